@@ -41,6 +41,18 @@ enum {
     ENV_NOT_RUNNABLE
 };
 
+/* Scheduling priorities (run queue indices), lower value runs first */
+enum {
+    ENV_PRIO_SERVER, /* System servers */
+    ENV_PRIO_NORMAL,
+    ENV_PRIO_IDLE, /* Runs only when nothing else can */
+    NENV_PRIO
+};
+
+/* Range of nice values, higher value means smaller CPU share */
+#define NICE_MIN (-20)
+#define NICE_MAX 19
+
 /* Special environment types */
 enum EnvType {
     ENV_TYPE_IDLE,
@@ -53,10 +65,44 @@ struct List {
     struct List *prev, *next;
 };
 
+/* Number of cached virtual tree lookups per address space */
+#define AS_LOOKUP_CACHE_SIZE 4
+
 struct AddressSpace {
     pml4e_t *pml4;     /* Virtual address of pml4 */
     uintptr_t cr3;     /* Physical address of pml4 */
     struct Page *root; /* root node of address space tree */
+    uint16_t pcid;     /* Process-context identifier (0 for kspace) */
+
+    /* Recently visited virtual tree nodes
+     * (node describes [addr, addr + 2^(class+12)) ) */
+    struct {
+        uintptr_t addr;
+        int class;
+        struct Page *node;
+    } lookup_cache[AS_LOOKUP_CACHE_SIZE];
+    unsigned lookup_cache_next;
+    size_t lookup_hits, lookup_misses;
+
+    unsigned color_next; /* Cache color of next allocated 4K page */
+};
+
+/* Access hints for sys_region_advise() */
+enum RegionAdvice {
+    ADVICE_NORMAL,     /* No special treatment (drops hints below) */
+    ADVICE_WILLNEED,   /* Region will be accessed soon, resolve lazy pages now */
+    ADVICE_DONTNEED,   /* Contents are not needed, replace private pages with zero pages */
+    ADVICE_SEQUENTIAL, /* Region is accessed sequentially, fault-around aggressively */
+    ADVICE_HUGEPAGE,   /* Resolve faults with huge pages */
+    ADVICE_NOHUGEPAGE, /* Never promote region to huge pages */
+};
+
+/* Maximal number of regions with persistent hints per environment */
+#define ENV_ADVICE_RANGES 8
+
+struct EnvAdvice {
+    uintptr_t start, end;
+    int advice;
 };
 
 struct EnqueuedSignal {
@@ -105,6 +151,25 @@ struct Env {
 
     sigset_t env_sig_waiting;       /* Signals to wait (for sys_sigwait) */
     int * env_sig_waiting_num_out;  /* Pointer to write number of signal (for sys_sigwait) */
+
+    /* Fault-around */
+    uintptr_t env_fault_next;  /* Next page fault address of sequential access */
+    size_t env_fault_window;   /* Number of pages resolved on next fault */
+    size_t env_faults_avoided; /* Number of pages resolved in advance */
+
+    /* Persistent access hints (SEQUENTIAL/HUGEPAGE/NOHUGEPAGE) */
+    struct EnvAdvice env_advice[ENV_ADVICE_RANGES];
+
+    /* Scheduling */
+    struct List env_runq;    /* Link in run queue of env_priority */
+    int env_priority;        /* ENV_PRIO_* */
+    bool env_queued;         /* Env is in run queue */
+    bool env_live;           /* Counted as ENV_RUNNABLE or ENV_RUNNING */
+    int env_nice;            /* NICE_MIN..NICE_MAX */
+    uint32_t env_weight;     /* CPU share weight derived from env_nice */
+    uint64_t env_vruntime;   /* Weighted CPU time consumed (TSC cycles) */
+    uint64_t env_exec_start; /* TSC value when env was last charged */
+    int env_cpunum;          /* CPU whose run queue holds env */
 };
 
 #endif /* !JOS_INC_ENV_H */
@@ -30,6 +30,7 @@ enum {
 
 
     E_AGAIN = 20,    
+    E_PERM = 21,     /* Operation not permitted */
     MAXERROR
 };
 
@@ -60,6 +60,9 @@ char *readline(const char *buf);
 /* sys_alloc_region() specific flags */
 #define ALLOC_ZERO 0x100000 /* Allocate memory filled with 0x00 */
 #define ALLOC_ONE  0x200000 /* Allocate memory filled with 0xFF */
+#define ALLOC_HUGE_2M  0x1000 /* Back with 2MB pages */
+#define ALLOC_HUGE_1G  0x2000 /* Back with 1GB pages */
+#define ALLOC_POPULATE 0x4000 /* Allocate memory immediately instead of lazily */
 
 /* Memory protection flags & attributes
  * NOTE These should be in-sync with kern/pmap.h
@@ -92,6 +95,8 @@ int sys_alloc_region(envid_t env, void *pg, size_t size, int perm);
 int sys_map_region(envid_t src_env, void *src_pg,
                    envid_t dst_env, void *dst_pg, size_t size, int perm);
 int sys_unmap_region(envid_t env, void *pg, size_t size);
+int sys_region_advise(envid_t env, void *va, size_t size, int advice);
+int sys_env_set_nice(envid_t env, int nice);
 int sys_ipc_try_send(envid_t to_env, uint64_t value, void *pg, size_t size, int perm);
 int sys_ipc_recv(void *rcv_pg, size_t size);
 int sys_gettime(void);
@@ -120,6 +120,14 @@
 #define KERN_PF_STACK_SIZE (16 * PAGE_SIZE)                                    /* size of a kernel stack */
 #define KERN_STACK_GAP     (8 * PAGE_SIZE)                                     /* size of a kernel stack guard */
 #define KERN_PF_STACK_TOP  (KERN_STACK_TOP - KERN_STACK_SIZE - KERN_STACK_GAP) /* size of page fault handler stack size */
+/* Both stacks of CPU i are located KERN_CPU_STACKS_SIZE * i below those of CPU0 */
+#define KERN_CPU_STACKS_SIZE (KERN_STACK_SIZE + KERN_PF_STACK_SIZE + 2 * KERN_STACK_GAP)
+
+/* Application processors start executing real mode code at this
+ * physical address, followed by pages of their boot page table */
+#define MPENTRY_PADDR 0x7000
+#define MPENTRY_PML4  (MPENTRY_PADDR + PAGE_SIZE)
+#define MPENTRY_SIZE  (4 * PAGE_SIZE)
 
 /* Memory-mapped IO */
 #define KERN_HEAP_END   (KERN_STACK_TOP - HUGE_PAGE_SIZE)
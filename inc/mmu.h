@@ -139,12 +139,26 @@
 #define CR4_SMAP       0x00200000 /* SMAP Enable */
 #define CR4_PKE        0x00400000 /* Protected Key Enable */
 
+/* Control Register 3 flags (with CR4_PCIDE set) */
+#define CR3_PCID_MASK 0x0000000000000FFFULL /* Process-context identifier */
+#define CR3_NOFLUSH   0x8000000000000000ULL /* Preserve TLB entries of loaded PCID */
+#define NPCID         4096                  /* Number of PCIDs */
+
+/* CPUID feature flags */
+#define CPUID_1_ECX_PCID     (1U << 17) /* Process-context identifiers */
+#define CPUID_1_ECX_TSC_DL   (1U << 24) /* Local APIC timer TSC-deadline mode */
+#define CPUID_7_EBX_INVPCID  (1U << 10) /* INVPCID instruction */
+#define CPUID_80000001_EDX_PAGE1GB (1U << 26) /* 1GB pages */
+
 /* x86_64 related changes */
 #define EFER_MSR 0xC0000080
 #define EFER_LME (1ULL << 8)
 #define EFER_LMA (1ULL << 10)
 #define EFER_NXE (1ULL << 11)
 
+/* Local APIC timer fires when TSC reaches this value */
+#define TSC_DEADLINE_MSR 0x6E0
+
 /* RFLAGS register */
 #define FL_CF        0x00000001 /* Carry Flag */
 #define FL_PF        0x00000004 /* Parity Flag */
@@ -23,6 +23,8 @@ enum {
     SYS_sigwait,
     SYS_sigaction,
     SYS_sigprocmask,
+    SYS_region_advise,
+    SYS_env_set_nice,
     NSYSCALLS
 };
 
@@ -26,8 +26,10 @@
 
 /* These are arbitrarily chosen, but with care not to overlap
  * processor defined exceptions or interrupt vectors.*/
-#define T_SYSCALL 48  /* system call */
-#define T_DEFAULT 500 /* catchall */
+#define T_SYSCALL  48  /* system call */
+#define T_TLBFLUSH 49  /* TLB shootdown IPI */
+#define T_RESCHED  50  /* reschedule IPI */
+#define T_DEFAULT  500 /* catchall */
 
 #define IRQ_OFFSET 32 /* IRQ 0 corresponds to int IRQ_OFFSET */
 
@@ -104,6 +104,36 @@ invlpg(void *addr) {
                  : "memory");
 }
 
+/* INVPCID invalidation types */
+#define INVPCID_ADDR       0 /* Single address of single PCID */
+#define INVPCID_SINGLE     1 /* All non-global entries of single PCID */
+#define INVPCID_ALL_GLOBAL 2 /* All entries including global ones */
+#define INVPCID_ALL        3 /* All non-global entries */
+
+static inline void __attribute__((always_inline))
+invpcid(uint64_t type, uint64_t pcid, uintptr_t addr) {
+    struct {
+        uint64_t pcid;
+        uint64_t addr;
+    } desc = {pcid, addr};
+    asm volatile("invpcid %0, %1" ::"m"(desc), "r"(type)
+                 : "memory");
+}
+
+/* Store 64-bit value bypassing caches */
+static inline void __attribute__((always_inline))
+movnti(uint64_t *dst, uint64_t val) {
+    asm volatile("movnti %1, %0"
+                 : "=m"(*dst)
+                 : "r"(val));
+}
+
+static inline void __attribute__((always_inline))
+sfence(void) {
+    asm volatile("sfence" ::
+                         : "memory");
+}
+
 static inline void __attribute__((always_inline))
 lidt(void *p) {
     asm volatile("lidt (%0)" ::"r"(p));
@@ -124,6 +154,14 @@ ltr(uint16_t sel) {
     asm volatile("ltr %0" ::"r"(sel));
 }
 
+static inline uint16_t __attribute__((always_inline))
+read_tr(void) {
+    uint16_t sel;
+    asm volatile("str %0"
+                 : "=r"(sel));
+    return sel;
+}
+
 static inline void __attribute__((always_inline))
 lcr0(uint64_t val) {
     asm volatile("movq %0,%%cr0" ::"r"(val));
@@ -183,9 +221,7 @@ rdmsr(uint32_t msr) {
 static inline void __attribute__((always_inline))
 wrmsr(uint32_t msr, uint64_t val) {
     uint64_t rax = val & 0xFFFFFFFF, rdx = val >> 32;
-    asm volatile("rdmsr"
-                 : "=a"(rax), "=d"(rdx)
-                 : "c"(msr));
+    asm volatile("wrmsr" ::"c"(msr), "a"(rax), "d"(rdx));
 }
 
 static inline void __attribute__((always_inline))
@@ -245,6 +281,18 @@ cpuid(uint32_t info, uint32_t *raxp, uint32_t *rbxp, uint32_t *rcxp, uint32_t *r
     if (rdxp) *rdxp = edx;
 }
 
+static inline void __attribute__((always_inline))
+cpuid_count(uint32_t info, uint32_t subleaf, uint32_t *raxp, uint32_t *rbxp, uint32_t *rcxp, uint32_t *rdxp) {
+    uint32_t eax, ebx, ecx, edx;
+    asm volatile("cpuid"
+                 : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+                 : "a"(info), "c"(subleaf));
+    if (raxp) *raxp = eax;
+    if (rbxp) *rbxp = ebx;
+    if (rcxp) *rcxp = ecx;
+    if (rdxp) *rdxp = edx;
+}
+
 static inline uint64_t __attribute__((always_inline))
 read_tsc(void) {
     uint32_t lo, hi;
@@ -1,114 +1,305 @@
 #include <inc/types.h>
-#include <kern/alloc.h>
 #include <inc/assert.h>
+#include <inc/string.h>
+#include <inc/x86.h>
+#include <kern/alloc.h>
+#include <kern/pmap.h>
 #include <kern/spinlock.h>
 
-#define SPACE_SIZE 5 * 0x1000
+/* Objects are aligned on this boundary */
+#define KMEM_ALIGN 16
 
-static uint8_t space[SPACE_SIZE];
+/* Number of objects moved between per-CPU stack and slabs at once */
+#define KMEM_BATCH (KMEM_CPU_CACHE / 2)
 
-/* empty list to get started */
-static Header base = {.next = (Header *)space, .prev = (Header *)space};
-/* start of free list */
-static Header *freep = NULL;
+/*
+ * Slab header is stored at the beginning of its page
+ * followed by stack of free object indices and objects.
+ * Header of large (page sized) allocation has NULL cache,
+ * so kfree() can distinguish them.
+ */
+struct Slab {
+    struct KmemCache *cache;
+    struct Slab *next, *prev;
+    size_t nfree;         /* Number of free objects */
+    int class;            /* Page class of large allocation */
+    uint16_t free_idx[];  /* Free object indices */
+};
 
-static void
-check_list(void) {
+#define LARGE_OFFSET ROUNDUP(sizeof(struct Slab), KMEM_ALIGN)
+
+/* Protects slab lists of all caches */
+static struct spinlock kmem_lock = {
+#if trace_spinlock
+        .name = "kmem_lock"
+#endif
+};
+
+/* Generic caches used by kmalloc() */
+static struct KmemCache kmalloc_caches[] = {
+        {.name = "kmalloc-16", .size = 16},
+        {.name = "kmalloc-32", .size = 32},
+        {.name = "kmalloc-64", .size = 64},
+        {.name = "kmalloc-128", .size = 128},
+        {.name = "kmalloc-256", .size = 256},
+        {.name = "kmalloc-512", .size = 512},
+        {.name = "kmalloc-1024", .size = KMALLOC_MAX_SLAB},
+};
+
+#define NKMALLOC_CACHES (sizeof(kmalloc_caches) / sizeof(*kmalloc_caches))
+
+/* Per-CPU stacks make descriptor larger than KMALLOC_MAX_SLAB,
+ * so descriptors created by kmem_cache_create() take whole pages */
+static_assert(sizeof(struct KmemCache) <= PAGE_SIZE, "KmemCache descriptor does not fit into page");
+
+/* List of all initialized caches */
+static struct KmemCache *caches;
+
+/* Large allocation statistics */
+static size_t large_allocs, large_frees;
+
+/* Disable interrupts protecting per-CPU data,
+ * returns previous flags for kmem_irq_restore() */
+static uint64_t
+kmem_irq_save(void) {
+    uint64_t rflags = read_rflags();
     asm volatile("cli");
-    Header *prevp = freep, *p = prevp->next;
-    for (; p != freep; p = p->next) {
-        if (prevp != p->prev) panic("Corrupted list.\n");
-        prevp = p;
-    }
-    asm volatile("sti");
+    return rflags;
 }
 
-/* malloc: general-purpose storage allocator */
-void *
-test_alloc(uint8_t nbytes) {
+static void
+kmem_irq_restore(uint64_t rflags) {
+    if (rflags & FL_IF) asm volatile("sti");
+}
+
+static void
+slab_list_add(struct Slab **head, struct Slab *slab) {
+    slab->prev = NULL;
+    slab->next = *head;
+    if (*head) (*head)->prev = slab;
+    *head = slab;
+}
+
+static void
+slab_list_del(struct Slab **head, struct Slab *slab) {
+    if (slab->prev)
+        slab->prev->next = slab->next;
+    else
+        *head = slab->next;
+    if (slab->next) slab->next->prev = slab->prev;
+    slab->next = slab->prev = NULL;
+}
 
-    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
-    // LAB 5: Your code here
-    spin_lock(&kernel_lock);
+/* Compute slab layout of cache on first use */
+static void
+cache_init(struct KmemCache *cache) {
+    cache->size = ROUNDUP(MAX(cache->size, (size_t)KMEM_ALIGN), KMEM_ALIGN);
+    assert(cache->size <= KMALLOC_MAX_SLAB);
 
-    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+    size_t n = (PAGE_SIZE - sizeof(struct Slab)) / (cache->size + sizeof(uint16_t));
+    while (ROUNDUP(sizeof(struct Slab) + n * sizeof(uint16_t), KMEM_ALIGN) + n * cache->size > PAGE_SIZE) n--;
+    assert(n);
 
-    /* no free list yet */
-    if (!freep) {
-        Header *hd = (Header *)&space;
+    cache->objs_per_slab = n;
+    cache->offset = ROUNDUP(sizeof(struct Slab) + n * sizeof(uint16_t), KMEM_ALIGN);
+    cache->next = caches;
+    caches = cache;
+}
 
-        hd->next = (Header *)&base;
-        hd->prev = (Header *)&base;
-        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+/* Allocate new slab and construct all of its objects */
+static struct Slab *
+slab_create(struct KmemCache *cache) {
+    struct Slab *slab = kalloc_pages(0);
+    if (!slab) return NULL;
 
-        freep = &base;
+    slab->cache = cache;
+    slab->next = slab->prev = NULL;
+    slab->nfree = cache->objs_per_slab;
+    for (size_t i = 0; i < cache->objs_per_slab; i++) {
+        slab->free_idx[i] = cache->objs_per_slab - i - 1;
+        if (cache->ctor) cache->ctor((uint8_t *)slab + cache->offset + i * cache->size);
     }
 
-    check_list();
-
-    for (Header *p = freep->next;; p = p->next) {
-        /* big enough */
-        if (p->size >= nunits) {
-            freep = p->prev;
-            /* exactly */
-            if (p->size == nunits) {
-                p->prev->next = p->next;
-                p->next->prev = p->prev;
-            } else { /* allocate tail end */
-                p->size -= nunits;
-                p += p->size;
-                p->size = nunits;
-            }
-            spin_unlock(&kernel_lock);
-            return (void *)(p + 1);
+    cache->slabs++;
+    cache->slab_allocs++;
+    return slab;
+}
+
+/* Move up to count objects from slabs to per-CPU stack */
+static void
+cache_refill(struct KmemCache *cache, size_t cpu, size_t count) {
+    spin_lock(&kmem_lock);
+    if (!cache->objs_per_slab) cache_init(cache);
+
+    while (count--) {
+        struct Slab *slab = cache->partial;
+        if (!slab && (slab = cache->empty)) {
+            slab_list_del(&cache->empty, slab);
+            slab_list_add(&cache->partial, slab);
         }
+        if (!slab && (slab = slab_create(cache))) slab_list_add(&cache->partial, slab);
+        if (!slab) break;
+
+        size_t idx = slab->free_idx[--slab->nfree];
+        cache->cpu[cpu].objs[cache->cpu[cpu].count++] = (uint8_t *)slab + cache->offset + idx * cache->size;
 
-        /* wrapped around free list */
-        if (p == freep) {
-            spin_unlock(&kernel_lock);
-            return NULL;
+        if (!slab->nfree) {
+            slab_list_del(&cache->partial, slab);
+            slab_list_add(&cache->full, slab);
+        }
+    }
+    spin_unlock(&kmem_lock);
+}
+
+/* Return up to count objects from per-CPU stack to their slabs.
+ * Only one empty slab is kept, others are released */
+static void
+cache_flush(struct KmemCache *cache, size_t cpu, size_t count) {
+    spin_lock(&kmem_lock);
+    while (count-- && cache->cpu[cpu].count) {
+        uint8_t *obj = cache->cpu[cpu].objs[--cache->cpu[cpu].count];
+        struct Slab *slab = (struct Slab *)ROUNDDOWN(obj, PAGE_SIZE);
+        assert(slab->cache == cache);
+
+        size_t idx = (obj - (uint8_t *)slab - cache->offset) / cache->size;
+        if (!slab->nfree) {
+            slab_list_del(&cache->full, slab);
+            slab_list_add(&cache->partial, slab);
+        }
+        slab->free_idx[slab->nfree++] = idx;
+
+        if (slab->nfree == cache->objs_per_slab) {
+            slab_list_del(&cache->partial, slab);
+            if (cache->empty) {
+                cache->slabs--;
+                cache->slab_frees++;
+                kfree_pages(slab, 0);
+            } else {
+                slab_list_add(&cache->empty, slab);
+            }
         }
     }
+    spin_unlock(&kmem_lock);
+}
+
+/* Create cache of objects of given size, ctor (if not NULL)
+ * is called once for every object when its slab is allocated,
+ * freed objects are expected to be returned in constructed state */
+struct KmemCache *
+kmem_cache_create(const char *name, size_t size, void (*ctor)(void *obj)) {
+    if (!size || size > KMALLOC_MAX_SLAB) return NULL;
+
+    struct KmemCache *cache = kalloc_pages(0);
+    if (!cache) return NULL;
 
-    spin_unlock(&kernel_lock);
+    memset(cache, 0, sizeof(*cache));
+    cache->name = name;
+    cache->size = size;
+    cache->ctor = ctor;
+    return cache;
+}
+
+void *
+kmem_cache_alloc(struct KmemCache *cache) {
+    uint64_t rflags = kmem_irq_save();
+
+    size_t cpu = cpunum();
+    if (cache->cpu[cpu].count)
+        cache->cpu_hits++;
+    else
+        cache_refill(cache, cpu, KMEM_BATCH);
+
+    void *obj = NULL;
+    if (cache->cpu[cpu].count) {
+        obj = cache->cpu[cpu].objs[--cache->cpu[cpu].count];
+        cache->allocs++;
+    }
+
+    kmem_irq_restore(rflags);
+
+#ifdef SANITIZE_SHADOW_BASE
+    if (obj) platform_asan_unpoison(obj, cache->size);
+#endif
+    return obj;
 }
 
-/* free: put block ap in free list */
 void
-test_free(void *ap) {
+kmem_cache_free(struct KmemCache *cache, void *obj) {
+    if (!obj) return;
+    assert(((struct Slab *)ROUNDDOWN(obj, PAGE_SIZE))->cache == cache);
+
+#ifdef SANITIZE_SHADOW_BASE
+    platform_asan_poison(obj, cache->size);
+#endif
+
+    uint64_t rflags = kmem_irq_save();
+
+    size_t cpu = cpunum();
+    if (cache->cpu[cpu].count == KMEM_CPU_CACHE)
+        cache_flush(cache, cpu, KMEM_BATCH);
+    cache->cpu[cpu].objs[cache->cpu[cpu].count++] = obj;
+    cache->frees++;
+
+    kmem_irq_restore(rflags);
+}
+
+/* Allocate size bytes of kernel memory */
+void *
+kmalloc(size_t size) {
+    for (size_t i = 0; i < NKMALLOC_CACHES; i++)
+        if (size <= kmalloc_caches[i].size) return kmem_cache_alloc(&kmalloc_caches[i]);
 
-    /* point to block header */
-    Header *bp = (Header *)ap - 1;
-
-    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
-    // LAB 5: Your code here
-    spin_lock(&kernel_lock);
-
-    /* freed block at start or end of arena */
-    Header *p = freep;
-    for (; !(bp > p && bp < p->next); p = p->next)
-        if (p >= p->next && (bp > p || bp < p->next)) break;
-
-    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
-        p->size += bp->size + p->next->size;
-        p->next->next->prev = p;
-        p->next = p->next->next;
-    } else if (bp + bp->size == p->next) /* join to upper nbr */ {
-        bp->size += p->next->size;
-        bp->next = p->next->next;
-        bp->prev = p->next->prev;
-        p->next->next->prev = bp;
-        p->next = bp;
-    } else if (p + p->size == bp) /* join to lower nbr */ {
-        p->size += bp->size;
+    /* Too large for slabs, use whole pages with header */
+    int class = 0;
+    while (CLASS_SIZE(class) < size + LARGE_OFFSET) class++;
+    if (class > MAX_ALLOCATION_CLASS) return NULL;
+
+    struct Slab *hdr = kalloc_pages(class);
+    if (!hdr) return NULL;
+    hdr->cache = NULL;
+    hdr->class = class;
+    large_allocs++;
+    return (uint8_t *)hdr + LARGE_OFFSET;
+}
+
+void *
+kzalloc(size_t size) {
+    void *ptr = kmalloc(size);
+    if (ptr) memset(ptr, 0, size);
+    return ptr;
+}
+
+void
+kfree(void *ptr) {
+    if (!ptr) return;
+
+    struct Slab *slab = (struct Slab *)ROUNDDOWN(ptr, PAGE_SIZE);
+    if (slab->cache) {
+        kmem_cache_free(slab->cache, ptr);
     } else {
-        bp->next = p->next;
-        bp->prev = p;
-        p->next->prev = bp;
-        p->next = bp;
+        assert((uint8_t *)ptr == (uint8_t *)slab + LARGE_OFFSET);
+        large_frees++;
+        kfree_pages(slab, slab->class);
     }
-    freep = p;
+}
 
-    check_list();
-    spin_unlock(&kernel_lock);
+void
+dump_kmem_stats(void) {
+    cprintf("%-14s %6s %5s %8s %8s %8s %8s\n", "cache", "size", "slabs", "allocs", "frees", "cpu hits", "inuse");
+    for (struct KmemCache *cache = caches; cache; cache = cache->next) {
+        cprintf("%-14s %6zu %5zu %8zu %8zu %8zu %8zu\n", cache->name, cache->size, cache->slabs,
+                cache->allocs, cache->frees, cache->cpu_hits, cache->allocs - cache->frees);
+    }
+    cprintf("Large allocations: %zu allocs, %zu frees\n", large_allocs, large_frees);
+}
+
+/* Kernel space test programs (prog/) bind to these names */
+void *
+test_alloc(uint8_t nbytes) {
+    return kmalloc(nbytes);
+}
+
+void
+test_free(void *ap) {
+    kfree(ap);
 }
@@ -2,17 +2,50 @@
 #define JOS_INC_ALLOC_H
 
 #include <inc/types.h>
+#include <kern/cpu.h>
 
-/* block header */
-struct header {
-    /* next block */
-    struct header *next;
-    /* prev block */
-    struct header *prev;
-    /* size of this block */
-    size_t size;
-} __attribute__((packed, aligned(_Alignof(max_align_t))));
-
-typedef struct header Header;
+/* Largest object size served from slabs,
+ * larger allocations take whole pages */
+#define KMALLOC_MAX_SLAB 1024
+
+/* Number of objects cached per CPU for each cache */
+#define KMEM_CPU_CACHE 16
+
+struct Slab;
+
+/* Cache of equally sized kernel objects */
+struct KmemCache {
+    const char *name;
+    size_t size;               /* Object size (rounded up to alignment) */
+    size_t objs_per_slab;      /* Number of objects per slab page */
+    size_t offset;             /* Offset of the first object within slab page */
+    void (*ctor)(void *obj);   /* Called once for every object of new slab */
+
+    struct Slab *partial;      /* Slabs having both free and used objects */
+    struct Slab *full;         /* Slabs with all objects used */
+    struct Slab *empty;        /* Slabs with all objects free */
+
+    /* Per-CPU free object stacks (O(1) fast path) */
+    struct {
+        size_t count;
+        void *objs[KMEM_CPU_CACHE];
+    } cpu[NCPU];
+
+    struct KmemCache *next;    /* All caches list */
+
+    /* Statistics */
+    size_t allocs, frees, cpu_hits;
+    size_t slabs, slab_allocs, slab_frees;
+};
+
+struct KmemCache *kmem_cache_create(const char *name, size_t size, void (*ctor)(void *obj));
+void *kmem_cache_alloc(struct KmemCache *cache);
+void kmem_cache_free(struct KmemCache *cache, void *obj);
+
+void *kmalloc(size_t size);
+void *kzalloc(size_t size);
+void kfree(void *ptr);
+
+void dump_kmem_stats(void);
 
 #endif
@@ -1,4 +1,3 @@
-
 #ifndef JOS_INC_CPU_H
 #define JOS_INC_CPU_H
 
@@ -7,10 +6,49 @@
 #include <inc/mmu.h>
 #include <inc/env.h>
 
-#define NCPU 1
+/* Maximum number of CPUs */
+#define NCPU 8
+
+/* Values of status in struct CpuInfo */
+enum {
+    CPU_UNUSED = 0,
+    CPU_STARTED,
+    CPU_HALTED,
+};
+
+struct AddressSpace;
+
+/* Per-CPU state */
+struct CpuInfo {
+    uint8_t cpu_id;                 /* Local APIC ID */
+    volatile unsigned cpu_status;   /* The status of the CPU */
+    struct Env *cpu_env;            /* The currently-running environment */
+    struct AddressSpace *cpu_space; /* Address space loaded into CR3 */
+    volatile bool cpu_tlb_flush;    /* TLB shootdown requested by other CPU */
+    struct Taskstate cpu_ts;        /* Used by x86 to find stack for interrupt */
+};
+
+/* Initialized in mpconfig.c */
+extern struct CpuInfo cpus[NCPU];
+extern size_t ncpu;                 /* Total number of CPUs in the system */
+extern struct CpuInfo *bootcpu;     /* The boot-strap processor (BSP) */
+extern uint8_t apicid_to_cpu[256];  /* Index in cpus[] by local APIC ID */
+extern physaddr_t lapic_pa;         /* Physical MMIO address of the local APIC */
+
+/* Per-CPU kernel stacks */
+extern void *mpentry_kstack;
+
+int cpunum(void);
+#define thiscpu (&cpus[cpunum()])
+
+void mp_init(void);
+void lapic_init(void);
+int lapic_cpunum(void);
+void lapic_eoi(void);
+void lapic_ipi(int cpu, int vector);
+void lapic_startap(uint8_t apicid, physaddr_t addr);
 
-/* Used by x86 to find stack for interrupt */
-extern struct Taskstate cpu_ts;
+void tlb_shootdown_serve(void);
 
 extern char in_intr;
 extern bool in_clk_intr;
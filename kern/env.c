@@ -19,9 +19,7 @@
 #include <kern/traceopt.h>
 #include <kern/syscall.h>
 #include <kern/vsyscall.h>
-
-/* Currently active environment */
-struct Env *curenv = NULL;
+#include <kern/spinlock.h>
 
 #ifdef CONFIG_KSPACE
 /* All environments */
@@ -121,6 +119,8 @@ env_init(void) {
 
     // LAB 3: Your code here
 
+    sched_init();
+
     env_free_list = envs;
     for (size_t i = 0; i < NENV; ++i)
     {
@@ -170,6 +170,10 @@ env_alloc(struct Env **newenv_store, envid_t parent_id, enum EnvType type) {
 #endif
     env->env_status = ENV_RUNNABLE;
     env->env_runs = 0;
+    env->env_priority = type == ENV_TYPE_FS ? ENV_PRIO_SERVER :
+                        type == ENV_TYPE_IDLE ? ENV_PRIO_IDLE : ENV_PRIO_NORMAL;
+    env->env_vruntime = 0;
+    sched_set_nice(env, 0);
 
     /* Clear out all the saved register state,
      * to prevent the register values
@@ -242,10 +246,70 @@ env_alloc(struct Env **newenv_store, envid_t parent_id, enum EnvType type) {
     env->env_sig_waiting = 0;
     env->env_sig_waiting_num_out = 0;
 
+    env->env_fault_next = 0;
+    env->env_fault_window = 0;
+    env->env_faults_avoided = 0;
+    memset(env->env_advice, 0, sizeof(env->env_advice));
+
+    /* New env starts on the CPU of its creator */
+    env->env_cpunum = cpunum();
+    sched_update(env);
+
     if (trace_envs) cprintf("[%08x] new env %08x\n", curenv ? curenv->env_id : 0, env->env_id);
     return 0;
 }
 
+/* Get persistent access hint for the page containing va */
+int
+env_advice(struct Env *env, uintptr_t va) {
+    for (size_t i = 0; i < ENV_ADVICE_RANGES; i++)
+        if (env->env_advice[i].start <= va && va < env->env_advice[i].end)
+            return env->env_advice[i].advice;
+    return ADVICE_NORMAL;
+}
+
+/* Largest part of shared page copied on write fault at va */
+int
+env_fault_class(struct Env *env, uintptr_t va) {
+    return env_advice(env, va) == ADVICE_HUGEPAGE ? MAX_ALLOCATION_CLASS : cow_copy_class;
+}
+
+/* Replace hints of [start, end) with advice (ADVICE_NORMAL just drops them).
+ * Overlapping ranges are trimmed or split, and if that does not
+ * fit in ENV_ADVICE_RANGES, nothing is changed and -E_NO_MEM is returned */
+int
+env_set_advice(struct Env *env, uintptr_t start, uintptr_t end, int advice) {
+    struct EnvAdvice res[ENV_ADVICE_RANGES] = {0};
+    size_t n = 0;
+
+    for (size_t i = 0; i < ENV_ADVICE_RANGES; i++) {
+        struct EnvAdvice *old = &env->env_advice[i];
+        if (old->start >= old->end) continue;
+
+        if (old->end <= start || end <= old->start) {
+            if (n == ENV_ADVICE_RANGES) return -E_NO_MEM;
+            res[n++] = *old;
+            continue;
+        }
+        if (old->start < start) {
+            if (n == ENV_ADVICE_RANGES) return -E_NO_MEM;
+            res[n++] = (struct EnvAdvice){old->start, start, old->advice};
+        }
+        if (end < old->end) {
+            if (n == ENV_ADVICE_RANGES) return -E_NO_MEM;
+            res[n++] = (struct EnvAdvice){end, old->end, old->advice};
+        }
+    }
+
+    if (advice != ADVICE_NORMAL) {
+        if (n == ENV_ADVICE_RANGES) return -E_NO_MEM;
+        res[n++] = (struct EnvAdvice){start, end, advice};
+    }
+
+    memcpy(env->env_advice, res, sizeof(res));
+    return 0;
+}
+
 /* Pass the original ELF image to binary/size and bind all the symbols within
  * its loaded address space specified by image_start/image_end.
  * Make sure you understand why you need to check that each binding
@@ -481,6 +545,7 @@ env_free(struct Env *env) {
 
     /* Return the environment to the free list */
     env->env_status = ENV_FREE;
+    sched_update(env);
     env->env_link = env_free_list;
     env_free_list = env;
 }
@@ -516,6 +581,13 @@ env_destroy(struct Env *env) {
     // LAB 3: Your code here
     maybe_send_sigchld(env->env_parent_id, true);
 
+    if (env != curenv && cpus[env->env_cpunum].cpu_env == env) {
+        env->env_status = ENV_DYING;
+        sched_update(env);
+        lapic_ipi(env->env_cpunum, T_RESCHED);
+        return;
+    }
+
     env_free(env);
     if (curenv == env)
         sched_yield();
@@ -546,6 +618,9 @@ csys_yield(struct Trapframe *tf) {
 
 _Noreturn void
 env_pop_tf(struct Trapframe *tf) {
+    /* Release the big kernel lock when leaving to user mode */
+    if ((tf->tf_cs & 3) == 3) unlock_kernel();
+
     asm volatile(
             "movq %0, %%rsp\n"
             "movq 0(%%rsp), %%r15\n"
@@ -629,6 +704,9 @@ env_run(struct Env *env) {
         curenv->env_status = ENV_RUNNABLE;
     }
 
+    /* CPU time is charged from the moment of switch */
+    if (curenv != env) env->env_exec_start = read_tsc();
+
     curenv = env;
     curenv->env_status = ENV_RUNNING;
     ++curenv->env_runs;
@@ -637,6 +715,9 @@ env_run(struct Env *env) {
     assert(!curenv->env_sig_waiting);
     env_maybe_run_signal_handler();
 
+    /* Program the next timer interrupt */
+    sched_tick(env);
+
     // LAB 8: Your code here
     switch_address_space(&env->address_space);
     env_pop_tf(&curenv->env_tf);
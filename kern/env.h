@@ -4,13 +4,12 @@
 #define JOS_KERN_ENV_H
 
 #include <inc/env.h>
-
-#define NCPU 1
+#include <kern/cpu.h>
 
 /* All environments */
 extern struct Env *envs;
 /* Currently active environment */
-extern struct Env *curenv;
+#define curenv (thiscpu->cpu_env)
 extern struct Segdesc32 gdt[];
 
 void env_init(void);
@@ -21,6 +20,9 @@ void env_destroy(struct Env *env);
 
 void maybe_send_sigchld(envid_t penvid, bool on_destroy);
 int envid2env(envid_t envid, struct Env **env_store, bool checkperm);
+int env_advice(struct Env *env, uintptr_t va);
+int env_fault_class(struct Env *env, uintptr_t va);
+int env_set_advice(struct Env *env, uintptr_t start, uintptr_t end, int advice);
 _Noreturn void env_run(struct Env *e);
 _Noreturn void env_pop_tf(struct Trapframe *tf);
 
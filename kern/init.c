@@ -18,6 +18,8 @@
 #include <kern/kclock.h>
 #include <kern/kdebug.h>
 #include <kern/traceopt.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
 
 void
 timers_init(void) {
@@ -26,6 +28,8 @@ timers_init(void) {
     timertab[2] = timer_acpipm;
     timertab[3] = timer_hpet0;
     timertab[4] = timer_hpet1;
+    timertab[5] = timer_lapic;
+    timertab[6] = timer_lapic_periodic;
 
     for (int i = 0; i < MAX_TIMERS; i++) {
         if (timertab[i].timer_init) {
@@ -125,6 +129,72 @@ early_boot_pml4_init(void) {
 #endif
 }
 
+/* Kernel stack top for mp_main() of the AP being started */
+void *mpentry_kstack;
+
+static_assert(KERN_CPU_STACKS_SIZE * NCPU <= HUGE_PAGE_SIZE, "Kernel stacks of all CPUs should fit below KERN_STACK_TOP");
+
+/* Start the non-boot processors (APs) one by one */
+static void
+boot_aps(void) {
+    extern unsigned char mpentry_start[], mpentry_end[];
+
+    /* Write entry code to unused memory at MPENTRY_PADDR */
+    memmove(KADDR(MPENTRY_PADDR), mpentry_start, mpentry_end - mpentry_start);
+
+    /* Boot page table maps the first 2MB of physical memory
+     * identically for the entry code and the rest like kspace */
+    pml4e_t *pml4 = KADDR(MPENTRY_PML4);
+    pdpe_t *pdp = KADDR(MPENTRY_PML4 + PAGE_SIZE);
+    pde_t *pd = KADDR(MPENTRY_PML4 + 2 * PAGE_SIZE);
+    memcpy(pml4, kspace.pml4, PAGE_SIZE);
+    memset(pdp, 0, PAGE_SIZE);
+    memset(pd, 0, PAGE_SIZE);
+    pml4[0] = (MPENTRY_PML4 + PAGE_SIZE) | PTE_P | PTE_W;
+    pdp[0] = (MPENTRY_PML4 + 2 * PAGE_SIZE) | PTE_P | PTE_W;
+    pd[0] = PTE_P | PTE_W | PTE_PS;
+
+    for (size_t i = 1; i < ncpu; i++) {
+        uintptr_t top = KERN_STACK_TOP - i * KERN_CPU_STACKS_SIZE;
+        uintptr_t pftop = KERN_PF_STACK_TOP - i * KERN_CPU_STACKS_SIZE;
+
+        /* Stacks should not be lazy: the first touch
+         * happens when CPU pushes trap frame */
+        if (map_populated_region(&kspace, top - KERN_STACK_SIZE, KERN_STACK_SIZE, 0, PROT_R | PROT_W) ||
+            map_populated_region(&kspace, pftop - KERN_PF_STACK_SIZE, KERN_PF_STACK_SIZE, 0, PROT_R | PROT_W))
+            panic("Cannot allocate kernel stacks for CPU %zu", i);
+#ifdef SANITIZE_SHADOW_BASE
+        platform_asan_unpoison((void *)(top - KERN_STACK_SIZE), KERN_STACK_SIZE);
+        platform_asan_unpoison((void *)(pftop - KERN_PF_STACK_SIZE), KERN_PF_STACK_SIZE);
+#endif
+
+        /* Start the CPU at mpentry_start and
+         * wait for it to finish its basic setup in mp_main() */
+        mpentry_kstack = (void *)top;
+        lapic_startap(cpus[i].cpu_id, MPENTRY_PADDR);
+        while (cpus[i].cpu_status != CPU_STARTED)
+            asm volatile("pause");
+    }
+}
+
+/* Setup code for APs */
+void
+mp_main(void) {
+    trap_init_percpu();
+    init_memory_percpu();
+    lapic_init();
+    if (timer_for_schedule->timer_percpu) timer_for_schedule->enable_interrupts();
+    cprintf("SMP: CPU %d starting\n", thiscpu->cpu_id);
+
+    /* Tell boot_aps() we're up */
+    xchg(&thiscpu->cpu_status, CPU_STARTED);
+
+    /* Now that we have finished some basic setup, run
+     * environments after acquiring the big kernel lock */
+    lock_kernel();
+    sched_yield();
+}
+
 void
 i386_init(void) {
 
@@ -147,6 +217,10 @@ i386_init(void) {
     pic_init();
     timers_init();
 
+    /* Lab 12 multiprocessor initialization functions */
+    mp_init();
+    lapic_init();
+
     /* Framebuffer init should be done after memory init */
     fb_init();
     if (trace_init) cprintf("Framebuffer initialised\n");
@@ -154,8 +228,18 @@ i386_init(void) {
     /* User environment initialization functions */
     env_init();
 
-    /* Choose the timer used for scheduling: hpet or pit */
-    timers_schedule("hpet0");
+    /* Choose the timer used for scheduling: local APIC timer
+     * interrupts every CPU in one-shot (tickless) mode,
+     * hpet goes through PIC to BSP only */
+    timers_schedule(lapic_pa ? "lapic" : "hpet0");
+
+    /* Acquire the big kernel lock before waking up APs */
+    lock_kernel();
+
+#ifndef CONFIG_KSPACE
+    /* Starting non-boot CPUs */
+    boot_aps();
+#endif
 
 #ifdef CONFIG_KSPACE
     /* Touch all you want */
@@ -6,6 +6,7 @@
 #include <kern/timer.h>
 #include <kern/trap.h>
 #include <kern/picirq.h>
+#include <kern/tsc.h>
 
 /* HINT: Note that selected CMOS
  * register is reset to the first one
@@ -125,6 +126,29 @@ gettime(void) {
     return res;
 }
 
+/* CMOS time read once and TSC value at that moment */
+static int rtc_base;
+static uint64_t rtc_base_tsc;
+
+/* Time extrapolated with TSC from CMOS time read once,
+ * cheap enough to be called on every timer tick */
+int
+gettime_tsc(void) {
+    if (!rtc_base_tsc) {
+        rtc_base = gettime();
+        rtc_base_tsc = read_tsc();
+    }
+    return rtc_base + (read_tsc() - rtc_base_tsc) / tsc_calibrate();
+}
+
+/* TSC value at which gettime_tsc() changes next */
+uint64_t
+gettime_tsc_next(void) {
+    uint64_t freq = tsc_calibrate();
+    if (!rtc_base_tsc) gettime_tsc();
+    return rtc_base_tsc + ((read_tsc() - rtc_base_tsc) / freq + 1) * freq;
+}
+
 void
 rtc_timer_init(void) {
     // LAB 4: Your code here
@@ -62,6 +62,8 @@ void cmos_write8(uint8_t reg, uint8_t datum);
 uint16_t cmos_read16(uint8_t reg);
 
 int gettime(void);
+int gettime_tsc(void);
+uint64_t gettime_tsc_next(void);
 
 #define BCD2BIN(bcd) ({uint8_t bcd__ = (bcd); ((bcd__ & 15) + (bcd__ >> 4) * 10); })
 
@@ -0,0 +1,279 @@
+/* The local APIC manages internal (non-I/O) interrupts.
+ * See Chapter 8 & Appendix C of Intel processor manual volume 3 */
+
+#include <inc/types.h>
+#include <inc/memlayout.h>
+#include <inc/trap.h>
+#include <inc/mmu.h>
+#include <inc/stdio.h>
+#include <inc/x86.h>
+#include <kern/pmap.h>
+#include <kern/cpu.h>
+#include <kern/tsc.h>
+#include <kern/timer.h>
+
+/* Local APIC registers, divided by 4 for use as uint32_t[] indices */
+#define ID    (0x0020 / 4) /* ID */
+#define VER   (0x0030 / 4) /* Version */
+#define TPR   (0x0080 / 4) /* Task Priority */
+#define EOI   (0x00B0 / 4) /* EOI */
+#define SVR   (0x00F0 / 4) /* Spurious Interrupt Vector */
+#define ENABLE     0x00000100 /* Unit Enable */
+#define ESR   (0x0280 / 4) /* Error Status */
+#define ICRLO (0x0300 / 4) /* Interrupt Command */
+#define INIT       0x00000500 /* INIT/RESET */
+#define STARTUP    0x00000600 /* Startup IPI */
+#define DELIVS     0x00001000 /* Delivery status */
+#define ASSERT     0x00004000 /* Assert interrupt (vs deassert) */
+#define DEASSERT   0x00000000
+#define LEVEL      0x00008000 /* Level triggered */
+#define BCAST      0x00080000 /* Send to all APICs, including self */
+#define OTHERS     0x000C0000 /* Send to all APICs, excluding self */
+#define BUSY       0x00001000
+#define FIXED      0x00000000
+#define ICRHI (0x0310 / 4) /* Interrupt Command [63:32] */
+#define TIMER (0x0320 / 4) /* Local Vector Table 0 (TIMER) */
+#define PCINT (0x0340 / 4) /* Performance Counter LVT */
+#define LINT0 (0x0350 / 4) /* Local Vector Table 1 (LINT0) */
+#define LINT1 (0x0360 / 4) /* Local Vector Table 2 (LINT1) */
+#define ERROR (0x0370 / 4) /* Local Vector Table 3 (ERROR) */
+#define MASKED     0x00010000 /* Interrupt masked */
+#define PERIODIC   0x00020000 /* Periodic timer mode */
+#define DEADLINE   0x00040000 /* TSC-deadline timer mode */
+#define TICR  (0x0380 / 4) /* Timer Initial Count */
+#define TCCR  (0x0390 / 4) /* Timer Current Count */
+#define TDCR  (0x03E0 / 4) /* Timer Divide Configuration */
+#define X1         0x0000000B /* divide counts by 1 */
+
+/* Scheduling timer interrupts per second */
+#define LAPIC_TIMER_HZ 100
+
+static volatile uint32_t *lapic;
+
+static void
+lapicw(int index, int value) {
+    lapic[index] = value;
+    /* Wait for write to finish, by reading */
+    (void)lapic[ID];
+}
+
+void
+lapic_init(void) {
+    if (!lapic_pa) return;
+
+    /* Local APIC of every CPU is at the same physical address */
+    if (!lapic) lapic = mmio_map_region(lapic_pa, PAGE_SIZE);
+
+    /* Enable local APIC, set spurious interrupt vector */
+    lapicw(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
+
+    /* Timer is started by timer_lapic.enable_interrupts
+     * if it is used for scheduling */
+    lapicw(TIMER, MASKED);
+
+    /* Leave LINT0 of the BSP enabled so that it can get
+     * interrupts from the 8259A chip */
+    if (thiscpu != bootcpu) lapicw(LINT0, MASKED);
+
+    /* Disable NMI (LINT1) on all CPUs */
+    lapicw(LINT1, MASKED);
+
+    /* Disable performance counter overflow interrupts
+     * on machines that provide that interrupt entry */
+    if (((lapic[VER] >> 16) & 0xFF) >= 4) lapicw(PCINT, MASKED);
+
+    /* Map error interrupt to IRQ_ERROR */
+    lapicw(ERROR, IRQ_OFFSET + IRQ_ERROR);
+
+    /* Clear error status register (requires back-to-back writes) */
+    lapicw(ESR, 0);
+    lapicw(ESR, 0);
+
+    /* Ack any outstanding interrupts */
+    lapicw(EOI, 0);
+
+    /* Send an Init Level De-Assert to synchronize arbitration IDs */
+    lapicw(ICRHI, 0);
+    lapicw(ICRLO, BCAST | INIT | LEVEL);
+    while (lapic[ICRLO] & DELIVS)
+        ;
+
+    /* Enable interrupts on the APIC (but not on the processor) */
+    lapicw(TPR, 0);
+}
+
+/* Index of current CPU by its local APIC ID,
+ * used before per-CPU TSS is loaded */
+int
+lapic_cpunum(void) {
+    if (!lapic) return 0;
+    return apicid_to_cpu[lapic[ID] >> 24];
+}
+
+/* Acknowledge interrupt */
+void
+lapic_eoi(void) {
+    if (lapic) lapicw(EOI, 0);
+}
+
+/* Spin for a given number of microseconds */
+static void
+microdelay(int us) {
+    uint64_t end = read_tsc() + tsc_calibrate() / 1000000 * us;
+    while (read_tsc() < end) asm volatile("pause");
+}
+
+#define IO_RTC 0x70
+
+/* Start additional processor running entry code at addr.
+ * See Appendix B of MultiProcessor Specification */
+void
+lapic_startap(uint8_t apicid, physaddr_t addr) {
+    /* "The BSP must initialize CMOS shutdown code to 0AH
+     * and the warm reset vector (DWORD based at 40:67) to point at
+     * the AP startup code prior to the [universal startup algorithm]" */
+    outb(IO_RTC, 0xF);     /* offset 0xF is shutdown code */
+    outb(IO_RTC + 1, 0x0A);
+    uint16_t *wrv = (uint16_t *)KADDR((0x40 << 4 | 0x67)); /* Warm reset vector */
+    wrv[0] = 0;
+    wrv[1] = addr >> 4;
+
+    /* "Universal startup algorithm."
+     * Send INIT (level-triggered) interrupt to reset other CPU */
+    lapicw(ICRHI, apicid << 24);
+    lapicw(ICRLO, INIT | LEVEL | ASSERT);
+    microdelay(200);
+    lapicw(ICRLO, INIT | LEVEL);
+    microdelay(100); /* should be 10ms, but too slow in Bochs! */
+
+    /* Send startup IPI (twice!) to enter code.
+     * Regular hardware is supposed to only accept a STARTUP
+     * when it is in the halted state due to an INIT.  So the second
+     * should be ignored, but it is part of the official Intel algorithm */
+    for (int i = 0; i < 2; i++) {
+        lapicw(ICRHI, apicid << 24);
+        lapicw(ICRLO, STARTUP | (addr >> 12));
+        microdelay(200);
+    }
+}
+
+/* Send interrupt vector to CPU with given index */
+void
+lapic_ipi(int cpu, int vector) {
+    if (!lapic) return;
+
+    lapicw(ICRHI, cpus[cpu].cpu_id << 24);
+    lapicw(ICRLO, FIXED | ASSERT | vector);
+    while (lapic[ICRLO] & DELIVS)
+        ;
+}
+
+/* TSC and timer ticks per second, timer runs at the same
+ * bus clock on every CPU so they are measured only once */
+static uint64_t lapic_tsc_freq, lapic_timer_freq;
+/* Timer is re-armed with TSC deadlines instead of running periodically */
+static bool lapic_tsc_deadline;
+
+/* Count timer ticks during 1/LAPIC_TIMER_HZ second measured
+ * with TSC, whose frequency is taken from HPET or ACPI PM timer */
+static void
+lapic_timer_calibrate(void) {
+    if (lapic_timer_freq) return;
+    if (!lapic) panic("Local APIC is unavailable\n");
+
+    lapic_tsc_freq = get_hpet() ? hpet_cpu_frequency() : pmtimer_cpu_frequency();
+
+    uint32_t ecx;
+    cpuid(1, NULL, NULL, &ecx, NULL);
+    lapic_tsc_deadline = !!(ecx & CPUID_1_ECX_TSC_DL);
+
+    lapicw(TDCR, X1);
+    lapicw(TIMER, MASKED);
+    lapicw(TICR, 0xFFFFFFFF);
+    uint64_t end = read_tsc() + lapic_tsc_freq / LAPIC_TIMER_HZ;
+    while (read_tsc() < end) asm volatile("pause");
+    lapic_timer_freq = (uint64_t)(0xFFFFFFFF - lapic[TCCR]) * LAPIC_TIMER_HZ;
+    lapicw(TICR, 0);
+}
+
+static uint64_t
+lapic_timer_cpu_frequency(void) {
+    lapic_timer_calibrate();
+    return lapic_tsc_freq;
+}
+
+/* Start timer of the calling CPU, it interrupts
+ * with IRQ_TIMER vector LAPIC_TIMER_HZ times per second */
+static void
+lapic_timer_enable_periodic(void) {
+    lapic_timer_calibrate();
+
+    if (lapic_tsc_deadline) {
+        lapicw(TIMER, DEADLINE | (IRQ_OFFSET + IRQ_TIMER));
+        wrmsr(TSC_DEADLINE_MSR, read_tsc() + lapic_tsc_freq / LAPIC_TIMER_HZ);
+    } else {
+        lapicw(TDCR, X1);
+        lapicw(TIMER, PERIODIC | (IRQ_OFFSET + IRQ_TIMER));
+        lapicw(TICR, lapic_timer_freq / LAPIC_TIMER_HZ);
+    }
+}
+
+static void
+lapic_timer_handle_periodic(void) {
+    if (lapic_tsc_deadline) wrmsr(TSC_DEADLINE_MSR, read_tsc() + lapic_tsc_freq / LAPIC_TIMER_HZ);
+    lapic_eoi();
+}
+
+/* Prepare timer of the calling CPU for one-shot interrupts,
+ * nothing fires until lapic_timer_set_oneshot() */
+static void
+lapic_timer_enable_oneshot(void) {
+    lapic_timer_calibrate();
+
+    if (lapic_tsc_deadline) {
+        lapicw(TIMER, DEADLINE | (IRQ_OFFSET + IRQ_TIMER));
+        wrmsr(TSC_DEADLINE_MSR, 0);
+    } else {
+        lapicw(TDCR, X1);
+        lapicw(TIMER, IRQ_OFFSET + IRQ_TIMER);
+        lapicw(TICR, 0);
+    }
+}
+
+/* Interrupt this CPU once when TSC reaches deadline,
+ * replaces previous deadline, 0 cancels it */
+static void
+lapic_timer_set_oneshot(uint64_t deadline) {
+    if (lapic_tsc_deadline) {
+        wrmsr(TSC_DEADLINE_MSR, deadline);
+        return;
+    }
+
+    uint64_t now = read_tsc();
+    if (!deadline) {
+        lapicw(TICR, 0);
+        return;
+    }
+
+    /* Deadlines further than a second fire early,
+     * that keeps count conversion from overflowing */
+    uint64_t delta = deadline > now ? MIN(deadline - now, lapic_tsc_freq) : 1;
+    lapicw(TICR, MAX(delta * lapic_timer_freq / lapic_tsc_freq, (uint64_t)1));
+}
+
+struct Timer timer_lapic = {
+        .timer_name = "lapic",
+        .get_cpu_freq = lapic_timer_cpu_frequency,
+        .enable_interrupts = lapic_timer_enable_oneshot,
+        .handle_interrupts = lapic_eoi,
+        .set_oneshot = lapic_timer_set_oneshot,
+        .timer_percpu = 1,
+};
+
+struct Timer timer_lapic_periodic = {
+        .timer_name = "lapic-periodic",
+        .get_cpu_freq = lapic_timer_cpu_frequency,
+        .enable_interrupts = lapic_timer_enable_periodic,
+        .handle_interrupts = lapic_timer_handle_periodic,
+        .timer_percpu = 1,
+};
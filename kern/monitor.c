@@ -15,6 +15,7 @@
 #include <kern/timer.h>
 #include <kern/env.h>
 #include <kern/pmap.h>
+#include <kern/alloc.h>
 #include <kern/trap.h>
 #include <kern/kclock.h>
 
@@ -33,6 +34,13 @@ int mon_frequency(int argc, char **argv, struct Trapframe *tf);
 int mon_memory(int argc, char **argv, struct Trapframe *tf);
 int mon_pagetable(int argc, char **argv, struct Trapframe *tf);
 int mon_virt(int argc, char **argv, struct Trapframe *tf);
+int mon_magazines(int argc, char **argv, struct Trapframe *tf);
+int mon_coalesce(int argc, char **argv, struct Trapframe *tf);
+int mon_lookupcache(int argc, char **argv, struct Trapframe *tf);
+int mon_hugepages(int argc, char **argv, struct Trapframe *tf);
+int mon_coloring(int argc, char **argv, struct Trapframe *tf);
+int mon_kmem(int argc, char **argv, struct Trapframe *tf);
+int mon_ksm(int argc, char **argv, struct Trapframe *tf);
 
 struct Command {
     const char *name;
@@ -53,6 +61,13 @@ static struct Command commands[] = {
         {"memory", "Dump memory pages", mon_memory},
         {"pagetable", "Dump page table", mon_pagetable},
         {"virt", "Pretty-print virtual memory tree", mon_virt},
+        {"magazines", "Print per-CPU page magazine statistics", mon_magazines},
+        {"coalesce", "Print lazy buddy coalescing statistics", mon_coalesce},
+        {"lookupcache", "Print virtual tree lookup cache statistics", mon_lookupcache},
+        {"hugepages", "Print huge page promotion statistics", mon_hugepages},
+        {"coloring", "Turn page coloring on/off and print free pages per color", mon_coloring},
+        {"kmem", "Print kernel slab allocator statistics", mon_kmem},
+        {"ksm", "Turn same-page merging on/off and print pages saved", mon_ksm},
 };
 #define NCOMMANDS (sizeof(commands) / sizeof(commands[0]))
 
@@ -166,6 +181,61 @@ int mon_virt(int argc, char **argv, struct Trapframe *tf) {
     return 0;
 }
 
+int mon_magazines(int argc, char **argv, struct Trapframe *tf) {
+    dump_page_magazines();
+    return 0;
+}
+
+int mon_coalesce(int argc, char **argv, struct Trapframe *tf) {
+    dump_coalesce_stats();
+    return 0;
+}
+
+int mon_lookupcache(int argc, char **argv, struct Trapframe *tf) {
+    dump_lookup_cache_stats();
+    return 0;
+}
+
+int mon_hugepages(int argc, char **argv, struct Trapframe *tf) {
+    dump_huge_promotion_stats();
+    return 0;
+}
+
+int mon_coloring(int argc, char **argv, struct Trapframe *tf) {
+    if (argc > 1) {
+        if (!strcmp(argv[1], "on"))
+            page_coloring = 1;
+        else if (!strcmp(argv[1], "off"))
+            page_coloring = 0;
+        else {
+            cprintf("Usage: coloring [on|off]\n");
+            return 0;
+        }
+    }
+    dump_page_colors();
+    return 0;
+}
+
+int mon_kmem(int argc, char **argv, struct Trapframe *tf) {
+    dump_kmem_stats();
+    return 0;
+}
+
+int mon_ksm(int argc, char **argv, struct Trapframe *tf) {
+    if (argc > 1) {
+        if (!strcmp(argv[1], "on"))
+            ksm_enabled = 1;
+        else if (!strcmp(argv[1], "off"))
+            ksm_enabled = 0;
+        else {
+            cprintf("Usage: ksm [on|off]\n");
+            return 0;
+        }
+    }
+    dump_ksm_stats();
+    return 0;
+}
+
 /* Kernel monitor command interpreter */
 
 static int
@@ -0,0 +1,79 @@
+/* Search for and parse the multiprocessor configuration
+ * (processor local APIC entries of ACPI MADT table) */
+
+#include <inc/types.h>
+#include <inc/string.h>
+#include <inc/memlayout.h>
+#include <inc/x86.h>
+#include <inc/mmu.h>
+#include <inc/env.h>
+#include <kern/cpu.h>
+#include <kern/pmap.h>
+#include <kern/timer.h>
+#include <kern/traceopt.h>
+
+struct CpuInfo cpus[NCPU];
+struct CpuInfo *bootcpu = &cpus[0];
+size_t ncpu = 1;
+uint8_t apicid_to_cpu[256];
+physaddr_t lapic_pa;
+
+/* Current CPU index. Task register holds per-CPU TSS selector
+ * (see trap_init_percpu()), it is cheaper to read than local APIC.
+ * Before local APIC is mapped only BSP is running */
+int
+cpunum(void) {
+    if (!lapic_pa) return 0;
+    uint16_t tr = read_tr();
+    return tr ? (tr - GD_TSS0) >> 4 : 0;
+}
+
+static void
+mp_add_cpu(uint8_t apicid) {
+    if (ncpu == NCPU) {
+        cprintf("SMP: too many CPUs, CPU %d disabled\n", apicid);
+        return;
+    }
+    cpus[ncpu].cpu_id = apicid;
+    apicid_to_cpu[apicid] = ncpu++;
+}
+
+void
+mp_init(void) {
+    MADT *madt = get_madt();
+    if (!madt) {
+        cprintf("SMP: no MADT found, running on one CPU\n");
+        bootcpu->cpu_status = CPU_STARTED;
+        return;
+    }
+
+    lapic_pa = madt->LocalApicAddress;
+
+    /* BSP always gets index 0 */
+    uint32_t ebx;
+    cpuid(1, NULL, &ebx, NULL, NULL);
+    bootcpu->cpu_id = ebx >> 24;
+    apicid_to_cpu[bootcpu->cpu_id] = 0;
+
+    uint8_t *entry = madt->Entries;
+    uint8_t *end = (uint8_t *)madt + madt->h.Length;
+    for (; entry + sizeof(MADTEntryHeader) <= end; entry += ((MADTEntryHeader *)entry)->Length) {
+        MADTEntryHeader *hdr = (MADTEntryHeader *)entry;
+        if (!hdr->Length) break;
+
+        switch (hdr->Type) {
+        case MADT_LOCAL_APIC: {
+            MADTLocalApic *proc = (MADTLocalApic *)entry;
+            if ((proc->Flags & MADT_LAPIC_ENABLED) && proc->ApicId != bootcpu->cpu_id)
+                mp_add_cpu(proc->ApicId);
+            break;
+        }
+        case MADT_LOCAL_APIC_OVERRIDE:
+            lapic_pa = ((MADTLocalApicOverride *)entry)->LocalApicAddress;
+            break;
+        }
+    }
+
+    bootcpu->cpu_status = CPU_STARTED;
+    cprintf("SMP: CPU %d found %zu CPU(s)\n", bootcpu->cpu_id, ncpu);
+}
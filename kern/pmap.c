@@ -23,29 +23,66 @@
  */
 
 /* for O(1) page allocation */
-static struct List free_classes[MAX_CLASS];
+static struct Page free_classes[MAX_CLASS];
+/* Free pages of class 0 are partitioned by cache color
+ * (free_classes[0] stays empty) */
+static struct Page free_colors[PAGE_COLORS];
 /* List of descriptor pools */
 static struct PagePool *first_pool;
 /* List of free descriptors */
-static struct List free_descriptors;
+static struct Page free_descriptors;
 static size_t free_desc_count;
 /* Physical memory size */
 size_t max_memory_map_addr;
 /* Kernel address space */
 struct AddressSpace kspace;
-/* Currently active address spcae */
-struct AddressSpace *current_space;
 /* Root node of physical memory tree */
 struct Page root;
-/* Top address for page pools mappings */
-static uintptr_t metaheaptop;
+/* Number of 4K pages in kernel heap virtual address space */
+#define HEAP_PAGES ((KERN_HEAP_END - KERN_HEAP_START) / PAGE_SIZE)
+
+/* Bit i is set if page i of kernel heap virtual address space
+ * is in use, so freed ranges merge with their neighbours
+ * and no range is ever lost */
+static uint64_t heap_used[HEAP_PAGES / 64];
+
+/* Mark n heap pages starting from page first as used or free */
+static void
+heap_mark(size_t first, size_t n, bool used) {
+    assert(first + n <= HEAP_PAGES);
+    for (size_t i = first; i < first + n; i++) {
+        uint64_t bit = 1ULL << (i % 64);
+        assert(!(heap_used[i / 64] & bit) == used);
+        if (used)
+            heap_used[i / 64] |= bit;
+        else
+            heap_used[i / 64] &= ~bit;
+    }
+}
 
 // TODO Test these properly via cpuid
 
 /* Not-executable bit supported by page tables */
 static bool nx_supported = 1;
-/* 1GB pages are supported */
-static bool has_1gb_pages = 1;
+/* 1GB pages are supported (detected via cpuid) */
+static bool has_1gb_pages;
+/* Process-context identifiers are supported (detected via cpuid) */
+static bool pcid_supported;
+/* INVPCID instruction is supported (detected via cpuid) */
+static bool invpcid_supported;
+/* CR4_PCIDE is set and address spaces are tagged with PCIDs */
+static bool pcid_enabled;
+
+/* Allocated PCIDs (PCID 0 belongs to kspace) */
+static uint64_t pcid_used[NPCID / 64];
+/* PCIDs which can still have TLB entries of freed or
+ * modified address space and need to be flushed on next switch
+ * (TLB of every CPU is tracked separately) */
+static uint64_t pcid_stale[NCPU][NPCID / 64];
+/* Next PCID to try to allocate */
+static uint16_t pcid_next = 1;
+
+static_assert(NENV < NPCID, "Every environment should have its own PCID");
 
 /* Kernel executable end virtual address */
 extern char end[];
@@ -57,6 +94,12 @@ extern char pfstacktop[], pfstack[];
 #define ALLOC_WEAK 0x20000
 /* Allocate page within [0; BOOT_MEM_SIZE) */
 #define ALLOC_BOOTMEM 0x40000
+/* Bypass per-CPU page magazines */
+#define ALLOC_NOMAGAZINE 0x80000
+/* Prefer class 0 page of cache color ALLOC_COLOR_OF(flags) */
+#define ALLOC_COLORED 0x400000
+#define ALLOC_COLOR(c) (ALLOC_COLORED | (c) << 23)
+#define ALLOC_COLOR_OF(flags) (((flags) >> 23) & (PAGE_COLORS - 1))
 
 /* Descriptor pool page size */
 #define POOL_CLASS 1
@@ -72,44 +115,210 @@ extern char pfstacktop[], pfstack[];
 
 #define ABSDIFF(x, y) ((x) > (y) ? (x) - (y) : (y) - (x))
 
+/* Spread allocations of every address space over cache colors,
+ * turned on with "coloring on" monitor command */
+bool page_coloring = 0;
+
+/* Merge identical read-only and lazy user pages during idle time */
+bool ksm_enabled = 0;
+
+/* Maximal number of hardware pages invalidated one by one,
+ * larger batches are invalidated by flushing whole TLB */
+#define TLB_FLUSH_THRESHOLD 32
+
+/*
+ * Batch of pending TLB invalidations in single address space.
+ * Page table modifications append addresses of changed
+ * hardware pages (one per hardware page of any size) and
+ * then invalidate all of them at once with tlb_batch_flush()
+ */
+struct TlbBatch {
+    struct AddressSpace *spc;
+    size_t count; /* Number of queued addresses */
+    bool full;    /* Too many pages, flush everything */
+    uintptr_t addrs[TLB_FLUSH_THRESHOLD];
+};
+
+inline static void
+tlb_batch_add(struct TlbBatch *tlb, uintptr_t addr) {
+    if (tlb->full) return;
+    if (tlb->count == TLB_FLUSH_THRESHOLD)
+        tlb->full = 1;
+    else
+        tlb->addrs[tlb->count++] = addr;
+}
+
+/* Class of physical pages indexed by page_index */
+#define PAGE_INDEX_CLASS MAX_ALLOCATION_CLASS
+
+/*
+ * Radix index of physical memory tree:
+ * maps 2MB frame number to the descriptor of that
+ * frame (if physical tree is split down to it),
+ * so lookups do not need to descend from the root.
+ * Maintained by alloc_child() and free_descriptor().
+ */
+static pageref_t *page_index;
+static size_t page_index_size;
+
+/* Number of pages freed without coalescing
+ * that triggers batched coalescing pass */
+#define COALESCE_WATERMARK 256
+
+/* Defer buddy merging until watermark is reached
+ * or allocation of larger page misses */
+static bool lazy_coalescing = 1;
+
+/* Largest class of shared lazy page that is copied whole
+ * on write fault. Larger pages are split down to this class
+ * and only the part containing faulting address is copied,
+ * the rest stays shared. MAX_ALLOCATION_CLASS restores
+ * whole huge page copying */
+int cow_copy_class = 0;
+
+static struct {
+    size_t pending;  /* Pages freed since last coalescing pass */
+    size_t deferred; /* Total number of deferred frees */
+    size_t passes;   /* Number of batched coalescing passes */
+    size_t merges;   /* Number of merged buddy pairs */
+} coalesce_stats;
+
+/* Number of page classes cached in per-CPU magazines */
+#define NMAGAZINES 2
+
+/*
+ * Per-CPU magazine of pre-split free pages of single class.
+ * Pages stored in magazine are detached from the free lists
+ * and hold single reference owned by magazine itself, so buddy
+ * coalescing never touches them. This makes allocation and
+ * freeing of the most common page sizes (4K and 2M) O(1)
+ * without splitting or merging physical memory tree.
+ */
+struct PageMagazine {
+    int class;       /* Class of cached pages */
+    size_t capacity; /* Maximal number of cached pages */
+    size_t batch;    /* Number of pages moved on refill/drain */
+    size_t count;    /* Number of currently cached pages */
+    struct Page *pages[64];
+
+    /* Statistics */
+    size_t hits, misses;
+    size_t refills, drains;
+};
+
+static struct PageMagazine page_magazines[NCPU][NMAGAZINES] = {
+        [0 ... NCPU - 1] = {
+                {.class = 0, .capacity = 64, .batch = 16},
+                {.class = MAX_ALLOCATION_CLASS, .capacity = 4, .batch = 2},
+        },
+};
+
+/*
+ * Pools of pre-zeroed pages refilled during idle time,
+ * zero-fill faults just map page from here instead of
+ * copying zero page. Pool pages are owned the same way
+ * as magazine pages.
+ */
+static struct PageMagazine zero_pools[NMAGAZINES] = {
+        {.class = 0, .capacity = 64, .batch = 8},
+        {.class = MAX_ALLOCATION_CLASS, .capacity = 2, .batch = 1},
+};
+
+/*
+ * Cache of zeroed page table pages. Tables emptied by remove_pt()
+ * are all zeroes already, so instead of being freed they are kept
+ * here for alloc_pt() to reuse without clearing, until memory
+ * pressure drains the cache.
+ */
+static struct PageMagazine pt_cache = {.class = 0, .capacity = 64, .batch = 16};
+static size_t pt_allocs, pt_reuses;
+
+/* Maximal number of huge pages promoted per idle scan */
+#define PROMOTE_BATCH 4
+
+/* Number of small page ranges replaced with huge pages */
+static size_t huge_promotions;
+
+/* Size of same-page merging checksum table and
+ * maximal number of pages checked per idle scan */
+#define KSM_BUCKETS 1024
+#define KSM_BATCH   64
+
+/* Page remembered by same-page merging scanner,
+ * it is only trusted after checking that env still maps phy at va */
+struct KsmEntry {
+    uint64_t sum;
+    envid_t envid;
+    uintptr_t va;
+    struct Page *phy;
+};
+
+static struct KsmEntry ksm_table[KSM_BUCKETS];
+static size_t ksm_scanned, ksm_merged, ksm_saved;
+
+/* Filler pages for ALLOC_ZERO and ALLOC_ONE mappings */
+static struct Page *zero_page, *one_page;
+
+#define PAGE_IS_ZERO(p) ((page2pa(p) & ~CLASS_MASK(MAX_ALLOCATION_CLASS)) == page2pa(zero_page))
+
 #define assert_physical(n) ({ if (trace_memory_more) _assert_root(__FILE__, __LINE__, n, 1); assert(((n)->state & NODE_TYPE_MASK) >= PARTIAL_NODE); })
 #define assert_virtual(n)  ({if (trace_memory_more) _assert_root(__FILE__, __LINE__, n, 0); assert(((n)->state & NODE_TYPE_MASK) < PARTIAL_NODE); })
 
+/*
+ * Lists of descriptors are linked with descriptor indices,
+ * so list heads are descriptors too
+ */
+inline static struct Page *__attribute__((always_inline))
+list_next(struct Page *list) {
+    return ref2page(list->head.next);
+}
+
+inline static struct Page *__attribute__((always_inline))
+list_prev(struct Page *list) {
+    return ref2page(list->head.prev);
+}
+
 inline static bool __attribute__((always_inline))
-list_empty(struct List *list) {
-    return list->next == list;
+list_empty(struct Page *list) {
+    return list->head.next == page2ref(list);
 }
 
 inline static void __attribute__((always_inline))
-list_init(struct List *list) {
-    list->next = list->prev = list;
+list_init(struct Page *list) {
+    list->head.next = list->head.prev = page2ref(list);
 }
 
 /*
  * Appends list element 'new' after list element 'list'
  */
 inline static void __attribute__((always_inline))
-list_append(struct List *list, struct List *new) {
+list_append(struct Page *list, struct Page *new) {
     // LAB 6: Your code here
-    new->prev = list;
-    new->next = list->next;
-    new->next->prev = new;
-    list->next = new;
+    new->head.prev = page2ref(list);
+    new->head.next = list->head.next;
+    list_next(new)->head.prev = page2ref(new);
+    list->head.next = page2ref(new);
 }
 
 /*
  * Deletes list element from list.
  * NOTE: Use list_init() on deleted List element
  */
-inline static struct List *__attribute__((always_inline))
-list_del(struct List *list) {
+inline static struct Page *__attribute__((always_inline))
+list_del(struct Page *list) {
     // LAB 6: Your code here.
-    list->prev->next = list->next;
-    list->next->prev = list->prev;
+    list_prev(list)->head.next = list->head.next;
+    list_next(list)->head.prev = list->head.prev;
     list_init(list);
     return list;
 }
 
+/* Free list of allocatable page */
+inline static struct Page *
+free_list(struct Page *page) {
+    return page->class ? &free_classes[page->class] : &free_colors[PAGE_COLOR(page2pa(page))];
+}
+
 static struct Page *alloc_page(int class, int flags);
 
 void
@@ -128,26 +337,53 @@ static struct Page *
 alloc_descriptor(enum PageState state) {
     ensure_free_desc(1);
 
-    struct Page *new = (struct Page *)list_del(free_descriptors.next);
+    struct Page *new = list_del(list_next(&free_descriptors));
 
     memset(new, 0, sizeof *new);
-    list_init((struct List *)new);
+    list_init(new);
     new->state = state;
     free_desc_count--;
 
     return new;
 }
 
+inline static pageref_t *
+page_index_slot(uintptr_t addr) {
+    size_t frame = addr >> (CLASS_BASE + PAGE_INDEX_CLASS);
+    return frame < page_index_size ? &page_index[frame] : NULL;
+}
+
+/* Register (or unregister when removed) indexed physical page */
+inline static void
+page_index_update(struct Page *page, bool removed) {
+    if (page->class != PAGE_INDEX_CLASS || (page->state & NODE_TYPE_MASK) < PARTIAL_NODE) return;
+
+    pageref_t *slot = page_index_slot(page2pa(page));
+    if (slot) *slot = removed ? 0 : page2ref(page);
+}
+
+/* Lowest known descriptor containing page of given class at addr */
+static struct Page *
+page_index_lookup(uintptr_t addr, int class) {
+    pageref_t *slot = page_index_slot(addr);
+    if (!slot || !*slot) return &root;
+
+    struct Page *node = ref2page(*slot);
+    while (node->class < class) node = page_parent(node);
+    return node;
+}
+
 static void
 free_descriptor(struct Page *page) {
-    list_del((struct List *)page);
-    list_append(&free_descriptors, (struct List *)page);
+    page_index_update(page, 1);
+    list_del(page);
+    list_append(&free_descriptors, page);
     free_desc_count++;
 }
 
 static void
 _assert_root(const char *file, int line, struct Page *p, bool phy) {
-    while (p->parent) p = p->parent;
+    while (p->parent) p = page_parent(p);
     if ((p == &root) != phy)
         _panic(file, line, "Page %p (phy %p) should%s be physical\n", p, (void *)PADDR(p), phy ? "" : "n't");
 }
@@ -156,8 +392,8 @@ static void
 free_desc_rec(struct Page *p) {
     while (p) {
         assert(!p->refc);
-        free_desc_rec(p->right);
-        struct Page *tmp = p->left;
+        free_desc_rec(page_right(p));
+        struct Page *tmp = page_left(p);
         free_descriptor(p);
         p = tmp;
     }
@@ -189,19 +425,23 @@ alloc_child(struct Page *parent, bool right) {
     // LAB 6: Your code here
     assert(0 < parent->class);
     struct Page *new = alloc_descriptor(parent->state);
-    new->left = new->right = NULL;
-    new->parent = parent;
+    new->left = new->right = 0;
+    new->parent = page2ref(parent);
     new->refc = parent->refc ? 1 : 0;
     new->class = parent->class - 1;
 
+    /* Address is stored in units of page size */
+    assert(parent->addr <= UINT32_MAX / 2);
     if (right) {
-        parent->right = new;
-        new->addr = parent->addr + (CLASS_SIZE(new->class) >> CLASS_BASE);
+        parent->right = page2ref(new);
+        new->addr = parent->addr * 2 + 1;
     } else {
-        parent->left = new;
-        new->addr = parent->addr;
+        parent->left = page2ref(new);
+        new->addr = parent->addr * 2;
     }
 
+    page_index_update(new, 0);
+
     return new;
 }
 
@@ -212,7 +452,9 @@ page_lookup(struct Page *hint, uintptr_t addr, int class, enum PageState type, b
     assert(class >= 0);
     if (hint) assert_physical(hint);
 
-    struct Page *node = hint ? hint : &root;
+    /* Retyping memory also changes types of
+     * parent nodes so it requires full walk from the root */
+    struct Page *node = hint ? hint : type == PARTIAL_NODE ? page_index_lookup(addr, class) : &root;
     assert(!(addr & CLASS_MASK(class)));
     assert(node);
 
@@ -228,10 +470,10 @@ page_lookup(struct Page *hint, uintptr_t addr, int class, enum PageState type, b
 
             if (was_free) {
                 /* Recalculate free lists for allocatable page */
-                struct Page *other = !right ? node->right : node->left;
+                struct Page *other = !right ? page_right(node) : page_left(node);
                 assert(other->state == ALLOCATABLE_NODE);
-                list_del((struct List *)node);
-                list_append(&free_classes[node->class - 1], (struct List *)other);
+                list_del(node);
+                list_append(free_list(other), other);
             }
 
             if (type != PARTIAL_NODE && node->state != type)
@@ -240,7 +482,7 @@ page_lookup(struct Page *hint, uintptr_t addr, int class, enum PageState type, b
 
         assert((node->left && node->right) || !alloc);
 
-        node = right ? node->right : node->left;
+        node = right ? page_right(node) : page_left(node);
     }
 
     if (alloc) assert(node);
@@ -249,14 +491,14 @@ page_lookup(struct Page *hint, uintptr_t addr, int class, enum PageState type, b
         assert(!node->refc);
 
         /* Need to free old subtree when retyping memory */
-        free_desc_rec(node->left);
-        free_desc_rec(node->right);
-        node->left = node->right = NULL;
-        list_del((struct List *)node);
+        free_desc_rec(page_left(node));
+        free_desc_rec(page_right(node));
+        node->left = node->right = 0;
+        list_del(node);
 
         /* We cannot change RESERVED_NODE memory to ALLOCATABLE_NODE */
         if (type != PARTIAL_NODE && node->state != RESERVED_NODE) node->state = type;
-        if (node->state == ALLOCATABLE_NODE) list_append(&free_classes[node->class], (struct List *)node);
+        if (node->state == ALLOCATABLE_NODE) list_append(free_list(node), node);
 
         if (trace_memory) cprintf("Attaching page (%x) at %p class=%d\n", node->state, (void *)page2pa(node), (int)node->class);
     }
@@ -275,11 +517,281 @@ page_ref(struct Page *node) {
      * so need to reference them recursively
      * when refc transitions from 0 to 1 */
     if (!node->refc++) {
-        list_del((struct List *)node);
-        list_init((struct List *)node);
-        page_ref(node->left);
-        page_ref(node->right);
+        list_del(node);
+        list_init(node);
+        page_ref(page_left(node));
+        page_ref(page_right(node));
+    }
+}
+
+/* Merge free page with its free buddies
+ * and put the result to the free lists */
+static void
+page_coalesce(struct Page *page) {
+    while (page != &root) {
+        struct Page *par = page_parent(page);
+        assert_physical(par);
+        if (par->state == page->state &&
+            PAGE_IS_FREE(page_left(par)) &&
+            PAGE_IS_FREE(page_right(par))) {
+            free_descriptor(page_left(par));
+            par->left = 0;
+
+            free_descriptor(page_right(par));
+            par->right = 0;
+
+            if (par->state == ALLOCATABLE_NODE) {
+                assert(list_empty(par));
+                list_append(free_list(par), par);
+            }
+            page = par;
+            coalesce_stats.merges++;
+        } else
+            break;
+    }
+    list_del(page);
+    if (page->state == ALLOCATABLE_NODE)
+        list_append(free_list(page), page);
+}
+
+/* Merge all free buddies in a single pass.
+ * Classes are processed from the smallest one
+ * so merged pages are visited again at their new class */
+static void
+coalesce_free_pages(void) {
+    /* NOTE List heads cannot be allocated on stack
+     * since they should be addressable via pageref_t */
+    static struct Page pending;
+
+    for (int class = 0; class < MAX_CLASS; class++) {
+        for (int color = 0; color < (class ? 1 : PAGE_COLORS); color++) {
+            struct Page *list = class ? &free_classes[class] : &free_colors[color];
+            if (list_empty(list)) continue;
+
+            /* Move whole list to the temporary one since
+             * page_coalesce() reinserts pages into free lists */
+            pending.head = list->head;
+            list_next(&pending)->head.prev = list_prev(&pending)->head.next = page2ref(&pending);
+            list_init(list);
+
+            while (!list_empty(&pending)) {
+                struct Page *page = list_del(list_next(&pending));
+                assert(PAGE_IS_FREE(page));
+                page_coalesce(page);
+            }
+        }
+    }
+
+    coalesce_stats.pending = 0;
+    coalesce_stats.passes++;
+}
+
+/* Return free page to the free lists
+ * merging it with its free buddies */
+static void
+page_free(struct Page *page) {
+    assert(PAGE_IS_FREE(page));
+
+    if (lazy_coalescing && page->state == ALLOCATABLE_NODE) {
+        /* Keep page at its class until the next coalescing pass */
+        list_del(page);
+        list_append(free_list(page), page);
+        coalesce_stats.deferred++;
+        if (++coalesce_stats.pending >= COALESCE_WATERMARK) coalesce_free_pages();
+    } else {
+        page_coalesce(page);
+    }
+
+#if SANITIZE_SHADOW_BASE
+    if (current_space) {
+        platform_asan_poison(KADDR(page2pa(page)), CLASS_SIZE(page->class));
+    }
+#endif
+}
+
+void
+dump_lookup_cache_stats(void) {
+    cprintf("kspace: %zu hits, %zu misses\n", kspace.lookup_hits, kspace.lookup_misses);
+    for (size_t i = 0; i < NENV; i++) {
+        struct AddressSpace *spc = &envs[i].address_space;
+        if (envs[i].env_status == ENV_FREE || !spc->root) continue;
+        cprintf("[%08x]: %zu hits, %zu misses\n", envs[i].env_id, spc->lookup_hits, spc->lookup_misses);
+    }
+}
+
+void
+dump_coalesce_stats(void) {
+    cprintf("Lazy coalescing: %s, watermark %d\n", lazy_coalescing ? "on" : "off", COALESCE_WATERMARK);
+    cprintf("%zu pending, %zu deferred frees, %zu passes, %zu merges\n",
+            coalesce_stats.pending, coalesce_stats.deferred, coalesce_stats.passes, coalesce_stats.merges);
+}
+
+/* Magazine of current CPU caching pages of given class (if any) */
+static struct PageMagazine *
+page_magazine(int class) {
+    struct PageMagazine *mags = page_magazines[cpunum()];
+    for (size_t i = 0; i < NMAGAZINES; i++)
+        if (mags[i].class == class) return &mags[i];
+    return NULL;
+}
+
+/* Return up to count cached pages back to the buddy allocator */
+static size_t
+magazine_drain(struct PageMagazine *mag, size_t count) {
+    size_t n = 0;
+    for (; n < count && mag->count; n++) {
+        struct Page *page = mag->pages[--mag->count];
+        assert(page->refc == 1);
+        page->refc--;
+        page_free(page);
+    }
+    if (n) mag->drains++;
+    return n;
+}
+
+/* Drain every magazine of every CPU,
+ * returns number of pages released */
+static size_t
+magazines_drain_all(void) {
+    size_t n = 0;
+    for (size_t cpu = 0; cpu < NCPU; cpu++)
+        for (size_t i = 0; i < NMAGAZINES; i++)
+            n += magazine_drain(&page_magazines[cpu][i], page_magazines[cpu][i].count);
+    return n;
+}
+
+/* Fill magazine with a batch of pages taken from the buddy allocator */
+static void
+magazine_refill(struct PageMagazine *mag, int flags) {
+    size_t n = 0;
+    for (; n < mag->batch && mag->count < mag->capacity; n++) {
+        struct Page *page = alloc_page(mag->class, (flags & ALLOC_BOOTMEM) | ALLOC_NOMAGAZINE);
+        if (!page) break;
+        page_ref(page);
+        mag->pages[mag->count++] = page;
+    }
+    if (n) mag->refills++;
+}
+
+/* Remove page satisfying allocation flags from magazine,
+ * returned page still holds magazine reference */
+static struct Page *
+magazine_take(struct PageMagazine *mag, int flags) {
+    for (size_t i = mag->count; i > 0; i--) {
+        struct Page *page = mag->pages[i - 1];
+        if ((flags & ALLOC_BOOTMEM) && page2pa(page) + CLASS_SIZE(mag->class) >= BOOT_MEM_SIZE) continue;
+        if ((flags & ALLOC_COLORED) && PAGE_COLOR(page2pa(page)) != ALLOC_COLOR_OF(flags)) continue;
+
+        mag->pages[i - 1] = mag->pages[--mag->count];
+        assert(page->refc == 1 && !page->left && !page->right);
+        assert(list_empty(page));
+        mag->hits++;
+        return page;
+    }
+
+    mag->misses++;
+    return NULL;
+}
+
+/* Take page satisfying allocation flags from magazine,
+ * returned page is unreferenced just like one returned from alloc_page() */
+static struct Page *
+magazine_pop(struct PageMagazine *mag, int flags) {
+    if (!mag->count) magazine_refill(mag, flags);
+
+    struct Page *page = magazine_take(mag, flags);
+    if (page) page->refc--;
+    return page;
+}
+
+/* Try to cache page which is about to become free,
+ * returns 1 if magazine took ownership of the page reference */
+static bool
+magazine_push(struct Page *page) {
+    if (page->state != ALLOCATABLE_NODE || page->left || page->right) return 0;
+
+    struct PageMagazine *mag = page_magazine(page->class);
+    if (!mag) return 0;
+
+    if (mag->count == mag->capacity) magazine_drain(mag, mag->batch);
+    assert(mag->count < mag->capacity);
+
+    /* Detach from the list of mappings, last of
+     * them is going to be deleted by the caller */
+    list_del(page);
+    mag->pages[mag->count++] = page;
+
+#if SANITIZE_SHADOW_BASE
+    if (current_space) {
+        platform_asan_poison(KADDR(page2pa(page)), CLASS_SIZE(page->class));
+    }
+#endif
+    return 1;
+}
+
+void
+dump_page_magazines(void) {
+    for (size_t cpu = 0; cpu < NCPU; cpu++) {
+        for (size_t i = 0; i < NMAGAZINES; i++) {
+            struct PageMagazine *mag = &page_magazines[cpu][i];
+            size_t total = mag->hits + mag->misses;
+            cprintf("CPU %zu class %d: %zu/%zu cached, %zu hits, %zu misses (%zu%% hit rate), %zu refills, %zu drains\n",
+                    cpu, mag->class, mag->count, mag->capacity, mag->hits, mag->misses,
+                    total ? mag->hits * 100 / total : 0, mag->refills, mag->drains);
+        }
+    }
+    for (size_t i = 0; i < NMAGAZINES; i++) {
+        struct PageMagazine *pool = &zero_pools[i];
+        cprintf("Zeroed class %d: %zu/%zu cached, %zu hits, %zu misses, %zu refills, %zu drains\n",
+                pool->class, pool->count, pool->capacity, pool->hits,
+                pool->misses, pool->refills, pool->drains);
+    }
+    cprintf("Page tables: %zu allocated, %zu reused, %zu/%zu cached, %zu drains\n",
+            pt_allocs, pt_reuses, pt_cache.count, pt_cache.capacity, pt_cache.drains);
+}
+
+static size_t
+zero_pools_drain_all(void) {
+    size_t n = 0;
+    for (size_t i = 0; i < NMAGAZINES; i++)
+        n += magazine_drain(&zero_pools[i], zero_pools[i].count);
+    return n;
+}
+
+/* Zero memory with non-temporal stores so
+ * that idle time zeroing does not pollute caches */
+static void
+nt_memzero(void *va, size_t size) {
+    assert(!((uintptr_t)va & 7) && !(size & 31));
+    for (uint64_t *ptr = va, *end = (uint64_t *)((uint8_t *)va + size); ptr < end; ptr += 4) {
+        movnti(ptr + 0, 0);
+        movnti(ptr + 1, 0);
+        movnti(ptr + 2, 0);
+        movnti(ptr + 3, 0);
+    }
+    sfence();
+}
+
+/* Zero one batch of pages for every non-full pool,
+ * called when CPU has nothing else to do.
+ * Returns true if some pool can be refilled further */
+bool
+zero_pools_refill(void) {
+    bool more = 0;
+    for (size_t i = 0; i < NMAGAZINES; i++) {
+        struct PageMagazine *pool = &zero_pools[i];
+        size_t n = 0;
+        for (; n < pool->batch && pool->count < pool->capacity; n++) {
+            struct Page *page = alloc_page(pool->class, 0);
+            if (!page) break;
+            page_ref(page);
+            nt_memzero(KADDR(page2pa(page)), CLASS_SIZE(pool->class));
+            pool->pages[pool->count++] = page;
+        }
+        if (n) pool->refills++;
+        if (n == pool->batch && pool->count < pool->capacity) more = 1;
     }
+    return more;
 }
 
 static void
@@ -293,57 +805,31 @@ page_unref(struct Page *page) {
      * to prevent double frees */
 
     if (page->refc == 1) {
-        page_unref(page->left);
-        page_unref(page->right);
+        /* Last reference is passed to the magazine */
+        if (magazine_push(page)) return;
+
+        page_unref(page_left(page));
+        page_unref(page_right(page));
     }
 
     page->refc--;
 
-    /* Try to merge free page with adjacent */
-    if (PAGE_IS_FREE(page)) {
-        while (page != &root) {
-            struct Page *par = page->parent;
-            assert_physical(par);
-            if (par->state == page->state &&
-                PAGE_IS_FREE(par->left) &&
-                PAGE_IS_FREE(par->right)) {
-                free_descriptor(par->left);
-                par->left = NULL;
-
-                free_descriptor(par->right);
-                par->right = NULL;
-
-                if (par->state == ALLOCATABLE_NODE) {
-                    assert(list_empty((struct List *)par));
-                    list_append(&free_classes[par->class], (struct List *)par);
-                }
-                page = par;
-            } else
-                break;
-        }
-        list_del((struct List *)page);
-        if (page->state == ALLOCATABLE_NODE)
-            list_append(&free_classes[page->class], (struct List *)page);
-
-#if SANITIZE_SHADOW_BASE
-        if (current_space) {
-            platform_asan_poison(KADDR(page2pa(page)), CLASS_SIZE(page->class));
-        }
-#endif
-    }
+    if (PAGE_IS_FREE(page)) page_free(page);
 }
 
 void
-alloc_virtual_child(struct Page *parent, struct Page **dst) {
+alloc_virtual_child(struct Page *parent, pageref_t *dst) {
     assert_virtual(parent);
-    assert(parent->phy && parent->phy->left && parent->phy->right);
+    assert(parent->phy && page_phy(parent)->left && page_phy(parent)->right);
 
-    if ((*dst = alloc_descriptor(parent->state))) {
-        (*dst)->parent = parent;
-        (*dst)->phy = dst == &parent->left ? parent->phy->left : parent->phy->right;
-        page_ref((*dst)->phy);
-        list_append((struct List *)(*dst)->phy, (struct List *)(*dst));
+    struct Page *child = alloc_descriptor(parent->state);
+    if (child) {
+        child->parent = page2ref(parent);
+        child->phy = dst == &parent->left ? page_phy(parent)->left : page_phy(parent)->right;
+        page_ref(page_phy(child));
+        list_append(page_phy(child), child);
     }
+    *dst = page2ref(child);
 }
 
 /*
@@ -367,24 +853,71 @@ alloc_virtual_child(struct Page *parent, struct Page **dst) {
  */
 static void
 check_virtual_class(struct Page *node, int class) {
-    while (node->parent) class ++, node = node->parent;
+    while (node->parent) class ++, node = page_parent(node);
     assert(class == MAX_CLASS);
 }
 
+/* Find the smallest cached node containing page of given class at addr.
+ * Cached node is always on the path from the root to the looked up node,
+ * so tree walk can be started from it */
+static struct Page *
+lookup_cache_find(struct AddressSpace *spc, uintptr_t addr, int class, int *nclass) {
+    struct Page *best = NULL;
+    for (size_t i = 0; i < AS_LOOKUP_CACHE_SIZE; i++) {
+        struct Page *node = spc->lookup_cache[i].node;
+        int nodeclass = spc->lookup_cache[i].class;
+        if (node && nodeclass >= class && nodeclass < *nclass &&
+            (addr & ~CLASS_MASK(nodeclass)) == spc->lookup_cache[i].addr) {
+            best = node;
+            *nclass = nodeclass;
+        }
+    }
+    return best;
+}
+
+static void
+lookup_cache_insert(struct AddressSpace *spc, uintptr_t addr, int class, struct Page *node) {
+    for (size_t i = 0; i < AS_LOOKUP_CACHE_SIZE; i++)
+        if (spc->lookup_cache[i].node == node) return;
+
+    unsigned i = spc->lookup_cache_next++ % AS_LOOKUP_CACHE_SIZE;
+    spc->lookup_cache[i].addr = addr & ~CLASS_MASK(class);
+    spc->lookup_cache[i].class = class;
+    spc->lookup_cache[i].node = node;
+}
+
+/* Drop cached nodes that are about to be freed
+ * when [addr, addr + CLASS_SIZE(class)) is unmapped */
+static void
+lookup_cache_invalidate(struct AddressSpace *spc, uintptr_t addr, int class) {
+    for (size_t i = 0; i < AS_LOOKUP_CACHE_SIZE; i++) {
+        if (spc->lookup_cache[i].class <= class &&
+            (spc->lookup_cache[i].addr & ~CLASS_MASK(class)) == addr)
+            spc->lookup_cache[i].node = NULL;
+    }
+}
+
 /* Lookup virtual address space mapping node with given address and class */
 static struct Page *
-page_lookup_virtual(struct Page *node, uintptr_t addr, int class, int alloc) {
+page_lookup_virtual(struct AddressSpace *spc, uintptr_t addr, int class, int alloc) {
     assert(class >= 0);
-    assert_virtual(node);
-
 
     int nclass = MAX_CLASS;
+    struct Page *node = lookup_cache_find(spc, addr, class, &nclass);
+    if (node) {
+        spc->lookup_hits++;
+    } else {
+        spc->lookup_misses++;
+        node = spc->root;
+    }
+    assert_virtual(node);
+
     while (nclass > class) {
         assert(nclass > 0);
         bool right = addr & CLASS_SIZE(nclass - 1);
 
 
-        struct Page **next = right ? &node->right : &node->left;
+        pageref_t *next = right ? &node->right : &node->left;
 
         if (!*next) {
             if (!alloc) break;
@@ -393,34 +926,37 @@ page_lookup_virtual(struct Page *node, uintptr_t addr, int class, int alloc) {
 
             assert(nclass);
             if (node->phy) {
-                assert(nclass == node->phy->class);
+                assert(nclass == page_phy(node)->class);
                 assert((node->state & NODE_TYPE_MASK) == MAPPING_NODE);
 
-                struct Page *pleft = page_lookup(node->phy, page2pa(node->phy), node->phy->class - 1, PARTIAL_NODE, 1);
+                struct Page *pleft = page_lookup(page_phy(node), page2pa(page_phy(node)), page_phy(node)->class - 1, PARTIAL_NODE, 1);
                 if (!pleft) return NULL;
 
-                assert(node->phy->left && node->phy->right);
+                assert(page_phy(node)->left && page_phy(node)->right);
 
                 alloc_virtual_child(node, &node->left);
                 if (!node->left) return NULL;
                 alloc_virtual_child(node, &node->right);
                 if (!node->right) return NULL;
 
-                list_del((struct List *)node);
-                page_unref(node->phy);
-                node->phy = NULL;
+                list_del(node);
+                page_unref(page_phy(node));
+                node->phy = 0;
                 node->state = INTERMEDIATE_NODE;
             } else {
                 assert(node->state == INTERMEDIATE_NODE);
-                *next = alloc_descriptor(INTERMEDIATE_NODE);
-                (*next)->parent = node;
+                struct Page *child = alloc_descriptor(INTERMEDIATE_NODE);
+                child->parent = page2ref(node);
+                *next = page2ref(child);
             }
             assert(*next);
         }
-        node = *next;
+        node = ref2page(*next);
         nclass--;
     }
 
+    if (node) lookup_cache_insert(spc, addr, nclass, node);
+
     if (node && (alloc == LOOKUP_ALLOC || (alloc == LOOKUP_SPLIT && node->phy)) && trace_memory_more) {
         check_virtual_class(node, class);
     }
@@ -456,35 +992,58 @@ unmap_page_remove(struct Page *node) {
     if (node->phy) {
         assert(!node->left && !node->right);
         assert((node->state & NODE_TYPE_MASK) == MAPPING_NODE);
-        page_unref(node->phy);
+        page_unref(page_phy(node));
     } else {
         assert((node->state & NODE_TYPE_MASK) == INTERMEDIATE_NODE);
-        unmap_page_remove(node->left);
-        unmap_page_remove(node->right);
+        unmap_page_remove(page_left(node));
+        unmap_page_remove(page_right(node));
     }
 
-    if (node->parent) {
-        *(node->parent->left == node ?
-                  &node->parent->left :
-                  &node->parent->right) = NULL;
+    struct Page *parent = page_parent(node);
+    if (parent) {
+        *(page_left(parent) == node ?
+                  &parent->left :
+                  &parent->right) = 0;
     }
 
     free_descriptor(node);
 }
 
+/* Drop reference to emptied page table, last
+ * reference is passed to the page table cache */
+static void
+release_pt(pte_t *pt) {
+    struct Page *page = page_lookup(NULL, (uintptr_t)PADDR(pt), 0, PARTIAL_NODE, 0);
+    if (page->refc != 1 || page->left || page->right) {
+        page_unref(page);
+        return;
+    }
+
+    if (pt_cache.count == pt_cache.capacity) magazine_drain(&pt_cache, pt_cache.batch);
+    pt_cache.pages[pt_cache.count++] = page;
+#ifdef SANITIZE_SHADOW_BASE
+    if (current_space) platform_asan_poison(pt, CLASS_SIZE(0));
+#endif
+}
+
+/* Remove entries [i0, i1) of page table pt,
+ * base is virtual address corresponding to entry i0 */
 static void
-remove_pt(pte_t *pt, pte_t base, size_t step, uintptr_t i0, uintptr_t i1) {
+remove_pt(pte_t *pt, uintptr_t base, size_t step, uintptr_t i0, uintptr_t i1, struct TlbBatch *tlb) {
     assert(step == 1 * GB || step == 2 * MB || step == 4 * KB || step == 512 * GB);
-    for (size_t i = i0; i < i1; i++) {
+    for (size_t i = i0; i < i1; i++, base += step) {
         if (!(pt[i] & PTE_P)) continue;
         assert(!(pt[i] & PTE_PS) || (step == 1 * GB || step == 2 * MB));
 
         if (!(pt[i] & PTE_PS) && step > 4 * KB) {
             pte_t *pt2 = KADDR(PTE_ADDR(pt[i]));
-            remove_pt(pt2, base, step / PT_ENTRY_COUNT, 0, PT_ENTRY_COUNT);
-            page_unref(page_lookup(NULL, (uintptr_t)PADDR(pt2), 0, PARTIAL_NODE, 0));
+            remove_pt(pt2, base, step / PT_ENTRY_COUNT, 0, PT_ENTRY_COUNT, tlb);
+            release_pt(pt2);
         }
 
+        /* Single invalidation is enough for huge page; for page tables
+         * it also drops cached paging structures referencing them */
+        tlb_batch_add(tlb, base);
         pt[i] = 0;
     }
 }
@@ -527,48 +1086,49 @@ check_physical_tree(struct Page *page) {
     assert_physical(page);
     assert(page->class >= 0);
     assert(!(page2pa(page) & CLASS_MASK(page->class)));
+    if (page->class == PAGE_INDEX_CLASS && page_index_slot(page2pa(page)))
+        assert(ref2page(*page_index_slot(page2pa(page))) == page);
     if (page->state == ALLOCATABLE_NODE || page->state == RESERVED_NODE) {
-        if (page->left) assert(page->left->state == page->state);
-        if (page->right) assert(page->right->state == page->state);
+        if (page->left) assert(page_left(page)->state == page->state);
+        if (page->right) assert(page_right(page)->state == page->state);
     }
     if (page->left) {
-        assert(page->left->class + 1 == page->class);
-        assert(page2pa(page) == page2pa(page->left));
+        assert(page_left(page)->class + 1 == page->class);
+        assert(page2pa(page) == page2pa(page_left(page)));
     }
     if (page->right) {
-        assert(page->right->class + 1 == page->class);
-        assert(page->addr + (1ULL << (page->class - 1)) == page->right->addr);
+        assert(page_right(page)->class + 1 == page->class);
+        assert(page2pa(page) + CLASS_SIZE(page->class - 1) == page2pa(page_right(page)));
     }
     if (page->parent) {
-        assert(page->parent->class - 1 == page->class);
-        assert((page->parent->left == page) ^ (page->parent->right == page));
+        assert(page_parent(page)->class - 1 == page->class);
+        assert((page_left(page_parent(page)) == page) ^ (page_right(page_parent(page)) == page));
     } else {
         assert(page->class == MAX_CLASS);
         assert(page == &root);
     }
     if (!page->refc) {
         assert(page->head.next && page->head.prev);
-        if (!list_empty((struct List *)page)) {
-            for (struct List *n = page->head.next;
-                 n != &free_classes[page->class]; n = n->next) {
-                assert(n != &page->head);
+        if (!list_empty(page)) {
+            for (struct Page *n = list_next(page);
+                 n != free_list(page); n = list_next(n)) {
+                assert(n != page);
             }
         }
     } else {
-        for (struct List *n = (struct List *)page->head.next;
-             (struct List *)page != n; n = n->next) {
-            struct Page *v = (struct Page *)n;
+        for (struct Page *v = list_next(page);
+             page != v; v = list_next(v)) {
             assert_virtual(v);
-            assert(v->phy == page);
+            assert(page_phy(v) == page);
         }
     }
     if (page->left) {
-        assert(page->left->parent == page);
-        check_physical_tree(page->left);
+        assert(page_parent(page_left(page)) == page);
+        check_physical_tree(page_left(page));
     }
     if (page->right) {
-        assert(page->right->parent == page);
-        check_physical_tree(page->right);
+        assert(page_parent(page_right(page)) == page);
+        check_physical_tree(page_right(page));
     }
 }
 
@@ -581,19 +1141,19 @@ check_virtual_tree(struct Page *page, int class) {
         assert(!(page->state & PROT_LAZY) || !(page->state & PROT_SHARE));
         assert(!page->left && !page->right);
         assert(page->phy);
-        if (!(page->phy->class == class)) cprintf("%d %d\n", page->phy->class, class);
-        assert(page->phy->class == class);
+        if (!(page_phy(page)->class == class)) cprintf("%d %d\n", page_phy(page)->class, class);
+        assert(page_phy(page)->class == class);
     } else {
         assert(!page->phy);
         assert(page->state == INTERMEDIATE_NODE);
     }
     if (page->left) {
-        assert(page->left->parent == page);
-        check_virtual_tree(page->left, class - 1);
+        assert(page_parent(page_left(page)) == page);
+        check_virtual_tree(page_left(page), class - 1);
     }
     if (page->right) {
-        assert(page->right->parent == page);
-        check_virtual_tree(page->right, class - 1);
+        assert(page_parent(page_right(page)) == page);
+        check_virtual_tree(page_right(page), class - 1);
     }
 }
 
@@ -606,30 +1166,42 @@ dump_virtual_tree(struct Page *node, int class) {
     if (!node)
         return;
     
-    dump_virtual_tree(node->left, node->left->class);
+    dump_virtual_tree(page_left(node), class - 1);
 
     if (node->phy)
     {
-        void * start = (void *)PTE_ADDR(node->phy->addr);
-        cprintf("%p-%p (class %d)\n", start, start + CLASS_MASK(node->class), node->class);
+        void * start = (void *)page2pa(page_phy(node));
+        cprintf("%p-%p (class %d)\n", start, start + CLASS_MASK(page_phy(node)->class), page_phy(node)->class);
     }
 
-    dump_virtual_tree(node->right, node->right->class);
+    dump_virtual_tree(page_right(node), class - 1);
 }
 
 void
 dump_memory_lists(void) {
     // LAB 6: Your code here
-    struct List *li = NULL;
     for (int pclass = 0; pclass < MAX_CLASS; pclass++)
     {
-        for (li = free_classes[pclass].next; li != &free_classes[pclass]; li = li->next) {
-            struct Page *page = (struct Page *)li;
-            cprintf("%016lx - %016llx (class %d)\n", page2pa(page), page2pa(page) + CLASS_MASK(pclass), pclass);
+        for (int color = 0; color < (pclass ? 1 : PAGE_COLORS); color++) {
+            struct Page *list = pclass ? &free_classes[pclass] : &free_colors[color];
+            for (struct Page *page = list_next(list); page != list; page = list_next(page)) {
+                cprintf("%016lx - %016llx (class %d)\n", page2pa(page), page2pa(page) + CLASS_MASK(pclass), pclass);
+            }
         }
     }
 }
 
+void
+dump_page_colors(void) {
+    cprintf("Page coloring: %s, %d colors\nFree 4K pages per color:", page_coloring ? "on" : "off", PAGE_COLORS);
+    for (int color = 0; color < PAGE_COLORS; color++) {
+        size_t n = 0;
+        for (struct Page *page = list_next(&free_colors[color]); page != &free_colors[color]; page = list_next(page)) n++;
+        cprintf("%s%zu", color % 8 ? " " : "\n  ", n);
+    }
+    cprintf("\n");
+}
+
 /*
  * Pretty-print page table
  * You can read about page the table
@@ -675,16 +1247,39 @@ dump_page_table(pte_t *pml4) {
     }
 }
 
+/* Allocation flags selecting next round-robin cache color of
+ * address space for class 0 page. Caller advances spc->color_next
+ * when the page is actually allocated */
+static int
+page_color_flags(struct AddressSpace *spc, int class) {
+    if (!page_coloring || class || !spc) return 0;
+    return ALLOC_COLOR(spc->color_next % PAGE_COLORS);
+}
+
 inline static int
-alloc_pt(pte_t *dst) {
+alloc_pt(struct AddressSpace *spc, pte_t *dst) {
     if (!(*dst & PTE_P) || (*dst & PTE_PS)) {
-        struct Page *page = alloc_page(0, ALLOC_BOOTMEM);
+        /* Cached tables are zeroed and keep their reference */
+        struct Page *page = magazine_take(&pt_cache, ALLOC_BOOTMEM);
+        if (page) {
+            pt_reuses++;
+            *dst = page2pa(page) | PTE_U | PTE_W | PTE_P;
+#ifdef SANITIZE_SHADOW_BASE
+            if (current_space) platform_asan_unpoison(KADDR(page2pa(page)), CLASS_SIZE(0));
+#endif
+            return 0;
+        }
+
+        int color = page_color_flags(spc, 0);
+        page = alloc_page(0, ALLOC_BOOTMEM | color);
         if (!page) return -E_NO_MEM;
+        if (color) spc->color_next++;
 #ifdef SANITIZE_SHADOW_BASE
         assert(page2pa(page) + CLASS_SIZE(page->class) <= BOOT_MEM_SIZE);
 #endif
         assert(!page->refc);
         page_ref(page);
+        pt_allocs++;
         *dst = page2pa(page) | PTE_U | PTE_W | PTE_P;
 
 #ifdef SANITIZE_SHADOW_BASE
@@ -695,39 +1290,8 @@ alloc_pt(pte_t *dst) {
     return 0;
 }
 
-static void
-propagate_one_pml4(struct AddressSpace *dst, struct AddressSpace *src) {
-    /* Reference level 3 page tables */
-    for (size_t i = NUSERPML4; i < PML4_ENTRY_COUNT; i++) {
-        if (src->pml4[i] & PTE_P && i != PML4_INDEX(UVPT))
-            page_ref(page_lookup(NULL, PTE_ADDR(src->pml4[i]), 0, PARTIAL_NODE, 0));
-    }
-
-    /* Dereference old level 3 page tables */
-    for (size_t i = NUSERPML4; i < PML4_ENTRY_COUNT; i++) {
-        if (dst->pml4[i] & PTE_P && i != PML4_INDEX(UVPT))
-            page_ref(page_lookup(NULL, PTE_ADDR(dst->pml4[i]), 0, PARTIAL_NODE, 0));
-    }
-
-    pte_t uvpt = dst->pml4[PML4_INDEX(UVPT)];
-    memcpy(dst->pml4 + NUSERPML4, src->pml4 + NUSERPML4,
-           PAGE_SIZE - NUSERPML4 * sizeof(pml4e_t));
-    dst->pml4[PML4_INDEX(UVPT)] = uvpt;
-}
-
-static void
-propagate_pml4(struct AddressSpace *spc) {
-    if (!current_space) return;
-
-    if (spc != &kspace) propagate_one_pml4(&kspace, spc);
-    for (size_t i = 0; i < NENV; i++) {
-        if (envs[i].env_status != ENV_FREE && &envs[i].address_space != spc)
-            propagate_one_pml4(&envs[i].address_space, spc);
-    }
-}
-
 inline static int
-alloc_fill_pt(pte_t *dst, pte_t base, size_t step, size_t i0, size_t i1) {
+alloc_fill_pt(struct AddressSpace *spc, pte_t *dst, pte_t base, size_t step, size_t i0, size_t i1) {
     assert(i0 != i1);
     bool need_recur = step > 1 * GB || (step == 1 * GB && !has_1gb_pages);
     if (!need_recur && step != 4 * KB) base |= PTE_PS;
@@ -736,9 +1300,9 @@ alloc_fill_pt(pte_t *dst, pte_t base, size_t step, size_t i0, size_t i1) {
 
     for (size_t i = i0; i < i1; i++, base += step) {
         if (need_recur) {
-            int res = alloc_pt(dst + i);
+            int res = alloc_pt(spc, dst + i);
             if (res < 0) return res;
-            res = alloc_fill_pt(dst + i, base, step / PT_ENTRY_COUNT, 0, PT_ENTRY_COUNT);
+            res = alloc_fill_pt(spc, dst + i, base, step / PT_ENTRY_COUNT, 0, PT_ENTRY_COUNT);
             if (res < 0) return res;
         } else {
             if ((PTE_ADDR(base) & (step - 1))) cprintf("%08lX %08lX\n", (long)PTE_ADDR(base), step);
@@ -750,81 +1314,233 @@ alloc_fill_pt(pte_t *dst, pte_t base, size_t step, size_t i0, size_t i1) {
     return 0;
 }
 
-/* Copy physical page contents to some virtual address
- *
- * To copy physical address you can use linear
- * physical memeory mapping to KERN_BASE_ADDR
- * (via KADDR).
- *
- * You need temporaly switch to dst address space and
- * restore previous address space afterwards.
- *
- * Don't forget to disable write protection, since
- * destination page might be read-only
- *
- * TIP: switch_address_space, nosan_memcpy, and set_wp are used here
- */
+/* Translate address va of spc to its kernel direct mapping address
+ * and store number of bytes till the end of physical page to *left.
+ * Lazy page is resolved first when it is going to be written */
+static uint8_t *
+space_kaddr(struct AddressSpace *spc, uintptr_t va, bool write, size_t *left) {
+    struct Page *node = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+    if (!node || !node->phy) return NULL;
+
+    if (write && node->state & PROT_LAZY) {
+        if (force_alloc_page(spc, va, cow_copy_class) < 0) return NULL;
+        node = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+        if (!node || !node->phy) return NULL;
+    }
+
+    struct Page *phy = page_phy(node);
+    size_t offset = va & CLASS_MASK(phy->class);
+    *left = CLASS_SIZE(phy->class) - offset;
+    return (uint8_t *)KADDR(page2pa(phy)) + offset;
+}
+
+/* Copy size bytes from kernel address src to address dst of spc.
+ * Destination is written through physical memory mapping,
+ * so neither address space switch nor write protection toggling
+ * is required, and read-only pages can be written too */
+int
+copy_to_space(struct AddressSpace *spc, uintptr_t dst, const void *src, size_t size) {
+    assert(spc);
+
+    while (size) {
+        size_t left;
+        uint8_t *kva = space_kaddr(spc, dst, 1, &left);
+        if (!kva) return -E_FAULT;
+
+        size_t n = MIN(left, size);
+        nosan_memcpy(kva, (void *)src, n);
+        src = (const uint8_t *)src + n;
+        dst += n;
+        size -= n;
+    }
+    return 0;
+}
+
+/* Copy size bytes from address src of spc to kernel address dst */
+int
+copy_from_space(struct AddressSpace *spc, void *dst, uintptr_t src, size_t size) {
+    assert(spc);
+
+    while (size) {
+        size_t left;
+        uint8_t *kva = space_kaddr(spc, src, 0, &left);
+        if (!kva) return -E_FAULT;
+
+        size_t n = MIN(left, size);
+        nosan_memcpy(dst, kva, n);
+        dst = (uint8_t *)dst + n;
+        src += n;
+        size -= n;
+    }
+    return 0;
+}
+
+/* Copy physical page contents to va of address space dst */
 static void
 memcpy_page(struct AddressSpace *dst, uintptr_t va, struct Page *page) {
     assert(current_space);
     assert(dst);
 
-    // LAB 7: Your code here
-    as_memcpy(dst, va, (uintptr_t)KADDR(page2pa(page)), CLASS_SIZE(page->class));
+    int res = copy_to_space(dst, va, KADDR(page2pa(page)), CLASS_SIZE(page->class));
+    assert(!res);
 }
 
-void
-as_memcpy(struct AddressSpace *dst, uintptr_t dst_va, uintptr_t src_va, size_t size) {
-    assert(dst);
+inline static void
+pcid_set_stale(int cpu, uint16_t pcid) {
+    pcid_stale[cpu][pcid / 64] |= 1ULL << (pcid % 64);
+}
 
-    struct AddressSpace * saved_as = switch_address_space(dst);
-    
-    set_wp(0);
-    nosan_memcpy((void *)dst_va, (void *)src_va, size);
-    set_wp(1);
+/* Allocate PCID for new address space.
+ * PCIDs are recycled round-robin so recently
+ * freed identifiers are reused as late as possible */
+static uint16_t
+pcid_alloc(void) {
+    if (!pcid_enabled) return 0;
+
+    for (size_t i = 0; i < NPCID; i++, pcid_next++) {
+        if (pcid_next >= NPCID) pcid_next = 1;
+        uint16_t pcid = pcid_next;
+        if (!(pcid_used[pcid / 64] & (1ULL << (pcid % 64)))) {
+            pcid_used[pcid / 64] |= 1ULL << (pcid % 64);
+            pcid_next++;
+            return pcid;
+        }
+    }
+
+    panic("Out of PCIDs\n");
+}
+
+/* Release PCID making sure none of its TLB entries survive */
+static void
+pcid_free(uint16_t pcid) {
+    if (!pcid_enabled || !pcid) return;
+
+    pcid_used[pcid / 64] &= ~(1ULL << (pcid % 64));
+    if (invpcid_supported)
+        invpcid(INVPCID_SINGLE, pcid, 0);
+    else
+        pcid_set_stale(cpunum(), pcid);
+
+    /* INVPCID only affects this CPU */
+    for (size_t i = 0; i < ncpu; i++)
+        if (i != (size_t)cpunum()) pcid_set_stale(i, pcid);
+}
 
-    switch_address_space(saved_as);
+/* Flush TLB entries of every address space
+ * (kernel part of address space is shared by all of them) */
+static void
+tlb_invalidate_all(void) {
+    if (invpcid_supported) {
+        invpcid(INVPCID_ALL_GLOBAL, 0, 0);
+    } else {
+        memset(pcid_stale[cpunum()], 0xFF, sizeof pcid_stale[0]);
+        lcr3(rcr3());
+    }
 }
 
+/* Make other CPUs drop TLB entries of spc.
+ * CPUs that have spc loaded (every CPU for kspace) are interrupted
+ * and waited for, others only need to forget cached PCID entries.
+ * Caller holds the kernel lock, so other CPUs serve
+ * shootdowns while spinning in lock_kernel() */
 static void
-tlb_invalidate_range(struct AddressSpace *spc, uintptr_t start, uintptr_t end) {
-    if (current_space == spc || !current_space) {
+tlb_shootdown(struct AddressSpace *spc) {
+    int self = cpunum();
+    bool wait = 0;
+
+    for (size_t i = 0; i < ncpu; i++) {
+        if ((int)i == self || cpus[i].cpu_status == CPU_UNUSED) continue;
+
+        if (spc == &kspace || cpus[i].cpu_space == spc) {
+            cpus[i].cpu_tlb_flush = 1;
+            lapic_ipi(i, T_TLBFLUSH);
+            wait = 1;
+        } else if (pcid_enabled) {
+            pcid_set_stale(i, spc->pcid);
+        }
+    }
+
+    for (size_t i = 0; wait && i < ncpu; i++)
+        while (cpus[i].cpu_tlb_flush) asm volatile("pause");
+}
+
+/* Flush TLB if some other CPU requested it */
+void
+tlb_shootdown_serve(void) {
+    if (!thiscpu->cpu_tlb_flush) return;
+    tlb_invalidate_all();
+    thiscpu->cpu_tlb_flush = 0;
+}
+
+/* Invalidate all queued addresses and empty the batch */
+static void
+tlb_batch_flush(struct TlbBatch *tlb) {
+    struct AddressSpace *spc = tlb->spc;
+    if (!tlb->count && !tlb->full) return;
+
+    if (pcid_enabled && spc == &kspace) {
+        /* Other address spaces keep TLB entries
+         * of kernel mappings tagged with their PCIDs */
+        tlb_invalidate_all();
+    } else if (pcid_enabled && current_space != spc) {
+        /* TLB entries of inactive address space
+         * are preserved when PCIDs are enabled */
+        if (!invpcid_supported)
+            pcid_set_stale(cpunum(), spc->pcid);
+        else if (tlb->full)
+            invpcid(INVPCID_SINGLE, spc->pcid, 0);
+        else {
+            for (size_t i = 0; i < tlb->count; i++)
+                invpcid(INVPCID_ADDR, spc->pcid, tlb->addrs[i]);
+        }
+    } else if (current_space == spc || !current_space) {
         /* If we need to invalidate a lot of memory, just flush whole cache */
-        if (start - end > 512 * GB)
+        if (tlb->full)
             lcr3(rcr3());
         else {
-            while (start < end) {
-                invlpg((void *)start);
-                start += PAGE_SIZE;
-            }
+            for (size_t i = 0; i < tlb->count; i++)
+                invlpg((void *)tlb->addrs[i]);
         }
     }
+
+    if (ncpu > 1) tlb_shootdown(spc);
+
+    tlb->count = 0;
+    tlb->full = 0;
 }
 
+/* Unmap page from address space. Invalidated addresses are
+ * appended to tlb if provided and flushed immediately otherwise */
 static void
-unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
+unmap_page(struct AddressSpace *spc, uintptr_t addr, int class, struct TlbBatch *tlb) {
     if (trace_memory) cprintf("<%p> Unmapping [%08lX, %08lX]\n",
                               spc, addr, addr + (long)CLASS_MASK(class));
     int res;
     assert(!(addr & CLASS_MASK(class)));
 
-    struct Page *node = page_lookup_virtual(spc->root, addr, class, LOOKUP_ALLOC);
+    struct Page *node = page_lookup_virtual(spc, addr, class, LOOKUP_ALLOC);
     if (node) unmap_page_remove(node);
+    lookup_cache_invalidate(spc, addr, class);
     /* Disallow root node deallocation */
     if (node == spc->root)
         spc->root = alloc_descriptor(INTERMEDIATE_NODE);
 
+    struct TlbBatch local_tlb = {.spc = spc};
+    if (!tlb) tlb = &local_tlb;
+    assert(tlb->spc == spc);
+
     uintptr_t end = addr + CLASS_SIZE(class);
-    uintptr_t inval_start = addr, inval_end = end;
 
     size_t pml4i0 = PML4_INDEX(addr), pml4i1 = PML4_INDEX(end);
     if (class >= 27) {
-        remove_pt(spc->pml4, addr, 512 * GB, pml4i0, pml4i1);
-        if (pml4i1 - 1 >= NUSERPML4) propagate_pml4(spc);
+        /* Kernel half of PML4 is shared by all address spaces and never removed.
+         * Range of MAX_CLASS wraps around, so index 0 means the end of PML4 */
+        if (!pml4i1 || pml4i1 > NUSERPML4) pml4i1 = NUSERPML4;
+        if (pml4i0 < pml4i1) remove_pt(spc->pml4, addr, 512 * GB, pml4i0, pml4i1, tlb);
         goto finish;
     }
 
-    if (!(spc->pml4[pml4i0] & PTE_P)) return;
+    if (!(spc->pml4[pml4i0] & PTE_P)) goto finish;
     pdpe_t *pdp = KADDR(PTE_ADDR(spc->pml4[pml4i0]));
 
     size_t pdpi0 = PDP_INDEX(addr), pdpi1 = PDP_INDEX(end);
@@ -836,24 +1552,23 @@ unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
      * is >= than 1*GB */
 
     if (class >= 18) {
-        remove_pt(pdp, addr, 1 * GB, pdpi0, pdpi1);
+        remove_pt(pdp, addr, 1 * GB, pdpi0, pdpi1, tlb);
         goto finish;
     }
 
     /* If page is not present don't need to do anything */
 
     if (!(pdp[pdpi0] & PTE_P))
-        return;
+        goto finish;
     /* otherwise we need to split 1*GB page hw page
      * into smaller 2*MB pages, allocting new page table level */
     else if (pdp[pdpi0] & PTE_PS) {
         pdpe_t old = pdp[pdpi0];
-        res = alloc_pt(pdp + pdpi0);
+        res = alloc_pt(spc, pdp + pdpi0);
         assert(!res);
         pde_t *pd = KADDR(PTE_ADDR(pdp[pdpi0]));
-        res = alloc_fill_pt(pd, old & ~PTE_PS, 2 * MB, 0, PT_ENTRY_COUNT);
-        inval_start = ROUNDDOWN(inval_start, 1 * GB);
-        inval_end = ROUNDUP(inval_end, 1 * GB);
+        res = alloc_fill_pt(spc, pd, old & ~PTE_PS, 2 * MB, 0, PT_ENTRY_COUNT);
+        tlb_batch_add(tlb, ROUNDDOWN(addr, 1 * GB));
         assert(!res);
     }
     pde_t *pd = KADDR(PTE_ADDR(pdp[pdpi0]));
@@ -873,7 +1588,7 @@ unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
     /* Unmap 2*MB hardware page if size of virtual page
      * is >= than 2*MB */
     if (class >= 9) {
-        remove_pt(pd, addr, 2 * MB, pdi0, pdi1);
+        remove_pt(pd, addr, 2 * MB, pdi0, pdi1, tlb);
         goto finish;
     }
 
@@ -889,17 +1604,16 @@ unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
 
     /* If page is not present don't need to do anything */
     if (!(pd[pdi0] & PTE_P))
-        return;
+        goto finish;
     /* otherwise we need to split 2*MB page hw page
      * into smaller 4*KB pages, allocting new page table level */
     else if (pd[pdi0] & PTE_PS) {
         pdpe_t old = pd[pdi0];
-        res = alloc_pt(pd + pdi0);
+        res = alloc_pt(spc, pd + pdi0);
         assert(!res);
         pde_t *pt = KADDR(PTE_ADDR(pd[pdi0]));
-        res = alloc_fill_pt(pt, old & ~PTE_PS, 4 * KB, 0, PT_ENTRY_COUNT);
-        inval_start = ROUNDDOWN(inval_start, 2 * MB);
-        inval_end = ROUNDUP(inval_end, 2 * MB);
+        res = alloc_fill_pt(spc, pt, old & ~PTE_PS, 4 * KB, 0, PT_ENTRY_COUNT);
+        tlb_batch_add(tlb, ROUNDDOWN(addr, 2 * MB));
         assert(!res);
     }
     pte_t *pt = KADDR(PTE_ADDR(pd[pdi0]));
@@ -908,7 +1622,7 @@ unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
     size_t pti0 = PT_INDEX(addr), pti1 = PT_INDEX(end);
     if (pti0 > pti1) pti1 = PT_ENTRY_COUNT;
     if (class >= 0) {
-        remove_pt(pt, addr, 4 * KB, pti0, pti1);
+        remove_pt(pt, addr, 4 * KB, pti0, pti1, tlb);
         goto finish;
     }
 
@@ -916,7 +1630,7 @@ unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
     assert(0);
 
 finish:
-    tlb_invalidate_range(spc, inval_start, inval_end);
+    if (tlb == &local_tlb) tlb_batch_flush(tlb);
 }
 
 static int
@@ -926,19 +1640,25 @@ map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags)
     assert_physical(page);
     assert(!(addr & CLASS_MASK(page->class)));
 
+    int res;
+    struct TlbBatch tlb = {.spc = spc};
+
     /* NOTE ALLOC_WEAK cannot be map()'ed/unmap()'ed
      * since it does not store any
      * metadata and only exits as a part of page table */
 
     if (!(flags & ALLOC_WEAK)) {
         page_ref(page);
-        unmap_page(spc, addr, page->class);
-        struct Page *mapping = page_lookup_virtual(spc->root, addr, page->class, LOOKUP_ALLOC);
-        if (!mapping) return -E_NO_MEM;
+        unmap_page(spc, addr, page->class, &tlb);
+        struct Page *mapping = page_lookup_virtual(spc, addr, page->class, LOOKUP_ALLOC);
+        if (!mapping) {
+            res = -E_NO_MEM;
+            goto finish;
+        }
 
-        mapping->phy = page;
+        mapping->phy = page2ref(page);
         mapping->state = (PAGE_PROT(flags) & ~PROT_COMBINE) | MAPPING_NODE;
-        list_append((struct List *)page, (struct List *)mapping);
+        list_append(page, mapping);
     }
 
     if (trace_memory) cprintf("<%p> Mapping [%08lX, %08lX] to [%08lX, %08lX] (class=%d flags=%x)\n", spc,
@@ -954,15 +1674,16 @@ map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags)
     size_t pml4i0 = PML4_INDEX(addr), pml4i1 = PML4_INDEX(end);
     /* Fill PML4 range if page size is larger than 512GB */
     if (page->class >= 27) {
-        int res = alloc_fill_pt(spc->pml4, base, 512 * GB, pml4i0, pml4i1);
-        if (pml4i1 - 1 >= NUSERPML4) propagate_pml4(spc);
-        return res;
+        assert(pml4i0 < pml4i1 && pml4i1 <= NUSERPML4);
+        res = alloc_fill_pt(spc, spc->pml4, base, 512 * GB, pml4i0, pml4i1);
+        goto finish;
     }
 
-    /* Allocate empty pdp if required */
+    /* Allocate empty pdp if required,
+     * kernel ones are preallocated and shared */
     if (!(spc->pml4[pml4i0] & PTE_P)) {
-        if (alloc_pt(spc->pml4 + pml4i0) < 0) return -E_NO_MEM;
-        if (pml4i0 >= NUSERPML4) propagate_pml4(spc);
+        assert(pml4i0 < NUSERPML4);
+        if ((res = alloc_pt(spc, spc->pml4 + pml4i0)) < 0) goto finish;
     }
     assert(!(spc->pml4[pml4i0] & PTE_PS)); /* There's (yet) no support for 512GB pages in x86 arch */
     pdpe_t *pdp = KADDR(PTE_ADDR(spc->pml4[pml4i0]));
@@ -973,16 +1694,22 @@ map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags)
     /* Fixup index if pdpi0 == 511 and pdpi1 == 0 (and should be 512) */
     if (pdpi0 > pdpi1) pdpi1 = PDP_ENTRY_COUNT;
     /* Fill PDP range if page size is larger than 1GB */
-    if (page->class >= 18) return alloc_fill_pt(pdp, base, 1 * GB, pdpi0, pdpi1);
+    if (page->class >= 18) {
+        res = alloc_fill_pt(spc, pdp, base, 1 * GB, pdpi0, pdpi1);
+        goto finish;
+    }
 
     /* Allocate empty pd... */
-    if (!(pdp[pdpi0] & PTE_P) && alloc_pt(pdp + pdpi0) < 0) return -E_NO_MEM;
+    if (!(pdp[pdpi0] & PTE_P)) {
+        if ((res = alloc_pt(spc, pdp + pdpi0)) < 0) goto finish;
+    }
     /* ...or split 1GB page into 2MB pages if required */
     else if (pdp[pdpi0] & PTE_PS) {
         pdpe_t old = pdp[pdpi0];
-        if (alloc_pt(pdp + pdpi0) < 0) return -E_NO_MEM;
+        if ((res = alloc_pt(spc, pdp + pdpi0)) < 0) goto finish;
         pde_t *pd = KADDR(PTE_ADDR(pdp[pdpi0]));
-        if (alloc_fill_pt(pd, old & ~PTE_PS, 2 * MB, 0, PT_ENTRY_COUNT) < 0) return -E_NO_MEM;
+        tlb_batch_add(&tlb, ROUNDDOWN(addr, 1 * GB));
+        if ((res = alloc_fill_pt(spc, pd, old & ~PTE_PS, 2 * MB, 0, PT_ENTRY_COUNT)) < 0) goto finish;
     }
     /* Calculate kernel virtual address of page directory */
     pde_t *pd = KADDR(PTE_ADDR(pdp[pdpi0]));
@@ -998,7 +1725,10 @@ map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags)
     size_t pdi0 = PD_INDEX(addr);
     size_t pdi1 = PD_INDEX(end);
     if (pdpi0 > pdpi1) pdpi1 = PD_ENTRY_COUNT;
-    if (page->class >= 9) return alloc_fill_pt(pd, base, 2 * MB, pdi0, pdi1);
+    if (page->class >= 9) {
+        res = alloc_fill_pt(spc, pd, base, 2 * MB, pdi0, pdi1);
+        goto finish;
+    }
 
     /* Allocate empty pt or split 2MB page into 4KB pages if required and
      * calculate virtual address into pt.
@@ -1008,13 +1738,16 @@ map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags)
     // LAB 7: Your code here
 
     /* Allocate empty pd... */
-    if (!(pd[pdi0] & PTE_P) && alloc_pt(pd + pdi0) < 0) return -E_NO_MEM;
+    if (!(pd[pdi0] & PTE_P)) {
+        if ((res = alloc_pt(spc, pd + pdi0)) < 0) goto finish;
+    }
     /* ...or split 2MB page into 4KB pages if required */
     else if (pd[pdi0] & PTE_PS) {
         pdpe_t old = pd[pdi0];
-        if (alloc_pt(pd + pdi0) < 0) return -E_NO_MEM;
+        if ((res = alloc_pt(spc, pd + pdi0)) < 0) goto finish;
         pde_t *pt = KADDR(PTE_ADDR(pd[pdi0]));
-        if (alloc_fill_pt(pt, old & ~PTE_PS, 4 * KB, 0, PT_ENTRY_COUNT) < 0) return -E_NO_MEM;
+        tlb_batch_add(&tlb, ROUNDDOWN(addr, 2 * MB));
+        if ((res = alloc_fill_pt(spc, pt, old & ~PTE_PS, 4 * KB, 0, PT_ENTRY_COUNT)) < 0) goto finish;
     }
 
     pte_t *pt = KADDR(PTE_ADDR(pd[pdi0]));
@@ -1024,38 +1757,47 @@ map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags)
     size_t pti0 = PT_INDEX(addr), pti1 = PT_INDEX(end);
     if (pti0 > pti1) pti1 = PT_ENTRY_COUNT;
     /* Fill PT range if page size is larger than 4KB */
-    if (page->class >= 0) return alloc_fill_pt(pt, base, 4 * KB, pti0, pti1);
+    if (page->class >= 0) {
+        res = alloc_fill_pt(spc, pt, base, 4 * KB, pti0, pti1);
+        goto finish;
+    }
 
     /* We cannot allocate less than a page */
     assert(0);
+
+finish:
+    tlb_batch_flush(&tlb);
+    return res;
 }
 
 void
 unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size) {
     int class = 0;
+    struct TlbBatch tlb = {.spc = dspace};
 
     uintptr_t start = ROUNDDOWN(dst, 1ULL << CLASS_BASE);
     uintptr_t end = ROUNDUP(dst + size, 1ULL << CLASS_BASE);
 
     for (; class < MAX_CLASS && start + CLASS_SIZE(class) <= end; class ++) {
         if (start & CLASS_SIZE(class)) {
-            unmap_page(dspace, start, class);
+            unmap_page(dspace, start, class, &tlb);
             start += CLASS_SIZE(class);
         }
     }
 
     for (; class >= 0 && start < end; class --) {
         if (start + CLASS_SIZE(class) <= end) {
-            unmap_page(dspace, start, class);
+            unmap_page(dspace, start, class, &tlb);
             start += CLASS_SIZE(class);
         }
     }
+
+    tlb_batch_flush(&tlb);
 }
 
 /* Just allocate page, without mapping it */
 static struct Page *
 alloc_page(int class, int flags) {
-    struct List *li = NULL;
     struct Page *peer = NULL;
 
     if (flags & ALLOC_POOL) flags |= ALLOC_BOOTMEM;
@@ -1063,20 +1805,66 @@ alloc_page(int class, int flags) {
     if (current_space) flags &= ~ALLOC_BOOTMEM;
 #endif
 
+    if (class) flags &= ~ALLOC_COLORED;
+
+    /* Fast path: take pre-split page from per-CPU magazine */
+    struct PageMagazine *mag = page_magazine(class);
+    if (mag && !(flags & (ALLOC_POOL | ALLOC_NOMAGAZINE))) {
+        struct Page *page = magazine_pop(mag, flags);
+        if (page) return page;
+    }
+
+    /* Address of allocated page within peer */
+    uintptr_t addr;
+retry:
     /* Find page that is not smaller than requested
      * (Pool memory should also be within BOOT_MEM_SIZE) */
-    for (int pclass = class; pclass < MAX_CLASS; pclass++, li = NULL) {
-        for (li = free_classes[pclass].next; li != &free_classes[pclass]; li = li->next) {
-            peer = (struct Page *)li;
-            assert(peer->state == ALLOCATABLE_NODE);
-            assert_physical(peer);
-            if (!(flags & ALLOC_BOOTMEM) || page2pa(peer) + CLASS_SIZE(class) < BOOT_MEM_SIZE) goto found;
+    for (int pclass = class; pclass < MAX_CLASS; pclass++) {
+        /* Larger class allocation is about to split bigger
+         * page while smaller free buddies are not merged yet */
+        if (pclass == class + 1 && class && coalesce_stats.pending) {
+            coalesce_free_pages();
+            goto retry;
+        }
+        /* Colored allocation only looks at the list of its color,
+         * uncolored one looks at every color */
+        int color = flags & ALLOC_COLORED ? ALLOC_COLOR_OF(flags) : 0;
+        int ncolors = pclass || (flags & ALLOC_COLORED) ? 1 : PAGE_COLORS;
+        for (; ncolors--; color++) {
+            struct Page *list = pclass ? &free_classes[pclass] : &free_colors[color];
+            for (peer = list_next(list); peer != list; peer = list_next(peer)) {
+                assert(peer->state == ALLOCATABLE_NODE);
+                assert_physical(peer);
+                addr = page2pa(peer);
+                if (flags & ALLOC_COLORED) {
+                    /* Peer should contain page of requested color */
+                    addr += (uintptr_t)((color - PAGE_COLOR(addr)) & (PAGE_COLORS - 1)) << CLASS_BASE;
+                    if (addr >= page2pa(peer) + CLASS_SIZE(pclass)) continue;
+                }
+                if (!(flags & ALLOC_BOOTMEM) || addr + CLASS_SIZE(class) < BOOT_MEM_SIZE) goto found;
+            }
         }
     }
+
+    /* Free buddies might not be merged yet */
+    if (coalesce_stats.pending) {
+        coalesce_free_pages();
+        goto retry;
+    }
+
+    /* Any color is better than nothing */
+    if (flags & ALLOC_COLORED) {
+        flags &= ~ALLOC_COLORED;
+        goto retry;
+    }
+
+    /* Memory might be held by magazines, zeroed page pools or page table cache */
+    if (magazines_drain_all() || zero_pools_drain_all() ||
+        magazine_drain(&pt_cache, pt_cache.count)) goto retry;
     return NULL;
 
 found:
-    list_del(li);
+    list_del(peer);
 
     size_t ndesc = 0;
     static bool allocating_pool;
@@ -1091,7 +1879,7 @@ found:
 #endif
         ndesc = POOL_ENTRIES_FOR_SIZE(CLASS_SIZE(class));
         for (size_t i = 0; i < ndesc; i++)
-            list_append(&free_descriptors, (struct List *)&newpool->data[i]);
+            list_append(&free_descriptors, &newpool->data[i]);
         newpool->next = first_pool;
         first_pool = newpool;
         free_desc_count += ndesc;
@@ -1099,7 +1887,7 @@ found:
                                        ndesc, page2pa(peer), page2pa(peer) + (long)CLASS_MASK(class));
     }
 
-    struct Page *new = page_lookup(peer, page2pa(peer), class, PARTIAL_NODE, 1);
+    struct Page *new = page_lookup(peer, addr, class, PARTIAL_NODE, 1);
     assert(!new->refc);
 
     if (flags & ALLOC_POOL) {
@@ -1126,10 +1914,10 @@ region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size) {
     uintptr_t end = ROUNDUP(addr + size, PAGE_SIZE);
     int res = 0;
     while (start < end) {
-        struct Page *page = page_lookup_virtual(spc->root, start, 0, LOOKUP_PRESERVE);
+        struct Page *page = page_lookup_virtual(spc, start, 0, LOOKUP_PRESERVE);
         if (page && page->phy) {
-            res = MAX(res, page->phy->refc + (page->phy->left || page->phy->right));
-            start += CLASS_SIZE(page->phy->class);
+            res = MAX(res, page_phy(page)->refc + (page_phy(page)->left || page_phy(page)->right));
+            start += CLASS_SIZE(page_phy(page)->class);
         } else
             start += CLASS_SIZE(0);
     }
@@ -1197,65 +1985,137 @@ alloc_composite_page(struct AddressSpace *spc, uintptr_t addr, int class, int fl
 
     assert(!(addr & CLASS_MASK(class)));
 
-    struct Page *page = alloc_page(class, flags);
+    int color = page_color_flags(spc, class);
+    struct Page *page = alloc_page(class, flags | color);
     if (page) {
+        if (color) spc->color_next++;
         res = map_page(spc, addr, page, flags);
     } else if (class) {
         /* If bigger page is not found try
          * to compose page from smaller pages recursively */
         if ((res = alloc_composite_page(spc, addr, class - 1, flags)) < 0) return res;
         if ((res = alloc_composite_page(spc, addr + CLASS_SIZE(class - 1), class - 1, flags)) < 0)
-            unmap_page(spc, addr, class - 1);
+            unmap_page(spc, addr, class - 1, NULL);
     }
 
     return res;
 }
 
-int
-force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
+/* Map pre-zeroed page of given class,
+ * returns -E_NO_ENT if there is none */
+static int
+map_zeroed_page(struct AddressSpace *spc, uintptr_t addr, int class, int flags) {
+    struct PageMagazine *pool = NULL;
+    for (size_t i = 0; i < NMAGAZINES; i++)
+        if (zero_pools[i].class == class) pool = &zero_pools[i];
+    if (!pool) return -E_NO_ENT;
+
+    int color = page_color_flags(spc, class);
+    struct Page *page = magazine_take(pool, color);
+    if (!page) return -E_NO_ENT;
+    if (color) spc->color_next++;
+
+    /* Mapping holds its own reference, drop the pool one */
+    int res = map_page(spc, addr, page, flags);
+    page_unref(page);
+    return res;
+}
 
-    int res = -E_FAULT;
-    /* FIXME We need to propagate kernel PML4E
-     * changes to every AddressSpace or just use KPTI
-     * (now it's ok since kernel does not map huge chunks of memory (>= 512GB)
-     * to higher part of address space after initiallization) */
+/* Eagerly back region [dst, dst + size) of spc with physical
+ * pages of given class filled according to ALLOC_ZERO/ALLOC_ONE.
+ * Pages are never composed of smaller ones, so if there is not enough
+ * memory or it is too fragmented, already mapped part is unmapped
+ * and -E_NO_MEM is returned. -E_NOT_SUPP is returned for 1GB
+ * pages if CPU does not support them */
+int
+map_populated_region(struct AddressSpace *spc, uintptr_t dst, uintptr_t size, int class, int flags) {
+    if ((dst | size) & CLASS_MASK(class) || !size) return -E_INVAL;
+    if (class >= CLASS_1G && !has_1gb_pages) return -E_NOT_SUPP;
+
+    int prot = flags & PROT_ALL & ~(PROT_LAZY | PROT_COMBINE);
+    for (uintptr_t va = dst; va < dst + size; va += CLASS_SIZE(class)) {
+        int res;
+        if (!(flags & ALLOC_ZERO) || (res = map_zeroed_page(spc, va, class, prot)) == -E_NO_ENT) {
+            int color = page_color_flags(spc, class);
+            struct Page *page = alloc_page(class, color);
+            if (page) {
+                if (color) spc->color_next++;
+                page_ref(page);
+                nosan_memset(KADDR(page2pa(page)), flags & ALLOC_ONE ? 0xFF : 0x00, CLASS_SIZE(class));
+                res = map_page(spc, va, page, prot);
+                page_unref(page);
+            } else
+                res = -E_NO_MEM;
+        }
 
-    static_assert(!(MAX_USER_ADDRESS & (HUGE_PAGE_SIZE * 512 * 512 - 1)), "MAX_USER_ADDRESS should be alligned on 512GiB");
+        if (res < 0) {
+            if (va > dst) unmap_region(spc, dst, va - dst);
+            return res;
+        }
+    }
 
-    /* If we are working with kernel addresses
-     * kspace should be current */
-    struct AddressSpace *old = NULL;
-    assert(current_space);
-    old = switch_address_space(spc = (va > MAX_USER_ADDRESS ? &kspace : spc));
+    return 0;
+}
 
+/* Resolve lazy page containing va in current address space spc */
+static int
+do_force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
+    assert(current_space == spc);
 
-    /* Lookup page mapping such that it's class it not larger than MAX_ALLOCATION_CLASS */
+    int res = -E_FAULT;
     struct Page *page;
-    if (!(page = page_lookup_virtual(spc->root, va, maxclass, LOOKUP_SPLIT))) goto fault;
-    if (!(page = page_lookup_virtual(spc->root, va, 0, LOOKUP_PRESERVE))) goto fault;
-    if (!(page->state & PROT_LAZY)) goto fault;
+    if (!(page = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE))) goto fault;
+    if (!(page->state & PROT_LAZY) || !page->phy) goto fault;
+
+    /* Split shared mapping such that its class is not larger than maxclass,
+     * so only that part gets copied. Unique pages are remapped as a whole */
+    if (!PAGE_IS_UNIQ(page_phy(page)) && page_phy(page)->class > maxclass) {
+        if (!page_lookup_virtual(spc, va, maxclass, LOOKUP_SPLIT)) goto fault;
+        if (!(page = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE))) goto fault;
+        assert(page->phy && page_phy(page)->class <= maxclass);
+    }
 
-    va &= ~CLASS_MASK(page->phy->class);
+    va &= ~CLASS_MASK(page_phy(page)->class);
 
-    if (PAGE_IS_UNIQ(page->phy)) {
+    if (PAGE_IS_UNIQ(page_phy(page))) {
         /* If we have the only reference to the page and
          * and its mapping to itself we can actually just
          * disable lazy flag and not bother copying */
-        res = map_page(spc, va, page->phy, page->state & ~PROT_LAZY);
+        res = map_page(spc, va, page_phy(page), page->state & ~PROT_LAZY);
     } else {
         if (trace_memory) {
             cprintf("<%p> Allocating new page [%08lX, %08lX] flags=%x\n", spc,
-                    va, va + (long)CLASS_MASK(page->phy->class), page->state & PROT_ALL & ~PROT_LAZY);
+                    va, va + (long)CLASS_MASK(page_phy(page)->class), page->state & PROT_ALL & ~PROT_LAZY);
         }
 
-        struct Page *phy = page->phy;
-        page_ref(phy);
-        res = alloc_composite_page(spc, va, phy->class, page->state & PROT_ALL & ~PROT_LAZY);
-        if (!res) memcpy_page(spc, va, phy);
-        page_unref(phy);
+        struct Page *phy = page_phy(page);
+        int prot = page->state & PROT_ALL & ~PROT_LAZY;
+
+        /* Zero-fill fault is just a mapping of pre-zeroed page if there is one */
+        if (!PAGE_IS_ZERO(phy) || (res = map_zeroed_page(spc, va, phy->class, prot)) == -E_NO_ENT) {
+            page_ref(phy);
+            res = alloc_composite_page(spc, va, phy->class, prot);
+            if (!res) memcpy_page(spc, va, phy);
+            page_unref(phy);
+        }
     }
 
 fault:
+    return res;
+}
+
+int
+force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
+    static_assert(!(MAX_USER_ADDRESS & (HUGE_PAGE_SIZE * 512 * 512 - 1)), "MAX_USER_ADDRESS should be alligned on 512GiB");
+
+    /* If we are working with kernel addresses
+     * kspace should be current */
+    struct AddressSpace *old = NULL;
+    assert(current_space);
+    old = switch_address_space(spc = (va > MAX_USER_ADDRESS ? &kspace : spc));
+
+    int res = do_force_alloc_page(spc, va, maxclass);
+
     switch_address_space(old);
 
     if (res == -E_NO_MEM) {
@@ -1270,6 +2130,332 @@ fault:
     return res;
 }
 
+/* Resolve lazy pages following the page containing
+ * user address va within next npages 4K pages in advance,
+ * copying at most maxclass sized parts of shared pages.
+ * Stops at the first page that is not lazy, is shared
+ * with other mappings or cannot be allocated. Returns number of resolved pages and stores
+ * address of the first unresolved one to *next */
+size_t
+fault_around(struct AddressSpace *spc, uintptr_t va, size_t npages, int maxclass, uintptr_t *next) {
+    assert(va < MAX_USER_ADDRESS);
+    assert(current_space);
+
+    uintptr_t end = ROUNDDOWN(va, PAGE_SIZE) + npages * PAGE_SIZE;
+    if (end > MAX_USER_ADDRESS || end < va) end = MAX_USER_ADDRESS;
+
+    struct AddressSpace *old = switch_address_space(spc);
+
+    size_t n = 0;
+    struct Page *node = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+    while (node && node->phy) {
+        /* Skip the rest of just resolved page */
+        va = ROUNDDOWN(va, CLASS_SIZE(page_phy(node)->class)) + CLASS_SIZE(page_phy(node)->class);
+        if (va >= end) break;
+
+        /* Only zero and private pages are resolved in advance,
+         * pages shared after fork are copied when written */
+        node = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+        if (!node || !node->phy || !(PAGE_IS_ZERO(page_phy(node)) || PAGE_IS_UNIQ(page_phy(node)))) break;
+
+        if (do_force_alloc_page(spc, va, maxclass) < 0) break;
+        node = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+        n++;
+    }
+    *next = va;
+
+    switch_address_space(old);
+    return n;
+}
+
+/* Resolve all lazy pages of user region [va, va + size) of spc now,
+ * copying at most maxclass sized parts of shared pages.
+ * Unlike page faults, running out of memory is just reported */
+int
+prefault_region(struct AddressSpace *spc, uintptr_t va, uintptr_t size, int maxclass) {
+    assert(va + size <= MAX_USER_ADDRESS);
+
+    struct AddressSpace *old = switch_address_space(spc);
+
+    int res = 0;
+    for (uintptr_t end = va + size; va < end;) {
+        struct Page *node = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+        if (node && node->phy && node->state & PROT_LAZY) {
+            if ((res = do_force_alloc_page(spc, va, maxclass)) < 0) break;
+            node = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+        }
+        if (node && node->phy)
+            va = ROUNDDOWN(va, CLASS_SIZE(page_phy(node)->class)) + CLASS_SIZE(page_phy(node)->class);
+        else
+            va += PAGE_SIZE;
+    }
+
+    switch_address_space(old);
+    return res;
+}
+
+/* Replace private pages of user region [va, va + size) of spc with
+ * lazily mapped zero pages keeping their protection, so memory is
+ * released and reading gives zeroes. Shared mappings are left as is */
+int
+discard_region(struct AddressSpace *spc, uintptr_t va, uintptr_t size) {
+    assert(va + size <= MAX_USER_ADDRESS);
+
+    for (uintptr_t end = va + size; va < end;) {
+        struct Page *node = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+        if (!node || !node->phy) {
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        struct Page *phy = page_phy(node);
+        uintptr_t next = MIN(ROUNDDOWN(va, CLASS_SIZE(phy->class)) + CLASS_SIZE(phy->class), end);
+        if (!(node->state & PROT_SHARE) && phy->state == ALLOCATABLE_NODE && !PAGE_IS_ZERO(phy)) {
+            int res = map_region(spc, va, NULL, 0, next - va, (node->state & PROT_ALL) | PROT_LAZY | ALLOC_ZERO);
+            if (res < 0) return res;
+        }
+        va = next;
+    }
+
+    return 0;
+}
+
+/* Check that subtree is completely mapped by unique private
+ * pages with the same protection that can be merged into huge page */
+static bool
+promotable_subtree(struct Page *node, int *state) {
+    if (!node) return 0;
+    if (!node->phy) {
+        assert(node->state == INTERMEDIATE_NODE);
+        return promotable_subtree(page_left(node), state) &&
+               promotable_subtree(page_right(node), state);
+    }
+
+    struct Page *phy = page_phy(node);
+    if (phy->state != ALLOCATABLE_NODE || !PAGE_IS_UNIQ(phy)) return 0;
+    if (node->state & (PROT_LAZY | PROT_SHARE)) return 0;
+    if (*state < 0) *state = node->state;
+    return node->state == *state;
+}
+
+/* Copy contents of pages mapped by subtree of given class to dst */
+static void
+promote_copy(struct Page *node, int class, uint8_t *dst) {
+    if (node->phy) {
+        assert(page_phy(node)->class == class);
+        nosan_memcpy(dst, KADDR(page2pa(page_phy(node))), CLASS_SIZE(class));
+    } else {
+        promote_copy(page_left(node), class - 1, dst);
+        promote_copy(page_right(node), class - 1, dst + CLASS_SIZE(class - 1));
+    }
+}
+
+/* Replace smaller pages fully populating huge page sized range
+ * containing va with single physically contiguous huge page */
+int
+promote_huge_page(struct AddressSpace *spc, uintptr_t va) {
+    va = ROUNDDOWN(va, CLASS_SIZE(MAX_ALLOCATION_CLASS));
+    if (va >= MAX_USER_ADDRESS) return -E_INVAL;
+
+    /* Find node of huge page class without allocating anything */
+    struct Page *node = spc->root;
+    int class = MAX_CLASS;
+    for (; node && !node->phy && class > MAX_ALLOCATION_CLASS; class--)
+        node = va & CLASS_SIZE(class - 1) ? page_right(node) : page_left(node);
+    if (!node || node->phy) return -E_INVAL;
+
+    int state = -1;
+    if (!promotable_subtree(node, &state)) return -E_INVAL;
+
+    struct Page *page = alloc_page(MAX_ALLOCATION_CLASS, 0);
+    if (!page) return -E_NO_MEM;
+
+    if (trace_memory) cprintf("<%p> Promoting [%08lX, %08lX] to huge page\n", spc,
+                              va, va + (long)CLASS_MASK(MAX_ALLOCATION_CLASS));
+
+    page_ref(page);
+    promote_copy(node, MAX_ALLOCATION_CLASS, KADDR(page2pa(page)));
+    /* Small pages are released by unmapping */
+    int res = map_page(spc, va, page, state & PROT_ALL);
+    page_unref(page);
+    if (!res) huge_promotions++;
+    return res;
+}
+
+/* Promote up to PROMOTE_BATCH huge page sized ranges of subtree
+ * except for ones marked with ADVICE_NOHUGEPAGE */
+static void
+promote_subtree(struct Env *env, struct Page *node, int class, uintptr_t va, size_t *budget) {
+    if (!node || node->phy || !*budget || va >= MAX_USER_ADDRESS) return;
+    if (class == MAX_ALLOCATION_CLASS) {
+        if (env_advice(env, va) != ADVICE_NOHUGEPAGE &&
+            !promote_huge_page(&env->address_space, va)) --*budget;
+        return;
+    }
+    promote_subtree(env, page_left(node), class - 1, va, budget);
+    promote_subtree(env, page_right(node), class - 1, va + CLASS_SIZE(class - 1), budget);
+}
+
+void
+dump_huge_promotion_stats(void) {
+    cprintf("%zu ranges promoted to huge pages\n", huge_promotions);
+}
+
+/* Scan address space of one environment for promotable ranges,
+ * called when CPU has nothing else to do. Returns false
+ * after all environments were scanned without promotions */
+bool
+promote_huge_pages(void) {
+    static size_t next_env, last_promotion;
+
+    for (size_t i = 0; i < NENV; i++) {
+        struct Env *env = &envs[next_env++ % NENV];
+        if (env->env_status == ENV_FREE || env->env_status == ENV_DYING) continue;
+        /* Pages are copied before being remapped, so writes
+         * of env running on other CPU meanwhile would be lost */
+        if (cpus[env->env_cpunum].cpu_env == env) continue;
+
+        size_t budget = PROMOTE_BATCH;
+        promote_subtree(env, env->address_space.root, MAX_CLASS, 0, &budget);
+        if (budget < PROMOTE_BATCH) last_promotion = next_env;
+        break;
+    }
+    return next_env - last_promotion < NENV;
+}
+
+/* Page mapped by node can be shared with identical pages
+ * without changing semantics of its mapping */
+static bool
+ksm_candidate(struct Page *node) {
+    struct Page *phy = page_phy(node);
+    if (phy->class || phy->state != ALLOCATABLE_NODE || PAGE_IS_ZERO(phy)) return 0;
+    if (node->state & (PROT_SHARE | PROT_WC)) return 0;
+    if (node->state & PROT_LAZY) return 1;
+    /* Read-only view of a page mapped elsewhere (sys_map_region)
+     * should keep seeing writes made through other mappings */
+    return !(node->state & PROT_W) && PAGE_IS_UNIQ(phy);
+}
+
+/* User pages are accessed through direct mapping, so sanitizer is disabled here */
+__attribute__((no_sanitize_address)) static uint64_t
+ksm_checksum(const uint64_t *data) {
+    uint64_t sum = 0xCBF29CE484222325ULL;
+    for (size_t i = 0; i < PAGE_SIZE / sizeof(*data); i++)
+        sum = (sum ^ data[i]) * 0x100000001B3ULL;
+    return sum;
+}
+
+__attribute__((no_sanitize_address)) static bool
+ksm_same(const uint64_t *a, const uint64_t *b) {
+    for (size_t i = 0; i < PAGE_SIZE / sizeof(*a); i++)
+        if (a[i] != b[i]) return 0;
+    return 1;
+}
+
+/* Lookup mapping recorded in checksum table entry if it is still valid */
+static struct Page *
+ksm_entry_node(struct KsmEntry *ent) {
+    if (!ent->phy) return NULL;
+
+    struct Env *env = &envs[ENVX(ent->envid)];
+    if (env->env_id != ent->envid || env->env_status == ENV_FREE || env->env_status == ENV_DYING) return NULL;
+
+    struct Page *node = page_lookup_virtual(&env->address_space, ent->va, 0, LOOKUP_PRESERVE);
+    if (!node || !node->phy || page_phy(node) != ent->phy || !ksm_candidate(node)) return NULL;
+    return node;
+}
+
+/* Remember page mapped at va or merge it with identical page seen before.
+ * Both mappings become PROT_LAZY so the first write gets private copy */
+static void
+ksm_merge_page(struct Env *env, uintptr_t va) {
+    struct AddressSpace *spc = &env->address_space;
+    struct Page *node = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+    if (!node || !node->phy || !ksm_candidate(node)) return;
+
+    struct Page *phy = page_phy(node);
+    uint64_t sum = ksm_checksum(KADDR(page2pa(phy)));
+    struct KsmEntry *ent = &ksm_table[sum % KSM_BUCKETS];
+    ksm_scanned++;
+
+    struct Page *knode = ksm_entry_node(ent);
+    if (!knode || ent->sum != sum) {
+        *ent = (struct KsmEntry){.sum = sum, .envid = env->env_id, .va = va, .phy = phy};
+        return;
+    }
+
+    struct Page *shared = ent->phy;
+    if (shared == phy || !ksm_same(KADDR(page2pa(phy)), KADDR(page2pa(shared)))) return;
+
+    if (trace_memory) cprintf("<%p> Merging [%08lX] with [%08lX]\n", spc, page2pa(phy), page2pa(shared));
+
+    struct AddressSpace *kspc = &envs[ENVX(ent->envid)].address_space;
+    int kprot = knode->state & PROT_ALL;
+    bool saved = PAGE_IS_UNIQ(phy);
+
+    page_ref(shared);
+    int res = map_page(spc, va, shared, (node->state & PROT_ALL) | PROT_LAZY);
+    if (!res && !(kprot & PROT_LAZY)) res = map_page(kspc, ent->va, shared, kprot | PROT_LAZY);
+    page_unref(shared);
+
+    if (!res) {
+        ksm_merged++;
+        ksm_saved += saved;
+    }
+}
+
+/* Collect up to KSM_BATCH addresses of merge candidates not below start */
+static void
+ksm_collect(struct Page *node, int class, uintptr_t va, uintptr_t start, uintptr_t *vas, size_t *count) {
+    if (!node || *count == KSM_BATCH || va >= MAX_USER_ADDRESS) return;
+    if (va + CLASS_SIZE(class) <= start) return;
+    if (node->phy) {
+        if (!class && ksm_candidate(node)) vas[(*count)++] = va;
+        return;
+    }
+    ksm_collect(page_left(node), class - 1, va, start, vas, count);
+    ksm_collect(page_right(node), class - 1, va + CLASS_SIZE(class - 1), start, vas, count);
+}
+
+void
+dump_ksm_stats(void) {
+    cprintf("Same-page merging: %s, %zu pages scanned, %zu merged, %zu pages saved\n",
+            ksm_enabled ? "on" : "off", ksm_scanned, ksm_merged, ksm_saved);
+}
+
+/* Check next KSM_BATCH candidate pages of one environment,
+ * called when CPU has nothing else to do. Returns false
+ * after all environments were scanned without merges */
+bool
+ksm_scan(void) {
+    static size_t next_env, last_merge;
+    static uintptr_t next_va;
+
+    if (!ksm_enabled) return 0;
+
+    for (size_t i = 0; i < NENV; i++, next_env++, next_va = 0) {
+        struct Env *env = &envs[next_env % NENV];
+        if (env->env_status == ENV_FREE || env->env_status == ENV_DYING) continue;
+
+        /* Mappings can change during merging, so collect addresses first */
+        uintptr_t vas[KSM_BATCH];
+        size_t count = 0;
+        ksm_collect(env->address_space.root, MAX_CLASS, 0, next_va, vas, &count);
+        if (count < KSM_BATCH) {
+            next_env++;
+            next_va = 0;
+        } else
+            next_va = vas[count - 1] + PAGE_SIZE;
+
+        size_t merged = ksm_merged;
+        for (size_t j = 0; j < count; j++)
+            ksm_merge_page(env, vas[j]);
+        if (ksm_merged != merged) last_merge = next_env;
+        break;
+    }
+    return next_env - last_merge < NENV;
+}
+
 static int
 do_map_page(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, struct Page *phy, int oldflags, int flags) {
     int res;
@@ -1311,10 +2497,10 @@ do_map_page(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *ssp
         res = force_alloc_page(sspace, src, MAX_CLASS);
         if (res < 0 || (sspace == dspace && src == dst)) return res;
 
-        struct Page *newv = page_lookup_virtual(sspace->root, src, class, LOOKUP_PRESERVE);
+        struct Page *newv = page_lookup_virtual(sspace, src, class, LOOKUP_PRESERVE);
         check_virtual_class(newv, class);
-        assert(newv && newv->phy);
-        phy = newv->phy;
+        assert(newv && page_phy(newv));
+        phy = page_phy(newv);
     }
 
     page_ref(phy);
@@ -1345,23 +2531,21 @@ do_map_subtree(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *
         if (vpage->phy) {
             assert((vpage->state & NODE_TYPE_MASK) == MAPPING_NODE);
             return do_map_page(dspace, dst, sspace, src,
-                               vpage->phy, vpage->state & PROT_ALL, flags);
+                               page_phy(vpage), vpage->state & PROT_ALL, flags);
         }
         assert(vpage->state == INTERMEDIATE_NODE);
 
         if (vpage->left && (res = do_map_subtree(dspace, dst,
-                                                 sspace, src, vpage->left, class - 1, flags)) < 0) break;
+                                                 sspace, src, page_left(vpage), class - 1, flags)) < 0) break;
 
         dst += CLASS_SIZE(class - 1);
         src += CLASS_SIZE(class - 1);
-        vpage = vpage->right;
+        vpage = page_right(vpage);
         class --;
     }
     return res;
 }
 
-static struct Page *zero_page, *one_page;
-
 static int
 do_map_region_one_page(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, int class, int flags) {
     if (dspace == sspace && src != dst) assert(ABSDIFF(dst, src) >= CLASS_SIZE(class));
@@ -1371,15 +2555,18 @@ do_map_region_one_page(struct AddressSpace *dspace, uintptr_t dst, struct Addres
         if (flags & PROT_SHARE) {
             /* Shared pages cannot be lazily allocated
              * So just allocate them and filled with 0's/FF's */
-            res = alloc_composite_page(dspace, dst, class, flags & PROT_ALL & ~(PROT_LAZY | PROT_COMBINE));
-            if (!res) {
-                assert(current_space);
-                assert(dspace);
-                struct AddressSpace *old = switch_address_space(dspace);
-                set_wp(0);
-                nosan_memset((void *)dst, flags & ALLOC_ONE ? 0xFF : 0x00, CLASS_SIZE(class));
-                set_wp(1);
-                switch_address_space(old);
+            int prot = flags & PROT_ALL & ~(PROT_LAZY | PROT_COMBINE);
+            if (!(flags & ALLOC_ZERO) || (res = map_zeroed_page(dspace, dst, class, prot)) == -E_NO_ENT) {
+                res = alloc_composite_page(dspace, dst, class, prot);
+                if (!res) {
+                    assert(current_space);
+                    assert(dspace);
+                    struct AddressSpace *old = switch_address_space(dspace);
+                    set_wp(0);
+                    nosan_memset((void *)dst, flags & ALLOC_ONE ? 0xFF : 0x00, CLASS_SIZE(class));
+                    set_wp(1);
+                    switch_address_space(old);
+                }
             }
         } else {
             /* MAP_ZERO and MAP_ONE ignore sspace and source and
@@ -1401,11 +2588,11 @@ do_map_region_one_page(struct AddressSpace *dspace, uintptr_t dst, struct Addres
             }
         }
     } else {
-        struct Page *page1 = page_lookup_virtual(sspace->root, src, class, LOOKUP_ALLOC);
+        struct Page *page1 = page_lookup_virtual(sspace, src, class, LOOKUP_ALLOC);
         assert(page1);
-        if (page1->phy && page1->phy->class > class) {
+        if (page1->phy && page_phy(page1)->class > class) {
             /* We need to split physical page if part of it is remapped */
-            struct Page *page = page_lookup(page1->phy, src, class, PARTIAL_NODE, 1);
+            struct Page *page = page_lookup(page_phy(page1), src, class, PARTIAL_NODE, 1);
             return do_map_page(dspace, dst, sspace, src, page, page1->state & PROT_ALL, flags);
         } else {
             check_virtual_class(page1, class);
@@ -1455,22 +2642,18 @@ void
 release_address_space(struct AddressSpace *space) {
     /* NOTE: This function should not be called for kspace */
 
-    /* Manually unref level 3 kernel page tables */
-    for (size_t i = NUSERPML4; i < PML4_ENTRY_COUNT; i++) {
-        if (kspace.pml4[i] & PTE_P && i != UVPT_INDEX)
-            page_unref(page_lookup(NULL, PTE_ADDR(kspace.pml4[i]), 0, PARTIAL_NODE, 0));
-    }
-
     /* Unmap all memory from the space
      * (kernel is cheating and does not store
      *  metadata for upper part of address space (privileged)
      *  in tree and only in page tables for user address spaces,
      *  so unmapping is safe) */
-    unmap_page(space, 0, MAX_CLASS);
+    unmap_page(space, 0, MAX_CLASS, NULL);
 
     /* Also unmap PML4 itself since it is never deallocated by page_uname*/
     page_unref(page_lookup(NULL, space->cr3, 0, PARTIAL_NODE, 0));
 
+    pcid_free(space->pcid);
+
     /* Zero-out metadata */
     memset(space, 0, sizeof *space);
 }
@@ -1496,7 +2679,21 @@ switch_address_space(struct AddressSpace *space) {
         return space;
     
     struct AddressSpace * old_space = current_space;
-    lcr3(space->cr3);
+
+    uint64_t cr3 = space->cr3;
+    if (pcid_enabled) {
+        uint64_t *stale = &pcid_stale[cpunum()][space->pcid / 64];
+        uint64_t mask = 1ULL << (space->pcid % 64);
+
+        /* Keep TLB entries tagged with this PCID
+         * unless they could have become stale */
+        cr3 |= space->pcid;
+        if (*stale & mask)
+            *stale &= ~mask;
+        else
+            cr3 |= CR3_NOFLUSH;
+    }
+    lcr3(cr3);
     current_space = space;
 
     return old_space;
@@ -1508,7 +2705,8 @@ init_address_space(struct AddressSpace *space) {
      * (remember to clean flag bits of result with PTE_ADDR) */
     // LAB 8: Your code here
     pte_t pte = 0;
-    if (alloc_pt(&pte))
+    space->color_next = 0;
+    if (alloc_pt(space, &pte))
         return -1;
 
     pte = PTE_ADDR(pte);
@@ -1522,13 +2720,16 @@ init_address_space(struct AddressSpace *space) {
     // of type INTERMEDIATE_NODE with alloc_rescriptor() of type
     // LAB 8: Your code here
     space->root = alloc_descriptor(INTERMEDIATE_NODE);
+    memset(space->lookup_cache, 0, sizeof space->lookup_cache);
+    space->pcid = pcid_alloc();
+
+    /* Kernel half references PDPs shared by all address spaces */
+    memcpy(space->pml4 + NUSERPML4, kspace.pml4 + NUSERPML4,
+           (PML4_ENTRY_COUNT - NUSERPML4) * sizeof(pml4e_t));
 
     /* Initialize UVPT */
     // LAB 8: Your code here
     space->pml4[PML4_INDEX(UVPT)] = space->cr3 | PTE_P | PTE_U;
-
-    /* Why this call is required here and what does it do? */
-    propagate_one_pml4(space, &kspace);
     return 0;
 }
 
@@ -1554,6 +2755,9 @@ detect_memory(void) {
     // LAB 6: Your code here
     attach_region(0, PAGE_SIZE, RESERVED_NODE);
 
+    /* Attach AP entry code and its boot page table as reserved */
+    attach_region(MPENTRY_PADDR, MPENTRY_PADDR + MPENTRY_SIZE, RESERVED_NODE);
+
     /* Attach kernel and old IO memory
      * (from IOPHYSMEM to the physical address of end label. end points the the
      *  end of kernel executable image.)*/
@@ -1624,15 +2828,49 @@ detect_memory(void) {
     assert(!((uintptr_t)zero_page_raw & (HUGE_PAGE_SIZE - 1)));
 }
 
+static void
+fill_page_index(struct Page *node) {
+    while (node && node->class >= PAGE_INDEX_CLASS) {
+        page_index_update(node, 0);
+        fill_page_index(page_left(node));
+        node = page_right(node);
+    }
+}
+
+/* Allocate radix index of physical memory tree
+ * and fill it with already existing descriptors */
+static void
+init_page_index(void) {
+    size_t size = ROUNDUP(max_memory_map_addr, CLASS_SIZE(PAGE_INDEX_CLASS)) >> (CLASS_BASE + PAGE_INDEX_CLASS);
+
+    int class = 0;
+    while (CLASS_SIZE(class) < size * sizeof *page_index) class++;
+
+    struct Page *page = alloc_page(class, ALLOC_BOOTMEM);
+    if (!page) panic("Out of memory\n");
+    page_ref(page);
+
+    page_index = KADDR(page2pa(page));
+    memset(page_index, 0, CLASS_SIZE(class));
+    page_index_size = size;
+
+    fill_page_index(&root);
+
+    if (trace_memory_more) cprintf("Page index of %zu entries at %p\n", size, page_index);
+}
+
 static void
 init_allocator(void) {
     static struct Page initial_buffer[INIT_DESCR];
 
-    metaheaptop = KERN_HEAP_START + ROUNDUP(uefi_lp->FrameBufferSize, PAGE_SIZE);
+    /* Framebuffer occupies the beginning of the heap */
+    heap_mark(0, ROUNDUP(uefi_lp->FrameBufferSize, PAGE_SIZE) / PAGE_SIZE, 1);
 
     /* Initiallize lists */
     for (size_t i = 0; i < MAX_CLASS; i++)
         list_init(&free_classes[i]);
+    for (size_t i = 0; i < PAGE_COLORS; i++)
+        list_init(&free_colors[i]);
 
     /* Initiallize first pool */
 
@@ -1642,23 +2880,76 @@ init_allocator(void) {
     list_init(&free_descriptors);
     free_desc_count = INIT_DESCR;
     for (size_t i = 0; i < INIT_DESCR; i++)
-        list_append(&free_descriptors, (struct List *)&initial_buffer[i]);
+        list_append(&free_descriptors, &initial_buffer[i]);
 
-    list_init(&root.head);
+    list_init(&root);
     root.class = MAX_CLASS;
     root.state = PARTIAL_NODE;
 }
 
+/* Allocate physically contiguous memory of given class
+ * accessed via direct physical memory mapping */
+void *
+kalloc_pages(int class) {
+    struct Page *page = alloc_page(class, ALLOC_BOOTMEM);
+    if (!page) return NULL;
+    page_ref(page);
+
+#ifdef SANITIZE_SHADOW_BASE
+    if (current_space) platform_asan_unpoison(KADDR(page2pa(page)), CLASS_SIZE(class));
+#endif
+    return KADDR(page2pa(page));
+}
+
+void
+kfree_pages(void *va, int class) {
+    struct Page *page = page_lookup(NULL, PADDR(va), class, PARTIAL_NODE, 0);
+    assert(page && page->class == class && PAGE_IS_UNIQ(page));
+    page_unref(page);
+}
+
+/* Allocate kernel heap virtual address range (first fit),
+ * returns 0 if there is no large enough range */
+static uintptr_t
+heap_alloc_range(size_t size) {
+    size_t n = size / PAGE_SIZE, run = 0;
+    assert(n && !(size & CLASS_MASK(0)));
+
+    for (size_t i = 0; i < HEAP_PAGES; i++) {
+        /* Skip fully used words at once */
+        if (!(i % 64) && heap_used[i / 64] == ~0ULL) {
+            run = 0;
+            i += 63;
+            continue;
+        }
+        if (heap_used[i / 64] & (1ULL << (i % 64))) {
+            run = 0;
+            continue;
+        }
+        if (++run == n) {
+            heap_mark(i + 1 - n, n, 1);
+            return KERN_HEAP_START + (i + 1 - n) * PAGE_SIZE;
+        }
+    }
+    return 0;
+}
+
+/* Return range to the kernel heap */
+static void
+heap_free_range(uintptr_t start, size_t size) {
+    assert(KERN_HEAP_START <= start && start + size <= KERN_HEAP_END);
+    assert(!(start & CLASS_MASK(0)) && !(size & CLASS_MASK(0)));
+    heap_mark((start - KERN_HEAP_START) / PAGE_SIZE, size / PAGE_SIZE, 0);
+}
+
 void *
 kzalloc_region(size_t size) {
     assert(current_space);
 
     size = ROUNDUP(size, PAGE_SIZE);
 
-    if (metaheaptop + size > KERN_HEAP_END) panic("Kernel heap overflow\n");
-
-    uintptr_t res = metaheaptop;
-    metaheaptop += size;
+    uintptr_t res = heap_alloc_range(size);
+    if (!res) panic("Kernel heap overflow\n");
 
     int r = map_region(&kspace, res, NULL, 0, size, PROT_R | PROT_W | ALLOC_ZERO);
     if (r < 0) panic("kzalloc_region: %i\n", r);
@@ -1674,15 +2965,61 @@ kzalloc_region(size_t size) {
     return (void *)res;
 }
 
+/* Unmap region allocated with kzalloc_region() returning
+ * its memory to the page allocator and addresses to the heap */
+void
+kfree_region(void *va, size_t size) {
+    assert(!((uintptr_t)va & CLASS_MASK(0)));
+    size = ROUNDUP(size, PAGE_SIZE);
+
+    unmap_region(&kspace, (uintptr_t)va, size);
+#ifdef SANITIZE_SHADOW_BASE
+    platform_asan_poison(va, size);
+#endif
+    heap_free_range((uintptr_t)va, size);
+}
+
+/* Check that freed kernel heap ranges are reused and merged,
+ * so repeated allocations do not exhaust the heap */
+static void
+check_kernel_heap(void) {
+    uint8_t *a = kzalloc_region(3 * PAGE_SIZE);
+    kfree_region(a, 3 * PAGE_SIZE);
+    assert(kzalloc_region(3 * PAGE_SIZE) == a);
+    kfree_region(a, 3 * PAGE_SIZE);
+
+    uint8_t *b = kzalloc_region(2 * PAGE_SIZE);
+    uint8_t *c = kzalloc_region(2 * PAGE_SIZE);
+    kfree_region(b, 2 * PAGE_SIZE);
+    kfree_region(c, 2 * PAGE_SIZE);
+    uint8_t *d = kzalloc_region(4 * PAGE_SIZE);
+    /* Adjacent freed ranges form one range */
+    if (c == b + 2 * PAGE_SIZE) assert(d == b);
+    kfree_region(d, 4 * PAGE_SIZE);
+
+    /* Many more cycles than the heap could hold if ranges leaked */
+    for (size_t i = 0; i < 2 * (KERN_HEAP_END - KERN_HEAP_START) / HUGE_PAGE_SIZE; i++) {
+        size_t size = (i % 7 + 1) * HUGE_PAGE_SIZE;
+        uint8_t *e = kzalloc_region(size);
+        kfree_region(e, size);
+    }
+    assert(kzalloc_region(3 * PAGE_SIZE) == a);
+    kfree_region(a, 3 * PAGE_SIZE);
+
+    if (trace_init) cprintf("Kernel heap is correct\n");
+}
+
 static uintptr_t prev_mmio;
+static size_t prev_mmio_size;
 void *
 mmio_map_region(physaddr_t addr, size_t size) {
     assert(current_space == &kspace);
     uintptr_t start = ROUNDDOWN(addr, PAGE_SIZE);
     uintptr_t end = ROUNDUP(addr + size, PAGE_SIZE);
 
-    prev_mmio = metaheaptop;
-    metaheaptop += end - start;
+    prev_mmio = heap_alloc_range(end - start);
+    prev_mmio_size = end - start;
+    if (!prev_mmio) panic("Kernel heap overflow\n");
 
     if (map_physical_region(&kspace, prev_mmio, start, end - start, PROT_R | PROT_W | PROT_CD) < 0)
         panic("Cannot map physical region at %p of size %zd", (void *)addr, size);
@@ -1693,16 +3030,25 @@ mmio_map_region(physaddr_t addr, size_t size) {
 void *
 mmio_remap_last_region(physaddr_t addr, void *oldva, size_t oldsz, size_t size) {
     uintptr_t start = ROUNDDOWN(addr, PAGE_SIZE);
-    uintptr_t end = ROUNDUP(addr + size, PAGE_SIZE);
 
-    if (prev_mmio + addr - start != (uintptr_t)oldva &&
-        (prev_mmio + end - start != metaheaptop))
+    if (prev_mmio + addr - start != (uintptr_t)oldva ||
+        ROUNDUP(addr + oldsz, PAGE_SIZE) - start != prev_mmio_size)
         panic("Trying to remap non-last MMIO region!\n");
 
-    metaheaptop = prev_mmio;
+    unmap_region(&kspace, prev_mmio, prev_mmio_size);
+    heap_free_range(prev_mmio, prev_mmio_size);
     return mmio_map_region(addr, size);
 }
 
+static void
+prealloc_kernel_pdps(uintptr_t start, uintptr_t end) {
+    for (size_t i = PML4_INDEX(start); i <= PML4_INDEX(end - 1); i++) {
+        assert(i >= NUSERPML4 && i != PML4_INDEX(UVPT));
+        if (kspace.pml4[i] & PTE_P) continue;
+        if (alloc_pt(&kspace, kspace.pml4 + i) < 0) panic("Cannot allocate kernel PDP\n");
+    }
+}
+
 static void
 init_kspace(void) {
     struct Page *page = alloc_page(0, ALLOC_BOOTMEM);
@@ -1712,6 +3058,15 @@ init_kspace(void) {
     memset(kspace.pml4, 0, CLASS_SIZE(0));
     kspace.pml4[PML4_INDEX(UVPT)] = kspace.cr3 | PTE_P | PTE_U;
     kspace.root = alloc_descriptor(INTERMEDIATE_NODE);
+
+    /* Preallocate kernel PDPs once, so kernel mappings never
+     * change PML4 and are seen by all address spaces.
+     * Kernel heap, stacks and MMIO windows are right below
+     * KERN_BASE_ADDR and physical memory is mapped right above it */
+    prealloc_kernel_pdps(KERN_HEAP_START, KERN_BASE_ADDR + max_memory_map_addr);
+#ifdef SANITIZE_SHADOW_BASE
+    prealloc_kernel_pdps(SANITIZE_SHADOW_OFF, SANITIZE_SHADOW_BASE + SANITIZE_SHADOW_SIZE);
+#endif
 }
 
 #ifdef SANITIZE_SHADOW_BASE
@@ -1724,8 +3079,8 @@ unpoison_meta(struct Page *node) {
             return;
         }
 
-        if (node->left) unpoison_meta(node->left);
-        node = node->right;
+        if (node->left) unpoison_meta(page_left(node));
+        node = page_right(node);
     }
 }
 
@@ -1776,9 +3131,16 @@ init_memory(void) {
     if (trace_init) cprintf("Memory allocator is initiallized\n");
 
     detect_memory();
+    init_page_index();
     check_physical_tree(&root);
     if (trace_init) cprintf("Physical memory tree is correct\n");
 
+    /* Should be known before the first mapping is made */
+    uint32_t maxext, edx = 0;
+    cpuid(0x80000000, &maxext, NULL, NULL, NULL);
+    if (maxext >= 0x80000001) cpuid(0x80000001, NULL, NULL, NULL, &edx);
+    has_1gb_pages = !!(edx & CPUID_80000001_EDX_PAGE1GB);
+
     init_kspace();
 
     /* First, only map kernel itself, kernel stacks, UEFI memory
@@ -1841,6 +3203,13 @@ init_memory(void) {
     lcr0(CR0_PE | CR0_PG | CR0_AM | CR0_WP | CR0_NE | CR0_MP);
     lcr4(CR4_PSE | CR4_PAE | CR4_PCE);
 
+    uint32_t maxleaf, ecx, ebx = 0;
+    cpuid(0, &maxleaf, NULL, NULL, NULL);
+    cpuid(1, NULL, NULL, &ecx, NULL);
+    if (maxleaf >= 7) cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+    pcid_supported = !!(ecx & CPUID_1_ECX_PCID);
+    invpcid_supported = pcid_supported && (ebx & CPUID_7_EBX_INVPCID);
+
     /* Enable NX bit (execution protection) */
     uint64_t efer = rdmsr(EFER_MSR);
     efer |= EFER_NXE;
@@ -1850,6 +3219,15 @@ init_memory(void) {
 
     switch_address_space(&kspace);
 
+    /* PCIDs can only be enabled with PCID 0 loaded into CR3 */
+    if (pcid_supported) {
+        assert(!(rcr3() & CR3_PCID_MASK));
+        lcr4(rcr4() | CR4_PCIDE);
+        pcid_enabled = 1;
+    }
+    if (trace_init) cprintf("PCID %s, INVPCID %s\n", pcid_enabled ? "enabled" : "disabled",
+                            invpcid_supported ? "supported" : "not supported");
+
     /* One page is a page filled with 0xFF values -- ASAN poison */
     nosan_memset(one_page_raw, 0xFF, CLASS_SIZE(MAX_ALLOCATION_CLASS));
 
@@ -1908,6 +3286,23 @@ init_memory(void) {
 
     check_virtual_tree(kspace.root, MAX_CLASS);
     if (trace_init) cprintf("Kernel virutal memory tree is correct\n");
+
+    check_kernel_heap();
+}
+
+/* Set up paging modes of AP same as init_memory() did for BSP
+ * and load kernel address space */
+void
+init_memory_percpu(void) {
+    lcr0(CR0_PE | CR0_PG | CR0_AM | CR0_WP | CR0_NE | CR0_MP);
+    lcr4(CR4_PSE | CR4_PAE | CR4_PCE);
+
+    /* Plain CR3 load: flushes whatever was cached
+     * with the boot page table */
+    lcr3(kspace.cr3);
+    current_space = &kspace;
+
+    if (pcid_enabled) lcr4(rcr4() | CR4_PCIDE);
 }
 
 static uintptr_t user_mem_check_addr;
@@ -1936,7 +3331,7 @@ user_mem_check(struct Env *env, const void *va, size_t len, int perm) {
 
     void * va_page = (void *)ROUNDDOWN(va, PAGE_SIZE);
     while (va_page < va + len) {
-        struct Page * page = page_lookup_virtual(env->address_space.root, (uintptr_t)va_page, 0, 0);
+        struct Page * page = page_lookup_virtual(&env->address_space, (uintptr_t)va_page, 0, 0);
         if (!page || !page->phy || ((page->state & perm) != perm)) {
             user_mem_check_addr = (uintptr_t)va;
             return -E_FAULT;
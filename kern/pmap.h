@@ -10,11 +10,16 @@
 #include <inc/assert.h>
 #include <inc/env.h>
 #include <inc/x86.h>
+#include <kern/cpu.h>
 
 #define CLASS_BASE    12
 #define CLASS_SIZE(c) (1ULL << ((c) + CLASS_BASE))
 #define CLASS_MASK(c) (CLASS_SIZE(c) - 1)
 
+/* Number of cache colors of 4K pages (last level cache size / associativity / 4K) */
+#define PAGE_COLORS   32
+#define PAGE_COLOR(pa) (((pa) >> CLASS_BASE) & (PAGE_COLORS - 1))
+
 #ifdef SANITIZE_SHADOW_BASE
 #define SHADOW_ADDR(v) (((uintptr_t)(v) >> 3) + SANITIZE_SHADOW_OFF)
 /* asan unpoison routine used for whitelisting regions. */
@@ -48,6 +53,11 @@ void __nosan_memmove(void *, void *, size_t);
 #define ALLOC_ZERO 0x100000 /* Allocate memory filled with 0x00 */
 #define ALLOC_ONE  0x200000 /* Allocate memory filled with 0xFF */
 
+/* sys_alloc_region() backing flags */
+#define ALLOC_HUGE_2M  0x1000 /* Back with 2MB pages */
+#define ALLOC_HUGE_1G  0x2000 /* Back with 1GB pages */
+#define ALLOC_POPULATE 0x4000 /* Allocate memory immediately instead of lazily */
+
 /* Memory protection flags & attributes */
 #define PROT_X       0x1 /* Executable */
 #define PROT_W       0x2 /* Writable */
@@ -66,6 +76,10 @@ void __nosan_memmove(void *, void *, size_t);
 /* Maximal size of page allocated on pagefault */
 #define MAX_ALLOCATION_CLASS 9
 
+/* Classes of hardware large pages */
+#define CLASS_2M 9
+#define CLASS_1G 18
+
 enum PageState {
     MAPPING_NODE = 0x100000,      /* Memory mapping (part of virtual tree) */
     INTERMEDIATE_NODE = 0x200000, /* Intermediate node of virtual memory tree */
@@ -78,23 +92,41 @@ enum PageState {
 extern __attribute__((aligned(HUGE_PAGE_SIZE))) uint8_t zero_page_raw[HUGE_PAGE_SIZE];
 extern __attribute__((aligned(HUGE_PAGE_SIZE))) uint8_t one_page_raw[HUGE_PAGE_SIZE];
 
+/*
+ * Descriptors reference each other with 32-bit
+ * indices instead of pointers. Index is an offset of
+ * descriptor from KERN_BASE_ADDR in units of descriptor
+ * size. Every descriptor is located either in kernel
+ * image or in pool page accessed via KERN_BASE_ADDR
+ * mapping, so up to 128GB of physical memory can be
+ * addressed this way. Index 0 (physical page 0)
+ * is never used for descriptors and denotes NULL.
+ */
+typedef uint32_t pageref_t;
+
+struct PageList {
+    pageref_t prev, next;
+};
+
 struct Page {
-    struct List head; /* This should be first member */
-    struct Page *left, *right, *parent;
-    enum PageState state;
+    struct PageList head; /* This should be first member */
+    pageref_t left, right, parent;
+    uint32_t state : 24; /* enum PageState (and PROT_* flags for mappings) */
+    uint32_t class : 8;  /* = log2(size)-CLASS_BASE (physical page only) */
     union {
         struct /* physical page */ {
             /* Number of references
              * Child nodes always have class
              * smaller by 1 than their parents */
             uint32_t refc;
-            uintptr_t class : CLASS_BASE;                        /* = log2(size)-CLASS_BASE */
-            uintptr_t addr : sizeof(uintptr_t) * 8 - CLASS_BASE; /* = address >> CLASS_BASE */
+            uint32_t addr; /* = address >> (CLASS_BASE + class) */
         };
         /* mapping */
-        struct Page *phy; /* If phy == NULL this is intemediate page */
+        pageref_t phy; /* If phy == 0 this is intemediate page */
     };
-};
+} __attribute__((aligned(32)));
+
+static_assert(sizeof(struct Page) == 32, "Page descriptor should be 32 bytes long");
 
 struct PagePool {
     struct Page *peer;     /* Page from which memory is taken */
@@ -103,28 +135,50 @@ struct PagePool {
 };
 
 int map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, uintptr_t size, int flags);
+int map_populated_region(struct AddressSpace *spc, uintptr_t dst, uintptr_t size, int class, int flags);
 void unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size);
 void init_memory(void);
+void init_memory_percpu(void);
 void release_address_space(struct AddressSpace *space);
 struct AddressSpace *switch_address_space(struct AddressSpace *space);
 int init_address_space(struct AddressSpace *space);
 void user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
 int region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size);
 int force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass);
+size_t fault_around(struct AddressSpace *spc, uintptr_t va, size_t npages, int maxclass, uintptr_t *next);
+int prefault_region(struct AddressSpace *spc, uintptr_t va, uintptr_t size, int maxclass);
+int discard_region(struct AddressSpace *spc, uintptr_t va, uintptr_t size);
+int promote_huge_page(struct AddressSpace *spc, uintptr_t va);
+bool promote_huge_pages(void);
+bool ksm_scan(void);
+void dump_ksm_stats(void);
 void dump_page_table(pte_t *pml4);
 void dump_memory_lists(void);
+void dump_page_magazines(void);
+bool zero_pools_refill(void);
+void dump_coalesce_stats(void);
+void dump_lookup_cache_stats(void);
+void dump_huge_promotion_stats(void);
+void dump_page_colors(void);
 void dump_virtual_tree(struct Page *node, int class);
 
 void *kzalloc_region(size_t size);
+void kfree_region(void *va, size_t size);
+void *kalloc_pages(int class);
+void kfree_pages(void *va, int class);
 
 void *mmio_map_region(physaddr_t addr, size_t size);
 void *mmio_remap_last_region(physaddr_t addr, void *oldva, size_t oldsz, size_t size);
 
 extern struct AddressSpace kspace;
-extern struct AddressSpace *current_space;
+/* Currently active address space */
+#define current_space (thiscpu->cpu_space)
 extern struct Page root;
 extern char bootstacktop[], bootstack[];
 extern size_t max_memory_map_addr;
+extern int cow_copy_class;
+extern bool page_coloring;
+extern bool ksm_enabled;
 
 /* This macro takes a kernel virtual address -- an address that points above
  * KERN_BASE_ADDR, where the machine's maximum 512MB of physical memory is mapped --
@@ -163,7 +217,43 @@ _kaddr(const char *file, int line, physaddr_t pa) {
 
 inline static physaddr_t __attribute__((always_inline))
 page2pa(struct Page *page) {
-    return page->addr << CLASS_BASE;
+    return (physaddr_t)page->addr << (CLASS_BASE + page->class);
+}
+
+inline static struct Page *__attribute__((always_inline))
+ref2page(pageref_t ref) {
+    return ref ? (struct Page *)KERN_BASE_ADDR + ref : NULL;
+}
+
+inline static pageref_t __attribute__((always_inline))
+page2ref(struct Page *page) {
+    if (!page) return 0;
+    uintptr_t ref = (struct Page *)page - (struct Page *)KERN_BASE_ADDR;
+    assert((uintptr_t)page > KERN_BASE_ADDR && (pageref_t)ref == ref);
+    assert(!((uintptr_t)page & (sizeof(struct Page) - 1)));
+    return ref;
+}
+
+/* Tree links accessors */
+
+inline static struct Page *__attribute__((always_inline))
+page_left(struct Page *page) {
+    return ref2page(page->left);
+}
+
+inline static struct Page *__attribute__((always_inline))
+page_right(struct Page *page) {
+    return ref2page(page->right);
+}
+
+inline static struct Page *__attribute__((always_inline))
+page_parent(struct Page *page) {
+    return ref2page(page->parent);
+}
+
+inline static struct Page *__attribute__((always_inline))
+page_phy(struct Page *page) {
+    return ref2page(page->phy);
 }
 
 inline static void
@@ -172,7 +262,7 @@ set_wp(bool wp) {
     lcr0(wp ? old | CR0_WP : old & ~CR0_WP);
 }
 
-void
-as_memcpy(struct AddressSpace *dst, uintptr_t dst_va, uintptr_t src_va, size_t size);
+int copy_to_space(struct AddressSpace *spc, uintptr_t dst, const void *src, size_t size);
+int copy_from_space(struct AddressSpace *spc, void *dst, uintptr_t src, size_t size);
 
 #endif /* !JOS_KERN_PMAP_H */
@@ -1,15 +1,260 @@
 #include <inc/assert.h>
+#include <inc/error.h>
 #include <inc/x86.h>
 #include <inc/string.h>
+#include <inc/vsyscall.h>
 #include <kern/env.h>
 #include <kern/monitor.h>
 #include <kern/traceopt.h>
 #include <kern/pmap.h>
+#include <kern/spinlock.h>
+#include <kern/timer.h>
+#include <kern/kclock.h>
+#include <kern/tsc.h>
+#include <kern/vsyscall.h>
 
-
-struct Taskstate cpu_ts;
 _Noreturn void sched_halt(void);
 
+/* Run queues of environments that can be run, one per priority
+ * for every CPU. Env is queued on CPU env_cpunum and can only
+ * run there. Every queue is sorted by virtual runtime, so its head
+ * is the env that got least weighted CPU time.
+ * Bit i of runq_mask[cpu] is set if runq[cpu][i] is not empty */
+static struct List runq[NCPU][NENV_PRIO];
+static unsigned runq_mask[NCPU];
+/* Number of queued envs of every CPU (including running one) */
+static size_t runq_len[NCPU];
+
+/* Virtual runtime of the most recently picked env of every queue,
+ * newly queued envs start from it so that sleeping does not
+ * accumulate credit */
+static uint64_t runq_min_vruntime[NCPU][NENV_PRIO];
+
+/* CPU share weights for nice values NICE_MIN..NICE_MAX,
+ * each nice step changes share by about 10% */
+#define NICE_0_WEIGHT 1024
+static const uint32_t nice_weights[NICE_MAX - NICE_MIN + 1] = {
+        88761, 71755, 56483, 46273, 36291,
+        29154, 23254, 18705, 14949, 11916,
+        9548, 7620, 6100, 4904, 3906,
+        3121, 2501, 1991, 1586, 1277,
+        1024, 820, 655, 526, 423,
+        335, 272, 215, 172, 137,
+        110, 87, 70, 56, 45,
+        36, 29, 23, 18, 15,
+};
+
+/* Scheduling quantum of envs sharing a CPU in tickless mode */
+#define SCHED_HZ 100
+
+/* Rate of idle scanning in tickless mode */
+#define IDLE_SCAN_HZ 10
+
+/* TSC value of the pending one-shot timer interrupt
+ * of every CPU in tickless mode, 0 if none */
+static uint64_t tick_deadline[NCPU];
+
+/* Number of ENV_RUNNABLE and ENV_RUNNING environments
+ * including stopped and waiting for signals ones */
+static size_t nlive;
+
+#define RUNQ_ENV(l) ((struct Env *)((uint8_t *)(l) - offsetof(struct Env, env_runq)))
+
+void
+sched_init(void) {
+    for (size_t cpu = 0; cpu < NCPU; cpu++) {
+        for (size_t i = 0; i < NENV_PRIO; i++) {
+            runq[cpu][i].prev = runq[cpu][i].next = &runq[cpu][i];
+            runq_min_vruntime[cpu][i] = 0;
+        }
+        runq_mask[cpu] = 0;
+        runq_len[cpu] = 0;
+    }
+    nlive = 0;
+}
+
+/* Insert env after all envs with not greater virtual runtime */
+static void
+runq_insert(struct Env *env) {
+    int cpu = env->env_cpunum;
+    struct List *head = &runq[cpu][env->env_priority];
+    env->env_vruntime = MAX(env->env_vruntime, runq_min_vruntime[cpu][env->env_priority]);
+
+    /* Env charged last has the largest virtual runtime
+     * most of the time, so search from the tail */
+    struct List *prev = head->prev;
+    while (prev != head && RUNQ_ENV(prev)->env_vruntime > env->env_vruntime)
+        prev = prev->prev;
+
+    env->env_runq.prev = prev;
+    env->env_runq.next = prev->next;
+    prev->next->prev = &env->env_runq;
+    prev->next = &env->env_runq;
+    runq_mask[cpu] |= 1U << env->env_priority;
+    runq_len[cpu]++;
+    env->env_queued = 1;
+}
+
+static void
+runq_remove(struct Env *env) {
+    int cpu = env->env_cpunum;
+    struct List *head = &runq[cpu][env->env_priority];
+    env->env_runq.prev->next = env->env_runq.next;
+    env->env_runq.next->prev = env->env_runq.prev;
+    env->env_runq.prev = env->env_runq.next = NULL;
+    if (head->next == head) runq_mask[cpu] &= ~(1U << env->env_priority);
+    runq_len[cpu]--;
+    env->env_queued = 0;
+}
+
+/* Timer interrupts are programmed only when needed */
+static bool
+sched_tickless(void) {
+    return timer_for_schedule && timer_for_schedule->set_oneshot;
+}
+
+/* Wake up CPU that can run env just queued on cpu:
+ * cpu itself if it is halted or some halted CPU
+ * that would steal env if cpu is busy */
+static void
+sched_kick(int cpu) {
+    int self = cpunum();
+    if (cpu != self && cpus[cpu].cpu_status == CPU_HALTED) {
+        lapic_ipi(cpu, T_RESCHED);
+        return;
+    }
+
+    /* Busy tickless CPU might not be interrupted for
+     * a long time, let it program the next quantum */
+    if (cpu != self && sched_tickless() && cpus[cpu].cpu_env &&
+        (!tick_deadline[cpu] || tick_deadline[cpu] > read_tsc() + tsc_calibrate() / SCHED_HZ))
+        lapic_ipi(cpu, T_RESCHED);
+    if (runq_len[cpu] < 2) return;
+
+    for (size_t i = 0; i < ncpu; i++) {
+        if ((int)i != self && cpus[i].cpu_status == CPU_HALTED) {
+            lapic_ipi(i, T_RESCHED);
+            return;
+        }
+    }
+}
+
+/* Move env of priority less than maxprio from the busiest CPU
+ * to the run queue of self, keeping its lag behind
+ * the queue minimum. Returns false if there is nothing to steal */
+static bool
+sched_steal(int self, int maxprio) {
+    int victim = -1;
+    for (size_t i = 0; i < ncpu; i++)
+        if ((int)i != self && runq_len[i] > 1 && (victim < 0 || runq_len[i] > runq_len[victim])) victim = i;
+    if (victim < 0) return 0;
+
+    for (int prio = 0; prio < maxprio; prio++) {
+        struct List *head = &runq[victim][prio];
+        /* Tail env is the last one victim would run */
+        for (struct List *l = head->prev; l != head; l = l->prev) {
+            struct Env *env = RUNQ_ENV(l);
+            if (cpus[victim].cpu_env == env) continue;
+
+            uint64_t vmin = runq_min_vruntime[victim][prio];
+            uint64_t lag = env->env_vruntime > vmin ? env->env_vruntime - vmin : 0;
+            runq_remove(env);
+            env->env_cpunum = self;
+            env->env_vruntime = runq_min_vruntime[self][prio] + lag;
+            runq_insert(env);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Only BSP receives PIC timer interrupts, it forwards them
+ * to other busy CPUs so that their envs are preempted too */
+void
+sched_preempt_others(void) {
+    for (size_t i = 0; i < ncpu; i++)
+        if ((int)i != cpunum() && cpus[i].cpu_status == CPU_STARTED && cpus[i].cpu_env) lapic_ipi(i, T_RESCHED);
+}
+
+/* Env has to share this CPU with other envs
+ * of the same or higher priority */
+static bool
+sched_contended(int cpu, struct Env *env) {
+    if (runq_mask[cpu] & ((1U << env->env_priority) - 1)) return 1;
+
+    struct List *head = &runq[cpu][env->env_priority], *first = head->next;
+    return first != head && (first != &env->env_runq || first->next != head);
+}
+
+/* Called right before env starts running on this CPU.
+ * In tickless mode the next timer interrupt comes one quantum later
+ * if env shares the CPU, otherwise only when vsys time changes */
+void
+sched_tick(struct Env *env) {
+    vsys[VSYS_gettime] = gettime_tsc();
+    if (!sched_tickless()) return;
+
+    int cpu = cpunum();
+    uint64_t now = read_tsc(), quantum = tsc_calibrate() / SCHED_HZ;
+    uint64_t deadline = gettime_tsc_next();
+    if (sched_contended(cpu, env)) {
+        /* Keep the quantum already running */
+        uint64_t pending = tick_deadline[cpu];
+        deadline = MIN(deadline, pending > now && pending <= now + quantum ? pending : now + quantum);
+    }
+
+    if (deadline != tick_deadline[cpu]) {
+        tick_deadline[cpu] = deadline;
+        timer_for_schedule->set_oneshot(deadline);
+    }
+}
+
+/* Charge env for CPU time used since it was last charged,
+ * scaled inversely to its weight */
+static void
+sched_charge(struct Env *env) {
+    uint64_t now = read_tsc();
+    env->env_vruntime += (now - env->env_exec_start) * NICE_0_WEIGHT / env->env_weight;
+    env->env_exec_start = now;
+}
+
+int
+sched_set_nice(struct Env *env, int nice) {
+    if (nice < NICE_MIN || nice > NICE_MAX) return -E_INVAL;
+    env->env_nice = nice;
+    env->env_weight = nice_weights[nice - NICE_MIN];
+    return 0;
+}
+
+/* Env waiting in sys_sigwait has one of awaited signals queued */
+static bool
+wait_signal_pending(struct Env *env) {
+    for (size_t i = env->env_sig_queue_beg; i != env->env_sig_queue_end; i = (i + 1) % SIGNALS_QUEUE_SIZE)
+        if (env->env_sig_waiting & SIGNAL_FLAG(env->env_sig_queue[i].signo)) return 1;
+    return 0;
+}
+
+/* Put env into its run queue or remove it from there according to its
+ * status, SIGSTOP state and awaited signals. Must be called after
+ * any of them changes, so that sched_yield() never visits envs
+ * that cannot run */
+void
+sched_update(struct Env *env) {
+    bool live = env->env_status == ENV_RUNNABLE || env->env_status == ENV_RUNNING;
+    if (live != env->env_live) {
+        nlive += live ? 1 : -1;
+        env->env_live = live;
+    }
+
+    bool runnable = live && !env->env_is_stopped &&
+                    (!env->env_sig_waiting || wait_signal_pending(env));
+    if (runnable && !env->env_queued) {
+        runq_insert(env);
+        sched_kick(env->env_cpunum);
+    } else if (!runnable && env->env_queued)
+        runq_remove(env);
+}
+
 bool check_wait_for_signal(struct Env * env) {
     // Check if process is waiting for some signal (sys_sigwait)
     if (!env->env_sig_waiting)
@@ -34,8 +279,12 @@ bool check_wait_for_signal(struct Env * env) {
         cprintf("signals: env %x: wake up with %d\n", env->env_id, es->signo);
 
     //*env->env_sig_waiting_num_out = es->signo;
-    if (env->env_sig_waiting_num_out)
-        as_memcpy(&env->address_space, (uintptr_t)env->env_sig_waiting_num_out, (uintptr_t)&es->signo, sizeof(es->signo));
+    if (env->env_sig_waiting_num_out &&
+        copy_to_space(&env->address_space, (uintptr_t)env->env_sig_waiting_num_out, &es->signo, sizeof(es->signo)) < 0) {
+        /* Running out of memory has destroyed env already */
+        if (env->env_status != ENV_FREE) env_destroy(env);
+        return true;
+    }
     env->env_sig_waiting_num_out = NULL;
     env->env_sig_waiting = 0;
 
@@ -58,72 +307,91 @@ bool check_wait_for_signal(struct Env * env) {
 /* Choose a user environment to run and run it */
 _Noreturn void
 sched_yield(void) {
-    /* Implement simple round-robin scheduling.
-     *
-     * Search through 'envs' for an ENV_RUNNABLE environment in
-     * circular fashion starting just after the env was
-     * last running.  Switch to the first such environment found.
-     *
-     * If no envs are runnable, but the environment previously
-     * running is still ENV_RUNNING, it's okay to
-     * choose that environment.
-     *
-     * If there are no runnable environments,
-     * simply drop through to the code
-     * below to halt the cpu */
-
-    // LAB 3: Your code here:
-    size_t next_env_idx = 0;
-    if (curenv)
-        next_env_idx = (curenv - envs) + 1;
-    
-    for (size_t i = 0; i < NENV; ++i)
-    {
-        size_t next_idx = (next_env_idx + i) % NENV;
-        
-        if (envs[next_idx].env_status != ENV_RUNNABLE)
-            continue;
-        
-        if (envs[next_idx].env_is_stopped)
-            continue;
+    /* Run env with the least virtual runtime from the highest
+     * priority non-empty run queue of this CPU. Currently running env
+     * is charged for the time it has used and is requeued, so it is
+     * chosen again only if it is still the least served one.
+     * If this CPU has nothing but idle envs to run, try to steal
+     * work from the busiest CPU. If run queues are empty, halt the cpu */
+
+    int cpu = cpunum();
+
+    if (curenv && curenv->env_status != ENV_FREE) sched_charge(curenv);
+
+    if (curenv && curenv->env_queued) {
+        runq_remove(curenv);
+        runq_insert(curenv);
+    }
 
-        if (check_wait_for_signal(envs + next_idx))
+    for (;;) {
+        int prio = runq_mask[cpu] ? __builtin_ctz(runq_mask[cpu]) : NENV_PRIO;
+        if (prio >= ENV_PRIO_IDLE && sched_steal(cpu, ENV_PRIO_IDLE)) continue;
+        if (!runq_mask[cpu]) break;
+
+        struct Env *env = RUNQ_ENV(runq[cpu][prio].next);
+        runq_min_vruntime[cpu][prio] = MAX(runq_min_vruntime[cpu][prio], env->env_vruntime);
+
+        /* Queued env waiting for signals has one pending,
+         * this completes its sys_sigwait */
+        if (check_wait_for_signal(env)) {
+            if (env->env_queued) runq_remove(env);
             continue;
+        }
 
-        env_run(envs + next_idx);
+        env_run(env);
     }
- 
-    if (curenv && 
-        curenv->env_status == ENV_RUNNING && 
-        !curenv->env_is_stopped &&
-        !check_wait_for_signal(curenv))
-        env_run(curenv);
 
-    cprintf("Halt\n");
+    if (thiscpu == bootcpu) cprintf("Halt\n");
 
     /* No runnable environments,
      * so just halt the cpu */
     sched_halt();
 }
 
-/* Halt this CPU when there is nothing to do. Wait until the
- * timer interrupt wakes it up. This function never returns */
+/* Halt this CPU when there is nothing to do. Wait until an
+ * interrupt wakes it up. This function never returns */
 _Noreturn void
 sched_halt(void) {
 
     /* For debugging and testing purposes, if there are no runnable
      * environments in the system, then drop into the kernel monitor */
-    int i;
-    for (i = 0; i < NENV; i++)
-        if (envs[i].env_status == ENV_RUNNABLE ||
-            envs[i].env_status == ENV_RUNNING) break;
-    if (i == NENV) {
+    if (!nlive && thiscpu == bootcpu) {
         cprintf("No runnable environments in the system!\n");
         for (;;) monitor(NULL);
     }
 
-    /* Mark that no environment is running on CPU */
+    /* Let halted BSP drop into the monitor */
+    if (!nlive && bootcpu->cpu_status == CPU_HALTED) lapic_ipi(0, T_RESCHED);
+
+    /* Mark that no environment is running on CPU
+     * and stop using address space of the last one */
     curenv = NULL;
+    switch_address_space(&kspace);
+
+    /* Use idle time to prepare zeroed pages, to merge
+     * small pages into huge ones and identical pages together */
+    bool more = zero_pools_refill();
+    more |= promote_huge_pages();
+    more |= ksm_scan();
+
+    /* Idle CPU is woken up by T_RESCHED when there is work for it,
+     * timer brings it back only while idle scanners have work left */
+    int cpu = cpunum();
+    if (sched_tickless()) {
+        uint64_t deadline = more ? read_tsc() + tsc_calibrate() / IDLE_SCAN_HZ : 0;
+        if (deadline != tick_deadline[cpu]) {
+            tick_deadline[cpu] = deadline;
+            timer_for_schedule->set_oneshot(deadline);
+        }
+    }
+
+    /* Mark that this CPU is in the HALT state, so that when
+     * an interrupt comes in, we know we should re-acquire the
+     * big kernel lock */
+    xchg(&thiscpu->cpu_status, CPU_HALTED);
+
+    /* Release the big kernel lock as if we were "leaving" the kernel */
+    unlock_kernel();
 
     /* Reset stack pointer, enable interrupts and then halt */
     asm volatile(
@@ -132,7 +400,7 @@ sched_halt(void) {
             "pushq $0\n"
             "pushq $0\n"
             "sti\n"
-            "hlt\n" ::"a"(cpu_ts.ts_rsp0));
+            "hlt\n" ::"a"(thiscpu->cpu_ts.ts_rsp0));
 
     /* Unreachable */
     for (;;)
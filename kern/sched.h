@@ -6,6 +6,13 @@
 #error "This is a JOS kernel header; user programs should not #include it"
 #endif
 
+#include <inc/env.h>
+
 _Noreturn void sched_yield(void);
+void sched_init(void);
+void sched_update(struct Env *env);
+int sched_set_nice(struct Env *env, int nice);
+void sched_preempt_others(void);
+void sched_tick(struct Env *env);
 
 #endif /* !JOS_KERN_SCHED_H */
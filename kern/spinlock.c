@@ -34,7 +34,7 @@ get_caller_pcs(uint64_t pcs[]) {
 /* Check whether this CPU is holding the lock. */
 static int
 holding(struct spinlock *lock) {
-    return lock->locked;
+    return lock->locked && lock->cpu == thiscpu;
 }
 #endif
 
@@ -43,6 +43,7 @@ __spin_initlock(struct spinlock *lk, char *name) {
     lk->locked = 0;
 #if trace_spinlock
     lk->name = name;
+    lk->cpu = 0;
 #endif
 }
 
@@ -63,10 +64,28 @@ spin_lock(struct spinlock *lk) {
 
         /* Record info about lock acquisition for debugging. */
 #if trace_spinlock
+    lk->cpu = thiscpu;
     get_caller_pcs(lk->pcs);
 #endif
 }
 
+/* Try to acquire the lock without spinning.
+ * Returns true if the lock was acquired */
+bool
+spin_trylock(struct spinlock *lk) {
+#if trace_spinlock
+    if (holding(lk)) panic("Cannot acquire %s: already holding", lk->name);
+#endif
+
+    if (xchg(&lk->locked, 1)) return 0;
+
+#if trace_spinlock
+    lk->cpu = thiscpu;
+    get_caller_pcs(lk->pcs);
+#endif
+    return 1;
+}
+
 /* Release the lock. */
 void
 spin_unlock(struct spinlock *lk) {
@@ -91,6 +110,7 @@ spin_unlock(struct spinlock *lk) {
     }
 
     lk->pcs[0] = 0;
+    lk->cpu = 0;
 #endif
 
     /* The xchg serializes, so that reads before release are
@@ -3,6 +3,7 @@
 
 #include <inc/types.h>
 #include <kern/traceopt.h>
+#include <kern/cpu.h>
 
 /* Mutual exclusion lock */
 struct spinlock {
@@ -10,14 +11,16 @@ struct spinlock {
 
 #if trace_spinlock
     /* For debugging: */
-    char *name;        /* Name of lock */
-    uintptr_t pcs[10]; /* The call stack (an array of program counters)
-                        * that locked the lock */
+    char *name;          /* Name of lock */
+    struct CpuInfo *cpu; /* The CPU holding the lock */
+    uintptr_t pcs[10];   /* The call stack (an array of program counters)
+                          * that locked the lock */
 #endif
 };
 
 void __spin_initlock(struct spinlock *lk, char *name);
 void spin_lock(struct spinlock *lk);
+bool spin_trylock(struct spinlock *lk);
 void spin_unlock(struct spinlock *lk);
 
 #define spin_initlock(lock) __spin_initlock(lock, #lock)
@@ -26,7 +29,12 @@ extern struct spinlock kernel_lock;
 
 static inline void
 lock_kernel(void) {
-    spin_lock(&kernel_lock);
+    /* Lock holder can be waiting for this CPU
+     * to flush its TLB, so serve shootdowns while spinning */
+    while (!spin_trylock(&kernel_lock)) {
+        tlb_shootdown_serve();
+        asm volatile("pause");
+    }
 }
 
 static inline void
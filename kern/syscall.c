@@ -123,6 +123,8 @@ sys_exofork(void) {
         return -E_NO_FREE_ENV;
 
     env->env_status = ENV_NOT_RUNNABLE;
+    sched_update(env);
+    sched_set_nice(env, curenv->env_nice);
     env->env_tf = curenv->env_tf;
     env->env_tf.tf_regs.reg_rax = 0;
 
@@ -153,10 +155,34 @@ sys_env_set_status(envid_t envid, int status) {
         return -E_BAD_ENV;
     
     env->env_status = status;
+    sched_update(env);
 
     return 0;
 }
 
+/* Set nice value of 'envid' which determines its CPU share
+ * relative to other environments of the same scheduling class,
+ * nice value is inherited by environments created with sys_exofork.
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_BAD_ENV if environment envid doesn't currently exist,
+ *      or the caller doesn't have permission to change envid.
+ *  -E_PERM if nice is lower than the nice value of the caller.
+ *  -E_INVAL if nice is not in [NICE_MIN, NICE_MAX] range. */
+static int
+sys_env_set_nice(envid_t envid, int nice) {
+    struct Env *env = NULL;
+    if (envid2env(envid, &env, true))
+        return -E_BAD_ENV;
+
+    /* Otherwise env could take CPU from its peers,
+     * e.g. by forking a child with lower nice value */
+    if (nice < curenv->env_nice)
+        return -E_PERM;
+
+    return sched_set_nice(env, nice);
+}
+
 /* Set the page fault upcall for 'envid' by modifying the corresponding struct
  * Env's 'env_pgfault_upcall' field.  When 'envid' causes a page fault, the
  * kernel will push a fault record onto the exception stack, then branch to
@@ -193,13 +219,20 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func) {
  * 
  * PROT_ALL is useful for validation.
  *
+ * ALLOC_HUGE_2M/ALLOC_HUGE_1G back the region with physically
+ * contiguous 2MB/1GB pages right away, ALLOC_POPULATE does
+ * the same with 4K pages. Such regions are not lazy.
+ *
  * Return 0 on success, < 0 on error.  Errors are:
  *  -E_BAD_ENV if environment envid doesn't currently exist,
  *      or the caller doesn't have permission to change envid.
  *  -E_INVAL if va >= MAX_USER_ADDRESS, or va is not page-aligned.
  *  -E_INVAL if perm is inappropriate (see above).
+ *  -E_INVAL if va or size is not aligned on requested huge page size.
+ *  -E_NOT_SUPP if ALLOC_HUGE_1G is requested but CPU has no 1GB pages.
  *  -E_NO_MEM if there's no memory to allocate the new page,
- *      or to allocate any necessary page tables. */
+ *      or to allocate any necessary page tables,
+ *      or there's no free contiguous block of requested size. */
 static int
 sys_alloc_region(envid_t envid, uintptr_t addr, size_t size, int perm) {
     // LAB 9: Your code here:
@@ -213,12 +246,23 @@ sys_alloc_region(envid_t envid, uintptr_t addr, size_t size, int perm) {
     if (addr & CLASS_MASK(0))
         return -E_INVAL;
 
-    if (perm & ~(PROT_ALL | ALLOC_ONE | ALLOC_ZERO))
+    if (perm & ~(PROT_ALL | ALLOC_ONE | ALLOC_ZERO | ALLOC_HUGE_2M | ALLOC_HUGE_1G | ALLOC_POPULATE))
+        return -E_INVAL;
+
+    if ((perm & ALLOC_HUGE_2M) && (perm & ALLOC_HUGE_1G))
         return -E_INVAL;
 
     if (!((perm & ALLOC_ONE) || (perm & ALLOC_ZERO)))
         perm |= ALLOC_ZERO;
 
+    if (perm & (ALLOC_HUGE_2M | ALLOC_HUGE_1G | ALLOC_POPULATE)) {
+        if (addr + size > MAX_USER_ADDRESS || addr + size < addr)
+            return -E_INVAL;
+
+        int class = perm & ALLOC_HUGE_1G ? CLASS_1G : perm & ALLOC_HUGE_2M ? CLASS_2M : 0;
+        return map_populated_region(&env->address_space, addr, size, class, perm | PROT_USER_);
+    }
+
     if (map_region(&env->address_space, addr, NULL, 0, size, perm | PROT_USER_ | PROT_LAZY))
         return -E_NO_MEM;
 
@@ -314,6 +358,48 @@ sys_unmap_region(envid_t envid, uintptr_t va, size_t size) {
     return 0;
 }
 
+/* Give the kernel a hint about future use of region at 'va'
+ * of 'envid' address space (see enum RegionAdvice).
+ * WILLNEED and DONTNEED are applied to the pages mapped now,
+ * SEQUENTIAL, HUGEPAGE, NOHUGEPAGE and NORMAL are remembered
+ * and affect later page faults and huge page promotion.
+ * Advice for an empty region is a no-op.
+ *
+ * Return 0 on success, < 0 on error.  Errors are:
+ *  -E_BAD_ENV if environment envid doesn't currently exist,
+ *      or the caller doesn't have permission to change envid.
+ *  -E_INVAL if region is not a part of user space, va is not page-aligned,
+ *      or advice is unknown.
+ *  -E_NO_MEM if there's no memory to populate region or
+ *      there are too many regions with hints. */
+static int
+sys_region_advise(envid_t envid, uintptr_t va, size_t size, int advice) {
+    struct Env *env = NULL;
+    if (envid2env(envid, &env, true))
+        return -E_BAD_ENV;
+
+    size = ROUNDUP(size, PAGE_SIZE);
+    if (va & CLASS_MASK(0) || va + size > MAX_USER_ADDRESS || va + size < va)
+        return -E_INVAL;
+
+    /* Would take a hint slot otherwise */
+    if (!size) return 0;
+
+    switch (advice) {
+    case ADVICE_WILLNEED:
+        return prefault_region(&env->address_space, va, size, env_fault_class(env, va));
+    case ADVICE_DONTNEED:
+        return discard_region(&env->address_space, va, size);
+    case ADVICE_NORMAL:
+    case ADVICE_SEQUENTIAL:
+    case ADVICE_HUGEPAGE:
+    case ADVICE_NOHUGEPAGE:
+        return env_set_advice(env, va, va + size, advice);
+    default:
+        return -E_INVAL;
+    }
+}
+
 /* Try to send 'value' to the target env 'envid'.
  * If srcva < MAX_USER_ADDRESS, then also send region currently mapped at 'srcva',
  * so receiver also gets mapping.
@@ -380,6 +466,7 @@ sys_ipc_try_send(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, in
     env->env_ipc_from = sys_getenvid();
     env->env_ipc_value = value;
     env->env_status = ENV_RUNNABLE;
+    sched_update(env);
     
     return 0;
 }
@@ -418,6 +505,7 @@ sys_ipc_recv(uintptr_t dstva, uintptr_t maxsize) {
 
     curenv->env_ipc_recving = 1;
     curenv->env_status = ENV_NOT_RUNNABLE;
+    sched_update(curenv);
     curenv->env_tf.tf_regs.reg_rax = 0;
     sched_yield();
     return 0;
@@ -508,12 +596,14 @@ sys_sigqueue(pid_t pid, int signo, const union sigval value) {
 
     if (signo == SIGSTOP) {
         env->env_is_stopped = true;
+        sched_update(env);
         maybe_send_sigchld(env->env_parent_id, false);
         goto signal_sent;
     }
 
     if (signo == SIGCONT) {
         env->env_is_stopped = false;
+        sched_update(env);
         maybe_send_sigchld(env->env_parent_id, false);
         goto signal_sent;
     }
@@ -552,6 +642,7 @@ sys_sigqueue(pid_t pid, int signo, const union sigval value) {
     memcpy(&(es->sa), sa, sizeof(struct sigaction));
 
     env->env_sig_queue_end = new_end;
+    sched_update(env);
 
     if (sa->sa_flags & SA_RESETHAND) {
         sa->sa_handler = signo == SIGCHLD ? SIG_IGN : SIG_DFL;
@@ -584,6 +675,7 @@ sys_sigwait(const sigset_t * set, int * sig) {
 
     curenv->env_sig_waiting = tmp_set;
     curenv->env_sig_waiting_num_out = sig;
+    sched_update(curenv);
     curenv->env_tf.tf_regs.reg_rax = 0;
     if (trace_signals)
         cprintf("signals: env %x: will wait for signals 0x%x\n", curenv->env_id, tmp_set);
@@ -686,6 +778,10 @@ syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t
         return sys_unmap_region((envid_t)a1, a2, (size_t)a3);
     case SYS_region_refs:
         return sys_region_refs(a1, (size_t)a2, a3, a4);
+    case SYS_region_advise:
+        return sys_region_advise((envid_t)a1, a2, (size_t)a3, (int)a4);
+    case SYS_env_set_nice:
+        return sys_env_set_nice((envid_t)a1, (int)a2);
     case SYS_exofork:
         return sys_exofork();
     case SYS_env_set_status:
@@ -214,6 +214,17 @@ get_hpet(void) {
     return khpet;
 }
 
+/* Obtain and map MADT ACPI table address. */
+MADT *
+get_madt(void) {
+    static MADT *kmadt = NULL;
+
+    if (!kmadt)
+        kmadt = acpi_find_table("APIC");
+
+    return kmadt;
+}
+
 /* Getting physical HPET timer address from its table. */
 HPETRegister *
 hpet_register(void) {
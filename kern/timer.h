@@ -15,9 +15,11 @@ struct Timer {
     uint64_t (*get_cpu_freq)(void);  /* Get CPU frequency */
     void (*enable_interrupts)(void); /* Init timer interrupts */
     void (*handle_interrupts)(void);
+    void (*set_oneshot)(uint64_t);   /* Interrupt once at TSC value, 0 cancels */
+    bool timer_percpu;               /* Every CPU gets its own interrupts */
 };
 
-#define MAX_TIMERS 5
+#define MAX_TIMERS 7
 
 extern struct Timer timertab[MAX_TIMERS];
 
@@ -26,6 +28,8 @@ extern struct Timer timer_rtc;
 extern struct Timer timer_hpet0;
 extern struct Timer timer_hpet1;
 extern struct Timer timer_acpipm;
+extern struct Timer timer_lapic;
+extern struct Timer timer_lapic_periodic;
 extern struct Timer *timer_for_schedule;
 
 #pragma pack(push, 1)
@@ -175,12 +179,45 @@ typedef struct {
     uint8_t Reserved3[3];
 } FADT;
 
+typedef struct {
+    ACPISDTHeader h;
+    uint32_t LocalApicAddress;
+    uint32_t Flags;
+    uint8_t Entries[];
+} MADT;
+
+/* MADT interrupt controller structure types */
+#define MADT_LOCAL_APIC          0
+#define MADT_LOCAL_APIC_OVERRIDE 5
+
+/* Processor is usable (MADTLocalApic.Flags) */
+#define MADT_LAPIC_ENABLED 0x1
+
+typedef struct {
+    uint8_t Type;
+    uint8_t Length;
+} MADTEntryHeader;
+
+typedef struct {
+    MADTEntryHeader h;
+    uint8_t ProcessorId;
+    uint8_t ApicId;
+    uint32_t Flags;
+} MADTLocalApic;
+
+typedef struct {
+    MADTEntryHeader h;
+    uint16_t Reserved;
+    uint64_t LocalApicAddress;
+} MADTLocalApicOverride;
+
 #pragma pack(pop)
 
 void acpi_enable(void);
 RSDP *get_rsdp(void);
 FADT *get_fadt(void);
 HPET *get_hpet(void);
+MADT *get_madt(void);
 
 void hpet_print_struct(void);
 void hpet_init(void);
@@ -19,15 +19,20 @@
 #include <kern/timer.h>
 #include <kern/vsyscall.h>
 #include <kern/traceopt.h>
+#include <kern/spinlock.h>
 #include <stdint.h>
 
-static struct Taskstate ts;
-
 /* For debugging, so print_trapframe can distinguish between printing
  * a saved trapframe and printing the current trapframe and print some
  * additional information in the latter case */
 static struct Trapframe *last_tf;
 
+/* Number of pages resolved on isolated lazy page fault
+ * (including the faulting one), 1 disables fault-around */
+size_t fault_around_pages = 4;
+/* Window grows up to this size on sequential access */
+#define FAULT_AROUND_MAX 64
+
 /* Interrupt descriptor table  (Must be built at run time because
  * shifted function addresses can't be represented in relocation records) */
 struct Gatedesc idt[256] = {{0}};
@@ -128,12 +133,16 @@ trap_init(void) {
     extern void (*fperr_thdlr)(void);
 
     extern void (*syscall_thdlr)(void);
+    extern void (*tlbflush_thdlr)(void);
+    extern void (*resched_thdlr)(void);
 
     extern void (*timer_thdlr)(void);
     extern void (*clock_thdlr)(void);
 
     extern void (*kbd_thdlr)(void);
     extern void (*serial_thdlr)(void);
+    extern void (*spurious_thdlr)(void);
+    extern void (*error_thdlr)(void);
 
     idt[T_DIVIDE] = GATE(0, GD_KT, (uintptr_t)(&divide_thdlr), 0);
     idt[T_DEBUG]  = GATE(0, GD_KT, (uintptr_t)(&debug_thdlr), 0);
@@ -151,12 +160,16 @@ trap_init(void) {
     idt[T_FPERR]  = GATE(0, GD_KT, (uintptr_t)(&fperr_thdlr), 0);
 
     idt[T_SYSCALL]  = GATE(0, GD_KT, (uintptr_t)(&syscall_thdlr), 3);
+    idt[T_TLBFLUSH] = GATE(0, GD_KT, (uintptr_t)(&tlbflush_thdlr), 0);
+    idt[T_RESCHED]  = GATE(0, GD_KT, (uintptr_t)(&resched_thdlr), 0);
 
     idt[IRQ_OFFSET + IRQ_TIMER]  = GATE(0, GD_KT, (uintptr_t)(&timer_thdlr), 0);
     idt[IRQ_OFFSET + IRQ_CLOCK]  = GATE(0, GD_KT, (uintptr_t)(&clock_thdlr), 0);
 
     idt[IRQ_OFFSET + IRQ_KBD]  = GATE(0, GD_KT, (uintptr_t)(&kbd_thdlr), 0);
     idt[IRQ_OFFSET + IRQ_SERIAL]  = GATE(0, GD_KT, (uintptr_t)(&serial_thdlr), 0);
+    idt[IRQ_OFFSET + IRQ_SPURIOUS]  = GATE(0, GD_KT, (uintptr_t)(&spurious_thdlr), 0);
+    idt[IRQ_OFFSET + IRQ_ERROR]  = GATE(0, GD_KT, (uintptr_t)(&error_thdlr), 0);
 
     /* Setup #PF handler dedicated stack
      * It should be switched on #PF because
@@ -197,17 +210,23 @@ trap_init_percpu(void) {
             "d"(GD_UD | 3), "c"(GD_KT)
             : "cc", "memory");
 
+    /* Task register is not loaded yet, so local APIC
+     * is used to find out which CPU we are */
+    int i = lapic_cpunum();
+    struct Taskstate *ts = &cpus[i].cpu_ts;
+
     /* Setup a TSS so that we get the right stack
      * when we trap to the kernel. */
-    ts.ts_rsp0 = KERN_STACK_TOP;
-    ts.ts_ist1 = KERN_PF_STACK_TOP;
+    ts->ts_rsp0 = KERN_STACK_TOP - i * KERN_CPU_STACKS_SIZE;
+    ts->ts_ist1 = KERN_PF_STACK_TOP - i * KERN_CPU_STACKS_SIZE;
 
-    /* Initialize the TSS slot of the gdt. */
-    *(volatile struct Segdesc64 *)(&gdt[(GD_TSS0 >> 3)]) = SEG64_TSS(STS_T64A, ((uint64_t)&ts), sizeof(struct Taskstate), 0);
+    /* Initialize the TSS slot of the gdt (every 64-bit TSS
+     * descriptor takes two slots). */
+    *(volatile struct Segdesc64 *)(&gdt[(GD_TSS0 >> 3) + 2 * i]) = SEG64_TSS(STS_T64A, ((uint64_t)ts), sizeof(struct Taskstate), 0);
 
     /* Load the TSS selector (like other segment selectors, the
      * bottom three bits are special; we leave them 0) */
-    ltr(GD_TSS0);
+    ltr(GD_TSS0 + (i << 4));
 
     /* Load the IDT */
     lidt(&idt_pd);
@@ -298,13 +317,26 @@ trap_dispatch(struct Trapframe *tf) {
             print_trapframe(tf);
         }
         return;
+    case IRQ_OFFSET + IRQ_ERROR:
+        cprintf("Local APIC error on CPU %d\n", cpunum());
+        lapic_eoi();
+        return;
+    case T_TLBFLUSH:
+        /* Already served in trap() */
+        return;
+    case T_RESCHED:
+        /* Other CPU made env runnable here, destroyed curenv
+         * or needs this CPU to program its tickless quantum */
+        lapic_eoi();
+        sched_yield();
+        return;
     case IRQ_OFFSET + IRQ_TIMER:
     case IRQ_OFFSET + IRQ_CLOCK:
         // LAB 12: Your code here
         // LAB 5: Your code here
         // LAB 4: Your code here
-        vsys[VSYS_gettime] = gettime();
         timer_for_schedule->handle_interrupts();
+        if (!timer_for_schedule->timer_percpu) sched_preempt_others();
         sched_yield();
         return;
         /* Handle keyboard and serial interrupts. */
@@ -328,6 +360,26 @@ trap_dispatch(struct Trapframe *tf) {
 /* We do not support recursive page faults in-kernel */
 bool in_page_fault;
 
+/* Resolve lazy pages after the one just faulted at va,
+ * window doubles while faults are sequential and is
+ * maximal right away for ADVICE_SEQUENTIAL regions */
+static void
+env_fault_around(struct Env *env, uintptr_t va) {
+    bool sequential = env_advice(env, va) == ADVICE_SEQUENTIAL;
+    if (fault_around_pages <= 1 && !sequential) return;
+
+    va = ROUNDDOWN(va, PAGE_SIZE);
+    if (sequential)
+        env->env_fault_window = FAULT_AROUND_MAX;
+    else if (va == env->env_fault_next && env->env_fault_window)
+        env->env_fault_window = MIN(env->env_fault_window * 2, FAULT_AROUND_MAX);
+    else
+        env->env_fault_window = fault_around_pages;
+
+    env->env_faults_avoided += fault_around(&env->address_space, va, env->env_fault_window,
+                                            env_fault_class(env, va), &env->env_fault_next);
+}
+
 _Noreturn void
 trap(struct Trapframe *tf) {
     /* The environment may have set DF and some versions
@@ -344,6 +396,27 @@ trap(struct Trapframe *tf) {
      * the interrupt path */
     assert(!(read_rflags() & FL_IF));
 
+    /* TLB shootdown is served before acquiring the big kernel lock
+     * since its holder is waiting for it */
+    if (tf->tf_trapno == T_TLBFLUSH) {
+        tlb_shootdown_serve();
+        lapic_eoi();
+    }
+
+    /* Re-acquire the big kernel lock if we were halted in
+     * sched_yield(). Trapped from user mode, acquire it too */
+    if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED)
+        lock_kernel();
+    else if ((tf->tf_cs & 3) == 3)
+        lock_kernel();
+
+    /* Env was destroyed by other CPU while running here */
+    if (curenv && curenv->env_status == ENV_DYING) {
+        env_free(curenv);
+        curenv = NULL;
+        sched_yield();
+    }
+
     if (trace_traps) cprintf("Incoming TRAP[%ld] frame at %p\n", tf->tf_trapno, tf);
     if (trace_traps_more) print_trapframe(tf);
 
@@ -373,7 +446,8 @@ trap(struct Trapframe *tf) {
          * which can happen with curenv == NULL */
 
         /* Read processor's CR2 register to find the faulting address */
-        int res = force_alloc_page(current_space, va, MAX_ALLOCATION_CLASS);
+        bool user_fault = curenv && current_space == &curenv->address_space && va < MAX_USER_ADDRESS;
+        int res = force_alloc_page(current_space, va, user_fault ? env_fault_class(curenv, va) : MAX_ALLOCATION_CLASS);
         if (trace_pagefaults) {
             bool can_redir = tf->tf_err & FEC_U && curenv && curenv->env_pgfault_upcall;
             cprintf("<%p> Page fault ip=%08lX va=%08lX err=%c%c%c%c%c -> %s\n", current_space, tf->tf_rip, va,
@@ -384,20 +458,28 @@ trap(struct Trapframe *tf) {
                     tf->tf_err & FEC_I ? 'I' : '-',
                     res ? can_redir ? "redirected to user" : "fault" : "resolved by kernel");
         }
+        if (!res && user_fault) {
+            env_fault_around(curenv, va);
+            /* Sequential fill might have just populated whole huge page range */
+            uintptr_t filled = MAX(curenv->env_fault_next, ROUNDDOWN(va, PAGE_SIZE) + PAGE_SIZE);
+            if (filled >= ROUNDDOWN(va, HUGE_PAGE_SIZE) + HUGE_PAGE_SIZE &&
+                env_advice(curenv, va) != ADVICE_NOHUGEPAGE)
+                promote_huge_page(current_space, va);
+        }
         if (!res) {
             in_page_fault = 0;
             env_pop_tf(tf);
         }
     }
 
-    assert(curenv);
-
     /* Copy trap frame (which is currently on the stack)
      * into 'curenv->env_tf', so that running the environment
-     * will restart at the trap point */
-    curenv->env_tf = *tf;
-    /* The trapframe on the stack should be ignored from here on */
-    tf = &curenv->env_tf;
+     * will restart at the trap point. Halted CPU has no curenv */
+    if (curenv) {
+        curenv->env_tf = *tf;
+        /* The trapframe on the stack should be ignored from here on */
+        tf = &curenv->env_tf;
+    }
 
     /* Record that tf is the last real trapframe so
      * print_trapframe can print some additional information */
@@ -440,12 +522,14 @@ call_signal_handler(uintptr_t rsp, struct Trapframe *tf, struct EnqueuedSignal *
     // Put signal info on stack
     uintptr_t dst = handler_rsp;
     assert(dst % 8 == 0);
-    as_memcpy(&curenv->address_space, dst, (uintptr_t)es, sizeof(struct EnqueuedSignal));
+    if (copy_to_space(&curenv->address_space, dst, es, sizeof(struct EnqueuedSignal)) < 0)
+        env_destroy(curenv);
     dst += sizeof(struct EnqueuedSignal);
 
     // Put prev blocked signals mask on stack
     assert(dst % 8 == 0);
-    as_memcpy(&curenv->address_space, dst, (uintptr_t)&(curenv->env_sig_mask), sizeof(curenv->env_sig_mask));
+    if (copy_to_space(&curenv->address_space, dst, &curenv->env_sig_mask, sizeof(curenv->env_sig_mask)) < 0)
+        env_destroy(curenv);
     dst += sizeof(curenv->env_sig_mask) + mask_alignment;
 
     // Prepare trapframe for returning from handler
@@ -457,7 +541,8 @@ call_signal_handler(uintptr_t rsp, struct Trapframe *tf, struct EnqueuedSignal *
     utf.utf_rsp = tf->tf_rsp;
     utf.utf_rip = tf->tf_rip;
     assert(dst % 8 == 0);
-    as_memcpy(&curenv->address_space, dst, (uintptr_t)&utf, sizeof(struct UTrapframe));
+    if (copy_to_space(&curenv->address_space, dst, &utf, sizeof(struct UTrapframe)) < 0)
+        env_destroy(curenv);
     dst += sizeof(struct UTrapframe);
 
     // Update blocked signals mask
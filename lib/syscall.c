@@ -112,6 +112,16 @@ sys_unmap_region(envid_t envid, void *va, size_t size) {
     return res;
 }
 
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+}
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+}
+
 /* sys_exofork is inlined in lib.h */
 
 int
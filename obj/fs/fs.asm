@@ -0,0 +1,10268 @@
+
+obj/fs/fs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 bd 25 00 00       	call   8025e0 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <ide_wait_ready>:
+}
+
+static inline uint8_t __attribute__((always_inline))
+inb(int port) {
+    uint8_t data;
+    asm volatile("inb %w1,%0"
+  800025:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80002a:	ec                   	in     (%dx),%al
+
+static int
+ide_wait_ready(bool check_error) {
+    int r;
+
+    while (((r = inb(0x1F7)) & (IDE_BSY | IDE_DRDY)) != IDE_DRDY) /* nothing */
+  80002b:	89 c1                	mov    %eax,%ecx
+  80002d:	83 e1 c0             	and    $0xffffffc0,%ecx
+  800030:	80 f9 40             	cmp    $0x40,%cl
+  800033:	75 f5                	jne    80002a <ide_wait_ready+0x5>
+        ;
+
+    if (check_error && (r & (IDE_DF | IDE_ERR)) != 0) return -1;
+    return 0;
+  800035:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (check_error && (r & (IDE_DF | IDE_ERR)) != 0) return -1;
+  80003a:	40 84 ff             	test   %dil,%dil
+  80003d:	74 0a                	je     800049 <ide_wait_ready+0x24>
+  80003f:	a8 21                	test   $0x21,%al
+  800041:	0f 95 c2             	setne  %dl
+  800044:	0f b6 d2             	movzbl %dl,%edx
+  800047:	f7 da                	neg    %edx
+}
+  800049:	89 d0                	mov    %edx,%eax
+  80004b:	c3                   	ret
+
+000000000080004c <ide_probe_disk1>:
+
+bool
+ide_probe_disk1(void) {
+  80004c:	55                   	push   %rbp
+  80004d:	48 89 e5             	mov    %rsp,%rbp
+  800050:	53                   	push   %rbx
+  800051:	48 83 ec 08          	sub    $0x8,%rsp
+    int x;
+
+    /* Wait for Device 0 to be ready */
+    ide_wait_ready(0);
+  800055:	bf 00 00 00 00       	mov    $0x0,%edi
+  80005a:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800061:	00 00 00 
+  800064:	ff d0                	call   *%rax
+                 : "memory", "cc");
+}
+
+static inline void __attribute__((always_inline))
+outb(int port, uint8_t data) {
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  800066:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80006b:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800070:	ee                   	out    %al,(%dx)
+    asm volatile("inb %w1,%0"
+  800071:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800076:	ec                   	in     (%dx),%al
+
+    /* Switch to Device 1 */
+    outb(0x1F6, 0xE0 | (1 << 4));
+
+    /* Check for Device 1 to be ready for a while */
+    for (x = 0; x < 1000 && (inb(0x1F7) & (IDE_BSY | IDE_DF | IDE_ERR)) != 0; x++) /* nothing */
+  800077:	a8 a1                	test   $0xa1,%al
+  800079:	74 54                	je     8000cf <ide_probe_disk1+0x83>
+  80007b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800080:	83 c1 01             	add    $0x1,%ecx
+  800083:	81 f9 e8 03 00 00    	cmp    $0x3e8,%ecx
+  800089:	74 05                	je     800090 <ide_probe_disk1+0x44>
+  80008b:	ec                   	in     (%dx),%al
+  80008c:	a8 a1                	test   $0xa1,%al
+  80008e:	75 f0                	jne    800080 <ide_probe_disk1+0x34>
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  800090:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+  800095:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  80009a:	ee                   	out    %al,(%dx)
+        ;
+
+    /* Switch back to Device 0 */
+    outb(0x1F6, 0xE0 | (0 << 4));
+
+    cprintf("Device 1 presence: %d\n", (x < 1000));
+  80009b:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+  8000a1:	0f 9e c3             	setle  %bl
+  8000a4:	40 0f 9e c6          	setle  %sil
+  8000a8:	40 0f b6 f6          	movzbl %sil,%esi
+  8000ac:	48 bf 28 56 80 00 00 	movabs $0x805628,%rdi
+  8000b3:	00 00 00 
+  8000b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bb:	48 ba fa 27 80 00 00 	movabs $0x8027fa,%rdx
+  8000c2:	00 00 00 
+  8000c5:	ff d2                	call   *%rdx
+    return (x < 1000);
+}
+  8000c7:	89 d8                	mov    %ebx,%eax
+  8000c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000cd:	c9                   	leave
+  8000ce:	c3                   	ret
+    for (x = 0; x < 1000 && (inb(0x1F7) & (IDE_BSY | IDE_DF | IDE_ERR)) != 0; x++) /* nothing */
+  8000cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000d4:	eb ba                	jmp    800090 <ide_probe_disk1+0x44>
+
+00000000008000d6 <ide_set_disk>:
+
+void
+ide_set_disk(int d) {
+    if (d != 0 && d != 1)
+  8000d6:	83 ff 01             	cmp    $0x1,%edi
+  8000d9:	77 0c                	ja     8000e7 <ide_set_disk+0x11>
+        panic("bad disk number");
+    diskno = d;
+  8000db:	89 f8                	mov    %edi,%eax
+  8000dd:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8000e4:	00 00 
+  8000e6:	c3                   	ret
+ide_set_disk(int d) {
+  8000e7:	55                   	push   %rbp
+  8000e8:	48 89 e5             	mov    %rsp,%rbp
+        panic("bad disk number");
+  8000eb:	48 ba 3f 56 80 00 00 	movabs $0x80563f,%rdx
+  8000f2:	00 00 00 
+  8000f5:	be 34 00 00 00       	mov    $0x34,%esi
+  8000fa:	48 bf 4f 56 80 00 00 	movabs $0x80564f,%rdi
+  800101:	00 00 00 
+  800104:	b8 00 00 00 00       	mov    $0x0,%eax
+  800109:	48 b9 aa 26 80 00 00 	movabs $0x8026aa,%rcx
+  800110:	00 00 00 
+  800113:	ff d1                	call   *%rcx
+
+0000000000800115 <ide_read>:
+}
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs) {
+  800115:	55                   	push   %rbp
+  800116:	48 89 e5             	mov    %rsp,%rbp
+  800119:	41 55                	push   %r13
+  80011b:	41 54                	push   %r12
+  80011d:	53                   	push   %rbx
+  80011e:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+
+    assert(nsecs <= 256);
+  800122:	48 81 fa 00 01 00 00 	cmp    $0x100,%rdx
+  800129:	0f 87 c0 00 00 00    	ja     8001ef <ide_read+0xda>
+  80012f:	41 89 fd             	mov    %edi,%r13d
+  800132:	48 89 f3             	mov    %rsi,%rbx
+  800135:	49 89 d4             	mov    %rdx,%r12
+
+    ide_wait_ready(0);
+  800138:	bf 00 00 00 00       	mov    $0x0,%edi
+  80013d:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800144:	00 00 00 
+  800147:	ff d0                	call   *%rax
+  800149:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  80014e:	44 89 e0             	mov    %r12d,%eax
+  800151:	ee                   	out    %al,(%dx)
+  800152:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  800157:	44 89 e8             	mov    %r13d,%eax
+  80015a:	ee                   	out    %al,(%dx)
+
+    outb(0x1F2, nsecs);
+    outb(0x1F3, secno & 0xFF);
+    outb(0x1F4, (secno >> 8) & 0xFF);
+  80015b:	44 89 e8             	mov    %r13d,%eax
+  80015e:	c1 e8 08             	shr    $0x8,%eax
+  800161:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  800166:	ee                   	out    %al,(%dx)
+    outb(0x1F5, (secno >> 16) & 0xFF);
+  800167:	44 89 e8             	mov    %r13d,%eax
+  80016a:	c1 e8 10             	shr    $0x10,%eax
+  80016d:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  800172:	ee                   	out    %al,(%dx)
+    outb(0x1F6, 0xE0 | ((diskno & 1) << 4) | ((secno >> 24) & 0x0F));
+  800173:	a1 00 70 80 00 00 00 	movabs 0x807000,%eax
+  80017a:	00 00 
+  80017c:	c1 e0 04             	shl    $0x4,%eax
+  80017f:	83 e0 10             	and    $0x10,%eax
+  800182:	41 c1 ed 18          	shr    $0x18,%r13d
+  800186:	41 83 e5 0f          	and    $0xf,%r13d
+  80018a:	44 09 e8             	or     %r13d,%eax
+  80018d:	83 c8 e0             	or     $0xffffffe0,%eax
+  800190:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800195:	ee                   	out    %al,(%dx)
+  800196:	b8 20 00 00 00       	mov    $0x20,%eax
+  80019b:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  8001a0:	ee                   	out    %al,(%dx)
+    outb(0x1F7, 0x20); /* CMD 0x20 means read sector */
+
+    for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  8001a1:	4d 85 e4             	test   %r12,%r12
+  8001a4:	74 7e                	je     800224 <ide_read+0x10f>
+  8001a6:	49 c1 e4 09          	shl    $0x9,%r12
+  8001aa:	49 01 dc             	add    %rbx,%r12
+        if ((r = ide_wait_ready(1)) < 0) return r;
+  8001ad:	49 bd 25 00 80 00 00 	movabs $0x800025,%r13
+  8001b4:	00 00 00 
+  8001b7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001bc:	41 ff d5             	call   *%r13
+  8001bf:	85 c0                	test   %eax,%eax
+  8001c1:	78 21                	js     8001e4 <ide_read+0xcf>
+    asm volatile("cld\n\trepne\n\tinsl"
+  8001c3:	48 89 df             	mov    %rbx,%rdi
+  8001c6:	b9 80 00 00 00       	mov    $0x80,%ecx
+  8001cb:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  8001d0:	fc                   	cld
+  8001d1:	f2 6d                	repnz insl (%dx),%es:(%rdi)
+    for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  8001d3:	48 81 c3 00 02 00 00 	add    $0x200,%rbx
+  8001da:	49 39 dc             	cmp    %rbx,%r12
+  8001dd:	75 d8                	jne    8001b7 <ide_read+0xa2>
+        insl(0x1F0, dst, SECTSIZE / 4);
+    }
+
+    return 0;
+  8001df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8001e4:	48 83 c4 08          	add    $0x8,%rsp
+  8001e8:	5b                   	pop    %rbx
+  8001e9:	41 5c                	pop    %r12
+  8001eb:	41 5d                	pop    %r13
+  8001ed:	5d                   	pop    %rbp
+  8001ee:	c3                   	ret
+    assert(nsecs <= 256);
+  8001ef:	48 b9 58 56 80 00 00 	movabs $0x805658,%rcx
+  8001f6:	00 00 00 
+  8001f9:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  800200:	00 00 00 
+  800203:	be 3c 00 00 00       	mov    $0x3c,%esi
+  800208:	48 bf 4f 56 80 00 00 	movabs $0x80564f,%rdi
+  80020f:	00 00 00 
+  800212:	b8 00 00 00 00       	mov    $0x0,%eax
+  800217:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  80021e:	00 00 00 
+  800221:	41 ff d0             	call   *%r8
+    return 0;
+  800224:	b8 00 00 00 00       	mov    $0x0,%eax
+  800229:	eb b9                	jmp    8001e4 <ide_read+0xcf>
+
+000000000080022b <ide_write>:
+
+int
+ide_write(uint32_t secno, const void *src, size_t nsecs) {
+  80022b:	55                   	push   %rbp
+  80022c:	48 89 e5             	mov    %rsp,%rbp
+  80022f:	41 55                	push   %r13
+  800231:	41 54                	push   %r12
+  800233:	53                   	push   %rbx
+  800234:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+
+    assert(nsecs <= 256);
+  800238:	48 81 fa 00 01 00 00 	cmp    $0x100,%rdx
+  80023f:	0f 87 c0 00 00 00    	ja     800305 <ide_write+0xda>
+  800245:	41 89 fd             	mov    %edi,%r13d
+  800248:	48 89 f3             	mov    %rsi,%rbx
+  80024b:	49 89 d4             	mov    %rdx,%r12
+
+    ide_wait_ready(0);
+  80024e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800253:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80025a:	00 00 00 
+  80025d:	ff d0                	call   *%rax
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  80025f:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  800264:	44 89 e0             	mov    %r12d,%eax
+  800267:	ee                   	out    %al,(%dx)
+  800268:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  80026d:	44 89 e8             	mov    %r13d,%eax
+  800270:	ee                   	out    %al,(%dx)
+
+    outb(0x1F2, nsecs);
+    outb(0x1F3, secno & 0xFF);
+    outb(0x1F4, (secno >> 8) & 0xFF);
+  800271:	44 89 e8             	mov    %r13d,%eax
+  800274:	c1 e8 08             	shr    $0x8,%eax
+  800277:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  80027c:	ee                   	out    %al,(%dx)
+    outb(0x1F5, (secno >> 16) & 0xFF);
+  80027d:	44 89 e8             	mov    %r13d,%eax
+  800280:	c1 e8 10             	shr    $0x10,%eax
+  800283:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  800288:	ee                   	out    %al,(%dx)
+    outb(0x1F6, 0xE0 | ((diskno & 1) << 4) | ((secno >> 24) & 0x0F));
+  800289:	a1 00 70 80 00 00 00 	movabs 0x807000,%eax
+  800290:	00 00 
+  800292:	c1 e0 04             	shl    $0x4,%eax
+  800295:	83 e0 10             	and    $0x10,%eax
+  800298:	41 c1 ed 18          	shr    $0x18,%r13d
+  80029c:	41 83 e5 0f          	and    $0xf,%r13d
+  8002a0:	44 09 e8             	or     %r13d,%eax
+  8002a3:	83 c8 e0             	or     $0xffffffe0,%eax
+  8002a6:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  8002ab:	ee                   	out    %al,(%dx)
+  8002ac:	b8 30 00 00 00       	mov    $0x30,%eax
+  8002b1:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  8002b6:	ee                   	out    %al,(%dx)
+    outb(0x1F7, 0x30); /* CMD 0x30 means write sector */
+
+    for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  8002b7:	4d 85 e4             	test   %r12,%r12
+  8002ba:	74 7e                	je     80033a <ide_write+0x10f>
+  8002bc:	49 c1 e4 09          	shl    $0x9,%r12
+  8002c0:	49 01 dc             	add    %rbx,%r12
+        if ((r = ide_wait_ready(1)) < 0) return r;
+  8002c3:	49 bd 25 00 80 00 00 	movabs $0x800025,%r13
+  8002ca:	00 00 00 
+  8002cd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8002d2:	41 ff d5             	call   *%r13
+  8002d5:	85 c0                	test   %eax,%eax
+  8002d7:	78 21                	js     8002fa <ide_write+0xcf>
+                 : "cc");
+}
+
+static inline void __attribute__((always_inline))
+outsl(int port, const void *addr, int cnt) {
+    asm volatile("cld\n\trepne\n\toutsl"
+  8002d9:	48 89 de             	mov    %rbx,%rsi
+  8002dc:	b9 80 00 00 00       	mov    $0x80,%ecx
+  8002e1:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  8002e6:	fc                   	cld
+  8002e7:	f2 6f                	repnz outsl %ds:(%rsi),(%dx)
+    for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  8002e9:	48 81 c3 00 02 00 00 	add    $0x200,%rbx
+  8002f0:	49 39 dc             	cmp    %rbx,%r12
+  8002f3:	75 d8                	jne    8002cd <ide_write+0xa2>
+        outsl(0x1F0, src, SECTSIZE / 4);
+    }
+
+    return 0;
+  8002f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8002fa:	48 83 c4 08          	add    $0x8,%rsp
+  8002fe:	5b                   	pop    %rbx
+  8002ff:	41 5c                	pop    %r12
+  800301:	41 5d                	pop    %r13
+  800303:	5d                   	pop    %rbp
+  800304:	c3                   	ret
+    assert(nsecs <= 256);
+  800305:	48 b9 58 56 80 00 00 	movabs $0x805658,%rcx
+  80030c:	00 00 00 
+  80030f:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  800316:	00 00 00 
+  800319:	be 53 00 00 00       	mov    $0x53,%esi
+  80031e:	48 bf 4f 56 80 00 00 	movabs $0x80564f,%rdi
+  800325:	00 00 00 
+  800328:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032d:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  800334:	00 00 00 
+  800337:	41 ff d0             	call   *%r8
+    return 0;
+  80033a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033f:	eb b9                	jmp    8002fa <ide_write+0xcf>
+
+0000000000800341 <bc_pgfault>:
+
+/* Fault any disk block that is read in to memory by
+ * loading it from disk. */
+static bool
+bc_pgfault(struct UTrapframe *utf) {
+    void *addr = (void *)utf->utf_fault_va;
+  800341:	48 8b 17             	mov    (%rdi),%rdx
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  800344:	48 8d ba 00 00 00 f0 	lea    -0x10000000(%rdx),%rdi
+
+    /* Check that the fault was within the block cache region */
+    if (addr < (void *)DISKMAP || addr >= (void *)(DISKMAP + DISKSIZE)) return 0;
+  80034b:	b8 ff ff ff bf       	mov    $0xbfffffff,%eax
+  800350:	48 39 f8             	cmp    %rdi,%rax
+  800353:	0f 82 fd 00 00 00    	jb     800456 <bc_pgfault+0x115>
+bc_pgfault(struct UTrapframe *utf) {
+  800359:	55                   	push   %rbp
+  80035a:	48 89 e5             	mov    %rsp,%rbp
+  80035d:	41 54                	push   %r12
+  80035f:	53                   	push   %rbx
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  800360:	48 c1 ef 0c          	shr    $0xc,%rdi
+  800364:	49 89 fc             	mov    %rdi,%r12
+  800367:	89 f9                	mov    %edi,%ecx
+
+    /* Sanity check the block number. */
+    if (super && blockno >= super->s_nblocks)
+  800369:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  800370:	00 00 00 
+  800373:	48 85 c0             	test   %rax,%rax
+  800376:	74 09                	je     800381 <bc_pgfault+0x40>
+  800378:	44 8b 40 04          	mov    0x4(%rax),%r8d
+  80037c:	44 39 c7             	cmp    %r8d,%edi
+  80037f:	73 56                	jae    8003d7 <bc_pgfault+0x96>
+    /* Allocate a page in the disk map region, read the contents
+     * of the block from the disk into that page.
+     * Hint: first round addr to page boundary. fs/ide.c has code to read
+     * the disk. */
+    // LAB 10: Your code here
+    addr = ROUNDDOWN(addr, PAGE_SIZE);
+  800381:	48 89 d3             	mov    %rdx,%rbx
+  800384:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    if (sys_alloc_region(CURENVID, addr, PAGE_SIZE, PROT_RW | PTE_U | PTE_P))
+  80038b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  800390:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800395:	48 89 de             	mov    %rbx,%rsi
+  800398:	bf 00 00 00 00       	mov    $0x0,%edi
+  80039d:	48 b8 cf 36 80 00 00 	movabs $0x8036cf,%rax
+  8003a4:	00 00 00 
+  8003a7:	ff d0                	call   *%rax
+  8003a9:	85 c0                	test   %eax,%eax
+  8003ab:	75 55                	jne    800402 <bc_pgfault+0xc1>
+        panic("bc_pgfault: failed to alloc");
+
+    if (ide_read(blockno * BLKSECTS, addr, BLKSECTS))
+  8003ad:	42 8d 3c e5 00 00 00 	lea    0x0(,%r12,8),%edi
+  8003b4:	00 
+  8003b5:	ba 08 00 00 00       	mov    $0x8,%edx
+  8003ba:	48 89 de             	mov    %rbx,%rsi
+  8003bd:	48 b8 15 01 80 00 00 	movabs $0x800115,%rax
+  8003c4:	00 00 00 
+  8003c7:	ff d0                	call   *%rax
+  8003c9:	85 c0                	test   %eax,%eax
+  8003cb:	75 5f                	jne    80042c <bc_pgfault+0xeb>
+        panic("bc_pgfault: failed to read");
+
+    return 1;
+  8003cd:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8003d2:	5b                   	pop    %rbx
+  8003d3:	41 5c                	pop    %r12
+  8003d5:	5d                   	pop    %rbp
+  8003d6:	c3                   	ret
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+  8003d7:	48 ba 80 56 80 00 00 	movabs $0x805680,%rdx
+  8003de:	00 00 00 
+  8003e1:	be 1c 00 00 00       	mov    $0x1c,%esi
+  8003e6:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  8003ed:	00 00 00 
+  8003f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f5:	49 b9 aa 26 80 00 00 	movabs $0x8026aa,%r9
+  8003fc:	00 00 00 
+  8003ff:	41 ff d1             	call   *%r9
+        panic("bc_pgfault: failed to alloc");
+  800402:	48 ba 04 57 80 00 00 	movabs $0x805704,%rdx
+  800409:	00 00 00 
+  80040c:	be 25 00 00 00       	mov    $0x25,%esi
+  800411:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  800418:	00 00 00 
+  80041b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800420:	48 b9 aa 26 80 00 00 	movabs $0x8026aa,%rcx
+  800427:	00 00 00 
+  80042a:	ff d1                	call   *%rcx
+        panic("bc_pgfault: failed to read");
+  80042c:	48 ba 20 57 80 00 00 	movabs $0x805720,%rdx
+  800433:	00 00 00 
+  800436:	be 28 00 00 00       	mov    $0x28,%esi
+  80043b:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  800442:	00 00 00 
+  800445:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044a:	48 b9 aa 26 80 00 00 	movabs $0x8026aa,%rcx
+  800451:	00 00 00 
+  800454:	ff d1                	call   *%rcx
+    if (addr < (void *)DISKMAP || addr >= (void *)(DISKMAP + DISKSIZE)) return 0;
+  800456:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80045b:	c3                   	ret
+
+000000000080045c <diskaddr>:
+    if (blockno == 0 || (super && blockno >= super->s_nblocks))
+  80045c:	85 ff                	test   %edi,%edi
+  80045e:	74 21                	je     800481 <diskaddr+0x25>
+  800460:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  800467:	00 00 00 
+  80046a:	48 85 c0             	test   %rax,%rax
+  80046d:	74 05                	je     800474 <diskaddr+0x18>
+  80046f:	3b 78 04             	cmp    0x4(%rax),%edi
+  800472:	73 0d                	jae    800481 <diskaddr+0x25>
+    void *r = (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  800474:	89 f8                	mov    %edi,%eax
+  800476:	48 05 00 00 01 00    	add    $0x10000,%rax
+  80047c:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800480:	c3                   	ret
+diskaddr(uint32_t blockno) {
+  800481:	55                   	push   %rbp
+  800482:	48 89 e5             	mov    %rsp,%rbp
+        panic("bad block number %08x in diskaddr", blockno);
+  800485:	89 f9                	mov    %edi,%ecx
+  800487:	48 ba b0 56 80 00 00 	movabs $0x8056b0,%rdx
+  80048e:	00 00 00 
+  800491:	be 08 00 00 00       	mov    $0x8,%esi
+  800496:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  80049d:	00 00 00 
+  8004a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a5:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  8004ac:	00 00 00 
+  8004af:	41 ff d0             	call   *%r8
+
+00000000008004b2 <flush_block>:
+ * nothing.
+ * Hint: Use is_page_present, is_page_dirty, and ide_write.
+ * Hint: Use the PTE_SYSCALL constant when calling sys_page_map.
+ * Hint: Don't forget to round addr down. */
+void
+flush_block(void *addr) {
+  8004b2:	55                   	push   %rbp
+  8004b3:	48 89 e5             	mov    %rsp,%rbp
+  8004b6:	41 54                	push   %r12
+  8004b8:	53                   	push   %rbx
+  8004b9:	48 89 fb             	mov    %rdi,%rbx
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  8004bc:	48 8d 87 00 00 00 f0 	lea    -0x10000000(%rdi),%rax
+  8004c3:	49 89 c4             	mov    %rax,%r12
+  8004c6:	49 c1 ec 0c          	shr    $0xc,%r12
+
+    if (addr < (void *)(uintptr_t)DISKMAP || addr >= (void *)(uintptr_t)(DISKMAP + DISKSIZE))
+  8004ca:	ba ff ff ff bf       	mov    $0xbfffffff,%edx
+  8004cf:	48 39 c2             	cmp    %rax,%rdx
+  8004d2:	72 3f                	jb     800513 <flush_block+0x61>
+  8004d4:	44 89 e1             	mov    %r12d,%ecx
+        panic("flush_block of bad va %p", addr);
+    if (blockno && super && blockno >= super->s_nblocks)
+  8004d7:	45 85 e4             	test   %r12d,%r12d
+  8004da:	74 18                	je     8004f4 <flush_block+0x42>
+  8004dc:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  8004e3:	00 00 00 
+  8004e6:	48 85 c0             	test   %rax,%rax
+  8004e9:	74 09                	je     8004f4 <flush_block+0x42>
+  8004eb:	44 8b 40 04          	mov    0x4(%rax),%r8d
+  8004ef:	45 39 c4             	cmp    %r8d,%r12d
+  8004f2:	73 4d                	jae    800541 <flush_block+0x8f>
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+
+    // LAB 10: Your code here.
+    addr = ROUNDDOWN(addr, PAGE_SIZE);
+  8004f4:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+
+    if (!is_page_present(addr))
+  8004fb:	48 89 df             	mov    %rbx,%rdi
+  8004fe:	48 b8 7e 51 80 00 00 	movabs $0x80517e,%rax
+  800505:	00 00 00 
+  800508:	ff d0                	call   *%rax
+  80050a:	84 c0                	test   %al,%al
+  80050c:	75 5e                	jne    80056c <flush_block+0xba>
+
+    if (sys_map_region(CURENVID, addr, CURENVID, addr, PAGE_SIZE, get_uvpt_entry(addr) & PTE_SYSCALL))
+        panic("flush_block: failed to map");
+
+    assert(!is_page_dirty(addr));
+}
+  80050e:	5b                   	pop    %rbx
+  80050f:	41 5c                	pop    %r12
+  800511:	5d                   	pop    %rbp
+  800512:	c3                   	ret
+        panic("flush_block of bad va %p", addr);
+  800513:	48 89 f9             	mov    %rdi,%rcx
+  800516:	48 ba 3b 57 80 00 00 	movabs $0x80573b,%rdx
+  80051d:	00 00 00 
+  800520:	be 39 00 00 00       	mov    $0x39,%esi
+  800525:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  80052c:	00 00 00 
+  80052f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800534:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  80053b:	00 00 00 
+  80053e:	41 ff d0             	call   *%r8
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+  800541:	48 ba 80 56 80 00 00 	movabs $0x805680,%rdx
+  800548:	00 00 00 
+  80054b:	be 3b 00 00 00       	mov    $0x3b,%esi
+  800550:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  800557:	00 00 00 
+  80055a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055f:	49 b9 aa 26 80 00 00 	movabs $0x8026aa,%r9
+  800566:	00 00 00 
+  800569:	41 ff d1             	call   *%r9
+    if (!is_page_dirty(addr))
+  80056c:	48 89 df             	mov    %rbx,%rdi
+  80056f:	48 b8 65 51 80 00 00 	movabs $0x805165,%rax
+  800576:	00 00 00 
+  800579:	ff d0                	call   *%rax
+  80057b:	84 c0                	test   %al,%al
+  80057d:	74 8f                	je     80050e <flush_block+0x5c>
+    if (ide_write(blockno * BLKSECTS, addr, BLKSECTS))
+  80057f:	42 8d 3c e5 00 00 00 	lea    0x0(,%r12,8),%edi
+  800586:	00 
+  800587:	ba 08 00 00 00       	mov    $0x8,%edx
+  80058c:	48 89 de             	mov    %rbx,%rsi
+  80058f:	48 b8 2b 02 80 00 00 	movabs $0x80022b,%rax
+  800596:	00 00 00 
+  800599:	ff d0                	call   *%rax
+  80059b:	85 c0                	test   %eax,%eax
+  80059d:	0f 85 8b 00 00 00    	jne    80062e <flush_block+0x17c>
+    if (sys_map_region(CURENVID, addr, CURENVID, addr, PAGE_SIZE, get_uvpt_entry(addr) & PTE_SYSCALL))
+  8005a3:	48 89 df             	mov    %rbx,%rdi
+  8005a6:	48 b8 6b 50 80 00 00 	movabs $0x80506b,%rax
+  8005ad:	00 00 00 
+  8005b0:	ff d0                	call   *%rax
+  8005b2:	41 89 c1             	mov    %eax,%r9d
+  8005b5:	41 81 e1 07 0e 00 00 	and    $0xe07,%r9d
+  8005bc:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8005c2:	48 89 d9             	mov    %rbx,%rcx
+  8005c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ca:	48 89 de             	mov    %rbx,%rsi
+  8005cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005d2:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  8005d9:	00 00 00 
+  8005dc:	ff d0                	call   *%rax
+  8005de:	85 c0                	test   %eax,%eax
+  8005e0:	75 76                	jne    800658 <flush_block+0x1a6>
+    assert(!is_page_dirty(addr));
+  8005e2:	48 89 df             	mov    %rbx,%rdi
+  8005e5:	48 b8 65 51 80 00 00 	movabs $0x805165,%rax
+  8005ec:	00 00 00 
+  8005ef:	ff d0                	call   *%rax
+  8005f1:	84 c0                	test   %al,%al
+  8005f3:	0f 84 15 ff ff ff    	je     80050e <flush_block+0x5c>
+  8005f9:	48 b9 8c 57 80 00 00 	movabs $0x80578c,%rcx
+  800600:	00 00 00 
+  800603:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  80060a:	00 00 00 
+  80060d:	be 4c 00 00 00       	mov    $0x4c,%esi
+  800612:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  800619:	00 00 00 
+  80061c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800621:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  800628:	00 00 00 
+  80062b:	41 ff d0             	call   *%r8
+        panic("flush_block: failed to write");
+  80062e:	48 ba 54 57 80 00 00 	movabs $0x805754,%rdx
+  800635:	00 00 00 
+  800638:	be 47 00 00 00       	mov    $0x47,%esi
+  80063d:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  800644:	00 00 00 
+  800647:	b8 00 00 00 00       	mov    $0x0,%eax
+  80064c:	48 b9 aa 26 80 00 00 	movabs $0x8026aa,%rcx
+  800653:	00 00 00 
+  800656:	ff d1                	call   *%rcx
+        panic("flush_block: failed to map");
+  800658:	48 ba 71 57 80 00 00 	movabs $0x805771,%rdx
+  80065f:	00 00 00 
+  800662:	be 4a 00 00 00       	mov    $0x4a,%esi
+  800667:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  80066e:	00 00 00 
+  800671:	b8 00 00 00 00       	mov    $0x0,%eax
+  800676:	48 b9 aa 26 80 00 00 	movabs $0x8026aa,%rcx
+  80067d:	00 00 00 
+  800680:	ff d1                	call   *%rcx
+
+0000000000800682 <bc_init>:
+
+    cprintf("block cache is good\n");
+}
+
+void
+bc_init(void) {
+  800682:	55                   	push   %rbp
+  800683:	48 89 e5             	mov    %rsp,%rbp
+  800686:	41 54                	push   %r12
+  800688:	53                   	push   %rbx
+  800689:	48 81 ec 10 02 00 00 	sub    $0x210,%rsp
+    struct Super super;
+    add_pgfault_handler(bc_pgfault);
+  800690:	48 bf 41 03 80 00 00 	movabs $0x800341,%rdi
+  800697:	00 00 00 
+  80069a:	48 b8 fb 3c 80 00 00 	movabs $0x803cfb,%rax
+  8006a1:	00 00 00 
+  8006a4:	ff d0                	call   *%rax
+    memmove(&backup, diskaddr(1), sizeof backup);
+  8006a6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8006ab:	48 bb 5c 04 80 00 00 	movabs $0x80045c,%rbx
+  8006b2:	00 00 00 
+  8006b5:	ff d3                	call   *%rbx
+  8006b7:	48 89 c6             	mov    %rax,%rsi
+  8006ba:	ba 08 01 00 00       	mov    $0x108,%edx
+  8006bf:	48 8d bd e0 fd ff ff 	lea    -0x220(%rbp),%rdi
+  8006c6:	48 b8 19 33 80 00 00 	movabs $0x803319,%rax
+  8006cd:	00 00 00 
+  8006d0:	ff d0                	call   *%rax
+    strcpy(diskaddr(1), "OOPS!\n");
+  8006d2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8006d7:	ff d3                	call   *%rbx
+  8006d9:	48 89 c7             	mov    %rax,%rdi
+  8006dc:	48 be a1 57 80 00 00 	movabs $0x8057a1,%rsi
+  8006e3:	00 00 00 
+  8006e6:	48 b8 1f 31 80 00 00 	movabs $0x80311f,%rax
+  8006ed:	00 00 00 
+  8006f0:	ff d0                	call   *%rax
+    flush_block(diskaddr(1));
+  8006f2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8006f7:	ff d3                	call   *%rbx
+  8006f9:	48 89 c7             	mov    %rax,%rdi
+  8006fc:	48 b8 b2 04 80 00 00 	movabs $0x8004b2,%rax
+  800703:	00 00 00 
+  800706:	ff d0                	call   *%rax
+    assert(is_page_present(diskaddr(1)));
+  800708:	bf 01 00 00 00       	mov    $0x1,%edi
+  80070d:	ff d3                	call   *%rbx
+  80070f:	48 89 c7             	mov    %rax,%rdi
+  800712:	48 b8 7e 51 80 00 00 	movabs $0x80517e,%rax
+  800719:	00 00 00 
+  80071c:	ff d0                	call   *%rax
+  80071e:	84 c0                	test   %al,%al
+  800720:	0f 84 25 01 00 00    	je     80084b <bc_init+0x1c9>
+    assert(!is_page_dirty(diskaddr(1)));
+  800726:	bf 01 00 00 00       	mov    $0x1,%edi
+  80072b:	48 b8 5c 04 80 00 00 	movabs $0x80045c,%rax
+  800732:	00 00 00 
+  800735:	ff d0                	call   *%rax
+  800737:	48 89 c7             	mov    %rax,%rdi
+  80073a:	48 b8 65 51 80 00 00 	movabs $0x805165,%rax
+  800741:	00 00 00 
+  800744:	ff d0                	call   *%rax
+  800746:	84 c0                	test   %al,%al
+  800748:	0f 85 2d 01 00 00    	jne    80087b <bc_init+0x1f9>
+    sys_unmap_region(0, diskaddr(1), PAGE_SIZE);
+  80074e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800753:	48 bb 5c 04 80 00 00 	movabs $0x80045c,%rbx
+  80075a:	00 00 00 
+  80075d:	ff d3                	call   *%rbx
+  80075f:	48 89 c6             	mov    %rax,%rsi
+  800762:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800767:	bf 00 00 00 00       	mov    $0x0,%edi
+  80076c:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  800773:	00 00 00 
+  800776:	ff d0                	call   *%rax
+    assert(!is_page_present(diskaddr(1)));
+  800778:	bf 01 00 00 00       	mov    $0x1,%edi
+  80077d:	ff d3                	call   *%rbx
+  80077f:	48 89 c7             	mov    %rax,%rdi
+  800782:	48 b8 7e 51 80 00 00 	movabs $0x80517e,%rax
+  800789:	00 00 00 
+  80078c:	ff d0                	call   *%rax
+  80078e:	84 c0                	test   %al,%al
+  800790:	0f 85 1a 01 00 00    	jne    8008b0 <bc_init+0x22e>
+    assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  800796:	bf 01 00 00 00       	mov    $0x1,%edi
+  80079b:	48 b8 5c 04 80 00 00 	movabs $0x80045c,%rax
+  8007a2:	00 00 00 
+  8007a5:	ff d0                	call   *%rax
+  8007a7:	48 89 c7             	mov    %rax,%rdi
+  8007aa:	48 be a1 57 80 00 00 	movabs $0x8057a1,%rsi
+  8007b1:	00 00 00 
+  8007b4:	48 b8 c3 31 80 00 00 	movabs $0x8031c3,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+  8007c0:	85 c0                	test   %eax,%eax
+  8007c2:	0f 85 1d 01 00 00    	jne    8008e5 <bc_init+0x263>
+    memmove(diskaddr(1), &backup, sizeof backup);
+  8007c8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8007cd:	48 bb 5c 04 80 00 00 	movabs $0x80045c,%rbx
+  8007d4:	00 00 00 
+  8007d7:	ff d3                	call   *%rbx
+  8007d9:	48 89 c7             	mov    %rax,%rdi
+  8007dc:	ba 08 01 00 00       	mov    $0x108,%edx
+  8007e1:	48 8d b5 e0 fd ff ff 	lea    -0x220(%rbp),%rsi
+  8007e8:	49 bc 19 33 80 00 00 	movabs $0x803319,%r12
+  8007ef:	00 00 00 
+  8007f2:	41 ff d4             	call   *%r12
+    flush_block(diskaddr(1));
+  8007f5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8007fa:	ff d3                	call   *%rbx
+  8007fc:	48 89 c7             	mov    %rax,%rdi
+  8007ff:	48 b8 b2 04 80 00 00 	movabs $0x8004b2,%rax
+  800806:	00 00 00 
+  800809:	ff d0                	call   *%rax
+    cprintf("block cache is good\n");
+  80080b:	48 bf e2 57 80 00 00 	movabs $0x8057e2,%rdi
+  800812:	00 00 00 
+  800815:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081a:	48 ba fa 27 80 00 00 	movabs $0x8027fa,%rdx
+  800821:	00 00 00 
+  800824:	ff d2                	call   *%rdx
+    check_bc();
+
+    /* Cache the super block by reading it once */
+    memmove(&super, diskaddr(1), sizeof super);
+  800826:	bf 01 00 00 00       	mov    $0x1,%edi
+  80082b:	ff d3                	call   *%rbx
+  80082d:	48 89 c6             	mov    %rax,%rsi
+  800830:	ba 08 01 00 00       	mov    $0x108,%edx
+  800835:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  80083c:	41 ff d4             	call   *%r12
+}
+  80083f:	48 81 c4 10 02 00 00 	add    $0x210,%rsp
+  800846:	5b                   	pop    %rbx
+  800847:	41 5c                	pop    %r12
+  800849:	5d                   	pop    %rbp
+  80084a:	c3                   	ret
+    assert(is_page_present(diskaddr(1)));
+  80084b:	48 b9 c5 57 80 00 00 	movabs $0x8057c5,%rcx
+  800852:	00 00 00 
+  800855:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  80085c:	00 00 00 
+  80085f:	be 5b 00 00 00       	mov    $0x5b,%esi
+  800864:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  80086b:	00 00 00 
+  80086e:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  800875:	00 00 00 
+  800878:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(diskaddr(1)));
+  80087b:	48 b9 a8 57 80 00 00 	movabs $0x8057a8,%rcx
+  800882:	00 00 00 
+  800885:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  80088c:	00 00 00 
+  80088f:	be 5c 00 00 00       	mov    $0x5c,%esi
+  800894:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  80089b:	00 00 00 
+  80089e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a3:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  8008aa:	00 00 00 
+  8008ad:	41 ff d0             	call   *%r8
+    assert(!is_page_present(diskaddr(1)));
+  8008b0:	48 b9 c4 57 80 00 00 	movabs $0x8057c4,%rcx
+  8008b7:	00 00 00 
+  8008ba:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  8008c1:	00 00 00 
+  8008c4:	be 60 00 00 00       	mov    $0x60,%esi
+  8008c9:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  8008d0:	00 00 00 
+  8008d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d8:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  8008df:	00 00 00 
+  8008e2:	41 ff d0             	call   *%r8
+    assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  8008e5:	48 b9 d8 56 80 00 00 	movabs $0x8056d8,%rcx
+  8008ec:	00 00 00 
+  8008ef:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  8008f6:	00 00 00 
+  8008f9:	be 63 00 00 00       	mov    $0x63,%esi
+  8008fe:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  800905:	00 00 00 
+  800908:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090d:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  800914:	00 00 00 
+  800917:	41 ff d0             	call   *%r8
+
+000000000080091a <check_super>:
+ *                         Super block
+ ****************************************************************/
+
+/* Validate the file system super-block. */
+void
+check_super(void) {
+  80091a:	55                   	push   %rbp
+  80091b:	48 89 e5             	mov    %rsp,%rbp
+    if (super->s_magic != FS_MAGIC)
+  80091e:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  800925:	00 00 00 
+  800928:	8b 08                	mov    (%rax),%ecx
+  80092a:	81 f9 ae 30 05 4a    	cmp    $0x4a0530ae,%ecx
+  800930:	75 26                	jne    800958 <check_super+0x3e>
+        panic("bad file system magic number %08x", super->s_magic);
+
+    if (super->s_nblocks > DISKSIZE / BLKSIZE)
+  800932:	81 78 04 00 00 0c 00 	cmpl   $0xc0000,0x4(%rax)
+  800939:	77 48                	ja     800983 <check_super+0x69>
+        panic("file system is too large");
+
+    cprintf("superblock is good\n");
+  80093b:	48 bf 3b 58 80 00 00 	movabs $0x80583b,%rdi
+  800942:	00 00 00 
+  800945:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094a:	48 ba fa 27 80 00 00 	movabs $0x8027fa,%rdx
+  800951:	00 00 00 
+  800954:	ff d2                	call   *%rdx
+}
+  800956:	5d                   	pop    %rbp
+  800957:	c3                   	ret
+        panic("bad file system magic number %08x", super->s_magic);
+  800958:	48 ba f8 57 80 00 00 	movabs $0x8057f8,%rdx
+  80095f:	00 00 00 
+  800962:	be 13 00 00 00       	mov    $0x13,%esi
+  800967:	48 bf 1a 58 80 00 00 	movabs $0x80581a,%rdi
+  80096e:	00 00 00 
+  800971:	b8 00 00 00 00       	mov    $0x0,%eax
+  800976:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  80097d:	00 00 00 
+  800980:	41 ff d0             	call   *%r8
+        panic("file system is too large");
+  800983:	48 ba 22 58 80 00 00 	movabs $0x805822,%rdx
+  80098a:	00 00 00 
+  80098d:	be 16 00 00 00       	mov    $0x16,%esi
+  800992:	48 bf 1a 58 80 00 00 	movabs $0x80581a,%rdi
+  800999:	00 00 00 
+  80099c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a1:	48 b9 aa 26 80 00 00 	movabs $0x8026aa,%rcx
+  8009a8:	00 00 00 
+  8009ab:	ff d1                	call   *%rcx
+
+00000000008009ad <block_is_free>:
+
+/* Check to see if the block bitmap indicates that block 'blockno' is free.
+ * Return 1 if the block is free, 0 if not. */
+bool
+block_is_free(uint32_t blockno) {
+    if (super == 0 || blockno >= super->s_nblocks) return 0;
+  8009ad:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  8009b4:	00 00 00 
+  8009b7:	48 85 c0             	test   %rax,%rax
+  8009ba:	74 2d                	je     8009e9 <block_is_free+0x3c>
+  8009bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009c1:	3b 78 04             	cmp    0x4(%rax),%edi
+  8009c4:	73 20                	jae    8009e6 <block_is_free+0x39>
+    if (TSTBIT(bitmap, blockno)) return 1;
+  8009c6:	89 fe                	mov    %edi,%esi
+  8009c8:	c1 ee 05             	shr    $0x5,%esi
+  8009cb:	89 f6                	mov    %esi,%esi
+  8009cd:	ba 01 00 00 00       	mov    $0x1,%edx
+  8009d2:	89 f9                	mov    %edi,%ecx
+  8009d4:	d3 e2                	shl    %cl,%edx
+  8009d6:	48 a1 00 c0 80 00 00 	movabs 0x80c000,%rax
+  8009dd:	00 00 00 
+  8009e0:	23 14 b0             	and    (%rax,%rsi,4),%edx
+  8009e3:	0f 95 c2             	setne  %dl
+    return 0;
+}
+  8009e6:	89 d0                	mov    %edx,%eax
+  8009e8:	c3                   	ret
+    if (super == 0 || blockno >= super->s_nblocks) return 0;
+  8009e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009ee:	eb f6                	jmp    8009e6 <block_is_free+0x39>
+
+00000000008009f0 <free_block>:
+
+/* Mark a block free in the bitmap */
+void
+free_block(uint32_t blockno) {
+    /* Blockno zero is the null pointer of block numbers. */
+    if (blockno == 0) panic("attempt to free zero block");
+  8009f0:	85 ff                	test   %edi,%edi
+  8009f2:	74 1e                	je     800a12 <free_block+0x22>
+    SETBIT(bitmap, blockno);
+  8009f4:	89 fa                	mov    %edi,%edx
+  8009f6:	c1 ea 05             	shr    $0x5,%edx
+  8009f9:	89 d2                	mov    %edx,%edx
+  8009fb:	48 a1 00 c0 80 00 00 	movabs 0x80c000,%rax
+  800a02:	00 00 00 
+  800a05:	be 01 00 00 00       	mov    $0x1,%esi
+  800a0a:	89 f9                	mov    %edi,%ecx
+  800a0c:	d3 e6                	shl    %cl,%esi
+  800a0e:	09 34 90             	or     %esi,(%rax,%rdx,4)
+  800a11:	c3                   	ret
+free_block(uint32_t blockno) {
+  800a12:	55                   	push   %rbp
+  800a13:	48 89 e5             	mov    %rsp,%rbp
+    if (blockno == 0) panic("attempt to free zero block");
+  800a16:	48 ba 4f 58 80 00 00 	movabs $0x80584f,%rdx
+  800a1d:	00 00 00 
+  800a20:	be 2c 00 00 00       	mov    $0x2c,%esi
+  800a25:	48 bf 1a 58 80 00 00 	movabs $0x80581a,%rdi
+  800a2c:	00 00 00 
+  800a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a34:	48 b9 aa 26 80 00 00 	movabs $0x8026aa,%rcx
+  800a3b:	00 00 00 
+  800a3e:	ff d1                	call   *%rcx
+
+0000000000800a40 <alloc_block>:
+ * Return block number allocated on success,
+ * 0 if we are out of blocks.
+ *
+ * Hint: use free_block as an example for manipulating the bitmap. */
+blockno_t
+alloc_block(void) {
+  800a40:	55                   	push   %rbp
+  800a41:	48 89 e5             	mov    %rsp,%rbp
+  800a44:	41 56                	push   %r14
+  800a46:	41 55                	push   %r13
+  800a48:	41 54                	push   %r12
+  800a4a:	53                   	push   %rbx
+    /* The bitmap consists of one or more blocks.  A single bitmap block
+     * contains the in-use bits for BLKBITSIZE blocks.  There are
+     * super->s_nblocks blocks in the disk altogether. */
+
+    // LAB 10: Your code here
+    for (size_t i = 0; i < super->s_nblocks; ++i) {
+  800a4b:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  800a52:	00 00 00 
+  800a55:	44 8b 60 04          	mov    0x4(%rax),%r12d
+  800a59:	45 85 e4             	test   %r12d,%r12d
+  800a5c:	74 68                	je     800ac6 <alloc_block+0x86>
+  800a5e:	45 89 e6             	mov    %r12d,%r14d
+  800a61:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (block_is_free(i)) {
+  800a66:	49 bd ad 09 80 00 00 	movabs $0x8009ad,%r13
+  800a6d:	00 00 00 
+  800a70:	41 89 dc             	mov    %ebx,%r12d
+  800a73:	89 df                	mov    %ebx,%edi
+  800a75:	41 ff d5             	call   *%r13
+  800a78:	84 c0                	test   %al,%al
+  800a7a:	75 11                	jne    800a8d <alloc_block+0x4d>
+    for (size_t i = 0; i < super->s_nblocks; ++i) {
+  800a7c:	48 83 c3 01          	add    $0x1,%rbx
+  800a80:	4c 39 f3             	cmp    %r14,%rbx
+  800a83:	75 eb                	jne    800a70 <alloc_block+0x30>
+            flush_block(bitmap + (i >> sizeof(*bitmap)));
+            return i;
+        }
+    }
+
+    return 0;
+  800a85:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800a8b:	eb 39                	jmp    800ac6 <alloc_block+0x86>
+            CLRBIT(bitmap, i);
+  800a8d:	48 ba 00 c0 80 00 00 	movabs $0x80c000,%rdx
+  800a94:	00 00 00 
+  800a97:	48 89 df             	mov    %rbx,%rdi
+  800a9a:	48 c1 ef 05          	shr    $0x5,%rdi
+  800a9e:	48 8b 32             	mov    (%rdx),%rsi
+  800aa1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800aa6:	89 d9                	mov    %ebx,%ecx
+  800aa8:	d3 e0                	shl    %cl,%eax
+  800aaa:	f7 d0                	not    %eax
+  800aac:	21 04 be             	and    %eax,(%rsi,%rdi,4)
+            flush_block(bitmap + (i >> sizeof(*bitmap)));
+  800aaf:	48 c1 eb 04          	shr    $0x4,%rbx
+  800ab3:	48 8b 02             	mov    (%rdx),%rax
+  800ab6:	48 8d 3c 98          	lea    (%rax,%rbx,4),%rdi
+  800aba:	48 b8 b2 04 80 00 00 	movabs $0x8004b2,%rax
+  800ac1:	00 00 00 
+  800ac4:	ff d0                	call   *%rax
+}
+  800ac6:	44 89 e0             	mov    %r12d,%eax
+  800ac9:	5b                   	pop    %rbx
+  800aca:	41 5c                	pop    %r12
+  800acc:	41 5d                	pop    %r13
+  800ace:	41 5e                	pop    %r14
+  800ad0:	5d                   	pop    %rbp
+  800ad1:	c3                   	ret
+
+0000000000800ad2 <check_bitmap>:
+/* Validate the file system bitmap.
+ *
+ * Check that all reserved blocks -- 0, 1, and the bitmap blocks themselves --
+ * are all marked as in-use. */
+void
+check_bitmap(void) {
+  800ad2:	55                   	push   %rbp
+  800ad3:	48 89 e5             	mov    %rsp,%rbp
+  800ad6:	41 55                	push   %r13
+  800ad8:	41 54                	push   %r12
+  800ada:	53                   	push   %rbx
+  800adb:	48 83 ec 08          	sub    $0x8,%rsp
+
+    /* Make sure all bitmap blocks are marked in-use */
+    for (uint32_t i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  800adf:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  800ae6:	00 00 00 
+  800ae9:	8b 40 04             	mov    0x4(%rax),%eax
+  800aec:	85 c0                	test   %eax,%eax
+  800aee:	74 2a                	je     800b1a <check_bitmap+0x48>
+  800af0:	41 89 c4             	mov    %eax,%r12d
+  800af3:	bb 00 00 00 00       	mov    $0x0,%ebx
+        assert(!block_is_free(2 + i));
+  800af8:	49 bd ad 09 80 00 00 	movabs $0x8009ad,%r13
+  800aff:	00 00 00 
+  800b02:	8d 7b 02             	lea    0x2(%rbx),%edi
+  800b05:	41 ff d5             	call   *%r13
+  800b08:	84 c0                	test   %al,%al
+  800b0a:	75 62                	jne    800b6e <check_bitmap+0x9c>
+    for (uint32_t i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  800b0c:	83 c3 01             	add    $0x1,%ebx
+  800b0f:	89 d8                	mov    %ebx,%eax
+  800b11:	48 c1 e0 0f          	shl    $0xf,%rax
+  800b15:	4c 39 e0             	cmp    %r12,%rax
+  800b18:	7c e8                	jl     800b02 <check_bitmap+0x30>
+
+    /* Make sure the reserved and root blocks are marked in-use. */
+
+    assert(!block_is_free(1));
+  800b1a:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b1f:	48 b8 ad 09 80 00 00 	movabs $0x8009ad,%rax
+  800b26:	00 00 00 
+  800b29:	ff d0                	call   *%rax
+  800b2b:	84 c0                	test   %al,%al
+  800b2d:	75 74                	jne    800ba3 <check_bitmap+0xd1>
+    assert(!block_is_free(0));
+  800b2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b34:	48 b8 ad 09 80 00 00 	movabs $0x8009ad,%rax
+  800b3b:	00 00 00 
+  800b3e:	ff d0                	call   *%rax
+  800b40:	84 c0                	test   %al,%al
+  800b42:	0f 85 90 00 00 00    	jne    800bd8 <check_bitmap+0x106>
+
+    cprintf("bitmap is good\n");
+  800b48:	48 bf a4 58 80 00 00 	movabs $0x8058a4,%rdi
+  800b4f:	00 00 00 
+  800b52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b57:	48 ba fa 27 80 00 00 	movabs $0x8027fa,%rdx
+  800b5e:	00 00 00 
+  800b61:	ff d2                	call   *%rdx
+}
+  800b63:	48 83 c4 08          	add    $0x8,%rsp
+  800b67:	5b                   	pop    %rbx
+  800b68:	41 5c                	pop    %r12
+  800b6a:	41 5d                	pop    %r13
+  800b6c:	5d                   	pop    %rbp
+  800b6d:	c3                   	ret
+        assert(!block_is_free(2 + i));
+  800b6e:	48 b9 6a 58 80 00 00 	movabs $0x80586a,%rcx
+  800b75:	00 00 00 
+  800b78:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  800b7f:	00 00 00 
+  800b82:	be 53 00 00 00       	mov    $0x53,%esi
+  800b87:	48 bf 1a 58 80 00 00 	movabs $0x80581a,%rdi
+  800b8e:	00 00 00 
+  800b91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b96:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  800b9d:	00 00 00 
+  800ba0:	41 ff d0             	call   *%r8
+    assert(!block_is_free(1));
+  800ba3:	48 b9 80 58 80 00 00 	movabs $0x805880,%rcx
+  800baa:	00 00 00 
+  800bad:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  800bb4:	00 00 00 
+  800bb7:	be 57 00 00 00       	mov    $0x57,%esi
+  800bbc:	48 bf 1a 58 80 00 00 	movabs $0x80581a,%rdi
+  800bc3:	00 00 00 
+  800bc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bcb:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  800bd2:	00 00 00 
+  800bd5:	41 ff d0             	call   *%r8
+    assert(!block_is_free(0));
+  800bd8:	48 b9 92 58 80 00 00 	movabs $0x805892,%rcx
+  800bdf:	00 00 00 
+  800be2:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  800be9:	00 00 00 
+  800bec:	be 58 00 00 00       	mov    $0x58,%esi
+  800bf1:	48 bf 1a 58 80 00 00 	movabs $0x80581a,%rdi
+  800bf8:	00 00 00 
+  800bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c00:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  800c07:	00 00 00 
+  800c0a:	41 ff d0             	call   *%r8
+
+0000000000800c0d <fs_init>:
+ *                    File system structures
+ ****************************************************************/
+
+/* Initialize the file system */
+void
+fs_init(void) {
+  800c0d:	55                   	push   %rbp
+  800c0e:	48 89 e5             	mov    %rsp,%rbp
+  800c11:	53                   	push   %rbx
+  800c12:	48 83 ec 08          	sub    $0x8,%rsp
+    static_assert(sizeof(struct File) == 256, "Unsupported file size");
+
+    /* Find a JOS disk.  Use the second IDE disk (number 1) if availabl */
+    if (ide_probe_disk1())
+  800c16:	48 b8 4c 00 80 00 00 	movabs $0x80004c,%rax
+  800c1d:	00 00 00 
+  800c20:	ff d0                	call   *%rax
+  800c22:	84 c0                	test   %al,%al
+  800c24:	74 67                	je     800c8d <fs_init+0x80>
+        ide_set_disk(1);
+  800c26:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c2b:	48 b8 d6 00 80 00 00 	movabs $0x8000d6,%rax
+  800c32:	00 00 00 
+  800c35:	ff d0                	call   *%rax
+    else
+        ide_set_disk(0);
+    bc_init();
+  800c37:	48 b8 82 06 80 00 00 	movabs $0x800682,%rax
+  800c3e:	00 00 00 
+  800c41:	ff d0                	call   *%rax
+
+    /* Set "super" to point to the super block. */
+    super = diskaddr(1);
+  800c43:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c48:	48 bb 5c 04 80 00 00 	movabs $0x80045c,%rbx
+  800c4f:	00 00 00 
+  800c52:	ff d3                	call   *%rbx
+  800c54:	48 a3 08 c0 80 00 00 	movabs %rax,0x80c008
+  800c5b:	00 00 00 
+    check_super();
+  800c5e:	48 b8 1a 09 80 00 00 	movabs $0x80091a,%rax
+  800c65:	00 00 00 
+  800c68:	ff d0                	call   *%rax
+
+    /* Set "bitmap" to the beginning of the first bitmap block. */
+    bitmap = diskaddr(2);
+  800c6a:	bf 02 00 00 00       	mov    $0x2,%edi
+  800c6f:	ff d3                	call   *%rbx
+  800c71:	48 a3 00 c0 80 00 00 	movabs %rax,0x80c000
+  800c78:	00 00 00 
+
+    check_bitmap();
+  800c7b:	48 b8 d2 0a 80 00 00 	movabs $0x800ad2,%rax
+  800c82:	00 00 00 
+  800c85:	ff d0                	call   *%rax
+}
+  800c87:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c8b:	c9                   	leave
+  800c8c:	c3                   	ret
+        ide_set_disk(0);
+  800c8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c92:	48 b8 d6 00 80 00 00 	movabs $0x8000d6,%rax
+  800c99:	00 00 00 
+  800c9c:	ff d0                	call   *%rax
+  800c9e:	eb 97                	jmp    800c37 <fs_init+0x2a>
+
+0000000000800ca0 <file_block_walk>:
+ * Hint: Don't forget to clear any block you allocate. */
+int
+file_block_walk(struct File *f, blockno_t filebno, blockno_t **ppdiskbno, bool alloc) {
+    // LAB 10: Your code here
+
+    if (filebno >= NDIRECT + NINDIRECT)
+  800ca0:	81 fe 09 04 00 00    	cmp    $0x409,%esi
+  800ca6:	0f 87 c2 00 00 00    	ja     800d6e <file_block_walk+0xce>
+file_block_walk(struct File *f, blockno_t filebno, blockno_t **ppdiskbno, bool alloc) {
+  800cac:	55                   	push   %rbp
+  800cad:	48 89 e5             	mov    %rsp,%rbp
+  800cb0:	41 57                	push   %r15
+  800cb2:	41 56                	push   %r14
+  800cb4:	41 55                	push   %r13
+  800cb6:	41 54                	push   %r12
+  800cb8:	53                   	push   %rbx
+  800cb9:	48 83 ec 08          	sub    $0x8,%rsp
+  800cbd:	49 89 fc             	mov    %rdi,%r12
+  800cc0:	89 f3                	mov    %esi,%ebx
+  800cc2:	49 89 d5             	mov    %rdx,%r13
+        return -E_INVAL;
+
+    if (filebno < NDIRECT) {
+  800cc5:	83 fe 09             	cmp    $0x9,%esi
+  800cc8:	76 72                	jbe    800d3c <file_block_walk+0x9c>
+        *ppdiskbno = f->f_direct + filebno;
+        return 0;
+    }
+
+    if (f->f_indirect) {
+  800cca:	8b bf b0 00 00 00    	mov    0xb0(%rdi),%edi
+  800cd0:	85 ff                	test   %edi,%edi
+  800cd2:	75 7c                	jne    800d50 <file_block_walk+0xb0>
+        uint32_t * p = diskaddr(f->f_indirect);
+        *ppdiskbno = p + filebno - NDIRECT;
+        return 0;
+    }
+
+    if (!alloc)
+  800cd4:	84 c9                	test   %cl,%cl
+  800cd6:	0f 84 98 00 00 00    	je     800d74 <file_block_walk+0xd4>
+        return -E_NOT_FOUND;
+
+    blockno_t indirect_block = alloc_block();
+  800cdc:	48 b8 40 0a 80 00 00 	movabs $0x800a40,%rax
+  800ce3:	00 00 00 
+  800ce6:	ff d0                	call   *%rax
+  800ce8:	41 89 c7             	mov    %eax,%r15d
+    if (indirect_block < 0)
+        return -E_NO_DISK;
+
+
+    uint32_t * p = diskaddr(indirect_block);
+  800ceb:	89 c7                	mov    %eax,%edi
+  800ced:	48 b8 5c 04 80 00 00 	movabs $0x80045c,%rax
+  800cf4:	00 00 00 
+  800cf7:	ff d0                	call   *%rax
+  800cf9:	49 89 c6             	mov    %rax,%r14
+    memset(p, 0, BLKSIZE);
+  800cfc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800d01:	be 00 00 00 00       	mov    $0x0,%esi
+  800d06:	48 89 c7             	mov    %rax,%rdi
+  800d09:	48 b8 6b 32 80 00 00 	movabs $0x80326b,%rax
+  800d10:	00 00 00 
+  800d13:	ff d0                	call   *%rax
+    f->f_indirect = indirect_block;
+  800d15:	45 89 bc 24 b0 00 00 	mov    %r15d,0xb0(%r12)
+  800d1c:	00 
+    *ppdiskbno = p + filebno - NDIRECT;
+  800d1d:	89 db                	mov    %ebx,%ebx
+  800d1f:	49 8d 44 9e d8       	lea    -0x28(%r14,%rbx,4),%rax
+  800d24:	49 89 45 00          	mov    %rax,0x0(%r13)
+
+    return 0;
+  800d28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d2d:	48 83 c4 08          	add    $0x8,%rsp
+  800d31:	5b                   	pop    %rbx
+  800d32:	41 5c                	pop    %r12
+  800d34:	41 5d                	pop    %r13
+  800d36:	41 5e                	pop    %r14
+  800d38:	41 5f                	pop    %r15
+  800d3a:	5d                   	pop    %rbp
+  800d3b:	c3                   	ret
+        *ppdiskbno = f->f_direct + filebno;
+  800d3c:	89 f3                	mov    %esi,%ebx
+  800d3e:	48 8d 84 9f 88 00 00 	lea    0x88(%rdi,%rbx,4),%rax
+  800d45:	00 
+  800d46:	48 89 02             	mov    %rax,(%rdx)
+        return 0;
+  800d49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4e:	eb dd                	jmp    800d2d <file_block_walk+0x8d>
+        uint32_t * p = diskaddr(f->f_indirect);
+  800d50:	48 b8 5c 04 80 00 00 	movabs $0x80045c,%rax
+  800d57:	00 00 00 
+  800d5a:	ff d0                	call   *%rax
+        *ppdiskbno = p + filebno - NDIRECT;
+  800d5c:	89 db                	mov    %ebx,%ebx
+  800d5e:	48 8d 44 98 d8       	lea    -0x28(%rax,%rbx,4),%rax
+  800d63:	49 89 45 00          	mov    %rax,0x0(%r13)
+        return 0;
+  800d67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d6c:	eb bf                	jmp    800d2d <file_block_walk+0x8d>
+        return -E_INVAL;
+  800d6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800d73:	c3                   	ret
+        return -E_NOT_FOUND;
+  800d74:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800d79:	eb b2                	jmp    800d2d <file_block_walk+0x8d>
+
+0000000000800d7b <file_get_block>:
+ *  -E_NO_DISK if a block needed to be allocated but the disk is full.
+ *  -E_INVAL if filebno is out of range.
+ *
+ * Hint: Use file_block_walk and alloc_block. */
+int
+file_get_block(struct File *f, uint32_t filebno, char **blk) {
+  800d7b:	55                   	push   %rbp
+  800d7c:	48 89 e5             	mov    %rsp,%rbp
+  800d7f:	41 55                	push   %r13
+  800d81:	41 54                	push   %r12
+  800d83:	53                   	push   %rbx
+  800d84:	48 83 ec 18          	sub    $0x18,%rsp
+  800d88:	49 89 d4             	mov    %rdx,%r12
+    // LAB 10: Your code here
+
+    uint32_t * pdiskbno;
+    int err = file_block_walk(f, filebno, &pdiskbno, 1);
+  800d8b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d90:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  800d94:	48 b8 a0 0c 80 00 00 	movabs $0x800ca0,%rax
+  800d9b:	00 00 00 
+  800d9e:	ff d0                	call   *%rax
+  800da0:	89 c3                	mov    %eax,%ebx
+    if (err)
+  800da2:	85 c0                	test   %eax,%eax
+  800da4:	75 47                	jne    800ded <file_get_block+0x72>
+        return err;
+
+    if (*pdiskbno) {
+  800da6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800daa:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800dae:	85 ff                	test   %edi,%edi
+  800db0:	75 48                	jne    800dfa <file_get_block+0x7f>
+        *blk = diskaddr(*pdiskbno);
+        return 0;
+    }
+
+    blockno_t new_block = alloc_block();
+  800db2:	48 b8 40 0a 80 00 00 	movabs $0x800a40,%rax
+  800db9:	00 00 00 
+  800dbc:	ff d0                	call   *%rax
+  800dbe:	89 c7                	mov    %eax,%edi
+    if (new_block < 0)
+        return -E_NO_DISK;
+
+    *pdiskbno = new_block;
+  800dc0:	41 89 45 00          	mov    %eax,0x0(%r13)
+    *blk = diskaddr(new_block);
+  800dc4:	48 b8 5c 04 80 00 00 	movabs $0x80045c,%rax
+  800dcb:	00 00 00 
+  800dce:	ff d0                	call   *%rax
+  800dd0:	48 89 c7             	mov    %rax,%rdi
+  800dd3:	49 89 04 24          	mov    %rax,(%r12)
+    memset(*blk, 0, BLKSIZE);
+  800dd7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ddc:	be 00 00 00 00       	mov    $0x0,%esi
+  800de1:	48 b8 6b 32 80 00 00 	movabs $0x80326b,%rax
+  800de8:	00 00 00 
+  800deb:	ff d0                	call   *%rax
+    return 0;
+}
+  800ded:	89 d8                	mov    %ebx,%eax
+  800def:	48 83 c4 18          	add    $0x18,%rsp
+  800df3:	5b                   	pop    %rbx
+  800df4:	41 5c                	pop    %r12
+  800df6:	41 5d                	pop    %r13
+  800df8:	5d                   	pop    %rbp
+  800df9:	c3                   	ret
+        *blk = diskaddr(*pdiskbno);
+  800dfa:	48 b8 5c 04 80 00 00 	movabs $0x80045c,%rax
+  800e01:	00 00 00 
+  800e04:	ff d0                	call   *%rax
+  800e06:	49 89 04 24          	mov    %rax,(%r12)
+        return 0;
+  800e0a:	eb e1                	jmp    800ded <file_get_block+0x72>
+
+0000000000800e0c <walk_path>:
+ * and set *pdir to the directory the file is in.
+ * If we cannot find the file but find the directory
+ * it should be in, set *pdir and copy the final path
+ * element into lastelem. */
+static int
+walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem) {
+  800e0c:	55                   	push   %rbp
+  800e0d:	48 89 e5             	mov    %rsp,%rbp
+  800e10:	41 57                	push   %r15
+  800e12:	41 56                	push   %r14
+  800e14:	41 55                	push   %r13
+  800e16:	41 54                	push   %r12
+  800e18:	53                   	push   %rbx
+  800e19:	48 81 ec c8 00 00 00 	sub    $0xc8,%rsp
+  800e20:	48 89 d3             	mov    %rdx,%rbx
+  800e23:	49 89 cd             	mov    %rcx,%r13
+    while (*p == '/')
+  800e26:	80 3f 2f             	cmpb   $0x2f,(%rdi)
+  800e29:	75 09                	jne    800e34 <walk_path+0x28>
+        p++;
+  800e2b:	48 83 c7 01          	add    $0x1,%rdi
+    while (*p == '/')
+  800e2f:	80 3f 2f             	cmpb   $0x2f,(%rdi)
+  800e32:	74 f7                	je     800e2b <walk_path+0x1f>
+    int r;
+
+    //if (*path != '/')
+    //    return -E_BAD_PATH;
+    path = skip_slash(path);
+    f = &super->s_root;
+  800e34:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  800e3b:	00 00 00 
+  800e3e:	4c 8d 78 08          	lea    0x8(%rax),%r15
+    dir = 0;
+    name[0] = 0;
+  800e42:	c6 85 50 ff ff ff 00 	movb   $0x0,-0xb0(%rbp)
+
+    if (pdir)
+  800e49:	48 85 f6             	test   %rsi,%rsi
+  800e4c:	74 07                	je     800e55 <walk_path+0x49>
+        *pdir = 0;
+  800e4e:	48 c7 06 00 00 00 00 	movq   $0x0,(%rsi)
+    *pf = 0;
+  800e55:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+    dir = 0;
+  800e5c:	ba 00 00 00 00       	mov    $0x0,%edx
+            if (strcmp(f[j].f_name, name) == 0) {
+  800e61:	49 be c3 31 80 00 00 	movabs $0x8031c3,%r14
+  800e68:	00 00 00 
+  800e6b:	48 89 b5 18 ff ff ff 	mov    %rsi,-0xe8(%rbp)
+  800e72:	48 89 fe             	mov    %rdi,%rsi
+  800e75:	4c 89 ad 10 ff ff ff 	mov    %r13,-0xf0(%rbp)
+    while (*path != '\0') {
+  800e7c:	e9 90 00 00 00       	jmp    800f11 <walk_path+0x105>
+        dir = f;
+        p = path;
+        while (*path != '/' && *path != '\0')
+  800e81:	49 89 f4             	mov    %rsi,%r12
+            path++;
+        if (path - p >= MAXNAMELEN)
+  800e84:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800e8a:	e9 b9 00 00 00       	jmp    800f48 <walk_path+0x13c>
+    while (*p == '/')
+  800e8f:	4c 89 e6             	mov    %r12,%rsi
+  800e92:	e9 e9 00 00 00       	jmp    800f80 <walk_path+0x174>
+    assert((dir->f_size % BLKSIZE) == 0);
+  800e97:	48 b9 b4 58 80 00 00 	movabs $0x8058b4,%rcx
+  800e9e:	00 00 00 
+  800ea1:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  800ea8:	00 00 00 
+  800eab:	be d2 00 00 00       	mov    $0xd2,%esi
+  800eb0:	48 bf 1a 58 80 00 00 	movabs $0x80581a,%rdi
+  800eb7:	00 00 00 
+  800eba:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ebf:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  800ec6:	00 00 00 
+  800ec9:	41 ff d0             	call   *%r8
+  800ecc:	48 8b b5 28 ff ff ff 	mov    -0xd8(%rbp),%rsi
+  800ed3:	48 8b 9d 20 ff ff ff 	mov    -0xe0(%rbp),%rbx
+  800eda:	4c 89 bd 38 ff ff ff 	mov    %r15,-0xc8(%rbp)
+  800ee1:	eb 1c                	jmp    800eff <walk_path+0xf3>
+    for (blockno_t i = 0; i < nblock; i++) {
+  800ee3:	4c 89 bd 38 ff ff ff 	mov    %r15,-0xc8(%rbp)
+    return -E_NOT_FOUND;
+  800eea:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800eef:	eb 0e                	jmp    800eff <walk_path+0xf3>
+  800ef1:	48 8b b5 28 ff ff ff 	mov    -0xd8(%rbp),%rsi
+  800ef8:	48 8b 9d 20 ff ff ff 	mov    -0xe0(%rbp),%rbx
+  800eff:	4c 89 fa             	mov    %r15,%rdx
+        path = skip_slash(path);
+
+        if (dir->f_type != FTYPE_DIR)
+            return -E_NOT_FOUND;
+
+        if ((r = dir_lookup(dir, name, &f)) < 0) {
+  800f02:	85 c0                	test   %eax,%eax
+  800f04:	0f 88 48 01 00 00    	js     801052 <walk_path+0x246>
+  800f0a:	4c 8b bd 38 ff ff ff 	mov    -0xc8(%rbp),%r15
+    while (*path != '\0') {
+  800f11:	0f b6 06             	movzbl (%rsi),%eax
+  800f14:	84 c0                	test   %al,%al
+  800f16:	0f 84 80 01 00 00    	je     80109c <walk_path+0x290>
+        while (*path != '/' && *path != '\0')
+  800f1c:	3c 2f                	cmp    $0x2f,%al
+  800f1e:	0f 84 5d ff ff ff    	je     800e81 <walk_path+0x75>
+  800f24:	49 89 f4             	mov    %rsi,%r12
+            path++;
+  800f27:	49 83 c4 01          	add    $0x1,%r12
+        while (*path != '/' && *path != '\0')
+  800f2b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800f30:	3c 2f                	cmp    $0x2f,%al
+  800f32:	74 04                	je     800f38 <walk_path+0x12c>
+  800f34:	84 c0                	test   %al,%al
+  800f36:	75 ef                	jne    800f27 <walk_path+0x11b>
+        if (path - p >= MAXNAMELEN)
+  800f38:	4d 89 e5             	mov    %r12,%r13
+  800f3b:	49 29 f5             	sub    %rsi,%r13
+  800f3e:	49 83 fd 7f          	cmp    $0x7f,%r13
+  800f42:	0f 8f 81 01 00 00    	jg     8010c9 <walk_path+0x2bd>
+        memmove(name, p, path - p);
+  800f48:	4c 89 ea             	mov    %r13,%rdx
+  800f4b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800f52:	48 b8 19 33 80 00 00 	movabs $0x803319,%rax
+  800f59:	00 00 00 
+  800f5c:	ff d0                	call   *%rax
+        name[path - p] = '\0';
+  800f5e:	42 c6 84 2d 50 ff ff 	movb   $0x0,-0xb0(%rbp,%r13,1)
+  800f65:	ff 00 
+    while (*p == '/')
+  800f67:	41 80 3c 24 2f       	cmpb   $0x2f,(%r12)
+  800f6c:	0f 85 1d ff ff ff    	jne    800e8f <walk_path+0x83>
+        p++;
+  800f72:	49 83 c4 01          	add    $0x1,%r12
+    while (*p == '/')
+  800f76:	41 80 3c 24 2f       	cmpb   $0x2f,(%r12)
+  800f7b:	74 f5                	je     800f72 <walk_path+0x166>
+        p++;
+  800f7d:	4c 89 e6             	mov    %r12,%rsi
+        if (dir->f_type != FTYPE_DIR)
+  800f80:	41 83 bf 84 00 00 00 	cmpl   $0x1,0x84(%r15)
+  800f87:	01 
+  800f88:	0f 85 43 01 00 00    	jne    8010d1 <walk_path+0x2c5>
+    assert((dir->f_size % BLKSIZE) == 0);
+  800f8e:	41 8b 97 80 00 00 00 	mov    0x80(%r15),%edx
+  800f95:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+  800f9b:	0f 85 f6 fe ff ff    	jne    800e97 <walk_path+0x8b>
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  800fa1:	8d 82 ff 0f 00 00    	lea    0xfff(%rdx),%eax
+  800fa7:	85 d2                	test   %edx,%edx
+  800fa9:	0f 49 c2             	cmovns %edx,%eax
+    for (blockno_t i = 0; i < nblock; i++) {
+  800fac:	c1 f8 0c             	sar    $0xc,%eax
+  800faf:	89 85 34 ff ff ff    	mov    %eax,-0xcc(%rbp)
+  800fb5:	0f 84 28 ff ff ff    	je     800ee3 <walk_path+0xd7>
+  800fbb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            if (strcmp(f[j].f_name, name) == 0) {
+  800fc1:	48 89 b5 28 ff ff ff 	mov    %rsi,-0xd8(%rbp)
+  800fc8:	48 89 9d 20 ff ff ff 	mov    %rbx,-0xe0(%rbp)
+        int res = file_get_block(dir, i, &blk);
+  800fcf:	48 8d 95 48 ff ff ff 	lea    -0xb8(%rbp),%rdx
+  800fd6:	44 89 e6             	mov    %r12d,%esi
+  800fd9:	4c 89 ff             	mov    %r15,%rdi
+  800fdc:	48 b8 7b 0d 80 00 00 	movabs $0x800d7b,%rax
+  800fe3:	00 00 00 
+  800fe6:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  800fe8:	85 c0                	test   %eax,%eax
+  800fea:	0f 88 dc fe ff ff    	js     800ecc <walk_path+0xc0>
+        for (blockno_t j = 0; j < BLKFILES; j++)
+  800ff0:	48 8b 9d 48 ff ff ff 	mov    -0xb8(%rbp),%rbx
+  800ff7:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+            if (strcmp(f[j].f_name, name) == 0) {
+  800ffe:	48 89 9d 38 ff ff ff 	mov    %rbx,-0xc8(%rbp)
+  801005:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  80100c:	48 89 df             	mov    %rbx,%rdi
+  80100f:	41 ff d6             	call   *%r14
+  801012:	85 c0                	test   %eax,%eax
+  801014:	0f 84 d7 fe ff ff    	je     800ef1 <walk_path+0xe5>
+        for (blockno_t j = 0; j < BLKFILES; j++)
+  80101a:	48 81 c3 00 01 00 00 	add    $0x100,%rbx
+  801021:	4c 39 eb             	cmp    %r13,%rbx
+  801024:	75 d8                	jne    800ffe <walk_path+0x1f2>
+    for (blockno_t i = 0; i < nblock; i++) {
+  801026:	41 83 c4 01          	add    $0x1,%r12d
+  80102a:	44 39 a5 34 ff ff ff 	cmp    %r12d,-0xcc(%rbp)
+  801031:	75 9c                	jne    800fcf <walk_path+0x1c3>
+  801033:	48 8b b5 28 ff ff ff 	mov    -0xd8(%rbp),%rsi
+  80103a:	48 8b 9d 20 ff ff ff 	mov    -0xe0(%rbp),%rbx
+  801041:	4c 89 bd 38 ff ff ff 	mov    %r15,-0xc8(%rbp)
+    return -E_NOT_FOUND;
+  801048:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80104d:	e9 ad fe ff ff       	jmp    800eff <walk_path+0xf3>
+            if (r == -E_NOT_FOUND && *path == '\0') {
+  801052:	41 89 c4             	mov    %eax,%r12d
+  801055:	48 89 f7             	mov    %rsi,%rdi
+  801058:	48 8b b5 18 ff ff ff 	mov    -0xe8(%rbp),%rsi
+  80105f:	4c 8b ad 10 ff ff ff 	mov    -0xf0(%rbp),%r13
+  801066:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801069:	75 49                	jne    8010b4 <walk_path+0x2a8>
+  80106b:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80106e:	75 44                	jne    8010b4 <walk_path+0x2a8>
+                if (pdir)
+  801070:	48 85 f6             	test   %rsi,%rsi
+  801073:	74 03                	je     801078 <walk_path+0x26c>
+                    *pdir = dir;
+  801075:	4c 89 3e             	mov    %r15,(%rsi)
+                if (lastelem)
+  801078:	4d 85 ed             	test   %r13,%r13
+  80107b:	74 16                	je     801093 <walk_path+0x287>
+                    strcpy(lastelem, name);
+  80107d:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  801084:	4c 89 ef             	mov    %r13,%rdi
+  801087:	48 b8 1f 31 80 00 00 	movabs $0x80311f,%rax
+  80108e:	00 00 00 
+  801091:	ff d0                	call   *%rax
+                *pf = 0;
+  801093:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80109a:	eb 18                	jmp    8010b4 <walk_path+0x2a8>
+            }
+            return r;
+        }
+    }
+
+    if (pdir)
+  80109c:	48 8b b5 18 ff ff ff 	mov    -0xe8(%rbp),%rsi
+  8010a3:	48 85 f6             	test   %rsi,%rsi
+  8010a6:	74 03                	je     8010ab <walk_path+0x29f>
+        *pdir = dir;
+  8010a8:	48 89 16             	mov    %rdx,(%rsi)
+    *pf = f;
+  8010ab:	4c 89 3b             	mov    %r15,(%rbx)
+    return 0;
+  8010ae:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+}
+  8010b4:	44 89 e0             	mov    %r12d,%eax
+  8010b7:	48 81 c4 c8 00 00 00 	add    $0xc8,%rsp
+  8010be:	5b                   	pop    %rbx
+  8010bf:	41 5c                	pop    %r12
+  8010c1:	41 5d                	pop    %r13
+  8010c3:	41 5e                	pop    %r14
+  8010c5:	41 5f                	pop    %r15
+  8010c7:	5d                   	pop    %rbp
+  8010c8:	c3                   	ret
+            return -E_BAD_PATH;
+  8010c9:	41 bc f0 ff ff ff    	mov    $0xfffffff0,%r12d
+  8010cf:	eb e3                	jmp    8010b4 <walk_path+0x2a8>
+            return -E_NOT_FOUND;
+  8010d1:	41 bc f1 ff ff ff    	mov    $0xfffffff1,%r12d
+  8010d7:	eb db                	jmp    8010b4 <walk_path+0x2a8>
+
+00000000008010d9 <file_open>:
+}
+
+/* Open "path".  On success set *pf to point at the file and return 0.
+ * On error return < 0. */
+int
+file_open(const char *path, struct File **pf) {
+  8010d9:	55                   	push   %rbp
+  8010da:	48 89 e5             	mov    %rsp,%rbp
+  8010dd:	48 89 f2             	mov    %rsi,%rdx
+    return walk_path(path, 0, pf, 0);
+  8010e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ea:	48 b8 0c 0e 80 00 00 	movabs $0x800e0c,%rax
+  8010f1:	00 00 00 
+  8010f4:	ff d0                	call   *%rax
+}
+  8010f6:	5d                   	pop    %rbp
+  8010f7:	c3                   	ret
+
+00000000008010f8 <file_read>:
+
+/* Read count bytes from f into buf, starting from seek position
+ * offset.  This meant to mimic the standard pread function.
+ * Returns the number of bytes read, < 0 on error. */
+ssize_t
+file_read(struct File *f, void *buf, size_t count, off_t offset) {
+  8010f8:	55                   	push   %rbp
+  8010f9:	48 89 e5             	mov    %rsp,%rbp
+  8010fc:	41 57                	push   %r15
+  8010fe:	41 56                	push   %r14
+  801100:	41 55                	push   %r13
+  801102:	41 54                	push   %r12
+  801104:	53                   	push   %rbx
+  801105:	48 83 ec 28          	sub    $0x28,%rsp
+  801109:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80110d:	89 cb                	mov    %ecx,%ebx
+    char *blk;
+
+    if (offset >= f->f_size)
+  80110f:	8b 8f 80 00 00 00    	mov    0x80(%rdi),%ecx
+        return 0;
+  801115:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (offset >= f->f_size)
+  80111a:	39 d9                	cmp    %ebx,%ecx
+  80111c:	0f 8e 9c 00 00 00    	jle    8011be <file_read+0xc6>
+  801122:	49 89 f5             	mov    %rsi,%r13
+
+    count = MIN(count, f->f_size - offset);
+  801125:	29 d9                	sub    %ebx,%ecx
+  801127:	48 63 c9             	movslq %ecx,%rcx
+  80112a:	48 39 d1             	cmp    %rdx,%rcx
+  80112d:	48 0f 46 d1          	cmovbe %rcx,%rdx
+  801131:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+
+    for (off_t pos = offset; pos < offset + count;) {
+  801135:	4c 63 f3             	movslq %ebx,%r14
+  801138:	4e 8d 3c 32          	lea    (%rdx,%r14,1),%r15
+  80113c:	4d 39 fe             	cmp    %r15,%r14
+  80113f:	73 79                	jae    8011ba <file_read+0xc2>
+        int r = file_get_block(f, pos / BLKSIZE, &blk);
+  801141:	8d b3 ff 0f 00 00    	lea    0xfff(%rbx),%esi
+  801147:	85 db                	test   %ebx,%ebx
+  801149:	0f 49 f3             	cmovns %ebx,%esi
+  80114c:	c1 fe 0c             	sar    $0xc,%esi
+  80114f:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801153:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801157:	48 b8 7b 0d 80 00 00 	movabs $0x800d7b,%rax
+  80115e:	00 00 00 
+  801161:	ff d0                	call   *%rax
+        if (r < 0) return r;
+  801163:	85 c0                	test   %eax,%eax
+  801165:	78 66                	js     8011cd <file_read+0xd5>
+
+        int bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  801167:	89 d8                	mov    %ebx,%eax
+  801169:	c1 f8 1f             	sar    $0x1f,%eax
+  80116c:	c1 e8 14             	shr    $0x14,%eax
+  80116f:	8d 34 03             	lea    (%rbx,%rax,1),%esi
+  801172:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801178:	29 c6                	sub    %eax,%esi
+  80117a:	48 63 f6             	movslq %esi,%rsi
+  80117d:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  801183:	49 29 f4             	sub    %rsi,%r12
+  801186:	4c 89 f8             	mov    %r15,%rax
+  801189:	4c 29 f0             	sub    %r14,%rax
+  80118c:	49 39 c4             	cmp    %rax,%r12
+  80118f:	4c 0f 47 e0          	cmova  %rax,%r12
+        memmove(buf, blk + pos % BLKSIZE, bn);
+  801193:	4d 63 f4             	movslq %r12d,%r14
+  801196:	48 03 75 c8          	add    -0x38(%rbp),%rsi
+  80119a:	4c 89 f2             	mov    %r14,%rdx
+  80119d:	4c 89 ef             	mov    %r13,%rdi
+  8011a0:	48 b8 19 33 80 00 00 	movabs $0x803319,%rax
+  8011a7:	00 00 00 
+  8011aa:	ff d0                	call   *%rax
+        pos += bn;
+  8011ac:	44 01 e3             	add    %r12d,%ebx
+        buf += bn;
+  8011af:	4d 01 f5             	add    %r14,%r13
+    for (off_t pos = offset; pos < offset + count;) {
+  8011b2:	4c 63 f3             	movslq %ebx,%r14
+  8011b5:	4d 39 fe             	cmp    %r15,%r14
+  8011b8:	72 87                	jb     801141 <file_read+0x49>
+    }
+
+    return count;
+  8011ba:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+}
+  8011be:	48 83 c4 28          	add    $0x28,%rsp
+  8011c2:	5b                   	pop    %rbx
+  8011c3:	41 5c                	pop    %r12
+  8011c5:	41 5d                	pop    %r13
+  8011c7:	41 5e                	pop    %r14
+  8011c9:	41 5f                	pop    %r15
+  8011cb:	5d                   	pop    %rbp
+  8011cc:	c3                   	ret
+        if (r < 0) return r;
+  8011cd:	48 98                	cltq
+  8011cf:	eb ed                	jmp    8011be <file_read+0xc6>
+
+00000000008011d1 <file_set_size>:
+    }
+}
+
+/* Set the size of file f, truncating or extending as necessary. */
+int
+file_set_size(struct File *f, off_t newsize) {
+  8011d1:	55                   	push   %rbp
+  8011d2:	48 89 e5             	mov    %rsp,%rbp
+  8011d5:	41 57                	push   %r15
+  8011d7:	41 56                	push   %r14
+  8011d9:	41 55                	push   %r13
+  8011db:	41 54                	push   %r12
+  8011dd:	53                   	push   %rbx
+  8011de:	48 83 ec 28          	sub    $0x28,%rsp
+  8011e2:	49 89 fc             	mov    %rdi,%r12
+  8011e5:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    if (f->f_size > newsize)
+  8011e8:	8b 87 80 00 00 00    	mov    0x80(%rdi),%eax
+  8011ee:	39 f0                	cmp    %esi,%eax
+  8011f0:	7f 2e                	jg     801220 <file_set_size+0x4f>
+        file_truncate_blocks(f, newsize);
+    f->f_size = newsize;
+  8011f2:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8011f5:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  8011fc:	00 
+    flush_block(f);
+  8011fd:	4c 89 e7             	mov    %r12,%rdi
+  801200:	48 b8 b2 04 80 00 00 	movabs $0x8004b2,%rax
+  801207:	00 00 00 
+  80120a:	ff d0                	call   *%rax
+    return 0;
+}
+  80120c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801211:	48 83 c4 28          	add    $0x28,%rsp
+  801215:	5b                   	pop    %rbx
+  801216:	41 5c                	pop    %r12
+  801218:	41 5d                	pop    %r13
+  80121a:	41 5e                	pop    %r14
+  80121c:	41 5f                	pop    %r15
+  80121e:	5d                   	pop    %rbp
+  80121f:	c3                   	ret
+    blockno_t old_nblocks = CEILDIV(f->f_size, BLKSIZE);
+  801220:	48 98                	cltq
+  801222:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801228:	48 c1 e8 0c          	shr    $0xc,%rax
+  80122c:	41 89 c6             	mov    %eax,%r14d
+    blockno_t new_nblocks = CEILDIV(newsize, BLKSIZE);
+  80122f:	48 63 d6             	movslq %esi,%rdx
+  801232:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  801239:	48 c1 ea 0c          	shr    $0xc,%rdx
+  80123d:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    for (blockno_t bno = new_nblocks; bno < old_nblocks; bno++) {
+  801241:	39 c2                	cmp    %eax,%edx
+  801243:	73 0e                	jae    801253 <file_set_size+0x82>
+  801245:	89 d3                	mov    %edx,%ebx
+    int res = file_block_walk(f, filebno, &ptr, 0);
+  801247:	49 bf a0 0c 80 00 00 	movabs $0x800ca0,%r15
+  80124e:	00 00 00 
+  801251:	eb 54                	jmp    8012a7 <file_set_size+0xd6>
+    if (new_nblocks <= NDIRECT && f->f_indirect) {
+  801253:	83 7d b0 0a          	cmpl   $0xa,-0x50(%rbp)
+  801257:	77 99                	ja     8011f2 <file_set_size+0x21>
+  801259:	41 8b bc 24 b0 00 00 	mov    0xb0(%r12),%edi
+  801260:	00 
+  801261:	85 ff                	test   %edi,%edi
+  801263:	74 8d                	je     8011f2 <file_set_size+0x21>
+        free_block(f->f_indirect);
+  801265:	48 b8 f0 09 80 00 00 	movabs $0x8009f0,%rax
+  80126c:	00 00 00 
+  80126f:	ff d0                	call   *%rax
+        f->f_indirect = 0;
+  801271:	41 c7 84 24 b0 00 00 	movl   $0x0,0xb0(%r12)
+  801278:	00 00 00 00 00 
+  80127d:	e9 70 ff ff ff       	jmp    8011f2 <file_set_size+0x21>
+        if (res < 0) cprintf("warning: file_free_block: %i", res);
+  801282:	89 c6                	mov    %eax,%esi
+  801284:	48 bf d1 58 80 00 00 	movabs $0x8058d1,%rdi
+  80128b:	00 00 00 
+  80128e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801293:	48 b9 fa 27 80 00 00 	movabs $0x8027fa,%rcx
+  80129a:	00 00 00 
+  80129d:	ff d1                	call   *%rcx
+    for (blockno_t bno = new_nblocks; bno < old_nblocks; bno++) {
+  80129f:	83 c3 01             	add    $0x1,%ebx
+  8012a2:	44 39 f3             	cmp    %r14d,%ebx
+  8012a5:	73 ac                	jae    801253 <file_set_size+0x82>
+    int res = file_block_walk(f, filebno, &ptr, 0);
+  8012a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012ac:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8012b0:	89 de                	mov    %ebx,%esi
+  8012b2:	4c 89 e7             	mov    %r12,%rdi
+  8012b5:	41 ff d7             	call   *%r15
+    if (res < 0) return res;
+  8012b8:	85 c0                	test   %eax,%eax
+  8012ba:	78 c6                	js     801282 <file_set_size+0xb1>
+    if (*ptr) {
+  8012bc:	4c 8b 6d c8          	mov    -0x38(%rbp),%r13
+  8012c0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8012c4:	85 ff                	test   %edi,%edi
+  8012c6:	74 d7                	je     80129f <file_set_size+0xce>
+        free_block(*ptr);
+  8012c8:	48 b8 f0 09 80 00 00 	movabs $0x8009f0,%rax
+  8012cf:	00 00 00 
+  8012d2:	ff d0                	call   *%rax
+        *ptr = 0;
+  8012d4:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8012db:	00 
+  8012dc:	eb c1                	jmp    80129f <file_set_size+0xce>
+
+00000000008012de <file_write>:
+file_write(struct File *f, const void *buf, size_t count, off_t offset) {
+  8012de:	55                   	push   %rbp
+  8012df:	48 89 e5             	mov    %rsp,%rbp
+  8012e2:	41 57                	push   %r15
+  8012e4:	41 56                	push   %r14
+  8012e6:	41 55                	push   %r13
+  8012e8:	41 54                	push   %r12
+  8012ea:	53                   	push   %rbx
+  8012eb:	48 83 ec 28          	sub    $0x28,%rsp
+  8012ef:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8012f3:	49 89 f5             	mov    %rsi,%r13
+  8012f6:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  8012fa:	89 cb                	mov    %ecx,%ebx
+    if (offset + count > f->f_size)
+  8012fc:	4c 63 e1             	movslq %ecx,%r12
+  8012ff:	4d 8d 34 14          	lea    (%r12,%rdx,1),%r14
+  801303:	48 63 87 80 00 00 00 	movslq 0x80(%rdi),%rax
+  80130a:	4c 39 f0             	cmp    %r14,%rax
+  80130d:	0f 82 98 00 00 00    	jb     8013ab <file_write+0xcd>
+        if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) return res;
+  801313:	49 bf 7b 0d 80 00 00 	movabs $0x800d7b,%r15
+  80131a:	00 00 00 
+    for (off_t pos = offset; pos < offset + count;) {
+  80131d:	4d 39 f4             	cmp    %r14,%r12
+  801320:	73 76                	jae    801398 <file_write+0xba>
+        if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) return res;
+  801322:	8d b3 ff 0f 00 00    	lea    0xfff(%rbx),%esi
+  801328:	85 db                	test   %ebx,%ebx
+  80132a:	0f 49 f3             	cmovns %ebx,%esi
+  80132d:	c1 fe 0c             	sar    $0xc,%esi
+  801330:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801334:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801338:	41 ff d7             	call   *%r15
+  80133b:	85 c0                	test   %eax,%eax
+  80133d:	0f 88 88 00 00 00    	js     8013cb <file_write+0xed>
+        uint32_t bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  801343:	89 d8                	mov    %ebx,%eax
+  801345:	c1 f8 1f             	sar    $0x1f,%eax
+  801348:	c1 e8 14             	shr    $0x14,%eax
+  80134b:	8d 3c 03             	lea    (%rbx,%rax,1),%edi
+  80134e:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801354:	29 c7                	sub    %eax,%edi
+  801356:	48 63 ff             	movslq %edi,%rdi
+  801359:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80135e:	48 29 fa             	sub    %rdi,%rdx
+  801361:	4c 89 f0             	mov    %r14,%rax
+  801364:	4c 29 e0             	sub    %r12,%rax
+  801367:	48 39 c2             	cmp    %rax,%rdx
+  80136a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80136e:	49 89 c4             	mov    %rax,%r12
+        memmove(blk + pos % BLKSIZE, buf, bn);
+  801371:	48 03 7d c8          	add    -0x38(%rbp),%rdi
+  801375:	48 89 c2             	mov    %rax,%rdx
+  801378:	4c 89 ee             	mov    %r13,%rsi
+  80137b:	48 b8 19 33 80 00 00 	movabs $0x803319,%rax
+  801382:	00 00 00 
+  801385:	ff d0                	call   *%rax
+        pos += bn;
+  801387:	42 8d 04 23          	lea    (%rbx,%r12,1),%eax
+  80138b:	89 c3                	mov    %eax,%ebx
+        buf += bn;
+  80138d:	4d 01 e5             	add    %r12,%r13
+    for (off_t pos = offset; pos < offset + count;) {
+  801390:	4c 63 e0             	movslq %eax,%r12
+  801393:	4d 39 f4             	cmp    %r14,%r12
+  801396:	72 8a                	jb     801322 <file_write+0x44>
+    return count;
+  801398:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+}
+  80139c:	48 83 c4 28          	add    $0x28,%rsp
+  8013a0:	5b                   	pop    %rbx
+  8013a1:	41 5c                	pop    %r12
+  8013a3:	41 5d                	pop    %r13
+  8013a5:	41 5e                	pop    %r14
+  8013a7:	41 5f                	pop    %r15
+  8013a9:	5d                   	pop    %rbp
+  8013aa:	c3                   	ret
+        if ((res = file_set_size(f, offset + count)) < 0) return res;
+  8013ab:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8013ae:	8d 34 01             	lea    (%rcx,%rax,1),%esi
+  8013b1:	48 b8 d1 11 80 00 00 	movabs $0x8011d1,%rax
+  8013b8:	00 00 00 
+  8013bb:	ff d0                	call   *%rax
+  8013bd:	89 c2                	mov    %eax,%edx
+  8013bf:	48 98                	cltq
+  8013c1:	85 d2                	test   %edx,%edx
+  8013c3:	0f 89 4a ff ff ff    	jns    801313 <file_write+0x35>
+  8013c9:	eb d1                	jmp    80139c <file_write+0xbe>
+        if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) return res;
+  8013cb:	48 98                	cltq
+  8013cd:	eb cd                	jmp    80139c <file_write+0xbe>
+
+00000000008013cf <file_flush>:
+/* Flush the contents and metadata of file f out to disk.
+ * Loop over all the blocks in file.
+ * Translate the file block number into a disk block number
+ * and then check whether that disk block is dirty.  If so, write it out. */
+void
+file_flush(struct File *f) {
+  8013cf:	55                   	push   %rbp
+  8013d0:	48 89 e5             	mov    %rsp,%rbp
+  8013d3:	41 57                	push   %r15
+  8013d5:	41 56                	push   %r14
+  8013d7:	41 55                	push   %r13
+  8013d9:	41 54                	push   %r12
+  8013db:	53                   	push   %rbx
+  8013dc:	48 83 ec 18          	sub    $0x18,%rsp
+  8013e0:	49 89 fc             	mov    %rdi,%r12
+    blockno_t *pdiskbno;
+
+    for (blockno_t i = 0; i < CEILDIV(f->f_size, BLKSIZE); i++) {
+  8013e3:	48 63 87 80 00 00 00 	movslq 0x80(%rdi),%rax
+  8013ea:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  8013f0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8013f4:	85 c0                	test   %eax,%eax
+  8013f6:	74 6d                	je     801465 <file_flush+0x96>
+  8013f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  8013fd:	49 bd a0 0c 80 00 00 	movabs $0x800ca0,%r13
+  801404:	00 00 00 
+            pdiskbno == NULL || *pdiskbno == 0)
+            continue;
+        flush_block(diskaddr(*pdiskbno));
+  801407:	49 bf 5c 04 80 00 00 	movabs $0x80045c,%r15
+  80140e:	00 00 00 
+  801411:	49 be b2 04 80 00 00 	movabs $0x8004b2,%r14
+  801418:	00 00 00 
+  80141b:	eb 19                	jmp    801436 <file_flush+0x67>
+    for (blockno_t i = 0; i < CEILDIV(f->f_size, BLKSIZE); i++) {
+  80141d:	83 c3 01             	add    $0x1,%ebx
+  801420:	49 63 84 24 80 00 00 	movslq 0x80(%r12),%rax
+  801427:	00 
+  801428:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  80142e:	48 c1 e8 0c          	shr    $0xc,%rax
+  801432:	39 c3                	cmp    %eax,%ebx
+  801434:	73 2f                	jae    801465 <file_flush+0x96>
+        if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  801436:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80143b:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80143f:	89 de                	mov    %ebx,%esi
+  801441:	4c 89 e7             	mov    %r12,%rdi
+  801444:	41 ff d5             	call   *%r13
+  801447:	85 c0                	test   %eax,%eax
+  801449:	78 d2                	js     80141d <file_flush+0x4e>
+            pdiskbno == NULL || *pdiskbno == 0)
+  80144b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+        if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  80144f:	48 85 c0             	test   %rax,%rax
+  801452:	74 c9                	je     80141d <file_flush+0x4e>
+            pdiskbno == NULL || *pdiskbno == 0)
+  801454:	8b 38                	mov    (%rax),%edi
+  801456:	85 ff                	test   %edi,%edi
+  801458:	74 c3                	je     80141d <file_flush+0x4e>
+        flush_block(diskaddr(*pdiskbno));
+  80145a:	41 ff d7             	call   *%r15
+  80145d:	48 89 c7             	mov    %rax,%rdi
+  801460:	41 ff d6             	call   *%r14
+  801463:	eb b8                	jmp    80141d <file_flush+0x4e>
+    }
+    if (f->f_indirect)
+  801465:	41 8b bc 24 b0 00 00 	mov    0xb0(%r12),%edi
+  80146c:	00 
+  80146d:	85 ff                	test   %edi,%edi
+  80146f:	75 1e                	jne    80148f <file_flush+0xc0>
+        flush_block(diskaddr(f->f_indirect));
+    flush_block(f);
+  801471:	4c 89 e7             	mov    %r12,%rdi
+  801474:	48 b8 b2 04 80 00 00 	movabs $0x8004b2,%rax
+  80147b:	00 00 00 
+  80147e:	ff d0                	call   *%rax
+}
+  801480:	48 83 c4 18          	add    $0x18,%rsp
+  801484:	5b                   	pop    %rbx
+  801485:	41 5c                	pop    %r12
+  801487:	41 5d                	pop    %r13
+  801489:	41 5e                	pop    %r14
+  80148b:	41 5f                	pop    %r15
+  80148d:	5d                   	pop    %rbp
+  80148e:	c3                   	ret
+        flush_block(diskaddr(f->f_indirect));
+  80148f:	48 b8 5c 04 80 00 00 	movabs $0x80045c,%rax
+  801496:	00 00 00 
+  801499:	ff d0                	call   *%rax
+  80149b:	48 89 c7             	mov    %rax,%rdi
+  80149e:	48 b8 b2 04 80 00 00 	movabs $0x8004b2,%rax
+  8014a5:	00 00 00 
+  8014a8:	ff d0                	call   *%rax
+  8014aa:	eb c5                	jmp    801471 <file_flush+0xa2>
+
+00000000008014ac <file_create>:
+file_create(const char *path, struct File **pf) {
+  8014ac:	55                   	push   %rbp
+  8014ad:	48 89 e5             	mov    %rsp,%rbp
+  8014b0:	41 57                	push   %r15
+  8014b2:	41 56                	push   %r14
+  8014b4:	41 55                	push   %r13
+  8014b6:	41 54                	push   %r12
+  8014b8:	53                   	push   %rbx
+  8014b9:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8014c0:	48 89 b5 28 ff ff ff 	mov    %rsi,-0xd8(%rbp)
+    if (!(res = walk_path(path, &dir, &filp, name))) return -E_FILE_EXISTS;
+  8014c7:	48 8d 8d 50 ff ff ff 	lea    -0xb0(%rbp),%rcx
+  8014ce:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  8014d5:	48 8d b5 48 ff ff ff 	lea    -0xb8(%rbp),%rsi
+  8014dc:	48 b8 0c 0e 80 00 00 	movabs $0x800e0c,%rax
+  8014e3:	00 00 00 
+  8014e6:	ff d0                	call   *%rax
+  8014e8:	85 c0                	test   %eax,%eax
+  8014ea:	0f 84 55 01 00 00    	je     801645 <file_create+0x199>
+  8014f0:	89 c3                	mov    %eax,%ebx
+    if (res != -E_NOT_FOUND || dir == 0) return res;
+  8014f2:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8014f5:	0f 85 fd 00 00 00    	jne    8015f8 <file_create+0x14c>
+  8014fb:	4c 8b ad 48 ff ff ff 	mov    -0xb8(%rbp),%r13
+  801502:	4d 85 ed             	test   %r13,%r13
+  801505:	0f 84 ed 00 00 00    	je     8015f8 <file_create+0x14c>
+    assert((dir->f_size % BLKSIZE) == 0);
+  80150b:	41 8b 85 80 00 00 00 	mov    0x80(%r13),%eax
+  801512:	89 c3                	mov    %eax,%ebx
+  801514:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80151a:	0f 85 ec 00 00 00    	jne    80160c <file_create+0x160>
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  801520:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  801526:	85 c0                	test   %eax,%eax
+  801528:	0f 48 c2             	cmovs  %edx,%eax
+    for (blockno_t i = 0; i < nblock; i++) {
+  80152b:	c1 f8 0c             	sar    $0xc,%eax
+  80152e:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%rbp)
+  801534:	74 56                	je     80158c <file_create+0xe0>
+  801536:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        int res = file_get_block(dir, i, &blk);
+  80153c:	49 bf 7b 0d 80 00 00 	movabs $0x800d7b,%r15
+  801543:	00 00 00 
+  801546:	48 8d 95 38 ff ff ff 	lea    -0xc8(%rbp),%rdx
+  80154d:	44 89 f6             	mov    %r14d,%esi
+  801550:	4c 89 ef             	mov    %r13,%rdi
+  801553:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  801556:	85 c0                	test   %eax,%eax
+  801558:	0f 88 e3 00 00 00    	js     801641 <file_create+0x195>
+        for (blockno_t j = 0; j < BLKFILES; j++) {
+  80155e:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  801565:	48 8d 90 00 10 00 00 	lea    0x1000(%rax),%rdx
+            if (f[j].f_name[0] == '\0') {
+  80156c:	49 89 c4             	mov    %rax,%r12
+  80156f:	80 38 00             	cmpb   $0x0,(%rax)
+  801572:	74 4e                	je     8015c2 <file_create+0x116>
+        for (blockno_t j = 0; j < BLKFILES; j++) {
+  801574:	48 05 00 01 00 00    	add    $0x100,%rax
+  80157a:	48 39 d0             	cmp    %rdx,%rax
+  80157d:	75 ed                	jne    80156c <file_create+0xc0>
+    for (blockno_t i = 0; i < nblock; i++) {
+  80157f:	41 83 c6 01          	add    $0x1,%r14d
+  801583:	44 39 b5 24 ff ff ff 	cmp    %r14d,-0xdc(%rbp)
+  80158a:	75 ba                	jne    801546 <file_create+0x9a>
+    dir->f_size += BLKSIZE;
+  80158c:	41 81 85 80 00 00 00 	addl   $0x1000,0x80(%r13)
+  801593:	00 10 00 00 
+    int res = file_get_block(dir, nblock, &blk);
+  801597:	48 8d 95 38 ff ff ff 	lea    -0xc8(%rbp),%rdx
+  80159e:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  8015a4:	4c 89 ef             	mov    %r13,%rdi
+  8015a7:	48 b8 7b 0d 80 00 00 	movabs $0x800d7b,%rax
+  8015ae:	00 00 00 
+  8015b1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8015b3:	85 c0                	test   %eax,%eax
+  8015b5:	0f 88 91 00 00 00    	js     80164c <file_create+0x1a0>
+    *file = (struct File *)blk;
+  8015bb:	4c 8b a5 38 ff ff ff 	mov    -0xc8(%rbp),%r12
+  8015c2:	4c 89 a5 40 ff ff ff 	mov    %r12,-0xc0(%rbp)
+    strcpy(filp->f_name, name);
+  8015c9:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  8015d0:	4c 89 e7             	mov    %r12,%rdi
+  8015d3:	48 b8 1f 31 80 00 00 	movabs $0x80311f,%rax
+  8015da:	00 00 00 
+  8015dd:	ff d0                	call   *%rax
+    *pf = filp;
+  8015df:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8015e6:	4c 89 20             	mov    %r12,(%rax)
+    file_flush(dir);
+  8015e9:	4c 89 ef             	mov    %r13,%rdi
+  8015ec:	48 b8 cf 13 80 00 00 	movabs $0x8013cf,%rax
+  8015f3:	00 00 00 
+  8015f6:	ff d0                	call   *%rax
+}
+  8015f8:	89 d8                	mov    %ebx,%eax
+  8015fa:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  801601:	5b                   	pop    %rbx
+  801602:	41 5c                	pop    %r12
+  801604:	41 5d                	pop    %r13
+  801606:	41 5e                	pop    %r14
+  801608:	41 5f                	pop    %r15
+  80160a:	5d                   	pop    %rbp
+  80160b:	c3                   	ret
+    assert((dir->f_size % BLKSIZE) == 0);
+  80160c:	48 b9 b4 58 80 00 00 	movabs $0x8058b4,%rcx
+  801613:	00 00 00 
+  801616:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  80161d:	00 00 00 
+  801620:	be e9 00 00 00       	mov    $0xe9,%esi
+  801625:	48 bf 1a 58 80 00 00 	movabs $0x80581a,%rdi
+  80162c:	00 00 00 
+  80162f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801634:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  80163b:	00 00 00 
+  80163e:	41 ff d0             	call   *%r8
+        int res = file_get_block(dir, i, &blk);
+  801641:	89 c3                	mov    %eax,%ebx
+  801643:	eb b3                	jmp    8015f8 <file_create+0x14c>
+    if (!(res = walk_path(path, &dir, &filp, name))) return -E_FILE_EXISTS;
+  801645:	bb ef ff ff ff       	mov    $0xffffffef,%ebx
+  80164a:	eb ac                	jmp    8015f8 <file_create+0x14c>
+    if (res < 0) return res;
+  80164c:	89 c3                	mov    %eax,%ebx
+  80164e:	eb a8                	jmp    8015f8 <file_create+0x14c>
+
+0000000000801650 <fs_sync>:
+
+/* Sync the entire file system.  A big hammer. */
+void
+fs_sync(void) {
+    for (int i = 1; i < super->s_nblocks; i++) {
+  801650:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  801657:	00 00 00 
+  80165a:	83 78 04 01          	cmpl   $0x1,0x4(%rax)
+  80165e:	76 4e                	jbe    8016ae <fs_sync+0x5e>
+fs_sync(void) {
+  801660:	55                   	push   %rbp
+  801661:	48 89 e5             	mov    %rsp,%rbp
+  801664:	41 56                	push   %r14
+  801666:	41 55                	push   %r13
+  801668:	41 54                	push   %r12
+  80166a:	53                   	push   %rbx
+    for (int i = 1; i < super->s_nblocks; i++) {
+  80166b:	bb 01 00 00 00       	mov    $0x1,%ebx
+        flush_block(diskaddr(i));
+  801670:	49 be 5c 04 80 00 00 	movabs $0x80045c,%r14
+  801677:	00 00 00 
+  80167a:	49 bd b2 04 80 00 00 	movabs $0x8004b2,%r13
+  801681:	00 00 00 
+    for (int i = 1; i < super->s_nblocks; i++) {
+  801684:	49 bc 08 c0 80 00 00 	movabs $0x80c008,%r12
+  80168b:	00 00 00 
+        flush_block(diskaddr(i));
+  80168e:	89 df                	mov    %ebx,%edi
+  801690:	41 ff d6             	call   *%r14
+  801693:	48 89 c7             	mov    %rax,%rdi
+  801696:	41 ff d5             	call   *%r13
+    for (int i = 1; i < super->s_nblocks; i++) {
+  801699:	83 c3 01             	add    $0x1,%ebx
+  80169c:	49 8b 04 24          	mov    (%r12),%rax
+  8016a0:	3b 58 04             	cmp    0x4(%rax),%ebx
+  8016a3:	72 e9                	jb     80168e <fs_sync+0x3e>
+    }
+}
+  8016a5:	5b                   	pop    %rbx
+  8016a6:	41 5c                	pop    %r12
+  8016a8:	41 5d                	pop    %r13
+  8016aa:	41 5e                	pop    %r14
+  8016ac:	5d                   	pop    %rbp
+  8016ad:	c3                   	ret
+  8016ae:	c3                   	ret
+
+00000000008016af <serve_sync>:
+    file_flush(o->o_file);
+    return 0;
+}
+
+int
+serve_sync(envid_t envid, union Fsipc *req) {
+  8016af:	55                   	push   %rbp
+  8016b0:	48 89 e5             	mov    %rsp,%rbp
+    fs_sync();
+  8016b3:	48 b8 50 16 80 00 00 	movabs $0x801650,%rax
+  8016ba:	00 00 00 
+  8016bd:	ff d0                	call   *%rax
+    return 0;
+}
+  8016bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c4:	5d                   	pop    %rbp
+  8016c5:	c3                   	ret
+
+00000000008016c6 <serve_init>:
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  8016c6:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  8016cd:	00 00 00 
+  8016d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+    uintptr_t va = FILE_BASE;
+  8016d5:	48 b8 00 00 00 00 02 	movabs $0x200000000,%rax
+  8016dc:	00 00 00 
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  8016df:	48 be 00 00 20 00 02 	movabs $0x200200000,%rsi
+  8016e6:	00 00 00 
+        opentab[i].o_fileid = i;
+  8016e9:	89 0a                	mov    %ecx,(%rdx)
+        opentab[i].o_fd = (struct Fd *)va;
+  8016eb:	48 89 42 18          	mov    %rax,0x18(%rdx)
+        va += PAGE_SIZE;
+  8016ef:	48 05 00 10 00 00    	add    $0x1000,%rax
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  8016f5:	48 83 c1 01          	add    $0x1,%rcx
+  8016f9:	48 83 c2 20          	add    $0x20,%rdx
+  8016fd:	48 39 f0             	cmp    %rsi,%rax
+  801700:	75 e7                	jne    8016e9 <serve_init+0x23>
+}
+  801702:	c3                   	ret
+
+0000000000801703 <openfile_alloc>:
+openfile_alloc(struct OpenFile **o) {
+  801703:	55                   	push   %rbp
+  801704:	48 89 e5             	mov    %rsp,%rbp
+  801707:	41 56                	push   %r14
+  801709:	41 55                	push   %r13
+  80170b:	41 54                	push   %r12
+  80170d:	53                   	push   %rbx
+  80170e:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  801711:	49 bd 98 70 80 00 00 	movabs $0x807098,%r13
+  801718:	00 00 00 
+  80171b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        switch (sys_region_refs(opentab[i].o_fd, PAGE_SIZE)) {
+  801720:	49 be 71 36 80 00 00 	movabs $0x803671,%r14
+  801727:	00 00 00 
+  80172a:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  80172e:	be 00 10 00 00       	mov    $0x1000,%esi
+  801733:	41 ff d6             	call   *%r14
+  801736:	85 c0                	test   %eax,%eax
+  801738:	74 1d                	je     801757 <openfile_alloc+0x54>
+  80173a:	83 f8 01             	cmp    $0x1,%eax
+  80173d:	74 4d                	je     80178c <openfile_alloc+0x89>
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  80173f:	48 83 c3 01          	add    $0x1,%rbx
+  801743:	49 83 c5 20          	add    $0x20,%r13
+  801747:	48 81 fb 00 02 00 00 	cmp    $0x200,%rbx
+  80174e:	75 da                	jne    80172a <openfile_alloc+0x27>
+    return -E_MAX_OPEN;
+  801750:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+  801755:	eb 70                	jmp    8017c7 <openfile_alloc+0xc4>
+            int res = sys_alloc_region(0, opentab[i].o_fd, PAGE_SIZE, PROT_RW);
+  801757:	48 89 d8             	mov    %rbx,%rax
+  80175a:	48 c1 e0 05          	shl    $0x5,%rax
+  80175e:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  801765:	00 00 00 
+  801768:	48 8b 74 02 18       	mov    0x18(%rdx,%rax,1),%rsi
+  80176d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801772:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801777:	bf 00 00 00 00       	mov    $0x0,%edi
+  80177c:	48 b8 cf 36 80 00 00 	movabs $0x8036cf,%rax
+  801783:	00 00 00 
+  801786:	ff d0                	call   *%rax
+            if (res < 0) return res;
+  801788:	85 c0                	test   %eax,%eax
+  80178a:	78 3b                	js     8017c7 <openfile_alloc+0xc4>
+            opentab[i].o_fileid += MAXOPEN;
+  80178c:	48 c1 e3 05          	shl    $0x5,%rbx
+  801790:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  801797:	00 00 00 
+  80179a:	48 01 c3             	add    %rax,%rbx
+  80179d:	81 03 00 02 00 00    	addl   $0x200,(%rbx)
+            *o = &opentab[i];
+  8017a3:	49 89 1c 24          	mov    %rbx,(%r12)
+            memset(opentab[i].o_fd, 0, PAGE_SIZE);
+  8017a7:	48 8b 7b 18          	mov    0x18(%rbx),%rdi
+  8017ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b5:	48 b8 6b 32 80 00 00 	movabs $0x80326b,%rax
+  8017bc:	00 00 00 
+  8017bf:	ff d0                	call   *%rax
+            return (*o)->o_fileid;
+  8017c1:	49 8b 04 24          	mov    (%r12),%rax
+  8017c5:	8b 00                	mov    (%rax),%eax
+}
+  8017c7:	5b                   	pop    %rbx
+  8017c8:	41 5c                	pop    %r12
+  8017ca:	41 5d                	pop    %r13
+  8017cc:	41 5e                	pop    %r14
+  8017ce:	5d                   	pop    %rbp
+  8017cf:	c3                   	ret
+
+00000000008017d0 <openfile_lookup>:
+openfile_lookup(envid_t envid, uint32_t fileid, struct OpenFile **po) {
+  8017d0:	55                   	push   %rbp
+  8017d1:	48 89 e5             	mov    %rsp,%rbp
+  8017d4:	41 56                	push   %r14
+  8017d6:	41 55                	push   %r13
+  8017d8:	41 54                	push   %r12
+  8017da:	53                   	push   %rbx
+  8017db:	41 89 f5             	mov    %esi,%r13d
+  8017de:	49 89 d6             	mov    %rdx,%r14
+    o = &opentab[fileid % MAXOPEN];
+  8017e1:	41 89 f4             	mov    %esi,%r12d
+  8017e4:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8017eb:	44 89 e3             	mov    %r12d,%ebx
+  8017ee:	48 c1 e3 05          	shl    $0x5,%rbx
+  8017f2:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  8017f9:	00 00 00 
+  8017fc:	48 01 c3             	add    %rax,%rbx
+    if (sys_region_refs(o->o_fd, PAGE_SIZE) <= 1 || o->o_fileid != fileid)
+  8017ff:	48 8b 7b 18          	mov    0x18(%rbx),%rdi
+  801803:	be 00 10 00 00       	mov    $0x1000,%esi
+  801808:	48 b8 71 36 80 00 00 	movabs $0x803671,%rax
+  80180f:	00 00 00 
+  801812:	ff d0                	call   *%rax
+  801814:	83 f8 01             	cmp    $0x1,%eax
+  801817:	7e 28                	jle    801841 <openfile_lookup+0x71>
+  801819:	45 89 e4             	mov    %r12d,%r12d
+  80181c:	49 c1 e4 05          	shl    $0x5,%r12
+  801820:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  801827:	00 00 00 
+  80182a:	46 39 2c 20          	cmp    %r13d,(%rax,%r12,1)
+  80182e:	75 18                	jne    801848 <openfile_lookup+0x78>
+    *po = o;
+  801830:	49 89 1e             	mov    %rbx,(%r14)
+    return 0;
+  801833:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801838:	5b                   	pop    %rbx
+  801839:	41 5c                	pop    %r12
+  80183b:	41 5d                	pop    %r13
+  80183d:	41 5e                	pop    %r14
+  80183f:	5d                   	pop    %rbp
+  801840:	c3                   	ret
+        return -E_INVAL;
+  801841:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801846:	eb f0                	jmp    801838 <openfile_lookup+0x68>
+  801848:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80184d:	eb e9                	jmp    801838 <openfile_lookup+0x68>
+
+000000000080184f <serve_set_size>:
+serve_set_size(envid_t envid, union Fsipc *ipc) {
+  80184f:	55                   	push   %rbp
+  801850:	48 89 e5             	mov    %rsp,%rbp
+  801853:	53                   	push   %rbx
+  801854:	48 83 ec 18          	sub    $0x18,%rsp
+  801858:	48 89 f3             	mov    %rsi,%rbx
+    if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  80185b:	8b 36                	mov    (%rsi),%esi
+  80185d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801861:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  801868:	00 00 00 
+  80186b:	ff d0                	call   *%rax
+  80186d:	85 c0                	test   %eax,%eax
+  80186f:	78 17                	js     801888 <serve_set_size+0x39>
+    return file_set_size(o->o_file, req->req_size);
+  801871:	8b 73 04             	mov    0x4(%rbx),%esi
+  801874:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801878:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  80187c:	48 b8 d1 11 80 00 00 	movabs $0x8011d1,%rax
+  801883:	00 00 00 
+  801886:	ff d0                	call   *%rax
+}
+  801888:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80188c:	c9                   	leave
+  80188d:	c3                   	ret
+
+000000000080188e <serve_read>:
+serve_read(envid_t envid, union Fsipc *ipc) {
+  80188e:	55                   	push   %rbp
+  80188f:	48 89 e5             	mov    %rsp,%rbp
+  801892:	41 54                	push   %r12
+  801894:	53                   	push   %rbx
+  801895:	48 83 ec 10          	sub    $0x10,%rsp
+  801899:	48 89 f3             	mov    %rsi,%rbx
+    int err = openfile_lookup(envid, req->req_fileid, &of);
+  80189c:	8b 36                	mov    (%rsi),%esi
+  80189e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8018a2:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  8018a9:	00 00 00 
+  8018ac:	ff d0                	call   *%rax
+    if (err)
+  8018ae:	85 c0                	test   %eax,%eax
+  8018b0:	74 09                	je     8018bb <serve_read+0x2d>
+}
+  8018b2:	48 83 c4 10          	add    $0x10,%rsp
+  8018b6:	5b                   	pop    %rbx
+  8018b7:	41 5c                	pop    %r12
+  8018b9:	5d                   	pop    %rbp
+  8018ba:	c3                   	ret
+    ssize_t bytes_read = file_read(of->o_file, &ipc->readRet.ret_buf, req->req_n, of->o_fd->fd_offset);
+  8018bb:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8018bf:	49 8b 44 24 18       	mov    0x18(%r12),%rax
+  8018c4:	8b 48 04             	mov    0x4(%rax),%ecx
+  8018c7:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8018cb:	49 8b 7c 24 08       	mov    0x8(%r12),%rdi
+  8018d0:	48 89 de             	mov    %rbx,%rsi
+  8018d3:	48 b8 f8 10 80 00 00 	movabs $0x8010f8,%rax
+  8018da:	00 00 00 
+  8018dd:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  8018df:	48 85 c0             	test   %rax,%rax
+  8018e2:	78 ce                	js     8018b2 <serve_read+0x24>
+    of->o_fd->fd_offset += bytes_read;
+  8018e4:	49 8b 54 24 18       	mov    0x18(%r12),%rdx
+  8018e9:	01 42 04             	add    %eax,0x4(%rdx)
+    return bytes_read;
+  8018ec:	eb c4                	jmp    8018b2 <serve_read+0x24>
+
+00000000008018ee <serve_write>:
+serve_write(envid_t envid, union Fsipc *ipc) {
+  8018ee:	55                   	push   %rbp
+  8018ef:	48 89 e5             	mov    %rsp,%rbp
+  8018f2:	41 54                	push   %r12
+  8018f4:	53                   	push   %rbx
+  8018f5:	48 83 ec 10          	sub    $0x10,%rsp
+  8018f9:	48 89 f3             	mov    %rsi,%rbx
+    int err = openfile_lookup(envid, req->req_fileid, &of);
+  8018fc:	8b 36                	mov    (%rsi),%esi
+  8018fe:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801902:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  801909:	00 00 00 
+  80190c:	ff d0                	call   *%rax
+    if (err)
+  80190e:	85 c0                	test   %eax,%eax
+  801910:	74 09                	je     80191b <serve_write+0x2d>
+}
+  801912:	48 83 c4 10          	add    $0x10,%rsp
+  801916:	5b                   	pop    %rbx
+  801917:	41 5c                	pop    %r12
+  801919:	5d                   	pop    %rbp
+  80191a:	c3                   	ret
+    ssize_t bytes_written = file_write(of->o_file, req->req_buf, req->req_n, of->o_fd->fd_offset);
+  80191b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80191f:	49 8b 44 24 18       	mov    0x18(%r12),%rax
+  801924:	8b 48 04             	mov    0x4(%rax),%ecx
+  801927:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80192b:	48 8d 73 10          	lea    0x10(%rbx),%rsi
+  80192f:	49 8b 7c 24 08       	mov    0x8(%r12),%rdi
+  801934:	48 b8 de 12 80 00 00 	movabs $0x8012de,%rax
+  80193b:	00 00 00 
+  80193e:	ff d0                	call   *%rax
+    if (bytes_written < 0)
+  801940:	48 85 c0             	test   %rax,%rax
+  801943:	78 cd                	js     801912 <serve_write+0x24>
+    of->o_fd->fd_offset += bytes_written;
+  801945:	49 8b 54 24 18       	mov    0x18(%r12),%rdx
+  80194a:	01 42 04             	add    %eax,0x4(%rdx)
+    return bytes_written;
+  80194d:	eb c3                	jmp    801912 <serve_write+0x24>
+
+000000000080194f <serve_stat>:
+serve_stat(envid_t envid, union Fsipc *ipc) {
+  80194f:	55                   	push   %rbp
+  801950:	48 89 e5             	mov    %rsp,%rbp
+  801953:	41 54                	push   %r12
+  801955:	53                   	push   %rbx
+  801956:	48 83 ec 10          	sub    $0x10,%rsp
+  80195a:	48 89 f3             	mov    %rsi,%rbx
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  80195d:	8b 36                	mov    (%rsi),%esi
+  80195f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801963:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  80196a:	00 00 00 
+  80196d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80196f:	85 c0                	test   %eax,%eax
+  801971:	78 46                	js     8019b9 <serve_stat+0x6a>
+    strcpy(ret->ret_name, o->o_file->f_name);
+  801973:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801977:	49 8b 74 24 08       	mov    0x8(%r12),%rsi
+  80197c:	48 89 df             	mov    %rbx,%rdi
+  80197f:	48 b8 1f 31 80 00 00 	movabs $0x80311f,%rax
+  801986:	00 00 00 
+  801989:	ff d0                	call   *%rax
+    ret->ret_size = o->o_file->f_size;
+  80198b:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  801990:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  801996:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  80199c:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  8019a1:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%rax)
+  8019a8:	0f 94 c0             	sete   %al
+  8019ab:	0f b6 c0             	movzbl %al,%eax
+  8019ae:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8019b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019b9:	48 83 c4 10          	add    $0x10,%rsp
+  8019bd:	5b                   	pop    %rbx
+  8019be:	41 5c                	pop    %r12
+  8019c0:	5d                   	pop    %rbp
+  8019c1:	c3                   	ret
+
+00000000008019c2 <serve_flush>:
+serve_flush(envid_t envid, union Fsipc *ipc) {
+  8019c2:	55                   	push   %rbp
+  8019c3:	48 89 e5             	mov    %rsp,%rbp
+  8019c6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  8019ca:	8b 36                	mov    (%rsi),%esi
+  8019cc:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8019d0:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  8019d7:	00 00 00 
+  8019da:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8019dc:	85 c0                	test   %eax,%eax
+  8019de:	78 19                	js     8019f9 <serve_flush+0x37>
+    file_flush(o->o_file);
+  8019e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019e4:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  8019e8:	48 b8 cf 13 80 00 00 	movabs $0x8013cf,%rax
+  8019ef:	00 00 00 
+  8019f2:	ff d0                	call   *%rax
+    return 0;
+  8019f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019f9:	c9                   	leave
+  8019fa:	c3                   	ret
+
+00000000008019fb <serve_open>:
+           void **pg_store, int *perm_store) {
+  8019fb:	55                   	push   %rbp
+  8019fc:	48 89 e5             	mov    %rsp,%rbp
+  8019ff:	41 55                	push   %r13
+  801a01:	41 54                	push   %r12
+  801a03:	53                   	push   %rbx
+  801a04:	48 81 ec 18 04 00 00 	sub    $0x418,%rsp
+  801a0b:	48 89 f3             	mov    %rsi,%rbx
+  801a0e:	49 89 d5             	mov    %rdx,%r13
+  801a11:	49 89 cc             	mov    %rcx,%r12
+    memmove(path, req->req_path, MAXPATHLEN);
+  801a14:	ba 00 04 00 00       	mov    $0x400,%edx
+  801a19:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  801a20:	48 b8 19 33 80 00 00 	movabs $0x803319,%rax
+  801a27:	00 00 00 
+  801a2a:	ff d0                	call   *%rax
+    path[MAXPATHLEN - 1] = 0;
+  801a2c:	c6 45 df 00          	movb   $0x0,-0x21(%rbp)
+    if ((res = openfile_alloc(&o)) < 0) {
+  801a30:	48 8d bd d0 fb ff ff 	lea    -0x430(%rbp),%rdi
+  801a37:	48 b8 03 17 80 00 00 	movabs $0x801703,%rax
+  801a3e:	00 00 00 
+  801a41:	ff d0                	call   *%rax
+  801a43:	85 c0                	test   %eax,%eax
+  801a45:	0f 88 fa 00 00 00    	js     801b45 <serve_open+0x14a>
+    if (req->req_omode & O_CREAT) {
+  801a4b:	f6 83 01 04 00 00 01 	testb  $0x1,0x401(%rbx)
+  801a52:	74 34                	je     801a88 <serve_open+0x8d>
+        if ((res = file_create(path, &f)) < 0) {
+  801a54:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  801a5b:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  801a62:	48 b8 ac 14 80 00 00 	movabs $0x8014ac,%rax
+  801a69:	00 00 00 
+  801a6c:	ff d0                	call   *%rax
+  801a6e:	85 c0                	test   %eax,%eax
+  801a70:	79 38                	jns    801aaa <serve_open+0xaf>
+            if (!(req->req_omode & O_EXCL) && res == -E_FILE_EXISTS)
+  801a72:	f6 83 01 04 00 00 04 	testb  $0x4,0x401(%rbx)
+  801a79:	0f 85 c6 00 00 00    	jne    801b45 <serve_open+0x14a>
+  801a7f:	83 f8 ef             	cmp    $0xffffffef,%eax
+  801a82:	0f 85 bd 00 00 00    	jne    801b45 <serve_open+0x14a>
+        if ((res = file_open(path, &f)) < 0) {
+  801a88:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  801a8f:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  801a96:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  801a9d:	00 00 00 
+  801aa0:	ff d0                	call   *%rax
+  801aa2:	85 c0                	test   %eax,%eax
+  801aa4:	0f 88 9b 00 00 00    	js     801b45 <serve_open+0x14a>
+    if (req->req_omode & O_TRUNC) {
+  801aaa:	f6 83 01 04 00 00 02 	testb  $0x2,0x401(%rbx)
+  801ab1:	74 1c                	je     801acf <serve_open+0xd4>
+        if ((res = file_set_size(f, 0)) < 0) {
+  801ab3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ab8:	48 8b bd d8 fb ff ff 	mov    -0x428(%rbp),%rdi
+  801abf:	48 b8 d1 11 80 00 00 	movabs $0x8011d1,%rax
+  801ac6:	00 00 00 
+  801ac9:	ff d0                	call   *%rax
+  801acb:	85 c0                	test   %eax,%eax
+  801acd:	78 76                	js     801b45 <serve_open+0x14a>
+    if ((res = file_open(path, &f)) < 0) {
+  801acf:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  801ad6:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  801add:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  801ae4:	00 00 00 
+  801ae7:	ff d0                	call   *%rax
+  801ae9:	85 c0                	test   %eax,%eax
+  801aeb:	78 58                	js     801b45 <serve_open+0x14a>
+    o->o_file = f;
+  801aed:	48 8b 95 d0 fb ff ff 	mov    -0x430(%rbp),%rdx
+  801af4:	48 8b 85 d8 fb ff ff 	mov    -0x428(%rbp),%rax
+  801afb:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    o->o_fd->fd_file.id = o->o_fileid;
+  801aff:	48 8b 42 18          	mov    0x18(%rdx),%rax
+  801b03:	8b 0a                	mov    (%rdx),%ecx
+  801b05:	89 48 0c             	mov    %ecx,0xc(%rax)
+    o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+  801b08:	48 8b 4a 18          	mov    0x18(%rdx),%rcx
+  801b0c:	8b 83 00 04 00 00    	mov    0x400(%rbx),%eax
+  801b12:	83 e0 03             	and    $0x3,%eax
+  801b15:	89 41 08             	mov    %eax,0x8(%rcx)
+    o->o_fd->fd_dev_id = devfile.dev_id;
+  801b18:	48 8b 4a 18          	mov    0x18(%rdx),%rcx
+  801b1c:	a1 a0 b0 80 00 00 00 	movabs 0x80b0a0,%eax
+  801b23:	00 00 
+  801b25:	89 01                	mov    %eax,(%rcx)
+    o->o_mode = req->req_omode;
+  801b27:	8b 83 00 04 00 00    	mov    0x400(%rbx),%eax
+  801b2d:	89 42 10             	mov    %eax,0x10(%rdx)
+    *pg_store = o->o_fd;
+  801b30:	48 8b 42 18          	mov    0x18(%rdx),%rax
+  801b34:	49 89 45 00          	mov    %rax,0x0(%r13)
+    *perm_store = PROT_RW | PROT_SHARE;
+  801b38:	41 c7 04 24 46 00 00 	movl   $0x46,(%r12)
+  801b3f:	00 
+    return 0;
+  801b40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b45:	48 81 c4 18 04 00 00 	add    $0x418,%rsp
+  801b4c:	5b                   	pop    %rbx
+  801b4d:	41 5c                	pop    %r12
+  801b4f:	41 5d                	pop    %r13
+  801b51:	5d                   	pop    %rbp
+  801b52:	c3                   	ret
+
+0000000000801b53 <serve>:
+        [FSREQ_SET_SIZE] = serve_set_size,
+        [FSREQ_SYNC] = serve_sync};
+#define NHANDLERS (sizeof(handlers) / sizeof(handlers[0]))
+
+void
+serve(void) {
+  801b53:	55                   	push   %rbp
+  801b54:	48 89 e5             	mov    %rsp,%rbp
+  801b57:	41 56                	push   %r14
+  801b59:	41 55                	push   %r13
+  801b5b:	41 54                	push   %r12
+  801b5d:	53                   	push   %rbx
+  801b5e:	48 83 ec 20          	sub    $0x20,%rsp
+    void *pg;
+
+    while (1) {
+        perm = 0;
+        size_t sz = PAGE_SIZE;
+        req = ipc_recv((int32_t *)&whom, fsreq, &sz, &perm);
+  801b62:	48 bb 68 70 80 00 00 	movabs $0x807068,%rbx
+  801b69:	00 00 00 
+  801b6c:	49 bc ee 3f 80 00 00 	movabs $0x803fee,%r12
+  801b73:	00 00 00 
+            res = handlers[req](whom, fsreq);
+        } else {
+            cprintf("Invalid request code %d from %08x\n", req, whom);
+            res = -E_INVAL;
+        }
+        ipc_send(whom, res, pg, PAGE_SIZE, perm);
+  801b76:	49 be 83 40 80 00 00 	movabs $0x804083,%r14
+  801b7d:	00 00 00 
+        sys_unmap_region(0, fsreq, PAGE_SIZE);
+  801b80:	49 bd 9b 37 80 00 00 	movabs $0x80379b,%r13
+  801b87:	00 00 00 
+  801b8a:	eb 1e                	jmp    801baa <serve+0x57>
+            cprintf("Invalid request from %08x: no argument page\n", whom);
+  801b8c:	8b 75 dc             	mov    -0x24(%rbp),%esi
+  801b8f:	48 bf f0 58 80 00 00 	movabs $0x8058f0,%rdi
+  801b96:	00 00 00 
+  801b99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9e:	48 ba fa 27 80 00 00 	movabs $0x8027fa,%rdx
+  801ba5:	00 00 00 
+  801ba8:	ff d2                	call   *%rdx
+        perm = 0;
+  801baa:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+        size_t sz = PAGE_SIZE;
+  801bb1:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  801bb8:	00 
+        req = ipc_recv((int32_t *)&whom, fsreq, &sz, &perm);
+  801bb9:	48 8b 33             	mov    (%rbx),%rsi
+  801bbc:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801bc0:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801bc4:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  801bc8:	41 ff d4             	call   *%r12
+  801bcb:	89 c6                	mov    %eax,%esi
+        if (!(perm & PROT_R)) {
+  801bcd:	f6 45 d8 04          	testb  $0x4,-0x28(%rbp)
+  801bd1:	74 b9                	je     801b8c <serve+0x39>
+        pg = NULL;
+  801bd3:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  801bda:	00 
+        if (req == FSREQ_OPEN) {
+  801bdb:	83 f8 01             	cmp    $0x1,%eax
+  801bde:	74 26                	je     801c06 <serve+0xb3>
+        } else if (req < NHANDLERS && handlers[req]) {
+  801be0:	83 f8 08             	cmp    $0x8,%eax
+  801be3:	77 3f                	ja     801c24 <serve+0xd1>
+  801be5:	89 c0                	mov    %eax,%eax
+  801be7:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801bee:	00 00 00 
+  801bf1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801bf5:	48 85 c0             	test   %rax,%rax
+  801bf8:	74 2a                	je     801c24 <serve+0xd1>
+            res = handlers[req](whom, fsreq);
+  801bfa:	48 8b 33             	mov    (%rbx),%rsi
+  801bfd:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  801c00:	ff d0                	call   *%rax
+  801c02:	89 c6                	mov    %eax,%esi
+  801c04:	eb 41                	jmp    801c47 <serve+0xf4>
+            res = serve_open(whom, (struct Fsreq_open *)fsreq, &pg, &perm);
+  801c06:	48 8b 33             	mov    (%rbx),%rsi
+  801c09:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801c0d:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  801c11:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  801c14:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  801c1b:	00 00 00 
+  801c1e:	ff d0                	call   *%rax
+  801c20:	89 c6                	mov    %eax,%esi
+  801c22:	eb 23                	jmp    801c47 <serve+0xf4>
+            cprintf("Invalid request code %d from %08x\n", req, whom);
+  801c24:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  801c27:	48 bf 20 59 80 00 00 	movabs $0x805920,%rdi
+  801c2e:	00 00 00 
+  801c31:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c36:	48 b9 fa 27 80 00 00 	movabs $0x8027fa,%rcx
+  801c3d:	00 00 00 
+  801c40:	ff d1                	call   *%rcx
+            res = -E_INVAL;
+  801c42:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+        ipc_send(whom, res, pg, PAGE_SIZE, perm);
+  801c47:	44 8b 45 d8          	mov    -0x28(%rbp),%r8d
+  801c4b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801c50:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801c54:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  801c57:	41 ff d6             	call   *%r14
+        sys_unmap_region(0, fsreq, PAGE_SIZE);
+  801c5a:	48 8b 33             	mov    (%rbx),%rsi
+  801c5d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c62:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c67:	41 ff d5             	call   *%r13
+  801c6a:	e9 3b ff ff ff       	jmp    801baa <serve+0x57>
+
+0000000000801c6f <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  801c6f:	55                   	push   %rbp
+  801c70:	48 89 e5             	mov    %rsp,%rbp
+  801c73:	53                   	push   %rbx
+  801c74:	48 83 ec 08          	sub    $0x8,%rsp
+    static_assert(sizeof(struct File) == 256, "Unsupported file size");
+    binaryname = "fs";
+  801c78:	48 b8 43 59 80 00 00 	movabs $0x805943,%rax
+  801c7f:	00 00 00 
+  801c82:	48 a3 80 b0 80 00 00 	movabs %rax,0x80b080
+  801c89:	00 00 00 
+    cprintf("FS is running\n");
+  801c8c:	48 bf 46 59 80 00 00 	movabs $0x805946,%rdi
+  801c93:	00 00 00 
+  801c96:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9b:	48 bb fa 27 80 00 00 	movabs $0x8027fa,%rbx
+  801ca2:	00 00 00 
+  801ca5:	ff d3                	call   *%rbx
+    asm volatile("outw %0,%w1" ::"a"(data), "d"(port));
+  801ca7:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+  801cac:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+  801cb1:	66 ef                	out    %ax,(%dx)
+
+    /* Check that we are able to do I/O */
+    outw(0x8A00, 0x8A00);
+    cprintf("FS can do I/O\n");
+  801cb3:	48 bf 55 59 80 00 00 	movabs $0x805955,%rdi
+  801cba:	00 00 00 
+  801cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc2:	ff d3                	call   *%rbx
+
+    serve_init();
+  801cc4:	48 b8 c6 16 80 00 00 	movabs $0x8016c6,%rax
+  801ccb:	00 00 00 
+  801cce:	ff d0                	call   *%rax
+    fs_init();
+  801cd0:	48 b8 0d 0c 80 00 00 	movabs $0x800c0d,%rax
+  801cd7:	00 00 00 
+  801cda:	ff d0                	call   *%rax
+    fs_test();
+  801cdc:	48 b8 b5 1e 80 00 00 	movabs $0x801eb5,%rax
+  801ce3:	00 00 00 
+  801ce6:	ff d0                	call   *%rax
+    serve();
+  801ce8:	48 b8 53 1b 80 00 00 	movabs $0x801b53,%rax
+  801cef:	00 00 00 
+  801cf2:	ff d0                	call   *%rax
+
+0000000000801cf4 <check_dir>:
+void
+check_dir(struct File *dir) {
+    uint32_t *blk;
+    struct File *files;
+
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  801cf4:	8b 8f 80 00 00 00    	mov    0x80(%rdi),%ecx
+  801cfa:	8d 81 ff 0f 00 00    	lea    0xfff(%rcx),%eax
+  801d00:	85 c9                	test   %ecx,%ecx
+  801d02:	0f 49 c1             	cmovns %ecx,%eax
+    for (blockno_t i = 0; i < nblock; ++i) {
+  801d05:	c1 f8 0c             	sar    $0xc,%eax
+  801d08:	0f 84 a6 01 00 00    	je     801eb4 <check_dir+0x1c0>
+check_dir(struct File *dir) {
+  801d0e:	55                   	push   %rbp
+  801d0f:	48 89 e5             	mov    %rsp,%rbp
+  801d12:	41 57                	push   %r15
+  801d14:	41 56                	push   %r14
+  801d16:	41 55                	push   %r13
+  801d18:	41 54                	push   %r12
+  801d1a:	53                   	push   %rbx
+  801d1b:	48 83 ec 28          	sub    $0x28,%rsp
+  801d1f:	41 89 c5             	mov    %eax,%r13d
+    for (blockno_t i = 0; i < nblock; ++i) {
+  801d22:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                        check_dir(f);
+                    }
+                    if (file_block_walk(f, k, &pdiskbno, 0) < 0 || pdiskbno == NULL || *pdiskbno == 0) {
+                        continue;
+                    }
+                    assert(!block_is_free(*pdiskbno));
+  801d28:	49 89 fe             	mov    %rdi,%r14
+  801d2b:	e9 2d 01 00 00       	jmp    801e5d <check_dir+0x169>
+                        check_dir(f);
+  801d30:	4c 89 e7             	mov    %r12,%rdi
+  801d33:	48 b8 f4 1c 80 00 00 	movabs $0x801cf4,%rax
+  801d3a:	00 00 00 
+  801d3d:	ff d0                	call   *%rax
+  801d3f:	eb 26                	jmp    801d67 <check_dir+0x73>
+                for (blockno_t k = 0; k < CEILDIV(f->f_size, BLKSIZE); ++k) {
+  801d41:	41 83 c6 01          	add    $0x1,%r14d
+  801d45:	49 63 84 24 80 00 00 	movslq 0x80(%r12),%rax
+  801d4c:	00 
+  801d4d:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801d53:	48 c1 e8 0c          	shr    $0xc,%rax
+  801d57:	41 39 c6             	cmp    %eax,%r14d
+  801d5a:	73 7e                	jae    801dda <check_dir+0xe6>
+                    if (f->f_type == FTYPE_DIR) {
+  801d5c:	41 83 bc 24 84 00 00 	cmpl   $0x1,0x84(%r12)
+  801d63:	00 01 
+  801d65:	74 c9                	je     801d30 <check_dir+0x3c>
+                    if (file_block_walk(f, k, &pdiskbno, 0) < 0 || pdiskbno == NULL || *pdiskbno == 0) {
+  801d67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d6c:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  801d70:	44 89 f6             	mov    %r14d,%esi
+  801d73:	4c 89 e7             	mov    %r12,%rdi
+  801d76:	48 b8 a0 0c 80 00 00 	movabs $0x800ca0,%rax
+  801d7d:	00 00 00 
+  801d80:	ff d0                	call   *%rax
+  801d82:	85 c0                	test   %eax,%eax
+  801d84:	78 bb                	js     801d41 <check_dir+0x4d>
+  801d86:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801d8a:	48 85 c0             	test   %rax,%rax
+  801d8d:	74 b2                	je     801d41 <check_dir+0x4d>
+  801d8f:	8b 38                	mov    (%rax),%edi
+  801d91:	85 ff                	test   %edi,%edi
+  801d93:	74 ac                	je     801d41 <check_dir+0x4d>
+                    assert(!block_is_free(*pdiskbno));
+  801d95:	48 b8 ad 09 80 00 00 	movabs $0x8009ad,%rax
+  801d9c:	00 00 00 
+  801d9f:	ff d0                	call   *%rax
+  801da1:	84 c0                	test   %al,%al
+  801da3:	74 9c                	je     801d41 <check_dir+0x4d>
+  801da5:	48 b9 82 59 80 00 00 	movabs $0x805982,%rcx
+  801dac:	00 00 00 
+  801daf:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  801db6:	00 00 00 
+  801db9:	be 28 00 00 00       	mov    $0x28,%esi
+  801dbe:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  801dc5:	00 00 00 
+  801dc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dcd:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  801dd4:	00 00 00 
+  801dd7:	41 ff d0             	call   *%r8
+        for (blockno_t j = 0; j < BLKFILES; ++j) {
+  801dda:	48 81 c3 00 01 00 00 	add    $0x100,%rbx
+  801de1:	4c 39 fb             	cmp    %r15,%rbx
+  801de4:	74 66                	je     801e4c <check_dir+0x158>
+            struct File *f = &(files[j]);
+  801de6:	49 89 dc             	mov    %rbx,%r12
+            if (strcmp(f->f_name, "\0") != 0) {
+  801de9:	48 be 64 59 80 00 00 	movabs $0x805964,%rsi
+  801df0:	00 00 00 
+  801df3:	48 89 df             	mov    %rbx,%rdi
+  801df6:	48 b8 c3 31 80 00 00 	movabs $0x8031c3,%rax
+  801dfd:	00 00 00 
+  801e00:	ff d0                	call   *%rax
+  801e02:	85 c0                	test   %eax,%eax
+  801e04:	74 d4                	je     801dda <check_dir+0xe6>
+                blockno_t *pdiskbno = NULL;
+  801e06:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801e0d:	00 
+                cprintf("checking consistency of %s\n", f->f_name);
+  801e0e:	48 89 de             	mov    %rbx,%rsi
+  801e11:	48 bf 66 59 80 00 00 	movabs $0x805966,%rdi
+  801e18:	00 00 00 
+  801e1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e20:	48 ba fa 27 80 00 00 	movabs $0x8027fa,%rdx
+  801e27:	00 00 00 
+  801e2a:	ff d2                	call   *%rdx
+                for (blockno_t k = 0; k < CEILDIV(f->f_size, BLKSIZE); ++k) {
+  801e2c:	48 63 83 80 00 00 00 	movslq 0x80(%rbx),%rax
+  801e33:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801e39:	48 c1 e8 0c          	shr    $0xc,%rax
+  801e3d:	85 c0                	test   %eax,%eax
+  801e3f:	74 99                	je     801dda <check_dir+0xe6>
+  801e41:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801e47:	e9 10 ff ff ff       	jmp    801d5c <check_dir+0x68>
+  801e4c:	44 8b 65 bc          	mov    -0x44(%rbp),%r12d
+  801e50:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+    for (blockno_t i = 0; i < nblock; ++i) {
+  801e54:	41 83 c4 01          	add    $0x1,%r12d
+  801e58:	45 39 e5             	cmp    %r12d,%r13d
+  801e5b:	74 48                	je     801ea5 <check_dir+0x1b1>
+        if (file_block_walk(dir, i, &blk, 0) < 0) continue;
+  801e5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e62:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801e66:	44 89 e6             	mov    %r12d,%esi
+  801e69:	4c 89 f7             	mov    %r14,%rdi
+  801e6c:	48 b8 a0 0c 80 00 00 	movabs $0x800ca0,%rax
+  801e73:	00 00 00 
+  801e76:	ff d0                	call   *%rax
+  801e78:	85 c0                	test   %eax,%eax
+  801e7a:	78 d8                	js     801e54 <check_dir+0x160>
+        files = (struct File *)diskaddr(*blk);
+  801e7c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e80:	8b 38                	mov    (%rax),%edi
+  801e82:	48 b8 5c 04 80 00 00 	movabs $0x80045c,%rax
+  801e89:	00 00 00 
+  801e8c:	ff d0                	call   *%rax
+  801e8e:	48 89 c3             	mov    %rax,%rbx
+        for (blockno_t j = 0; j < BLKFILES; ++j) {
+  801e91:	4c 8d b8 00 10 00 00 	lea    0x1000(%rax),%r15
+            if (strcmp(f->f_name, "\0") != 0) {
+  801e98:	44 89 65 bc          	mov    %r12d,-0x44(%rbp)
+  801e9c:	4c 89 75 b0          	mov    %r14,-0x50(%rbp)
+  801ea0:	e9 41 ff ff ff       	jmp    801de6 <check_dir+0xf2>
+                }
+            }
+        }
+    }
+}
+  801ea5:	48 83 c4 28          	add    $0x28,%rsp
+  801ea9:	5b                   	pop    %rbx
+  801eaa:	41 5c                	pop    %r12
+  801eac:	41 5d                	pop    %r13
+  801eae:	41 5e                	pop    %r14
+  801eb0:	41 5f                	pop    %r15
+  801eb2:	5d                   	pop    %rbp
+  801eb3:	c3                   	ret
+  801eb4:	c3                   	ret
+
+0000000000801eb5 <fs_test>:
+
+void
+fs_test(void) {
+  801eb5:	55                   	push   %rbp
+  801eb6:	48 89 e5             	mov    %rsp,%rbp
+  801eb9:	53                   	push   %rbx
+  801eba:	48 83 ec 18          	sub    $0x18,%rsp
+    int r;
+    char *blk;
+    uint32_t *bits;
+
+    /* Back up bitmap */
+    if ((r = sys_alloc_region(0, (void *)PAGE_SIZE, PAGE_SIZE, PROT_RW)) < 0)
+  801ebe:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801ec3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ec8:	be 00 10 00 00       	mov    $0x1000,%esi
+  801ecd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ed2:	48 b8 cf 36 80 00 00 	movabs $0x8036cf,%rax
+  801ed9:	00 00 00 
+  801edc:	ff d0                	call   *%rax
+  801ede:	85 c0                	test   %eax,%eax
+  801ee0:	0f 88 34 03 00 00    	js     80221a <fs_test+0x365>
+        panic("sys_page_alloc: %i", r);
+    bits = (uint32_t *)PAGE_SIZE;
+    memmove(bits, bitmap, PAGE_SIZE);
+  801ee6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801eeb:	48 b8 00 c0 80 00 00 	movabs $0x80c000,%rax
+  801ef2:	00 00 00 
+  801ef5:	48 8b 30             	mov    (%rax),%rsi
+  801ef8:	bf 00 10 00 00       	mov    $0x1000,%edi
+  801efd:	48 b8 19 33 80 00 00 	movabs $0x803319,%rax
+  801f04:	00 00 00 
+  801f07:	ff d0                	call   *%rax
+    /* Allocate block */
+    if (!(r = alloc_block()))
+  801f09:	48 b8 40 0a 80 00 00 	movabs $0x800a40,%rax
+  801f10:	00 00 00 
+  801f13:	ff d0                	call   *%rax
+  801f15:	89 c1                	mov    %eax,%ecx
+  801f17:	85 c0                	test   %eax,%eax
+  801f19:	0f 84 28 03 00 00    	je     802247 <fs_test+0x392>
+        panic("alloc_block: %i", -E_NO_DISK);
+    /* Check that block was free */
+    assert(TSTBIT(bits, r));
+  801f1f:	8d 50 1f             	lea    0x1f(%rax),%edx
+  801f22:	0f 49 d0             	cmovns %eax,%edx
+  801f25:	c1 fa 05             	sar    $0x5,%edx
+  801f28:	48 63 d2             	movslq %edx,%rdx
+  801f2b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f30:	d3 e0                	shl    %cl,%eax
+  801f32:	89 c1                	mov    %eax,%ecx
+  801f34:	23 04 95 00 10 00 00 	and    0x1000(,%rdx,4),%eax
+  801f3b:	0f 84 36 03 00 00    	je     802277 <fs_test+0x3c2>
+    /* And is not free any more */
+    assert(!TSTBIT(bitmap, r));
+  801f41:	48 a1 00 c0 80 00 00 	movabs 0x80c000,%rax
+  801f48:	00 00 00 
+  801f4b:	23 0c 90             	and    (%rax,%rdx,4),%ecx
+  801f4e:	0f 85 53 03 00 00    	jne    8022a7 <fs_test+0x3f2>
+    cprintf("alloc_block is good\n");
+  801f54:	48 bf ec 59 80 00 00 	movabs $0x8059ec,%rdi
+  801f5b:	00 00 00 
+  801f5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f63:	48 bb fa 27 80 00 00 	movabs $0x8027fa,%rbx
+  801f6a:	00 00 00 
+  801f6d:	ff d3                	call   *%rbx
+    check_dir(&super->s_root);
+  801f6f:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  801f76:	00 00 00 
+  801f79:	48 8d 78 08          	lea    0x8(%rax),%rdi
+  801f7d:	48 b8 f4 1c 80 00 00 	movabs $0x801cf4,%rax
+  801f84:	00 00 00 
+  801f87:	ff d0                	call   *%rax
+    check_consistency();
+    cprintf("fs consistency is good\n");
+  801f89:	48 bf 01 5a 80 00 00 	movabs $0x805a01,%rdi
+  801f90:	00 00 00 
+  801f93:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f98:	ff d3                	call   *%rbx
+
+    if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  801f9a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f9e:	48 bf 19 5a 80 00 00 	movabs $0x805a19,%rdi
+  801fa5:	00 00 00 
+  801fa8:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  801faf:	00 00 00 
+  801fb2:	ff d0                	call   *%rax
+  801fb4:	85 c0                	test   %eax,%eax
+  801fb6:	0f 88 20 03 00 00    	js     8022dc <fs_test+0x427>
+        panic("file_open /not-found: %i", r);
+    else if (r == 0)
+  801fbc:	0f 84 50 03 00 00    	je     802312 <fs_test+0x45d>
+        panic("file_open /not-found succeeded!");
+    if ((r = file_open("/newmotd", &f)) < 0)
+  801fc2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fc6:	48 bf 3d 5a 80 00 00 	movabs $0x805a3d,%rdi
+  801fcd:	00 00 00 
+  801fd0:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  801fd7:	00 00 00 
+  801fda:	ff d0                	call   *%rax
+  801fdc:	85 c0                	test   %eax,%eax
+  801fde:	0f 88 53 03 00 00    	js     802337 <fs_test+0x482>
+        panic("file_open /newmotd: %i", r);
+    cprintf("file_open is good\n");
+  801fe4:	48 bf 5d 5a 80 00 00 	movabs $0x805a5d,%rdi
+  801feb:	00 00 00 
+  801fee:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff3:	48 ba fa 27 80 00 00 	movabs $0x8027fa,%rdx
+  801ffa:	00 00 00 
+  801ffd:	ff d2                	call   *%rdx
+
+    if ((r = file_get_block(f, 0, &blk)) < 0)
+  801fff:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802003:	be 00 00 00 00       	mov    $0x0,%esi
+  802008:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80200c:	48 b8 7b 0d 80 00 00 	movabs $0x800d7b,%rax
+  802013:	00 00 00 
+  802016:	ff d0                	call   *%rax
+  802018:	85 c0                	test   %eax,%eax
+  80201a:	0f 88 44 03 00 00    	js     802364 <fs_test+0x4af>
+        panic("file_get_block: %i", r);
+    if (strcmp(blk, msg) != 0)
+  802020:	48 be 78 5b 80 00 00 	movabs $0x805b78,%rsi
+  802027:	00 00 00 
+  80202a:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80202e:	48 b8 c3 31 80 00 00 	movabs $0x8031c3,%rax
+  802035:	00 00 00 
+  802038:	ff d0                	call   *%rax
+  80203a:	85 c0                	test   %eax,%eax
+  80203c:	0f 85 4f 03 00 00    	jne    802391 <fs_test+0x4dc>
+        panic("file_get_block returned wrong data");
+    cprintf("file_get_block is good\n");
+  802042:	48 bf 83 5a 80 00 00 	movabs $0x805a83,%rdi
+  802049:	00 00 00 
+  80204c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802051:	48 ba fa 27 80 00 00 	movabs $0x8027fa,%rdx
+  802058:	00 00 00 
+  80205b:	ff d2                	call   *%rdx
+
+    *(volatile char *)blk = *(volatile char *)blk;
+  80205d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802061:	0f b6 10             	movzbl (%rax),%edx
+  802064:	88 10                	mov    %dl,(%rax)
+    assert(is_page_dirty(blk));
+  802066:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80206a:	48 b8 65 51 80 00 00 	movabs $0x805165,%rax
+  802071:	00 00 00 
+  802074:	ff d0                	call   *%rax
+  802076:	84 c0                	test   %al,%al
+  802078:	0f 84 3d 03 00 00    	je     8023bb <fs_test+0x506>
+    file_flush(f);
+  80207e:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802082:	48 b8 cf 13 80 00 00 	movabs $0x8013cf,%rax
+  802089:	00 00 00 
+  80208c:	ff d0                	call   *%rax
+    assert(!is_page_dirty(blk));
+  80208e:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802092:	48 b8 65 51 80 00 00 	movabs $0x805165,%rax
+  802099:	00 00 00 
+  80209c:	ff d0                	call   *%rax
+  80209e:	84 c0                	test   %al,%al
+  8020a0:	0f 85 45 03 00 00    	jne    8023eb <fs_test+0x536>
+    cprintf("file_flush is good\n");
+  8020a6:	48 bf af 5a 80 00 00 	movabs $0x805aaf,%rdi
+  8020ad:	00 00 00 
+  8020b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b5:	48 ba fa 27 80 00 00 	movabs $0x8027fa,%rdx
+  8020bc:	00 00 00 
+  8020bf:	ff d2                	call   *%rdx
+
+    if ((r = file_set_size(f, 0)) < 0)
+  8020c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8020c6:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8020ca:	48 b8 d1 11 80 00 00 	movabs $0x8011d1,%rax
+  8020d1:	00 00 00 
+  8020d4:	ff d0                	call   *%rax
+  8020d6:	85 c0                	test   %eax,%eax
+  8020d8:	0f 88 42 03 00 00    	js     802420 <fs_test+0x56b>
+        panic("file_set_size: %i", r);
+    assert(f->f_direct[0] == 0);
+  8020de:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8020e2:	83 bf 88 00 00 00 00 	cmpl   $0x0,0x88(%rdi)
+  8020e9:	0f 85 5e 03 00 00    	jne    80244d <fs_test+0x598>
+    assert(!is_page_dirty(f));
+  8020ef:	48 b8 65 51 80 00 00 	movabs $0x805165,%rax
+  8020f6:	00 00 00 
+  8020f9:	ff d0                	call   *%rax
+  8020fb:	84 c0                	test   %al,%al
+  8020fd:	0f 85 7f 03 00 00    	jne    802482 <fs_test+0x5cd>
+    cprintf("file_truncate is good\n");
+  802103:	48 bf fb 5a 80 00 00 	movabs $0x805afb,%rdi
+  80210a:	00 00 00 
+  80210d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802112:	48 ba fa 27 80 00 00 	movabs $0x8027fa,%rdx
+  802119:	00 00 00 
+  80211c:	ff d2                	call   *%rdx
+
+    if ((r = file_set_size(f, strlen(msg))) < 0)
+  80211e:	48 bf 78 5b 80 00 00 	movabs $0x805b78,%rdi
+  802125:	00 00 00 
+  802128:	48 b8 e1 30 80 00 00 	movabs $0x8030e1,%rax
+  80212f:	00 00 00 
+  802132:	ff d0                	call   *%rax
+  802134:	89 c6                	mov    %eax,%esi
+  802136:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80213a:	48 b8 d1 11 80 00 00 	movabs $0x8011d1,%rax
+  802141:	00 00 00 
+  802144:	ff d0                	call   *%rax
+  802146:	85 c0                	test   %eax,%eax
+  802148:	0f 88 69 03 00 00    	js     8024b7 <fs_test+0x602>
+        panic("file_set_size 2: %i", r);
+    assert(!is_page_dirty(f));
+  80214e:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802152:	48 b8 65 51 80 00 00 	movabs $0x805165,%rax
+  802159:	00 00 00 
+  80215c:	ff d0                	call   *%rax
+  80215e:	84 c0                	test   %al,%al
+  802160:	0f 85 7e 03 00 00    	jne    8024e4 <fs_test+0x62f>
+    if ((r = file_get_block(f, 0, &blk)) < 0)
+  802166:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80216a:	be 00 00 00 00       	mov    $0x0,%esi
+  80216f:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802173:	48 b8 7b 0d 80 00 00 	movabs $0x800d7b,%rax
+  80217a:	00 00 00 
+  80217d:	ff d0                	call   *%rax
+  80217f:	85 c0                	test   %eax,%eax
+  802181:	0f 88 92 03 00 00    	js     802519 <fs_test+0x664>
+        panic("file_get_block 2: %i", r);
+    strcpy(blk, msg);
+  802187:	48 be 78 5b 80 00 00 	movabs $0x805b78,%rsi
+  80218e:	00 00 00 
+  802191:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802195:	48 b8 1f 31 80 00 00 	movabs $0x80311f,%rax
+  80219c:	00 00 00 
+  80219f:	ff d0                	call   *%rax
+    assert(is_page_dirty(blk));
+  8021a1:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8021a5:	48 b8 65 51 80 00 00 	movabs $0x805165,%rax
+  8021ac:	00 00 00 
+  8021af:	ff d0                	call   *%rax
+  8021b1:	84 c0                	test   %al,%al
+  8021b3:	0f 84 8d 03 00 00    	je     802546 <fs_test+0x691>
+    file_flush(f);
+  8021b9:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8021bd:	48 b8 cf 13 80 00 00 	movabs $0x8013cf,%rax
+  8021c4:	00 00 00 
+  8021c7:	ff d0                	call   *%rax
+    assert(!is_page_dirty(blk));
+  8021c9:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8021cd:	48 b8 65 51 80 00 00 	movabs $0x805165,%rax
+  8021d4:	00 00 00 
+  8021d7:	ff d0                	call   *%rax
+  8021d9:	84 c0                	test   %al,%al
+  8021db:	0f 85 95 03 00 00    	jne    802576 <fs_test+0x6c1>
+    assert(!is_page_dirty(f));
+  8021e1:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8021e5:	48 b8 65 51 80 00 00 	movabs $0x805165,%rax
+  8021ec:	00 00 00 
+  8021ef:	ff d0                	call   *%rax
+  8021f1:	84 c0                	test   %al,%al
+  8021f3:	0f 85 b2 03 00 00    	jne    8025ab <fs_test+0x6f6>
+    cprintf("file rewrite is good\n");
+  8021f9:	48 bf 3b 5b 80 00 00 	movabs $0x805b3b,%rdi
+  802200:	00 00 00 
+  802203:	b8 00 00 00 00       	mov    $0x0,%eax
+  802208:	48 ba fa 27 80 00 00 	movabs $0x8027fa,%rdx
+  80220f:	00 00 00 
+  802212:	ff d2                	call   *%rdx
+}
+  802214:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802218:	c9                   	leave
+  802219:	c3                   	ret
+        panic("sys_page_alloc: %i", r);
+  80221a:	89 c1                	mov    %eax,%ecx
+  80221c:	48 ba a6 59 80 00 00 	movabs $0x8059a6,%rdx
+  802223:	00 00 00 
+  802226:	be 38 00 00 00       	mov    $0x38,%esi
+  80222b:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  802232:	00 00 00 
+  802235:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223a:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  802241:	00 00 00 
+  802244:	41 ff d0             	call   *%r8
+        panic("alloc_block: %i", -E_NO_DISK);
+  802247:	b9 f3 ff ff ff       	mov    $0xfffffff3,%ecx
+  80224c:	48 ba b9 59 80 00 00 	movabs $0x8059b9,%rdx
+  802253:	00 00 00 
+  802256:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80225b:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  802262:	00 00 00 
+  802265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226a:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  802271:	00 00 00 
+  802274:	41 ff d0             	call   *%r8
+    assert(TSTBIT(bits, r));
+  802277:	48 b9 c9 59 80 00 00 	movabs $0x8059c9,%rcx
+  80227e:	00 00 00 
+  802281:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  802288:	00 00 00 
+  80228b:	be 3f 00 00 00       	mov    $0x3f,%esi
+  802290:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  802297:	00 00 00 
+  80229a:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  8022a1:	00 00 00 
+  8022a4:	41 ff d0             	call   *%r8
+    assert(!TSTBIT(bitmap, r));
+  8022a7:	48 b9 d9 59 80 00 00 	movabs $0x8059d9,%rcx
+  8022ae:	00 00 00 
+  8022b1:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  8022b8:	00 00 00 
+  8022bb:	be 41 00 00 00       	mov    $0x41,%esi
+  8022c0:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  8022c7:	00 00 00 
+  8022ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022cf:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  8022d6:	00 00 00 
+  8022d9:	41 ff d0             	call   *%r8
+    if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  8022dc:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8022df:	0f 84 dd fc ff ff    	je     801fc2 <fs_test+0x10d>
+        panic("file_open /not-found: %i", r);
+  8022e5:	89 c1                	mov    %eax,%ecx
+  8022e7:	48 ba 24 5a 80 00 00 	movabs $0x805a24,%rdx
+  8022ee:	00 00 00 
+  8022f1:	be 47 00 00 00       	mov    $0x47,%esi
+  8022f6:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  8022fd:	00 00 00 
+  802300:	b8 00 00 00 00       	mov    $0x0,%eax
+  802305:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  80230c:	00 00 00 
+  80230f:	41 ff d0             	call   *%r8
+        panic("file_open /not-found succeeded!");
+  802312:	48 ba 58 5b 80 00 00 	movabs $0x805b58,%rdx
+  802319:	00 00 00 
+  80231c:	be 49 00 00 00       	mov    $0x49,%esi
+  802321:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  802328:	00 00 00 
+  80232b:	48 b9 aa 26 80 00 00 	movabs $0x8026aa,%rcx
+  802332:	00 00 00 
+  802335:	ff d1                	call   *%rcx
+        panic("file_open /newmotd: %i", r);
+  802337:	89 c1                	mov    %eax,%ecx
+  802339:	48 ba 46 5a 80 00 00 	movabs $0x805a46,%rdx
+  802340:	00 00 00 
+  802343:	be 4b 00 00 00       	mov    $0x4b,%esi
+  802348:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  80234f:	00 00 00 
+  802352:	b8 00 00 00 00       	mov    $0x0,%eax
+  802357:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  80235e:	00 00 00 
+  802361:	41 ff d0             	call   *%r8
+        panic("file_get_block: %i", r);
+  802364:	89 c1                	mov    %eax,%ecx
+  802366:	48 ba 70 5a 80 00 00 	movabs $0x805a70,%rdx
+  80236d:	00 00 00 
+  802370:	be 4f 00 00 00       	mov    $0x4f,%esi
+  802375:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  80237c:	00 00 00 
+  80237f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802384:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  80238b:	00 00 00 
+  80238e:	41 ff d0             	call   *%r8
+        panic("file_get_block returned wrong data");
+  802391:	48 ba a0 5b 80 00 00 	movabs $0x805ba0,%rdx
+  802398:	00 00 00 
+  80239b:	be 51 00 00 00       	mov    $0x51,%esi
+  8023a0:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  8023a7:	00 00 00 
+  8023aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023af:	48 b9 aa 26 80 00 00 	movabs $0x8026aa,%rcx
+  8023b6:	00 00 00 
+  8023b9:	ff d1                	call   *%rcx
+    assert(is_page_dirty(blk));
+  8023bb:	48 b9 9c 5a 80 00 00 	movabs $0x805a9c,%rcx
+  8023c2:	00 00 00 
+  8023c5:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  8023cc:	00 00 00 
+  8023cf:	be 55 00 00 00       	mov    $0x55,%esi
+  8023d4:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  8023db:	00 00 00 
+  8023de:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  8023e5:	00 00 00 
+  8023e8:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(blk));
+  8023eb:	48 b9 9b 5a 80 00 00 	movabs $0x805a9b,%rcx
+  8023f2:	00 00 00 
+  8023f5:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  8023fc:	00 00 00 
+  8023ff:	be 57 00 00 00       	mov    $0x57,%esi
+  802404:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  80240b:	00 00 00 
+  80240e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802413:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  80241a:	00 00 00 
+  80241d:	41 ff d0             	call   *%r8
+        panic("file_set_size: %i", r);
+  802420:	89 c1                	mov    %eax,%ecx
+  802422:	48 ba c3 5a 80 00 00 	movabs $0x805ac3,%rdx
+  802429:	00 00 00 
+  80242c:	be 5b 00 00 00       	mov    $0x5b,%esi
+  802431:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  802438:	00 00 00 
+  80243b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802440:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  802447:	00 00 00 
+  80244a:	41 ff d0             	call   *%r8
+    assert(f->f_direct[0] == 0);
+  80244d:	48 b9 d5 5a 80 00 00 	movabs $0x805ad5,%rcx
+  802454:	00 00 00 
+  802457:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  80245e:	00 00 00 
+  802461:	be 5c 00 00 00       	mov    $0x5c,%esi
+  802466:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  80246d:	00 00 00 
+  802470:	b8 00 00 00 00       	mov    $0x0,%eax
+  802475:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  80247c:	00 00 00 
+  80247f:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  802482:	48 b9 e9 5a 80 00 00 	movabs $0x805ae9,%rcx
+  802489:	00 00 00 
+  80248c:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  802493:	00 00 00 
+  802496:	be 5d 00 00 00       	mov    $0x5d,%esi
+  80249b:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  8024a2:	00 00 00 
+  8024a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024aa:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  8024b1:	00 00 00 
+  8024b4:	41 ff d0             	call   *%r8
+        panic("file_set_size 2: %i", r);
+  8024b7:	89 c1                	mov    %eax,%ecx
+  8024b9:	48 ba 12 5b 80 00 00 	movabs $0x805b12,%rdx
+  8024c0:	00 00 00 
+  8024c3:	be 61 00 00 00       	mov    $0x61,%esi
+  8024c8:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  8024cf:	00 00 00 
+  8024d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d7:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  8024de:	00 00 00 
+  8024e1:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  8024e4:	48 b9 e9 5a 80 00 00 	movabs $0x805ae9,%rcx
+  8024eb:	00 00 00 
+  8024ee:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  8024f5:	00 00 00 
+  8024f8:	be 62 00 00 00       	mov    $0x62,%esi
+  8024fd:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  802504:	00 00 00 
+  802507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80250c:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  802513:	00 00 00 
+  802516:	41 ff d0             	call   *%r8
+        panic("file_get_block 2: %i", r);
+  802519:	89 c1                	mov    %eax,%ecx
+  80251b:	48 ba 26 5b 80 00 00 	movabs $0x805b26,%rdx
+  802522:	00 00 00 
+  802525:	be 64 00 00 00       	mov    $0x64,%esi
+  80252a:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  802531:	00 00 00 
+  802534:	b8 00 00 00 00       	mov    $0x0,%eax
+  802539:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  802540:	00 00 00 
+  802543:	41 ff d0             	call   *%r8
+    assert(is_page_dirty(blk));
+  802546:	48 b9 9c 5a 80 00 00 	movabs $0x805a9c,%rcx
+  80254d:	00 00 00 
+  802550:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  802557:	00 00 00 
+  80255a:	be 66 00 00 00       	mov    $0x66,%esi
+  80255f:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  802566:	00 00 00 
+  802569:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  802570:	00 00 00 
+  802573:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(blk));
+  802576:	48 b9 9b 5a 80 00 00 	movabs $0x805a9b,%rcx
+  80257d:	00 00 00 
+  802580:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  802587:	00 00 00 
+  80258a:	be 68 00 00 00       	mov    $0x68,%esi
+  80258f:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  802596:	00 00 00 
+  802599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80259e:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  8025a5:	00 00 00 
+  8025a8:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  8025ab:	48 b9 e9 5a 80 00 00 	movabs $0x805ae9,%rcx
+  8025b2:	00 00 00 
+  8025b5:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  8025bc:	00 00 00 
+  8025bf:	be 69 00 00 00       	mov    $0x69,%esi
+  8025c4:	48 bf 9c 59 80 00 00 	movabs $0x80599c,%rdi
+  8025cb:	00 00 00 
+  8025ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d3:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  8025da:	00 00 00 
+  8025dd:	41 ff d0             	call   *%r8
+
+00000000008025e0 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8025e0:	55                   	push   %rbp
+  8025e1:	48 89 e5             	mov    %rsp,%rbp
+  8025e4:	41 56                	push   %r14
+  8025e6:	41 55                	push   %r13
+  8025e8:	41 54                	push   %r12
+  8025ea:	53                   	push   %rbx
+  8025eb:	41 89 fd             	mov    %edi,%r13d
+  8025ee:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8025f1:	48 ba 58 b1 80 00 00 	movabs $0x80b158,%rdx
+  8025f8:	00 00 00 
+  8025fb:	48 b8 58 b1 80 00 00 	movabs $0x80b158,%rax
+  802602:	00 00 00 
+  802605:	48 39 c2             	cmp    %rax,%rdx
+  802608:	73 17                	jae    802621 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80260a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80260d:	49 89 c4             	mov    %rax,%r12
+  802610:	48 83 c3 08          	add    $0x8,%rbx
+  802614:	b8 00 00 00 00       	mov    $0x0,%eax
+  802619:	ff 53 f8             	call   *-0x8(%rbx)
+  80261c:	4c 39 e3             	cmp    %r12,%rbx
+  80261f:	72 ef                	jb     802610 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  802621:	48 b8 0f 36 80 00 00 	movabs $0x80360f,%rax
+  802628:	00 00 00 
+  80262b:	ff d0                	call   *%rax
+  80262d:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  802630:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802637:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80263e:	00 00 00 
+  802641:	48 01 d0             	add    %rdx,%rax
+  802644:	48 a3 10 c0 80 00 00 	movabs %rax,0x80c010
+  80264b:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80264e:	45 85 ed             	test   %r13d,%r13d
+  802651:	7e 0d                	jle    802660 <libmain+0x80>
+  802653:	49 8b 06             	mov    (%r14),%rax
+  802656:	48 a3 80 b0 80 00 00 	movabs %rax,0x80b080
+  80265d:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  802660:	4c 89 f6             	mov    %r14,%rsi
+  802663:	44 89 ef             	mov    %r13d,%edi
+  802666:	48 b8 6f 1c 80 00 00 	movabs $0x801c6f,%rax
+  80266d:	00 00 00 
+  802670:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  802672:	48 b8 87 26 80 00 00 	movabs $0x802687,%rax
+  802679:	00 00 00 
+  80267c:	ff d0                	call   *%rax
+#endif
+}
+  80267e:	5b                   	pop    %rbx
+  80267f:	41 5c                	pop    %r12
+  802681:	41 5d                	pop    %r13
+  802683:	41 5e                	pop    %r14
+  802685:	5d                   	pop    %rbp
+  802686:	c3                   	ret
+
+0000000000802687 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  802687:	55                   	push   %rbp
+  802688:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80268b:	48 b8 99 43 80 00 00 	movabs $0x804399,%rax
+  802692:	00 00 00 
+  802695:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  802697:	bf 00 00 00 00       	mov    $0x0,%edi
+  80269c:	48 b8 a4 35 80 00 00 	movabs $0x8035a4,%rax
+  8026a3:	00 00 00 
+  8026a6:	ff d0                	call   *%rax
+}
+  8026a8:	5d                   	pop    %rbp
+  8026a9:	c3                   	ret
+
+00000000008026aa <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8026aa:	55                   	push   %rbp
+  8026ab:	48 89 e5             	mov    %rsp,%rbp
+  8026ae:	41 56                	push   %r14
+  8026b0:	41 55                	push   %r13
+  8026b2:	41 54                	push   %r12
+  8026b4:	53                   	push   %rbx
+  8026b5:	48 83 ec 50          	sub    $0x50,%rsp
+  8026b9:	49 89 fc             	mov    %rdi,%r12
+  8026bc:	41 89 f5             	mov    %esi,%r13d
+  8026bf:	48 89 d3             	mov    %rdx,%rbx
+  8026c2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8026c6:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8026ca:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8026ce:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8026d5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8026d9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8026dd:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8026e1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8026e5:	48 b8 80 b0 80 00 00 	movabs $0x80b080,%rax
+  8026ec:	00 00 00 
+  8026ef:	4c 8b 30             	mov    (%rax),%r14
+  8026f2:	48 b8 0f 36 80 00 00 	movabs $0x80360f,%rax
+  8026f9:	00 00 00 
+  8026fc:	ff d0                	call   *%rax
+  8026fe:	89 c6                	mov    %eax,%esi
+  802700:	45 89 e8             	mov    %r13d,%r8d
+  802703:	4c 89 e1             	mov    %r12,%rcx
+  802706:	4c 89 f2             	mov    %r14,%rdx
+  802709:	48 bf d0 5b 80 00 00 	movabs $0x805bd0,%rdi
+  802710:	00 00 00 
+  802713:	b8 00 00 00 00       	mov    $0x0,%eax
+  802718:	49 bc fa 27 80 00 00 	movabs $0x8027fa,%r12
+  80271f:	00 00 00 
+  802722:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802725:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802729:	48 89 df             	mov    %rbx,%rdi
+  80272c:	48 b8 96 27 80 00 00 	movabs $0x802796,%rax
+  802733:	00 00 00 
+  802736:	ff d0                	call   *%rax
+    cprintf("\n");
+  802738:	48 bf a6 57 80 00 00 	movabs $0x8057a6,%rdi
+  80273f:	00 00 00 
+  802742:	b8 00 00 00 00       	mov    $0x0,%eax
+  802747:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80274a:	cc                   	int3
+  80274b:	eb fd                	jmp    80274a <_panic+0xa0>
+
+000000000080274d <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80274d:	55                   	push   %rbp
+  80274e:	48 89 e5             	mov    %rsp,%rbp
+  802751:	53                   	push   %rbx
+  802752:	48 83 ec 08          	sub    $0x8,%rsp
+  802756:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802759:	8b 06                	mov    (%rsi),%eax
+  80275b:	8d 50 01             	lea    0x1(%rax),%edx
+  80275e:	89 16                	mov    %edx,(%rsi)
+  802760:	48 98                	cltq
+  802762:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802767:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80276d:	74 0a                	je     802779 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80276f:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802773:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802777:	c9                   	leave
+  802778:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802779:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80277d:	be ff 00 00 00       	mov    $0xff,%esi
+  802782:	48 b8 46 35 80 00 00 	movabs $0x803546,%rax
+  802789:	00 00 00 
+  80278c:	ff d0                	call   *%rax
+        state->offset = 0;
+  80278e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802794:	eb d9                	jmp    80276f <putch+0x22>
+
+0000000000802796 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802796:	55                   	push   %rbp
+  802797:	48 89 e5             	mov    %rsp,%rbp
+  80279a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8027a1:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8027a4:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8027ab:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8027b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8027b8:	48 89 f1             	mov    %rsi,%rcx
+  8027bb:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8027c2:	48 bf 4d 27 80 00 00 	movabs $0x80274d,%rdi
+  8027c9:	00 00 00 
+  8027cc:	48 b8 4a 29 80 00 00 	movabs $0x80294a,%rax
+  8027d3:	00 00 00 
+  8027d6:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8027d8:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8027df:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8027e6:	48 b8 46 35 80 00 00 	movabs $0x803546,%rax
+  8027ed:	00 00 00 
+  8027f0:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8027f2:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8027f8:	c9                   	leave
+  8027f9:	c3                   	ret
+
+00000000008027fa <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8027fa:	55                   	push   %rbp
+  8027fb:	48 89 e5             	mov    %rsp,%rbp
+  8027fe:	48 83 ec 50          	sub    $0x50,%rsp
+  802802:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802806:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80280a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80280e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802812:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802816:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80281d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802821:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802825:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802829:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80282d:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802831:	48 b8 96 27 80 00 00 	movabs $0x802796,%rax
+  802838:	00 00 00 
+  80283b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80283d:	c9                   	leave
+  80283e:	c3                   	ret
+
+000000000080283f <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80283f:	55                   	push   %rbp
+  802840:	48 89 e5             	mov    %rsp,%rbp
+  802843:	41 57                	push   %r15
+  802845:	41 56                	push   %r14
+  802847:	41 55                	push   %r13
+  802849:	41 54                	push   %r12
+  80284b:	53                   	push   %rbx
+  80284c:	48 83 ec 18          	sub    $0x18,%rsp
+  802850:	49 89 fc             	mov    %rdi,%r12
+  802853:	49 89 f5             	mov    %rsi,%r13
+  802856:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80285a:	8b 45 10             	mov    0x10(%rbp),%eax
+  80285d:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802860:	41 89 cf             	mov    %ecx,%r15d
+  802863:	4c 39 fa             	cmp    %r15,%rdx
+  802866:	73 5b                	jae    8028c3 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802868:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80286c:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  802870:	85 db                	test   %ebx,%ebx
+  802872:	7e 0e                	jle    802882 <print_num+0x43>
+            putch(padc, put_arg);
+  802874:	4c 89 ee             	mov    %r13,%rsi
+  802877:	44 89 f7             	mov    %r14d,%edi
+  80287a:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80287d:	83 eb 01             	sub    $0x1,%ebx
+  802880:	75 f2                	jne    802874 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802882:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802886:	48 b9 04 5c 80 00 00 	movabs $0x805c04,%rcx
+  80288d:	00 00 00 
+  802890:	48 b8 f3 5b 80 00 00 	movabs $0x805bf3,%rax
+  802897:	00 00 00 
+  80289a:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80289e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028a7:	49 f7 f7             	div    %r15
+  8028aa:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8028ae:	4c 89 ee             	mov    %r13,%rsi
+  8028b1:	41 ff d4             	call   *%r12
+}
+  8028b4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8028b8:	5b                   	pop    %rbx
+  8028b9:	41 5c                	pop    %r12
+  8028bb:	41 5d                	pop    %r13
+  8028bd:	41 5e                	pop    %r14
+  8028bf:	41 5f                	pop    %r15
+  8028c1:	5d                   	pop    %rbp
+  8028c2:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8028c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028cc:	49 f7 f7             	div    %r15
+  8028cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8028d3:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8028d7:	52                   	push   %rdx
+  8028d8:	45 0f be c9          	movsbl %r9b,%r9d
+  8028dc:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8028e0:	48 89 c2             	mov    %rax,%rdx
+  8028e3:	48 b8 3f 28 80 00 00 	movabs $0x80283f,%rax
+  8028ea:	00 00 00 
+  8028ed:	ff d0                	call   *%rax
+  8028ef:	48 83 c4 10          	add    $0x10,%rsp
+  8028f3:	eb 8d                	jmp    802882 <print_num+0x43>
+
+00000000008028f5 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8028f5:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8028f9:	48 8b 06             	mov    (%rsi),%rax
+  8028fc:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802900:	73 0a                	jae    80290c <sprintputch+0x17>
+        *state->start++ = ch;
+  802902:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802906:	48 89 16             	mov    %rdx,(%rsi)
+  802909:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80290c:	c3                   	ret
+
+000000000080290d <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80290d:	55                   	push   %rbp
+  80290e:	48 89 e5             	mov    %rsp,%rbp
+  802911:	48 83 ec 50          	sub    $0x50,%rsp
+  802915:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802919:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80291d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802921:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802928:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80292c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802930:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802934:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802938:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80293c:	48 b8 4a 29 80 00 00 	movabs $0x80294a,%rax
+  802943:	00 00 00 
+  802946:	ff d0                	call   *%rax
+}
+  802948:	c9                   	leave
+  802949:	c3                   	ret
+
+000000000080294a <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80294a:	55                   	push   %rbp
+  80294b:	48 89 e5             	mov    %rsp,%rbp
+  80294e:	41 57                	push   %r15
+  802950:	41 56                	push   %r14
+  802952:	41 55                	push   %r13
+  802954:	41 54                	push   %r12
+  802956:	53                   	push   %rbx
+  802957:	48 83 ec 38          	sub    $0x38,%rsp
+  80295b:	49 89 fe             	mov    %rdi,%r14
+  80295e:	49 89 f5             	mov    %rsi,%r13
+  802961:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802964:	48 8b 01             	mov    (%rcx),%rax
+  802967:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80296b:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80296f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802973:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802977:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80297b:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80297f:	0f b6 3b             	movzbl (%rbx),%edi
+  802982:	40 80 ff 25          	cmp    $0x25,%dil
+  802986:	74 18                	je     8029a0 <vprintfmt+0x56>
+            if (!ch) return;
+  802988:	40 84 ff             	test   %dil,%dil
+  80298b:	0f 84 b1 06 00 00    	je     803042 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802991:	40 0f b6 ff          	movzbl %dil,%edi
+  802995:	4c 89 ee             	mov    %r13,%rsi
+  802998:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80299b:	4c 89 e3             	mov    %r12,%rbx
+  80299e:	eb db                	jmp    80297b <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8029a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8029a5:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8029a9:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8029ae:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8029b4:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8029bb:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8029bf:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8029c4:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8029c9:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8029cc:	83 e8 23             	sub    $0x23,%eax
+  8029cf:	3c 57                	cmp    $0x57,%al
+  8029d1:	0f 87 51 06 00 00    	ja     803028 <vprintfmt+0x6de>
+  8029d7:	0f b6 c0             	movzbl %al,%eax
+  8029da:	48 b9 a0 5d 80 00 00 	movabs $0x805da0,%rcx
+  8029e1:	00 00 00 
+  8029e4:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8029e7:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8029ea:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8029ee:	eb cf                	jmp    8029bf <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8029f0:	49 89 dc             	mov    %rbx,%r12
+  8029f3:	be 01 00 00 00       	mov    $0x1,%esi
+  8029f8:	eb c5                	jmp    8029bf <vprintfmt+0x75>
+            padc = ch;
+  8029fa:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8029fe:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802a01:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802a04:	eb b9                	jmp    8029bf <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802a06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a09:	83 f8 2f             	cmp    $0x2f,%eax
+  802a0c:	77 24                	ja     802a32 <vprintfmt+0xe8>
+  802a0e:	89 c1                	mov    %eax,%ecx
+  802a10:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802a14:	83 c0 08             	add    $0x8,%eax
+  802a17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802a1a:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802a1d:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802a20:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802a24:	79 99                	jns    8029bf <vprintfmt+0x75>
+                width = precision;
+  802a26:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802a2a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802a30:	eb 8d                	jmp    8029bf <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802a32:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802a36:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802a3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a3e:	eb da                	jmp    802a1a <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802a40:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802a45:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802a49:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802a4f:	3c 39                	cmp    $0x39,%al
+  802a51:	77 1c                	ja     802a6f <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802a53:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802a57:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802a5b:	0f b6 c0             	movzbl %al,%eax
+  802a5e:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802a63:	0f b6 03             	movzbl (%rbx),%eax
+  802a66:	3c 39                	cmp    $0x39,%al
+  802a68:	76 e9                	jbe    802a53 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802a6a:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802a6d:	eb b1                	jmp    802a20 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802a6f:	49 89 dc             	mov    %rbx,%r12
+  802a72:	eb ac                	jmp    802a20 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802a74:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802a77:	85 c9                	test   %ecx,%ecx
+  802a79:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a7e:	0f 49 c1             	cmovns %ecx,%eax
+  802a81:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802a84:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802a87:	e9 33 ff ff ff       	jmp    8029bf <vprintfmt+0x75>
+            lflag++;
+  802a8c:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802a8f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802a92:	e9 28 ff ff ff       	jmp    8029bf <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802a97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a9a:	83 f8 2f             	cmp    $0x2f,%eax
+  802a9d:	77 19                	ja     802ab8 <vprintfmt+0x16e>
+  802a9f:	89 c2                	mov    %eax,%edx
+  802aa1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802aa5:	83 c0 08             	add    $0x8,%eax
+  802aa8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802aab:	8b 3a                	mov    (%rdx),%edi
+  802aad:	4c 89 ee             	mov    %r13,%rsi
+  802ab0:	41 ff d6             	call   *%r14
+            break;
+  802ab3:	e9 c3 fe ff ff       	jmp    80297b <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802ab8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802abc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ac0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ac4:	eb e5                	jmp    802aab <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802ac6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ac9:	83 f8 2f             	cmp    $0x2f,%eax
+  802acc:	77 5a                	ja     802b28 <vprintfmt+0x1de>
+  802ace:	89 c2                	mov    %eax,%edx
+  802ad0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ad4:	83 c0 08             	add    $0x8,%eax
+  802ad7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802ada:	8b 02                	mov    (%rdx),%eax
+  802adc:	89 c1                	mov    %eax,%ecx
+  802ade:	f7 d9                	neg    %ecx
+  802ae0:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802ae3:	83 f9 15             	cmp    $0x15,%ecx
+  802ae6:	7f 4e                	jg     802b36 <vprintfmt+0x1ec>
+  802ae8:	48 63 c1             	movslq %ecx,%rax
+  802aeb:	48 ba 60 60 80 00 00 	movabs $0x806060,%rdx
+  802af2:	00 00 00 
+  802af5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802af9:	48 85 c0             	test   %rax,%rax
+  802afc:	74 38                	je     802b36 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802afe:	48 89 c1             	mov    %rax,%rcx
+  802b01:	48 ba 77 56 80 00 00 	movabs $0x805677,%rdx
+  802b08:	00 00 00 
+  802b0b:	4c 89 ee             	mov    %r13,%rsi
+  802b0e:	4c 89 f7             	mov    %r14,%rdi
+  802b11:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b16:	49 b8 0d 29 80 00 00 	movabs $0x80290d,%r8
+  802b1d:	00 00 00 
+  802b20:	41 ff d0             	call   *%r8
+  802b23:	e9 53 fe ff ff       	jmp    80297b <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  802b28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b34:	eb a4                	jmp    802ada <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  802b36:	48 ba 1c 5c 80 00 00 	movabs $0x805c1c,%rdx
+  802b3d:	00 00 00 
+  802b40:	4c 89 ee             	mov    %r13,%rsi
+  802b43:	4c 89 f7             	mov    %r14,%rdi
+  802b46:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b4b:	49 b8 0d 29 80 00 00 	movabs $0x80290d,%r8
+  802b52:	00 00 00 
+  802b55:	41 ff d0             	call   *%r8
+  802b58:	e9 1e fe ff ff       	jmp    80297b <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802b5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b60:	83 f8 2f             	cmp    $0x2f,%eax
+  802b63:	77 6c                	ja     802bd1 <vprintfmt+0x287>
+  802b65:	89 c2                	mov    %eax,%edx
+  802b67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b6b:	83 c0 08             	add    $0x8,%eax
+  802b6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b71:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  802b74:	48 85 d2             	test   %rdx,%rdx
+  802b77:	48 b8 15 5c 80 00 00 	movabs $0x805c15,%rax
+  802b7e:	00 00 00 
+  802b81:	48 0f 45 c2          	cmovne %rdx,%rax
+  802b85:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  802b89:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802b8d:	7e 06                	jle    802b95 <vprintfmt+0x24b>
+  802b8f:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802b93:	75 4a                	jne    802bdf <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802b95:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802b99:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  802b9d:	0f b6 00             	movzbl (%rax),%eax
+  802ba0:	84 c0                	test   %al,%al
+  802ba2:	0f 85 9a 00 00 00    	jne    802c42 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  802ba8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802bab:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802baf:	85 c0                	test   %eax,%eax
+  802bb1:	0f 8e c4 fd ff ff    	jle    80297b <vprintfmt+0x31>
+  802bb7:	4c 89 ee             	mov    %r13,%rsi
+  802bba:	bf 20 00 00 00       	mov    $0x20,%edi
+  802bbf:	41 ff d6             	call   *%r14
+  802bc2:	41 83 ec 01          	sub    $0x1,%r12d
+  802bc6:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802bca:	75 eb                	jne    802bb7 <vprintfmt+0x26d>
+  802bcc:	e9 aa fd ff ff       	jmp    80297b <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802bd1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bd5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802bd9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802bdd:	eb 92                	jmp    802b71 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802bdf:	49 63 f7             	movslq %r15d,%rsi
+  802be2:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802be6:	48 b8 fc 30 80 00 00 	movabs $0x8030fc,%rax
+  802bed:	00 00 00 
+  802bf0:	ff d0                	call   *%rax
+  802bf2:	48 89 c2             	mov    %rax,%rdx
+  802bf5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802bf8:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802bfa:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802bfd:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802c00:	85 c0                	test   %eax,%eax
+  802c02:	7e 91                	jle    802b95 <vprintfmt+0x24b>
+  802c04:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802c09:	4c 89 ee             	mov    %r13,%rsi
+  802c0c:	44 89 e7             	mov    %r12d,%edi
+  802c0f:	41 ff d6             	call   *%r14
+  802c12:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802c16:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802c19:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802c1c:	75 eb                	jne    802c09 <vprintfmt+0x2bf>
+  802c1e:	e9 72 ff ff ff       	jmp    802b95 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802c23:	0f b6 f8             	movzbl %al,%edi
+  802c26:	4c 89 ee             	mov    %r13,%rsi
+  802c29:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802c2c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802c30:	49 83 c4 01          	add    $0x1,%r12
+  802c34:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802c3a:	84 c0                	test   %al,%al
+  802c3c:	0f 84 66 ff ff ff    	je     802ba8 <vprintfmt+0x25e>
+  802c42:	45 85 ff             	test   %r15d,%r15d
+  802c45:	78 0a                	js     802c51 <vprintfmt+0x307>
+  802c47:	41 83 ef 01          	sub    $0x1,%r15d
+  802c4b:	0f 88 57 ff ff ff    	js     802ba8 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802c51:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802c55:	74 cc                	je     802c23 <vprintfmt+0x2d9>
+  802c57:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802c5a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802c5f:	80 fa 5e             	cmp    $0x5e,%dl
+  802c62:	77 c2                	ja     802c26 <vprintfmt+0x2dc>
+  802c64:	eb bd                	jmp    802c23 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  802c66:	40 84 f6             	test   %sil,%sil
+  802c69:	75 26                	jne    802c91 <vprintfmt+0x347>
+    switch (lflag) {
+  802c6b:	85 d2                	test   %edx,%edx
+  802c6d:	74 59                	je     802cc8 <vprintfmt+0x37e>
+  802c6f:	83 fa 01             	cmp    $0x1,%edx
+  802c72:	74 7b                	je     802cef <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802c74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c77:	83 f8 2f             	cmp    $0x2f,%eax
+  802c7a:	0f 87 96 00 00 00    	ja     802d16 <vprintfmt+0x3cc>
+  802c80:	89 c2                	mov    %eax,%edx
+  802c82:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c86:	83 c0 08             	add    $0x8,%eax
+  802c89:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c8c:	4c 8b 22             	mov    (%rdx),%r12
+  802c8f:	eb 17                	jmp    802ca8 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802c91:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c94:	83 f8 2f             	cmp    $0x2f,%eax
+  802c97:	77 21                	ja     802cba <vprintfmt+0x370>
+  802c99:	89 c2                	mov    %eax,%edx
+  802c9b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c9f:	83 c0 08             	add    $0x8,%eax
+  802ca2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ca5:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802ca8:	4d 85 e4             	test   %r12,%r12
+  802cab:	78 7a                	js     802d27 <vprintfmt+0x3dd>
+            num = i;
+  802cad:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802cb0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802cb5:	e9 50 02 00 00       	jmp    802f0a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802cba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cbe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cc2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cc6:	eb dd                	jmp    802ca5 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802cc8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ccb:	83 f8 2f             	cmp    $0x2f,%eax
+  802cce:	77 11                	ja     802ce1 <vprintfmt+0x397>
+  802cd0:	89 c2                	mov    %eax,%edx
+  802cd2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cd6:	83 c0 08             	add    $0x8,%eax
+  802cd9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cdc:	4c 63 22             	movslq (%rdx),%r12
+  802cdf:	eb c7                	jmp    802ca8 <vprintfmt+0x35e>
+  802ce1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ce5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ce9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ced:	eb ed                	jmp    802cdc <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802cef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cf2:	83 f8 2f             	cmp    $0x2f,%eax
+  802cf5:	77 11                	ja     802d08 <vprintfmt+0x3be>
+  802cf7:	89 c2                	mov    %eax,%edx
+  802cf9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cfd:	83 c0 08             	add    $0x8,%eax
+  802d00:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d03:	4c 8b 22             	mov    (%rdx),%r12
+  802d06:	eb a0                	jmp    802ca8 <vprintfmt+0x35e>
+  802d08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d14:	eb ed                	jmp    802d03 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802d16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d22:	e9 65 ff ff ff       	jmp    802c8c <vprintfmt+0x342>
+                putch('-', put_arg);
+  802d27:	4c 89 ee             	mov    %r13,%rsi
+  802d2a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802d2f:	41 ff d6             	call   *%r14
+                i = -i;
+  802d32:	49 f7 dc             	neg    %r12
+  802d35:	e9 73 ff ff ff       	jmp    802cad <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802d3a:	40 84 f6             	test   %sil,%sil
+  802d3d:	75 32                	jne    802d71 <vprintfmt+0x427>
+    switch (lflag) {
+  802d3f:	85 d2                	test   %edx,%edx
+  802d41:	74 5d                	je     802da0 <vprintfmt+0x456>
+  802d43:	83 fa 01             	cmp    $0x1,%edx
+  802d46:	0f 84 82 00 00 00    	je     802dce <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802d4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d4f:	83 f8 2f             	cmp    $0x2f,%eax
+  802d52:	0f 87 a5 00 00 00    	ja     802dfd <vprintfmt+0x4b3>
+  802d58:	89 c2                	mov    %eax,%edx
+  802d5a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d5e:	83 c0 08             	add    $0x8,%eax
+  802d61:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d64:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802d67:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802d6c:	e9 99 01 00 00       	jmp    802f0a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802d71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d74:	83 f8 2f             	cmp    $0x2f,%eax
+  802d77:	77 19                	ja     802d92 <vprintfmt+0x448>
+  802d79:	89 c2                	mov    %eax,%edx
+  802d7b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d7f:	83 c0 08             	add    $0x8,%eax
+  802d82:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d85:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802d88:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802d8d:	e9 78 01 00 00       	jmp    802f0a <vprintfmt+0x5c0>
+  802d92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d9e:	eb e5                	jmp    802d85 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802da0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802da3:	83 f8 2f             	cmp    $0x2f,%eax
+  802da6:	77 18                	ja     802dc0 <vprintfmt+0x476>
+  802da8:	89 c2                	mov    %eax,%edx
+  802daa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802dae:	83 c0 08             	add    $0x8,%eax
+  802db1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802db4:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802db6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802dbb:	e9 4a 01 00 00       	jmp    802f0a <vprintfmt+0x5c0>
+  802dc0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802dc4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802dc8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802dcc:	eb e6                	jmp    802db4 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802dce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802dd1:	83 f8 2f             	cmp    $0x2f,%eax
+  802dd4:	77 19                	ja     802def <vprintfmt+0x4a5>
+  802dd6:	89 c2                	mov    %eax,%edx
+  802dd8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ddc:	83 c0 08             	add    $0x8,%eax
+  802ddf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802de2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802de5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802dea:	e9 1b 01 00 00       	jmp    802f0a <vprintfmt+0x5c0>
+  802def:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802df3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802df7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802dfb:	eb e5                	jmp    802de2 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802dfd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e01:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e09:	e9 56 ff ff ff       	jmp    802d64 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802e0e:	40 84 f6             	test   %sil,%sil
+  802e11:	75 2e                	jne    802e41 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802e13:	85 d2                	test   %edx,%edx
+  802e15:	74 59                	je     802e70 <vprintfmt+0x526>
+  802e17:	83 fa 01             	cmp    $0x1,%edx
+  802e1a:	74 7f                	je     802e9b <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802e1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e1f:	83 f8 2f             	cmp    $0x2f,%eax
+  802e22:	0f 87 9f 00 00 00    	ja     802ec7 <vprintfmt+0x57d>
+  802e28:	89 c2                	mov    %eax,%edx
+  802e2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e2e:	83 c0 08             	add    $0x8,%eax
+  802e31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e34:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802e37:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802e3c:	e9 c9 00 00 00       	jmp    802f0a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802e41:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e44:	83 f8 2f             	cmp    $0x2f,%eax
+  802e47:	77 19                	ja     802e62 <vprintfmt+0x518>
+  802e49:	89 c2                	mov    %eax,%edx
+  802e4b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e4f:	83 c0 08             	add    $0x8,%eax
+  802e52:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e55:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802e58:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802e5d:	e9 a8 00 00 00       	jmp    802f0a <vprintfmt+0x5c0>
+  802e62:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e66:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e6e:	eb e5                	jmp    802e55 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802e70:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e73:	83 f8 2f             	cmp    $0x2f,%eax
+  802e76:	77 15                	ja     802e8d <vprintfmt+0x543>
+  802e78:	89 c2                	mov    %eax,%edx
+  802e7a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e7e:	83 c0 08             	add    $0x8,%eax
+  802e81:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e84:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802e86:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802e8b:	eb 7d                	jmp    802f0a <vprintfmt+0x5c0>
+  802e8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e99:	eb e9                	jmp    802e84 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802e9b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e9e:	83 f8 2f             	cmp    $0x2f,%eax
+  802ea1:	77 16                	ja     802eb9 <vprintfmt+0x56f>
+  802ea3:	89 c2                	mov    %eax,%edx
+  802ea5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ea9:	83 c0 08             	add    $0x8,%eax
+  802eac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802eaf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802eb2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802eb7:	eb 51                	jmp    802f0a <vprintfmt+0x5c0>
+  802eb9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ebd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ec1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ec5:	eb e8                	jmp    802eaf <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802ec7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ecb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ecf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ed3:	e9 5c ff ff ff       	jmp    802e34 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802ed8:	4c 89 ee             	mov    %r13,%rsi
+  802edb:	bf 30 00 00 00       	mov    $0x30,%edi
+  802ee0:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802ee3:	4c 89 ee             	mov    %r13,%rsi
+  802ee6:	bf 78 00 00 00       	mov    $0x78,%edi
+  802eeb:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802eee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ef1:	83 f8 2f             	cmp    $0x2f,%eax
+  802ef4:	77 47                	ja     802f3d <vprintfmt+0x5f3>
+  802ef6:	89 c2                	mov    %eax,%edx
+  802ef8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802efc:	83 c0 08             	add    $0x8,%eax
+  802eff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f02:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802f05:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802f0a:	48 83 ec 08          	sub    $0x8,%rsp
+  802f0e:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802f12:	0f 94 c0             	sete   %al
+  802f15:	0f b6 c0             	movzbl %al,%eax
+  802f18:	50                   	push   %rax
+  802f19:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802f1e:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802f22:	4c 89 ee             	mov    %r13,%rsi
+  802f25:	4c 89 f7             	mov    %r14,%rdi
+  802f28:	48 b8 3f 28 80 00 00 	movabs $0x80283f,%rax
+  802f2f:	00 00 00 
+  802f32:	ff d0                	call   *%rax
+            break;
+  802f34:	48 83 c4 10          	add    $0x10,%rsp
+  802f38:	e9 3e fa ff ff       	jmp    80297b <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802f3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802f41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802f45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f49:	eb b7                	jmp    802f02 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802f4b:	40 84 f6             	test   %sil,%sil
+  802f4e:	75 2b                	jne    802f7b <vprintfmt+0x631>
+    switch (lflag) {
+  802f50:	85 d2                	test   %edx,%edx
+  802f52:	74 56                	je     802faa <vprintfmt+0x660>
+  802f54:	83 fa 01             	cmp    $0x1,%edx
+  802f57:	74 7f                	je     802fd8 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  802f59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f5c:	83 f8 2f             	cmp    $0x2f,%eax
+  802f5f:	0f 87 a2 00 00 00    	ja     803007 <vprintfmt+0x6bd>
+  802f65:	89 c2                	mov    %eax,%edx
+  802f67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802f6b:	83 c0 08             	add    $0x8,%eax
+  802f6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f71:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802f74:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802f79:	eb 8f                	jmp    802f0a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802f7b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f7e:	83 f8 2f             	cmp    $0x2f,%eax
+  802f81:	77 19                	ja     802f9c <vprintfmt+0x652>
+  802f83:	89 c2                	mov    %eax,%edx
+  802f85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802f89:	83 c0 08             	add    $0x8,%eax
+  802f8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f8f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802f92:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802f97:	e9 6e ff ff ff       	jmp    802f0a <vprintfmt+0x5c0>
+  802f9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fa0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802fa4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fa8:	eb e5                	jmp    802f8f <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802faa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fad:	83 f8 2f             	cmp    $0x2f,%eax
+  802fb0:	77 18                	ja     802fca <vprintfmt+0x680>
+  802fb2:	89 c2                	mov    %eax,%edx
+  802fb4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802fb8:	83 c0 08             	add    $0x8,%eax
+  802fbb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802fbe:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802fc0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802fc5:	e9 40 ff ff ff       	jmp    802f0a <vprintfmt+0x5c0>
+  802fca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802fd2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fd6:	eb e6                	jmp    802fbe <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802fd8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fdb:	83 f8 2f             	cmp    $0x2f,%eax
+  802fde:	77 19                	ja     802ff9 <vprintfmt+0x6af>
+  802fe0:	89 c2                	mov    %eax,%edx
+  802fe2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802fe6:	83 c0 08             	add    $0x8,%eax
+  802fe9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802fec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802fef:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802ff4:	e9 11 ff ff ff       	jmp    802f0a <vprintfmt+0x5c0>
+  802ff9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ffd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803001:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803005:	eb e5                	jmp    802fec <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803007:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80300b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80300f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803013:	e9 59 ff ff ff       	jmp    802f71 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803018:	4c 89 ee             	mov    %r13,%rsi
+  80301b:	bf 25 00 00 00       	mov    $0x25,%edi
+  803020:	41 ff d6             	call   *%r14
+            break;
+  803023:	e9 53 f9 ff ff       	jmp    80297b <vprintfmt+0x31>
+            putch('%', put_arg);
+  803028:	4c 89 ee             	mov    %r13,%rsi
+  80302b:	bf 25 00 00 00       	mov    $0x25,%edi
+  803030:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803033:	48 83 eb 01          	sub    $0x1,%rbx
+  803037:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80303b:	75 f6                	jne    803033 <vprintfmt+0x6e9>
+  80303d:	e9 39 f9 ff ff       	jmp    80297b <vprintfmt+0x31>
+}
+  803042:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803046:	5b                   	pop    %rbx
+  803047:	41 5c                	pop    %r12
+  803049:	41 5d                	pop    %r13
+  80304b:	41 5e                	pop    %r14
+  80304d:	41 5f                	pop    %r15
+  80304f:	5d                   	pop    %rbp
+  803050:	c3                   	ret
+
+0000000000803051 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803051:	55                   	push   %rbp
+  803052:	48 89 e5             	mov    %rsp,%rbp
+  803055:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803059:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80305d:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803062:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803066:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80306d:	48 85 ff             	test   %rdi,%rdi
+  803070:	74 2b                	je     80309d <vsnprintf+0x4c>
+  803072:	48 85 f6             	test   %rsi,%rsi
+  803075:	74 26                	je     80309d <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803077:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80307b:	48 bf f5 28 80 00 00 	movabs $0x8028f5,%rdi
+  803082:	00 00 00 
+  803085:	48 b8 4a 29 80 00 00 	movabs $0x80294a,%rax
+  80308c:	00 00 00 
+  80308f:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803091:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803095:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803098:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80309b:	c9                   	leave
+  80309c:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80309d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030a2:	eb f7                	jmp    80309b <vsnprintf+0x4a>
+
+00000000008030a4 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8030a4:	55                   	push   %rbp
+  8030a5:	48 89 e5             	mov    %rsp,%rbp
+  8030a8:	48 83 ec 50          	sub    $0x50,%rsp
+  8030ac:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8030b0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8030b4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8030b8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8030bf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8030c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030c7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8030cb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8030cf:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8030d3:	48 b8 51 30 80 00 00 	movabs $0x803051,%rax
+  8030da:	00 00 00 
+  8030dd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8030df:	c9                   	leave
+  8030e0:	c3                   	ret
+
+00000000008030e1 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8030e1:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8030e4:	74 10                	je     8030f6 <strlen+0x15>
+    size_t n = 0;
+  8030e6:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8030eb:	48 83 c0 01          	add    $0x1,%rax
+  8030ef:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8030f3:	75 f6                	jne    8030eb <strlen+0xa>
+  8030f5:	c3                   	ret
+    size_t n = 0;
+  8030f6:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8030fb:	c3                   	ret
+
+00000000008030fc <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8030fc:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8030ff:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803104:	48 85 f6             	test   %rsi,%rsi
+  803107:	74 11                	je     80311a <strnlen+0x1e>
+  803109:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80310d:	74 0c                	je     80311b <strnlen+0x1f>
+  80310f:	48 83 c2 01          	add    $0x1,%rdx
+  803113:	48 39 d0             	cmp    %rdx,%rax
+  803116:	75 f1                	jne    803109 <strnlen+0xd>
+  803118:	eb 04                	jmp    80311e <strnlen+0x22>
+  80311a:	c3                   	ret
+  80311b:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80311e:	c3                   	ret
+
+000000000080311f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80311f:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803122:	ba 00 00 00 00       	mov    $0x0,%edx
+  803127:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80312b:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80312e:	48 83 c2 01          	add    $0x1,%rdx
+  803132:	84 c9                	test   %cl,%cl
+  803134:	75 f1                	jne    803127 <strcpy+0x8>
+        ;
+    return res;
+}
+  803136:	c3                   	ret
+
+0000000000803137 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803137:	55                   	push   %rbp
+  803138:	48 89 e5             	mov    %rsp,%rbp
+  80313b:	41 54                	push   %r12
+  80313d:	53                   	push   %rbx
+  80313e:	48 89 fb             	mov    %rdi,%rbx
+  803141:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803144:	48 b8 e1 30 80 00 00 	movabs $0x8030e1,%rax
+  80314b:	00 00 00 
+  80314e:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803150:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803154:	4c 89 e6             	mov    %r12,%rsi
+  803157:	48 b8 1f 31 80 00 00 	movabs $0x80311f,%rax
+  80315e:	00 00 00 
+  803161:	ff d0                	call   *%rax
+    return dst;
+}
+  803163:	48 89 d8             	mov    %rbx,%rax
+  803166:	5b                   	pop    %rbx
+  803167:	41 5c                	pop    %r12
+  803169:	5d                   	pop    %rbp
+  80316a:	c3                   	ret
+
+000000000080316b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80316b:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80316e:	48 85 d2             	test   %rdx,%rdx
+  803171:	74 1f                	je     803192 <strncpy+0x27>
+  803173:	48 01 fa             	add    %rdi,%rdx
+  803176:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803179:	48 83 c1 01          	add    $0x1,%rcx
+  80317d:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803181:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803185:	41 80 f8 01          	cmp    $0x1,%r8b
+  803189:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80318d:	48 39 ca             	cmp    %rcx,%rdx
+  803190:	75 e7                	jne    803179 <strncpy+0xe>
+    }
+    return ret;
+}
+  803192:	c3                   	ret
+
+0000000000803193 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803193:	48 89 f8             	mov    %rdi,%rax
+  803196:	48 85 d2             	test   %rdx,%rdx
+  803199:	74 24                	je     8031bf <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80319b:	48 83 ea 01          	sub    $0x1,%rdx
+  80319f:	74 1b                	je     8031bc <strlcpy+0x29>
+  8031a1:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8031a5:	0f b6 16             	movzbl (%rsi),%edx
+  8031a8:	84 d2                	test   %dl,%dl
+  8031aa:	74 10                	je     8031bc <strlcpy+0x29>
+            *dst++ = *src++;
+  8031ac:	48 83 c6 01          	add    $0x1,%rsi
+  8031b0:	48 83 c0 01          	add    $0x1,%rax
+  8031b4:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8031b7:	48 39 c8             	cmp    %rcx,%rax
+  8031ba:	75 e9                	jne    8031a5 <strlcpy+0x12>
+        *dst = '\0';
+  8031bc:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8031bf:	48 29 f8             	sub    %rdi,%rax
+}
+  8031c2:	c3                   	ret
+
+00000000008031c3 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8031c3:	0f b6 07             	movzbl (%rdi),%eax
+  8031c6:	84 c0                	test   %al,%al
+  8031c8:	74 13                	je     8031dd <strcmp+0x1a>
+  8031ca:	38 06                	cmp    %al,(%rsi)
+  8031cc:	75 0f                	jne    8031dd <strcmp+0x1a>
+  8031ce:	48 83 c7 01          	add    $0x1,%rdi
+  8031d2:	48 83 c6 01          	add    $0x1,%rsi
+  8031d6:	0f b6 07             	movzbl (%rdi),%eax
+  8031d9:	84 c0                	test   %al,%al
+  8031db:	75 ed                	jne    8031ca <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8031dd:	0f b6 c0             	movzbl %al,%eax
+  8031e0:	0f b6 16             	movzbl (%rsi),%edx
+  8031e3:	29 d0                	sub    %edx,%eax
+}
+  8031e5:	c3                   	ret
+
+00000000008031e6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8031e6:	48 85 d2             	test   %rdx,%rdx
+  8031e9:	74 1f                	je     80320a <strncmp+0x24>
+  8031eb:	0f b6 07             	movzbl (%rdi),%eax
+  8031ee:	84 c0                	test   %al,%al
+  8031f0:	74 1e                	je     803210 <strncmp+0x2a>
+  8031f2:	3a 06                	cmp    (%rsi),%al
+  8031f4:	75 1a                	jne    803210 <strncmp+0x2a>
+  8031f6:	48 83 c7 01          	add    $0x1,%rdi
+  8031fa:	48 83 c6 01          	add    $0x1,%rsi
+  8031fe:	48 83 ea 01          	sub    $0x1,%rdx
+  803202:	75 e7                	jne    8031eb <strncmp+0x5>
+
+    if (!n) return 0;
+  803204:	b8 00 00 00 00       	mov    $0x0,%eax
+  803209:	c3                   	ret
+  80320a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80320f:	c3                   	ret
+  803210:	48 85 d2             	test   %rdx,%rdx
+  803213:	74 09                	je     80321e <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803215:	0f b6 07             	movzbl (%rdi),%eax
+  803218:	0f b6 16             	movzbl (%rsi),%edx
+  80321b:	29 d0                	sub    %edx,%eax
+  80321d:	c3                   	ret
+    if (!n) return 0;
+  80321e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803223:	c3                   	ret
+
+0000000000803224 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803224:	0f b6 17             	movzbl (%rdi),%edx
+  803227:	84 d2                	test   %dl,%dl
+  803229:	74 18                	je     803243 <strchr+0x1f>
+        if (*str == c) {
+  80322b:	0f be d2             	movsbl %dl,%edx
+  80322e:	39 f2                	cmp    %esi,%edx
+  803230:	74 17                	je     803249 <strchr+0x25>
+    for (; *str; str++) {
+  803232:	48 83 c7 01          	add    $0x1,%rdi
+  803236:	0f b6 17             	movzbl (%rdi),%edx
+  803239:	84 d2                	test   %dl,%dl
+  80323b:	75 ee                	jne    80322b <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80323d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803242:	c3                   	ret
+  803243:	b8 00 00 00 00       	mov    $0x0,%eax
+  803248:	c3                   	ret
+  803249:	48 89 f8             	mov    %rdi,%rax
+}
+  80324c:	c3                   	ret
+
+000000000080324d <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80324d:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803250:	0f b6 17             	movzbl (%rdi),%edx
+  803253:	84 d2                	test   %dl,%dl
+  803255:	74 13                	je     80326a <strfind+0x1d>
+  803257:	0f be d2             	movsbl %dl,%edx
+  80325a:	39 f2                	cmp    %esi,%edx
+  80325c:	74 0b                	je     803269 <strfind+0x1c>
+  80325e:	48 83 c0 01          	add    $0x1,%rax
+  803262:	0f b6 10             	movzbl (%rax),%edx
+  803265:	84 d2                	test   %dl,%dl
+  803267:	75 ee                	jne    803257 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803269:	c3                   	ret
+  80326a:	c3                   	ret
+
+000000000080326b <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80326b:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80326e:	48 89 f8             	mov    %rdi,%rax
+  803271:	48 f7 d8             	neg    %rax
+  803274:	83 e0 07             	and    $0x7,%eax
+  803277:	49 89 d1             	mov    %rdx,%r9
+  80327a:	49 29 c1             	sub    %rax,%r9
+  80327d:	78 36                	js     8032b5 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80327f:	40 0f b6 c6          	movzbl %sil,%eax
+  803283:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80328a:	01 01 01 
+  80328d:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803291:	40 f6 c7 07          	test   $0x7,%dil
+  803295:	75 38                	jne    8032cf <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803297:	4c 89 c9             	mov    %r9,%rcx
+  80329a:	48 c1 f9 03          	sar    $0x3,%rcx
+  80329e:	74 0c                	je     8032ac <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8032a0:	fc                   	cld
+  8032a1:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8032a4:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8032a8:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8032ac:	4d 85 c9             	test   %r9,%r9
+  8032af:	75 45                	jne    8032f6 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8032b1:	4c 89 c0             	mov    %r8,%rax
+  8032b4:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8032b5:	48 85 d2             	test   %rdx,%rdx
+  8032b8:	74 f7                	je     8032b1 <memset+0x46>
+  8032ba:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8032bd:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8032c0:	48 83 c0 01          	add    $0x1,%rax
+  8032c4:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8032c8:	48 39 c2             	cmp    %rax,%rdx
+  8032cb:	75 f3                	jne    8032c0 <memset+0x55>
+  8032cd:	eb e2                	jmp    8032b1 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8032cf:	40 f6 c7 01          	test   $0x1,%dil
+  8032d3:	74 06                	je     8032db <memset+0x70>
+  8032d5:	88 07                	mov    %al,(%rdi)
+  8032d7:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8032db:	40 f6 c7 02          	test   $0x2,%dil
+  8032df:	74 07                	je     8032e8 <memset+0x7d>
+  8032e1:	66 89 07             	mov    %ax,(%rdi)
+  8032e4:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8032e8:	40 f6 c7 04          	test   $0x4,%dil
+  8032ec:	74 a9                	je     803297 <memset+0x2c>
+  8032ee:	89 07                	mov    %eax,(%rdi)
+  8032f0:	48 83 c7 04          	add    $0x4,%rdi
+  8032f4:	eb a1                	jmp    803297 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8032f6:	41 f6 c1 04          	test   $0x4,%r9b
+  8032fa:	74 06                	je     803302 <memset+0x97>
+  8032fc:	89 07                	mov    %eax,(%rdi)
+  8032fe:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803302:	41 f6 c1 02          	test   $0x2,%r9b
+  803306:	74 07                	je     80330f <memset+0xa4>
+  803308:	66 89 07             	mov    %ax,(%rdi)
+  80330b:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80330f:	41 f6 c1 01          	test   $0x1,%r9b
+  803313:	74 9c                	je     8032b1 <memset+0x46>
+  803315:	88 07                	mov    %al,(%rdi)
+  803317:	eb 98                	jmp    8032b1 <memset+0x46>
+
+0000000000803319 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803319:	48 89 f8             	mov    %rdi,%rax
+  80331c:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80331f:	48 39 fe             	cmp    %rdi,%rsi
+  803322:	73 3b                	jae    80335f <memmove+0x46>
+  803324:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803328:	48 39 d7             	cmp    %rdx,%rdi
+  80332b:	73 32                	jae    80335f <memmove+0x46>
+        s += n;
+        d += n;
+  80332d:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803331:	48 89 d6             	mov    %rdx,%rsi
+  803334:	48 09 fe             	or     %rdi,%rsi
+  803337:	48 09 ce             	or     %rcx,%rsi
+  80333a:	40 f6 c6 07          	test   $0x7,%sil
+  80333e:	75 12                	jne    803352 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803340:	48 83 ef 08          	sub    $0x8,%rdi
+  803344:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803348:	48 c1 e9 03          	shr    $0x3,%rcx
+  80334c:	fd                   	std
+  80334d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803350:	fc                   	cld
+  803351:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803352:	48 83 ef 01          	sub    $0x1,%rdi
+  803356:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80335a:	fd                   	std
+  80335b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80335d:	eb f1                	jmp    803350 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80335f:	48 89 f2             	mov    %rsi,%rdx
+  803362:	48 09 c2             	or     %rax,%rdx
+  803365:	48 09 ca             	or     %rcx,%rdx
+  803368:	f6 c2 07             	test   $0x7,%dl
+  80336b:	75 0c                	jne    803379 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80336d:	48 c1 e9 03          	shr    $0x3,%rcx
+  803371:	48 89 c7             	mov    %rax,%rdi
+  803374:	fc                   	cld
+  803375:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  803378:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  803379:	48 89 c7             	mov    %rax,%rdi
+  80337c:	fc                   	cld
+  80337d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80337f:	c3                   	ret
+
+0000000000803380 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  803380:	55                   	push   %rbp
+  803381:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803384:	48 b8 19 33 80 00 00 	movabs $0x803319,%rax
+  80338b:	00 00 00 
+  80338e:	ff d0                	call   *%rax
+}
+  803390:	5d                   	pop    %rbp
+  803391:	c3                   	ret
+
+0000000000803392 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803392:	55                   	push   %rbp
+  803393:	48 89 e5             	mov    %rsp,%rbp
+  803396:	41 57                	push   %r15
+  803398:	41 56                	push   %r14
+  80339a:	41 55                	push   %r13
+  80339c:	41 54                	push   %r12
+  80339e:	53                   	push   %rbx
+  80339f:	48 83 ec 08          	sub    $0x8,%rsp
+  8033a3:	49 89 fe             	mov    %rdi,%r14
+  8033a6:	49 89 f7             	mov    %rsi,%r15
+  8033a9:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8033ac:	48 89 f7             	mov    %rsi,%rdi
+  8033af:	48 b8 e1 30 80 00 00 	movabs $0x8030e1,%rax
+  8033b6:	00 00 00 
+  8033b9:	ff d0                	call   *%rax
+  8033bb:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8033be:	48 89 de             	mov    %rbx,%rsi
+  8033c1:	4c 89 f7             	mov    %r14,%rdi
+  8033c4:	48 b8 fc 30 80 00 00 	movabs $0x8030fc,%rax
+  8033cb:	00 00 00 
+  8033ce:	ff d0                	call   *%rax
+  8033d0:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8033d3:	48 39 c3             	cmp    %rax,%rbx
+  8033d6:	74 36                	je     80340e <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8033d8:	48 89 d8             	mov    %rbx,%rax
+  8033db:	4c 29 e8             	sub    %r13,%rax
+  8033de:	49 39 c4             	cmp    %rax,%r12
+  8033e1:	73 31                	jae    803414 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8033e3:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8033e8:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8033ec:	4c 89 fe             	mov    %r15,%rsi
+  8033ef:	48 b8 80 33 80 00 00 	movabs $0x803380,%rax
+  8033f6:	00 00 00 
+  8033f9:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8033fb:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8033ff:	48 83 c4 08          	add    $0x8,%rsp
+  803403:	5b                   	pop    %rbx
+  803404:	41 5c                	pop    %r12
+  803406:	41 5d                	pop    %r13
+  803408:	41 5e                	pop    %r14
+  80340a:	41 5f                	pop    %r15
+  80340c:	5d                   	pop    %rbp
+  80340d:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80340e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803412:	eb eb                	jmp    8033ff <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803414:	48 83 eb 01          	sub    $0x1,%rbx
+  803418:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80341c:	48 89 da             	mov    %rbx,%rdx
+  80341f:	4c 89 fe             	mov    %r15,%rsi
+  803422:	48 b8 80 33 80 00 00 	movabs $0x803380,%rax
+  803429:	00 00 00 
+  80342c:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80342e:	49 01 de             	add    %rbx,%r14
+  803431:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803436:	eb c3                	jmp    8033fb <strlcat+0x69>
+
+0000000000803438 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803438:	48 85 d2             	test   %rdx,%rdx
+  80343b:	74 2d                	je     80346a <memcmp+0x32>
+  80343d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803442:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803446:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80344b:	44 38 c1             	cmp    %r8b,%cl
+  80344e:	75 0f                	jne    80345f <memcmp+0x27>
+    while (n-- > 0) {
+  803450:	48 83 c0 01          	add    $0x1,%rax
+  803454:	48 39 c2             	cmp    %rax,%rdx
+  803457:	75 e9                	jne    803442 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803459:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345e:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80345f:	0f b6 c1             	movzbl %cl,%eax
+  803462:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803466:	44 29 c0             	sub    %r8d,%eax
+  803469:	c3                   	ret
+    return 0;
+  80346a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80346f:	c3                   	ret
+
+0000000000803470 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  803470:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  803474:	48 39 c7             	cmp    %rax,%rdi
+  803477:	73 0f                	jae    803488 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  803479:	40 38 37             	cmp    %sil,(%rdi)
+  80347c:	74 0e                	je     80348c <memfind+0x1c>
+    for (; src < end; src++) {
+  80347e:	48 83 c7 01          	add    $0x1,%rdi
+  803482:	48 39 f8             	cmp    %rdi,%rax
+  803485:	75 f2                	jne    803479 <memfind+0x9>
+  803487:	c3                   	ret
+  803488:	48 89 f8             	mov    %rdi,%rax
+  80348b:	c3                   	ret
+  80348c:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80348f:	c3                   	ret
+
+0000000000803490 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803490:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803493:	0f b6 37             	movzbl (%rdi),%esi
+  803496:	40 80 fe 20          	cmp    $0x20,%sil
+  80349a:	74 06                	je     8034a2 <strtol+0x12>
+  80349c:	40 80 fe 09          	cmp    $0x9,%sil
+  8034a0:	75 13                	jne    8034b5 <strtol+0x25>
+  8034a2:	48 83 c7 01          	add    $0x1,%rdi
+  8034a6:	0f b6 37             	movzbl (%rdi),%esi
+  8034a9:	40 80 fe 20          	cmp    $0x20,%sil
+  8034ad:	74 f3                	je     8034a2 <strtol+0x12>
+  8034af:	40 80 fe 09          	cmp    $0x9,%sil
+  8034b3:	74 ed                	je     8034a2 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8034b5:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8034b8:	83 e0 fd             	and    $0xfffffffd,%eax
+  8034bb:	3c 01                	cmp    $0x1,%al
+  8034bd:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8034c1:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8034c7:	75 0f                	jne    8034d8 <strtol+0x48>
+  8034c9:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8034cc:	74 14                	je     8034e2 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8034ce:	85 d2                	test   %edx,%edx
+  8034d0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8034d5:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8034d8:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8034dd:	4c 63 ca             	movslq %edx,%r9
+  8034e0:	eb 36                	jmp    803518 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8034e2:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8034e6:	74 0f                	je     8034f7 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8034e8:	85 d2                	test   %edx,%edx
+  8034ea:	75 ec                	jne    8034d8 <strtol+0x48>
+        s++;
+  8034ec:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8034f0:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8034f5:	eb e1                	jmp    8034d8 <strtol+0x48>
+        s += 2;
+  8034f7:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8034fb:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803500:	eb d6                	jmp    8034d8 <strtol+0x48>
+            dig -= '0';
+  803502:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803505:	44 0f b6 c1          	movzbl %cl,%r8d
+  803509:	41 39 d0             	cmp    %edx,%r8d
+  80350c:	7d 21                	jge    80352f <strtol+0x9f>
+        val = val * base + dig;
+  80350e:	49 0f af c1          	imul   %r9,%rax
+  803512:	0f b6 c9             	movzbl %cl,%ecx
+  803515:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803518:	48 83 c7 01          	add    $0x1,%rdi
+  80351c:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803520:	80 f9 39             	cmp    $0x39,%cl
+  803523:	76 dd                	jbe    803502 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803525:	80 f9 7b             	cmp    $0x7b,%cl
+  803528:	77 05                	ja     80352f <strtol+0x9f>
+            dig -= 'a' - 10;
+  80352a:	83 e9 57             	sub    $0x57,%ecx
+  80352d:	eb d6                	jmp    803505 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80352f:	4d 85 d2             	test   %r10,%r10
+  803532:	74 03                	je     803537 <strtol+0xa7>
+  803534:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803537:	48 89 c2             	mov    %rax,%rdx
+  80353a:	48 f7 da             	neg    %rdx
+  80353d:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803541:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803545:	c3                   	ret
+
+0000000000803546 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  803546:	55                   	push   %rbp
+  803547:	48 89 e5             	mov    %rsp,%rbp
+  80354a:	53                   	push   %rbx
+  80354b:	48 89 fa             	mov    %rdi,%rdx
+  80354e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803551:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803556:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80355b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803560:	be 00 00 00 00       	mov    $0x0,%esi
+  803565:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80356b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80356d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803571:	c9                   	leave
+  803572:	c3                   	ret
+
+0000000000803573 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  803573:	55                   	push   %rbp
+  803574:	48 89 e5             	mov    %rsp,%rbp
+  803577:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803578:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80357d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803582:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803587:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80358c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803591:	be 00 00 00 00       	mov    $0x0,%esi
+  803596:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80359c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80359e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035a2:	c9                   	leave
+  8035a3:	c3                   	ret
+
+00000000008035a4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8035a4:	55                   	push   %rbp
+  8035a5:	48 89 e5             	mov    %rsp,%rbp
+  8035a8:	53                   	push   %rbx
+  8035a9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8035ad:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8035b0:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8035b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8035ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8035c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8035c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8035cf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8035d1:	48 85 c0             	test   %rax,%rax
+  8035d4:	7f 06                	jg     8035dc <sys_env_destroy+0x38>
+}
+  8035d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035da:	c9                   	leave
+  8035db:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8035dc:	49 89 c0             	mov    %rax,%r8
+  8035df:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8035e4:	48 ba 30 61 80 00 00 	movabs $0x806130,%rdx
+  8035eb:	00 00 00 
+  8035ee:	be 26 00 00 00       	mov    $0x26,%esi
+  8035f3:	48 bf 4f 61 80 00 00 	movabs $0x80614f,%rdi
+  8035fa:	00 00 00 
+  8035fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803602:	49 b9 aa 26 80 00 00 	movabs $0x8026aa,%r9
+  803609:	00 00 00 
+  80360c:	41 ff d1             	call   *%r9
+
+000000000080360f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80360f:	55                   	push   %rbp
+  803610:	48 89 e5             	mov    %rsp,%rbp
+  803613:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803614:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803619:	ba 00 00 00 00       	mov    $0x0,%edx
+  80361e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803623:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803628:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80362d:	be 00 00 00 00       	mov    $0x0,%esi
+  803632:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803638:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80363a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80363e:	c9                   	leave
+  80363f:	c3                   	ret
+
+0000000000803640 <sys_yield>:
+
+void
+sys_yield(void) {
+  803640:	55                   	push   %rbp
+  803641:	48 89 e5             	mov    %rsp,%rbp
+  803644:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803645:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80364a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80364f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803654:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803659:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80365e:	be 00 00 00 00       	mov    $0x0,%esi
+  803663:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803669:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80366b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80366f:	c9                   	leave
+  803670:	c3                   	ret
+
+0000000000803671 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  803671:	55                   	push   %rbp
+  803672:	48 89 e5             	mov    %rsp,%rbp
+  803675:	53                   	push   %rbx
+  803676:	48 89 fa             	mov    %rdi,%rdx
+  803679:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80367c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803681:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  803688:	00 00 00 
+  80368b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803690:	be 00 00 00 00       	mov    $0x0,%esi
+  803695:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80369b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80369d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036a1:	c9                   	leave
+  8036a2:	c3                   	ret
+
+00000000008036a3 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8036a3:	55                   	push   %rbp
+  8036a4:	48 89 e5             	mov    %rsp,%rbp
+  8036a7:	53                   	push   %rbx
+  8036a8:	49 89 f8             	mov    %rdi,%r8
+  8036ab:	48 89 d3             	mov    %rdx,%rbx
+  8036ae:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8036b1:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8036b6:	4c 89 c2             	mov    %r8,%rdx
+  8036b9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8036bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8036c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8036c7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8036c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036cd:	c9                   	leave
+  8036ce:	c3                   	ret
+
+00000000008036cf <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8036cf:	55                   	push   %rbp
+  8036d0:	48 89 e5             	mov    %rsp,%rbp
+  8036d3:	53                   	push   %rbx
+  8036d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8036d8:	89 f8                	mov    %edi,%eax
+  8036da:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8036dd:	48 63 f9             	movslq %ecx,%rdi
+  8036e0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8036e3:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8036e8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8036eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8036f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8036f6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8036f8:	48 85 c0             	test   %rax,%rax
+  8036fb:	7f 06                	jg     803703 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8036fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803701:	c9                   	leave
+  803702:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803703:	49 89 c0             	mov    %rax,%r8
+  803706:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80370b:	48 ba 30 61 80 00 00 	movabs $0x806130,%rdx
+  803712:	00 00 00 
+  803715:	be 26 00 00 00       	mov    $0x26,%esi
+  80371a:	48 bf 4f 61 80 00 00 	movabs $0x80614f,%rdi
+  803721:	00 00 00 
+  803724:	b8 00 00 00 00       	mov    $0x0,%eax
+  803729:	49 b9 aa 26 80 00 00 	movabs $0x8026aa,%r9
+  803730:	00 00 00 
+  803733:	41 ff d1             	call   *%r9
+
+0000000000803736 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  803736:	55                   	push   %rbp
+  803737:	48 89 e5             	mov    %rsp,%rbp
+  80373a:	53                   	push   %rbx
+  80373b:	48 83 ec 08          	sub    $0x8,%rsp
+  80373f:	89 f8                	mov    %edi,%eax
+  803741:	49 89 f2             	mov    %rsi,%r10
+  803744:	48 89 cf             	mov    %rcx,%rdi
+  803747:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80374a:	48 63 da             	movslq %edx,%rbx
+  80374d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803750:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803755:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803758:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80375b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80375d:	48 85 c0             	test   %rax,%rax
+  803760:	7f 06                	jg     803768 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  803762:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803766:	c9                   	leave
+  803767:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803768:	49 89 c0             	mov    %rax,%r8
+  80376b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803770:	48 ba 30 61 80 00 00 	movabs $0x806130,%rdx
+  803777:	00 00 00 
+  80377a:	be 26 00 00 00       	mov    $0x26,%esi
+  80377f:	48 bf 4f 61 80 00 00 	movabs $0x80614f,%rdi
+  803786:	00 00 00 
+  803789:	b8 00 00 00 00       	mov    $0x0,%eax
+  80378e:	49 b9 aa 26 80 00 00 	movabs $0x8026aa,%r9
+  803795:	00 00 00 
+  803798:	41 ff d1             	call   *%r9
+
+000000000080379b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80379b:	55                   	push   %rbp
+  80379c:	48 89 e5             	mov    %rsp,%rbp
+  80379f:	53                   	push   %rbx
+  8037a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8037a4:	48 89 f1             	mov    %rsi,%rcx
+  8037a7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8037aa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8037ad:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8037b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8037b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8037bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8037c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8037c4:	48 85 c0             	test   %rax,%rax
+  8037c7:	7f 06                	jg     8037cf <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8037c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037cd:	c9                   	leave
+  8037ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8037cf:	49 89 c0             	mov    %rax,%r8
+  8037d2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8037d7:	48 ba 30 61 80 00 00 	movabs $0x806130,%rdx
+  8037de:	00 00 00 
+  8037e1:	be 26 00 00 00       	mov    $0x26,%esi
+  8037e6:	48 bf 4f 61 80 00 00 	movabs $0x80614f,%rdi
+  8037ed:	00 00 00 
+  8037f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f5:	49 b9 aa 26 80 00 00 	movabs $0x8026aa,%r9
+  8037fc:	00 00 00 
+  8037ff:	41 ff d1             	call   *%r9
+
+0000000000803802 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  803802:	55                   	push   %rbp
+  803803:	48 89 e5             	mov    %rsp,%rbp
+  803806:	53                   	push   %rbx
+  803807:	48 83 ec 08          	sub    $0x8,%rsp
+  80380b:	89 f8                	mov    %edi,%eax
+  80380d:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  803810:	48 63 f9             	movslq %ecx,%rdi
+  803813:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803816:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80381b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80381e:	be 00 00 00 00       	mov    $0x0,%esi
+  803823:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803829:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80382b:	48 85 c0             	test   %rax,%rax
+  80382e:	7f 06                	jg     803836 <sys_region_advise+0x34>
+}
+  803830:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803834:	c9                   	leave
+  803835:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803836:	49 89 c0             	mov    %rax,%r8
+  803839:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80383e:	48 ba 30 61 80 00 00 	movabs $0x806130,%rdx
+  803845:	00 00 00 
+  803848:	be 26 00 00 00       	mov    $0x26,%esi
+  80384d:	48 bf 4f 61 80 00 00 	movabs $0x80614f,%rdi
+  803854:	00 00 00 
+  803857:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385c:	49 b9 aa 26 80 00 00 	movabs $0x8026aa,%r9
+  803863:	00 00 00 
+  803866:	41 ff d1             	call   *%r9
+
+0000000000803869 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  803869:	55                   	push   %rbp
+  80386a:	48 89 e5             	mov    %rsp,%rbp
+  80386d:	53                   	push   %rbx
+  80386e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  803872:	48 63 ce             	movslq %esi,%rcx
+  803875:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803878:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80387d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803882:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803887:	be 00 00 00 00       	mov    $0x0,%esi
+  80388c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803892:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803894:	48 85 c0             	test   %rax,%rax
+  803897:	7f 06                	jg     80389f <sys_env_set_nice+0x36>
+}
+  803899:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80389d:	c9                   	leave
+  80389e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80389f:	49 89 c0             	mov    %rax,%r8
+  8038a2:	b9 15 00 00 00       	mov    $0x15,%ecx
+  8038a7:	48 ba 30 61 80 00 00 	movabs $0x806130,%rdx
+  8038ae:	00 00 00 
+  8038b1:	be 26 00 00 00       	mov    $0x26,%esi
+  8038b6:	48 bf 4f 61 80 00 00 	movabs $0x80614f,%rdi
+  8038bd:	00 00 00 
+  8038c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c5:	49 b9 aa 26 80 00 00 	movabs $0x8026aa,%r9
+  8038cc:	00 00 00 
+  8038cf:	41 ff d1             	call   *%r9
+
+00000000008038d2 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8038d2:	55                   	push   %rbp
+  8038d3:	48 89 e5             	mov    %rsp,%rbp
+  8038d6:	53                   	push   %rbx
+  8038d7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8038db:	48 63 ce             	movslq %esi,%rcx
+  8038de:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8038e1:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8038e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8038f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8038f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8038fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8038fd:	48 85 c0             	test   %rax,%rax
+  803900:	7f 06                	jg     803908 <sys_env_set_status+0x36>
+}
+  803902:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803906:	c9                   	leave
+  803907:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803908:	49 89 c0             	mov    %rax,%r8
+  80390b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  803910:	48 ba 30 61 80 00 00 	movabs $0x806130,%rdx
+  803917:	00 00 00 
+  80391a:	be 26 00 00 00       	mov    $0x26,%esi
+  80391f:	48 bf 4f 61 80 00 00 	movabs $0x80614f,%rdi
+  803926:	00 00 00 
+  803929:	b8 00 00 00 00       	mov    $0x0,%eax
+  80392e:	49 b9 aa 26 80 00 00 	movabs $0x8026aa,%r9
+  803935:	00 00 00 
+  803938:	41 ff d1             	call   *%r9
+
+000000000080393b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80393b:	55                   	push   %rbp
+  80393c:	48 89 e5             	mov    %rsp,%rbp
+  80393f:	53                   	push   %rbx
+  803940:	48 83 ec 08          	sub    $0x8,%rsp
+  803944:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  803947:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80394a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80394f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803954:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803959:	be 00 00 00 00       	mov    $0x0,%esi
+  80395e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803964:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803966:	48 85 c0             	test   %rax,%rax
+  803969:	7f 06                	jg     803971 <sys_env_set_trapframe+0x36>
+}
+  80396b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80396f:	c9                   	leave
+  803970:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803971:	49 89 c0             	mov    %rax,%r8
+  803974:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  803979:	48 ba 30 61 80 00 00 	movabs $0x806130,%rdx
+  803980:	00 00 00 
+  803983:	be 26 00 00 00       	mov    $0x26,%esi
+  803988:	48 bf 4f 61 80 00 00 	movabs $0x80614f,%rdi
+  80398f:	00 00 00 
+  803992:	b8 00 00 00 00       	mov    $0x0,%eax
+  803997:	49 b9 aa 26 80 00 00 	movabs $0x8026aa,%r9
+  80399e:	00 00 00 
+  8039a1:	41 ff d1             	call   *%r9
+
+00000000008039a4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8039a4:	55                   	push   %rbp
+  8039a5:	48 89 e5             	mov    %rsp,%rbp
+  8039a8:	53                   	push   %rbx
+  8039a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8039ad:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8039b0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8039b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8039b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8039c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8039c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8039cd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8039cf:	48 85 c0             	test   %rax,%rax
+  8039d2:	7f 06                	jg     8039da <sys_env_set_pgfault_upcall+0x36>
+}
+  8039d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8039d8:	c9                   	leave
+  8039d9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8039da:	49 89 c0             	mov    %rax,%r8
+  8039dd:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8039e2:	48 ba 30 61 80 00 00 	movabs $0x806130,%rdx
+  8039e9:	00 00 00 
+  8039ec:	be 26 00 00 00       	mov    $0x26,%esi
+  8039f1:	48 bf 4f 61 80 00 00 	movabs $0x80614f,%rdi
+  8039f8:	00 00 00 
+  8039fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a00:	49 b9 aa 26 80 00 00 	movabs $0x8026aa,%r9
+  803a07:	00 00 00 
+  803a0a:	41 ff d1             	call   *%r9
+
+0000000000803a0d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  803a0d:	55                   	push   %rbp
+  803a0e:	48 89 e5             	mov    %rsp,%rbp
+  803a11:	53                   	push   %rbx
+  803a12:	89 f8                	mov    %edi,%eax
+  803a14:	49 89 f1             	mov    %rsi,%r9
+  803a17:	48 89 d3             	mov    %rdx,%rbx
+  803a1a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  803a1d:	49 63 f0             	movslq %r8d,%rsi
+  803a20:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803a23:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803a28:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803a2b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803a31:	cd 30                	int    $0x30
+}
+  803a33:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a37:	c9                   	leave
+  803a38:	c3                   	ret
+
+0000000000803a39 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  803a39:	55                   	push   %rbp
+  803a3a:	48 89 e5             	mov    %rsp,%rbp
+  803a3d:	53                   	push   %rbx
+  803a3e:	48 83 ec 08          	sub    $0x8,%rsp
+  803a42:	48 89 fa             	mov    %rdi,%rdx
+  803a45:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803a48:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803a4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a52:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803a57:	be 00 00 00 00       	mov    $0x0,%esi
+  803a5c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803a62:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803a64:	48 85 c0             	test   %rax,%rax
+  803a67:	7f 06                	jg     803a6f <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803a69:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a6d:	c9                   	leave
+  803a6e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803a6f:	49 89 c0             	mov    %rax,%r8
+  803a72:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  803a77:	48 ba 30 61 80 00 00 	movabs $0x806130,%rdx
+  803a7e:	00 00 00 
+  803a81:	be 26 00 00 00       	mov    $0x26,%esi
+  803a86:	48 bf 4f 61 80 00 00 	movabs $0x80614f,%rdi
+  803a8d:	00 00 00 
+  803a90:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a95:	49 b9 aa 26 80 00 00 	movabs $0x8026aa,%r9
+  803a9c:	00 00 00 
+  803a9f:	41 ff d1             	call   *%r9
+
+0000000000803aa2 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  803aa2:	55                   	push   %rbp
+  803aa3:	48 89 e5             	mov    %rsp,%rbp
+  803aa6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803aa7:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803aac:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ab1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803ab6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803abb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803ac0:	be 00 00 00 00       	mov    $0x0,%esi
+  803ac5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803acb:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  803acd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ad1:	c9                   	leave
+  803ad2:	c3                   	ret
+
+0000000000803ad3 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  803ad3:	55                   	push   %rbp
+  803ad4:	48 89 e5             	mov    %rsp,%rbp
+  803ad7:	53                   	push   %rbx
+  803ad8:	48 83 ec 08          	sub    $0x8,%rsp
+  803adc:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  803adf:	48 63 ce             	movslq %esi,%rcx
+  803ae2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803ae5:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803aea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803aef:	be 00 00 00 00       	mov    $0x0,%esi
+  803af4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803afa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803afc:	48 85 c0             	test   %rax,%rax
+  803aff:	7f 06                	jg     803b07 <sys_sigqueue+0x34>
+}
+  803b01:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b05:	c9                   	leave
+  803b06:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803b07:	49 89 c0             	mov    %rax,%r8
+  803b0a:	b9 10 00 00 00       	mov    $0x10,%ecx
+  803b0f:	48 ba 30 61 80 00 00 	movabs $0x806130,%rdx
+  803b16:	00 00 00 
+  803b19:	be 26 00 00 00       	mov    $0x26,%esi
+  803b1e:	48 bf 4f 61 80 00 00 	movabs $0x80614f,%rdi
+  803b25:	00 00 00 
+  803b28:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b2d:	49 b9 aa 26 80 00 00 	movabs $0x8026aa,%r9
+  803b34:	00 00 00 
+  803b37:	41 ff d1             	call   *%r9
+
+0000000000803b3a <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  803b3a:	55                   	push   %rbp
+  803b3b:	48 89 e5             	mov    %rsp,%rbp
+  803b3e:	53                   	push   %rbx
+  803b3f:	48 83 ec 08          	sub    $0x8,%rsp
+  803b43:	48 89 fa             	mov    %rdi,%rdx
+  803b46:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803b49:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803b4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b53:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803b58:	be 00 00 00 00       	mov    $0x0,%esi
+  803b5d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803b63:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803b65:	48 85 c0             	test   %rax,%rax
+  803b68:	7f 06                	jg     803b70 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  803b6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b6e:	c9                   	leave
+  803b6f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803b70:	49 89 c0             	mov    %rax,%r8
+  803b73:	b9 11 00 00 00       	mov    $0x11,%ecx
+  803b78:	48 ba 30 61 80 00 00 	movabs $0x806130,%rdx
+  803b7f:	00 00 00 
+  803b82:	be 26 00 00 00       	mov    $0x26,%esi
+  803b87:	48 bf 4f 61 80 00 00 	movabs $0x80614f,%rdi
+  803b8e:	00 00 00 
+  803b91:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b96:	49 b9 aa 26 80 00 00 	movabs $0x8026aa,%r9
+  803b9d:	00 00 00 
+  803ba0:	41 ff d1             	call   *%r9
+
+0000000000803ba3 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  803ba3:	55                   	push   %rbp
+  803ba4:	48 89 e5             	mov    %rsp,%rbp
+  803ba7:	53                   	push   %rbx
+  803ba8:	48 83 ec 08          	sub    $0x8,%rsp
+  803bac:	48 89 f1             	mov    %rsi,%rcx
+  803baf:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  803bb2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803bb5:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803bba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803bbf:	be 00 00 00 00       	mov    $0x0,%esi
+  803bc4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803bca:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803bcc:	48 85 c0             	test   %rax,%rax
+  803bcf:	7f 06                	jg     803bd7 <sys_sigaction+0x34>
+}
+  803bd1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bd5:	c9                   	leave
+  803bd6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803bd7:	49 89 c0             	mov    %rax,%r8
+  803bda:	b9 12 00 00 00       	mov    $0x12,%ecx
+  803bdf:	48 ba 30 61 80 00 00 	movabs $0x806130,%rdx
+  803be6:	00 00 00 
+  803be9:	be 26 00 00 00       	mov    $0x26,%esi
+  803bee:	48 bf 4f 61 80 00 00 	movabs $0x80614f,%rdi
+  803bf5:	00 00 00 
+  803bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bfd:	49 b9 aa 26 80 00 00 	movabs $0x8026aa,%r9
+  803c04:	00 00 00 
+  803c07:	41 ff d1             	call   *%r9
+
+0000000000803c0a <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  803c0a:	55                   	push   %rbp
+  803c0b:	48 89 e5             	mov    %rsp,%rbp
+  803c0e:	53                   	push   %rbx
+  803c0f:	48 83 ec 08          	sub    $0x8,%rsp
+  803c13:	48 89 f1             	mov    %rsi,%rcx
+  803c16:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  803c19:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803c1c:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803c21:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803c26:	be 00 00 00 00       	mov    $0x0,%esi
+  803c2b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803c31:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803c33:	48 85 c0             	test   %rax,%rax
+  803c36:	7f 06                	jg     803c3e <sys_sigprocmask+0x34>
+}
+  803c38:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c3c:	c9                   	leave
+  803c3d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803c3e:	49 89 c0             	mov    %rax,%r8
+  803c41:	b9 13 00 00 00       	mov    $0x13,%ecx
+  803c46:	48 ba 30 61 80 00 00 	movabs $0x806130,%rdx
+  803c4d:	00 00 00 
+  803c50:	be 26 00 00 00       	mov    $0x26,%esi
+  803c55:	48 bf 4f 61 80 00 00 	movabs $0x80614f,%rdi
+  803c5c:	00 00 00 
+  803c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c64:	49 b9 aa 26 80 00 00 	movabs $0x8026aa,%r9
+  803c6b:	00 00 00 
+  803c6e:	41 ff d1             	call   *%r9
+
+0000000000803c71 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  803c71:	55                   	push   %rbp
+  803c72:	48 89 e5             	mov    %rsp,%rbp
+  803c75:	41 56                	push   %r14
+  803c77:	41 55                	push   %r13
+  803c79:	41 54                	push   %r12
+  803c7b:	53                   	push   %rbx
+  803c7c:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803c7f:	48 b8 68 c0 80 00 00 	movabs $0x80c068,%rax
+  803c86:	00 00 00 
+  803c89:	48 83 38 00          	cmpq   $0x0,(%rax)
+  803c8d:	74 27                	je     803cb6 <_handle_vectored_pagefault+0x45>
+  803c8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  803c94:	49 bd 20 c0 80 00 00 	movabs $0x80c020,%r13
+  803c9b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803c9e:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  803ca1:	4c 89 e7             	mov    %r12,%rdi
+  803ca4:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  803ca9:	84 c0                	test   %al,%al
+  803cab:	75 45                	jne    803cf2 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803cad:	48 83 c3 01          	add    $0x1,%rbx
+  803cb1:	49 3b 1e             	cmp    (%r14),%rbx
+  803cb4:	72 eb                	jb     803ca1 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  803cb6:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  803cbd:	00 
+  803cbe:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  803cc3:	4d 8b 04 24          	mov    (%r12),%r8
+  803cc7:	48 ba 60 61 80 00 00 	movabs $0x806160,%rdx
+  803cce:	00 00 00 
+  803cd1:	be 1d 00 00 00       	mov    $0x1d,%esi
+  803cd6:	48 bf f7 61 80 00 00 	movabs $0x8061f7,%rdi
+  803cdd:	00 00 00 
+  803ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ce5:	49 ba aa 26 80 00 00 	movabs $0x8026aa,%r10
+  803cec:	00 00 00 
+  803cef:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  803cf2:	5b                   	pop    %rbx
+  803cf3:	41 5c                	pop    %r12
+  803cf5:	41 5d                	pop    %r13
+  803cf7:	41 5e                	pop    %r14
+  803cf9:	5d                   	pop    %rbp
+  803cfa:	c3                   	ret
+
+0000000000803cfb <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  803cfb:	55                   	push   %rbp
+  803cfc:	48 89 e5             	mov    %rsp,%rbp
+  803cff:	53                   	push   %rbx
+  803d00:	48 83 ec 08          	sub    $0x8,%rsp
+  803d04:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  803d07:	48 b8 60 c0 80 00 00 	movabs $0x80c060,%rax
+  803d0e:	00 00 00 
+  803d11:	80 38 00             	cmpb   $0x0,(%rax)
+  803d14:	74 61                	je     803d77 <add_pgfault_handler+0x7c>
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803d16:	48 b8 68 c0 80 00 00 	movabs $0x80c068,%rax
+  803d1d:	00 00 00 
+  803d20:	48 8b 10             	mov    (%rax),%rdx
+  803d23:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  803d28:	48 b9 20 c0 80 00 00 	movabs $0x80c020,%rcx
+  803d2f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803d32:	48 85 d2             	test   %rdx,%rdx
+  803d35:	74 19                	je     803d50 <add_pgfault_handler+0x55>
+        if (handler == _pfhandler_vec[i]) return 0;
+  803d37:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  803d3b:	74 2f                	je     803d6c <add_pgfault_handler+0x71>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803d3d:	48 83 c0 01          	add    $0x1,%rax
+  803d41:	48 39 d0             	cmp    %rdx,%rax
+  803d44:	75 f1                	jne    803d37 <add_pgfault_handler+0x3c>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  803d46:	48 83 fa 08          	cmp    $0x8,%rdx
+  803d4a:	0f 84 f7 00 00 00    	je     803e47 <add_pgfault_handler+0x14c>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  803d50:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  803d54:	48 a3 68 c0 80 00 00 	movabs %rax,0x80c068
+  803d5b:	00 00 00 
+  803d5e:	48 b8 20 c0 80 00 00 	movabs $0x80c020,%rax
+  803d65:	00 00 00 
+  803d68:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  803d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d71:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803d75:	c9                   	leave
+  803d76:	c3                   	ret
+        if (sys_alloc_region(CURENVID, ues_beg, PAGE_SIZE, PROT_RW))
+  803d77:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803d7c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d81:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  803d88:	00 00 00 
+  803d8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d90:	48 b8 cf 36 80 00 00 	movabs $0x8036cf,%rax
+  803d97:	00 00 00 
+  803d9a:	ff d0                	call   *%rax
+  803d9c:	85 c0                	test   %eax,%eax
+  803d9e:	75 53                	jne    803df3 <add_pgfault_handler+0xf8>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  803da0:	48 ba 68 c0 80 00 00 	movabs $0x80c068,%rdx
+  803da7:	00 00 00 
+  803daa:	48 8b 02             	mov    (%rdx),%rax
+  803dad:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803db1:	48 89 0a             	mov    %rcx,(%rdx)
+  803db4:	48 ba 20 c0 80 00 00 	movabs $0x80c020,%rdx
+  803dbb:	00 00 00 
+  803dbe:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        if (sys_env_set_pgfault_upcall(CURENVID, _pgfault_upcall))
+  803dc2:	48 be 33 3f 80 00 00 	movabs $0x803f33,%rsi
+  803dc9:	00 00 00 
+  803dcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dd1:	48 b8 a4 39 80 00 00 	movabs $0x8039a4,%rax
+  803dd8:	00 00 00 
+  803ddb:	ff d0                	call   *%rax
+  803ddd:	85 c0                	test   %eax,%eax
+  803ddf:	75 3c                	jne    803e1d <add_pgfault_handler+0x122>
+        _pfhandler_inititiallized = 1;
+  803de1:	48 b8 60 c0 80 00 00 	movabs $0x80c060,%rax
+  803de8:	00 00 00 
+  803deb:	c6 00 01             	movb   $0x1,(%rax)
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803dee:	e9 79 ff ff ff       	jmp    803d6c <add_pgfault_handler+0x71>
+            panic("add_pgfault_handler: sys_alloc_region failed");
+  803df3:	48 ba 90 61 80 00 00 	movabs $0x806190,%rdx
+  803dfa:	00 00 00 
+  803dfd:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803e02:	48 bf f7 61 80 00 00 	movabs $0x8061f7,%rdi
+  803e09:	00 00 00 
+  803e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e11:	48 b9 aa 26 80 00 00 	movabs $0x8026aa,%rcx
+  803e18:	00 00 00 
+  803e1b:	ff d1                	call   *%rcx
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+  803e1d:	48 ba c0 61 80 00 00 	movabs $0x8061c0,%rdx
+  803e24:	00 00 00 
+  803e27:	be 32 00 00 00       	mov    $0x32,%esi
+  803e2c:	48 bf f7 61 80 00 00 	movabs $0x8061f7,%rdi
+  803e33:	00 00 00 
+  803e36:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e3b:	48 b9 aa 26 80 00 00 	movabs $0x8026aa,%rcx
+  803e42:	00 00 00 
+  803e45:	ff d1                	call   *%rcx
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803e47:	b9 fd ff ff ff       	mov    $0xfffffffd,%ecx
+  803e4c:	48 ba 05 62 80 00 00 	movabs $0x806205,%rdx
+  803e53:	00 00 00 
+  803e56:	be 40 00 00 00       	mov    $0x40,%esi
+  803e5b:	48 bf f7 61 80 00 00 	movabs $0x8061f7,%rdi
+  803e62:	00 00 00 
+  803e65:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e6a:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  803e71:	00 00 00 
+  803e74:	41 ff d0             	call   *%r8
+
+0000000000803e77 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  803e77:	55                   	push   %rbp
+  803e78:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  803e7b:	48 b8 60 c0 80 00 00 	movabs $0x80c060,%rax
+  803e82:	00 00 00 
+  803e85:	80 38 00             	cmpb   $0x0,(%rax)
+  803e88:	74 33                	je     803ebd <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803e8a:	48 a1 68 c0 80 00 00 	movabs 0x80c068,%rax
+  803e91:	00 00 00 
+  803e94:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  803e99:	48 ba 20 c0 80 00 00 	movabs $0x80c020,%rdx
+  803ea0:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803ea3:	48 85 c0             	test   %rax,%rax
+  803ea6:	0f 84 85 00 00 00    	je     803f31 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  803eac:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  803eb0:	74 40                	je     803ef2 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803eb2:	48 83 c1 01          	add    $0x1,%rcx
+  803eb6:	48 39 c1             	cmp    %rax,%rcx
+  803eb9:	75 f1                	jne    803eac <remove_pgfault_handler+0x35>
+  803ebb:	eb 74                	jmp    803f31 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  803ebd:	48 b9 1d 62 80 00 00 	movabs $0x80621d,%rcx
+  803ec4:	00 00 00 
+  803ec7:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  803ece:	00 00 00 
+  803ed1:	be 46 00 00 00       	mov    $0x46,%esi
+  803ed6:	48 bf f7 61 80 00 00 	movabs $0x8061f7,%rdi
+  803edd:	00 00 00 
+  803ee0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ee5:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  803eec:	00 00 00 
+  803eef:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  803ef2:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  803ef9:	00 
+  803efa:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803efe:	48 29 ca             	sub    %rcx,%rdx
+  803f01:	48 b8 20 c0 80 00 00 	movabs $0x80c020,%rax
+  803f08:	00 00 00 
+  803f0b:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  803f0f:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  803f14:	48 89 ce             	mov    %rcx,%rsi
+  803f17:	48 b8 19 33 80 00 00 	movabs $0x803319,%rax
+  803f1e:	00 00 00 
+  803f21:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  803f23:	48 b8 68 c0 80 00 00 	movabs $0x80c068,%rax
+  803f2a:	00 00 00 
+  803f2d:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  803f31:	5d                   	pop    %rbp
+  803f32:	c3                   	ret
+
+0000000000803f33 <_pgfault_upcall>:
+.text
+.globl _pgfault_upcall
+.globl _signal_handler_trampoline
+_pgfault_upcall:
+_signal_handler_trampoline:
+    movq  %rsp,%rdi # passing the function argument (UTrapframe *) in rdi
+  803f33:	48 89 e7             	mov    %rsp,%rdi
+    # sizeof(struct EnqueuedSignal) == 56
+    # sizeof(curenv->env_sig_mask) == 4
+    # + 4 bytes of alignment
+    add $64, %rdi
+  803f36:	48 83 c7 40          	add    $0x40,%rdi
+
+    # load signo
+    mov (%rsp), %eax
+  803f3a:	8b 04 24             	mov    (%rsp),%eax
+    test %eax, %eax
+  803f3d:	85 c0                	test   %eax,%eax
+    jnz _call_generic_signal_handler
+  803f3f:	75 0e                	jne    803f4f <_call_generic_signal_handler>
+
+    # Call the C page fault handler.
+    movabs $_handle_vectored_pagefault, %rax
+  803f41:	48 b8 71 3c 80 00 00 	movabs $0x803c71,%rax
+  803f48:	00 00 00 
+    call *%rax
+  803f4b:	ff d0                	call   *%rax
+    jmp _return_from_handler
+  803f4d:	eb 0f                	jmp    803f5e <_return_from_handler>
+
+0000000000803f4f <_call_generic_signal_handler>:
+
+_call_generic_signal_handler:
+    movq %rsp, %rsi # passing the function argument (EnqueuedSignal *) in rsi
+  803f4f:	48 89 e6             	mov    %rsp,%rsi
+    movabs $_generic_signal_handler, %rax
+  803f52:	48 b8 1b 52 80 00 00 	movabs $0x80521b,%rax
+  803f59:	00 00 00 
+    call *%rax
+  803f5c:	ff d0                	call   *%rax
+
+0000000000803f5e <_return_from_handler>:
+
+_return_from_handler:
+    # ignore EnqueuedSignal and env_sig_mask
+    add $64, %rsp
+  803f5e:	48 83 c4 40          	add    $0x40,%rsp
+    # put SIG_SETMASK as the first func arg
+    movq $3, %rdi
+  803f62:	48 c7 c7 03 00 00 00 	mov    $0x3,%rdi
+    # load &env_sig_mask (as the second func arg)
+    lea -4(%rsp), %rsi
+  803f69:	48 8d 74 24 fc       	lea    -0x4(%rsp),%rsi
+    # NULL as the third arg
+    xor %rdx, %rdx
+  803f6e:	48 31 d2             	xor    %rdx,%rdx
+    # restore blocked signals mask
+    movabs $sys_sigprocmask, %rax
+  803f71:	48 b8 0a 3c 80 00 00 	movabs $0x803c0a,%rax
+  803f78:	00 00 00 
+    call *%rax
+  803f7b:	ff d0                	call   *%rax
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    # ignore utf_fault_va, utf_err
+    addq $16, %rsp
+  803f7d:	48 83 c4 10          	add    $0x10,%rsp
+    # restore utf_regs, save rax again
+    POPA
+  803f81:	4c 8b 3c 24          	mov    (%rsp),%r15
+  803f85:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  803f8a:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  803f8f:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  803f94:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  803f99:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  803f9e:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  803fa3:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  803fa8:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  803fad:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  803fb2:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  803fb7:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  803fbc:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  803fc1:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  803fc6:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  803fcb:	48 83 c4 78          	add    $0x78,%rsp
+    pushq %rax
+  803fcf:	50                   	push   %rax
+    # 16 utf_rflags
+    #  8 utf_rip
+    #  0 rax
+
+    # load utf_rip
+    movq 8(%rsp), %rax
+  803fd0:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    # save rbx to utf_rip
+    movq %rbx, 8(%rsp)
+  803fd5:	48 89 5c 24 08       	mov    %rbx,0x8(%rsp)
+    # load utf_rsp
+    movq 24(%rsp), %rbx
+  803fda:	48 8b 5c 24 18       	mov    0x18(%rsp),%rbx
+    # store return address to *utf_stack
+    subq $8, 24(%rsp)
+  803fdf:	48 83 6c 24 18 08    	subq   $0x8,0x18(%rsp)
+    movq %rax, -8(%rbx)
+  803fe5:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    # restore rax and rbx
+    popq %rax
+  803fe9:	58                   	pop    %rax
+    popq %rbx
+  803fea:	5b                   	pop    %rbx
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+    popfq
+  803feb:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    popq %rsp
+  803fec:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  803fed:	c3                   	ret
+
+0000000000803fee <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803fee:	55                   	push   %rbp
+  803fef:	48 89 e5             	mov    %rsp,%rbp
+  803ff2:	41 54                	push   %r12
+  803ff4:	53                   	push   %rbx
+  803ff5:	48 89 fb             	mov    %rdi,%rbx
+  803ff8:	48 89 f7             	mov    %rsi,%rdi
+  803ffb:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  803ffe:	48 85 f6             	test   %rsi,%rsi
+  804001:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804008:	00 00 00 
+  80400b:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  80400f:	be 00 10 00 00       	mov    $0x1000,%esi
+  804014:	48 b8 39 3a 80 00 00 	movabs $0x803a39,%rax
+  80401b:	00 00 00 
+  80401e:	ff d0                	call   *%rax
+    if (res < 0) {
+  804020:	85 c0                	test   %eax,%eax
+  804022:	78 45                	js     804069 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  804024:	48 85 db             	test   %rbx,%rbx
+  804027:	74 12                	je     80403b <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  804029:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  804030:	00 00 00 
+  804033:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  804039:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  80403b:	4d 85 e4             	test   %r12,%r12
+  80403e:	74 14                	je     804054 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  804040:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  804047:	00 00 00 
+  80404a:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  804050:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  804054:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  80405b:	00 00 00 
+  80405e:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  804064:	5b                   	pop    %rbx
+  804065:	41 5c                	pop    %r12
+  804067:	5d                   	pop    %rbp
+  804068:	c3                   	ret
+        if (from_env_store)
+  804069:	48 85 db             	test   %rbx,%rbx
+  80406c:	74 06                	je     804074 <ipc_recv+0x86>
+            *from_env_store = 0;
+  80406e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  804074:	4d 85 e4             	test   %r12,%r12
+  804077:	74 eb                	je     804064 <ipc_recv+0x76>
+            *perm_store = 0;
+  804079:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804080:	00 
+  804081:	eb e1                	jmp    804064 <ipc_recv+0x76>
+
+0000000000804083 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804083:	55                   	push   %rbp
+  804084:	48 89 e5             	mov    %rsp,%rbp
+  804087:	41 57                	push   %r15
+  804089:	41 56                	push   %r14
+  80408b:	41 55                	push   %r13
+  80408d:	41 54                	push   %r12
+  80408f:	53                   	push   %rbx
+  804090:	48 83 ec 18          	sub    $0x18,%rsp
+  804094:	41 89 fd             	mov    %edi,%r13d
+  804097:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80409a:	48 89 d3             	mov    %rdx,%rbx
+  80409d:	49 89 cc             	mov    %rcx,%r12
+  8040a0:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8040a4:	48 85 d2             	test   %rdx,%rdx
+  8040a7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040ae:	00 00 00 
+  8040b1:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8040b5:	49 be 0d 3a 80 00 00 	movabs $0x803a0d,%r14
+  8040bc:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  8040bf:	49 bf 40 36 80 00 00 	movabs $0x803640,%r15
+  8040c6:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8040c9:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8040cc:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8040d0:	4c 89 e1             	mov    %r12,%rcx
+  8040d3:	48 89 da             	mov    %rbx,%rdx
+  8040d6:	44 89 ef             	mov    %r13d,%edi
+  8040d9:	41 ff d6             	call   *%r14
+        if (res == 0)
+  8040dc:	85 c0                	test   %eax,%eax
+  8040de:	74 34                	je     804114 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  8040e0:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8040e3:	75 05                	jne    8040ea <ipc_send+0x67>
+        sys_yield();
+  8040e5:	41 ff d7             	call   *%r15
+    while (true) {
+  8040e8:	eb df                	jmp    8040c9 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  8040ea:	48 ba 37 62 80 00 00 	movabs $0x806237,%rdx
+  8040f1:	00 00 00 
+  8040f4:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8040f9:	48 bf 50 62 80 00 00 	movabs $0x806250,%rdi
+  804100:	00 00 00 
+  804103:	b8 00 00 00 00       	mov    $0x0,%eax
+  804108:	48 b9 aa 26 80 00 00 	movabs $0x8026aa,%rcx
+  80410f:	00 00 00 
+  804112:	ff d1                	call   *%rcx
+    }
+}
+  804114:	48 83 c4 18          	add    $0x18,%rsp
+  804118:	5b                   	pop    %rbx
+  804119:	41 5c                	pop    %r12
+  80411b:	41 5d                	pop    %r13
+  80411d:	41 5e                	pop    %r14
+  80411f:	41 5f                	pop    %r15
+  804121:	5d                   	pop    %rbp
+  804122:	c3                   	ret
+
+0000000000804123 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804123:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804128:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80412f:	00 00 00 
+  804132:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  804139:	48 01 ca             	add    %rcx,%rdx
+  80413c:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804142:	39 fa                	cmp    %edi,%edx
+  804144:	74 12                	je     804158 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804146:	48 83 c0 01          	add    $0x1,%rax
+  80414a:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  804150:	75 e0                	jne    804132 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804152:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804157:	c3                   	ret
+            return envs[i].env_id;
+  804158:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80415f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804166:	00 00 00 
+  804169:	48 01 d0             	add    %rdx,%rax
+  80416c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804172:	c3                   	ret
+
+0000000000804173 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  804173:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80417a:	ff ff ff 
+  80417d:	48 01 f8             	add    %rdi,%rax
+  804180:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  804184:	c3                   	ret
+
+0000000000804185 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  804185:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80418c:	ff ff ff 
+  80418f:	48 01 f8             	add    %rdi,%rax
+  804192:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  804196:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80419c:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8041a0:	c3                   	ret
+
+00000000008041a1 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8041a1:	55                   	push   %rbp
+  8041a2:	48 89 e5             	mov    %rsp,%rbp
+  8041a5:	41 57                	push   %r15
+  8041a7:	41 56                	push   %r14
+  8041a9:	41 55                	push   %r13
+  8041ab:	41 54                	push   %r12
+  8041ad:	53                   	push   %rbx
+  8041ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8041b2:	49 89 ff             	mov    %rdi,%r15
+  8041b5:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8041ba:	49 bd 1f 51 80 00 00 	movabs $0x80511f,%r13
+  8041c1:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8041c4:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8041ca:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8041cd:	48 89 df             	mov    %rbx,%rdi
+  8041d0:	41 ff d5             	call   *%r13
+  8041d3:	83 e0 04             	and    $0x4,%eax
+  8041d6:	74 17                	je     8041ef <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8041d8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8041df:	4c 39 f3             	cmp    %r14,%rbx
+  8041e2:	75 e6                	jne    8041ca <fd_alloc+0x29>
+  8041e4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8041ea:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8041ef:	4d 89 27             	mov    %r12,(%r15)
+}
+  8041f2:	48 83 c4 08          	add    $0x8,%rsp
+  8041f6:	5b                   	pop    %rbx
+  8041f7:	41 5c                	pop    %r12
+  8041f9:	41 5d                	pop    %r13
+  8041fb:	41 5e                	pop    %r14
+  8041fd:	41 5f                	pop    %r15
+  8041ff:	5d                   	pop    %rbp
+  804200:	c3                   	ret
+
+0000000000804201 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  804201:	83 ff 1f             	cmp    $0x1f,%edi
+  804204:	77 39                	ja     80423f <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  804206:	55                   	push   %rbp
+  804207:	48 89 e5             	mov    %rsp,%rbp
+  80420a:	41 54                	push   %r12
+  80420c:	53                   	push   %rbx
+  80420d:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  804210:	48 63 df             	movslq %edi,%rbx
+  804213:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80421a:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80421e:	48 89 df             	mov    %rbx,%rdi
+  804221:	48 b8 1f 51 80 00 00 	movabs $0x80511f,%rax
+  804228:	00 00 00 
+  80422b:	ff d0                	call   *%rax
+  80422d:	a8 04                	test   $0x4,%al
+  80422f:	74 14                	je     804245 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  804231:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  804235:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80423a:	5b                   	pop    %rbx
+  80423b:	41 5c                	pop    %r12
+  80423d:	5d                   	pop    %rbp
+  80423e:	c3                   	ret
+        return -E_INVAL;
+  80423f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  804244:	c3                   	ret
+        return -E_INVAL;
+  804245:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80424a:	eb ee                	jmp    80423a <fd_lookup+0x39>
+
+000000000080424c <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80424c:	55                   	push   %rbp
+  80424d:	48 89 e5             	mov    %rsp,%rbp
+  804250:	41 54                	push   %r12
+  804252:	53                   	push   %rbx
+  804253:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  804256:	48 b8 e0 62 80 00 00 	movabs $0x8062e0,%rax
+  80425d:	00 00 00 
+  804260:	48 bb a0 b0 80 00 00 	movabs $0x80b0a0,%rbx
+  804267:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80426a:	39 3b                	cmp    %edi,(%rbx)
+  80426c:	74 47                	je     8042b5 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80426e:	48 83 c0 08          	add    $0x8,%rax
+  804272:	48 8b 18             	mov    (%rax),%rbx
+  804275:	48 85 db             	test   %rbx,%rbx
+  804278:	75 f0                	jne    80426a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80427a:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  804281:	00 00 00 
+  804284:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80428a:	89 fa                	mov    %edi,%edx
+  80428c:	48 bf 60 62 80 00 00 	movabs $0x806260,%rdi
+  804293:	00 00 00 
+  804296:	b8 00 00 00 00       	mov    $0x0,%eax
+  80429b:	48 b9 fa 27 80 00 00 	movabs $0x8027fa,%rcx
+  8042a2:	00 00 00 
+  8042a5:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8042a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8042ac:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8042b0:	5b                   	pop    %rbx
+  8042b1:	41 5c                	pop    %r12
+  8042b3:	5d                   	pop    %rbp
+  8042b4:	c3                   	ret
+            return 0;
+  8042b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042ba:	eb f0                	jmp    8042ac <dev_lookup+0x60>
+
+00000000008042bc <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8042bc:	55                   	push   %rbp
+  8042bd:	48 89 e5             	mov    %rsp,%rbp
+  8042c0:	41 55                	push   %r13
+  8042c2:	41 54                	push   %r12
+  8042c4:	53                   	push   %rbx
+  8042c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8042c9:	48 89 fb             	mov    %rdi,%rbx
+  8042cc:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8042cf:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8042d6:	ff ff ff 
+  8042d9:	48 01 df             	add    %rbx,%rdi
+  8042dc:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8042e0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8042e4:	48 b8 01 42 80 00 00 	movabs $0x804201,%rax
+  8042eb:	00 00 00 
+  8042ee:	ff d0                	call   *%rax
+  8042f0:	41 89 c5             	mov    %eax,%r13d
+  8042f3:	85 c0                	test   %eax,%eax
+  8042f5:	78 06                	js     8042fd <fd_close+0x41>
+  8042f7:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8042fb:	74 1a                	je     804317 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8042fd:	45 84 e4             	test   %r12b,%r12b
+  804300:	b8 00 00 00 00       	mov    $0x0,%eax
+  804305:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  804309:	44 89 e8             	mov    %r13d,%eax
+  80430c:	48 83 c4 18          	add    $0x18,%rsp
+  804310:	5b                   	pop    %rbx
+  804311:	41 5c                	pop    %r12
+  804313:	41 5d                	pop    %r13
+  804315:	5d                   	pop    %rbp
+  804316:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  804317:	8b 3b                	mov    (%rbx),%edi
+  804319:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80431d:	48 b8 4c 42 80 00 00 	movabs $0x80424c,%rax
+  804324:	00 00 00 
+  804327:	ff d0                	call   *%rax
+  804329:	41 89 c5             	mov    %eax,%r13d
+  80432c:	85 c0                	test   %eax,%eax
+  80432e:	78 1b                	js     80434b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  804330:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804334:	48 8b 40 20          	mov    0x20(%rax),%rax
+  804338:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80433e:	48 85 c0             	test   %rax,%rax
+  804341:	74 08                	je     80434b <fd_close+0x8f>
+  804343:	48 89 df             	mov    %rbx,%rdi
+  804346:	ff d0                	call   *%rax
+  804348:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80434b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804350:	48 89 de             	mov    %rbx,%rsi
+  804353:	bf 00 00 00 00       	mov    $0x0,%edi
+  804358:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  80435f:	00 00 00 
+  804362:	ff d0                	call   *%rax
+    return res;
+  804364:	eb a3                	jmp    804309 <fd_close+0x4d>
+
+0000000000804366 <close>:
+
+int
+close(int fdnum) {
+  804366:	55                   	push   %rbp
+  804367:	48 89 e5             	mov    %rsp,%rbp
+  80436a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80436e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804372:	48 b8 01 42 80 00 00 	movabs $0x804201,%rax
+  804379:	00 00 00 
+  80437c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80437e:	85 c0                	test   %eax,%eax
+  804380:	78 15                	js     804397 <close+0x31>
+
+    return fd_close(fd, 1);
+  804382:	be 01 00 00 00       	mov    $0x1,%esi
+  804387:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80438b:	48 b8 bc 42 80 00 00 	movabs $0x8042bc,%rax
+  804392:	00 00 00 
+  804395:	ff d0                	call   *%rax
+}
+  804397:	c9                   	leave
+  804398:	c3                   	ret
+
+0000000000804399 <close_all>:
+
+void
+close_all(void) {
+  804399:	55                   	push   %rbp
+  80439a:	48 89 e5             	mov    %rsp,%rbp
+  80439d:	41 54                	push   %r12
+  80439f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8043a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8043a5:	49 bc 66 43 80 00 00 	movabs $0x804366,%r12
+  8043ac:	00 00 00 
+  8043af:	89 df                	mov    %ebx,%edi
+  8043b1:	41 ff d4             	call   *%r12
+  8043b4:	83 c3 01             	add    $0x1,%ebx
+  8043b7:	83 fb 20             	cmp    $0x20,%ebx
+  8043ba:	75 f3                	jne    8043af <close_all+0x16>
+}
+  8043bc:	5b                   	pop    %rbx
+  8043bd:	41 5c                	pop    %r12
+  8043bf:	5d                   	pop    %rbp
+  8043c0:	c3                   	ret
+
+00000000008043c1 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8043c1:	55                   	push   %rbp
+  8043c2:	48 89 e5             	mov    %rsp,%rbp
+  8043c5:	41 57                	push   %r15
+  8043c7:	41 56                	push   %r14
+  8043c9:	41 55                	push   %r13
+  8043cb:	41 54                	push   %r12
+  8043cd:	53                   	push   %rbx
+  8043ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8043d2:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8043d5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8043d9:	48 b8 01 42 80 00 00 	movabs $0x804201,%rax
+  8043e0:	00 00 00 
+  8043e3:	ff d0                	call   *%rax
+  8043e5:	89 c3                	mov    %eax,%ebx
+  8043e7:	85 c0                	test   %eax,%eax
+  8043e9:	0f 88 b8 00 00 00    	js     8044a7 <dup+0xe6>
+    close(newfdnum);
+  8043ef:	44 89 e7             	mov    %r12d,%edi
+  8043f2:	48 b8 66 43 80 00 00 	movabs $0x804366,%rax
+  8043f9:	00 00 00 
+  8043fc:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8043fe:	4d 63 ec             	movslq %r12d,%r13
+  804401:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  804408:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80440c:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  804410:	4c 89 ff             	mov    %r15,%rdi
+  804413:	49 be 85 41 80 00 00 	movabs $0x804185,%r14
+  80441a:	00 00 00 
+  80441d:	41 ff d6             	call   *%r14
+  804420:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  804423:	4c 89 ef             	mov    %r13,%rdi
+  804426:	41 ff d6             	call   *%r14
+  804429:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80442c:	48 89 df             	mov    %rbx,%rdi
+  80442f:	48 b8 1f 51 80 00 00 	movabs $0x80511f,%rax
+  804436:	00 00 00 
+  804439:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80443b:	a8 04                	test   $0x4,%al
+  80443d:	74 2b                	je     80446a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80443f:	41 89 c1             	mov    %eax,%r9d
+  804442:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804448:	4c 89 f1             	mov    %r14,%rcx
+  80444b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804450:	48 89 de             	mov    %rbx,%rsi
+  804453:	bf 00 00 00 00       	mov    $0x0,%edi
+  804458:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  80445f:	00 00 00 
+  804462:	ff d0                	call   *%rax
+  804464:	89 c3                	mov    %eax,%ebx
+  804466:	85 c0                	test   %eax,%eax
+  804468:	78 4e                	js     8044b8 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80446a:	4c 89 ff             	mov    %r15,%rdi
+  80446d:	48 b8 1f 51 80 00 00 	movabs $0x80511f,%rax
+  804474:	00 00 00 
+  804477:	ff d0                	call   *%rax
+  804479:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80447c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804482:	4c 89 e9             	mov    %r13,%rcx
+  804485:	ba 00 00 00 00       	mov    $0x0,%edx
+  80448a:	4c 89 fe             	mov    %r15,%rsi
+  80448d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804492:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  804499:	00 00 00 
+  80449c:	ff d0                	call   *%rax
+  80449e:	89 c3                	mov    %eax,%ebx
+  8044a0:	85 c0                	test   %eax,%eax
+  8044a2:	78 14                	js     8044b8 <dup+0xf7>
+
+    return newfdnum;
+  8044a4:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8044a7:	89 d8                	mov    %ebx,%eax
+  8044a9:	48 83 c4 18          	add    $0x18,%rsp
+  8044ad:	5b                   	pop    %rbx
+  8044ae:	41 5c                	pop    %r12
+  8044b0:	41 5d                	pop    %r13
+  8044b2:	41 5e                	pop    %r14
+  8044b4:	41 5f                	pop    %r15
+  8044b6:	5d                   	pop    %rbp
+  8044b7:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8044b8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044bd:	4c 89 ee             	mov    %r13,%rsi
+  8044c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044c5:	49 bc 9b 37 80 00 00 	movabs $0x80379b,%r12
+  8044cc:	00 00 00 
+  8044cf:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8044d2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044d7:	4c 89 f6             	mov    %r14,%rsi
+  8044da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044df:	41 ff d4             	call   *%r12
+    return res;
+  8044e2:	eb c3                	jmp    8044a7 <dup+0xe6>
+
+00000000008044e4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8044e4:	55                   	push   %rbp
+  8044e5:	48 89 e5             	mov    %rsp,%rbp
+  8044e8:	41 56                	push   %r14
+  8044ea:	41 55                	push   %r13
+  8044ec:	41 54                	push   %r12
+  8044ee:	53                   	push   %rbx
+  8044ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8044f3:	89 fb                	mov    %edi,%ebx
+  8044f5:	49 89 f4             	mov    %rsi,%r12
+  8044f8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8044fb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8044ff:	48 b8 01 42 80 00 00 	movabs $0x804201,%rax
+  804506:	00 00 00 
+  804509:	ff d0                	call   *%rax
+  80450b:	85 c0                	test   %eax,%eax
+  80450d:	78 4c                	js     80455b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80450f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  804513:	41 8b 3e             	mov    (%r14),%edi
+  804516:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80451a:	48 b8 4c 42 80 00 00 	movabs $0x80424c,%rax
+  804521:	00 00 00 
+  804524:	ff d0                	call   *%rax
+  804526:	85 c0                	test   %eax,%eax
+  804528:	78 35                	js     80455f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80452a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80452e:	83 e0 03             	and    $0x3,%eax
+  804531:	83 f8 01             	cmp    $0x1,%eax
+  804534:	74 2d                	je     804563 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  804536:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80453a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80453e:	48 85 c0             	test   %rax,%rax
+  804541:	74 56                	je     804599 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  804543:	4c 89 ea             	mov    %r13,%rdx
+  804546:	4c 89 e6             	mov    %r12,%rsi
+  804549:	4c 89 f7             	mov    %r14,%rdi
+  80454c:	ff d0                	call   *%rax
+}
+  80454e:	48 83 c4 10          	add    $0x10,%rsp
+  804552:	5b                   	pop    %rbx
+  804553:	41 5c                	pop    %r12
+  804555:	41 5d                	pop    %r13
+  804557:	41 5e                	pop    %r14
+  804559:	5d                   	pop    %rbp
+  80455a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80455b:	48 98                	cltq
+  80455d:	eb ef                	jmp    80454e <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80455f:	48 98                	cltq
+  804561:	eb eb                	jmp    80454e <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  804563:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  80456a:	00 00 00 
+  80456d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  804573:	89 da                	mov    %ebx,%edx
+  804575:	48 bf a1 62 80 00 00 	movabs $0x8062a1,%rdi
+  80457c:	00 00 00 
+  80457f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804584:	48 b9 fa 27 80 00 00 	movabs $0x8027fa,%rcx
+  80458b:	00 00 00 
+  80458e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  804590:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804597:	eb b5                	jmp    80454e <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  804599:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8045a0:	eb ac                	jmp    80454e <read+0x6a>
+
+00000000008045a2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8045a2:	55                   	push   %rbp
+  8045a3:	48 89 e5             	mov    %rsp,%rbp
+  8045a6:	41 57                	push   %r15
+  8045a8:	41 56                	push   %r14
+  8045aa:	41 55                	push   %r13
+  8045ac:	41 54                	push   %r12
+  8045ae:	53                   	push   %rbx
+  8045af:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8045b3:	48 85 d2             	test   %rdx,%rdx
+  8045b6:	74 54                	je     80460c <readn+0x6a>
+  8045b8:	41 89 fd             	mov    %edi,%r13d
+  8045bb:	49 89 f6             	mov    %rsi,%r14
+  8045be:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8045c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8045c6:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8045cb:	49 bf e4 44 80 00 00 	movabs $0x8044e4,%r15
+  8045d2:	00 00 00 
+  8045d5:	4c 89 e2             	mov    %r12,%rdx
+  8045d8:	48 29 f2             	sub    %rsi,%rdx
+  8045db:	4c 01 f6             	add    %r14,%rsi
+  8045de:	44 89 ef             	mov    %r13d,%edi
+  8045e1:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8045e4:	85 c0                	test   %eax,%eax
+  8045e6:	78 20                	js     804608 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8045e8:	01 c3                	add    %eax,%ebx
+  8045ea:	85 c0                	test   %eax,%eax
+  8045ec:	74 08                	je     8045f6 <readn+0x54>
+  8045ee:	48 63 f3             	movslq %ebx,%rsi
+  8045f1:	4c 39 e6             	cmp    %r12,%rsi
+  8045f4:	72 df                	jb     8045d5 <readn+0x33>
+    }
+    return res;
+  8045f6:	48 63 c3             	movslq %ebx,%rax
+}
+  8045f9:	48 83 c4 08          	add    $0x8,%rsp
+  8045fd:	5b                   	pop    %rbx
+  8045fe:	41 5c                	pop    %r12
+  804600:	41 5d                	pop    %r13
+  804602:	41 5e                	pop    %r14
+  804604:	41 5f                	pop    %r15
+  804606:	5d                   	pop    %rbp
+  804607:	c3                   	ret
+        if (inc < 0) return inc;
+  804608:	48 98                	cltq
+  80460a:	eb ed                	jmp    8045f9 <readn+0x57>
+    int inc = 1, res = 0;
+  80460c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804611:	eb e3                	jmp    8045f6 <readn+0x54>
+
+0000000000804613 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  804613:	55                   	push   %rbp
+  804614:	48 89 e5             	mov    %rsp,%rbp
+  804617:	41 56                	push   %r14
+  804619:	41 55                	push   %r13
+  80461b:	41 54                	push   %r12
+  80461d:	53                   	push   %rbx
+  80461e:	48 83 ec 10          	sub    $0x10,%rsp
+  804622:	89 fb                	mov    %edi,%ebx
+  804624:	49 89 f4             	mov    %rsi,%r12
+  804627:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80462a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80462e:	48 b8 01 42 80 00 00 	movabs $0x804201,%rax
+  804635:	00 00 00 
+  804638:	ff d0                	call   *%rax
+  80463a:	85 c0                	test   %eax,%eax
+  80463c:	78 47                	js     804685 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80463e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  804642:	41 8b 3e             	mov    (%r14),%edi
+  804645:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  804649:	48 b8 4c 42 80 00 00 	movabs $0x80424c,%rax
+  804650:	00 00 00 
+  804653:	ff d0                	call   *%rax
+  804655:	85 c0                	test   %eax,%eax
+  804657:	78 30                	js     804689 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804659:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80465e:	74 2d                	je     80468d <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  804660:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804664:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804668:	48 85 c0             	test   %rax,%rax
+  80466b:	74 56                	je     8046c3 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80466d:	4c 89 ea             	mov    %r13,%rdx
+  804670:	4c 89 e6             	mov    %r12,%rsi
+  804673:	4c 89 f7             	mov    %r14,%rdi
+  804676:	ff d0                	call   *%rax
+}
+  804678:	48 83 c4 10          	add    $0x10,%rsp
+  80467c:	5b                   	pop    %rbx
+  80467d:	41 5c                	pop    %r12
+  80467f:	41 5d                	pop    %r13
+  804681:	41 5e                	pop    %r14
+  804683:	5d                   	pop    %rbp
+  804684:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  804685:	48 98                	cltq
+  804687:	eb ef                	jmp    804678 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  804689:	48 98                	cltq
+  80468b:	eb eb                	jmp    804678 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80468d:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  804694:	00 00 00 
+  804697:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80469d:	89 da                	mov    %ebx,%edx
+  80469f:	48 bf bd 62 80 00 00 	movabs $0x8062bd,%rdi
+  8046a6:	00 00 00 
+  8046a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046ae:	48 b9 fa 27 80 00 00 	movabs $0x8027fa,%rcx
+  8046b5:	00 00 00 
+  8046b8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8046ba:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8046c1:	eb b5                	jmp    804678 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8046c3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8046ca:	eb ac                	jmp    804678 <write+0x65>
+
+00000000008046cc <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8046cc:	55                   	push   %rbp
+  8046cd:	48 89 e5             	mov    %rsp,%rbp
+  8046d0:	53                   	push   %rbx
+  8046d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8046d5:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8046d7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8046db:	48 b8 01 42 80 00 00 	movabs $0x804201,%rax
+  8046e2:	00 00 00 
+  8046e5:	ff d0                	call   *%rax
+  8046e7:	85 c0                	test   %eax,%eax
+  8046e9:	78 0c                	js     8046f7 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8046eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046ef:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8046f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8046fb:	c9                   	leave
+  8046fc:	c3                   	ret
+
+00000000008046fd <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8046fd:	55                   	push   %rbp
+  8046fe:	48 89 e5             	mov    %rsp,%rbp
+  804701:	41 55                	push   %r13
+  804703:	41 54                	push   %r12
+  804705:	53                   	push   %rbx
+  804706:	48 83 ec 18          	sub    $0x18,%rsp
+  80470a:	89 fb                	mov    %edi,%ebx
+  80470c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80470f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804713:	48 b8 01 42 80 00 00 	movabs $0x804201,%rax
+  80471a:	00 00 00 
+  80471d:	ff d0                	call   *%rax
+  80471f:	85 c0                	test   %eax,%eax
+  804721:	78 38                	js     80475b <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  804723:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  804727:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80472b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80472f:	48 b8 4c 42 80 00 00 	movabs $0x80424c,%rax
+  804736:	00 00 00 
+  804739:	ff d0                	call   *%rax
+  80473b:	85 c0                	test   %eax,%eax
+  80473d:	78 1c                	js     80475b <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80473f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  804744:	74 20                	je     804766 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  804746:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80474a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80474e:	48 85 c0             	test   %rax,%rax
+  804751:	74 47                	je     80479a <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  804753:	44 89 e6             	mov    %r12d,%esi
+  804756:	4c 89 ef             	mov    %r13,%rdi
+  804759:	ff d0                	call   *%rax
+}
+  80475b:	48 83 c4 18          	add    $0x18,%rsp
+  80475f:	5b                   	pop    %rbx
+  804760:	41 5c                	pop    %r12
+  804762:	41 5d                	pop    %r13
+  804764:	5d                   	pop    %rbp
+  804765:	c3                   	ret
+                thisenv->env_id, fdnum);
+  804766:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  80476d:	00 00 00 
+  804770:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  804776:	89 da                	mov    %ebx,%edx
+  804778:	48 bf 80 62 80 00 00 	movabs $0x806280,%rdi
+  80477f:	00 00 00 
+  804782:	b8 00 00 00 00       	mov    $0x0,%eax
+  804787:	48 b9 fa 27 80 00 00 	movabs $0x8027fa,%rcx
+  80478e:	00 00 00 
+  804791:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  804793:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804798:	eb c1                	jmp    80475b <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80479a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80479f:	eb ba                	jmp    80475b <ftruncate+0x5e>
+
+00000000008047a1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8047a1:	55                   	push   %rbp
+  8047a2:	48 89 e5             	mov    %rsp,%rbp
+  8047a5:	41 54                	push   %r12
+  8047a7:	53                   	push   %rbx
+  8047a8:	48 83 ec 10          	sub    $0x10,%rsp
+  8047ac:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8047af:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8047b3:	48 b8 01 42 80 00 00 	movabs $0x804201,%rax
+  8047ba:	00 00 00 
+  8047bd:	ff d0                	call   *%rax
+  8047bf:	85 c0                	test   %eax,%eax
+  8047c1:	78 4e                	js     804811 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8047c3:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8047c7:	41 8b 3c 24          	mov    (%r12),%edi
+  8047cb:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8047cf:	48 b8 4c 42 80 00 00 	movabs $0x80424c,%rax
+  8047d6:	00 00 00 
+  8047d9:	ff d0                	call   *%rax
+  8047db:	85 c0                	test   %eax,%eax
+  8047dd:	78 32                	js     804811 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8047df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047e3:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8047e8:	74 30                	je     80481a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8047ea:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8047ed:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8047f4:	00 00 00 
+    stat->st_isdir = 0;
+  8047f7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8047fe:	00 00 00 
+    stat->st_dev = dev;
+  804801:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  804808:	48 89 de             	mov    %rbx,%rsi
+  80480b:	4c 89 e7             	mov    %r12,%rdi
+  80480e:	ff 50 28             	call   *0x28(%rax)
+}
+  804811:	48 83 c4 10          	add    $0x10,%rsp
+  804815:	5b                   	pop    %rbx
+  804816:	41 5c                	pop    %r12
+  804818:	5d                   	pop    %rbp
+  804819:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80481a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80481f:	eb f0                	jmp    804811 <fstat+0x70>
+
+0000000000804821 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  804821:	55                   	push   %rbp
+  804822:	48 89 e5             	mov    %rsp,%rbp
+  804825:	41 54                	push   %r12
+  804827:	53                   	push   %rbx
+  804828:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80482b:	be 00 00 00 00       	mov    $0x0,%esi
+  804830:	48 b8 a2 4a 80 00 00 	movabs $0x804aa2,%rax
+  804837:	00 00 00 
+  80483a:	ff d0                	call   *%rax
+  80483c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80483e:	85 c0                	test   %eax,%eax
+  804840:	78 25                	js     804867 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  804842:	4c 89 e6             	mov    %r12,%rsi
+  804845:	89 c7                	mov    %eax,%edi
+  804847:	48 b8 a1 47 80 00 00 	movabs $0x8047a1,%rax
+  80484e:	00 00 00 
+  804851:	ff d0                	call   *%rax
+  804853:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  804856:	89 df                	mov    %ebx,%edi
+  804858:	48 b8 66 43 80 00 00 	movabs $0x804366,%rax
+  80485f:	00 00 00 
+  804862:	ff d0                	call   *%rax
+
+    return res;
+  804864:	44 89 e3             	mov    %r12d,%ebx
+}
+  804867:	89 d8                	mov    %ebx,%eax
+  804869:	5b                   	pop    %rbx
+  80486a:	41 5c                	pop    %r12
+  80486c:	5d                   	pop    %rbp
+  80486d:	c3                   	ret
+
+000000000080486e <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  80486e:	55                   	push   %rbp
+  80486f:	48 89 e5             	mov    %rsp,%rbp
+  804872:	41 54                	push   %r12
+  804874:	53                   	push   %rbx
+  804875:	48 83 ec 10          	sub    $0x10,%rsp
+  804879:	41 89 fc             	mov    %edi,%r12d
+  80487c:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80487f:	48 b8 00 e0 80 00 00 	movabs $0x80e000,%rax
+  804886:	00 00 00 
+  804889:	83 38 00             	cmpl   $0x0,(%rax)
+  80488c:	74 5e                	je     8048ec <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80488e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  804894:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804899:	48 ba 00 d0 80 00 00 	movabs $0x80d000,%rdx
+  8048a0:	00 00 00 
+  8048a3:	44 89 e6             	mov    %r12d,%esi
+  8048a6:	48 b8 00 e0 80 00 00 	movabs $0x80e000,%rax
+  8048ad:	00 00 00 
+  8048b0:	8b 38                	mov    (%rax),%edi
+  8048b2:	48 b8 83 40 80 00 00 	movabs $0x804083,%rax
+  8048b9:	00 00 00 
+  8048bc:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8048be:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8048c5:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8048c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8048cb:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8048cf:	48 89 de             	mov    %rbx,%rsi
+  8048d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048d7:	48 b8 ee 3f 80 00 00 	movabs $0x803fee,%rax
+  8048de:	00 00 00 
+  8048e1:	ff d0                	call   *%rax
+}
+  8048e3:	48 83 c4 10          	add    $0x10,%rsp
+  8048e7:	5b                   	pop    %rbx
+  8048e8:	41 5c                	pop    %r12
+  8048ea:	5d                   	pop    %rbp
+  8048eb:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8048ec:	bf 03 00 00 00       	mov    $0x3,%edi
+  8048f1:	48 b8 23 41 80 00 00 	movabs $0x804123,%rax
+  8048f8:	00 00 00 
+  8048fb:	ff d0                	call   *%rax
+  8048fd:	a3 00 e0 80 00 00 00 	movabs %eax,0x80e000
+  804904:	00 00 
+  804906:	eb 86                	jmp    80488e <fsipc+0x20>
+
+0000000000804908 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  804908:	55                   	push   %rbp
+  804909:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80490c:	48 b8 00 d0 80 00 00 	movabs $0x80d000,%rax
+  804913:	00 00 00 
+  804916:	8b 57 0c             	mov    0xc(%rdi),%edx
+  804919:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80491b:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80491e:	be 00 00 00 00       	mov    $0x0,%esi
+  804923:	bf 02 00 00 00       	mov    $0x2,%edi
+  804928:	48 b8 6e 48 80 00 00 	movabs $0x80486e,%rax
+  80492f:	00 00 00 
+  804932:	ff d0                	call   *%rax
+}
+  804934:	5d                   	pop    %rbp
+  804935:	c3                   	ret
+
+0000000000804936 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  804936:	55                   	push   %rbp
+  804937:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80493a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80493d:	a3 00 d0 80 00 00 00 	movabs %eax,0x80d000
+  804944:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  804946:	be 00 00 00 00       	mov    $0x0,%esi
+  80494b:	bf 06 00 00 00       	mov    $0x6,%edi
+  804950:	48 b8 6e 48 80 00 00 	movabs $0x80486e,%rax
+  804957:	00 00 00 
+  80495a:	ff d0                	call   *%rax
+}
+  80495c:	5d                   	pop    %rbp
+  80495d:	c3                   	ret
+
+000000000080495e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80495e:	55                   	push   %rbp
+  80495f:	48 89 e5             	mov    %rsp,%rbp
+  804962:	41 54                	push   %r12
+  804964:	53                   	push   %rbx
+  804965:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804968:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80496b:	a3 00 d0 80 00 00 00 	movabs %eax,0x80d000
+  804972:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  804974:	be 00 00 00 00       	mov    $0x0,%esi
+  804979:	bf 05 00 00 00       	mov    $0x5,%edi
+  80497e:	48 b8 6e 48 80 00 00 	movabs $0x80486e,%rax
+  804985:	00 00 00 
+  804988:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80498a:	85 c0                	test   %eax,%eax
+  80498c:	78 3d                	js     8049cb <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80498e:	49 bc 00 d0 80 00 00 	movabs $0x80d000,%r12
+  804995:	00 00 00 
+  804998:	4c 89 e6             	mov    %r12,%rsi
+  80499b:	48 89 df             	mov    %rbx,%rdi
+  80499e:	48 b8 1f 31 80 00 00 	movabs $0x80311f,%rax
+  8049a5:	00 00 00 
+  8049a8:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8049aa:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8049b1:	00 
+  8049b2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8049b8:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8049bf:	00 
+  8049c0:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8049c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049cb:	5b                   	pop    %rbx
+  8049cc:	41 5c                	pop    %r12
+  8049ce:	5d                   	pop    %rbp
+  8049cf:	c3                   	ret
+
+00000000008049d0 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8049d0:	55                   	push   %rbp
+  8049d1:	48 89 e5             	mov    %rsp,%rbp
+  8049d4:	41 54                	push   %r12
+  8049d6:	53                   	push   %rbx
+  8049d7:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8049da:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8049df:	48 39 c2             	cmp    %rax,%rdx
+  8049e2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8049e6:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8049e9:	48 89 c2             	mov    %rax,%rdx
+  8049ec:	48 bf 10 d0 80 00 00 	movabs $0x80d010,%rdi
+  8049f3:	00 00 00 
+  8049f6:	48 b8 80 33 80 00 00 	movabs $0x803380,%rax
+  8049fd:	00 00 00 
+  804a00:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804a02:	48 b8 00 d0 80 00 00 	movabs $0x80d000,%rax
+  804a09:	00 00 00 
+  804a0c:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  804a11:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  804a13:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  804a17:	be 00 00 00 00       	mov    $0x0,%esi
+  804a1c:	bf 04 00 00 00       	mov    $0x4,%edi
+  804a21:	48 b8 6e 48 80 00 00 	movabs $0x80486e,%rax
+  804a28:	00 00 00 
+  804a2b:	ff d0                	call   *%rax
+  804a2d:	48 98                	cltq
+}
+  804a2f:	5b                   	pop    %rbx
+  804a30:	41 5c                	pop    %r12
+  804a32:	5d                   	pop    %rbp
+  804a33:	c3                   	ret
+
+0000000000804a34 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  804a34:	55                   	push   %rbp
+  804a35:	48 89 e5             	mov    %rsp,%rbp
+  804a38:	41 54                	push   %r12
+  804a3a:	53                   	push   %rbx
+  804a3b:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804a3e:	48 b8 00 d0 80 00 00 	movabs $0x80d000,%rax
+  804a45:	00 00 00 
+  804a48:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  804a4b:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  804a4d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804a52:	48 39 ca             	cmp    %rcx,%rdx
+  804a55:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  804a59:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  804a5d:	be 00 00 00 00       	mov    $0x0,%esi
+  804a62:	bf 03 00 00 00       	mov    $0x3,%edi
+  804a67:	48 b8 6e 48 80 00 00 	movabs $0x80486e,%rax
+  804a6e:	00 00 00 
+  804a71:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  804a73:	85 c0                	test   %eax,%eax
+  804a75:	78 27                	js     804a9e <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  804a77:	48 63 d8             	movslq %eax,%rbx
+  804a7a:	48 89 da             	mov    %rbx,%rdx
+  804a7d:	48 be 00 d0 80 00 00 	movabs $0x80d000,%rsi
+  804a84:	00 00 00 
+  804a87:	4c 89 e7             	mov    %r12,%rdi
+  804a8a:	48 b8 80 33 80 00 00 	movabs $0x803380,%rax
+  804a91:	00 00 00 
+  804a94:	ff d0                	call   *%rax
+    return bytes_read;
+  804a96:	48 89 d8             	mov    %rbx,%rax
+}
+  804a99:	5b                   	pop    %rbx
+  804a9a:	41 5c                	pop    %r12
+  804a9c:	5d                   	pop    %rbp
+  804a9d:	c3                   	ret
+        return bytes_read;
+  804a9e:	48 98                	cltq
+  804aa0:	eb f7                	jmp    804a99 <devfile_read+0x65>
+
+0000000000804aa2 <open>:
+open(const char *path, int mode) {
+  804aa2:	55                   	push   %rbp
+  804aa3:	48 89 e5             	mov    %rsp,%rbp
+  804aa6:	41 55                	push   %r13
+  804aa8:	41 54                	push   %r12
+  804aaa:	53                   	push   %rbx
+  804aab:	48 83 ec 18          	sub    $0x18,%rsp
+  804aaf:	49 89 fc             	mov    %rdi,%r12
+  804ab2:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  804ab5:	48 b8 e1 30 80 00 00 	movabs $0x8030e1,%rax
+  804abc:	00 00 00 
+  804abf:	ff d0                	call   *%rax
+  804ac1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  804ac7:	0f 87 8a 00 00 00    	ja     804b57 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804acd:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804ad1:	48 b8 a1 41 80 00 00 	movabs $0x8041a1,%rax
+  804ad8:	00 00 00 
+  804adb:	ff d0                	call   *%rax
+  804add:	89 c3                	mov    %eax,%ebx
+  804adf:	85 c0                	test   %eax,%eax
+  804ae1:	78 50                	js     804b33 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  804ae3:	4c 89 e6             	mov    %r12,%rsi
+  804ae6:	48 bb 00 d0 80 00 00 	movabs $0x80d000,%rbx
+  804aed:	00 00 00 
+  804af0:	48 89 df             	mov    %rbx,%rdi
+  804af3:	48 b8 1f 31 80 00 00 	movabs $0x80311f,%rax
+  804afa:	00 00 00 
+  804afd:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  804aff:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  804b06:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804b0a:	bf 01 00 00 00       	mov    $0x1,%edi
+  804b0f:	48 b8 6e 48 80 00 00 	movabs $0x80486e,%rax
+  804b16:	00 00 00 
+  804b19:	ff d0                	call   *%rax
+  804b1b:	89 c3                	mov    %eax,%ebx
+  804b1d:	85 c0                	test   %eax,%eax
+  804b1f:	78 1f                	js     804b40 <open+0x9e>
+    return fd2num(fd);
+  804b21:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804b25:	48 b8 73 41 80 00 00 	movabs $0x804173,%rax
+  804b2c:	00 00 00 
+  804b2f:	ff d0                	call   *%rax
+  804b31:	89 c3                	mov    %eax,%ebx
+}
+  804b33:	89 d8                	mov    %ebx,%eax
+  804b35:	48 83 c4 18          	add    $0x18,%rsp
+  804b39:	5b                   	pop    %rbx
+  804b3a:	41 5c                	pop    %r12
+  804b3c:	41 5d                	pop    %r13
+  804b3e:	5d                   	pop    %rbp
+  804b3f:	c3                   	ret
+        fd_close(fd, 0);
+  804b40:	be 00 00 00 00       	mov    $0x0,%esi
+  804b45:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804b49:	48 b8 bc 42 80 00 00 	movabs $0x8042bc,%rax
+  804b50:	00 00 00 
+  804b53:	ff d0                	call   *%rax
+        return res;
+  804b55:	eb dc                	jmp    804b33 <open+0x91>
+        return -E_BAD_PATH;
+  804b57:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  804b5c:	eb d5                	jmp    804b33 <open+0x91>
+
+0000000000804b5e <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  804b5e:	55                   	push   %rbp
+  804b5f:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  804b62:	be 00 00 00 00       	mov    $0x0,%esi
+  804b67:	bf 08 00 00 00       	mov    $0x8,%edi
+  804b6c:	48 b8 6e 48 80 00 00 	movabs $0x80486e,%rax
+  804b73:	00 00 00 
+  804b76:	ff d0                	call   *%rax
+}
+  804b78:	5d                   	pop    %rbp
+  804b79:	c3                   	ret
+
+0000000000804b7a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804b7a:	55                   	push   %rbp
+  804b7b:	48 89 e5             	mov    %rsp,%rbp
+  804b7e:	41 54                	push   %r12
+  804b80:	53                   	push   %rbx
+  804b81:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804b84:	48 b8 85 41 80 00 00 	movabs $0x804185,%rax
+  804b8b:	00 00 00 
+  804b8e:	ff d0                	call   *%rax
+  804b90:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804b93:	48 be 00 63 80 00 00 	movabs $0x806300,%rsi
+  804b9a:	00 00 00 
+  804b9d:	48 89 df             	mov    %rbx,%rdi
+  804ba0:	48 b8 1f 31 80 00 00 	movabs $0x80311f,%rax
+  804ba7:	00 00 00 
+  804baa:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804bac:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804bb1:	41 2b 04 24          	sub    (%r12),%eax
+  804bb5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804bbb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804bc2:	00 00 00 
+    stat->st_dev = &devpipe;
+  804bc5:	48 b8 e0 b0 80 00 00 	movabs $0x80b0e0,%rax
+  804bcc:	00 00 00 
+  804bcf:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  804bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bdb:	5b                   	pop    %rbx
+  804bdc:	41 5c                	pop    %r12
+  804bde:	5d                   	pop    %rbp
+  804bdf:	c3                   	ret
+
+0000000000804be0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804be0:	55                   	push   %rbp
+  804be1:	48 89 e5             	mov    %rsp,%rbp
+  804be4:	41 54                	push   %r12
+  804be6:	53                   	push   %rbx
+  804be7:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804bea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804bef:	48 89 fe             	mov    %rdi,%rsi
+  804bf2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bf7:	49 bc 9b 37 80 00 00 	movabs $0x80379b,%r12
+  804bfe:	00 00 00 
+  804c01:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804c04:	48 89 df             	mov    %rbx,%rdi
+  804c07:	48 b8 85 41 80 00 00 	movabs $0x804185,%rax
+  804c0e:	00 00 00 
+  804c11:	ff d0                	call   *%rax
+  804c13:	48 89 c6             	mov    %rax,%rsi
+  804c16:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c20:	41 ff d4             	call   *%r12
+}
+  804c23:	5b                   	pop    %rbx
+  804c24:	41 5c                	pop    %r12
+  804c26:	5d                   	pop    %rbp
+  804c27:	c3                   	ret
+
+0000000000804c28 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804c28:	55                   	push   %rbp
+  804c29:	48 89 e5             	mov    %rsp,%rbp
+  804c2c:	41 57                	push   %r15
+  804c2e:	41 56                	push   %r14
+  804c30:	41 55                	push   %r13
+  804c32:	41 54                	push   %r12
+  804c34:	53                   	push   %rbx
+  804c35:	48 83 ec 18          	sub    $0x18,%rsp
+  804c39:	49 89 fc             	mov    %rdi,%r12
+  804c3c:	49 89 f5             	mov    %rsi,%r13
+  804c3f:	49 89 d7             	mov    %rdx,%r15
+  804c42:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804c46:	48 b8 85 41 80 00 00 	movabs $0x804185,%rax
+  804c4d:	00 00 00 
+  804c50:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804c52:	4d 85 ff             	test   %r15,%r15
+  804c55:	0f 84 af 00 00 00    	je     804d0a <devpipe_write+0xe2>
+  804c5b:	48 89 c3             	mov    %rax,%rbx
+  804c5e:	4c 89 f8             	mov    %r15,%rax
+  804c61:	4d 89 ef             	mov    %r13,%r15
+  804c64:	4c 01 e8             	add    %r13,%rax
+  804c67:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804c6b:	49 bd a3 36 80 00 00 	movabs $0x8036a3,%r13
+  804c72:	00 00 00 
+            sys_yield();
+  804c75:	49 be 40 36 80 00 00 	movabs $0x803640,%r14
+  804c7c:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804c7f:	8b 73 04             	mov    0x4(%rbx),%esi
+  804c82:	48 63 ce             	movslq %esi,%rcx
+  804c85:	48 63 03             	movslq (%rbx),%rax
+  804c88:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804c8e:	48 39 c1             	cmp    %rax,%rcx
+  804c91:	72 2e                	jb     804cc1 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804c93:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804c98:	48 89 da             	mov    %rbx,%rdx
+  804c9b:	be 00 10 00 00       	mov    $0x1000,%esi
+  804ca0:	4c 89 e7             	mov    %r12,%rdi
+  804ca3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804ca6:	85 c0                	test   %eax,%eax
+  804ca8:	74 66                	je     804d10 <devpipe_write+0xe8>
+            sys_yield();
+  804caa:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804cad:	8b 73 04             	mov    0x4(%rbx),%esi
+  804cb0:	48 63 ce             	movslq %esi,%rcx
+  804cb3:	48 63 03             	movslq (%rbx),%rax
+  804cb6:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804cbc:	48 39 c1             	cmp    %rax,%rcx
+  804cbf:	73 d2                	jae    804c93 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804cc1:	41 0f b6 3f          	movzbl (%r15),%edi
+  804cc5:	48 89 ca             	mov    %rcx,%rdx
+  804cc8:	48 c1 ea 03          	shr    $0x3,%rdx
+  804ccc:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804cd3:	08 10 20 
+  804cd6:	48 f7 e2             	mul    %rdx
+  804cd9:	48 c1 ea 06          	shr    $0x6,%rdx
+  804cdd:	48 89 d0             	mov    %rdx,%rax
+  804ce0:	48 c1 e0 09          	shl    $0x9,%rax
+  804ce4:	48 29 d0             	sub    %rdx,%rax
+  804ce7:	48 c1 e0 03          	shl    $0x3,%rax
+  804ceb:	48 29 c1             	sub    %rax,%rcx
+  804cee:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804cf3:	83 c6 01             	add    $0x1,%esi
+  804cf6:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804cf9:	49 83 c7 01          	add    $0x1,%r15
+  804cfd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d01:	49 39 c7             	cmp    %rax,%r15
+  804d04:	0f 85 75 ff ff ff    	jne    804c7f <devpipe_write+0x57>
+    return n;
+  804d0a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d0e:	eb 05                	jmp    804d15 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804d10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d15:	48 83 c4 18          	add    $0x18,%rsp
+  804d19:	5b                   	pop    %rbx
+  804d1a:	41 5c                	pop    %r12
+  804d1c:	41 5d                	pop    %r13
+  804d1e:	41 5e                	pop    %r14
+  804d20:	41 5f                	pop    %r15
+  804d22:	5d                   	pop    %rbp
+  804d23:	c3                   	ret
+
+0000000000804d24 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804d24:	55                   	push   %rbp
+  804d25:	48 89 e5             	mov    %rsp,%rbp
+  804d28:	41 57                	push   %r15
+  804d2a:	41 56                	push   %r14
+  804d2c:	41 55                	push   %r13
+  804d2e:	41 54                	push   %r12
+  804d30:	53                   	push   %rbx
+  804d31:	48 83 ec 18          	sub    $0x18,%rsp
+  804d35:	49 89 fc             	mov    %rdi,%r12
+  804d38:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804d3c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804d40:	48 b8 85 41 80 00 00 	movabs $0x804185,%rax
+  804d47:	00 00 00 
+  804d4a:	ff d0                	call   *%rax
+  804d4c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804d4f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804d55:	49 bd a3 36 80 00 00 	movabs $0x8036a3,%r13
+  804d5c:	00 00 00 
+            sys_yield();
+  804d5f:	49 be 40 36 80 00 00 	movabs $0x803640,%r14
+  804d66:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804d69:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804d6e:	74 7d                	je     804ded <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804d70:	8b 03                	mov    (%rbx),%eax
+  804d72:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804d75:	75 26                	jne    804d9d <devpipe_read+0x79>
+            if (i > 0) return i;
+  804d77:	4d 85 ff             	test   %r15,%r15
+  804d7a:	75 77                	jne    804df3 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804d7c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804d81:	48 89 da             	mov    %rbx,%rdx
+  804d84:	be 00 10 00 00       	mov    $0x1000,%esi
+  804d89:	4c 89 e7             	mov    %r12,%rdi
+  804d8c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804d8f:	85 c0                	test   %eax,%eax
+  804d91:	74 72                	je     804e05 <devpipe_read+0xe1>
+            sys_yield();
+  804d93:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804d96:	8b 03                	mov    (%rbx),%eax
+  804d98:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804d9b:	74 df                	je     804d7c <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804d9d:	48 63 c8             	movslq %eax,%rcx
+  804da0:	48 89 ca             	mov    %rcx,%rdx
+  804da3:	48 c1 ea 03          	shr    $0x3,%rdx
+  804da7:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804dae:	08 10 20 
+  804db1:	48 89 d0             	mov    %rdx,%rax
+  804db4:	48 f7 e6             	mul    %rsi
+  804db7:	48 c1 ea 06          	shr    $0x6,%rdx
+  804dbb:	48 89 d0             	mov    %rdx,%rax
+  804dbe:	48 c1 e0 09          	shl    $0x9,%rax
+  804dc2:	48 29 d0             	sub    %rdx,%rax
+  804dc5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804dcc:	00 
+  804dcd:	48 89 c8             	mov    %rcx,%rax
+  804dd0:	48 29 d0             	sub    %rdx,%rax
+  804dd3:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804dd8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804ddc:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804de0:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804de3:	49 83 c7 01          	add    $0x1,%r15
+  804de7:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804deb:	75 83                	jne    804d70 <devpipe_read+0x4c>
+    return n;
+  804ded:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804df1:	eb 03                	jmp    804df6 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804df3:	4c 89 f8             	mov    %r15,%rax
+}
+  804df6:	48 83 c4 18          	add    $0x18,%rsp
+  804dfa:	5b                   	pop    %rbx
+  804dfb:	41 5c                	pop    %r12
+  804dfd:	41 5d                	pop    %r13
+  804dff:	41 5e                	pop    %r14
+  804e01:	41 5f                	pop    %r15
+  804e03:	5d                   	pop    %rbp
+  804e04:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804e05:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e0a:	eb ea                	jmp    804df6 <devpipe_read+0xd2>
+
+0000000000804e0c <pipe>:
+pipe(int pfd[2]) {
+  804e0c:	55                   	push   %rbp
+  804e0d:	48 89 e5             	mov    %rsp,%rbp
+  804e10:	41 55                	push   %r13
+  804e12:	41 54                	push   %r12
+  804e14:	53                   	push   %rbx
+  804e15:	48 83 ec 18          	sub    $0x18,%rsp
+  804e19:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804e1c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804e20:	48 b8 a1 41 80 00 00 	movabs $0x8041a1,%rax
+  804e27:	00 00 00 
+  804e2a:	ff d0                	call   *%rax
+  804e2c:	89 c3                	mov    %eax,%ebx
+  804e2e:	85 c0                	test   %eax,%eax
+  804e30:	0f 88 a0 01 00 00    	js     804fd6 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804e36:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804e3b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e40:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804e44:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e49:	48 b8 cf 36 80 00 00 	movabs $0x8036cf,%rax
+  804e50:	00 00 00 
+  804e53:	ff d0                	call   *%rax
+  804e55:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804e57:	85 c0                	test   %eax,%eax
+  804e59:	0f 88 77 01 00 00    	js     804fd6 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804e5f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804e63:	48 b8 a1 41 80 00 00 	movabs $0x8041a1,%rax
+  804e6a:	00 00 00 
+  804e6d:	ff d0                	call   *%rax
+  804e6f:	89 c3                	mov    %eax,%ebx
+  804e71:	85 c0                	test   %eax,%eax
+  804e73:	0f 88 43 01 00 00    	js     804fbc <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804e79:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804e7e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e83:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804e87:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e8c:	48 b8 cf 36 80 00 00 	movabs $0x8036cf,%rax
+  804e93:	00 00 00 
+  804e96:	ff d0                	call   *%rax
+  804e98:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804e9a:	85 c0                	test   %eax,%eax
+  804e9c:	0f 88 1a 01 00 00    	js     804fbc <pipe+0x1b0>
+    va = fd2data(fd0);
+  804ea2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804ea6:	48 b8 85 41 80 00 00 	movabs $0x804185,%rax
+  804ead:	00 00 00 
+  804eb0:	ff d0                	call   *%rax
+  804eb2:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804eb5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804eba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ebf:	48 89 c6             	mov    %rax,%rsi
+  804ec2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ec7:	48 b8 cf 36 80 00 00 	movabs $0x8036cf,%rax
+  804ece:	00 00 00 
+  804ed1:	ff d0                	call   *%rax
+  804ed3:	89 c3                	mov    %eax,%ebx
+  804ed5:	85 c0                	test   %eax,%eax
+  804ed7:	0f 88 c5 00 00 00    	js     804fa2 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804edd:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804ee1:	48 b8 85 41 80 00 00 	movabs $0x804185,%rax
+  804ee8:	00 00 00 
+  804eeb:	ff d0                	call   *%rax
+  804eed:	48 89 c1             	mov    %rax,%rcx
+  804ef0:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804ef6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804efc:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f01:	4c 89 ee             	mov    %r13,%rsi
+  804f04:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f09:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  804f10:	00 00 00 
+  804f13:	ff d0                	call   *%rax
+  804f15:	89 c3                	mov    %eax,%ebx
+  804f17:	85 c0                	test   %eax,%eax
+  804f19:	78 6e                	js     804f89 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804f1b:	be 00 10 00 00       	mov    $0x1000,%esi
+  804f20:	4c 89 ef             	mov    %r13,%rdi
+  804f23:	48 b8 71 36 80 00 00 	movabs $0x803671,%rax
+  804f2a:	00 00 00 
+  804f2d:	ff d0                	call   *%rax
+  804f2f:	83 f8 02             	cmp    $0x2,%eax
+  804f32:	0f 85 ab 00 00 00    	jne    804fe3 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804f38:	a1 e0 b0 80 00 00 00 	movabs 0x80b0e0,%eax
+  804f3f:	00 00 
+  804f41:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804f45:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804f47:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804f4b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804f52:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804f56:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804f58:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f5c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804f63:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804f67:	48 bb 73 41 80 00 00 	movabs $0x804173,%rbx
+  804f6e:	00 00 00 
+  804f71:	ff d3                	call   *%rbx
+  804f73:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804f77:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804f7b:	ff d3                	call   *%rbx
+  804f7d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804f82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804f87:	eb 4d                	jmp    804fd6 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804f89:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804f8e:	4c 89 ee             	mov    %r13,%rsi
+  804f91:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f96:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  804f9d:	00 00 00 
+  804fa0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804fa2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804fa7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804fab:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fb0:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  804fb7:	00 00 00 
+  804fba:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804fbc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804fc1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804fc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fca:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  804fd1:	00 00 00 
+  804fd4:	ff d0                	call   *%rax
+}
+  804fd6:	89 d8                	mov    %ebx,%eax
+  804fd8:	48 83 c4 18          	add    $0x18,%rsp
+  804fdc:	5b                   	pop    %rbx
+  804fdd:	41 5c                	pop    %r12
+  804fdf:	41 5d                	pop    %r13
+  804fe1:	5d                   	pop    %rbp
+  804fe2:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804fe3:	48 b9 18 63 80 00 00 	movabs $0x806318,%rcx
+  804fea:	00 00 00 
+  804fed:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  804ff4:	00 00 00 
+  804ff7:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804ffc:	48 bf 07 63 80 00 00 	movabs $0x806307,%rdi
+  805003:	00 00 00 
+  805006:	b8 00 00 00 00       	mov    $0x0,%eax
+  80500b:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  805012:	00 00 00 
+  805015:	41 ff d0             	call   *%r8
+
+0000000000805018 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  805018:	55                   	push   %rbp
+  805019:	48 89 e5             	mov    %rsp,%rbp
+  80501c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805020:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805024:	48 b8 01 42 80 00 00 	movabs $0x804201,%rax
+  80502b:	00 00 00 
+  80502e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805030:	85 c0                	test   %eax,%eax
+  805032:	78 35                	js     805069 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  805034:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805038:	48 b8 85 41 80 00 00 	movabs $0x804185,%rax
+  80503f:	00 00 00 
+  805042:	ff d0                	call   *%rax
+  805044:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805047:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80504c:	be 00 10 00 00       	mov    $0x1000,%esi
+  805051:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805055:	48 b8 a3 36 80 00 00 	movabs $0x8036a3,%rax
+  80505c:	00 00 00 
+  80505f:	ff d0                	call   *%rax
+  805061:	85 c0                	test   %eax,%eax
+  805063:	0f 94 c0             	sete   %al
+  805066:	0f b6 c0             	movzbl %al,%eax
+}
+  805069:	c9                   	leave
+  80506a:	c3                   	ret
+
+000000000080506b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80506b:	48 89 f8             	mov    %rdi,%rax
+  80506e:	48 c1 e8 27          	shr    $0x27,%rax
+  805072:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  805079:	01 00 00 
+  80507c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805080:	f6 c2 01             	test   $0x1,%dl
+  805083:	74 6d                	je     8050f2 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  805085:	48 89 f8             	mov    %rdi,%rax
+  805088:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80508c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805093:	01 00 00 
+  805096:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80509a:	f6 c2 01             	test   $0x1,%dl
+  80509d:	74 62                	je     805101 <get_uvpt_entry+0x96>
+  80509f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8050a6:	01 00 00 
+  8050a9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8050ad:	f6 c2 80             	test   $0x80,%dl
+  8050b0:	75 4f                	jne    805101 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8050b2:	48 89 f8             	mov    %rdi,%rax
+  8050b5:	48 c1 e8 15          	shr    $0x15,%rax
+  8050b9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8050c0:	01 00 00 
+  8050c3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8050c7:	f6 c2 01             	test   $0x1,%dl
+  8050ca:	74 44                	je     805110 <get_uvpt_entry+0xa5>
+  8050cc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8050d3:	01 00 00 
+  8050d6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8050da:	f6 c2 80             	test   $0x80,%dl
+  8050dd:	75 31                	jne    805110 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8050df:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8050e3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8050ea:	01 00 00 
+  8050ed:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8050f1:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8050f2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8050f9:	01 00 00 
+  8050fc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  805100:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  805101:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805108:	01 00 00 
+  80510b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80510f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  805110:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  805117:	01 00 00 
+  80511a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80511e:	c3                   	ret
+
+000000000080511f <get_prot>:
+
+int
+get_prot(void *va) {
+  80511f:	55                   	push   %rbp
+  805120:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  805123:	48 b8 6b 50 80 00 00 	movabs $0x80506b,%rax
+  80512a:	00 00 00 
+  80512d:	ff d0                	call   *%rax
+  80512f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  805132:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  805137:	89 c1                	mov    %eax,%ecx
+  805139:	83 c9 04             	or     $0x4,%ecx
+  80513c:	f6 c2 01             	test   $0x1,%dl
+  80513f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  805142:	89 c1                	mov    %eax,%ecx
+  805144:	83 c9 02             	or     $0x2,%ecx
+  805147:	f6 c2 02             	test   $0x2,%dl
+  80514a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80514d:	89 c1                	mov    %eax,%ecx
+  80514f:	83 c9 01             	or     $0x1,%ecx
+  805152:	48 85 d2             	test   %rdx,%rdx
+  805155:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  805158:	89 c1                	mov    %eax,%ecx
+  80515a:	83 c9 40             	or     $0x40,%ecx
+  80515d:	f6 c6 04             	test   $0x4,%dh
+  805160:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  805163:	5d                   	pop    %rbp
+  805164:	c3                   	ret
+
+0000000000805165 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  805165:	55                   	push   %rbp
+  805166:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  805169:	48 b8 6b 50 80 00 00 	movabs $0x80506b,%rax
+  805170:	00 00 00 
+  805173:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  805175:	48 c1 e8 06          	shr    $0x6,%rax
+  805179:	83 e0 01             	and    $0x1,%eax
+}
+  80517c:	5d                   	pop    %rbp
+  80517d:	c3                   	ret
+
+000000000080517e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80517e:	55                   	push   %rbp
+  80517f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  805182:	48 b8 6b 50 80 00 00 	movabs $0x80506b,%rax
+  805189:	00 00 00 
+  80518c:	ff d0                	call   *%rax
+  80518e:	83 e0 01             	and    $0x1,%eax
+}
+  805191:	5d                   	pop    %rbp
+  805192:	c3                   	ret
+
+0000000000805193 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  805193:	55                   	push   %rbp
+  805194:	48 89 e5             	mov    %rsp,%rbp
+  805197:	41 57                	push   %r15
+  805199:	41 56                	push   %r14
+  80519b:	41 55                	push   %r13
+  80519d:	41 54                	push   %r12
+  80519f:	53                   	push   %rbx
+  8051a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8051a4:	49 89 ff             	mov    %rdi,%r15
+  8051a7:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8051ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  8051b0:	49 bc 7e 51 80 00 00 	movabs $0x80517e,%r12
+  8051b7:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  8051ba:	49 be 1f 51 80 00 00 	movabs $0x80511f,%r14
+  8051c1:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8051c4:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  8051cb:	00 00 00 
+  8051ce:	eb 0c                	jmp    8051dc <foreach_shared_region+0x49>
+  8051d0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8051d7:	4c 39 eb             	cmp    %r13,%rbx
+  8051da:	74 38                	je     805214 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  8051dc:	48 89 df             	mov    %rbx,%rdi
+  8051df:	41 ff d4             	call   *%r12
+  8051e2:	84 c0                	test   %al,%al
+  8051e4:	74 ea                	je     8051d0 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  8051e6:	48 89 df             	mov    %rbx,%rdi
+  8051e9:	41 ff d6             	call   *%r14
+  8051ec:	a8 40                	test   $0x40,%al
+  8051ee:	74 e0                	je     8051d0 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8051f0:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8051f7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8051fb:	48 89 df             	mov    %rbx,%rdi
+  8051fe:	41 ff d7             	call   *%r15
+        if (err)
+  805201:	85 c0                	test   %eax,%eax
+  805203:	74 cb                	je     8051d0 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  805205:	48 83 c4 18          	add    $0x18,%rsp
+  805209:	5b                   	pop    %rbx
+  80520a:	41 5c                	pop    %r12
+  80520c:	41 5d                	pop    %r13
+  80520e:	41 5e                	pop    %r14
+  805210:	41 5f                	pop    %r15
+  805212:	5d                   	pop    %rbp
+  805213:	c3                   	ret
+    return 0;
+  805214:	b8 00 00 00 00       	mov    $0x0,%eax
+  805219:	eb ea                	jmp    805205 <foreach_shared_region+0x72>
+
+000000000080521b <_generic_signal_handler>:
+        (es->sa.sa_handler)(es->signo);
+    }
+}
+
+void
+_generic_signal_handler(struct UTrapframe *utf, struct EnqueuedSignal * es) {
+  80521b:	55                   	push   %rbp
+  80521c:	48 89 e5             	mov    %rsp,%rbp
+  80521f:	41 55                	push   %r13
+  805221:	41 54                	push   %r12
+  805223:	53                   	push   %rbx
+  805224:	48 83 ec 08          	sub    $0x8,%rsp
+  805228:	49 89 fc             	mov    %rdi,%r12
+  80522b:	48 89 f3             	mov    %rsi,%rbx
+    if (trace_signals)
+        cprintf("signals: env %x: begin generic handler for %d\n", sys_getenvid(), es->signo);
+  80522e:	44 8b 2e             	mov    (%rsi),%r13d
+  805231:	48 b8 0f 36 80 00 00 	movabs $0x80360f,%rax
+  805238:	00 00 00 
+  80523b:	ff d0                	call   *%rax
+  80523d:	89 c6                	mov    %eax,%esi
+  80523f:	44 89 ea             	mov    %r13d,%edx
+  805242:	48 bf 40 63 80 00 00 	movabs $0x806340,%rdi
+  805249:	00 00 00 
+  80524c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805251:	48 b9 fa 27 80 00 00 	movabs $0x8027fa,%rcx
+  805258:	00 00 00 
+  80525b:	ff d1                	call   *%rcx
+    if (es->sa.sa_handler == SIG_DFL) {
+  80525d:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  805261:	48 85 c0             	test   %rax,%rax
+  805264:	74 57                	je     8052bd <_generic_signal_handler+0xa2>
+    if (es->sa.sa_handler == SIG_IGN) {
+  805266:	48 83 f8 01          	cmp    $0x1,%rax
+  80526a:	0f 84 c0 00 00 00    	je     805330 <_generic_signal_handler+0x115>
+    if (es->sa.sa_flags & SA_SIGINFO) {
+  805270:	f6 43 14 04          	testb  $0x4,0x14(%rbx)
+  805274:	0f 84 ea 00 00 00    	je     805364 <_generic_signal_handler+0x149>
+        (es->sa.sa_sigaction)(es->signo, &(es->info), utf);
+  80527a:	48 8d 73 18          	lea    0x18(%rbx),%rsi
+  80527e:	8b 3b                	mov    (%rbx),%edi
+  805280:	4c 89 e2             	mov    %r12,%rdx
+  805283:	ff d0                	call   *%rax
+
+    _generic_signal_handler_impl(utf, es);
+
+    if (trace_signals)
+        cprintf("signals: env %x: end generic handler for %d\n", sys_getenvid(), es->signo);
+  805285:	8b 1b                	mov    (%rbx),%ebx
+  805287:	48 b8 0f 36 80 00 00 	movabs $0x80360f,%rax
+  80528e:	00 00 00 
+  805291:	ff d0                	call   *%rax
+  805293:	89 c6                	mov    %eax,%esi
+  805295:	89 da                	mov    %ebx,%edx
+  805297:	48 bf c8 63 80 00 00 	movabs $0x8063c8,%rdi
+  80529e:	00 00 00 
+  8052a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052a6:	48 b9 fa 27 80 00 00 	movabs $0x8027fa,%rcx
+  8052ad:	00 00 00 
+  8052b0:	ff d1                	call   *%rcx
+}
+  8052b2:	48 83 c4 08          	add    $0x8,%rsp
+  8052b6:	5b                   	pop    %rbx
+  8052b7:	41 5c                	pop    %r12
+  8052b9:	41 5d                	pop    %r13
+  8052bb:	5d                   	pop    %rbp
+  8052bc:	c3                   	ret
+            cprintf("signals: env %x: exiting due to signal %d\n", sys_getenvid(), es->signo);
+  8052bd:	8b 1b                	mov    (%rbx),%ebx
+  8052bf:	48 b8 0f 36 80 00 00 	movabs $0x80360f,%rax
+  8052c6:	00 00 00 
+  8052c9:	ff d0                	call   *%rax
+  8052cb:	89 c6                	mov    %eax,%esi
+  8052cd:	89 da                	mov    %ebx,%edx
+  8052cf:	48 bf 70 63 80 00 00 	movabs $0x806370,%rdi
+  8052d6:	00 00 00 
+  8052d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052de:	48 b9 fa 27 80 00 00 	movabs $0x8027fa,%rcx
+  8052e5:	00 00 00 
+  8052e8:	ff d1                	call   *%rcx
+        sys_env_destroy(CURENVID);
+  8052ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052ef:	48 b8 a4 35 80 00 00 	movabs $0x8035a4,%rax
+  8052f6:	00 00 00 
+  8052f9:	ff d0                	call   *%rax
+        assert(false);
+  8052fb:	48 b9 f5 63 80 00 00 	movabs $0x8063f5,%rcx
+  805302:	00 00 00 
+  805305:	48 ba 65 56 80 00 00 	movabs $0x805665,%rdx
+  80530c:	00 00 00 
+  80530f:	be 0c 00 00 00       	mov    $0xc,%esi
+  805314:	48 bf fb 63 80 00 00 	movabs $0x8063fb,%rdi
+  80531b:	00 00 00 
+  80531e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805323:	49 b8 aa 26 80 00 00 	movabs $0x8026aa,%r8
+  80532a:	00 00 00 
+  80532d:	41 ff d0             	call   *%r8
+            cprintf("signals: env %x: ignoring signal %d\n", sys_getenvid(), es->signo);
+  805330:	44 8b 23             	mov    (%rbx),%r12d
+  805333:	48 b8 0f 36 80 00 00 	movabs $0x80360f,%rax
+  80533a:	00 00 00 
+  80533d:	ff d0                	call   *%rax
+  80533f:	89 c6                	mov    %eax,%esi
+  805341:	44 89 e2             	mov    %r12d,%edx
+  805344:	48 bf a0 63 80 00 00 	movabs $0x8063a0,%rdi
+  80534b:	00 00 00 
+  80534e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805353:	48 b9 fa 27 80 00 00 	movabs $0x8027fa,%rcx
+  80535a:	00 00 00 
+  80535d:	ff d1                	call   *%rcx
+        return;
+  80535f:	e9 21 ff ff ff       	jmp    805285 <_generic_signal_handler+0x6a>
+        (es->sa.sa_handler)(es->signo);
+  805364:	8b 3b                	mov    (%rbx),%edi
+  805366:	ff d0                	call   *%rax
+  805368:	e9 18 ff ff ff       	jmp    805285 <_generic_signal_handler+0x6a>
+
+000000000080536d <sigqueue>:
+
+int sigqueue(pid_t pid, int signo, const union sigval value) {
+  80536d:	55                   	push   %rbp
+  80536e:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigqueue(pid, signo, value);
+  805371:	48 b8 d3 3a 80 00 00 	movabs $0x803ad3,%rax
+  805378:	00 00 00 
+  80537b:	ff d0                	call   *%rax
+}
+  80537d:	5d                   	pop    %rbp
+  80537e:	c3                   	ret
+
+000000000080537f <sigwait>:
+
+int sigwait(const sigset_t * set, int * sig) {
+  80537f:	55                   	push   %rbp
+  805380:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigwait(set, sig);
+  805383:	48 b8 3a 3b 80 00 00 	movabs $0x803b3a,%rax
+  80538a:	00 00 00 
+  80538d:	ff d0                	call   *%rax
+}
+  80538f:	5d                   	pop    %rbp
+  805390:	c3                   	ret
+
+0000000000805391 <sigaction>:
+
+extern void _signal_handler_trampoline(void);
+
+int sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  805391:	55                   	push   %rbp
+  805392:	48 89 e5             	mov    %rsp,%rbp
+  805395:	41 55                	push   %r13
+  805397:	41 54                	push   %r12
+  805399:	53                   	push   %rbx
+  80539a:	48 83 ec 08          	sub    $0x8,%rsp
+  80539e:	89 fb                	mov    %edi,%ebx
+  8053a0:	49 89 f4             	mov    %rsi,%r12
+  8053a3:	49 89 d5             	mov    %rdx,%r13
+    int err = sys_env_set_pgfault_upcall(CURENVID, _signal_handler_trampoline);
+  8053a6:	48 be 33 3f 80 00 00 	movabs $0x803f33,%rsi
+  8053ad:	00 00 00 
+  8053b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053b5:	48 b8 a4 39 80 00 00 	movabs $0x8039a4,%rax
+  8053bc:	00 00 00 
+  8053bf:	ff d0                	call   *%rax
+    if (err)
+  8053c1:	85 c0                	test   %eax,%eax
+  8053c3:	74 0b                	je     8053d0 <sigaction+0x3f>
+        return err;
+    return sys_sigaction(sig, act, oact);
+}
+  8053c5:	48 83 c4 08          	add    $0x8,%rsp
+  8053c9:	5b                   	pop    %rbx
+  8053ca:	41 5c                	pop    %r12
+  8053cc:	41 5d                	pop    %r13
+  8053ce:	5d                   	pop    %rbp
+  8053cf:	c3                   	ret
+    return sys_sigaction(sig, act, oact);
+  8053d0:	4c 89 ea             	mov    %r13,%rdx
+  8053d3:	4c 89 e6             	mov    %r12,%rsi
+  8053d6:	89 df                	mov    %ebx,%edi
+  8053d8:	48 b8 a3 3b 80 00 00 	movabs $0x803ba3,%rax
+  8053df:	00 00 00 
+  8053e2:	ff d0                	call   *%rax
+  8053e4:	eb df                	jmp    8053c5 <sigaction+0x34>
+
+00000000008053e6 <sigprocmask>:
+
+int sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8053e6:	55                   	push   %rbp
+  8053e7:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigprocmask(how, set, oldset);
+  8053ea:	48 b8 0a 3c 80 00 00 	movabs $0x803c0a,%rax
+  8053f1:	00 00 00 
+  8053f4:	ff d0                	call   *%rax
+}
+  8053f6:	5d                   	pop    %rbp
+  8053f7:	c3                   	ret
+
+00000000008053f8 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8053f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053fd:	c3                   	ret
+
+00000000008053fe <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8053fe:	55                   	push   %rbp
+  8053ff:	48 89 e5             	mov    %rsp,%rbp
+  805402:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805405:	48 be 08 64 80 00 00 	movabs $0x806408,%rsi
+  80540c:	00 00 00 
+  80540f:	48 b8 1f 31 80 00 00 	movabs $0x80311f,%rax
+  805416:	00 00 00 
+  805419:	ff d0                	call   *%rax
+    return 0;
+}
+  80541b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805420:	5d                   	pop    %rbp
+  805421:	c3                   	ret
+
+0000000000805422 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805422:	55                   	push   %rbp
+  805423:	48 89 e5             	mov    %rsp,%rbp
+  805426:	41 57                	push   %r15
+  805428:	41 56                	push   %r14
+  80542a:	41 55                	push   %r13
+  80542c:	41 54                	push   %r12
+  80542e:	53                   	push   %rbx
+  80542f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  805436:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80543d:	48 85 d2             	test   %rdx,%rdx
+  805440:	74 7a                	je     8054bc <devcons_write+0x9a>
+  805442:	49 89 d6             	mov    %rdx,%r14
+  805445:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80544b:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805450:	49 bf 19 33 80 00 00 	movabs $0x803319,%r15
+  805457:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80545a:	4c 89 f3             	mov    %r14,%rbx
+  80545d:	48 29 f3             	sub    %rsi,%rbx
+  805460:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805465:	48 39 c3             	cmp    %rax,%rbx
+  805468:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80546c:	4c 63 eb             	movslq %ebx,%r13
+  80546f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805476:	48 01 c6             	add    %rax,%rsi
+  805479:	4c 89 ea             	mov    %r13,%rdx
+  80547c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805483:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805486:	4c 89 ee             	mov    %r13,%rsi
+  805489:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805490:	48 b8 46 35 80 00 00 	movabs $0x803546,%rax
+  805497:	00 00 00 
+  80549a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80549c:	41 01 dc             	add    %ebx,%r12d
+  80549f:	49 63 f4             	movslq %r12d,%rsi
+  8054a2:	4c 39 f6             	cmp    %r14,%rsi
+  8054a5:	72 b3                	jb     80545a <devcons_write+0x38>
+    return res;
+  8054a7:	49 63 c4             	movslq %r12d,%rax
+}
+  8054aa:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8054b1:	5b                   	pop    %rbx
+  8054b2:	41 5c                	pop    %r12
+  8054b4:	41 5d                	pop    %r13
+  8054b6:	41 5e                	pop    %r14
+  8054b8:	41 5f                	pop    %r15
+  8054ba:	5d                   	pop    %rbp
+  8054bb:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8054bc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8054c2:	eb e3                	jmp    8054a7 <devcons_write+0x85>
+
+00000000008054c4 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8054c4:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8054c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054cc:	48 85 c0             	test   %rax,%rax
+  8054cf:	74 55                	je     805526 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8054d1:	55                   	push   %rbp
+  8054d2:	48 89 e5             	mov    %rsp,%rbp
+  8054d5:	41 55                	push   %r13
+  8054d7:	41 54                	push   %r12
+  8054d9:	53                   	push   %rbx
+  8054da:	48 83 ec 08          	sub    $0x8,%rsp
+  8054de:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8054e1:	48 bb 73 35 80 00 00 	movabs $0x803573,%rbx
+  8054e8:	00 00 00 
+  8054eb:	49 bc 40 36 80 00 00 	movabs $0x803640,%r12
+  8054f2:	00 00 00 
+  8054f5:	eb 03                	jmp    8054fa <devcons_read+0x36>
+  8054f7:	41 ff d4             	call   *%r12
+  8054fa:	ff d3                	call   *%rbx
+  8054fc:	85 c0                	test   %eax,%eax
+  8054fe:	74 f7                	je     8054f7 <devcons_read+0x33>
+    if (c < 0) return c;
+  805500:	48 63 d0             	movslq %eax,%rdx
+  805503:	78 13                	js     805518 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805505:	ba 00 00 00 00       	mov    $0x0,%edx
+  80550a:	83 f8 04             	cmp    $0x4,%eax
+  80550d:	74 09                	je     805518 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80550f:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805513:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805518:	48 89 d0             	mov    %rdx,%rax
+  80551b:	48 83 c4 08          	add    $0x8,%rsp
+  80551f:	5b                   	pop    %rbx
+  805520:	41 5c                	pop    %r12
+  805522:	41 5d                	pop    %r13
+  805524:	5d                   	pop    %rbp
+  805525:	c3                   	ret
+  805526:	48 89 d0             	mov    %rdx,%rax
+  805529:	c3                   	ret
+
+000000000080552a <cputchar>:
+cputchar(int ch) {
+  80552a:	55                   	push   %rbp
+  80552b:	48 89 e5             	mov    %rsp,%rbp
+  80552e:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805532:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805536:	be 01 00 00 00       	mov    $0x1,%esi
+  80553b:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80553f:	48 b8 46 35 80 00 00 	movabs $0x803546,%rax
+  805546:	00 00 00 
+  805549:	ff d0                	call   *%rax
+}
+  80554b:	c9                   	leave
+  80554c:	c3                   	ret
+
+000000000080554d <getchar>:
+getchar(void) {
+  80554d:	55                   	push   %rbp
+  80554e:	48 89 e5             	mov    %rsp,%rbp
+  805551:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805555:	ba 01 00 00 00       	mov    $0x1,%edx
+  80555a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80555e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805563:	48 b8 e4 44 80 00 00 	movabs $0x8044e4,%rax
+  80556a:	00 00 00 
+  80556d:	ff d0                	call   *%rax
+  80556f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805571:	85 c0                	test   %eax,%eax
+  805573:	78 06                	js     80557b <getchar+0x2e>
+  805575:	74 08                	je     80557f <getchar+0x32>
+  805577:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80557b:	89 d0                	mov    %edx,%eax
+  80557d:	c9                   	leave
+  80557e:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80557f:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805584:	eb f5                	jmp    80557b <getchar+0x2e>
+
+0000000000805586 <iscons>:
+iscons(int fdnum) {
+  805586:	55                   	push   %rbp
+  805587:	48 89 e5             	mov    %rsp,%rbp
+  80558a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80558e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805592:	48 b8 01 42 80 00 00 	movabs $0x804201,%rax
+  805599:	00 00 00 
+  80559c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80559e:	85 c0                	test   %eax,%eax
+  8055a0:	78 18                	js     8055ba <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8055a2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8055a6:	48 b8 20 b1 80 00 00 	movabs $0x80b120,%rax
+  8055ad:	00 00 00 
+  8055b0:	8b 00                	mov    (%rax),%eax
+  8055b2:	39 02                	cmp    %eax,(%rdx)
+  8055b4:	0f 94 c0             	sete   %al
+  8055b7:	0f b6 c0             	movzbl %al,%eax
+}
+  8055ba:	c9                   	leave
+  8055bb:	c3                   	ret
+
+00000000008055bc <opencons>:
+opencons(void) {
+  8055bc:	55                   	push   %rbp
+  8055bd:	48 89 e5             	mov    %rsp,%rbp
+  8055c0:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8055c4:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8055c8:	48 b8 a1 41 80 00 00 	movabs $0x8041a1,%rax
+  8055cf:	00 00 00 
+  8055d2:	ff d0                	call   *%rax
+  8055d4:	85 c0                	test   %eax,%eax
+  8055d6:	78 49                	js     805621 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8055d8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8055dd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8055e2:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8055e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055eb:	48 b8 cf 36 80 00 00 	movabs $0x8036cf,%rax
+  8055f2:	00 00 00 
+  8055f5:	ff d0                	call   *%rax
+  8055f7:	85 c0                	test   %eax,%eax
+  8055f9:	78 26                	js     805621 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8055fb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8055ff:	a1 20 b1 80 00 00 00 	movabs 0x80b120,%eax
+  805606:	00 00 
+  805608:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80560a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80560e:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805615:	48 b8 73 41 80 00 00 	movabs $0x804173,%rax
+  80561c:	00 00 00 
+  80561f:	ff d0                	call   *%rax
+}
+  805621:	c9                   	leave
+  805622:	c3                   	ret
+  805623:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000805628 <__rodata_start>:
+  805628:	44                   	rex.R
+  805629:	65 76 69             	gs jbe 805695 <__rodata_start+0x6d>
+  80562c:	63 65 20             	movsxd 0x20(%rbp),%esp
+  80562f:	31 20                	xor    %esp,(%rax)
+  805631:	70 72                	jo     8056a5 <__rodata_start+0x7d>
+  805633:	65 73 65             	gs jae 80569b <__rodata_start+0x73>
+  805636:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805637:	63 65 3a             	movsxd 0x3a(%rbp),%esp
+  80563a:	20 25 64 0a 00 62    	and    %ah,0x62000a64(%rip)        # 628060a4 <__bss_end+0x61ff70a4>
+  805640:	61                   	(bad)
+  805641:	64 20 64 69 73       	and    %ah,%fs:0x73(%rcx,%rbp,2)
+  805646:	6b 20 6e             	imul   $0x6e,(%rax),%esp
+  805649:	75 6d                	jne    8056b8 <__rodata_start+0x90>
+  80564b:	62 65                	(bad)
+  80564d:	72 00                	jb     80564f <__rodata_start+0x27>
+  80564f:	66 73 2f             	data16 jae 805681 <__rodata_start+0x59>
+  805652:	69 64 65 2e 63 00 6e 	imul   $0x736e0063,0x2e(%rbp,%riz,2),%esp
+  805659:	73 
+  80565a:	65 63 73 20          	movsxd %gs:0x20(%rbx),%esi
+  80565e:	3c 3d                	cmp    $0x3d,%al
+  805660:	20 32                	and    %dh,(%rdx)
+  805662:	35 36 00 61 73       	xor    $0x73610036,%eax
+  805667:	73 65                	jae    8056ce <__rodata_start+0xa6>
+  805669:	72 74                	jb     8056df <__rodata_start+0xb7>
+  80566b:	69 6f 6e 20 66 61 69 	imul   $0x69616620,0x6e(%rdi),%ebp
+  805672:	6c                   	insb   (%dx),%es:(%rdi)
+  805673:	65 64 3a 20          	gs cmp %fs:(%rax),%ah
+  805677:	25 73 00 66 0f       	and    $0xf660073,%eax
+  80567c:	1f                   	(bad)
+  80567d:	44 00 00             	add    %r8b,(%rax)
+  805680:	72 65                	jb     8056e7 <__rodata_start+0xbf>
+  805682:	61                   	(bad)
+  805683:	64 69 6e 67 20 6e 6f 	imul   $0x6e6f6e20,%fs:0x67(%rsi),%ebp
+  80568a:	6e 
+  80568b:	2d 65 78 69 73       	sub    $0x73697865,%eax
+  805690:	74 65                	je     8056f7 <__rodata_start+0xcf>
+  805692:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805693:	74 20                	je     8056b5 <__rodata_start+0x8d>
+  805695:	62                   	(bad)
+  805696:	6c                   	insb   (%dx),%es:(%rdi)
+  805697:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805698:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80569b:	25 30 38 78 20       	and    $0x20783830,%eax
+  8056a0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8056a1:	75 74                	jne    805717 <__rodata_start+0xef>
+  8056a3:	20 6f 66             	and    %ch,0x66(%rdi)
+  8056a6:	20 25 30 38 78 0a    	and    %ah,0xa783830(%rip)        # af88edc <__bss_end+0xa779edc>
+  8056ac:	00 00                	add    %al,(%rax)
+  8056ae:	00 00                	add    %al,(%rax)
+  8056b0:	62 61 64 20 62       	(bad)
+  8056b5:	6c                   	insb   (%dx),%es:(%rdi)
+  8056b6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8056b7:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8056ba:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8056bb:	75 6d                	jne    80572a <__rodata_start+0x102>
+  8056bd:	62 65                	(bad)
+  8056bf:	72 20                	jb     8056e1 <__rodata_start+0xb9>
+  8056c1:	25 30 38 78 20       	and    $0x20783830,%eax
+  8056c6:	69 6e 20 64 69 73 6b 	imul   $0x6b736964,0x20(%rsi),%ebp
+  8056cd:	61                   	(bad)
+  8056ce:	64 64 72 00          	fs fs jb 8056d2 <__rodata_start+0xaa>
+  8056d2:	00 00                	add    %al,(%rax)
+  8056d4:	00 00                	add    %al,(%rax)
+  8056d6:	00 00                	add    %al,(%rax)
+  8056d8:	73 74                	jae    80574e <__rodata_start+0x126>
+  8056da:	72 63                	jb     80573f <__rodata_start+0x117>
+  8056dc:	6d                   	insl   (%dx),%es:(%rdi)
+  8056dd:	70 28                	jo     805707 <__rodata_start+0xdf>
+  8056df:	64 69 73 6b 61 64 64 	imul   $0x72646461,%fs:0x6b(%rbx),%esi
+  8056e6:	72 
+  8056e7:	28 31                	sub    %dh,(%rcx)
+  8056e9:	29 2c 20             	sub    %ebp,(%rax,%riz,1)
+  8056ec:	22 4f 4f             	and    0x4f(%rdi),%cl
+  8056ef:	50                   	push   %rax
+  8056f0:	53                   	push   %rbx
+  8056f1:	21 5c 6e 22          	and    %ebx,0x22(%rsi,%rbp,2)
+  8056f5:	29 20                	sub    %esp,(%rax)
+  8056f7:	3d 3d 20 30 00       	cmp    $0x30203d,%eax
+  8056fc:	66 73 2f             	data16 jae 80572e <__rodata_start+0x106>
+  8056ff:	62 63 2e 63 00       	(bad)
+  805704:	62 63 5f 70 67       	(bad)
+  805709:	66 61                	data16 (bad)
+  80570b:	75 6c                	jne    805779 <__rodata_start+0x151>
+  80570d:	74 3a                	je     805749 <__rodata_start+0x121>
+  80570f:	20 66 61             	and    %ah,0x61(%rsi)
+  805712:	69 6c 65 64 20 74 6f 	imul   $0x206f7420,0x64(%rbp,%riz,2),%ebp
+  805719:	20 
+  80571a:	61                   	(bad)
+  80571b:	6c                   	insb   (%dx),%es:(%rdi)
+  80571c:	6c                   	insb   (%dx),%es:(%rdi)
+  80571d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80571e:	63 00                	movsxd (%rax),%eax
+  805720:	62 63 5f 70 67       	(bad)
+  805725:	66 61                	data16 (bad)
+  805727:	75 6c                	jne    805795 <__rodata_start+0x16d>
+  805729:	74 3a                	je     805765 <__rodata_start+0x13d>
+  80572b:	20 66 61             	and    %ah,0x61(%rsi)
+  80572e:	69 6c 65 64 20 74 6f 	imul   $0x206f7420,0x64(%rbp,%riz,2),%ebp
+  805735:	20 
+  805736:	72 65                	jb     80579d <__rodata_start+0x175>
+  805738:	61                   	(bad)
+  805739:	64 00 66 6c          	add    %ah,%fs:0x6c(%rsi)
+  80573d:	75 73                	jne    8057b2 <__rodata_start+0x18a>
+  80573f:	68 5f 62 6c 6f       	push   $0x6f6c625f
+  805744:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805747:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805748:	66 20 62 61          	data16 and %ah,0x61(%rdx)
+  80574c:	64 20 76 61          	and    %dh,%fs:0x61(%rsi)
+  805750:	20 25 70 00 66 6c    	and    %ah,0x6c660070(%rip)        # 6ce657c6 <__bss_end+0x6c6567c6>
+  805756:	75 73                	jne    8057cb <__rodata_start+0x1a3>
+  805758:	68 5f 62 6c 6f       	push   $0x6f6c625f
+  80575d:	63 6b 3a             	movsxd 0x3a(%rbx),%ebp
+  805760:	20 66 61             	and    %ah,0x61(%rsi)
+  805763:	69 6c 65 64 20 74 6f 	imul   $0x206f7420,0x64(%rbp,%riz,2),%ebp
+  80576a:	20 
+  80576b:	77 72                	ja     8057df <__rodata_start+0x1b7>
+  80576d:	69 74 65 00 66 6c 75 	imul   $0x73756c66,0x0(%rbp,%riz,2),%esi
+  805774:	73 
+  805775:	68 5f 62 6c 6f       	push   $0x6f6c625f
+  80577a:	63 6b 3a             	movsxd 0x3a(%rbx),%ebp
+  80577d:	20 66 61             	and    %ah,0x61(%rsi)
+  805780:	69 6c 65 64 20 74 6f 	imul   $0x206f7420,0x64(%rbp,%riz,2),%ebp
+  805787:	20 
+  805788:	6d                   	insl   (%dx),%es:(%rdi)
+  805789:	61                   	(bad)
+  80578a:	70 00                	jo     80578c <__rodata_start+0x164>
+  80578c:	21 69 73             	and    %ebp,0x73(%rcx)
+  80578f:	5f                   	pop    %rdi
+  805790:	70 61                	jo     8057f3 <__rodata_start+0x1cb>
+  805792:	67 65 5f             	addr32 gs pop %rdi
+  805795:	64 69 72 74 79 28 61 	imul   $0x64612879,%fs:0x74(%rdx),%esi
+  80579c:	64 
+  80579d:	64 72 29             	fs jb  8057c9 <__rodata_start+0x1a1>
+  8057a0:	00 4f 4f             	add    %cl,0x4f(%rdi)
+  8057a3:	50                   	push   %rax
+  8057a4:	53                   	push   %rbx
+  8057a5:	21 0a                	and    %ecx,(%rdx)
+  8057a7:	00 21                	add    %ah,(%rcx)
+  8057a9:	69 73 5f 70 61 67 65 	imul   $0x65676170,0x5f(%rbx),%esi
+  8057b0:	5f                   	pop    %rdi
+  8057b1:	64 69 72 74 79 28 64 	imul   $0x69642879,%fs:0x74(%rdx),%esi
+  8057b8:	69 
+  8057b9:	73 6b                	jae    805826 <__rodata_start+0x1fe>
+  8057bb:	61                   	(bad)
+  8057bc:	64 64 72 28          	fs fs jb 8057e8 <__rodata_start+0x1c0>
+  8057c0:	31 29                	xor    %ebp,(%rcx)
+  8057c2:	29 00                	sub    %eax,(%rax)
+  8057c4:	21 69 73             	and    %ebp,0x73(%rcx)
+  8057c7:	5f                   	pop    %rdi
+  8057c8:	70 61                	jo     80582b <__rodata_start+0x203>
+  8057ca:	67 65 5f             	addr32 gs pop %rdi
+  8057cd:	70 72                	jo     805841 <__rodata_start+0x219>
+  8057cf:	65 73 65             	gs jae 805837 <__rodata_start+0x20f>
+  8057d2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8057d3:	74 28                	je     8057fd <__rodata_start+0x1d5>
+  8057d5:	64 69 73 6b 61 64 64 	imul   $0x72646461,%fs:0x6b(%rbx),%esi
+  8057dc:	72 
+  8057dd:	28 31                	sub    %dh,(%rcx)
+  8057df:	29 29                	sub    %ebp,(%rcx)
+  8057e1:	00 62 6c             	add    %ah,0x6c(%rdx)
+  8057e4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8057e5:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8057e8:	63 61 63             	movsxd 0x63(%rcx),%esp
+  8057eb:	68 65 20 69 73       	push   $0x73692065
+  8057f0:	20 67 6f             	and    %ah,0x6f(%rdi)
+  8057f3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8057f4:	64 0a 00             	or     %fs:(%rax),%al
+  8057f7:	90                   	nop
+  8057f8:	62 61 64 20 66       	(bad)
+  8057fd:	69 6c 65 20 73 79 73 	imul   $0x74737973,0x20(%rbp,%riz,2),%ebp
+  805804:	74 
+  805805:	65 6d                	gs insl (%dx),%es:(%rdi)
+  805807:	20 6d 61             	and    %ch,0x61(%rbp)
+  80580a:	67 69 63 20 6e 75 6d 	imul   $0x626d756e,0x20(%ebx),%esp
+  805811:	62 
+  805812:	65 72 20             	gs jb  805835 <__rodata_start+0x20d>
+  805815:	25 30 38 78 00       	and    $0x783830,%eax
+  80581a:	66 73 2f             	data16 jae 80584c <__rodata_start+0x224>
+  80581d:	66 73 2e             	data16 jae 80584e <__rodata_start+0x226>
+  805820:	63 00                	movsxd (%rax),%eax
+  805822:	66 69 6c 65 20 73 79 	imul   $0x7973,0x20(%rbp,%riz,2),%bp
+  805829:	73 74                	jae    80589f <__rodata_start+0x277>
+  80582b:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80582d:	20 69 73             	and    %ch,0x73(%rcx)
+  805830:	20 74 6f 6f          	and    %dh,0x6f(%rdi,%rbp,2)
+  805834:	20 6c 61 72          	and    %ch,0x72(%rcx,%riz,2)
+  805838:	67 65 00 73 75       	add    %dh,%gs:0x75(%ebx)
+  80583d:	70 65                	jo     8058a4 <__rodata_start+0x27c>
+  80583f:	72 62                	jb     8058a3 <__rodata_start+0x27b>
+  805841:	6c                   	insb   (%dx),%es:(%rdi)
+  805842:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805843:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805846:	69 73 20 67 6f 6f 64 	imul   $0x646f6f67,0x20(%rbx),%esi
+  80584d:	0a 00                	or     (%rax),%al
+  80584f:	61                   	(bad)
+  805850:	74 74                	je     8058c6 <__rodata_start+0x29e>
+  805852:	65 6d                	gs insl (%dx),%es:(%rdi)
+  805854:	70 74                	jo     8058ca <__rodata_start+0x2a2>
+  805856:	20 74 6f 20          	and    %dh,0x20(%rdi,%rbp,2)
+  80585a:	66 72 65             	data16 jb 8058c2 <__rodata_start+0x29a>
+  80585d:	65 20 7a 65          	and    %bh,%gs:0x65(%rdx)
+  805861:	72 6f                	jb     8058d2 <__rodata_start+0x2aa>
+  805863:	20 62 6c             	and    %ah,0x6c(%rdx)
+  805866:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805867:	63 6b 00             	movsxd 0x0(%rbx),%ebp
+  80586a:	21 62 6c             	and    %esp,0x6c(%rdx)
+  80586d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80586e:	63 6b 5f             	movsxd 0x5f(%rbx),%ebp
+  805871:	69 73 5f 66 72 65 65 	imul   $0x65657266,0x5f(%rbx),%esi
+  805878:	28 32                	sub    %dh,(%rdx)
+  80587a:	20 2b                	and    %ch,(%rbx)
+  80587c:	20 69 29             	and    %ch,0x29(%rcx)
+  80587f:	00 21                	add    %ah,(%rcx)
+  805881:	62                   	(bad)
+  805882:	6c                   	insb   (%dx),%es:(%rdi)
+  805883:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805884:	63 6b 5f             	movsxd 0x5f(%rbx),%ebp
+  805887:	69 73 5f 66 72 65 65 	imul   $0x65657266,0x5f(%rbx),%esi
+  80588e:	28 31                	sub    %dh,(%rcx)
+  805890:	29 00                	sub    %eax,(%rax)
+  805892:	21 62 6c             	and    %esp,0x6c(%rdx)
+  805895:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805896:	63 6b 5f             	movsxd 0x5f(%rbx),%ebp
+  805899:	69 73 5f 66 72 65 65 	imul   $0x65657266,0x5f(%rbx),%esi
+  8058a0:	28 30                	sub    %dh,(%rax)
+  8058a2:	29 00                	sub    %eax,(%rax)
+  8058a4:	62                   	(bad)
+  8058a5:	69 74 6d 61 70 20 69 	imul   $0x73692070,0x61(%rbp,%rbp,2),%esi
+  8058ac:	73 
+  8058ad:	20 67 6f             	and    %ah,0x6f(%rdi)
+  8058b0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058b1:	64 0a 00             	or     %fs:(%rax),%al
+  8058b4:	28 64 69 72          	sub    %ah,0x72(%rcx,%rbp,2)
+  8058b8:	2d 3e 66 5f 73       	sub    $0x735f663e,%eax
+  8058bd:	69 7a 65 20 25 20 42 	imul   $0x42202520,0x65(%rdx),%edi
+  8058c4:	4c                   	rex.WR
+  8058c5:	4b 53                	rex.WXB push %r11
+  8058c7:	49 5a                	rex.WB pop %r10
+  8058c9:	45 29 20             	sub    %r12d,(%r8)
+  8058cc:	3d 3d 20 30 00       	cmp    $0x30203d,%eax
+  8058d1:	77 61                	ja     805934 <__rodata_start+0x30c>
+  8058d3:	72 6e                	jb     805943 <__rodata_start+0x31b>
+  8058d5:	69 6e 67 3a 20 66 69 	imul   $0x6966203a,0x67(%rsi),%ebp
+  8058dc:	6c                   	insb   (%dx),%es:(%rdi)
+  8058dd:	65 5f                	gs pop %rdi
+  8058df:	66 72 65             	data16 jb 805947 <__rodata_start+0x31f>
+  8058e2:	65 5f                	gs pop %rdi
+  8058e4:	62                   	(bad)
+  8058e5:	6c                   	insb   (%dx),%es:(%rdi)
+  8058e6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058e7:	63 6b 3a             	movsxd 0x3a(%rbx),%ebp
+  8058ea:	20 25 69 00 66 90    	and    %ah,-0x6f99ff97(%rip)        # ffffffff90e65959 <uvpml4+0xfffffeff10a63959>
+  8058f0:	49 6e                	rex.WB outsb %ds:(%rsi),(%dx)
+  8058f2:	76 61                	jbe    805955 <__rodata_start+0x32d>
+  8058f4:	6c                   	insb   (%dx),%es:(%rdi)
+  8058f5:	69 64 20 72 65 71 75 	imul   $0x65757165,0x72(%rax,%riz,1),%esp
+  8058fc:	65 
+  8058fd:	73 74                	jae    805973 <__rodata_start+0x34b>
+  8058ff:	20 66 72             	and    %ah,0x72(%rsi)
+  805902:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805903:	6d                   	insl   (%dx),%es:(%rdi)
+  805904:	20 25 30 38 78 3a    	and    %ah,0x3a783830(%rip)        # 3af8913a <__bss_end+0x3a77a13a>
+  80590a:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80590d:	20 61 72             	and    %ah,0x72(%rcx)
+  805910:	67 75 6d             	addr32 jne 805980 <__rodata_start+0x358>
+  805913:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805915:	74 20                	je     805937 <__rodata_start+0x30f>
+  805917:	70 61                	jo     80597a <__rodata_start+0x352>
+  805919:	67 65 0a 00          	or     %gs:(%eax),%al
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 49 6e             	add    %cl,0x6e(%rcx)
+  805922:	76 61                	jbe    805985 <__rodata_start+0x35d>
+  805924:	6c                   	insb   (%dx),%es:(%rdi)
+  805925:	69 64 20 72 65 71 75 	imul   $0x65757165,0x72(%rax,%riz,1),%esp
+  80592c:	65 
+  80592d:	73 74                	jae    8059a3 <__rodata_start+0x37b>
+  80592f:	20 63 6f             	and    %ah,0x6f(%rbx)
+  805932:	64 65 20 25 64 20 66 	fs and %ah,%gs:0x72662064(%rip)        # 72e6799e <__bss_end+0x7265899e>
+  805939:	72 
+  80593a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80593b:	6d                   	insl   (%dx),%es:(%rdi)
+  80593c:	20 25 30 38 78 0a    	and    %ah,0xa783830(%rip)        # af89172 <__bss_end+0xa77a172>
+  805942:	00 66 73             	add    %ah,0x73(%rsi)
+  805945:	00 46 53             	add    %al,0x53(%rsi)
+  805948:	20 69 73             	and    %ch,0x73(%rcx)
+  80594b:	20 72 75             	and    %dh,0x75(%rdx)
+  80594e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80594f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805950:	69 6e 67 0a 00 46 53 	imul   $0x5346000a,0x67(%rsi),%ebp
+  805957:	20 63 61             	and    %ah,0x61(%rbx)
+  80595a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80595b:	20 64 6f 20          	and    %ah,0x20(%rdi,%rbp,2)
+  80595f:	49 2f                	rex.WB (bad)
+  805961:	4f 0a 00             	rex.WRXB or (%r8),%r8b
+  805964:	00 00                	add    %al,(%rax)
+  805966:	63 68 65             	movsxd 0x65(%rax),%ebp
+  805969:	63 6b 69             	movsxd 0x69(%rbx),%ebp
+  80596c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80596d:	67 20 63 6f          	and    %ah,0x6f(%ebx)
+  805971:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805972:	73 69                	jae    8059dd <__rodata_start+0x3b5>
+  805974:	73 74                	jae    8059ea <__rodata_start+0x3c2>
+  805976:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805978:	63 79 20             	movsxd 0x20(%rcx),%edi
+  80597b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80597c:	66 20 25 73 0a 00 21 	data16 and %ah,0x21000a73(%rip)        # 218063f6 <__bss_end+0x20ff73f6>
+  805983:	62                   	(bad)
+  805984:	6c                   	insb   (%dx),%es:(%rdi)
+  805985:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805986:	63 6b 5f             	movsxd 0x5f(%rbx),%ebp
+  805989:	69 73 5f 66 72 65 65 	imul   $0x65657266,0x5f(%rbx),%esi
+  805990:	28 2a                	sub    %ch,(%rdx)
+  805992:	70 64                	jo     8059f8 <__rodata_start+0x3d0>
+  805994:	69 73 6b 62 6e 6f 29 	imul   $0x296f6e62,0x6b(%rbx),%esi
+  80599b:	00 66 73             	add    %ah,0x73(%rsi)
+  80599e:	2f                   	(bad)
+  80599f:	74 65                	je     805a06 <__rodata_start+0x3de>
+  8059a1:	73 74                	jae    805a17 <__rodata_start+0x3ef>
+  8059a3:	2e 63 00             	cs movsxd (%rax),%eax
+  8059a6:	73 79                	jae    805a21 <__rodata_start+0x3f9>
+  8059a8:	73 5f                	jae    805a09 <__rodata_start+0x3e1>
+  8059aa:	70 61                	jo     805a0d <__rodata_start+0x3e5>
+  8059ac:	67 65 5f             	addr32 gs pop %rdi
+  8059af:	61                   	(bad)
+  8059b0:	6c                   	insb   (%dx),%es:(%rdi)
+  8059b1:	6c                   	insb   (%dx),%es:(%rdi)
+  8059b2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8059b3:	63 3a                	movsxd (%rdx),%edi
+  8059b5:	20 25 69 00 61 6c    	and    %ah,0x6c610069(%rip)        # 6ce15a24 <__bss_end+0x6c606a24>
+  8059bb:	6c                   	insb   (%dx),%es:(%rdi)
+  8059bc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8059bd:	63 5f 62             	movsxd 0x62(%rdi),%ebx
+  8059c0:	6c                   	insb   (%dx),%es:(%rdi)
+  8059c1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8059c2:	63 6b 3a             	movsxd 0x3a(%rbx),%ebp
+  8059c5:	20 25 69 00 54 53    	and    %ah,0x53540069(%rip)        # 53d45a34 <__bss_end+0x53536a34>
+  8059cb:	54                   	push   %rsp
+  8059cc:	42                   	rex.X
+  8059cd:	49 54                	rex.WB push %r12
+  8059cf:	28 62 69             	sub    %ah,0x69(%rdx)
+  8059d2:	74 73                	je     805a47 <__rodata_start+0x41f>
+  8059d4:	2c 20                	sub    $0x20,%al
+  8059d6:	72 29                	jb     805a01 <__rodata_start+0x3d9>
+  8059d8:	00 21                	add    %ah,(%rcx)
+  8059da:	54                   	push   %rsp
+  8059db:	53                   	push   %rbx
+  8059dc:	54                   	push   %rsp
+  8059dd:	42                   	rex.X
+  8059de:	49 54                	rex.WB push %r12
+  8059e0:	28 62 69             	sub    %ah,0x69(%rdx)
+  8059e3:	74 6d                	je     805a52 <__rodata_start+0x42a>
+  8059e5:	61                   	(bad)
+  8059e6:	70 2c                	jo     805a14 <__rodata_start+0x3ec>
+  8059e8:	20 72 29             	and    %dh,0x29(%rdx)
+  8059eb:	00 61 6c             	add    %ah,0x6c(%rcx)
+  8059ee:	6c                   	insb   (%dx),%es:(%rdi)
+  8059ef:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8059f0:	63 5f 62             	movsxd 0x62(%rdi),%ebx
+  8059f3:	6c                   	insb   (%dx),%es:(%rdi)
+  8059f4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8059f5:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8059f8:	69 73 20 67 6f 6f 64 	imul   $0x646f6f67,0x20(%rbx),%esi
+  8059ff:	0a 00                	or     (%rax),%al
+  805a01:	66 73 20             	data16 jae 805a24 <__rodata_start+0x3fc>
+  805a04:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  805a07:	73 69                	jae    805a72 <__rodata_start+0x44a>
+  805a09:	73 74                	jae    805a7f <__rodata_start+0x457>
+  805a0b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805a0d:	63 79 20             	movsxd 0x20(%rcx),%edi
+  805a10:	69 73 20 67 6f 6f 64 	imul   $0x646f6f67,0x20(%rbx),%esi
+  805a17:	0a 00                	or     (%rax),%al
+  805a19:	2f                   	(bad)
+  805a1a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a1b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a1c:	74 2d                	je     805a4b <__rodata_start+0x423>
+  805a1e:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805a20:	75 6e                	jne    805a90 <__rodata_start+0x468>
+  805a22:	64 00 66 69          	add    %ah,%fs:0x69(%rsi)
+  805a26:	6c                   	insb   (%dx),%es:(%rdi)
+  805a27:	65 5f                	gs pop %rdi
+  805a29:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a2a:	70 65                	jo     805a91 <__rodata_start+0x469>
+  805a2c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a2d:	20 2f                	and    %ch,(%rdi)
+  805a2f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a30:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a31:	74 2d                	je     805a60 <__rodata_start+0x438>
+  805a33:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805a35:	75 6e                	jne    805aa5 <__rodata_start+0x47d>
+  805a37:	64 3a 20             	cmp    %fs:(%rax),%ah
+  805a3a:	25 69 00 2f 6e       	and    $0x6e2f0069,%eax
+  805a3f:	65 77 6d             	gs ja  805aaf <__rodata_start+0x487>
+  805a42:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a43:	74 64                	je     805aa9 <__rodata_start+0x481>
+  805a45:	00 66 69             	add    %ah,0x69(%rsi)
+  805a48:	6c                   	insb   (%dx),%es:(%rdi)
+  805a49:	65 5f                	gs pop %rdi
+  805a4b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a4c:	70 65                	jo     805ab3 <__rodata_start+0x48b>
+  805a4e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a4f:	20 2f                	and    %ch,(%rdi)
+  805a51:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a52:	65 77 6d             	gs ja  805ac2 <__rodata_start+0x49a>
+  805a55:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a56:	74 64                	je     805abc <__rodata_start+0x494>
+  805a58:	3a 20                	cmp    (%rax),%ah
+  805a5a:	25 69 00 66 69       	and    $0x69660069,%eax
+  805a5f:	6c                   	insb   (%dx),%es:(%rdi)
+  805a60:	65 5f                	gs pop %rdi
+  805a62:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a63:	70 65                	jo     805aca <__rodata_start+0x4a2>
+  805a65:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a66:	20 69 73             	and    %ch,0x73(%rcx)
+  805a69:	20 67 6f             	and    %ah,0x6f(%rdi)
+  805a6c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a6d:	64 0a 00             	or     %fs:(%rax),%al
+  805a70:	66 69 6c 65 5f 67 65 	imul   $0x6567,0x5f(%rbp,%riz,2),%bp
+  805a77:	74 5f                	je     805ad8 <__rodata_start+0x4b0>
+  805a79:	62                   	(bad)
+  805a7a:	6c                   	insb   (%dx),%es:(%rdi)
+  805a7b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a7c:	63 6b 3a             	movsxd 0x3a(%rbx),%ebp
+  805a7f:	20 25 69 00 66 69    	and    %ah,0x69660069(%rip)        # 69e65aee <__bss_end+0x69656aee>
+  805a85:	6c                   	insb   (%dx),%es:(%rdi)
+  805a86:	65 5f                	gs pop %rdi
+  805a88:	67 65 74 5f          	addr32 gs je 805aeb <__rodata_start+0x4c3>
+  805a8c:	62                   	(bad)
+  805a8d:	6c                   	insb   (%dx),%es:(%rdi)
+  805a8e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a8f:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805a92:	69 73 20 67 6f 6f 64 	imul   $0x646f6f67,0x20(%rbx),%esi
+  805a99:	0a 00                	or     (%rax),%al
+  805a9b:	21 69 73             	and    %ebp,0x73(%rcx)
+  805a9e:	5f                   	pop    %rdi
+  805a9f:	70 61                	jo     805b02 <__rodata_start+0x4da>
+  805aa1:	67 65 5f             	addr32 gs pop %rdi
+  805aa4:	64 69 72 74 79 28 62 	imul   $0x6c622879,%fs:0x74(%rdx),%esi
+  805aab:	6c 
+  805aac:	6b 29 00             	imul   $0x0,(%rcx),%ebp
+  805aaf:	66 69 6c 65 5f 66 6c 	imul   $0x6c66,0x5f(%rbp,%riz,2),%bp
+  805ab6:	75 73                	jne    805b2b <__rodata_start+0x503>
+  805ab8:	68 20 69 73 20       	push   $0x20736920
+  805abd:	67 6f                	outsl  %ds:(%esi),(%dx)
+  805abf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805ac0:	64 0a 00             	or     %fs:(%rax),%al
+  805ac3:	66 69 6c 65 5f 73 65 	imul   $0x6573,0x5f(%rbp,%riz,2),%bp
+  805aca:	74 5f                	je     805b2b <__rodata_start+0x503>
+  805acc:	73 69                	jae    805b37 <__rodata_start+0x50f>
+  805ace:	7a 65                	jp     805b35 <__rodata_start+0x50d>
+  805ad0:	3a 20                	cmp    (%rax),%ah
+  805ad2:	25 69 00 66 2d       	and    $0x2d660069,%eax
+  805ad7:	3e 66 5f             	ds pop %di
+  805ada:	64 69 72 65 63 74 5b 	imul   $0x305b7463,%fs:0x65(%rdx),%esi
+  805ae1:	30 
+  805ae2:	5d                   	pop    %rbp
+  805ae3:	20 3d 3d 20 30 00    	and    %bh,0x30203d(%rip)        # b07b26 <__bss_end+0x2f8b26>
+  805ae9:	21 69 73             	and    %ebp,0x73(%rcx)
+  805aec:	5f                   	pop    %rdi
+  805aed:	70 61                	jo     805b50 <__rodata_start+0x528>
+  805aef:	67 65 5f             	addr32 gs pop %rdi
+  805af2:	64 69 72 74 79 28 66 	imul   $0x29662879,%fs:0x74(%rdx),%esi
+  805af9:	29 
+  805afa:	00 66 69             	add    %ah,0x69(%rsi)
+  805afd:	6c                   	insb   (%dx),%es:(%rdi)
+  805afe:	65 5f                	gs pop %rdi
+  805b00:	74 72                	je     805b74 <__rodata_start+0x54c>
+  805b02:	75 6e                	jne    805b72 <__rodata_start+0x54a>
+  805b04:	63 61 74             	movsxd 0x74(%rcx),%esp
+  805b07:	65 20 69 73          	and    %ch,%gs:0x73(%rcx)
+  805b0b:	20 67 6f             	and    %ah,0x6f(%rdi)
+  805b0e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b0f:	64 0a 00             	or     %fs:(%rax),%al
+  805b12:	66 69 6c 65 5f 73 65 	imul   $0x6573,0x5f(%rbp,%riz,2),%bp
+  805b19:	74 5f                	je     805b7a <__rodata_start+0x552>
+  805b1b:	73 69                	jae    805b86 <__rodata_start+0x55e>
+  805b1d:	7a 65                	jp     805b84 <__rodata_start+0x55c>
+  805b1f:	20 32                	and    %dh,(%rdx)
+  805b21:	3a 20                	cmp    (%rax),%ah
+  805b23:	25 69 00 66 69       	and    $0x69660069,%eax
+  805b28:	6c                   	insb   (%dx),%es:(%rdi)
+  805b29:	65 5f                	gs pop %rdi
+  805b2b:	67 65 74 5f          	addr32 gs je 805b8e <__rodata_start+0x566>
+  805b2f:	62                   	(bad)
+  805b30:	6c                   	insb   (%dx),%es:(%rdi)
+  805b31:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b32:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805b35:	32 3a                	xor    (%rdx),%bh
+  805b37:	20 25 69 00 66 69    	and    %ah,0x69660069(%rip)        # 69e65ba6 <__bss_end+0x69656ba6>
+  805b3d:	6c                   	insb   (%dx),%es:(%rdi)
+  805b3e:	65 20 72 65          	and    %dh,%gs:0x65(%rdx)
+  805b42:	77 72                	ja     805bb6 <__rodata_start+0x58e>
+  805b44:	69 74 65 20 69 73 20 	imul   $0x67207369,0x20(%rbp,%riz,2),%esi
+  805b4b:	67 
+  805b4c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b4d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b4e:	64 0a 00             	or     %fs:(%rax),%al
+  805b51:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  805b58:	66 69 6c 65 5f 6f 70 	imul   $0x706f,0x5f(%rbp,%riz,2),%bp
+  805b5f:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805b61:	20 2f                	and    %ch,(%rdi)
+  805b63:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b64:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b65:	74 2d                	je     805b94 <__rodata_start+0x56c>
+  805b67:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805b69:	75 6e                	jne    805bd9 <__rodata_start+0x5b1>
+  805b6b:	64 20 73 75          	and    %dh,%fs:0x75(%rbx)
+  805b6f:	63 63 65             	movsxd 0x65(%rbx),%esp
+  805b72:	65 64 65 64 21 00    	gs fs gs and %eax,%fs:(%rax)
+  805b78:	54                   	push   %rsp
+  805b79:	68 69 73 20 69       	push   $0x69207369
+  805b7e:	73 20                	jae    805ba0 <__rodata_start+0x578>
+  805b80:	74 68                	je     805bea <__rodata_start+0x5c2>
+  805b82:	65 20 4e 45          	and    %cl,%gs:0x45(%rsi)
+  805b86:	57                   	push   %rdi
+  805b87:	20 6d 65             	and    %ch,0x65(%rbp)
+  805b8a:	73 73                	jae    805bff <__rodata_start+0x5d7>
+  805b8c:	61                   	(bad)
+  805b8d:	67 65 20 6f 66       	and    %ch,%gs:0x66(%edi)
+  805b92:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  805b96:	20 64 61 79          	and    %ah,0x79(%rcx,%riz,2)
+  805b9a:	21 0a                	and    %ecx,(%rdx)
+  805b9c:	0a 00                	or     (%rax),%al
+  805b9e:	00 00                	add    %al,(%rax)
+  805ba0:	66 69 6c 65 5f 67 65 	imul   $0x6567,0x5f(%rbp,%riz,2),%bp
+  805ba7:	74 5f                	je     805c08 <__rodata_start+0x5e0>
+  805ba9:	62                   	(bad)
+  805baa:	6c                   	insb   (%dx),%es:(%rdi)
+  805bab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805bac:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805baf:	72 65                	jb     805c16 <__rodata_start+0x5ee>
+  805bb1:	74 75                	je     805c28 <__rodata_start+0x600>
+  805bb3:	72 6e                	jb     805c23 <__rodata_start+0x5fb>
+  805bb5:	65 64 20 77 72       	gs and %dh,%fs:0x72(%rdi)
+  805bba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805bbb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805bbc:	67 20 64 61 74       	and    %ah,0x74(%ecx,%eiz,2)
+  805bc1:	61                   	(bad)
+  805bc2:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  805bc9:	77 6e                	ja     805c39 <__rodata_start+0x611>
+  805bcb:	3e 00 0f             	ds add %cl,(%rdi)
+  805bce:	1f                   	(bad)
+  805bcf:	00 5b 25             	add    %bl,0x25(%rbx)
+  805bd2:	30 38                	xor    %bh,(%rax)
+  805bd4:	78 5d                	js     805c33 <__rodata_start+0x60b>
+  805bd6:	20 75 73             	and    %dh,0x73(%rbp)
+  805bd9:	65 72 20             	gs jb  805bfc <__rodata_start+0x5d4>
+  805bdc:	70 61                	jo     805c3f <__rodata_start+0x617>
+  805bde:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805bdf:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  805be6:	73 20                	jae    805c08 <__rodata_start+0x5e0>
+  805be8:	61                   	(bad)
+  805be9:	74 20                	je     805c0b <__rodata_start+0x5e3>
+  805beb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  805bf0:	3a 20                	cmp    (%rax),%ah
+  805bf2:	00 30                	add    %dh,(%rax)
+  805bf4:	31 32                	xor    %esi,(%rdx)
+  805bf6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  805bfd:	41                   	rex.B
+  805bfe:	42                   	rex.X
+  805bff:	43                   	rex.XB
+  805c00:	44                   	rex.R
+  805c01:	45                   	rex.RB
+  805c02:	46 00 30             	rex.RX add %r14b,(%rax)
+  805c05:	31 32                	xor    %esi,(%rdx)
+  805c07:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  805c0e:	61                   	(bad)
+  805c0f:	62 63 64 65 66       	(bad)
+  805c14:	00 28                	add    %ch,(%rax)
+  805c16:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805c17:	75 6c                	jne    805c85 <__rodata_start+0x65d>
+  805c19:	6c                   	insb   (%dx),%es:(%rdi)
+  805c1a:	29 00                	sub    %eax,(%rax)
+  805c1c:	65 72 72             	gs jb  805c91 <__rodata_start+0x669>
+  805c1f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c20:	72 20                	jb     805c42 <__rodata_start+0x61a>
+  805c22:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  805c27:	73 70                	jae    805c99 <__rodata_start+0x671>
+  805c29:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  805c2d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  805c34:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c35:	72 00                	jb     805c37 <__rodata_start+0x60f>
+  805c37:	62 61 64 20 65       	(bad)
+  805c3c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805c3d:	76 69                	jbe    805ca8 <__rodata_start+0x680>
+  805c3f:	72 6f                	jb     805cb0 <__rodata_start+0x688>
+  805c41:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805c42:	6d                   	insl   (%dx),%es:(%rdi)
+  805c43:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805c45:	74 00                	je     805c47 <__rodata_start+0x61f>
+  805c47:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  805c4e:	20 70 61             	and    %dh,0x61(%rax)
+  805c51:	72 61                	jb     805cb4 <__rodata_start+0x68c>
+  805c53:	6d                   	insl   (%dx),%es:(%rdi)
+  805c54:	65 74 65             	gs je  805cbc <__rodata_start+0x694>
+  805c57:	72 00                	jb     805c59 <__rodata_start+0x631>
+  805c59:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c5a:	75 74                	jne    805cd0 <__rodata_start+0x6a8>
+  805c5c:	20 6f 66             	and    %ch,0x66(%rdi)
+  805c5f:	20 6d 65             	and    %ch,0x65(%rbp)
+  805c62:	6d                   	insl   (%dx),%es:(%rdi)
+  805c63:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c64:	72 79                	jb     805cdf <__rodata_start+0x6b7>
+  805c66:	00 6f 75             	add    %ch,0x75(%rdi)
+  805c69:	74 20                	je     805c8b <__rodata_start+0x663>
+  805c6b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c6c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  805c70:	76 69                	jbe    805cdb <__rodata_start+0x6b3>
+  805c72:	72 6f                	jb     805ce3 <__rodata_start+0x6bb>
+  805c74:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805c75:	6d                   	insl   (%dx),%es:(%rdi)
+  805c76:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805c78:	74 73                	je     805ced <__rodata_start+0x6c5>
+  805c7a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  805c7d:	72 72                	jb     805cf1 <__rodata_start+0x6c9>
+  805c7f:	75 70                	jne    805cf1 <__rodata_start+0x6c9>
+  805c81:	74 65                	je     805ce8 <__rodata_start+0x6c0>
+  805c83:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  805c88:	75 67                	jne    805cf1 <__rodata_start+0x6c9>
+  805c8a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805c8d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805c8f:	00 73 65             	add    %dh,0x65(%rbx)
+  805c92:	67 6d                	insl   (%dx),%es:(%edi)
+  805c94:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805c96:	74 61                	je     805cf9 <__rodata_start+0x6d1>
+  805c98:	74 69                	je     805d03 <__rodata_start+0x6db>
+  805c9a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c9b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805c9c:	20 66 61             	and    %ah,0x61(%rsi)
+  805c9f:	75 6c                	jne    805d0d <__rodata_start+0x6e5>
+  805ca1:	74 00                	je     805ca3 <__rodata_start+0x67b>
+  805ca3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  805caa:	20 45 4c             	and    %al,0x4c(%rbp)
+  805cad:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  805cb1:	61                   	(bad)
+  805cb2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  805cb7:	20 73 75             	and    %dh,0x75(%rbx)
+  805cba:	63 68 20             	movsxd 0x20(%rax),%ebp
+  805cbd:	73 79                	jae    805d38 <__rodata_start+0x710>
+  805cbf:	73 74                	jae    805d35 <__rodata_start+0x70d>
+  805cc1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  805cc3:	20 63 61             	and    %ah,0x61(%rbx)
+  805cc6:	6c                   	insb   (%dx),%es:(%rdi)
+  805cc7:	6c                   	insb   (%dx),%es:(%rdi)
+  805cc8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  805ccb:	74 72                	je     805d3f <__rodata_start+0x717>
+  805ccd:	79 20                	jns    805cef <__rodata_start+0x6c7>
+  805ccf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805cd0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805cd1:	74 20                	je     805cf3 <__rodata_start+0x6cb>
+  805cd3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805cd5:	75 6e                	jne    805d45 <__rodata_start+0x71d>
+  805cd7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  805cdb:	76 20                	jbe    805cfd <__rodata_start+0x6d5>
+  805cdd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  805ce4:	72 65                	jb     805d4b <__rodata_start+0x723>
+  805ce6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  805ce9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805cea:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  805cee:	65 78 70             	gs js  805d61 <__rodata_start+0x739>
+  805cf1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  805cf6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  805cf9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  805cfd:	20 66 69             	and    %ah,0x69(%rsi)
+  805d00:	6c                   	insb   (%dx),%es:(%rdi)
+  805d01:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  805d05:	20 66 72             	and    %ah,0x72(%rsi)
+  805d08:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  805d0d:	61                   	(bad)
+  805d0e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  805d11:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805d12:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805d13:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  805d17:	6b 00 74             	imul   $0x74,(%rax),%eax
+  805d1a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805d1b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805d1c:	20 6d 61             	and    %ch,0x61(%rbp)
+  805d1f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805d20:	79 20                	jns    805d42 <__rodata_start+0x71a>
+  805d22:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  805d29:	72 65                	jb     805d90 <__rodata_start+0x768>
+  805d2b:	20 6f 70             	and    %ch,0x70(%rdi)
+  805d2e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805d30:	00 66 69             	add    %ah,0x69(%rsi)
+  805d33:	6c                   	insb   (%dx),%es:(%rdi)
+  805d34:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  805d38:	20 62 6c             	and    %ah,0x6c(%rdx)
+  805d3b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805d3c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805d3f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805d40:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805d41:	74 20                	je     805d63 <__rodata_start+0x73b>
+  805d43:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805d45:	75 6e                	jne    805db5 <__rodata_start+0x78d>
+  805d47:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  805d4b:	76 61                	jbe    805dae <__rodata_start+0x786>
+  805d4d:	6c                   	insb   (%dx),%es:(%rdi)
+  805d4e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  805d55:	00 
+  805d56:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  805d5d:	72 65                	jb     805dc4 <__rodata_start+0x79c>
+  805d5f:	61                   	(bad)
+  805d60:	64 79 20             	fs jns 805d83 <__rodata_start+0x75b>
+  805d63:	65 78 69             	gs js  805dcf <__rodata_start+0x7a7>
+  805d66:	73 74                	jae    805ddc <__rodata_start+0x7b4>
+  805d68:	73 00                	jae    805d6a <__rodata_start+0x742>
+  805d6a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805d6b:	70 65                	jo     805dd2 <__rodata_start+0x7aa>
+  805d6d:	72 61                	jb     805dd0 <__rodata_start+0x7a8>
+  805d6f:	74 69                	je     805dda <__rodata_start+0x7b2>
+  805d71:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805d72:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805d73:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  805d76:	74 20                	je     805d98 <__rodata_start+0x770>
+  805d78:	73 75                	jae    805def <__rodata_start+0x7c7>
+  805d7a:	70 70                	jo     805dec <__rodata_start+0x7c4>
+  805d7c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805d7d:	72 74                	jb     805df3 <__rodata_start+0x7cb>
+  805d7f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  805d84:	65 72 61             	gs jb  805de8 <__rodata_start+0x7c0>
+  805d87:	74 69                	je     805df2 <__rodata_start+0x7ca>
+  805d89:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805d8a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805d8b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  805d8e:	74 20                	je     805db0 <__rodata_start+0x788>
+  805d90:	70 65                	jo     805df7 <__rodata_start+0x7cf>
+  805d92:	72 6d                	jb     805e01 <__rodata_start+0x7d9>
+  805d94:	69 74 74 65 64 00 66 	imul   $0xf660064,0x65(%rsp,%rsi,2),%esi
+  805d9b:	0f 
+  805d9c:	1f                   	(bad)
+  805d9d:	44 00 00             	add    %r8b,(%rax)
+  805da0:	e7 29                	out    %eax,$0x29
+  805da2:	80 00 00             	addb   $0x0,(%rax)
+  805da5:	00 00                	add    %al,(%rax)
+  805da7:	00 28                	add    %ch,(%rax)
+  805da9:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805daf:	00 18                	add    %bl,(%rax)
+  805db1:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805db7:	00 28                	add    %ch,(%rax)
+  805db9:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805dbf:	00 28                	add    %ch,(%rax)
+  805dc1:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805dc7:	00 28                	add    %ch,(%rax)
+  805dc9:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805dcf:	00 28                	add    %ch,(%rax)
+  805dd1:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805dd7:	00 06                	add    %al,(%rsi)
+  805dd9:	2a 80 00 00 00 00    	sub    0x0(%rax),%al
+  805ddf:	00 28                	add    %ch,(%rax)
+  805de1:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805de7:	00 28                	add    %ch,(%rax)
+  805de9:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805def:	00 fa                	add    %bh,%dl
+  805df1:	29 80 00 00 00 00    	sub    %eax,0x0(%rax)
+  805df7:	00 74 2a 80          	add    %dh,-0x80(%rdx,%rbp,1)
+  805dfb:	00 00                	add    %al,(%rax)
+  805dfd:	00 00                	add    %al,(%rax)
+  805dff:	00 28                	add    %ch,(%rax)
+  805e01:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805e07:	00 fa                	add    %bh,%dl
+  805e09:	29 80 00 00 00 00    	sub    %eax,0x0(%rax)
+  805e0f:	00 40 2a             	add    %al,0x2a(%rax)
+  805e12:	80 00 00             	addb   $0x0,(%rax)
+  805e15:	00 00                	add    %al,(%rax)
+  805e17:	00 40 2a             	add    %al,0x2a(%rax)
+  805e1a:	80 00 00             	addb   $0x0,(%rax)
+  805e1d:	00 00                	add    %al,(%rax)
+  805e1f:	00 40 2a             	add    %al,0x2a(%rax)
+  805e22:	80 00 00             	addb   $0x0,(%rax)
+  805e25:	00 00                	add    %al,(%rax)
+  805e27:	00 40 2a             	add    %al,0x2a(%rax)
+  805e2a:	80 00 00             	addb   $0x0,(%rax)
+  805e2d:	00 00                	add    %al,(%rax)
+  805e2f:	00 40 2a             	add    %al,0x2a(%rax)
+  805e32:	80 00 00             	addb   $0x0,(%rax)
+  805e35:	00 00                	add    %al,(%rax)
+  805e37:	00 40 2a             	add    %al,0x2a(%rax)
+  805e3a:	80 00 00             	addb   $0x0,(%rax)
+  805e3d:	00 00                	add    %al,(%rax)
+  805e3f:	00 40 2a             	add    %al,0x2a(%rax)
+  805e42:	80 00 00             	addb   $0x0,(%rax)
+  805e45:	00 00                	add    %al,(%rax)
+  805e47:	00 40 2a             	add    %al,0x2a(%rax)
+  805e4a:	80 00 00             	addb   $0x0,(%rax)
+  805e4d:	00 00                	add    %al,(%rax)
+  805e4f:	00 40 2a             	add    %al,0x2a(%rax)
+  805e52:	80 00 00             	addb   $0x0,(%rax)
+  805e55:	00 00                	add    %al,(%rax)
+  805e57:	00 28                	add    %ch,(%rax)
+  805e59:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805e5f:	00 28                	add    %ch,(%rax)
+  805e61:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805e67:	00 28                	add    %ch,(%rax)
+  805e69:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805e6f:	00 28                	add    %ch,(%rax)
+  805e71:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805e77:	00 28                	add    %ch,(%rax)
+  805e79:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805e7f:	00 28                	add    %ch,(%rax)
+  805e81:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805e87:	00 28                	add    %ch,(%rax)
+  805e89:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805e8f:	00 28                	add    %ch,(%rax)
+  805e91:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805e97:	00 28                	add    %ch,(%rax)
+  805e99:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805e9f:	00 28                	add    %ch,(%rax)
+  805ea1:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805ea7:	00 28                	add    %ch,(%rax)
+  805ea9:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805eaf:	00 28                	add    %ch,(%rax)
+  805eb1:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805eb7:	00 28                	add    %ch,(%rax)
+  805eb9:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805ebf:	00 28                	add    %ch,(%rax)
+  805ec1:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805ec7:	00 28                	add    %ch,(%rax)
+  805ec9:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805ecf:	00 28                	add    %ch,(%rax)
+  805ed1:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805ed7:	00 28                	add    %ch,(%rax)
+  805ed9:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805edf:	00 28                	add    %ch,(%rax)
+  805ee1:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805ee7:	00 28                	add    %ch,(%rax)
+  805ee9:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805eef:	00 28                	add    %ch,(%rax)
+  805ef1:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805ef7:	00 28                	add    %ch,(%rax)
+  805ef9:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805eff:	00 28                	add    %ch,(%rax)
+  805f01:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f07:	00 28                	add    %ch,(%rax)
+  805f09:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f0f:	00 28                	add    %ch,(%rax)
+  805f11:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f17:	00 28                	add    %ch,(%rax)
+  805f19:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f1f:	00 28                	add    %ch,(%rax)
+  805f21:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f27:	00 28                	add    %ch,(%rax)
+  805f29:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f2f:	00 28                	add    %ch,(%rax)
+  805f31:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f37:	00 28                	add    %ch,(%rax)
+  805f39:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f3f:	00 28                	add    %ch,(%rax)
+  805f41:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f47:	00 4b 2f             	add    %cl,0x2f(%rbx)
+  805f4a:	80 00 00             	addb   $0x0,(%rax)
+  805f4d:	00 00                	add    %al,(%rax)
+  805f4f:	00 28                	add    %ch,(%rax)
+  805f51:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f57:	00 28                	add    %ch,(%rax)
+  805f59:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f5f:	00 28                	add    %ch,(%rax)
+  805f61:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f67:	00 28                	add    %ch,(%rax)
+  805f69:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f6f:	00 28                	add    %ch,(%rax)
+  805f71:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f77:	00 28                	add    %ch,(%rax)
+  805f79:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f7f:	00 28                	add    %ch,(%rax)
+  805f81:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f87:	00 28                	add    %ch,(%rax)
+  805f89:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f8f:	00 28                	add    %ch,(%rax)
+  805f91:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f97:	00 28                	add    %ch,(%rax)
+  805f99:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805f9f:	00 97 2a 80 00 00    	add    %dl,0x802a(%rdi)
+  805fa5:	00 00                	add    %al,(%rax)
+  805fa7:	00 66 2c             	add    %ah,0x2c(%rsi)
+  805faa:	80 00 00             	addb   $0x0,(%rax)
+  805fad:	00 00                	add    %al,(%rax)
+  805faf:	00 28                	add    %ch,(%rax)
+  805fb1:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805fb7:	00 28                	add    %ch,(%rax)
+  805fb9:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805fbf:	00 28                	add    %ch,(%rax)
+  805fc1:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805fc7:	00 28                	add    %ch,(%rax)
+  805fc9:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805fcf:	00 c6                	add    %al,%dh
+  805fd1:	2a 80 00 00 00 00    	sub    0x0(%rax),%al
+  805fd7:	00 28                	add    %ch,(%rax)
+  805fd9:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805fdf:	00 28                	add    %ch,(%rax)
+  805fe1:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805fe7:	00 8c 2a 80 00 00 00 	add    %cl,0x80(%rdx,%rbp,1)
+  805fee:	00 00                	add    %al,(%rax)
+  805ff0:	28 30                	sub    %dh,(%rax)
+  805ff2:	80 00 00             	addb   $0x0,(%rax)
+  805ff5:	00 00                	add    %al,(%rax)
+  805ff7:	00 28                	add    %ch,(%rax)
+  805ff9:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  805fff:	00 0e                	add    %cl,(%rsi)
+  806001:	2e 80 00 00          	cs addb $0x0,(%rax)
+  806005:	00 00                	add    %al,(%rax)
+  806007:	00 d8                	add    %bl,%al
+  806009:	2e 80 00 00          	cs addb $0x0,(%rax)
+  80600d:	00 00                	add    %al,(%rax)
+  80600f:	00 28                	add    %ch,(%rax)
+  806011:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  806017:	00 28                	add    %ch,(%rax)
+  806019:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  80601f:	00 5d 2b             	add    %bl,0x2b(%rbp)
+  806022:	80 00 00             	addb   $0x0,(%rax)
+  806025:	00 00                	add    %al,(%rax)
+  806027:	00 28                	add    %ch,(%rax)
+  806029:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  80602f:	00 3a                	add    %bh,(%rdx)
+  806031:	2d 80 00 00 00       	sub    $0x80,%eax
+  806036:	00 00                	add    %al,(%rax)
+  806038:	28 30                	sub    %dh,(%rax)
+  80603a:	80 00 00             	addb   $0x0,(%rax)
+  80603d:	00 00                	add    %al,(%rax)
+  80603f:	00 28                	add    %ch,(%rax)
+  806041:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  806047:	00 4b 2f             	add    %cl,0x2f(%rbx)
+  80604a:	80 00 00             	addb   $0x0,(%rax)
+  80604d:	00 00                	add    %al,(%rax)
+  80604f:	00 28                	add    %ch,(%rax)
+  806051:	30 80 00 00 00 00    	xor    %al,0x0(%rax)
+  806057:	00 f0                	add    %dh,%al
+  806059:	29 80 00 00 00 00    	sub    %eax,0x0(%rax)
+	...
+
+0000000000806060 <error_string>:
+	...
+  806068:	25 5c 80 00 00 00 00 00 37 5c 80 00 00 00 00 00     %\......7\......
+  806078:	47 5c 80 00 00 00 00 00 59 5c 80 00 00 00 00 00     G\......Y\......
+  806088:	67 5c 80 00 00 00 00 00 7b 5c 80 00 00 00 00 00     g\......{\......
+  806098:	90 5c 80 00 00 00 00 00 a3 5c 80 00 00 00 00 00     .\.......\......
+  8060a8:	b5 5c 80 00 00 00 00 00 c9 5c 80 00 00 00 00 00     .\.......\......
+  8060b8:	d9 5c 80 00 00 00 00 00 ec 5c 80 00 00 00 00 00     .\.......\......
+  8060c8:	03 5d 80 00 00 00 00 00 19 5d 80 00 00 00 00 00     .].......]......
+  8060d8:	31 5d 80 00 00 00 00 00 49 5d 80 00 00 00 00 00     1]......I]......
+  8060e8:	56 5d 80 00 00 00 00 00 10 61 80 00 00 00 00 00     V].......a......
+  8060f8:	6a 5d 80 00 00 00 00 00 00 00 00 00 00 00 00 00     j]..............
+  806108:	82 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806118:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806128:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  806138:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  806148:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  806158:	6c 6c 2e 63 00 0f 1f 00 55 73 65 72 73 70 61 63     ll.c....Userspac
+  806168:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806178:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806188:	65 72 72 3d 25 78 0a 00 61 64 64 5f 70 67 66 61     err=%x..add_pgfa
+  806198:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  8061a8:	5f 61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61     _alloc_region fa
+  8061b8:	69 6c 65 64 00 00 00 00 61 64 64 5f 70 67 66 61     iled....add_pgfa
+  8061c8:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  8061d8:	5f 65 6e 76 5f 73 65 74 5f 70 67 66 61 75 6c 74     _env_set_pgfault
+  8061e8:	5f 75 70 63 61 6c 6c 20 66 61 69 6c 65 64 00 6c     _upcall failed.l
+  8061f8:	69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65 74     ib/pgfault.c.set
+  806208:	5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65 72     _pgfault_handler
+  806218:	3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72 5f     : %i._pfhandler_
+  806228:	69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00 69     inititiallized.i
+  806238:	70 63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64 20     pc_send: failed 
+  806248:	74 6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63 2e     to send.lib/ipc.
+  806258:	63 00 66 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     c.f..D..[%08x] u
+  806268:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  806278:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  806288:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  806298:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8062a8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8062b8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8062c8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8062d8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008062e0 <devtab>:
+  8062e0:	a0 b0 80 00 00 00 00 00 e0 b0 80 00 00 00 00 00     ................
+  8062f0:	20 b1 80 00 00 00 00 00 00 00 00 00 00 00 00 00      ...............
+  806300:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806310:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806320:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806330:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 0f 1f 40 00     _SIZE) == 2...@.
+  806340:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  806350:	20 62 65 67 69 6e 20 67 65 6e 65 72 69 63 20 68      begin generic h
+  806360:	61 6e 64 6c 65 72 20 66 6f 72 20 25 64 0a 00 00     andler for %d...
+  806370:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  806380:	20 65 78 69 74 69 6e 67 20 64 75 65 20 74 6f 20      exiting due to 
+  806390:	73 69 67 6e 61 6c 20 25 64 0a 00 00 00 00 00 00     signal %d.......
+  8063a0:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  8063b0:	20 69 67 6e 6f 72 69 6e 67 20 73 69 67 6e 61 6c      ignoring signal
+  8063c0:	20 25 64 0a 00 00 00 00 73 69 67 6e 61 6c 73 3a      %d.....signals:
+  8063d0:	20 65 6e 76 20 25 78 3a 20 65 6e 64 20 67 65 6e      env %x: end gen
+  8063e0:	65 72 69 63 20 68 61 6e 64 6c 65 72 20 66 6f 72     eric handler for
+  8063f0:	20 25 64 0a 00 66 61 6c 73 65 00 6c 69 62 2f 73      %d..false.lib/s
+  806400:	69 67 6e 61 6c 2e 63 00 3c 63 6f 6e 73 3e 00 63     ignal.c.<cons>.c
+  806410:	6f 6e 73 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ons.f.........f.
+  806420:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806430:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806440:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8064a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8064b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8064c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8064d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8064e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8064f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8065a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8065b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8065c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8065d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8065e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8065f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8066a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8066b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8066c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8066d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8066e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8066f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8067b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8068b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
@@ -0,0 +1,5382 @@
+
+obj/user/badsegment:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 09 00 00 00       	call   80002c <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    /* Try to load the kernel's TSS selector into the DS register. */
+    asm volatile("movw $0x38,%ax; movw %ax,%ds");
+  800025:	66 b8 38 00          	mov    $0x38,%ax
+  800029:	8e d8                	mov    %eax,%ds
+}
+  80002b:	c3                   	ret
+
+000000000080002c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80002c:	55                   	push   %rbp
+  80002d:	48 89 e5             	mov    %rsp,%rbp
+  800030:	41 56                	push   %r14
+  800032:	41 55                	push   %r13
+  800034:	41 54                	push   %r12
+  800036:	53                   	push   %rbx
+  800037:	41 89 fd             	mov    %edi,%r13d
+  80003a:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80003d:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800044:	00 00 00 
+  800047:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80004e:	00 00 00 
+  800051:	48 39 c2             	cmp    %rax,%rdx
+  800054:	73 17                	jae    80006d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800056:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800059:	49 89 c4             	mov    %rax,%r12
+  80005c:	48 83 c3 08          	add    $0x8,%rbx
+  800060:	b8 00 00 00 00       	mov    $0x0,%eax
+  800065:	ff 53 f8             	call   *-0x8(%rbx)
+  800068:	4c 39 e3             	cmp    %r12,%rbx
+  80006b:	72 ef                	jb     80005c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  80006d:	48 b8 bf 01 80 00 00 	movabs $0x8001bf,%rax
+  800074:	00 00 00 
+  800077:	ff d0                	call   *%rax
+  800079:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  80007c:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800083:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80008a:	00 00 00 
+  80008d:	48 01 d0             	add    %rdx,%rax
+  800090:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800097:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80009a:	45 85 ed             	test   %r13d,%r13d
+  80009d:	7e 0d                	jle    8000ac <libmain+0x80>
+  80009f:	49 8b 06             	mov    (%r14),%rax
+  8000a2:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000a9:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000ac:	4c 89 f6             	mov    %r14,%rsi
+  8000af:	44 89 ef             	mov    %r13d,%edi
+  8000b2:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000b9:	00 00 00 
+  8000bc:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000be:	48 b8 d3 00 80 00 00 	movabs $0x8000d3,%rax
+  8000c5:	00 00 00 
+  8000c8:	ff d0                	call   *%rax
+#endif
+}
+  8000ca:	5b                   	pop    %rbx
+  8000cb:	41 5c                	pop    %r12
+  8000cd:	41 5d                	pop    %r13
+  8000cf:	41 5e                	pop    %r14
+  8000d1:	5d                   	pop    %rbp
+  8000d2:	c3                   	ret
+
+00000000008000d3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000d3:	55                   	push   %rbp
+  8000d4:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000d7:	48 b8 47 0a 80 00 00 	movabs $0x800a47,%rax
+  8000de:	00 00 00 
+  8000e1:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000e8:	48 b8 54 01 80 00 00 	movabs $0x800154,%rax
+  8000ef:	00 00 00 
+  8000f2:	ff d0                	call   *%rax
+}
+  8000f4:	5d                   	pop    %rbp
+  8000f5:	c3                   	ret
+
+00000000008000f6 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000f6:	55                   	push   %rbp
+  8000f7:	48 89 e5             	mov    %rsp,%rbp
+  8000fa:	53                   	push   %rbx
+  8000fb:	48 89 fa             	mov    %rdi,%rdx
+  8000fe:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800101:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800106:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80010b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800110:	be 00 00 00 00       	mov    $0x0,%esi
+  800115:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80011b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80011d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800121:	c9                   	leave
+  800122:	c3                   	ret
+
+0000000000800123 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800123:	55                   	push   %rbp
+  800124:	48 89 e5             	mov    %rsp,%rbp
+  800127:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800128:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80012d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800132:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800137:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80013c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800141:	be 00 00 00 00       	mov    $0x0,%esi
+  800146:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80014c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80014e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800152:	c9                   	leave
+  800153:	c3                   	ret
+
+0000000000800154 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800154:	55                   	push   %rbp
+  800155:	48 89 e5             	mov    %rsp,%rbp
+  800158:	53                   	push   %rbx
+  800159:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80015d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800160:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800165:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80016a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80016f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800174:	be 00 00 00 00       	mov    $0x0,%esi
+  800179:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80017f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800181:	48 85 c0             	test   %rax,%rax
+  800184:	7f 06                	jg     80018c <sys_env_destroy+0x38>
+}
+  800186:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80018a:	c9                   	leave
+  80018b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80018c:	49 89 c0             	mov    %rax,%r8
+  80018f:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800194:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  80019b:	00 00 00 
+  80019e:	be 26 00 00 00       	mov    $0x26,%esi
+  8001a3:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  8001aa:	00 00 00 
+  8001ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b2:	49 b9 f4 1a 80 00 00 	movabs $0x801af4,%r9
+  8001b9:	00 00 00 
+  8001bc:	41 ff d1             	call   *%r9
+
+00000000008001bf <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001bf:	55                   	push   %rbp
+  8001c0:	48 89 e5             	mov    %rsp,%rbp
+  8001c3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001c4:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001d8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001e8:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ee:	c9                   	leave
+  8001ef:	c3                   	ret
+
+00000000008001f0 <sys_yield>:
+
+void
+sys_yield(void) {
+  8001f0:	55                   	push   %rbp
+  8001f1:	48 89 e5             	mov    %rsp,%rbp
+  8001f4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001f5:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800204:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800209:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80020e:	be 00 00 00 00       	mov    $0x0,%esi
+  800213:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800219:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80021b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80021f:	c9                   	leave
+  800220:	c3                   	ret
+
+0000000000800221 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800221:	55                   	push   %rbp
+  800222:	48 89 e5             	mov    %rsp,%rbp
+  800225:	53                   	push   %rbx
+  800226:	48 89 fa             	mov    %rdi,%rdx
+  800229:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80022c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800231:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800238:	00 00 00 
+  80023b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800240:	be 00 00 00 00       	mov    $0x0,%esi
+  800245:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80024b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80024d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800251:	c9                   	leave
+  800252:	c3                   	ret
+
+0000000000800253 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800253:	55                   	push   %rbp
+  800254:	48 89 e5             	mov    %rsp,%rbp
+  800257:	53                   	push   %rbx
+  800258:	49 89 f8             	mov    %rdi,%r8
+  80025b:	48 89 d3             	mov    %rdx,%rbx
+  80025e:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800261:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800266:	4c 89 c2             	mov    %r8,%rdx
+  800269:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80026c:	be 00 00 00 00       	mov    $0x0,%esi
+  800271:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800277:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800279:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80027d:	c9                   	leave
+  80027e:	c3                   	ret
+
+000000000080027f <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80027f:	55                   	push   %rbp
+  800280:	48 89 e5             	mov    %rsp,%rbp
+  800283:	53                   	push   %rbx
+  800284:	48 83 ec 08          	sub    $0x8,%rsp
+  800288:	89 f8                	mov    %edi,%eax
+  80028a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80028d:	48 63 f9             	movslq %ecx,%rdi
+  800290:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800293:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800298:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80029b:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002a6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002a8:	48 85 c0             	test   %rax,%rax
+  8002ab:	7f 06                	jg     8002b3 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002b1:	c9                   	leave
+  8002b2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002b3:	49 89 c0             	mov    %rax,%r8
+  8002b6:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002bb:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  8002c2:	00 00 00 
+  8002c5:	be 26 00 00 00       	mov    $0x26,%esi
+  8002ca:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  8002d1:	00 00 00 
+  8002d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d9:	49 b9 f4 1a 80 00 00 	movabs $0x801af4,%r9
+  8002e0:	00 00 00 
+  8002e3:	41 ff d1             	call   *%r9
+
+00000000008002e6 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002e6:	55                   	push   %rbp
+  8002e7:	48 89 e5             	mov    %rsp,%rbp
+  8002ea:	53                   	push   %rbx
+  8002eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ef:	89 f8                	mov    %edi,%eax
+  8002f1:	49 89 f2             	mov    %rsi,%r10
+  8002f4:	48 89 cf             	mov    %rcx,%rdi
+  8002f7:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002fa:	48 63 da             	movslq %edx,%rbx
+  8002fd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800300:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800305:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800308:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80030b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80030d:	48 85 c0             	test   %rax,%rax
+  800310:	7f 06                	jg     800318 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800312:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800316:	c9                   	leave
+  800317:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800318:	49 89 c0             	mov    %rax,%r8
+  80031b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800320:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  800327:	00 00 00 
+  80032a:	be 26 00 00 00       	mov    $0x26,%esi
+  80032f:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  800336:	00 00 00 
+  800339:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033e:	49 b9 f4 1a 80 00 00 	movabs $0x801af4,%r9
+  800345:	00 00 00 
+  800348:	41 ff d1             	call   *%r9
+
+000000000080034b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80034b:	55                   	push   %rbp
+  80034c:	48 89 e5             	mov    %rsp,%rbp
+  80034f:	53                   	push   %rbx
+  800350:	48 83 ec 08          	sub    $0x8,%rsp
+  800354:	48 89 f1             	mov    %rsi,%rcx
+  800357:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80035a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80035d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800362:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800367:	be 00 00 00 00       	mov    $0x0,%esi
+  80036c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800372:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800374:	48 85 c0             	test   %rax,%rax
+  800377:	7f 06                	jg     80037f <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800379:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80037d:	c9                   	leave
+  80037e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80037f:	49 89 c0             	mov    %rax,%r8
+  800382:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800387:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  80038e:	00 00 00 
+  800391:	be 26 00 00 00       	mov    $0x26,%esi
+  800396:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  80039d:	00 00 00 
+  8003a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a5:	49 b9 f4 1a 80 00 00 	movabs $0x801af4,%r9
+  8003ac:	00 00 00 
+  8003af:	41 ff d1             	call   *%r9
+
+00000000008003b2 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8003b2:	55                   	push   %rbp
+  8003b3:	48 89 e5             	mov    %rsp,%rbp
+  8003b6:	53                   	push   %rbx
+  8003b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8003bb:	89 f8                	mov    %edi,%eax
+  8003bd:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8003c0:	48 63 f9             	movslq %ecx,%rdi
+  8003c3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003c6:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003cb:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8003d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003db:	48 85 c0             	test   %rax,%rax
+  8003de:	7f 06                	jg     8003e6 <sys_region_advise+0x34>
+}
+  8003e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003e4:	c9                   	leave
+  8003e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003e6:	49 89 c0             	mov    %rax,%r8
+  8003e9:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8003ee:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  8003f5:	00 00 00 
+  8003f8:	be 26 00 00 00       	mov    $0x26,%esi
+  8003fd:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  800404:	00 00 00 
+  800407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040c:	49 b9 f4 1a 80 00 00 	movabs $0x801af4,%r9
+  800413:	00 00 00 
+  800416:	41 ff d1             	call   *%r9
+
+0000000000800419 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  800419:	55                   	push   %rbp
+  80041a:	48 89 e5             	mov    %rsp,%rbp
+  80041d:	53                   	push   %rbx
+  80041e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  800422:	48 63 ce             	movslq %esi,%rcx
+  800425:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800428:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80042d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800432:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800437:	be 00 00 00 00       	mov    $0x0,%esi
+  80043c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800442:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800444:	48 85 c0             	test   %rax,%rax
+  800447:	7f 06                	jg     80044f <sys_env_set_nice+0x36>
+}
+  800449:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80044d:	c9                   	leave
+  80044e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80044f:	49 89 c0             	mov    %rax,%r8
+  800452:	b9 15 00 00 00       	mov    $0x15,%ecx
+  800457:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  80045e:	00 00 00 
+  800461:	be 26 00 00 00       	mov    $0x26,%esi
+  800466:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  80046d:	00 00 00 
+  800470:	b8 00 00 00 00       	mov    $0x0,%eax
+  800475:	49 b9 f4 1a 80 00 00 	movabs $0x801af4,%r9
+  80047c:	00 00 00 
+  80047f:	41 ff d1             	call   *%r9
+
+0000000000800482 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800482:	55                   	push   %rbp
+  800483:	48 89 e5             	mov    %rsp,%rbp
+  800486:	53                   	push   %rbx
+  800487:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80048b:	48 63 ce             	movslq %esi,%rcx
+  80048e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800491:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800496:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80049b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8004a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004ab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004ad:	48 85 c0             	test   %rax,%rax
+  8004b0:	7f 06                	jg     8004b8 <sys_env_set_status+0x36>
+}
+  8004b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004b6:	c9                   	leave
+  8004b7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004b8:	49 89 c0             	mov    %rax,%r8
+  8004bb:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004c0:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  8004c7:	00 00 00 
+  8004ca:	be 26 00 00 00       	mov    $0x26,%esi
+  8004cf:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  8004d6:	00 00 00 
+  8004d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004de:	49 b9 f4 1a 80 00 00 	movabs $0x801af4,%r9
+  8004e5:	00 00 00 
+  8004e8:	41 ff d1             	call   *%r9
+
+00000000008004eb <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8004eb:	55                   	push   %rbp
+  8004ec:	48 89 e5             	mov    %rsp,%rbp
+  8004ef:	53                   	push   %rbx
+  8004f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8004f4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8004f7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004fa:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800504:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800509:	be 00 00 00 00       	mov    $0x0,%esi
+  80050e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800514:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800516:	48 85 c0             	test   %rax,%rax
+  800519:	7f 06                	jg     800521 <sys_env_set_trapframe+0x36>
+}
+  80051b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80051f:	c9                   	leave
+  800520:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800521:	49 89 c0             	mov    %rax,%r8
+  800524:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800529:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  800530:	00 00 00 
+  800533:	be 26 00 00 00       	mov    $0x26,%esi
+  800538:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  80053f:	00 00 00 
+  800542:	b8 00 00 00 00       	mov    $0x0,%eax
+  800547:	49 b9 f4 1a 80 00 00 	movabs $0x801af4,%r9
+  80054e:	00 00 00 
+  800551:	41 ff d1             	call   *%r9
+
+0000000000800554 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800554:	55                   	push   %rbp
+  800555:	48 89 e5             	mov    %rsp,%rbp
+  800558:	53                   	push   %rbx
+  800559:	48 83 ec 08          	sub    $0x8,%rsp
+  80055d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800560:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800563:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800568:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80056d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800572:	be 00 00 00 00       	mov    $0x0,%esi
+  800577:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80057d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80057f:	48 85 c0             	test   %rax,%rax
+  800582:	7f 06                	jg     80058a <sys_env_set_pgfault_upcall+0x36>
+}
+  800584:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800588:	c9                   	leave
+  800589:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80058a:	49 89 c0             	mov    %rax,%r8
+  80058d:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800592:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  800599:	00 00 00 
+  80059c:	be 26 00 00 00       	mov    $0x26,%esi
+  8005a1:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  8005a8:	00 00 00 
+  8005ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b0:	49 b9 f4 1a 80 00 00 	movabs $0x801af4,%r9
+  8005b7:	00 00 00 
+  8005ba:	41 ff d1             	call   *%r9
+
+00000000008005bd <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8005bd:	55                   	push   %rbp
+  8005be:	48 89 e5             	mov    %rsp,%rbp
+  8005c1:	53                   	push   %rbx
+  8005c2:	89 f8                	mov    %edi,%eax
+  8005c4:	49 89 f1             	mov    %rsi,%r9
+  8005c7:	48 89 d3             	mov    %rdx,%rbx
+  8005ca:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8005cd:	49 63 f0             	movslq %r8d,%rsi
+  8005d0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005d8:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005e1:	cd 30                	int    $0x30
+}
+  8005e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005e7:	c9                   	leave
+  8005e8:	c3                   	ret
+
+00000000008005e9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8005e9:	55                   	push   %rbp
+  8005ea:	48 89 e5             	mov    %rsp,%rbp
+  8005ed:	53                   	push   %rbx
+  8005ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8005f2:	48 89 fa             	mov    %rdi,%rdx
+  8005f5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8005f8:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800602:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800607:	be 00 00 00 00       	mov    $0x0,%esi
+  80060c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800612:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800614:	48 85 c0             	test   %rax,%rax
+  800617:	7f 06                	jg     80061f <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800619:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80061d:	c9                   	leave
+  80061e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80061f:	49 89 c0             	mov    %rax,%r8
+  800622:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800627:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  80062e:	00 00 00 
+  800631:	be 26 00 00 00       	mov    $0x26,%esi
+  800636:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  80063d:	00 00 00 
+  800640:	b8 00 00 00 00       	mov    $0x0,%eax
+  800645:	49 b9 f4 1a 80 00 00 	movabs $0x801af4,%r9
+  80064c:	00 00 00 
+  80064f:	41 ff d1             	call   *%r9
+
+0000000000800652 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800652:	55                   	push   %rbp
+  800653:	48 89 e5             	mov    %rsp,%rbp
+  800656:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800657:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80065c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800661:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800666:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80066b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800670:	be 00 00 00 00       	mov    $0x0,%esi
+  800675:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80067b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80067d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800681:	c9                   	leave
+  800682:	c3                   	ret
+
+0000000000800683 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  800683:	55                   	push   %rbp
+  800684:	48 89 e5             	mov    %rsp,%rbp
+  800687:	53                   	push   %rbx
+  800688:	48 83 ec 08          	sub    $0x8,%rsp
+  80068c:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  80068f:	48 63 ce             	movslq %esi,%rcx
+  800692:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800695:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80069a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80069f:	be 00 00 00 00       	mov    $0x0,%esi
+  8006a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006aa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8006ac:	48 85 c0             	test   %rax,%rax
+  8006af:	7f 06                	jg     8006b7 <sys_sigqueue+0x34>
+}
+  8006b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006b5:	c9                   	leave
+  8006b6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006b7:	49 89 c0             	mov    %rax,%r8
+  8006ba:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8006bf:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  8006c6:	00 00 00 
+  8006c9:	be 26 00 00 00       	mov    $0x26,%esi
+  8006ce:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  8006d5:	00 00 00 
+  8006d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006dd:	49 b9 f4 1a 80 00 00 	movabs $0x801af4,%r9
+  8006e4:	00 00 00 
+  8006e7:	41 ff d1             	call   *%r9
+
+00000000008006ea <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8006ea:	55                   	push   %rbp
+  8006eb:	48 89 e5             	mov    %rsp,%rbp
+  8006ee:	53                   	push   %rbx
+  8006ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8006f3:	48 89 fa             	mov    %rdi,%rdx
+  8006f6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8006f9:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800703:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800708:	be 00 00 00 00       	mov    $0x0,%esi
+  80070d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800713:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800715:	48 85 c0             	test   %rax,%rax
+  800718:	7f 06                	jg     800720 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  80071a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80071e:	c9                   	leave
+  80071f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800720:	49 89 c0             	mov    %rax,%r8
+  800723:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800728:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  80072f:	00 00 00 
+  800732:	be 26 00 00 00       	mov    $0x26,%esi
+  800737:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  80073e:	00 00 00 
+  800741:	b8 00 00 00 00       	mov    $0x0,%eax
+  800746:	49 b9 f4 1a 80 00 00 	movabs $0x801af4,%r9
+  80074d:	00 00 00 
+  800750:	41 ff d1             	call   *%r9
+
+0000000000800753 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  800753:	55                   	push   %rbp
+  800754:	48 89 e5             	mov    %rsp,%rbp
+  800757:	53                   	push   %rbx
+  800758:	48 83 ec 08          	sub    $0x8,%rsp
+  80075c:	48 89 f1             	mov    %rsi,%rcx
+  80075f:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  800762:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800765:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80076a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80076f:	be 00 00 00 00       	mov    $0x0,%esi
+  800774:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80077a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80077c:	48 85 c0             	test   %rax,%rax
+  80077f:	7f 06                	jg     800787 <sys_sigaction+0x34>
+}
+  800781:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800785:	c9                   	leave
+  800786:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800787:	49 89 c0             	mov    %rax,%r8
+  80078a:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80078f:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  800796:	00 00 00 
+  800799:	be 26 00 00 00       	mov    $0x26,%esi
+  80079e:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  8007a5:	00 00 00 
+  8007a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ad:	49 b9 f4 1a 80 00 00 	movabs $0x801af4,%r9
+  8007b4:	00 00 00 
+  8007b7:	41 ff d1             	call   *%r9
+
+00000000008007ba <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8007ba:	55                   	push   %rbp
+  8007bb:	48 89 e5             	mov    %rsp,%rbp
+  8007be:	53                   	push   %rbx
+  8007bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8007c3:	48 89 f1             	mov    %rsi,%rcx
+  8007c6:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8007c9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8007cc:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8007d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8007db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8007e1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8007e3:	48 85 c0             	test   %rax,%rax
+  8007e6:	7f 06                	jg     8007ee <sys_sigprocmask+0x34>
+}
+  8007e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007ec:	c9                   	leave
+  8007ed:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007ee:	49 89 c0             	mov    %rax,%r8
+  8007f1:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8007f6:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  8007fd:	00 00 00 
+  800800:	be 26 00 00 00       	mov    $0x26,%esi
+  800805:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  80080c:	00 00 00 
+  80080f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800814:	49 b9 f4 1a 80 00 00 	movabs $0x801af4,%r9
+  80081b:	00 00 00 
+  80081e:	41 ff d1             	call   *%r9
+
+0000000000800821 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800821:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800828:	ff ff ff 
+  80082b:	48 01 f8             	add    %rdi,%rax
+  80082e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800832:	c3                   	ret
+
+0000000000800833 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800833:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80083a:	ff ff ff 
+  80083d:	48 01 f8             	add    %rdi,%rax
+  800840:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800844:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80084a:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80084e:	c3                   	ret
+
+000000000080084f <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80084f:	55                   	push   %rbp
+  800850:	48 89 e5             	mov    %rsp,%rbp
+  800853:	41 57                	push   %r15
+  800855:	41 56                	push   %r14
+  800857:	41 55                	push   %r13
+  800859:	41 54                	push   %r12
+  80085b:	53                   	push   %rbx
+  80085c:	48 83 ec 08          	sub    $0x8,%rsp
+  800860:	49 89 ff             	mov    %rdi,%r15
+  800863:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800868:	49 bd cd 17 80 00 00 	movabs $0x8017cd,%r13
+  80086f:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800872:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800878:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80087b:	48 89 df             	mov    %rbx,%rdi
+  80087e:	41 ff d5             	call   *%r13
+  800881:	83 e0 04             	and    $0x4,%eax
+  800884:	74 17                	je     80089d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800886:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80088d:	4c 39 f3             	cmp    %r14,%rbx
+  800890:	75 e6                	jne    800878 <fd_alloc+0x29>
+  800892:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800898:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80089d:	4d 89 27             	mov    %r12,(%r15)
+}
+  8008a0:	48 83 c4 08          	add    $0x8,%rsp
+  8008a4:	5b                   	pop    %rbx
+  8008a5:	41 5c                	pop    %r12
+  8008a7:	41 5d                	pop    %r13
+  8008a9:	41 5e                	pop    %r14
+  8008ab:	41 5f                	pop    %r15
+  8008ad:	5d                   	pop    %rbp
+  8008ae:	c3                   	ret
+
+00000000008008af <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8008af:	83 ff 1f             	cmp    $0x1f,%edi
+  8008b2:	77 39                	ja     8008ed <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8008b4:	55                   	push   %rbp
+  8008b5:	48 89 e5             	mov    %rsp,%rbp
+  8008b8:	41 54                	push   %r12
+  8008ba:	53                   	push   %rbx
+  8008bb:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8008be:	48 63 df             	movslq %edi,%rbx
+  8008c1:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8008c8:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8008cc:	48 89 df             	mov    %rbx,%rdi
+  8008cf:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  8008d6:	00 00 00 
+  8008d9:	ff d0                	call   *%rax
+  8008db:	a8 04                	test   $0x4,%al
+  8008dd:	74 14                	je     8008f3 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8008df:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8008e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008e8:	5b                   	pop    %rbx
+  8008e9:	41 5c                	pop    %r12
+  8008eb:	5d                   	pop    %rbp
+  8008ec:	c3                   	ret
+        return -E_INVAL;
+  8008ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8008f2:	c3                   	ret
+        return -E_INVAL;
+  8008f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008f8:	eb ee                	jmp    8008e8 <fd_lookup+0x39>
+
+00000000008008fa <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8008fa:	55                   	push   %rbp
+  8008fb:	48 89 e5             	mov    %rsp,%rbp
+  8008fe:	41 54                	push   %r12
+  800900:	53                   	push   %rbx
+  800901:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800904:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  80090b:	00 00 00 
+  80090e:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  800915:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800918:	39 3b                	cmp    %edi,(%rbx)
+  80091a:	74 47                	je     800963 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80091c:	48 83 c0 08          	add    $0x8,%rax
+  800920:	48 8b 18             	mov    (%rax),%rbx
+  800923:	48 85 db             	test   %rbx,%rbx
+  800926:	75 f0                	jne    800918 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800928:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80092f:	00 00 00 
+  800932:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800938:	89 fa                	mov    %edi,%edx
+  80093a:	48 bf 58 2b 80 00 00 	movabs $0x802b58,%rdi
+  800941:	00 00 00 
+  800944:	b8 00 00 00 00       	mov    $0x0,%eax
+  800949:	48 b9 44 1c 80 00 00 	movabs $0x801c44,%rcx
+  800950:	00 00 00 
+  800953:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800955:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80095a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80095e:	5b                   	pop    %rbx
+  80095f:	41 5c                	pop    %r12
+  800961:	5d                   	pop    %rbp
+  800962:	c3                   	ret
+            return 0;
+  800963:	b8 00 00 00 00       	mov    $0x0,%eax
+  800968:	eb f0                	jmp    80095a <dev_lookup+0x60>
+
+000000000080096a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80096a:	55                   	push   %rbp
+  80096b:	48 89 e5             	mov    %rsp,%rbp
+  80096e:	41 55                	push   %r13
+  800970:	41 54                	push   %r12
+  800972:	53                   	push   %rbx
+  800973:	48 83 ec 18          	sub    $0x18,%rsp
+  800977:	48 89 fb             	mov    %rdi,%rbx
+  80097a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80097d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800984:	ff ff ff 
+  800987:	48 01 df             	add    %rbx,%rdi
+  80098a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80098e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800992:	48 b8 af 08 80 00 00 	movabs $0x8008af,%rax
+  800999:	00 00 00 
+  80099c:	ff d0                	call   *%rax
+  80099e:	41 89 c5             	mov    %eax,%r13d
+  8009a1:	85 c0                	test   %eax,%eax
+  8009a3:	78 06                	js     8009ab <fd_close+0x41>
+  8009a5:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8009a9:	74 1a                	je     8009c5 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8009ab:	45 84 e4             	test   %r12b,%r12b
+  8009ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b3:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8009b7:	44 89 e8             	mov    %r13d,%eax
+  8009ba:	48 83 c4 18          	add    $0x18,%rsp
+  8009be:	5b                   	pop    %rbx
+  8009bf:	41 5c                	pop    %r12
+  8009c1:	41 5d                	pop    %r13
+  8009c3:	5d                   	pop    %rbp
+  8009c4:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8009c5:	8b 3b                	mov    (%rbx),%edi
+  8009c7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8009cb:	48 b8 fa 08 80 00 00 	movabs $0x8008fa,%rax
+  8009d2:	00 00 00 
+  8009d5:	ff d0                	call   *%rax
+  8009d7:	41 89 c5             	mov    %eax,%r13d
+  8009da:	85 c0                	test   %eax,%eax
+  8009dc:	78 1b                	js     8009f9 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8009de:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8009e2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8009e6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8009ec:	48 85 c0             	test   %rax,%rax
+  8009ef:	74 08                	je     8009f9 <fd_close+0x8f>
+  8009f1:	48 89 df             	mov    %rbx,%rdi
+  8009f4:	ff d0                	call   *%rax
+  8009f6:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8009f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009fe:	48 89 de             	mov    %rbx,%rsi
+  800a01:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a06:	48 b8 4b 03 80 00 00 	movabs $0x80034b,%rax
+  800a0d:	00 00 00 
+  800a10:	ff d0                	call   *%rax
+    return res;
+  800a12:	eb a3                	jmp    8009b7 <fd_close+0x4d>
+
+0000000000800a14 <close>:
+
+int
+close(int fdnum) {
+  800a14:	55                   	push   %rbp
+  800a15:	48 89 e5             	mov    %rsp,%rbp
+  800a18:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800a1c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800a20:	48 b8 af 08 80 00 00 	movabs $0x8008af,%rax
+  800a27:	00 00 00 
+  800a2a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800a2c:	85 c0                	test   %eax,%eax
+  800a2e:	78 15                	js     800a45 <close+0x31>
+
+    return fd_close(fd, 1);
+  800a30:	be 01 00 00 00       	mov    $0x1,%esi
+  800a35:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800a39:	48 b8 6a 09 80 00 00 	movabs $0x80096a,%rax
+  800a40:	00 00 00 
+  800a43:	ff d0                	call   *%rax
+}
+  800a45:	c9                   	leave
+  800a46:	c3                   	ret
+
+0000000000800a47 <close_all>:
+
+void
+close_all(void) {
+  800a47:	55                   	push   %rbp
+  800a48:	48 89 e5             	mov    %rsp,%rbp
+  800a4b:	41 54                	push   %r12
+  800a4d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800a4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a53:	49 bc 14 0a 80 00 00 	movabs $0x800a14,%r12
+  800a5a:	00 00 00 
+  800a5d:	89 df                	mov    %ebx,%edi
+  800a5f:	41 ff d4             	call   *%r12
+  800a62:	83 c3 01             	add    $0x1,%ebx
+  800a65:	83 fb 20             	cmp    $0x20,%ebx
+  800a68:	75 f3                	jne    800a5d <close_all+0x16>
+}
+  800a6a:	5b                   	pop    %rbx
+  800a6b:	41 5c                	pop    %r12
+  800a6d:	5d                   	pop    %rbp
+  800a6e:	c3                   	ret
+
+0000000000800a6f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800a6f:	55                   	push   %rbp
+  800a70:	48 89 e5             	mov    %rsp,%rbp
+  800a73:	41 57                	push   %r15
+  800a75:	41 56                	push   %r14
+  800a77:	41 55                	push   %r13
+  800a79:	41 54                	push   %r12
+  800a7b:	53                   	push   %rbx
+  800a7c:	48 83 ec 18          	sub    $0x18,%rsp
+  800a80:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800a83:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800a87:	48 b8 af 08 80 00 00 	movabs $0x8008af,%rax
+  800a8e:	00 00 00 
+  800a91:	ff d0                	call   *%rax
+  800a93:	89 c3                	mov    %eax,%ebx
+  800a95:	85 c0                	test   %eax,%eax
+  800a97:	0f 88 b8 00 00 00    	js     800b55 <dup+0xe6>
+    close(newfdnum);
+  800a9d:	44 89 e7             	mov    %r12d,%edi
+  800aa0:	48 b8 14 0a 80 00 00 	movabs $0x800a14,%rax
+  800aa7:	00 00 00 
+  800aaa:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800aac:	4d 63 ec             	movslq %r12d,%r13
+  800aaf:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800ab6:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800aba:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800abe:	4c 89 ff             	mov    %r15,%rdi
+  800ac1:	49 be 33 08 80 00 00 	movabs $0x800833,%r14
+  800ac8:	00 00 00 
+  800acb:	41 ff d6             	call   *%r14
+  800ace:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800ad1:	4c 89 ef             	mov    %r13,%rdi
+  800ad4:	41 ff d6             	call   *%r14
+  800ad7:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800ada:	48 89 df             	mov    %rbx,%rdi
+  800add:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  800ae4:	00 00 00 
+  800ae7:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800ae9:	a8 04                	test   $0x4,%al
+  800aeb:	74 2b                	je     800b18 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800aed:	41 89 c1             	mov    %eax,%r9d
+  800af0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800af6:	4c 89 f1             	mov    %r14,%rcx
+  800af9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800afe:	48 89 de             	mov    %rbx,%rsi
+  800b01:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b06:	48 b8 e6 02 80 00 00 	movabs $0x8002e6,%rax
+  800b0d:	00 00 00 
+  800b10:	ff d0                	call   *%rax
+  800b12:	89 c3                	mov    %eax,%ebx
+  800b14:	85 c0                	test   %eax,%eax
+  800b16:	78 4e                	js     800b66 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800b18:	4c 89 ff             	mov    %r15,%rdi
+  800b1b:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  800b22:	00 00 00 
+  800b25:	ff d0                	call   *%rax
+  800b27:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800b2a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800b30:	4c 89 e9             	mov    %r13,%rcx
+  800b33:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b38:	4c 89 fe             	mov    %r15,%rsi
+  800b3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b40:	48 b8 e6 02 80 00 00 	movabs $0x8002e6,%rax
+  800b47:	00 00 00 
+  800b4a:	ff d0                	call   *%rax
+  800b4c:	89 c3                	mov    %eax,%ebx
+  800b4e:	85 c0                	test   %eax,%eax
+  800b50:	78 14                	js     800b66 <dup+0xf7>
+
+    return newfdnum;
+  800b52:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800b55:	89 d8                	mov    %ebx,%eax
+  800b57:	48 83 c4 18          	add    $0x18,%rsp
+  800b5b:	5b                   	pop    %rbx
+  800b5c:	41 5c                	pop    %r12
+  800b5e:	41 5d                	pop    %r13
+  800b60:	41 5e                	pop    %r14
+  800b62:	41 5f                	pop    %r15
+  800b64:	5d                   	pop    %rbp
+  800b65:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800b66:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b6b:	4c 89 ee             	mov    %r13,%rsi
+  800b6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b73:	49 bc 4b 03 80 00 00 	movabs $0x80034b,%r12
+  800b7a:	00 00 00 
+  800b7d:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800b80:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b85:	4c 89 f6             	mov    %r14,%rsi
+  800b88:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b8d:	41 ff d4             	call   *%r12
+    return res;
+  800b90:	eb c3                	jmp    800b55 <dup+0xe6>
+
+0000000000800b92 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800b92:	55                   	push   %rbp
+  800b93:	48 89 e5             	mov    %rsp,%rbp
+  800b96:	41 56                	push   %r14
+  800b98:	41 55                	push   %r13
+  800b9a:	41 54                	push   %r12
+  800b9c:	53                   	push   %rbx
+  800b9d:	48 83 ec 10          	sub    $0x10,%rsp
+  800ba1:	89 fb                	mov    %edi,%ebx
+  800ba3:	49 89 f4             	mov    %rsi,%r12
+  800ba6:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ba9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bad:	48 b8 af 08 80 00 00 	movabs $0x8008af,%rax
+  800bb4:	00 00 00 
+  800bb7:	ff d0                	call   *%rax
+  800bb9:	85 c0                	test   %eax,%eax
+  800bbb:	78 4c                	js     800c09 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bbd:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bc1:	41 8b 3e             	mov    (%r14),%edi
+  800bc4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bc8:	48 b8 fa 08 80 00 00 	movabs $0x8008fa,%rax
+  800bcf:	00 00 00 
+  800bd2:	ff d0                	call   *%rax
+  800bd4:	85 c0                	test   %eax,%eax
+  800bd6:	78 35                	js     800c0d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800bd8:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800bdc:	83 e0 03             	and    $0x3,%eax
+  800bdf:	83 f8 01             	cmp    $0x1,%eax
+  800be2:	74 2d                	je     800c11 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800be4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800be8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800bec:	48 85 c0             	test   %rax,%rax
+  800bef:	74 56                	je     800c47 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800bf1:	4c 89 ea             	mov    %r13,%rdx
+  800bf4:	4c 89 e6             	mov    %r12,%rsi
+  800bf7:	4c 89 f7             	mov    %r14,%rdi
+  800bfa:	ff d0                	call   *%rax
+}
+  800bfc:	48 83 c4 10          	add    $0x10,%rsp
+  800c00:	5b                   	pop    %rbx
+  800c01:	41 5c                	pop    %r12
+  800c03:	41 5d                	pop    %r13
+  800c05:	41 5e                	pop    %r14
+  800c07:	5d                   	pop    %rbp
+  800c08:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c09:	48 98                	cltq
+  800c0b:	eb ef                	jmp    800bfc <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c0d:	48 98                	cltq
+  800c0f:	eb eb                	jmp    800bfc <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c11:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c18:	00 00 00 
+  800c1b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c21:	89 da                	mov    %ebx,%edx
+  800c23:	48 bf 99 2b 80 00 00 	movabs $0x802b99,%rdi
+  800c2a:	00 00 00 
+  800c2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c32:	48 b9 44 1c 80 00 00 	movabs $0x801c44,%rcx
+  800c39:	00 00 00 
+  800c3c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c3e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c45:	eb b5                	jmp    800bfc <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800c47:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c4e:	eb ac                	jmp    800bfc <read+0x6a>
+
+0000000000800c50 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800c50:	55                   	push   %rbp
+  800c51:	48 89 e5             	mov    %rsp,%rbp
+  800c54:	41 57                	push   %r15
+  800c56:	41 56                	push   %r14
+  800c58:	41 55                	push   %r13
+  800c5a:	41 54                	push   %r12
+  800c5c:	53                   	push   %rbx
+  800c5d:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800c61:	48 85 d2             	test   %rdx,%rdx
+  800c64:	74 54                	je     800cba <readn+0x6a>
+  800c66:	41 89 fd             	mov    %edi,%r13d
+  800c69:	49 89 f6             	mov    %rsi,%r14
+  800c6c:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800c6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800c74:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800c79:	49 bf 92 0b 80 00 00 	movabs $0x800b92,%r15
+  800c80:	00 00 00 
+  800c83:	4c 89 e2             	mov    %r12,%rdx
+  800c86:	48 29 f2             	sub    %rsi,%rdx
+  800c89:	4c 01 f6             	add    %r14,%rsi
+  800c8c:	44 89 ef             	mov    %r13d,%edi
+  800c8f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800c92:	85 c0                	test   %eax,%eax
+  800c94:	78 20                	js     800cb6 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800c96:	01 c3                	add    %eax,%ebx
+  800c98:	85 c0                	test   %eax,%eax
+  800c9a:	74 08                	je     800ca4 <readn+0x54>
+  800c9c:	48 63 f3             	movslq %ebx,%rsi
+  800c9f:	4c 39 e6             	cmp    %r12,%rsi
+  800ca2:	72 df                	jb     800c83 <readn+0x33>
+    }
+    return res;
+  800ca4:	48 63 c3             	movslq %ebx,%rax
+}
+  800ca7:	48 83 c4 08          	add    $0x8,%rsp
+  800cab:	5b                   	pop    %rbx
+  800cac:	41 5c                	pop    %r12
+  800cae:	41 5d                	pop    %r13
+  800cb0:	41 5e                	pop    %r14
+  800cb2:	41 5f                	pop    %r15
+  800cb4:	5d                   	pop    %rbp
+  800cb5:	c3                   	ret
+        if (inc < 0) return inc;
+  800cb6:	48 98                	cltq
+  800cb8:	eb ed                	jmp    800ca7 <readn+0x57>
+    int inc = 1, res = 0;
+  800cba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cbf:	eb e3                	jmp    800ca4 <readn+0x54>
+
+0000000000800cc1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800cc1:	55                   	push   %rbp
+  800cc2:	48 89 e5             	mov    %rsp,%rbp
+  800cc5:	41 56                	push   %r14
+  800cc7:	41 55                	push   %r13
+  800cc9:	41 54                	push   %r12
+  800ccb:	53                   	push   %rbx
+  800ccc:	48 83 ec 10          	sub    $0x10,%rsp
+  800cd0:	89 fb                	mov    %edi,%ebx
+  800cd2:	49 89 f4             	mov    %rsi,%r12
+  800cd5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cd8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cdc:	48 b8 af 08 80 00 00 	movabs $0x8008af,%rax
+  800ce3:	00 00 00 
+  800ce6:	ff d0                	call   *%rax
+  800ce8:	85 c0                	test   %eax,%eax
+  800cea:	78 47                	js     800d33 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cec:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800cf0:	41 8b 3e             	mov    (%r14),%edi
+  800cf3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cf7:	48 b8 fa 08 80 00 00 	movabs $0x8008fa,%rax
+  800cfe:	00 00 00 
+  800d01:	ff d0                	call   *%rax
+  800d03:	85 c0                	test   %eax,%eax
+  800d05:	78 30                	js     800d37 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d07:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800d0c:	74 2d                	je     800d3b <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d12:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800d16:	48 85 c0             	test   %rax,%rax
+  800d19:	74 56                	je     800d71 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800d1b:	4c 89 ea             	mov    %r13,%rdx
+  800d1e:	4c 89 e6             	mov    %r12,%rsi
+  800d21:	4c 89 f7             	mov    %r14,%rdi
+  800d24:	ff d0                	call   *%rax
+}
+  800d26:	48 83 c4 10          	add    $0x10,%rsp
+  800d2a:	5b                   	pop    %rbx
+  800d2b:	41 5c                	pop    %r12
+  800d2d:	41 5d                	pop    %r13
+  800d2f:	41 5e                	pop    %r14
+  800d31:	5d                   	pop    %rbp
+  800d32:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d33:	48 98                	cltq
+  800d35:	eb ef                	jmp    800d26 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d37:	48 98                	cltq
+  800d39:	eb eb                	jmp    800d26 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800d3b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d42:	00 00 00 
+  800d45:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800d4b:	89 da                	mov    %ebx,%edx
+  800d4d:	48 bf b5 2b 80 00 00 	movabs $0x802bb5,%rdi
+  800d54:	00 00 00 
+  800d57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d5c:	48 b9 44 1c 80 00 00 	movabs $0x801c44,%rcx
+  800d63:	00 00 00 
+  800d66:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d68:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800d6f:	eb b5                	jmp    800d26 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d71:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800d78:	eb ac                	jmp    800d26 <write+0x65>
+
+0000000000800d7a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800d7a:	55                   	push   %rbp
+  800d7b:	48 89 e5             	mov    %rsp,%rbp
+  800d7e:	53                   	push   %rbx
+  800d7f:	48 83 ec 18          	sub    $0x18,%rsp
+  800d83:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d85:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d89:	48 b8 af 08 80 00 00 	movabs $0x8008af,%rax
+  800d90:	00 00 00 
+  800d93:	ff d0                	call   *%rax
+  800d95:	85 c0                	test   %eax,%eax
+  800d97:	78 0c                	js     800da5 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800d99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d9d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800da0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800da5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800da9:	c9                   	leave
+  800daa:	c3                   	ret
+
+0000000000800dab <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800dab:	55                   	push   %rbp
+  800dac:	48 89 e5             	mov    %rsp,%rbp
+  800daf:	41 55                	push   %r13
+  800db1:	41 54                	push   %r12
+  800db3:	53                   	push   %rbx
+  800db4:	48 83 ec 18          	sub    $0x18,%rsp
+  800db8:	89 fb                	mov    %edi,%ebx
+  800dba:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800dbd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800dc1:	48 b8 af 08 80 00 00 	movabs $0x8008af,%rax
+  800dc8:	00 00 00 
+  800dcb:	ff d0                	call   *%rax
+  800dcd:	85 c0                	test   %eax,%eax
+  800dcf:	78 38                	js     800e09 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800dd1:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800dd5:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800dd9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ddd:	48 b8 fa 08 80 00 00 	movabs $0x8008fa,%rax
+  800de4:	00 00 00 
+  800de7:	ff d0                	call   *%rax
+  800de9:	85 c0                	test   %eax,%eax
+  800deb:	78 1c                	js     800e09 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800ded:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800df2:	74 20                	je     800e14 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800df4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800df8:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800dfc:	48 85 c0             	test   %rax,%rax
+  800dff:	74 47                	je     800e48 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800e01:	44 89 e6             	mov    %r12d,%esi
+  800e04:	4c 89 ef             	mov    %r13,%rdi
+  800e07:	ff d0                	call   *%rax
+}
+  800e09:	48 83 c4 18          	add    $0x18,%rsp
+  800e0d:	5b                   	pop    %rbx
+  800e0e:	41 5c                	pop    %r12
+  800e10:	41 5d                	pop    %r13
+  800e12:	5d                   	pop    %rbp
+  800e13:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800e14:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800e1b:	00 00 00 
+  800e1e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800e24:	89 da                	mov    %ebx,%edx
+  800e26:	48 bf 78 2b 80 00 00 	movabs $0x802b78,%rdi
+  800e2d:	00 00 00 
+  800e30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e35:	48 b9 44 1c 80 00 00 	movabs $0x801c44,%rcx
+  800e3c:	00 00 00 
+  800e3f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e41:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e46:	eb c1                	jmp    800e09 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800e48:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e4d:	eb ba                	jmp    800e09 <ftruncate+0x5e>
+
+0000000000800e4f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800e4f:	55                   	push   %rbp
+  800e50:	48 89 e5             	mov    %rsp,%rbp
+  800e53:	41 54                	push   %r12
+  800e55:	53                   	push   %rbx
+  800e56:	48 83 ec 10          	sub    $0x10,%rsp
+  800e5a:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e5d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e61:	48 b8 af 08 80 00 00 	movabs $0x8008af,%rax
+  800e68:	00 00 00 
+  800e6b:	ff d0                	call   *%rax
+  800e6d:	85 c0                	test   %eax,%eax
+  800e6f:	78 4e                	js     800ebf <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e71:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800e75:	41 8b 3c 24          	mov    (%r12),%edi
+  800e79:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800e7d:	48 b8 fa 08 80 00 00 	movabs $0x8008fa,%rax
+  800e84:	00 00 00 
+  800e87:	ff d0                	call   *%rax
+  800e89:	85 c0                	test   %eax,%eax
+  800e8b:	78 32                	js     800ebf <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800e8d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e91:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800e96:	74 30                	je     800ec8 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800e98:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800e9b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800ea2:	00 00 00 
+    stat->st_isdir = 0;
+  800ea5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800eac:	00 00 00 
+    stat->st_dev = dev;
+  800eaf:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800eb6:	48 89 de             	mov    %rbx,%rsi
+  800eb9:	4c 89 e7             	mov    %r12,%rdi
+  800ebc:	ff 50 28             	call   *0x28(%rax)
+}
+  800ebf:	48 83 c4 10          	add    $0x10,%rsp
+  800ec3:	5b                   	pop    %rbx
+  800ec4:	41 5c                	pop    %r12
+  800ec6:	5d                   	pop    %rbp
+  800ec7:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800ec8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ecd:	eb f0                	jmp    800ebf <fstat+0x70>
+
+0000000000800ecf <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800ecf:	55                   	push   %rbp
+  800ed0:	48 89 e5             	mov    %rsp,%rbp
+  800ed3:	41 54                	push   %r12
+  800ed5:	53                   	push   %rbx
+  800ed6:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800ed9:	be 00 00 00 00       	mov    $0x0,%esi
+  800ede:	48 b8 50 11 80 00 00 	movabs $0x801150,%rax
+  800ee5:	00 00 00 
+  800ee8:	ff d0                	call   *%rax
+  800eea:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800eec:	85 c0                	test   %eax,%eax
+  800eee:	78 25                	js     800f15 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800ef0:	4c 89 e6             	mov    %r12,%rsi
+  800ef3:	89 c7                	mov    %eax,%edi
+  800ef5:	48 b8 4f 0e 80 00 00 	movabs $0x800e4f,%rax
+  800efc:	00 00 00 
+  800eff:	ff d0                	call   *%rax
+  800f01:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800f04:	89 df                	mov    %ebx,%edi
+  800f06:	48 b8 14 0a 80 00 00 	movabs $0x800a14,%rax
+  800f0d:	00 00 00 
+  800f10:	ff d0                	call   *%rax
+
+    return res;
+  800f12:	44 89 e3             	mov    %r12d,%ebx
+}
+  800f15:	89 d8                	mov    %ebx,%eax
+  800f17:	5b                   	pop    %rbx
+  800f18:	41 5c                	pop    %r12
+  800f1a:	5d                   	pop    %rbp
+  800f1b:	c3                   	ret
+
+0000000000800f1c <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800f1c:	55                   	push   %rbp
+  800f1d:	48 89 e5             	mov    %rsp,%rbp
+  800f20:	41 54                	push   %r12
+  800f22:	53                   	push   %rbx
+  800f23:	48 83 ec 10          	sub    $0x10,%rsp
+  800f27:	41 89 fc             	mov    %edi,%r12d
+  800f2a:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f2d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f34:	00 00 00 
+  800f37:	83 38 00             	cmpl   $0x0,(%rax)
+  800f3a:	74 5e                	je     800f9a <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800f3c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800f42:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800f47:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800f4e:	00 00 00 
+  800f51:	44 89 e6             	mov    %r12d,%esi
+  800f54:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f5b:	00 00 00 
+  800f5e:	8b 38                	mov    (%rax),%edi
+  800f60:	48 b8 25 2a 80 00 00 	movabs $0x802a25,%rax
+  800f67:	00 00 00 
+  800f6a:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800f6c:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800f73:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800f74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f79:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800f7d:	48 89 de             	mov    %rbx,%rsi
+  800f80:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f85:	48 b8 90 29 80 00 00 	movabs $0x802990,%rax
+  800f8c:	00 00 00 
+  800f8f:	ff d0                	call   *%rax
+}
+  800f91:	48 83 c4 10          	add    $0x10,%rsp
+  800f95:	5b                   	pop    %rbx
+  800f96:	41 5c                	pop    %r12
+  800f98:	5d                   	pop    %rbp
+  800f99:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f9a:	bf 03 00 00 00       	mov    $0x3,%edi
+  800f9f:	48 b8 c5 2a 80 00 00 	movabs $0x802ac5,%rax
+  800fa6:	00 00 00 
+  800fa9:	ff d0                	call   *%rax
+  800fab:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800fb2:	00 00 
+  800fb4:	eb 86                	jmp    800f3c <fsipc+0x20>
+
+0000000000800fb6 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800fb6:	55                   	push   %rbp
+  800fb7:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800fba:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800fc1:	00 00 00 
+  800fc4:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800fc7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800fc9:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800fcc:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd1:	bf 02 00 00 00       	mov    $0x2,%edi
+  800fd6:	48 b8 1c 0f 80 00 00 	movabs $0x800f1c,%rax
+  800fdd:	00 00 00 
+  800fe0:	ff d0                	call   *%rax
+}
+  800fe2:	5d                   	pop    %rbp
+  800fe3:	c3                   	ret
+
+0000000000800fe4 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800fe4:	55                   	push   %rbp
+  800fe5:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800fe8:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800feb:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800ff2:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  800ff4:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff9:	bf 06 00 00 00       	mov    $0x6,%edi
+  800ffe:	48 b8 1c 0f 80 00 00 	movabs $0x800f1c,%rax
+  801005:	00 00 00 
+  801008:	ff d0                	call   *%rax
+}
+  80100a:	5d                   	pop    %rbp
+  80100b:	c3                   	ret
+
+000000000080100c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80100c:	55                   	push   %rbp
+  80100d:	48 89 e5             	mov    %rsp,%rbp
+  801010:	41 54                	push   %r12
+  801012:	53                   	push   %rbx
+  801013:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801016:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801019:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801020:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801022:	be 00 00 00 00       	mov    $0x0,%esi
+  801027:	bf 05 00 00 00       	mov    $0x5,%edi
+  80102c:	48 b8 1c 0f 80 00 00 	movabs $0x800f1c,%rax
+  801033:	00 00 00 
+  801036:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801038:	85 c0                	test   %eax,%eax
+  80103a:	78 3d                	js     801079 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80103c:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801043:	00 00 00 
+  801046:	4c 89 e6             	mov    %r12,%rsi
+  801049:	48 89 df             	mov    %rbx,%rdi
+  80104c:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  801053:	00 00 00 
+  801056:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801058:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80105f:	00 
+  801060:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801066:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80106d:	00 
+  80106e:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801074:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801079:	5b                   	pop    %rbx
+  80107a:	41 5c                	pop    %r12
+  80107c:	5d                   	pop    %rbp
+  80107d:	c3                   	ret
+
+000000000080107e <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80107e:	55                   	push   %rbp
+  80107f:	48 89 e5             	mov    %rsp,%rbp
+  801082:	41 54                	push   %r12
+  801084:	53                   	push   %rbx
+  801085:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  801088:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80108d:	48 39 c2             	cmp    %rax,%rdx
+  801090:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801094:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801097:	48 89 c2             	mov    %rax,%rdx
+  80109a:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8010a1:	00 00 00 
+  8010a4:	48 b8 ca 27 80 00 00 	movabs $0x8027ca,%rax
+  8010ab:	00 00 00 
+  8010ae:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8010b0:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8010b7:	00 00 00 
+  8010ba:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8010bf:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8010c1:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8010c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ca:	bf 04 00 00 00       	mov    $0x4,%edi
+  8010cf:	48 b8 1c 0f 80 00 00 	movabs $0x800f1c,%rax
+  8010d6:	00 00 00 
+  8010d9:	ff d0                	call   *%rax
+  8010db:	48 98                	cltq
+}
+  8010dd:	5b                   	pop    %rbx
+  8010de:	41 5c                	pop    %r12
+  8010e0:	5d                   	pop    %rbp
+  8010e1:	c3                   	ret
+
+00000000008010e2 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8010e2:	55                   	push   %rbp
+  8010e3:	48 89 e5             	mov    %rsp,%rbp
+  8010e6:	41 54                	push   %r12
+  8010e8:	53                   	push   %rbx
+  8010e9:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8010ec:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8010f3:	00 00 00 
+  8010f6:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8010f9:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8010fb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801100:	48 39 ca             	cmp    %rcx,%rdx
+  801103:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  801107:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  80110b:	be 00 00 00 00       	mov    $0x0,%esi
+  801110:	bf 03 00 00 00       	mov    $0x3,%edi
+  801115:	48 b8 1c 0f 80 00 00 	movabs $0x800f1c,%rax
+  80111c:	00 00 00 
+  80111f:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  801121:	85 c0                	test   %eax,%eax
+  801123:	78 27                	js     80114c <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  801125:	48 63 d8             	movslq %eax,%rbx
+  801128:	48 89 da             	mov    %rbx,%rdx
+  80112b:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801132:	00 00 00 
+  801135:	4c 89 e7             	mov    %r12,%rdi
+  801138:	48 b8 ca 27 80 00 00 	movabs $0x8027ca,%rax
+  80113f:	00 00 00 
+  801142:	ff d0                	call   *%rax
+    return bytes_read;
+  801144:	48 89 d8             	mov    %rbx,%rax
+}
+  801147:	5b                   	pop    %rbx
+  801148:	41 5c                	pop    %r12
+  80114a:	5d                   	pop    %rbp
+  80114b:	c3                   	ret
+        return bytes_read;
+  80114c:	48 98                	cltq
+  80114e:	eb f7                	jmp    801147 <devfile_read+0x65>
+
+0000000000801150 <open>:
+open(const char *path, int mode) {
+  801150:	55                   	push   %rbp
+  801151:	48 89 e5             	mov    %rsp,%rbp
+  801154:	41 55                	push   %r13
+  801156:	41 54                	push   %r12
+  801158:	53                   	push   %rbx
+  801159:	48 83 ec 18          	sub    $0x18,%rsp
+  80115d:	49 89 fc             	mov    %rdi,%r12
+  801160:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801163:	48 b8 2b 25 80 00 00 	movabs $0x80252b,%rax
+  80116a:	00 00 00 
+  80116d:	ff d0                	call   *%rax
+  80116f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801175:	0f 87 8a 00 00 00    	ja     801205 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80117b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80117f:	48 b8 4f 08 80 00 00 	movabs $0x80084f,%rax
+  801186:	00 00 00 
+  801189:	ff d0                	call   *%rax
+  80118b:	89 c3                	mov    %eax,%ebx
+  80118d:	85 c0                	test   %eax,%eax
+  80118f:	78 50                	js     8011e1 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801191:	4c 89 e6             	mov    %r12,%rsi
+  801194:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80119b:	00 00 00 
+  80119e:	48 89 df             	mov    %rbx,%rdi
+  8011a1:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  8011a8:	00 00 00 
+  8011ab:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011ad:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011b4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8011b8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011bd:	48 b8 1c 0f 80 00 00 	movabs $0x800f1c,%rax
+  8011c4:	00 00 00 
+  8011c7:	ff d0                	call   *%rax
+  8011c9:	89 c3                	mov    %eax,%ebx
+  8011cb:	85 c0                	test   %eax,%eax
+  8011cd:	78 1f                	js     8011ee <open+0x9e>
+    return fd2num(fd);
+  8011cf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8011d3:	48 b8 21 08 80 00 00 	movabs $0x800821,%rax
+  8011da:	00 00 00 
+  8011dd:	ff d0                	call   *%rax
+  8011df:	89 c3                	mov    %eax,%ebx
+}
+  8011e1:	89 d8                	mov    %ebx,%eax
+  8011e3:	48 83 c4 18          	add    $0x18,%rsp
+  8011e7:	5b                   	pop    %rbx
+  8011e8:	41 5c                	pop    %r12
+  8011ea:	41 5d                	pop    %r13
+  8011ec:	5d                   	pop    %rbp
+  8011ed:	c3                   	ret
+        fd_close(fd, 0);
+  8011ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8011f7:	48 b8 6a 09 80 00 00 	movabs $0x80096a,%rax
+  8011fe:	00 00 00 
+  801201:	ff d0                	call   *%rax
+        return res;
+  801203:	eb dc                	jmp    8011e1 <open+0x91>
+        return -E_BAD_PATH;
+  801205:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80120a:	eb d5                	jmp    8011e1 <open+0x91>
+
+000000000080120c <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80120c:	55                   	push   %rbp
+  80120d:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801210:	be 00 00 00 00       	mov    $0x0,%esi
+  801215:	bf 08 00 00 00       	mov    $0x8,%edi
+  80121a:	48 b8 1c 0f 80 00 00 	movabs $0x800f1c,%rax
+  801221:	00 00 00 
+  801224:	ff d0                	call   *%rax
+}
+  801226:	5d                   	pop    %rbp
+  801227:	c3                   	ret
+
+0000000000801228 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801228:	55                   	push   %rbp
+  801229:	48 89 e5             	mov    %rsp,%rbp
+  80122c:	41 54                	push   %r12
+  80122e:	53                   	push   %rbx
+  80122f:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801232:	48 b8 33 08 80 00 00 	movabs $0x800833,%rax
+  801239:	00 00 00 
+  80123c:	ff d0                	call   *%rax
+  80123e:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801241:	48 be 00 2c 80 00 00 	movabs $0x802c00,%rsi
+  801248:	00 00 00 
+  80124b:	48 89 df             	mov    %rbx,%rdi
+  80124e:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  801255:	00 00 00 
+  801258:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80125a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80125f:	41 2b 04 24          	sub    (%r12),%eax
+  801263:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801269:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801270:	00 00 00 
+    stat->st_dev = &devpipe;
+  801273:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80127a:	00 00 00 
+  80127d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801284:	b8 00 00 00 00       	mov    $0x0,%eax
+  801289:	5b                   	pop    %rbx
+  80128a:	41 5c                	pop    %r12
+  80128c:	5d                   	pop    %rbp
+  80128d:	c3                   	ret
+
+000000000080128e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80128e:	55                   	push   %rbp
+  80128f:	48 89 e5             	mov    %rsp,%rbp
+  801292:	41 54                	push   %r12
+  801294:	53                   	push   %rbx
+  801295:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801298:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80129d:	48 89 fe             	mov    %rdi,%rsi
+  8012a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012a5:	49 bc 4b 03 80 00 00 	movabs $0x80034b,%r12
+  8012ac:	00 00 00 
+  8012af:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012b2:	48 89 df             	mov    %rbx,%rdi
+  8012b5:	48 b8 33 08 80 00 00 	movabs $0x800833,%rax
+  8012bc:	00 00 00 
+  8012bf:	ff d0                	call   *%rax
+  8012c1:	48 89 c6             	mov    %rax,%rsi
+  8012c4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012ce:	41 ff d4             	call   *%r12
+}
+  8012d1:	5b                   	pop    %rbx
+  8012d2:	41 5c                	pop    %r12
+  8012d4:	5d                   	pop    %rbp
+  8012d5:	c3                   	ret
+
+00000000008012d6 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8012d6:	55                   	push   %rbp
+  8012d7:	48 89 e5             	mov    %rsp,%rbp
+  8012da:	41 57                	push   %r15
+  8012dc:	41 56                	push   %r14
+  8012de:	41 55                	push   %r13
+  8012e0:	41 54                	push   %r12
+  8012e2:	53                   	push   %rbx
+  8012e3:	48 83 ec 18          	sub    $0x18,%rsp
+  8012e7:	49 89 fc             	mov    %rdi,%r12
+  8012ea:	49 89 f5             	mov    %rsi,%r13
+  8012ed:	49 89 d7             	mov    %rdx,%r15
+  8012f0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8012f4:	48 b8 33 08 80 00 00 	movabs $0x800833,%rax
+  8012fb:	00 00 00 
+  8012fe:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801300:	4d 85 ff             	test   %r15,%r15
+  801303:	0f 84 af 00 00 00    	je     8013b8 <devpipe_write+0xe2>
+  801309:	48 89 c3             	mov    %rax,%rbx
+  80130c:	4c 89 f8             	mov    %r15,%rax
+  80130f:	4d 89 ef             	mov    %r13,%r15
+  801312:	4c 01 e8             	add    %r13,%rax
+  801315:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801319:	49 bd 53 02 80 00 00 	movabs $0x800253,%r13
+  801320:	00 00 00 
+            sys_yield();
+  801323:	49 be f0 01 80 00 00 	movabs $0x8001f0,%r14
+  80132a:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80132d:	8b 73 04             	mov    0x4(%rbx),%esi
+  801330:	48 63 ce             	movslq %esi,%rcx
+  801333:	48 63 03             	movslq (%rbx),%rax
+  801336:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80133c:	48 39 c1             	cmp    %rax,%rcx
+  80133f:	72 2e                	jb     80136f <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801341:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801346:	48 89 da             	mov    %rbx,%rdx
+  801349:	be 00 10 00 00       	mov    $0x1000,%esi
+  80134e:	4c 89 e7             	mov    %r12,%rdi
+  801351:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801354:	85 c0                	test   %eax,%eax
+  801356:	74 66                	je     8013be <devpipe_write+0xe8>
+            sys_yield();
+  801358:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80135b:	8b 73 04             	mov    0x4(%rbx),%esi
+  80135e:	48 63 ce             	movslq %esi,%rcx
+  801361:	48 63 03             	movslq (%rbx),%rax
+  801364:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80136a:	48 39 c1             	cmp    %rax,%rcx
+  80136d:	73 d2                	jae    801341 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80136f:	41 0f b6 3f          	movzbl (%r15),%edi
+  801373:	48 89 ca             	mov    %rcx,%rdx
+  801376:	48 c1 ea 03          	shr    $0x3,%rdx
+  80137a:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  801381:	08 10 20 
+  801384:	48 f7 e2             	mul    %rdx
+  801387:	48 c1 ea 06          	shr    $0x6,%rdx
+  80138b:	48 89 d0             	mov    %rdx,%rax
+  80138e:	48 c1 e0 09          	shl    $0x9,%rax
+  801392:	48 29 d0             	sub    %rdx,%rax
+  801395:	48 c1 e0 03          	shl    $0x3,%rax
+  801399:	48 29 c1             	sub    %rax,%rcx
+  80139c:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013a1:	83 c6 01             	add    $0x1,%esi
+  8013a4:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013a7:	49 83 c7 01          	add    $0x1,%r15
+  8013ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013af:	49 39 c7             	cmp    %rax,%r15
+  8013b2:	0f 85 75 ff ff ff    	jne    80132d <devpipe_write+0x57>
+    return n;
+  8013b8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8013bc:	eb 05                	jmp    8013c3 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8013be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013c3:	48 83 c4 18          	add    $0x18,%rsp
+  8013c7:	5b                   	pop    %rbx
+  8013c8:	41 5c                	pop    %r12
+  8013ca:	41 5d                	pop    %r13
+  8013cc:	41 5e                	pop    %r14
+  8013ce:	41 5f                	pop    %r15
+  8013d0:	5d                   	pop    %rbp
+  8013d1:	c3                   	ret
+
+00000000008013d2 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8013d2:	55                   	push   %rbp
+  8013d3:	48 89 e5             	mov    %rsp,%rbp
+  8013d6:	41 57                	push   %r15
+  8013d8:	41 56                	push   %r14
+  8013da:	41 55                	push   %r13
+  8013dc:	41 54                	push   %r12
+  8013de:	53                   	push   %rbx
+  8013df:	48 83 ec 18          	sub    $0x18,%rsp
+  8013e3:	49 89 fc             	mov    %rdi,%r12
+  8013e6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8013ea:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8013ee:	48 b8 33 08 80 00 00 	movabs $0x800833,%rax
+  8013f5:	00 00 00 
+  8013f8:	ff d0                	call   *%rax
+  8013fa:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8013fd:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801403:	49 bd 53 02 80 00 00 	movabs $0x800253,%r13
+  80140a:	00 00 00 
+            sys_yield();
+  80140d:	49 be f0 01 80 00 00 	movabs $0x8001f0,%r14
+  801414:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801417:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80141c:	74 7d                	je     80149b <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80141e:	8b 03                	mov    (%rbx),%eax
+  801420:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801423:	75 26                	jne    80144b <devpipe_read+0x79>
+            if (i > 0) return i;
+  801425:	4d 85 ff             	test   %r15,%r15
+  801428:	75 77                	jne    8014a1 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80142a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80142f:	48 89 da             	mov    %rbx,%rdx
+  801432:	be 00 10 00 00       	mov    $0x1000,%esi
+  801437:	4c 89 e7             	mov    %r12,%rdi
+  80143a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80143d:	85 c0                	test   %eax,%eax
+  80143f:	74 72                	je     8014b3 <devpipe_read+0xe1>
+            sys_yield();
+  801441:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801444:	8b 03                	mov    (%rbx),%eax
+  801446:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801449:	74 df                	je     80142a <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80144b:	48 63 c8             	movslq %eax,%rcx
+  80144e:	48 89 ca             	mov    %rcx,%rdx
+  801451:	48 c1 ea 03          	shr    $0x3,%rdx
+  801455:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80145c:	08 10 20 
+  80145f:	48 89 d0             	mov    %rdx,%rax
+  801462:	48 f7 e6             	mul    %rsi
+  801465:	48 c1 ea 06          	shr    $0x6,%rdx
+  801469:	48 89 d0             	mov    %rdx,%rax
+  80146c:	48 c1 e0 09          	shl    $0x9,%rax
+  801470:	48 29 d0             	sub    %rdx,%rax
+  801473:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80147a:	00 
+  80147b:	48 89 c8             	mov    %rcx,%rax
+  80147e:	48 29 d0             	sub    %rdx,%rax
+  801481:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801486:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80148a:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80148e:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801491:	49 83 c7 01          	add    $0x1,%r15
+  801495:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801499:	75 83                	jne    80141e <devpipe_read+0x4c>
+    return n;
+  80149b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80149f:	eb 03                	jmp    8014a4 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014a1:	4c 89 f8             	mov    %r15,%rax
+}
+  8014a4:	48 83 c4 18          	add    $0x18,%rsp
+  8014a8:	5b                   	pop    %rbx
+  8014a9:	41 5c                	pop    %r12
+  8014ab:	41 5d                	pop    %r13
+  8014ad:	41 5e                	pop    %r14
+  8014af:	41 5f                	pop    %r15
+  8014b1:	5d                   	pop    %rbp
+  8014b2:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b8:	eb ea                	jmp    8014a4 <devpipe_read+0xd2>
+
+00000000008014ba <pipe>:
+pipe(int pfd[2]) {
+  8014ba:	55                   	push   %rbp
+  8014bb:	48 89 e5             	mov    %rsp,%rbp
+  8014be:	41 55                	push   %r13
+  8014c0:	41 54                	push   %r12
+  8014c2:	53                   	push   %rbx
+  8014c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8014c7:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8014ca:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8014ce:	48 b8 4f 08 80 00 00 	movabs $0x80084f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+  8014da:	89 c3                	mov    %eax,%ebx
+  8014dc:	85 c0                	test   %eax,%eax
+  8014de:	0f 88 a0 01 00 00    	js     801684 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8014e4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8014e9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8014ee:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8014f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014f7:	48 b8 7f 02 80 00 00 	movabs $0x80027f,%rax
+  8014fe:	00 00 00 
+  801501:	ff d0                	call   *%rax
+  801503:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801505:	85 c0                	test   %eax,%eax
+  801507:	0f 88 77 01 00 00    	js     801684 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80150d:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801511:	48 b8 4f 08 80 00 00 	movabs $0x80084f,%rax
+  801518:	00 00 00 
+  80151b:	ff d0                	call   *%rax
+  80151d:	89 c3                	mov    %eax,%ebx
+  80151f:	85 c0                	test   %eax,%eax
+  801521:	0f 88 43 01 00 00    	js     80166a <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801527:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80152c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801531:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801535:	bf 00 00 00 00       	mov    $0x0,%edi
+  80153a:	48 b8 7f 02 80 00 00 	movabs $0x80027f,%rax
+  801541:	00 00 00 
+  801544:	ff d0                	call   *%rax
+  801546:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801548:	85 c0                	test   %eax,%eax
+  80154a:	0f 88 1a 01 00 00    	js     80166a <pipe+0x1b0>
+    va = fd2data(fd0);
+  801550:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801554:	48 b8 33 08 80 00 00 	movabs $0x800833,%rax
+  80155b:	00 00 00 
+  80155e:	ff d0                	call   *%rax
+  801560:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801563:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801568:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80156d:	48 89 c6             	mov    %rax,%rsi
+  801570:	bf 00 00 00 00       	mov    $0x0,%edi
+  801575:	48 b8 7f 02 80 00 00 	movabs $0x80027f,%rax
+  80157c:	00 00 00 
+  80157f:	ff d0                	call   *%rax
+  801581:	89 c3                	mov    %eax,%ebx
+  801583:	85 c0                	test   %eax,%eax
+  801585:	0f 88 c5 00 00 00    	js     801650 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80158b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80158f:	48 b8 33 08 80 00 00 	movabs $0x800833,%rax
+  801596:	00 00 00 
+  801599:	ff d0                	call   *%rax
+  80159b:	48 89 c1             	mov    %rax,%rcx
+  80159e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8015a4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8015aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015af:	4c 89 ee             	mov    %r13,%rsi
+  8015b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015b7:	48 b8 e6 02 80 00 00 	movabs $0x8002e6,%rax
+  8015be:	00 00 00 
+  8015c1:	ff d0                	call   *%rax
+  8015c3:	89 c3                	mov    %eax,%ebx
+  8015c5:	85 c0                	test   %eax,%eax
+  8015c7:	78 6e                	js     801637 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8015c9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8015ce:	4c 89 ef             	mov    %r13,%rdi
+  8015d1:	48 b8 21 02 80 00 00 	movabs $0x800221,%rax
+  8015d8:	00 00 00 
+  8015db:	ff d0                	call   *%rax
+  8015dd:	83 f8 02             	cmp    $0x2,%eax
+  8015e0:	0f 85 ab 00 00 00    	jne    801691 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8015e6:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8015ed:	00 00 
+  8015ef:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8015f3:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8015f5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8015f9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801600:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801604:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801606:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80160a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801611:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801615:	48 bb 21 08 80 00 00 	movabs $0x800821,%rbx
+  80161c:	00 00 00 
+  80161f:	ff d3                	call   *%rbx
+  801621:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801625:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801629:	ff d3                	call   *%rbx
+  80162b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  801630:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801635:	eb 4d                	jmp    801684 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  801637:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80163c:	4c 89 ee             	mov    %r13,%rsi
+  80163f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801644:	48 b8 4b 03 80 00 00 	movabs $0x80034b,%rax
+  80164b:	00 00 00 
+  80164e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  801650:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801655:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801659:	bf 00 00 00 00       	mov    $0x0,%edi
+  80165e:	48 b8 4b 03 80 00 00 	movabs $0x80034b,%rax
+  801665:	00 00 00 
+  801668:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80166a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80166f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801673:	bf 00 00 00 00       	mov    $0x0,%edi
+  801678:	48 b8 4b 03 80 00 00 	movabs $0x80034b,%rax
+  80167f:	00 00 00 
+  801682:	ff d0                	call   *%rax
+}
+  801684:	89 d8                	mov    %ebx,%eax
+  801686:	48 83 c4 18          	add    $0x18,%rsp
+  80168a:	5b                   	pop    %rbx
+  80168b:	41 5c                	pop    %r12
+  80168d:	41 5d                	pop    %r13
+  80168f:	5d                   	pop    %rbp
+  801690:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801691:	48 b9 30 2c 80 00 00 	movabs $0x802c30,%rcx
+  801698:	00 00 00 
+  80169b:	48 ba 07 2c 80 00 00 	movabs $0x802c07,%rdx
+  8016a2:	00 00 00 
+  8016a5:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8016aa:	48 bf 1c 2c 80 00 00 	movabs $0x802c1c,%rdi
+  8016b1:	00 00 00 
+  8016b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b9:	49 b8 f4 1a 80 00 00 	movabs $0x801af4,%r8
+  8016c0:	00 00 00 
+  8016c3:	41 ff d0             	call   *%r8
+
+00000000008016c6 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8016c6:	55                   	push   %rbp
+  8016c7:	48 89 e5             	mov    %rsp,%rbp
+  8016ca:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8016ce:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8016d2:	48 b8 af 08 80 00 00 	movabs $0x8008af,%rax
+  8016d9:	00 00 00 
+  8016dc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8016de:	85 c0                	test   %eax,%eax
+  8016e0:	78 35                	js     801717 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8016e2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8016e6:	48 b8 33 08 80 00 00 	movabs $0x800833,%rax
+  8016ed:	00 00 00 
+  8016f0:	ff d0                	call   *%rax
+  8016f2:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8016f5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8016fa:	be 00 10 00 00       	mov    $0x1000,%esi
+  8016ff:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801703:	48 b8 53 02 80 00 00 	movabs $0x800253,%rax
+  80170a:	00 00 00 
+  80170d:	ff d0                	call   *%rax
+  80170f:	85 c0                	test   %eax,%eax
+  801711:	0f 94 c0             	sete   %al
+  801714:	0f b6 c0             	movzbl %al,%eax
+}
+  801717:	c9                   	leave
+  801718:	c3                   	ret
+
+0000000000801719 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801719:	48 89 f8             	mov    %rdi,%rax
+  80171c:	48 c1 e8 27          	shr    $0x27,%rax
+  801720:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801727:	01 00 00 
+  80172a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80172e:	f6 c2 01             	test   $0x1,%dl
+  801731:	74 6d                	je     8017a0 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801733:	48 89 f8             	mov    %rdi,%rax
+  801736:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80173a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801741:	01 00 00 
+  801744:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801748:	f6 c2 01             	test   $0x1,%dl
+  80174b:	74 62                	je     8017af <get_uvpt_entry+0x96>
+  80174d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801754:	01 00 00 
+  801757:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80175b:	f6 c2 80             	test   $0x80,%dl
+  80175e:	75 4f                	jne    8017af <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801760:	48 89 f8             	mov    %rdi,%rax
+  801763:	48 c1 e8 15          	shr    $0x15,%rax
+  801767:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80176e:	01 00 00 
+  801771:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801775:	f6 c2 01             	test   $0x1,%dl
+  801778:	74 44                	je     8017be <get_uvpt_entry+0xa5>
+  80177a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801781:	01 00 00 
+  801784:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801788:	f6 c2 80             	test   $0x80,%dl
+  80178b:	75 31                	jne    8017be <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80178d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  801791:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801798:	01 00 00 
+  80179b:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80179f:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017a0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017a7:	01 00 00 
+  8017aa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017ae:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017af:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017b6:	01 00 00 
+  8017b9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017bd:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017be:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017c5:	01 00 00 
+  8017c8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017cc:	c3                   	ret
+
+00000000008017cd <get_prot>:
+
+int
+get_prot(void *va) {
+  8017cd:	55                   	push   %rbp
+  8017ce:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8017d1:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  8017d8:	00 00 00 
+  8017db:	ff d0                	call   *%rax
+  8017dd:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8017e0:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8017e5:	89 c1                	mov    %eax,%ecx
+  8017e7:	83 c9 04             	or     $0x4,%ecx
+  8017ea:	f6 c2 01             	test   $0x1,%dl
+  8017ed:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8017f0:	89 c1                	mov    %eax,%ecx
+  8017f2:	83 c9 02             	or     $0x2,%ecx
+  8017f5:	f6 c2 02             	test   $0x2,%dl
+  8017f8:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8017fb:	89 c1                	mov    %eax,%ecx
+  8017fd:	83 c9 01             	or     $0x1,%ecx
+  801800:	48 85 d2             	test   %rdx,%rdx
+  801803:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801806:	89 c1                	mov    %eax,%ecx
+  801808:	83 c9 40             	or     $0x40,%ecx
+  80180b:	f6 c6 04             	test   $0x4,%dh
+  80180e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  801811:	5d                   	pop    %rbp
+  801812:	c3                   	ret
+
+0000000000801813 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  801813:	55                   	push   %rbp
+  801814:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801817:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  80181e:	00 00 00 
+  801821:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  801823:	48 c1 e8 06          	shr    $0x6,%rax
+  801827:	83 e0 01             	and    $0x1,%eax
+}
+  80182a:	5d                   	pop    %rbp
+  80182b:	c3                   	ret
+
+000000000080182c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80182c:	55                   	push   %rbp
+  80182d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  801830:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  801837:	00 00 00 
+  80183a:	ff d0                	call   *%rax
+  80183c:	83 e0 01             	and    $0x1,%eax
+}
+  80183f:	5d                   	pop    %rbp
+  801840:	c3                   	ret
+
+0000000000801841 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  801841:	55                   	push   %rbp
+  801842:	48 89 e5             	mov    %rsp,%rbp
+  801845:	41 57                	push   %r15
+  801847:	41 56                	push   %r14
+  801849:	41 55                	push   %r13
+  80184b:	41 54                	push   %r12
+  80184d:	53                   	push   %rbx
+  80184e:	48 83 ec 18          	sub    $0x18,%rsp
+  801852:	49 89 ff             	mov    %rdi,%r15
+  801855:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  801859:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  80185e:	49 bc 2c 18 80 00 00 	movabs $0x80182c,%r12
+  801865:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  801868:	49 be cd 17 80 00 00 	movabs $0x8017cd,%r14
+  80186f:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  801872:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  801879:	00 00 00 
+  80187c:	eb 0c                	jmp    80188a <foreach_shared_region+0x49>
+  80187e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801885:	4c 39 eb             	cmp    %r13,%rbx
+  801888:	74 38                	je     8018c2 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  80188a:	48 89 df             	mov    %rbx,%rdi
+  80188d:	41 ff d4             	call   *%r12
+  801890:	84 c0                	test   %al,%al
+  801892:	74 ea                	je     80187e <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  801894:	48 89 df             	mov    %rbx,%rdi
+  801897:	41 ff d6             	call   *%r14
+  80189a:	a8 40                	test   $0x40,%al
+  80189c:	74 e0                	je     80187e <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  80189e:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8018a5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8018a9:	48 89 df             	mov    %rbx,%rdi
+  8018ac:	41 ff d7             	call   *%r15
+        if (err)
+  8018af:	85 c0                	test   %eax,%eax
+  8018b1:	74 cb                	je     80187e <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8018b3:	48 83 c4 18          	add    $0x18,%rsp
+  8018b7:	5b                   	pop    %rbx
+  8018b8:	41 5c                	pop    %r12
+  8018ba:	41 5d                	pop    %r13
+  8018bc:	41 5e                	pop    %r14
+  8018be:	41 5f                	pop    %r15
+  8018c0:	5d                   	pop    %rbp
+  8018c1:	c3                   	ret
+    return 0;
+  8018c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c7:	eb ea                	jmp    8018b3 <foreach_shared_region+0x72>
+
+00000000008018c9 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8018c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ce:	c3                   	ret
+
+00000000008018cf <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8018cf:	55                   	push   %rbp
+  8018d0:	48 89 e5             	mov    %rsp,%rbp
+  8018d3:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8018d6:	48 be 54 2c 80 00 00 	movabs $0x802c54,%rsi
+  8018dd:	00 00 00 
+  8018e0:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  8018e7:	00 00 00 
+  8018ea:	ff d0                	call   *%rax
+    return 0;
+}
+  8018ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f1:	5d                   	pop    %rbp
+  8018f2:	c3                   	ret
+
+00000000008018f3 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8018f3:	55                   	push   %rbp
+  8018f4:	48 89 e5             	mov    %rsp,%rbp
+  8018f7:	41 57                	push   %r15
+  8018f9:	41 56                	push   %r14
+  8018fb:	41 55                	push   %r13
+  8018fd:	41 54                	push   %r12
+  8018ff:	53                   	push   %rbx
+  801900:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801907:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80190e:	48 85 d2             	test   %rdx,%rdx
+  801911:	74 7a                	je     80198d <devcons_write+0x9a>
+  801913:	49 89 d6             	mov    %rdx,%r14
+  801916:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80191c:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801921:	49 bf 63 27 80 00 00 	movabs $0x802763,%r15
+  801928:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80192b:	4c 89 f3             	mov    %r14,%rbx
+  80192e:	48 29 f3             	sub    %rsi,%rbx
+  801931:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801936:	48 39 c3             	cmp    %rax,%rbx
+  801939:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80193d:	4c 63 eb             	movslq %ebx,%r13
+  801940:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801947:	48 01 c6             	add    %rax,%rsi
+  80194a:	4c 89 ea             	mov    %r13,%rdx
+  80194d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801954:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801957:	4c 89 ee             	mov    %r13,%rsi
+  80195a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801961:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  801968:	00 00 00 
+  80196b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80196d:	41 01 dc             	add    %ebx,%r12d
+  801970:	49 63 f4             	movslq %r12d,%rsi
+  801973:	4c 39 f6             	cmp    %r14,%rsi
+  801976:	72 b3                	jb     80192b <devcons_write+0x38>
+    return res;
+  801978:	49 63 c4             	movslq %r12d,%rax
+}
+  80197b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801982:	5b                   	pop    %rbx
+  801983:	41 5c                	pop    %r12
+  801985:	41 5d                	pop    %r13
+  801987:	41 5e                	pop    %r14
+  801989:	41 5f                	pop    %r15
+  80198b:	5d                   	pop    %rbp
+  80198c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80198d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801993:	eb e3                	jmp    801978 <devcons_write+0x85>
+
+0000000000801995 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801995:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801998:	ba 00 00 00 00       	mov    $0x0,%edx
+  80199d:	48 85 c0             	test   %rax,%rax
+  8019a0:	74 55                	je     8019f7 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8019a2:	55                   	push   %rbp
+  8019a3:	48 89 e5             	mov    %rsp,%rbp
+  8019a6:	41 55                	push   %r13
+  8019a8:	41 54                	push   %r12
+  8019aa:	53                   	push   %rbx
+  8019ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8019af:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8019b2:	48 bb 23 01 80 00 00 	movabs $0x800123,%rbx
+  8019b9:	00 00 00 
+  8019bc:	49 bc f0 01 80 00 00 	movabs $0x8001f0,%r12
+  8019c3:	00 00 00 
+  8019c6:	eb 03                	jmp    8019cb <devcons_read+0x36>
+  8019c8:	41 ff d4             	call   *%r12
+  8019cb:	ff d3                	call   *%rbx
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	74 f7                	je     8019c8 <devcons_read+0x33>
+    if (c < 0) return c;
+  8019d1:	48 63 d0             	movslq %eax,%rdx
+  8019d4:	78 13                	js     8019e9 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8019d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019db:	83 f8 04             	cmp    $0x4,%eax
+  8019de:	74 09                	je     8019e9 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8019e0:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8019e4:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8019e9:	48 89 d0             	mov    %rdx,%rax
+  8019ec:	48 83 c4 08          	add    $0x8,%rsp
+  8019f0:	5b                   	pop    %rbx
+  8019f1:	41 5c                	pop    %r12
+  8019f3:	41 5d                	pop    %r13
+  8019f5:	5d                   	pop    %rbp
+  8019f6:	c3                   	ret
+  8019f7:	48 89 d0             	mov    %rdx,%rax
+  8019fa:	c3                   	ret
+
+00000000008019fb <cputchar>:
+cputchar(int ch) {
+  8019fb:	55                   	push   %rbp
+  8019fc:	48 89 e5             	mov    %rsp,%rbp
+  8019ff:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801a03:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801a07:	be 01 00 00 00       	mov    $0x1,%esi
+  801a0c:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801a10:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  801a17:	00 00 00 
+  801a1a:	ff d0                	call   *%rax
+}
+  801a1c:	c9                   	leave
+  801a1d:	c3                   	ret
+
+0000000000801a1e <getchar>:
+getchar(void) {
+  801a1e:	55                   	push   %rbp
+  801a1f:	48 89 e5             	mov    %rsp,%rbp
+  801a22:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801a26:	ba 01 00 00 00       	mov    $0x1,%edx
+  801a2b:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801a2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a34:	48 b8 92 0b 80 00 00 	movabs $0x800b92,%rax
+  801a3b:	00 00 00 
+  801a3e:	ff d0                	call   *%rax
+  801a40:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801a42:	85 c0                	test   %eax,%eax
+  801a44:	78 06                	js     801a4c <getchar+0x2e>
+  801a46:	74 08                	je     801a50 <getchar+0x32>
+  801a48:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801a4c:	89 d0                	mov    %edx,%eax
+  801a4e:	c9                   	leave
+  801a4f:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801a50:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801a55:	eb f5                	jmp    801a4c <getchar+0x2e>
+
+0000000000801a57 <iscons>:
+iscons(int fdnum) {
+  801a57:	55                   	push   %rbp
+  801a58:	48 89 e5             	mov    %rsp,%rbp
+  801a5b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801a5f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a63:	48 b8 af 08 80 00 00 	movabs $0x8008af,%rax
+  801a6a:	00 00 00 
+  801a6d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a6f:	85 c0                	test   %eax,%eax
+  801a71:	78 18                	js     801a8b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801a73:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a77:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801a7e:	00 00 00 
+  801a81:	8b 00                	mov    (%rax),%eax
+  801a83:	39 02                	cmp    %eax,(%rdx)
+  801a85:	0f 94 c0             	sete   %al
+  801a88:	0f b6 c0             	movzbl %al,%eax
+}
+  801a8b:	c9                   	leave
+  801a8c:	c3                   	ret
+
+0000000000801a8d <opencons>:
+opencons(void) {
+  801a8d:	55                   	push   %rbp
+  801a8e:	48 89 e5             	mov    %rsp,%rbp
+  801a91:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801a95:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801a99:	48 b8 4f 08 80 00 00 	movabs $0x80084f,%rax
+  801aa0:	00 00 00 
+  801aa3:	ff d0                	call   *%rax
+  801aa5:	85 c0                	test   %eax,%eax
+  801aa7:	78 49                	js     801af2 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801aa9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801aae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ab3:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801ab7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801abc:	48 b8 7f 02 80 00 00 	movabs $0x80027f,%rax
+  801ac3:	00 00 00 
+  801ac6:	ff d0                	call   *%rax
+  801ac8:	85 c0                	test   %eax,%eax
+  801aca:	78 26                	js     801af2 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801acc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ad0:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801ad7:	00 00 
+  801ad9:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801adb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801adf:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801ae6:	48 b8 21 08 80 00 00 	movabs $0x800821,%rax
+  801aed:	00 00 00 
+  801af0:	ff d0                	call   *%rax
+}
+  801af2:	c9                   	leave
+  801af3:	c3                   	ret
+
+0000000000801af4 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801af4:	55                   	push   %rbp
+  801af5:	48 89 e5             	mov    %rsp,%rbp
+  801af8:	41 56                	push   %r14
+  801afa:	41 55                	push   %r13
+  801afc:	41 54                	push   %r12
+  801afe:	53                   	push   %rbx
+  801aff:	48 83 ec 50          	sub    $0x50,%rsp
+  801b03:	49 89 fc             	mov    %rdi,%r12
+  801b06:	41 89 f5             	mov    %esi,%r13d
+  801b09:	48 89 d3             	mov    %rdx,%rbx
+  801b0c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b10:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801b14:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801b18:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801b1f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b23:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801b27:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801b2b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801b2f:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801b36:	00 00 00 
+  801b39:	4c 8b 30             	mov    (%rax),%r14
+  801b3c:	48 b8 bf 01 80 00 00 	movabs $0x8001bf,%rax
+  801b43:	00 00 00 
+  801b46:	ff d0                	call   *%rax
+  801b48:	89 c6                	mov    %eax,%esi
+  801b4a:	45 89 e8             	mov    %r13d,%r8d
+  801b4d:	4c 89 e1             	mov    %r12,%rcx
+  801b50:	4c 89 f2             	mov    %r14,%rdx
+  801b53:	48 bf 60 2c 80 00 00 	movabs $0x802c60,%rdi
+  801b5a:	00 00 00 
+  801b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b62:	49 bc 44 1c 80 00 00 	movabs $0x801c44,%r12
+  801b69:	00 00 00 
+  801b6c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801b6f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801b73:	48 89 df             	mov    %rbx,%rdi
+  801b76:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  801b7d:	00 00 00 
+  801b80:	ff d0                	call   *%rax
+    cprintf("\n");
+  801b82:	48 bf b3 2b 80 00 00 	movabs $0x802bb3,%rdi
+  801b89:	00 00 00 
+  801b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b91:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801b94:	cc                   	int3
+  801b95:	eb fd                	jmp    801b94 <_panic+0xa0>
+
+0000000000801b97 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801b97:	55                   	push   %rbp
+  801b98:	48 89 e5             	mov    %rsp,%rbp
+  801b9b:	53                   	push   %rbx
+  801b9c:	48 83 ec 08          	sub    $0x8,%rsp
+  801ba0:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801ba3:	8b 06                	mov    (%rsi),%eax
+  801ba5:	8d 50 01             	lea    0x1(%rax),%edx
+  801ba8:	89 16                	mov    %edx,(%rsi)
+  801baa:	48 98                	cltq
+  801bac:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801bb1:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801bb7:	74 0a                	je     801bc3 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801bb9:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801bbd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bc1:	c9                   	leave
+  801bc2:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801bc3:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801bc7:	be ff 00 00 00       	mov    $0xff,%esi
+  801bcc:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  801bd3:	00 00 00 
+  801bd6:	ff d0                	call   *%rax
+        state->offset = 0;
+  801bd8:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801bde:	eb d9                	jmp    801bb9 <putch+0x22>
+
+0000000000801be0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801be0:	55                   	push   %rbp
+  801be1:	48 89 e5             	mov    %rsp,%rbp
+  801be4:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801beb:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801bee:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801bf5:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801bfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bff:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801c02:	48 89 f1             	mov    %rsi,%rcx
+  801c05:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801c0c:	48 bf 97 1b 80 00 00 	movabs $0x801b97,%rdi
+  801c13:	00 00 00 
+  801c16:	48 b8 94 1d 80 00 00 	movabs $0x801d94,%rax
+  801c1d:	00 00 00 
+  801c20:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801c22:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801c29:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801c30:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  801c37:	00 00 00 
+  801c3a:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801c3c:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801c42:	c9                   	leave
+  801c43:	c3                   	ret
+
+0000000000801c44 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801c44:	55                   	push   %rbp
+  801c45:	48 89 e5             	mov    %rsp,%rbp
+  801c48:	48 83 ec 50          	sub    $0x50,%rsp
+  801c4c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801c50:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801c54:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c58:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801c5c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801c60:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801c67:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c6f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801c73:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801c77:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801c7b:	48 b8 e0 1b 80 00 00 	movabs $0x801be0,%rax
+  801c82:	00 00 00 
+  801c85:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801c87:	c9                   	leave
+  801c88:	c3                   	ret
+
+0000000000801c89 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801c89:	55                   	push   %rbp
+  801c8a:	48 89 e5             	mov    %rsp,%rbp
+  801c8d:	41 57                	push   %r15
+  801c8f:	41 56                	push   %r14
+  801c91:	41 55                	push   %r13
+  801c93:	41 54                	push   %r12
+  801c95:	53                   	push   %rbx
+  801c96:	48 83 ec 18          	sub    $0x18,%rsp
+  801c9a:	49 89 fc             	mov    %rdi,%r12
+  801c9d:	49 89 f5             	mov    %rsi,%r13
+  801ca0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ca4:	8b 45 10             	mov    0x10(%rbp),%eax
+  801ca7:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801caa:	41 89 cf             	mov    %ecx,%r15d
+  801cad:	4c 39 fa             	cmp    %r15,%rdx
+  801cb0:	73 5b                	jae    801d0d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801cb2:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801cb6:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801cba:	85 db                	test   %ebx,%ebx
+  801cbc:	7e 0e                	jle    801ccc <print_num+0x43>
+            putch(padc, put_arg);
+  801cbe:	4c 89 ee             	mov    %r13,%rsi
+  801cc1:	44 89 f7             	mov    %r14d,%edi
+  801cc4:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801cc7:	83 eb 01             	sub    $0x1,%ebx
+  801cca:	75 f2                	jne    801cbe <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801ccc:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801cd0:	48 b9 94 2c 80 00 00 	movabs $0x802c94,%rcx
+  801cd7:	00 00 00 
+  801cda:	48 b8 83 2c 80 00 00 	movabs $0x802c83,%rax
+  801ce1:	00 00 00 
+  801ce4:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801ce8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cec:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cf1:	49 f7 f7             	div    %r15
+  801cf4:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801cf8:	4c 89 ee             	mov    %r13,%rsi
+  801cfb:	41 ff d4             	call   *%r12
+}
+  801cfe:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801d02:	5b                   	pop    %rbx
+  801d03:	41 5c                	pop    %r12
+  801d05:	41 5d                	pop    %r13
+  801d07:	41 5e                	pop    %r14
+  801d09:	41 5f                	pop    %r15
+  801d0b:	5d                   	pop    %rbp
+  801d0c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801d0d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d11:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d16:	49 f7 f7             	div    %r15
+  801d19:	48 83 ec 08          	sub    $0x8,%rsp
+  801d1d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801d21:	52                   	push   %rdx
+  801d22:	45 0f be c9          	movsbl %r9b,%r9d
+  801d26:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801d2a:	48 89 c2             	mov    %rax,%rdx
+  801d2d:	48 b8 89 1c 80 00 00 	movabs $0x801c89,%rax
+  801d34:	00 00 00 
+  801d37:	ff d0                	call   *%rax
+  801d39:	48 83 c4 10          	add    $0x10,%rsp
+  801d3d:	eb 8d                	jmp    801ccc <print_num+0x43>
+
+0000000000801d3f <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801d3f:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801d43:	48 8b 06             	mov    (%rsi),%rax
+  801d46:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801d4a:	73 0a                	jae    801d56 <sprintputch+0x17>
+        *state->start++ = ch;
+  801d4c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d50:	48 89 16             	mov    %rdx,(%rsi)
+  801d53:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801d56:	c3                   	ret
+
+0000000000801d57 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801d57:	55                   	push   %rbp
+  801d58:	48 89 e5             	mov    %rsp,%rbp
+  801d5b:	48 83 ec 50          	sub    $0x50,%rsp
+  801d5f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d63:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d67:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801d6b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801d72:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d7a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801d7e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801d82:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801d86:	48 b8 94 1d 80 00 00 	movabs $0x801d94,%rax
+  801d8d:	00 00 00 
+  801d90:	ff d0                	call   *%rax
+}
+  801d92:	c9                   	leave
+  801d93:	c3                   	ret
+
+0000000000801d94 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801d94:	55                   	push   %rbp
+  801d95:	48 89 e5             	mov    %rsp,%rbp
+  801d98:	41 57                	push   %r15
+  801d9a:	41 56                	push   %r14
+  801d9c:	41 55                	push   %r13
+  801d9e:	41 54                	push   %r12
+  801da0:	53                   	push   %rbx
+  801da1:	48 83 ec 38          	sub    $0x38,%rsp
+  801da5:	49 89 fe             	mov    %rdi,%r14
+  801da8:	49 89 f5             	mov    %rsi,%r13
+  801dab:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801dae:	48 8b 01             	mov    (%rcx),%rax
+  801db1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801db5:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801db9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dbd:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801dc1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801dc5:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801dc9:	0f b6 3b             	movzbl (%rbx),%edi
+  801dcc:	40 80 ff 25          	cmp    $0x25,%dil
+  801dd0:	74 18                	je     801dea <vprintfmt+0x56>
+            if (!ch) return;
+  801dd2:	40 84 ff             	test   %dil,%dil
+  801dd5:	0f 84 b1 06 00 00    	je     80248c <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801ddb:	40 0f b6 ff          	movzbl %dil,%edi
+  801ddf:	4c 89 ee             	mov    %r13,%rsi
+  801de2:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801de5:	4c 89 e3             	mov    %r12,%rbx
+  801de8:	eb db                	jmp    801dc5 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801dea:	be 00 00 00 00       	mov    $0x0,%esi
+  801def:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801df3:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801df8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801dfe:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801e05:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e09:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801e0e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801e13:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801e16:	83 e8 23             	sub    $0x23,%eax
+  801e19:	3c 57                	cmp    $0x57,%al
+  801e1b:	0f 87 51 06 00 00    	ja     802472 <vprintfmt+0x6de>
+  801e21:	0f b6 c0             	movzbl %al,%eax
+  801e24:	48 b9 40 2e 80 00 00 	movabs $0x802e40,%rcx
+  801e2b:	00 00 00 
+  801e2e:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801e31:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801e34:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801e38:	eb cf                	jmp    801e09 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801e3a:	49 89 dc             	mov    %rbx,%r12
+  801e3d:	be 01 00 00 00       	mov    $0x1,%esi
+  801e42:	eb c5                	jmp    801e09 <vprintfmt+0x75>
+            padc = ch;
+  801e44:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801e48:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e4b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801e4e:	eb b9                	jmp    801e09 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e53:	83 f8 2f             	cmp    $0x2f,%eax
+  801e56:	77 24                	ja     801e7c <vprintfmt+0xe8>
+  801e58:	89 c1                	mov    %eax,%ecx
+  801e5a:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801e5e:	83 c0 08             	add    $0x8,%eax
+  801e61:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e64:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801e67:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801e6a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801e6e:	79 99                	jns    801e09 <vprintfmt+0x75>
+                width = precision;
+  801e70:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801e74:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e7a:	eb 8d                	jmp    801e09 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e7c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e80:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801e84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e88:	eb da                	jmp    801e64 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801e8a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801e8f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801e93:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801e99:	3c 39                	cmp    $0x39,%al
+  801e9b:	77 1c                	ja     801eb9 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801e9d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801ea1:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801ea5:	0f b6 c0             	movzbl %al,%eax
+  801ea8:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801ead:	0f b6 03             	movzbl (%rbx),%eax
+  801eb0:	3c 39                	cmp    $0x39,%al
+  801eb2:	76 e9                	jbe    801e9d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801eb4:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801eb7:	eb b1                	jmp    801e6a <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801eb9:	49 89 dc             	mov    %rbx,%r12
+  801ebc:	eb ac                	jmp    801e6a <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801ebe:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801ec1:	85 c9                	test   %ecx,%ecx
+  801ec3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec8:	0f 49 c1             	cmovns %ecx,%eax
+  801ecb:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801ece:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ed1:	e9 33 ff ff ff       	jmp    801e09 <vprintfmt+0x75>
+            lflag++;
+  801ed6:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ed9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801edc:	e9 28 ff ff ff       	jmp    801e09 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801ee1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ee4:	83 f8 2f             	cmp    $0x2f,%eax
+  801ee7:	77 19                	ja     801f02 <vprintfmt+0x16e>
+  801ee9:	89 c2                	mov    %eax,%edx
+  801eeb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801eef:	83 c0 08             	add    $0x8,%eax
+  801ef2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ef5:	8b 3a                	mov    (%rdx),%edi
+  801ef7:	4c 89 ee             	mov    %r13,%rsi
+  801efa:	41 ff d6             	call   *%r14
+            break;
+  801efd:	e9 c3 fe ff ff       	jmp    801dc5 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  801f02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f0e:	eb e5                	jmp    801ef5 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  801f10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f13:	83 f8 2f             	cmp    $0x2f,%eax
+  801f16:	77 5a                	ja     801f72 <vprintfmt+0x1de>
+  801f18:	89 c2                	mov    %eax,%edx
+  801f1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f1e:	83 c0 08             	add    $0x8,%eax
+  801f21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801f24:	8b 02                	mov    (%rdx),%eax
+  801f26:	89 c1                	mov    %eax,%ecx
+  801f28:	f7 d9                	neg    %ecx
+  801f2a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801f2d:	83 f9 15             	cmp    $0x15,%ecx
+  801f30:	7f 4e                	jg     801f80 <vprintfmt+0x1ec>
+  801f32:	48 63 c1             	movslq %ecx,%rax
+  801f35:	48 ba 00 31 80 00 00 	movabs $0x803100,%rdx
+  801f3c:	00 00 00 
+  801f3f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801f43:	48 85 c0             	test   %rax,%rax
+  801f46:	74 38                	je     801f80 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801f48:	48 89 c1             	mov    %rax,%rcx
+  801f4b:	48 ba 19 2c 80 00 00 	movabs $0x802c19,%rdx
+  801f52:	00 00 00 
+  801f55:	4c 89 ee             	mov    %r13,%rsi
+  801f58:	4c 89 f7             	mov    %r14,%rdi
+  801f5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f60:	49 b8 57 1d 80 00 00 	movabs $0x801d57,%r8
+  801f67:	00 00 00 
+  801f6a:	41 ff d0             	call   *%r8
+  801f6d:	e9 53 fe ff ff       	jmp    801dc5 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801f72:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f76:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f7e:	eb a4                	jmp    801f24 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801f80:	48 ba ac 2c 80 00 00 	movabs $0x802cac,%rdx
+  801f87:	00 00 00 
+  801f8a:	4c 89 ee             	mov    %r13,%rsi
+  801f8d:	4c 89 f7             	mov    %r14,%rdi
+  801f90:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f95:	49 b8 57 1d 80 00 00 	movabs $0x801d57,%r8
+  801f9c:	00 00 00 
+  801f9f:	41 ff d0             	call   *%r8
+  801fa2:	e9 1e fe ff ff       	jmp    801dc5 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801fa7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801faa:	83 f8 2f             	cmp    $0x2f,%eax
+  801fad:	77 6c                	ja     80201b <vprintfmt+0x287>
+  801faf:	89 c2                	mov    %eax,%edx
+  801fb1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fb5:	83 c0 08             	add    $0x8,%eax
+  801fb8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fbb:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801fbe:	48 85 d2             	test   %rdx,%rdx
+  801fc1:	48 b8 a5 2c 80 00 00 	movabs $0x802ca5,%rax
+  801fc8:	00 00 00 
+  801fcb:	48 0f 45 c2          	cmovne %rdx,%rax
+  801fcf:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801fd3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801fd7:	7e 06                	jle    801fdf <vprintfmt+0x24b>
+  801fd9:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801fdd:	75 4a                	jne    802029 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801fdf:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801fe3:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801fe7:	0f b6 00             	movzbl (%rax),%eax
+  801fea:	84 c0                	test   %al,%al
+  801fec:	0f 85 9a 00 00 00    	jne    80208c <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  801ff2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ff5:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801ff9:	85 c0                	test   %eax,%eax
+  801ffb:	0f 8e c4 fd ff ff    	jle    801dc5 <vprintfmt+0x31>
+  802001:	4c 89 ee             	mov    %r13,%rsi
+  802004:	bf 20 00 00 00       	mov    $0x20,%edi
+  802009:	41 ff d6             	call   *%r14
+  80200c:	41 83 ec 01          	sub    $0x1,%r12d
+  802010:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802014:	75 eb                	jne    802001 <vprintfmt+0x26d>
+  802016:	e9 aa fd ff ff       	jmp    801dc5 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80201b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80201f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802023:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802027:	eb 92                	jmp    801fbb <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802029:	49 63 f7             	movslq %r15d,%rsi
+  80202c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802030:	48 b8 46 25 80 00 00 	movabs $0x802546,%rax
+  802037:	00 00 00 
+  80203a:	ff d0                	call   *%rax
+  80203c:	48 89 c2             	mov    %rax,%rdx
+  80203f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802042:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802044:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802047:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80204a:	85 c0                	test   %eax,%eax
+  80204c:	7e 91                	jle    801fdf <vprintfmt+0x24b>
+  80204e:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802053:	4c 89 ee             	mov    %r13,%rsi
+  802056:	44 89 e7             	mov    %r12d,%edi
+  802059:	41 ff d6             	call   *%r14
+  80205c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802060:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802063:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802066:	75 eb                	jne    802053 <vprintfmt+0x2bf>
+  802068:	e9 72 ff ff ff       	jmp    801fdf <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80206d:	0f b6 f8             	movzbl %al,%edi
+  802070:	4c 89 ee             	mov    %r13,%rsi
+  802073:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802076:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80207a:	49 83 c4 01          	add    $0x1,%r12
+  80207e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802084:	84 c0                	test   %al,%al
+  802086:	0f 84 66 ff ff ff    	je     801ff2 <vprintfmt+0x25e>
+  80208c:	45 85 ff             	test   %r15d,%r15d
+  80208f:	78 0a                	js     80209b <vprintfmt+0x307>
+  802091:	41 83 ef 01          	sub    $0x1,%r15d
+  802095:	0f 88 57 ff ff ff    	js     801ff2 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80209b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80209f:	74 cc                	je     80206d <vprintfmt+0x2d9>
+  8020a1:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8020a4:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8020a9:	80 fa 5e             	cmp    $0x5e,%dl
+  8020ac:	77 c2                	ja     802070 <vprintfmt+0x2dc>
+  8020ae:	eb bd                	jmp    80206d <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8020b0:	40 84 f6             	test   %sil,%sil
+  8020b3:	75 26                	jne    8020db <vprintfmt+0x347>
+    switch (lflag) {
+  8020b5:	85 d2                	test   %edx,%edx
+  8020b7:	74 59                	je     802112 <vprintfmt+0x37e>
+  8020b9:	83 fa 01             	cmp    $0x1,%edx
+  8020bc:	74 7b                	je     802139 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8020be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8020c4:	0f 87 96 00 00 00    	ja     802160 <vprintfmt+0x3cc>
+  8020ca:	89 c2                	mov    %eax,%edx
+  8020cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020d0:	83 c0 08             	add    $0x8,%eax
+  8020d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020d6:	4c 8b 22             	mov    (%rdx),%r12
+  8020d9:	eb 17                	jmp    8020f2 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8020db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020de:	83 f8 2f             	cmp    $0x2f,%eax
+  8020e1:	77 21                	ja     802104 <vprintfmt+0x370>
+  8020e3:	89 c2                	mov    %eax,%edx
+  8020e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020e9:	83 c0 08             	add    $0x8,%eax
+  8020ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020ef:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8020f2:	4d 85 e4             	test   %r12,%r12
+  8020f5:	78 7a                	js     802171 <vprintfmt+0x3dd>
+            num = i;
+  8020f7:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8020fa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8020ff:	e9 50 02 00 00       	jmp    802354 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802104:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802108:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80210c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802110:	eb dd                	jmp    8020ef <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802112:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802115:	83 f8 2f             	cmp    $0x2f,%eax
+  802118:	77 11                	ja     80212b <vprintfmt+0x397>
+  80211a:	89 c2                	mov    %eax,%edx
+  80211c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802120:	83 c0 08             	add    $0x8,%eax
+  802123:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802126:	4c 63 22             	movslq (%rdx),%r12
+  802129:	eb c7                	jmp    8020f2 <vprintfmt+0x35e>
+  80212b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80212f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802133:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802137:	eb ed                	jmp    802126 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802139:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80213c:	83 f8 2f             	cmp    $0x2f,%eax
+  80213f:	77 11                	ja     802152 <vprintfmt+0x3be>
+  802141:	89 c2                	mov    %eax,%edx
+  802143:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802147:	83 c0 08             	add    $0x8,%eax
+  80214a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80214d:	4c 8b 22             	mov    (%rdx),%r12
+  802150:	eb a0                	jmp    8020f2 <vprintfmt+0x35e>
+  802152:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802156:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80215a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80215e:	eb ed                	jmp    80214d <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802160:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802164:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802168:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80216c:	e9 65 ff ff ff       	jmp    8020d6 <vprintfmt+0x342>
+                putch('-', put_arg);
+  802171:	4c 89 ee             	mov    %r13,%rsi
+  802174:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802179:	41 ff d6             	call   *%r14
+                i = -i;
+  80217c:	49 f7 dc             	neg    %r12
+  80217f:	e9 73 ff ff ff       	jmp    8020f7 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802184:	40 84 f6             	test   %sil,%sil
+  802187:	75 32                	jne    8021bb <vprintfmt+0x427>
+    switch (lflag) {
+  802189:	85 d2                	test   %edx,%edx
+  80218b:	74 5d                	je     8021ea <vprintfmt+0x456>
+  80218d:	83 fa 01             	cmp    $0x1,%edx
+  802190:	0f 84 82 00 00 00    	je     802218 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802196:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802199:	83 f8 2f             	cmp    $0x2f,%eax
+  80219c:	0f 87 a5 00 00 00    	ja     802247 <vprintfmt+0x4b3>
+  8021a2:	89 c2                	mov    %eax,%edx
+  8021a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021a8:	83 c0 08             	add    $0x8,%eax
+  8021ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021ae:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021b1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8021b6:	e9 99 01 00 00       	jmp    802354 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8021bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021be:	83 f8 2f             	cmp    $0x2f,%eax
+  8021c1:	77 19                	ja     8021dc <vprintfmt+0x448>
+  8021c3:	89 c2                	mov    %eax,%edx
+  8021c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021c9:	83 c0 08             	add    $0x8,%eax
+  8021cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021cf:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021d2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8021d7:	e9 78 01 00 00       	jmp    802354 <vprintfmt+0x5c0>
+  8021dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021e8:	eb e5                	jmp    8021cf <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8021ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8021f0:	77 18                	ja     80220a <vprintfmt+0x476>
+  8021f2:	89 c2                	mov    %eax,%edx
+  8021f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021f8:	83 c0 08             	add    $0x8,%eax
+  8021fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021fe:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802200:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802205:	e9 4a 01 00 00       	jmp    802354 <vprintfmt+0x5c0>
+  80220a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80220e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802212:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802216:	eb e6                	jmp    8021fe <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802218:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80221b:	83 f8 2f             	cmp    $0x2f,%eax
+  80221e:	77 19                	ja     802239 <vprintfmt+0x4a5>
+  802220:	89 c2                	mov    %eax,%edx
+  802222:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802226:	83 c0 08             	add    $0x8,%eax
+  802229:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80222c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80222f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802234:	e9 1b 01 00 00       	jmp    802354 <vprintfmt+0x5c0>
+  802239:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80223d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802241:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802245:	eb e5                	jmp    80222c <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802247:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80224b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80224f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802253:	e9 56 ff ff ff       	jmp    8021ae <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802258:	40 84 f6             	test   %sil,%sil
+  80225b:	75 2e                	jne    80228b <vprintfmt+0x4f7>
+    switch (lflag) {
+  80225d:	85 d2                	test   %edx,%edx
+  80225f:	74 59                	je     8022ba <vprintfmt+0x526>
+  802261:	83 fa 01             	cmp    $0x1,%edx
+  802264:	74 7f                	je     8022e5 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802266:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802269:	83 f8 2f             	cmp    $0x2f,%eax
+  80226c:	0f 87 9f 00 00 00    	ja     802311 <vprintfmt+0x57d>
+  802272:	89 c2                	mov    %eax,%edx
+  802274:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802278:	83 c0 08             	add    $0x8,%eax
+  80227b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80227e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802281:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802286:	e9 c9 00 00 00       	jmp    802354 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80228b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80228e:	83 f8 2f             	cmp    $0x2f,%eax
+  802291:	77 19                	ja     8022ac <vprintfmt+0x518>
+  802293:	89 c2                	mov    %eax,%edx
+  802295:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802299:	83 c0 08             	add    $0x8,%eax
+  80229c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80229f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8022a2:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022a7:	e9 a8 00 00 00       	jmp    802354 <vprintfmt+0x5c0>
+  8022ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022b8:	eb e5                	jmp    80229f <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8022ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8022c0:	77 15                	ja     8022d7 <vprintfmt+0x543>
+  8022c2:	89 c2                	mov    %eax,%edx
+  8022c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022c8:	83 c0 08             	add    $0x8,%eax
+  8022cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022ce:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8022d0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8022d5:	eb 7d                	jmp    802354 <vprintfmt+0x5c0>
+  8022d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022e3:	eb e9                	jmp    8022ce <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8022e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8022eb:	77 16                	ja     802303 <vprintfmt+0x56f>
+  8022ed:	89 c2                	mov    %eax,%edx
+  8022ef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022f3:	83 c0 08             	add    $0x8,%eax
+  8022f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022f9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8022fc:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802301:	eb 51                	jmp    802354 <vprintfmt+0x5c0>
+  802303:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802307:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80230b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80230f:	eb e8                	jmp    8022f9 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802311:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802315:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802319:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80231d:	e9 5c ff ff ff       	jmp    80227e <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802322:	4c 89 ee             	mov    %r13,%rsi
+  802325:	bf 30 00 00 00       	mov    $0x30,%edi
+  80232a:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80232d:	4c 89 ee             	mov    %r13,%rsi
+  802330:	bf 78 00 00 00       	mov    $0x78,%edi
+  802335:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802338:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80233b:	83 f8 2f             	cmp    $0x2f,%eax
+  80233e:	77 47                	ja     802387 <vprintfmt+0x5f3>
+  802340:	89 c2                	mov    %eax,%edx
+  802342:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802346:	83 c0 08             	add    $0x8,%eax
+  802349:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80234c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80234f:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802354:	48 83 ec 08          	sub    $0x8,%rsp
+  802358:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80235c:	0f 94 c0             	sete   %al
+  80235f:	0f b6 c0             	movzbl %al,%eax
+  802362:	50                   	push   %rax
+  802363:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802368:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80236c:	4c 89 ee             	mov    %r13,%rsi
+  80236f:	4c 89 f7             	mov    %r14,%rdi
+  802372:	48 b8 89 1c 80 00 00 	movabs $0x801c89,%rax
+  802379:	00 00 00 
+  80237c:	ff d0                	call   *%rax
+            break;
+  80237e:	48 83 c4 10          	add    $0x10,%rsp
+  802382:	e9 3e fa ff ff       	jmp    801dc5 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802387:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80238b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80238f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802393:	eb b7                	jmp    80234c <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802395:	40 84 f6             	test   %sil,%sil
+  802398:	75 2b                	jne    8023c5 <vprintfmt+0x631>
+    switch (lflag) {
+  80239a:	85 d2                	test   %edx,%edx
+  80239c:	74 56                	je     8023f4 <vprintfmt+0x660>
+  80239e:	83 fa 01             	cmp    $0x1,%edx
+  8023a1:	74 7f                	je     802422 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8023a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8023a9:	0f 87 a2 00 00 00    	ja     802451 <vprintfmt+0x6bd>
+  8023af:	89 c2                	mov    %eax,%edx
+  8023b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023b5:	83 c0 08             	add    $0x8,%eax
+  8023b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023bb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023be:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023c3:	eb 8f                	jmp    802354 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8023cb:	77 19                	ja     8023e6 <vprintfmt+0x652>
+  8023cd:	89 c2                	mov    %eax,%edx
+  8023cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023d3:	83 c0 08             	add    $0x8,%eax
+  8023d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023d9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023dc:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023e1:	e9 6e ff ff ff       	jmp    802354 <vprintfmt+0x5c0>
+  8023e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023f2:	eb e5                	jmp    8023d9 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8023f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8023fa:	77 18                	ja     802414 <vprintfmt+0x680>
+  8023fc:	89 c2                	mov    %eax,%edx
+  8023fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802402:	83 c0 08             	add    $0x8,%eax
+  802405:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802408:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80240a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80240f:	e9 40 ff ff ff       	jmp    802354 <vprintfmt+0x5c0>
+  802414:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802418:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80241c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802420:	eb e6                	jmp    802408 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802422:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802425:	83 f8 2f             	cmp    $0x2f,%eax
+  802428:	77 19                	ja     802443 <vprintfmt+0x6af>
+  80242a:	89 c2                	mov    %eax,%edx
+  80242c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802430:	83 c0 08             	add    $0x8,%eax
+  802433:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802436:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802439:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80243e:	e9 11 ff ff ff       	jmp    802354 <vprintfmt+0x5c0>
+  802443:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802447:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80244b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80244f:	eb e5                	jmp    802436 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802451:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802455:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802459:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80245d:	e9 59 ff ff ff       	jmp    8023bb <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802462:	4c 89 ee             	mov    %r13,%rsi
+  802465:	bf 25 00 00 00       	mov    $0x25,%edi
+  80246a:	41 ff d6             	call   *%r14
+            break;
+  80246d:	e9 53 f9 ff ff       	jmp    801dc5 <vprintfmt+0x31>
+            putch('%', put_arg);
+  802472:	4c 89 ee             	mov    %r13,%rsi
+  802475:	bf 25 00 00 00       	mov    $0x25,%edi
+  80247a:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80247d:	48 83 eb 01          	sub    $0x1,%rbx
+  802481:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802485:	75 f6                	jne    80247d <vprintfmt+0x6e9>
+  802487:	e9 39 f9 ff ff       	jmp    801dc5 <vprintfmt+0x31>
+}
+  80248c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802490:	5b                   	pop    %rbx
+  802491:	41 5c                	pop    %r12
+  802493:	41 5d                	pop    %r13
+  802495:	41 5e                	pop    %r14
+  802497:	41 5f                	pop    %r15
+  802499:	5d                   	pop    %rbp
+  80249a:	c3                   	ret
+
+000000000080249b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80249b:	55                   	push   %rbp
+  80249c:	48 89 e5             	mov    %rsp,%rbp
+  80249f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8024a3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8024a7:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8024ac:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8024b0:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8024b7:	48 85 ff             	test   %rdi,%rdi
+  8024ba:	74 2b                	je     8024e7 <vsnprintf+0x4c>
+  8024bc:	48 85 f6             	test   %rsi,%rsi
+  8024bf:	74 26                	je     8024e7 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8024c1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024c5:	48 bf 3f 1d 80 00 00 	movabs $0x801d3f,%rdi
+  8024cc:	00 00 00 
+  8024cf:	48 b8 94 1d 80 00 00 	movabs $0x801d94,%rax
+  8024d6:	00 00 00 
+  8024d9:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8024db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024df:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8024e2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8024e5:	c9                   	leave
+  8024e6:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8024e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024ec:	eb f7                	jmp    8024e5 <vsnprintf+0x4a>
+
+00000000008024ee <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8024ee:	55                   	push   %rbp
+  8024ef:	48 89 e5             	mov    %rsp,%rbp
+  8024f2:	48 83 ec 50          	sub    $0x50,%rsp
+  8024f6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8024fa:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8024fe:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802502:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802509:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80250d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802511:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802515:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802519:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80251d:	48 b8 9b 24 80 00 00 	movabs $0x80249b,%rax
+  802524:	00 00 00 
+  802527:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802529:	c9                   	leave
+  80252a:	c3                   	ret
+
+000000000080252b <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80252b:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80252e:	74 10                	je     802540 <strlen+0x15>
+    size_t n = 0;
+  802530:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802535:	48 83 c0 01          	add    $0x1,%rax
+  802539:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80253d:	75 f6                	jne    802535 <strlen+0xa>
+  80253f:	c3                   	ret
+    size_t n = 0;
+  802540:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802545:	c3                   	ret
+
+0000000000802546 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802546:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802549:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80254e:	48 85 f6             	test   %rsi,%rsi
+  802551:	74 11                	je     802564 <strnlen+0x1e>
+  802553:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802557:	74 0c                	je     802565 <strnlen+0x1f>
+  802559:	48 83 c2 01          	add    $0x1,%rdx
+  80255d:	48 39 d0             	cmp    %rdx,%rax
+  802560:	75 f1                	jne    802553 <strnlen+0xd>
+  802562:	eb 04                	jmp    802568 <strnlen+0x22>
+  802564:	c3                   	ret
+  802565:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802568:	c3                   	ret
+
+0000000000802569 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802569:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80256c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802571:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802575:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802578:	48 83 c2 01          	add    $0x1,%rdx
+  80257c:	84 c9                	test   %cl,%cl
+  80257e:	75 f1                	jne    802571 <strcpy+0x8>
+        ;
+    return res;
+}
+  802580:	c3                   	ret
+
+0000000000802581 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802581:	55                   	push   %rbp
+  802582:	48 89 e5             	mov    %rsp,%rbp
+  802585:	41 54                	push   %r12
+  802587:	53                   	push   %rbx
+  802588:	48 89 fb             	mov    %rdi,%rbx
+  80258b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80258e:	48 b8 2b 25 80 00 00 	movabs $0x80252b,%rax
+  802595:	00 00 00 
+  802598:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80259a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80259e:	4c 89 e6             	mov    %r12,%rsi
+  8025a1:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  8025a8:	00 00 00 
+  8025ab:	ff d0                	call   *%rax
+    return dst;
+}
+  8025ad:	48 89 d8             	mov    %rbx,%rax
+  8025b0:	5b                   	pop    %rbx
+  8025b1:	41 5c                	pop    %r12
+  8025b3:	5d                   	pop    %rbp
+  8025b4:	c3                   	ret
+
+00000000008025b5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8025b5:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8025b8:	48 85 d2             	test   %rdx,%rdx
+  8025bb:	74 1f                	je     8025dc <strncpy+0x27>
+  8025bd:	48 01 fa             	add    %rdi,%rdx
+  8025c0:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8025c3:	48 83 c1 01          	add    $0x1,%rcx
+  8025c7:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8025cb:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8025cf:	41 80 f8 01          	cmp    $0x1,%r8b
+  8025d3:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8025d7:	48 39 ca             	cmp    %rcx,%rdx
+  8025da:	75 e7                	jne    8025c3 <strncpy+0xe>
+    }
+    return ret;
+}
+  8025dc:	c3                   	ret
+
+00000000008025dd <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8025dd:	48 89 f8             	mov    %rdi,%rax
+  8025e0:	48 85 d2             	test   %rdx,%rdx
+  8025e3:	74 24                	je     802609 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8025e5:	48 83 ea 01          	sub    $0x1,%rdx
+  8025e9:	74 1b                	je     802606 <strlcpy+0x29>
+  8025eb:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8025ef:	0f b6 16             	movzbl (%rsi),%edx
+  8025f2:	84 d2                	test   %dl,%dl
+  8025f4:	74 10                	je     802606 <strlcpy+0x29>
+            *dst++ = *src++;
+  8025f6:	48 83 c6 01          	add    $0x1,%rsi
+  8025fa:	48 83 c0 01          	add    $0x1,%rax
+  8025fe:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802601:	48 39 c8             	cmp    %rcx,%rax
+  802604:	75 e9                	jne    8025ef <strlcpy+0x12>
+        *dst = '\0';
+  802606:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802609:	48 29 f8             	sub    %rdi,%rax
+}
+  80260c:	c3                   	ret
+
+000000000080260d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80260d:	0f b6 07             	movzbl (%rdi),%eax
+  802610:	84 c0                	test   %al,%al
+  802612:	74 13                	je     802627 <strcmp+0x1a>
+  802614:	38 06                	cmp    %al,(%rsi)
+  802616:	75 0f                	jne    802627 <strcmp+0x1a>
+  802618:	48 83 c7 01          	add    $0x1,%rdi
+  80261c:	48 83 c6 01          	add    $0x1,%rsi
+  802620:	0f b6 07             	movzbl (%rdi),%eax
+  802623:	84 c0                	test   %al,%al
+  802625:	75 ed                	jne    802614 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802627:	0f b6 c0             	movzbl %al,%eax
+  80262a:	0f b6 16             	movzbl (%rsi),%edx
+  80262d:	29 d0                	sub    %edx,%eax
+}
+  80262f:	c3                   	ret
+
+0000000000802630 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802630:	48 85 d2             	test   %rdx,%rdx
+  802633:	74 1f                	je     802654 <strncmp+0x24>
+  802635:	0f b6 07             	movzbl (%rdi),%eax
+  802638:	84 c0                	test   %al,%al
+  80263a:	74 1e                	je     80265a <strncmp+0x2a>
+  80263c:	3a 06                	cmp    (%rsi),%al
+  80263e:	75 1a                	jne    80265a <strncmp+0x2a>
+  802640:	48 83 c7 01          	add    $0x1,%rdi
+  802644:	48 83 c6 01          	add    $0x1,%rsi
+  802648:	48 83 ea 01          	sub    $0x1,%rdx
+  80264c:	75 e7                	jne    802635 <strncmp+0x5>
+
+    if (!n) return 0;
+  80264e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802653:	c3                   	ret
+  802654:	b8 00 00 00 00       	mov    $0x0,%eax
+  802659:	c3                   	ret
+  80265a:	48 85 d2             	test   %rdx,%rdx
+  80265d:	74 09                	je     802668 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80265f:	0f b6 07             	movzbl (%rdi),%eax
+  802662:	0f b6 16             	movzbl (%rsi),%edx
+  802665:	29 d0                	sub    %edx,%eax
+  802667:	c3                   	ret
+    if (!n) return 0;
+  802668:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80266d:	c3                   	ret
+
+000000000080266e <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80266e:	0f b6 17             	movzbl (%rdi),%edx
+  802671:	84 d2                	test   %dl,%dl
+  802673:	74 18                	je     80268d <strchr+0x1f>
+        if (*str == c) {
+  802675:	0f be d2             	movsbl %dl,%edx
+  802678:	39 f2                	cmp    %esi,%edx
+  80267a:	74 17                	je     802693 <strchr+0x25>
+    for (; *str; str++) {
+  80267c:	48 83 c7 01          	add    $0x1,%rdi
+  802680:	0f b6 17             	movzbl (%rdi),%edx
+  802683:	84 d2                	test   %dl,%dl
+  802685:	75 ee                	jne    802675 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802687:	b8 00 00 00 00       	mov    $0x0,%eax
+  80268c:	c3                   	ret
+  80268d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802692:	c3                   	ret
+  802693:	48 89 f8             	mov    %rdi,%rax
+}
+  802696:	c3                   	ret
+
+0000000000802697 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802697:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80269a:	0f b6 17             	movzbl (%rdi),%edx
+  80269d:	84 d2                	test   %dl,%dl
+  80269f:	74 13                	je     8026b4 <strfind+0x1d>
+  8026a1:	0f be d2             	movsbl %dl,%edx
+  8026a4:	39 f2                	cmp    %esi,%edx
+  8026a6:	74 0b                	je     8026b3 <strfind+0x1c>
+  8026a8:	48 83 c0 01          	add    $0x1,%rax
+  8026ac:	0f b6 10             	movzbl (%rax),%edx
+  8026af:	84 d2                	test   %dl,%dl
+  8026b1:	75 ee                	jne    8026a1 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8026b3:	c3                   	ret
+  8026b4:	c3                   	ret
+
+00000000008026b5 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8026b5:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8026b8:	48 89 f8             	mov    %rdi,%rax
+  8026bb:	48 f7 d8             	neg    %rax
+  8026be:	83 e0 07             	and    $0x7,%eax
+  8026c1:	49 89 d1             	mov    %rdx,%r9
+  8026c4:	49 29 c1             	sub    %rax,%r9
+  8026c7:	78 36                	js     8026ff <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8026c9:	40 0f b6 c6          	movzbl %sil,%eax
+  8026cd:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8026d4:	01 01 01 
+  8026d7:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8026db:	40 f6 c7 07          	test   $0x7,%dil
+  8026df:	75 38                	jne    802719 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8026e1:	4c 89 c9             	mov    %r9,%rcx
+  8026e4:	48 c1 f9 03          	sar    $0x3,%rcx
+  8026e8:	74 0c                	je     8026f6 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8026ea:	fc                   	cld
+  8026eb:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8026ee:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8026f2:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8026f6:	4d 85 c9             	test   %r9,%r9
+  8026f9:	75 45                	jne    802740 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8026fb:	4c 89 c0             	mov    %r8,%rax
+  8026fe:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8026ff:	48 85 d2             	test   %rdx,%rdx
+  802702:	74 f7                	je     8026fb <memset+0x46>
+  802704:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802707:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80270a:	48 83 c0 01          	add    $0x1,%rax
+  80270e:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802712:	48 39 c2             	cmp    %rax,%rdx
+  802715:	75 f3                	jne    80270a <memset+0x55>
+  802717:	eb e2                	jmp    8026fb <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802719:	40 f6 c7 01          	test   $0x1,%dil
+  80271d:	74 06                	je     802725 <memset+0x70>
+  80271f:	88 07                	mov    %al,(%rdi)
+  802721:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802725:	40 f6 c7 02          	test   $0x2,%dil
+  802729:	74 07                	je     802732 <memset+0x7d>
+  80272b:	66 89 07             	mov    %ax,(%rdi)
+  80272e:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802732:	40 f6 c7 04          	test   $0x4,%dil
+  802736:	74 a9                	je     8026e1 <memset+0x2c>
+  802738:	89 07                	mov    %eax,(%rdi)
+  80273a:	48 83 c7 04          	add    $0x4,%rdi
+  80273e:	eb a1                	jmp    8026e1 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802740:	41 f6 c1 04          	test   $0x4,%r9b
+  802744:	74 06                	je     80274c <memset+0x97>
+  802746:	89 07                	mov    %eax,(%rdi)
+  802748:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80274c:	41 f6 c1 02          	test   $0x2,%r9b
+  802750:	74 07                	je     802759 <memset+0xa4>
+  802752:	66 89 07             	mov    %ax,(%rdi)
+  802755:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802759:	41 f6 c1 01          	test   $0x1,%r9b
+  80275d:	74 9c                	je     8026fb <memset+0x46>
+  80275f:	88 07                	mov    %al,(%rdi)
+  802761:	eb 98                	jmp    8026fb <memset+0x46>
+
+0000000000802763 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802763:	48 89 f8             	mov    %rdi,%rax
+  802766:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802769:	48 39 fe             	cmp    %rdi,%rsi
+  80276c:	73 3b                	jae    8027a9 <memmove+0x46>
+  80276e:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802772:	48 39 d7             	cmp    %rdx,%rdi
+  802775:	73 32                	jae    8027a9 <memmove+0x46>
+        s += n;
+        d += n;
+  802777:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80277b:	48 89 d6             	mov    %rdx,%rsi
+  80277e:	48 09 fe             	or     %rdi,%rsi
+  802781:	48 09 ce             	or     %rcx,%rsi
+  802784:	40 f6 c6 07          	test   $0x7,%sil
+  802788:	75 12                	jne    80279c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80278a:	48 83 ef 08          	sub    $0x8,%rdi
+  80278e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802792:	48 c1 e9 03          	shr    $0x3,%rcx
+  802796:	fd                   	std
+  802797:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80279a:	fc                   	cld
+  80279b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80279c:	48 83 ef 01          	sub    $0x1,%rdi
+  8027a0:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8027a4:	fd                   	std
+  8027a5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8027a7:	eb f1                	jmp    80279a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8027a9:	48 89 f2             	mov    %rsi,%rdx
+  8027ac:	48 09 c2             	or     %rax,%rdx
+  8027af:	48 09 ca             	or     %rcx,%rdx
+  8027b2:	f6 c2 07             	test   $0x7,%dl
+  8027b5:	75 0c                	jne    8027c3 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8027b7:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027bb:	48 89 c7             	mov    %rax,%rdi
+  8027be:	fc                   	cld
+  8027bf:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8027c2:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8027c3:	48 89 c7             	mov    %rax,%rdi
+  8027c6:	fc                   	cld
+  8027c7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8027c9:	c3                   	ret
+
+00000000008027ca <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8027ca:	55                   	push   %rbp
+  8027cb:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8027ce:	48 b8 63 27 80 00 00 	movabs $0x802763,%rax
+  8027d5:	00 00 00 
+  8027d8:	ff d0                	call   *%rax
+}
+  8027da:	5d                   	pop    %rbp
+  8027db:	c3                   	ret
+
+00000000008027dc <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8027dc:	55                   	push   %rbp
+  8027dd:	48 89 e5             	mov    %rsp,%rbp
+  8027e0:	41 57                	push   %r15
+  8027e2:	41 56                	push   %r14
+  8027e4:	41 55                	push   %r13
+  8027e6:	41 54                	push   %r12
+  8027e8:	53                   	push   %rbx
+  8027e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8027ed:	49 89 fe             	mov    %rdi,%r14
+  8027f0:	49 89 f7             	mov    %rsi,%r15
+  8027f3:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8027f6:	48 89 f7             	mov    %rsi,%rdi
+  8027f9:	48 b8 2b 25 80 00 00 	movabs $0x80252b,%rax
+  802800:	00 00 00 
+  802803:	ff d0                	call   *%rax
+  802805:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802808:	48 89 de             	mov    %rbx,%rsi
+  80280b:	4c 89 f7             	mov    %r14,%rdi
+  80280e:	48 b8 46 25 80 00 00 	movabs $0x802546,%rax
+  802815:	00 00 00 
+  802818:	ff d0                	call   *%rax
+  80281a:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80281d:	48 39 c3             	cmp    %rax,%rbx
+  802820:	74 36                	je     802858 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802822:	48 89 d8             	mov    %rbx,%rax
+  802825:	4c 29 e8             	sub    %r13,%rax
+  802828:	49 39 c4             	cmp    %rax,%r12
+  80282b:	73 31                	jae    80285e <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80282d:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802832:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802836:	4c 89 fe             	mov    %r15,%rsi
+  802839:	48 b8 ca 27 80 00 00 	movabs $0x8027ca,%rax
+  802840:	00 00 00 
+  802843:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802845:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802849:	48 83 c4 08          	add    $0x8,%rsp
+  80284d:	5b                   	pop    %rbx
+  80284e:	41 5c                	pop    %r12
+  802850:	41 5d                	pop    %r13
+  802852:	41 5e                	pop    %r14
+  802854:	41 5f                	pop    %r15
+  802856:	5d                   	pop    %rbp
+  802857:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802858:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80285c:	eb eb                	jmp    802849 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80285e:	48 83 eb 01          	sub    $0x1,%rbx
+  802862:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802866:	48 89 da             	mov    %rbx,%rdx
+  802869:	4c 89 fe             	mov    %r15,%rsi
+  80286c:	48 b8 ca 27 80 00 00 	movabs $0x8027ca,%rax
+  802873:	00 00 00 
+  802876:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802878:	49 01 de             	add    %rbx,%r14
+  80287b:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802880:	eb c3                	jmp    802845 <strlcat+0x69>
+
+0000000000802882 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802882:	48 85 d2             	test   %rdx,%rdx
+  802885:	74 2d                	je     8028b4 <memcmp+0x32>
+  802887:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80288c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802890:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802895:	44 38 c1             	cmp    %r8b,%cl
+  802898:	75 0f                	jne    8028a9 <memcmp+0x27>
+    while (n-- > 0) {
+  80289a:	48 83 c0 01          	add    $0x1,%rax
+  80289e:	48 39 c2             	cmp    %rax,%rdx
+  8028a1:	75 e9                	jne    80288c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8028a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a8:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8028a9:	0f b6 c1             	movzbl %cl,%eax
+  8028ac:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8028b0:	44 29 c0             	sub    %r8d,%eax
+  8028b3:	c3                   	ret
+    return 0;
+  8028b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028b9:	c3                   	ret
+
+00000000008028ba <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8028ba:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8028be:	48 39 c7             	cmp    %rax,%rdi
+  8028c1:	73 0f                	jae    8028d2 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8028c3:	40 38 37             	cmp    %sil,(%rdi)
+  8028c6:	74 0e                	je     8028d6 <memfind+0x1c>
+    for (; src < end; src++) {
+  8028c8:	48 83 c7 01          	add    $0x1,%rdi
+  8028cc:	48 39 f8             	cmp    %rdi,%rax
+  8028cf:	75 f2                	jne    8028c3 <memfind+0x9>
+  8028d1:	c3                   	ret
+  8028d2:	48 89 f8             	mov    %rdi,%rax
+  8028d5:	c3                   	ret
+  8028d6:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8028d9:	c3                   	ret
+
+00000000008028da <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8028da:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8028dd:	0f b6 37             	movzbl (%rdi),%esi
+  8028e0:	40 80 fe 20          	cmp    $0x20,%sil
+  8028e4:	74 06                	je     8028ec <strtol+0x12>
+  8028e6:	40 80 fe 09          	cmp    $0x9,%sil
+  8028ea:	75 13                	jne    8028ff <strtol+0x25>
+  8028ec:	48 83 c7 01          	add    $0x1,%rdi
+  8028f0:	0f b6 37             	movzbl (%rdi),%esi
+  8028f3:	40 80 fe 20          	cmp    $0x20,%sil
+  8028f7:	74 f3                	je     8028ec <strtol+0x12>
+  8028f9:	40 80 fe 09          	cmp    $0x9,%sil
+  8028fd:	74 ed                	je     8028ec <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8028ff:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802902:	83 e0 fd             	and    $0xfffffffd,%eax
+  802905:	3c 01                	cmp    $0x1,%al
+  802907:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80290b:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802911:	75 0f                	jne    802922 <strtol+0x48>
+  802913:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802916:	74 14                	je     80292c <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802918:	85 d2                	test   %edx,%edx
+  80291a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80291f:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802922:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802927:	4c 63 ca             	movslq %edx,%r9
+  80292a:	eb 36                	jmp    802962 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80292c:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802930:	74 0f                	je     802941 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802932:	85 d2                	test   %edx,%edx
+  802934:	75 ec                	jne    802922 <strtol+0x48>
+        s++;
+  802936:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80293a:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80293f:	eb e1                	jmp    802922 <strtol+0x48>
+        s += 2;
+  802941:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802945:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80294a:	eb d6                	jmp    802922 <strtol+0x48>
+            dig -= '0';
+  80294c:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80294f:	44 0f b6 c1          	movzbl %cl,%r8d
+  802953:	41 39 d0             	cmp    %edx,%r8d
+  802956:	7d 21                	jge    802979 <strtol+0x9f>
+        val = val * base + dig;
+  802958:	49 0f af c1          	imul   %r9,%rax
+  80295c:	0f b6 c9             	movzbl %cl,%ecx
+  80295f:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802962:	48 83 c7 01          	add    $0x1,%rdi
+  802966:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80296a:	80 f9 39             	cmp    $0x39,%cl
+  80296d:	76 dd                	jbe    80294c <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80296f:	80 f9 7b             	cmp    $0x7b,%cl
+  802972:	77 05                	ja     802979 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802974:	83 e9 57             	sub    $0x57,%ecx
+  802977:	eb d6                	jmp    80294f <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802979:	4d 85 d2             	test   %r10,%r10
+  80297c:	74 03                	je     802981 <strtol+0xa7>
+  80297e:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802981:	48 89 c2             	mov    %rax,%rdx
+  802984:	48 f7 da             	neg    %rdx
+  802987:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80298b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80298f:	c3                   	ret
+
+0000000000802990 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802990:	55                   	push   %rbp
+  802991:	48 89 e5             	mov    %rsp,%rbp
+  802994:	41 54                	push   %r12
+  802996:	53                   	push   %rbx
+  802997:	48 89 fb             	mov    %rdi,%rbx
+  80299a:	48 89 f7             	mov    %rsi,%rdi
+  80299d:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8029a0:	48 85 f6             	test   %rsi,%rsi
+  8029a3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029aa:	00 00 00 
+  8029ad:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8029b1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029b6:	48 b8 e9 05 80 00 00 	movabs $0x8005e9,%rax
+  8029bd:	00 00 00 
+  8029c0:	ff d0                	call   *%rax
+    if (res < 0) {
+  8029c2:	85 c0                	test   %eax,%eax
+  8029c4:	78 45                	js     802a0b <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8029c6:	48 85 db             	test   %rbx,%rbx
+  8029c9:	74 12                	je     8029dd <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8029cb:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029d2:	00 00 00 
+  8029d5:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8029db:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  8029dd:	4d 85 e4             	test   %r12,%r12
+  8029e0:	74 14                	je     8029f6 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  8029e2:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029e9:	00 00 00 
+  8029ec:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8029f2:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  8029f6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029fd:	00 00 00 
+  802a00:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802a06:	5b                   	pop    %rbx
+  802a07:	41 5c                	pop    %r12
+  802a09:	5d                   	pop    %rbp
+  802a0a:	c3                   	ret
+        if (from_env_store)
+  802a0b:	48 85 db             	test   %rbx,%rbx
+  802a0e:	74 06                	je     802a16 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802a10:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802a16:	4d 85 e4             	test   %r12,%r12
+  802a19:	74 eb                	je     802a06 <ipc_recv+0x76>
+            *perm_store = 0;
+  802a1b:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802a22:	00 
+  802a23:	eb e1                	jmp    802a06 <ipc_recv+0x76>
+
+0000000000802a25 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802a25:	55                   	push   %rbp
+  802a26:	48 89 e5             	mov    %rsp,%rbp
+  802a29:	41 57                	push   %r15
+  802a2b:	41 56                	push   %r14
+  802a2d:	41 55                	push   %r13
+  802a2f:	41 54                	push   %r12
+  802a31:	53                   	push   %rbx
+  802a32:	48 83 ec 18          	sub    $0x18,%rsp
+  802a36:	41 89 fd             	mov    %edi,%r13d
+  802a39:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802a3c:	48 89 d3             	mov    %rdx,%rbx
+  802a3f:	49 89 cc             	mov    %rcx,%r12
+  802a42:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a46:	48 85 d2             	test   %rdx,%rdx
+  802a49:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a50:	00 00 00 
+  802a53:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a57:	49 be bd 05 80 00 00 	movabs $0x8005bd,%r14
+  802a5e:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802a61:	49 bf f0 01 80 00 00 	movabs $0x8001f0,%r15
+  802a68:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a6b:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802a6e:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802a72:	4c 89 e1             	mov    %r12,%rcx
+  802a75:	48 89 da             	mov    %rbx,%rdx
+  802a78:	44 89 ef             	mov    %r13d,%edi
+  802a7b:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802a7e:	85 c0                	test   %eax,%eax
+  802a80:	74 34                	je     802ab6 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802a82:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802a85:	75 05                	jne    802a8c <ipc_send+0x67>
+        sys_yield();
+  802a87:	41 ff d7             	call   *%r15
+    while (true) {
+  802a8a:	eb df                	jmp    802a6b <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802a8c:	48 ba cf 31 80 00 00 	movabs $0x8031cf,%rdx
+  802a93:	00 00 00 
+  802a96:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802a9b:	48 bf e8 31 80 00 00 	movabs $0x8031e8,%rdi
+  802aa2:	00 00 00 
+  802aa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aaa:	48 b9 f4 1a 80 00 00 	movabs $0x801af4,%rcx
+  802ab1:	00 00 00 
+  802ab4:	ff d1                	call   *%rcx
+    }
+}
+  802ab6:	48 83 c4 18          	add    $0x18,%rsp
+  802aba:	5b                   	pop    %rbx
+  802abb:	41 5c                	pop    %r12
+  802abd:	41 5d                	pop    %r13
+  802abf:	41 5e                	pop    %r14
+  802ac1:	41 5f                	pop    %r15
+  802ac3:	5d                   	pop    %rbp
+  802ac4:	c3                   	ret
+
+0000000000802ac5 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802aca:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802ad1:	00 00 00 
+  802ad4:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802adb:	48 01 ca             	add    %rcx,%rdx
+  802ade:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802ae4:	39 fa                	cmp    %edi,%edx
+  802ae6:	74 12                	je     802afa <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802ae8:	48 83 c0 01          	add    $0x1,%rax
+  802aec:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802af2:	75 e0                	jne    802ad4 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802af4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802af9:	c3                   	ret
+            return envs[i].env_id;
+  802afa:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802b01:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b08:	00 00 00 
+  802b0b:	48 01 d0             	add    %rdx,%rax
+  802b0e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b14:	c3                   	ret
+  802b15:	0f 1f 00             	nopl   (%rax)
+
+0000000000802b18 <__rodata_start>:
+  802b18:	3c 75                	cmp    $0x75,%al
+  802b1a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b1b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b1f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b20:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802b24:	1f                   	(bad)
+  802b25:	44 00 00             	add    %r8b,(%rax)
+  802b28:	73 79                	jae    802ba3 <__rodata_start+0x8b>
+  802b2a:	73 63                	jae    802b8f <__rodata_start+0x77>
+  802b2c:	61                   	(bad)
+  802b2d:	6c                   	insb   (%dx),%es:(%rdi)
+  802b2e:	6c                   	insb   (%dx),%es:(%rdi)
+  802b2f:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a08faf <__bss_end+0x72200faf>
+  802b35:	65 74 75             	gs je  802bad <__rodata_start+0x95>
+  802b38:	72 6e                	jb     802ba8 <__rodata_start+0x90>
+  802b3a:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a08fbc <__bss_end+0x28200fbc>
+  802b41:	28 
+  802b42:	3e 20 30             	ds and %dh,(%rax)
+  802b45:	29 00                	sub    %eax,(%rax)
+  802b47:	6c                   	insb   (%dx),%es:(%rdi)
+  802b48:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802b4f:	61                   	(bad)
+  802b50:	6c                   	insb   (%dx),%es:(%rdi)
+  802b51:	6c                   	insb   (%dx),%es:(%rdi)
+  802b52:	2e 63 00             	cs movsxd (%rax),%eax
+  802b55:	0f 1f 00             	nopl   (%rax)
+  802b58:	5b                   	pop    %rbx
+  802b59:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b5e:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802b61:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b65:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b66:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802b6a:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802b71:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 8035dc <error_string+0x4dc>
+  802b78:	5b                   	pop    %rbx
+  802b79:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b7e:	20 66 74             	and    %ah,0x74(%rsi)
+  802b81:	72 75                	jb     802bf8 <devtab+0x18>
+  802b83:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b84:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802b87:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4bf2 <__bss_end+0x2d2ccbf2>
+  802b8e:	20 62 61             	and    %ah,0x61(%rdx)
+  802b91:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802b95:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802b99:	5b                   	pop    %rbx
+  802b9a:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b9f:	20 72 65             	and    %dh,0x65(%rdx)
+  802ba2:	61                   	(bad)
+  802ba3:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4c0e <__bss_end+0x2d2ccc0e>
+  802baa:	20 62 61             	and    %ah,0x61(%rdx)
+  802bad:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802bb1:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bb5:	5b                   	pop    %rbx
+  802bb6:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802bbb:	20 77 72             	and    %dh,0x72(%rdi)
+  802bbe:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802bc5:	2d 
+  802bc6:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802bcb:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802bce:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802bd9:	00 00 00 
+  802bdc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000802be0 <devtab>:
+  802be0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802bf0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802c00:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802c10:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802c20:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802c30:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802c40:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802c50:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802c60:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802c70:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802c80:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802c90:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802ca0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802cb0:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802cc0:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802cd0:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802ce0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802cf0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802d00:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802d10:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802d20:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802d30:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802d40:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802d50:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802d60:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802d70:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802d80:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802d90:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802da0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802db0:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802dc0:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802dd0:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802de0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802df0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802e00:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802e10:	64 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     d.operation not 
+  802e20:	70 65 72 6d 69 74 74 65 64 00 66 2e 0f 1f 84 00     permitted.f.....
+  802e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
+  802e40:	31 1e 80 00 00 00 00 00 72 24 80 00 00 00 00 00     1.......r$......
+  802e50:	62 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     b$......r$......
+  802e60:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  802e70:	72 24 80 00 00 00 00 00 50 1e 80 00 00 00 00 00     r$......P.......
+  802e80:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  802e90:	44 1e 80 00 00 00 00 00 be 1e 80 00 00 00 00 00     D...............
+  802ea0:	72 24 80 00 00 00 00 00 44 1e 80 00 00 00 00 00     r$......D.......
+  802eb0:	8a 1e 80 00 00 00 00 00 8a 1e 80 00 00 00 00 00     ................
+  802ec0:	8a 1e 80 00 00 00 00 00 8a 1e 80 00 00 00 00 00     ................
+  802ed0:	8a 1e 80 00 00 00 00 00 8a 1e 80 00 00 00 00 00     ................
+  802ee0:	8a 1e 80 00 00 00 00 00 8a 1e 80 00 00 00 00 00     ................
+  802ef0:	8a 1e 80 00 00 00 00 00 72 24 80 00 00 00 00 00     ........r$......
+  802f00:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  802f10:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  802f20:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  802f30:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  802f40:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  802f50:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  802f60:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  802f70:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  802f80:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  802f90:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  802fa0:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  802fb0:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  802fc0:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  802fd0:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  802fe0:	72 24 80 00 00 00 00 00 95 23 80 00 00 00 00 00     r$.......#......
+  802ff0:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  803000:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  803010:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  803020:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  803030:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  803040:	e1 1e 80 00 00 00 00 00 b0 20 80 00 00 00 00 00     ......... ......
+  803050:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  803060:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  803070:	10 1f 80 00 00 00 00 00 72 24 80 00 00 00 00 00     ........r$......
+  803080:	72 24 80 00 00 00 00 00 d6 1e 80 00 00 00 00 00     r$..............
+  803090:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  8030a0:	58 22 80 00 00 00 00 00 22 23 80 00 00 00 00 00     X"......"#......
+  8030b0:	72 24 80 00 00 00 00 00 72 24 80 00 00 00 00 00     r$......r$......
+  8030c0:	a7 1f 80 00 00 00 00 00 72 24 80 00 00 00 00 00     ........r$......
+  8030d0:	84 21 80 00 00 00 00 00 72 24 80 00 00 00 00 00     .!......r$......
+  8030e0:	72 24 80 00 00 00 00 00 95 23 80 00 00 00 00 00     r$.......#......
+  8030f0:	72 24 80 00 00 00 00 00 3a 1e 80 00 00 00 00 00     r$......:.......
+
+0000000000803100 <error_string>:
+	...
+  803108:	b5 2c 80 00 00 00 00 00 c7 2c 80 00 00 00 00 00     .,.......,......
+  803118:	d7 2c 80 00 00 00 00 00 e9 2c 80 00 00 00 00 00     .,.......,......
+  803128:	f7 2c 80 00 00 00 00 00 0b 2d 80 00 00 00 00 00     .,.......-......
+  803138:	20 2d 80 00 00 00 00 00 33 2d 80 00 00 00 00 00      -......3-......
+  803148:	45 2d 80 00 00 00 00 00 59 2d 80 00 00 00 00 00     E-......Y-......
+  803158:	69 2d 80 00 00 00 00 00 7c 2d 80 00 00 00 00 00     i-......|-......
+  803168:	93 2d 80 00 00 00 00 00 a9 2d 80 00 00 00 00 00     .-.......-......
+  803178:	c1 2d 80 00 00 00 00 00 d9 2d 80 00 00 00 00 00     .-.......-......
+  803188:	e6 2d 80 00 00 00 00 00 b0 31 80 00 00 00 00 00     .-.......1......
+  803198:	fa 2d 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .-..............
+  8031a8:	12 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ........file is 
+  8031b8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8031c8:	75 74 61 62 6c 65 00 69 70 63 5f 73 65 6e 64 3a     utable.ipc_send:
+  8031d8:	20 66 61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00      failed to send.
+  8031e8:	6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00     lib/ipc.c.f.....
+  8031f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803208:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803218:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803228:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803238:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803248:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803258:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803268:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803278:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803288:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803298:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8032e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803308:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803318:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803328:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803338:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803348:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803358:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803368:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803378:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803388:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803398:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803408:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803418:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803428:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803438:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803448:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803458:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803468:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803478:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803488:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803498:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803508:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803518:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803528:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803538:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803548:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803558:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803568:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803578:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803588:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803598:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803608:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803618:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803628:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803638:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803648:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803658:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803668:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803678:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803688:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803698:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803708:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803718:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803728:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803738:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803748:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803758:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803768:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803778:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803788:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803798:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803808:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803818:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803828:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803838:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803848:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803858:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803868:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803878:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803888:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803898:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803908:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803918:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803928:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803938:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803948:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803958:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803968:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803978:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803988:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803998:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803aa8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ab8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ac8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ad8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ae8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803af8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ba8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bb8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bc8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bd8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803be8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bf8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ca8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cb8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cc8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cd8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ce8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cf8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803da8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803db8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dc8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dd8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803de8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803df8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ea8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803eb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ec8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ed8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ee8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ef8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fa8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fe8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ff8:	0f 1f 84 00 00 00 00 00                             ........
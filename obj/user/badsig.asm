@@ -0,0 +1,7402 @@
+
+obj/user/badsig:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 bc 0e 00 00       	call   800edf <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler_usr2>:
+
+volatile sig_atomic_t updated = 0;
+
+static void
+handler_usr2(int signo) {
+    assert(signo == SIGUSR2);
+  800025:	83 ff 0c             	cmp    $0xc,%edi
+  800028:	75 11                	jne    80003b <handler_usr2+0x16>
+    updated = 1;
+  80002a:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800031:	00 00 00 
+  800034:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+  80003a:	c3                   	ret
+handler_usr2(int signo) {
+  80003b:	55                   	push   %rbp
+  80003c:	48 89 e5             	mov    %rsp,%rbp
+    assert(signo == SIGUSR2);
+  80003f:	48 b9 28 40 80 00 00 	movabs $0x804028,%rcx
+  800046:	00 00 00 
+  800049:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800050:	00 00 00 
+  800053:	be 1c 00 00 00       	mov    $0x1c,%esi
+  800058:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  80005f:	00 00 00 
+  800062:	b8 00 00 00 00       	mov    $0x0,%eax
+  800067:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  80006e:	00 00 00 
+  800071:	41 ff d0             	call   *%r8
+
+0000000000800074 <handler_chld>:
+    assert(signo == SIGCHLD);
+  800074:	83 ff 11             	cmp    $0x11,%edi
+  800077:	75 12                	jne    80008b <handler_chld+0x17>
+    ++finished_children;
+  800079:	48 ba 04 60 80 00 00 	movabs $0x806004,%rdx
+  800080:	00 00 00 
+  800083:	8b 02                	mov    (%rdx),%eax
+  800085:	83 c0 01             	add    $0x1,%eax
+  800088:	89 02                	mov    %eax,(%rdx)
+  80008a:	c3                   	ret
+handler_chld(int signo) {
+  80008b:	55                   	push   %rbp
+  80008c:	48 89 e5             	mov    %rsp,%rbp
+    assert(signo == SIGCHLD);
+  80008f:	48 b9 5c 40 80 00 00 	movabs $0x80405c,%rcx
+  800096:	00 00 00 
+  800099:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  8000a0:	00 00 00 
+  8000a3:	be 09 00 00 00       	mov    $0x9,%esi
+  8000a8:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  8000af:	00 00 00 
+  8000b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b7:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  8000be:	00 00 00 
+  8000c1:	41 ff d0             	call   *%r8
+
+00000000008000c4 <handler>:
+handler(int signo, siginfo_t * info, void * ctx) {
+  8000c4:	55                   	push   %rbp
+  8000c5:	48 89 e5             	mov    %rsp,%rbp
+  8000c8:	41 56                	push   %r14
+  8000ca:	41 55                	push   %r13
+  8000cc:	41 54                	push   %r12
+  8000ce:	53                   	push   %rbx
+  8000cf:	48 89 f3             	mov    %rsi,%rbx
+    sv.sival_int = 0;
+  8000d2:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        sigqueue(info->si_pid, SIGUSR2, sv);
+  8000d8:	49 bd 6a 38 80 00 00 	movabs $0x80386a,%r13
+  8000df:	00 00 00 
+        sys_yield();
+  8000e2:	49 bc 3f 1f 80 00 00 	movabs $0x801f3f,%r12
+  8000e9:	00 00 00 
+        sigqueue(info->si_pid, SIGUSR2, sv);
+  8000ec:	8b 7b 08             	mov    0x8(%rbx),%edi
+  8000ef:	4c 89 f2             	mov    %r14,%rdx
+  8000f2:	be 0c 00 00 00       	mov    $0xc,%esi
+  8000f7:	41 ff d5             	call   *%r13
+        sys_yield();
+  8000fa:	41 ff d4             	call   *%r12
+    while (true) {
+  8000fd:	eb ed                	jmp    8000ec <handler+0x28>
+
+00000000008000ff <umain>:
+}
+
+void
+umain(int argc, char **argv) {
+  8000ff:	55                   	push   %rbp
+  800100:	48 89 e5             	mov    %rsp,%rbp
+  800103:	41 55                	push   %r13
+  800105:	41 54                	push   %r12
+  800107:	53                   	push   %rbx
+  800108:	48 83 ec 28          	sub    $0x28,%rsp
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+  80010c:	ba 10 00 00 00       	mov    $0x10,%edx
+  800111:	be 00 00 00 00       	mov    $0x0,%esi
+  800116:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80011a:	48 b8 6a 1b 80 00 00 	movabs $0x801b6a,%rax
+  800121:	00 00 00 
+  800124:	ff d0                	call   *%rax
+
+    // invalid signals
+    int err;
+    err = sigaction(0, &sa, NULL);
+  800126:	ba 00 00 00 00       	mov    $0x0,%edx
+  80012b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80012f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800134:	48 b8 8e 38 80 00 00 	movabs $0x80388e,%rax
+  80013b:	00 00 00 
+  80013e:	ff d0                	call   *%rax
+    assert(err == -E_INVAL);
+  800140:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800143:	0f 85 24 05 00 00    	jne    80066d <umain+0x56e>
+    err = sigaction(SIGMAX, &sa, NULL);
+  800149:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800152:	bf 20 00 00 00       	mov    $0x20,%edi
+  800157:	48 b8 8e 38 80 00 00 	movabs $0x80388e,%rax
+  80015e:	00 00 00 
+  800161:	ff d0                	call   *%rax
+    assert(err == -E_INVAL);
+  800163:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800166:	0f 85 36 05 00 00    	jne    8006a2 <umain+0x5a3>
+    err = sigaction(SIGKILL, &sa, NULL);
+  80016c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800171:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800175:	bf 09 00 00 00       	mov    $0x9,%edi
+  80017a:	48 b8 8e 38 80 00 00 	movabs $0x80388e,%rax
+  800181:	00 00 00 
+  800184:	ff d0                	call   *%rax
+    assert(err == -E_INVAL);
+  800186:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800189:	0f 85 48 05 00 00    	jne    8006d7 <umain+0x5d8>
+    err = sigaction(SIGSTOP, &sa, NULL);
+  80018f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800194:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800198:	bf 12 00 00 00       	mov    $0x12,%edi
+  80019d:	48 b8 8e 38 80 00 00 	movabs $0x80388e,%rax
+  8001a4:	00 00 00 
+  8001a7:	ff d0                	call   *%rax
+    assert(err == -E_INVAL);
+  8001a9:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8001ac:	0f 85 5a 05 00 00    	jne    80070c <umain+0x60d>
+    err = sigaction(SIGCONT, &sa, NULL);
+  8001b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001b7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8001bb:	bf 13 00 00 00       	mov    $0x13,%edi
+  8001c0:	48 b8 8e 38 80 00 00 	movabs $0x80388e,%rax
+  8001c7:	00 00 00 
+  8001ca:	ff d0                	call   *%rax
+    assert(err == -E_INVAL);
+  8001cc:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8001cf:	0f 85 6c 05 00 00    	jne    800741 <umain+0x642>
+    union sigval sv;
+    sv.sival_ptr = NULL;
+  8001d5:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    err = sigqueue(0, 0, sv);
+  8001db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ea:	48 b8 6a 38 80 00 00 	movabs $0x80386a,%rax
+  8001f1:	00 00 00 
+  8001f4:	ff d0                	call   *%rax
+    assert(err == -E_INVAL);
+  8001f6:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8001f9:	0f 85 77 05 00 00    	jne    800776 <umain+0x677>
+    err = sigqueue(0, SIGMAX, sv);
+  8001ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800204:	be 20 00 00 00       	mov    $0x20,%esi
+  800209:	bf 00 00 00 00       	mov    $0x0,%edi
+  80020e:	48 b8 6a 38 80 00 00 	movabs $0x80386a,%rax
+  800215:	00 00 00 
+  800218:	ff d0                	call   *%rax
+    assert(err == -E_INVAL);
+  80021a:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80021d:	0f 85 88 05 00 00    	jne    8007ab <umain+0x6ac>
+
+    // sigmasks
+    sigset_t test_set = SIGNAL_FLAG(SIGINT) | SIGNAL_FLAG(SIGTERM);
+  800223:	c7 45 cc 04 80 00 00 	movl   $0x8004,-0x34(%rbp)
+    err = sigprocmask(123, &test_set, NULL);
+  80022a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80022f:	48 8d 75 cc          	lea    -0x34(%rbp),%rsi
+  800233:	bf 7b 00 00 00       	mov    $0x7b,%edi
+  800238:	48 b8 e3 38 80 00 00 	movabs $0x8038e3,%rax
+  80023f:	00 00 00 
+  800242:	ff d0                	call   *%rax
+    assert(err == -E_INVAL);
+  800244:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800247:	0f 85 93 05 00 00    	jne    8007e0 <umain+0x6e1>
+    err = sigprocmask(SIG_BLOCK, NULL, NULL);
+  80024d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800252:	be 00 00 00 00       	mov    $0x0,%esi
+  800257:	bf 01 00 00 00       	mov    $0x1,%edi
+  80025c:	48 b8 e3 38 80 00 00 	movabs $0x8038e3,%rax
+  800263:	00 00 00 
+  800266:	ff d0                	call   *%rax
+    assert(err == 0);
+  800268:	85 c0                	test   %eax,%eax
+  80026a:	0f 85 a5 05 00 00    	jne    800815 <umain+0x716>
+    err = sigprocmask(SIG_SETMASK, &test_set, NULL);
+  800270:	ba 00 00 00 00       	mov    $0x0,%edx
+  800275:	48 8d 75 cc          	lea    -0x34(%rbp),%rsi
+  800279:	bf 03 00 00 00       	mov    $0x3,%edi
+  80027e:	48 b8 e3 38 80 00 00 	movabs $0x8038e3,%rax
+  800285:	00 00 00 
+  800288:	ff d0                	call   *%rax
+    assert(err == 0);
+  80028a:	85 c0                	test   %eax,%eax
+  80028c:	0f 85 b8 05 00 00    	jne    80084a <umain+0x74b>
+    test_set = SIGNAL_FLAG(SIGUSR2);
+  800292:	c7 45 cc 00 10 00 00 	movl   $0x1000,-0x34(%rbp)
+    err = sigprocmask(SIG_BLOCK, &test_set, NULL);
+  800299:	ba 00 00 00 00       	mov    $0x0,%edx
+  80029e:	48 8d 75 cc          	lea    -0x34(%rbp),%rsi
+  8002a2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8002a7:	48 bb e3 38 80 00 00 	movabs $0x8038e3,%rbx
+  8002ae:	00 00 00 
+  8002b1:	ff d3                	call   *%rbx
+    test_set = SIGNAL_FLAG(SIGUSR1);
+  8002b3:	c7 45 cc 00 04 00 00 	movl   $0x400,-0x34(%rbp)
+    err = sigprocmask(SIG_UNBLOCK, &test_set, NULL);
+  8002ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002bf:	48 8d 75 cc          	lea    -0x34(%rbp),%rsi
+  8002c3:	bf 02 00 00 00       	mov    $0x2,%edi
+  8002c8:	ff d3                	call   *%rbx
+    test_set = SIGNAL_FLAG(SIGINT);
+  8002ca:	c7 45 cc 04 00 00 00 	movl   $0x4,-0x34(%rbp)
+    err = sigprocmask(SIG_UNBLOCK, &test_set, NULL);
+  8002d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002d6:	48 8d 75 cc          	lea    -0x34(%rbp),%rsi
+  8002da:	bf 02 00 00 00       	mov    $0x2,%edi
+  8002df:	ff d3                	call   *%rbx
+    assert(err == 0);
+  8002e1:	85 c0                	test   %eax,%eax
+  8002e3:	0f 85 96 05 00 00    	jne    80087f <umain+0x780>
+    sigset_t old_test_set;
+    err = sigprocmask(0, NULL, &old_test_set);
+  8002e9:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8002ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8002f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002f7:	48 b8 e3 38 80 00 00 	movabs $0x8038e3,%rax
+  8002fe:	00 00 00 
+  800301:	ff d0                	call   *%rax
+    assert(err == 0);
+  800303:	85 c0                	test   %eax,%eax
+  800305:	0f 85 a9 05 00 00    	jne    8008b4 <umain+0x7b5>
+    assert(old_test_set == (SIGNAL_FLAG(SIGUSR2) | SIGNAL_FLAG(SIGTERM)));
+  80030b:	81 7d c8 00 90 00 00 	cmpl   $0x9000,-0x38(%rbp)
+  800312:	0f 85 d1 05 00 00    	jne    8008e9 <umain+0x7ea>
+    test_set = 0;
+  800318:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+    err = sigprocmask(SIG_SETMASK, &test_set, NULL);
+  80031f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800324:	48 8d 75 cc          	lea    -0x34(%rbp),%rsi
+  800328:	bf 03 00 00 00       	mov    $0x3,%edi
+  80032d:	48 b8 e3 38 80 00 00 	movabs $0x8038e3,%rax
+  800334:	00 00 00 
+  800337:	ff d0                	call   *%rax
+
+    // invalid flags
+    sa.sa_flags = 123;
+  800339:	c7 45 dc 7b 00 00 00 	movl   $0x7b,-0x24(%rbp)
+    err = sigaction(SIGUSR1, &sa, NULL);
+  800340:	ba 00 00 00 00       	mov    $0x0,%edx
+  800345:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800349:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80034e:	48 b8 8e 38 80 00 00 	movabs $0x80388e,%rax
+  800355:	00 00 00 
+  800358:	ff d0                	call   *%rax
+    assert(err == -E_INVAL);
+  80035a:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80035d:	0f 85 bb 05 00 00    	jne    80091e <umain+0x81f>
+    sa.sa_flags = 0;
+
+    sa.sa_handler = handler_chld;
+  800363:	48 b8 74 00 80 00 00 	movabs $0x800074,%rax
+  80036a:	00 00 00 
+  80036d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    sa.sa_flags = SA_NOCLDSTOP;
+  800371:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%rbp)
+    err = sigaction(SIGCHLD, &sa, NULL);
+  800378:	ba 00 00 00 00       	mov    $0x0,%edx
+  80037d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800381:	bf 11 00 00 00       	mov    $0x11,%edi
+  800386:	48 b8 8e 38 80 00 00 	movabs $0x80388e,%rax
+  80038d:	00 00 00 
+  800390:	ff d0                	call   *%rax
+    assert(err == 0);
+  800392:	85 c0                	test   %eax,%eax
+  800394:	0f 85 b9 05 00 00    	jne    800953 <umain+0x854>
+
+    // invalid pointers
+    if (fork() == 0) {
+  80039a:	48 b8 70 25 80 00 00 	movabs $0x802570,%rax
+  8003a1:	00 00 00 
+  8003a4:	ff d0                	call   *%rax
+  8003a6:	85 c0                	test   %eax,%eax
+  8003a8:	0f 84 da 05 00 00    	je     800988 <umain+0x889>
+        sigaction(SIGUSR1, (void *)0xdeadbeef, NULL);
+        assert(false);
+    }
+    if (fork() == 0) {
+  8003ae:	48 b8 70 25 80 00 00 	movabs $0x802570,%rax
+  8003b5:	00 00 00 
+  8003b8:	ff d0                	call   *%rax
+  8003ba:	85 c0                	test   %eax,%eax
+  8003bc:	0f 84 16 06 00 00    	je     8009d8 <umain+0x8d9>
+        sigaction(SIGUSR1, &sa, (void *)0xdeadbeef);
+        assert(false);
+    }
+    if (fork() == 0) {
+  8003c2:	48 b8 70 25 80 00 00 	movabs $0x802570,%rax
+  8003c9:	00 00 00 
+  8003cc:	ff d0                	call   *%rax
+  8003ce:	85 c0                	test   %eax,%eax
+  8003d0:	0f 84 51 06 00 00    	je     800a27 <umain+0x928>
+        sigwait((void *)0xdeadbeef, NULL);
+        assert(false);
+    }
+    if (fork() == 0) {
+  8003d6:	48 b8 70 25 80 00 00 	movabs $0x802570,%rax
+  8003dd:	00 00 00 
+  8003e0:	ff d0                	call   *%rax
+  8003e2:	85 c0                	test   %eax,%eax
+  8003e4:	0f 84 88 06 00 00    	je     800a72 <umain+0x973>
+        sigset_t set = 2;
+        sigwait(&set, (void *)0xdeadbeef);
+        assert(false);
+    }
+    if (fork() == 0) {
+  8003ea:	48 b8 70 25 80 00 00 	movabs $0x802570,%rax
+  8003f1:	00 00 00 
+  8003f4:	ff d0                	call   *%rax
+  8003f6:	85 c0                	test   %eax,%eax
+  8003f8:	0f 84 c5 06 00 00    	je     800ac3 <umain+0x9c4>
+        sigprocmask(SIG_SETMASK, (void *)0xdeadbeef, NULL);
+        assert(false);
+    }
+    if (fork() == 0) {
+  8003fe:	48 b8 70 25 80 00 00 	movabs $0x802570,%rax
+  800405:	00 00 00 
+  800408:	ff d0                	call   *%rax
+  80040a:	85 c0                	test   %eax,%eax
+  80040c:	0f 84 01 07 00 00    	je     800b13 <umain+0xa14>
+        assert(false);
+    }
+
+    // check that queue does not overflow
+    // and that it's not possible to block special signals
+    sa.sa_handler = handler_usr2;
+  800412:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800419:	00 00 00 
+  80041c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    err = sigaction(SIGUSR2, &sa, NULL);
+  800420:	ba 00 00 00 00       	mov    $0x0,%edx
+  800425:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800429:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80042e:	48 b8 8e 38 80 00 00 	movabs $0x80388e,%rax
+  800435:	00 00 00 
+  800438:	ff d0                	call   *%rax
+    assert(err == 0);
+  80043a:	85 c0                	test   %eax,%eax
+  80043c:	0f 85 27 07 00 00    	jne    800b69 <umain+0xa6a>
+    sa.sa_sigaction = handler;
+  800442:	48 b8 c4 00 80 00 00 	movabs $0x8000c4,%rax
+  800449:	00 00 00 
+  80044c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    sa.sa_flags = SA_SIGINFO;
+  800450:	c7 45 dc 04 00 00 00 	movl   $0x4,-0x24(%rbp)
+    sa.sa_mask = (uint32_t)-1;
+  800457:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    err = sigaction(SIGUSR1, &sa, NULL);
+  80045e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800463:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800467:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80046c:	48 b8 8e 38 80 00 00 	movabs $0x80388e,%rax
+  800473:	00 00 00 
+  800476:	ff d0                	call   *%rax
+    assert(err == 0);
+  800478:	85 c0                	test   %eax,%eax
+  80047a:	0f 85 1e 07 00 00    	jne    800b9e <umain+0xa9f>
+
+    envid_t child1 = fork();
+  800480:	48 b8 70 25 80 00 00 	movabs $0x802570,%rax
+  800487:	00 00 00 
+  80048a:	ff d0                	call   *%rax
+  80048c:	41 89 c4             	mov    %eax,%r12d
+        sigprocmask(SIG_SETMASK, &set, NULL);
+        while (1) sys_yield();
+    }
+
+    while (err == 0)
+        err = sigqueue(child1, SIGUSR1, sv);
+  80048f:	48 bb 6a 38 80 00 00 	movabs $0x80386a,%rbx
+  800496:	00 00 00 
+    if (child1 == 0) {
+  800499:	85 c0                	test   %eax,%eax
+  80049b:	0f 84 32 07 00 00    	je     800bd3 <umain+0xad4>
+        err = sigqueue(child1, SIGUSR1, sv);
+  8004a1:	4c 89 ea             	mov    %r13,%rdx
+  8004a4:	be 0a 00 00 00       	mov    $0xa,%esi
+  8004a9:	44 89 e7             	mov    %r12d,%edi
+  8004ac:	ff d3                	call   *%rbx
+    while (err == 0)
+  8004ae:	85 c0                	test   %eax,%eax
+  8004b0:	74 ef                	je     8004a1 <umain+0x3a2>
+    assert(err == -E_AGAIN);
+  8004b2:	83 f8 ec             	cmp    $0xffffffec,%eax
+  8004b5:	0f 85 47 07 00 00    	jne    800c02 <umain+0xb03>
+    err = sigqueue(child1, SIGUSR1, sv);
+  8004bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004c0:	be 0a 00 00 00       	mov    $0xa,%esi
+  8004c5:	44 89 e7             	mov    %r12d,%edi
+  8004c8:	48 b8 6a 38 80 00 00 	movabs $0x80386a,%rax
+  8004cf:	00 00 00 
+  8004d2:	ff d0                	call   *%rax
+    assert(err == -E_AGAIN);
+  8004d4:	83 f8 ec             	cmp    $0xffffffec,%eax
+  8004d7:	0f 85 5a 07 00 00    	jne    800c37 <umain+0xb38>
+  8004dd:	bb 0a 00 00 00       	mov    $0xa,%ebx
+
+    // stop child and check that flag is not updating anymore
+    for (int i = 0; i < 10; ++i) sys_yield();
+  8004e2:	49 bd 3f 1f 80 00 00 	movabs $0x801f3f,%r13
+  8004e9:	00 00 00 
+  8004ec:	41 ff d5             	call   *%r13
+  8004ef:	83 eb 01             	sub    $0x1,%ebx
+  8004f2:	75 f8                	jne    8004ec <umain+0x3ed>
+    err = sigqueue(child1, SIGSTOP, sv);
+  8004f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004f9:	be 12 00 00 00       	mov    $0x12,%esi
+  8004fe:	44 89 e7             	mov    %r12d,%edi
+  800501:	48 b8 6a 38 80 00 00 	movabs $0x80386a,%rax
+  800508:	00 00 00 
+  80050b:	ff d0                	call   *%rax
+    assert(err == 0);
+  80050d:	85 c0                	test   %eax,%eax
+  80050f:	0f 85 57 07 00 00    	jne    800c6c <umain+0xb6d>
+    assert(updated);
+  800515:	a1 00 60 80 00 00 00 	movabs 0x806000,%eax
+  80051c:	00 00 
+  80051e:	85 c0                	test   %eax,%eax
+  800520:	0f 84 7b 07 00 00    	je     800ca1 <umain+0xba2>
+    updated = 0;
+  800526:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80052d:	00 00 00 
+  800530:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  800536:	bb 0a 00 00 00       	mov    $0xa,%ebx
+    for (int i = 0; i < 10; ++i) sys_yield();
+  80053b:	49 bd 3f 1f 80 00 00 	movabs $0x801f3f,%r13
+  800542:	00 00 00 
+  800545:	41 ff d5             	call   *%r13
+  800548:	83 eb 01             	sub    $0x1,%ebx
+  80054b:	75 f8                	jne    800545 <umain+0x446>
+    assert(!updated);
+  80054d:	a1 00 60 80 00 00 00 	movabs 0x806000,%eax
+  800554:	00 00 
+  800556:	85 c0                	test   %eax,%eax
+  800558:	0f 85 73 07 00 00    	jne    800cd1 <umain+0xbd2>
+
+    // continue
+    err = sigqueue(child1, SIGCONT, sv);
+  80055e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800563:	be 13 00 00 00       	mov    $0x13,%esi
+  800568:	44 89 e7             	mov    %r12d,%edi
+  80056b:	48 b8 6a 38 80 00 00 	movabs $0x80386a,%rax
+  800572:	00 00 00 
+  800575:	ff d0                	call   *%rax
+    assert(err == 0);
+  800577:	85 c0                	test   %eax,%eax
+  800579:	0f 85 87 07 00 00    	jne    800d06 <umain+0xc07>
+  80057f:	bb 0a 00 00 00       	mov    $0xa,%ebx
+    for (int i = 0; i < 10; ++i) sys_yield();
+  800584:	49 bd 3f 1f 80 00 00 	movabs $0x801f3f,%r13
+  80058b:	00 00 00 
+  80058e:	41 ff d5             	call   *%r13
+  800591:	83 eb 01             	sub    $0x1,%ebx
+  800594:	75 f8                	jne    80058e <umain+0x48f>
+    assert(updated);
+  800596:	a1 00 60 80 00 00 00 	movabs 0x806000,%eax
+  80059d:	00 00 
+  80059f:	85 c0                	test   %eax,%eax
+  8005a1:	0f 84 94 07 00 00    	je     800d3b <umain+0xc3c>
+
+    // kill
+    err = sigqueue(child1, SIGKILL, sv);
+  8005a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ac:	be 09 00 00 00       	mov    $0x9,%esi
+  8005b1:	44 89 e7             	mov    %r12d,%edi
+  8005b4:	48 b8 6a 38 80 00 00 	movabs $0x80386a,%rax
+  8005bb:	00 00 00 
+  8005be:	ff d0                	call   *%rax
+    assert(err == 0);
+  8005c0:	85 c0                	test   %eax,%eax
+  8005c2:	0f 85 a3 07 00 00    	jne    800d6b <umain+0xc6c>
+    updated = 0;
+  8005c8:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8005cf:	00 00 00 
+  8005d2:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  8005d8:	bb 0a 00 00 00       	mov    $0xa,%ebx
+    for (int i = 0; i < 10; ++i) sys_yield();
+  8005dd:	49 bc 3f 1f 80 00 00 	movabs $0x801f3f,%r12
+  8005e4:	00 00 00 
+  8005e7:	41 ff d4             	call   *%r12
+  8005ea:	83 eb 01             	sub    $0x1,%ebx
+  8005ed:	75 f8                	jne    8005e7 <umain+0x4e8>
+    assert(!updated);
+  8005ef:	a1 00 60 80 00 00 00 	movabs 0x806000,%eax
+  8005f6:	00 00 
+  8005f8:	85 c0                	test   %eax,%eax
+  8005fa:	0f 85 a0 07 00 00    	jne    800da0 <umain+0xca1>
+
+    // test SIGCHLD and SA_NOCLDSTOP btw
+    assert(finished_children == 7);
+  800600:	a1 04 60 80 00 00 00 	movabs 0x806004,%eax
+  800607:	00 00 
+  800609:	83 f8 07             	cmp    $0x7,%eax
+  80060c:	0f 85 c3 07 00 00    	jne    800dd5 <umain+0xcd6>
+
+    sa.sa_handler = handler_chld;
+  800612:	48 b8 74 00 80 00 00 	movabs $0x800074,%rax
+  800619:	00 00 00 
+  80061c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    sa.sa_flags = 0;
+  800620:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    err = sigaction(SIGCHLD, &sa, NULL);
+  800627:	ba 00 00 00 00       	mov    $0x0,%edx
+  80062c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800630:	bf 11 00 00 00       	mov    $0x11,%edi
+  800635:	48 b8 8e 38 80 00 00 	movabs $0x80388e,%rax
+  80063c:	00 00 00 
+  80063f:	ff d0                	call   *%rax
+    assert(err == 0);
+  800641:	85 c0                	test   %eax,%eax
+  800643:	0f 85 c1 07 00 00    	jne    800e0a <umain+0xd0b>
+
+    envid_t child2 = fork();
+  800649:	48 b8 70 25 80 00 00 	movabs $0x802570,%rax
+  800650:	00 00 00 
+  800653:	ff d0                	call   *%rax
+  800655:	89 c3                	mov    %eax,%ebx
+    if (child2 == 0) {
+  800657:	85 c0                	test   %eax,%eax
+  800659:	0f 85 e0 07 00 00    	jne    800e3f <umain+0xd40>
+        while (1) sys_yield();
+  80065f:	48 bb 3f 1f 80 00 00 	movabs $0x801f3f,%rbx
+  800666:	00 00 00 
+  800669:	ff d3                	call   *%rbx
+  80066b:	eb fc                	jmp    800669 <umain+0x56a>
+    assert(err == -E_INVAL);
+  80066d:	48 b9 6d 40 80 00 00 	movabs $0x80406d,%rcx
+  800674:	00 00 00 
+  800677:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  80067e:	00 00 00 
+  800681:	be 28 00 00 00       	mov    $0x28,%esi
+  800686:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  80068d:	00 00 00 
+  800690:	b8 00 00 00 00       	mov    $0x0,%eax
+  800695:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  80069c:	00 00 00 
+  80069f:	41 ff d0             	call   *%r8
+    assert(err == -E_INVAL);
+  8006a2:	48 b9 6d 40 80 00 00 	movabs $0x80406d,%rcx
+  8006a9:	00 00 00 
+  8006ac:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  8006b3:	00 00 00 
+  8006b6:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8006bb:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  8006c2:	00 00 00 
+  8006c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ca:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  8006d1:	00 00 00 
+  8006d4:	41 ff d0             	call   *%r8
+    assert(err == -E_INVAL);
+  8006d7:	48 b9 6d 40 80 00 00 	movabs $0x80406d,%rcx
+  8006de:	00 00 00 
+  8006e1:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  8006e8:	00 00 00 
+  8006eb:	be 2c 00 00 00       	mov    $0x2c,%esi
+  8006f0:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  8006f7:	00 00 00 
+  8006fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ff:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800706:	00 00 00 
+  800709:	41 ff d0             	call   *%r8
+    assert(err == -E_INVAL);
+  80070c:	48 b9 6d 40 80 00 00 	movabs $0x80406d,%rcx
+  800713:	00 00 00 
+  800716:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  80071d:	00 00 00 
+  800720:	be 2e 00 00 00       	mov    $0x2e,%esi
+  800725:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  80072c:	00 00 00 
+  80072f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800734:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  80073b:	00 00 00 
+  80073e:	41 ff d0             	call   *%r8
+    assert(err == -E_INVAL);
+  800741:	48 b9 6d 40 80 00 00 	movabs $0x80406d,%rcx
+  800748:	00 00 00 
+  80074b:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800752:	00 00 00 
+  800755:	be 30 00 00 00       	mov    $0x30,%esi
+  80075a:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800761:	00 00 00 
+  800764:	b8 00 00 00 00       	mov    $0x0,%eax
+  800769:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800770:	00 00 00 
+  800773:	41 ff d0             	call   *%r8
+    assert(err == -E_INVAL);
+  800776:	48 b9 6d 40 80 00 00 	movabs $0x80406d,%rcx
+  80077d:	00 00 00 
+  800780:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800787:	00 00 00 
+  80078a:	be 34 00 00 00       	mov    $0x34,%esi
+  80078f:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800796:	00 00 00 
+  800799:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079e:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  8007a5:	00 00 00 
+  8007a8:	41 ff d0             	call   *%r8
+    assert(err == -E_INVAL);
+  8007ab:	48 b9 6d 40 80 00 00 	movabs $0x80406d,%rcx
+  8007b2:	00 00 00 
+  8007b5:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  8007bc:	00 00 00 
+  8007bf:	be 36 00 00 00       	mov    $0x36,%esi
+  8007c4:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  8007cb:	00 00 00 
+  8007ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d3:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  8007da:	00 00 00 
+  8007dd:	41 ff d0             	call   *%r8
+    assert(err == -E_INVAL);
+  8007e0:	48 b9 6d 40 80 00 00 	movabs $0x80406d,%rcx
+  8007e7:	00 00 00 
+  8007ea:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  8007f1:	00 00 00 
+  8007f4:	be 3b 00 00 00       	mov    $0x3b,%esi
+  8007f9:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800800:	00 00 00 
+  800803:	b8 00 00 00 00       	mov    $0x0,%eax
+  800808:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  80080f:	00 00 00 
+  800812:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  800815:	48 b9 7d 40 80 00 00 	movabs $0x80407d,%rcx
+  80081c:	00 00 00 
+  80081f:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800826:	00 00 00 
+  800829:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80082e:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800835:	00 00 00 
+  800838:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083d:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800844:	00 00 00 
+  800847:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  80084a:	48 b9 7d 40 80 00 00 	movabs $0x80407d,%rcx
+  800851:	00 00 00 
+  800854:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  80085b:	00 00 00 
+  80085e:	be 3f 00 00 00       	mov    $0x3f,%esi
+  800863:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  80086a:	00 00 00 
+  80086d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800872:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800879:	00 00 00 
+  80087c:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  80087f:	48 b9 7d 40 80 00 00 	movabs $0x80407d,%rcx
+  800886:	00 00 00 
+  800889:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800890:	00 00 00 
+  800893:	be 46 00 00 00       	mov    $0x46,%esi
+  800898:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  80089f:	00 00 00 
+  8008a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a7:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  8008ae:	00 00 00 
+  8008b1:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  8008b4:	48 b9 7d 40 80 00 00 	movabs $0x80407d,%rcx
+  8008bb:	00 00 00 
+  8008be:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  8008c5:	00 00 00 
+  8008c8:	be 49 00 00 00       	mov    $0x49,%esi
+  8008cd:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  8008d4:	00 00 00 
+  8008d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008dc:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  8008e3:	00 00 00 
+  8008e6:	41 ff d0             	call   *%r8
+    assert(old_test_set == (SIGNAL_FLAG(SIGUSR2) | SIGNAL_FLAG(SIGTERM)));
+  8008e9:	48 b9 e8 40 80 00 00 	movabs $0x8040e8,%rcx
+  8008f0:	00 00 00 
+  8008f3:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  8008fa:	00 00 00 
+  8008fd:	be 4a 00 00 00       	mov    $0x4a,%esi
+  800902:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800909:	00 00 00 
+  80090c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800911:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800918:	00 00 00 
+  80091b:	41 ff d0             	call   *%r8
+    assert(err == -E_INVAL);
+  80091e:	48 b9 6d 40 80 00 00 	movabs $0x80406d,%rcx
+  800925:	00 00 00 
+  800928:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  80092f:	00 00 00 
+  800932:	be 51 00 00 00       	mov    $0x51,%esi
+  800937:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  80093e:	00 00 00 
+  800941:	b8 00 00 00 00       	mov    $0x0,%eax
+  800946:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  80094d:	00 00 00 
+  800950:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  800953:	48 b9 7d 40 80 00 00 	movabs $0x80407d,%rcx
+  80095a:	00 00 00 
+  80095d:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800964:	00 00 00 
+  800967:	be 57 00 00 00       	mov    $0x57,%esi
+  80096c:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800973:	00 00 00 
+  800976:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097b:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800982:	00 00 00 
+  800985:	41 ff d0             	call   *%r8
+        sigaction(SIGUSR1, (void *)0xdeadbeef, NULL);
+  800988:	ba 00 00 00 00       	mov    $0x0,%edx
+  80098d:	be ef be ad de       	mov    $0xdeadbeef,%esi
+  800992:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800997:	48 b8 8e 38 80 00 00 	movabs $0x80388e,%rax
+  80099e:	00 00 00 
+  8009a1:	ff d0                	call   *%rax
+        assert(false);
+  8009a3:	48 b9 86 40 80 00 00 	movabs $0x804086,%rcx
+  8009aa:	00 00 00 
+  8009ad:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  8009b4:	00 00 00 
+  8009b7:	be 5c 00 00 00       	mov    $0x5c,%esi
+  8009bc:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  8009c3:	00 00 00 
+  8009c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009cb:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  8009d2:	00 00 00 
+  8009d5:	41 ff d0             	call   *%r8
+        sigaction(SIGUSR1, &sa, (void *)0xdeadbeef);
+  8009d8:	ba ef be ad de       	mov    $0xdeadbeef,%edx
+  8009dd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8009e1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8009e6:	48 b8 8e 38 80 00 00 	movabs $0x80388e,%rax
+  8009ed:	00 00 00 
+  8009f0:	ff d0                	call   *%rax
+        assert(false);
+  8009f2:	48 b9 86 40 80 00 00 	movabs $0x804086,%rcx
+  8009f9:	00 00 00 
+  8009fc:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800a03:	00 00 00 
+  800a06:	be 60 00 00 00       	mov    $0x60,%esi
+  800a0b:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800a12:	00 00 00 
+  800a15:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a1a:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800a21:	00 00 00 
+  800a24:	41 ff d0             	call   *%r8
+        sigwait((void *)0xdeadbeef, NULL);
+  800a27:	be 00 00 00 00       	mov    $0x0,%esi
+  800a2c:	bf ef be ad de       	mov    $0xdeadbeef,%edi
+  800a31:	48 b8 7c 38 80 00 00 	movabs $0x80387c,%rax
+  800a38:	00 00 00 
+  800a3b:	ff d0                	call   *%rax
+        assert(false);
+  800a3d:	48 b9 86 40 80 00 00 	movabs $0x804086,%rcx
+  800a44:	00 00 00 
+  800a47:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800a4e:	00 00 00 
+  800a51:	be 64 00 00 00       	mov    $0x64,%esi
+  800a56:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800a5d:	00 00 00 
+  800a60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a65:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800a6c:	00 00 00 
+  800a6f:	41 ff d0             	call   *%r8
+        sigset_t set = 2;
+  800a72:	c7 45 c4 02 00 00 00 	movl   $0x2,-0x3c(%rbp)
+        sigwait(&set, (void *)0xdeadbeef);
+  800a79:	be ef be ad de       	mov    $0xdeadbeef,%esi
+  800a7e:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  800a82:	48 b8 7c 38 80 00 00 	movabs $0x80387c,%rax
+  800a89:	00 00 00 
+  800a8c:	ff d0                	call   *%rax
+        assert(false);
+  800a8e:	48 b9 86 40 80 00 00 	movabs $0x804086,%rcx
+  800a95:	00 00 00 
+  800a98:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800a9f:	00 00 00 
+  800aa2:	be 69 00 00 00       	mov    $0x69,%esi
+  800aa7:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800aae:	00 00 00 
+  800ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab6:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800abd:	00 00 00 
+  800ac0:	41 ff d0             	call   *%r8
+        sigprocmask(SIG_SETMASK, (void *)0xdeadbeef, NULL);
+  800ac3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ac8:	be ef be ad de       	mov    $0xdeadbeef,%esi
+  800acd:	bf 03 00 00 00       	mov    $0x3,%edi
+  800ad2:	48 b8 e3 38 80 00 00 	movabs $0x8038e3,%rax
+  800ad9:	00 00 00 
+  800adc:	ff d0                	call   *%rax
+        assert(false);
+  800ade:	48 b9 86 40 80 00 00 	movabs $0x804086,%rcx
+  800ae5:	00 00 00 
+  800ae8:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800aef:	00 00 00 
+  800af2:	be 6d 00 00 00       	mov    $0x6d,%esi
+  800af7:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800afe:	00 00 00 
+  800b01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b06:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800b0d:	00 00 00 
+  800b10:	41 ff d0             	call   *%r8
+        sigset_t set = 2;
+  800b13:	c7 45 c4 02 00 00 00 	movl   $0x2,-0x3c(%rbp)
+        sigprocmask(SIG_SETMASK, &set, (void *)0xdeadbeef);
+  800b1a:	ba ef be ad de       	mov    $0xdeadbeef,%edx
+  800b1f:	48 8d 75 c4          	lea    -0x3c(%rbp),%rsi
+  800b23:	bf 03 00 00 00       	mov    $0x3,%edi
+  800b28:	48 b8 e3 38 80 00 00 	movabs $0x8038e3,%rax
+  800b2f:	00 00 00 
+  800b32:	ff d0                	call   *%rax
+        assert(false);
+  800b34:	48 b9 86 40 80 00 00 	movabs $0x804086,%rcx
+  800b3b:	00 00 00 
+  800b3e:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800b45:	00 00 00 
+  800b48:	be 72 00 00 00       	mov    $0x72,%esi
+  800b4d:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800b54:	00 00 00 
+  800b57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5c:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800b63:	00 00 00 
+  800b66:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  800b69:	48 b9 7d 40 80 00 00 	movabs $0x80407d,%rcx
+  800b70:	00 00 00 
+  800b73:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800b7a:	00 00 00 
+  800b7d:	be 79 00 00 00       	mov    $0x79,%esi
+  800b82:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800b89:	00 00 00 
+  800b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b91:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800b98:	00 00 00 
+  800b9b:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  800b9e:	48 b9 7d 40 80 00 00 	movabs $0x80407d,%rcx
+  800ba5:	00 00 00 
+  800ba8:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800baf:	00 00 00 
+  800bb2:	be 7e 00 00 00       	mov    $0x7e,%esi
+  800bb7:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800bbe:	00 00 00 
+  800bc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc6:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800bcd:	00 00 00 
+  800bd0:	41 ff d0             	call   *%r8
+        sigset_t set = ~SIGNAL_FLAG(SIGUSR1);
+  800bd3:	c7 45 c4 ff fb ff ff 	movl   $0xfffffbff,-0x3c(%rbp)
+        sigprocmask(SIG_SETMASK, &set, NULL);
+  800bda:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bdf:	48 8d 75 c4          	lea    -0x3c(%rbp),%rsi
+  800be3:	bf 03 00 00 00       	mov    $0x3,%edi
+  800be8:	48 b8 e3 38 80 00 00 	movabs $0x8038e3,%rax
+  800bef:	00 00 00 
+  800bf2:	ff d0                	call   *%rax
+        while (1) sys_yield();
+  800bf4:	48 bb 3f 1f 80 00 00 	movabs $0x801f3f,%rbx
+  800bfb:	00 00 00 
+  800bfe:	ff d3                	call   *%rbx
+  800c00:	eb fc                	jmp    800bfe <umain+0xaff>
+    assert(err == -E_AGAIN);
+  800c02:	48 b9 8c 40 80 00 00 	movabs $0x80408c,%rcx
+  800c09:	00 00 00 
+  800c0c:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800c13:	00 00 00 
+  800c16:	be 8a 00 00 00       	mov    $0x8a,%esi
+  800c1b:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800c22:	00 00 00 
+  800c25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2a:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800c31:	00 00 00 
+  800c34:	41 ff d0             	call   *%r8
+    assert(err == -E_AGAIN);
+  800c37:	48 b9 8c 40 80 00 00 	movabs $0x80408c,%rcx
+  800c3e:	00 00 00 
+  800c41:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800c48:	00 00 00 
+  800c4b:	be 8c 00 00 00       	mov    $0x8c,%esi
+  800c50:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800c57:	00 00 00 
+  800c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5f:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800c66:	00 00 00 
+  800c69:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  800c6c:	48 b9 7d 40 80 00 00 	movabs $0x80407d,%rcx
+  800c73:	00 00 00 
+  800c76:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800c7d:	00 00 00 
+  800c80:	be 91 00 00 00       	mov    $0x91,%esi
+  800c85:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800c8c:	00 00 00 
+  800c8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c94:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800c9b:	00 00 00 
+  800c9e:	41 ff d0             	call   *%r8
+    assert(updated);
+  800ca1:	48 b9 9d 40 80 00 00 	movabs $0x80409d,%rcx
+  800ca8:	00 00 00 
+  800cab:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800cb2:	00 00 00 
+  800cb5:	be 92 00 00 00       	mov    $0x92,%esi
+  800cba:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800cc1:	00 00 00 
+  800cc4:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800ccb:	00 00 00 
+  800cce:	41 ff d0             	call   *%r8
+    assert(!updated);
+  800cd1:	48 b9 9c 40 80 00 00 	movabs $0x80409c,%rcx
+  800cd8:	00 00 00 
+  800cdb:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800ce2:	00 00 00 
+  800ce5:	be 95 00 00 00       	mov    $0x95,%esi
+  800cea:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800cf1:	00 00 00 
+  800cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf9:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800d00:	00 00 00 
+  800d03:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  800d06:	48 b9 7d 40 80 00 00 	movabs $0x80407d,%rcx
+  800d0d:	00 00 00 
+  800d10:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800d17:	00 00 00 
+  800d1a:	be 99 00 00 00       	mov    $0x99,%esi
+  800d1f:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800d26:	00 00 00 
+  800d29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d2e:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800d35:	00 00 00 
+  800d38:	41 ff d0             	call   *%r8
+    assert(updated);
+  800d3b:	48 b9 9d 40 80 00 00 	movabs $0x80409d,%rcx
+  800d42:	00 00 00 
+  800d45:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800d4c:	00 00 00 
+  800d4f:	be 9b 00 00 00       	mov    $0x9b,%esi
+  800d54:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800d5b:	00 00 00 
+  800d5e:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800d65:	00 00 00 
+  800d68:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  800d6b:	48 b9 7d 40 80 00 00 	movabs $0x80407d,%rcx
+  800d72:	00 00 00 
+  800d75:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800d7c:	00 00 00 
+  800d7f:	be 9f 00 00 00       	mov    $0x9f,%esi
+  800d84:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800d8b:	00 00 00 
+  800d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d93:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800d9a:	00 00 00 
+  800d9d:	41 ff d0             	call   *%r8
+    assert(!updated);
+  800da0:	48 b9 9c 40 80 00 00 	movabs $0x80409c,%rcx
+  800da7:	00 00 00 
+  800daa:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800db1:	00 00 00 
+  800db4:	be a2 00 00 00       	mov    $0xa2,%esi
+  800db9:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800dc0:	00 00 00 
+  800dc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc8:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800dcf:	00 00 00 
+  800dd2:	41 ff d0             	call   *%r8
+    assert(finished_children == 7);
+  800dd5:	48 b9 a5 40 80 00 00 	movabs $0x8040a5,%rcx
+  800ddc:	00 00 00 
+  800ddf:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800de6:	00 00 00 
+  800de9:	be a5 00 00 00       	mov    $0xa5,%esi
+  800dee:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800df5:	00 00 00 
+  800df8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfd:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800e04:	00 00 00 
+  800e07:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  800e0a:	48 b9 7d 40 80 00 00 	movabs $0x80407d,%rcx
+  800e11:	00 00 00 
+  800e14:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800e1b:	00 00 00 
+  800e1e:	be aa 00 00 00       	mov    $0xaa,%esi
+  800e23:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800e2a:	00 00 00 
+  800e2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e32:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800e39:	00 00 00 
+  800e3c:	41 ff d0             	call   *%r8
+    }
+    sigqueue(child2, SIGSTOP, sv);
+  800e3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e44:	be 12 00 00 00       	mov    $0x12,%esi
+  800e49:	89 c7                	mov    %eax,%edi
+  800e4b:	49 bc 6a 38 80 00 00 	movabs $0x80386a,%r12
+  800e52:	00 00 00 
+  800e55:	41 ff d4             	call   *%r12
+    sigqueue(child2, SIGCONT, sv);
+  800e58:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5d:	be 13 00 00 00       	mov    $0x13,%esi
+  800e62:	89 df                	mov    %ebx,%edi
+  800e64:	41 ff d4             	call   *%r12
+    sigqueue(child2, SIGKILL, sv);
+  800e67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e6c:	be 09 00 00 00       	mov    $0x9,%esi
+  800e71:	89 df                	mov    %ebx,%edi
+  800e73:	41 ff d4             	call   *%r12
+    assert(finished_children == 10);
+  800e76:	a1 04 60 80 00 00 00 	movabs 0x806004,%eax
+  800e7d:	00 00 
+  800e7f:	83 f8 0a             	cmp    $0xa,%eax
+  800e82:	75 26                	jne    800eaa <umain+0xdab>
+
+    cprintf("Test finished\n");
+  800e84:	48 bf d4 40 80 00 00 	movabs $0x8040d4,%rdi
+  800e8b:	00 00 00 
+  800e8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e93:	48 ba f9 10 80 00 00 	movabs $0x8010f9,%rdx
+  800e9a:	00 00 00 
+  800e9d:	ff d2                	call   *%rdx
+}
+  800e9f:	48 83 c4 28          	add    $0x28,%rsp
+  800ea3:	5b                   	pop    %rbx
+  800ea4:	41 5c                	pop    %r12
+  800ea6:	41 5d                	pop    %r13
+  800ea8:	5d                   	pop    %rbp
+  800ea9:	c3                   	ret
+    assert(finished_children == 10);
+  800eaa:	48 b9 bc 40 80 00 00 	movabs $0x8040bc,%rcx
+  800eb1:	00 00 00 
+  800eb4:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  800ebb:	00 00 00 
+  800ebe:	be b3 00 00 00       	mov    $0xb3,%esi
+  800ec3:	48 bf 4e 40 80 00 00 	movabs $0x80404e,%rdi
+  800eca:	00 00 00 
+  800ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed2:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  800ed9:	00 00 00 
+  800edc:	41 ff d0             	call   *%r8
+
+0000000000800edf <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800edf:	55                   	push   %rbp
+  800ee0:	48 89 e5             	mov    %rsp,%rbp
+  800ee3:	41 56                	push   %r14
+  800ee5:	41 55                	push   %r13
+  800ee7:	41 54                	push   %r12
+  800ee9:	53                   	push   %rbx
+  800eea:	41 89 fd             	mov    %edi,%r13d
+  800eed:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800ef0:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  800ef7:	00 00 00 
+  800efa:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  800f01:	00 00 00 
+  800f04:	48 39 c2             	cmp    %rax,%rdx
+  800f07:	73 17                	jae    800f20 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800f09:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800f0c:	49 89 c4             	mov    %rax,%r12
+  800f0f:	48 83 c3 08          	add    $0x8,%rbx
+  800f13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f18:	ff 53 f8             	call   *-0x8(%rbx)
+  800f1b:	4c 39 e3             	cmp    %r12,%rbx
+  800f1e:	72 ef                	jb     800f0f <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800f20:	48 b8 0e 1f 80 00 00 	movabs $0x801f0e,%rax
+  800f27:	00 00 00 
+  800f2a:	ff d0                	call   *%rax
+  800f2c:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800f2f:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800f36:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800f3d:	00 00 00 
+  800f40:	48 01 d0             	add    %rdx,%rax
+  800f43:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  800f4a:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800f4d:	45 85 ed             	test   %r13d,%r13d
+  800f50:	7e 0d                	jle    800f5f <libmain+0x80>
+  800f52:	49 8b 06             	mov    (%r14),%rax
+  800f55:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800f5c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800f5f:	4c 89 f6             	mov    %r14,%rsi
+  800f62:	44 89 ef             	mov    %r13d,%edi
+  800f65:	48 b8 ff 00 80 00 00 	movabs $0x8000ff,%rax
+  800f6c:	00 00 00 
+  800f6f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800f71:	48 b8 86 0f 80 00 00 	movabs $0x800f86,%rax
+  800f78:	00 00 00 
+  800f7b:	ff d0                	call   *%rax
+#endif
+}
+  800f7d:	5b                   	pop    %rbx
+  800f7e:	41 5c                	pop    %r12
+  800f80:	41 5d                	pop    %r13
+  800f82:	41 5e                	pop    %r14
+  800f84:	5d                   	pop    %rbp
+  800f85:	c3                   	ret
+
+0000000000800f86 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800f86:	55                   	push   %rbp
+  800f87:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800f8a:	48 b8 96 28 80 00 00 	movabs $0x802896,%rax
+  800f91:	00 00 00 
+  800f94:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800f96:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f9b:	48 b8 a3 1e 80 00 00 	movabs $0x801ea3,%rax
+  800fa2:	00 00 00 
+  800fa5:	ff d0                	call   *%rax
+}
+  800fa7:	5d                   	pop    %rbp
+  800fa8:	c3                   	ret
+
+0000000000800fa9 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800fa9:	55                   	push   %rbp
+  800faa:	48 89 e5             	mov    %rsp,%rbp
+  800fad:	41 56                	push   %r14
+  800faf:	41 55                	push   %r13
+  800fb1:	41 54                	push   %r12
+  800fb3:	53                   	push   %rbx
+  800fb4:	48 83 ec 50          	sub    $0x50,%rsp
+  800fb8:	49 89 fc             	mov    %rdi,%r12
+  800fbb:	41 89 f5             	mov    %esi,%r13d
+  800fbe:	48 89 d3             	mov    %rdx,%rbx
+  800fc1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800fc5:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800fc9:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800fcd:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800fd4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800fd8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800fdc:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800fe0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800fe4:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800feb:	00 00 00 
+  800fee:	4c 8b 30             	mov    (%rax),%r14
+  800ff1:	48 b8 0e 1f 80 00 00 	movabs $0x801f0e,%rax
+  800ff8:	00 00 00 
+  800ffb:	ff d0                	call   *%rax
+  800ffd:	89 c6                	mov    %eax,%esi
+  800fff:	45 89 e8             	mov    %r13d,%r8d
+  801002:	4c 89 e1             	mov    %r12,%rcx
+  801005:	4c 89 f2             	mov    %r14,%rdx
+  801008:	48 bf 30 41 80 00 00 	movabs $0x804130,%rdi
+  80100f:	00 00 00 
+  801012:	b8 00 00 00 00       	mov    $0x0,%eax
+  801017:	49 bc f9 10 80 00 00 	movabs $0x8010f9,%r12
+  80101e:	00 00 00 
+  801021:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801024:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801028:	48 89 df             	mov    %rbx,%rdi
+  80102b:	48 b8 95 10 80 00 00 	movabs $0x801095,%rax
+  801032:	00 00 00 
+  801035:	ff d0                	call   *%rax
+    cprintf("\n");
+  801037:	48 bf e1 40 80 00 00 	movabs $0x8040e1,%rdi
+  80103e:	00 00 00 
+  801041:	b8 00 00 00 00       	mov    $0x0,%eax
+  801046:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801049:	cc                   	int3
+  80104a:	eb fd                	jmp    801049 <_panic+0xa0>
+
+000000000080104c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80104c:	55                   	push   %rbp
+  80104d:	48 89 e5             	mov    %rsp,%rbp
+  801050:	53                   	push   %rbx
+  801051:	48 83 ec 08          	sub    $0x8,%rsp
+  801055:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801058:	8b 06                	mov    (%rsi),%eax
+  80105a:	8d 50 01             	lea    0x1(%rax),%edx
+  80105d:	89 16                	mov    %edx,(%rsi)
+  80105f:	48 98                	cltq
+  801061:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801066:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80106c:	74 0a                	je     801078 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80106e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801072:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801076:	c9                   	leave
+  801077:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801078:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80107c:	be ff 00 00 00       	mov    $0xff,%esi
+  801081:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  801088:	00 00 00 
+  80108b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80108d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801093:	eb d9                	jmp    80106e <putch+0x22>
+
+0000000000801095 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801095:	55                   	push   %rbp
+  801096:	48 89 e5             	mov    %rsp,%rbp
+  801099:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8010a0:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8010a3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8010aa:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8010af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8010b7:	48 89 f1             	mov    %rsi,%rcx
+  8010ba:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8010c1:	48 bf 4c 10 80 00 00 	movabs $0x80104c,%rdi
+  8010c8:	00 00 00 
+  8010cb:	48 b8 49 12 80 00 00 	movabs $0x801249,%rax
+  8010d2:	00 00 00 
+  8010d5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8010d7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8010de:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8010e5:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  8010ec:	00 00 00 
+  8010ef:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8010f1:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8010f7:	c9                   	leave
+  8010f8:	c3                   	ret
+
+00000000008010f9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8010f9:	55                   	push   %rbp
+  8010fa:	48 89 e5             	mov    %rsp,%rbp
+  8010fd:	48 83 ec 50          	sub    $0x50,%rsp
+  801101:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801105:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801109:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80110d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801111:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801115:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80111c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801120:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801124:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801128:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80112c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801130:	48 b8 95 10 80 00 00 	movabs $0x801095,%rax
+  801137:	00 00 00 
+  80113a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80113c:	c9                   	leave
+  80113d:	c3                   	ret
+
+000000000080113e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80113e:	55                   	push   %rbp
+  80113f:	48 89 e5             	mov    %rsp,%rbp
+  801142:	41 57                	push   %r15
+  801144:	41 56                	push   %r14
+  801146:	41 55                	push   %r13
+  801148:	41 54                	push   %r12
+  80114a:	53                   	push   %rbx
+  80114b:	48 83 ec 18          	sub    $0x18,%rsp
+  80114f:	49 89 fc             	mov    %rdi,%r12
+  801152:	49 89 f5             	mov    %rsi,%r13
+  801155:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801159:	8b 45 10             	mov    0x10(%rbp),%eax
+  80115c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80115f:	41 89 cf             	mov    %ecx,%r15d
+  801162:	4c 39 fa             	cmp    %r15,%rdx
+  801165:	73 5b                	jae    8011c2 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801167:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80116b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80116f:	85 db                	test   %ebx,%ebx
+  801171:	7e 0e                	jle    801181 <print_num+0x43>
+            putch(padc, put_arg);
+  801173:	4c 89 ee             	mov    %r13,%rsi
+  801176:	44 89 f7             	mov    %r14d,%edi
+  801179:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80117c:	83 eb 01             	sub    $0x1,%ebx
+  80117f:	75 f2                	jne    801173 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801181:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801185:	48 b9 64 41 80 00 00 	movabs $0x804164,%rcx
+  80118c:	00 00 00 
+  80118f:	48 b8 53 41 80 00 00 	movabs $0x804153,%rax
+  801196:	00 00 00 
+  801199:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80119d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a6:	49 f7 f7             	div    %r15
+  8011a9:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8011ad:	4c 89 ee             	mov    %r13,%rsi
+  8011b0:	41 ff d4             	call   *%r12
+}
+  8011b3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8011b7:	5b                   	pop    %rbx
+  8011b8:	41 5c                	pop    %r12
+  8011ba:	41 5d                	pop    %r13
+  8011bc:	41 5e                	pop    %r14
+  8011be:	41 5f                	pop    %r15
+  8011c0:	5d                   	pop    %rbp
+  8011c1:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8011c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011cb:	49 f7 f7             	div    %r15
+  8011ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8011d2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8011d6:	52                   	push   %rdx
+  8011d7:	45 0f be c9          	movsbl %r9b,%r9d
+  8011db:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8011df:	48 89 c2             	mov    %rax,%rdx
+  8011e2:	48 b8 3e 11 80 00 00 	movabs $0x80113e,%rax
+  8011e9:	00 00 00 
+  8011ec:	ff d0                	call   *%rax
+  8011ee:	48 83 c4 10          	add    $0x10,%rsp
+  8011f2:	eb 8d                	jmp    801181 <print_num+0x43>
+
+00000000008011f4 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8011f4:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8011f8:	48 8b 06             	mov    (%rsi),%rax
+  8011fb:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8011ff:	73 0a                	jae    80120b <sprintputch+0x17>
+        *state->start++ = ch;
+  801201:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801205:	48 89 16             	mov    %rdx,(%rsi)
+  801208:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80120b:	c3                   	ret
+
+000000000080120c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80120c:	55                   	push   %rbp
+  80120d:	48 89 e5             	mov    %rsp,%rbp
+  801210:	48 83 ec 50          	sub    $0x50,%rsp
+  801214:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801218:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80121c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801220:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801227:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80122b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80122f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801233:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801237:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80123b:	48 b8 49 12 80 00 00 	movabs $0x801249,%rax
+  801242:	00 00 00 
+  801245:	ff d0                	call   *%rax
+}
+  801247:	c9                   	leave
+  801248:	c3                   	ret
+
+0000000000801249 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801249:	55                   	push   %rbp
+  80124a:	48 89 e5             	mov    %rsp,%rbp
+  80124d:	41 57                	push   %r15
+  80124f:	41 56                	push   %r14
+  801251:	41 55                	push   %r13
+  801253:	41 54                	push   %r12
+  801255:	53                   	push   %rbx
+  801256:	48 83 ec 38          	sub    $0x38,%rsp
+  80125a:	49 89 fe             	mov    %rdi,%r14
+  80125d:	49 89 f5             	mov    %rsi,%r13
+  801260:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801263:	48 8b 01             	mov    (%rcx),%rax
+  801266:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80126a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80126e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801272:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801276:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80127a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80127e:	0f b6 3b             	movzbl (%rbx),%edi
+  801281:	40 80 ff 25          	cmp    $0x25,%dil
+  801285:	74 18                	je     80129f <vprintfmt+0x56>
+            if (!ch) return;
+  801287:	40 84 ff             	test   %dil,%dil
+  80128a:	0f 84 b1 06 00 00    	je     801941 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801290:	40 0f b6 ff          	movzbl %dil,%edi
+  801294:	4c 89 ee             	mov    %r13,%rsi
+  801297:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80129a:	4c 89 e3             	mov    %r12,%rbx
+  80129d:	eb db                	jmp    80127a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80129f:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8012a8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8012ad:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8012b3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8012ba:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8012be:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8012c3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8012c8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8012cb:	83 e8 23             	sub    $0x23,%eax
+  8012ce:	3c 57                	cmp    $0x57,%al
+  8012d0:	0f 87 51 06 00 00    	ja     801927 <vprintfmt+0x6de>
+  8012d6:	0f b6 c0             	movzbl %al,%eax
+  8012d9:	48 b9 00 43 80 00 00 	movabs $0x804300,%rcx
+  8012e0:	00 00 00 
+  8012e3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8012e6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8012e9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8012ed:	eb cf                	jmp    8012be <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8012ef:	49 89 dc             	mov    %rbx,%r12
+  8012f2:	be 01 00 00 00       	mov    $0x1,%esi
+  8012f7:	eb c5                	jmp    8012be <vprintfmt+0x75>
+            padc = ch;
+  8012f9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8012fd:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801300:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801303:	eb b9                	jmp    8012be <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801305:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801308:	83 f8 2f             	cmp    $0x2f,%eax
+  80130b:	77 24                	ja     801331 <vprintfmt+0xe8>
+  80130d:	89 c1                	mov    %eax,%ecx
+  80130f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801313:	83 c0 08             	add    $0x8,%eax
+  801316:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801319:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80131c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80131f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801323:	79 99                	jns    8012be <vprintfmt+0x75>
+                width = precision;
+  801325:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801329:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80132f:	eb 8d                	jmp    8012be <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801331:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801335:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801339:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80133d:	eb da                	jmp    801319 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80133f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801344:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801348:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80134e:	3c 39                	cmp    $0x39,%al
+  801350:	77 1c                	ja     80136e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801352:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801356:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80135a:	0f b6 c0             	movzbl %al,%eax
+  80135d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801362:	0f b6 03             	movzbl (%rbx),%eax
+  801365:	3c 39                	cmp    $0x39,%al
+  801367:	76 e9                	jbe    801352 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801369:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80136c:	eb b1                	jmp    80131f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80136e:	49 89 dc             	mov    %rbx,%r12
+  801371:	eb ac                	jmp    80131f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801373:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801376:	85 c9                	test   %ecx,%ecx
+  801378:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137d:	0f 49 c1             	cmovns %ecx,%eax
+  801380:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801383:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801386:	e9 33 ff ff ff       	jmp    8012be <vprintfmt+0x75>
+            lflag++;
+  80138b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80138e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801391:	e9 28 ff ff ff       	jmp    8012be <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801396:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801399:	83 f8 2f             	cmp    $0x2f,%eax
+  80139c:	77 19                	ja     8013b7 <vprintfmt+0x16e>
+  80139e:	89 c2                	mov    %eax,%edx
+  8013a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013a4:	83 c0 08             	add    $0x8,%eax
+  8013a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013aa:	8b 3a                	mov    (%rdx),%edi
+  8013ac:	4c 89 ee             	mov    %r13,%rsi
+  8013af:	41 ff d6             	call   *%r14
+            break;
+  8013b2:	e9 c3 fe ff ff       	jmp    80127a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8013b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013c3:	eb e5                	jmp    8013aa <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8013c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8013cb:	77 5a                	ja     801427 <vprintfmt+0x1de>
+  8013cd:	89 c2                	mov    %eax,%edx
+  8013cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013d3:	83 c0 08             	add    $0x8,%eax
+  8013d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8013d9:	8b 02                	mov    (%rdx),%eax
+  8013db:	89 c1                	mov    %eax,%ecx
+  8013dd:	f7 d9                	neg    %ecx
+  8013df:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8013e2:	83 f9 15             	cmp    $0x15,%ecx
+  8013e5:	7f 4e                	jg     801435 <vprintfmt+0x1ec>
+  8013e7:	48 63 c1             	movslq %ecx,%rax
+  8013ea:	48 ba c0 45 80 00 00 	movabs $0x8045c0,%rdx
+  8013f1:	00 00 00 
+  8013f4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8013f8:	48 85 c0             	test   %rax,%rax
+  8013fb:	74 38                	je     801435 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8013fd:	48 89 c1             	mov    %rax,%rcx
+  801400:	48 ba 4b 40 80 00 00 	movabs $0x80404b,%rdx
+  801407:	00 00 00 
+  80140a:	4c 89 ee             	mov    %r13,%rsi
+  80140d:	4c 89 f7             	mov    %r14,%rdi
+  801410:	b8 00 00 00 00       	mov    $0x0,%eax
+  801415:	49 b8 0c 12 80 00 00 	movabs $0x80120c,%r8
+  80141c:	00 00 00 
+  80141f:	41 ff d0             	call   *%r8
+  801422:	e9 53 fe ff ff       	jmp    80127a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801427:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80142b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80142f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801433:	eb a4                	jmp    8013d9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801435:	48 ba 7c 41 80 00 00 	movabs $0x80417c,%rdx
+  80143c:	00 00 00 
+  80143f:	4c 89 ee             	mov    %r13,%rsi
+  801442:	4c 89 f7             	mov    %r14,%rdi
+  801445:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144a:	49 b8 0c 12 80 00 00 	movabs $0x80120c,%r8
+  801451:	00 00 00 
+  801454:	41 ff d0             	call   *%r8
+  801457:	e9 1e fe ff ff       	jmp    80127a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80145c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80145f:	83 f8 2f             	cmp    $0x2f,%eax
+  801462:	77 6c                	ja     8014d0 <vprintfmt+0x287>
+  801464:	89 c2                	mov    %eax,%edx
+  801466:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80146a:	83 c0 08             	add    $0x8,%eax
+  80146d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801473:	48 85 d2             	test   %rdx,%rdx
+  801476:	48 b8 75 41 80 00 00 	movabs $0x804175,%rax
+  80147d:	00 00 00 
+  801480:	48 0f 45 c2          	cmovne %rdx,%rax
+  801484:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801488:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80148c:	7e 06                	jle    801494 <vprintfmt+0x24b>
+  80148e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801492:	75 4a                	jne    8014de <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801494:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801498:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80149c:	0f b6 00             	movzbl (%rax),%eax
+  80149f:	84 c0                	test   %al,%al
+  8014a1:	0f 85 9a 00 00 00    	jne    801541 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8014a7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8014aa:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8014ae:	85 c0                	test   %eax,%eax
+  8014b0:	0f 8e c4 fd ff ff    	jle    80127a <vprintfmt+0x31>
+  8014b6:	4c 89 ee             	mov    %r13,%rsi
+  8014b9:	bf 20 00 00 00       	mov    $0x20,%edi
+  8014be:	41 ff d6             	call   *%r14
+  8014c1:	41 83 ec 01          	sub    $0x1,%r12d
+  8014c5:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8014c9:	75 eb                	jne    8014b6 <vprintfmt+0x26d>
+  8014cb:	e9 aa fd ff ff       	jmp    80127a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8014d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014dc:	eb 92                	jmp    801470 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8014de:	49 63 f7             	movslq %r15d,%rsi
+  8014e1:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8014e5:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  8014ec:	00 00 00 
+  8014ef:	ff d0                	call   *%rax
+  8014f1:	48 89 c2             	mov    %rax,%rdx
+  8014f4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8014f7:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8014f9:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8014fc:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8014ff:	85 c0                	test   %eax,%eax
+  801501:	7e 91                	jle    801494 <vprintfmt+0x24b>
+  801503:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801508:	4c 89 ee             	mov    %r13,%rsi
+  80150b:	44 89 e7             	mov    %r12d,%edi
+  80150e:	41 ff d6             	call   *%r14
+  801511:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801515:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801518:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80151b:	75 eb                	jne    801508 <vprintfmt+0x2bf>
+  80151d:	e9 72 ff ff ff       	jmp    801494 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801522:	0f b6 f8             	movzbl %al,%edi
+  801525:	4c 89 ee             	mov    %r13,%rsi
+  801528:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80152b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80152f:	49 83 c4 01          	add    $0x1,%r12
+  801533:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801539:	84 c0                	test   %al,%al
+  80153b:	0f 84 66 ff ff ff    	je     8014a7 <vprintfmt+0x25e>
+  801541:	45 85 ff             	test   %r15d,%r15d
+  801544:	78 0a                	js     801550 <vprintfmt+0x307>
+  801546:	41 83 ef 01          	sub    $0x1,%r15d
+  80154a:	0f 88 57 ff ff ff    	js     8014a7 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801550:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801554:	74 cc                	je     801522 <vprintfmt+0x2d9>
+  801556:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801559:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80155e:	80 fa 5e             	cmp    $0x5e,%dl
+  801561:	77 c2                	ja     801525 <vprintfmt+0x2dc>
+  801563:	eb bd                	jmp    801522 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  801565:	40 84 f6             	test   %sil,%sil
+  801568:	75 26                	jne    801590 <vprintfmt+0x347>
+    switch (lflag) {
+  80156a:	85 d2                	test   %edx,%edx
+  80156c:	74 59                	je     8015c7 <vprintfmt+0x37e>
+  80156e:	83 fa 01             	cmp    $0x1,%edx
+  801571:	74 7b                	je     8015ee <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  801573:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801576:	83 f8 2f             	cmp    $0x2f,%eax
+  801579:	0f 87 96 00 00 00    	ja     801615 <vprintfmt+0x3cc>
+  80157f:	89 c2                	mov    %eax,%edx
+  801581:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801585:	83 c0 08             	add    $0x8,%eax
+  801588:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80158b:	4c 8b 22             	mov    (%rdx),%r12
+  80158e:	eb 17                	jmp    8015a7 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  801590:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801593:	83 f8 2f             	cmp    $0x2f,%eax
+  801596:	77 21                	ja     8015b9 <vprintfmt+0x370>
+  801598:	89 c2                	mov    %eax,%edx
+  80159a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80159e:	83 c0 08             	add    $0x8,%eax
+  8015a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015a4:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8015a7:	4d 85 e4             	test   %r12,%r12
+  8015aa:	78 7a                	js     801626 <vprintfmt+0x3dd>
+            num = i;
+  8015ac:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8015af:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8015b4:	e9 50 02 00 00       	jmp    801809 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8015b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015c5:	eb dd                	jmp    8015a4 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8015c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8015cd:	77 11                	ja     8015e0 <vprintfmt+0x397>
+  8015cf:	89 c2                	mov    %eax,%edx
+  8015d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015d5:	83 c0 08             	add    $0x8,%eax
+  8015d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015db:	4c 63 22             	movslq (%rdx),%r12
+  8015de:	eb c7                	jmp    8015a7 <vprintfmt+0x35e>
+  8015e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015ec:	eb ed                	jmp    8015db <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8015ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8015f4:	77 11                	ja     801607 <vprintfmt+0x3be>
+  8015f6:	89 c2                	mov    %eax,%edx
+  8015f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015fc:	83 c0 08             	add    $0x8,%eax
+  8015ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801602:	4c 8b 22             	mov    (%rdx),%r12
+  801605:	eb a0                	jmp    8015a7 <vprintfmt+0x35e>
+  801607:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80160b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80160f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801613:	eb ed                	jmp    801602 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  801615:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801619:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80161d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801621:	e9 65 ff ff ff       	jmp    80158b <vprintfmt+0x342>
+                putch('-', put_arg);
+  801626:	4c 89 ee             	mov    %r13,%rsi
+  801629:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80162e:	41 ff d6             	call   *%r14
+                i = -i;
+  801631:	49 f7 dc             	neg    %r12
+  801634:	e9 73 ff ff ff       	jmp    8015ac <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  801639:	40 84 f6             	test   %sil,%sil
+  80163c:	75 32                	jne    801670 <vprintfmt+0x427>
+    switch (lflag) {
+  80163e:	85 d2                	test   %edx,%edx
+  801640:	74 5d                	je     80169f <vprintfmt+0x456>
+  801642:	83 fa 01             	cmp    $0x1,%edx
+  801645:	0f 84 82 00 00 00    	je     8016cd <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80164b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80164e:	83 f8 2f             	cmp    $0x2f,%eax
+  801651:	0f 87 a5 00 00 00    	ja     8016fc <vprintfmt+0x4b3>
+  801657:	89 c2                	mov    %eax,%edx
+  801659:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80165d:	83 c0 08             	add    $0x8,%eax
+  801660:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801663:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801666:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80166b:	e9 99 01 00 00       	jmp    801809 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801670:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801673:	83 f8 2f             	cmp    $0x2f,%eax
+  801676:	77 19                	ja     801691 <vprintfmt+0x448>
+  801678:	89 c2                	mov    %eax,%edx
+  80167a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80167e:	83 c0 08             	add    $0x8,%eax
+  801681:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801684:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801687:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80168c:	e9 78 01 00 00       	jmp    801809 <vprintfmt+0x5c0>
+  801691:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801695:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801699:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80169d:	eb e5                	jmp    801684 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80169f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8016a5:	77 18                	ja     8016bf <vprintfmt+0x476>
+  8016a7:	89 c2                	mov    %eax,%edx
+  8016a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016ad:	83 c0 08             	add    $0x8,%eax
+  8016b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016b3:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8016b5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8016ba:	e9 4a 01 00 00       	jmp    801809 <vprintfmt+0x5c0>
+  8016bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016cb:	eb e6                	jmp    8016b3 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8016cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8016d3:	77 19                	ja     8016ee <vprintfmt+0x4a5>
+  8016d5:	89 c2                	mov    %eax,%edx
+  8016d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016db:	83 c0 08             	add    $0x8,%eax
+  8016de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016e1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8016e4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8016e9:	e9 1b 01 00 00       	jmp    801809 <vprintfmt+0x5c0>
+  8016ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016fa:	eb e5                	jmp    8016e1 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8016fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801700:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801704:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801708:	e9 56 ff ff ff       	jmp    801663 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80170d:	40 84 f6             	test   %sil,%sil
+  801710:	75 2e                	jne    801740 <vprintfmt+0x4f7>
+    switch (lflag) {
+  801712:	85 d2                	test   %edx,%edx
+  801714:	74 59                	je     80176f <vprintfmt+0x526>
+  801716:	83 fa 01             	cmp    $0x1,%edx
+  801719:	74 7f                	je     80179a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80171b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80171e:	83 f8 2f             	cmp    $0x2f,%eax
+  801721:	0f 87 9f 00 00 00    	ja     8017c6 <vprintfmt+0x57d>
+  801727:	89 c2                	mov    %eax,%edx
+  801729:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80172d:	83 c0 08             	add    $0x8,%eax
+  801730:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801733:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801736:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80173b:	e9 c9 00 00 00       	jmp    801809 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801740:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801743:	83 f8 2f             	cmp    $0x2f,%eax
+  801746:	77 19                	ja     801761 <vprintfmt+0x518>
+  801748:	89 c2                	mov    %eax,%edx
+  80174a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80174e:	83 c0 08             	add    $0x8,%eax
+  801751:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801754:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801757:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80175c:	e9 a8 00 00 00       	jmp    801809 <vprintfmt+0x5c0>
+  801761:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801765:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801769:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80176d:	eb e5                	jmp    801754 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80176f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801772:	83 f8 2f             	cmp    $0x2f,%eax
+  801775:	77 15                	ja     80178c <vprintfmt+0x543>
+  801777:	89 c2                	mov    %eax,%edx
+  801779:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80177d:	83 c0 08             	add    $0x8,%eax
+  801780:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801783:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801785:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80178a:	eb 7d                	jmp    801809 <vprintfmt+0x5c0>
+  80178c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801790:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801794:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801798:	eb e9                	jmp    801783 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80179a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80179d:	83 f8 2f             	cmp    $0x2f,%eax
+  8017a0:	77 16                	ja     8017b8 <vprintfmt+0x56f>
+  8017a2:	89 c2                	mov    %eax,%edx
+  8017a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8017a8:	83 c0 08             	add    $0x8,%eax
+  8017ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8017ae:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8017b1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8017b6:	eb 51                	jmp    801809 <vprintfmt+0x5c0>
+  8017b8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8017bc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8017c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017c4:	eb e8                	jmp    8017ae <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8017c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8017ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8017ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017d2:	e9 5c ff ff ff       	jmp    801733 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8017d7:	4c 89 ee             	mov    %r13,%rsi
+  8017da:	bf 30 00 00 00       	mov    $0x30,%edi
+  8017df:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8017e2:	4c 89 ee             	mov    %r13,%rsi
+  8017e5:	bf 78 00 00 00       	mov    $0x78,%edi
+  8017ea:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8017ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8017f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8017f3:	77 47                	ja     80183c <vprintfmt+0x5f3>
+  8017f5:	89 c2                	mov    %eax,%edx
+  8017f7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8017fb:	83 c0 08             	add    $0x8,%eax
+  8017fe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801801:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801804:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801809:	48 83 ec 08          	sub    $0x8,%rsp
+  80180d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801811:	0f 94 c0             	sete   %al
+  801814:	0f b6 c0             	movzbl %al,%eax
+  801817:	50                   	push   %rax
+  801818:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80181d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801821:	4c 89 ee             	mov    %r13,%rsi
+  801824:	4c 89 f7             	mov    %r14,%rdi
+  801827:	48 b8 3e 11 80 00 00 	movabs $0x80113e,%rax
+  80182e:	00 00 00 
+  801831:	ff d0                	call   *%rax
+            break;
+  801833:	48 83 c4 10          	add    $0x10,%rsp
+  801837:	e9 3e fa ff ff       	jmp    80127a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80183c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801840:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801844:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801848:	eb b7                	jmp    801801 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80184a:	40 84 f6             	test   %sil,%sil
+  80184d:	75 2b                	jne    80187a <vprintfmt+0x631>
+    switch (lflag) {
+  80184f:	85 d2                	test   %edx,%edx
+  801851:	74 56                	je     8018a9 <vprintfmt+0x660>
+  801853:	83 fa 01             	cmp    $0x1,%edx
+  801856:	74 7f                	je     8018d7 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  801858:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80185b:	83 f8 2f             	cmp    $0x2f,%eax
+  80185e:	0f 87 a2 00 00 00    	ja     801906 <vprintfmt+0x6bd>
+  801864:	89 c2                	mov    %eax,%edx
+  801866:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80186a:	83 c0 08             	add    $0x8,%eax
+  80186d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801870:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801873:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801878:	eb 8f                	jmp    801809 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80187a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80187d:	83 f8 2f             	cmp    $0x2f,%eax
+  801880:	77 19                	ja     80189b <vprintfmt+0x652>
+  801882:	89 c2                	mov    %eax,%edx
+  801884:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801888:	83 c0 08             	add    $0x8,%eax
+  80188b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80188e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801891:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801896:	e9 6e ff ff ff       	jmp    801809 <vprintfmt+0x5c0>
+  80189b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80189f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8018a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018a7:	eb e5                	jmp    80188e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8018a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8018af:	77 18                	ja     8018c9 <vprintfmt+0x680>
+  8018b1:	89 c2                	mov    %eax,%edx
+  8018b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8018b7:	83 c0 08             	add    $0x8,%eax
+  8018ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018bd:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8018bf:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8018c4:	e9 40 ff ff ff       	jmp    801809 <vprintfmt+0x5c0>
+  8018c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8018cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8018d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018d5:	eb e6                	jmp    8018bd <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8018d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018da:	83 f8 2f             	cmp    $0x2f,%eax
+  8018dd:	77 19                	ja     8018f8 <vprintfmt+0x6af>
+  8018df:	89 c2                	mov    %eax,%edx
+  8018e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8018e5:	83 c0 08             	add    $0x8,%eax
+  8018e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018eb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8018ee:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8018f3:	e9 11 ff ff ff       	jmp    801809 <vprintfmt+0x5c0>
+  8018f8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8018fc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801900:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801904:	eb e5                	jmp    8018eb <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801906:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80190a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80190e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801912:	e9 59 ff ff ff       	jmp    801870 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  801917:	4c 89 ee             	mov    %r13,%rsi
+  80191a:	bf 25 00 00 00       	mov    $0x25,%edi
+  80191f:	41 ff d6             	call   *%r14
+            break;
+  801922:	e9 53 f9 ff ff       	jmp    80127a <vprintfmt+0x31>
+            putch('%', put_arg);
+  801927:	4c 89 ee             	mov    %r13,%rsi
+  80192a:	bf 25 00 00 00       	mov    $0x25,%edi
+  80192f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801932:	48 83 eb 01          	sub    $0x1,%rbx
+  801936:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80193a:	75 f6                	jne    801932 <vprintfmt+0x6e9>
+  80193c:	e9 39 f9 ff ff       	jmp    80127a <vprintfmt+0x31>
+}
+  801941:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801945:	5b                   	pop    %rbx
+  801946:	41 5c                	pop    %r12
+  801948:	41 5d                	pop    %r13
+  80194a:	41 5e                	pop    %r14
+  80194c:	41 5f                	pop    %r15
+  80194e:	5d                   	pop    %rbp
+  80194f:	c3                   	ret
+
+0000000000801950 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801950:	55                   	push   %rbp
+  801951:	48 89 e5             	mov    %rsp,%rbp
+  801954:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801958:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80195c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801961:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801965:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80196c:	48 85 ff             	test   %rdi,%rdi
+  80196f:	74 2b                	je     80199c <vsnprintf+0x4c>
+  801971:	48 85 f6             	test   %rsi,%rsi
+  801974:	74 26                	je     80199c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801976:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80197a:	48 bf f4 11 80 00 00 	movabs $0x8011f4,%rdi
+  801981:	00 00 00 
+  801984:	48 b8 49 12 80 00 00 	movabs $0x801249,%rax
+  80198b:	00 00 00 
+  80198e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801990:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801994:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801997:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80199a:	c9                   	leave
+  80199b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80199c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019a1:	eb f7                	jmp    80199a <vsnprintf+0x4a>
+
+00000000008019a3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8019a3:	55                   	push   %rbp
+  8019a4:	48 89 e5             	mov    %rsp,%rbp
+  8019a7:	48 83 ec 50          	sub    $0x50,%rsp
+  8019ab:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8019af:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8019b3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8019b7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8019be:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8019c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019c6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8019ca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8019ce:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8019d2:	48 b8 50 19 80 00 00 	movabs $0x801950,%rax
+  8019d9:	00 00 00 
+  8019dc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8019de:	c9                   	leave
+  8019df:	c3                   	ret
+
+00000000008019e0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8019e0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8019e3:	74 10                	je     8019f5 <strlen+0x15>
+    size_t n = 0;
+  8019e5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8019ea:	48 83 c0 01          	add    $0x1,%rax
+  8019ee:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8019f2:	75 f6                	jne    8019ea <strlen+0xa>
+  8019f4:	c3                   	ret
+    size_t n = 0;
+  8019f5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8019fa:	c3                   	ret
+
+00000000008019fb <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8019fb:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8019fe:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801a03:	48 85 f6             	test   %rsi,%rsi
+  801a06:	74 11                	je     801a19 <strnlen+0x1e>
+  801a08:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801a0c:	74 0c                	je     801a1a <strnlen+0x1f>
+  801a0e:	48 83 c2 01          	add    $0x1,%rdx
+  801a12:	48 39 d0             	cmp    %rdx,%rax
+  801a15:	75 f1                	jne    801a08 <strnlen+0xd>
+  801a17:	eb 04                	jmp    801a1d <strnlen+0x22>
+  801a19:	c3                   	ret
+  801a1a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801a1d:	c3                   	ret
+
+0000000000801a1e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801a1e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801a21:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a26:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801a2a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801a2d:	48 83 c2 01          	add    $0x1,%rdx
+  801a31:	84 c9                	test   %cl,%cl
+  801a33:	75 f1                	jne    801a26 <strcpy+0x8>
+        ;
+    return res;
+}
+  801a35:	c3                   	ret
+
+0000000000801a36 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801a36:	55                   	push   %rbp
+  801a37:	48 89 e5             	mov    %rsp,%rbp
+  801a3a:	41 54                	push   %r12
+  801a3c:	53                   	push   %rbx
+  801a3d:	48 89 fb             	mov    %rdi,%rbx
+  801a40:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801a43:	48 b8 e0 19 80 00 00 	movabs $0x8019e0,%rax
+  801a4a:	00 00 00 
+  801a4d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801a4f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801a53:	4c 89 e6             	mov    %r12,%rsi
+  801a56:	48 b8 1e 1a 80 00 00 	movabs $0x801a1e,%rax
+  801a5d:	00 00 00 
+  801a60:	ff d0                	call   *%rax
+    return dst;
+}
+  801a62:	48 89 d8             	mov    %rbx,%rax
+  801a65:	5b                   	pop    %rbx
+  801a66:	41 5c                	pop    %r12
+  801a68:	5d                   	pop    %rbp
+  801a69:	c3                   	ret
+
+0000000000801a6a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801a6a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801a6d:	48 85 d2             	test   %rdx,%rdx
+  801a70:	74 1f                	je     801a91 <strncpy+0x27>
+  801a72:	48 01 fa             	add    %rdi,%rdx
+  801a75:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801a78:	48 83 c1 01          	add    $0x1,%rcx
+  801a7c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801a80:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801a84:	41 80 f8 01          	cmp    $0x1,%r8b
+  801a88:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801a8c:	48 39 ca             	cmp    %rcx,%rdx
+  801a8f:	75 e7                	jne    801a78 <strncpy+0xe>
+    }
+    return ret;
+}
+  801a91:	c3                   	ret
+
+0000000000801a92 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801a92:	48 89 f8             	mov    %rdi,%rax
+  801a95:	48 85 d2             	test   %rdx,%rdx
+  801a98:	74 24                	je     801abe <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801a9a:	48 83 ea 01          	sub    $0x1,%rdx
+  801a9e:	74 1b                	je     801abb <strlcpy+0x29>
+  801aa0:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801aa4:	0f b6 16             	movzbl (%rsi),%edx
+  801aa7:	84 d2                	test   %dl,%dl
+  801aa9:	74 10                	je     801abb <strlcpy+0x29>
+            *dst++ = *src++;
+  801aab:	48 83 c6 01          	add    $0x1,%rsi
+  801aaf:	48 83 c0 01          	add    $0x1,%rax
+  801ab3:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801ab6:	48 39 c8             	cmp    %rcx,%rax
+  801ab9:	75 e9                	jne    801aa4 <strlcpy+0x12>
+        *dst = '\0';
+  801abb:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801abe:	48 29 f8             	sub    %rdi,%rax
+}
+  801ac1:	c3                   	ret
+
+0000000000801ac2 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801ac2:	0f b6 07             	movzbl (%rdi),%eax
+  801ac5:	84 c0                	test   %al,%al
+  801ac7:	74 13                	je     801adc <strcmp+0x1a>
+  801ac9:	38 06                	cmp    %al,(%rsi)
+  801acb:	75 0f                	jne    801adc <strcmp+0x1a>
+  801acd:	48 83 c7 01          	add    $0x1,%rdi
+  801ad1:	48 83 c6 01          	add    $0x1,%rsi
+  801ad5:	0f b6 07             	movzbl (%rdi),%eax
+  801ad8:	84 c0                	test   %al,%al
+  801ada:	75 ed                	jne    801ac9 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801adc:	0f b6 c0             	movzbl %al,%eax
+  801adf:	0f b6 16             	movzbl (%rsi),%edx
+  801ae2:	29 d0                	sub    %edx,%eax
+}
+  801ae4:	c3                   	ret
+
+0000000000801ae5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801ae5:	48 85 d2             	test   %rdx,%rdx
+  801ae8:	74 1f                	je     801b09 <strncmp+0x24>
+  801aea:	0f b6 07             	movzbl (%rdi),%eax
+  801aed:	84 c0                	test   %al,%al
+  801aef:	74 1e                	je     801b0f <strncmp+0x2a>
+  801af1:	3a 06                	cmp    (%rsi),%al
+  801af3:	75 1a                	jne    801b0f <strncmp+0x2a>
+  801af5:	48 83 c7 01          	add    $0x1,%rdi
+  801af9:	48 83 c6 01          	add    $0x1,%rsi
+  801afd:	48 83 ea 01          	sub    $0x1,%rdx
+  801b01:	75 e7                	jne    801aea <strncmp+0x5>
+
+    if (!n) return 0;
+  801b03:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b08:	c3                   	ret
+  801b09:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b0e:	c3                   	ret
+  801b0f:	48 85 d2             	test   %rdx,%rdx
+  801b12:	74 09                	je     801b1d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801b14:	0f b6 07             	movzbl (%rdi),%eax
+  801b17:	0f b6 16             	movzbl (%rsi),%edx
+  801b1a:	29 d0                	sub    %edx,%eax
+  801b1c:	c3                   	ret
+    if (!n) return 0;
+  801b1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b22:	c3                   	ret
+
+0000000000801b23 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801b23:	0f b6 17             	movzbl (%rdi),%edx
+  801b26:	84 d2                	test   %dl,%dl
+  801b28:	74 18                	je     801b42 <strchr+0x1f>
+        if (*str == c) {
+  801b2a:	0f be d2             	movsbl %dl,%edx
+  801b2d:	39 f2                	cmp    %esi,%edx
+  801b2f:	74 17                	je     801b48 <strchr+0x25>
+    for (; *str; str++) {
+  801b31:	48 83 c7 01          	add    $0x1,%rdi
+  801b35:	0f b6 17             	movzbl (%rdi),%edx
+  801b38:	84 d2                	test   %dl,%dl
+  801b3a:	75 ee                	jne    801b2a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b41:	c3                   	ret
+  801b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b47:	c3                   	ret
+  801b48:	48 89 f8             	mov    %rdi,%rax
+}
+  801b4b:	c3                   	ret
+
+0000000000801b4c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801b4c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801b4f:	0f b6 17             	movzbl (%rdi),%edx
+  801b52:	84 d2                	test   %dl,%dl
+  801b54:	74 13                	je     801b69 <strfind+0x1d>
+  801b56:	0f be d2             	movsbl %dl,%edx
+  801b59:	39 f2                	cmp    %esi,%edx
+  801b5b:	74 0b                	je     801b68 <strfind+0x1c>
+  801b5d:	48 83 c0 01          	add    $0x1,%rax
+  801b61:	0f b6 10             	movzbl (%rax),%edx
+  801b64:	84 d2                	test   %dl,%dl
+  801b66:	75 ee                	jne    801b56 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801b68:	c3                   	ret
+  801b69:	c3                   	ret
+
+0000000000801b6a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801b6a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801b6d:	48 89 f8             	mov    %rdi,%rax
+  801b70:	48 f7 d8             	neg    %rax
+  801b73:	83 e0 07             	and    $0x7,%eax
+  801b76:	49 89 d1             	mov    %rdx,%r9
+  801b79:	49 29 c1             	sub    %rax,%r9
+  801b7c:	78 36                	js     801bb4 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801b7e:	40 0f b6 c6          	movzbl %sil,%eax
+  801b82:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801b89:	01 01 01 
+  801b8c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801b90:	40 f6 c7 07          	test   $0x7,%dil
+  801b94:	75 38                	jne    801bce <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801b96:	4c 89 c9             	mov    %r9,%rcx
+  801b99:	48 c1 f9 03          	sar    $0x3,%rcx
+  801b9d:	74 0c                	je     801bab <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801b9f:	fc                   	cld
+  801ba0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801ba3:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801ba7:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801bab:	4d 85 c9             	test   %r9,%r9
+  801bae:	75 45                	jne    801bf5 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801bb0:	4c 89 c0             	mov    %r8,%rax
+  801bb3:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801bb4:	48 85 d2             	test   %rdx,%rdx
+  801bb7:	74 f7                	je     801bb0 <memset+0x46>
+  801bb9:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801bbc:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801bbf:	48 83 c0 01          	add    $0x1,%rax
+  801bc3:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801bc7:	48 39 c2             	cmp    %rax,%rdx
+  801bca:	75 f3                	jne    801bbf <memset+0x55>
+  801bcc:	eb e2                	jmp    801bb0 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801bce:	40 f6 c7 01          	test   $0x1,%dil
+  801bd2:	74 06                	je     801bda <memset+0x70>
+  801bd4:	88 07                	mov    %al,(%rdi)
+  801bd6:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801bda:	40 f6 c7 02          	test   $0x2,%dil
+  801bde:	74 07                	je     801be7 <memset+0x7d>
+  801be0:	66 89 07             	mov    %ax,(%rdi)
+  801be3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801be7:	40 f6 c7 04          	test   $0x4,%dil
+  801beb:	74 a9                	je     801b96 <memset+0x2c>
+  801bed:	89 07                	mov    %eax,(%rdi)
+  801bef:	48 83 c7 04          	add    $0x4,%rdi
+  801bf3:	eb a1                	jmp    801b96 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801bf5:	41 f6 c1 04          	test   $0x4,%r9b
+  801bf9:	74 06                	je     801c01 <memset+0x97>
+  801bfb:	89 07                	mov    %eax,(%rdi)
+  801bfd:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801c01:	41 f6 c1 02          	test   $0x2,%r9b
+  801c05:	74 07                	je     801c0e <memset+0xa4>
+  801c07:	66 89 07             	mov    %ax,(%rdi)
+  801c0a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801c0e:	41 f6 c1 01          	test   $0x1,%r9b
+  801c12:	74 9c                	je     801bb0 <memset+0x46>
+  801c14:	88 07                	mov    %al,(%rdi)
+  801c16:	eb 98                	jmp    801bb0 <memset+0x46>
+
+0000000000801c18 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801c18:	48 89 f8             	mov    %rdi,%rax
+  801c1b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801c1e:	48 39 fe             	cmp    %rdi,%rsi
+  801c21:	73 3b                	jae    801c5e <memmove+0x46>
+  801c23:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801c27:	48 39 d7             	cmp    %rdx,%rdi
+  801c2a:	73 32                	jae    801c5e <memmove+0x46>
+        s += n;
+        d += n;
+  801c2c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801c30:	48 89 d6             	mov    %rdx,%rsi
+  801c33:	48 09 fe             	or     %rdi,%rsi
+  801c36:	48 09 ce             	or     %rcx,%rsi
+  801c39:	40 f6 c6 07          	test   $0x7,%sil
+  801c3d:	75 12                	jne    801c51 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801c3f:	48 83 ef 08          	sub    $0x8,%rdi
+  801c43:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801c47:	48 c1 e9 03          	shr    $0x3,%rcx
+  801c4b:	fd                   	std
+  801c4c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801c4f:	fc                   	cld
+  801c50:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801c51:	48 83 ef 01          	sub    $0x1,%rdi
+  801c55:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801c59:	fd                   	std
+  801c5a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801c5c:	eb f1                	jmp    801c4f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801c5e:	48 89 f2             	mov    %rsi,%rdx
+  801c61:	48 09 c2             	or     %rax,%rdx
+  801c64:	48 09 ca             	or     %rcx,%rdx
+  801c67:	f6 c2 07             	test   $0x7,%dl
+  801c6a:	75 0c                	jne    801c78 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801c6c:	48 c1 e9 03          	shr    $0x3,%rcx
+  801c70:	48 89 c7             	mov    %rax,%rdi
+  801c73:	fc                   	cld
+  801c74:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801c77:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801c78:	48 89 c7             	mov    %rax,%rdi
+  801c7b:	fc                   	cld
+  801c7c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801c7e:	c3                   	ret
+
+0000000000801c7f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801c7f:	55                   	push   %rbp
+  801c80:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801c83:	48 b8 18 1c 80 00 00 	movabs $0x801c18,%rax
+  801c8a:	00 00 00 
+  801c8d:	ff d0                	call   *%rax
+}
+  801c8f:	5d                   	pop    %rbp
+  801c90:	c3                   	ret
+
+0000000000801c91 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801c91:	55                   	push   %rbp
+  801c92:	48 89 e5             	mov    %rsp,%rbp
+  801c95:	41 57                	push   %r15
+  801c97:	41 56                	push   %r14
+  801c99:	41 55                	push   %r13
+  801c9b:	41 54                	push   %r12
+  801c9d:	53                   	push   %rbx
+  801c9e:	48 83 ec 08          	sub    $0x8,%rsp
+  801ca2:	49 89 fe             	mov    %rdi,%r14
+  801ca5:	49 89 f7             	mov    %rsi,%r15
+  801ca8:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801cab:	48 89 f7             	mov    %rsi,%rdi
+  801cae:	48 b8 e0 19 80 00 00 	movabs $0x8019e0,%rax
+  801cb5:	00 00 00 
+  801cb8:	ff d0                	call   *%rax
+  801cba:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801cbd:	48 89 de             	mov    %rbx,%rsi
+  801cc0:	4c 89 f7             	mov    %r14,%rdi
+  801cc3:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  801cca:	00 00 00 
+  801ccd:	ff d0                	call   *%rax
+  801ccf:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801cd2:	48 39 c3             	cmp    %rax,%rbx
+  801cd5:	74 36                	je     801d0d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801cd7:	48 89 d8             	mov    %rbx,%rax
+  801cda:	4c 29 e8             	sub    %r13,%rax
+  801cdd:	49 39 c4             	cmp    %rax,%r12
+  801ce0:	73 31                	jae    801d13 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801ce2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801ce7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801ceb:	4c 89 fe             	mov    %r15,%rsi
+  801cee:	48 b8 7f 1c 80 00 00 	movabs $0x801c7f,%rax
+  801cf5:	00 00 00 
+  801cf8:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801cfa:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801cfe:	48 83 c4 08          	add    $0x8,%rsp
+  801d02:	5b                   	pop    %rbx
+  801d03:	41 5c                	pop    %r12
+  801d05:	41 5d                	pop    %r13
+  801d07:	41 5e                	pop    %r14
+  801d09:	41 5f                	pop    %r15
+  801d0b:	5d                   	pop    %rbp
+  801d0c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801d0d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801d11:	eb eb                	jmp    801cfe <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801d13:	48 83 eb 01          	sub    $0x1,%rbx
+  801d17:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801d1b:	48 89 da             	mov    %rbx,%rdx
+  801d1e:	4c 89 fe             	mov    %r15,%rsi
+  801d21:	48 b8 7f 1c 80 00 00 	movabs $0x801c7f,%rax
+  801d28:	00 00 00 
+  801d2b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801d2d:	49 01 de             	add    %rbx,%r14
+  801d30:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801d35:	eb c3                	jmp    801cfa <strlcat+0x69>
+
+0000000000801d37 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801d37:	48 85 d2             	test   %rdx,%rdx
+  801d3a:	74 2d                	je     801d69 <memcmp+0x32>
+  801d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801d41:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801d45:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801d4a:	44 38 c1             	cmp    %r8b,%cl
+  801d4d:	75 0f                	jne    801d5e <memcmp+0x27>
+    while (n-- > 0) {
+  801d4f:	48 83 c0 01          	add    $0x1,%rax
+  801d53:	48 39 c2             	cmp    %rax,%rdx
+  801d56:	75 e9                	jne    801d41 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801d58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d5d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801d5e:	0f b6 c1             	movzbl %cl,%eax
+  801d61:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801d65:	44 29 c0             	sub    %r8d,%eax
+  801d68:	c3                   	ret
+    return 0;
+  801d69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d6e:	c3                   	ret
+
+0000000000801d6f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801d6f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801d73:	48 39 c7             	cmp    %rax,%rdi
+  801d76:	73 0f                	jae    801d87 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801d78:	40 38 37             	cmp    %sil,(%rdi)
+  801d7b:	74 0e                	je     801d8b <memfind+0x1c>
+    for (; src < end; src++) {
+  801d7d:	48 83 c7 01          	add    $0x1,%rdi
+  801d81:	48 39 f8             	cmp    %rdi,%rax
+  801d84:	75 f2                	jne    801d78 <memfind+0x9>
+  801d86:	c3                   	ret
+  801d87:	48 89 f8             	mov    %rdi,%rax
+  801d8a:	c3                   	ret
+  801d8b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801d8e:	c3                   	ret
+
+0000000000801d8f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801d8f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801d92:	0f b6 37             	movzbl (%rdi),%esi
+  801d95:	40 80 fe 20          	cmp    $0x20,%sil
+  801d99:	74 06                	je     801da1 <strtol+0x12>
+  801d9b:	40 80 fe 09          	cmp    $0x9,%sil
+  801d9f:	75 13                	jne    801db4 <strtol+0x25>
+  801da1:	48 83 c7 01          	add    $0x1,%rdi
+  801da5:	0f b6 37             	movzbl (%rdi),%esi
+  801da8:	40 80 fe 20          	cmp    $0x20,%sil
+  801dac:	74 f3                	je     801da1 <strtol+0x12>
+  801dae:	40 80 fe 09          	cmp    $0x9,%sil
+  801db2:	74 ed                	je     801da1 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801db4:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801db7:	83 e0 fd             	and    $0xfffffffd,%eax
+  801dba:	3c 01                	cmp    $0x1,%al
+  801dbc:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801dc0:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801dc6:	75 0f                	jne    801dd7 <strtol+0x48>
+  801dc8:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801dcb:	74 14                	je     801de1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801dcd:	85 d2                	test   %edx,%edx
+  801dcf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801dd4:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801dd7:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801ddc:	4c 63 ca             	movslq %edx,%r9
+  801ddf:	eb 36                	jmp    801e17 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801de1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801de5:	74 0f                	je     801df6 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801de7:	85 d2                	test   %edx,%edx
+  801de9:	75 ec                	jne    801dd7 <strtol+0x48>
+        s++;
+  801deb:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801def:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801df4:	eb e1                	jmp    801dd7 <strtol+0x48>
+        s += 2;
+  801df6:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801dfa:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801dff:	eb d6                	jmp    801dd7 <strtol+0x48>
+            dig -= '0';
+  801e01:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801e04:	44 0f b6 c1          	movzbl %cl,%r8d
+  801e08:	41 39 d0             	cmp    %edx,%r8d
+  801e0b:	7d 21                	jge    801e2e <strtol+0x9f>
+        val = val * base + dig;
+  801e0d:	49 0f af c1          	imul   %r9,%rax
+  801e11:	0f b6 c9             	movzbl %cl,%ecx
+  801e14:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801e17:	48 83 c7 01          	add    $0x1,%rdi
+  801e1b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801e1f:	80 f9 39             	cmp    $0x39,%cl
+  801e22:	76 dd                	jbe    801e01 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801e24:	80 f9 7b             	cmp    $0x7b,%cl
+  801e27:	77 05                	ja     801e2e <strtol+0x9f>
+            dig -= 'a' - 10;
+  801e29:	83 e9 57             	sub    $0x57,%ecx
+  801e2c:	eb d6                	jmp    801e04 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801e2e:	4d 85 d2             	test   %r10,%r10
+  801e31:	74 03                	je     801e36 <strtol+0xa7>
+  801e33:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801e36:	48 89 c2             	mov    %rax,%rdx
+  801e39:	48 f7 da             	neg    %rdx
+  801e3c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801e40:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801e44:	c3                   	ret
+
+0000000000801e45 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801e45:	55                   	push   %rbp
+  801e46:	48 89 e5             	mov    %rsp,%rbp
+  801e49:	53                   	push   %rbx
+  801e4a:	48 89 fa             	mov    %rdi,%rdx
+  801e4d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801e50:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e5a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e5f:	be 00 00 00 00       	mov    $0x0,%esi
+  801e64:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e6a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801e6c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e70:	c9                   	leave
+  801e71:	c3                   	ret
+
+0000000000801e72 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801e72:	55                   	push   %rbp
+  801e73:	48 89 e5             	mov    %rsp,%rbp
+  801e76:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e77:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e81:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e8b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e90:	be 00 00 00 00       	mov    $0x0,%esi
+  801e95:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e9b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e9d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ea1:	c9                   	leave
+  801ea2:	c3                   	ret
+
+0000000000801ea3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801ea3:	55                   	push   %rbp
+  801ea4:	48 89 e5             	mov    %rsp,%rbp
+  801ea7:	53                   	push   %rbx
+  801ea8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801eac:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801eaf:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801eb4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801eb9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ebe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ec3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ece:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ed0:	48 85 c0             	test   %rax,%rax
+  801ed3:	7f 06                	jg     801edb <sys_env_destroy+0x38>
+}
+  801ed5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ed9:	c9                   	leave
+  801eda:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801edb:	49 89 c0             	mov    %rax,%r8
+  801ede:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801ee3:	48 ba 90 46 80 00 00 	movabs $0x804690,%rdx
+  801eea:	00 00 00 
+  801eed:	be 26 00 00 00       	mov    $0x26,%esi
+  801ef2:	48 bf af 46 80 00 00 	movabs $0x8046af,%rdi
+  801ef9:	00 00 00 
+  801efc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f01:	49 b9 a9 0f 80 00 00 	movabs $0x800fa9,%r9
+  801f08:	00 00 00 
+  801f0b:	41 ff d1             	call   *%r9
+
+0000000000801f0e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801f0e:	55                   	push   %rbp
+  801f0f:	48 89 e5             	mov    %rsp,%rbp
+  801f12:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f13:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f18:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f27:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f2c:	be 00 00 00 00       	mov    $0x0,%esi
+  801f31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f37:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f3d:	c9                   	leave
+  801f3e:	c3                   	ret
+
+0000000000801f3f <sys_yield>:
+
+void
+sys_yield(void) {
+  801f3f:	55                   	push   %rbp
+  801f40:	48 89 e5             	mov    %rsp,%rbp
+  801f43:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f44:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f49:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f58:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f5d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f68:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f6e:	c9                   	leave
+  801f6f:	c3                   	ret
+
+0000000000801f70 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801f70:	55                   	push   %rbp
+  801f71:	48 89 e5             	mov    %rsp,%rbp
+  801f74:	53                   	push   %rbx
+  801f75:	48 89 fa             	mov    %rdi,%rdx
+  801f78:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801f7b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f80:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801f87:	00 00 00 
+  801f8a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f8f:	be 00 00 00 00       	mov    $0x0,%esi
+  801f94:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f9a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801f9c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fa0:	c9                   	leave
+  801fa1:	c3                   	ret
+
+0000000000801fa2 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801fa2:	55                   	push   %rbp
+  801fa3:	48 89 e5             	mov    %rsp,%rbp
+  801fa6:	53                   	push   %rbx
+  801fa7:	49 89 f8             	mov    %rdi,%r8
+  801faa:	48 89 d3             	mov    %rdx,%rbx
+  801fad:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801fb0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801fb5:	4c 89 c2             	mov    %r8,%rdx
+  801fb8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fbb:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801fc6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801fc8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fcc:	c9                   	leave
+  801fcd:	c3                   	ret
+
+0000000000801fce <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801fce:	55                   	push   %rbp
+  801fcf:	48 89 e5             	mov    %rsp,%rbp
+  801fd2:	53                   	push   %rbx
+  801fd3:	48 83 ec 08          	sub    $0x8,%rsp
+  801fd7:	89 f8                	mov    %edi,%eax
+  801fd9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801fdc:	48 63 f9             	movslq %ecx,%rdi
+  801fdf:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801fe2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801fe7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fea:	be 00 00 00 00       	mov    $0x0,%esi
+  801fef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ff5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ff7:	48 85 c0             	test   %rax,%rax
+  801ffa:	7f 06                	jg     802002 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801ffc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802000:	c9                   	leave
+  802001:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802002:	49 89 c0             	mov    %rax,%r8
+  802005:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80200a:	48 ba 90 46 80 00 00 	movabs $0x804690,%rdx
+  802011:	00 00 00 
+  802014:	be 26 00 00 00       	mov    $0x26,%esi
+  802019:	48 bf af 46 80 00 00 	movabs $0x8046af,%rdi
+  802020:	00 00 00 
+  802023:	b8 00 00 00 00       	mov    $0x0,%eax
+  802028:	49 b9 a9 0f 80 00 00 	movabs $0x800fa9,%r9
+  80202f:	00 00 00 
+  802032:	41 ff d1             	call   *%r9
+
+0000000000802035 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802035:	55                   	push   %rbp
+  802036:	48 89 e5             	mov    %rsp,%rbp
+  802039:	53                   	push   %rbx
+  80203a:	48 83 ec 08          	sub    $0x8,%rsp
+  80203e:	89 f8                	mov    %edi,%eax
+  802040:	49 89 f2             	mov    %rsi,%r10
+  802043:	48 89 cf             	mov    %rcx,%rdi
+  802046:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  802049:	48 63 da             	movslq %edx,%rbx
+  80204c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80204f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802054:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802057:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80205a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80205c:	48 85 c0             	test   %rax,%rax
+  80205f:	7f 06                	jg     802067 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802061:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802065:	c9                   	leave
+  802066:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802067:	49 89 c0             	mov    %rax,%r8
+  80206a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80206f:	48 ba 90 46 80 00 00 	movabs $0x804690,%rdx
+  802076:	00 00 00 
+  802079:	be 26 00 00 00       	mov    $0x26,%esi
+  80207e:	48 bf af 46 80 00 00 	movabs $0x8046af,%rdi
+  802085:	00 00 00 
+  802088:	b8 00 00 00 00       	mov    $0x0,%eax
+  80208d:	49 b9 a9 0f 80 00 00 	movabs $0x800fa9,%r9
+  802094:	00 00 00 
+  802097:	41 ff d1             	call   *%r9
+
+000000000080209a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80209a:	55                   	push   %rbp
+  80209b:	48 89 e5             	mov    %rsp,%rbp
+  80209e:	53                   	push   %rbx
+  80209f:	48 83 ec 08          	sub    $0x8,%rsp
+  8020a3:	48 89 f1             	mov    %rsi,%rcx
+  8020a6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8020a9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8020ac:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8020b1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8020b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8020bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8020c1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8020c3:	48 85 c0             	test   %rax,%rax
+  8020c6:	7f 06                	jg     8020ce <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8020c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020cc:	c9                   	leave
+  8020cd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8020ce:	49 89 c0             	mov    %rax,%r8
+  8020d1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8020d6:	48 ba 90 46 80 00 00 	movabs $0x804690,%rdx
+  8020dd:	00 00 00 
+  8020e0:	be 26 00 00 00       	mov    $0x26,%esi
+  8020e5:	48 bf af 46 80 00 00 	movabs $0x8046af,%rdi
+  8020ec:	00 00 00 
+  8020ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f4:	49 b9 a9 0f 80 00 00 	movabs $0x800fa9,%r9
+  8020fb:	00 00 00 
+  8020fe:	41 ff d1             	call   *%r9
+
+0000000000802101 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  802101:	55                   	push   %rbp
+  802102:	48 89 e5             	mov    %rsp,%rbp
+  802105:	53                   	push   %rbx
+  802106:	48 83 ec 08          	sub    $0x8,%rsp
+  80210a:	89 f8                	mov    %edi,%eax
+  80210c:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  80210f:	48 63 f9             	movslq %ecx,%rdi
+  802112:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802115:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80211a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80211d:	be 00 00 00 00       	mov    $0x0,%esi
+  802122:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802128:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80212a:	48 85 c0             	test   %rax,%rax
+  80212d:	7f 06                	jg     802135 <sys_region_advise+0x34>
+}
+  80212f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802133:	c9                   	leave
+  802134:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802135:	49 89 c0             	mov    %rax,%r8
+  802138:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80213d:	48 ba 90 46 80 00 00 	movabs $0x804690,%rdx
+  802144:	00 00 00 
+  802147:	be 26 00 00 00       	mov    $0x26,%esi
+  80214c:	48 bf af 46 80 00 00 	movabs $0x8046af,%rdi
+  802153:	00 00 00 
+  802156:	b8 00 00 00 00       	mov    $0x0,%eax
+  80215b:	49 b9 a9 0f 80 00 00 	movabs $0x800fa9,%r9
+  802162:	00 00 00 
+  802165:	41 ff d1             	call   *%r9
+
+0000000000802168 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802168:	55                   	push   %rbp
+  802169:	48 89 e5             	mov    %rsp,%rbp
+  80216c:	53                   	push   %rbx
+  80216d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  802171:	48 63 ce             	movslq %esi,%rcx
+  802174:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802177:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80217c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802181:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802186:	be 00 00 00 00       	mov    $0x0,%esi
+  80218b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802191:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802193:	48 85 c0             	test   %rax,%rax
+  802196:	7f 06                	jg     80219e <sys_env_set_nice+0x36>
+}
+  802198:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80219c:	c9                   	leave
+  80219d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80219e:	49 89 c0             	mov    %rax,%r8
+  8021a1:	b9 15 00 00 00       	mov    $0x15,%ecx
+  8021a6:	48 ba 90 46 80 00 00 	movabs $0x804690,%rdx
+  8021ad:	00 00 00 
+  8021b0:	be 26 00 00 00       	mov    $0x26,%esi
+  8021b5:	48 bf af 46 80 00 00 	movabs $0x8046af,%rdi
+  8021bc:	00 00 00 
+  8021bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021c4:	49 b9 a9 0f 80 00 00 	movabs $0x800fa9,%r9
+  8021cb:	00 00 00 
+  8021ce:	41 ff d1             	call   *%r9
+
+00000000008021d1 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8021d1:	55                   	push   %rbp
+  8021d2:	48 89 e5             	mov    %rsp,%rbp
+  8021d5:	53                   	push   %rbx
+  8021d6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8021da:	48 63 ce             	movslq %esi,%rcx
+  8021dd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8021e0:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8021e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8021fa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8021fc:	48 85 c0             	test   %rax,%rax
+  8021ff:	7f 06                	jg     802207 <sys_env_set_status+0x36>
+}
+  802201:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802205:	c9                   	leave
+  802206:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802207:	49 89 c0             	mov    %rax,%r8
+  80220a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80220f:	48 ba 90 46 80 00 00 	movabs $0x804690,%rdx
+  802216:	00 00 00 
+  802219:	be 26 00 00 00       	mov    $0x26,%esi
+  80221e:	48 bf af 46 80 00 00 	movabs $0x8046af,%rdi
+  802225:	00 00 00 
+  802228:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222d:	49 b9 a9 0f 80 00 00 	movabs $0x800fa9,%r9
+  802234:	00 00 00 
+  802237:	41 ff d1             	call   *%r9
+
+000000000080223a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80223a:	55                   	push   %rbp
+  80223b:	48 89 e5             	mov    %rsp,%rbp
+  80223e:	53                   	push   %rbx
+  80223f:	48 83 ec 08          	sub    $0x8,%rsp
+  802243:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  802246:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802249:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80224e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802253:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802258:	be 00 00 00 00       	mov    $0x0,%esi
+  80225d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802263:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802265:	48 85 c0             	test   %rax,%rax
+  802268:	7f 06                	jg     802270 <sys_env_set_trapframe+0x36>
+}
+  80226a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80226e:	c9                   	leave
+  80226f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802270:	49 89 c0             	mov    %rax,%r8
+  802273:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802278:	48 ba 90 46 80 00 00 	movabs $0x804690,%rdx
+  80227f:	00 00 00 
+  802282:	be 26 00 00 00       	mov    $0x26,%esi
+  802287:	48 bf af 46 80 00 00 	movabs $0x8046af,%rdi
+  80228e:	00 00 00 
+  802291:	b8 00 00 00 00       	mov    $0x0,%eax
+  802296:	49 b9 a9 0f 80 00 00 	movabs $0x800fa9,%r9
+  80229d:	00 00 00 
+  8022a0:	41 ff d1             	call   *%r9
+
+00000000008022a3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8022a3:	55                   	push   %rbp
+  8022a4:	48 89 e5             	mov    %rsp,%rbp
+  8022a7:	53                   	push   %rbx
+  8022a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8022ac:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8022af:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8022b2:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8022b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8022c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8022c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8022cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8022ce:	48 85 c0             	test   %rax,%rax
+  8022d1:	7f 06                	jg     8022d9 <sys_env_set_pgfault_upcall+0x36>
+}
+  8022d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022d7:	c9                   	leave
+  8022d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8022d9:	49 89 c0             	mov    %rax,%r8
+  8022dc:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8022e1:	48 ba 90 46 80 00 00 	movabs $0x804690,%rdx
+  8022e8:	00 00 00 
+  8022eb:	be 26 00 00 00       	mov    $0x26,%esi
+  8022f0:	48 bf af 46 80 00 00 	movabs $0x8046af,%rdi
+  8022f7:	00 00 00 
+  8022fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ff:	49 b9 a9 0f 80 00 00 	movabs $0x800fa9,%r9
+  802306:	00 00 00 
+  802309:	41 ff d1             	call   *%r9
+
+000000000080230c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80230c:	55                   	push   %rbp
+  80230d:	48 89 e5             	mov    %rsp,%rbp
+  802310:	53                   	push   %rbx
+  802311:	89 f8                	mov    %edi,%eax
+  802313:	49 89 f1             	mov    %rsi,%r9
+  802316:	48 89 d3             	mov    %rdx,%rbx
+  802319:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80231c:	49 63 f0             	movslq %r8d,%rsi
+  80231f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802322:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802327:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80232a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802330:	cd 30                	int    $0x30
+}
+  802332:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802336:	c9                   	leave
+  802337:	c3                   	ret
+
+0000000000802338 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802338:	55                   	push   %rbp
+  802339:	48 89 e5             	mov    %rsp,%rbp
+  80233c:	53                   	push   %rbx
+  80233d:	48 83 ec 08          	sub    $0x8,%rsp
+  802341:	48 89 fa             	mov    %rdi,%rdx
+  802344:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802347:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80234c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802351:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802356:	be 00 00 00 00       	mov    $0x0,%esi
+  80235b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802361:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802363:	48 85 c0             	test   %rax,%rax
+  802366:	7f 06                	jg     80236e <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802368:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80236c:	c9                   	leave
+  80236d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80236e:	49 89 c0             	mov    %rax,%r8
+  802371:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  802376:	48 ba 90 46 80 00 00 	movabs $0x804690,%rdx
+  80237d:	00 00 00 
+  802380:	be 26 00 00 00       	mov    $0x26,%esi
+  802385:	48 bf af 46 80 00 00 	movabs $0x8046af,%rdi
+  80238c:	00 00 00 
+  80238f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802394:	49 b9 a9 0f 80 00 00 	movabs $0x800fa9,%r9
+  80239b:	00 00 00 
+  80239e:	41 ff d1             	call   *%r9
+
+00000000008023a1 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8023a1:	55                   	push   %rbp
+  8023a2:	48 89 e5             	mov    %rsp,%rbp
+  8023a5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8023a6:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8023ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8023b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8023bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8023ca:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8023cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023d0:	c9                   	leave
+  8023d1:	c3                   	ret
+
+00000000008023d2 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8023d2:	55                   	push   %rbp
+  8023d3:	48 89 e5             	mov    %rsp,%rbp
+  8023d6:	53                   	push   %rbx
+  8023d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8023db:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8023de:	48 63 ce             	movslq %esi,%rcx
+  8023e1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8023e4:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8023e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8023ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8023f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8023fb:	48 85 c0             	test   %rax,%rax
+  8023fe:	7f 06                	jg     802406 <sys_sigqueue+0x34>
+}
+  802400:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802404:	c9                   	leave
+  802405:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802406:	49 89 c0             	mov    %rax,%r8
+  802409:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80240e:	48 ba 90 46 80 00 00 	movabs $0x804690,%rdx
+  802415:	00 00 00 
+  802418:	be 26 00 00 00       	mov    $0x26,%esi
+  80241d:	48 bf af 46 80 00 00 	movabs $0x8046af,%rdi
+  802424:	00 00 00 
+  802427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80242c:	49 b9 a9 0f 80 00 00 	movabs $0x800fa9,%r9
+  802433:	00 00 00 
+  802436:	41 ff d1             	call   *%r9
+
+0000000000802439 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  802439:	55                   	push   %rbp
+  80243a:	48 89 e5             	mov    %rsp,%rbp
+  80243d:	53                   	push   %rbx
+  80243e:	48 83 ec 08          	sub    $0x8,%rsp
+  802442:	48 89 fa             	mov    %rdi,%rdx
+  802445:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802448:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80244d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802452:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802457:	be 00 00 00 00       	mov    $0x0,%esi
+  80245c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802462:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802464:	48 85 c0             	test   %rax,%rax
+  802467:	7f 06                	jg     80246f <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  802469:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80246d:	c9                   	leave
+  80246e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80246f:	49 89 c0             	mov    %rax,%r8
+  802472:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802477:	48 ba 90 46 80 00 00 	movabs $0x804690,%rdx
+  80247e:	00 00 00 
+  802481:	be 26 00 00 00       	mov    $0x26,%esi
+  802486:	48 bf af 46 80 00 00 	movabs $0x8046af,%rdi
+  80248d:	00 00 00 
+  802490:	b8 00 00 00 00       	mov    $0x0,%eax
+  802495:	49 b9 a9 0f 80 00 00 	movabs $0x800fa9,%r9
+  80249c:	00 00 00 
+  80249f:	41 ff d1             	call   *%r9
+
+00000000008024a2 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  8024a2:	55                   	push   %rbp
+  8024a3:	48 89 e5             	mov    %rsp,%rbp
+  8024a6:	53                   	push   %rbx
+  8024a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ab:	48 89 f1             	mov    %rsi,%rcx
+  8024ae:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  8024b1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8024b4:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8024b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8024be:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8024c9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8024cb:	48 85 c0             	test   %rax,%rax
+  8024ce:	7f 06                	jg     8024d6 <sys_sigaction+0x34>
+}
+  8024d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024d4:	c9                   	leave
+  8024d5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8024d6:	49 89 c0             	mov    %rax,%r8
+  8024d9:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8024de:	48 ba 90 46 80 00 00 	movabs $0x804690,%rdx
+  8024e5:	00 00 00 
+  8024e8:	be 26 00 00 00       	mov    $0x26,%esi
+  8024ed:	48 bf af 46 80 00 00 	movabs $0x8046af,%rdi
+  8024f4:	00 00 00 
+  8024f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024fc:	49 b9 a9 0f 80 00 00 	movabs $0x800fa9,%r9
+  802503:	00 00 00 
+  802506:	41 ff d1             	call   *%r9
+
+0000000000802509 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  802509:	55                   	push   %rbp
+  80250a:	48 89 e5             	mov    %rsp,%rbp
+  80250d:	53                   	push   %rbx
+  80250e:	48 83 ec 08          	sub    $0x8,%rsp
+  802512:	48 89 f1             	mov    %rsi,%rcx
+  802515:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  802518:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80251b:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802520:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802525:	be 00 00 00 00       	mov    $0x0,%esi
+  80252a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802530:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802532:	48 85 c0             	test   %rax,%rax
+  802535:	7f 06                	jg     80253d <sys_sigprocmask+0x34>
+}
+  802537:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80253b:	c9                   	leave
+  80253c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80253d:	49 89 c0             	mov    %rax,%r8
+  802540:	b9 13 00 00 00       	mov    $0x13,%ecx
+  802545:	48 ba 90 46 80 00 00 	movabs $0x804690,%rdx
+  80254c:	00 00 00 
+  80254f:	be 26 00 00 00       	mov    $0x26,%esi
+  802554:	48 bf af 46 80 00 00 	movabs $0x8046af,%rdi
+  80255b:	00 00 00 
+  80255e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802563:	49 b9 a9 0f 80 00 00 	movabs $0x800fa9,%r9
+  80256a:	00 00 00 
+  80256d:	41 ff d1             	call   *%r9
+
+0000000000802570 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  802570:	55                   	push   %rbp
+  802571:	48 89 e5             	mov    %rsp,%rbp
+  802574:	41 54                	push   %r12
+  802576:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802577:	b8 08 00 00 00       	mov    $0x8,%eax
+  80257c:	cd 30                	int    $0x30
+  80257e:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  802581:	85 c0                	test   %eax,%eax
+  802583:	78 76                	js     8025fb <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  802585:	74 7c                	je     802603 <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  802587:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80258d:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  802594:	00 00 00 
+  802597:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80259c:	89 c2                	mov    %eax,%edx
+  80259e:	be 00 00 00 00       	mov    $0x0,%esi
+  8025a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025a8:	48 b8 35 20 80 00 00 	movabs $0x802035,%rax
+  8025af:	00 00 00 
+  8025b2:	ff d0                	call   *%rax
+  8025b4:	85 c0                	test   %eax,%eax
+  8025b6:	75 7a                	jne    802632 <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  8025b8:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8025bf:	00 00 00 
+  8025c2:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8025c9:	44 89 e7             	mov    %r12d,%edi
+  8025cc:	48 b8 a3 22 80 00 00 	movabs $0x8022a3,%rax
+  8025d3:	00 00 00 
+  8025d6:	ff d0                	call   *%rax
+  8025d8:	85 c0                	test   %eax,%eax
+  8025da:	75 5e                	jne    80263a <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  8025dc:	be 02 00 00 00       	mov    $0x2,%esi
+  8025e1:	44 89 e7             	mov    %r12d,%edi
+  8025e4:	48 b8 d1 21 80 00 00 	movabs $0x8021d1,%rax
+  8025eb:	00 00 00 
+  8025ee:	ff d0                	call   *%rax
+        return -1;
+  8025f0:	85 c0                	test   %eax,%eax
+  8025f2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025f7:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  8025fb:	44 89 e0             	mov    %r12d,%eax
+  8025fe:	5b                   	pop    %rbx
+  8025ff:	41 5c                	pop    %r12
+  802601:	5d                   	pop    %rbp
+  802602:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  802603:	48 b8 0e 1f 80 00 00 	movabs $0x801f0e,%rax
+  80260a:	00 00 00 
+  80260d:	ff d0                	call   *%rax
+  80260f:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  802612:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802619:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802620:	00 00 00 
+  802623:	48 01 d0             	add    %rdx,%rax
+  802626:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  80262d:	00 00 00 
+        return 0;
+  802630:	eb c9                	jmp    8025fb <fork+0x8b>
+        return -1;
+  802632:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802638:	eb c1                	jmp    8025fb <fork+0x8b>
+        return -1;
+  80263a:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802640:	eb b9                	jmp    8025fb <fork+0x8b>
+
+0000000000802642 <sfork>:
+
+envid_t
+sfork() {
+  802642:	55                   	push   %rbp
+  802643:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  802646:	48 ba bd 46 80 00 00 	movabs $0x8046bd,%rdx
+  80264d:	00 00 00 
+  802650:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802655:	48 bf d8 46 80 00 00 	movabs $0x8046d8,%rdi
+  80265c:	00 00 00 
+  80265f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802664:	48 b9 a9 0f 80 00 00 	movabs $0x800fa9,%rcx
+  80266b:	00 00 00 
+  80266e:	ff d1                	call   *%rcx
+
+0000000000802670 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802670:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802677:	ff ff ff 
+  80267a:	48 01 f8             	add    %rdi,%rax
+  80267d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802681:	c3                   	ret
+
+0000000000802682 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802682:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802689:	ff ff ff 
+  80268c:	48 01 f8             	add    %rdi,%rax
+  80268f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802693:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802699:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80269d:	c3                   	ret
+
+000000000080269e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80269e:	55                   	push   %rbp
+  80269f:	48 89 e5             	mov    %rsp,%rbp
+  8026a2:	41 57                	push   %r15
+  8026a4:	41 56                	push   %r14
+  8026a6:	41 55                	push   %r13
+  8026a8:	41 54                	push   %r12
+  8026aa:	53                   	push   %rbx
+  8026ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8026af:	49 89 ff             	mov    %rdi,%r15
+  8026b2:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8026b7:	49 bd 1c 36 80 00 00 	movabs $0x80361c,%r13
+  8026be:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8026c1:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8026c7:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8026ca:	48 89 df             	mov    %rbx,%rdi
+  8026cd:	41 ff d5             	call   *%r13
+  8026d0:	83 e0 04             	and    $0x4,%eax
+  8026d3:	74 17                	je     8026ec <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8026d5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8026dc:	4c 39 f3             	cmp    %r14,%rbx
+  8026df:	75 e6                	jne    8026c7 <fd_alloc+0x29>
+  8026e1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8026e7:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8026ec:	4d 89 27             	mov    %r12,(%r15)
+}
+  8026ef:	48 83 c4 08          	add    $0x8,%rsp
+  8026f3:	5b                   	pop    %rbx
+  8026f4:	41 5c                	pop    %r12
+  8026f6:	41 5d                	pop    %r13
+  8026f8:	41 5e                	pop    %r14
+  8026fa:	41 5f                	pop    %r15
+  8026fc:	5d                   	pop    %rbp
+  8026fd:	c3                   	ret
+
+00000000008026fe <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8026fe:	83 ff 1f             	cmp    $0x1f,%edi
+  802701:	77 39                	ja     80273c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802703:	55                   	push   %rbp
+  802704:	48 89 e5             	mov    %rsp,%rbp
+  802707:	41 54                	push   %r12
+  802709:	53                   	push   %rbx
+  80270a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80270d:	48 63 df             	movslq %edi,%rbx
+  802710:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802717:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80271b:	48 89 df             	mov    %rbx,%rdi
+  80271e:	48 b8 1c 36 80 00 00 	movabs $0x80361c,%rax
+  802725:	00 00 00 
+  802728:	ff d0                	call   *%rax
+  80272a:	a8 04                	test   $0x4,%al
+  80272c:	74 14                	je     802742 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80272e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802732:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802737:	5b                   	pop    %rbx
+  802738:	41 5c                	pop    %r12
+  80273a:	5d                   	pop    %rbp
+  80273b:	c3                   	ret
+        return -E_INVAL;
+  80273c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802741:	c3                   	ret
+        return -E_INVAL;
+  802742:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802747:	eb ee                	jmp    802737 <fd_lookup+0x39>
+
+0000000000802749 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802749:	55                   	push   %rbp
+  80274a:	48 89 e5             	mov    %rsp,%rbp
+  80274d:	41 54                	push   %r12
+  80274f:	53                   	push   %rbx
+  802750:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802753:	48 b8 80 47 80 00 00 	movabs $0x804780,%rax
+  80275a:	00 00 00 
+  80275d:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  802764:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802767:	39 3b                	cmp    %edi,(%rbx)
+  802769:	74 47                	je     8027b2 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80276b:	48 83 c0 08          	add    $0x8,%rax
+  80276f:	48 8b 18             	mov    (%rax),%rbx
+  802772:	48 85 db             	test   %rbx,%rbx
+  802775:	75 f0                	jne    802767 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802777:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  80277e:	00 00 00 
+  802781:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802787:	89 fa                	mov    %edi,%edx
+  802789:	48 bf e8 46 80 00 00 	movabs $0x8046e8,%rdi
+  802790:	00 00 00 
+  802793:	b8 00 00 00 00       	mov    $0x0,%eax
+  802798:	48 b9 f9 10 80 00 00 	movabs $0x8010f9,%rcx
+  80279f:	00 00 00 
+  8027a2:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8027a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8027a9:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8027ad:	5b                   	pop    %rbx
+  8027ae:	41 5c                	pop    %r12
+  8027b0:	5d                   	pop    %rbp
+  8027b1:	c3                   	ret
+            return 0;
+  8027b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b7:	eb f0                	jmp    8027a9 <dev_lookup+0x60>
+
+00000000008027b9 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8027b9:	55                   	push   %rbp
+  8027ba:	48 89 e5             	mov    %rsp,%rbp
+  8027bd:	41 55                	push   %r13
+  8027bf:	41 54                	push   %r12
+  8027c1:	53                   	push   %rbx
+  8027c2:	48 83 ec 18          	sub    $0x18,%rsp
+  8027c6:	48 89 fb             	mov    %rdi,%rbx
+  8027c9:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8027cc:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8027d3:	ff ff ff 
+  8027d6:	48 01 df             	add    %rbx,%rdi
+  8027d9:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8027dd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8027e1:	48 b8 fe 26 80 00 00 	movabs $0x8026fe,%rax
+  8027e8:	00 00 00 
+  8027eb:	ff d0                	call   *%rax
+  8027ed:	41 89 c5             	mov    %eax,%r13d
+  8027f0:	85 c0                	test   %eax,%eax
+  8027f2:	78 06                	js     8027fa <fd_close+0x41>
+  8027f4:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8027f8:	74 1a                	je     802814 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8027fa:	45 84 e4             	test   %r12b,%r12b
+  8027fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802802:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802806:	44 89 e8             	mov    %r13d,%eax
+  802809:	48 83 c4 18          	add    $0x18,%rsp
+  80280d:	5b                   	pop    %rbx
+  80280e:	41 5c                	pop    %r12
+  802810:	41 5d                	pop    %r13
+  802812:	5d                   	pop    %rbp
+  802813:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802814:	8b 3b                	mov    (%rbx),%edi
+  802816:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80281a:	48 b8 49 27 80 00 00 	movabs $0x802749,%rax
+  802821:	00 00 00 
+  802824:	ff d0                	call   *%rax
+  802826:	41 89 c5             	mov    %eax,%r13d
+  802829:	85 c0                	test   %eax,%eax
+  80282b:	78 1b                	js     802848 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80282d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802831:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802835:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80283b:	48 85 c0             	test   %rax,%rax
+  80283e:	74 08                	je     802848 <fd_close+0x8f>
+  802840:	48 89 df             	mov    %rbx,%rdi
+  802843:	ff d0                	call   *%rax
+  802845:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802848:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80284d:	48 89 de             	mov    %rbx,%rsi
+  802850:	bf 00 00 00 00       	mov    $0x0,%edi
+  802855:	48 b8 9a 20 80 00 00 	movabs $0x80209a,%rax
+  80285c:	00 00 00 
+  80285f:	ff d0                	call   *%rax
+    return res;
+  802861:	eb a3                	jmp    802806 <fd_close+0x4d>
+
+0000000000802863 <close>:
+
+int
+close(int fdnum) {
+  802863:	55                   	push   %rbp
+  802864:	48 89 e5             	mov    %rsp,%rbp
+  802867:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80286b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80286f:	48 b8 fe 26 80 00 00 	movabs $0x8026fe,%rax
+  802876:	00 00 00 
+  802879:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80287b:	85 c0                	test   %eax,%eax
+  80287d:	78 15                	js     802894 <close+0x31>
+
+    return fd_close(fd, 1);
+  80287f:	be 01 00 00 00       	mov    $0x1,%esi
+  802884:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802888:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  80288f:	00 00 00 
+  802892:	ff d0                	call   *%rax
+}
+  802894:	c9                   	leave
+  802895:	c3                   	ret
+
+0000000000802896 <close_all>:
+
+void
+close_all(void) {
+  802896:	55                   	push   %rbp
+  802897:	48 89 e5             	mov    %rsp,%rbp
+  80289a:	41 54                	push   %r12
+  80289c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80289d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028a2:	49 bc 63 28 80 00 00 	movabs $0x802863,%r12
+  8028a9:	00 00 00 
+  8028ac:	89 df                	mov    %ebx,%edi
+  8028ae:	41 ff d4             	call   *%r12
+  8028b1:	83 c3 01             	add    $0x1,%ebx
+  8028b4:	83 fb 20             	cmp    $0x20,%ebx
+  8028b7:	75 f3                	jne    8028ac <close_all+0x16>
+}
+  8028b9:	5b                   	pop    %rbx
+  8028ba:	41 5c                	pop    %r12
+  8028bc:	5d                   	pop    %rbp
+  8028bd:	c3                   	ret
+
+00000000008028be <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8028be:	55                   	push   %rbp
+  8028bf:	48 89 e5             	mov    %rsp,%rbp
+  8028c2:	41 57                	push   %r15
+  8028c4:	41 56                	push   %r14
+  8028c6:	41 55                	push   %r13
+  8028c8:	41 54                	push   %r12
+  8028ca:	53                   	push   %rbx
+  8028cb:	48 83 ec 18          	sub    $0x18,%rsp
+  8028cf:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8028d2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8028d6:	48 b8 fe 26 80 00 00 	movabs $0x8026fe,%rax
+  8028dd:	00 00 00 
+  8028e0:	ff d0                	call   *%rax
+  8028e2:	89 c3                	mov    %eax,%ebx
+  8028e4:	85 c0                	test   %eax,%eax
+  8028e6:	0f 88 b8 00 00 00    	js     8029a4 <dup+0xe6>
+    close(newfdnum);
+  8028ec:	44 89 e7             	mov    %r12d,%edi
+  8028ef:	48 b8 63 28 80 00 00 	movabs $0x802863,%rax
+  8028f6:	00 00 00 
+  8028f9:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8028fb:	4d 63 ec             	movslq %r12d,%r13
+  8028fe:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802905:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802909:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80290d:	4c 89 ff             	mov    %r15,%rdi
+  802910:	49 be 82 26 80 00 00 	movabs $0x802682,%r14
+  802917:	00 00 00 
+  80291a:	41 ff d6             	call   *%r14
+  80291d:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802920:	4c 89 ef             	mov    %r13,%rdi
+  802923:	41 ff d6             	call   *%r14
+  802926:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802929:	48 89 df             	mov    %rbx,%rdi
+  80292c:	48 b8 1c 36 80 00 00 	movabs $0x80361c,%rax
+  802933:	00 00 00 
+  802936:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802938:	a8 04                	test   $0x4,%al
+  80293a:	74 2b                	je     802967 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80293c:	41 89 c1             	mov    %eax,%r9d
+  80293f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802945:	4c 89 f1             	mov    %r14,%rcx
+  802948:	ba 00 00 00 00       	mov    $0x0,%edx
+  80294d:	48 89 de             	mov    %rbx,%rsi
+  802950:	bf 00 00 00 00       	mov    $0x0,%edi
+  802955:	48 b8 35 20 80 00 00 	movabs $0x802035,%rax
+  80295c:	00 00 00 
+  80295f:	ff d0                	call   *%rax
+  802961:	89 c3                	mov    %eax,%ebx
+  802963:	85 c0                	test   %eax,%eax
+  802965:	78 4e                	js     8029b5 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802967:	4c 89 ff             	mov    %r15,%rdi
+  80296a:	48 b8 1c 36 80 00 00 	movabs $0x80361c,%rax
+  802971:	00 00 00 
+  802974:	ff d0                	call   *%rax
+  802976:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802979:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80297f:	4c 89 e9             	mov    %r13,%rcx
+  802982:	ba 00 00 00 00       	mov    $0x0,%edx
+  802987:	4c 89 fe             	mov    %r15,%rsi
+  80298a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80298f:	48 b8 35 20 80 00 00 	movabs $0x802035,%rax
+  802996:	00 00 00 
+  802999:	ff d0                	call   *%rax
+  80299b:	89 c3                	mov    %eax,%ebx
+  80299d:	85 c0                	test   %eax,%eax
+  80299f:	78 14                	js     8029b5 <dup+0xf7>
+
+    return newfdnum;
+  8029a1:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8029a4:	89 d8                	mov    %ebx,%eax
+  8029a6:	48 83 c4 18          	add    $0x18,%rsp
+  8029aa:	5b                   	pop    %rbx
+  8029ab:	41 5c                	pop    %r12
+  8029ad:	41 5d                	pop    %r13
+  8029af:	41 5e                	pop    %r14
+  8029b1:	41 5f                	pop    %r15
+  8029b3:	5d                   	pop    %rbp
+  8029b4:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8029b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029ba:	4c 89 ee             	mov    %r13,%rsi
+  8029bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029c2:	49 bc 9a 20 80 00 00 	movabs $0x80209a,%r12
+  8029c9:	00 00 00 
+  8029cc:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8029cf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029d4:	4c 89 f6             	mov    %r14,%rsi
+  8029d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029dc:	41 ff d4             	call   *%r12
+    return res;
+  8029df:	eb c3                	jmp    8029a4 <dup+0xe6>
+
+00000000008029e1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8029e1:	55                   	push   %rbp
+  8029e2:	48 89 e5             	mov    %rsp,%rbp
+  8029e5:	41 56                	push   %r14
+  8029e7:	41 55                	push   %r13
+  8029e9:	41 54                	push   %r12
+  8029eb:	53                   	push   %rbx
+  8029ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8029f0:	89 fb                	mov    %edi,%ebx
+  8029f2:	49 89 f4             	mov    %rsi,%r12
+  8029f5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8029f8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8029fc:	48 b8 fe 26 80 00 00 	movabs $0x8026fe,%rax
+  802a03:	00 00 00 
+  802a06:	ff d0                	call   *%rax
+  802a08:	85 c0                	test   %eax,%eax
+  802a0a:	78 4c                	js     802a58 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a0c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802a10:	41 8b 3e             	mov    (%r14),%edi
+  802a13:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802a17:	48 b8 49 27 80 00 00 	movabs $0x802749,%rax
+  802a1e:	00 00 00 
+  802a21:	ff d0                	call   *%rax
+  802a23:	85 c0                	test   %eax,%eax
+  802a25:	78 35                	js     802a5c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802a27:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802a2b:	83 e0 03             	and    $0x3,%eax
+  802a2e:	83 f8 01             	cmp    $0x1,%eax
+  802a31:	74 2d                	je     802a60 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802a33:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a37:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802a3b:	48 85 c0             	test   %rax,%rax
+  802a3e:	74 56                	je     802a96 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802a40:	4c 89 ea             	mov    %r13,%rdx
+  802a43:	4c 89 e6             	mov    %r12,%rsi
+  802a46:	4c 89 f7             	mov    %r14,%rdi
+  802a49:	ff d0                	call   *%rax
+}
+  802a4b:	48 83 c4 10          	add    $0x10,%rsp
+  802a4f:	5b                   	pop    %rbx
+  802a50:	41 5c                	pop    %r12
+  802a52:	41 5d                	pop    %r13
+  802a54:	41 5e                	pop    %r14
+  802a56:	5d                   	pop    %rbp
+  802a57:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a58:	48 98                	cltq
+  802a5a:	eb ef                	jmp    802a4b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a5c:	48 98                	cltq
+  802a5e:	eb eb                	jmp    802a4b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802a60:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  802a67:	00 00 00 
+  802a6a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802a70:	89 da                	mov    %ebx,%edx
+  802a72:	48 bf 29 47 80 00 00 	movabs $0x804729,%rdi
+  802a79:	00 00 00 
+  802a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a81:	48 b9 f9 10 80 00 00 	movabs $0x8010f9,%rcx
+  802a88:	00 00 00 
+  802a8b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802a8d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802a94:	eb b5                	jmp    802a4b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802a96:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802a9d:	eb ac                	jmp    802a4b <read+0x6a>
+
+0000000000802a9f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802a9f:	55                   	push   %rbp
+  802aa0:	48 89 e5             	mov    %rsp,%rbp
+  802aa3:	41 57                	push   %r15
+  802aa5:	41 56                	push   %r14
+  802aa7:	41 55                	push   %r13
+  802aa9:	41 54                	push   %r12
+  802aab:	53                   	push   %rbx
+  802aac:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802ab0:	48 85 d2             	test   %rdx,%rdx
+  802ab3:	74 54                	je     802b09 <readn+0x6a>
+  802ab5:	41 89 fd             	mov    %edi,%r13d
+  802ab8:	49 89 f6             	mov    %rsi,%r14
+  802abb:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802abe:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802ac3:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802ac8:	49 bf e1 29 80 00 00 	movabs $0x8029e1,%r15
+  802acf:	00 00 00 
+  802ad2:	4c 89 e2             	mov    %r12,%rdx
+  802ad5:	48 29 f2             	sub    %rsi,%rdx
+  802ad8:	4c 01 f6             	add    %r14,%rsi
+  802adb:	44 89 ef             	mov    %r13d,%edi
+  802ade:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802ae1:	85 c0                	test   %eax,%eax
+  802ae3:	78 20                	js     802b05 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802ae5:	01 c3                	add    %eax,%ebx
+  802ae7:	85 c0                	test   %eax,%eax
+  802ae9:	74 08                	je     802af3 <readn+0x54>
+  802aeb:	48 63 f3             	movslq %ebx,%rsi
+  802aee:	4c 39 e6             	cmp    %r12,%rsi
+  802af1:	72 df                	jb     802ad2 <readn+0x33>
+    }
+    return res;
+  802af3:	48 63 c3             	movslq %ebx,%rax
+}
+  802af6:	48 83 c4 08          	add    $0x8,%rsp
+  802afa:	5b                   	pop    %rbx
+  802afb:	41 5c                	pop    %r12
+  802afd:	41 5d                	pop    %r13
+  802aff:	41 5e                	pop    %r14
+  802b01:	41 5f                	pop    %r15
+  802b03:	5d                   	pop    %rbp
+  802b04:	c3                   	ret
+        if (inc < 0) return inc;
+  802b05:	48 98                	cltq
+  802b07:	eb ed                	jmp    802af6 <readn+0x57>
+    int inc = 1, res = 0;
+  802b09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b0e:	eb e3                	jmp    802af3 <readn+0x54>
+
+0000000000802b10 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802b10:	55                   	push   %rbp
+  802b11:	48 89 e5             	mov    %rsp,%rbp
+  802b14:	41 56                	push   %r14
+  802b16:	41 55                	push   %r13
+  802b18:	41 54                	push   %r12
+  802b1a:	53                   	push   %rbx
+  802b1b:	48 83 ec 10          	sub    $0x10,%rsp
+  802b1f:	89 fb                	mov    %edi,%ebx
+  802b21:	49 89 f4             	mov    %rsi,%r12
+  802b24:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802b27:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802b2b:	48 b8 fe 26 80 00 00 	movabs $0x8026fe,%rax
+  802b32:	00 00 00 
+  802b35:	ff d0                	call   *%rax
+  802b37:	85 c0                	test   %eax,%eax
+  802b39:	78 47                	js     802b82 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802b3b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802b3f:	41 8b 3e             	mov    (%r14),%edi
+  802b42:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802b46:	48 b8 49 27 80 00 00 	movabs $0x802749,%rax
+  802b4d:	00 00 00 
+  802b50:	ff d0                	call   *%rax
+  802b52:	85 c0                	test   %eax,%eax
+  802b54:	78 30                	js     802b86 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802b56:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802b5b:	74 2d                	je     802b8a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802b5d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b61:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802b65:	48 85 c0             	test   %rax,%rax
+  802b68:	74 56                	je     802bc0 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802b6a:	4c 89 ea             	mov    %r13,%rdx
+  802b6d:	4c 89 e6             	mov    %r12,%rsi
+  802b70:	4c 89 f7             	mov    %r14,%rdi
+  802b73:	ff d0                	call   *%rax
+}
+  802b75:	48 83 c4 10          	add    $0x10,%rsp
+  802b79:	5b                   	pop    %rbx
+  802b7a:	41 5c                	pop    %r12
+  802b7c:	41 5d                	pop    %r13
+  802b7e:	41 5e                	pop    %r14
+  802b80:	5d                   	pop    %rbp
+  802b81:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802b82:	48 98                	cltq
+  802b84:	eb ef                	jmp    802b75 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802b86:	48 98                	cltq
+  802b88:	eb eb                	jmp    802b75 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802b8a:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  802b91:	00 00 00 
+  802b94:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802b9a:	89 da                	mov    %ebx,%edx
+  802b9c:	48 bf 45 47 80 00 00 	movabs $0x804745,%rdi
+  802ba3:	00 00 00 
+  802ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bab:	48 b9 f9 10 80 00 00 	movabs $0x8010f9,%rcx
+  802bb2:	00 00 00 
+  802bb5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802bb7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802bbe:	eb b5                	jmp    802b75 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802bc0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802bc7:	eb ac                	jmp    802b75 <write+0x65>
+
+0000000000802bc9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802bc9:	55                   	push   %rbp
+  802bca:	48 89 e5             	mov    %rsp,%rbp
+  802bcd:	53                   	push   %rbx
+  802bce:	48 83 ec 18          	sub    $0x18,%rsp
+  802bd2:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802bd4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802bd8:	48 b8 fe 26 80 00 00 	movabs $0x8026fe,%rax
+  802bdf:	00 00 00 
+  802be2:	ff d0                	call   *%rax
+  802be4:	85 c0                	test   %eax,%eax
+  802be6:	78 0c                	js     802bf4 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802be8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bec:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802bef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bf4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bf8:	c9                   	leave
+  802bf9:	c3                   	ret
+
+0000000000802bfa <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802bfa:	55                   	push   %rbp
+  802bfb:	48 89 e5             	mov    %rsp,%rbp
+  802bfe:	41 55                	push   %r13
+  802c00:	41 54                	push   %r12
+  802c02:	53                   	push   %rbx
+  802c03:	48 83 ec 18          	sub    $0x18,%rsp
+  802c07:	89 fb                	mov    %edi,%ebx
+  802c09:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c0c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802c10:	48 b8 fe 26 80 00 00 	movabs $0x8026fe,%rax
+  802c17:	00 00 00 
+  802c1a:	ff d0                	call   *%rax
+  802c1c:	85 c0                	test   %eax,%eax
+  802c1e:	78 38                	js     802c58 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802c20:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802c24:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802c28:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802c2c:	48 b8 49 27 80 00 00 	movabs $0x802749,%rax
+  802c33:	00 00 00 
+  802c36:	ff d0                	call   *%rax
+  802c38:	85 c0                	test   %eax,%eax
+  802c3a:	78 1c                	js     802c58 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802c3c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802c41:	74 20                	je     802c63 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802c43:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c47:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802c4b:	48 85 c0             	test   %rax,%rax
+  802c4e:	74 47                	je     802c97 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802c50:	44 89 e6             	mov    %r12d,%esi
+  802c53:	4c 89 ef             	mov    %r13,%rdi
+  802c56:	ff d0                	call   *%rax
+}
+  802c58:	48 83 c4 18          	add    $0x18,%rsp
+  802c5c:	5b                   	pop    %rbx
+  802c5d:	41 5c                	pop    %r12
+  802c5f:	41 5d                	pop    %r13
+  802c61:	5d                   	pop    %rbp
+  802c62:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802c63:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  802c6a:	00 00 00 
+  802c6d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802c73:	89 da                	mov    %ebx,%edx
+  802c75:	48 bf 08 47 80 00 00 	movabs $0x804708,%rdi
+  802c7c:	00 00 00 
+  802c7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c84:	48 b9 f9 10 80 00 00 	movabs $0x8010f9,%rcx
+  802c8b:	00 00 00 
+  802c8e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802c90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c95:	eb c1                	jmp    802c58 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802c97:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802c9c:	eb ba                	jmp    802c58 <ftruncate+0x5e>
+
+0000000000802c9e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802c9e:	55                   	push   %rbp
+  802c9f:	48 89 e5             	mov    %rsp,%rbp
+  802ca2:	41 54                	push   %r12
+  802ca4:	53                   	push   %rbx
+  802ca5:	48 83 ec 10          	sub    $0x10,%rsp
+  802ca9:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802cac:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802cb0:	48 b8 fe 26 80 00 00 	movabs $0x8026fe,%rax
+  802cb7:	00 00 00 
+  802cba:	ff d0                	call   *%rax
+  802cbc:	85 c0                	test   %eax,%eax
+  802cbe:	78 4e                	js     802d0e <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802cc0:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802cc4:	41 8b 3c 24          	mov    (%r12),%edi
+  802cc8:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802ccc:	48 b8 49 27 80 00 00 	movabs $0x802749,%rax
+  802cd3:	00 00 00 
+  802cd6:	ff d0                	call   *%rax
+  802cd8:	85 c0                	test   %eax,%eax
+  802cda:	78 32                	js     802d0e <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802cdc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ce0:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802ce5:	74 30                	je     802d17 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802ce7:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802cea:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802cf1:	00 00 00 
+    stat->st_isdir = 0;
+  802cf4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802cfb:	00 00 00 
+    stat->st_dev = dev;
+  802cfe:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802d05:	48 89 de             	mov    %rbx,%rsi
+  802d08:	4c 89 e7             	mov    %r12,%rdi
+  802d0b:	ff 50 28             	call   *0x28(%rax)
+}
+  802d0e:	48 83 c4 10          	add    $0x10,%rsp
+  802d12:	5b                   	pop    %rbx
+  802d13:	41 5c                	pop    %r12
+  802d15:	5d                   	pop    %rbp
+  802d16:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802d17:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802d1c:	eb f0                	jmp    802d0e <fstat+0x70>
+
+0000000000802d1e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802d1e:	55                   	push   %rbp
+  802d1f:	48 89 e5             	mov    %rsp,%rbp
+  802d22:	41 54                	push   %r12
+  802d24:	53                   	push   %rbx
+  802d25:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802d28:	be 00 00 00 00       	mov    $0x0,%esi
+  802d2d:	48 b8 9f 2f 80 00 00 	movabs $0x802f9f,%rax
+  802d34:	00 00 00 
+  802d37:	ff d0                	call   *%rax
+  802d39:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802d3b:	85 c0                	test   %eax,%eax
+  802d3d:	78 25                	js     802d64 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802d3f:	4c 89 e6             	mov    %r12,%rsi
+  802d42:	89 c7                	mov    %eax,%edi
+  802d44:	48 b8 9e 2c 80 00 00 	movabs $0x802c9e,%rax
+  802d4b:	00 00 00 
+  802d4e:	ff d0                	call   *%rax
+  802d50:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802d53:	89 df                	mov    %ebx,%edi
+  802d55:	48 b8 63 28 80 00 00 	movabs $0x802863,%rax
+  802d5c:	00 00 00 
+  802d5f:	ff d0                	call   *%rax
+
+    return res;
+  802d61:	44 89 e3             	mov    %r12d,%ebx
+}
+  802d64:	89 d8                	mov    %ebx,%eax
+  802d66:	5b                   	pop    %rbx
+  802d67:	41 5c                	pop    %r12
+  802d69:	5d                   	pop    %rbp
+  802d6a:	c3                   	ret
+
+0000000000802d6b <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802d6b:	55                   	push   %rbp
+  802d6c:	48 89 e5             	mov    %rsp,%rbp
+  802d6f:	41 54                	push   %r12
+  802d71:	53                   	push   %rbx
+  802d72:	48 83 ec 10          	sub    $0x10,%rsp
+  802d76:	41 89 fc             	mov    %edi,%r12d
+  802d79:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802d7c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802d83:	00 00 00 
+  802d86:	83 38 00             	cmpl   $0x0,(%rax)
+  802d89:	74 5e                	je     802de9 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802d8b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802d91:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802d96:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802d9d:	00 00 00 
+  802da0:	44 89 e6             	mov    %r12d,%esi
+  802da3:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802daa:	00 00 00 
+  802dad:	8b 38                	mov    (%rax),%edi
+  802daf:	48 b8 70 3c 80 00 00 	movabs $0x803c70,%rax
+  802db6:	00 00 00 
+  802db9:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802dbb:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802dc2:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802dc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802dc8:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802dcc:	48 89 de             	mov    %rbx,%rsi
+  802dcf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dd4:	48 b8 db 3b 80 00 00 	movabs $0x803bdb,%rax
+  802ddb:	00 00 00 
+  802dde:	ff d0                	call   *%rax
+}
+  802de0:	48 83 c4 10          	add    $0x10,%rsp
+  802de4:	5b                   	pop    %rbx
+  802de5:	41 5c                	pop    %r12
+  802de7:	5d                   	pop    %rbp
+  802de8:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802de9:	bf 03 00 00 00       	mov    $0x3,%edi
+  802dee:	48 b8 10 3d 80 00 00 	movabs $0x803d10,%rax
+  802df5:	00 00 00 
+  802df8:	ff d0                	call   *%rax
+  802dfa:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802e01:	00 00 
+  802e03:	eb 86                	jmp    802d8b <fsipc+0x20>
+
+0000000000802e05 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802e05:	55                   	push   %rbp
+  802e06:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802e09:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802e10:	00 00 00 
+  802e13:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802e16:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802e18:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802e1b:	be 00 00 00 00       	mov    $0x0,%esi
+  802e20:	bf 02 00 00 00       	mov    $0x2,%edi
+  802e25:	48 b8 6b 2d 80 00 00 	movabs $0x802d6b,%rax
+  802e2c:	00 00 00 
+  802e2f:	ff d0                	call   *%rax
+}
+  802e31:	5d                   	pop    %rbp
+  802e32:	c3                   	ret
+
+0000000000802e33 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802e33:	55                   	push   %rbp
+  802e34:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802e37:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802e3a:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802e41:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802e43:	be 00 00 00 00       	mov    $0x0,%esi
+  802e48:	bf 06 00 00 00       	mov    $0x6,%edi
+  802e4d:	48 b8 6b 2d 80 00 00 	movabs $0x802d6b,%rax
+  802e54:	00 00 00 
+  802e57:	ff d0                	call   *%rax
+}
+  802e59:	5d                   	pop    %rbp
+  802e5a:	c3                   	ret
+
+0000000000802e5b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802e5b:	55                   	push   %rbp
+  802e5c:	48 89 e5             	mov    %rsp,%rbp
+  802e5f:	41 54                	push   %r12
+  802e61:	53                   	push   %rbx
+  802e62:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802e65:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802e68:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802e6f:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802e71:	be 00 00 00 00       	mov    $0x0,%esi
+  802e76:	bf 05 00 00 00       	mov    $0x5,%edi
+  802e7b:	48 b8 6b 2d 80 00 00 	movabs $0x802d6b,%rax
+  802e82:	00 00 00 
+  802e85:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e87:	85 c0                	test   %eax,%eax
+  802e89:	78 3d                	js     802ec8 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802e8b:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802e92:	00 00 00 
+  802e95:	4c 89 e6             	mov    %r12,%rsi
+  802e98:	48 89 df             	mov    %rbx,%rdi
+  802e9b:	48 b8 1e 1a 80 00 00 	movabs $0x801a1e,%rax
+  802ea2:	00 00 00 
+  802ea5:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802ea7:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802eae:	00 
+  802eaf:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802eb5:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802ebc:	00 
+  802ebd:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802ec3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ec8:	5b                   	pop    %rbx
+  802ec9:	41 5c                	pop    %r12
+  802ecb:	5d                   	pop    %rbp
+  802ecc:	c3                   	ret
+
+0000000000802ecd <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802ecd:	55                   	push   %rbp
+  802ece:	48 89 e5             	mov    %rsp,%rbp
+  802ed1:	41 54                	push   %r12
+  802ed3:	53                   	push   %rbx
+  802ed4:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  802ed7:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802edc:	48 39 c2             	cmp    %rax,%rdx
+  802edf:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802ee3:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802ee6:	48 89 c2             	mov    %rax,%rdx
+  802ee9:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802ef0:	00 00 00 
+  802ef3:	48 b8 7f 1c 80 00 00 	movabs $0x801c7f,%rax
+  802efa:	00 00 00 
+  802efd:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802eff:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802f06:	00 00 00 
+  802f09:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802f0e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802f10:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  802f14:	be 00 00 00 00       	mov    $0x0,%esi
+  802f19:	bf 04 00 00 00       	mov    $0x4,%edi
+  802f1e:	48 b8 6b 2d 80 00 00 	movabs $0x802d6b,%rax
+  802f25:	00 00 00 
+  802f28:	ff d0                	call   *%rax
+  802f2a:	48 98                	cltq
+}
+  802f2c:	5b                   	pop    %rbx
+  802f2d:	41 5c                	pop    %r12
+  802f2f:	5d                   	pop    %rbp
+  802f30:	c3                   	ret
+
+0000000000802f31 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802f31:	55                   	push   %rbp
+  802f32:	48 89 e5             	mov    %rsp,%rbp
+  802f35:	41 54                	push   %r12
+  802f37:	53                   	push   %rbx
+  802f38:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802f3b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802f42:	00 00 00 
+  802f45:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802f48:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  802f4a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802f4f:	48 39 ca             	cmp    %rcx,%rdx
+  802f52:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  802f56:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  802f5a:	be 00 00 00 00       	mov    $0x0,%esi
+  802f5f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802f64:	48 b8 6b 2d 80 00 00 	movabs $0x802d6b,%rax
+  802f6b:	00 00 00 
+  802f6e:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802f70:	85 c0                	test   %eax,%eax
+  802f72:	78 27                	js     802f9b <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802f74:	48 63 d8             	movslq %eax,%rbx
+  802f77:	48 89 da             	mov    %rbx,%rdx
+  802f7a:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  802f81:	00 00 00 
+  802f84:	4c 89 e7             	mov    %r12,%rdi
+  802f87:	48 b8 7f 1c 80 00 00 	movabs $0x801c7f,%rax
+  802f8e:	00 00 00 
+  802f91:	ff d0                	call   *%rax
+    return bytes_read;
+  802f93:	48 89 d8             	mov    %rbx,%rax
+}
+  802f96:	5b                   	pop    %rbx
+  802f97:	41 5c                	pop    %r12
+  802f99:	5d                   	pop    %rbp
+  802f9a:	c3                   	ret
+        return bytes_read;
+  802f9b:	48 98                	cltq
+  802f9d:	eb f7                	jmp    802f96 <devfile_read+0x65>
+
+0000000000802f9f <open>:
+open(const char *path, int mode) {
+  802f9f:	55                   	push   %rbp
+  802fa0:	48 89 e5             	mov    %rsp,%rbp
+  802fa3:	41 55                	push   %r13
+  802fa5:	41 54                	push   %r12
+  802fa7:	53                   	push   %rbx
+  802fa8:	48 83 ec 18          	sub    $0x18,%rsp
+  802fac:	49 89 fc             	mov    %rdi,%r12
+  802faf:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802fb2:	48 b8 e0 19 80 00 00 	movabs $0x8019e0,%rax
+  802fb9:	00 00 00 
+  802fbc:	ff d0                	call   *%rax
+  802fbe:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802fc4:	0f 87 8a 00 00 00    	ja     803054 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802fca:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802fce:	48 b8 9e 26 80 00 00 	movabs $0x80269e,%rax
+  802fd5:	00 00 00 
+  802fd8:	ff d0                	call   *%rax
+  802fda:	89 c3                	mov    %eax,%ebx
+  802fdc:	85 c0                	test   %eax,%eax
+  802fde:	78 50                	js     803030 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802fe0:	4c 89 e6             	mov    %r12,%rsi
+  802fe3:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802fea:	00 00 00 
+  802fed:	48 89 df             	mov    %rbx,%rdi
+  802ff0:	48 b8 1e 1a 80 00 00 	movabs $0x801a1e,%rax
+  802ff7:	00 00 00 
+  802ffa:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802ffc:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803003:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803007:	bf 01 00 00 00       	mov    $0x1,%edi
+  80300c:	48 b8 6b 2d 80 00 00 	movabs $0x802d6b,%rax
+  803013:	00 00 00 
+  803016:	ff d0                	call   *%rax
+  803018:	89 c3                	mov    %eax,%ebx
+  80301a:	85 c0                	test   %eax,%eax
+  80301c:	78 1f                	js     80303d <open+0x9e>
+    return fd2num(fd);
+  80301e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803022:	48 b8 70 26 80 00 00 	movabs $0x802670,%rax
+  803029:	00 00 00 
+  80302c:	ff d0                	call   *%rax
+  80302e:	89 c3                	mov    %eax,%ebx
+}
+  803030:	89 d8                	mov    %ebx,%eax
+  803032:	48 83 c4 18          	add    $0x18,%rsp
+  803036:	5b                   	pop    %rbx
+  803037:	41 5c                	pop    %r12
+  803039:	41 5d                	pop    %r13
+  80303b:	5d                   	pop    %rbp
+  80303c:	c3                   	ret
+        fd_close(fd, 0);
+  80303d:	be 00 00 00 00       	mov    $0x0,%esi
+  803042:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803046:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  80304d:	00 00 00 
+  803050:	ff d0                	call   *%rax
+        return res;
+  803052:	eb dc                	jmp    803030 <open+0x91>
+        return -E_BAD_PATH;
+  803054:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803059:	eb d5                	jmp    803030 <open+0x91>
+
+000000000080305b <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80305b:	55                   	push   %rbp
+  80305c:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80305f:	be 00 00 00 00       	mov    $0x0,%esi
+  803064:	bf 08 00 00 00       	mov    $0x8,%edi
+  803069:	48 b8 6b 2d 80 00 00 	movabs $0x802d6b,%rax
+  803070:	00 00 00 
+  803073:	ff d0                	call   *%rax
+}
+  803075:	5d                   	pop    %rbp
+  803076:	c3                   	ret
+
+0000000000803077 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803077:	55                   	push   %rbp
+  803078:	48 89 e5             	mov    %rsp,%rbp
+  80307b:	41 54                	push   %r12
+  80307d:	53                   	push   %rbx
+  80307e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803081:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  803088:	00 00 00 
+  80308b:	ff d0                	call   *%rax
+  80308d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803090:	48 be a0 47 80 00 00 	movabs $0x8047a0,%rsi
+  803097:	00 00 00 
+  80309a:	48 89 df             	mov    %rbx,%rdi
+  80309d:	48 b8 1e 1a 80 00 00 	movabs $0x801a1e,%rax
+  8030a4:	00 00 00 
+  8030a7:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8030a9:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8030ae:	41 2b 04 24          	sub    (%r12),%eax
+  8030b2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8030b8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8030bf:	00 00 00 
+    stat->st_dev = &devpipe;
+  8030c2:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8030c9:	00 00 00 
+  8030cc:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8030d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d8:	5b                   	pop    %rbx
+  8030d9:	41 5c                	pop    %r12
+  8030db:	5d                   	pop    %rbp
+  8030dc:	c3                   	ret
+
+00000000008030dd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8030dd:	55                   	push   %rbp
+  8030de:	48 89 e5             	mov    %rsp,%rbp
+  8030e1:	41 54                	push   %r12
+  8030e3:	53                   	push   %rbx
+  8030e4:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8030e7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030ec:	48 89 fe             	mov    %rdi,%rsi
+  8030ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030f4:	49 bc 9a 20 80 00 00 	movabs $0x80209a,%r12
+  8030fb:	00 00 00 
+  8030fe:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803101:	48 89 df             	mov    %rbx,%rdi
+  803104:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  80310b:	00 00 00 
+  80310e:	ff d0                	call   *%rax
+  803110:	48 89 c6             	mov    %rax,%rsi
+  803113:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803118:	bf 00 00 00 00       	mov    $0x0,%edi
+  80311d:	41 ff d4             	call   *%r12
+}
+  803120:	5b                   	pop    %rbx
+  803121:	41 5c                	pop    %r12
+  803123:	5d                   	pop    %rbp
+  803124:	c3                   	ret
+
+0000000000803125 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803125:	55                   	push   %rbp
+  803126:	48 89 e5             	mov    %rsp,%rbp
+  803129:	41 57                	push   %r15
+  80312b:	41 56                	push   %r14
+  80312d:	41 55                	push   %r13
+  80312f:	41 54                	push   %r12
+  803131:	53                   	push   %rbx
+  803132:	48 83 ec 18          	sub    $0x18,%rsp
+  803136:	49 89 fc             	mov    %rdi,%r12
+  803139:	49 89 f5             	mov    %rsi,%r13
+  80313c:	49 89 d7             	mov    %rdx,%r15
+  80313f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803143:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  80314a:	00 00 00 
+  80314d:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80314f:	4d 85 ff             	test   %r15,%r15
+  803152:	0f 84 af 00 00 00    	je     803207 <devpipe_write+0xe2>
+  803158:	48 89 c3             	mov    %rax,%rbx
+  80315b:	4c 89 f8             	mov    %r15,%rax
+  80315e:	4d 89 ef             	mov    %r13,%r15
+  803161:	4c 01 e8             	add    %r13,%rax
+  803164:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803168:	49 bd a2 1f 80 00 00 	movabs $0x801fa2,%r13
+  80316f:	00 00 00 
+            sys_yield();
+  803172:	49 be 3f 1f 80 00 00 	movabs $0x801f3f,%r14
+  803179:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80317c:	8b 73 04             	mov    0x4(%rbx),%esi
+  80317f:	48 63 ce             	movslq %esi,%rcx
+  803182:	48 63 03             	movslq (%rbx),%rax
+  803185:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80318b:	48 39 c1             	cmp    %rax,%rcx
+  80318e:	72 2e                	jb     8031be <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803190:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803195:	48 89 da             	mov    %rbx,%rdx
+  803198:	be 00 10 00 00       	mov    $0x1000,%esi
+  80319d:	4c 89 e7             	mov    %r12,%rdi
+  8031a0:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8031a3:	85 c0                	test   %eax,%eax
+  8031a5:	74 66                	je     80320d <devpipe_write+0xe8>
+            sys_yield();
+  8031a7:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8031aa:	8b 73 04             	mov    0x4(%rbx),%esi
+  8031ad:	48 63 ce             	movslq %esi,%rcx
+  8031b0:	48 63 03             	movslq (%rbx),%rax
+  8031b3:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8031b9:	48 39 c1             	cmp    %rax,%rcx
+  8031bc:	73 d2                	jae    803190 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8031be:	41 0f b6 3f          	movzbl (%r15),%edi
+  8031c2:	48 89 ca             	mov    %rcx,%rdx
+  8031c5:	48 c1 ea 03          	shr    $0x3,%rdx
+  8031c9:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8031d0:	08 10 20 
+  8031d3:	48 f7 e2             	mul    %rdx
+  8031d6:	48 c1 ea 06          	shr    $0x6,%rdx
+  8031da:	48 89 d0             	mov    %rdx,%rax
+  8031dd:	48 c1 e0 09          	shl    $0x9,%rax
+  8031e1:	48 29 d0             	sub    %rdx,%rax
+  8031e4:	48 c1 e0 03          	shl    $0x3,%rax
+  8031e8:	48 29 c1             	sub    %rax,%rcx
+  8031eb:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8031f0:	83 c6 01             	add    $0x1,%esi
+  8031f3:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8031f6:	49 83 c7 01          	add    $0x1,%r15
+  8031fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031fe:	49 39 c7             	cmp    %rax,%r15
+  803201:	0f 85 75 ff ff ff    	jne    80317c <devpipe_write+0x57>
+    return n;
+  803207:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80320b:	eb 05                	jmp    803212 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80320d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803212:	48 83 c4 18          	add    $0x18,%rsp
+  803216:	5b                   	pop    %rbx
+  803217:	41 5c                	pop    %r12
+  803219:	41 5d                	pop    %r13
+  80321b:	41 5e                	pop    %r14
+  80321d:	41 5f                	pop    %r15
+  80321f:	5d                   	pop    %rbp
+  803220:	c3                   	ret
+
+0000000000803221 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803221:	55                   	push   %rbp
+  803222:	48 89 e5             	mov    %rsp,%rbp
+  803225:	41 57                	push   %r15
+  803227:	41 56                	push   %r14
+  803229:	41 55                	push   %r13
+  80322b:	41 54                	push   %r12
+  80322d:	53                   	push   %rbx
+  80322e:	48 83 ec 18          	sub    $0x18,%rsp
+  803232:	49 89 fc             	mov    %rdi,%r12
+  803235:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803239:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80323d:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  803244:	00 00 00 
+  803247:	ff d0                	call   *%rax
+  803249:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80324c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803252:	49 bd a2 1f 80 00 00 	movabs $0x801fa2,%r13
+  803259:	00 00 00 
+            sys_yield();
+  80325c:	49 be 3f 1f 80 00 00 	movabs $0x801f3f,%r14
+  803263:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803266:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80326b:	74 7d                	je     8032ea <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80326d:	8b 03                	mov    (%rbx),%eax
+  80326f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803272:	75 26                	jne    80329a <devpipe_read+0x79>
+            if (i > 0) return i;
+  803274:	4d 85 ff             	test   %r15,%r15
+  803277:	75 77                	jne    8032f0 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803279:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80327e:	48 89 da             	mov    %rbx,%rdx
+  803281:	be 00 10 00 00       	mov    $0x1000,%esi
+  803286:	4c 89 e7             	mov    %r12,%rdi
+  803289:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80328c:	85 c0                	test   %eax,%eax
+  80328e:	74 72                	je     803302 <devpipe_read+0xe1>
+            sys_yield();
+  803290:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803293:	8b 03                	mov    (%rbx),%eax
+  803295:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803298:	74 df                	je     803279 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80329a:	48 63 c8             	movslq %eax,%rcx
+  80329d:	48 89 ca             	mov    %rcx,%rdx
+  8032a0:	48 c1 ea 03          	shr    $0x3,%rdx
+  8032a4:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8032ab:	08 10 20 
+  8032ae:	48 89 d0             	mov    %rdx,%rax
+  8032b1:	48 f7 e6             	mul    %rsi
+  8032b4:	48 c1 ea 06          	shr    $0x6,%rdx
+  8032b8:	48 89 d0             	mov    %rdx,%rax
+  8032bb:	48 c1 e0 09          	shl    $0x9,%rax
+  8032bf:	48 29 d0             	sub    %rdx,%rax
+  8032c2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8032c9:	00 
+  8032ca:	48 89 c8             	mov    %rcx,%rax
+  8032cd:	48 29 d0             	sub    %rdx,%rax
+  8032d0:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8032d5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032d9:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8032dd:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8032e0:	49 83 c7 01          	add    $0x1,%r15
+  8032e4:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8032e8:	75 83                	jne    80326d <devpipe_read+0x4c>
+    return n;
+  8032ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032ee:	eb 03                	jmp    8032f3 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8032f0:	4c 89 f8             	mov    %r15,%rax
+}
+  8032f3:	48 83 c4 18          	add    $0x18,%rsp
+  8032f7:	5b                   	pop    %rbx
+  8032f8:	41 5c                	pop    %r12
+  8032fa:	41 5d                	pop    %r13
+  8032fc:	41 5e                	pop    %r14
+  8032fe:	41 5f                	pop    %r15
+  803300:	5d                   	pop    %rbp
+  803301:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803302:	b8 00 00 00 00       	mov    $0x0,%eax
+  803307:	eb ea                	jmp    8032f3 <devpipe_read+0xd2>
+
+0000000000803309 <pipe>:
+pipe(int pfd[2]) {
+  803309:	55                   	push   %rbp
+  80330a:	48 89 e5             	mov    %rsp,%rbp
+  80330d:	41 55                	push   %r13
+  80330f:	41 54                	push   %r12
+  803311:	53                   	push   %rbx
+  803312:	48 83 ec 18          	sub    $0x18,%rsp
+  803316:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803319:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80331d:	48 b8 9e 26 80 00 00 	movabs $0x80269e,%rax
+  803324:	00 00 00 
+  803327:	ff d0                	call   *%rax
+  803329:	89 c3                	mov    %eax,%ebx
+  80332b:	85 c0                	test   %eax,%eax
+  80332d:	0f 88 a0 01 00 00    	js     8034d3 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803333:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803338:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80333d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803341:	bf 00 00 00 00       	mov    $0x0,%edi
+  803346:	48 b8 ce 1f 80 00 00 	movabs $0x801fce,%rax
+  80334d:	00 00 00 
+  803350:	ff d0                	call   *%rax
+  803352:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803354:	85 c0                	test   %eax,%eax
+  803356:	0f 88 77 01 00 00    	js     8034d3 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80335c:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803360:	48 b8 9e 26 80 00 00 	movabs $0x80269e,%rax
+  803367:	00 00 00 
+  80336a:	ff d0                	call   *%rax
+  80336c:	89 c3                	mov    %eax,%ebx
+  80336e:	85 c0                	test   %eax,%eax
+  803370:	0f 88 43 01 00 00    	js     8034b9 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803376:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80337b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803380:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803384:	bf 00 00 00 00       	mov    $0x0,%edi
+  803389:	48 b8 ce 1f 80 00 00 	movabs $0x801fce,%rax
+  803390:	00 00 00 
+  803393:	ff d0                	call   *%rax
+  803395:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803397:	85 c0                	test   %eax,%eax
+  803399:	0f 88 1a 01 00 00    	js     8034b9 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80339f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8033a3:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  8033aa:	00 00 00 
+  8033ad:	ff d0                	call   *%rax
+  8033af:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8033b2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8033b7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033bc:	48 89 c6             	mov    %rax,%rsi
+  8033bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033c4:	48 b8 ce 1f 80 00 00 	movabs $0x801fce,%rax
+  8033cb:	00 00 00 
+  8033ce:	ff d0                	call   *%rax
+  8033d0:	89 c3                	mov    %eax,%ebx
+  8033d2:	85 c0                	test   %eax,%eax
+  8033d4:	0f 88 c5 00 00 00    	js     80349f <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8033da:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8033de:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  8033e5:	00 00 00 
+  8033e8:	ff d0                	call   *%rax
+  8033ea:	48 89 c1             	mov    %rax,%rcx
+  8033ed:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8033f3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8033f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033fe:	4c 89 ee             	mov    %r13,%rsi
+  803401:	bf 00 00 00 00       	mov    $0x0,%edi
+  803406:	48 b8 35 20 80 00 00 	movabs $0x802035,%rax
+  80340d:	00 00 00 
+  803410:	ff d0                	call   *%rax
+  803412:	89 c3                	mov    %eax,%ebx
+  803414:	85 c0                	test   %eax,%eax
+  803416:	78 6e                	js     803486 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803418:	be 00 10 00 00       	mov    $0x1000,%esi
+  80341d:	4c 89 ef             	mov    %r13,%rdi
+  803420:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  803427:	00 00 00 
+  80342a:	ff d0                	call   *%rax
+  80342c:	83 f8 02             	cmp    $0x2,%eax
+  80342f:	0f 85 ab 00 00 00    	jne    8034e0 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803435:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  80343c:	00 00 
+  80343e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803442:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803444:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803448:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80344f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803453:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803455:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803459:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803460:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803464:	48 bb 70 26 80 00 00 	movabs $0x802670,%rbx
+  80346b:	00 00 00 
+  80346e:	ff d3                	call   *%rbx
+  803470:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803474:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803478:	ff d3                	call   *%rbx
+  80347a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80347f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803484:	eb 4d                	jmp    8034d3 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803486:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80348b:	4c 89 ee             	mov    %r13,%rsi
+  80348e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803493:	48 b8 9a 20 80 00 00 	movabs $0x80209a,%rax
+  80349a:	00 00 00 
+  80349d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80349f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034a4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8034a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034ad:	48 b8 9a 20 80 00 00 	movabs $0x80209a,%rax
+  8034b4:	00 00 00 
+  8034b7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8034b9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034be:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8034c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034c7:	48 b8 9a 20 80 00 00 	movabs $0x80209a,%rax
+  8034ce:	00 00 00 
+  8034d1:	ff d0                	call   *%rax
+}
+  8034d3:	89 d8                	mov    %ebx,%eax
+  8034d5:	48 83 c4 18          	add    $0x18,%rsp
+  8034d9:	5b                   	pop    %rbx
+  8034da:	41 5c                	pop    %r12
+  8034dc:	41 5d                	pop    %r13
+  8034de:	5d                   	pop    %rbp
+  8034df:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8034e0:	48 b9 b8 47 80 00 00 	movabs $0x8047b8,%rcx
+  8034e7:	00 00 00 
+  8034ea:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  8034f1:	00 00 00 
+  8034f4:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8034f9:	48 bf a7 47 80 00 00 	movabs $0x8047a7,%rdi
+  803500:	00 00 00 
+  803503:	b8 00 00 00 00       	mov    $0x0,%eax
+  803508:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  80350f:	00 00 00 
+  803512:	41 ff d0             	call   *%r8
+
+0000000000803515 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803515:	55                   	push   %rbp
+  803516:	48 89 e5             	mov    %rsp,%rbp
+  803519:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80351d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803521:	48 b8 fe 26 80 00 00 	movabs $0x8026fe,%rax
+  803528:	00 00 00 
+  80352b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80352d:	85 c0                	test   %eax,%eax
+  80352f:	78 35                	js     803566 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803531:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803535:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  80353c:	00 00 00 
+  80353f:	ff d0                	call   *%rax
+  803541:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803544:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803549:	be 00 10 00 00       	mov    $0x1000,%esi
+  80354e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803552:	48 b8 a2 1f 80 00 00 	movabs $0x801fa2,%rax
+  803559:	00 00 00 
+  80355c:	ff d0                	call   *%rax
+  80355e:	85 c0                	test   %eax,%eax
+  803560:	0f 94 c0             	sete   %al
+  803563:	0f b6 c0             	movzbl %al,%eax
+}
+  803566:	c9                   	leave
+  803567:	c3                   	ret
+
+0000000000803568 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803568:	48 89 f8             	mov    %rdi,%rax
+  80356b:	48 c1 e8 27          	shr    $0x27,%rax
+  80356f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803576:	01 00 00 
+  803579:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80357d:	f6 c2 01             	test   $0x1,%dl
+  803580:	74 6d                	je     8035ef <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803582:	48 89 f8             	mov    %rdi,%rax
+  803585:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803589:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803590:	01 00 00 
+  803593:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803597:	f6 c2 01             	test   $0x1,%dl
+  80359a:	74 62                	je     8035fe <get_uvpt_entry+0x96>
+  80359c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8035a3:	01 00 00 
+  8035a6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8035aa:	f6 c2 80             	test   $0x80,%dl
+  8035ad:	75 4f                	jne    8035fe <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8035af:	48 89 f8             	mov    %rdi,%rax
+  8035b2:	48 c1 e8 15          	shr    $0x15,%rax
+  8035b6:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8035bd:	01 00 00 
+  8035c0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8035c4:	f6 c2 01             	test   $0x1,%dl
+  8035c7:	74 44                	je     80360d <get_uvpt_entry+0xa5>
+  8035c9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8035d0:	01 00 00 
+  8035d3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8035d7:	f6 c2 80             	test   $0x80,%dl
+  8035da:	75 31                	jne    80360d <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8035dc:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8035e0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8035e7:	01 00 00 
+  8035ea:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8035ee:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8035ef:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8035f6:	01 00 00 
+  8035f9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8035fd:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8035fe:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803605:	01 00 00 
+  803608:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80360c:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80360d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803614:	01 00 00 
+  803617:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80361b:	c3                   	ret
+
+000000000080361c <get_prot>:
+
+int
+get_prot(void *va) {
+  80361c:	55                   	push   %rbp
+  80361d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803620:	48 b8 68 35 80 00 00 	movabs $0x803568,%rax
+  803627:	00 00 00 
+  80362a:	ff d0                	call   *%rax
+  80362c:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80362f:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803634:	89 c1                	mov    %eax,%ecx
+  803636:	83 c9 04             	or     $0x4,%ecx
+  803639:	f6 c2 01             	test   $0x1,%dl
+  80363c:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80363f:	89 c1                	mov    %eax,%ecx
+  803641:	83 c9 02             	or     $0x2,%ecx
+  803644:	f6 c2 02             	test   $0x2,%dl
+  803647:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80364a:	89 c1                	mov    %eax,%ecx
+  80364c:	83 c9 01             	or     $0x1,%ecx
+  80364f:	48 85 d2             	test   %rdx,%rdx
+  803652:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803655:	89 c1                	mov    %eax,%ecx
+  803657:	83 c9 40             	or     $0x40,%ecx
+  80365a:	f6 c6 04             	test   $0x4,%dh
+  80365d:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803660:	5d                   	pop    %rbp
+  803661:	c3                   	ret
+
+0000000000803662 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803662:	55                   	push   %rbp
+  803663:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803666:	48 b8 68 35 80 00 00 	movabs $0x803568,%rax
+  80366d:	00 00 00 
+  803670:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803672:	48 c1 e8 06          	shr    $0x6,%rax
+  803676:	83 e0 01             	and    $0x1,%eax
+}
+  803679:	5d                   	pop    %rbp
+  80367a:	c3                   	ret
+
+000000000080367b <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80367b:	55                   	push   %rbp
+  80367c:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80367f:	48 b8 68 35 80 00 00 	movabs $0x803568,%rax
+  803686:	00 00 00 
+  803689:	ff d0                	call   *%rax
+  80368b:	83 e0 01             	and    $0x1,%eax
+}
+  80368e:	5d                   	pop    %rbp
+  80368f:	c3                   	ret
+
+0000000000803690 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803690:	55                   	push   %rbp
+  803691:	48 89 e5             	mov    %rsp,%rbp
+  803694:	41 57                	push   %r15
+  803696:	41 56                	push   %r14
+  803698:	41 55                	push   %r13
+  80369a:	41 54                	push   %r12
+  80369c:	53                   	push   %rbx
+  80369d:	48 83 ec 18          	sub    $0x18,%rsp
+  8036a1:	49 89 ff             	mov    %rdi,%r15
+  8036a4:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8036a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  8036ad:	49 bc 7b 36 80 00 00 	movabs $0x80367b,%r12
+  8036b4:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  8036b7:	49 be 1c 36 80 00 00 	movabs $0x80361c,%r14
+  8036be:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8036c1:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  8036c8:	00 00 00 
+  8036cb:	eb 0c                	jmp    8036d9 <foreach_shared_region+0x49>
+  8036cd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8036d4:	4c 39 eb             	cmp    %r13,%rbx
+  8036d7:	74 38                	je     803711 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  8036d9:	48 89 df             	mov    %rbx,%rdi
+  8036dc:	41 ff d4             	call   *%r12
+  8036df:	84 c0                	test   %al,%al
+  8036e1:	74 ea                	je     8036cd <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  8036e3:	48 89 df             	mov    %rbx,%rdi
+  8036e6:	41 ff d6             	call   *%r14
+  8036e9:	a8 40                	test   $0x40,%al
+  8036eb:	74 e0                	je     8036cd <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8036ed:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8036f4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8036f8:	48 89 df             	mov    %rbx,%rdi
+  8036fb:	41 ff d7             	call   *%r15
+        if (err)
+  8036fe:	85 c0                	test   %eax,%eax
+  803700:	74 cb                	je     8036cd <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  803702:	48 83 c4 18          	add    $0x18,%rsp
+  803706:	5b                   	pop    %rbx
+  803707:	41 5c                	pop    %r12
+  803709:	41 5d                	pop    %r13
+  80370b:	41 5e                	pop    %r14
+  80370d:	41 5f                	pop    %r15
+  80370f:	5d                   	pop    %rbp
+  803710:	c3                   	ret
+    return 0;
+  803711:	b8 00 00 00 00       	mov    $0x0,%eax
+  803716:	eb ea                	jmp    803702 <foreach_shared_region+0x72>
+
+0000000000803718 <_generic_signal_handler>:
+        (es->sa.sa_handler)(es->signo);
+    }
+}
+
+void
+_generic_signal_handler(struct UTrapframe *utf, struct EnqueuedSignal * es) {
+  803718:	55                   	push   %rbp
+  803719:	48 89 e5             	mov    %rsp,%rbp
+  80371c:	41 55                	push   %r13
+  80371e:	41 54                	push   %r12
+  803720:	53                   	push   %rbx
+  803721:	48 83 ec 08          	sub    $0x8,%rsp
+  803725:	49 89 fc             	mov    %rdi,%r12
+  803728:	48 89 f3             	mov    %rsi,%rbx
+    if (trace_signals)
+        cprintf("signals: env %x: begin generic handler for %d\n", sys_getenvid(), es->signo);
+  80372b:	44 8b 2e             	mov    (%rsi),%r13d
+  80372e:	48 b8 0e 1f 80 00 00 	movabs $0x801f0e,%rax
+  803735:	00 00 00 
+  803738:	ff d0                	call   *%rax
+  80373a:	89 c6                	mov    %eax,%esi
+  80373c:	44 89 ea             	mov    %r13d,%edx
+  80373f:	48 bf e0 47 80 00 00 	movabs $0x8047e0,%rdi
+  803746:	00 00 00 
+  803749:	b8 00 00 00 00       	mov    $0x0,%eax
+  80374e:	48 b9 f9 10 80 00 00 	movabs $0x8010f9,%rcx
+  803755:	00 00 00 
+  803758:	ff d1                	call   *%rcx
+    if (es->sa.sa_handler == SIG_DFL) {
+  80375a:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80375e:	48 85 c0             	test   %rax,%rax
+  803761:	74 57                	je     8037ba <_generic_signal_handler+0xa2>
+    if (es->sa.sa_handler == SIG_IGN) {
+  803763:	48 83 f8 01          	cmp    $0x1,%rax
+  803767:	0f 84 c0 00 00 00    	je     80382d <_generic_signal_handler+0x115>
+    if (es->sa.sa_flags & SA_SIGINFO) {
+  80376d:	f6 43 14 04          	testb  $0x4,0x14(%rbx)
+  803771:	0f 84 ea 00 00 00    	je     803861 <_generic_signal_handler+0x149>
+        (es->sa.sa_sigaction)(es->signo, &(es->info), utf);
+  803777:	48 8d 73 18          	lea    0x18(%rbx),%rsi
+  80377b:	8b 3b                	mov    (%rbx),%edi
+  80377d:	4c 89 e2             	mov    %r12,%rdx
+  803780:	ff d0                	call   *%rax
+
+    _generic_signal_handler_impl(utf, es);
+
+    if (trace_signals)
+        cprintf("signals: env %x: end generic handler for %d\n", sys_getenvid(), es->signo);
+  803782:	8b 1b                	mov    (%rbx),%ebx
+  803784:	48 b8 0e 1f 80 00 00 	movabs $0x801f0e,%rax
+  80378b:	00 00 00 
+  80378e:	ff d0                	call   *%rax
+  803790:	89 c6                	mov    %eax,%esi
+  803792:	89 da                	mov    %ebx,%edx
+  803794:	48 bf 68 48 80 00 00 	movabs $0x804868,%rdi
+  80379b:	00 00 00 
+  80379e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037a3:	48 b9 f9 10 80 00 00 	movabs $0x8010f9,%rcx
+  8037aa:	00 00 00 
+  8037ad:	ff d1                	call   *%rcx
+}
+  8037af:	48 83 c4 08          	add    $0x8,%rsp
+  8037b3:	5b                   	pop    %rbx
+  8037b4:	41 5c                	pop    %r12
+  8037b6:	41 5d                	pop    %r13
+  8037b8:	5d                   	pop    %rbp
+  8037b9:	c3                   	ret
+            cprintf("signals: env %x: exiting due to signal %d\n", sys_getenvid(), es->signo);
+  8037ba:	8b 1b                	mov    (%rbx),%ebx
+  8037bc:	48 b8 0e 1f 80 00 00 	movabs $0x801f0e,%rax
+  8037c3:	00 00 00 
+  8037c6:	ff d0                	call   *%rax
+  8037c8:	89 c6                	mov    %eax,%esi
+  8037ca:	89 da                	mov    %ebx,%edx
+  8037cc:	48 bf 10 48 80 00 00 	movabs $0x804810,%rdi
+  8037d3:	00 00 00 
+  8037d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037db:	48 b9 f9 10 80 00 00 	movabs $0x8010f9,%rcx
+  8037e2:	00 00 00 
+  8037e5:	ff d1                	call   *%rcx
+        sys_env_destroy(CURENVID);
+  8037e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037ec:	48 b8 a3 1e 80 00 00 	movabs $0x801ea3,%rax
+  8037f3:	00 00 00 
+  8037f6:	ff d0                	call   *%rax
+        assert(false);
+  8037f8:	48 b9 86 40 80 00 00 	movabs $0x804086,%rcx
+  8037ff:	00 00 00 
+  803802:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  803809:	00 00 00 
+  80380c:	be 0c 00 00 00       	mov    $0xc,%esi
+  803811:	48 bf 95 48 80 00 00 	movabs $0x804895,%rdi
+  803818:	00 00 00 
+  80381b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803820:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  803827:	00 00 00 
+  80382a:	41 ff d0             	call   *%r8
+            cprintf("signals: env %x: ignoring signal %d\n", sys_getenvid(), es->signo);
+  80382d:	44 8b 23             	mov    (%rbx),%r12d
+  803830:	48 b8 0e 1f 80 00 00 	movabs $0x801f0e,%rax
+  803837:	00 00 00 
+  80383a:	ff d0                	call   *%rax
+  80383c:	89 c6                	mov    %eax,%esi
+  80383e:	44 89 e2             	mov    %r12d,%edx
+  803841:	48 bf 40 48 80 00 00 	movabs $0x804840,%rdi
+  803848:	00 00 00 
+  80384b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803850:	48 b9 f9 10 80 00 00 	movabs $0x8010f9,%rcx
+  803857:	00 00 00 
+  80385a:	ff d1                	call   *%rcx
+        return;
+  80385c:	e9 21 ff ff ff       	jmp    803782 <_generic_signal_handler+0x6a>
+        (es->sa.sa_handler)(es->signo);
+  803861:	8b 3b                	mov    (%rbx),%edi
+  803863:	ff d0                	call   *%rax
+  803865:	e9 18 ff ff ff       	jmp    803782 <_generic_signal_handler+0x6a>
+
+000000000080386a <sigqueue>:
+
+int sigqueue(pid_t pid, int signo, const union sigval value) {
+  80386a:	55                   	push   %rbp
+  80386b:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigqueue(pid, signo, value);
+  80386e:	48 b8 d2 23 80 00 00 	movabs $0x8023d2,%rax
+  803875:	00 00 00 
+  803878:	ff d0                	call   *%rax
+}
+  80387a:	5d                   	pop    %rbp
+  80387b:	c3                   	ret
+
+000000000080387c <sigwait>:
+
+int sigwait(const sigset_t * set, int * sig) {
+  80387c:	55                   	push   %rbp
+  80387d:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigwait(set, sig);
+  803880:	48 b8 39 24 80 00 00 	movabs $0x802439,%rax
+  803887:	00 00 00 
+  80388a:	ff d0                	call   *%rax
+}
+  80388c:	5d                   	pop    %rbp
+  80388d:	c3                   	ret
+
+000000000080388e <sigaction>:
+
+extern void _signal_handler_trampoline(void);
+
+int sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80388e:	55                   	push   %rbp
+  80388f:	48 89 e5             	mov    %rsp,%rbp
+  803892:	41 55                	push   %r13
+  803894:	41 54                	push   %r12
+  803896:	53                   	push   %rbx
+  803897:	48 83 ec 08          	sub    $0x8,%rsp
+  80389b:	89 fb                	mov    %edi,%ebx
+  80389d:	49 89 f4             	mov    %rsi,%r12
+  8038a0:	49 89 d5             	mov    %rdx,%r13
+    int err = sys_env_set_pgfault_upcall(CURENVID, _signal_handler_trampoline);
+  8038a3:	48 be 20 3b 80 00 00 	movabs $0x803b20,%rsi
+  8038aa:	00 00 00 
+  8038ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038b2:	48 b8 a3 22 80 00 00 	movabs $0x8022a3,%rax
+  8038b9:	00 00 00 
+  8038bc:	ff d0                	call   *%rax
+    if (err)
+  8038be:	85 c0                	test   %eax,%eax
+  8038c0:	74 0b                	je     8038cd <sigaction+0x3f>
+        return err;
+    return sys_sigaction(sig, act, oact);
+}
+  8038c2:	48 83 c4 08          	add    $0x8,%rsp
+  8038c6:	5b                   	pop    %rbx
+  8038c7:	41 5c                	pop    %r12
+  8038c9:	41 5d                	pop    %r13
+  8038cb:	5d                   	pop    %rbp
+  8038cc:	c3                   	ret
+    return sys_sigaction(sig, act, oact);
+  8038cd:	4c 89 ea             	mov    %r13,%rdx
+  8038d0:	4c 89 e6             	mov    %r12,%rsi
+  8038d3:	89 df                	mov    %ebx,%edi
+  8038d5:	48 b8 a2 24 80 00 00 	movabs $0x8024a2,%rax
+  8038dc:	00 00 00 
+  8038df:	ff d0                	call   *%rax
+  8038e1:	eb df                	jmp    8038c2 <sigaction+0x34>
+
+00000000008038e3 <sigprocmask>:
+
+int sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8038e3:	55                   	push   %rbp
+  8038e4:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigprocmask(how, set, oldset);
+  8038e7:	48 b8 09 25 80 00 00 	movabs $0x802509,%rax
+  8038ee:	00 00 00 
+  8038f1:	ff d0                	call   *%rax
+}
+  8038f3:	5d                   	pop    %rbp
+  8038f4:	c3                   	ret
+
+00000000008038f5 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8038f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038fa:	c3                   	ret
+
+00000000008038fb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8038fb:	55                   	push   %rbp
+  8038fc:	48 89 e5             	mov    %rsp,%rbp
+  8038ff:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803902:	48 be a2 48 80 00 00 	movabs $0x8048a2,%rsi
+  803909:	00 00 00 
+  80390c:	48 b8 1e 1a 80 00 00 	movabs $0x801a1e,%rax
+  803913:	00 00 00 
+  803916:	ff d0                	call   *%rax
+    return 0;
+}
+  803918:	b8 00 00 00 00       	mov    $0x0,%eax
+  80391d:	5d                   	pop    %rbp
+  80391e:	c3                   	ret
+
+000000000080391f <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80391f:	55                   	push   %rbp
+  803920:	48 89 e5             	mov    %rsp,%rbp
+  803923:	41 57                	push   %r15
+  803925:	41 56                	push   %r14
+  803927:	41 55                	push   %r13
+  803929:	41 54                	push   %r12
+  80392b:	53                   	push   %rbx
+  80392c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803933:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80393a:	48 85 d2             	test   %rdx,%rdx
+  80393d:	74 7a                	je     8039b9 <devcons_write+0x9a>
+  80393f:	49 89 d6             	mov    %rdx,%r14
+  803942:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803948:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80394d:	49 bf 18 1c 80 00 00 	movabs $0x801c18,%r15
+  803954:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803957:	4c 89 f3             	mov    %r14,%rbx
+  80395a:	48 29 f3             	sub    %rsi,%rbx
+  80395d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803962:	48 39 c3             	cmp    %rax,%rbx
+  803965:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803969:	4c 63 eb             	movslq %ebx,%r13
+  80396c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803973:	48 01 c6             	add    %rax,%rsi
+  803976:	4c 89 ea             	mov    %r13,%rdx
+  803979:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803980:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803983:	4c 89 ee             	mov    %r13,%rsi
+  803986:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80398d:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  803994:	00 00 00 
+  803997:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803999:	41 01 dc             	add    %ebx,%r12d
+  80399c:	49 63 f4             	movslq %r12d,%rsi
+  80399f:	4c 39 f6             	cmp    %r14,%rsi
+  8039a2:	72 b3                	jb     803957 <devcons_write+0x38>
+    return res;
+  8039a4:	49 63 c4             	movslq %r12d,%rax
+}
+  8039a7:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8039ae:	5b                   	pop    %rbx
+  8039af:	41 5c                	pop    %r12
+  8039b1:	41 5d                	pop    %r13
+  8039b3:	41 5e                	pop    %r14
+  8039b5:	41 5f                	pop    %r15
+  8039b7:	5d                   	pop    %rbp
+  8039b8:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8039b9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8039bf:	eb e3                	jmp    8039a4 <devcons_write+0x85>
+
+00000000008039c1 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8039c1:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8039c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039c9:	48 85 c0             	test   %rax,%rax
+  8039cc:	74 55                	je     803a23 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8039ce:	55                   	push   %rbp
+  8039cf:	48 89 e5             	mov    %rsp,%rbp
+  8039d2:	41 55                	push   %r13
+  8039d4:	41 54                	push   %r12
+  8039d6:	53                   	push   %rbx
+  8039d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8039db:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8039de:	48 bb 72 1e 80 00 00 	movabs $0x801e72,%rbx
+  8039e5:	00 00 00 
+  8039e8:	49 bc 3f 1f 80 00 00 	movabs $0x801f3f,%r12
+  8039ef:	00 00 00 
+  8039f2:	eb 03                	jmp    8039f7 <devcons_read+0x36>
+  8039f4:	41 ff d4             	call   *%r12
+  8039f7:	ff d3                	call   *%rbx
+  8039f9:	85 c0                	test   %eax,%eax
+  8039fb:	74 f7                	je     8039f4 <devcons_read+0x33>
+    if (c < 0) return c;
+  8039fd:	48 63 d0             	movslq %eax,%rdx
+  803a00:	78 13                	js     803a15 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803a02:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a07:	83 f8 04             	cmp    $0x4,%eax
+  803a0a:	74 09                	je     803a15 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803a0c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803a10:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803a15:	48 89 d0             	mov    %rdx,%rax
+  803a18:	48 83 c4 08          	add    $0x8,%rsp
+  803a1c:	5b                   	pop    %rbx
+  803a1d:	41 5c                	pop    %r12
+  803a1f:	41 5d                	pop    %r13
+  803a21:	5d                   	pop    %rbp
+  803a22:	c3                   	ret
+  803a23:	48 89 d0             	mov    %rdx,%rax
+  803a26:	c3                   	ret
+
+0000000000803a27 <cputchar>:
+cputchar(int ch) {
+  803a27:	55                   	push   %rbp
+  803a28:	48 89 e5             	mov    %rsp,%rbp
+  803a2b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803a2f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803a33:	be 01 00 00 00       	mov    $0x1,%esi
+  803a38:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803a3c:	48 b8 45 1e 80 00 00 	movabs $0x801e45,%rax
+  803a43:	00 00 00 
+  803a46:	ff d0                	call   *%rax
+}
+  803a48:	c9                   	leave
+  803a49:	c3                   	ret
+
+0000000000803a4a <getchar>:
+getchar(void) {
+  803a4a:	55                   	push   %rbp
+  803a4b:	48 89 e5             	mov    %rsp,%rbp
+  803a4e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803a52:	ba 01 00 00 00       	mov    $0x1,%edx
+  803a57:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803a5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a60:	48 b8 e1 29 80 00 00 	movabs $0x8029e1,%rax
+  803a67:	00 00 00 
+  803a6a:	ff d0                	call   *%rax
+  803a6c:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803a6e:	85 c0                	test   %eax,%eax
+  803a70:	78 06                	js     803a78 <getchar+0x2e>
+  803a72:	74 08                	je     803a7c <getchar+0x32>
+  803a74:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803a78:	89 d0                	mov    %edx,%eax
+  803a7a:	c9                   	leave
+  803a7b:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803a7c:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803a81:	eb f5                	jmp    803a78 <getchar+0x2e>
+
+0000000000803a83 <iscons>:
+iscons(int fdnum) {
+  803a83:	55                   	push   %rbp
+  803a84:	48 89 e5             	mov    %rsp,%rbp
+  803a87:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803a8b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803a8f:	48 b8 fe 26 80 00 00 	movabs $0x8026fe,%rax
+  803a96:	00 00 00 
+  803a99:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803a9b:	85 c0                	test   %eax,%eax
+  803a9d:	78 18                	js     803ab7 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803a9f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803aa3:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  803aaa:	00 00 00 
+  803aad:	8b 00                	mov    (%rax),%eax
+  803aaf:	39 02                	cmp    %eax,(%rdx)
+  803ab1:	0f 94 c0             	sete   %al
+  803ab4:	0f b6 c0             	movzbl %al,%eax
+}
+  803ab7:	c9                   	leave
+  803ab8:	c3                   	ret
+
+0000000000803ab9 <opencons>:
+opencons(void) {
+  803ab9:	55                   	push   %rbp
+  803aba:	48 89 e5             	mov    %rsp,%rbp
+  803abd:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803ac1:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803ac5:	48 b8 9e 26 80 00 00 	movabs $0x80269e,%rax
+  803acc:	00 00 00 
+  803acf:	ff d0                	call   *%rax
+  803ad1:	85 c0                	test   %eax,%eax
+  803ad3:	78 49                	js     803b1e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803ad5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ada:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803adf:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803ae3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ae8:	48 b8 ce 1f 80 00 00 	movabs $0x801fce,%rax
+  803aef:	00 00 00 
+  803af2:	ff d0                	call   *%rax
+  803af4:	85 c0                	test   %eax,%eax
+  803af6:	78 26                	js     803b1e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803af8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803afc:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  803b03:	00 00 
+  803b05:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803b07:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b0b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803b12:	48 b8 70 26 80 00 00 	movabs $0x802670,%rax
+  803b19:	00 00 00 
+  803b1c:	ff d0                	call   *%rax
+}
+  803b1e:	c9                   	leave
+  803b1f:	c3                   	ret
+
+0000000000803b20 <_pgfault_upcall>:
+.text
+.globl _pgfault_upcall
+.globl _signal_handler_trampoline
+_pgfault_upcall:
+_signal_handler_trampoline:
+    movq  %rsp,%rdi # passing the function argument (UTrapframe *) in rdi
+  803b20:	48 89 e7             	mov    %rsp,%rdi
+    # sizeof(struct EnqueuedSignal) == 56
+    # sizeof(curenv->env_sig_mask) == 4
+    # + 4 bytes of alignment
+    add $64, %rdi
+  803b23:	48 83 c7 40          	add    $0x40,%rdi
+
+    # load signo
+    mov (%rsp), %eax
+  803b27:	8b 04 24             	mov    (%rsp),%eax
+    test %eax, %eax
+  803b2a:	85 c0                	test   %eax,%eax
+    jnz _call_generic_signal_handler
+  803b2c:	75 0e                	jne    803b3c <_call_generic_signal_handler>
+
+    # Call the C page fault handler.
+    movabs $_handle_vectored_pagefault, %rax
+  803b2e:	48 b8 60 3d 80 00 00 	movabs $0x803d60,%rax
+  803b35:	00 00 00 
+    call *%rax
+  803b38:	ff d0                	call   *%rax
+    jmp _return_from_handler
+  803b3a:	eb 0f                	jmp    803b4b <_return_from_handler>
+
+0000000000803b3c <_call_generic_signal_handler>:
+
+_call_generic_signal_handler:
+    movq %rsp, %rsi # passing the function argument (EnqueuedSignal *) in rsi
+  803b3c:	48 89 e6             	mov    %rsp,%rsi
+    movabs $_generic_signal_handler, %rax
+  803b3f:	48 b8 18 37 80 00 00 	movabs $0x803718,%rax
+  803b46:	00 00 00 
+    call *%rax
+  803b49:	ff d0                	call   *%rax
+
+0000000000803b4b <_return_from_handler>:
+
+_return_from_handler:
+    # ignore EnqueuedSignal and env_sig_mask
+    add $64, %rsp
+  803b4b:	48 83 c4 40          	add    $0x40,%rsp
+    # put SIG_SETMASK as the first func arg
+    movq $3, %rdi
+  803b4f:	48 c7 c7 03 00 00 00 	mov    $0x3,%rdi
+    # load &env_sig_mask (as the second func arg)
+    lea -4(%rsp), %rsi
+  803b56:	48 8d 74 24 fc       	lea    -0x4(%rsp),%rsi
+    # NULL as the third arg
+    xor %rdx, %rdx
+  803b5b:	48 31 d2             	xor    %rdx,%rdx
+    # restore blocked signals mask
+    movabs $sys_sigprocmask, %rax
+  803b5e:	48 b8 09 25 80 00 00 	movabs $0x802509,%rax
+  803b65:	00 00 00 
+    call *%rax
+  803b68:	ff d0                	call   *%rax
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    # ignore utf_fault_va, utf_err
+    addq $16, %rsp
+  803b6a:	48 83 c4 10          	add    $0x10,%rsp
+    # restore utf_regs, save rax again
+    POPA
+  803b6e:	4c 8b 3c 24          	mov    (%rsp),%r15
+  803b72:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  803b77:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  803b7c:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  803b81:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  803b86:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  803b8b:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  803b90:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  803b95:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  803b9a:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  803b9f:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  803ba4:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  803ba9:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  803bae:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  803bb3:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  803bb8:	48 83 c4 78          	add    $0x78,%rsp
+    pushq %rax
+  803bbc:	50                   	push   %rax
+    # 16 utf_rflags
+    #  8 utf_rip
+    #  0 rax
+
+    # load utf_rip
+    movq 8(%rsp), %rax
+  803bbd:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    # save rbx to utf_rip
+    movq %rbx, 8(%rsp)
+  803bc2:	48 89 5c 24 08       	mov    %rbx,0x8(%rsp)
+    # load utf_rsp
+    movq 24(%rsp), %rbx
+  803bc7:	48 8b 5c 24 18       	mov    0x18(%rsp),%rbx
+    # store return address to *utf_stack
+    subq $8, 24(%rsp)
+  803bcc:	48 83 6c 24 18 08    	subq   $0x8,0x18(%rsp)
+    movq %rax, -8(%rbx)
+  803bd2:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    # restore rax and rbx
+    popq %rax
+  803bd6:	58                   	pop    %rax
+    popq %rbx
+  803bd7:	5b                   	pop    %rbx
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+    popfq
+  803bd8:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    popq %rsp
+  803bd9:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  803bda:	c3                   	ret
+
+0000000000803bdb <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803bdb:	55                   	push   %rbp
+  803bdc:	48 89 e5             	mov    %rsp,%rbp
+  803bdf:	41 54                	push   %r12
+  803be1:	53                   	push   %rbx
+  803be2:	48 89 fb             	mov    %rdi,%rbx
+  803be5:	48 89 f7             	mov    %rsi,%rdi
+  803be8:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  803beb:	48 85 f6             	test   %rsi,%rsi
+  803bee:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803bf5:	00 00 00 
+  803bf8:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  803bfc:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c01:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  803c08:	00 00 00 
+  803c0b:	ff d0                	call   *%rax
+    if (res < 0) {
+  803c0d:	85 c0                	test   %eax,%eax
+  803c0f:	78 45                	js     803c56 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  803c11:	48 85 db             	test   %rbx,%rbx
+  803c14:	74 12                	je     803c28 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  803c16:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  803c1d:	00 00 00 
+  803c20:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  803c26:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  803c28:	4d 85 e4             	test   %r12,%r12
+  803c2b:	74 14                	je     803c41 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  803c2d:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  803c34:	00 00 00 
+  803c37:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  803c3d:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  803c41:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  803c48:	00 00 00 
+  803c4b:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  803c51:	5b                   	pop    %rbx
+  803c52:	41 5c                	pop    %r12
+  803c54:	5d                   	pop    %rbp
+  803c55:	c3                   	ret
+        if (from_env_store)
+  803c56:	48 85 db             	test   %rbx,%rbx
+  803c59:	74 06                	je     803c61 <ipc_recv+0x86>
+            *from_env_store = 0;
+  803c5b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  803c61:	4d 85 e4             	test   %r12,%r12
+  803c64:	74 eb                	je     803c51 <ipc_recv+0x76>
+            *perm_store = 0;
+  803c66:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803c6d:	00 
+  803c6e:	eb e1                	jmp    803c51 <ipc_recv+0x76>
+
+0000000000803c70 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803c70:	55                   	push   %rbp
+  803c71:	48 89 e5             	mov    %rsp,%rbp
+  803c74:	41 57                	push   %r15
+  803c76:	41 56                	push   %r14
+  803c78:	41 55                	push   %r13
+  803c7a:	41 54                	push   %r12
+  803c7c:	53                   	push   %rbx
+  803c7d:	48 83 ec 18          	sub    $0x18,%rsp
+  803c81:	41 89 fd             	mov    %edi,%r13d
+  803c84:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803c87:	48 89 d3             	mov    %rdx,%rbx
+  803c8a:	49 89 cc             	mov    %rcx,%r12
+  803c8d:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  803c91:	48 85 d2             	test   %rdx,%rdx
+  803c94:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803c9b:	00 00 00 
+  803c9e:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803ca2:	49 be 0c 23 80 00 00 	movabs $0x80230c,%r14
+  803ca9:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  803cac:	49 bf 3f 1f 80 00 00 	movabs $0x801f3f,%r15
+  803cb3:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803cb6:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803cb9:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  803cbd:	4c 89 e1             	mov    %r12,%rcx
+  803cc0:	48 89 da             	mov    %rbx,%rdx
+  803cc3:	44 89 ef             	mov    %r13d,%edi
+  803cc6:	41 ff d6             	call   *%r14
+        if (res == 0)
+  803cc9:	85 c0                	test   %eax,%eax
+  803ccb:	74 34                	je     803d01 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  803ccd:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803cd0:	75 05                	jne    803cd7 <ipc_send+0x67>
+        sys_yield();
+  803cd2:	41 ff d7             	call   *%r15
+    while (true) {
+  803cd5:	eb df                	jmp    803cb6 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  803cd7:	48 ba ae 48 80 00 00 	movabs $0x8048ae,%rdx
+  803cde:	00 00 00 
+  803ce1:	be 3e 00 00 00       	mov    $0x3e,%esi
+  803ce6:	48 bf c7 48 80 00 00 	movabs $0x8048c7,%rdi
+  803ced:	00 00 00 
+  803cf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cf5:	48 b9 a9 0f 80 00 00 	movabs $0x800fa9,%rcx
+  803cfc:	00 00 00 
+  803cff:	ff d1                	call   *%rcx
+    }
+}
+  803d01:	48 83 c4 18          	add    $0x18,%rsp
+  803d05:	5b                   	pop    %rbx
+  803d06:	41 5c                	pop    %r12
+  803d08:	41 5d                	pop    %r13
+  803d0a:	41 5e                	pop    %r14
+  803d0c:	41 5f                	pop    %r15
+  803d0e:	5d                   	pop    %rbp
+  803d0f:	c3                   	ret
+
+0000000000803d10 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803d10:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803d15:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803d1c:	00 00 00 
+  803d1f:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  803d26:	48 01 ca             	add    %rcx,%rdx
+  803d29:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803d2f:	39 fa                	cmp    %edi,%edx
+  803d31:	74 12                	je     803d45 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803d33:	48 83 c0 01          	add    $0x1,%rax
+  803d37:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  803d3d:	75 e0                	jne    803d1f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803d3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d44:	c3                   	ret
+            return envs[i].env_id;
+  803d45:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  803d4c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803d53:	00 00 00 
+  803d56:	48 01 d0             	add    %rdx,%rax
+  803d59:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803d5f:	c3                   	ret
+
+0000000000803d60 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  803d60:	55                   	push   %rbp
+  803d61:	48 89 e5             	mov    %rsp,%rbp
+  803d64:	41 56                	push   %r14
+  803d66:	41 55                	push   %r13
+  803d68:	41 54                	push   %r12
+  803d6a:	53                   	push   %rbx
+  803d6b:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803d6e:	48 b8 68 80 80 00 00 	movabs $0x808068,%rax
+  803d75:	00 00 00 
+  803d78:	48 83 38 00          	cmpq   $0x0,(%rax)
+  803d7c:	74 27                	je     803da5 <_handle_vectored_pagefault+0x45>
+  803d7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  803d83:	49 bd 20 80 80 00 00 	movabs $0x808020,%r13
+  803d8a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803d8d:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  803d90:	4c 89 e7             	mov    %r12,%rdi
+  803d93:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  803d98:	84 c0                	test   %al,%al
+  803d9a:	75 45                	jne    803de1 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803d9c:	48 83 c3 01          	add    $0x1,%rbx
+  803da0:	49 3b 1e             	cmp    (%r14),%rbx
+  803da3:	72 eb                	jb     803d90 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  803da5:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  803dac:	00 
+  803dad:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  803db2:	4d 8b 04 24          	mov    (%r12),%r8
+  803db6:	48 ba d8 48 80 00 00 	movabs $0x8048d8,%rdx
+  803dbd:	00 00 00 
+  803dc0:	be 1d 00 00 00       	mov    $0x1d,%esi
+  803dc5:	48 bf 6f 49 80 00 00 	movabs $0x80496f,%rdi
+  803dcc:	00 00 00 
+  803dcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dd4:	49 ba a9 0f 80 00 00 	movabs $0x800fa9,%r10
+  803ddb:	00 00 00 
+  803dde:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  803de1:	5b                   	pop    %rbx
+  803de2:	41 5c                	pop    %r12
+  803de4:	41 5d                	pop    %r13
+  803de6:	41 5e                	pop    %r14
+  803de8:	5d                   	pop    %rbp
+  803de9:	c3                   	ret
+
+0000000000803dea <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  803dea:	55                   	push   %rbp
+  803deb:	48 89 e5             	mov    %rsp,%rbp
+  803dee:	53                   	push   %rbx
+  803def:	48 83 ec 08          	sub    $0x8,%rsp
+  803df3:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  803df6:	48 b8 60 80 80 00 00 	movabs $0x808060,%rax
+  803dfd:	00 00 00 
+  803e00:	80 38 00             	cmpb   $0x0,(%rax)
+  803e03:	74 61                	je     803e66 <add_pgfault_handler+0x7c>
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803e05:	48 b8 68 80 80 00 00 	movabs $0x808068,%rax
+  803e0c:	00 00 00 
+  803e0f:	48 8b 10             	mov    (%rax),%rdx
+  803e12:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  803e17:	48 b9 20 80 80 00 00 	movabs $0x808020,%rcx
+  803e1e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803e21:	48 85 d2             	test   %rdx,%rdx
+  803e24:	74 19                	je     803e3f <add_pgfault_handler+0x55>
+        if (handler == _pfhandler_vec[i]) return 0;
+  803e26:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  803e2a:	74 2f                	je     803e5b <add_pgfault_handler+0x71>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803e2c:	48 83 c0 01          	add    $0x1,%rax
+  803e30:	48 39 d0             	cmp    %rdx,%rax
+  803e33:	75 f1                	jne    803e26 <add_pgfault_handler+0x3c>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  803e35:	48 83 fa 08          	cmp    $0x8,%rdx
+  803e39:	0f 84 f7 00 00 00    	je     803f36 <add_pgfault_handler+0x14c>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  803e3f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  803e43:	48 a3 68 80 80 00 00 	movabs %rax,0x808068
+  803e4a:	00 00 00 
+  803e4d:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  803e54:	00 00 00 
+  803e57:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  803e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e60:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e64:	c9                   	leave
+  803e65:	c3                   	ret
+        if (sys_alloc_region(CURENVID, ues_beg, PAGE_SIZE, PROT_RW))
+  803e66:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803e6b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e70:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  803e77:	00 00 00 
+  803e7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e7f:	48 b8 ce 1f 80 00 00 	movabs $0x801fce,%rax
+  803e86:	00 00 00 
+  803e89:	ff d0                	call   *%rax
+  803e8b:	85 c0                	test   %eax,%eax
+  803e8d:	75 53                	jne    803ee2 <add_pgfault_handler+0xf8>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  803e8f:	48 ba 68 80 80 00 00 	movabs $0x808068,%rdx
+  803e96:	00 00 00 
+  803e99:	48 8b 02             	mov    (%rdx),%rax
+  803e9c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803ea0:	48 89 0a             	mov    %rcx,(%rdx)
+  803ea3:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  803eaa:	00 00 00 
+  803ead:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        if (sys_env_set_pgfault_upcall(CURENVID, _pgfault_upcall))
+  803eb1:	48 be 20 3b 80 00 00 	movabs $0x803b20,%rsi
+  803eb8:	00 00 00 
+  803ebb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ec0:	48 b8 a3 22 80 00 00 	movabs $0x8022a3,%rax
+  803ec7:	00 00 00 
+  803eca:	ff d0                	call   *%rax
+  803ecc:	85 c0                	test   %eax,%eax
+  803ece:	75 3c                	jne    803f0c <add_pgfault_handler+0x122>
+        _pfhandler_inititiallized = 1;
+  803ed0:	48 b8 60 80 80 00 00 	movabs $0x808060,%rax
+  803ed7:	00 00 00 
+  803eda:	c6 00 01             	movb   $0x1,(%rax)
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803edd:	e9 79 ff ff ff       	jmp    803e5b <add_pgfault_handler+0x71>
+            panic("add_pgfault_handler: sys_alloc_region failed");
+  803ee2:	48 ba 08 49 80 00 00 	movabs $0x804908,%rdx
+  803ee9:	00 00 00 
+  803eec:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803ef1:	48 bf 6f 49 80 00 00 	movabs $0x80496f,%rdi
+  803ef8:	00 00 00 
+  803efb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f00:	48 b9 a9 0f 80 00 00 	movabs $0x800fa9,%rcx
+  803f07:	00 00 00 
+  803f0a:	ff d1                	call   *%rcx
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+  803f0c:	48 ba 38 49 80 00 00 	movabs $0x804938,%rdx
+  803f13:	00 00 00 
+  803f16:	be 32 00 00 00       	mov    $0x32,%esi
+  803f1b:	48 bf 6f 49 80 00 00 	movabs $0x80496f,%rdi
+  803f22:	00 00 00 
+  803f25:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f2a:	48 b9 a9 0f 80 00 00 	movabs $0x800fa9,%rcx
+  803f31:	00 00 00 
+  803f34:	ff d1                	call   *%rcx
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803f36:	b9 fd ff ff ff       	mov    $0xfffffffd,%ecx
+  803f3b:	48 ba 7d 49 80 00 00 	movabs $0x80497d,%rdx
+  803f42:	00 00 00 
+  803f45:	be 40 00 00 00       	mov    $0x40,%esi
+  803f4a:	48 bf 6f 49 80 00 00 	movabs $0x80496f,%rdi
+  803f51:	00 00 00 
+  803f54:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f59:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  803f60:	00 00 00 
+  803f63:	41 ff d0             	call   *%r8
+
+0000000000803f66 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  803f66:	55                   	push   %rbp
+  803f67:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  803f6a:	48 b8 60 80 80 00 00 	movabs $0x808060,%rax
+  803f71:	00 00 00 
+  803f74:	80 38 00             	cmpb   $0x0,(%rax)
+  803f77:	74 33                	je     803fac <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803f79:	48 a1 68 80 80 00 00 	movabs 0x808068,%rax
+  803f80:	00 00 00 
+  803f83:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  803f88:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  803f8f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803f92:	48 85 c0             	test   %rax,%rax
+  803f95:	0f 84 85 00 00 00    	je     804020 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  803f9b:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  803f9f:	74 40                	je     803fe1 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803fa1:	48 83 c1 01          	add    $0x1,%rcx
+  803fa5:	48 39 c1             	cmp    %rax,%rcx
+  803fa8:	75 f1                	jne    803f9b <remove_pgfault_handler+0x35>
+  803faa:	eb 74                	jmp    804020 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  803fac:	48 b9 95 49 80 00 00 	movabs $0x804995,%rcx
+  803fb3:	00 00 00 
+  803fb6:	48 ba 39 40 80 00 00 	movabs $0x804039,%rdx
+  803fbd:	00 00 00 
+  803fc0:	be 46 00 00 00       	mov    $0x46,%esi
+  803fc5:	48 bf 6f 49 80 00 00 	movabs $0x80496f,%rdi
+  803fcc:	00 00 00 
+  803fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd4:	49 b8 a9 0f 80 00 00 	movabs $0x800fa9,%r8
+  803fdb:	00 00 00 
+  803fde:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  803fe1:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  803fe8:	00 
+  803fe9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803fed:	48 29 ca             	sub    %rcx,%rdx
+  803ff0:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  803ff7:	00 00 00 
+  803ffa:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  803ffe:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804003:	48 89 ce             	mov    %rcx,%rsi
+  804006:	48 b8 18 1c 80 00 00 	movabs $0x801c18,%rax
+  80400d:	00 00 00 
+  804010:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804012:	48 b8 68 80 80 00 00 	movabs $0x808068,%rax
+  804019:	00 00 00 
+  80401c:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804020:	5d                   	pop    %rbp
+  804021:	c3                   	ret
+  804022:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000804028 <__rodata_start>:
+  804028:	73 69                	jae    804093 <__rodata_start+0x6b>
+  80402a:	67 6e                	outsb  %ds:(%esi),(%dx)
+  80402c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80402d:	20 3d 3d 20 53 49    	and    %bh,0x4953203d(%rip)        # 49d36070 <__bss_end+0x4952d070>
+  804033:	47 55                	rex.RXB push %r13
+  804035:	53                   	push   %rbx
+  804036:	52                   	push   %rdx
+  804037:	32 00                	xor    (%rax),%al
+  804039:	61                   	(bad)
+  80403a:	73 73                	jae    8040af <__rodata_start+0x87>
+  80403c:	65 72 74             	gs jb  8040b3 <__rodata_start+0x8b>
+  80403f:	69 6f 6e 20 66 61 69 	imul   $0x69616620,0x6e(%rdi),%ebp
+  804046:	6c                   	insb   (%dx),%es:(%rdi)
+  804047:	65 64 3a 20          	gs cmp %fs:(%rax),%ah
+  80404b:	25 73 00 75 73       	and    $0x73750073,%eax
+  804050:	65 72 2f             	gs jb  804082 <__rodata_start+0x5a>
+  804053:	62 61 64 73 69       	(bad)
+  804058:	67 2e 63 00          	cs movsxd (%eax),%eax
+  80405c:	73 69                	jae    8040c7 <__rodata_start+0x9f>
+  80405e:	67 6e                	outsb  %ds:(%esi),(%dx)
+  804060:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804061:	20 3d 3d 20 53 49    	and    %bh,0x4953203d(%rip)        # 49d360a4 <__bss_end+0x4952d0a4>
+  804067:	47                   	rex.RXB
+  804068:	43                   	rex.XB
+  804069:	48                   	rex.W
+  80406a:	4c                   	rex.WR
+  80406b:	44 00 65 72          	add    %r12b,0x72(%rbp)
+  80406f:	72 20                	jb     804091 <__rodata_start+0x69>
+  804071:	3d 3d 20 2d 45       	cmp    $0x452d203d,%eax
+  804076:	5f                   	pop    %rdi
+  804077:	49                   	rex.WB
+  804078:	4e 56                	rex.WRX push %rsi
+  80407a:	41                   	rex.B
+  80407b:	4c 00 65 72          	rex.WR add %r12b,0x72(%rbp)
+  80407f:	72 20                	jb     8040a1 <__rodata_start+0x79>
+  804081:	3d 3d 20 30 00       	cmp    $0x30203d,%eax
+  804086:	66 61                	data16 (bad)
+  804088:	6c                   	insb   (%dx),%es:(%rdi)
+  804089:	73 65                	jae    8040f0 <__rodata_start+0xc8>
+  80408b:	00 65 72             	add    %ah,0x72(%rbp)
+  80408e:	72 20                	jb     8040b0 <__rodata_start+0x88>
+  804090:	3d 3d 20 2d 45       	cmp    $0x452d203d,%eax
+  804095:	5f                   	pop    %rdi
+  804096:	41                   	rex.B
+  804097:	47                   	rex.RXB
+  804098:	41                   	rex.B
+  804099:	49                   	rex.WB
+  80409a:	4e 00 21             	rex.WRX add %r12b,(%rcx)
+  80409d:	75 70                	jne    80410f <__rodata_start+0xe7>
+  80409f:	64 61                	fs (bad)
+  8040a1:	74 65                	je     804108 <__rodata_start+0xe0>
+  8040a3:	64 00 66 69          	add    %ah,%fs:0x69(%rsi)
+  8040a7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8040a8:	69 73 68 65 64 5f 63 	imul   $0x635f6465,0x68(%rbx),%esi
+  8040af:	68 69 6c 64 72       	push   $0x72646c69
+  8040b4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8040b6:	20 3d 3d 20 37 00    	and    %bh,0x37203d(%rip)        # b760f9 <__bss_end+0x36d0f9>
+  8040bc:	66 69 6e 69 73 68    	imul   $0x6873,0x69(%rsi),%bp
+  8040c2:	65 64 5f             	gs fs pop %rdi
+  8040c5:	63 68 69             	movsxd 0x69(%rax),%ebp
+  8040c8:	6c                   	insb   (%dx),%es:(%rdi)
+  8040c9:	64 72 65             	fs jb  804131 <__rodata_start+0x109>
+  8040cc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8040cd:	20 3d 3d 20 31 30    	and    %bh,0x3031203d(%rip)        # 30b16110 <__bss_end+0x3030d110>
+  8040d3:	00 54 65 73          	add    %dl,0x73(%rbp,%riz,2)
+  8040d7:	74 20                	je     8040f9 <__rodata_start+0xd1>
+  8040d9:	66 69 6e 69 73 68    	imul   $0x6873,0x69(%rsi),%bp
+  8040df:	65 64 0a 00          	gs or  %fs:(%rax),%al
+  8040e3:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+  8040e8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8040e9:	6c                   	insb   (%dx),%es:(%rdi)
+  8040ea:	64 5f                	fs pop %rdi
+  8040ec:	74 65                	je     804153 <__rodata_start+0x12b>
+  8040ee:	73 74                	jae    804164 <__rodata_start+0x13c>
+  8040f0:	5f                   	pop    %rdi
+  8040f1:	73 65                	jae    804158 <__rodata_start+0x130>
+  8040f3:	74 20                	je     804115 <__rodata_start+0xed>
+  8040f5:	3d 3d 20 28 53       	cmp    $0x5328203d,%eax
+  8040fa:	49                   	rex.WB
+  8040fb:	47                   	rex.RXB
+  8040fc:	4e                   	rex.WRX
+  8040fd:	41                   	rex.B
+  8040fe:	4c 5f                	rex.WR pop %rdi
+  804100:	46                   	rex.RX
+  804101:	4c                   	rex.WR
+  804102:	41                   	rex.B
+  804103:	47 28 53 49          	rex.RXB sub %r10b,0x49(%r11)
+  804107:	47 55                	rex.RXB push %r13
+  804109:	53                   	push   %rbx
+  80410a:	52                   	push   %rdx
+  80410b:	32 29                	xor    (%rcx),%ch
+  80410d:	20 7c 20 53          	and    %bh,0x53(%rax,%riz,1)
+  804111:	49                   	rex.WB
+  804112:	47                   	rex.RXB
+  804113:	4e                   	rex.WRX
+  804114:	41                   	rex.B
+  804115:	4c 5f                	rex.WR pop %rdi
+  804117:	46                   	rex.RX
+  804118:	4c                   	rex.WR
+  804119:	41                   	rex.B
+  80411a:	47 28 53 49          	rex.RXB sub %r10b,0x49(%r11)
+  80411e:	47 54                	rex.RXB push %r12
+  804120:	45 52                	rex.RB push %r10
+  804122:	4d 29 29             	sub    %r13,(%r9)
+  804125:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  80412c:	77 6e                	ja     80419c <__rodata_start+0x174>
+  80412e:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  804132:	30 38                	xor    %bh,(%rax)
+  804134:	78 5d                	js     804193 <__rodata_start+0x16b>
+  804136:	20 75 73             	and    %dh,0x73(%rbp)
+  804139:	65 72 20             	gs jb  80415c <__rodata_start+0x134>
+  80413c:	70 61                	jo     80419f <__rodata_start+0x177>
+  80413e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80413f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804146:	73 20                	jae    804168 <__rodata_start+0x140>
+  804148:	61                   	(bad)
+  804149:	74 20                	je     80416b <__rodata_start+0x143>
+  80414b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804150:	3a 20                	cmp    (%rax),%ah
+  804152:	00 30                	add    %dh,(%rax)
+  804154:	31 32                	xor    %esi,(%rdx)
+  804156:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80415d:	41                   	rex.B
+  80415e:	42                   	rex.X
+  80415f:	43                   	rex.XB
+  804160:	44                   	rex.R
+  804161:	45                   	rex.RB
+  804162:	46 00 30             	rex.RX add %r14b,(%rax)
+  804165:	31 32                	xor    %esi,(%rdx)
+  804167:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80416e:	61                   	(bad)
+  80416f:	62 63 64 65 66       	(bad)
+  804174:	00 28                	add    %ch,(%rax)
+  804176:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804177:	75 6c                	jne    8041e5 <__rodata_start+0x1bd>
+  804179:	6c                   	insb   (%dx),%es:(%rdi)
+  80417a:	29 00                	sub    %eax,(%rax)
+  80417c:	65 72 72             	gs jb  8041f1 <__rodata_start+0x1c9>
+  80417f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804180:	72 20                	jb     8041a2 <__rodata_start+0x17a>
+  804182:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804187:	73 70                	jae    8041f9 <__rodata_start+0x1d1>
+  804189:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80418d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804194:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804195:	72 00                	jb     804197 <__rodata_start+0x16f>
+  804197:	62 61 64 20 65       	(bad)
+  80419c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80419d:	76 69                	jbe    804208 <__rodata_start+0x1e0>
+  80419f:	72 6f                	jb     804210 <__rodata_start+0x1e8>
+  8041a1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8041a2:	6d                   	insl   (%dx),%es:(%rdi)
+  8041a3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8041a5:	74 00                	je     8041a7 <__rodata_start+0x17f>
+  8041a7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8041ae:	20 70 61             	and    %dh,0x61(%rax)
+  8041b1:	72 61                	jb     804214 <__rodata_start+0x1ec>
+  8041b3:	6d                   	insl   (%dx),%es:(%rdi)
+  8041b4:	65 74 65             	gs je  80421c <__rodata_start+0x1f4>
+  8041b7:	72 00                	jb     8041b9 <__rodata_start+0x191>
+  8041b9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8041ba:	75 74                	jne    804230 <__rodata_start+0x208>
+  8041bc:	20 6f 66             	and    %ch,0x66(%rdi)
+  8041bf:	20 6d 65             	and    %ch,0x65(%rbp)
+  8041c2:	6d                   	insl   (%dx),%es:(%rdi)
+  8041c3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8041c4:	72 79                	jb     80423f <__rodata_start+0x217>
+  8041c6:	00 6f 75             	add    %ch,0x75(%rdi)
+  8041c9:	74 20                	je     8041eb <__rodata_start+0x1c3>
+  8041cb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8041cc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8041d0:	76 69                	jbe    80423b <__rodata_start+0x213>
+  8041d2:	72 6f                	jb     804243 <__rodata_start+0x21b>
+  8041d4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8041d5:	6d                   	insl   (%dx),%es:(%rdi)
+  8041d6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8041d8:	74 73                	je     80424d <__rodata_start+0x225>
+  8041da:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8041dd:	72 72                	jb     804251 <__rodata_start+0x229>
+  8041df:	75 70                	jne    804251 <__rodata_start+0x229>
+  8041e1:	74 65                	je     804248 <__rodata_start+0x220>
+  8041e3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8041e8:	75 67                	jne    804251 <__rodata_start+0x229>
+  8041ea:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8041ed:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8041ef:	00 73 65             	add    %dh,0x65(%rbx)
+  8041f2:	67 6d                	insl   (%dx),%es:(%edi)
+  8041f4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8041f6:	74 61                	je     804259 <__rodata_start+0x231>
+  8041f8:	74 69                	je     804263 <__rodata_start+0x23b>
+  8041fa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8041fb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8041fc:	20 66 61             	and    %ah,0x61(%rsi)
+  8041ff:	75 6c                	jne    80426d <__rodata_start+0x245>
+  804201:	74 00                	je     804203 <__rodata_start+0x1db>
+  804203:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80420a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80420d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804211:	61                   	(bad)
+  804212:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804217:	20 73 75             	and    %dh,0x75(%rbx)
+  80421a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80421d:	73 79                	jae    804298 <__rodata_start+0x270>
+  80421f:	73 74                	jae    804295 <__rodata_start+0x26d>
+  804221:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804223:	20 63 61             	and    %ah,0x61(%rbx)
+  804226:	6c                   	insb   (%dx),%es:(%rdi)
+  804227:	6c                   	insb   (%dx),%es:(%rdi)
+  804228:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80422b:	74 72                	je     80429f <__rodata_start+0x277>
+  80422d:	79 20                	jns    80424f <__rodata_start+0x227>
+  80422f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804230:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804231:	74 20                	je     804253 <__rodata_start+0x22b>
+  804233:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804235:	75 6e                	jne    8042a5 <__rodata_start+0x27d>
+  804237:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80423b:	76 20                	jbe    80425d <__rodata_start+0x235>
+  80423d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804244:	72 65                	jb     8042ab <__rodata_start+0x283>
+  804246:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804249:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80424a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80424e:	65 78 70             	gs js  8042c1 <__rodata_start+0x299>
+  804251:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804256:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804259:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80425d:	20 66 69             	and    %ah,0x69(%rsi)
+  804260:	6c                   	insb   (%dx),%es:(%rdi)
+  804261:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804265:	20 66 72             	and    %ah,0x72(%rsi)
+  804268:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80426d:	61                   	(bad)
+  80426e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804271:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804272:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804273:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804277:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80427a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80427b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80427c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80427f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804280:	79 20                	jns    8042a2 <__rodata_start+0x27a>
+  804282:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804289:	72 65                	jb     8042f0 <__rodata_start+0x2c8>
+  80428b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80428e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804290:	00 66 69             	add    %ah,0x69(%rsi)
+  804293:	6c                   	insb   (%dx),%es:(%rdi)
+  804294:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804298:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80429b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80429c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80429f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8042a0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8042a1:	74 20                	je     8042c3 <__rodata_start+0x29b>
+  8042a3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8042a5:	75 6e                	jne    804315 <__rodata_start+0x2ed>
+  8042a7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8042ab:	76 61                	jbe    80430e <__rodata_start+0x2e6>
+  8042ad:	6c                   	insb   (%dx),%es:(%rdi)
+  8042ae:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8042b5:	00 
+  8042b6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8042bd:	72 65                	jb     804324 <__rodata_start+0x2fc>
+  8042bf:	61                   	(bad)
+  8042c0:	64 79 20             	fs jns 8042e3 <__rodata_start+0x2bb>
+  8042c3:	65 78 69             	gs js  80432f <__rodata_start+0x307>
+  8042c6:	73 74                	jae    80433c <__rodata_start+0x314>
+  8042c8:	73 00                	jae    8042ca <__rodata_start+0x2a2>
+  8042ca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8042cb:	70 65                	jo     804332 <__rodata_start+0x30a>
+  8042cd:	72 61                	jb     804330 <__rodata_start+0x308>
+  8042cf:	74 69                	je     80433a <__rodata_start+0x312>
+  8042d1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8042d2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8042d3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8042d6:	74 20                	je     8042f8 <__rodata_start+0x2d0>
+  8042d8:	73 75                	jae    80434f <__rodata_start+0x327>
+  8042da:	70 70                	jo     80434c <__rodata_start+0x324>
+  8042dc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8042dd:	72 74                	jb     804353 <__rodata_start+0x32b>
+  8042df:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8042e4:	65 72 61             	gs jb  804348 <__rodata_start+0x320>
+  8042e7:	74 69                	je     804352 <__rodata_start+0x32a>
+  8042e9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8042ea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8042eb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8042ee:	74 20                	je     804310 <__rodata_start+0x2e8>
+  8042f0:	70 65                	jo     804357 <__rodata_start+0x32f>
+  8042f2:	72 6d                	jb     804361 <__rodata_start+0x339>
+  8042f4:	69 74 74 65 64 00 66 	imul   $0xf660064,0x65(%rsp,%rsi,2),%esi
+  8042fb:	0f 
+  8042fc:	1f                   	(bad)
+  8042fd:	44 00 00             	add    %r8b,(%rax)
+  804300:	e6 12                	out    %al,$0x12
+  804302:	80 00 00             	addb   $0x0,(%rax)
+  804305:	00 00                	add    %al,(%rax)
+  804307:	00 27                	add    %ah,(%rdi)
+  804309:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80430f:	00 17                	add    %dl,(%rdi)
+  804311:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804317:	00 27                	add    %ah,(%rdi)
+  804319:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80431f:	00 27                	add    %ah,(%rdi)
+  804321:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804327:	00 27                	add    %ah,(%rdi)
+  804329:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80432f:	00 27                	add    %ah,(%rdi)
+  804331:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804337:	00 05 13 80 00 00    	add    %al,0x8013(%rip)        # 80c350 <__bss_end+0x3350>
+  80433d:	00 00                	add    %al,(%rax)
+  80433f:	00 27                	add    %ah,(%rdi)
+  804341:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804347:	00 27                	add    %ah,(%rdi)
+  804349:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80434f:	00 f9                	add    %bh,%cl
+  804351:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  804357:	00 73 13             	add    %dh,0x13(%rbx)
+  80435a:	80 00 00             	addb   $0x0,(%rax)
+  80435d:	00 00                	add    %al,(%rax)
+  80435f:	00 27                	add    %ah,(%rdi)
+  804361:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804367:	00 f9                	add    %bh,%cl
+  804369:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80436f:	00 3f                	add    %bh,(%rdi)
+  804371:	13 80 00 00 00 00    	adc    0x0(%rax),%eax
+  804377:	00 3f                	add    %bh,(%rdi)
+  804379:	13 80 00 00 00 00    	adc    0x0(%rax),%eax
+  80437f:	00 3f                	add    %bh,(%rdi)
+  804381:	13 80 00 00 00 00    	adc    0x0(%rax),%eax
+  804387:	00 3f                	add    %bh,(%rdi)
+  804389:	13 80 00 00 00 00    	adc    0x0(%rax),%eax
+  80438f:	00 3f                	add    %bh,(%rdi)
+  804391:	13 80 00 00 00 00    	adc    0x0(%rax),%eax
+  804397:	00 3f                	add    %bh,(%rdi)
+  804399:	13 80 00 00 00 00    	adc    0x0(%rax),%eax
+  80439f:	00 3f                	add    %bh,(%rdi)
+  8043a1:	13 80 00 00 00 00    	adc    0x0(%rax),%eax
+  8043a7:	00 3f                	add    %bh,(%rdi)
+  8043a9:	13 80 00 00 00 00    	adc    0x0(%rax),%eax
+  8043af:	00 3f                	add    %bh,(%rdi)
+  8043b1:	13 80 00 00 00 00    	adc    0x0(%rax),%eax
+  8043b7:	00 27                	add    %ah,(%rdi)
+  8043b9:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8043bf:	00 27                	add    %ah,(%rdi)
+  8043c1:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8043c7:	00 27                	add    %ah,(%rdi)
+  8043c9:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8043cf:	00 27                	add    %ah,(%rdi)
+  8043d1:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8043d7:	00 27                	add    %ah,(%rdi)
+  8043d9:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8043df:	00 27                	add    %ah,(%rdi)
+  8043e1:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8043e7:	00 27                	add    %ah,(%rdi)
+  8043e9:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8043ef:	00 27                	add    %ah,(%rdi)
+  8043f1:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8043f7:	00 27                	add    %ah,(%rdi)
+  8043f9:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8043ff:	00 27                	add    %ah,(%rdi)
+  804401:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804407:	00 27                	add    %ah,(%rdi)
+  804409:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80440f:	00 27                	add    %ah,(%rdi)
+  804411:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804417:	00 27                	add    %ah,(%rdi)
+  804419:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80441f:	00 27                	add    %ah,(%rdi)
+  804421:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804427:	00 27                	add    %ah,(%rdi)
+  804429:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80442f:	00 27                	add    %ah,(%rdi)
+  804431:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804437:	00 27                	add    %ah,(%rdi)
+  804439:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80443f:	00 27                	add    %ah,(%rdi)
+  804441:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804447:	00 27                	add    %ah,(%rdi)
+  804449:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80444f:	00 27                	add    %ah,(%rdi)
+  804451:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804457:	00 27                	add    %ah,(%rdi)
+  804459:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80445f:	00 27                	add    %ah,(%rdi)
+  804461:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804467:	00 27                	add    %ah,(%rdi)
+  804469:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80446f:	00 27                	add    %ah,(%rdi)
+  804471:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804477:	00 27                	add    %ah,(%rdi)
+  804479:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80447f:	00 27                	add    %ah,(%rdi)
+  804481:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804487:	00 27                	add    %ah,(%rdi)
+  804489:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80448f:	00 27                	add    %ah,(%rdi)
+  804491:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804497:	00 27                	add    %ah,(%rdi)
+  804499:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80449f:	00 27                	add    %ah,(%rdi)
+  8044a1:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8044a7:	00 4a 18             	add    %cl,0x18(%rdx)
+  8044aa:	80 00 00             	addb   $0x0,(%rax)
+  8044ad:	00 00                	add    %al,(%rax)
+  8044af:	00 27                	add    %ah,(%rdi)
+  8044b1:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8044b7:	00 27                	add    %ah,(%rdi)
+  8044b9:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8044bf:	00 27                	add    %ah,(%rdi)
+  8044c1:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8044c7:	00 27                	add    %ah,(%rdi)
+  8044c9:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8044cf:	00 27                	add    %ah,(%rdi)
+  8044d1:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8044d7:	00 27                	add    %ah,(%rdi)
+  8044d9:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8044df:	00 27                	add    %ah,(%rdi)
+  8044e1:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8044e7:	00 27                	add    %ah,(%rdi)
+  8044e9:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8044ef:	00 27                	add    %ah,(%rdi)
+  8044f1:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8044f7:	00 27                	add    %ah,(%rdi)
+  8044f9:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8044ff:	00 96 13 80 00 00    	add    %dl,0x8013(%rsi)
+  804505:	00 00                	add    %al,(%rax)
+  804507:	00 65 15             	add    %ah,0x15(%rbp)
+  80450a:	80 00 00             	addb   $0x0,(%rax)
+  80450d:	00 00                	add    %al,(%rax)
+  80450f:	00 27                	add    %ah,(%rdi)
+  804511:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804517:	00 27                	add    %ah,(%rdi)
+  804519:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80451f:	00 27                	add    %ah,(%rdi)
+  804521:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804527:	00 27                	add    %ah,(%rdi)
+  804529:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80452f:	00 c5                	add    %al,%ch
+  804531:	13 80 00 00 00 00    	adc    0x0(%rax),%eax
+  804537:	00 27                	add    %ah,(%rdi)
+  804539:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80453f:	00 27                	add    %ah,(%rdi)
+  804541:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804547:	00 8b 13 80 00 00    	add    %cl,0x8013(%rbx)
+  80454d:	00 00                	add    %al,(%rax)
+  80454f:	00 27                	add    %ah,(%rdi)
+  804551:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804557:	00 27                	add    %ah,(%rdi)
+  804559:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80455f:	00 0d 17 80 00 00    	add    %cl,0x8017(%rip)        # 80c57c <__bss_end+0x357c>
+  804565:	00 00                	add    %al,(%rax)
+  804567:	00 d7                	add    %dl,%bh
+  804569:	17                   	(bad)
+  80456a:	80 00 00             	addb   $0x0,(%rax)
+  80456d:	00 00                	add    %al,(%rax)
+  80456f:	00 27                	add    %ah,(%rdi)
+  804571:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  804577:	00 27                	add    %ah,(%rdi)
+  804579:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80457f:	00 5c 14 80          	add    %bl,-0x80(%rsp,%rdx,1)
+  804583:	00 00                	add    %al,(%rax)
+  804585:	00 00                	add    %al,(%rax)
+  804587:	00 27                	add    %ah,(%rdi)
+  804589:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80458f:	00 39                	add    %bh,(%rcx)
+  804591:	16                   	(bad)
+  804592:	80 00 00             	addb   $0x0,(%rax)
+  804595:	00 00                	add    %al,(%rax)
+  804597:	00 27                	add    %ah,(%rdi)
+  804599:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  80459f:	00 27                	add    %ah,(%rdi)
+  8045a1:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8045a7:	00 4a 18             	add    %cl,0x18(%rdx)
+  8045aa:	80 00 00             	addb   $0x0,(%rax)
+  8045ad:	00 00                	add    %al,(%rax)
+  8045af:	00 27                	add    %ah,(%rdi)
+  8045b1:	19 80 00 00 00 00    	sbb    %eax,0x0(%rax)
+  8045b7:	00 ef                	add    %ch,%bh
+  8045b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+	...
+
+00000000008045c0 <error_string>:
+	...
+  8045c8:	85 41 80 00 00 00 00 00 97 41 80 00 00 00 00 00     .A.......A......
+  8045d8:	a7 41 80 00 00 00 00 00 b9 41 80 00 00 00 00 00     .A.......A......
+  8045e8:	c7 41 80 00 00 00 00 00 db 41 80 00 00 00 00 00     .A.......A......
+  8045f8:	f0 41 80 00 00 00 00 00 03 42 80 00 00 00 00 00     .A.......B......
+  804608:	15 42 80 00 00 00 00 00 29 42 80 00 00 00 00 00     .B......)B......
+  804618:	39 42 80 00 00 00 00 00 4c 42 80 00 00 00 00 00     9B......LB......
+  804628:	63 42 80 00 00 00 00 00 79 42 80 00 00 00 00 00     cB......yB......
+  804638:	91 42 80 00 00 00 00 00 a9 42 80 00 00 00 00 00     .B.......B......
+  804648:	b6 42 80 00 00 00 00 00 70 46 80 00 00 00 00 00     .B......pF......
+  804658:	ca 42 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .B..............
+  804668:	e2 42 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .B......file is 
+  804678:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  804688:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  804698:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8046a8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8046b8:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  8046c8:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  8046d8:	6c 69 62 2f 66 6f 72 6b 2e 63 00 0f 1f 44 00 00     lib/fork.c...D..
+  8046e8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8046f8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804708:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804718:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804728:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804738:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804748:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804758:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804768:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804778:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000804780 <devtab>:
+  804780:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804790:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  8047a0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8047b0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8047c0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8047d0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 0f 1f 40 00     _SIZE) == 2...@.
+  8047e0:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  8047f0:	20 62 65 67 69 6e 20 67 65 6e 65 72 69 63 20 68      begin generic h
+  804800:	61 6e 64 6c 65 72 20 66 6f 72 20 25 64 0a 00 00     andler for %d...
+  804810:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  804820:	20 65 78 69 74 69 6e 67 20 64 75 65 20 74 6f 20      exiting due to 
+  804830:	73 69 67 6e 61 6c 20 25 64 0a 00 00 00 00 00 00     signal %d.......
+  804840:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  804850:	20 69 67 6e 6f 72 69 6e 67 20 73 69 67 6e 61 6c      ignoring signal
+  804860:	20 25 64 0a 00 00 00 00 73 69 67 6e 61 6c 73 3a      %d.....signals:
+  804870:	20 65 6e 76 20 25 78 3a 20 65 6e 64 20 67 65 6e      env %x: end gen
+  804880:	65 72 69 63 20 68 61 6e 64 6c 65 72 20 66 6f 72     eric handler for
+  804890:	20 25 64 0a 00 6c 69 62 2f 73 69 67 6e 61 6c 2e      %d..lib/signal.
+  8048a0:	63 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00 69 70     c.<cons>.cons.ip
+  8048b0:	63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64 20 74     c_send: failed t
+  8048c0:	6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63 2e 63     o send.lib/ipc.c
+  8048d0:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  8048e0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  8048f0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  804900:	65 72 72 3d 25 78 0a 00 61 64 64 5f 70 67 66 61     err=%x..add_pgfa
+  804910:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  804920:	5f 61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61     _alloc_region fa
+  804930:	69 6c 65 64 00 00 00 00 61 64 64 5f 70 67 66 61     iled....add_pgfa
+  804940:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  804950:	5f 65 6e 76 5f 73 65 74 5f 70 67 66 61 75 6c 74     _env_set_pgfault
+  804960:	5f 75 70 63 61 6c 6c 20 66 61 69 6c 65 64 00 6c     _upcall failed.l
+  804970:	69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65 74     ib/pgfault.c.set
+  804980:	5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65 72     _pgfault_handler
+  804990:	3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72 5f     : %i._pfhandler_
+  8049a0:	69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00 66     inititiallized.f
+  8049b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8049c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8049e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8049f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
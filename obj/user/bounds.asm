@@ -0,0 +1,5658 @@
+
+obj/user/bounds:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 3a 00 00 00       	call   80005d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Test for UBSAN support - accessing array element with an out-of-borders index */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	48 83 ec 10          	sub    $0x10,%rsp
+    int a[4] = {0};
+    /* Trying to print the value of the fifth element of the array (which causes undefined behavior).
+     * The "cprintf" function is sanitized by UBSAN because lib/Makefrag accesses the USER_SAN_CFLAGS variable.
+     * The access operator ([]) is not used because it will trigger -Warray-bounds option of Clang,
+     * which will make this test unrunnable because of -Werror flag which is specified in GNUmakefile. */
+    cprintf("%d\n", *(a + 5));
+  80002d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  800034:	00 
+  800035:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80003c:	00 
+  80003d:	8b 75 04             	mov    0x4(%rbp),%esi
+  800040:	48 bf 48 2b 80 00 00 	movabs $0x802b48,%rdi
+  800047:	00 00 00 
+  80004a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004f:	48 ba d4 01 80 00 00 	movabs $0x8001d4,%rdx
+  800056:	00 00 00 
+  800059:	ff d2                	call   *%rdx
+}
+  80005b:	c9                   	leave
+  80005c:	c3                   	ret
+
+000000000080005d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80005d:	55                   	push   %rbp
+  80005e:	48 89 e5             	mov    %rsp,%rbp
+  800061:	41 56                	push   %r14
+  800063:	41 55                	push   %r13
+  800065:	41 54                	push   %r12
+  800067:	53                   	push   %rbx
+  800068:	41 89 fd             	mov    %edi,%r13d
+  80006b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80006e:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800075:	00 00 00 
+  800078:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80007f:	00 00 00 
+  800082:	48 39 c2             	cmp    %rax,%rdx
+  800085:	73 17                	jae    80009e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800087:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80008a:	49 89 c4             	mov    %rax,%r12
+  80008d:	48 83 c3 08          	add    $0x8,%rbx
+  800091:	b8 00 00 00 00       	mov    $0x0,%eax
+  800096:	ff 53 f8             	call   *-0x8(%rbx)
+  800099:	4c 39 e3             	cmp    %r12,%rbx
+  80009c:	72 ef                	jb     80008d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  80009e:	48 b8 e9 0f 80 00 00 	movabs $0x800fe9,%rax
+  8000a5:	00 00 00 
+  8000a8:	ff d0                	call   *%rax
+  8000aa:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8000ad:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8000b4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000bb:	00 00 00 
+  8000be:	48 01 d0             	add    %rdx,%rax
+  8000c1:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000c8:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000cb:	45 85 ed             	test   %r13d,%r13d
+  8000ce:	7e 0d                	jle    8000dd <libmain+0x80>
+  8000d0:	49 8b 06             	mov    (%r14),%rax
+  8000d3:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000da:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000dd:	4c 89 f6             	mov    %r14,%rsi
+  8000e0:	44 89 ef             	mov    %r13d,%edi
+  8000e3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000ea:	00 00 00 
+  8000ed:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000ef:	48 b8 04 01 80 00 00 	movabs $0x800104,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+#endif
+}
+  8000fb:	5b                   	pop    %rbx
+  8000fc:	41 5c                	pop    %r12
+  8000fe:	41 5d                	pop    %r13
+  800100:	41 5e                	pop    %r14
+  800102:	5d                   	pop    %rbp
+  800103:	c3                   	ret
+
+0000000000800104 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800104:	55                   	push   %rbp
+  800105:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800108:	48 b8 71 18 80 00 00 	movabs $0x801871,%rax
+  80010f:	00 00 00 
+  800112:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800114:	bf 00 00 00 00       	mov    $0x0,%edi
+  800119:	48 b8 7e 0f 80 00 00 	movabs $0x800f7e,%rax
+  800120:	00 00 00 
+  800123:	ff d0                	call   *%rax
+}
+  800125:	5d                   	pop    %rbp
+  800126:	c3                   	ret
+
+0000000000800127 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800127:	55                   	push   %rbp
+  800128:	48 89 e5             	mov    %rsp,%rbp
+  80012b:	53                   	push   %rbx
+  80012c:	48 83 ec 08          	sub    $0x8,%rsp
+  800130:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800133:	8b 06                	mov    (%rsi),%eax
+  800135:	8d 50 01             	lea    0x1(%rax),%edx
+  800138:	89 16                	mov    %edx,(%rsi)
+  80013a:	48 98                	cltq
+  80013c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800141:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800147:	74 0a                	je     800153 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800149:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80014d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800151:	c9                   	leave
+  800152:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800153:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800157:	be ff 00 00 00       	mov    $0xff,%esi
+  80015c:	48 b8 20 0f 80 00 00 	movabs $0x800f20,%rax
+  800163:	00 00 00 
+  800166:	ff d0                	call   *%rax
+        state->offset = 0;
+  800168:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80016e:	eb d9                	jmp    800149 <putch+0x22>
+
+0000000000800170 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800170:	55                   	push   %rbp
+  800171:	48 89 e5             	mov    %rsp,%rbp
+  800174:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80017b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80017e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800185:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80018a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800192:	48 89 f1             	mov    %rsi,%rcx
+  800195:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80019c:	48 bf 27 01 80 00 00 	movabs $0x800127,%rdi
+  8001a3:	00 00 00 
+  8001a6:	48 b8 24 03 80 00 00 	movabs $0x800324,%rax
+  8001ad:	00 00 00 
+  8001b0:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001b2:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001b9:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001c0:	48 b8 20 0f 80 00 00 	movabs $0x800f20,%rax
+  8001c7:	00 00 00 
+  8001ca:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001cc:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001d2:	c9                   	leave
+  8001d3:	c3                   	ret
+
+00000000008001d4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001d4:	55                   	push   %rbp
+  8001d5:	48 89 e5             	mov    %rsp,%rbp
+  8001d8:	48 83 ec 50          	sub    $0x50,%rsp
+  8001dc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001e0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001e4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001e8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001ec:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001f0:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001f7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8001ff:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800203:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800207:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80020b:	48 b8 70 01 80 00 00 	movabs $0x800170,%rax
+  800212:	00 00 00 
+  800215:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800217:	c9                   	leave
+  800218:	c3                   	ret
+
+0000000000800219 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800219:	55                   	push   %rbp
+  80021a:	48 89 e5             	mov    %rsp,%rbp
+  80021d:	41 57                	push   %r15
+  80021f:	41 56                	push   %r14
+  800221:	41 55                	push   %r13
+  800223:	41 54                	push   %r12
+  800225:	53                   	push   %rbx
+  800226:	48 83 ec 18          	sub    $0x18,%rsp
+  80022a:	49 89 fc             	mov    %rdi,%r12
+  80022d:	49 89 f5             	mov    %rsi,%r13
+  800230:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800234:	8b 45 10             	mov    0x10(%rbp),%eax
+  800237:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80023a:	41 89 cf             	mov    %ecx,%r15d
+  80023d:	4c 39 fa             	cmp    %r15,%rdx
+  800240:	73 5b                	jae    80029d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800242:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800246:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80024a:	85 db                	test   %ebx,%ebx
+  80024c:	7e 0e                	jle    80025c <print_num+0x43>
+            putch(padc, put_arg);
+  80024e:	4c 89 ee             	mov    %r13,%rsi
+  800251:	44 89 f7             	mov    %r14d,%edi
+  800254:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800257:	83 eb 01             	sub    $0x1,%ebx
+  80025a:	75 f2                	jne    80024e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80025c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800260:	48 b9 67 2b 80 00 00 	movabs $0x802b67,%rcx
+  800267:	00 00 00 
+  80026a:	48 b8 56 2b 80 00 00 	movabs $0x802b56,%rax
+  800271:	00 00 00 
+  800274:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800278:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80027c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800281:	49 f7 f7             	div    %r15
+  800284:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800288:	4c 89 ee             	mov    %r13,%rsi
+  80028b:	41 ff d4             	call   *%r12
+}
+  80028e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800292:	5b                   	pop    %rbx
+  800293:	41 5c                	pop    %r12
+  800295:	41 5d                	pop    %r13
+  800297:	41 5e                	pop    %r14
+  800299:	41 5f                	pop    %r15
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80029d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a6:	49 f7 f7             	div    %r15
+  8002a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ad:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002b1:	52                   	push   %rdx
+  8002b2:	45 0f be c9          	movsbl %r9b,%r9d
+  8002b6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002ba:	48 89 c2             	mov    %rax,%rdx
+  8002bd:	48 b8 19 02 80 00 00 	movabs $0x800219,%rax
+  8002c4:	00 00 00 
+  8002c7:	ff d0                	call   *%rax
+  8002c9:	48 83 c4 10          	add    $0x10,%rsp
+  8002cd:	eb 8d                	jmp    80025c <print_num+0x43>
+
+00000000008002cf <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002cf:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002d3:	48 8b 06             	mov    (%rsi),%rax
+  8002d6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002da:	73 0a                	jae    8002e6 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002dc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002e0:	48 89 16             	mov    %rdx,(%rsi)
+  8002e3:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002e6:	c3                   	ret
+
+00000000008002e7 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002e7:	55                   	push   %rbp
+  8002e8:	48 89 e5             	mov    %rsp,%rbp
+  8002eb:	48 83 ec 50          	sub    $0x50,%rsp
+  8002ef:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002f3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002f7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002fb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800302:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800306:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80030a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80030e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800312:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800316:	48 b8 24 03 80 00 00 	movabs $0x800324,%rax
+  80031d:	00 00 00 
+  800320:	ff d0                	call   *%rax
+}
+  800322:	c9                   	leave
+  800323:	c3                   	ret
+
+0000000000800324 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800324:	55                   	push   %rbp
+  800325:	48 89 e5             	mov    %rsp,%rbp
+  800328:	41 57                	push   %r15
+  80032a:	41 56                	push   %r14
+  80032c:	41 55                	push   %r13
+  80032e:	41 54                	push   %r12
+  800330:	53                   	push   %rbx
+  800331:	48 83 ec 38          	sub    $0x38,%rsp
+  800335:	49 89 fe             	mov    %rdi,%r14
+  800338:	49 89 f5             	mov    %rsi,%r13
+  80033b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80033e:	48 8b 01             	mov    (%rcx),%rax
+  800341:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800345:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800349:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80034d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800351:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800355:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800359:	0f b6 3b             	movzbl (%rbx),%edi
+  80035c:	40 80 ff 25          	cmp    $0x25,%dil
+  800360:	74 18                	je     80037a <vprintfmt+0x56>
+            if (!ch) return;
+  800362:	40 84 ff             	test   %dil,%dil
+  800365:	0f 84 b1 06 00 00    	je     800a1c <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80036b:	40 0f b6 ff          	movzbl %dil,%edi
+  80036f:	4c 89 ee             	mov    %r13,%rsi
+  800372:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800375:	4c 89 e3             	mov    %r12,%rbx
+  800378:	eb db                	jmp    800355 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80037a:	be 00 00 00 00       	mov    $0x0,%esi
+  80037f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800383:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800388:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80038e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800395:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800399:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80039e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003a3:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003a6:	83 e8 23             	sub    $0x23,%eax
+  8003a9:	3c 57                	cmp    $0x57,%al
+  8003ab:	0f 87 51 06 00 00    	ja     800a02 <vprintfmt+0x6de>
+  8003b1:	0f b6 c0             	movzbl %al,%eax
+  8003b4:	48 b9 00 2d 80 00 00 	movabs $0x802d00,%rcx
+  8003bb:	00 00 00 
+  8003be:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003c1:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003c4:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003c8:	eb cf                	jmp    800399 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003ca:	49 89 dc             	mov    %rbx,%r12
+  8003cd:	be 01 00 00 00       	mov    $0x1,%esi
+  8003d2:	eb c5                	jmp    800399 <vprintfmt+0x75>
+            padc = ch;
+  8003d4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003d8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003db:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003de:	eb b9                	jmp    800399 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8003e6:	77 24                	ja     80040c <vprintfmt+0xe8>
+  8003e8:	89 c1                	mov    %eax,%ecx
+  8003ea:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003ee:	83 c0 08             	add    $0x8,%eax
+  8003f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003f4:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003f7:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003fa:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003fe:	79 99                	jns    800399 <vprintfmt+0x75>
+                width = precision;
+  800400:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800404:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80040a:	eb 8d                	jmp    800399 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80040c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800410:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800414:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800418:	eb da                	jmp    8003f4 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80041a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80041f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800423:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800429:	3c 39                	cmp    $0x39,%al
+  80042b:	77 1c                	ja     800449 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80042d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800431:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800435:	0f b6 c0             	movzbl %al,%eax
+  800438:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80043d:	0f b6 03             	movzbl (%rbx),%eax
+  800440:	3c 39                	cmp    $0x39,%al
+  800442:	76 e9                	jbe    80042d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800444:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800447:	eb b1                	jmp    8003fa <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800449:	49 89 dc             	mov    %rbx,%r12
+  80044c:	eb ac                	jmp    8003fa <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80044e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800451:	85 c9                	test   %ecx,%ecx
+  800453:	b8 00 00 00 00       	mov    $0x0,%eax
+  800458:	0f 49 c1             	cmovns %ecx,%eax
+  80045b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80045e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800461:	e9 33 ff ff ff       	jmp    800399 <vprintfmt+0x75>
+            lflag++;
+  800466:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800469:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80046c:	e9 28 ff ff ff       	jmp    800399 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800471:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800474:	83 f8 2f             	cmp    $0x2f,%eax
+  800477:	77 19                	ja     800492 <vprintfmt+0x16e>
+  800479:	89 c2                	mov    %eax,%edx
+  80047b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80047f:	83 c0 08             	add    $0x8,%eax
+  800482:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800485:	8b 3a                	mov    (%rdx),%edi
+  800487:	4c 89 ee             	mov    %r13,%rsi
+  80048a:	41 ff d6             	call   *%r14
+            break;
+  80048d:	e9 c3 fe ff ff       	jmp    800355 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800492:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800496:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80049a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80049e:	eb e5                	jmp    800485 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8004a6:	77 5a                	ja     800502 <vprintfmt+0x1de>
+  8004a8:	89 c2                	mov    %eax,%edx
+  8004aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004ae:	83 c0 08             	add    $0x8,%eax
+  8004b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004b4:	8b 02                	mov    (%rdx),%eax
+  8004b6:	89 c1                	mov    %eax,%ecx
+  8004b8:	f7 d9                	neg    %ecx
+  8004ba:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004bd:	83 f9 15             	cmp    $0x15,%ecx
+  8004c0:	7f 4e                	jg     800510 <vprintfmt+0x1ec>
+  8004c2:	48 63 c1             	movslq %ecx,%rax
+  8004c5:	48 ba c0 2f 80 00 00 	movabs $0x802fc0,%rdx
+  8004cc:	00 00 00 
+  8004cf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004d3:	48 85 c0             	test   %rax,%rax
+  8004d6:	74 38                	je     800510 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004d8:	48 89 c1             	mov    %rax,%rcx
+  8004db:	48 ba 79 31 80 00 00 	movabs $0x803179,%rdx
+  8004e2:	00 00 00 
+  8004e5:	4c 89 ee             	mov    %r13,%rsi
+  8004e8:	4c 89 f7             	mov    %r14,%rdi
+  8004eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f0:	49 b8 e7 02 80 00 00 	movabs $0x8002e7,%r8
+  8004f7:	00 00 00 
+  8004fa:	41 ff d0             	call   *%r8
+  8004fd:	e9 53 fe ff ff       	jmp    800355 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800502:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800506:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80050a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80050e:	eb a4                	jmp    8004b4 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800510:	48 ba 7f 2b 80 00 00 	movabs $0x802b7f,%rdx
+  800517:	00 00 00 
+  80051a:	4c 89 ee             	mov    %r13,%rsi
+  80051d:	4c 89 f7             	mov    %r14,%rdi
+  800520:	b8 00 00 00 00       	mov    $0x0,%eax
+  800525:	49 b8 e7 02 80 00 00 	movabs $0x8002e7,%r8
+  80052c:	00 00 00 
+  80052f:	41 ff d0             	call   *%r8
+  800532:	e9 1e fe ff ff       	jmp    800355 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800537:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80053a:	83 f8 2f             	cmp    $0x2f,%eax
+  80053d:	77 6c                	ja     8005ab <vprintfmt+0x287>
+  80053f:	89 c2                	mov    %eax,%edx
+  800541:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800545:	83 c0 08             	add    $0x8,%eax
+  800548:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80054b:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80054e:	48 85 d2             	test   %rdx,%rdx
+  800551:	48 b8 78 2b 80 00 00 	movabs $0x802b78,%rax
+  800558:	00 00 00 
+  80055b:	48 0f 45 c2          	cmovne %rdx,%rax
+  80055f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800563:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800567:	7e 06                	jle    80056f <vprintfmt+0x24b>
+  800569:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80056d:	75 4a                	jne    8005b9 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80056f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800573:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800577:	0f b6 00             	movzbl (%rax),%eax
+  80057a:	84 c0                	test   %al,%al
+  80057c:	0f 85 9a 00 00 00    	jne    80061c <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800582:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800585:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800589:	85 c0                	test   %eax,%eax
+  80058b:	0f 8e c4 fd ff ff    	jle    800355 <vprintfmt+0x31>
+  800591:	4c 89 ee             	mov    %r13,%rsi
+  800594:	bf 20 00 00 00       	mov    $0x20,%edi
+  800599:	41 ff d6             	call   *%r14
+  80059c:	41 83 ec 01          	sub    $0x1,%r12d
+  8005a0:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005a4:	75 eb                	jne    800591 <vprintfmt+0x26d>
+  8005a6:	e9 aa fd ff ff       	jmp    800355 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b7:	eb 92                	jmp    80054b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005b9:	49 63 f7             	movslq %r15d,%rsi
+  8005bc:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005c0:	48 b8 d6 0a 80 00 00 	movabs $0x800ad6,%rax
+  8005c7:	00 00 00 
+  8005ca:	ff d0                	call   *%rax
+  8005cc:	48 89 c2             	mov    %rax,%rdx
+  8005cf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005d2:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005d4:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005d7:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005da:	85 c0                	test   %eax,%eax
+  8005dc:	7e 91                	jle    80056f <vprintfmt+0x24b>
+  8005de:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005e3:	4c 89 ee             	mov    %r13,%rsi
+  8005e6:	44 89 e7             	mov    %r12d,%edi
+  8005e9:	41 ff d6             	call   *%r14
+  8005ec:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005f0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005f3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005f6:	75 eb                	jne    8005e3 <vprintfmt+0x2bf>
+  8005f8:	e9 72 ff ff ff       	jmp    80056f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005fd:	0f b6 f8             	movzbl %al,%edi
+  800600:	4c 89 ee             	mov    %r13,%rsi
+  800603:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800606:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80060a:	49 83 c4 01          	add    $0x1,%r12
+  80060e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800614:	84 c0                	test   %al,%al
+  800616:	0f 84 66 ff ff ff    	je     800582 <vprintfmt+0x25e>
+  80061c:	45 85 ff             	test   %r15d,%r15d
+  80061f:	78 0a                	js     80062b <vprintfmt+0x307>
+  800621:	41 83 ef 01          	sub    $0x1,%r15d
+  800625:	0f 88 57 ff ff ff    	js     800582 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80062b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80062f:	74 cc                	je     8005fd <vprintfmt+0x2d9>
+  800631:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800634:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800639:	80 fa 5e             	cmp    $0x5e,%dl
+  80063c:	77 c2                	ja     800600 <vprintfmt+0x2dc>
+  80063e:	eb bd                	jmp    8005fd <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800640:	40 84 f6             	test   %sil,%sil
+  800643:	75 26                	jne    80066b <vprintfmt+0x347>
+    switch (lflag) {
+  800645:	85 d2                	test   %edx,%edx
+  800647:	74 59                	je     8006a2 <vprintfmt+0x37e>
+  800649:	83 fa 01             	cmp    $0x1,%edx
+  80064c:	74 7b                	je     8006c9 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80064e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800651:	83 f8 2f             	cmp    $0x2f,%eax
+  800654:	0f 87 96 00 00 00    	ja     8006f0 <vprintfmt+0x3cc>
+  80065a:	89 c2                	mov    %eax,%edx
+  80065c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800660:	83 c0 08             	add    $0x8,%eax
+  800663:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800666:	4c 8b 22             	mov    (%rdx),%r12
+  800669:	eb 17                	jmp    800682 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80066b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80066e:	83 f8 2f             	cmp    $0x2f,%eax
+  800671:	77 21                	ja     800694 <vprintfmt+0x370>
+  800673:	89 c2                	mov    %eax,%edx
+  800675:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800679:	83 c0 08             	add    $0x8,%eax
+  80067c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80067f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800682:	4d 85 e4             	test   %r12,%r12
+  800685:	78 7a                	js     800701 <vprintfmt+0x3dd>
+            num = i;
+  800687:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80068a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80068f:	e9 50 02 00 00       	jmp    8008e4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800694:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800698:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80069c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a0:	eb dd                	jmp    80067f <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a8:	77 11                	ja     8006bb <vprintfmt+0x397>
+  8006aa:	89 c2                	mov    %eax,%edx
+  8006ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b0:	83 c0 08             	add    $0x8,%eax
+  8006b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b6:	4c 63 22             	movslq (%rdx),%r12
+  8006b9:	eb c7                	jmp    800682 <vprintfmt+0x35e>
+  8006bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c7:	eb ed                	jmp    8006b6 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8006cf:	77 11                	ja     8006e2 <vprintfmt+0x3be>
+  8006d1:	89 c2                	mov    %eax,%edx
+  8006d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d7:	83 c0 08             	add    $0x8,%eax
+  8006da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006dd:	4c 8b 22             	mov    (%rdx),%r12
+  8006e0:	eb a0                	jmp    800682 <vprintfmt+0x35e>
+  8006e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ee:	eb ed                	jmp    8006dd <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006fc:	e9 65 ff ff ff       	jmp    800666 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800701:	4c 89 ee             	mov    %r13,%rsi
+  800704:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800709:	41 ff d6             	call   *%r14
+                i = -i;
+  80070c:	49 f7 dc             	neg    %r12
+  80070f:	e9 73 ff ff ff       	jmp    800687 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800714:	40 84 f6             	test   %sil,%sil
+  800717:	75 32                	jne    80074b <vprintfmt+0x427>
+    switch (lflag) {
+  800719:	85 d2                	test   %edx,%edx
+  80071b:	74 5d                	je     80077a <vprintfmt+0x456>
+  80071d:	83 fa 01             	cmp    $0x1,%edx
+  800720:	0f 84 82 00 00 00    	je     8007a8 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800726:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800729:	83 f8 2f             	cmp    $0x2f,%eax
+  80072c:	0f 87 a5 00 00 00    	ja     8007d7 <vprintfmt+0x4b3>
+  800732:	89 c2                	mov    %eax,%edx
+  800734:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800738:	83 c0 08             	add    $0x8,%eax
+  80073b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80073e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800741:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800746:	e9 99 01 00 00       	jmp    8008e4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80074b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80074e:	83 f8 2f             	cmp    $0x2f,%eax
+  800751:	77 19                	ja     80076c <vprintfmt+0x448>
+  800753:	89 c2                	mov    %eax,%edx
+  800755:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800759:	83 c0 08             	add    $0x8,%eax
+  80075c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80075f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800762:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800767:	e9 78 01 00 00       	jmp    8008e4 <vprintfmt+0x5c0>
+  80076c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800770:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800774:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800778:	eb e5                	jmp    80075f <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80077a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80077d:	83 f8 2f             	cmp    $0x2f,%eax
+  800780:	77 18                	ja     80079a <vprintfmt+0x476>
+  800782:	89 c2                	mov    %eax,%edx
+  800784:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800788:	83 c0 08             	add    $0x8,%eax
+  80078b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80078e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800790:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800795:	e9 4a 01 00 00       	jmp    8008e4 <vprintfmt+0x5c0>
+  80079a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80079e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a6:	eb e6                	jmp    80078e <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ae:	77 19                	ja     8007c9 <vprintfmt+0x4a5>
+  8007b0:	89 c2                	mov    %eax,%edx
+  8007b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b6:	83 c0 08             	add    $0x8,%eax
+  8007b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007bc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007bf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007c4:	e9 1b 01 00 00       	jmp    8008e4 <vprintfmt+0x5c0>
+  8007c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d5:	eb e5                	jmp    8007bc <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e3:	e9 56 ff ff ff       	jmp    80073e <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e8:	40 84 f6             	test   %sil,%sil
+  8007eb:	75 2e                	jne    80081b <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007ed:	85 d2                	test   %edx,%edx
+  8007ef:	74 59                	je     80084a <vprintfmt+0x526>
+  8007f1:	83 fa 01             	cmp    $0x1,%edx
+  8007f4:	74 7f                	je     800875 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fc:	0f 87 9f 00 00 00    	ja     8008a1 <vprintfmt+0x57d>
+  800802:	89 c2                	mov    %eax,%edx
+  800804:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800808:	83 c0 08             	add    $0x8,%eax
+  80080b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800811:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800816:	e9 c9 00 00 00       	jmp    8008e4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80081b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081e:	83 f8 2f             	cmp    $0x2f,%eax
+  800821:	77 19                	ja     80083c <vprintfmt+0x518>
+  800823:	89 c2                	mov    %eax,%edx
+  800825:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800829:	83 c0 08             	add    $0x8,%eax
+  80082c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800832:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800837:	e9 a8 00 00 00       	jmp    8008e4 <vprintfmt+0x5c0>
+  80083c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800840:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800844:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800848:	eb e5                	jmp    80082f <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80084a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084d:	83 f8 2f             	cmp    $0x2f,%eax
+  800850:	77 15                	ja     800867 <vprintfmt+0x543>
+  800852:	89 c2                	mov    %eax,%edx
+  800854:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800858:	83 c0 08             	add    $0x8,%eax
+  80085b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085e:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800860:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800865:	eb 7d                	jmp    8008e4 <vprintfmt+0x5c0>
+  800867:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800873:	eb e9                	jmp    80085e <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800875:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800878:	83 f8 2f             	cmp    $0x2f,%eax
+  80087b:	77 16                	ja     800893 <vprintfmt+0x56f>
+  80087d:	89 c2                	mov    %eax,%edx
+  80087f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800883:	83 c0 08             	add    $0x8,%eax
+  800886:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800889:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80088c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800891:	eb 51                	jmp    8008e4 <vprintfmt+0x5c0>
+  800893:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800897:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089f:	eb e8                	jmp    800889 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ad:	e9 5c ff ff ff       	jmp    80080e <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008b2:	4c 89 ee             	mov    %r13,%rsi
+  8008b5:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008ba:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008bd:	4c 89 ee             	mov    %r13,%rsi
+  8008c0:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008c5:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ce:	77 47                	ja     800917 <vprintfmt+0x5f3>
+  8008d0:	89 c2                	mov    %eax,%edx
+  8008d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d6:	83 c0 08             	add    $0x8,%eax
+  8008d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008dc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008df:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8008e8:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008ec:	0f 94 c0             	sete   %al
+  8008ef:	0f b6 c0             	movzbl %al,%eax
+  8008f2:	50                   	push   %rax
+  8008f3:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008f8:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008fc:	4c 89 ee             	mov    %r13,%rsi
+  8008ff:	4c 89 f7             	mov    %r14,%rdi
+  800902:	48 b8 19 02 80 00 00 	movabs $0x800219,%rax
+  800909:	00 00 00 
+  80090c:	ff d0                	call   *%rax
+            break;
+  80090e:	48 83 c4 10          	add    $0x10,%rsp
+  800912:	e9 3e fa ff ff       	jmp    800355 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800917:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800923:	eb b7                	jmp    8008dc <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800925:	40 84 f6             	test   %sil,%sil
+  800928:	75 2b                	jne    800955 <vprintfmt+0x631>
+    switch (lflag) {
+  80092a:	85 d2                	test   %edx,%edx
+  80092c:	74 56                	je     800984 <vprintfmt+0x660>
+  80092e:	83 fa 01             	cmp    $0x1,%edx
+  800931:	74 7f                	je     8009b2 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800933:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800936:	83 f8 2f             	cmp    $0x2f,%eax
+  800939:	0f 87 a2 00 00 00    	ja     8009e1 <vprintfmt+0x6bd>
+  80093f:	89 c2                	mov    %eax,%edx
+  800941:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800945:	83 c0 08             	add    $0x8,%eax
+  800948:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80094e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800953:	eb 8f                	jmp    8008e4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800955:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800958:	83 f8 2f             	cmp    $0x2f,%eax
+  80095b:	77 19                	ja     800976 <vprintfmt+0x652>
+  80095d:	89 c2                	mov    %eax,%edx
+  80095f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800963:	83 c0 08             	add    $0x8,%eax
+  800966:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800969:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80096c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800971:	e9 6e ff ff ff       	jmp    8008e4 <vprintfmt+0x5c0>
+  800976:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800982:	eb e5                	jmp    800969 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800984:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800987:	83 f8 2f             	cmp    $0x2f,%eax
+  80098a:	77 18                	ja     8009a4 <vprintfmt+0x680>
+  80098c:	89 c2                	mov    %eax,%edx
+  80098e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800992:	83 c0 08             	add    $0x8,%eax
+  800995:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800998:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80099a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80099f:	e9 40 ff ff ff       	jmp    8008e4 <vprintfmt+0x5c0>
+  8009a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b0:	eb e6                	jmp    800998 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009b2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b8:	77 19                	ja     8009d3 <vprintfmt+0x6af>
+  8009ba:	89 c2                	mov    %eax,%edx
+  8009bc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c0:	83 c0 08             	add    $0x8,%eax
+  8009c3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009c9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009ce:	e9 11 ff ff ff       	jmp    8008e4 <vprintfmt+0x5c0>
+  8009d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009df:	eb e5                	jmp    8009c6 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ed:	e9 59 ff ff ff       	jmp    80094b <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009f2:	4c 89 ee             	mov    %r13,%rsi
+  8009f5:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009fa:	41 ff d6             	call   *%r14
+            break;
+  8009fd:	e9 53 f9 ff ff       	jmp    800355 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a02:	4c 89 ee             	mov    %r13,%rsi
+  800a05:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a0a:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a0d:	48 83 eb 01          	sub    $0x1,%rbx
+  800a11:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a15:	75 f6                	jne    800a0d <vprintfmt+0x6e9>
+  800a17:	e9 39 f9 ff ff       	jmp    800355 <vprintfmt+0x31>
+}
+  800a1c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a20:	5b                   	pop    %rbx
+  800a21:	41 5c                	pop    %r12
+  800a23:	41 5d                	pop    %r13
+  800a25:	41 5e                	pop    %r14
+  800a27:	41 5f                	pop    %r15
+  800a29:	5d                   	pop    %rbp
+  800a2a:	c3                   	ret
+
+0000000000800a2b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a2b:	55                   	push   %rbp
+  800a2c:	48 89 e5             	mov    %rsp,%rbp
+  800a2f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a33:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a37:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a3c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a40:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a47:	48 85 ff             	test   %rdi,%rdi
+  800a4a:	74 2b                	je     800a77 <vsnprintf+0x4c>
+  800a4c:	48 85 f6             	test   %rsi,%rsi
+  800a4f:	74 26                	je     800a77 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a51:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a55:	48 bf cf 02 80 00 00 	movabs $0x8002cf,%rdi
+  800a5c:	00 00 00 
+  800a5f:	48 b8 24 03 80 00 00 	movabs $0x800324,%rax
+  800a66:	00 00 00 
+  800a69:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a6f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a72:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a75:	c9                   	leave
+  800a76:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a7c:	eb f7                	jmp    800a75 <vsnprintf+0x4a>
+
+0000000000800a7e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a7e:	55                   	push   %rbp
+  800a7f:	48 89 e5             	mov    %rsp,%rbp
+  800a82:	48 83 ec 50          	sub    $0x50,%rsp
+  800a86:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a8a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a8e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a92:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a99:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aa5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800aa9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800aad:	48 b8 2b 0a 80 00 00 	movabs $0x800a2b,%rax
+  800ab4:	00 00 00 
+  800ab7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ab9:	c9                   	leave
+  800aba:	c3                   	ret
+
+0000000000800abb <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800abb:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800abe:	74 10                	je     800ad0 <strlen+0x15>
+    size_t n = 0;
+  800ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ac5:	48 83 c0 01          	add    $0x1,%rax
+  800ac9:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800acd:	75 f6                	jne    800ac5 <strlen+0xa>
+  800acf:	c3                   	ret
+    size_t n = 0;
+  800ad0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ad5:	c3                   	ret
+
+0000000000800ad6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ad6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ad9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ade:	48 85 f6             	test   %rsi,%rsi
+  800ae1:	74 11                	je     800af4 <strnlen+0x1e>
+  800ae3:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ae7:	74 0c                	je     800af5 <strnlen+0x1f>
+  800ae9:	48 83 c2 01          	add    $0x1,%rdx
+  800aed:	48 39 d0             	cmp    %rdx,%rax
+  800af0:	75 f1                	jne    800ae3 <strnlen+0xd>
+  800af2:	eb 04                	jmp    800af8 <strnlen+0x22>
+  800af4:	c3                   	ret
+  800af5:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800af8:	c3                   	ret
+
+0000000000800af9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800af9:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800afc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b01:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b05:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b08:	48 83 c2 01          	add    $0x1,%rdx
+  800b0c:	84 c9                	test   %cl,%cl
+  800b0e:	75 f1                	jne    800b01 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b10:	c3                   	ret
+
+0000000000800b11 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b11:	55                   	push   %rbp
+  800b12:	48 89 e5             	mov    %rsp,%rbp
+  800b15:	41 54                	push   %r12
+  800b17:	53                   	push   %rbx
+  800b18:	48 89 fb             	mov    %rdi,%rbx
+  800b1b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b1e:	48 b8 bb 0a 80 00 00 	movabs $0x800abb,%rax
+  800b25:	00 00 00 
+  800b28:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b2a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b2e:	4c 89 e6             	mov    %r12,%rsi
+  800b31:	48 b8 f9 0a 80 00 00 	movabs $0x800af9,%rax
+  800b38:	00 00 00 
+  800b3b:	ff d0                	call   *%rax
+    return dst;
+}
+  800b3d:	48 89 d8             	mov    %rbx,%rax
+  800b40:	5b                   	pop    %rbx
+  800b41:	41 5c                	pop    %r12
+  800b43:	5d                   	pop    %rbp
+  800b44:	c3                   	ret
+
+0000000000800b45 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b45:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b48:	48 85 d2             	test   %rdx,%rdx
+  800b4b:	74 1f                	je     800b6c <strncpy+0x27>
+  800b4d:	48 01 fa             	add    %rdi,%rdx
+  800b50:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b53:	48 83 c1 01          	add    $0x1,%rcx
+  800b57:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b5b:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b5f:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b63:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b67:	48 39 ca             	cmp    %rcx,%rdx
+  800b6a:	75 e7                	jne    800b53 <strncpy+0xe>
+    }
+    return ret;
+}
+  800b6c:	c3                   	ret
+
+0000000000800b6d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b6d:	48 89 f8             	mov    %rdi,%rax
+  800b70:	48 85 d2             	test   %rdx,%rdx
+  800b73:	74 24                	je     800b99 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b75:	48 83 ea 01          	sub    $0x1,%rdx
+  800b79:	74 1b                	je     800b96 <strlcpy+0x29>
+  800b7b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b7f:	0f b6 16             	movzbl (%rsi),%edx
+  800b82:	84 d2                	test   %dl,%dl
+  800b84:	74 10                	je     800b96 <strlcpy+0x29>
+            *dst++ = *src++;
+  800b86:	48 83 c6 01          	add    $0x1,%rsi
+  800b8a:	48 83 c0 01          	add    $0x1,%rax
+  800b8e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b91:	48 39 c8             	cmp    %rcx,%rax
+  800b94:	75 e9                	jne    800b7f <strlcpy+0x12>
+        *dst = '\0';
+  800b96:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800b99:	48 29 f8             	sub    %rdi,%rax
+}
+  800b9c:	c3                   	ret
+
+0000000000800b9d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800b9d:	0f b6 07             	movzbl (%rdi),%eax
+  800ba0:	84 c0                	test   %al,%al
+  800ba2:	74 13                	je     800bb7 <strcmp+0x1a>
+  800ba4:	38 06                	cmp    %al,(%rsi)
+  800ba6:	75 0f                	jne    800bb7 <strcmp+0x1a>
+  800ba8:	48 83 c7 01          	add    $0x1,%rdi
+  800bac:	48 83 c6 01          	add    $0x1,%rsi
+  800bb0:	0f b6 07             	movzbl (%rdi),%eax
+  800bb3:	84 c0                	test   %al,%al
+  800bb5:	75 ed                	jne    800ba4 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bb7:	0f b6 c0             	movzbl %al,%eax
+  800bba:	0f b6 16             	movzbl (%rsi),%edx
+  800bbd:	29 d0                	sub    %edx,%eax
+}
+  800bbf:	c3                   	ret
+
+0000000000800bc0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bc0:	48 85 d2             	test   %rdx,%rdx
+  800bc3:	74 1f                	je     800be4 <strncmp+0x24>
+  800bc5:	0f b6 07             	movzbl (%rdi),%eax
+  800bc8:	84 c0                	test   %al,%al
+  800bca:	74 1e                	je     800bea <strncmp+0x2a>
+  800bcc:	3a 06                	cmp    (%rsi),%al
+  800bce:	75 1a                	jne    800bea <strncmp+0x2a>
+  800bd0:	48 83 c7 01          	add    $0x1,%rdi
+  800bd4:	48 83 c6 01          	add    $0x1,%rsi
+  800bd8:	48 83 ea 01          	sub    $0x1,%rdx
+  800bdc:	75 e7                	jne    800bc5 <strncmp+0x5>
+
+    if (!n) return 0;
+  800bde:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be3:	c3                   	ret
+  800be4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be9:	c3                   	ret
+  800bea:	48 85 d2             	test   %rdx,%rdx
+  800bed:	74 09                	je     800bf8 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bef:	0f b6 07             	movzbl (%rdi),%eax
+  800bf2:	0f b6 16             	movzbl (%rsi),%edx
+  800bf5:	29 d0                	sub    %edx,%eax
+  800bf7:	c3                   	ret
+    if (!n) return 0;
+  800bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bfd:	c3                   	ret
+
+0000000000800bfe <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800bfe:	0f b6 17             	movzbl (%rdi),%edx
+  800c01:	84 d2                	test   %dl,%dl
+  800c03:	74 18                	je     800c1d <strchr+0x1f>
+        if (*str == c) {
+  800c05:	0f be d2             	movsbl %dl,%edx
+  800c08:	39 f2                	cmp    %esi,%edx
+  800c0a:	74 17                	je     800c23 <strchr+0x25>
+    for (; *str; str++) {
+  800c0c:	48 83 c7 01          	add    $0x1,%rdi
+  800c10:	0f b6 17             	movzbl (%rdi),%edx
+  800c13:	84 d2                	test   %dl,%dl
+  800c15:	75 ee                	jne    800c05 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1c:	c3                   	ret
+  800c1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c22:	c3                   	ret
+  800c23:	48 89 f8             	mov    %rdi,%rax
+}
+  800c26:	c3                   	ret
+
+0000000000800c27 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c27:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c2a:	0f b6 17             	movzbl (%rdi),%edx
+  800c2d:	84 d2                	test   %dl,%dl
+  800c2f:	74 13                	je     800c44 <strfind+0x1d>
+  800c31:	0f be d2             	movsbl %dl,%edx
+  800c34:	39 f2                	cmp    %esi,%edx
+  800c36:	74 0b                	je     800c43 <strfind+0x1c>
+  800c38:	48 83 c0 01          	add    $0x1,%rax
+  800c3c:	0f b6 10             	movzbl (%rax),%edx
+  800c3f:	84 d2                	test   %dl,%dl
+  800c41:	75 ee                	jne    800c31 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c43:	c3                   	ret
+  800c44:	c3                   	ret
+
+0000000000800c45 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c45:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c48:	48 89 f8             	mov    %rdi,%rax
+  800c4b:	48 f7 d8             	neg    %rax
+  800c4e:	83 e0 07             	and    $0x7,%eax
+  800c51:	49 89 d1             	mov    %rdx,%r9
+  800c54:	49 29 c1             	sub    %rax,%r9
+  800c57:	78 36                	js     800c8f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c59:	40 0f b6 c6          	movzbl %sil,%eax
+  800c5d:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c64:	01 01 01 
+  800c67:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c6b:	40 f6 c7 07          	test   $0x7,%dil
+  800c6f:	75 38                	jne    800ca9 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c71:	4c 89 c9             	mov    %r9,%rcx
+  800c74:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c78:	74 0c                	je     800c86 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c7a:	fc                   	cld
+  800c7b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c7e:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c82:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c86:	4d 85 c9             	test   %r9,%r9
+  800c89:	75 45                	jne    800cd0 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c8b:	4c 89 c0             	mov    %r8,%rax
+  800c8e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c8f:	48 85 d2             	test   %rdx,%rdx
+  800c92:	74 f7                	je     800c8b <memset+0x46>
+  800c94:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c97:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800c9a:	48 83 c0 01          	add    $0x1,%rax
+  800c9e:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ca2:	48 39 c2             	cmp    %rax,%rdx
+  800ca5:	75 f3                	jne    800c9a <memset+0x55>
+  800ca7:	eb e2                	jmp    800c8b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ca9:	40 f6 c7 01          	test   $0x1,%dil
+  800cad:	74 06                	je     800cb5 <memset+0x70>
+  800caf:	88 07                	mov    %al,(%rdi)
+  800cb1:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cb5:	40 f6 c7 02          	test   $0x2,%dil
+  800cb9:	74 07                	je     800cc2 <memset+0x7d>
+  800cbb:	66 89 07             	mov    %ax,(%rdi)
+  800cbe:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cc2:	40 f6 c7 04          	test   $0x4,%dil
+  800cc6:	74 a9                	je     800c71 <memset+0x2c>
+  800cc8:	89 07                	mov    %eax,(%rdi)
+  800cca:	48 83 c7 04          	add    $0x4,%rdi
+  800cce:	eb a1                	jmp    800c71 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cd0:	41 f6 c1 04          	test   $0x4,%r9b
+  800cd4:	74 06                	je     800cdc <memset+0x97>
+  800cd6:	89 07                	mov    %eax,(%rdi)
+  800cd8:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cdc:	41 f6 c1 02          	test   $0x2,%r9b
+  800ce0:	74 07                	je     800ce9 <memset+0xa4>
+  800ce2:	66 89 07             	mov    %ax,(%rdi)
+  800ce5:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ce9:	41 f6 c1 01          	test   $0x1,%r9b
+  800ced:	74 9c                	je     800c8b <memset+0x46>
+  800cef:	88 07                	mov    %al,(%rdi)
+  800cf1:	eb 98                	jmp    800c8b <memset+0x46>
+
+0000000000800cf3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800cf3:	48 89 f8             	mov    %rdi,%rax
+  800cf6:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800cf9:	48 39 fe             	cmp    %rdi,%rsi
+  800cfc:	73 3b                	jae    800d39 <memmove+0x46>
+  800cfe:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d02:	48 39 d7             	cmp    %rdx,%rdi
+  800d05:	73 32                	jae    800d39 <memmove+0x46>
+        s += n;
+        d += n;
+  800d07:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d0b:	48 89 d6             	mov    %rdx,%rsi
+  800d0e:	48 09 fe             	or     %rdi,%rsi
+  800d11:	48 09 ce             	or     %rcx,%rsi
+  800d14:	40 f6 c6 07          	test   $0x7,%sil
+  800d18:	75 12                	jne    800d2c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d1a:	48 83 ef 08          	sub    $0x8,%rdi
+  800d1e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d22:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d26:	fd                   	std
+  800d27:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d2a:	fc                   	cld
+  800d2b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d2c:	48 83 ef 01          	sub    $0x1,%rdi
+  800d30:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d34:	fd                   	std
+  800d35:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d37:	eb f1                	jmp    800d2a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d39:	48 89 f2             	mov    %rsi,%rdx
+  800d3c:	48 09 c2             	or     %rax,%rdx
+  800d3f:	48 09 ca             	or     %rcx,%rdx
+  800d42:	f6 c2 07             	test   $0x7,%dl
+  800d45:	75 0c                	jne    800d53 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d47:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d4b:	48 89 c7             	mov    %rax,%rdi
+  800d4e:	fc                   	cld
+  800d4f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d52:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d53:	48 89 c7             	mov    %rax,%rdi
+  800d56:	fc                   	cld
+  800d57:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d59:	c3                   	ret
+
+0000000000800d5a <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d5a:	55                   	push   %rbp
+  800d5b:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d5e:	48 b8 f3 0c 80 00 00 	movabs $0x800cf3,%rax
+  800d65:	00 00 00 
+  800d68:	ff d0                	call   *%rax
+}
+  800d6a:	5d                   	pop    %rbp
+  800d6b:	c3                   	ret
+
+0000000000800d6c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d6c:	55                   	push   %rbp
+  800d6d:	48 89 e5             	mov    %rsp,%rbp
+  800d70:	41 57                	push   %r15
+  800d72:	41 56                	push   %r14
+  800d74:	41 55                	push   %r13
+  800d76:	41 54                	push   %r12
+  800d78:	53                   	push   %rbx
+  800d79:	48 83 ec 08          	sub    $0x8,%rsp
+  800d7d:	49 89 fe             	mov    %rdi,%r14
+  800d80:	49 89 f7             	mov    %rsi,%r15
+  800d83:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d86:	48 89 f7             	mov    %rsi,%rdi
+  800d89:	48 b8 bb 0a 80 00 00 	movabs $0x800abb,%rax
+  800d90:	00 00 00 
+  800d93:	ff d0                	call   *%rax
+  800d95:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d98:	48 89 de             	mov    %rbx,%rsi
+  800d9b:	4c 89 f7             	mov    %r14,%rdi
+  800d9e:	48 b8 d6 0a 80 00 00 	movabs $0x800ad6,%rax
+  800da5:	00 00 00 
+  800da8:	ff d0                	call   *%rax
+  800daa:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800dad:	48 39 c3             	cmp    %rax,%rbx
+  800db0:	74 36                	je     800de8 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800db2:	48 89 d8             	mov    %rbx,%rax
+  800db5:	4c 29 e8             	sub    %r13,%rax
+  800db8:	49 39 c4             	cmp    %rax,%r12
+  800dbb:	73 31                	jae    800dee <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800dbd:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dc2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dc6:	4c 89 fe             	mov    %r15,%rsi
+  800dc9:	48 b8 5a 0d 80 00 00 	movabs $0x800d5a,%rax
+  800dd0:	00 00 00 
+  800dd3:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dd5:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800dd9:	48 83 c4 08          	add    $0x8,%rsp
+  800ddd:	5b                   	pop    %rbx
+  800dde:	41 5c                	pop    %r12
+  800de0:	41 5d                	pop    %r13
+  800de2:	41 5e                	pop    %r14
+  800de4:	41 5f                	pop    %r15
+  800de6:	5d                   	pop    %rbp
+  800de7:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800de8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800dec:	eb eb                	jmp    800dd9 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800dee:	48 83 eb 01          	sub    $0x1,%rbx
+  800df2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800df6:	48 89 da             	mov    %rbx,%rdx
+  800df9:	4c 89 fe             	mov    %r15,%rsi
+  800dfc:	48 b8 5a 0d 80 00 00 	movabs $0x800d5a,%rax
+  800e03:	00 00 00 
+  800e06:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e08:	49 01 de             	add    %rbx,%r14
+  800e0b:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e10:	eb c3                	jmp    800dd5 <strlcat+0x69>
+
+0000000000800e12 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e12:	48 85 d2             	test   %rdx,%rdx
+  800e15:	74 2d                	je     800e44 <memcmp+0x32>
+  800e17:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e1c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e20:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e25:	44 38 c1             	cmp    %r8b,%cl
+  800e28:	75 0f                	jne    800e39 <memcmp+0x27>
+    while (n-- > 0) {
+  800e2a:	48 83 c0 01          	add    $0x1,%rax
+  800e2e:	48 39 c2             	cmp    %rax,%rdx
+  800e31:	75 e9                	jne    800e1c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e38:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e39:	0f b6 c1             	movzbl %cl,%eax
+  800e3c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e40:	44 29 c0             	sub    %r8d,%eax
+  800e43:	c3                   	ret
+    return 0;
+  800e44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e49:	c3                   	ret
+
+0000000000800e4a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e4a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e4e:	48 39 c7             	cmp    %rax,%rdi
+  800e51:	73 0f                	jae    800e62 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e53:	40 38 37             	cmp    %sil,(%rdi)
+  800e56:	74 0e                	je     800e66 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e58:	48 83 c7 01          	add    $0x1,%rdi
+  800e5c:	48 39 f8             	cmp    %rdi,%rax
+  800e5f:	75 f2                	jne    800e53 <memfind+0x9>
+  800e61:	c3                   	ret
+  800e62:	48 89 f8             	mov    %rdi,%rax
+  800e65:	c3                   	ret
+  800e66:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e69:	c3                   	ret
+
+0000000000800e6a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e6a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e6d:	0f b6 37             	movzbl (%rdi),%esi
+  800e70:	40 80 fe 20          	cmp    $0x20,%sil
+  800e74:	74 06                	je     800e7c <strtol+0x12>
+  800e76:	40 80 fe 09          	cmp    $0x9,%sil
+  800e7a:	75 13                	jne    800e8f <strtol+0x25>
+  800e7c:	48 83 c7 01          	add    $0x1,%rdi
+  800e80:	0f b6 37             	movzbl (%rdi),%esi
+  800e83:	40 80 fe 20          	cmp    $0x20,%sil
+  800e87:	74 f3                	je     800e7c <strtol+0x12>
+  800e89:	40 80 fe 09          	cmp    $0x9,%sil
+  800e8d:	74 ed                	je     800e7c <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e8f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e92:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e95:	3c 01                	cmp    $0x1,%al
+  800e97:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800e9b:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ea1:	75 0f                	jne    800eb2 <strtol+0x48>
+  800ea3:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ea6:	74 14                	je     800ebc <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ea8:	85 d2                	test   %edx,%edx
+  800eaa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eaf:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800eb2:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800eb7:	4c 63 ca             	movslq %edx,%r9
+  800eba:	eb 36                	jmp    800ef2 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ebc:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ec0:	74 0f                	je     800ed1 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ec2:	85 d2                	test   %edx,%edx
+  800ec4:	75 ec                	jne    800eb2 <strtol+0x48>
+        s++;
+  800ec6:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800eca:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ecf:	eb e1                	jmp    800eb2 <strtol+0x48>
+        s += 2;
+  800ed1:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ed5:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800eda:	eb d6                	jmp    800eb2 <strtol+0x48>
+            dig -= '0';
+  800edc:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800edf:	44 0f b6 c1          	movzbl %cl,%r8d
+  800ee3:	41 39 d0             	cmp    %edx,%r8d
+  800ee6:	7d 21                	jge    800f09 <strtol+0x9f>
+        val = val * base + dig;
+  800ee8:	49 0f af c1          	imul   %r9,%rax
+  800eec:	0f b6 c9             	movzbl %cl,%ecx
+  800eef:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800ef2:	48 83 c7 01          	add    $0x1,%rdi
+  800ef6:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800efa:	80 f9 39             	cmp    $0x39,%cl
+  800efd:	76 dd                	jbe    800edc <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800eff:	80 f9 7b             	cmp    $0x7b,%cl
+  800f02:	77 05                	ja     800f09 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f04:	83 e9 57             	sub    $0x57,%ecx
+  800f07:	eb d6                	jmp    800edf <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f09:	4d 85 d2             	test   %r10,%r10
+  800f0c:	74 03                	je     800f11 <strtol+0xa7>
+  800f0e:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f11:	48 89 c2             	mov    %rax,%rdx
+  800f14:	48 f7 da             	neg    %rdx
+  800f17:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f1b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f1f:	c3                   	ret
+
+0000000000800f20 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f20:	55                   	push   %rbp
+  800f21:	48 89 e5             	mov    %rsp,%rbp
+  800f24:	53                   	push   %rbx
+  800f25:	48 89 fa             	mov    %rdi,%rdx
+  800f28:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f2b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f35:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f3a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f3f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f45:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f47:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f4b:	c9                   	leave
+  800f4c:	c3                   	ret
+
+0000000000800f4d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f4d:	55                   	push   %rbp
+  800f4e:	48 89 e5             	mov    %rsp,%rbp
+  800f51:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f52:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f57:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f61:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f66:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f6b:	be 00 00 00 00       	mov    $0x0,%esi
+  800f70:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f76:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f7c:	c9                   	leave
+  800f7d:	c3                   	ret
+
+0000000000800f7e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800f7e:	55                   	push   %rbp
+  800f7f:	48 89 e5             	mov    %rsp,%rbp
+  800f82:	53                   	push   %rbx
+  800f83:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f87:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800f8a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f99:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f9e:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fa9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800fab:	48 85 c0             	test   %rax,%rax
+  800fae:	7f 06                	jg     800fb6 <sys_env_destroy+0x38>
+}
+  800fb0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fb4:	c9                   	leave
+  800fb5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fb6:	49 89 c0             	mov    %rax,%r8
+  800fb9:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fbe:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  800fc5:	00 00 00 
+  800fc8:	be 26 00 00 00       	mov    $0x26,%esi
+  800fcd:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  800fd4:	00 00 00 
+  800fd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdc:	49 b9 1e 29 80 00 00 	movabs $0x80291e,%r9
+  800fe3:	00 00 00 
+  800fe6:	41 ff d1             	call   *%r9
+
+0000000000800fe9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800fe9:	55                   	push   %rbp
+  800fea:	48 89 e5             	mov    %rsp,%rbp
+  800fed:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800fee:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800ff3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800ffd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801002:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801007:	be 00 00 00 00       	mov    $0x0,%esi
+  80100c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801012:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801014:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801018:	c9                   	leave
+  801019:	c3                   	ret
+
+000000000080101a <sys_yield>:
+
+void
+sys_yield(void) {
+  80101a:	55                   	push   %rbp
+  80101b:	48 89 e5             	mov    %rsp,%rbp
+  80101e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80101f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801024:	ba 00 00 00 00       	mov    $0x0,%edx
+  801029:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80102e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801033:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801038:	be 00 00 00 00       	mov    $0x0,%esi
+  80103d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801043:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801045:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801049:	c9                   	leave
+  80104a:	c3                   	ret
+
+000000000080104b <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80104b:	55                   	push   %rbp
+  80104c:	48 89 e5             	mov    %rsp,%rbp
+  80104f:	53                   	push   %rbx
+  801050:	48 89 fa             	mov    %rdi,%rdx
+  801053:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801056:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80105b:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801062:	00 00 00 
+  801065:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80106a:	be 00 00 00 00       	mov    $0x0,%esi
+  80106f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801075:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801077:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80107b:	c9                   	leave
+  80107c:	c3                   	ret
+
+000000000080107d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80107d:	55                   	push   %rbp
+  80107e:	48 89 e5             	mov    %rsp,%rbp
+  801081:	53                   	push   %rbx
+  801082:	49 89 f8             	mov    %rdi,%r8
+  801085:	48 89 d3             	mov    %rdx,%rbx
+  801088:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80108b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801090:	4c 89 c2             	mov    %r8,%rdx
+  801093:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801096:	be 00 00 00 00       	mov    $0x0,%esi
+  80109b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010a1:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8010a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010a7:	c9                   	leave
+  8010a8:	c3                   	ret
+
+00000000008010a9 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8010a9:	55                   	push   %rbp
+  8010aa:	48 89 e5             	mov    %rsp,%rbp
+  8010ad:	53                   	push   %rbx
+  8010ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8010b2:	89 f8                	mov    %edi,%eax
+  8010b4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010b7:	48 63 f9             	movslq %ecx,%rdi
+  8010ba:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010bd:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010d0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010d2:	48 85 c0             	test   %rax,%rax
+  8010d5:	7f 06                	jg     8010dd <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8010d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010db:	c9                   	leave
+  8010dc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010dd:	49 89 c0             	mov    %rax,%r8
+  8010e0:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8010e5:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  8010ec:	00 00 00 
+  8010ef:	be 26 00 00 00       	mov    $0x26,%esi
+  8010f4:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  8010fb:	00 00 00 
+  8010fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801103:	49 b9 1e 29 80 00 00 	movabs $0x80291e,%r9
+  80110a:	00 00 00 
+  80110d:	41 ff d1             	call   *%r9
+
+0000000000801110 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801110:	55                   	push   %rbp
+  801111:	48 89 e5             	mov    %rsp,%rbp
+  801114:	53                   	push   %rbx
+  801115:	48 83 ec 08          	sub    $0x8,%rsp
+  801119:	89 f8                	mov    %edi,%eax
+  80111b:	49 89 f2             	mov    %rsi,%r10
+  80111e:	48 89 cf             	mov    %rcx,%rdi
+  801121:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801124:	48 63 da             	movslq %edx,%rbx
+  801127:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80112a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80112f:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801132:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801135:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801137:	48 85 c0             	test   %rax,%rax
+  80113a:	7f 06                	jg     801142 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80113c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801140:	c9                   	leave
+  801141:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801142:	49 89 c0             	mov    %rax,%r8
+  801145:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80114a:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  801151:	00 00 00 
+  801154:	be 26 00 00 00       	mov    $0x26,%esi
+  801159:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  801160:	00 00 00 
+  801163:	b8 00 00 00 00       	mov    $0x0,%eax
+  801168:	49 b9 1e 29 80 00 00 	movabs $0x80291e,%r9
+  80116f:	00 00 00 
+  801172:	41 ff d1             	call   *%r9
+
+0000000000801175 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801175:	55                   	push   %rbp
+  801176:	48 89 e5             	mov    %rsp,%rbp
+  801179:	53                   	push   %rbx
+  80117a:	48 83 ec 08          	sub    $0x8,%rsp
+  80117e:	48 89 f1             	mov    %rsi,%rcx
+  801181:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801184:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801187:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80118c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801191:	be 00 00 00 00       	mov    $0x0,%esi
+  801196:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80119c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80119e:	48 85 c0             	test   %rax,%rax
+  8011a1:	7f 06                	jg     8011a9 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8011a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a7:	c9                   	leave
+  8011a8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011a9:	49 89 c0             	mov    %rax,%r8
+  8011ac:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011b1:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  8011b8:	00 00 00 
+  8011bb:	be 26 00 00 00       	mov    $0x26,%esi
+  8011c0:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  8011c7:	00 00 00 
+  8011ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011cf:	49 b9 1e 29 80 00 00 	movabs $0x80291e,%r9
+  8011d6:	00 00 00 
+  8011d9:	41 ff d1             	call   *%r9
+
+00000000008011dc <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8011dc:	55                   	push   %rbp
+  8011dd:	48 89 e5             	mov    %rsp,%rbp
+  8011e0:	53                   	push   %rbx
+  8011e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8011e5:	89 f8                	mov    %edi,%eax
+  8011e7:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8011ea:	48 63 f9             	movslq %ecx,%rdi
+  8011ed:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011f5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801203:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801205:	48 85 c0             	test   %rax,%rax
+  801208:	7f 06                	jg     801210 <sys_region_advise+0x34>
+}
+  80120a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80120e:	c9                   	leave
+  80120f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801210:	49 89 c0             	mov    %rax,%r8
+  801213:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801218:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  80121f:	00 00 00 
+  801222:	be 26 00 00 00       	mov    $0x26,%esi
+  801227:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  80122e:	00 00 00 
+  801231:	b8 00 00 00 00       	mov    $0x0,%eax
+  801236:	49 b9 1e 29 80 00 00 	movabs $0x80291e,%r9
+  80123d:	00 00 00 
+  801240:	41 ff d1             	call   *%r9
+
+0000000000801243 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801243:	55                   	push   %rbp
+  801244:	48 89 e5             	mov    %rsp,%rbp
+  801247:	53                   	push   %rbx
+  801248:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80124c:	48 63 ce             	movslq %esi,%rcx
+  80124f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801252:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801257:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801261:	be 00 00 00 00       	mov    $0x0,%esi
+  801266:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80126c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80126e:	48 85 c0             	test   %rax,%rax
+  801271:	7f 06                	jg     801279 <sys_env_set_nice+0x36>
+}
+  801273:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801277:	c9                   	leave
+  801278:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801279:	49 89 c0             	mov    %rax,%r8
+  80127c:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801281:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  801288:	00 00 00 
+  80128b:	be 26 00 00 00       	mov    $0x26,%esi
+  801290:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  801297:	00 00 00 
+  80129a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129f:	49 b9 1e 29 80 00 00 	movabs $0x80291e,%r9
+  8012a6:	00 00 00 
+  8012a9:	41 ff d1             	call   *%r9
+
+00000000008012ac <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8012ac:	55                   	push   %rbp
+  8012ad:	48 89 e5             	mov    %rsp,%rbp
+  8012b0:	53                   	push   %rbx
+  8012b1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012b5:	48 63 ce             	movslq %esi,%rcx
+  8012b8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012bb:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8012cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012d7:	48 85 c0             	test   %rax,%rax
+  8012da:	7f 06                	jg     8012e2 <sys_env_set_status+0x36>
+}
+  8012dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e0:	c9                   	leave
+  8012e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012e2:	49 89 c0             	mov    %rax,%r8
+  8012e5:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012ea:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  8012f1:	00 00 00 
+  8012f4:	be 26 00 00 00       	mov    $0x26,%esi
+  8012f9:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  801300:	00 00 00 
+  801303:	b8 00 00 00 00       	mov    $0x0,%eax
+  801308:	49 b9 1e 29 80 00 00 	movabs $0x80291e,%r9
+  80130f:	00 00 00 
+  801312:	41 ff d1             	call   *%r9
+
+0000000000801315 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801315:	55                   	push   %rbp
+  801316:	48 89 e5             	mov    %rsp,%rbp
+  801319:	53                   	push   %rbx
+  80131a:	48 83 ec 08          	sub    $0x8,%rsp
+  80131e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801321:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801324:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801329:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801333:	be 00 00 00 00       	mov    $0x0,%esi
+  801338:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80133e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801340:	48 85 c0             	test   %rax,%rax
+  801343:	7f 06                	jg     80134b <sys_env_set_trapframe+0x36>
+}
+  801345:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801349:	c9                   	leave
+  80134a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80134b:	49 89 c0             	mov    %rax,%r8
+  80134e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801353:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  80135a:	00 00 00 
+  80135d:	be 26 00 00 00       	mov    $0x26,%esi
+  801362:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  801369:	00 00 00 
+  80136c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801371:	49 b9 1e 29 80 00 00 	movabs $0x80291e,%r9
+  801378:	00 00 00 
+  80137b:	41 ff d1             	call   *%r9
+
+000000000080137e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80137e:	55                   	push   %rbp
+  80137f:	48 89 e5             	mov    %rsp,%rbp
+  801382:	53                   	push   %rbx
+  801383:	48 83 ec 08          	sub    $0x8,%rsp
+  801387:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80138a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80138d:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801392:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801397:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80139c:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013a9:	48 85 c0             	test   %rax,%rax
+  8013ac:	7f 06                	jg     8013b4 <sys_env_set_pgfault_upcall+0x36>
+}
+  8013ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b2:	c9                   	leave
+  8013b3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013b4:	49 89 c0             	mov    %rax,%r8
+  8013b7:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013bc:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  8013c3:	00 00 00 
+  8013c6:	be 26 00 00 00       	mov    $0x26,%esi
+  8013cb:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  8013d2:	00 00 00 
+  8013d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013da:	49 b9 1e 29 80 00 00 	movabs $0x80291e,%r9
+  8013e1:	00 00 00 
+  8013e4:	41 ff d1             	call   *%r9
+
+00000000008013e7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013e7:	55                   	push   %rbp
+  8013e8:	48 89 e5             	mov    %rsp,%rbp
+  8013eb:	53                   	push   %rbx
+  8013ec:	89 f8                	mov    %edi,%eax
+  8013ee:	49 89 f1             	mov    %rsi,%r9
+  8013f1:	48 89 d3             	mov    %rdx,%rbx
+  8013f4:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8013f7:	49 63 f0             	movslq %r8d,%rsi
+  8013fa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013fd:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801402:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801405:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80140b:	cd 30                	int    $0x30
+}
+  80140d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801411:	c9                   	leave
+  801412:	c3                   	ret
+
+0000000000801413 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801413:	55                   	push   %rbp
+  801414:	48 89 e5             	mov    %rsp,%rbp
+  801417:	53                   	push   %rbx
+  801418:	48 83 ec 08          	sub    $0x8,%rsp
+  80141c:	48 89 fa             	mov    %rdi,%rdx
+  80141f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801422:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801427:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801431:	be 00 00 00 00       	mov    $0x0,%esi
+  801436:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80143c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80143e:	48 85 c0             	test   %rax,%rax
+  801441:	7f 06                	jg     801449 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801443:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801447:	c9                   	leave
+  801448:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801449:	49 89 c0             	mov    %rax,%r8
+  80144c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801451:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  801458:	00 00 00 
+  80145b:	be 26 00 00 00       	mov    $0x26,%esi
+  801460:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  801467:	00 00 00 
+  80146a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146f:	49 b9 1e 29 80 00 00 	movabs $0x80291e,%r9
+  801476:	00 00 00 
+  801479:	41 ff d1             	call   *%r9
+
+000000000080147c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80147c:	55                   	push   %rbp
+  80147d:	48 89 e5             	mov    %rsp,%rbp
+  801480:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801481:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801486:	ba 00 00 00 00       	mov    $0x0,%edx
+  80148b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801490:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801495:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149a:	be 00 00 00 00       	mov    $0x0,%esi
+  80149f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a5:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ab:	c9                   	leave
+  8014ac:	c3                   	ret
+
+00000000008014ad <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8014ad:	55                   	push   %rbp
+  8014ae:	48 89 e5             	mov    %rsp,%rbp
+  8014b1:	53                   	push   %rbx
+  8014b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8014b6:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8014b9:	48 63 ce             	movslq %esi,%rcx
+  8014bc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014bf:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d6:	48 85 c0             	test   %rax,%rax
+  8014d9:	7f 06                	jg     8014e1 <sys_sigqueue+0x34>
+}
+  8014db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014df:	c9                   	leave
+  8014e0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e1:	49 89 c0             	mov    %rax,%r8
+  8014e4:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8014e9:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  8014f0:	00 00 00 
+  8014f3:	be 26 00 00 00       	mov    $0x26,%esi
+  8014f8:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  8014ff:	00 00 00 
+  801502:	b8 00 00 00 00       	mov    $0x0,%eax
+  801507:	49 b9 1e 29 80 00 00 	movabs $0x80291e,%r9
+  80150e:	00 00 00 
+  801511:	41 ff d1             	call   *%r9
+
+0000000000801514 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801514:	55                   	push   %rbp
+  801515:	48 89 e5             	mov    %rsp,%rbp
+  801518:	53                   	push   %rbx
+  801519:	48 83 ec 08          	sub    $0x8,%rsp
+  80151d:	48 89 fa             	mov    %rdi,%rdx
+  801520:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801523:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801528:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80152d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801532:	be 00 00 00 00       	mov    $0x0,%esi
+  801537:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80153f:	48 85 c0             	test   %rax,%rax
+  801542:	7f 06                	jg     80154a <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801544:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801548:	c9                   	leave
+  801549:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80154a:	49 89 c0             	mov    %rax,%r8
+  80154d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801552:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  801559:	00 00 00 
+  80155c:	be 26 00 00 00       	mov    $0x26,%esi
+  801561:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  801568:	00 00 00 
+  80156b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801570:	49 b9 1e 29 80 00 00 	movabs $0x80291e,%r9
+  801577:	00 00 00 
+  80157a:	41 ff d1             	call   *%r9
+
+000000000080157d <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80157d:	55                   	push   %rbp
+  80157e:	48 89 e5             	mov    %rsp,%rbp
+  801581:	53                   	push   %rbx
+  801582:	48 83 ec 08          	sub    $0x8,%rsp
+  801586:	48 89 f1             	mov    %rsi,%rcx
+  801589:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80158c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80158f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801594:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801599:	be 00 00 00 00       	mov    $0x0,%esi
+  80159e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a6:	48 85 c0             	test   %rax,%rax
+  8015a9:	7f 06                	jg     8015b1 <sys_sigaction+0x34>
+}
+  8015ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015af:	c9                   	leave
+  8015b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b1:	49 89 c0             	mov    %rax,%r8
+  8015b4:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8015b9:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  8015c0:	00 00 00 
+  8015c3:	be 26 00 00 00       	mov    $0x26,%esi
+  8015c8:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  8015cf:	00 00 00 
+  8015d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d7:	49 b9 1e 29 80 00 00 	movabs $0x80291e,%r9
+  8015de:	00 00 00 
+  8015e1:	41 ff d1             	call   *%r9
+
+00000000008015e4 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8015e4:	55                   	push   %rbp
+  8015e5:	48 89 e5             	mov    %rsp,%rbp
+  8015e8:	53                   	push   %rbx
+  8015e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ed:	48 89 f1             	mov    %rsi,%rcx
+  8015f0:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8015f3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f6:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801600:	be 00 00 00 00       	mov    $0x0,%esi
+  801605:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80160d:	48 85 c0             	test   %rax,%rax
+  801610:	7f 06                	jg     801618 <sys_sigprocmask+0x34>
+}
+  801612:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801616:	c9                   	leave
+  801617:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801618:	49 89 c0             	mov    %rax,%r8
+  80161b:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801620:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  801627:	00 00 00 
+  80162a:	be 26 00 00 00       	mov    $0x26,%esi
+  80162f:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  801636:	00 00 00 
+  801639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163e:	49 b9 1e 29 80 00 00 	movabs $0x80291e,%r9
+  801645:	00 00 00 
+  801648:	41 ff d1             	call   *%r9
+
+000000000080164b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80164b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801652:	ff ff ff 
+  801655:	48 01 f8             	add    %rdi,%rax
+  801658:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80165c:	c3                   	ret
+
+000000000080165d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80165d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801664:	ff ff ff 
+  801667:	48 01 f8             	add    %rdi,%rax
+  80166a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80166e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801674:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801678:	c3                   	ret
+
+0000000000801679 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801679:	55                   	push   %rbp
+  80167a:	48 89 e5             	mov    %rsp,%rbp
+  80167d:	41 57                	push   %r15
+  80167f:	41 56                	push   %r14
+  801681:	41 55                	push   %r13
+  801683:	41 54                	push   %r12
+  801685:	53                   	push   %rbx
+  801686:	48 83 ec 08          	sub    $0x8,%rsp
+  80168a:	49 89 ff             	mov    %rdi,%r15
+  80168d:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801692:	49 bd f7 25 80 00 00 	movabs $0x8025f7,%r13
+  801699:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80169c:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8016a2:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8016a5:	48 89 df             	mov    %rbx,%rdi
+  8016a8:	41 ff d5             	call   *%r13
+  8016ab:	83 e0 04             	and    $0x4,%eax
+  8016ae:	74 17                	je     8016c7 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8016b0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8016b7:	4c 39 f3             	cmp    %r14,%rbx
+  8016ba:	75 e6                	jne    8016a2 <fd_alloc+0x29>
+  8016bc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8016c2:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8016c7:	4d 89 27             	mov    %r12,(%r15)
+}
+  8016ca:	48 83 c4 08          	add    $0x8,%rsp
+  8016ce:	5b                   	pop    %rbx
+  8016cf:	41 5c                	pop    %r12
+  8016d1:	41 5d                	pop    %r13
+  8016d3:	41 5e                	pop    %r14
+  8016d5:	41 5f                	pop    %r15
+  8016d7:	5d                   	pop    %rbp
+  8016d8:	c3                   	ret
+
+00000000008016d9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8016d9:	83 ff 1f             	cmp    $0x1f,%edi
+  8016dc:	77 39                	ja     801717 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8016de:	55                   	push   %rbp
+  8016df:	48 89 e5             	mov    %rsp,%rbp
+  8016e2:	41 54                	push   %r12
+  8016e4:	53                   	push   %rbx
+  8016e5:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8016e8:	48 63 df             	movslq %edi,%rbx
+  8016eb:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8016f2:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8016f6:	48 89 df             	mov    %rbx,%rdi
+  8016f9:	48 b8 f7 25 80 00 00 	movabs $0x8025f7,%rax
+  801700:	00 00 00 
+  801703:	ff d0                	call   *%rax
+  801705:	a8 04                	test   $0x4,%al
+  801707:	74 14                	je     80171d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801709:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80170d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801712:	5b                   	pop    %rbx
+  801713:	41 5c                	pop    %r12
+  801715:	5d                   	pop    %rbp
+  801716:	c3                   	ret
+        return -E_INVAL;
+  801717:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80171c:	c3                   	ret
+        return -E_INVAL;
+  80171d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801722:	eb ee                	jmp    801712 <fd_lookup+0x39>
+
+0000000000801724 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801724:	55                   	push   %rbp
+  801725:	48 89 e5             	mov    %rsp,%rbp
+  801728:	41 54                	push   %r12
+  80172a:	53                   	push   %rbx
+  80172b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80172e:	48 b8 40 31 80 00 00 	movabs $0x803140,%rax
+  801735:	00 00 00 
+  801738:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80173f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801742:	39 3b                	cmp    %edi,(%rbx)
+  801744:	74 47                	je     80178d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801746:	48 83 c0 08          	add    $0x8,%rax
+  80174a:	48 8b 18             	mov    (%rax),%rbx
+  80174d:	48 85 db             	test   %rbx,%rbx
+  801750:	75 f0                	jne    801742 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801752:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801759:	00 00 00 
+  80175c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801762:	89 fa                	mov    %edi,%edx
+  801764:	48 bf c0 30 80 00 00 	movabs $0x8030c0,%rdi
+  80176b:	00 00 00 
+  80176e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801773:	48 b9 d4 01 80 00 00 	movabs $0x8001d4,%rcx
+  80177a:	00 00 00 
+  80177d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80177f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801784:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801788:	5b                   	pop    %rbx
+  801789:	41 5c                	pop    %r12
+  80178b:	5d                   	pop    %rbp
+  80178c:	c3                   	ret
+            return 0;
+  80178d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801792:	eb f0                	jmp    801784 <dev_lookup+0x60>
+
+0000000000801794 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801794:	55                   	push   %rbp
+  801795:	48 89 e5             	mov    %rsp,%rbp
+  801798:	41 55                	push   %r13
+  80179a:	41 54                	push   %r12
+  80179c:	53                   	push   %rbx
+  80179d:	48 83 ec 18          	sub    $0x18,%rsp
+  8017a1:	48 89 fb             	mov    %rdi,%rbx
+  8017a4:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017a7:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8017ae:	ff ff ff 
+  8017b1:	48 01 df             	add    %rbx,%rdi
+  8017b4:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8017b8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8017bc:	48 b8 d9 16 80 00 00 	movabs $0x8016d9,%rax
+  8017c3:	00 00 00 
+  8017c6:	ff d0                	call   *%rax
+  8017c8:	41 89 c5             	mov    %eax,%r13d
+  8017cb:	85 c0                	test   %eax,%eax
+  8017cd:	78 06                	js     8017d5 <fd_close+0x41>
+  8017cf:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8017d3:	74 1a                	je     8017ef <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8017d5:	45 84 e4             	test   %r12b,%r12b
+  8017d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017dd:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8017e1:	44 89 e8             	mov    %r13d,%eax
+  8017e4:	48 83 c4 18          	add    $0x18,%rsp
+  8017e8:	5b                   	pop    %rbx
+  8017e9:	41 5c                	pop    %r12
+  8017eb:	41 5d                	pop    %r13
+  8017ed:	5d                   	pop    %rbp
+  8017ee:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017ef:	8b 3b                	mov    (%rbx),%edi
+  8017f1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8017f5:	48 b8 24 17 80 00 00 	movabs $0x801724,%rax
+  8017fc:	00 00 00 
+  8017ff:	ff d0                	call   *%rax
+  801801:	41 89 c5             	mov    %eax,%r13d
+  801804:	85 c0                	test   %eax,%eax
+  801806:	78 1b                	js     801823 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801808:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80180c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801810:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801816:	48 85 c0             	test   %rax,%rax
+  801819:	74 08                	je     801823 <fd_close+0x8f>
+  80181b:	48 89 df             	mov    %rbx,%rdi
+  80181e:	ff d0                	call   *%rax
+  801820:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801823:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801828:	48 89 de             	mov    %rbx,%rsi
+  80182b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801830:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  801837:	00 00 00 
+  80183a:	ff d0                	call   *%rax
+    return res;
+  80183c:	eb a3                	jmp    8017e1 <fd_close+0x4d>
+
+000000000080183e <close>:
+
+int
+close(int fdnum) {
+  80183e:	55                   	push   %rbp
+  80183f:	48 89 e5             	mov    %rsp,%rbp
+  801842:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801846:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80184a:	48 b8 d9 16 80 00 00 	movabs $0x8016d9,%rax
+  801851:	00 00 00 
+  801854:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801856:	85 c0                	test   %eax,%eax
+  801858:	78 15                	js     80186f <close+0x31>
+
+    return fd_close(fd, 1);
+  80185a:	be 01 00 00 00       	mov    $0x1,%esi
+  80185f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801863:	48 b8 94 17 80 00 00 	movabs $0x801794,%rax
+  80186a:	00 00 00 
+  80186d:	ff d0                	call   *%rax
+}
+  80186f:	c9                   	leave
+  801870:	c3                   	ret
+
+0000000000801871 <close_all>:
+
+void
+close_all(void) {
+  801871:	55                   	push   %rbp
+  801872:	48 89 e5             	mov    %rsp,%rbp
+  801875:	41 54                	push   %r12
+  801877:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801878:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80187d:	49 bc 3e 18 80 00 00 	movabs $0x80183e,%r12
+  801884:	00 00 00 
+  801887:	89 df                	mov    %ebx,%edi
+  801889:	41 ff d4             	call   *%r12
+  80188c:	83 c3 01             	add    $0x1,%ebx
+  80188f:	83 fb 20             	cmp    $0x20,%ebx
+  801892:	75 f3                	jne    801887 <close_all+0x16>
+}
+  801894:	5b                   	pop    %rbx
+  801895:	41 5c                	pop    %r12
+  801897:	5d                   	pop    %rbp
+  801898:	c3                   	ret
+
+0000000000801899 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801899:	55                   	push   %rbp
+  80189a:	48 89 e5             	mov    %rsp,%rbp
+  80189d:	41 57                	push   %r15
+  80189f:	41 56                	push   %r14
+  8018a1:	41 55                	push   %r13
+  8018a3:	41 54                	push   %r12
+  8018a5:	53                   	push   %rbx
+  8018a6:	48 83 ec 18          	sub    $0x18,%rsp
+  8018aa:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8018ad:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8018b1:	48 b8 d9 16 80 00 00 	movabs $0x8016d9,%rax
+  8018b8:	00 00 00 
+  8018bb:	ff d0                	call   *%rax
+  8018bd:	89 c3                	mov    %eax,%ebx
+  8018bf:	85 c0                	test   %eax,%eax
+  8018c1:	0f 88 b8 00 00 00    	js     80197f <dup+0xe6>
+    close(newfdnum);
+  8018c7:	44 89 e7             	mov    %r12d,%edi
+  8018ca:	48 b8 3e 18 80 00 00 	movabs $0x80183e,%rax
+  8018d1:	00 00 00 
+  8018d4:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8018d6:	4d 63 ec             	movslq %r12d,%r13
+  8018d9:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8018e0:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8018e4:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8018e8:	4c 89 ff             	mov    %r15,%rdi
+  8018eb:	49 be 5d 16 80 00 00 	movabs $0x80165d,%r14
+  8018f2:	00 00 00 
+  8018f5:	41 ff d6             	call   *%r14
+  8018f8:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8018fb:	4c 89 ef             	mov    %r13,%rdi
+  8018fe:	41 ff d6             	call   *%r14
+  801901:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801904:	48 89 df             	mov    %rbx,%rdi
+  801907:	48 b8 f7 25 80 00 00 	movabs $0x8025f7,%rax
+  80190e:	00 00 00 
+  801911:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801913:	a8 04                	test   $0x4,%al
+  801915:	74 2b                	je     801942 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801917:	41 89 c1             	mov    %eax,%r9d
+  80191a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801920:	4c 89 f1             	mov    %r14,%rcx
+  801923:	ba 00 00 00 00       	mov    $0x0,%edx
+  801928:	48 89 de             	mov    %rbx,%rsi
+  80192b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801930:	48 b8 10 11 80 00 00 	movabs $0x801110,%rax
+  801937:	00 00 00 
+  80193a:	ff d0                	call   *%rax
+  80193c:	89 c3                	mov    %eax,%ebx
+  80193e:	85 c0                	test   %eax,%eax
+  801940:	78 4e                	js     801990 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801942:	4c 89 ff             	mov    %r15,%rdi
+  801945:	48 b8 f7 25 80 00 00 	movabs $0x8025f7,%rax
+  80194c:	00 00 00 
+  80194f:	ff d0                	call   *%rax
+  801951:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801954:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80195a:	4c 89 e9             	mov    %r13,%rcx
+  80195d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801962:	4c 89 fe             	mov    %r15,%rsi
+  801965:	bf 00 00 00 00       	mov    $0x0,%edi
+  80196a:	48 b8 10 11 80 00 00 	movabs $0x801110,%rax
+  801971:	00 00 00 
+  801974:	ff d0                	call   *%rax
+  801976:	89 c3                	mov    %eax,%ebx
+  801978:	85 c0                	test   %eax,%eax
+  80197a:	78 14                	js     801990 <dup+0xf7>
+
+    return newfdnum;
+  80197c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80197f:	89 d8                	mov    %ebx,%eax
+  801981:	48 83 c4 18          	add    $0x18,%rsp
+  801985:	5b                   	pop    %rbx
+  801986:	41 5c                	pop    %r12
+  801988:	41 5d                	pop    %r13
+  80198a:	41 5e                	pop    %r14
+  80198c:	41 5f                	pop    %r15
+  80198e:	5d                   	pop    %rbp
+  80198f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801990:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801995:	4c 89 ee             	mov    %r13,%rsi
+  801998:	bf 00 00 00 00       	mov    $0x0,%edi
+  80199d:	49 bc 75 11 80 00 00 	movabs $0x801175,%r12
+  8019a4:	00 00 00 
+  8019a7:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8019aa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019af:	4c 89 f6             	mov    %r14,%rsi
+  8019b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019b7:	41 ff d4             	call   *%r12
+    return res;
+  8019ba:	eb c3                	jmp    80197f <dup+0xe6>
+
+00000000008019bc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8019bc:	55                   	push   %rbp
+  8019bd:	48 89 e5             	mov    %rsp,%rbp
+  8019c0:	41 56                	push   %r14
+  8019c2:	41 55                	push   %r13
+  8019c4:	41 54                	push   %r12
+  8019c6:	53                   	push   %rbx
+  8019c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8019cb:	89 fb                	mov    %edi,%ebx
+  8019cd:	49 89 f4             	mov    %rsi,%r12
+  8019d0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019d3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019d7:	48 b8 d9 16 80 00 00 	movabs $0x8016d9,%rax
+  8019de:	00 00 00 
+  8019e1:	ff d0                	call   *%rax
+  8019e3:	85 c0                	test   %eax,%eax
+  8019e5:	78 4c                	js     801a33 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019e7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019eb:	41 8b 3e             	mov    (%r14),%edi
+  8019ee:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019f2:	48 b8 24 17 80 00 00 	movabs $0x801724,%rax
+  8019f9:	00 00 00 
+  8019fc:	ff d0                	call   *%rax
+  8019fe:	85 c0                	test   %eax,%eax
+  801a00:	78 35                	js     801a37 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a02:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a06:	83 e0 03             	and    $0x3,%eax
+  801a09:	83 f8 01             	cmp    $0x1,%eax
+  801a0c:	74 2d                	je     801a3b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a12:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801a16:	48 85 c0             	test   %rax,%rax
+  801a19:	74 56                	je     801a71 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801a1b:	4c 89 ea             	mov    %r13,%rdx
+  801a1e:	4c 89 e6             	mov    %r12,%rsi
+  801a21:	4c 89 f7             	mov    %r14,%rdi
+  801a24:	ff d0                	call   *%rax
+}
+  801a26:	48 83 c4 10          	add    $0x10,%rsp
+  801a2a:	5b                   	pop    %rbx
+  801a2b:	41 5c                	pop    %r12
+  801a2d:	41 5d                	pop    %r13
+  801a2f:	41 5e                	pop    %r14
+  801a31:	5d                   	pop    %rbp
+  801a32:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a33:	48 98                	cltq
+  801a35:	eb ef                	jmp    801a26 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a37:	48 98                	cltq
+  801a39:	eb eb                	jmp    801a26 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a3b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a42:	00 00 00 
+  801a45:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a4b:	89 da                	mov    %ebx,%edx
+  801a4d:	48 bf 01 31 80 00 00 	movabs $0x803101,%rdi
+  801a54:	00 00 00 
+  801a57:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5c:	48 b9 d4 01 80 00 00 	movabs $0x8001d4,%rcx
+  801a63:	00 00 00 
+  801a66:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a68:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a6f:	eb b5                	jmp    801a26 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a71:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a78:	eb ac                	jmp    801a26 <read+0x6a>
+
+0000000000801a7a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a7a:	55                   	push   %rbp
+  801a7b:	48 89 e5             	mov    %rsp,%rbp
+  801a7e:	41 57                	push   %r15
+  801a80:	41 56                	push   %r14
+  801a82:	41 55                	push   %r13
+  801a84:	41 54                	push   %r12
+  801a86:	53                   	push   %rbx
+  801a87:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a8b:	48 85 d2             	test   %rdx,%rdx
+  801a8e:	74 54                	je     801ae4 <readn+0x6a>
+  801a90:	41 89 fd             	mov    %edi,%r13d
+  801a93:	49 89 f6             	mov    %rsi,%r14
+  801a96:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801a99:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801a9e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801aa3:	49 bf bc 19 80 00 00 	movabs $0x8019bc,%r15
+  801aaa:	00 00 00 
+  801aad:	4c 89 e2             	mov    %r12,%rdx
+  801ab0:	48 29 f2             	sub    %rsi,%rdx
+  801ab3:	4c 01 f6             	add    %r14,%rsi
+  801ab6:	44 89 ef             	mov    %r13d,%edi
+  801ab9:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801abc:	85 c0                	test   %eax,%eax
+  801abe:	78 20                	js     801ae0 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ac0:	01 c3                	add    %eax,%ebx
+  801ac2:	85 c0                	test   %eax,%eax
+  801ac4:	74 08                	je     801ace <readn+0x54>
+  801ac6:	48 63 f3             	movslq %ebx,%rsi
+  801ac9:	4c 39 e6             	cmp    %r12,%rsi
+  801acc:	72 df                	jb     801aad <readn+0x33>
+    }
+    return res;
+  801ace:	48 63 c3             	movslq %ebx,%rax
+}
+  801ad1:	48 83 c4 08          	add    $0x8,%rsp
+  801ad5:	5b                   	pop    %rbx
+  801ad6:	41 5c                	pop    %r12
+  801ad8:	41 5d                	pop    %r13
+  801ada:	41 5e                	pop    %r14
+  801adc:	41 5f                	pop    %r15
+  801ade:	5d                   	pop    %rbp
+  801adf:	c3                   	ret
+        if (inc < 0) return inc;
+  801ae0:	48 98                	cltq
+  801ae2:	eb ed                	jmp    801ad1 <readn+0x57>
+    int inc = 1, res = 0;
+  801ae4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ae9:	eb e3                	jmp    801ace <readn+0x54>
+
+0000000000801aeb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801aeb:	55                   	push   %rbp
+  801aec:	48 89 e5             	mov    %rsp,%rbp
+  801aef:	41 56                	push   %r14
+  801af1:	41 55                	push   %r13
+  801af3:	41 54                	push   %r12
+  801af5:	53                   	push   %rbx
+  801af6:	48 83 ec 10          	sub    $0x10,%rsp
+  801afa:	89 fb                	mov    %edi,%ebx
+  801afc:	49 89 f4             	mov    %rsi,%r12
+  801aff:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b02:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b06:	48 b8 d9 16 80 00 00 	movabs $0x8016d9,%rax
+  801b0d:	00 00 00 
+  801b10:	ff d0                	call   *%rax
+  801b12:	85 c0                	test   %eax,%eax
+  801b14:	78 47                	js     801b5d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b16:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b1a:	41 8b 3e             	mov    (%r14),%edi
+  801b1d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b21:	48 b8 24 17 80 00 00 	movabs $0x801724,%rax
+  801b28:	00 00 00 
+  801b2b:	ff d0                	call   *%rax
+  801b2d:	85 c0                	test   %eax,%eax
+  801b2f:	78 30                	js     801b61 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b31:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b36:	74 2d                	je     801b65 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b38:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b3c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b40:	48 85 c0             	test   %rax,%rax
+  801b43:	74 56                	je     801b9b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b45:	4c 89 ea             	mov    %r13,%rdx
+  801b48:	4c 89 e6             	mov    %r12,%rsi
+  801b4b:	4c 89 f7             	mov    %r14,%rdi
+  801b4e:	ff d0                	call   *%rax
+}
+  801b50:	48 83 c4 10          	add    $0x10,%rsp
+  801b54:	5b                   	pop    %rbx
+  801b55:	41 5c                	pop    %r12
+  801b57:	41 5d                	pop    %r13
+  801b59:	41 5e                	pop    %r14
+  801b5b:	5d                   	pop    %rbp
+  801b5c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b5d:	48 98                	cltq
+  801b5f:	eb ef                	jmp    801b50 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b61:	48 98                	cltq
+  801b63:	eb eb                	jmp    801b50 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b65:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b6c:	00 00 00 
+  801b6f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b75:	89 da                	mov    %ebx,%edx
+  801b77:	48 bf 1d 31 80 00 00 	movabs $0x80311d,%rdi
+  801b7e:	00 00 00 
+  801b81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b86:	48 b9 d4 01 80 00 00 	movabs $0x8001d4,%rcx
+  801b8d:	00 00 00 
+  801b90:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b92:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b99:	eb b5                	jmp    801b50 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b9b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ba2:	eb ac                	jmp    801b50 <write+0x65>
+
+0000000000801ba4 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ba4:	55                   	push   %rbp
+  801ba5:	48 89 e5             	mov    %rsp,%rbp
+  801ba8:	53                   	push   %rbx
+  801ba9:	48 83 ec 18          	sub    $0x18,%rsp
+  801bad:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801baf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801bb3:	48 b8 d9 16 80 00 00 	movabs $0x8016d9,%rax
+  801bba:	00 00 00 
+  801bbd:	ff d0                	call   *%rax
+  801bbf:	85 c0                	test   %eax,%eax
+  801bc1:	78 0c                	js     801bcf <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801bc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bc7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801bca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bcf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bd3:	c9                   	leave
+  801bd4:	c3                   	ret
+
+0000000000801bd5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801bd5:	55                   	push   %rbp
+  801bd6:	48 89 e5             	mov    %rsp,%rbp
+  801bd9:	41 55                	push   %r13
+  801bdb:	41 54                	push   %r12
+  801bdd:	53                   	push   %rbx
+  801bde:	48 83 ec 18          	sub    $0x18,%rsp
+  801be2:	89 fb                	mov    %edi,%ebx
+  801be4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801be7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801beb:	48 b8 d9 16 80 00 00 	movabs $0x8016d9,%rax
+  801bf2:	00 00 00 
+  801bf5:	ff d0                	call   *%rax
+  801bf7:	85 c0                	test   %eax,%eax
+  801bf9:	78 38                	js     801c33 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bfb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801bff:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c03:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c07:	48 b8 24 17 80 00 00 	movabs $0x801724,%rax
+  801c0e:	00 00 00 
+  801c11:	ff d0                	call   *%rax
+  801c13:	85 c0                	test   %eax,%eax
+  801c15:	78 1c                	js     801c33 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c17:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c1c:	74 20                	je     801c3e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c1e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c22:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801c26:	48 85 c0             	test   %rax,%rax
+  801c29:	74 47                	je     801c72 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c2b:	44 89 e6             	mov    %r12d,%esi
+  801c2e:	4c 89 ef             	mov    %r13,%rdi
+  801c31:	ff d0                	call   *%rax
+}
+  801c33:	48 83 c4 18          	add    $0x18,%rsp
+  801c37:	5b                   	pop    %rbx
+  801c38:	41 5c                	pop    %r12
+  801c3a:	41 5d                	pop    %r13
+  801c3c:	5d                   	pop    %rbp
+  801c3d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c3e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c45:	00 00 00 
+  801c48:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c4e:	89 da                	mov    %ebx,%edx
+  801c50:	48 bf e0 30 80 00 00 	movabs $0x8030e0,%rdi
+  801c57:	00 00 00 
+  801c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5f:	48 b9 d4 01 80 00 00 	movabs $0x8001d4,%rcx
+  801c66:	00 00 00 
+  801c69:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c70:	eb c1                	jmp    801c33 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c72:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c77:	eb ba                	jmp    801c33 <ftruncate+0x5e>
+
+0000000000801c79 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801c79:	55                   	push   %rbp
+  801c7a:	48 89 e5             	mov    %rsp,%rbp
+  801c7d:	41 54                	push   %r12
+  801c7f:	53                   	push   %rbx
+  801c80:	48 83 ec 10          	sub    $0x10,%rsp
+  801c84:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c87:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c8b:	48 b8 d9 16 80 00 00 	movabs $0x8016d9,%rax
+  801c92:	00 00 00 
+  801c95:	ff d0                	call   *%rax
+  801c97:	85 c0                	test   %eax,%eax
+  801c99:	78 4e                	js     801ce9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c9b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c9f:	41 8b 3c 24          	mov    (%r12),%edi
+  801ca3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ca7:	48 b8 24 17 80 00 00 	movabs $0x801724,%rax
+  801cae:	00 00 00 
+  801cb1:	ff d0                	call   *%rax
+  801cb3:	85 c0                	test   %eax,%eax
+  801cb5:	78 32                	js     801ce9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801cb7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801cbb:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801cc0:	74 30                	je     801cf2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801cc2:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801cc5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801ccc:	00 00 00 
+    stat->st_isdir = 0;
+  801ccf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801cd6:	00 00 00 
+    stat->st_dev = dev;
+  801cd9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801ce0:	48 89 de             	mov    %rbx,%rsi
+  801ce3:	4c 89 e7             	mov    %r12,%rdi
+  801ce6:	ff 50 28             	call   *0x28(%rax)
+}
+  801ce9:	48 83 c4 10          	add    $0x10,%rsp
+  801ced:	5b                   	pop    %rbx
+  801cee:	41 5c                	pop    %r12
+  801cf0:	5d                   	pop    %rbp
+  801cf1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801cf2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801cf7:	eb f0                	jmp    801ce9 <fstat+0x70>
+
+0000000000801cf9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801cf9:	55                   	push   %rbp
+  801cfa:	48 89 e5             	mov    %rsp,%rbp
+  801cfd:	41 54                	push   %r12
+  801cff:	53                   	push   %rbx
+  801d00:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d03:	be 00 00 00 00       	mov    $0x0,%esi
+  801d08:	48 b8 7a 1f 80 00 00 	movabs $0x801f7a,%rax
+  801d0f:	00 00 00 
+  801d12:	ff d0                	call   *%rax
+  801d14:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d16:	85 c0                	test   %eax,%eax
+  801d18:	78 25                	js     801d3f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d1a:	4c 89 e6             	mov    %r12,%rsi
+  801d1d:	89 c7                	mov    %eax,%edi
+  801d1f:	48 b8 79 1c 80 00 00 	movabs $0x801c79,%rax
+  801d26:	00 00 00 
+  801d29:	ff d0                	call   *%rax
+  801d2b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d2e:	89 df                	mov    %ebx,%edi
+  801d30:	48 b8 3e 18 80 00 00 	movabs $0x80183e,%rax
+  801d37:	00 00 00 
+  801d3a:	ff d0                	call   *%rax
+
+    return res;
+  801d3c:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d3f:	89 d8                	mov    %ebx,%eax
+  801d41:	5b                   	pop    %rbx
+  801d42:	41 5c                	pop    %r12
+  801d44:	5d                   	pop    %rbp
+  801d45:	c3                   	ret
+
+0000000000801d46 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801d46:	55                   	push   %rbp
+  801d47:	48 89 e5             	mov    %rsp,%rbp
+  801d4a:	41 54                	push   %r12
+  801d4c:	53                   	push   %rbx
+  801d4d:	48 83 ec 10          	sub    $0x10,%rsp
+  801d51:	41 89 fc             	mov    %edi,%r12d
+  801d54:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d57:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801d5e:	00 00 00 
+  801d61:	83 38 00             	cmpl   $0x0,(%rax)
+  801d64:	74 5e                	je     801dc4 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801d66:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801d6c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d71:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801d78:	00 00 00 
+  801d7b:	44 89 e6             	mov    %r12d,%esi
+  801d7e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801d85:	00 00 00 
+  801d88:	8b 38                	mov    (%rax),%edi
+  801d8a:	48 b8 56 2a 80 00 00 	movabs $0x802a56,%rax
+  801d91:	00 00 00 
+  801d94:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801d96:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801d9d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801d9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801da3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801da7:	48 89 de             	mov    %rbx,%rsi
+  801daa:	bf 00 00 00 00       	mov    $0x0,%edi
+  801daf:	48 b8 c1 29 80 00 00 	movabs $0x8029c1,%rax
+  801db6:	00 00 00 
+  801db9:	ff d0                	call   *%rax
+}
+  801dbb:	48 83 c4 10          	add    $0x10,%rsp
+  801dbf:	5b                   	pop    %rbx
+  801dc0:	41 5c                	pop    %r12
+  801dc2:	5d                   	pop    %rbp
+  801dc3:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801dc4:	bf 03 00 00 00       	mov    $0x3,%edi
+  801dc9:	48 b8 f6 2a 80 00 00 	movabs $0x802af6,%rax
+  801dd0:	00 00 00 
+  801dd3:	ff d0                	call   *%rax
+  801dd5:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801ddc:	00 00 
+  801dde:	eb 86                	jmp    801d66 <fsipc+0x20>
+
+0000000000801de0 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801de0:	55                   	push   %rbp
+  801de1:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801de4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801deb:	00 00 00 
+  801dee:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801df1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801df3:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801df6:	be 00 00 00 00       	mov    $0x0,%esi
+  801dfb:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e00:	48 b8 46 1d 80 00 00 	movabs $0x801d46,%rax
+  801e07:	00 00 00 
+  801e0a:	ff d0                	call   *%rax
+}
+  801e0c:	5d                   	pop    %rbp
+  801e0d:	c3                   	ret
+
+0000000000801e0e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801e0e:	55                   	push   %rbp
+  801e0f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e12:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801e15:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801e1c:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801e1e:	be 00 00 00 00       	mov    $0x0,%esi
+  801e23:	bf 06 00 00 00       	mov    $0x6,%edi
+  801e28:	48 b8 46 1d 80 00 00 	movabs $0x801d46,%rax
+  801e2f:	00 00 00 
+  801e32:	ff d0                	call   *%rax
+}
+  801e34:	5d                   	pop    %rbp
+  801e35:	c3                   	ret
+
+0000000000801e36 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801e36:	55                   	push   %rbp
+  801e37:	48 89 e5             	mov    %rsp,%rbp
+  801e3a:	41 54                	push   %r12
+  801e3c:	53                   	push   %rbx
+  801e3d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e40:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801e43:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801e4a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801e4c:	be 00 00 00 00       	mov    $0x0,%esi
+  801e51:	bf 05 00 00 00       	mov    $0x5,%edi
+  801e56:	48 b8 46 1d 80 00 00 	movabs $0x801d46,%rax
+  801e5d:	00 00 00 
+  801e60:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e62:	85 c0                	test   %eax,%eax
+  801e64:	78 3d                	js     801ea3 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e66:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801e6d:	00 00 00 
+  801e70:	4c 89 e6             	mov    %r12,%rsi
+  801e73:	48 89 df             	mov    %rbx,%rdi
+  801e76:	48 b8 f9 0a 80 00 00 	movabs $0x800af9,%rax
+  801e7d:	00 00 00 
+  801e80:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801e82:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801e89:	00 
+  801e8a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e90:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801e97:	00 
+  801e98:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ea3:	5b                   	pop    %rbx
+  801ea4:	41 5c                	pop    %r12
+  801ea6:	5d                   	pop    %rbp
+  801ea7:	c3                   	ret
+
+0000000000801ea8 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801ea8:	55                   	push   %rbp
+  801ea9:	48 89 e5             	mov    %rsp,%rbp
+  801eac:	41 54                	push   %r12
+  801eae:	53                   	push   %rbx
+  801eaf:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  801eb2:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  801eb7:	48 39 c2             	cmp    %rax,%rdx
+  801eba:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801ebe:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801ec1:	48 89 c2             	mov    %rax,%rdx
+  801ec4:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801ecb:	00 00 00 
+  801ece:	48 b8 5a 0d 80 00 00 	movabs $0x800d5a,%rax
+  801ed5:	00 00 00 
+  801ed8:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801eda:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801ee1:	00 00 00 
+  801ee4:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  801ee9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  801eeb:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  801eef:	be 00 00 00 00       	mov    $0x0,%esi
+  801ef4:	bf 04 00 00 00       	mov    $0x4,%edi
+  801ef9:	48 b8 46 1d 80 00 00 	movabs $0x801d46,%rax
+  801f00:	00 00 00 
+  801f03:	ff d0                	call   *%rax
+  801f05:	48 98                	cltq
+}
+  801f07:	5b                   	pop    %rbx
+  801f08:	41 5c                	pop    %r12
+  801f0a:	5d                   	pop    %rbp
+  801f0b:	c3                   	ret
+
+0000000000801f0c <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801f0c:	55                   	push   %rbp
+  801f0d:	48 89 e5             	mov    %rsp,%rbp
+  801f10:	41 54                	push   %r12
+  801f12:	53                   	push   %rbx
+  801f13:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f16:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801f1d:	00 00 00 
+  801f20:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801f23:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  801f25:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801f2a:	48 39 ca             	cmp    %rcx,%rdx
+  801f2d:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  801f31:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  801f35:	be 00 00 00 00       	mov    $0x0,%esi
+  801f3a:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f3f:	48 b8 46 1d 80 00 00 	movabs $0x801d46,%rax
+  801f46:	00 00 00 
+  801f49:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  801f4b:	85 c0                	test   %eax,%eax
+  801f4d:	78 27                	js     801f76 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  801f4f:	48 63 d8             	movslq %eax,%rbx
+  801f52:	48 89 da             	mov    %rbx,%rdx
+  801f55:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801f5c:	00 00 00 
+  801f5f:	4c 89 e7             	mov    %r12,%rdi
+  801f62:	48 b8 5a 0d 80 00 00 	movabs $0x800d5a,%rax
+  801f69:	00 00 00 
+  801f6c:	ff d0                	call   *%rax
+    return bytes_read;
+  801f6e:	48 89 d8             	mov    %rbx,%rax
+}
+  801f71:	5b                   	pop    %rbx
+  801f72:	41 5c                	pop    %r12
+  801f74:	5d                   	pop    %rbp
+  801f75:	c3                   	ret
+        return bytes_read;
+  801f76:	48 98                	cltq
+  801f78:	eb f7                	jmp    801f71 <devfile_read+0x65>
+
+0000000000801f7a <open>:
+open(const char *path, int mode) {
+  801f7a:	55                   	push   %rbp
+  801f7b:	48 89 e5             	mov    %rsp,%rbp
+  801f7e:	41 55                	push   %r13
+  801f80:	41 54                	push   %r12
+  801f82:	53                   	push   %rbx
+  801f83:	48 83 ec 18          	sub    $0x18,%rsp
+  801f87:	49 89 fc             	mov    %rdi,%r12
+  801f8a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801f8d:	48 b8 bb 0a 80 00 00 	movabs $0x800abb,%rax
+  801f94:	00 00 00 
+  801f97:	ff d0                	call   *%rax
+  801f99:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801f9f:	0f 87 8a 00 00 00    	ja     80202f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801fa5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801fa9:	48 b8 79 16 80 00 00 	movabs $0x801679,%rax
+  801fb0:	00 00 00 
+  801fb3:	ff d0                	call   *%rax
+  801fb5:	89 c3                	mov    %eax,%ebx
+  801fb7:	85 c0                	test   %eax,%eax
+  801fb9:	78 50                	js     80200b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801fbb:	4c 89 e6             	mov    %r12,%rsi
+  801fbe:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801fc5:	00 00 00 
+  801fc8:	48 89 df             	mov    %rbx,%rdi
+  801fcb:	48 b8 f9 0a 80 00 00 	movabs $0x800af9,%rax
+  801fd2:	00 00 00 
+  801fd5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801fd7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801fde:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801fe2:	bf 01 00 00 00       	mov    $0x1,%edi
+  801fe7:	48 b8 46 1d 80 00 00 	movabs $0x801d46,%rax
+  801fee:	00 00 00 
+  801ff1:	ff d0                	call   *%rax
+  801ff3:	89 c3                	mov    %eax,%ebx
+  801ff5:	85 c0                	test   %eax,%eax
+  801ff7:	78 1f                	js     802018 <open+0x9e>
+    return fd2num(fd);
+  801ff9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801ffd:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  802004:	00 00 00 
+  802007:	ff d0                	call   *%rax
+  802009:	89 c3                	mov    %eax,%ebx
+}
+  80200b:	89 d8                	mov    %ebx,%eax
+  80200d:	48 83 c4 18          	add    $0x18,%rsp
+  802011:	5b                   	pop    %rbx
+  802012:	41 5c                	pop    %r12
+  802014:	41 5d                	pop    %r13
+  802016:	5d                   	pop    %rbp
+  802017:	c3                   	ret
+        fd_close(fd, 0);
+  802018:	be 00 00 00 00       	mov    $0x0,%esi
+  80201d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802021:	48 b8 94 17 80 00 00 	movabs $0x801794,%rax
+  802028:	00 00 00 
+  80202b:	ff d0                	call   *%rax
+        return res;
+  80202d:	eb dc                	jmp    80200b <open+0x91>
+        return -E_BAD_PATH;
+  80202f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802034:	eb d5                	jmp    80200b <open+0x91>
+
+0000000000802036 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802036:	55                   	push   %rbp
+  802037:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80203a:	be 00 00 00 00       	mov    $0x0,%esi
+  80203f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802044:	48 b8 46 1d 80 00 00 	movabs $0x801d46,%rax
+  80204b:	00 00 00 
+  80204e:	ff d0                	call   *%rax
+}
+  802050:	5d                   	pop    %rbp
+  802051:	c3                   	ret
+
+0000000000802052 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802052:	55                   	push   %rbp
+  802053:	48 89 e5             	mov    %rsp,%rbp
+  802056:	41 54                	push   %r12
+  802058:	53                   	push   %rbx
+  802059:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80205c:	48 b8 5d 16 80 00 00 	movabs $0x80165d,%rax
+  802063:	00 00 00 
+  802066:	ff d0                	call   *%rax
+  802068:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80206b:	48 be 60 31 80 00 00 	movabs $0x803160,%rsi
+  802072:	00 00 00 
+  802075:	48 89 df             	mov    %rbx,%rdi
+  802078:	48 b8 f9 0a 80 00 00 	movabs $0x800af9,%rax
+  80207f:	00 00 00 
+  802082:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802084:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802089:	41 2b 04 24          	sub    (%r12),%eax
+  80208d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802093:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80209a:	00 00 00 
+    stat->st_dev = &devpipe;
+  80209d:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8020a4:	00 00 00 
+  8020a7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8020ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b3:	5b                   	pop    %rbx
+  8020b4:	41 5c                	pop    %r12
+  8020b6:	5d                   	pop    %rbp
+  8020b7:	c3                   	ret
+
+00000000008020b8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8020b8:	55                   	push   %rbp
+  8020b9:	48 89 e5             	mov    %rsp,%rbp
+  8020bc:	41 54                	push   %r12
+  8020be:	53                   	push   %rbx
+  8020bf:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8020c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020c7:	48 89 fe             	mov    %rdi,%rsi
+  8020ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020cf:	49 bc 75 11 80 00 00 	movabs $0x801175,%r12
+  8020d6:	00 00 00 
+  8020d9:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8020dc:	48 89 df             	mov    %rbx,%rdi
+  8020df:	48 b8 5d 16 80 00 00 	movabs $0x80165d,%rax
+  8020e6:	00 00 00 
+  8020e9:	ff d0                	call   *%rax
+  8020eb:	48 89 c6             	mov    %rax,%rsi
+  8020ee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020f8:	41 ff d4             	call   *%r12
+}
+  8020fb:	5b                   	pop    %rbx
+  8020fc:	41 5c                	pop    %r12
+  8020fe:	5d                   	pop    %rbp
+  8020ff:	c3                   	ret
+
+0000000000802100 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802100:	55                   	push   %rbp
+  802101:	48 89 e5             	mov    %rsp,%rbp
+  802104:	41 57                	push   %r15
+  802106:	41 56                	push   %r14
+  802108:	41 55                	push   %r13
+  80210a:	41 54                	push   %r12
+  80210c:	53                   	push   %rbx
+  80210d:	48 83 ec 18          	sub    $0x18,%rsp
+  802111:	49 89 fc             	mov    %rdi,%r12
+  802114:	49 89 f5             	mov    %rsi,%r13
+  802117:	49 89 d7             	mov    %rdx,%r15
+  80211a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80211e:	48 b8 5d 16 80 00 00 	movabs $0x80165d,%rax
+  802125:	00 00 00 
+  802128:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80212a:	4d 85 ff             	test   %r15,%r15
+  80212d:	0f 84 af 00 00 00    	je     8021e2 <devpipe_write+0xe2>
+  802133:	48 89 c3             	mov    %rax,%rbx
+  802136:	4c 89 f8             	mov    %r15,%rax
+  802139:	4d 89 ef             	mov    %r13,%r15
+  80213c:	4c 01 e8             	add    %r13,%rax
+  80213f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802143:	49 bd 7d 10 80 00 00 	movabs $0x80107d,%r13
+  80214a:	00 00 00 
+            sys_yield();
+  80214d:	49 be 1a 10 80 00 00 	movabs $0x80101a,%r14
+  802154:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802157:	8b 73 04             	mov    0x4(%rbx),%esi
+  80215a:	48 63 ce             	movslq %esi,%rcx
+  80215d:	48 63 03             	movslq (%rbx),%rax
+  802160:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802166:	48 39 c1             	cmp    %rax,%rcx
+  802169:	72 2e                	jb     802199 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80216b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802170:	48 89 da             	mov    %rbx,%rdx
+  802173:	be 00 10 00 00       	mov    $0x1000,%esi
+  802178:	4c 89 e7             	mov    %r12,%rdi
+  80217b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80217e:	85 c0                	test   %eax,%eax
+  802180:	74 66                	je     8021e8 <devpipe_write+0xe8>
+            sys_yield();
+  802182:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802185:	8b 73 04             	mov    0x4(%rbx),%esi
+  802188:	48 63 ce             	movslq %esi,%rcx
+  80218b:	48 63 03             	movslq (%rbx),%rax
+  80218e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802194:	48 39 c1             	cmp    %rax,%rcx
+  802197:	73 d2                	jae    80216b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802199:	41 0f b6 3f          	movzbl (%r15),%edi
+  80219d:	48 89 ca             	mov    %rcx,%rdx
+  8021a0:	48 c1 ea 03          	shr    $0x3,%rdx
+  8021a4:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8021ab:	08 10 20 
+  8021ae:	48 f7 e2             	mul    %rdx
+  8021b1:	48 c1 ea 06          	shr    $0x6,%rdx
+  8021b5:	48 89 d0             	mov    %rdx,%rax
+  8021b8:	48 c1 e0 09          	shl    $0x9,%rax
+  8021bc:	48 29 d0             	sub    %rdx,%rax
+  8021bf:	48 c1 e0 03          	shl    $0x3,%rax
+  8021c3:	48 29 c1             	sub    %rax,%rcx
+  8021c6:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8021cb:	83 c6 01             	add    $0x1,%esi
+  8021ce:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8021d1:	49 83 c7 01          	add    $0x1,%r15
+  8021d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021d9:	49 39 c7             	cmp    %rax,%r15
+  8021dc:	0f 85 75 ff ff ff    	jne    802157 <devpipe_write+0x57>
+    return n;
+  8021e2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021e6:	eb 05                	jmp    8021ed <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8021e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021ed:	48 83 c4 18          	add    $0x18,%rsp
+  8021f1:	5b                   	pop    %rbx
+  8021f2:	41 5c                	pop    %r12
+  8021f4:	41 5d                	pop    %r13
+  8021f6:	41 5e                	pop    %r14
+  8021f8:	41 5f                	pop    %r15
+  8021fa:	5d                   	pop    %rbp
+  8021fb:	c3                   	ret
+
+00000000008021fc <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8021fc:	55                   	push   %rbp
+  8021fd:	48 89 e5             	mov    %rsp,%rbp
+  802200:	41 57                	push   %r15
+  802202:	41 56                	push   %r14
+  802204:	41 55                	push   %r13
+  802206:	41 54                	push   %r12
+  802208:	53                   	push   %rbx
+  802209:	48 83 ec 18          	sub    $0x18,%rsp
+  80220d:	49 89 fc             	mov    %rdi,%r12
+  802210:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802214:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802218:	48 b8 5d 16 80 00 00 	movabs $0x80165d,%rax
+  80221f:	00 00 00 
+  802222:	ff d0                	call   *%rax
+  802224:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802227:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80222d:	49 bd 7d 10 80 00 00 	movabs $0x80107d,%r13
+  802234:	00 00 00 
+            sys_yield();
+  802237:	49 be 1a 10 80 00 00 	movabs $0x80101a,%r14
+  80223e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802241:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802246:	74 7d                	je     8022c5 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802248:	8b 03                	mov    (%rbx),%eax
+  80224a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80224d:	75 26                	jne    802275 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80224f:	4d 85 ff             	test   %r15,%r15
+  802252:	75 77                	jne    8022cb <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802254:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802259:	48 89 da             	mov    %rbx,%rdx
+  80225c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802261:	4c 89 e7             	mov    %r12,%rdi
+  802264:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802267:	85 c0                	test   %eax,%eax
+  802269:	74 72                	je     8022dd <devpipe_read+0xe1>
+            sys_yield();
+  80226b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80226e:	8b 03                	mov    (%rbx),%eax
+  802270:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802273:	74 df                	je     802254 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802275:	48 63 c8             	movslq %eax,%rcx
+  802278:	48 89 ca             	mov    %rcx,%rdx
+  80227b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80227f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802286:	08 10 20 
+  802289:	48 89 d0             	mov    %rdx,%rax
+  80228c:	48 f7 e6             	mul    %rsi
+  80228f:	48 c1 ea 06          	shr    $0x6,%rdx
+  802293:	48 89 d0             	mov    %rdx,%rax
+  802296:	48 c1 e0 09          	shl    $0x9,%rax
+  80229a:	48 29 d0             	sub    %rdx,%rax
+  80229d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8022a4:	00 
+  8022a5:	48 89 c8             	mov    %rcx,%rax
+  8022a8:	48 29 d0             	sub    %rdx,%rax
+  8022ab:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8022b0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8022b4:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8022b8:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8022bb:	49 83 c7 01          	add    $0x1,%r15
+  8022bf:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8022c3:	75 83                	jne    802248 <devpipe_read+0x4c>
+    return n;
+  8022c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022c9:	eb 03                	jmp    8022ce <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8022cb:	4c 89 f8             	mov    %r15,%rax
+}
+  8022ce:	48 83 c4 18          	add    $0x18,%rsp
+  8022d2:	5b                   	pop    %rbx
+  8022d3:	41 5c                	pop    %r12
+  8022d5:	41 5d                	pop    %r13
+  8022d7:	41 5e                	pop    %r14
+  8022d9:	41 5f                	pop    %r15
+  8022db:	5d                   	pop    %rbp
+  8022dc:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8022dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e2:	eb ea                	jmp    8022ce <devpipe_read+0xd2>
+
+00000000008022e4 <pipe>:
+pipe(int pfd[2]) {
+  8022e4:	55                   	push   %rbp
+  8022e5:	48 89 e5             	mov    %rsp,%rbp
+  8022e8:	41 55                	push   %r13
+  8022ea:	41 54                	push   %r12
+  8022ec:	53                   	push   %rbx
+  8022ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8022f1:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022f4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8022f8:	48 b8 79 16 80 00 00 	movabs $0x801679,%rax
+  8022ff:	00 00 00 
+  802302:	ff d0                	call   *%rax
+  802304:	89 c3                	mov    %eax,%ebx
+  802306:	85 c0                	test   %eax,%eax
+  802308:	0f 88 a0 01 00 00    	js     8024ae <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80230e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802313:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802318:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80231c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802321:	48 b8 a9 10 80 00 00 	movabs $0x8010a9,%rax
+  802328:	00 00 00 
+  80232b:	ff d0                	call   *%rax
+  80232d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80232f:	85 c0                	test   %eax,%eax
+  802331:	0f 88 77 01 00 00    	js     8024ae <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802337:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80233b:	48 b8 79 16 80 00 00 	movabs $0x801679,%rax
+  802342:	00 00 00 
+  802345:	ff d0                	call   *%rax
+  802347:	89 c3                	mov    %eax,%ebx
+  802349:	85 c0                	test   %eax,%eax
+  80234b:	0f 88 43 01 00 00    	js     802494 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802351:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802356:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80235b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80235f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802364:	48 b8 a9 10 80 00 00 	movabs $0x8010a9,%rax
+  80236b:	00 00 00 
+  80236e:	ff d0                	call   *%rax
+  802370:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802372:	85 c0                	test   %eax,%eax
+  802374:	0f 88 1a 01 00 00    	js     802494 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80237a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80237e:	48 b8 5d 16 80 00 00 	movabs $0x80165d,%rax
+  802385:	00 00 00 
+  802388:	ff d0                	call   *%rax
+  80238a:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80238d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802392:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802397:	48 89 c6             	mov    %rax,%rsi
+  80239a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80239f:	48 b8 a9 10 80 00 00 	movabs $0x8010a9,%rax
+  8023a6:	00 00 00 
+  8023a9:	ff d0                	call   *%rax
+  8023ab:	89 c3                	mov    %eax,%ebx
+  8023ad:	85 c0                	test   %eax,%eax
+  8023af:	0f 88 c5 00 00 00    	js     80247a <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8023b5:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8023b9:	48 b8 5d 16 80 00 00 	movabs $0x80165d,%rax
+  8023c0:	00 00 00 
+  8023c3:	ff d0                	call   *%rax
+  8023c5:	48 89 c1             	mov    %rax,%rcx
+  8023c8:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8023ce:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023d9:	4c 89 ee             	mov    %r13,%rsi
+  8023dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023e1:	48 b8 10 11 80 00 00 	movabs $0x801110,%rax
+  8023e8:	00 00 00 
+  8023eb:	ff d0                	call   *%rax
+  8023ed:	89 c3                	mov    %eax,%ebx
+  8023ef:	85 c0                	test   %eax,%eax
+  8023f1:	78 6e                	js     802461 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8023f3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8023f8:	4c 89 ef             	mov    %r13,%rdi
+  8023fb:	48 b8 4b 10 80 00 00 	movabs $0x80104b,%rax
+  802402:	00 00 00 
+  802405:	ff d0                	call   *%rax
+  802407:	83 f8 02             	cmp    $0x2,%eax
+  80240a:	0f 85 ab 00 00 00    	jne    8024bb <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802410:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802417:	00 00 
+  802419:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80241d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80241f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802423:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80242a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80242e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802430:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802434:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80243b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80243f:	48 bb 4b 16 80 00 00 	movabs $0x80164b,%rbx
+  802446:	00 00 00 
+  802449:	ff d3                	call   *%rbx
+  80244b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80244f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802453:	ff d3                	call   *%rbx
+  802455:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80245a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80245f:	eb 4d                	jmp    8024ae <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802461:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802466:	4c 89 ee             	mov    %r13,%rsi
+  802469:	bf 00 00 00 00       	mov    $0x0,%edi
+  80246e:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  802475:	00 00 00 
+  802478:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80247a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80247f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802483:	bf 00 00 00 00       	mov    $0x0,%edi
+  802488:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  80248f:	00 00 00 
+  802492:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802494:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802499:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80249d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024a2:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  8024a9:	00 00 00 
+  8024ac:	ff d0                	call   *%rax
+}
+  8024ae:	89 d8                	mov    %ebx,%eax
+  8024b0:	48 83 c4 18          	add    $0x18,%rsp
+  8024b4:	5b                   	pop    %rbx
+  8024b5:	41 5c                	pop    %r12
+  8024b7:	41 5d                	pop    %r13
+  8024b9:	5d                   	pop    %rbp
+  8024ba:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8024bb:	48 b9 90 31 80 00 00 	movabs $0x803190,%rcx
+  8024c2:	00 00 00 
+  8024c5:	48 ba 67 31 80 00 00 	movabs $0x803167,%rdx
+  8024cc:	00 00 00 
+  8024cf:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8024d4:	48 bf 7c 31 80 00 00 	movabs $0x80317c,%rdi
+  8024db:	00 00 00 
+  8024de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e3:	49 b8 1e 29 80 00 00 	movabs $0x80291e,%r8
+  8024ea:	00 00 00 
+  8024ed:	41 ff d0             	call   *%r8
+
+00000000008024f0 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8024f0:	55                   	push   %rbp
+  8024f1:	48 89 e5             	mov    %rsp,%rbp
+  8024f4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8024f8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024fc:	48 b8 d9 16 80 00 00 	movabs $0x8016d9,%rax
+  802503:	00 00 00 
+  802506:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802508:	85 c0                	test   %eax,%eax
+  80250a:	78 35                	js     802541 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80250c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802510:	48 b8 5d 16 80 00 00 	movabs $0x80165d,%rax
+  802517:	00 00 00 
+  80251a:	ff d0                	call   *%rax
+  80251c:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80251f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802524:	be 00 10 00 00       	mov    $0x1000,%esi
+  802529:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80252d:	48 b8 7d 10 80 00 00 	movabs $0x80107d,%rax
+  802534:	00 00 00 
+  802537:	ff d0                	call   *%rax
+  802539:	85 c0                	test   %eax,%eax
+  80253b:	0f 94 c0             	sete   %al
+  80253e:	0f b6 c0             	movzbl %al,%eax
+}
+  802541:	c9                   	leave
+  802542:	c3                   	ret
+
+0000000000802543 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802543:	48 89 f8             	mov    %rdi,%rax
+  802546:	48 c1 e8 27          	shr    $0x27,%rax
+  80254a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802551:	01 00 00 
+  802554:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802558:	f6 c2 01             	test   $0x1,%dl
+  80255b:	74 6d                	je     8025ca <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80255d:	48 89 f8             	mov    %rdi,%rax
+  802560:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802564:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80256b:	01 00 00 
+  80256e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802572:	f6 c2 01             	test   $0x1,%dl
+  802575:	74 62                	je     8025d9 <get_uvpt_entry+0x96>
+  802577:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80257e:	01 00 00 
+  802581:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802585:	f6 c2 80             	test   $0x80,%dl
+  802588:	75 4f                	jne    8025d9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80258a:	48 89 f8             	mov    %rdi,%rax
+  80258d:	48 c1 e8 15          	shr    $0x15,%rax
+  802591:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802598:	01 00 00 
+  80259b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80259f:	f6 c2 01             	test   $0x1,%dl
+  8025a2:	74 44                	je     8025e8 <get_uvpt_entry+0xa5>
+  8025a4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025ab:	01 00 00 
+  8025ae:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025b2:	f6 c2 80             	test   $0x80,%dl
+  8025b5:	75 31                	jne    8025e8 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8025b7:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8025bb:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8025c2:	01 00 00 
+  8025c5:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8025c9:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8025ca:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8025d1:	01 00 00 
+  8025d4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025d8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025d9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8025e0:	01 00 00 
+  8025e3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025e7:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025e8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025ef:	01 00 00 
+  8025f2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025f6:	c3                   	ret
+
+00000000008025f7 <get_prot>:
+
+int
+get_prot(void *va) {
+  8025f7:	55                   	push   %rbp
+  8025f8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8025fb:	48 b8 43 25 80 00 00 	movabs $0x802543,%rax
+  802602:	00 00 00 
+  802605:	ff d0                	call   *%rax
+  802607:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80260a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80260f:	89 c1                	mov    %eax,%ecx
+  802611:	83 c9 04             	or     $0x4,%ecx
+  802614:	f6 c2 01             	test   $0x1,%dl
+  802617:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80261a:	89 c1                	mov    %eax,%ecx
+  80261c:	83 c9 02             	or     $0x2,%ecx
+  80261f:	f6 c2 02             	test   $0x2,%dl
+  802622:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802625:	89 c1                	mov    %eax,%ecx
+  802627:	83 c9 01             	or     $0x1,%ecx
+  80262a:	48 85 d2             	test   %rdx,%rdx
+  80262d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802630:	89 c1                	mov    %eax,%ecx
+  802632:	83 c9 40             	or     $0x40,%ecx
+  802635:	f6 c6 04             	test   $0x4,%dh
+  802638:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80263b:	5d                   	pop    %rbp
+  80263c:	c3                   	ret
+
+000000000080263d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80263d:	55                   	push   %rbp
+  80263e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802641:	48 b8 43 25 80 00 00 	movabs $0x802543,%rax
+  802648:	00 00 00 
+  80264b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80264d:	48 c1 e8 06          	shr    $0x6,%rax
+  802651:	83 e0 01             	and    $0x1,%eax
+}
+  802654:	5d                   	pop    %rbp
+  802655:	c3                   	ret
+
+0000000000802656 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802656:	55                   	push   %rbp
+  802657:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80265a:	48 b8 43 25 80 00 00 	movabs $0x802543,%rax
+  802661:	00 00 00 
+  802664:	ff d0                	call   *%rax
+  802666:	83 e0 01             	and    $0x1,%eax
+}
+  802669:	5d                   	pop    %rbp
+  80266a:	c3                   	ret
+
+000000000080266b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80266b:	55                   	push   %rbp
+  80266c:	48 89 e5             	mov    %rsp,%rbp
+  80266f:	41 57                	push   %r15
+  802671:	41 56                	push   %r14
+  802673:	41 55                	push   %r13
+  802675:	41 54                	push   %r12
+  802677:	53                   	push   %rbx
+  802678:	48 83 ec 18          	sub    $0x18,%rsp
+  80267c:	49 89 ff             	mov    %rdi,%r15
+  80267f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802683:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802688:	49 bc 56 26 80 00 00 	movabs $0x802656,%r12
+  80268f:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802692:	49 be f7 25 80 00 00 	movabs $0x8025f7,%r14
+  802699:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80269c:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  8026a3:	00 00 00 
+  8026a6:	eb 0c                	jmp    8026b4 <foreach_shared_region+0x49>
+  8026a8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8026af:	4c 39 eb             	cmp    %r13,%rbx
+  8026b2:	74 38                	je     8026ec <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  8026b4:	48 89 df             	mov    %rbx,%rdi
+  8026b7:	41 ff d4             	call   *%r12
+  8026ba:	84 c0                	test   %al,%al
+  8026bc:	74 ea                	je     8026a8 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  8026be:	48 89 df             	mov    %rbx,%rdi
+  8026c1:	41 ff d6             	call   *%r14
+  8026c4:	a8 40                	test   $0x40,%al
+  8026c6:	74 e0                	je     8026a8 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8026c8:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8026cf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8026d3:	48 89 df             	mov    %rbx,%rdi
+  8026d6:	41 ff d7             	call   *%r15
+        if (err)
+  8026d9:	85 c0                	test   %eax,%eax
+  8026db:	74 cb                	je     8026a8 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8026dd:	48 83 c4 18          	add    $0x18,%rsp
+  8026e1:	5b                   	pop    %rbx
+  8026e2:	41 5c                	pop    %r12
+  8026e4:	41 5d                	pop    %r13
+  8026e6:	41 5e                	pop    %r14
+  8026e8:	41 5f                	pop    %r15
+  8026ea:	5d                   	pop    %rbp
+  8026eb:	c3                   	ret
+    return 0;
+  8026ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f1:	eb ea                	jmp    8026dd <foreach_shared_region+0x72>
+
+00000000008026f3 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8026f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f8:	c3                   	ret
+
+00000000008026f9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8026f9:	55                   	push   %rbp
+  8026fa:	48 89 e5             	mov    %rsp,%rbp
+  8026fd:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802700:	48 be b4 31 80 00 00 	movabs $0x8031b4,%rsi
+  802707:	00 00 00 
+  80270a:	48 b8 f9 0a 80 00 00 	movabs $0x800af9,%rax
+  802711:	00 00 00 
+  802714:	ff d0                	call   *%rax
+    return 0;
+}
+  802716:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271b:	5d                   	pop    %rbp
+  80271c:	c3                   	ret
+
+000000000080271d <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80271d:	55                   	push   %rbp
+  80271e:	48 89 e5             	mov    %rsp,%rbp
+  802721:	41 57                	push   %r15
+  802723:	41 56                	push   %r14
+  802725:	41 55                	push   %r13
+  802727:	41 54                	push   %r12
+  802729:	53                   	push   %rbx
+  80272a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802731:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802738:	48 85 d2             	test   %rdx,%rdx
+  80273b:	74 7a                	je     8027b7 <devcons_write+0x9a>
+  80273d:	49 89 d6             	mov    %rdx,%r14
+  802740:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802746:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80274b:	49 bf f3 0c 80 00 00 	movabs $0x800cf3,%r15
+  802752:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802755:	4c 89 f3             	mov    %r14,%rbx
+  802758:	48 29 f3             	sub    %rsi,%rbx
+  80275b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802760:	48 39 c3             	cmp    %rax,%rbx
+  802763:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802767:	4c 63 eb             	movslq %ebx,%r13
+  80276a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802771:	48 01 c6             	add    %rax,%rsi
+  802774:	4c 89 ea             	mov    %r13,%rdx
+  802777:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80277e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802781:	4c 89 ee             	mov    %r13,%rsi
+  802784:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80278b:	48 b8 20 0f 80 00 00 	movabs $0x800f20,%rax
+  802792:	00 00 00 
+  802795:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802797:	41 01 dc             	add    %ebx,%r12d
+  80279a:	49 63 f4             	movslq %r12d,%rsi
+  80279d:	4c 39 f6             	cmp    %r14,%rsi
+  8027a0:	72 b3                	jb     802755 <devcons_write+0x38>
+    return res;
+  8027a2:	49 63 c4             	movslq %r12d,%rax
+}
+  8027a5:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8027ac:	5b                   	pop    %rbx
+  8027ad:	41 5c                	pop    %r12
+  8027af:	41 5d                	pop    %r13
+  8027b1:	41 5e                	pop    %r14
+  8027b3:	41 5f                	pop    %r15
+  8027b5:	5d                   	pop    %rbp
+  8027b6:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8027b7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8027bd:	eb e3                	jmp    8027a2 <devcons_write+0x85>
+
+00000000008027bf <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8027bf:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8027c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027c7:	48 85 c0             	test   %rax,%rax
+  8027ca:	74 55                	je     802821 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8027cc:	55                   	push   %rbp
+  8027cd:	48 89 e5             	mov    %rsp,%rbp
+  8027d0:	41 55                	push   %r13
+  8027d2:	41 54                	push   %r12
+  8027d4:	53                   	push   %rbx
+  8027d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8027d9:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8027dc:	48 bb 4d 0f 80 00 00 	movabs $0x800f4d,%rbx
+  8027e3:	00 00 00 
+  8027e6:	49 bc 1a 10 80 00 00 	movabs $0x80101a,%r12
+  8027ed:	00 00 00 
+  8027f0:	eb 03                	jmp    8027f5 <devcons_read+0x36>
+  8027f2:	41 ff d4             	call   *%r12
+  8027f5:	ff d3                	call   *%rbx
+  8027f7:	85 c0                	test   %eax,%eax
+  8027f9:	74 f7                	je     8027f2 <devcons_read+0x33>
+    if (c < 0) return c;
+  8027fb:	48 63 d0             	movslq %eax,%rdx
+  8027fe:	78 13                	js     802813 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802800:	ba 00 00 00 00       	mov    $0x0,%edx
+  802805:	83 f8 04             	cmp    $0x4,%eax
+  802808:	74 09                	je     802813 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80280a:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80280e:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802813:	48 89 d0             	mov    %rdx,%rax
+  802816:	48 83 c4 08          	add    $0x8,%rsp
+  80281a:	5b                   	pop    %rbx
+  80281b:	41 5c                	pop    %r12
+  80281d:	41 5d                	pop    %r13
+  80281f:	5d                   	pop    %rbp
+  802820:	c3                   	ret
+  802821:	48 89 d0             	mov    %rdx,%rax
+  802824:	c3                   	ret
+
+0000000000802825 <cputchar>:
+cputchar(int ch) {
+  802825:	55                   	push   %rbp
+  802826:	48 89 e5             	mov    %rsp,%rbp
+  802829:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80282d:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802831:	be 01 00 00 00       	mov    $0x1,%esi
+  802836:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80283a:	48 b8 20 0f 80 00 00 	movabs $0x800f20,%rax
+  802841:	00 00 00 
+  802844:	ff d0                	call   *%rax
+}
+  802846:	c9                   	leave
+  802847:	c3                   	ret
+
+0000000000802848 <getchar>:
+getchar(void) {
+  802848:	55                   	push   %rbp
+  802849:	48 89 e5             	mov    %rsp,%rbp
+  80284c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802850:	ba 01 00 00 00       	mov    $0x1,%edx
+  802855:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802859:	bf 00 00 00 00       	mov    $0x0,%edi
+  80285e:	48 b8 bc 19 80 00 00 	movabs $0x8019bc,%rax
+  802865:	00 00 00 
+  802868:	ff d0                	call   *%rax
+  80286a:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80286c:	85 c0                	test   %eax,%eax
+  80286e:	78 06                	js     802876 <getchar+0x2e>
+  802870:	74 08                	je     80287a <getchar+0x32>
+  802872:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802876:	89 d0                	mov    %edx,%eax
+  802878:	c9                   	leave
+  802879:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80287a:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80287f:	eb f5                	jmp    802876 <getchar+0x2e>
+
+0000000000802881 <iscons>:
+iscons(int fdnum) {
+  802881:	55                   	push   %rbp
+  802882:	48 89 e5             	mov    %rsp,%rbp
+  802885:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802889:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80288d:	48 b8 d9 16 80 00 00 	movabs $0x8016d9,%rax
+  802894:	00 00 00 
+  802897:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802899:	85 c0                	test   %eax,%eax
+  80289b:	78 18                	js     8028b5 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80289d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028a1:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  8028a8:	00 00 00 
+  8028ab:	8b 00                	mov    (%rax),%eax
+  8028ad:	39 02                	cmp    %eax,(%rdx)
+  8028af:	0f 94 c0             	sete   %al
+  8028b2:	0f b6 c0             	movzbl %al,%eax
+}
+  8028b5:	c9                   	leave
+  8028b6:	c3                   	ret
+
+00000000008028b7 <opencons>:
+opencons(void) {
+  8028b7:	55                   	push   %rbp
+  8028b8:	48 89 e5             	mov    %rsp,%rbp
+  8028bb:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8028bf:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8028c3:	48 b8 79 16 80 00 00 	movabs $0x801679,%rax
+  8028ca:	00 00 00 
+  8028cd:	ff d0                	call   *%rax
+  8028cf:	85 c0                	test   %eax,%eax
+  8028d1:	78 49                	js     80291c <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8028d3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8028d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028dd:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8028e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028e6:	48 b8 a9 10 80 00 00 	movabs $0x8010a9,%rax
+  8028ed:	00 00 00 
+  8028f0:	ff d0                	call   *%rax
+  8028f2:	85 c0                	test   %eax,%eax
+  8028f4:	78 26                	js     80291c <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8028f6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028fa:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802901:	00 00 
+  802903:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802905:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802909:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802910:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  802917:	00 00 00 
+  80291a:	ff d0                	call   *%rax
+}
+  80291c:	c9                   	leave
+  80291d:	c3                   	ret
+
+000000000080291e <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80291e:	55                   	push   %rbp
+  80291f:	48 89 e5             	mov    %rsp,%rbp
+  802922:	41 56                	push   %r14
+  802924:	41 55                	push   %r13
+  802926:	41 54                	push   %r12
+  802928:	53                   	push   %rbx
+  802929:	48 83 ec 50          	sub    $0x50,%rsp
+  80292d:	49 89 fc             	mov    %rdi,%r12
+  802930:	41 89 f5             	mov    %esi,%r13d
+  802933:	48 89 d3             	mov    %rdx,%rbx
+  802936:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80293a:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80293e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802942:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802949:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80294d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802951:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802955:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802959:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802960:	00 00 00 
+  802963:	4c 8b 30             	mov    (%rax),%r14
+  802966:	48 b8 e9 0f 80 00 00 	movabs $0x800fe9,%rax
+  80296d:	00 00 00 
+  802970:	ff d0                	call   *%rax
+  802972:	89 c6                	mov    %eax,%esi
+  802974:	45 89 e8             	mov    %r13d,%r8d
+  802977:	4c 89 e1             	mov    %r12,%rcx
+  80297a:	4c 89 f2             	mov    %r14,%rdx
+  80297d:	48 bf c0 31 80 00 00 	movabs $0x8031c0,%rdi
+  802984:	00 00 00 
+  802987:	b8 00 00 00 00       	mov    $0x0,%eax
+  80298c:	49 bc d4 01 80 00 00 	movabs $0x8001d4,%r12
+  802993:	00 00 00 
+  802996:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802999:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80299d:	48 89 df             	mov    %rbx,%rdi
+  8029a0:	48 b8 70 01 80 00 00 	movabs $0x800170,%rax
+  8029a7:	00 00 00 
+  8029aa:	ff d0                	call   *%rax
+    cprintf("\n");
+  8029ac:	48 bf 4a 2b 80 00 00 	movabs $0x802b4a,%rdi
+  8029b3:	00 00 00 
+  8029b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029bb:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8029be:	cc                   	int3
+  8029bf:	eb fd                	jmp    8029be <_panic+0xa0>
+
+00000000008029c1 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8029c1:	55                   	push   %rbp
+  8029c2:	48 89 e5             	mov    %rsp,%rbp
+  8029c5:	41 54                	push   %r12
+  8029c7:	53                   	push   %rbx
+  8029c8:	48 89 fb             	mov    %rdi,%rbx
+  8029cb:	48 89 f7             	mov    %rsi,%rdi
+  8029ce:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8029d1:	48 85 f6             	test   %rsi,%rsi
+  8029d4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029db:	00 00 00 
+  8029de:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8029e2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029e7:	48 b8 13 14 80 00 00 	movabs $0x801413,%rax
+  8029ee:	00 00 00 
+  8029f1:	ff d0                	call   *%rax
+    if (res < 0) {
+  8029f3:	85 c0                	test   %eax,%eax
+  8029f5:	78 45                	js     802a3c <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8029f7:	48 85 db             	test   %rbx,%rbx
+  8029fa:	74 12                	je     802a0e <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8029fc:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a03:	00 00 00 
+  802a06:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802a0c:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802a0e:	4d 85 e4             	test   %r12,%r12
+  802a11:	74 14                	je     802a27 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802a13:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a1a:	00 00 00 
+  802a1d:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802a23:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802a27:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a2e:	00 00 00 
+  802a31:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802a37:	5b                   	pop    %rbx
+  802a38:	41 5c                	pop    %r12
+  802a3a:	5d                   	pop    %rbp
+  802a3b:	c3                   	ret
+        if (from_env_store)
+  802a3c:	48 85 db             	test   %rbx,%rbx
+  802a3f:	74 06                	je     802a47 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802a41:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802a47:	4d 85 e4             	test   %r12,%r12
+  802a4a:	74 eb                	je     802a37 <ipc_recv+0x76>
+            *perm_store = 0;
+  802a4c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802a53:	00 
+  802a54:	eb e1                	jmp    802a37 <ipc_recv+0x76>
+
+0000000000802a56 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802a56:	55                   	push   %rbp
+  802a57:	48 89 e5             	mov    %rsp,%rbp
+  802a5a:	41 57                	push   %r15
+  802a5c:	41 56                	push   %r14
+  802a5e:	41 55                	push   %r13
+  802a60:	41 54                	push   %r12
+  802a62:	53                   	push   %rbx
+  802a63:	48 83 ec 18          	sub    $0x18,%rsp
+  802a67:	41 89 fd             	mov    %edi,%r13d
+  802a6a:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802a6d:	48 89 d3             	mov    %rdx,%rbx
+  802a70:	49 89 cc             	mov    %rcx,%r12
+  802a73:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a77:	48 85 d2             	test   %rdx,%rdx
+  802a7a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a81:	00 00 00 
+  802a84:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a88:	49 be e7 13 80 00 00 	movabs $0x8013e7,%r14
+  802a8f:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802a92:	49 bf 1a 10 80 00 00 	movabs $0x80101a,%r15
+  802a99:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a9c:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802a9f:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802aa3:	4c 89 e1             	mov    %r12,%rcx
+  802aa6:	48 89 da             	mov    %rbx,%rdx
+  802aa9:	44 89 ef             	mov    %r13d,%edi
+  802aac:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802aaf:	85 c0                	test   %eax,%eax
+  802ab1:	74 34                	je     802ae7 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802ab3:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802ab6:	75 05                	jne    802abd <ipc_send+0x67>
+        sys_yield();
+  802ab8:	41 ff d7             	call   *%r15
+    while (true) {
+  802abb:	eb df                	jmp    802a9c <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802abd:	48 ba e3 31 80 00 00 	movabs $0x8031e3,%rdx
+  802ac4:	00 00 00 
+  802ac7:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802acc:	48 bf fc 31 80 00 00 	movabs $0x8031fc,%rdi
+  802ad3:	00 00 00 
+  802ad6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802adb:	48 b9 1e 29 80 00 00 	movabs $0x80291e,%rcx
+  802ae2:	00 00 00 
+  802ae5:	ff d1                	call   *%rcx
+    }
+}
+  802ae7:	48 83 c4 18          	add    $0x18,%rsp
+  802aeb:	5b                   	pop    %rbx
+  802aec:	41 5c                	pop    %r12
+  802aee:	41 5d                	pop    %r13
+  802af0:	41 5e                	pop    %r14
+  802af2:	41 5f                	pop    %r15
+  802af4:	5d                   	pop    %rbp
+  802af5:	c3                   	ret
+
+0000000000802af6 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802af6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802afb:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802b02:	00 00 00 
+  802b05:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802b0c:	48 01 ca             	add    %rcx,%rdx
+  802b0f:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802b15:	39 fa                	cmp    %edi,%edx
+  802b17:	74 12                	je     802b2b <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802b19:	48 83 c0 01          	add    $0x1,%rax
+  802b1d:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b23:	75 e0                	jne    802b05 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802b25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b2a:	c3                   	ret
+            return envs[i].env_id;
+  802b2b:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802b32:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b39:	00 00 00 
+  802b3c:	48 01 d0             	add    %rdx,%rax
+  802b3f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b45:	c3                   	ret
+  802b46:	66 90                	xchg   %ax,%ax
+
+0000000000802b48 <__rodata_start>:
+  802b48:	25 64 0a 00 3c       	and    $0x3c000a64,%eax
+  802b4d:	75 6e                	jne    802bbd <__rodata_start+0x75>
+  802b4f:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b53:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b54:	3e 00 30             	ds add %dh,(%rax)
+  802b57:	31 32                	xor    %esi,(%rdx)
+  802b59:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802b60:	41                   	rex.B
+  802b61:	42                   	rex.X
+  802b62:	43                   	rex.XB
+  802b63:	44                   	rex.R
+  802b64:	45                   	rex.RB
+  802b65:	46 00 30             	rex.RX add %r14b,(%rax)
+  802b68:	31 32                	xor    %esi,(%rdx)
+  802b6a:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802b71:	61                   	(bad)
+  802b72:	62 63 64 65 66       	(bad)
+  802b77:	00 28                	add    %ch,(%rax)
+  802b79:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b7a:	75 6c                	jne    802be8 <__rodata_start+0xa0>
+  802b7c:	6c                   	insb   (%dx),%es:(%rdi)
+  802b7d:	29 00                	sub    %eax,(%rax)
+  802b7f:	65 72 72             	gs jb  802bf4 <__rodata_start+0xac>
+  802b82:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802b83:	72 20                	jb     802ba5 <__rodata_start+0x5d>
+  802b85:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802b8a:	73 70                	jae    802bfc <__rodata_start+0xb4>
+  802b8c:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802b90:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802b97:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802b98:	72 00                	jb     802b9a <__rodata_start+0x52>
+  802b9a:	62 61 64 20 65       	(bad)
+  802b9f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ba0:	76 69                	jbe    802c0b <__rodata_start+0xc3>
+  802ba2:	72 6f                	jb     802c13 <__rodata_start+0xcb>
+  802ba4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ba5:	6d                   	insl   (%dx),%es:(%rdi)
+  802ba6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802ba8:	74 00                	je     802baa <__rodata_start+0x62>
+  802baa:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802bb1:	20 70 61             	and    %dh,0x61(%rax)
+  802bb4:	72 61                	jb     802c17 <__rodata_start+0xcf>
+  802bb6:	6d                   	insl   (%dx),%es:(%rdi)
+  802bb7:	65 74 65             	gs je  802c1f <__rodata_start+0xd7>
+  802bba:	72 00                	jb     802bbc <__rodata_start+0x74>
+  802bbc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bbd:	75 74                	jne    802c33 <__rodata_start+0xeb>
+  802bbf:	20 6f 66             	and    %ch,0x66(%rdi)
+  802bc2:	20 6d 65             	and    %ch,0x65(%rbp)
+  802bc5:	6d                   	insl   (%dx),%es:(%rdi)
+  802bc6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bc7:	72 79                	jb     802c42 <__rodata_start+0xfa>
+  802bc9:	00 6f 75             	add    %ch,0x75(%rdi)
+  802bcc:	74 20                	je     802bee <__rodata_start+0xa6>
+  802bce:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bcf:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802bd3:	76 69                	jbe    802c3e <__rodata_start+0xf6>
+  802bd5:	72 6f                	jb     802c46 <__rodata_start+0xfe>
+  802bd7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bd8:	6d                   	insl   (%dx),%es:(%rdi)
+  802bd9:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802bdb:	74 73                	je     802c50 <__rodata_start+0x108>
+  802bdd:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802be0:	72 72                	jb     802c54 <__rodata_start+0x10c>
+  802be2:	75 70                	jne    802c54 <__rodata_start+0x10c>
+  802be4:	74 65                	je     802c4b <__rodata_start+0x103>
+  802be6:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802beb:	75 67                	jne    802c54 <__rodata_start+0x10c>
+  802bed:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802bf0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802bf2:	00 73 65             	add    %dh,0x65(%rbx)
+  802bf5:	67 6d                	insl   (%dx),%es:(%edi)
+  802bf7:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802bf9:	74 61                	je     802c5c <__rodata_start+0x114>
+  802bfb:	74 69                	je     802c66 <__rodata_start+0x11e>
+  802bfd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bfe:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bff:	20 66 61             	and    %ah,0x61(%rsi)
+  802c02:	75 6c                	jne    802c70 <__rodata_start+0x128>
+  802c04:	74 00                	je     802c06 <__rodata_start+0xbe>
+  802c06:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802c0d:	20 45 4c             	and    %al,0x4c(%rbp)
+  802c10:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802c14:	61                   	(bad)
+  802c15:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802c1a:	20 73 75             	and    %dh,0x75(%rbx)
+  802c1d:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802c20:	73 79                	jae    802c9b <__rodata_start+0x153>
+  802c22:	73 74                	jae    802c98 <__rodata_start+0x150>
+  802c24:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802c26:	20 63 61             	and    %ah,0x61(%rbx)
+  802c29:	6c                   	insb   (%dx),%es:(%rdi)
+  802c2a:	6c                   	insb   (%dx),%es:(%rdi)
+  802c2b:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802c2e:	74 72                	je     802ca2 <__rodata_start+0x15a>
+  802c30:	79 20                	jns    802c52 <__rodata_start+0x10a>
+  802c32:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c33:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c34:	74 20                	je     802c56 <__rodata_start+0x10e>
+  802c36:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802c38:	75 6e                	jne    802ca8 <__rodata_start+0x160>
+  802c3a:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802c3e:	76 20                	jbe    802c60 <__rodata_start+0x118>
+  802c40:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802c47:	72 65                	jb     802cae <__rodata_start+0x166>
+  802c49:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802c4c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c4d:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802c51:	65 78 70             	gs js  802cc4 <__rodata_start+0x17c>
+  802c54:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802c59:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802c5c:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802c60:	20 66 69             	and    %ah,0x69(%rsi)
+  802c63:	6c                   	insb   (%dx),%es:(%rdi)
+  802c64:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802c68:	20 66 72             	and    %ah,0x72(%rsi)
+  802c6b:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802c70:	61                   	(bad)
+  802c71:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802c74:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c75:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c76:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802c7a:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802c7d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c7e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c7f:	20 6d 61             	and    %ch,0x61(%rbp)
+  802c82:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c83:	79 20                	jns    802ca5 <__rodata_start+0x15d>
+  802c85:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802c8c:	72 65                	jb     802cf3 <__rodata_start+0x1ab>
+  802c8e:	20 6f 70             	and    %ch,0x70(%rdi)
+  802c91:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802c93:	00 66 69             	add    %ah,0x69(%rsi)
+  802c96:	6c                   	insb   (%dx),%es:(%rdi)
+  802c97:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802c9b:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802c9e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c9f:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802ca2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ca3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ca4:	74 20                	je     802cc6 <__rodata_start+0x17e>
+  802ca6:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802ca8:	75 6e                	jne    802d18 <__rodata_start+0x1d0>
+  802caa:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802cae:	76 61                	jbe    802d11 <__rodata_start+0x1c9>
+  802cb0:	6c                   	insb   (%dx),%es:(%rdi)
+  802cb1:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802cb8:	00 
+  802cb9:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802cc0:	72 65                	jb     802d27 <__rodata_start+0x1df>
+  802cc2:	61                   	(bad)
+  802cc3:	64 79 20             	fs jns 802ce6 <__rodata_start+0x19e>
+  802cc6:	65 78 69             	gs js  802d32 <__rodata_start+0x1ea>
+  802cc9:	73 74                	jae    802d3f <__rodata_start+0x1f7>
+  802ccb:	73 00                	jae    802ccd <__rodata_start+0x185>
+  802ccd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cce:	70 65                	jo     802d35 <__rodata_start+0x1ed>
+  802cd0:	72 61                	jb     802d33 <__rodata_start+0x1eb>
+  802cd2:	74 69                	je     802d3d <__rodata_start+0x1f5>
+  802cd4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cd5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cd6:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802cd9:	74 20                	je     802cfb <__rodata_start+0x1b3>
+  802cdb:	73 75                	jae    802d52 <__rodata_start+0x20a>
+  802cdd:	70 70                	jo     802d4f <__rodata_start+0x207>
+  802cdf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ce0:	72 74                	jb     802d56 <__rodata_start+0x20e>
+  802ce2:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802ce7:	65 72 61             	gs jb  802d4b <__rodata_start+0x203>
+  802cea:	74 69                	je     802d55 <__rodata_start+0x20d>
+  802cec:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ced:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cee:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802cf1:	74 20                	je     802d13 <__rodata_start+0x1cb>
+  802cf3:	70 65                	jo     802d5a <__rodata_start+0x212>
+  802cf5:	72 6d                	jb     802d64 <__rodata_start+0x21c>
+  802cf7:	69 74 74 65 64 00 0f 	imul   $0x1f0f0064,0x65(%rsp,%rsi,2),%esi
+  802cfe:	1f 
+  802cff:	00 c1                	add    %al,%cl
+  802d01:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d07:	00 02                	add    %al,(%rdx)
+  802d09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802d0f:	00 f2                	add    %dh,%dl
+  802d11:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d17:	00 02                	add    %al,(%rdx)
+  802d19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802d1f:	00 02                	add    %al,(%rdx)
+  802d21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802d27:	00 02                	add    %al,(%rdx)
+  802d29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802d2f:	00 02                	add    %al,(%rdx)
+  802d31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802d37:	00 e0                	add    %ah,%al
+  802d39:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d3f:	00 02                	add    %al,(%rdx)
+  802d41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802d47:	00 02                	add    %al,(%rdx)
+  802d49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802d4f:	00 d4                	add    %dl,%ah
+  802d51:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d57:	00 4e 04             	add    %cl,0x4(%rsi)
+  802d5a:	80 00 00             	addb   $0x0,(%rax)
+  802d5d:	00 00                	add    %al,(%rax)
+  802d5f:	00 02                	add    %al,(%rdx)
+  802d61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802d67:	00 d4                	add    %dl,%ah
+  802d69:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d6f:	00 1a                	add    %bl,(%rdx)
+  802d71:	04 80                	add    $0x80,%al
+  802d73:	00 00                	add    %al,(%rax)
+  802d75:	00 00                	add    %al,(%rax)
+  802d77:	00 1a                	add    %bl,(%rdx)
+  802d79:	04 80                	add    $0x80,%al
+  802d7b:	00 00                	add    %al,(%rax)
+  802d7d:	00 00                	add    %al,(%rax)
+  802d7f:	00 1a                	add    %bl,(%rdx)
+  802d81:	04 80                	add    $0x80,%al
+  802d83:	00 00                	add    %al,(%rax)
+  802d85:	00 00                	add    %al,(%rax)
+  802d87:	00 1a                	add    %bl,(%rdx)
+  802d89:	04 80                	add    $0x80,%al
+  802d8b:	00 00                	add    %al,(%rax)
+  802d8d:	00 00                	add    %al,(%rax)
+  802d8f:	00 1a                	add    %bl,(%rdx)
+  802d91:	04 80                	add    $0x80,%al
+  802d93:	00 00                	add    %al,(%rax)
+  802d95:	00 00                	add    %al,(%rax)
+  802d97:	00 1a                	add    %bl,(%rdx)
+  802d99:	04 80                	add    $0x80,%al
+  802d9b:	00 00                	add    %al,(%rax)
+  802d9d:	00 00                	add    %al,(%rax)
+  802d9f:	00 1a                	add    %bl,(%rdx)
+  802da1:	04 80                	add    $0x80,%al
+  802da3:	00 00                	add    %al,(%rax)
+  802da5:	00 00                	add    %al,(%rax)
+  802da7:	00 1a                	add    %bl,(%rdx)
+  802da9:	04 80                	add    $0x80,%al
+  802dab:	00 00                	add    %al,(%rax)
+  802dad:	00 00                	add    %al,(%rax)
+  802daf:	00 1a                	add    %bl,(%rdx)
+  802db1:	04 80                	add    $0x80,%al
+  802db3:	00 00                	add    %al,(%rax)
+  802db5:	00 00                	add    %al,(%rax)
+  802db7:	00 02                	add    %al,(%rdx)
+  802db9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802dbf:	00 02                	add    %al,(%rdx)
+  802dc1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802dc7:	00 02                	add    %al,(%rdx)
+  802dc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802dcf:	00 02                	add    %al,(%rdx)
+  802dd1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802dd7:	00 02                	add    %al,(%rdx)
+  802dd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ddf:	00 02                	add    %al,(%rdx)
+  802de1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802de7:	00 02                	add    %al,(%rdx)
+  802de9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802def:	00 02                	add    %al,(%rdx)
+  802df1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802df7:	00 02                	add    %al,(%rdx)
+  802df9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802dff:	00 02                	add    %al,(%rdx)
+  802e01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e07:	00 02                	add    %al,(%rdx)
+  802e09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e0f:	00 02                	add    %al,(%rdx)
+  802e11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e17:	00 02                	add    %al,(%rdx)
+  802e19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e1f:	00 02                	add    %al,(%rdx)
+  802e21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e27:	00 02                	add    %al,(%rdx)
+  802e29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e2f:	00 02                	add    %al,(%rdx)
+  802e31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e37:	00 02                	add    %al,(%rdx)
+  802e39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e3f:	00 02                	add    %al,(%rdx)
+  802e41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e47:	00 02                	add    %al,(%rdx)
+  802e49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e4f:	00 02                	add    %al,(%rdx)
+  802e51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e57:	00 02                	add    %al,(%rdx)
+  802e59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e5f:	00 02                	add    %al,(%rdx)
+  802e61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e67:	00 02                	add    %al,(%rdx)
+  802e69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e6f:	00 02                	add    %al,(%rdx)
+  802e71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e77:	00 02                	add    %al,(%rdx)
+  802e79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e7f:	00 02                	add    %al,(%rdx)
+  802e81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e87:	00 02                	add    %al,(%rdx)
+  802e89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e8f:	00 02                	add    %al,(%rdx)
+  802e91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e97:	00 02                	add    %al,(%rdx)
+  802e99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e9f:	00 02                	add    %al,(%rdx)
+  802ea1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ea7:	00 25 09 80 00 00    	add    %ah,0x8009(%rip)        # 80aeb6 <__bss_end+0x2eb6>
+  802ead:	00 00                	add    %al,(%rax)
+  802eaf:	00 02                	add    %al,(%rdx)
+  802eb1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802eb7:	00 02                	add    %al,(%rdx)
+  802eb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ebf:	00 02                	add    %al,(%rdx)
+  802ec1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ec7:	00 02                	add    %al,(%rdx)
+  802ec9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ecf:	00 02                	add    %al,(%rdx)
+  802ed1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ed7:	00 02                	add    %al,(%rdx)
+  802ed9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802edf:	00 02                	add    %al,(%rdx)
+  802ee1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ee7:	00 02                	add    %al,(%rdx)
+  802ee9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802eef:	00 02                	add    %al,(%rdx)
+  802ef1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ef7:	00 02                	add    %al,(%rdx)
+  802ef9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802eff:	00 71 04             	add    %dh,0x4(%rcx)
+  802f02:	80 00 00             	addb   $0x0,(%rax)
+  802f05:	00 00                	add    %al,(%rax)
+  802f07:	00 40 06             	add    %al,0x6(%rax)
+  802f0a:	80 00 00             	addb   $0x0,(%rax)
+  802f0d:	00 00                	add    %al,(%rax)
+  802f0f:	00 02                	add    %al,(%rdx)
+  802f11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f17:	00 02                	add    %al,(%rdx)
+  802f19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f1f:	00 02                	add    %al,(%rdx)
+  802f21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f27:	00 02                	add    %al,(%rdx)
+  802f29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f2f:	00 a0 04 80 00 00    	add    %ah,0x8004(%rax)
+  802f35:	00 00                	add    %al,(%rax)
+  802f37:	00 02                	add    %al,(%rdx)
+  802f39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f3f:	00 02                	add    %al,(%rdx)
+  802f41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f47:	00 66 04             	add    %ah,0x4(%rsi)
+  802f4a:	80 00 00             	addb   $0x0,(%rax)
+  802f4d:	00 00                	add    %al,(%rax)
+  802f4f:	00 02                	add    %al,(%rdx)
+  802f51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f57:	00 02                	add    %al,(%rdx)
+  802f59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f5f:	00 e8                	add    %ch,%al
+  802f61:	07                   	(bad)
+  802f62:	80 00 00             	addb   $0x0,(%rax)
+  802f65:	00 00                	add    %al,(%rax)
+  802f67:	00 b2 08 80 00 00    	add    %dh,0x8008(%rdx)
+  802f6d:	00 00                	add    %al,(%rax)
+  802f6f:	00 02                	add    %al,(%rdx)
+  802f71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f77:	00 02                	add    %al,(%rdx)
+  802f79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f7f:	00 37                	add    %dh,(%rdi)
+  802f81:	05 80 00 00 00       	add    $0x80,%eax
+  802f86:	00 00                	add    %al,(%rax)
+  802f88:	02 0a                	add    (%rdx),%cl
+  802f8a:	80 00 00             	addb   $0x0,(%rax)
+  802f8d:	00 00                	add    %al,(%rax)
+  802f8f:	00 14 07             	add    %dl,(%rdi,%rax,1)
+  802f92:	80 00 00             	addb   $0x0,(%rax)
+  802f95:	00 00                	add    %al,(%rax)
+  802f97:	00 02                	add    %al,(%rdx)
+  802f99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f9f:	00 02                	add    %al,(%rdx)
+  802fa1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fa7:	00 25 09 80 00 00    	add    %ah,0x8009(%rip)        # 80afb6 <__bss_end+0x2fb6>
+  802fad:	00 00                	add    %al,(%rax)
+  802faf:	00 02                	add    %al,(%rdx)
+  802fb1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fb7:	00 ca                	add    %cl,%dl
+  802fb9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000802fc0 <error_string>:
+	...
+  802fc8:	88 2b 80 00 00 00 00 00 9a 2b 80 00 00 00 00 00     .+.......+......
+  802fd8:	aa 2b 80 00 00 00 00 00 bc 2b 80 00 00 00 00 00     .+.......+......
+  802fe8:	ca 2b 80 00 00 00 00 00 de 2b 80 00 00 00 00 00     .+.......+......
+  802ff8:	f3 2b 80 00 00 00 00 00 06 2c 80 00 00 00 00 00     .+.......,......
+  803008:	18 2c 80 00 00 00 00 00 2c 2c 80 00 00 00 00 00     .,......,,......
+  803018:	3c 2c 80 00 00 00 00 00 4f 2c 80 00 00 00 00 00     <,......O,......
+  803028:	66 2c 80 00 00 00 00 00 7c 2c 80 00 00 00 00 00     f,......|,......
+  803038:	94 2c 80 00 00 00 00 00 ac 2c 80 00 00 00 00 00     .,.......,......
+  803048:	b9 2c 80 00 00 00 00 00 70 30 80 00 00 00 00 00     .,......p0......
+  803058:	cd 2c 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .,..............
+  803068:	e5 2c 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .,......file is 
+  803078:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803088:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803098:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8030a8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8030b8:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  8030c8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8030d8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8030e8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8030f8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803108:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803118:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803128:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803138:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803140 <devtab>:
+  803140:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803150:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803160:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803170:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803180:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803190:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8031a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8031b0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8031c0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8031d0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8031e0:	3a 20 00 69 70 63 5f 73 65 6e 64 3a 20 66 61 69     : .ipc_send: fai
+  8031f0:	6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62 2f     led to send.lib/
+  803200:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803210:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803220:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803230:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803240:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803250:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803260:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803270:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803280:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803290:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8032c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803300:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803310:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803320:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803330:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803340:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803350:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803360:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803370:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803380:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803390:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803400:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803410:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803420:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803430:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803440:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803450:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803460:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803470:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803480:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803490:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803500:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803510:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803520:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803530:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803540:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803550:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803560:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803570:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803580:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803590:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803600:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803610:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803620:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803630:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803640:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803650:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803660:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803670:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803680:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803690:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803700:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
@@ -0,0 +1,5382 @@
+
+obj/user/breakpoint:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 04 00 00 00       	call   800027 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    asm volatile("int $3");
+  800025:	cc                   	int3
+}
+  800026:	c3                   	ret
+
+0000000000800027 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800027:	55                   	push   %rbp
+  800028:	48 89 e5             	mov    %rsp,%rbp
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	41 89 fd             	mov    %edi,%r13d
+  800035:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800038:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80003f:	00 00 00 
+  800042:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800049:	00 00 00 
+  80004c:	48 39 c2             	cmp    %rax,%rdx
+  80004f:	73 17                	jae    800068 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800051:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800054:	49 89 c4             	mov    %rax,%r12
+  800057:	48 83 c3 08          	add    $0x8,%rbx
+  80005b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800060:	ff 53 f8             	call   *-0x8(%rbx)
+  800063:	4c 39 e3             	cmp    %r12,%rbx
+  800066:	72 ef                	jb     800057 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800068:	48 b8 ba 01 80 00 00 	movabs $0x8001ba,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800077:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80007e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800085:	00 00 00 
+  800088:	48 01 d0             	add    %rdx,%rax
+  80008b:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800092:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800095:	45 85 ed             	test   %r13d,%r13d
+  800098:	7e 0d                	jle    8000a7 <libmain+0x80>
+  80009a:	49 8b 06             	mov    (%r14),%rax
+  80009d:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000a4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000a7:	4c 89 f6             	mov    %r14,%rsi
+  8000aa:	44 89 ef             	mov    %r13d,%edi
+  8000ad:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000b4:	00 00 00 
+  8000b7:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000b9:	48 b8 ce 00 80 00 00 	movabs $0x8000ce,%rax
+  8000c0:	00 00 00 
+  8000c3:	ff d0                	call   *%rax
+#endif
+}
+  8000c5:	5b                   	pop    %rbx
+  8000c6:	41 5c                	pop    %r12
+  8000c8:	41 5d                	pop    %r13
+  8000ca:	41 5e                	pop    %r14
+  8000cc:	5d                   	pop    %rbp
+  8000cd:	c3                   	ret
+
+00000000008000ce <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000ce:	55                   	push   %rbp
+  8000cf:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000d2:	48 b8 42 0a 80 00 00 	movabs $0x800a42,%rax
+  8000d9:	00 00 00 
+  8000dc:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000e3:	48 b8 4f 01 80 00 00 	movabs $0x80014f,%rax
+  8000ea:	00 00 00 
+  8000ed:	ff d0                	call   *%rax
+}
+  8000ef:	5d                   	pop    %rbp
+  8000f0:	c3                   	ret
+
+00000000008000f1 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000f1:	55                   	push   %rbp
+  8000f2:	48 89 e5             	mov    %rsp,%rbp
+  8000f5:	53                   	push   %rbx
+  8000f6:	48 89 fa             	mov    %rdi,%rdx
+  8000f9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8000fc:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800101:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800106:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80010b:	be 00 00 00 00       	mov    $0x0,%esi
+  800110:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800116:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800118:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80011c:	c9                   	leave
+  80011d:	c3                   	ret
+
+000000000080011e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80011e:	55                   	push   %rbp
+  80011f:	48 89 e5             	mov    %rsp,%rbp
+  800122:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800123:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800128:	ba 00 00 00 00       	mov    $0x0,%edx
+  80012d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800132:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800137:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80013c:	be 00 00 00 00       	mov    $0x0,%esi
+  800141:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800147:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800149:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80014d:	c9                   	leave
+  80014e:	c3                   	ret
+
+000000000080014f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80014f:	55                   	push   %rbp
+  800150:	48 89 e5             	mov    %rsp,%rbp
+  800153:	53                   	push   %rbx
+  800154:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800158:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80015b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800160:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800165:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80016a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80016f:	be 00 00 00 00       	mov    $0x0,%esi
+  800174:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80017a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80017c:	48 85 c0             	test   %rax,%rax
+  80017f:	7f 06                	jg     800187 <sys_env_destroy+0x38>
+}
+  800181:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800185:	c9                   	leave
+  800186:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800187:	49 89 c0             	mov    %rax,%r8
+  80018a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80018f:	48 ba 20 2b 80 00 00 	movabs $0x802b20,%rdx
+  800196:	00 00 00 
+  800199:	be 26 00 00 00       	mov    $0x26,%esi
+  80019e:	48 bf 3f 2b 80 00 00 	movabs $0x802b3f,%rdi
+  8001a5:	00 00 00 
+  8001a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ad:	49 b9 ef 1a 80 00 00 	movabs $0x801aef,%r9
+  8001b4:	00 00 00 
+  8001b7:	41 ff d1             	call   *%r9
+
+00000000008001ba <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001ba:	55                   	push   %rbp
+  8001bb:	48 89 e5             	mov    %rsp,%rbp
+  8001be:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001bf:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8001dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001e3:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001e9:	c9                   	leave
+  8001ea:	c3                   	ret
+
+00000000008001eb <sys_yield>:
+
+void
+sys_yield(void) {
+  8001eb:	55                   	push   %rbp
+  8001ec:	48 89 e5             	mov    %rsp,%rbp
+  8001ef:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800204:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800209:	be 00 00 00 00       	mov    $0x0,%esi
+  80020e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800214:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800216:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80021a:	c9                   	leave
+  80021b:	c3                   	ret
+
+000000000080021c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80021c:	55                   	push   %rbp
+  80021d:	48 89 e5             	mov    %rsp,%rbp
+  800220:	53                   	push   %rbx
+  800221:	48 89 fa             	mov    %rdi,%rdx
+  800224:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800227:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80022c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800233:	00 00 00 
+  800236:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80023b:	be 00 00 00 00       	mov    $0x0,%esi
+  800240:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800246:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800248:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80024c:	c9                   	leave
+  80024d:	c3                   	ret
+
+000000000080024e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80024e:	55                   	push   %rbp
+  80024f:	48 89 e5             	mov    %rsp,%rbp
+  800252:	53                   	push   %rbx
+  800253:	49 89 f8             	mov    %rdi,%r8
+  800256:	48 89 d3             	mov    %rdx,%rbx
+  800259:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80025c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800261:	4c 89 c2             	mov    %r8,%rdx
+  800264:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800267:	be 00 00 00 00       	mov    $0x0,%esi
+  80026c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800272:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800274:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800278:	c9                   	leave
+  800279:	c3                   	ret
+
+000000000080027a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80027a:	55                   	push   %rbp
+  80027b:	48 89 e5             	mov    %rsp,%rbp
+  80027e:	53                   	push   %rbx
+  80027f:	48 83 ec 08          	sub    $0x8,%rsp
+  800283:	89 f8                	mov    %edi,%eax
+  800285:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800288:	48 63 f9             	movslq %ecx,%rdi
+  80028b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80028e:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800293:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800296:	be 00 00 00 00       	mov    $0x0,%esi
+  80029b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002a1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002a3:	48 85 c0             	test   %rax,%rax
+  8002a6:	7f 06                	jg     8002ae <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002ac:	c9                   	leave
+  8002ad:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002ae:	49 89 c0             	mov    %rax,%r8
+  8002b1:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002b6:	48 ba 20 2b 80 00 00 	movabs $0x802b20,%rdx
+  8002bd:	00 00 00 
+  8002c0:	be 26 00 00 00       	mov    $0x26,%esi
+  8002c5:	48 bf 3f 2b 80 00 00 	movabs $0x802b3f,%rdi
+  8002cc:	00 00 00 
+  8002cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d4:	49 b9 ef 1a 80 00 00 	movabs $0x801aef,%r9
+  8002db:	00 00 00 
+  8002de:	41 ff d1             	call   *%r9
+
+00000000008002e1 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002e1:	55                   	push   %rbp
+  8002e2:	48 89 e5             	mov    %rsp,%rbp
+  8002e5:	53                   	push   %rbx
+  8002e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ea:	89 f8                	mov    %edi,%eax
+  8002ec:	49 89 f2             	mov    %rsi,%r10
+  8002ef:	48 89 cf             	mov    %rcx,%rdi
+  8002f2:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002f5:	48 63 da             	movslq %edx,%rbx
+  8002f8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002fb:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800300:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800303:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800306:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800308:	48 85 c0             	test   %rax,%rax
+  80030b:	7f 06                	jg     800313 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80030d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800311:	c9                   	leave
+  800312:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800313:	49 89 c0             	mov    %rax,%r8
+  800316:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80031b:	48 ba 20 2b 80 00 00 	movabs $0x802b20,%rdx
+  800322:	00 00 00 
+  800325:	be 26 00 00 00       	mov    $0x26,%esi
+  80032a:	48 bf 3f 2b 80 00 00 	movabs $0x802b3f,%rdi
+  800331:	00 00 00 
+  800334:	b8 00 00 00 00       	mov    $0x0,%eax
+  800339:	49 b9 ef 1a 80 00 00 	movabs $0x801aef,%r9
+  800340:	00 00 00 
+  800343:	41 ff d1             	call   *%r9
+
+0000000000800346 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800346:	55                   	push   %rbp
+  800347:	48 89 e5             	mov    %rsp,%rbp
+  80034a:	53                   	push   %rbx
+  80034b:	48 83 ec 08          	sub    $0x8,%rsp
+  80034f:	48 89 f1             	mov    %rsi,%rcx
+  800352:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800355:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800358:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80035d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800362:	be 00 00 00 00       	mov    $0x0,%esi
+  800367:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80036d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80036f:	48 85 c0             	test   %rax,%rax
+  800372:	7f 06                	jg     80037a <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800374:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800378:	c9                   	leave
+  800379:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80037a:	49 89 c0             	mov    %rax,%r8
+  80037d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800382:	48 ba 20 2b 80 00 00 	movabs $0x802b20,%rdx
+  800389:	00 00 00 
+  80038c:	be 26 00 00 00       	mov    $0x26,%esi
+  800391:	48 bf 3f 2b 80 00 00 	movabs $0x802b3f,%rdi
+  800398:	00 00 00 
+  80039b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a0:	49 b9 ef 1a 80 00 00 	movabs $0x801aef,%r9
+  8003a7:	00 00 00 
+  8003aa:	41 ff d1             	call   *%r9
+
+00000000008003ad <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8003ad:	55                   	push   %rbp
+  8003ae:	48 89 e5             	mov    %rsp,%rbp
+  8003b1:	53                   	push   %rbx
+  8003b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8003b6:	89 f8                	mov    %edi,%eax
+  8003b8:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8003bb:	48 63 f9             	movslq %ecx,%rdi
+  8003be:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003c1:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003c6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8003ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003d4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003d6:	48 85 c0             	test   %rax,%rax
+  8003d9:	7f 06                	jg     8003e1 <sys_region_advise+0x34>
+}
+  8003db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003df:	c9                   	leave
+  8003e0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003e1:	49 89 c0             	mov    %rax,%r8
+  8003e4:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8003e9:	48 ba 20 2b 80 00 00 	movabs $0x802b20,%rdx
+  8003f0:	00 00 00 
+  8003f3:	be 26 00 00 00       	mov    $0x26,%esi
+  8003f8:	48 bf 3f 2b 80 00 00 	movabs $0x802b3f,%rdi
+  8003ff:	00 00 00 
+  800402:	b8 00 00 00 00       	mov    $0x0,%eax
+  800407:	49 b9 ef 1a 80 00 00 	movabs $0x801aef,%r9
+  80040e:	00 00 00 
+  800411:	41 ff d1             	call   *%r9
+
+0000000000800414 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  800414:	55                   	push   %rbp
+  800415:	48 89 e5             	mov    %rsp,%rbp
+  800418:	53                   	push   %rbx
+  800419:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80041d:	48 63 ce             	movslq %esi,%rcx
+  800420:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800423:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800428:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80042d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800432:	be 00 00 00 00       	mov    $0x0,%esi
+  800437:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80043d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80043f:	48 85 c0             	test   %rax,%rax
+  800442:	7f 06                	jg     80044a <sys_env_set_nice+0x36>
+}
+  800444:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800448:	c9                   	leave
+  800449:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80044a:	49 89 c0             	mov    %rax,%r8
+  80044d:	b9 15 00 00 00       	mov    $0x15,%ecx
+  800452:	48 ba 20 2b 80 00 00 	movabs $0x802b20,%rdx
+  800459:	00 00 00 
+  80045c:	be 26 00 00 00       	mov    $0x26,%esi
+  800461:	48 bf 3f 2b 80 00 00 	movabs $0x802b3f,%rdi
+  800468:	00 00 00 
+  80046b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800470:	49 b9 ef 1a 80 00 00 	movabs $0x801aef,%r9
+  800477:	00 00 00 
+  80047a:	41 ff d1             	call   *%r9
+
+000000000080047d <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80047d:	55                   	push   %rbp
+  80047e:	48 89 e5             	mov    %rsp,%rbp
+  800481:	53                   	push   %rbx
+  800482:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800486:	48 63 ce             	movslq %esi,%rcx
+  800489:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80048c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800491:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800496:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80049b:	be 00 00 00 00       	mov    $0x0,%esi
+  8004a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004a6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004a8:	48 85 c0             	test   %rax,%rax
+  8004ab:	7f 06                	jg     8004b3 <sys_env_set_status+0x36>
+}
+  8004ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004b1:	c9                   	leave
+  8004b2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004b3:	49 89 c0             	mov    %rax,%r8
+  8004b6:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004bb:	48 ba 20 2b 80 00 00 	movabs $0x802b20,%rdx
+  8004c2:	00 00 00 
+  8004c5:	be 26 00 00 00       	mov    $0x26,%esi
+  8004ca:	48 bf 3f 2b 80 00 00 	movabs $0x802b3f,%rdi
+  8004d1:	00 00 00 
+  8004d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d9:	49 b9 ef 1a 80 00 00 	movabs $0x801aef,%r9
+  8004e0:	00 00 00 
+  8004e3:	41 ff d1             	call   *%r9
+
+00000000008004e6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8004e6:	55                   	push   %rbp
+  8004e7:	48 89 e5             	mov    %rsp,%rbp
+  8004ea:	53                   	push   %rbx
+  8004eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8004ef:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8004f2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004f5:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800504:	be 00 00 00 00       	mov    $0x0,%esi
+  800509:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80050f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800511:	48 85 c0             	test   %rax,%rax
+  800514:	7f 06                	jg     80051c <sys_env_set_trapframe+0x36>
+}
+  800516:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80051a:	c9                   	leave
+  80051b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80051c:	49 89 c0             	mov    %rax,%r8
+  80051f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800524:	48 ba 20 2b 80 00 00 	movabs $0x802b20,%rdx
+  80052b:	00 00 00 
+  80052e:	be 26 00 00 00       	mov    $0x26,%esi
+  800533:	48 bf 3f 2b 80 00 00 	movabs $0x802b3f,%rdi
+  80053a:	00 00 00 
+  80053d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800542:	49 b9 ef 1a 80 00 00 	movabs $0x801aef,%r9
+  800549:	00 00 00 
+  80054c:	41 ff d1             	call   *%r9
+
+000000000080054f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80054f:	55                   	push   %rbp
+  800550:	48 89 e5             	mov    %rsp,%rbp
+  800553:	53                   	push   %rbx
+  800554:	48 83 ec 08          	sub    $0x8,%rsp
+  800558:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80055b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80055e:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800563:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800568:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80056d:	be 00 00 00 00       	mov    $0x0,%esi
+  800572:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800578:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80057a:	48 85 c0             	test   %rax,%rax
+  80057d:	7f 06                	jg     800585 <sys_env_set_pgfault_upcall+0x36>
+}
+  80057f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800583:	c9                   	leave
+  800584:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800585:	49 89 c0             	mov    %rax,%r8
+  800588:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80058d:	48 ba 20 2b 80 00 00 	movabs $0x802b20,%rdx
+  800594:	00 00 00 
+  800597:	be 26 00 00 00       	mov    $0x26,%esi
+  80059c:	48 bf 3f 2b 80 00 00 	movabs $0x802b3f,%rdi
+  8005a3:	00 00 00 
+  8005a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ab:	49 b9 ef 1a 80 00 00 	movabs $0x801aef,%r9
+  8005b2:	00 00 00 
+  8005b5:	41 ff d1             	call   *%r9
+
+00000000008005b8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8005b8:	55                   	push   %rbp
+  8005b9:	48 89 e5             	mov    %rsp,%rbp
+  8005bc:	53                   	push   %rbx
+  8005bd:	89 f8                	mov    %edi,%eax
+  8005bf:	49 89 f1             	mov    %rsi,%r9
+  8005c2:	48 89 d3             	mov    %rdx,%rbx
+  8005c5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8005c8:	49 63 f0             	movslq %r8d,%rsi
+  8005cb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005ce:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005d3:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005dc:	cd 30                	int    $0x30
+}
+  8005de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005e2:	c9                   	leave
+  8005e3:	c3                   	ret
+
+00000000008005e4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8005e4:	55                   	push   %rbp
+  8005e5:	48 89 e5             	mov    %rsp,%rbp
+  8005e8:	53                   	push   %rbx
+  8005e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8005ed:	48 89 fa             	mov    %rdi,%rdx
+  8005f0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8005f3:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800602:	be 00 00 00 00       	mov    $0x0,%esi
+  800607:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80060d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80060f:	48 85 c0             	test   %rax,%rax
+  800612:	7f 06                	jg     80061a <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800614:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800618:	c9                   	leave
+  800619:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80061a:	49 89 c0             	mov    %rax,%r8
+  80061d:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800622:	48 ba 20 2b 80 00 00 	movabs $0x802b20,%rdx
+  800629:	00 00 00 
+  80062c:	be 26 00 00 00       	mov    $0x26,%esi
+  800631:	48 bf 3f 2b 80 00 00 	movabs $0x802b3f,%rdi
+  800638:	00 00 00 
+  80063b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800640:	49 b9 ef 1a 80 00 00 	movabs $0x801aef,%r9
+  800647:	00 00 00 
+  80064a:	41 ff d1             	call   *%r9
+
+000000000080064d <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80064d:	55                   	push   %rbp
+  80064e:	48 89 e5             	mov    %rsp,%rbp
+  800651:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800652:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800657:	ba 00 00 00 00       	mov    $0x0,%edx
+  80065c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800661:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800666:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80066b:	be 00 00 00 00       	mov    $0x0,%esi
+  800670:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800676:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800678:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80067c:	c9                   	leave
+  80067d:	c3                   	ret
+
+000000000080067e <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80067e:	55                   	push   %rbp
+  80067f:	48 89 e5             	mov    %rsp,%rbp
+  800682:	53                   	push   %rbx
+  800683:	48 83 ec 08          	sub    $0x8,%rsp
+  800687:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  80068a:	48 63 ce             	movslq %esi,%rcx
+  80068d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800690:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800695:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80069a:	be 00 00 00 00       	mov    $0x0,%esi
+  80069f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006a5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8006a7:	48 85 c0             	test   %rax,%rax
+  8006aa:	7f 06                	jg     8006b2 <sys_sigqueue+0x34>
+}
+  8006ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006b0:	c9                   	leave
+  8006b1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006b2:	49 89 c0             	mov    %rax,%r8
+  8006b5:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8006ba:	48 ba 20 2b 80 00 00 	movabs $0x802b20,%rdx
+  8006c1:	00 00 00 
+  8006c4:	be 26 00 00 00       	mov    $0x26,%esi
+  8006c9:	48 bf 3f 2b 80 00 00 	movabs $0x802b3f,%rdi
+  8006d0:	00 00 00 
+  8006d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d8:	49 b9 ef 1a 80 00 00 	movabs $0x801aef,%r9
+  8006df:	00 00 00 
+  8006e2:	41 ff d1             	call   *%r9
+
+00000000008006e5 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8006e5:	55                   	push   %rbp
+  8006e6:	48 89 e5             	mov    %rsp,%rbp
+  8006e9:	53                   	push   %rbx
+  8006ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8006ee:	48 89 fa             	mov    %rdi,%rdx
+  8006f1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8006f4:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800703:	be 00 00 00 00       	mov    $0x0,%esi
+  800708:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80070e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800710:	48 85 c0             	test   %rax,%rax
+  800713:	7f 06                	jg     80071b <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  800715:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800719:	c9                   	leave
+  80071a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80071b:	49 89 c0             	mov    %rax,%r8
+  80071e:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800723:	48 ba 20 2b 80 00 00 	movabs $0x802b20,%rdx
+  80072a:	00 00 00 
+  80072d:	be 26 00 00 00       	mov    $0x26,%esi
+  800732:	48 bf 3f 2b 80 00 00 	movabs $0x802b3f,%rdi
+  800739:	00 00 00 
+  80073c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800741:	49 b9 ef 1a 80 00 00 	movabs $0x801aef,%r9
+  800748:	00 00 00 
+  80074b:	41 ff d1             	call   *%r9
+
+000000000080074e <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80074e:	55                   	push   %rbp
+  80074f:	48 89 e5             	mov    %rsp,%rbp
+  800752:	53                   	push   %rbx
+  800753:	48 83 ec 08          	sub    $0x8,%rsp
+  800757:	48 89 f1             	mov    %rsi,%rcx
+  80075a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80075d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800760:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800765:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80076a:	be 00 00 00 00       	mov    $0x0,%esi
+  80076f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800775:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800777:	48 85 c0             	test   %rax,%rax
+  80077a:	7f 06                	jg     800782 <sys_sigaction+0x34>
+}
+  80077c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800780:	c9                   	leave
+  800781:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800782:	49 89 c0             	mov    %rax,%r8
+  800785:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80078a:	48 ba 20 2b 80 00 00 	movabs $0x802b20,%rdx
+  800791:	00 00 00 
+  800794:	be 26 00 00 00       	mov    $0x26,%esi
+  800799:	48 bf 3f 2b 80 00 00 	movabs $0x802b3f,%rdi
+  8007a0:	00 00 00 
+  8007a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a8:	49 b9 ef 1a 80 00 00 	movabs $0x801aef,%r9
+  8007af:	00 00 00 
+  8007b2:	41 ff d1             	call   *%r9
+
+00000000008007b5 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8007b5:	55                   	push   %rbp
+  8007b6:	48 89 e5             	mov    %rsp,%rbp
+  8007b9:	53                   	push   %rbx
+  8007ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8007be:	48 89 f1             	mov    %rsi,%rcx
+  8007c1:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8007c4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8007c7:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8007cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8007d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8007dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8007de:	48 85 c0             	test   %rax,%rax
+  8007e1:	7f 06                	jg     8007e9 <sys_sigprocmask+0x34>
+}
+  8007e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007e7:	c9                   	leave
+  8007e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007e9:	49 89 c0             	mov    %rax,%r8
+  8007ec:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8007f1:	48 ba 20 2b 80 00 00 	movabs $0x802b20,%rdx
+  8007f8:	00 00 00 
+  8007fb:	be 26 00 00 00       	mov    $0x26,%esi
+  800800:	48 bf 3f 2b 80 00 00 	movabs $0x802b3f,%rdi
+  800807:	00 00 00 
+  80080a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080f:	49 b9 ef 1a 80 00 00 	movabs $0x801aef,%r9
+  800816:	00 00 00 
+  800819:	41 ff d1             	call   *%r9
+
+000000000080081c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80081c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800823:	ff ff ff 
+  800826:	48 01 f8             	add    %rdi,%rax
+  800829:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80082d:	c3                   	ret
+
+000000000080082e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80082e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800835:	ff ff ff 
+  800838:	48 01 f8             	add    %rdi,%rax
+  80083b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80083f:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800845:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800849:	c3                   	ret
+
+000000000080084a <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80084a:	55                   	push   %rbp
+  80084b:	48 89 e5             	mov    %rsp,%rbp
+  80084e:	41 57                	push   %r15
+  800850:	41 56                	push   %r14
+  800852:	41 55                	push   %r13
+  800854:	41 54                	push   %r12
+  800856:	53                   	push   %rbx
+  800857:	48 83 ec 08          	sub    $0x8,%rsp
+  80085b:	49 89 ff             	mov    %rdi,%r15
+  80085e:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800863:	49 bd c8 17 80 00 00 	movabs $0x8017c8,%r13
+  80086a:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80086d:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800873:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800876:	48 89 df             	mov    %rbx,%rdi
+  800879:	41 ff d5             	call   *%r13
+  80087c:	83 e0 04             	and    $0x4,%eax
+  80087f:	74 17                	je     800898 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800881:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800888:	4c 39 f3             	cmp    %r14,%rbx
+  80088b:	75 e6                	jne    800873 <fd_alloc+0x29>
+  80088d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800893:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800898:	4d 89 27             	mov    %r12,(%r15)
+}
+  80089b:	48 83 c4 08          	add    $0x8,%rsp
+  80089f:	5b                   	pop    %rbx
+  8008a0:	41 5c                	pop    %r12
+  8008a2:	41 5d                	pop    %r13
+  8008a4:	41 5e                	pop    %r14
+  8008a6:	41 5f                	pop    %r15
+  8008a8:	5d                   	pop    %rbp
+  8008a9:	c3                   	ret
+
+00000000008008aa <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8008aa:	83 ff 1f             	cmp    $0x1f,%edi
+  8008ad:	77 39                	ja     8008e8 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8008af:	55                   	push   %rbp
+  8008b0:	48 89 e5             	mov    %rsp,%rbp
+  8008b3:	41 54                	push   %r12
+  8008b5:	53                   	push   %rbx
+  8008b6:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8008b9:	48 63 df             	movslq %edi,%rbx
+  8008bc:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8008c3:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8008c7:	48 89 df             	mov    %rbx,%rdi
+  8008ca:	48 b8 c8 17 80 00 00 	movabs $0x8017c8,%rax
+  8008d1:	00 00 00 
+  8008d4:	ff d0                	call   *%rax
+  8008d6:	a8 04                	test   $0x4,%al
+  8008d8:	74 14                	je     8008ee <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8008da:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8008de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008e3:	5b                   	pop    %rbx
+  8008e4:	41 5c                	pop    %r12
+  8008e6:	5d                   	pop    %rbp
+  8008e7:	c3                   	ret
+        return -E_INVAL;
+  8008e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8008ed:	c3                   	ret
+        return -E_INVAL;
+  8008ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008f3:	eb ee                	jmp    8008e3 <fd_lookup+0x39>
+
+00000000008008f5 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8008f5:	55                   	push   %rbp
+  8008f6:	48 89 e5             	mov    %rsp,%rbp
+  8008f9:	41 54                	push   %r12
+  8008fb:	53                   	push   %rbx
+  8008fc:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8008ff:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  800906:	00 00 00 
+  800909:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  800910:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800913:	39 3b                	cmp    %edi,(%rbx)
+  800915:	74 47                	je     80095e <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800917:	48 83 c0 08          	add    $0x8,%rax
+  80091b:	48 8b 18             	mov    (%rax),%rbx
+  80091e:	48 85 db             	test   %rbx,%rbx
+  800921:	75 f0                	jne    800913 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800923:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80092a:	00 00 00 
+  80092d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800933:	89 fa                	mov    %edi,%edx
+  800935:	48 bf 50 2b 80 00 00 	movabs $0x802b50,%rdi
+  80093c:	00 00 00 
+  80093f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800944:	48 b9 3f 1c 80 00 00 	movabs $0x801c3f,%rcx
+  80094b:	00 00 00 
+  80094e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800950:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800955:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800959:	5b                   	pop    %rbx
+  80095a:	41 5c                	pop    %r12
+  80095c:	5d                   	pop    %rbp
+  80095d:	c3                   	ret
+            return 0;
+  80095e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800963:	eb f0                	jmp    800955 <dev_lookup+0x60>
+
+0000000000800965 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800965:	55                   	push   %rbp
+  800966:	48 89 e5             	mov    %rsp,%rbp
+  800969:	41 55                	push   %r13
+  80096b:	41 54                	push   %r12
+  80096d:	53                   	push   %rbx
+  80096e:	48 83 ec 18          	sub    $0x18,%rsp
+  800972:	48 89 fb             	mov    %rdi,%rbx
+  800975:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800978:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80097f:	ff ff ff 
+  800982:	48 01 df             	add    %rbx,%rdi
+  800985:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800989:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80098d:	48 b8 aa 08 80 00 00 	movabs $0x8008aa,%rax
+  800994:	00 00 00 
+  800997:	ff d0                	call   *%rax
+  800999:	41 89 c5             	mov    %eax,%r13d
+  80099c:	85 c0                	test   %eax,%eax
+  80099e:	78 06                	js     8009a6 <fd_close+0x41>
+  8009a0:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8009a4:	74 1a                	je     8009c0 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8009a6:	45 84 e4             	test   %r12b,%r12b
+  8009a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ae:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8009b2:	44 89 e8             	mov    %r13d,%eax
+  8009b5:	48 83 c4 18          	add    $0x18,%rsp
+  8009b9:	5b                   	pop    %rbx
+  8009ba:	41 5c                	pop    %r12
+  8009bc:	41 5d                	pop    %r13
+  8009be:	5d                   	pop    %rbp
+  8009bf:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8009c0:	8b 3b                	mov    (%rbx),%edi
+  8009c2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8009c6:	48 b8 f5 08 80 00 00 	movabs $0x8008f5,%rax
+  8009cd:	00 00 00 
+  8009d0:	ff d0                	call   *%rax
+  8009d2:	41 89 c5             	mov    %eax,%r13d
+  8009d5:	85 c0                	test   %eax,%eax
+  8009d7:	78 1b                	js     8009f4 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8009d9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8009dd:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8009e1:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8009e7:	48 85 c0             	test   %rax,%rax
+  8009ea:	74 08                	je     8009f4 <fd_close+0x8f>
+  8009ec:	48 89 df             	mov    %rbx,%rdi
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8009f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009f9:	48 89 de             	mov    %rbx,%rsi
+  8009fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a01:	48 b8 46 03 80 00 00 	movabs $0x800346,%rax
+  800a08:	00 00 00 
+  800a0b:	ff d0                	call   *%rax
+    return res;
+  800a0d:	eb a3                	jmp    8009b2 <fd_close+0x4d>
+
+0000000000800a0f <close>:
+
+int
+close(int fdnum) {
+  800a0f:	55                   	push   %rbp
+  800a10:	48 89 e5             	mov    %rsp,%rbp
+  800a13:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800a17:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800a1b:	48 b8 aa 08 80 00 00 	movabs $0x8008aa,%rax
+  800a22:	00 00 00 
+  800a25:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800a27:	85 c0                	test   %eax,%eax
+  800a29:	78 15                	js     800a40 <close+0x31>
+
+    return fd_close(fd, 1);
+  800a2b:	be 01 00 00 00       	mov    $0x1,%esi
+  800a30:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800a34:	48 b8 65 09 80 00 00 	movabs $0x800965,%rax
+  800a3b:	00 00 00 
+  800a3e:	ff d0                	call   *%rax
+}
+  800a40:	c9                   	leave
+  800a41:	c3                   	ret
+
+0000000000800a42 <close_all>:
+
+void
+close_all(void) {
+  800a42:	55                   	push   %rbp
+  800a43:	48 89 e5             	mov    %rsp,%rbp
+  800a46:	41 54                	push   %r12
+  800a48:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800a49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a4e:	49 bc 0f 0a 80 00 00 	movabs $0x800a0f,%r12
+  800a55:	00 00 00 
+  800a58:	89 df                	mov    %ebx,%edi
+  800a5a:	41 ff d4             	call   *%r12
+  800a5d:	83 c3 01             	add    $0x1,%ebx
+  800a60:	83 fb 20             	cmp    $0x20,%ebx
+  800a63:	75 f3                	jne    800a58 <close_all+0x16>
+}
+  800a65:	5b                   	pop    %rbx
+  800a66:	41 5c                	pop    %r12
+  800a68:	5d                   	pop    %rbp
+  800a69:	c3                   	ret
+
+0000000000800a6a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800a6a:	55                   	push   %rbp
+  800a6b:	48 89 e5             	mov    %rsp,%rbp
+  800a6e:	41 57                	push   %r15
+  800a70:	41 56                	push   %r14
+  800a72:	41 55                	push   %r13
+  800a74:	41 54                	push   %r12
+  800a76:	53                   	push   %rbx
+  800a77:	48 83 ec 18          	sub    $0x18,%rsp
+  800a7b:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800a7e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800a82:	48 b8 aa 08 80 00 00 	movabs $0x8008aa,%rax
+  800a89:	00 00 00 
+  800a8c:	ff d0                	call   *%rax
+  800a8e:	89 c3                	mov    %eax,%ebx
+  800a90:	85 c0                	test   %eax,%eax
+  800a92:	0f 88 b8 00 00 00    	js     800b50 <dup+0xe6>
+    close(newfdnum);
+  800a98:	44 89 e7             	mov    %r12d,%edi
+  800a9b:	48 b8 0f 0a 80 00 00 	movabs $0x800a0f,%rax
+  800aa2:	00 00 00 
+  800aa5:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800aa7:	4d 63 ec             	movslq %r12d,%r13
+  800aaa:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800ab1:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800ab5:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800ab9:	4c 89 ff             	mov    %r15,%rdi
+  800abc:	49 be 2e 08 80 00 00 	movabs $0x80082e,%r14
+  800ac3:	00 00 00 
+  800ac6:	41 ff d6             	call   *%r14
+  800ac9:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800acc:	4c 89 ef             	mov    %r13,%rdi
+  800acf:	41 ff d6             	call   *%r14
+  800ad2:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800ad5:	48 89 df             	mov    %rbx,%rdi
+  800ad8:	48 b8 c8 17 80 00 00 	movabs $0x8017c8,%rax
+  800adf:	00 00 00 
+  800ae2:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800ae4:	a8 04                	test   $0x4,%al
+  800ae6:	74 2b                	je     800b13 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800ae8:	41 89 c1             	mov    %eax,%r9d
+  800aeb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800af1:	4c 89 f1             	mov    %r14,%rcx
+  800af4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800af9:	48 89 de             	mov    %rbx,%rsi
+  800afc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b01:	48 b8 e1 02 80 00 00 	movabs $0x8002e1,%rax
+  800b08:	00 00 00 
+  800b0b:	ff d0                	call   *%rax
+  800b0d:	89 c3                	mov    %eax,%ebx
+  800b0f:	85 c0                	test   %eax,%eax
+  800b11:	78 4e                	js     800b61 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800b13:	4c 89 ff             	mov    %r15,%rdi
+  800b16:	48 b8 c8 17 80 00 00 	movabs $0x8017c8,%rax
+  800b1d:	00 00 00 
+  800b20:	ff d0                	call   *%rax
+  800b22:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800b25:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800b2b:	4c 89 e9             	mov    %r13,%rcx
+  800b2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b33:	4c 89 fe             	mov    %r15,%rsi
+  800b36:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b3b:	48 b8 e1 02 80 00 00 	movabs $0x8002e1,%rax
+  800b42:	00 00 00 
+  800b45:	ff d0                	call   *%rax
+  800b47:	89 c3                	mov    %eax,%ebx
+  800b49:	85 c0                	test   %eax,%eax
+  800b4b:	78 14                	js     800b61 <dup+0xf7>
+
+    return newfdnum;
+  800b4d:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800b50:	89 d8                	mov    %ebx,%eax
+  800b52:	48 83 c4 18          	add    $0x18,%rsp
+  800b56:	5b                   	pop    %rbx
+  800b57:	41 5c                	pop    %r12
+  800b59:	41 5d                	pop    %r13
+  800b5b:	41 5e                	pop    %r14
+  800b5d:	41 5f                	pop    %r15
+  800b5f:	5d                   	pop    %rbp
+  800b60:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800b61:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b66:	4c 89 ee             	mov    %r13,%rsi
+  800b69:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b6e:	49 bc 46 03 80 00 00 	movabs $0x800346,%r12
+  800b75:	00 00 00 
+  800b78:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800b7b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b80:	4c 89 f6             	mov    %r14,%rsi
+  800b83:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b88:	41 ff d4             	call   *%r12
+    return res;
+  800b8b:	eb c3                	jmp    800b50 <dup+0xe6>
+
+0000000000800b8d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800b8d:	55                   	push   %rbp
+  800b8e:	48 89 e5             	mov    %rsp,%rbp
+  800b91:	41 56                	push   %r14
+  800b93:	41 55                	push   %r13
+  800b95:	41 54                	push   %r12
+  800b97:	53                   	push   %rbx
+  800b98:	48 83 ec 10          	sub    $0x10,%rsp
+  800b9c:	89 fb                	mov    %edi,%ebx
+  800b9e:	49 89 f4             	mov    %rsi,%r12
+  800ba1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ba4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ba8:	48 b8 aa 08 80 00 00 	movabs $0x8008aa,%rax
+  800baf:	00 00 00 
+  800bb2:	ff d0                	call   *%rax
+  800bb4:	85 c0                	test   %eax,%eax
+  800bb6:	78 4c                	js     800c04 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bb8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bbc:	41 8b 3e             	mov    (%r14),%edi
+  800bbf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bc3:	48 b8 f5 08 80 00 00 	movabs $0x8008f5,%rax
+  800bca:	00 00 00 
+  800bcd:	ff d0                	call   *%rax
+  800bcf:	85 c0                	test   %eax,%eax
+  800bd1:	78 35                	js     800c08 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800bd3:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800bd7:	83 e0 03             	and    $0x3,%eax
+  800bda:	83 f8 01             	cmp    $0x1,%eax
+  800bdd:	74 2d                	je     800c0c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800bdf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800be3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800be7:	48 85 c0             	test   %rax,%rax
+  800bea:	74 56                	je     800c42 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800bec:	4c 89 ea             	mov    %r13,%rdx
+  800bef:	4c 89 e6             	mov    %r12,%rsi
+  800bf2:	4c 89 f7             	mov    %r14,%rdi
+  800bf5:	ff d0                	call   *%rax
+}
+  800bf7:	48 83 c4 10          	add    $0x10,%rsp
+  800bfb:	5b                   	pop    %rbx
+  800bfc:	41 5c                	pop    %r12
+  800bfe:	41 5d                	pop    %r13
+  800c00:	41 5e                	pop    %r14
+  800c02:	5d                   	pop    %rbp
+  800c03:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c04:	48 98                	cltq
+  800c06:	eb ef                	jmp    800bf7 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c08:	48 98                	cltq
+  800c0a:	eb eb                	jmp    800bf7 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c0c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c13:	00 00 00 
+  800c16:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c1c:	89 da                	mov    %ebx,%edx
+  800c1e:	48 bf 91 2b 80 00 00 	movabs $0x802b91,%rdi
+  800c25:	00 00 00 
+  800c28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2d:	48 b9 3f 1c 80 00 00 	movabs $0x801c3f,%rcx
+  800c34:	00 00 00 
+  800c37:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c39:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c40:	eb b5                	jmp    800bf7 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800c42:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c49:	eb ac                	jmp    800bf7 <read+0x6a>
+
+0000000000800c4b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800c4b:	55                   	push   %rbp
+  800c4c:	48 89 e5             	mov    %rsp,%rbp
+  800c4f:	41 57                	push   %r15
+  800c51:	41 56                	push   %r14
+  800c53:	41 55                	push   %r13
+  800c55:	41 54                	push   %r12
+  800c57:	53                   	push   %rbx
+  800c58:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800c5c:	48 85 d2             	test   %rdx,%rdx
+  800c5f:	74 54                	je     800cb5 <readn+0x6a>
+  800c61:	41 89 fd             	mov    %edi,%r13d
+  800c64:	49 89 f6             	mov    %rsi,%r14
+  800c67:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800c6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800c6f:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800c74:	49 bf 8d 0b 80 00 00 	movabs $0x800b8d,%r15
+  800c7b:	00 00 00 
+  800c7e:	4c 89 e2             	mov    %r12,%rdx
+  800c81:	48 29 f2             	sub    %rsi,%rdx
+  800c84:	4c 01 f6             	add    %r14,%rsi
+  800c87:	44 89 ef             	mov    %r13d,%edi
+  800c8a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800c8d:	85 c0                	test   %eax,%eax
+  800c8f:	78 20                	js     800cb1 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800c91:	01 c3                	add    %eax,%ebx
+  800c93:	85 c0                	test   %eax,%eax
+  800c95:	74 08                	je     800c9f <readn+0x54>
+  800c97:	48 63 f3             	movslq %ebx,%rsi
+  800c9a:	4c 39 e6             	cmp    %r12,%rsi
+  800c9d:	72 df                	jb     800c7e <readn+0x33>
+    }
+    return res;
+  800c9f:	48 63 c3             	movslq %ebx,%rax
+}
+  800ca2:	48 83 c4 08          	add    $0x8,%rsp
+  800ca6:	5b                   	pop    %rbx
+  800ca7:	41 5c                	pop    %r12
+  800ca9:	41 5d                	pop    %r13
+  800cab:	41 5e                	pop    %r14
+  800cad:	41 5f                	pop    %r15
+  800caf:	5d                   	pop    %rbp
+  800cb0:	c3                   	ret
+        if (inc < 0) return inc;
+  800cb1:	48 98                	cltq
+  800cb3:	eb ed                	jmp    800ca2 <readn+0x57>
+    int inc = 1, res = 0;
+  800cb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cba:	eb e3                	jmp    800c9f <readn+0x54>
+
+0000000000800cbc <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800cbc:	55                   	push   %rbp
+  800cbd:	48 89 e5             	mov    %rsp,%rbp
+  800cc0:	41 56                	push   %r14
+  800cc2:	41 55                	push   %r13
+  800cc4:	41 54                	push   %r12
+  800cc6:	53                   	push   %rbx
+  800cc7:	48 83 ec 10          	sub    $0x10,%rsp
+  800ccb:	89 fb                	mov    %edi,%ebx
+  800ccd:	49 89 f4             	mov    %rsi,%r12
+  800cd0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cd3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cd7:	48 b8 aa 08 80 00 00 	movabs $0x8008aa,%rax
+  800cde:	00 00 00 
+  800ce1:	ff d0                	call   *%rax
+  800ce3:	85 c0                	test   %eax,%eax
+  800ce5:	78 47                	js     800d2e <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ce7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800ceb:	41 8b 3e             	mov    (%r14),%edi
+  800cee:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cf2:	48 b8 f5 08 80 00 00 	movabs $0x8008f5,%rax
+  800cf9:	00 00 00 
+  800cfc:	ff d0                	call   *%rax
+  800cfe:	85 c0                	test   %eax,%eax
+  800d00:	78 30                	js     800d32 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d02:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800d07:	74 2d                	je     800d36 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d09:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d0d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800d11:	48 85 c0             	test   %rax,%rax
+  800d14:	74 56                	je     800d6c <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800d16:	4c 89 ea             	mov    %r13,%rdx
+  800d19:	4c 89 e6             	mov    %r12,%rsi
+  800d1c:	4c 89 f7             	mov    %r14,%rdi
+  800d1f:	ff d0                	call   *%rax
+}
+  800d21:	48 83 c4 10          	add    $0x10,%rsp
+  800d25:	5b                   	pop    %rbx
+  800d26:	41 5c                	pop    %r12
+  800d28:	41 5d                	pop    %r13
+  800d2a:	41 5e                	pop    %r14
+  800d2c:	5d                   	pop    %rbp
+  800d2d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d2e:	48 98                	cltq
+  800d30:	eb ef                	jmp    800d21 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d32:	48 98                	cltq
+  800d34:	eb eb                	jmp    800d21 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800d36:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d3d:	00 00 00 
+  800d40:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800d46:	89 da                	mov    %ebx,%edx
+  800d48:	48 bf ad 2b 80 00 00 	movabs $0x802bad,%rdi
+  800d4f:	00 00 00 
+  800d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d57:	48 b9 3f 1c 80 00 00 	movabs $0x801c3f,%rcx
+  800d5e:	00 00 00 
+  800d61:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d63:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800d6a:	eb b5                	jmp    800d21 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d6c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800d73:	eb ac                	jmp    800d21 <write+0x65>
+
+0000000000800d75 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800d75:	55                   	push   %rbp
+  800d76:	48 89 e5             	mov    %rsp,%rbp
+  800d79:	53                   	push   %rbx
+  800d7a:	48 83 ec 18          	sub    $0x18,%rsp
+  800d7e:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d80:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d84:	48 b8 aa 08 80 00 00 	movabs $0x8008aa,%rax
+  800d8b:	00 00 00 
+  800d8e:	ff d0                	call   *%rax
+  800d90:	85 c0                	test   %eax,%eax
+  800d92:	78 0c                	js     800da0 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800d94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d98:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800d9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800da0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800da4:	c9                   	leave
+  800da5:	c3                   	ret
+
+0000000000800da6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800da6:	55                   	push   %rbp
+  800da7:	48 89 e5             	mov    %rsp,%rbp
+  800daa:	41 55                	push   %r13
+  800dac:	41 54                	push   %r12
+  800dae:	53                   	push   %rbx
+  800daf:	48 83 ec 18          	sub    $0x18,%rsp
+  800db3:	89 fb                	mov    %edi,%ebx
+  800db5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800db8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800dbc:	48 b8 aa 08 80 00 00 	movabs $0x8008aa,%rax
+  800dc3:	00 00 00 
+  800dc6:	ff d0                	call   *%rax
+  800dc8:	85 c0                	test   %eax,%eax
+  800dca:	78 38                	js     800e04 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800dcc:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800dd0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800dd4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800dd8:	48 b8 f5 08 80 00 00 	movabs $0x8008f5,%rax
+  800ddf:	00 00 00 
+  800de2:	ff d0                	call   *%rax
+  800de4:	85 c0                	test   %eax,%eax
+  800de6:	78 1c                	js     800e04 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800de8:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800ded:	74 20                	je     800e0f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800def:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800df3:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800df7:	48 85 c0             	test   %rax,%rax
+  800dfa:	74 47                	je     800e43 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800dfc:	44 89 e6             	mov    %r12d,%esi
+  800dff:	4c 89 ef             	mov    %r13,%rdi
+  800e02:	ff d0                	call   *%rax
+}
+  800e04:	48 83 c4 18          	add    $0x18,%rsp
+  800e08:	5b                   	pop    %rbx
+  800e09:	41 5c                	pop    %r12
+  800e0b:	41 5d                	pop    %r13
+  800e0d:	5d                   	pop    %rbp
+  800e0e:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800e0f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800e16:	00 00 00 
+  800e19:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800e1f:	89 da                	mov    %ebx,%edx
+  800e21:	48 bf 70 2b 80 00 00 	movabs $0x802b70,%rdi
+  800e28:	00 00 00 
+  800e2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e30:	48 b9 3f 1c 80 00 00 	movabs $0x801c3f,%rcx
+  800e37:	00 00 00 
+  800e3a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e41:	eb c1                	jmp    800e04 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800e43:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e48:	eb ba                	jmp    800e04 <ftruncate+0x5e>
+
+0000000000800e4a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800e4a:	55                   	push   %rbp
+  800e4b:	48 89 e5             	mov    %rsp,%rbp
+  800e4e:	41 54                	push   %r12
+  800e50:	53                   	push   %rbx
+  800e51:	48 83 ec 10          	sub    $0x10,%rsp
+  800e55:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e58:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e5c:	48 b8 aa 08 80 00 00 	movabs $0x8008aa,%rax
+  800e63:	00 00 00 
+  800e66:	ff d0                	call   *%rax
+  800e68:	85 c0                	test   %eax,%eax
+  800e6a:	78 4e                	js     800eba <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e6c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800e70:	41 8b 3c 24          	mov    (%r12),%edi
+  800e74:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800e78:	48 b8 f5 08 80 00 00 	movabs $0x8008f5,%rax
+  800e7f:	00 00 00 
+  800e82:	ff d0                	call   *%rax
+  800e84:	85 c0                	test   %eax,%eax
+  800e86:	78 32                	js     800eba <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800e88:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e8c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800e91:	74 30                	je     800ec3 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800e93:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800e96:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800e9d:	00 00 00 
+    stat->st_isdir = 0;
+  800ea0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800ea7:	00 00 00 
+    stat->st_dev = dev;
+  800eaa:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800eb1:	48 89 de             	mov    %rbx,%rsi
+  800eb4:	4c 89 e7             	mov    %r12,%rdi
+  800eb7:	ff 50 28             	call   *0x28(%rax)
+}
+  800eba:	48 83 c4 10          	add    $0x10,%rsp
+  800ebe:	5b                   	pop    %rbx
+  800ebf:	41 5c                	pop    %r12
+  800ec1:	5d                   	pop    %rbp
+  800ec2:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800ec3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ec8:	eb f0                	jmp    800eba <fstat+0x70>
+
+0000000000800eca <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800eca:	55                   	push   %rbp
+  800ecb:	48 89 e5             	mov    %rsp,%rbp
+  800ece:	41 54                	push   %r12
+  800ed0:	53                   	push   %rbx
+  800ed1:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800ed4:	be 00 00 00 00       	mov    $0x0,%esi
+  800ed9:	48 b8 4b 11 80 00 00 	movabs $0x80114b,%rax
+  800ee0:	00 00 00 
+  800ee3:	ff d0                	call   *%rax
+  800ee5:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800ee7:	85 c0                	test   %eax,%eax
+  800ee9:	78 25                	js     800f10 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800eeb:	4c 89 e6             	mov    %r12,%rsi
+  800eee:	89 c7                	mov    %eax,%edi
+  800ef0:	48 b8 4a 0e 80 00 00 	movabs $0x800e4a,%rax
+  800ef7:	00 00 00 
+  800efa:	ff d0                	call   *%rax
+  800efc:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800eff:	89 df                	mov    %ebx,%edi
+  800f01:	48 b8 0f 0a 80 00 00 	movabs $0x800a0f,%rax
+  800f08:	00 00 00 
+  800f0b:	ff d0                	call   *%rax
+
+    return res;
+  800f0d:	44 89 e3             	mov    %r12d,%ebx
+}
+  800f10:	89 d8                	mov    %ebx,%eax
+  800f12:	5b                   	pop    %rbx
+  800f13:	41 5c                	pop    %r12
+  800f15:	5d                   	pop    %rbp
+  800f16:	c3                   	ret
+
+0000000000800f17 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800f17:	55                   	push   %rbp
+  800f18:	48 89 e5             	mov    %rsp,%rbp
+  800f1b:	41 54                	push   %r12
+  800f1d:	53                   	push   %rbx
+  800f1e:	48 83 ec 10          	sub    $0x10,%rsp
+  800f22:	41 89 fc             	mov    %edi,%r12d
+  800f25:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f28:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f2f:	00 00 00 
+  800f32:	83 38 00             	cmpl   $0x0,(%rax)
+  800f35:	74 5e                	je     800f95 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800f37:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800f3d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800f42:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800f49:	00 00 00 
+  800f4c:	44 89 e6             	mov    %r12d,%esi
+  800f4f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f56:	00 00 00 
+  800f59:	8b 38                	mov    (%rax),%edi
+  800f5b:	48 b8 20 2a 80 00 00 	movabs $0x802a20,%rax
+  800f62:	00 00 00 
+  800f65:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800f67:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800f6e:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800f6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f74:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800f78:	48 89 de             	mov    %rbx,%rsi
+  800f7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f80:	48 b8 8b 29 80 00 00 	movabs $0x80298b,%rax
+  800f87:	00 00 00 
+  800f8a:	ff d0                	call   *%rax
+}
+  800f8c:	48 83 c4 10          	add    $0x10,%rsp
+  800f90:	5b                   	pop    %rbx
+  800f91:	41 5c                	pop    %r12
+  800f93:	5d                   	pop    %rbp
+  800f94:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f95:	bf 03 00 00 00       	mov    $0x3,%edi
+  800f9a:	48 b8 c0 2a 80 00 00 	movabs $0x802ac0,%rax
+  800fa1:	00 00 00 
+  800fa4:	ff d0                	call   *%rax
+  800fa6:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800fad:	00 00 
+  800faf:	eb 86                	jmp    800f37 <fsipc+0x20>
+
+0000000000800fb1 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800fb1:	55                   	push   %rbp
+  800fb2:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800fb5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800fbc:	00 00 00 
+  800fbf:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800fc2:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800fc4:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800fc7:	be 00 00 00 00       	mov    $0x0,%esi
+  800fcc:	bf 02 00 00 00       	mov    $0x2,%edi
+  800fd1:	48 b8 17 0f 80 00 00 	movabs $0x800f17,%rax
+  800fd8:	00 00 00 
+  800fdb:	ff d0                	call   *%rax
+}
+  800fdd:	5d                   	pop    %rbp
+  800fde:	c3                   	ret
+
+0000000000800fdf <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800fdf:	55                   	push   %rbp
+  800fe0:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800fe3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800fe6:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800fed:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  800fef:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff4:	bf 06 00 00 00       	mov    $0x6,%edi
+  800ff9:	48 b8 17 0f 80 00 00 	movabs $0x800f17,%rax
+  801000:	00 00 00 
+  801003:	ff d0                	call   *%rax
+}
+  801005:	5d                   	pop    %rbp
+  801006:	c3                   	ret
+
+0000000000801007 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801007:	55                   	push   %rbp
+  801008:	48 89 e5             	mov    %rsp,%rbp
+  80100b:	41 54                	push   %r12
+  80100d:	53                   	push   %rbx
+  80100e:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801011:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801014:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80101b:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80101d:	be 00 00 00 00       	mov    $0x0,%esi
+  801022:	bf 05 00 00 00       	mov    $0x5,%edi
+  801027:	48 b8 17 0f 80 00 00 	movabs $0x800f17,%rax
+  80102e:	00 00 00 
+  801031:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801033:	85 c0                	test   %eax,%eax
+  801035:	78 3d                	js     801074 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801037:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80103e:	00 00 00 
+  801041:	4c 89 e6             	mov    %r12,%rsi
+  801044:	48 89 df             	mov    %rbx,%rdi
+  801047:	48 b8 64 25 80 00 00 	movabs $0x802564,%rax
+  80104e:	00 00 00 
+  801051:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801053:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80105a:	00 
+  80105b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801061:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801068:	00 
+  801069:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80106f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801074:	5b                   	pop    %rbx
+  801075:	41 5c                	pop    %r12
+  801077:	5d                   	pop    %rbp
+  801078:	c3                   	ret
+
+0000000000801079 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801079:	55                   	push   %rbp
+  80107a:	48 89 e5             	mov    %rsp,%rbp
+  80107d:	41 54                	push   %r12
+  80107f:	53                   	push   %rbx
+  801080:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  801083:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  801088:	48 39 c2             	cmp    %rax,%rdx
+  80108b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80108f:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801092:	48 89 c2             	mov    %rax,%rdx
+  801095:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80109c:	00 00 00 
+  80109f:	48 b8 c5 27 80 00 00 	movabs $0x8027c5,%rax
+  8010a6:	00 00 00 
+  8010a9:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8010ab:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8010b2:	00 00 00 
+  8010b5:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8010ba:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8010bc:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8010c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8010ca:	48 b8 17 0f 80 00 00 	movabs $0x800f17,%rax
+  8010d1:	00 00 00 
+  8010d4:	ff d0                	call   *%rax
+  8010d6:	48 98                	cltq
+}
+  8010d8:	5b                   	pop    %rbx
+  8010d9:	41 5c                	pop    %r12
+  8010db:	5d                   	pop    %rbp
+  8010dc:	c3                   	ret
+
+00000000008010dd <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8010dd:	55                   	push   %rbp
+  8010de:	48 89 e5             	mov    %rsp,%rbp
+  8010e1:	41 54                	push   %r12
+  8010e3:	53                   	push   %rbx
+  8010e4:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8010e7:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8010ee:	00 00 00 
+  8010f1:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8010f4:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8010f6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8010fb:	48 39 ca             	cmp    %rcx,%rdx
+  8010fe:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  801102:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  801106:	be 00 00 00 00       	mov    $0x0,%esi
+  80110b:	bf 03 00 00 00       	mov    $0x3,%edi
+  801110:	48 b8 17 0f 80 00 00 	movabs $0x800f17,%rax
+  801117:	00 00 00 
+  80111a:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  80111c:	85 c0                	test   %eax,%eax
+  80111e:	78 27                	js     801147 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  801120:	48 63 d8             	movslq %eax,%rbx
+  801123:	48 89 da             	mov    %rbx,%rdx
+  801126:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80112d:	00 00 00 
+  801130:	4c 89 e7             	mov    %r12,%rdi
+  801133:	48 b8 c5 27 80 00 00 	movabs $0x8027c5,%rax
+  80113a:	00 00 00 
+  80113d:	ff d0                	call   *%rax
+    return bytes_read;
+  80113f:	48 89 d8             	mov    %rbx,%rax
+}
+  801142:	5b                   	pop    %rbx
+  801143:	41 5c                	pop    %r12
+  801145:	5d                   	pop    %rbp
+  801146:	c3                   	ret
+        return bytes_read;
+  801147:	48 98                	cltq
+  801149:	eb f7                	jmp    801142 <devfile_read+0x65>
+
+000000000080114b <open>:
+open(const char *path, int mode) {
+  80114b:	55                   	push   %rbp
+  80114c:	48 89 e5             	mov    %rsp,%rbp
+  80114f:	41 55                	push   %r13
+  801151:	41 54                	push   %r12
+  801153:	53                   	push   %rbx
+  801154:	48 83 ec 18          	sub    $0x18,%rsp
+  801158:	49 89 fc             	mov    %rdi,%r12
+  80115b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80115e:	48 b8 26 25 80 00 00 	movabs $0x802526,%rax
+  801165:	00 00 00 
+  801168:	ff d0                	call   *%rax
+  80116a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801170:	0f 87 8a 00 00 00    	ja     801200 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801176:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80117a:	48 b8 4a 08 80 00 00 	movabs $0x80084a,%rax
+  801181:	00 00 00 
+  801184:	ff d0                	call   *%rax
+  801186:	89 c3                	mov    %eax,%ebx
+  801188:	85 c0                	test   %eax,%eax
+  80118a:	78 50                	js     8011dc <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80118c:	4c 89 e6             	mov    %r12,%rsi
+  80118f:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801196:	00 00 00 
+  801199:	48 89 df             	mov    %rbx,%rdi
+  80119c:	48 b8 64 25 80 00 00 	movabs $0x802564,%rax
+  8011a3:	00 00 00 
+  8011a6:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011a8:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011af:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8011b3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011b8:	48 b8 17 0f 80 00 00 	movabs $0x800f17,%rax
+  8011bf:	00 00 00 
+  8011c2:	ff d0                	call   *%rax
+  8011c4:	89 c3                	mov    %eax,%ebx
+  8011c6:	85 c0                	test   %eax,%eax
+  8011c8:	78 1f                	js     8011e9 <open+0x9e>
+    return fd2num(fd);
+  8011ca:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8011ce:	48 b8 1c 08 80 00 00 	movabs $0x80081c,%rax
+  8011d5:	00 00 00 
+  8011d8:	ff d0                	call   *%rax
+  8011da:	89 c3                	mov    %eax,%ebx
+}
+  8011dc:	89 d8                	mov    %ebx,%eax
+  8011de:	48 83 c4 18          	add    $0x18,%rsp
+  8011e2:	5b                   	pop    %rbx
+  8011e3:	41 5c                	pop    %r12
+  8011e5:	41 5d                	pop    %r13
+  8011e7:	5d                   	pop    %rbp
+  8011e8:	c3                   	ret
+        fd_close(fd, 0);
+  8011e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ee:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8011f2:	48 b8 65 09 80 00 00 	movabs $0x800965,%rax
+  8011f9:	00 00 00 
+  8011fc:	ff d0                	call   *%rax
+        return res;
+  8011fe:	eb dc                	jmp    8011dc <open+0x91>
+        return -E_BAD_PATH;
+  801200:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801205:	eb d5                	jmp    8011dc <open+0x91>
+
+0000000000801207 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801207:	55                   	push   %rbp
+  801208:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80120b:	be 00 00 00 00       	mov    $0x0,%esi
+  801210:	bf 08 00 00 00       	mov    $0x8,%edi
+  801215:	48 b8 17 0f 80 00 00 	movabs $0x800f17,%rax
+  80121c:	00 00 00 
+  80121f:	ff d0                	call   *%rax
+}
+  801221:	5d                   	pop    %rbp
+  801222:	c3                   	ret
+
+0000000000801223 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801223:	55                   	push   %rbp
+  801224:	48 89 e5             	mov    %rsp,%rbp
+  801227:	41 54                	push   %r12
+  801229:	53                   	push   %rbx
+  80122a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80122d:	48 b8 2e 08 80 00 00 	movabs $0x80082e,%rax
+  801234:	00 00 00 
+  801237:	ff d0                	call   *%rax
+  801239:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80123c:	48 be 00 2c 80 00 00 	movabs $0x802c00,%rsi
+  801243:	00 00 00 
+  801246:	48 89 df             	mov    %rbx,%rdi
+  801249:	48 b8 64 25 80 00 00 	movabs $0x802564,%rax
+  801250:	00 00 00 
+  801253:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801255:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80125a:	41 2b 04 24          	sub    (%r12),%eax
+  80125e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801264:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80126b:	00 00 00 
+    stat->st_dev = &devpipe;
+  80126e:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  801275:	00 00 00 
+  801278:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80127f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801284:	5b                   	pop    %rbx
+  801285:	41 5c                	pop    %r12
+  801287:	5d                   	pop    %rbp
+  801288:	c3                   	ret
+
+0000000000801289 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801289:	55                   	push   %rbp
+  80128a:	48 89 e5             	mov    %rsp,%rbp
+  80128d:	41 54                	push   %r12
+  80128f:	53                   	push   %rbx
+  801290:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801293:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801298:	48 89 fe             	mov    %rdi,%rsi
+  80129b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012a0:	49 bc 46 03 80 00 00 	movabs $0x800346,%r12
+  8012a7:	00 00 00 
+  8012aa:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012ad:	48 89 df             	mov    %rbx,%rdi
+  8012b0:	48 b8 2e 08 80 00 00 	movabs $0x80082e,%rax
+  8012b7:	00 00 00 
+  8012ba:	ff d0                	call   *%rax
+  8012bc:	48 89 c6             	mov    %rax,%rsi
+  8012bf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012c9:	41 ff d4             	call   *%r12
+}
+  8012cc:	5b                   	pop    %rbx
+  8012cd:	41 5c                	pop    %r12
+  8012cf:	5d                   	pop    %rbp
+  8012d0:	c3                   	ret
+
+00000000008012d1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8012d1:	55                   	push   %rbp
+  8012d2:	48 89 e5             	mov    %rsp,%rbp
+  8012d5:	41 57                	push   %r15
+  8012d7:	41 56                	push   %r14
+  8012d9:	41 55                	push   %r13
+  8012db:	41 54                	push   %r12
+  8012dd:	53                   	push   %rbx
+  8012de:	48 83 ec 18          	sub    $0x18,%rsp
+  8012e2:	49 89 fc             	mov    %rdi,%r12
+  8012e5:	49 89 f5             	mov    %rsi,%r13
+  8012e8:	49 89 d7             	mov    %rdx,%r15
+  8012eb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8012ef:	48 b8 2e 08 80 00 00 	movabs $0x80082e,%rax
+  8012f6:	00 00 00 
+  8012f9:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8012fb:	4d 85 ff             	test   %r15,%r15
+  8012fe:	0f 84 af 00 00 00    	je     8013b3 <devpipe_write+0xe2>
+  801304:	48 89 c3             	mov    %rax,%rbx
+  801307:	4c 89 f8             	mov    %r15,%rax
+  80130a:	4d 89 ef             	mov    %r13,%r15
+  80130d:	4c 01 e8             	add    %r13,%rax
+  801310:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801314:	49 bd 4e 02 80 00 00 	movabs $0x80024e,%r13
+  80131b:	00 00 00 
+            sys_yield();
+  80131e:	49 be eb 01 80 00 00 	movabs $0x8001eb,%r14
+  801325:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801328:	8b 73 04             	mov    0x4(%rbx),%esi
+  80132b:	48 63 ce             	movslq %esi,%rcx
+  80132e:	48 63 03             	movslq (%rbx),%rax
+  801331:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801337:	48 39 c1             	cmp    %rax,%rcx
+  80133a:	72 2e                	jb     80136a <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80133c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801341:	48 89 da             	mov    %rbx,%rdx
+  801344:	be 00 10 00 00       	mov    $0x1000,%esi
+  801349:	4c 89 e7             	mov    %r12,%rdi
+  80134c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80134f:	85 c0                	test   %eax,%eax
+  801351:	74 66                	je     8013b9 <devpipe_write+0xe8>
+            sys_yield();
+  801353:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801356:	8b 73 04             	mov    0x4(%rbx),%esi
+  801359:	48 63 ce             	movslq %esi,%rcx
+  80135c:	48 63 03             	movslq (%rbx),%rax
+  80135f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801365:	48 39 c1             	cmp    %rax,%rcx
+  801368:	73 d2                	jae    80133c <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80136a:	41 0f b6 3f          	movzbl (%r15),%edi
+  80136e:	48 89 ca             	mov    %rcx,%rdx
+  801371:	48 c1 ea 03          	shr    $0x3,%rdx
+  801375:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80137c:	08 10 20 
+  80137f:	48 f7 e2             	mul    %rdx
+  801382:	48 c1 ea 06          	shr    $0x6,%rdx
+  801386:	48 89 d0             	mov    %rdx,%rax
+  801389:	48 c1 e0 09          	shl    $0x9,%rax
+  80138d:	48 29 d0             	sub    %rdx,%rax
+  801390:	48 c1 e0 03          	shl    $0x3,%rax
+  801394:	48 29 c1             	sub    %rax,%rcx
+  801397:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80139c:	83 c6 01             	add    $0x1,%esi
+  80139f:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013a2:	49 83 c7 01          	add    $0x1,%r15
+  8013a6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013aa:	49 39 c7             	cmp    %rax,%r15
+  8013ad:	0f 85 75 ff ff ff    	jne    801328 <devpipe_write+0x57>
+    return n;
+  8013b3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8013b7:	eb 05                	jmp    8013be <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8013b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013be:	48 83 c4 18          	add    $0x18,%rsp
+  8013c2:	5b                   	pop    %rbx
+  8013c3:	41 5c                	pop    %r12
+  8013c5:	41 5d                	pop    %r13
+  8013c7:	41 5e                	pop    %r14
+  8013c9:	41 5f                	pop    %r15
+  8013cb:	5d                   	pop    %rbp
+  8013cc:	c3                   	ret
+
+00000000008013cd <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8013cd:	55                   	push   %rbp
+  8013ce:	48 89 e5             	mov    %rsp,%rbp
+  8013d1:	41 57                	push   %r15
+  8013d3:	41 56                	push   %r14
+  8013d5:	41 55                	push   %r13
+  8013d7:	41 54                	push   %r12
+  8013d9:	53                   	push   %rbx
+  8013da:	48 83 ec 18          	sub    $0x18,%rsp
+  8013de:	49 89 fc             	mov    %rdi,%r12
+  8013e1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8013e5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8013e9:	48 b8 2e 08 80 00 00 	movabs $0x80082e,%rax
+  8013f0:	00 00 00 
+  8013f3:	ff d0                	call   *%rax
+  8013f5:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8013f8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8013fe:	49 bd 4e 02 80 00 00 	movabs $0x80024e,%r13
+  801405:	00 00 00 
+            sys_yield();
+  801408:	49 be eb 01 80 00 00 	movabs $0x8001eb,%r14
+  80140f:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801412:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801417:	74 7d                	je     801496 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801419:	8b 03                	mov    (%rbx),%eax
+  80141b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80141e:	75 26                	jne    801446 <devpipe_read+0x79>
+            if (i > 0) return i;
+  801420:	4d 85 ff             	test   %r15,%r15
+  801423:	75 77                	jne    80149c <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801425:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80142a:	48 89 da             	mov    %rbx,%rdx
+  80142d:	be 00 10 00 00       	mov    $0x1000,%esi
+  801432:	4c 89 e7             	mov    %r12,%rdi
+  801435:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801438:	85 c0                	test   %eax,%eax
+  80143a:	74 72                	je     8014ae <devpipe_read+0xe1>
+            sys_yield();
+  80143c:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80143f:	8b 03                	mov    (%rbx),%eax
+  801441:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801444:	74 df                	je     801425 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801446:	48 63 c8             	movslq %eax,%rcx
+  801449:	48 89 ca             	mov    %rcx,%rdx
+  80144c:	48 c1 ea 03          	shr    $0x3,%rdx
+  801450:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801457:	08 10 20 
+  80145a:	48 89 d0             	mov    %rdx,%rax
+  80145d:	48 f7 e6             	mul    %rsi
+  801460:	48 c1 ea 06          	shr    $0x6,%rdx
+  801464:	48 89 d0             	mov    %rdx,%rax
+  801467:	48 c1 e0 09          	shl    $0x9,%rax
+  80146b:	48 29 d0             	sub    %rdx,%rax
+  80146e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801475:	00 
+  801476:	48 89 c8             	mov    %rcx,%rax
+  801479:	48 29 d0             	sub    %rdx,%rax
+  80147c:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801481:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801485:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801489:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80148c:	49 83 c7 01          	add    $0x1,%r15
+  801490:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801494:	75 83                	jne    801419 <devpipe_read+0x4c>
+    return n;
+  801496:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80149a:	eb 03                	jmp    80149f <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80149c:	4c 89 f8             	mov    %r15,%rax
+}
+  80149f:	48 83 c4 18          	add    $0x18,%rsp
+  8014a3:	5b                   	pop    %rbx
+  8014a4:	41 5c                	pop    %r12
+  8014a6:	41 5d                	pop    %r13
+  8014a8:	41 5e                	pop    %r14
+  8014aa:	41 5f                	pop    %r15
+  8014ac:	5d                   	pop    %rbp
+  8014ad:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b3:	eb ea                	jmp    80149f <devpipe_read+0xd2>
+
+00000000008014b5 <pipe>:
+pipe(int pfd[2]) {
+  8014b5:	55                   	push   %rbp
+  8014b6:	48 89 e5             	mov    %rsp,%rbp
+  8014b9:	41 55                	push   %r13
+  8014bb:	41 54                	push   %r12
+  8014bd:	53                   	push   %rbx
+  8014be:	48 83 ec 18          	sub    $0x18,%rsp
+  8014c2:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8014c5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8014c9:	48 b8 4a 08 80 00 00 	movabs $0x80084a,%rax
+  8014d0:	00 00 00 
+  8014d3:	ff d0                	call   *%rax
+  8014d5:	89 c3                	mov    %eax,%ebx
+  8014d7:	85 c0                	test   %eax,%eax
+  8014d9:	0f 88 a0 01 00 00    	js     80167f <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8014df:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8014e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8014e9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8014ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014f2:	48 b8 7a 02 80 00 00 	movabs $0x80027a,%rax
+  8014f9:	00 00 00 
+  8014fc:	ff d0                	call   *%rax
+  8014fe:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801500:	85 c0                	test   %eax,%eax
+  801502:	0f 88 77 01 00 00    	js     80167f <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801508:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80150c:	48 b8 4a 08 80 00 00 	movabs $0x80084a,%rax
+  801513:	00 00 00 
+  801516:	ff d0                	call   *%rax
+  801518:	89 c3                	mov    %eax,%ebx
+  80151a:	85 c0                	test   %eax,%eax
+  80151c:	0f 88 43 01 00 00    	js     801665 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801522:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801527:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80152c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801530:	bf 00 00 00 00       	mov    $0x0,%edi
+  801535:	48 b8 7a 02 80 00 00 	movabs $0x80027a,%rax
+  80153c:	00 00 00 
+  80153f:	ff d0                	call   *%rax
+  801541:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801543:	85 c0                	test   %eax,%eax
+  801545:	0f 88 1a 01 00 00    	js     801665 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80154b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80154f:	48 b8 2e 08 80 00 00 	movabs $0x80082e,%rax
+  801556:	00 00 00 
+  801559:	ff d0                	call   *%rax
+  80155b:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80155e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801563:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801568:	48 89 c6             	mov    %rax,%rsi
+  80156b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801570:	48 b8 7a 02 80 00 00 	movabs $0x80027a,%rax
+  801577:	00 00 00 
+  80157a:	ff d0                	call   *%rax
+  80157c:	89 c3                	mov    %eax,%ebx
+  80157e:	85 c0                	test   %eax,%eax
+  801580:	0f 88 c5 00 00 00    	js     80164b <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801586:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80158a:	48 b8 2e 08 80 00 00 	movabs $0x80082e,%rax
+  801591:	00 00 00 
+  801594:	ff d0                	call   *%rax
+  801596:	48 89 c1             	mov    %rax,%rcx
+  801599:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80159f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8015a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015aa:	4c 89 ee             	mov    %r13,%rsi
+  8015ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015b2:	48 b8 e1 02 80 00 00 	movabs $0x8002e1,%rax
+  8015b9:	00 00 00 
+  8015bc:	ff d0                	call   *%rax
+  8015be:	89 c3                	mov    %eax,%ebx
+  8015c0:	85 c0                	test   %eax,%eax
+  8015c2:	78 6e                	js     801632 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8015c4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8015c9:	4c 89 ef             	mov    %r13,%rdi
+  8015cc:	48 b8 1c 02 80 00 00 	movabs $0x80021c,%rax
+  8015d3:	00 00 00 
+  8015d6:	ff d0                	call   *%rax
+  8015d8:	83 f8 02             	cmp    $0x2,%eax
+  8015db:	0f 85 ab 00 00 00    	jne    80168c <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8015e1:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8015e8:	00 00 
+  8015ea:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8015ee:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8015f0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8015f4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8015fb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8015ff:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801601:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801605:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80160c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801610:	48 bb 1c 08 80 00 00 	movabs $0x80081c,%rbx
+  801617:	00 00 00 
+  80161a:	ff d3                	call   *%rbx
+  80161c:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801620:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801624:	ff d3                	call   *%rbx
+  801626:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80162b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801630:	eb 4d                	jmp    80167f <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  801632:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801637:	4c 89 ee             	mov    %r13,%rsi
+  80163a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80163f:	48 b8 46 03 80 00 00 	movabs $0x800346,%rax
+  801646:	00 00 00 
+  801649:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80164b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801650:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801654:	bf 00 00 00 00       	mov    $0x0,%edi
+  801659:	48 b8 46 03 80 00 00 	movabs $0x800346,%rax
+  801660:	00 00 00 
+  801663:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  801665:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80166a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80166e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801673:	48 b8 46 03 80 00 00 	movabs $0x800346,%rax
+  80167a:	00 00 00 
+  80167d:	ff d0                	call   *%rax
+}
+  80167f:	89 d8                	mov    %ebx,%eax
+  801681:	48 83 c4 18          	add    $0x18,%rsp
+  801685:	5b                   	pop    %rbx
+  801686:	41 5c                	pop    %r12
+  801688:	41 5d                	pop    %r13
+  80168a:	5d                   	pop    %rbp
+  80168b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80168c:	48 b9 30 2c 80 00 00 	movabs $0x802c30,%rcx
+  801693:	00 00 00 
+  801696:	48 ba 07 2c 80 00 00 	movabs $0x802c07,%rdx
+  80169d:	00 00 00 
+  8016a0:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8016a5:	48 bf 1c 2c 80 00 00 	movabs $0x802c1c,%rdi
+  8016ac:	00 00 00 
+  8016af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b4:	49 b8 ef 1a 80 00 00 	movabs $0x801aef,%r8
+  8016bb:	00 00 00 
+  8016be:	41 ff d0             	call   *%r8
+
+00000000008016c1 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8016c1:	55                   	push   %rbp
+  8016c2:	48 89 e5             	mov    %rsp,%rbp
+  8016c5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8016c9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8016cd:	48 b8 aa 08 80 00 00 	movabs $0x8008aa,%rax
+  8016d4:	00 00 00 
+  8016d7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8016d9:	85 c0                	test   %eax,%eax
+  8016db:	78 35                	js     801712 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8016dd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8016e1:	48 b8 2e 08 80 00 00 	movabs $0x80082e,%rax
+  8016e8:	00 00 00 
+  8016eb:	ff d0                	call   *%rax
+  8016ed:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8016f0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8016f5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8016fa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8016fe:	48 b8 4e 02 80 00 00 	movabs $0x80024e,%rax
+  801705:	00 00 00 
+  801708:	ff d0                	call   *%rax
+  80170a:	85 c0                	test   %eax,%eax
+  80170c:	0f 94 c0             	sete   %al
+  80170f:	0f b6 c0             	movzbl %al,%eax
+}
+  801712:	c9                   	leave
+  801713:	c3                   	ret
+
+0000000000801714 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801714:	48 89 f8             	mov    %rdi,%rax
+  801717:	48 c1 e8 27          	shr    $0x27,%rax
+  80171b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801722:	01 00 00 
+  801725:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801729:	f6 c2 01             	test   $0x1,%dl
+  80172c:	74 6d                	je     80179b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80172e:	48 89 f8             	mov    %rdi,%rax
+  801731:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801735:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80173c:	01 00 00 
+  80173f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801743:	f6 c2 01             	test   $0x1,%dl
+  801746:	74 62                	je     8017aa <get_uvpt_entry+0x96>
+  801748:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80174f:	01 00 00 
+  801752:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801756:	f6 c2 80             	test   $0x80,%dl
+  801759:	75 4f                	jne    8017aa <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80175b:	48 89 f8             	mov    %rdi,%rax
+  80175e:	48 c1 e8 15          	shr    $0x15,%rax
+  801762:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801769:	01 00 00 
+  80176c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801770:	f6 c2 01             	test   $0x1,%dl
+  801773:	74 44                	je     8017b9 <get_uvpt_entry+0xa5>
+  801775:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80177c:	01 00 00 
+  80177f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801783:	f6 c2 80             	test   $0x80,%dl
+  801786:	75 31                	jne    8017b9 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  801788:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80178c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801793:	01 00 00 
+  801796:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80179a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80179b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017a2:	01 00 00 
+  8017a5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017a9:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017aa:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017b1:	01 00 00 
+  8017b4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017b8:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017b9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017c0:	01 00 00 
+  8017c3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017c7:	c3                   	ret
+
+00000000008017c8 <get_prot>:
+
+int
+get_prot(void *va) {
+  8017c8:	55                   	push   %rbp
+  8017c9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8017cc:	48 b8 14 17 80 00 00 	movabs $0x801714,%rax
+  8017d3:	00 00 00 
+  8017d6:	ff d0                	call   *%rax
+  8017d8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8017db:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8017e0:	89 c1                	mov    %eax,%ecx
+  8017e2:	83 c9 04             	or     $0x4,%ecx
+  8017e5:	f6 c2 01             	test   $0x1,%dl
+  8017e8:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8017eb:	89 c1                	mov    %eax,%ecx
+  8017ed:	83 c9 02             	or     $0x2,%ecx
+  8017f0:	f6 c2 02             	test   $0x2,%dl
+  8017f3:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8017f6:	89 c1                	mov    %eax,%ecx
+  8017f8:	83 c9 01             	or     $0x1,%ecx
+  8017fb:	48 85 d2             	test   %rdx,%rdx
+  8017fe:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801801:	89 c1                	mov    %eax,%ecx
+  801803:	83 c9 40             	or     $0x40,%ecx
+  801806:	f6 c6 04             	test   $0x4,%dh
+  801809:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80180c:	5d                   	pop    %rbp
+  80180d:	c3                   	ret
+
+000000000080180e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80180e:	55                   	push   %rbp
+  80180f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801812:	48 b8 14 17 80 00 00 	movabs $0x801714,%rax
+  801819:	00 00 00 
+  80181c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80181e:	48 c1 e8 06          	shr    $0x6,%rax
+  801822:	83 e0 01             	and    $0x1,%eax
+}
+  801825:	5d                   	pop    %rbp
+  801826:	c3                   	ret
+
+0000000000801827 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  801827:	55                   	push   %rbp
+  801828:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80182b:	48 b8 14 17 80 00 00 	movabs $0x801714,%rax
+  801832:	00 00 00 
+  801835:	ff d0                	call   *%rax
+  801837:	83 e0 01             	and    $0x1,%eax
+}
+  80183a:	5d                   	pop    %rbp
+  80183b:	c3                   	ret
+
+000000000080183c <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80183c:	55                   	push   %rbp
+  80183d:	48 89 e5             	mov    %rsp,%rbp
+  801840:	41 57                	push   %r15
+  801842:	41 56                	push   %r14
+  801844:	41 55                	push   %r13
+  801846:	41 54                	push   %r12
+  801848:	53                   	push   %rbx
+  801849:	48 83 ec 18          	sub    $0x18,%rsp
+  80184d:	49 89 ff             	mov    %rdi,%r15
+  801850:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  801854:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  801859:	49 bc 27 18 80 00 00 	movabs $0x801827,%r12
+  801860:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  801863:	49 be c8 17 80 00 00 	movabs $0x8017c8,%r14
+  80186a:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80186d:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  801874:	00 00 00 
+  801877:	eb 0c                	jmp    801885 <foreach_shared_region+0x49>
+  801879:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801880:	4c 39 eb             	cmp    %r13,%rbx
+  801883:	74 38                	je     8018bd <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  801885:	48 89 df             	mov    %rbx,%rdi
+  801888:	41 ff d4             	call   *%r12
+  80188b:	84 c0                	test   %al,%al
+  80188d:	74 ea                	je     801879 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  80188f:	48 89 df             	mov    %rbx,%rdi
+  801892:	41 ff d6             	call   *%r14
+  801895:	a8 40                	test   $0x40,%al
+  801897:	74 e0                	je     801879 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  801899:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8018a0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8018a4:	48 89 df             	mov    %rbx,%rdi
+  8018a7:	41 ff d7             	call   *%r15
+        if (err)
+  8018aa:	85 c0                	test   %eax,%eax
+  8018ac:	74 cb                	je     801879 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8018ae:	48 83 c4 18          	add    $0x18,%rsp
+  8018b2:	5b                   	pop    %rbx
+  8018b3:	41 5c                	pop    %r12
+  8018b5:	41 5d                	pop    %r13
+  8018b7:	41 5e                	pop    %r14
+  8018b9:	41 5f                	pop    %r15
+  8018bb:	5d                   	pop    %rbp
+  8018bc:	c3                   	ret
+    return 0;
+  8018bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c2:	eb ea                	jmp    8018ae <foreach_shared_region+0x72>
+
+00000000008018c4 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8018c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c9:	c3                   	ret
+
+00000000008018ca <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8018ca:	55                   	push   %rbp
+  8018cb:	48 89 e5             	mov    %rsp,%rbp
+  8018ce:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8018d1:	48 be 54 2c 80 00 00 	movabs $0x802c54,%rsi
+  8018d8:	00 00 00 
+  8018db:	48 b8 64 25 80 00 00 	movabs $0x802564,%rax
+  8018e2:	00 00 00 
+  8018e5:	ff d0                	call   *%rax
+    return 0;
+}
+  8018e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ec:	5d                   	pop    %rbp
+  8018ed:	c3                   	ret
+
+00000000008018ee <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8018ee:	55                   	push   %rbp
+  8018ef:	48 89 e5             	mov    %rsp,%rbp
+  8018f2:	41 57                	push   %r15
+  8018f4:	41 56                	push   %r14
+  8018f6:	41 55                	push   %r13
+  8018f8:	41 54                	push   %r12
+  8018fa:	53                   	push   %rbx
+  8018fb:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801902:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801909:	48 85 d2             	test   %rdx,%rdx
+  80190c:	74 7a                	je     801988 <devcons_write+0x9a>
+  80190e:	49 89 d6             	mov    %rdx,%r14
+  801911:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801917:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80191c:	49 bf 5e 27 80 00 00 	movabs $0x80275e,%r15
+  801923:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801926:	4c 89 f3             	mov    %r14,%rbx
+  801929:	48 29 f3             	sub    %rsi,%rbx
+  80192c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801931:	48 39 c3             	cmp    %rax,%rbx
+  801934:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801938:	4c 63 eb             	movslq %ebx,%r13
+  80193b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801942:	48 01 c6             	add    %rax,%rsi
+  801945:	4c 89 ea             	mov    %r13,%rdx
+  801948:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80194f:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801952:	4c 89 ee             	mov    %r13,%rsi
+  801955:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80195c:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  801963:	00 00 00 
+  801966:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801968:	41 01 dc             	add    %ebx,%r12d
+  80196b:	49 63 f4             	movslq %r12d,%rsi
+  80196e:	4c 39 f6             	cmp    %r14,%rsi
+  801971:	72 b3                	jb     801926 <devcons_write+0x38>
+    return res;
+  801973:	49 63 c4             	movslq %r12d,%rax
+}
+  801976:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80197d:	5b                   	pop    %rbx
+  80197e:	41 5c                	pop    %r12
+  801980:	41 5d                	pop    %r13
+  801982:	41 5e                	pop    %r14
+  801984:	41 5f                	pop    %r15
+  801986:	5d                   	pop    %rbp
+  801987:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801988:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80198e:	eb e3                	jmp    801973 <devcons_write+0x85>
+
+0000000000801990 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801990:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801993:	ba 00 00 00 00       	mov    $0x0,%edx
+  801998:	48 85 c0             	test   %rax,%rax
+  80199b:	74 55                	je     8019f2 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80199d:	55                   	push   %rbp
+  80199e:	48 89 e5             	mov    %rsp,%rbp
+  8019a1:	41 55                	push   %r13
+  8019a3:	41 54                	push   %r12
+  8019a5:	53                   	push   %rbx
+  8019a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8019aa:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8019ad:	48 bb 1e 01 80 00 00 	movabs $0x80011e,%rbx
+  8019b4:	00 00 00 
+  8019b7:	49 bc eb 01 80 00 00 	movabs $0x8001eb,%r12
+  8019be:	00 00 00 
+  8019c1:	eb 03                	jmp    8019c6 <devcons_read+0x36>
+  8019c3:	41 ff d4             	call   *%r12
+  8019c6:	ff d3                	call   *%rbx
+  8019c8:	85 c0                	test   %eax,%eax
+  8019ca:	74 f7                	je     8019c3 <devcons_read+0x33>
+    if (c < 0) return c;
+  8019cc:	48 63 d0             	movslq %eax,%rdx
+  8019cf:	78 13                	js     8019e4 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8019d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019d6:	83 f8 04             	cmp    $0x4,%eax
+  8019d9:	74 09                	je     8019e4 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8019db:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8019df:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8019e4:	48 89 d0             	mov    %rdx,%rax
+  8019e7:	48 83 c4 08          	add    $0x8,%rsp
+  8019eb:	5b                   	pop    %rbx
+  8019ec:	41 5c                	pop    %r12
+  8019ee:	41 5d                	pop    %r13
+  8019f0:	5d                   	pop    %rbp
+  8019f1:	c3                   	ret
+  8019f2:	48 89 d0             	mov    %rdx,%rax
+  8019f5:	c3                   	ret
+
+00000000008019f6 <cputchar>:
+cputchar(int ch) {
+  8019f6:	55                   	push   %rbp
+  8019f7:	48 89 e5             	mov    %rsp,%rbp
+  8019fa:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8019fe:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801a02:	be 01 00 00 00       	mov    $0x1,%esi
+  801a07:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801a0b:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  801a12:	00 00 00 
+  801a15:	ff d0                	call   *%rax
+}
+  801a17:	c9                   	leave
+  801a18:	c3                   	ret
+
+0000000000801a19 <getchar>:
+getchar(void) {
+  801a19:	55                   	push   %rbp
+  801a1a:	48 89 e5             	mov    %rsp,%rbp
+  801a1d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801a21:	ba 01 00 00 00       	mov    $0x1,%edx
+  801a26:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801a2a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a2f:	48 b8 8d 0b 80 00 00 	movabs $0x800b8d,%rax
+  801a36:	00 00 00 
+  801a39:	ff d0                	call   *%rax
+  801a3b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801a3d:	85 c0                	test   %eax,%eax
+  801a3f:	78 06                	js     801a47 <getchar+0x2e>
+  801a41:	74 08                	je     801a4b <getchar+0x32>
+  801a43:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801a47:	89 d0                	mov    %edx,%eax
+  801a49:	c9                   	leave
+  801a4a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801a4b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801a50:	eb f5                	jmp    801a47 <getchar+0x2e>
+
+0000000000801a52 <iscons>:
+iscons(int fdnum) {
+  801a52:	55                   	push   %rbp
+  801a53:	48 89 e5             	mov    %rsp,%rbp
+  801a56:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801a5a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a5e:	48 b8 aa 08 80 00 00 	movabs $0x8008aa,%rax
+  801a65:	00 00 00 
+  801a68:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a6a:	85 c0                	test   %eax,%eax
+  801a6c:	78 18                	js     801a86 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801a6e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a72:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801a79:	00 00 00 
+  801a7c:	8b 00                	mov    (%rax),%eax
+  801a7e:	39 02                	cmp    %eax,(%rdx)
+  801a80:	0f 94 c0             	sete   %al
+  801a83:	0f b6 c0             	movzbl %al,%eax
+}
+  801a86:	c9                   	leave
+  801a87:	c3                   	ret
+
+0000000000801a88 <opencons>:
+opencons(void) {
+  801a88:	55                   	push   %rbp
+  801a89:	48 89 e5             	mov    %rsp,%rbp
+  801a8c:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801a90:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801a94:	48 b8 4a 08 80 00 00 	movabs $0x80084a,%rax
+  801a9b:	00 00 00 
+  801a9e:	ff d0                	call   *%rax
+  801aa0:	85 c0                	test   %eax,%eax
+  801aa2:	78 49                	js     801aed <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801aa4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801aa9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801aae:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801ab2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ab7:	48 b8 7a 02 80 00 00 	movabs $0x80027a,%rax
+  801abe:	00 00 00 
+  801ac1:	ff d0                	call   *%rax
+  801ac3:	85 c0                	test   %eax,%eax
+  801ac5:	78 26                	js     801aed <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801ac7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801acb:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801ad2:	00 00 
+  801ad4:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801ad6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801ada:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801ae1:	48 b8 1c 08 80 00 00 	movabs $0x80081c,%rax
+  801ae8:	00 00 00 
+  801aeb:	ff d0                	call   *%rax
+}
+  801aed:	c9                   	leave
+  801aee:	c3                   	ret
+
+0000000000801aef <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801aef:	55                   	push   %rbp
+  801af0:	48 89 e5             	mov    %rsp,%rbp
+  801af3:	41 56                	push   %r14
+  801af5:	41 55                	push   %r13
+  801af7:	41 54                	push   %r12
+  801af9:	53                   	push   %rbx
+  801afa:	48 83 ec 50          	sub    $0x50,%rsp
+  801afe:	49 89 fc             	mov    %rdi,%r12
+  801b01:	41 89 f5             	mov    %esi,%r13d
+  801b04:	48 89 d3             	mov    %rdx,%rbx
+  801b07:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b0b:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801b0f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801b13:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801b1a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b1e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801b22:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801b26:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801b2a:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801b31:	00 00 00 
+  801b34:	4c 8b 30             	mov    (%rax),%r14
+  801b37:	48 b8 ba 01 80 00 00 	movabs $0x8001ba,%rax
+  801b3e:	00 00 00 
+  801b41:	ff d0                	call   *%rax
+  801b43:	89 c6                	mov    %eax,%esi
+  801b45:	45 89 e8             	mov    %r13d,%r8d
+  801b48:	4c 89 e1             	mov    %r12,%rcx
+  801b4b:	4c 89 f2             	mov    %r14,%rdx
+  801b4e:	48 bf 60 2c 80 00 00 	movabs $0x802c60,%rdi
+  801b55:	00 00 00 
+  801b58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5d:	49 bc 3f 1c 80 00 00 	movabs $0x801c3f,%r12
+  801b64:	00 00 00 
+  801b67:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801b6a:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801b6e:	48 89 df             	mov    %rbx,%rdi
+  801b71:	48 b8 db 1b 80 00 00 	movabs $0x801bdb,%rax
+  801b78:	00 00 00 
+  801b7b:	ff d0                	call   *%rax
+    cprintf("\n");
+  801b7d:	48 bf ab 2b 80 00 00 	movabs $0x802bab,%rdi
+  801b84:	00 00 00 
+  801b87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b8c:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801b8f:	cc                   	int3
+  801b90:	eb fd                	jmp    801b8f <_panic+0xa0>
+
+0000000000801b92 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801b92:	55                   	push   %rbp
+  801b93:	48 89 e5             	mov    %rsp,%rbp
+  801b96:	53                   	push   %rbx
+  801b97:	48 83 ec 08          	sub    $0x8,%rsp
+  801b9b:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801b9e:	8b 06                	mov    (%rsi),%eax
+  801ba0:	8d 50 01             	lea    0x1(%rax),%edx
+  801ba3:	89 16                	mov    %edx,(%rsi)
+  801ba5:	48 98                	cltq
+  801ba7:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801bac:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801bb2:	74 0a                	je     801bbe <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801bb4:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801bb8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bbc:	c9                   	leave
+  801bbd:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801bbe:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801bc2:	be ff 00 00 00       	mov    $0xff,%esi
+  801bc7:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  801bce:	00 00 00 
+  801bd1:	ff d0                	call   *%rax
+        state->offset = 0;
+  801bd3:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801bd9:	eb d9                	jmp    801bb4 <putch+0x22>
+
+0000000000801bdb <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801bdb:	55                   	push   %rbp
+  801bdc:	48 89 e5             	mov    %rsp,%rbp
+  801bdf:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801be6:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801be9:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801bf0:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bfa:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801bfd:	48 89 f1             	mov    %rsi,%rcx
+  801c00:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801c07:	48 bf 92 1b 80 00 00 	movabs $0x801b92,%rdi
+  801c0e:	00 00 00 
+  801c11:	48 b8 8f 1d 80 00 00 	movabs $0x801d8f,%rax
+  801c18:	00 00 00 
+  801c1b:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801c1d:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801c24:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801c2b:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  801c32:	00 00 00 
+  801c35:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801c37:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801c3d:	c9                   	leave
+  801c3e:	c3                   	ret
+
+0000000000801c3f <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801c3f:	55                   	push   %rbp
+  801c40:	48 89 e5             	mov    %rsp,%rbp
+  801c43:	48 83 ec 50          	sub    $0x50,%rsp
+  801c47:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801c4b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801c4f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c53:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801c57:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801c5b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801c62:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c6a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801c6e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801c72:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801c76:	48 b8 db 1b 80 00 00 	movabs $0x801bdb,%rax
+  801c7d:	00 00 00 
+  801c80:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801c82:	c9                   	leave
+  801c83:	c3                   	ret
+
+0000000000801c84 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801c84:	55                   	push   %rbp
+  801c85:	48 89 e5             	mov    %rsp,%rbp
+  801c88:	41 57                	push   %r15
+  801c8a:	41 56                	push   %r14
+  801c8c:	41 55                	push   %r13
+  801c8e:	41 54                	push   %r12
+  801c90:	53                   	push   %rbx
+  801c91:	48 83 ec 18          	sub    $0x18,%rsp
+  801c95:	49 89 fc             	mov    %rdi,%r12
+  801c98:	49 89 f5             	mov    %rsi,%r13
+  801c9b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c9f:	8b 45 10             	mov    0x10(%rbp),%eax
+  801ca2:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801ca5:	41 89 cf             	mov    %ecx,%r15d
+  801ca8:	4c 39 fa             	cmp    %r15,%rdx
+  801cab:	73 5b                	jae    801d08 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801cad:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801cb1:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801cb5:	85 db                	test   %ebx,%ebx
+  801cb7:	7e 0e                	jle    801cc7 <print_num+0x43>
+            putch(padc, put_arg);
+  801cb9:	4c 89 ee             	mov    %r13,%rsi
+  801cbc:	44 89 f7             	mov    %r14d,%edi
+  801cbf:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801cc2:	83 eb 01             	sub    $0x1,%ebx
+  801cc5:	75 f2                	jne    801cb9 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801cc7:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801ccb:	48 b9 94 2c 80 00 00 	movabs $0x802c94,%rcx
+  801cd2:	00 00 00 
+  801cd5:	48 b8 83 2c 80 00 00 	movabs $0x802c83,%rax
+  801cdc:	00 00 00 
+  801cdf:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801ce3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ce7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cec:	49 f7 f7             	div    %r15
+  801cef:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801cf3:	4c 89 ee             	mov    %r13,%rsi
+  801cf6:	41 ff d4             	call   *%r12
+}
+  801cf9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801cfd:	5b                   	pop    %rbx
+  801cfe:	41 5c                	pop    %r12
+  801d00:	41 5d                	pop    %r13
+  801d02:	41 5e                	pop    %r14
+  801d04:	41 5f                	pop    %r15
+  801d06:	5d                   	pop    %rbp
+  801d07:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801d08:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d11:	49 f7 f7             	div    %r15
+  801d14:	48 83 ec 08          	sub    $0x8,%rsp
+  801d18:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801d1c:	52                   	push   %rdx
+  801d1d:	45 0f be c9          	movsbl %r9b,%r9d
+  801d21:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801d25:	48 89 c2             	mov    %rax,%rdx
+  801d28:	48 b8 84 1c 80 00 00 	movabs $0x801c84,%rax
+  801d2f:	00 00 00 
+  801d32:	ff d0                	call   *%rax
+  801d34:	48 83 c4 10          	add    $0x10,%rsp
+  801d38:	eb 8d                	jmp    801cc7 <print_num+0x43>
+
+0000000000801d3a <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801d3a:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801d3e:	48 8b 06             	mov    (%rsi),%rax
+  801d41:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801d45:	73 0a                	jae    801d51 <sprintputch+0x17>
+        *state->start++ = ch;
+  801d47:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d4b:	48 89 16             	mov    %rdx,(%rsi)
+  801d4e:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801d51:	c3                   	ret
+
+0000000000801d52 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801d52:	55                   	push   %rbp
+  801d53:	48 89 e5             	mov    %rsp,%rbp
+  801d56:	48 83 ec 50          	sub    $0x50,%rsp
+  801d5a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d5e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d62:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801d66:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801d6d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d75:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801d79:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801d7d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801d81:	48 b8 8f 1d 80 00 00 	movabs $0x801d8f,%rax
+  801d88:	00 00 00 
+  801d8b:	ff d0                	call   *%rax
+}
+  801d8d:	c9                   	leave
+  801d8e:	c3                   	ret
+
+0000000000801d8f <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801d8f:	55                   	push   %rbp
+  801d90:	48 89 e5             	mov    %rsp,%rbp
+  801d93:	41 57                	push   %r15
+  801d95:	41 56                	push   %r14
+  801d97:	41 55                	push   %r13
+  801d99:	41 54                	push   %r12
+  801d9b:	53                   	push   %rbx
+  801d9c:	48 83 ec 38          	sub    $0x38,%rsp
+  801da0:	49 89 fe             	mov    %rdi,%r14
+  801da3:	49 89 f5             	mov    %rsi,%r13
+  801da6:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801da9:	48 8b 01             	mov    (%rcx),%rax
+  801dac:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801db0:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801db4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801db8:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801dbc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801dc0:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801dc4:	0f b6 3b             	movzbl (%rbx),%edi
+  801dc7:	40 80 ff 25          	cmp    $0x25,%dil
+  801dcb:	74 18                	je     801de5 <vprintfmt+0x56>
+            if (!ch) return;
+  801dcd:	40 84 ff             	test   %dil,%dil
+  801dd0:	0f 84 b1 06 00 00    	je     802487 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801dd6:	40 0f b6 ff          	movzbl %dil,%edi
+  801dda:	4c 89 ee             	mov    %r13,%rsi
+  801ddd:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801de0:	4c 89 e3             	mov    %r12,%rbx
+  801de3:	eb db                	jmp    801dc0 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801de5:	be 00 00 00 00       	mov    $0x0,%esi
+  801dea:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801dee:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801df3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801df9:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801e00:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e04:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801e09:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801e0e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801e11:	83 e8 23             	sub    $0x23,%eax
+  801e14:	3c 57                	cmp    $0x57,%al
+  801e16:	0f 87 51 06 00 00    	ja     80246d <vprintfmt+0x6de>
+  801e1c:	0f b6 c0             	movzbl %al,%eax
+  801e1f:	48 b9 40 2e 80 00 00 	movabs $0x802e40,%rcx
+  801e26:	00 00 00 
+  801e29:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801e2c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801e2f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801e33:	eb cf                	jmp    801e04 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801e35:	49 89 dc             	mov    %rbx,%r12
+  801e38:	be 01 00 00 00       	mov    $0x1,%esi
+  801e3d:	eb c5                	jmp    801e04 <vprintfmt+0x75>
+            padc = ch;
+  801e3f:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801e43:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e46:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801e49:	eb b9                	jmp    801e04 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e4e:	83 f8 2f             	cmp    $0x2f,%eax
+  801e51:	77 24                	ja     801e77 <vprintfmt+0xe8>
+  801e53:	89 c1                	mov    %eax,%ecx
+  801e55:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801e59:	83 c0 08             	add    $0x8,%eax
+  801e5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e5f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801e62:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801e65:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801e69:	79 99                	jns    801e04 <vprintfmt+0x75>
+                width = precision;
+  801e6b:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801e6f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e75:	eb 8d                	jmp    801e04 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e77:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e7b:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801e7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e83:	eb da                	jmp    801e5f <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801e85:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801e8a:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801e8e:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801e94:	3c 39                	cmp    $0x39,%al
+  801e96:	77 1c                	ja     801eb4 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801e98:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801e9c:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801ea0:	0f b6 c0             	movzbl %al,%eax
+  801ea3:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801ea8:	0f b6 03             	movzbl (%rbx),%eax
+  801eab:	3c 39                	cmp    $0x39,%al
+  801ead:	76 e9                	jbe    801e98 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801eaf:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801eb2:	eb b1                	jmp    801e65 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801eb4:	49 89 dc             	mov    %rbx,%r12
+  801eb7:	eb ac                	jmp    801e65 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801eb9:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801ebc:	85 c9                	test   %ecx,%ecx
+  801ebe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec3:	0f 49 c1             	cmovns %ecx,%eax
+  801ec6:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801ec9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ecc:	e9 33 ff ff ff       	jmp    801e04 <vprintfmt+0x75>
+            lflag++;
+  801ed1:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ed4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ed7:	e9 28 ff ff ff       	jmp    801e04 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801edc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801edf:	83 f8 2f             	cmp    $0x2f,%eax
+  801ee2:	77 19                	ja     801efd <vprintfmt+0x16e>
+  801ee4:	89 c2                	mov    %eax,%edx
+  801ee6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801eea:	83 c0 08             	add    $0x8,%eax
+  801eed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ef0:	8b 3a                	mov    (%rdx),%edi
+  801ef2:	4c 89 ee             	mov    %r13,%rsi
+  801ef5:	41 ff d6             	call   *%r14
+            break;
+  801ef8:	e9 c3 fe ff ff       	jmp    801dc0 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  801efd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f01:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f09:	eb e5                	jmp    801ef0 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  801f0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f0e:	83 f8 2f             	cmp    $0x2f,%eax
+  801f11:	77 5a                	ja     801f6d <vprintfmt+0x1de>
+  801f13:	89 c2                	mov    %eax,%edx
+  801f15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f19:	83 c0 08             	add    $0x8,%eax
+  801f1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801f1f:	8b 02                	mov    (%rdx),%eax
+  801f21:	89 c1                	mov    %eax,%ecx
+  801f23:	f7 d9                	neg    %ecx
+  801f25:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801f28:	83 f9 15             	cmp    $0x15,%ecx
+  801f2b:	7f 4e                	jg     801f7b <vprintfmt+0x1ec>
+  801f2d:	48 63 c1             	movslq %ecx,%rax
+  801f30:	48 ba 00 31 80 00 00 	movabs $0x803100,%rdx
+  801f37:	00 00 00 
+  801f3a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801f3e:	48 85 c0             	test   %rax,%rax
+  801f41:	74 38                	je     801f7b <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801f43:	48 89 c1             	mov    %rax,%rcx
+  801f46:	48 ba 19 2c 80 00 00 	movabs $0x802c19,%rdx
+  801f4d:	00 00 00 
+  801f50:	4c 89 ee             	mov    %r13,%rsi
+  801f53:	4c 89 f7             	mov    %r14,%rdi
+  801f56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f5b:	49 b8 52 1d 80 00 00 	movabs $0x801d52,%r8
+  801f62:	00 00 00 
+  801f65:	41 ff d0             	call   *%r8
+  801f68:	e9 53 fe ff ff       	jmp    801dc0 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801f6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f79:	eb a4                	jmp    801f1f <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801f7b:	48 ba ac 2c 80 00 00 	movabs $0x802cac,%rdx
+  801f82:	00 00 00 
+  801f85:	4c 89 ee             	mov    %r13,%rsi
+  801f88:	4c 89 f7             	mov    %r14,%rdi
+  801f8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f90:	49 b8 52 1d 80 00 00 	movabs $0x801d52,%r8
+  801f97:	00 00 00 
+  801f9a:	41 ff d0             	call   *%r8
+  801f9d:	e9 1e fe ff ff       	jmp    801dc0 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801fa2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fa5:	83 f8 2f             	cmp    $0x2f,%eax
+  801fa8:	77 6c                	ja     802016 <vprintfmt+0x287>
+  801faa:	89 c2                	mov    %eax,%edx
+  801fac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fb0:	83 c0 08             	add    $0x8,%eax
+  801fb3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fb6:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801fb9:	48 85 d2             	test   %rdx,%rdx
+  801fbc:	48 b8 a5 2c 80 00 00 	movabs $0x802ca5,%rax
+  801fc3:	00 00 00 
+  801fc6:	48 0f 45 c2          	cmovne %rdx,%rax
+  801fca:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801fce:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801fd2:	7e 06                	jle    801fda <vprintfmt+0x24b>
+  801fd4:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801fd8:	75 4a                	jne    802024 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801fda:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801fde:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801fe2:	0f b6 00             	movzbl (%rax),%eax
+  801fe5:	84 c0                	test   %al,%al
+  801fe7:	0f 85 9a 00 00 00    	jne    802087 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  801fed:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ff0:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801ff4:	85 c0                	test   %eax,%eax
+  801ff6:	0f 8e c4 fd ff ff    	jle    801dc0 <vprintfmt+0x31>
+  801ffc:	4c 89 ee             	mov    %r13,%rsi
+  801fff:	bf 20 00 00 00       	mov    $0x20,%edi
+  802004:	41 ff d6             	call   *%r14
+  802007:	41 83 ec 01          	sub    $0x1,%r12d
+  80200b:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80200f:	75 eb                	jne    801ffc <vprintfmt+0x26d>
+  802011:	e9 aa fd ff ff       	jmp    801dc0 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802016:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80201a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80201e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802022:	eb 92                	jmp    801fb6 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802024:	49 63 f7             	movslq %r15d,%rsi
+  802027:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80202b:	48 b8 41 25 80 00 00 	movabs $0x802541,%rax
+  802032:	00 00 00 
+  802035:	ff d0                	call   *%rax
+  802037:	48 89 c2             	mov    %rax,%rdx
+  80203a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80203d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80203f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802042:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802045:	85 c0                	test   %eax,%eax
+  802047:	7e 91                	jle    801fda <vprintfmt+0x24b>
+  802049:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80204e:	4c 89 ee             	mov    %r13,%rsi
+  802051:	44 89 e7             	mov    %r12d,%edi
+  802054:	41 ff d6             	call   *%r14
+  802057:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80205b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80205e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802061:	75 eb                	jne    80204e <vprintfmt+0x2bf>
+  802063:	e9 72 ff ff ff       	jmp    801fda <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802068:	0f b6 f8             	movzbl %al,%edi
+  80206b:	4c 89 ee             	mov    %r13,%rsi
+  80206e:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802071:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802075:	49 83 c4 01          	add    $0x1,%r12
+  802079:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80207f:	84 c0                	test   %al,%al
+  802081:	0f 84 66 ff ff ff    	je     801fed <vprintfmt+0x25e>
+  802087:	45 85 ff             	test   %r15d,%r15d
+  80208a:	78 0a                	js     802096 <vprintfmt+0x307>
+  80208c:	41 83 ef 01          	sub    $0x1,%r15d
+  802090:	0f 88 57 ff ff ff    	js     801fed <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802096:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80209a:	74 cc                	je     802068 <vprintfmt+0x2d9>
+  80209c:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80209f:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8020a4:	80 fa 5e             	cmp    $0x5e,%dl
+  8020a7:	77 c2                	ja     80206b <vprintfmt+0x2dc>
+  8020a9:	eb bd                	jmp    802068 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8020ab:	40 84 f6             	test   %sil,%sil
+  8020ae:	75 26                	jne    8020d6 <vprintfmt+0x347>
+    switch (lflag) {
+  8020b0:	85 d2                	test   %edx,%edx
+  8020b2:	74 59                	je     80210d <vprintfmt+0x37e>
+  8020b4:	83 fa 01             	cmp    $0x1,%edx
+  8020b7:	74 7b                	je     802134 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8020b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8020bf:	0f 87 96 00 00 00    	ja     80215b <vprintfmt+0x3cc>
+  8020c5:	89 c2                	mov    %eax,%edx
+  8020c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020cb:	83 c0 08             	add    $0x8,%eax
+  8020ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020d1:	4c 8b 22             	mov    (%rdx),%r12
+  8020d4:	eb 17                	jmp    8020ed <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8020d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8020dc:	77 21                	ja     8020ff <vprintfmt+0x370>
+  8020de:	89 c2                	mov    %eax,%edx
+  8020e0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020e4:	83 c0 08             	add    $0x8,%eax
+  8020e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020ea:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8020ed:	4d 85 e4             	test   %r12,%r12
+  8020f0:	78 7a                	js     80216c <vprintfmt+0x3dd>
+            num = i;
+  8020f2:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8020f5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8020fa:	e9 50 02 00 00       	jmp    80234f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8020ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802103:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802107:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80210b:	eb dd                	jmp    8020ea <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80210d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802110:	83 f8 2f             	cmp    $0x2f,%eax
+  802113:	77 11                	ja     802126 <vprintfmt+0x397>
+  802115:	89 c2                	mov    %eax,%edx
+  802117:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80211b:	83 c0 08             	add    $0x8,%eax
+  80211e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802121:	4c 63 22             	movslq (%rdx),%r12
+  802124:	eb c7                	jmp    8020ed <vprintfmt+0x35e>
+  802126:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80212a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80212e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802132:	eb ed                	jmp    802121 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802134:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802137:	83 f8 2f             	cmp    $0x2f,%eax
+  80213a:	77 11                	ja     80214d <vprintfmt+0x3be>
+  80213c:	89 c2                	mov    %eax,%edx
+  80213e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802142:	83 c0 08             	add    $0x8,%eax
+  802145:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802148:	4c 8b 22             	mov    (%rdx),%r12
+  80214b:	eb a0                	jmp    8020ed <vprintfmt+0x35e>
+  80214d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802151:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802155:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802159:	eb ed                	jmp    802148 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80215b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80215f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802163:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802167:	e9 65 ff ff ff       	jmp    8020d1 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80216c:	4c 89 ee             	mov    %r13,%rsi
+  80216f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802174:	41 ff d6             	call   *%r14
+                i = -i;
+  802177:	49 f7 dc             	neg    %r12
+  80217a:	e9 73 ff ff ff       	jmp    8020f2 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80217f:	40 84 f6             	test   %sil,%sil
+  802182:	75 32                	jne    8021b6 <vprintfmt+0x427>
+    switch (lflag) {
+  802184:	85 d2                	test   %edx,%edx
+  802186:	74 5d                	je     8021e5 <vprintfmt+0x456>
+  802188:	83 fa 01             	cmp    $0x1,%edx
+  80218b:	0f 84 82 00 00 00    	je     802213 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802191:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802194:	83 f8 2f             	cmp    $0x2f,%eax
+  802197:	0f 87 a5 00 00 00    	ja     802242 <vprintfmt+0x4b3>
+  80219d:	89 c2                	mov    %eax,%edx
+  80219f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021a3:	83 c0 08             	add    $0x8,%eax
+  8021a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021a9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021ac:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8021b1:	e9 99 01 00 00       	jmp    80234f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8021b6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021b9:	83 f8 2f             	cmp    $0x2f,%eax
+  8021bc:	77 19                	ja     8021d7 <vprintfmt+0x448>
+  8021be:	89 c2                	mov    %eax,%edx
+  8021c0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021c4:	83 c0 08             	add    $0x8,%eax
+  8021c7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021ca:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021cd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8021d2:	e9 78 01 00 00       	jmp    80234f <vprintfmt+0x5c0>
+  8021d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021e3:	eb e5                	jmp    8021ca <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8021e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8021eb:	77 18                	ja     802205 <vprintfmt+0x476>
+  8021ed:	89 c2                	mov    %eax,%edx
+  8021ef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021f3:	83 c0 08             	add    $0x8,%eax
+  8021f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021f9:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8021fb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802200:	e9 4a 01 00 00       	jmp    80234f <vprintfmt+0x5c0>
+  802205:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802209:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80220d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802211:	eb e6                	jmp    8021f9 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802213:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802216:	83 f8 2f             	cmp    $0x2f,%eax
+  802219:	77 19                	ja     802234 <vprintfmt+0x4a5>
+  80221b:	89 c2                	mov    %eax,%edx
+  80221d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802221:	83 c0 08             	add    $0x8,%eax
+  802224:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802227:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80222a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80222f:	e9 1b 01 00 00       	jmp    80234f <vprintfmt+0x5c0>
+  802234:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802238:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80223c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802240:	eb e5                	jmp    802227 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802242:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802246:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80224a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80224e:	e9 56 ff ff ff       	jmp    8021a9 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802253:	40 84 f6             	test   %sil,%sil
+  802256:	75 2e                	jne    802286 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802258:	85 d2                	test   %edx,%edx
+  80225a:	74 59                	je     8022b5 <vprintfmt+0x526>
+  80225c:	83 fa 01             	cmp    $0x1,%edx
+  80225f:	74 7f                	je     8022e0 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802261:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802264:	83 f8 2f             	cmp    $0x2f,%eax
+  802267:	0f 87 9f 00 00 00    	ja     80230c <vprintfmt+0x57d>
+  80226d:	89 c2                	mov    %eax,%edx
+  80226f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802273:	83 c0 08             	add    $0x8,%eax
+  802276:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802279:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80227c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802281:	e9 c9 00 00 00       	jmp    80234f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802286:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802289:	83 f8 2f             	cmp    $0x2f,%eax
+  80228c:	77 19                	ja     8022a7 <vprintfmt+0x518>
+  80228e:	89 c2                	mov    %eax,%edx
+  802290:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802294:	83 c0 08             	add    $0x8,%eax
+  802297:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80229a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80229d:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022a2:	e9 a8 00 00 00       	jmp    80234f <vprintfmt+0x5c0>
+  8022a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022b3:	eb e5                	jmp    80229a <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8022b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8022bb:	77 15                	ja     8022d2 <vprintfmt+0x543>
+  8022bd:	89 c2                	mov    %eax,%edx
+  8022bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022c3:	83 c0 08             	add    $0x8,%eax
+  8022c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022c9:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8022cb:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8022d0:	eb 7d                	jmp    80234f <vprintfmt+0x5c0>
+  8022d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022d6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022de:	eb e9                	jmp    8022c9 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8022e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8022e6:	77 16                	ja     8022fe <vprintfmt+0x56f>
+  8022e8:	89 c2                	mov    %eax,%edx
+  8022ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022ee:	83 c0 08             	add    $0x8,%eax
+  8022f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022f4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8022f7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8022fc:	eb 51                	jmp    80234f <vprintfmt+0x5c0>
+  8022fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802302:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802306:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80230a:	eb e8                	jmp    8022f4 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80230c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802310:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802314:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802318:	e9 5c ff ff ff       	jmp    802279 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80231d:	4c 89 ee             	mov    %r13,%rsi
+  802320:	bf 30 00 00 00       	mov    $0x30,%edi
+  802325:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802328:	4c 89 ee             	mov    %r13,%rsi
+  80232b:	bf 78 00 00 00       	mov    $0x78,%edi
+  802330:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802333:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802336:	83 f8 2f             	cmp    $0x2f,%eax
+  802339:	77 47                	ja     802382 <vprintfmt+0x5f3>
+  80233b:	89 c2                	mov    %eax,%edx
+  80233d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802341:	83 c0 08             	add    $0x8,%eax
+  802344:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802347:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80234a:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80234f:	48 83 ec 08          	sub    $0x8,%rsp
+  802353:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802357:	0f 94 c0             	sete   %al
+  80235a:	0f b6 c0             	movzbl %al,%eax
+  80235d:	50                   	push   %rax
+  80235e:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802363:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802367:	4c 89 ee             	mov    %r13,%rsi
+  80236a:	4c 89 f7             	mov    %r14,%rdi
+  80236d:	48 b8 84 1c 80 00 00 	movabs $0x801c84,%rax
+  802374:	00 00 00 
+  802377:	ff d0                	call   *%rax
+            break;
+  802379:	48 83 c4 10          	add    $0x10,%rsp
+  80237d:	e9 3e fa ff ff       	jmp    801dc0 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802382:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802386:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80238a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80238e:	eb b7                	jmp    802347 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802390:	40 84 f6             	test   %sil,%sil
+  802393:	75 2b                	jne    8023c0 <vprintfmt+0x631>
+    switch (lflag) {
+  802395:	85 d2                	test   %edx,%edx
+  802397:	74 56                	je     8023ef <vprintfmt+0x660>
+  802399:	83 fa 01             	cmp    $0x1,%edx
+  80239c:	74 7f                	je     80241d <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80239e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8023a4:	0f 87 a2 00 00 00    	ja     80244c <vprintfmt+0x6bd>
+  8023aa:	89 c2                	mov    %eax,%edx
+  8023ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023b0:	83 c0 08             	add    $0x8,%eax
+  8023b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023b6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023b9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023be:	eb 8f                	jmp    80234f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8023c6:	77 19                	ja     8023e1 <vprintfmt+0x652>
+  8023c8:	89 c2                	mov    %eax,%edx
+  8023ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023ce:	83 c0 08             	add    $0x8,%eax
+  8023d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023d4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023d7:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023dc:	e9 6e ff ff ff       	jmp    80234f <vprintfmt+0x5c0>
+  8023e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023ed:	eb e5                	jmp    8023d4 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8023ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8023f5:	77 18                	ja     80240f <vprintfmt+0x680>
+  8023f7:	89 c2                	mov    %eax,%edx
+  8023f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023fd:	83 c0 08             	add    $0x8,%eax
+  802400:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802403:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802405:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80240a:	e9 40 ff ff ff       	jmp    80234f <vprintfmt+0x5c0>
+  80240f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802413:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802417:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80241b:	eb e6                	jmp    802403 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80241d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802420:	83 f8 2f             	cmp    $0x2f,%eax
+  802423:	77 19                	ja     80243e <vprintfmt+0x6af>
+  802425:	89 c2                	mov    %eax,%edx
+  802427:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80242b:	83 c0 08             	add    $0x8,%eax
+  80242e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802431:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802434:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802439:	e9 11 ff ff ff       	jmp    80234f <vprintfmt+0x5c0>
+  80243e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802442:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802446:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80244a:	eb e5                	jmp    802431 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80244c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802450:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802454:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802458:	e9 59 ff ff ff       	jmp    8023b6 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80245d:	4c 89 ee             	mov    %r13,%rsi
+  802460:	bf 25 00 00 00       	mov    $0x25,%edi
+  802465:	41 ff d6             	call   *%r14
+            break;
+  802468:	e9 53 f9 ff ff       	jmp    801dc0 <vprintfmt+0x31>
+            putch('%', put_arg);
+  80246d:	4c 89 ee             	mov    %r13,%rsi
+  802470:	bf 25 00 00 00       	mov    $0x25,%edi
+  802475:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802478:	48 83 eb 01          	sub    $0x1,%rbx
+  80247c:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802480:	75 f6                	jne    802478 <vprintfmt+0x6e9>
+  802482:	e9 39 f9 ff ff       	jmp    801dc0 <vprintfmt+0x31>
+}
+  802487:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80248b:	5b                   	pop    %rbx
+  80248c:	41 5c                	pop    %r12
+  80248e:	41 5d                	pop    %r13
+  802490:	41 5e                	pop    %r14
+  802492:	41 5f                	pop    %r15
+  802494:	5d                   	pop    %rbp
+  802495:	c3                   	ret
+
+0000000000802496 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802496:	55                   	push   %rbp
+  802497:	48 89 e5             	mov    %rsp,%rbp
+  80249a:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80249e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8024a2:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8024a7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8024ab:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8024b2:	48 85 ff             	test   %rdi,%rdi
+  8024b5:	74 2b                	je     8024e2 <vsnprintf+0x4c>
+  8024b7:	48 85 f6             	test   %rsi,%rsi
+  8024ba:	74 26                	je     8024e2 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8024bc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024c0:	48 bf 3a 1d 80 00 00 	movabs $0x801d3a,%rdi
+  8024c7:	00 00 00 
+  8024ca:	48 b8 8f 1d 80 00 00 	movabs $0x801d8f,%rax
+  8024d1:	00 00 00 
+  8024d4:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8024d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024da:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8024dd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8024e0:	c9                   	leave
+  8024e1:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8024e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024e7:	eb f7                	jmp    8024e0 <vsnprintf+0x4a>
+
+00000000008024e9 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8024e9:	55                   	push   %rbp
+  8024ea:	48 89 e5             	mov    %rsp,%rbp
+  8024ed:	48 83 ec 50          	sub    $0x50,%rsp
+  8024f1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8024f5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8024f9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8024fd:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802504:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802508:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80250c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802510:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802514:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802518:	48 b8 96 24 80 00 00 	movabs $0x802496,%rax
+  80251f:	00 00 00 
+  802522:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802524:	c9                   	leave
+  802525:	c3                   	ret
+
+0000000000802526 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802526:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802529:	74 10                	je     80253b <strlen+0x15>
+    size_t n = 0;
+  80252b:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802530:	48 83 c0 01          	add    $0x1,%rax
+  802534:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802538:	75 f6                	jne    802530 <strlen+0xa>
+  80253a:	c3                   	ret
+    size_t n = 0;
+  80253b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802540:	c3                   	ret
+
+0000000000802541 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802541:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802544:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802549:	48 85 f6             	test   %rsi,%rsi
+  80254c:	74 11                	je     80255f <strnlen+0x1e>
+  80254e:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802552:	74 0c                	je     802560 <strnlen+0x1f>
+  802554:	48 83 c2 01          	add    $0x1,%rdx
+  802558:	48 39 d0             	cmp    %rdx,%rax
+  80255b:	75 f1                	jne    80254e <strnlen+0xd>
+  80255d:	eb 04                	jmp    802563 <strnlen+0x22>
+  80255f:	c3                   	ret
+  802560:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802563:	c3                   	ret
+
+0000000000802564 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802564:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802567:	ba 00 00 00 00       	mov    $0x0,%edx
+  80256c:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802570:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802573:	48 83 c2 01          	add    $0x1,%rdx
+  802577:	84 c9                	test   %cl,%cl
+  802579:	75 f1                	jne    80256c <strcpy+0x8>
+        ;
+    return res;
+}
+  80257b:	c3                   	ret
+
+000000000080257c <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80257c:	55                   	push   %rbp
+  80257d:	48 89 e5             	mov    %rsp,%rbp
+  802580:	41 54                	push   %r12
+  802582:	53                   	push   %rbx
+  802583:	48 89 fb             	mov    %rdi,%rbx
+  802586:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802589:	48 b8 26 25 80 00 00 	movabs $0x802526,%rax
+  802590:	00 00 00 
+  802593:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802595:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802599:	4c 89 e6             	mov    %r12,%rsi
+  80259c:	48 b8 64 25 80 00 00 	movabs $0x802564,%rax
+  8025a3:	00 00 00 
+  8025a6:	ff d0                	call   *%rax
+    return dst;
+}
+  8025a8:	48 89 d8             	mov    %rbx,%rax
+  8025ab:	5b                   	pop    %rbx
+  8025ac:	41 5c                	pop    %r12
+  8025ae:	5d                   	pop    %rbp
+  8025af:	c3                   	ret
+
+00000000008025b0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8025b0:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8025b3:	48 85 d2             	test   %rdx,%rdx
+  8025b6:	74 1f                	je     8025d7 <strncpy+0x27>
+  8025b8:	48 01 fa             	add    %rdi,%rdx
+  8025bb:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8025be:	48 83 c1 01          	add    $0x1,%rcx
+  8025c2:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8025c6:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8025ca:	41 80 f8 01          	cmp    $0x1,%r8b
+  8025ce:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8025d2:	48 39 ca             	cmp    %rcx,%rdx
+  8025d5:	75 e7                	jne    8025be <strncpy+0xe>
+    }
+    return ret;
+}
+  8025d7:	c3                   	ret
+
+00000000008025d8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8025d8:	48 89 f8             	mov    %rdi,%rax
+  8025db:	48 85 d2             	test   %rdx,%rdx
+  8025de:	74 24                	je     802604 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8025e0:	48 83 ea 01          	sub    $0x1,%rdx
+  8025e4:	74 1b                	je     802601 <strlcpy+0x29>
+  8025e6:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8025ea:	0f b6 16             	movzbl (%rsi),%edx
+  8025ed:	84 d2                	test   %dl,%dl
+  8025ef:	74 10                	je     802601 <strlcpy+0x29>
+            *dst++ = *src++;
+  8025f1:	48 83 c6 01          	add    $0x1,%rsi
+  8025f5:	48 83 c0 01          	add    $0x1,%rax
+  8025f9:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8025fc:	48 39 c8             	cmp    %rcx,%rax
+  8025ff:	75 e9                	jne    8025ea <strlcpy+0x12>
+        *dst = '\0';
+  802601:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802604:	48 29 f8             	sub    %rdi,%rax
+}
+  802607:	c3                   	ret
+
+0000000000802608 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802608:	0f b6 07             	movzbl (%rdi),%eax
+  80260b:	84 c0                	test   %al,%al
+  80260d:	74 13                	je     802622 <strcmp+0x1a>
+  80260f:	38 06                	cmp    %al,(%rsi)
+  802611:	75 0f                	jne    802622 <strcmp+0x1a>
+  802613:	48 83 c7 01          	add    $0x1,%rdi
+  802617:	48 83 c6 01          	add    $0x1,%rsi
+  80261b:	0f b6 07             	movzbl (%rdi),%eax
+  80261e:	84 c0                	test   %al,%al
+  802620:	75 ed                	jne    80260f <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802622:	0f b6 c0             	movzbl %al,%eax
+  802625:	0f b6 16             	movzbl (%rsi),%edx
+  802628:	29 d0                	sub    %edx,%eax
+}
+  80262a:	c3                   	ret
+
+000000000080262b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80262b:	48 85 d2             	test   %rdx,%rdx
+  80262e:	74 1f                	je     80264f <strncmp+0x24>
+  802630:	0f b6 07             	movzbl (%rdi),%eax
+  802633:	84 c0                	test   %al,%al
+  802635:	74 1e                	je     802655 <strncmp+0x2a>
+  802637:	3a 06                	cmp    (%rsi),%al
+  802639:	75 1a                	jne    802655 <strncmp+0x2a>
+  80263b:	48 83 c7 01          	add    $0x1,%rdi
+  80263f:	48 83 c6 01          	add    $0x1,%rsi
+  802643:	48 83 ea 01          	sub    $0x1,%rdx
+  802647:	75 e7                	jne    802630 <strncmp+0x5>
+
+    if (!n) return 0;
+  802649:	b8 00 00 00 00       	mov    $0x0,%eax
+  80264e:	c3                   	ret
+  80264f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802654:	c3                   	ret
+  802655:	48 85 d2             	test   %rdx,%rdx
+  802658:	74 09                	je     802663 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80265a:	0f b6 07             	movzbl (%rdi),%eax
+  80265d:	0f b6 16             	movzbl (%rsi),%edx
+  802660:	29 d0                	sub    %edx,%eax
+  802662:	c3                   	ret
+    if (!n) return 0;
+  802663:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802668:	c3                   	ret
+
+0000000000802669 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802669:	0f b6 17             	movzbl (%rdi),%edx
+  80266c:	84 d2                	test   %dl,%dl
+  80266e:	74 18                	je     802688 <strchr+0x1f>
+        if (*str == c) {
+  802670:	0f be d2             	movsbl %dl,%edx
+  802673:	39 f2                	cmp    %esi,%edx
+  802675:	74 17                	je     80268e <strchr+0x25>
+    for (; *str; str++) {
+  802677:	48 83 c7 01          	add    $0x1,%rdi
+  80267b:	0f b6 17             	movzbl (%rdi),%edx
+  80267e:	84 d2                	test   %dl,%dl
+  802680:	75 ee                	jne    802670 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802682:	b8 00 00 00 00       	mov    $0x0,%eax
+  802687:	c3                   	ret
+  802688:	b8 00 00 00 00       	mov    $0x0,%eax
+  80268d:	c3                   	ret
+  80268e:	48 89 f8             	mov    %rdi,%rax
+}
+  802691:	c3                   	ret
+
+0000000000802692 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802692:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802695:	0f b6 17             	movzbl (%rdi),%edx
+  802698:	84 d2                	test   %dl,%dl
+  80269a:	74 13                	je     8026af <strfind+0x1d>
+  80269c:	0f be d2             	movsbl %dl,%edx
+  80269f:	39 f2                	cmp    %esi,%edx
+  8026a1:	74 0b                	je     8026ae <strfind+0x1c>
+  8026a3:	48 83 c0 01          	add    $0x1,%rax
+  8026a7:	0f b6 10             	movzbl (%rax),%edx
+  8026aa:	84 d2                	test   %dl,%dl
+  8026ac:	75 ee                	jne    80269c <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8026ae:	c3                   	ret
+  8026af:	c3                   	ret
+
+00000000008026b0 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8026b0:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8026b3:	48 89 f8             	mov    %rdi,%rax
+  8026b6:	48 f7 d8             	neg    %rax
+  8026b9:	83 e0 07             	and    $0x7,%eax
+  8026bc:	49 89 d1             	mov    %rdx,%r9
+  8026bf:	49 29 c1             	sub    %rax,%r9
+  8026c2:	78 36                	js     8026fa <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8026c4:	40 0f b6 c6          	movzbl %sil,%eax
+  8026c8:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8026cf:	01 01 01 
+  8026d2:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8026d6:	40 f6 c7 07          	test   $0x7,%dil
+  8026da:	75 38                	jne    802714 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8026dc:	4c 89 c9             	mov    %r9,%rcx
+  8026df:	48 c1 f9 03          	sar    $0x3,%rcx
+  8026e3:	74 0c                	je     8026f1 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8026e5:	fc                   	cld
+  8026e6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8026e9:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8026ed:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8026f1:	4d 85 c9             	test   %r9,%r9
+  8026f4:	75 45                	jne    80273b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8026f6:	4c 89 c0             	mov    %r8,%rax
+  8026f9:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8026fa:	48 85 d2             	test   %rdx,%rdx
+  8026fd:	74 f7                	je     8026f6 <memset+0x46>
+  8026ff:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802702:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802705:	48 83 c0 01          	add    $0x1,%rax
+  802709:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80270d:	48 39 c2             	cmp    %rax,%rdx
+  802710:	75 f3                	jne    802705 <memset+0x55>
+  802712:	eb e2                	jmp    8026f6 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802714:	40 f6 c7 01          	test   $0x1,%dil
+  802718:	74 06                	je     802720 <memset+0x70>
+  80271a:	88 07                	mov    %al,(%rdi)
+  80271c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802720:	40 f6 c7 02          	test   $0x2,%dil
+  802724:	74 07                	je     80272d <memset+0x7d>
+  802726:	66 89 07             	mov    %ax,(%rdi)
+  802729:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80272d:	40 f6 c7 04          	test   $0x4,%dil
+  802731:	74 a9                	je     8026dc <memset+0x2c>
+  802733:	89 07                	mov    %eax,(%rdi)
+  802735:	48 83 c7 04          	add    $0x4,%rdi
+  802739:	eb a1                	jmp    8026dc <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80273b:	41 f6 c1 04          	test   $0x4,%r9b
+  80273f:	74 06                	je     802747 <memset+0x97>
+  802741:	89 07                	mov    %eax,(%rdi)
+  802743:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802747:	41 f6 c1 02          	test   $0x2,%r9b
+  80274b:	74 07                	je     802754 <memset+0xa4>
+  80274d:	66 89 07             	mov    %ax,(%rdi)
+  802750:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802754:	41 f6 c1 01          	test   $0x1,%r9b
+  802758:	74 9c                	je     8026f6 <memset+0x46>
+  80275a:	88 07                	mov    %al,(%rdi)
+  80275c:	eb 98                	jmp    8026f6 <memset+0x46>
+
+000000000080275e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80275e:	48 89 f8             	mov    %rdi,%rax
+  802761:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802764:	48 39 fe             	cmp    %rdi,%rsi
+  802767:	73 3b                	jae    8027a4 <memmove+0x46>
+  802769:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80276d:	48 39 d7             	cmp    %rdx,%rdi
+  802770:	73 32                	jae    8027a4 <memmove+0x46>
+        s += n;
+        d += n;
+  802772:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802776:	48 89 d6             	mov    %rdx,%rsi
+  802779:	48 09 fe             	or     %rdi,%rsi
+  80277c:	48 09 ce             	or     %rcx,%rsi
+  80277f:	40 f6 c6 07          	test   $0x7,%sil
+  802783:	75 12                	jne    802797 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802785:	48 83 ef 08          	sub    $0x8,%rdi
+  802789:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80278d:	48 c1 e9 03          	shr    $0x3,%rcx
+  802791:	fd                   	std
+  802792:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802795:	fc                   	cld
+  802796:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802797:	48 83 ef 01          	sub    $0x1,%rdi
+  80279b:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80279f:	fd                   	std
+  8027a0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8027a2:	eb f1                	jmp    802795 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8027a4:	48 89 f2             	mov    %rsi,%rdx
+  8027a7:	48 09 c2             	or     %rax,%rdx
+  8027aa:	48 09 ca             	or     %rcx,%rdx
+  8027ad:	f6 c2 07             	test   $0x7,%dl
+  8027b0:	75 0c                	jne    8027be <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8027b2:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027b6:	48 89 c7             	mov    %rax,%rdi
+  8027b9:	fc                   	cld
+  8027ba:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8027bd:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8027be:	48 89 c7             	mov    %rax,%rdi
+  8027c1:	fc                   	cld
+  8027c2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8027c4:	c3                   	ret
+
+00000000008027c5 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8027c5:	55                   	push   %rbp
+  8027c6:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8027c9:	48 b8 5e 27 80 00 00 	movabs $0x80275e,%rax
+  8027d0:	00 00 00 
+  8027d3:	ff d0                	call   *%rax
+}
+  8027d5:	5d                   	pop    %rbp
+  8027d6:	c3                   	ret
+
+00000000008027d7 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8027d7:	55                   	push   %rbp
+  8027d8:	48 89 e5             	mov    %rsp,%rbp
+  8027db:	41 57                	push   %r15
+  8027dd:	41 56                	push   %r14
+  8027df:	41 55                	push   %r13
+  8027e1:	41 54                	push   %r12
+  8027e3:	53                   	push   %rbx
+  8027e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8027e8:	49 89 fe             	mov    %rdi,%r14
+  8027eb:	49 89 f7             	mov    %rsi,%r15
+  8027ee:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8027f1:	48 89 f7             	mov    %rsi,%rdi
+  8027f4:	48 b8 26 25 80 00 00 	movabs $0x802526,%rax
+  8027fb:	00 00 00 
+  8027fe:	ff d0                	call   *%rax
+  802800:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802803:	48 89 de             	mov    %rbx,%rsi
+  802806:	4c 89 f7             	mov    %r14,%rdi
+  802809:	48 b8 41 25 80 00 00 	movabs $0x802541,%rax
+  802810:	00 00 00 
+  802813:	ff d0                	call   *%rax
+  802815:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802818:	48 39 c3             	cmp    %rax,%rbx
+  80281b:	74 36                	je     802853 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80281d:	48 89 d8             	mov    %rbx,%rax
+  802820:	4c 29 e8             	sub    %r13,%rax
+  802823:	49 39 c4             	cmp    %rax,%r12
+  802826:	73 31                	jae    802859 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802828:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80282d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802831:	4c 89 fe             	mov    %r15,%rsi
+  802834:	48 b8 c5 27 80 00 00 	movabs $0x8027c5,%rax
+  80283b:	00 00 00 
+  80283e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802840:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802844:	48 83 c4 08          	add    $0x8,%rsp
+  802848:	5b                   	pop    %rbx
+  802849:	41 5c                	pop    %r12
+  80284b:	41 5d                	pop    %r13
+  80284d:	41 5e                	pop    %r14
+  80284f:	41 5f                	pop    %r15
+  802851:	5d                   	pop    %rbp
+  802852:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802853:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802857:	eb eb                	jmp    802844 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802859:	48 83 eb 01          	sub    $0x1,%rbx
+  80285d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802861:	48 89 da             	mov    %rbx,%rdx
+  802864:	4c 89 fe             	mov    %r15,%rsi
+  802867:	48 b8 c5 27 80 00 00 	movabs $0x8027c5,%rax
+  80286e:	00 00 00 
+  802871:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802873:	49 01 de             	add    %rbx,%r14
+  802876:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80287b:	eb c3                	jmp    802840 <strlcat+0x69>
+
+000000000080287d <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80287d:	48 85 d2             	test   %rdx,%rdx
+  802880:	74 2d                	je     8028af <memcmp+0x32>
+  802882:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802887:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80288b:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802890:	44 38 c1             	cmp    %r8b,%cl
+  802893:	75 0f                	jne    8028a4 <memcmp+0x27>
+    while (n-- > 0) {
+  802895:	48 83 c0 01          	add    $0x1,%rax
+  802899:	48 39 c2             	cmp    %rax,%rdx
+  80289c:	75 e9                	jne    802887 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80289e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a3:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8028a4:	0f b6 c1             	movzbl %cl,%eax
+  8028a7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8028ab:	44 29 c0             	sub    %r8d,%eax
+  8028ae:	c3                   	ret
+    return 0;
+  8028af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028b4:	c3                   	ret
+
+00000000008028b5 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8028b5:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8028b9:	48 39 c7             	cmp    %rax,%rdi
+  8028bc:	73 0f                	jae    8028cd <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8028be:	40 38 37             	cmp    %sil,(%rdi)
+  8028c1:	74 0e                	je     8028d1 <memfind+0x1c>
+    for (; src < end; src++) {
+  8028c3:	48 83 c7 01          	add    $0x1,%rdi
+  8028c7:	48 39 f8             	cmp    %rdi,%rax
+  8028ca:	75 f2                	jne    8028be <memfind+0x9>
+  8028cc:	c3                   	ret
+  8028cd:	48 89 f8             	mov    %rdi,%rax
+  8028d0:	c3                   	ret
+  8028d1:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8028d4:	c3                   	ret
+
+00000000008028d5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8028d5:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8028d8:	0f b6 37             	movzbl (%rdi),%esi
+  8028db:	40 80 fe 20          	cmp    $0x20,%sil
+  8028df:	74 06                	je     8028e7 <strtol+0x12>
+  8028e1:	40 80 fe 09          	cmp    $0x9,%sil
+  8028e5:	75 13                	jne    8028fa <strtol+0x25>
+  8028e7:	48 83 c7 01          	add    $0x1,%rdi
+  8028eb:	0f b6 37             	movzbl (%rdi),%esi
+  8028ee:	40 80 fe 20          	cmp    $0x20,%sil
+  8028f2:	74 f3                	je     8028e7 <strtol+0x12>
+  8028f4:	40 80 fe 09          	cmp    $0x9,%sil
+  8028f8:	74 ed                	je     8028e7 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8028fa:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8028fd:	83 e0 fd             	and    $0xfffffffd,%eax
+  802900:	3c 01                	cmp    $0x1,%al
+  802902:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802906:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80290c:	75 0f                	jne    80291d <strtol+0x48>
+  80290e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802911:	74 14                	je     802927 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802913:	85 d2                	test   %edx,%edx
+  802915:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80291a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80291d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802922:	4c 63 ca             	movslq %edx,%r9
+  802925:	eb 36                	jmp    80295d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802927:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80292b:	74 0f                	je     80293c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80292d:	85 d2                	test   %edx,%edx
+  80292f:	75 ec                	jne    80291d <strtol+0x48>
+        s++;
+  802931:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802935:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80293a:	eb e1                	jmp    80291d <strtol+0x48>
+        s += 2;
+  80293c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802940:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802945:	eb d6                	jmp    80291d <strtol+0x48>
+            dig -= '0';
+  802947:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80294a:	44 0f b6 c1          	movzbl %cl,%r8d
+  80294e:	41 39 d0             	cmp    %edx,%r8d
+  802951:	7d 21                	jge    802974 <strtol+0x9f>
+        val = val * base + dig;
+  802953:	49 0f af c1          	imul   %r9,%rax
+  802957:	0f b6 c9             	movzbl %cl,%ecx
+  80295a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80295d:	48 83 c7 01          	add    $0x1,%rdi
+  802961:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802965:	80 f9 39             	cmp    $0x39,%cl
+  802968:	76 dd                	jbe    802947 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80296a:	80 f9 7b             	cmp    $0x7b,%cl
+  80296d:	77 05                	ja     802974 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80296f:	83 e9 57             	sub    $0x57,%ecx
+  802972:	eb d6                	jmp    80294a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802974:	4d 85 d2             	test   %r10,%r10
+  802977:	74 03                	je     80297c <strtol+0xa7>
+  802979:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80297c:	48 89 c2             	mov    %rax,%rdx
+  80297f:	48 f7 da             	neg    %rdx
+  802982:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802986:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80298a:	c3                   	ret
+
+000000000080298b <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80298b:	55                   	push   %rbp
+  80298c:	48 89 e5             	mov    %rsp,%rbp
+  80298f:	41 54                	push   %r12
+  802991:	53                   	push   %rbx
+  802992:	48 89 fb             	mov    %rdi,%rbx
+  802995:	48 89 f7             	mov    %rsi,%rdi
+  802998:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  80299b:	48 85 f6             	test   %rsi,%rsi
+  80299e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029a5:	00 00 00 
+  8029a8:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8029ac:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029b1:	48 b8 e4 05 80 00 00 	movabs $0x8005e4,%rax
+  8029b8:	00 00 00 
+  8029bb:	ff d0                	call   *%rax
+    if (res < 0) {
+  8029bd:	85 c0                	test   %eax,%eax
+  8029bf:	78 45                	js     802a06 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8029c1:	48 85 db             	test   %rbx,%rbx
+  8029c4:	74 12                	je     8029d8 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8029c6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029cd:	00 00 00 
+  8029d0:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8029d6:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  8029d8:	4d 85 e4             	test   %r12,%r12
+  8029db:	74 14                	je     8029f1 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  8029dd:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029e4:	00 00 00 
+  8029e7:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8029ed:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  8029f1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029f8:	00 00 00 
+  8029fb:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802a01:	5b                   	pop    %rbx
+  802a02:	41 5c                	pop    %r12
+  802a04:	5d                   	pop    %rbp
+  802a05:	c3                   	ret
+        if (from_env_store)
+  802a06:	48 85 db             	test   %rbx,%rbx
+  802a09:	74 06                	je     802a11 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802a0b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802a11:	4d 85 e4             	test   %r12,%r12
+  802a14:	74 eb                	je     802a01 <ipc_recv+0x76>
+            *perm_store = 0;
+  802a16:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802a1d:	00 
+  802a1e:	eb e1                	jmp    802a01 <ipc_recv+0x76>
+
+0000000000802a20 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802a20:	55                   	push   %rbp
+  802a21:	48 89 e5             	mov    %rsp,%rbp
+  802a24:	41 57                	push   %r15
+  802a26:	41 56                	push   %r14
+  802a28:	41 55                	push   %r13
+  802a2a:	41 54                	push   %r12
+  802a2c:	53                   	push   %rbx
+  802a2d:	48 83 ec 18          	sub    $0x18,%rsp
+  802a31:	41 89 fd             	mov    %edi,%r13d
+  802a34:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802a37:	48 89 d3             	mov    %rdx,%rbx
+  802a3a:	49 89 cc             	mov    %rcx,%r12
+  802a3d:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a41:	48 85 d2             	test   %rdx,%rdx
+  802a44:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a4b:	00 00 00 
+  802a4e:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a52:	49 be b8 05 80 00 00 	movabs $0x8005b8,%r14
+  802a59:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802a5c:	49 bf eb 01 80 00 00 	movabs $0x8001eb,%r15
+  802a63:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a66:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802a69:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802a6d:	4c 89 e1             	mov    %r12,%rcx
+  802a70:	48 89 da             	mov    %rbx,%rdx
+  802a73:	44 89 ef             	mov    %r13d,%edi
+  802a76:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802a79:	85 c0                	test   %eax,%eax
+  802a7b:	74 34                	je     802ab1 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802a7d:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802a80:	75 05                	jne    802a87 <ipc_send+0x67>
+        sys_yield();
+  802a82:	41 ff d7             	call   *%r15
+    while (true) {
+  802a85:	eb df                	jmp    802a66 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802a87:	48 ba cf 31 80 00 00 	movabs $0x8031cf,%rdx
+  802a8e:	00 00 00 
+  802a91:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802a96:	48 bf e8 31 80 00 00 	movabs $0x8031e8,%rdi
+  802a9d:	00 00 00 
+  802aa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa5:	48 b9 ef 1a 80 00 00 	movabs $0x801aef,%rcx
+  802aac:	00 00 00 
+  802aaf:	ff d1                	call   *%rcx
+    }
+}
+  802ab1:	48 83 c4 18          	add    $0x18,%rsp
+  802ab5:	5b                   	pop    %rbx
+  802ab6:	41 5c                	pop    %r12
+  802ab8:	41 5d                	pop    %r13
+  802aba:	41 5e                	pop    %r14
+  802abc:	41 5f                	pop    %r15
+  802abe:	5d                   	pop    %rbp
+  802abf:	c3                   	ret
+
+0000000000802ac0 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802ac5:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802acc:	00 00 00 
+  802acf:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802ad6:	48 01 ca             	add    %rcx,%rdx
+  802ad9:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802adf:	39 fa                	cmp    %edi,%edx
+  802ae1:	74 12                	je     802af5 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802ae3:	48 83 c0 01          	add    $0x1,%rax
+  802ae7:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802aed:	75 e0                	jne    802acf <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802aef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802af4:	c3                   	ret
+            return envs[i].env_id;
+  802af5:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802afc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b03:	00 00 00 
+  802b06:	48 01 d0             	add    %rdx,%rax
+  802b09:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b0f:	c3                   	ret
+
+0000000000802b10 <__rodata_start>:
+  802b10:	3c 75                	cmp    $0x75,%al
+  802b12:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b13:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b17:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b18:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802b1c:	1f                   	(bad)
+  802b1d:	44 00 00             	add    %r8b,(%rax)
+  802b20:	73 79                	jae    802b9b <__rodata_start+0x8b>
+  802b22:	73 63                	jae    802b87 <__rodata_start+0x77>
+  802b24:	61                   	(bad)
+  802b25:	6c                   	insb   (%dx),%es:(%rdi)
+  802b26:	6c                   	insb   (%dx),%es:(%rdi)
+  802b27:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a08fa7 <__bss_end+0x72200fa7>
+  802b2d:	65 74 75             	gs je  802ba5 <__rodata_start+0x95>
+  802b30:	72 6e                	jb     802ba0 <__rodata_start+0x90>
+  802b32:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a08fb4 <__bss_end+0x28200fb4>
+  802b39:	28 
+  802b3a:	3e 20 30             	ds and %dh,(%rax)
+  802b3d:	29 00                	sub    %eax,(%rax)
+  802b3f:	6c                   	insb   (%dx),%es:(%rdi)
+  802b40:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802b47:	61                   	(bad)
+  802b48:	6c                   	insb   (%dx),%es:(%rdi)
+  802b49:	6c                   	insb   (%dx),%es:(%rdi)
+  802b4a:	2e 63 00             	cs movsxd (%rax),%eax
+  802b4d:	0f 1f 00             	nopl   (%rax)
+  802b50:	5b                   	pop    %rbx
+  802b51:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b56:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802b59:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b5d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b5e:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802b62:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802b69:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 8035d4 <error_string+0x4d4>
+  802b70:	5b                   	pop    %rbx
+  802b71:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b76:	20 66 74             	and    %ah,0x74(%rsi)
+  802b79:	72 75                	jb     802bf0 <devtab+0x10>
+  802b7b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b7c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802b7f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4bea <__bss_end+0x2d2ccbea>
+  802b86:	20 62 61             	and    %ah,0x61(%rdx)
+  802b89:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802b8d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802b91:	5b                   	pop    %rbx
+  802b92:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b97:	20 72 65             	and    %dh,0x65(%rdx)
+  802b9a:	61                   	(bad)
+  802b9b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4c06 <__bss_end+0x2d2ccc06>
+  802ba2:	20 62 61             	and    %ah,0x61(%rdx)
+  802ba5:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802ba9:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bad:	5b                   	pop    %rbx
+  802bae:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802bb3:	20 77 72             	and    %dh,0x72(%rdi)
+  802bb6:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802bbd:	2d 
+  802bbe:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802bc3:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802bc6:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802bd1:	00 00 00 
+  802bd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802bdb:	00 00 00 
+  802bde:	66 90                	xchg   %ax,%ax
+
+0000000000802be0 <devtab>:
+  802be0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802bf0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802c00:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802c10:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802c20:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802c30:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802c40:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802c50:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802c60:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802c70:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802c80:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802c90:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802ca0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802cb0:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802cc0:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802cd0:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802ce0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802cf0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802d00:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802d10:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802d20:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802d30:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802d40:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802d50:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802d60:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802d70:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802d80:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802d90:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802da0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802db0:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802dc0:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802dd0:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802de0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802df0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802e00:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802e10:	64 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     d.operation not 
+  802e20:	70 65 72 6d 69 74 74 65 64 00 66 2e 0f 1f 84 00     permitted.f.....
+  802e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
+  802e40:	2c 1e 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     ,.......m$......
+  802e50:	5d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     ]$......m$......
+  802e60:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  802e70:	6d 24 80 00 00 00 00 00 4b 1e 80 00 00 00 00 00     m$......K.......
+  802e80:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  802e90:	3f 1e 80 00 00 00 00 00 b9 1e 80 00 00 00 00 00     ?...............
+  802ea0:	6d 24 80 00 00 00 00 00 3f 1e 80 00 00 00 00 00     m$......?.......
+  802eb0:	85 1e 80 00 00 00 00 00 85 1e 80 00 00 00 00 00     ................
+  802ec0:	85 1e 80 00 00 00 00 00 85 1e 80 00 00 00 00 00     ................
+  802ed0:	85 1e 80 00 00 00 00 00 85 1e 80 00 00 00 00 00     ................
+  802ee0:	85 1e 80 00 00 00 00 00 85 1e 80 00 00 00 00 00     ................
+  802ef0:	85 1e 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     ........m$......
+  802f00:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  802f10:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  802f20:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  802f30:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  802f40:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  802f50:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  802f60:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  802f70:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  802f80:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  802f90:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  802fa0:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  802fb0:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  802fc0:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  802fd0:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  802fe0:	6d 24 80 00 00 00 00 00 90 23 80 00 00 00 00 00     m$.......#......
+  802ff0:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  803000:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  803010:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  803020:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  803030:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  803040:	dc 1e 80 00 00 00 00 00 ab 20 80 00 00 00 00 00     ......... ......
+  803050:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  803060:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  803070:	0b 1f 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     ........m$......
+  803080:	6d 24 80 00 00 00 00 00 d1 1e 80 00 00 00 00 00     m$..............
+  803090:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  8030a0:	53 22 80 00 00 00 00 00 1d 23 80 00 00 00 00 00     S".......#......
+  8030b0:	6d 24 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     m$......m$......
+  8030c0:	a2 1f 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     ........m$......
+  8030d0:	7f 21 80 00 00 00 00 00 6d 24 80 00 00 00 00 00     .!......m$......
+  8030e0:	6d 24 80 00 00 00 00 00 90 23 80 00 00 00 00 00     m$.......#......
+  8030f0:	6d 24 80 00 00 00 00 00 35 1e 80 00 00 00 00 00     m$......5.......
+
+0000000000803100 <error_string>:
+	...
+  803108:	b5 2c 80 00 00 00 00 00 c7 2c 80 00 00 00 00 00     .,.......,......
+  803118:	d7 2c 80 00 00 00 00 00 e9 2c 80 00 00 00 00 00     .,.......,......
+  803128:	f7 2c 80 00 00 00 00 00 0b 2d 80 00 00 00 00 00     .,.......-......
+  803138:	20 2d 80 00 00 00 00 00 33 2d 80 00 00 00 00 00      -......3-......
+  803148:	45 2d 80 00 00 00 00 00 59 2d 80 00 00 00 00 00     E-......Y-......
+  803158:	69 2d 80 00 00 00 00 00 7c 2d 80 00 00 00 00 00     i-......|-......
+  803168:	93 2d 80 00 00 00 00 00 a9 2d 80 00 00 00 00 00     .-.......-......
+  803178:	c1 2d 80 00 00 00 00 00 d9 2d 80 00 00 00 00 00     .-.......-......
+  803188:	e6 2d 80 00 00 00 00 00 b0 31 80 00 00 00 00 00     .-.......1......
+  803198:	fa 2d 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .-..............
+  8031a8:	12 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ........file is 
+  8031b8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8031c8:	75 74 61 62 6c 65 00 69 70 63 5f 73 65 6e 64 3a     utable.ipc_send:
+  8031d8:	20 66 61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00      failed to send.
+  8031e8:	6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00     lib/ipc.c.f.....
+  8031f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803208:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803218:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803228:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803238:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803248:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803258:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803268:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803278:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803288:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803298:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8032e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803308:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803318:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803328:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803338:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803348:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803358:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803368:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803378:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803388:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803398:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803408:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803418:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803428:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803438:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803448:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803458:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803468:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803478:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803488:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803498:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803508:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803518:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803528:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803538:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803548:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803558:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803568:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803578:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803588:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803598:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803608:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803618:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803628:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803638:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803648:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803658:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803668:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803678:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803688:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803698:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803708:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803718:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803728:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803738:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803748:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803758:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803768:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803778:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803788:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803798:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803808:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803818:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803828:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803838:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803848:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803858:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803868:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803878:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803888:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803898:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803908:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803918:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803928:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803938:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803948:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803958:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803968:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803978:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803988:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803998:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803aa8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ab8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ac8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ad8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ae8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803af8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ba8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bb8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bc8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bd8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803be8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bf8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ca8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cb8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cc8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cd8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ce8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cf8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803da8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803db8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dc8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dd8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803de8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803df8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ea8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803eb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ec8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ed8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ee8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ef8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fa8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fe8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ff8:	0f 1f 84 00 00 00 00 00                             ........
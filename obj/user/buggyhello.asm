@@ -0,0 +1,5389 @@
+
+obj/user/buggyhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 1e 00 00 00       	call   800041 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * kernel should destroy user environment in response */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    sys_cputs((char *)1, 1);
+  800029:	be 01 00 00 00       	mov    $0x1,%esi
+  80002e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800033:	48 b8 0b 01 80 00 00 	movabs $0x80010b,%rax
+  80003a:	00 00 00 
+  80003d:	ff d0                	call   *%rax
+}
+  80003f:	5d                   	pop    %rbp
+  800040:	c3                   	ret
+
+0000000000800041 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800041:	55                   	push   %rbp
+  800042:	48 89 e5             	mov    %rsp,%rbp
+  800045:	41 56                	push   %r14
+  800047:	41 55                	push   %r13
+  800049:	41 54                	push   %r12
+  80004b:	53                   	push   %rbx
+  80004c:	41 89 fd             	mov    %edi,%r13d
+  80004f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800052:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800059:	00 00 00 
+  80005c:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800063:	00 00 00 
+  800066:	48 39 c2             	cmp    %rax,%rdx
+  800069:	73 17                	jae    800082 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80006b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80006e:	49 89 c4             	mov    %rax,%r12
+  800071:	48 83 c3 08          	add    $0x8,%rbx
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007a:	ff 53 f8             	call   *-0x8(%rbx)
+  80007d:	4c 39 e3             	cmp    %r12,%rbx
+  800080:	72 ef                	jb     800071 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800082:	48 b8 d4 01 80 00 00 	movabs $0x8001d4,%rax
+  800089:	00 00 00 
+  80008c:	ff d0                	call   *%rax
+  80008e:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800091:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800098:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80009f:	00 00 00 
+  8000a2:	48 01 d0             	add    %rdx,%rax
+  8000a5:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000ac:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000af:	45 85 ed             	test   %r13d,%r13d
+  8000b2:	7e 0d                	jle    8000c1 <libmain+0x80>
+  8000b4:	49 8b 06             	mov    (%r14),%rax
+  8000b7:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000be:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000c1:	4c 89 f6             	mov    %r14,%rsi
+  8000c4:	44 89 ef             	mov    %r13d,%edi
+  8000c7:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000ce:	00 00 00 
+  8000d1:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000d3:	48 b8 e8 00 80 00 00 	movabs $0x8000e8,%rax
+  8000da:	00 00 00 
+  8000dd:	ff d0                	call   *%rax
+#endif
+}
+  8000df:	5b                   	pop    %rbx
+  8000e0:	41 5c                	pop    %r12
+  8000e2:	41 5d                	pop    %r13
+  8000e4:	41 5e                	pop    %r14
+  8000e6:	5d                   	pop    %rbp
+  8000e7:	c3                   	ret
+
+00000000008000e8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000e8:	55                   	push   %rbp
+  8000e9:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000ec:	48 b8 5c 0a 80 00 00 	movabs $0x800a5c,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000fd:	48 b8 69 01 80 00 00 	movabs $0x800169,%rax
+  800104:	00 00 00 
+  800107:	ff d0                	call   *%rax
+}
+  800109:	5d                   	pop    %rbp
+  80010a:	c3                   	ret
+
+000000000080010b <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80010b:	55                   	push   %rbp
+  80010c:	48 89 e5             	mov    %rsp,%rbp
+  80010f:	53                   	push   %rbx
+  800110:	48 89 fa             	mov    %rdi,%rdx
+  800113:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800116:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80011b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800120:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800125:	be 00 00 00 00       	mov    $0x0,%esi
+  80012a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800130:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800132:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800136:	c9                   	leave
+  800137:	c3                   	ret
+
+0000000000800138 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800138:	55                   	push   %rbp
+  800139:	48 89 e5             	mov    %rsp,%rbp
+  80013c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80013d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800142:	ba 00 00 00 00       	mov    $0x0,%edx
+  800147:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80014c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800151:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800156:	be 00 00 00 00       	mov    $0x0,%esi
+  80015b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800161:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800163:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800167:	c9                   	leave
+  800168:	c3                   	ret
+
+0000000000800169 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800169:	55                   	push   %rbp
+  80016a:	48 89 e5             	mov    %rsp,%rbp
+  80016d:	53                   	push   %rbx
+  80016e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800172:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800175:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80017a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80017f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800184:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800189:	be 00 00 00 00       	mov    $0x0,%esi
+  80018e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800194:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800196:	48 85 c0             	test   %rax,%rax
+  800199:	7f 06                	jg     8001a1 <sys_env_destroy+0x38>
+}
+  80019b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80019f:	c9                   	leave
+  8001a0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001a1:	49 89 c0             	mov    %rax,%r8
+  8001a4:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001a9:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  8001b0:	00 00 00 
+  8001b3:	be 26 00 00 00       	mov    $0x26,%esi
+  8001b8:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  8001bf:	00 00 00 
+  8001c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c7:	49 b9 09 1b 80 00 00 	movabs $0x801b09,%r9
+  8001ce:	00 00 00 
+  8001d1:	41 ff d1             	call   *%r9
+
+00000000008001d4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001d4:	55                   	push   %rbp
+  8001d5:	48 89 e5             	mov    %rsp,%rbp
+  8001d8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001d9:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001ed:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8001f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001fd:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800203:	c9                   	leave
+  800204:	c3                   	ret
+
+0000000000800205 <sys_yield>:
+
+void
+sys_yield(void) {
+  800205:	55                   	push   %rbp
+  800206:	48 89 e5             	mov    %rsp,%rbp
+  800209:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80020a:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80020f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800214:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800219:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80021e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800223:	be 00 00 00 00       	mov    $0x0,%esi
+  800228:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80022e:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800230:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800234:	c9                   	leave
+  800235:	c3                   	ret
+
+0000000000800236 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800236:	55                   	push   %rbp
+  800237:	48 89 e5             	mov    %rsp,%rbp
+  80023a:	53                   	push   %rbx
+  80023b:	48 89 fa             	mov    %rdi,%rdx
+  80023e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800241:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800246:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80024d:	00 00 00 
+  800250:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800255:	be 00 00 00 00       	mov    $0x0,%esi
+  80025a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800260:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800262:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800266:	c9                   	leave
+  800267:	c3                   	ret
+
+0000000000800268 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800268:	55                   	push   %rbp
+  800269:	48 89 e5             	mov    %rsp,%rbp
+  80026c:	53                   	push   %rbx
+  80026d:	49 89 f8             	mov    %rdi,%r8
+  800270:	48 89 d3             	mov    %rdx,%rbx
+  800273:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800276:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80027b:	4c 89 c2             	mov    %r8,%rdx
+  80027e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800281:	be 00 00 00 00       	mov    $0x0,%esi
+  800286:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80028c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80028e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800292:	c9                   	leave
+  800293:	c3                   	ret
+
+0000000000800294 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800294:	55                   	push   %rbp
+  800295:	48 89 e5             	mov    %rsp,%rbp
+  800298:	53                   	push   %rbx
+  800299:	48 83 ec 08          	sub    $0x8,%rsp
+  80029d:	89 f8                	mov    %edi,%eax
+  80029f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002a2:	48 63 f9             	movslq %ecx,%rdi
+  8002a5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002a8:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002ad:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002bb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002bd:	48 85 c0             	test   %rax,%rax
+  8002c0:	7f 06                	jg     8002c8 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002c6:	c9                   	leave
+  8002c7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002c8:	49 89 c0             	mov    %rax,%r8
+  8002cb:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002d0:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  8002d7:	00 00 00 
+  8002da:	be 26 00 00 00       	mov    $0x26,%esi
+  8002df:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  8002e6:	00 00 00 
+  8002e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ee:	49 b9 09 1b 80 00 00 	movabs $0x801b09,%r9
+  8002f5:	00 00 00 
+  8002f8:	41 ff d1             	call   *%r9
+
+00000000008002fb <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002fb:	55                   	push   %rbp
+  8002fc:	48 89 e5             	mov    %rsp,%rbp
+  8002ff:	53                   	push   %rbx
+  800300:	48 83 ec 08          	sub    $0x8,%rsp
+  800304:	89 f8                	mov    %edi,%eax
+  800306:	49 89 f2             	mov    %rsi,%r10
+  800309:	48 89 cf             	mov    %rcx,%rdi
+  80030c:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80030f:	48 63 da             	movslq %edx,%rbx
+  800312:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800315:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80031a:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80031d:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800320:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800322:	48 85 c0             	test   %rax,%rax
+  800325:	7f 06                	jg     80032d <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800327:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80032b:	c9                   	leave
+  80032c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80032d:	49 89 c0             	mov    %rax,%r8
+  800330:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800335:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  80033c:	00 00 00 
+  80033f:	be 26 00 00 00       	mov    $0x26,%esi
+  800344:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  80034b:	00 00 00 
+  80034e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800353:	49 b9 09 1b 80 00 00 	movabs $0x801b09,%r9
+  80035a:	00 00 00 
+  80035d:	41 ff d1             	call   *%r9
+
+0000000000800360 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800360:	55                   	push   %rbp
+  800361:	48 89 e5             	mov    %rsp,%rbp
+  800364:	53                   	push   %rbx
+  800365:	48 83 ec 08          	sub    $0x8,%rsp
+  800369:	48 89 f1             	mov    %rsi,%rcx
+  80036c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80036f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800372:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800377:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80037c:	be 00 00 00 00       	mov    $0x0,%esi
+  800381:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800387:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800389:	48 85 c0             	test   %rax,%rax
+  80038c:	7f 06                	jg     800394 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80038e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800392:	c9                   	leave
+  800393:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800394:	49 89 c0             	mov    %rax,%r8
+  800397:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80039c:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  8003a3:	00 00 00 
+  8003a6:	be 26 00 00 00       	mov    $0x26,%esi
+  8003ab:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  8003b2:	00 00 00 
+  8003b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ba:	49 b9 09 1b 80 00 00 	movabs $0x801b09,%r9
+  8003c1:	00 00 00 
+  8003c4:	41 ff d1             	call   *%r9
+
+00000000008003c7 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8003c7:	55                   	push   %rbp
+  8003c8:	48 89 e5             	mov    %rsp,%rbp
+  8003cb:	53                   	push   %rbx
+  8003cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8003d0:	89 f8                	mov    %edi,%eax
+  8003d2:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8003d5:	48 63 f9             	movslq %ecx,%rdi
+  8003d8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003db:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003e0:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003ee:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003f0:	48 85 c0             	test   %rax,%rax
+  8003f3:	7f 06                	jg     8003fb <sys_region_advise+0x34>
+}
+  8003f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003f9:	c9                   	leave
+  8003fa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003fb:	49 89 c0             	mov    %rax,%r8
+  8003fe:	b9 14 00 00 00       	mov    $0x14,%ecx
+  800403:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  80040a:	00 00 00 
+  80040d:	be 26 00 00 00       	mov    $0x26,%esi
+  800412:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  800419:	00 00 00 
+  80041c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800421:	49 b9 09 1b 80 00 00 	movabs $0x801b09,%r9
+  800428:	00 00 00 
+  80042b:	41 ff d1             	call   *%r9
+
+000000000080042e <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  80042e:	55                   	push   %rbp
+  80042f:	48 89 e5             	mov    %rsp,%rbp
+  800432:	53                   	push   %rbx
+  800433:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  800437:	48 63 ce             	movslq %esi,%rcx
+  80043a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80043d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800442:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800447:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80044c:	be 00 00 00 00       	mov    $0x0,%esi
+  800451:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800457:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800459:	48 85 c0             	test   %rax,%rax
+  80045c:	7f 06                	jg     800464 <sys_env_set_nice+0x36>
+}
+  80045e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800462:	c9                   	leave
+  800463:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800464:	49 89 c0             	mov    %rax,%r8
+  800467:	b9 15 00 00 00       	mov    $0x15,%ecx
+  80046c:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  800473:	00 00 00 
+  800476:	be 26 00 00 00       	mov    $0x26,%esi
+  80047b:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  800482:	00 00 00 
+  800485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048a:	49 b9 09 1b 80 00 00 	movabs $0x801b09,%r9
+  800491:	00 00 00 
+  800494:	41 ff d1             	call   *%r9
+
+0000000000800497 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800497:	55                   	push   %rbp
+  800498:	48 89 e5             	mov    %rsp,%rbp
+  80049b:	53                   	push   %rbx
+  80049c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004a0:	48 63 ce             	movslq %esi,%rcx
+  8004a3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004a6:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8004ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004c2:	48 85 c0             	test   %rax,%rax
+  8004c5:	7f 06                	jg     8004cd <sys_env_set_status+0x36>
+}
+  8004c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004cb:	c9                   	leave
+  8004cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004cd:	49 89 c0             	mov    %rax,%r8
+  8004d0:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004d5:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  8004dc:	00 00 00 
+  8004df:	be 26 00 00 00       	mov    $0x26,%esi
+  8004e4:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  8004eb:	00 00 00 
+  8004ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f3:	49 b9 09 1b 80 00 00 	movabs $0x801b09,%r9
+  8004fa:	00 00 00 
+  8004fd:	41 ff d1             	call   *%r9
+
+0000000000800500 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800500:	55                   	push   %rbp
+  800501:	48 89 e5             	mov    %rsp,%rbp
+  800504:	53                   	push   %rbx
+  800505:	48 83 ec 08          	sub    $0x8,%rsp
+  800509:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80050c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80050f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800514:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800519:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80051e:	be 00 00 00 00       	mov    $0x0,%esi
+  800523:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800529:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80052b:	48 85 c0             	test   %rax,%rax
+  80052e:	7f 06                	jg     800536 <sys_env_set_trapframe+0x36>
+}
+  800530:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800534:	c9                   	leave
+  800535:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800536:	49 89 c0             	mov    %rax,%r8
+  800539:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80053e:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  800545:	00 00 00 
+  800548:	be 26 00 00 00       	mov    $0x26,%esi
+  80054d:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  800554:	00 00 00 
+  800557:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055c:	49 b9 09 1b 80 00 00 	movabs $0x801b09,%r9
+  800563:	00 00 00 
+  800566:	41 ff d1             	call   *%r9
+
+0000000000800569 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800569:	55                   	push   %rbp
+  80056a:	48 89 e5             	mov    %rsp,%rbp
+  80056d:	53                   	push   %rbx
+  80056e:	48 83 ec 08          	sub    $0x8,%rsp
+  800572:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800575:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800578:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80057d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800582:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800587:	be 00 00 00 00       	mov    $0x0,%esi
+  80058c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800592:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800594:	48 85 c0             	test   %rax,%rax
+  800597:	7f 06                	jg     80059f <sys_env_set_pgfault_upcall+0x36>
+}
+  800599:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80059d:	c9                   	leave
+  80059e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80059f:	49 89 c0             	mov    %rax,%r8
+  8005a2:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8005a7:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  8005ae:	00 00 00 
+  8005b1:	be 26 00 00 00       	mov    $0x26,%esi
+  8005b6:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  8005bd:	00 00 00 
+  8005c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c5:	49 b9 09 1b 80 00 00 	movabs $0x801b09,%r9
+  8005cc:	00 00 00 
+  8005cf:	41 ff d1             	call   *%r9
+
+00000000008005d2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8005d2:	55                   	push   %rbp
+  8005d3:	48 89 e5             	mov    %rsp,%rbp
+  8005d6:	53                   	push   %rbx
+  8005d7:	89 f8                	mov    %edi,%eax
+  8005d9:	49 89 f1             	mov    %rsi,%r9
+  8005dc:	48 89 d3             	mov    %rdx,%rbx
+  8005df:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8005e2:	49 63 f0             	movslq %r8d,%rsi
+  8005e5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005e8:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005ed:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005f6:	cd 30                	int    $0x30
+}
+  8005f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005fc:	c9                   	leave
+  8005fd:	c3                   	ret
+
+00000000008005fe <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8005fe:	55                   	push   %rbp
+  8005ff:	48 89 e5             	mov    %rsp,%rbp
+  800602:	53                   	push   %rbx
+  800603:	48 83 ec 08          	sub    $0x8,%rsp
+  800607:	48 89 fa             	mov    %rdi,%rdx
+  80060a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80060d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800612:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800617:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80061c:	be 00 00 00 00       	mov    $0x0,%esi
+  800621:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800627:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800629:	48 85 c0             	test   %rax,%rax
+  80062c:	7f 06                	jg     800634 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80062e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800632:	c9                   	leave
+  800633:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800634:	49 89 c0             	mov    %rax,%r8
+  800637:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80063c:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  800643:	00 00 00 
+  800646:	be 26 00 00 00       	mov    $0x26,%esi
+  80064b:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  800652:	00 00 00 
+  800655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065a:	49 b9 09 1b 80 00 00 	movabs $0x801b09,%r9
+  800661:	00 00 00 
+  800664:	41 ff d1             	call   *%r9
+
+0000000000800667 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800667:	55                   	push   %rbp
+  800668:	48 89 e5             	mov    %rsp,%rbp
+  80066b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80066c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800671:	ba 00 00 00 00       	mov    $0x0,%edx
+  800676:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80067b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800680:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800685:	be 00 00 00 00       	mov    $0x0,%esi
+  80068a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800690:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800692:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800696:	c9                   	leave
+  800697:	c3                   	ret
+
+0000000000800698 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  800698:	55                   	push   %rbp
+  800699:	48 89 e5             	mov    %rsp,%rbp
+  80069c:	53                   	push   %rbx
+  80069d:	48 83 ec 08          	sub    $0x8,%rsp
+  8006a1:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8006a4:	48 63 ce             	movslq %esi,%rcx
+  8006a7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006aa:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006bf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8006c1:	48 85 c0             	test   %rax,%rax
+  8006c4:	7f 06                	jg     8006cc <sys_sigqueue+0x34>
+}
+  8006c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006ca:	c9                   	leave
+  8006cb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006cc:	49 89 c0             	mov    %rax,%r8
+  8006cf:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8006d4:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  8006db:	00 00 00 
+  8006de:	be 26 00 00 00       	mov    $0x26,%esi
+  8006e3:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  8006ea:	00 00 00 
+  8006ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f2:	49 b9 09 1b 80 00 00 	movabs $0x801b09,%r9
+  8006f9:	00 00 00 
+  8006fc:	41 ff d1             	call   *%r9
+
+00000000008006ff <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8006ff:	55                   	push   %rbp
+  800700:	48 89 e5             	mov    %rsp,%rbp
+  800703:	53                   	push   %rbx
+  800704:	48 83 ec 08          	sub    $0x8,%rsp
+  800708:	48 89 fa             	mov    %rdi,%rdx
+  80070b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80070e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800713:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800718:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80071d:	be 00 00 00 00       	mov    $0x0,%esi
+  800722:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800728:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80072a:	48 85 c0             	test   %rax,%rax
+  80072d:	7f 06                	jg     800735 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  80072f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800733:	c9                   	leave
+  800734:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800735:	49 89 c0             	mov    %rax,%r8
+  800738:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80073d:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  800744:	00 00 00 
+  800747:	be 26 00 00 00       	mov    $0x26,%esi
+  80074c:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  800753:	00 00 00 
+  800756:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075b:	49 b9 09 1b 80 00 00 	movabs $0x801b09,%r9
+  800762:	00 00 00 
+  800765:	41 ff d1             	call   *%r9
+
+0000000000800768 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  800768:	55                   	push   %rbp
+  800769:	48 89 e5             	mov    %rsp,%rbp
+  80076c:	53                   	push   %rbx
+  80076d:	48 83 ec 08          	sub    $0x8,%rsp
+  800771:	48 89 f1             	mov    %rsi,%rcx
+  800774:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  800777:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80077a:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80077f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800784:	be 00 00 00 00       	mov    $0x0,%esi
+  800789:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80078f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800791:	48 85 c0             	test   %rax,%rax
+  800794:	7f 06                	jg     80079c <sys_sigaction+0x34>
+}
+  800796:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80079a:	c9                   	leave
+  80079b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80079c:	49 89 c0             	mov    %rax,%r8
+  80079f:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8007a4:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  8007ab:	00 00 00 
+  8007ae:	be 26 00 00 00       	mov    $0x26,%esi
+  8007b3:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  8007ba:	00 00 00 
+  8007bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c2:	49 b9 09 1b 80 00 00 	movabs $0x801b09,%r9
+  8007c9:	00 00 00 
+  8007cc:	41 ff d1             	call   *%r9
+
+00000000008007cf <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8007cf:	55                   	push   %rbp
+  8007d0:	48 89 e5             	mov    %rsp,%rbp
+  8007d3:	53                   	push   %rbx
+  8007d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8007d8:	48 89 f1             	mov    %rsi,%rcx
+  8007db:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8007de:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8007e1:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8007e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8007f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8007f6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8007f8:	48 85 c0             	test   %rax,%rax
+  8007fb:	7f 06                	jg     800803 <sys_sigprocmask+0x34>
+}
+  8007fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800801:	c9                   	leave
+  800802:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800803:	49 89 c0             	mov    %rax,%r8
+  800806:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80080b:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  800812:	00 00 00 
+  800815:	be 26 00 00 00       	mov    $0x26,%esi
+  80081a:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  800821:	00 00 00 
+  800824:	b8 00 00 00 00       	mov    $0x0,%eax
+  800829:	49 b9 09 1b 80 00 00 	movabs $0x801b09,%r9
+  800830:	00 00 00 
+  800833:	41 ff d1             	call   *%r9
+
+0000000000800836 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800836:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80083d:	ff ff ff 
+  800840:	48 01 f8             	add    %rdi,%rax
+  800843:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800847:	c3                   	ret
+
+0000000000800848 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800848:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80084f:	ff ff ff 
+  800852:	48 01 f8             	add    %rdi,%rax
+  800855:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800859:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80085f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800863:	c3                   	ret
+
+0000000000800864 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800864:	55                   	push   %rbp
+  800865:	48 89 e5             	mov    %rsp,%rbp
+  800868:	41 57                	push   %r15
+  80086a:	41 56                	push   %r14
+  80086c:	41 55                	push   %r13
+  80086e:	41 54                	push   %r12
+  800870:	53                   	push   %rbx
+  800871:	48 83 ec 08          	sub    $0x8,%rsp
+  800875:	49 89 ff             	mov    %rdi,%r15
+  800878:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80087d:	49 bd e2 17 80 00 00 	movabs $0x8017e2,%r13
+  800884:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800887:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80088d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800890:	48 89 df             	mov    %rbx,%rdi
+  800893:	41 ff d5             	call   *%r13
+  800896:	83 e0 04             	and    $0x4,%eax
+  800899:	74 17                	je     8008b2 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80089b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8008a2:	4c 39 f3             	cmp    %r14,%rbx
+  8008a5:	75 e6                	jne    80088d <fd_alloc+0x29>
+  8008a7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8008ad:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8008b2:	4d 89 27             	mov    %r12,(%r15)
+}
+  8008b5:	48 83 c4 08          	add    $0x8,%rsp
+  8008b9:	5b                   	pop    %rbx
+  8008ba:	41 5c                	pop    %r12
+  8008bc:	41 5d                	pop    %r13
+  8008be:	41 5e                	pop    %r14
+  8008c0:	41 5f                	pop    %r15
+  8008c2:	5d                   	pop    %rbp
+  8008c3:	c3                   	ret
+
+00000000008008c4 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8008c4:	83 ff 1f             	cmp    $0x1f,%edi
+  8008c7:	77 39                	ja     800902 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8008c9:	55                   	push   %rbp
+  8008ca:	48 89 e5             	mov    %rsp,%rbp
+  8008cd:	41 54                	push   %r12
+  8008cf:	53                   	push   %rbx
+  8008d0:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8008d3:	48 63 df             	movslq %edi,%rbx
+  8008d6:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8008dd:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8008e1:	48 89 df             	mov    %rbx,%rdi
+  8008e4:	48 b8 e2 17 80 00 00 	movabs $0x8017e2,%rax
+  8008eb:	00 00 00 
+  8008ee:	ff d0                	call   *%rax
+  8008f0:	a8 04                	test   $0x4,%al
+  8008f2:	74 14                	je     800908 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8008f4:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8008f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008fd:	5b                   	pop    %rbx
+  8008fe:	41 5c                	pop    %r12
+  800900:	5d                   	pop    %rbp
+  800901:	c3                   	ret
+        return -E_INVAL;
+  800902:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800907:	c3                   	ret
+        return -E_INVAL;
+  800908:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80090d:	eb ee                	jmp    8008fd <fd_lookup+0x39>
+
+000000000080090f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80090f:	55                   	push   %rbp
+  800910:	48 89 e5             	mov    %rsp,%rbp
+  800913:	41 54                	push   %r12
+  800915:	53                   	push   %rbx
+  800916:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800919:	48 b8 00 2c 80 00 00 	movabs $0x802c00,%rax
+  800920:	00 00 00 
+  800923:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80092a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80092d:	39 3b                	cmp    %edi,(%rbx)
+  80092f:	74 47                	je     800978 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800931:	48 83 c0 08          	add    $0x8,%rax
+  800935:	48 8b 18             	mov    (%rax),%rbx
+  800938:	48 85 db             	test   %rbx,%rbx
+  80093b:	75 f0                	jne    80092d <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80093d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800944:	00 00 00 
+  800947:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80094d:	89 fa                	mov    %edi,%edx
+  80094f:	48 bf 70 2b 80 00 00 	movabs $0x802b70,%rdi
+  800956:	00 00 00 
+  800959:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095e:	48 b9 59 1c 80 00 00 	movabs $0x801c59,%rcx
+  800965:	00 00 00 
+  800968:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80096a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80096f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800973:	5b                   	pop    %rbx
+  800974:	41 5c                	pop    %r12
+  800976:	5d                   	pop    %rbp
+  800977:	c3                   	ret
+            return 0;
+  800978:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097d:	eb f0                	jmp    80096f <dev_lookup+0x60>
+
+000000000080097f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80097f:	55                   	push   %rbp
+  800980:	48 89 e5             	mov    %rsp,%rbp
+  800983:	41 55                	push   %r13
+  800985:	41 54                	push   %r12
+  800987:	53                   	push   %rbx
+  800988:	48 83 ec 18          	sub    $0x18,%rsp
+  80098c:	48 89 fb             	mov    %rdi,%rbx
+  80098f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800992:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800999:	ff ff ff 
+  80099c:	48 01 df             	add    %rbx,%rdi
+  80099f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8009a3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009a7:	48 b8 c4 08 80 00 00 	movabs $0x8008c4,%rax
+  8009ae:	00 00 00 
+  8009b1:	ff d0                	call   *%rax
+  8009b3:	41 89 c5             	mov    %eax,%r13d
+  8009b6:	85 c0                	test   %eax,%eax
+  8009b8:	78 06                	js     8009c0 <fd_close+0x41>
+  8009ba:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8009be:	74 1a                	je     8009da <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8009c0:	45 84 e4             	test   %r12b,%r12b
+  8009c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c8:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8009cc:	44 89 e8             	mov    %r13d,%eax
+  8009cf:	48 83 c4 18          	add    $0x18,%rsp
+  8009d3:	5b                   	pop    %rbx
+  8009d4:	41 5c                	pop    %r12
+  8009d6:	41 5d                	pop    %r13
+  8009d8:	5d                   	pop    %rbp
+  8009d9:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8009da:	8b 3b                	mov    (%rbx),%edi
+  8009dc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8009e0:	48 b8 0f 09 80 00 00 	movabs $0x80090f,%rax
+  8009e7:	00 00 00 
+  8009ea:	ff d0                	call   *%rax
+  8009ec:	41 89 c5             	mov    %eax,%r13d
+  8009ef:	85 c0                	test   %eax,%eax
+  8009f1:	78 1b                	js     800a0e <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8009f3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8009f7:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8009fb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800a01:	48 85 c0             	test   %rax,%rax
+  800a04:	74 08                	je     800a0e <fd_close+0x8f>
+  800a06:	48 89 df             	mov    %rbx,%rdi
+  800a09:	ff d0                	call   *%rax
+  800a0b:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800a0e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a13:	48 89 de             	mov    %rbx,%rsi
+  800a16:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a1b:	48 b8 60 03 80 00 00 	movabs $0x800360,%rax
+  800a22:	00 00 00 
+  800a25:	ff d0                	call   *%rax
+    return res;
+  800a27:	eb a3                	jmp    8009cc <fd_close+0x4d>
+
+0000000000800a29 <close>:
+
+int
+close(int fdnum) {
+  800a29:	55                   	push   %rbp
+  800a2a:	48 89 e5             	mov    %rsp,%rbp
+  800a2d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800a31:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800a35:	48 b8 c4 08 80 00 00 	movabs $0x8008c4,%rax
+  800a3c:	00 00 00 
+  800a3f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800a41:	85 c0                	test   %eax,%eax
+  800a43:	78 15                	js     800a5a <close+0x31>
+
+    return fd_close(fd, 1);
+  800a45:	be 01 00 00 00       	mov    $0x1,%esi
+  800a4a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800a4e:	48 b8 7f 09 80 00 00 	movabs $0x80097f,%rax
+  800a55:	00 00 00 
+  800a58:	ff d0                	call   *%rax
+}
+  800a5a:	c9                   	leave
+  800a5b:	c3                   	ret
+
+0000000000800a5c <close_all>:
+
+void
+close_all(void) {
+  800a5c:	55                   	push   %rbp
+  800a5d:	48 89 e5             	mov    %rsp,%rbp
+  800a60:	41 54                	push   %r12
+  800a62:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800a63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a68:	49 bc 29 0a 80 00 00 	movabs $0x800a29,%r12
+  800a6f:	00 00 00 
+  800a72:	89 df                	mov    %ebx,%edi
+  800a74:	41 ff d4             	call   *%r12
+  800a77:	83 c3 01             	add    $0x1,%ebx
+  800a7a:	83 fb 20             	cmp    $0x20,%ebx
+  800a7d:	75 f3                	jne    800a72 <close_all+0x16>
+}
+  800a7f:	5b                   	pop    %rbx
+  800a80:	41 5c                	pop    %r12
+  800a82:	5d                   	pop    %rbp
+  800a83:	c3                   	ret
+
+0000000000800a84 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800a84:	55                   	push   %rbp
+  800a85:	48 89 e5             	mov    %rsp,%rbp
+  800a88:	41 57                	push   %r15
+  800a8a:	41 56                	push   %r14
+  800a8c:	41 55                	push   %r13
+  800a8e:	41 54                	push   %r12
+  800a90:	53                   	push   %rbx
+  800a91:	48 83 ec 18          	sub    $0x18,%rsp
+  800a95:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800a98:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800a9c:	48 b8 c4 08 80 00 00 	movabs $0x8008c4,%rax
+  800aa3:	00 00 00 
+  800aa6:	ff d0                	call   *%rax
+  800aa8:	89 c3                	mov    %eax,%ebx
+  800aaa:	85 c0                	test   %eax,%eax
+  800aac:	0f 88 b8 00 00 00    	js     800b6a <dup+0xe6>
+    close(newfdnum);
+  800ab2:	44 89 e7             	mov    %r12d,%edi
+  800ab5:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  800abc:	00 00 00 
+  800abf:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800ac1:	4d 63 ec             	movslq %r12d,%r13
+  800ac4:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800acb:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800acf:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800ad3:	4c 89 ff             	mov    %r15,%rdi
+  800ad6:	49 be 48 08 80 00 00 	movabs $0x800848,%r14
+  800add:	00 00 00 
+  800ae0:	41 ff d6             	call   *%r14
+  800ae3:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800ae6:	4c 89 ef             	mov    %r13,%rdi
+  800ae9:	41 ff d6             	call   *%r14
+  800aec:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800aef:	48 89 df             	mov    %rbx,%rdi
+  800af2:	48 b8 e2 17 80 00 00 	movabs $0x8017e2,%rax
+  800af9:	00 00 00 
+  800afc:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800afe:	a8 04                	test   $0x4,%al
+  800b00:	74 2b                	je     800b2d <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800b02:	41 89 c1             	mov    %eax,%r9d
+  800b05:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800b0b:	4c 89 f1             	mov    %r14,%rcx
+  800b0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b13:	48 89 de             	mov    %rbx,%rsi
+  800b16:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b1b:	48 b8 fb 02 80 00 00 	movabs $0x8002fb,%rax
+  800b22:	00 00 00 
+  800b25:	ff d0                	call   *%rax
+  800b27:	89 c3                	mov    %eax,%ebx
+  800b29:	85 c0                	test   %eax,%eax
+  800b2b:	78 4e                	js     800b7b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800b2d:	4c 89 ff             	mov    %r15,%rdi
+  800b30:	48 b8 e2 17 80 00 00 	movabs $0x8017e2,%rax
+  800b37:	00 00 00 
+  800b3a:	ff d0                	call   *%rax
+  800b3c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800b3f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800b45:	4c 89 e9             	mov    %r13,%rcx
+  800b48:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b4d:	4c 89 fe             	mov    %r15,%rsi
+  800b50:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b55:	48 b8 fb 02 80 00 00 	movabs $0x8002fb,%rax
+  800b5c:	00 00 00 
+  800b5f:	ff d0                	call   *%rax
+  800b61:	89 c3                	mov    %eax,%ebx
+  800b63:	85 c0                	test   %eax,%eax
+  800b65:	78 14                	js     800b7b <dup+0xf7>
+
+    return newfdnum;
+  800b67:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800b6a:	89 d8                	mov    %ebx,%eax
+  800b6c:	48 83 c4 18          	add    $0x18,%rsp
+  800b70:	5b                   	pop    %rbx
+  800b71:	41 5c                	pop    %r12
+  800b73:	41 5d                	pop    %r13
+  800b75:	41 5e                	pop    %r14
+  800b77:	41 5f                	pop    %r15
+  800b79:	5d                   	pop    %rbp
+  800b7a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800b7b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b80:	4c 89 ee             	mov    %r13,%rsi
+  800b83:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b88:	49 bc 60 03 80 00 00 	movabs $0x800360,%r12
+  800b8f:	00 00 00 
+  800b92:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800b95:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b9a:	4c 89 f6             	mov    %r14,%rsi
+  800b9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ba2:	41 ff d4             	call   *%r12
+    return res;
+  800ba5:	eb c3                	jmp    800b6a <dup+0xe6>
+
+0000000000800ba7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800ba7:	55                   	push   %rbp
+  800ba8:	48 89 e5             	mov    %rsp,%rbp
+  800bab:	41 56                	push   %r14
+  800bad:	41 55                	push   %r13
+  800baf:	41 54                	push   %r12
+  800bb1:	53                   	push   %rbx
+  800bb2:	48 83 ec 10          	sub    $0x10,%rsp
+  800bb6:	89 fb                	mov    %edi,%ebx
+  800bb8:	49 89 f4             	mov    %rsi,%r12
+  800bbb:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bbe:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bc2:	48 b8 c4 08 80 00 00 	movabs $0x8008c4,%rax
+  800bc9:	00 00 00 
+  800bcc:	ff d0                	call   *%rax
+  800bce:	85 c0                	test   %eax,%eax
+  800bd0:	78 4c                	js     800c1e <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bd2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bd6:	41 8b 3e             	mov    (%r14),%edi
+  800bd9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bdd:	48 b8 0f 09 80 00 00 	movabs $0x80090f,%rax
+  800be4:	00 00 00 
+  800be7:	ff d0                	call   *%rax
+  800be9:	85 c0                	test   %eax,%eax
+  800beb:	78 35                	js     800c22 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800bed:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800bf1:	83 e0 03             	and    $0x3,%eax
+  800bf4:	83 f8 01             	cmp    $0x1,%eax
+  800bf7:	74 2d                	je     800c26 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800bf9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bfd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800c01:	48 85 c0             	test   %rax,%rax
+  800c04:	74 56                	je     800c5c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800c06:	4c 89 ea             	mov    %r13,%rdx
+  800c09:	4c 89 e6             	mov    %r12,%rsi
+  800c0c:	4c 89 f7             	mov    %r14,%rdi
+  800c0f:	ff d0                	call   *%rax
+}
+  800c11:	48 83 c4 10          	add    $0x10,%rsp
+  800c15:	5b                   	pop    %rbx
+  800c16:	41 5c                	pop    %r12
+  800c18:	41 5d                	pop    %r13
+  800c1a:	41 5e                	pop    %r14
+  800c1c:	5d                   	pop    %rbp
+  800c1d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c1e:	48 98                	cltq
+  800c20:	eb ef                	jmp    800c11 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c22:	48 98                	cltq
+  800c24:	eb eb                	jmp    800c11 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c26:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c2d:	00 00 00 
+  800c30:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c36:	89 da                	mov    %ebx,%edx
+  800c38:	48 bf b1 2b 80 00 00 	movabs $0x802bb1,%rdi
+  800c3f:	00 00 00 
+  800c42:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c47:	48 b9 59 1c 80 00 00 	movabs $0x801c59,%rcx
+  800c4e:	00 00 00 
+  800c51:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c53:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c5a:	eb b5                	jmp    800c11 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800c5c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c63:	eb ac                	jmp    800c11 <read+0x6a>
+
+0000000000800c65 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800c65:	55                   	push   %rbp
+  800c66:	48 89 e5             	mov    %rsp,%rbp
+  800c69:	41 57                	push   %r15
+  800c6b:	41 56                	push   %r14
+  800c6d:	41 55                	push   %r13
+  800c6f:	41 54                	push   %r12
+  800c71:	53                   	push   %rbx
+  800c72:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800c76:	48 85 d2             	test   %rdx,%rdx
+  800c79:	74 54                	je     800ccf <readn+0x6a>
+  800c7b:	41 89 fd             	mov    %edi,%r13d
+  800c7e:	49 89 f6             	mov    %rsi,%r14
+  800c81:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800c84:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800c89:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800c8e:	49 bf a7 0b 80 00 00 	movabs $0x800ba7,%r15
+  800c95:	00 00 00 
+  800c98:	4c 89 e2             	mov    %r12,%rdx
+  800c9b:	48 29 f2             	sub    %rsi,%rdx
+  800c9e:	4c 01 f6             	add    %r14,%rsi
+  800ca1:	44 89 ef             	mov    %r13d,%edi
+  800ca4:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800ca7:	85 c0                	test   %eax,%eax
+  800ca9:	78 20                	js     800ccb <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800cab:	01 c3                	add    %eax,%ebx
+  800cad:	85 c0                	test   %eax,%eax
+  800caf:	74 08                	je     800cb9 <readn+0x54>
+  800cb1:	48 63 f3             	movslq %ebx,%rsi
+  800cb4:	4c 39 e6             	cmp    %r12,%rsi
+  800cb7:	72 df                	jb     800c98 <readn+0x33>
+    }
+    return res;
+  800cb9:	48 63 c3             	movslq %ebx,%rax
+}
+  800cbc:	48 83 c4 08          	add    $0x8,%rsp
+  800cc0:	5b                   	pop    %rbx
+  800cc1:	41 5c                	pop    %r12
+  800cc3:	41 5d                	pop    %r13
+  800cc5:	41 5e                	pop    %r14
+  800cc7:	41 5f                	pop    %r15
+  800cc9:	5d                   	pop    %rbp
+  800cca:	c3                   	ret
+        if (inc < 0) return inc;
+  800ccb:	48 98                	cltq
+  800ccd:	eb ed                	jmp    800cbc <readn+0x57>
+    int inc = 1, res = 0;
+  800ccf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cd4:	eb e3                	jmp    800cb9 <readn+0x54>
+
+0000000000800cd6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800cd6:	55                   	push   %rbp
+  800cd7:	48 89 e5             	mov    %rsp,%rbp
+  800cda:	41 56                	push   %r14
+  800cdc:	41 55                	push   %r13
+  800cde:	41 54                	push   %r12
+  800ce0:	53                   	push   %rbx
+  800ce1:	48 83 ec 10          	sub    $0x10,%rsp
+  800ce5:	89 fb                	mov    %edi,%ebx
+  800ce7:	49 89 f4             	mov    %rsi,%r12
+  800cea:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ced:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cf1:	48 b8 c4 08 80 00 00 	movabs $0x8008c4,%rax
+  800cf8:	00 00 00 
+  800cfb:	ff d0                	call   *%rax
+  800cfd:	85 c0                	test   %eax,%eax
+  800cff:	78 47                	js     800d48 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d01:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800d05:	41 8b 3e             	mov    (%r14),%edi
+  800d08:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800d0c:	48 b8 0f 09 80 00 00 	movabs $0x80090f,%rax
+  800d13:	00 00 00 
+  800d16:	ff d0                	call   *%rax
+  800d18:	85 c0                	test   %eax,%eax
+  800d1a:	78 30                	js     800d4c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d1c:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800d21:	74 2d                	je     800d50 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d23:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d27:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800d2b:	48 85 c0             	test   %rax,%rax
+  800d2e:	74 56                	je     800d86 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800d30:	4c 89 ea             	mov    %r13,%rdx
+  800d33:	4c 89 e6             	mov    %r12,%rsi
+  800d36:	4c 89 f7             	mov    %r14,%rdi
+  800d39:	ff d0                	call   *%rax
+}
+  800d3b:	48 83 c4 10          	add    $0x10,%rsp
+  800d3f:	5b                   	pop    %rbx
+  800d40:	41 5c                	pop    %r12
+  800d42:	41 5d                	pop    %r13
+  800d44:	41 5e                	pop    %r14
+  800d46:	5d                   	pop    %rbp
+  800d47:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d48:	48 98                	cltq
+  800d4a:	eb ef                	jmp    800d3b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d4c:	48 98                	cltq
+  800d4e:	eb eb                	jmp    800d3b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800d50:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d57:	00 00 00 
+  800d5a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800d60:	89 da                	mov    %ebx,%edx
+  800d62:	48 bf cd 2b 80 00 00 	movabs $0x802bcd,%rdi
+  800d69:	00 00 00 
+  800d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d71:	48 b9 59 1c 80 00 00 	movabs $0x801c59,%rcx
+  800d78:	00 00 00 
+  800d7b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d7d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800d84:	eb b5                	jmp    800d3b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d86:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800d8d:	eb ac                	jmp    800d3b <write+0x65>
+
+0000000000800d8f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800d8f:	55                   	push   %rbp
+  800d90:	48 89 e5             	mov    %rsp,%rbp
+  800d93:	53                   	push   %rbx
+  800d94:	48 83 ec 18          	sub    $0x18,%rsp
+  800d98:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d9a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d9e:	48 b8 c4 08 80 00 00 	movabs $0x8008c4,%rax
+  800da5:	00 00 00 
+  800da8:	ff d0                	call   *%rax
+  800daa:	85 c0                	test   %eax,%eax
+  800dac:	78 0c                	js     800dba <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800dae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800db2:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800db5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800dbe:	c9                   	leave
+  800dbf:	c3                   	ret
+
+0000000000800dc0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800dc0:	55                   	push   %rbp
+  800dc1:	48 89 e5             	mov    %rsp,%rbp
+  800dc4:	41 55                	push   %r13
+  800dc6:	41 54                	push   %r12
+  800dc8:	53                   	push   %rbx
+  800dc9:	48 83 ec 18          	sub    $0x18,%rsp
+  800dcd:	89 fb                	mov    %edi,%ebx
+  800dcf:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800dd2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800dd6:	48 b8 c4 08 80 00 00 	movabs $0x8008c4,%rax
+  800ddd:	00 00 00 
+  800de0:	ff d0                	call   *%rax
+  800de2:	85 c0                	test   %eax,%eax
+  800de4:	78 38                	js     800e1e <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800de6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800dea:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800dee:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800df2:	48 b8 0f 09 80 00 00 	movabs $0x80090f,%rax
+  800df9:	00 00 00 
+  800dfc:	ff d0                	call   *%rax
+  800dfe:	85 c0                	test   %eax,%eax
+  800e00:	78 1c                	js     800e1e <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800e02:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800e07:	74 20                	je     800e29 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800e09:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e0d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800e11:	48 85 c0             	test   %rax,%rax
+  800e14:	74 47                	je     800e5d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800e16:	44 89 e6             	mov    %r12d,%esi
+  800e19:	4c 89 ef             	mov    %r13,%rdi
+  800e1c:	ff d0                	call   *%rax
+}
+  800e1e:	48 83 c4 18          	add    $0x18,%rsp
+  800e22:	5b                   	pop    %rbx
+  800e23:	41 5c                	pop    %r12
+  800e25:	41 5d                	pop    %r13
+  800e27:	5d                   	pop    %rbp
+  800e28:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800e29:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800e30:	00 00 00 
+  800e33:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800e39:	89 da                	mov    %ebx,%edx
+  800e3b:	48 bf 90 2b 80 00 00 	movabs $0x802b90,%rdi
+  800e42:	00 00 00 
+  800e45:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4a:	48 b9 59 1c 80 00 00 	movabs $0x801c59,%rcx
+  800e51:	00 00 00 
+  800e54:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e5b:	eb c1                	jmp    800e1e <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800e5d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e62:	eb ba                	jmp    800e1e <ftruncate+0x5e>
+
+0000000000800e64 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800e64:	55                   	push   %rbp
+  800e65:	48 89 e5             	mov    %rsp,%rbp
+  800e68:	41 54                	push   %r12
+  800e6a:	53                   	push   %rbx
+  800e6b:	48 83 ec 10          	sub    $0x10,%rsp
+  800e6f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e72:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e76:	48 b8 c4 08 80 00 00 	movabs $0x8008c4,%rax
+  800e7d:	00 00 00 
+  800e80:	ff d0                	call   *%rax
+  800e82:	85 c0                	test   %eax,%eax
+  800e84:	78 4e                	js     800ed4 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e86:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800e8a:	41 8b 3c 24          	mov    (%r12),%edi
+  800e8e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800e92:	48 b8 0f 09 80 00 00 	movabs $0x80090f,%rax
+  800e99:	00 00 00 
+  800e9c:	ff d0                	call   *%rax
+  800e9e:	85 c0                	test   %eax,%eax
+  800ea0:	78 32                	js     800ed4 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800ea2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800ea6:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800eab:	74 30                	je     800edd <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800ead:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800eb0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800eb7:	00 00 00 
+    stat->st_isdir = 0;
+  800eba:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800ec1:	00 00 00 
+    stat->st_dev = dev;
+  800ec4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800ecb:	48 89 de             	mov    %rbx,%rsi
+  800ece:	4c 89 e7             	mov    %r12,%rdi
+  800ed1:	ff 50 28             	call   *0x28(%rax)
+}
+  800ed4:	48 83 c4 10          	add    $0x10,%rsp
+  800ed8:	5b                   	pop    %rbx
+  800ed9:	41 5c                	pop    %r12
+  800edb:	5d                   	pop    %rbp
+  800edc:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800edd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ee2:	eb f0                	jmp    800ed4 <fstat+0x70>
+
+0000000000800ee4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800ee4:	55                   	push   %rbp
+  800ee5:	48 89 e5             	mov    %rsp,%rbp
+  800ee8:	41 54                	push   %r12
+  800eea:	53                   	push   %rbx
+  800eeb:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800eee:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef3:	48 b8 65 11 80 00 00 	movabs $0x801165,%rax
+  800efa:	00 00 00 
+  800efd:	ff d0                	call   *%rax
+  800eff:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800f01:	85 c0                	test   %eax,%eax
+  800f03:	78 25                	js     800f2a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800f05:	4c 89 e6             	mov    %r12,%rsi
+  800f08:	89 c7                	mov    %eax,%edi
+  800f0a:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  800f11:	00 00 00 
+  800f14:	ff d0                	call   *%rax
+  800f16:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800f19:	89 df                	mov    %ebx,%edi
+  800f1b:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  800f22:	00 00 00 
+  800f25:	ff d0                	call   *%rax
+
+    return res;
+  800f27:	44 89 e3             	mov    %r12d,%ebx
+}
+  800f2a:	89 d8                	mov    %ebx,%eax
+  800f2c:	5b                   	pop    %rbx
+  800f2d:	41 5c                	pop    %r12
+  800f2f:	5d                   	pop    %rbp
+  800f30:	c3                   	ret
+
+0000000000800f31 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800f31:	55                   	push   %rbp
+  800f32:	48 89 e5             	mov    %rsp,%rbp
+  800f35:	41 54                	push   %r12
+  800f37:	53                   	push   %rbx
+  800f38:	48 83 ec 10          	sub    $0x10,%rsp
+  800f3c:	41 89 fc             	mov    %edi,%r12d
+  800f3f:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f42:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f49:	00 00 00 
+  800f4c:	83 38 00             	cmpl   $0x0,(%rax)
+  800f4f:	74 5e                	je     800faf <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800f51:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800f57:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800f5c:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800f63:	00 00 00 
+  800f66:	44 89 e6             	mov    %r12d,%esi
+  800f69:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f70:	00 00 00 
+  800f73:	8b 38                	mov    (%rax),%edi
+  800f75:	48 b8 3a 2a 80 00 00 	movabs $0x802a3a,%rax
+  800f7c:	00 00 00 
+  800f7f:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800f81:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800f88:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800f89:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f8e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800f92:	48 89 de             	mov    %rbx,%rsi
+  800f95:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f9a:	48 b8 a5 29 80 00 00 	movabs $0x8029a5,%rax
+  800fa1:	00 00 00 
+  800fa4:	ff d0                	call   *%rax
+}
+  800fa6:	48 83 c4 10          	add    $0x10,%rsp
+  800faa:	5b                   	pop    %rbx
+  800fab:	41 5c                	pop    %r12
+  800fad:	5d                   	pop    %rbp
+  800fae:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800faf:	bf 03 00 00 00       	mov    $0x3,%edi
+  800fb4:	48 b8 da 2a 80 00 00 	movabs $0x802ada,%rax
+  800fbb:	00 00 00 
+  800fbe:	ff d0                	call   *%rax
+  800fc0:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800fc7:	00 00 
+  800fc9:	eb 86                	jmp    800f51 <fsipc+0x20>
+
+0000000000800fcb <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800fcb:	55                   	push   %rbp
+  800fcc:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800fcf:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800fd6:	00 00 00 
+  800fd9:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800fdc:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800fde:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800fe1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe6:	bf 02 00 00 00       	mov    $0x2,%edi
+  800feb:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  800ff2:	00 00 00 
+  800ff5:	ff d0                	call   *%rax
+}
+  800ff7:	5d                   	pop    %rbp
+  800ff8:	c3                   	ret
+
+0000000000800ff9 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800ff9:	55                   	push   %rbp
+  800ffa:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800ffd:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801000:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801007:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801009:	be 00 00 00 00       	mov    $0x0,%esi
+  80100e:	bf 06 00 00 00       	mov    $0x6,%edi
+  801013:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  80101a:	00 00 00 
+  80101d:	ff d0                	call   *%rax
+}
+  80101f:	5d                   	pop    %rbp
+  801020:	c3                   	ret
+
+0000000000801021 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801021:	55                   	push   %rbp
+  801022:	48 89 e5             	mov    %rsp,%rbp
+  801025:	41 54                	push   %r12
+  801027:	53                   	push   %rbx
+  801028:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80102b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80102e:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801035:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801037:	be 00 00 00 00       	mov    $0x0,%esi
+  80103c:	bf 05 00 00 00       	mov    $0x5,%edi
+  801041:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  801048:	00 00 00 
+  80104b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80104d:	85 c0                	test   %eax,%eax
+  80104f:	78 3d                	js     80108e <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801051:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801058:	00 00 00 
+  80105b:	4c 89 e6             	mov    %r12,%rsi
+  80105e:	48 89 df             	mov    %rbx,%rdi
+  801061:	48 b8 7e 25 80 00 00 	movabs $0x80257e,%rax
+  801068:	00 00 00 
+  80106b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80106d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801074:	00 
+  801075:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80107b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801082:	00 
+  801083:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801089:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80108e:	5b                   	pop    %rbx
+  80108f:	41 5c                	pop    %r12
+  801091:	5d                   	pop    %rbp
+  801092:	c3                   	ret
+
+0000000000801093 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801093:	55                   	push   %rbp
+  801094:	48 89 e5             	mov    %rsp,%rbp
+  801097:	41 54                	push   %r12
+  801099:	53                   	push   %rbx
+  80109a:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  80109d:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8010a2:	48 39 c2             	cmp    %rax,%rdx
+  8010a5:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8010a9:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8010ac:	48 89 c2             	mov    %rax,%rdx
+  8010af:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8010b6:	00 00 00 
+  8010b9:	48 b8 df 27 80 00 00 	movabs $0x8027df,%rax
+  8010c0:	00 00 00 
+  8010c3:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8010c5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8010cc:	00 00 00 
+  8010cf:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8010d4:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8010d6:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8010da:	be 00 00 00 00       	mov    $0x0,%esi
+  8010df:	bf 04 00 00 00       	mov    $0x4,%edi
+  8010e4:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  8010eb:	00 00 00 
+  8010ee:	ff d0                	call   *%rax
+  8010f0:	48 98                	cltq
+}
+  8010f2:	5b                   	pop    %rbx
+  8010f3:	41 5c                	pop    %r12
+  8010f5:	5d                   	pop    %rbp
+  8010f6:	c3                   	ret
+
+00000000008010f7 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8010f7:	55                   	push   %rbp
+  8010f8:	48 89 e5             	mov    %rsp,%rbp
+  8010fb:	41 54                	push   %r12
+  8010fd:	53                   	push   %rbx
+  8010fe:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801101:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801108:	00 00 00 
+  80110b:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80110e:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  801110:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801115:	48 39 ca             	cmp    %rcx,%rdx
+  801118:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  80111c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  801120:	be 00 00 00 00       	mov    $0x0,%esi
+  801125:	bf 03 00 00 00       	mov    $0x3,%edi
+  80112a:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  801131:	00 00 00 
+  801134:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  801136:	85 c0                	test   %eax,%eax
+  801138:	78 27                	js     801161 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  80113a:	48 63 d8             	movslq %eax,%rbx
+  80113d:	48 89 da             	mov    %rbx,%rdx
+  801140:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801147:	00 00 00 
+  80114a:	4c 89 e7             	mov    %r12,%rdi
+  80114d:	48 b8 df 27 80 00 00 	movabs $0x8027df,%rax
+  801154:	00 00 00 
+  801157:	ff d0                	call   *%rax
+    return bytes_read;
+  801159:	48 89 d8             	mov    %rbx,%rax
+}
+  80115c:	5b                   	pop    %rbx
+  80115d:	41 5c                	pop    %r12
+  80115f:	5d                   	pop    %rbp
+  801160:	c3                   	ret
+        return bytes_read;
+  801161:	48 98                	cltq
+  801163:	eb f7                	jmp    80115c <devfile_read+0x65>
+
+0000000000801165 <open>:
+open(const char *path, int mode) {
+  801165:	55                   	push   %rbp
+  801166:	48 89 e5             	mov    %rsp,%rbp
+  801169:	41 55                	push   %r13
+  80116b:	41 54                	push   %r12
+  80116d:	53                   	push   %rbx
+  80116e:	48 83 ec 18          	sub    $0x18,%rsp
+  801172:	49 89 fc             	mov    %rdi,%r12
+  801175:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801178:	48 b8 40 25 80 00 00 	movabs $0x802540,%rax
+  80117f:	00 00 00 
+  801182:	ff d0                	call   *%rax
+  801184:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80118a:	0f 87 8a 00 00 00    	ja     80121a <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801190:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801194:	48 b8 64 08 80 00 00 	movabs $0x800864,%rax
+  80119b:	00 00 00 
+  80119e:	ff d0                	call   *%rax
+  8011a0:	89 c3                	mov    %eax,%ebx
+  8011a2:	85 c0                	test   %eax,%eax
+  8011a4:	78 50                	js     8011f6 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8011a6:	4c 89 e6             	mov    %r12,%rsi
+  8011a9:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8011b0:	00 00 00 
+  8011b3:	48 89 df             	mov    %rbx,%rdi
+  8011b6:	48 b8 7e 25 80 00 00 	movabs $0x80257e,%rax
+  8011bd:	00 00 00 
+  8011c0:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011c2:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011c9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8011cd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011d2:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  8011d9:	00 00 00 
+  8011dc:	ff d0                	call   *%rax
+  8011de:	89 c3                	mov    %eax,%ebx
+  8011e0:	85 c0                	test   %eax,%eax
+  8011e2:	78 1f                	js     801203 <open+0x9e>
+    return fd2num(fd);
+  8011e4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8011e8:	48 b8 36 08 80 00 00 	movabs $0x800836,%rax
+  8011ef:	00 00 00 
+  8011f2:	ff d0                	call   *%rax
+  8011f4:	89 c3                	mov    %eax,%ebx
+}
+  8011f6:	89 d8                	mov    %ebx,%eax
+  8011f8:	48 83 c4 18          	add    $0x18,%rsp
+  8011fc:	5b                   	pop    %rbx
+  8011fd:	41 5c                	pop    %r12
+  8011ff:	41 5d                	pop    %r13
+  801201:	5d                   	pop    %rbp
+  801202:	c3                   	ret
+        fd_close(fd, 0);
+  801203:	be 00 00 00 00       	mov    $0x0,%esi
+  801208:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80120c:	48 b8 7f 09 80 00 00 	movabs $0x80097f,%rax
+  801213:	00 00 00 
+  801216:	ff d0                	call   *%rax
+        return res;
+  801218:	eb dc                	jmp    8011f6 <open+0x91>
+        return -E_BAD_PATH;
+  80121a:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80121f:	eb d5                	jmp    8011f6 <open+0x91>
+
+0000000000801221 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801221:	55                   	push   %rbp
+  801222:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801225:	be 00 00 00 00       	mov    $0x0,%esi
+  80122a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80122f:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  801236:	00 00 00 
+  801239:	ff d0                	call   *%rax
+}
+  80123b:	5d                   	pop    %rbp
+  80123c:	c3                   	ret
+
+000000000080123d <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80123d:	55                   	push   %rbp
+  80123e:	48 89 e5             	mov    %rsp,%rbp
+  801241:	41 54                	push   %r12
+  801243:	53                   	push   %rbx
+  801244:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801247:	48 b8 48 08 80 00 00 	movabs $0x800848,%rax
+  80124e:	00 00 00 
+  801251:	ff d0                	call   *%rax
+  801253:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801256:	48 be 20 2c 80 00 00 	movabs $0x802c20,%rsi
+  80125d:	00 00 00 
+  801260:	48 89 df             	mov    %rbx,%rdi
+  801263:	48 b8 7e 25 80 00 00 	movabs $0x80257e,%rax
+  80126a:	00 00 00 
+  80126d:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80126f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801274:	41 2b 04 24          	sub    (%r12),%eax
+  801278:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80127e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801285:	00 00 00 
+    stat->st_dev = &devpipe;
+  801288:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80128f:	00 00 00 
+  801292:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801299:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129e:	5b                   	pop    %rbx
+  80129f:	41 5c                	pop    %r12
+  8012a1:	5d                   	pop    %rbp
+  8012a2:	c3                   	ret
+
+00000000008012a3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8012a3:	55                   	push   %rbp
+  8012a4:	48 89 e5             	mov    %rsp,%rbp
+  8012a7:	41 54                	push   %r12
+  8012a9:	53                   	push   %rbx
+  8012aa:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8012ad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012b2:	48 89 fe             	mov    %rdi,%rsi
+  8012b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012ba:	49 bc 60 03 80 00 00 	movabs $0x800360,%r12
+  8012c1:	00 00 00 
+  8012c4:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012c7:	48 89 df             	mov    %rbx,%rdi
+  8012ca:	48 b8 48 08 80 00 00 	movabs $0x800848,%rax
+  8012d1:	00 00 00 
+  8012d4:	ff d0                	call   *%rax
+  8012d6:	48 89 c6             	mov    %rax,%rsi
+  8012d9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012e3:	41 ff d4             	call   *%r12
+}
+  8012e6:	5b                   	pop    %rbx
+  8012e7:	41 5c                	pop    %r12
+  8012e9:	5d                   	pop    %rbp
+  8012ea:	c3                   	ret
+
+00000000008012eb <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8012eb:	55                   	push   %rbp
+  8012ec:	48 89 e5             	mov    %rsp,%rbp
+  8012ef:	41 57                	push   %r15
+  8012f1:	41 56                	push   %r14
+  8012f3:	41 55                	push   %r13
+  8012f5:	41 54                	push   %r12
+  8012f7:	53                   	push   %rbx
+  8012f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8012fc:	49 89 fc             	mov    %rdi,%r12
+  8012ff:	49 89 f5             	mov    %rsi,%r13
+  801302:	49 89 d7             	mov    %rdx,%r15
+  801305:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801309:	48 b8 48 08 80 00 00 	movabs $0x800848,%rax
+  801310:	00 00 00 
+  801313:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801315:	4d 85 ff             	test   %r15,%r15
+  801318:	0f 84 af 00 00 00    	je     8013cd <devpipe_write+0xe2>
+  80131e:	48 89 c3             	mov    %rax,%rbx
+  801321:	4c 89 f8             	mov    %r15,%rax
+  801324:	4d 89 ef             	mov    %r13,%r15
+  801327:	4c 01 e8             	add    %r13,%rax
+  80132a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80132e:	49 bd 68 02 80 00 00 	movabs $0x800268,%r13
+  801335:	00 00 00 
+            sys_yield();
+  801338:	49 be 05 02 80 00 00 	movabs $0x800205,%r14
+  80133f:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801342:	8b 73 04             	mov    0x4(%rbx),%esi
+  801345:	48 63 ce             	movslq %esi,%rcx
+  801348:	48 63 03             	movslq (%rbx),%rax
+  80134b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801351:	48 39 c1             	cmp    %rax,%rcx
+  801354:	72 2e                	jb     801384 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801356:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80135b:	48 89 da             	mov    %rbx,%rdx
+  80135e:	be 00 10 00 00       	mov    $0x1000,%esi
+  801363:	4c 89 e7             	mov    %r12,%rdi
+  801366:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801369:	85 c0                	test   %eax,%eax
+  80136b:	74 66                	je     8013d3 <devpipe_write+0xe8>
+            sys_yield();
+  80136d:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801370:	8b 73 04             	mov    0x4(%rbx),%esi
+  801373:	48 63 ce             	movslq %esi,%rcx
+  801376:	48 63 03             	movslq (%rbx),%rax
+  801379:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80137f:	48 39 c1             	cmp    %rax,%rcx
+  801382:	73 d2                	jae    801356 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801384:	41 0f b6 3f          	movzbl (%r15),%edi
+  801388:	48 89 ca             	mov    %rcx,%rdx
+  80138b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80138f:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  801396:	08 10 20 
+  801399:	48 f7 e2             	mul    %rdx
+  80139c:	48 c1 ea 06          	shr    $0x6,%rdx
+  8013a0:	48 89 d0             	mov    %rdx,%rax
+  8013a3:	48 c1 e0 09          	shl    $0x9,%rax
+  8013a7:	48 29 d0             	sub    %rdx,%rax
+  8013aa:	48 c1 e0 03          	shl    $0x3,%rax
+  8013ae:	48 29 c1             	sub    %rax,%rcx
+  8013b1:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013b6:	83 c6 01             	add    $0x1,%esi
+  8013b9:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013bc:	49 83 c7 01          	add    $0x1,%r15
+  8013c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013c4:	49 39 c7             	cmp    %rax,%r15
+  8013c7:	0f 85 75 ff ff ff    	jne    801342 <devpipe_write+0x57>
+    return n;
+  8013cd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8013d1:	eb 05                	jmp    8013d8 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8013d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013d8:	48 83 c4 18          	add    $0x18,%rsp
+  8013dc:	5b                   	pop    %rbx
+  8013dd:	41 5c                	pop    %r12
+  8013df:	41 5d                	pop    %r13
+  8013e1:	41 5e                	pop    %r14
+  8013e3:	41 5f                	pop    %r15
+  8013e5:	5d                   	pop    %rbp
+  8013e6:	c3                   	ret
+
+00000000008013e7 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8013e7:	55                   	push   %rbp
+  8013e8:	48 89 e5             	mov    %rsp,%rbp
+  8013eb:	41 57                	push   %r15
+  8013ed:	41 56                	push   %r14
+  8013ef:	41 55                	push   %r13
+  8013f1:	41 54                	push   %r12
+  8013f3:	53                   	push   %rbx
+  8013f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8013f8:	49 89 fc             	mov    %rdi,%r12
+  8013fb:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8013ff:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801403:	48 b8 48 08 80 00 00 	movabs $0x800848,%rax
+  80140a:	00 00 00 
+  80140d:	ff d0                	call   *%rax
+  80140f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801412:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801418:	49 bd 68 02 80 00 00 	movabs $0x800268,%r13
+  80141f:	00 00 00 
+            sys_yield();
+  801422:	49 be 05 02 80 00 00 	movabs $0x800205,%r14
+  801429:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80142c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801431:	74 7d                	je     8014b0 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801433:	8b 03                	mov    (%rbx),%eax
+  801435:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801438:	75 26                	jne    801460 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80143a:	4d 85 ff             	test   %r15,%r15
+  80143d:	75 77                	jne    8014b6 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80143f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801444:	48 89 da             	mov    %rbx,%rdx
+  801447:	be 00 10 00 00       	mov    $0x1000,%esi
+  80144c:	4c 89 e7             	mov    %r12,%rdi
+  80144f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801452:	85 c0                	test   %eax,%eax
+  801454:	74 72                	je     8014c8 <devpipe_read+0xe1>
+            sys_yield();
+  801456:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801459:	8b 03                	mov    (%rbx),%eax
+  80145b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80145e:	74 df                	je     80143f <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801460:	48 63 c8             	movslq %eax,%rcx
+  801463:	48 89 ca             	mov    %rcx,%rdx
+  801466:	48 c1 ea 03          	shr    $0x3,%rdx
+  80146a:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801471:	08 10 20 
+  801474:	48 89 d0             	mov    %rdx,%rax
+  801477:	48 f7 e6             	mul    %rsi
+  80147a:	48 c1 ea 06          	shr    $0x6,%rdx
+  80147e:	48 89 d0             	mov    %rdx,%rax
+  801481:	48 c1 e0 09          	shl    $0x9,%rax
+  801485:	48 29 d0             	sub    %rdx,%rax
+  801488:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80148f:	00 
+  801490:	48 89 c8             	mov    %rcx,%rax
+  801493:	48 29 d0             	sub    %rdx,%rax
+  801496:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80149b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80149f:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8014a3:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8014a6:	49 83 c7 01          	add    $0x1,%r15
+  8014aa:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8014ae:	75 83                	jne    801433 <devpipe_read+0x4c>
+    return n;
+  8014b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014b4:	eb 03                	jmp    8014b9 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014b6:	4c 89 f8             	mov    %r15,%rax
+}
+  8014b9:	48 83 c4 18          	add    $0x18,%rsp
+  8014bd:	5b                   	pop    %rbx
+  8014be:	41 5c                	pop    %r12
+  8014c0:	41 5d                	pop    %r13
+  8014c2:	41 5e                	pop    %r14
+  8014c4:	41 5f                	pop    %r15
+  8014c6:	5d                   	pop    %rbp
+  8014c7:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014cd:	eb ea                	jmp    8014b9 <devpipe_read+0xd2>
+
+00000000008014cf <pipe>:
+pipe(int pfd[2]) {
+  8014cf:	55                   	push   %rbp
+  8014d0:	48 89 e5             	mov    %rsp,%rbp
+  8014d3:	41 55                	push   %r13
+  8014d5:	41 54                	push   %r12
+  8014d7:	53                   	push   %rbx
+  8014d8:	48 83 ec 18          	sub    $0x18,%rsp
+  8014dc:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8014df:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8014e3:	48 b8 64 08 80 00 00 	movabs $0x800864,%rax
+  8014ea:	00 00 00 
+  8014ed:	ff d0                	call   *%rax
+  8014ef:	89 c3                	mov    %eax,%ebx
+  8014f1:	85 c0                	test   %eax,%eax
+  8014f3:	0f 88 a0 01 00 00    	js     801699 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8014f9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8014fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801503:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801507:	bf 00 00 00 00       	mov    $0x0,%edi
+  80150c:	48 b8 94 02 80 00 00 	movabs $0x800294,%rax
+  801513:	00 00 00 
+  801516:	ff d0                	call   *%rax
+  801518:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80151a:	85 c0                	test   %eax,%eax
+  80151c:	0f 88 77 01 00 00    	js     801699 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801522:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801526:	48 b8 64 08 80 00 00 	movabs $0x800864,%rax
+  80152d:	00 00 00 
+  801530:	ff d0                	call   *%rax
+  801532:	89 c3                	mov    %eax,%ebx
+  801534:	85 c0                	test   %eax,%eax
+  801536:	0f 88 43 01 00 00    	js     80167f <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80153c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801541:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801546:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80154a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80154f:	48 b8 94 02 80 00 00 	movabs $0x800294,%rax
+  801556:	00 00 00 
+  801559:	ff d0                	call   *%rax
+  80155b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80155d:	85 c0                	test   %eax,%eax
+  80155f:	0f 88 1a 01 00 00    	js     80167f <pipe+0x1b0>
+    va = fd2data(fd0);
+  801565:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801569:	48 b8 48 08 80 00 00 	movabs $0x800848,%rax
+  801570:	00 00 00 
+  801573:	ff d0                	call   *%rax
+  801575:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801578:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80157d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801582:	48 89 c6             	mov    %rax,%rsi
+  801585:	bf 00 00 00 00       	mov    $0x0,%edi
+  80158a:	48 b8 94 02 80 00 00 	movabs $0x800294,%rax
+  801591:	00 00 00 
+  801594:	ff d0                	call   *%rax
+  801596:	89 c3                	mov    %eax,%ebx
+  801598:	85 c0                	test   %eax,%eax
+  80159a:	0f 88 c5 00 00 00    	js     801665 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8015a0:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8015a4:	48 b8 48 08 80 00 00 	movabs $0x800848,%rax
+  8015ab:	00 00 00 
+  8015ae:	ff d0                	call   *%rax
+  8015b0:	48 89 c1             	mov    %rax,%rcx
+  8015b3:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8015b9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8015bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015c4:	4c 89 ee             	mov    %r13,%rsi
+  8015c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015cc:	48 b8 fb 02 80 00 00 	movabs $0x8002fb,%rax
+  8015d3:	00 00 00 
+  8015d6:	ff d0                	call   *%rax
+  8015d8:	89 c3                	mov    %eax,%ebx
+  8015da:	85 c0                	test   %eax,%eax
+  8015dc:	78 6e                	js     80164c <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8015de:	be 00 10 00 00       	mov    $0x1000,%esi
+  8015e3:	4c 89 ef             	mov    %r13,%rdi
+  8015e6:	48 b8 36 02 80 00 00 	movabs $0x800236,%rax
+  8015ed:	00 00 00 
+  8015f0:	ff d0                	call   *%rax
+  8015f2:	83 f8 02             	cmp    $0x2,%eax
+  8015f5:	0f 85 ab 00 00 00    	jne    8016a6 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8015fb:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  801602:	00 00 
+  801604:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801608:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80160a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80160e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801615:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801619:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80161b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80161f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801626:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80162a:	48 bb 36 08 80 00 00 	movabs $0x800836,%rbx
+  801631:	00 00 00 
+  801634:	ff d3                	call   *%rbx
+  801636:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80163a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80163e:	ff d3                	call   *%rbx
+  801640:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  801645:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164a:	eb 4d                	jmp    801699 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80164c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801651:	4c 89 ee             	mov    %r13,%rsi
+  801654:	bf 00 00 00 00       	mov    $0x0,%edi
+  801659:	48 b8 60 03 80 00 00 	movabs $0x800360,%rax
+  801660:	00 00 00 
+  801663:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  801665:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80166a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80166e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801673:	48 b8 60 03 80 00 00 	movabs $0x800360,%rax
+  80167a:	00 00 00 
+  80167d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80167f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801684:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801688:	bf 00 00 00 00       	mov    $0x0,%edi
+  80168d:	48 b8 60 03 80 00 00 	movabs $0x800360,%rax
+  801694:	00 00 00 
+  801697:	ff d0                	call   *%rax
+}
+  801699:	89 d8                	mov    %ebx,%eax
+  80169b:	48 83 c4 18          	add    $0x18,%rsp
+  80169f:	5b                   	pop    %rbx
+  8016a0:	41 5c                	pop    %r12
+  8016a2:	41 5d                	pop    %r13
+  8016a4:	5d                   	pop    %rbp
+  8016a5:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8016a6:	48 b9 50 2c 80 00 00 	movabs $0x802c50,%rcx
+  8016ad:	00 00 00 
+  8016b0:	48 ba 27 2c 80 00 00 	movabs $0x802c27,%rdx
+  8016b7:	00 00 00 
+  8016ba:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8016bf:	48 bf 3c 2c 80 00 00 	movabs $0x802c3c,%rdi
+  8016c6:	00 00 00 
+  8016c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ce:	49 b8 09 1b 80 00 00 	movabs $0x801b09,%r8
+  8016d5:	00 00 00 
+  8016d8:	41 ff d0             	call   *%r8
+
+00000000008016db <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8016db:	55                   	push   %rbp
+  8016dc:	48 89 e5             	mov    %rsp,%rbp
+  8016df:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8016e3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8016e7:	48 b8 c4 08 80 00 00 	movabs $0x8008c4,%rax
+  8016ee:	00 00 00 
+  8016f1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8016f3:	85 c0                	test   %eax,%eax
+  8016f5:	78 35                	js     80172c <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8016f7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8016fb:	48 b8 48 08 80 00 00 	movabs $0x800848,%rax
+  801702:	00 00 00 
+  801705:	ff d0                	call   *%rax
+  801707:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80170a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80170f:	be 00 10 00 00       	mov    $0x1000,%esi
+  801714:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801718:	48 b8 68 02 80 00 00 	movabs $0x800268,%rax
+  80171f:	00 00 00 
+  801722:	ff d0                	call   *%rax
+  801724:	85 c0                	test   %eax,%eax
+  801726:	0f 94 c0             	sete   %al
+  801729:	0f b6 c0             	movzbl %al,%eax
+}
+  80172c:	c9                   	leave
+  80172d:	c3                   	ret
+
+000000000080172e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80172e:	48 89 f8             	mov    %rdi,%rax
+  801731:	48 c1 e8 27          	shr    $0x27,%rax
+  801735:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80173c:	01 00 00 
+  80173f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801743:	f6 c2 01             	test   $0x1,%dl
+  801746:	74 6d                	je     8017b5 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801748:	48 89 f8             	mov    %rdi,%rax
+  80174b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80174f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801756:	01 00 00 
+  801759:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80175d:	f6 c2 01             	test   $0x1,%dl
+  801760:	74 62                	je     8017c4 <get_uvpt_entry+0x96>
+  801762:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801769:	01 00 00 
+  80176c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801770:	f6 c2 80             	test   $0x80,%dl
+  801773:	75 4f                	jne    8017c4 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801775:	48 89 f8             	mov    %rdi,%rax
+  801778:	48 c1 e8 15          	shr    $0x15,%rax
+  80177c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801783:	01 00 00 
+  801786:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80178a:	f6 c2 01             	test   $0x1,%dl
+  80178d:	74 44                	je     8017d3 <get_uvpt_entry+0xa5>
+  80178f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801796:	01 00 00 
+  801799:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80179d:	f6 c2 80             	test   $0x80,%dl
+  8017a0:	75 31                	jne    8017d3 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8017a2:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8017a6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8017ad:	01 00 00 
+  8017b0:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8017b4:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017b5:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017bc:	01 00 00 
+  8017bf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017c3:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017c4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017cb:	01 00 00 
+  8017ce:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017d2:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017d3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017da:	01 00 00 
+  8017dd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017e1:	c3                   	ret
+
+00000000008017e2 <get_prot>:
+
+int
+get_prot(void *va) {
+  8017e2:	55                   	push   %rbp
+  8017e3:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8017e6:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  8017ed:	00 00 00 
+  8017f0:	ff d0                	call   *%rax
+  8017f2:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8017f5:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8017fa:	89 c1                	mov    %eax,%ecx
+  8017fc:	83 c9 04             	or     $0x4,%ecx
+  8017ff:	f6 c2 01             	test   $0x1,%dl
+  801802:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  801805:	89 c1                	mov    %eax,%ecx
+  801807:	83 c9 02             	or     $0x2,%ecx
+  80180a:	f6 c2 02             	test   $0x2,%dl
+  80180d:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  801810:	89 c1                	mov    %eax,%ecx
+  801812:	83 c9 01             	or     $0x1,%ecx
+  801815:	48 85 d2             	test   %rdx,%rdx
+  801818:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80181b:	89 c1                	mov    %eax,%ecx
+  80181d:	83 c9 40             	or     $0x40,%ecx
+  801820:	f6 c6 04             	test   $0x4,%dh
+  801823:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  801826:	5d                   	pop    %rbp
+  801827:	c3                   	ret
+
+0000000000801828 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  801828:	55                   	push   %rbp
+  801829:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80182c:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  801833:	00 00 00 
+  801836:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  801838:	48 c1 e8 06          	shr    $0x6,%rax
+  80183c:	83 e0 01             	and    $0x1,%eax
+}
+  80183f:	5d                   	pop    %rbp
+  801840:	c3                   	ret
+
+0000000000801841 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  801841:	55                   	push   %rbp
+  801842:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  801845:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  80184c:	00 00 00 
+  80184f:	ff d0                	call   *%rax
+  801851:	83 e0 01             	and    $0x1,%eax
+}
+  801854:	5d                   	pop    %rbp
+  801855:	c3                   	ret
+
+0000000000801856 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  801856:	55                   	push   %rbp
+  801857:	48 89 e5             	mov    %rsp,%rbp
+  80185a:	41 57                	push   %r15
+  80185c:	41 56                	push   %r14
+  80185e:	41 55                	push   %r13
+  801860:	41 54                	push   %r12
+  801862:	53                   	push   %rbx
+  801863:	48 83 ec 18          	sub    $0x18,%rsp
+  801867:	49 89 ff             	mov    %rdi,%r15
+  80186a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80186e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  801873:	49 bc 41 18 80 00 00 	movabs $0x801841,%r12
+  80187a:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  80187d:	49 be e2 17 80 00 00 	movabs $0x8017e2,%r14
+  801884:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  801887:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  80188e:	00 00 00 
+  801891:	eb 0c                	jmp    80189f <foreach_shared_region+0x49>
+  801893:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80189a:	4c 39 eb             	cmp    %r13,%rbx
+  80189d:	74 38                	je     8018d7 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  80189f:	48 89 df             	mov    %rbx,%rdi
+  8018a2:	41 ff d4             	call   *%r12
+  8018a5:	84 c0                	test   %al,%al
+  8018a7:	74 ea                	je     801893 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  8018a9:	48 89 df             	mov    %rbx,%rdi
+  8018ac:	41 ff d6             	call   *%r14
+  8018af:	a8 40                	test   $0x40,%al
+  8018b1:	74 e0                	je     801893 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8018b3:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8018ba:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8018be:	48 89 df             	mov    %rbx,%rdi
+  8018c1:	41 ff d7             	call   *%r15
+        if (err)
+  8018c4:	85 c0                	test   %eax,%eax
+  8018c6:	74 cb                	je     801893 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8018c8:	48 83 c4 18          	add    $0x18,%rsp
+  8018cc:	5b                   	pop    %rbx
+  8018cd:	41 5c                	pop    %r12
+  8018cf:	41 5d                	pop    %r13
+  8018d1:	41 5e                	pop    %r14
+  8018d3:	41 5f                	pop    %r15
+  8018d5:	5d                   	pop    %rbp
+  8018d6:	c3                   	ret
+    return 0;
+  8018d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018dc:	eb ea                	jmp    8018c8 <foreach_shared_region+0x72>
+
+00000000008018de <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8018de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e3:	c3                   	ret
+
+00000000008018e4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8018e4:	55                   	push   %rbp
+  8018e5:	48 89 e5             	mov    %rsp,%rbp
+  8018e8:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8018eb:	48 be 74 2c 80 00 00 	movabs $0x802c74,%rsi
+  8018f2:	00 00 00 
+  8018f5:	48 b8 7e 25 80 00 00 	movabs $0x80257e,%rax
+  8018fc:	00 00 00 
+  8018ff:	ff d0                	call   *%rax
+    return 0;
+}
+  801901:	b8 00 00 00 00       	mov    $0x0,%eax
+  801906:	5d                   	pop    %rbp
+  801907:	c3                   	ret
+
+0000000000801908 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801908:	55                   	push   %rbp
+  801909:	48 89 e5             	mov    %rsp,%rbp
+  80190c:	41 57                	push   %r15
+  80190e:	41 56                	push   %r14
+  801910:	41 55                	push   %r13
+  801912:	41 54                	push   %r12
+  801914:	53                   	push   %rbx
+  801915:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80191c:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801923:	48 85 d2             	test   %rdx,%rdx
+  801926:	74 7a                	je     8019a2 <devcons_write+0x9a>
+  801928:	49 89 d6             	mov    %rdx,%r14
+  80192b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801931:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801936:	49 bf 78 27 80 00 00 	movabs $0x802778,%r15
+  80193d:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801940:	4c 89 f3             	mov    %r14,%rbx
+  801943:	48 29 f3             	sub    %rsi,%rbx
+  801946:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80194b:	48 39 c3             	cmp    %rax,%rbx
+  80194e:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801952:	4c 63 eb             	movslq %ebx,%r13
+  801955:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80195c:	48 01 c6             	add    %rax,%rsi
+  80195f:	4c 89 ea             	mov    %r13,%rdx
+  801962:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801969:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80196c:	4c 89 ee             	mov    %r13,%rsi
+  80196f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801976:	48 b8 0b 01 80 00 00 	movabs $0x80010b,%rax
+  80197d:	00 00 00 
+  801980:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801982:	41 01 dc             	add    %ebx,%r12d
+  801985:	49 63 f4             	movslq %r12d,%rsi
+  801988:	4c 39 f6             	cmp    %r14,%rsi
+  80198b:	72 b3                	jb     801940 <devcons_write+0x38>
+    return res;
+  80198d:	49 63 c4             	movslq %r12d,%rax
+}
+  801990:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801997:	5b                   	pop    %rbx
+  801998:	41 5c                	pop    %r12
+  80199a:	41 5d                	pop    %r13
+  80199c:	41 5e                	pop    %r14
+  80199e:	41 5f                	pop    %r15
+  8019a0:	5d                   	pop    %rbp
+  8019a1:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8019a2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8019a8:	eb e3                	jmp    80198d <devcons_write+0x85>
+
+00000000008019aa <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8019aa:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8019ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b2:	48 85 c0             	test   %rax,%rax
+  8019b5:	74 55                	je     801a0c <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8019b7:	55                   	push   %rbp
+  8019b8:	48 89 e5             	mov    %rsp,%rbp
+  8019bb:	41 55                	push   %r13
+  8019bd:	41 54                	push   %r12
+  8019bf:	53                   	push   %rbx
+  8019c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8019c4:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8019c7:	48 bb 38 01 80 00 00 	movabs $0x800138,%rbx
+  8019ce:	00 00 00 
+  8019d1:	49 bc 05 02 80 00 00 	movabs $0x800205,%r12
+  8019d8:	00 00 00 
+  8019db:	eb 03                	jmp    8019e0 <devcons_read+0x36>
+  8019dd:	41 ff d4             	call   *%r12
+  8019e0:	ff d3                	call   *%rbx
+  8019e2:	85 c0                	test   %eax,%eax
+  8019e4:	74 f7                	je     8019dd <devcons_read+0x33>
+    if (c < 0) return c;
+  8019e6:	48 63 d0             	movslq %eax,%rdx
+  8019e9:	78 13                	js     8019fe <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8019eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f0:	83 f8 04             	cmp    $0x4,%eax
+  8019f3:	74 09                	je     8019fe <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8019f5:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8019f9:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8019fe:	48 89 d0             	mov    %rdx,%rax
+  801a01:	48 83 c4 08          	add    $0x8,%rsp
+  801a05:	5b                   	pop    %rbx
+  801a06:	41 5c                	pop    %r12
+  801a08:	41 5d                	pop    %r13
+  801a0a:	5d                   	pop    %rbp
+  801a0b:	c3                   	ret
+  801a0c:	48 89 d0             	mov    %rdx,%rax
+  801a0f:	c3                   	ret
+
+0000000000801a10 <cputchar>:
+cputchar(int ch) {
+  801a10:	55                   	push   %rbp
+  801a11:	48 89 e5             	mov    %rsp,%rbp
+  801a14:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801a18:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801a1c:	be 01 00 00 00       	mov    $0x1,%esi
+  801a21:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801a25:	48 b8 0b 01 80 00 00 	movabs $0x80010b,%rax
+  801a2c:	00 00 00 
+  801a2f:	ff d0                	call   *%rax
+}
+  801a31:	c9                   	leave
+  801a32:	c3                   	ret
+
+0000000000801a33 <getchar>:
+getchar(void) {
+  801a33:	55                   	push   %rbp
+  801a34:	48 89 e5             	mov    %rsp,%rbp
+  801a37:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801a3b:	ba 01 00 00 00       	mov    $0x1,%edx
+  801a40:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801a44:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a49:	48 b8 a7 0b 80 00 00 	movabs $0x800ba7,%rax
+  801a50:	00 00 00 
+  801a53:	ff d0                	call   *%rax
+  801a55:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801a57:	85 c0                	test   %eax,%eax
+  801a59:	78 06                	js     801a61 <getchar+0x2e>
+  801a5b:	74 08                	je     801a65 <getchar+0x32>
+  801a5d:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801a61:	89 d0                	mov    %edx,%eax
+  801a63:	c9                   	leave
+  801a64:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801a65:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801a6a:	eb f5                	jmp    801a61 <getchar+0x2e>
+
+0000000000801a6c <iscons>:
+iscons(int fdnum) {
+  801a6c:	55                   	push   %rbp
+  801a6d:	48 89 e5             	mov    %rsp,%rbp
+  801a70:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801a74:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a78:	48 b8 c4 08 80 00 00 	movabs $0x8008c4,%rax
+  801a7f:	00 00 00 
+  801a82:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a84:	85 c0                	test   %eax,%eax
+  801a86:	78 18                	js     801aa0 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801a88:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a8c:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801a93:	00 00 00 
+  801a96:	8b 00                	mov    (%rax),%eax
+  801a98:	39 02                	cmp    %eax,(%rdx)
+  801a9a:	0f 94 c0             	sete   %al
+  801a9d:	0f b6 c0             	movzbl %al,%eax
+}
+  801aa0:	c9                   	leave
+  801aa1:	c3                   	ret
+
+0000000000801aa2 <opencons>:
+opencons(void) {
+  801aa2:	55                   	push   %rbp
+  801aa3:	48 89 e5             	mov    %rsp,%rbp
+  801aa6:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801aaa:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801aae:	48 b8 64 08 80 00 00 	movabs $0x800864,%rax
+  801ab5:	00 00 00 
+  801ab8:	ff d0                	call   *%rax
+  801aba:	85 c0                	test   %eax,%eax
+  801abc:	78 49                	js     801b07 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801abe:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ac3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ac8:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801acc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ad1:	48 b8 94 02 80 00 00 	movabs $0x800294,%rax
+  801ad8:	00 00 00 
+  801adb:	ff d0                	call   *%rax
+  801add:	85 c0                	test   %eax,%eax
+  801adf:	78 26                	js     801b07 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801ae1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ae5:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801aec:	00 00 
+  801aee:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801af0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801af4:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801afb:	48 b8 36 08 80 00 00 	movabs $0x800836,%rax
+  801b02:	00 00 00 
+  801b05:	ff d0                	call   *%rax
+}
+  801b07:	c9                   	leave
+  801b08:	c3                   	ret
+
+0000000000801b09 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801b09:	55                   	push   %rbp
+  801b0a:	48 89 e5             	mov    %rsp,%rbp
+  801b0d:	41 56                	push   %r14
+  801b0f:	41 55                	push   %r13
+  801b11:	41 54                	push   %r12
+  801b13:	53                   	push   %rbx
+  801b14:	48 83 ec 50          	sub    $0x50,%rsp
+  801b18:	49 89 fc             	mov    %rdi,%r12
+  801b1b:	41 89 f5             	mov    %esi,%r13d
+  801b1e:	48 89 d3             	mov    %rdx,%rbx
+  801b21:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b25:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801b29:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801b2d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801b34:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b38:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801b3c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801b40:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801b44:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801b4b:	00 00 00 
+  801b4e:	4c 8b 30             	mov    (%rax),%r14
+  801b51:	48 b8 d4 01 80 00 00 	movabs $0x8001d4,%rax
+  801b58:	00 00 00 
+  801b5b:	ff d0                	call   *%rax
+  801b5d:	89 c6                	mov    %eax,%esi
+  801b5f:	45 89 e8             	mov    %r13d,%r8d
+  801b62:	4c 89 e1             	mov    %r12,%rcx
+  801b65:	4c 89 f2             	mov    %r14,%rdx
+  801b68:	48 bf 80 2c 80 00 00 	movabs $0x802c80,%rdi
+  801b6f:	00 00 00 
+  801b72:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b77:	49 bc 59 1c 80 00 00 	movabs $0x801c59,%r12
+  801b7e:	00 00 00 
+  801b81:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801b84:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801b88:	48 89 df             	mov    %rbx,%rdi
+  801b8b:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  801b92:	00 00 00 
+  801b95:	ff d0                	call   *%rax
+    cprintf("\n");
+  801b97:	48 bf cb 2b 80 00 00 	movabs $0x802bcb,%rdi
+  801b9e:	00 00 00 
+  801ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba6:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801ba9:	cc                   	int3
+  801baa:	eb fd                	jmp    801ba9 <_panic+0xa0>
+
+0000000000801bac <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801bac:	55                   	push   %rbp
+  801bad:	48 89 e5             	mov    %rsp,%rbp
+  801bb0:	53                   	push   %rbx
+  801bb1:	48 83 ec 08          	sub    $0x8,%rsp
+  801bb5:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801bb8:	8b 06                	mov    (%rsi),%eax
+  801bba:	8d 50 01             	lea    0x1(%rax),%edx
+  801bbd:	89 16                	mov    %edx,(%rsi)
+  801bbf:	48 98                	cltq
+  801bc1:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801bc6:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801bcc:	74 0a                	je     801bd8 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801bce:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801bd2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bd6:	c9                   	leave
+  801bd7:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801bd8:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801bdc:	be ff 00 00 00       	mov    $0xff,%esi
+  801be1:	48 b8 0b 01 80 00 00 	movabs $0x80010b,%rax
+  801be8:	00 00 00 
+  801beb:	ff d0                	call   *%rax
+        state->offset = 0;
+  801bed:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801bf3:	eb d9                	jmp    801bce <putch+0x22>
+
+0000000000801bf5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801bf5:	55                   	push   %rbp
+  801bf6:	48 89 e5             	mov    %rsp,%rbp
+  801bf9:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801c00:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801c03:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801c0a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c14:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801c17:	48 89 f1             	mov    %rsi,%rcx
+  801c1a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801c21:	48 bf ac 1b 80 00 00 	movabs $0x801bac,%rdi
+  801c28:	00 00 00 
+  801c2b:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  801c32:	00 00 00 
+  801c35:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801c37:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801c3e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801c45:	48 b8 0b 01 80 00 00 	movabs $0x80010b,%rax
+  801c4c:	00 00 00 
+  801c4f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801c51:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801c57:	c9                   	leave
+  801c58:	c3                   	ret
+
+0000000000801c59 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801c59:	55                   	push   %rbp
+  801c5a:	48 89 e5             	mov    %rsp,%rbp
+  801c5d:	48 83 ec 50          	sub    $0x50,%rsp
+  801c61:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801c65:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801c69:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c6d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801c71:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801c75:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801c7c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c84:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801c88:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801c8c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801c90:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  801c97:	00 00 00 
+  801c9a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801c9c:	c9                   	leave
+  801c9d:	c3                   	ret
+
+0000000000801c9e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801c9e:	55                   	push   %rbp
+  801c9f:	48 89 e5             	mov    %rsp,%rbp
+  801ca2:	41 57                	push   %r15
+  801ca4:	41 56                	push   %r14
+  801ca6:	41 55                	push   %r13
+  801ca8:	41 54                	push   %r12
+  801caa:	53                   	push   %rbx
+  801cab:	48 83 ec 18          	sub    $0x18,%rsp
+  801caf:	49 89 fc             	mov    %rdi,%r12
+  801cb2:	49 89 f5             	mov    %rsi,%r13
+  801cb5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cb9:	8b 45 10             	mov    0x10(%rbp),%eax
+  801cbc:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801cbf:	41 89 cf             	mov    %ecx,%r15d
+  801cc2:	4c 39 fa             	cmp    %r15,%rdx
+  801cc5:	73 5b                	jae    801d22 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801cc7:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801ccb:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801ccf:	85 db                	test   %ebx,%ebx
+  801cd1:	7e 0e                	jle    801ce1 <print_num+0x43>
+            putch(padc, put_arg);
+  801cd3:	4c 89 ee             	mov    %r13,%rsi
+  801cd6:	44 89 f7             	mov    %r14d,%edi
+  801cd9:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801cdc:	83 eb 01             	sub    $0x1,%ebx
+  801cdf:	75 f2                	jne    801cd3 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801ce1:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801ce5:	48 b9 b4 2c 80 00 00 	movabs $0x802cb4,%rcx
+  801cec:	00 00 00 
+  801cef:	48 b8 a3 2c 80 00 00 	movabs $0x802ca3,%rax
+  801cf6:	00 00 00 
+  801cf9:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801cfd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d01:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d06:	49 f7 f7             	div    %r15
+  801d09:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801d0d:	4c 89 ee             	mov    %r13,%rsi
+  801d10:	41 ff d4             	call   *%r12
+}
+  801d13:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801d17:	5b                   	pop    %rbx
+  801d18:	41 5c                	pop    %r12
+  801d1a:	41 5d                	pop    %r13
+  801d1c:	41 5e                	pop    %r14
+  801d1e:	41 5f                	pop    %r15
+  801d20:	5d                   	pop    %rbp
+  801d21:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801d22:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d26:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d2b:	49 f7 f7             	div    %r15
+  801d2e:	48 83 ec 08          	sub    $0x8,%rsp
+  801d32:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801d36:	52                   	push   %rdx
+  801d37:	45 0f be c9          	movsbl %r9b,%r9d
+  801d3b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801d3f:	48 89 c2             	mov    %rax,%rdx
+  801d42:	48 b8 9e 1c 80 00 00 	movabs $0x801c9e,%rax
+  801d49:	00 00 00 
+  801d4c:	ff d0                	call   *%rax
+  801d4e:	48 83 c4 10          	add    $0x10,%rsp
+  801d52:	eb 8d                	jmp    801ce1 <print_num+0x43>
+
+0000000000801d54 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801d54:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801d58:	48 8b 06             	mov    (%rsi),%rax
+  801d5b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801d5f:	73 0a                	jae    801d6b <sprintputch+0x17>
+        *state->start++ = ch;
+  801d61:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d65:	48 89 16             	mov    %rdx,(%rsi)
+  801d68:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801d6b:	c3                   	ret
+
+0000000000801d6c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801d6c:	55                   	push   %rbp
+  801d6d:	48 89 e5             	mov    %rsp,%rbp
+  801d70:	48 83 ec 50          	sub    $0x50,%rsp
+  801d74:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d78:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d7c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801d80:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801d87:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801d93:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801d97:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801d9b:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  801da2:	00 00 00 
+  801da5:	ff d0                	call   *%rax
+}
+  801da7:	c9                   	leave
+  801da8:	c3                   	ret
+
+0000000000801da9 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801da9:	55                   	push   %rbp
+  801daa:	48 89 e5             	mov    %rsp,%rbp
+  801dad:	41 57                	push   %r15
+  801daf:	41 56                	push   %r14
+  801db1:	41 55                	push   %r13
+  801db3:	41 54                	push   %r12
+  801db5:	53                   	push   %rbx
+  801db6:	48 83 ec 38          	sub    $0x38,%rsp
+  801dba:	49 89 fe             	mov    %rdi,%r14
+  801dbd:	49 89 f5             	mov    %rsi,%r13
+  801dc0:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801dc3:	48 8b 01             	mov    (%rcx),%rax
+  801dc6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801dca:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801dce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dd2:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801dd6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801dda:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801dde:	0f b6 3b             	movzbl (%rbx),%edi
+  801de1:	40 80 ff 25          	cmp    $0x25,%dil
+  801de5:	74 18                	je     801dff <vprintfmt+0x56>
+            if (!ch) return;
+  801de7:	40 84 ff             	test   %dil,%dil
+  801dea:	0f 84 b1 06 00 00    	je     8024a1 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801df0:	40 0f b6 ff          	movzbl %dil,%edi
+  801df4:	4c 89 ee             	mov    %r13,%rsi
+  801df7:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801dfa:	4c 89 e3             	mov    %r12,%rbx
+  801dfd:	eb db                	jmp    801dda <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801dff:	be 00 00 00 00       	mov    $0x0,%esi
+  801e04:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801e08:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801e0d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e13:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801e1a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e1e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801e23:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801e28:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801e2b:	83 e8 23             	sub    $0x23,%eax
+  801e2e:	3c 57                	cmp    $0x57,%al
+  801e30:	0f 87 51 06 00 00    	ja     802487 <vprintfmt+0x6de>
+  801e36:	0f b6 c0             	movzbl %al,%eax
+  801e39:	48 b9 60 2e 80 00 00 	movabs $0x802e60,%rcx
+  801e40:	00 00 00 
+  801e43:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801e46:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801e49:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801e4d:	eb cf                	jmp    801e1e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801e4f:	49 89 dc             	mov    %rbx,%r12
+  801e52:	be 01 00 00 00       	mov    $0x1,%esi
+  801e57:	eb c5                	jmp    801e1e <vprintfmt+0x75>
+            padc = ch;
+  801e59:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801e5d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e60:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801e63:	eb b9                	jmp    801e1e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e68:	83 f8 2f             	cmp    $0x2f,%eax
+  801e6b:	77 24                	ja     801e91 <vprintfmt+0xe8>
+  801e6d:	89 c1                	mov    %eax,%ecx
+  801e6f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801e73:	83 c0 08             	add    $0x8,%eax
+  801e76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e79:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801e7c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801e7f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801e83:	79 99                	jns    801e1e <vprintfmt+0x75>
+                width = precision;
+  801e85:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801e89:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e8f:	eb 8d                	jmp    801e1e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e91:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e95:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801e99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e9d:	eb da                	jmp    801e79 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801e9f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801ea4:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801ea8:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801eae:	3c 39                	cmp    $0x39,%al
+  801eb0:	77 1c                	ja     801ece <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801eb2:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801eb6:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801eba:	0f b6 c0             	movzbl %al,%eax
+  801ebd:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801ec2:	0f b6 03             	movzbl (%rbx),%eax
+  801ec5:	3c 39                	cmp    $0x39,%al
+  801ec7:	76 e9                	jbe    801eb2 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801ec9:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801ecc:	eb b1                	jmp    801e7f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801ece:	49 89 dc             	mov    %rbx,%r12
+  801ed1:	eb ac                	jmp    801e7f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801ed3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801ed6:	85 c9                	test   %ecx,%ecx
+  801ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801edd:	0f 49 c1             	cmovns %ecx,%eax
+  801ee0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801ee3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ee6:	e9 33 ff ff ff       	jmp    801e1e <vprintfmt+0x75>
+            lflag++;
+  801eeb:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801eee:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ef1:	e9 28 ff ff ff       	jmp    801e1e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801ef6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ef9:	83 f8 2f             	cmp    $0x2f,%eax
+  801efc:	77 19                	ja     801f17 <vprintfmt+0x16e>
+  801efe:	89 c2                	mov    %eax,%edx
+  801f00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f04:	83 c0 08             	add    $0x8,%eax
+  801f07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f0a:	8b 3a                	mov    (%rdx),%edi
+  801f0c:	4c 89 ee             	mov    %r13,%rsi
+  801f0f:	41 ff d6             	call   *%r14
+            break;
+  801f12:	e9 c3 fe ff ff       	jmp    801dda <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  801f17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f23:	eb e5                	jmp    801f0a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  801f25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f28:	83 f8 2f             	cmp    $0x2f,%eax
+  801f2b:	77 5a                	ja     801f87 <vprintfmt+0x1de>
+  801f2d:	89 c2                	mov    %eax,%edx
+  801f2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f33:	83 c0 08             	add    $0x8,%eax
+  801f36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801f39:	8b 02                	mov    (%rdx),%eax
+  801f3b:	89 c1                	mov    %eax,%ecx
+  801f3d:	f7 d9                	neg    %ecx
+  801f3f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801f42:	83 f9 15             	cmp    $0x15,%ecx
+  801f45:	7f 4e                	jg     801f95 <vprintfmt+0x1ec>
+  801f47:	48 63 c1             	movslq %ecx,%rax
+  801f4a:	48 ba 20 31 80 00 00 	movabs $0x803120,%rdx
+  801f51:	00 00 00 
+  801f54:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801f58:	48 85 c0             	test   %rax,%rax
+  801f5b:	74 38                	je     801f95 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801f5d:	48 89 c1             	mov    %rax,%rcx
+  801f60:	48 ba 39 2c 80 00 00 	movabs $0x802c39,%rdx
+  801f67:	00 00 00 
+  801f6a:	4c 89 ee             	mov    %r13,%rsi
+  801f6d:	4c 89 f7             	mov    %r14,%rdi
+  801f70:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f75:	49 b8 6c 1d 80 00 00 	movabs $0x801d6c,%r8
+  801f7c:	00 00 00 
+  801f7f:	41 ff d0             	call   *%r8
+  801f82:	e9 53 fe ff ff       	jmp    801dda <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801f87:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f8b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f93:	eb a4                	jmp    801f39 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801f95:	48 ba cc 2c 80 00 00 	movabs $0x802ccc,%rdx
+  801f9c:	00 00 00 
+  801f9f:	4c 89 ee             	mov    %r13,%rsi
+  801fa2:	4c 89 f7             	mov    %r14,%rdi
+  801fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801faa:	49 b8 6c 1d 80 00 00 	movabs $0x801d6c,%r8
+  801fb1:	00 00 00 
+  801fb4:	41 ff d0             	call   *%r8
+  801fb7:	e9 1e fe ff ff       	jmp    801dda <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801fbc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fbf:	83 f8 2f             	cmp    $0x2f,%eax
+  801fc2:	77 6c                	ja     802030 <vprintfmt+0x287>
+  801fc4:	89 c2                	mov    %eax,%edx
+  801fc6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fca:	83 c0 08             	add    $0x8,%eax
+  801fcd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fd0:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801fd3:	48 85 d2             	test   %rdx,%rdx
+  801fd6:	48 b8 c5 2c 80 00 00 	movabs $0x802cc5,%rax
+  801fdd:	00 00 00 
+  801fe0:	48 0f 45 c2          	cmovne %rdx,%rax
+  801fe4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801fe8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801fec:	7e 06                	jle    801ff4 <vprintfmt+0x24b>
+  801fee:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801ff2:	75 4a                	jne    80203e <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ff4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801ff8:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801ffc:	0f b6 00             	movzbl (%rax),%eax
+  801fff:	84 c0                	test   %al,%al
+  802001:	0f 85 9a 00 00 00    	jne    8020a1 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  802007:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80200a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80200e:	85 c0                	test   %eax,%eax
+  802010:	0f 8e c4 fd ff ff    	jle    801dda <vprintfmt+0x31>
+  802016:	4c 89 ee             	mov    %r13,%rsi
+  802019:	bf 20 00 00 00       	mov    $0x20,%edi
+  80201e:	41 ff d6             	call   *%r14
+  802021:	41 83 ec 01          	sub    $0x1,%r12d
+  802025:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802029:	75 eb                	jne    802016 <vprintfmt+0x26d>
+  80202b:	e9 aa fd ff ff       	jmp    801dda <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802030:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802034:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802038:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80203c:	eb 92                	jmp    801fd0 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80203e:	49 63 f7             	movslq %r15d,%rsi
+  802041:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802045:	48 b8 5b 25 80 00 00 	movabs $0x80255b,%rax
+  80204c:	00 00 00 
+  80204f:	ff d0                	call   *%rax
+  802051:	48 89 c2             	mov    %rax,%rdx
+  802054:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802057:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802059:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80205c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80205f:	85 c0                	test   %eax,%eax
+  802061:	7e 91                	jle    801ff4 <vprintfmt+0x24b>
+  802063:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802068:	4c 89 ee             	mov    %r13,%rsi
+  80206b:	44 89 e7             	mov    %r12d,%edi
+  80206e:	41 ff d6             	call   *%r14
+  802071:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802075:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802078:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80207b:	75 eb                	jne    802068 <vprintfmt+0x2bf>
+  80207d:	e9 72 ff ff ff       	jmp    801ff4 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802082:	0f b6 f8             	movzbl %al,%edi
+  802085:	4c 89 ee             	mov    %r13,%rsi
+  802088:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80208b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80208f:	49 83 c4 01          	add    $0x1,%r12
+  802093:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802099:	84 c0                	test   %al,%al
+  80209b:	0f 84 66 ff ff ff    	je     802007 <vprintfmt+0x25e>
+  8020a1:	45 85 ff             	test   %r15d,%r15d
+  8020a4:	78 0a                	js     8020b0 <vprintfmt+0x307>
+  8020a6:	41 83 ef 01          	sub    $0x1,%r15d
+  8020aa:	0f 88 57 ff ff ff    	js     802007 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8020b0:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8020b4:	74 cc                	je     802082 <vprintfmt+0x2d9>
+  8020b6:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8020b9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8020be:	80 fa 5e             	cmp    $0x5e,%dl
+  8020c1:	77 c2                	ja     802085 <vprintfmt+0x2dc>
+  8020c3:	eb bd                	jmp    802082 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8020c5:	40 84 f6             	test   %sil,%sil
+  8020c8:	75 26                	jne    8020f0 <vprintfmt+0x347>
+    switch (lflag) {
+  8020ca:	85 d2                	test   %edx,%edx
+  8020cc:	74 59                	je     802127 <vprintfmt+0x37e>
+  8020ce:	83 fa 01             	cmp    $0x1,%edx
+  8020d1:	74 7b                	je     80214e <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8020d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8020d9:	0f 87 96 00 00 00    	ja     802175 <vprintfmt+0x3cc>
+  8020df:	89 c2                	mov    %eax,%edx
+  8020e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020e5:	83 c0 08             	add    $0x8,%eax
+  8020e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020eb:	4c 8b 22             	mov    (%rdx),%r12
+  8020ee:	eb 17                	jmp    802107 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8020f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8020f6:	77 21                	ja     802119 <vprintfmt+0x370>
+  8020f8:	89 c2                	mov    %eax,%edx
+  8020fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020fe:	83 c0 08             	add    $0x8,%eax
+  802101:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802104:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802107:	4d 85 e4             	test   %r12,%r12
+  80210a:	78 7a                	js     802186 <vprintfmt+0x3dd>
+            num = i;
+  80210c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80210f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802114:	e9 50 02 00 00       	jmp    802369 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802119:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80211d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802121:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802125:	eb dd                	jmp    802104 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802127:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80212a:	83 f8 2f             	cmp    $0x2f,%eax
+  80212d:	77 11                	ja     802140 <vprintfmt+0x397>
+  80212f:	89 c2                	mov    %eax,%edx
+  802131:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802135:	83 c0 08             	add    $0x8,%eax
+  802138:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80213b:	4c 63 22             	movslq (%rdx),%r12
+  80213e:	eb c7                	jmp    802107 <vprintfmt+0x35e>
+  802140:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802144:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802148:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80214c:	eb ed                	jmp    80213b <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80214e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802151:	83 f8 2f             	cmp    $0x2f,%eax
+  802154:	77 11                	ja     802167 <vprintfmt+0x3be>
+  802156:	89 c2                	mov    %eax,%edx
+  802158:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80215c:	83 c0 08             	add    $0x8,%eax
+  80215f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802162:	4c 8b 22             	mov    (%rdx),%r12
+  802165:	eb a0                	jmp    802107 <vprintfmt+0x35e>
+  802167:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80216b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80216f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802173:	eb ed                	jmp    802162 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802175:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802179:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80217d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802181:	e9 65 ff ff ff       	jmp    8020eb <vprintfmt+0x342>
+                putch('-', put_arg);
+  802186:	4c 89 ee             	mov    %r13,%rsi
+  802189:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80218e:	41 ff d6             	call   *%r14
+                i = -i;
+  802191:	49 f7 dc             	neg    %r12
+  802194:	e9 73 ff ff ff       	jmp    80210c <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802199:	40 84 f6             	test   %sil,%sil
+  80219c:	75 32                	jne    8021d0 <vprintfmt+0x427>
+    switch (lflag) {
+  80219e:	85 d2                	test   %edx,%edx
+  8021a0:	74 5d                	je     8021ff <vprintfmt+0x456>
+  8021a2:	83 fa 01             	cmp    $0x1,%edx
+  8021a5:	0f 84 82 00 00 00    	je     80222d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8021ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8021b1:	0f 87 a5 00 00 00    	ja     80225c <vprintfmt+0x4b3>
+  8021b7:	89 c2                	mov    %eax,%edx
+  8021b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021bd:	83 c0 08             	add    $0x8,%eax
+  8021c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021c3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8021cb:	e9 99 01 00 00       	jmp    802369 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8021d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8021d6:	77 19                	ja     8021f1 <vprintfmt+0x448>
+  8021d8:	89 c2                	mov    %eax,%edx
+  8021da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021de:	83 c0 08             	add    $0x8,%eax
+  8021e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021e4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021e7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8021ec:	e9 78 01 00 00       	jmp    802369 <vprintfmt+0x5c0>
+  8021f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021fd:	eb e5                	jmp    8021e4 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8021ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802202:	83 f8 2f             	cmp    $0x2f,%eax
+  802205:	77 18                	ja     80221f <vprintfmt+0x476>
+  802207:	89 c2                	mov    %eax,%edx
+  802209:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80220d:	83 c0 08             	add    $0x8,%eax
+  802210:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802213:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802215:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80221a:	e9 4a 01 00 00       	jmp    802369 <vprintfmt+0x5c0>
+  80221f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802223:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802227:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80222b:	eb e6                	jmp    802213 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80222d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802230:	83 f8 2f             	cmp    $0x2f,%eax
+  802233:	77 19                	ja     80224e <vprintfmt+0x4a5>
+  802235:	89 c2                	mov    %eax,%edx
+  802237:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80223b:	83 c0 08             	add    $0x8,%eax
+  80223e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802241:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802244:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802249:	e9 1b 01 00 00       	jmp    802369 <vprintfmt+0x5c0>
+  80224e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802252:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802256:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80225a:	eb e5                	jmp    802241 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80225c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802260:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802264:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802268:	e9 56 ff ff ff       	jmp    8021c3 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80226d:	40 84 f6             	test   %sil,%sil
+  802270:	75 2e                	jne    8022a0 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802272:	85 d2                	test   %edx,%edx
+  802274:	74 59                	je     8022cf <vprintfmt+0x526>
+  802276:	83 fa 01             	cmp    $0x1,%edx
+  802279:	74 7f                	je     8022fa <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80227b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80227e:	83 f8 2f             	cmp    $0x2f,%eax
+  802281:	0f 87 9f 00 00 00    	ja     802326 <vprintfmt+0x57d>
+  802287:	89 c2                	mov    %eax,%edx
+  802289:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80228d:	83 c0 08             	add    $0x8,%eax
+  802290:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802293:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802296:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80229b:	e9 c9 00 00 00       	jmp    802369 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8022a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8022a6:	77 19                	ja     8022c1 <vprintfmt+0x518>
+  8022a8:	89 c2                	mov    %eax,%edx
+  8022aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022ae:	83 c0 08             	add    $0x8,%eax
+  8022b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022b4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8022b7:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022bc:	e9 a8 00 00 00       	jmp    802369 <vprintfmt+0x5c0>
+  8022c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022cd:	eb e5                	jmp    8022b4 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8022cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8022d5:	77 15                	ja     8022ec <vprintfmt+0x543>
+  8022d7:	89 c2                	mov    %eax,%edx
+  8022d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022dd:	83 c0 08             	add    $0x8,%eax
+  8022e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022e3:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8022e5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8022ea:	eb 7d                	jmp    802369 <vprintfmt+0x5c0>
+  8022ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022f8:	eb e9                	jmp    8022e3 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8022fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022fd:	83 f8 2f             	cmp    $0x2f,%eax
+  802300:	77 16                	ja     802318 <vprintfmt+0x56f>
+  802302:	89 c2                	mov    %eax,%edx
+  802304:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802308:	83 c0 08             	add    $0x8,%eax
+  80230b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80230e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802311:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802316:	eb 51                	jmp    802369 <vprintfmt+0x5c0>
+  802318:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80231c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802320:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802324:	eb e8                	jmp    80230e <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802326:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80232a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80232e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802332:	e9 5c ff ff ff       	jmp    802293 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802337:	4c 89 ee             	mov    %r13,%rsi
+  80233a:	bf 30 00 00 00       	mov    $0x30,%edi
+  80233f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802342:	4c 89 ee             	mov    %r13,%rsi
+  802345:	bf 78 00 00 00       	mov    $0x78,%edi
+  80234a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80234d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802350:	83 f8 2f             	cmp    $0x2f,%eax
+  802353:	77 47                	ja     80239c <vprintfmt+0x5f3>
+  802355:	89 c2                	mov    %eax,%edx
+  802357:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80235b:	83 c0 08             	add    $0x8,%eax
+  80235e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802361:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802364:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802369:	48 83 ec 08          	sub    $0x8,%rsp
+  80236d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802371:	0f 94 c0             	sete   %al
+  802374:	0f b6 c0             	movzbl %al,%eax
+  802377:	50                   	push   %rax
+  802378:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80237d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802381:	4c 89 ee             	mov    %r13,%rsi
+  802384:	4c 89 f7             	mov    %r14,%rdi
+  802387:	48 b8 9e 1c 80 00 00 	movabs $0x801c9e,%rax
+  80238e:	00 00 00 
+  802391:	ff d0                	call   *%rax
+            break;
+  802393:	48 83 c4 10          	add    $0x10,%rsp
+  802397:	e9 3e fa ff ff       	jmp    801dda <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80239c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023a0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023a4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023a8:	eb b7                	jmp    802361 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8023aa:	40 84 f6             	test   %sil,%sil
+  8023ad:	75 2b                	jne    8023da <vprintfmt+0x631>
+    switch (lflag) {
+  8023af:	85 d2                	test   %edx,%edx
+  8023b1:	74 56                	je     802409 <vprintfmt+0x660>
+  8023b3:	83 fa 01             	cmp    $0x1,%edx
+  8023b6:	74 7f                	je     802437 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8023b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8023be:	0f 87 a2 00 00 00    	ja     802466 <vprintfmt+0x6bd>
+  8023c4:	89 c2                	mov    %eax,%edx
+  8023c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023ca:	83 c0 08             	add    $0x8,%eax
+  8023cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023d0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023d3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023d8:	eb 8f                	jmp    802369 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8023e0:	77 19                	ja     8023fb <vprintfmt+0x652>
+  8023e2:	89 c2                	mov    %eax,%edx
+  8023e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023e8:	83 c0 08             	add    $0x8,%eax
+  8023eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023ee:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023f1:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023f6:	e9 6e ff ff ff       	jmp    802369 <vprintfmt+0x5c0>
+  8023fb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023ff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802403:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802407:	eb e5                	jmp    8023ee <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802409:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80240c:	83 f8 2f             	cmp    $0x2f,%eax
+  80240f:	77 18                	ja     802429 <vprintfmt+0x680>
+  802411:	89 c2                	mov    %eax,%edx
+  802413:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802417:	83 c0 08             	add    $0x8,%eax
+  80241a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80241d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80241f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802424:	e9 40 ff ff ff       	jmp    802369 <vprintfmt+0x5c0>
+  802429:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80242d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802431:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802435:	eb e6                	jmp    80241d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802437:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80243a:	83 f8 2f             	cmp    $0x2f,%eax
+  80243d:	77 19                	ja     802458 <vprintfmt+0x6af>
+  80243f:	89 c2                	mov    %eax,%edx
+  802441:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802445:	83 c0 08             	add    $0x8,%eax
+  802448:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80244b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80244e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802453:	e9 11 ff ff ff       	jmp    802369 <vprintfmt+0x5c0>
+  802458:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80245c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802460:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802464:	eb e5                	jmp    80244b <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802466:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80246a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80246e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802472:	e9 59 ff ff ff       	jmp    8023d0 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802477:	4c 89 ee             	mov    %r13,%rsi
+  80247a:	bf 25 00 00 00       	mov    $0x25,%edi
+  80247f:	41 ff d6             	call   *%r14
+            break;
+  802482:	e9 53 f9 ff ff       	jmp    801dda <vprintfmt+0x31>
+            putch('%', put_arg);
+  802487:	4c 89 ee             	mov    %r13,%rsi
+  80248a:	bf 25 00 00 00       	mov    $0x25,%edi
+  80248f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802492:	48 83 eb 01          	sub    $0x1,%rbx
+  802496:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80249a:	75 f6                	jne    802492 <vprintfmt+0x6e9>
+  80249c:	e9 39 f9 ff ff       	jmp    801dda <vprintfmt+0x31>
+}
+  8024a1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8024a5:	5b                   	pop    %rbx
+  8024a6:	41 5c                	pop    %r12
+  8024a8:	41 5d                	pop    %r13
+  8024aa:	41 5e                	pop    %r14
+  8024ac:	41 5f                	pop    %r15
+  8024ae:	5d                   	pop    %rbp
+  8024af:	c3                   	ret
+
+00000000008024b0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8024b0:	55                   	push   %rbp
+  8024b1:	48 89 e5             	mov    %rsp,%rbp
+  8024b4:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8024b8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8024bc:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8024c1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8024c5:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8024cc:	48 85 ff             	test   %rdi,%rdi
+  8024cf:	74 2b                	je     8024fc <vsnprintf+0x4c>
+  8024d1:	48 85 f6             	test   %rsi,%rsi
+  8024d4:	74 26                	je     8024fc <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8024d6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024da:	48 bf 54 1d 80 00 00 	movabs $0x801d54,%rdi
+  8024e1:	00 00 00 
+  8024e4:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  8024eb:	00 00 00 
+  8024ee:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8024f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024f4:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8024f7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8024fa:	c9                   	leave
+  8024fb:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8024fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802501:	eb f7                	jmp    8024fa <vsnprintf+0x4a>
+
+0000000000802503 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802503:	55                   	push   %rbp
+  802504:	48 89 e5             	mov    %rsp,%rbp
+  802507:	48 83 ec 50          	sub    $0x50,%rsp
+  80250b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80250f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802513:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802517:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80251e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802522:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802526:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80252a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80252e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802532:	48 b8 b0 24 80 00 00 	movabs $0x8024b0,%rax
+  802539:	00 00 00 
+  80253c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80253e:	c9                   	leave
+  80253f:	c3                   	ret
+
+0000000000802540 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802540:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802543:	74 10                	je     802555 <strlen+0x15>
+    size_t n = 0;
+  802545:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80254a:	48 83 c0 01          	add    $0x1,%rax
+  80254e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802552:	75 f6                	jne    80254a <strlen+0xa>
+  802554:	c3                   	ret
+    size_t n = 0;
+  802555:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80255a:	c3                   	ret
+
+000000000080255b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80255b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80255e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802563:	48 85 f6             	test   %rsi,%rsi
+  802566:	74 11                	je     802579 <strnlen+0x1e>
+  802568:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80256c:	74 0c                	je     80257a <strnlen+0x1f>
+  80256e:	48 83 c2 01          	add    $0x1,%rdx
+  802572:	48 39 d0             	cmp    %rdx,%rax
+  802575:	75 f1                	jne    802568 <strnlen+0xd>
+  802577:	eb 04                	jmp    80257d <strnlen+0x22>
+  802579:	c3                   	ret
+  80257a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80257d:	c3                   	ret
+
+000000000080257e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80257e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802581:	ba 00 00 00 00       	mov    $0x0,%edx
+  802586:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80258a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80258d:	48 83 c2 01          	add    $0x1,%rdx
+  802591:	84 c9                	test   %cl,%cl
+  802593:	75 f1                	jne    802586 <strcpy+0x8>
+        ;
+    return res;
+}
+  802595:	c3                   	ret
+
+0000000000802596 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802596:	55                   	push   %rbp
+  802597:	48 89 e5             	mov    %rsp,%rbp
+  80259a:	41 54                	push   %r12
+  80259c:	53                   	push   %rbx
+  80259d:	48 89 fb             	mov    %rdi,%rbx
+  8025a0:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8025a3:	48 b8 40 25 80 00 00 	movabs $0x802540,%rax
+  8025aa:	00 00 00 
+  8025ad:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8025af:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8025b3:	4c 89 e6             	mov    %r12,%rsi
+  8025b6:	48 b8 7e 25 80 00 00 	movabs $0x80257e,%rax
+  8025bd:	00 00 00 
+  8025c0:	ff d0                	call   *%rax
+    return dst;
+}
+  8025c2:	48 89 d8             	mov    %rbx,%rax
+  8025c5:	5b                   	pop    %rbx
+  8025c6:	41 5c                	pop    %r12
+  8025c8:	5d                   	pop    %rbp
+  8025c9:	c3                   	ret
+
+00000000008025ca <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8025ca:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8025cd:	48 85 d2             	test   %rdx,%rdx
+  8025d0:	74 1f                	je     8025f1 <strncpy+0x27>
+  8025d2:	48 01 fa             	add    %rdi,%rdx
+  8025d5:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8025d8:	48 83 c1 01          	add    $0x1,%rcx
+  8025dc:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8025e0:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8025e4:	41 80 f8 01          	cmp    $0x1,%r8b
+  8025e8:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8025ec:	48 39 ca             	cmp    %rcx,%rdx
+  8025ef:	75 e7                	jne    8025d8 <strncpy+0xe>
+    }
+    return ret;
+}
+  8025f1:	c3                   	ret
+
+00000000008025f2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8025f2:	48 89 f8             	mov    %rdi,%rax
+  8025f5:	48 85 d2             	test   %rdx,%rdx
+  8025f8:	74 24                	je     80261e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8025fa:	48 83 ea 01          	sub    $0x1,%rdx
+  8025fe:	74 1b                	je     80261b <strlcpy+0x29>
+  802600:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802604:	0f b6 16             	movzbl (%rsi),%edx
+  802607:	84 d2                	test   %dl,%dl
+  802609:	74 10                	je     80261b <strlcpy+0x29>
+            *dst++ = *src++;
+  80260b:	48 83 c6 01          	add    $0x1,%rsi
+  80260f:	48 83 c0 01          	add    $0x1,%rax
+  802613:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802616:	48 39 c8             	cmp    %rcx,%rax
+  802619:	75 e9                	jne    802604 <strlcpy+0x12>
+        *dst = '\0';
+  80261b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80261e:	48 29 f8             	sub    %rdi,%rax
+}
+  802621:	c3                   	ret
+
+0000000000802622 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802622:	0f b6 07             	movzbl (%rdi),%eax
+  802625:	84 c0                	test   %al,%al
+  802627:	74 13                	je     80263c <strcmp+0x1a>
+  802629:	38 06                	cmp    %al,(%rsi)
+  80262b:	75 0f                	jne    80263c <strcmp+0x1a>
+  80262d:	48 83 c7 01          	add    $0x1,%rdi
+  802631:	48 83 c6 01          	add    $0x1,%rsi
+  802635:	0f b6 07             	movzbl (%rdi),%eax
+  802638:	84 c0                	test   %al,%al
+  80263a:	75 ed                	jne    802629 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80263c:	0f b6 c0             	movzbl %al,%eax
+  80263f:	0f b6 16             	movzbl (%rsi),%edx
+  802642:	29 d0                	sub    %edx,%eax
+}
+  802644:	c3                   	ret
+
+0000000000802645 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802645:	48 85 d2             	test   %rdx,%rdx
+  802648:	74 1f                	je     802669 <strncmp+0x24>
+  80264a:	0f b6 07             	movzbl (%rdi),%eax
+  80264d:	84 c0                	test   %al,%al
+  80264f:	74 1e                	je     80266f <strncmp+0x2a>
+  802651:	3a 06                	cmp    (%rsi),%al
+  802653:	75 1a                	jne    80266f <strncmp+0x2a>
+  802655:	48 83 c7 01          	add    $0x1,%rdi
+  802659:	48 83 c6 01          	add    $0x1,%rsi
+  80265d:	48 83 ea 01          	sub    $0x1,%rdx
+  802661:	75 e7                	jne    80264a <strncmp+0x5>
+
+    if (!n) return 0;
+  802663:	b8 00 00 00 00       	mov    $0x0,%eax
+  802668:	c3                   	ret
+  802669:	b8 00 00 00 00       	mov    $0x0,%eax
+  80266e:	c3                   	ret
+  80266f:	48 85 d2             	test   %rdx,%rdx
+  802672:	74 09                	je     80267d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802674:	0f b6 07             	movzbl (%rdi),%eax
+  802677:	0f b6 16             	movzbl (%rsi),%edx
+  80267a:	29 d0                	sub    %edx,%eax
+  80267c:	c3                   	ret
+    if (!n) return 0;
+  80267d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802682:	c3                   	ret
+
+0000000000802683 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802683:	0f b6 17             	movzbl (%rdi),%edx
+  802686:	84 d2                	test   %dl,%dl
+  802688:	74 18                	je     8026a2 <strchr+0x1f>
+        if (*str == c) {
+  80268a:	0f be d2             	movsbl %dl,%edx
+  80268d:	39 f2                	cmp    %esi,%edx
+  80268f:	74 17                	je     8026a8 <strchr+0x25>
+    for (; *str; str++) {
+  802691:	48 83 c7 01          	add    $0x1,%rdi
+  802695:	0f b6 17             	movzbl (%rdi),%edx
+  802698:	84 d2                	test   %dl,%dl
+  80269a:	75 ee                	jne    80268a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80269c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a1:	c3                   	ret
+  8026a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a7:	c3                   	ret
+  8026a8:	48 89 f8             	mov    %rdi,%rax
+}
+  8026ab:	c3                   	ret
+
+00000000008026ac <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8026ac:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8026af:	0f b6 17             	movzbl (%rdi),%edx
+  8026b2:	84 d2                	test   %dl,%dl
+  8026b4:	74 13                	je     8026c9 <strfind+0x1d>
+  8026b6:	0f be d2             	movsbl %dl,%edx
+  8026b9:	39 f2                	cmp    %esi,%edx
+  8026bb:	74 0b                	je     8026c8 <strfind+0x1c>
+  8026bd:	48 83 c0 01          	add    $0x1,%rax
+  8026c1:	0f b6 10             	movzbl (%rax),%edx
+  8026c4:	84 d2                	test   %dl,%dl
+  8026c6:	75 ee                	jne    8026b6 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8026c8:	c3                   	ret
+  8026c9:	c3                   	ret
+
+00000000008026ca <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8026ca:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8026cd:	48 89 f8             	mov    %rdi,%rax
+  8026d0:	48 f7 d8             	neg    %rax
+  8026d3:	83 e0 07             	and    $0x7,%eax
+  8026d6:	49 89 d1             	mov    %rdx,%r9
+  8026d9:	49 29 c1             	sub    %rax,%r9
+  8026dc:	78 36                	js     802714 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8026de:	40 0f b6 c6          	movzbl %sil,%eax
+  8026e2:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8026e9:	01 01 01 
+  8026ec:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8026f0:	40 f6 c7 07          	test   $0x7,%dil
+  8026f4:	75 38                	jne    80272e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8026f6:	4c 89 c9             	mov    %r9,%rcx
+  8026f9:	48 c1 f9 03          	sar    $0x3,%rcx
+  8026fd:	74 0c                	je     80270b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8026ff:	fc                   	cld
+  802700:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802703:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802707:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80270b:	4d 85 c9             	test   %r9,%r9
+  80270e:	75 45                	jne    802755 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802710:	4c 89 c0             	mov    %r8,%rax
+  802713:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802714:	48 85 d2             	test   %rdx,%rdx
+  802717:	74 f7                	je     802710 <memset+0x46>
+  802719:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80271c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80271f:	48 83 c0 01          	add    $0x1,%rax
+  802723:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802727:	48 39 c2             	cmp    %rax,%rdx
+  80272a:	75 f3                	jne    80271f <memset+0x55>
+  80272c:	eb e2                	jmp    802710 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80272e:	40 f6 c7 01          	test   $0x1,%dil
+  802732:	74 06                	je     80273a <memset+0x70>
+  802734:	88 07                	mov    %al,(%rdi)
+  802736:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80273a:	40 f6 c7 02          	test   $0x2,%dil
+  80273e:	74 07                	je     802747 <memset+0x7d>
+  802740:	66 89 07             	mov    %ax,(%rdi)
+  802743:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802747:	40 f6 c7 04          	test   $0x4,%dil
+  80274b:	74 a9                	je     8026f6 <memset+0x2c>
+  80274d:	89 07                	mov    %eax,(%rdi)
+  80274f:	48 83 c7 04          	add    $0x4,%rdi
+  802753:	eb a1                	jmp    8026f6 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802755:	41 f6 c1 04          	test   $0x4,%r9b
+  802759:	74 06                	je     802761 <memset+0x97>
+  80275b:	89 07                	mov    %eax,(%rdi)
+  80275d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802761:	41 f6 c1 02          	test   $0x2,%r9b
+  802765:	74 07                	je     80276e <memset+0xa4>
+  802767:	66 89 07             	mov    %ax,(%rdi)
+  80276a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80276e:	41 f6 c1 01          	test   $0x1,%r9b
+  802772:	74 9c                	je     802710 <memset+0x46>
+  802774:	88 07                	mov    %al,(%rdi)
+  802776:	eb 98                	jmp    802710 <memset+0x46>
+
+0000000000802778 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802778:	48 89 f8             	mov    %rdi,%rax
+  80277b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80277e:	48 39 fe             	cmp    %rdi,%rsi
+  802781:	73 3b                	jae    8027be <memmove+0x46>
+  802783:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802787:	48 39 d7             	cmp    %rdx,%rdi
+  80278a:	73 32                	jae    8027be <memmove+0x46>
+        s += n;
+        d += n;
+  80278c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802790:	48 89 d6             	mov    %rdx,%rsi
+  802793:	48 09 fe             	or     %rdi,%rsi
+  802796:	48 09 ce             	or     %rcx,%rsi
+  802799:	40 f6 c6 07          	test   $0x7,%sil
+  80279d:	75 12                	jne    8027b1 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80279f:	48 83 ef 08          	sub    $0x8,%rdi
+  8027a3:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8027a7:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027ab:	fd                   	std
+  8027ac:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8027af:	fc                   	cld
+  8027b0:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8027b1:	48 83 ef 01          	sub    $0x1,%rdi
+  8027b5:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8027b9:	fd                   	std
+  8027ba:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8027bc:	eb f1                	jmp    8027af <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8027be:	48 89 f2             	mov    %rsi,%rdx
+  8027c1:	48 09 c2             	or     %rax,%rdx
+  8027c4:	48 09 ca             	or     %rcx,%rdx
+  8027c7:	f6 c2 07             	test   $0x7,%dl
+  8027ca:	75 0c                	jne    8027d8 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8027cc:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027d0:	48 89 c7             	mov    %rax,%rdi
+  8027d3:	fc                   	cld
+  8027d4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8027d7:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8027d8:	48 89 c7             	mov    %rax,%rdi
+  8027db:	fc                   	cld
+  8027dc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8027de:	c3                   	ret
+
+00000000008027df <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8027df:	55                   	push   %rbp
+  8027e0:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8027e3:	48 b8 78 27 80 00 00 	movabs $0x802778,%rax
+  8027ea:	00 00 00 
+  8027ed:	ff d0                	call   *%rax
+}
+  8027ef:	5d                   	pop    %rbp
+  8027f0:	c3                   	ret
+
+00000000008027f1 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8027f1:	55                   	push   %rbp
+  8027f2:	48 89 e5             	mov    %rsp,%rbp
+  8027f5:	41 57                	push   %r15
+  8027f7:	41 56                	push   %r14
+  8027f9:	41 55                	push   %r13
+  8027fb:	41 54                	push   %r12
+  8027fd:	53                   	push   %rbx
+  8027fe:	48 83 ec 08          	sub    $0x8,%rsp
+  802802:	49 89 fe             	mov    %rdi,%r14
+  802805:	49 89 f7             	mov    %rsi,%r15
+  802808:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80280b:	48 89 f7             	mov    %rsi,%rdi
+  80280e:	48 b8 40 25 80 00 00 	movabs $0x802540,%rax
+  802815:	00 00 00 
+  802818:	ff d0                	call   *%rax
+  80281a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80281d:	48 89 de             	mov    %rbx,%rsi
+  802820:	4c 89 f7             	mov    %r14,%rdi
+  802823:	48 b8 5b 25 80 00 00 	movabs $0x80255b,%rax
+  80282a:	00 00 00 
+  80282d:	ff d0                	call   *%rax
+  80282f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802832:	48 39 c3             	cmp    %rax,%rbx
+  802835:	74 36                	je     80286d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802837:	48 89 d8             	mov    %rbx,%rax
+  80283a:	4c 29 e8             	sub    %r13,%rax
+  80283d:	49 39 c4             	cmp    %rax,%r12
+  802840:	73 31                	jae    802873 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802842:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802847:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80284b:	4c 89 fe             	mov    %r15,%rsi
+  80284e:	48 b8 df 27 80 00 00 	movabs $0x8027df,%rax
+  802855:	00 00 00 
+  802858:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80285a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80285e:	48 83 c4 08          	add    $0x8,%rsp
+  802862:	5b                   	pop    %rbx
+  802863:	41 5c                	pop    %r12
+  802865:	41 5d                	pop    %r13
+  802867:	41 5e                	pop    %r14
+  802869:	41 5f                	pop    %r15
+  80286b:	5d                   	pop    %rbp
+  80286c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80286d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802871:	eb eb                	jmp    80285e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802873:	48 83 eb 01          	sub    $0x1,%rbx
+  802877:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80287b:	48 89 da             	mov    %rbx,%rdx
+  80287e:	4c 89 fe             	mov    %r15,%rsi
+  802881:	48 b8 df 27 80 00 00 	movabs $0x8027df,%rax
+  802888:	00 00 00 
+  80288b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80288d:	49 01 de             	add    %rbx,%r14
+  802890:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802895:	eb c3                	jmp    80285a <strlcat+0x69>
+
+0000000000802897 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802897:	48 85 d2             	test   %rdx,%rdx
+  80289a:	74 2d                	je     8028c9 <memcmp+0x32>
+  80289c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8028a1:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8028a5:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8028aa:	44 38 c1             	cmp    %r8b,%cl
+  8028ad:	75 0f                	jne    8028be <memcmp+0x27>
+    while (n-- > 0) {
+  8028af:	48 83 c0 01          	add    $0x1,%rax
+  8028b3:	48 39 c2             	cmp    %rax,%rdx
+  8028b6:	75 e9                	jne    8028a1 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8028b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bd:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8028be:	0f b6 c1             	movzbl %cl,%eax
+  8028c1:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8028c5:	44 29 c0             	sub    %r8d,%eax
+  8028c8:	c3                   	ret
+    return 0;
+  8028c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028ce:	c3                   	ret
+
+00000000008028cf <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8028cf:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8028d3:	48 39 c7             	cmp    %rax,%rdi
+  8028d6:	73 0f                	jae    8028e7 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8028d8:	40 38 37             	cmp    %sil,(%rdi)
+  8028db:	74 0e                	je     8028eb <memfind+0x1c>
+    for (; src < end; src++) {
+  8028dd:	48 83 c7 01          	add    $0x1,%rdi
+  8028e1:	48 39 f8             	cmp    %rdi,%rax
+  8028e4:	75 f2                	jne    8028d8 <memfind+0x9>
+  8028e6:	c3                   	ret
+  8028e7:	48 89 f8             	mov    %rdi,%rax
+  8028ea:	c3                   	ret
+  8028eb:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8028ee:	c3                   	ret
+
+00000000008028ef <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8028ef:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8028f2:	0f b6 37             	movzbl (%rdi),%esi
+  8028f5:	40 80 fe 20          	cmp    $0x20,%sil
+  8028f9:	74 06                	je     802901 <strtol+0x12>
+  8028fb:	40 80 fe 09          	cmp    $0x9,%sil
+  8028ff:	75 13                	jne    802914 <strtol+0x25>
+  802901:	48 83 c7 01          	add    $0x1,%rdi
+  802905:	0f b6 37             	movzbl (%rdi),%esi
+  802908:	40 80 fe 20          	cmp    $0x20,%sil
+  80290c:	74 f3                	je     802901 <strtol+0x12>
+  80290e:	40 80 fe 09          	cmp    $0x9,%sil
+  802912:	74 ed                	je     802901 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802914:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802917:	83 e0 fd             	and    $0xfffffffd,%eax
+  80291a:	3c 01                	cmp    $0x1,%al
+  80291c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802920:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802926:	75 0f                	jne    802937 <strtol+0x48>
+  802928:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80292b:	74 14                	je     802941 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80292d:	85 d2                	test   %edx,%edx
+  80292f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802934:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802937:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80293c:	4c 63 ca             	movslq %edx,%r9
+  80293f:	eb 36                	jmp    802977 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802941:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802945:	74 0f                	je     802956 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802947:	85 d2                	test   %edx,%edx
+  802949:	75 ec                	jne    802937 <strtol+0x48>
+        s++;
+  80294b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80294f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802954:	eb e1                	jmp    802937 <strtol+0x48>
+        s += 2;
+  802956:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80295a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80295f:	eb d6                	jmp    802937 <strtol+0x48>
+            dig -= '0';
+  802961:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802964:	44 0f b6 c1          	movzbl %cl,%r8d
+  802968:	41 39 d0             	cmp    %edx,%r8d
+  80296b:	7d 21                	jge    80298e <strtol+0x9f>
+        val = val * base + dig;
+  80296d:	49 0f af c1          	imul   %r9,%rax
+  802971:	0f b6 c9             	movzbl %cl,%ecx
+  802974:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802977:	48 83 c7 01          	add    $0x1,%rdi
+  80297b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80297f:	80 f9 39             	cmp    $0x39,%cl
+  802982:	76 dd                	jbe    802961 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802984:	80 f9 7b             	cmp    $0x7b,%cl
+  802987:	77 05                	ja     80298e <strtol+0x9f>
+            dig -= 'a' - 10;
+  802989:	83 e9 57             	sub    $0x57,%ecx
+  80298c:	eb d6                	jmp    802964 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80298e:	4d 85 d2             	test   %r10,%r10
+  802991:	74 03                	je     802996 <strtol+0xa7>
+  802993:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802996:	48 89 c2             	mov    %rax,%rdx
+  802999:	48 f7 da             	neg    %rdx
+  80299c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8029a0:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8029a4:	c3                   	ret
+
+00000000008029a5 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8029a5:	55                   	push   %rbp
+  8029a6:	48 89 e5             	mov    %rsp,%rbp
+  8029a9:	41 54                	push   %r12
+  8029ab:	53                   	push   %rbx
+  8029ac:	48 89 fb             	mov    %rdi,%rbx
+  8029af:	48 89 f7             	mov    %rsi,%rdi
+  8029b2:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8029b5:	48 85 f6             	test   %rsi,%rsi
+  8029b8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029bf:	00 00 00 
+  8029c2:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8029c6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029cb:	48 b8 fe 05 80 00 00 	movabs $0x8005fe,%rax
+  8029d2:	00 00 00 
+  8029d5:	ff d0                	call   *%rax
+    if (res < 0) {
+  8029d7:	85 c0                	test   %eax,%eax
+  8029d9:	78 45                	js     802a20 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8029db:	48 85 db             	test   %rbx,%rbx
+  8029de:	74 12                	je     8029f2 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8029e0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029e7:	00 00 00 
+  8029ea:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8029f0:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  8029f2:	4d 85 e4             	test   %r12,%r12
+  8029f5:	74 14                	je     802a0b <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  8029f7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029fe:	00 00 00 
+  802a01:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802a07:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802a0b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a12:	00 00 00 
+  802a15:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802a1b:	5b                   	pop    %rbx
+  802a1c:	41 5c                	pop    %r12
+  802a1e:	5d                   	pop    %rbp
+  802a1f:	c3                   	ret
+        if (from_env_store)
+  802a20:	48 85 db             	test   %rbx,%rbx
+  802a23:	74 06                	je     802a2b <ipc_recv+0x86>
+            *from_env_store = 0;
+  802a25:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802a2b:	4d 85 e4             	test   %r12,%r12
+  802a2e:	74 eb                	je     802a1b <ipc_recv+0x76>
+            *perm_store = 0;
+  802a30:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802a37:	00 
+  802a38:	eb e1                	jmp    802a1b <ipc_recv+0x76>
+
+0000000000802a3a <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802a3a:	55                   	push   %rbp
+  802a3b:	48 89 e5             	mov    %rsp,%rbp
+  802a3e:	41 57                	push   %r15
+  802a40:	41 56                	push   %r14
+  802a42:	41 55                	push   %r13
+  802a44:	41 54                	push   %r12
+  802a46:	53                   	push   %rbx
+  802a47:	48 83 ec 18          	sub    $0x18,%rsp
+  802a4b:	41 89 fd             	mov    %edi,%r13d
+  802a4e:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802a51:	48 89 d3             	mov    %rdx,%rbx
+  802a54:	49 89 cc             	mov    %rcx,%r12
+  802a57:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a5b:	48 85 d2             	test   %rdx,%rdx
+  802a5e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a65:	00 00 00 
+  802a68:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a6c:	49 be d2 05 80 00 00 	movabs $0x8005d2,%r14
+  802a73:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802a76:	49 bf 05 02 80 00 00 	movabs $0x800205,%r15
+  802a7d:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a80:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802a83:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802a87:	4c 89 e1             	mov    %r12,%rcx
+  802a8a:	48 89 da             	mov    %rbx,%rdx
+  802a8d:	44 89 ef             	mov    %r13d,%edi
+  802a90:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802a93:	85 c0                	test   %eax,%eax
+  802a95:	74 34                	je     802acb <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802a97:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802a9a:	75 05                	jne    802aa1 <ipc_send+0x67>
+        sys_yield();
+  802a9c:	41 ff d7             	call   *%r15
+    while (true) {
+  802a9f:	eb df                	jmp    802a80 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802aa1:	48 ba ef 31 80 00 00 	movabs $0x8031ef,%rdx
+  802aa8:	00 00 00 
+  802aab:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802ab0:	48 bf 08 32 80 00 00 	movabs $0x803208,%rdi
+  802ab7:	00 00 00 
+  802aba:	b8 00 00 00 00       	mov    $0x0,%eax
+  802abf:	48 b9 09 1b 80 00 00 	movabs $0x801b09,%rcx
+  802ac6:	00 00 00 
+  802ac9:	ff d1                	call   *%rcx
+    }
+}
+  802acb:	48 83 c4 18          	add    $0x18,%rsp
+  802acf:	5b                   	pop    %rbx
+  802ad0:	41 5c                	pop    %r12
+  802ad2:	41 5d                	pop    %r13
+  802ad4:	41 5e                	pop    %r14
+  802ad6:	41 5f                	pop    %r15
+  802ad8:	5d                   	pop    %rbp
+  802ad9:	c3                   	ret
+
+0000000000802ada <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802ada:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802adf:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802ae6:	00 00 00 
+  802ae9:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802af0:	48 01 ca             	add    %rcx,%rdx
+  802af3:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802af9:	39 fa                	cmp    %edi,%edx
+  802afb:	74 12                	je     802b0f <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802afd:	48 83 c0 01          	add    $0x1,%rax
+  802b01:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b07:	75 e0                	jne    802ae9 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802b09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b0e:	c3                   	ret
+            return envs[i].env_id;
+  802b0f:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802b16:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b1d:	00 00 00 
+  802b20:	48 01 d0             	add    %rdx,%rax
+  802b23:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b29:	c3                   	ret
+  802b2a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802b30 <__rodata_start>:
+  802b30:	3c 75                	cmp    $0x75,%al
+  802b32:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b33:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b37:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b38:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802b3c:	1f                   	(bad)
+  802b3d:	44 00 00             	add    %r8b,(%rax)
+  802b40:	73 79                	jae    802bbb <__rodata_start+0x8b>
+  802b42:	73 63                	jae    802ba7 <__rodata_start+0x77>
+  802b44:	61                   	(bad)
+  802b45:	6c                   	insb   (%dx),%es:(%rdi)
+  802b46:	6c                   	insb   (%dx),%es:(%rdi)
+  802b47:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a08fc7 <__bss_end+0x72200fc7>
+  802b4d:	65 74 75             	gs je  802bc5 <__rodata_start+0x95>
+  802b50:	72 6e                	jb     802bc0 <__rodata_start+0x90>
+  802b52:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a08fd4 <__bss_end+0x28200fd4>
+  802b59:	28 
+  802b5a:	3e 20 30             	ds and %dh,(%rax)
+  802b5d:	29 00                	sub    %eax,(%rax)
+  802b5f:	6c                   	insb   (%dx),%es:(%rdi)
+  802b60:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802b67:	61                   	(bad)
+  802b68:	6c                   	insb   (%dx),%es:(%rdi)
+  802b69:	6c                   	insb   (%dx),%es:(%rdi)
+  802b6a:	2e 63 00             	cs movsxd (%rax),%eax
+  802b6d:	0f 1f 00             	nopl   (%rax)
+  802b70:	5b                   	pop    %rbx
+  802b71:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b76:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802b79:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b7d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b7e:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802b82:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802b89:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 8035f4 <error_string+0x4d4>
+  802b90:	5b                   	pop    %rbx
+  802b91:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b96:	20 66 74             	and    %ah,0x74(%rsi)
+  802b99:	72 75                	jb     802c10 <devtab+0x10>
+  802b9b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b9c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802b9f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4c0a <__bss_end+0x2d2ccc0a>
+  802ba6:	20 62 61             	and    %ah,0x61(%rdx)
+  802ba9:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802bad:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bb1:	5b                   	pop    %rbx
+  802bb2:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802bb7:	20 72 65             	and    %dh,0x65(%rdx)
+  802bba:	61                   	(bad)
+  802bbb:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4c26 <__bss_end+0x2d2ccc26>
+  802bc2:	20 62 61             	and    %ah,0x61(%rdx)
+  802bc5:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802bc9:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bcd:	5b                   	pop    %rbx
+  802bce:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802bd3:	20 77 72             	and    %dh,0x72(%rdi)
+  802bd6:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802bdd:	2d 
+  802bde:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802be3:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802be6:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802bf1:	00 00 00 
+  802bf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802bfb:	00 00 00 
+  802bfe:	66 90                	xchg   %ax,%ax
+
+0000000000802c00 <devtab>:
+  802c00:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802c10:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802c20:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802c30:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802c40:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802c50:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802c60:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802c70:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802c80:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802c90:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802ca0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802cb0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802cc0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802cd0:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802ce0:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802cf0:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802d00:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802d10:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802d20:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802d30:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802d40:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802d50:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802d60:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802d70:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802d80:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802d90:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802da0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802db0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802dc0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802dd0:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802de0:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802df0:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802e00:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802e10:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802e20:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802e30:	64 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     d.operation not 
+  802e40:	70 65 72 6d 69 74 74 65 64 00 66 2e 0f 1f 84 00     permitted.f.....
+  802e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
+  802e60:	46 1e 80 00 00 00 00 00 87 24 80 00 00 00 00 00     F........$......
+  802e70:	77 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     w$.......$......
+  802e80:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  802e90:	87 24 80 00 00 00 00 00 65 1e 80 00 00 00 00 00     .$......e.......
+  802ea0:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  802eb0:	59 1e 80 00 00 00 00 00 d3 1e 80 00 00 00 00 00     Y...............
+  802ec0:	87 24 80 00 00 00 00 00 59 1e 80 00 00 00 00 00     .$......Y.......
+  802ed0:	9f 1e 80 00 00 00 00 00 9f 1e 80 00 00 00 00 00     ................
+  802ee0:	9f 1e 80 00 00 00 00 00 9f 1e 80 00 00 00 00 00     ................
+  802ef0:	9f 1e 80 00 00 00 00 00 9f 1e 80 00 00 00 00 00     ................
+  802f00:	9f 1e 80 00 00 00 00 00 9f 1e 80 00 00 00 00 00     ................
+  802f10:	9f 1e 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .........$......
+  802f20:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  802f30:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  802f40:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  802f50:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  802f60:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  802f70:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  802f80:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  802f90:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  802fa0:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  802fb0:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  802fc0:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  802fd0:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  802fe0:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  802ff0:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  803000:	87 24 80 00 00 00 00 00 aa 23 80 00 00 00 00 00     .$.......#......
+  803010:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  803020:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  803030:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  803040:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  803050:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  803060:	f6 1e 80 00 00 00 00 00 c5 20 80 00 00 00 00 00     ......... ......
+  803070:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  803080:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  803090:	25 1f 80 00 00 00 00 00 87 24 80 00 00 00 00 00     %........$......
+  8030a0:	87 24 80 00 00 00 00 00 eb 1e 80 00 00 00 00 00     .$..............
+  8030b0:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  8030c0:	6d 22 80 00 00 00 00 00 37 23 80 00 00 00 00 00     m"......7#......
+  8030d0:	87 24 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .$.......$......
+  8030e0:	bc 1f 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .........$......
+  8030f0:	99 21 80 00 00 00 00 00 87 24 80 00 00 00 00 00     .!.......$......
+  803100:	87 24 80 00 00 00 00 00 aa 23 80 00 00 00 00 00     .$.......#......
+  803110:	87 24 80 00 00 00 00 00 4f 1e 80 00 00 00 00 00     .$......O.......
+
+0000000000803120 <error_string>:
+	...
+  803128:	d5 2c 80 00 00 00 00 00 e7 2c 80 00 00 00 00 00     .,.......,......
+  803138:	f7 2c 80 00 00 00 00 00 09 2d 80 00 00 00 00 00     .,.......-......
+  803148:	17 2d 80 00 00 00 00 00 2b 2d 80 00 00 00 00 00     .-......+-......
+  803158:	40 2d 80 00 00 00 00 00 53 2d 80 00 00 00 00 00     @-......S-......
+  803168:	65 2d 80 00 00 00 00 00 79 2d 80 00 00 00 00 00     e-......y-......
+  803178:	89 2d 80 00 00 00 00 00 9c 2d 80 00 00 00 00 00     .-.......-......
+  803188:	b3 2d 80 00 00 00 00 00 c9 2d 80 00 00 00 00 00     .-.......-......
+  803198:	e1 2d 80 00 00 00 00 00 f9 2d 80 00 00 00 00 00     .-.......-......
+  8031a8:	06 2e 80 00 00 00 00 00 d0 31 80 00 00 00 00 00     .........1......
+  8031b8:	1a 2e 80 00 00 00 00 00 00 00 00 00 00 00 00 00     ................
+  8031c8:	32 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     2.......file is 
+  8031d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8031e8:	75 74 61 62 6c 65 00 69 70 63 5f 73 65 6e 64 3a     utable.ipc_send:
+  8031f8:	20 66 61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00      failed to send.
+  803208:	6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00     lib/ipc.c.f.....
+  803218:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803228:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803238:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803248:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803258:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803268:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803278:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803288:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803298:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8032b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803308:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803318:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803328:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803338:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803348:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803358:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803368:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803378:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803388:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803398:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803408:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803418:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803428:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803438:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803448:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803458:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803468:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803478:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803488:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803498:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803508:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803518:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803528:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803538:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803548:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803558:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803568:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803578:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803588:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803598:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803608:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803618:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803628:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803638:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803648:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803658:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803668:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803678:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803688:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803698:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803708:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803718:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803728:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803738:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803748:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803758:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803768:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803778:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803788:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803798:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803808:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803818:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803828:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803838:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803848:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803858:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803868:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803878:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803888:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803898:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803908:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803918:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803928:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803938:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803948:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803958:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803968:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803978:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803988:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803998:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803aa8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ab8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ac8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ad8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ae8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803af8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ba8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bc8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bd8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803be8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bf8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ca8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ce8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cf8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803da8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803db8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803dc8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dd8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803de8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803df8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ea8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803eb8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ec8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ed8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ee8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ef8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fa8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fb8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fc8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fd8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fe8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ff8:	00 00 66 0f 1f 44 00 00                             ..f..D..
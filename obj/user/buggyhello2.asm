@@ -0,0 +1,5389 @@
+
+obj/user/buggyhello2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 26 00 00 00       	call   800049 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    sys_cputs(hello, 1024 * 1024);
+  800029:	be 00 00 10 00       	mov    $0x100000,%esi
+  80002e:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800035:	00 00 00 
+  800038:	48 8b 38             	mov    (%rax),%rdi
+  80003b:	48 b8 13 01 80 00 00 	movabs $0x800113,%rax
+  800042:	00 00 00 
+  800045:	ff d0                	call   *%rax
+}
+  800047:	5d                   	pop    %rbp
+  800048:	c3                   	ret
+
+0000000000800049 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800049:	55                   	push   %rbp
+  80004a:	48 89 e5             	mov    %rsp,%rbp
+  80004d:	41 56                	push   %r14
+  80004f:	41 55                	push   %r13
+  800051:	41 54                	push   %r12
+  800053:	53                   	push   %rbx
+  800054:	41 89 fd             	mov    %edi,%r13d
+  800057:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005a:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800061:	00 00 00 
+  800064:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80006b:	00 00 00 
+  80006e:	48 39 c2             	cmp    %rax,%rdx
+  800071:	73 17                	jae    80008a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800073:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800076:	49 89 c4             	mov    %rax,%r12
+  800079:	48 83 c3 08          	add    $0x8,%rbx
+  80007d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800082:	ff 53 f8             	call   *-0x8(%rbx)
+  800085:	4c 39 e3             	cmp    %r12,%rbx
+  800088:	72 ef                	jb     800079 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  80008a:	48 b8 dc 01 80 00 00 	movabs $0x8001dc,%rax
+  800091:	00 00 00 
+  800094:	ff d0                	call   *%rax
+  800096:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800099:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8000a0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000a7:	00 00 00 
+  8000aa:	48 01 d0             	add    %rdx,%rax
+  8000ad:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000b4:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000b7:	45 85 ed             	test   %r13d,%r13d
+  8000ba:	7e 0d                	jle    8000c9 <libmain+0x80>
+  8000bc:	49 8b 06             	mov    (%r14),%rax
+  8000bf:	48 a3 08 40 80 00 00 	movabs %rax,0x804008
+  8000c6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000c9:	4c 89 f6             	mov    %r14,%rsi
+  8000cc:	44 89 ef             	mov    %r13d,%edi
+  8000cf:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000d6:	00 00 00 
+  8000d9:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000db:	48 b8 f0 00 80 00 00 	movabs $0x8000f0,%rax
+  8000e2:	00 00 00 
+  8000e5:	ff d0                	call   *%rax
+#endif
+}
+  8000e7:	5b                   	pop    %rbx
+  8000e8:	41 5c                	pop    %r12
+  8000ea:	41 5d                	pop    %r13
+  8000ec:	41 5e                	pop    %r14
+  8000ee:	5d                   	pop    %rbp
+  8000ef:	c3                   	ret
+
+00000000008000f0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f0:	55                   	push   %rbp
+  8000f1:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000f4:	48 b8 64 0a 80 00 00 	movabs $0x800a64,%rax
+  8000fb:	00 00 00 
+  8000fe:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800100:	bf 00 00 00 00       	mov    $0x0,%edi
+  800105:	48 b8 71 01 80 00 00 	movabs $0x800171,%rax
+  80010c:	00 00 00 
+  80010f:	ff d0                	call   *%rax
+}
+  800111:	5d                   	pop    %rbp
+  800112:	c3                   	ret
+
+0000000000800113 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800113:	55                   	push   %rbp
+  800114:	48 89 e5             	mov    %rsp,%rbp
+  800117:	53                   	push   %rbx
+  800118:	48 89 fa             	mov    %rdi,%rdx
+  80011b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80011e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800123:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800128:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80012d:	be 00 00 00 00       	mov    $0x0,%esi
+  800132:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800138:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80013a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80013e:	c9                   	leave
+  80013f:	c3                   	ret
+
+0000000000800140 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800140:	55                   	push   %rbp
+  800141:	48 89 e5             	mov    %rsp,%rbp
+  800144:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800145:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80014a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800154:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800159:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80015e:	be 00 00 00 00       	mov    $0x0,%esi
+  800163:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800169:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80016b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80016f:	c9                   	leave
+  800170:	c3                   	ret
+
+0000000000800171 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800171:	55                   	push   %rbp
+  800172:	48 89 e5             	mov    %rsp,%rbp
+  800175:	53                   	push   %rbx
+  800176:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80017a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80017d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800182:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800187:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80018c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800191:	be 00 00 00 00       	mov    $0x0,%esi
+  800196:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80019c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80019e:	48 85 c0             	test   %rax,%rax
+  8001a1:	7f 06                	jg     8001a9 <sys_env_destroy+0x38>
+}
+  8001a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001a7:	c9                   	leave
+  8001a8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001a9:	49 89 c0             	mov    %rax,%r8
+  8001ac:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001b1:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  8001b8:	00 00 00 
+  8001bb:	be 26 00 00 00       	mov    $0x26,%esi
+  8001c0:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  8001c7:	00 00 00 
+  8001ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001cf:	49 b9 11 1b 80 00 00 	movabs $0x801b11,%r9
+  8001d6:	00 00 00 
+  8001d9:	41 ff d1             	call   *%r9
+
+00000000008001dc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001dc:	55                   	push   %rbp
+  8001dd:	48 89 e5             	mov    %rsp,%rbp
+  8001e0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001e1:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800205:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800207:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80020b:	c9                   	leave
+  80020c:	c3                   	ret
+
+000000000080020d <sys_yield>:
+
+void
+sys_yield(void) {
+  80020d:	55                   	push   %rbp
+  80020e:	48 89 e5             	mov    %rsp,%rbp
+  800211:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800212:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800217:	ba 00 00 00 00       	mov    $0x0,%edx
+  80021c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800221:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800226:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80022b:	be 00 00 00 00       	mov    $0x0,%esi
+  800230:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800236:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800238:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80023c:	c9                   	leave
+  80023d:	c3                   	ret
+
+000000000080023e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80023e:	55                   	push   %rbp
+  80023f:	48 89 e5             	mov    %rsp,%rbp
+  800242:	53                   	push   %rbx
+  800243:	48 89 fa             	mov    %rdi,%rdx
+  800246:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800249:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80024e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800255:	00 00 00 
+  800258:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80025d:	be 00 00 00 00       	mov    $0x0,%esi
+  800262:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800268:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80026a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80026e:	c9                   	leave
+  80026f:	c3                   	ret
+
+0000000000800270 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800270:	55                   	push   %rbp
+  800271:	48 89 e5             	mov    %rsp,%rbp
+  800274:	53                   	push   %rbx
+  800275:	49 89 f8             	mov    %rdi,%r8
+  800278:	48 89 d3             	mov    %rdx,%rbx
+  80027b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80027e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800283:	4c 89 c2             	mov    %r8,%rdx
+  800286:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800289:	be 00 00 00 00       	mov    $0x0,%esi
+  80028e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800294:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800296:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80029a:	c9                   	leave
+  80029b:	c3                   	ret
+
+000000000080029c <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80029c:	55                   	push   %rbp
+  80029d:	48 89 e5             	mov    %rsp,%rbp
+  8002a0:	53                   	push   %rbx
+  8002a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a5:	89 f8                	mov    %edi,%eax
+  8002a7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002aa:	48 63 f9             	movslq %ecx,%rdi
+  8002ad:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002b0:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002b5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8002bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002c5:	48 85 c0             	test   %rax,%rax
+  8002c8:	7f 06                	jg     8002d0 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002ce:	c9                   	leave
+  8002cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002d0:	49 89 c0             	mov    %rax,%r8
+  8002d3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002d8:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  8002df:	00 00 00 
+  8002e2:	be 26 00 00 00       	mov    $0x26,%esi
+  8002e7:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  8002ee:	00 00 00 
+  8002f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f6:	49 b9 11 1b 80 00 00 	movabs $0x801b11,%r9
+  8002fd:	00 00 00 
+  800300:	41 ff d1             	call   *%r9
+
+0000000000800303 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800303:	55                   	push   %rbp
+  800304:	48 89 e5             	mov    %rsp,%rbp
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	89 f8                	mov    %edi,%eax
+  80030e:	49 89 f2             	mov    %rsi,%r10
+  800311:	48 89 cf             	mov    %rcx,%rdi
+  800314:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800317:	48 63 da             	movslq %edx,%rbx
+  80031a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80031d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800322:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800325:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800328:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80032a:	48 85 c0             	test   %rax,%rax
+  80032d:	7f 06                	jg     800335 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80032f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800333:	c9                   	leave
+  800334:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800335:	49 89 c0             	mov    %rax,%r8
+  800338:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80033d:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  800344:	00 00 00 
+  800347:	be 26 00 00 00       	mov    $0x26,%esi
+  80034c:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  800353:	00 00 00 
+  800356:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035b:	49 b9 11 1b 80 00 00 	movabs $0x801b11,%r9
+  800362:	00 00 00 
+  800365:	41 ff d1             	call   *%r9
+
+0000000000800368 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800368:	55                   	push   %rbp
+  800369:	48 89 e5             	mov    %rsp,%rbp
+  80036c:	53                   	push   %rbx
+  80036d:	48 83 ec 08          	sub    $0x8,%rsp
+  800371:	48 89 f1             	mov    %rsi,%rcx
+  800374:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800377:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80037a:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80037f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800384:	be 00 00 00 00       	mov    $0x0,%esi
+  800389:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80038f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800391:	48 85 c0             	test   %rax,%rax
+  800394:	7f 06                	jg     80039c <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800396:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80039a:	c9                   	leave
+  80039b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80039c:	49 89 c0             	mov    %rax,%r8
+  80039f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003a4:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  8003ab:	00 00 00 
+  8003ae:	be 26 00 00 00       	mov    $0x26,%esi
+  8003b3:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  8003ba:	00 00 00 
+  8003bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c2:	49 b9 11 1b 80 00 00 	movabs $0x801b11,%r9
+  8003c9:	00 00 00 
+  8003cc:	41 ff d1             	call   *%r9
+
+00000000008003cf <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8003cf:	55                   	push   %rbp
+  8003d0:	48 89 e5             	mov    %rsp,%rbp
+  8003d3:	53                   	push   %rbx
+  8003d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8003d8:	89 f8                	mov    %edi,%eax
+  8003da:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8003dd:	48 63 f9             	movslq %ecx,%rdi
+  8003e0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003e3:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003e8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8003f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003f6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003f8:	48 85 c0             	test   %rax,%rax
+  8003fb:	7f 06                	jg     800403 <sys_region_advise+0x34>
+}
+  8003fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800401:	c9                   	leave
+  800402:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800403:	49 89 c0             	mov    %rax,%r8
+  800406:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80040b:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  800412:	00 00 00 
+  800415:	be 26 00 00 00       	mov    $0x26,%esi
+  80041a:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  800421:	00 00 00 
+  800424:	b8 00 00 00 00       	mov    $0x0,%eax
+  800429:	49 b9 11 1b 80 00 00 	movabs $0x801b11,%r9
+  800430:	00 00 00 
+  800433:	41 ff d1             	call   *%r9
+
+0000000000800436 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  800436:	55                   	push   %rbp
+  800437:	48 89 e5             	mov    %rsp,%rbp
+  80043a:	53                   	push   %rbx
+  80043b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80043f:	48 63 ce             	movslq %esi,%rcx
+  800442:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800445:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80044a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80044f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800454:	be 00 00 00 00       	mov    $0x0,%esi
+  800459:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80045f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800461:	48 85 c0             	test   %rax,%rax
+  800464:	7f 06                	jg     80046c <sys_env_set_nice+0x36>
+}
+  800466:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80046a:	c9                   	leave
+  80046b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80046c:	49 89 c0             	mov    %rax,%r8
+  80046f:	b9 15 00 00 00       	mov    $0x15,%ecx
+  800474:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  80047b:	00 00 00 
+  80047e:	be 26 00 00 00       	mov    $0x26,%esi
+  800483:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  80048a:	00 00 00 
+  80048d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800492:	49 b9 11 1b 80 00 00 	movabs $0x801b11,%r9
+  800499:	00 00 00 
+  80049c:	41 ff d1             	call   *%r9
+
+000000000080049f <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80049f:	55                   	push   %rbp
+  8004a0:	48 89 e5             	mov    %rsp,%rbp
+  8004a3:	53                   	push   %rbx
+  8004a4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004a8:	48 63 ce             	movslq %esi,%rcx
+  8004ab:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004ae:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004b8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8004c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004c8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004ca:	48 85 c0             	test   %rax,%rax
+  8004cd:	7f 06                	jg     8004d5 <sys_env_set_status+0x36>
+}
+  8004cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004d3:	c9                   	leave
+  8004d4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004d5:	49 89 c0             	mov    %rax,%r8
+  8004d8:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004dd:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  8004e4:	00 00 00 
+  8004e7:	be 26 00 00 00       	mov    $0x26,%esi
+  8004ec:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  8004f3:	00 00 00 
+  8004f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fb:	49 b9 11 1b 80 00 00 	movabs $0x801b11,%r9
+  800502:	00 00 00 
+  800505:	41 ff d1             	call   *%r9
+
+0000000000800508 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800508:	55                   	push   %rbp
+  800509:	48 89 e5             	mov    %rsp,%rbp
+  80050c:	53                   	push   %rbx
+  80050d:	48 83 ec 08          	sub    $0x8,%rsp
+  800511:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800514:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800517:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80051c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800521:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800526:	be 00 00 00 00       	mov    $0x0,%esi
+  80052b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800531:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800533:	48 85 c0             	test   %rax,%rax
+  800536:	7f 06                	jg     80053e <sys_env_set_trapframe+0x36>
+}
+  800538:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80053c:	c9                   	leave
+  80053d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80053e:	49 89 c0             	mov    %rax,%r8
+  800541:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800546:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  80054d:	00 00 00 
+  800550:	be 26 00 00 00       	mov    $0x26,%esi
+  800555:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  80055c:	00 00 00 
+  80055f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800564:	49 b9 11 1b 80 00 00 	movabs $0x801b11,%r9
+  80056b:	00 00 00 
+  80056e:	41 ff d1             	call   *%r9
+
+0000000000800571 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800571:	55                   	push   %rbp
+  800572:	48 89 e5             	mov    %rsp,%rbp
+  800575:	53                   	push   %rbx
+  800576:	48 83 ec 08          	sub    $0x8,%rsp
+  80057a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80057d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800580:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800585:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80058a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80058f:	be 00 00 00 00       	mov    $0x0,%esi
+  800594:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80059a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80059c:	48 85 c0             	test   %rax,%rax
+  80059f:	7f 06                	jg     8005a7 <sys_env_set_pgfault_upcall+0x36>
+}
+  8005a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005a5:	c9                   	leave
+  8005a6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005a7:	49 89 c0             	mov    %rax,%r8
+  8005aa:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8005af:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  8005b6:	00 00 00 
+  8005b9:	be 26 00 00 00       	mov    $0x26,%esi
+  8005be:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  8005c5:	00 00 00 
+  8005c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005cd:	49 b9 11 1b 80 00 00 	movabs $0x801b11,%r9
+  8005d4:	00 00 00 
+  8005d7:	41 ff d1             	call   *%r9
+
+00000000008005da <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8005da:	55                   	push   %rbp
+  8005db:	48 89 e5             	mov    %rsp,%rbp
+  8005de:	53                   	push   %rbx
+  8005df:	89 f8                	mov    %edi,%eax
+  8005e1:	49 89 f1             	mov    %rsi,%r9
+  8005e4:	48 89 d3             	mov    %rdx,%rbx
+  8005e7:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8005ea:	49 63 f0             	movslq %r8d,%rsi
+  8005ed:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005f0:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005f5:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005fe:	cd 30                	int    $0x30
+}
+  800600:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800604:	c9                   	leave
+  800605:	c3                   	ret
+
+0000000000800606 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800606:	55                   	push   %rbp
+  800607:	48 89 e5             	mov    %rsp,%rbp
+  80060a:	53                   	push   %rbx
+  80060b:	48 83 ec 08          	sub    $0x8,%rsp
+  80060f:	48 89 fa             	mov    %rdi,%rdx
+  800612:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800615:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80061a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80061f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800624:	be 00 00 00 00       	mov    $0x0,%esi
+  800629:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80062f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800631:	48 85 c0             	test   %rax,%rax
+  800634:	7f 06                	jg     80063c <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800636:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80063a:	c9                   	leave
+  80063b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80063c:	49 89 c0             	mov    %rax,%r8
+  80063f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800644:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  80064b:	00 00 00 
+  80064e:	be 26 00 00 00       	mov    $0x26,%esi
+  800653:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  80065a:	00 00 00 
+  80065d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800662:	49 b9 11 1b 80 00 00 	movabs $0x801b11,%r9
+  800669:	00 00 00 
+  80066c:	41 ff d1             	call   *%r9
+
+000000000080066f <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80066f:	55                   	push   %rbp
+  800670:	48 89 e5             	mov    %rsp,%rbp
+  800673:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800674:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800679:	ba 00 00 00 00       	mov    $0x0,%edx
+  80067e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800683:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800688:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80068d:	be 00 00 00 00       	mov    $0x0,%esi
+  800692:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800698:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80069a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80069e:	c9                   	leave
+  80069f:	c3                   	ret
+
+00000000008006a0 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8006a0:	55                   	push   %rbp
+  8006a1:	48 89 e5             	mov    %rsp,%rbp
+  8006a4:	53                   	push   %rbx
+  8006a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8006a9:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8006ac:	48 63 ce             	movslq %esi,%rcx
+  8006af:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006b2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006b7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8006c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006c7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8006c9:	48 85 c0             	test   %rax,%rax
+  8006cc:	7f 06                	jg     8006d4 <sys_sigqueue+0x34>
+}
+  8006ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006d2:	c9                   	leave
+  8006d3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006d4:	49 89 c0             	mov    %rax,%r8
+  8006d7:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8006dc:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  8006e3:	00 00 00 
+  8006e6:	be 26 00 00 00       	mov    $0x26,%esi
+  8006eb:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  8006f2:	00 00 00 
+  8006f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006fa:	49 b9 11 1b 80 00 00 	movabs $0x801b11,%r9
+  800701:	00 00 00 
+  800704:	41 ff d1             	call   *%r9
+
+0000000000800707 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  800707:	55                   	push   %rbp
+  800708:	48 89 e5             	mov    %rsp,%rbp
+  80070b:	53                   	push   %rbx
+  80070c:	48 83 ec 08          	sub    $0x8,%rsp
+  800710:	48 89 fa             	mov    %rdi,%rdx
+  800713:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800716:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80071b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800720:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800725:	be 00 00 00 00       	mov    $0x0,%esi
+  80072a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800730:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800732:	48 85 c0             	test   %rax,%rax
+  800735:	7f 06                	jg     80073d <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  800737:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80073b:	c9                   	leave
+  80073c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80073d:	49 89 c0             	mov    %rax,%r8
+  800740:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800745:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  80074c:	00 00 00 
+  80074f:	be 26 00 00 00       	mov    $0x26,%esi
+  800754:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  80075b:	00 00 00 
+  80075e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800763:	49 b9 11 1b 80 00 00 	movabs $0x801b11,%r9
+  80076a:	00 00 00 
+  80076d:	41 ff d1             	call   *%r9
+
+0000000000800770 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  800770:	55                   	push   %rbp
+  800771:	48 89 e5             	mov    %rsp,%rbp
+  800774:	53                   	push   %rbx
+  800775:	48 83 ec 08          	sub    $0x8,%rsp
+  800779:	48 89 f1             	mov    %rsi,%rcx
+  80077c:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80077f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800782:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800787:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80078c:	be 00 00 00 00       	mov    $0x0,%esi
+  800791:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800797:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800799:	48 85 c0             	test   %rax,%rax
+  80079c:	7f 06                	jg     8007a4 <sys_sigaction+0x34>
+}
+  80079e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007a2:	c9                   	leave
+  8007a3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007a4:	49 89 c0             	mov    %rax,%r8
+  8007a7:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8007ac:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  8007b3:	00 00 00 
+  8007b6:	be 26 00 00 00       	mov    $0x26,%esi
+  8007bb:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  8007c2:	00 00 00 
+  8007c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ca:	49 b9 11 1b 80 00 00 	movabs $0x801b11,%r9
+  8007d1:	00 00 00 
+  8007d4:	41 ff d1             	call   *%r9
+
+00000000008007d7 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8007d7:	55                   	push   %rbp
+  8007d8:	48 89 e5             	mov    %rsp,%rbp
+  8007db:	53                   	push   %rbx
+  8007dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8007e0:	48 89 f1             	mov    %rsi,%rcx
+  8007e3:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8007e6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8007e9:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8007ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8007f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8007fe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800800:	48 85 c0             	test   %rax,%rax
+  800803:	7f 06                	jg     80080b <sys_sigprocmask+0x34>
+}
+  800805:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800809:	c9                   	leave
+  80080a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80080b:	49 89 c0             	mov    %rax,%r8
+  80080e:	b9 13 00 00 00       	mov    $0x13,%ecx
+  800813:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  80081a:	00 00 00 
+  80081d:	be 26 00 00 00       	mov    $0x26,%esi
+  800822:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  800829:	00 00 00 
+  80082c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800831:	49 b9 11 1b 80 00 00 	movabs $0x801b11,%r9
+  800838:	00 00 00 
+  80083b:	41 ff d1             	call   *%r9
+
+000000000080083e <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80083e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800845:	ff ff ff 
+  800848:	48 01 f8             	add    %rdi,%rax
+  80084b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80084f:	c3                   	ret
+
+0000000000800850 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800850:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800857:	ff ff ff 
+  80085a:	48 01 f8             	add    %rdi,%rax
+  80085d:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800861:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800867:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80086b:	c3                   	ret
+
+000000000080086c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80086c:	55                   	push   %rbp
+  80086d:	48 89 e5             	mov    %rsp,%rbp
+  800870:	41 57                	push   %r15
+  800872:	41 56                	push   %r14
+  800874:	41 55                	push   %r13
+  800876:	41 54                	push   %r12
+  800878:	53                   	push   %rbx
+  800879:	48 83 ec 08          	sub    $0x8,%rsp
+  80087d:	49 89 ff             	mov    %rdi,%r15
+  800880:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800885:	49 bd ea 17 80 00 00 	movabs $0x8017ea,%r13
+  80088c:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80088f:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800895:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800898:	48 89 df             	mov    %rbx,%rdi
+  80089b:	41 ff d5             	call   *%r13
+  80089e:	83 e0 04             	and    $0x4,%eax
+  8008a1:	74 17                	je     8008ba <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8008a3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8008aa:	4c 39 f3             	cmp    %r14,%rbx
+  8008ad:	75 e6                	jne    800895 <fd_alloc+0x29>
+  8008af:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8008b5:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8008ba:	4d 89 27             	mov    %r12,(%r15)
+}
+  8008bd:	48 83 c4 08          	add    $0x8,%rsp
+  8008c1:	5b                   	pop    %rbx
+  8008c2:	41 5c                	pop    %r12
+  8008c4:	41 5d                	pop    %r13
+  8008c6:	41 5e                	pop    %r14
+  8008c8:	41 5f                	pop    %r15
+  8008ca:	5d                   	pop    %rbp
+  8008cb:	c3                   	ret
+
+00000000008008cc <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8008cc:	83 ff 1f             	cmp    $0x1f,%edi
+  8008cf:	77 39                	ja     80090a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8008d1:	55                   	push   %rbp
+  8008d2:	48 89 e5             	mov    %rsp,%rbp
+  8008d5:	41 54                	push   %r12
+  8008d7:	53                   	push   %rbx
+  8008d8:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8008db:	48 63 df             	movslq %edi,%rbx
+  8008de:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8008e5:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8008e9:	48 89 df             	mov    %rbx,%rdi
+  8008ec:	48 b8 ea 17 80 00 00 	movabs $0x8017ea,%rax
+  8008f3:	00 00 00 
+  8008f6:	ff d0                	call   *%rax
+  8008f8:	a8 04                	test   $0x4,%al
+  8008fa:	74 14                	je     800910 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8008fc:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800900:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800905:	5b                   	pop    %rbx
+  800906:	41 5c                	pop    %r12
+  800908:	5d                   	pop    %rbp
+  800909:	c3                   	ret
+        return -E_INVAL;
+  80090a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80090f:	c3                   	ret
+        return -E_INVAL;
+  800910:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800915:	eb ee                	jmp    800905 <fd_lookup+0x39>
+
+0000000000800917 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800917:	55                   	push   %rbp
+  800918:	48 89 e5             	mov    %rsp,%rbp
+  80091b:	41 54                	push   %r12
+  80091d:	53                   	push   %rbx
+  80091e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800921:	48 b8 00 2c 80 00 00 	movabs $0x802c00,%rax
+  800928:	00 00 00 
+  80092b:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  800932:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800935:	39 3b                	cmp    %edi,(%rbx)
+  800937:	74 47                	je     800980 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800939:	48 83 c0 08          	add    $0x8,%rax
+  80093d:	48 8b 18             	mov    (%rax),%rbx
+  800940:	48 85 db             	test   %rbx,%rbx
+  800943:	75 f0                	jne    800935 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800945:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80094c:	00 00 00 
+  80094f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800955:	89 fa                	mov    %edi,%edx
+  800957:	48 bf 80 2b 80 00 00 	movabs $0x802b80,%rdi
+  80095e:	00 00 00 
+  800961:	b8 00 00 00 00       	mov    $0x0,%eax
+  800966:	48 b9 61 1c 80 00 00 	movabs $0x801c61,%rcx
+  80096d:	00 00 00 
+  800970:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800972:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800977:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80097b:	5b                   	pop    %rbx
+  80097c:	41 5c                	pop    %r12
+  80097e:	5d                   	pop    %rbp
+  80097f:	c3                   	ret
+            return 0;
+  800980:	b8 00 00 00 00       	mov    $0x0,%eax
+  800985:	eb f0                	jmp    800977 <dev_lookup+0x60>
+
+0000000000800987 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800987:	55                   	push   %rbp
+  800988:	48 89 e5             	mov    %rsp,%rbp
+  80098b:	41 55                	push   %r13
+  80098d:	41 54                	push   %r12
+  80098f:	53                   	push   %rbx
+  800990:	48 83 ec 18          	sub    $0x18,%rsp
+  800994:	48 89 fb             	mov    %rdi,%rbx
+  800997:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80099a:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8009a1:	ff ff ff 
+  8009a4:	48 01 df             	add    %rbx,%rdi
+  8009a7:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8009ab:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009af:	48 b8 cc 08 80 00 00 	movabs $0x8008cc,%rax
+  8009b6:	00 00 00 
+  8009b9:	ff d0                	call   *%rax
+  8009bb:	41 89 c5             	mov    %eax,%r13d
+  8009be:	85 c0                	test   %eax,%eax
+  8009c0:	78 06                	js     8009c8 <fd_close+0x41>
+  8009c2:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8009c6:	74 1a                	je     8009e2 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8009c8:	45 84 e4             	test   %r12b,%r12b
+  8009cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d0:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8009d4:	44 89 e8             	mov    %r13d,%eax
+  8009d7:	48 83 c4 18          	add    $0x18,%rsp
+  8009db:	5b                   	pop    %rbx
+  8009dc:	41 5c                	pop    %r12
+  8009de:	41 5d                	pop    %r13
+  8009e0:	5d                   	pop    %rbp
+  8009e1:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8009e2:	8b 3b                	mov    (%rbx),%edi
+  8009e4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8009e8:	48 b8 17 09 80 00 00 	movabs $0x800917,%rax
+  8009ef:	00 00 00 
+  8009f2:	ff d0                	call   *%rax
+  8009f4:	41 89 c5             	mov    %eax,%r13d
+  8009f7:	85 c0                	test   %eax,%eax
+  8009f9:	78 1b                	js     800a16 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8009fb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8009ff:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800a03:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800a09:	48 85 c0             	test   %rax,%rax
+  800a0c:	74 08                	je     800a16 <fd_close+0x8f>
+  800a0e:	48 89 df             	mov    %rbx,%rdi
+  800a11:	ff d0                	call   *%rax
+  800a13:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800a16:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a1b:	48 89 de             	mov    %rbx,%rsi
+  800a1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a23:	48 b8 68 03 80 00 00 	movabs $0x800368,%rax
+  800a2a:	00 00 00 
+  800a2d:	ff d0                	call   *%rax
+    return res;
+  800a2f:	eb a3                	jmp    8009d4 <fd_close+0x4d>
+
+0000000000800a31 <close>:
+
+int
+close(int fdnum) {
+  800a31:	55                   	push   %rbp
+  800a32:	48 89 e5             	mov    %rsp,%rbp
+  800a35:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800a39:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800a3d:	48 b8 cc 08 80 00 00 	movabs $0x8008cc,%rax
+  800a44:	00 00 00 
+  800a47:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800a49:	85 c0                	test   %eax,%eax
+  800a4b:	78 15                	js     800a62 <close+0x31>
+
+    return fd_close(fd, 1);
+  800a4d:	be 01 00 00 00       	mov    $0x1,%esi
+  800a52:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800a56:	48 b8 87 09 80 00 00 	movabs $0x800987,%rax
+  800a5d:	00 00 00 
+  800a60:	ff d0                	call   *%rax
+}
+  800a62:	c9                   	leave
+  800a63:	c3                   	ret
+
+0000000000800a64 <close_all>:
+
+void
+close_all(void) {
+  800a64:	55                   	push   %rbp
+  800a65:	48 89 e5             	mov    %rsp,%rbp
+  800a68:	41 54                	push   %r12
+  800a6a:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800a6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a70:	49 bc 31 0a 80 00 00 	movabs $0x800a31,%r12
+  800a77:	00 00 00 
+  800a7a:	89 df                	mov    %ebx,%edi
+  800a7c:	41 ff d4             	call   *%r12
+  800a7f:	83 c3 01             	add    $0x1,%ebx
+  800a82:	83 fb 20             	cmp    $0x20,%ebx
+  800a85:	75 f3                	jne    800a7a <close_all+0x16>
+}
+  800a87:	5b                   	pop    %rbx
+  800a88:	41 5c                	pop    %r12
+  800a8a:	5d                   	pop    %rbp
+  800a8b:	c3                   	ret
+
+0000000000800a8c <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800a8c:	55                   	push   %rbp
+  800a8d:	48 89 e5             	mov    %rsp,%rbp
+  800a90:	41 57                	push   %r15
+  800a92:	41 56                	push   %r14
+  800a94:	41 55                	push   %r13
+  800a96:	41 54                	push   %r12
+  800a98:	53                   	push   %rbx
+  800a99:	48 83 ec 18          	sub    $0x18,%rsp
+  800a9d:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800aa0:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800aa4:	48 b8 cc 08 80 00 00 	movabs $0x8008cc,%rax
+  800aab:	00 00 00 
+  800aae:	ff d0                	call   *%rax
+  800ab0:	89 c3                	mov    %eax,%ebx
+  800ab2:	85 c0                	test   %eax,%eax
+  800ab4:	0f 88 b8 00 00 00    	js     800b72 <dup+0xe6>
+    close(newfdnum);
+  800aba:	44 89 e7             	mov    %r12d,%edi
+  800abd:	48 b8 31 0a 80 00 00 	movabs $0x800a31,%rax
+  800ac4:	00 00 00 
+  800ac7:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800ac9:	4d 63 ec             	movslq %r12d,%r13
+  800acc:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800ad3:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800ad7:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800adb:	4c 89 ff             	mov    %r15,%rdi
+  800ade:	49 be 50 08 80 00 00 	movabs $0x800850,%r14
+  800ae5:	00 00 00 
+  800ae8:	41 ff d6             	call   *%r14
+  800aeb:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800aee:	4c 89 ef             	mov    %r13,%rdi
+  800af1:	41 ff d6             	call   *%r14
+  800af4:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800af7:	48 89 df             	mov    %rbx,%rdi
+  800afa:	48 b8 ea 17 80 00 00 	movabs $0x8017ea,%rax
+  800b01:	00 00 00 
+  800b04:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800b06:	a8 04                	test   $0x4,%al
+  800b08:	74 2b                	je     800b35 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800b0a:	41 89 c1             	mov    %eax,%r9d
+  800b0d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800b13:	4c 89 f1             	mov    %r14,%rcx
+  800b16:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b1b:	48 89 de             	mov    %rbx,%rsi
+  800b1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b23:	48 b8 03 03 80 00 00 	movabs $0x800303,%rax
+  800b2a:	00 00 00 
+  800b2d:	ff d0                	call   *%rax
+  800b2f:	89 c3                	mov    %eax,%ebx
+  800b31:	85 c0                	test   %eax,%eax
+  800b33:	78 4e                	js     800b83 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800b35:	4c 89 ff             	mov    %r15,%rdi
+  800b38:	48 b8 ea 17 80 00 00 	movabs $0x8017ea,%rax
+  800b3f:	00 00 00 
+  800b42:	ff d0                	call   *%rax
+  800b44:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800b47:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800b4d:	4c 89 e9             	mov    %r13,%rcx
+  800b50:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b55:	4c 89 fe             	mov    %r15,%rsi
+  800b58:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b5d:	48 b8 03 03 80 00 00 	movabs $0x800303,%rax
+  800b64:	00 00 00 
+  800b67:	ff d0                	call   *%rax
+  800b69:	89 c3                	mov    %eax,%ebx
+  800b6b:	85 c0                	test   %eax,%eax
+  800b6d:	78 14                	js     800b83 <dup+0xf7>
+
+    return newfdnum;
+  800b6f:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800b72:	89 d8                	mov    %ebx,%eax
+  800b74:	48 83 c4 18          	add    $0x18,%rsp
+  800b78:	5b                   	pop    %rbx
+  800b79:	41 5c                	pop    %r12
+  800b7b:	41 5d                	pop    %r13
+  800b7d:	41 5e                	pop    %r14
+  800b7f:	41 5f                	pop    %r15
+  800b81:	5d                   	pop    %rbp
+  800b82:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800b83:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b88:	4c 89 ee             	mov    %r13,%rsi
+  800b8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b90:	49 bc 68 03 80 00 00 	movabs $0x800368,%r12
+  800b97:	00 00 00 
+  800b9a:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800b9d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ba2:	4c 89 f6             	mov    %r14,%rsi
+  800ba5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800baa:	41 ff d4             	call   *%r12
+    return res;
+  800bad:	eb c3                	jmp    800b72 <dup+0xe6>
+
+0000000000800baf <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800baf:	55                   	push   %rbp
+  800bb0:	48 89 e5             	mov    %rsp,%rbp
+  800bb3:	41 56                	push   %r14
+  800bb5:	41 55                	push   %r13
+  800bb7:	41 54                	push   %r12
+  800bb9:	53                   	push   %rbx
+  800bba:	48 83 ec 10          	sub    $0x10,%rsp
+  800bbe:	89 fb                	mov    %edi,%ebx
+  800bc0:	49 89 f4             	mov    %rsi,%r12
+  800bc3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bc6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bca:	48 b8 cc 08 80 00 00 	movabs $0x8008cc,%rax
+  800bd1:	00 00 00 
+  800bd4:	ff d0                	call   *%rax
+  800bd6:	85 c0                	test   %eax,%eax
+  800bd8:	78 4c                	js     800c26 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bda:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bde:	41 8b 3e             	mov    (%r14),%edi
+  800be1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800be5:	48 b8 17 09 80 00 00 	movabs $0x800917,%rax
+  800bec:	00 00 00 
+  800bef:	ff d0                	call   *%rax
+  800bf1:	85 c0                	test   %eax,%eax
+  800bf3:	78 35                	js     800c2a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800bf5:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800bf9:	83 e0 03             	and    $0x3,%eax
+  800bfc:	83 f8 01             	cmp    $0x1,%eax
+  800bff:	74 2d                	je     800c2e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800c01:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c05:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800c09:	48 85 c0             	test   %rax,%rax
+  800c0c:	74 56                	je     800c64 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800c0e:	4c 89 ea             	mov    %r13,%rdx
+  800c11:	4c 89 e6             	mov    %r12,%rsi
+  800c14:	4c 89 f7             	mov    %r14,%rdi
+  800c17:	ff d0                	call   *%rax
+}
+  800c19:	48 83 c4 10          	add    $0x10,%rsp
+  800c1d:	5b                   	pop    %rbx
+  800c1e:	41 5c                	pop    %r12
+  800c20:	41 5d                	pop    %r13
+  800c22:	41 5e                	pop    %r14
+  800c24:	5d                   	pop    %rbp
+  800c25:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c26:	48 98                	cltq
+  800c28:	eb ef                	jmp    800c19 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c2a:	48 98                	cltq
+  800c2c:	eb eb                	jmp    800c19 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c2e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c35:	00 00 00 
+  800c38:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c3e:	89 da                	mov    %ebx,%edx
+  800c40:	48 bf c1 2b 80 00 00 	movabs $0x802bc1,%rdi
+  800c47:	00 00 00 
+  800c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4f:	48 b9 61 1c 80 00 00 	movabs $0x801c61,%rcx
+  800c56:	00 00 00 
+  800c59:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c5b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c62:	eb b5                	jmp    800c19 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800c64:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c6b:	eb ac                	jmp    800c19 <read+0x6a>
+
+0000000000800c6d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800c6d:	55                   	push   %rbp
+  800c6e:	48 89 e5             	mov    %rsp,%rbp
+  800c71:	41 57                	push   %r15
+  800c73:	41 56                	push   %r14
+  800c75:	41 55                	push   %r13
+  800c77:	41 54                	push   %r12
+  800c79:	53                   	push   %rbx
+  800c7a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800c7e:	48 85 d2             	test   %rdx,%rdx
+  800c81:	74 54                	je     800cd7 <readn+0x6a>
+  800c83:	41 89 fd             	mov    %edi,%r13d
+  800c86:	49 89 f6             	mov    %rsi,%r14
+  800c89:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800c8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800c91:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800c96:	49 bf af 0b 80 00 00 	movabs $0x800baf,%r15
+  800c9d:	00 00 00 
+  800ca0:	4c 89 e2             	mov    %r12,%rdx
+  800ca3:	48 29 f2             	sub    %rsi,%rdx
+  800ca6:	4c 01 f6             	add    %r14,%rsi
+  800ca9:	44 89 ef             	mov    %r13d,%edi
+  800cac:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800caf:	85 c0                	test   %eax,%eax
+  800cb1:	78 20                	js     800cd3 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800cb3:	01 c3                	add    %eax,%ebx
+  800cb5:	85 c0                	test   %eax,%eax
+  800cb7:	74 08                	je     800cc1 <readn+0x54>
+  800cb9:	48 63 f3             	movslq %ebx,%rsi
+  800cbc:	4c 39 e6             	cmp    %r12,%rsi
+  800cbf:	72 df                	jb     800ca0 <readn+0x33>
+    }
+    return res;
+  800cc1:	48 63 c3             	movslq %ebx,%rax
+}
+  800cc4:	48 83 c4 08          	add    $0x8,%rsp
+  800cc8:	5b                   	pop    %rbx
+  800cc9:	41 5c                	pop    %r12
+  800ccb:	41 5d                	pop    %r13
+  800ccd:	41 5e                	pop    %r14
+  800ccf:	41 5f                	pop    %r15
+  800cd1:	5d                   	pop    %rbp
+  800cd2:	c3                   	ret
+        if (inc < 0) return inc;
+  800cd3:	48 98                	cltq
+  800cd5:	eb ed                	jmp    800cc4 <readn+0x57>
+    int inc = 1, res = 0;
+  800cd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cdc:	eb e3                	jmp    800cc1 <readn+0x54>
+
+0000000000800cde <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800cde:	55                   	push   %rbp
+  800cdf:	48 89 e5             	mov    %rsp,%rbp
+  800ce2:	41 56                	push   %r14
+  800ce4:	41 55                	push   %r13
+  800ce6:	41 54                	push   %r12
+  800ce8:	53                   	push   %rbx
+  800ce9:	48 83 ec 10          	sub    $0x10,%rsp
+  800ced:	89 fb                	mov    %edi,%ebx
+  800cef:	49 89 f4             	mov    %rsi,%r12
+  800cf2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cf5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cf9:	48 b8 cc 08 80 00 00 	movabs $0x8008cc,%rax
+  800d00:	00 00 00 
+  800d03:	ff d0                	call   *%rax
+  800d05:	85 c0                	test   %eax,%eax
+  800d07:	78 47                	js     800d50 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d09:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800d0d:	41 8b 3e             	mov    (%r14),%edi
+  800d10:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800d14:	48 b8 17 09 80 00 00 	movabs $0x800917,%rax
+  800d1b:	00 00 00 
+  800d1e:	ff d0                	call   *%rax
+  800d20:	85 c0                	test   %eax,%eax
+  800d22:	78 30                	js     800d54 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d24:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800d29:	74 2d                	je     800d58 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d2b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d2f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800d33:	48 85 c0             	test   %rax,%rax
+  800d36:	74 56                	je     800d8e <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800d38:	4c 89 ea             	mov    %r13,%rdx
+  800d3b:	4c 89 e6             	mov    %r12,%rsi
+  800d3e:	4c 89 f7             	mov    %r14,%rdi
+  800d41:	ff d0                	call   *%rax
+}
+  800d43:	48 83 c4 10          	add    $0x10,%rsp
+  800d47:	5b                   	pop    %rbx
+  800d48:	41 5c                	pop    %r12
+  800d4a:	41 5d                	pop    %r13
+  800d4c:	41 5e                	pop    %r14
+  800d4e:	5d                   	pop    %rbp
+  800d4f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d50:	48 98                	cltq
+  800d52:	eb ef                	jmp    800d43 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d54:	48 98                	cltq
+  800d56:	eb eb                	jmp    800d43 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800d58:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d5f:	00 00 00 
+  800d62:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800d68:	89 da                	mov    %ebx,%edx
+  800d6a:	48 bf dd 2b 80 00 00 	movabs $0x802bdd,%rdi
+  800d71:	00 00 00 
+  800d74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d79:	48 b9 61 1c 80 00 00 	movabs $0x801c61,%rcx
+  800d80:	00 00 00 
+  800d83:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d85:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800d8c:	eb b5                	jmp    800d43 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d8e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800d95:	eb ac                	jmp    800d43 <write+0x65>
+
+0000000000800d97 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800d97:	55                   	push   %rbp
+  800d98:	48 89 e5             	mov    %rsp,%rbp
+  800d9b:	53                   	push   %rbx
+  800d9c:	48 83 ec 18          	sub    $0x18,%rsp
+  800da0:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800da2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800da6:	48 b8 cc 08 80 00 00 	movabs $0x8008cc,%rax
+  800dad:	00 00 00 
+  800db0:	ff d0                	call   *%rax
+  800db2:	85 c0                	test   %eax,%eax
+  800db4:	78 0c                	js     800dc2 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800db6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dba:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800dbd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dc2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800dc6:	c9                   	leave
+  800dc7:	c3                   	ret
+
+0000000000800dc8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800dc8:	55                   	push   %rbp
+  800dc9:	48 89 e5             	mov    %rsp,%rbp
+  800dcc:	41 55                	push   %r13
+  800dce:	41 54                	push   %r12
+  800dd0:	53                   	push   %rbx
+  800dd1:	48 83 ec 18          	sub    $0x18,%rsp
+  800dd5:	89 fb                	mov    %edi,%ebx
+  800dd7:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800dda:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800dde:	48 b8 cc 08 80 00 00 	movabs $0x8008cc,%rax
+  800de5:	00 00 00 
+  800de8:	ff d0                	call   *%rax
+  800dea:	85 c0                	test   %eax,%eax
+  800dec:	78 38                	js     800e26 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800dee:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800df2:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800df6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800dfa:	48 b8 17 09 80 00 00 	movabs $0x800917,%rax
+  800e01:	00 00 00 
+  800e04:	ff d0                	call   *%rax
+  800e06:	85 c0                	test   %eax,%eax
+  800e08:	78 1c                	js     800e26 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800e0a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800e0f:	74 20                	je     800e31 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800e11:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e15:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800e19:	48 85 c0             	test   %rax,%rax
+  800e1c:	74 47                	je     800e65 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800e1e:	44 89 e6             	mov    %r12d,%esi
+  800e21:	4c 89 ef             	mov    %r13,%rdi
+  800e24:	ff d0                	call   *%rax
+}
+  800e26:	48 83 c4 18          	add    $0x18,%rsp
+  800e2a:	5b                   	pop    %rbx
+  800e2b:	41 5c                	pop    %r12
+  800e2d:	41 5d                	pop    %r13
+  800e2f:	5d                   	pop    %rbp
+  800e30:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800e31:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800e38:	00 00 00 
+  800e3b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800e41:	89 da                	mov    %ebx,%edx
+  800e43:	48 bf a0 2b 80 00 00 	movabs $0x802ba0,%rdi
+  800e4a:	00 00 00 
+  800e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e52:	48 b9 61 1c 80 00 00 	movabs $0x801c61,%rcx
+  800e59:	00 00 00 
+  800e5c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e5e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e63:	eb c1                	jmp    800e26 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800e65:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e6a:	eb ba                	jmp    800e26 <ftruncate+0x5e>
+
+0000000000800e6c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800e6c:	55                   	push   %rbp
+  800e6d:	48 89 e5             	mov    %rsp,%rbp
+  800e70:	41 54                	push   %r12
+  800e72:	53                   	push   %rbx
+  800e73:	48 83 ec 10          	sub    $0x10,%rsp
+  800e77:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e7a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e7e:	48 b8 cc 08 80 00 00 	movabs $0x8008cc,%rax
+  800e85:	00 00 00 
+  800e88:	ff d0                	call   *%rax
+  800e8a:	85 c0                	test   %eax,%eax
+  800e8c:	78 4e                	js     800edc <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e8e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800e92:	41 8b 3c 24          	mov    (%r12),%edi
+  800e96:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800e9a:	48 b8 17 09 80 00 00 	movabs $0x800917,%rax
+  800ea1:	00 00 00 
+  800ea4:	ff d0                	call   *%rax
+  800ea6:	85 c0                	test   %eax,%eax
+  800ea8:	78 32                	js     800edc <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800eaa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800eae:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800eb3:	74 30                	je     800ee5 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800eb5:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800eb8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800ebf:	00 00 00 
+    stat->st_isdir = 0;
+  800ec2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800ec9:	00 00 00 
+    stat->st_dev = dev;
+  800ecc:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800ed3:	48 89 de             	mov    %rbx,%rsi
+  800ed6:	4c 89 e7             	mov    %r12,%rdi
+  800ed9:	ff 50 28             	call   *0x28(%rax)
+}
+  800edc:	48 83 c4 10          	add    $0x10,%rsp
+  800ee0:	5b                   	pop    %rbx
+  800ee1:	41 5c                	pop    %r12
+  800ee3:	5d                   	pop    %rbp
+  800ee4:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800ee5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800eea:	eb f0                	jmp    800edc <fstat+0x70>
+
+0000000000800eec <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800eec:	55                   	push   %rbp
+  800eed:	48 89 e5             	mov    %rsp,%rbp
+  800ef0:	41 54                	push   %r12
+  800ef2:	53                   	push   %rbx
+  800ef3:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800ef6:	be 00 00 00 00       	mov    $0x0,%esi
+  800efb:	48 b8 6d 11 80 00 00 	movabs $0x80116d,%rax
+  800f02:	00 00 00 
+  800f05:	ff d0                	call   *%rax
+  800f07:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800f09:	85 c0                	test   %eax,%eax
+  800f0b:	78 25                	js     800f32 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800f0d:	4c 89 e6             	mov    %r12,%rsi
+  800f10:	89 c7                	mov    %eax,%edi
+  800f12:	48 b8 6c 0e 80 00 00 	movabs $0x800e6c,%rax
+  800f19:	00 00 00 
+  800f1c:	ff d0                	call   *%rax
+  800f1e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800f21:	89 df                	mov    %ebx,%edi
+  800f23:	48 b8 31 0a 80 00 00 	movabs $0x800a31,%rax
+  800f2a:	00 00 00 
+  800f2d:	ff d0                	call   *%rax
+
+    return res;
+  800f2f:	44 89 e3             	mov    %r12d,%ebx
+}
+  800f32:	89 d8                	mov    %ebx,%eax
+  800f34:	5b                   	pop    %rbx
+  800f35:	41 5c                	pop    %r12
+  800f37:	5d                   	pop    %rbp
+  800f38:	c3                   	ret
+
+0000000000800f39 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800f39:	55                   	push   %rbp
+  800f3a:	48 89 e5             	mov    %rsp,%rbp
+  800f3d:	41 54                	push   %r12
+  800f3f:	53                   	push   %rbx
+  800f40:	48 83 ec 10          	sub    $0x10,%rsp
+  800f44:	41 89 fc             	mov    %edi,%r12d
+  800f47:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f4a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f51:	00 00 00 
+  800f54:	83 38 00             	cmpl   $0x0,(%rax)
+  800f57:	74 5e                	je     800fb7 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800f59:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800f5f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800f64:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800f6b:	00 00 00 
+  800f6e:	44 89 e6             	mov    %r12d,%esi
+  800f71:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f78:	00 00 00 
+  800f7b:	8b 38                	mov    (%rax),%edi
+  800f7d:	48 b8 42 2a 80 00 00 	movabs $0x802a42,%rax
+  800f84:	00 00 00 
+  800f87:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800f89:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800f90:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800f91:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f96:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800f9a:	48 89 de             	mov    %rbx,%rsi
+  800f9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fa2:	48 b8 ad 29 80 00 00 	movabs $0x8029ad,%rax
+  800fa9:	00 00 00 
+  800fac:	ff d0                	call   *%rax
+}
+  800fae:	48 83 c4 10          	add    $0x10,%rsp
+  800fb2:	5b                   	pop    %rbx
+  800fb3:	41 5c                	pop    %r12
+  800fb5:	5d                   	pop    %rbp
+  800fb6:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800fb7:	bf 03 00 00 00       	mov    $0x3,%edi
+  800fbc:	48 b8 e2 2a 80 00 00 	movabs $0x802ae2,%rax
+  800fc3:	00 00 00 
+  800fc6:	ff d0                	call   *%rax
+  800fc8:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800fcf:	00 00 
+  800fd1:	eb 86                	jmp    800f59 <fsipc+0x20>
+
+0000000000800fd3 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800fd3:	55                   	push   %rbp
+  800fd4:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800fd7:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800fde:	00 00 00 
+  800fe1:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800fe4:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800fe6:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800fe9:	be 00 00 00 00       	mov    $0x0,%esi
+  800fee:	bf 02 00 00 00       	mov    $0x2,%edi
+  800ff3:	48 b8 39 0f 80 00 00 	movabs $0x800f39,%rax
+  800ffa:	00 00 00 
+  800ffd:	ff d0                	call   *%rax
+}
+  800fff:	5d                   	pop    %rbp
+  801000:	c3                   	ret
+
+0000000000801001 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801001:	55                   	push   %rbp
+  801002:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801005:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801008:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80100f:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801011:	be 00 00 00 00       	mov    $0x0,%esi
+  801016:	bf 06 00 00 00       	mov    $0x6,%edi
+  80101b:	48 b8 39 0f 80 00 00 	movabs $0x800f39,%rax
+  801022:	00 00 00 
+  801025:	ff d0                	call   *%rax
+}
+  801027:	5d                   	pop    %rbp
+  801028:	c3                   	ret
+
+0000000000801029 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801029:	55                   	push   %rbp
+  80102a:	48 89 e5             	mov    %rsp,%rbp
+  80102d:	41 54                	push   %r12
+  80102f:	53                   	push   %rbx
+  801030:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801033:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801036:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80103d:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80103f:	be 00 00 00 00       	mov    $0x0,%esi
+  801044:	bf 05 00 00 00       	mov    $0x5,%edi
+  801049:	48 b8 39 0f 80 00 00 	movabs $0x800f39,%rax
+  801050:	00 00 00 
+  801053:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801055:	85 c0                	test   %eax,%eax
+  801057:	78 3d                	js     801096 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801059:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801060:	00 00 00 
+  801063:	4c 89 e6             	mov    %r12,%rsi
+  801066:	48 89 df             	mov    %rbx,%rdi
+  801069:	48 b8 86 25 80 00 00 	movabs $0x802586,%rax
+  801070:	00 00 00 
+  801073:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801075:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80107c:	00 
+  80107d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801083:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80108a:	00 
+  80108b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801091:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801096:	5b                   	pop    %rbx
+  801097:	41 5c                	pop    %r12
+  801099:	5d                   	pop    %rbp
+  80109a:	c3                   	ret
+
+000000000080109b <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80109b:	55                   	push   %rbp
+  80109c:	48 89 e5             	mov    %rsp,%rbp
+  80109f:	41 54                	push   %r12
+  8010a1:	53                   	push   %rbx
+  8010a2:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8010a5:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8010aa:	48 39 c2             	cmp    %rax,%rdx
+  8010ad:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8010b1:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8010b4:	48 89 c2             	mov    %rax,%rdx
+  8010b7:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8010be:	00 00 00 
+  8010c1:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  8010c8:	00 00 00 
+  8010cb:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8010cd:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8010d4:	00 00 00 
+  8010d7:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8010dc:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8010de:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8010e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e7:	bf 04 00 00 00       	mov    $0x4,%edi
+  8010ec:	48 b8 39 0f 80 00 00 	movabs $0x800f39,%rax
+  8010f3:	00 00 00 
+  8010f6:	ff d0                	call   *%rax
+  8010f8:	48 98                	cltq
+}
+  8010fa:	5b                   	pop    %rbx
+  8010fb:	41 5c                	pop    %r12
+  8010fd:	5d                   	pop    %rbp
+  8010fe:	c3                   	ret
+
+00000000008010ff <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8010ff:	55                   	push   %rbp
+  801100:	48 89 e5             	mov    %rsp,%rbp
+  801103:	41 54                	push   %r12
+  801105:	53                   	push   %rbx
+  801106:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801109:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801110:	00 00 00 
+  801113:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801116:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  801118:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80111d:	48 39 ca             	cmp    %rcx,%rdx
+  801120:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  801124:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  801128:	be 00 00 00 00       	mov    $0x0,%esi
+  80112d:	bf 03 00 00 00       	mov    $0x3,%edi
+  801132:	48 b8 39 0f 80 00 00 	movabs $0x800f39,%rax
+  801139:	00 00 00 
+  80113c:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  80113e:	85 c0                	test   %eax,%eax
+  801140:	78 27                	js     801169 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  801142:	48 63 d8             	movslq %eax,%rbx
+  801145:	48 89 da             	mov    %rbx,%rdx
+  801148:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80114f:	00 00 00 
+  801152:	4c 89 e7             	mov    %r12,%rdi
+  801155:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  80115c:	00 00 00 
+  80115f:	ff d0                	call   *%rax
+    return bytes_read;
+  801161:	48 89 d8             	mov    %rbx,%rax
+}
+  801164:	5b                   	pop    %rbx
+  801165:	41 5c                	pop    %r12
+  801167:	5d                   	pop    %rbp
+  801168:	c3                   	ret
+        return bytes_read;
+  801169:	48 98                	cltq
+  80116b:	eb f7                	jmp    801164 <devfile_read+0x65>
+
+000000000080116d <open>:
+open(const char *path, int mode) {
+  80116d:	55                   	push   %rbp
+  80116e:	48 89 e5             	mov    %rsp,%rbp
+  801171:	41 55                	push   %r13
+  801173:	41 54                	push   %r12
+  801175:	53                   	push   %rbx
+  801176:	48 83 ec 18          	sub    $0x18,%rsp
+  80117a:	49 89 fc             	mov    %rdi,%r12
+  80117d:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801180:	48 b8 48 25 80 00 00 	movabs $0x802548,%rax
+  801187:	00 00 00 
+  80118a:	ff d0                	call   *%rax
+  80118c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801192:	0f 87 8a 00 00 00    	ja     801222 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801198:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80119c:	48 b8 6c 08 80 00 00 	movabs $0x80086c,%rax
+  8011a3:	00 00 00 
+  8011a6:	ff d0                	call   *%rax
+  8011a8:	89 c3                	mov    %eax,%ebx
+  8011aa:	85 c0                	test   %eax,%eax
+  8011ac:	78 50                	js     8011fe <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8011ae:	4c 89 e6             	mov    %r12,%rsi
+  8011b1:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8011b8:	00 00 00 
+  8011bb:	48 89 df             	mov    %rbx,%rdi
+  8011be:	48 b8 86 25 80 00 00 	movabs $0x802586,%rax
+  8011c5:	00 00 00 
+  8011c8:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011ca:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011d1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8011d5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011da:	48 b8 39 0f 80 00 00 	movabs $0x800f39,%rax
+  8011e1:	00 00 00 
+  8011e4:	ff d0                	call   *%rax
+  8011e6:	89 c3                	mov    %eax,%ebx
+  8011e8:	85 c0                	test   %eax,%eax
+  8011ea:	78 1f                	js     80120b <open+0x9e>
+    return fd2num(fd);
+  8011ec:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8011f0:	48 b8 3e 08 80 00 00 	movabs $0x80083e,%rax
+  8011f7:	00 00 00 
+  8011fa:	ff d0                	call   *%rax
+  8011fc:	89 c3                	mov    %eax,%ebx
+}
+  8011fe:	89 d8                	mov    %ebx,%eax
+  801200:	48 83 c4 18          	add    $0x18,%rsp
+  801204:	5b                   	pop    %rbx
+  801205:	41 5c                	pop    %r12
+  801207:	41 5d                	pop    %r13
+  801209:	5d                   	pop    %rbp
+  80120a:	c3                   	ret
+        fd_close(fd, 0);
+  80120b:	be 00 00 00 00       	mov    $0x0,%esi
+  801210:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801214:	48 b8 87 09 80 00 00 	movabs $0x800987,%rax
+  80121b:	00 00 00 
+  80121e:	ff d0                	call   *%rax
+        return res;
+  801220:	eb dc                	jmp    8011fe <open+0x91>
+        return -E_BAD_PATH;
+  801222:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801227:	eb d5                	jmp    8011fe <open+0x91>
+
+0000000000801229 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801229:	55                   	push   %rbp
+  80122a:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80122d:	be 00 00 00 00       	mov    $0x0,%esi
+  801232:	bf 08 00 00 00       	mov    $0x8,%edi
+  801237:	48 b8 39 0f 80 00 00 	movabs $0x800f39,%rax
+  80123e:	00 00 00 
+  801241:	ff d0                	call   *%rax
+}
+  801243:	5d                   	pop    %rbp
+  801244:	c3                   	ret
+
+0000000000801245 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801245:	55                   	push   %rbp
+  801246:	48 89 e5             	mov    %rsp,%rbp
+  801249:	41 54                	push   %r12
+  80124b:	53                   	push   %rbx
+  80124c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80124f:	48 b8 50 08 80 00 00 	movabs $0x800850,%rax
+  801256:	00 00 00 
+  801259:	ff d0                	call   *%rax
+  80125b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80125e:	48 be 20 2c 80 00 00 	movabs $0x802c20,%rsi
+  801265:	00 00 00 
+  801268:	48 89 df             	mov    %rbx,%rdi
+  80126b:	48 b8 86 25 80 00 00 	movabs $0x802586,%rax
+  801272:	00 00 00 
+  801275:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801277:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80127c:	41 2b 04 24          	sub    (%r12),%eax
+  801280:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801286:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80128d:	00 00 00 
+    stat->st_dev = &devpipe;
+  801290:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  801297:	00 00 00 
+  80129a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8012a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a6:	5b                   	pop    %rbx
+  8012a7:	41 5c                	pop    %r12
+  8012a9:	5d                   	pop    %rbp
+  8012aa:	c3                   	ret
+
+00000000008012ab <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8012ab:	55                   	push   %rbp
+  8012ac:	48 89 e5             	mov    %rsp,%rbp
+  8012af:	41 54                	push   %r12
+  8012b1:	53                   	push   %rbx
+  8012b2:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8012b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012ba:	48 89 fe             	mov    %rdi,%rsi
+  8012bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012c2:	49 bc 68 03 80 00 00 	movabs $0x800368,%r12
+  8012c9:	00 00 00 
+  8012cc:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012cf:	48 89 df             	mov    %rbx,%rdi
+  8012d2:	48 b8 50 08 80 00 00 	movabs $0x800850,%rax
+  8012d9:	00 00 00 
+  8012dc:	ff d0                	call   *%rax
+  8012de:	48 89 c6             	mov    %rax,%rsi
+  8012e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012eb:	41 ff d4             	call   *%r12
+}
+  8012ee:	5b                   	pop    %rbx
+  8012ef:	41 5c                	pop    %r12
+  8012f1:	5d                   	pop    %rbp
+  8012f2:	c3                   	ret
+
+00000000008012f3 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8012f3:	55                   	push   %rbp
+  8012f4:	48 89 e5             	mov    %rsp,%rbp
+  8012f7:	41 57                	push   %r15
+  8012f9:	41 56                	push   %r14
+  8012fb:	41 55                	push   %r13
+  8012fd:	41 54                	push   %r12
+  8012ff:	53                   	push   %rbx
+  801300:	48 83 ec 18          	sub    $0x18,%rsp
+  801304:	49 89 fc             	mov    %rdi,%r12
+  801307:	49 89 f5             	mov    %rsi,%r13
+  80130a:	49 89 d7             	mov    %rdx,%r15
+  80130d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801311:	48 b8 50 08 80 00 00 	movabs $0x800850,%rax
+  801318:	00 00 00 
+  80131b:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80131d:	4d 85 ff             	test   %r15,%r15
+  801320:	0f 84 af 00 00 00    	je     8013d5 <devpipe_write+0xe2>
+  801326:	48 89 c3             	mov    %rax,%rbx
+  801329:	4c 89 f8             	mov    %r15,%rax
+  80132c:	4d 89 ef             	mov    %r13,%r15
+  80132f:	4c 01 e8             	add    %r13,%rax
+  801332:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801336:	49 bd 70 02 80 00 00 	movabs $0x800270,%r13
+  80133d:	00 00 00 
+            sys_yield();
+  801340:	49 be 0d 02 80 00 00 	movabs $0x80020d,%r14
+  801347:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80134a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80134d:	48 63 ce             	movslq %esi,%rcx
+  801350:	48 63 03             	movslq (%rbx),%rax
+  801353:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801359:	48 39 c1             	cmp    %rax,%rcx
+  80135c:	72 2e                	jb     80138c <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80135e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801363:	48 89 da             	mov    %rbx,%rdx
+  801366:	be 00 10 00 00       	mov    $0x1000,%esi
+  80136b:	4c 89 e7             	mov    %r12,%rdi
+  80136e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801371:	85 c0                	test   %eax,%eax
+  801373:	74 66                	je     8013db <devpipe_write+0xe8>
+            sys_yield();
+  801375:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801378:	8b 73 04             	mov    0x4(%rbx),%esi
+  80137b:	48 63 ce             	movslq %esi,%rcx
+  80137e:	48 63 03             	movslq (%rbx),%rax
+  801381:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801387:	48 39 c1             	cmp    %rax,%rcx
+  80138a:	73 d2                	jae    80135e <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80138c:	41 0f b6 3f          	movzbl (%r15),%edi
+  801390:	48 89 ca             	mov    %rcx,%rdx
+  801393:	48 c1 ea 03          	shr    $0x3,%rdx
+  801397:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80139e:	08 10 20 
+  8013a1:	48 f7 e2             	mul    %rdx
+  8013a4:	48 c1 ea 06          	shr    $0x6,%rdx
+  8013a8:	48 89 d0             	mov    %rdx,%rax
+  8013ab:	48 c1 e0 09          	shl    $0x9,%rax
+  8013af:	48 29 d0             	sub    %rdx,%rax
+  8013b2:	48 c1 e0 03          	shl    $0x3,%rax
+  8013b6:	48 29 c1             	sub    %rax,%rcx
+  8013b9:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013be:	83 c6 01             	add    $0x1,%esi
+  8013c1:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013c4:	49 83 c7 01          	add    $0x1,%r15
+  8013c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013cc:	49 39 c7             	cmp    %rax,%r15
+  8013cf:	0f 85 75 ff ff ff    	jne    80134a <devpipe_write+0x57>
+    return n;
+  8013d5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8013d9:	eb 05                	jmp    8013e0 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8013db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013e0:	48 83 c4 18          	add    $0x18,%rsp
+  8013e4:	5b                   	pop    %rbx
+  8013e5:	41 5c                	pop    %r12
+  8013e7:	41 5d                	pop    %r13
+  8013e9:	41 5e                	pop    %r14
+  8013eb:	41 5f                	pop    %r15
+  8013ed:	5d                   	pop    %rbp
+  8013ee:	c3                   	ret
+
+00000000008013ef <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8013ef:	55                   	push   %rbp
+  8013f0:	48 89 e5             	mov    %rsp,%rbp
+  8013f3:	41 57                	push   %r15
+  8013f5:	41 56                	push   %r14
+  8013f7:	41 55                	push   %r13
+  8013f9:	41 54                	push   %r12
+  8013fb:	53                   	push   %rbx
+  8013fc:	48 83 ec 18          	sub    $0x18,%rsp
+  801400:	49 89 fc             	mov    %rdi,%r12
+  801403:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801407:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80140b:	48 b8 50 08 80 00 00 	movabs $0x800850,%rax
+  801412:	00 00 00 
+  801415:	ff d0                	call   *%rax
+  801417:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80141a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801420:	49 bd 70 02 80 00 00 	movabs $0x800270,%r13
+  801427:	00 00 00 
+            sys_yield();
+  80142a:	49 be 0d 02 80 00 00 	movabs $0x80020d,%r14
+  801431:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801434:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801439:	74 7d                	je     8014b8 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80143b:	8b 03                	mov    (%rbx),%eax
+  80143d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801440:	75 26                	jne    801468 <devpipe_read+0x79>
+            if (i > 0) return i;
+  801442:	4d 85 ff             	test   %r15,%r15
+  801445:	75 77                	jne    8014be <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801447:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80144c:	48 89 da             	mov    %rbx,%rdx
+  80144f:	be 00 10 00 00       	mov    $0x1000,%esi
+  801454:	4c 89 e7             	mov    %r12,%rdi
+  801457:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80145a:	85 c0                	test   %eax,%eax
+  80145c:	74 72                	je     8014d0 <devpipe_read+0xe1>
+            sys_yield();
+  80145e:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801461:	8b 03                	mov    (%rbx),%eax
+  801463:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801466:	74 df                	je     801447 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801468:	48 63 c8             	movslq %eax,%rcx
+  80146b:	48 89 ca             	mov    %rcx,%rdx
+  80146e:	48 c1 ea 03          	shr    $0x3,%rdx
+  801472:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801479:	08 10 20 
+  80147c:	48 89 d0             	mov    %rdx,%rax
+  80147f:	48 f7 e6             	mul    %rsi
+  801482:	48 c1 ea 06          	shr    $0x6,%rdx
+  801486:	48 89 d0             	mov    %rdx,%rax
+  801489:	48 c1 e0 09          	shl    $0x9,%rax
+  80148d:	48 29 d0             	sub    %rdx,%rax
+  801490:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801497:	00 
+  801498:	48 89 c8             	mov    %rcx,%rax
+  80149b:	48 29 d0             	sub    %rdx,%rax
+  80149e:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8014a3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8014a7:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8014ab:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8014ae:	49 83 c7 01          	add    $0x1,%r15
+  8014b2:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8014b6:	75 83                	jne    80143b <devpipe_read+0x4c>
+    return n;
+  8014b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014bc:	eb 03                	jmp    8014c1 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014be:	4c 89 f8             	mov    %r15,%rax
+}
+  8014c1:	48 83 c4 18          	add    $0x18,%rsp
+  8014c5:	5b                   	pop    %rbx
+  8014c6:	41 5c                	pop    %r12
+  8014c8:	41 5d                	pop    %r13
+  8014ca:	41 5e                	pop    %r14
+  8014cc:	41 5f                	pop    %r15
+  8014ce:	5d                   	pop    %rbp
+  8014cf:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d5:	eb ea                	jmp    8014c1 <devpipe_read+0xd2>
+
+00000000008014d7 <pipe>:
+pipe(int pfd[2]) {
+  8014d7:	55                   	push   %rbp
+  8014d8:	48 89 e5             	mov    %rsp,%rbp
+  8014db:	41 55                	push   %r13
+  8014dd:	41 54                	push   %r12
+  8014df:	53                   	push   %rbx
+  8014e0:	48 83 ec 18          	sub    $0x18,%rsp
+  8014e4:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8014e7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8014eb:	48 b8 6c 08 80 00 00 	movabs $0x80086c,%rax
+  8014f2:	00 00 00 
+  8014f5:	ff d0                	call   *%rax
+  8014f7:	89 c3                	mov    %eax,%ebx
+  8014f9:	85 c0                	test   %eax,%eax
+  8014fb:	0f 88 a0 01 00 00    	js     8016a1 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  801501:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801506:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80150b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80150f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801514:	48 b8 9c 02 80 00 00 	movabs $0x80029c,%rax
+  80151b:	00 00 00 
+  80151e:	ff d0                	call   *%rax
+  801520:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801522:	85 c0                	test   %eax,%eax
+  801524:	0f 88 77 01 00 00    	js     8016a1 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80152a:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80152e:	48 b8 6c 08 80 00 00 	movabs $0x80086c,%rax
+  801535:	00 00 00 
+  801538:	ff d0                	call   *%rax
+  80153a:	89 c3                	mov    %eax,%ebx
+  80153c:	85 c0                	test   %eax,%eax
+  80153e:	0f 88 43 01 00 00    	js     801687 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801544:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801549:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80154e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801552:	bf 00 00 00 00       	mov    $0x0,%edi
+  801557:	48 b8 9c 02 80 00 00 	movabs $0x80029c,%rax
+  80155e:	00 00 00 
+  801561:	ff d0                	call   *%rax
+  801563:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801565:	85 c0                	test   %eax,%eax
+  801567:	0f 88 1a 01 00 00    	js     801687 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80156d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801571:	48 b8 50 08 80 00 00 	movabs $0x800850,%rax
+  801578:	00 00 00 
+  80157b:	ff d0                	call   *%rax
+  80157d:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801580:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801585:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80158a:	48 89 c6             	mov    %rax,%rsi
+  80158d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801592:	48 b8 9c 02 80 00 00 	movabs $0x80029c,%rax
+  801599:	00 00 00 
+  80159c:	ff d0                	call   *%rax
+  80159e:	89 c3                	mov    %eax,%ebx
+  8015a0:	85 c0                	test   %eax,%eax
+  8015a2:	0f 88 c5 00 00 00    	js     80166d <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8015a8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8015ac:	48 b8 50 08 80 00 00 	movabs $0x800850,%rax
+  8015b3:	00 00 00 
+  8015b6:	ff d0                	call   *%rax
+  8015b8:	48 89 c1             	mov    %rax,%rcx
+  8015bb:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8015c1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8015c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015cc:	4c 89 ee             	mov    %r13,%rsi
+  8015cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015d4:	48 b8 03 03 80 00 00 	movabs $0x800303,%rax
+  8015db:	00 00 00 
+  8015de:	ff d0                	call   *%rax
+  8015e0:	89 c3                	mov    %eax,%ebx
+  8015e2:	85 c0                	test   %eax,%eax
+  8015e4:	78 6e                	js     801654 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8015e6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8015eb:	4c 89 ef             	mov    %r13,%rdi
+  8015ee:	48 b8 3e 02 80 00 00 	movabs $0x80023e,%rax
+  8015f5:	00 00 00 
+  8015f8:	ff d0                	call   *%rax
+  8015fa:	83 f8 02             	cmp    $0x2,%eax
+  8015fd:	0f 85 ab 00 00 00    	jne    8016ae <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801603:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80160a:	00 00 
+  80160c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801610:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801612:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801616:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80161d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801621:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801623:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801627:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80162e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801632:	48 bb 3e 08 80 00 00 	movabs $0x80083e,%rbx
+  801639:	00 00 00 
+  80163c:	ff d3                	call   *%rbx
+  80163e:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801642:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801646:	ff d3                	call   *%rbx
+  801648:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80164d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801652:	eb 4d                	jmp    8016a1 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  801654:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801659:	4c 89 ee             	mov    %r13,%rsi
+  80165c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801661:	48 b8 68 03 80 00 00 	movabs $0x800368,%rax
+  801668:	00 00 00 
+  80166b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80166d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801672:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801676:	bf 00 00 00 00       	mov    $0x0,%edi
+  80167b:	48 b8 68 03 80 00 00 	movabs $0x800368,%rax
+  801682:	00 00 00 
+  801685:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  801687:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80168c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801690:	bf 00 00 00 00       	mov    $0x0,%edi
+  801695:	48 b8 68 03 80 00 00 	movabs $0x800368,%rax
+  80169c:	00 00 00 
+  80169f:	ff d0                	call   *%rax
+}
+  8016a1:	89 d8                	mov    %ebx,%eax
+  8016a3:	48 83 c4 18          	add    $0x18,%rsp
+  8016a7:	5b                   	pop    %rbx
+  8016a8:	41 5c                	pop    %r12
+  8016aa:	41 5d                	pop    %r13
+  8016ac:	5d                   	pop    %rbp
+  8016ad:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8016ae:	48 b9 50 2c 80 00 00 	movabs $0x802c50,%rcx
+  8016b5:	00 00 00 
+  8016b8:	48 ba 27 2c 80 00 00 	movabs $0x802c27,%rdx
+  8016bf:	00 00 00 
+  8016c2:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8016c7:	48 bf 3c 2c 80 00 00 	movabs $0x802c3c,%rdi
+  8016ce:	00 00 00 
+  8016d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d6:	49 b8 11 1b 80 00 00 	movabs $0x801b11,%r8
+  8016dd:	00 00 00 
+  8016e0:	41 ff d0             	call   *%r8
+
+00000000008016e3 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8016e3:	55                   	push   %rbp
+  8016e4:	48 89 e5             	mov    %rsp,%rbp
+  8016e7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8016eb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8016ef:	48 b8 cc 08 80 00 00 	movabs $0x8008cc,%rax
+  8016f6:	00 00 00 
+  8016f9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8016fb:	85 c0                	test   %eax,%eax
+  8016fd:	78 35                	js     801734 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8016ff:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801703:	48 b8 50 08 80 00 00 	movabs $0x800850,%rax
+  80170a:	00 00 00 
+  80170d:	ff d0                	call   *%rax
+  80170f:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801712:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801717:	be 00 10 00 00       	mov    $0x1000,%esi
+  80171c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801720:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  801727:	00 00 00 
+  80172a:	ff d0                	call   *%rax
+  80172c:	85 c0                	test   %eax,%eax
+  80172e:	0f 94 c0             	sete   %al
+  801731:	0f b6 c0             	movzbl %al,%eax
+}
+  801734:	c9                   	leave
+  801735:	c3                   	ret
+
+0000000000801736 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801736:	48 89 f8             	mov    %rdi,%rax
+  801739:	48 c1 e8 27          	shr    $0x27,%rax
+  80173d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801744:	01 00 00 
+  801747:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80174b:	f6 c2 01             	test   $0x1,%dl
+  80174e:	74 6d                	je     8017bd <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801750:	48 89 f8             	mov    %rdi,%rax
+  801753:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801757:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80175e:	01 00 00 
+  801761:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801765:	f6 c2 01             	test   $0x1,%dl
+  801768:	74 62                	je     8017cc <get_uvpt_entry+0x96>
+  80176a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801771:	01 00 00 
+  801774:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801778:	f6 c2 80             	test   $0x80,%dl
+  80177b:	75 4f                	jne    8017cc <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80177d:	48 89 f8             	mov    %rdi,%rax
+  801780:	48 c1 e8 15          	shr    $0x15,%rax
+  801784:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80178b:	01 00 00 
+  80178e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801792:	f6 c2 01             	test   $0x1,%dl
+  801795:	74 44                	je     8017db <get_uvpt_entry+0xa5>
+  801797:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80179e:	01 00 00 
+  8017a1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017a5:	f6 c2 80             	test   $0x80,%dl
+  8017a8:	75 31                	jne    8017db <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8017aa:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8017ae:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8017b5:	01 00 00 
+  8017b8:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8017bc:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017bd:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017c4:	01 00 00 
+  8017c7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017cb:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017cc:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017d3:	01 00 00 
+  8017d6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017da:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017db:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017e2:	01 00 00 
+  8017e5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017e9:	c3                   	ret
+
+00000000008017ea <get_prot>:
+
+int
+get_prot(void *va) {
+  8017ea:	55                   	push   %rbp
+  8017eb:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8017ee:	48 b8 36 17 80 00 00 	movabs $0x801736,%rax
+  8017f5:	00 00 00 
+  8017f8:	ff d0                	call   *%rax
+  8017fa:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8017fd:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  801802:	89 c1                	mov    %eax,%ecx
+  801804:	83 c9 04             	or     $0x4,%ecx
+  801807:	f6 c2 01             	test   $0x1,%dl
+  80180a:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80180d:	89 c1                	mov    %eax,%ecx
+  80180f:	83 c9 02             	or     $0x2,%ecx
+  801812:	f6 c2 02             	test   $0x2,%dl
+  801815:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  801818:	89 c1                	mov    %eax,%ecx
+  80181a:	83 c9 01             	or     $0x1,%ecx
+  80181d:	48 85 d2             	test   %rdx,%rdx
+  801820:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801823:	89 c1                	mov    %eax,%ecx
+  801825:	83 c9 40             	or     $0x40,%ecx
+  801828:	f6 c6 04             	test   $0x4,%dh
+  80182b:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80182e:	5d                   	pop    %rbp
+  80182f:	c3                   	ret
+
+0000000000801830 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  801830:	55                   	push   %rbp
+  801831:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801834:	48 b8 36 17 80 00 00 	movabs $0x801736,%rax
+  80183b:	00 00 00 
+  80183e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  801840:	48 c1 e8 06          	shr    $0x6,%rax
+  801844:	83 e0 01             	and    $0x1,%eax
+}
+  801847:	5d                   	pop    %rbp
+  801848:	c3                   	ret
+
+0000000000801849 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  801849:	55                   	push   %rbp
+  80184a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80184d:	48 b8 36 17 80 00 00 	movabs $0x801736,%rax
+  801854:	00 00 00 
+  801857:	ff d0                	call   *%rax
+  801859:	83 e0 01             	and    $0x1,%eax
+}
+  80185c:	5d                   	pop    %rbp
+  80185d:	c3                   	ret
+
+000000000080185e <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80185e:	55                   	push   %rbp
+  80185f:	48 89 e5             	mov    %rsp,%rbp
+  801862:	41 57                	push   %r15
+  801864:	41 56                	push   %r14
+  801866:	41 55                	push   %r13
+  801868:	41 54                	push   %r12
+  80186a:	53                   	push   %rbx
+  80186b:	48 83 ec 18          	sub    $0x18,%rsp
+  80186f:	49 89 ff             	mov    %rdi,%r15
+  801872:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  801876:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  80187b:	49 bc 49 18 80 00 00 	movabs $0x801849,%r12
+  801882:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  801885:	49 be ea 17 80 00 00 	movabs $0x8017ea,%r14
+  80188c:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80188f:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  801896:	00 00 00 
+  801899:	eb 0c                	jmp    8018a7 <foreach_shared_region+0x49>
+  80189b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018a2:	4c 39 eb             	cmp    %r13,%rbx
+  8018a5:	74 38                	je     8018df <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  8018a7:	48 89 df             	mov    %rbx,%rdi
+  8018aa:	41 ff d4             	call   *%r12
+  8018ad:	84 c0                	test   %al,%al
+  8018af:	74 ea                	je     80189b <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  8018b1:	48 89 df             	mov    %rbx,%rdi
+  8018b4:	41 ff d6             	call   *%r14
+  8018b7:	a8 40                	test   $0x40,%al
+  8018b9:	74 e0                	je     80189b <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8018bb:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8018c2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8018c6:	48 89 df             	mov    %rbx,%rdi
+  8018c9:	41 ff d7             	call   *%r15
+        if (err)
+  8018cc:	85 c0                	test   %eax,%eax
+  8018ce:	74 cb                	je     80189b <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8018d0:	48 83 c4 18          	add    $0x18,%rsp
+  8018d4:	5b                   	pop    %rbx
+  8018d5:	41 5c                	pop    %r12
+  8018d7:	41 5d                	pop    %r13
+  8018d9:	41 5e                	pop    %r14
+  8018db:	41 5f                	pop    %r15
+  8018dd:	5d                   	pop    %rbp
+  8018de:	c3                   	ret
+    return 0;
+  8018df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e4:	eb ea                	jmp    8018d0 <foreach_shared_region+0x72>
+
+00000000008018e6 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8018e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018eb:	c3                   	ret
+
+00000000008018ec <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8018ec:	55                   	push   %rbp
+  8018ed:	48 89 e5             	mov    %rsp,%rbp
+  8018f0:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8018f3:	48 be 74 2c 80 00 00 	movabs $0x802c74,%rsi
+  8018fa:	00 00 00 
+  8018fd:	48 b8 86 25 80 00 00 	movabs $0x802586,%rax
+  801904:	00 00 00 
+  801907:	ff d0                	call   *%rax
+    return 0;
+}
+  801909:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190e:	5d                   	pop    %rbp
+  80190f:	c3                   	ret
+
+0000000000801910 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801910:	55                   	push   %rbp
+  801911:	48 89 e5             	mov    %rsp,%rbp
+  801914:	41 57                	push   %r15
+  801916:	41 56                	push   %r14
+  801918:	41 55                	push   %r13
+  80191a:	41 54                	push   %r12
+  80191c:	53                   	push   %rbx
+  80191d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801924:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80192b:	48 85 d2             	test   %rdx,%rdx
+  80192e:	74 7a                	je     8019aa <devcons_write+0x9a>
+  801930:	49 89 d6             	mov    %rdx,%r14
+  801933:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801939:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80193e:	49 bf 80 27 80 00 00 	movabs $0x802780,%r15
+  801945:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801948:	4c 89 f3             	mov    %r14,%rbx
+  80194b:	48 29 f3             	sub    %rsi,%rbx
+  80194e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801953:	48 39 c3             	cmp    %rax,%rbx
+  801956:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80195a:	4c 63 eb             	movslq %ebx,%r13
+  80195d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801964:	48 01 c6             	add    %rax,%rsi
+  801967:	4c 89 ea             	mov    %r13,%rdx
+  80196a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801971:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801974:	4c 89 ee             	mov    %r13,%rsi
+  801977:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80197e:	48 b8 13 01 80 00 00 	movabs $0x800113,%rax
+  801985:	00 00 00 
+  801988:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80198a:	41 01 dc             	add    %ebx,%r12d
+  80198d:	49 63 f4             	movslq %r12d,%rsi
+  801990:	4c 39 f6             	cmp    %r14,%rsi
+  801993:	72 b3                	jb     801948 <devcons_write+0x38>
+    return res;
+  801995:	49 63 c4             	movslq %r12d,%rax
+}
+  801998:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80199f:	5b                   	pop    %rbx
+  8019a0:	41 5c                	pop    %r12
+  8019a2:	41 5d                	pop    %r13
+  8019a4:	41 5e                	pop    %r14
+  8019a6:	41 5f                	pop    %r15
+  8019a8:	5d                   	pop    %rbp
+  8019a9:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8019aa:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8019b0:	eb e3                	jmp    801995 <devcons_write+0x85>
+
+00000000008019b2 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8019b2:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8019b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ba:	48 85 c0             	test   %rax,%rax
+  8019bd:	74 55                	je     801a14 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8019bf:	55                   	push   %rbp
+  8019c0:	48 89 e5             	mov    %rsp,%rbp
+  8019c3:	41 55                	push   %r13
+  8019c5:	41 54                	push   %r12
+  8019c7:	53                   	push   %rbx
+  8019c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8019cc:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8019cf:	48 bb 40 01 80 00 00 	movabs $0x800140,%rbx
+  8019d6:	00 00 00 
+  8019d9:	49 bc 0d 02 80 00 00 	movabs $0x80020d,%r12
+  8019e0:	00 00 00 
+  8019e3:	eb 03                	jmp    8019e8 <devcons_read+0x36>
+  8019e5:	41 ff d4             	call   *%r12
+  8019e8:	ff d3                	call   *%rbx
+  8019ea:	85 c0                	test   %eax,%eax
+  8019ec:	74 f7                	je     8019e5 <devcons_read+0x33>
+    if (c < 0) return c;
+  8019ee:	48 63 d0             	movslq %eax,%rdx
+  8019f1:	78 13                	js     801a06 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8019f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f8:	83 f8 04             	cmp    $0x4,%eax
+  8019fb:	74 09                	je     801a06 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8019fd:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801a01:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801a06:	48 89 d0             	mov    %rdx,%rax
+  801a09:	48 83 c4 08          	add    $0x8,%rsp
+  801a0d:	5b                   	pop    %rbx
+  801a0e:	41 5c                	pop    %r12
+  801a10:	41 5d                	pop    %r13
+  801a12:	5d                   	pop    %rbp
+  801a13:	c3                   	ret
+  801a14:	48 89 d0             	mov    %rdx,%rax
+  801a17:	c3                   	ret
+
+0000000000801a18 <cputchar>:
+cputchar(int ch) {
+  801a18:	55                   	push   %rbp
+  801a19:	48 89 e5             	mov    %rsp,%rbp
+  801a1c:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801a20:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801a24:	be 01 00 00 00       	mov    $0x1,%esi
+  801a29:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801a2d:	48 b8 13 01 80 00 00 	movabs $0x800113,%rax
+  801a34:	00 00 00 
+  801a37:	ff d0                	call   *%rax
+}
+  801a39:	c9                   	leave
+  801a3a:	c3                   	ret
+
+0000000000801a3b <getchar>:
+getchar(void) {
+  801a3b:	55                   	push   %rbp
+  801a3c:	48 89 e5             	mov    %rsp,%rbp
+  801a3f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801a43:	ba 01 00 00 00       	mov    $0x1,%edx
+  801a48:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801a4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a51:	48 b8 af 0b 80 00 00 	movabs $0x800baf,%rax
+  801a58:	00 00 00 
+  801a5b:	ff d0                	call   *%rax
+  801a5d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801a5f:	85 c0                	test   %eax,%eax
+  801a61:	78 06                	js     801a69 <getchar+0x2e>
+  801a63:	74 08                	je     801a6d <getchar+0x32>
+  801a65:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801a69:	89 d0                	mov    %edx,%eax
+  801a6b:	c9                   	leave
+  801a6c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801a6d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801a72:	eb f5                	jmp    801a69 <getchar+0x2e>
+
+0000000000801a74 <iscons>:
+iscons(int fdnum) {
+  801a74:	55                   	push   %rbp
+  801a75:	48 89 e5             	mov    %rsp,%rbp
+  801a78:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801a7c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a80:	48 b8 cc 08 80 00 00 	movabs $0x8008cc,%rax
+  801a87:	00 00 00 
+  801a8a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a8c:	85 c0                	test   %eax,%eax
+  801a8e:	78 18                	js     801aa8 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801a90:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a94:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801a9b:	00 00 00 
+  801a9e:	8b 00                	mov    (%rax),%eax
+  801aa0:	39 02                	cmp    %eax,(%rdx)
+  801aa2:	0f 94 c0             	sete   %al
+  801aa5:	0f b6 c0             	movzbl %al,%eax
+}
+  801aa8:	c9                   	leave
+  801aa9:	c3                   	ret
+
+0000000000801aaa <opencons>:
+opencons(void) {
+  801aaa:	55                   	push   %rbp
+  801aab:	48 89 e5             	mov    %rsp,%rbp
+  801aae:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801ab2:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801ab6:	48 b8 6c 08 80 00 00 	movabs $0x80086c,%rax
+  801abd:	00 00 00 
+  801ac0:	ff d0                	call   *%rax
+  801ac2:	85 c0                	test   %eax,%eax
+  801ac4:	78 49                	js     801b0f <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801ac6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801acb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ad0:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801ad4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ad9:	48 b8 9c 02 80 00 00 	movabs $0x80029c,%rax
+  801ae0:	00 00 00 
+  801ae3:	ff d0                	call   *%rax
+  801ae5:	85 c0                	test   %eax,%eax
+  801ae7:	78 26                	js     801b0f <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801ae9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801aed:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801af4:	00 00 
+  801af6:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801af8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801afc:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801b03:	48 b8 3e 08 80 00 00 	movabs $0x80083e,%rax
+  801b0a:	00 00 00 
+  801b0d:	ff d0                	call   *%rax
+}
+  801b0f:	c9                   	leave
+  801b10:	c3                   	ret
+
+0000000000801b11 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801b11:	55                   	push   %rbp
+  801b12:	48 89 e5             	mov    %rsp,%rbp
+  801b15:	41 56                	push   %r14
+  801b17:	41 55                	push   %r13
+  801b19:	41 54                	push   %r12
+  801b1b:	53                   	push   %rbx
+  801b1c:	48 83 ec 50          	sub    $0x50,%rsp
+  801b20:	49 89 fc             	mov    %rdi,%r12
+  801b23:	41 89 f5             	mov    %esi,%r13d
+  801b26:	48 89 d3             	mov    %rdx,%rbx
+  801b29:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b2d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801b31:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801b35:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801b3c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b40:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801b44:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801b48:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801b4c:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  801b53:	00 00 00 
+  801b56:	4c 8b 30             	mov    (%rax),%r14
+  801b59:	48 b8 dc 01 80 00 00 	movabs $0x8001dc,%rax
+  801b60:	00 00 00 
+  801b63:	ff d0                	call   *%rax
+  801b65:	89 c6                	mov    %eax,%esi
+  801b67:	45 89 e8             	mov    %r13d,%r8d
+  801b6a:	4c 89 e1             	mov    %r12,%rcx
+  801b6d:	4c 89 f2             	mov    %r14,%rdx
+  801b70:	48 bf 80 2c 80 00 00 	movabs $0x802c80,%rdi
+  801b77:	00 00 00 
+  801b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b7f:	49 bc 61 1c 80 00 00 	movabs $0x801c61,%r12
+  801b86:	00 00 00 
+  801b89:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801b8c:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801b90:	48 89 df             	mov    %rbx,%rdi
+  801b93:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  801b9a:	00 00 00 
+  801b9d:	ff d0                	call   *%rax
+    cprintf("\n");
+  801b9f:	48 bf 44 2b 80 00 00 	movabs $0x802b44,%rdi
+  801ba6:	00 00 00 
+  801ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bae:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801bb1:	cc                   	int3
+  801bb2:	eb fd                	jmp    801bb1 <_panic+0xa0>
+
+0000000000801bb4 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801bb4:	55                   	push   %rbp
+  801bb5:	48 89 e5             	mov    %rsp,%rbp
+  801bb8:	53                   	push   %rbx
+  801bb9:	48 83 ec 08          	sub    $0x8,%rsp
+  801bbd:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801bc0:	8b 06                	mov    (%rsi),%eax
+  801bc2:	8d 50 01             	lea    0x1(%rax),%edx
+  801bc5:	89 16                	mov    %edx,(%rsi)
+  801bc7:	48 98                	cltq
+  801bc9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801bce:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801bd4:	74 0a                	je     801be0 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801bd6:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801bda:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bde:	c9                   	leave
+  801bdf:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801be0:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801be4:	be ff 00 00 00       	mov    $0xff,%esi
+  801be9:	48 b8 13 01 80 00 00 	movabs $0x800113,%rax
+  801bf0:	00 00 00 
+  801bf3:	ff d0                	call   *%rax
+        state->offset = 0;
+  801bf5:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801bfb:	eb d9                	jmp    801bd6 <putch+0x22>
+
+0000000000801bfd <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801bfd:	55                   	push   %rbp
+  801bfe:	48 89 e5             	mov    %rsp,%rbp
+  801c01:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801c08:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801c0b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801c12:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801c17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801c1f:	48 89 f1             	mov    %rsi,%rcx
+  801c22:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801c29:	48 bf b4 1b 80 00 00 	movabs $0x801bb4,%rdi
+  801c30:	00 00 00 
+  801c33:	48 b8 b1 1d 80 00 00 	movabs $0x801db1,%rax
+  801c3a:	00 00 00 
+  801c3d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801c3f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801c46:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801c4d:	48 b8 13 01 80 00 00 	movabs $0x800113,%rax
+  801c54:	00 00 00 
+  801c57:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801c59:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801c5f:	c9                   	leave
+  801c60:	c3                   	ret
+
+0000000000801c61 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801c61:	55                   	push   %rbp
+  801c62:	48 89 e5             	mov    %rsp,%rbp
+  801c65:	48 83 ec 50          	sub    $0x50,%rsp
+  801c69:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801c6d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801c71:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c75:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801c79:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801c7d:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801c84:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c8c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801c90:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801c94:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801c98:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  801c9f:	00 00 00 
+  801ca2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801ca4:	c9                   	leave
+  801ca5:	c3                   	ret
+
+0000000000801ca6 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801ca6:	55                   	push   %rbp
+  801ca7:	48 89 e5             	mov    %rsp,%rbp
+  801caa:	41 57                	push   %r15
+  801cac:	41 56                	push   %r14
+  801cae:	41 55                	push   %r13
+  801cb0:	41 54                	push   %r12
+  801cb2:	53                   	push   %rbx
+  801cb3:	48 83 ec 18          	sub    $0x18,%rsp
+  801cb7:	49 89 fc             	mov    %rdi,%r12
+  801cba:	49 89 f5             	mov    %rsi,%r13
+  801cbd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cc1:	8b 45 10             	mov    0x10(%rbp),%eax
+  801cc4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801cc7:	41 89 cf             	mov    %ecx,%r15d
+  801cca:	4c 39 fa             	cmp    %r15,%rdx
+  801ccd:	73 5b                	jae    801d2a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801ccf:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801cd3:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801cd7:	85 db                	test   %ebx,%ebx
+  801cd9:	7e 0e                	jle    801ce9 <print_num+0x43>
+            putch(padc, put_arg);
+  801cdb:	4c 89 ee             	mov    %r13,%rsi
+  801cde:	44 89 f7             	mov    %r14d,%edi
+  801ce1:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801ce4:	83 eb 01             	sub    $0x1,%ebx
+  801ce7:	75 f2                	jne    801cdb <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801ce9:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801ced:	48 b9 b4 2c 80 00 00 	movabs $0x802cb4,%rcx
+  801cf4:	00 00 00 
+  801cf7:	48 b8 a3 2c 80 00 00 	movabs $0x802ca3,%rax
+  801cfe:	00 00 00 
+  801d01:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801d05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d09:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d0e:	49 f7 f7             	div    %r15
+  801d11:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801d15:	4c 89 ee             	mov    %r13,%rsi
+  801d18:	41 ff d4             	call   *%r12
+}
+  801d1b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801d1f:	5b                   	pop    %rbx
+  801d20:	41 5c                	pop    %r12
+  801d22:	41 5d                	pop    %r13
+  801d24:	41 5e                	pop    %r14
+  801d26:	41 5f                	pop    %r15
+  801d28:	5d                   	pop    %rbp
+  801d29:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801d2a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d33:	49 f7 f7             	div    %r15
+  801d36:	48 83 ec 08          	sub    $0x8,%rsp
+  801d3a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801d3e:	52                   	push   %rdx
+  801d3f:	45 0f be c9          	movsbl %r9b,%r9d
+  801d43:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801d47:	48 89 c2             	mov    %rax,%rdx
+  801d4a:	48 b8 a6 1c 80 00 00 	movabs $0x801ca6,%rax
+  801d51:	00 00 00 
+  801d54:	ff d0                	call   *%rax
+  801d56:	48 83 c4 10          	add    $0x10,%rsp
+  801d5a:	eb 8d                	jmp    801ce9 <print_num+0x43>
+
+0000000000801d5c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801d5c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801d60:	48 8b 06             	mov    (%rsi),%rax
+  801d63:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801d67:	73 0a                	jae    801d73 <sprintputch+0x17>
+        *state->start++ = ch;
+  801d69:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d6d:	48 89 16             	mov    %rdx,(%rsi)
+  801d70:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801d73:	c3                   	ret
+
+0000000000801d74 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801d74:	55                   	push   %rbp
+  801d75:	48 89 e5             	mov    %rsp,%rbp
+  801d78:	48 83 ec 50          	sub    $0x50,%rsp
+  801d7c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d80:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d84:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801d88:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801d8f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d97:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801d9b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801d9f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801da3:	48 b8 b1 1d 80 00 00 	movabs $0x801db1,%rax
+  801daa:	00 00 00 
+  801dad:	ff d0                	call   *%rax
+}
+  801daf:	c9                   	leave
+  801db0:	c3                   	ret
+
+0000000000801db1 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801db1:	55                   	push   %rbp
+  801db2:	48 89 e5             	mov    %rsp,%rbp
+  801db5:	41 57                	push   %r15
+  801db7:	41 56                	push   %r14
+  801db9:	41 55                	push   %r13
+  801dbb:	41 54                	push   %r12
+  801dbd:	53                   	push   %rbx
+  801dbe:	48 83 ec 38          	sub    $0x38,%rsp
+  801dc2:	49 89 fe             	mov    %rdi,%r14
+  801dc5:	49 89 f5             	mov    %rsi,%r13
+  801dc8:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801dcb:	48 8b 01             	mov    (%rcx),%rax
+  801dce:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801dd2:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801dd6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dda:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801dde:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801de2:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801de6:	0f b6 3b             	movzbl (%rbx),%edi
+  801de9:	40 80 ff 25          	cmp    $0x25,%dil
+  801ded:	74 18                	je     801e07 <vprintfmt+0x56>
+            if (!ch) return;
+  801def:	40 84 ff             	test   %dil,%dil
+  801df2:	0f 84 b1 06 00 00    	je     8024a9 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801df8:	40 0f b6 ff          	movzbl %dil,%edi
+  801dfc:	4c 89 ee             	mov    %r13,%rsi
+  801dff:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801e02:	4c 89 e3             	mov    %r12,%rbx
+  801e05:	eb db                	jmp    801de2 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801e07:	be 00 00 00 00       	mov    $0x0,%esi
+  801e0c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801e10:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801e15:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e1b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801e22:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e26:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801e2b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801e30:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801e33:	83 e8 23             	sub    $0x23,%eax
+  801e36:	3c 57                	cmp    $0x57,%al
+  801e38:	0f 87 51 06 00 00    	ja     80248f <vprintfmt+0x6de>
+  801e3e:	0f b6 c0             	movzbl %al,%eax
+  801e41:	48 b9 60 2e 80 00 00 	movabs $0x802e60,%rcx
+  801e48:	00 00 00 
+  801e4b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801e4e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801e51:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801e55:	eb cf                	jmp    801e26 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801e57:	49 89 dc             	mov    %rbx,%r12
+  801e5a:	be 01 00 00 00       	mov    $0x1,%esi
+  801e5f:	eb c5                	jmp    801e26 <vprintfmt+0x75>
+            padc = ch;
+  801e61:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801e65:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e68:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801e6b:	eb b9                	jmp    801e26 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e70:	83 f8 2f             	cmp    $0x2f,%eax
+  801e73:	77 24                	ja     801e99 <vprintfmt+0xe8>
+  801e75:	89 c1                	mov    %eax,%ecx
+  801e77:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801e7b:	83 c0 08             	add    $0x8,%eax
+  801e7e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e81:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801e84:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801e87:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801e8b:	79 99                	jns    801e26 <vprintfmt+0x75>
+                width = precision;
+  801e8d:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801e91:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e97:	eb 8d                	jmp    801e26 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e99:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e9d:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801ea1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ea5:	eb da                	jmp    801e81 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801ea7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801eac:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801eb0:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801eb6:	3c 39                	cmp    $0x39,%al
+  801eb8:	77 1c                	ja     801ed6 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801eba:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801ebe:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801ec2:	0f b6 c0             	movzbl %al,%eax
+  801ec5:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801eca:	0f b6 03             	movzbl (%rbx),%eax
+  801ecd:	3c 39                	cmp    $0x39,%al
+  801ecf:	76 e9                	jbe    801eba <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801ed1:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801ed4:	eb b1                	jmp    801e87 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801ed6:	49 89 dc             	mov    %rbx,%r12
+  801ed9:	eb ac                	jmp    801e87 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801edb:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801ede:	85 c9                	test   %ecx,%ecx
+  801ee0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee5:	0f 49 c1             	cmovns %ecx,%eax
+  801ee8:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801eeb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801eee:	e9 33 ff ff ff       	jmp    801e26 <vprintfmt+0x75>
+            lflag++;
+  801ef3:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ef6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ef9:	e9 28 ff ff ff       	jmp    801e26 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801efe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f01:	83 f8 2f             	cmp    $0x2f,%eax
+  801f04:	77 19                	ja     801f1f <vprintfmt+0x16e>
+  801f06:	89 c2                	mov    %eax,%edx
+  801f08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f0c:	83 c0 08             	add    $0x8,%eax
+  801f0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f12:	8b 3a                	mov    (%rdx),%edi
+  801f14:	4c 89 ee             	mov    %r13,%rsi
+  801f17:	41 ff d6             	call   *%r14
+            break;
+  801f1a:	e9 c3 fe ff ff       	jmp    801de2 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  801f1f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f23:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f27:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f2b:	eb e5                	jmp    801f12 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  801f2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f30:	83 f8 2f             	cmp    $0x2f,%eax
+  801f33:	77 5a                	ja     801f8f <vprintfmt+0x1de>
+  801f35:	89 c2                	mov    %eax,%edx
+  801f37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f3b:	83 c0 08             	add    $0x8,%eax
+  801f3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801f41:	8b 02                	mov    (%rdx),%eax
+  801f43:	89 c1                	mov    %eax,%ecx
+  801f45:	f7 d9                	neg    %ecx
+  801f47:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801f4a:	83 f9 15             	cmp    $0x15,%ecx
+  801f4d:	7f 4e                	jg     801f9d <vprintfmt+0x1ec>
+  801f4f:	48 63 c1             	movslq %ecx,%rax
+  801f52:	48 ba 20 31 80 00 00 	movabs $0x803120,%rdx
+  801f59:	00 00 00 
+  801f5c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801f60:	48 85 c0             	test   %rax,%rax
+  801f63:	74 38                	je     801f9d <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801f65:	48 89 c1             	mov    %rax,%rcx
+  801f68:	48 ba 39 2c 80 00 00 	movabs $0x802c39,%rdx
+  801f6f:	00 00 00 
+  801f72:	4c 89 ee             	mov    %r13,%rsi
+  801f75:	4c 89 f7             	mov    %r14,%rdi
+  801f78:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7d:	49 b8 74 1d 80 00 00 	movabs $0x801d74,%r8
+  801f84:	00 00 00 
+  801f87:	41 ff d0             	call   *%r8
+  801f8a:	e9 53 fe ff ff       	jmp    801de2 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801f8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f9b:	eb a4                	jmp    801f41 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801f9d:	48 ba cc 2c 80 00 00 	movabs $0x802ccc,%rdx
+  801fa4:	00 00 00 
+  801fa7:	4c 89 ee             	mov    %r13,%rsi
+  801faa:	4c 89 f7             	mov    %r14,%rdi
+  801fad:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb2:	49 b8 74 1d 80 00 00 	movabs $0x801d74,%r8
+  801fb9:	00 00 00 
+  801fbc:	41 ff d0             	call   *%r8
+  801fbf:	e9 1e fe ff ff       	jmp    801de2 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801fc4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fc7:	83 f8 2f             	cmp    $0x2f,%eax
+  801fca:	77 6c                	ja     802038 <vprintfmt+0x287>
+  801fcc:	89 c2                	mov    %eax,%edx
+  801fce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fd2:	83 c0 08             	add    $0x8,%eax
+  801fd5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fd8:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801fdb:	48 85 d2             	test   %rdx,%rdx
+  801fde:	48 b8 c5 2c 80 00 00 	movabs $0x802cc5,%rax
+  801fe5:	00 00 00 
+  801fe8:	48 0f 45 c2          	cmovne %rdx,%rax
+  801fec:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801ff0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801ff4:	7e 06                	jle    801ffc <vprintfmt+0x24b>
+  801ff6:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801ffa:	75 4a                	jne    802046 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ffc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802000:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  802004:	0f b6 00             	movzbl (%rax),%eax
+  802007:	84 c0                	test   %al,%al
+  802009:	0f 85 9a 00 00 00    	jne    8020a9 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80200f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802012:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802016:	85 c0                	test   %eax,%eax
+  802018:	0f 8e c4 fd ff ff    	jle    801de2 <vprintfmt+0x31>
+  80201e:	4c 89 ee             	mov    %r13,%rsi
+  802021:	bf 20 00 00 00       	mov    $0x20,%edi
+  802026:	41 ff d6             	call   *%r14
+  802029:	41 83 ec 01          	sub    $0x1,%r12d
+  80202d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802031:	75 eb                	jne    80201e <vprintfmt+0x26d>
+  802033:	e9 aa fd ff ff       	jmp    801de2 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802038:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80203c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802040:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802044:	eb 92                	jmp    801fd8 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802046:	49 63 f7             	movslq %r15d,%rsi
+  802049:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80204d:	48 b8 63 25 80 00 00 	movabs $0x802563,%rax
+  802054:	00 00 00 
+  802057:	ff d0                	call   *%rax
+  802059:	48 89 c2             	mov    %rax,%rdx
+  80205c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80205f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802061:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802064:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802067:	85 c0                	test   %eax,%eax
+  802069:	7e 91                	jle    801ffc <vprintfmt+0x24b>
+  80206b:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802070:	4c 89 ee             	mov    %r13,%rsi
+  802073:	44 89 e7             	mov    %r12d,%edi
+  802076:	41 ff d6             	call   *%r14
+  802079:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80207d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802080:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802083:	75 eb                	jne    802070 <vprintfmt+0x2bf>
+  802085:	e9 72 ff ff ff       	jmp    801ffc <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80208a:	0f b6 f8             	movzbl %al,%edi
+  80208d:	4c 89 ee             	mov    %r13,%rsi
+  802090:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802093:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802097:	49 83 c4 01          	add    $0x1,%r12
+  80209b:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8020a1:	84 c0                	test   %al,%al
+  8020a3:	0f 84 66 ff ff ff    	je     80200f <vprintfmt+0x25e>
+  8020a9:	45 85 ff             	test   %r15d,%r15d
+  8020ac:	78 0a                	js     8020b8 <vprintfmt+0x307>
+  8020ae:	41 83 ef 01          	sub    $0x1,%r15d
+  8020b2:	0f 88 57 ff ff ff    	js     80200f <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8020b8:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8020bc:	74 cc                	je     80208a <vprintfmt+0x2d9>
+  8020be:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8020c1:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8020c6:	80 fa 5e             	cmp    $0x5e,%dl
+  8020c9:	77 c2                	ja     80208d <vprintfmt+0x2dc>
+  8020cb:	eb bd                	jmp    80208a <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8020cd:	40 84 f6             	test   %sil,%sil
+  8020d0:	75 26                	jne    8020f8 <vprintfmt+0x347>
+    switch (lflag) {
+  8020d2:	85 d2                	test   %edx,%edx
+  8020d4:	74 59                	je     80212f <vprintfmt+0x37e>
+  8020d6:	83 fa 01             	cmp    $0x1,%edx
+  8020d9:	74 7b                	je     802156 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8020db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020de:	83 f8 2f             	cmp    $0x2f,%eax
+  8020e1:	0f 87 96 00 00 00    	ja     80217d <vprintfmt+0x3cc>
+  8020e7:	89 c2                	mov    %eax,%edx
+  8020e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020ed:	83 c0 08             	add    $0x8,%eax
+  8020f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020f3:	4c 8b 22             	mov    (%rdx),%r12
+  8020f6:	eb 17                	jmp    80210f <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8020f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8020fe:	77 21                	ja     802121 <vprintfmt+0x370>
+  802100:	89 c2                	mov    %eax,%edx
+  802102:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802106:	83 c0 08             	add    $0x8,%eax
+  802109:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80210c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80210f:	4d 85 e4             	test   %r12,%r12
+  802112:	78 7a                	js     80218e <vprintfmt+0x3dd>
+            num = i;
+  802114:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802117:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80211c:	e9 50 02 00 00       	jmp    802371 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802121:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802125:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802129:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80212d:	eb dd                	jmp    80210c <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80212f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802132:	83 f8 2f             	cmp    $0x2f,%eax
+  802135:	77 11                	ja     802148 <vprintfmt+0x397>
+  802137:	89 c2                	mov    %eax,%edx
+  802139:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80213d:	83 c0 08             	add    $0x8,%eax
+  802140:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802143:	4c 63 22             	movslq (%rdx),%r12
+  802146:	eb c7                	jmp    80210f <vprintfmt+0x35e>
+  802148:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80214c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802150:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802154:	eb ed                	jmp    802143 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802156:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802159:	83 f8 2f             	cmp    $0x2f,%eax
+  80215c:	77 11                	ja     80216f <vprintfmt+0x3be>
+  80215e:	89 c2                	mov    %eax,%edx
+  802160:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802164:	83 c0 08             	add    $0x8,%eax
+  802167:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80216a:	4c 8b 22             	mov    (%rdx),%r12
+  80216d:	eb a0                	jmp    80210f <vprintfmt+0x35e>
+  80216f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802173:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802177:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80217b:	eb ed                	jmp    80216a <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80217d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802181:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802185:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802189:	e9 65 ff ff ff       	jmp    8020f3 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80218e:	4c 89 ee             	mov    %r13,%rsi
+  802191:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802196:	41 ff d6             	call   *%r14
+                i = -i;
+  802199:	49 f7 dc             	neg    %r12
+  80219c:	e9 73 ff ff ff       	jmp    802114 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8021a1:	40 84 f6             	test   %sil,%sil
+  8021a4:	75 32                	jne    8021d8 <vprintfmt+0x427>
+    switch (lflag) {
+  8021a6:	85 d2                	test   %edx,%edx
+  8021a8:	74 5d                	je     802207 <vprintfmt+0x456>
+  8021aa:	83 fa 01             	cmp    $0x1,%edx
+  8021ad:	0f 84 82 00 00 00    	je     802235 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8021b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8021b9:	0f 87 a5 00 00 00    	ja     802264 <vprintfmt+0x4b3>
+  8021bf:	89 c2                	mov    %eax,%edx
+  8021c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021c5:	83 c0 08             	add    $0x8,%eax
+  8021c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021cb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021ce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8021d3:	e9 99 01 00 00       	jmp    802371 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8021d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021db:	83 f8 2f             	cmp    $0x2f,%eax
+  8021de:	77 19                	ja     8021f9 <vprintfmt+0x448>
+  8021e0:	89 c2                	mov    %eax,%edx
+  8021e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021e6:	83 c0 08             	add    $0x8,%eax
+  8021e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021ec:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021ef:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8021f4:	e9 78 01 00 00       	jmp    802371 <vprintfmt+0x5c0>
+  8021f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802201:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802205:	eb e5                	jmp    8021ec <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802207:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80220a:	83 f8 2f             	cmp    $0x2f,%eax
+  80220d:	77 18                	ja     802227 <vprintfmt+0x476>
+  80220f:	89 c2                	mov    %eax,%edx
+  802211:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802215:	83 c0 08             	add    $0x8,%eax
+  802218:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80221b:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80221d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802222:	e9 4a 01 00 00       	jmp    802371 <vprintfmt+0x5c0>
+  802227:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80222b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80222f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802233:	eb e6                	jmp    80221b <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802235:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802238:	83 f8 2f             	cmp    $0x2f,%eax
+  80223b:	77 19                	ja     802256 <vprintfmt+0x4a5>
+  80223d:	89 c2                	mov    %eax,%edx
+  80223f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802243:	83 c0 08             	add    $0x8,%eax
+  802246:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802249:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80224c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802251:	e9 1b 01 00 00       	jmp    802371 <vprintfmt+0x5c0>
+  802256:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80225a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80225e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802262:	eb e5                	jmp    802249 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802264:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802268:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80226c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802270:	e9 56 ff ff ff       	jmp    8021cb <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802275:	40 84 f6             	test   %sil,%sil
+  802278:	75 2e                	jne    8022a8 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80227a:	85 d2                	test   %edx,%edx
+  80227c:	74 59                	je     8022d7 <vprintfmt+0x526>
+  80227e:	83 fa 01             	cmp    $0x1,%edx
+  802281:	74 7f                	je     802302 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802283:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802286:	83 f8 2f             	cmp    $0x2f,%eax
+  802289:	0f 87 9f 00 00 00    	ja     80232e <vprintfmt+0x57d>
+  80228f:	89 c2                	mov    %eax,%edx
+  802291:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802295:	83 c0 08             	add    $0x8,%eax
+  802298:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80229b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80229e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8022a3:	e9 c9 00 00 00       	jmp    802371 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8022a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8022ae:	77 19                	ja     8022c9 <vprintfmt+0x518>
+  8022b0:	89 c2                	mov    %eax,%edx
+  8022b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022b6:	83 c0 08             	add    $0x8,%eax
+  8022b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022bc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8022bf:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022c4:	e9 a8 00 00 00       	jmp    802371 <vprintfmt+0x5c0>
+  8022c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022d5:	eb e5                	jmp    8022bc <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8022d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022da:	83 f8 2f             	cmp    $0x2f,%eax
+  8022dd:	77 15                	ja     8022f4 <vprintfmt+0x543>
+  8022df:	89 c2                	mov    %eax,%edx
+  8022e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022e5:	83 c0 08             	add    $0x8,%eax
+  8022e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022eb:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8022ed:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8022f2:	eb 7d                	jmp    802371 <vprintfmt+0x5c0>
+  8022f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802300:	eb e9                	jmp    8022eb <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802302:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802305:	83 f8 2f             	cmp    $0x2f,%eax
+  802308:	77 16                	ja     802320 <vprintfmt+0x56f>
+  80230a:	89 c2                	mov    %eax,%edx
+  80230c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802310:	83 c0 08             	add    $0x8,%eax
+  802313:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802316:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802319:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80231e:	eb 51                	jmp    802371 <vprintfmt+0x5c0>
+  802320:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802324:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802328:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80232c:	eb e8                	jmp    802316 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80232e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802332:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802336:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80233a:	e9 5c ff ff ff       	jmp    80229b <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80233f:	4c 89 ee             	mov    %r13,%rsi
+  802342:	bf 30 00 00 00       	mov    $0x30,%edi
+  802347:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80234a:	4c 89 ee             	mov    %r13,%rsi
+  80234d:	bf 78 00 00 00       	mov    $0x78,%edi
+  802352:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802355:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802358:	83 f8 2f             	cmp    $0x2f,%eax
+  80235b:	77 47                	ja     8023a4 <vprintfmt+0x5f3>
+  80235d:	89 c2                	mov    %eax,%edx
+  80235f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802363:	83 c0 08             	add    $0x8,%eax
+  802366:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802369:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80236c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802371:	48 83 ec 08          	sub    $0x8,%rsp
+  802375:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802379:	0f 94 c0             	sete   %al
+  80237c:	0f b6 c0             	movzbl %al,%eax
+  80237f:	50                   	push   %rax
+  802380:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802385:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802389:	4c 89 ee             	mov    %r13,%rsi
+  80238c:	4c 89 f7             	mov    %r14,%rdi
+  80238f:	48 b8 a6 1c 80 00 00 	movabs $0x801ca6,%rax
+  802396:	00 00 00 
+  802399:	ff d0                	call   *%rax
+            break;
+  80239b:	48 83 c4 10          	add    $0x10,%rsp
+  80239f:	e9 3e fa ff ff       	jmp    801de2 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8023a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023b0:	eb b7                	jmp    802369 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8023b2:	40 84 f6             	test   %sil,%sil
+  8023b5:	75 2b                	jne    8023e2 <vprintfmt+0x631>
+    switch (lflag) {
+  8023b7:	85 d2                	test   %edx,%edx
+  8023b9:	74 56                	je     802411 <vprintfmt+0x660>
+  8023bb:	83 fa 01             	cmp    $0x1,%edx
+  8023be:	74 7f                	je     80243f <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8023c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8023c6:	0f 87 a2 00 00 00    	ja     80246e <vprintfmt+0x6bd>
+  8023cc:	89 c2                	mov    %eax,%edx
+  8023ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023d2:	83 c0 08             	add    $0x8,%eax
+  8023d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023d8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023db:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023e0:	eb 8f                	jmp    802371 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8023e8:	77 19                	ja     802403 <vprintfmt+0x652>
+  8023ea:	89 c2                	mov    %eax,%edx
+  8023ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023f0:	83 c0 08             	add    $0x8,%eax
+  8023f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023f6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023f9:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023fe:	e9 6e ff ff ff       	jmp    802371 <vprintfmt+0x5c0>
+  802403:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802407:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80240b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80240f:	eb e5                	jmp    8023f6 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802411:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802414:	83 f8 2f             	cmp    $0x2f,%eax
+  802417:	77 18                	ja     802431 <vprintfmt+0x680>
+  802419:	89 c2                	mov    %eax,%edx
+  80241b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80241f:	83 c0 08             	add    $0x8,%eax
+  802422:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802425:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802427:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80242c:	e9 40 ff ff ff       	jmp    802371 <vprintfmt+0x5c0>
+  802431:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802435:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802439:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80243d:	eb e6                	jmp    802425 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80243f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802442:	83 f8 2f             	cmp    $0x2f,%eax
+  802445:	77 19                	ja     802460 <vprintfmt+0x6af>
+  802447:	89 c2                	mov    %eax,%edx
+  802449:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80244d:	83 c0 08             	add    $0x8,%eax
+  802450:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802453:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802456:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80245b:	e9 11 ff ff ff       	jmp    802371 <vprintfmt+0x5c0>
+  802460:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802464:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802468:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80246c:	eb e5                	jmp    802453 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80246e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802472:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802476:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80247a:	e9 59 ff ff ff       	jmp    8023d8 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80247f:	4c 89 ee             	mov    %r13,%rsi
+  802482:	bf 25 00 00 00       	mov    $0x25,%edi
+  802487:	41 ff d6             	call   *%r14
+            break;
+  80248a:	e9 53 f9 ff ff       	jmp    801de2 <vprintfmt+0x31>
+            putch('%', put_arg);
+  80248f:	4c 89 ee             	mov    %r13,%rsi
+  802492:	bf 25 00 00 00       	mov    $0x25,%edi
+  802497:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80249a:	48 83 eb 01          	sub    $0x1,%rbx
+  80249e:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8024a2:	75 f6                	jne    80249a <vprintfmt+0x6e9>
+  8024a4:	e9 39 f9 ff ff       	jmp    801de2 <vprintfmt+0x31>
+}
+  8024a9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8024ad:	5b                   	pop    %rbx
+  8024ae:	41 5c                	pop    %r12
+  8024b0:	41 5d                	pop    %r13
+  8024b2:	41 5e                	pop    %r14
+  8024b4:	41 5f                	pop    %r15
+  8024b6:	5d                   	pop    %rbp
+  8024b7:	c3                   	ret
+
+00000000008024b8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8024b8:	55                   	push   %rbp
+  8024b9:	48 89 e5             	mov    %rsp,%rbp
+  8024bc:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8024c0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8024c4:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8024c9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8024cd:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8024d4:	48 85 ff             	test   %rdi,%rdi
+  8024d7:	74 2b                	je     802504 <vsnprintf+0x4c>
+  8024d9:	48 85 f6             	test   %rsi,%rsi
+  8024dc:	74 26                	je     802504 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8024de:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024e2:	48 bf 5c 1d 80 00 00 	movabs $0x801d5c,%rdi
+  8024e9:	00 00 00 
+  8024ec:	48 b8 b1 1d 80 00 00 	movabs $0x801db1,%rax
+  8024f3:	00 00 00 
+  8024f6:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8024f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024fc:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8024ff:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802502:	c9                   	leave
+  802503:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802504:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802509:	eb f7                	jmp    802502 <vsnprintf+0x4a>
+
+000000000080250b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80250b:	55                   	push   %rbp
+  80250c:	48 89 e5             	mov    %rsp,%rbp
+  80250f:	48 83 ec 50          	sub    $0x50,%rsp
+  802513:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802517:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80251b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80251f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802526:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80252a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80252e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802532:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802536:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80253a:	48 b8 b8 24 80 00 00 	movabs $0x8024b8,%rax
+  802541:	00 00 00 
+  802544:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802546:	c9                   	leave
+  802547:	c3                   	ret
+
+0000000000802548 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802548:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80254b:	74 10                	je     80255d <strlen+0x15>
+    size_t n = 0;
+  80254d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802552:	48 83 c0 01          	add    $0x1,%rax
+  802556:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80255a:	75 f6                	jne    802552 <strlen+0xa>
+  80255c:	c3                   	ret
+    size_t n = 0;
+  80255d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802562:	c3                   	ret
+
+0000000000802563 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802563:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802566:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80256b:	48 85 f6             	test   %rsi,%rsi
+  80256e:	74 11                	je     802581 <strnlen+0x1e>
+  802570:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802574:	74 0c                	je     802582 <strnlen+0x1f>
+  802576:	48 83 c2 01          	add    $0x1,%rdx
+  80257a:	48 39 d0             	cmp    %rdx,%rax
+  80257d:	75 f1                	jne    802570 <strnlen+0xd>
+  80257f:	eb 04                	jmp    802585 <strnlen+0x22>
+  802581:	c3                   	ret
+  802582:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802585:	c3                   	ret
+
+0000000000802586 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802586:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802589:	ba 00 00 00 00       	mov    $0x0,%edx
+  80258e:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802592:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802595:	48 83 c2 01          	add    $0x1,%rdx
+  802599:	84 c9                	test   %cl,%cl
+  80259b:	75 f1                	jne    80258e <strcpy+0x8>
+        ;
+    return res;
+}
+  80259d:	c3                   	ret
+
+000000000080259e <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80259e:	55                   	push   %rbp
+  80259f:	48 89 e5             	mov    %rsp,%rbp
+  8025a2:	41 54                	push   %r12
+  8025a4:	53                   	push   %rbx
+  8025a5:	48 89 fb             	mov    %rdi,%rbx
+  8025a8:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8025ab:	48 b8 48 25 80 00 00 	movabs $0x802548,%rax
+  8025b2:	00 00 00 
+  8025b5:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8025b7:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8025bb:	4c 89 e6             	mov    %r12,%rsi
+  8025be:	48 b8 86 25 80 00 00 	movabs $0x802586,%rax
+  8025c5:	00 00 00 
+  8025c8:	ff d0                	call   *%rax
+    return dst;
+}
+  8025ca:	48 89 d8             	mov    %rbx,%rax
+  8025cd:	5b                   	pop    %rbx
+  8025ce:	41 5c                	pop    %r12
+  8025d0:	5d                   	pop    %rbp
+  8025d1:	c3                   	ret
+
+00000000008025d2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8025d2:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8025d5:	48 85 d2             	test   %rdx,%rdx
+  8025d8:	74 1f                	je     8025f9 <strncpy+0x27>
+  8025da:	48 01 fa             	add    %rdi,%rdx
+  8025dd:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8025e0:	48 83 c1 01          	add    $0x1,%rcx
+  8025e4:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8025e8:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8025ec:	41 80 f8 01          	cmp    $0x1,%r8b
+  8025f0:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8025f4:	48 39 ca             	cmp    %rcx,%rdx
+  8025f7:	75 e7                	jne    8025e0 <strncpy+0xe>
+    }
+    return ret;
+}
+  8025f9:	c3                   	ret
+
+00000000008025fa <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8025fa:	48 89 f8             	mov    %rdi,%rax
+  8025fd:	48 85 d2             	test   %rdx,%rdx
+  802600:	74 24                	je     802626 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802602:	48 83 ea 01          	sub    $0x1,%rdx
+  802606:	74 1b                	je     802623 <strlcpy+0x29>
+  802608:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80260c:	0f b6 16             	movzbl (%rsi),%edx
+  80260f:	84 d2                	test   %dl,%dl
+  802611:	74 10                	je     802623 <strlcpy+0x29>
+            *dst++ = *src++;
+  802613:	48 83 c6 01          	add    $0x1,%rsi
+  802617:	48 83 c0 01          	add    $0x1,%rax
+  80261b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80261e:	48 39 c8             	cmp    %rcx,%rax
+  802621:	75 e9                	jne    80260c <strlcpy+0x12>
+        *dst = '\0';
+  802623:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802626:	48 29 f8             	sub    %rdi,%rax
+}
+  802629:	c3                   	ret
+
+000000000080262a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80262a:	0f b6 07             	movzbl (%rdi),%eax
+  80262d:	84 c0                	test   %al,%al
+  80262f:	74 13                	je     802644 <strcmp+0x1a>
+  802631:	38 06                	cmp    %al,(%rsi)
+  802633:	75 0f                	jne    802644 <strcmp+0x1a>
+  802635:	48 83 c7 01          	add    $0x1,%rdi
+  802639:	48 83 c6 01          	add    $0x1,%rsi
+  80263d:	0f b6 07             	movzbl (%rdi),%eax
+  802640:	84 c0                	test   %al,%al
+  802642:	75 ed                	jne    802631 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802644:	0f b6 c0             	movzbl %al,%eax
+  802647:	0f b6 16             	movzbl (%rsi),%edx
+  80264a:	29 d0                	sub    %edx,%eax
+}
+  80264c:	c3                   	ret
+
+000000000080264d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80264d:	48 85 d2             	test   %rdx,%rdx
+  802650:	74 1f                	je     802671 <strncmp+0x24>
+  802652:	0f b6 07             	movzbl (%rdi),%eax
+  802655:	84 c0                	test   %al,%al
+  802657:	74 1e                	je     802677 <strncmp+0x2a>
+  802659:	3a 06                	cmp    (%rsi),%al
+  80265b:	75 1a                	jne    802677 <strncmp+0x2a>
+  80265d:	48 83 c7 01          	add    $0x1,%rdi
+  802661:	48 83 c6 01          	add    $0x1,%rsi
+  802665:	48 83 ea 01          	sub    $0x1,%rdx
+  802669:	75 e7                	jne    802652 <strncmp+0x5>
+
+    if (!n) return 0;
+  80266b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802670:	c3                   	ret
+  802671:	b8 00 00 00 00       	mov    $0x0,%eax
+  802676:	c3                   	ret
+  802677:	48 85 d2             	test   %rdx,%rdx
+  80267a:	74 09                	je     802685 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80267c:	0f b6 07             	movzbl (%rdi),%eax
+  80267f:	0f b6 16             	movzbl (%rsi),%edx
+  802682:	29 d0                	sub    %edx,%eax
+  802684:	c3                   	ret
+    if (!n) return 0;
+  802685:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80268a:	c3                   	ret
+
+000000000080268b <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80268b:	0f b6 17             	movzbl (%rdi),%edx
+  80268e:	84 d2                	test   %dl,%dl
+  802690:	74 18                	je     8026aa <strchr+0x1f>
+        if (*str == c) {
+  802692:	0f be d2             	movsbl %dl,%edx
+  802695:	39 f2                	cmp    %esi,%edx
+  802697:	74 17                	je     8026b0 <strchr+0x25>
+    for (; *str; str++) {
+  802699:	48 83 c7 01          	add    $0x1,%rdi
+  80269d:	0f b6 17             	movzbl (%rdi),%edx
+  8026a0:	84 d2                	test   %dl,%dl
+  8026a2:	75 ee                	jne    802692 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8026a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a9:	c3                   	ret
+  8026aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026af:	c3                   	ret
+  8026b0:	48 89 f8             	mov    %rdi,%rax
+}
+  8026b3:	c3                   	ret
+
+00000000008026b4 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8026b4:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8026b7:	0f b6 17             	movzbl (%rdi),%edx
+  8026ba:	84 d2                	test   %dl,%dl
+  8026bc:	74 13                	je     8026d1 <strfind+0x1d>
+  8026be:	0f be d2             	movsbl %dl,%edx
+  8026c1:	39 f2                	cmp    %esi,%edx
+  8026c3:	74 0b                	je     8026d0 <strfind+0x1c>
+  8026c5:	48 83 c0 01          	add    $0x1,%rax
+  8026c9:	0f b6 10             	movzbl (%rax),%edx
+  8026cc:	84 d2                	test   %dl,%dl
+  8026ce:	75 ee                	jne    8026be <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8026d0:	c3                   	ret
+  8026d1:	c3                   	ret
+
+00000000008026d2 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8026d2:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8026d5:	48 89 f8             	mov    %rdi,%rax
+  8026d8:	48 f7 d8             	neg    %rax
+  8026db:	83 e0 07             	and    $0x7,%eax
+  8026de:	49 89 d1             	mov    %rdx,%r9
+  8026e1:	49 29 c1             	sub    %rax,%r9
+  8026e4:	78 36                	js     80271c <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8026e6:	40 0f b6 c6          	movzbl %sil,%eax
+  8026ea:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8026f1:	01 01 01 
+  8026f4:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8026f8:	40 f6 c7 07          	test   $0x7,%dil
+  8026fc:	75 38                	jne    802736 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8026fe:	4c 89 c9             	mov    %r9,%rcx
+  802701:	48 c1 f9 03          	sar    $0x3,%rcx
+  802705:	74 0c                	je     802713 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802707:	fc                   	cld
+  802708:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80270b:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80270f:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802713:	4d 85 c9             	test   %r9,%r9
+  802716:	75 45                	jne    80275d <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802718:	4c 89 c0             	mov    %r8,%rax
+  80271b:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80271c:	48 85 d2             	test   %rdx,%rdx
+  80271f:	74 f7                	je     802718 <memset+0x46>
+  802721:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802724:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802727:	48 83 c0 01          	add    $0x1,%rax
+  80272b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80272f:	48 39 c2             	cmp    %rax,%rdx
+  802732:	75 f3                	jne    802727 <memset+0x55>
+  802734:	eb e2                	jmp    802718 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802736:	40 f6 c7 01          	test   $0x1,%dil
+  80273a:	74 06                	je     802742 <memset+0x70>
+  80273c:	88 07                	mov    %al,(%rdi)
+  80273e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802742:	40 f6 c7 02          	test   $0x2,%dil
+  802746:	74 07                	je     80274f <memset+0x7d>
+  802748:	66 89 07             	mov    %ax,(%rdi)
+  80274b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80274f:	40 f6 c7 04          	test   $0x4,%dil
+  802753:	74 a9                	je     8026fe <memset+0x2c>
+  802755:	89 07                	mov    %eax,(%rdi)
+  802757:	48 83 c7 04          	add    $0x4,%rdi
+  80275b:	eb a1                	jmp    8026fe <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80275d:	41 f6 c1 04          	test   $0x4,%r9b
+  802761:	74 06                	je     802769 <memset+0x97>
+  802763:	89 07                	mov    %eax,(%rdi)
+  802765:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802769:	41 f6 c1 02          	test   $0x2,%r9b
+  80276d:	74 07                	je     802776 <memset+0xa4>
+  80276f:	66 89 07             	mov    %ax,(%rdi)
+  802772:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802776:	41 f6 c1 01          	test   $0x1,%r9b
+  80277a:	74 9c                	je     802718 <memset+0x46>
+  80277c:	88 07                	mov    %al,(%rdi)
+  80277e:	eb 98                	jmp    802718 <memset+0x46>
+
+0000000000802780 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802780:	48 89 f8             	mov    %rdi,%rax
+  802783:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802786:	48 39 fe             	cmp    %rdi,%rsi
+  802789:	73 3b                	jae    8027c6 <memmove+0x46>
+  80278b:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80278f:	48 39 d7             	cmp    %rdx,%rdi
+  802792:	73 32                	jae    8027c6 <memmove+0x46>
+        s += n;
+        d += n;
+  802794:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802798:	48 89 d6             	mov    %rdx,%rsi
+  80279b:	48 09 fe             	or     %rdi,%rsi
+  80279e:	48 09 ce             	or     %rcx,%rsi
+  8027a1:	40 f6 c6 07          	test   $0x7,%sil
+  8027a5:	75 12                	jne    8027b9 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8027a7:	48 83 ef 08          	sub    $0x8,%rdi
+  8027ab:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8027af:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027b3:	fd                   	std
+  8027b4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8027b7:	fc                   	cld
+  8027b8:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8027b9:	48 83 ef 01          	sub    $0x1,%rdi
+  8027bd:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8027c1:	fd                   	std
+  8027c2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8027c4:	eb f1                	jmp    8027b7 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8027c6:	48 89 f2             	mov    %rsi,%rdx
+  8027c9:	48 09 c2             	or     %rax,%rdx
+  8027cc:	48 09 ca             	or     %rcx,%rdx
+  8027cf:	f6 c2 07             	test   $0x7,%dl
+  8027d2:	75 0c                	jne    8027e0 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8027d4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027d8:	48 89 c7             	mov    %rax,%rdi
+  8027db:	fc                   	cld
+  8027dc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8027df:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8027e0:	48 89 c7             	mov    %rax,%rdi
+  8027e3:	fc                   	cld
+  8027e4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8027e6:	c3                   	ret
+
+00000000008027e7 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8027e7:	55                   	push   %rbp
+  8027e8:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8027eb:	48 b8 80 27 80 00 00 	movabs $0x802780,%rax
+  8027f2:	00 00 00 
+  8027f5:	ff d0                	call   *%rax
+}
+  8027f7:	5d                   	pop    %rbp
+  8027f8:	c3                   	ret
+
+00000000008027f9 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8027f9:	55                   	push   %rbp
+  8027fa:	48 89 e5             	mov    %rsp,%rbp
+  8027fd:	41 57                	push   %r15
+  8027ff:	41 56                	push   %r14
+  802801:	41 55                	push   %r13
+  802803:	41 54                	push   %r12
+  802805:	53                   	push   %rbx
+  802806:	48 83 ec 08          	sub    $0x8,%rsp
+  80280a:	49 89 fe             	mov    %rdi,%r14
+  80280d:	49 89 f7             	mov    %rsi,%r15
+  802810:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802813:	48 89 f7             	mov    %rsi,%rdi
+  802816:	48 b8 48 25 80 00 00 	movabs $0x802548,%rax
+  80281d:	00 00 00 
+  802820:	ff d0                	call   *%rax
+  802822:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802825:	48 89 de             	mov    %rbx,%rsi
+  802828:	4c 89 f7             	mov    %r14,%rdi
+  80282b:	48 b8 63 25 80 00 00 	movabs $0x802563,%rax
+  802832:	00 00 00 
+  802835:	ff d0                	call   *%rax
+  802837:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80283a:	48 39 c3             	cmp    %rax,%rbx
+  80283d:	74 36                	je     802875 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80283f:	48 89 d8             	mov    %rbx,%rax
+  802842:	4c 29 e8             	sub    %r13,%rax
+  802845:	49 39 c4             	cmp    %rax,%r12
+  802848:	73 31                	jae    80287b <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80284a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80284f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802853:	4c 89 fe             	mov    %r15,%rsi
+  802856:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  80285d:	00 00 00 
+  802860:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802862:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802866:	48 83 c4 08          	add    $0x8,%rsp
+  80286a:	5b                   	pop    %rbx
+  80286b:	41 5c                	pop    %r12
+  80286d:	41 5d                	pop    %r13
+  80286f:	41 5e                	pop    %r14
+  802871:	41 5f                	pop    %r15
+  802873:	5d                   	pop    %rbp
+  802874:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802875:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802879:	eb eb                	jmp    802866 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80287b:	48 83 eb 01          	sub    $0x1,%rbx
+  80287f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802883:	48 89 da             	mov    %rbx,%rdx
+  802886:	4c 89 fe             	mov    %r15,%rsi
+  802889:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  802890:	00 00 00 
+  802893:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802895:	49 01 de             	add    %rbx,%r14
+  802898:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80289d:	eb c3                	jmp    802862 <strlcat+0x69>
+
+000000000080289f <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80289f:	48 85 d2             	test   %rdx,%rdx
+  8028a2:	74 2d                	je     8028d1 <memcmp+0x32>
+  8028a4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8028a9:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8028ad:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8028b2:	44 38 c1             	cmp    %r8b,%cl
+  8028b5:	75 0f                	jne    8028c6 <memcmp+0x27>
+    while (n-- > 0) {
+  8028b7:	48 83 c0 01          	add    $0x1,%rax
+  8028bb:	48 39 c2             	cmp    %rax,%rdx
+  8028be:	75 e9                	jne    8028a9 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8028c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c5:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8028c6:	0f b6 c1             	movzbl %cl,%eax
+  8028c9:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8028cd:	44 29 c0             	sub    %r8d,%eax
+  8028d0:	c3                   	ret
+    return 0;
+  8028d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028d6:	c3                   	ret
+
+00000000008028d7 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8028d7:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8028db:	48 39 c7             	cmp    %rax,%rdi
+  8028de:	73 0f                	jae    8028ef <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8028e0:	40 38 37             	cmp    %sil,(%rdi)
+  8028e3:	74 0e                	je     8028f3 <memfind+0x1c>
+    for (; src < end; src++) {
+  8028e5:	48 83 c7 01          	add    $0x1,%rdi
+  8028e9:	48 39 f8             	cmp    %rdi,%rax
+  8028ec:	75 f2                	jne    8028e0 <memfind+0x9>
+  8028ee:	c3                   	ret
+  8028ef:	48 89 f8             	mov    %rdi,%rax
+  8028f2:	c3                   	ret
+  8028f3:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8028f6:	c3                   	ret
+
+00000000008028f7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8028f7:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8028fa:	0f b6 37             	movzbl (%rdi),%esi
+  8028fd:	40 80 fe 20          	cmp    $0x20,%sil
+  802901:	74 06                	je     802909 <strtol+0x12>
+  802903:	40 80 fe 09          	cmp    $0x9,%sil
+  802907:	75 13                	jne    80291c <strtol+0x25>
+  802909:	48 83 c7 01          	add    $0x1,%rdi
+  80290d:	0f b6 37             	movzbl (%rdi),%esi
+  802910:	40 80 fe 20          	cmp    $0x20,%sil
+  802914:	74 f3                	je     802909 <strtol+0x12>
+  802916:	40 80 fe 09          	cmp    $0x9,%sil
+  80291a:	74 ed                	je     802909 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80291c:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80291f:	83 e0 fd             	and    $0xfffffffd,%eax
+  802922:	3c 01                	cmp    $0x1,%al
+  802924:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802928:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80292e:	75 0f                	jne    80293f <strtol+0x48>
+  802930:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802933:	74 14                	je     802949 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802935:	85 d2                	test   %edx,%edx
+  802937:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80293c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80293f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802944:	4c 63 ca             	movslq %edx,%r9
+  802947:	eb 36                	jmp    80297f <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802949:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80294d:	74 0f                	je     80295e <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80294f:	85 d2                	test   %edx,%edx
+  802951:	75 ec                	jne    80293f <strtol+0x48>
+        s++;
+  802953:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802957:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80295c:	eb e1                	jmp    80293f <strtol+0x48>
+        s += 2;
+  80295e:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802962:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802967:	eb d6                	jmp    80293f <strtol+0x48>
+            dig -= '0';
+  802969:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80296c:	44 0f b6 c1          	movzbl %cl,%r8d
+  802970:	41 39 d0             	cmp    %edx,%r8d
+  802973:	7d 21                	jge    802996 <strtol+0x9f>
+        val = val * base + dig;
+  802975:	49 0f af c1          	imul   %r9,%rax
+  802979:	0f b6 c9             	movzbl %cl,%ecx
+  80297c:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80297f:	48 83 c7 01          	add    $0x1,%rdi
+  802983:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802987:	80 f9 39             	cmp    $0x39,%cl
+  80298a:	76 dd                	jbe    802969 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80298c:	80 f9 7b             	cmp    $0x7b,%cl
+  80298f:	77 05                	ja     802996 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802991:	83 e9 57             	sub    $0x57,%ecx
+  802994:	eb d6                	jmp    80296c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802996:	4d 85 d2             	test   %r10,%r10
+  802999:	74 03                	je     80299e <strtol+0xa7>
+  80299b:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80299e:	48 89 c2             	mov    %rax,%rdx
+  8029a1:	48 f7 da             	neg    %rdx
+  8029a4:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8029a8:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8029ac:	c3                   	ret
+
+00000000008029ad <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8029ad:	55                   	push   %rbp
+  8029ae:	48 89 e5             	mov    %rsp,%rbp
+  8029b1:	41 54                	push   %r12
+  8029b3:	53                   	push   %rbx
+  8029b4:	48 89 fb             	mov    %rdi,%rbx
+  8029b7:	48 89 f7             	mov    %rsi,%rdi
+  8029ba:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8029bd:	48 85 f6             	test   %rsi,%rsi
+  8029c0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029c7:	00 00 00 
+  8029ca:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8029ce:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029d3:	48 b8 06 06 80 00 00 	movabs $0x800606,%rax
+  8029da:	00 00 00 
+  8029dd:	ff d0                	call   *%rax
+    if (res < 0) {
+  8029df:	85 c0                	test   %eax,%eax
+  8029e1:	78 45                	js     802a28 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8029e3:	48 85 db             	test   %rbx,%rbx
+  8029e6:	74 12                	je     8029fa <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8029e8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029ef:	00 00 00 
+  8029f2:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8029f8:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  8029fa:	4d 85 e4             	test   %r12,%r12
+  8029fd:	74 14                	je     802a13 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  8029ff:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a06:	00 00 00 
+  802a09:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802a0f:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802a13:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a1a:	00 00 00 
+  802a1d:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802a23:	5b                   	pop    %rbx
+  802a24:	41 5c                	pop    %r12
+  802a26:	5d                   	pop    %rbp
+  802a27:	c3                   	ret
+        if (from_env_store)
+  802a28:	48 85 db             	test   %rbx,%rbx
+  802a2b:	74 06                	je     802a33 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802a2d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802a33:	4d 85 e4             	test   %r12,%r12
+  802a36:	74 eb                	je     802a23 <ipc_recv+0x76>
+            *perm_store = 0;
+  802a38:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802a3f:	00 
+  802a40:	eb e1                	jmp    802a23 <ipc_recv+0x76>
+
+0000000000802a42 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802a42:	55                   	push   %rbp
+  802a43:	48 89 e5             	mov    %rsp,%rbp
+  802a46:	41 57                	push   %r15
+  802a48:	41 56                	push   %r14
+  802a4a:	41 55                	push   %r13
+  802a4c:	41 54                	push   %r12
+  802a4e:	53                   	push   %rbx
+  802a4f:	48 83 ec 18          	sub    $0x18,%rsp
+  802a53:	41 89 fd             	mov    %edi,%r13d
+  802a56:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802a59:	48 89 d3             	mov    %rdx,%rbx
+  802a5c:	49 89 cc             	mov    %rcx,%r12
+  802a5f:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a63:	48 85 d2             	test   %rdx,%rdx
+  802a66:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a6d:	00 00 00 
+  802a70:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a74:	49 be da 05 80 00 00 	movabs $0x8005da,%r14
+  802a7b:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802a7e:	49 bf 0d 02 80 00 00 	movabs $0x80020d,%r15
+  802a85:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a88:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802a8b:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802a8f:	4c 89 e1             	mov    %r12,%rcx
+  802a92:	48 89 da             	mov    %rbx,%rdx
+  802a95:	44 89 ef             	mov    %r13d,%edi
+  802a98:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802a9b:	85 c0                	test   %eax,%eax
+  802a9d:	74 34                	je     802ad3 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802a9f:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802aa2:	75 05                	jne    802aa9 <ipc_send+0x67>
+        sys_yield();
+  802aa4:	41 ff d7             	call   *%r15
+    while (true) {
+  802aa7:	eb df                	jmp    802a88 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802aa9:	48 ba ef 31 80 00 00 	movabs $0x8031ef,%rdx
+  802ab0:	00 00 00 
+  802ab3:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802ab8:	48 bf 08 32 80 00 00 	movabs $0x803208,%rdi
+  802abf:	00 00 00 
+  802ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac7:	48 b9 11 1b 80 00 00 	movabs $0x801b11,%rcx
+  802ace:	00 00 00 
+  802ad1:	ff d1                	call   *%rcx
+    }
+}
+  802ad3:	48 83 c4 18          	add    $0x18,%rsp
+  802ad7:	5b                   	pop    %rbx
+  802ad8:	41 5c                	pop    %r12
+  802ada:	41 5d                	pop    %r13
+  802adc:	41 5e                	pop    %r14
+  802ade:	41 5f                	pop    %r15
+  802ae0:	5d                   	pop    %rbp
+  802ae1:	c3                   	ret
+
+0000000000802ae2 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802ae7:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802aee:	00 00 00 
+  802af1:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802af8:	48 01 ca             	add    %rcx,%rdx
+  802afb:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802b01:	39 fa                	cmp    %edi,%edx
+  802b03:	74 12                	je     802b17 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802b05:	48 83 c0 01          	add    $0x1,%rax
+  802b09:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b0f:	75 e0                	jne    802af1 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802b11:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b16:	c3                   	ret
+            return envs[i].env_id;
+  802b17:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802b1e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b25:	00 00 00 
+  802b28:	48 01 d0             	add    %rdx,%rax
+  802b2b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b31:	c3                   	ret
+  802b32:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802b38 <__rodata_start>:
+  802b38:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  802b3d:	2c 20                	sub    $0x20,%al
+  802b3f:	77 6f                	ja     802bb0 <__rodata_start+0x78>
+  802b41:	72 6c                	jb     802baf <__rodata_start+0x77>
+  802b43:	64 0a 00             	or     %fs:(%rax),%al
+  802b46:	3c 75                	cmp    $0x75,%al
+  802b48:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b49:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b4d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b4e:	3e 00 73 79          	ds add %dh,0x79(%rbx)
+  802b52:	73 63                	jae    802bb7 <__rodata_start+0x7f>
+  802b54:	61                   	(bad)
+  802b55:	6c                   	insb   (%dx),%es:(%rdi)
+  802b56:	6c                   	insb   (%dx),%es:(%rdi)
+  802b57:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a08fd7 <__bss_end+0x72200fd7>
+  802b5d:	65 74 75             	gs je  802bd5 <__rodata_start+0x9d>
+  802b60:	72 6e                	jb     802bd0 <__rodata_start+0x98>
+  802b62:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a08fe4 <__bss_end+0x28200fe4>
+  802b69:	28 
+  802b6a:	3e 20 30             	ds and %dh,(%rax)
+  802b6d:	29 00                	sub    %eax,(%rax)
+  802b6f:	6c                   	insb   (%dx),%es:(%rdi)
+  802b70:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802b77:	61                   	(bad)
+  802b78:	6c                   	insb   (%dx),%es:(%rdi)
+  802b79:	6c                   	insb   (%dx),%es:(%rdi)
+  802b7a:	2e 63 00             	cs movsxd (%rax),%eax
+  802b7d:	0f 1f 00             	nopl   (%rax)
+  802b80:	5b                   	pop    %rbx
+  802b81:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b86:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802b89:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b8d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b8e:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802b92:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802b99:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 803604 <error_string+0x4e4>
+  802ba0:	5b                   	pop    %rbx
+  802ba1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802ba6:	20 66 74             	and    %ah,0x74(%rsi)
+  802ba9:	72 75                	jb     802c20 <devtab+0x20>
+  802bab:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bac:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802baf:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4c1a <__bss_end+0x2d2ccc1a>
+  802bb6:	20 62 61             	and    %ah,0x61(%rdx)
+  802bb9:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802bbd:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bc1:	5b                   	pop    %rbx
+  802bc2:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802bc7:	20 72 65             	and    %dh,0x65(%rdx)
+  802bca:	61                   	(bad)
+  802bcb:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4c36 <__bss_end+0x2d2ccc36>
+  802bd2:	20 62 61             	and    %ah,0x61(%rdx)
+  802bd5:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802bd9:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bdd:	5b                   	pop    %rbx
+  802bde:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802be3:	20 77 72             	and    %dh,0x72(%rdi)
+  802be6:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802bed:	2d 
+  802bee:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802bf3:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802bf6:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bfa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802c00 <devtab>:
+  802c00:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802c10:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802c20:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802c30:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802c40:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802c50:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802c60:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802c70:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802c80:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802c90:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802ca0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802cb0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802cc0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802cd0:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802ce0:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802cf0:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802d00:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802d10:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802d20:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802d30:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802d40:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802d50:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802d60:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802d70:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802d80:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802d90:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802da0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802db0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802dc0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802dd0:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802de0:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802df0:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802e00:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802e10:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802e20:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802e30:	64 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     d.operation not 
+  802e40:	70 65 72 6d 69 74 74 65 64 00 66 2e 0f 1f 84 00     permitted.f.....
+  802e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
+  802e60:	4e 1e 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     N........$......
+  802e70:	7f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  802e80:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  802e90:	8f 24 80 00 00 00 00 00 6d 1e 80 00 00 00 00 00     .$......m.......
+  802ea0:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  802eb0:	61 1e 80 00 00 00 00 00 db 1e 80 00 00 00 00 00     a...............
+  802ec0:	8f 24 80 00 00 00 00 00 61 1e 80 00 00 00 00 00     .$......a.......
+  802ed0:	a7 1e 80 00 00 00 00 00 a7 1e 80 00 00 00 00 00     ................
+  802ee0:	a7 1e 80 00 00 00 00 00 a7 1e 80 00 00 00 00 00     ................
+  802ef0:	a7 1e 80 00 00 00 00 00 a7 1e 80 00 00 00 00 00     ................
+  802f00:	a7 1e 80 00 00 00 00 00 a7 1e 80 00 00 00 00 00     ................
+  802f10:	a7 1e 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .........$......
+  802f20:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  802f30:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  802f40:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  802f50:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  802f60:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  802f70:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  802f80:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  802f90:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  802fa0:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  802fb0:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  802fc0:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  802fd0:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  802fe0:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  802ff0:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  803000:	8f 24 80 00 00 00 00 00 b2 23 80 00 00 00 00 00     .$.......#......
+  803010:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  803020:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  803030:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  803040:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  803050:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  803060:	fe 1e 80 00 00 00 00 00 cd 20 80 00 00 00 00 00     ......... ......
+  803070:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  803080:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  803090:	2d 1f 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     -........$......
+  8030a0:	8f 24 80 00 00 00 00 00 f3 1e 80 00 00 00 00 00     .$..............
+  8030b0:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  8030c0:	75 22 80 00 00 00 00 00 3f 23 80 00 00 00 00 00     u"......?#......
+  8030d0:	8f 24 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .$.......$......
+  8030e0:	c4 1f 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .........$......
+  8030f0:	a1 21 80 00 00 00 00 00 8f 24 80 00 00 00 00 00     .!.......$......
+  803100:	8f 24 80 00 00 00 00 00 b2 23 80 00 00 00 00 00     .$.......#......
+  803110:	8f 24 80 00 00 00 00 00 57 1e 80 00 00 00 00 00     .$......W.......
+
+0000000000803120 <error_string>:
+	...
+  803128:	d5 2c 80 00 00 00 00 00 e7 2c 80 00 00 00 00 00     .,.......,......
+  803138:	f7 2c 80 00 00 00 00 00 09 2d 80 00 00 00 00 00     .,.......-......
+  803148:	17 2d 80 00 00 00 00 00 2b 2d 80 00 00 00 00 00     .-......+-......
+  803158:	40 2d 80 00 00 00 00 00 53 2d 80 00 00 00 00 00     @-......S-......
+  803168:	65 2d 80 00 00 00 00 00 79 2d 80 00 00 00 00 00     e-......y-......
+  803178:	89 2d 80 00 00 00 00 00 9c 2d 80 00 00 00 00 00     .-.......-......
+  803188:	b3 2d 80 00 00 00 00 00 c9 2d 80 00 00 00 00 00     .-.......-......
+  803198:	e1 2d 80 00 00 00 00 00 f9 2d 80 00 00 00 00 00     .-.......-......
+  8031a8:	06 2e 80 00 00 00 00 00 d0 31 80 00 00 00 00 00     .........1......
+  8031b8:	1a 2e 80 00 00 00 00 00 00 00 00 00 00 00 00 00     ................
+  8031c8:	32 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     2.......file is 
+  8031d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8031e8:	75 74 61 62 6c 65 00 69 70 63 5f 73 65 6e 64 3a     utable.ipc_send:
+  8031f8:	20 66 61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00      failed to send.
+  803208:	6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00     lib/ipc.c.f.....
+  803218:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803228:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803238:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803248:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803258:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803268:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803278:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803288:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803298:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8032b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803308:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803318:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803328:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803338:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803348:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803358:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803368:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803378:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803388:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803398:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803408:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803418:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803428:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803438:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803448:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803458:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803468:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803478:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803488:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803498:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803508:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803518:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803528:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803538:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803548:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803558:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803568:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803578:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803588:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803598:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803608:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803618:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803628:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803638:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803648:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803658:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803668:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803678:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803688:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803698:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803708:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803718:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803728:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803738:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803748:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803758:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803768:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803778:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803788:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803798:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803808:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803818:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803828:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803838:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803848:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803858:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803868:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803878:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803888:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803898:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803908:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803918:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803928:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803938:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803948:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803958:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803968:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803978:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803988:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803998:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803aa8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ab8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ac8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ad8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ae8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803af8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ba8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bc8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bd8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803be8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bf8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ca8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ce8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cf8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803da8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803db8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803dc8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dd8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803de8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803df8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ea8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803eb8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ec8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ed8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ee8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ef8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fa8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fb8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fc8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fd8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fe8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ff8:	00 00 66 0f 1f 44 00 00                             ..f..D..
@@ -0,0 +1,6102 @@
+
+obj/user/cat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 a6 01 00 00       	call   8001c9 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <cat>:
+#include <inc/lib.h>
+
+char buf[8192];
+
+void
+cat(int f, char *s) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+  800036:	41 89 fd             	mov    %edi,%r13d
+  800039:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    long n;
+    int r;
+
+    while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  80003d:	49 bc 00 50 80 00 00 	movabs $0x805000,%r12
+  800044:	00 00 00 
+  800047:	49 be cb 1b 80 00 00 	movabs $0x801bcb,%r14
+  80004e:	00 00 00 
+        if ((r = write(1, buf, n)) != n)
+  800051:	49 bf fa 1c 80 00 00 	movabs $0x801cfa,%r15
+  800058:	00 00 00 
+    while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  80005b:	ba 00 20 00 00       	mov    $0x2000,%edx
+  800060:	4c 89 e6             	mov    %r12,%rsi
+  800063:	44 89 ef             	mov    %r13d,%edi
+  800066:	41 ff d6             	call   *%r14
+  800069:	48 89 c3             	mov    %rax,%rbx
+  80006c:	48 85 c0             	test   %rax,%rax
+  80006f:	7e 48                	jle    8000b9 <cat+0x94>
+        if ((r = write(1, buf, n)) != n)
+  800071:	48 89 da             	mov    %rbx,%rdx
+  800074:	4c 89 e6             	mov    %r12,%rsi
+  800077:	bf 01 00 00 00       	mov    $0x1,%edi
+  80007c:	41 ff d7             	call   *%r15
+  80007f:	48 63 d0             	movslq %eax,%rdx
+  800082:	48 39 da             	cmp    %rbx,%rdx
+  800085:	74 d4                	je     80005b <cat+0x36>
+            panic("write error copying %s: %i", s, r);
+  800087:	41 89 c0             	mov    %eax,%r8d
+  80008a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80008e:	48 ba 58 2e 80 00 00 	movabs $0x802e58,%rdx
+  800095:	00 00 00 
+  800098:	be 0c 00 00 00       	mov    $0xc,%esi
+  80009d:	48 bf 73 2e 80 00 00 	movabs $0x802e73,%rdi
+  8000a4:	00 00 00 
+  8000a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ac:	49 b9 93 02 80 00 00 	movabs $0x800293,%r9
+  8000b3:	00 00 00 
+  8000b6:	41 ff d1             	call   *%r9
+    if (n < 0)
+  8000b9:	78 0f                	js     8000ca <cat+0xa5>
+        panic("error reading %s: %i", s, (int)n);
+}
+  8000bb:	48 83 c4 18          	add    $0x18,%rsp
+  8000bf:	5b                   	pop    %rbx
+  8000c0:	41 5c                	pop    %r12
+  8000c2:	41 5d                	pop    %r13
+  8000c4:	41 5e                	pop    %r14
+  8000c6:	41 5f                	pop    %r15
+  8000c8:	5d                   	pop    %rbp
+  8000c9:	c3                   	ret
+        panic("error reading %s: %i", s, (int)n);
+  8000ca:	41 89 c0             	mov    %eax,%r8d
+  8000cd:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8000d1:	48 ba 7e 2e 80 00 00 	movabs $0x802e7e,%rdx
+  8000d8:	00 00 00 
+  8000db:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000e0:	48 bf 73 2e 80 00 00 	movabs $0x802e73,%rdi
+  8000e7:	00 00 00 
+  8000ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ef:	49 b9 93 02 80 00 00 	movabs $0x800293,%r9
+  8000f6:	00 00 00 
+  8000f9:	41 ff d1             	call   *%r9
+
+00000000008000fc <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000fc:	55                   	push   %rbp
+  8000fd:	48 89 e5             	mov    %rsp,%rbp
+  800100:	41 57                	push   %r15
+  800102:	41 56                	push   %r14
+  800104:	41 55                	push   %r13
+  800106:	41 54                	push   %r12
+  800108:	53                   	push   %rbx
+  800109:	48 83 ec 08          	sub    $0x8,%rsp
+    int f, i;
+
+    binaryname = "cat";
+  80010d:	48 b8 93 2e 80 00 00 	movabs $0x802e93,%rax
+  800114:	00 00 00 
+  800117:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80011e:	00 00 00 
+    if (argc == 1)
+  800121:	83 ff 01             	cmp    $0x1,%edi
+  800124:	74 24                	je     80014a <umain+0x4e>
+        cat(0, "<stdin>");
+    else
+        for (i = 1; i < argc; i++) {
+  800126:	7e 3d                	jle    800165 <umain+0x69>
+  800128:	4c 8d 66 08          	lea    0x8(%rsi),%r12
+  80012c:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80012f:	4c 8d 74 c6 10       	lea    0x10(%rsi,%rax,8),%r14
+            f = open(argv[i], O_RDONLY);
+  800134:	49 bd 89 21 80 00 00 	movabs $0x802189,%r13
+  80013b:	00 00 00 
+            if (f < 0)
+                printf("can't open %s: %i\n", argv[i], f);
+            else {
+                cat(f, argv[i]);
+  80013e:	49 bf 25 00 80 00 00 	movabs $0x800025,%r15
+  800145:	00 00 00 
+  800148:	eb 54                	jmp    80019e <umain+0xa2>
+        cat(0, "<stdin>");
+  80014a:	48 be 97 2e 80 00 00 	movabs $0x802e97,%rsi
+  800151:	00 00 00 
+  800154:	bf 00 00 00 00       	mov    $0x0,%edi
+  800159:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800160:	00 00 00 
+  800163:	ff d0                	call   *%rax
+                close(f);
+            }
+        }
+}
+  800165:	48 83 c4 08          	add    $0x8,%rsp
+  800169:	5b                   	pop    %rbx
+  80016a:	41 5c                	pop    %r12
+  80016c:	41 5d                	pop    %r13
+  80016e:	41 5e                	pop    %r14
+  800170:	41 5f                	pop    %r15
+  800172:	5d                   	pop    %rbp
+  800173:	c3                   	ret
+                printf("can't open %s: %i\n", argv[i], f);
+  800174:	49 8b 34 24          	mov    (%r12),%rsi
+  800178:	89 c2                	mov    %eax,%edx
+  80017a:	48 bf 9f 2e 80 00 00 	movabs $0x802e9f,%rdi
+  800181:	00 00 00 
+  800184:	b8 00 00 00 00       	mov    $0x0,%eax
+  800189:	48 b9 b8 23 80 00 00 	movabs $0x8023b8,%rcx
+  800190:	00 00 00 
+  800193:	ff d1                	call   *%rcx
+        for (i = 1; i < argc; i++) {
+  800195:	49 83 c4 08          	add    $0x8,%r12
+  800199:	4d 39 f4             	cmp    %r14,%r12
+  80019c:	74 c7                	je     800165 <umain+0x69>
+            f = open(argv[i], O_RDONLY);
+  80019e:	49 8b 3c 24          	mov    (%r12),%rdi
+  8001a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a7:	41 ff d5             	call   *%r13
+  8001aa:	89 c3                	mov    %eax,%ebx
+            if (f < 0)
+  8001ac:	85 c0                	test   %eax,%eax
+  8001ae:	78 c4                	js     800174 <umain+0x78>
+                cat(f, argv[i]);
+  8001b0:	49 8b 34 24          	mov    (%r12),%rsi
+  8001b4:	89 c7                	mov    %eax,%edi
+  8001b6:	41 ff d7             	call   *%r15
+                close(f);
+  8001b9:	89 df                	mov    %ebx,%edi
+  8001bb:	48 b8 4d 1a 80 00 00 	movabs $0x801a4d,%rax
+  8001c2:	00 00 00 
+  8001c5:	ff d0                	call   *%rax
+  8001c7:	eb cc                	jmp    800195 <umain+0x99>
+
+00000000008001c9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001c9:	55                   	push   %rbp
+  8001ca:	48 89 e5             	mov    %rsp,%rbp
+  8001cd:	41 56                	push   %r14
+  8001cf:	41 55                	push   %r13
+  8001d1:	41 54                	push   %r12
+  8001d3:	53                   	push   %rbx
+  8001d4:	41 89 fd             	mov    %edi,%r13d
+  8001d7:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001da:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8001e1:	00 00 00 
+  8001e4:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8001eb:	00 00 00 
+  8001ee:	48 39 c2             	cmp    %rax,%rdx
+  8001f1:	73 17                	jae    80020a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001f3:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001f6:	49 89 c4             	mov    %rax,%r12
+  8001f9:	48 83 c3 08          	add    $0x8,%rbx
+  8001fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800202:	ff 53 f8             	call   *-0x8(%rbx)
+  800205:	4c 39 e3             	cmp    %r12,%rbx
+  800208:	72 ef                	jb     8001f9 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  80020a:	48 b8 f8 11 80 00 00 	movabs $0x8011f8,%rax
+  800211:	00 00 00 
+  800214:	ff d0                	call   *%rax
+  800216:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800219:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800220:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800227:	00 00 00 
+  80022a:	48 01 d0             	add    %rdx,%rax
+  80022d:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800234:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800237:	45 85 ed             	test   %r13d,%r13d
+  80023a:	7e 0d                	jle    800249 <libmain+0x80>
+  80023c:	49 8b 06             	mov    (%r14),%rax
+  80023f:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800246:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800249:	4c 89 f6             	mov    %r14,%rsi
+  80024c:	44 89 ef             	mov    %r13d,%edi
+  80024f:	48 b8 fc 00 80 00 00 	movabs $0x8000fc,%rax
+  800256:	00 00 00 
+  800259:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80025b:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  800262:	00 00 00 
+  800265:	ff d0                	call   *%rax
+#endif
+}
+  800267:	5b                   	pop    %rbx
+  800268:	41 5c                	pop    %r12
+  80026a:	41 5d                	pop    %r13
+  80026c:	41 5e                	pop    %r14
+  80026e:	5d                   	pop    %rbp
+  80026f:	c3                   	ret
+
+0000000000800270 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800270:	55                   	push   %rbp
+  800271:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800274:	48 b8 80 1a 80 00 00 	movabs $0x801a80,%rax
+  80027b:	00 00 00 
+  80027e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800280:	bf 00 00 00 00       	mov    $0x0,%edi
+  800285:	48 b8 8d 11 80 00 00 	movabs $0x80118d,%rax
+  80028c:	00 00 00 
+  80028f:	ff d0                	call   *%rax
+}
+  800291:	5d                   	pop    %rbp
+  800292:	c3                   	ret
+
+0000000000800293 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800293:	55                   	push   %rbp
+  800294:	48 89 e5             	mov    %rsp,%rbp
+  800297:	41 56                	push   %r14
+  800299:	41 55                	push   %r13
+  80029b:	41 54                	push   %r12
+  80029d:	53                   	push   %rbx
+  80029e:	48 83 ec 50          	sub    $0x50,%rsp
+  8002a2:	49 89 fc             	mov    %rdi,%r12
+  8002a5:	41 89 f5             	mov    %esi,%r13d
+  8002a8:	48 89 d3             	mov    %rdx,%rbx
+  8002ab:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002af:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002b3:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002b7:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8002be:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002c2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002c6:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002ca:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002ce:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8002d5:	00 00 00 
+  8002d8:	4c 8b 30             	mov    (%rax),%r14
+  8002db:	48 b8 f8 11 80 00 00 	movabs $0x8011f8,%rax
+  8002e2:	00 00 00 
+  8002e5:	ff d0                	call   *%rax
+  8002e7:	89 c6                	mov    %eax,%esi
+  8002e9:	45 89 e8             	mov    %r13d,%r8d
+  8002ec:	4c 89 e1             	mov    %r12,%rcx
+  8002ef:	4c 89 f2             	mov    %r14,%rdx
+  8002f2:	48 bf c0 2e 80 00 00 	movabs $0x802ec0,%rdi
+  8002f9:	00 00 00 
+  8002fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800301:	49 bc e3 03 80 00 00 	movabs $0x8003e3,%r12
+  800308:	00 00 00 
+  80030b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80030e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800312:	48 89 df             	mov    %rbx,%rdi
+  800315:	48 b8 7f 03 80 00 00 	movabs $0x80037f,%rax
+  80031c:	00 00 00 
+  80031f:	ff d0                	call   *%rax
+    cprintf("\n");
+  800321:	48 bf bb 34 80 00 00 	movabs $0x8034bb,%rdi
+  800328:	00 00 00 
+  80032b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800330:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800333:	cc                   	int3
+  800334:	eb fd                	jmp    800333 <_panic+0xa0>
+
+0000000000800336 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800336:	55                   	push   %rbp
+  800337:	48 89 e5             	mov    %rsp,%rbp
+  80033a:	53                   	push   %rbx
+  80033b:	48 83 ec 08          	sub    $0x8,%rsp
+  80033f:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800342:	8b 06                	mov    (%rsi),%eax
+  800344:	8d 50 01             	lea    0x1(%rax),%edx
+  800347:	89 16                	mov    %edx,(%rsi)
+  800349:	48 98                	cltq
+  80034b:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800350:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800356:	74 0a                	je     800362 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800358:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80035c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800360:	c9                   	leave
+  800361:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800362:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800366:	be ff 00 00 00       	mov    $0xff,%esi
+  80036b:	48 b8 2f 11 80 00 00 	movabs $0x80112f,%rax
+  800372:	00 00 00 
+  800375:	ff d0                	call   *%rax
+        state->offset = 0;
+  800377:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80037d:	eb d9                	jmp    800358 <putch+0x22>
+
+000000000080037f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80037f:	55                   	push   %rbp
+  800380:	48 89 e5             	mov    %rsp,%rbp
+  800383:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80038a:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80038d:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800394:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80039e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003a1:	48 89 f1             	mov    %rsi,%rcx
+  8003a4:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8003ab:	48 bf 36 03 80 00 00 	movabs $0x800336,%rdi
+  8003b2:	00 00 00 
+  8003b5:	48 b8 33 05 80 00 00 	movabs $0x800533,%rax
+  8003bc:	00 00 00 
+  8003bf:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003c1:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003c8:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003cf:	48 b8 2f 11 80 00 00 	movabs $0x80112f,%rax
+  8003d6:	00 00 00 
+  8003d9:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003db:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003e1:	c9                   	leave
+  8003e2:	c3                   	ret
+
+00000000008003e3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003e3:	55                   	push   %rbp
+  8003e4:	48 89 e5             	mov    %rsp,%rbp
+  8003e7:	48 83 ec 50          	sub    $0x50,%rsp
+  8003eb:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003ef:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003f3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003f7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003fb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003ff:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800406:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80040a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80040e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800412:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800416:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80041a:	48 b8 7f 03 80 00 00 	movabs $0x80037f,%rax
+  800421:	00 00 00 
+  800424:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800426:	c9                   	leave
+  800427:	c3                   	ret
+
+0000000000800428 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800428:	55                   	push   %rbp
+  800429:	48 89 e5             	mov    %rsp,%rbp
+  80042c:	41 57                	push   %r15
+  80042e:	41 56                	push   %r14
+  800430:	41 55                	push   %r13
+  800432:	41 54                	push   %r12
+  800434:	53                   	push   %rbx
+  800435:	48 83 ec 18          	sub    $0x18,%rsp
+  800439:	49 89 fc             	mov    %rdi,%r12
+  80043c:	49 89 f5             	mov    %rsi,%r13
+  80043f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800443:	8b 45 10             	mov    0x10(%rbp),%eax
+  800446:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800449:	41 89 cf             	mov    %ecx,%r15d
+  80044c:	4c 39 fa             	cmp    %r15,%rdx
+  80044f:	73 5b                	jae    8004ac <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800451:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800455:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800459:	85 db                	test   %ebx,%ebx
+  80045b:	7e 0e                	jle    80046b <print_num+0x43>
+            putch(padc, put_arg);
+  80045d:	4c 89 ee             	mov    %r13,%rsi
+  800460:	44 89 f7             	mov    %r14d,%edi
+  800463:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800466:	83 eb 01             	sub    $0x1,%ebx
+  800469:	75 f2                	jne    80045d <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80046b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80046f:	48 b9 f4 2e 80 00 00 	movabs $0x802ef4,%rcx
+  800476:	00 00 00 
+  800479:	48 b8 e3 2e 80 00 00 	movabs $0x802ee3,%rax
+  800480:	00 00 00 
+  800483:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800487:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80048b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800490:	49 f7 f7             	div    %r15
+  800493:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800497:	4c 89 ee             	mov    %r13,%rsi
+  80049a:	41 ff d4             	call   *%r12
+}
+  80049d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004a1:	5b                   	pop    %rbx
+  8004a2:	41 5c                	pop    %r12
+  8004a4:	41 5d                	pop    %r13
+  8004a6:	41 5e                	pop    %r14
+  8004a8:	41 5f                	pop    %r15
+  8004aa:	5d                   	pop    %rbp
+  8004ab:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8004ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004b5:	49 f7 f7             	div    %r15
+  8004b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8004bc:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004c0:	52                   	push   %rdx
+  8004c1:	45 0f be c9          	movsbl %r9b,%r9d
+  8004c5:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004c9:	48 89 c2             	mov    %rax,%rdx
+  8004cc:	48 b8 28 04 80 00 00 	movabs $0x800428,%rax
+  8004d3:	00 00 00 
+  8004d6:	ff d0                	call   *%rax
+  8004d8:	48 83 c4 10          	add    $0x10,%rsp
+  8004dc:	eb 8d                	jmp    80046b <print_num+0x43>
+
+00000000008004de <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004de:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004e2:	48 8b 06             	mov    (%rsi),%rax
+  8004e5:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004e9:	73 0a                	jae    8004f5 <sprintputch+0x17>
+        *state->start++ = ch;
+  8004eb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004ef:	48 89 16             	mov    %rdx,(%rsi)
+  8004f2:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004f5:	c3                   	ret
+
+00000000008004f6 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004f6:	55                   	push   %rbp
+  8004f7:	48 89 e5             	mov    %rsp,%rbp
+  8004fa:	48 83 ec 50          	sub    $0x50,%rsp
+  8004fe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800502:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800506:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80050a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800511:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800515:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800519:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80051d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800521:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800525:	48 b8 33 05 80 00 00 	movabs $0x800533,%rax
+  80052c:	00 00 00 
+  80052f:	ff d0                	call   *%rax
+}
+  800531:	c9                   	leave
+  800532:	c3                   	ret
+
+0000000000800533 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800533:	55                   	push   %rbp
+  800534:	48 89 e5             	mov    %rsp,%rbp
+  800537:	41 57                	push   %r15
+  800539:	41 56                	push   %r14
+  80053b:	41 55                	push   %r13
+  80053d:	41 54                	push   %r12
+  80053f:	53                   	push   %rbx
+  800540:	48 83 ec 38          	sub    $0x38,%rsp
+  800544:	49 89 fe             	mov    %rdi,%r14
+  800547:	49 89 f5             	mov    %rsi,%r13
+  80054a:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80054d:	48 8b 01             	mov    (%rcx),%rax
+  800550:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800554:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800558:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80055c:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800560:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800564:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800568:	0f b6 3b             	movzbl (%rbx),%edi
+  80056b:	40 80 ff 25          	cmp    $0x25,%dil
+  80056f:	74 18                	je     800589 <vprintfmt+0x56>
+            if (!ch) return;
+  800571:	40 84 ff             	test   %dil,%dil
+  800574:	0f 84 b1 06 00 00    	je     800c2b <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80057a:	40 0f b6 ff          	movzbl %dil,%edi
+  80057e:	4c 89 ee             	mov    %r13,%rsi
+  800581:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800584:	4c 89 e3             	mov    %r12,%rbx
+  800587:	eb db                	jmp    800564 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800589:	be 00 00 00 00       	mov    $0x0,%esi
+  80058e:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800592:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800597:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80059d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005a4:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005a8:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005ad:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005b2:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005b5:	83 e8 23             	sub    $0x23,%eax
+  8005b8:	3c 57                	cmp    $0x57,%al
+  8005ba:	0f 87 51 06 00 00    	ja     800c11 <vprintfmt+0x6de>
+  8005c0:	0f b6 c0             	movzbl %al,%eax
+  8005c3:	48 b9 a0 30 80 00 00 	movabs $0x8030a0,%rcx
+  8005ca:	00 00 00 
+  8005cd:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005d0:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005d3:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005d7:	eb cf                	jmp    8005a8 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005d9:	49 89 dc             	mov    %rbx,%r12
+  8005dc:	be 01 00 00 00       	mov    $0x1,%esi
+  8005e1:	eb c5                	jmp    8005a8 <vprintfmt+0x75>
+            padc = ch;
+  8005e3:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005e7:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005ea:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005ed:	eb b9                	jmp    8005a8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8005f5:	77 24                	ja     80061b <vprintfmt+0xe8>
+  8005f7:	89 c1                	mov    %eax,%ecx
+  8005f9:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005fd:	83 c0 08             	add    $0x8,%eax
+  800600:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800603:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800606:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800609:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80060d:	79 99                	jns    8005a8 <vprintfmt+0x75>
+                width = precision;
+  80060f:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800613:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800619:	eb 8d                	jmp    8005a8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80061b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80061f:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800623:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800627:	eb da                	jmp    800603 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800629:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80062e:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800632:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800638:	3c 39                	cmp    $0x39,%al
+  80063a:	77 1c                	ja     800658 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80063c:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800640:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800644:	0f b6 c0             	movzbl %al,%eax
+  800647:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80064c:	0f b6 03             	movzbl (%rbx),%eax
+  80064f:	3c 39                	cmp    $0x39,%al
+  800651:	76 e9                	jbe    80063c <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800653:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800656:	eb b1                	jmp    800609 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800658:	49 89 dc             	mov    %rbx,%r12
+  80065b:	eb ac                	jmp    800609 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80065d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800660:	85 c9                	test   %ecx,%ecx
+  800662:	b8 00 00 00 00       	mov    $0x0,%eax
+  800667:	0f 49 c1             	cmovns %ecx,%eax
+  80066a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80066d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800670:	e9 33 ff ff ff       	jmp    8005a8 <vprintfmt+0x75>
+            lflag++;
+  800675:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800678:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80067b:	e9 28 ff ff ff       	jmp    8005a8 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800680:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800683:	83 f8 2f             	cmp    $0x2f,%eax
+  800686:	77 19                	ja     8006a1 <vprintfmt+0x16e>
+  800688:	89 c2                	mov    %eax,%edx
+  80068a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80068e:	83 c0 08             	add    $0x8,%eax
+  800691:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800694:	8b 3a                	mov    (%rdx),%edi
+  800696:	4c 89 ee             	mov    %r13,%rsi
+  800699:	41 ff d6             	call   *%r14
+            break;
+  80069c:	e9 c3 fe ff ff       	jmp    800564 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ad:	eb e5                	jmp    800694 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b5:	77 5a                	ja     800711 <vprintfmt+0x1de>
+  8006b7:	89 c2                	mov    %eax,%edx
+  8006b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006bd:	83 c0 08             	add    $0x8,%eax
+  8006c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006c3:	8b 02                	mov    (%rdx),%eax
+  8006c5:	89 c1                	mov    %eax,%ecx
+  8006c7:	f7 d9                	neg    %ecx
+  8006c9:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006cc:	83 f9 15             	cmp    $0x15,%ecx
+  8006cf:	7f 4e                	jg     80071f <vprintfmt+0x1ec>
+  8006d1:	48 63 c1             	movslq %ecx,%rax
+  8006d4:	48 ba 60 33 80 00 00 	movabs $0x803360,%rdx
+  8006db:	00 00 00 
+  8006de:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006e2:	48 85 c0             	test   %rax,%rax
+  8006e5:	74 38                	je     80071f <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006e7:	48 89 c1             	mov    %rax,%rcx
+  8006ea:	48 ba 19 35 80 00 00 	movabs $0x803519,%rdx
+  8006f1:	00 00 00 
+  8006f4:	4c 89 ee             	mov    %r13,%rsi
+  8006f7:	4c 89 f7             	mov    %r14,%rdi
+  8006fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ff:	49 b8 f6 04 80 00 00 	movabs $0x8004f6,%r8
+  800706:	00 00 00 
+  800709:	41 ff d0             	call   *%r8
+  80070c:	e9 53 fe ff ff       	jmp    800564 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800711:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800715:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800719:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80071d:	eb a4                	jmp    8006c3 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80071f:	48 ba 0c 2f 80 00 00 	movabs $0x802f0c,%rdx
+  800726:	00 00 00 
+  800729:	4c 89 ee             	mov    %r13,%rsi
+  80072c:	4c 89 f7             	mov    %r14,%rdi
+  80072f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800734:	49 b8 f6 04 80 00 00 	movabs $0x8004f6,%r8
+  80073b:	00 00 00 
+  80073e:	41 ff d0             	call   *%r8
+  800741:	e9 1e fe ff ff       	jmp    800564 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800746:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800749:	83 f8 2f             	cmp    $0x2f,%eax
+  80074c:	77 6c                	ja     8007ba <vprintfmt+0x287>
+  80074e:	89 c2                	mov    %eax,%edx
+  800750:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800754:	83 c0 08             	add    $0x8,%eax
+  800757:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80075a:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80075d:	48 85 d2             	test   %rdx,%rdx
+  800760:	48 b8 05 2f 80 00 00 	movabs $0x802f05,%rax
+  800767:	00 00 00 
+  80076a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80076e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800772:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800776:	7e 06                	jle    80077e <vprintfmt+0x24b>
+  800778:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80077c:	75 4a                	jne    8007c8 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80077e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800782:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800786:	0f b6 00             	movzbl (%rax),%eax
+  800789:	84 c0                	test   %al,%al
+  80078b:	0f 85 9a 00 00 00    	jne    80082b <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800791:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800794:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800798:	85 c0                	test   %eax,%eax
+  80079a:	0f 8e c4 fd ff ff    	jle    800564 <vprintfmt+0x31>
+  8007a0:	4c 89 ee             	mov    %r13,%rsi
+  8007a3:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007a8:	41 ff d6             	call   *%r14
+  8007ab:	41 83 ec 01          	sub    $0x1,%r12d
+  8007af:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007b3:	75 eb                	jne    8007a0 <vprintfmt+0x26d>
+  8007b5:	e9 aa fd ff ff       	jmp    800564 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c6:	eb 92                	jmp    80075a <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007c8:	49 63 f7             	movslq %r15d,%rsi
+  8007cb:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007cf:	48 b8 e5 0c 80 00 00 	movabs $0x800ce5,%rax
+  8007d6:	00 00 00 
+  8007d9:	ff d0                	call   *%rax
+  8007db:	48 89 c2             	mov    %rax,%rdx
+  8007de:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007e1:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007e3:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007e6:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007e9:	85 c0                	test   %eax,%eax
+  8007eb:	7e 91                	jle    80077e <vprintfmt+0x24b>
+  8007ed:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007f2:	4c 89 ee             	mov    %r13,%rsi
+  8007f5:	44 89 e7             	mov    %r12d,%edi
+  8007f8:	41 ff d6             	call   *%r14
+  8007fb:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007ff:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800802:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800805:	75 eb                	jne    8007f2 <vprintfmt+0x2bf>
+  800807:	e9 72 ff ff ff       	jmp    80077e <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80080c:	0f b6 f8             	movzbl %al,%edi
+  80080f:	4c 89 ee             	mov    %r13,%rsi
+  800812:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800815:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800819:	49 83 c4 01          	add    $0x1,%r12
+  80081d:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800823:	84 c0                	test   %al,%al
+  800825:	0f 84 66 ff ff ff    	je     800791 <vprintfmt+0x25e>
+  80082b:	45 85 ff             	test   %r15d,%r15d
+  80082e:	78 0a                	js     80083a <vprintfmt+0x307>
+  800830:	41 83 ef 01          	sub    $0x1,%r15d
+  800834:	0f 88 57 ff ff ff    	js     800791 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80083a:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80083e:	74 cc                	je     80080c <vprintfmt+0x2d9>
+  800840:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800843:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800848:	80 fa 5e             	cmp    $0x5e,%dl
+  80084b:	77 c2                	ja     80080f <vprintfmt+0x2dc>
+  80084d:	eb bd                	jmp    80080c <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80084f:	40 84 f6             	test   %sil,%sil
+  800852:	75 26                	jne    80087a <vprintfmt+0x347>
+    switch (lflag) {
+  800854:	85 d2                	test   %edx,%edx
+  800856:	74 59                	je     8008b1 <vprintfmt+0x37e>
+  800858:	83 fa 01             	cmp    $0x1,%edx
+  80085b:	74 7b                	je     8008d8 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80085d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800860:	83 f8 2f             	cmp    $0x2f,%eax
+  800863:	0f 87 96 00 00 00    	ja     8008ff <vprintfmt+0x3cc>
+  800869:	89 c2                	mov    %eax,%edx
+  80086b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086f:	83 c0 08             	add    $0x8,%eax
+  800872:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800875:	4c 8b 22             	mov    (%rdx),%r12
+  800878:	eb 17                	jmp    800891 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80087a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087d:	83 f8 2f             	cmp    $0x2f,%eax
+  800880:	77 21                	ja     8008a3 <vprintfmt+0x370>
+  800882:	89 c2                	mov    %eax,%edx
+  800884:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800888:	83 c0 08             	add    $0x8,%eax
+  80088b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800891:	4d 85 e4             	test   %r12,%r12
+  800894:	78 7a                	js     800910 <vprintfmt+0x3dd>
+            num = i;
+  800896:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800899:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80089e:	e9 50 02 00 00       	jmp    800af3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008af:	eb dd                	jmp    80088e <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8008b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b7:	77 11                	ja     8008ca <vprintfmt+0x397>
+  8008b9:	89 c2                	mov    %eax,%edx
+  8008bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bf:	83 c0 08             	add    $0x8,%eax
+  8008c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c5:	4c 63 22             	movslq (%rdx),%r12
+  8008c8:	eb c7                	jmp    800891 <vprintfmt+0x35e>
+  8008ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d6:	eb ed                	jmp    8008c5 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008db:	83 f8 2f             	cmp    $0x2f,%eax
+  8008de:	77 11                	ja     8008f1 <vprintfmt+0x3be>
+  8008e0:	89 c2                	mov    %eax,%edx
+  8008e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e6:	83 c0 08             	add    $0x8,%eax
+  8008e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ec:	4c 8b 22             	mov    (%rdx),%r12
+  8008ef:	eb a0                	jmp    800891 <vprintfmt+0x35e>
+  8008f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fd:	eb ed                	jmp    8008ec <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8008ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800903:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800907:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80090b:	e9 65 ff ff ff       	jmp    800875 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800910:	4c 89 ee             	mov    %r13,%rsi
+  800913:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800918:	41 ff d6             	call   *%r14
+                i = -i;
+  80091b:	49 f7 dc             	neg    %r12
+  80091e:	e9 73 ff ff ff       	jmp    800896 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800923:	40 84 f6             	test   %sil,%sil
+  800926:	75 32                	jne    80095a <vprintfmt+0x427>
+    switch (lflag) {
+  800928:	85 d2                	test   %edx,%edx
+  80092a:	74 5d                	je     800989 <vprintfmt+0x456>
+  80092c:	83 fa 01             	cmp    $0x1,%edx
+  80092f:	0f 84 82 00 00 00    	je     8009b7 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800935:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800938:	83 f8 2f             	cmp    $0x2f,%eax
+  80093b:	0f 87 a5 00 00 00    	ja     8009e6 <vprintfmt+0x4b3>
+  800941:	89 c2                	mov    %eax,%edx
+  800943:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800947:	83 c0 08             	add    $0x8,%eax
+  80094a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800950:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800955:	e9 99 01 00 00       	jmp    800af3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80095a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095d:	83 f8 2f             	cmp    $0x2f,%eax
+  800960:	77 19                	ja     80097b <vprintfmt+0x448>
+  800962:	89 c2                	mov    %eax,%edx
+  800964:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800968:	83 c0 08             	add    $0x8,%eax
+  80096b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800971:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800976:	e9 78 01 00 00       	jmp    800af3 <vprintfmt+0x5c0>
+  80097b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800983:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800987:	eb e5                	jmp    80096e <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800989:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098c:	83 f8 2f             	cmp    $0x2f,%eax
+  80098f:	77 18                	ja     8009a9 <vprintfmt+0x476>
+  800991:	89 c2                	mov    %eax,%edx
+  800993:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800997:	83 c0 08             	add    $0x8,%eax
+  80099a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80099f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8009a4:	e9 4a 01 00 00       	jmp    800af3 <vprintfmt+0x5c0>
+  8009a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b5:	eb e6                	jmp    80099d <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8009b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8009bd:	77 19                	ja     8009d8 <vprintfmt+0x4a5>
+  8009bf:	89 c2                	mov    %eax,%edx
+  8009c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c5:	83 c0 08             	add    $0x8,%eax
+  8009c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009cb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009ce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009d3:	e9 1b 01 00 00       	jmp    800af3 <vprintfmt+0x5c0>
+  8009d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e4:	eb e5                	jmp    8009cb <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8009e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f2:	e9 56 ff ff ff       	jmp    80094d <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f7:	40 84 f6             	test   %sil,%sil
+  8009fa:	75 2e                	jne    800a2a <vprintfmt+0x4f7>
+    switch (lflag) {
+  8009fc:	85 d2                	test   %edx,%edx
+  8009fe:	74 59                	je     800a59 <vprintfmt+0x526>
+  800a00:	83 fa 01             	cmp    $0x1,%edx
+  800a03:	74 7f                	je     800a84 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a08:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0b:	0f 87 9f 00 00 00    	ja     800ab0 <vprintfmt+0x57d>
+  800a11:	89 c2                	mov    %eax,%edx
+  800a13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a17:	83 c0 08             	add    $0x8,%eax
+  800a1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a1d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a20:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a25:	e9 c9 00 00 00       	jmp    800af3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a30:	77 19                	ja     800a4b <vprintfmt+0x518>
+  800a32:	89 c2                	mov    %eax,%edx
+  800a34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a38:	83 c0 08             	add    $0x8,%eax
+  800a3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a41:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a46:	e9 a8 00 00 00       	jmp    800af3 <vprintfmt+0x5c0>
+  800a4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a57:	eb e5                	jmp    800a3e <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5f:	77 15                	ja     800a76 <vprintfmt+0x543>
+  800a61:	89 c2                	mov    %eax,%edx
+  800a63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a67:	83 c0 08             	add    $0x8,%eax
+  800a6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a6d:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a6f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a74:	eb 7d                	jmp    800af3 <vprintfmt+0x5c0>
+  800a76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a82:	eb e9                	jmp    800a6d <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a87:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8a:	77 16                	ja     800aa2 <vprintfmt+0x56f>
+  800a8c:	89 c2                	mov    %eax,%edx
+  800a8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a92:	83 c0 08             	add    $0x8,%eax
+  800a95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a98:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a9b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800aa0:	eb 51                	jmp    800af3 <vprintfmt+0x5c0>
+  800aa2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aaa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aae:	eb e8                	jmp    800a98 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800ab0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abc:	e9 5c ff ff ff       	jmp    800a1d <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800ac1:	4c 89 ee             	mov    %r13,%rsi
+  800ac4:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ac9:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800acc:	4c 89 ee             	mov    %r13,%rsi
+  800acf:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ad4:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800ad7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ada:	83 f8 2f             	cmp    $0x2f,%eax
+  800add:	77 47                	ja     800b26 <vprintfmt+0x5f3>
+  800adf:	89 c2                	mov    %eax,%edx
+  800ae1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae5:	83 c0 08             	add    $0x8,%eax
+  800ae8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aeb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aee:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800af3:	48 83 ec 08          	sub    $0x8,%rsp
+  800af7:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800afb:	0f 94 c0             	sete   %al
+  800afe:	0f b6 c0             	movzbl %al,%eax
+  800b01:	50                   	push   %rax
+  800b02:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b07:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b0b:	4c 89 ee             	mov    %r13,%rsi
+  800b0e:	4c 89 f7             	mov    %r14,%rdi
+  800b11:	48 b8 28 04 80 00 00 	movabs $0x800428,%rax
+  800b18:	00 00 00 
+  800b1b:	ff d0                	call   *%rax
+            break;
+  800b1d:	48 83 c4 10          	add    $0x10,%rsp
+  800b21:	e9 3e fa ff ff       	jmp    800564 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b32:	eb b7                	jmp    800aeb <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b34:	40 84 f6             	test   %sil,%sil
+  800b37:	75 2b                	jne    800b64 <vprintfmt+0x631>
+    switch (lflag) {
+  800b39:	85 d2                	test   %edx,%edx
+  800b3b:	74 56                	je     800b93 <vprintfmt+0x660>
+  800b3d:	83 fa 01             	cmp    $0x1,%edx
+  800b40:	74 7f                	je     800bc1 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b42:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b45:	83 f8 2f             	cmp    $0x2f,%eax
+  800b48:	0f 87 a2 00 00 00    	ja     800bf0 <vprintfmt+0x6bd>
+  800b4e:	89 c2                	mov    %eax,%edx
+  800b50:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b54:	83 c0 08             	add    $0x8,%eax
+  800b57:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b5a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b5d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b62:	eb 8f                	jmp    800af3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b67:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6a:	77 19                	ja     800b85 <vprintfmt+0x652>
+  800b6c:	89 c2                	mov    %eax,%edx
+  800b6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b72:	83 c0 08             	add    $0x8,%eax
+  800b75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b78:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b7b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b80:	e9 6e ff ff ff       	jmp    800af3 <vprintfmt+0x5c0>
+  800b85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b91:	eb e5                	jmp    800b78 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b93:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b96:	83 f8 2f             	cmp    $0x2f,%eax
+  800b99:	77 18                	ja     800bb3 <vprintfmt+0x680>
+  800b9b:	89 c2                	mov    %eax,%edx
+  800b9d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba1:	83 c0 08             	add    $0x8,%eax
+  800ba4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba7:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800ba9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800bae:	e9 40 ff ff ff       	jmp    800af3 <vprintfmt+0x5c0>
+  800bb3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bbb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbf:	eb e6                	jmp    800ba7 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800bc1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc4:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc7:	77 19                	ja     800be2 <vprintfmt+0x6af>
+  800bc9:	89 c2                	mov    %eax,%edx
+  800bcb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bcf:	83 c0 08             	add    $0x8,%eax
+  800bd2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bd8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800bdd:	e9 11 ff ff ff       	jmp    800af3 <vprintfmt+0x5c0>
+  800be2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bee:	eb e5                	jmp    800bd5 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800bf0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bfc:	e9 59 ff ff ff       	jmp    800b5a <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c01:	4c 89 ee             	mov    %r13,%rsi
+  800c04:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c09:	41 ff d6             	call   *%r14
+            break;
+  800c0c:	e9 53 f9 ff ff       	jmp    800564 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c11:	4c 89 ee             	mov    %r13,%rsi
+  800c14:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c19:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c1c:	48 83 eb 01          	sub    $0x1,%rbx
+  800c20:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c24:	75 f6                	jne    800c1c <vprintfmt+0x6e9>
+  800c26:	e9 39 f9 ff ff       	jmp    800564 <vprintfmt+0x31>
+}
+  800c2b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c2f:	5b                   	pop    %rbx
+  800c30:	41 5c                	pop    %r12
+  800c32:	41 5d                	pop    %r13
+  800c34:	41 5e                	pop    %r14
+  800c36:	41 5f                	pop    %r15
+  800c38:	5d                   	pop    %rbp
+  800c39:	c3                   	ret
+
+0000000000800c3a <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c3a:	55                   	push   %rbp
+  800c3b:	48 89 e5             	mov    %rsp,%rbp
+  800c3e:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c42:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c46:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c4b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c4f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c56:	48 85 ff             	test   %rdi,%rdi
+  800c59:	74 2b                	je     800c86 <vsnprintf+0x4c>
+  800c5b:	48 85 f6             	test   %rsi,%rsi
+  800c5e:	74 26                	je     800c86 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c60:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c64:	48 bf de 04 80 00 00 	movabs $0x8004de,%rdi
+  800c6b:	00 00 00 
+  800c6e:	48 b8 33 05 80 00 00 	movabs $0x800533,%rax
+  800c75:	00 00 00 
+  800c78:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c7e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c81:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c84:	c9                   	leave
+  800c85:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c8b:	eb f7                	jmp    800c84 <vsnprintf+0x4a>
+
+0000000000800c8d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c8d:	55                   	push   %rbp
+  800c8e:	48 89 e5             	mov    %rsp,%rbp
+  800c91:	48 83 ec 50          	sub    $0x50,%rsp
+  800c95:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c99:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c9d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ca1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ca8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cb4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800cb8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800cbc:	48 b8 3a 0c 80 00 00 	movabs $0x800c3a,%rax
+  800cc3:	00 00 00 
+  800cc6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800cc8:	c9                   	leave
+  800cc9:	c3                   	ret
+
+0000000000800cca <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800cca:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ccd:	74 10                	je     800cdf <strlen+0x15>
+    size_t n = 0;
+  800ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800cd4:	48 83 c0 01          	add    $0x1,%rax
+  800cd8:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800cdc:	75 f6                	jne    800cd4 <strlen+0xa>
+  800cde:	c3                   	ret
+    size_t n = 0;
+  800cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ce4:	c3                   	ret
+
+0000000000800ce5 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ce5:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ce8:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ced:	48 85 f6             	test   %rsi,%rsi
+  800cf0:	74 11                	je     800d03 <strnlen+0x1e>
+  800cf2:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800cf6:	74 0c                	je     800d04 <strnlen+0x1f>
+  800cf8:	48 83 c2 01          	add    $0x1,%rdx
+  800cfc:	48 39 d0             	cmp    %rdx,%rax
+  800cff:	75 f1                	jne    800cf2 <strnlen+0xd>
+  800d01:	eb 04                	jmp    800d07 <strnlen+0x22>
+  800d03:	c3                   	ret
+  800d04:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d07:	c3                   	ret
+
+0000000000800d08 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d08:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d10:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d14:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d17:	48 83 c2 01          	add    $0x1,%rdx
+  800d1b:	84 c9                	test   %cl,%cl
+  800d1d:	75 f1                	jne    800d10 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d1f:	c3                   	ret
+
+0000000000800d20 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d20:	55                   	push   %rbp
+  800d21:	48 89 e5             	mov    %rsp,%rbp
+  800d24:	41 54                	push   %r12
+  800d26:	53                   	push   %rbx
+  800d27:	48 89 fb             	mov    %rdi,%rbx
+  800d2a:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d2d:	48 b8 ca 0c 80 00 00 	movabs $0x800cca,%rax
+  800d34:	00 00 00 
+  800d37:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d39:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d3d:	4c 89 e6             	mov    %r12,%rsi
+  800d40:	48 b8 08 0d 80 00 00 	movabs $0x800d08,%rax
+  800d47:	00 00 00 
+  800d4a:	ff d0                	call   *%rax
+    return dst;
+}
+  800d4c:	48 89 d8             	mov    %rbx,%rax
+  800d4f:	5b                   	pop    %rbx
+  800d50:	41 5c                	pop    %r12
+  800d52:	5d                   	pop    %rbp
+  800d53:	c3                   	ret
+
+0000000000800d54 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d54:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d57:	48 85 d2             	test   %rdx,%rdx
+  800d5a:	74 1f                	je     800d7b <strncpy+0x27>
+  800d5c:	48 01 fa             	add    %rdi,%rdx
+  800d5f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d62:	48 83 c1 01          	add    $0x1,%rcx
+  800d66:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d6a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d6e:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d72:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d76:	48 39 ca             	cmp    %rcx,%rdx
+  800d79:	75 e7                	jne    800d62 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d7b:	c3                   	ret
+
+0000000000800d7c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d7c:	48 89 f8             	mov    %rdi,%rax
+  800d7f:	48 85 d2             	test   %rdx,%rdx
+  800d82:	74 24                	je     800da8 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d84:	48 83 ea 01          	sub    $0x1,%rdx
+  800d88:	74 1b                	je     800da5 <strlcpy+0x29>
+  800d8a:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d8e:	0f b6 16             	movzbl (%rsi),%edx
+  800d91:	84 d2                	test   %dl,%dl
+  800d93:	74 10                	je     800da5 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d95:	48 83 c6 01          	add    $0x1,%rsi
+  800d99:	48 83 c0 01          	add    $0x1,%rax
+  800d9d:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800da0:	48 39 c8             	cmp    %rcx,%rax
+  800da3:	75 e9                	jne    800d8e <strlcpy+0x12>
+        *dst = '\0';
+  800da5:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800da8:	48 29 f8             	sub    %rdi,%rax
+}
+  800dab:	c3                   	ret
+
+0000000000800dac <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800dac:	0f b6 07             	movzbl (%rdi),%eax
+  800daf:	84 c0                	test   %al,%al
+  800db1:	74 13                	je     800dc6 <strcmp+0x1a>
+  800db3:	38 06                	cmp    %al,(%rsi)
+  800db5:	75 0f                	jne    800dc6 <strcmp+0x1a>
+  800db7:	48 83 c7 01          	add    $0x1,%rdi
+  800dbb:	48 83 c6 01          	add    $0x1,%rsi
+  800dbf:	0f b6 07             	movzbl (%rdi),%eax
+  800dc2:	84 c0                	test   %al,%al
+  800dc4:	75 ed                	jne    800db3 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dc6:	0f b6 c0             	movzbl %al,%eax
+  800dc9:	0f b6 16             	movzbl (%rsi),%edx
+  800dcc:	29 d0                	sub    %edx,%eax
+}
+  800dce:	c3                   	ret
+
+0000000000800dcf <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800dcf:	48 85 d2             	test   %rdx,%rdx
+  800dd2:	74 1f                	je     800df3 <strncmp+0x24>
+  800dd4:	0f b6 07             	movzbl (%rdi),%eax
+  800dd7:	84 c0                	test   %al,%al
+  800dd9:	74 1e                	je     800df9 <strncmp+0x2a>
+  800ddb:	3a 06                	cmp    (%rsi),%al
+  800ddd:	75 1a                	jne    800df9 <strncmp+0x2a>
+  800ddf:	48 83 c7 01          	add    $0x1,%rdi
+  800de3:	48 83 c6 01          	add    $0x1,%rsi
+  800de7:	48 83 ea 01          	sub    $0x1,%rdx
+  800deb:	75 e7                	jne    800dd4 <strncmp+0x5>
+
+    if (!n) return 0;
+  800ded:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df2:	c3                   	ret
+  800df3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df8:	c3                   	ret
+  800df9:	48 85 d2             	test   %rdx,%rdx
+  800dfc:	74 09                	je     800e07 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dfe:	0f b6 07             	movzbl (%rdi),%eax
+  800e01:	0f b6 16             	movzbl (%rsi),%edx
+  800e04:	29 d0                	sub    %edx,%eax
+  800e06:	c3                   	ret
+    if (!n) return 0;
+  800e07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e0c:	c3                   	ret
+
+0000000000800e0d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e0d:	0f b6 17             	movzbl (%rdi),%edx
+  800e10:	84 d2                	test   %dl,%dl
+  800e12:	74 18                	je     800e2c <strchr+0x1f>
+        if (*str == c) {
+  800e14:	0f be d2             	movsbl %dl,%edx
+  800e17:	39 f2                	cmp    %esi,%edx
+  800e19:	74 17                	je     800e32 <strchr+0x25>
+    for (; *str; str++) {
+  800e1b:	48 83 c7 01          	add    $0x1,%rdi
+  800e1f:	0f b6 17             	movzbl (%rdi),%edx
+  800e22:	84 d2                	test   %dl,%dl
+  800e24:	75 ee                	jne    800e14 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e26:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2b:	c3                   	ret
+  800e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e31:	c3                   	ret
+  800e32:	48 89 f8             	mov    %rdi,%rax
+}
+  800e35:	c3                   	ret
+
+0000000000800e36 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e36:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e39:	0f b6 17             	movzbl (%rdi),%edx
+  800e3c:	84 d2                	test   %dl,%dl
+  800e3e:	74 13                	je     800e53 <strfind+0x1d>
+  800e40:	0f be d2             	movsbl %dl,%edx
+  800e43:	39 f2                	cmp    %esi,%edx
+  800e45:	74 0b                	je     800e52 <strfind+0x1c>
+  800e47:	48 83 c0 01          	add    $0x1,%rax
+  800e4b:	0f b6 10             	movzbl (%rax),%edx
+  800e4e:	84 d2                	test   %dl,%dl
+  800e50:	75 ee                	jne    800e40 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e52:	c3                   	ret
+  800e53:	c3                   	ret
+
+0000000000800e54 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e54:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e57:	48 89 f8             	mov    %rdi,%rax
+  800e5a:	48 f7 d8             	neg    %rax
+  800e5d:	83 e0 07             	and    $0x7,%eax
+  800e60:	49 89 d1             	mov    %rdx,%r9
+  800e63:	49 29 c1             	sub    %rax,%r9
+  800e66:	78 36                	js     800e9e <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e68:	40 0f b6 c6          	movzbl %sil,%eax
+  800e6c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e73:	01 01 01 
+  800e76:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e7a:	40 f6 c7 07          	test   $0x7,%dil
+  800e7e:	75 38                	jne    800eb8 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e80:	4c 89 c9             	mov    %r9,%rcx
+  800e83:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e87:	74 0c                	je     800e95 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e89:	fc                   	cld
+  800e8a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e8d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e91:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e95:	4d 85 c9             	test   %r9,%r9
+  800e98:	75 45                	jne    800edf <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e9a:	4c 89 c0             	mov    %r8,%rax
+  800e9d:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e9e:	48 85 d2             	test   %rdx,%rdx
+  800ea1:	74 f7                	je     800e9a <memset+0x46>
+  800ea3:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ea6:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ea9:	48 83 c0 01          	add    $0x1,%rax
+  800ead:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800eb1:	48 39 c2             	cmp    %rax,%rdx
+  800eb4:	75 f3                	jne    800ea9 <memset+0x55>
+  800eb6:	eb e2                	jmp    800e9a <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800eb8:	40 f6 c7 01          	test   $0x1,%dil
+  800ebc:	74 06                	je     800ec4 <memset+0x70>
+  800ebe:	88 07                	mov    %al,(%rdi)
+  800ec0:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ec4:	40 f6 c7 02          	test   $0x2,%dil
+  800ec8:	74 07                	je     800ed1 <memset+0x7d>
+  800eca:	66 89 07             	mov    %ax,(%rdi)
+  800ecd:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ed1:	40 f6 c7 04          	test   $0x4,%dil
+  800ed5:	74 a9                	je     800e80 <memset+0x2c>
+  800ed7:	89 07                	mov    %eax,(%rdi)
+  800ed9:	48 83 c7 04          	add    $0x4,%rdi
+  800edd:	eb a1                	jmp    800e80 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800edf:	41 f6 c1 04          	test   $0x4,%r9b
+  800ee3:	74 06                	je     800eeb <memset+0x97>
+  800ee5:	89 07                	mov    %eax,(%rdi)
+  800ee7:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800eeb:	41 f6 c1 02          	test   $0x2,%r9b
+  800eef:	74 07                	je     800ef8 <memset+0xa4>
+  800ef1:	66 89 07             	mov    %ax,(%rdi)
+  800ef4:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ef8:	41 f6 c1 01          	test   $0x1,%r9b
+  800efc:	74 9c                	je     800e9a <memset+0x46>
+  800efe:	88 07                	mov    %al,(%rdi)
+  800f00:	eb 98                	jmp    800e9a <memset+0x46>
+
+0000000000800f02 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f02:	48 89 f8             	mov    %rdi,%rax
+  800f05:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f08:	48 39 fe             	cmp    %rdi,%rsi
+  800f0b:	73 3b                	jae    800f48 <memmove+0x46>
+  800f0d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f11:	48 39 d7             	cmp    %rdx,%rdi
+  800f14:	73 32                	jae    800f48 <memmove+0x46>
+        s += n;
+        d += n;
+  800f16:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f1a:	48 89 d6             	mov    %rdx,%rsi
+  800f1d:	48 09 fe             	or     %rdi,%rsi
+  800f20:	48 09 ce             	or     %rcx,%rsi
+  800f23:	40 f6 c6 07          	test   $0x7,%sil
+  800f27:	75 12                	jne    800f3b <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f29:	48 83 ef 08          	sub    $0x8,%rdi
+  800f2d:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f31:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f35:	fd                   	std
+  800f36:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f39:	fc                   	cld
+  800f3a:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f3b:	48 83 ef 01          	sub    $0x1,%rdi
+  800f3f:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f43:	fd                   	std
+  800f44:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f46:	eb f1                	jmp    800f39 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f48:	48 89 f2             	mov    %rsi,%rdx
+  800f4b:	48 09 c2             	or     %rax,%rdx
+  800f4e:	48 09 ca             	or     %rcx,%rdx
+  800f51:	f6 c2 07             	test   $0x7,%dl
+  800f54:	75 0c                	jne    800f62 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f56:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f5a:	48 89 c7             	mov    %rax,%rdi
+  800f5d:	fc                   	cld
+  800f5e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f61:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f62:	48 89 c7             	mov    %rax,%rdi
+  800f65:	fc                   	cld
+  800f66:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f68:	c3                   	ret
+
+0000000000800f69 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f69:	55                   	push   %rbp
+  800f6a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f6d:	48 b8 02 0f 80 00 00 	movabs $0x800f02,%rax
+  800f74:	00 00 00 
+  800f77:	ff d0                	call   *%rax
+}
+  800f79:	5d                   	pop    %rbp
+  800f7a:	c3                   	ret
+
+0000000000800f7b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f7b:	55                   	push   %rbp
+  800f7c:	48 89 e5             	mov    %rsp,%rbp
+  800f7f:	41 57                	push   %r15
+  800f81:	41 56                	push   %r14
+  800f83:	41 55                	push   %r13
+  800f85:	41 54                	push   %r12
+  800f87:	53                   	push   %rbx
+  800f88:	48 83 ec 08          	sub    $0x8,%rsp
+  800f8c:	49 89 fe             	mov    %rdi,%r14
+  800f8f:	49 89 f7             	mov    %rsi,%r15
+  800f92:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f95:	48 89 f7             	mov    %rsi,%rdi
+  800f98:	48 b8 ca 0c 80 00 00 	movabs $0x800cca,%rax
+  800f9f:	00 00 00 
+  800fa2:	ff d0                	call   *%rax
+  800fa4:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800fa7:	48 89 de             	mov    %rbx,%rsi
+  800faa:	4c 89 f7             	mov    %r14,%rdi
+  800fad:	48 b8 e5 0c 80 00 00 	movabs $0x800ce5,%rax
+  800fb4:	00 00 00 
+  800fb7:	ff d0                	call   *%rax
+  800fb9:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fbc:	48 39 c3             	cmp    %rax,%rbx
+  800fbf:	74 36                	je     800ff7 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800fc1:	48 89 d8             	mov    %rbx,%rax
+  800fc4:	4c 29 e8             	sub    %r13,%rax
+  800fc7:	49 39 c4             	cmp    %rax,%r12
+  800fca:	73 31                	jae    800ffd <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800fcc:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800fd1:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fd5:	4c 89 fe             	mov    %r15,%rsi
+  800fd8:	48 b8 69 0f 80 00 00 	movabs $0x800f69,%rax
+  800fdf:	00 00 00 
+  800fe2:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fe4:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fe8:	48 83 c4 08          	add    $0x8,%rsp
+  800fec:	5b                   	pop    %rbx
+  800fed:	41 5c                	pop    %r12
+  800fef:	41 5d                	pop    %r13
+  800ff1:	41 5e                	pop    %r14
+  800ff3:	41 5f                	pop    %r15
+  800ff5:	5d                   	pop    %rbp
+  800ff6:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ff7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ffb:	eb eb                	jmp    800fe8 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800ffd:	48 83 eb 01          	sub    $0x1,%rbx
+  801001:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801005:	48 89 da             	mov    %rbx,%rdx
+  801008:	4c 89 fe             	mov    %r15,%rsi
+  80100b:	48 b8 69 0f 80 00 00 	movabs $0x800f69,%rax
+  801012:	00 00 00 
+  801015:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801017:	49 01 de             	add    %rbx,%r14
+  80101a:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80101f:	eb c3                	jmp    800fe4 <strlcat+0x69>
+
+0000000000801021 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801021:	48 85 d2             	test   %rdx,%rdx
+  801024:	74 2d                	je     801053 <memcmp+0x32>
+  801026:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80102b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80102f:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801034:	44 38 c1             	cmp    %r8b,%cl
+  801037:	75 0f                	jne    801048 <memcmp+0x27>
+    while (n-- > 0) {
+  801039:	48 83 c0 01          	add    $0x1,%rax
+  80103d:	48 39 c2             	cmp    %rax,%rdx
+  801040:	75 e9                	jne    80102b <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801042:	b8 00 00 00 00       	mov    $0x0,%eax
+  801047:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801048:	0f b6 c1             	movzbl %cl,%eax
+  80104b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80104f:	44 29 c0             	sub    %r8d,%eax
+  801052:	c3                   	ret
+    return 0;
+  801053:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801058:	c3                   	ret
+
+0000000000801059 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801059:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80105d:	48 39 c7             	cmp    %rax,%rdi
+  801060:	73 0f                	jae    801071 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801062:	40 38 37             	cmp    %sil,(%rdi)
+  801065:	74 0e                	je     801075 <memfind+0x1c>
+    for (; src < end; src++) {
+  801067:	48 83 c7 01          	add    $0x1,%rdi
+  80106b:	48 39 f8             	cmp    %rdi,%rax
+  80106e:	75 f2                	jne    801062 <memfind+0x9>
+  801070:	c3                   	ret
+  801071:	48 89 f8             	mov    %rdi,%rax
+  801074:	c3                   	ret
+  801075:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801078:	c3                   	ret
+
+0000000000801079 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801079:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80107c:	0f b6 37             	movzbl (%rdi),%esi
+  80107f:	40 80 fe 20          	cmp    $0x20,%sil
+  801083:	74 06                	je     80108b <strtol+0x12>
+  801085:	40 80 fe 09          	cmp    $0x9,%sil
+  801089:	75 13                	jne    80109e <strtol+0x25>
+  80108b:	48 83 c7 01          	add    $0x1,%rdi
+  80108f:	0f b6 37             	movzbl (%rdi),%esi
+  801092:	40 80 fe 20          	cmp    $0x20,%sil
+  801096:	74 f3                	je     80108b <strtol+0x12>
+  801098:	40 80 fe 09          	cmp    $0x9,%sil
+  80109c:	74 ed                	je     80108b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80109e:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8010a1:	83 e0 fd             	and    $0xfffffffd,%eax
+  8010a4:	3c 01                	cmp    $0x1,%al
+  8010a6:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010aa:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010b0:	75 0f                	jne    8010c1 <strtol+0x48>
+  8010b2:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010b5:	74 14                	je     8010cb <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010b7:	85 d2                	test   %edx,%edx
+  8010b9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010be:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010c1:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010c6:	4c 63 ca             	movslq %edx,%r9
+  8010c9:	eb 36                	jmp    801101 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010cb:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010cf:	74 0f                	je     8010e0 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010d1:	85 d2                	test   %edx,%edx
+  8010d3:	75 ec                	jne    8010c1 <strtol+0x48>
+        s++;
+  8010d5:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010d9:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010de:	eb e1                	jmp    8010c1 <strtol+0x48>
+        s += 2;
+  8010e0:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010e4:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010e9:	eb d6                	jmp    8010c1 <strtol+0x48>
+            dig -= '0';
+  8010eb:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010ee:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010f2:	41 39 d0             	cmp    %edx,%r8d
+  8010f5:	7d 21                	jge    801118 <strtol+0x9f>
+        val = val * base + dig;
+  8010f7:	49 0f af c1          	imul   %r9,%rax
+  8010fb:	0f b6 c9             	movzbl %cl,%ecx
+  8010fe:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801101:	48 83 c7 01          	add    $0x1,%rdi
+  801105:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801109:	80 f9 39             	cmp    $0x39,%cl
+  80110c:	76 dd                	jbe    8010eb <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80110e:	80 f9 7b             	cmp    $0x7b,%cl
+  801111:	77 05                	ja     801118 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801113:	83 e9 57             	sub    $0x57,%ecx
+  801116:	eb d6                	jmp    8010ee <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801118:	4d 85 d2             	test   %r10,%r10
+  80111b:	74 03                	je     801120 <strtol+0xa7>
+  80111d:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801120:	48 89 c2             	mov    %rax,%rdx
+  801123:	48 f7 da             	neg    %rdx
+  801126:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80112a:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80112e:	c3                   	ret
+
+000000000080112f <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80112f:	55                   	push   %rbp
+  801130:	48 89 e5             	mov    %rsp,%rbp
+  801133:	53                   	push   %rbx
+  801134:	48 89 fa             	mov    %rdi,%rdx
+  801137:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80113a:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80113f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801144:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801149:	be 00 00 00 00       	mov    $0x0,%esi
+  80114e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801154:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801156:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80115a:	c9                   	leave
+  80115b:	c3                   	ret
+
+000000000080115c <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80115c:	55                   	push   %rbp
+  80115d:	48 89 e5             	mov    %rsp,%rbp
+  801160:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801161:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801166:	ba 00 00 00 00       	mov    $0x0,%edx
+  80116b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801170:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801175:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80117a:	be 00 00 00 00       	mov    $0x0,%esi
+  80117f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801185:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801187:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80118b:	c9                   	leave
+  80118c:	c3                   	ret
+
+000000000080118d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80118d:	55                   	push   %rbp
+  80118e:	48 89 e5             	mov    %rsp,%rbp
+  801191:	53                   	push   %rbx
+  801192:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801196:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801199:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80119e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011b8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011ba:	48 85 c0             	test   %rax,%rax
+  8011bd:	7f 06                	jg     8011c5 <sys_env_destroy+0x38>
+}
+  8011bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011c3:	c9                   	leave
+  8011c4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011c5:	49 89 c0             	mov    %rax,%r8
+  8011c8:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011cd:	48 ba 30 34 80 00 00 	movabs $0x803430,%rdx
+  8011d4:	00 00 00 
+  8011d7:	be 26 00 00 00       	mov    $0x26,%esi
+  8011dc:	48 bf 4f 34 80 00 00 	movabs $0x80344f,%rdi
+  8011e3:	00 00 00 
+  8011e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011eb:	49 b9 93 02 80 00 00 	movabs $0x800293,%r9
+  8011f2:	00 00 00 
+  8011f5:	41 ff d1             	call   *%r9
+
+00000000008011f8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011f8:	55                   	push   %rbp
+  8011f9:	48 89 e5             	mov    %rsp,%rbp
+  8011fc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011fd:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801202:	ba 00 00 00 00       	mov    $0x0,%edx
+  801207:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80120c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801211:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801216:	be 00 00 00 00       	mov    $0x0,%esi
+  80121b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801221:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801223:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801227:	c9                   	leave
+  801228:	c3                   	ret
+
+0000000000801229 <sys_yield>:
+
+void
+sys_yield(void) {
+  801229:	55                   	push   %rbp
+  80122a:	48 89 e5             	mov    %rsp,%rbp
+  80122d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80122e:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801233:	ba 00 00 00 00       	mov    $0x0,%edx
+  801238:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80123d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801242:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801247:	be 00 00 00 00       	mov    $0x0,%esi
+  80124c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801252:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801254:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801258:	c9                   	leave
+  801259:	c3                   	ret
+
+000000000080125a <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80125a:	55                   	push   %rbp
+  80125b:	48 89 e5             	mov    %rsp,%rbp
+  80125e:	53                   	push   %rbx
+  80125f:	48 89 fa             	mov    %rdi,%rdx
+  801262:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801265:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80126a:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801271:	00 00 00 
+  801274:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801279:	be 00 00 00 00       	mov    $0x0,%esi
+  80127e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801284:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801286:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80128a:	c9                   	leave
+  80128b:	c3                   	ret
+
+000000000080128c <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80128c:	55                   	push   %rbp
+  80128d:	48 89 e5             	mov    %rsp,%rbp
+  801290:	53                   	push   %rbx
+  801291:	49 89 f8             	mov    %rdi,%r8
+  801294:	48 89 d3             	mov    %rdx,%rbx
+  801297:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80129a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80129f:	4c 89 c2             	mov    %r8,%rdx
+  8012a2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b0:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b6:	c9                   	leave
+  8012b7:	c3                   	ret
+
+00000000008012b8 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012b8:	55                   	push   %rbp
+  8012b9:	48 89 e5             	mov    %rsp,%rbp
+  8012bc:	53                   	push   %rbx
+  8012bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8012c1:	89 f8                	mov    %edi,%eax
+  8012c3:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012c6:	48 63 f9             	movslq %ecx,%rdi
+  8012c9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012cc:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012d1:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012df:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012e1:	48 85 c0             	test   %rax,%rax
+  8012e4:	7f 06                	jg     8012ec <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ea:	c9                   	leave
+  8012eb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ec:	49 89 c0             	mov    %rax,%r8
+  8012ef:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012f4:	48 ba 30 34 80 00 00 	movabs $0x803430,%rdx
+  8012fb:	00 00 00 
+  8012fe:	be 26 00 00 00       	mov    $0x26,%esi
+  801303:	48 bf 4f 34 80 00 00 	movabs $0x80344f,%rdi
+  80130a:	00 00 00 
+  80130d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801312:	49 b9 93 02 80 00 00 	movabs $0x800293,%r9
+  801319:	00 00 00 
+  80131c:	41 ff d1             	call   *%r9
+
+000000000080131f <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80131f:	55                   	push   %rbp
+  801320:	48 89 e5             	mov    %rsp,%rbp
+  801323:	53                   	push   %rbx
+  801324:	48 83 ec 08          	sub    $0x8,%rsp
+  801328:	89 f8                	mov    %edi,%eax
+  80132a:	49 89 f2             	mov    %rsi,%r10
+  80132d:	48 89 cf             	mov    %rcx,%rdi
+  801330:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801333:	48 63 da             	movslq %edx,%rbx
+  801336:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801339:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80133e:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801341:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801344:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801346:	48 85 c0             	test   %rax,%rax
+  801349:	7f 06                	jg     801351 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80134b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80134f:	c9                   	leave
+  801350:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801351:	49 89 c0             	mov    %rax,%r8
+  801354:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801359:	48 ba 30 34 80 00 00 	movabs $0x803430,%rdx
+  801360:	00 00 00 
+  801363:	be 26 00 00 00       	mov    $0x26,%esi
+  801368:	48 bf 4f 34 80 00 00 	movabs $0x80344f,%rdi
+  80136f:	00 00 00 
+  801372:	b8 00 00 00 00       	mov    $0x0,%eax
+  801377:	49 b9 93 02 80 00 00 	movabs $0x800293,%r9
+  80137e:	00 00 00 
+  801381:	41 ff d1             	call   *%r9
+
+0000000000801384 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801384:	55                   	push   %rbp
+  801385:	48 89 e5             	mov    %rsp,%rbp
+  801388:	53                   	push   %rbx
+  801389:	48 83 ec 08          	sub    $0x8,%rsp
+  80138d:	48 89 f1             	mov    %rsi,%rcx
+  801390:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801393:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801396:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80139b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013ad:	48 85 c0             	test   %rax,%rax
+  8013b0:	7f 06                	jg     8013b8 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b6:	c9                   	leave
+  8013b7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013b8:	49 89 c0             	mov    %rax,%r8
+  8013bb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013c0:	48 ba 30 34 80 00 00 	movabs $0x803430,%rdx
+  8013c7:	00 00 00 
+  8013ca:	be 26 00 00 00       	mov    $0x26,%esi
+  8013cf:	48 bf 4f 34 80 00 00 	movabs $0x80344f,%rdi
+  8013d6:	00 00 00 
+  8013d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013de:	49 b9 93 02 80 00 00 	movabs $0x800293,%r9
+  8013e5:	00 00 00 
+  8013e8:	41 ff d1             	call   *%r9
+
+00000000008013eb <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8013eb:	55                   	push   %rbp
+  8013ec:	48 89 e5             	mov    %rsp,%rbp
+  8013ef:	53                   	push   %rbx
+  8013f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8013f4:	89 f8                	mov    %edi,%eax
+  8013f6:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8013f9:	48 63 f9             	movslq %ecx,%rdi
+  8013fc:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ff:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801404:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801407:	be 00 00 00 00       	mov    $0x0,%esi
+  80140c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801412:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801414:	48 85 c0             	test   %rax,%rax
+  801417:	7f 06                	jg     80141f <sys_region_advise+0x34>
+}
+  801419:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141d:	c9                   	leave
+  80141e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80141f:	49 89 c0             	mov    %rax,%r8
+  801422:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801427:	48 ba 30 34 80 00 00 	movabs $0x803430,%rdx
+  80142e:	00 00 00 
+  801431:	be 26 00 00 00       	mov    $0x26,%esi
+  801436:	48 bf 4f 34 80 00 00 	movabs $0x80344f,%rdi
+  80143d:	00 00 00 
+  801440:	b8 00 00 00 00       	mov    $0x0,%eax
+  801445:	49 b9 93 02 80 00 00 	movabs $0x800293,%r9
+  80144c:	00 00 00 
+  80144f:	41 ff d1             	call   *%r9
+
+0000000000801452 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801452:	55                   	push   %rbp
+  801453:	48 89 e5             	mov    %rsp,%rbp
+  801456:	53                   	push   %rbx
+  801457:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80145b:	48 63 ce             	movslq %esi,%rcx
+  80145e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801461:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801466:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801470:	be 00 00 00 00       	mov    $0x0,%esi
+  801475:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80147b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80147d:	48 85 c0             	test   %rax,%rax
+  801480:	7f 06                	jg     801488 <sys_env_set_nice+0x36>
+}
+  801482:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801486:	c9                   	leave
+  801487:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801488:	49 89 c0             	mov    %rax,%r8
+  80148b:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801490:	48 ba 30 34 80 00 00 	movabs $0x803430,%rdx
+  801497:	00 00 00 
+  80149a:	be 26 00 00 00       	mov    $0x26,%esi
+  80149f:	48 bf 4f 34 80 00 00 	movabs $0x80344f,%rdi
+  8014a6:	00 00 00 
+  8014a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ae:	49 b9 93 02 80 00 00 	movabs $0x800293,%r9
+  8014b5:	00 00 00 
+  8014b8:	41 ff d1             	call   *%r9
+
+00000000008014bb <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014bb:	55                   	push   %rbp
+  8014bc:	48 89 e5             	mov    %rsp,%rbp
+  8014bf:	53                   	push   %rbx
+  8014c0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014c4:	48 63 ce             	movslq %esi,%rcx
+  8014c7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ca:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014e6:	48 85 c0             	test   %rax,%rax
+  8014e9:	7f 06                	jg     8014f1 <sys_env_set_status+0x36>
+}
+  8014eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ef:	c9                   	leave
+  8014f0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014f1:	49 89 c0             	mov    %rax,%r8
+  8014f4:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014f9:	48 ba 30 34 80 00 00 	movabs $0x803430,%rdx
+  801500:	00 00 00 
+  801503:	be 26 00 00 00       	mov    $0x26,%esi
+  801508:	48 bf 4f 34 80 00 00 	movabs $0x80344f,%rdi
+  80150f:	00 00 00 
+  801512:	b8 00 00 00 00       	mov    $0x0,%eax
+  801517:	49 b9 93 02 80 00 00 	movabs $0x800293,%r9
+  80151e:	00 00 00 
+  801521:	41 ff d1             	call   *%r9
+
+0000000000801524 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801524:	55                   	push   %rbp
+  801525:	48 89 e5             	mov    %rsp,%rbp
+  801528:	53                   	push   %rbx
+  801529:	48 83 ec 08          	sub    $0x8,%rsp
+  80152d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801530:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801533:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801538:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80153d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801542:	be 00 00 00 00       	mov    $0x0,%esi
+  801547:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80154d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80154f:	48 85 c0             	test   %rax,%rax
+  801552:	7f 06                	jg     80155a <sys_env_set_trapframe+0x36>
+}
+  801554:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801558:	c9                   	leave
+  801559:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80155a:	49 89 c0             	mov    %rax,%r8
+  80155d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801562:	48 ba 30 34 80 00 00 	movabs $0x803430,%rdx
+  801569:	00 00 00 
+  80156c:	be 26 00 00 00       	mov    $0x26,%esi
+  801571:	48 bf 4f 34 80 00 00 	movabs $0x80344f,%rdi
+  801578:	00 00 00 
+  80157b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801580:	49 b9 93 02 80 00 00 	movabs $0x800293,%r9
+  801587:	00 00 00 
+  80158a:	41 ff d1             	call   *%r9
+
+000000000080158d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80158d:	55                   	push   %rbp
+  80158e:	48 89 e5             	mov    %rsp,%rbp
+  801591:	53                   	push   %rbx
+  801592:	48 83 ec 08          	sub    $0x8,%rsp
+  801596:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801599:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80159c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015b8:	48 85 c0             	test   %rax,%rax
+  8015bb:	7f 06                	jg     8015c3 <sys_env_set_pgfault_upcall+0x36>
+}
+  8015bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c1:	c9                   	leave
+  8015c2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015c3:	49 89 c0             	mov    %rax,%r8
+  8015c6:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015cb:	48 ba 30 34 80 00 00 	movabs $0x803430,%rdx
+  8015d2:	00 00 00 
+  8015d5:	be 26 00 00 00       	mov    $0x26,%esi
+  8015da:	48 bf 4f 34 80 00 00 	movabs $0x80344f,%rdi
+  8015e1:	00 00 00 
+  8015e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e9:	49 b9 93 02 80 00 00 	movabs $0x800293,%r9
+  8015f0:	00 00 00 
+  8015f3:	41 ff d1             	call   *%r9
+
+00000000008015f6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015f6:	55                   	push   %rbp
+  8015f7:	48 89 e5             	mov    %rsp,%rbp
+  8015fa:	53                   	push   %rbx
+  8015fb:	89 f8                	mov    %edi,%eax
+  8015fd:	49 89 f1             	mov    %rsi,%r9
+  801600:	48 89 d3             	mov    %rdx,%rbx
+  801603:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801606:	49 63 f0             	movslq %r8d,%rsi
+  801609:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80160c:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801611:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801614:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80161a:	cd 30                	int    $0x30
+}
+  80161c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801620:	c9                   	leave
+  801621:	c3                   	ret
+
+0000000000801622 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801622:	55                   	push   %rbp
+  801623:	48 89 e5             	mov    %rsp,%rbp
+  801626:	53                   	push   %rbx
+  801627:	48 83 ec 08          	sub    $0x8,%rsp
+  80162b:	48 89 fa             	mov    %rdi,%rdx
+  80162e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801631:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801636:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801640:	be 00 00 00 00       	mov    $0x0,%esi
+  801645:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80164b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80164d:	48 85 c0             	test   %rax,%rax
+  801650:	7f 06                	jg     801658 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801652:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801656:	c9                   	leave
+  801657:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801658:	49 89 c0             	mov    %rax,%r8
+  80165b:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801660:	48 ba 30 34 80 00 00 	movabs $0x803430,%rdx
+  801667:	00 00 00 
+  80166a:	be 26 00 00 00       	mov    $0x26,%esi
+  80166f:	48 bf 4f 34 80 00 00 	movabs $0x80344f,%rdi
+  801676:	00 00 00 
+  801679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80167e:	49 b9 93 02 80 00 00 	movabs $0x800293,%r9
+  801685:	00 00 00 
+  801688:	41 ff d1             	call   *%r9
+
+000000000080168b <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80168b:	55                   	push   %rbp
+  80168c:	48 89 e5             	mov    %rsp,%rbp
+  80168f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801690:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801695:	ba 00 00 00 00       	mov    $0x0,%edx
+  80169a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80169f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016b4:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ba:	c9                   	leave
+  8016bb:	c3                   	ret
+
+00000000008016bc <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8016bc:	55                   	push   %rbp
+  8016bd:	48 89 e5             	mov    %rsp,%rbp
+  8016c0:	53                   	push   %rbx
+  8016c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8016c5:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8016c8:	48 63 ce             	movslq %esi,%rcx
+  8016cb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ce:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8016dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016e3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016e5:	48 85 c0             	test   %rax,%rax
+  8016e8:	7f 06                	jg     8016f0 <sys_sigqueue+0x34>
+}
+  8016ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ee:	c9                   	leave
+  8016ef:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016f0:	49 89 c0             	mov    %rax,%r8
+  8016f3:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8016f8:	48 ba 30 34 80 00 00 	movabs $0x803430,%rdx
+  8016ff:	00 00 00 
+  801702:	be 26 00 00 00       	mov    $0x26,%esi
+  801707:	48 bf 4f 34 80 00 00 	movabs $0x80344f,%rdi
+  80170e:	00 00 00 
+  801711:	b8 00 00 00 00       	mov    $0x0,%eax
+  801716:	49 b9 93 02 80 00 00 	movabs $0x800293,%r9
+  80171d:	00 00 00 
+  801720:	41 ff d1             	call   *%r9
+
+0000000000801723 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801723:	55                   	push   %rbp
+  801724:	48 89 e5             	mov    %rsp,%rbp
+  801727:	53                   	push   %rbx
+  801728:	48 83 ec 08          	sub    $0x8,%rsp
+  80172c:	48 89 fa             	mov    %rdi,%rdx
+  80172f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801732:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801737:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80173c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801741:	be 00 00 00 00       	mov    $0x0,%esi
+  801746:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80174c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80174e:	48 85 c0             	test   %rax,%rax
+  801751:	7f 06                	jg     801759 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801753:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801757:	c9                   	leave
+  801758:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801759:	49 89 c0             	mov    %rax,%r8
+  80175c:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801761:	48 ba 30 34 80 00 00 	movabs $0x803430,%rdx
+  801768:	00 00 00 
+  80176b:	be 26 00 00 00       	mov    $0x26,%esi
+  801770:	48 bf 4f 34 80 00 00 	movabs $0x80344f,%rdi
+  801777:	00 00 00 
+  80177a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177f:	49 b9 93 02 80 00 00 	movabs $0x800293,%r9
+  801786:	00 00 00 
+  801789:	41 ff d1             	call   *%r9
+
+000000000080178c <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80178c:	55                   	push   %rbp
+  80178d:	48 89 e5             	mov    %rsp,%rbp
+  801790:	53                   	push   %rbx
+  801791:	48 83 ec 08          	sub    $0x8,%rsp
+  801795:	48 89 f1             	mov    %rsi,%rcx
+  801798:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80179b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80179e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017a3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017b3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017b5:	48 85 c0             	test   %rax,%rax
+  8017b8:	7f 06                	jg     8017c0 <sys_sigaction+0x34>
+}
+  8017ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017be:	c9                   	leave
+  8017bf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017c0:	49 89 c0             	mov    %rax,%r8
+  8017c3:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8017c8:	48 ba 30 34 80 00 00 	movabs $0x803430,%rdx
+  8017cf:	00 00 00 
+  8017d2:	be 26 00 00 00       	mov    $0x26,%esi
+  8017d7:	48 bf 4f 34 80 00 00 	movabs $0x80344f,%rdi
+  8017de:	00 00 00 
+  8017e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e6:	49 b9 93 02 80 00 00 	movabs $0x800293,%r9
+  8017ed:	00 00 00 
+  8017f0:	41 ff d1             	call   *%r9
+
+00000000008017f3 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8017f3:	55                   	push   %rbp
+  8017f4:	48 89 e5             	mov    %rsp,%rbp
+  8017f7:	53                   	push   %rbx
+  8017f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8017fc:	48 89 f1             	mov    %rsi,%rcx
+  8017ff:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801802:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801805:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80180a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80180f:	be 00 00 00 00       	mov    $0x0,%esi
+  801814:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80181a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80181c:	48 85 c0             	test   %rax,%rax
+  80181f:	7f 06                	jg     801827 <sys_sigprocmask+0x34>
+}
+  801821:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801825:	c9                   	leave
+  801826:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801827:	49 89 c0             	mov    %rax,%r8
+  80182a:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80182f:	48 ba 30 34 80 00 00 	movabs $0x803430,%rdx
+  801836:	00 00 00 
+  801839:	be 26 00 00 00       	mov    $0x26,%esi
+  80183e:	48 bf 4f 34 80 00 00 	movabs $0x80344f,%rdi
+  801845:	00 00 00 
+  801848:	b8 00 00 00 00       	mov    $0x0,%eax
+  80184d:	49 b9 93 02 80 00 00 	movabs $0x800293,%r9
+  801854:	00 00 00 
+  801857:	41 ff d1             	call   *%r9
+
+000000000080185a <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80185a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801861:	ff ff ff 
+  801864:	48 01 f8             	add    %rdi,%rax
+  801867:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80186b:	c3                   	ret
+
+000000000080186c <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80186c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801873:	ff ff ff 
+  801876:	48 01 f8             	add    %rdi,%rax
+  801879:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80187d:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801883:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801887:	c3                   	ret
+
+0000000000801888 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801888:	55                   	push   %rbp
+  801889:	48 89 e5             	mov    %rsp,%rbp
+  80188c:	41 57                	push   %r15
+  80188e:	41 56                	push   %r14
+  801890:	41 55                	push   %r13
+  801892:	41 54                	push   %r12
+  801894:	53                   	push   %rbx
+  801895:	48 83 ec 08          	sub    $0x8,%rsp
+  801899:	49 89 ff             	mov    %rdi,%r15
+  80189c:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8018a1:	49 bd aa 29 80 00 00 	movabs $0x8029aa,%r13
+  8018a8:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8018ab:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8018b1:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8018b4:	48 89 df             	mov    %rbx,%rdi
+  8018b7:	41 ff d5             	call   *%r13
+  8018ba:	83 e0 04             	and    $0x4,%eax
+  8018bd:	74 17                	je     8018d6 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8018bf:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018c6:	4c 39 f3             	cmp    %r14,%rbx
+  8018c9:	75 e6                	jne    8018b1 <fd_alloc+0x29>
+  8018cb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8018d1:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8018d6:	4d 89 27             	mov    %r12,(%r15)
+}
+  8018d9:	48 83 c4 08          	add    $0x8,%rsp
+  8018dd:	5b                   	pop    %rbx
+  8018de:	41 5c                	pop    %r12
+  8018e0:	41 5d                	pop    %r13
+  8018e2:	41 5e                	pop    %r14
+  8018e4:	41 5f                	pop    %r15
+  8018e6:	5d                   	pop    %rbp
+  8018e7:	c3                   	ret
+
+00000000008018e8 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8018e8:	83 ff 1f             	cmp    $0x1f,%edi
+  8018eb:	77 39                	ja     801926 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8018ed:	55                   	push   %rbp
+  8018ee:	48 89 e5             	mov    %rsp,%rbp
+  8018f1:	41 54                	push   %r12
+  8018f3:	53                   	push   %rbx
+  8018f4:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8018f7:	48 63 df             	movslq %edi,%rbx
+  8018fa:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801901:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801905:	48 89 df             	mov    %rbx,%rdi
+  801908:	48 b8 aa 29 80 00 00 	movabs $0x8029aa,%rax
+  80190f:	00 00 00 
+  801912:	ff d0                	call   *%rax
+  801914:	a8 04                	test   $0x4,%al
+  801916:	74 14                	je     80192c <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801918:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80191c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801921:	5b                   	pop    %rbx
+  801922:	41 5c                	pop    %r12
+  801924:	5d                   	pop    %rbp
+  801925:	c3                   	ret
+        return -E_INVAL;
+  801926:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80192b:	c3                   	ret
+        return -E_INVAL;
+  80192c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801931:	eb ee                	jmp    801921 <fd_lookup+0x39>
+
+0000000000801933 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801933:	55                   	push   %rbp
+  801934:	48 89 e5             	mov    %rsp,%rbp
+  801937:	41 54                	push   %r12
+  801939:	53                   	push   %rbx
+  80193a:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80193d:	48 b8 e0 34 80 00 00 	movabs $0x8034e0,%rax
+  801944:	00 00 00 
+  801947:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80194e:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801951:	39 3b                	cmp    %edi,(%rbx)
+  801953:	74 47                	je     80199c <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801955:	48 83 c0 08          	add    $0x8,%rax
+  801959:	48 8b 18             	mov    (%rax),%rbx
+  80195c:	48 85 db             	test   %rbx,%rbx
+  80195f:	75 f0                	jne    801951 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801961:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801968:	00 00 00 
+  80196b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801971:	89 fa                	mov    %edi,%edx
+  801973:	48 bf 60 34 80 00 00 	movabs $0x803460,%rdi
+  80197a:	00 00 00 
+  80197d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801982:	48 b9 e3 03 80 00 00 	movabs $0x8003e3,%rcx
+  801989:	00 00 00 
+  80198c:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80198e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801993:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801997:	5b                   	pop    %rbx
+  801998:	41 5c                	pop    %r12
+  80199a:	5d                   	pop    %rbp
+  80199b:	c3                   	ret
+            return 0;
+  80199c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a1:	eb f0                	jmp    801993 <dev_lookup+0x60>
+
+00000000008019a3 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8019a3:	55                   	push   %rbp
+  8019a4:	48 89 e5             	mov    %rsp,%rbp
+  8019a7:	41 55                	push   %r13
+  8019a9:	41 54                	push   %r12
+  8019ab:	53                   	push   %rbx
+  8019ac:	48 83 ec 18          	sub    $0x18,%rsp
+  8019b0:	48 89 fb             	mov    %rdi,%rbx
+  8019b3:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019b6:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8019bd:	ff ff ff 
+  8019c0:	48 01 df             	add    %rbx,%rdi
+  8019c3:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8019c7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019cb:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  8019d2:	00 00 00 
+  8019d5:	ff d0                	call   *%rax
+  8019d7:	41 89 c5             	mov    %eax,%r13d
+  8019da:	85 c0                	test   %eax,%eax
+  8019dc:	78 06                	js     8019e4 <fd_close+0x41>
+  8019de:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8019e2:	74 1a                	je     8019fe <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8019e4:	45 84 e4             	test   %r12b,%r12b
+  8019e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ec:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8019f0:	44 89 e8             	mov    %r13d,%eax
+  8019f3:	48 83 c4 18          	add    $0x18,%rsp
+  8019f7:	5b                   	pop    %rbx
+  8019f8:	41 5c                	pop    %r12
+  8019fa:	41 5d                	pop    %r13
+  8019fc:	5d                   	pop    %rbp
+  8019fd:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019fe:	8b 3b                	mov    (%rbx),%edi
+  801a00:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a04:	48 b8 33 19 80 00 00 	movabs $0x801933,%rax
+  801a0b:	00 00 00 
+  801a0e:	ff d0                	call   *%rax
+  801a10:	41 89 c5             	mov    %eax,%r13d
+  801a13:	85 c0                	test   %eax,%eax
+  801a15:	78 1b                	js     801a32 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a17:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a1b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801a1f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a25:	48 85 c0             	test   %rax,%rax
+  801a28:	74 08                	je     801a32 <fd_close+0x8f>
+  801a2a:	48 89 df             	mov    %rbx,%rdi
+  801a2d:	ff d0                	call   *%rax
+  801a2f:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a32:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a37:	48 89 de             	mov    %rbx,%rsi
+  801a3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a3f:	48 b8 84 13 80 00 00 	movabs $0x801384,%rax
+  801a46:	00 00 00 
+  801a49:	ff d0                	call   *%rax
+    return res;
+  801a4b:	eb a3                	jmp    8019f0 <fd_close+0x4d>
+
+0000000000801a4d <close>:
+
+int
+close(int fdnum) {
+  801a4d:	55                   	push   %rbp
+  801a4e:	48 89 e5             	mov    %rsp,%rbp
+  801a51:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a55:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a59:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  801a60:	00 00 00 
+  801a63:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a65:	85 c0                	test   %eax,%eax
+  801a67:	78 15                	js     801a7e <close+0x31>
+
+    return fd_close(fd, 1);
+  801a69:	be 01 00 00 00       	mov    $0x1,%esi
+  801a6e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a72:	48 b8 a3 19 80 00 00 	movabs $0x8019a3,%rax
+  801a79:	00 00 00 
+  801a7c:	ff d0                	call   *%rax
+}
+  801a7e:	c9                   	leave
+  801a7f:	c3                   	ret
+
+0000000000801a80 <close_all>:
+
+void
+close_all(void) {
+  801a80:	55                   	push   %rbp
+  801a81:	48 89 e5             	mov    %rsp,%rbp
+  801a84:	41 54                	push   %r12
+  801a86:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a8c:	49 bc 4d 1a 80 00 00 	movabs $0x801a4d,%r12
+  801a93:	00 00 00 
+  801a96:	89 df                	mov    %ebx,%edi
+  801a98:	41 ff d4             	call   *%r12
+  801a9b:	83 c3 01             	add    $0x1,%ebx
+  801a9e:	83 fb 20             	cmp    $0x20,%ebx
+  801aa1:	75 f3                	jne    801a96 <close_all+0x16>
+}
+  801aa3:	5b                   	pop    %rbx
+  801aa4:	41 5c                	pop    %r12
+  801aa6:	5d                   	pop    %rbp
+  801aa7:	c3                   	ret
+
+0000000000801aa8 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801aa8:	55                   	push   %rbp
+  801aa9:	48 89 e5             	mov    %rsp,%rbp
+  801aac:	41 57                	push   %r15
+  801aae:	41 56                	push   %r14
+  801ab0:	41 55                	push   %r13
+  801ab2:	41 54                	push   %r12
+  801ab4:	53                   	push   %rbx
+  801ab5:	48 83 ec 18          	sub    $0x18,%rsp
+  801ab9:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801abc:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ac0:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  801ac7:	00 00 00 
+  801aca:	ff d0                	call   *%rax
+  801acc:	89 c3                	mov    %eax,%ebx
+  801ace:	85 c0                	test   %eax,%eax
+  801ad0:	0f 88 b8 00 00 00    	js     801b8e <dup+0xe6>
+    close(newfdnum);
+  801ad6:	44 89 e7             	mov    %r12d,%edi
+  801ad9:	48 b8 4d 1a 80 00 00 	movabs $0x801a4d,%rax
+  801ae0:	00 00 00 
+  801ae3:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801ae5:	4d 63 ec             	movslq %r12d,%r13
+  801ae8:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801aef:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801af3:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801af7:	4c 89 ff             	mov    %r15,%rdi
+  801afa:	49 be 6c 18 80 00 00 	movabs $0x80186c,%r14
+  801b01:	00 00 00 
+  801b04:	41 ff d6             	call   *%r14
+  801b07:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b0a:	4c 89 ef             	mov    %r13,%rdi
+  801b0d:	41 ff d6             	call   *%r14
+  801b10:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b13:	48 89 df             	mov    %rbx,%rdi
+  801b16:	48 b8 aa 29 80 00 00 	movabs $0x8029aa,%rax
+  801b1d:	00 00 00 
+  801b20:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801b22:	a8 04                	test   $0x4,%al
+  801b24:	74 2b                	je     801b51 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801b26:	41 89 c1             	mov    %eax,%r9d
+  801b29:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b2f:	4c 89 f1             	mov    %r14,%rcx
+  801b32:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b37:	48 89 de             	mov    %rbx,%rsi
+  801b3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b3f:	48 b8 1f 13 80 00 00 	movabs $0x80131f,%rax
+  801b46:	00 00 00 
+  801b49:	ff d0                	call   *%rax
+  801b4b:	89 c3                	mov    %eax,%ebx
+  801b4d:	85 c0                	test   %eax,%eax
+  801b4f:	78 4e                	js     801b9f <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801b51:	4c 89 ff             	mov    %r15,%rdi
+  801b54:	48 b8 aa 29 80 00 00 	movabs $0x8029aa,%rax
+  801b5b:	00 00 00 
+  801b5e:	ff d0                	call   *%rax
+  801b60:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b63:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b69:	4c 89 e9             	mov    %r13,%rcx
+  801b6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b71:	4c 89 fe             	mov    %r15,%rsi
+  801b74:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b79:	48 b8 1f 13 80 00 00 	movabs $0x80131f,%rax
+  801b80:	00 00 00 
+  801b83:	ff d0                	call   *%rax
+  801b85:	89 c3                	mov    %eax,%ebx
+  801b87:	85 c0                	test   %eax,%eax
+  801b89:	78 14                	js     801b9f <dup+0xf7>
+
+    return newfdnum;
+  801b8b:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801b8e:	89 d8                	mov    %ebx,%eax
+  801b90:	48 83 c4 18          	add    $0x18,%rsp
+  801b94:	5b                   	pop    %rbx
+  801b95:	41 5c                	pop    %r12
+  801b97:	41 5d                	pop    %r13
+  801b99:	41 5e                	pop    %r14
+  801b9b:	41 5f                	pop    %r15
+  801b9d:	5d                   	pop    %rbp
+  801b9e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b9f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ba4:	4c 89 ee             	mov    %r13,%rsi
+  801ba7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bac:	49 bc 84 13 80 00 00 	movabs $0x801384,%r12
+  801bb3:	00 00 00 
+  801bb6:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801bb9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bbe:	4c 89 f6             	mov    %r14,%rsi
+  801bc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bc6:	41 ff d4             	call   *%r12
+    return res;
+  801bc9:	eb c3                	jmp    801b8e <dup+0xe6>
+
+0000000000801bcb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801bcb:	55                   	push   %rbp
+  801bcc:	48 89 e5             	mov    %rsp,%rbp
+  801bcf:	41 56                	push   %r14
+  801bd1:	41 55                	push   %r13
+  801bd3:	41 54                	push   %r12
+  801bd5:	53                   	push   %rbx
+  801bd6:	48 83 ec 10          	sub    $0x10,%rsp
+  801bda:	89 fb                	mov    %edi,%ebx
+  801bdc:	49 89 f4             	mov    %rsi,%r12
+  801bdf:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801be2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801be6:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  801bed:	00 00 00 
+  801bf0:	ff d0                	call   *%rax
+  801bf2:	85 c0                	test   %eax,%eax
+  801bf4:	78 4c                	js     801c42 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bf6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bfa:	41 8b 3e             	mov    (%r14),%edi
+  801bfd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c01:	48 b8 33 19 80 00 00 	movabs $0x801933,%rax
+  801c08:	00 00 00 
+  801c0b:	ff d0                	call   *%rax
+  801c0d:	85 c0                	test   %eax,%eax
+  801c0f:	78 35                	js     801c46 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c11:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c15:	83 e0 03             	and    $0x3,%eax
+  801c18:	83 f8 01             	cmp    $0x1,%eax
+  801c1b:	74 2d                	je     801c4a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c1d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c21:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c25:	48 85 c0             	test   %rax,%rax
+  801c28:	74 56                	je     801c80 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c2a:	4c 89 ea             	mov    %r13,%rdx
+  801c2d:	4c 89 e6             	mov    %r12,%rsi
+  801c30:	4c 89 f7             	mov    %r14,%rdi
+  801c33:	ff d0                	call   *%rax
+}
+  801c35:	48 83 c4 10          	add    $0x10,%rsp
+  801c39:	5b                   	pop    %rbx
+  801c3a:	41 5c                	pop    %r12
+  801c3c:	41 5d                	pop    %r13
+  801c3e:	41 5e                	pop    %r14
+  801c40:	5d                   	pop    %rbp
+  801c41:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c42:	48 98                	cltq
+  801c44:	eb ef                	jmp    801c35 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c46:	48 98                	cltq
+  801c48:	eb eb                	jmp    801c35 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c4a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801c51:	00 00 00 
+  801c54:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c5a:	89 da                	mov    %ebx,%edx
+  801c5c:	48 bf a1 34 80 00 00 	movabs $0x8034a1,%rdi
+  801c63:	00 00 00 
+  801c66:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6b:	48 b9 e3 03 80 00 00 	movabs $0x8003e3,%rcx
+  801c72:	00 00 00 
+  801c75:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c77:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c7e:	eb b5                	jmp    801c35 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c80:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c87:	eb ac                	jmp    801c35 <read+0x6a>
+
+0000000000801c89 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c89:	55                   	push   %rbp
+  801c8a:	48 89 e5             	mov    %rsp,%rbp
+  801c8d:	41 57                	push   %r15
+  801c8f:	41 56                	push   %r14
+  801c91:	41 55                	push   %r13
+  801c93:	41 54                	push   %r12
+  801c95:	53                   	push   %rbx
+  801c96:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c9a:	48 85 d2             	test   %rdx,%rdx
+  801c9d:	74 54                	je     801cf3 <readn+0x6a>
+  801c9f:	41 89 fd             	mov    %edi,%r13d
+  801ca2:	49 89 f6             	mov    %rsi,%r14
+  801ca5:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801ca8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801cad:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801cb2:	49 bf cb 1b 80 00 00 	movabs $0x801bcb,%r15
+  801cb9:	00 00 00 
+  801cbc:	4c 89 e2             	mov    %r12,%rdx
+  801cbf:	48 29 f2             	sub    %rsi,%rdx
+  801cc2:	4c 01 f6             	add    %r14,%rsi
+  801cc5:	44 89 ef             	mov    %r13d,%edi
+  801cc8:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801ccb:	85 c0                	test   %eax,%eax
+  801ccd:	78 20                	js     801cef <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ccf:	01 c3                	add    %eax,%ebx
+  801cd1:	85 c0                	test   %eax,%eax
+  801cd3:	74 08                	je     801cdd <readn+0x54>
+  801cd5:	48 63 f3             	movslq %ebx,%rsi
+  801cd8:	4c 39 e6             	cmp    %r12,%rsi
+  801cdb:	72 df                	jb     801cbc <readn+0x33>
+    }
+    return res;
+  801cdd:	48 63 c3             	movslq %ebx,%rax
+}
+  801ce0:	48 83 c4 08          	add    $0x8,%rsp
+  801ce4:	5b                   	pop    %rbx
+  801ce5:	41 5c                	pop    %r12
+  801ce7:	41 5d                	pop    %r13
+  801ce9:	41 5e                	pop    %r14
+  801ceb:	41 5f                	pop    %r15
+  801ced:	5d                   	pop    %rbp
+  801cee:	c3                   	ret
+        if (inc < 0) return inc;
+  801cef:	48 98                	cltq
+  801cf1:	eb ed                	jmp    801ce0 <readn+0x57>
+    int inc = 1, res = 0;
+  801cf3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cf8:	eb e3                	jmp    801cdd <readn+0x54>
+
+0000000000801cfa <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801cfa:	55                   	push   %rbp
+  801cfb:	48 89 e5             	mov    %rsp,%rbp
+  801cfe:	41 56                	push   %r14
+  801d00:	41 55                	push   %r13
+  801d02:	41 54                	push   %r12
+  801d04:	53                   	push   %rbx
+  801d05:	48 83 ec 10          	sub    $0x10,%rsp
+  801d09:	89 fb                	mov    %edi,%ebx
+  801d0b:	49 89 f4             	mov    %rsi,%r12
+  801d0e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d11:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d15:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  801d1c:	00 00 00 
+  801d1f:	ff d0                	call   *%rax
+  801d21:	85 c0                	test   %eax,%eax
+  801d23:	78 47                	js     801d6c <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d25:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d29:	41 8b 3e             	mov    (%r14),%edi
+  801d2c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d30:	48 b8 33 19 80 00 00 	movabs $0x801933,%rax
+  801d37:	00 00 00 
+  801d3a:	ff d0                	call   *%rax
+  801d3c:	85 c0                	test   %eax,%eax
+  801d3e:	78 30                	js     801d70 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d40:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d45:	74 2d                	je     801d74 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d47:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d4b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d4f:	48 85 c0             	test   %rax,%rax
+  801d52:	74 56                	je     801daa <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801d54:	4c 89 ea             	mov    %r13,%rdx
+  801d57:	4c 89 e6             	mov    %r12,%rsi
+  801d5a:	4c 89 f7             	mov    %r14,%rdi
+  801d5d:	ff d0                	call   *%rax
+}
+  801d5f:	48 83 c4 10          	add    $0x10,%rsp
+  801d63:	5b                   	pop    %rbx
+  801d64:	41 5c                	pop    %r12
+  801d66:	41 5d                	pop    %r13
+  801d68:	41 5e                	pop    %r14
+  801d6a:	5d                   	pop    %rbp
+  801d6b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d6c:	48 98                	cltq
+  801d6e:	eb ef                	jmp    801d5f <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d70:	48 98                	cltq
+  801d72:	eb eb                	jmp    801d5f <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d74:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801d7b:	00 00 00 
+  801d7e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d84:	89 da                	mov    %ebx,%edx
+  801d86:	48 bf bd 34 80 00 00 	movabs $0x8034bd,%rdi
+  801d8d:	00 00 00 
+  801d90:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d95:	48 b9 e3 03 80 00 00 	movabs $0x8003e3,%rcx
+  801d9c:	00 00 00 
+  801d9f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801da1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801da8:	eb b5                	jmp    801d5f <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801daa:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801db1:	eb ac                	jmp    801d5f <write+0x65>
+
+0000000000801db3 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801db3:	55                   	push   %rbp
+  801db4:	48 89 e5             	mov    %rsp,%rbp
+  801db7:	53                   	push   %rbx
+  801db8:	48 83 ec 18          	sub    $0x18,%rsp
+  801dbc:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dbe:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dc2:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  801dc9:	00 00 00 
+  801dcc:	ff d0                	call   *%rax
+  801dce:	85 c0                	test   %eax,%eax
+  801dd0:	78 0c                	js     801dde <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801dd2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dd6:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801dd9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dde:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801de2:	c9                   	leave
+  801de3:	c3                   	ret
+
+0000000000801de4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801de4:	55                   	push   %rbp
+  801de5:	48 89 e5             	mov    %rsp,%rbp
+  801de8:	41 55                	push   %r13
+  801dea:	41 54                	push   %r12
+  801dec:	53                   	push   %rbx
+  801ded:	48 83 ec 18          	sub    $0x18,%rsp
+  801df1:	89 fb                	mov    %edi,%ebx
+  801df3:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801df6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dfa:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  801e01:	00 00 00 
+  801e04:	ff d0                	call   *%rax
+  801e06:	85 c0                	test   %eax,%eax
+  801e08:	78 38                	js     801e42 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e0a:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e0e:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e12:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e16:	48 b8 33 19 80 00 00 	movabs $0x801933,%rax
+  801e1d:	00 00 00 
+  801e20:	ff d0                	call   *%rax
+  801e22:	85 c0                	test   %eax,%eax
+  801e24:	78 1c                	js     801e42 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e26:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e2b:	74 20                	je     801e4d <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e2d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e31:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801e35:	48 85 c0             	test   %rax,%rax
+  801e38:	74 47                	je     801e81 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e3a:	44 89 e6             	mov    %r12d,%esi
+  801e3d:	4c 89 ef             	mov    %r13,%rdi
+  801e40:	ff d0                	call   *%rax
+}
+  801e42:	48 83 c4 18          	add    $0x18,%rsp
+  801e46:	5b                   	pop    %rbx
+  801e47:	41 5c                	pop    %r12
+  801e49:	41 5d                	pop    %r13
+  801e4b:	5d                   	pop    %rbp
+  801e4c:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801e4d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801e54:	00 00 00 
+  801e57:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e5d:	89 da                	mov    %ebx,%edx
+  801e5f:	48 bf 80 34 80 00 00 	movabs $0x803480,%rdi
+  801e66:	00 00 00 
+  801e69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6e:	48 b9 e3 03 80 00 00 	movabs $0x8003e3,%rcx
+  801e75:	00 00 00 
+  801e78:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e7a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e7f:	eb c1                	jmp    801e42 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e81:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e86:	eb ba                	jmp    801e42 <ftruncate+0x5e>
+
+0000000000801e88 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e88:	55                   	push   %rbp
+  801e89:	48 89 e5             	mov    %rsp,%rbp
+  801e8c:	41 54                	push   %r12
+  801e8e:	53                   	push   %rbx
+  801e8f:	48 83 ec 10          	sub    $0x10,%rsp
+  801e93:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e96:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e9a:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  801ea1:	00 00 00 
+  801ea4:	ff d0                	call   *%rax
+  801ea6:	85 c0                	test   %eax,%eax
+  801ea8:	78 4e                	js     801ef8 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eaa:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801eae:	41 8b 3c 24          	mov    (%r12),%edi
+  801eb2:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801eb6:	48 b8 33 19 80 00 00 	movabs $0x801933,%rax
+  801ebd:	00 00 00 
+  801ec0:	ff d0                	call   *%rax
+  801ec2:	85 c0                	test   %eax,%eax
+  801ec4:	78 32                	js     801ef8 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ec6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801eca:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801ecf:	74 30                	je     801f01 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801ed1:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801ed4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801edb:	00 00 00 
+    stat->st_isdir = 0;
+  801ede:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ee5:	00 00 00 
+    stat->st_dev = dev;
+  801ee8:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801eef:	48 89 de             	mov    %rbx,%rsi
+  801ef2:	4c 89 e7             	mov    %r12,%rdi
+  801ef5:	ff 50 28             	call   *0x28(%rax)
+}
+  801ef8:	48 83 c4 10          	add    $0x10,%rsp
+  801efc:	5b                   	pop    %rbx
+  801efd:	41 5c                	pop    %r12
+  801eff:	5d                   	pop    %rbp
+  801f00:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f01:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f06:	eb f0                	jmp    801ef8 <fstat+0x70>
+
+0000000000801f08 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f08:	55                   	push   %rbp
+  801f09:	48 89 e5             	mov    %rsp,%rbp
+  801f0c:	41 54                	push   %r12
+  801f0e:	53                   	push   %rbx
+  801f0f:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f12:	be 00 00 00 00       	mov    $0x0,%esi
+  801f17:	48 b8 89 21 80 00 00 	movabs $0x802189,%rax
+  801f1e:	00 00 00 
+  801f21:	ff d0                	call   *%rax
+  801f23:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f25:	85 c0                	test   %eax,%eax
+  801f27:	78 25                	js     801f4e <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f29:	4c 89 e6             	mov    %r12,%rsi
+  801f2c:	89 c7                	mov    %eax,%edi
+  801f2e:	48 b8 88 1e 80 00 00 	movabs $0x801e88,%rax
+  801f35:	00 00 00 
+  801f38:	ff d0                	call   *%rax
+  801f3a:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f3d:	89 df                	mov    %ebx,%edi
+  801f3f:	48 b8 4d 1a 80 00 00 	movabs $0x801a4d,%rax
+  801f46:	00 00 00 
+  801f49:	ff d0                	call   *%rax
+
+    return res;
+  801f4b:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f4e:	89 d8                	mov    %ebx,%eax
+  801f50:	5b                   	pop    %rbx
+  801f51:	41 5c                	pop    %r12
+  801f53:	5d                   	pop    %rbp
+  801f54:	c3                   	ret
+
+0000000000801f55 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801f55:	55                   	push   %rbp
+  801f56:	48 89 e5             	mov    %rsp,%rbp
+  801f59:	41 54                	push   %r12
+  801f5b:	53                   	push   %rbx
+  801f5c:	48 83 ec 10          	sub    $0x10,%rsp
+  801f60:	41 89 fc             	mov    %edi,%r12d
+  801f63:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f66:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  801f6d:	00 00 00 
+  801f70:	83 38 00             	cmpl   $0x0,(%rax)
+  801f73:	74 5e                	je     801fd3 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801f75:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801f7b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801f80:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  801f87:	00 00 00 
+  801f8a:	44 89 e6             	mov    %r12d,%esi
+  801f8d:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  801f94:	00 00 00 
+  801f97:	8b 38                	mov    (%rax),%edi
+  801f99:	48 b8 66 2d 80 00 00 	movabs $0x802d66,%rax
+  801fa0:	00 00 00 
+  801fa3:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801fa5:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801fac:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801fad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fb2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801fb6:	48 89 de             	mov    %rbx,%rsi
+  801fb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fbe:	48 b8 d1 2c 80 00 00 	movabs $0x802cd1,%rax
+  801fc5:	00 00 00 
+  801fc8:	ff d0                	call   *%rax
+}
+  801fca:	48 83 c4 10          	add    $0x10,%rsp
+  801fce:	5b                   	pop    %rbx
+  801fcf:	41 5c                	pop    %r12
+  801fd1:	5d                   	pop    %rbp
+  801fd2:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fd3:	bf 03 00 00 00       	mov    $0x3,%edi
+  801fd8:	48 b8 06 2e 80 00 00 	movabs $0x802e06,%rax
+  801fdf:	00 00 00 
+  801fe2:	ff d0                	call   *%rax
+  801fe4:	a3 00 90 80 00 00 00 	movabs %eax,0x809000
+  801feb:	00 00 
+  801fed:	eb 86                	jmp    801f75 <fsipc+0x20>
+
+0000000000801fef <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801fef:	55                   	push   %rbp
+  801ff0:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ff3:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801ffa:	00 00 00 
+  801ffd:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802000:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802002:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802005:	be 00 00 00 00       	mov    $0x0,%esi
+  80200a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80200f:	48 b8 55 1f 80 00 00 	movabs $0x801f55,%rax
+  802016:	00 00 00 
+  802019:	ff d0                	call   *%rax
+}
+  80201b:	5d                   	pop    %rbp
+  80201c:	c3                   	ret
+
+000000000080201d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80201d:	55                   	push   %rbp
+  80201e:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802021:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802024:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  80202b:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80202d:	be 00 00 00 00       	mov    $0x0,%esi
+  802032:	bf 06 00 00 00       	mov    $0x6,%edi
+  802037:	48 b8 55 1f 80 00 00 	movabs $0x801f55,%rax
+  80203e:	00 00 00 
+  802041:	ff d0                	call   *%rax
+}
+  802043:	5d                   	pop    %rbp
+  802044:	c3                   	ret
+
+0000000000802045 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802045:	55                   	push   %rbp
+  802046:	48 89 e5             	mov    %rsp,%rbp
+  802049:	41 54                	push   %r12
+  80204b:	53                   	push   %rbx
+  80204c:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80204f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802052:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802059:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80205b:	be 00 00 00 00       	mov    $0x0,%esi
+  802060:	bf 05 00 00 00       	mov    $0x5,%edi
+  802065:	48 b8 55 1f 80 00 00 	movabs $0x801f55,%rax
+  80206c:	00 00 00 
+  80206f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802071:	85 c0                	test   %eax,%eax
+  802073:	78 3d                	js     8020b2 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802075:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  80207c:	00 00 00 
+  80207f:	4c 89 e6             	mov    %r12,%rsi
+  802082:	48 89 df             	mov    %rbx,%rdi
+  802085:	48 b8 08 0d 80 00 00 	movabs $0x800d08,%rax
+  80208c:	00 00 00 
+  80208f:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802091:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802098:	00 
+  802099:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80209f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8020a6:	00 
+  8020a7:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8020ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020b2:	5b                   	pop    %rbx
+  8020b3:	41 5c                	pop    %r12
+  8020b5:	5d                   	pop    %rbp
+  8020b6:	c3                   	ret
+
+00000000008020b7 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8020b7:	55                   	push   %rbp
+  8020b8:	48 89 e5             	mov    %rsp,%rbp
+  8020bb:	41 54                	push   %r12
+  8020bd:	53                   	push   %rbx
+  8020be:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8020c1:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8020c6:	48 39 c2             	cmp    %rax,%rdx
+  8020c9:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8020cd:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8020d0:	48 89 c2             	mov    %rax,%rdx
+  8020d3:	48 bf 10 80 80 00 00 	movabs $0x808010,%rdi
+  8020da:	00 00 00 
+  8020dd:	48 b8 69 0f 80 00 00 	movabs $0x800f69,%rax
+  8020e4:	00 00 00 
+  8020e7:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020e9:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8020f0:	00 00 00 
+  8020f3:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8020f8:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8020fa:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8020fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802103:	bf 04 00 00 00       	mov    $0x4,%edi
+  802108:	48 b8 55 1f 80 00 00 	movabs $0x801f55,%rax
+  80210f:	00 00 00 
+  802112:	ff d0                	call   *%rax
+  802114:	48 98                	cltq
+}
+  802116:	5b                   	pop    %rbx
+  802117:	41 5c                	pop    %r12
+  802119:	5d                   	pop    %rbp
+  80211a:	c3                   	ret
+
+000000000080211b <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80211b:	55                   	push   %rbp
+  80211c:	48 89 e5             	mov    %rsp,%rbp
+  80211f:	41 54                	push   %r12
+  802121:	53                   	push   %rbx
+  802122:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802125:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80212c:	00 00 00 
+  80212f:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802132:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  802134:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802139:	48 39 ca             	cmp    %rcx,%rdx
+  80213c:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  802140:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  802144:	be 00 00 00 00       	mov    $0x0,%esi
+  802149:	bf 03 00 00 00       	mov    $0x3,%edi
+  80214e:	48 b8 55 1f 80 00 00 	movabs $0x801f55,%rax
+  802155:	00 00 00 
+  802158:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  80215a:	85 c0                	test   %eax,%eax
+  80215c:	78 27                	js     802185 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  80215e:	48 63 d8             	movslq %eax,%rbx
+  802161:	48 89 da             	mov    %rbx,%rdx
+  802164:	48 be 00 80 80 00 00 	movabs $0x808000,%rsi
+  80216b:	00 00 00 
+  80216e:	4c 89 e7             	mov    %r12,%rdi
+  802171:	48 b8 69 0f 80 00 00 	movabs $0x800f69,%rax
+  802178:	00 00 00 
+  80217b:	ff d0                	call   *%rax
+    return bytes_read;
+  80217d:	48 89 d8             	mov    %rbx,%rax
+}
+  802180:	5b                   	pop    %rbx
+  802181:	41 5c                	pop    %r12
+  802183:	5d                   	pop    %rbp
+  802184:	c3                   	ret
+        return bytes_read;
+  802185:	48 98                	cltq
+  802187:	eb f7                	jmp    802180 <devfile_read+0x65>
+
+0000000000802189 <open>:
+open(const char *path, int mode) {
+  802189:	55                   	push   %rbp
+  80218a:	48 89 e5             	mov    %rsp,%rbp
+  80218d:	41 55                	push   %r13
+  80218f:	41 54                	push   %r12
+  802191:	53                   	push   %rbx
+  802192:	48 83 ec 18          	sub    $0x18,%rsp
+  802196:	49 89 fc             	mov    %rdi,%r12
+  802199:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80219c:	48 b8 ca 0c 80 00 00 	movabs $0x800cca,%rax
+  8021a3:	00 00 00 
+  8021a6:	ff d0                	call   *%rax
+  8021a8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8021ae:	0f 87 8a 00 00 00    	ja     80223e <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8021b4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8021b8:	48 b8 88 18 80 00 00 	movabs $0x801888,%rax
+  8021bf:	00 00 00 
+  8021c2:	ff d0                	call   *%rax
+  8021c4:	89 c3                	mov    %eax,%ebx
+  8021c6:	85 c0                	test   %eax,%eax
+  8021c8:	78 50                	js     80221a <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8021ca:	4c 89 e6             	mov    %r12,%rsi
+  8021cd:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  8021d4:	00 00 00 
+  8021d7:	48 89 df             	mov    %rbx,%rdi
+  8021da:	48 b8 08 0d 80 00 00 	movabs $0x800d08,%rax
+  8021e1:	00 00 00 
+  8021e4:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8021e6:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021ed:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8021f1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8021f6:	48 b8 55 1f 80 00 00 	movabs $0x801f55,%rax
+  8021fd:	00 00 00 
+  802200:	ff d0                	call   *%rax
+  802202:	89 c3                	mov    %eax,%ebx
+  802204:	85 c0                	test   %eax,%eax
+  802206:	78 1f                	js     802227 <open+0x9e>
+    return fd2num(fd);
+  802208:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80220c:	48 b8 5a 18 80 00 00 	movabs $0x80185a,%rax
+  802213:	00 00 00 
+  802216:	ff d0                	call   *%rax
+  802218:	89 c3                	mov    %eax,%ebx
+}
+  80221a:	89 d8                	mov    %ebx,%eax
+  80221c:	48 83 c4 18          	add    $0x18,%rsp
+  802220:	5b                   	pop    %rbx
+  802221:	41 5c                	pop    %r12
+  802223:	41 5d                	pop    %r13
+  802225:	5d                   	pop    %rbp
+  802226:	c3                   	ret
+        fd_close(fd, 0);
+  802227:	be 00 00 00 00       	mov    $0x0,%esi
+  80222c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802230:	48 b8 a3 19 80 00 00 	movabs $0x8019a3,%rax
+  802237:	00 00 00 
+  80223a:	ff d0                	call   *%rax
+        return res;
+  80223c:	eb dc                	jmp    80221a <open+0x91>
+        return -E_BAD_PATH;
+  80223e:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802243:	eb d5                	jmp    80221a <open+0x91>
+
+0000000000802245 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802245:	55                   	push   %rbp
+  802246:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802249:	be 00 00 00 00       	mov    $0x0,%esi
+  80224e:	bf 08 00 00 00       	mov    $0x8,%edi
+  802253:	48 b8 55 1f 80 00 00 	movabs $0x801f55,%rax
+  80225a:	00 00 00 
+  80225d:	ff d0                	call   *%rax
+}
+  80225f:	5d                   	pop    %rbp
+  802260:	c3                   	ret
+
+0000000000802261 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  802261:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  802265:	7f 01                	jg     802268 <writebuf+0x7>
+  802267:	c3                   	ret
+writebuf(struct printbuf *state) {
+  802268:	55                   	push   %rbp
+  802269:	48 89 e5             	mov    %rsp,%rbp
+  80226c:	53                   	push   %rbx
+  80226d:	48 83 ec 08          	sub    $0x8,%rsp
+  802271:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  802274:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  802278:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  80227c:	8b 3f                	mov    (%rdi),%edi
+  80227e:	48 b8 fa 1c 80 00 00 	movabs $0x801cfa,%rax
+  802285:	00 00 00 
+  802288:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  80228a:	48 85 c0             	test   %rax,%rax
+  80228d:	7e 04                	jle    802293 <writebuf+0x32>
+  80228f:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  802293:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  802297:	48 39 c2             	cmp    %rax,%rdx
+  80229a:	74 0f                	je     8022ab <writebuf+0x4a>
+            state->error = MIN(0, result);
+  80229c:	48 85 c0             	test   %rax,%rax
+  80229f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a4:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8022a8:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  8022ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022af:	c9                   	leave
+  8022b0:	c3                   	ret
+
+00000000008022b1 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  8022b1:	8b 46 04             	mov    0x4(%rsi),%eax
+  8022b4:	8d 50 01             	lea    0x1(%rax),%edx
+  8022b7:	89 56 04             	mov    %edx,0x4(%rsi)
+  8022ba:	48 98                	cltq
+  8022bc:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  8022c1:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8022c7:	74 01                	je     8022ca <putch+0x19>
+  8022c9:	c3                   	ret
+putch(int ch, void *arg) {
+  8022ca:	55                   	push   %rbp
+  8022cb:	48 89 e5             	mov    %rsp,%rbp
+  8022ce:	53                   	push   %rbx
+  8022cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8022d3:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  8022d6:	48 89 f7             	mov    %rsi,%rdi
+  8022d9:	48 b8 61 22 80 00 00 	movabs $0x802261,%rax
+  8022e0:	00 00 00 
+  8022e3:	ff d0                	call   *%rax
+        state->offset = 0;
+  8022e5:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  8022ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022f0:	c9                   	leave
+  8022f1:	c3                   	ret
+
+00000000008022f2 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8022f2:	55                   	push   %rbp
+  8022f3:	48 89 e5             	mov    %rsp,%rbp
+  8022f6:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8022fd:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  802300:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  802306:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  80230d:	00 00 00 
+    state.result = 0;
+  802310:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  802317:	00 00 00 00 
+    state.error = 1;
+  80231b:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  802322:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  802325:	48 89 f2             	mov    %rsi,%rdx
+  802328:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  80232f:	48 bf b1 22 80 00 00 	movabs $0x8022b1,%rdi
+  802336:	00 00 00 
+  802339:	48 b8 33 05 80 00 00 	movabs $0x800533,%rax
+  802340:	00 00 00 
+  802343:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  802345:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  80234c:	7f 14                	jg     802362 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  80234e:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  802355:	48 85 c0             	test   %rax,%rax
+  802358:	75 06                	jne    802360 <vfprintf+0x6e>
+  80235a:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  802360:	c9                   	leave
+  802361:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  802362:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  802369:	48 b8 61 22 80 00 00 	movabs $0x802261,%rax
+  802370:	00 00 00 
+  802373:	ff d0                	call   *%rax
+  802375:	eb d7                	jmp    80234e <vfprintf+0x5c>
+
+0000000000802377 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  802377:	55                   	push   %rbp
+  802378:	48 89 e5             	mov    %rsp,%rbp
+  80237b:	48 83 ec 50          	sub    $0x50,%rsp
+  80237f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802383:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802387:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80238b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80238f:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802396:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80239a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80239e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8023a2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  8023a6:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8023aa:	48 b8 f2 22 80 00 00 	movabs $0x8022f2,%rax
+  8023b1:	00 00 00 
+  8023b4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8023b6:	c9                   	leave
+  8023b7:	c3                   	ret
+
+00000000008023b8 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8023b8:	55                   	push   %rbp
+  8023b9:	48 89 e5             	mov    %rsp,%rbp
+  8023bc:	48 83 ec 50          	sub    $0x50,%rsp
+  8023c0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8023c4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8023c8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8023cc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8023d0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8023d4:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8023db:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8023df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023e3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8023e7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8023eb:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8023ef:	48 89 fe             	mov    %rdi,%rsi
+  8023f2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023f7:	48 b8 f2 22 80 00 00 	movabs $0x8022f2,%rax
+  8023fe:	00 00 00 
+  802401:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  802403:	c9                   	leave
+  802404:	c3                   	ret
+
+0000000000802405 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802405:	55                   	push   %rbp
+  802406:	48 89 e5             	mov    %rsp,%rbp
+  802409:	41 54                	push   %r12
+  80240b:	53                   	push   %rbx
+  80240c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80240f:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  802416:	00 00 00 
+  802419:	ff d0                	call   *%rax
+  80241b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80241e:	48 be 00 35 80 00 00 	movabs $0x803500,%rsi
+  802425:	00 00 00 
+  802428:	48 89 df             	mov    %rbx,%rdi
+  80242b:	48 b8 08 0d 80 00 00 	movabs $0x800d08,%rax
+  802432:	00 00 00 
+  802435:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802437:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80243c:	41 2b 04 24          	sub    (%r12),%eax
+  802440:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802446:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80244d:	00 00 00 
+    stat->st_dev = &devpipe;
+  802450:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802457:	00 00 00 
+  80245a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802461:	b8 00 00 00 00       	mov    $0x0,%eax
+  802466:	5b                   	pop    %rbx
+  802467:	41 5c                	pop    %r12
+  802469:	5d                   	pop    %rbp
+  80246a:	c3                   	ret
+
+000000000080246b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80246b:	55                   	push   %rbp
+  80246c:	48 89 e5             	mov    %rsp,%rbp
+  80246f:	41 54                	push   %r12
+  802471:	53                   	push   %rbx
+  802472:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802475:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80247a:	48 89 fe             	mov    %rdi,%rsi
+  80247d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802482:	49 bc 84 13 80 00 00 	movabs $0x801384,%r12
+  802489:	00 00 00 
+  80248c:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80248f:	48 89 df             	mov    %rbx,%rdi
+  802492:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  802499:	00 00 00 
+  80249c:	ff d0                	call   *%rax
+  80249e:	48 89 c6             	mov    %rax,%rsi
+  8024a1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024ab:	41 ff d4             	call   *%r12
+}
+  8024ae:	5b                   	pop    %rbx
+  8024af:	41 5c                	pop    %r12
+  8024b1:	5d                   	pop    %rbp
+  8024b2:	c3                   	ret
+
+00000000008024b3 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8024b3:	55                   	push   %rbp
+  8024b4:	48 89 e5             	mov    %rsp,%rbp
+  8024b7:	41 57                	push   %r15
+  8024b9:	41 56                	push   %r14
+  8024bb:	41 55                	push   %r13
+  8024bd:	41 54                	push   %r12
+  8024bf:	53                   	push   %rbx
+  8024c0:	48 83 ec 18          	sub    $0x18,%rsp
+  8024c4:	49 89 fc             	mov    %rdi,%r12
+  8024c7:	49 89 f5             	mov    %rsi,%r13
+  8024ca:	49 89 d7             	mov    %rdx,%r15
+  8024cd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024d1:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  8024d8:	00 00 00 
+  8024db:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8024dd:	4d 85 ff             	test   %r15,%r15
+  8024e0:	0f 84 af 00 00 00    	je     802595 <devpipe_write+0xe2>
+  8024e6:	48 89 c3             	mov    %rax,%rbx
+  8024e9:	4c 89 f8             	mov    %r15,%rax
+  8024ec:	4d 89 ef             	mov    %r13,%r15
+  8024ef:	4c 01 e8             	add    %r13,%rax
+  8024f2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8024f6:	49 bd 8c 12 80 00 00 	movabs $0x80128c,%r13
+  8024fd:	00 00 00 
+            sys_yield();
+  802500:	49 be 29 12 80 00 00 	movabs $0x801229,%r14
+  802507:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80250a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80250d:	48 63 ce             	movslq %esi,%rcx
+  802510:	48 63 03             	movslq (%rbx),%rax
+  802513:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802519:	48 39 c1             	cmp    %rax,%rcx
+  80251c:	72 2e                	jb     80254c <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80251e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802523:	48 89 da             	mov    %rbx,%rdx
+  802526:	be 00 10 00 00       	mov    $0x1000,%esi
+  80252b:	4c 89 e7             	mov    %r12,%rdi
+  80252e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802531:	85 c0                	test   %eax,%eax
+  802533:	74 66                	je     80259b <devpipe_write+0xe8>
+            sys_yield();
+  802535:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802538:	8b 73 04             	mov    0x4(%rbx),%esi
+  80253b:	48 63 ce             	movslq %esi,%rcx
+  80253e:	48 63 03             	movslq (%rbx),%rax
+  802541:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802547:	48 39 c1             	cmp    %rax,%rcx
+  80254a:	73 d2                	jae    80251e <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80254c:	41 0f b6 3f          	movzbl (%r15),%edi
+  802550:	48 89 ca             	mov    %rcx,%rdx
+  802553:	48 c1 ea 03          	shr    $0x3,%rdx
+  802557:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80255e:	08 10 20 
+  802561:	48 f7 e2             	mul    %rdx
+  802564:	48 c1 ea 06          	shr    $0x6,%rdx
+  802568:	48 89 d0             	mov    %rdx,%rax
+  80256b:	48 c1 e0 09          	shl    $0x9,%rax
+  80256f:	48 29 d0             	sub    %rdx,%rax
+  802572:	48 c1 e0 03          	shl    $0x3,%rax
+  802576:	48 29 c1             	sub    %rax,%rcx
+  802579:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80257e:	83 c6 01             	add    $0x1,%esi
+  802581:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802584:	49 83 c7 01          	add    $0x1,%r15
+  802588:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80258c:	49 39 c7             	cmp    %rax,%r15
+  80258f:	0f 85 75 ff ff ff    	jne    80250a <devpipe_write+0x57>
+    return n;
+  802595:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802599:	eb 05                	jmp    8025a0 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80259b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025a0:	48 83 c4 18          	add    $0x18,%rsp
+  8025a4:	5b                   	pop    %rbx
+  8025a5:	41 5c                	pop    %r12
+  8025a7:	41 5d                	pop    %r13
+  8025a9:	41 5e                	pop    %r14
+  8025ab:	41 5f                	pop    %r15
+  8025ad:	5d                   	pop    %rbp
+  8025ae:	c3                   	ret
+
+00000000008025af <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8025af:	55                   	push   %rbp
+  8025b0:	48 89 e5             	mov    %rsp,%rbp
+  8025b3:	41 57                	push   %r15
+  8025b5:	41 56                	push   %r14
+  8025b7:	41 55                	push   %r13
+  8025b9:	41 54                	push   %r12
+  8025bb:	53                   	push   %rbx
+  8025bc:	48 83 ec 18          	sub    $0x18,%rsp
+  8025c0:	49 89 fc             	mov    %rdi,%r12
+  8025c3:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8025c7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025cb:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  8025d2:	00 00 00 
+  8025d5:	ff d0                	call   *%rax
+  8025d7:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8025da:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025e0:	49 bd 8c 12 80 00 00 	movabs $0x80128c,%r13
+  8025e7:	00 00 00 
+            sys_yield();
+  8025ea:	49 be 29 12 80 00 00 	movabs $0x801229,%r14
+  8025f1:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8025f4:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8025f9:	74 7d                	je     802678 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8025fb:	8b 03                	mov    (%rbx),%eax
+  8025fd:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802600:	75 26                	jne    802628 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802602:	4d 85 ff             	test   %r15,%r15
+  802605:	75 77                	jne    80267e <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802607:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80260c:	48 89 da             	mov    %rbx,%rdx
+  80260f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802614:	4c 89 e7             	mov    %r12,%rdi
+  802617:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80261a:	85 c0                	test   %eax,%eax
+  80261c:	74 72                	je     802690 <devpipe_read+0xe1>
+            sys_yield();
+  80261e:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802621:	8b 03                	mov    (%rbx),%eax
+  802623:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802626:	74 df                	je     802607 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802628:	48 63 c8             	movslq %eax,%rcx
+  80262b:	48 89 ca             	mov    %rcx,%rdx
+  80262e:	48 c1 ea 03          	shr    $0x3,%rdx
+  802632:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802639:	08 10 20 
+  80263c:	48 89 d0             	mov    %rdx,%rax
+  80263f:	48 f7 e6             	mul    %rsi
+  802642:	48 c1 ea 06          	shr    $0x6,%rdx
+  802646:	48 89 d0             	mov    %rdx,%rax
+  802649:	48 c1 e0 09          	shl    $0x9,%rax
+  80264d:	48 29 d0             	sub    %rdx,%rax
+  802650:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802657:	00 
+  802658:	48 89 c8             	mov    %rcx,%rax
+  80265b:	48 29 d0             	sub    %rdx,%rax
+  80265e:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802663:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802667:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80266b:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80266e:	49 83 c7 01          	add    $0x1,%r15
+  802672:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802676:	75 83                	jne    8025fb <devpipe_read+0x4c>
+    return n;
+  802678:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80267c:	eb 03                	jmp    802681 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80267e:	4c 89 f8             	mov    %r15,%rax
+}
+  802681:	48 83 c4 18          	add    $0x18,%rsp
+  802685:	5b                   	pop    %rbx
+  802686:	41 5c                	pop    %r12
+  802688:	41 5d                	pop    %r13
+  80268a:	41 5e                	pop    %r14
+  80268c:	41 5f                	pop    %r15
+  80268e:	5d                   	pop    %rbp
+  80268f:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802690:	b8 00 00 00 00       	mov    $0x0,%eax
+  802695:	eb ea                	jmp    802681 <devpipe_read+0xd2>
+
+0000000000802697 <pipe>:
+pipe(int pfd[2]) {
+  802697:	55                   	push   %rbp
+  802698:	48 89 e5             	mov    %rsp,%rbp
+  80269b:	41 55                	push   %r13
+  80269d:	41 54                	push   %r12
+  80269f:	53                   	push   %rbx
+  8026a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8026a4:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8026a7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8026ab:	48 b8 88 18 80 00 00 	movabs $0x801888,%rax
+  8026b2:	00 00 00 
+  8026b5:	ff d0                	call   *%rax
+  8026b7:	89 c3                	mov    %eax,%ebx
+  8026b9:	85 c0                	test   %eax,%eax
+  8026bb:	0f 88 a0 01 00 00    	js     802861 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8026c1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8026c6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026cb:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8026cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026d4:	48 b8 b8 12 80 00 00 	movabs $0x8012b8,%rax
+  8026db:	00 00 00 
+  8026de:	ff d0                	call   *%rax
+  8026e0:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8026e2:	85 c0                	test   %eax,%eax
+  8026e4:	0f 88 77 01 00 00    	js     802861 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8026ea:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8026ee:	48 b8 88 18 80 00 00 	movabs $0x801888,%rax
+  8026f5:	00 00 00 
+  8026f8:	ff d0                	call   *%rax
+  8026fa:	89 c3                	mov    %eax,%ebx
+  8026fc:	85 c0                	test   %eax,%eax
+  8026fe:	0f 88 43 01 00 00    	js     802847 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802704:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802709:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80270e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802712:	bf 00 00 00 00       	mov    $0x0,%edi
+  802717:	48 b8 b8 12 80 00 00 	movabs $0x8012b8,%rax
+  80271e:	00 00 00 
+  802721:	ff d0                	call   *%rax
+  802723:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802725:	85 c0                	test   %eax,%eax
+  802727:	0f 88 1a 01 00 00    	js     802847 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80272d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802731:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  802738:	00 00 00 
+  80273b:	ff d0                	call   *%rax
+  80273d:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802740:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802745:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80274a:	48 89 c6             	mov    %rax,%rsi
+  80274d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802752:	48 b8 b8 12 80 00 00 	movabs $0x8012b8,%rax
+  802759:	00 00 00 
+  80275c:	ff d0                	call   *%rax
+  80275e:	89 c3                	mov    %eax,%ebx
+  802760:	85 c0                	test   %eax,%eax
+  802762:	0f 88 c5 00 00 00    	js     80282d <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802768:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80276c:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  802773:	00 00 00 
+  802776:	ff d0                	call   *%rax
+  802778:	48 89 c1             	mov    %rax,%rcx
+  80277b:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802781:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802787:	ba 00 00 00 00       	mov    $0x0,%edx
+  80278c:	4c 89 ee             	mov    %r13,%rsi
+  80278f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802794:	48 b8 1f 13 80 00 00 	movabs $0x80131f,%rax
+  80279b:	00 00 00 
+  80279e:	ff d0                	call   *%rax
+  8027a0:	89 c3                	mov    %eax,%ebx
+  8027a2:	85 c0                	test   %eax,%eax
+  8027a4:	78 6e                	js     802814 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8027a6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8027ab:	4c 89 ef             	mov    %r13,%rdi
+  8027ae:	48 b8 5a 12 80 00 00 	movabs $0x80125a,%rax
+  8027b5:	00 00 00 
+  8027b8:	ff d0                	call   *%rax
+  8027ba:	83 f8 02             	cmp    $0x2,%eax
+  8027bd:	0f 85 ab 00 00 00    	jne    80286e <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8027c3:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8027ca:	00 00 
+  8027cc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8027d0:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8027d2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8027d6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8027dd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8027e1:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8027e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027e7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8027ee:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027f2:	48 bb 5a 18 80 00 00 	movabs $0x80185a,%rbx
+  8027f9:	00 00 00 
+  8027fc:	ff d3                	call   *%rbx
+  8027fe:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802802:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802806:	ff d3                	call   *%rbx
+  802808:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80280d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802812:	eb 4d                	jmp    802861 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802814:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802819:	4c 89 ee             	mov    %r13,%rsi
+  80281c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802821:	48 b8 84 13 80 00 00 	movabs $0x801384,%rax
+  802828:	00 00 00 
+  80282b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80282d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802832:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802836:	bf 00 00 00 00       	mov    $0x0,%edi
+  80283b:	48 b8 84 13 80 00 00 	movabs $0x801384,%rax
+  802842:	00 00 00 
+  802845:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802847:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80284c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802850:	bf 00 00 00 00       	mov    $0x0,%edi
+  802855:	48 b8 84 13 80 00 00 	movabs $0x801384,%rax
+  80285c:	00 00 00 
+  80285f:	ff d0                	call   *%rax
+}
+  802861:	89 d8                	mov    %ebx,%eax
+  802863:	48 83 c4 18          	add    $0x18,%rsp
+  802867:	5b                   	pop    %rbx
+  802868:	41 5c                	pop    %r12
+  80286a:	41 5d                	pop    %r13
+  80286c:	5d                   	pop    %rbp
+  80286d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80286e:	48 b9 30 35 80 00 00 	movabs $0x803530,%rcx
+  802875:	00 00 00 
+  802878:	48 ba 07 35 80 00 00 	movabs $0x803507,%rdx
+  80287f:	00 00 00 
+  802882:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802887:	48 bf 1c 35 80 00 00 	movabs $0x80351c,%rdi
+  80288e:	00 00 00 
+  802891:	b8 00 00 00 00       	mov    $0x0,%eax
+  802896:	49 b8 93 02 80 00 00 	movabs $0x800293,%r8
+  80289d:	00 00 00 
+  8028a0:	41 ff d0             	call   *%r8
+
+00000000008028a3 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8028a3:	55                   	push   %rbp
+  8028a4:	48 89 e5             	mov    %rsp,%rbp
+  8028a7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8028ab:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8028af:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  8028b6:	00 00 00 
+  8028b9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028bb:	85 c0                	test   %eax,%eax
+  8028bd:	78 35                	js     8028f4 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8028bf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8028c3:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  8028ca:	00 00 00 
+  8028cd:	ff d0                	call   *%rax
+  8028cf:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8028d2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8028d7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028dc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8028e0:	48 b8 8c 12 80 00 00 	movabs $0x80128c,%rax
+  8028e7:	00 00 00 
+  8028ea:	ff d0                	call   *%rax
+  8028ec:	85 c0                	test   %eax,%eax
+  8028ee:	0f 94 c0             	sete   %al
+  8028f1:	0f b6 c0             	movzbl %al,%eax
+}
+  8028f4:	c9                   	leave
+  8028f5:	c3                   	ret
+
+00000000008028f6 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8028f6:	48 89 f8             	mov    %rdi,%rax
+  8028f9:	48 c1 e8 27          	shr    $0x27,%rax
+  8028fd:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802904:	01 00 00 
+  802907:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80290b:	f6 c2 01             	test   $0x1,%dl
+  80290e:	74 6d                	je     80297d <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802910:	48 89 f8             	mov    %rdi,%rax
+  802913:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802917:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80291e:	01 00 00 
+  802921:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802925:	f6 c2 01             	test   $0x1,%dl
+  802928:	74 62                	je     80298c <get_uvpt_entry+0x96>
+  80292a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802931:	01 00 00 
+  802934:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802938:	f6 c2 80             	test   $0x80,%dl
+  80293b:	75 4f                	jne    80298c <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80293d:	48 89 f8             	mov    %rdi,%rax
+  802940:	48 c1 e8 15          	shr    $0x15,%rax
+  802944:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80294b:	01 00 00 
+  80294e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802952:	f6 c2 01             	test   $0x1,%dl
+  802955:	74 44                	je     80299b <get_uvpt_entry+0xa5>
+  802957:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80295e:	01 00 00 
+  802961:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802965:	f6 c2 80             	test   $0x80,%dl
+  802968:	75 31                	jne    80299b <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80296a:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80296e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802975:	01 00 00 
+  802978:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80297c:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80297d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802984:	01 00 00 
+  802987:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80298b:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80298c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802993:	01 00 00 
+  802996:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80299a:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80299b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8029a2:	01 00 00 
+  8029a5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029a9:	c3                   	ret
+
+00000000008029aa <get_prot>:
+
+int
+get_prot(void *va) {
+  8029aa:	55                   	push   %rbp
+  8029ab:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8029ae:	48 b8 f6 28 80 00 00 	movabs $0x8028f6,%rax
+  8029b5:	00 00 00 
+  8029b8:	ff d0                	call   *%rax
+  8029ba:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8029bd:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8029c2:	89 c1                	mov    %eax,%ecx
+  8029c4:	83 c9 04             	or     $0x4,%ecx
+  8029c7:	f6 c2 01             	test   $0x1,%dl
+  8029ca:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8029cd:	89 c1                	mov    %eax,%ecx
+  8029cf:	83 c9 02             	or     $0x2,%ecx
+  8029d2:	f6 c2 02             	test   $0x2,%dl
+  8029d5:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8029d8:	89 c1                	mov    %eax,%ecx
+  8029da:	83 c9 01             	or     $0x1,%ecx
+  8029dd:	48 85 d2             	test   %rdx,%rdx
+  8029e0:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8029e3:	89 c1                	mov    %eax,%ecx
+  8029e5:	83 c9 40             	or     $0x40,%ecx
+  8029e8:	f6 c6 04             	test   $0x4,%dh
+  8029eb:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8029ee:	5d                   	pop    %rbp
+  8029ef:	c3                   	ret
+
+00000000008029f0 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8029f0:	55                   	push   %rbp
+  8029f1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8029f4:	48 b8 f6 28 80 00 00 	movabs $0x8028f6,%rax
+  8029fb:	00 00 00 
+  8029fe:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802a00:	48 c1 e8 06          	shr    $0x6,%rax
+  802a04:	83 e0 01             	and    $0x1,%eax
+}
+  802a07:	5d                   	pop    %rbp
+  802a08:	c3                   	ret
+
+0000000000802a09 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802a09:	55                   	push   %rbp
+  802a0a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802a0d:	48 b8 f6 28 80 00 00 	movabs $0x8028f6,%rax
+  802a14:	00 00 00 
+  802a17:	ff d0                	call   *%rax
+  802a19:	83 e0 01             	and    $0x1,%eax
+}
+  802a1c:	5d                   	pop    %rbp
+  802a1d:	c3                   	ret
+
+0000000000802a1e <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802a1e:	55                   	push   %rbp
+  802a1f:	48 89 e5             	mov    %rsp,%rbp
+  802a22:	41 57                	push   %r15
+  802a24:	41 56                	push   %r14
+  802a26:	41 55                	push   %r13
+  802a28:	41 54                	push   %r12
+  802a2a:	53                   	push   %rbx
+  802a2b:	48 83 ec 18          	sub    $0x18,%rsp
+  802a2f:	49 89 ff             	mov    %rdi,%r15
+  802a32:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802a36:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802a3b:	49 bc 09 2a 80 00 00 	movabs $0x802a09,%r12
+  802a42:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802a45:	49 be aa 29 80 00 00 	movabs $0x8029aa,%r14
+  802a4c:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802a4f:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802a56:	00 00 00 
+  802a59:	eb 0c                	jmp    802a67 <foreach_shared_region+0x49>
+  802a5b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802a62:	4c 39 eb             	cmp    %r13,%rbx
+  802a65:	74 38                	je     802a9f <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802a67:	48 89 df             	mov    %rbx,%rdi
+  802a6a:	41 ff d4             	call   *%r12
+  802a6d:	84 c0                	test   %al,%al
+  802a6f:	74 ea                	je     802a5b <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802a71:	48 89 df             	mov    %rbx,%rdi
+  802a74:	41 ff d6             	call   *%r14
+  802a77:	a8 40                	test   $0x40,%al
+  802a79:	74 e0                	je     802a5b <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802a7b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802a82:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802a86:	48 89 df             	mov    %rbx,%rdi
+  802a89:	41 ff d7             	call   *%r15
+        if (err)
+  802a8c:	85 c0                	test   %eax,%eax
+  802a8e:	74 cb                	je     802a5b <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802a90:	48 83 c4 18          	add    $0x18,%rsp
+  802a94:	5b                   	pop    %rbx
+  802a95:	41 5c                	pop    %r12
+  802a97:	41 5d                	pop    %r13
+  802a99:	41 5e                	pop    %r14
+  802a9b:	41 5f                	pop    %r15
+  802a9d:	5d                   	pop    %rbp
+  802a9e:	c3                   	ret
+    return 0;
+  802a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa4:	eb ea                	jmp    802a90 <foreach_shared_region+0x72>
+
+0000000000802aa6 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aab:	c3                   	ret
+
+0000000000802aac <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802aac:	55                   	push   %rbp
+  802aad:	48 89 e5             	mov    %rsp,%rbp
+  802ab0:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802ab3:	48 be 54 35 80 00 00 	movabs $0x803554,%rsi
+  802aba:	00 00 00 
+  802abd:	48 b8 08 0d 80 00 00 	movabs $0x800d08,%rax
+  802ac4:	00 00 00 
+  802ac7:	ff d0                	call   *%rax
+    return 0;
+}
+  802ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ace:	5d                   	pop    %rbp
+  802acf:	c3                   	ret
+
+0000000000802ad0 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802ad0:	55                   	push   %rbp
+  802ad1:	48 89 e5             	mov    %rsp,%rbp
+  802ad4:	41 57                	push   %r15
+  802ad6:	41 56                	push   %r14
+  802ad8:	41 55                	push   %r13
+  802ada:	41 54                	push   %r12
+  802adc:	53                   	push   %rbx
+  802add:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802ae4:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802aeb:	48 85 d2             	test   %rdx,%rdx
+  802aee:	74 7a                	je     802b6a <devcons_write+0x9a>
+  802af0:	49 89 d6             	mov    %rdx,%r14
+  802af3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802af9:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802afe:	49 bf 02 0f 80 00 00 	movabs $0x800f02,%r15
+  802b05:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802b08:	4c 89 f3             	mov    %r14,%rbx
+  802b0b:	48 29 f3             	sub    %rsi,%rbx
+  802b0e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802b13:	48 39 c3             	cmp    %rax,%rbx
+  802b16:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802b1a:	4c 63 eb             	movslq %ebx,%r13
+  802b1d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802b24:	48 01 c6             	add    %rax,%rsi
+  802b27:	4c 89 ea             	mov    %r13,%rdx
+  802b2a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802b31:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802b34:	4c 89 ee             	mov    %r13,%rsi
+  802b37:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802b3e:	48 b8 2f 11 80 00 00 	movabs $0x80112f,%rax
+  802b45:	00 00 00 
+  802b48:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802b4a:	41 01 dc             	add    %ebx,%r12d
+  802b4d:	49 63 f4             	movslq %r12d,%rsi
+  802b50:	4c 39 f6             	cmp    %r14,%rsi
+  802b53:	72 b3                	jb     802b08 <devcons_write+0x38>
+    return res;
+  802b55:	49 63 c4             	movslq %r12d,%rax
+}
+  802b58:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802b5f:	5b                   	pop    %rbx
+  802b60:	41 5c                	pop    %r12
+  802b62:	41 5d                	pop    %r13
+  802b64:	41 5e                	pop    %r14
+  802b66:	41 5f                	pop    %r15
+  802b68:	5d                   	pop    %rbp
+  802b69:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802b6a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802b70:	eb e3                	jmp    802b55 <devcons_write+0x85>
+
+0000000000802b72 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802b72:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802b75:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b7a:	48 85 c0             	test   %rax,%rax
+  802b7d:	74 55                	je     802bd4 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802b7f:	55                   	push   %rbp
+  802b80:	48 89 e5             	mov    %rsp,%rbp
+  802b83:	41 55                	push   %r13
+  802b85:	41 54                	push   %r12
+  802b87:	53                   	push   %rbx
+  802b88:	48 83 ec 08          	sub    $0x8,%rsp
+  802b8c:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802b8f:	48 bb 5c 11 80 00 00 	movabs $0x80115c,%rbx
+  802b96:	00 00 00 
+  802b99:	49 bc 29 12 80 00 00 	movabs $0x801229,%r12
+  802ba0:	00 00 00 
+  802ba3:	eb 03                	jmp    802ba8 <devcons_read+0x36>
+  802ba5:	41 ff d4             	call   *%r12
+  802ba8:	ff d3                	call   *%rbx
+  802baa:	85 c0                	test   %eax,%eax
+  802bac:	74 f7                	je     802ba5 <devcons_read+0x33>
+    if (c < 0) return c;
+  802bae:	48 63 d0             	movslq %eax,%rdx
+  802bb1:	78 13                	js     802bc6 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802bb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bb8:	83 f8 04             	cmp    $0x4,%eax
+  802bbb:	74 09                	je     802bc6 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802bbd:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802bc1:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802bc6:	48 89 d0             	mov    %rdx,%rax
+  802bc9:	48 83 c4 08          	add    $0x8,%rsp
+  802bcd:	5b                   	pop    %rbx
+  802bce:	41 5c                	pop    %r12
+  802bd0:	41 5d                	pop    %r13
+  802bd2:	5d                   	pop    %rbp
+  802bd3:	c3                   	ret
+  802bd4:	48 89 d0             	mov    %rdx,%rax
+  802bd7:	c3                   	ret
+
+0000000000802bd8 <cputchar>:
+cputchar(int ch) {
+  802bd8:	55                   	push   %rbp
+  802bd9:	48 89 e5             	mov    %rsp,%rbp
+  802bdc:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802be0:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802be4:	be 01 00 00 00       	mov    $0x1,%esi
+  802be9:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802bed:	48 b8 2f 11 80 00 00 	movabs $0x80112f,%rax
+  802bf4:	00 00 00 
+  802bf7:	ff d0                	call   *%rax
+}
+  802bf9:	c9                   	leave
+  802bfa:	c3                   	ret
+
+0000000000802bfb <getchar>:
+getchar(void) {
+  802bfb:	55                   	push   %rbp
+  802bfc:	48 89 e5             	mov    %rsp,%rbp
+  802bff:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802c03:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c08:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802c0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c11:	48 b8 cb 1b 80 00 00 	movabs $0x801bcb,%rax
+  802c18:	00 00 00 
+  802c1b:	ff d0                	call   *%rax
+  802c1d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802c1f:	85 c0                	test   %eax,%eax
+  802c21:	78 06                	js     802c29 <getchar+0x2e>
+  802c23:	74 08                	je     802c2d <getchar+0x32>
+  802c25:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802c29:	89 d0                	mov    %edx,%eax
+  802c2b:	c9                   	leave
+  802c2c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802c2d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802c32:	eb f5                	jmp    802c29 <getchar+0x2e>
+
+0000000000802c34 <iscons>:
+iscons(int fdnum) {
+  802c34:	55                   	push   %rbp
+  802c35:	48 89 e5             	mov    %rsp,%rbp
+  802c38:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802c3c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802c40:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  802c47:	00 00 00 
+  802c4a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c4c:	85 c0                	test   %eax,%eax
+  802c4e:	78 18                	js     802c68 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802c50:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c54:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802c5b:	00 00 00 
+  802c5e:	8b 00                	mov    (%rax),%eax
+  802c60:	39 02                	cmp    %eax,(%rdx)
+  802c62:	0f 94 c0             	sete   %al
+  802c65:	0f b6 c0             	movzbl %al,%eax
+}
+  802c68:	c9                   	leave
+  802c69:	c3                   	ret
+
+0000000000802c6a <opencons>:
+opencons(void) {
+  802c6a:	55                   	push   %rbp
+  802c6b:	48 89 e5             	mov    %rsp,%rbp
+  802c6e:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802c72:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802c76:	48 b8 88 18 80 00 00 	movabs $0x801888,%rax
+  802c7d:	00 00 00 
+  802c80:	ff d0                	call   *%rax
+  802c82:	85 c0                	test   %eax,%eax
+  802c84:	78 49                	js     802ccf <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802c86:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802c8b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c90:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802c94:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c99:	48 b8 b8 12 80 00 00 	movabs $0x8012b8,%rax
+  802ca0:	00 00 00 
+  802ca3:	ff d0                	call   *%rax
+  802ca5:	85 c0                	test   %eax,%eax
+  802ca7:	78 26                	js     802ccf <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802ca9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802cad:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802cb4:	00 00 
+  802cb6:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802cb8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802cbc:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802cc3:	48 b8 5a 18 80 00 00 	movabs $0x80185a,%rax
+  802cca:	00 00 00 
+  802ccd:	ff d0                	call   *%rax
+}
+  802ccf:	c9                   	leave
+  802cd0:	c3                   	ret
+
+0000000000802cd1 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802cd1:	55                   	push   %rbp
+  802cd2:	48 89 e5             	mov    %rsp,%rbp
+  802cd5:	41 54                	push   %r12
+  802cd7:	53                   	push   %rbx
+  802cd8:	48 89 fb             	mov    %rdi,%rbx
+  802cdb:	48 89 f7             	mov    %rsi,%rdi
+  802cde:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802ce1:	48 85 f6             	test   %rsi,%rsi
+  802ce4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ceb:	00 00 00 
+  802cee:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802cf2:	be 00 10 00 00       	mov    $0x1000,%esi
+  802cf7:	48 b8 22 16 80 00 00 	movabs $0x801622,%rax
+  802cfe:	00 00 00 
+  802d01:	ff d0                	call   *%rax
+    if (res < 0) {
+  802d03:	85 c0                	test   %eax,%eax
+  802d05:	78 45                	js     802d4c <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802d07:	48 85 db             	test   %rbx,%rbx
+  802d0a:	74 12                	je     802d1e <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802d0c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802d13:	00 00 00 
+  802d16:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802d1c:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802d1e:	4d 85 e4             	test   %r12,%r12
+  802d21:	74 14                	je     802d37 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802d23:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802d2a:	00 00 00 
+  802d2d:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802d33:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802d37:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802d3e:	00 00 00 
+  802d41:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802d47:	5b                   	pop    %rbx
+  802d48:	41 5c                	pop    %r12
+  802d4a:	5d                   	pop    %rbp
+  802d4b:	c3                   	ret
+        if (from_env_store)
+  802d4c:	48 85 db             	test   %rbx,%rbx
+  802d4f:	74 06                	je     802d57 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802d51:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802d57:	4d 85 e4             	test   %r12,%r12
+  802d5a:	74 eb                	je     802d47 <ipc_recv+0x76>
+            *perm_store = 0;
+  802d5c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802d63:	00 
+  802d64:	eb e1                	jmp    802d47 <ipc_recv+0x76>
+
+0000000000802d66 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802d66:	55                   	push   %rbp
+  802d67:	48 89 e5             	mov    %rsp,%rbp
+  802d6a:	41 57                	push   %r15
+  802d6c:	41 56                	push   %r14
+  802d6e:	41 55                	push   %r13
+  802d70:	41 54                	push   %r12
+  802d72:	53                   	push   %rbx
+  802d73:	48 83 ec 18          	sub    $0x18,%rsp
+  802d77:	41 89 fd             	mov    %edi,%r13d
+  802d7a:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802d7d:	48 89 d3             	mov    %rdx,%rbx
+  802d80:	49 89 cc             	mov    %rcx,%r12
+  802d83:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802d87:	48 85 d2             	test   %rdx,%rdx
+  802d8a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802d91:	00 00 00 
+  802d94:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802d98:	49 be f6 15 80 00 00 	movabs $0x8015f6,%r14
+  802d9f:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802da2:	49 bf 29 12 80 00 00 	movabs $0x801229,%r15
+  802da9:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802dac:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802daf:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802db3:	4c 89 e1             	mov    %r12,%rcx
+  802db6:	48 89 da             	mov    %rbx,%rdx
+  802db9:	44 89 ef             	mov    %r13d,%edi
+  802dbc:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802dbf:	85 c0                	test   %eax,%eax
+  802dc1:	74 34                	je     802df7 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802dc3:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802dc6:	75 05                	jne    802dcd <ipc_send+0x67>
+        sys_yield();
+  802dc8:	41 ff d7             	call   *%r15
+    while (true) {
+  802dcb:	eb df                	jmp    802dac <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802dcd:	48 ba 60 35 80 00 00 	movabs $0x803560,%rdx
+  802dd4:	00 00 00 
+  802dd7:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802ddc:	48 bf 79 35 80 00 00 	movabs $0x803579,%rdi
+  802de3:	00 00 00 
+  802de6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802deb:	48 b9 93 02 80 00 00 	movabs $0x800293,%rcx
+  802df2:	00 00 00 
+  802df5:	ff d1                	call   *%rcx
+    }
+}
+  802df7:	48 83 c4 18          	add    $0x18,%rsp
+  802dfb:	5b                   	pop    %rbx
+  802dfc:	41 5c                	pop    %r12
+  802dfe:	41 5d                	pop    %r13
+  802e00:	41 5e                	pop    %r14
+  802e02:	41 5f                	pop    %r15
+  802e04:	5d                   	pop    %rbp
+  802e05:	c3                   	ret
+
+0000000000802e06 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802e06:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802e0b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802e12:	00 00 00 
+  802e15:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802e1c:	48 01 ca             	add    %rcx,%rdx
+  802e1f:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802e25:	39 fa                	cmp    %edi,%edx
+  802e27:	74 12                	je     802e3b <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802e29:	48 83 c0 01          	add    $0x1,%rax
+  802e2d:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802e33:	75 e0                	jne    802e15 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802e35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e3a:	c3                   	ret
+            return envs[i].env_id;
+  802e3b:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802e42:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802e49:	00 00 00 
+  802e4c:	48 01 d0             	add    %rdx,%rax
+  802e4f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802e55:	c3                   	ret
+  802e56:	66 90                	xchg   %ax,%ax
+
+0000000000802e58 <__rodata_start>:
+  802e58:	77 72                	ja     802ecc <__rodata_start+0x74>
+  802e5a:	69 74 65 20 65 72 72 	imul   $0x6f727265,0x20(%rbp,%riz,2),%esi
+  802e61:	6f 
+  802e62:	72 20                	jb     802e84 <__rodata_start+0x2c>
+  802e64:	63 6f 70             	movsxd 0x70(%rdi),%ebp
+  802e67:	79 69                	jns    802ed2 <__rodata_start+0x7a>
+  802e69:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e6a:	67 20 25 73 3a 20 25 	and    %ah,0x25203a73(%eip)        # 25a068e4 <__bss_end+0x251fc8e4>
+  802e71:	69 00 75 73 65 72    	imul   $0x72657375,(%rax),%eax
+  802e77:	2f                   	(bad)
+  802e78:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802e7b:	2e 63 00             	cs movsxd (%rax),%eax
+  802e7e:	65 72 72             	gs jb  802ef3 <__rodata_start+0x9b>
+  802e81:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e82:	72 20                	jb     802ea4 <__rodata_start+0x4c>
+  802e84:	72 65                	jb     802eeb <__rodata_start+0x93>
+  802e86:	61                   	(bad)
+  802e87:	64 69 6e 67 20 25 73 	imul   $0x3a732520,%fs:0x67(%rsi),%ebp
+  802e8e:	3a 
+  802e8f:	20 25 69 00 63 61    	and    %ah,0x61630069(%rip)        # 61e32efe <__bss_end+0x61628efe>
+  802e95:	74 00                	je     802e97 <__rodata_start+0x3f>
+  802e97:	3c 73                	cmp    $0x73,%al
+  802e99:	74 64                	je     802eff <__rodata_start+0xa7>
+  802e9b:	69 6e 3e 00 63 61 6e 	imul   $0x6e616300,0x3e(%rsi),%ebp
+  802ea2:	27                   	(bad)
+  802ea3:	74 20                	je     802ec5 <__rodata_start+0x6d>
+  802ea5:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ea6:	70 65                	jo     802f0d <__rodata_start+0xb5>
+  802ea8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ea9:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a06922 <__bss_end+0x251fc922>
+  802eaf:	69 0a 00 3c 75 6e    	imul   $0x6e753c00,(%rdx),%ecx
+  802eb5:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802eb9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802eba:	3e 00 0f             	ds add %cl,(%rdi)
+  802ebd:	1f                   	(bad)
+  802ebe:	40 00 5b 25          	rex add %bl,0x25(%rbx)
+  802ec2:	30 38                	xor    %bh,(%rax)
+  802ec4:	78 5d                	js     802f23 <__rodata_start+0xcb>
+  802ec6:	20 75 73             	and    %dh,0x73(%rbp)
+  802ec9:	65 72 20             	gs jb  802eec <__rodata_start+0x94>
+  802ecc:	70 61                	jo     802f2f <__rodata_start+0xd7>
+  802ece:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ecf:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  802ed6:	73 20                	jae    802ef8 <__rodata_start+0xa0>
+  802ed8:	61                   	(bad)
+  802ed9:	74 20                	je     802efb <__rodata_start+0xa3>
+  802edb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  802ee0:	3a 20                	cmp    (%rax),%ah
+  802ee2:	00 30                	add    %dh,(%rax)
+  802ee4:	31 32                	xor    %esi,(%rdx)
+  802ee6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802eed:	41                   	rex.B
+  802eee:	42                   	rex.X
+  802eef:	43                   	rex.XB
+  802ef0:	44                   	rex.R
+  802ef1:	45                   	rex.RB
+  802ef2:	46 00 30             	rex.RX add %r14b,(%rax)
+  802ef5:	31 32                	xor    %esi,(%rdx)
+  802ef7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802efe:	61                   	(bad)
+  802eff:	62 63 64 65 66       	(bad)
+  802f04:	00 28                	add    %ch,(%rax)
+  802f06:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f07:	75 6c                	jne    802f75 <__rodata_start+0x11d>
+  802f09:	6c                   	insb   (%dx),%es:(%rdi)
+  802f0a:	29 00                	sub    %eax,(%rax)
+  802f0c:	65 72 72             	gs jb  802f81 <__rodata_start+0x129>
+  802f0f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f10:	72 20                	jb     802f32 <__rodata_start+0xda>
+  802f12:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802f17:	73 70                	jae    802f89 <__rodata_start+0x131>
+  802f19:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802f1d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802f24:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f25:	72 00                	jb     802f27 <__rodata_start+0xcf>
+  802f27:	62 61 64 20 65       	(bad)
+  802f2c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f2d:	76 69                	jbe    802f98 <__rodata_start+0x140>
+  802f2f:	72 6f                	jb     802fa0 <__rodata_start+0x148>
+  802f31:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f32:	6d                   	insl   (%dx),%es:(%rdi)
+  802f33:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f35:	74 00                	je     802f37 <__rodata_start+0xdf>
+  802f37:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802f3e:	20 70 61             	and    %dh,0x61(%rax)
+  802f41:	72 61                	jb     802fa4 <__rodata_start+0x14c>
+  802f43:	6d                   	insl   (%dx),%es:(%rdi)
+  802f44:	65 74 65             	gs je  802fac <__rodata_start+0x154>
+  802f47:	72 00                	jb     802f49 <__rodata_start+0xf1>
+  802f49:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f4a:	75 74                	jne    802fc0 <__rodata_start+0x168>
+  802f4c:	20 6f 66             	and    %ch,0x66(%rdi)
+  802f4f:	20 6d 65             	and    %ch,0x65(%rbp)
+  802f52:	6d                   	insl   (%dx),%es:(%rdi)
+  802f53:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f54:	72 79                	jb     802fcf <__rodata_start+0x177>
+  802f56:	00 6f 75             	add    %ch,0x75(%rdi)
+  802f59:	74 20                	je     802f7b <__rodata_start+0x123>
+  802f5b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f5c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802f60:	76 69                	jbe    802fcb <__rodata_start+0x173>
+  802f62:	72 6f                	jb     802fd3 <__rodata_start+0x17b>
+  802f64:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f65:	6d                   	insl   (%dx),%es:(%rdi)
+  802f66:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f68:	74 73                	je     802fdd <__rodata_start+0x185>
+  802f6a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802f6d:	72 72                	jb     802fe1 <__rodata_start+0x189>
+  802f6f:	75 70                	jne    802fe1 <__rodata_start+0x189>
+  802f71:	74 65                	je     802fd8 <__rodata_start+0x180>
+  802f73:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802f78:	75 67                	jne    802fe1 <__rodata_start+0x189>
+  802f7a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802f7d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802f7f:	00 73 65             	add    %dh,0x65(%rbx)
+  802f82:	67 6d                	insl   (%dx),%es:(%edi)
+  802f84:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f86:	74 61                	je     802fe9 <__rodata_start+0x191>
+  802f88:	74 69                	je     802ff3 <__rodata_start+0x19b>
+  802f8a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f8b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f8c:	20 66 61             	and    %ah,0x61(%rsi)
+  802f8f:	75 6c                	jne    802ffd <__rodata_start+0x1a5>
+  802f91:	74 00                	je     802f93 <__rodata_start+0x13b>
+  802f93:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802f9a:	20 45 4c             	and    %al,0x4c(%rbp)
+  802f9d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802fa1:	61                   	(bad)
+  802fa2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802fa7:	20 73 75             	and    %dh,0x75(%rbx)
+  802faa:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802fad:	73 79                	jae    803028 <__rodata_start+0x1d0>
+  802faf:	73 74                	jae    803025 <__rodata_start+0x1cd>
+  802fb1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802fb3:	20 63 61             	and    %ah,0x61(%rbx)
+  802fb6:	6c                   	insb   (%dx),%es:(%rdi)
+  802fb7:	6c                   	insb   (%dx),%es:(%rdi)
+  802fb8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802fbb:	74 72                	je     80302f <__rodata_start+0x1d7>
+  802fbd:	79 20                	jns    802fdf <__rodata_start+0x187>
+  802fbf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fc0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fc1:	74 20                	je     802fe3 <__rodata_start+0x18b>
+  802fc3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802fc5:	75 6e                	jne    803035 <__rodata_start+0x1dd>
+  802fc7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802fcb:	76 20                	jbe    802fed <__rodata_start+0x195>
+  802fcd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802fd4:	72 65                	jb     80303b <__rodata_start+0x1e3>
+  802fd6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802fd9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fda:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802fde:	65 78 70             	gs js  803051 <__rodata_start+0x1f9>
+  802fe1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802fe6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802fe9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802fed:	20 66 69             	and    %ah,0x69(%rsi)
+  802ff0:	6c                   	insb   (%dx),%es:(%rdi)
+  802ff1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802ff5:	20 66 72             	and    %ah,0x72(%rsi)
+  802ff8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802ffd:	61                   	(bad)
+  802ffe:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803001:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803002:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803003:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803007:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80300a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80300b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80300c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80300f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803010:	79 20                	jns    803032 <__rodata_start+0x1da>
+  803012:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803019:	72 65                	jb     803080 <__rodata_start+0x228>
+  80301b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80301e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803020:	00 66 69             	add    %ah,0x69(%rsi)
+  803023:	6c                   	insb   (%dx),%es:(%rdi)
+  803024:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803028:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80302b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80302c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80302f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803030:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803031:	74 20                	je     803053 <__rodata_start+0x1fb>
+  803033:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803035:	75 6e                	jne    8030a5 <__rodata_start+0x24d>
+  803037:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80303b:	76 61                	jbe    80309e <__rodata_start+0x246>
+  80303d:	6c                   	insb   (%dx),%es:(%rdi)
+  80303e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803045:	00 
+  803046:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80304d:	72 65                	jb     8030b4 <__rodata_start+0x25c>
+  80304f:	61                   	(bad)
+  803050:	64 79 20             	fs jns 803073 <__rodata_start+0x21b>
+  803053:	65 78 69             	gs js  8030bf <__rodata_start+0x267>
+  803056:	73 74                	jae    8030cc <__rodata_start+0x274>
+  803058:	73 00                	jae    80305a <__rodata_start+0x202>
+  80305a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80305b:	70 65                	jo     8030c2 <__rodata_start+0x26a>
+  80305d:	72 61                	jb     8030c0 <__rodata_start+0x268>
+  80305f:	74 69                	je     8030ca <__rodata_start+0x272>
+  803061:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803062:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803063:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803066:	74 20                	je     803088 <__rodata_start+0x230>
+  803068:	73 75                	jae    8030df <__rodata_start+0x287>
+  80306a:	70 70                	jo     8030dc <__rodata_start+0x284>
+  80306c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80306d:	72 74                	jb     8030e3 <__rodata_start+0x28b>
+  80306f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803074:	65 72 61             	gs jb  8030d8 <__rodata_start+0x280>
+  803077:	74 69                	je     8030e2 <__rodata_start+0x28a>
+  803079:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80307a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80307b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80307e:	74 20                	je     8030a0 <__rodata_start+0x248>
+  803080:	70 65                	jo     8030e7 <__rodata_start+0x28f>
+  803082:	72 6d                	jb     8030f1 <__rodata_start+0x299>
+  803084:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  80308b:	2e 
+  80308c:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803093:	00 
+  803094:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80309b:	00 00 00 
+  80309e:	66 90                	xchg   %ax,%ax
+  8030a0:	d0 05 80 00 00 00    	rolb   0x80(%rip)        # 803126 <__rodata_start+0x2ce>
+  8030a6:	00 00                	add    %al,(%rax)
+  8030a8:	11 0c 80             	adc    %ecx,(%rax,%rax,4)
+  8030ab:	00 00                	add    %al,(%rax)
+  8030ad:	00 00                	add    %al,(%rax)
+  8030af:	00 01                	add    %al,(%rcx)
+  8030b1:	0c 80                	or     $0x80,%al
+  8030b3:	00 00                	add    %al,(%rax)
+  8030b5:	00 00                	add    %al,(%rax)
+  8030b7:	00 11                	add    %dl,(%rcx)
+  8030b9:	0c 80                	or     $0x80,%al
+  8030bb:	00 00                	add    %al,(%rax)
+  8030bd:	00 00                	add    %al,(%rax)
+  8030bf:	00 11                	add    %dl,(%rcx)
+  8030c1:	0c 80                	or     $0x80,%al
+  8030c3:	00 00                	add    %al,(%rax)
+  8030c5:	00 00                	add    %al,(%rax)
+  8030c7:	00 11                	add    %dl,(%rcx)
+  8030c9:	0c 80                	or     $0x80,%al
+  8030cb:	00 00                	add    %al,(%rax)
+  8030cd:	00 00                	add    %al,(%rax)
+  8030cf:	00 11                	add    %dl,(%rcx)
+  8030d1:	0c 80                	or     $0x80,%al
+  8030d3:	00 00                	add    %al,(%rax)
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 ef                	add    %ch,%bh
+  8030d9:	05 80 00 00 00       	add    $0x80,%eax
+  8030de:	00 00                	add    %al,(%rax)
+  8030e0:	11 0c 80             	adc    %ecx,(%rax,%rax,4)
+  8030e3:	00 00                	add    %al,(%rax)
+  8030e5:	00 00                	add    %al,(%rax)
+  8030e7:	00 11                	add    %dl,(%rcx)
+  8030e9:	0c 80                	or     $0x80,%al
+  8030eb:	00 00                	add    %al,(%rax)
+  8030ed:	00 00                	add    %al,(%rax)
+  8030ef:	00 e3                	add    %ah,%bl
+  8030f1:	05 80 00 00 00       	add    $0x80,%eax
+  8030f6:	00 00                	add    %al,(%rax)
+  8030f8:	5d                   	pop    %rbp
+  8030f9:	06                   	(bad)
+  8030fa:	80 00 00             	addb   $0x0,(%rax)
+  8030fd:	00 00                	add    %al,(%rax)
+  8030ff:	00 11                	add    %dl,(%rcx)
+  803101:	0c 80                	or     $0x80,%al
+  803103:	00 00                	add    %al,(%rax)
+  803105:	00 00                	add    %al,(%rax)
+  803107:	00 e3                	add    %ah,%bl
+  803109:	05 80 00 00 00       	add    $0x80,%eax
+  80310e:	00 00                	add    %al,(%rax)
+  803110:	29 06                	sub    %eax,(%rsi)
+  803112:	80 00 00             	addb   $0x0,(%rax)
+  803115:	00 00                	add    %al,(%rax)
+  803117:	00 29                	add    %ch,(%rcx)
+  803119:	06                   	(bad)
+  80311a:	80 00 00             	addb   $0x0,(%rax)
+  80311d:	00 00                	add    %al,(%rax)
+  80311f:	00 29                	add    %ch,(%rcx)
+  803121:	06                   	(bad)
+  803122:	80 00 00             	addb   $0x0,(%rax)
+  803125:	00 00                	add    %al,(%rax)
+  803127:	00 29                	add    %ch,(%rcx)
+  803129:	06                   	(bad)
+  80312a:	80 00 00             	addb   $0x0,(%rax)
+  80312d:	00 00                	add    %al,(%rax)
+  80312f:	00 29                	add    %ch,(%rcx)
+  803131:	06                   	(bad)
+  803132:	80 00 00             	addb   $0x0,(%rax)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 29                	add    %ch,(%rcx)
+  803139:	06                   	(bad)
+  80313a:	80 00 00             	addb   $0x0,(%rax)
+  80313d:	00 00                	add    %al,(%rax)
+  80313f:	00 29                	add    %ch,(%rcx)
+  803141:	06                   	(bad)
+  803142:	80 00 00             	addb   $0x0,(%rax)
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 29                	add    %ch,(%rcx)
+  803149:	06                   	(bad)
+  80314a:	80 00 00             	addb   $0x0,(%rax)
+  80314d:	00 00                	add    %al,(%rax)
+  80314f:	00 29                	add    %ch,(%rcx)
+  803151:	06                   	(bad)
+  803152:	80 00 00             	addb   $0x0,(%rax)
+  803155:	00 00                	add    %al,(%rax)
+  803157:	00 11                	add    %dl,(%rcx)
+  803159:	0c 80                	or     $0x80,%al
+  80315b:	00 00                	add    %al,(%rax)
+  80315d:	00 00                	add    %al,(%rax)
+  80315f:	00 11                	add    %dl,(%rcx)
+  803161:	0c 80                	or     $0x80,%al
+  803163:	00 00                	add    %al,(%rax)
+  803165:	00 00                	add    %al,(%rax)
+  803167:	00 11                	add    %dl,(%rcx)
+  803169:	0c 80                	or     $0x80,%al
+  80316b:	00 00                	add    %al,(%rax)
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 11                	add    %dl,(%rcx)
+  803171:	0c 80                	or     $0x80,%al
+  803173:	00 00                	add    %al,(%rax)
+  803175:	00 00                	add    %al,(%rax)
+  803177:	00 11                	add    %dl,(%rcx)
+  803179:	0c 80                	or     $0x80,%al
+  80317b:	00 00                	add    %al,(%rax)
+  80317d:	00 00                	add    %al,(%rax)
+  80317f:	00 11                	add    %dl,(%rcx)
+  803181:	0c 80                	or     $0x80,%al
+  803183:	00 00                	add    %al,(%rax)
+  803185:	00 00                	add    %al,(%rax)
+  803187:	00 11                	add    %dl,(%rcx)
+  803189:	0c 80                	or     $0x80,%al
+  80318b:	00 00                	add    %al,(%rax)
+  80318d:	00 00                	add    %al,(%rax)
+  80318f:	00 11                	add    %dl,(%rcx)
+  803191:	0c 80                	or     $0x80,%al
+  803193:	00 00                	add    %al,(%rax)
+  803195:	00 00                	add    %al,(%rax)
+  803197:	00 11                	add    %dl,(%rcx)
+  803199:	0c 80                	or     $0x80,%al
+  80319b:	00 00                	add    %al,(%rax)
+  80319d:	00 00                	add    %al,(%rax)
+  80319f:	00 11                	add    %dl,(%rcx)
+  8031a1:	0c 80                	or     $0x80,%al
+  8031a3:	00 00                	add    %al,(%rax)
+  8031a5:	00 00                	add    %al,(%rax)
+  8031a7:	00 11                	add    %dl,(%rcx)
+  8031a9:	0c 80                	or     $0x80,%al
+  8031ab:	00 00                	add    %al,(%rax)
+  8031ad:	00 00                	add    %al,(%rax)
+  8031af:	00 11                	add    %dl,(%rcx)
+  8031b1:	0c 80                	or     $0x80,%al
+  8031b3:	00 00                	add    %al,(%rax)
+  8031b5:	00 00                	add    %al,(%rax)
+  8031b7:	00 11                	add    %dl,(%rcx)
+  8031b9:	0c 80                	or     $0x80,%al
+  8031bb:	00 00                	add    %al,(%rax)
+  8031bd:	00 00                	add    %al,(%rax)
+  8031bf:	00 11                	add    %dl,(%rcx)
+  8031c1:	0c 80                	or     $0x80,%al
+  8031c3:	00 00                	add    %al,(%rax)
+  8031c5:	00 00                	add    %al,(%rax)
+  8031c7:	00 11                	add    %dl,(%rcx)
+  8031c9:	0c 80                	or     $0x80,%al
+  8031cb:	00 00                	add    %al,(%rax)
+  8031cd:	00 00                	add    %al,(%rax)
+  8031cf:	00 11                	add    %dl,(%rcx)
+  8031d1:	0c 80                	or     $0x80,%al
+  8031d3:	00 00                	add    %al,(%rax)
+  8031d5:	00 00                	add    %al,(%rax)
+  8031d7:	00 11                	add    %dl,(%rcx)
+  8031d9:	0c 80                	or     $0x80,%al
+  8031db:	00 00                	add    %al,(%rax)
+  8031dd:	00 00                	add    %al,(%rax)
+  8031df:	00 11                	add    %dl,(%rcx)
+  8031e1:	0c 80                	or     $0x80,%al
+  8031e3:	00 00                	add    %al,(%rax)
+  8031e5:	00 00                	add    %al,(%rax)
+  8031e7:	00 11                	add    %dl,(%rcx)
+  8031e9:	0c 80                	or     $0x80,%al
+  8031eb:	00 00                	add    %al,(%rax)
+  8031ed:	00 00                	add    %al,(%rax)
+  8031ef:	00 11                	add    %dl,(%rcx)
+  8031f1:	0c 80                	or     $0x80,%al
+  8031f3:	00 00                	add    %al,(%rax)
+  8031f5:	00 00                	add    %al,(%rax)
+  8031f7:	00 11                	add    %dl,(%rcx)
+  8031f9:	0c 80                	or     $0x80,%al
+  8031fb:	00 00                	add    %al,(%rax)
+  8031fd:	00 00                	add    %al,(%rax)
+  8031ff:	00 11                	add    %dl,(%rcx)
+  803201:	0c 80                	or     $0x80,%al
+  803203:	00 00                	add    %al,(%rax)
+  803205:	00 00                	add    %al,(%rax)
+  803207:	00 11                	add    %dl,(%rcx)
+  803209:	0c 80                	or     $0x80,%al
+  80320b:	00 00                	add    %al,(%rax)
+  80320d:	00 00                	add    %al,(%rax)
+  80320f:	00 11                	add    %dl,(%rcx)
+  803211:	0c 80                	or     $0x80,%al
+  803213:	00 00                	add    %al,(%rax)
+  803215:	00 00                	add    %al,(%rax)
+  803217:	00 11                	add    %dl,(%rcx)
+  803219:	0c 80                	or     $0x80,%al
+  80321b:	00 00                	add    %al,(%rax)
+  80321d:	00 00                	add    %al,(%rax)
+  80321f:	00 11                	add    %dl,(%rcx)
+  803221:	0c 80                	or     $0x80,%al
+  803223:	00 00                	add    %al,(%rax)
+  803225:	00 00                	add    %al,(%rax)
+  803227:	00 11                	add    %dl,(%rcx)
+  803229:	0c 80                	or     $0x80,%al
+  80322b:	00 00                	add    %al,(%rax)
+  80322d:	00 00                	add    %al,(%rax)
+  80322f:	00 11                	add    %dl,(%rcx)
+  803231:	0c 80                	or     $0x80,%al
+  803233:	00 00                	add    %al,(%rax)
+  803235:	00 00                	add    %al,(%rax)
+  803237:	00 11                	add    %dl,(%rcx)
+  803239:	0c 80                	or     $0x80,%al
+  80323b:	00 00                	add    %al,(%rax)
+  80323d:	00 00                	add    %al,(%rax)
+  80323f:	00 11                	add    %dl,(%rcx)
+  803241:	0c 80                	or     $0x80,%al
+  803243:	00 00                	add    %al,(%rax)
+  803245:	00 00                	add    %al,(%rax)
+  803247:	00 34 0b             	add    %dh,(%rbx,%rcx,1)
+  80324a:	80 00 00             	addb   $0x0,(%rax)
+  80324d:	00 00                	add    %al,(%rax)
+  80324f:	00 11                	add    %dl,(%rcx)
+  803251:	0c 80                	or     $0x80,%al
+  803253:	00 00                	add    %al,(%rax)
+  803255:	00 00                	add    %al,(%rax)
+  803257:	00 11                	add    %dl,(%rcx)
+  803259:	0c 80                	or     $0x80,%al
+  80325b:	00 00                	add    %al,(%rax)
+  80325d:	00 00                	add    %al,(%rax)
+  80325f:	00 11                	add    %dl,(%rcx)
+  803261:	0c 80                	or     $0x80,%al
+  803263:	00 00                	add    %al,(%rax)
+  803265:	00 00                	add    %al,(%rax)
+  803267:	00 11                	add    %dl,(%rcx)
+  803269:	0c 80                	or     $0x80,%al
+  80326b:	00 00                	add    %al,(%rax)
+  80326d:	00 00                	add    %al,(%rax)
+  80326f:	00 11                	add    %dl,(%rcx)
+  803271:	0c 80                	or     $0x80,%al
+  803273:	00 00                	add    %al,(%rax)
+  803275:	00 00                	add    %al,(%rax)
+  803277:	00 11                	add    %dl,(%rcx)
+  803279:	0c 80                	or     $0x80,%al
+  80327b:	00 00                	add    %al,(%rax)
+  80327d:	00 00                	add    %al,(%rax)
+  80327f:	00 11                	add    %dl,(%rcx)
+  803281:	0c 80                	or     $0x80,%al
+  803283:	00 00                	add    %al,(%rax)
+  803285:	00 00                	add    %al,(%rax)
+  803287:	00 11                	add    %dl,(%rcx)
+  803289:	0c 80                	or     $0x80,%al
+  80328b:	00 00                	add    %al,(%rax)
+  80328d:	00 00                	add    %al,(%rax)
+  80328f:	00 11                	add    %dl,(%rcx)
+  803291:	0c 80                	or     $0x80,%al
+  803293:	00 00                	add    %al,(%rax)
+  803295:	00 00                	add    %al,(%rax)
+  803297:	00 11                	add    %dl,(%rcx)
+  803299:	0c 80                	or     $0x80,%al
+  80329b:	00 00                	add    %al,(%rax)
+  80329d:	00 00                	add    %al,(%rax)
+  80329f:	00 80 06 80 00 00    	add    %al,0x8006(%rax)
+  8032a5:	00 00                	add    %al,(%rax)
+  8032a7:	00 4f 08             	add    %cl,0x8(%rdi)
+  8032aa:	80 00 00             	addb   $0x0,(%rax)
+  8032ad:	00 00                	add    %al,(%rax)
+  8032af:	00 11                	add    %dl,(%rcx)
+  8032b1:	0c 80                	or     $0x80,%al
+  8032b3:	00 00                	add    %al,(%rax)
+  8032b5:	00 00                	add    %al,(%rax)
+  8032b7:	00 11                	add    %dl,(%rcx)
+  8032b9:	0c 80                	or     $0x80,%al
+  8032bb:	00 00                	add    %al,(%rax)
+  8032bd:	00 00                	add    %al,(%rax)
+  8032bf:	00 11                	add    %dl,(%rcx)
+  8032c1:	0c 80                	or     $0x80,%al
+  8032c3:	00 00                	add    %al,(%rax)
+  8032c5:	00 00                	add    %al,(%rax)
+  8032c7:	00 11                	add    %dl,(%rcx)
+  8032c9:	0c 80                	or     $0x80,%al
+  8032cb:	00 00                	add    %al,(%rax)
+  8032cd:	00 00                	add    %al,(%rax)
+  8032cf:	00 af 06 80 00 00    	add    %ch,0x8006(%rdi)
+  8032d5:	00 00                	add    %al,(%rax)
+  8032d7:	00 11                	add    %dl,(%rcx)
+  8032d9:	0c 80                	or     $0x80,%al
+  8032db:	00 00                	add    %al,(%rax)
+  8032dd:	00 00                	add    %al,(%rax)
+  8032df:	00 11                	add    %dl,(%rcx)
+  8032e1:	0c 80                	or     $0x80,%al
+  8032e3:	00 00                	add    %al,(%rax)
+  8032e5:	00 00                	add    %al,(%rax)
+  8032e7:	00 75 06             	add    %dh,0x6(%rbp)
+  8032ea:	80 00 00             	addb   $0x0,(%rax)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 11                	add    %dl,(%rcx)
+  8032f1:	0c 80                	or     $0x80,%al
+  8032f3:	00 00                	add    %al,(%rax)
+  8032f5:	00 00                	add    %al,(%rax)
+  8032f7:	00 11                	add    %dl,(%rcx)
+  8032f9:	0c 80                	or     $0x80,%al
+  8032fb:	00 00                	add    %al,(%rax)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 f7                	add    %dh,%bh
+  803301:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803307:	00 c1                	add    %al,%cl
+  803309:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80330f:	00 11                	add    %dl,(%rcx)
+  803311:	0c 80                	or     $0x80,%al
+  803313:	00 00                	add    %al,(%rax)
+  803315:	00 00                	add    %al,(%rax)
+  803317:	00 11                	add    %dl,(%rcx)
+  803319:	0c 80                	or     $0x80,%al
+  80331b:	00 00                	add    %al,(%rax)
+  80331d:	00 00                	add    %al,(%rax)
+  80331f:	00 46 07             	add    %al,0x7(%rsi)
+  803322:	80 00 00             	addb   $0x0,(%rax)
+  803325:	00 00                	add    %al,(%rax)
+  803327:	00 11                	add    %dl,(%rcx)
+  803329:	0c 80                	or     $0x80,%al
+  80332b:	00 00                	add    %al,(%rax)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 23                	add    %ah,(%rbx)
+  803331:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803337:	00 11                	add    %dl,(%rcx)
+  803339:	0c 80                	or     $0x80,%al
+  80333b:	00 00                	add    %al,(%rax)
+  80333d:	00 00                	add    %al,(%rax)
+  80333f:	00 11                	add    %dl,(%rcx)
+  803341:	0c 80                	or     $0x80,%al
+  803343:	00 00                	add    %al,(%rax)
+  803345:	00 00                	add    %al,(%rax)
+  803347:	00 34 0b             	add    %dh,(%rbx,%rcx,1)
+  80334a:	80 00 00             	addb   $0x0,(%rax)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 11                	add    %dl,(%rcx)
+  803351:	0c 80                	or     $0x80,%al
+  803353:	00 00                	add    %al,(%rax)
+  803355:	00 00                	add    %al,(%rax)
+  803357:	00 d9                	add    %bl,%cl
+  803359:	05 80 00 00 00       	add    $0x80,%eax
+	...
+
+0000000000803360 <error_string>:
+	...
+  803368:	15 2f 80 00 00 00 00 00 27 2f 80 00 00 00 00 00     ./......'/......
+  803378:	37 2f 80 00 00 00 00 00 49 2f 80 00 00 00 00 00     7/......I/......
+  803388:	57 2f 80 00 00 00 00 00 6b 2f 80 00 00 00 00 00     W/......k/......
+  803398:	80 2f 80 00 00 00 00 00 93 2f 80 00 00 00 00 00     ./......./......
+  8033a8:	a5 2f 80 00 00 00 00 00 b9 2f 80 00 00 00 00 00     ./......./......
+  8033b8:	c9 2f 80 00 00 00 00 00 dc 2f 80 00 00 00 00 00     ./......./......
+  8033c8:	f3 2f 80 00 00 00 00 00 09 30 80 00 00 00 00 00     ./.......0......
+  8033d8:	21 30 80 00 00 00 00 00 39 30 80 00 00 00 00 00     !0......90......
+  8033e8:	46 30 80 00 00 00 00 00 10 34 80 00 00 00 00 00     F0.......4......
+  8033f8:	5a 30 80 00 00 00 00 00 00 00 00 00 00 00 00 00     Z0..............
+  803408:	72 30 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     r0......file is 
+  803418:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803428:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803438:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803448:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803458:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803468:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803478:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803488:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803498:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8034a8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8034b8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8034c8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8034d8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008034e0 <devtab>:
+  8034e0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8034f0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803500:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803510:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803520:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803530:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803540:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803550:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803560:	69 70 63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64     ipc_send: failed
+  803570:	20 74 6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63      to send.lib/ipc
+  803580:	2e 63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     .c.f.........f..
+  803590:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803600:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803610:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803620:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803630:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803640:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803650:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803660:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803670:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803680:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803690:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803700:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803710:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803720:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803730:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803740:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803750:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803760:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803770:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803780:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803790:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
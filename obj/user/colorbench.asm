@@ -0,0 +1,5812 @@
+
+obj/user/colorbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 1e 02 00 00       	call   800241 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+    sys_unmap_region(0, buffer, npages * PAGE_SIZE);
+    return cycles / (ROUNDS * npages);
+}
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = sys_alloc_region(0, scratch, SCRATCH_PAGES * PAGE_SIZE, PROT_RW);
+  800036:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80003b:	ba 00 00 20 00       	mov    $0x200000,%edx
+  800040:	be 00 00 00 10       	mov    $0x10000000,%esi
+  800045:	bf 00 00 00 00       	mov    $0x0,%edi
+  80004a:	48 b8 30 13 80 00 00 	movabs $0x801330,%rax
+  800051:	00 00 00 
+  800054:	ff d0                	call   *%rax
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  800056:	85 c0                	test   %eax,%eax
+  800058:	0f 88 99 00 00 00    	js     8000f7 <umain+0xd2>
+  80005e:	b8 00 00 00 10       	mov    $0x10000000,%eax
+        scratch[i * PAGE_SIZE] = 1;
+  800063:	c6 00 01             	movb   $0x1,(%rax)
+    for (size_t i = 0; i < SCRATCH_PAGES; i++)
+  800066:	48 05 00 10 00 00    	add    $0x1000,%rax
+  80006c:	48 3d 00 00 20 10    	cmp    $0x10200000,%rax
+  800072:	75 ef                	jne    800063 <umain+0x3e>
+  800074:	bb 00 00 00 00       	mov    $0x0,%ebx
+        sys_unmap_region(0, scratch + (i * 167 % SCRATCH_PAGES) * PAGE_SIZE, PAGE_SIZE);
+  800079:	49 bc fc 13 80 00 00 	movabs $0x8013fc,%r12
+  800080:	00 00 00 
+  800083:	48 89 de             	mov    %rbx,%rsi
+  800086:	81 e6 ff 01 00 00    	and    $0x1ff,%esi
+  80008c:	48 c1 e6 0c          	shl    $0xc,%rsi
+  800090:	48 81 c6 00 00 00 10 	add    $0x10000000,%rsi
+  800097:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80009c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000a1:	41 ff d4             	call   *%r12
+    for (size_t i = 0; i < SCRATCH_PAGES; i++)
+  8000a4:	48 81 c3 a7 00 00 00 	add    $0xa7,%rbx
+  8000ab:	48 81 fb 00 4e 01 00 	cmp    $0x14e00,%rbx
+  8000b2:	75 cf                	jne    800083 <umain+0x5e>
+    scatter_memory();
+
+    cprintf("pages  cycles/access\n");
+  8000b4:	48 bf 57 2d 80 00 00 	movabs $0x802d57,%rdi
+  8000bb:	00 00 00 
+  8000be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c3:	48 ba 5b 04 80 00 00 	movabs $0x80045b,%rdx
+  8000ca:	00 00 00 
+  8000cd:	ff d2                	call   *%rdx
+    for (size_t npages = 8; npages <= MAX_PAGES; npages *= 2)
+  8000cf:	bb 08 00 00 00       	mov    $0x8,%ebx
+    int res = sys_alloc_region(0, buffer, npages * PAGE_SIZE, PROT_RW);
+  8000d4:	49 bf 30 13 80 00 00 	movabs $0x801330,%r15
+  8000db:	00 00 00 
+    sys_unmap_region(0, buffer, npages * PAGE_SIZE);
+  8000de:	49 be fc 13 80 00 00 	movabs $0x8013fc,%r14
+  8000e5:	00 00 00 
+        cprintf("%5zu  %lu\n", npages, (unsigned long)measure(npages));
+  8000e8:	49 bd 5b 04 80 00 00 	movabs $0x80045b,%r13
+  8000ef:	00 00 00 
+  8000f2:	e9 d4 00 00 00       	jmp    8001cb <umain+0x1a6>
+  8000f7:	89 c1                	mov    %eax,%ecx
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  8000f9:	48 ba 30 2d 80 00 00 	movabs $0x802d30,%rdx
+  800100:	00 00 00 
+  800103:	be 17 00 00 00       	mov    $0x17,%esi
+  800108:	48 bf 45 2d 80 00 00 	movabs $0x802d45,%rdi
+  80010f:	00 00 00 
+  800112:	b8 00 00 00 00       	mov    $0x0,%eax
+  800117:	49 b8 0b 03 80 00 00 	movabs $0x80030b,%r8
+  80011e:	00 00 00 
+  800121:	41 ff d0             	call   *%r8
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  800124:	48 ba 30 2d 80 00 00 	movabs $0x802d30,%rdx
+  80012b:	00 00 00 
+  80012e:	be 25 00 00 00       	mov    $0x25,%esi
+  800133:	48 bf 45 2d 80 00 00 	movabs $0x802d45,%rdi
+  80013a:	00 00 00 
+  80013d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800142:	49 b8 0b 03 80 00 00 	movabs $0x80030b,%r8
+  800149:	00 00 00 
+  80014c:	41 ff d0             	call   *%r8
+            (void)buf[i * PAGE_SIZE];
+  80014f:	0f b6 30             	movzbl (%rax),%esi
+        for (size_t i = 0; i < npages; i++)
+  800152:	48 05 00 10 00 00    	add    $0x1000,%rax
+  800158:	48 39 c8             	cmp    %rcx,%rax
+  80015b:	75 f2                	jne    80014f <umain+0x12a>
+    for (size_t r = 0; r < ROUNDS; r++)
+  80015d:	48 83 ea 01          	sub    $0x1,%rdx
+  800161:	74 0c                	je     80016f <umain+0x14a>
+        for (size_t i = 0; i < npages; i++)
+  800163:	b8 00 00 00 20       	mov    $0x20000000,%eax
+  800168:	48 85 db             	test   %rbx,%rbx
+  80016b:	75 e2                	jne    80014f <umain+0x12a>
+  80016d:	eb ee                	jmp    80015d <umain+0x138>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80016f:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800171:	48 c1 e2 20          	shl    $0x20,%rdx
+  800175:	89 c0                	mov    %eax,%eax
+  800177:	48 09 c2             	or     %rax,%rdx
+    uint64_t cycles = read_tsc() - start;
+  80017a:	48 89 d0             	mov    %rdx,%rax
+  80017d:	48 29 f8             	sub    %rdi,%rax
+  800180:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    sys_unmap_region(0, buffer, npages * PAGE_SIZE);
+  800184:	4c 89 e2             	mov    %r12,%rdx
+  800187:	be 00 00 00 20       	mov    $0x20000000,%esi
+  80018c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800191:	41 ff d6             	call   *%r14
+    return cycles / (ROUNDS * npages);
+  800194:	48 69 cb e8 03 00 00 	imul   $0x3e8,%rbx,%rcx
+  80019b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80019f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001a4:	48 f7 f1             	div    %rcx
+        cprintf("%5zu  %lu\n", npages, (unsigned long)measure(npages));
+  8001a7:	48 89 c2             	mov    %rax,%rdx
+  8001aa:	48 89 de             	mov    %rbx,%rsi
+  8001ad:	48 bf 6d 2d 80 00 00 	movabs $0x802d6d,%rdi
+  8001b4:	00 00 00 
+  8001b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bc:	41 ff d5             	call   *%r13
+    for (size_t npages = 8; npages <= MAX_PAGES; npages *= 2)
+  8001bf:	48 01 db             	add    %rbx,%rbx
+  8001c2:	48 81 fb 00 01 00 00 	cmp    $0x100,%rbx
+  8001c9:	77 67                	ja     800232 <umain+0x20d>
+    int res = sys_alloc_region(0, buffer, npages * PAGE_SIZE, PROT_RW);
+  8001cb:	49 89 dc             	mov    %rbx,%r12
+  8001ce:	49 c1 e4 0c          	shl    $0xc,%r12
+  8001d2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8001d7:	4c 89 e2             	mov    %r12,%rdx
+  8001da:	be 00 00 00 20       	mov    $0x20000000,%esi
+  8001df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e4:	41 ff d7             	call   *%r15
+  8001e7:	89 c1                	mov    %eax,%ecx
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  8001e9:	85 c0                	test   %eax,%eax
+  8001eb:	0f 88 33 ff ff ff    	js     800124 <umain+0xff>
+    for (size_t i = 0; i < npages; i++)
+  8001f1:	ba 00 00 00 20       	mov    $0x20000000,%edx
+  8001f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fb:	48 85 db             	test   %rbx,%rbx
+  8001fe:	74 12                	je     800212 <umain+0x1ed>
+        buf[i * PAGE_SIZE] = (uint8_t)i;
+  800200:	88 02                	mov    %al,(%rdx)
+    for (size_t i = 0; i < npages; i++)
+  800202:	48 83 c0 01          	add    $0x1,%rax
+  800206:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  80020d:	48 39 d8             	cmp    %rbx,%rax
+  800210:	75 ee                	jne    800200 <umain+0x1db>
+    asm volatile("rdtsc"
+  800212:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800214:	48 c1 e2 20          	shl    $0x20,%rdx
+  800218:	89 c0                	mov    %eax,%eax
+  80021a:	48 89 d7             	mov    %rdx,%rdi
+  80021d:	48 09 c7             	or     %rax,%rdi
+    for (size_t r = 0; r < ROUNDS; r++)
+  800220:	49 8d 8c 24 00 00 00 	lea    0x20000000(%r12),%rcx
+  800227:	20 
+  800228:	ba e8 03 00 00       	mov    $0x3e8,%edx
+  80022d:	e9 31 ff ff ff       	jmp    800163 <umain+0x13e>
+}
+  800232:	48 83 c4 18          	add    $0x18,%rsp
+  800236:	5b                   	pop    %rbx
+  800237:	41 5c                	pop    %r12
+  800239:	41 5d                	pop    %r13
+  80023b:	41 5e                	pop    %r14
+  80023d:	41 5f                	pop    %r15
+  80023f:	5d                   	pop    %rbp
+  800240:	c3                   	ret
+
+0000000000800241 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800241:	55                   	push   %rbp
+  800242:	48 89 e5             	mov    %rsp,%rbp
+  800245:	41 56                	push   %r14
+  800247:	41 55                	push   %r13
+  800249:	41 54                	push   %r12
+  80024b:	53                   	push   %rbx
+  80024c:	41 89 fd             	mov    %edi,%r13d
+  80024f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800252:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800259:	00 00 00 
+  80025c:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800263:	00 00 00 
+  800266:	48 39 c2             	cmp    %rax,%rdx
+  800269:	73 17                	jae    800282 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80026b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80026e:	49 89 c4             	mov    %rax,%r12
+  800271:	48 83 c3 08          	add    $0x8,%rbx
+  800275:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027a:	ff 53 f8             	call   *-0x8(%rbx)
+  80027d:	4c 39 e3             	cmp    %r12,%rbx
+  800280:	72 ef                	jb     800271 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800282:	48 b8 70 12 80 00 00 	movabs $0x801270,%rax
+  800289:	00 00 00 
+  80028c:	ff d0                	call   *%rax
+  80028e:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800291:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800298:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80029f:	00 00 00 
+  8002a2:	48 01 d0             	add    %rdx,%rax
+  8002a5:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8002ac:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002af:	45 85 ed             	test   %r13d,%r13d
+  8002b2:	7e 0d                	jle    8002c1 <libmain+0x80>
+  8002b4:	49 8b 06             	mov    (%r14),%rax
+  8002b7:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8002be:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002c1:	4c 89 f6             	mov    %r14,%rsi
+  8002c4:	44 89 ef             	mov    %r13d,%edi
+  8002c7:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002ce:	00 00 00 
+  8002d1:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8002d3:	48 b8 e8 02 80 00 00 	movabs $0x8002e8,%rax
+  8002da:	00 00 00 
+  8002dd:	ff d0                	call   *%rax
+#endif
+}
+  8002df:	5b                   	pop    %rbx
+  8002e0:	41 5c                	pop    %r12
+  8002e2:	41 5d                	pop    %r13
+  8002e4:	41 5e                	pop    %r14
+  8002e6:	5d                   	pop    %rbp
+  8002e7:	c3                   	ret
+
+00000000008002e8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8002e8:	55                   	push   %rbp
+  8002e9:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8002ec:	48 b8 f8 1a 80 00 00 	movabs $0x801af8,%rax
+  8002f3:	00 00 00 
+  8002f6:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002fd:	48 b8 05 12 80 00 00 	movabs $0x801205,%rax
+  800304:	00 00 00 
+  800307:	ff d0                	call   *%rax
+}
+  800309:	5d                   	pop    %rbp
+  80030a:	c3                   	ret
+
+000000000080030b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80030b:	55                   	push   %rbp
+  80030c:	48 89 e5             	mov    %rsp,%rbp
+  80030f:	41 56                	push   %r14
+  800311:	41 55                	push   %r13
+  800313:	41 54                	push   %r12
+  800315:	53                   	push   %rbx
+  800316:	48 83 ec 50          	sub    $0x50,%rsp
+  80031a:	49 89 fc             	mov    %rdi,%r12
+  80031d:	41 89 f5             	mov    %esi,%r13d
+  800320:	48 89 d3             	mov    %rdx,%rbx
+  800323:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800327:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80032b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80032f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800336:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80033a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80033e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800342:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800346:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80034d:	00 00 00 
+  800350:	4c 8b 30             	mov    (%rax),%r14
+  800353:	48 b8 70 12 80 00 00 	movabs $0x801270,%rax
+  80035a:	00 00 00 
+  80035d:	ff d0                	call   *%rax
+  80035f:	89 c6                	mov    %eax,%esi
+  800361:	45 89 e8             	mov    %r13d,%r8d
+  800364:	4c 89 e1             	mov    %r12,%rcx
+  800367:	4c 89 f2             	mov    %r14,%rdx
+  80036a:	48 bf 88 2d 80 00 00 	movabs $0x802d88,%rdi
+  800371:	00 00 00 
+  800374:	b8 00 00 00 00       	mov    $0x0,%eax
+  800379:	49 bc 5b 04 80 00 00 	movabs $0x80045b,%r12
+  800380:	00 00 00 
+  800383:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800386:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80038a:	48 89 df             	mov    %rbx,%rdi
+  80038d:	48 b8 f7 03 80 00 00 	movabs $0x8003f7,%rax
+  800394:	00 00 00 
+  800397:	ff d0                	call   *%rax
+    cprintf("\n");
+  800399:	48 bf 7b 33 80 00 00 	movabs $0x80337b,%rdi
+  8003a0:	00 00 00 
+  8003a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a8:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003ab:	cc                   	int3
+  8003ac:	eb fd                	jmp    8003ab <_panic+0xa0>
+
+00000000008003ae <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003ae:	55                   	push   %rbp
+  8003af:	48 89 e5             	mov    %rsp,%rbp
+  8003b2:	53                   	push   %rbx
+  8003b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8003b7:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003ba:	8b 06                	mov    (%rsi),%eax
+  8003bc:	8d 50 01             	lea    0x1(%rax),%edx
+  8003bf:	89 16                	mov    %edx,(%rsi)
+  8003c1:	48 98                	cltq
+  8003c3:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8003c8:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8003ce:	74 0a                	je     8003da <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8003d0:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8003d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003d8:	c9                   	leave
+  8003d9:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8003da:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8003de:	be ff 00 00 00       	mov    $0xff,%esi
+  8003e3:	48 b8 a7 11 80 00 00 	movabs $0x8011a7,%rax
+  8003ea:	00 00 00 
+  8003ed:	ff d0                	call   *%rax
+        state->offset = 0;
+  8003ef:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003f5:	eb d9                	jmp    8003d0 <putch+0x22>
+
+00000000008003f7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003f7:	55                   	push   %rbp
+  8003f8:	48 89 e5             	mov    %rsp,%rbp
+  8003fb:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800402:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800405:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80040c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800411:	b8 00 00 00 00       	mov    $0x0,%eax
+  800416:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800419:	48 89 f1             	mov    %rsi,%rcx
+  80041c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800423:	48 bf ae 03 80 00 00 	movabs $0x8003ae,%rdi
+  80042a:	00 00 00 
+  80042d:	48 b8 ab 05 80 00 00 	movabs $0x8005ab,%rax
+  800434:	00 00 00 
+  800437:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800439:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800440:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800447:	48 b8 a7 11 80 00 00 	movabs $0x8011a7,%rax
+  80044e:	00 00 00 
+  800451:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800453:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800459:	c9                   	leave
+  80045a:	c3                   	ret
+
+000000000080045b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80045b:	55                   	push   %rbp
+  80045c:	48 89 e5             	mov    %rsp,%rbp
+  80045f:	48 83 ec 50          	sub    $0x50,%rsp
+  800463:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800467:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80046b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80046f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800473:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800477:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80047e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800482:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800486:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80048a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80048e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800492:	48 b8 f7 03 80 00 00 	movabs $0x8003f7,%rax
+  800499:	00 00 00 
+  80049c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80049e:	c9                   	leave
+  80049f:	c3                   	ret
+
+00000000008004a0 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	41 57                	push   %r15
+  8004a6:	41 56                	push   %r14
+  8004a8:	41 55                	push   %r13
+  8004aa:	41 54                	push   %r12
+  8004ac:	53                   	push   %rbx
+  8004ad:	48 83 ec 18          	sub    $0x18,%rsp
+  8004b1:	49 89 fc             	mov    %rdi,%r12
+  8004b4:	49 89 f5             	mov    %rsi,%r13
+  8004b7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004bb:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004be:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8004c1:	41 89 cf             	mov    %ecx,%r15d
+  8004c4:	4c 39 fa             	cmp    %r15,%rdx
+  8004c7:	73 5b                	jae    800524 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8004c9:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8004cd:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8004d1:	85 db                	test   %ebx,%ebx
+  8004d3:	7e 0e                	jle    8004e3 <print_num+0x43>
+            putch(padc, put_arg);
+  8004d5:	4c 89 ee             	mov    %r13,%rsi
+  8004d8:	44 89 f7             	mov    %r14d,%edi
+  8004db:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8004de:	83 eb 01             	sub    $0x1,%ebx
+  8004e1:	75 f2                	jne    8004d5 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8004e3:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8004e7:	48 b9 bc 2d 80 00 00 	movabs $0x802dbc,%rcx
+  8004ee:	00 00 00 
+  8004f1:	48 b8 ab 2d 80 00 00 	movabs $0x802dab,%rax
+  8004f8:	00 00 00 
+  8004fb:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8004ff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800503:	ba 00 00 00 00       	mov    $0x0,%edx
+  800508:	49 f7 f7             	div    %r15
+  80050b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80050f:	4c 89 ee             	mov    %r13,%rsi
+  800512:	41 ff d4             	call   *%r12
+}
+  800515:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800519:	5b                   	pop    %rbx
+  80051a:	41 5c                	pop    %r12
+  80051c:	41 5d                	pop    %r13
+  80051e:	41 5e                	pop    %r14
+  800520:	41 5f                	pop    %r15
+  800522:	5d                   	pop    %rbp
+  800523:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800524:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800528:	ba 00 00 00 00       	mov    $0x0,%edx
+  80052d:	49 f7 f7             	div    %r15
+  800530:	48 83 ec 08          	sub    $0x8,%rsp
+  800534:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800538:	52                   	push   %rdx
+  800539:	45 0f be c9          	movsbl %r9b,%r9d
+  80053d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800541:	48 89 c2             	mov    %rax,%rdx
+  800544:	48 b8 a0 04 80 00 00 	movabs $0x8004a0,%rax
+  80054b:	00 00 00 
+  80054e:	ff d0                	call   *%rax
+  800550:	48 83 c4 10          	add    $0x10,%rsp
+  800554:	eb 8d                	jmp    8004e3 <print_num+0x43>
+
+0000000000800556 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800556:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80055a:	48 8b 06             	mov    (%rsi),%rax
+  80055d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800561:	73 0a                	jae    80056d <sprintputch+0x17>
+        *state->start++ = ch;
+  800563:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800567:	48 89 16             	mov    %rdx,(%rsi)
+  80056a:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80056d:	c3                   	ret
+
+000000000080056e <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80056e:	55                   	push   %rbp
+  80056f:	48 89 e5             	mov    %rsp,%rbp
+  800572:	48 83 ec 50          	sub    $0x50,%rsp
+  800576:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80057a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800582:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800589:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800591:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800595:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800599:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059d:	48 b8 ab 05 80 00 00 	movabs $0x8005ab,%rax
+  8005a4:	00 00 00 
+  8005a7:	ff d0                	call   *%rax
+}
+  8005a9:	c9                   	leave
+  8005aa:	c3                   	ret
+
+00000000008005ab <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005ab:	55                   	push   %rbp
+  8005ac:	48 89 e5             	mov    %rsp,%rbp
+  8005af:	41 57                	push   %r15
+  8005b1:	41 56                	push   %r14
+  8005b3:	41 55                	push   %r13
+  8005b5:	41 54                	push   %r12
+  8005b7:	53                   	push   %rbx
+  8005b8:	48 83 ec 38          	sub    $0x38,%rsp
+  8005bc:	49 89 fe             	mov    %rdi,%r14
+  8005bf:	49 89 f5             	mov    %rsi,%r13
+  8005c2:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8005c5:	48 8b 01             	mov    (%rcx),%rax
+  8005c8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8005cc:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8005d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d4:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8005d8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8005dc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8005e0:	0f b6 3b             	movzbl (%rbx),%edi
+  8005e3:	40 80 ff 25          	cmp    $0x25,%dil
+  8005e7:	74 18                	je     800601 <vprintfmt+0x56>
+            if (!ch) return;
+  8005e9:	40 84 ff             	test   %dil,%dil
+  8005ec:	0f 84 b1 06 00 00    	je     800ca3 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8005f2:	40 0f b6 ff          	movzbl %dil,%edi
+  8005f6:	4c 89 ee             	mov    %r13,%rsi
+  8005f9:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005fc:	4c 89 e3             	mov    %r12,%rbx
+  8005ff:	eb db                	jmp    8005dc <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800601:	be 00 00 00 00       	mov    $0x0,%esi
+  800606:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80060a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80060f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800615:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80061c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800620:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800625:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80062a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80062d:	83 e8 23             	sub    $0x23,%eax
+  800630:	3c 57                	cmp    $0x57,%al
+  800632:	0f 87 51 06 00 00    	ja     800c89 <vprintfmt+0x6de>
+  800638:	0f b6 c0             	movzbl %al,%eax
+  80063b:	48 b9 60 2f 80 00 00 	movabs $0x802f60,%rcx
+  800642:	00 00 00 
+  800645:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800648:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80064b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80064f:	eb cf                	jmp    800620 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800651:	49 89 dc             	mov    %rbx,%r12
+  800654:	be 01 00 00 00       	mov    $0x1,%esi
+  800659:	eb c5                	jmp    800620 <vprintfmt+0x75>
+            padc = ch;
+  80065b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80065f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800662:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800665:	eb b9                	jmp    800620 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800667:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80066a:	83 f8 2f             	cmp    $0x2f,%eax
+  80066d:	77 24                	ja     800693 <vprintfmt+0xe8>
+  80066f:	89 c1                	mov    %eax,%ecx
+  800671:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800675:	83 c0 08             	add    $0x8,%eax
+  800678:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80067b:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80067e:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800681:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800685:	79 99                	jns    800620 <vprintfmt+0x75>
+                width = precision;
+  800687:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80068b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800691:	eb 8d                	jmp    800620 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800693:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800697:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80069b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80069f:	eb da                	jmp    80067b <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8006a1:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006a6:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006aa:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006b0:	3c 39                	cmp    $0x39,%al
+  8006b2:	77 1c                	ja     8006d0 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006b4:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006b8:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006bc:	0f b6 c0             	movzbl %al,%eax
+  8006bf:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006c4:	0f b6 03             	movzbl (%rbx),%eax
+  8006c7:	3c 39                	cmp    $0x39,%al
+  8006c9:	76 e9                	jbe    8006b4 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8006cb:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8006ce:	eb b1                	jmp    800681 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8006d0:	49 89 dc             	mov    %rbx,%r12
+  8006d3:	eb ac                	jmp    800681 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8006d5:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8006d8:	85 c9                	test   %ecx,%ecx
+  8006da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006df:	0f 49 c1             	cmovns %ecx,%eax
+  8006e2:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8006e5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006e8:	e9 33 ff ff ff       	jmp    800620 <vprintfmt+0x75>
+            lflag++;
+  8006ed:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8006f0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006f3:	e9 28 ff ff ff       	jmp    800620 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8006fe:	77 19                	ja     800719 <vprintfmt+0x16e>
+  800700:	89 c2                	mov    %eax,%edx
+  800702:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800706:	83 c0 08             	add    $0x8,%eax
+  800709:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80070c:	8b 3a                	mov    (%rdx),%edi
+  80070e:	4c 89 ee             	mov    %r13,%rsi
+  800711:	41 ff d6             	call   *%r14
+            break;
+  800714:	e9 c3 fe ff ff       	jmp    8005dc <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800719:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80071d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800721:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800725:	eb e5                	jmp    80070c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800727:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072a:	83 f8 2f             	cmp    $0x2f,%eax
+  80072d:	77 5a                	ja     800789 <vprintfmt+0x1de>
+  80072f:	89 c2                	mov    %eax,%edx
+  800731:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800735:	83 c0 08             	add    $0x8,%eax
+  800738:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80073b:	8b 02                	mov    (%rdx),%eax
+  80073d:	89 c1                	mov    %eax,%ecx
+  80073f:	f7 d9                	neg    %ecx
+  800741:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800744:	83 f9 15             	cmp    $0x15,%ecx
+  800747:	7f 4e                	jg     800797 <vprintfmt+0x1ec>
+  800749:	48 63 c1             	movslq %ecx,%rax
+  80074c:	48 ba 20 32 80 00 00 	movabs $0x803220,%rdx
+  800753:	00 00 00 
+  800756:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80075a:	48 85 c0             	test   %rax,%rax
+  80075d:	74 38                	je     800797 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80075f:	48 89 c1             	mov    %rax,%rcx
+  800762:	48 ba d9 33 80 00 00 	movabs $0x8033d9,%rdx
+  800769:	00 00 00 
+  80076c:	4c 89 ee             	mov    %r13,%rsi
+  80076f:	4c 89 f7             	mov    %r14,%rdi
+  800772:	b8 00 00 00 00       	mov    $0x0,%eax
+  800777:	49 b8 6e 05 80 00 00 	movabs $0x80056e,%r8
+  80077e:	00 00 00 
+  800781:	41 ff d0             	call   *%r8
+  800784:	e9 53 fe ff ff       	jmp    8005dc <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800789:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800791:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800795:	eb a4                	jmp    80073b <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800797:	48 ba d4 2d 80 00 00 	movabs $0x802dd4,%rdx
+  80079e:	00 00 00 
+  8007a1:	4c 89 ee             	mov    %r13,%rsi
+  8007a4:	4c 89 f7             	mov    %r14,%rdi
+  8007a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ac:	49 b8 6e 05 80 00 00 	movabs $0x80056e,%r8
+  8007b3:	00 00 00 
+  8007b6:	41 ff d0             	call   *%r8
+  8007b9:	e9 1e fe ff ff       	jmp    8005dc <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c4:	77 6c                	ja     800832 <vprintfmt+0x287>
+  8007c6:	89 c2                	mov    %eax,%edx
+  8007c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007cc:	83 c0 08             	add    $0x8,%eax
+  8007cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d2:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8007d5:	48 85 d2             	test   %rdx,%rdx
+  8007d8:	48 b8 cd 2d 80 00 00 	movabs $0x802dcd,%rax
+  8007df:	00 00 00 
+  8007e2:	48 0f 45 c2          	cmovne %rdx,%rax
+  8007e6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8007ea:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007ee:	7e 06                	jle    8007f6 <vprintfmt+0x24b>
+  8007f0:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007f4:	75 4a                	jne    800840 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007f6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007fa:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8007fe:	0f b6 00             	movzbl (%rax),%eax
+  800801:	84 c0                	test   %al,%al
+  800803:	0f 85 9a 00 00 00    	jne    8008a3 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800809:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80080c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800810:	85 c0                	test   %eax,%eax
+  800812:	0f 8e c4 fd ff ff    	jle    8005dc <vprintfmt+0x31>
+  800818:	4c 89 ee             	mov    %r13,%rsi
+  80081b:	bf 20 00 00 00       	mov    $0x20,%edi
+  800820:	41 ff d6             	call   *%r14
+  800823:	41 83 ec 01          	sub    $0x1,%r12d
+  800827:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80082b:	75 eb                	jne    800818 <vprintfmt+0x26d>
+  80082d:	e9 aa fd ff ff       	jmp    8005dc <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800832:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800836:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083e:	eb 92                	jmp    8007d2 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800840:	49 63 f7             	movslq %r15d,%rsi
+  800843:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800847:	48 b8 5d 0d 80 00 00 	movabs $0x800d5d,%rax
+  80084e:	00 00 00 
+  800851:	ff d0                	call   *%rax
+  800853:	48 89 c2             	mov    %rax,%rdx
+  800856:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800859:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80085b:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80085e:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800861:	85 c0                	test   %eax,%eax
+  800863:	7e 91                	jle    8007f6 <vprintfmt+0x24b>
+  800865:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80086a:	4c 89 ee             	mov    %r13,%rsi
+  80086d:	44 89 e7             	mov    %r12d,%edi
+  800870:	41 ff d6             	call   *%r14
+  800873:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800877:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80087a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80087d:	75 eb                	jne    80086a <vprintfmt+0x2bf>
+  80087f:	e9 72 ff ff ff       	jmp    8007f6 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800884:	0f b6 f8             	movzbl %al,%edi
+  800887:	4c 89 ee             	mov    %r13,%rsi
+  80088a:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80088d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800891:	49 83 c4 01          	add    $0x1,%r12
+  800895:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80089b:	84 c0                	test   %al,%al
+  80089d:	0f 84 66 ff ff ff    	je     800809 <vprintfmt+0x25e>
+  8008a3:	45 85 ff             	test   %r15d,%r15d
+  8008a6:	78 0a                	js     8008b2 <vprintfmt+0x307>
+  8008a8:	41 83 ef 01          	sub    $0x1,%r15d
+  8008ac:	0f 88 57 ff ff ff    	js     800809 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008b2:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008b6:	74 cc                	je     800884 <vprintfmt+0x2d9>
+  8008b8:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008bb:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008c0:	80 fa 5e             	cmp    $0x5e,%dl
+  8008c3:	77 c2                	ja     800887 <vprintfmt+0x2dc>
+  8008c5:	eb bd                	jmp    800884 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c7:	40 84 f6             	test   %sil,%sil
+  8008ca:	75 26                	jne    8008f2 <vprintfmt+0x347>
+    switch (lflag) {
+  8008cc:	85 d2                	test   %edx,%edx
+  8008ce:	74 59                	je     800929 <vprintfmt+0x37e>
+  8008d0:	83 fa 01             	cmp    $0x1,%edx
+  8008d3:	74 7b                	je     800950 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8008d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8008db:	0f 87 96 00 00 00    	ja     800977 <vprintfmt+0x3cc>
+  8008e1:	89 c2                	mov    %eax,%edx
+  8008e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e7:	83 c0 08             	add    $0x8,%eax
+  8008ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ed:	4c 8b 22             	mov    (%rdx),%r12
+  8008f0:	eb 17                	jmp    800909 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f8:	77 21                	ja     80091b <vprintfmt+0x370>
+  8008fa:	89 c2                	mov    %eax,%edx
+  8008fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800900:	83 c0 08             	add    $0x8,%eax
+  800903:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800906:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800909:	4d 85 e4             	test   %r12,%r12
+  80090c:	78 7a                	js     800988 <vprintfmt+0x3dd>
+            num = i;
+  80090e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800911:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800916:	e9 50 02 00 00       	jmp    800b6b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80091b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800923:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800927:	eb dd                	jmp    800906 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800929:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092c:	83 f8 2f             	cmp    $0x2f,%eax
+  80092f:	77 11                	ja     800942 <vprintfmt+0x397>
+  800931:	89 c2                	mov    %eax,%edx
+  800933:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800937:	83 c0 08             	add    $0x8,%eax
+  80093a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093d:	4c 63 22             	movslq (%rdx),%r12
+  800940:	eb c7                	jmp    800909 <vprintfmt+0x35e>
+  800942:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800946:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094e:	eb ed                	jmp    80093d <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800950:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800953:	83 f8 2f             	cmp    $0x2f,%eax
+  800956:	77 11                	ja     800969 <vprintfmt+0x3be>
+  800958:	89 c2                	mov    %eax,%edx
+  80095a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095e:	83 c0 08             	add    $0x8,%eax
+  800961:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800964:	4c 8b 22             	mov    (%rdx),%r12
+  800967:	eb a0                	jmp    800909 <vprintfmt+0x35e>
+  800969:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800971:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800975:	eb ed                	jmp    800964 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800977:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800983:	e9 65 ff ff ff       	jmp    8008ed <vprintfmt+0x342>
+                putch('-', put_arg);
+  800988:	4c 89 ee             	mov    %r13,%rsi
+  80098b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800990:	41 ff d6             	call   *%r14
+                i = -i;
+  800993:	49 f7 dc             	neg    %r12
+  800996:	e9 73 ff ff ff       	jmp    80090e <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80099b:	40 84 f6             	test   %sil,%sil
+  80099e:	75 32                	jne    8009d2 <vprintfmt+0x427>
+    switch (lflag) {
+  8009a0:	85 d2                	test   %edx,%edx
+  8009a2:	74 5d                	je     800a01 <vprintfmt+0x456>
+  8009a4:	83 fa 01             	cmp    $0x1,%edx
+  8009a7:	0f 84 82 00 00 00    	je     800a2f <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8009ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b3:	0f 87 a5 00 00 00    	ja     800a5e <vprintfmt+0x4b3>
+  8009b9:	89 c2                	mov    %eax,%edx
+  8009bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009bf:	83 c0 08             	add    $0x8,%eax
+  8009c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009c8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009cd:	e9 99 01 00 00       	jmp    800b6b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d8:	77 19                	ja     8009f3 <vprintfmt+0x448>
+  8009da:	89 c2                	mov    %eax,%edx
+  8009dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e0:	83 c0 08             	add    $0x8,%eax
+  8009e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009e9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009ee:	e9 78 01 00 00       	jmp    800b6b <vprintfmt+0x5c0>
+  8009f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ff:	eb e5                	jmp    8009e6 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a04:	83 f8 2f             	cmp    $0x2f,%eax
+  800a07:	77 18                	ja     800a21 <vprintfmt+0x476>
+  800a09:	89 c2                	mov    %eax,%edx
+  800a0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0f:	83 c0 08             	add    $0x8,%eax
+  800a12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a15:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a17:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a1c:	e9 4a 01 00 00       	jmp    800b6b <vprintfmt+0x5c0>
+  800a21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2d:	eb e6                	jmp    800a15 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a32:	83 f8 2f             	cmp    $0x2f,%eax
+  800a35:	77 19                	ja     800a50 <vprintfmt+0x4a5>
+  800a37:	89 c2                	mov    %eax,%edx
+  800a39:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3d:	83 c0 08             	add    $0x8,%eax
+  800a40:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a43:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a46:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a4b:	e9 1b 01 00 00       	jmp    800b6b <vprintfmt+0x5c0>
+  800a50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5c:	eb e5                	jmp    800a43 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6a:	e9 56 ff ff ff       	jmp    8009c5 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a6f:	40 84 f6             	test   %sil,%sil
+  800a72:	75 2e                	jne    800aa2 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a74:	85 d2                	test   %edx,%edx
+  800a76:	74 59                	je     800ad1 <vprintfmt+0x526>
+  800a78:	83 fa 01             	cmp    $0x1,%edx
+  800a7b:	74 7f                	je     800afc <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a7d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a80:	83 f8 2f             	cmp    $0x2f,%eax
+  800a83:	0f 87 9f 00 00 00    	ja     800b28 <vprintfmt+0x57d>
+  800a89:	89 c2                	mov    %eax,%edx
+  800a8b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8f:	83 c0 08             	add    $0x8,%eax
+  800a92:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a95:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a98:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a9d:	e9 c9 00 00 00       	jmp    800b6b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa5:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa8:	77 19                	ja     800ac3 <vprintfmt+0x518>
+  800aaa:	89 c2                	mov    %eax,%edx
+  800aac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab0:	83 c0 08             	add    $0x8,%eax
+  800ab3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ab9:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800abe:	e9 a8 00 00 00       	jmp    800b6b <vprintfmt+0x5c0>
+  800ac3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800acf:	eb e5                	jmp    800ab6 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800ad1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad7:	77 15                	ja     800aee <vprintfmt+0x543>
+  800ad9:	89 c2                	mov    %eax,%edx
+  800adb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800adf:	83 c0 08             	add    $0x8,%eax
+  800ae2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae5:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800ae7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800aec:	eb 7d                	jmp    800b6b <vprintfmt+0x5c0>
+  800aee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800afa:	eb e9                	jmp    800ae5 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800afc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aff:	83 f8 2f             	cmp    $0x2f,%eax
+  800b02:	77 16                	ja     800b1a <vprintfmt+0x56f>
+  800b04:	89 c2                	mov    %eax,%edx
+  800b06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0a:	83 c0 08             	add    $0x8,%eax
+  800b0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b10:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b13:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b18:	eb 51                	jmp    800b6b <vprintfmt+0x5c0>
+  800b1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b26:	eb e8                	jmp    800b10 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b34:	e9 5c ff ff ff       	jmp    800a95 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b39:	4c 89 ee             	mov    %r13,%rsi
+  800b3c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b41:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b44:	4c 89 ee             	mov    %r13,%rsi
+  800b47:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b4c:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b52:	83 f8 2f             	cmp    $0x2f,%eax
+  800b55:	77 47                	ja     800b9e <vprintfmt+0x5f3>
+  800b57:	89 c2                	mov    %eax,%edx
+  800b59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5d:	83 c0 08             	add    $0x8,%eax
+  800b60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b63:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b66:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b6b:	48 83 ec 08          	sub    $0x8,%rsp
+  800b6f:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b73:	0f 94 c0             	sete   %al
+  800b76:	0f b6 c0             	movzbl %al,%eax
+  800b79:	50                   	push   %rax
+  800b7a:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b7f:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b83:	4c 89 ee             	mov    %r13,%rsi
+  800b86:	4c 89 f7             	mov    %r14,%rdi
+  800b89:	48 b8 a0 04 80 00 00 	movabs $0x8004a0,%rax
+  800b90:	00 00 00 
+  800b93:	ff d0                	call   *%rax
+            break;
+  800b95:	48 83 c4 10          	add    $0x10,%rsp
+  800b99:	e9 3e fa ff ff       	jmp    8005dc <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800baa:	eb b7                	jmp    800b63 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800bac:	40 84 f6             	test   %sil,%sil
+  800baf:	75 2b                	jne    800bdc <vprintfmt+0x631>
+    switch (lflag) {
+  800bb1:	85 d2                	test   %edx,%edx
+  800bb3:	74 56                	je     800c0b <vprintfmt+0x660>
+  800bb5:	83 fa 01             	cmp    $0x1,%edx
+  800bb8:	74 7f                	je     800c39 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800bba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbd:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc0:	0f 87 a2 00 00 00    	ja     800c68 <vprintfmt+0x6bd>
+  800bc6:	89 c2                	mov    %eax,%edx
+  800bc8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bcc:	83 c0 08             	add    $0x8,%eax
+  800bcf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bd5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bda:	eb 8f                	jmp    800b6b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bdc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bdf:	83 f8 2f             	cmp    $0x2f,%eax
+  800be2:	77 19                	ja     800bfd <vprintfmt+0x652>
+  800be4:	89 c2                	mov    %eax,%edx
+  800be6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bea:	83 c0 08             	add    $0x8,%eax
+  800bed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bf3:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bf8:	e9 6e ff ff ff       	jmp    800b6b <vprintfmt+0x5c0>
+  800bfd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c01:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c09:	eb e5                	jmp    800bf0 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c0e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c11:	77 18                	ja     800c2b <vprintfmt+0x680>
+  800c13:	89 c2                	mov    %eax,%edx
+  800c15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c19:	83 c0 08             	add    $0x8,%eax
+  800c1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c21:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c26:	e9 40 ff ff ff       	jmp    800b6b <vprintfmt+0x5c0>
+  800c2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c37:	eb e6                	jmp    800c1f <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c3c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c3f:	77 19                	ja     800c5a <vprintfmt+0x6af>
+  800c41:	89 c2                	mov    %eax,%edx
+  800c43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c47:	83 c0 08             	add    $0x8,%eax
+  800c4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c4d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c50:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c55:	e9 11 ff ff ff       	jmp    800b6b <vprintfmt+0x5c0>
+  800c5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c66:	eb e5                	jmp    800c4d <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c74:	e9 59 ff ff ff       	jmp    800bd2 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c79:	4c 89 ee             	mov    %r13,%rsi
+  800c7c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c81:	41 ff d6             	call   *%r14
+            break;
+  800c84:	e9 53 f9 ff ff       	jmp    8005dc <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c89:	4c 89 ee             	mov    %r13,%rsi
+  800c8c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c91:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c94:	48 83 eb 01          	sub    $0x1,%rbx
+  800c98:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c9c:	75 f6                	jne    800c94 <vprintfmt+0x6e9>
+  800c9e:	e9 39 f9 ff ff       	jmp    8005dc <vprintfmt+0x31>
+}
+  800ca3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ca7:	5b                   	pop    %rbx
+  800ca8:	41 5c                	pop    %r12
+  800caa:	41 5d                	pop    %r13
+  800cac:	41 5e                	pop    %r14
+  800cae:	41 5f                	pop    %r15
+  800cb0:	5d                   	pop    %rbp
+  800cb1:	c3                   	ret
+
+0000000000800cb2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800cb2:	55                   	push   %rbp
+  800cb3:	48 89 e5             	mov    %rsp,%rbp
+  800cb6:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800cba:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800cbe:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800cc3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800cc7:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800cce:	48 85 ff             	test   %rdi,%rdi
+  800cd1:	74 2b                	je     800cfe <vsnprintf+0x4c>
+  800cd3:	48 85 f6             	test   %rsi,%rsi
+  800cd6:	74 26                	je     800cfe <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800cd8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800cdc:	48 bf 56 05 80 00 00 	movabs $0x800556,%rdi
+  800ce3:	00 00 00 
+  800ce6:	48 b8 ab 05 80 00 00 	movabs $0x8005ab,%rax
+  800ced:	00 00 00 
+  800cf0:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800cf2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cf6:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800cf9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800cfc:	c9                   	leave
+  800cfd:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800cfe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d03:	eb f7                	jmp    800cfc <vsnprintf+0x4a>
+
+0000000000800d05 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d05:	55                   	push   %rbp
+  800d06:	48 89 e5             	mov    %rsp,%rbp
+  800d09:	48 83 ec 50          	sub    $0x50,%rsp
+  800d0d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d11:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d15:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d19:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d20:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d28:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d2c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d30:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d34:	48 b8 b2 0c 80 00 00 	movabs $0x800cb2,%rax
+  800d3b:	00 00 00 
+  800d3e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d40:	c9                   	leave
+  800d41:	c3                   	ret
+
+0000000000800d42 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d42:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d45:	74 10                	je     800d57 <strlen+0x15>
+    size_t n = 0;
+  800d47:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d4c:	48 83 c0 01          	add    $0x1,%rax
+  800d50:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d54:	75 f6                	jne    800d4c <strlen+0xa>
+  800d56:	c3                   	ret
+    size_t n = 0;
+  800d57:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d5c:	c3                   	ret
+
+0000000000800d5d <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d5d:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d60:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d65:	48 85 f6             	test   %rsi,%rsi
+  800d68:	74 11                	je     800d7b <strnlen+0x1e>
+  800d6a:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d6e:	74 0c                	je     800d7c <strnlen+0x1f>
+  800d70:	48 83 c2 01          	add    $0x1,%rdx
+  800d74:	48 39 d0             	cmp    %rdx,%rax
+  800d77:	75 f1                	jne    800d6a <strnlen+0xd>
+  800d79:	eb 04                	jmp    800d7f <strnlen+0x22>
+  800d7b:	c3                   	ret
+  800d7c:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d7f:	c3                   	ret
+
+0000000000800d80 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d80:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d83:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d88:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d8c:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d8f:	48 83 c2 01          	add    $0x1,%rdx
+  800d93:	84 c9                	test   %cl,%cl
+  800d95:	75 f1                	jne    800d88 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d97:	c3                   	ret
+
+0000000000800d98 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d98:	55                   	push   %rbp
+  800d99:	48 89 e5             	mov    %rsp,%rbp
+  800d9c:	41 54                	push   %r12
+  800d9e:	53                   	push   %rbx
+  800d9f:	48 89 fb             	mov    %rdi,%rbx
+  800da2:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800da5:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  800dac:	00 00 00 
+  800daf:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800db1:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800db5:	4c 89 e6             	mov    %r12,%rsi
+  800db8:	48 b8 80 0d 80 00 00 	movabs $0x800d80,%rax
+  800dbf:	00 00 00 
+  800dc2:	ff d0                	call   *%rax
+    return dst;
+}
+  800dc4:	48 89 d8             	mov    %rbx,%rax
+  800dc7:	5b                   	pop    %rbx
+  800dc8:	41 5c                	pop    %r12
+  800dca:	5d                   	pop    %rbp
+  800dcb:	c3                   	ret
+
+0000000000800dcc <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800dcc:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800dcf:	48 85 d2             	test   %rdx,%rdx
+  800dd2:	74 1f                	je     800df3 <strncpy+0x27>
+  800dd4:	48 01 fa             	add    %rdi,%rdx
+  800dd7:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800dda:	48 83 c1 01          	add    $0x1,%rcx
+  800dde:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800de2:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800de6:	41 80 f8 01          	cmp    $0x1,%r8b
+  800dea:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800dee:	48 39 ca             	cmp    %rcx,%rdx
+  800df1:	75 e7                	jne    800dda <strncpy+0xe>
+    }
+    return ret;
+}
+  800df3:	c3                   	ret
+
+0000000000800df4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800df4:	48 89 f8             	mov    %rdi,%rax
+  800df7:	48 85 d2             	test   %rdx,%rdx
+  800dfa:	74 24                	je     800e20 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800dfc:	48 83 ea 01          	sub    $0x1,%rdx
+  800e00:	74 1b                	je     800e1d <strlcpy+0x29>
+  800e02:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e06:	0f b6 16             	movzbl (%rsi),%edx
+  800e09:	84 d2                	test   %dl,%dl
+  800e0b:	74 10                	je     800e1d <strlcpy+0x29>
+            *dst++ = *src++;
+  800e0d:	48 83 c6 01          	add    $0x1,%rsi
+  800e11:	48 83 c0 01          	add    $0x1,%rax
+  800e15:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e18:	48 39 c8             	cmp    %rcx,%rax
+  800e1b:	75 e9                	jne    800e06 <strlcpy+0x12>
+        *dst = '\0';
+  800e1d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e20:	48 29 f8             	sub    %rdi,%rax
+}
+  800e23:	c3                   	ret
+
+0000000000800e24 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e24:	0f b6 07             	movzbl (%rdi),%eax
+  800e27:	84 c0                	test   %al,%al
+  800e29:	74 13                	je     800e3e <strcmp+0x1a>
+  800e2b:	38 06                	cmp    %al,(%rsi)
+  800e2d:	75 0f                	jne    800e3e <strcmp+0x1a>
+  800e2f:	48 83 c7 01          	add    $0x1,%rdi
+  800e33:	48 83 c6 01          	add    $0x1,%rsi
+  800e37:	0f b6 07             	movzbl (%rdi),%eax
+  800e3a:	84 c0                	test   %al,%al
+  800e3c:	75 ed                	jne    800e2b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e3e:	0f b6 c0             	movzbl %al,%eax
+  800e41:	0f b6 16             	movzbl (%rsi),%edx
+  800e44:	29 d0                	sub    %edx,%eax
+}
+  800e46:	c3                   	ret
+
+0000000000800e47 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e47:	48 85 d2             	test   %rdx,%rdx
+  800e4a:	74 1f                	je     800e6b <strncmp+0x24>
+  800e4c:	0f b6 07             	movzbl (%rdi),%eax
+  800e4f:	84 c0                	test   %al,%al
+  800e51:	74 1e                	je     800e71 <strncmp+0x2a>
+  800e53:	3a 06                	cmp    (%rsi),%al
+  800e55:	75 1a                	jne    800e71 <strncmp+0x2a>
+  800e57:	48 83 c7 01          	add    $0x1,%rdi
+  800e5b:	48 83 c6 01          	add    $0x1,%rsi
+  800e5f:	48 83 ea 01          	sub    $0x1,%rdx
+  800e63:	75 e7                	jne    800e4c <strncmp+0x5>
+
+    if (!n) return 0;
+  800e65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e6a:	c3                   	ret
+  800e6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e70:	c3                   	ret
+  800e71:	48 85 d2             	test   %rdx,%rdx
+  800e74:	74 09                	je     800e7f <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e76:	0f b6 07             	movzbl (%rdi),%eax
+  800e79:	0f b6 16             	movzbl (%rsi),%edx
+  800e7c:	29 d0                	sub    %edx,%eax
+  800e7e:	c3                   	ret
+    if (!n) return 0;
+  800e7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e84:	c3                   	ret
+
+0000000000800e85 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e85:	0f b6 17             	movzbl (%rdi),%edx
+  800e88:	84 d2                	test   %dl,%dl
+  800e8a:	74 18                	je     800ea4 <strchr+0x1f>
+        if (*str == c) {
+  800e8c:	0f be d2             	movsbl %dl,%edx
+  800e8f:	39 f2                	cmp    %esi,%edx
+  800e91:	74 17                	je     800eaa <strchr+0x25>
+    for (; *str; str++) {
+  800e93:	48 83 c7 01          	add    $0x1,%rdi
+  800e97:	0f b6 17             	movzbl (%rdi),%edx
+  800e9a:	84 d2                	test   %dl,%dl
+  800e9c:	75 ee                	jne    800e8c <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea3:	c3                   	ret
+  800ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea9:	c3                   	ret
+  800eaa:	48 89 f8             	mov    %rdi,%rax
+}
+  800ead:	c3                   	ret
+
+0000000000800eae <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800eae:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800eb1:	0f b6 17             	movzbl (%rdi),%edx
+  800eb4:	84 d2                	test   %dl,%dl
+  800eb6:	74 13                	je     800ecb <strfind+0x1d>
+  800eb8:	0f be d2             	movsbl %dl,%edx
+  800ebb:	39 f2                	cmp    %esi,%edx
+  800ebd:	74 0b                	je     800eca <strfind+0x1c>
+  800ebf:	48 83 c0 01          	add    $0x1,%rax
+  800ec3:	0f b6 10             	movzbl (%rax),%edx
+  800ec6:	84 d2                	test   %dl,%dl
+  800ec8:	75 ee                	jne    800eb8 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800eca:	c3                   	ret
+  800ecb:	c3                   	ret
+
+0000000000800ecc <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ecc:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ecf:	48 89 f8             	mov    %rdi,%rax
+  800ed2:	48 f7 d8             	neg    %rax
+  800ed5:	83 e0 07             	and    $0x7,%eax
+  800ed8:	49 89 d1             	mov    %rdx,%r9
+  800edb:	49 29 c1             	sub    %rax,%r9
+  800ede:	78 36                	js     800f16 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ee0:	40 0f b6 c6          	movzbl %sil,%eax
+  800ee4:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800eeb:	01 01 01 
+  800eee:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ef2:	40 f6 c7 07          	test   $0x7,%dil
+  800ef6:	75 38                	jne    800f30 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ef8:	4c 89 c9             	mov    %r9,%rcx
+  800efb:	48 c1 f9 03          	sar    $0x3,%rcx
+  800eff:	74 0c                	je     800f0d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f01:	fc                   	cld
+  800f02:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f05:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f09:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f0d:	4d 85 c9             	test   %r9,%r9
+  800f10:	75 45                	jne    800f57 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f12:	4c 89 c0             	mov    %r8,%rax
+  800f15:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f16:	48 85 d2             	test   %rdx,%rdx
+  800f19:	74 f7                	je     800f12 <memset+0x46>
+  800f1b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f1e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f21:	48 83 c0 01          	add    $0x1,%rax
+  800f25:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f29:	48 39 c2             	cmp    %rax,%rdx
+  800f2c:	75 f3                	jne    800f21 <memset+0x55>
+  800f2e:	eb e2                	jmp    800f12 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f30:	40 f6 c7 01          	test   $0x1,%dil
+  800f34:	74 06                	je     800f3c <memset+0x70>
+  800f36:	88 07                	mov    %al,(%rdi)
+  800f38:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f3c:	40 f6 c7 02          	test   $0x2,%dil
+  800f40:	74 07                	je     800f49 <memset+0x7d>
+  800f42:	66 89 07             	mov    %ax,(%rdi)
+  800f45:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f49:	40 f6 c7 04          	test   $0x4,%dil
+  800f4d:	74 a9                	je     800ef8 <memset+0x2c>
+  800f4f:	89 07                	mov    %eax,(%rdi)
+  800f51:	48 83 c7 04          	add    $0x4,%rdi
+  800f55:	eb a1                	jmp    800ef8 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f57:	41 f6 c1 04          	test   $0x4,%r9b
+  800f5b:	74 06                	je     800f63 <memset+0x97>
+  800f5d:	89 07                	mov    %eax,(%rdi)
+  800f5f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f63:	41 f6 c1 02          	test   $0x2,%r9b
+  800f67:	74 07                	je     800f70 <memset+0xa4>
+  800f69:	66 89 07             	mov    %ax,(%rdi)
+  800f6c:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f70:	41 f6 c1 01          	test   $0x1,%r9b
+  800f74:	74 9c                	je     800f12 <memset+0x46>
+  800f76:	88 07                	mov    %al,(%rdi)
+  800f78:	eb 98                	jmp    800f12 <memset+0x46>
+
+0000000000800f7a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f7a:	48 89 f8             	mov    %rdi,%rax
+  800f7d:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f80:	48 39 fe             	cmp    %rdi,%rsi
+  800f83:	73 3b                	jae    800fc0 <memmove+0x46>
+  800f85:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f89:	48 39 d7             	cmp    %rdx,%rdi
+  800f8c:	73 32                	jae    800fc0 <memmove+0x46>
+        s += n;
+        d += n;
+  800f8e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f92:	48 89 d6             	mov    %rdx,%rsi
+  800f95:	48 09 fe             	or     %rdi,%rsi
+  800f98:	48 09 ce             	or     %rcx,%rsi
+  800f9b:	40 f6 c6 07          	test   $0x7,%sil
+  800f9f:	75 12                	jne    800fb3 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fa1:	48 83 ef 08          	sub    $0x8,%rdi
+  800fa5:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fa9:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fad:	fd                   	std
+  800fae:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800fb1:	fc                   	cld
+  800fb2:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800fb3:	48 83 ef 01          	sub    $0x1,%rdi
+  800fb7:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800fbb:	fd                   	std
+  800fbc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800fbe:	eb f1                	jmp    800fb1 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fc0:	48 89 f2             	mov    %rsi,%rdx
+  800fc3:	48 09 c2             	or     %rax,%rdx
+  800fc6:	48 09 ca             	or     %rcx,%rdx
+  800fc9:	f6 c2 07             	test   $0x7,%dl
+  800fcc:	75 0c                	jne    800fda <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800fce:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fd2:	48 89 c7             	mov    %rax,%rdi
+  800fd5:	fc                   	cld
+  800fd6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800fd9:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800fda:	48 89 c7             	mov    %rax,%rdi
+  800fdd:	fc                   	cld
+  800fde:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800fe0:	c3                   	ret
+
+0000000000800fe1 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800fe1:	55                   	push   %rbp
+  800fe2:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800fe5:	48 b8 7a 0f 80 00 00 	movabs $0x800f7a,%rax
+  800fec:	00 00 00 
+  800fef:	ff d0                	call   *%rax
+}
+  800ff1:	5d                   	pop    %rbp
+  800ff2:	c3                   	ret
+
+0000000000800ff3 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ff3:	55                   	push   %rbp
+  800ff4:	48 89 e5             	mov    %rsp,%rbp
+  800ff7:	41 57                	push   %r15
+  800ff9:	41 56                	push   %r14
+  800ffb:	41 55                	push   %r13
+  800ffd:	41 54                	push   %r12
+  800fff:	53                   	push   %rbx
+  801000:	48 83 ec 08          	sub    $0x8,%rsp
+  801004:	49 89 fe             	mov    %rdi,%r14
+  801007:	49 89 f7             	mov    %rsi,%r15
+  80100a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80100d:	48 89 f7             	mov    %rsi,%rdi
+  801010:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  801017:	00 00 00 
+  80101a:	ff d0                	call   *%rax
+  80101c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80101f:	48 89 de             	mov    %rbx,%rsi
+  801022:	4c 89 f7             	mov    %r14,%rdi
+  801025:	48 b8 5d 0d 80 00 00 	movabs $0x800d5d,%rax
+  80102c:	00 00 00 
+  80102f:	ff d0                	call   *%rax
+  801031:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801034:	48 39 c3             	cmp    %rax,%rbx
+  801037:	74 36                	je     80106f <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801039:	48 89 d8             	mov    %rbx,%rax
+  80103c:	4c 29 e8             	sub    %r13,%rax
+  80103f:	49 39 c4             	cmp    %rax,%r12
+  801042:	73 31                	jae    801075 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801044:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801049:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80104d:	4c 89 fe             	mov    %r15,%rsi
+  801050:	48 b8 e1 0f 80 00 00 	movabs $0x800fe1,%rax
+  801057:	00 00 00 
+  80105a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80105c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801060:	48 83 c4 08          	add    $0x8,%rsp
+  801064:	5b                   	pop    %rbx
+  801065:	41 5c                	pop    %r12
+  801067:	41 5d                	pop    %r13
+  801069:	41 5e                	pop    %r14
+  80106b:	41 5f                	pop    %r15
+  80106d:	5d                   	pop    %rbp
+  80106e:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80106f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801073:	eb eb                	jmp    801060 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801075:	48 83 eb 01          	sub    $0x1,%rbx
+  801079:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80107d:	48 89 da             	mov    %rbx,%rdx
+  801080:	4c 89 fe             	mov    %r15,%rsi
+  801083:	48 b8 e1 0f 80 00 00 	movabs $0x800fe1,%rax
+  80108a:	00 00 00 
+  80108d:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80108f:	49 01 de             	add    %rbx,%r14
+  801092:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801097:	eb c3                	jmp    80105c <strlcat+0x69>
+
+0000000000801099 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801099:	48 85 d2             	test   %rdx,%rdx
+  80109c:	74 2d                	je     8010cb <memcmp+0x32>
+  80109e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010a3:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010a7:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010ac:	44 38 c1             	cmp    %r8b,%cl
+  8010af:	75 0f                	jne    8010c0 <memcmp+0x27>
+    while (n-- > 0) {
+  8010b1:	48 83 c0 01          	add    $0x1,%rax
+  8010b5:	48 39 c2             	cmp    %rax,%rdx
+  8010b8:	75 e9                	jne    8010a3 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010bf:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010c0:	0f b6 c1             	movzbl %cl,%eax
+  8010c3:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010c7:	44 29 c0             	sub    %r8d,%eax
+  8010ca:	c3                   	ret
+    return 0;
+  8010cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010d0:	c3                   	ret
+
+00000000008010d1 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8010d1:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8010d5:	48 39 c7             	cmp    %rax,%rdi
+  8010d8:	73 0f                	jae    8010e9 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8010da:	40 38 37             	cmp    %sil,(%rdi)
+  8010dd:	74 0e                	je     8010ed <memfind+0x1c>
+    for (; src < end; src++) {
+  8010df:	48 83 c7 01          	add    $0x1,%rdi
+  8010e3:	48 39 f8             	cmp    %rdi,%rax
+  8010e6:	75 f2                	jne    8010da <memfind+0x9>
+  8010e8:	c3                   	ret
+  8010e9:	48 89 f8             	mov    %rdi,%rax
+  8010ec:	c3                   	ret
+  8010ed:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8010f0:	c3                   	ret
+
+00000000008010f1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8010f1:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010f4:	0f b6 37             	movzbl (%rdi),%esi
+  8010f7:	40 80 fe 20          	cmp    $0x20,%sil
+  8010fb:	74 06                	je     801103 <strtol+0x12>
+  8010fd:	40 80 fe 09          	cmp    $0x9,%sil
+  801101:	75 13                	jne    801116 <strtol+0x25>
+  801103:	48 83 c7 01          	add    $0x1,%rdi
+  801107:	0f b6 37             	movzbl (%rdi),%esi
+  80110a:	40 80 fe 20          	cmp    $0x20,%sil
+  80110e:	74 f3                	je     801103 <strtol+0x12>
+  801110:	40 80 fe 09          	cmp    $0x9,%sil
+  801114:	74 ed                	je     801103 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801116:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801119:	83 e0 fd             	and    $0xfffffffd,%eax
+  80111c:	3c 01                	cmp    $0x1,%al
+  80111e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801122:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801128:	75 0f                	jne    801139 <strtol+0x48>
+  80112a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80112d:	74 14                	je     801143 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80112f:	85 d2                	test   %edx,%edx
+  801131:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801136:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801139:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80113e:	4c 63 ca             	movslq %edx,%r9
+  801141:	eb 36                	jmp    801179 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801143:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801147:	74 0f                	je     801158 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801149:	85 d2                	test   %edx,%edx
+  80114b:	75 ec                	jne    801139 <strtol+0x48>
+        s++;
+  80114d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801151:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801156:	eb e1                	jmp    801139 <strtol+0x48>
+        s += 2;
+  801158:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80115c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801161:	eb d6                	jmp    801139 <strtol+0x48>
+            dig -= '0';
+  801163:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801166:	44 0f b6 c1          	movzbl %cl,%r8d
+  80116a:	41 39 d0             	cmp    %edx,%r8d
+  80116d:	7d 21                	jge    801190 <strtol+0x9f>
+        val = val * base + dig;
+  80116f:	49 0f af c1          	imul   %r9,%rax
+  801173:	0f b6 c9             	movzbl %cl,%ecx
+  801176:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801179:	48 83 c7 01          	add    $0x1,%rdi
+  80117d:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801181:	80 f9 39             	cmp    $0x39,%cl
+  801184:	76 dd                	jbe    801163 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801186:	80 f9 7b             	cmp    $0x7b,%cl
+  801189:	77 05                	ja     801190 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80118b:	83 e9 57             	sub    $0x57,%ecx
+  80118e:	eb d6                	jmp    801166 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801190:	4d 85 d2             	test   %r10,%r10
+  801193:	74 03                	je     801198 <strtol+0xa7>
+  801195:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801198:	48 89 c2             	mov    %rax,%rdx
+  80119b:	48 f7 da             	neg    %rdx
+  80119e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011a2:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011a6:	c3                   	ret
+
+00000000008011a7 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011a7:	55                   	push   %rbp
+  8011a8:	48 89 e5             	mov    %rsp,%rbp
+  8011ab:	53                   	push   %rbx
+  8011ac:	48 89 fa             	mov    %rdi,%rdx
+  8011af:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011b2:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011cc:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8011ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011d2:	c9                   	leave
+  8011d3:	c3                   	ret
+
+00000000008011d4 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8011d4:	55                   	push   %rbp
+  8011d5:	48 89 e5             	mov    %rsp,%rbp
+  8011d8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011d9:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ed:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011fd:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801203:	c9                   	leave
+  801204:	c3                   	ret
+
+0000000000801205 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801205:	55                   	push   %rbp
+  801206:	48 89 e5             	mov    %rsp,%rbp
+  801209:	53                   	push   %rbx
+  80120a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80120e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801211:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801216:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80121b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801220:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801225:	be 00 00 00 00       	mov    $0x0,%esi
+  80122a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801230:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801232:	48 85 c0             	test   %rax,%rax
+  801235:	7f 06                	jg     80123d <sys_env_destroy+0x38>
+}
+  801237:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80123b:	c9                   	leave
+  80123c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80123d:	49 89 c0             	mov    %rax,%r8
+  801240:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801245:	48 ba f0 32 80 00 00 	movabs $0x8032f0,%rdx
+  80124c:	00 00 00 
+  80124f:	be 26 00 00 00       	mov    $0x26,%esi
+  801254:	48 bf 0f 33 80 00 00 	movabs $0x80330f,%rdi
+  80125b:	00 00 00 
+  80125e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801263:	49 b9 0b 03 80 00 00 	movabs $0x80030b,%r9
+  80126a:	00 00 00 
+  80126d:	41 ff d1             	call   *%r9
+
+0000000000801270 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801270:	55                   	push   %rbp
+  801271:	48 89 e5             	mov    %rsp,%rbp
+  801274:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801275:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80127a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80127f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801284:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801289:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80128e:	be 00 00 00 00       	mov    $0x0,%esi
+  801293:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801299:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80129b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80129f:	c9                   	leave
+  8012a0:	c3                   	ret
+
+00000000008012a1 <sys_yield>:
+
+void
+sys_yield(void) {
+  8012a1:	55                   	push   %rbp
+  8012a2:	48 89 e5             	mov    %rsp,%rbp
+  8012a5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a6:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ca:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d0:	c9                   	leave
+  8012d1:	c3                   	ret
+
+00000000008012d2 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012d2:	55                   	push   %rbp
+  8012d3:	48 89 e5             	mov    %rsp,%rbp
+  8012d6:	53                   	push   %rbx
+  8012d7:	48 89 fa             	mov    %rdi,%rdx
+  8012da:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012dd:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012e2:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8012e9:	00 00 00 
+  8012ec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012fc:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801302:	c9                   	leave
+  801303:	c3                   	ret
+
+0000000000801304 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801304:	55                   	push   %rbp
+  801305:	48 89 e5             	mov    %rsp,%rbp
+  801308:	53                   	push   %rbx
+  801309:	49 89 f8             	mov    %rdi,%r8
+  80130c:	48 89 d3             	mov    %rdx,%rbx
+  80130f:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801312:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801317:	4c 89 c2             	mov    %r8,%rdx
+  80131a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80131d:	be 00 00 00 00       	mov    $0x0,%esi
+  801322:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801328:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80132a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80132e:	c9                   	leave
+  80132f:	c3                   	ret
+
+0000000000801330 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801330:	55                   	push   %rbp
+  801331:	48 89 e5             	mov    %rsp,%rbp
+  801334:	53                   	push   %rbx
+  801335:	48 83 ec 08          	sub    $0x8,%rsp
+  801339:	89 f8                	mov    %edi,%eax
+  80133b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80133e:	48 63 f9             	movslq %ecx,%rdi
+  801341:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801344:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801349:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80134c:	be 00 00 00 00       	mov    $0x0,%esi
+  801351:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801357:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801359:	48 85 c0             	test   %rax,%rax
+  80135c:	7f 06                	jg     801364 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80135e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801362:	c9                   	leave
+  801363:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801364:	49 89 c0             	mov    %rax,%r8
+  801367:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80136c:	48 ba f0 32 80 00 00 	movabs $0x8032f0,%rdx
+  801373:	00 00 00 
+  801376:	be 26 00 00 00       	mov    $0x26,%esi
+  80137b:	48 bf 0f 33 80 00 00 	movabs $0x80330f,%rdi
+  801382:	00 00 00 
+  801385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138a:	49 b9 0b 03 80 00 00 	movabs $0x80030b,%r9
+  801391:	00 00 00 
+  801394:	41 ff d1             	call   *%r9
+
+0000000000801397 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801397:	55                   	push   %rbp
+  801398:	48 89 e5             	mov    %rsp,%rbp
+  80139b:	53                   	push   %rbx
+  80139c:	48 83 ec 08          	sub    $0x8,%rsp
+  8013a0:	89 f8                	mov    %edi,%eax
+  8013a2:	49 89 f2             	mov    %rsi,%r10
+  8013a5:	48 89 cf             	mov    %rcx,%rdi
+  8013a8:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013ab:	48 63 da             	movslq %edx,%rbx
+  8013ae:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b1:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013b6:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b9:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013bc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013be:	48 85 c0             	test   %rax,%rax
+  8013c1:	7f 06                	jg     8013c9 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c7:	c9                   	leave
+  8013c8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c9:	49 89 c0             	mov    %rax,%r8
+  8013cc:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013d1:	48 ba f0 32 80 00 00 	movabs $0x8032f0,%rdx
+  8013d8:	00 00 00 
+  8013db:	be 26 00 00 00       	mov    $0x26,%esi
+  8013e0:	48 bf 0f 33 80 00 00 	movabs $0x80330f,%rdi
+  8013e7:	00 00 00 
+  8013ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ef:	49 b9 0b 03 80 00 00 	movabs $0x80030b,%r9
+  8013f6:	00 00 00 
+  8013f9:	41 ff d1             	call   *%r9
+
+00000000008013fc <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013fc:	55                   	push   %rbp
+  8013fd:	48 89 e5             	mov    %rsp,%rbp
+  801400:	53                   	push   %rbx
+  801401:	48 83 ec 08          	sub    $0x8,%rsp
+  801405:	48 89 f1             	mov    %rsi,%rcx
+  801408:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80140b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80140e:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801413:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801418:	be 00 00 00 00       	mov    $0x0,%esi
+  80141d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801423:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801425:	48 85 c0             	test   %rax,%rax
+  801428:	7f 06                	jg     801430 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80142a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80142e:	c9                   	leave
+  80142f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801430:	49 89 c0             	mov    %rax,%r8
+  801433:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801438:	48 ba f0 32 80 00 00 	movabs $0x8032f0,%rdx
+  80143f:	00 00 00 
+  801442:	be 26 00 00 00       	mov    $0x26,%esi
+  801447:	48 bf 0f 33 80 00 00 	movabs $0x80330f,%rdi
+  80144e:	00 00 00 
+  801451:	b8 00 00 00 00       	mov    $0x0,%eax
+  801456:	49 b9 0b 03 80 00 00 	movabs $0x80030b,%r9
+  80145d:	00 00 00 
+  801460:	41 ff d1             	call   *%r9
+
+0000000000801463 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801463:	55                   	push   %rbp
+  801464:	48 89 e5             	mov    %rsp,%rbp
+  801467:	53                   	push   %rbx
+  801468:	48 83 ec 08          	sub    $0x8,%rsp
+  80146c:	89 f8                	mov    %edi,%eax
+  80146e:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801471:	48 63 f9             	movslq %ecx,%rdi
+  801474:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801477:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80147c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80147f:	be 00 00 00 00       	mov    $0x0,%esi
+  801484:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80148a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80148c:	48 85 c0             	test   %rax,%rax
+  80148f:	7f 06                	jg     801497 <sys_region_advise+0x34>
+}
+  801491:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801495:	c9                   	leave
+  801496:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801497:	49 89 c0             	mov    %rax,%r8
+  80149a:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80149f:	48 ba f0 32 80 00 00 	movabs $0x8032f0,%rdx
+  8014a6:	00 00 00 
+  8014a9:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ae:	48 bf 0f 33 80 00 00 	movabs $0x80330f,%rdi
+  8014b5:	00 00 00 
+  8014b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014bd:	49 b9 0b 03 80 00 00 	movabs $0x80030b,%r9
+  8014c4:	00 00 00 
+  8014c7:	41 ff d1             	call   *%r9
+
+00000000008014ca <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  8014ca:	55                   	push   %rbp
+  8014cb:	48 89 e5             	mov    %rsp,%rbp
+  8014ce:	53                   	push   %rbx
+  8014cf:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  8014d3:	48 63 ce             	movslq %esi,%rcx
+  8014d6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d9:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014f5:	48 85 c0             	test   %rax,%rax
+  8014f8:	7f 06                	jg     801500 <sys_env_set_nice+0x36>
+}
+  8014fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014fe:	c9                   	leave
+  8014ff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801500:	49 89 c0             	mov    %rax,%r8
+  801503:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801508:	48 ba f0 32 80 00 00 	movabs $0x8032f0,%rdx
+  80150f:	00 00 00 
+  801512:	be 26 00 00 00       	mov    $0x26,%esi
+  801517:	48 bf 0f 33 80 00 00 	movabs $0x80330f,%rdi
+  80151e:	00 00 00 
+  801521:	b8 00 00 00 00       	mov    $0x0,%eax
+  801526:	49 b9 0b 03 80 00 00 	movabs $0x80030b,%r9
+  80152d:	00 00 00 
+  801530:	41 ff d1             	call   *%r9
+
+0000000000801533 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801533:	55                   	push   %rbp
+  801534:	48 89 e5             	mov    %rsp,%rbp
+  801537:	53                   	push   %rbx
+  801538:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80153c:	48 63 ce             	movslq %esi,%rcx
+  80153f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801542:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801547:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80154c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801551:	be 00 00 00 00       	mov    $0x0,%esi
+  801556:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80155c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80155e:	48 85 c0             	test   %rax,%rax
+  801561:	7f 06                	jg     801569 <sys_env_set_status+0x36>
+}
+  801563:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801567:	c9                   	leave
+  801568:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801569:	49 89 c0             	mov    %rax,%r8
+  80156c:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801571:	48 ba f0 32 80 00 00 	movabs $0x8032f0,%rdx
+  801578:	00 00 00 
+  80157b:	be 26 00 00 00       	mov    $0x26,%esi
+  801580:	48 bf 0f 33 80 00 00 	movabs $0x80330f,%rdi
+  801587:	00 00 00 
+  80158a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80158f:	49 b9 0b 03 80 00 00 	movabs $0x80030b,%r9
+  801596:	00 00 00 
+  801599:	41 ff d1             	call   *%r9
+
+000000000080159c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80159c:	55                   	push   %rbp
+  80159d:	48 89 e5             	mov    %rsp,%rbp
+  8015a0:	53                   	push   %rbx
+  8015a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a5:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8015a8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8015bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015c7:	48 85 c0             	test   %rax,%rax
+  8015ca:	7f 06                	jg     8015d2 <sys_env_set_trapframe+0x36>
+}
+  8015cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d0:	c9                   	leave
+  8015d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015d2:	49 89 c0             	mov    %rax,%r8
+  8015d5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8015da:	48 ba f0 32 80 00 00 	movabs $0x8032f0,%rdx
+  8015e1:	00 00 00 
+  8015e4:	be 26 00 00 00       	mov    $0x26,%esi
+  8015e9:	48 bf 0f 33 80 00 00 	movabs $0x80330f,%rdi
+  8015f0:	00 00 00 
+  8015f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f8:	49 b9 0b 03 80 00 00 	movabs $0x80030b,%r9
+  8015ff:	00 00 00 
+  801602:	41 ff d1             	call   *%r9
+
+0000000000801605 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801605:	55                   	push   %rbp
+  801606:	48 89 e5             	mov    %rsp,%rbp
+  801609:	53                   	push   %rbx
+  80160a:	48 83 ec 08          	sub    $0x8,%rsp
+  80160e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801611:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801614:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801619:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801623:	be 00 00 00 00       	mov    $0x0,%esi
+  801628:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80162e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801630:	48 85 c0             	test   %rax,%rax
+  801633:	7f 06                	jg     80163b <sys_env_set_pgfault_upcall+0x36>
+}
+  801635:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801639:	c9                   	leave
+  80163a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80163b:	49 89 c0             	mov    %rax,%r8
+  80163e:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801643:	48 ba f0 32 80 00 00 	movabs $0x8032f0,%rdx
+  80164a:	00 00 00 
+  80164d:	be 26 00 00 00       	mov    $0x26,%esi
+  801652:	48 bf 0f 33 80 00 00 	movabs $0x80330f,%rdi
+  801659:	00 00 00 
+  80165c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801661:	49 b9 0b 03 80 00 00 	movabs $0x80030b,%r9
+  801668:	00 00 00 
+  80166b:	41 ff d1             	call   *%r9
+
+000000000080166e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80166e:	55                   	push   %rbp
+  80166f:	48 89 e5             	mov    %rsp,%rbp
+  801672:	53                   	push   %rbx
+  801673:	89 f8                	mov    %edi,%eax
+  801675:	49 89 f1             	mov    %rsi,%r9
+  801678:	48 89 d3             	mov    %rdx,%rbx
+  80167b:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80167e:	49 63 f0             	movslq %r8d,%rsi
+  801681:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801684:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801689:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80168c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801692:	cd 30                	int    $0x30
+}
+  801694:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801698:	c9                   	leave
+  801699:	c3                   	ret
+
+000000000080169a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80169a:	55                   	push   %rbp
+  80169b:	48 89 e5             	mov    %rsp,%rbp
+  80169e:	53                   	push   %rbx
+  80169f:	48 83 ec 08          	sub    $0x8,%rsp
+  8016a3:	48 89 fa             	mov    %rdi,%rdx
+  8016a6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016a9:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8016bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016c5:	48 85 c0             	test   %rax,%rax
+  8016c8:	7f 06                	jg     8016d0 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ce:	c9                   	leave
+  8016cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016d0:	49 89 c0             	mov    %rax,%r8
+  8016d3:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8016d8:	48 ba f0 32 80 00 00 	movabs $0x8032f0,%rdx
+  8016df:	00 00 00 
+  8016e2:	be 26 00 00 00       	mov    $0x26,%esi
+  8016e7:	48 bf 0f 33 80 00 00 	movabs $0x80330f,%rdi
+  8016ee:	00 00 00 
+  8016f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f6:	49 b9 0b 03 80 00 00 	movabs $0x80030b,%r9
+  8016fd:	00 00 00 
+  801700:	41 ff d1             	call   *%r9
+
+0000000000801703 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801703:	55                   	push   %rbp
+  801704:	48 89 e5             	mov    %rsp,%rbp
+  801707:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801708:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80170d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801712:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801717:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801721:	be 00 00 00 00       	mov    $0x0,%esi
+  801726:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80172c:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80172e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801732:	c9                   	leave
+  801733:	c3                   	ret
+
+0000000000801734 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  801734:	55                   	push   %rbp
+  801735:	48 89 e5             	mov    %rsp,%rbp
+  801738:	53                   	push   %rbx
+  801739:	48 83 ec 08          	sub    $0x8,%rsp
+  80173d:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801740:	48 63 ce             	movslq %esi,%rcx
+  801743:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801746:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80174b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801750:	be 00 00 00 00       	mov    $0x0,%esi
+  801755:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80175b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80175d:	48 85 c0             	test   %rax,%rax
+  801760:	7f 06                	jg     801768 <sys_sigqueue+0x34>
+}
+  801762:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801766:	c9                   	leave
+  801767:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801768:	49 89 c0             	mov    %rax,%r8
+  80176b:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801770:	48 ba f0 32 80 00 00 	movabs $0x8032f0,%rdx
+  801777:	00 00 00 
+  80177a:	be 26 00 00 00       	mov    $0x26,%esi
+  80177f:	48 bf 0f 33 80 00 00 	movabs $0x80330f,%rdi
+  801786:	00 00 00 
+  801789:	b8 00 00 00 00       	mov    $0x0,%eax
+  80178e:	49 b9 0b 03 80 00 00 	movabs $0x80030b,%r9
+  801795:	00 00 00 
+  801798:	41 ff d1             	call   *%r9
+
+000000000080179b <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  80179b:	55                   	push   %rbp
+  80179c:	48 89 e5             	mov    %rsp,%rbp
+  80179f:	53                   	push   %rbx
+  8017a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8017a4:	48 89 fa             	mov    %rdi,%rdx
+  8017a7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017aa:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8017be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017c6:	48 85 c0             	test   %rax,%rax
+  8017c9:	7f 06                	jg     8017d1 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  8017cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017cf:	c9                   	leave
+  8017d0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017d1:	49 89 c0             	mov    %rax,%r8
+  8017d4:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8017d9:	48 ba f0 32 80 00 00 	movabs $0x8032f0,%rdx
+  8017e0:	00 00 00 
+  8017e3:	be 26 00 00 00       	mov    $0x26,%esi
+  8017e8:	48 bf 0f 33 80 00 00 	movabs $0x80330f,%rdi
+  8017ef:	00 00 00 
+  8017f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f7:	49 b9 0b 03 80 00 00 	movabs $0x80030b,%r9
+  8017fe:	00 00 00 
+  801801:	41 ff d1             	call   *%r9
+
+0000000000801804 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801804:	55                   	push   %rbp
+  801805:	48 89 e5             	mov    %rsp,%rbp
+  801808:	53                   	push   %rbx
+  801809:	48 83 ec 08          	sub    $0x8,%rsp
+  80180d:	48 89 f1             	mov    %rsi,%rcx
+  801810:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801813:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801816:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80181b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801820:	be 00 00 00 00       	mov    $0x0,%esi
+  801825:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80182b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80182d:	48 85 c0             	test   %rax,%rax
+  801830:	7f 06                	jg     801838 <sys_sigaction+0x34>
+}
+  801832:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801836:	c9                   	leave
+  801837:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801838:	49 89 c0             	mov    %rax,%r8
+  80183b:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801840:	48 ba f0 32 80 00 00 	movabs $0x8032f0,%rdx
+  801847:	00 00 00 
+  80184a:	be 26 00 00 00       	mov    $0x26,%esi
+  80184f:	48 bf 0f 33 80 00 00 	movabs $0x80330f,%rdi
+  801856:	00 00 00 
+  801859:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185e:	49 b9 0b 03 80 00 00 	movabs $0x80030b,%r9
+  801865:	00 00 00 
+  801868:	41 ff d1             	call   *%r9
+
+000000000080186b <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  80186b:	55                   	push   %rbp
+  80186c:	48 89 e5             	mov    %rsp,%rbp
+  80186f:	53                   	push   %rbx
+  801870:	48 83 ec 08          	sub    $0x8,%rsp
+  801874:	48 89 f1             	mov    %rsi,%rcx
+  801877:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  80187a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80187d:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801882:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801887:	be 00 00 00 00       	mov    $0x0,%esi
+  80188c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801892:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801894:	48 85 c0             	test   %rax,%rax
+  801897:	7f 06                	jg     80189f <sys_sigprocmask+0x34>
+}
+  801899:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80189d:	c9                   	leave
+  80189e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80189f:	49 89 c0             	mov    %rax,%r8
+  8018a2:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8018a7:	48 ba f0 32 80 00 00 	movabs $0x8032f0,%rdx
+  8018ae:	00 00 00 
+  8018b1:	be 26 00 00 00       	mov    $0x26,%esi
+  8018b6:	48 bf 0f 33 80 00 00 	movabs $0x80330f,%rdi
+  8018bd:	00 00 00 
+  8018c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c5:	49 b9 0b 03 80 00 00 	movabs $0x80030b,%r9
+  8018cc:	00 00 00 
+  8018cf:	41 ff d1             	call   *%r9
+
+00000000008018d2 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018d2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018d9:	ff ff ff 
+  8018dc:	48 01 f8             	add    %rdi,%rax
+  8018df:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8018e3:	c3                   	ret
+
+00000000008018e4 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018e4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018eb:	ff ff ff 
+  8018ee:	48 01 f8             	add    %rdi,%rax
+  8018f1:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8018f5:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8018fb:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8018ff:	c3                   	ret
+
+0000000000801900 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801900:	55                   	push   %rbp
+  801901:	48 89 e5             	mov    %rsp,%rbp
+  801904:	41 57                	push   %r15
+  801906:	41 56                	push   %r14
+  801908:	41 55                	push   %r13
+  80190a:	41 54                	push   %r12
+  80190c:	53                   	push   %rbx
+  80190d:	48 83 ec 08          	sub    $0x8,%rsp
+  801911:	49 89 ff             	mov    %rdi,%r15
+  801914:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801919:	49 bd 7e 28 80 00 00 	movabs $0x80287e,%r13
+  801920:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801923:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801929:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80192c:	48 89 df             	mov    %rbx,%rdi
+  80192f:	41 ff d5             	call   *%r13
+  801932:	83 e0 04             	and    $0x4,%eax
+  801935:	74 17                	je     80194e <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801937:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80193e:	4c 39 f3             	cmp    %r14,%rbx
+  801941:	75 e6                	jne    801929 <fd_alloc+0x29>
+  801943:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801949:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80194e:	4d 89 27             	mov    %r12,(%r15)
+}
+  801951:	48 83 c4 08          	add    $0x8,%rsp
+  801955:	5b                   	pop    %rbx
+  801956:	41 5c                	pop    %r12
+  801958:	41 5d                	pop    %r13
+  80195a:	41 5e                	pop    %r14
+  80195c:	41 5f                	pop    %r15
+  80195e:	5d                   	pop    %rbp
+  80195f:	c3                   	ret
+
+0000000000801960 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801960:	83 ff 1f             	cmp    $0x1f,%edi
+  801963:	77 39                	ja     80199e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801965:	55                   	push   %rbp
+  801966:	48 89 e5             	mov    %rsp,%rbp
+  801969:	41 54                	push   %r12
+  80196b:	53                   	push   %rbx
+  80196c:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80196f:	48 63 df             	movslq %edi,%rbx
+  801972:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801979:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80197d:	48 89 df             	mov    %rbx,%rdi
+  801980:	48 b8 7e 28 80 00 00 	movabs $0x80287e,%rax
+  801987:	00 00 00 
+  80198a:	ff d0                	call   *%rax
+  80198c:	a8 04                	test   $0x4,%al
+  80198e:	74 14                	je     8019a4 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801990:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801994:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801999:	5b                   	pop    %rbx
+  80199a:	41 5c                	pop    %r12
+  80199c:	5d                   	pop    %rbp
+  80199d:	c3                   	ret
+        return -E_INVAL;
+  80199e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8019a3:	c3                   	ret
+        return -E_INVAL;
+  8019a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019a9:	eb ee                	jmp    801999 <fd_lookup+0x39>
+
+00000000008019ab <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8019ab:	55                   	push   %rbp
+  8019ac:	48 89 e5             	mov    %rsp,%rbp
+  8019af:	41 54                	push   %r12
+  8019b1:	53                   	push   %rbx
+  8019b2:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8019b5:	48 b8 a0 33 80 00 00 	movabs $0x8033a0,%rax
+  8019bc:	00 00 00 
+  8019bf:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8019c6:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8019c9:	39 3b                	cmp    %edi,(%rbx)
+  8019cb:	74 47                	je     801a14 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8019cd:	48 83 c0 08          	add    $0x8,%rax
+  8019d1:	48 8b 18             	mov    (%rax),%rbx
+  8019d4:	48 85 db             	test   %rbx,%rbx
+  8019d7:	75 f0                	jne    8019c9 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019d9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8019e0:	00 00 00 
+  8019e3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019e9:	89 fa                	mov    %edi,%edx
+  8019eb:	48 bf 20 33 80 00 00 	movabs $0x803320,%rdi
+  8019f2:	00 00 00 
+  8019f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fa:	48 b9 5b 04 80 00 00 	movabs $0x80045b,%rcx
+  801a01:	00 00 00 
+  801a04:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a06:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a0b:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a0f:	5b                   	pop    %rbx
+  801a10:	41 5c                	pop    %r12
+  801a12:	5d                   	pop    %rbp
+  801a13:	c3                   	ret
+            return 0;
+  801a14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a19:	eb f0                	jmp    801a0b <dev_lookup+0x60>
+
+0000000000801a1b <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a1b:	55                   	push   %rbp
+  801a1c:	48 89 e5             	mov    %rsp,%rbp
+  801a1f:	41 55                	push   %r13
+  801a21:	41 54                	push   %r12
+  801a23:	53                   	push   %rbx
+  801a24:	48 83 ec 18          	sub    $0x18,%rsp
+  801a28:	48 89 fb             	mov    %rdi,%rbx
+  801a2b:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a2e:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a35:	ff ff ff 
+  801a38:	48 01 df             	add    %rbx,%rdi
+  801a3b:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a3f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a43:	48 b8 60 19 80 00 00 	movabs $0x801960,%rax
+  801a4a:	00 00 00 
+  801a4d:	ff d0                	call   *%rax
+  801a4f:	41 89 c5             	mov    %eax,%r13d
+  801a52:	85 c0                	test   %eax,%eax
+  801a54:	78 06                	js     801a5c <fd_close+0x41>
+  801a56:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a5a:	74 1a                	je     801a76 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a5c:	45 84 e4             	test   %r12b,%r12b
+  801a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a64:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a68:	44 89 e8             	mov    %r13d,%eax
+  801a6b:	48 83 c4 18          	add    $0x18,%rsp
+  801a6f:	5b                   	pop    %rbx
+  801a70:	41 5c                	pop    %r12
+  801a72:	41 5d                	pop    %r13
+  801a74:	5d                   	pop    %rbp
+  801a75:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a76:	8b 3b                	mov    (%rbx),%edi
+  801a78:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a7c:	48 b8 ab 19 80 00 00 	movabs $0x8019ab,%rax
+  801a83:	00 00 00 
+  801a86:	ff d0                	call   *%rax
+  801a88:	41 89 c5             	mov    %eax,%r13d
+  801a8b:	85 c0                	test   %eax,%eax
+  801a8d:	78 1b                	js     801aaa <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a8f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a93:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801a97:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a9d:	48 85 c0             	test   %rax,%rax
+  801aa0:	74 08                	je     801aaa <fd_close+0x8f>
+  801aa2:	48 89 df             	mov    %rbx,%rdi
+  801aa5:	ff d0                	call   *%rax
+  801aa7:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801aaa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801aaf:	48 89 de             	mov    %rbx,%rsi
+  801ab2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ab7:	48 b8 fc 13 80 00 00 	movabs $0x8013fc,%rax
+  801abe:	00 00 00 
+  801ac1:	ff d0                	call   *%rax
+    return res;
+  801ac3:	eb a3                	jmp    801a68 <fd_close+0x4d>
+
+0000000000801ac5 <close>:
+
+int
+close(int fdnum) {
+  801ac5:	55                   	push   %rbp
+  801ac6:	48 89 e5             	mov    %rsp,%rbp
+  801ac9:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801acd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ad1:	48 b8 60 19 80 00 00 	movabs $0x801960,%rax
+  801ad8:	00 00 00 
+  801adb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801add:	85 c0                	test   %eax,%eax
+  801adf:	78 15                	js     801af6 <close+0x31>
+
+    return fd_close(fd, 1);
+  801ae1:	be 01 00 00 00       	mov    $0x1,%esi
+  801ae6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801aea:	48 b8 1b 1a 80 00 00 	movabs $0x801a1b,%rax
+  801af1:	00 00 00 
+  801af4:	ff d0                	call   *%rax
+}
+  801af6:	c9                   	leave
+  801af7:	c3                   	ret
+
+0000000000801af8 <close_all>:
+
+void
+close_all(void) {
+  801af8:	55                   	push   %rbp
+  801af9:	48 89 e5             	mov    %rsp,%rbp
+  801afc:	41 54                	push   %r12
+  801afe:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801aff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b04:	49 bc c5 1a 80 00 00 	movabs $0x801ac5,%r12
+  801b0b:	00 00 00 
+  801b0e:	89 df                	mov    %ebx,%edi
+  801b10:	41 ff d4             	call   *%r12
+  801b13:	83 c3 01             	add    $0x1,%ebx
+  801b16:	83 fb 20             	cmp    $0x20,%ebx
+  801b19:	75 f3                	jne    801b0e <close_all+0x16>
+}
+  801b1b:	5b                   	pop    %rbx
+  801b1c:	41 5c                	pop    %r12
+  801b1e:	5d                   	pop    %rbp
+  801b1f:	c3                   	ret
+
+0000000000801b20 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b20:	55                   	push   %rbp
+  801b21:	48 89 e5             	mov    %rsp,%rbp
+  801b24:	41 57                	push   %r15
+  801b26:	41 56                	push   %r14
+  801b28:	41 55                	push   %r13
+  801b2a:	41 54                	push   %r12
+  801b2c:	53                   	push   %rbx
+  801b2d:	48 83 ec 18          	sub    $0x18,%rsp
+  801b31:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b34:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b38:	48 b8 60 19 80 00 00 	movabs $0x801960,%rax
+  801b3f:	00 00 00 
+  801b42:	ff d0                	call   *%rax
+  801b44:	89 c3                	mov    %eax,%ebx
+  801b46:	85 c0                	test   %eax,%eax
+  801b48:	0f 88 b8 00 00 00    	js     801c06 <dup+0xe6>
+    close(newfdnum);
+  801b4e:	44 89 e7             	mov    %r12d,%edi
+  801b51:	48 b8 c5 1a 80 00 00 	movabs $0x801ac5,%rax
+  801b58:	00 00 00 
+  801b5b:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b5d:	4d 63 ec             	movslq %r12d,%r13
+  801b60:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801b67:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801b6b:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b6f:	4c 89 ff             	mov    %r15,%rdi
+  801b72:	49 be e4 18 80 00 00 	movabs $0x8018e4,%r14
+  801b79:	00 00 00 
+  801b7c:	41 ff d6             	call   *%r14
+  801b7f:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b82:	4c 89 ef             	mov    %r13,%rdi
+  801b85:	41 ff d6             	call   *%r14
+  801b88:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b8b:	48 89 df             	mov    %rbx,%rdi
+  801b8e:	48 b8 7e 28 80 00 00 	movabs $0x80287e,%rax
+  801b95:	00 00 00 
+  801b98:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801b9a:	a8 04                	test   $0x4,%al
+  801b9c:	74 2b                	je     801bc9 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801b9e:	41 89 c1             	mov    %eax,%r9d
+  801ba1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ba7:	4c 89 f1             	mov    %r14,%rcx
+  801baa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801baf:	48 89 de             	mov    %rbx,%rsi
+  801bb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bb7:	48 b8 97 13 80 00 00 	movabs $0x801397,%rax
+  801bbe:	00 00 00 
+  801bc1:	ff d0                	call   *%rax
+  801bc3:	89 c3                	mov    %eax,%ebx
+  801bc5:	85 c0                	test   %eax,%eax
+  801bc7:	78 4e                	js     801c17 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801bc9:	4c 89 ff             	mov    %r15,%rdi
+  801bcc:	48 b8 7e 28 80 00 00 	movabs $0x80287e,%rax
+  801bd3:	00 00 00 
+  801bd6:	ff d0                	call   *%rax
+  801bd8:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801bdb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801be1:	4c 89 e9             	mov    %r13,%rcx
+  801be4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801be9:	4c 89 fe             	mov    %r15,%rsi
+  801bec:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bf1:	48 b8 97 13 80 00 00 	movabs $0x801397,%rax
+  801bf8:	00 00 00 
+  801bfb:	ff d0                	call   *%rax
+  801bfd:	89 c3                	mov    %eax,%ebx
+  801bff:	85 c0                	test   %eax,%eax
+  801c01:	78 14                	js     801c17 <dup+0xf7>
+
+    return newfdnum;
+  801c03:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c06:	89 d8                	mov    %ebx,%eax
+  801c08:	48 83 c4 18          	add    $0x18,%rsp
+  801c0c:	5b                   	pop    %rbx
+  801c0d:	41 5c                	pop    %r12
+  801c0f:	41 5d                	pop    %r13
+  801c11:	41 5e                	pop    %r14
+  801c13:	41 5f                	pop    %r15
+  801c15:	5d                   	pop    %rbp
+  801c16:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c17:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c1c:	4c 89 ee             	mov    %r13,%rsi
+  801c1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c24:	49 bc fc 13 80 00 00 	movabs $0x8013fc,%r12
+  801c2b:	00 00 00 
+  801c2e:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c31:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c36:	4c 89 f6             	mov    %r14,%rsi
+  801c39:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c3e:	41 ff d4             	call   *%r12
+    return res;
+  801c41:	eb c3                	jmp    801c06 <dup+0xe6>
+
+0000000000801c43 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c43:	55                   	push   %rbp
+  801c44:	48 89 e5             	mov    %rsp,%rbp
+  801c47:	41 56                	push   %r14
+  801c49:	41 55                	push   %r13
+  801c4b:	41 54                	push   %r12
+  801c4d:	53                   	push   %rbx
+  801c4e:	48 83 ec 10          	sub    $0x10,%rsp
+  801c52:	89 fb                	mov    %edi,%ebx
+  801c54:	49 89 f4             	mov    %rsi,%r12
+  801c57:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c5a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c5e:	48 b8 60 19 80 00 00 	movabs $0x801960,%rax
+  801c65:	00 00 00 
+  801c68:	ff d0                	call   *%rax
+  801c6a:	85 c0                	test   %eax,%eax
+  801c6c:	78 4c                	js     801cba <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c6e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c72:	41 8b 3e             	mov    (%r14),%edi
+  801c75:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c79:	48 b8 ab 19 80 00 00 	movabs $0x8019ab,%rax
+  801c80:	00 00 00 
+  801c83:	ff d0                	call   *%rax
+  801c85:	85 c0                	test   %eax,%eax
+  801c87:	78 35                	js     801cbe <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c89:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c8d:	83 e0 03             	and    $0x3,%eax
+  801c90:	83 f8 01             	cmp    $0x1,%eax
+  801c93:	74 2d                	je     801cc2 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c95:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c99:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c9d:	48 85 c0             	test   %rax,%rax
+  801ca0:	74 56                	je     801cf8 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ca2:	4c 89 ea             	mov    %r13,%rdx
+  801ca5:	4c 89 e6             	mov    %r12,%rsi
+  801ca8:	4c 89 f7             	mov    %r14,%rdi
+  801cab:	ff d0                	call   *%rax
+}
+  801cad:	48 83 c4 10          	add    $0x10,%rsp
+  801cb1:	5b                   	pop    %rbx
+  801cb2:	41 5c                	pop    %r12
+  801cb4:	41 5d                	pop    %r13
+  801cb6:	41 5e                	pop    %r14
+  801cb8:	5d                   	pop    %rbp
+  801cb9:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cba:	48 98                	cltq
+  801cbc:	eb ef                	jmp    801cad <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cbe:	48 98                	cltq
+  801cc0:	eb eb                	jmp    801cad <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cc2:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801cc9:	00 00 00 
+  801ccc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cd2:	89 da                	mov    %ebx,%edx
+  801cd4:	48 bf 61 33 80 00 00 	movabs $0x803361,%rdi
+  801cdb:	00 00 00 
+  801cde:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce3:	48 b9 5b 04 80 00 00 	movabs $0x80045b,%rcx
+  801cea:	00 00 00 
+  801ced:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cef:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801cf6:	eb b5                	jmp    801cad <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801cf8:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801cff:	eb ac                	jmp    801cad <read+0x6a>
+
+0000000000801d01 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d01:	55                   	push   %rbp
+  801d02:	48 89 e5             	mov    %rsp,%rbp
+  801d05:	41 57                	push   %r15
+  801d07:	41 56                	push   %r14
+  801d09:	41 55                	push   %r13
+  801d0b:	41 54                	push   %r12
+  801d0d:	53                   	push   %rbx
+  801d0e:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d12:	48 85 d2             	test   %rdx,%rdx
+  801d15:	74 54                	je     801d6b <readn+0x6a>
+  801d17:	41 89 fd             	mov    %edi,%r13d
+  801d1a:	49 89 f6             	mov    %rsi,%r14
+  801d1d:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d20:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d25:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d2a:	49 bf 43 1c 80 00 00 	movabs $0x801c43,%r15
+  801d31:	00 00 00 
+  801d34:	4c 89 e2             	mov    %r12,%rdx
+  801d37:	48 29 f2             	sub    %rsi,%rdx
+  801d3a:	4c 01 f6             	add    %r14,%rsi
+  801d3d:	44 89 ef             	mov    %r13d,%edi
+  801d40:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d43:	85 c0                	test   %eax,%eax
+  801d45:	78 20                	js     801d67 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d47:	01 c3                	add    %eax,%ebx
+  801d49:	85 c0                	test   %eax,%eax
+  801d4b:	74 08                	je     801d55 <readn+0x54>
+  801d4d:	48 63 f3             	movslq %ebx,%rsi
+  801d50:	4c 39 e6             	cmp    %r12,%rsi
+  801d53:	72 df                	jb     801d34 <readn+0x33>
+    }
+    return res;
+  801d55:	48 63 c3             	movslq %ebx,%rax
+}
+  801d58:	48 83 c4 08          	add    $0x8,%rsp
+  801d5c:	5b                   	pop    %rbx
+  801d5d:	41 5c                	pop    %r12
+  801d5f:	41 5d                	pop    %r13
+  801d61:	41 5e                	pop    %r14
+  801d63:	41 5f                	pop    %r15
+  801d65:	5d                   	pop    %rbp
+  801d66:	c3                   	ret
+        if (inc < 0) return inc;
+  801d67:	48 98                	cltq
+  801d69:	eb ed                	jmp    801d58 <readn+0x57>
+    int inc = 1, res = 0;
+  801d6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d70:	eb e3                	jmp    801d55 <readn+0x54>
+
+0000000000801d72 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d72:	55                   	push   %rbp
+  801d73:	48 89 e5             	mov    %rsp,%rbp
+  801d76:	41 56                	push   %r14
+  801d78:	41 55                	push   %r13
+  801d7a:	41 54                	push   %r12
+  801d7c:	53                   	push   %rbx
+  801d7d:	48 83 ec 10          	sub    $0x10,%rsp
+  801d81:	89 fb                	mov    %edi,%ebx
+  801d83:	49 89 f4             	mov    %rsi,%r12
+  801d86:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d89:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d8d:	48 b8 60 19 80 00 00 	movabs $0x801960,%rax
+  801d94:	00 00 00 
+  801d97:	ff d0                	call   *%rax
+  801d99:	85 c0                	test   %eax,%eax
+  801d9b:	78 47                	js     801de4 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d9d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801da1:	41 8b 3e             	mov    (%r14),%edi
+  801da4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801da8:	48 b8 ab 19 80 00 00 	movabs $0x8019ab,%rax
+  801daf:	00 00 00 
+  801db2:	ff d0                	call   *%rax
+  801db4:	85 c0                	test   %eax,%eax
+  801db6:	78 30                	js     801de8 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801db8:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801dbd:	74 2d                	je     801dec <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dbf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dc3:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801dc7:	48 85 c0             	test   %rax,%rax
+  801dca:	74 56                	je     801e22 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801dcc:	4c 89 ea             	mov    %r13,%rdx
+  801dcf:	4c 89 e6             	mov    %r12,%rsi
+  801dd2:	4c 89 f7             	mov    %r14,%rdi
+  801dd5:	ff d0                	call   *%rax
+}
+  801dd7:	48 83 c4 10          	add    $0x10,%rsp
+  801ddb:	5b                   	pop    %rbx
+  801ddc:	41 5c                	pop    %r12
+  801dde:	41 5d                	pop    %r13
+  801de0:	41 5e                	pop    %r14
+  801de2:	5d                   	pop    %rbp
+  801de3:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801de4:	48 98                	cltq
+  801de6:	eb ef                	jmp    801dd7 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801de8:	48 98                	cltq
+  801dea:	eb eb                	jmp    801dd7 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dec:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801df3:	00 00 00 
+  801df6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801dfc:	89 da                	mov    %ebx,%edx
+  801dfe:	48 bf 7d 33 80 00 00 	movabs $0x80337d,%rdi
+  801e05:	00 00 00 
+  801e08:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0d:	48 b9 5b 04 80 00 00 	movabs $0x80045b,%rcx
+  801e14:	00 00 00 
+  801e17:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e19:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e20:	eb b5                	jmp    801dd7 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e22:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e29:	eb ac                	jmp    801dd7 <write+0x65>
+
+0000000000801e2b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e2b:	55                   	push   %rbp
+  801e2c:	48 89 e5             	mov    %rsp,%rbp
+  801e2f:	53                   	push   %rbx
+  801e30:	48 83 ec 18          	sub    $0x18,%rsp
+  801e34:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e36:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e3a:	48 b8 60 19 80 00 00 	movabs $0x801960,%rax
+  801e41:	00 00 00 
+  801e44:	ff d0                	call   *%rax
+  801e46:	85 c0                	test   %eax,%eax
+  801e48:	78 0c                	js     801e56 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801e4a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e4e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801e51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e56:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e5a:	c9                   	leave
+  801e5b:	c3                   	ret
+
+0000000000801e5c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e5c:	55                   	push   %rbp
+  801e5d:	48 89 e5             	mov    %rsp,%rbp
+  801e60:	41 55                	push   %r13
+  801e62:	41 54                	push   %r12
+  801e64:	53                   	push   %rbx
+  801e65:	48 83 ec 18          	sub    $0x18,%rsp
+  801e69:	89 fb                	mov    %edi,%ebx
+  801e6b:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e6e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e72:	48 b8 60 19 80 00 00 	movabs $0x801960,%rax
+  801e79:	00 00 00 
+  801e7c:	ff d0                	call   *%rax
+  801e7e:	85 c0                	test   %eax,%eax
+  801e80:	78 38                	js     801eba <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e82:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e86:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e8a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e8e:	48 b8 ab 19 80 00 00 	movabs $0x8019ab,%rax
+  801e95:	00 00 00 
+  801e98:	ff d0                	call   *%rax
+  801e9a:	85 c0                	test   %eax,%eax
+  801e9c:	78 1c                	js     801eba <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e9e:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801ea3:	74 20                	je     801ec5 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ea5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ea9:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801ead:	48 85 c0             	test   %rax,%rax
+  801eb0:	74 47                	je     801ef9 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801eb2:	44 89 e6             	mov    %r12d,%esi
+  801eb5:	4c 89 ef             	mov    %r13,%rdi
+  801eb8:	ff d0                	call   *%rax
+}
+  801eba:	48 83 c4 18          	add    $0x18,%rsp
+  801ebe:	5b                   	pop    %rbx
+  801ebf:	41 5c                	pop    %r12
+  801ec1:	41 5d                	pop    %r13
+  801ec3:	5d                   	pop    %rbp
+  801ec4:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ec5:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ecc:	00 00 00 
+  801ecf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ed5:	89 da                	mov    %ebx,%edx
+  801ed7:	48 bf 40 33 80 00 00 	movabs $0x803340,%rdi
+  801ede:	00 00 00 
+  801ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee6:	48 b9 5b 04 80 00 00 	movabs $0x80045b,%rcx
+  801eed:	00 00 00 
+  801ef0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ef2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ef7:	eb c1                	jmp    801eba <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ef9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801efe:	eb ba                	jmp    801eba <ftruncate+0x5e>
+
+0000000000801f00 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f00:	55                   	push   %rbp
+  801f01:	48 89 e5             	mov    %rsp,%rbp
+  801f04:	41 54                	push   %r12
+  801f06:	53                   	push   %rbx
+  801f07:	48 83 ec 10          	sub    $0x10,%rsp
+  801f0b:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f0e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f12:	48 b8 60 19 80 00 00 	movabs $0x801960,%rax
+  801f19:	00 00 00 
+  801f1c:	ff d0                	call   *%rax
+  801f1e:	85 c0                	test   %eax,%eax
+  801f20:	78 4e                	js     801f70 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f22:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f26:	41 8b 3c 24          	mov    (%r12),%edi
+  801f2a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f2e:	48 b8 ab 19 80 00 00 	movabs $0x8019ab,%rax
+  801f35:	00 00 00 
+  801f38:	ff d0                	call   *%rax
+  801f3a:	85 c0                	test   %eax,%eax
+  801f3c:	78 32                	js     801f70 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f3e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f42:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f47:	74 30                	je     801f79 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f49:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f4c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f53:	00 00 00 
+    stat->st_isdir = 0;
+  801f56:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f5d:	00 00 00 
+    stat->st_dev = dev;
+  801f60:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f67:	48 89 de             	mov    %rbx,%rsi
+  801f6a:	4c 89 e7             	mov    %r12,%rdi
+  801f6d:	ff 50 28             	call   *0x28(%rax)
+}
+  801f70:	48 83 c4 10          	add    $0x10,%rsp
+  801f74:	5b                   	pop    %rbx
+  801f75:	41 5c                	pop    %r12
+  801f77:	5d                   	pop    %rbp
+  801f78:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f79:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f7e:	eb f0                	jmp    801f70 <fstat+0x70>
+
+0000000000801f80 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f80:	55                   	push   %rbp
+  801f81:	48 89 e5             	mov    %rsp,%rbp
+  801f84:	41 54                	push   %r12
+  801f86:	53                   	push   %rbx
+  801f87:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f8a:	be 00 00 00 00       	mov    $0x0,%esi
+  801f8f:	48 b8 01 22 80 00 00 	movabs $0x802201,%rax
+  801f96:	00 00 00 
+  801f99:	ff d0                	call   *%rax
+  801f9b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f9d:	85 c0                	test   %eax,%eax
+  801f9f:	78 25                	js     801fc6 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801fa1:	4c 89 e6             	mov    %r12,%rsi
+  801fa4:	89 c7                	mov    %eax,%edi
+  801fa6:	48 b8 00 1f 80 00 00 	movabs $0x801f00,%rax
+  801fad:	00 00 00 
+  801fb0:	ff d0                	call   *%rax
+  801fb2:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801fb5:	89 df                	mov    %ebx,%edi
+  801fb7:	48 b8 c5 1a 80 00 00 	movabs $0x801ac5,%rax
+  801fbe:	00 00 00 
+  801fc1:	ff d0                	call   *%rax
+
+    return res;
+  801fc3:	44 89 e3             	mov    %r12d,%ebx
+}
+  801fc6:	89 d8                	mov    %ebx,%eax
+  801fc8:	5b                   	pop    %rbx
+  801fc9:	41 5c                	pop    %r12
+  801fcb:	5d                   	pop    %rbp
+  801fcc:	c3                   	ret
+
+0000000000801fcd <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801fcd:	55                   	push   %rbp
+  801fce:	48 89 e5             	mov    %rsp,%rbp
+  801fd1:	41 54                	push   %r12
+  801fd3:	53                   	push   %rbx
+  801fd4:	48 83 ec 10          	sub    $0x10,%rsp
+  801fd8:	41 89 fc             	mov    %edi,%r12d
+  801fdb:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fde:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801fe5:	00 00 00 
+  801fe8:	83 38 00             	cmpl   $0x0,(%rax)
+  801feb:	74 5e                	je     80204b <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801fed:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801ff3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801ff8:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801fff:	00 00 00 
+  802002:	44 89 e6             	mov    %r12d,%esi
+  802005:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80200c:	00 00 00 
+  80200f:	8b 38                	mov    (%rax),%edi
+  802011:	48 b8 3a 2c 80 00 00 	movabs $0x802c3a,%rax
+  802018:	00 00 00 
+  80201b:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  80201d:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802024:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802025:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80202a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80202e:	48 89 de             	mov    %rbx,%rsi
+  802031:	bf 00 00 00 00       	mov    $0x0,%edi
+  802036:	48 b8 a5 2b 80 00 00 	movabs $0x802ba5,%rax
+  80203d:	00 00 00 
+  802040:	ff d0                	call   *%rax
+}
+  802042:	48 83 c4 10          	add    $0x10,%rsp
+  802046:	5b                   	pop    %rbx
+  802047:	41 5c                	pop    %r12
+  802049:	5d                   	pop    %rbp
+  80204a:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80204b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802050:	48 b8 da 2c 80 00 00 	movabs $0x802cda,%rax
+  802057:	00 00 00 
+  80205a:	ff d0                	call   *%rax
+  80205c:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802063:	00 00 
+  802065:	eb 86                	jmp    801fed <fsipc+0x20>
+
+0000000000802067 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802067:	55                   	push   %rbp
+  802068:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80206b:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802072:	00 00 00 
+  802075:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802078:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80207a:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80207d:	be 00 00 00 00       	mov    $0x0,%esi
+  802082:	bf 02 00 00 00       	mov    $0x2,%edi
+  802087:	48 b8 cd 1f 80 00 00 	movabs $0x801fcd,%rax
+  80208e:	00 00 00 
+  802091:	ff d0                	call   *%rax
+}
+  802093:	5d                   	pop    %rbp
+  802094:	c3                   	ret
+
+0000000000802095 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802095:	55                   	push   %rbp
+  802096:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802099:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80209c:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8020a3:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8020a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8020aa:	bf 06 00 00 00       	mov    $0x6,%edi
+  8020af:	48 b8 cd 1f 80 00 00 	movabs $0x801fcd,%rax
+  8020b6:	00 00 00 
+  8020b9:	ff d0                	call   *%rax
+}
+  8020bb:	5d                   	pop    %rbp
+  8020bc:	c3                   	ret
+
+00000000008020bd <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8020bd:	55                   	push   %rbp
+  8020be:	48 89 e5             	mov    %rsp,%rbp
+  8020c1:	41 54                	push   %r12
+  8020c3:	53                   	push   %rbx
+  8020c4:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8020c7:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8020ca:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8020d1:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8020d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d8:	bf 05 00 00 00       	mov    $0x5,%edi
+  8020dd:	48 b8 cd 1f 80 00 00 	movabs $0x801fcd,%rax
+  8020e4:	00 00 00 
+  8020e7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020e9:	85 c0                	test   %eax,%eax
+  8020eb:	78 3d                	js     80212a <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8020ed:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8020f4:	00 00 00 
+  8020f7:	4c 89 e6             	mov    %r12,%rsi
+  8020fa:	48 89 df             	mov    %rbx,%rdi
+  8020fd:	48 b8 80 0d 80 00 00 	movabs $0x800d80,%rax
+  802104:	00 00 00 
+  802107:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802109:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802110:	00 
+  802111:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802117:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80211e:	00 
+  80211f:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802125:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80212a:	5b                   	pop    %rbx
+  80212b:	41 5c                	pop    %r12
+  80212d:	5d                   	pop    %rbp
+  80212e:	c3                   	ret
+
+000000000080212f <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80212f:	55                   	push   %rbp
+  802130:	48 89 e5             	mov    %rsp,%rbp
+  802133:	41 54                	push   %r12
+  802135:	53                   	push   %rbx
+  802136:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  802139:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80213e:	48 39 c2             	cmp    %rax,%rdx
+  802141:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802145:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802148:	48 89 c2             	mov    %rax,%rdx
+  80214b:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802152:	00 00 00 
+  802155:	48 b8 e1 0f 80 00 00 	movabs $0x800fe1,%rax
+  80215c:	00 00 00 
+  80215f:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802161:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802168:	00 00 00 
+  80216b:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802170:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802172:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  802176:	be 00 00 00 00       	mov    $0x0,%esi
+  80217b:	bf 04 00 00 00       	mov    $0x4,%edi
+  802180:	48 b8 cd 1f 80 00 00 	movabs $0x801fcd,%rax
+  802187:	00 00 00 
+  80218a:	ff d0                	call   *%rax
+  80218c:	48 98                	cltq
+}
+  80218e:	5b                   	pop    %rbx
+  80218f:	41 5c                	pop    %r12
+  802191:	5d                   	pop    %rbp
+  802192:	c3                   	ret
+
+0000000000802193 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802193:	55                   	push   %rbp
+  802194:	48 89 e5             	mov    %rsp,%rbp
+  802197:	41 54                	push   %r12
+  802199:	53                   	push   %rbx
+  80219a:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80219d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8021a4:	00 00 00 
+  8021a7:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8021aa:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8021ac:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021b1:	48 39 ca             	cmp    %rcx,%rdx
+  8021b4:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8021b8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8021bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021c6:	48 b8 cd 1f 80 00 00 	movabs $0x801fcd,%rax
+  8021cd:	00 00 00 
+  8021d0:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  8021d2:	85 c0                	test   %eax,%eax
+  8021d4:	78 27                	js     8021fd <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  8021d6:	48 63 d8             	movslq %eax,%rbx
+  8021d9:	48 89 da             	mov    %rbx,%rdx
+  8021dc:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8021e3:	00 00 00 
+  8021e6:	4c 89 e7             	mov    %r12,%rdi
+  8021e9:	48 b8 e1 0f 80 00 00 	movabs $0x800fe1,%rax
+  8021f0:	00 00 00 
+  8021f3:	ff d0                	call   *%rax
+    return bytes_read;
+  8021f5:	48 89 d8             	mov    %rbx,%rax
+}
+  8021f8:	5b                   	pop    %rbx
+  8021f9:	41 5c                	pop    %r12
+  8021fb:	5d                   	pop    %rbp
+  8021fc:	c3                   	ret
+        return bytes_read;
+  8021fd:	48 98                	cltq
+  8021ff:	eb f7                	jmp    8021f8 <devfile_read+0x65>
+
+0000000000802201 <open>:
+open(const char *path, int mode) {
+  802201:	55                   	push   %rbp
+  802202:	48 89 e5             	mov    %rsp,%rbp
+  802205:	41 55                	push   %r13
+  802207:	41 54                	push   %r12
+  802209:	53                   	push   %rbx
+  80220a:	48 83 ec 18          	sub    $0x18,%rsp
+  80220e:	49 89 fc             	mov    %rdi,%r12
+  802211:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802214:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  80221b:	00 00 00 
+  80221e:	ff d0                	call   *%rax
+  802220:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802226:	0f 87 8a 00 00 00    	ja     8022b6 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80222c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802230:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  802237:	00 00 00 
+  80223a:	ff d0                	call   *%rax
+  80223c:	89 c3                	mov    %eax,%ebx
+  80223e:	85 c0                	test   %eax,%eax
+  802240:	78 50                	js     802292 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802242:	4c 89 e6             	mov    %r12,%rsi
+  802245:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80224c:	00 00 00 
+  80224f:	48 89 df             	mov    %rbx,%rdi
+  802252:	48 b8 80 0d 80 00 00 	movabs $0x800d80,%rax
+  802259:	00 00 00 
+  80225c:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80225e:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802265:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802269:	bf 01 00 00 00       	mov    $0x1,%edi
+  80226e:	48 b8 cd 1f 80 00 00 	movabs $0x801fcd,%rax
+  802275:	00 00 00 
+  802278:	ff d0                	call   *%rax
+  80227a:	89 c3                	mov    %eax,%ebx
+  80227c:	85 c0                	test   %eax,%eax
+  80227e:	78 1f                	js     80229f <open+0x9e>
+    return fd2num(fd);
+  802280:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802284:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  80228b:	00 00 00 
+  80228e:	ff d0                	call   *%rax
+  802290:	89 c3                	mov    %eax,%ebx
+}
+  802292:	89 d8                	mov    %ebx,%eax
+  802294:	48 83 c4 18          	add    $0x18,%rsp
+  802298:	5b                   	pop    %rbx
+  802299:	41 5c                	pop    %r12
+  80229b:	41 5d                	pop    %r13
+  80229d:	5d                   	pop    %rbp
+  80229e:	c3                   	ret
+        fd_close(fd, 0);
+  80229f:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022a8:	48 b8 1b 1a 80 00 00 	movabs $0x801a1b,%rax
+  8022af:	00 00 00 
+  8022b2:	ff d0                	call   *%rax
+        return res;
+  8022b4:	eb dc                	jmp    802292 <open+0x91>
+        return -E_BAD_PATH;
+  8022b6:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8022bb:	eb d5                	jmp    802292 <open+0x91>
+
+00000000008022bd <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8022bd:	55                   	push   %rbp
+  8022be:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8022c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8022c6:	bf 08 00 00 00       	mov    $0x8,%edi
+  8022cb:	48 b8 cd 1f 80 00 00 	movabs $0x801fcd,%rax
+  8022d2:	00 00 00 
+  8022d5:	ff d0                	call   *%rax
+}
+  8022d7:	5d                   	pop    %rbp
+  8022d8:	c3                   	ret
+
+00000000008022d9 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8022d9:	55                   	push   %rbp
+  8022da:	48 89 e5             	mov    %rsp,%rbp
+  8022dd:	41 54                	push   %r12
+  8022df:	53                   	push   %rbx
+  8022e0:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8022e3:	48 b8 e4 18 80 00 00 	movabs $0x8018e4,%rax
+  8022ea:	00 00 00 
+  8022ed:	ff d0                	call   *%rax
+  8022ef:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8022f2:	48 be c0 33 80 00 00 	movabs $0x8033c0,%rsi
+  8022f9:	00 00 00 
+  8022fc:	48 89 df             	mov    %rbx,%rdi
+  8022ff:	48 b8 80 0d 80 00 00 	movabs $0x800d80,%rax
+  802306:	00 00 00 
+  802309:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80230b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802310:	41 2b 04 24          	sub    (%r12),%eax
+  802314:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80231a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802321:	00 00 00 
+    stat->st_dev = &devpipe;
+  802324:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80232b:	00 00 00 
+  80232e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80233a:	5b                   	pop    %rbx
+  80233b:	41 5c                	pop    %r12
+  80233d:	5d                   	pop    %rbp
+  80233e:	c3                   	ret
+
+000000000080233f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80233f:	55                   	push   %rbp
+  802340:	48 89 e5             	mov    %rsp,%rbp
+  802343:	41 54                	push   %r12
+  802345:	53                   	push   %rbx
+  802346:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802349:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80234e:	48 89 fe             	mov    %rdi,%rsi
+  802351:	bf 00 00 00 00       	mov    $0x0,%edi
+  802356:	49 bc fc 13 80 00 00 	movabs $0x8013fc,%r12
+  80235d:	00 00 00 
+  802360:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802363:	48 89 df             	mov    %rbx,%rdi
+  802366:	48 b8 e4 18 80 00 00 	movabs $0x8018e4,%rax
+  80236d:	00 00 00 
+  802370:	ff d0                	call   *%rax
+  802372:	48 89 c6             	mov    %rax,%rsi
+  802375:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80237a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80237f:	41 ff d4             	call   *%r12
+}
+  802382:	5b                   	pop    %rbx
+  802383:	41 5c                	pop    %r12
+  802385:	5d                   	pop    %rbp
+  802386:	c3                   	ret
+
+0000000000802387 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802387:	55                   	push   %rbp
+  802388:	48 89 e5             	mov    %rsp,%rbp
+  80238b:	41 57                	push   %r15
+  80238d:	41 56                	push   %r14
+  80238f:	41 55                	push   %r13
+  802391:	41 54                	push   %r12
+  802393:	53                   	push   %rbx
+  802394:	48 83 ec 18          	sub    $0x18,%rsp
+  802398:	49 89 fc             	mov    %rdi,%r12
+  80239b:	49 89 f5             	mov    %rsi,%r13
+  80239e:	49 89 d7             	mov    %rdx,%r15
+  8023a1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8023a5:	48 b8 e4 18 80 00 00 	movabs $0x8018e4,%rax
+  8023ac:	00 00 00 
+  8023af:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8023b1:	4d 85 ff             	test   %r15,%r15
+  8023b4:	0f 84 af 00 00 00    	je     802469 <devpipe_write+0xe2>
+  8023ba:	48 89 c3             	mov    %rax,%rbx
+  8023bd:	4c 89 f8             	mov    %r15,%rax
+  8023c0:	4d 89 ef             	mov    %r13,%r15
+  8023c3:	4c 01 e8             	add    %r13,%rax
+  8023c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8023ca:	49 bd 04 13 80 00 00 	movabs $0x801304,%r13
+  8023d1:	00 00 00 
+            sys_yield();
+  8023d4:	49 be a1 12 80 00 00 	movabs $0x8012a1,%r14
+  8023db:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8023de:	8b 73 04             	mov    0x4(%rbx),%esi
+  8023e1:	48 63 ce             	movslq %esi,%rcx
+  8023e4:	48 63 03             	movslq (%rbx),%rax
+  8023e7:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8023ed:	48 39 c1             	cmp    %rax,%rcx
+  8023f0:	72 2e                	jb     802420 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8023f2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8023f7:	48 89 da             	mov    %rbx,%rdx
+  8023fa:	be 00 10 00 00       	mov    $0x1000,%esi
+  8023ff:	4c 89 e7             	mov    %r12,%rdi
+  802402:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802405:	85 c0                	test   %eax,%eax
+  802407:	74 66                	je     80246f <devpipe_write+0xe8>
+            sys_yield();
+  802409:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80240c:	8b 73 04             	mov    0x4(%rbx),%esi
+  80240f:	48 63 ce             	movslq %esi,%rcx
+  802412:	48 63 03             	movslq (%rbx),%rax
+  802415:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80241b:	48 39 c1             	cmp    %rax,%rcx
+  80241e:	73 d2                	jae    8023f2 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802420:	41 0f b6 3f          	movzbl (%r15),%edi
+  802424:	48 89 ca             	mov    %rcx,%rdx
+  802427:	48 c1 ea 03          	shr    $0x3,%rdx
+  80242b:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802432:	08 10 20 
+  802435:	48 f7 e2             	mul    %rdx
+  802438:	48 c1 ea 06          	shr    $0x6,%rdx
+  80243c:	48 89 d0             	mov    %rdx,%rax
+  80243f:	48 c1 e0 09          	shl    $0x9,%rax
+  802443:	48 29 d0             	sub    %rdx,%rax
+  802446:	48 c1 e0 03          	shl    $0x3,%rax
+  80244a:	48 29 c1             	sub    %rax,%rcx
+  80244d:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802452:	83 c6 01             	add    $0x1,%esi
+  802455:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802458:	49 83 c7 01          	add    $0x1,%r15
+  80245c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802460:	49 39 c7             	cmp    %rax,%r15
+  802463:	0f 85 75 ff ff ff    	jne    8023de <devpipe_write+0x57>
+    return n;
+  802469:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80246d:	eb 05                	jmp    802474 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80246f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802474:	48 83 c4 18          	add    $0x18,%rsp
+  802478:	5b                   	pop    %rbx
+  802479:	41 5c                	pop    %r12
+  80247b:	41 5d                	pop    %r13
+  80247d:	41 5e                	pop    %r14
+  80247f:	41 5f                	pop    %r15
+  802481:	5d                   	pop    %rbp
+  802482:	c3                   	ret
+
+0000000000802483 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802483:	55                   	push   %rbp
+  802484:	48 89 e5             	mov    %rsp,%rbp
+  802487:	41 57                	push   %r15
+  802489:	41 56                	push   %r14
+  80248b:	41 55                	push   %r13
+  80248d:	41 54                	push   %r12
+  80248f:	53                   	push   %rbx
+  802490:	48 83 ec 18          	sub    $0x18,%rsp
+  802494:	49 89 fc             	mov    %rdi,%r12
+  802497:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80249b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80249f:	48 b8 e4 18 80 00 00 	movabs $0x8018e4,%rax
+  8024a6:	00 00 00 
+  8024a9:	ff d0                	call   *%rax
+  8024ab:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8024ae:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8024b4:	49 bd 04 13 80 00 00 	movabs $0x801304,%r13
+  8024bb:	00 00 00 
+            sys_yield();
+  8024be:	49 be a1 12 80 00 00 	movabs $0x8012a1,%r14
+  8024c5:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8024c8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8024cd:	74 7d                	je     80254c <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8024cf:	8b 03                	mov    (%rbx),%eax
+  8024d1:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8024d4:	75 26                	jne    8024fc <devpipe_read+0x79>
+            if (i > 0) return i;
+  8024d6:	4d 85 ff             	test   %r15,%r15
+  8024d9:	75 77                	jne    802552 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8024db:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024e0:	48 89 da             	mov    %rbx,%rdx
+  8024e3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8024e8:	4c 89 e7             	mov    %r12,%rdi
+  8024eb:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8024ee:	85 c0                	test   %eax,%eax
+  8024f0:	74 72                	je     802564 <devpipe_read+0xe1>
+            sys_yield();
+  8024f2:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8024f5:	8b 03                	mov    (%rbx),%eax
+  8024f7:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8024fa:	74 df                	je     8024db <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8024fc:	48 63 c8             	movslq %eax,%rcx
+  8024ff:	48 89 ca             	mov    %rcx,%rdx
+  802502:	48 c1 ea 03          	shr    $0x3,%rdx
+  802506:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80250d:	08 10 20 
+  802510:	48 89 d0             	mov    %rdx,%rax
+  802513:	48 f7 e6             	mul    %rsi
+  802516:	48 c1 ea 06          	shr    $0x6,%rdx
+  80251a:	48 89 d0             	mov    %rdx,%rax
+  80251d:	48 c1 e0 09          	shl    $0x9,%rax
+  802521:	48 29 d0             	sub    %rdx,%rax
+  802524:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80252b:	00 
+  80252c:	48 89 c8             	mov    %rcx,%rax
+  80252f:	48 29 d0             	sub    %rdx,%rax
+  802532:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802537:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80253b:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80253f:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802542:	49 83 c7 01          	add    $0x1,%r15
+  802546:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80254a:	75 83                	jne    8024cf <devpipe_read+0x4c>
+    return n;
+  80254c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802550:	eb 03                	jmp    802555 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802552:	4c 89 f8             	mov    %r15,%rax
+}
+  802555:	48 83 c4 18          	add    $0x18,%rsp
+  802559:	5b                   	pop    %rbx
+  80255a:	41 5c                	pop    %r12
+  80255c:	41 5d                	pop    %r13
+  80255e:	41 5e                	pop    %r14
+  802560:	41 5f                	pop    %r15
+  802562:	5d                   	pop    %rbp
+  802563:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802564:	b8 00 00 00 00       	mov    $0x0,%eax
+  802569:	eb ea                	jmp    802555 <devpipe_read+0xd2>
+
+000000000080256b <pipe>:
+pipe(int pfd[2]) {
+  80256b:	55                   	push   %rbp
+  80256c:	48 89 e5             	mov    %rsp,%rbp
+  80256f:	41 55                	push   %r13
+  802571:	41 54                	push   %r12
+  802573:	53                   	push   %rbx
+  802574:	48 83 ec 18          	sub    $0x18,%rsp
+  802578:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80257b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80257f:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  802586:	00 00 00 
+  802589:	ff d0                	call   *%rax
+  80258b:	89 c3                	mov    %eax,%ebx
+  80258d:	85 c0                	test   %eax,%eax
+  80258f:	0f 88 a0 01 00 00    	js     802735 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802595:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80259a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80259f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8025a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025a8:	48 b8 30 13 80 00 00 	movabs $0x801330,%rax
+  8025af:	00 00 00 
+  8025b2:	ff d0                	call   *%rax
+  8025b4:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8025b6:	85 c0                	test   %eax,%eax
+  8025b8:	0f 88 77 01 00 00    	js     802735 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8025be:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8025c2:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  8025c9:	00 00 00 
+  8025cc:	ff d0                	call   *%rax
+  8025ce:	89 c3                	mov    %eax,%ebx
+  8025d0:	85 c0                	test   %eax,%eax
+  8025d2:	0f 88 43 01 00 00    	js     80271b <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8025d8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8025dd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025e2:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8025e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025eb:	48 b8 30 13 80 00 00 	movabs $0x801330,%rax
+  8025f2:	00 00 00 
+  8025f5:	ff d0                	call   *%rax
+  8025f7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8025f9:	85 c0                	test   %eax,%eax
+  8025fb:	0f 88 1a 01 00 00    	js     80271b <pipe+0x1b0>
+    va = fd2data(fd0);
+  802601:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802605:	48 b8 e4 18 80 00 00 	movabs $0x8018e4,%rax
+  80260c:	00 00 00 
+  80260f:	ff d0                	call   *%rax
+  802611:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802614:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802619:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80261e:	48 89 c6             	mov    %rax,%rsi
+  802621:	bf 00 00 00 00       	mov    $0x0,%edi
+  802626:	48 b8 30 13 80 00 00 	movabs $0x801330,%rax
+  80262d:	00 00 00 
+  802630:	ff d0                	call   *%rax
+  802632:	89 c3                	mov    %eax,%ebx
+  802634:	85 c0                	test   %eax,%eax
+  802636:	0f 88 c5 00 00 00    	js     802701 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80263c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802640:	48 b8 e4 18 80 00 00 	movabs $0x8018e4,%rax
+  802647:	00 00 00 
+  80264a:	ff d0                	call   *%rax
+  80264c:	48 89 c1             	mov    %rax,%rcx
+  80264f:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802655:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80265b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802660:	4c 89 ee             	mov    %r13,%rsi
+  802663:	bf 00 00 00 00       	mov    $0x0,%edi
+  802668:	48 b8 97 13 80 00 00 	movabs $0x801397,%rax
+  80266f:	00 00 00 
+  802672:	ff d0                	call   *%rax
+  802674:	89 c3                	mov    %eax,%ebx
+  802676:	85 c0                	test   %eax,%eax
+  802678:	78 6e                	js     8026e8 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80267a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80267f:	4c 89 ef             	mov    %r13,%rdi
+  802682:	48 b8 d2 12 80 00 00 	movabs $0x8012d2,%rax
+  802689:	00 00 00 
+  80268c:	ff d0                	call   *%rax
+  80268e:	83 f8 02             	cmp    $0x2,%eax
+  802691:	0f 85 ab 00 00 00    	jne    802742 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802697:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80269e:	00 00 
+  8026a0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8026a4:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8026a6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8026aa:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8026b1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8026b5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8026b7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026bb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8026c2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8026c6:	48 bb d2 18 80 00 00 	movabs $0x8018d2,%rbx
+  8026cd:	00 00 00 
+  8026d0:	ff d3                	call   *%rbx
+  8026d2:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8026d6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8026da:	ff d3                	call   *%rbx
+  8026dc:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8026e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026e6:	eb 4d                	jmp    802735 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8026e8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026ed:	4c 89 ee             	mov    %r13,%rsi
+  8026f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026f5:	48 b8 fc 13 80 00 00 	movabs $0x8013fc,%rax
+  8026fc:	00 00 00 
+  8026ff:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802701:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802706:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80270a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80270f:	48 b8 fc 13 80 00 00 	movabs $0x8013fc,%rax
+  802716:	00 00 00 
+  802719:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80271b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802720:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802724:	bf 00 00 00 00       	mov    $0x0,%edi
+  802729:	48 b8 fc 13 80 00 00 	movabs $0x8013fc,%rax
+  802730:	00 00 00 
+  802733:	ff d0                	call   *%rax
+}
+  802735:	89 d8                	mov    %ebx,%eax
+  802737:	48 83 c4 18          	add    $0x18,%rsp
+  80273b:	5b                   	pop    %rbx
+  80273c:	41 5c                	pop    %r12
+  80273e:	41 5d                	pop    %r13
+  802740:	5d                   	pop    %rbp
+  802741:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802742:	48 b9 f0 33 80 00 00 	movabs $0x8033f0,%rcx
+  802749:	00 00 00 
+  80274c:	48 ba c7 33 80 00 00 	movabs $0x8033c7,%rdx
+  802753:	00 00 00 
+  802756:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80275b:	48 bf dc 33 80 00 00 	movabs $0x8033dc,%rdi
+  802762:	00 00 00 
+  802765:	b8 00 00 00 00       	mov    $0x0,%eax
+  80276a:	49 b8 0b 03 80 00 00 	movabs $0x80030b,%r8
+  802771:	00 00 00 
+  802774:	41 ff d0             	call   *%r8
+
+0000000000802777 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802777:	55                   	push   %rbp
+  802778:	48 89 e5             	mov    %rsp,%rbp
+  80277b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80277f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802783:	48 b8 60 19 80 00 00 	movabs $0x801960,%rax
+  80278a:	00 00 00 
+  80278d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80278f:	85 c0                	test   %eax,%eax
+  802791:	78 35                	js     8027c8 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802793:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802797:	48 b8 e4 18 80 00 00 	movabs $0x8018e4,%rax
+  80279e:	00 00 00 
+  8027a1:	ff d0                	call   *%rax
+  8027a3:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8027a6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8027ab:	be 00 10 00 00       	mov    $0x1000,%esi
+  8027b0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8027b4:	48 b8 04 13 80 00 00 	movabs $0x801304,%rax
+  8027bb:	00 00 00 
+  8027be:	ff d0                	call   *%rax
+  8027c0:	85 c0                	test   %eax,%eax
+  8027c2:	0f 94 c0             	sete   %al
+  8027c5:	0f b6 c0             	movzbl %al,%eax
+}
+  8027c8:	c9                   	leave
+  8027c9:	c3                   	ret
+
+00000000008027ca <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8027ca:	48 89 f8             	mov    %rdi,%rax
+  8027cd:	48 c1 e8 27          	shr    $0x27,%rax
+  8027d1:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8027d8:	01 00 00 
+  8027db:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8027df:	f6 c2 01             	test   $0x1,%dl
+  8027e2:	74 6d                	je     802851 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8027e4:	48 89 f8             	mov    %rdi,%rax
+  8027e7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8027eb:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8027f2:	01 00 00 
+  8027f5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8027f9:	f6 c2 01             	test   $0x1,%dl
+  8027fc:	74 62                	je     802860 <get_uvpt_entry+0x96>
+  8027fe:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802805:	01 00 00 
+  802808:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80280c:	f6 c2 80             	test   $0x80,%dl
+  80280f:	75 4f                	jne    802860 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802811:	48 89 f8             	mov    %rdi,%rax
+  802814:	48 c1 e8 15          	shr    $0x15,%rax
+  802818:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80281f:	01 00 00 
+  802822:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802826:	f6 c2 01             	test   $0x1,%dl
+  802829:	74 44                	je     80286f <get_uvpt_entry+0xa5>
+  80282b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802832:	01 00 00 
+  802835:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802839:	f6 c2 80             	test   $0x80,%dl
+  80283c:	75 31                	jne    80286f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80283e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802842:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802849:	01 00 00 
+  80284c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802850:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802851:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802858:	01 00 00 
+  80285b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80285f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802860:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802867:	01 00 00 
+  80286a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80286e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80286f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802876:	01 00 00 
+  802879:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80287d:	c3                   	ret
+
+000000000080287e <get_prot>:
+
+int
+get_prot(void *va) {
+  80287e:	55                   	push   %rbp
+  80287f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802882:	48 b8 ca 27 80 00 00 	movabs $0x8027ca,%rax
+  802889:	00 00 00 
+  80288c:	ff d0                	call   *%rax
+  80288e:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802891:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802896:	89 c1                	mov    %eax,%ecx
+  802898:	83 c9 04             	or     $0x4,%ecx
+  80289b:	f6 c2 01             	test   $0x1,%dl
+  80289e:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8028a1:	89 c1                	mov    %eax,%ecx
+  8028a3:	83 c9 02             	or     $0x2,%ecx
+  8028a6:	f6 c2 02             	test   $0x2,%dl
+  8028a9:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8028ac:	89 c1                	mov    %eax,%ecx
+  8028ae:	83 c9 01             	or     $0x1,%ecx
+  8028b1:	48 85 d2             	test   %rdx,%rdx
+  8028b4:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8028b7:	89 c1                	mov    %eax,%ecx
+  8028b9:	83 c9 40             	or     $0x40,%ecx
+  8028bc:	f6 c6 04             	test   $0x4,%dh
+  8028bf:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8028c2:	5d                   	pop    %rbp
+  8028c3:	c3                   	ret
+
+00000000008028c4 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8028c4:	55                   	push   %rbp
+  8028c5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8028c8:	48 b8 ca 27 80 00 00 	movabs $0x8027ca,%rax
+  8028cf:	00 00 00 
+  8028d2:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8028d4:	48 c1 e8 06          	shr    $0x6,%rax
+  8028d8:	83 e0 01             	and    $0x1,%eax
+}
+  8028db:	5d                   	pop    %rbp
+  8028dc:	c3                   	ret
+
+00000000008028dd <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8028dd:	55                   	push   %rbp
+  8028de:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8028e1:	48 b8 ca 27 80 00 00 	movabs $0x8027ca,%rax
+  8028e8:	00 00 00 
+  8028eb:	ff d0                	call   *%rax
+  8028ed:	83 e0 01             	and    $0x1,%eax
+}
+  8028f0:	5d                   	pop    %rbp
+  8028f1:	c3                   	ret
+
+00000000008028f2 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8028f2:	55                   	push   %rbp
+  8028f3:	48 89 e5             	mov    %rsp,%rbp
+  8028f6:	41 57                	push   %r15
+  8028f8:	41 56                	push   %r14
+  8028fa:	41 55                	push   %r13
+  8028fc:	41 54                	push   %r12
+  8028fe:	53                   	push   %rbx
+  8028ff:	48 83 ec 18          	sub    $0x18,%rsp
+  802903:	49 89 ff             	mov    %rdi,%r15
+  802906:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80290a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  80290f:	49 bc dd 28 80 00 00 	movabs $0x8028dd,%r12
+  802916:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802919:	49 be 7e 28 80 00 00 	movabs $0x80287e,%r14
+  802920:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802923:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  80292a:	00 00 00 
+  80292d:	eb 0c                	jmp    80293b <foreach_shared_region+0x49>
+  80292f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802936:	4c 39 eb             	cmp    %r13,%rbx
+  802939:	74 38                	je     802973 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  80293b:	48 89 df             	mov    %rbx,%rdi
+  80293e:	41 ff d4             	call   *%r12
+  802941:	84 c0                	test   %al,%al
+  802943:	74 ea                	je     80292f <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802945:	48 89 df             	mov    %rbx,%rdi
+  802948:	41 ff d6             	call   *%r14
+  80294b:	a8 40                	test   $0x40,%al
+  80294d:	74 e0                	je     80292f <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  80294f:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802956:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80295a:	48 89 df             	mov    %rbx,%rdi
+  80295d:	41 ff d7             	call   *%r15
+        if (err)
+  802960:	85 c0                	test   %eax,%eax
+  802962:	74 cb                	je     80292f <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802964:	48 83 c4 18          	add    $0x18,%rsp
+  802968:	5b                   	pop    %rbx
+  802969:	41 5c                	pop    %r12
+  80296b:	41 5d                	pop    %r13
+  80296d:	41 5e                	pop    %r14
+  80296f:	41 5f                	pop    %r15
+  802971:	5d                   	pop    %rbp
+  802972:	c3                   	ret
+    return 0;
+  802973:	b8 00 00 00 00       	mov    $0x0,%eax
+  802978:	eb ea                	jmp    802964 <foreach_shared_region+0x72>
+
+000000000080297a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80297a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80297f:	c3                   	ret
+
+0000000000802980 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802980:	55                   	push   %rbp
+  802981:	48 89 e5             	mov    %rsp,%rbp
+  802984:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802987:	48 be 14 34 80 00 00 	movabs $0x803414,%rsi
+  80298e:	00 00 00 
+  802991:	48 b8 80 0d 80 00 00 	movabs $0x800d80,%rax
+  802998:	00 00 00 
+  80299b:	ff d0                	call   *%rax
+    return 0;
+}
+  80299d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a2:	5d                   	pop    %rbp
+  8029a3:	c3                   	ret
+
+00000000008029a4 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8029a4:	55                   	push   %rbp
+  8029a5:	48 89 e5             	mov    %rsp,%rbp
+  8029a8:	41 57                	push   %r15
+  8029aa:	41 56                	push   %r14
+  8029ac:	41 55                	push   %r13
+  8029ae:	41 54                	push   %r12
+  8029b0:	53                   	push   %rbx
+  8029b1:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8029b8:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8029bf:	48 85 d2             	test   %rdx,%rdx
+  8029c2:	74 7a                	je     802a3e <devcons_write+0x9a>
+  8029c4:	49 89 d6             	mov    %rdx,%r14
+  8029c7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8029cd:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8029d2:	49 bf 7a 0f 80 00 00 	movabs $0x800f7a,%r15
+  8029d9:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8029dc:	4c 89 f3             	mov    %r14,%rbx
+  8029df:	48 29 f3             	sub    %rsi,%rbx
+  8029e2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8029e7:	48 39 c3             	cmp    %rax,%rbx
+  8029ea:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8029ee:	4c 63 eb             	movslq %ebx,%r13
+  8029f1:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8029f8:	48 01 c6             	add    %rax,%rsi
+  8029fb:	4c 89 ea             	mov    %r13,%rdx
+  8029fe:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a05:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a08:	4c 89 ee             	mov    %r13,%rsi
+  802a0b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a12:	48 b8 a7 11 80 00 00 	movabs $0x8011a7,%rax
+  802a19:	00 00 00 
+  802a1c:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a1e:	41 01 dc             	add    %ebx,%r12d
+  802a21:	49 63 f4             	movslq %r12d,%rsi
+  802a24:	4c 39 f6             	cmp    %r14,%rsi
+  802a27:	72 b3                	jb     8029dc <devcons_write+0x38>
+    return res;
+  802a29:	49 63 c4             	movslq %r12d,%rax
+}
+  802a2c:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802a33:	5b                   	pop    %rbx
+  802a34:	41 5c                	pop    %r12
+  802a36:	41 5d                	pop    %r13
+  802a38:	41 5e                	pop    %r14
+  802a3a:	41 5f                	pop    %r15
+  802a3c:	5d                   	pop    %rbp
+  802a3d:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802a3e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a44:	eb e3                	jmp    802a29 <devcons_write+0x85>
+
+0000000000802a46 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a46:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802a49:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a4e:	48 85 c0             	test   %rax,%rax
+  802a51:	74 55                	je     802aa8 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a53:	55                   	push   %rbp
+  802a54:	48 89 e5             	mov    %rsp,%rbp
+  802a57:	41 55                	push   %r13
+  802a59:	41 54                	push   %r12
+  802a5b:	53                   	push   %rbx
+  802a5c:	48 83 ec 08          	sub    $0x8,%rsp
+  802a60:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802a63:	48 bb d4 11 80 00 00 	movabs $0x8011d4,%rbx
+  802a6a:	00 00 00 
+  802a6d:	49 bc a1 12 80 00 00 	movabs $0x8012a1,%r12
+  802a74:	00 00 00 
+  802a77:	eb 03                	jmp    802a7c <devcons_read+0x36>
+  802a79:	41 ff d4             	call   *%r12
+  802a7c:	ff d3                	call   *%rbx
+  802a7e:	85 c0                	test   %eax,%eax
+  802a80:	74 f7                	je     802a79 <devcons_read+0x33>
+    if (c < 0) return c;
+  802a82:	48 63 d0             	movslq %eax,%rdx
+  802a85:	78 13                	js     802a9a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802a87:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a8c:	83 f8 04             	cmp    $0x4,%eax
+  802a8f:	74 09                	je     802a9a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802a91:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802a95:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802a9a:	48 89 d0             	mov    %rdx,%rax
+  802a9d:	48 83 c4 08          	add    $0x8,%rsp
+  802aa1:	5b                   	pop    %rbx
+  802aa2:	41 5c                	pop    %r12
+  802aa4:	41 5d                	pop    %r13
+  802aa6:	5d                   	pop    %rbp
+  802aa7:	c3                   	ret
+  802aa8:	48 89 d0             	mov    %rdx,%rax
+  802aab:	c3                   	ret
+
+0000000000802aac <cputchar>:
+cputchar(int ch) {
+  802aac:	55                   	push   %rbp
+  802aad:	48 89 e5             	mov    %rsp,%rbp
+  802ab0:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802ab4:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802ab8:	be 01 00 00 00       	mov    $0x1,%esi
+  802abd:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802ac1:	48 b8 a7 11 80 00 00 	movabs $0x8011a7,%rax
+  802ac8:	00 00 00 
+  802acb:	ff d0                	call   *%rax
+}
+  802acd:	c9                   	leave
+  802ace:	c3                   	ret
+
+0000000000802acf <getchar>:
+getchar(void) {
+  802acf:	55                   	push   %rbp
+  802ad0:	48 89 e5             	mov    %rsp,%rbp
+  802ad3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802ad7:	ba 01 00 00 00       	mov    $0x1,%edx
+  802adc:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802ae0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ae5:	48 b8 43 1c 80 00 00 	movabs $0x801c43,%rax
+  802aec:	00 00 00 
+  802aef:	ff d0                	call   *%rax
+  802af1:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802af3:	85 c0                	test   %eax,%eax
+  802af5:	78 06                	js     802afd <getchar+0x2e>
+  802af7:	74 08                	je     802b01 <getchar+0x32>
+  802af9:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802afd:	89 d0                	mov    %edx,%eax
+  802aff:	c9                   	leave
+  802b00:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b01:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b06:	eb f5                	jmp    802afd <getchar+0x2e>
+
+0000000000802b08 <iscons>:
+iscons(int fdnum) {
+  802b08:	55                   	push   %rbp
+  802b09:	48 89 e5             	mov    %rsp,%rbp
+  802b0c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b10:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b14:	48 b8 60 19 80 00 00 	movabs $0x801960,%rax
+  802b1b:	00 00 00 
+  802b1e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b20:	85 c0                	test   %eax,%eax
+  802b22:	78 18                	js     802b3c <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802b24:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b28:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802b2f:	00 00 00 
+  802b32:	8b 00                	mov    (%rax),%eax
+  802b34:	39 02                	cmp    %eax,(%rdx)
+  802b36:	0f 94 c0             	sete   %al
+  802b39:	0f b6 c0             	movzbl %al,%eax
+}
+  802b3c:	c9                   	leave
+  802b3d:	c3                   	ret
+
+0000000000802b3e <opencons>:
+opencons(void) {
+  802b3e:	55                   	push   %rbp
+  802b3f:	48 89 e5             	mov    %rsp,%rbp
+  802b42:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b46:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802b4a:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  802b51:	00 00 00 
+  802b54:	ff d0                	call   *%rax
+  802b56:	85 c0                	test   %eax,%eax
+  802b58:	78 49                	js     802ba3 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802b5a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b5f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b64:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802b68:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b6d:	48 b8 30 13 80 00 00 	movabs $0x801330,%rax
+  802b74:	00 00 00 
+  802b77:	ff d0                	call   *%rax
+  802b79:	85 c0                	test   %eax,%eax
+  802b7b:	78 26                	js     802ba3 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802b7d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b81:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802b88:	00 00 
+  802b8a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802b8c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802b90:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802b97:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  802b9e:	00 00 00 
+  802ba1:	ff d0                	call   *%rax
+}
+  802ba3:	c9                   	leave
+  802ba4:	c3                   	ret
+
+0000000000802ba5 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802ba5:	55                   	push   %rbp
+  802ba6:	48 89 e5             	mov    %rsp,%rbp
+  802ba9:	41 54                	push   %r12
+  802bab:	53                   	push   %rbx
+  802bac:	48 89 fb             	mov    %rdi,%rbx
+  802baf:	48 89 f7             	mov    %rsi,%rdi
+  802bb2:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802bb5:	48 85 f6             	test   %rsi,%rsi
+  802bb8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bbf:	00 00 00 
+  802bc2:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802bc6:	be 00 10 00 00       	mov    $0x1000,%esi
+  802bcb:	48 b8 9a 16 80 00 00 	movabs $0x80169a,%rax
+  802bd2:	00 00 00 
+  802bd5:	ff d0                	call   *%rax
+    if (res < 0) {
+  802bd7:	85 c0                	test   %eax,%eax
+  802bd9:	78 45                	js     802c20 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802bdb:	48 85 db             	test   %rbx,%rbx
+  802bde:	74 12                	je     802bf2 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802be0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802be7:	00 00 00 
+  802bea:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802bf0:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802bf2:	4d 85 e4             	test   %r12,%r12
+  802bf5:	74 14                	je     802c0b <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802bf7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802bfe:	00 00 00 
+  802c01:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802c07:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802c0b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802c12:	00 00 00 
+  802c15:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802c1b:	5b                   	pop    %rbx
+  802c1c:	41 5c                	pop    %r12
+  802c1e:	5d                   	pop    %rbp
+  802c1f:	c3                   	ret
+        if (from_env_store)
+  802c20:	48 85 db             	test   %rbx,%rbx
+  802c23:	74 06                	je     802c2b <ipc_recv+0x86>
+            *from_env_store = 0;
+  802c25:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802c2b:	4d 85 e4             	test   %r12,%r12
+  802c2e:	74 eb                	je     802c1b <ipc_recv+0x76>
+            *perm_store = 0;
+  802c30:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802c37:	00 
+  802c38:	eb e1                	jmp    802c1b <ipc_recv+0x76>
+
+0000000000802c3a <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802c3a:	55                   	push   %rbp
+  802c3b:	48 89 e5             	mov    %rsp,%rbp
+  802c3e:	41 57                	push   %r15
+  802c40:	41 56                	push   %r14
+  802c42:	41 55                	push   %r13
+  802c44:	41 54                	push   %r12
+  802c46:	53                   	push   %rbx
+  802c47:	48 83 ec 18          	sub    $0x18,%rsp
+  802c4b:	41 89 fd             	mov    %edi,%r13d
+  802c4e:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802c51:	48 89 d3             	mov    %rdx,%rbx
+  802c54:	49 89 cc             	mov    %rcx,%r12
+  802c57:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802c5b:	48 85 d2             	test   %rdx,%rdx
+  802c5e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802c65:	00 00 00 
+  802c68:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802c6c:	49 be 6e 16 80 00 00 	movabs $0x80166e,%r14
+  802c73:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802c76:	49 bf a1 12 80 00 00 	movabs $0x8012a1,%r15
+  802c7d:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802c80:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802c83:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802c87:	4c 89 e1             	mov    %r12,%rcx
+  802c8a:	48 89 da             	mov    %rbx,%rdx
+  802c8d:	44 89 ef             	mov    %r13d,%edi
+  802c90:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802c93:	85 c0                	test   %eax,%eax
+  802c95:	74 34                	je     802ccb <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802c97:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802c9a:	75 05                	jne    802ca1 <ipc_send+0x67>
+        sys_yield();
+  802c9c:	41 ff d7             	call   *%r15
+    while (true) {
+  802c9f:	eb df                	jmp    802c80 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802ca1:	48 ba 20 34 80 00 00 	movabs $0x803420,%rdx
+  802ca8:	00 00 00 
+  802cab:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802cb0:	48 bf 39 34 80 00 00 	movabs $0x803439,%rdi
+  802cb7:	00 00 00 
+  802cba:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbf:	48 b9 0b 03 80 00 00 	movabs $0x80030b,%rcx
+  802cc6:	00 00 00 
+  802cc9:	ff d1                	call   *%rcx
+    }
+}
+  802ccb:	48 83 c4 18          	add    $0x18,%rsp
+  802ccf:	5b                   	pop    %rbx
+  802cd0:	41 5c                	pop    %r12
+  802cd2:	41 5d                	pop    %r13
+  802cd4:	41 5e                	pop    %r14
+  802cd6:	41 5f                	pop    %r15
+  802cd8:	5d                   	pop    %rbp
+  802cd9:	c3                   	ret
+
+0000000000802cda <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802cda:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802cdf:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802ce6:	00 00 00 
+  802ce9:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802cf0:	48 01 ca             	add    %rcx,%rdx
+  802cf3:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802cf9:	39 fa                	cmp    %edi,%edx
+  802cfb:	74 12                	je     802d0f <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802cfd:	48 83 c0 01          	add    $0x1,%rax
+  802d01:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802d07:	75 e0                	jne    802ce9 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802d09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d0e:	c3                   	ret
+            return envs[i].env_id;
+  802d0f:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802d16:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802d1d:	00 00 00 
+  802d20:	48 01 d0             	add    %rdx,%rax
+  802d23:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802d29:	c3                   	ret
+  802d2a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802d30 <__rodata_start>:
+  802d30:	73 79                	jae    802dab <__rodata_start+0x7b>
+  802d32:	73 5f                	jae    802d93 <__rodata_start+0x63>
+  802d34:	61                   	(bad)
+  802d35:	6c                   	insb   (%dx),%es:(%rdi)
+  802d36:	6c                   	insb   (%dx),%es:(%rdi)
+  802d37:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d38:	63 5f 72             	movsxd 0x72(%rdi),%ebx
+  802d3b:	65 67 69 6f 6e 3a 20 	imul   $0x6925203a,%gs:0x6e(%edi),%ebp
+  802d42:	25 69 
+  802d44:	00 75 73             	add    %dh,0x73(%rbp)
+  802d47:	65 72 2f             	gs jb  802d79 <__rodata_start+0x49>
+  802d4a:	63 6f 6c             	movsxd 0x6c(%rdi),%ebp
+  802d4d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d4e:	72 62                	jb     802db2 <__rodata_start+0x82>
+  802d50:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d52:	63 68 2e             	movsxd 0x2e(%rax),%ebp
+  802d55:	63 00                	movsxd (%rax),%eax
+  802d57:	70 61                	jo     802dba <__rodata_start+0x8a>
+  802d59:	67 65 73 20          	addr32 gs jae 802d7d <__rodata_start+0x4d>
+  802d5d:	20 63 79             	and    %ah,0x79(%rbx)
+  802d60:	63 6c 65 73          	movsxd 0x73(%rbp,%riz,2),%ebp
+  802d64:	2f                   	(bad)
+  802d65:	61                   	(bad)
+  802d66:	63 63 65             	movsxd 0x65(%rbx),%esp
+  802d69:	73 73                	jae    802dde <__rodata_start+0xae>
+  802d6b:	0a 00                	or     (%rax),%al
+  802d6d:	25 35 7a 75 20       	and    $0x20757a35,%eax
+  802d72:	20 25 6c 75 0a 00    	and    %ah,0xa756c(%rip)        # 8aa2e4 <__bss_end+0xa22e4>
+  802d78:	3c 75                	cmp    $0x75,%al
+  802d7a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d7b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802d7f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d80:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802d84:	1f                   	(bad)
+  802d85:	44 00 00             	add    %r8b,(%rax)
+  802d88:	5b                   	pop    %rbx
+  802d89:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d8e:	20 75 73             	and    %dh,0x73(%rbp)
+  802d91:	65 72 20             	gs jb  802db4 <__rodata_start+0x84>
+  802d94:	70 61                	jo     802df7 <__rodata_start+0xc7>
+  802d96:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d97:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  802d9e:	73 20                	jae    802dc0 <__rodata_start+0x90>
+  802da0:	61                   	(bad)
+  802da1:	74 20                	je     802dc3 <__rodata_start+0x93>
+  802da3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  802da8:	3a 20                	cmp    (%rax),%ah
+  802daa:	00 30                	add    %dh,(%rax)
+  802dac:	31 32                	xor    %esi,(%rdx)
+  802dae:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802db5:	41                   	rex.B
+  802db6:	42                   	rex.X
+  802db7:	43                   	rex.XB
+  802db8:	44                   	rex.R
+  802db9:	45                   	rex.RB
+  802dba:	46 00 30             	rex.RX add %r14b,(%rax)
+  802dbd:	31 32                	xor    %esi,(%rdx)
+  802dbf:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802dc6:	61                   	(bad)
+  802dc7:	62 63 64 65 66       	(bad)
+  802dcc:	00 28                	add    %ch,(%rax)
+  802dce:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dcf:	75 6c                	jne    802e3d <__rodata_start+0x10d>
+  802dd1:	6c                   	insb   (%dx),%es:(%rdi)
+  802dd2:	29 00                	sub    %eax,(%rax)
+  802dd4:	65 72 72             	gs jb  802e49 <__rodata_start+0x119>
+  802dd7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dd8:	72 20                	jb     802dfa <__rodata_start+0xca>
+  802dda:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802ddf:	73 70                	jae    802e51 <__rodata_start+0x121>
+  802de1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802de5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802dec:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ded:	72 00                	jb     802def <__rodata_start+0xbf>
+  802def:	62 61 64 20 65       	(bad)
+  802df4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802df5:	76 69                	jbe    802e60 <__rodata_start+0x130>
+  802df7:	72 6f                	jb     802e68 <__rodata_start+0x138>
+  802df9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dfa:	6d                   	insl   (%dx),%es:(%rdi)
+  802dfb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802dfd:	74 00                	je     802dff <__rodata_start+0xcf>
+  802dff:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802e06:	20 70 61             	and    %dh,0x61(%rax)
+  802e09:	72 61                	jb     802e6c <__rodata_start+0x13c>
+  802e0b:	6d                   	insl   (%dx),%es:(%rdi)
+  802e0c:	65 74 65             	gs je  802e74 <__rodata_start+0x144>
+  802e0f:	72 00                	jb     802e11 <__rodata_start+0xe1>
+  802e11:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e12:	75 74                	jne    802e88 <__rodata_start+0x158>
+  802e14:	20 6f 66             	and    %ch,0x66(%rdi)
+  802e17:	20 6d 65             	and    %ch,0x65(%rbp)
+  802e1a:	6d                   	insl   (%dx),%es:(%rdi)
+  802e1b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e1c:	72 79                	jb     802e97 <__rodata_start+0x167>
+  802e1e:	00 6f 75             	add    %ch,0x75(%rdi)
+  802e21:	74 20                	je     802e43 <__rodata_start+0x113>
+  802e23:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e24:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802e28:	76 69                	jbe    802e93 <__rodata_start+0x163>
+  802e2a:	72 6f                	jb     802e9b <__rodata_start+0x16b>
+  802e2c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e2d:	6d                   	insl   (%dx),%es:(%rdi)
+  802e2e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e30:	74 73                	je     802ea5 <__rodata_start+0x175>
+  802e32:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802e35:	72 72                	jb     802ea9 <__rodata_start+0x179>
+  802e37:	75 70                	jne    802ea9 <__rodata_start+0x179>
+  802e39:	74 65                	je     802ea0 <__rodata_start+0x170>
+  802e3b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802e40:	75 67                	jne    802ea9 <__rodata_start+0x179>
+  802e42:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802e45:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e47:	00 73 65             	add    %dh,0x65(%rbx)
+  802e4a:	67 6d                	insl   (%dx),%es:(%edi)
+  802e4c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e4e:	74 61                	je     802eb1 <__rodata_start+0x181>
+  802e50:	74 69                	je     802ebb <__rodata_start+0x18b>
+  802e52:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e53:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e54:	20 66 61             	and    %ah,0x61(%rsi)
+  802e57:	75 6c                	jne    802ec5 <__rodata_start+0x195>
+  802e59:	74 00                	je     802e5b <__rodata_start+0x12b>
+  802e5b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802e62:	20 45 4c             	and    %al,0x4c(%rbp)
+  802e65:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802e69:	61                   	(bad)
+  802e6a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802e6f:	20 73 75             	and    %dh,0x75(%rbx)
+  802e72:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802e75:	73 79                	jae    802ef0 <__rodata_start+0x1c0>
+  802e77:	73 74                	jae    802eed <__rodata_start+0x1bd>
+  802e79:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802e7b:	20 63 61             	and    %ah,0x61(%rbx)
+  802e7e:	6c                   	insb   (%dx),%es:(%rdi)
+  802e7f:	6c                   	insb   (%dx),%es:(%rdi)
+  802e80:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802e83:	74 72                	je     802ef7 <__rodata_start+0x1c7>
+  802e85:	79 20                	jns    802ea7 <__rodata_start+0x177>
+  802e87:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e88:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e89:	74 20                	je     802eab <__rodata_start+0x17b>
+  802e8b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e8d:	75 6e                	jne    802efd <__rodata_start+0x1cd>
+  802e8f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802e93:	76 20                	jbe    802eb5 <__rodata_start+0x185>
+  802e95:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802e9c:	72 65                	jb     802f03 <__rodata_start+0x1d3>
+  802e9e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802ea1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ea2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802ea6:	65 78 70             	gs js  802f19 <__rodata_start+0x1e9>
+  802ea9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802eae:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802eb1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802eb5:	20 66 69             	and    %ah,0x69(%rsi)
+  802eb8:	6c                   	insb   (%dx),%es:(%rdi)
+  802eb9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802ebd:	20 66 72             	and    %ah,0x72(%rsi)
+  802ec0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802ec5:	61                   	(bad)
+  802ec6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802ec9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eca:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ecb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802ecf:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802ed2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ed3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ed4:	20 6d 61             	and    %ch,0x61(%rbp)
+  802ed7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ed8:	79 20                	jns    802efa <__rodata_start+0x1ca>
+  802eda:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802ee1:	72 65                	jb     802f48 <__rodata_start+0x218>
+  802ee3:	20 6f 70             	and    %ch,0x70(%rdi)
+  802ee6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802ee8:	00 66 69             	add    %ah,0x69(%rsi)
+  802eeb:	6c                   	insb   (%dx),%es:(%rdi)
+  802eec:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802ef0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802ef3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ef4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802ef7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ef8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ef9:	74 20                	je     802f1b <__rodata_start+0x1eb>
+  802efb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802efd:	75 6e                	jne    802f6d <__rodata_start+0x23d>
+  802eff:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802f03:	76 61                	jbe    802f66 <__rodata_start+0x236>
+  802f05:	6c                   	insb   (%dx),%es:(%rdi)
+  802f06:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802f0d:	00 
+  802f0e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802f15:	72 65                	jb     802f7c <__rodata_start+0x24c>
+  802f17:	61                   	(bad)
+  802f18:	64 79 20             	fs jns 802f3b <__rodata_start+0x20b>
+  802f1b:	65 78 69             	gs js  802f87 <__rodata_start+0x257>
+  802f1e:	73 74                	jae    802f94 <__rodata_start+0x264>
+  802f20:	73 00                	jae    802f22 <__rodata_start+0x1f2>
+  802f22:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f23:	70 65                	jo     802f8a <__rodata_start+0x25a>
+  802f25:	72 61                	jb     802f88 <__rodata_start+0x258>
+  802f27:	74 69                	je     802f92 <__rodata_start+0x262>
+  802f29:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f2a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f2b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802f2e:	74 20                	je     802f50 <__rodata_start+0x220>
+  802f30:	73 75                	jae    802fa7 <__rodata_start+0x277>
+  802f32:	70 70                	jo     802fa4 <__rodata_start+0x274>
+  802f34:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f35:	72 74                	jb     802fab <__rodata_start+0x27b>
+  802f37:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802f3c:	65 72 61             	gs jb  802fa0 <__rodata_start+0x270>
+  802f3f:	74 69                	je     802faa <__rodata_start+0x27a>
+  802f41:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f42:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f43:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802f46:	74 20                	je     802f68 <__rodata_start+0x238>
+  802f48:	70 65                	jo     802faf <__rodata_start+0x27f>
+  802f4a:	72 6d                	jb     802fb9 <__rodata_start+0x289>
+  802f4c:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  802f53:	2e 
+  802f54:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  802f5b:	00 
+  802f5c:	0f 1f 40 00          	nopl   0x0(%rax)
+  802f60:	48 06                	rex.W (bad)
+  802f62:	80 00 00             	addb   $0x0,(%rax)
+  802f65:	00 00                	add    %al,(%rax)
+  802f67:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  802f6d:	00 00                	add    %al,(%rax)
+  802f6f:	00 79 0c             	add    %bh,0xc(%rcx)
+  802f72:	80 00 00             	addb   $0x0,(%rax)
+  802f75:	00 00                	add    %al,(%rax)
+  802f77:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  802f7d:	00 00                	add    %al,(%rax)
+  802f7f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  802f85:	00 00                	add    %al,(%rax)
+  802f87:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  802f8d:	00 00                	add    %al,(%rax)
+  802f8f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  802f95:	00 00                	add    %al,(%rax)
+  802f97:	00 67 06             	add    %ah,0x6(%rdi)
+  802f9a:	80 00 00             	addb   $0x0,(%rax)
+  802f9d:	00 00                	add    %al,(%rax)
+  802f9f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  802fa5:	00 00                	add    %al,(%rax)
+  802fa7:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  802fad:	00 00                	add    %al,(%rax)
+  802faf:	00 5b 06             	add    %bl,0x6(%rbx)
+  802fb2:	80 00 00             	addb   $0x0,(%rax)
+  802fb5:	00 00                	add    %al,(%rax)
+  802fb7:	00 d5                	add    %dl,%ch
+  802fb9:	06                   	(bad)
+  802fba:	80 00 00             	addb   $0x0,(%rax)
+  802fbd:	00 00                	add    %al,(%rax)
+  802fbf:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  802fc5:	00 00                	add    %al,(%rax)
+  802fc7:	00 5b 06             	add    %bl,0x6(%rbx)
+  802fca:	80 00 00             	addb   $0x0,(%rax)
+  802fcd:	00 00                	add    %al,(%rax)
+  802fcf:	00 a1 06 80 00 00    	add    %ah,0x8006(%rcx)
+  802fd5:	00 00                	add    %al,(%rax)
+  802fd7:	00 a1 06 80 00 00    	add    %ah,0x8006(%rcx)
+  802fdd:	00 00                	add    %al,(%rax)
+  802fdf:	00 a1 06 80 00 00    	add    %ah,0x8006(%rcx)
+  802fe5:	00 00                	add    %al,(%rax)
+  802fe7:	00 a1 06 80 00 00    	add    %ah,0x8006(%rcx)
+  802fed:	00 00                	add    %al,(%rax)
+  802fef:	00 a1 06 80 00 00    	add    %ah,0x8006(%rcx)
+  802ff5:	00 00                	add    %al,(%rax)
+  802ff7:	00 a1 06 80 00 00    	add    %ah,0x8006(%rcx)
+  802ffd:	00 00                	add    %al,(%rax)
+  802fff:	00 a1 06 80 00 00    	add    %ah,0x8006(%rcx)
+  803005:	00 00                	add    %al,(%rax)
+  803007:	00 a1 06 80 00 00    	add    %ah,0x8006(%rcx)
+  80300d:	00 00                	add    %al,(%rax)
+  80300f:	00 a1 06 80 00 00    	add    %ah,0x8006(%rcx)
+  803015:	00 00                	add    %al,(%rax)
+  803017:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80301d:	00 00                	add    %al,(%rax)
+  80301f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  803025:	00 00                	add    %al,(%rax)
+  803027:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80302d:	00 00                	add    %al,(%rax)
+  80302f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  803035:	00 00                	add    %al,(%rax)
+  803037:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80303d:	00 00                	add    %al,(%rax)
+  80303f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  803045:	00 00                	add    %al,(%rax)
+  803047:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80304d:	00 00                	add    %al,(%rax)
+  80304f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  803055:	00 00                	add    %al,(%rax)
+  803057:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80305d:	00 00                	add    %al,(%rax)
+  80305f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  803065:	00 00                	add    %al,(%rax)
+  803067:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80306d:	00 00                	add    %al,(%rax)
+  80306f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  803075:	00 00                	add    %al,(%rax)
+  803077:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80307d:	00 00                	add    %al,(%rax)
+  80307f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  803085:	00 00                	add    %al,(%rax)
+  803087:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80308d:	00 00                	add    %al,(%rax)
+  80308f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  803095:	00 00                	add    %al,(%rax)
+  803097:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80309d:	00 00                	add    %al,(%rax)
+  80309f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8030a5:	00 00                	add    %al,(%rax)
+  8030a7:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8030ad:	00 00                	add    %al,(%rax)
+  8030af:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8030b5:	00 00                	add    %al,(%rax)
+  8030b7:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8030bd:	00 00                	add    %al,(%rax)
+  8030bf:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8030c5:	00 00                	add    %al,(%rax)
+  8030c7:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8030cd:	00 00                	add    %al,(%rax)
+  8030cf:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8030dd:	00 00                	add    %al,(%rax)
+  8030df:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8030e5:	00 00                	add    %al,(%rax)
+  8030e7:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8030ed:	00 00                	add    %al,(%rax)
+  8030ef:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8030f5:	00 00                	add    %al,(%rax)
+  8030f7:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8030fd:	00 00                	add    %al,(%rax)
+  8030ff:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  803105:	00 00                	add    %al,(%rax)
+  803107:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  80310e:	00 00                	add    %al,(%rax)
+  803110:	89 0c 80             	mov    %ecx,(%rax,%rax,4)
+  803113:	00 00                	add    %al,(%rax)
+  803115:	00 00                	add    %al,(%rax)
+  803117:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80311d:	00 00                	add    %al,(%rax)
+  80311f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  803125:	00 00                	add    %al,(%rax)
+  803127:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80312d:	00 00                	add    %al,(%rax)
+  80312f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80313d:	00 00                	add    %al,(%rax)
+  80313f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80314d:	00 00                	add    %al,(%rax)
+  80314f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  803155:	00 00                	add    %al,(%rax)
+  803157:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80315d:	00 00                	add    %al,(%rax)
+  80315f:	00 f8                	add    %bh,%al
+  803161:	06                   	(bad)
+  803162:	80 00 00             	addb   $0x0,(%rax)
+  803165:	00 00                	add    %al,(%rax)
+  803167:	00 c7                	add    %al,%bh
+  803169:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80316f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  803175:	00 00                	add    %al,(%rax)
+  803177:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80317d:	00 00                	add    %al,(%rax)
+  80317f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  803185:	00 00                	add    %al,(%rax)
+  803187:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80318d:	00 00                	add    %al,(%rax)
+  80318f:	00 27                	add    %ah,(%rdi)
+  803191:	07                   	(bad)
+  803192:	80 00 00             	addb   $0x0,(%rax)
+  803195:	00 00                	add    %al,(%rax)
+  803197:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  80319d:	00 00                	add    %al,(%rax)
+  80319f:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8031a5:	00 00                	add    %al,(%rax)
+  8031a7:	00 ed                	add    %ch,%ch
+  8031a9:	06                   	(bad)
+  8031aa:	80 00 00             	addb   $0x0,(%rax)
+  8031ad:	00 00                	add    %al,(%rax)
+  8031af:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8031b5:	00 00                	add    %al,(%rax)
+  8031b7:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8031bd:	00 00                	add    %al,(%rax)
+  8031bf:	00 6f 0a             	add    %ch,0xa(%rdi)
+  8031c2:	80 00 00             	addb   $0x0,(%rax)
+  8031c5:	00 00                	add    %al,(%rax)
+  8031c7:	00 39                	add    %bh,(%rcx)
+  8031c9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031cf:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8031d5:	00 00                	add    %al,(%rax)
+  8031d7:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8031dd:	00 00                	add    %al,(%rax)
+  8031df:	00 be 07 80 00 00    	add    %bh,0x8007(%rsi)
+  8031e5:	00 00                	add    %al,(%rax)
+  8031e7:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8031ed:	00 00                	add    %al,(%rax)
+  8031ef:	00 9b 09 80 00 00    	add    %bl,0x8009(%rbx)
+  8031f5:	00 00                	add    %al,(%rax)
+  8031f7:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  8031fd:	00 00                	add    %al,(%rax)
+  8031ff:	00 89 0c 80 00 00    	add    %cl,0x800c(%rcx)
+  803205:	00 00                	add    %al,(%rax)
+  803207:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  80320e:	00 00                	add    %al,(%rax)
+  803210:	89 0c 80             	mov    %ecx,(%rax,%rax,4)
+  803213:	00 00                	add    %al,(%rax)
+  803215:	00 00                	add    %al,(%rax)
+  803217:	00 51 06             	add    %dl,0x6(%rcx)
+  80321a:	80 00 00             	addb   $0x0,(%rax)
+  80321d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803220 <error_string>:
+	...
+  803228:	dd 2d 80 00 00 00 00 00 ef 2d 80 00 00 00 00 00     .-.......-......
+  803238:	ff 2d 80 00 00 00 00 00 11 2e 80 00 00 00 00 00     .-..............
+  803248:	1f 2e 80 00 00 00 00 00 33 2e 80 00 00 00 00 00     ........3.......
+  803258:	48 2e 80 00 00 00 00 00 5b 2e 80 00 00 00 00 00     H.......[.......
+  803268:	6d 2e 80 00 00 00 00 00 81 2e 80 00 00 00 00 00     m...............
+  803278:	91 2e 80 00 00 00 00 00 a4 2e 80 00 00 00 00 00     ................
+  803288:	bb 2e 80 00 00 00 00 00 d1 2e 80 00 00 00 00 00     ................
+  803298:	e9 2e 80 00 00 00 00 00 01 2f 80 00 00 00 00 00     ........./......
+  8032a8:	0e 2f 80 00 00 00 00 00 d0 32 80 00 00 00 00 00     ./.......2......
+  8032b8:	22 2f 80 00 00 00 00 00 00 00 00 00 00 00 00 00     "/..............
+  8032c8:	3a 2f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     :/......file is 
+  8032d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8032e8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8032f8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803308:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803318:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803328:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803338:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803348:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803358:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803368:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803378:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803388:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803398:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008033a0 <devtab>:
+  8033a0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8033b0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8033c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8033d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8033e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8033f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803400:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803410:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803420:	69 70 63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64     ipc_send: failed
+  803430:	20 74 6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63      to send.lib/ipc
+  803440:	2e 63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     .c.f.........f..
+  803450:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803460:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803470:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803480:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803490:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803500:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803510:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803520:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803530:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803540:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803550:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803560:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803570:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803580:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803590:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803600:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803610:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803620:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803630:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803640:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803650:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803660:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803670:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803680:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803690:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803700:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803710:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803720:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803730:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803740:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803750:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803760:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803770:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803780:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803790:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
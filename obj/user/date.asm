@@ -0,0 +1,5921 @@
+
+obj/user/date:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 5f 03 00 00       	call   800382 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/time.h>
+#include <inc/stdio.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 58          	sub    $0x58,%rsp
+    char time[20];
+    int now = sys_gettime();
+  80002e:	48 b8 a1 17 80 00 00 	movabs $0x8017a1,%rax
+  800035:	00 00 00 
+  800038:	ff d0                	call   *%rax
+  80003a:	41 89 c0             	mov    %eax,%r8d
+
+inline static void
+mktime(int time, struct tm *tm) {
+    // TODO Support negative timestamps
+
+    int year = 1970 + (time / (DAY * 366 + 1));
+  80003d:	48 63 f0             	movslq %eax,%rsi
+  800040:	48 69 f6 c1 40 fa 10 	imul   $0x10fa40c1,%rsi,%rsi
+  800047:	48 c1 fe 35          	sar    $0x35,%rsi
+  80004b:	c1 f8 1f             	sar    $0x1f,%eax
+  80004e:	29 c6                	sub    %eax,%esi
+  800050:	8d be b2 07 00 00    	lea    0x7b2(%rsi),%edi
+    while (time >= DAY * (Y2DAYS(year + 1) - Y2DAYS(1970))) year++;
+  800056:	81 c6 b3 07 00 00    	add    $0x7b3,%esi
+  80005c:	69 f6 6d 01 00 00    	imul   $0x16d,%esi,%esi
+  800062:	89 f9                	mov    %edi,%ecx
+  800064:	83 c7 01             	add    $0x1,%edi
+  800067:	8d 41 03             	lea    0x3(%rcx),%eax
+  80006a:	85 c9                	test   %ecx,%ecx
+  80006c:	0f 49 c1             	cmovns %ecx,%eax
+  80006f:	c1 f8 02             	sar    $0x2,%eax
+  800072:	01 f0                	add    %esi,%eax
+  800074:	48 63 d1             	movslq %ecx,%rdx
+  800077:	48 69 d2 1f 85 eb 51 	imul   $0x51eb851f,%rdx,%rdx
+  80007e:	48 89 d3             	mov    %rdx,%rbx
+  800081:	48 c1 fb 25          	sar    $0x25,%rbx
+  800085:	49 89 db             	mov    %rbx,%r11
+  800088:	41 89 c9             	mov    %ecx,%r9d
+  80008b:	41 c1 f9 1f          	sar    $0x1f,%r9d
+  80008f:	45 89 ca             	mov    %r9d,%r10d
+  800092:	41 29 da             	sub    %ebx,%r10d
+  800095:	44 01 d0             	add    %r10d,%eax
+  800098:	48 c1 fa 27          	sar    $0x27,%rdx
+  80009c:	44 29 ca             	sub    %r9d,%edx
+  80009f:	8d 84 10 59 05 f5 ff 	lea    -0xafaa7(%rax,%rdx,1),%eax
+  8000a6:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  8000ac:	81 c6 6d 01 00 00    	add    $0x16d,%esi
+  8000b2:	41 39 c0             	cmp    %eax,%r8d
+  8000b5:	7d ab                	jge    800062 <umain+0x3d>
+    tm->tm_year = year - 1900;
+    time -= DAY * (Y2DAYS(year) - Y2DAYS(1970));
+  8000b7:	69 f1 6d 01 00 00    	imul   $0x16d,%ecx,%esi
+  8000bd:	8d 41 02             	lea    0x2(%rcx),%eax
+  8000c0:	89 ca                	mov    %ecx,%edx
+  8000c2:	83 ea 01             	sub    $0x1,%edx
+  8000c5:	0f 49 c2             	cmovns %edx,%eax
+  8000c8:	c1 f8 02             	sar    $0x2,%eax
+  8000cb:	01 c6                	add    %eax,%esi
+  8000cd:	48 63 c2             	movslq %edx,%rax
+  8000d0:	48 69 c0 1f 85 eb 51 	imul   $0x51eb851f,%rax,%rax
+  8000d7:	48 89 c3             	mov    %rax,%rbx
+  8000da:	48 c1 fb 25          	sar    $0x25,%rbx
+  8000de:	c1 fa 1f             	sar    $0x1f,%edx
+  8000e1:	89 d7                	mov    %edx,%edi
+  8000e3:	29 df                	sub    %ebx,%edi
+  8000e5:	01 fe                	add    %edi,%esi
+  8000e7:	48 c1 f8 27          	sar    $0x27,%rax
+  8000eb:	29 d0                	sub    %edx,%eax
+  8000ed:	8d b4 06 59 05 f5 ff 	lea    -0xafaa7(%rsi,%rax,1),%esi
+  8000f4:	69 f6 80 ae fe ff    	imul   $0xfffeae80,%esi,%esi
+  8000fa:	44 01 c6             	add    %r8d,%esi
+
+    int month = time / (DAY * 32);
+    while (time >= DAY * (M2DAYS(month + 1, year))) month++;
+  8000fd:	4c 63 c9             	movslq %ecx,%r9
+  800100:	4d 69 c9 1f 85 eb 51 	imul   $0x51eb851f,%r9,%r9
+  800107:	4c 89 c8             	mov    %r9,%rax
+  80010a:	48 c1 f8 27          	sar    $0x27,%rax
+  80010e:	49 89 c2             	mov    %rax,%r10
+  800111:	89 c8                	mov    %ecx,%eax
+  800113:	c1 f8 1f             	sar    $0x1f,%eax
+  800116:	41 29 c2             	sub    %eax,%r10d
+  800119:	41 69 d2 90 01 00 00 	imul   $0x190,%r10d,%edx
+  800120:	41 89 ca             	mov    %ecx,%r10d
+  800123:	41 29 d2             	sub    %edx,%r10d
+  800126:	4d 89 d9             	mov    %r11,%r9
+  800129:	41 29 c1             	sub    %eax,%r9d
+  80012c:	41 6b c1 64          	imul   $0x64,%r9d,%eax
+  800130:	41 89 c9             	mov    %ecx,%r9d
+  800133:	41 29 c1             	sub    %eax,%r9d
+    int month = time / (DAY * 32);
+  800136:	48 63 d6             	movslq %esi,%rdx
+  800139:	48 69 d2 07 45 2e c2 	imul   $0xffffffffc22e4507,%rdx,%rdx
+  800140:	48 c1 ea 20          	shr    $0x20,%rdx
+  800144:	01 f2                	add    %esi,%edx
+  800146:	c1 fa 15             	sar    $0x15,%edx
+  800149:	89 f0                	mov    %esi,%eax
+  80014b:	c1 f8 1f             	sar    $0x1f,%eax
+  80014e:	29 c2                	sub    %eax,%edx
+  800150:	48 63 d2             	movslq %edx,%rdx
+    while (time >= DAY * (M2DAYS(month + 1, year))) month++;
+  800153:	41 89 cb             	mov    %ecx,%r11d
+  800156:	41 83 e3 03          	and    $0x3,%r11d
+  80015a:	44 89 cb             	mov    %r9d,%ebx
+  80015d:	eb 21                	jmp    800180 <umain+0x15b>
+  80015f:	85 d2                	test   %edx,%edx
+  800161:	40 0f 9f c7          	setg   %dil
+  800165:	40 0f b6 ff          	movzbl %dil,%edi
+  800169:	4c 8d 42 01          	lea    0x1(%rdx),%r8
+  80016d:	01 f8                	add    %edi,%eax
+  80016f:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  800175:	39 c6                	cmp    %eax,%esi
+  800177:	0f 8c 89 00 00 00    	jl     800206 <umain+0x1e1>
+  80017d:	4c 89 c2             	mov    %r8,%rdx
+  800180:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+  800187:	c7 45 ac 1f 00 00 00 	movl   $0x1f,-0x54(%rbp)
+  80018e:	c7 45 b0 3b 00 00 00 	movl   $0x3b,-0x50(%rbp)
+  800195:	c7 45 b4 5a 00 00 00 	movl   $0x5a,-0x4c(%rbp)
+  80019c:	c7 45 b8 78 00 00 00 	movl   $0x78,-0x48(%rbp)
+  8001a3:	c7 45 bc 97 00 00 00 	movl   $0x97,-0x44(%rbp)
+  8001aa:	c7 45 c0 b5 00 00 00 	movl   $0xb5,-0x40(%rbp)
+  8001b1:	c7 45 c4 d4 00 00 00 	movl   $0xd4,-0x3c(%rbp)
+  8001b8:	c7 45 c8 f3 00 00 00 	movl   $0xf3,-0x38(%rbp)
+  8001bf:	c7 45 cc 11 01 00 00 	movl   $0x111,-0x34(%rbp)
+  8001c6:	c7 45 d0 30 01 00 00 	movl   $0x130,-0x30(%rbp)
+  8001cd:	c7 45 d4 4e 01 00 00 	movl   $0x14e,-0x2c(%rbp)
+  8001d4:	c7 45 d8 6d 01 00 00 	movl   $0x16d,-0x28(%rbp)
+  8001db:	8b 44 95 ac          	mov    -0x54(%rbp,%rdx,4),%eax
+  8001df:	45 85 d2             	test   %r10d,%r10d
+  8001e2:	0f 84 77 ff ff ff    	je     80015f <umain+0x13a>
+  8001e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ed:	45 85 db             	test   %r11d,%r11d
+  8001f0:	0f 85 73 ff ff ff    	jne    800169 <umain+0x144>
+  8001f6:	89 df                	mov    %ebx,%edi
+  8001f8:	45 85 c9             	test   %r9d,%r9d
+  8001fb:	0f 84 68 ff ff ff    	je     800169 <umain+0x144>
+  800201:	e9 59 ff ff ff       	jmp    80015f <umain+0x13a>
+  800206:	89 d7                	mov    %edx,%edi
+    tm->tm_mon = month;
+    time -= DAY * M2DAYS(month, year);
+  800208:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+  80020f:	c7 45 ac 1f 00 00 00 	movl   $0x1f,-0x54(%rbp)
+  800216:	c7 45 b0 3b 00 00 00 	movl   $0x3b,-0x50(%rbp)
+  80021d:	c7 45 b4 5a 00 00 00 	movl   $0x5a,-0x4c(%rbp)
+  800224:	c7 45 b8 78 00 00 00 	movl   $0x78,-0x48(%rbp)
+  80022b:	c7 45 bc 97 00 00 00 	movl   $0x97,-0x44(%rbp)
+  800232:	c7 45 c0 b5 00 00 00 	movl   $0xb5,-0x40(%rbp)
+  800239:	c7 45 c4 d4 00 00 00 	movl   $0xd4,-0x3c(%rbp)
+  800240:	c7 45 c8 f3 00 00 00 	movl   $0xf3,-0x38(%rbp)
+  800247:	c7 45 cc 11 01 00 00 	movl   $0x111,-0x34(%rbp)
+  80024e:	c7 45 d0 30 01 00 00 	movl   $0x130,-0x30(%rbp)
+  800255:	c7 45 d4 4e 01 00 00 	movl   $0x14e,-0x2c(%rbp)
+  80025c:	c7 45 d8 6d 01 00 00 	movl   $0x16d,-0x28(%rbp)
+  800263:	48 63 c2             	movslq %edx,%rax
+  800266:	8b 44 85 a8          	mov    -0x58(%rbp,%rax,4),%eax
+  80026a:	45 85 d2             	test   %r10d,%r10d
+  80026d:	74 0e                	je     80027d <umain+0x258>
+  80026f:	f6 c1 03             	test   $0x3,%cl
+  800272:	0f 85 ff 00 00 00    	jne    800377 <umain+0x352>
+  800278:	45 85 c9             	test   %r9d,%r9d
+  80027b:	74 0b                	je     800288 <umain+0x263>
+  80027d:	83 ff 01             	cmp    $0x1,%edi
+  800280:	41 0f 9f c1          	setg   %r9b
+  800284:	45 0f b6 c9          	movzbl %r9b,%r9d
+  800288:	44 01 c8             	add    %r9d,%eax
+  80028b:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  800291:	29 c6                	sub    %eax,%esi
+
+    tm->tm_mday = time / DAY + 1;
+    time %= DAY;
+  800293:	48 63 c6             	movslq %esi,%rax
+  800296:	48 69 c0 07 45 2e c2 	imul   $0xffffffffc22e4507,%rax,%rax
+  80029d:	48 c1 e8 20          	shr    $0x20,%rax
+  8002a1:	01 f0                	add    %esi,%eax
+  8002a3:	c1 f8 10             	sar    $0x10,%eax
+  8002a6:	41 89 f3             	mov    %esi,%r11d
+  8002a9:	41 c1 fb 1f          	sar    $0x1f,%r11d
+  8002ad:	41 89 c2             	mov    %eax,%r10d
+  8002b0:	45 29 da             	sub    %r11d,%r10d
+  8002b3:	41 69 fa 80 51 01 00 	imul   $0x15180,%r10d,%edi
+  8002ba:	29 fe                	sub    %edi,%esi
+  8002bc:	41 89 f2             	mov    %esi,%r10d
+    tm->tm_hour = time / HOUR;
+    time %= HOUR;
+  8002bf:	48 63 f6             	movslq %esi,%rsi
+  8002c2:	48 69 f6 c5 b3 a2 91 	imul   $0xffffffff91a2b3c5,%rsi,%rsi
+  8002c9:	48 c1 ee 20          	shr    $0x20,%rsi
+  8002cd:	44 01 d6             	add    %r10d,%esi
+  8002d0:	c1 fe 0b             	sar    $0xb,%esi
+  8002d3:	41 89 f0             	mov    %esi,%r8d
+  8002d6:	45 89 d1             	mov    %r10d,%r9d
+  8002d9:	41 c1 f9 1f          	sar    $0x1f,%r9d
+  8002dd:	89 f7                	mov    %esi,%edi
+  8002df:	44 29 cf             	sub    %r9d,%edi
+  8002e2:	69 f7 10 0e 00 00    	imul   $0xe10,%edi,%esi
+  8002e8:	44 89 d7             	mov    %r10d,%edi
+  8002eb:	29 f7                	sub    %esi,%edi
+    tm->tm_mday = time / DAY + 1;
+  8002ed:	44 29 d8             	sub    %r11d,%eax
+  8002f0:	89 c6                	mov    %eax,%esi
+}
+
+inline static void
+snprint_datetime(char *buf, int size, struct tm *tm) {
+    assert(size >= 10 + 1 + 8 + 1);
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  8002f2:	48 83 ec 08          	sub    $0x8,%rsp
+    time %= MINUTE;
+  8002f6:	48 63 c7             	movslq %edi,%rax
+  8002f9:	48 69 c0 89 88 88 88 	imul   $0xffffffff88888889,%rax,%rax
+  800300:	48 c1 e8 20          	shr    $0x20,%rax
+  800304:	01 f8                	add    %edi,%eax
+  800306:	c1 f8 05             	sar    $0x5,%eax
+  800309:	41 89 fa             	mov    %edi,%r10d
+  80030c:	41 c1 fa 1f          	sar    $0x1f,%r10d
+  800310:	44 29 d0             	sub    %r10d,%eax
+  800313:	44 6b d0 3c          	imul   $0x3c,%eax,%r10d
+  800317:	44 29 d7             	sub    %r10d,%edi
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  80031a:	57                   	push   %rdi
+  80031b:	50                   	push   %rax
+    tm->tm_hour = time / HOUR;
+  80031c:	45 29 c8             	sub    %r9d,%r8d
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  80031f:	41 50                	push   %r8
+  800321:	44 8d 4e 01          	lea    0x1(%rsi),%r9d
+  800325:	44 8d 42 01          	lea    0x1(%rdx),%r8d
+  800329:	48 ba 70 2e 80 00 00 	movabs $0x802e70,%rdx
+  800330:	00 00 00 
+  800333:	be 14 00 00 00       	mov    $0x14,%esi
+  800338:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80033c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800341:	49 ba a3 0d 80 00 00 	movabs $0x800da3,%r10
+  800348:	00 00 00 
+  80034b:	41 ff d2             	call   *%r10
+    struct tm tnow;
+
+    mktime(now, &tnow);
+
+    snprint_datetime(time, 20, &tnow);
+    cprintf("DATE: %s\n", time);
+  80034e:	48 83 c4 20          	add    $0x20,%rsp
+  800352:	48 8d 75 dc          	lea    -0x24(%rbp),%rsi
+  800356:	48 bf 8e 2e 80 00 00 	movabs $0x802e8e,%rdi
+  80035d:	00 00 00 
+  800360:	b8 00 00 00 00       	mov    $0x0,%eax
+  800365:	48 ba f9 04 80 00 00 	movabs $0x8004f9,%rdx
+  80036c:	00 00 00 
+  80036f:	ff d2                	call   *%rdx
+}
+  800371:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800375:	c9                   	leave
+  800376:	c3                   	ret
+    time -= DAY * M2DAYS(month, year);
+  800377:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80037d:	e9 06 ff ff ff       	jmp    800288 <umain+0x263>
+
+0000000000800382 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800382:	55                   	push   %rbp
+  800383:	48 89 e5             	mov    %rsp,%rbp
+  800386:	41 56                	push   %r14
+  800388:	41 55                	push   %r13
+  80038a:	41 54                	push   %r12
+  80038c:	53                   	push   %rbx
+  80038d:	41 89 fd             	mov    %edi,%r13d
+  800390:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800393:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80039a:	00 00 00 
+  80039d:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8003a4:	00 00 00 
+  8003a7:	48 39 c2             	cmp    %rax,%rdx
+  8003aa:	73 17                	jae    8003c3 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8003ac:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003af:	49 89 c4             	mov    %rax,%r12
+  8003b2:	48 83 c3 08          	add    $0x8,%rbx
+  8003b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bb:	ff 53 f8             	call   *-0x8(%rbx)
+  8003be:	4c 39 e3             	cmp    %r12,%rbx
+  8003c1:	72 ef                	jb     8003b2 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8003c3:	48 b8 0e 13 80 00 00 	movabs $0x80130e,%rax
+  8003ca:	00 00 00 
+  8003cd:	ff d0                	call   *%rax
+  8003cf:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8003d2:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8003d9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003e0:	00 00 00 
+  8003e3:	48 01 d0             	add    %rdx,%rax
+  8003e6:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8003ed:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003f0:	45 85 ed             	test   %r13d,%r13d
+  8003f3:	7e 0d                	jle    800402 <libmain+0x80>
+  8003f5:	49 8b 06             	mov    (%r14),%rax
+  8003f8:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8003ff:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800402:	4c 89 f6             	mov    %r14,%rsi
+  800405:	44 89 ef             	mov    %r13d,%edi
+  800408:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80040f:	00 00 00 
+  800412:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800414:	48 b8 29 04 80 00 00 	movabs $0x800429,%rax
+  80041b:	00 00 00 
+  80041e:	ff d0                	call   *%rax
+#endif
+}
+  800420:	5b                   	pop    %rbx
+  800421:	41 5c                	pop    %r12
+  800423:	41 5d                	pop    %r13
+  800425:	41 5e                	pop    %r14
+  800427:	5d                   	pop    %rbp
+  800428:	c3                   	ret
+
+0000000000800429 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800429:	55                   	push   %rbp
+  80042a:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80042d:	48 b8 96 1b 80 00 00 	movabs $0x801b96,%rax
+  800434:	00 00 00 
+  800437:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800439:	bf 00 00 00 00       	mov    $0x0,%edi
+  80043e:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  800445:	00 00 00 
+  800448:	ff d0                	call   *%rax
+}
+  80044a:	5d                   	pop    %rbp
+  80044b:	c3                   	ret
+
+000000000080044c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80044c:	55                   	push   %rbp
+  80044d:	48 89 e5             	mov    %rsp,%rbp
+  800450:	53                   	push   %rbx
+  800451:	48 83 ec 08          	sub    $0x8,%rsp
+  800455:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800458:	8b 06                	mov    (%rsi),%eax
+  80045a:	8d 50 01             	lea    0x1(%rax),%edx
+  80045d:	89 16                	mov    %edx,(%rsi)
+  80045f:	48 98                	cltq
+  800461:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800466:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80046c:	74 0a                	je     800478 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80046e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800472:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800476:	c9                   	leave
+  800477:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800478:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80047c:	be ff 00 00 00       	mov    $0xff,%esi
+  800481:	48 b8 45 12 80 00 00 	movabs $0x801245,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80048d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800493:	eb d9                	jmp    80046e <putch+0x22>
+
+0000000000800495 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800495:	55                   	push   %rbp
+  800496:	48 89 e5             	mov    %rsp,%rbp
+  800499:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004a0:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004a3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004aa:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004b7:	48 89 f1             	mov    %rsi,%rcx
+  8004ba:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004c1:	48 bf 4c 04 80 00 00 	movabs $0x80044c,%rdi
+  8004c8:	00 00 00 
+  8004cb:	48 b8 49 06 80 00 00 	movabs $0x800649,%rax
+  8004d2:	00 00 00 
+  8004d5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004d7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004de:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004e5:	48 b8 45 12 80 00 00 	movabs $0x801245,%rax
+  8004ec:	00 00 00 
+  8004ef:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8004f1:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8004f7:	c9                   	leave
+  8004f8:	c3                   	ret
+
+00000000008004f9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8004f9:	55                   	push   %rbp
+  8004fa:	48 89 e5             	mov    %rsp,%rbp
+  8004fd:	48 83 ec 50          	sub    $0x50,%rsp
+  800501:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800505:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800509:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80050d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800511:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800515:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80051c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800520:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800524:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800528:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80052c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800530:	48 b8 95 04 80 00 00 	movabs $0x800495,%rax
+  800537:	00 00 00 
+  80053a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80053c:	c9                   	leave
+  80053d:	c3                   	ret
+
+000000000080053e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80053e:	55                   	push   %rbp
+  80053f:	48 89 e5             	mov    %rsp,%rbp
+  800542:	41 57                	push   %r15
+  800544:	41 56                	push   %r14
+  800546:	41 55                	push   %r13
+  800548:	41 54                	push   %r12
+  80054a:	53                   	push   %rbx
+  80054b:	48 83 ec 18          	sub    $0x18,%rsp
+  80054f:	49 89 fc             	mov    %rdi,%r12
+  800552:	49 89 f5             	mov    %rsi,%r13
+  800555:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800559:	8b 45 10             	mov    0x10(%rbp),%eax
+  80055c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80055f:	41 89 cf             	mov    %ecx,%r15d
+  800562:	4c 39 fa             	cmp    %r15,%rdx
+  800565:	73 5b                	jae    8005c2 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800567:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80056b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80056f:	85 db                	test   %ebx,%ebx
+  800571:	7e 0e                	jle    800581 <print_num+0x43>
+            putch(padc, put_arg);
+  800573:	4c 89 ee             	mov    %r13,%rsi
+  800576:	44 89 f7             	mov    %r14d,%edi
+  800579:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80057c:	83 eb 01             	sub    $0x1,%ebx
+  80057f:	75 f2                	jne    800573 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800581:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800585:	48 b9 b3 2e 80 00 00 	movabs $0x802eb3,%rcx
+  80058c:	00 00 00 
+  80058f:	48 b8 a2 2e 80 00 00 	movabs $0x802ea2,%rax
+  800596:	00 00 00 
+  800599:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80059d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a6:	49 f7 f7             	div    %r15
+  8005a9:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005ad:	4c 89 ee             	mov    %r13,%rsi
+  8005b0:	41 ff d4             	call   *%r12
+}
+  8005b3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005b7:	5b                   	pop    %rbx
+  8005b8:	41 5c                	pop    %r12
+  8005ba:	41 5d                	pop    %r13
+  8005bc:	41 5e                	pop    %r14
+  8005be:	41 5f                	pop    %r15
+  8005c0:	5d                   	pop    %rbp
+  8005c1:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005cb:	49 f7 f7             	div    %r15
+  8005ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8005d2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005d6:	52                   	push   %rdx
+  8005d7:	45 0f be c9          	movsbl %r9b,%r9d
+  8005db:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005df:	48 89 c2             	mov    %rax,%rdx
+  8005e2:	48 b8 3e 05 80 00 00 	movabs $0x80053e,%rax
+  8005e9:	00 00 00 
+  8005ec:	ff d0                	call   *%rax
+  8005ee:	48 83 c4 10          	add    $0x10,%rsp
+  8005f2:	eb 8d                	jmp    800581 <print_num+0x43>
+
+00000000008005f4 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8005f4:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8005f8:	48 8b 06             	mov    (%rsi),%rax
+  8005fb:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8005ff:	73 0a                	jae    80060b <sprintputch+0x17>
+        *state->start++ = ch;
+  800601:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800605:	48 89 16             	mov    %rdx,(%rsi)
+  800608:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80060b:	c3                   	ret
+
+000000000080060c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80060c:	55                   	push   %rbp
+  80060d:	48 89 e5             	mov    %rsp,%rbp
+  800610:	48 83 ec 50          	sub    $0x50,%rsp
+  800614:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800618:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80061c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800620:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800627:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80062b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80062f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800633:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800637:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80063b:	48 b8 49 06 80 00 00 	movabs $0x800649,%rax
+  800642:	00 00 00 
+  800645:	ff d0                	call   *%rax
+}
+  800647:	c9                   	leave
+  800648:	c3                   	ret
+
+0000000000800649 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800649:	55                   	push   %rbp
+  80064a:	48 89 e5             	mov    %rsp,%rbp
+  80064d:	41 57                	push   %r15
+  80064f:	41 56                	push   %r14
+  800651:	41 55                	push   %r13
+  800653:	41 54                	push   %r12
+  800655:	53                   	push   %rbx
+  800656:	48 83 ec 38          	sub    $0x38,%rsp
+  80065a:	49 89 fe             	mov    %rdi,%r14
+  80065d:	49 89 f5             	mov    %rsi,%r13
+  800660:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800663:	48 8b 01             	mov    (%rcx),%rax
+  800666:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80066a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80066e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800672:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800676:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80067a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80067e:	0f b6 3b             	movzbl (%rbx),%edi
+  800681:	40 80 ff 25          	cmp    $0x25,%dil
+  800685:	74 18                	je     80069f <vprintfmt+0x56>
+            if (!ch) return;
+  800687:	40 84 ff             	test   %dil,%dil
+  80068a:	0f 84 b1 06 00 00    	je     800d41 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800690:	40 0f b6 ff          	movzbl %dil,%edi
+  800694:	4c 89 ee             	mov    %r13,%rsi
+  800697:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80069a:	4c 89 e3             	mov    %r12,%rbx
+  80069d:	eb db                	jmp    80067a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80069f:	be 00 00 00 00       	mov    $0x0,%esi
+  8006a4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006a8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006ad:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006b3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006ba:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006be:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006c3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006c8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006cb:	83 e8 23             	sub    $0x23,%eax
+  8006ce:	3c 57                	cmp    $0x57,%al
+  8006d0:	0f 87 51 06 00 00    	ja     800d27 <vprintfmt+0x6de>
+  8006d6:	0f b6 c0             	movzbl %al,%eax
+  8006d9:	48 b9 60 30 80 00 00 	movabs $0x803060,%rcx
+  8006e0:	00 00 00 
+  8006e3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006e6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006e9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8006ed:	eb cf                	jmp    8006be <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8006ef:	49 89 dc             	mov    %rbx,%r12
+  8006f2:	be 01 00 00 00       	mov    $0x1,%esi
+  8006f7:	eb c5                	jmp    8006be <vprintfmt+0x75>
+            padc = ch;
+  8006f9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8006fd:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800700:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800703:	eb b9                	jmp    8006be <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800705:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800708:	83 f8 2f             	cmp    $0x2f,%eax
+  80070b:	77 24                	ja     800731 <vprintfmt+0xe8>
+  80070d:	89 c1                	mov    %eax,%ecx
+  80070f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800713:	83 c0 08             	add    $0x8,%eax
+  800716:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800719:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80071c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80071f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800723:	79 99                	jns    8006be <vprintfmt+0x75>
+                width = precision;
+  800725:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800729:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80072f:	eb 8d                	jmp    8006be <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800731:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800735:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800739:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80073d:	eb da                	jmp    800719 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80073f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800744:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800748:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80074e:	3c 39                	cmp    $0x39,%al
+  800750:	77 1c                	ja     80076e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800752:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800756:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80075a:	0f b6 c0             	movzbl %al,%eax
+  80075d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800762:	0f b6 03             	movzbl (%rbx),%eax
+  800765:	3c 39                	cmp    $0x39,%al
+  800767:	76 e9                	jbe    800752 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800769:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80076c:	eb b1                	jmp    80071f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80076e:	49 89 dc             	mov    %rbx,%r12
+  800771:	eb ac                	jmp    80071f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800773:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800776:	85 c9                	test   %ecx,%ecx
+  800778:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077d:	0f 49 c1             	cmovns %ecx,%eax
+  800780:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800783:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800786:	e9 33 ff ff ff       	jmp    8006be <vprintfmt+0x75>
+            lflag++;
+  80078b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80078e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800791:	e9 28 ff ff ff       	jmp    8006be <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800796:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800799:	83 f8 2f             	cmp    $0x2f,%eax
+  80079c:	77 19                	ja     8007b7 <vprintfmt+0x16e>
+  80079e:	89 c2                	mov    %eax,%edx
+  8007a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a4:	83 c0 08             	add    $0x8,%eax
+  8007a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007aa:	8b 3a                	mov    (%rdx),%edi
+  8007ac:	4c 89 ee             	mov    %r13,%rsi
+  8007af:	41 ff d6             	call   *%r14
+            break;
+  8007b2:	e9 c3 fe ff ff       	jmp    80067a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c3:	eb e5                	jmp    8007aa <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007cb:	77 5a                	ja     800827 <vprintfmt+0x1de>
+  8007cd:	89 c2                	mov    %eax,%edx
+  8007cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d3:	83 c0 08             	add    $0x8,%eax
+  8007d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007d9:	8b 02                	mov    (%rdx),%eax
+  8007db:	89 c1                	mov    %eax,%ecx
+  8007dd:	f7 d9                	neg    %ecx
+  8007df:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007e2:	83 f9 15             	cmp    $0x15,%ecx
+  8007e5:	7f 4e                	jg     800835 <vprintfmt+0x1ec>
+  8007e7:	48 63 c1             	movslq %ecx,%rax
+  8007ea:	48 ba 20 33 80 00 00 	movabs $0x803320,%rdx
+  8007f1:	00 00 00 
+  8007f4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007f8:	48 85 c0             	test   %rax,%rax
+  8007fb:	74 38                	je     800835 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8007fd:	48 89 c1             	mov    %rax,%rcx
+  800800:	48 ba d9 34 80 00 00 	movabs $0x8034d9,%rdx
+  800807:	00 00 00 
+  80080a:	4c 89 ee             	mov    %r13,%rsi
+  80080d:	4c 89 f7             	mov    %r14,%rdi
+  800810:	b8 00 00 00 00       	mov    $0x0,%eax
+  800815:	49 b8 0c 06 80 00 00 	movabs $0x80060c,%r8
+  80081c:	00 00 00 
+  80081f:	41 ff d0             	call   *%r8
+  800822:	e9 53 fe ff ff       	jmp    80067a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800827:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80082b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800833:	eb a4                	jmp    8007d9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800835:	48 ba cb 2e 80 00 00 	movabs $0x802ecb,%rdx
+  80083c:	00 00 00 
+  80083f:	4c 89 ee             	mov    %r13,%rsi
+  800842:	4c 89 f7             	mov    %r14,%rdi
+  800845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084a:	49 b8 0c 06 80 00 00 	movabs $0x80060c,%r8
+  800851:	00 00 00 
+  800854:	41 ff d0             	call   *%r8
+  800857:	e9 1e fe ff ff       	jmp    80067a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80085c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80085f:	83 f8 2f             	cmp    $0x2f,%eax
+  800862:	77 6c                	ja     8008d0 <vprintfmt+0x287>
+  800864:	89 c2                	mov    %eax,%edx
+  800866:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086a:	83 c0 08             	add    $0x8,%eax
+  80086d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800870:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800873:	48 85 d2             	test   %rdx,%rdx
+  800876:	48 b8 c4 2e 80 00 00 	movabs $0x802ec4,%rax
+  80087d:	00 00 00 
+  800880:	48 0f 45 c2          	cmovne %rdx,%rax
+  800884:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800888:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80088c:	7e 06                	jle    800894 <vprintfmt+0x24b>
+  80088e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800892:	75 4a                	jne    8008de <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800894:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800898:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80089c:	0f b6 00             	movzbl (%rax),%eax
+  80089f:	84 c0                	test   %al,%al
+  8008a1:	0f 85 9a 00 00 00    	jne    800941 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008a7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008aa:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008ae:	85 c0                	test   %eax,%eax
+  8008b0:	0f 8e c4 fd ff ff    	jle    80067a <vprintfmt+0x31>
+  8008b6:	4c 89 ee             	mov    %r13,%rsi
+  8008b9:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008be:	41 ff d6             	call   *%r14
+  8008c1:	41 83 ec 01          	sub    $0x1,%r12d
+  8008c5:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008c9:	75 eb                	jne    8008b6 <vprintfmt+0x26d>
+  8008cb:	e9 aa fd ff ff       	jmp    80067a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008dc:	eb 92                	jmp    800870 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008de:	49 63 f7             	movslq %r15d,%rsi
+  8008e1:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008e5:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  8008ec:	00 00 00 
+  8008ef:	ff d0                	call   *%rax
+  8008f1:	48 89 c2             	mov    %rax,%rdx
+  8008f4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008f7:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8008f9:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8008fc:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8008ff:	85 c0                	test   %eax,%eax
+  800901:	7e 91                	jle    800894 <vprintfmt+0x24b>
+  800903:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800908:	4c 89 ee             	mov    %r13,%rsi
+  80090b:	44 89 e7             	mov    %r12d,%edi
+  80090e:	41 ff d6             	call   *%r14
+  800911:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800915:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800918:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80091b:	75 eb                	jne    800908 <vprintfmt+0x2bf>
+  80091d:	e9 72 ff ff ff       	jmp    800894 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800922:	0f b6 f8             	movzbl %al,%edi
+  800925:	4c 89 ee             	mov    %r13,%rsi
+  800928:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80092b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80092f:	49 83 c4 01          	add    $0x1,%r12
+  800933:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800939:	84 c0                	test   %al,%al
+  80093b:	0f 84 66 ff ff ff    	je     8008a7 <vprintfmt+0x25e>
+  800941:	45 85 ff             	test   %r15d,%r15d
+  800944:	78 0a                	js     800950 <vprintfmt+0x307>
+  800946:	41 83 ef 01          	sub    $0x1,%r15d
+  80094a:	0f 88 57 ff ff ff    	js     8008a7 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800950:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800954:	74 cc                	je     800922 <vprintfmt+0x2d9>
+  800956:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800959:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80095e:	80 fa 5e             	cmp    $0x5e,%dl
+  800961:	77 c2                	ja     800925 <vprintfmt+0x2dc>
+  800963:	eb bd                	jmp    800922 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800965:	40 84 f6             	test   %sil,%sil
+  800968:	75 26                	jne    800990 <vprintfmt+0x347>
+    switch (lflag) {
+  80096a:	85 d2                	test   %edx,%edx
+  80096c:	74 59                	je     8009c7 <vprintfmt+0x37e>
+  80096e:	83 fa 01             	cmp    $0x1,%edx
+  800971:	74 7b                	je     8009ee <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800973:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800976:	83 f8 2f             	cmp    $0x2f,%eax
+  800979:	0f 87 96 00 00 00    	ja     800a15 <vprintfmt+0x3cc>
+  80097f:	89 c2                	mov    %eax,%edx
+  800981:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800985:	83 c0 08             	add    $0x8,%eax
+  800988:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098b:	4c 8b 22             	mov    (%rdx),%r12
+  80098e:	eb 17                	jmp    8009a7 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800990:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800993:	83 f8 2f             	cmp    $0x2f,%eax
+  800996:	77 21                	ja     8009b9 <vprintfmt+0x370>
+  800998:	89 c2                	mov    %eax,%edx
+  80099a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099e:	83 c0 08             	add    $0x8,%eax
+  8009a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a4:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009a7:	4d 85 e4             	test   %r12,%r12
+  8009aa:	78 7a                	js     800a26 <vprintfmt+0x3dd>
+            num = i;
+  8009ac:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009af:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009b4:	e9 50 02 00 00       	jmp    800c09 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c5:	eb dd                	jmp    8009a4 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8009cd:	77 11                	ja     8009e0 <vprintfmt+0x397>
+  8009cf:	89 c2                	mov    %eax,%edx
+  8009d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d5:	83 c0 08             	add    $0x8,%eax
+  8009d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009db:	4c 63 22             	movslq (%rdx),%r12
+  8009de:	eb c7                	jmp    8009a7 <vprintfmt+0x35e>
+  8009e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ec:	eb ed                	jmp    8009db <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8009ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f4:	77 11                	ja     800a07 <vprintfmt+0x3be>
+  8009f6:	89 c2                	mov    %eax,%edx
+  8009f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fc:	83 c0 08             	add    $0x8,%eax
+  8009ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a02:	4c 8b 22             	mov    (%rdx),%r12
+  800a05:	eb a0                	jmp    8009a7 <vprintfmt+0x35e>
+  800a07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a13:	eb ed                	jmp    800a02 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a19:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a21:	e9 65 ff ff ff       	jmp    80098b <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a26:	4c 89 ee             	mov    %r13,%rsi
+  800a29:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a2e:	41 ff d6             	call   *%r14
+                i = -i;
+  800a31:	49 f7 dc             	neg    %r12
+  800a34:	e9 73 ff ff ff       	jmp    8009ac <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a39:	40 84 f6             	test   %sil,%sil
+  800a3c:	75 32                	jne    800a70 <vprintfmt+0x427>
+    switch (lflag) {
+  800a3e:	85 d2                	test   %edx,%edx
+  800a40:	74 5d                	je     800a9f <vprintfmt+0x456>
+  800a42:	83 fa 01             	cmp    $0x1,%edx
+  800a45:	0f 84 82 00 00 00    	je     800acd <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a51:	0f 87 a5 00 00 00    	ja     800afc <vprintfmt+0x4b3>
+  800a57:	89 c2                	mov    %eax,%edx
+  800a59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5d:	83 c0 08             	add    $0x8,%eax
+  800a60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a63:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a66:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a6b:	e9 99 01 00 00       	jmp    800c09 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a70:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a73:	83 f8 2f             	cmp    $0x2f,%eax
+  800a76:	77 19                	ja     800a91 <vprintfmt+0x448>
+  800a78:	89 c2                	mov    %eax,%edx
+  800a7a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7e:	83 c0 08             	add    $0x8,%eax
+  800a81:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a84:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a87:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a8c:	e9 78 01 00 00       	jmp    800c09 <vprintfmt+0x5c0>
+  800a91:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a95:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9d:	eb e5                	jmp    800a84 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a9f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa2:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa5:	77 18                	ja     800abf <vprintfmt+0x476>
+  800aa7:	89 c2                	mov    %eax,%edx
+  800aa9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aad:	83 c0 08             	add    $0x8,%eax
+  800ab0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab3:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800ab5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800aba:	e9 4a 01 00 00       	jmp    800c09 <vprintfmt+0x5c0>
+  800abf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800acb:	eb e6                	jmp    800ab3 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800acd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad3:	77 19                	ja     800aee <vprintfmt+0x4a5>
+  800ad5:	89 c2                	mov    %eax,%edx
+  800ad7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800adb:	83 c0 08             	add    $0x8,%eax
+  800ade:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ae4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800ae9:	e9 1b 01 00 00       	jmp    800c09 <vprintfmt+0x5c0>
+  800aee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800afa:	eb e5                	jmp    800ae1 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800afc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b00:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b08:	e9 56 ff ff ff       	jmp    800a63 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b0d:	40 84 f6             	test   %sil,%sil
+  800b10:	75 2e                	jne    800b40 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b12:	85 d2                	test   %edx,%edx
+  800b14:	74 59                	je     800b6f <vprintfmt+0x526>
+  800b16:	83 fa 01             	cmp    $0x1,%edx
+  800b19:	74 7f                	je     800b9a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b21:	0f 87 9f 00 00 00    	ja     800bc6 <vprintfmt+0x57d>
+  800b27:	89 c2                	mov    %eax,%edx
+  800b29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2d:	83 c0 08             	add    $0x8,%eax
+  800b30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b33:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b36:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b3b:	e9 c9 00 00 00       	jmp    800c09 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b43:	83 f8 2f             	cmp    $0x2f,%eax
+  800b46:	77 19                	ja     800b61 <vprintfmt+0x518>
+  800b48:	89 c2                	mov    %eax,%edx
+  800b4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b4e:	83 c0 08             	add    $0x8,%eax
+  800b51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b54:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b57:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b5c:	e9 a8 00 00 00       	jmp    800c09 <vprintfmt+0x5c0>
+  800b61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6d:	eb e5                	jmp    800b54 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b72:	83 f8 2f             	cmp    $0x2f,%eax
+  800b75:	77 15                	ja     800b8c <vprintfmt+0x543>
+  800b77:	89 c2                	mov    %eax,%edx
+  800b79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b7d:	83 c0 08             	add    $0x8,%eax
+  800b80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b83:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b85:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b8a:	eb 7d                	jmp    800c09 <vprintfmt+0x5c0>
+  800b8c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b90:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b98:	eb e9                	jmp    800b83 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b9a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b9d:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba0:	77 16                	ja     800bb8 <vprintfmt+0x56f>
+  800ba2:	89 c2                	mov    %eax,%edx
+  800ba4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba8:	83 c0 08             	add    $0x8,%eax
+  800bab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bae:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bb1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bb6:	eb 51                	jmp    800c09 <vprintfmt+0x5c0>
+  800bb8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bbc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc4:	eb e8                	jmp    800bae <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800bc6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd2:	e9 5c ff ff ff       	jmp    800b33 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800bd7:	4c 89 ee             	mov    %r13,%rsi
+  800bda:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bdf:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800be2:	4c 89 ee             	mov    %r13,%rsi
+  800be5:	bf 78 00 00 00       	mov    $0x78,%edi
+  800bea:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800bed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf0:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf3:	77 47                	ja     800c3c <vprintfmt+0x5f3>
+  800bf5:	89 c2                	mov    %eax,%edx
+  800bf7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bfb:	83 c0 08             	add    $0x8,%eax
+  800bfe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c01:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c04:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c09:	48 83 ec 08          	sub    $0x8,%rsp
+  800c0d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c11:	0f 94 c0             	sete   %al
+  800c14:	0f b6 c0             	movzbl %al,%eax
+  800c17:	50                   	push   %rax
+  800c18:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c1d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c21:	4c 89 ee             	mov    %r13,%rsi
+  800c24:	4c 89 f7             	mov    %r14,%rdi
+  800c27:	48 b8 3e 05 80 00 00 	movabs $0x80053e,%rax
+  800c2e:	00 00 00 
+  800c31:	ff d0                	call   *%rax
+            break;
+  800c33:	48 83 c4 10          	add    $0x10,%rsp
+  800c37:	e9 3e fa ff ff       	jmp    80067a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c3c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c40:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c48:	eb b7                	jmp    800c01 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c4a:	40 84 f6             	test   %sil,%sil
+  800c4d:	75 2b                	jne    800c7a <vprintfmt+0x631>
+    switch (lflag) {
+  800c4f:	85 d2                	test   %edx,%edx
+  800c51:	74 56                	je     800ca9 <vprintfmt+0x660>
+  800c53:	83 fa 01             	cmp    $0x1,%edx
+  800c56:	74 7f                	je     800cd7 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c58:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c5b:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5e:	0f 87 a2 00 00 00    	ja     800d06 <vprintfmt+0x6bd>
+  800c64:	89 c2                	mov    %eax,%edx
+  800c66:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c6a:	83 c0 08             	add    $0x8,%eax
+  800c6d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c70:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c73:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c78:	eb 8f                	jmp    800c09 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c7d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c80:	77 19                	ja     800c9b <vprintfmt+0x652>
+  800c82:	89 c2                	mov    %eax,%edx
+  800c84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c88:	83 c0 08             	add    $0x8,%eax
+  800c8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c8e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c91:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c96:	e9 6e ff ff ff       	jmp    800c09 <vprintfmt+0x5c0>
+  800c9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca7:	eb e5                	jmp    800c8e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800ca9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cac:	83 f8 2f             	cmp    $0x2f,%eax
+  800caf:	77 18                	ja     800cc9 <vprintfmt+0x680>
+  800cb1:	89 c2                	mov    %eax,%edx
+  800cb3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb7:	83 c0 08             	add    $0x8,%eax
+  800cba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cbd:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800cbf:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800cc4:	e9 40 ff ff ff       	jmp    800c09 <vprintfmt+0x5c0>
+  800cc9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ccd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cd1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd5:	eb e6                	jmp    800cbd <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800cd7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cda:	83 f8 2f             	cmp    $0x2f,%eax
+  800cdd:	77 19                	ja     800cf8 <vprintfmt+0x6af>
+  800cdf:	89 c2                	mov    %eax,%edx
+  800ce1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ce5:	83 c0 08             	add    $0x8,%eax
+  800ce8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ceb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cee:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800cf3:	e9 11 ff ff ff       	jmp    800c09 <vprintfmt+0x5c0>
+  800cf8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cfc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d04:	eb e5                	jmp    800ceb <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d06:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d0a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d0e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d12:	e9 59 ff ff ff       	jmp    800c70 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d17:	4c 89 ee             	mov    %r13,%rsi
+  800d1a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d1f:	41 ff d6             	call   *%r14
+            break;
+  800d22:	e9 53 f9 ff ff       	jmp    80067a <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d27:	4c 89 ee             	mov    %r13,%rsi
+  800d2a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d2f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d32:	48 83 eb 01          	sub    $0x1,%rbx
+  800d36:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d3a:	75 f6                	jne    800d32 <vprintfmt+0x6e9>
+  800d3c:	e9 39 f9 ff ff       	jmp    80067a <vprintfmt+0x31>
+}
+  800d41:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d45:	5b                   	pop    %rbx
+  800d46:	41 5c                	pop    %r12
+  800d48:	41 5d                	pop    %r13
+  800d4a:	41 5e                	pop    %r14
+  800d4c:	41 5f                	pop    %r15
+  800d4e:	5d                   	pop    %rbp
+  800d4f:	c3                   	ret
+
+0000000000800d50 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d50:	55                   	push   %rbp
+  800d51:	48 89 e5             	mov    %rsp,%rbp
+  800d54:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d58:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d5c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d61:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d65:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d6c:	48 85 ff             	test   %rdi,%rdi
+  800d6f:	74 2b                	je     800d9c <vsnprintf+0x4c>
+  800d71:	48 85 f6             	test   %rsi,%rsi
+  800d74:	74 26                	je     800d9c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d76:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d7a:	48 bf f4 05 80 00 00 	movabs $0x8005f4,%rdi
+  800d81:	00 00 00 
+  800d84:	48 b8 49 06 80 00 00 	movabs $0x800649,%rax
+  800d8b:	00 00 00 
+  800d8e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d94:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d97:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d9a:	c9                   	leave
+  800d9b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d9c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800da1:	eb f7                	jmp    800d9a <vsnprintf+0x4a>
+
+0000000000800da3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800da3:	55                   	push   %rbp
+  800da4:	48 89 e5             	mov    %rsp,%rbp
+  800da7:	48 83 ec 50          	sub    $0x50,%rsp
+  800dab:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800daf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800db3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800db7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800dbe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dc2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800dca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800dce:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800dd2:	48 b8 50 0d 80 00 00 	movabs $0x800d50,%rax
+  800dd9:	00 00 00 
+  800ddc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800dde:	c9                   	leave
+  800ddf:	c3                   	ret
+
+0000000000800de0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800de0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800de3:	74 10                	je     800df5 <strlen+0x15>
+    size_t n = 0;
+  800de5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800dea:	48 83 c0 01          	add    $0x1,%rax
+  800dee:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800df2:	75 f6                	jne    800dea <strlen+0xa>
+  800df4:	c3                   	ret
+    size_t n = 0;
+  800df5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800dfa:	c3                   	ret
+
+0000000000800dfb <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800dfb:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800dfe:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e03:	48 85 f6             	test   %rsi,%rsi
+  800e06:	74 11                	je     800e19 <strnlen+0x1e>
+  800e08:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e0c:	74 0c                	je     800e1a <strnlen+0x1f>
+  800e0e:	48 83 c2 01          	add    $0x1,%rdx
+  800e12:	48 39 d0             	cmp    %rdx,%rax
+  800e15:	75 f1                	jne    800e08 <strnlen+0xd>
+  800e17:	eb 04                	jmp    800e1d <strnlen+0x22>
+  800e19:	c3                   	ret
+  800e1a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e1d:	c3                   	ret
+
+0000000000800e1e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e1e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e21:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e26:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e2a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e2d:	48 83 c2 01          	add    $0x1,%rdx
+  800e31:	84 c9                	test   %cl,%cl
+  800e33:	75 f1                	jne    800e26 <strcpy+0x8>
+        ;
+    return res;
+}
+  800e35:	c3                   	ret
+
+0000000000800e36 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e36:	55                   	push   %rbp
+  800e37:	48 89 e5             	mov    %rsp,%rbp
+  800e3a:	41 54                	push   %r12
+  800e3c:	53                   	push   %rbx
+  800e3d:	48 89 fb             	mov    %rdi,%rbx
+  800e40:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e43:	48 b8 e0 0d 80 00 00 	movabs $0x800de0,%rax
+  800e4a:	00 00 00 
+  800e4d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e4f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e53:	4c 89 e6             	mov    %r12,%rsi
+  800e56:	48 b8 1e 0e 80 00 00 	movabs $0x800e1e,%rax
+  800e5d:	00 00 00 
+  800e60:	ff d0                	call   *%rax
+    return dst;
+}
+  800e62:	48 89 d8             	mov    %rbx,%rax
+  800e65:	5b                   	pop    %rbx
+  800e66:	41 5c                	pop    %r12
+  800e68:	5d                   	pop    %rbp
+  800e69:	c3                   	ret
+
+0000000000800e6a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e6a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e6d:	48 85 d2             	test   %rdx,%rdx
+  800e70:	74 1f                	je     800e91 <strncpy+0x27>
+  800e72:	48 01 fa             	add    %rdi,%rdx
+  800e75:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e78:	48 83 c1 01          	add    $0x1,%rcx
+  800e7c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e80:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e84:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e88:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e8c:	48 39 ca             	cmp    %rcx,%rdx
+  800e8f:	75 e7                	jne    800e78 <strncpy+0xe>
+    }
+    return ret;
+}
+  800e91:	c3                   	ret
+
+0000000000800e92 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e92:	48 89 f8             	mov    %rdi,%rax
+  800e95:	48 85 d2             	test   %rdx,%rdx
+  800e98:	74 24                	je     800ebe <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e9a:	48 83 ea 01          	sub    $0x1,%rdx
+  800e9e:	74 1b                	je     800ebb <strlcpy+0x29>
+  800ea0:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800ea4:	0f b6 16             	movzbl (%rsi),%edx
+  800ea7:	84 d2                	test   %dl,%dl
+  800ea9:	74 10                	je     800ebb <strlcpy+0x29>
+            *dst++ = *src++;
+  800eab:	48 83 c6 01          	add    $0x1,%rsi
+  800eaf:	48 83 c0 01          	add    $0x1,%rax
+  800eb3:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800eb6:	48 39 c8             	cmp    %rcx,%rax
+  800eb9:	75 e9                	jne    800ea4 <strlcpy+0x12>
+        *dst = '\0';
+  800ebb:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ebe:	48 29 f8             	sub    %rdi,%rax
+}
+  800ec1:	c3                   	ret
+
+0000000000800ec2 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ec2:	0f b6 07             	movzbl (%rdi),%eax
+  800ec5:	84 c0                	test   %al,%al
+  800ec7:	74 13                	je     800edc <strcmp+0x1a>
+  800ec9:	38 06                	cmp    %al,(%rsi)
+  800ecb:	75 0f                	jne    800edc <strcmp+0x1a>
+  800ecd:	48 83 c7 01          	add    $0x1,%rdi
+  800ed1:	48 83 c6 01          	add    $0x1,%rsi
+  800ed5:	0f b6 07             	movzbl (%rdi),%eax
+  800ed8:	84 c0                	test   %al,%al
+  800eda:	75 ed                	jne    800ec9 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800edc:	0f b6 c0             	movzbl %al,%eax
+  800edf:	0f b6 16             	movzbl (%rsi),%edx
+  800ee2:	29 d0                	sub    %edx,%eax
+}
+  800ee4:	c3                   	ret
+
+0000000000800ee5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800ee5:	48 85 d2             	test   %rdx,%rdx
+  800ee8:	74 1f                	je     800f09 <strncmp+0x24>
+  800eea:	0f b6 07             	movzbl (%rdi),%eax
+  800eed:	84 c0                	test   %al,%al
+  800eef:	74 1e                	je     800f0f <strncmp+0x2a>
+  800ef1:	3a 06                	cmp    (%rsi),%al
+  800ef3:	75 1a                	jne    800f0f <strncmp+0x2a>
+  800ef5:	48 83 c7 01          	add    $0x1,%rdi
+  800ef9:	48 83 c6 01          	add    $0x1,%rsi
+  800efd:	48 83 ea 01          	sub    $0x1,%rdx
+  800f01:	75 e7                	jne    800eea <strncmp+0x5>
+
+    if (!n) return 0;
+  800f03:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f08:	c3                   	ret
+  800f09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f0e:	c3                   	ret
+  800f0f:	48 85 d2             	test   %rdx,%rdx
+  800f12:	74 09                	je     800f1d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f14:	0f b6 07             	movzbl (%rdi),%eax
+  800f17:	0f b6 16             	movzbl (%rsi),%edx
+  800f1a:	29 d0                	sub    %edx,%eax
+  800f1c:	c3                   	ret
+    if (!n) return 0;
+  800f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f22:	c3                   	ret
+
+0000000000800f23 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f23:	0f b6 17             	movzbl (%rdi),%edx
+  800f26:	84 d2                	test   %dl,%dl
+  800f28:	74 18                	je     800f42 <strchr+0x1f>
+        if (*str == c) {
+  800f2a:	0f be d2             	movsbl %dl,%edx
+  800f2d:	39 f2                	cmp    %esi,%edx
+  800f2f:	74 17                	je     800f48 <strchr+0x25>
+    for (; *str; str++) {
+  800f31:	48 83 c7 01          	add    $0x1,%rdi
+  800f35:	0f b6 17             	movzbl (%rdi),%edx
+  800f38:	84 d2                	test   %dl,%dl
+  800f3a:	75 ee                	jne    800f2a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f41:	c3                   	ret
+  800f42:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f47:	c3                   	ret
+  800f48:	48 89 f8             	mov    %rdi,%rax
+}
+  800f4b:	c3                   	ret
+
+0000000000800f4c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f4c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f4f:	0f b6 17             	movzbl (%rdi),%edx
+  800f52:	84 d2                	test   %dl,%dl
+  800f54:	74 13                	je     800f69 <strfind+0x1d>
+  800f56:	0f be d2             	movsbl %dl,%edx
+  800f59:	39 f2                	cmp    %esi,%edx
+  800f5b:	74 0b                	je     800f68 <strfind+0x1c>
+  800f5d:	48 83 c0 01          	add    $0x1,%rax
+  800f61:	0f b6 10             	movzbl (%rax),%edx
+  800f64:	84 d2                	test   %dl,%dl
+  800f66:	75 ee                	jne    800f56 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f68:	c3                   	ret
+  800f69:	c3                   	ret
+
+0000000000800f6a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f6a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f6d:	48 89 f8             	mov    %rdi,%rax
+  800f70:	48 f7 d8             	neg    %rax
+  800f73:	83 e0 07             	and    $0x7,%eax
+  800f76:	49 89 d1             	mov    %rdx,%r9
+  800f79:	49 29 c1             	sub    %rax,%r9
+  800f7c:	78 36                	js     800fb4 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f7e:	40 0f b6 c6          	movzbl %sil,%eax
+  800f82:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f89:	01 01 01 
+  800f8c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f90:	40 f6 c7 07          	test   $0x7,%dil
+  800f94:	75 38                	jne    800fce <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f96:	4c 89 c9             	mov    %r9,%rcx
+  800f99:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f9d:	74 0c                	je     800fab <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f9f:	fc                   	cld
+  800fa0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fa3:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fa7:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fab:	4d 85 c9             	test   %r9,%r9
+  800fae:	75 45                	jne    800ff5 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fb0:	4c 89 c0             	mov    %r8,%rax
+  800fb3:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fb4:	48 85 d2             	test   %rdx,%rdx
+  800fb7:	74 f7                	je     800fb0 <memset+0x46>
+  800fb9:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fbc:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fbf:	48 83 c0 01          	add    $0x1,%rax
+  800fc3:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fc7:	48 39 c2             	cmp    %rax,%rdx
+  800fca:	75 f3                	jne    800fbf <memset+0x55>
+  800fcc:	eb e2                	jmp    800fb0 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fce:	40 f6 c7 01          	test   $0x1,%dil
+  800fd2:	74 06                	je     800fda <memset+0x70>
+  800fd4:	88 07                	mov    %al,(%rdi)
+  800fd6:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fda:	40 f6 c7 02          	test   $0x2,%dil
+  800fde:	74 07                	je     800fe7 <memset+0x7d>
+  800fe0:	66 89 07             	mov    %ax,(%rdi)
+  800fe3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800fe7:	40 f6 c7 04          	test   $0x4,%dil
+  800feb:	74 a9                	je     800f96 <memset+0x2c>
+  800fed:	89 07                	mov    %eax,(%rdi)
+  800fef:	48 83 c7 04          	add    $0x4,%rdi
+  800ff3:	eb a1                	jmp    800f96 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ff5:	41 f6 c1 04          	test   $0x4,%r9b
+  800ff9:	74 06                	je     801001 <memset+0x97>
+  800ffb:	89 07                	mov    %eax,(%rdi)
+  800ffd:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801001:	41 f6 c1 02          	test   $0x2,%r9b
+  801005:	74 07                	je     80100e <memset+0xa4>
+  801007:	66 89 07             	mov    %ax,(%rdi)
+  80100a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80100e:	41 f6 c1 01          	test   $0x1,%r9b
+  801012:	74 9c                	je     800fb0 <memset+0x46>
+  801014:	88 07                	mov    %al,(%rdi)
+  801016:	eb 98                	jmp    800fb0 <memset+0x46>
+
+0000000000801018 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801018:	48 89 f8             	mov    %rdi,%rax
+  80101b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80101e:	48 39 fe             	cmp    %rdi,%rsi
+  801021:	73 3b                	jae    80105e <memmove+0x46>
+  801023:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801027:	48 39 d7             	cmp    %rdx,%rdi
+  80102a:	73 32                	jae    80105e <memmove+0x46>
+        s += n;
+        d += n;
+  80102c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801030:	48 89 d6             	mov    %rdx,%rsi
+  801033:	48 09 fe             	or     %rdi,%rsi
+  801036:	48 09 ce             	or     %rcx,%rsi
+  801039:	40 f6 c6 07          	test   $0x7,%sil
+  80103d:	75 12                	jne    801051 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80103f:	48 83 ef 08          	sub    $0x8,%rdi
+  801043:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801047:	48 c1 e9 03          	shr    $0x3,%rcx
+  80104b:	fd                   	std
+  80104c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80104f:	fc                   	cld
+  801050:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801051:	48 83 ef 01          	sub    $0x1,%rdi
+  801055:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801059:	fd                   	std
+  80105a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80105c:	eb f1                	jmp    80104f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80105e:	48 89 f2             	mov    %rsi,%rdx
+  801061:	48 09 c2             	or     %rax,%rdx
+  801064:	48 09 ca             	or     %rcx,%rdx
+  801067:	f6 c2 07             	test   $0x7,%dl
+  80106a:	75 0c                	jne    801078 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80106c:	48 c1 e9 03          	shr    $0x3,%rcx
+  801070:	48 89 c7             	mov    %rax,%rdi
+  801073:	fc                   	cld
+  801074:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801077:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801078:	48 89 c7             	mov    %rax,%rdi
+  80107b:	fc                   	cld
+  80107c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80107e:	c3                   	ret
+
+000000000080107f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80107f:	55                   	push   %rbp
+  801080:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801083:	48 b8 18 10 80 00 00 	movabs $0x801018,%rax
+  80108a:	00 00 00 
+  80108d:	ff d0                	call   *%rax
+}
+  80108f:	5d                   	pop    %rbp
+  801090:	c3                   	ret
+
+0000000000801091 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801091:	55                   	push   %rbp
+  801092:	48 89 e5             	mov    %rsp,%rbp
+  801095:	41 57                	push   %r15
+  801097:	41 56                	push   %r14
+  801099:	41 55                	push   %r13
+  80109b:	41 54                	push   %r12
+  80109d:	53                   	push   %rbx
+  80109e:	48 83 ec 08          	sub    $0x8,%rsp
+  8010a2:	49 89 fe             	mov    %rdi,%r14
+  8010a5:	49 89 f7             	mov    %rsi,%r15
+  8010a8:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010ab:	48 89 f7             	mov    %rsi,%rdi
+  8010ae:	48 b8 e0 0d 80 00 00 	movabs $0x800de0,%rax
+  8010b5:	00 00 00 
+  8010b8:	ff d0                	call   *%rax
+  8010ba:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010bd:	48 89 de             	mov    %rbx,%rsi
+  8010c0:	4c 89 f7             	mov    %r14,%rdi
+  8010c3:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  8010ca:	00 00 00 
+  8010cd:	ff d0                	call   *%rax
+  8010cf:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010d2:	48 39 c3             	cmp    %rax,%rbx
+  8010d5:	74 36                	je     80110d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010d7:	48 89 d8             	mov    %rbx,%rax
+  8010da:	4c 29 e8             	sub    %r13,%rax
+  8010dd:	49 39 c4             	cmp    %rax,%r12
+  8010e0:	73 31                	jae    801113 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010e2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8010e7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010eb:	4c 89 fe             	mov    %r15,%rsi
+  8010ee:	48 b8 7f 10 80 00 00 	movabs $0x80107f,%rax
+  8010f5:	00 00 00 
+  8010f8:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8010fa:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8010fe:	48 83 c4 08          	add    $0x8,%rsp
+  801102:	5b                   	pop    %rbx
+  801103:	41 5c                	pop    %r12
+  801105:	41 5d                	pop    %r13
+  801107:	41 5e                	pop    %r14
+  801109:	41 5f                	pop    %r15
+  80110b:	5d                   	pop    %rbp
+  80110c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80110d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801111:	eb eb                	jmp    8010fe <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801113:	48 83 eb 01          	sub    $0x1,%rbx
+  801117:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80111b:	48 89 da             	mov    %rbx,%rdx
+  80111e:	4c 89 fe             	mov    %r15,%rsi
+  801121:	48 b8 7f 10 80 00 00 	movabs $0x80107f,%rax
+  801128:	00 00 00 
+  80112b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80112d:	49 01 de             	add    %rbx,%r14
+  801130:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801135:	eb c3                	jmp    8010fa <strlcat+0x69>
+
+0000000000801137 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801137:	48 85 d2             	test   %rdx,%rdx
+  80113a:	74 2d                	je     801169 <memcmp+0x32>
+  80113c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801141:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801145:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80114a:	44 38 c1             	cmp    %r8b,%cl
+  80114d:	75 0f                	jne    80115e <memcmp+0x27>
+    while (n-- > 0) {
+  80114f:	48 83 c0 01          	add    $0x1,%rax
+  801153:	48 39 c2             	cmp    %rax,%rdx
+  801156:	75 e9                	jne    801141 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801158:	b8 00 00 00 00       	mov    $0x0,%eax
+  80115d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80115e:	0f b6 c1             	movzbl %cl,%eax
+  801161:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801165:	44 29 c0             	sub    %r8d,%eax
+  801168:	c3                   	ret
+    return 0;
+  801169:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80116e:	c3                   	ret
+
+000000000080116f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80116f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801173:	48 39 c7             	cmp    %rax,%rdi
+  801176:	73 0f                	jae    801187 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801178:	40 38 37             	cmp    %sil,(%rdi)
+  80117b:	74 0e                	je     80118b <memfind+0x1c>
+    for (; src < end; src++) {
+  80117d:	48 83 c7 01          	add    $0x1,%rdi
+  801181:	48 39 f8             	cmp    %rdi,%rax
+  801184:	75 f2                	jne    801178 <memfind+0x9>
+  801186:	c3                   	ret
+  801187:	48 89 f8             	mov    %rdi,%rax
+  80118a:	c3                   	ret
+  80118b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80118e:	c3                   	ret
+
+000000000080118f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80118f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801192:	0f b6 37             	movzbl (%rdi),%esi
+  801195:	40 80 fe 20          	cmp    $0x20,%sil
+  801199:	74 06                	je     8011a1 <strtol+0x12>
+  80119b:	40 80 fe 09          	cmp    $0x9,%sil
+  80119f:	75 13                	jne    8011b4 <strtol+0x25>
+  8011a1:	48 83 c7 01          	add    $0x1,%rdi
+  8011a5:	0f b6 37             	movzbl (%rdi),%esi
+  8011a8:	40 80 fe 20          	cmp    $0x20,%sil
+  8011ac:	74 f3                	je     8011a1 <strtol+0x12>
+  8011ae:	40 80 fe 09          	cmp    $0x9,%sil
+  8011b2:	74 ed                	je     8011a1 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011b4:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011b7:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011ba:	3c 01                	cmp    $0x1,%al
+  8011bc:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011c0:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011c6:	75 0f                	jne    8011d7 <strtol+0x48>
+  8011c8:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011cb:	74 14                	je     8011e1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011cd:	85 d2                	test   %edx,%edx
+  8011cf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011d4:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011d7:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011dc:	4c 63 ca             	movslq %edx,%r9
+  8011df:	eb 36                	jmp    801217 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011e1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011e5:	74 0f                	je     8011f6 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8011e7:	85 d2                	test   %edx,%edx
+  8011e9:	75 ec                	jne    8011d7 <strtol+0x48>
+        s++;
+  8011eb:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8011ef:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8011f4:	eb e1                	jmp    8011d7 <strtol+0x48>
+        s += 2;
+  8011f6:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8011fa:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8011ff:	eb d6                	jmp    8011d7 <strtol+0x48>
+            dig -= '0';
+  801201:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801204:	44 0f b6 c1          	movzbl %cl,%r8d
+  801208:	41 39 d0             	cmp    %edx,%r8d
+  80120b:	7d 21                	jge    80122e <strtol+0x9f>
+        val = val * base + dig;
+  80120d:	49 0f af c1          	imul   %r9,%rax
+  801211:	0f b6 c9             	movzbl %cl,%ecx
+  801214:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801217:	48 83 c7 01          	add    $0x1,%rdi
+  80121b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80121f:	80 f9 39             	cmp    $0x39,%cl
+  801222:	76 dd                	jbe    801201 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801224:	80 f9 7b             	cmp    $0x7b,%cl
+  801227:	77 05                	ja     80122e <strtol+0x9f>
+            dig -= 'a' - 10;
+  801229:	83 e9 57             	sub    $0x57,%ecx
+  80122c:	eb d6                	jmp    801204 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80122e:	4d 85 d2             	test   %r10,%r10
+  801231:	74 03                	je     801236 <strtol+0xa7>
+  801233:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801236:	48 89 c2             	mov    %rax,%rdx
+  801239:	48 f7 da             	neg    %rdx
+  80123c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801240:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801244:	c3                   	ret
+
+0000000000801245 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801245:	55                   	push   %rbp
+  801246:	48 89 e5             	mov    %rsp,%rbp
+  801249:	53                   	push   %rbx
+  80124a:	48 89 fa             	mov    %rdi,%rdx
+  80124d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801250:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801255:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80125f:	be 00 00 00 00       	mov    $0x0,%esi
+  801264:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80126a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80126c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801270:	c9                   	leave
+  801271:	c3                   	ret
+
+0000000000801272 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801272:	55                   	push   %rbp
+  801273:	48 89 e5             	mov    %rsp,%rbp
+  801276:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801277:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80127c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801281:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801286:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801290:	be 00 00 00 00       	mov    $0x0,%esi
+  801295:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80129b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80129d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a1:	c9                   	leave
+  8012a2:	c3                   	ret
+
+00000000008012a3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8012a3:	55                   	push   %rbp
+  8012a4:	48 89 e5             	mov    %rsp,%rbp
+  8012a7:	53                   	push   %rbx
+  8012a8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012ac:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012af:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ce:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012d0:	48 85 c0             	test   %rax,%rax
+  8012d3:	7f 06                	jg     8012db <sys_env_destroy+0x38>
+}
+  8012d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d9:	c9                   	leave
+  8012da:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012db:	49 89 c0             	mov    %rax,%r8
+  8012de:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012e3:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  8012ea:	00 00 00 
+  8012ed:	be 26 00 00 00       	mov    $0x26,%esi
+  8012f2:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  8012f9:	00 00 00 
+  8012fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801301:	49 b9 43 2c 80 00 00 	movabs $0x802c43,%r9
+  801308:	00 00 00 
+  80130b:	41 ff d1             	call   *%r9
+
+000000000080130e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80130e:	55                   	push   %rbp
+  80130f:	48 89 e5             	mov    %rsp,%rbp
+  801312:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801313:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801318:	ba 00 00 00 00       	mov    $0x0,%edx
+  80131d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801322:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801327:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80132c:	be 00 00 00 00       	mov    $0x0,%esi
+  801331:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801337:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801339:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80133d:	c9                   	leave
+  80133e:	c3                   	ret
+
+000000000080133f <sys_yield>:
+
+void
+sys_yield(void) {
+  80133f:	55                   	push   %rbp
+  801340:	48 89 e5             	mov    %rsp,%rbp
+  801343:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801344:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801349:	ba 00 00 00 00       	mov    $0x0,%edx
+  80134e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801353:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801358:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80135d:	be 00 00 00 00       	mov    $0x0,%esi
+  801362:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801368:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80136a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80136e:	c9                   	leave
+  80136f:	c3                   	ret
+
+0000000000801370 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801370:	55                   	push   %rbp
+  801371:	48 89 e5             	mov    %rsp,%rbp
+  801374:	53                   	push   %rbx
+  801375:	48 89 fa             	mov    %rdi,%rdx
+  801378:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80137b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801380:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801387:	00 00 00 
+  80138a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80138f:	be 00 00 00 00       	mov    $0x0,%esi
+  801394:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80139a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80139c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a0:	c9                   	leave
+  8013a1:	c3                   	ret
+
+00000000008013a2 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013a2:	55                   	push   %rbp
+  8013a3:	48 89 e5             	mov    %rsp,%rbp
+  8013a6:	53                   	push   %rbx
+  8013a7:	49 89 f8             	mov    %rdi,%r8
+  8013aa:	48 89 d3             	mov    %rdx,%rbx
+  8013ad:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013b0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013b5:	4c 89 c2             	mov    %r8,%rdx
+  8013b8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013cc:	c9                   	leave
+  8013cd:	c3                   	ret
+
+00000000008013ce <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013ce:	55                   	push   %rbp
+  8013cf:	48 89 e5             	mov    %rsp,%rbp
+  8013d2:	53                   	push   %rbx
+  8013d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d7:	89 f8                	mov    %edi,%eax
+  8013d9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8013dc:	48 63 f9             	movslq %ecx,%rdi
+  8013df:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013e2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013e7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013f7:	48 85 c0             	test   %rax,%rax
+  8013fa:	7f 06                	jg     801402 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801400:	c9                   	leave
+  801401:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801402:	49 89 c0             	mov    %rax,%r8
+  801405:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80140a:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  801411:	00 00 00 
+  801414:	be 26 00 00 00       	mov    $0x26,%esi
+  801419:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  801420:	00 00 00 
+  801423:	b8 00 00 00 00       	mov    $0x0,%eax
+  801428:	49 b9 43 2c 80 00 00 	movabs $0x802c43,%r9
+  80142f:	00 00 00 
+  801432:	41 ff d1             	call   *%r9
+
+0000000000801435 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801435:	55                   	push   %rbp
+  801436:	48 89 e5             	mov    %rsp,%rbp
+  801439:	53                   	push   %rbx
+  80143a:	48 83 ec 08          	sub    $0x8,%rsp
+  80143e:	89 f8                	mov    %edi,%eax
+  801440:	49 89 f2             	mov    %rsi,%r10
+  801443:	48 89 cf             	mov    %rcx,%rdi
+  801446:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801449:	48 63 da             	movslq %edx,%rbx
+  80144c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80144f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801454:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801457:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80145a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80145c:	48 85 c0             	test   %rax,%rax
+  80145f:	7f 06                	jg     801467 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801461:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801465:	c9                   	leave
+  801466:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801467:	49 89 c0             	mov    %rax,%r8
+  80146a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80146f:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  801476:	00 00 00 
+  801479:	be 26 00 00 00       	mov    $0x26,%esi
+  80147e:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  801485:	00 00 00 
+  801488:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148d:	49 b9 43 2c 80 00 00 	movabs $0x802c43,%r9
+  801494:	00 00 00 
+  801497:	41 ff d1             	call   *%r9
+
+000000000080149a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80149a:	55                   	push   %rbp
+  80149b:	48 89 e5             	mov    %rsp,%rbp
+  80149e:	53                   	push   %rbx
+  80149f:	48 83 ec 08          	sub    $0x8,%rsp
+  8014a3:	48 89 f1             	mov    %rsi,%rcx
+  8014a6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014a9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ac:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c3:	48 85 c0             	test   %rax,%rax
+  8014c6:	7f 06                	jg     8014ce <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014cc:	c9                   	leave
+  8014cd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ce:	49 89 c0             	mov    %rax,%r8
+  8014d1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014d6:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  8014dd:	00 00 00 
+  8014e0:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e5:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  8014ec:	00 00 00 
+  8014ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f4:	49 b9 43 2c 80 00 00 	movabs $0x802c43,%r9
+  8014fb:	00 00 00 
+  8014fe:	41 ff d1             	call   *%r9
+
+0000000000801501 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	53                   	push   %rbx
+  801506:	48 83 ec 08          	sub    $0x8,%rsp
+  80150a:	89 f8                	mov    %edi,%eax
+  80150c:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  80150f:	48 63 f9             	movslq %ecx,%rdi
+  801512:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801515:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80151a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80151d:	be 00 00 00 00       	mov    $0x0,%esi
+  801522:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801528:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80152a:	48 85 c0             	test   %rax,%rax
+  80152d:	7f 06                	jg     801535 <sys_region_advise+0x34>
+}
+  80152f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801533:	c9                   	leave
+  801534:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801535:	49 89 c0             	mov    %rax,%r8
+  801538:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80153d:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  801544:	00 00 00 
+  801547:	be 26 00 00 00       	mov    $0x26,%esi
+  80154c:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  801553:	00 00 00 
+  801556:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155b:	49 b9 43 2c 80 00 00 	movabs $0x802c43,%r9
+  801562:	00 00 00 
+  801565:	41 ff d1             	call   *%r9
+
+0000000000801568 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801568:	55                   	push   %rbp
+  801569:	48 89 e5             	mov    %rsp,%rbp
+  80156c:	53                   	push   %rbx
+  80156d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801571:	48 63 ce             	movslq %esi,%rcx
+  801574:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801577:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80157c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801581:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801586:	be 00 00 00 00       	mov    $0x0,%esi
+  80158b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801591:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801593:	48 85 c0             	test   %rax,%rax
+  801596:	7f 06                	jg     80159e <sys_env_set_nice+0x36>
+}
+  801598:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159c:	c9                   	leave
+  80159d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80159e:	49 89 c0             	mov    %rax,%r8
+  8015a1:	b9 15 00 00 00       	mov    $0x15,%ecx
+  8015a6:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  8015ad:	00 00 00 
+  8015b0:	be 26 00 00 00       	mov    $0x26,%esi
+  8015b5:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  8015bc:	00 00 00 
+  8015bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c4:	49 b9 43 2c 80 00 00 	movabs $0x802c43,%r9
+  8015cb:	00 00 00 
+  8015ce:	41 ff d1             	call   *%r9
+
+00000000008015d1 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8015d1:	55                   	push   %rbp
+  8015d2:	48 89 e5             	mov    %rsp,%rbp
+  8015d5:	53                   	push   %rbx
+  8015d6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8015da:	48 63 ce             	movslq %esi,%rcx
+  8015dd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e0:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015fa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015fc:	48 85 c0             	test   %rax,%rax
+  8015ff:	7f 06                	jg     801607 <sys_env_set_status+0x36>
+}
+  801601:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801605:	c9                   	leave
+  801606:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801607:	49 89 c0             	mov    %rax,%r8
+  80160a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80160f:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  801616:	00 00 00 
+  801619:	be 26 00 00 00       	mov    $0x26,%esi
+  80161e:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  801625:	00 00 00 
+  801628:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162d:	49 b9 43 2c 80 00 00 	movabs $0x802c43,%r9
+  801634:	00 00 00 
+  801637:	41 ff d1             	call   *%r9
+
+000000000080163a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80163a:	55                   	push   %rbp
+  80163b:	48 89 e5             	mov    %rsp,%rbp
+  80163e:	53                   	push   %rbx
+  80163f:	48 83 ec 08          	sub    $0x8,%rsp
+  801643:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801646:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801649:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80164e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801653:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801658:	be 00 00 00 00       	mov    $0x0,%esi
+  80165d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801663:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801665:	48 85 c0             	test   %rax,%rax
+  801668:	7f 06                	jg     801670 <sys_env_set_trapframe+0x36>
+}
+  80166a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80166e:	c9                   	leave
+  80166f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801670:	49 89 c0             	mov    %rax,%r8
+  801673:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801678:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  80167f:	00 00 00 
+  801682:	be 26 00 00 00       	mov    $0x26,%esi
+  801687:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  80168e:	00 00 00 
+  801691:	b8 00 00 00 00       	mov    $0x0,%eax
+  801696:	49 b9 43 2c 80 00 00 	movabs $0x802c43,%r9
+  80169d:	00 00 00 
+  8016a0:	41 ff d1             	call   *%r9
+
+00000000008016a3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8016a3:	55                   	push   %rbp
+  8016a4:	48 89 e5             	mov    %rsp,%rbp
+  8016a7:	53                   	push   %rbx
+  8016a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ac:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8016af:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016b2:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016ce:	48 85 c0             	test   %rax,%rax
+  8016d1:	7f 06                	jg     8016d9 <sys_env_set_pgfault_upcall+0x36>
+}
+  8016d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d7:	c9                   	leave
+  8016d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016d9:	49 89 c0             	mov    %rax,%r8
+  8016dc:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8016e1:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  8016e8:	00 00 00 
+  8016eb:	be 26 00 00 00       	mov    $0x26,%esi
+  8016f0:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  8016f7:	00 00 00 
+  8016fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ff:	49 b9 43 2c 80 00 00 	movabs $0x802c43,%r9
+  801706:	00 00 00 
+  801709:	41 ff d1             	call   *%r9
+
+000000000080170c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80170c:	55                   	push   %rbp
+  80170d:	48 89 e5             	mov    %rsp,%rbp
+  801710:	53                   	push   %rbx
+  801711:	89 f8                	mov    %edi,%eax
+  801713:	49 89 f1             	mov    %rsi,%r9
+  801716:	48 89 d3             	mov    %rdx,%rbx
+  801719:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80171c:	49 63 f0             	movslq %r8d,%rsi
+  80171f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801722:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801727:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80172a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801730:	cd 30                	int    $0x30
+}
+  801732:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801736:	c9                   	leave
+  801737:	c3                   	ret
+
+0000000000801738 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801738:	55                   	push   %rbp
+  801739:	48 89 e5             	mov    %rsp,%rbp
+  80173c:	53                   	push   %rbx
+  80173d:	48 83 ec 08          	sub    $0x8,%rsp
+  801741:	48 89 fa             	mov    %rdi,%rdx
+  801744:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801747:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80174c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801751:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801756:	be 00 00 00 00       	mov    $0x0,%esi
+  80175b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801761:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801763:	48 85 c0             	test   %rax,%rax
+  801766:	7f 06                	jg     80176e <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801768:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80176c:	c9                   	leave
+  80176d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80176e:	49 89 c0             	mov    %rax,%r8
+  801771:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801776:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  80177d:	00 00 00 
+  801780:	be 26 00 00 00       	mov    $0x26,%esi
+  801785:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  80178c:	00 00 00 
+  80178f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801794:	49 b9 43 2c 80 00 00 	movabs $0x802c43,%r9
+  80179b:	00 00 00 
+  80179e:	41 ff d1             	call   *%r9
+
+00000000008017a1 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8017a1:	55                   	push   %rbp
+  8017a2:	48 89 e5             	mov    %rsp,%rbp
+  8017a5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a6:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ca:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017d0:	c9                   	leave
+  8017d1:	c3                   	ret
+
+00000000008017d2 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8017d2:	55                   	push   %rbp
+  8017d3:	48 89 e5             	mov    %rsp,%rbp
+  8017d6:	53                   	push   %rbx
+  8017d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8017db:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8017de:	48 63 ce             	movslq %esi,%rcx
+  8017e1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e4:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017fb:	48 85 c0             	test   %rax,%rax
+  8017fe:	7f 06                	jg     801806 <sys_sigqueue+0x34>
+}
+  801800:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801804:	c9                   	leave
+  801805:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801806:	49 89 c0             	mov    %rax,%r8
+  801809:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80180e:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  801815:	00 00 00 
+  801818:	be 26 00 00 00       	mov    $0x26,%esi
+  80181d:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  801824:	00 00 00 
+  801827:	b8 00 00 00 00       	mov    $0x0,%eax
+  80182c:	49 b9 43 2c 80 00 00 	movabs $0x802c43,%r9
+  801833:	00 00 00 
+  801836:	41 ff d1             	call   *%r9
+
+0000000000801839 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801839:	55                   	push   %rbp
+  80183a:	48 89 e5             	mov    %rsp,%rbp
+  80183d:	53                   	push   %rbx
+  80183e:	48 83 ec 08          	sub    $0x8,%rsp
+  801842:	48 89 fa             	mov    %rdi,%rdx
+  801845:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801848:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80184d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801852:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801857:	be 00 00 00 00       	mov    $0x0,%esi
+  80185c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801862:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801864:	48 85 c0             	test   %rax,%rax
+  801867:	7f 06                	jg     80186f <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801869:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80186d:	c9                   	leave
+  80186e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80186f:	49 89 c0             	mov    %rax,%r8
+  801872:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801877:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  80187e:	00 00 00 
+  801881:	be 26 00 00 00       	mov    $0x26,%esi
+  801886:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  80188d:	00 00 00 
+  801890:	b8 00 00 00 00       	mov    $0x0,%eax
+  801895:	49 b9 43 2c 80 00 00 	movabs $0x802c43,%r9
+  80189c:	00 00 00 
+  80189f:	41 ff d1             	call   *%r9
+
+00000000008018a2 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  8018a2:	55                   	push   %rbp
+  8018a3:	48 89 e5             	mov    %rsp,%rbp
+  8018a6:	53                   	push   %rbx
+  8018a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8018ab:	48 89 f1             	mov    %rsi,%rcx
+  8018ae:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  8018b1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018b4:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018be:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018c9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018cb:	48 85 c0             	test   %rax,%rax
+  8018ce:	7f 06                	jg     8018d6 <sys_sigaction+0x34>
+}
+  8018d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018d4:	c9                   	leave
+  8018d5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018d6:	49 89 c0             	mov    %rax,%r8
+  8018d9:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8018de:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  8018e5:	00 00 00 
+  8018e8:	be 26 00 00 00       	mov    $0x26,%esi
+  8018ed:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  8018f4:	00 00 00 
+  8018f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018fc:	49 b9 43 2c 80 00 00 	movabs $0x802c43,%r9
+  801903:	00 00 00 
+  801906:	41 ff d1             	call   *%r9
+
+0000000000801909 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801909:	55                   	push   %rbp
+  80190a:	48 89 e5             	mov    %rsp,%rbp
+  80190d:	53                   	push   %rbx
+  80190e:	48 83 ec 08          	sub    $0x8,%rsp
+  801912:	48 89 f1             	mov    %rsi,%rcx
+  801915:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801918:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80191b:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801920:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801925:	be 00 00 00 00       	mov    $0x0,%esi
+  80192a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801930:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801932:	48 85 c0             	test   %rax,%rax
+  801935:	7f 06                	jg     80193d <sys_sigprocmask+0x34>
+}
+  801937:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80193b:	c9                   	leave
+  80193c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80193d:	49 89 c0             	mov    %rax,%r8
+  801940:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801945:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  80194c:	00 00 00 
+  80194f:	be 26 00 00 00       	mov    $0x26,%esi
+  801954:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  80195b:	00 00 00 
+  80195e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801963:	49 b9 43 2c 80 00 00 	movabs $0x802c43,%r9
+  80196a:	00 00 00 
+  80196d:	41 ff d1             	call   *%r9
+
+0000000000801970 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801970:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801977:	ff ff ff 
+  80197a:	48 01 f8             	add    %rdi,%rax
+  80197d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801981:	c3                   	ret
+
+0000000000801982 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801982:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801989:	ff ff ff 
+  80198c:	48 01 f8             	add    %rdi,%rax
+  80198f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801993:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801999:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80199d:	c3                   	ret
+
+000000000080199e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80199e:	55                   	push   %rbp
+  80199f:	48 89 e5             	mov    %rsp,%rbp
+  8019a2:	41 57                	push   %r15
+  8019a4:	41 56                	push   %r14
+  8019a6:	41 55                	push   %r13
+  8019a8:	41 54                	push   %r12
+  8019aa:	53                   	push   %rbx
+  8019ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8019af:	49 89 ff             	mov    %rdi,%r15
+  8019b2:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019b7:	49 bd 1c 29 80 00 00 	movabs $0x80291c,%r13
+  8019be:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8019c1:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8019c7:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8019ca:	48 89 df             	mov    %rbx,%rdi
+  8019cd:	41 ff d5             	call   *%r13
+  8019d0:	83 e0 04             	and    $0x4,%eax
+  8019d3:	74 17                	je     8019ec <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8019d5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8019dc:	4c 39 f3             	cmp    %r14,%rbx
+  8019df:	75 e6                	jne    8019c7 <fd_alloc+0x29>
+  8019e1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8019e7:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8019ec:	4d 89 27             	mov    %r12,(%r15)
+}
+  8019ef:	48 83 c4 08          	add    $0x8,%rsp
+  8019f3:	5b                   	pop    %rbx
+  8019f4:	41 5c                	pop    %r12
+  8019f6:	41 5d                	pop    %r13
+  8019f8:	41 5e                	pop    %r14
+  8019fa:	41 5f                	pop    %r15
+  8019fc:	5d                   	pop    %rbp
+  8019fd:	c3                   	ret
+
+00000000008019fe <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8019fe:	83 ff 1f             	cmp    $0x1f,%edi
+  801a01:	77 39                	ja     801a3c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a03:	55                   	push   %rbp
+  801a04:	48 89 e5             	mov    %rsp,%rbp
+  801a07:	41 54                	push   %r12
+  801a09:	53                   	push   %rbx
+  801a0a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a0d:	48 63 df             	movslq %edi,%rbx
+  801a10:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a17:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a1b:	48 89 df             	mov    %rbx,%rdi
+  801a1e:	48 b8 1c 29 80 00 00 	movabs $0x80291c,%rax
+  801a25:	00 00 00 
+  801a28:	ff d0                	call   *%rax
+  801a2a:	a8 04                	test   $0x4,%al
+  801a2c:	74 14                	je     801a42 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a2e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a37:	5b                   	pop    %rbx
+  801a38:	41 5c                	pop    %r12
+  801a3a:	5d                   	pop    %rbp
+  801a3b:	c3                   	ret
+        return -E_INVAL;
+  801a3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a41:	c3                   	ret
+        return -E_INVAL;
+  801a42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a47:	eb ee                	jmp    801a37 <fd_lookup+0x39>
+
+0000000000801a49 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a49:	55                   	push   %rbp
+  801a4a:	48 89 e5             	mov    %rsp,%rbp
+  801a4d:	41 54                	push   %r12
+  801a4f:	53                   	push   %rbx
+  801a50:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a53:	48 b8 a0 34 80 00 00 	movabs $0x8034a0,%rax
+  801a5a:	00 00 00 
+  801a5d:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801a64:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a67:	39 3b                	cmp    %edi,(%rbx)
+  801a69:	74 47                	je     801ab2 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a6b:	48 83 c0 08          	add    $0x8,%rax
+  801a6f:	48 8b 18             	mov    (%rax),%rbx
+  801a72:	48 85 db             	test   %rbx,%rbx
+  801a75:	75 f0                	jne    801a67 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a77:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a7e:	00 00 00 
+  801a81:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a87:	89 fa                	mov    %edi,%edx
+  801a89:	48 bf 20 34 80 00 00 	movabs $0x803420,%rdi
+  801a90:	00 00 00 
+  801a93:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a98:	48 b9 f9 04 80 00 00 	movabs $0x8004f9,%rcx
+  801a9f:	00 00 00 
+  801aa2:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801aa4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801aa9:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801aad:	5b                   	pop    %rbx
+  801aae:	41 5c                	pop    %r12
+  801ab0:	5d                   	pop    %rbp
+  801ab1:	c3                   	ret
+            return 0;
+  801ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab7:	eb f0                	jmp    801aa9 <dev_lookup+0x60>
+
+0000000000801ab9 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ab9:	55                   	push   %rbp
+  801aba:	48 89 e5             	mov    %rsp,%rbp
+  801abd:	41 55                	push   %r13
+  801abf:	41 54                	push   %r12
+  801ac1:	53                   	push   %rbx
+  801ac2:	48 83 ec 18          	sub    $0x18,%rsp
+  801ac6:	48 89 fb             	mov    %rdi,%rbx
+  801ac9:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801acc:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801ad3:	ff ff ff 
+  801ad6:	48 01 df             	add    %rbx,%rdi
+  801ad9:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801add:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ae1:	48 b8 fe 19 80 00 00 	movabs $0x8019fe,%rax
+  801ae8:	00 00 00 
+  801aeb:	ff d0                	call   *%rax
+  801aed:	41 89 c5             	mov    %eax,%r13d
+  801af0:	85 c0                	test   %eax,%eax
+  801af2:	78 06                	js     801afa <fd_close+0x41>
+  801af4:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801af8:	74 1a                	je     801b14 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801afa:	45 84 e4             	test   %r12b,%r12b
+  801afd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b02:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b06:	44 89 e8             	mov    %r13d,%eax
+  801b09:	48 83 c4 18          	add    $0x18,%rsp
+  801b0d:	5b                   	pop    %rbx
+  801b0e:	41 5c                	pop    %r12
+  801b10:	41 5d                	pop    %r13
+  801b12:	5d                   	pop    %rbp
+  801b13:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b14:	8b 3b                	mov    (%rbx),%edi
+  801b16:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b1a:	48 b8 49 1a 80 00 00 	movabs $0x801a49,%rax
+  801b21:	00 00 00 
+  801b24:	ff d0                	call   *%rax
+  801b26:	41 89 c5             	mov    %eax,%r13d
+  801b29:	85 c0                	test   %eax,%eax
+  801b2b:	78 1b                	js     801b48 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b2d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b31:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b35:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b3b:	48 85 c0             	test   %rax,%rax
+  801b3e:	74 08                	je     801b48 <fd_close+0x8f>
+  801b40:	48 89 df             	mov    %rbx,%rdi
+  801b43:	ff d0                	call   *%rax
+  801b45:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b48:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b4d:	48 89 de             	mov    %rbx,%rsi
+  801b50:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b55:	48 b8 9a 14 80 00 00 	movabs $0x80149a,%rax
+  801b5c:	00 00 00 
+  801b5f:	ff d0                	call   *%rax
+    return res;
+  801b61:	eb a3                	jmp    801b06 <fd_close+0x4d>
+
+0000000000801b63 <close>:
+
+int
+close(int fdnum) {
+  801b63:	55                   	push   %rbp
+  801b64:	48 89 e5             	mov    %rsp,%rbp
+  801b67:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b6b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b6f:	48 b8 fe 19 80 00 00 	movabs $0x8019fe,%rax
+  801b76:	00 00 00 
+  801b79:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b7b:	85 c0                	test   %eax,%eax
+  801b7d:	78 15                	js     801b94 <close+0x31>
+
+    return fd_close(fd, 1);
+  801b7f:	be 01 00 00 00       	mov    $0x1,%esi
+  801b84:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b88:	48 b8 b9 1a 80 00 00 	movabs $0x801ab9,%rax
+  801b8f:	00 00 00 
+  801b92:	ff d0                	call   *%rax
+}
+  801b94:	c9                   	leave
+  801b95:	c3                   	ret
+
+0000000000801b96 <close_all>:
+
+void
+close_all(void) {
+  801b96:	55                   	push   %rbp
+  801b97:	48 89 e5             	mov    %rsp,%rbp
+  801b9a:	41 54                	push   %r12
+  801b9c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ba2:	49 bc 63 1b 80 00 00 	movabs $0x801b63,%r12
+  801ba9:	00 00 00 
+  801bac:	89 df                	mov    %ebx,%edi
+  801bae:	41 ff d4             	call   *%r12
+  801bb1:	83 c3 01             	add    $0x1,%ebx
+  801bb4:	83 fb 20             	cmp    $0x20,%ebx
+  801bb7:	75 f3                	jne    801bac <close_all+0x16>
+}
+  801bb9:	5b                   	pop    %rbx
+  801bba:	41 5c                	pop    %r12
+  801bbc:	5d                   	pop    %rbp
+  801bbd:	c3                   	ret
+
+0000000000801bbe <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801bbe:	55                   	push   %rbp
+  801bbf:	48 89 e5             	mov    %rsp,%rbp
+  801bc2:	41 57                	push   %r15
+  801bc4:	41 56                	push   %r14
+  801bc6:	41 55                	push   %r13
+  801bc8:	41 54                	push   %r12
+  801bca:	53                   	push   %rbx
+  801bcb:	48 83 ec 18          	sub    $0x18,%rsp
+  801bcf:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801bd2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801bd6:	48 b8 fe 19 80 00 00 	movabs $0x8019fe,%rax
+  801bdd:	00 00 00 
+  801be0:	ff d0                	call   *%rax
+  801be2:	89 c3                	mov    %eax,%ebx
+  801be4:	85 c0                	test   %eax,%eax
+  801be6:	0f 88 b8 00 00 00    	js     801ca4 <dup+0xe6>
+    close(newfdnum);
+  801bec:	44 89 e7             	mov    %r12d,%edi
+  801bef:	48 b8 63 1b 80 00 00 	movabs $0x801b63,%rax
+  801bf6:	00 00 00 
+  801bf9:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801bfb:	4d 63 ec             	movslq %r12d,%r13
+  801bfe:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c05:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c09:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c0d:	4c 89 ff             	mov    %r15,%rdi
+  801c10:	49 be 82 19 80 00 00 	movabs $0x801982,%r14
+  801c17:	00 00 00 
+  801c1a:	41 ff d6             	call   *%r14
+  801c1d:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c20:	4c 89 ef             	mov    %r13,%rdi
+  801c23:	41 ff d6             	call   *%r14
+  801c26:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c29:	48 89 df             	mov    %rbx,%rdi
+  801c2c:	48 b8 1c 29 80 00 00 	movabs $0x80291c,%rax
+  801c33:	00 00 00 
+  801c36:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c38:	a8 04                	test   $0x4,%al
+  801c3a:	74 2b                	je     801c67 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c3c:	41 89 c1             	mov    %eax,%r9d
+  801c3f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c45:	4c 89 f1             	mov    %r14,%rcx
+  801c48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c4d:	48 89 de             	mov    %rbx,%rsi
+  801c50:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c55:	48 b8 35 14 80 00 00 	movabs $0x801435,%rax
+  801c5c:	00 00 00 
+  801c5f:	ff d0                	call   *%rax
+  801c61:	89 c3                	mov    %eax,%ebx
+  801c63:	85 c0                	test   %eax,%eax
+  801c65:	78 4e                	js     801cb5 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c67:	4c 89 ff             	mov    %r15,%rdi
+  801c6a:	48 b8 1c 29 80 00 00 	movabs $0x80291c,%rax
+  801c71:	00 00 00 
+  801c74:	ff d0                	call   *%rax
+  801c76:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c79:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c7f:	4c 89 e9             	mov    %r13,%rcx
+  801c82:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c87:	4c 89 fe             	mov    %r15,%rsi
+  801c8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c8f:	48 b8 35 14 80 00 00 	movabs $0x801435,%rax
+  801c96:	00 00 00 
+  801c99:	ff d0                	call   *%rax
+  801c9b:	89 c3                	mov    %eax,%ebx
+  801c9d:	85 c0                	test   %eax,%eax
+  801c9f:	78 14                	js     801cb5 <dup+0xf7>
+
+    return newfdnum;
+  801ca1:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ca4:	89 d8                	mov    %ebx,%eax
+  801ca6:	48 83 c4 18          	add    $0x18,%rsp
+  801caa:	5b                   	pop    %rbx
+  801cab:	41 5c                	pop    %r12
+  801cad:	41 5d                	pop    %r13
+  801caf:	41 5e                	pop    %r14
+  801cb1:	41 5f                	pop    %r15
+  801cb3:	5d                   	pop    %rbp
+  801cb4:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801cb5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cba:	4c 89 ee             	mov    %r13,%rsi
+  801cbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc2:	49 bc 9a 14 80 00 00 	movabs $0x80149a,%r12
+  801cc9:	00 00 00 
+  801ccc:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801ccf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cd4:	4c 89 f6             	mov    %r14,%rsi
+  801cd7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cdc:	41 ff d4             	call   *%r12
+    return res;
+  801cdf:	eb c3                	jmp    801ca4 <dup+0xe6>
+
+0000000000801ce1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801ce1:	55                   	push   %rbp
+  801ce2:	48 89 e5             	mov    %rsp,%rbp
+  801ce5:	41 56                	push   %r14
+  801ce7:	41 55                	push   %r13
+  801ce9:	41 54                	push   %r12
+  801ceb:	53                   	push   %rbx
+  801cec:	48 83 ec 10          	sub    $0x10,%rsp
+  801cf0:	89 fb                	mov    %edi,%ebx
+  801cf2:	49 89 f4             	mov    %rsi,%r12
+  801cf5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cf8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cfc:	48 b8 fe 19 80 00 00 	movabs $0x8019fe,%rax
+  801d03:	00 00 00 
+  801d06:	ff d0                	call   *%rax
+  801d08:	85 c0                	test   %eax,%eax
+  801d0a:	78 4c                	js     801d58 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d0c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d10:	41 8b 3e             	mov    (%r14),%edi
+  801d13:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d17:	48 b8 49 1a 80 00 00 	movabs $0x801a49,%rax
+  801d1e:	00 00 00 
+  801d21:	ff d0                	call   *%rax
+  801d23:	85 c0                	test   %eax,%eax
+  801d25:	78 35                	js     801d5c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d27:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d2b:	83 e0 03             	and    $0x3,%eax
+  801d2e:	83 f8 01             	cmp    $0x1,%eax
+  801d31:	74 2d                	je     801d60 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d33:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d37:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d3b:	48 85 c0             	test   %rax,%rax
+  801d3e:	74 56                	je     801d96 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d40:	4c 89 ea             	mov    %r13,%rdx
+  801d43:	4c 89 e6             	mov    %r12,%rsi
+  801d46:	4c 89 f7             	mov    %r14,%rdi
+  801d49:	ff d0                	call   *%rax
+}
+  801d4b:	48 83 c4 10          	add    $0x10,%rsp
+  801d4f:	5b                   	pop    %rbx
+  801d50:	41 5c                	pop    %r12
+  801d52:	41 5d                	pop    %r13
+  801d54:	41 5e                	pop    %r14
+  801d56:	5d                   	pop    %rbp
+  801d57:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d58:	48 98                	cltq
+  801d5a:	eb ef                	jmp    801d4b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d5c:	48 98                	cltq
+  801d5e:	eb eb                	jmp    801d4b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d60:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d67:	00 00 00 
+  801d6a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d70:	89 da                	mov    %ebx,%edx
+  801d72:	48 bf 61 34 80 00 00 	movabs $0x803461,%rdi
+  801d79:	00 00 00 
+  801d7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d81:	48 b9 f9 04 80 00 00 	movabs $0x8004f9,%rcx
+  801d88:	00 00 00 
+  801d8b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d8d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d94:	eb b5                	jmp    801d4b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d96:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d9d:	eb ac                	jmp    801d4b <read+0x6a>
+
+0000000000801d9f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d9f:	55                   	push   %rbp
+  801da0:	48 89 e5             	mov    %rsp,%rbp
+  801da3:	41 57                	push   %r15
+  801da5:	41 56                	push   %r14
+  801da7:	41 55                	push   %r13
+  801da9:	41 54                	push   %r12
+  801dab:	53                   	push   %rbx
+  801dac:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801db0:	48 85 d2             	test   %rdx,%rdx
+  801db3:	74 54                	je     801e09 <readn+0x6a>
+  801db5:	41 89 fd             	mov    %edi,%r13d
+  801db8:	49 89 f6             	mov    %rsi,%r14
+  801dbb:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801dbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801dc3:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801dc8:	49 bf e1 1c 80 00 00 	movabs $0x801ce1,%r15
+  801dcf:	00 00 00 
+  801dd2:	4c 89 e2             	mov    %r12,%rdx
+  801dd5:	48 29 f2             	sub    %rsi,%rdx
+  801dd8:	4c 01 f6             	add    %r14,%rsi
+  801ddb:	44 89 ef             	mov    %r13d,%edi
+  801dde:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801de1:	85 c0                	test   %eax,%eax
+  801de3:	78 20                	js     801e05 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801de5:	01 c3                	add    %eax,%ebx
+  801de7:	85 c0                	test   %eax,%eax
+  801de9:	74 08                	je     801df3 <readn+0x54>
+  801deb:	48 63 f3             	movslq %ebx,%rsi
+  801dee:	4c 39 e6             	cmp    %r12,%rsi
+  801df1:	72 df                	jb     801dd2 <readn+0x33>
+    }
+    return res;
+  801df3:	48 63 c3             	movslq %ebx,%rax
+}
+  801df6:	48 83 c4 08          	add    $0x8,%rsp
+  801dfa:	5b                   	pop    %rbx
+  801dfb:	41 5c                	pop    %r12
+  801dfd:	41 5d                	pop    %r13
+  801dff:	41 5e                	pop    %r14
+  801e01:	41 5f                	pop    %r15
+  801e03:	5d                   	pop    %rbp
+  801e04:	c3                   	ret
+        if (inc < 0) return inc;
+  801e05:	48 98                	cltq
+  801e07:	eb ed                	jmp    801df6 <readn+0x57>
+    int inc = 1, res = 0;
+  801e09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e0e:	eb e3                	jmp    801df3 <readn+0x54>
+
+0000000000801e10 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e10:	55                   	push   %rbp
+  801e11:	48 89 e5             	mov    %rsp,%rbp
+  801e14:	41 56                	push   %r14
+  801e16:	41 55                	push   %r13
+  801e18:	41 54                	push   %r12
+  801e1a:	53                   	push   %rbx
+  801e1b:	48 83 ec 10          	sub    $0x10,%rsp
+  801e1f:	89 fb                	mov    %edi,%ebx
+  801e21:	49 89 f4             	mov    %rsi,%r12
+  801e24:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e27:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e2b:	48 b8 fe 19 80 00 00 	movabs $0x8019fe,%rax
+  801e32:	00 00 00 
+  801e35:	ff d0                	call   *%rax
+  801e37:	85 c0                	test   %eax,%eax
+  801e39:	78 47                	js     801e82 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e3b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e3f:	41 8b 3e             	mov    (%r14),%edi
+  801e42:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e46:	48 b8 49 1a 80 00 00 	movabs $0x801a49,%rax
+  801e4d:	00 00 00 
+  801e50:	ff d0                	call   *%rax
+  801e52:	85 c0                	test   %eax,%eax
+  801e54:	78 30                	js     801e86 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e56:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e5b:	74 2d                	je     801e8a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e5d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e61:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e65:	48 85 c0             	test   %rax,%rax
+  801e68:	74 56                	je     801ec0 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e6a:	4c 89 ea             	mov    %r13,%rdx
+  801e6d:	4c 89 e6             	mov    %r12,%rsi
+  801e70:	4c 89 f7             	mov    %r14,%rdi
+  801e73:	ff d0                	call   *%rax
+}
+  801e75:	48 83 c4 10          	add    $0x10,%rsp
+  801e79:	5b                   	pop    %rbx
+  801e7a:	41 5c                	pop    %r12
+  801e7c:	41 5d                	pop    %r13
+  801e7e:	41 5e                	pop    %r14
+  801e80:	5d                   	pop    %rbp
+  801e81:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e82:	48 98                	cltq
+  801e84:	eb ef                	jmp    801e75 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e86:	48 98                	cltq
+  801e88:	eb eb                	jmp    801e75 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e8a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e91:	00 00 00 
+  801e94:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e9a:	89 da                	mov    %ebx,%edx
+  801e9c:	48 bf 7d 34 80 00 00 	movabs $0x80347d,%rdi
+  801ea3:	00 00 00 
+  801ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eab:	48 b9 f9 04 80 00 00 	movabs $0x8004f9,%rcx
+  801eb2:	00 00 00 
+  801eb5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801eb7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ebe:	eb b5                	jmp    801e75 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ec0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ec7:	eb ac                	jmp    801e75 <write+0x65>
+
+0000000000801ec9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ec9:	55                   	push   %rbp
+  801eca:	48 89 e5             	mov    %rsp,%rbp
+  801ecd:	53                   	push   %rbx
+  801ece:	48 83 ec 18          	sub    $0x18,%rsp
+  801ed2:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ed4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ed8:	48 b8 fe 19 80 00 00 	movabs $0x8019fe,%rax
+  801edf:	00 00 00 
+  801ee2:	ff d0                	call   *%rax
+  801ee4:	85 c0                	test   %eax,%eax
+  801ee6:	78 0c                	js     801ef4 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801ee8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801eec:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801eef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ef4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ef8:	c9                   	leave
+  801ef9:	c3                   	ret
+
+0000000000801efa <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801efa:	55                   	push   %rbp
+  801efb:	48 89 e5             	mov    %rsp,%rbp
+  801efe:	41 55                	push   %r13
+  801f00:	41 54                	push   %r12
+  801f02:	53                   	push   %rbx
+  801f03:	48 83 ec 18          	sub    $0x18,%rsp
+  801f07:	89 fb                	mov    %edi,%ebx
+  801f09:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f0c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f10:	48 b8 fe 19 80 00 00 	movabs $0x8019fe,%rax
+  801f17:	00 00 00 
+  801f1a:	ff d0                	call   *%rax
+  801f1c:	85 c0                	test   %eax,%eax
+  801f1e:	78 38                	js     801f58 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f20:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f24:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f28:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f2c:	48 b8 49 1a 80 00 00 	movabs $0x801a49,%rax
+  801f33:	00 00 00 
+  801f36:	ff d0                	call   *%rax
+  801f38:	85 c0                	test   %eax,%eax
+  801f3a:	78 1c                	js     801f58 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f3c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f41:	74 20                	je     801f63 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f43:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f47:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f4b:	48 85 c0             	test   %rax,%rax
+  801f4e:	74 47                	je     801f97 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f50:	44 89 e6             	mov    %r12d,%esi
+  801f53:	4c 89 ef             	mov    %r13,%rdi
+  801f56:	ff d0                	call   *%rax
+}
+  801f58:	48 83 c4 18          	add    $0x18,%rsp
+  801f5c:	5b                   	pop    %rbx
+  801f5d:	41 5c                	pop    %r12
+  801f5f:	41 5d                	pop    %r13
+  801f61:	5d                   	pop    %rbp
+  801f62:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f63:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f6a:	00 00 00 
+  801f6d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f73:	89 da                	mov    %ebx,%edx
+  801f75:	48 bf 40 34 80 00 00 	movabs $0x803440,%rdi
+  801f7c:	00 00 00 
+  801f7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f84:	48 b9 f9 04 80 00 00 	movabs $0x8004f9,%rcx
+  801f8b:	00 00 00 
+  801f8e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f95:	eb c1                	jmp    801f58 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f97:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f9c:	eb ba                	jmp    801f58 <ftruncate+0x5e>
+
+0000000000801f9e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f9e:	55                   	push   %rbp
+  801f9f:	48 89 e5             	mov    %rsp,%rbp
+  801fa2:	41 54                	push   %r12
+  801fa4:	53                   	push   %rbx
+  801fa5:	48 83 ec 10          	sub    $0x10,%rsp
+  801fa9:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fac:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fb0:	48 b8 fe 19 80 00 00 	movabs $0x8019fe,%rax
+  801fb7:	00 00 00 
+  801fba:	ff d0                	call   *%rax
+  801fbc:	85 c0                	test   %eax,%eax
+  801fbe:	78 4e                	js     80200e <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fc0:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801fc4:	41 8b 3c 24          	mov    (%r12),%edi
+  801fc8:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801fcc:	48 b8 49 1a 80 00 00 	movabs $0x801a49,%rax
+  801fd3:	00 00 00 
+  801fd6:	ff d0                	call   *%rax
+  801fd8:	85 c0                	test   %eax,%eax
+  801fda:	78 32                	js     80200e <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fdc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801fe0:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801fe5:	74 30                	je     802017 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801fe7:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801fea:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801ff1:	00 00 00 
+    stat->st_isdir = 0;
+  801ff4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ffb:	00 00 00 
+    stat->st_dev = dev;
+  801ffe:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802005:	48 89 de             	mov    %rbx,%rsi
+  802008:	4c 89 e7             	mov    %r12,%rdi
+  80200b:	ff 50 28             	call   *0x28(%rax)
+}
+  80200e:	48 83 c4 10          	add    $0x10,%rsp
+  802012:	5b                   	pop    %rbx
+  802013:	41 5c                	pop    %r12
+  802015:	5d                   	pop    %rbp
+  802016:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802017:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80201c:	eb f0                	jmp    80200e <fstat+0x70>
+
+000000000080201e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80201e:	55                   	push   %rbp
+  80201f:	48 89 e5             	mov    %rsp,%rbp
+  802022:	41 54                	push   %r12
+  802024:	53                   	push   %rbx
+  802025:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802028:	be 00 00 00 00       	mov    $0x0,%esi
+  80202d:	48 b8 9f 22 80 00 00 	movabs $0x80229f,%rax
+  802034:	00 00 00 
+  802037:	ff d0                	call   *%rax
+  802039:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80203b:	85 c0                	test   %eax,%eax
+  80203d:	78 25                	js     802064 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80203f:	4c 89 e6             	mov    %r12,%rsi
+  802042:	89 c7                	mov    %eax,%edi
+  802044:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  80204b:	00 00 00 
+  80204e:	ff d0                	call   *%rax
+  802050:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802053:	89 df                	mov    %ebx,%edi
+  802055:	48 b8 63 1b 80 00 00 	movabs $0x801b63,%rax
+  80205c:	00 00 00 
+  80205f:	ff d0                	call   *%rax
+
+    return res;
+  802061:	44 89 e3             	mov    %r12d,%ebx
+}
+  802064:	89 d8                	mov    %ebx,%eax
+  802066:	5b                   	pop    %rbx
+  802067:	41 5c                	pop    %r12
+  802069:	5d                   	pop    %rbp
+  80206a:	c3                   	ret
+
+000000000080206b <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  80206b:	55                   	push   %rbp
+  80206c:	48 89 e5             	mov    %rsp,%rbp
+  80206f:	41 54                	push   %r12
+  802071:	53                   	push   %rbx
+  802072:	48 83 ec 10          	sub    $0x10,%rsp
+  802076:	41 89 fc             	mov    %edi,%r12d
+  802079:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80207c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802083:	00 00 00 
+  802086:	83 38 00             	cmpl   $0x0,(%rax)
+  802089:	74 5e                	je     8020e9 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80208b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802091:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802096:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80209d:	00 00 00 
+  8020a0:	44 89 e6             	mov    %r12d,%esi
+  8020a3:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020aa:	00 00 00 
+  8020ad:	8b 38                	mov    (%rax),%edi
+  8020af:	48 b8 7b 2d 80 00 00 	movabs $0x802d7b,%rax
+  8020b6:	00 00 00 
+  8020b9:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8020bb:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8020c2:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8020c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020c8:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8020cc:	48 89 de             	mov    %rbx,%rsi
+  8020cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020d4:	48 b8 e6 2c 80 00 00 	movabs $0x802ce6,%rax
+  8020db:	00 00 00 
+  8020de:	ff d0                	call   *%rax
+}
+  8020e0:	48 83 c4 10          	add    $0x10,%rsp
+  8020e4:	5b                   	pop    %rbx
+  8020e5:	41 5c                	pop    %r12
+  8020e7:	5d                   	pop    %rbp
+  8020e8:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020e9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020ee:	48 b8 1b 2e 80 00 00 	movabs $0x802e1b,%rax
+  8020f5:	00 00 00 
+  8020f8:	ff d0                	call   *%rax
+  8020fa:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802101:	00 00 
+  802103:	eb 86                	jmp    80208b <fsipc+0x20>
+
+0000000000802105 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802105:	55                   	push   %rbp
+  802106:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802109:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802110:	00 00 00 
+  802113:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802116:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802118:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80211b:	be 00 00 00 00       	mov    $0x0,%esi
+  802120:	bf 02 00 00 00       	mov    $0x2,%edi
+  802125:	48 b8 6b 20 80 00 00 	movabs $0x80206b,%rax
+  80212c:	00 00 00 
+  80212f:	ff d0                	call   *%rax
+}
+  802131:	5d                   	pop    %rbp
+  802132:	c3                   	ret
+
+0000000000802133 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802133:	55                   	push   %rbp
+  802134:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802137:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80213a:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802141:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802143:	be 00 00 00 00       	mov    $0x0,%esi
+  802148:	bf 06 00 00 00       	mov    $0x6,%edi
+  80214d:	48 b8 6b 20 80 00 00 	movabs $0x80206b,%rax
+  802154:	00 00 00 
+  802157:	ff d0                	call   *%rax
+}
+  802159:	5d                   	pop    %rbp
+  80215a:	c3                   	ret
+
+000000000080215b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80215b:	55                   	push   %rbp
+  80215c:	48 89 e5             	mov    %rsp,%rbp
+  80215f:	41 54                	push   %r12
+  802161:	53                   	push   %rbx
+  802162:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802165:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802168:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80216f:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802171:	be 00 00 00 00       	mov    $0x0,%esi
+  802176:	bf 05 00 00 00       	mov    $0x5,%edi
+  80217b:	48 b8 6b 20 80 00 00 	movabs $0x80206b,%rax
+  802182:	00 00 00 
+  802185:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802187:	85 c0                	test   %eax,%eax
+  802189:	78 3d                	js     8021c8 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80218b:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802192:	00 00 00 
+  802195:	4c 89 e6             	mov    %r12,%rsi
+  802198:	48 89 df             	mov    %rbx,%rdi
+  80219b:	48 b8 1e 0e 80 00 00 	movabs $0x800e1e,%rax
+  8021a2:	00 00 00 
+  8021a5:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8021a7:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8021ae:	00 
+  8021af:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021b5:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8021bc:	00 
+  8021bd:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8021c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021c8:	5b                   	pop    %rbx
+  8021c9:	41 5c                	pop    %r12
+  8021cb:	5d                   	pop    %rbp
+  8021cc:	c3                   	ret
+
+00000000008021cd <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8021cd:	55                   	push   %rbp
+  8021ce:	48 89 e5             	mov    %rsp,%rbp
+  8021d1:	41 54                	push   %r12
+  8021d3:	53                   	push   %rbx
+  8021d4:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8021d7:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8021dc:	48 39 c2             	cmp    %rax,%rdx
+  8021df:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8021e3:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8021e6:	48 89 c2             	mov    %rax,%rdx
+  8021e9:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8021f0:	00 00 00 
+  8021f3:	48 b8 7f 10 80 00 00 	movabs $0x80107f,%rax
+  8021fa:	00 00 00 
+  8021fd:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021ff:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802206:	00 00 00 
+  802209:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80220e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802210:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  802214:	be 00 00 00 00       	mov    $0x0,%esi
+  802219:	bf 04 00 00 00       	mov    $0x4,%edi
+  80221e:	48 b8 6b 20 80 00 00 	movabs $0x80206b,%rax
+  802225:	00 00 00 
+  802228:	ff d0                	call   *%rax
+  80222a:	48 98                	cltq
+}
+  80222c:	5b                   	pop    %rbx
+  80222d:	41 5c                	pop    %r12
+  80222f:	5d                   	pop    %rbp
+  802230:	c3                   	ret
+
+0000000000802231 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802231:	55                   	push   %rbp
+  802232:	48 89 e5             	mov    %rsp,%rbp
+  802235:	41 54                	push   %r12
+  802237:	53                   	push   %rbx
+  802238:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80223b:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802242:	00 00 00 
+  802245:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802248:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  80224a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80224f:	48 39 ca             	cmp    %rcx,%rdx
+  802252:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  802256:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  80225a:	be 00 00 00 00       	mov    $0x0,%esi
+  80225f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802264:	48 b8 6b 20 80 00 00 	movabs $0x80206b,%rax
+  80226b:	00 00 00 
+  80226e:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802270:	85 c0                	test   %eax,%eax
+  802272:	78 27                	js     80229b <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802274:	48 63 d8             	movslq %eax,%rbx
+  802277:	48 89 da             	mov    %rbx,%rdx
+  80227a:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802281:	00 00 00 
+  802284:	4c 89 e7             	mov    %r12,%rdi
+  802287:	48 b8 7f 10 80 00 00 	movabs $0x80107f,%rax
+  80228e:	00 00 00 
+  802291:	ff d0                	call   *%rax
+    return bytes_read;
+  802293:	48 89 d8             	mov    %rbx,%rax
+}
+  802296:	5b                   	pop    %rbx
+  802297:	41 5c                	pop    %r12
+  802299:	5d                   	pop    %rbp
+  80229a:	c3                   	ret
+        return bytes_read;
+  80229b:	48 98                	cltq
+  80229d:	eb f7                	jmp    802296 <devfile_read+0x65>
+
+000000000080229f <open>:
+open(const char *path, int mode) {
+  80229f:	55                   	push   %rbp
+  8022a0:	48 89 e5             	mov    %rsp,%rbp
+  8022a3:	41 55                	push   %r13
+  8022a5:	41 54                	push   %r12
+  8022a7:	53                   	push   %rbx
+  8022a8:	48 83 ec 18          	sub    $0x18,%rsp
+  8022ac:	49 89 fc             	mov    %rdi,%r12
+  8022af:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8022b2:	48 b8 e0 0d 80 00 00 	movabs $0x800de0,%rax
+  8022b9:	00 00 00 
+  8022bc:	ff d0                	call   *%rax
+  8022be:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8022c4:	0f 87 8a 00 00 00    	ja     802354 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8022ca:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8022ce:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  8022d5:	00 00 00 
+  8022d8:	ff d0                	call   *%rax
+  8022da:	89 c3                	mov    %eax,%ebx
+  8022dc:	85 c0                	test   %eax,%eax
+  8022de:	78 50                	js     802330 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8022e0:	4c 89 e6             	mov    %r12,%rsi
+  8022e3:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8022ea:	00 00 00 
+  8022ed:	48 89 df             	mov    %rbx,%rdi
+  8022f0:	48 b8 1e 0e 80 00 00 	movabs $0x800e1e,%rax
+  8022f7:	00 00 00 
+  8022fa:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8022fc:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802303:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802307:	bf 01 00 00 00       	mov    $0x1,%edi
+  80230c:	48 b8 6b 20 80 00 00 	movabs $0x80206b,%rax
+  802313:	00 00 00 
+  802316:	ff d0                	call   *%rax
+  802318:	89 c3                	mov    %eax,%ebx
+  80231a:	85 c0                	test   %eax,%eax
+  80231c:	78 1f                	js     80233d <open+0x9e>
+    return fd2num(fd);
+  80231e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802322:	48 b8 70 19 80 00 00 	movabs $0x801970,%rax
+  802329:	00 00 00 
+  80232c:	ff d0                	call   *%rax
+  80232e:	89 c3                	mov    %eax,%ebx
+}
+  802330:	89 d8                	mov    %ebx,%eax
+  802332:	48 83 c4 18          	add    $0x18,%rsp
+  802336:	5b                   	pop    %rbx
+  802337:	41 5c                	pop    %r12
+  802339:	41 5d                	pop    %r13
+  80233b:	5d                   	pop    %rbp
+  80233c:	c3                   	ret
+        fd_close(fd, 0);
+  80233d:	be 00 00 00 00       	mov    $0x0,%esi
+  802342:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802346:	48 b8 b9 1a 80 00 00 	movabs $0x801ab9,%rax
+  80234d:	00 00 00 
+  802350:	ff d0                	call   *%rax
+        return res;
+  802352:	eb dc                	jmp    802330 <open+0x91>
+        return -E_BAD_PATH;
+  802354:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802359:	eb d5                	jmp    802330 <open+0x91>
+
+000000000080235b <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80235b:	55                   	push   %rbp
+  80235c:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80235f:	be 00 00 00 00       	mov    $0x0,%esi
+  802364:	bf 08 00 00 00       	mov    $0x8,%edi
+  802369:	48 b8 6b 20 80 00 00 	movabs $0x80206b,%rax
+  802370:	00 00 00 
+  802373:	ff d0                	call   *%rax
+}
+  802375:	5d                   	pop    %rbp
+  802376:	c3                   	ret
+
+0000000000802377 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802377:	55                   	push   %rbp
+  802378:	48 89 e5             	mov    %rsp,%rbp
+  80237b:	41 54                	push   %r12
+  80237d:	53                   	push   %rbx
+  80237e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802381:	48 b8 82 19 80 00 00 	movabs $0x801982,%rax
+  802388:	00 00 00 
+  80238b:	ff d0                	call   *%rax
+  80238d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802390:	48 be c0 34 80 00 00 	movabs $0x8034c0,%rsi
+  802397:	00 00 00 
+  80239a:	48 89 df             	mov    %rbx,%rdi
+  80239d:	48 b8 1e 0e 80 00 00 	movabs $0x800e1e,%rax
+  8023a4:	00 00 00 
+  8023a7:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8023a9:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8023ae:	41 2b 04 24          	sub    (%r12),%eax
+  8023b2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8023b8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8023bf:	00 00 00 
+    stat->st_dev = &devpipe;
+  8023c2:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8023c9:	00 00 00 
+  8023cc:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8023d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d8:	5b                   	pop    %rbx
+  8023d9:	41 5c                	pop    %r12
+  8023db:	5d                   	pop    %rbp
+  8023dc:	c3                   	ret
+
+00000000008023dd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8023dd:	55                   	push   %rbp
+  8023de:	48 89 e5             	mov    %rsp,%rbp
+  8023e1:	41 54                	push   %r12
+  8023e3:	53                   	push   %rbx
+  8023e4:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8023e7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023ec:	48 89 fe             	mov    %rdi,%rsi
+  8023ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023f4:	49 bc 9a 14 80 00 00 	movabs $0x80149a,%r12
+  8023fb:	00 00 00 
+  8023fe:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802401:	48 89 df             	mov    %rbx,%rdi
+  802404:	48 b8 82 19 80 00 00 	movabs $0x801982,%rax
+  80240b:	00 00 00 
+  80240e:	ff d0                	call   *%rax
+  802410:	48 89 c6             	mov    %rax,%rsi
+  802413:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802418:	bf 00 00 00 00       	mov    $0x0,%edi
+  80241d:	41 ff d4             	call   *%r12
+}
+  802420:	5b                   	pop    %rbx
+  802421:	41 5c                	pop    %r12
+  802423:	5d                   	pop    %rbp
+  802424:	c3                   	ret
+
+0000000000802425 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802425:	55                   	push   %rbp
+  802426:	48 89 e5             	mov    %rsp,%rbp
+  802429:	41 57                	push   %r15
+  80242b:	41 56                	push   %r14
+  80242d:	41 55                	push   %r13
+  80242f:	41 54                	push   %r12
+  802431:	53                   	push   %rbx
+  802432:	48 83 ec 18          	sub    $0x18,%rsp
+  802436:	49 89 fc             	mov    %rdi,%r12
+  802439:	49 89 f5             	mov    %rsi,%r13
+  80243c:	49 89 d7             	mov    %rdx,%r15
+  80243f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802443:	48 b8 82 19 80 00 00 	movabs $0x801982,%rax
+  80244a:	00 00 00 
+  80244d:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80244f:	4d 85 ff             	test   %r15,%r15
+  802452:	0f 84 af 00 00 00    	je     802507 <devpipe_write+0xe2>
+  802458:	48 89 c3             	mov    %rax,%rbx
+  80245b:	4c 89 f8             	mov    %r15,%rax
+  80245e:	4d 89 ef             	mov    %r13,%r15
+  802461:	4c 01 e8             	add    %r13,%rax
+  802464:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802468:	49 bd a2 13 80 00 00 	movabs $0x8013a2,%r13
+  80246f:	00 00 00 
+            sys_yield();
+  802472:	49 be 3f 13 80 00 00 	movabs $0x80133f,%r14
+  802479:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80247c:	8b 73 04             	mov    0x4(%rbx),%esi
+  80247f:	48 63 ce             	movslq %esi,%rcx
+  802482:	48 63 03             	movslq (%rbx),%rax
+  802485:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80248b:	48 39 c1             	cmp    %rax,%rcx
+  80248e:	72 2e                	jb     8024be <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802490:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802495:	48 89 da             	mov    %rbx,%rdx
+  802498:	be 00 10 00 00       	mov    $0x1000,%esi
+  80249d:	4c 89 e7             	mov    %r12,%rdi
+  8024a0:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8024a3:	85 c0                	test   %eax,%eax
+  8024a5:	74 66                	je     80250d <devpipe_write+0xe8>
+            sys_yield();
+  8024a7:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8024aa:	8b 73 04             	mov    0x4(%rbx),%esi
+  8024ad:	48 63 ce             	movslq %esi,%rcx
+  8024b0:	48 63 03             	movslq (%rbx),%rax
+  8024b3:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8024b9:	48 39 c1             	cmp    %rax,%rcx
+  8024bc:	73 d2                	jae    802490 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8024be:	41 0f b6 3f          	movzbl (%r15),%edi
+  8024c2:	48 89 ca             	mov    %rcx,%rdx
+  8024c5:	48 c1 ea 03          	shr    $0x3,%rdx
+  8024c9:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8024d0:	08 10 20 
+  8024d3:	48 f7 e2             	mul    %rdx
+  8024d6:	48 c1 ea 06          	shr    $0x6,%rdx
+  8024da:	48 89 d0             	mov    %rdx,%rax
+  8024dd:	48 c1 e0 09          	shl    $0x9,%rax
+  8024e1:	48 29 d0             	sub    %rdx,%rax
+  8024e4:	48 c1 e0 03          	shl    $0x3,%rax
+  8024e8:	48 29 c1             	sub    %rax,%rcx
+  8024eb:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8024f0:	83 c6 01             	add    $0x1,%esi
+  8024f3:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8024f6:	49 83 c7 01          	add    $0x1,%r15
+  8024fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024fe:	49 39 c7             	cmp    %rax,%r15
+  802501:	0f 85 75 ff ff ff    	jne    80247c <devpipe_write+0x57>
+    return n;
+  802507:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80250b:	eb 05                	jmp    802512 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80250d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802512:	48 83 c4 18          	add    $0x18,%rsp
+  802516:	5b                   	pop    %rbx
+  802517:	41 5c                	pop    %r12
+  802519:	41 5d                	pop    %r13
+  80251b:	41 5e                	pop    %r14
+  80251d:	41 5f                	pop    %r15
+  80251f:	5d                   	pop    %rbp
+  802520:	c3                   	ret
+
+0000000000802521 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802521:	55                   	push   %rbp
+  802522:	48 89 e5             	mov    %rsp,%rbp
+  802525:	41 57                	push   %r15
+  802527:	41 56                	push   %r14
+  802529:	41 55                	push   %r13
+  80252b:	41 54                	push   %r12
+  80252d:	53                   	push   %rbx
+  80252e:	48 83 ec 18          	sub    $0x18,%rsp
+  802532:	49 89 fc             	mov    %rdi,%r12
+  802535:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802539:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80253d:	48 b8 82 19 80 00 00 	movabs $0x801982,%rax
+  802544:	00 00 00 
+  802547:	ff d0                	call   *%rax
+  802549:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80254c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802552:	49 bd a2 13 80 00 00 	movabs $0x8013a2,%r13
+  802559:	00 00 00 
+            sys_yield();
+  80255c:	49 be 3f 13 80 00 00 	movabs $0x80133f,%r14
+  802563:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802566:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80256b:	74 7d                	je     8025ea <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80256d:	8b 03                	mov    (%rbx),%eax
+  80256f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802572:	75 26                	jne    80259a <devpipe_read+0x79>
+            if (i > 0) return i;
+  802574:	4d 85 ff             	test   %r15,%r15
+  802577:	75 77                	jne    8025f0 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802579:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80257e:	48 89 da             	mov    %rbx,%rdx
+  802581:	be 00 10 00 00       	mov    $0x1000,%esi
+  802586:	4c 89 e7             	mov    %r12,%rdi
+  802589:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80258c:	85 c0                	test   %eax,%eax
+  80258e:	74 72                	je     802602 <devpipe_read+0xe1>
+            sys_yield();
+  802590:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802593:	8b 03                	mov    (%rbx),%eax
+  802595:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802598:	74 df                	je     802579 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80259a:	48 63 c8             	movslq %eax,%rcx
+  80259d:	48 89 ca             	mov    %rcx,%rdx
+  8025a0:	48 c1 ea 03          	shr    $0x3,%rdx
+  8025a4:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8025ab:	08 10 20 
+  8025ae:	48 89 d0             	mov    %rdx,%rax
+  8025b1:	48 f7 e6             	mul    %rsi
+  8025b4:	48 c1 ea 06          	shr    $0x6,%rdx
+  8025b8:	48 89 d0             	mov    %rdx,%rax
+  8025bb:	48 c1 e0 09          	shl    $0x9,%rax
+  8025bf:	48 29 d0             	sub    %rdx,%rax
+  8025c2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8025c9:	00 
+  8025ca:	48 89 c8             	mov    %rcx,%rax
+  8025cd:	48 29 d0             	sub    %rdx,%rax
+  8025d0:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8025d5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8025d9:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8025dd:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8025e0:	49 83 c7 01          	add    $0x1,%r15
+  8025e4:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8025e8:	75 83                	jne    80256d <devpipe_read+0x4c>
+    return n;
+  8025ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025ee:	eb 03                	jmp    8025f3 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8025f0:	4c 89 f8             	mov    %r15,%rax
+}
+  8025f3:	48 83 c4 18          	add    $0x18,%rsp
+  8025f7:	5b                   	pop    %rbx
+  8025f8:	41 5c                	pop    %r12
+  8025fa:	41 5d                	pop    %r13
+  8025fc:	41 5e                	pop    %r14
+  8025fe:	41 5f                	pop    %r15
+  802600:	5d                   	pop    %rbp
+  802601:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802602:	b8 00 00 00 00       	mov    $0x0,%eax
+  802607:	eb ea                	jmp    8025f3 <devpipe_read+0xd2>
+
+0000000000802609 <pipe>:
+pipe(int pfd[2]) {
+  802609:	55                   	push   %rbp
+  80260a:	48 89 e5             	mov    %rsp,%rbp
+  80260d:	41 55                	push   %r13
+  80260f:	41 54                	push   %r12
+  802611:	53                   	push   %rbx
+  802612:	48 83 ec 18          	sub    $0x18,%rsp
+  802616:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802619:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80261d:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  802624:	00 00 00 
+  802627:	ff d0                	call   *%rax
+  802629:	89 c3                	mov    %eax,%ebx
+  80262b:	85 c0                	test   %eax,%eax
+  80262d:	0f 88 a0 01 00 00    	js     8027d3 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802633:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802638:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80263d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802641:	bf 00 00 00 00       	mov    $0x0,%edi
+  802646:	48 b8 ce 13 80 00 00 	movabs $0x8013ce,%rax
+  80264d:	00 00 00 
+  802650:	ff d0                	call   *%rax
+  802652:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802654:	85 c0                	test   %eax,%eax
+  802656:	0f 88 77 01 00 00    	js     8027d3 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80265c:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802660:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  802667:	00 00 00 
+  80266a:	ff d0                	call   *%rax
+  80266c:	89 c3                	mov    %eax,%ebx
+  80266e:	85 c0                	test   %eax,%eax
+  802670:	0f 88 43 01 00 00    	js     8027b9 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802676:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80267b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802680:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802684:	bf 00 00 00 00       	mov    $0x0,%edi
+  802689:	48 b8 ce 13 80 00 00 	movabs $0x8013ce,%rax
+  802690:	00 00 00 
+  802693:	ff d0                	call   *%rax
+  802695:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802697:	85 c0                	test   %eax,%eax
+  802699:	0f 88 1a 01 00 00    	js     8027b9 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80269f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8026a3:	48 b8 82 19 80 00 00 	movabs $0x801982,%rax
+  8026aa:	00 00 00 
+  8026ad:	ff d0                	call   *%rax
+  8026af:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8026b2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8026b7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026bc:	48 89 c6             	mov    %rax,%rsi
+  8026bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026c4:	48 b8 ce 13 80 00 00 	movabs $0x8013ce,%rax
+  8026cb:	00 00 00 
+  8026ce:	ff d0                	call   *%rax
+  8026d0:	89 c3                	mov    %eax,%ebx
+  8026d2:	85 c0                	test   %eax,%eax
+  8026d4:	0f 88 c5 00 00 00    	js     80279f <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8026da:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8026de:	48 b8 82 19 80 00 00 	movabs $0x801982,%rax
+  8026e5:	00 00 00 
+  8026e8:	ff d0                	call   *%rax
+  8026ea:	48 89 c1             	mov    %rax,%rcx
+  8026ed:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8026f3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8026f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026fe:	4c 89 ee             	mov    %r13,%rsi
+  802701:	bf 00 00 00 00       	mov    $0x0,%edi
+  802706:	48 b8 35 14 80 00 00 	movabs $0x801435,%rax
+  80270d:	00 00 00 
+  802710:	ff d0                	call   *%rax
+  802712:	89 c3                	mov    %eax,%ebx
+  802714:	85 c0                	test   %eax,%eax
+  802716:	78 6e                	js     802786 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802718:	be 00 10 00 00       	mov    $0x1000,%esi
+  80271d:	4c 89 ef             	mov    %r13,%rdi
+  802720:	48 b8 70 13 80 00 00 	movabs $0x801370,%rax
+  802727:	00 00 00 
+  80272a:	ff d0                	call   *%rax
+  80272c:	83 f8 02             	cmp    $0x2,%eax
+  80272f:	0f 85 ab 00 00 00    	jne    8027e0 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802735:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80273c:	00 00 
+  80273e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802742:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802744:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802748:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80274f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802753:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802755:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802759:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802760:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802764:	48 bb 70 19 80 00 00 	movabs $0x801970,%rbx
+  80276b:	00 00 00 
+  80276e:	ff d3                	call   *%rbx
+  802770:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802774:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802778:	ff d3                	call   *%rbx
+  80277a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80277f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802784:	eb 4d                	jmp    8027d3 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802786:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80278b:	4c 89 ee             	mov    %r13,%rsi
+  80278e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802793:	48 b8 9a 14 80 00 00 	movabs $0x80149a,%rax
+  80279a:	00 00 00 
+  80279d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80279f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027a4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027ad:	48 b8 9a 14 80 00 00 	movabs $0x80149a,%rax
+  8027b4:	00 00 00 
+  8027b7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8027b9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027be:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8027c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027c7:	48 b8 9a 14 80 00 00 	movabs $0x80149a,%rax
+  8027ce:	00 00 00 
+  8027d1:	ff d0                	call   *%rax
+}
+  8027d3:	89 d8                	mov    %ebx,%eax
+  8027d5:	48 83 c4 18          	add    $0x18,%rsp
+  8027d9:	5b                   	pop    %rbx
+  8027da:	41 5c                	pop    %r12
+  8027dc:	41 5d                	pop    %r13
+  8027de:	5d                   	pop    %rbp
+  8027df:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8027e0:	48 b9 f0 34 80 00 00 	movabs $0x8034f0,%rcx
+  8027e7:	00 00 00 
+  8027ea:	48 ba c7 34 80 00 00 	movabs $0x8034c7,%rdx
+  8027f1:	00 00 00 
+  8027f4:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8027f9:	48 bf dc 34 80 00 00 	movabs $0x8034dc,%rdi
+  802800:	00 00 00 
+  802803:	b8 00 00 00 00       	mov    $0x0,%eax
+  802808:	49 b8 43 2c 80 00 00 	movabs $0x802c43,%r8
+  80280f:	00 00 00 
+  802812:	41 ff d0             	call   *%r8
+
+0000000000802815 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802815:	55                   	push   %rbp
+  802816:	48 89 e5             	mov    %rsp,%rbp
+  802819:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80281d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802821:	48 b8 fe 19 80 00 00 	movabs $0x8019fe,%rax
+  802828:	00 00 00 
+  80282b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80282d:	85 c0                	test   %eax,%eax
+  80282f:	78 35                	js     802866 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802831:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802835:	48 b8 82 19 80 00 00 	movabs $0x801982,%rax
+  80283c:	00 00 00 
+  80283f:	ff d0                	call   *%rax
+  802841:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802844:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802849:	be 00 10 00 00       	mov    $0x1000,%esi
+  80284e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802852:	48 b8 a2 13 80 00 00 	movabs $0x8013a2,%rax
+  802859:	00 00 00 
+  80285c:	ff d0                	call   *%rax
+  80285e:	85 c0                	test   %eax,%eax
+  802860:	0f 94 c0             	sete   %al
+  802863:	0f b6 c0             	movzbl %al,%eax
+}
+  802866:	c9                   	leave
+  802867:	c3                   	ret
+
+0000000000802868 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802868:	48 89 f8             	mov    %rdi,%rax
+  80286b:	48 c1 e8 27          	shr    $0x27,%rax
+  80286f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802876:	01 00 00 
+  802879:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80287d:	f6 c2 01             	test   $0x1,%dl
+  802880:	74 6d                	je     8028ef <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802882:	48 89 f8             	mov    %rdi,%rax
+  802885:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802889:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802890:	01 00 00 
+  802893:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802897:	f6 c2 01             	test   $0x1,%dl
+  80289a:	74 62                	je     8028fe <get_uvpt_entry+0x96>
+  80289c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8028a3:	01 00 00 
+  8028a6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028aa:	f6 c2 80             	test   $0x80,%dl
+  8028ad:	75 4f                	jne    8028fe <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8028af:	48 89 f8             	mov    %rdi,%rax
+  8028b2:	48 c1 e8 15          	shr    $0x15,%rax
+  8028b6:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8028bd:	01 00 00 
+  8028c0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028c4:	f6 c2 01             	test   $0x1,%dl
+  8028c7:	74 44                	je     80290d <get_uvpt_entry+0xa5>
+  8028c9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8028d0:	01 00 00 
+  8028d3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028d7:	f6 c2 80             	test   $0x80,%dl
+  8028da:	75 31                	jne    80290d <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8028dc:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8028e0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8028e7:	01 00 00 
+  8028ea:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8028ee:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8028ef:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8028f6:	01 00 00 
+  8028f9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8028fd:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8028fe:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802905:	01 00 00 
+  802908:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80290c:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80290d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802914:	01 00 00 
+  802917:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80291b:	c3                   	ret
+
+000000000080291c <get_prot>:
+
+int
+get_prot(void *va) {
+  80291c:	55                   	push   %rbp
+  80291d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802920:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  802927:	00 00 00 
+  80292a:	ff d0                	call   *%rax
+  80292c:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80292f:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802934:	89 c1                	mov    %eax,%ecx
+  802936:	83 c9 04             	or     $0x4,%ecx
+  802939:	f6 c2 01             	test   $0x1,%dl
+  80293c:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80293f:	89 c1                	mov    %eax,%ecx
+  802941:	83 c9 02             	or     $0x2,%ecx
+  802944:	f6 c2 02             	test   $0x2,%dl
+  802947:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80294a:	89 c1                	mov    %eax,%ecx
+  80294c:	83 c9 01             	or     $0x1,%ecx
+  80294f:	48 85 d2             	test   %rdx,%rdx
+  802952:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802955:	89 c1                	mov    %eax,%ecx
+  802957:	83 c9 40             	or     $0x40,%ecx
+  80295a:	f6 c6 04             	test   $0x4,%dh
+  80295d:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802960:	5d                   	pop    %rbp
+  802961:	c3                   	ret
+
+0000000000802962 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802962:	55                   	push   %rbp
+  802963:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802966:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  80296d:	00 00 00 
+  802970:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802972:	48 c1 e8 06          	shr    $0x6,%rax
+  802976:	83 e0 01             	and    $0x1,%eax
+}
+  802979:	5d                   	pop    %rbp
+  80297a:	c3                   	ret
+
+000000000080297b <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80297b:	55                   	push   %rbp
+  80297c:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80297f:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  802986:	00 00 00 
+  802989:	ff d0                	call   *%rax
+  80298b:	83 e0 01             	and    $0x1,%eax
+}
+  80298e:	5d                   	pop    %rbp
+  80298f:	c3                   	ret
+
+0000000000802990 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802990:	55                   	push   %rbp
+  802991:	48 89 e5             	mov    %rsp,%rbp
+  802994:	41 57                	push   %r15
+  802996:	41 56                	push   %r14
+  802998:	41 55                	push   %r13
+  80299a:	41 54                	push   %r12
+  80299c:	53                   	push   %rbx
+  80299d:	48 83 ec 18          	sub    $0x18,%rsp
+  8029a1:	49 89 ff             	mov    %rdi,%r15
+  8029a4:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8029a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  8029ad:	49 bc 7b 29 80 00 00 	movabs $0x80297b,%r12
+  8029b4:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  8029b7:	49 be 1c 29 80 00 00 	movabs $0x80291c,%r14
+  8029be:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8029c1:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  8029c8:	00 00 00 
+  8029cb:	eb 0c                	jmp    8029d9 <foreach_shared_region+0x49>
+  8029cd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8029d4:	4c 39 eb             	cmp    %r13,%rbx
+  8029d7:	74 38                	je     802a11 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  8029d9:	48 89 df             	mov    %rbx,%rdi
+  8029dc:	41 ff d4             	call   *%r12
+  8029df:	84 c0                	test   %al,%al
+  8029e1:	74 ea                	je     8029cd <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  8029e3:	48 89 df             	mov    %rbx,%rdi
+  8029e6:	41 ff d6             	call   *%r14
+  8029e9:	a8 40                	test   $0x40,%al
+  8029eb:	74 e0                	je     8029cd <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8029ed:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8029f4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8029f8:	48 89 df             	mov    %rbx,%rdi
+  8029fb:	41 ff d7             	call   *%r15
+        if (err)
+  8029fe:	85 c0                	test   %eax,%eax
+  802a00:	74 cb                	je     8029cd <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802a02:	48 83 c4 18          	add    $0x18,%rsp
+  802a06:	5b                   	pop    %rbx
+  802a07:	41 5c                	pop    %r12
+  802a09:	41 5d                	pop    %r13
+  802a0b:	41 5e                	pop    %r14
+  802a0d:	41 5f                	pop    %r15
+  802a0f:	5d                   	pop    %rbp
+  802a10:	c3                   	ret
+    return 0;
+  802a11:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a16:	eb ea                	jmp    802a02 <foreach_shared_region+0x72>
+
+0000000000802a18 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802a18:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a1d:	c3                   	ret
+
+0000000000802a1e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802a1e:	55                   	push   %rbp
+  802a1f:	48 89 e5             	mov    %rsp,%rbp
+  802a22:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802a25:	48 be 14 35 80 00 00 	movabs $0x803514,%rsi
+  802a2c:	00 00 00 
+  802a2f:	48 b8 1e 0e 80 00 00 	movabs $0x800e1e,%rax
+  802a36:	00 00 00 
+  802a39:	ff d0                	call   *%rax
+    return 0;
+}
+  802a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a40:	5d                   	pop    %rbp
+  802a41:	c3                   	ret
+
+0000000000802a42 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802a42:	55                   	push   %rbp
+  802a43:	48 89 e5             	mov    %rsp,%rbp
+  802a46:	41 57                	push   %r15
+  802a48:	41 56                	push   %r14
+  802a4a:	41 55                	push   %r13
+  802a4c:	41 54                	push   %r12
+  802a4e:	53                   	push   %rbx
+  802a4f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802a56:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802a5d:	48 85 d2             	test   %rdx,%rdx
+  802a60:	74 7a                	je     802adc <devcons_write+0x9a>
+  802a62:	49 89 d6             	mov    %rdx,%r14
+  802a65:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a6b:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802a70:	49 bf 18 10 80 00 00 	movabs $0x801018,%r15
+  802a77:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a7a:	4c 89 f3             	mov    %r14,%rbx
+  802a7d:	48 29 f3             	sub    %rsi,%rbx
+  802a80:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a85:	48 39 c3             	cmp    %rax,%rbx
+  802a88:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a8c:	4c 63 eb             	movslq %ebx,%r13
+  802a8f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a96:	48 01 c6             	add    %rax,%rsi
+  802a99:	4c 89 ea             	mov    %r13,%rdx
+  802a9c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802aa3:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802aa6:	4c 89 ee             	mov    %r13,%rsi
+  802aa9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802ab0:	48 b8 45 12 80 00 00 	movabs $0x801245,%rax
+  802ab7:	00 00 00 
+  802aba:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802abc:	41 01 dc             	add    %ebx,%r12d
+  802abf:	49 63 f4             	movslq %r12d,%rsi
+  802ac2:	4c 39 f6             	cmp    %r14,%rsi
+  802ac5:	72 b3                	jb     802a7a <devcons_write+0x38>
+    return res;
+  802ac7:	49 63 c4             	movslq %r12d,%rax
+}
+  802aca:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802ad1:	5b                   	pop    %rbx
+  802ad2:	41 5c                	pop    %r12
+  802ad4:	41 5d                	pop    %r13
+  802ad6:	41 5e                	pop    %r14
+  802ad8:	41 5f                	pop    %r15
+  802ada:	5d                   	pop    %rbp
+  802adb:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802adc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802ae2:	eb e3                	jmp    802ac7 <devcons_write+0x85>
+
+0000000000802ae4 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ae4:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802ae7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aec:	48 85 c0             	test   %rax,%rax
+  802aef:	74 55                	je     802b46 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802af1:	55                   	push   %rbp
+  802af2:	48 89 e5             	mov    %rsp,%rbp
+  802af5:	41 55                	push   %r13
+  802af7:	41 54                	push   %r12
+  802af9:	53                   	push   %rbx
+  802afa:	48 83 ec 08          	sub    $0x8,%rsp
+  802afe:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802b01:	48 bb 72 12 80 00 00 	movabs $0x801272,%rbx
+  802b08:	00 00 00 
+  802b0b:	49 bc 3f 13 80 00 00 	movabs $0x80133f,%r12
+  802b12:	00 00 00 
+  802b15:	eb 03                	jmp    802b1a <devcons_read+0x36>
+  802b17:	41 ff d4             	call   *%r12
+  802b1a:	ff d3                	call   *%rbx
+  802b1c:	85 c0                	test   %eax,%eax
+  802b1e:	74 f7                	je     802b17 <devcons_read+0x33>
+    if (c < 0) return c;
+  802b20:	48 63 d0             	movslq %eax,%rdx
+  802b23:	78 13                	js     802b38 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802b25:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b2a:	83 f8 04             	cmp    $0x4,%eax
+  802b2d:	74 09                	je     802b38 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802b2f:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802b33:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802b38:	48 89 d0             	mov    %rdx,%rax
+  802b3b:	48 83 c4 08          	add    $0x8,%rsp
+  802b3f:	5b                   	pop    %rbx
+  802b40:	41 5c                	pop    %r12
+  802b42:	41 5d                	pop    %r13
+  802b44:	5d                   	pop    %rbp
+  802b45:	c3                   	ret
+  802b46:	48 89 d0             	mov    %rdx,%rax
+  802b49:	c3                   	ret
+
+0000000000802b4a <cputchar>:
+cputchar(int ch) {
+  802b4a:	55                   	push   %rbp
+  802b4b:	48 89 e5             	mov    %rsp,%rbp
+  802b4e:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802b52:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802b56:	be 01 00 00 00       	mov    $0x1,%esi
+  802b5b:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802b5f:	48 b8 45 12 80 00 00 	movabs $0x801245,%rax
+  802b66:	00 00 00 
+  802b69:	ff d0                	call   *%rax
+}
+  802b6b:	c9                   	leave
+  802b6c:	c3                   	ret
+
+0000000000802b6d <getchar>:
+getchar(void) {
+  802b6d:	55                   	push   %rbp
+  802b6e:	48 89 e5             	mov    %rsp,%rbp
+  802b71:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b75:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b7a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b83:	48 b8 e1 1c 80 00 00 	movabs $0x801ce1,%rax
+  802b8a:	00 00 00 
+  802b8d:	ff d0                	call   *%rax
+  802b8f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b91:	85 c0                	test   %eax,%eax
+  802b93:	78 06                	js     802b9b <getchar+0x2e>
+  802b95:	74 08                	je     802b9f <getchar+0x32>
+  802b97:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b9b:	89 d0                	mov    %edx,%eax
+  802b9d:	c9                   	leave
+  802b9e:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b9f:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802ba4:	eb f5                	jmp    802b9b <getchar+0x2e>
+
+0000000000802ba6 <iscons>:
+iscons(int fdnum) {
+  802ba6:	55                   	push   %rbp
+  802ba7:	48 89 e5             	mov    %rsp,%rbp
+  802baa:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802bae:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802bb2:	48 b8 fe 19 80 00 00 	movabs $0x8019fe,%rax
+  802bb9:	00 00 00 
+  802bbc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bbe:	85 c0                	test   %eax,%eax
+  802bc0:	78 18                	js     802bda <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802bc2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bc6:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802bcd:	00 00 00 
+  802bd0:	8b 00                	mov    (%rax),%eax
+  802bd2:	39 02                	cmp    %eax,(%rdx)
+  802bd4:	0f 94 c0             	sete   %al
+  802bd7:	0f b6 c0             	movzbl %al,%eax
+}
+  802bda:	c9                   	leave
+  802bdb:	c3                   	ret
+
+0000000000802bdc <opencons>:
+opencons(void) {
+  802bdc:	55                   	push   %rbp
+  802bdd:	48 89 e5             	mov    %rsp,%rbp
+  802be0:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802be4:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802be8:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  802bef:	00 00 00 
+  802bf2:	ff d0                	call   *%rax
+  802bf4:	85 c0                	test   %eax,%eax
+  802bf6:	78 49                	js     802c41 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802bf8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bfd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c02:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802c06:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c0b:	48 b8 ce 13 80 00 00 	movabs $0x8013ce,%rax
+  802c12:	00 00 00 
+  802c15:	ff d0                	call   *%rax
+  802c17:	85 c0                	test   %eax,%eax
+  802c19:	78 26                	js     802c41 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802c1b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c1f:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802c26:	00 00 
+  802c28:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802c2a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802c2e:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802c35:	48 b8 70 19 80 00 00 	movabs $0x801970,%rax
+  802c3c:	00 00 00 
+  802c3f:	ff d0                	call   *%rax
+}
+  802c41:	c9                   	leave
+  802c42:	c3                   	ret
+
+0000000000802c43 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802c43:	55                   	push   %rbp
+  802c44:	48 89 e5             	mov    %rsp,%rbp
+  802c47:	41 56                	push   %r14
+  802c49:	41 55                	push   %r13
+  802c4b:	41 54                	push   %r12
+  802c4d:	53                   	push   %rbx
+  802c4e:	48 83 ec 50          	sub    $0x50,%rsp
+  802c52:	49 89 fc             	mov    %rdi,%r12
+  802c55:	41 89 f5             	mov    %esi,%r13d
+  802c58:	48 89 d3             	mov    %rdx,%rbx
+  802c5b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c5f:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802c63:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802c67:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802c6e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c72:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802c76:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802c7a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802c7e:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802c85:	00 00 00 
+  802c88:	4c 8b 30             	mov    (%rax),%r14
+  802c8b:	48 b8 0e 13 80 00 00 	movabs $0x80130e,%rax
+  802c92:	00 00 00 
+  802c95:	ff d0                	call   *%rax
+  802c97:	89 c6                	mov    %eax,%esi
+  802c99:	45 89 e8             	mov    %r13d,%r8d
+  802c9c:	4c 89 e1             	mov    %r12,%rcx
+  802c9f:	4c 89 f2             	mov    %r14,%rdx
+  802ca2:	48 bf 20 35 80 00 00 	movabs $0x803520,%rdi
+  802ca9:	00 00 00 
+  802cac:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb1:	49 bc f9 04 80 00 00 	movabs $0x8004f9,%r12
+  802cb8:	00 00 00 
+  802cbb:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802cbe:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802cc2:	48 89 df             	mov    %rbx,%rdi
+  802cc5:	48 b8 95 04 80 00 00 	movabs $0x800495,%rax
+  802ccc:	00 00 00 
+  802ccf:	ff d0                	call   *%rax
+    cprintf("\n");
+  802cd1:	48 bf 7b 34 80 00 00 	movabs $0x80347b,%rdi
+  802cd8:	00 00 00 
+  802cdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce0:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802ce3:	cc                   	int3
+  802ce4:	eb fd                	jmp    802ce3 <_panic+0xa0>
+
+0000000000802ce6 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802ce6:	55                   	push   %rbp
+  802ce7:	48 89 e5             	mov    %rsp,%rbp
+  802cea:	41 54                	push   %r12
+  802cec:	53                   	push   %rbx
+  802ced:	48 89 fb             	mov    %rdi,%rbx
+  802cf0:	48 89 f7             	mov    %rsi,%rdi
+  802cf3:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802cf6:	48 85 f6             	test   %rsi,%rsi
+  802cf9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802d00:	00 00 00 
+  802d03:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802d07:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d0c:	48 b8 38 17 80 00 00 	movabs $0x801738,%rax
+  802d13:	00 00 00 
+  802d16:	ff d0                	call   *%rax
+    if (res < 0) {
+  802d18:	85 c0                	test   %eax,%eax
+  802d1a:	78 45                	js     802d61 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802d1c:	48 85 db             	test   %rbx,%rbx
+  802d1f:	74 12                	je     802d33 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802d21:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802d28:	00 00 00 
+  802d2b:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802d31:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802d33:	4d 85 e4             	test   %r12,%r12
+  802d36:	74 14                	je     802d4c <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802d38:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802d3f:	00 00 00 
+  802d42:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802d48:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802d4c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802d53:	00 00 00 
+  802d56:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802d5c:	5b                   	pop    %rbx
+  802d5d:	41 5c                	pop    %r12
+  802d5f:	5d                   	pop    %rbp
+  802d60:	c3                   	ret
+        if (from_env_store)
+  802d61:	48 85 db             	test   %rbx,%rbx
+  802d64:	74 06                	je     802d6c <ipc_recv+0x86>
+            *from_env_store = 0;
+  802d66:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802d6c:	4d 85 e4             	test   %r12,%r12
+  802d6f:	74 eb                	je     802d5c <ipc_recv+0x76>
+            *perm_store = 0;
+  802d71:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802d78:	00 
+  802d79:	eb e1                	jmp    802d5c <ipc_recv+0x76>
+
+0000000000802d7b <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802d7b:	55                   	push   %rbp
+  802d7c:	48 89 e5             	mov    %rsp,%rbp
+  802d7f:	41 57                	push   %r15
+  802d81:	41 56                	push   %r14
+  802d83:	41 55                	push   %r13
+  802d85:	41 54                	push   %r12
+  802d87:	53                   	push   %rbx
+  802d88:	48 83 ec 18          	sub    $0x18,%rsp
+  802d8c:	41 89 fd             	mov    %edi,%r13d
+  802d8f:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802d92:	48 89 d3             	mov    %rdx,%rbx
+  802d95:	49 89 cc             	mov    %rcx,%r12
+  802d98:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802d9c:	48 85 d2             	test   %rdx,%rdx
+  802d9f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802da6:	00 00 00 
+  802da9:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802dad:	49 be 0c 17 80 00 00 	movabs $0x80170c,%r14
+  802db4:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802db7:	49 bf 3f 13 80 00 00 	movabs $0x80133f,%r15
+  802dbe:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802dc1:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802dc4:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802dc8:	4c 89 e1             	mov    %r12,%rcx
+  802dcb:	48 89 da             	mov    %rbx,%rdx
+  802dce:	44 89 ef             	mov    %r13d,%edi
+  802dd1:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802dd4:	85 c0                	test   %eax,%eax
+  802dd6:	74 34                	je     802e0c <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802dd8:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802ddb:	75 05                	jne    802de2 <ipc_send+0x67>
+        sys_yield();
+  802ddd:	41 ff d7             	call   *%r15
+    while (true) {
+  802de0:	eb df                	jmp    802dc1 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802de2:	48 ba 43 35 80 00 00 	movabs $0x803543,%rdx
+  802de9:	00 00 00 
+  802dec:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802df1:	48 bf 5c 35 80 00 00 	movabs $0x80355c,%rdi
+  802df8:	00 00 00 
+  802dfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e00:	48 b9 43 2c 80 00 00 	movabs $0x802c43,%rcx
+  802e07:	00 00 00 
+  802e0a:	ff d1                	call   *%rcx
+    }
+}
+  802e0c:	48 83 c4 18          	add    $0x18,%rsp
+  802e10:	5b                   	pop    %rbx
+  802e11:	41 5c                	pop    %r12
+  802e13:	41 5d                	pop    %r13
+  802e15:	41 5e                	pop    %r14
+  802e17:	41 5f                	pop    %r15
+  802e19:	5d                   	pop    %rbp
+  802e1a:	c3                   	ret
+
+0000000000802e1b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802e1b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802e20:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802e27:	00 00 00 
+  802e2a:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802e31:	48 01 ca             	add    %rcx,%rdx
+  802e34:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802e3a:	39 fa                	cmp    %edi,%edx
+  802e3c:	74 12                	je     802e50 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802e3e:	48 83 c0 01          	add    $0x1,%rax
+  802e42:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802e48:	75 e0                	jne    802e2a <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e4f:	c3                   	ret
+            return envs[i].env_id;
+  802e50:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802e57:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802e5e:	00 00 00 
+  802e61:	48 01 d0             	add    %rdx,%rax
+  802e64:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802e6a:	c3                   	ret
+  802e6b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000802e70 <__rodata_start>:
+  802e70:	25 30 34 64 2d       	and    $0x2d643430,%eax
+  802e75:	25 30 32 64 2d       	and    $0x2d643230,%eax
+  802e7a:	25 30 32 64 20       	and    $0x20643230,%eax
+  802e7f:	25 30 32 64 3a       	and    $0x3a643230,%eax
+  802e84:	25 30 32 64 3a       	and    $0x3a643230,%eax
+  802e89:	25 30 32 64 00       	and    $0x643230,%eax
+  802e8e:	44                   	rex.R
+  802e8f:	41 54                	push   %r12
+  802e91:	45 3a 20             	cmp    (%r8),%r12b
+  802e94:	25 73 0a 00 3c       	and    $0x3c000a73,%eax
+  802e99:	75 6e                	jne    802f09 <__rodata_start+0x99>
+  802e9b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802e9f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ea0:	3e 00 30             	ds add %dh,(%rax)
+  802ea3:	31 32                	xor    %esi,(%rdx)
+  802ea5:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802eac:	41                   	rex.B
+  802ead:	42                   	rex.X
+  802eae:	43                   	rex.XB
+  802eaf:	44                   	rex.R
+  802eb0:	45                   	rex.RB
+  802eb1:	46 00 30             	rex.RX add %r14b,(%rax)
+  802eb4:	31 32                	xor    %esi,(%rdx)
+  802eb6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802ebd:	61                   	(bad)
+  802ebe:	62 63 64 65 66       	(bad)
+  802ec3:	00 28                	add    %ch,(%rax)
+  802ec5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ec6:	75 6c                	jne    802f34 <__rodata_start+0xc4>
+  802ec8:	6c                   	insb   (%dx),%es:(%rdi)
+  802ec9:	29 00                	sub    %eax,(%rax)
+  802ecb:	65 72 72             	gs jb  802f40 <__rodata_start+0xd0>
+  802ece:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ecf:	72 20                	jb     802ef1 <__rodata_start+0x81>
+  802ed1:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802ed6:	73 70                	jae    802f48 <__rodata_start+0xd8>
+  802ed8:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802edc:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802ee3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ee4:	72 00                	jb     802ee6 <__rodata_start+0x76>
+  802ee6:	62 61 64 20 65       	(bad)
+  802eeb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802eec:	76 69                	jbe    802f57 <__rodata_start+0xe7>
+  802eee:	72 6f                	jb     802f5f <__rodata_start+0xef>
+  802ef0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ef1:	6d                   	insl   (%dx),%es:(%rdi)
+  802ef2:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802ef4:	74 00                	je     802ef6 <__rodata_start+0x86>
+  802ef6:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802efd:	20 70 61             	and    %dh,0x61(%rax)
+  802f00:	72 61                	jb     802f63 <__rodata_start+0xf3>
+  802f02:	6d                   	insl   (%dx),%es:(%rdi)
+  802f03:	65 74 65             	gs je  802f6b <__rodata_start+0xfb>
+  802f06:	72 00                	jb     802f08 <__rodata_start+0x98>
+  802f08:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f09:	75 74                	jne    802f7f <__rodata_start+0x10f>
+  802f0b:	20 6f 66             	and    %ch,0x66(%rdi)
+  802f0e:	20 6d 65             	and    %ch,0x65(%rbp)
+  802f11:	6d                   	insl   (%dx),%es:(%rdi)
+  802f12:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f13:	72 79                	jb     802f8e <__rodata_start+0x11e>
+  802f15:	00 6f 75             	add    %ch,0x75(%rdi)
+  802f18:	74 20                	je     802f3a <__rodata_start+0xca>
+  802f1a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f1b:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802f1f:	76 69                	jbe    802f8a <__rodata_start+0x11a>
+  802f21:	72 6f                	jb     802f92 <__rodata_start+0x122>
+  802f23:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f24:	6d                   	insl   (%dx),%es:(%rdi)
+  802f25:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f27:	74 73                	je     802f9c <__rodata_start+0x12c>
+  802f29:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802f2c:	72 72                	jb     802fa0 <__rodata_start+0x130>
+  802f2e:	75 70                	jne    802fa0 <__rodata_start+0x130>
+  802f30:	74 65                	je     802f97 <__rodata_start+0x127>
+  802f32:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802f37:	75 67                	jne    802fa0 <__rodata_start+0x130>
+  802f39:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802f3c:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802f3e:	00 73 65             	add    %dh,0x65(%rbx)
+  802f41:	67 6d                	insl   (%dx),%es:(%edi)
+  802f43:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f45:	74 61                	je     802fa8 <__rodata_start+0x138>
+  802f47:	74 69                	je     802fb2 <__rodata_start+0x142>
+  802f49:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f4a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f4b:	20 66 61             	and    %ah,0x61(%rsi)
+  802f4e:	75 6c                	jne    802fbc <__rodata_start+0x14c>
+  802f50:	74 00                	je     802f52 <__rodata_start+0xe2>
+  802f52:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802f59:	20 45 4c             	and    %al,0x4c(%rbp)
+  802f5c:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802f60:	61                   	(bad)
+  802f61:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802f66:	20 73 75             	and    %dh,0x75(%rbx)
+  802f69:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802f6c:	73 79                	jae    802fe7 <__rodata_start+0x177>
+  802f6e:	73 74                	jae    802fe4 <__rodata_start+0x174>
+  802f70:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802f72:	20 63 61             	and    %ah,0x61(%rbx)
+  802f75:	6c                   	insb   (%dx),%es:(%rdi)
+  802f76:	6c                   	insb   (%dx),%es:(%rdi)
+  802f77:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802f7a:	74 72                	je     802fee <__rodata_start+0x17e>
+  802f7c:	79 20                	jns    802f9e <__rodata_start+0x12e>
+  802f7e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f7f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f80:	74 20                	je     802fa2 <__rodata_start+0x132>
+  802f82:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802f84:	75 6e                	jne    802ff4 <__rodata_start+0x184>
+  802f86:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802f8a:	76 20                	jbe    802fac <__rodata_start+0x13c>
+  802f8c:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802f93:	72 65                	jb     802ffa <__rodata_start+0x18a>
+  802f95:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802f98:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f99:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802f9d:	65 78 70             	gs js  803010 <__rodata_start+0x1a0>
+  802fa0:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802fa5:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802fa8:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802fac:	20 66 69             	and    %ah,0x69(%rsi)
+  802faf:	6c                   	insb   (%dx),%es:(%rdi)
+  802fb0:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802fb4:	20 66 72             	and    %ah,0x72(%rsi)
+  802fb7:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802fbc:	61                   	(bad)
+  802fbd:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802fc0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fc1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fc2:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802fc6:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802fc9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fcb:	20 6d 61             	and    %ch,0x61(%rbp)
+  802fce:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fcf:	79 20                	jns    802ff1 <__rodata_start+0x181>
+  802fd1:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802fd8:	72 65                	jb     80303f <__rodata_start+0x1cf>
+  802fda:	20 6f 70             	and    %ch,0x70(%rdi)
+  802fdd:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802fdf:	00 66 69             	add    %ah,0x69(%rsi)
+  802fe2:	6c                   	insb   (%dx),%es:(%rdi)
+  802fe3:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802fe7:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802fea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802feb:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802fee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fef:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ff0:	74 20                	je     803012 <__rodata_start+0x1a2>
+  802ff2:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802ff4:	75 6e                	jne    803064 <__rodata_start+0x1f4>
+  802ff6:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802ffa:	76 61                	jbe    80305d <__rodata_start+0x1ed>
+  802ffc:	6c                   	insb   (%dx),%es:(%rdi)
+  802ffd:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803004:	00 
+  803005:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80300c:	72 65                	jb     803073 <__rodata_start+0x203>
+  80300e:	61                   	(bad)
+  80300f:	64 79 20             	fs jns 803032 <__rodata_start+0x1c2>
+  803012:	65 78 69             	gs js  80307e <__rodata_start+0x20e>
+  803015:	73 74                	jae    80308b <__rodata_start+0x21b>
+  803017:	73 00                	jae    803019 <__rodata_start+0x1a9>
+  803019:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80301a:	70 65                	jo     803081 <__rodata_start+0x211>
+  80301c:	72 61                	jb     80307f <__rodata_start+0x20f>
+  80301e:	74 69                	je     803089 <__rodata_start+0x219>
+  803020:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803021:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803022:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803025:	74 20                	je     803047 <__rodata_start+0x1d7>
+  803027:	73 75                	jae    80309e <__rodata_start+0x22e>
+  803029:	70 70                	jo     80309b <__rodata_start+0x22b>
+  80302b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80302c:	72 74                	jb     8030a2 <__rodata_start+0x232>
+  80302e:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803033:	65 72 61             	gs jb  803097 <__rodata_start+0x227>
+  803036:	74 69                	je     8030a1 <__rodata_start+0x231>
+  803038:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803039:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80303a:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80303d:	74 20                	je     80305f <__rodata_start+0x1ef>
+  80303f:	70 65                	jo     8030a6 <__rodata_start+0x236>
+  803041:	72 6d                	jb     8030b0 <__rodata_start+0x240>
+  803043:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  80304a:	2e 
+  80304b:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803052:	00 
+  803053:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80305a:	00 00 00 
+  80305d:	0f 1f 00             	nopl   (%rax)
+  803060:	e6 06                	out    %al,$0x6
+  803062:	80 00 00             	addb   $0x0,(%rax)
+  803065:	00 00                	add    %al,(%rax)
+  803067:	00 27                	add    %ah,(%rdi)
+  803069:	0d 80 00 00 00       	or     $0x80,%eax
+  80306e:	00 00                	add    %al,(%rax)
+  803070:	17                   	(bad)
+  803071:	0d 80 00 00 00       	or     $0x80,%eax
+  803076:	00 00                	add    %al,(%rax)
+  803078:	27                   	(bad)
+  803079:	0d 80 00 00 00       	or     $0x80,%eax
+  80307e:	00 00                	add    %al,(%rax)
+  803080:	27                   	(bad)
+  803081:	0d 80 00 00 00       	or     $0x80,%eax
+  803086:	00 00                	add    %al,(%rax)
+  803088:	27                   	(bad)
+  803089:	0d 80 00 00 00       	or     $0x80,%eax
+  80308e:	00 00                	add    %al,(%rax)
+  803090:	27                   	(bad)
+  803091:	0d 80 00 00 00       	or     $0x80,%eax
+  803096:	00 00                	add    %al,(%rax)
+  803098:	05 07 80 00 00       	add    $0x8007,%eax
+  80309d:	00 00                	add    %al,(%rax)
+  80309f:	00 27                	add    %ah,(%rdi)
+  8030a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8030a6:	00 00                	add    %al,(%rax)
+  8030a8:	27                   	(bad)
+  8030a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8030ae:	00 00                	add    %al,(%rax)
+  8030b0:	f9                   	stc
+  8030b1:	06                   	(bad)
+  8030b2:	80 00 00             	addb   $0x0,(%rax)
+  8030b5:	00 00                	add    %al,(%rax)
+  8030b7:	00 73 07             	add    %dh,0x7(%rbx)
+  8030ba:	80 00 00             	addb   $0x0,(%rax)
+  8030bd:	00 00                	add    %al,(%rax)
+  8030bf:	00 27                	add    %ah,(%rdi)
+  8030c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8030c6:	00 00                	add    %al,(%rax)
+  8030c8:	f9                   	stc
+  8030c9:	06                   	(bad)
+  8030ca:	80 00 00             	addb   $0x0,(%rax)
+  8030cd:	00 00                	add    %al,(%rax)
+  8030cf:	00 3f                	add    %bh,(%rdi)
+  8030d1:	07                   	(bad)
+  8030d2:	80 00 00             	addb   $0x0,(%rax)
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 3f                	add    %bh,(%rdi)
+  8030d9:	07                   	(bad)
+  8030da:	80 00 00             	addb   $0x0,(%rax)
+  8030dd:	00 00                	add    %al,(%rax)
+  8030df:	00 3f                	add    %bh,(%rdi)
+  8030e1:	07                   	(bad)
+  8030e2:	80 00 00             	addb   $0x0,(%rax)
+  8030e5:	00 00                	add    %al,(%rax)
+  8030e7:	00 3f                	add    %bh,(%rdi)
+  8030e9:	07                   	(bad)
+  8030ea:	80 00 00             	addb   $0x0,(%rax)
+  8030ed:	00 00                	add    %al,(%rax)
+  8030ef:	00 3f                	add    %bh,(%rdi)
+  8030f1:	07                   	(bad)
+  8030f2:	80 00 00             	addb   $0x0,(%rax)
+  8030f5:	00 00                	add    %al,(%rax)
+  8030f7:	00 3f                	add    %bh,(%rdi)
+  8030f9:	07                   	(bad)
+  8030fa:	80 00 00             	addb   $0x0,(%rax)
+  8030fd:	00 00                	add    %al,(%rax)
+  8030ff:	00 3f                	add    %bh,(%rdi)
+  803101:	07                   	(bad)
+  803102:	80 00 00             	addb   $0x0,(%rax)
+  803105:	00 00                	add    %al,(%rax)
+  803107:	00 3f                	add    %bh,(%rdi)
+  803109:	07                   	(bad)
+  80310a:	80 00 00             	addb   $0x0,(%rax)
+  80310d:	00 00                	add    %al,(%rax)
+  80310f:	00 3f                	add    %bh,(%rdi)
+  803111:	07                   	(bad)
+  803112:	80 00 00             	addb   $0x0,(%rax)
+  803115:	00 00                	add    %al,(%rax)
+  803117:	00 27                	add    %ah,(%rdi)
+  803119:	0d 80 00 00 00       	or     $0x80,%eax
+  80311e:	00 00                	add    %al,(%rax)
+  803120:	27                   	(bad)
+  803121:	0d 80 00 00 00       	or     $0x80,%eax
+  803126:	00 00                	add    %al,(%rax)
+  803128:	27                   	(bad)
+  803129:	0d 80 00 00 00       	or     $0x80,%eax
+  80312e:	00 00                	add    %al,(%rax)
+  803130:	27                   	(bad)
+  803131:	0d 80 00 00 00       	or     $0x80,%eax
+  803136:	00 00                	add    %al,(%rax)
+  803138:	27                   	(bad)
+  803139:	0d 80 00 00 00       	or     $0x80,%eax
+  80313e:	00 00                	add    %al,(%rax)
+  803140:	27                   	(bad)
+  803141:	0d 80 00 00 00       	or     $0x80,%eax
+  803146:	00 00                	add    %al,(%rax)
+  803148:	27                   	(bad)
+  803149:	0d 80 00 00 00       	or     $0x80,%eax
+  80314e:	00 00                	add    %al,(%rax)
+  803150:	27                   	(bad)
+  803151:	0d 80 00 00 00       	or     $0x80,%eax
+  803156:	00 00                	add    %al,(%rax)
+  803158:	27                   	(bad)
+  803159:	0d 80 00 00 00       	or     $0x80,%eax
+  80315e:	00 00                	add    %al,(%rax)
+  803160:	27                   	(bad)
+  803161:	0d 80 00 00 00       	or     $0x80,%eax
+  803166:	00 00                	add    %al,(%rax)
+  803168:	27                   	(bad)
+  803169:	0d 80 00 00 00       	or     $0x80,%eax
+  80316e:	00 00                	add    %al,(%rax)
+  803170:	27                   	(bad)
+  803171:	0d 80 00 00 00       	or     $0x80,%eax
+  803176:	00 00                	add    %al,(%rax)
+  803178:	27                   	(bad)
+  803179:	0d 80 00 00 00       	or     $0x80,%eax
+  80317e:	00 00                	add    %al,(%rax)
+  803180:	27                   	(bad)
+  803181:	0d 80 00 00 00       	or     $0x80,%eax
+  803186:	00 00                	add    %al,(%rax)
+  803188:	27                   	(bad)
+  803189:	0d 80 00 00 00       	or     $0x80,%eax
+  80318e:	00 00                	add    %al,(%rax)
+  803190:	27                   	(bad)
+  803191:	0d 80 00 00 00       	or     $0x80,%eax
+  803196:	00 00                	add    %al,(%rax)
+  803198:	27                   	(bad)
+  803199:	0d 80 00 00 00       	or     $0x80,%eax
+  80319e:	00 00                	add    %al,(%rax)
+  8031a0:	27                   	(bad)
+  8031a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8031a6:	00 00                	add    %al,(%rax)
+  8031a8:	27                   	(bad)
+  8031a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8031ae:	00 00                	add    %al,(%rax)
+  8031b0:	27                   	(bad)
+  8031b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8031b6:	00 00                	add    %al,(%rax)
+  8031b8:	27                   	(bad)
+  8031b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8031be:	00 00                	add    %al,(%rax)
+  8031c0:	27                   	(bad)
+  8031c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8031c6:	00 00                	add    %al,(%rax)
+  8031c8:	27                   	(bad)
+  8031c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8031ce:	00 00                	add    %al,(%rax)
+  8031d0:	27                   	(bad)
+  8031d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8031d6:	00 00                	add    %al,(%rax)
+  8031d8:	27                   	(bad)
+  8031d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8031de:	00 00                	add    %al,(%rax)
+  8031e0:	27                   	(bad)
+  8031e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8031e6:	00 00                	add    %al,(%rax)
+  8031e8:	27                   	(bad)
+  8031e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8031ee:	00 00                	add    %al,(%rax)
+  8031f0:	27                   	(bad)
+  8031f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8031f6:	00 00                	add    %al,(%rax)
+  8031f8:	27                   	(bad)
+  8031f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8031fe:	00 00                	add    %al,(%rax)
+  803200:	27                   	(bad)
+  803201:	0d 80 00 00 00       	or     $0x80,%eax
+  803206:	00 00                	add    %al,(%rax)
+  803208:	4a 0c 80             	rex.WX or $0x80,%al
+  80320b:	00 00                	add    %al,(%rax)
+  80320d:	00 00                	add    %al,(%rax)
+  80320f:	00 27                	add    %ah,(%rdi)
+  803211:	0d 80 00 00 00       	or     $0x80,%eax
+  803216:	00 00                	add    %al,(%rax)
+  803218:	27                   	(bad)
+  803219:	0d 80 00 00 00       	or     $0x80,%eax
+  80321e:	00 00                	add    %al,(%rax)
+  803220:	27                   	(bad)
+  803221:	0d 80 00 00 00       	or     $0x80,%eax
+  803226:	00 00                	add    %al,(%rax)
+  803228:	27                   	(bad)
+  803229:	0d 80 00 00 00       	or     $0x80,%eax
+  80322e:	00 00                	add    %al,(%rax)
+  803230:	27                   	(bad)
+  803231:	0d 80 00 00 00       	or     $0x80,%eax
+  803236:	00 00                	add    %al,(%rax)
+  803238:	27                   	(bad)
+  803239:	0d 80 00 00 00       	or     $0x80,%eax
+  80323e:	00 00                	add    %al,(%rax)
+  803240:	27                   	(bad)
+  803241:	0d 80 00 00 00       	or     $0x80,%eax
+  803246:	00 00                	add    %al,(%rax)
+  803248:	27                   	(bad)
+  803249:	0d 80 00 00 00       	or     $0x80,%eax
+  80324e:	00 00                	add    %al,(%rax)
+  803250:	27                   	(bad)
+  803251:	0d 80 00 00 00       	or     $0x80,%eax
+  803256:	00 00                	add    %al,(%rax)
+  803258:	27                   	(bad)
+  803259:	0d 80 00 00 00       	or     $0x80,%eax
+  80325e:	00 00                	add    %al,(%rax)
+  803260:	96                   	xchg   %eax,%esi
+  803261:	07                   	(bad)
+  803262:	80 00 00             	addb   $0x0,(%rax)
+  803265:	00 00                	add    %al,(%rax)
+  803267:	00 65 09             	add    %ah,0x9(%rbp)
+  80326a:	80 00 00             	addb   $0x0,(%rax)
+  80326d:	00 00                	add    %al,(%rax)
+  80326f:	00 27                	add    %ah,(%rdi)
+  803271:	0d 80 00 00 00       	or     $0x80,%eax
+  803276:	00 00                	add    %al,(%rax)
+  803278:	27                   	(bad)
+  803279:	0d 80 00 00 00       	or     $0x80,%eax
+  80327e:	00 00                	add    %al,(%rax)
+  803280:	27                   	(bad)
+  803281:	0d 80 00 00 00       	or     $0x80,%eax
+  803286:	00 00                	add    %al,(%rax)
+  803288:	27                   	(bad)
+  803289:	0d 80 00 00 00       	or     $0x80,%eax
+  80328e:	00 00                	add    %al,(%rax)
+  803290:	c5 07 80             	(bad)
+  803293:	00 00                	add    %al,(%rax)
+  803295:	00 00                	add    %al,(%rax)
+  803297:	00 27                	add    %ah,(%rdi)
+  803299:	0d 80 00 00 00       	or     $0x80,%eax
+  80329e:	00 00                	add    %al,(%rax)
+  8032a0:	27                   	(bad)
+  8032a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8032a6:	00 00                	add    %al,(%rax)
+  8032a8:	8b 07                	mov    (%rdi),%eax
+  8032aa:	80 00 00             	addb   $0x0,(%rax)
+  8032ad:	00 00                	add    %al,(%rax)
+  8032af:	00 27                	add    %ah,(%rdi)
+  8032b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8032b6:	00 00                	add    %al,(%rax)
+  8032b8:	27                   	(bad)
+  8032b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8032be:	00 00                	add    %al,(%rax)
+  8032c0:	0d 0b 80 00 00       	or     $0x800b,%eax
+  8032c5:	00 00                	add    %al,(%rax)
+  8032c7:	00 d7                	add    %dl,%bh
+  8032c9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032cf:	00 27                	add    %ah,(%rdi)
+  8032d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8032d6:	00 00                	add    %al,(%rax)
+  8032d8:	27                   	(bad)
+  8032d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8032de:	00 00                	add    %al,(%rax)
+  8032e0:	5c                   	pop    %rsp
+  8032e1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8032e7:	00 27                	add    %ah,(%rdi)
+  8032e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8032ee:	00 00                	add    %al,(%rax)
+  8032f0:	39 0a                	cmp    %ecx,(%rdx)
+  8032f2:	80 00 00             	addb   $0x0,(%rax)
+  8032f5:	00 00                	add    %al,(%rax)
+  8032f7:	00 27                	add    %ah,(%rdi)
+  8032f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8032fe:	00 00                	add    %al,(%rax)
+  803300:	27                   	(bad)
+  803301:	0d 80 00 00 00       	or     $0x80,%eax
+  803306:	00 00                	add    %al,(%rax)
+  803308:	4a 0c 80             	rex.WX or $0x80,%al
+  80330b:	00 00                	add    %al,(%rax)
+  80330d:	00 00                	add    %al,(%rax)
+  80330f:	00 27                	add    %ah,(%rdi)
+  803311:	0d 80 00 00 00       	or     $0x80,%eax
+  803316:	00 00                	add    %al,(%rax)
+  803318:	ef                   	out    %eax,(%dx)
+  803319:	06                   	(bad)
+  80331a:	80 00 00             	addb   $0x0,(%rax)
+  80331d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803320 <error_string>:
+	...
+  803328:	d4 2e 80 00 00 00 00 00 e6 2e 80 00 00 00 00 00     ................
+  803338:	f6 2e 80 00 00 00 00 00 08 2f 80 00 00 00 00 00     ........./......
+  803348:	16 2f 80 00 00 00 00 00 2a 2f 80 00 00 00 00 00     ./......*/......
+  803358:	3f 2f 80 00 00 00 00 00 52 2f 80 00 00 00 00 00     ?/......R/......
+  803368:	64 2f 80 00 00 00 00 00 78 2f 80 00 00 00 00 00     d/......x/......
+  803378:	88 2f 80 00 00 00 00 00 9b 2f 80 00 00 00 00 00     ./......./......
+  803388:	b2 2f 80 00 00 00 00 00 c8 2f 80 00 00 00 00 00     ./......./......
+  803398:	e0 2f 80 00 00 00 00 00 f8 2f 80 00 00 00 00 00     ./......./......
+  8033a8:	05 30 80 00 00 00 00 00 d0 33 80 00 00 00 00 00     .0.......3......
+  8033b8:	19 30 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .0..............
+  8033c8:	31 30 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     10......file is 
+  8033d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8033e8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8033f8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803408:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803418:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803428:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803438:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803448:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803458:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803468:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803478:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803488:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803498:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008034a0 <devtab>:
+  8034a0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8034b0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8034c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8034d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8034e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8034f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803500:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803510:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803520:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803530:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803540:	3a 20 00 69 70 63 5f 73 65 6e 64 3a 20 66 61 69     : .ipc_send: fai
+  803550:	6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62 2f     led to send.lib/
+  803560:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803570:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803580:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803590:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803600:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803610:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803620:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803630:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803640:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803650:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803660:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803670:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803680:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803690:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803700:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803710:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803720:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803730:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803740:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803750:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803760:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803770:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803780:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803790:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803800:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
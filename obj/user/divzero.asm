@@ -0,0 +1,5642 @@
+
+obj/user/divzero:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 3d 00 00 00       	call   800060 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+volatile int zero;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("1337/0 is %08x!\n", 1337 / zero);
+  800029:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800030:	00 00 00 
+  800033:	8b 08                	mov    (%rax),%ecx
+  800035:	b8 39 05 00 00       	mov    $0x539,%eax
+  80003a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80003f:	f7 f9                	idiv   %ecx
+  800041:	89 c6                	mov    %eax,%esi
+  800043:	48 bf 50 2b 80 00 00 	movabs $0x802b50,%rdi
+  80004a:	00 00 00 
+  80004d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800052:	48 ba d7 01 80 00 00 	movabs $0x8001d7,%rdx
+  800059:	00 00 00 
+  80005c:	ff d2                	call   *%rdx
+}
+  80005e:	5d                   	pop    %rbp
+  80005f:	c3                   	ret
+
+0000000000800060 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800060:	55                   	push   %rbp
+  800061:	48 89 e5             	mov    %rsp,%rbp
+  800064:	41 56                	push   %r14
+  800066:	41 55                	push   %r13
+  800068:	41 54                	push   %r12
+  80006a:	53                   	push   %rbx
+  80006b:	41 89 fd             	mov    %edi,%r13d
+  80006e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800071:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800078:	00 00 00 
+  80007b:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800082:	00 00 00 
+  800085:	48 39 c2             	cmp    %rax,%rdx
+  800088:	73 17                	jae    8000a1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80008a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80008d:	49 89 c4             	mov    %rax,%r12
+  800090:	48 83 c3 08          	add    $0x8,%rbx
+  800094:	b8 00 00 00 00       	mov    $0x0,%eax
+  800099:	ff 53 f8             	call   *-0x8(%rbx)
+  80009c:	4c 39 e3             	cmp    %r12,%rbx
+  80009f:	72 ef                	jb     800090 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8000a1:	48 b8 ec 0f 80 00 00 	movabs $0x800fec,%rax
+  8000a8:	00 00 00 
+  8000ab:	ff d0                	call   *%rax
+  8000ad:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8000b0:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8000b7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000be:	00 00 00 
+  8000c1:	48 01 d0             	add    %rdx,%rax
+  8000c4:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  8000cb:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000ce:	45 85 ed             	test   %r13d,%r13d
+  8000d1:	7e 0d                	jle    8000e0 <libmain+0x80>
+  8000d3:	49 8b 06             	mov    (%r14),%rax
+  8000d6:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000dd:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000e0:	4c 89 f6             	mov    %r14,%rsi
+  8000e3:	44 89 ef             	mov    %r13d,%edi
+  8000e6:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000ed:	00 00 00 
+  8000f0:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000f2:	48 b8 07 01 80 00 00 	movabs $0x800107,%rax
+  8000f9:	00 00 00 
+  8000fc:	ff d0                	call   *%rax
+#endif
+}
+  8000fe:	5b                   	pop    %rbx
+  8000ff:	41 5c                	pop    %r12
+  800101:	41 5d                	pop    %r13
+  800103:	41 5e                	pop    %r14
+  800105:	5d                   	pop    %rbp
+  800106:	c3                   	ret
+
+0000000000800107 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800107:	55                   	push   %rbp
+  800108:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80010b:	48 b8 74 18 80 00 00 	movabs $0x801874,%rax
+  800112:	00 00 00 
+  800115:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800117:	bf 00 00 00 00       	mov    $0x0,%edi
+  80011c:	48 b8 81 0f 80 00 00 	movabs $0x800f81,%rax
+  800123:	00 00 00 
+  800126:	ff d0                	call   *%rax
+}
+  800128:	5d                   	pop    %rbp
+  800129:	c3                   	ret
+
+000000000080012a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80012a:	55                   	push   %rbp
+  80012b:	48 89 e5             	mov    %rsp,%rbp
+  80012e:	53                   	push   %rbx
+  80012f:	48 83 ec 08          	sub    $0x8,%rsp
+  800133:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800136:	8b 06                	mov    (%rsi),%eax
+  800138:	8d 50 01             	lea    0x1(%rax),%edx
+  80013b:	89 16                	mov    %edx,(%rsi)
+  80013d:	48 98                	cltq
+  80013f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800144:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80014a:	74 0a                	je     800156 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80014c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800150:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800156:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80015a:	be ff 00 00 00       	mov    $0xff,%esi
+  80015f:	48 b8 23 0f 80 00 00 	movabs $0x800f23,%rax
+  800166:	00 00 00 
+  800169:	ff d0                	call   *%rax
+        state->offset = 0;
+  80016b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800171:	eb d9                	jmp    80014c <putch+0x22>
+
+0000000000800173 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800173:	55                   	push   %rbp
+  800174:	48 89 e5             	mov    %rsp,%rbp
+  800177:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80017e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800181:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800188:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80018d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800192:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800195:	48 89 f1             	mov    %rsi,%rcx
+  800198:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80019f:	48 bf 2a 01 80 00 00 	movabs $0x80012a,%rdi
+  8001a6:	00 00 00 
+  8001a9:	48 b8 27 03 80 00 00 	movabs $0x800327,%rax
+  8001b0:	00 00 00 
+  8001b3:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001b5:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001bc:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001c3:	48 b8 23 0f 80 00 00 	movabs $0x800f23,%rax
+  8001ca:	00 00 00 
+  8001cd:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001cf:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001d5:	c9                   	leave
+  8001d6:	c3                   	ret
+
+00000000008001d7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001d7:	55                   	push   %rbp
+  8001d8:	48 89 e5             	mov    %rsp,%rbp
+  8001db:	48 83 ec 50          	sub    $0x50,%rsp
+  8001df:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001e3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001e7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001eb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001ef:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001f3:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001fa:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800202:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800206:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80020a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80020e:	48 b8 73 01 80 00 00 	movabs $0x800173,%rax
+  800215:	00 00 00 
+  800218:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80021a:	c9                   	leave
+  80021b:	c3                   	ret
+
+000000000080021c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80021c:	55                   	push   %rbp
+  80021d:	48 89 e5             	mov    %rsp,%rbp
+  800220:	41 57                	push   %r15
+  800222:	41 56                	push   %r14
+  800224:	41 55                	push   %r13
+  800226:	41 54                	push   %r12
+  800228:	53                   	push   %rbx
+  800229:	48 83 ec 18          	sub    $0x18,%rsp
+  80022d:	49 89 fc             	mov    %rdi,%r12
+  800230:	49 89 f5             	mov    %rsi,%r13
+  800233:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800237:	8b 45 10             	mov    0x10(%rbp),%eax
+  80023a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80023d:	41 89 cf             	mov    %ecx,%r15d
+  800240:	4c 39 fa             	cmp    %r15,%rdx
+  800243:	73 5b                	jae    8002a0 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800245:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800249:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80024d:	85 db                	test   %ebx,%ebx
+  80024f:	7e 0e                	jle    80025f <print_num+0x43>
+            putch(padc, put_arg);
+  800251:	4c 89 ee             	mov    %r13,%rsi
+  800254:	44 89 f7             	mov    %r14d,%edi
+  800257:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80025a:	83 eb 01             	sub    $0x1,%ebx
+  80025d:	75 f2                	jne    800251 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80025f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800263:	48 b9 7c 2b 80 00 00 	movabs $0x802b7c,%rcx
+  80026a:	00 00 00 
+  80026d:	48 b8 6b 2b 80 00 00 	movabs $0x802b6b,%rax
+  800274:	00 00 00 
+  800277:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80027b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80027f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800284:	49 f7 f7             	div    %r15
+  800287:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80028b:	4c 89 ee             	mov    %r13,%rsi
+  80028e:	41 ff d4             	call   *%r12
+}
+  800291:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800295:	5b                   	pop    %rbx
+  800296:	41 5c                	pop    %r12
+  800298:	41 5d                	pop    %r13
+  80029a:	41 5e                	pop    %r14
+  80029c:	41 5f                	pop    %r15
+  80029e:	5d                   	pop    %rbp
+  80029f:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a9:	49 f7 f7             	div    %r15
+  8002ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8002b0:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002b4:	52                   	push   %rdx
+  8002b5:	45 0f be c9          	movsbl %r9b,%r9d
+  8002b9:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002bd:	48 89 c2             	mov    %rax,%rdx
+  8002c0:	48 b8 1c 02 80 00 00 	movabs $0x80021c,%rax
+  8002c7:	00 00 00 
+  8002ca:	ff d0                	call   *%rax
+  8002cc:	48 83 c4 10          	add    $0x10,%rsp
+  8002d0:	eb 8d                	jmp    80025f <print_num+0x43>
+
+00000000008002d2 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002d2:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002d6:	48 8b 06             	mov    (%rsi),%rax
+  8002d9:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002dd:	73 0a                	jae    8002e9 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002df:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002e3:	48 89 16             	mov    %rdx,(%rsi)
+  8002e6:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002e9:	c3                   	ret
+
+00000000008002ea <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002ea:	55                   	push   %rbp
+  8002eb:	48 89 e5             	mov    %rsp,%rbp
+  8002ee:	48 83 ec 50          	sub    $0x50,%rsp
+  8002f2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002f6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002fa:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002fe:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800305:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800309:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80030d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800311:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800315:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800319:	48 b8 27 03 80 00 00 	movabs $0x800327,%rax
+  800320:	00 00 00 
+  800323:	ff d0                	call   *%rax
+}
+  800325:	c9                   	leave
+  800326:	c3                   	ret
+
+0000000000800327 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800327:	55                   	push   %rbp
+  800328:	48 89 e5             	mov    %rsp,%rbp
+  80032b:	41 57                	push   %r15
+  80032d:	41 56                	push   %r14
+  80032f:	41 55                	push   %r13
+  800331:	41 54                	push   %r12
+  800333:	53                   	push   %rbx
+  800334:	48 83 ec 38          	sub    $0x38,%rsp
+  800338:	49 89 fe             	mov    %rdi,%r14
+  80033b:	49 89 f5             	mov    %rsi,%r13
+  80033e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800341:	48 8b 01             	mov    (%rcx),%rax
+  800344:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800348:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80034c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800350:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800354:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800358:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80035c:	0f b6 3b             	movzbl (%rbx),%edi
+  80035f:	40 80 ff 25          	cmp    $0x25,%dil
+  800363:	74 18                	je     80037d <vprintfmt+0x56>
+            if (!ch) return;
+  800365:	40 84 ff             	test   %dil,%dil
+  800368:	0f 84 b1 06 00 00    	je     800a1f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80036e:	40 0f b6 ff          	movzbl %dil,%edi
+  800372:	4c 89 ee             	mov    %r13,%rsi
+  800375:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800378:	4c 89 e3             	mov    %r12,%rbx
+  80037b:	eb db                	jmp    800358 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80037d:	be 00 00 00 00       	mov    $0x0,%esi
+  800382:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800386:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80038b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800391:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800398:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80039c:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003a1:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003a6:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003a9:	83 e8 23             	sub    $0x23,%eax
+  8003ac:	3c 57                	cmp    $0x57,%al
+  8003ae:	0f 87 51 06 00 00    	ja     800a05 <vprintfmt+0x6de>
+  8003b4:	0f b6 c0             	movzbl %al,%eax
+  8003b7:	48 b9 20 2d 80 00 00 	movabs $0x802d20,%rcx
+  8003be:	00 00 00 
+  8003c1:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003c4:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003c7:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003cb:	eb cf                	jmp    80039c <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003cd:	49 89 dc             	mov    %rbx,%r12
+  8003d0:	be 01 00 00 00       	mov    $0x1,%esi
+  8003d5:	eb c5                	jmp    80039c <vprintfmt+0x75>
+            padc = ch;
+  8003d7:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003db:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003de:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003e1:	eb b9                	jmp    80039c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8003e9:	77 24                	ja     80040f <vprintfmt+0xe8>
+  8003eb:	89 c1                	mov    %eax,%ecx
+  8003ed:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003f1:	83 c0 08             	add    $0x8,%eax
+  8003f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003f7:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003fa:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003fd:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800401:	79 99                	jns    80039c <vprintfmt+0x75>
+                width = precision;
+  800403:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800407:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80040d:	eb 8d                	jmp    80039c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80040f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800413:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800417:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80041b:	eb da                	jmp    8003f7 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80041d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800422:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800426:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80042c:	3c 39                	cmp    $0x39,%al
+  80042e:	77 1c                	ja     80044c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800430:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800434:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800438:	0f b6 c0             	movzbl %al,%eax
+  80043b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800440:	0f b6 03             	movzbl (%rbx),%eax
+  800443:	3c 39                	cmp    $0x39,%al
+  800445:	76 e9                	jbe    800430 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800447:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80044a:	eb b1                	jmp    8003fd <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80044c:	49 89 dc             	mov    %rbx,%r12
+  80044f:	eb ac                	jmp    8003fd <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800451:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800454:	85 c9                	test   %ecx,%ecx
+  800456:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045b:	0f 49 c1             	cmovns %ecx,%eax
+  80045e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800461:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800464:	e9 33 ff ff ff       	jmp    80039c <vprintfmt+0x75>
+            lflag++;
+  800469:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80046c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80046f:	e9 28 ff ff ff       	jmp    80039c <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800474:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800477:	83 f8 2f             	cmp    $0x2f,%eax
+  80047a:	77 19                	ja     800495 <vprintfmt+0x16e>
+  80047c:	89 c2                	mov    %eax,%edx
+  80047e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800482:	83 c0 08             	add    $0x8,%eax
+  800485:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800488:	8b 3a                	mov    (%rdx),%edi
+  80048a:	4c 89 ee             	mov    %r13,%rsi
+  80048d:	41 ff d6             	call   *%r14
+            break;
+  800490:	e9 c3 fe ff ff       	jmp    800358 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800495:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800499:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80049d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a1:	eb e5                	jmp    800488 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8004a9:	77 5a                	ja     800505 <vprintfmt+0x1de>
+  8004ab:	89 c2                	mov    %eax,%edx
+  8004ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004b1:	83 c0 08             	add    $0x8,%eax
+  8004b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004b7:	8b 02                	mov    (%rdx),%eax
+  8004b9:	89 c1                	mov    %eax,%ecx
+  8004bb:	f7 d9                	neg    %ecx
+  8004bd:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004c0:	83 f9 15             	cmp    $0x15,%ecx
+  8004c3:	7f 4e                	jg     800513 <vprintfmt+0x1ec>
+  8004c5:	48 63 c1             	movslq %ecx,%rax
+  8004c8:	48 ba e0 2f 80 00 00 	movabs $0x802fe0,%rdx
+  8004cf:	00 00 00 
+  8004d2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004d6:	48 85 c0             	test   %rax,%rax
+  8004d9:	74 38                	je     800513 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004db:	48 89 c1             	mov    %rax,%rcx
+  8004de:	48 ba 99 31 80 00 00 	movabs $0x803199,%rdx
+  8004e5:	00 00 00 
+  8004e8:	4c 89 ee             	mov    %r13,%rsi
+  8004eb:	4c 89 f7             	mov    %r14,%rdi
+  8004ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f3:	49 b8 ea 02 80 00 00 	movabs $0x8002ea,%r8
+  8004fa:	00 00 00 
+  8004fd:	41 ff d0             	call   *%r8
+  800500:	e9 53 fe ff ff       	jmp    800358 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800505:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800509:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80050d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800511:	eb a4                	jmp    8004b7 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800513:	48 ba 94 2b 80 00 00 	movabs $0x802b94,%rdx
+  80051a:	00 00 00 
+  80051d:	4c 89 ee             	mov    %r13,%rsi
+  800520:	4c 89 f7             	mov    %r14,%rdi
+  800523:	b8 00 00 00 00       	mov    $0x0,%eax
+  800528:	49 b8 ea 02 80 00 00 	movabs $0x8002ea,%r8
+  80052f:	00 00 00 
+  800532:	41 ff d0             	call   *%r8
+  800535:	e9 1e fe ff ff       	jmp    800358 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80053a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80053d:	83 f8 2f             	cmp    $0x2f,%eax
+  800540:	77 6c                	ja     8005ae <vprintfmt+0x287>
+  800542:	89 c2                	mov    %eax,%edx
+  800544:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800548:	83 c0 08             	add    $0x8,%eax
+  80054b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80054e:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800551:	48 85 d2             	test   %rdx,%rdx
+  800554:	48 b8 8d 2b 80 00 00 	movabs $0x802b8d,%rax
+  80055b:	00 00 00 
+  80055e:	48 0f 45 c2          	cmovne %rdx,%rax
+  800562:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800566:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80056a:	7e 06                	jle    800572 <vprintfmt+0x24b>
+  80056c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800570:	75 4a                	jne    8005bc <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800572:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800576:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80057a:	0f b6 00             	movzbl (%rax),%eax
+  80057d:	84 c0                	test   %al,%al
+  80057f:	0f 85 9a 00 00 00    	jne    80061f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800585:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800588:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80058c:	85 c0                	test   %eax,%eax
+  80058e:	0f 8e c4 fd ff ff    	jle    800358 <vprintfmt+0x31>
+  800594:	4c 89 ee             	mov    %r13,%rsi
+  800597:	bf 20 00 00 00       	mov    $0x20,%edi
+  80059c:	41 ff d6             	call   *%r14
+  80059f:	41 83 ec 01          	sub    $0x1,%r12d
+  8005a3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005a7:	75 eb                	jne    800594 <vprintfmt+0x26d>
+  8005a9:	e9 aa fd ff ff       	jmp    800358 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005b2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005ba:	eb 92                	jmp    80054e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005bc:	49 63 f7             	movslq %r15d,%rsi
+  8005bf:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005c3:	48 b8 d9 0a 80 00 00 	movabs $0x800ad9,%rax
+  8005ca:	00 00 00 
+  8005cd:	ff d0                	call   *%rax
+  8005cf:	48 89 c2             	mov    %rax,%rdx
+  8005d2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005d5:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005d7:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005da:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005dd:	85 c0                	test   %eax,%eax
+  8005df:	7e 91                	jle    800572 <vprintfmt+0x24b>
+  8005e1:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005e6:	4c 89 ee             	mov    %r13,%rsi
+  8005e9:	44 89 e7             	mov    %r12d,%edi
+  8005ec:	41 ff d6             	call   *%r14
+  8005ef:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005f3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005f6:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005f9:	75 eb                	jne    8005e6 <vprintfmt+0x2bf>
+  8005fb:	e9 72 ff ff ff       	jmp    800572 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800600:	0f b6 f8             	movzbl %al,%edi
+  800603:	4c 89 ee             	mov    %r13,%rsi
+  800606:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800609:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80060d:	49 83 c4 01          	add    $0x1,%r12
+  800611:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800617:	84 c0                	test   %al,%al
+  800619:	0f 84 66 ff ff ff    	je     800585 <vprintfmt+0x25e>
+  80061f:	45 85 ff             	test   %r15d,%r15d
+  800622:	78 0a                	js     80062e <vprintfmt+0x307>
+  800624:	41 83 ef 01          	sub    $0x1,%r15d
+  800628:	0f 88 57 ff ff ff    	js     800585 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80062e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800632:	74 cc                	je     800600 <vprintfmt+0x2d9>
+  800634:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800637:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80063c:	80 fa 5e             	cmp    $0x5e,%dl
+  80063f:	77 c2                	ja     800603 <vprintfmt+0x2dc>
+  800641:	eb bd                	jmp    800600 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800643:	40 84 f6             	test   %sil,%sil
+  800646:	75 26                	jne    80066e <vprintfmt+0x347>
+    switch (lflag) {
+  800648:	85 d2                	test   %edx,%edx
+  80064a:	74 59                	je     8006a5 <vprintfmt+0x37e>
+  80064c:	83 fa 01             	cmp    $0x1,%edx
+  80064f:	74 7b                	je     8006cc <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800651:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800654:	83 f8 2f             	cmp    $0x2f,%eax
+  800657:	0f 87 96 00 00 00    	ja     8006f3 <vprintfmt+0x3cc>
+  80065d:	89 c2                	mov    %eax,%edx
+  80065f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800663:	83 c0 08             	add    $0x8,%eax
+  800666:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800669:	4c 8b 22             	mov    (%rdx),%r12
+  80066c:	eb 17                	jmp    800685 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80066e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800671:	83 f8 2f             	cmp    $0x2f,%eax
+  800674:	77 21                	ja     800697 <vprintfmt+0x370>
+  800676:	89 c2                	mov    %eax,%edx
+  800678:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80067c:	83 c0 08             	add    $0x8,%eax
+  80067f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800682:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800685:	4d 85 e4             	test   %r12,%r12
+  800688:	78 7a                	js     800704 <vprintfmt+0x3dd>
+            num = i;
+  80068a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80068d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800692:	e9 50 02 00 00       	jmp    8008e7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800697:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80069b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80069f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a3:	eb dd                	jmp    800682 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ab:	77 11                	ja     8006be <vprintfmt+0x397>
+  8006ad:	89 c2                	mov    %eax,%edx
+  8006af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b3:	83 c0 08             	add    $0x8,%eax
+  8006b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b9:	4c 63 22             	movslq (%rdx),%r12
+  8006bc:	eb c7                	jmp    800685 <vprintfmt+0x35e>
+  8006be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ca:	eb ed                	jmp    8006b9 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d2:	77 11                	ja     8006e5 <vprintfmt+0x3be>
+  8006d4:	89 c2                	mov    %eax,%edx
+  8006d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006da:	83 c0 08             	add    $0x8,%eax
+  8006dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006e0:	4c 8b 22             	mov    (%rdx),%r12
+  8006e3:	eb a0                	jmp    800685 <vprintfmt+0x35e>
+  8006e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f1:	eb ed                	jmp    8006e0 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ff:	e9 65 ff ff ff       	jmp    800669 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800704:	4c 89 ee             	mov    %r13,%rsi
+  800707:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80070c:	41 ff d6             	call   *%r14
+                i = -i;
+  80070f:	49 f7 dc             	neg    %r12
+  800712:	e9 73 ff ff ff       	jmp    80068a <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800717:	40 84 f6             	test   %sil,%sil
+  80071a:	75 32                	jne    80074e <vprintfmt+0x427>
+    switch (lflag) {
+  80071c:	85 d2                	test   %edx,%edx
+  80071e:	74 5d                	je     80077d <vprintfmt+0x456>
+  800720:	83 fa 01             	cmp    $0x1,%edx
+  800723:	0f 84 82 00 00 00    	je     8007ab <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800729:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072c:	83 f8 2f             	cmp    $0x2f,%eax
+  80072f:	0f 87 a5 00 00 00    	ja     8007da <vprintfmt+0x4b3>
+  800735:	89 c2                	mov    %eax,%edx
+  800737:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073b:	83 c0 08             	add    $0x8,%eax
+  80073e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800741:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800744:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800749:	e9 99 01 00 00       	jmp    8008e7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80074e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800751:	83 f8 2f             	cmp    $0x2f,%eax
+  800754:	77 19                	ja     80076f <vprintfmt+0x448>
+  800756:	89 c2                	mov    %eax,%edx
+  800758:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075c:	83 c0 08             	add    $0x8,%eax
+  80075f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800762:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800765:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80076a:	e9 78 01 00 00       	jmp    8008e7 <vprintfmt+0x5c0>
+  80076f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800773:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800777:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80077b:	eb e5                	jmp    800762 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80077d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800780:	83 f8 2f             	cmp    $0x2f,%eax
+  800783:	77 18                	ja     80079d <vprintfmt+0x476>
+  800785:	89 c2                	mov    %eax,%edx
+  800787:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80078b:	83 c0 08             	add    $0x8,%eax
+  80078e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800791:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800793:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800798:	e9 4a 01 00 00       	jmp    8008e7 <vprintfmt+0x5c0>
+  80079d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a9:	eb e6                	jmp    800791 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b1:	77 19                	ja     8007cc <vprintfmt+0x4a5>
+  8007b3:	89 c2                	mov    %eax,%edx
+  8007b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b9:	83 c0 08             	add    $0x8,%eax
+  8007bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007bf:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007c2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007c7:	e9 1b 01 00 00       	jmp    8008e7 <vprintfmt+0x5c0>
+  8007cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d8:	eb e5                	jmp    8007bf <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e6:	e9 56 ff ff ff       	jmp    800741 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007eb:	40 84 f6             	test   %sil,%sil
+  8007ee:	75 2e                	jne    80081e <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007f0:	85 d2                	test   %edx,%edx
+  8007f2:	74 59                	je     80084d <vprintfmt+0x526>
+  8007f4:	83 fa 01             	cmp    $0x1,%edx
+  8007f7:	74 7f                	je     800878 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ff:	0f 87 9f 00 00 00    	ja     8008a4 <vprintfmt+0x57d>
+  800805:	89 c2                	mov    %eax,%edx
+  800807:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080b:	83 c0 08             	add    $0x8,%eax
+  80080e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800811:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800814:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800819:	e9 c9 00 00 00       	jmp    8008e7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80081e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800821:	83 f8 2f             	cmp    $0x2f,%eax
+  800824:	77 19                	ja     80083f <vprintfmt+0x518>
+  800826:	89 c2                	mov    %eax,%edx
+  800828:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082c:	83 c0 08             	add    $0x8,%eax
+  80082f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800832:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800835:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80083a:	e9 a8 00 00 00       	jmp    8008e7 <vprintfmt+0x5c0>
+  80083f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800843:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800847:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084b:	eb e5                	jmp    800832 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80084d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800850:	83 f8 2f             	cmp    $0x2f,%eax
+  800853:	77 15                	ja     80086a <vprintfmt+0x543>
+  800855:	89 c2                	mov    %eax,%edx
+  800857:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085b:	83 c0 08             	add    $0x8,%eax
+  80085e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800861:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800863:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800868:	eb 7d                	jmp    8008e7 <vprintfmt+0x5c0>
+  80086a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800872:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800876:	eb e9                	jmp    800861 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800878:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087b:	83 f8 2f             	cmp    $0x2f,%eax
+  80087e:	77 16                	ja     800896 <vprintfmt+0x56f>
+  800880:	89 c2                	mov    %eax,%edx
+  800882:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800886:	83 c0 08             	add    $0x8,%eax
+  800889:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80088f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800894:	eb 51                	jmp    8008e7 <vprintfmt+0x5c0>
+  800896:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a2:	eb e8                	jmp    80088c <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b0:	e9 5c ff ff ff       	jmp    800811 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008b5:	4c 89 ee             	mov    %r13,%rsi
+  8008b8:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008bd:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008c0:	4c 89 ee             	mov    %r13,%rsi
+  8008c3:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008c8:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d1:	77 47                	ja     80091a <vprintfmt+0x5f3>
+  8008d3:	89 c2                	mov    %eax,%edx
+  8008d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d9:	83 c0 08             	add    $0x8,%eax
+  8008dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008df:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008e2:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8008eb:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008ef:	0f 94 c0             	sete   %al
+  8008f2:	0f b6 c0             	movzbl %al,%eax
+  8008f5:	50                   	push   %rax
+  8008f6:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008fb:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008ff:	4c 89 ee             	mov    %r13,%rsi
+  800902:	4c 89 f7             	mov    %r14,%rdi
+  800905:	48 b8 1c 02 80 00 00 	movabs $0x80021c,%rax
+  80090c:	00 00 00 
+  80090f:	ff d0                	call   *%rax
+            break;
+  800911:	48 83 c4 10          	add    $0x10,%rsp
+  800915:	e9 3e fa ff ff       	jmp    800358 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80091a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800922:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800926:	eb b7                	jmp    8008df <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800928:	40 84 f6             	test   %sil,%sil
+  80092b:	75 2b                	jne    800958 <vprintfmt+0x631>
+    switch (lflag) {
+  80092d:	85 d2                	test   %edx,%edx
+  80092f:	74 56                	je     800987 <vprintfmt+0x660>
+  800931:	83 fa 01             	cmp    $0x1,%edx
+  800934:	74 7f                	je     8009b5 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800936:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800939:	83 f8 2f             	cmp    $0x2f,%eax
+  80093c:	0f 87 a2 00 00 00    	ja     8009e4 <vprintfmt+0x6bd>
+  800942:	89 c2                	mov    %eax,%edx
+  800944:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800948:	83 c0 08             	add    $0x8,%eax
+  80094b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800951:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800956:	eb 8f                	jmp    8008e7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800958:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095b:	83 f8 2f             	cmp    $0x2f,%eax
+  80095e:	77 19                	ja     800979 <vprintfmt+0x652>
+  800960:	89 c2                	mov    %eax,%edx
+  800962:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800966:	83 c0 08             	add    $0x8,%eax
+  800969:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80096f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800974:	e9 6e ff ff ff       	jmp    8008e7 <vprintfmt+0x5c0>
+  800979:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800981:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800985:	eb e5                	jmp    80096c <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800987:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098a:	83 f8 2f             	cmp    $0x2f,%eax
+  80098d:	77 18                	ja     8009a7 <vprintfmt+0x680>
+  80098f:	89 c2                	mov    %eax,%edx
+  800991:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800995:	83 c0 08             	add    $0x8,%eax
+  800998:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099b:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80099d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009a2:	e9 40 ff ff ff       	jmp    8008e7 <vprintfmt+0x5c0>
+  8009a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b3:	eb e6                	jmp    80099b <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009bb:	77 19                	ja     8009d6 <vprintfmt+0x6af>
+  8009bd:	89 c2                	mov    %eax,%edx
+  8009bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c3:	83 c0 08             	add    $0x8,%eax
+  8009c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009cc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009d1:	e9 11 ff ff ff       	jmp    8008e7 <vprintfmt+0x5c0>
+  8009d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e2:	eb e5                	jmp    8009c9 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009e4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f0:	e9 59 ff ff ff       	jmp    80094e <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009f5:	4c 89 ee             	mov    %r13,%rsi
+  8009f8:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009fd:	41 ff d6             	call   *%r14
+            break;
+  800a00:	e9 53 f9 ff ff       	jmp    800358 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a05:	4c 89 ee             	mov    %r13,%rsi
+  800a08:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a0d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a10:	48 83 eb 01          	sub    $0x1,%rbx
+  800a14:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a18:	75 f6                	jne    800a10 <vprintfmt+0x6e9>
+  800a1a:	e9 39 f9 ff ff       	jmp    800358 <vprintfmt+0x31>
+}
+  800a1f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a23:	5b                   	pop    %rbx
+  800a24:	41 5c                	pop    %r12
+  800a26:	41 5d                	pop    %r13
+  800a28:	41 5e                	pop    %r14
+  800a2a:	41 5f                	pop    %r15
+  800a2c:	5d                   	pop    %rbp
+  800a2d:	c3                   	ret
+
+0000000000800a2e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a2e:	55                   	push   %rbp
+  800a2f:	48 89 e5             	mov    %rsp,%rbp
+  800a32:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a36:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a3a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a3f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a43:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a4a:	48 85 ff             	test   %rdi,%rdi
+  800a4d:	74 2b                	je     800a7a <vsnprintf+0x4c>
+  800a4f:	48 85 f6             	test   %rsi,%rsi
+  800a52:	74 26                	je     800a7a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a54:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a58:	48 bf d2 02 80 00 00 	movabs $0x8002d2,%rdi
+  800a5f:	00 00 00 
+  800a62:	48 b8 27 03 80 00 00 	movabs $0x800327,%rax
+  800a69:	00 00 00 
+  800a6c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a72:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a75:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a78:	c9                   	leave
+  800a79:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a7a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a7f:	eb f7                	jmp    800a78 <vsnprintf+0x4a>
+
+0000000000800a81 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a81:	55                   	push   %rbp
+  800a82:	48 89 e5             	mov    %rsp,%rbp
+  800a85:	48 83 ec 50          	sub    $0x50,%rsp
+  800a89:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a8d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a91:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a95:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a9c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800aa0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aa8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800aac:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ab0:	48 b8 2e 0a 80 00 00 	movabs $0x800a2e,%rax
+  800ab7:	00 00 00 
+  800aba:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800abc:	c9                   	leave
+  800abd:	c3                   	ret
+
+0000000000800abe <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800abe:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ac1:	74 10                	je     800ad3 <strlen+0x15>
+    size_t n = 0;
+  800ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ac8:	48 83 c0 01          	add    $0x1,%rax
+  800acc:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ad0:	75 f6                	jne    800ac8 <strlen+0xa>
+  800ad2:	c3                   	ret
+    size_t n = 0;
+  800ad3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ad8:	c3                   	ret
+
+0000000000800ad9 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ad9:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800adc:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ae1:	48 85 f6             	test   %rsi,%rsi
+  800ae4:	74 11                	je     800af7 <strnlen+0x1e>
+  800ae6:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800aea:	74 0c                	je     800af8 <strnlen+0x1f>
+  800aec:	48 83 c2 01          	add    $0x1,%rdx
+  800af0:	48 39 d0             	cmp    %rdx,%rax
+  800af3:	75 f1                	jne    800ae6 <strnlen+0xd>
+  800af5:	eb 04                	jmp    800afb <strnlen+0x22>
+  800af7:	c3                   	ret
+  800af8:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800afb:	c3                   	ret
+
+0000000000800afc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800afc:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800aff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b04:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b08:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b0b:	48 83 c2 01          	add    $0x1,%rdx
+  800b0f:	84 c9                	test   %cl,%cl
+  800b11:	75 f1                	jne    800b04 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b13:	c3                   	ret
+
+0000000000800b14 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b14:	55                   	push   %rbp
+  800b15:	48 89 e5             	mov    %rsp,%rbp
+  800b18:	41 54                	push   %r12
+  800b1a:	53                   	push   %rbx
+  800b1b:	48 89 fb             	mov    %rdi,%rbx
+  800b1e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b21:	48 b8 be 0a 80 00 00 	movabs $0x800abe,%rax
+  800b28:	00 00 00 
+  800b2b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b2d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b31:	4c 89 e6             	mov    %r12,%rsi
+  800b34:	48 b8 fc 0a 80 00 00 	movabs $0x800afc,%rax
+  800b3b:	00 00 00 
+  800b3e:	ff d0                	call   *%rax
+    return dst;
+}
+  800b40:	48 89 d8             	mov    %rbx,%rax
+  800b43:	5b                   	pop    %rbx
+  800b44:	41 5c                	pop    %r12
+  800b46:	5d                   	pop    %rbp
+  800b47:	c3                   	ret
+
+0000000000800b48 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b48:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b4b:	48 85 d2             	test   %rdx,%rdx
+  800b4e:	74 1f                	je     800b6f <strncpy+0x27>
+  800b50:	48 01 fa             	add    %rdi,%rdx
+  800b53:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b56:	48 83 c1 01          	add    $0x1,%rcx
+  800b5a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b5e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b62:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b66:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b6a:	48 39 ca             	cmp    %rcx,%rdx
+  800b6d:	75 e7                	jne    800b56 <strncpy+0xe>
+    }
+    return ret;
+}
+  800b6f:	c3                   	ret
+
+0000000000800b70 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b70:	48 89 f8             	mov    %rdi,%rax
+  800b73:	48 85 d2             	test   %rdx,%rdx
+  800b76:	74 24                	je     800b9c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b78:	48 83 ea 01          	sub    $0x1,%rdx
+  800b7c:	74 1b                	je     800b99 <strlcpy+0x29>
+  800b7e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b82:	0f b6 16             	movzbl (%rsi),%edx
+  800b85:	84 d2                	test   %dl,%dl
+  800b87:	74 10                	je     800b99 <strlcpy+0x29>
+            *dst++ = *src++;
+  800b89:	48 83 c6 01          	add    $0x1,%rsi
+  800b8d:	48 83 c0 01          	add    $0x1,%rax
+  800b91:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b94:	48 39 c8             	cmp    %rcx,%rax
+  800b97:	75 e9                	jne    800b82 <strlcpy+0x12>
+        *dst = '\0';
+  800b99:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800b9c:	48 29 f8             	sub    %rdi,%rax
+}
+  800b9f:	c3                   	ret
+
+0000000000800ba0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ba0:	0f b6 07             	movzbl (%rdi),%eax
+  800ba3:	84 c0                	test   %al,%al
+  800ba5:	74 13                	je     800bba <strcmp+0x1a>
+  800ba7:	38 06                	cmp    %al,(%rsi)
+  800ba9:	75 0f                	jne    800bba <strcmp+0x1a>
+  800bab:	48 83 c7 01          	add    $0x1,%rdi
+  800baf:	48 83 c6 01          	add    $0x1,%rsi
+  800bb3:	0f b6 07             	movzbl (%rdi),%eax
+  800bb6:	84 c0                	test   %al,%al
+  800bb8:	75 ed                	jne    800ba7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bba:	0f b6 c0             	movzbl %al,%eax
+  800bbd:	0f b6 16             	movzbl (%rsi),%edx
+  800bc0:	29 d0                	sub    %edx,%eax
+}
+  800bc2:	c3                   	ret
+
+0000000000800bc3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bc3:	48 85 d2             	test   %rdx,%rdx
+  800bc6:	74 1f                	je     800be7 <strncmp+0x24>
+  800bc8:	0f b6 07             	movzbl (%rdi),%eax
+  800bcb:	84 c0                	test   %al,%al
+  800bcd:	74 1e                	je     800bed <strncmp+0x2a>
+  800bcf:	3a 06                	cmp    (%rsi),%al
+  800bd1:	75 1a                	jne    800bed <strncmp+0x2a>
+  800bd3:	48 83 c7 01          	add    $0x1,%rdi
+  800bd7:	48 83 c6 01          	add    $0x1,%rsi
+  800bdb:	48 83 ea 01          	sub    $0x1,%rdx
+  800bdf:	75 e7                	jne    800bc8 <strncmp+0x5>
+
+    if (!n) return 0;
+  800be1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be6:	c3                   	ret
+  800be7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bec:	c3                   	ret
+  800bed:	48 85 d2             	test   %rdx,%rdx
+  800bf0:	74 09                	je     800bfb <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bf2:	0f b6 07             	movzbl (%rdi),%eax
+  800bf5:	0f b6 16             	movzbl (%rsi),%edx
+  800bf8:	29 d0                	sub    %edx,%eax
+  800bfa:	c3                   	ret
+    if (!n) return 0;
+  800bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c00:	c3                   	ret
+
+0000000000800c01 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c01:	0f b6 17             	movzbl (%rdi),%edx
+  800c04:	84 d2                	test   %dl,%dl
+  800c06:	74 18                	je     800c20 <strchr+0x1f>
+        if (*str == c) {
+  800c08:	0f be d2             	movsbl %dl,%edx
+  800c0b:	39 f2                	cmp    %esi,%edx
+  800c0d:	74 17                	je     800c26 <strchr+0x25>
+    for (; *str; str++) {
+  800c0f:	48 83 c7 01          	add    $0x1,%rdi
+  800c13:	0f b6 17             	movzbl (%rdi),%edx
+  800c16:	84 d2                	test   %dl,%dl
+  800c18:	75 ee                	jne    800c08 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1f:	c3                   	ret
+  800c20:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c25:	c3                   	ret
+  800c26:	48 89 f8             	mov    %rdi,%rax
+}
+  800c29:	c3                   	ret
+
+0000000000800c2a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c2a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c2d:	0f b6 17             	movzbl (%rdi),%edx
+  800c30:	84 d2                	test   %dl,%dl
+  800c32:	74 13                	je     800c47 <strfind+0x1d>
+  800c34:	0f be d2             	movsbl %dl,%edx
+  800c37:	39 f2                	cmp    %esi,%edx
+  800c39:	74 0b                	je     800c46 <strfind+0x1c>
+  800c3b:	48 83 c0 01          	add    $0x1,%rax
+  800c3f:	0f b6 10             	movzbl (%rax),%edx
+  800c42:	84 d2                	test   %dl,%dl
+  800c44:	75 ee                	jne    800c34 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c46:	c3                   	ret
+  800c47:	c3                   	ret
+
+0000000000800c48 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c48:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c4b:	48 89 f8             	mov    %rdi,%rax
+  800c4e:	48 f7 d8             	neg    %rax
+  800c51:	83 e0 07             	and    $0x7,%eax
+  800c54:	49 89 d1             	mov    %rdx,%r9
+  800c57:	49 29 c1             	sub    %rax,%r9
+  800c5a:	78 36                	js     800c92 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c5c:	40 0f b6 c6          	movzbl %sil,%eax
+  800c60:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c67:	01 01 01 
+  800c6a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c6e:	40 f6 c7 07          	test   $0x7,%dil
+  800c72:	75 38                	jne    800cac <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c74:	4c 89 c9             	mov    %r9,%rcx
+  800c77:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c7b:	74 0c                	je     800c89 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c7d:	fc                   	cld
+  800c7e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c81:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c85:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c89:	4d 85 c9             	test   %r9,%r9
+  800c8c:	75 45                	jne    800cd3 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c8e:	4c 89 c0             	mov    %r8,%rax
+  800c91:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c92:	48 85 d2             	test   %rdx,%rdx
+  800c95:	74 f7                	je     800c8e <memset+0x46>
+  800c97:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c9a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800c9d:	48 83 c0 01          	add    $0x1,%rax
+  800ca1:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ca5:	48 39 c2             	cmp    %rax,%rdx
+  800ca8:	75 f3                	jne    800c9d <memset+0x55>
+  800caa:	eb e2                	jmp    800c8e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800cac:	40 f6 c7 01          	test   $0x1,%dil
+  800cb0:	74 06                	je     800cb8 <memset+0x70>
+  800cb2:	88 07                	mov    %al,(%rdi)
+  800cb4:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cb8:	40 f6 c7 02          	test   $0x2,%dil
+  800cbc:	74 07                	je     800cc5 <memset+0x7d>
+  800cbe:	66 89 07             	mov    %ax,(%rdi)
+  800cc1:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cc5:	40 f6 c7 04          	test   $0x4,%dil
+  800cc9:	74 a9                	je     800c74 <memset+0x2c>
+  800ccb:	89 07                	mov    %eax,(%rdi)
+  800ccd:	48 83 c7 04          	add    $0x4,%rdi
+  800cd1:	eb a1                	jmp    800c74 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cd3:	41 f6 c1 04          	test   $0x4,%r9b
+  800cd7:	74 06                	je     800cdf <memset+0x97>
+  800cd9:	89 07                	mov    %eax,(%rdi)
+  800cdb:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cdf:	41 f6 c1 02          	test   $0x2,%r9b
+  800ce3:	74 07                	je     800cec <memset+0xa4>
+  800ce5:	66 89 07             	mov    %ax,(%rdi)
+  800ce8:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800cec:	41 f6 c1 01          	test   $0x1,%r9b
+  800cf0:	74 9c                	je     800c8e <memset+0x46>
+  800cf2:	88 07                	mov    %al,(%rdi)
+  800cf4:	eb 98                	jmp    800c8e <memset+0x46>
+
+0000000000800cf6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800cf6:	48 89 f8             	mov    %rdi,%rax
+  800cf9:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800cfc:	48 39 fe             	cmp    %rdi,%rsi
+  800cff:	73 3b                	jae    800d3c <memmove+0x46>
+  800d01:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d05:	48 39 d7             	cmp    %rdx,%rdi
+  800d08:	73 32                	jae    800d3c <memmove+0x46>
+        s += n;
+        d += n;
+  800d0a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d0e:	48 89 d6             	mov    %rdx,%rsi
+  800d11:	48 09 fe             	or     %rdi,%rsi
+  800d14:	48 09 ce             	or     %rcx,%rsi
+  800d17:	40 f6 c6 07          	test   $0x7,%sil
+  800d1b:	75 12                	jne    800d2f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d1d:	48 83 ef 08          	sub    $0x8,%rdi
+  800d21:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d25:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d29:	fd                   	std
+  800d2a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d2d:	fc                   	cld
+  800d2e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d2f:	48 83 ef 01          	sub    $0x1,%rdi
+  800d33:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d37:	fd                   	std
+  800d38:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d3a:	eb f1                	jmp    800d2d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d3c:	48 89 f2             	mov    %rsi,%rdx
+  800d3f:	48 09 c2             	or     %rax,%rdx
+  800d42:	48 09 ca             	or     %rcx,%rdx
+  800d45:	f6 c2 07             	test   $0x7,%dl
+  800d48:	75 0c                	jne    800d56 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d4a:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d4e:	48 89 c7             	mov    %rax,%rdi
+  800d51:	fc                   	cld
+  800d52:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d55:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d56:	48 89 c7             	mov    %rax,%rdi
+  800d59:	fc                   	cld
+  800d5a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d5c:	c3                   	ret
+
+0000000000800d5d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d5d:	55                   	push   %rbp
+  800d5e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d61:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  800d68:	00 00 00 
+  800d6b:	ff d0                	call   *%rax
+}
+  800d6d:	5d                   	pop    %rbp
+  800d6e:	c3                   	ret
+
+0000000000800d6f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d6f:	55                   	push   %rbp
+  800d70:	48 89 e5             	mov    %rsp,%rbp
+  800d73:	41 57                	push   %r15
+  800d75:	41 56                	push   %r14
+  800d77:	41 55                	push   %r13
+  800d79:	41 54                	push   %r12
+  800d7b:	53                   	push   %rbx
+  800d7c:	48 83 ec 08          	sub    $0x8,%rsp
+  800d80:	49 89 fe             	mov    %rdi,%r14
+  800d83:	49 89 f7             	mov    %rsi,%r15
+  800d86:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d89:	48 89 f7             	mov    %rsi,%rdi
+  800d8c:	48 b8 be 0a 80 00 00 	movabs $0x800abe,%rax
+  800d93:	00 00 00 
+  800d96:	ff d0                	call   *%rax
+  800d98:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d9b:	48 89 de             	mov    %rbx,%rsi
+  800d9e:	4c 89 f7             	mov    %r14,%rdi
+  800da1:	48 b8 d9 0a 80 00 00 	movabs $0x800ad9,%rax
+  800da8:	00 00 00 
+  800dab:	ff d0                	call   *%rax
+  800dad:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800db0:	48 39 c3             	cmp    %rax,%rbx
+  800db3:	74 36                	je     800deb <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800db5:	48 89 d8             	mov    %rbx,%rax
+  800db8:	4c 29 e8             	sub    %r13,%rax
+  800dbb:	49 39 c4             	cmp    %rax,%r12
+  800dbe:	73 31                	jae    800df1 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800dc0:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dc5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dc9:	4c 89 fe             	mov    %r15,%rsi
+  800dcc:	48 b8 5d 0d 80 00 00 	movabs $0x800d5d,%rax
+  800dd3:	00 00 00 
+  800dd6:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dd8:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ddc:	48 83 c4 08          	add    $0x8,%rsp
+  800de0:	5b                   	pop    %rbx
+  800de1:	41 5c                	pop    %r12
+  800de3:	41 5d                	pop    %r13
+  800de5:	41 5e                	pop    %r14
+  800de7:	41 5f                	pop    %r15
+  800de9:	5d                   	pop    %rbp
+  800dea:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800deb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800def:	eb eb                	jmp    800ddc <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800df1:	48 83 eb 01          	sub    $0x1,%rbx
+  800df5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800df9:	48 89 da             	mov    %rbx,%rdx
+  800dfc:	4c 89 fe             	mov    %r15,%rsi
+  800dff:	48 b8 5d 0d 80 00 00 	movabs $0x800d5d,%rax
+  800e06:	00 00 00 
+  800e09:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e0b:	49 01 de             	add    %rbx,%r14
+  800e0e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e13:	eb c3                	jmp    800dd8 <strlcat+0x69>
+
+0000000000800e15 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e15:	48 85 d2             	test   %rdx,%rdx
+  800e18:	74 2d                	je     800e47 <memcmp+0x32>
+  800e1a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e1f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e23:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e28:	44 38 c1             	cmp    %r8b,%cl
+  800e2b:	75 0f                	jne    800e3c <memcmp+0x27>
+    while (n-- > 0) {
+  800e2d:	48 83 c0 01          	add    $0x1,%rax
+  800e31:	48 39 c2             	cmp    %rax,%rdx
+  800e34:	75 e9                	jne    800e1f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e36:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e3c:	0f b6 c1             	movzbl %cl,%eax
+  800e3f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e43:	44 29 c0             	sub    %r8d,%eax
+  800e46:	c3                   	ret
+    return 0;
+  800e47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e4c:	c3                   	ret
+
+0000000000800e4d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e4d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e51:	48 39 c7             	cmp    %rax,%rdi
+  800e54:	73 0f                	jae    800e65 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e56:	40 38 37             	cmp    %sil,(%rdi)
+  800e59:	74 0e                	je     800e69 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e5b:	48 83 c7 01          	add    $0x1,%rdi
+  800e5f:	48 39 f8             	cmp    %rdi,%rax
+  800e62:	75 f2                	jne    800e56 <memfind+0x9>
+  800e64:	c3                   	ret
+  800e65:	48 89 f8             	mov    %rdi,%rax
+  800e68:	c3                   	ret
+  800e69:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e6c:	c3                   	ret
+
+0000000000800e6d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e6d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e70:	0f b6 37             	movzbl (%rdi),%esi
+  800e73:	40 80 fe 20          	cmp    $0x20,%sil
+  800e77:	74 06                	je     800e7f <strtol+0x12>
+  800e79:	40 80 fe 09          	cmp    $0x9,%sil
+  800e7d:	75 13                	jne    800e92 <strtol+0x25>
+  800e7f:	48 83 c7 01          	add    $0x1,%rdi
+  800e83:	0f b6 37             	movzbl (%rdi),%esi
+  800e86:	40 80 fe 20          	cmp    $0x20,%sil
+  800e8a:	74 f3                	je     800e7f <strtol+0x12>
+  800e8c:	40 80 fe 09          	cmp    $0x9,%sil
+  800e90:	74 ed                	je     800e7f <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e92:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e95:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e98:	3c 01                	cmp    $0x1,%al
+  800e9a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800e9e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ea4:	75 0f                	jne    800eb5 <strtol+0x48>
+  800ea6:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ea9:	74 14                	je     800ebf <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800eab:	85 d2                	test   %edx,%edx
+  800ead:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eb2:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800eb5:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800eba:	4c 63 ca             	movslq %edx,%r9
+  800ebd:	eb 36                	jmp    800ef5 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ebf:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ec3:	74 0f                	je     800ed4 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ec5:	85 d2                	test   %edx,%edx
+  800ec7:	75 ec                	jne    800eb5 <strtol+0x48>
+        s++;
+  800ec9:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ecd:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ed2:	eb e1                	jmp    800eb5 <strtol+0x48>
+        s += 2;
+  800ed4:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ed8:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800edd:	eb d6                	jmp    800eb5 <strtol+0x48>
+            dig -= '0';
+  800edf:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ee2:	44 0f b6 c1          	movzbl %cl,%r8d
+  800ee6:	41 39 d0             	cmp    %edx,%r8d
+  800ee9:	7d 21                	jge    800f0c <strtol+0x9f>
+        val = val * base + dig;
+  800eeb:	49 0f af c1          	imul   %r9,%rax
+  800eef:	0f b6 c9             	movzbl %cl,%ecx
+  800ef2:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800ef5:	48 83 c7 01          	add    $0x1,%rdi
+  800ef9:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800efd:	80 f9 39             	cmp    $0x39,%cl
+  800f00:	76 dd                	jbe    800edf <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f02:	80 f9 7b             	cmp    $0x7b,%cl
+  800f05:	77 05                	ja     800f0c <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f07:	83 e9 57             	sub    $0x57,%ecx
+  800f0a:	eb d6                	jmp    800ee2 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f0c:	4d 85 d2             	test   %r10,%r10
+  800f0f:	74 03                	je     800f14 <strtol+0xa7>
+  800f11:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f14:	48 89 c2             	mov    %rax,%rdx
+  800f17:	48 f7 da             	neg    %rdx
+  800f1a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f1e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f22:	c3                   	ret
+
+0000000000800f23 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f23:	55                   	push   %rbp
+  800f24:	48 89 e5             	mov    %rsp,%rbp
+  800f27:	53                   	push   %rbx
+  800f28:	48 89 fa             	mov    %rdi,%rdx
+  800f2b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f2e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f38:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f3d:	be 00 00 00 00       	mov    $0x0,%esi
+  800f42:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f48:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f4a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f4e:	c9                   	leave
+  800f4f:	c3                   	ret
+
+0000000000800f50 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f50:	55                   	push   %rbp
+  800f51:	48 89 e5             	mov    %rsp,%rbp
+  800f54:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f55:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f69:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f6e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f73:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f79:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f7b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f7f:	c9                   	leave
+  800f80:	c3                   	ret
+
+0000000000800f81 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800f81:	55                   	push   %rbp
+  800f82:	48 89 e5             	mov    %rsp,%rbp
+  800f85:	53                   	push   %rbx
+  800f86:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f8a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800f8d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f92:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fa1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fac:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800fae:	48 85 c0             	test   %rax,%rax
+  800fb1:	7f 06                	jg     800fb9 <sys_env_destroy+0x38>
+}
+  800fb3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fb7:	c9                   	leave
+  800fb8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fb9:	49 89 c0             	mov    %rax,%r8
+  800fbc:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fc1:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  800fc8:	00 00 00 
+  800fcb:	be 26 00 00 00       	mov    $0x26,%esi
+  800fd0:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  800fd7:	00 00 00 
+  800fda:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdf:	49 b9 21 29 80 00 00 	movabs $0x802921,%r9
+  800fe6:	00 00 00 
+  800fe9:	41 ff d1             	call   *%r9
+
+0000000000800fec <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800fec:	55                   	push   %rbp
+  800fed:	48 89 e5             	mov    %rsp,%rbp
+  800ff0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800ff1:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800ff6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ffb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801000:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801005:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80100a:	be 00 00 00 00       	mov    $0x0,%esi
+  80100f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801015:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801017:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80101b:	c9                   	leave
+  80101c:	c3                   	ret
+
+000000000080101d <sys_yield>:
+
+void
+sys_yield(void) {
+  80101d:	55                   	push   %rbp
+  80101e:	48 89 e5             	mov    %rsp,%rbp
+  801021:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801022:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801027:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801031:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801036:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80103b:	be 00 00 00 00       	mov    $0x0,%esi
+  801040:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801046:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801048:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80104c:	c9                   	leave
+  80104d:	c3                   	ret
+
+000000000080104e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80104e:	55                   	push   %rbp
+  80104f:	48 89 e5             	mov    %rsp,%rbp
+  801052:	53                   	push   %rbx
+  801053:	48 89 fa             	mov    %rdi,%rdx
+  801056:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801059:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80105e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801065:	00 00 00 
+  801068:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80106d:	be 00 00 00 00       	mov    $0x0,%esi
+  801072:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801078:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80107a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80107e:	c9                   	leave
+  80107f:	c3                   	ret
+
+0000000000801080 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801080:	55                   	push   %rbp
+  801081:	48 89 e5             	mov    %rsp,%rbp
+  801084:	53                   	push   %rbx
+  801085:	49 89 f8             	mov    %rdi,%r8
+  801088:	48 89 d3             	mov    %rdx,%rbx
+  80108b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80108e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801093:	4c 89 c2             	mov    %r8,%rdx
+  801096:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801099:	be 00 00 00 00       	mov    $0x0,%esi
+  80109e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010a4:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8010a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010aa:	c9                   	leave
+  8010ab:	c3                   	ret
+
+00000000008010ac <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8010ac:	55                   	push   %rbp
+  8010ad:	48 89 e5             	mov    %rsp,%rbp
+  8010b0:	53                   	push   %rbx
+  8010b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8010b5:	89 f8                	mov    %edi,%eax
+  8010b7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010ba:	48 63 f9             	movslq %ecx,%rdi
+  8010bd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010c0:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8010cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010d3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010d5:	48 85 c0             	test   %rax,%rax
+  8010d8:	7f 06                	jg     8010e0 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8010da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010de:	c9                   	leave
+  8010df:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010e0:	49 89 c0             	mov    %rax,%r8
+  8010e3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8010e8:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8010ef:	00 00 00 
+  8010f2:	be 26 00 00 00       	mov    $0x26,%esi
+  8010f7:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  8010fe:	00 00 00 
+  801101:	b8 00 00 00 00       	mov    $0x0,%eax
+  801106:	49 b9 21 29 80 00 00 	movabs $0x802921,%r9
+  80110d:	00 00 00 
+  801110:	41 ff d1             	call   *%r9
+
+0000000000801113 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801113:	55                   	push   %rbp
+  801114:	48 89 e5             	mov    %rsp,%rbp
+  801117:	53                   	push   %rbx
+  801118:	48 83 ec 08          	sub    $0x8,%rsp
+  80111c:	89 f8                	mov    %edi,%eax
+  80111e:	49 89 f2             	mov    %rsi,%r10
+  801121:	48 89 cf             	mov    %rcx,%rdi
+  801124:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801127:	48 63 da             	movslq %edx,%rbx
+  80112a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80112d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801132:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801135:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801138:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80113a:	48 85 c0             	test   %rax,%rax
+  80113d:	7f 06                	jg     801145 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80113f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801143:	c9                   	leave
+  801144:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801145:	49 89 c0             	mov    %rax,%r8
+  801148:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80114d:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  801154:	00 00 00 
+  801157:	be 26 00 00 00       	mov    $0x26,%esi
+  80115c:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  801163:	00 00 00 
+  801166:	b8 00 00 00 00       	mov    $0x0,%eax
+  80116b:	49 b9 21 29 80 00 00 	movabs $0x802921,%r9
+  801172:	00 00 00 
+  801175:	41 ff d1             	call   *%r9
+
+0000000000801178 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801178:	55                   	push   %rbp
+  801179:	48 89 e5             	mov    %rsp,%rbp
+  80117c:	53                   	push   %rbx
+  80117d:	48 83 ec 08          	sub    $0x8,%rsp
+  801181:	48 89 f1             	mov    %rsi,%rcx
+  801184:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801187:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80118a:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80118f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801194:	be 00 00 00 00       	mov    $0x0,%esi
+  801199:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80119f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011a1:	48 85 c0             	test   %rax,%rax
+  8011a4:	7f 06                	jg     8011ac <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8011a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011aa:	c9                   	leave
+  8011ab:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011ac:	49 89 c0             	mov    %rax,%r8
+  8011af:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011b4:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8011bb:	00 00 00 
+  8011be:	be 26 00 00 00       	mov    $0x26,%esi
+  8011c3:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  8011ca:	00 00 00 
+  8011cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d2:	49 b9 21 29 80 00 00 	movabs $0x802921,%r9
+  8011d9:	00 00 00 
+  8011dc:	41 ff d1             	call   *%r9
+
+00000000008011df <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8011df:	55                   	push   %rbp
+  8011e0:	48 89 e5             	mov    %rsp,%rbp
+  8011e3:	53                   	push   %rbx
+  8011e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8011e8:	89 f8                	mov    %edi,%eax
+  8011ea:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8011ed:	48 63 f9             	movslq %ecx,%rdi
+  8011f0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f3:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011f8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801200:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801206:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801208:	48 85 c0             	test   %rax,%rax
+  80120b:	7f 06                	jg     801213 <sys_region_advise+0x34>
+}
+  80120d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801211:	c9                   	leave
+  801212:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801213:	49 89 c0             	mov    %rax,%r8
+  801216:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80121b:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  801222:	00 00 00 
+  801225:	be 26 00 00 00       	mov    $0x26,%esi
+  80122a:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  801231:	00 00 00 
+  801234:	b8 00 00 00 00       	mov    $0x0,%eax
+  801239:	49 b9 21 29 80 00 00 	movabs $0x802921,%r9
+  801240:	00 00 00 
+  801243:	41 ff d1             	call   *%r9
+
+0000000000801246 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801246:	55                   	push   %rbp
+  801247:	48 89 e5             	mov    %rsp,%rbp
+  80124a:	53                   	push   %rbx
+  80124b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80124f:	48 63 ce             	movslq %esi,%rcx
+  801252:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801255:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80125a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801264:	be 00 00 00 00       	mov    $0x0,%esi
+  801269:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80126f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801271:	48 85 c0             	test   %rax,%rax
+  801274:	7f 06                	jg     80127c <sys_env_set_nice+0x36>
+}
+  801276:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127a:	c9                   	leave
+  80127b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80127c:	49 89 c0             	mov    %rax,%r8
+  80127f:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801284:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  80128b:	00 00 00 
+  80128e:	be 26 00 00 00       	mov    $0x26,%esi
+  801293:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  80129a:	00 00 00 
+  80129d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a2:	49 b9 21 29 80 00 00 	movabs $0x802921,%r9
+  8012a9:	00 00 00 
+  8012ac:	41 ff d1             	call   *%r9
+
+00000000008012af <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8012af:	55                   	push   %rbp
+  8012b0:	48 89 e5             	mov    %rsp,%rbp
+  8012b3:	53                   	push   %rbx
+  8012b4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012b8:	48 63 ce             	movslq %esi,%rcx
+  8012bb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012be:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012da:	48 85 c0             	test   %rax,%rax
+  8012dd:	7f 06                	jg     8012e5 <sys_env_set_status+0x36>
+}
+  8012df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e3:	c9                   	leave
+  8012e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012e5:	49 89 c0             	mov    %rax,%r8
+  8012e8:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012ed:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8012f4:	00 00 00 
+  8012f7:	be 26 00 00 00       	mov    $0x26,%esi
+  8012fc:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  801303:	00 00 00 
+  801306:	b8 00 00 00 00       	mov    $0x0,%eax
+  80130b:	49 b9 21 29 80 00 00 	movabs $0x802921,%r9
+  801312:	00 00 00 
+  801315:	41 ff d1             	call   *%r9
+
+0000000000801318 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801318:	55                   	push   %rbp
+  801319:	48 89 e5             	mov    %rsp,%rbp
+  80131c:	53                   	push   %rbx
+  80131d:	48 83 ec 08          	sub    $0x8,%rsp
+  801321:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801324:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801327:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80132c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801331:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801336:	be 00 00 00 00       	mov    $0x0,%esi
+  80133b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801341:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801343:	48 85 c0             	test   %rax,%rax
+  801346:	7f 06                	jg     80134e <sys_env_set_trapframe+0x36>
+}
+  801348:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80134c:	c9                   	leave
+  80134d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80134e:	49 89 c0             	mov    %rax,%r8
+  801351:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801356:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  80135d:	00 00 00 
+  801360:	be 26 00 00 00       	mov    $0x26,%esi
+  801365:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  80136c:	00 00 00 
+  80136f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801374:	49 b9 21 29 80 00 00 	movabs $0x802921,%r9
+  80137b:	00 00 00 
+  80137e:	41 ff d1             	call   *%r9
+
+0000000000801381 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801381:	55                   	push   %rbp
+  801382:	48 89 e5             	mov    %rsp,%rbp
+  801385:	53                   	push   %rbx
+  801386:	48 83 ec 08          	sub    $0x8,%rsp
+  80138a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80138d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801390:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801395:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80139f:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013aa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013ac:	48 85 c0             	test   %rax,%rax
+  8013af:	7f 06                	jg     8013b7 <sys_env_set_pgfault_upcall+0x36>
+}
+  8013b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b5:	c9                   	leave
+  8013b6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013b7:	49 89 c0             	mov    %rax,%r8
+  8013ba:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013bf:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8013c6:	00 00 00 
+  8013c9:	be 26 00 00 00       	mov    $0x26,%esi
+  8013ce:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  8013d5:	00 00 00 
+  8013d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013dd:	49 b9 21 29 80 00 00 	movabs $0x802921,%r9
+  8013e4:	00 00 00 
+  8013e7:	41 ff d1             	call   *%r9
+
+00000000008013ea <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013ea:	55                   	push   %rbp
+  8013eb:	48 89 e5             	mov    %rsp,%rbp
+  8013ee:	53                   	push   %rbx
+  8013ef:	89 f8                	mov    %edi,%eax
+  8013f1:	49 89 f1             	mov    %rsi,%r9
+  8013f4:	48 89 d3             	mov    %rdx,%rbx
+  8013f7:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8013fa:	49 63 f0             	movslq %r8d,%rsi
+  8013fd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801400:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801405:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801408:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80140e:	cd 30                	int    $0x30
+}
+  801410:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801414:	c9                   	leave
+  801415:	c3                   	ret
+
+0000000000801416 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801416:	55                   	push   %rbp
+  801417:	48 89 e5             	mov    %rsp,%rbp
+  80141a:	53                   	push   %rbx
+  80141b:	48 83 ec 08          	sub    $0x8,%rsp
+  80141f:	48 89 fa             	mov    %rdi,%rdx
+  801422:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801425:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80142a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801434:	be 00 00 00 00       	mov    $0x0,%esi
+  801439:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80143f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801441:	48 85 c0             	test   %rax,%rax
+  801444:	7f 06                	jg     80144c <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801446:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144a:	c9                   	leave
+  80144b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80144c:	49 89 c0             	mov    %rax,%r8
+  80144f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801454:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  80145b:	00 00 00 
+  80145e:	be 26 00 00 00       	mov    $0x26,%esi
+  801463:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  80146a:	00 00 00 
+  80146d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801472:	49 b9 21 29 80 00 00 	movabs $0x802921,%r9
+  801479:	00 00 00 
+  80147c:	41 ff d1             	call   *%r9
+
+000000000080147f <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80147f:	55                   	push   %rbp
+  801480:	48 89 e5             	mov    %rsp,%rbp
+  801483:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801484:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801489:	ba 00 00 00 00       	mov    $0x0,%edx
+  80148e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801493:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801498:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149d:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a8:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ae:	c9                   	leave
+  8014af:	c3                   	ret
+
+00000000008014b0 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8014b0:	55                   	push   %rbp
+  8014b1:	48 89 e5             	mov    %rsp,%rbp
+  8014b4:	53                   	push   %rbx
+  8014b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8014b9:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8014bc:	48 63 ce             	movslq %esi,%rcx
+  8014bf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d9:	48 85 c0             	test   %rax,%rax
+  8014dc:	7f 06                	jg     8014e4 <sys_sigqueue+0x34>
+}
+  8014de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e2:	c9                   	leave
+  8014e3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e4:	49 89 c0             	mov    %rax,%r8
+  8014e7:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8014ec:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8014f3:	00 00 00 
+  8014f6:	be 26 00 00 00       	mov    $0x26,%esi
+  8014fb:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  801502:	00 00 00 
+  801505:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150a:	49 b9 21 29 80 00 00 	movabs $0x802921,%r9
+  801511:	00 00 00 
+  801514:	41 ff d1             	call   *%r9
+
+0000000000801517 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801517:	55                   	push   %rbp
+  801518:	48 89 e5             	mov    %rsp,%rbp
+  80151b:	53                   	push   %rbx
+  80151c:	48 83 ec 08          	sub    $0x8,%rsp
+  801520:	48 89 fa             	mov    %rdi,%rdx
+  801523:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801526:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80152b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801530:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801535:	be 00 00 00 00       	mov    $0x0,%esi
+  80153a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801540:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801542:	48 85 c0             	test   %rax,%rax
+  801545:	7f 06                	jg     80154d <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801547:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154b:	c9                   	leave
+  80154c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80154d:	49 89 c0             	mov    %rax,%r8
+  801550:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801555:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  80155c:	00 00 00 
+  80155f:	be 26 00 00 00       	mov    $0x26,%esi
+  801564:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  80156b:	00 00 00 
+  80156e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801573:	49 b9 21 29 80 00 00 	movabs $0x802921,%r9
+  80157a:	00 00 00 
+  80157d:	41 ff d1             	call   *%r9
+
+0000000000801580 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801580:	55                   	push   %rbp
+  801581:	48 89 e5             	mov    %rsp,%rbp
+  801584:	53                   	push   %rbx
+  801585:	48 83 ec 08          	sub    $0x8,%rsp
+  801589:	48 89 f1             	mov    %rsi,%rcx
+  80158c:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80158f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801592:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801597:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80159c:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a9:	48 85 c0             	test   %rax,%rax
+  8015ac:	7f 06                	jg     8015b4 <sys_sigaction+0x34>
+}
+  8015ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b2:	c9                   	leave
+  8015b3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b4:	49 89 c0             	mov    %rax,%r8
+  8015b7:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8015bc:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8015c3:	00 00 00 
+  8015c6:	be 26 00 00 00       	mov    $0x26,%esi
+  8015cb:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  8015d2:	00 00 00 
+  8015d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015da:	49 b9 21 29 80 00 00 	movabs $0x802921,%r9
+  8015e1:	00 00 00 
+  8015e4:	41 ff d1             	call   *%r9
+
+00000000008015e7 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8015e7:	55                   	push   %rbp
+  8015e8:	48 89 e5             	mov    %rsp,%rbp
+  8015eb:	53                   	push   %rbx
+  8015ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8015f0:	48 89 f1             	mov    %rsi,%rcx
+  8015f3:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8015f6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f9:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801603:	be 00 00 00 00       	mov    $0x0,%esi
+  801608:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801610:	48 85 c0             	test   %rax,%rax
+  801613:	7f 06                	jg     80161b <sys_sigprocmask+0x34>
+}
+  801615:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801619:	c9                   	leave
+  80161a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80161b:	49 89 c0             	mov    %rax,%r8
+  80161e:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801623:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  80162a:	00 00 00 
+  80162d:	be 26 00 00 00       	mov    $0x26,%esi
+  801632:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  801639:	00 00 00 
+  80163c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801641:	49 b9 21 29 80 00 00 	movabs $0x802921,%r9
+  801648:	00 00 00 
+  80164b:	41 ff d1             	call   *%r9
+
+000000000080164e <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80164e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801655:	ff ff ff 
+  801658:	48 01 f8             	add    %rdi,%rax
+  80165b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80165f:	c3                   	ret
+
+0000000000801660 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801660:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801667:	ff ff ff 
+  80166a:	48 01 f8             	add    %rdi,%rax
+  80166d:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801671:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801677:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80167b:	c3                   	ret
+
+000000000080167c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80167c:	55                   	push   %rbp
+  80167d:	48 89 e5             	mov    %rsp,%rbp
+  801680:	41 57                	push   %r15
+  801682:	41 56                	push   %r14
+  801684:	41 55                	push   %r13
+  801686:	41 54                	push   %r12
+  801688:	53                   	push   %rbx
+  801689:	48 83 ec 08          	sub    $0x8,%rsp
+  80168d:	49 89 ff             	mov    %rdi,%r15
+  801690:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801695:	49 bd fa 25 80 00 00 	movabs $0x8025fa,%r13
+  80169c:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80169f:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8016a5:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8016a8:	48 89 df             	mov    %rbx,%rdi
+  8016ab:	41 ff d5             	call   *%r13
+  8016ae:	83 e0 04             	and    $0x4,%eax
+  8016b1:	74 17                	je     8016ca <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8016b3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8016ba:	4c 39 f3             	cmp    %r14,%rbx
+  8016bd:	75 e6                	jne    8016a5 <fd_alloc+0x29>
+  8016bf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8016c5:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8016ca:	4d 89 27             	mov    %r12,(%r15)
+}
+  8016cd:	48 83 c4 08          	add    $0x8,%rsp
+  8016d1:	5b                   	pop    %rbx
+  8016d2:	41 5c                	pop    %r12
+  8016d4:	41 5d                	pop    %r13
+  8016d6:	41 5e                	pop    %r14
+  8016d8:	41 5f                	pop    %r15
+  8016da:	5d                   	pop    %rbp
+  8016db:	c3                   	ret
+
+00000000008016dc <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8016dc:	83 ff 1f             	cmp    $0x1f,%edi
+  8016df:	77 39                	ja     80171a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8016e1:	55                   	push   %rbp
+  8016e2:	48 89 e5             	mov    %rsp,%rbp
+  8016e5:	41 54                	push   %r12
+  8016e7:	53                   	push   %rbx
+  8016e8:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8016eb:	48 63 df             	movslq %edi,%rbx
+  8016ee:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8016f5:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8016f9:	48 89 df             	mov    %rbx,%rdi
+  8016fc:	48 b8 fa 25 80 00 00 	movabs $0x8025fa,%rax
+  801703:	00 00 00 
+  801706:	ff d0                	call   *%rax
+  801708:	a8 04                	test   $0x4,%al
+  80170a:	74 14                	je     801720 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80170c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801710:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801715:	5b                   	pop    %rbx
+  801716:	41 5c                	pop    %r12
+  801718:	5d                   	pop    %rbp
+  801719:	c3                   	ret
+        return -E_INVAL;
+  80171a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80171f:	c3                   	ret
+        return -E_INVAL;
+  801720:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801725:	eb ee                	jmp    801715 <fd_lookup+0x39>
+
+0000000000801727 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801727:	55                   	push   %rbp
+  801728:	48 89 e5             	mov    %rsp,%rbp
+  80172b:	41 54                	push   %r12
+  80172d:	53                   	push   %rbx
+  80172e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801731:	48 b8 60 31 80 00 00 	movabs $0x803160,%rax
+  801738:	00 00 00 
+  80173b:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801742:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801745:	39 3b                	cmp    %edi,(%rbx)
+  801747:	74 47                	je     801790 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801749:	48 83 c0 08          	add    $0x8,%rax
+  80174d:	48 8b 18             	mov    (%rax),%rbx
+  801750:	48 85 db             	test   %rbx,%rbx
+  801753:	75 f0                	jne    801745 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801755:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  80175c:	00 00 00 
+  80175f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801765:	89 fa                	mov    %edi,%edx
+  801767:	48 bf e0 30 80 00 00 	movabs $0x8030e0,%rdi
+  80176e:	00 00 00 
+  801771:	b8 00 00 00 00       	mov    $0x0,%eax
+  801776:	48 b9 d7 01 80 00 00 	movabs $0x8001d7,%rcx
+  80177d:	00 00 00 
+  801780:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801782:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801787:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80178b:	5b                   	pop    %rbx
+  80178c:	41 5c                	pop    %r12
+  80178e:	5d                   	pop    %rbp
+  80178f:	c3                   	ret
+            return 0;
+  801790:	b8 00 00 00 00       	mov    $0x0,%eax
+  801795:	eb f0                	jmp    801787 <dev_lookup+0x60>
+
+0000000000801797 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801797:	55                   	push   %rbp
+  801798:	48 89 e5             	mov    %rsp,%rbp
+  80179b:	41 55                	push   %r13
+  80179d:	41 54                	push   %r12
+  80179f:	53                   	push   %rbx
+  8017a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8017a4:	48 89 fb             	mov    %rdi,%rbx
+  8017a7:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017aa:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8017b1:	ff ff ff 
+  8017b4:	48 01 df             	add    %rbx,%rdi
+  8017b7:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8017bb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8017bf:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  8017c6:	00 00 00 
+  8017c9:	ff d0                	call   *%rax
+  8017cb:	41 89 c5             	mov    %eax,%r13d
+  8017ce:	85 c0                	test   %eax,%eax
+  8017d0:	78 06                	js     8017d8 <fd_close+0x41>
+  8017d2:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8017d6:	74 1a                	je     8017f2 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8017d8:	45 84 e4             	test   %r12b,%r12b
+  8017db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e0:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8017e4:	44 89 e8             	mov    %r13d,%eax
+  8017e7:	48 83 c4 18          	add    $0x18,%rsp
+  8017eb:	5b                   	pop    %rbx
+  8017ec:	41 5c                	pop    %r12
+  8017ee:	41 5d                	pop    %r13
+  8017f0:	5d                   	pop    %rbp
+  8017f1:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017f2:	8b 3b                	mov    (%rbx),%edi
+  8017f4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8017f8:	48 b8 27 17 80 00 00 	movabs $0x801727,%rax
+  8017ff:	00 00 00 
+  801802:	ff d0                	call   *%rax
+  801804:	41 89 c5             	mov    %eax,%r13d
+  801807:	85 c0                	test   %eax,%eax
+  801809:	78 1b                	js     801826 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80180b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80180f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801813:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801819:	48 85 c0             	test   %rax,%rax
+  80181c:	74 08                	je     801826 <fd_close+0x8f>
+  80181e:	48 89 df             	mov    %rbx,%rdi
+  801821:	ff d0                	call   *%rax
+  801823:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801826:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80182b:	48 89 de             	mov    %rbx,%rsi
+  80182e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801833:	48 b8 78 11 80 00 00 	movabs $0x801178,%rax
+  80183a:	00 00 00 
+  80183d:	ff d0                	call   *%rax
+    return res;
+  80183f:	eb a3                	jmp    8017e4 <fd_close+0x4d>
+
+0000000000801841 <close>:
+
+int
+close(int fdnum) {
+  801841:	55                   	push   %rbp
+  801842:	48 89 e5             	mov    %rsp,%rbp
+  801845:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801849:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80184d:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  801854:	00 00 00 
+  801857:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801859:	85 c0                	test   %eax,%eax
+  80185b:	78 15                	js     801872 <close+0x31>
+
+    return fd_close(fd, 1);
+  80185d:	be 01 00 00 00       	mov    $0x1,%esi
+  801862:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801866:	48 b8 97 17 80 00 00 	movabs $0x801797,%rax
+  80186d:	00 00 00 
+  801870:	ff d0                	call   *%rax
+}
+  801872:	c9                   	leave
+  801873:	c3                   	ret
+
+0000000000801874 <close_all>:
+
+void
+close_all(void) {
+  801874:	55                   	push   %rbp
+  801875:	48 89 e5             	mov    %rsp,%rbp
+  801878:	41 54                	push   %r12
+  80187a:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80187b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801880:	49 bc 41 18 80 00 00 	movabs $0x801841,%r12
+  801887:	00 00 00 
+  80188a:	89 df                	mov    %ebx,%edi
+  80188c:	41 ff d4             	call   *%r12
+  80188f:	83 c3 01             	add    $0x1,%ebx
+  801892:	83 fb 20             	cmp    $0x20,%ebx
+  801895:	75 f3                	jne    80188a <close_all+0x16>
+}
+  801897:	5b                   	pop    %rbx
+  801898:	41 5c                	pop    %r12
+  80189a:	5d                   	pop    %rbp
+  80189b:	c3                   	ret
+
+000000000080189c <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80189c:	55                   	push   %rbp
+  80189d:	48 89 e5             	mov    %rsp,%rbp
+  8018a0:	41 57                	push   %r15
+  8018a2:	41 56                	push   %r14
+  8018a4:	41 55                	push   %r13
+  8018a6:	41 54                	push   %r12
+  8018a8:	53                   	push   %rbx
+  8018a9:	48 83 ec 18          	sub    $0x18,%rsp
+  8018ad:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8018b0:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8018b4:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  8018bb:	00 00 00 
+  8018be:	ff d0                	call   *%rax
+  8018c0:	89 c3                	mov    %eax,%ebx
+  8018c2:	85 c0                	test   %eax,%eax
+  8018c4:	0f 88 b8 00 00 00    	js     801982 <dup+0xe6>
+    close(newfdnum);
+  8018ca:	44 89 e7             	mov    %r12d,%edi
+  8018cd:	48 b8 41 18 80 00 00 	movabs $0x801841,%rax
+  8018d4:	00 00 00 
+  8018d7:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8018d9:	4d 63 ec             	movslq %r12d,%r13
+  8018dc:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8018e3:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8018e7:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8018eb:	4c 89 ff             	mov    %r15,%rdi
+  8018ee:	49 be 60 16 80 00 00 	movabs $0x801660,%r14
+  8018f5:	00 00 00 
+  8018f8:	41 ff d6             	call   *%r14
+  8018fb:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8018fe:	4c 89 ef             	mov    %r13,%rdi
+  801901:	41 ff d6             	call   *%r14
+  801904:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801907:	48 89 df             	mov    %rbx,%rdi
+  80190a:	48 b8 fa 25 80 00 00 	movabs $0x8025fa,%rax
+  801911:	00 00 00 
+  801914:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801916:	a8 04                	test   $0x4,%al
+  801918:	74 2b                	je     801945 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80191a:	41 89 c1             	mov    %eax,%r9d
+  80191d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801923:	4c 89 f1             	mov    %r14,%rcx
+  801926:	ba 00 00 00 00       	mov    $0x0,%edx
+  80192b:	48 89 de             	mov    %rbx,%rsi
+  80192e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801933:	48 b8 13 11 80 00 00 	movabs $0x801113,%rax
+  80193a:	00 00 00 
+  80193d:	ff d0                	call   *%rax
+  80193f:	89 c3                	mov    %eax,%ebx
+  801941:	85 c0                	test   %eax,%eax
+  801943:	78 4e                	js     801993 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801945:	4c 89 ff             	mov    %r15,%rdi
+  801948:	48 b8 fa 25 80 00 00 	movabs $0x8025fa,%rax
+  80194f:	00 00 00 
+  801952:	ff d0                	call   *%rax
+  801954:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801957:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80195d:	4c 89 e9             	mov    %r13,%rcx
+  801960:	ba 00 00 00 00       	mov    $0x0,%edx
+  801965:	4c 89 fe             	mov    %r15,%rsi
+  801968:	bf 00 00 00 00       	mov    $0x0,%edi
+  80196d:	48 b8 13 11 80 00 00 	movabs $0x801113,%rax
+  801974:	00 00 00 
+  801977:	ff d0                	call   *%rax
+  801979:	89 c3                	mov    %eax,%ebx
+  80197b:	85 c0                	test   %eax,%eax
+  80197d:	78 14                	js     801993 <dup+0xf7>
+
+    return newfdnum;
+  80197f:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801982:	89 d8                	mov    %ebx,%eax
+  801984:	48 83 c4 18          	add    $0x18,%rsp
+  801988:	5b                   	pop    %rbx
+  801989:	41 5c                	pop    %r12
+  80198b:	41 5d                	pop    %r13
+  80198d:	41 5e                	pop    %r14
+  80198f:	41 5f                	pop    %r15
+  801991:	5d                   	pop    %rbp
+  801992:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801993:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801998:	4c 89 ee             	mov    %r13,%rsi
+  80199b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019a0:	49 bc 78 11 80 00 00 	movabs $0x801178,%r12
+  8019a7:	00 00 00 
+  8019aa:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8019ad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019b2:	4c 89 f6             	mov    %r14,%rsi
+  8019b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019ba:	41 ff d4             	call   *%r12
+    return res;
+  8019bd:	eb c3                	jmp    801982 <dup+0xe6>
+
+00000000008019bf <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8019bf:	55                   	push   %rbp
+  8019c0:	48 89 e5             	mov    %rsp,%rbp
+  8019c3:	41 56                	push   %r14
+  8019c5:	41 55                	push   %r13
+  8019c7:	41 54                	push   %r12
+  8019c9:	53                   	push   %rbx
+  8019ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8019ce:	89 fb                	mov    %edi,%ebx
+  8019d0:	49 89 f4             	mov    %rsi,%r12
+  8019d3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019d6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019da:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  8019e1:	00 00 00 
+  8019e4:	ff d0                	call   *%rax
+  8019e6:	85 c0                	test   %eax,%eax
+  8019e8:	78 4c                	js     801a36 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019ea:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019ee:	41 8b 3e             	mov    (%r14),%edi
+  8019f1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019f5:	48 b8 27 17 80 00 00 	movabs $0x801727,%rax
+  8019fc:	00 00 00 
+  8019ff:	ff d0                	call   *%rax
+  801a01:	85 c0                	test   %eax,%eax
+  801a03:	78 35                	js     801a3a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a05:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a09:	83 e0 03             	and    $0x3,%eax
+  801a0c:	83 f8 01             	cmp    $0x1,%eax
+  801a0f:	74 2d                	je     801a3e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a11:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a15:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801a19:	48 85 c0             	test   %rax,%rax
+  801a1c:	74 56                	je     801a74 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801a1e:	4c 89 ea             	mov    %r13,%rdx
+  801a21:	4c 89 e6             	mov    %r12,%rsi
+  801a24:	4c 89 f7             	mov    %r14,%rdi
+  801a27:	ff d0                	call   *%rax
+}
+  801a29:	48 83 c4 10          	add    $0x10,%rsp
+  801a2d:	5b                   	pop    %rbx
+  801a2e:	41 5c                	pop    %r12
+  801a30:	41 5d                	pop    %r13
+  801a32:	41 5e                	pop    %r14
+  801a34:	5d                   	pop    %rbp
+  801a35:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a36:	48 98                	cltq
+  801a38:	eb ef                	jmp    801a29 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a3a:	48 98                	cltq
+  801a3c:	eb eb                	jmp    801a29 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a3e:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801a45:	00 00 00 
+  801a48:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a4e:	89 da                	mov    %ebx,%edx
+  801a50:	48 bf 21 31 80 00 00 	movabs $0x803121,%rdi
+  801a57:	00 00 00 
+  801a5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5f:	48 b9 d7 01 80 00 00 	movabs $0x8001d7,%rcx
+  801a66:	00 00 00 
+  801a69:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a6b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a72:	eb b5                	jmp    801a29 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a74:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a7b:	eb ac                	jmp    801a29 <read+0x6a>
+
+0000000000801a7d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a7d:	55                   	push   %rbp
+  801a7e:	48 89 e5             	mov    %rsp,%rbp
+  801a81:	41 57                	push   %r15
+  801a83:	41 56                	push   %r14
+  801a85:	41 55                	push   %r13
+  801a87:	41 54                	push   %r12
+  801a89:	53                   	push   %rbx
+  801a8a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a8e:	48 85 d2             	test   %rdx,%rdx
+  801a91:	74 54                	je     801ae7 <readn+0x6a>
+  801a93:	41 89 fd             	mov    %edi,%r13d
+  801a96:	49 89 f6             	mov    %rsi,%r14
+  801a99:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801a9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801aa1:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801aa6:	49 bf bf 19 80 00 00 	movabs $0x8019bf,%r15
+  801aad:	00 00 00 
+  801ab0:	4c 89 e2             	mov    %r12,%rdx
+  801ab3:	48 29 f2             	sub    %rsi,%rdx
+  801ab6:	4c 01 f6             	add    %r14,%rsi
+  801ab9:	44 89 ef             	mov    %r13d,%edi
+  801abc:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801abf:	85 c0                	test   %eax,%eax
+  801ac1:	78 20                	js     801ae3 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ac3:	01 c3                	add    %eax,%ebx
+  801ac5:	85 c0                	test   %eax,%eax
+  801ac7:	74 08                	je     801ad1 <readn+0x54>
+  801ac9:	48 63 f3             	movslq %ebx,%rsi
+  801acc:	4c 39 e6             	cmp    %r12,%rsi
+  801acf:	72 df                	jb     801ab0 <readn+0x33>
+    }
+    return res;
+  801ad1:	48 63 c3             	movslq %ebx,%rax
+}
+  801ad4:	48 83 c4 08          	add    $0x8,%rsp
+  801ad8:	5b                   	pop    %rbx
+  801ad9:	41 5c                	pop    %r12
+  801adb:	41 5d                	pop    %r13
+  801add:	41 5e                	pop    %r14
+  801adf:	41 5f                	pop    %r15
+  801ae1:	5d                   	pop    %rbp
+  801ae2:	c3                   	ret
+        if (inc < 0) return inc;
+  801ae3:	48 98                	cltq
+  801ae5:	eb ed                	jmp    801ad4 <readn+0x57>
+    int inc = 1, res = 0;
+  801ae7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aec:	eb e3                	jmp    801ad1 <readn+0x54>
+
+0000000000801aee <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801aee:	55                   	push   %rbp
+  801aef:	48 89 e5             	mov    %rsp,%rbp
+  801af2:	41 56                	push   %r14
+  801af4:	41 55                	push   %r13
+  801af6:	41 54                	push   %r12
+  801af8:	53                   	push   %rbx
+  801af9:	48 83 ec 10          	sub    $0x10,%rsp
+  801afd:	89 fb                	mov    %edi,%ebx
+  801aff:	49 89 f4             	mov    %rsi,%r12
+  801b02:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b05:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b09:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  801b10:	00 00 00 
+  801b13:	ff d0                	call   *%rax
+  801b15:	85 c0                	test   %eax,%eax
+  801b17:	78 47                	js     801b60 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b19:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b1d:	41 8b 3e             	mov    (%r14),%edi
+  801b20:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b24:	48 b8 27 17 80 00 00 	movabs $0x801727,%rax
+  801b2b:	00 00 00 
+  801b2e:	ff d0                	call   *%rax
+  801b30:	85 c0                	test   %eax,%eax
+  801b32:	78 30                	js     801b64 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b34:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b39:	74 2d                	je     801b68 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b3b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b3f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b43:	48 85 c0             	test   %rax,%rax
+  801b46:	74 56                	je     801b9e <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b48:	4c 89 ea             	mov    %r13,%rdx
+  801b4b:	4c 89 e6             	mov    %r12,%rsi
+  801b4e:	4c 89 f7             	mov    %r14,%rdi
+  801b51:	ff d0                	call   *%rax
+}
+  801b53:	48 83 c4 10          	add    $0x10,%rsp
+  801b57:	5b                   	pop    %rbx
+  801b58:	41 5c                	pop    %r12
+  801b5a:	41 5d                	pop    %r13
+  801b5c:	41 5e                	pop    %r14
+  801b5e:	5d                   	pop    %rbp
+  801b5f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b60:	48 98                	cltq
+  801b62:	eb ef                	jmp    801b53 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b64:	48 98                	cltq
+  801b66:	eb eb                	jmp    801b53 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b68:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801b6f:	00 00 00 
+  801b72:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b78:	89 da                	mov    %ebx,%edx
+  801b7a:	48 bf 3d 31 80 00 00 	movabs $0x80313d,%rdi
+  801b81:	00 00 00 
+  801b84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b89:	48 b9 d7 01 80 00 00 	movabs $0x8001d7,%rcx
+  801b90:	00 00 00 
+  801b93:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b95:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b9c:	eb b5                	jmp    801b53 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b9e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ba5:	eb ac                	jmp    801b53 <write+0x65>
+
+0000000000801ba7 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ba7:	55                   	push   %rbp
+  801ba8:	48 89 e5             	mov    %rsp,%rbp
+  801bab:	53                   	push   %rbx
+  801bac:	48 83 ec 18          	sub    $0x18,%rsp
+  801bb0:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bb2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801bb6:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  801bbd:	00 00 00 
+  801bc0:	ff d0                	call   *%rax
+  801bc2:	85 c0                	test   %eax,%eax
+  801bc4:	78 0c                	js     801bd2 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801bc6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bca:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bd2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bd6:	c9                   	leave
+  801bd7:	c3                   	ret
+
+0000000000801bd8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801bd8:	55                   	push   %rbp
+  801bd9:	48 89 e5             	mov    %rsp,%rbp
+  801bdc:	41 55                	push   %r13
+  801bde:	41 54                	push   %r12
+  801be0:	53                   	push   %rbx
+  801be1:	48 83 ec 18          	sub    $0x18,%rsp
+  801be5:	89 fb                	mov    %edi,%ebx
+  801be7:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bea:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bee:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  801bf5:	00 00 00 
+  801bf8:	ff d0                	call   *%rax
+  801bfa:	85 c0                	test   %eax,%eax
+  801bfc:	78 38                	js     801c36 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bfe:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801c02:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c06:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c0a:	48 b8 27 17 80 00 00 	movabs $0x801727,%rax
+  801c11:	00 00 00 
+  801c14:	ff d0                	call   *%rax
+  801c16:	85 c0                	test   %eax,%eax
+  801c18:	78 1c                	js     801c36 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c1a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c1f:	74 20                	je     801c41 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c21:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c25:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801c29:	48 85 c0             	test   %rax,%rax
+  801c2c:	74 47                	je     801c75 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c2e:	44 89 e6             	mov    %r12d,%esi
+  801c31:	4c 89 ef             	mov    %r13,%rdi
+  801c34:	ff d0                	call   *%rax
+}
+  801c36:	48 83 c4 18          	add    $0x18,%rsp
+  801c3a:	5b                   	pop    %rbx
+  801c3b:	41 5c                	pop    %r12
+  801c3d:	41 5d                	pop    %r13
+  801c3f:	5d                   	pop    %rbp
+  801c40:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c41:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801c48:	00 00 00 
+  801c4b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c51:	89 da                	mov    %ebx,%edx
+  801c53:	48 bf 00 31 80 00 00 	movabs $0x803100,%rdi
+  801c5a:	00 00 00 
+  801c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c62:	48 b9 d7 01 80 00 00 	movabs $0x8001d7,%rcx
+  801c69:	00 00 00 
+  801c6c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c73:	eb c1                	jmp    801c36 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c75:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c7a:	eb ba                	jmp    801c36 <ftruncate+0x5e>
+
+0000000000801c7c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801c7c:	55                   	push   %rbp
+  801c7d:	48 89 e5             	mov    %rsp,%rbp
+  801c80:	41 54                	push   %r12
+  801c82:	53                   	push   %rbx
+  801c83:	48 83 ec 10          	sub    $0x10,%rsp
+  801c87:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c8a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c8e:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  801c95:	00 00 00 
+  801c98:	ff d0                	call   *%rax
+  801c9a:	85 c0                	test   %eax,%eax
+  801c9c:	78 4e                	js     801cec <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c9e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ca2:	41 8b 3c 24          	mov    (%r12),%edi
+  801ca6:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801caa:	48 b8 27 17 80 00 00 	movabs $0x801727,%rax
+  801cb1:	00 00 00 
+  801cb4:	ff d0                	call   *%rax
+  801cb6:	85 c0                	test   %eax,%eax
+  801cb8:	78 32                	js     801cec <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801cba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801cbe:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801cc3:	74 30                	je     801cf5 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801cc5:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801cc8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801ccf:	00 00 00 
+    stat->st_isdir = 0;
+  801cd2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801cd9:	00 00 00 
+    stat->st_dev = dev;
+  801cdc:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801ce3:	48 89 de             	mov    %rbx,%rsi
+  801ce6:	4c 89 e7             	mov    %r12,%rdi
+  801ce9:	ff 50 28             	call   *0x28(%rax)
+}
+  801cec:	48 83 c4 10          	add    $0x10,%rsp
+  801cf0:	5b                   	pop    %rbx
+  801cf1:	41 5c                	pop    %r12
+  801cf3:	5d                   	pop    %rbp
+  801cf4:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801cf5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801cfa:	eb f0                	jmp    801cec <fstat+0x70>
+
+0000000000801cfc <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801cfc:	55                   	push   %rbp
+  801cfd:	48 89 e5             	mov    %rsp,%rbp
+  801d00:	41 54                	push   %r12
+  801d02:	53                   	push   %rbx
+  801d03:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d06:	be 00 00 00 00       	mov    $0x0,%esi
+  801d0b:	48 b8 7d 1f 80 00 00 	movabs $0x801f7d,%rax
+  801d12:	00 00 00 
+  801d15:	ff d0                	call   *%rax
+  801d17:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d19:	85 c0                	test   %eax,%eax
+  801d1b:	78 25                	js     801d42 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d1d:	4c 89 e6             	mov    %r12,%rsi
+  801d20:	89 c7                	mov    %eax,%edi
+  801d22:	48 b8 7c 1c 80 00 00 	movabs $0x801c7c,%rax
+  801d29:	00 00 00 
+  801d2c:	ff d0                	call   *%rax
+  801d2e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d31:	89 df                	mov    %ebx,%edi
+  801d33:	48 b8 41 18 80 00 00 	movabs $0x801841,%rax
+  801d3a:	00 00 00 
+  801d3d:	ff d0                	call   *%rax
+
+    return res;
+  801d3f:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d42:	89 d8                	mov    %ebx,%eax
+  801d44:	5b                   	pop    %rbx
+  801d45:	41 5c                	pop    %r12
+  801d47:	5d                   	pop    %rbp
+  801d48:	c3                   	ret
+
+0000000000801d49 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801d49:	55                   	push   %rbp
+  801d4a:	48 89 e5             	mov    %rsp,%rbp
+  801d4d:	41 54                	push   %r12
+  801d4f:	53                   	push   %rbx
+  801d50:	48 83 ec 10          	sub    $0x10,%rsp
+  801d54:	41 89 fc             	mov    %edi,%r12d
+  801d57:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d5a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801d61:	00 00 00 
+  801d64:	83 38 00             	cmpl   $0x0,(%rax)
+  801d67:	74 5e                	je     801dc7 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801d69:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801d6f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d74:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801d7b:	00 00 00 
+  801d7e:	44 89 e6             	mov    %r12d,%esi
+  801d81:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801d88:	00 00 00 
+  801d8b:	8b 38                	mov    (%rax),%edi
+  801d8d:	48 b8 59 2a 80 00 00 	movabs $0x802a59,%rax
+  801d94:	00 00 00 
+  801d97:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801d99:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801da0:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801da1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801da6:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801daa:	48 89 de             	mov    %rbx,%rsi
+  801dad:	bf 00 00 00 00       	mov    $0x0,%edi
+  801db2:	48 b8 c4 29 80 00 00 	movabs $0x8029c4,%rax
+  801db9:	00 00 00 
+  801dbc:	ff d0                	call   *%rax
+}
+  801dbe:	48 83 c4 10          	add    $0x10,%rsp
+  801dc2:	5b                   	pop    %rbx
+  801dc3:	41 5c                	pop    %r12
+  801dc5:	5d                   	pop    %rbp
+  801dc6:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801dc7:	bf 03 00 00 00       	mov    $0x3,%edi
+  801dcc:	48 b8 f9 2a 80 00 00 	movabs $0x802af9,%rax
+  801dd3:	00 00 00 
+  801dd6:	ff d0                	call   *%rax
+  801dd8:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801ddf:	00 00 
+  801de1:	eb 86                	jmp    801d69 <fsipc+0x20>
+
+0000000000801de3 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801de3:	55                   	push   %rbp
+  801de4:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801de7:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801dee:	00 00 00 
+  801df1:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801df4:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801df6:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801df9:	be 00 00 00 00       	mov    $0x0,%esi
+  801dfe:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e03:	48 b8 49 1d 80 00 00 	movabs $0x801d49,%rax
+  801e0a:	00 00 00 
+  801e0d:	ff d0                	call   *%rax
+}
+  801e0f:	5d                   	pop    %rbp
+  801e10:	c3                   	ret
+
+0000000000801e11 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801e11:	55                   	push   %rbp
+  801e12:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e15:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801e18:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801e1f:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801e21:	be 00 00 00 00       	mov    $0x0,%esi
+  801e26:	bf 06 00 00 00       	mov    $0x6,%edi
+  801e2b:	48 b8 49 1d 80 00 00 	movabs $0x801d49,%rax
+  801e32:	00 00 00 
+  801e35:	ff d0                	call   *%rax
+}
+  801e37:	5d                   	pop    %rbp
+  801e38:	c3                   	ret
+
+0000000000801e39 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801e39:	55                   	push   %rbp
+  801e3a:	48 89 e5             	mov    %rsp,%rbp
+  801e3d:	41 54                	push   %r12
+  801e3f:	53                   	push   %rbx
+  801e40:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e43:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801e46:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801e4d:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801e4f:	be 00 00 00 00       	mov    $0x0,%esi
+  801e54:	bf 05 00 00 00       	mov    $0x5,%edi
+  801e59:	48 b8 49 1d 80 00 00 	movabs $0x801d49,%rax
+  801e60:	00 00 00 
+  801e63:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e65:	85 c0                	test   %eax,%eax
+  801e67:	78 3d                	js     801ea6 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e69:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801e70:	00 00 00 
+  801e73:	4c 89 e6             	mov    %r12,%rsi
+  801e76:	48 89 df             	mov    %rbx,%rdi
+  801e79:	48 b8 fc 0a 80 00 00 	movabs $0x800afc,%rax
+  801e80:	00 00 00 
+  801e83:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801e85:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801e8c:	00 
+  801e8d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e93:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801e9a:	00 
+  801e9b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801ea1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ea6:	5b                   	pop    %rbx
+  801ea7:	41 5c                	pop    %r12
+  801ea9:	5d                   	pop    %rbp
+  801eaa:	c3                   	ret
+
+0000000000801eab <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801eab:	55                   	push   %rbp
+  801eac:	48 89 e5             	mov    %rsp,%rbp
+  801eaf:	41 54                	push   %r12
+  801eb1:	53                   	push   %rbx
+  801eb2:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  801eb5:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  801eba:	48 39 c2             	cmp    %rax,%rdx
+  801ebd:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801ec1:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801ec4:	48 89 c2             	mov    %rax,%rdx
+  801ec7:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801ece:	00 00 00 
+  801ed1:	48 b8 5d 0d 80 00 00 	movabs $0x800d5d,%rax
+  801ed8:	00 00 00 
+  801edb:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801edd:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801ee4:	00 00 00 
+  801ee7:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  801eec:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  801eee:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  801ef2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ef7:	bf 04 00 00 00       	mov    $0x4,%edi
+  801efc:	48 b8 49 1d 80 00 00 	movabs $0x801d49,%rax
+  801f03:	00 00 00 
+  801f06:	ff d0                	call   *%rax
+  801f08:	48 98                	cltq
+}
+  801f0a:	5b                   	pop    %rbx
+  801f0b:	41 5c                	pop    %r12
+  801f0d:	5d                   	pop    %rbp
+  801f0e:	c3                   	ret
+
+0000000000801f0f <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801f0f:	55                   	push   %rbp
+  801f10:	48 89 e5             	mov    %rsp,%rbp
+  801f13:	41 54                	push   %r12
+  801f15:	53                   	push   %rbx
+  801f16:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f19:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801f20:	00 00 00 
+  801f23:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801f26:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  801f28:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801f2d:	48 39 ca             	cmp    %rcx,%rdx
+  801f30:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  801f34:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  801f38:	be 00 00 00 00       	mov    $0x0,%esi
+  801f3d:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f42:	48 b8 49 1d 80 00 00 	movabs $0x801d49,%rax
+  801f49:	00 00 00 
+  801f4c:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  801f4e:	85 c0                	test   %eax,%eax
+  801f50:	78 27                	js     801f79 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  801f52:	48 63 d8             	movslq %eax,%rbx
+  801f55:	48 89 da             	mov    %rbx,%rdx
+  801f58:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801f5f:	00 00 00 
+  801f62:	4c 89 e7             	mov    %r12,%rdi
+  801f65:	48 b8 5d 0d 80 00 00 	movabs $0x800d5d,%rax
+  801f6c:	00 00 00 
+  801f6f:	ff d0                	call   *%rax
+    return bytes_read;
+  801f71:	48 89 d8             	mov    %rbx,%rax
+}
+  801f74:	5b                   	pop    %rbx
+  801f75:	41 5c                	pop    %r12
+  801f77:	5d                   	pop    %rbp
+  801f78:	c3                   	ret
+        return bytes_read;
+  801f79:	48 98                	cltq
+  801f7b:	eb f7                	jmp    801f74 <devfile_read+0x65>
+
+0000000000801f7d <open>:
+open(const char *path, int mode) {
+  801f7d:	55                   	push   %rbp
+  801f7e:	48 89 e5             	mov    %rsp,%rbp
+  801f81:	41 55                	push   %r13
+  801f83:	41 54                	push   %r12
+  801f85:	53                   	push   %rbx
+  801f86:	48 83 ec 18          	sub    $0x18,%rsp
+  801f8a:	49 89 fc             	mov    %rdi,%r12
+  801f8d:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801f90:	48 b8 be 0a 80 00 00 	movabs $0x800abe,%rax
+  801f97:	00 00 00 
+  801f9a:	ff d0                	call   *%rax
+  801f9c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801fa2:	0f 87 8a 00 00 00    	ja     802032 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801fa8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801fac:	48 b8 7c 16 80 00 00 	movabs $0x80167c,%rax
+  801fb3:	00 00 00 
+  801fb6:	ff d0                	call   *%rax
+  801fb8:	89 c3                	mov    %eax,%ebx
+  801fba:	85 c0                	test   %eax,%eax
+  801fbc:	78 50                	js     80200e <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801fbe:	4c 89 e6             	mov    %r12,%rsi
+  801fc1:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801fc8:	00 00 00 
+  801fcb:	48 89 df             	mov    %rbx,%rdi
+  801fce:	48 b8 fc 0a 80 00 00 	movabs $0x800afc,%rax
+  801fd5:	00 00 00 
+  801fd8:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801fda:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801fe1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801fe5:	bf 01 00 00 00       	mov    $0x1,%edi
+  801fea:	48 b8 49 1d 80 00 00 	movabs $0x801d49,%rax
+  801ff1:	00 00 00 
+  801ff4:	ff d0                	call   *%rax
+  801ff6:	89 c3                	mov    %eax,%ebx
+  801ff8:	85 c0                	test   %eax,%eax
+  801ffa:	78 1f                	js     80201b <open+0x9e>
+    return fd2num(fd);
+  801ffc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802000:	48 b8 4e 16 80 00 00 	movabs $0x80164e,%rax
+  802007:	00 00 00 
+  80200a:	ff d0                	call   *%rax
+  80200c:	89 c3                	mov    %eax,%ebx
+}
+  80200e:	89 d8                	mov    %ebx,%eax
+  802010:	48 83 c4 18          	add    $0x18,%rsp
+  802014:	5b                   	pop    %rbx
+  802015:	41 5c                	pop    %r12
+  802017:	41 5d                	pop    %r13
+  802019:	5d                   	pop    %rbp
+  80201a:	c3                   	ret
+        fd_close(fd, 0);
+  80201b:	be 00 00 00 00       	mov    $0x0,%esi
+  802020:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802024:	48 b8 97 17 80 00 00 	movabs $0x801797,%rax
+  80202b:	00 00 00 
+  80202e:	ff d0                	call   *%rax
+        return res;
+  802030:	eb dc                	jmp    80200e <open+0x91>
+        return -E_BAD_PATH;
+  802032:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802037:	eb d5                	jmp    80200e <open+0x91>
+
+0000000000802039 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802039:	55                   	push   %rbp
+  80203a:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80203d:	be 00 00 00 00       	mov    $0x0,%esi
+  802042:	bf 08 00 00 00       	mov    $0x8,%edi
+  802047:	48 b8 49 1d 80 00 00 	movabs $0x801d49,%rax
+  80204e:	00 00 00 
+  802051:	ff d0                	call   *%rax
+}
+  802053:	5d                   	pop    %rbp
+  802054:	c3                   	ret
+
+0000000000802055 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802055:	55                   	push   %rbp
+  802056:	48 89 e5             	mov    %rsp,%rbp
+  802059:	41 54                	push   %r12
+  80205b:	53                   	push   %rbx
+  80205c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80205f:	48 b8 60 16 80 00 00 	movabs $0x801660,%rax
+  802066:	00 00 00 
+  802069:	ff d0                	call   *%rax
+  80206b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80206e:	48 be 80 31 80 00 00 	movabs $0x803180,%rsi
+  802075:	00 00 00 
+  802078:	48 89 df             	mov    %rbx,%rdi
+  80207b:	48 b8 fc 0a 80 00 00 	movabs $0x800afc,%rax
+  802082:	00 00 00 
+  802085:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802087:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80208c:	41 2b 04 24          	sub    (%r12),%eax
+  802090:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802096:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80209d:	00 00 00 
+    stat->st_dev = &devpipe;
+  8020a0:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8020a7:	00 00 00 
+  8020aa:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8020b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b6:	5b                   	pop    %rbx
+  8020b7:	41 5c                	pop    %r12
+  8020b9:	5d                   	pop    %rbp
+  8020ba:	c3                   	ret
+
+00000000008020bb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8020bb:	55                   	push   %rbp
+  8020bc:	48 89 e5             	mov    %rsp,%rbp
+  8020bf:	41 54                	push   %r12
+  8020c1:	53                   	push   %rbx
+  8020c2:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8020c5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020ca:	48 89 fe             	mov    %rdi,%rsi
+  8020cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020d2:	49 bc 78 11 80 00 00 	movabs $0x801178,%r12
+  8020d9:	00 00 00 
+  8020dc:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8020df:	48 89 df             	mov    %rbx,%rdi
+  8020e2:	48 b8 60 16 80 00 00 	movabs $0x801660,%rax
+  8020e9:	00 00 00 
+  8020ec:	ff d0                	call   *%rax
+  8020ee:	48 89 c6             	mov    %rax,%rsi
+  8020f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020fb:	41 ff d4             	call   *%r12
+}
+  8020fe:	5b                   	pop    %rbx
+  8020ff:	41 5c                	pop    %r12
+  802101:	5d                   	pop    %rbp
+  802102:	c3                   	ret
+
+0000000000802103 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802103:	55                   	push   %rbp
+  802104:	48 89 e5             	mov    %rsp,%rbp
+  802107:	41 57                	push   %r15
+  802109:	41 56                	push   %r14
+  80210b:	41 55                	push   %r13
+  80210d:	41 54                	push   %r12
+  80210f:	53                   	push   %rbx
+  802110:	48 83 ec 18          	sub    $0x18,%rsp
+  802114:	49 89 fc             	mov    %rdi,%r12
+  802117:	49 89 f5             	mov    %rsi,%r13
+  80211a:	49 89 d7             	mov    %rdx,%r15
+  80211d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802121:	48 b8 60 16 80 00 00 	movabs $0x801660,%rax
+  802128:	00 00 00 
+  80212b:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80212d:	4d 85 ff             	test   %r15,%r15
+  802130:	0f 84 af 00 00 00    	je     8021e5 <devpipe_write+0xe2>
+  802136:	48 89 c3             	mov    %rax,%rbx
+  802139:	4c 89 f8             	mov    %r15,%rax
+  80213c:	4d 89 ef             	mov    %r13,%r15
+  80213f:	4c 01 e8             	add    %r13,%rax
+  802142:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802146:	49 bd 80 10 80 00 00 	movabs $0x801080,%r13
+  80214d:	00 00 00 
+            sys_yield();
+  802150:	49 be 1d 10 80 00 00 	movabs $0x80101d,%r14
+  802157:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80215a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80215d:	48 63 ce             	movslq %esi,%rcx
+  802160:	48 63 03             	movslq (%rbx),%rax
+  802163:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802169:	48 39 c1             	cmp    %rax,%rcx
+  80216c:	72 2e                	jb     80219c <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80216e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802173:	48 89 da             	mov    %rbx,%rdx
+  802176:	be 00 10 00 00       	mov    $0x1000,%esi
+  80217b:	4c 89 e7             	mov    %r12,%rdi
+  80217e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802181:	85 c0                	test   %eax,%eax
+  802183:	74 66                	je     8021eb <devpipe_write+0xe8>
+            sys_yield();
+  802185:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802188:	8b 73 04             	mov    0x4(%rbx),%esi
+  80218b:	48 63 ce             	movslq %esi,%rcx
+  80218e:	48 63 03             	movslq (%rbx),%rax
+  802191:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802197:	48 39 c1             	cmp    %rax,%rcx
+  80219a:	73 d2                	jae    80216e <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80219c:	41 0f b6 3f          	movzbl (%r15),%edi
+  8021a0:	48 89 ca             	mov    %rcx,%rdx
+  8021a3:	48 c1 ea 03          	shr    $0x3,%rdx
+  8021a7:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8021ae:	08 10 20 
+  8021b1:	48 f7 e2             	mul    %rdx
+  8021b4:	48 c1 ea 06          	shr    $0x6,%rdx
+  8021b8:	48 89 d0             	mov    %rdx,%rax
+  8021bb:	48 c1 e0 09          	shl    $0x9,%rax
+  8021bf:	48 29 d0             	sub    %rdx,%rax
+  8021c2:	48 c1 e0 03          	shl    $0x3,%rax
+  8021c6:	48 29 c1             	sub    %rax,%rcx
+  8021c9:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8021ce:	83 c6 01             	add    $0x1,%esi
+  8021d1:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8021d4:	49 83 c7 01          	add    $0x1,%r15
+  8021d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021dc:	49 39 c7             	cmp    %rax,%r15
+  8021df:	0f 85 75 ff ff ff    	jne    80215a <devpipe_write+0x57>
+    return n;
+  8021e5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021e9:	eb 05                	jmp    8021f0 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8021eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021f0:	48 83 c4 18          	add    $0x18,%rsp
+  8021f4:	5b                   	pop    %rbx
+  8021f5:	41 5c                	pop    %r12
+  8021f7:	41 5d                	pop    %r13
+  8021f9:	41 5e                	pop    %r14
+  8021fb:	41 5f                	pop    %r15
+  8021fd:	5d                   	pop    %rbp
+  8021fe:	c3                   	ret
+
+00000000008021ff <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8021ff:	55                   	push   %rbp
+  802200:	48 89 e5             	mov    %rsp,%rbp
+  802203:	41 57                	push   %r15
+  802205:	41 56                	push   %r14
+  802207:	41 55                	push   %r13
+  802209:	41 54                	push   %r12
+  80220b:	53                   	push   %rbx
+  80220c:	48 83 ec 18          	sub    $0x18,%rsp
+  802210:	49 89 fc             	mov    %rdi,%r12
+  802213:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802217:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80221b:	48 b8 60 16 80 00 00 	movabs $0x801660,%rax
+  802222:	00 00 00 
+  802225:	ff d0                	call   *%rax
+  802227:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80222a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802230:	49 bd 80 10 80 00 00 	movabs $0x801080,%r13
+  802237:	00 00 00 
+            sys_yield();
+  80223a:	49 be 1d 10 80 00 00 	movabs $0x80101d,%r14
+  802241:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802244:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802249:	74 7d                	je     8022c8 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80224b:	8b 03                	mov    (%rbx),%eax
+  80224d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802250:	75 26                	jne    802278 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802252:	4d 85 ff             	test   %r15,%r15
+  802255:	75 77                	jne    8022ce <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802257:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80225c:	48 89 da             	mov    %rbx,%rdx
+  80225f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802264:	4c 89 e7             	mov    %r12,%rdi
+  802267:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80226a:	85 c0                	test   %eax,%eax
+  80226c:	74 72                	je     8022e0 <devpipe_read+0xe1>
+            sys_yield();
+  80226e:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802271:	8b 03                	mov    (%rbx),%eax
+  802273:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802276:	74 df                	je     802257 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802278:	48 63 c8             	movslq %eax,%rcx
+  80227b:	48 89 ca             	mov    %rcx,%rdx
+  80227e:	48 c1 ea 03          	shr    $0x3,%rdx
+  802282:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802289:	08 10 20 
+  80228c:	48 89 d0             	mov    %rdx,%rax
+  80228f:	48 f7 e6             	mul    %rsi
+  802292:	48 c1 ea 06          	shr    $0x6,%rdx
+  802296:	48 89 d0             	mov    %rdx,%rax
+  802299:	48 c1 e0 09          	shl    $0x9,%rax
+  80229d:	48 29 d0             	sub    %rdx,%rax
+  8022a0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8022a7:	00 
+  8022a8:	48 89 c8             	mov    %rcx,%rax
+  8022ab:	48 29 d0             	sub    %rdx,%rax
+  8022ae:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8022b3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8022b7:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8022bb:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8022be:	49 83 c7 01          	add    $0x1,%r15
+  8022c2:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8022c6:	75 83                	jne    80224b <devpipe_read+0x4c>
+    return n;
+  8022c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022cc:	eb 03                	jmp    8022d1 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8022ce:	4c 89 f8             	mov    %r15,%rax
+}
+  8022d1:	48 83 c4 18          	add    $0x18,%rsp
+  8022d5:	5b                   	pop    %rbx
+  8022d6:	41 5c                	pop    %r12
+  8022d8:	41 5d                	pop    %r13
+  8022da:	41 5e                	pop    %r14
+  8022dc:	41 5f                	pop    %r15
+  8022de:	5d                   	pop    %rbp
+  8022df:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8022e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e5:	eb ea                	jmp    8022d1 <devpipe_read+0xd2>
+
+00000000008022e7 <pipe>:
+pipe(int pfd[2]) {
+  8022e7:	55                   	push   %rbp
+  8022e8:	48 89 e5             	mov    %rsp,%rbp
+  8022eb:	41 55                	push   %r13
+  8022ed:	41 54                	push   %r12
+  8022ef:	53                   	push   %rbx
+  8022f0:	48 83 ec 18          	sub    $0x18,%rsp
+  8022f4:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022f7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8022fb:	48 b8 7c 16 80 00 00 	movabs $0x80167c,%rax
+  802302:	00 00 00 
+  802305:	ff d0                	call   *%rax
+  802307:	89 c3                	mov    %eax,%ebx
+  802309:	85 c0                	test   %eax,%eax
+  80230b:	0f 88 a0 01 00 00    	js     8024b1 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802311:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802316:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80231b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80231f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802324:	48 b8 ac 10 80 00 00 	movabs $0x8010ac,%rax
+  80232b:	00 00 00 
+  80232e:	ff d0                	call   *%rax
+  802330:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802332:	85 c0                	test   %eax,%eax
+  802334:	0f 88 77 01 00 00    	js     8024b1 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80233a:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80233e:	48 b8 7c 16 80 00 00 	movabs $0x80167c,%rax
+  802345:	00 00 00 
+  802348:	ff d0                	call   *%rax
+  80234a:	89 c3                	mov    %eax,%ebx
+  80234c:	85 c0                	test   %eax,%eax
+  80234e:	0f 88 43 01 00 00    	js     802497 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802354:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802359:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80235e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802362:	bf 00 00 00 00       	mov    $0x0,%edi
+  802367:	48 b8 ac 10 80 00 00 	movabs $0x8010ac,%rax
+  80236e:	00 00 00 
+  802371:	ff d0                	call   *%rax
+  802373:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802375:	85 c0                	test   %eax,%eax
+  802377:	0f 88 1a 01 00 00    	js     802497 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80237d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802381:	48 b8 60 16 80 00 00 	movabs $0x801660,%rax
+  802388:	00 00 00 
+  80238b:	ff d0                	call   *%rax
+  80238d:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802390:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802395:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80239a:	48 89 c6             	mov    %rax,%rsi
+  80239d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023a2:	48 b8 ac 10 80 00 00 	movabs $0x8010ac,%rax
+  8023a9:	00 00 00 
+  8023ac:	ff d0                	call   *%rax
+  8023ae:	89 c3                	mov    %eax,%ebx
+  8023b0:	85 c0                	test   %eax,%eax
+  8023b2:	0f 88 c5 00 00 00    	js     80247d <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8023b8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8023bc:	48 b8 60 16 80 00 00 	movabs $0x801660,%rax
+  8023c3:	00 00 00 
+  8023c6:	ff d0                	call   *%rax
+  8023c8:	48 89 c1             	mov    %rax,%rcx
+  8023cb:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8023d1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023dc:	4c 89 ee             	mov    %r13,%rsi
+  8023df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023e4:	48 b8 13 11 80 00 00 	movabs $0x801113,%rax
+  8023eb:	00 00 00 
+  8023ee:	ff d0                	call   *%rax
+  8023f0:	89 c3                	mov    %eax,%ebx
+  8023f2:	85 c0                	test   %eax,%eax
+  8023f4:	78 6e                	js     802464 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8023f6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8023fb:	4c 89 ef             	mov    %r13,%rdi
+  8023fe:	48 b8 4e 10 80 00 00 	movabs $0x80104e,%rax
+  802405:	00 00 00 
+  802408:	ff d0                	call   *%rax
+  80240a:	83 f8 02             	cmp    $0x2,%eax
+  80240d:	0f 85 ab 00 00 00    	jne    8024be <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802413:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80241a:	00 00 
+  80241c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802420:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802422:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802426:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80242d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802431:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802433:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802437:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80243e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802442:	48 bb 4e 16 80 00 00 	movabs $0x80164e,%rbx
+  802449:	00 00 00 
+  80244c:	ff d3                	call   *%rbx
+  80244e:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802452:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802456:	ff d3                	call   *%rbx
+  802458:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80245d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802462:	eb 4d                	jmp    8024b1 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802464:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802469:	4c 89 ee             	mov    %r13,%rsi
+  80246c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802471:	48 b8 78 11 80 00 00 	movabs $0x801178,%rax
+  802478:	00 00 00 
+  80247b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80247d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802482:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802486:	bf 00 00 00 00       	mov    $0x0,%edi
+  80248b:	48 b8 78 11 80 00 00 	movabs $0x801178,%rax
+  802492:	00 00 00 
+  802495:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802497:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80249c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8024a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024a5:	48 b8 78 11 80 00 00 	movabs $0x801178,%rax
+  8024ac:	00 00 00 
+  8024af:	ff d0                	call   *%rax
+}
+  8024b1:	89 d8                	mov    %ebx,%eax
+  8024b3:	48 83 c4 18          	add    $0x18,%rsp
+  8024b7:	5b                   	pop    %rbx
+  8024b8:	41 5c                	pop    %r12
+  8024ba:	41 5d                	pop    %r13
+  8024bc:	5d                   	pop    %rbp
+  8024bd:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8024be:	48 b9 b0 31 80 00 00 	movabs $0x8031b0,%rcx
+  8024c5:	00 00 00 
+  8024c8:	48 ba 87 31 80 00 00 	movabs $0x803187,%rdx
+  8024cf:	00 00 00 
+  8024d2:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8024d7:	48 bf 9c 31 80 00 00 	movabs $0x80319c,%rdi
+  8024de:	00 00 00 
+  8024e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e6:	49 b8 21 29 80 00 00 	movabs $0x802921,%r8
+  8024ed:	00 00 00 
+  8024f0:	41 ff d0             	call   *%r8
+
+00000000008024f3 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8024f3:	55                   	push   %rbp
+  8024f4:	48 89 e5             	mov    %rsp,%rbp
+  8024f7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8024fb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024ff:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  802506:	00 00 00 
+  802509:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80250b:	85 c0                	test   %eax,%eax
+  80250d:	78 35                	js     802544 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80250f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802513:	48 b8 60 16 80 00 00 	movabs $0x801660,%rax
+  80251a:	00 00 00 
+  80251d:	ff d0                	call   *%rax
+  80251f:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802522:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802527:	be 00 10 00 00       	mov    $0x1000,%esi
+  80252c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802530:	48 b8 80 10 80 00 00 	movabs $0x801080,%rax
+  802537:	00 00 00 
+  80253a:	ff d0                	call   *%rax
+  80253c:	85 c0                	test   %eax,%eax
+  80253e:	0f 94 c0             	sete   %al
+  802541:	0f b6 c0             	movzbl %al,%eax
+}
+  802544:	c9                   	leave
+  802545:	c3                   	ret
+
+0000000000802546 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802546:	48 89 f8             	mov    %rdi,%rax
+  802549:	48 c1 e8 27          	shr    $0x27,%rax
+  80254d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802554:	01 00 00 
+  802557:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80255b:	f6 c2 01             	test   $0x1,%dl
+  80255e:	74 6d                	je     8025cd <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802560:	48 89 f8             	mov    %rdi,%rax
+  802563:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802567:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80256e:	01 00 00 
+  802571:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802575:	f6 c2 01             	test   $0x1,%dl
+  802578:	74 62                	je     8025dc <get_uvpt_entry+0x96>
+  80257a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802581:	01 00 00 
+  802584:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802588:	f6 c2 80             	test   $0x80,%dl
+  80258b:	75 4f                	jne    8025dc <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80258d:	48 89 f8             	mov    %rdi,%rax
+  802590:	48 c1 e8 15          	shr    $0x15,%rax
+  802594:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80259b:	01 00 00 
+  80259e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025a2:	f6 c2 01             	test   $0x1,%dl
+  8025a5:	74 44                	je     8025eb <get_uvpt_entry+0xa5>
+  8025a7:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025ae:	01 00 00 
+  8025b1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025b5:	f6 c2 80             	test   $0x80,%dl
+  8025b8:	75 31                	jne    8025eb <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8025ba:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8025be:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8025c5:	01 00 00 
+  8025c8:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8025cc:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8025cd:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8025d4:	01 00 00 
+  8025d7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025db:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025dc:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8025e3:	01 00 00 
+  8025e6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025ea:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025eb:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025f2:	01 00 00 
+  8025f5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025f9:	c3                   	ret
+
+00000000008025fa <get_prot>:
+
+int
+get_prot(void *va) {
+  8025fa:	55                   	push   %rbp
+  8025fb:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8025fe:	48 b8 46 25 80 00 00 	movabs $0x802546,%rax
+  802605:	00 00 00 
+  802608:	ff d0                	call   *%rax
+  80260a:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80260d:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802612:	89 c1                	mov    %eax,%ecx
+  802614:	83 c9 04             	or     $0x4,%ecx
+  802617:	f6 c2 01             	test   $0x1,%dl
+  80261a:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80261d:	89 c1                	mov    %eax,%ecx
+  80261f:	83 c9 02             	or     $0x2,%ecx
+  802622:	f6 c2 02             	test   $0x2,%dl
+  802625:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802628:	89 c1                	mov    %eax,%ecx
+  80262a:	83 c9 01             	or     $0x1,%ecx
+  80262d:	48 85 d2             	test   %rdx,%rdx
+  802630:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802633:	89 c1                	mov    %eax,%ecx
+  802635:	83 c9 40             	or     $0x40,%ecx
+  802638:	f6 c6 04             	test   $0x4,%dh
+  80263b:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80263e:	5d                   	pop    %rbp
+  80263f:	c3                   	ret
+
+0000000000802640 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802640:	55                   	push   %rbp
+  802641:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802644:	48 b8 46 25 80 00 00 	movabs $0x802546,%rax
+  80264b:	00 00 00 
+  80264e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802650:	48 c1 e8 06          	shr    $0x6,%rax
+  802654:	83 e0 01             	and    $0x1,%eax
+}
+  802657:	5d                   	pop    %rbp
+  802658:	c3                   	ret
+
+0000000000802659 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802659:	55                   	push   %rbp
+  80265a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80265d:	48 b8 46 25 80 00 00 	movabs $0x802546,%rax
+  802664:	00 00 00 
+  802667:	ff d0                	call   *%rax
+  802669:	83 e0 01             	and    $0x1,%eax
+}
+  80266c:	5d                   	pop    %rbp
+  80266d:	c3                   	ret
+
+000000000080266e <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80266e:	55                   	push   %rbp
+  80266f:	48 89 e5             	mov    %rsp,%rbp
+  802672:	41 57                	push   %r15
+  802674:	41 56                	push   %r14
+  802676:	41 55                	push   %r13
+  802678:	41 54                	push   %r12
+  80267a:	53                   	push   %rbx
+  80267b:	48 83 ec 18          	sub    $0x18,%rsp
+  80267f:	49 89 ff             	mov    %rdi,%r15
+  802682:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802686:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  80268b:	49 bc 59 26 80 00 00 	movabs $0x802659,%r12
+  802692:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802695:	49 be fa 25 80 00 00 	movabs $0x8025fa,%r14
+  80269c:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80269f:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  8026a6:	00 00 00 
+  8026a9:	eb 0c                	jmp    8026b7 <foreach_shared_region+0x49>
+  8026ab:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8026b2:	4c 39 eb             	cmp    %r13,%rbx
+  8026b5:	74 38                	je     8026ef <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  8026b7:	48 89 df             	mov    %rbx,%rdi
+  8026ba:	41 ff d4             	call   *%r12
+  8026bd:	84 c0                	test   %al,%al
+  8026bf:	74 ea                	je     8026ab <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  8026c1:	48 89 df             	mov    %rbx,%rdi
+  8026c4:	41 ff d6             	call   *%r14
+  8026c7:	a8 40                	test   $0x40,%al
+  8026c9:	74 e0                	je     8026ab <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8026cb:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8026d2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8026d6:	48 89 df             	mov    %rbx,%rdi
+  8026d9:	41 ff d7             	call   *%r15
+        if (err)
+  8026dc:	85 c0                	test   %eax,%eax
+  8026de:	74 cb                	je     8026ab <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8026e0:	48 83 c4 18          	add    $0x18,%rsp
+  8026e4:	5b                   	pop    %rbx
+  8026e5:	41 5c                	pop    %r12
+  8026e7:	41 5d                	pop    %r13
+  8026e9:	41 5e                	pop    %r14
+  8026eb:	41 5f                	pop    %r15
+  8026ed:	5d                   	pop    %rbp
+  8026ee:	c3                   	ret
+    return 0;
+  8026ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f4:	eb ea                	jmp    8026e0 <foreach_shared_region+0x72>
+
+00000000008026f6 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8026f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026fb:	c3                   	ret
+
+00000000008026fc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8026fc:	55                   	push   %rbp
+  8026fd:	48 89 e5             	mov    %rsp,%rbp
+  802700:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802703:	48 be d4 31 80 00 00 	movabs $0x8031d4,%rsi
+  80270a:	00 00 00 
+  80270d:	48 b8 fc 0a 80 00 00 	movabs $0x800afc,%rax
+  802714:	00 00 00 
+  802717:	ff d0                	call   *%rax
+    return 0;
+}
+  802719:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271e:	5d                   	pop    %rbp
+  80271f:	c3                   	ret
+
+0000000000802720 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802720:	55                   	push   %rbp
+  802721:	48 89 e5             	mov    %rsp,%rbp
+  802724:	41 57                	push   %r15
+  802726:	41 56                	push   %r14
+  802728:	41 55                	push   %r13
+  80272a:	41 54                	push   %r12
+  80272c:	53                   	push   %rbx
+  80272d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802734:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80273b:	48 85 d2             	test   %rdx,%rdx
+  80273e:	74 7a                	je     8027ba <devcons_write+0x9a>
+  802740:	49 89 d6             	mov    %rdx,%r14
+  802743:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802749:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80274e:	49 bf f6 0c 80 00 00 	movabs $0x800cf6,%r15
+  802755:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802758:	4c 89 f3             	mov    %r14,%rbx
+  80275b:	48 29 f3             	sub    %rsi,%rbx
+  80275e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802763:	48 39 c3             	cmp    %rax,%rbx
+  802766:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80276a:	4c 63 eb             	movslq %ebx,%r13
+  80276d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802774:	48 01 c6             	add    %rax,%rsi
+  802777:	4c 89 ea             	mov    %r13,%rdx
+  80277a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802781:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802784:	4c 89 ee             	mov    %r13,%rsi
+  802787:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80278e:	48 b8 23 0f 80 00 00 	movabs $0x800f23,%rax
+  802795:	00 00 00 
+  802798:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80279a:	41 01 dc             	add    %ebx,%r12d
+  80279d:	49 63 f4             	movslq %r12d,%rsi
+  8027a0:	4c 39 f6             	cmp    %r14,%rsi
+  8027a3:	72 b3                	jb     802758 <devcons_write+0x38>
+    return res;
+  8027a5:	49 63 c4             	movslq %r12d,%rax
+}
+  8027a8:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8027af:	5b                   	pop    %rbx
+  8027b0:	41 5c                	pop    %r12
+  8027b2:	41 5d                	pop    %r13
+  8027b4:	41 5e                	pop    %r14
+  8027b6:	41 5f                	pop    %r15
+  8027b8:	5d                   	pop    %rbp
+  8027b9:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8027ba:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8027c0:	eb e3                	jmp    8027a5 <devcons_write+0x85>
+
+00000000008027c2 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8027c2:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8027c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ca:	48 85 c0             	test   %rax,%rax
+  8027cd:	74 55                	je     802824 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8027cf:	55                   	push   %rbp
+  8027d0:	48 89 e5             	mov    %rsp,%rbp
+  8027d3:	41 55                	push   %r13
+  8027d5:	41 54                	push   %r12
+  8027d7:	53                   	push   %rbx
+  8027d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8027dc:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8027df:	48 bb 50 0f 80 00 00 	movabs $0x800f50,%rbx
+  8027e6:	00 00 00 
+  8027e9:	49 bc 1d 10 80 00 00 	movabs $0x80101d,%r12
+  8027f0:	00 00 00 
+  8027f3:	eb 03                	jmp    8027f8 <devcons_read+0x36>
+  8027f5:	41 ff d4             	call   *%r12
+  8027f8:	ff d3                	call   *%rbx
+  8027fa:	85 c0                	test   %eax,%eax
+  8027fc:	74 f7                	je     8027f5 <devcons_read+0x33>
+    if (c < 0) return c;
+  8027fe:	48 63 d0             	movslq %eax,%rdx
+  802801:	78 13                	js     802816 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802803:	ba 00 00 00 00       	mov    $0x0,%edx
+  802808:	83 f8 04             	cmp    $0x4,%eax
+  80280b:	74 09                	je     802816 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80280d:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802811:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802816:	48 89 d0             	mov    %rdx,%rax
+  802819:	48 83 c4 08          	add    $0x8,%rsp
+  80281d:	5b                   	pop    %rbx
+  80281e:	41 5c                	pop    %r12
+  802820:	41 5d                	pop    %r13
+  802822:	5d                   	pop    %rbp
+  802823:	c3                   	ret
+  802824:	48 89 d0             	mov    %rdx,%rax
+  802827:	c3                   	ret
+
+0000000000802828 <cputchar>:
+cputchar(int ch) {
+  802828:	55                   	push   %rbp
+  802829:	48 89 e5             	mov    %rsp,%rbp
+  80282c:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802830:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802834:	be 01 00 00 00       	mov    $0x1,%esi
+  802839:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80283d:	48 b8 23 0f 80 00 00 	movabs $0x800f23,%rax
+  802844:	00 00 00 
+  802847:	ff d0                	call   *%rax
+}
+  802849:	c9                   	leave
+  80284a:	c3                   	ret
+
+000000000080284b <getchar>:
+getchar(void) {
+  80284b:	55                   	push   %rbp
+  80284c:	48 89 e5             	mov    %rsp,%rbp
+  80284f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802853:	ba 01 00 00 00       	mov    $0x1,%edx
+  802858:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80285c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802861:	48 b8 bf 19 80 00 00 	movabs $0x8019bf,%rax
+  802868:	00 00 00 
+  80286b:	ff d0                	call   *%rax
+  80286d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80286f:	85 c0                	test   %eax,%eax
+  802871:	78 06                	js     802879 <getchar+0x2e>
+  802873:	74 08                	je     80287d <getchar+0x32>
+  802875:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802879:	89 d0                	mov    %edx,%eax
+  80287b:	c9                   	leave
+  80287c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80287d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802882:	eb f5                	jmp    802879 <getchar+0x2e>
+
+0000000000802884 <iscons>:
+iscons(int fdnum) {
+  802884:	55                   	push   %rbp
+  802885:	48 89 e5             	mov    %rsp,%rbp
+  802888:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80288c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802890:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  802897:	00 00 00 
+  80289a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80289c:	85 c0                	test   %eax,%eax
+  80289e:	78 18                	js     8028b8 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8028a0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028a4:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  8028ab:	00 00 00 
+  8028ae:	8b 00                	mov    (%rax),%eax
+  8028b0:	39 02                	cmp    %eax,(%rdx)
+  8028b2:	0f 94 c0             	sete   %al
+  8028b5:	0f b6 c0             	movzbl %al,%eax
+}
+  8028b8:	c9                   	leave
+  8028b9:	c3                   	ret
+
+00000000008028ba <opencons>:
+opencons(void) {
+  8028ba:	55                   	push   %rbp
+  8028bb:	48 89 e5             	mov    %rsp,%rbp
+  8028be:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8028c2:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8028c6:	48 b8 7c 16 80 00 00 	movabs $0x80167c,%rax
+  8028cd:	00 00 00 
+  8028d0:	ff d0                	call   *%rax
+  8028d2:	85 c0                	test   %eax,%eax
+  8028d4:	78 49                	js     80291f <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8028d6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8028db:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028e0:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8028e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028e9:	48 b8 ac 10 80 00 00 	movabs $0x8010ac,%rax
+  8028f0:	00 00 00 
+  8028f3:	ff d0                	call   *%rax
+  8028f5:	85 c0                	test   %eax,%eax
+  8028f7:	78 26                	js     80291f <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8028f9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028fd:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802904:	00 00 
+  802906:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802908:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80290c:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802913:	48 b8 4e 16 80 00 00 	movabs $0x80164e,%rax
+  80291a:	00 00 00 
+  80291d:	ff d0                	call   *%rax
+}
+  80291f:	c9                   	leave
+  802920:	c3                   	ret
+
+0000000000802921 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802921:	55                   	push   %rbp
+  802922:	48 89 e5             	mov    %rsp,%rbp
+  802925:	41 56                	push   %r14
+  802927:	41 55                	push   %r13
+  802929:	41 54                	push   %r12
+  80292b:	53                   	push   %rbx
+  80292c:	48 83 ec 50          	sub    $0x50,%rsp
+  802930:	49 89 fc             	mov    %rdi,%r12
+  802933:	41 89 f5             	mov    %esi,%r13d
+  802936:	48 89 d3             	mov    %rdx,%rbx
+  802939:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80293d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802941:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802945:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80294c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802950:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802954:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802958:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80295c:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802963:	00 00 00 
+  802966:	4c 8b 30             	mov    (%rax),%r14
+  802969:	48 b8 ec 0f 80 00 00 	movabs $0x800fec,%rax
+  802970:	00 00 00 
+  802973:	ff d0                	call   *%rax
+  802975:	89 c6                	mov    %eax,%esi
+  802977:	45 89 e8             	mov    %r13d,%r8d
+  80297a:	4c 89 e1             	mov    %r12,%rcx
+  80297d:	4c 89 f2             	mov    %r14,%rdx
+  802980:	48 bf e0 31 80 00 00 	movabs $0x8031e0,%rdi
+  802987:	00 00 00 
+  80298a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80298f:	49 bc d7 01 80 00 00 	movabs $0x8001d7,%r12
+  802996:	00 00 00 
+  802999:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80299c:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8029a0:	48 89 df             	mov    %rbx,%rdi
+  8029a3:	48 b8 73 01 80 00 00 	movabs $0x800173,%rax
+  8029aa:	00 00 00 
+  8029ad:	ff d0                	call   *%rax
+    cprintf("\n");
+  8029af:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  8029b6:	00 00 00 
+  8029b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029be:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8029c1:	cc                   	int3
+  8029c2:	eb fd                	jmp    8029c1 <_panic+0xa0>
+
+00000000008029c4 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8029c4:	55                   	push   %rbp
+  8029c5:	48 89 e5             	mov    %rsp,%rbp
+  8029c8:	41 54                	push   %r12
+  8029ca:	53                   	push   %rbx
+  8029cb:	48 89 fb             	mov    %rdi,%rbx
+  8029ce:	48 89 f7             	mov    %rsi,%rdi
+  8029d1:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8029d4:	48 85 f6             	test   %rsi,%rsi
+  8029d7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029de:	00 00 00 
+  8029e1:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8029e5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029ea:	48 b8 16 14 80 00 00 	movabs $0x801416,%rax
+  8029f1:	00 00 00 
+  8029f4:	ff d0                	call   *%rax
+    if (res < 0) {
+  8029f6:	85 c0                	test   %eax,%eax
+  8029f8:	78 45                	js     802a3f <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8029fa:	48 85 db             	test   %rbx,%rbx
+  8029fd:	74 12                	je     802a11 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8029ff:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802a06:	00 00 00 
+  802a09:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802a0f:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802a11:	4d 85 e4             	test   %r12,%r12
+  802a14:	74 14                	je     802a2a <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802a16:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802a1d:	00 00 00 
+  802a20:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802a26:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802a2a:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802a31:	00 00 00 
+  802a34:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802a3a:	5b                   	pop    %rbx
+  802a3b:	41 5c                	pop    %r12
+  802a3d:	5d                   	pop    %rbp
+  802a3e:	c3                   	ret
+        if (from_env_store)
+  802a3f:	48 85 db             	test   %rbx,%rbx
+  802a42:	74 06                	je     802a4a <ipc_recv+0x86>
+            *from_env_store = 0;
+  802a44:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802a4a:	4d 85 e4             	test   %r12,%r12
+  802a4d:	74 eb                	je     802a3a <ipc_recv+0x76>
+            *perm_store = 0;
+  802a4f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802a56:	00 
+  802a57:	eb e1                	jmp    802a3a <ipc_recv+0x76>
+
+0000000000802a59 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802a59:	55                   	push   %rbp
+  802a5a:	48 89 e5             	mov    %rsp,%rbp
+  802a5d:	41 57                	push   %r15
+  802a5f:	41 56                	push   %r14
+  802a61:	41 55                	push   %r13
+  802a63:	41 54                	push   %r12
+  802a65:	53                   	push   %rbx
+  802a66:	48 83 ec 18          	sub    $0x18,%rsp
+  802a6a:	41 89 fd             	mov    %edi,%r13d
+  802a6d:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802a70:	48 89 d3             	mov    %rdx,%rbx
+  802a73:	49 89 cc             	mov    %rcx,%r12
+  802a76:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a7a:	48 85 d2             	test   %rdx,%rdx
+  802a7d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a84:	00 00 00 
+  802a87:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a8b:	49 be ea 13 80 00 00 	movabs $0x8013ea,%r14
+  802a92:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802a95:	49 bf 1d 10 80 00 00 	movabs $0x80101d,%r15
+  802a9c:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a9f:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802aa2:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802aa6:	4c 89 e1             	mov    %r12,%rcx
+  802aa9:	48 89 da             	mov    %rbx,%rdx
+  802aac:	44 89 ef             	mov    %r13d,%edi
+  802aaf:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802ab2:	85 c0                	test   %eax,%eax
+  802ab4:	74 34                	je     802aea <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802ab6:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802ab9:	75 05                	jne    802ac0 <ipc_send+0x67>
+        sys_yield();
+  802abb:	41 ff d7             	call   *%r15
+    while (true) {
+  802abe:	eb df                	jmp    802a9f <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802ac0:	48 ba 03 32 80 00 00 	movabs $0x803203,%rdx
+  802ac7:	00 00 00 
+  802aca:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802acf:	48 bf 1c 32 80 00 00 	movabs $0x80321c,%rdi
+  802ad6:	00 00 00 
+  802ad9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ade:	48 b9 21 29 80 00 00 	movabs $0x802921,%rcx
+  802ae5:	00 00 00 
+  802ae8:	ff d1                	call   *%rcx
+    }
+}
+  802aea:	48 83 c4 18          	add    $0x18,%rsp
+  802aee:	5b                   	pop    %rbx
+  802aef:	41 5c                	pop    %r12
+  802af1:	41 5d                	pop    %r13
+  802af3:	41 5e                	pop    %r14
+  802af5:	41 5f                	pop    %r15
+  802af7:	5d                   	pop    %rbp
+  802af8:	c3                   	ret
+
+0000000000802af9 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802af9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802afe:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802b05:	00 00 00 
+  802b08:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802b0f:	48 01 ca             	add    %rcx,%rdx
+  802b12:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802b18:	39 fa                	cmp    %edi,%edx
+  802b1a:	74 12                	je     802b2e <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802b1c:	48 83 c0 01          	add    $0x1,%rax
+  802b20:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b26:	75 e0                	jne    802b08 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802b28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b2d:	c3                   	ret
+            return envs[i].env_id;
+  802b2e:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802b35:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b3c:	00 00 00 
+  802b3f:	48 01 d0             	add    %rdx,%rax
+  802b42:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b48:	c3                   	ret
+  802b49:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000802b50 <__rodata_start>:
+  802b50:	31 33                	xor    %esi,(%rbx)
+  802b52:	33 37                	xor    (%rdi),%esi
+  802b54:	2f                   	(bad)
+  802b55:	30 20                	xor    %ah,(%rax)
+  802b57:	69 73 20 25 30 38 78 	imul   $0x78383025,0x20(%rbx),%esi
+  802b5e:	21 0a                	and    %ecx,(%rdx)
+  802b60:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  802b67:	77 6e                	ja     802bd7 <__rodata_start+0x87>
+  802b69:	3e 00 30             	ds add %dh,(%rax)
+  802b6c:	31 32                	xor    %esi,(%rdx)
+  802b6e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802b75:	41                   	rex.B
+  802b76:	42                   	rex.X
+  802b77:	43                   	rex.XB
+  802b78:	44                   	rex.R
+  802b79:	45                   	rex.RB
+  802b7a:	46 00 30             	rex.RX add %r14b,(%rax)
+  802b7d:	31 32                	xor    %esi,(%rdx)
+  802b7f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802b86:	61                   	(bad)
+  802b87:	62 63 64 65 66       	(bad)
+  802b8c:	00 28                	add    %ch,(%rax)
+  802b8e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b8f:	75 6c                	jne    802bfd <__rodata_start+0xad>
+  802b91:	6c                   	insb   (%dx),%es:(%rdi)
+  802b92:	29 00                	sub    %eax,(%rax)
+  802b94:	65 72 72             	gs jb  802c09 <__rodata_start+0xb9>
+  802b97:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802b98:	72 20                	jb     802bba <__rodata_start+0x6a>
+  802b9a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802b9f:	73 70                	jae    802c11 <__rodata_start+0xc1>
+  802ba1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802ba5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802bac:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bad:	72 00                	jb     802baf <__rodata_start+0x5f>
+  802baf:	62 61 64 20 65       	(bad)
+  802bb4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bb5:	76 69                	jbe    802c20 <__rodata_start+0xd0>
+  802bb7:	72 6f                	jb     802c28 <__rodata_start+0xd8>
+  802bb9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bba:	6d                   	insl   (%dx),%es:(%rdi)
+  802bbb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802bbd:	74 00                	je     802bbf <__rodata_start+0x6f>
+  802bbf:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802bc6:	20 70 61             	and    %dh,0x61(%rax)
+  802bc9:	72 61                	jb     802c2c <__rodata_start+0xdc>
+  802bcb:	6d                   	insl   (%dx),%es:(%rdi)
+  802bcc:	65 74 65             	gs je  802c34 <__rodata_start+0xe4>
+  802bcf:	72 00                	jb     802bd1 <__rodata_start+0x81>
+  802bd1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bd2:	75 74                	jne    802c48 <__rodata_start+0xf8>
+  802bd4:	20 6f 66             	and    %ch,0x66(%rdi)
+  802bd7:	20 6d 65             	and    %ch,0x65(%rbp)
+  802bda:	6d                   	insl   (%dx),%es:(%rdi)
+  802bdb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bdc:	72 79                	jb     802c57 <__rodata_start+0x107>
+  802bde:	00 6f 75             	add    %ch,0x75(%rdi)
+  802be1:	74 20                	je     802c03 <__rodata_start+0xb3>
+  802be3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802be4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802be8:	76 69                	jbe    802c53 <__rodata_start+0x103>
+  802bea:	72 6f                	jb     802c5b <__rodata_start+0x10b>
+  802bec:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bed:	6d                   	insl   (%dx),%es:(%rdi)
+  802bee:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802bf0:	74 73                	je     802c65 <__rodata_start+0x115>
+  802bf2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802bf5:	72 72                	jb     802c69 <__rodata_start+0x119>
+  802bf7:	75 70                	jne    802c69 <__rodata_start+0x119>
+  802bf9:	74 65                	je     802c60 <__rodata_start+0x110>
+  802bfb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802c00:	75 67                	jne    802c69 <__rodata_start+0x119>
+  802c02:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802c05:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802c07:	00 73 65             	add    %dh,0x65(%rbx)
+  802c0a:	67 6d                	insl   (%dx),%es:(%edi)
+  802c0c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802c0e:	74 61                	je     802c71 <__rodata_start+0x121>
+  802c10:	74 69                	je     802c7b <__rodata_start+0x12b>
+  802c12:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c13:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c14:	20 66 61             	and    %ah,0x61(%rsi)
+  802c17:	75 6c                	jne    802c85 <__rodata_start+0x135>
+  802c19:	74 00                	je     802c1b <__rodata_start+0xcb>
+  802c1b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802c22:	20 45 4c             	and    %al,0x4c(%rbp)
+  802c25:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802c29:	61                   	(bad)
+  802c2a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802c2f:	20 73 75             	and    %dh,0x75(%rbx)
+  802c32:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802c35:	73 79                	jae    802cb0 <__rodata_start+0x160>
+  802c37:	73 74                	jae    802cad <__rodata_start+0x15d>
+  802c39:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802c3b:	20 63 61             	and    %ah,0x61(%rbx)
+  802c3e:	6c                   	insb   (%dx),%es:(%rdi)
+  802c3f:	6c                   	insb   (%dx),%es:(%rdi)
+  802c40:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802c43:	74 72                	je     802cb7 <__rodata_start+0x167>
+  802c45:	79 20                	jns    802c67 <__rodata_start+0x117>
+  802c47:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c48:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c49:	74 20                	je     802c6b <__rodata_start+0x11b>
+  802c4b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802c4d:	75 6e                	jne    802cbd <__rodata_start+0x16d>
+  802c4f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802c53:	76 20                	jbe    802c75 <__rodata_start+0x125>
+  802c55:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802c5c:	72 65                	jb     802cc3 <__rodata_start+0x173>
+  802c5e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802c61:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c62:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802c66:	65 78 70             	gs js  802cd9 <__rodata_start+0x189>
+  802c69:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802c6e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802c71:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802c75:	20 66 69             	and    %ah,0x69(%rsi)
+  802c78:	6c                   	insb   (%dx),%es:(%rdi)
+  802c79:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802c7d:	20 66 72             	and    %ah,0x72(%rsi)
+  802c80:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802c85:	61                   	(bad)
+  802c86:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802c89:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c8a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c8b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802c8f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802c92:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c93:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c94:	20 6d 61             	and    %ch,0x61(%rbp)
+  802c97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c98:	79 20                	jns    802cba <__rodata_start+0x16a>
+  802c9a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802ca1:	72 65                	jb     802d08 <__rodata_start+0x1b8>
+  802ca3:	20 6f 70             	and    %ch,0x70(%rdi)
+  802ca6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802ca8:	00 66 69             	add    %ah,0x69(%rsi)
+  802cab:	6c                   	insb   (%dx),%es:(%rdi)
+  802cac:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802cb0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802cb3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cb4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802cb7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cb8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cb9:	74 20                	je     802cdb <__rodata_start+0x18b>
+  802cbb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802cbd:	75 6e                	jne    802d2d <__rodata_start+0x1dd>
+  802cbf:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802cc3:	76 61                	jbe    802d26 <__rodata_start+0x1d6>
+  802cc5:	6c                   	insb   (%dx),%es:(%rdi)
+  802cc6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802ccd:	00 
+  802cce:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802cd5:	72 65                	jb     802d3c <__rodata_start+0x1ec>
+  802cd7:	61                   	(bad)
+  802cd8:	64 79 20             	fs jns 802cfb <__rodata_start+0x1ab>
+  802cdb:	65 78 69             	gs js  802d47 <__rodata_start+0x1f7>
+  802cde:	73 74                	jae    802d54 <__rodata_start+0x204>
+  802ce0:	73 00                	jae    802ce2 <__rodata_start+0x192>
+  802ce2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ce3:	70 65                	jo     802d4a <__rodata_start+0x1fa>
+  802ce5:	72 61                	jb     802d48 <__rodata_start+0x1f8>
+  802ce7:	74 69                	je     802d52 <__rodata_start+0x202>
+  802ce9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ceb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802cee:	74 20                	je     802d10 <__rodata_start+0x1c0>
+  802cf0:	73 75                	jae    802d67 <__rodata_start+0x217>
+  802cf2:	70 70                	jo     802d64 <__rodata_start+0x214>
+  802cf4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cf5:	72 74                	jb     802d6b <__rodata_start+0x21b>
+  802cf7:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802cfc:	65 72 61             	gs jb  802d60 <__rodata_start+0x210>
+  802cff:	74 69                	je     802d6a <__rodata_start+0x21a>
+  802d01:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d02:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d03:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802d06:	74 20                	je     802d28 <__rodata_start+0x1d8>
+  802d08:	70 65                	jo     802d6f <__rodata_start+0x21f>
+  802d0a:	72 6d                	jb     802d79 <__rodata_start+0x229>
+  802d0c:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  802d13:	2e 
+  802d14:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  802d1b:	00 
+  802d1c:	0f 1f 40 00          	nopl   0x0(%rax)
+  802d20:	c4 03 80 00          	(bad)
+  802d24:	00 00                	add    %al,(%rax)
+  802d26:	00 00                	add    %al,(%rax)
+  802d28:	05 0a 80 00 00       	add    $0x800a,%eax
+  802d2d:	00 00                	add    %al,(%rax)
+  802d2f:	00 f5                	add    %dh,%ch
+  802d31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d37:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ad47 <__bss_end+0x2d47>
+  802d3d:	00 00                	add    %al,(%rax)
+  802d3f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ad4f <__bss_end+0x2d4f>
+  802d45:	00 00                	add    %al,(%rax)
+  802d47:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ad57 <__bss_end+0x2d57>
+  802d4d:	00 00                	add    %al,(%rax)
+  802d4f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ad5f <__bss_end+0x2d5f>
+  802d55:	00 00                	add    %al,(%rax)
+  802d57:	00 e3                	add    %ah,%bl
+  802d59:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d5f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ad6f <__bss_end+0x2d6f>
+  802d65:	00 00                	add    %al,(%rax)
+  802d67:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ad77 <__bss_end+0x2d77>
+  802d6d:	00 00                	add    %al,(%rax)
+  802d6f:	00 d7                	add    %dl,%bh
+  802d71:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d77:	00 51 04             	add    %dl,0x4(%rcx)
+  802d7a:	80 00 00             	addb   $0x0,(%rax)
+  802d7d:	00 00                	add    %al,(%rax)
+  802d7f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ad8f <__bss_end+0x2d8f>
+  802d85:	00 00                	add    %al,(%rax)
+  802d87:	00 d7                	add    %dl,%bh
+  802d89:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d8f:	00 1d 04 80 00 00    	add    %bl,0x8004(%rip)        # 80ad99 <__bss_end+0x2d99>
+  802d95:	00 00                	add    %al,(%rax)
+  802d97:	00 1d 04 80 00 00    	add    %bl,0x8004(%rip)        # 80ada1 <__bss_end+0x2da1>
+  802d9d:	00 00                	add    %al,(%rax)
+  802d9f:	00 1d 04 80 00 00    	add    %bl,0x8004(%rip)        # 80ada9 <__bss_end+0x2da9>
+  802da5:	00 00                	add    %al,(%rax)
+  802da7:	00 1d 04 80 00 00    	add    %bl,0x8004(%rip)        # 80adb1 <__bss_end+0x2db1>
+  802dad:	00 00                	add    %al,(%rax)
+  802daf:	00 1d 04 80 00 00    	add    %bl,0x8004(%rip)        # 80adb9 <__bss_end+0x2db9>
+  802db5:	00 00                	add    %al,(%rax)
+  802db7:	00 1d 04 80 00 00    	add    %bl,0x8004(%rip)        # 80adc1 <__bss_end+0x2dc1>
+  802dbd:	00 00                	add    %al,(%rax)
+  802dbf:	00 1d 04 80 00 00    	add    %bl,0x8004(%rip)        # 80adc9 <__bss_end+0x2dc9>
+  802dc5:	00 00                	add    %al,(%rax)
+  802dc7:	00 1d 04 80 00 00    	add    %bl,0x8004(%rip)        # 80add1 <__bss_end+0x2dd1>
+  802dcd:	00 00                	add    %al,(%rax)
+  802dcf:	00 1d 04 80 00 00    	add    %bl,0x8004(%rip)        # 80add9 <__bss_end+0x2dd9>
+  802dd5:	00 00                	add    %al,(%rax)
+  802dd7:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ade7 <__bss_end+0x2de7>
+  802ddd:	00 00                	add    %al,(%rax)
+  802ddf:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80adef <__bss_end+0x2def>
+  802de5:	00 00                	add    %al,(%rax)
+  802de7:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80adf7 <__bss_end+0x2df7>
+  802ded:	00 00                	add    %al,(%rax)
+  802def:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80adff <__bss_end+0x2dff>
+  802df5:	00 00                	add    %al,(%rax)
+  802df7:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae07 <__bss_end+0x2e07>
+  802dfd:	00 00                	add    %al,(%rax)
+  802dff:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae0f <__bss_end+0x2e0f>
+  802e05:	00 00                	add    %al,(%rax)
+  802e07:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae17 <__bss_end+0x2e17>
+  802e0d:	00 00                	add    %al,(%rax)
+  802e0f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae1f <__bss_end+0x2e1f>
+  802e15:	00 00                	add    %al,(%rax)
+  802e17:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae27 <__bss_end+0x2e27>
+  802e1d:	00 00                	add    %al,(%rax)
+  802e1f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae2f <__bss_end+0x2e2f>
+  802e25:	00 00                	add    %al,(%rax)
+  802e27:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae37 <__bss_end+0x2e37>
+  802e2d:	00 00                	add    %al,(%rax)
+  802e2f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae3f <__bss_end+0x2e3f>
+  802e35:	00 00                	add    %al,(%rax)
+  802e37:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae47 <__bss_end+0x2e47>
+  802e3d:	00 00                	add    %al,(%rax)
+  802e3f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae4f <__bss_end+0x2e4f>
+  802e45:	00 00                	add    %al,(%rax)
+  802e47:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae57 <__bss_end+0x2e57>
+  802e4d:	00 00                	add    %al,(%rax)
+  802e4f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae5f <__bss_end+0x2e5f>
+  802e55:	00 00                	add    %al,(%rax)
+  802e57:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae67 <__bss_end+0x2e67>
+  802e5d:	00 00                	add    %al,(%rax)
+  802e5f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae6f <__bss_end+0x2e6f>
+  802e65:	00 00                	add    %al,(%rax)
+  802e67:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae77 <__bss_end+0x2e77>
+  802e6d:	00 00                	add    %al,(%rax)
+  802e6f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae7f <__bss_end+0x2e7f>
+  802e75:	00 00                	add    %al,(%rax)
+  802e77:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae87 <__bss_end+0x2e87>
+  802e7d:	00 00                	add    %al,(%rax)
+  802e7f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae8f <__bss_end+0x2e8f>
+  802e85:	00 00                	add    %al,(%rax)
+  802e87:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae97 <__bss_end+0x2e97>
+  802e8d:	00 00                	add    %al,(%rax)
+  802e8f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ae9f <__bss_end+0x2e9f>
+  802e95:	00 00                	add    %al,(%rax)
+  802e97:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80aea7 <__bss_end+0x2ea7>
+  802e9d:	00 00                	add    %al,(%rax)
+  802e9f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80aeaf <__bss_end+0x2eaf>
+  802ea5:	00 00                	add    %al,(%rax)
+  802ea7:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80aeb7 <__bss_end+0x2eb7>
+  802ead:	00 00                	add    %al,(%rax)
+  802eaf:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80aebf <__bss_end+0x2ebf>
+  802eb5:	00 00                	add    %al,(%rax)
+  802eb7:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80aec7 <__bss_end+0x2ec7>
+  802ebd:	00 00                	add    %al,(%rax)
+  802ebf:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80aecf <__bss_end+0x2ecf>
+  802ec5:	00 00                	add    %al,(%rax)
+  802ec7:	00 28                	add    %ch,(%rax)
+  802ec9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ecf:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80aedf <__bss_end+0x2edf>
+  802ed5:	00 00                	add    %al,(%rax)
+  802ed7:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80aee7 <__bss_end+0x2ee7>
+  802edd:	00 00                	add    %al,(%rax)
+  802edf:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80aeef <__bss_end+0x2eef>
+  802ee5:	00 00                	add    %al,(%rax)
+  802ee7:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80aef7 <__bss_end+0x2ef7>
+  802eed:	00 00                	add    %al,(%rax)
+  802eef:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80aeff <__bss_end+0x2eff>
+  802ef5:	00 00                	add    %al,(%rax)
+  802ef7:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80af07 <__bss_end+0x2f07>
+  802efd:	00 00                	add    %al,(%rax)
+  802eff:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80af0f <__bss_end+0x2f0f>
+  802f05:	00 00                	add    %al,(%rax)
+  802f07:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80af17 <__bss_end+0x2f17>
+  802f0d:	00 00                	add    %al,(%rax)
+  802f0f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80af1f <__bss_end+0x2f1f>
+  802f15:	00 00                	add    %al,(%rax)
+  802f17:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80af27 <__bss_end+0x2f27>
+  802f1d:	00 00                	add    %al,(%rax)
+  802f1f:	00 74 04 80          	add    %dh,-0x80(%rsp,%rax,1)
+  802f23:	00 00                	add    %al,(%rax)
+  802f25:	00 00                	add    %al,(%rax)
+  802f27:	00 43 06             	add    %al,0x6(%rbx)
+  802f2a:	80 00 00             	addb   $0x0,(%rax)
+  802f2d:	00 00                	add    %al,(%rax)
+  802f2f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80af3f <__bss_end+0x2f3f>
+  802f35:	00 00                	add    %al,(%rax)
+  802f37:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80af47 <__bss_end+0x2f47>
+  802f3d:	00 00                	add    %al,(%rax)
+  802f3f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80af4f <__bss_end+0x2f4f>
+  802f45:	00 00                	add    %al,(%rax)
+  802f47:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80af57 <__bss_end+0x2f57>
+  802f4d:	00 00                	add    %al,(%rax)
+  802f4f:	00 a3 04 80 00 00    	add    %ah,0x8004(%rbx)
+  802f55:	00 00                	add    %al,(%rax)
+  802f57:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80af67 <__bss_end+0x2f67>
+  802f5d:	00 00                	add    %al,(%rax)
+  802f5f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80af6f <__bss_end+0x2f6f>
+  802f65:	00 00                	add    %al,(%rax)
+  802f67:	00 69 04             	add    %ch,0x4(%rcx)
+  802f6a:	80 00 00             	addb   $0x0,(%rax)
+  802f6d:	00 00                	add    %al,(%rax)
+  802f6f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80af7f <__bss_end+0x2f7f>
+  802f75:	00 00                	add    %al,(%rax)
+  802f77:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80af87 <__bss_end+0x2f87>
+  802f7d:	00 00                	add    %al,(%rax)
+  802f7f:	00 eb                	add    %ch,%bl
+  802f81:	07                   	(bad)
+  802f82:	80 00 00             	addb   $0x0,(%rax)
+  802f85:	00 00                	add    %al,(%rax)
+  802f87:	00 b5 08 80 00 00    	add    %dh,0x8008(%rbp)
+  802f8d:	00 00                	add    %al,(%rax)
+  802f8f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80af9f <__bss_end+0x2f9f>
+  802f95:	00 00                	add    %al,(%rax)
+  802f97:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80afa7 <__bss_end+0x2fa7>
+  802f9d:	00 00                	add    %al,(%rax)
+  802f9f:	00 3a                	add    %bh,(%rdx)
+  802fa1:	05 80 00 00 00       	add    $0x80,%eax
+  802fa6:	00 00                	add    %al,(%rax)
+  802fa8:	05 0a 80 00 00       	add    $0x800a,%eax
+  802fad:	00 00                	add    %al,(%rax)
+  802faf:	00 17                	add    %dl,(%rdi)
+  802fb1:	07                   	(bad)
+  802fb2:	80 00 00             	addb   $0x0,(%rax)
+  802fb5:	00 00                	add    %al,(%rax)
+  802fb7:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80afc7 <__bss_end+0x2fc7>
+  802fbd:	00 00                	add    %al,(%rax)
+  802fbf:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80afcf <__bss_end+0x2fcf>
+  802fc5:	00 00                	add    %al,(%rax)
+  802fc7:	00 28                	add    %ch,(%rax)
+  802fc9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fcf:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80afdf <__bss_end+0x2fdf>
+  802fd5:	00 00                	add    %al,(%rax)
+  802fd7:	00 cd                	add    %cl,%ch
+  802fd9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000802fe0 <error_string>:
+	...
+  802fe8:	9d 2b 80 00 00 00 00 00 af 2b 80 00 00 00 00 00     .+.......+......
+  802ff8:	bf 2b 80 00 00 00 00 00 d1 2b 80 00 00 00 00 00     .+.......+......
+  803008:	df 2b 80 00 00 00 00 00 f3 2b 80 00 00 00 00 00     .+.......+......
+  803018:	08 2c 80 00 00 00 00 00 1b 2c 80 00 00 00 00 00     .,.......,......
+  803028:	2d 2c 80 00 00 00 00 00 41 2c 80 00 00 00 00 00     -,......A,......
+  803038:	51 2c 80 00 00 00 00 00 64 2c 80 00 00 00 00 00     Q,......d,......
+  803048:	7b 2c 80 00 00 00 00 00 91 2c 80 00 00 00 00 00     {,.......,......
+  803058:	a9 2c 80 00 00 00 00 00 c1 2c 80 00 00 00 00 00     .,.......,......
+  803068:	ce 2c 80 00 00 00 00 00 90 30 80 00 00 00 00 00     .,.......0......
+  803078:	e2 2c 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .,..............
+  803088:	fa 2c 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .,......file is 
+  803098:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8030a8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8030b8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8030c8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8030d8:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  8030e8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8030f8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803108:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803118:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803128:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803138:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803148:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803158:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803160 <devtab>:
+  803160:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803170:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803180:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803190:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8031a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8031b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8031c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8031d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8031e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8031f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803200:	3a 20 00 69 70 63 5f 73 65 6e 64 3a 20 66 61 69     : .ipc_send: fai
+  803210:	6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62 2f     led to send.lib/
+  803220:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803230:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803240:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803250:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803260:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803270:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803280:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803290:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8032e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803300:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803310:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803320:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803330:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803340:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803350:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803360:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803370:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803380:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803390:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803400:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803410:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803420:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803430:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803440:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803450:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803460:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803470:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803480:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803490:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803500:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803510:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803520:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803530:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803540:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803550:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803560:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803570:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803580:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803590:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803600:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803610:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803620:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803630:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803640:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803650:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803660:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803670:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803680:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803690:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803700:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803710:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803720:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803730:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803740:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803750:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803760:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803770:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803780:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803790:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803800:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803810:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
@@ -0,0 +1,5800 @@
+
+obj/user/dumbfork:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 7f 01 00 00       	call   8001a2 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <dumbfork>:
+        sys_yield();
+    }
+}
+
+envid_t
+dumbfork(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80002e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800033:	cd 30                	int    $0x30
+  800035:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  800037:	85 c0                	test   %eax,%eax
+  800039:	78 4e                	js     800089 <dumbfork+0x64>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  80003b:	74 79                	je     8000b6 <dumbfork+0x91>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  80003d:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  800043:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80004a:	00 00 00 
+  80004d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800052:	89 c2                	mov    %eax,%edx
+  800054:	be 00 00 00 00       	mov    $0x0,%esi
+  800059:	bf 00 00 00 00       	mov    $0x0,%edi
+  80005e:	48 b8 f8 12 80 00 00 	movabs $0x8012f8,%rax
+  800065:	00 00 00 
+  800068:	ff d0                	call   *%rax
+
+    /* Start the child environment running */
+    if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80006a:	be 02 00 00 00       	mov    $0x2,%esi
+  80006f:	89 df                	mov    %ebx,%edi
+  800071:	48 b8 94 14 80 00 00 	movabs $0x801494,%rax
+  800078:	00 00 00 
+  80007b:	ff d0                	call   *%rax
+  80007d:	85 c0                	test   %eax,%eax
+  80007f:	78 64                	js     8000e5 <dumbfork+0xc0>
+        panic("sys_env_set_status: %i", r);
+
+    return envid;
+}
+  800081:	89 d8                	mov    %ebx,%eax
+  800083:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800087:	c9                   	leave
+  800088:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  800089:	89 c1                	mov    %eax,%ecx
+  80008b:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  800092:	00 00 00 
+  800095:	be 23 00 00 00       	mov    $0x23,%esi
+  80009a:	48 bf a0 2c 80 00 00 	movabs $0x802ca0,%rdi
+  8000a1:	00 00 00 
+  8000a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a9:	49 b8 6c 02 80 00 00 	movabs $0x80026c,%r8
+  8000b0:	00 00 00 
+  8000b3:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8000b6:	48 b8 d1 11 80 00 00 	movabs $0x8011d1,%rax
+  8000bd:	00 00 00 
+  8000c0:	ff d0                	call   *%rax
+  8000c2:	0f b6 c0             	movzbl %al,%eax
+  8000c5:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8000cc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000d3:	00 00 00 
+  8000d6:	48 01 d0             	add    %rdx,%rax
+  8000d9:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000e0:	00 00 00 
+        return 0;
+  8000e3:	eb 9c                	jmp    800081 <dumbfork+0x5c>
+        panic("sys_env_set_status: %i", r);
+  8000e5:	89 c1                	mov    %eax,%ecx
+  8000e7:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  8000ee:	00 00 00 
+  8000f1:	be 33 00 00 00       	mov    $0x33,%esi
+  8000f6:	48 bf a0 2c 80 00 00 	movabs $0x802ca0,%rdi
+  8000fd:	00 00 00 
+  800100:	b8 00 00 00 00       	mov    $0x0,%eax
+  800105:	49 b8 6c 02 80 00 00 	movabs $0x80026c,%r8
+  80010c:	00 00 00 
+  80010f:	41 ff d0             	call   *%r8
+
+0000000000800112 <umain>:
+umain(int argc, char **argv) {
+  800112:	55                   	push   %rbp
+  800113:	48 89 e5             	mov    %rsp,%rbp
+  800116:	41 57                	push   %r15
+  800118:	41 56                	push   %r14
+  80011a:	41 55                	push   %r13
+  80011c:	41 54                	push   %r12
+  80011e:	53                   	push   %rbx
+  80011f:	48 83 ec 08          	sub    $0x8,%rsp
+    who = dumbfork();
+  800123:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80012a:	00 00 00 
+  80012d:	ff d0                	call   *%rax
+  80012f:	41 89 c4             	mov    %eax,%r12d
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  800132:	85 c0                	test   %eax,%eax
+  800134:	49 bd c7 2c 80 00 00 	movabs $0x802cc7,%r13
+  80013b:	00 00 00 
+  80013e:	48 b8 ce 2c 80 00 00 	movabs $0x802cce,%rax
+  800145:	00 00 00 
+  800148:	4c 0f 44 e8          	cmove  %rax,%r13
+  80014c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  800151:	49 bf bc 03 80 00 00 	movabs $0x8003bc,%r15
+  800158:	00 00 00 
+        sys_yield();
+  80015b:	49 be 02 12 80 00 00 	movabs $0x801202,%r14
+  800162:	00 00 00 
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  800165:	eb 22                	jmp    800189 <umain+0x77>
+  800167:	83 fb 13             	cmp    $0x13,%ebx
+  80016a:	7f 27                	jg     800193 <umain+0x81>
+        cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  80016c:	4c 89 ea             	mov    %r13,%rdx
+  80016f:	89 de                	mov    %ebx,%esi
+  800171:	48 bf d4 2c 80 00 00 	movabs $0x802cd4,%rdi
+  800178:	00 00 00 
+  80017b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800180:	41 ff d7             	call   *%r15
+        sys_yield();
+  800183:	41 ff d6             	call   *%r14
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  800186:	83 c3 01             	add    $0x1,%ebx
+  800189:	45 85 e4             	test   %r12d,%r12d
+  80018c:	74 d9                	je     800167 <umain+0x55>
+  80018e:	83 fb 09             	cmp    $0x9,%ebx
+  800191:	7e d9                	jle    80016c <umain+0x5a>
+}
+  800193:	48 83 c4 08          	add    $0x8,%rsp
+  800197:	5b                   	pop    %rbx
+  800198:	41 5c                	pop    %r12
+  80019a:	41 5d                	pop    %r13
+  80019c:	41 5e                	pop    %r14
+  80019e:	41 5f                	pop    %r15
+  8001a0:	5d                   	pop    %rbp
+  8001a1:	c3                   	ret
+
+00000000008001a2 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001a2:	55                   	push   %rbp
+  8001a3:	48 89 e5             	mov    %rsp,%rbp
+  8001a6:	41 56                	push   %r14
+  8001a8:	41 55                	push   %r13
+  8001aa:	41 54                	push   %r12
+  8001ac:	53                   	push   %rbx
+  8001ad:	41 89 fd             	mov    %edi,%r13d
+  8001b0:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001b3:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8001ba:	00 00 00 
+  8001bd:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8001c4:	00 00 00 
+  8001c7:	48 39 c2             	cmp    %rax,%rdx
+  8001ca:	73 17                	jae    8001e3 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001cc:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001cf:	49 89 c4             	mov    %rax,%r12
+  8001d2:	48 83 c3 08          	add    $0x8,%rbx
+  8001d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001db:	ff 53 f8             	call   *-0x8(%rbx)
+  8001de:	4c 39 e3             	cmp    %r12,%rbx
+  8001e1:	72 ef                	jb     8001d2 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8001e3:	48 b8 d1 11 80 00 00 	movabs $0x8011d1,%rax
+  8001ea:	00 00 00 
+  8001ed:	ff d0                	call   *%rax
+  8001ef:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8001f2:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8001f9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800200:	00 00 00 
+  800203:	48 01 d0             	add    %rdx,%rax
+  800206:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80020d:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800210:	45 85 ed             	test   %r13d,%r13d
+  800213:	7e 0d                	jle    800222 <libmain+0x80>
+  800215:	49 8b 06             	mov    (%r14),%rax
+  800218:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80021f:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800222:	4c 89 f6             	mov    %r14,%rsi
+  800225:	44 89 ef             	mov    %r13d,%edi
+  800228:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  80022f:	00 00 00 
+  800232:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800234:	48 b8 49 02 80 00 00 	movabs $0x800249,%rax
+  80023b:	00 00 00 
+  80023e:	ff d0                	call   *%rax
+#endif
+}
+  800240:	5b                   	pop    %rbx
+  800241:	41 5c                	pop    %r12
+  800243:	41 5d                	pop    %r13
+  800245:	41 5e                	pop    %r14
+  800247:	5d                   	pop    %rbp
+  800248:	c3                   	ret
+
+0000000000800249 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800249:	55                   	push   %rbp
+  80024a:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80024d:	48 b8 59 1a 80 00 00 	movabs $0x801a59,%rax
+  800254:	00 00 00 
+  800257:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800259:	bf 00 00 00 00       	mov    $0x0,%edi
+  80025e:	48 b8 66 11 80 00 00 	movabs $0x801166,%rax
+  800265:	00 00 00 
+  800268:	ff d0                	call   *%rax
+}
+  80026a:	5d                   	pop    %rbp
+  80026b:	c3                   	ret
+
+000000000080026c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80026c:	55                   	push   %rbp
+  80026d:	48 89 e5             	mov    %rsp,%rbp
+  800270:	41 56                	push   %r14
+  800272:	41 55                	push   %r13
+  800274:	41 54                	push   %r12
+  800276:	53                   	push   %rbx
+  800277:	48 83 ec 50          	sub    $0x50,%rsp
+  80027b:	49 89 fc             	mov    %rdi,%r12
+  80027e:	41 89 f5             	mov    %esi,%r13d
+  800281:	48 89 d3             	mov    %rdx,%rbx
+  800284:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800288:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80028c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800290:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800297:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80029b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80029f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002a3:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002a7:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8002ae:	00 00 00 
+  8002b1:	4c 8b 30             	mov    (%rax),%r14
+  8002b4:	48 b8 d1 11 80 00 00 	movabs $0x8011d1,%rax
+  8002bb:	00 00 00 
+  8002be:	ff d0                	call   *%rax
+  8002c0:	89 c6                	mov    %eax,%esi
+  8002c2:	45 89 e8             	mov    %r13d,%r8d
+  8002c5:	4c 89 e1             	mov    %r12,%rcx
+  8002c8:	4c 89 f2             	mov    %r14,%rdx
+  8002cb:	48 bf f0 2c 80 00 00 	movabs $0x802cf0,%rdi
+  8002d2:	00 00 00 
+  8002d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002da:	49 bc bc 03 80 00 00 	movabs $0x8003bc,%r12
+  8002e1:	00 00 00 
+  8002e4:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002e7:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002eb:	48 89 df             	mov    %rbx,%rdi
+  8002ee:	48 b8 58 03 80 00 00 	movabs $0x800358,%rax
+  8002f5:	00 00 00 
+  8002f8:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002fa:	48 bf e4 2c 80 00 00 	movabs $0x802ce4,%rdi
+  800301:	00 00 00 
+  800304:	b8 00 00 00 00       	mov    $0x0,%eax
+  800309:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80030c:	cc                   	int3
+  80030d:	eb fd                	jmp    80030c <_panic+0xa0>
+
+000000000080030f <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80030f:	55                   	push   %rbp
+  800310:	48 89 e5             	mov    %rsp,%rbp
+  800313:	53                   	push   %rbx
+  800314:	48 83 ec 08          	sub    $0x8,%rsp
+  800318:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80031b:	8b 06                	mov    (%rsi),%eax
+  80031d:	8d 50 01             	lea    0x1(%rax),%edx
+  800320:	89 16                	mov    %edx,(%rsi)
+  800322:	48 98                	cltq
+  800324:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800329:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80032f:	74 0a                	je     80033b <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800331:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800335:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800339:	c9                   	leave
+  80033a:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80033b:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80033f:	be ff 00 00 00       	mov    $0xff,%esi
+  800344:	48 b8 08 11 80 00 00 	movabs $0x801108,%rax
+  80034b:	00 00 00 
+  80034e:	ff d0                	call   *%rax
+        state->offset = 0;
+  800350:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800356:	eb d9                	jmp    800331 <putch+0x22>
+
+0000000000800358 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800358:	55                   	push   %rbp
+  800359:	48 89 e5             	mov    %rsp,%rbp
+  80035c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800363:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800366:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80036d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800372:	b8 00 00 00 00       	mov    $0x0,%eax
+  800377:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80037a:	48 89 f1             	mov    %rsi,%rcx
+  80037d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800384:	48 bf 0f 03 80 00 00 	movabs $0x80030f,%rdi
+  80038b:	00 00 00 
+  80038e:	48 b8 0c 05 80 00 00 	movabs $0x80050c,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80039a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003a1:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003a8:	48 b8 08 11 80 00 00 	movabs $0x801108,%rax
+  8003af:	00 00 00 
+  8003b2:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003b4:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003ba:	c9                   	leave
+  8003bb:	c3                   	ret
+
+00000000008003bc <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003bc:	55                   	push   %rbp
+  8003bd:	48 89 e5             	mov    %rsp,%rbp
+  8003c0:	48 83 ec 50          	sub    $0x50,%rsp
+  8003c4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003c8:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003cc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003d0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003d4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003d8:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003df:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003e7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003eb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003ef:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003f3:	48 b8 58 03 80 00 00 	movabs $0x800358,%rax
+  8003fa:	00 00 00 
+  8003fd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003ff:	c9                   	leave
+  800400:	c3                   	ret
+
+0000000000800401 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800401:	55                   	push   %rbp
+  800402:	48 89 e5             	mov    %rsp,%rbp
+  800405:	41 57                	push   %r15
+  800407:	41 56                	push   %r14
+  800409:	41 55                	push   %r13
+  80040b:	41 54                	push   %r12
+  80040d:	53                   	push   %rbx
+  80040e:	48 83 ec 18          	sub    $0x18,%rsp
+  800412:	49 89 fc             	mov    %rdi,%r12
+  800415:	49 89 f5             	mov    %rsi,%r13
+  800418:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80041c:	8b 45 10             	mov    0x10(%rbp),%eax
+  80041f:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800422:	41 89 cf             	mov    %ecx,%r15d
+  800425:	4c 39 fa             	cmp    %r15,%rdx
+  800428:	73 5b                	jae    800485 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80042a:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80042e:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800432:	85 db                	test   %ebx,%ebx
+  800434:	7e 0e                	jle    800444 <print_num+0x43>
+            putch(padc, put_arg);
+  800436:	4c 89 ee             	mov    %r13,%rsi
+  800439:	44 89 f7             	mov    %r14d,%edi
+  80043c:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80043f:	83 eb 01             	sub    $0x1,%ebx
+  800442:	75 f2                	jne    800436 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800444:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800448:	48 b9 24 2d 80 00 00 	movabs $0x802d24,%rcx
+  80044f:	00 00 00 
+  800452:	48 b8 13 2d 80 00 00 	movabs $0x802d13,%rax
+  800459:	00 00 00 
+  80045c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800460:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800464:	ba 00 00 00 00       	mov    $0x0,%edx
+  800469:	49 f7 f7             	div    %r15
+  80046c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800470:	4c 89 ee             	mov    %r13,%rsi
+  800473:	41 ff d4             	call   *%r12
+}
+  800476:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80047a:	5b                   	pop    %rbx
+  80047b:	41 5c                	pop    %r12
+  80047d:	41 5d                	pop    %r13
+  80047f:	41 5e                	pop    %r14
+  800481:	41 5f                	pop    %r15
+  800483:	5d                   	pop    %rbp
+  800484:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800485:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800489:	ba 00 00 00 00       	mov    $0x0,%edx
+  80048e:	49 f7 f7             	div    %r15
+  800491:	48 83 ec 08          	sub    $0x8,%rsp
+  800495:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800499:	52                   	push   %rdx
+  80049a:	45 0f be c9          	movsbl %r9b,%r9d
+  80049e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004a2:	48 89 c2             	mov    %rax,%rdx
+  8004a5:	48 b8 01 04 80 00 00 	movabs $0x800401,%rax
+  8004ac:	00 00 00 
+  8004af:	ff d0                	call   *%rax
+  8004b1:	48 83 c4 10          	add    $0x10,%rsp
+  8004b5:	eb 8d                	jmp    800444 <print_num+0x43>
+
+00000000008004b7 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004b7:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004bb:	48 8b 06             	mov    (%rsi),%rax
+  8004be:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004c2:	73 0a                	jae    8004ce <sprintputch+0x17>
+        *state->start++ = ch;
+  8004c4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004c8:	48 89 16             	mov    %rdx,(%rsi)
+  8004cb:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004ce:	c3                   	ret
+
+00000000008004cf <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004cf:	55                   	push   %rbp
+  8004d0:	48 89 e5             	mov    %rsp,%rbp
+  8004d3:	48 83 ec 50          	sub    $0x50,%rsp
+  8004d7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004db:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004df:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004e3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004ea:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004f2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004f6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004fa:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004fe:	48 b8 0c 05 80 00 00 	movabs $0x80050c,%rax
+  800505:	00 00 00 
+  800508:	ff d0                	call   *%rax
+}
+  80050a:	c9                   	leave
+  80050b:	c3                   	ret
+
+000000000080050c <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80050c:	55                   	push   %rbp
+  80050d:	48 89 e5             	mov    %rsp,%rbp
+  800510:	41 57                	push   %r15
+  800512:	41 56                	push   %r14
+  800514:	41 55                	push   %r13
+  800516:	41 54                	push   %r12
+  800518:	53                   	push   %rbx
+  800519:	48 83 ec 38          	sub    $0x38,%rsp
+  80051d:	49 89 fe             	mov    %rdi,%r14
+  800520:	49 89 f5             	mov    %rsi,%r13
+  800523:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800526:	48 8b 01             	mov    (%rcx),%rax
+  800529:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80052d:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800531:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800535:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800539:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80053d:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800541:	0f b6 3b             	movzbl (%rbx),%edi
+  800544:	40 80 ff 25          	cmp    $0x25,%dil
+  800548:	74 18                	je     800562 <vprintfmt+0x56>
+            if (!ch) return;
+  80054a:	40 84 ff             	test   %dil,%dil
+  80054d:	0f 84 b1 06 00 00    	je     800c04 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800553:	40 0f b6 ff          	movzbl %dil,%edi
+  800557:	4c 89 ee             	mov    %r13,%rsi
+  80055a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80055d:	4c 89 e3             	mov    %r12,%rbx
+  800560:	eb db                	jmp    80053d <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800562:	be 00 00 00 00       	mov    $0x0,%esi
+  800567:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80056b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800570:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800576:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80057d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800581:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800586:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80058b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80058e:	83 e8 23             	sub    $0x23,%eax
+  800591:	3c 57                	cmp    $0x57,%al
+  800593:	0f 87 51 06 00 00    	ja     800bea <vprintfmt+0x6de>
+  800599:	0f b6 c0             	movzbl %al,%eax
+  80059c:	48 b9 c0 2e 80 00 00 	movabs $0x802ec0,%rcx
+  8005a3:	00 00 00 
+  8005a6:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005a9:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005ac:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005b0:	eb cf                	jmp    800581 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005b2:	49 89 dc             	mov    %rbx,%r12
+  8005b5:	be 01 00 00 00       	mov    $0x1,%esi
+  8005ba:	eb c5                	jmp    800581 <vprintfmt+0x75>
+            padc = ch;
+  8005bc:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005c0:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005c3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005c6:	eb b9                	jmp    800581 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ce:	77 24                	ja     8005f4 <vprintfmt+0xe8>
+  8005d0:	89 c1                	mov    %eax,%ecx
+  8005d2:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005d6:	83 c0 08             	add    $0x8,%eax
+  8005d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005dc:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005df:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005e2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005e6:	79 99                	jns    800581 <vprintfmt+0x75>
+                width = precision;
+  8005e8:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005ec:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005f2:	eb 8d                	jmp    800581 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005f4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005f8:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800600:	eb da                	jmp    8005dc <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800602:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800607:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80060b:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800611:	3c 39                	cmp    $0x39,%al
+  800613:	77 1c                	ja     800631 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800615:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800619:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80061d:	0f b6 c0             	movzbl %al,%eax
+  800620:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800625:	0f b6 03             	movzbl (%rbx),%eax
+  800628:	3c 39                	cmp    $0x39,%al
+  80062a:	76 e9                	jbe    800615 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80062c:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80062f:	eb b1                	jmp    8005e2 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800631:	49 89 dc             	mov    %rbx,%r12
+  800634:	eb ac                	jmp    8005e2 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800636:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800639:	85 c9                	test   %ecx,%ecx
+  80063b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800640:	0f 49 c1             	cmovns %ecx,%eax
+  800643:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800646:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800649:	e9 33 ff ff ff       	jmp    800581 <vprintfmt+0x75>
+            lflag++;
+  80064e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800651:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800654:	e9 28 ff ff ff       	jmp    800581 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800659:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80065c:	83 f8 2f             	cmp    $0x2f,%eax
+  80065f:	77 19                	ja     80067a <vprintfmt+0x16e>
+  800661:	89 c2                	mov    %eax,%edx
+  800663:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800667:	83 c0 08             	add    $0x8,%eax
+  80066a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80066d:	8b 3a                	mov    (%rdx),%edi
+  80066f:	4c 89 ee             	mov    %r13,%rsi
+  800672:	41 ff d6             	call   *%r14
+            break;
+  800675:	e9 c3 fe ff ff       	jmp    80053d <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80067a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80067e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800682:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800686:	eb e5                	jmp    80066d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800688:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068b:	83 f8 2f             	cmp    $0x2f,%eax
+  80068e:	77 5a                	ja     8006ea <vprintfmt+0x1de>
+  800690:	89 c2                	mov    %eax,%edx
+  800692:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800696:	83 c0 08             	add    $0x8,%eax
+  800699:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80069c:	8b 02                	mov    (%rdx),%eax
+  80069e:	89 c1                	mov    %eax,%ecx
+  8006a0:	f7 d9                	neg    %ecx
+  8006a2:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006a5:	83 f9 15             	cmp    $0x15,%ecx
+  8006a8:	7f 4e                	jg     8006f8 <vprintfmt+0x1ec>
+  8006aa:	48 63 c1             	movslq %ecx,%rax
+  8006ad:	48 ba 80 31 80 00 00 	movabs $0x803180,%rdx
+  8006b4:	00 00 00 
+  8006b7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006bb:	48 85 c0             	test   %rax,%rax
+  8006be:	74 38                	je     8006f8 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006c0:	48 89 c1             	mov    %rax,%rcx
+  8006c3:	48 ba 39 33 80 00 00 	movabs $0x803339,%rdx
+  8006ca:	00 00 00 
+  8006cd:	4c 89 ee             	mov    %r13,%rsi
+  8006d0:	4c 89 f7             	mov    %r14,%rdi
+  8006d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d8:	49 b8 cf 04 80 00 00 	movabs $0x8004cf,%r8
+  8006df:	00 00 00 
+  8006e2:	41 ff d0             	call   *%r8
+  8006e5:	e9 53 fe ff ff       	jmp    80053d <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f6:	eb a4                	jmp    80069c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006f8:	48 ba 3c 2d 80 00 00 	movabs $0x802d3c,%rdx
+  8006ff:	00 00 00 
+  800702:	4c 89 ee             	mov    %r13,%rsi
+  800705:	4c 89 f7             	mov    %r14,%rdi
+  800708:	b8 00 00 00 00       	mov    $0x0,%eax
+  80070d:	49 b8 cf 04 80 00 00 	movabs $0x8004cf,%r8
+  800714:	00 00 00 
+  800717:	41 ff d0             	call   *%r8
+  80071a:	e9 1e fe ff ff       	jmp    80053d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80071f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800722:	83 f8 2f             	cmp    $0x2f,%eax
+  800725:	77 6c                	ja     800793 <vprintfmt+0x287>
+  800727:	89 c2                	mov    %eax,%edx
+  800729:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072d:	83 c0 08             	add    $0x8,%eax
+  800730:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800733:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800736:	48 85 d2             	test   %rdx,%rdx
+  800739:	48 b8 35 2d 80 00 00 	movabs $0x802d35,%rax
+  800740:	00 00 00 
+  800743:	48 0f 45 c2          	cmovne %rdx,%rax
+  800747:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80074b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80074f:	7e 06                	jle    800757 <vprintfmt+0x24b>
+  800751:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800755:	75 4a                	jne    8007a1 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800757:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80075b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80075f:	0f b6 00             	movzbl (%rax),%eax
+  800762:	84 c0                	test   %al,%al
+  800764:	0f 85 9a 00 00 00    	jne    800804 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80076a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80076d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800771:	85 c0                	test   %eax,%eax
+  800773:	0f 8e c4 fd ff ff    	jle    80053d <vprintfmt+0x31>
+  800779:	4c 89 ee             	mov    %r13,%rsi
+  80077c:	bf 20 00 00 00       	mov    $0x20,%edi
+  800781:	41 ff d6             	call   *%r14
+  800784:	41 83 ec 01          	sub    $0x1,%r12d
+  800788:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80078c:	75 eb                	jne    800779 <vprintfmt+0x26d>
+  80078e:	e9 aa fd ff ff       	jmp    80053d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800793:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800797:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80079b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80079f:	eb 92                	jmp    800733 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007a1:	49 63 f7             	movslq %r15d,%rsi
+  8007a4:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007a8:	48 b8 be 0c 80 00 00 	movabs $0x800cbe,%rax
+  8007af:	00 00 00 
+  8007b2:	ff d0                	call   *%rax
+  8007b4:	48 89 c2             	mov    %rax,%rdx
+  8007b7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007ba:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007bc:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007bf:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007c2:	85 c0                	test   %eax,%eax
+  8007c4:	7e 91                	jle    800757 <vprintfmt+0x24b>
+  8007c6:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007cb:	4c 89 ee             	mov    %r13,%rsi
+  8007ce:	44 89 e7             	mov    %r12d,%edi
+  8007d1:	41 ff d6             	call   *%r14
+  8007d4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007d8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007db:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007de:	75 eb                	jne    8007cb <vprintfmt+0x2bf>
+  8007e0:	e9 72 ff ff ff       	jmp    800757 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007e5:	0f b6 f8             	movzbl %al,%edi
+  8007e8:	4c 89 ee             	mov    %r13,%rsi
+  8007eb:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007ee:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007f2:	49 83 c4 01          	add    $0x1,%r12
+  8007f6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007fc:	84 c0                	test   %al,%al
+  8007fe:	0f 84 66 ff ff ff    	je     80076a <vprintfmt+0x25e>
+  800804:	45 85 ff             	test   %r15d,%r15d
+  800807:	78 0a                	js     800813 <vprintfmt+0x307>
+  800809:	41 83 ef 01          	sub    $0x1,%r15d
+  80080d:	0f 88 57 ff ff ff    	js     80076a <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800813:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800817:	74 cc                	je     8007e5 <vprintfmt+0x2d9>
+  800819:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80081c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800821:	80 fa 5e             	cmp    $0x5e,%dl
+  800824:	77 c2                	ja     8007e8 <vprintfmt+0x2dc>
+  800826:	eb bd                	jmp    8007e5 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800828:	40 84 f6             	test   %sil,%sil
+  80082b:	75 26                	jne    800853 <vprintfmt+0x347>
+    switch (lflag) {
+  80082d:	85 d2                	test   %edx,%edx
+  80082f:	74 59                	je     80088a <vprintfmt+0x37e>
+  800831:	83 fa 01             	cmp    $0x1,%edx
+  800834:	74 7b                	je     8008b1 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800836:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800839:	83 f8 2f             	cmp    $0x2f,%eax
+  80083c:	0f 87 96 00 00 00    	ja     8008d8 <vprintfmt+0x3cc>
+  800842:	89 c2                	mov    %eax,%edx
+  800844:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800848:	83 c0 08             	add    $0x8,%eax
+  80084b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084e:	4c 8b 22             	mov    (%rdx),%r12
+  800851:	eb 17                	jmp    80086a <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800853:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800856:	83 f8 2f             	cmp    $0x2f,%eax
+  800859:	77 21                	ja     80087c <vprintfmt+0x370>
+  80085b:	89 c2                	mov    %eax,%edx
+  80085d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800861:	83 c0 08             	add    $0x8,%eax
+  800864:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800867:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80086a:	4d 85 e4             	test   %r12,%r12
+  80086d:	78 7a                	js     8008e9 <vprintfmt+0x3dd>
+            num = i;
+  80086f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800872:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800877:	e9 50 02 00 00       	jmp    800acc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80087c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800880:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800884:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800888:	eb dd                	jmp    800867 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80088a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088d:	83 f8 2f             	cmp    $0x2f,%eax
+  800890:	77 11                	ja     8008a3 <vprintfmt+0x397>
+  800892:	89 c2                	mov    %eax,%edx
+  800894:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800898:	83 c0 08             	add    $0x8,%eax
+  80089b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089e:	4c 63 22             	movslq (%rdx),%r12
+  8008a1:	eb c7                	jmp    80086a <vprintfmt+0x35e>
+  8008a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008af:	eb ed                	jmp    80089e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b7:	77 11                	ja     8008ca <vprintfmt+0x3be>
+  8008b9:	89 c2                	mov    %eax,%edx
+  8008bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bf:	83 c0 08             	add    $0x8,%eax
+  8008c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c5:	4c 8b 22             	mov    (%rdx),%r12
+  8008c8:	eb a0                	jmp    80086a <vprintfmt+0x35e>
+  8008ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d6:	eb ed                	jmp    8008c5 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8008d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e4:	e9 65 ff ff ff       	jmp    80084e <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008e9:	4c 89 ee             	mov    %r13,%rsi
+  8008ec:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008f1:	41 ff d6             	call   *%r14
+                i = -i;
+  8008f4:	49 f7 dc             	neg    %r12
+  8008f7:	e9 73 ff ff ff       	jmp    80086f <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008fc:	40 84 f6             	test   %sil,%sil
+  8008ff:	75 32                	jne    800933 <vprintfmt+0x427>
+    switch (lflag) {
+  800901:	85 d2                	test   %edx,%edx
+  800903:	74 5d                	je     800962 <vprintfmt+0x456>
+  800905:	83 fa 01             	cmp    $0x1,%edx
+  800908:	0f 84 82 00 00 00    	je     800990 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80090e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800911:	83 f8 2f             	cmp    $0x2f,%eax
+  800914:	0f 87 a5 00 00 00    	ja     8009bf <vprintfmt+0x4b3>
+  80091a:	89 c2                	mov    %eax,%edx
+  80091c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800920:	83 c0 08             	add    $0x8,%eax
+  800923:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800926:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800929:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80092e:	e9 99 01 00 00       	jmp    800acc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800933:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800936:	83 f8 2f             	cmp    $0x2f,%eax
+  800939:	77 19                	ja     800954 <vprintfmt+0x448>
+  80093b:	89 c2                	mov    %eax,%edx
+  80093d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800941:	83 c0 08             	add    $0x8,%eax
+  800944:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800947:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80094a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80094f:	e9 78 01 00 00       	jmp    800acc <vprintfmt+0x5c0>
+  800954:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800958:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800960:	eb e5                	jmp    800947 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800962:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800965:	83 f8 2f             	cmp    $0x2f,%eax
+  800968:	77 18                	ja     800982 <vprintfmt+0x476>
+  80096a:	89 c2                	mov    %eax,%edx
+  80096c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800970:	83 c0 08             	add    $0x8,%eax
+  800973:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800976:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800978:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80097d:	e9 4a 01 00 00       	jmp    800acc <vprintfmt+0x5c0>
+  800982:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800986:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098e:	eb e6                	jmp    800976 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800990:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800993:	83 f8 2f             	cmp    $0x2f,%eax
+  800996:	77 19                	ja     8009b1 <vprintfmt+0x4a5>
+  800998:	89 c2                	mov    %eax,%edx
+  80099a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099e:	83 c0 08             	add    $0x8,%eax
+  8009a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009a7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009ac:	e9 1b 01 00 00       	jmp    800acc <vprintfmt+0x5c0>
+  8009b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bd:	eb e5                	jmp    8009a4 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8009bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cb:	e9 56 ff ff ff       	jmp    800926 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d0:	40 84 f6             	test   %sil,%sil
+  8009d3:	75 2e                	jne    800a03 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8009d5:	85 d2                	test   %edx,%edx
+  8009d7:	74 59                	je     800a32 <vprintfmt+0x526>
+  8009d9:	83 fa 01             	cmp    $0x1,%edx
+  8009dc:	74 7f                	je     800a5d <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8009de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e4:	0f 87 9f 00 00 00    	ja     800a89 <vprintfmt+0x57d>
+  8009ea:	89 c2                	mov    %eax,%edx
+  8009ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f0:	83 c0 08             	add    $0x8,%eax
+  8009f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009f9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009fe:	e9 c9 00 00 00       	jmp    800acc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a03:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a06:	83 f8 2f             	cmp    $0x2f,%eax
+  800a09:	77 19                	ja     800a24 <vprintfmt+0x518>
+  800a0b:	89 c2                	mov    %eax,%edx
+  800a0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a11:	83 c0 08             	add    $0x8,%eax
+  800a14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a17:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a1a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a1f:	e9 a8 00 00 00       	jmp    800acc <vprintfmt+0x5c0>
+  800a24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a30:	eb e5                	jmp    800a17 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a35:	83 f8 2f             	cmp    $0x2f,%eax
+  800a38:	77 15                	ja     800a4f <vprintfmt+0x543>
+  800a3a:	89 c2                	mov    %eax,%edx
+  800a3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a40:	83 c0 08             	add    $0x8,%eax
+  800a43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a46:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a48:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a4d:	eb 7d                	jmp    800acc <vprintfmt+0x5c0>
+  800a4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5b:	eb e9                	jmp    800a46 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a60:	83 f8 2f             	cmp    $0x2f,%eax
+  800a63:	77 16                	ja     800a7b <vprintfmt+0x56f>
+  800a65:	89 c2                	mov    %eax,%edx
+  800a67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6b:	83 c0 08             	add    $0x8,%eax
+  800a6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a71:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a74:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a79:	eb 51                	jmp    800acc <vprintfmt+0x5c0>
+  800a7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a87:	eb e8                	jmp    800a71 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a95:	e9 5c ff ff ff       	jmp    8009f6 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a9a:	4c 89 ee             	mov    %r13,%rsi
+  800a9d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800aa2:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800aa5:	4c 89 ee             	mov    %r13,%rsi
+  800aa8:	bf 78 00 00 00       	mov    $0x78,%edi
+  800aad:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800ab0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab6:	77 47                	ja     800aff <vprintfmt+0x5f3>
+  800ab8:	89 c2                	mov    %eax,%edx
+  800aba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800abe:	83 c0 08             	add    $0x8,%eax
+  800ac1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ac7:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800acc:	48 83 ec 08          	sub    $0x8,%rsp
+  800ad0:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ad4:	0f 94 c0             	sete   %al
+  800ad7:	0f b6 c0             	movzbl %al,%eax
+  800ada:	50                   	push   %rax
+  800adb:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ae0:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ae4:	4c 89 ee             	mov    %r13,%rsi
+  800ae7:	4c 89 f7             	mov    %r14,%rdi
+  800aea:	48 b8 01 04 80 00 00 	movabs $0x800401,%rax
+  800af1:	00 00 00 
+  800af4:	ff d0                	call   *%rax
+            break;
+  800af6:	48 83 c4 10          	add    $0x10,%rsp
+  800afa:	e9 3e fa ff ff       	jmp    80053d <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800aff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b03:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b07:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0b:	eb b7                	jmp    800ac4 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b0d:	40 84 f6             	test   %sil,%sil
+  800b10:	75 2b                	jne    800b3d <vprintfmt+0x631>
+    switch (lflag) {
+  800b12:	85 d2                	test   %edx,%edx
+  800b14:	74 56                	je     800b6c <vprintfmt+0x660>
+  800b16:	83 fa 01             	cmp    $0x1,%edx
+  800b19:	74 7f                	je     800b9a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b21:	0f 87 a2 00 00 00    	ja     800bc9 <vprintfmt+0x6bd>
+  800b27:	89 c2                	mov    %eax,%edx
+  800b29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2d:	83 c0 08             	add    $0x8,%eax
+  800b30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b33:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b36:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b3b:	eb 8f                	jmp    800acc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b3d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b40:	83 f8 2f             	cmp    $0x2f,%eax
+  800b43:	77 19                	ja     800b5e <vprintfmt+0x652>
+  800b45:	89 c2                	mov    %eax,%edx
+  800b47:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b4b:	83 c0 08             	add    $0x8,%eax
+  800b4e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b51:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b54:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b59:	e9 6e ff ff ff       	jmp    800acc <vprintfmt+0x5c0>
+  800b5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6a:	eb e5                	jmp    800b51 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b6c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b6f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b72:	77 18                	ja     800b8c <vprintfmt+0x680>
+  800b74:	89 c2                	mov    %eax,%edx
+  800b76:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b7a:	83 c0 08             	add    $0x8,%eax
+  800b7d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b80:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b82:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b87:	e9 40 ff ff ff       	jmp    800acc <vprintfmt+0x5c0>
+  800b8c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b90:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b98:	eb e6                	jmp    800b80 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b9a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b9d:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba0:	77 19                	ja     800bbb <vprintfmt+0x6af>
+  800ba2:	89 c2                	mov    %eax,%edx
+  800ba4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba8:	83 c0 08             	add    $0x8,%eax
+  800bab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bae:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bb1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800bb6:	e9 11 ff ff ff       	jmp    800acc <vprintfmt+0x5c0>
+  800bbb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bbf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc7:	eb e5                	jmp    800bae <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800bc9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bcd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd5:	e9 59 ff ff ff       	jmp    800b33 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800bda:	4c 89 ee             	mov    %r13,%rsi
+  800bdd:	bf 25 00 00 00       	mov    $0x25,%edi
+  800be2:	41 ff d6             	call   *%r14
+            break;
+  800be5:	e9 53 f9 ff ff       	jmp    80053d <vprintfmt+0x31>
+            putch('%', put_arg);
+  800bea:	4c 89 ee             	mov    %r13,%rsi
+  800bed:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bf2:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bf5:	48 83 eb 01          	sub    $0x1,%rbx
+  800bf9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bfd:	75 f6                	jne    800bf5 <vprintfmt+0x6e9>
+  800bff:	e9 39 f9 ff ff       	jmp    80053d <vprintfmt+0x31>
+}
+  800c04:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c08:	5b                   	pop    %rbx
+  800c09:	41 5c                	pop    %r12
+  800c0b:	41 5d                	pop    %r13
+  800c0d:	41 5e                	pop    %r14
+  800c0f:	41 5f                	pop    %r15
+  800c11:	5d                   	pop    %rbp
+  800c12:	c3                   	ret
+
+0000000000800c13 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c13:	55                   	push   %rbp
+  800c14:	48 89 e5             	mov    %rsp,%rbp
+  800c17:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c1b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c1f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c24:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c28:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c2f:	48 85 ff             	test   %rdi,%rdi
+  800c32:	74 2b                	je     800c5f <vsnprintf+0x4c>
+  800c34:	48 85 f6             	test   %rsi,%rsi
+  800c37:	74 26                	je     800c5f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c39:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c3d:	48 bf b7 04 80 00 00 	movabs $0x8004b7,%rdi
+  800c44:	00 00 00 
+  800c47:	48 b8 0c 05 80 00 00 	movabs $0x80050c,%rax
+  800c4e:	00 00 00 
+  800c51:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c57:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c5a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c5d:	c9                   	leave
+  800c5e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c64:	eb f7                	jmp    800c5d <vsnprintf+0x4a>
+
+0000000000800c66 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c66:	55                   	push   %rbp
+  800c67:	48 89 e5             	mov    %rsp,%rbp
+  800c6a:	48 83 ec 50          	sub    $0x50,%rsp
+  800c6e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c72:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c76:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c7a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c81:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c89:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c8d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c91:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c95:	48 b8 13 0c 80 00 00 	movabs $0x800c13,%rax
+  800c9c:	00 00 00 
+  800c9f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ca1:	c9                   	leave
+  800ca2:	c3                   	ret
+
+0000000000800ca3 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ca3:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ca6:	74 10                	je     800cb8 <strlen+0x15>
+    size_t n = 0;
+  800ca8:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800cad:	48 83 c0 01          	add    $0x1,%rax
+  800cb1:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800cb5:	75 f6                	jne    800cad <strlen+0xa>
+  800cb7:	c3                   	ret
+    size_t n = 0;
+  800cb8:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800cbd:	c3                   	ret
+
+0000000000800cbe <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800cbe:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800cc1:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800cc6:	48 85 f6             	test   %rsi,%rsi
+  800cc9:	74 11                	je     800cdc <strnlen+0x1e>
+  800ccb:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ccf:	74 0c                	je     800cdd <strnlen+0x1f>
+  800cd1:	48 83 c2 01          	add    $0x1,%rdx
+  800cd5:	48 39 d0             	cmp    %rdx,%rax
+  800cd8:	75 f1                	jne    800ccb <strnlen+0xd>
+  800cda:	eb 04                	jmp    800ce0 <strnlen+0x22>
+  800cdc:	c3                   	ret
+  800cdd:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ce0:	c3                   	ret
+
+0000000000800ce1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ce1:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ce4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce9:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ced:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cf0:	48 83 c2 01          	add    $0x1,%rdx
+  800cf4:	84 c9                	test   %cl,%cl
+  800cf6:	75 f1                	jne    800ce9 <strcpy+0x8>
+        ;
+    return res;
+}
+  800cf8:	c3                   	ret
+
+0000000000800cf9 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800cf9:	55                   	push   %rbp
+  800cfa:	48 89 e5             	mov    %rsp,%rbp
+  800cfd:	41 54                	push   %r12
+  800cff:	53                   	push   %rbx
+  800d00:	48 89 fb             	mov    %rdi,%rbx
+  800d03:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d06:	48 b8 a3 0c 80 00 00 	movabs $0x800ca3,%rax
+  800d0d:	00 00 00 
+  800d10:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d12:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d16:	4c 89 e6             	mov    %r12,%rsi
+  800d19:	48 b8 e1 0c 80 00 00 	movabs $0x800ce1,%rax
+  800d20:	00 00 00 
+  800d23:	ff d0                	call   *%rax
+    return dst;
+}
+  800d25:	48 89 d8             	mov    %rbx,%rax
+  800d28:	5b                   	pop    %rbx
+  800d29:	41 5c                	pop    %r12
+  800d2b:	5d                   	pop    %rbp
+  800d2c:	c3                   	ret
+
+0000000000800d2d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d2d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d30:	48 85 d2             	test   %rdx,%rdx
+  800d33:	74 1f                	je     800d54 <strncpy+0x27>
+  800d35:	48 01 fa             	add    %rdi,%rdx
+  800d38:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d3b:	48 83 c1 01          	add    $0x1,%rcx
+  800d3f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d43:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d47:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d4b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d4f:	48 39 ca             	cmp    %rcx,%rdx
+  800d52:	75 e7                	jne    800d3b <strncpy+0xe>
+    }
+    return ret;
+}
+  800d54:	c3                   	ret
+
+0000000000800d55 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d55:	48 89 f8             	mov    %rdi,%rax
+  800d58:	48 85 d2             	test   %rdx,%rdx
+  800d5b:	74 24                	je     800d81 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d5d:	48 83 ea 01          	sub    $0x1,%rdx
+  800d61:	74 1b                	je     800d7e <strlcpy+0x29>
+  800d63:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d67:	0f b6 16             	movzbl (%rsi),%edx
+  800d6a:	84 d2                	test   %dl,%dl
+  800d6c:	74 10                	je     800d7e <strlcpy+0x29>
+            *dst++ = *src++;
+  800d6e:	48 83 c6 01          	add    $0x1,%rsi
+  800d72:	48 83 c0 01          	add    $0x1,%rax
+  800d76:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d79:	48 39 c8             	cmp    %rcx,%rax
+  800d7c:	75 e9                	jne    800d67 <strlcpy+0x12>
+        *dst = '\0';
+  800d7e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d81:	48 29 f8             	sub    %rdi,%rax
+}
+  800d84:	c3                   	ret
+
+0000000000800d85 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d85:	0f b6 07             	movzbl (%rdi),%eax
+  800d88:	84 c0                	test   %al,%al
+  800d8a:	74 13                	je     800d9f <strcmp+0x1a>
+  800d8c:	38 06                	cmp    %al,(%rsi)
+  800d8e:	75 0f                	jne    800d9f <strcmp+0x1a>
+  800d90:	48 83 c7 01          	add    $0x1,%rdi
+  800d94:	48 83 c6 01          	add    $0x1,%rsi
+  800d98:	0f b6 07             	movzbl (%rdi),%eax
+  800d9b:	84 c0                	test   %al,%al
+  800d9d:	75 ed                	jne    800d8c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d9f:	0f b6 c0             	movzbl %al,%eax
+  800da2:	0f b6 16             	movzbl (%rsi),%edx
+  800da5:	29 d0                	sub    %edx,%eax
+}
+  800da7:	c3                   	ret
+
+0000000000800da8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800da8:	48 85 d2             	test   %rdx,%rdx
+  800dab:	74 1f                	je     800dcc <strncmp+0x24>
+  800dad:	0f b6 07             	movzbl (%rdi),%eax
+  800db0:	84 c0                	test   %al,%al
+  800db2:	74 1e                	je     800dd2 <strncmp+0x2a>
+  800db4:	3a 06                	cmp    (%rsi),%al
+  800db6:	75 1a                	jne    800dd2 <strncmp+0x2a>
+  800db8:	48 83 c7 01          	add    $0x1,%rdi
+  800dbc:	48 83 c6 01          	add    $0x1,%rsi
+  800dc0:	48 83 ea 01          	sub    $0x1,%rdx
+  800dc4:	75 e7                	jne    800dad <strncmp+0x5>
+
+    if (!n) return 0;
+  800dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dcb:	c3                   	ret
+  800dcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd1:	c3                   	ret
+  800dd2:	48 85 d2             	test   %rdx,%rdx
+  800dd5:	74 09                	je     800de0 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dd7:	0f b6 07             	movzbl (%rdi),%eax
+  800dda:	0f b6 16             	movzbl (%rsi),%edx
+  800ddd:	29 d0                	sub    %edx,%eax
+  800ddf:	c3                   	ret
+    if (!n) return 0;
+  800de0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800de5:	c3                   	ret
+
+0000000000800de6 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800de6:	0f b6 17             	movzbl (%rdi),%edx
+  800de9:	84 d2                	test   %dl,%dl
+  800deb:	74 18                	je     800e05 <strchr+0x1f>
+        if (*str == c) {
+  800ded:	0f be d2             	movsbl %dl,%edx
+  800df0:	39 f2                	cmp    %esi,%edx
+  800df2:	74 17                	je     800e0b <strchr+0x25>
+    for (; *str; str++) {
+  800df4:	48 83 c7 01          	add    $0x1,%rdi
+  800df8:	0f b6 17             	movzbl (%rdi),%edx
+  800dfb:	84 d2                	test   %dl,%dl
+  800dfd:	75 ee                	jne    800ded <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800dff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e04:	c3                   	ret
+  800e05:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0a:	c3                   	ret
+  800e0b:	48 89 f8             	mov    %rdi,%rax
+}
+  800e0e:	c3                   	ret
+
+0000000000800e0f <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e0f:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e12:	0f b6 17             	movzbl (%rdi),%edx
+  800e15:	84 d2                	test   %dl,%dl
+  800e17:	74 13                	je     800e2c <strfind+0x1d>
+  800e19:	0f be d2             	movsbl %dl,%edx
+  800e1c:	39 f2                	cmp    %esi,%edx
+  800e1e:	74 0b                	je     800e2b <strfind+0x1c>
+  800e20:	48 83 c0 01          	add    $0x1,%rax
+  800e24:	0f b6 10             	movzbl (%rax),%edx
+  800e27:	84 d2                	test   %dl,%dl
+  800e29:	75 ee                	jne    800e19 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e2b:	c3                   	ret
+  800e2c:	c3                   	ret
+
+0000000000800e2d <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e2d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e30:	48 89 f8             	mov    %rdi,%rax
+  800e33:	48 f7 d8             	neg    %rax
+  800e36:	83 e0 07             	and    $0x7,%eax
+  800e39:	49 89 d1             	mov    %rdx,%r9
+  800e3c:	49 29 c1             	sub    %rax,%r9
+  800e3f:	78 36                	js     800e77 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e41:	40 0f b6 c6          	movzbl %sil,%eax
+  800e45:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e4c:	01 01 01 
+  800e4f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e53:	40 f6 c7 07          	test   $0x7,%dil
+  800e57:	75 38                	jne    800e91 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e59:	4c 89 c9             	mov    %r9,%rcx
+  800e5c:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e60:	74 0c                	je     800e6e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e62:	fc                   	cld
+  800e63:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e66:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e6a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e6e:	4d 85 c9             	test   %r9,%r9
+  800e71:	75 45                	jne    800eb8 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e73:	4c 89 c0             	mov    %r8,%rax
+  800e76:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e77:	48 85 d2             	test   %rdx,%rdx
+  800e7a:	74 f7                	je     800e73 <memset+0x46>
+  800e7c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e7f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e82:	48 83 c0 01          	add    $0x1,%rax
+  800e86:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e8a:	48 39 c2             	cmp    %rax,%rdx
+  800e8d:	75 f3                	jne    800e82 <memset+0x55>
+  800e8f:	eb e2                	jmp    800e73 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e91:	40 f6 c7 01          	test   $0x1,%dil
+  800e95:	74 06                	je     800e9d <memset+0x70>
+  800e97:	88 07                	mov    %al,(%rdi)
+  800e99:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e9d:	40 f6 c7 02          	test   $0x2,%dil
+  800ea1:	74 07                	je     800eaa <memset+0x7d>
+  800ea3:	66 89 07             	mov    %ax,(%rdi)
+  800ea6:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800eaa:	40 f6 c7 04          	test   $0x4,%dil
+  800eae:	74 a9                	je     800e59 <memset+0x2c>
+  800eb0:	89 07                	mov    %eax,(%rdi)
+  800eb2:	48 83 c7 04          	add    $0x4,%rdi
+  800eb6:	eb a1                	jmp    800e59 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800eb8:	41 f6 c1 04          	test   $0x4,%r9b
+  800ebc:	74 06                	je     800ec4 <memset+0x97>
+  800ebe:	89 07                	mov    %eax,(%rdi)
+  800ec0:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ec4:	41 f6 c1 02          	test   $0x2,%r9b
+  800ec8:	74 07                	je     800ed1 <memset+0xa4>
+  800eca:	66 89 07             	mov    %ax,(%rdi)
+  800ecd:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ed1:	41 f6 c1 01          	test   $0x1,%r9b
+  800ed5:	74 9c                	je     800e73 <memset+0x46>
+  800ed7:	88 07                	mov    %al,(%rdi)
+  800ed9:	eb 98                	jmp    800e73 <memset+0x46>
+
+0000000000800edb <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800edb:	48 89 f8             	mov    %rdi,%rax
+  800ede:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ee1:	48 39 fe             	cmp    %rdi,%rsi
+  800ee4:	73 3b                	jae    800f21 <memmove+0x46>
+  800ee6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800eea:	48 39 d7             	cmp    %rdx,%rdi
+  800eed:	73 32                	jae    800f21 <memmove+0x46>
+        s += n;
+        d += n;
+  800eef:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ef3:	48 89 d6             	mov    %rdx,%rsi
+  800ef6:	48 09 fe             	or     %rdi,%rsi
+  800ef9:	48 09 ce             	or     %rcx,%rsi
+  800efc:	40 f6 c6 07          	test   $0x7,%sil
+  800f00:	75 12                	jne    800f14 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f02:	48 83 ef 08          	sub    $0x8,%rdi
+  800f06:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f0a:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f0e:	fd                   	std
+  800f0f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f12:	fc                   	cld
+  800f13:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f14:	48 83 ef 01          	sub    $0x1,%rdi
+  800f18:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f1c:	fd                   	std
+  800f1d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f1f:	eb f1                	jmp    800f12 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f21:	48 89 f2             	mov    %rsi,%rdx
+  800f24:	48 09 c2             	or     %rax,%rdx
+  800f27:	48 09 ca             	or     %rcx,%rdx
+  800f2a:	f6 c2 07             	test   $0x7,%dl
+  800f2d:	75 0c                	jne    800f3b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f2f:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f33:	48 89 c7             	mov    %rax,%rdi
+  800f36:	fc                   	cld
+  800f37:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f3a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f3b:	48 89 c7             	mov    %rax,%rdi
+  800f3e:	fc                   	cld
+  800f3f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f41:	c3                   	ret
+
+0000000000800f42 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f42:	55                   	push   %rbp
+  800f43:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f46:	48 b8 db 0e 80 00 00 	movabs $0x800edb,%rax
+  800f4d:	00 00 00 
+  800f50:	ff d0                	call   *%rax
+}
+  800f52:	5d                   	pop    %rbp
+  800f53:	c3                   	ret
+
+0000000000800f54 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f54:	55                   	push   %rbp
+  800f55:	48 89 e5             	mov    %rsp,%rbp
+  800f58:	41 57                	push   %r15
+  800f5a:	41 56                	push   %r14
+  800f5c:	41 55                	push   %r13
+  800f5e:	41 54                	push   %r12
+  800f60:	53                   	push   %rbx
+  800f61:	48 83 ec 08          	sub    $0x8,%rsp
+  800f65:	49 89 fe             	mov    %rdi,%r14
+  800f68:	49 89 f7             	mov    %rsi,%r15
+  800f6b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f6e:	48 89 f7             	mov    %rsi,%rdi
+  800f71:	48 b8 a3 0c 80 00 00 	movabs $0x800ca3,%rax
+  800f78:	00 00 00 
+  800f7b:	ff d0                	call   *%rax
+  800f7d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f80:	48 89 de             	mov    %rbx,%rsi
+  800f83:	4c 89 f7             	mov    %r14,%rdi
+  800f86:	48 b8 be 0c 80 00 00 	movabs $0x800cbe,%rax
+  800f8d:	00 00 00 
+  800f90:	ff d0                	call   *%rax
+  800f92:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f95:	48 39 c3             	cmp    %rax,%rbx
+  800f98:	74 36                	je     800fd0 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f9a:	48 89 d8             	mov    %rbx,%rax
+  800f9d:	4c 29 e8             	sub    %r13,%rax
+  800fa0:	49 39 c4             	cmp    %rax,%r12
+  800fa3:	73 31                	jae    800fd6 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800fa5:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800faa:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fae:	4c 89 fe             	mov    %r15,%rsi
+  800fb1:	48 b8 42 0f 80 00 00 	movabs $0x800f42,%rax
+  800fb8:	00 00 00 
+  800fbb:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fbd:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fc1:	48 83 c4 08          	add    $0x8,%rsp
+  800fc5:	5b                   	pop    %rbx
+  800fc6:	41 5c                	pop    %r12
+  800fc8:	41 5d                	pop    %r13
+  800fca:	41 5e                	pop    %r14
+  800fcc:	41 5f                	pop    %r15
+  800fce:	5d                   	pop    %rbp
+  800fcf:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fd0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fd4:	eb eb                	jmp    800fc1 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fd6:	48 83 eb 01          	sub    $0x1,%rbx
+  800fda:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fde:	48 89 da             	mov    %rbx,%rdx
+  800fe1:	4c 89 fe             	mov    %r15,%rsi
+  800fe4:	48 b8 42 0f 80 00 00 	movabs $0x800f42,%rax
+  800feb:	00 00 00 
+  800fee:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ff0:	49 01 de             	add    %rbx,%r14
+  800ff3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ff8:	eb c3                	jmp    800fbd <strlcat+0x69>
+
+0000000000800ffa <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ffa:	48 85 d2             	test   %rdx,%rdx
+  800ffd:	74 2d                	je     80102c <memcmp+0x32>
+  800fff:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801004:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801008:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80100d:	44 38 c1             	cmp    %r8b,%cl
+  801010:	75 0f                	jne    801021 <memcmp+0x27>
+    while (n-- > 0) {
+  801012:	48 83 c0 01          	add    $0x1,%rax
+  801016:	48 39 c2             	cmp    %rax,%rdx
+  801019:	75 e9                	jne    801004 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80101b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801020:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801021:	0f b6 c1             	movzbl %cl,%eax
+  801024:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801028:	44 29 c0             	sub    %r8d,%eax
+  80102b:	c3                   	ret
+    return 0;
+  80102c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801031:	c3                   	ret
+
+0000000000801032 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801032:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801036:	48 39 c7             	cmp    %rax,%rdi
+  801039:	73 0f                	jae    80104a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80103b:	40 38 37             	cmp    %sil,(%rdi)
+  80103e:	74 0e                	je     80104e <memfind+0x1c>
+    for (; src < end; src++) {
+  801040:	48 83 c7 01          	add    $0x1,%rdi
+  801044:	48 39 f8             	cmp    %rdi,%rax
+  801047:	75 f2                	jne    80103b <memfind+0x9>
+  801049:	c3                   	ret
+  80104a:	48 89 f8             	mov    %rdi,%rax
+  80104d:	c3                   	ret
+  80104e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801051:	c3                   	ret
+
+0000000000801052 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801052:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801055:	0f b6 37             	movzbl (%rdi),%esi
+  801058:	40 80 fe 20          	cmp    $0x20,%sil
+  80105c:	74 06                	je     801064 <strtol+0x12>
+  80105e:	40 80 fe 09          	cmp    $0x9,%sil
+  801062:	75 13                	jne    801077 <strtol+0x25>
+  801064:	48 83 c7 01          	add    $0x1,%rdi
+  801068:	0f b6 37             	movzbl (%rdi),%esi
+  80106b:	40 80 fe 20          	cmp    $0x20,%sil
+  80106f:	74 f3                	je     801064 <strtol+0x12>
+  801071:	40 80 fe 09          	cmp    $0x9,%sil
+  801075:	74 ed                	je     801064 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801077:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80107a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80107d:	3c 01                	cmp    $0x1,%al
+  80107f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801083:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801089:	75 0f                	jne    80109a <strtol+0x48>
+  80108b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80108e:	74 14                	je     8010a4 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801090:	85 d2                	test   %edx,%edx
+  801092:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801097:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80109a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80109f:	4c 63 ca             	movslq %edx,%r9
+  8010a2:	eb 36                	jmp    8010da <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010a4:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010a8:	74 0f                	je     8010b9 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010aa:	85 d2                	test   %edx,%edx
+  8010ac:	75 ec                	jne    80109a <strtol+0x48>
+        s++;
+  8010ae:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010b2:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010b7:	eb e1                	jmp    80109a <strtol+0x48>
+        s += 2;
+  8010b9:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010bd:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010c2:	eb d6                	jmp    80109a <strtol+0x48>
+            dig -= '0';
+  8010c4:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010c7:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010cb:	41 39 d0             	cmp    %edx,%r8d
+  8010ce:	7d 21                	jge    8010f1 <strtol+0x9f>
+        val = val * base + dig;
+  8010d0:	49 0f af c1          	imul   %r9,%rax
+  8010d4:	0f b6 c9             	movzbl %cl,%ecx
+  8010d7:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010da:	48 83 c7 01          	add    $0x1,%rdi
+  8010de:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010e2:	80 f9 39             	cmp    $0x39,%cl
+  8010e5:	76 dd                	jbe    8010c4 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010e7:	80 f9 7b             	cmp    $0x7b,%cl
+  8010ea:	77 05                	ja     8010f1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010ec:	83 e9 57             	sub    $0x57,%ecx
+  8010ef:	eb d6                	jmp    8010c7 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010f1:	4d 85 d2             	test   %r10,%r10
+  8010f4:	74 03                	je     8010f9 <strtol+0xa7>
+  8010f6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010f9:	48 89 c2             	mov    %rax,%rdx
+  8010fc:	48 f7 da             	neg    %rdx
+  8010ff:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801103:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801107:	c3                   	ret
+
+0000000000801108 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801108:	55                   	push   %rbp
+  801109:	48 89 e5             	mov    %rsp,%rbp
+  80110c:	53                   	push   %rbx
+  80110d:	48 89 fa             	mov    %rdi,%rdx
+  801110:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801113:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801118:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801122:	be 00 00 00 00       	mov    $0x0,%esi
+  801127:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80112d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80112f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801133:	c9                   	leave
+  801134:	c3                   	ret
+
+0000000000801135 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801135:	55                   	push   %rbp
+  801136:	48 89 e5             	mov    %rsp,%rbp
+  801139:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80113a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80113f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801144:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801149:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801153:	be 00 00 00 00       	mov    $0x0,%esi
+  801158:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80115e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801160:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801164:	c9                   	leave
+  801165:	c3                   	ret
+
+0000000000801166 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801166:	55                   	push   %rbp
+  801167:	48 89 e5             	mov    %rsp,%rbp
+  80116a:	53                   	push   %rbx
+  80116b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80116f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801172:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801177:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80117c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801181:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801186:	be 00 00 00 00       	mov    $0x0,%esi
+  80118b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801191:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801193:	48 85 c0             	test   %rax,%rax
+  801196:	7f 06                	jg     80119e <sys_env_destroy+0x38>
+}
+  801198:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80119c:	c9                   	leave
+  80119d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80119e:	49 89 c0             	mov    %rax,%r8
+  8011a1:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011a6:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  8011ad:	00 00 00 
+  8011b0:	be 26 00 00 00       	mov    $0x26,%esi
+  8011b5:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  8011bc:	00 00 00 
+  8011bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c4:	49 b9 6c 02 80 00 00 	movabs $0x80026c,%r9
+  8011cb:	00 00 00 
+  8011ce:	41 ff d1             	call   *%r9
+
+00000000008011d1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011d1:	55                   	push   %rbp
+  8011d2:	48 89 e5             	mov    %rsp,%rbp
+  8011d5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011d6:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011fa:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801200:	c9                   	leave
+  801201:	c3                   	ret
+
+0000000000801202 <sys_yield>:
+
+void
+sys_yield(void) {
+  801202:	55                   	push   %rbp
+  801203:	48 89 e5             	mov    %rsp,%rbp
+  801206:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801207:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80120c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801211:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801216:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801220:	be 00 00 00 00       	mov    $0x0,%esi
+  801225:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80122b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80122d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801231:	c9                   	leave
+  801232:	c3                   	ret
+
+0000000000801233 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801233:	55                   	push   %rbp
+  801234:	48 89 e5             	mov    %rsp,%rbp
+  801237:	53                   	push   %rbx
+  801238:	48 89 fa             	mov    %rdi,%rdx
+  80123b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80123e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801243:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80124a:	00 00 00 
+  80124d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801252:	be 00 00 00 00       	mov    $0x0,%esi
+  801257:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80125d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80125f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801263:	c9                   	leave
+  801264:	c3                   	ret
+
+0000000000801265 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801265:	55                   	push   %rbp
+  801266:	48 89 e5             	mov    %rsp,%rbp
+  801269:	53                   	push   %rbx
+  80126a:	49 89 f8             	mov    %rdi,%r8
+  80126d:	48 89 d3             	mov    %rdx,%rbx
+  801270:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801273:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801278:	4c 89 c2             	mov    %r8,%rdx
+  80127b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80127e:	be 00 00 00 00       	mov    $0x0,%esi
+  801283:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801289:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80128b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80128f:	c9                   	leave
+  801290:	c3                   	ret
+
+0000000000801291 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801291:	55                   	push   %rbp
+  801292:	48 89 e5             	mov    %rsp,%rbp
+  801295:	53                   	push   %rbx
+  801296:	48 83 ec 08          	sub    $0x8,%rsp
+  80129a:	89 f8                	mov    %edi,%eax
+  80129c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80129f:	48 63 f9             	movslq %ecx,%rdi
+  8012a2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a5:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012aa:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012ba:	48 85 c0             	test   %rax,%rax
+  8012bd:	7f 06                	jg     8012c5 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012c3:	c9                   	leave
+  8012c4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012c5:	49 89 c0             	mov    %rax,%r8
+  8012c8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012cd:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  8012d4:	00 00 00 
+  8012d7:	be 26 00 00 00       	mov    $0x26,%esi
+  8012dc:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  8012e3:	00 00 00 
+  8012e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012eb:	49 b9 6c 02 80 00 00 	movabs $0x80026c,%r9
+  8012f2:	00 00 00 
+  8012f5:	41 ff d1             	call   *%r9
+
+00000000008012f8 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012f8:	55                   	push   %rbp
+  8012f9:	48 89 e5             	mov    %rsp,%rbp
+  8012fc:	53                   	push   %rbx
+  8012fd:	48 83 ec 08          	sub    $0x8,%rsp
+  801301:	89 f8                	mov    %edi,%eax
+  801303:	49 89 f2             	mov    %rsi,%r10
+  801306:	48 89 cf             	mov    %rcx,%rdi
+  801309:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80130c:	48 63 da             	movslq %edx,%rbx
+  80130f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801312:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801317:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80131a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80131d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80131f:	48 85 c0             	test   %rax,%rax
+  801322:	7f 06                	jg     80132a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801324:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801328:	c9                   	leave
+  801329:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80132a:	49 89 c0             	mov    %rax,%r8
+  80132d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801332:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  801339:	00 00 00 
+  80133c:	be 26 00 00 00       	mov    $0x26,%esi
+  801341:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  801348:	00 00 00 
+  80134b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801350:	49 b9 6c 02 80 00 00 	movabs $0x80026c,%r9
+  801357:	00 00 00 
+  80135a:	41 ff d1             	call   *%r9
+
+000000000080135d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80135d:	55                   	push   %rbp
+  80135e:	48 89 e5             	mov    %rsp,%rbp
+  801361:	53                   	push   %rbx
+  801362:	48 83 ec 08          	sub    $0x8,%rsp
+  801366:	48 89 f1             	mov    %rsi,%rcx
+  801369:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80136c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80136f:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801374:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801379:	be 00 00 00 00       	mov    $0x0,%esi
+  80137e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801384:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801386:	48 85 c0             	test   %rax,%rax
+  801389:	7f 06                	jg     801391 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80138b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80138f:	c9                   	leave
+  801390:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801391:	49 89 c0             	mov    %rax,%r8
+  801394:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801399:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  8013a0:	00 00 00 
+  8013a3:	be 26 00 00 00       	mov    $0x26,%esi
+  8013a8:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  8013af:	00 00 00 
+  8013b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b7:	49 b9 6c 02 80 00 00 	movabs $0x80026c,%r9
+  8013be:	00 00 00 
+  8013c1:	41 ff d1             	call   *%r9
+
+00000000008013c4 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8013c4:	55                   	push   %rbp
+  8013c5:	48 89 e5             	mov    %rsp,%rbp
+  8013c8:	53                   	push   %rbx
+  8013c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8013cd:	89 f8                	mov    %edi,%eax
+  8013cf:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8013d2:	48 63 f9             	movslq %ecx,%rdi
+  8013d5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d8:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013dd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013eb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013ed:	48 85 c0             	test   %rax,%rax
+  8013f0:	7f 06                	jg     8013f8 <sys_region_advise+0x34>
+}
+  8013f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f6:	c9                   	leave
+  8013f7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013f8:	49 89 c0             	mov    %rax,%r8
+  8013fb:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801400:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  801407:	00 00 00 
+  80140a:	be 26 00 00 00       	mov    $0x26,%esi
+  80140f:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  801416:	00 00 00 
+  801419:	b8 00 00 00 00       	mov    $0x0,%eax
+  80141e:	49 b9 6c 02 80 00 00 	movabs $0x80026c,%r9
+  801425:	00 00 00 
+  801428:	41 ff d1             	call   *%r9
+
+000000000080142b <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  80142b:	55                   	push   %rbp
+  80142c:	48 89 e5             	mov    %rsp,%rbp
+  80142f:	53                   	push   %rbx
+  801430:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801434:	48 63 ce             	movslq %esi,%rcx
+  801437:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80143a:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80143f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801444:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801449:	be 00 00 00 00       	mov    $0x0,%esi
+  80144e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801454:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801456:	48 85 c0             	test   %rax,%rax
+  801459:	7f 06                	jg     801461 <sys_env_set_nice+0x36>
+}
+  80145b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80145f:	c9                   	leave
+  801460:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801461:	49 89 c0             	mov    %rax,%r8
+  801464:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801469:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  801470:	00 00 00 
+  801473:	be 26 00 00 00       	mov    $0x26,%esi
+  801478:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  80147f:	00 00 00 
+  801482:	b8 00 00 00 00       	mov    $0x0,%eax
+  801487:	49 b9 6c 02 80 00 00 	movabs $0x80026c,%r9
+  80148e:	00 00 00 
+  801491:	41 ff d1             	call   *%r9
+
+0000000000801494 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801494:	55                   	push   %rbp
+  801495:	48 89 e5             	mov    %rsp,%rbp
+  801498:	53                   	push   %rbx
+  801499:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80149d:	48 63 ce             	movslq %esi,%rcx
+  8014a0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a3:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014bd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014bf:	48 85 c0             	test   %rax,%rax
+  8014c2:	7f 06                	jg     8014ca <sys_env_set_status+0x36>
+}
+  8014c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c8:	c9                   	leave
+  8014c9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ca:	49 89 c0             	mov    %rax,%r8
+  8014cd:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014d2:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  8014d9:	00 00 00 
+  8014dc:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e1:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  8014e8:	00 00 00 
+  8014eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f0:	49 b9 6c 02 80 00 00 	movabs $0x80026c,%r9
+  8014f7:	00 00 00 
+  8014fa:	41 ff d1             	call   *%r9
+
+00000000008014fd <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8014fd:	55                   	push   %rbp
+  8014fe:	48 89 e5             	mov    %rsp,%rbp
+  801501:	53                   	push   %rbx
+  801502:	48 83 ec 08          	sub    $0x8,%rsp
+  801506:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801509:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80150c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801511:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801516:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80151b:	be 00 00 00 00       	mov    $0x0,%esi
+  801520:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801526:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801528:	48 85 c0             	test   %rax,%rax
+  80152b:	7f 06                	jg     801533 <sys_env_set_trapframe+0x36>
+}
+  80152d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801531:	c9                   	leave
+  801532:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801533:	49 89 c0             	mov    %rax,%r8
+  801536:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80153b:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  801542:	00 00 00 
+  801545:	be 26 00 00 00       	mov    $0x26,%esi
+  80154a:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  801551:	00 00 00 
+  801554:	b8 00 00 00 00       	mov    $0x0,%eax
+  801559:	49 b9 6c 02 80 00 00 	movabs $0x80026c,%r9
+  801560:	00 00 00 
+  801563:	41 ff d1             	call   *%r9
+
+0000000000801566 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801566:	55                   	push   %rbp
+  801567:	48 89 e5             	mov    %rsp,%rbp
+  80156a:	53                   	push   %rbx
+  80156b:	48 83 ec 08          	sub    $0x8,%rsp
+  80156f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801572:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801575:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80157a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801584:	be 00 00 00 00       	mov    $0x0,%esi
+  801589:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80158f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801591:	48 85 c0             	test   %rax,%rax
+  801594:	7f 06                	jg     80159c <sys_env_set_pgfault_upcall+0x36>
+}
+  801596:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159a:	c9                   	leave
+  80159b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80159c:	49 89 c0             	mov    %rax,%r8
+  80159f:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015a4:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  8015ab:	00 00 00 
+  8015ae:	be 26 00 00 00       	mov    $0x26,%esi
+  8015b3:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  8015ba:	00 00 00 
+  8015bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c2:	49 b9 6c 02 80 00 00 	movabs $0x80026c,%r9
+  8015c9:	00 00 00 
+  8015cc:	41 ff d1             	call   *%r9
+
+00000000008015cf <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015cf:	55                   	push   %rbp
+  8015d0:	48 89 e5             	mov    %rsp,%rbp
+  8015d3:	53                   	push   %rbx
+  8015d4:	89 f8                	mov    %edi,%eax
+  8015d6:	49 89 f1             	mov    %rsi,%r9
+  8015d9:	48 89 d3             	mov    %rdx,%rbx
+  8015dc:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015df:	49 63 f0             	movslq %r8d,%rsi
+  8015e2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e5:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015ea:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f3:	cd 30                	int    $0x30
+}
+  8015f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f9:	c9                   	leave
+  8015fa:	c3                   	ret
+
+00000000008015fb <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8015fb:	55                   	push   %rbp
+  8015fc:	48 89 e5             	mov    %rsp,%rbp
+  8015ff:	53                   	push   %rbx
+  801600:	48 83 ec 08          	sub    $0x8,%rsp
+  801604:	48 89 fa             	mov    %rdi,%rdx
+  801607:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80160a:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80160f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801614:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801619:	be 00 00 00 00       	mov    $0x0,%esi
+  80161e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801624:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801626:	48 85 c0             	test   %rax,%rax
+  801629:	7f 06                	jg     801631 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80162b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80162f:	c9                   	leave
+  801630:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801631:	49 89 c0             	mov    %rax,%r8
+  801634:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801639:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  801640:	00 00 00 
+  801643:	be 26 00 00 00       	mov    $0x26,%esi
+  801648:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  80164f:	00 00 00 
+  801652:	b8 00 00 00 00       	mov    $0x0,%eax
+  801657:	49 b9 6c 02 80 00 00 	movabs $0x80026c,%r9
+  80165e:	00 00 00 
+  801661:	41 ff d1             	call   *%r9
+
+0000000000801664 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801664:	55                   	push   %rbp
+  801665:	48 89 e5             	mov    %rsp,%rbp
+  801668:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801669:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80166e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801673:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801678:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80167d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801682:	be 00 00 00 00       	mov    $0x0,%esi
+  801687:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80168d:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80168f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801693:	c9                   	leave
+  801694:	c3                   	ret
+
+0000000000801695 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  801695:	55                   	push   %rbp
+  801696:	48 89 e5             	mov    %rsp,%rbp
+  801699:	53                   	push   %rbx
+  80169a:	48 83 ec 08          	sub    $0x8,%rsp
+  80169e:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8016a1:	48 63 ce             	movslq %esi,%rcx
+  8016a4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016a7:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016bc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016be:	48 85 c0             	test   %rax,%rax
+  8016c1:	7f 06                	jg     8016c9 <sys_sigqueue+0x34>
+}
+  8016c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016c7:	c9                   	leave
+  8016c8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016c9:	49 89 c0             	mov    %rax,%r8
+  8016cc:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8016d1:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  8016d8:	00 00 00 
+  8016db:	be 26 00 00 00       	mov    $0x26,%esi
+  8016e0:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  8016e7:	00 00 00 
+  8016ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ef:	49 b9 6c 02 80 00 00 	movabs $0x80026c,%r9
+  8016f6:	00 00 00 
+  8016f9:	41 ff d1             	call   *%r9
+
+00000000008016fc <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8016fc:	55                   	push   %rbp
+  8016fd:	48 89 e5             	mov    %rsp,%rbp
+  801700:	53                   	push   %rbx
+  801701:	48 83 ec 08          	sub    $0x8,%rsp
+  801705:	48 89 fa             	mov    %rdi,%rdx
+  801708:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80170b:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801710:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801715:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80171a:	be 00 00 00 00       	mov    $0x0,%esi
+  80171f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801725:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801727:	48 85 c0             	test   %rax,%rax
+  80172a:	7f 06                	jg     801732 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  80172c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801730:	c9                   	leave
+  801731:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801732:	49 89 c0             	mov    %rax,%r8
+  801735:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80173a:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  801741:	00 00 00 
+  801744:	be 26 00 00 00       	mov    $0x26,%esi
+  801749:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  801750:	00 00 00 
+  801753:	b8 00 00 00 00       	mov    $0x0,%eax
+  801758:	49 b9 6c 02 80 00 00 	movabs $0x80026c,%r9
+  80175f:	00 00 00 
+  801762:	41 ff d1             	call   *%r9
+
+0000000000801765 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801765:	55                   	push   %rbp
+  801766:	48 89 e5             	mov    %rsp,%rbp
+  801769:	53                   	push   %rbx
+  80176a:	48 83 ec 08          	sub    $0x8,%rsp
+  80176e:	48 89 f1             	mov    %rsi,%rcx
+  801771:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801774:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801777:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80177c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801781:	be 00 00 00 00       	mov    $0x0,%esi
+  801786:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80178c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80178e:	48 85 c0             	test   %rax,%rax
+  801791:	7f 06                	jg     801799 <sys_sigaction+0x34>
+}
+  801793:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801797:	c9                   	leave
+  801798:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801799:	49 89 c0             	mov    %rax,%r8
+  80179c:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8017a1:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  8017a8:	00 00 00 
+  8017ab:	be 26 00 00 00       	mov    $0x26,%esi
+  8017b0:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  8017b7:	00 00 00 
+  8017ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017bf:	49 b9 6c 02 80 00 00 	movabs $0x80026c,%r9
+  8017c6:	00 00 00 
+  8017c9:	41 ff d1             	call   *%r9
+
+00000000008017cc <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8017cc:	55                   	push   %rbp
+  8017cd:	48 89 e5             	mov    %rsp,%rbp
+  8017d0:	53                   	push   %rbx
+  8017d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8017d5:	48 89 f1             	mov    %rsi,%rcx
+  8017d8:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8017db:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017de:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017f5:	48 85 c0             	test   %rax,%rax
+  8017f8:	7f 06                	jg     801800 <sys_sigprocmask+0x34>
+}
+  8017fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017fe:	c9                   	leave
+  8017ff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801800:	49 89 c0             	mov    %rax,%r8
+  801803:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801808:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  80180f:	00 00 00 
+  801812:	be 26 00 00 00       	mov    $0x26,%esi
+  801817:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  80181e:	00 00 00 
+  801821:	b8 00 00 00 00       	mov    $0x0,%eax
+  801826:	49 b9 6c 02 80 00 00 	movabs $0x80026c,%r9
+  80182d:	00 00 00 
+  801830:	41 ff d1             	call   *%r9
+
+0000000000801833 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801833:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80183a:	ff ff ff 
+  80183d:	48 01 f8             	add    %rdi,%rax
+  801840:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801844:	c3                   	ret
+
+0000000000801845 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801845:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80184c:	ff ff ff 
+  80184f:	48 01 f8             	add    %rdi,%rax
+  801852:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801856:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80185c:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801860:	c3                   	ret
+
+0000000000801861 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801861:	55                   	push   %rbp
+  801862:	48 89 e5             	mov    %rsp,%rbp
+  801865:	41 57                	push   %r15
+  801867:	41 56                	push   %r14
+  801869:	41 55                	push   %r13
+  80186b:	41 54                	push   %r12
+  80186d:	53                   	push   %rbx
+  80186e:	48 83 ec 08          	sub    $0x8,%rsp
+  801872:	49 89 ff             	mov    %rdi,%r15
+  801875:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80187a:	49 bd df 27 80 00 00 	movabs $0x8027df,%r13
+  801881:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801884:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80188a:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80188d:	48 89 df             	mov    %rbx,%rdi
+  801890:	41 ff d5             	call   *%r13
+  801893:	83 e0 04             	and    $0x4,%eax
+  801896:	74 17                	je     8018af <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801898:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80189f:	4c 39 f3             	cmp    %r14,%rbx
+  8018a2:	75 e6                	jne    80188a <fd_alloc+0x29>
+  8018a4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8018aa:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8018af:	4d 89 27             	mov    %r12,(%r15)
+}
+  8018b2:	48 83 c4 08          	add    $0x8,%rsp
+  8018b6:	5b                   	pop    %rbx
+  8018b7:	41 5c                	pop    %r12
+  8018b9:	41 5d                	pop    %r13
+  8018bb:	41 5e                	pop    %r14
+  8018bd:	41 5f                	pop    %r15
+  8018bf:	5d                   	pop    %rbp
+  8018c0:	c3                   	ret
+
+00000000008018c1 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8018c1:	83 ff 1f             	cmp    $0x1f,%edi
+  8018c4:	77 39                	ja     8018ff <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8018c6:	55                   	push   %rbp
+  8018c7:	48 89 e5             	mov    %rsp,%rbp
+  8018ca:	41 54                	push   %r12
+  8018cc:	53                   	push   %rbx
+  8018cd:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8018d0:	48 63 df             	movslq %edi,%rbx
+  8018d3:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8018da:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8018de:	48 89 df             	mov    %rbx,%rdi
+  8018e1:	48 b8 df 27 80 00 00 	movabs $0x8027df,%rax
+  8018e8:	00 00 00 
+  8018eb:	ff d0                	call   *%rax
+  8018ed:	a8 04                	test   $0x4,%al
+  8018ef:	74 14                	je     801905 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8018f1:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8018f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018fa:	5b                   	pop    %rbx
+  8018fb:	41 5c                	pop    %r12
+  8018fd:	5d                   	pop    %rbp
+  8018fe:	c3                   	ret
+        return -E_INVAL;
+  8018ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801904:	c3                   	ret
+        return -E_INVAL;
+  801905:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80190a:	eb ee                	jmp    8018fa <fd_lookup+0x39>
+
+000000000080190c <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80190c:	55                   	push   %rbp
+  80190d:	48 89 e5             	mov    %rsp,%rbp
+  801910:	41 54                	push   %r12
+  801912:	53                   	push   %rbx
+  801913:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801916:	48 b8 00 33 80 00 00 	movabs $0x803300,%rax
+  80191d:	00 00 00 
+  801920:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801927:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80192a:	39 3b                	cmp    %edi,(%rbx)
+  80192c:	74 47                	je     801975 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80192e:	48 83 c0 08          	add    $0x8,%rax
+  801932:	48 8b 18             	mov    (%rax),%rbx
+  801935:	48 85 db             	test   %rbx,%rbx
+  801938:	75 f0                	jne    80192a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80193a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801941:	00 00 00 
+  801944:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80194a:	89 fa                	mov    %edi,%edx
+  80194c:	48 bf 80 32 80 00 00 	movabs $0x803280,%rdi
+  801953:	00 00 00 
+  801956:	b8 00 00 00 00       	mov    $0x0,%eax
+  80195b:	48 b9 bc 03 80 00 00 	movabs $0x8003bc,%rcx
+  801962:	00 00 00 
+  801965:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801967:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80196c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801970:	5b                   	pop    %rbx
+  801971:	41 5c                	pop    %r12
+  801973:	5d                   	pop    %rbp
+  801974:	c3                   	ret
+            return 0;
+  801975:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197a:	eb f0                	jmp    80196c <dev_lookup+0x60>
+
+000000000080197c <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80197c:	55                   	push   %rbp
+  80197d:	48 89 e5             	mov    %rsp,%rbp
+  801980:	41 55                	push   %r13
+  801982:	41 54                	push   %r12
+  801984:	53                   	push   %rbx
+  801985:	48 83 ec 18          	sub    $0x18,%rsp
+  801989:	48 89 fb             	mov    %rdi,%rbx
+  80198c:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80198f:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801996:	ff ff ff 
+  801999:	48 01 df             	add    %rbx,%rdi
+  80199c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8019a0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019a4:	48 b8 c1 18 80 00 00 	movabs $0x8018c1,%rax
+  8019ab:	00 00 00 
+  8019ae:	ff d0                	call   *%rax
+  8019b0:	41 89 c5             	mov    %eax,%r13d
+  8019b3:	85 c0                	test   %eax,%eax
+  8019b5:	78 06                	js     8019bd <fd_close+0x41>
+  8019b7:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8019bb:	74 1a                	je     8019d7 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8019bd:	45 84 e4             	test   %r12b,%r12b
+  8019c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c5:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8019c9:	44 89 e8             	mov    %r13d,%eax
+  8019cc:	48 83 c4 18          	add    $0x18,%rsp
+  8019d0:	5b                   	pop    %rbx
+  8019d1:	41 5c                	pop    %r12
+  8019d3:	41 5d                	pop    %r13
+  8019d5:	5d                   	pop    %rbp
+  8019d6:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019d7:	8b 3b                	mov    (%rbx),%edi
+  8019d9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019dd:	48 b8 0c 19 80 00 00 	movabs $0x80190c,%rax
+  8019e4:	00 00 00 
+  8019e7:	ff d0                	call   *%rax
+  8019e9:	41 89 c5             	mov    %eax,%r13d
+  8019ec:	85 c0                	test   %eax,%eax
+  8019ee:	78 1b                	js     801a0b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8019f0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019f4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8019f8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019fe:	48 85 c0             	test   %rax,%rax
+  801a01:	74 08                	je     801a0b <fd_close+0x8f>
+  801a03:	48 89 df             	mov    %rbx,%rdi
+  801a06:	ff d0                	call   *%rax
+  801a08:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a0b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a10:	48 89 de             	mov    %rbx,%rsi
+  801a13:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a18:	48 b8 5d 13 80 00 00 	movabs $0x80135d,%rax
+  801a1f:	00 00 00 
+  801a22:	ff d0                	call   *%rax
+    return res;
+  801a24:	eb a3                	jmp    8019c9 <fd_close+0x4d>
+
+0000000000801a26 <close>:
+
+int
+close(int fdnum) {
+  801a26:	55                   	push   %rbp
+  801a27:	48 89 e5             	mov    %rsp,%rbp
+  801a2a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a2e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a32:	48 b8 c1 18 80 00 00 	movabs $0x8018c1,%rax
+  801a39:	00 00 00 
+  801a3c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a3e:	85 c0                	test   %eax,%eax
+  801a40:	78 15                	js     801a57 <close+0x31>
+
+    return fd_close(fd, 1);
+  801a42:	be 01 00 00 00       	mov    $0x1,%esi
+  801a47:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a4b:	48 b8 7c 19 80 00 00 	movabs $0x80197c,%rax
+  801a52:	00 00 00 
+  801a55:	ff d0                	call   *%rax
+}
+  801a57:	c9                   	leave
+  801a58:	c3                   	ret
+
+0000000000801a59 <close_all>:
+
+void
+close_all(void) {
+  801a59:	55                   	push   %rbp
+  801a5a:	48 89 e5             	mov    %rsp,%rbp
+  801a5d:	41 54                	push   %r12
+  801a5f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a65:	49 bc 26 1a 80 00 00 	movabs $0x801a26,%r12
+  801a6c:	00 00 00 
+  801a6f:	89 df                	mov    %ebx,%edi
+  801a71:	41 ff d4             	call   *%r12
+  801a74:	83 c3 01             	add    $0x1,%ebx
+  801a77:	83 fb 20             	cmp    $0x20,%ebx
+  801a7a:	75 f3                	jne    801a6f <close_all+0x16>
+}
+  801a7c:	5b                   	pop    %rbx
+  801a7d:	41 5c                	pop    %r12
+  801a7f:	5d                   	pop    %rbp
+  801a80:	c3                   	ret
+
+0000000000801a81 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a81:	55                   	push   %rbp
+  801a82:	48 89 e5             	mov    %rsp,%rbp
+  801a85:	41 57                	push   %r15
+  801a87:	41 56                	push   %r14
+  801a89:	41 55                	push   %r13
+  801a8b:	41 54                	push   %r12
+  801a8d:	53                   	push   %rbx
+  801a8e:	48 83 ec 18          	sub    $0x18,%rsp
+  801a92:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a95:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a99:	48 b8 c1 18 80 00 00 	movabs $0x8018c1,%rax
+  801aa0:	00 00 00 
+  801aa3:	ff d0                	call   *%rax
+  801aa5:	89 c3                	mov    %eax,%ebx
+  801aa7:	85 c0                	test   %eax,%eax
+  801aa9:	0f 88 b8 00 00 00    	js     801b67 <dup+0xe6>
+    close(newfdnum);
+  801aaf:	44 89 e7             	mov    %r12d,%edi
+  801ab2:	48 b8 26 1a 80 00 00 	movabs $0x801a26,%rax
+  801ab9:	00 00 00 
+  801abc:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801abe:	4d 63 ec             	movslq %r12d,%r13
+  801ac1:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801ac8:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801acc:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ad0:	4c 89 ff             	mov    %r15,%rdi
+  801ad3:	49 be 45 18 80 00 00 	movabs $0x801845,%r14
+  801ada:	00 00 00 
+  801add:	41 ff d6             	call   *%r14
+  801ae0:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801ae3:	4c 89 ef             	mov    %r13,%rdi
+  801ae6:	41 ff d6             	call   *%r14
+  801ae9:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801aec:	48 89 df             	mov    %rbx,%rdi
+  801aef:	48 b8 df 27 80 00 00 	movabs $0x8027df,%rax
+  801af6:	00 00 00 
+  801af9:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801afb:	a8 04                	test   $0x4,%al
+  801afd:	74 2b                	je     801b2a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801aff:	41 89 c1             	mov    %eax,%r9d
+  801b02:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b08:	4c 89 f1             	mov    %r14,%rcx
+  801b0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b10:	48 89 de             	mov    %rbx,%rsi
+  801b13:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b18:	48 b8 f8 12 80 00 00 	movabs $0x8012f8,%rax
+  801b1f:	00 00 00 
+  801b22:	ff d0                	call   *%rax
+  801b24:	89 c3                	mov    %eax,%ebx
+  801b26:	85 c0                	test   %eax,%eax
+  801b28:	78 4e                	js     801b78 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801b2a:	4c 89 ff             	mov    %r15,%rdi
+  801b2d:	48 b8 df 27 80 00 00 	movabs $0x8027df,%rax
+  801b34:	00 00 00 
+  801b37:	ff d0                	call   *%rax
+  801b39:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b3c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b42:	4c 89 e9             	mov    %r13,%rcx
+  801b45:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b4a:	4c 89 fe             	mov    %r15,%rsi
+  801b4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b52:	48 b8 f8 12 80 00 00 	movabs $0x8012f8,%rax
+  801b59:	00 00 00 
+  801b5c:	ff d0                	call   *%rax
+  801b5e:	89 c3                	mov    %eax,%ebx
+  801b60:	85 c0                	test   %eax,%eax
+  801b62:	78 14                	js     801b78 <dup+0xf7>
+
+    return newfdnum;
+  801b64:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801b67:	89 d8                	mov    %ebx,%eax
+  801b69:	48 83 c4 18          	add    $0x18,%rsp
+  801b6d:	5b                   	pop    %rbx
+  801b6e:	41 5c                	pop    %r12
+  801b70:	41 5d                	pop    %r13
+  801b72:	41 5e                	pop    %r14
+  801b74:	41 5f                	pop    %r15
+  801b76:	5d                   	pop    %rbp
+  801b77:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b78:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b7d:	4c 89 ee             	mov    %r13,%rsi
+  801b80:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b85:	49 bc 5d 13 80 00 00 	movabs $0x80135d,%r12
+  801b8c:	00 00 00 
+  801b8f:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801b92:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b97:	4c 89 f6             	mov    %r14,%rsi
+  801b9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b9f:	41 ff d4             	call   *%r12
+    return res;
+  801ba2:	eb c3                	jmp    801b67 <dup+0xe6>
+
+0000000000801ba4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801ba4:	55                   	push   %rbp
+  801ba5:	48 89 e5             	mov    %rsp,%rbp
+  801ba8:	41 56                	push   %r14
+  801baa:	41 55                	push   %r13
+  801bac:	41 54                	push   %r12
+  801bae:	53                   	push   %rbx
+  801baf:	48 83 ec 10          	sub    $0x10,%rsp
+  801bb3:	89 fb                	mov    %edi,%ebx
+  801bb5:	49 89 f4             	mov    %rsi,%r12
+  801bb8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bbb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bbf:	48 b8 c1 18 80 00 00 	movabs $0x8018c1,%rax
+  801bc6:	00 00 00 
+  801bc9:	ff d0                	call   *%rax
+  801bcb:	85 c0                	test   %eax,%eax
+  801bcd:	78 4c                	js     801c1b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bcf:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bd3:	41 8b 3e             	mov    (%r14),%edi
+  801bd6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bda:	48 b8 0c 19 80 00 00 	movabs $0x80190c,%rax
+  801be1:	00 00 00 
+  801be4:	ff d0                	call   *%rax
+  801be6:	85 c0                	test   %eax,%eax
+  801be8:	78 35                	js     801c1f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801bea:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801bee:	83 e0 03             	and    $0x3,%eax
+  801bf1:	83 f8 01             	cmp    $0x1,%eax
+  801bf4:	74 2d                	je     801c23 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801bf6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bfa:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801bfe:	48 85 c0             	test   %rax,%rax
+  801c01:	74 56                	je     801c59 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c03:	4c 89 ea             	mov    %r13,%rdx
+  801c06:	4c 89 e6             	mov    %r12,%rsi
+  801c09:	4c 89 f7             	mov    %r14,%rdi
+  801c0c:	ff d0                	call   *%rax
+}
+  801c0e:	48 83 c4 10          	add    $0x10,%rsp
+  801c12:	5b                   	pop    %rbx
+  801c13:	41 5c                	pop    %r12
+  801c15:	41 5d                	pop    %r13
+  801c17:	41 5e                	pop    %r14
+  801c19:	5d                   	pop    %rbp
+  801c1a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c1b:	48 98                	cltq
+  801c1d:	eb ef                	jmp    801c0e <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c1f:	48 98                	cltq
+  801c21:	eb eb                	jmp    801c0e <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c23:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c2a:	00 00 00 
+  801c2d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c33:	89 da                	mov    %ebx,%edx
+  801c35:	48 bf c1 32 80 00 00 	movabs $0x8032c1,%rdi
+  801c3c:	00 00 00 
+  801c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c44:	48 b9 bc 03 80 00 00 	movabs $0x8003bc,%rcx
+  801c4b:	00 00 00 
+  801c4e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c50:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c57:	eb b5                	jmp    801c0e <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c59:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c60:	eb ac                	jmp    801c0e <read+0x6a>
+
+0000000000801c62 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c62:	55                   	push   %rbp
+  801c63:	48 89 e5             	mov    %rsp,%rbp
+  801c66:	41 57                	push   %r15
+  801c68:	41 56                	push   %r14
+  801c6a:	41 55                	push   %r13
+  801c6c:	41 54                	push   %r12
+  801c6e:	53                   	push   %rbx
+  801c6f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c73:	48 85 d2             	test   %rdx,%rdx
+  801c76:	74 54                	je     801ccc <readn+0x6a>
+  801c78:	41 89 fd             	mov    %edi,%r13d
+  801c7b:	49 89 f6             	mov    %rsi,%r14
+  801c7e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801c81:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801c86:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801c8b:	49 bf a4 1b 80 00 00 	movabs $0x801ba4,%r15
+  801c92:	00 00 00 
+  801c95:	4c 89 e2             	mov    %r12,%rdx
+  801c98:	48 29 f2             	sub    %rsi,%rdx
+  801c9b:	4c 01 f6             	add    %r14,%rsi
+  801c9e:	44 89 ef             	mov    %r13d,%edi
+  801ca1:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801ca4:	85 c0                	test   %eax,%eax
+  801ca6:	78 20                	js     801cc8 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ca8:	01 c3                	add    %eax,%ebx
+  801caa:	85 c0                	test   %eax,%eax
+  801cac:	74 08                	je     801cb6 <readn+0x54>
+  801cae:	48 63 f3             	movslq %ebx,%rsi
+  801cb1:	4c 39 e6             	cmp    %r12,%rsi
+  801cb4:	72 df                	jb     801c95 <readn+0x33>
+    }
+    return res;
+  801cb6:	48 63 c3             	movslq %ebx,%rax
+}
+  801cb9:	48 83 c4 08          	add    $0x8,%rsp
+  801cbd:	5b                   	pop    %rbx
+  801cbe:	41 5c                	pop    %r12
+  801cc0:	41 5d                	pop    %r13
+  801cc2:	41 5e                	pop    %r14
+  801cc4:	41 5f                	pop    %r15
+  801cc6:	5d                   	pop    %rbp
+  801cc7:	c3                   	ret
+        if (inc < 0) return inc;
+  801cc8:	48 98                	cltq
+  801cca:	eb ed                	jmp    801cb9 <readn+0x57>
+    int inc = 1, res = 0;
+  801ccc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cd1:	eb e3                	jmp    801cb6 <readn+0x54>
+
+0000000000801cd3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801cd3:	55                   	push   %rbp
+  801cd4:	48 89 e5             	mov    %rsp,%rbp
+  801cd7:	41 56                	push   %r14
+  801cd9:	41 55                	push   %r13
+  801cdb:	41 54                	push   %r12
+  801cdd:	53                   	push   %rbx
+  801cde:	48 83 ec 10          	sub    $0x10,%rsp
+  801ce2:	89 fb                	mov    %edi,%ebx
+  801ce4:	49 89 f4             	mov    %rsi,%r12
+  801ce7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cea:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cee:	48 b8 c1 18 80 00 00 	movabs $0x8018c1,%rax
+  801cf5:	00 00 00 
+  801cf8:	ff d0                	call   *%rax
+  801cfa:	85 c0                	test   %eax,%eax
+  801cfc:	78 47                	js     801d45 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cfe:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d02:	41 8b 3e             	mov    (%r14),%edi
+  801d05:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d09:	48 b8 0c 19 80 00 00 	movabs $0x80190c,%rax
+  801d10:	00 00 00 
+  801d13:	ff d0                	call   *%rax
+  801d15:	85 c0                	test   %eax,%eax
+  801d17:	78 30                	js     801d49 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d19:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d1e:	74 2d                	je     801d4d <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d20:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d24:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d28:	48 85 c0             	test   %rax,%rax
+  801d2b:	74 56                	je     801d83 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801d2d:	4c 89 ea             	mov    %r13,%rdx
+  801d30:	4c 89 e6             	mov    %r12,%rsi
+  801d33:	4c 89 f7             	mov    %r14,%rdi
+  801d36:	ff d0                	call   *%rax
+}
+  801d38:	48 83 c4 10          	add    $0x10,%rsp
+  801d3c:	5b                   	pop    %rbx
+  801d3d:	41 5c                	pop    %r12
+  801d3f:	41 5d                	pop    %r13
+  801d41:	41 5e                	pop    %r14
+  801d43:	5d                   	pop    %rbp
+  801d44:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d45:	48 98                	cltq
+  801d47:	eb ef                	jmp    801d38 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d49:	48 98                	cltq
+  801d4b:	eb eb                	jmp    801d38 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d4d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d54:	00 00 00 
+  801d57:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d5d:	89 da                	mov    %ebx,%edx
+  801d5f:	48 bf dd 32 80 00 00 	movabs $0x8032dd,%rdi
+  801d66:	00 00 00 
+  801d69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6e:	48 b9 bc 03 80 00 00 	movabs $0x8003bc,%rcx
+  801d75:	00 00 00 
+  801d78:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d7a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d81:	eb b5                	jmp    801d38 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d83:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d8a:	eb ac                	jmp    801d38 <write+0x65>
+
+0000000000801d8c <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801d8c:	55                   	push   %rbp
+  801d8d:	48 89 e5             	mov    %rsp,%rbp
+  801d90:	53                   	push   %rbx
+  801d91:	48 83 ec 18          	sub    $0x18,%rsp
+  801d95:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d97:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d9b:	48 b8 c1 18 80 00 00 	movabs $0x8018c1,%rax
+  801da2:	00 00 00 
+  801da5:	ff d0                	call   *%rax
+  801da7:	85 c0                	test   %eax,%eax
+  801da9:	78 0c                	js     801db7 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801dab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801daf:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801db2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801db7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dbb:	c9                   	leave
+  801dbc:	c3                   	ret
+
+0000000000801dbd <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801dbd:	55                   	push   %rbp
+  801dbe:	48 89 e5             	mov    %rsp,%rbp
+  801dc1:	41 55                	push   %r13
+  801dc3:	41 54                	push   %r12
+  801dc5:	53                   	push   %rbx
+  801dc6:	48 83 ec 18          	sub    $0x18,%rsp
+  801dca:	89 fb                	mov    %edi,%ebx
+  801dcc:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dcf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dd3:	48 b8 c1 18 80 00 00 	movabs $0x8018c1,%rax
+  801dda:	00 00 00 
+  801ddd:	ff d0                	call   *%rax
+  801ddf:	85 c0                	test   %eax,%eax
+  801de1:	78 38                	js     801e1b <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801de3:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801de7:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801deb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801def:	48 b8 0c 19 80 00 00 	movabs $0x80190c,%rax
+  801df6:	00 00 00 
+  801df9:	ff d0                	call   *%rax
+  801dfb:	85 c0                	test   %eax,%eax
+  801dfd:	78 1c                	js     801e1b <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dff:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e04:	74 20                	je     801e26 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e06:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e0a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801e0e:	48 85 c0             	test   %rax,%rax
+  801e11:	74 47                	je     801e5a <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e13:	44 89 e6             	mov    %r12d,%esi
+  801e16:	4c 89 ef             	mov    %r13,%rdi
+  801e19:	ff d0                	call   *%rax
+}
+  801e1b:	48 83 c4 18          	add    $0x18,%rsp
+  801e1f:	5b                   	pop    %rbx
+  801e20:	41 5c                	pop    %r12
+  801e22:	41 5d                	pop    %r13
+  801e24:	5d                   	pop    %rbp
+  801e25:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801e26:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e2d:	00 00 00 
+  801e30:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e36:	89 da                	mov    %ebx,%edx
+  801e38:	48 bf a0 32 80 00 00 	movabs $0x8032a0,%rdi
+  801e3f:	00 00 00 
+  801e42:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e47:	48 b9 bc 03 80 00 00 	movabs $0x8003bc,%rcx
+  801e4e:	00 00 00 
+  801e51:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e53:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e58:	eb c1                	jmp    801e1b <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e5a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e5f:	eb ba                	jmp    801e1b <ftruncate+0x5e>
+
+0000000000801e61 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e61:	55                   	push   %rbp
+  801e62:	48 89 e5             	mov    %rsp,%rbp
+  801e65:	41 54                	push   %r12
+  801e67:	53                   	push   %rbx
+  801e68:	48 83 ec 10          	sub    $0x10,%rsp
+  801e6c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e6f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e73:	48 b8 c1 18 80 00 00 	movabs $0x8018c1,%rax
+  801e7a:	00 00 00 
+  801e7d:	ff d0                	call   *%rax
+  801e7f:	85 c0                	test   %eax,%eax
+  801e81:	78 4e                	js     801ed1 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e83:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e87:	41 8b 3c 24          	mov    (%r12),%edi
+  801e8b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e8f:	48 b8 0c 19 80 00 00 	movabs $0x80190c,%rax
+  801e96:	00 00 00 
+  801e99:	ff d0                	call   *%rax
+  801e9b:	85 c0                	test   %eax,%eax
+  801e9d:	78 32                	js     801ed1 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e9f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ea3:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801ea8:	74 30                	je     801eda <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801eaa:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801ead:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801eb4:	00 00 00 
+    stat->st_isdir = 0;
+  801eb7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ebe:	00 00 00 
+    stat->st_dev = dev;
+  801ec1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801ec8:	48 89 de             	mov    %rbx,%rsi
+  801ecb:	4c 89 e7             	mov    %r12,%rdi
+  801ece:	ff 50 28             	call   *0x28(%rax)
+}
+  801ed1:	48 83 c4 10          	add    $0x10,%rsp
+  801ed5:	5b                   	pop    %rbx
+  801ed6:	41 5c                	pop    %r12
+  801ed8:	5d                   	pop    %rbp
+  801ed9:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801eda:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801edf:	eb f0                	jmp    801ed1 <fstat+0x70>
+
+0000000000801ee1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801ee1:	55                   	push   %rbp
+  801ee2:	48 89 e5             	mov    %rsp,%rbp
+  801ee5:	41 54                	push   %r12
+  801ee7:	53                   	push   %rbx
+  801ee8:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801eeb:	be 00 00 00 00       	mov    $0x0,%esi
+  801ef0:	48 b8 62 21 80 00 00 	movabs $0x802162,%rax
+  801ef7:	00 00 00 
+  801efa:	ff d0                	call   *%rax
+  801efc:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801efe:	85 c0                	test   %eax,%eax
+  801f00:	78 25                	js     801f27 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f02:	4c 89 e6             	mov    %r12,%rsi
+  801f05:	89 c7                	mov    %eax,%edi
+  801f07:	48 b8 61 1e 80 00 00 	movabs $0x801e61,%rax
+  801f0e:	00 00 00 
+  801f11:	ff d0                	call   *%rax
+  801f13:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f16:	89 df                	mov    %ebx,%edi
+  801f18:	48 b8 26 1a 80 00 00 	movabs $0x801a26,%rax
+  801f1f:	00 00 00 
+  801f22:	ff d0                	call   *%rax
+
+    return res;
+  801f24:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f27:	89 d8                	mov    %ebx,%eax
+  801f29:	5b                   	pop    %rbx
+  801f2a:	41 5c                	pop    %r12
+  801f2c:	5d                   	pop    %rbp
+  801f2d:	c3                   	ret
+
+0000000000801f2e <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801f2e:	55                   	push   %rbp
+  801f2f:	48 89 e5             	mov    %rsp,%rbp
+  801f32:	41 54                	push   %r12
+  801f34:	53                   	push   %rbx
+  801f35:	48 83 ec 10          	sub    $0x10,%rsp
+  801f39:	41 89 fc             	mov    %edi,%r12d
+  801f3c:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f3f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801f46:	00 00 00 
+  801f49:	83 38 00             	cmpl   $0x0,(%rax)
+  801f4c:	74 5e                	je     801fac <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801f4e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801f54:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801f59:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801f60:	00 00 00 
+  801f63:	44 89 e6             	mov    %r12d,%esi
+  801f66:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801f6d:	00 00 00 
+  801f70:	8b 38                	mov    (%rax),%edi
+  801f72:	48 b8 9b 2b 80 00 00 	movabs $0x802b9b,%rax
+  801f79:	00 00 00 
+  801f7c:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801f7e:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801f85:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801f86:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f8b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801f8f:	48 89 de             	mov    %rbx,%rsi
+  801f92:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f97:	48 b8 06 2b 80 00 00 	movabs $0x802b06,%rax
+  801f9e:	00 00 00 
+  801fa1:	ff d0                	call   *%rax
+}
+  801fa3:	48 83 c4 10          	add    $0x10,%rsp
+  801fa7:	5b                   	pop    %rbx
+  801fa8:	41 5c                	pop    %r12
+  801faa:	5d                   	pop    %rbp
+  801fab:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fac:	bf 03 00 00 00       	mov    $0x3,%edi
+  801fb1:	48 b8 3b 2c 80 00 00 	movabs $0x802c3b,%rax
+  801fb8:	00 00 00 
+  801fbb:	ff d0                	call   *%rax
+  801fbd:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801fc4:	00 00 
+  801fc6:	eb 86                	jmp    801f4e <fsipc+0x20>
+
+0000000000801fc8 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801fc8:	55                   	push   %rbp
+  801fc9:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801fcc:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801fd3:	00 00 00 
+  801fd6:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801fd9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801fdb:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801fde:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe3:	bf 02 00 00 00       	mov    $0x2,%edi
+  801fe8:	48 b8 2e 1f 80 00 00 	movabs $0x801f2e,%rax
+  801fef:	00 00 00 
+  801ff2:	ff d0                	call   *%rax
+}
+  801ff4:	5d                   	pop    %rbp
+  801ff5:	c3                   	ret
+
+0000000000801ff6 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801ff6:	55                   	push   %rbp
+  801ff7:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ffa:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801ffd:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802004:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802006:	be 00 00 00 00       	mov    $0x0,%esi
+  80200b:	bf 06 00 00 00       	mov    $0x6,%edi
+  802010:	48 b8 2e 1f 80 00 00 	movabs $0x801f2e,%rax
+  802017:	00 00 00 
+  80201a:	ff d0                	call   *%rax
+}
+  80201c:	5d                   	pop    %rbp
+  80201d:	c3                   	ret
+
+000000000080201e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80201e:	55                   	push   %rbp
+  80201f:	48 89 e5             	mov    %rsp,%rbp
+  802022:	41 54                	push   %r12
+  802024:	53                   	push   %rbx
+  802025:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802028:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80202b:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802032:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802034:	be 00 00 00 00       	mov    $0x0,%esi
+  802039:	bf 05 00 00 00       	mov    $0x5,%edi
+  80203e:	48 b8 2e 1f 80 00 00 	movabs $0x801f2e,%rax
+  802045:	00 00 00 
+  802048:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80204a:	85 c0                	test   %eax,%eax
+  80204c:	78 3d                	js     80208b <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80204e:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802055:	00 00 00 
+  802058:	4c 89 e6             	mov    %r12,%rsi
+  80205b:	48 89 df             	mov    %rbx,%rdi
+  80205e:	48 b8 e1 0c 80 00 00 	movabs $0x800ce1,%rax
+  802065:	00 00 00 
+  802068:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80206a:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802071:	00 
+  802072:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802078:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80207f:	00 
+  802080:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802086:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80208b:	5b                   	pop    %rbx
+  80208c:	41 5c                	pop    %r12
+  80208e:	5d                   	pop    %rbp
+  80208f:	c3                   	ret
+
+0000000000802090 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802090:	55                   	push   %rbp
+  802091:	48 89 e5             	mov    %rsp,%rbp
+  802094:	41 54                	push   %r12
+  802096:	53                   	push   %rbx
+  802097:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  80209a:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80209f:	48 39 c2             	cmp    %rax,%rdx
+  8020a2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8020a6:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8020a9:	48 89 c2             	mov    %rax,%rdx
+  8020ac:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8020b3:	00 00 00 
+  8020b6:	48 b8 42 0f 80 00 00 	movabs $0x800f42,%rax
+  8020bd:	00 00 00 
+  8020c0:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020c2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8020c9:	00 00 00 
+  8020cc:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8020d1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8020d3:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8020d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8020dc:	bf 04 00 00 00       	mov    $0x4,%edi
+  8020e1:	48 b8 2e 1f 80 00 00 	movabs $0x801f2e,%rax
+  8020e8:	00 00 00 
+  8020eb:	ff d0                	call   *%rax
+  8020ed:	48 98                	cltq
+}
+  8020ef:	5b                   	pop    %rbx
+  8020f0:	41 5c                	pop    %r12
+  8020f2:	5d                   	pop    %rbp
+  8020f3:	c3                   	ret
+
+00000000008020f4 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8020f4:	55                   	push   %rbp
+  8020f5:	48 89 e5             	mov    %rsp,%rbp
+  8020f8:	41 54                	push   %r12
+  8020fa:	53                   	push   %rbx
+  8020fb:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020fe:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802105:	00 00 00 
+  802108:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80210b:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  80210d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802112:	48 39 ca             	cmp    %rcx,%rdx
+  802115:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  802119:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  80211d:	be 00 00 00 00       	mov    $0x0,%esi
+  802122:	bf 03 00 00 00       	mov    $0x3,%edi
+  802127:	48 b8 2e 1f 80 00 00 	movabs $0x801f2e,%rax
+  80212e:	00 00 00 
+  802131:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802133:	85 c0                	test   %eax,%eax
+  802135:	78 27                	js     80215e <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802137:	48 63 d8             	movslq %eax,%rbx
+  80213a:	48 89 da             	mov    %rbx,%rdx
+  80213d:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802144:	00 00 00 
+  802147:	4c 89 e7             	mov    %r12,%rdi
+  80214a:	48 b8 42 0f 80 00 00 	movabs $0x800f42,%rax
+  802151:	00 00 00 
+  802154:	ff d0                	call   *%rax
+    return bytes_read;
+  802156:	48 89 d8             	mov    %rbx,%rax
+}
+  802159:	5b                   	pop    %rbx
+  80215a:	41 5c                	pop    %r12
+  80215c:	5d                   	pop    %rbp
+  80215d:	c3                   	ret
+        return bytes_read;
+  80215e:	48 98                	cltq
+  802160:	eb f7                	jmp    802159 <devfile_read+0x65>
+
+0000000000802162 <open>:
+open(const char *path, int mode) {
+  802162:	55                   	push   %rbp
+  802163:	48 89 e5             	mov    %rsp,%rbp
+  802166:	41 55                	push   %r13
+  802168:	41 54                	push   %r12
+  80216a:	53                   	push   %rbx
+  80216b:	48 83 ec 18          	sub    $0x18,%rsp
+  80216f:	49 89 fc             	mov    %rdi,%r12
+  802172:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802175:	48 b8 a3 0c 80 00 00 	movabs $0x800ca3,%rax
+  80217c:	00 00 00 
+  80217f:	ff d0                	call   *%rax
+  802181:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802187:	0f 87 8a 00 00 00    	ja     802217 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80218d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802191:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  802198:	00 00 00 
+  80219b:	ff d0                	call   *%rax
+  80219d:	89 c3                	mov    %eax,%ebx
+  80219f:	85 c0                	test   %eax,%eax
+  8021a1:	78 50                	js     8021f3 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8021a3:	4c 89 e6             	mov    %r12,%rsi
+  8021a6:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8021ad:	00 00 00 
+  8021b0:	48 89 df             	mov    %rbx,%rdi
+  8021b3:	48 b8 e1 0c 80 00 00 	movabs $0x800ce1,%rax
+  8021ba:	00 00 00 
+  8021bd:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8021bf:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021c6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8021ca:	bf 01 00 00 00       	mov    $0x1,%edi
+  8021cf:	48 b8 2e 1f 80 00 00 	movabs $0x801f2e,%rax
+  8021d6:	00 00 00 
+  8021d9:	ff d0                	call   *%rax
+  8021db:	89 c3                	mov    %eax,%ebx
+  8021dd:	85 c0                	test   %eax,%eax
+  8021df:	78 1f                	js     802200 <open+0x9e>
+    return fd2num(fd);
+  8021e1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8021e5:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  8021ec:	00 00 00 
+  8021ef:	ff d0                	call   *%rax
+  8021f1:	89 c3                	mov    %eax,%ebx
+}
+  8021f3:	89 d8                	mov    %ebx,%eax
+  8021f5:	48 83 c4 18          	add    $0x18,%rsp
+  8021f9:	5b                   	pop    %rbx
+  8021fa:	41 5c                	pop    %r12
+  8021fc:	41 5d                	pop    %r13
+  8021fe:	5d                   	pop    %rbp
+  8021ff:	c3                   	ret
+        fd_close(fd, 0);
+  802200:	be 00 00 00 00       	mov    $0x0,%esi
+  802205:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802209:	48 b8 7c 19 80 00 00 	movabs $0x80197c,%rax
+  802210:	00 00 00 
+  802213:	ff d0                	call   *%rax
+        return res;
+  802215:	eb dc                	jmp    8021f3 <open+0x91>
+        return -E_BAD_PATH;
+  802217:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80221c:	eb d5                	jmp    8021f3 <open+0x91>
+
+000000000080221e <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80221e:	55                   	push   %rbp
+  80221f:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802222:	be 00 00 00 00       	mov    $0x0,%esi
+  802227:	bf 08 00 00 00       	mov    $0x8,%edi
+  80222c:	48 b8 2e 1f 80 00 00 	movabs $0x801f2e,%rax
+  802233:	00 00 00 
+  802236:	ff d0                	call   *%rax
+}
+  802238:	5d                   	pop    %rbp
+  802239:	c3                   	ret
+
+000000000080223a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80223a:	55                   	push   %rbp
+  80223b:	48 89 e5             	mov    %rsp,%rbp
+  80223e:	41 54                	push   %r12
+  802240:	53                   	push   %rbx
+  802241:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802244:	48 b8 45 18 80 00 00 	movabs $0x801845,%rax
+  80224b:	00 00 00 
+  80224e:	ff d0                	call   *%rax
+  802250:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802253:	48 be 20 33 80 00 00 	movabs $0x803320,%rsi
+  80225a:	00 00 00 
+  80225d:	48 89 df             	mov    %rbx,%rdi
+  802260:	48 b8 e1 0c 80 00 00 	movabs $0x800ce1,%rax
+  802267:	00 00 00 
+  80226a:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80226c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802271:	41 2b 04 24          	sub    (%r12),%eax
+  802275:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80227b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802282:	00 00 00 
+    stat->st_dev = &devpipe;
+  802285:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80228c:	00 00 00 
+  80228f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802296:	b8 00 00 00 00       	mov    $0x0,%eax
+  80229b:	5b                   	pop    %rbx
+  80229c:	41 5c                	pop    %r12
+  80229e:	5d                   	pop    %rbp
+  80229f:	c3                   	ret
+
+00000000008022a0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8022a0:	55                   	push   %rbp
+  8022a1:	48 89 e5             	mov    %rsp,%rbp
+  8022a4:	41 54                	push   %r12
+  8022a6:	53                   	push   %rbx
+  8022a7:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8022aa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022af:	48 89 fe             	mov    %rdi,%rsi
+  8022b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022b7:	49 bc 5d 13 80 00 00 	movabs $0x80135d,%r12
+  8022be:	00 00 00 
+  8022c1:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8022c4:	48 89 df             	mov    %rbx,%rdi
+  8022c7:	48 b8 45 18 80 00 00 	movabs $0x801845,%rax
+  8022ce:	00 00 00 
+  8022d1:	ff d0                	call   *%rax
+  8022d3:	48 89 c6             	mov    %rax,%rsi
+  8022d6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022e0:	41 ff d4             	call   *%r12
+}
+  8022e3:	5b                   	pop    %rbx
+  8022e4:	41 5c                	pop    %r12
+  8022e6:	5d                   	pop    %rbp
+  8022e7:	c3                   	ret
+
+00000000008022e8 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8022e8:	55                   	push   %rbp
+  8022e9:	48 89 e5             	mov    %rsp,%rbp
+  8022ec:	41 57                	push   %r15
+  8022ee:	41 56                	push   %r14
+  8022f0:	41 55                	push   %r13
+  8022f2:	41 54                	push   %r12
+  8022f4:	53                   	push   %rbx
+  8022f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8022f9:	49 89 fc             	mov    %rdi,%r12
+  8022fc:	49 89 f5             	mov    %rsi,%r13
+  8022ff:	49 89 d7             	mov    %rdx,%r15
+  802302:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802306:	48 b8 45 18 80 00 00 	movabs $0x801845,%rax
+  80230d:	00 00 00 
+  802310:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802312:	4d 85 ff             	test   %r15,%r15
+  802315:	0f 84 af 00 00 00    	je     8023ca <devpipe_write+0xe2>
+  80231b:	48 89 c3             	mov    %rax,%rbx
+  80231e:	4c 89 f8             	mov    %r15,%rax
+  802321:	4d 89 ef             	mov    %r13,%r15
+  802324:	4c 01 e8             	add    %r13,%rax
+  802327:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80232b:	49 bd 65 12 80 00 00 	movabs $0x801265,%r13
+  802332:	00 00 00 
+            sys_yield();
+  802335:	49 be 02 12 80 00 00 	movabs $0x801202,%r14
+  80233c:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80233f:	8b 73 04             	mov    0x4(%rbx),%esi
+  802342:	48 63 ce             	movslq %esi,%rcx
+  802345:	48 63 03             	movslq (%rbx),%rax
+  802348:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80234e:	48 39 c1             	cmp    %rax,%rcx
+  802351:	72 2e                	jb     802381 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802353:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802358:	48 89 da             	mov    %rbx,%rdx
+  80235b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802360:	4c 89 e7             	mov    %r12,%rdi
+  802363:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802366:	85 c0                	test   %eax,%eax
+  802368:	74 66                	je     8023d0 <devpipe_write+0xe8>
+            sys_yield();
+  80236a:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80236d:	8b 73 04             	mov    0x4(%rbx),%esi
+  802370:	48 63 ce             	movslq %esi,%rcx
+  802373:	48 63 03             	movslq (%rbx),%rax
+  802376:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80237c:	48 39 c1             	cmp    %rax,%rcx
+  80237f:	73 d2                	jae    802353 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802381:	41 0f b6 3f          	movzbl (%r15),%edi
+  802385:	48 89 ca             	mov    %rcx,%rdx
+  802388:	48 c1 ea 03          	shr    $0x3,%rdx
+  80238c:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802393:	08 10 20 
+  802396:	48 f7 e2             	mul    %rdx
+  802399:	48 c1 ea 06          	shr    $0x6,%rdx
+  80239d:	48 89 d0             	mov    %rdx,%rax
+  8023a0:	48 c1 e0 09          	shl    $0x9,%rax
+  8023a4:	48 29 d0             	sub    %rdx,%rax
+  8023a7:	48 c1 e0 03          	shl    $0x3,%rax
+  8023ab:	48 29 c1             	sub    %rax,%rcx
+  8023ae:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8023b3:	83 c6 01             	add    $0x1,%esi
+  8023b6:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8023b9:	49 83 c7 01          	add    $0x1,%r15
+  8023bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023c1:	49 39 c7             	cmp    %rax,%r15
+  8023c4:	0f 85 75 ff ff ff    	jne    80233f <devpipe_write+0x57>
+    return n;
+  8023ca:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023ce:	eb 05                	jmp    8023d5 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8023d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023d5:	48 83 c4 18          	add    $0x18,%rsp
+  8023d9:	5b                   	pop    %rbx
+  8023da:	41 5c                	pop    %r12
+  8023dc:	41 5d                	pop    %r13
+  8023de:	41 5e                	pop    %r14
+  8023e0:	41 5f                	pop    %r15
+  8023e2:	5d                   	pop    %rbp
+  8023e3:	c3                   	ret
+
+00000000008023e4 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8023e4:	55                   	push   %rbp
+  8023e5:	48 89 e5             	mov    %rsp,%rbp
+  8023e8:	41 57                	push   %r15
+  8023ea:	41 56                	push   %r14
+  8023ec:	41 55                	push   %r13
+  8023ee:	41 54                	push   %r12
+  8023f0:	53                   	push   %rbx
+  8023f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8023f5:	49 89 fc             	mov    %rdi,%r12
+  8023f8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8023fc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802400:	48 b8 45 18 80 00 00 	movabs $0x801845,%rax
+  802407:	00 00 00 
+  80240a:	ff d0                	call   *%rax
+  80240c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80240f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802415:	49 bd 65 12 80 00 00 	movabs $0x801265,%r13
+  80241c:	00 00 00 
+            sys_yield();
+  80241f:	49 be 02 12 80 00 00 	movabs $0x801202,%r14
+  802426:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802429:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80242e:	74 7d                	je     8024ad <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802430:	8b 03                	mov    (%rbx),%eax
+  802432:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802435:	75 26                	jne    80245d <devpipe_read+0x79>
+            if (i > 0) return i;
+  802437:	4d 85 ff             	test   %r15,%r15
+  80243a:	75 77                	jne    8024b3 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80243c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802441:	48 89 da             	mov    %rbx,%rdx
+  802444:	be 00 10 00 00       	mov    $0x1000,%esi
+  802449:	4c 89 e7             	mov    %r12,%rdi
+  80244c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80244f:	85 c0                	test   %eax,%eax
+  802451:	74 72                	je     8024c5 <devpipe_read+0xe1>
+            sys_yield();
+  802453:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802456:	8b 03                	mov    (%rbx),%eax
+  802458:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80245b:	74 df                	je     80243c <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80245d:	48 63 c8             	movslq %eax,%rcx
+  802460:	48 89 ca             	mov    %rcx,%rdx
+  802463:	48 c1 ea 03          	shr    $0x3,%rdx
+  802467:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80246e:	08 10 20 
+  802471:	48 89 d0             	mov    %rdx,%rax
+  802474:	48 f7 e6             	mul    %rsi
+  802477:	48 c1 ea 06          	shr    $0x6,%rdx
+  80247b:	48 89 d0             	mov    %rdx,%rax
+  80247e:	48 c1 e0 09          	shl    $0x9,%rax
+  802482:	48 29 d0             	sub    %rdx,%rax
+  802485:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80248c:	00 
+  80248d:	48 89 c8             	mov    %rcx,%rax
+  802490:	48 29 d0             	sub    %rdx,%rax
+  802493:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802498:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80249c:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8024a0:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8024a3:	49 83 c7 01          	add    $0x1,%r15
+  8024a7:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8024ab:	75 83                	jne    802430 <devpipe_read+0x4c>
+    return n;
+  8024ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024b1:	eb 03                	jmp    8024b6 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8024b3:	4c 89 f8             	mov    %r15,%rax
+}
+  8024b6:	48 83 c4 18          	add    $0x18,%rsp
+  8024ba:	5b                   	pop    %rbx
+  8024bb:	41 5c                	pop    %r12
+  8024bd:	41 5d                	pop    %r13
+  8024bf:	41 5e                	pop    %r14
+  8024c1:	41 5f                	pop    %r15
+  8024c3:	5d                   	pop    %rbp
+  8024c4:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8024c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ca:	eb ea                	jmp    8024b6 <devpipe_read+0xd2>
+
+00000000008024cc <pipe>:
+pipe(int pfd[2]) {
+  8024cc:	55                   	push   %rbp
+  8024cd:	48 89 e5             	mov    %rsp,%rbp
+  8024d0:	41 55                	push   %r13
+  8024d2:	41 54                	push   %r12
+  8024d4:	53                   	push   %rbx
+  8024d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8024d9:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8024dc:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8024e0:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  8024e7:	00 00 00 
+  8024ea:	ff d0                	call   *%rax
+  8024ec:	89 c3                	mov    %eax,%ebx
+  8024ee:	85 c0                	test   %eax,%eax
+  8024f0:	0f 88 a0 01 00 00    	js     802696 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8024f6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8024fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802500:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802504:	bf 00 00 00 00       	mov    $0x0,%edi
+  802509:	48 b8 91 12 80 00 00 	movabs $0x801291,%rax
+  802510:	00 00 00 
+  802513:	ff d0                	call   *%rax
+  802515:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802517:	85 c0                	test   %eax,%eax
+  802519:	0f 88 77 01 00 00    	js     802696 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80251f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802523:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  80252a:	00 00 00 
+  80252d:	ff d0                	call   *%rax
+  80252f:	89 c3                	mov    %eax,%ebx
+  802531:	85 c0                	test   %eax,%eax
+  802533:	0f 88 43 01 00 00    	js     80267c <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802539:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80253e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802543:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802547:	bf 00 00 00 00       	mov    $0x0,%edi
+  80254c:	48 b8 91 12 80 00 00 	movabs $0x801291,%rax
+  802553:	00 00 00 
+  802556:	ff d0                	call   *%rax
+  802558:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80255a:	85 c0                	test   %eax,%eax
+  80255c:	0f 88 1a 01 00 00    	js     80267c <pipe+0x1b0>
+    va = fd2data(fd0);
+  802562:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802566:	48 b8 45 18 80 00 00 	movabs $0x801845,%rax
+  80256d:	00 00 00 
+  802570:	ff d0                	call   *%rax
+  802572:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802575:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80257a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80257f:	48 89 c6             	mov    %rax,%rsi
+  802582:	bf 00 00 00 00       	mov    $0x0,%edi
+  802587:	48 b8 91 12 80 00 00 	movabs $0x801291,%rax
+  80258e:	00 00 00 
+  802591:	ff d0                	call   *%rax
+  802593:	89 c3                	mov    %eax,%ebx
+  802595:	85 c0                	test   %eax,%eax
+  802597:	0f 88 c5 00 00 00    	js     802662 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80259d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8025a1:	48 b8 45 18 80 00 00 	movabs $0x801845,%rax
+  8025a8:	00 00 00 
+  8025ab:	ff d0                	call   *%rax
+  8025ad:	48 89 c1             	mov    %rax,%rcx
+  8025b0:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8025b6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8025bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025c1:	4c 89 ee             	mov    %r13,%rsi
+  8025c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025c9:	48 b8 f8 12 80 00 00 	movabs $0x8012f8,%rax
+  8025d0:	00 00 00 
+  8025d3:	ff d0                	call   *%rax
+  8025d5:	89 c3                	mov    %eax,%ebx
+  8025d7:	85 c0                	test   %eax,%eax
+  8025d9:	78 6e                	js     802649 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8025db:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025e0:	4c 89 ef             	mov    %r13,%rdi
+  8025e3:	48 b8 33 12 80 00 00 	movabs $0x801233,%rax
+  8025ea:	00 00 00 
+  8025ed:	ff d0                	call   *%rax
+  8025ef:	83 f8 02             	cmp    $0x2,%eax
+  8025f2:	0f 85 ab 00 00 00    	jne    8026a3 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8025f8:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8025ff:	00 00 
+  802601:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802605:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802607:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80260b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802612:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802616:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802618:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80261c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802623:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802627:	48 bb 33 18 80 00 00 	movabs $0x801833,%rbx
+  80262e:	00 00 00 
+  802631:	ff d3                	call   *%rbx
+  802633:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802637:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80263b:	ff d3                	call   *%rbx
+  80263d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802642:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802647:	eb 4d                	jmp    802696 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802649:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80264e:	4c 89 ee             	mov    %r13,%rsi
+  802651:	bf 00 00 00 00       	mov    $0x0,%edi
+  802656:	48 b8 5d 13 80 00 00 	movabs $0x80135d,%rax
+  80265d:	00 00 00 
+  802660:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802662:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802667:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80266b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802670:	48 b8 5d 13 80 00 00 	movabs $0x80135d,%rax
+  802677:	00 00 00 
+  80267a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80267c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802681:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802685:	bf 00 00 00 00       	mov    $0x0,%edi
+  80268a:	48 b8 5d 13 80 00 00 	movabs $0x80135d,%rax
+  802691:	00 00 00 
+  802694:	ff d0                	call   *%rax
+}
+  802696:	89 d8                	mov    %ebx,%eax
+  802698:	48 83 c4 18          	add    $0x18,%rsp
+  80269c:	5b                   	pop    %rbx
+  80269d:	41 5c                	pop    %r12
+  80269f:	41 5d                	pop    %r13
+  8026a1:	5d                   	pop    %rbp
+  8026a2:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8026a3:	48 b9 50 33 80 00 00 	movabs $0x803350,%rcx
+  8026aa:	00 00 00 
+  8026ad:	48 ba 27 33 80 00 00 	movabs $0x803327,%rdx
+  8026b4:	00 00 00 
+  8026b7:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8026bc:	48 bf 3c 33 80 00 00 	movabs $0x80333c,%rdi
+  8026c3:	00 00 00 
+  8026c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026cb:	49 b8 6c 02 80 00 00 	movabs $0x80026c,%r8
+  8026d2:	00 00 00 
+  8026d5:	41 ff d0             	call   *%r8
+
+00000000008026d8 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8026d8:	55                   	push   %rbp
+  8026d9:	48 89 e5             	mov    %rsp,%rbp
+  8026dc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8026e0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8026e4:	48 b8 c1 18 80 00 00 	movabs $0x8018c1,%rax
+  8026eb:	00 00 00 
+  8026ee:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026f0:	85 c0                	test   %eax,%eax
+  8026f2:	78 35                	js     802729 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8026f4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8026f8:	48 b8 45 18 80 00 00 	movabs $0x801845,%rax
+  8026ff:	00 00 00 
+  802702:	ff d0                	call   *%rax
+  802704:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802707:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80270c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802711:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802715:	48 b8 65 12 80 00 00 	movabs $0x801265,%rax
+  80271c:	00 00 00 
+  80271f:	ff d0                	call   *%rax
+  802721:	85 c0                	test   %eax,%eax
+  802723:	0f 94 c0             	sete   %al
+  802726:	0f b6 c0             	movzbl %al,%eax
+}
+  802729:	c9                   	leave
+  80272a:	c3                   	ret
+
+000000000080272b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80272b:	48 89 f8             	mov    %rdi,%rax
+  80272e:	48 c1 e8 27          	shr    $0x27,%rax
+  802732:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802739:	01 00 00 
+  80273c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802740:	f6 c2 01             	test   $0x1,%dl
+  802743:	74 6d                	je     8027b2 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802745:	48 89 f8             	mov    %rdi,%rax
+  802748:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80274c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802753:	01 00 00 
+  802756:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80275a:	f6 c2 01             	test   $0x1,%dl
+  80275d:	74 62                	je     8027c1 <get_uvpt_entry+0x96>
+  80275f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802766:	01 00 00 
+  802769:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80276d:	f6 c2 80             	test   $0x80,%dl
+  802770:	75 4f                	jne    8027c1 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802772:	48 89 f8             	mov    %rdi,%rax
+  802775:	48 c1 e8 15          	shr    $0x15,%rax
+  802779:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802780:	01 00 00 
+  802783:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802787:	f6 c2 01             	test   $0x1,%dl
+  80278a:	74 44                	je     8027d0 <get_uvpt_entry+0xa5>
+  80278c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802793:	01 00 00 
+  802796:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80279a:	f6 c2 80             	test   $0x80,%dl
+  80279d:	75 31                	jne    8027d0 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80279f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8027a3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8027aa:	01 00 00 
+  8027ad:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8027b1:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8027b2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8027b9:	01 00 00 
+  8027bc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027c0:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8027c1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8027c8:	01 00 00 
+  8027cb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027cf:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8027d0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8027d7:	01 00 00 
+  8027da:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027de:	c3                   	ret
+
+00000000008027df <get_prot>:
+
+int
+get_prot(void *va) {
+  8027df:	55                   	push   %rbp
+  8027e0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8027e3:	48 b8 2b 27 80 00 00 	movabs $0x80272b,%rax
+  8027ea:	00 00 00 
+  8027ed:	ff d0                	call   *%rax
+  8027ef:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8027f2:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8027f7:	89 c1                	mov    %eax,%ecx
+  8027f9:	83 c9 04             	or     $0x4,%ecx
+  8027fc:	f6 c2 01             	test   $0x1,%dl
+  8027ff:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802802:	89 c1                	mov    %eax,%ecx
+  802804:	83 c9 02             	or     $0x2,%ecx
+  802807:	f6 c2 02             	test   $0x2,%dl
+  80280a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80280d:	89 c1                	mov    %eax,%ecx
+  80280f:	83 c9 01             	or     $0x1,%ecx
+  802812:	48 85 d2             	test   %rdx,%rdx
+  802815:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802818:	89 c1                	mov    %eax,%ecx
+  80281a:	83 c9 40             	or     $0x40,%ecx
+  80281d:	f6 c6 04             	test   $0x4,%dh
+  802820:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802823:	5d                   	pop    %rbp
+  802824:	c3                   	ret
+
+0000000000802825 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802825:	55                   	push   %rbp
+  802826:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802829:	48 b8 2b 27 80 00 00 	movabs $0x80272b,%rax
+  802830:	00 00 00 
+  802833:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802835:	48 c1 e8 06          	shr    $0x6,%rax
+  802839:	83 e0 01             	and    $0x1,%eax
+}
+  80283c:	5d                   	pop    %rbp
+  80283d:	c3                   	ret
+
+000000000080283e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80283e:	55                   	push   %rbp
+  80283f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802842:	48 b8 2b 27 80 00 00 	movabs $0x80272b,%rax
+  802849:	00 00 00 
+  80284c:	ff d0                	call   *%rax
+  80284e:	83 e0 01             	and    $0x1,%eax
+}
+  802851:	5d                   	pop    %rbp
+  802852:	c3                   	ret
+
+0000000000802853 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802853:	55                   	push   %rbp
+  802854:	48 89 e5             	mov    %rsp,%rbp
+  802857:	41 57                	push   %r15
+  802859:	41 56                	push   %r14
+  80285b:	41 55                	push   %r13
+  80285d:	41 54                	push   %r12
+  80285f:	53                   	push   %rbx
+  802860:	48 83 ec 18          	sub    $0x18,%rsp
+  802864:	49 89 ff             	mov    %rdi,%r15
+  802867:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80286b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802870:	49 bc 3e 28 80 00 00 	movabs $0x80283e,%r12
+  802877:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  80287a:	49 be df 27 80 00 00 	movabs $0x8027df,%r14
+  802881:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802884:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  80288b:	00 00 00 
+  80288e:	eb 0c                	jmp    80289c <foreach_shared_region+0x49>
+  802890:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802897:	4c 39 eb             	cmp    %r13,%rbx
+  80289a:	74 38                	je     8028d4 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  80289c:	48 89 df             	mov    %rbx,%rdi
+  80289f:	41 ff d4             	call   *%r12
+  8028a2:	84 c0                	test   %al,%al
+  8028a4:	74 ea                	je     802890 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  8028a6:	48 89 df             	mov    %rbx,%rdi
+  8028a9:	41 ff d6             	call   *%r14
+  8028ac:	a8 40                	test   $0x40,%al
+  8028ae:	74 e0                	je     802890 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8028b0:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8028b7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8028bb:	48 89 df             	mov    %rbx,%rdi
+  8028be:	41 ff d7             	call   *%r15
+        if (err)
+  8028c1:	85 c0                	test   %eax,%eax
+  8028c3:	74 cb                	je     802890 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8028c5:	48 83 c4 18          	add    $0x18,%rsp
+  8028c9:	5b                   	pop    %rbx
+  8028ca:	41 5c                	pop    %r12
+  8028cc:	41 5d                	pop    %r13
+  8028ce:	41 5e                	pop    %r14
+  8028d0:	41 5f                	pop    %r15
+  8028d2:	5d                   	pop    %rbp
+  8028d3:	c3                   	ret
+    return 0;
+  8028d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d9:	eb ea                	jmp    8028c5 <foreach_shared_region+0x72>
+
+00000000008028db <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8028db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e0:	c3                   	ret
+
+00000000008028e1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8028e1:	55                   	push   %rbp
+  8028e2:	48 89 e5             	mov    %rsp,%rbp
+  8028e5:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8028e8:	48 be 74 33 80 00 00 	movabs $0x803374,%rsi
+  8028ef:	00 00 00 
+  8028f2:	48 b8 e1 0c 80 00 00 	movabs $0x800ce1,%rax
+  8028f9:	00 00 00 
+  8028fc:	ff d0                	call   *%rax
+    return 0;
+}
+  8028fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802903:	5d                   	pop    %rbp
+  802904:	c3                   	ret
+
+0000000000802905 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802905:	55                   	push   %rbp
+  802906:	48 89 e5             	mov    %rsp,%rbp
+  802909:	41 57                	push   %r15
+  80290b:	41 56                	push   %r14
+  80290d:	41 55                	push   %r13
+  80290f:	41 54                	push   %r12
+  802911:	53                   	push   %rbx
+  802912:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802919:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802920:	48 85 d2             	test   %rdx,%rdx
+  802923:	74 7a                	je     80299f <devcons_write+0x9a>
+  802925:	49 89 d6             	mov    %rdx,%r14
+  802928:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80292e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802933:	49 bf db 0e 80 00 00 	movabs $0x800edb,%r15
+  80293a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80293d:	4c 89 f3             	mov    %r14,%rbx
+  802940:	48 29 f3             	sub    %rsi,%rbx
+  802943:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802948:	48 39 c3             	cmp    %rax,%rbx
+  80294b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80294f:	4c 63 eb             	movslq %ebx,%r13
+  802952:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802959:	48 01 c6             	add    %rax,%rsi
+  80295c:	4c 89 ea             	mov    %r13,%rdx
+  80295f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802966:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802969:	4c 89 ee             	mov    %r13,%rsi
+  80296c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802973:	48 b8 08 11 80 00 00 	movabs $0x801108,%rax
+  80297a:	00 00 00 
+  80297d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80297f:	41 01 dc             	add    %ebx,%r12d
+  802982:	49 63 f4             	movslq %r12d,%rsi
+  802985:	4c 39 f6             	cmp    %r14,%rsi
+  802988:	72 b3                	jb     80293d <devcons_write+0x38>
+    return res;
+  80298a:	49 63 c4             	movslq %r12d,%rax
+}
+  80298d:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802994:	5b                   	pop    %rbx
+  802995:	41 5c                	pop    %r12
+  802997:	41 5d                	pop    %r13
+  802999:	41 5e                	pop    %r14
+  80299b:	41 5f                	pop    %r15
+  80299d:	5d                   	pop    %rbp
+  80299e:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80299f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8029a5:	eb e3                	jmp    80298a <devcons_write+0x85>
+
+00000000008029a7 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8029a7:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8029aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029af:	48 85 c0             	test   %rax,%rax
+  8029b2:	74 55                	je     802a09 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8029b4:	55                   	push   %rbp
+  8029b5:	48 89 e5             	mov    %rsp,%rbp
+  8029b8:	41 55                	push   %r13
+  8029ba:	41 54                	push   %r12
+  8029bc:	53                   	push   %rbx
+  8029bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8029c1:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8029c4:	48 bb 35 11 80 00 00 	movabs $0x801135,%rbx
+  8029cb:	00 00 00 
+  8029ce:	49 bc 02 12 80 00 00 	movabs $0x801202,%r12
+  8029d5:	00 00 00 
+  8029d8:	eb 03                	jmp    8029dd <devcons_read+0x36>
+  8029da:	41 ff d4             	call   *%r12
+  8029dd:	ff d3                	call   *%rbx
+  8029df:	85 c0                	test   %eax,%eax
+  8029e1:	74 f7                	je     8029da <devcons_read+0x33>
+    if (c < 0) return c;
+  8029e3:	48 63 d0             	movslq %eax,%rdx
+  8029e6:	78 13                	js     8029fb <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8029e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029ed:	83 f8 04             	cmp    $0x4,%eax
+  8029f0:	74 09                	je     8029fb <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8029f2:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8029f6:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8029fb:	48 89 d0             	mov    %rdx,%rax
+  8029fe:	48 83 c4 08          	add    $0x8,%rsp
+  802a02:	5b                   	pop    %rbx
+  802a03:	41 5c                	pop    %r12
+  802a05:	41 5d                	pop    %r13
+  802a07:	5d                   	pop    %rbp
+  802a08:	c3                   	ret
+  802a09:	48 89 d0             	mov    %rdx,%rax
+  802a0c:	c3                   	ret
+
+0000000000802a0d <cputchar>:
+cputchar(int ch) {
+  802a0d:	55                   	push   %rbp
+  802a0e:	48 89 e5             	mov    %rsp,%rbp
+  802a11:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802a15:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802a19:	be 01 00 00 00       	mov    $0x1,%esi
+  802a1e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802a22:	48 b8 08 11 80 00 00 	movabs $0x801108,%rax
+  802a29:	00 00 00 
+  802a2c:	ff d0                	call   *%rax
+}
+  802a2e:	c9                   	leave
+  802a2f:	c3                   	ret
+
+0000000000802a30 <getchar>:
+getchar(void) {
+  802a30:	55                   	push   %rbp
+  802a31:	48 89 e5             	mov    %rsp,%rbp
+  802a34:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802a38:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a3d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802a41:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a46:	48 b8 a4 1b 80 00 00 	movabs $0x801ba4,%rax
+  802a4d:	00 00 00 
+  802a50:	ff d0                	call   *%rax
+  802a52:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802a54:	85 c0                	test   %eax,%eax
+  802a56:	78 06                	js     802a5e <getchar+0x2e>
+  802a58:	74 08                	je     802a62 <getchar+0x32>
+  802a5a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802a5e:	89 d0                	mov    %edx,%eax
+  802a60:	c9                   	leave
+  802a61:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802a62:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802a67:	eb f5                	jmp    802a5e <getchar+0x2e>
+
+0000000000802a69 <iscons>:
+iscons(int fdnum) {
+  802a69:	55                   	push   %rbp
+  802a6a:	48 89 e5             	mov    %rsp,%rbp
+  802a6d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802a71:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802a75:	48 b8 c1 18 80 00 00 	movabs $0x8018c1,%rax
+  802a7c:	00 00 00 
+  802a7f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a81:	85 c0                	test   %eax,%eax
+  802a83:	78 18                	js     802a9d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802a85:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a89:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802a90:	00 00 00 
+  802a93:	8b 00                	mov    (%rax),%eax
+  802a95:	39 02                	cmp    %eax,(%rdx)
+  802a97:	0f 94 c0             	sete   %al
+  802a9a:	0f b6 c0             	movzbl %al,%eax
+}
+  802a9d:	c9                   	leave
+  802a9e:	c3                   	ret
+
+0000000000802a9f <opencons>:
+opencons(void) {
+  802a9f:	55                   	push   %rbp
+  802aa0:	48 89 e5             	mov    %rsp,%rbp
+  802aa3:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802aa7:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802aab:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  802ab2:	00 00 00 
+  802ab5:	ff d0                	call   *%rax
+  802ab7:	85 c0                	test   %eax,%eax
+  802ab9:	78 49                	js     802b04 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802abb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ac0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ac5:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802ac9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ace:	48 b8 91 12 80 00 00 	movabs $0x801291,%rax
+  802ad5:	00 00 00 
+  802ad8:	ff d0                	call   *%rax
+  802ada:	85 c0                	test   %eax,%eax
+  802adc:	78 26                	js     802b04 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802ade:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ae2:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802ae9:	00 00 
+  802aeb:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802aed:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802af1:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802af8:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  802aff:	00 00 00 
+  802b02:	ff d0                	call   *%rax
+}
+  802b04:	c9                   	leave
+  802b05:	c3                   	ret
+
+0000000000802b06 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802b06:	55                   	push   %rbp
+  802b07:	48 89 e5             	mov    %rsp,%rbp
+  802b0a:	41 54                	push   %r12
+  802b0c:	53                   	push   %rbx
+  802b0d:	48 89 fb             	mov    %rdi,%rbx
+  802b10:	48 89 f7             	mov    %rsi,%rdi
+  802b13:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802b16:	48 85 f6             	test   %rsi,%rsi
+  802b19:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802b20:	00 00 00 
+  802b23:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802b27:	be 00 10 00 00       	mov    $0x1000,%esi
+  802b2c:	48 b8 fb 15 80 00 00 	movabs $0x8015fb,%rax
+  802b33:	00 00 00 
+  802b36:	ff d0                	call   *%rax
+    if (res < 0) {
+  802b38:	85 c0                	test   %eax,%eax
+  802b3a:	78 45                	js     802b81 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802b3c:	48 85 db             	test   %rbx,%rbx
+  802b3f:	74 12                	je     802b53 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802b41:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b48:	00 00 00 
+  802b4b:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b51:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802b53:	4d 85 e4             	test   %r12,%r12
+  802b56:	74 14                	je     802b6c <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802b58:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b5f:	00 00 00 
+  802b62:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b68:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802b6c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b73:	00 00 00 
+  802b76:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b7c:	5b                   	pop    %rbx
+  802b7d:	41 5c                	pop    %r12
+  802b7f:	5d                   	pop    %rbp
+  802b80:	c3                   	ret
+        if (from_env_store)
+  802b81:	48 85 db             	test   %rbx,%rbx
+  802b84:	74 06                	je     802b8c <ipc_recv+0x86>
+            *from_env_store = 0;
+  802b86:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802b8c:	4d 85 e4             	test   %r12,%r12
+  802b8f:	74 eb                	je     802b7c <ipc_recv+0x76>
+            *perm_store = 0;
+  802b91:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b98:	00 
+  802b99:	eb e1                	jmp    802b7c <ipc_recv+0x76>
+
+0000000000802b9b <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802b9b:	55                   	push   %rbp
+  802b9c:	48 89 e5             	mov    %rsp,%rbp
+  802b9f:	41 57                	push   %r15
+  802ba1:	41 56                	push   %r14
+  802ba3:	41 55                	push   %r13
+  802ba5:	41 54                	push   %r12
+  802ba7:	53                   	push   %rbx
+  802ba8:	48 83 ec 18          	sub    $0x18,%rsp
+  802bac:	41 89 fd             	mov    %edi,%r13d
+  802baf:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802bb2:	48 89 d3             	mov    %rdx,%rbx
+  802bb5:	49 89 cc             	mov    %rcx,%r12
+  802bb8:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802bbc:	48 85 d2             	test   %rdx,%rdx
+  802bbf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bc6:	00 00 00 
+  802bc9:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802bcd:	49 be cf 15 80 00 00 	movabs $0x8015cf,%r14
+  802bd4:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802bd7:	49 bf 02 12 80 00 00 	movabs $0x801202,%r15
+  802bde:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802be1:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802be4:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802be8:	4c 89 e1             	mov    %r12,%rcx
+  802beb:	48 89 da             	mov    %rbx,%rdx
+  802bee:	44 89 ef             	mov    %r13d,%edi
+  802bf1:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802bf4:	85 c0                	test   %eax,%eax
+  802bf6:	74 34                	je     802c2c <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802bf8:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802bfb:	75 05                	jne    802c02 <ipc_send+0x67>
+        sys_yield();
+  802bfd:	41 ff d7             	call   *%r15
+    while (true) {
+  802c00:	eb df                	jmp    802be1 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802c02:	48 ba 80 33 80 00 00 	movabs $0x803380,%rdx
+  802c09:	00 00 00 
+  802c0c:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802c11:	48 bf 99 33 80 00 00 	movabs $0x803399,%rdi
+  802c18:	00 00 00 
+  802c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c20:	48 b9 6c 02 80 00 00 	movabs $0x80026c,%rcx
+  802c27:	00 00 00 
+  802c2a:	ff d1                	call   *%rcx
+    }
+}
+  802c2c:	48 83 c4 18          	add    $0x18,%rsp
+  802c30:	5b                   	pop    %rbx
+  802c31:	41 5c                	pop    %r12
+  802c33:	41 5d                	pop    %r13
+  802c35:	41 5e                	pop    %r14
+  802c37:	41 5f                	pop    %r15
+  802c39:	5d                   	pop    %rbp
+  802c3a:	c3                   	ret
+
+0000000000802c3b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c40:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c47:	00 00 00 
+  802c4a:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802c51:	48 01 ca             	add    %rcx,%rdx
+  802c54:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802c5a:	39 fa                	cmp    %edi,%edx
+  802c5c:	74 12                	je     802c70 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c5e:	48 83 c0 01          	add    $0x1,%rax
+  802c62:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c68:	75 e0                	jne    802c4a <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c6f:	c3                   	ret
+            return envs[i].env_id;
+  802c70:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802c77:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c7e:	00 00 00 
+  802c81:	48 01 d0             	add    %rdx,%rax
+  802c84:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802c8a:	c3                   	ret
+  802c8b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000802c90 <__rodata_start>:
+  802c90:	73 79                	jae    802d0b <__rodata_start+0x7b>
+  802c92:	73 5f                	jae    802cf3 <__rodata_start+0x63>
+  802c94:	65 78 6f             	gs js  802d06 <__rodata_start+0x76>
+  802c97:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802c99:	72 6b                	jb     802d06 <__rodata_start+0x76>
+  802c9b:	3a 20                	cmp    (%rax),%ah
+  802c9d:	25 69 00 75 73       	and    $0x73750069,%eax
+  802ca2:	65 72 2f             	gs jb  802cd4 <__rodata_start+0x44>
+  802ca5:	64 75 6d             	fs jne 802d15 <__rodata_start+0x85>
+  802ca8:	62 66 6f 72 6b       	(bad)
+  802cad:	2e 63 00             	cs movsxd (%rax),%eax
+  802cb0:	73 79                	jae    802d2b <__rodata_start+0x9b>
+  802cb2:	73 5f                	jae    802d13 <__rodata_start+0x83>
+  802cb4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802cb6:	76 5f                	jbe    802d17 <__rodata_start+0x87>
+  802cb8:	73 65                	jae    802d1f <__rodata_start+0x8f>
+  802cba:	74 5f                	je     802d1b <__rodata_start+0x8b>
+  802cbc:	73 74                	jae    802d32 <__rodata_start+0xa2>
+  802cbe:	61                   	(bad)
+  802cbf:	74 75                	je     802d36 <__rodata_start+0xa6>
+  802cc1:	73 3a                	jae    802cfd <__rodata_start+0x6d>
+  802cc3:	20 25 69 00 70 61    	and    %ah,0x61700069(%rip)        # 61f02d32 <__bss_end+0x616fad32>
+  802cc9:	72 65                	jb     802d30 <__rodata_start+0xa0>
+  802ccb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ccc:	74 00                	je     802cce <__rodata_start+0x3e>
+  802cce:	63 68 69             	movsxd 0x69(%rax),%ebp
+  802cd1:	6c                   	insb   (%dx),%es:(%rdi)
+  802cd2:	64 00 25 64 3a 20 49 	add    %ah,%fs:0x49203a64(%rip)        # 49a0673d <__bss_end+0x491fe73d>
+  802cd9:	20 61 6d             	and    %ah,0x6d(%rcx)
+  802cdc:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  802ce0:	20 25 73 21 0a 00    	and    %ah,0xa2173(%rip)        # 8a4e59 <__bss_end+0x9ce59>
+  802ce6:	3c 75                	cmp    $0x75,%al
+  802ce8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ce9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802ced:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cee:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  802cf2:	30 38                	xor    %bh,(%rax)
+  802cf4:	78 5d                	js     802d53 <__rodata_start+0xc3>
+  802cf6:	20 75 73             	and    %dh,0x73(%rbp)
+  802cf9:	65 72 20             	gs jb  802d1c <__rodata_start+0x8c>
+  802cfc:	70 61                	jo     802d5f <__rodata_start+0xcf>
+  802cfe:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cff:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  802d06:	73 20                	jae    802d28 <__rodata_start+0x98>
+  802d08:	61                   	(bad)
+  802d09:	74 20                	je     802d2b <__rodata_start+0x9b>
+  802d0b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  802d10:	3a 20                	cmp    (%rax),%ah
+  802d12:	00 30                	add    %dh,(%rax)
+  802d14:	31 32                	xor    %esi,(%rdx)
+  802d16:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802d1d:	41                   	rex.B
+  802d1e:	42                   	rex.X
+  802d1f:	43                   	rex.XB
+  802d20:	44                   	rex.R
+  802d21:	45                   	rex.RB
+  802d22:	46 00 30             	rex.RX add %r14b,(%rax)
+  802d25:	31 32                	xor    %esi,(%rdx)
+  802d27:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802d2e:	61                   	(bad)
+  802d2f:	62 63 64 65 66       	(bad)
+  802d34:	00 28                	add    %ch,(%rax)
+  802d36:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d37:	75 6c                	jne    802da5 <__rodata_start+0x115>
+  802d39:	6c                   	insb   (%dx),%es:(%rdi)
+  802d3a:	29 00                	sub    %eax,(%rax)
+  802d3c:	65 72 72             	gs jb  802db1 <__rodata_start+0x121>
+  802d3f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d40:	72 20                	jb     802d62 <__rodata_start+0xd2>
+  802d42:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802d47:	73 70                	jae    802db9 <__rodata_start+0x129>
+  802d49:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802d4d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802d54:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d55:	72 00                	jb     802d57 <__rodata_start+0xc7>
+  802d57:	62 61 64 20 65       	(bad)
+  802d5c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d5d:	76 69                	jbe    802dc8 <__rodata_start+0x138>
+  802d5f:	72 6f                	jb     802dd0 <__rodata_start+0x140>
+  802d61:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d62:	6d                   	insl   (%dx),%es:(%rdi)
+  802d63:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d65:	74 00                	je     802d67 <__rodata_start+0xd7>
+  802d67:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802d6e:	20 70 61             	and    %dh,0x61(%rax)
+  802d71:	72 61                	jb     802dd4 <__rodata_start+0x144>
+  802d73:	6d                   	insl   (%dx),%es:(%rdi)
+  802d74:	65 74 65             	gs je  802ddc <__rodata_start+0x14c>
+  802d77:	72 00                	jb     802d79 <__rodata_start+0xe9>
+  802d79:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d7a:	75 74                	jne    802df0 <__rodata_start+0x160>
+  802d7c:	20 6f 66             	and    %ch,0x66(%rdi)
+  802d7f:	20 6d 65             	and    %ch,0x65(%rbp)
+  802d82:	6d                   	insl   (%dx),%es:(%rdi)
+  802d83:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d84:	72 79                	jb     802dff <__rodata_start+0x16f>
+  802d86:	00 6f 75             	add    %ch,0x75(%rdi)
+  802d89:	74 20                	je     802dab <__rodata_start+0x11b>
+  802d8b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d8c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802d90:	76 69                	jbe    802dfb <__rodata_start+0x16b>
+  802d92:	72 6f                	jb     802e03 <__rodata_start+0x173>
+  802d94:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d95:	6d                   	insl   (%dx),%es:(%rdi)
+  802d96:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d98:	74 73                	je     802e0d <__rodata_start+0x17d>
+  802d9a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802d9d:	72 72                	jb     802e11 <__rodata_start+0x181>
+  802d9f:	75 70                	jne    802e11 <__rodata_start+0x181>
+  802da1:	74 65                	je     802e08 <__rodata_start+0x178>
+  802da3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802da8:	75 67                	jne    802e11 <__rodata_start+0x181>
+  802daa:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802dad:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802daf:	00 73 65             	add    %dh,0x65(%rbx)
+  802db2:	67 6d                	insl   (%dx),%es:(%edi)
+  802db4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802db6:	74 61                	je     802e19 <__rodata_start+0x189>
+  802db8:	74 69                	je     802e23 <__rodata_start+0x193>
+  802dba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dbb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dbc:	20 66 61             	and    %ah,0x61(%rsi)
+  802dbf:	75 6c                	jne    802e2d <__rodata_start+0x19d>
+  802dc1:	74 00                	je     802dc3 <__rodata_start+0x133>
+  802dc3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802dca:	20 45 4c             	and    %al,0x4c(%rbp)
+  802dcd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802dd1:	61                   	(bad)
+  802dd2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802dd7:	20 73 75             	and    %dh,0x75(%rbx)
+  802dda:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802ddd:	73 79                	jae    802e58 <__rodata_start+0x1c8>
+  802ddf:	73 74                	jae    802e55 <__rodata_start+0x1c5>
+  802de1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802de3:	20 63 61             	and    %ah,0x61(%rbx)
+  802de6:	6c                   	insb   (%dx),%es:(%rdi)
+  802de7:	6c                   	insb   (%dx),%es:(%rdi)
+  802de8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802deb:	74 72                	je     802e5f <__rodata_start+0x1cf>
+  802ded:	79 20                	jns    802e0f <__rodata_start+0x17f>
+  802def:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802df0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802df1:	74 20                	je     802e13 <__rodata_start+0x183>
+  802df3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802df5:	75 6e                	jne    802e65 <__rodata_start+0x1d5>
+  802df7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802dfb:	76 20                	jbe    802e1d <__rodata_start+0x18d>
+  802dfd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802e04:	72 65                	jb     802e6b <__rodata_start+0x1db>
+  802e06:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802e09:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e0a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802e0e:	65 78 70             	gs js  802e81 <__rodata_start+0x1f1>
+  802e11:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802e16:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802e19:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802e1d:	20 66 69             	and    %ah,0x69(%rsi)
+  802e20:	6c                   	insb   (%dx),%es:(%rdi)
+  802e21:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802e25:	20 66 72             	and    %ah,0x72(%rsi)
+  802e28:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802e2d:	61                   	(bad)
+  802e2e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802e31:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e32:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e33:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802e37:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802e3a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e3b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e3c:	20 6d 61             	and    %ch,0x61(%rbp)
+  802e3f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e40:	79 20                	jns    802e62 <__rodata_start+0x1d2>
+  802e42:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802e49:	72 65                	jb     802eb0 <__rodata_start+0x220>
+  802e4b:	20 6f 70             	and    %ch,0x70(%rdi)
+  802e4e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e50:	00 66 69             	add    %ah,0x69(%rsi)
+  802e53:	6c                   	insb   (%dx),%es:(%rdi)
+  802e54:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802e58:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802e5b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e5c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802e5f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e60:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e61:	74 20                	je     802e83 <__rodata_start+0x1f3>
+  802e63:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e65:	75 6e                	jne    802ed5 <__rodata_start+0x245>
+  802e67:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802e6b:	76 61                	jbe    802ece <__rodata_start+0x23e>
+  802e6d:	6c                   	insb   (%dx),%es:(%rdi)
+  802e6e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802e75:	00 
+  802e76:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802e7d:	72 65                	jb     802ee4 <__rodata_start+0x254>
+  802e7f:	61                   	(bad)
+  802e80:	64 79 20             	fs jns 802ea3 <__rodata_start+0x213>
+  802e83:	65 78 69             	gs js  802eef <__rodata_start+0x25f>
+  802e86:	73 74                	jae    802efc <__rodata_start+0x26c>
+  802e88:	73 00                	jae    802e8a <__rodata_start+0x1fa>
+  802e8a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e8b:	70 65                	jo     802ef2 <__rodata_start+0x262>
+  802e8d:	72 61                	jb     802ef0 <__rodata_start+0x260>
+  802e8f:	74 69                	je     802efa <__rodata_start+0x26a>
+  802e91:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e92:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e93:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802e96:	74 20                	je     802eb8 <__rodata_start+0x228>
+  802e98:	73 75                	jae    802f0f <__rodata_start+0x27f>
+  802e9a:	70 70                	jo     802f0c <__rodata_start+0x27c>
+  802e9c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e9d:	72 74                	jb     802f13 <__rodata_start+0x283>
+  802e9f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802ea4:	65 72 61             	gs jb  802f08 <__rodata_start+0x278>
+  802ea7:	74 69                	je     802f12 <__rodata_start+0x282>
+  802ea9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eaa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802eab:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802eae:	74 20                	je     802ed0 <__rodata_start+0x240>
+  802eb0:	70 65                	jo     802f17 <__rodata_start+0x287>
+  802eb2:	72 6d                	jb     802f21 <__rodata_start+0x291>
+  802eb4:	69 74 74 65 64 00 66 	imul   $0xf660064,0x65(%rsp,%rsi,2),%esi
+  802ebb:	0f 
+  802ebc:	1f                   	(bad)
+  802ebd:	44 00 00             	add    %r8b,(%rax)
+  802ec0:	a9 05 80 00 00       	test   $0x8005,%eax
+  802ec5:	00 00                	add    %al,(%rax)
+  802ec7:	00 ea                	add    %ch,%dl
+  802ec9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802ecf:	00 da                	add    %bl,%dl
+  802ed1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802ed7:	00 ea                	add    %ch,%dl
+  802ed9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802edf:	00 ea                	add    %ch,%dl
+  802ee1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802ee7:	00 ea                	add    %ch,%dl
+  802ee9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802eef:	00 ea                	add    %ch,%dl
+  802ef1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802ef7:	00 c8                	add    %cl,%al
+  802ef9:	05 80 00 00 00       	add    $0x80,%eax
+  802efe:	00 00                	add    %al,(%rax)
+  802f00:	ea                   	(bad)
+  802f01:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802f07:	00 ea                	add    %ch,%dl
+  802f09:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802f0f:	00 bc 05 80 00 00 00 	add    %bh,0x80(%rbp,%rax,1)
+  802f16:	00 00                	add    %al,(%rax)
+  802f18:	36 06                	ss (bad)
+  802f1a:	80 00 00             	addb   $0x0,(%rax)
+  802f1d:	00 00                	add    %al,(%rax)
+  802f1f:	00 ea                	add    %ch,%dl
+  802f21:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802f27:	00 bc 05 80 00 00 00 	add    %bh,0x80(%rbp,%rax,1)
+  802f2e:	00 00                	add    %al,(%rax)
+  802f30:	02 06                	add    (%rsi),%al
+  802f32:	80 00 00             	addb   $0x0,(%rax)
+  802f35:	00 00                	add    %al,(%rax)
+  802f37:	00 02                	add    %al,(%rdx)
+  802f39:	06                   	(bad)
+  802f3a:	80 00 00             	addb   $0x0,(%rax)
+  802f3d:	00 00                	add    %al,(%rax)
+  802f3f:	00 02                	add    %al,(%rdx)
+  802f41:	06                   	(bad)
+  802f42:	80 00 00             	addb   $0x0,(%rax)
+  802f45:	00 00                	add    %al,(%rax)
+  802f47:	00 02                	add    %al,(%rdx)
+  802f49:	06                   	(bad)
+  802f4a:	80 00 00             	addb   $0x0,(%rax)
+  802f4d:	00 00                	add    %al,(%rax)
+  802f4f:	00 02                	add    %al,(%rdx)
+  802f51:	06                   	(bad)
+  802f52:	80 00 00             	addb   $0x0,(%rax)
+  802f55:	00 00                	add    %al,(%rax)
+  802f57:	00 02                	add    %al,(%rdx)
+  802f59:	06                   	(bad)
+  802f5a:	80 00 00             	addb   $0x0,(%rax)
+  802f5d:	00 00                	add    %al,(%rax)
+  802f5f:	00 02                	add    %al,(%rdx)
+  802f61:	06                   	(bad)
+  802f62:	80 00 00             	addb   $0x0,(%rax)
+  802f65:	00 00                	add    %al,(%rax)
+  802f67:	00 02                	add    %al,(%rdx)
+  802f69:	06                   	(bad)
+  802f6a:	80 00 00             	addb   $0x0,(%rax)
+  802f6d:	00 00                	add    %al,(%rax)
+  802f6f:	00 02                	add    %al,(%rdx)
+  802f71:	06                   	(bad)
+  802f72:	80 00 00             	addb   $0x0,(%rax)
+  802f75:	00 00                	add    %al,(%rax)
+  802f77:	00 ea                	add    %ch,%dl
+  802f79:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802f7f:	00 ea                	add    %ch,%dl
+  802f81:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802f87:	00 ea                	add    %ch,%dl
+  802f89:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802f8f:	00 ea                	add    %ch,%dl
+  802f91:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802f97:	00 ea                	add    %ch,%dl
+  802f99:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802f9f:	00 ea                	add    %ch,%dl
+  802fa1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802fa7:	00 ea                	add    %ch,%dl
+  802fa9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802faf:	00 ea                	add    %ch,%dl
+  802fb1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802fb7:	00 ea                	add    %ch,%dl
+  802fb9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802fbf:	00 ea                	add    %ch,%dl
+  802fc1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802fc7:	00 ea                	add    %ch,%dl
+  802fc9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802fcf:	00 ea                	add    %ch,%dl
+  802fd1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802fd7:	00 ea                	add    %ch,%dl
+  802fd9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802fdf:	00 ea                	add    %ch,%dl
+  802fe1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802fe7:	00 ea                	add    %ch,%dl
+  802fe9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802fef:	00 ea                	add    %ch,%dl
+  802ff1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802ff7:	00 ea                	add    %ch,%dl
+  802ff9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802fff:	00 ea                	add    %ch,%dl
+  803001:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803007:	00 ea                	add    %ch,%dl
+  803009:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80300f:	00 ea                	add    %ch,%dl
+  803011:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803017:	00 ea                	add    %ch,%dl
+  803019:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80301f:	00 ea                	add    %ch,%dl
+  803021:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803027:	00 ea                	add    %ch,%dl
+  803029:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80302f:	00 ea                	add    %ch,%dl
+  803031:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803037:	00 ea                	add    %ch,%dl
+  803039:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80303f:	00 ea                	add    %ch,%dl
+  803041:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803047:	00 ea                	add    %ch,%dl
+  803049:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80304f:	00 ea                	add    %ch,%dl
+  803051:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803057:	00 ea                	add    %ch,%dl
+  803059:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80305f:	00 ea                	add    %ch,%dl
+  803061:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803067:	00 0d 0b 80 00 00    	add    %cl,0x800b(%rip)        # 80b078 <__bss_end+0x3078>
+  80306d:	00 00                	add    %al,(%rax)
+  80306f:	00 ea                	add    %ch,%dl
+  803071:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803077:	00 ea                	add    %ch,%dl
+  803079:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80307f:	00 ea                	add    %ch,%dl
+  803081:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803087:	00 ea                	add    %ch,%dl
+  803089:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80308f:	00 ea                	add    %ch,%dl
+  803091:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803097:	00 ea                	add    %ch,%dl
+  803099:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80309f:	00 ea                	add    %ch,%dl
+  8030a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030a7:	00 ea                	add    %ch,%dl
+  8030a9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030af:	00 ea                	add    %ch,%dl
+  8030b1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030b7:	00 ea                	add    %ch,%dl
+  8030b9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030bf:	00 59 06             	add    %bl,0x6(%rcx)
+  8030c2:	80 00 00             	addb   $0x0,(%rax)
+  8030c5:	00 00                	add    %al,(%rax)
+  8030c7:	00 28                	add    %ch,(%rax)
+  8030c9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8030cf:	00 ea                	add    %ch,%dl
+  8030d1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030d7:	00 ea                	add    %ch,%dl
+  8030d9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030df:	00 ea                	add    %ch,%dl
+  8030e1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030e7:	00 ea                	add    %ch,%dl
+  8030e9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030ef:	00 88 06 80 00 00    	add    %cl,0x8006(%rax)
+  8030f5:	00 00                	add    %al,(%rax)
+  8030f7:	00 ea                	add    %ch,%dl
+  8030f9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030ff:	00 ea                	add    %ch,%dl
+  803101:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803107:	00 4e 06             	add    %cl,0x6(%rsi)
+  80310a:	80 00 00             	addb   $0x0,(%rax)
+  80310d:	00 00                	add    %al,(%rax)
+  80310f:	00 ea                	add    %ch,%dl
+  803111:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803117:	00 ea                	add    %ch,%dl
+  803119:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80311f:	00 d0                	add    %dl,%al
+  803121:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803127:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  80312d:	00 00                	add    %al,(%rax)
+  80312f:	00 ea                	add    %ch,%dl
+  803131:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803137:	00 ea                	add    %ch,%dl
+  803139:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80313f:	00 1f                	add    %bl,(%rdi)
+  803141:	07                   	(bad)
+  803142:	80 00 00             	addb   $0x0,(%rax)
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 ea                	add    %ch,%dl
+  803149:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80314f:	00 fc                	add    %bh,%ah
+  803151:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803157:	00 ea                	add    %ch,%dl
+  803159:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80315f:	00 ea                	add    %ch,%dl
+  803161:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803167:	00 0d 0b 80 00 00    	add    %cl,0x800b(%rip)        # 80b178 <__bss_end+0x3178>
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 ea                	add    %ch,%dl
+  803171:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803177:	00 b2 05 80 00 00    	add    %dh,0x8005(%rdx)
+  80317d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803180 <error_string>:
+	...
+  803188:	45 2d 80 00 00 00 00 00 57 2d 80 00 00 00 00 00     E-......W-......
+  803198:	67 2d 80 00 00 00 00 00 79 2d 80 00 00 00 00 00     g-......y-......
+  8031a8:	87 2d 80 00 00 00 00 00 9b 2d 80 00 00 00 00 00     .-.......-......
+  8031b8:	b0 2d 80 00 00 00 00 00 c3 2d 80 00 00 00 00 00     .-.......-......
+  8031c8:	d5 2d 80 00 00 00 00 00 e9 2d 80 00 00 00 00 00     .-.......-......
+  8031d8:	f9 2d 80 00 00 00 00 00 0c 2e 80 00 00 00 00 00     .-..............
+  8031e8:	23 2e 80 00 00 00 00 00 39 2e 80 00 00 00 00 00     #.......9.......
+  8031f8:	51 2e 80 00 00 00 00 00 69 2e 80 00 00 00 00 00     Q.......i.......
+  803208:	76 2e 80 00 00 00 00 00 30 32 80 00 00 00 00 00     v.......02......
+  803218:	8a 2e 80 00 00 00 00 00 00 00 00 00 00 00 00 00     ................
+  803228:	a2 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ........file is 
+  803238:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803248:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803258:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803268:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803278:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803288:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803298:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8032a8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8032b8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8032c8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8032d8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8032e8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8032f8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803300 <devtab>:
+  803300:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803310:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803320:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803330:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803340:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803350:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803360:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803370:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803380:	69 70 63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64     ipc_send: failed
+  803390:	20 74 6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63      to send.lib/ipc
+  8033a0:	2e 63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     .c.f.........f..
+  8033b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8033f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803400:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803410:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803420:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803430:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803440:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803450:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803460:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803470:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803480:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803490:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803500:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803510:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803520:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803530:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803540:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803550:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803560:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803570:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803580:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803590:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803600:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803610:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803620:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803630:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803640:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803650:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803660:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803670:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803680:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803690:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803700:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803710:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803720:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803730:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803740:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803750:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803760:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803770:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803780:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803790:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
@@ -0,0 +1,5450 @@
+
+obj/user/echo:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 f0 00 00 00       	call   800113 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    int i, nflag;
+
+    nflag = 0;
+    if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800036:	83 ff 01             	cmp    $0x1,%edi
+  800039:	7f 25                	jg     800060 <umain+0x3b>
+        if (i > 1)
+            write(1, " ", 1);
+        write(1, argv[i], strlen(argv[i]));
+    }
+    if (!nflag)
+        write(1, "\n", 1);
+  80003b:	ba 01 00 00 00       	mov    $0x1,%edx
+  800040:	48 be 9b 2c 80 00 00 	movabs $0x802c9b,%rsi
+  800047:	00 00 00 
+  80004a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80004f:	48 b8 0d 12 80 00 00 	movabs $0x80120d,%rax
+  800056:	00 00 00 
+  800059:	ff d0                	call   *%rax
+}
+  80005b:	e9 a4 00 00 00       	jmp    800104 <umain+0xdf>
+  800060:	41 89 fe             	mov    %edi,%r14d
+  800063:	49 89 f4             	mov    %rsi,%r12
+    if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800066:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  80006a:	48 be 00 2c 80 00 00 	movabs $0x802c00,%rsi
+  800071:	00 00 00 
+  800074:	48 b8 bf 02 80 00 00 	movabs $0x8002bf,%rax
+  80007b:	00 00 00 
+  80007e:	ff d0                	call   *%rax
+  800080:	85 c0                	test   %eax,%eax
+  800082:	75 30                	jne    8000b4 <umain+0x8f>
+        argc--;
+  800084:	41 83 ee 01          	sub    $0x1,%r14d
+        argv++;
+  800088:	49 83 c4 08          	add    $0x8,%r12
+    for (i = 1; i < argc; i++) {
+  80008c:	41 83 fe 01          	cmp    $0x1,%r14d
+  800090:	7e 72                	jle    800104 <umain+0xdf>
+        nflag = 1;
+  800092:	c7 45 cc 01 00 00 00 	movl   $0x1,-0x34(%rbp)
+  800099:	bb 01 00 00 00       	mov    $0x1,%ebx
+            write(1, " ", 1);
+  80009e:	49 bd 0d 12 80 00 00 	movabs $0x80120d,%r13
+  8000a5:	00 00 00 
+        write(1, argv[i], strlen(argv[i]));
+  8000a8:	49 bf dd 01 80 00 00 	movabs $0x8001dd,%r15
+  8000af:	00 00 00 
+  8000b2:	eb 28                	jmp    8000dc <umain+0xb7>
+    nflag = 0;
+  8000b4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8000bb:	eb dc                	jmp    800099 <umain+0x74>
+        write(1, argv[i], strlen(argv[i]));
+  8000bd:	49 8b 3c dc          	mov    (%r12,%rbx,8),%rdi
+  8000c1:	41 ff d7             	call   *%r15
+  8000c4:	48 89 c2             	mov    %rax,%rdx
+  8000c7:	49 8b 34 dc          	mov    (%r12,%rbx,8),%rsi
+  8000cb:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000d0:	41 ff d5             	call   *%r13
+    for (i = 1; i < argc; i++) {
+  8000d3:	48 83 c3 01          	add    $0x1,%rbx
+  8000d7:	41 39 de             	cmp    %ebx,%r14d
+  8000da:	7e 1e                	jle    8000fa <umain+0xd5>
+        if (i > 1)
+  8000dc:	83 fb 01             	cmp    $0x1,%ebx
+  8000df:	7e dc                	jle    8000bd <umain+0x98>
+            write(1, " ", 1);
+  8000e1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8000e6:	48 be 03 2c 80 00 00 	movabs $0x802c03,%rsi
+  8000ed:	00 00 00 
+  8000f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000f5:	41 ff d5             	call   *%r13
+  8000f8:	eb c3                	jmp    8000bd <umain+0x98>
+    if (!nflag)
+  8000fa:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8000fe:	0f 84 37 ff ff ff    	je     80003b <umain+0x16>
+}
+  800104:	48 83 c4 18          	add    $0x18,%rsp
+  800108:	5b                   	pop    %rbx
+  800109:	41 5c                	pop    %r12
+  80010b:	41 5d                	pop    %r13
+  80010d:	41 5e                	pop    %r14
+  80010f:	41 5f                	pop    %r15
+  800111:	5d                   	pop    %rbp
+  800112:	c3                   	ret
+
+0000000000800113 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800113:	55                   	push   %rbp
+  800114:	48 89 e5             	mov    %rsp,%rbp
+  800117:	41 56                	push   %r14
+  800119:	41 55                	push   %r13
+  80011b:	41 54                	push   %r12
+  80011d:	53                   	push   %rbx
+  80011e:	41 89 fd             	mov    %edi,%r13d
+  800121:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800124:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80012b:	00 00 00 
+  80012e:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800135:	00 00 00 
+  800138:	48 39 c2             	cmp    %rax,%rdx
+  80013b:	73 17                	jae    800154 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80013d:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800140:	49 89 c4             	mov    %rax,%r12
+  800143:	48 83 c3 08          	add    $0x8,%rbx
+  800147:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014c:	ff 53 f8             	call   *-0x8(%rbx)
+  80014f:	4c 39 e3             	cmp    %r12,%rbx
+  800152:	72 ef                	jb     800143 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800154:	48 b8 0b 07 80 00 00 	movabs $0x80070b,%rax
+  80015b:	00 00 00 
+  80015e:	ff d0                	call   *%rax
+  800160:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800163:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80016a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800171:	00 00 00 
+  800174:	48 01 d0             	add    %rdx,%rax
+  800177:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80017e:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800181:	45 85 ed             	test   %r13d,%r13d
+  800184:	7e 0d                	jle    800193 <libmain+0x80>
+  800186:	49 8b 06             	mov    (%r14),%rax
+  800189:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800190:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800193:	4c 89 f6             	mov    %r14,%rsi
+  800196:	44 89 ef             	mov    %r13d,%edi
+  800199:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001a0:	00 00 00 
+  8001a3:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001a5:	48 b8 ba 01 80 00 00 	movabs $0x8001ba,%rax
+  8001ac:	00 00 00 
+  8001af:	ff d0                	call   *%rax
+#endif
+}
+  8001b1:	5b                   	pop    %rbx
+  8001b2:	41 5c                	pop    %r12
+  8001b4:	41 5d                	pop    %r13
+  8001b6:	41 5e                	pop    %r14
+  8001b8:	5d                   	pop    %rbp
+  8001b9:	c3                   	ret
+
+00000000008001ba <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001ba:	55                   	push   %rbp
+  8001bb:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001be:	48 b8 93 0f 80 00 00 	movabs $0x800f93,%rax
+  8001c5:	00 00 00 
+  8001c8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001cf:	48 b8 a0 06 80 00 00 	movabs $0x8006a0,%rax
+  8001d6:	00 00 00 
+  8001d9:	ff d0                	call   *%rax
+}
+  8001db:	5d                   	pop    %rbp
+  8001dc:	c3                   	ret
+
+00000000008001dd <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8001dd:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8001e0:	74 10                	je     8001f2 <strlen+0x15>
+    size_t n = 0;
+  8001e2:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8001e7:	48 83 c0 01          	add    $0x1,%rax
+  8001eb:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8001ef:	75 f6                	jne    8001e7 <strlen+0xa>
+  8001f1:	c3                   	ret
+    size_t n = 0;
+  8001f2:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8001f7:	c3                   	ret
+
+00000000008001f8 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8001f8:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8001fb:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800200:	48 85 f6             	test   %rsi,%rsi
+  800203:	74 11                	je     800216 <strnlen+0x1e>
+  800205:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800209:	74 0c                	je     800217 <strnlen+0x1f>
+  80020b:	48 83 c2 01          	add    $0x1,%rdx
+  80020f:	48 39 d0             	cmp    %rdx,%rax
+  800212:	75 f1                	jne    800205 <strnlen+0xd>
+  800214:	eb 04                	jmp    80021a <strnlen+0x22>
+  800216:	c3                   	ret
+  800217:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80021a:	c3                   	ret
+
+000000000080021b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80021b:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80021e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800223:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800227:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80022a:	48 83 c2 01          	add    $0x1,%rdx
+  80022e:	84 c9                	test   %cl,%cl
+  800230:	75 f1                	jne    800223 <strcpy+0x8>
+        ;
+    return res;
+}
+  800232:	c3                   	ret
+
+0000000000800233 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800233:	55                   	push   %rbp
+  800234:	48 89 e5             	mov    %rsp,%rbp
+  800237:	41 54                	push   %r12
+  800239:	53                   	push   %rbx
+  80023a:	48 89 fb             	mov    %rdi,%rbx
+  80023d:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800240:	48 b8 dd 01 80 00 00 	movabs $0x8001dd,%rax
+  800247:	00 00 00 
+  80024a:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80024c:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800250:	4c 89 e6             	mov    %r12,%rsi
+  800253:	48 b8 1b 02 80 00 00 	movabs $0x80021b,%rax
+  80025a:	00 00 00 
+  80025d:	ff d0                	call   *%rax
+    return dst;
+}
+  80025f:	48 89 d8             	mov    %rbx,%rax
+  800262:	5b                   	pop    %rbx
+  800263:	41 5c                	pop    %r12
+  800265:	5d                   	pop    %rbp
+  800266:	c3                   	ret
+
+0000000000800267 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800267:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80026a:	48 85 d2             	test   %rdx,%rdx
+  80026d:	74 1f                	je     80028e <strncpy+0x27>
+  80026f:	48 01 fa             	add    %rdi,%rdx
+  800272:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800275:	48 83 c1 01          	add    $0x1,%rcx
+  800279:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80027d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800281:	41 80 f8 01          	cmp    $0x1,%r8b
+  800285:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800289:	48 39 ca             	cmp    %rcx,%rdx
+  80028c:	75 e7                	jne    800275 <strncpy+0xe>
+    }
+    return ret;
+}
+  80028e:	c3                   	ret
+
+000000000080028f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80028f:	48 89 f8             	mov    %rdi,%rax
+  800292:	48 85 d2             	test   %rdx,%rdx
+  800295:	74 24                	je     8002bb <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800297:	48 83 ea 01          	sub    $0x1,%rdx
+  80029b:	74 1b                	je     8002b8 <strlcpy+0x29>
+  80029d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8002a1:	0f b6 16             	movzbl (%rsi),%edx
+  8002a4:	84 d2                	test   %dl,%dl
+  8002a6:	74 10                	je     8002b8 <strlcpy+0x29>
+            *dst++ = *src++;
+  8002a8:	48 83 c6 01          	add    $0x1,%rsi
+  8002ac:	48 83 c0 01          	add    $0x1,%rax
+  8002b0:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8002b3:	48 39 c8             	cmp    %rcx,%rax
+  8002b6:	75 e9                	jne    8002a1 <strlcpy+0x12>
+        *dst = '\0';
+  8002b8:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8002bb:	48 29 f8             	sub    %rdi,%rax
+}
+  8002be:	c3                   	ret
+
+00000000008002bf <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8002bf:	0f b6 07             	movzbl (%rdi),%eax
+  8002c2:	84 c0                	test   %al,%al
+  8002c4:	74 13                	je     8002d9 <strcmp+0x1a>
+  8002c6:	38 06                	cmp    %al,(%rsi)
+  8002c8:	75 0f                	jne    8002d9 <strcmp+0x1a>
+  8002ca:	48 83 c7 01          	add    $0x1,%rdi
+  8002ce:	48 83 c6 01          	add    $0x1,%rsi
+  8002d2:	0f b6 07             	movzbl (%rdi),%eax
+  8002d5:	84 c0                	test   %al,%al
+  8002d7:	75 ed                	jne    8002c6 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8002d9:	0f b6 c0             	movzbl %al,%eax
+  8002dc:	0f b6 16             	movzbl (%rsi),%edx
+  8002df:	29 d0                	sub    %edx,%eax
+}
+  8002e1:	c3                   	ret
+
+00000000008002e2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8002e2:	48 85 d2             	test   %rdx,%rdx
+  8002e5:	74 1f                	je     800306 <strncmp+0x24>
+  8002e7:	0f b6 07             	movzbl (%rdi),%eax
+  8002ea:	84 c0                	test   %al,%al
+  8002ec:	74 1e                	je     80030c <strncmp+0x2a>
+  8002ee:	3a 06                	cmp    (%rsi),%al
+  8002f0:	75 1a                	jne    80030c <strncmp+0x2a>
+  8002f2:	48 83 c7 01          	add    $0x1,%rdi
+  8002f6:	48 83 c6 01          	add    $0x1,%rsi
+  8002fa:	48 83 ea 01          	sub    $0x1,%rdx
+  8002fe:	75 e7                	jne    8002e7 <strncmp+0x5>
+
+    if (!n) return 0;
+  800300:	b8 00 00 00 00       	mov    $0x0,%eax
+  800305:	c3                   	ret
+  800306:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030b:	c3                   	ret
+  80030c:	48 85 d2             	test   %rdx,%rdx
+  80030f:	74 09                	je     80031a <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800311:	0f b6 07             	movzbl (%rdi),%eax
+  800314:	0f b6 16             	movzbl (%rsi),%edx
+  800317:	29 d0                	sub    %edx,%eax
+  800319:	c3                   	ret
+    if (!n) return 0;
+  80031a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80031f:	c3                   	ret
+
+0000000000800320 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800320:	0f b6 17             	movzbl (%rdi),%edx
+  800323:	84 d2                	test   %dl,%dl
+  800325:	74 18                	je     80033f <strchr+0x1f>
+        if (*str == c) {
+  800327:	0f be d2             	movsbl %dl,%edx
+  80032a:	39 f2                	cmp    %esi,%edx
+  80032c:	74 17                	je     800345 <strchr+0x25>
+    for (; *str; str++) {
+  80032e:	48 83 c7 01          	add    $0x1,%rdi
+  800332:	0f b6 17             	movzbl (%rdi),%edx
+  800335:	84 d2                	test   %dl,%dl
+  800337:	75 ee                	jne    800327 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800339:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033e:	c3                   	ret
+  80033f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800344:	c3                   	ret
+  800345:	48 89 f8             	mov    %rdi,%rax
+}
+  800348:	c3                   	ret
+
+0000000000800349 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800349:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80034c:	0f b6 17             	movzbl (%rdi),%edx
+  80034f:	84 d2                	test   %dl,%dl
+  800351:	74 13                	je     800366 <strfind+0x1d>
+  800353:	0f be d2             	movsbl %dl,%edx
+  800356:	39 f2                	cmp    %esi,%edx
+  800358:	74 0b                	je     800365 <strfind+0x1c>
+  80035a:	48 83 c0 01          	add    $0x1,%rax
+  80035e:	0f b6 10             	movzbl (%rax),%edx
+  800361:	84 d2                	test   %dl,%dl
+  800363:	75 ee                	jne    800353 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800365:	c3                   	ret
+  800366:	c3                   	ret
+
+0000000000800367 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800367:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80036a:	48 89 f8             	mov    %rdi,%rax
+  80036d:	48 f7 d8             	neg    %rax
+  800370:	83 e0 07             	and    $0x7,%eax
+  800373:	49 89 d1             	mov    %rdx,%r9
+  800376:	49 29 c1             	sub    %rax,%r9
+  800379:	78 36                	js     8003b1 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80037b:	40 0f b6 c6          	movzbl %sil,%eax
+  80037f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800386:	01 01 01 
+  800389:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80038d:	40 f6 c7 07          	test   $0x7,%dil
+  800391:	75 38                	jne    8003cb <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800393:	4c 89 c9             	mov    %r9,%rcx
+  800396:	48 c1 f9 03          	sar    $0x3,%rcx
+  80039a:	74 0c                	je     8003a8 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80039c:	fc                   	cld
+  80039d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8003a0:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8003a4:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8003a8:	4d 85 c9             	test   %r9,%r9
+  8003ab:	75 45                	jne    8003f2 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8003ad:	4c 89 c0             	mov    %r8,%rax
+  8003b0:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8003b1:	48 85 d2             	test   %rdx,%rdx
+  8003b4:	74 f7                	je     8003ad <memset+0x46>
+  8003b6:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8003b9:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8003bc:	48 83 c0 01          	add    $0x1,%rax
+  8003c0:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8003c4:	48 39 c2             	cmp    %rax,%rdx
+  8003c7:	75 f3                	jne    8003bc <memset+0x55>
+  8003c9:	eb e2                	jmp    8003ad <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8003cb:	40 f6 c7 01          	test   $0x1,%dil
+  8003cf:	74 06                	je     8003d7 <memset+0x70>
+  8003d1:	88 07                	mov    %al,(%rdi)
+  8003d3:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8003d7:	40 f6 c7 02          	test   $0x2,%dil
+  8003db:	74 07                	je     8003e4 <memset+0x7d>
+  8003dd:	66 89 07             	mov    %ax,(%rdi)
+  8003e0:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8003e4:	40 f6 c7 04          	test   $0x4,%dil
+  8003e8:	74 a9                	je     800393 <memset+0x2c>
+  8003ea:	89 07                	mov    %eax,(%rdi)
+  8003ec:	48 83 c7 04          	add    $0x4,%rdi
+  8003f0:	eb a1                	jmp    800393 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8003f2:	41 f6 c1 04          	test   $0x4,%r9b
+  8003f6:	74 06                	je     8003fe <memset+0x97>
+  8003f8:	89 07                	mov    %eax,(%rdi)
+  8003fa:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8003fe:	41 f6 c1 02          	test   $0x2,%r9b
+  800402:	74 07                	je     80040b <memset+0xa4>
+  800404:	66 89 07             	mov    %ax,(%rdi)
+  800407:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80040b:	41 f6 c1 01          	test   $0x1,%r9b
+  80040f:	74 9c                	je     8003ad <memset+0x46>
+  800411:	88 07                	mov    %al,(%rdi)
+  800413:	eb 98                	jmp    8003ad <memset+0x46>
+
+0000000000800415 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800415:	48 89 f8             	mov    %rdi,%rax
+  800418:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80041b:	48 39 fe             	cmp    %rdi,%rsi
+  80041e:	73 3b                	jae    80045b <memmove+0x46>
+  800420:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800424:	48 39 d7             	cmp    %rdx,%rdi
+  800427:	73 32                	jae    80045b <memmove+0x46>
+        s += n;
+        d += n;
+  800429:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80042d:	48 89 d6             	mov    %rdx,%rsi
+  800430:	48 09 fe             	or     %rdi,%rsi
+  800433:	48 09 ce             	or     %rcx,%rsi
+  800436:	40 f6 c6 07          	test   $0x7,%sil
+  80043a:	75 12                	jne    80044e <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80043c:	48 83 ef 08          	sub    $0x8,%rdi
+  800440:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800444:	48 c1 e9 03          	shr    $0x3,%rcx
+  800448:	fd                   	std
+  800449:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80044c:	fc                   	cld
+  80044d:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80044e:	48 83 ef 01          	sub    $0x1,%rdi
+  800452:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800456:	fd                   	std
+  800457:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800459:	eb f1                	jmp    80044c <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80045b:	48 89 f2             	mov    %rsi,%rdx
+  80045e:	48 09 c2             	or     %rax,%rdx
+  800461:	48 09 ca             	or     %rcx,%rdx
+  800464:	f6 c2 07             	test   $0x7,%dl
+  800467:	75 0c                	jne    800475 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800469:	48 c1 e9 03          	shr    $0x3,%rcx
+  80046d:	48 89 c7             	mov    %rax,%rdi
+  800470:	fc                   	cld
+  800471:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800474:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800475:	48 89 c7             	mov    %rax,%rdi
+  800478:	fc                   	cld
+  800479:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80047b:	c3                   	ret
+
+000000000080047c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80047c:	55                   	push   %rbp
+  80047d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800480:	48 b8 15 04 80 00 00 	movabs $0x800415,%rax
+  800487:	00 00 00 
+  80048a:	ff d0                	call   *%rax
+}
+  80048c:	5d                   	pop    %rbp
+  80048d:	c3                   	ret
+
+000000000080048e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80048e:	55                   	push   %rbp
+  80048f:	48 89 e5             	mov    %rsp,%rbp
+  800492:	41 57                	push   %r15
+  800494:	41 56                	push   %r14
+  800496:	41 55                	push   %r13
+  800498:	41 54                	push   %r12
+  80049a:	53                   	push   %rbx
+  80049b:	48 83 ec 08          	sub    $0x8,%rsp
+  80049f:	49 89 fe             	mov    %rdi,%r14
+  8004a2:	49 89 f7             	mov    %rsi,%r15
+  8004a5:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8004a8:	48 89 f7             	mov    %rsi,%rdi
+  8004ab:	48 b8 dd 01 80 00 00 	movabs $0x8001dd,%rax
+  8004b2:	00 00 00 
+  8004b5:	ff d0                	call   *%rax
+  8004b7:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8004ba:	48 89 de             	mov    %rbx,%rsi
+  8004bd:	4c 89 f7             	mov    %r14,%rdi
+  8004c0:	48 b8 f8 01 80 00 00 	movabs $0x8001f8,%rax
+  8004c7:	00 00 00 
+  8004ca:	ff d0                	call   *%rax
+  8004cc:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8004cf:	48 39 c3             	cmp    %rax,%rbx
+  8004d2:	74 36                	je     80050a <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8004d4:	48 89 d8             	mov    %rbx,%rax
+  8004d7:	4c 29 e8             	sub    %r13,%rax
+  8004da:	49 39 c4             	cmp    %rax,%r12
+  8004dd:	73 31                	jae    800510 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8004df:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8004e4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8004e8:	4c 89 fe             	mov    %r15,%rsi
+  8004eb:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  8004f2:	00 00 00 
+  8004f5:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8004f7:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8004fb:	48 83 c4 08          	add    $0x8,%rsp
+  8004ff:	5b                   	pop    %rbx
+  800500:	41 5c                	pop    %r12
+  800502:	41 5d                	pop    %r13
+  800504:	41 5e                	pop    %r14
+  800506:	41 5f                	pop    %r15
+  800508:	5d                   	pop    %rbp
+  800509:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80050a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80050e:	eb eb                	jmp    8004fb <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800510:	48 83 eb 01          	sub    $0x1,%rbx
+  800514:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800518:	48 89 da             	mov    %rbx,%rdx
+  80051b:	4c 89 fe             	mov    %r15,%rsi
+  80051e:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  800525:	00 00 00 
+  800528:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80052a:	49 01 de             	add    %rbx,%r14
+  80052d:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800532:	eb c3                	jmp    8004f7 <strlcat+0x69>
+
+0000000000800534 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800534:	48 85 d2             	test   %rdx,%rdx
+  800537:	74 2d                	je     800566 <memcmp+0x32>
+  800539:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80053e:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800542:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800547:	44 38 c1             	cmp    %r8b,%cl
+  80054a:	75 0f                	jne    80055b <memcmp+0x27>
+    while (n-- > 0) {
+  80054c:	48 83 c0 01          	add    $0x1,%rax
+  800550:	48 39 c2             	cmp    %rax,%rdx
+  800553:	75 e9                	jne    80053e <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800555:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055a:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80055b:	0f b6 c1             	movzbl %cl,%eax
+  80055e:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800562:	44 29 c0             	sub    %r8d,%eax
+  800565:	c3                   	ret
+    return 0;
+  800566:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80056b:	c3                   	ret
+
+000000000080056c <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80056c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800570:	48 39 c7             	cmp    %rax,%rdi
+  800573:	73 0f                	jae    800584 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800575:	40 38 37             	cmp    %sil,(%rdi)
+  800578:	74 0e                	je     800588 <memfind+0x1c>
+    for (; src < end; src++) {
+  80057a:	48 83 c7 01          	add    $0x1,%rdi
+  80057e:	48 39 f8             	cmp    %rdi,%rax
+  800581:	75 f2                	jne    800575 <memfind+0x9>
+  800583:	c3                   	ret
+  800584:	48 89 f8             	mov    %rdi,%rax
+  800587:	c3                   	ret
+  800588:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80058b:	c3                   	ret
+
+000000000080058c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80058c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80058f:	0f b6 37             	movzbl (%rdi),%esi
+  800592:	40 80 fe 20          	cmp    $0x20,%sil
+  800596:	74 06                	je     80059e <strtol+0x12>
+  800598:	40 80 fe 09          	cmp    $0x9,%sil
+  80059c:	75 13                	jne    8005b1 <strtol+0x25>
+  80059e:	48 83 c7 01          	add    $0x1,%rdi
+  8005a2:	0f b6 37             	movzbl (%rdi),%esi
+  8005a5:	40 80 fe 20          	cmp    $0x20,%sil
+  8005a9:	74 f3                	je     80059e <strtol+0x12>
+  8005ab:	40 80 fe 09          	cmp    $0x9,%sil
+  8005af:	74 ed                	je     80059e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8005b1:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8005b4:	83 e0 fd             	and    $0xfffffffd,%eax
+  8005b7:	3c 01                	cmp    $0x1,%al
+  8005b9:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8005bd:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8005c3:	75 0f                	jne    8005d4 <strtol+0x48>
+  8005c5:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8005c8:	74 14                	je     8005de <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8005ca:	85 d2                	test   %edx,%edx
+  8005cc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8005d1:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8005d4:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8005d9:	4c 63 ca             	movslq %edx,%r9
+  8005dc:	eb 36                	jmp    800614 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8005de:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8005e2:	74 0f                	je     8005f3 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8005e4:	85 d2                	test   %edx,%edx
+  8005e6:	75 ec                	jne    8005d4 <strtol+0x48>
+        s++;
+  8005e8:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8005ec:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8005f1:	eb e1                	jmp    8005d4 <strtol+0x48>
+        s += 2;
+  8005f3:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8005f7:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8005fc:	eb d6                	jmp    8005d4 <strtol+0x48>
+            dig -= '0';
+  8005fe:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800601:	44 0f b6 c1          	movzbl %cl,%r8d
+  800605:	41 39 d0             	cmp    %edx,%r8d
+  800608:	7d 21                	jge    80062b <strtol+0x9f>
+        val = val * base + dig;
+  80060a:	49 0f af c1          	imul   %r9,%rax
+  80060e:	0f b6 c9             	movzbl %cl,%ecx
+  800611:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800614:	48 83 c7 01          	add    $0x1,%rdi
+  800618:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80061c:	80 f9 39             	cmp    $0x39,%cl
+  80061f:	76 dd                	jbe    8005fe <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800621:	80 f9 7b             	cmp    $0x7b,%cl
+  800624:	77 05                	ja     80062b <strtol+0x9f>
+            dig -= 'a' - 10;
+  800626:	83 e9 57             	sub    $0x57,%ecx
+  800629:	eb d6                	jmp    800601 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80062b:	4d 85 d2             	test   %r10,%r10
+  80062e:	74 03                	je     800633 <strtol+0xa7>
+  800630:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800633:	48 89 c2             	mov    %rax,%rdx
+  800636:	48 f7 da             	neg    %rdx
+  800639:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80063d:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800641:	c3                   	ret
+
+0000000000800642 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800642:	55                   	push   %rbp
+  800643:	48 89 e5             	mov    %rsp,%rbp
+  800646:	53                   	push   %rbx
+  800647:	48 89 fa             	mov    %rdi,%rdx
+  80064a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80064d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800652:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800657:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80065c:	be 00 00 00 00       	mov    $0x0,%esi
+  800661:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800667:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800669:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80066d:	c9                   	leave
+  80066e:	c3                   	ret
+
+000000000080066f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80066f:	55                   	push   %rbp
+  800670:	48 89 e5             	mov    %rsp,%rbp
+  800673:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800674:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800679:	ba 00 00 00 00       	mov    $0x0,%edx
+  80067e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800683:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800688:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80068d:	be 00 00 00 00       	mov    $0x0,%esi
+  800692:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800698:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80069a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80069e:	c9                   	leave
+  80069f:	c3                   	ret
+
+00000000008006a0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8006a0:	55                   	push   %rbp
+  8006a1:	48 89 e5             	mov    %rsp,%rbp
+  8006a4:	53                   	push   %rbx
+  8006a5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8006a9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006ac:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006bb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8006c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006cb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8006cd:	48 85 c0             	test   %rax,%rax
+  8006d0:	7f 06                	jg     8006d8 <sys_env_destroy+0x38>
+}
+  8006d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006d6:	c9                   	leave
+  8006d7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006d8:	49 89 c0             	mov    %rax,%r8
+  8006db:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8006e0:	48 ba 10 2c 80 00 00 	movabs $0x802c10,%rdx
+  8006e7:	00 00 00 
+  8006ea:	be 26 00 00 00       	mov    $0x26,%esi
+  8006ef:	48 bf 2f 2c 80 00 00 	movabs $0x802c2f,%rdi
+  8006f6:	00 00 00 
+  8006f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006fe:	49 b9 40 20 80 00 00 	movabs $0x802040,%r9
+  800705:	00 00 00 
+  800708:	41 ff d1             	call   *%r9
+
+000000000080070b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80070b:	55                   	push   %rbp
+  80070c:	48 89 e5             	mov    %rsp,%rbp
+  80070f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800710:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800715:	ba 00 00 00 00       	mov    $0x0,%edx
+  80071a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80071f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800724:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800729:	be 00 00 00 00       	mov    $0x0,%esi
+  80072e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800734:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800736:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80073a:	c9                   	leave
+  80073b:	c3                   	ret
+
+000000000080073c <sys_yield>:
+
+void
+sys_yield(void) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+  800740:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800741:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800746:	ba 00 00 00 00       	mov    $0x0,%edx
+  80074b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800750:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800755:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80075a:	be 00 00 00 00       	mov    $0x0,%esi
+  80075f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800765:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800767:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80076b:	c9                   	leave
+  80076c:	c3                   	ret
+
+000000000080076d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80076d:	55                   	push   %rbp
+  80076e:	48 89 e5             	mov    %rsp,%rbp
+  800771:	53                   	push   %rbx
+  800772:	48 89 fa             	mov    %rdi,%rdx
+  800775:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800778:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80077d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800784:	00 00 00 
+  800787:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80078c:	be 00 00 00 00       	mov    $0x0,%esi
+  800791:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800797:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800799:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80079d:	c9                   	leave
+  80079e:	c3                   	ret
+
+000000000080079f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80079f:	55                   	push   %rbp
+  8007a0:	48 89 e5             	mov    %rsp,%rbp
+  8007a3:	53                   	push   %rbx
+  8007a4:	49 89 f8             	mov    %rdi,%r8
+  8007a7:	48 89 d3             	mov    %rdx,%rbx
+  8007aa:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8007ad:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8007b2:	4c 89 c2             	mov    %r8,%rdx
+  8007b5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8007bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8007c3:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8007c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007c9:	c9                   	leave
+  8007ca:	c3                   	ret
+
+00000000008007cb <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8007cb:	55                   	push   %rbp
+  8007cc:	48 89 e5             	mov    %rsp,%rbp
+  8007cf:	53                   	push   %rbx
+  8007d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8007d4:	89 f8                	mov    %edi,%eax
+  8007d6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8007d9:	48 63 f9             	movslq %ecx,%rdi
+  8007dc:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8007df:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8007e4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8007ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8007f2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8007f4:	48 85 c0             	test   %rax,%rax
+  8007f7:	7f 06                	jg     8007ff <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8007f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007fd:	c9                   	leave
+  8007fe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007ff:	49 89 c0             	mov    %rax,%r8
+  800802:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800807:	48 ba 10 2c 80 00 00 	movabs $0x802c10,%rdx
+  80080e:	00 00 00 
+  800811:	be 26 00 00 00       	mov    $0x26,%esi
+  800816:	48 bf 2f 2c 80 00 00 	movabs $0x802c2f,%rdi
+  80081d:	00 00 00 
+  800820:	b8 00 00 00 00       	mov    $0x0,%eax
+  800825:	49 b9 40 20 80 00 00 	movabs $0x802040,%r9
+  80082c:	00 00 00 
+  80082f:	41 ff d1             	call   *%r9
+
+0000000000800832 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800832:	55                   	push   %rbp
+  800833:	48 89 e5             	mov    %rsp,%rbp
+  800836:	53                   	push   %rbx
+  800837:	48 83 ec 08          	sub    $0x8,%rsp
+  80083b:	89 f8                	mov    %edi,%eax
+  80083d:	49 89 f2             	mov    %rsi,%r10
+  800840:	48 89 cf             	mov    %rcx,%rdi
+  800843:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800846:	48 63 da             	movslq %edx,%rbx
+  800849:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80084c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800851:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800854:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800857:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800859:	48 85 c0             	test   %rax,%rax
+  80085c:	7f 06                	jg     800864 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80085e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800862:	c9                   	leave
+  800863:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800864:	49 89 c0             	mov    %rax,%r8
+  800867:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80086c:	48 ba 10 2c 80 00 00 	movabs $0x802c10,%rdx
+  800873:	00 00 00 
+  800876:	be 26 00 00 00       	mov    $0x26,%esi
+  80087b:	48 bf 2f 2c 80 00 00 	movabs $0x802c2f,%rdi
+  800882:	00 00 00 
+  800885:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088a:	49 b9 40 20 80 00 00 	movabs $0x802040,%r9
+  800891:	00 00 00 
+  800894:	41 ff d1             	call   *%r9
+
+0000000000800897 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800897:	55                   	push   %rbp
+  800898:	48 89 e5             	mov    %rsp,%rbp
+  80089b:	53                   	push   %rbx
+  80089c:	48 83 ec 08          	sub    $0x8,%rsp
+  8008a0:	48 89 f1             	mov    %rsi,%rcx
+  8008a3:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8008a6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8008a9:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8008b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8008b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8008be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8008c0:	48 85 c0             	test   %rax,%rax
+  8008c3:	7f 06                	jg     8008cb <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8008c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008c9:	c9                   	leave
+  8008ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8008cb:	49 89 c0             	mov    %rax,%r8
+  8008ce:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8008d3:	48 ba 10 2c 80 00 00 	movabs $0x802c10,%rdx
+  8008da:	00 00 00 
+  8008dd:	be 26 00 00 00       	mov    $0x26,%esi
+  8008e2:	48 bf 2f 2c 80 00 00 	movabs $0x802c2f,%rdi
+  8008e9:	00 00 00 
+  8008ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f1:	49 b9 40 20 80 00 00 	movabs $0x802040,%r9
+  8008f8:	00 00 00 
+  8008fb:	41 ff d1             	call   *%r9
+
+00000000008008fe <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8008fe:	55                   	push   %rbp
+  8008ff:	48 89 e5             	mov    %rsp,%rbp
+  800902:	53                   	push   %rbx
+  800903:	48 83 ec 08          	sub    $0x8,%rsp
+  800907:	89 f8                	mov    %edi,%eax
+  800909:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  80090c:	48 63 f9             	movslq %ecx,%rdi
+  80090f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800912:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800917:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80091a:	be 00 00 00 00       	mov    $0x0,%esi
+  80091f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800925:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800927:	48 85 c0             	test   %rax,%rax
+  80092a:	7f 06                	jg     800932 <sys_region_advise+0x34>
+}
+  80092c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800930:	c9                   	leave
+  800931:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800932:	49 89 c0             	mov    %rax,%r8
+  800935:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80093a:	48 ba 10 2c 80 00 00 	movabs $0x802c10,%rdx
+  800941:	00 00 00 
+  800944:	be 26 00 00 00       	mov    $0x26,%esi
+  800949:	48 bf 2f 2c 80 00 00 	movabs $0x802c2f,%rdi
+  800950:	00 00 00 
+  800953:	b8 00 00 00 00       	mov    $0x0,%eax
+  800958:	49 b9 40 20 80 00 00 	movabs $0x802040,%r9
+  80095f:	00 00 00 
+  800962:	41 ff d1             	call   *%r9
+
+0000000000800965 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  800965:	55                   	push   %rbp
+  800966:	48 89 e5             	mov    %rsp,%rbp
+  800969:	53                   	push   %rbx
+  80096a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80096e:	48 63 ce             	movslq %esi,%rcx
+  800971:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800974:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800979:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80097e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800983:	be 00 00 00 00       	mov    $0x0,%esi
+  800988:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80098e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800990:	48 85 c0             	test   %rax,%rax
+  800993:	7f 06                	jg     80099b <sys_env_set_nice+0x36>
+}
+  800995:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800999:	c9                   	leave
+  80099a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80099b:	49 89 c0             	mov    %rax,%r8
+  80099e:	b9 15 00 00 00       	mov    $0x15,%ecx
+  8009a3:	48 ba 10 2c 80 00 00 	movabs $0x802c10,%rdx
+  8009aa:	00 00 00 
+  8009ad:	be 26 00 00 00       	mov    $0x26,%esi
+  8009b2:	48 bf 2f 2c 80 00 00 	movabs $0x802c2f,%rdi
+  8009b9:	00 00 00 
+  8009bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c1:	49 b9 40 20 80 00 00 	movabs $0x802040,%r9
+  8009c8:	00 00 00 
+  8009cb:	41 ff d1             	call   *%r9
+
+00000000008009ce <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8009ce:	55                   	push   %rbp
+  8009cf:	48 89 e5             	mov    %rsp,%rbp
+  8009d2:	53                   	push   %rbx
+  8009d3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8009d7:	48 63 ce             	movslq %esi,%rcx
+  8009da:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8009dd:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8009f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8009f9:	48 85 c0             	test   %rax,%rax
+  8009fc:	7f 06                	jg     800a04 <sys_env_set_status+0x36>
+}
+  8009fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a02:	c9                   	leave
+  800a03:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800a04:	49 89 c0             	mov    %rax,%r8
+  800a07:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800a0c:	48 ba 10 2c 80 00 00 	movabs $0x802c10,%rdx
+  800a13:	00 00 00 
+  800a16:	be 26 00 00 00       	mov    $0x26,%esi
+  800a1b:	48 bf 2f 2c 80 00 00 	movabs $0x802c2f,%rdi
+  800a22:	00 00 00 
+  800a25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2a:	49 b9 40 20 80 00 00 	movabs $0x802040,%r9
+  800a31:	00 00 00 
+  800a34:	41 ff d1             	call   *%r9
+
+0000000000800a37 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800a37:	55                   	push   %rbp
+  800a38:	48 89 e5             	mov    %rsp,%rbp
+  800a3b:	53                   	push   %rbx
+  800a3c:	48 83 ec 08          	sub    $0x8,%rsp
+  800a40:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800a43:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800a46:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800a4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a50:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800a55:	be 00 00 00 00       	mov    $0x0,%esi
+  800a5a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800a60:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800a62:	48 85 c0             	test   %rax,%rax
+  800a65:	7f 06                	jg     800a6d <sys_env_set_trapframe+0x36>
+}
+  800a67:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a6b:	c9                   	leave
+  800a6c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800a6d:	49 89 c0             	mov    %rax,%r8
+  800a70:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800a75:	48 ba 10 2c 80 00 00 	movabs $0x802c10,%rdx
+  800a7c:	00 00 00 
+  800a7f:	be 26 00 00 00       	mov    $0x26,%esi
+  800a84:	48 bf 2f 2c 80 00 00 	movabs $0x802c2f,%rdi
+  800a8b:	00 00 00 
+  800a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a93:	49 b9 40 20 80 00 00 	movabs $0x802040,%r9
+  800a9a:	00 00 00 
+  800a9d:	41 ff d1             	call   *%r9
+
+0000000000800aa0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800aa0:	55                   	push   %rbp
+  800aa1:	48 89 e5             	mov    %rsp,%rbp
+  800aa4:	53                   	push   %rbx
+  800aa5:	48 83 ec 08          	sub    $0x8,%rsp
+  800aa9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800aac:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800aaf:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800ab4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ab9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800abe:	be 00 00 00 00       	mov    $0x0,%esi
+  800ac3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800ac9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800acb:	48 85 c0             	test   %rax,%rax
+  800ace:	7f 06                	jg     800ad6 <sys_env_set_pgfault_upcall+0x36>
+}
+  800ad0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ad4:	c9                   	leave
+  800ad5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800ad6:	49 89 c0             	mov    %rax,%r8
+  800ad9:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800ade:	48 ba 10 2c 80 00 00 	movabs $0x802c10,%rdx
+  800ae5:	00 00 00 
+  800ae8:	be 26 00 00 00       	mov    $0x26,%esi
+  800aed:	48 bf 2f 2c 80 00 00 	movabs $0x802c2f,%rdi
+  800af4:	00 00 00 
+  800af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800afc:	49 b9 40 20 80 00 00 	movabs $0x802040,%r9
+  800b03:	00 00 00 
+  800b06:	41 ff d1             	call   *%r9
+
+0000000000800b09 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800b09:	55                   	push   %rbp
+  800b0a:	48 89 e5             	mov    %rsp,%rbp
+  800b0d:	53                   	push   %rbx
+  800b0e:	89 f8                	mov    %edi,%eax
+  800b10:	49 89 f1             	mov    %rsi,%r9
+  800b13:	48 89 d3             	mov    %rdx,%rbx
+  800b16:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800b19:	49 63 f0             	movslq %r8d,%rsi
+  800b1c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800b1f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800b24:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b27:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b2d:	cd 30                	int    $0x30
+}
+  800b2f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b33:	c9                   	leave
+  800b34:	c3                   	ret
+
+0000000000800b35 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800b35:	55                   	push   %rbp
+  800b36:	48 89 e5             	mov    %rsp,%rbp
+  800b39:	53                   	push   %rbx
+  800b3a:	48 83 ec 08          	sub    $0x8,%rsp
+  800b3e:	48 89 fa             	mov    %rdi,%rdx
+  800b41:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800b44:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b4e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b53:	be 00 00 00 00       	mov    $0x0,%esi
+  800b58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b5e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800b60:	48 85 c0             	test   %rax,%rax
+  800b63:	7f 06                	jg     800b6b <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800b65:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b69:	c9                   	leave
+  800b6a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800b6b:	49 89 c0             	mov    %rax,%r8
+  800b6e:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800b73:	48 ba 10 2c 80 00 00 	movabs $0x802c10,%rdx
+  800b7a:	00 00 00 
+  800b7d:	be 26 00 00 00       	mov    $0x26,%esi
+  800b82:	48 bf 2f 2c 80 00 00 	movabs $0x802c2f,%rdi
+  800b89:	00 00 00 
+  800b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b91:	49 b9 40 20 80 00 00 	movabs $0x802040,%r9
+  800b98:	00 00 00 
+  800b9b:	41 ff d1             	call   *%r9
+
+0000000000800b9e <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800b9e:	55                   	push   %rbp
+  800b9f:	48 89 e5             	mov    %rsp,%rbp
+  800ba2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800ba3:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800ba8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bad:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800bb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bb7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800bbc:	be 00 00 00 00       	mov    $0x0,%esi
+  800bc1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800bc7:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800bc9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800bcd:	c9                   	leave
+  800bce:	c3                   	ret
+
+0000000000800bcf <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  800bcf:	55                   	push   %rbp
+  800bd0:	48 89 e5             	mov    %rsp,%rbp
+  800bd3:	53                   	push   %rbx
+  800bd4:	48 83 ec 08          	sub    $0x8,%rsp
+  800bd8:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  800bdb:	48 63 ce             	movslq %esi,%rcx
+  800bde:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800be1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800be6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800beb:	be 00 00 00 00       	mov    $0x0,%esi
+  800bf0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800bf6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800bf8:	48 85 c0             	test   %rax,%rax
+  800bfb:	7f 06                	jg     800c03 <sys_sigqueue+0x34>
+}
+  800bfd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c01:	c9                   	leave
+  800c02:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800c03:	49 89 c0             	mov    %rax,%r8
+  800c06:	b9 10 00 00 00       	mov    $0x10,%ecx
+  800c0b:	48 ba 10 2c 80 00 00 	movabs $0x802c10,%rdx
+  800c12:	00 00 00 
+  800c15:	be 26 00 00 00       	mov    $0x26,%esi
+  800c1a:	48 bf 2f 2c 80 00 00 	movabs $0x802c2f,%rdi
+  800c21:	00 00 00 
+  800c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c29:	49 b9 40 20 80 00 00 	movabs $0x802040,%r9
+  800c30:	00 00 00 
+  800c33:	41 ff d1             	call   *%r9
+
+0000000000800c36 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  800c36:	55                   	push   %rbp
+  800c37:	48 89 e5             	mov    %rsp,%rbp
+  800c3a:	53                   	push   %rbx
+  800c3b:	48 83 ec 08          	sub    $0x8,%rsp
+  800c3f:	48 89 fa             	mov    %rdi,%rdx
+  800c42:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800c45:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c4f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c54:	be 00 00 00 00       	mov    $0x0,%esi
+  800c59:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c5f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800c61:	48 85 c0             	test   %rax,%rax
+  800c64:	7f 06                	jg     800c6c <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  800c66:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c6a:	c9                   	leave
+  800c6b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800c6c:	49 89 c0             	mov    %rax,%r8
+  800c6f:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800c74:	48 ba 10 2c 80 00 00 	movabs $0x802c10,%rdx
+  800c7b:	00 00 00 
+  800c7e:	be 26 00 00 00       	mov    $0x26,%esi
+  800c83:	48 bf 2f 2c 80 00 00 	movabs $0x802c2f,%rdi
+  800c8a:	00 00 00 
+  800c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c92:	49 b9 40 20 80 00 00 	movabs $0x802040,%r9
+  800c99:	00 00 00 
+  800c9c:	41 ff d1             	call   *%r9
+
+0000000000800c9f <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  800c9f:	55                   	push   %rbp
+  800ca0:	48 89 e5             	mov    %rsp,%rbp
+  800ca3:	53                   	push   %rbx
+  800ca4:	48 83 ec 08          	sub    $0x8,%rsp
+  800ca8:	48 89 f1             	mov    %rsi,%rcx
+  800cab:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  800cae:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800cb1:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800cb6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800cbb:	be 00 00 00 00       	mov    $0x0,%esi
+  800cc0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800cc6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800cc8:	48 85 c0             	test   %rax,%rax
+  800ccb:	7f 06                	jg     800cd3 <sys_sigaction+0x34>
+}
+  800ccd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cd1:	c9                   	leave
+  800cd2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800cd3:	49 89 c0             	mov    %rax,%r8
+  800cd6:	b9 12 00 00 00       	mov    $0x12,%ecx
+  800cdb:	48 ba 10 2c 80 00 00 	movabs $0x802c10,%rdx
+  800ce2:	00 00 00 
+  800ce5:	be 26 00 00 00       	mov    $0x26,%esi
+  800cea:	48 bf 2f 2c 80 00 00 	movabs $0x802c2f,%rdi
+  800cf1:	00 00 00 
+  800cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf9:	49 b9 40 20 80 00 00 	movabs $0x802040,%r9
+  800d00:	00 00 00 
+  800d03:	41 ff d1             	call   *%r9
+
+0000000000800d06 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  800d06:	55                   	push   %rbp
+  800d07:	48 89 e5             	mov    %rsp,%rbp
+  800d0a:	53                   	push   %rbx
+  800d0b:	48 83 ec 08          	sub    $0x8,%rsp
+  800d0f:	48 89 f1             	mov    %rsi,%rcx
+  800d12:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  800d15:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800d18:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800d1d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800d22:	be 00 00 00 00       	mov    $0x0,%esi
+  800d27:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800d2d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800d2f:	48 85 c0             	test   %rax,%rax
+  800d32:	7f 06                	jg     800d3a <sys_sigprocmask+0x34>
+}
+  800d34:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d38:	c9                   	leave
+  800d39:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800d3a:	49 89 c0             	mov    %rax,%r8
+  800d3d:	b9 13 00 00 00       	mov    $0x13,%ecx
+  800d42:	48 ba 10 2c 80 00 00 	movabs $0x802c10,%rdx
+  800d49:	00 00 00 
+  800d4c:	be 26 00 00 00       	mov    $0x26,%esi
+  800d51:	48 bf 2f 2c 80 00 00 	movabs $0x802c2f,%rdi
+  800d58:	00 00 00 
+  800d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d60:	49 b9 40 20 80 00 00 	movabs $0x802040,%r9
+  800d67:	00 00 00 
+  800d6a:	41 ff d1             	call   *%r9
+
+0000000000800d6d <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800d6d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800d74:	ff ff ff 
+  800d77:	48 01 f8             	add    %rdi,%rax
+  800d7a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800d7e:	c3                   	ret
+
+0000000000800d7f <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800d7f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800d86:	ff ff ff 
+  800d89:	48 01 f8             	add    %rdi,%rax
+  800d8c:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800d90:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800d96:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800d9a:	c3                   	ret
+
+0000000000800d9b <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800d9b:	55                   	push   %rbp
+  800d9c:	48 89 e5             	mov    %rsp,%rbp
+  800d9f:	41 57                	push   %r15
+  800da1:	41 56                	push   %r14
+  800da3:	41 55                	push   %r13
+  800da5:	41 54                	push   %r12
+  800da7:	53                   	push   %rbx
+  800da8:	48 83 ec 08          	sub    $0x8,%rsp
+  800dac:	49 89 ff             	mov    %rdi,%r15
+  800daf:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800db4:	49 bd 19 1d 80 00 00 	movabs $0x801d19,%r13
+  800dbb:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800dbe:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800dc4:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800dc7:	48 89 df             	mov    %rbx,%rdi
+  800dca:	41 ff d5             	call   *%r13
+  800dcd:	83 e0 04             	and    $0x4,%eax
+  800dd0:	74 17                	je     800de9 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800dd2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800dd9:	4c 39 f3             	cmp    %r14,%rbx
+  800ddc:	75 e6                	jne    800dc4 <fd_alloc+0x29>
+  800dde:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800de4:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800de9:	4d 89 27             	mov    %r12,(%r15)
+}
+  800dec:	48 83 c4 08          	add    $0x8,%rsp
+  800df0:	5b                   	pop    %rbx
+  800df1:	41 5c                	pop    %r12
+  800df3:	41 5d                	pop    %r13
+  800df5:	41 5e                	pop    %r14
+  800df7:	41 5f                	pop    %r15
+  800df9:	5d                   	pop    %rbp
+  800dfa:	c3                   	ret
+
+0000000000800dfb <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800dfb:	83 ff 1f             	cmp    $0x1f,%edi
+  800dfe:	77 39                	ja     800e39 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800e00:	55                   	push   %rbp
+  800e01:	48 89 e5             	mov    %rsp,%rbp
+  800e04:	41 54                	push   %r12
+  800e06:	53                   	push   %rbx
+  800e07:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800e0a:	48 63 df             	movslq %edi,%rbx
+  800e0d:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800e14:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800e18:	48 89 df             	mov    %rbx,%rdi
+  800e1b:	48 b8 19 1d 80 00 00 	movabs $0x801d19,%rax
+  800e22:	00 00 00 
+  800e25:	ff d0                	call   *%rax
+  800e27:	a8 04                	test   $0x4,%al
+  800e29:	74 14                	je     800e3f <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800e2b:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800e2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e34:	5b                   	pop    %rbx
+  800e35:	41 5c                	pop    %r12
+  800e37:	5d                   	pop    %rbp
+  800e38:	c3                   	ret
+        return -E_INVAL;
+  800e39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800e3e:	c3                   	ret
+        return -E_INVAL;
+  800e3f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e44:	eb ee                	jmp    800e34 <fd_lookup+0x39>
+
+0000000000800e46 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800e46:	55                   	push   %rbp
+  800e47:	48 89 e5             	mov    %rsp,%rbp
+  800e4a:	41 54                	push   %r12
+  800e4c:	53                   	push   %rbx
+  800e4d:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800e50:	48 b8 c0 2c 80 00 00 	movabs $0x802cc0,%rax
+  800e57:	00 00 00 
+  800e5a:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  800e61:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800e64:	39 3b                	cmp    %edi,(%rbx)
+  800e66:	74 47                	je     800eaf <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800e68:	48 83 c0 08          	add    $0x8,%rax
+  800e6c:	48 8b 18             	mov    (%rax),%rbx
+  800e6f:	48 85 db             	test   %rbx,%rbx
+  800e72:	75 f0                	jne    800e64 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800e74:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800e7b:	00 00 00 
+  800e7e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800e84:	89 fa                	mov    %edi,%edx
+  800e86:	48 bf 40 2c 80 00 00 	movabs $0x802c40,%rdi
+  800e8d:	00 00 00 
+  800e90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e95:	48 b9 90 21 80 00 00 	movabs $0x802190,%rcx
+  800e9c:	00 00 00 
+  800e9f:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800ea1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800ea6:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800eaa:	5b                   	pop    %rbx
+  800eab:	41 5c                	pop    %r12
+  800ead:	5d                   	pop    %rbp
+  800eae:	c3                   	ret
+            return 0;
+  800eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb4:	eb f0                	jmp    800ea6 <dev_lookup+0x60>
+
+0000000000800eb6 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800eb6:	55                   	push   %rbp
+  800eb7:	48 89 e5             	mov    %rsp,%rbp
+  800eba:	41 55                	push   %r13
+  800ebc:	41 54                	push   %r12
+  800ebe:	53                   	push   %rbx
+  800ebf:	48 83 ec 18          	sub    $0x18,%rsp
+  800ec3:	48 89 fb             	mov    %rdi,%rbx
+  800ec6:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800ec9:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800ed0:	ff ff ff 
+  800ed3:	48 01 df             	add    %rbx,%rdi
+  800ed6:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800eda:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ede:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  800ee5:	00 00 00 
+  800ee8:	ff d0                	call   *%rax
+  800eea:	41 89 c5             	mov    %eax,%r13d
+  800eed:	85 c0                	test   %eax,%eax
+  800eef:	78 06                	js     800ef7 <fd_close+0x41>
+  800ef1:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800ef5:	74 1a                	je     800f11 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800ef7:	45 84 e4             	test   %r12b,%r12b
+  800efa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eff:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800f03:	44 89 e8             	mov    %r13d,%eax
+  800f06:	48 83 c4 18          	add    $0x18,%rsp
+  800f0a:	5b                   	pop    %rbx
+  800f0b:	41 5c                	pop    %r12
+  800f0d:	41 5d                	pop    %r13
+  800f0f:	5d                   	pop    %rbp
+  800f10:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800f11:	8b 3b                	mov    (%rbx),%edi
+  800f13:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800f17:	48 b8 46 0e 80 00 00 	movabs $0x800e46,%rax
+  800f1e:	00 00 00 
+  800f21:	ff d0                	call   *%rax
+  800f23:	41 89 c5             	mov    %eax,%r13d
+  800f26:	85 c0                	test   %eax,%eax
+  800f28:	78 1b                	js     800f45 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800f2a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f2e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800f32:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800f38:	48 85 c0             	test   %rax,%rax
+  800f3b:	74 08                	je     800f45 <fd_close+0x8f>
+  800f3d:	48 89 df             	mov    %rbx,%rdi
+  800f40:	ff d0                	call   *%rax
+  800f42:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800f45:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800f4a:	48 89 de             	mov    %rbx,%rsi
+  800f4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f52:	48 b8 97 08 80 00 00 	movabs $0x800897,%rax
+  800f59:	00 00 00 
+  800f5c:	ff d0                	call   *%rax
+    return res;
+  800f5e:	eb a3                	jmp    800f03 <fd_close+0x4d>
+
+0000000000800f60 <close>:
+
+int
+close(int fdnum) {
+  800f60:	55                   	push   %rbp
+  800f61:	48 89 e5             	mov    %rsp,%rbp
+  800f64:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800f68:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800f6c:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  800f73:	00 00 00 
+  800f76:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800f78:	85 c0                	test   %eax,%eax
+  800f7a:	78 15                	js     800f91 <close+0x31>
+
+    return fd_close(fd, 1);
+  800f7c:	be 01 00 00 00       	mov    $0x1,%esi
+  800f81:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800f85:	48 b8 b6 0e 80 00 00 	movabs $0x800eb6,%rax
+  800f8c:	00 00 00 
+  800f8f:	ff d0                	call   *%rax
+}
+  800f91:	c9                   	leave
+  800f92:	c3                   	ret
+
+0000000000800f93 <close_all>:
+
+void
+close_all(void) {
+  800f93:	55                   	push   %rbp
+  800f94:	48 89 e5             	mov    %rsp,%rbp
+  800f97:	41 54                	push   %r12
+  800f99:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800f9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9f:	49 bc 60 0f 80 00 00 	movabs $0x800f60,%r12
+  800fa6:	00 00 00 
+  800fa9:	89 df                	mov    %ebx,%edi
+  800fab:	41 ff d4             	call   *%r12
+  800fae:	83 c3 01             	add    $0x1,%ebx
+  800fb1:	83 fb 20             	cmp    $0x20,%ebx
+  800fb4:	75 f3                	jne    800fa9 <close_all+0x16>
+}
+  800fb6:	5b                   	pop    %rbx
+  800fb7:	41 5c                	pop    %r12
+  800fb9:	5d                   	pop    %rbp
+  800fba:	c3                   	ret
+
+0000000000800fbb <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800fbb:	55                   	push   %rbp
+  800fbc:	48 89 e5             	mov    %rsp,%rbp
+  800fbf:	41 57                	push   %r15
+  800fc1:	41 56                	push   %r14
+  800fc3:	41 55                	push   %r13
+  800fc5:	41 54                	push   %r12
+  800fc7:	53                   	push   %rbx
+  800fc8:	48 83 ec 18          	sub    $0x18,%rsp
+  800fcc:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800fcf:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800fd3:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  800fda:	00 00 00 
+  800fdd:	ff d0                	call   *%rax
+  800fdf:	89 c3                	mov    %eax,%ebx
+  800fe1:	85 c0                	test   %eax,%eax
+  800fe3:	0f 88 b8 00 00 00    	js     8010a1 <dup+0xe6>
+    close(newfdnum);
+  800fe9:	44 89 e7             	mov    %r12d,%edi
+  800fec:	48 b8 60 0f 80 00 00 	movabs $0x800f60,%rax
+  800ff3:	00 00 00 
+  800ff6:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800ff8:	4d 63 ec             	movslq %r12d,%r13
+  800ffb:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801002:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801006:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80100a:	4c 89 ff             	mov    %r15,%rdi
+  80100d:	49 be 7f 0d 80 00 00 	movabs $0x800d7f,%r14
+  801014:	00 00 00 
+  801017:	41 ff d6             	call   *%r14
+  80101a:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80101d:	4c 89 ef             	mov    %r13,%rdi
+  801020:	41 ff d6             	call   *%r14
+  801023:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801026:	48 89 df             	mov    %rbx,%rdi
+  801029:	48 b8 19 1d 80 00 00 	movabs $0x801d19,%rax
+  801030:	00 00 00 
+  801033:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801035:	a8 04                	test   $0x4,%al
+  801037:	74 2b                	je     801064 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801039:	41 89 c1             	mov    %eax,%r9d
+  80103c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801042:	4c 89 f1             	mov    %r14,%rcx
+  801045:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104a:	48 89 de             	mov    %rbx,%rsi
+  80104d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801052:	48 b8 32 08 80 00 00 	movabs $0x800832,%rax
+  801059:	00 00 00 
+  80105c:	ff d0                	call   *%rax
+  80105e:	89 c3                	mov    %eax,%ebx
+  801060:	85 c0                	test   %eax,%eax
+  801062:	78 4e                	js     8010b2 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801064:	4c 89 ff             	mov    %r15,%rdi
+  801067:	48 b8 19 1d 80 00 00 	movabs $0x801d19,%rax
+  80106e:	00 00 00 
+  801071:	ff d0                	call   *%rax
+  801073:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801076:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80107c:	4c 89 e9             	mov    %r13,%rcx
+  80107f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801084:	4c 89 fe             	mov    %r15,%rsi
+  801087:	bf 00 00 00 00       	mov    $0x0,%edi
+  80108c:	48 b8 32 08 80 00 00 	movabs $0x800832,%rax
+  801093:	00 00 00 
+  801096:	ff d0                	call   *%rax
+  801098:	89 c3                	mov    %eax,%ebx
+  80109a:	85 c0                	test   %eax,%eax
+  80109c:	78 14                	js     8010b2 <dup+0xf7>
+
+    return newfdnum;
+  80109e:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8010a1:	89 d8                	mov    %ebx,%eax
+  8010a3:	48 83 c4 18          	add    $0x18,%rsp
+  8010a7:	5b                   	pop    %rbx
+  8010a8:	41 5c                	pop    %r12
+  8010aa:	41 5d                	pop    %r13
+  8010ac:	41 5e                	pop    %r14
+  8010ae:	41 5f                	pop    %r15
+  8010b0:	5d                   	pop    %rbp
+  8010b1:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8010b2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8010b7:	4c 89 ee             	mov    %r13,%rsi
+  8010ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010bf:	49 bc 97 08 80 00 00 	movabs $0x800897,%r12
+  8010c6:	00 00 00 
+  8010c9:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8010cc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8010d1:	4c 89 f6             	mov    %r14,%rsi
+  8010d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010d9:	41 ff d4             	call   *%r12
+    return res;
+  8010dc:	eb c3                	jmp    8010a1 <dup+0xe6>
+
+00000000008010de <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8010de:	55                   	push   %rbp
+  8010df:	48 89 e5             	mov    %rsp,%rbp
+  8010e2:	41 56                	push   %r14
+  8010e4:	41 55                	push   %r13
+  8010e6:	41 54                	push   %r12
+  8010e8:	53                   	push   %rbx
+  8010e9:	48 83 ec 10          	sub    $0x10,%rsp
+  8010ed:	89 fb                	mov    %edi,%ebx
+  8010ef:	49 89 f4             	mov    %rsi,%r12
+  8010f2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8010f5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8010f9:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  801100:	00 00 00 
+  801103:	ff d0                	call   *%rax
+  801105:	85 c0                	test   %eax,%eax
+  801107:	78 4c                	js     801155 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801109:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80110d:	41 8b 3e             	mov    (%r14),%edi
+  801110:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801114:	48 b8 46 0e 80 00 00 	movabs $0x800e46,%rax
+  80111b:	00 00 00 
+  80111e:	ff d0                	call   *%rax
+  801120:	85 c0                	test   %eax,%eax
+  801122:	78 35                	js     801159 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801124:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801128:	83 e0 03             	and    $0x3,%eax
+  80112b:	83 f8 01             	cmp    $0x1,%eax
+  80112e:	74 2d                	je     80115d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801130:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801134:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801138:	48 85 c0             	test   %rax,%rax
+  80113b:	74 56                	je     801193 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80113d:	4c 89 ea             	mov    %r13,%rdx
+  801140:	4c 89 e6             	mov    %r12,%rsi
+  801143:	4c 89 f7             	mov    %r14,%rdi
+  801146:	ff d0                	call   *%rax
+}
+  801148:	48 83 c4 10          	add    $0x10,%rsp
+  80114c:	5b                   	pop    %rbx
+  80114d:	41 5c                	pop    %r12
+  80114f:	41 5d                	pop    %r13
+  801151:	41 5e                	pop    %r14
+  801153:	5d                   	pop    %rbp
+  801154:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801155:	48 98                	cltq
+  801157:	eb ef                	jmp    801148 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801159:	48 98                	cltq
+  80115b:	eb eb                	jmp    801148 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80115d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801164:	00 00 00 
+  801167:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80116d:	89 da                	mov    %ebx,%edx
+  80116f:	48 bf 81 2c 80 00 00 	movabs $0x802c81,%rdi
+  801176:	00 00 00 
+  801179:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117e:	48 b9 90 21 80 00 00 	movabs $0x802190,%rcx
+  801185:	00 00 00 
+  801188:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80118a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801191:	eb b5                	jmp    801148 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801193:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80119a:	eb ac                	jmp    801148 <read+0x6a>
+
+000000000080119c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80119c:	55                   	push   %rbp
+  80119d:	48 89 e5             	mov    %rsp,%rbp
+  8011a0:	41 57                	push   %r15
+  8011a2:	41 56                	push   %r14
+  8011a4:	41 55                	push   %r13
+  8011a6:	41 54                	push   %r12
+  8011a8:	53                   	push   %rbx
+  8011a9:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8011ad:	48 85 d2             	test   %rdx,%rdx
+  8011b0:	74 54                	je     801206 <readn+0x6a>
+  8011b2:	41 89 fd             	mov    %edi,%r13d
+  8011b5:	49 89 f6             	mov    %rsi,%r14
+  8011b8:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8011bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8011c0:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8011c5:	49 bf de 10 80 00 00 	movabs $0x8010de,%r15
+  8011cc:	00 00 00 
+  8011cf:	4c 89 e2             	mov    %r12,%rdx
+  8011d2:	48 29 f2             	sub    %rsi,%rdx
+  8011d5:	4c 01 f6             	add    %r14,%rsi
+  8011d8:	44 89 ef             	mov    %r13d,%edi
+  8011db:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8011de:	85 c0                	test   %eax,%eax
+  8011e0:	78 20                	js     801202 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8011e2:	01 c3                	add    %eax,%ebx
+  8011e4:	85 c0                	test   %eax,%eax
+  8011e6:	74 08                	je     8011f0 <readn+0x54>
+  8011e8:	48 63 f3             	movslq %ebx,%rsi
+  8011eb:	4c 39 e6             	cmp    %r12,%rsi
+  8011ee:	72 df                	jb     8011cf <readn+0x33>
+    }
+    return res;
+  8011f0:	48 63 c3             	movslq %ebx,%rax
+}
+  8011f3:	48 83 c4 08          	add    $0x8,%rsp
+  8011f7:	5b                   	pop    %rbx
+  8011f8:	41 5c                	pop    %r12
+  8011fa:	41 5d                	pop    %r13
+  8011fc:	41 5e                	pop    %r14
+  8011fe:	41 5f                	pop    %r15
+  801200:	5d                   	pop    %rbp
+  801201:	c3                   	ret
+        if (inc < 0) return inc;
+  801202:	48 98                	cltq
+  801204:	eb ed                	jmp    8011f3 <readn+0x57>
+    int inc = 1, res = 0;
+  801206:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120b:	eb e3                	jmp    8011f0 <readn+0x54>
+
+000000000080120d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80120d:	55                   	push   %rbp
+  80120e:	48 89 e5             	mov    %rsp,%rbp
+  801211:	41 56                	push   %r14
+  801213:	41 55                	push   %r13
+  801215:	41 54                	push   %r12
+  801217:	53                   	push   %rbx
+  801218:	48 83 ec 10          	sub    $0x10,%rsp
+  80121c:	89 fb                	mov    %edi,%ebx
+  80121e:	49 89 f4             	mov    %rsi,%r12
+  801221:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801224:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801228:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  80122f:	00 00 00 
+  801232:	ff d0                	call   *%rax
+  801234:	85 c0                	test   %eax,%eax
+  801236:	78 47                	js     80127f <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801238:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80123c:	41 8b 3e             	mov    (%r14),%edi
+  80123f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801243:	48 b8 46 0e 80 00 00 	movabs $0x800e46,%rax
+  80124a:	00 00 00 
+  80124d:	ff d0                	call   *%rax
+  80124f:	85 c0                	test   %eax,%eax
+  801251:	78 30                	js     801283 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801253:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801258:	74 2d                	je     801287 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80125a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80125e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801262:	48 85 c0             	test   %rax,%rax
+  801265:	74 56                	je     8012bd <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801267:	4c 89 ea             	mov    %r13,%rdx
+  80126a:	4c 89 e6             	mov    %r12,%rsi
+  80126d:	4c 89 f7             	mov    %r14,%rdi
+  801270:	ff d0                	call   *%rax
+}
+  801272:	48 83 c4 10          	add    $0x10,%rsp
+  801276:	5b                   	pop    %rbx
+  801277:	41 5c                	pop    %r12
+  801279:	41 5d                	pop    %r13
+  80127b:	41 5e                	pop    %r14
+  80127d:	5d                   	pop    %rbp
+  80127e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80127f:	48 98                	cltq
+  801281:	eb ef                	jmp    801272 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801283:	48 98                	cltq
+  801285:	eb eb                	jmp    801272 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801287:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80128e:	00 00 00 
+  801291:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801297:	89 da                	mov    %ebx,%edx
+  801299:	48 bf 9d 2c 80 00 00 	movabs $0x802c9d,%rdi
+  8012a0:	00 00 00 
+  8012a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a8:	48 b9 90 21 80 00 00 	movabs $0x802190,%rcx
+  8012af:	00 00 00 
+  8012b2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8012b4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8012bb:	eb b5                	jmp    801272 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8012bd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8012c4:	eb ac                	jmp    801272 <write+0x65>
+
+00000000008012c6 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8012c6:	55                   	push   %rbp
+  8012c7:	48 89 e5             	mov    %rsp,%rbp
+  8012ca:	53                   	push   %rbx
+  8012cb:	48 83 ec 18          	sub    $0x18,%rsp
+  8012cf:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8012d1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8012d5:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  8012dc:	00 00 00 
+  8012df:	ff d0                	call   *%rax
+  8012e1:	85 c0                	test   %eax,%eax
+  8012e3:	78 0c                	js     8012f1 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8012e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012e9:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8012ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f5:	c9                   	leave
+  8012f6:	c3                   	ret
+
+00000000008012f7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8012f7:	55                   	push   %rbp
+  8012f8:	48 89 e5             	mov    %rsp,%rbp
+  8012fb:	41 55                	push   %r13
+  8012fd:	41 54                	push   %r12
+  8012ff:	53                   	push   %rbx
+  801300:	48 83 ec 18          	sub    $0x18,%rsp
+  801304:	89 fb                	mov    %edi,%ebx
+  801306:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801309:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80130d:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  801314:	00 00 00 
+  801317:	ff d0                	call   *%rax
+  801319:	85 c0                	test   %eax,%eax
+  80131b:	78 38                	js     801355 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80131d:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801321:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801325:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801329:	48 b8 46 0e 80 00 00 	movabs $0x800e46,%rax
+  801330:	00 00 00 
+  801333:	ff d0                	call   *%rax
+  801335:	85 c0                	test   %eax,%eax
+  801337:	78 1c                	js     801355 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801339:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80133e:	74 20                	je     801360 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801340:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801344:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801348:	48 85 c0             	test   %rax,%rax
+  80134b:	74 47                	je     801394 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80134d:	44 89 e6             	mov    %r12d,%esi
+  801350:	4c 89 ef             	mov    %r13,%rdi
+  801353:	ff d0                	call   *%rax
+}
+  801355:	48 83 c4 18          	add    $0x18,%rsp
+  801359:	5b                   	pop    %rbx
+  80135a:	41 5c                	pop    %r12
+  80135c:	41 5d                	pop    %r13
+  80135e:	5d                   	pop    %rbp
+  80135f:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801360:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801367:	00 00 00 
+  80136a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801370:	89 da                	mov    %ebx,%edx
+  801372:	48 bf 60 2c 80 00 00 	movabs $0x802c60,%rdi
+  801379:	00 00 00 
+  80137c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801381:	48 b9 90 21 80 00 00 	movabs $0x802190,%rcx
+  801388:	00 00 00 
+  80138b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80138d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801392:	eb c1                	jmp    801355 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801394:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801399:	eb ba                	jmp    801355 <ftruncate+0x5e>
+
+000000000080139b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80139b:	55                   	push   %rbp
+  80139c:	48 89 e5             	mov    %rsp,%rbp
+  80139f:	41 54                	push   %r12
+  8013a1:	53                   	push   %rbx
+  8013a2:	48 83 ec 10          	sub    $0x10,%rsp
+  8013a6:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8013a9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8013ad:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  8013b4:	00 00 00 
+  8013b7:	ff d0                	call   *%rax
+  8013b9:	85 c0                	test   %eax,%eax
+  8013bb:	78 4e                	js     80140b <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8013bd:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8013c1:	41 8b 3c 24          	mov    (%r12),%edi
+  8013c5:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8013c9:	48 b8 46 0e 80 00 00 	movabs $0x800e46,%rax
+  8013d0:	00 00 00 
+  8013d3:	ff d0                	call   *%rax
+  8013d5:	85 c0                	test   %eax,%eax
+  8013d7:	78 32                	js     80140b <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8013d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013dd:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8013e2:	74 30                	je     801414 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8013e4:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8013e7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8013ee:	00 00 00 
+    stat->st_isdir = 0;
+  8013f1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8013f8:	00 00 00 
+    stat->st_dev = dev;
+  8013fb:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801402:	48 89 de             	mov    %rbx,%rsi
+  801405:	4c 89 e7             	mov    %r12,%rdi
+  801408:	ff 50 28             	call   *0x28(%rax)
+}
+  80140b:	48 83 c4 10          	add    $0x10,%rsp
+  80140f:	5b                   	pop    %rbx
+  801410:	41 5c                	pop    %r12
+  801412:	5d                   	pop    %rbp
+  801413:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801414:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801419:	eb f0                	jmp    80140b <fstat+0x70>
+
+000000000080141b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80141b:	55                   	push   %rbp
+  80141c:	48 89 e5             	mov    %rsp,%rbp
+  80141f:	41 54                	push   %r12
+  801421:	53                   	push   %rbx
+  801422:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801425:	be 00 00 00 00       	mov    $0x0,%esi
+  80142a:	48 b8 9c 16 80 00 00 	movabs $0x80169c,%rax
+  801431:	00 00 00 
+  801434:	ff d0                	call   *%rax
+  801436:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801438:	85 c0                	test   %eax,%eax
+  80143a:	78 25                	js     801461 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80143c:	4c 89 e6             	mov    %r12,%rsi
+  80143f:	89 c7                	mov    %eax,%edi
+  801441:	48 b8 9b 13 80 00 00 	movabs $0x80139b,%rax
+  801448:	00 00 00 
+  80144b:	ff d0                	call   *%rax
+  80144d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801450:	89 df                	mov    %ebx,%edi
+  801452:	48 b8 60 0f 80 00 00 	movabs $0x800f60,%rax
+  801459:	00 00 00 
+  80145c:	ff d0                	call   *%rax
+
+    return res;
+  80145e:	44 89 e3             	mov    %r12d,%ebx
+}
+  801461:	89 d8                	mov    %ebx,%eax
+  801463:	5b                   	pop    %rbx
+  801464:	41 5c                	pop    %r12
+  801466:	5d                   	pop    %rbp
+  801467:	c3                   	ret
+
+0000000000801468 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801468:	55                   	push   %rbp
+  801469:	48 89 e5             	mov    %rsp,%rbp
+  80146c:	41 54                	push   %r12
+  80146e:	53                   	push   %rbx
+  80146f:	48 83 ec 10          	sub    $0x10,%rsp
+  801473:	41 89 fc             	mov    %edi,%r12d
+  801476:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801479:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801480:	00 00 00 
+  801483:	83 38 00             	cmpl   $0x0,(%rax)
+  801486:	74 5e                	je     8014e6 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801488:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80148e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801493:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80149a:	00 00 00 
+  80149d:	44 89 e6             	mov    %r12d,%esi
+  8014a0:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8014a7:	00 00 00 
+  8014aa:	8b 38                	mov    (%rax),%edi
+  8014ac:	48 b8 0c 2b 80 00 00 	movabs $0x802b0c,%rax
+  8014b3:	00 00 00 
+  8014b6:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8014b8:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8014bf:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8014c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014c5:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8014c9:	48 89 de             	mov    %rbx,%rsi
+  8014cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014d1:	48 b8 77 2a 80 00 00 	movabs $0x802a77,%rax
+  8014d8:	00 00 00 
+  8014db:	ff d0                	call   *%rax
+}
+  8014dd:	48 83 c4 10          	add    $0x10,%rsp
+  8014e1:	5b                   	pop    %rbx
+  8014e2:	41 5c                	pop    %r12
+  8014e4:	5d                   	pop    %rbp
+  8014e5:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8014e6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8014eb:	48 b8 ac 2b 80 00 00 	movabs $0x802bac,%rax
+  8014f2:	00 00 00 
+  8014f5:	ff d0                	call   *%rax
+  8014f7:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8014fe:	00 00 
+  801500:	eb 86                	jmp    801488 <fsipc+0x20>
+
+0000000000801502 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801502:	55                   	push   %rbp
+  801503:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801506:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80150d:	00 00 00 
+  801510:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801513:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801515:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801518:	be 00 00 00 00       	mov    $0x0,%esi
+  80151d:	bf 02 00 00 00       	mov    $0x2,%edi
+  801522:	48 b8 68 14 80 00 00 	movabs $0x801468,%rax
+  801529:	00 00 00 
+  80152c:	ff d0                	call   *%rax
+}
+  80152e:	5d                   	pop    %rbp
+  80152f:	c3                   	ret
+
+0000000000801530 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801530:	55                   	push   %rbp
+  801531:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801534:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801537:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80153e:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801540:	be 00 00 00 00       	mov    $0x0,%esi
+  801545:	bf 06 00 00 00       	mov    $0x6,%edi
+  80154a:	48 b8 68 14 80 00 00 	movabs $0x801468,%rax
+  801551:	00 00 00 
+  801554:	ff d0                	call   *%rax
+}
+  801556:	5d                   	pop    %rbp
+  801557:	c3                   	ret
+
+0000000000801558 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801558:	55                   	push   %rbp
+  801559:	48 89 e5             	mov    %rsp,%rbp
+  80155c:	41 54                	push   %r12
+  80155e:	53                   	push   %rbx
+  80155f:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801562:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801565:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80156c:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80156e:	be 00 00 00 00       	mov    $0x0,%esi
+  801573:	bf 05 00 00 00       	mov    $0x5,%edi
+  801578:	48 b8 68 14 80 00 00 	movabs $0x801468,%rax
+  80157f:	00 00 00 
+  801582:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801584:	85 c0                	test   %eax,%eax
+  801586:	78 3d                	js     8015c5 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801588:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80158f:	00 00 00 
+  801592:	4c 89 e6             	mov    %r12,%rsi
+  801595:	48 89 df             	mov    %rbx,%rdi
+  801598:	48 b8 1b 02 80 00 00 	movabs $0x80021b,%rax
+  80159f:	00 00 00 
+  8015a2:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8015a4:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8015ab:	00 
+  8015ac:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8015b2:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8015b9:	00 
+  8015ba:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8015c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015c5:	5b                   	pop    %rbx
+  8015c6:	41 5c                	pop    %r12
+  8015c8:	5d                   	pop    %rbp
+  8015c9:	c3                   	ret
+
+00000000008015ca <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8015ca:	55                   	push   %rbp
+  8015cb:	48 89 e5             	mov    %rsp,%rbp
+  8015ce:	41 54                	push   %r12
+  8015d0:	53                   	push   %rbx
+  8015d1:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8015d4:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8015d9:	48 39 c2             	cmp    %rax,%rdx
+  8015dc:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8015e0:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8015e3:	48 89 c2             	mov    %rax,%rdx
+  8015e6:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8015ed:	00 00 00 
+  8015f0:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  8015f7:	00 00 00 
+  8015fa:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8015fc:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801603:	00 00 00 
+  801606:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80160b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  80160d:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  801611:	be 00 00 00 00       	mov    $0x0,%esi
+  801616:	bf 04 00 00 00       	mov    $0x4,%edi
+  80161b:	48 b8 68 14 80 00 00 	movabs $0x801468,%rax
+  801622:	00 00 00 
+  801625:	ff d0                	call   *%rax
+  801627:	48 98                	cltq
+}
+  801629:	5b                   	pop    %rbx
+  80162a:	41 5c                	pop    %r12
+  80162c:	5d                   	pop    %rbp
+  80162d:	c3                   	ret
+
+000000000080162e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80162e:	55                   	push   %rbp
+  80162f:	48 89 e5             	mov    %rsp,%rbp
+  801632:	41 54                	push   %r12
+  801634:	53                   	push   %rbx
+  801635:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801638:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80163f:	00 00 00 
+  801642:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801645:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  801647:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80164c:	48 39 ca             	cmp    %rcx,%rdx
+  80164f:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  801653:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  801657:	be 00 00 00 00       	mov    $0x0,%esi
+  80165c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801661:	48 b8 68 14 80 00 00 	movabs $0x801468,%rax
+  801668:	00 00 00 
+  80166b:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	78 27                	js     801698 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  801671:	48 63 d8             	movslq %eax,%rbx
+  801674:	48 89 da             	mov    %rbx,%rdx
+  801677:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80167e:	00 00 00 
+  801681:	4c 89 e7             	mov    %r12,%rdi
+  801684:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  80168b:	00 00 00 
+  80168e:	ff d0                	call   *%rax
+    return bytes_read;
+  801690:	48 89 d8             	mov    %rbx,%rax
+}
+  801693:	5b                   	pop    %rbx
+  801694:	41 5c                	pop    %r12
+  801696:	5d                   	pop    %rbp
+  801697:	c3                   	ret
+        return bytes_read;
+  801698:	48 98                	cltq
+  80169a:	eb f7                	jmp    801693 <devfile_read+0x65>
+
+000000000080169c <open>:
+open(const char *path, int mode) {
+  80169c:	55                   	push   %rbp
+  80169d:	48 89 e5             	mov    %rsp,%rbp
+  8016a0:	41 55                	push   %r13
+  8016a2:	41 54                	push   %r12
+  8016a4:	53                   	push   %rbx
+  8016a5:	48 83 ec 18          	sub    $0x18,%rsp
+  8016a9:	49 89 fc             	mov    %rdi,%r12
+  8016ac:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8016af:	48 b8 dd 01 80 00 00 	movabs $0x8001dd,%rax
+  8016b6:	00 00 00 
+  8016b9:	ff d0                	call   *%rax
+  8016bb:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8016c1:	0f 87 8a 00 00 00    	ja     801751 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8016c7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8016cb:	48 b8 9b 0d 80 00 00 	movabs $0x800d9b,%rax
+  8016d2:	00 00 00 
+  8016d5:	ff d0                	call   *%rax
+  8016d7:	89 c3                	mov    %eax,%ebx
+  8016d9:	85 c0                	test   %eax,%eax
+  8016db:	78 50                	js     80172d <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8016dd:	4c 89 e6             	mov    %r12,%rsi
+  8016e0:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8016e7:	00 00 00 
+  8016ea:	48 89 df             	mov    %rbx,%rdi
+  8016ed:	48 b8 1b 02 80 00 00 	movabs $0x80021b,%rax
+  8016f4:	00 00 00 
+  8016f7:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8016f9:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801700:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801704:	bf 01 00 00 00       	mov    $0x1,%edi
+  801709:	48 b8 68 14 80 00 00 	movabs $0x801468,%rax
+  801710:	00 00 00 
+  801713:	ff d0                	call   *%rax
+  801715:	89 c3                	mov    %eax,%ebx
+  801717:	85 c0                	test   %eax,%eax
+  801719:	78 1f                	js     80173a <open+0x9e>
+    return fd2num(fd);
+  80171b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80171f:	48 b8 6d 0d 80 00 00 	movabs $0x800d6d,%rax
+  801726:	00 00 00 
+  801729:	ff d0                	call   *%rax
+  80172b:	89 c3                	mov    %eax,%ebx
+}
+  80172d:	89 d8                	mov    %ebx,%eax
+  80172f:	48 83 c4 18          	add    $0x18,%rsp
+  801733:	5b                   	pop    %rbx
+  801734:	41 5c                	pop    %r12
+  801736:	41 5d                	pop    %r13
+  801738:	5d                   	pop    %rbp
+  801739:	c3                   	ret
+        fd_close(fd, 0);
+  80173a:	be 00 00 00 00       	mov    $0x0,%esi
+  80173f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801743:	48 b8 b6 0e 80 00 00 	movabs $0x800eb6,%rax
+  80174a:	00 00 00 
+  80174d:	ff d0                	call   *%rax
+        return res;
+  80174f:	eb dc                	jmp    80172d <open+0x91>
+        return -E_BAD_PATH;
+  801751:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801756:	eb d5                	jmp    80172d <open+0x91>
+
+0000000000801758 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801758:	55                   	push   %rbp
+  801759:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80175c:	be 00 00 00 00       	mov    $0x0,%esi
+  801761:	bf 08 00 00 00       	mov    $0x8,%edi
+  801766:	48 b8 68 14 80 00 00 	movabs $0x801468,%rax
+  80176d:	00 00 00 
+  801770:	ff d0                	call   *%rax
+}
+  801772:	5d                   	pop    %rbp
+  801773:	c3                   	ret
+
+0000000000801774 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801774:	55                   	push   %rbp
+  801775:	48 89 e5             	mov    %rsp,%rbp
+  801778:	41 54                	push   %r12
+  80177a:	53                   	push   %rbx
+  80177b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80177e:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  801785:	00 00 00 
+  801788:	ff d0                	call   *%rax
+  80178a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80178d:	48 be e0 2c 80 00 00 	movabs $0x802ce0,%rsi
+  801794:	00 00 00 
+  801797:	48 89 df             	mov    %rbx,%rdi
+  80179a:	48 b8 1b 02 80 00 00 	movabs $0x80021b,%rax
+  8017a1:	00 00 00 
+  8017a4:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8017a6:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8017ab:	41 2b 04 24          	sub    (%r12),%eax
+  8017af:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8017b5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8017bc:	00 00 00 
+    stat->st_dev = &devpipe;
+  8017bf:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8017c6:	00 00 00 
+  8017c9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8017d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d5:	5b                   	pop    %rbx
+  8017d6:	41 5c                	pop    %r12
+  8017d8:	5d                   	pop    %rbp
+  8017d9:	c3                   	ret
+
+00000000008017da <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8017da:	55                   	push   %rbp
+  8017db:	48 89 e5             	mov    %rsp,%rbp
+  8017de:	41 54                	push   %r12
+  8017e0:	53                   	push   %rbx
+  8017e1:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8017e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017e9:	48 89 fe             	mov    %rdi,%rsi
+  8017ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017f1:	49 bc 97 08 80 00 00 	movabs $0x800897,%r12
+  8017f8:	00 00 00 
+  8017fb:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8017fe:	48 89 df             	mov    %rbx,%rdi
+  801801:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  801808:	00 00 00 
+  80180b:	ff d0                	call   *%rax
+  80180d:	48 89 c6             	mov    %rax,%rsi
+  801810:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801815:	bf 00 00 00 00       	mov    $0x0,%edi
+  80181a:	41 ff d4             	call   *%r12
+}
+  80181d:	5b                   	pop    %rbx
+  80181e:	41 5c                	pop    %r12
+  801820:	5d                   	pop    %rbp
+  801821:	c3                   	ret
+
+0000000000801822 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801822:	55                   	push   %rbp
+  801823:	48 89 e5             	mov    %rsp,%rbp
+  801826:	41 57                	push   %r15
+  801828:	41 56                	push   %r14
+  80182a:	41 55                	push   %r13
+  80182c:	41 54                	push   %r12
+  80182e:	53                   	push   %rbx
+  80182f:	48 83 ec 18          	sub    $0x18,%rsp
+  801833:	49 89 fc             	mov    %rdi,%r12
+  801836:	49 89 f5             	mov    %rsi,%r13
+  801839:	49 89 d7             	mov    %rdx,%r15
+  80183c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801840:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  801847:	00 00 00 
+  80184a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80184c:	4d 85 ff             	test   %r15,%r15
+  80184f:	0f 84 af 00 00 00    	je     801904 <devpipe_write+0xe2>
+  801855:	48 89 c3             	mov    %rax,%rbx
+  801858:	4c 89 f8             	mov    %r15,%rax
+  80185b:	4d 89 ef             	mov    %r13,%r15
+  80185e:	4c 01 e8             	add    %r13,%rax
+  801861:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801865:	49 bd 9f 07 80 00 00 	movabs $0x80079f,%r13
+  80186c:	00 00 00 
+            sys_yield();
+  80186f:	49 be 3c 07 80 00 00 	movabs $0x80073c,%r14
+  801876:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801879:	8b 73 04             	mov    0x4(%rbx),%esi
+  80187c:	48 63 ce             	movslq %esi,%rcx
+  80187f:	48 63 03             	movslq (%rbx),%rax
+  801882:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801888:	48 39 c1             	cmp    %rax,%rcx
+  80188b:	72 2e                	jb     8018bb <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80188d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801892:	48 89 da             	mov    %rbx,%rdx
+  801895:	be 00 10 00 00       	mov    $0x1000,%esi
+  80189a:	4c 89 e7             	mov    %r12,%rdi
+  80189d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8018a0:	85 c0                	test   %eax,%eax
+  8018a2:	74 66                	je     80190a <devpipe_write+0xe8>
+            sys_yield();
+  8018a4:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8018a7:	8b 73 04             	mov    0x4(%rbx),%esi
+  8018aa:	48 63 ce             	movslq %esi,%rcx
+  8018ad:	48 63 03             	movslq (%rbx),%rax
+  8018b0:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8018b6:	48 39 c1             	cmp    %rax,%rcx
+  8018b9:	73 d2                	jae    80188d <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8018bb:	41 0f b6 3f          	movzbl (%r15),%edi
+  8018bf:	48 89 ca             	mov    %rcx,%rdx
+  8018c2:	48 c1 ea 03          	shr    $0x3,%rdx
+  8018c6:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8018cd:	08 10 20 
+  8018d0:	48 f7 e2             	mul    %rdx
+  8018d3:	48 c1 ea 06          	shr    $0x6,%rdx
+  8018d7:	48 89 d0             	mov    %rdx,%rax
+  8018da:	48 c1 e0 09          	shl    $0x9,%rax
+  8018de:	48 29 d0             	sub    %rdx,%rax
+  8018e1:	48 c1 e0 03          	shl    $0x3,%rax
+  8018e5:	48 29 c1             	sub    %rax,%rcx
+  8018e8:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8018ed:	83 c6 01             	add    $0x1,%esi
+  8018f0:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8018f3:	49 83 c7 01          	add    $0x1,%r15
+  8018f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018fb:	49 39 c7             	cmp    %rax,%r15
+  8018fe:	0f 85 75 ff ff ff    	jne    801879 <devpipe_write+0x57>
+    return n;
+  801904:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801908:	eb 05                	jmp    80190f <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80190a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80190f:	48 83 c4 18          	add    $0x18,%rsp
+  801913:	5b                   	pop    %rbx
+  801914:	41 5c                	pop    %r12
+  801916:	41 5d                	pop    %r13
+  801918:	41 5e                	pop    %r14
+  80191a:	41 5f                	pop    %r15
+  80191c:	5d                   	pop    %rbp
+  80191d:	c3                   	ret
+
+000000000080191e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80191e:	55                   	push   %rbp
+  80191f:	48 89 e5             	mov    %rsp,%rbp
+  801922:	41 57                	push   %r15
+  801924:	41 56                	push   %r14
+  801926:	41 55                	push   %r13
+  801928:	41 54                	push   %r12
+  80192a:	53                   	push   %rbx
+  80192b:	48 83 ec 18          	sub    $0x18,%rsp
+  80192f:	49 89 fc             	mov    %rdi,%r12
+  801932:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801936:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80193a:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  801941:	00 00 00 
+  801944:	ff d0                	call   *%rax
+  801946:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801949:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80194f:	49 bd 9f 07 80 00 00 	movabs $0x80079f,%r13
+  801956:	00 00 00 
+            sys_yield();
+  801959:	49 be 3c 07 80 00 00 	movabs $0x80073c,%r14
+  801960:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801963:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801968:	74 7d                	je     8019e7 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80196a:	8b 03                	mov    (%rbx),%eax
+  80196c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80196f:	75 26                	jne    801997 <devpipe_read+0x79>
+            if (i > 0) return i;
+  801971:	4d 85 ff             	test   %r15,%r15
+  801974:	75 77                	jne    8019ed <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801976:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80197b:	48 89 da             	mov    %rbx,%rdx
+  80197e:	be 00 10 00 00       	mov    $0x1000,%esi
+  801983:	4c 89 e7             	mov    %r12,%rdi
+  801986:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801989:	85 c0                	test   %eax,%eax
+  80198b:	74 72                	je     8019ff <devpipe_read+0xe1>
+            sys_yield();
+  80198d:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801990:	8b 03                	mov    (%rbx),%eax
+  801992:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801995:	74 df                	je     801976 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801997:	48 63 c8             	movslq %eax,%rcx
+  80199a:	48 89 ca             	mov    %rcx,%rdx
+  80199d:	48 c1 ea 03          	shr    $0x3,%rdx
+  8019a1:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8019a8:	08 10 20 
+  8019ab:	48 89 d0             	mov    %rdx,%rax
+  8019ae:	48 f7 e6             	mul    %rsi
+  8019b1:	48 c1 ea 06          	shr    $0x6,%rdx
+  8019b5:	48 89 d0             	mov    %rdx,%rax
+  8019b8:	48 c1 e0 09          	shl    $0x9,%rax
+  8019bc:	48 29 d0             	sub    %rdx,%rax
+  8019bf:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8019c6:	00 
+  8019c7:	48 89 c8             	mov    %rcx,%rax
+  8019ca:	48 29 d0             	sub    %rdx,%rax
+  8019cd:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8019d2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8019d6:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8019da:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8019dd:	49 83 c7 01          	add    $0x1,%r15
+  8019e1:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8019e5:	75 83                	jne    80196a <devpipe_read+0x4c>
+    return n;
+  8019e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019eb:	eb 03                	jmp    8019f0 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8019ed:	4c 89 f8             	mov    %r15,%rax
+}
+  8019f0:	48 83 c4 18          	add    $0x18,%rsp
+  8019f4:	5b                   	pop    %rbx
+  8019f5:	41 5c                	pop    %r12
+  8019f7:	41 5d                	pop    %r13
+  8019f9:	41 5e                	pop    %r14
+  8019fb:	41 5f                	pop    %r15
+  8019fd:	5d                   	pop    %rbp
+  8019fe:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8019ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a04:	eb ea                	jmp    8019f0 <devpipe_read+0xd2>
+
+0000000000801a06 <pipe>:
+pipe(int pfd[2]) {
+  801a06:	55                   	push   %rbp
+  801a07:	48 89 e5             	mov    %rsp,%rbp
+  801a0a:	41 55                	push   %r13
+  801a0c:	41 54                	push   %r12
+  801a0e:	53                   	push   %rbx
+  801a0f:	48 83 ec 18          	sub    $0x18,%rsp
+  801a13:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801a16:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801a1a:	48 b8 9b 0d 80 00 00 	movabs $0x800d9b,%rax
+  801a21:	00 00 00 
+  801a24:	ff d0                	call   *%rax
+  801a26:	89 c3                	mov    %eax,%ebx
+  801a28:	85 c0                	test   %eax,%eax
+  801a2a:	0f 88 a0 01 00 00    	js     801bd0 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  801a30:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801a35:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a3a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801a3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a43:	48 b8 cb 07 80 00 00 	movabs $0x8007cb,%rax
+  801a4a:	00 00 00 
+  801a4d:	ff d0                	call   *%rax
+  801a4f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801a51:	85 c0                	test   %eax,%eax
+  801a53:	0f 88 77 01 00 00    	js     801bd0 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801a59:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801a5d:	48 b8 9b 0d 80 00 00 	movabs $0x800d9b,%rax
+  801a64:	00 00 00 
+  801a67:	ff d0                	call   *%rax
+  801a69:	89 c3                	mov    %eax,%ebx
+  801a6b:	85 c0                	test   %eax,%eax
+  801a6d:	0f 88 43 01 00 00    	js     801bb6 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801a73:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801a78:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a7d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801a81:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a86:	48 b8 cb 07 80 00 00 	movabs $0x8007cb,%rax
+  801a8d:	00 00 00 
+  801a90:	ff d0                	call   *%rax
+  801a92:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801a94:	85 c0                	test   %eax,%eax
+  801a96:	0f 88 1a 01 00 00    	js     801bb6 <pipe+0x1b0>
+    va = fd2data(fd0);
+  801a9c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801aa0:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  801aa7:	00 00 00 
+  801aaa:	ff d0                	call   *%rax
+  801aac:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801aaf:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ab4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ab9:	48 89 c6             	mov    %rax,%rsi
+  801abc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ac1:	48 b8 cb 07 80 00 00 	movabs $0x8007cb,%rax
+  801ac8:	00 00 00 
+  801acb:	ff d0                	call   *%rax
+  801acd:	89 c3                	mov    %eax,%ebx
+  801acf:	85 c0                	test   %eax,%eax
+  801ad1:	0f 88 c5 00 00 00    	js     801b9c <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801ad7:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801adb:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  801ae2:	00 00 00 
+  801ae5:	ff d0                	call   *%rax
+  801ae7:	48 89 c1             	mov    %rax,%rcx
+  801aea:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  801af0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801af6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801afb:	4c 89 ee             	mov    %r13,%rsi
+  801afe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b03:	48 b8 32 08 80 00 00 	movabs $0x800832,%rax
+  801b0a:	00 00 00 
+  801b0d:	ff d0                	call   *%rax
+  801b0f:	89 c3                	mov    %eax,%ebx
+  801b11:	85 c0                	test   %eax,%eax
+  801b13:	78 6e                	js     801b83 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801b15:	be 00 10 00 00       	mov    $0x1000,%esi
+  801b1a:	4c 89 ef             	mov    %r13,%rdi
+  801b1d:	48 b8 6d 07 80 00 00 	movabs $0x80076d,%rax
+  801b24:	00 00 00 
+  801b27:	ff d0                	call   *%rax
+  801b29:	83 f8 02             	cmp    $0x2,%eax
+  801b2c:	0f 85 ab 00 00 00    	jne    801bdd <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801b32:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  801b39:	00 00 
+  801b3b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801b3f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801b41:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801b45:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801b4c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801b50:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801b52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b56:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801b5d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801b61:	48 bb 6d 0d 80 00 00 	movabs $0x800d6d,%rbx
+  801b68:	00 00 00 
+  801b6b:	ff d3                	call   *%rbx
+  801b6d:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801b71:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801b75:	ff d3                	call   *%rbx
+  801b77:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  801b7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b81:	eb 4d                	jmp    801bd0 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  801b83:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b88:	4c 89 ee             	mov    %r13,%rsi
+  801b8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b90:	48 b8 97 08 80 00 00 	movabs $0x800897,%rax
+  801b97:	00 00 00 
+  801b9a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  801b9c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ba1:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801ba5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801baa:	48 b8 97 08 80 00 00 	movabs $0x800897,%rax
+  801bb1:	00 00 00 
+  801bb4:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  801bb6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bbb:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801bbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bc4:	48 b8 97 08 80 00 00 	movabs $0x800897,%rax
+  801bcb:	00 00 00 
+  801bce:	ff d0                	call   *%rax
+}
+  801bd0:	89 d8                	mov    %ebx,%eax
+  801bd2:	48 83 c4 18          	add    $0x18,%rsp
+  801bd6:	5b                   	pop    %rbx
+  801bd7:	41 5c                	pop    %r12
+  801bd9:	41 5d                	pop    %r13
+  801bdb:	5d                   	pop    %rbp
+  801bdc:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801bdd:	48 b9 10 2d 80 00 00 	movabs $0x802d10,%rcx
+  801be4:	00 00 00 
+  801be7:	48 ba e7 2c 80 00 00 	movabs $0x802ce7,%rdx
+  801bee:	00 00 00 
+  801bf1:	be 2e 00 00 00       	mov    $0x2e,%esi
+  801bf6:	48 bf fc 2c 80 00 00 	movabs $0x802cfc,%rdi
+  801bfd:	00 00 00 
+  801c00:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c05:	49 b8 40 20 80 00 00 	movabs $0x802040,%r8
+  801c0c:	00 00 00 
+  801c0f:	41 ff d0             	call   *%r8
+
+0000000000801c12 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  801c12:	55                   	push   %rbp
+  801c13:	48 89 e5             	mov    %rsp,%rbp
+  801c16:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801c1a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c1e:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  801c25:	00 00 00 
+  801c28:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c2a:	85 c0                	test   %eax,%eax
+  801c2c:	78 35                	js     801c63 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  801c2e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c32:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  801c39:	00 00 00 
+  801c3c:	ff d0                	call   *%rax
+  801c3e:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801c41:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801c46:	be 00 10 00 00       	mov    $0x1000,%esi
+  801c4b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c4f:	48 b8 9f 07 80 00 00 	movabs $0x80079f,%rax
+  801c56:	00 00 00 
+  801c59:	ff d0                	call   *%rax
+  801c5b:	85 c0                	test   %eax,%eax
+  801c5d:	0f 94 c0             	sete   %al
+  801c60:	0f b6 c0             	movzbl %al,%eax
+}
+  801c63:	c9                   	leave
+  801c64:	c3                   	ret
+
+0000000000801c65 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801c65:	48 89 f8             	mov    %rdi,%rax
+  801c68:	48 c1 e8 27          	shr    $0x27,%rax
+  801c6c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801c73:	01 00 00 
+  801c76:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801c7a:	f6 c2 01             	test   $0x1,%dl
+  801c7d:	74 6d                	je     801cec <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801c7f:	48 89 f8             	mov    %rdi,%rax
+  801c82:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801c86:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801c8d:	01 00 00 
+  801c90:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801c94:	f6 c2 01             	test   $0x1,%dl
+  801c97:	74 62                	je     801cfb <get_uvpt_entry+0x96>
+  801c99:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801ca0:	01 00 00 
+  801ca3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801ca7:	f6 c2 80             	test   $0x80,%dl
+  801caa:	75 4f                	jne    801cfb <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801cac:	48 89 f8             	mov    %rdi,%rax
+  801caf:	48 c1 e8 15          	shr    $0x15,%rax
+  801cb3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801cba:	01 00 00 
+  801cbd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801cc1:	f6 c2 01             	test   $0x1,%dl
+  801cc4:	74 44                	je     801d0a <get_uvpt_entry+0xa5>
+  801cc6:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801ccd:	01 00 00 
+  801cd0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801cd4:	f6 c2 80             	test   $0x80,%dl
+  801cd7:	75 31                	jne    801d0a <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  801cd9:	48 c1 ef 0c          	shr    $0xc,%rdi
+  801cdd:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801ce4:	01 00 00 
+  801ce7:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  801ceb:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801cec:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801cf3:	01 00 00 
+  801cf6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801cfa:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801cfb:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801d02:	01 00 00 
+  801d05:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801d09:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801d0a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801d11:	01 00 00 
+  801d14:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801d18:	c3                   	ret
+
+0000000000801d19 <get_prot>:
+
+int
+get_prot(void *va) {
+  801d19:	55                   	push   %rbp
+  801d1a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801d1d:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  801d24:	00 00 00 
+  801d27:	ff d0                	call   *%rax
+  801d29:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  801d2c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  801d31:	89 c1                	mov    %eax,%ecx
+  801d33:	83 c9 04             	or     $0x4,%ecx
+  801d36:	f6 c2 01             	test   $0x1,%dl
+  801d39:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  801d3c:	89 c1                	mov    %eax,%ecx
+  801d3e:	83 c9 02             	or     $0x2,%ecx
+  801d41:	f6 c2 02             	test   $0x2,%dl
+  801d44:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  801d47:	89 c1                	mov    %eax,%ecx
+  801d49:	83 c9 01             	or     $0x1,%ecx
+  801d4c:	48 85 d2             	test   %rdx,%rdx
+  801d4f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801d52:	89 c1                	mov    %eax,%ecx
+  801d54:	83 c9 40             	or     $0x40,%ecx
+  801d57:	f6 c6 04             	test   $0x4,%dh
+  801d5a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  801d5d:	5d                   	pop    %rbp
+  801d5e:	c3                   	ret
+
+0000000000801d5f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  801d5f:	55                   	push   %rbp
+  801d60:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801d63:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  801d6a:	00 00 00 
+  801d6d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  801d6f:	48 c1 e8 06          	shr    $0x6,%rax
+  801d73:	83 e0 01             	and    $0x1,%eax
+}
+  801d76:	5d                   	pop    %rbp
+  801d77:	c3                   	ret
+
+0000000000801d78 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  801d78:	55                   	push   %rbp
+  801d79:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  801d7c:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  801d83:	00 00 00 
+  801d86:	ff d0                	call   *%rax
+  801d88:	83 e0 01             	and    $0x1,%eax
+}
+  801d8b:	5d                   	pop    %rbp
+  801d8c:	c3                   	ret
+
+0000000000801d8d <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  801d8d:	55                   	push   %rbp
+  801d8e:	48 89 e5             	mov    %rsp,%rbp
+  801d91:	41 57                	push   %r15
+  801d93:	41 56                	push   %r14
+  801d95:	41 55                	push   %r13
+  801d97:	41 54                	push   %r12
+  801d99:	53                   	push   %rbx
+  801d9a:	48 83 ec 18          	sub    $0x18,%rsp
+  801d9e:	49 89 ff             	mov    %rdi,%r15
+  801da1:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  801da5:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  801daa:	49 bc 78 1d 80 00 00 	movabs $0x801d78,%r12
+  801db1:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  801db4:	49 be 19 1d 80 00 00 	movabs $0x801d19,%r14
+  801dbb:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  801dbe:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  801dc5:	00 00 00 
+  801dc8:	eb 0c                	jmp    801dd6 <foreach_shared_region+0x49>
+  801dca:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801dd1:	4c 39 eb             	cmp    %r13,%rbx
+  801dd4:	74 38                	je     801e0e <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  801dd6:	48 89 df             	mov    %rbx,%rdi
+  801dd9:	41 ff d4             	call   *%r12
+  801ddc:	84 c0                	test   %al,%al
+  801dde:	74 ea                	je     801dca <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  801de0:	48 89 df             	mov    %rbx,%rdi
+  801de3:	41 ff d6             	call   *%r14
+  801de6:	a8 40                	test   $0x40,%al
+  801de8:	74 e0                	je     801dca <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  801dea:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  801df1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801df5:	48 89 df             	mov    %rbx,%rdi
+  801df8:	41 ff d7             	call   *%r15
+        if (err)
+  801dfb:	85 c0                	test   %eax,%eax
+  801dfd:	74 cb                	je     801dca <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  801dff:	48 83 c4 18          	add    $0x18,%rsp
+  801e03:	5b                   	pop    %rbx
+  801e04:	41 5c                	pop    %r12
+  801e06:	41 5d                	pop    %r13
+  801e08:	41 5e                	pop    %r14
+  801e0a:	41 5f                	pop    %r15
+  801e0c:	5d                   	pop    %rbp
+  801e0d:	c3                   	ret
+    return 0;
+  801e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e13:	eb ea                	jmp    801dff <foreach_shared_region+0x72>
+
+0000000000801e15 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  801e15:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1a:	c3                   	ret
+
+0000000000801e1b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  801e1b:	55                   	push   %rbp
+  801e1c:	48 89 e5             	mov    %rsp,%rbp
+  801e1f:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  801e22:	48 be 34 2d 80 00 00 	movabs $0x802d34,%rsi
+  801e29:	00 00 00 
+  801e2c:	48 b8 1b 02 80 00 00 	movabs $0x80021b,%rax
+  801e33:	00 00 00 
+  801e36:	ff d0                	call   *%rax
+    return 0;
+}
+  801e38:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e3d:	5d                   	pop    %rbp
+  801e3e:	c3                   	ret
+
+0000000000801e3f <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801e3f:	55                   	push   %rbp
+  801e40:	48 89 e5             	mov    %rsp,%rbp
+  801e43:	41 57                	push   %r15
+  801e45:	41 56                	push   %r14
+  801e47:	41 55                	push   %r13
+  801e49:	41 54                	push   %r12
+  801e4b:	53                   	push   %rbx
+  801e4c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801e53:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801e5a:	48 85 d2             	test   %rdx,%rdx
+  801e5d:	74 7a                	je     801ed9 <devcons_write+0x9a>
+  801e5f:	49 89 d6             	mov    %rdx,%r14
+  801e62:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801e68:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801e6d:	49 bf 15 04 80 00 00 	movabs $0x800415,%r15
+  801e74:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801e77:	4c 89 f3             	mov    %r14,%rbx
+  801e7a:	48 29 f3             	sub    %rsi,%rbx
+  801e7d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801e82:	48 39 c3             	cmp    %rax,%rbx
+  801e85:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801e89:	4c 63 eb             	movslq %ebx,%r13
+  801e8c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801e93:	48 01 c6             	add    %rax,%rsi
+  801e96:	4c 89 ea             	mov    %r13,%rdx
+  801e99:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801ea0:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801ea3:	4c 89 ee             	mov    %r13,%rsi
+  801ea6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801ead:	48 b8 42 06 80 00 00 	movabs $0x800642,%rax
+  801eb4:	00 00 00 
+  801eb7:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801eb9:	41 01 dc             	add    %ebx,%r12d
+  801ebc:	49 63 f4             	movslq %r12d,%rsi
+  801ebf:	4c 39 f6             	cmp    %r14,%rsi
+  801ec2:	72 b3                	jb     801e77 <devcons_write+0x38>
+    return res;
+  801ec4:	49 63 c4             	movslq %r12d,%rax
+}
+  801ec7:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801ece:	5b                   	pop    %rbx
+  801ecf:	41 5c                	pop    %r12
+  801ed1:	41 5d                	pop    %r13
+  801ed3:	41 5e                	pop    %r14
+  801ed5:	41 5f                	pop    %r15
+  801ed7:	5d                   	pop    %rbp
+  801ed8:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801ed9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801edf:	eb e3                	jmp    801ec4 <devcons_write+0x85>
+
+0000000000801ee1 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801ee1:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801ee4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee9:	48 85 c0             	test   %rax,%rax
+  801eec:	74 55                	je     801f43 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801eee:	55                   	push   %rbp
+  801eef:	48 89 e5             	mov    %rsp,%rbp
+  801ef2:	41 55                	push   %r13
+  801ef4:	41 54                	push   %r12
+  801ef6:	53                   	push   %rbx
+  801ef7:	48 83 ec 08          	sub    $0x8,%rsp
+  801efb:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  801efe:	48 bb 6f 06 80 00 00 	movabs $0x80066f,%rbx
+  801f05:	00 00 00 
+  801f08:	49 bc 3c 07 80 00 00 	movabs $0x80073c,%r12
+  801f0f:	00 00 00 
+  801f12:	eb 03                	jmp    801f17 <devcons_read+0x36>
+  801f14:	41 ff d4             	call   *%r12
+  801f17:	ff d3                	call   *%rbx
+  801f19:	85 c0                	test   %eax,%eax
+  801f1b:	74 f7                	je     801f14 <devcons_read+0x33>
+    if (c < 0) return c;
+  801f1d:	48 63 d0             	movslq %eax,%rdx
+  801f20:	78 13                	js     801f35 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  801f22:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f27:	83 f8 04             	cmp    $0x4,%eax
+  801f2a:	74 09                	je     801f35 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801f2c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801f30:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801f35:	48 89 d0             	mov    %rdx,%rax
+  801f38:	48 83 c4 08          	add    $0x8,%rsp
+  801f3c:	5b                   	pop    %rbx
+  801f3d:	41 5c                	pop    %r12
+  801f3f:	41 5d                	pop    %r13
+  801f41:	5d                   	pop    %rbp
+  801f42:	c3                   	ret
+  801f43:	48 89 d0             	mov    %rdx,%rax
+  801f46:	c3                   	ret
+
+0000000000801f47 <cputchar>:
+cputchar(int ch) {
+  801f47:	55                   	push   %rbp
+  801f48:	48 89 e5             	mov    %rsp,%rbp
+  801f4b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801f4f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801f53:	be 01 00 00 00       	mov    $0x1,%esi
+  801f58:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801f5c:	48 b8 42 06 80 00 00 	movabs $0x800642,%rax
+  801f63:	00 00 00 
+  801f66:	ff d0                	call   *%rax
+}
+  801f68:	c9                   	leave
+  801f69:	c3                   	ret
+
+0000000000801f6a <getchar>:
+getchar(void) {
+  801f6a:	55                   	push   %rbp
+  801f6b:	48 89 e5             	mov    %rsp,%rbp
+  801f6e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801f72:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f77:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801f7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f80:	48 b8 de 10 80 00 00 	movabs $0x8010de,%rax
+  801f87:	00 00 00 
+  801f8a:	ff d0                	call   *%rax
+  801f8c:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801f8e:	85 c0                	test   %eax,%eax
+  801f90:	78 06                	js     801f98 <getchar+0x2e>
+  801f92:	74 08                	je     801f9c <getchar+0x32>
+  801f94:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801f98:	89 d0                	mov    %edx,%eax
+  801f9a:	c9                   	leave
+  801f9b:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801f9c:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801fa1:	eb f5                	jmp    801f98 <getchar+0x2e>
+
+0000000000801fa3 <iscons>:
+iscons(int fdnum) {
+  801fa3:	55                   	push   %rbp
+  801fa4:	48 89 e5             	mov    %rsp,%rbp
+  801fa7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801fab:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801faf:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  801fb6:	00 00 00 
+  801fb9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801fbb:	85 c0                	test   %eax,%eax
+  801fbd:	78 18                	js     801fd7 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801fbf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801fc3:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801fca:	00 00 00 
+  801fcd:	8b 00                	mov    (%rax),%eax
+  801fcf:	39 02                	cmp    %eax,(%rdx)
+  801fd1:	0f 94 c0             	sete   %al
+  801fd4:	0f b6 c0             	movzbl %al,%eax
+}
+  801fd7:	c9                   	leave
+  801fd8:	c3                   	ret
+
+0000000000801fd9 <opencons>:
+opencons(void) {
+  801fd9:	55                   	push   %rbp
+  801fda:	48 89 e5             	mov    %rsp,%rbp
+  801fdd:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801fe1:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801fe5:	48 b8 9b 0d 80 00 00 	movabs $0x800d9b,%rax
+  801fec:	00 00 00 
+  801fef:	ff d0                	call   *%rax
+  801ff1:	85 c0                	test   %eax,%eax
+  801ff3:	78 49                	js     80203e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801ff5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ffa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801fff:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802003:	bf 00 00 00 00       	mov    $0x0,%edi
+  802008:	48 b8 cb 07 80 00 00 	movabs $0x8007cb,%rax
+  80200f:	00 00 00 
+  802012:	ff d0                	call   *%rax
+  802014:	85 c0                	test   %eax,%eax
+  802016:	78 26                	js     80203e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802018:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80201c:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802023:	00 00 
+  802025:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802027:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80202b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802032:	48 b8 6d 0d 80 00 00 	movabs $0x800d6d,%rax
+  802039:	00 00 00 
+  80203c:	ff d0                	call   *%rax
+}
+  80203e:	c9                   	leave
+  80203f:	c3                   	ret
+
+0000000000802040 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802040:	55                   	push   %rbp
+  802041:	48 89 e5             	mov    %rsp,%rbp
+  802044:	41 56                	push   %r14
+  802046:	41 55                	push   %r13
+  802048:	41 54                	push   %r12
+  80204a:	53                   	push   %rbx
+  80204b:	48 83 ec 50          	sub    $0x50,%rsp
+  80204f:	49 89 fc             	mov    %rdi,%r12
+  802052:	41 89 f5             	mov    %esi,%r13d
+  802055:	48 89 d3             	mov    %rdx,%rbx
+  802058:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80205c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802060:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802064:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80206b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80206f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802073:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802077:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80207b:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802082:	00 00 00 
+  802085:	4c 8b 30             	mov    (%rax),%r14
+  802088:	48 b8 0b 07 80 00 00 	movabs $0x80070b,%rax
+  80208f:	00 00 00 
+  802092:	ff d0                	call   *%rax
+  802094:	89 c6                	mov    %eax,%esi
+  802096:	45 89 e8             	mov    %r13d,%r8d
+  802099:	4c 89 e1             	mov    %r12,%rcx
+  80209c:	4c 89 f2             	mov    %r14,%rdx
+  80209f:	48 bf 40 2d 80 00 00 	movabs $0x802d40,%rdi
+  8020a6:	00 00 00 
+  8020a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ae:	49 bc 90 21 80 00 00 	movabs $0x802190,%r12
+  8020b5:	00 00 00 
+  8020b8:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8020bb:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8020bf:	48 89 df             	mov    %rbx,%rdi
+  8020c2:	48 b8 2c 21 80 00 00 	movabs $0x80212c,%rax
+  8020c9:	00 00 00 
+  8020cc:	ff d0                	call   *%rax
+    cprintf("\n");
+  8020ce:	48 bf 9b 2c 80 00 00 	movabs $0x802c9b,%rdi
+  8020d5:	00 00 00 
+  8020d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020dd:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8020e0:	cc                   	int3
+  8020e1:	eb fd                	jmp    8020e0 <_panic+0xa0>
+
+00000000008020e3 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8020e3:	55                   	push   %rbp
+  8020e4:	48 89 e5             	mov    %rsp,%rbp
+  8020e7:	53                   	push   %rbx
+  8020e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8020ec:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8020ef:	8b 06                	mov    (%rsi),%eax
+  8020f1:	8d 50 01             	lea    0x1(%rax),%edx
+  8020f4:	89 16                	mov    %edx,(%rsi)
+  8020f6:	48 98                	cltq
+  8020f8:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8020fd:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802103:	74 0a                	je     80210f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802105:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802109:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80210d:	c9                   	leave
+  80210e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80210f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802113:	be ff 00 00 00       	mov    $0xff,%esi
+  802118:	48 b8 42 06 80 00 00 	movabs $0x800642,%rax
+  80211f:	00 00 00 
+  802122:	ff d0                	call   *%rax
+        state->offset = 0;
+  802124:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80212a:	eb d9                	jmp    802105 <putch+0x22>
+
+000000000080212c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80212c:	55                   	push   %rbp
+  80212d:	48 89 e5             	mov    %rsp,%rbp
+  802130:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802137:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80213a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802141:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802146:	b8 00 00 00 00       	mov    $0x0,%eax
+  80214b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80214e:	48 89 f1             	mov    %rsi,%rcx
+  802151:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802158:	48 bf e3 20 80 00 00 	movabs $0x8020e3,%rdi
+  80215f:	00 00 00 
+  802162:	48 b8 e0 22 80 00 00 	movabs $0x8022e0,%rax
+  802169:	00 00 00 
+  80216c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80216e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802175:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80217c:	48 b8 42 06 80 00 00 	movabs $0x800642,%rax
+  802183:	00 00 00 
+  802186:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802188:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80218e:	c9                   	leave
+  80218f:	c3                   	ret
+
+0000000000802190 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  802190:	55                   	push   %rbp
+  802191:	48 89 e5             	mov    %rsp,%rbp
+  802194:	48 83 ec 50          	sub    $0x50,%rsp
+  802198:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80219c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8021a0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8021a4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8021a8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8021ac:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8021b3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8021b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021bb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8021bf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8021c3:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8021c7:	48 b8 2c 21 80 00 00 	movabs $0x80212c,%rax
+  8021ce:	00 00 00 
+  8021d1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8021d3:	c9                   	leave
+  8021d4:	c3                   	ret
+
+00000000008021d5 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8021d5:	55                   	push   %rbp
+  8021d6:	48 89 e5             	mov    %rsp,%rbp
+  8021d9:	41 57                	push   %r15
+  8021db:	41 56                	push   %r14
+  8021dd:	41 55                	push   %r13
+  8021df:	41 54                	push   %r12
+  8021e1:	53                   	push   %rbx
+  8021e2:	48 83 ec 18          	sub    $0x18,%rsp
+  8021e6:	49 89 fc             	mov    %rdi,%r12
+  8021e9:	49 89 f5             	mov    %rsi,%r13
+  8021ec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8021f0:	8b 45 10             	mov    0x10(%rbp),%eax
+  8021f3:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8021f6:	41 89 cf             	mov    %ecx,%r15d
+  8021f9:	4c 39 fa             	cmp    %r15,%rdx
+  8021fc:	73 5b                	jae    802259 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8021fe:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802202:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  802206:	85 db                	test   %ebx,%ebx
+  802208:	7e 0e                	jle    802218 <print_num+0x43>
+            putch(padc, put_arg);
+  80220a:	4c 89 ee             	mov    %r13,%rsi
+  80220d:	44 89 f7             	mov    %r14d,%edi
+  802210:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802213:	83 eb 01             	sub    $0x1,%ebx
+  802216:	75 f2                	jne    80220a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802218:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80221c:	48 b9 74 2d 80 00 00 	movabs $0x802d74,%rcx
+  802223:	00 00 00 
+  802226:	48 b8 63 2d 80 00 00 	movabs $0x802d63,%rax
+  80222d:	00 00 00 
+  802230:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802234:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802238:	ba 00 00 00 00       	mov    $0x0,%edx
+  80223d:	49 f7 f7             	div    %r15
+  802240:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802244:	4c 89 ee             	mov    %r13,%rsi
+  802247:	41 ff d4             	call   *%r12
+}
+  80224a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80224e:	5b                   	pop    %rbx
+  80224f:	41 5c                	pop    %r12
+  802251:	41 5d                	pop    %r13
+  802253:	41 5e                	pop    %r14
+  802255:	41 5f                	pop    %r15
+  802257:	5d                   	pop    %rbp
+  802258:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802259:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80225d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802262:	49 f7 f7             	div    %r15
+  802265:	48 83 ec 08          	sub    $0x8,%rsp
+  802269:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80226d:	52                   	push   %rdx
+  80226e:	45 0f be c9          	movsbl %r9b,%r9d
+  802272:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802276:	48 89 c2             	mov    %rax,%rdx
+  802279:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  802280:	00 00 00 
+  802283:	ff d0                	call   *%rax
+  802285:	48 83 c4 10          	add    $0x10,%rsp
+  802289:	eb 8d                	jmp    802218 <print_num+0x43>
+
+000000000080228b <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80228b:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80228f:	48 8b 06             	mov    (%rsi),%rax
+  802292:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802296:	73 0a                	jae    8022a2 <sprintputch+0x17>
+        *state->start++ = ch;
+  802298:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80229c:	48 89 16             	mov    %rdx,(%rsi)
+  80229f:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8022a2:	c3                   	ret
+
+00000000008022a3 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8022a3:	55                   	push   %rbp
+  8022a4:	48 89 e5             	mov    %rsp,%rbp
+  8022a7:	48 83 ec 50          	sub    $0x50,%rsp
+  8022ab:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8022af:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8022b3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8022b7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8022be:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8022c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022c6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8022ca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8022ce:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8022d2:	48 b8 e0 22 80 00 00 	movabs $0x8022e0,%rax
+  8022d9:	00 00 00 
+  8022dc:	ff d0                	call   *%rax
+}
+  8022de:	c9                   	leave
+  8022df:	c3                   	ret
+
+00000000008022e0 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8022e0:	55                   	push   %rbp
+  8022e1:	48 89 e5             	mov    %rsp,%rbp
+  8022e4:	41 57                	push   %r15
+  8022e6:	41 56                	push   %r14
+  8022e8:	41 55                	push   %r13
+  8022ea:	41 54                	push   %r12
+  8022ec:	53                   	push   %rbx
+  8022ed:	48 83 ec 38          	sub    $0x38,%rsp
+  8022f1:	49 89 fe             	mov    %rdi,%r14
+  8022f4:	49 89 f5             	mov    %rsi,%r13
+  8022f7:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8022fa:	48 8b 01             	mov    (%rcx),%rax
+  8022fd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802301:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802305:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802309:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80230d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  802311:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802315:	0f b6 3b             	movzbl (%rbx),%edi
+  802318:	40 80 ff 25          	cmp    $0x25,%dil
+  80231c:	74 18                	je     802336 <vprintfmt+0x56>
+            if (!ch) return;
+  80231e:	40 84 ff             	test   %dil,%dil
+  802321:	0f 84 b1 06 00 00    	je     8029d8 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802327:	40 0f b6 ff          	movzbl %dil,%edi
+  80232b:	4c 89 ee             	mov    %r13,%rsi
+  80232e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802331:	4c 89 e3             	mov    %r12,%rbx
+  802334:	eb db                	jmp    802311 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802336:	be 00 00 00 00       	mov    $0x0,%esi
+  80233b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80233f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802344:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80234a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802351:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802355:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80235a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80235f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802362:	83 e8 23             	sub    $0x23,%eax
+  802365:	3c 57                	cmp    $0x57,%al
+  802367:	0f 87 51 06 00 00    	ja     8029be <vprintfmt+0x6de>
+  80236d:	0f b6 c0             	movzbl %al,%eax
+  802370:	48 b9 20 2f 80 00 00 	movabs $0x802f20,%rcx
+  802377:	00 00 00 
+  80237a:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80237d:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802380:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802384:	eb cf                	jmp    802355 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802386:	49 89 dc             	mov    %rbx,%r12
+  802389:	be 01 00 00 00       	mov    $0x1,%esi
+  80238e:	eb c5                	jmp    802355 <vprintfmt+0x75>
+            padc = ch;
+  802390:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802394:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802397:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80239a:	eb b9                	jmp    802355 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80239c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80239f:	83 f8 2f             	cmp    $0x2f,%eax
+  8023a2:	77 24                	ja     8023c8 <vprintfmt+0xe8>
+  8023a4:	89 c1                	mov    %eax,%ecx
+  8023a6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8023aa:	83 c0 08             	add    $0x8,%eax
+  8023ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023b0:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8023b3:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8023b6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8023ba:	79 99                	jns    802355 <vprintfmt+0x75>
+                width = precision;
+  8023bc:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8023c0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8023c6:	eb 8d                	jmp    802355 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8023c8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8023cc:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8023d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023d4:	eb da                	jmp    8023b0 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8023d6:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8023db:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8023df:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8023e5:	3c 39                	cmp    $0x39,%al
+  8023e7:	77 1c                	ja     802405 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8023e9:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8023ed:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8023f1:	0f b6 c0             	movzbl %al,%eax
+  8023f4:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8023f9:	0f b6 03             	movzbl (%rbx),%eax
+  8023fc:	3c 39                	cmp    $0x39,%al
+  8023fe:	76 e9                	jbe    8023e9 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802400:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802403:	eb b1                	jmp    8023b6 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802405:	49 89 dc             	mov    %rbx,%r12
+  802408:	eb ac                	jmp    8023b6 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80240a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80240d:	85 c9                	test   %ecx,%ecx
+  80240f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802414:	0f 49 c1             	cmovns %ecx,%eax
+  802417:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80241a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80241d:	e9 33 ff ff ff       	jmp    802355 <vprintfmt+0x75>
+            lflag++;
+  802422:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802425:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802428:	e9 28 ff ff ff       	jmp    802355 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80242d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802430:	83 f8 2f             	cmp    $0x2f,%eax
+  802433:	77 19                	ja     80244e <vprintfmt+0x16e>
+  802435:	89 c2                	mov    %eax,%edx
+  802437:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80243b:	83 c0 08             	add    $0x8,%eax
+  80243e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802441:	8b 3a                	mov    (%rdx),%edi
+  802443:	4c 89 ee             	mov    %r13,%rsi
+  802446:	41 ff d6             	call   *%r14
+            break;
+  802449:	e9 c3 fe ff ff       	jmp    802311 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80244e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802452:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802456:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80245a:	eb e5                	jmp    802441 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80245c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80245f:	83 f8 2f             	cmp    $0x2f,%eax
+  802462:	77 5a                	ja     8024be <vprintfmt+0x1de>
+  802464:	89 c2                	mov    %eax,%edx
+  802466:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80246a:	83 c0 08             	add    $0x8,%eax
+  80246d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802470:	8b 02                	mov    (%rdx),%eax
+  802472:	89 c1                	mov    %eax,%ecx
+  802474:	f7 d9                	neg    %ecx
+  802476:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802479:	83 f9 15             	cmp    $0x15,%ecx
+  80247c:	7f 4e                	jg     8024cc <vprintfmt+0x1ec>
+  80247e:	48 63 c1             	movslq %ecx,%rax
+  802481:	48 ba e0 31 80 00 00 	movabs $0x8031e0,%rdx
+  802488:	00 00 00 
+  80248b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80248f:	48 85 c0             	test   %rax,%rax
+  802492:	74 38                	je     8024cc <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802494:	48 89 c1             	mov    %rax,%rcx
+  802497:	48 ba f9 2c 80 00 00 	movabs $0x802cf9,%rdx
+  80249e:	00 00 00 
+  8024a1:	4c 89 ee             	mov    %r13,%rsi
+  8024a4:	4c 89 f7             	mov    %r14,%rdi
+  8024a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ac:	49 b8 a3 22 80 00 00 	movabs $0x8022a3,%r8
+  8024b3:	00 00 00 
+  8024b6:	41 ff d0             	call   *%r8
+  8024b9:	e9 53 fe ff ff       	jmp    802311 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8024be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024ca:	eb a4                	jmp    802470 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8024cc:	48 ba 8c 2d 80 00 00 	movabs $0x802d8c,%rdx
+  8024d3:	00 00 00 
+  8024d6:	4c 89 ee             	mov    %r13,%rsi
+  8024d9:	4c 89 f7             	mov    %r14,%rdi
+  8024dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e1:	49 b8 a3 22 80 00 00 	movabs $0x8022a3,%r8
+  8024e8:	00 00 00 
+  8024eb:	41 ff d0             	call   *%r8
+  8024ee:	e9 1e fe ff ff       	jmp    802311 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8024f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8024f9:	77 6c                	ja     802567 <vprintfmt+0x287>
+  8024fb:	89 c2                	mov    %eax,%edx
+  8024fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802501:	83 c0 08             	add    $0x8,%eax
+  802504:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802507:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80250a:	48 85 d2             	test   %rdx,%rdx
+  80250d:	48 b8 85 2d 80 00 00 	movabs $0x802d85,%rax
+  802514:	00 00 00 
+  802517:	48 0f 45 c2          	cmovne %rdx,%rax
+  80251b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80251f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802523:	7e 06                	jle    80252b <vprintfmt+0x24b>
+  802525:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802529:	75 4a                	jne    802575 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80252b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80252f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  802533:	0f b6 00             	movzbl (%rax),%eax
+  802536:	84 c0                	test   %al,%al
+  802538:	0f 85 9a 00 00 00    	jne    8025d8 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80253e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802541:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802545:	85 c0                	test   %eax,%eax
+  802547:	0f 8e c4 fd ff ff    	jle    802311 <vprintfmt+0x31>
+  80254d:	4c 89 ee             	mov    %r13,%rsi
+  802550:	bf 20 00 00 00       	mov    $0x20,%edi
+  802555:	41 ff d6             	call   *%r14
+  802558:	41 83 ec 01          	sub    $0x1,%r12d
+  80255c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802560:	75 eb                	jne    80254d <vprintfmt+0x26d>
+  802562:	e9 aa fd ff ff       	jmp    802311 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802567:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80256b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80256f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802573:	eb 92                	jmp    802507 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802575:	49 63 f7             	movslq %r15d,%rsi
+  802578:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80257c:	48 b8 f8 01 80 00 00 	movabs $0x8001f8,%rax
+  802583:	00 00 00 
+  802586:	ff d0                	call   *%rax
+  802588:	48 89 c2             	mov    %rax,%rdx
+  80258b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80258e:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802590:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802593:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802596:	85 c0                	test   %eax,%eax
+  802598:	7e 91                	jle    80252b <vprintfmt+0x24b>
+  80259a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80259f:	4c 89 ee             	mov    %r13,%rsi
+  8025a2:	44 89 e7             	mov    %r12d,%edi
+  8025a5:	41 ff d6             	call   *%r14
+  8025a8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8025ac:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8025af:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8025b2:	75 eb                	jne    80259f <vprintfmt+0x2bf>
+  8025b4:	e9 72 ff ff ff       	jmp    80252b <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8025b9:	0f b6 f8             	movzbl %al,%edi
+  8025bc:	4c 89 ee             	mov    %r13,%rsi
+  8025bf:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8025c2:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8025c6:	49 83 c4 01          	add    $0x1,%r12
+  8025ca:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8025d0:	84 c0                	test   %al,%al
+  8025d2:	0f 84 66 ff ff ff    	je     80253e <vprintfmt+0x25e>
+  8025d8:	45 85 ff             	test   %r15d,%r15d
+  8025db:	78 0a                	js     8025e7 <vprintfmt+0x307>
+  8025dd:	41 83 ef 01          	sub    $0x1,%r15d
+  8025e1:	0f 88 57 ff ff ff    	js     80253e <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8025e7:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8025eb:	74 cc                	je     8025b9 <vprintfmt+0x2d9>
+  8025ed:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8025f0:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8025f5:	80 fa 5e             	cmp    $0x5e,%dl
+  8025f8:	77 c2                	ja     8025bc <vprintfmt+0x2dc>
+  8025fa:	eb bd                	jmp    8025b9 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8025fc:	40 84 f6             	test   %sil,%sil
+  8025ff:	75 26                	jne    802627 <vprintfmt+0x347>
+    switch (lflag) {
+  802601:	85 d2                	test   %edx,%edx
+  802603:	74 59                	je     80265e <vprintfmt+0x37e>
+  802605:	83 fa 01             	cmp    $0x1,%edx
+  802608:	74 7b                	je     802685 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80260a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80260d:	83 f8 2f             	cmp    $0x2f,%eax
+  802610:	0f 87 96 00 00 00    	ja     8026ac <vprintfmt+0x3cc>
+  802616:	89 c2                	mov    %eax,%edx
+  802618:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80261c:	83 c0 08             	add    $0x8,%eax
+  80261f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802622:	4c 8b 22             	mov    (%rdx),%r12
+  802625:	eb 17                	jmp    80263e <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802627:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80262a:	83 f8 2f             	cmp    $0x2f,%eax
+  80262d:	77 21                	ja     802650 <vprintfmt+0x370>
+  80262f:	89 c2                	mov    %eax,%edx
+  802631:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802635:	83 c0 08             	add    $0x8,%eax
+  802638:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80263b:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80263e:	4d 85 e4             	test   %r12,%r12
+  802641:	78 7a                	js     8026bd <vprintfmt+0x3dd>
+            num = i;
+  802643:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802646:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80264b:	e9 50 02 00 00       	jmp    8028a0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802650:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802654:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802658:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80265c:	eb dd                	jmp    80263b <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80265e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802661:	83 f8 2f             	cmp    $0x2f,%eax
+  802664:	77 11                	ja     802677 <vprintfmt+0x397>
+  802666:	89 c2                	mov    %eax,%edx
+  802668:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80266c:	83 c0 08             	add    $0x8,%eax
+  80266f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802672:	4c 63 22             	movslq (%rdx),%r12
+  802675:	eb c7                	jmp    80263e <vprintfmt+0x35e>
+  802677:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80267b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80267f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802683:	eb ed                	jmp    802672 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802685:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802688:	83 f8 2f             	cmp    $0x2f,%eax
+  80268b:	77 11                	ja     80269e <vprintfmt+0x3be>
+  80268d:	89 c2                	mov    %eax,%edx
+  80268f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802693:	83 c0 08             	add    $0x8,%eax
+  802696:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802699:	4c 8b 22             	mov    (%rdx),%r12
+  80269c:	eb a0                	jmp    80263e <vprintfmt+0x35e>
+  80269e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8026a2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8026a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026aa:	eb ed                	jmp    802699 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8026ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8026b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8026b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026b8:	e9 65 ff ff ff       	jmp    802622 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8026bd:	4c 89 ee             	mov    %r13,%rsi
+  8026c0:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8026c5:	41 ff d6             	call   *%r14
+                i = -i;
+  8026c8:	49 f7 dc             	neg    %r12
+  8026cb:	e9 73 ff ff ff       	jmp    802643 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8026d0:	40 84 f6             	test   %sil,%sil
+  8026d3:	75 32                	jne    802707 <vprintfmt+0x427>
+    switch (lflag) {
+  8026d5:	85 d2                	test   %edx,%edx
+  8026d7:	74 5d                	je     802736 <vprintfmt+0x456>
+  8026d9:	83 fa 01             	cmp    $0x1,%edx
+  8026dc:	0f 84 82 00 00 00    	je     802764 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8026e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8026e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8026e8:	0f 87 a5 00 00 00    	ja     802793 <vprintfmt+0x4b3>
+  8026ee:	89 c2                	mov    %eax,%edx
+  8026f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8026f4:	83 c0 08             	add    $0x8,%eax
+  8026f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8026fa:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8026fd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802702:	e9 99 01 00 00       	jmp    8028a0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802707:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80270a:	83 f8 2f             	cmp    $0x2f,%eax
+  80270d:	77 19                	ja     802728 <vprintfmt+0x448>
+  80270f:	89 c2                	mov    %eax,%edx
+  802711:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802715:	83 c0 08             	add    $0x8,%eax
+  802718:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80271b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80271e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802723:	e9 78 01 00 00       	jmp    8028a0 <vprintfmt+0x5c0>
+  802728:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80272c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802730:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802734:	eb e5                	jmp    80271b <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802736:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802739:	83 f8 2f             	cmp    $0x2f,%eax
+  80273c:	77 18                	ja     802756 <vprintfmt+0x476>
+  80273e:	89 c2                	mov    %eax,%edx
+  802740:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802744:	83 c0 08             	add    $0x8,%eax
+  802747:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80274a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80274c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802751:	e9 4a 01 00 00       	jmp    8028a0 <vprintfmt+0x5c0>
+  802756:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80275a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80275e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802762:	eb e6                	jmp    80274a <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802764:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802767:	83 f8 2f             	cmp    $0x2f,%eax
+  80276a:	77 19                	ja     802785 <vprintfmt+0x4a5>
+  80276c:	89 c2                	mov    %eax,%edx
+  80276e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802772:	83 c0 08             	add    $0x8,%eax
+  802775:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802778:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80277b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802780:	e9 1b 01 00 00       	jmp    8028a0 <vprintfmt+0x5c0>
+  802785:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802789:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80278d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802791:	eb e5                	jmp    802778 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802793:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802797:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80279b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80279f:	e9 56 ff ff ff       	jmp    8026fa <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8027a4:	40 84 f6             	test   %sil,%sil
+  8027a7:	75 2e                	jne    8027d7 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8027a9:	85 d2                	test   %edx,%edx
+  8027ab:	74 59                	je     802806 <vprintfmt+0x526>
+  8027ad:	83 fa 01             	cmp    $0x1,%edx
+  8027b0:	74 7f                	je     802831 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8027b2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8027b5:	83 f8 2f             	cmp    $0x2f,%eax
+  8027b8:	0f 87 9f 00 00 00    	ja     80285d <vprintfmt+0x57d>
+  8027be:	89 c2                	mov    %eax,%edx
+  8027c0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8027c4:	83 c0 08             	add    $0x8,%eax
+  8027c7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8027ca:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8027cd:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8027d2:	e9 c9 00 00 00       	jmp    8028a0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8027d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8027da:	83 f8 2f             	cmp    $0x2f,%eax
+  8027dd:	77 19                	ja     8027f8 <vprintfmt+0x518>
+  8027df:	89 c2                	mov    %eax,%edx
+  8027e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8027e5:	83 c0 08             	add    $0x8,%eax
+  8027e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8027eb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8027ee:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8027f3:	e9 a8 00 00 00       	jmp    8028a0 <vprintfmt+0x5c0>
+  8027f8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8027fc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802800:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802804:	eb e5                	jmp    8027eb <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802806:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802809:	83 f8 2f             	cmp    $0x2f,%eax
+  80280c:	77 15                	ja     802823 <vprintfmt+0x543>
+  80280e:	89 c2                	mov    %eax,%edx
+  802810:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802814:	83 c0 08             	add    $0x8,%eax
+  802817:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80281a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80281c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802821:	eb 7d                	jmp    8028a0 <vprintfmt+0x5c0>
+  802823:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802827:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80282b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80282f:	eb e9                	jmp    80281a <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802831:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802834:	83 f8 2f             	cmp    $0x2f,%eax
+  802837:	77 16                	ja     80284f <vprintfmt+0x56f>
+  802839:	89 c2                	mov    %eax,%edx
+  80283b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80283f:	83 c0 08             	add    $0x8,%eax
+  802842:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802845:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802848:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80284d:	eb 51                	jmp    8028a0 <vprintfmt+0x5c0>
+  80284f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802853:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802857:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80285b:	eb e8                	jmp    802845 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80285d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802861:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802865:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802869:	e9 5c ff ff ff       	jmp    8027ca <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80286e:	4c 89 ee             	mov    %r13,%rsi
+  802871:	bf 30 00 00 00       	mov    $0x30,%edi
+  802876:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802879:	4c 89 ee             	mov    %r13,%rsi
+  80287c:	bf 78 00 00 00       	mov    $0x78,%edi
+  802881:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802884:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802887:	83 f8 2f             	cmp    $0x2f,%eax
+  80288a:	77 47                	ja     8028d3 <vprintfmt+0x5f3>
+  80288c:	89 c2                	mov    %eax,%edx
+  80288e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802892:	83 c0 08             	add    $0x8,%eax
+  802895:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802898:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80289b:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8028a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8028a4:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8028a8:	0f 94 c0             	sete   %al
+  8028ab:	0f b6 c0             	movzbl %al,%eax
+  8028ae:	50                   	push   %rax
+  8028af:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8028b4:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8028b8:	4c 89 ee             	mov    %r13,%rsi
+  8028bb:	4c 89 f7             	mov    %r14,%rdi
+  8028be:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  8028c5:	00 00 00 
+  8028c8:	ff d0                	call   *%rax
+            break;
+  8028ca:	48 83 c4 10          	add    $0x10,%rsp
+  8028ce:	e9 3e fa ff ff       	jmp    802311 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8028d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8028d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8028db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028df:	eb b7                	jmp    802898 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8028e1:	40 84 f6             	test   %sil,%sil
+  8028e4:	75 2b                	jne    802911 <vprintfmt+0x631>
+    switch (lflag) {
+  8028e6:	85 d2                	test   %edx,%edx
+  8028e8:	74 56                	je     802940 <vprintfmt+0x660>
+  8028ea:	83 fa 01             	cmp    $0x1,%edx
+  8028ed:	74 7f                	je     80296e <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8028ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8028f5:	0f 87 a2 00 00 00    	ja     80299d <vprintfmt+0x6bd>
+  8028fb:	89 c2                	mov    %eax,%edx
+  8028fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802901:	83 c0 08             	add    $0x8,%eax
+  802904:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802907:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80290a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80290f:	eb 8f                	jmp    8028a0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802911:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802914:	83 f8 2f             	cmp    $0x2f,%eax
+  802917:	77 19                	ja     802932 <vprintfmt+0x652>
+  802919:	89 c2                	mov    %eax,%edx
+  80291b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80291f:	83 c0 08             	add    $0x8,%eax
+  802922:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802925:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802928:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80292d:	e9 6e ff ff ff       	jmp    8028a0 <vprintfmt+0x5c0>
+  802932:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802936:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80293a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80293e:	eb e5                	jmp    802925 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802940:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802943:	83 f8 2f             	cmp    $0x2f,%eax
+  802946:	77 18                	ja     802960 <vprintfmt+0x680>
+  802948:	89 c2                	mov    %eax,%edx
+  80294a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80294e:	83 c0 08             	add    $0x8,%eax
+  802951:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802954:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802956:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80295b:	e9 40 ff ff ff       	jmp    8028a0 <vprintfmt+0x5c0>
+  802960:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802964:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802968:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80296c:	eb e6                	jmp    802954 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80296e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802971:	83 f8 2f             	cmp    $0x2f,%eax
+  802974:	77 19                	ja     80298f <vprintfmt+0x6af>
+  802976:	89 c2                	mov    %eax,%edx
+  802978:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80297c:	83 c0 08             	add    $0x8,%eax
+  80297f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802982:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802985:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80298a:	e9 11 ff ff ff       	jmp    8028a0 <vprintfmt+0x5c0>
+  80298f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802993:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802997:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80299b:	eb e5                	jmp    802982 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80299d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8029a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8029a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029a9:	e9 59 ff ff ff       	jmp    802907 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8029ae:	4c 89 ee             	mov    %r13,%rsi
+  8029b1:	bf 25 00 00 00       	mov    $0x25,%edi
+  8029b6:	41 ff d6             	call   *%r14
+            break;
+  8029b9:	e9 53 f9 ff ff       	jmp    802311 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8029be:	4c 89 ee             	mov    %r13,%rsi
+  8029c1:	bf 25 00 00 00       	mov    $0x25,%edi
+  8029c6:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8029c9:	48 83 eb 01          	sub    $0x1,%rbx
+  8029cd:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8029d1:	75 f6                	jne    8029c9 <vprintfmt+0x6e9>
+  8029d3:	e9 39 f9 ff ff       	jmp    802311 <vprintfmt+0x31>
+}
+  8029d8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8029dc:	5b                   	pop    %rbx
+  8029dd:	41 5c                	pop    %r12
+  8029df:	41 5d                	pop    %r13
+  8029e1:	41 5e                	pop    %r14
+  8029e3:	41 5f                	pop    %r15
+  8029e5:	5d                   	pop    %rbp
+  8029e6:	c3                   	ret
+
+00000000008029e7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8029e7:	55                   	push   %rbp
+  8029e8:	48 89 e5             	mov    %rsp,%rbp
+  8029eb:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8029ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8029f3:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8029f8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8029fc:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802a03:	48 85 ff             	test   %rdi,%rdi
+  802a06:	74 2b                	je     802a33 <vsnprintf+0x4c>
+  802a08:	48 85 f6             	test   %rsi,%rsi
+  802a0b:	74 26                	je     802a33 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802a0d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802a11:	48 bf 8b 22 80 00 00 	movabs $0x80228b,%rdi
+  802a18:	00 00 00 
+  802a1b:	48 b8 e0 22 80 00 00 	movabs $0x8022e0,%rax
+  802a22:	00 00 00 
+  802a25:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802a27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a2b:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802a2e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802a31:	c9                   	leave
+  802a32:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802a33:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a38:	eb f7                	jmp    802a31 <vsnprintf+0x4a>
+
+0000000000802a3a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802a3a:	55                   	push   %rbp
+  802a3b:	48 89 e5             	mov    %rsp,%rbp
+  802a3e:	48 83 ec 50          	sub    $0x50,%rsp
+  802a42:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802a46:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802a4a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802a4e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802a55:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802a59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a5d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802a61:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802a65:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802a69:	48 b8 e7 29 80 00 00 	movabs $0x8029e7,%rax
+  802a70:	00 00 00 
+  802a73:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802a75:	c9                   	leave
+  802a76:	c3                   	ret
+
+0000000000802a77 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802a77:	55                   	push   %rbp
+  802a78:	48 89 e5             	mov    %rsp,%rbp
+  802a7b:	41 54                	push   %r12
+  802a7d:	53                   	push   %rbx
+  802a7e:	48 89 fb             	mov    %rdi,%rbx
+  802a81:	48 89 f7             	mov    %rsi,%rdi
+  802a84:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a87:	48 85 f6             	test   %rsi,%rsi
+  802a8a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a91:	00 00 00 
+  802a94:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802a98:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a9d:	48 b8 35 0b 80 00 00 	movabs $0x800b35,%rax
+  802aa4:	00 00 00 
+  802aa7:	ff d0                	call   *%rax
+    if (res < 0) {
+  802aa9:	85 c0                	test   %eax,%eax
+  802aab:	78 45                	js     802af2 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802aad:	48 85 db             	test   %rbx,%rbx
+  802ab0:	74 12                	je     802ac4 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802ab2:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802ab9:	00 00 00 
+  802abc:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802ac2:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802ac4:	4d 85 e4             	test   %r12,%r12
+  802ac7:	74 14                	je     802add <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802ac9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802ad0:	00 00 00 
+  802ad3:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802ad9:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802add:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802ae4:	00 00 00 
+  802ae7:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802aed:	5b                   	pop    %rbx
+  802aee:	41 5c                	pop    %r12
+  802af0:	5d                   	pop    %rbp
+  802af1:	c3                   	ret
+        if (from_env_store)
+  802af2:	48 85 db             	test   %rbx,%rbx
+  802af5:	74 06                	je     802afd <ipc_recv+0x86>
+            *from_env_store = 0;
+  802af7:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802afd:	4d 85 e4             	test   %r12,%r12
+  802b00:	74 eb                	je     802aed <ipc_recv+0x76>
+            *perm_store = 0;
+  802b02:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b09:	00 
+  802b0a:	eb e1                	jmp    802aed <ipc_recv+0x76>
+
+0000000000802b0c <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802b0c:	55                   	push   %rbp
+  802b0d:	48 89 e5             	mov    %rsp,%rbp
+  802b10:	41 57                	push   %r15
+  802b12:	41 56                	push   %r14
+  802b14:	41 55                	push   %r13
+  802b16:	41 54                	push   %r12
+  802b18:	53                   	push   %rbx
+  802b19:	48 83 ec 18          	sub    $0x18,%rsp
+  802b1d:	41 89 fd             	mov    %edi,%r13d
+  802b20:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802b23:	48 89 d3             	mov    %rdx,%rbx
+  802b26:	49 89 cc             	mov    %rcx,%r12
+  802b29:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802b2d:	48 85 d2             	test   %rdx,%rdx
+  802b30:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802b37:	00 00 00 
+  802b3a:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802b3e:	49 be 09 0b 80 00 00 	movabs $0x800b09,%r14
+  802b45:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802b48:	49 bf 3c 07 80 00 00 	movabs $0x80073c,%r15
+  802b4f:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802b52:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802b55:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802b59:	4c 89 e1             	mov    %r12,%rcx
+  802b5c:	48 89 da             	mov    %rbx,%rdx
+  802b5f:	44 89 ef             	mov    %r13d,%edi
+  802b62:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802b65:	85 c0                	test   %eax,%eax
+  802b67:	74 34                	je     802b9d <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802b69:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802b6c:	75 05                	jne    802b73 <ipc_send+0x67>
+        sys_yield();
+  802b6e:	41 ff d7             	call   *%r15
+    while (true) {
+  802b71:	eb df                	jmp    802b52 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802b73:	48 ba af 32 80 00 00 	movabs $0x8032af,%rdx
+  802b7a:	00 00 00 
+  802b7d:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802b82:	48 bf c8 32 80 00 00 	movabs $0x8032c8,%rdi
+  802b89:	00 00 00 
+  802b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b91:	48 b9 40 20 80 00 00 	movabs $0x802040,%rcx
+  802b98:	00 00 00 
+  802b9b:	ff d1                	call   *%rcx
+    }
+}
+  802b9d:	48 83 c4 18          	add    $0x18,%rsp
+  802ba1:	5b                   	pop    %rbx
+  802ba2:	41 5c                	pop    %r12
+  802ba4:	41 5d                	pop    %r13
+  802ba6:	41 5e                	pop    %r14
+  802ba8:	41 5f                	pop    %r15
+  802baa:	5d                   	pop    %rbp
+  802bab:	c3                   	ret
+
+0000000000802bac <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802bac:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802bb1:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802bb8:	00 00 00 
+  802bbb:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802bc2:	48 01 ca             	add    %rcx,%rdx
+  802bc5:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802bcb:	39 fa                	cmp    %edi,%edx
+  802bcd:	74 12                	je     802be1 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802bcf:	48 83 c0 01          	add    $0x1,%rax
+  802bd3:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802bd9:	75 e0                	jne    802bbb <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802be0:	c3                   	ret
+            return envs[i].env_id;
+  802be1:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802be8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802bef:	00 00 00 
+  802bf2:	48 01 d0             	add    %rdx,%rax
+  802bf5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802bfb:	c3                   	ret
+  802bfc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000802c00 <__rodata_start>:
+  802c00:	2d 6e 00 20 00       	sub    $0x20006e,%eax
+  802c05:	3c 75                	cmp    $0x75,%al
+  802c07:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c08:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802c0c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c0d:	3e 00 90 73 79 73 63 	ds add %dl,0x63737973(%rax)
+  802c14:	61                   	(bad)
+  802c15:	6c                   	insb   (%dx),%es:(%rdi)
+  802c16:	6c                   	insb   (%dx),%es:(%rdi)
+  802c17:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09097 <__bss_end+0x72201097>
+  802c1d:	65 74 75             	gs je  802c95 <__rodata_start+0x95>
+  802c20:	72 6e                	jb     802c90 <__rodata_start+0x90>
+  802c22:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a090a4 <__bss_end+0x282010a4>
+  802c29:	28 
+  802c2a:	3e 20 30             	ds and %dh,(%rax)
+  802c2d:	29 00                	sub    %eax,(%rax)
+  802c2f:	6c                   	insb   (%dx),%es:(%rdi)
+  802c30:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802c37:	61                   	(bad)
+  802c38:	6c                   	insb   (%dx),%es:(%rdi)
+  802c39:	6c                   	insb   (%dx),%es:(%rdi)
+  802c3a:	2e 63 00             	cs movsxd (%rax),%eax
+  802c3d:	0f 1f 00             	nopl   (%rax)
+  802c40:	5b                   	pop    %rbx
+  802c41:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802c46:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802c49:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802c4d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c4e:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802c52:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802c59:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 8036c4 <error_string+0x4e4>
+  802c60:	5b                   	pop    %rbx
+  802c61:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802c66:	20 66 74             	and    %ah,0x74(%rsi)
+  802c69:	72 75                	jb     802ce0 <devtab+0x20>
+  802c6b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c6c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802c6f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4cda <__bss_end+0x2d2cccda>
+  802c76:	20 62 61             	and    %ah,0x61(%rdx)
+  802c79:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802c7d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802c81:	5b                   	pop    %rbx
+  802c82:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802c87:	20 72 65             	and    %dh,0x65(%rdx)
+  802c8a:	61                   	(bad)
+  802c8b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4cf6 <__bss_end+0x2d2cccf6>
+  802c92:	20 62 61             	and    %ah,0x61(%rdx)
+  802c95:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802c99:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802c9d:	5b                   	pop    %rbx
+  802c9e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802ca3:	20 77 72             	and    %dh,0x72(%rdi)
+  802ca6:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802cad:	2d 
+  802cae:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802cb3:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802cb6:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802cba:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802cc0 <devtab>:
+  802cc0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802cd0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802ce0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802cf0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802d00:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802d10:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802d20:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802d30:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802d40:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802d50:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802d60:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802d70:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802d80:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802d90:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802da0:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802db0:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802dc0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802dd0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802de0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802df0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802e00:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802e10:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802e20:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802e30:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802e40:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802e50:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802e60:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802e70:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802e80:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802e90:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802ea0:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802eb0:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802ec0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802ed0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802ee0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802ef0:	64 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     d.operation not 
+  802f00:	70 65 72 6d 69 74 74 65 64 00 66 2e 0f 1f 84 00     permitted.f.....
+  802f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
+  802f20:	7d 23 80 00 00 00 00 00 be 29 80 00 00 00 00 00     }#.......)......
+  802f30:	ae 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  802f40:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  802f50:	be 29 80 00 00 00 00 00 9c 23 80 00 00 00 00 00     .).......#......
+  802f60:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  802f70:	90 23 80 00 00 00 00 00 0a 24 80 00 00 00 00 00     .#.......$......
+  802f80:	be 29 80 00 00 00 00 00 90 23 80 00 00 00 00 00     .).......#......
+  802f90:	d6 23 80 00 00 00 00 00 d6 23 80 00 00 00 00 00     .#.......#......
+  802fa0:	d6 23 80 00 00 00 00 00 d6 23 80 00 00 00 00 00     .#.......#......
+  802fb0:	d6 23 80 00 00 00 00 00 d6 23 80 00 00 00 00 00     .#.......#......
+  802fc0:	d6 23 80 00 00 00 00 00 d6 23 80 00 00 00 00 00     .#.......#......
+  802fd0:	d6 23 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .#.......)......
+  802fe0:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  802ff0:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  803000:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  803010:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  803020:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  803030:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  803040:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  803050:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  803060:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  803070:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  803080:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  803090:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  8030a0:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  8030b0:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  8030c0:	be 29 80 00 00 00 00 00 e1 28 80 00 00 00 00 00     .).......(......
+  8030d0:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  8030e0:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  8030f0:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  803100:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  803110:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  803120:	2d 24 80 00 00 00 00 00 fc 25 80 00 00 00 00 00     -$.......%......
+  803130:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  803140:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  803150:	5c 24 80 00 00 00 00 00 be 29 80 00 00 00 00 00     \$.......)......
+  803160:	be 29 80 00 00 00 00 00 22 24 80 00 00 00 00 00     .)......"$......
+  803170:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  803180:	a4 27 80 00 00 00 00 00 6e 28 80 00 00 00 00 00     .'......n(......
+  803190:	be 29 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .).......)......
+  8031a0:	f3 24 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .$.......)......
+  8031b0:	d0 26 80 00 00 00 00 00 be 29 80 00 00 00 00 00     .&.......)......
+  8031c0:	be 29 80 00 00 00 00 00 e1 28 80 00 00 00 00 00     .).......(......
+  8031d0:	be 29 80 00 00 00 00 00 86 23 80 00 00 00 00 00     .).......#......
+
+00000000008031e0 <error_string>:
+	...
+  8031e8:	95 2d 80 00 00 00 00 00 a7 2d 80 00 00 00 00 00     .-.......-......
+  8031f8:	b7 2d 80 00 00 00 00 00 c9 2d 80 00 00 00 00 00     .-.......-......
+  803208:	d7 2d 80 00 00 00 00 00 eb 2d 80 00 00 00 00 00     .-.......-......
+  803218:	00 2e 80 00 00 00 00 00 13 2e 80 00 00 00 00 00     ................
+  803228:	25 2e 80 00 00 00 00 00 39 2e 80 00 00 00 00 00     %.......9.......
+  803238:	49 2e 80 00 00 00 00 00 5c 2e 80 00 00 00 00 00     I.......\.......
+  803248:	73 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     s...............
+  803258:	a1 2e 80 00 00 00 00 00 b9 2e 80 00 00 00 00 00     ................
+  803268:	c6 2e 80 00 00 00 00 00 90 32 80 00 00 00 00 00     .........2......
+  803278:	da 2e 80 00 00 00 00 00 00 00 00 00 00 00 00 00     ................
+  803288:	f2 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ........file is 
+  803298:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8032a8:	75 74 61 62 6c 65 00 69 70 63 5f 73 65 6e 64 3a     utable.ipc_send:
+  8032b8:	20 66 61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00      failed to send.
+  8032c8:	6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00     lib/ipc.c.f.....
+  8032d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803308:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803318:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803328:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803338:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803348:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803358:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803368:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803378:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803388:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803398:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803408:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803418:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803428:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803438:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803448:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803458:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803468:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803478:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803488:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803498:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803508:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803518:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803528:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803538:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803548:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803558:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803568:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803578:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803588:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803598:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803608:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803618:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803628:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803638:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803648:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803658:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803668:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803678:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803688:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803698:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803708:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803718:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803728:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803738:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803748:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803758:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803768:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803778:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803788:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803798:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803808:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803818:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803828:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803838:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803848:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803858:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803868:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803878:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803888:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803898:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803908:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803918:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803928:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803938:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803948:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803958:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803968:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803978:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803988:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803998:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803aa8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ab8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ac8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ad8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ae8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803af8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ba8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bb8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bc8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bd8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803be8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bf8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ca8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cb8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cc8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cd8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ce8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cf8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803da8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803db8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dc8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803dd8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803de8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803df8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ea8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803eb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ec8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ed8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ee8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ef8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fa8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fb8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fc8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fd8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fe8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ff8:	00 00 00 00 0f 1f 40 00                             ......@.
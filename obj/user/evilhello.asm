@@ -0,0 +1,5391 @@
+
+obj/user/evilhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 23 00 00 00       	call   800046 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * kernel should destroy user environment in response */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    /* try to print the kernel entry point as a string!  mua ha ha! */
+    sys_cputs((char *)0x804020000c, 100);
+  800029:	be 64 00 00 00       	mov    $0x64,%esi
+  80002e:	48 bf 0c 00 20 40 80 	movabs $0x804020000c,%rdi
+  800035:	00 00 00 
+  800038:	48 b8 10 01 80 00 00 	movabs $0x800110,%rax
+  80003f:	00 00 00 
+  800042:	ff d0                	call   *%rax
+}
+  800044:	5d                   	pop    %rbp
+  800045:	c3                   	ret
+
+0000000000800046 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800046:	55                   	push   %rbp
+  800047:	48 89 e5             	mov    %rsp,%rbp
+  80004a:	41 56                	push   %r14
+  80004c:	41 55                	push   %r13
+  80004e:	41 54                	push   %r12
+  800050:	53                   	push   %rbx
+  800051:	41 89 fd             	mov    %edi,%r13d
+  800054:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800057:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80005e:	00 00 00 
+  800061:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800068:	00 00 00 
+  80006b:	48 39 c2             	cmp    %rax,%rdx
+  80006e:	73 17                	jae    800087 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800070:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800073:	49 89 c4             	mov    %rax,%r12
+  800076:	48 83 c3 08          	add    $0x8,%rbx
+  80007a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007f:	ff 53 f8             	call   *-0x8(%rbx)
+  800082:	4c 39 e3             	cmp    %r12,%rbx
+  800085:	72 ef                	jb     800076 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800087:	48 b8 d9 01 80 00 00 	movabs $0x8001d9,%rax
+  80008e:	00 00 00 
+  800091:	ff d0                	call   *%rax
+  800093:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800096:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80009d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000a4:	00 00 00 
+  8000a7:	48 01 d0             	add    %rdx,%rax
+  8000aa:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000b1:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000b4:	45 85 ed             	test   %r13d,%r13d
+  8000b7:	7e 0d                	jle    8000c6 <libmain+0x80>
+  8000b9:	49 8b 06             	mov    (%r14),%rax
+  8000bc:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000c3:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000c6:	4c 89 f6             	mov    %r14,%rsi
+  8000c9:	44 89 ef             	mov    %r13d,%edi
+  8000cc:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000d3:	00 00 00 
+  8000d6:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000d8:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  8000df:	00 00 00 
+  8000e2:	ff d0                	call   *%rax
+#endif
+}
+  8000e4:	5b                   	pop    %rbx
+  8000e5:	41 5c                	pop    %r12
+  8000e7:	41 5d                	pop    %r13
+  8000e9:	41 5e                	pop    %r14
+  8000eb:	5d                   	pop    %rbp
+  8000ec:	c3                   	ret
+
+00000000008000ed <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000ed:	55                   	push   %rbp
+  8000ee:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000f1:	48 b8 61 0a 80 00 00 	movabs $0x800a61,%rax
+  8000f8:	00 00 00 
+  8000fb:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800102:	48 b8 6e 01 80 00 00 	movabs $0x80016e,%rax
+  800109:	00 00 00 
+  80010c:	ff d0                	call   *%rax
+}
+  80010e:	5d                   	pop    %rbp
+  80010f:	c3                   	ret
+
+0000000000800110 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800110:	55                   	push   %rbp
+  800111:	48 89 e5             	mov    %rsp,%rbp
+  800114:	53                   	push   %rbx
+  800115:	48 89 fa             	mov    %rdi,%rdx
+  800118:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80011b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800120:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800125:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80012a:	be 00 00 00 00       	mov    $0x0,%esi
+  80012f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800135:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800137:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80013b:	c9                   	leave
+  80013c:	c3                   	ret
+
+000000000080013d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80013d:	55                   	push   %rbp
+  80013e:	48 89 e5             	mov    %rsp,%rbp
+  800141:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800142:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800147:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800151:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800156:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80015b:	be 00 00 00 00       	mov    $0x0,%esi
+  800160:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800166:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800168:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80016c:	c9                   	leave
+  80016d:	c3                   	ret
+
+000000000080016e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80016e:	55                   	push   %rbp
+  80016f:	48 89 e5             	mov    %rsp,%rbp
+  800172:	53                   	push   %rbx
+  800173:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800177:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80017a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80017f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800184:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800189:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80018e:	be 00 00 00 00       	mov    $0x0,%esi
+  800193:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800199:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80019b:	48 85 c0             	test   %rax,%rax
+  80019e:	7f 06                	jg     8001a6 <sys_env_destroy+0x38>
+}
+  8001a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001a4:	c9                   	leave
+  8001a5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001a6:	49 89 c0             	mov    %rax,%r8
+  8001a9:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001ae:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  8001b5:	00 00 00 
+  8001b8:	be 26 00 00 00       	mov    $0x26,%esi
+  8001bd:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  8001c4:	00 00 00 
+  8001c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001cc:	49 b9 0e 1b 80 00 00 	movabs $0x801b0e,%r9
+  8001d3:	00 00 00 
+  8001d6:	41 ff d1             	call   *%r9
+
+00000000008001d9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001d9:	55                   	push   %rbp
+  8001da:	48 89 e5             	mov    %rsp,%rbp
+  8001dd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001de:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8001fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800202:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800204:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800208:	c9                   	leave
+  800209:	c3                   	ret
+
+000000000080020a <sys_yield>:
+
+void
+sys_yield(void) {
+  80020a:	55                   	push   %rbp
+  80020b:	48 89 e5             	mov    %rsp,%rbp
+  80020e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80020f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800214:	ba 00 00 00 00       	mov    $0x0,%edx
+  800219:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80021e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800223:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800228:	be 00 00 00 00       	mov    $0x0,%esi
+  80022d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800233:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800235:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800239:	c9                   	leave
+  80023a:	c3                   	ret
+
+000000000080023b <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80023b:	55                   	push   %rbp
+  80023c:	48 89 e5             	mov    %rsp,%rbp
+  80023f:	53                   	push   %rbx
+  800240:	48 89 fa             	mov    %rdi,%rdx
+  800243:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800246:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80024b:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800252:	00 00 00 
+  800255:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80025a:	be 00 00 00 00       	mov    $0x0,%esi
+  80025f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800265:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800267:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80026b:	c9                   	leave
+  80026c:	c3                   	ret
+
+000000000080026d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80026d:	55                   	push   %rbp
+  80026e:	48 89 e5             	mov    %rsp,%rbp
+  800271:	53                   	push   %rbx
+  800272:	49 89 f8             	mov    %rdi,%r8
+  800275:	48 89 d3             	mov    %rdx,%rbx
+  800278:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80027b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800280:	4c 89 c2             	mov    %r8,%rdx
+  800283:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800286:	be 00 00 00 00       	mov    $0x0,%esi
+  80028b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800291:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800293:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800297:	c9                   	leave
+  800298:	c3                   	ret
+
+0000000000800299 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800299:	55                   	push   %rbp
+  80029a:	48 89 e5             	mov    %rsp,%rbp
+  80029d:	53                   	push   %rbx
+  80029e:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a2:	89 f8                	mov    %edi,%eax
+  8002a4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002a7:	48 63 f9             	movslq %ecx,%rdi
+  8002aa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002ad:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002b2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8002ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002c2:	48 85 c0             	test   %rax,%rax
+  8002c5:	7f 06                	jg     8002cd <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002cb:	c9                   	leave
+  8002cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002cd:	49 89 c0             	mov    %rax,%r8
+  8002d0:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002d5:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  8002dc:	00 00 00 
+  8002df:	be 26 00 00 00       	mov    $0x26,%esi
+  8002e4:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  8002eb:	00 00 00 
+  8002ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f3:	49 b9 0e 1b 80 00 00 	movabs $0x801b0e,%r9
+  8002fa:	00 00 00 
+  8002fd:	41 ff d1             	call   *%r9
+
+0000000000800300 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800300:	55                   	push   %rbp
+  800301:	48 89 e5             	mov    %rsp,%rbp
+  800304:	53                   	push   %rbx
+  800305:	48 83 ec 08          	sub    $0x8,%rsp
+  800309:	89 f8                	mov    %edi,%eax
+  80030b:	49 89 f2             	mov    %rsi,%r10
+  80030e:	48 89 cf             	mov    %rcx,%rdi
+  800311:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800314:	48 63 da             	movslq %edx,%rbx
+  800317:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80031a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80031f:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800322:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800325:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800327:	48 85 c0             	test   %rax,%rax
+  80032a:	7f 06                	jg     800332 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80032c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800330:	c9                   	leave
+  800331:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800332:	49 89 c0             	mov    %rax,%r8
+  800335:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80033a:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  800341:	00 00 00 
+  800344:	be 26 00 00 00       	mov    $0x26,%esi
+  800349:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  800350:	00 00 00 
+  800353:	b8 00 00 00 00       	mov    $0x0,%eax
+  800358:	49 b9 0e 1b 80 00 00 	movabs $0x801b0e,%r9
+  80035f:	00 00 00 
+  800362:	41 ff d1             	call   *%r9
+
+0000000000800365 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800365:	55                   	push   %rbp
+  800366:	48 89 e5             	mov    %rsp,%rbp
+  800369:	53                   	push   %rbx
+  80036a:	48 83 ec 08          	sub    $0x8,%rsp
+  80036e:	48 89 f1             	mov    %rsi,%rcx
+  800371:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800374:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800377:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80037c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800381:	be 00 00 00 00       	mov    $0x0,%esi
+  800386:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80038c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80038e:	48 85 c0             	test   %rax,%rax
+  800391:	7f 06                	jg     800399 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800393:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800397:	c9                   	leave
+  800398:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800399:	49 89 c0             	mov    %rax,%r8
+  80039c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003a1:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  8003a8:	00 00 00 
+  8003ab:	be 26 00 00 00       	mov    $0x26,%esi
+  8003b0:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  8003b7:	00 00 00 
+  8003ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bf:	49 b9 0e 1b 80 00 00 	movabs $0x801b0e,%r9
+  8003c6:	00 00 00 
+  8003c9:	41 ff d1             	call   *%r9
+
+00000000008003cc <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8003cc:	55                   	push   %rbp
+  8003cd:	48 89 e5             	mov    %rsp,%rbp
+  8003d0:	53                   	push   %rbx
+  8003d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8003d5:	89 f8                	mov    %edi,%eax
+  8003d7:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8003da:	48 63 f9             	movslq %ecx,%rdi
+  8003dd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003e0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003e5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8003ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003f3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003f5:	48 85 c0             	test   %rax,%rax
+  8003f8:	7f 06                	jg     800400 <sys_region_advise+0x34>
+}
+  8003fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003fe:	c9                   	leave
+  8003ff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800400:	49 89 c0             	mov    %rax,%r8
+  800403:	b9 14 00 00 00       	mov    $0x14,%ecx
+  800408:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  80040f:	00 00 00 
+  800412:	be 26 00 00 00       	mov    $0x26,%esi
+  800417:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  80041e:	00 00 00 
+  800421:	b8 00 00 00 00       	mov    $0x0,%eax
+  800426:	49 b9 0e 1b 80 00 00 	movabs $0x801b0e,%r9
+  80042d:	00 00 00 
+  800430:	41 ff d1             	call   *%r9
+
+0000000000800433 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  800433:	55                   	push   %rbp
+  800434:	48 89 e5             	mov    %rsp,%rbp
+  800437:	53                   	push   %rbx
+  800438:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80043c:	48 63 ce             	movslq %esi,%rcx
+  80043f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800442:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800447:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80044c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800451:	be 00 00 00 00       	mov    $0x0,%esi
+  800456:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80045c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80045e:	48 85 c0             	test   %rax,%rax
+  800461:	7f 06                	jg     800469 <sys_env_set_nice+0x36>
+}
+  800463:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800467:	c9                   	leave
+  800468:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800469:	49 89 c0             	mov    %rax,%r8
+  80046c:	b9 15 00 00 00       	mov    $0x15,%ecx
+  800471:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  800478:	00 00 00 
+  80047b:	be 26 00 00 00       	mov    $0x26,%esi
+  800480:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  800487:	00 00 00 
+  80048a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048f:	49 b9 0e 1b 80 00 00 	movabs $0x801b0e,%r9
+  800496:	00 00 00 
+  800499:	41 ff d1             	call   *%r9
+
+000000000080049c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80049c:	55                   	push   %rbp
+  80049d:	48 89 e5             	mov    %rsp,%rbp
+  8004a0:	53                   	push   %rbx
+  8004a1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004a5:	48 63 ce             	movslq %esi,%rcx
+  8004a8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004ab:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8004bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004c7:	48 85 c0             	test   %rax,%rax
+  8004ca:	7f 06                	jg     8004d2 <sys_env_set_status+0x36>
+}
+  8004cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004d0:	c9                   	leave
+  8004d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004d2:	49 89 c0             	mov    %rax,%r8
+  8004d5:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004da:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  8004e1:	00 00 00 
+  8004e4:	be 26 00 00 00       	mov    $0x26,%esi
+  8004e9:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  8004f0:	00 00 00 
+  8004f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f8:	49 b9 0e 1b 80 00 00 	movabs $0x801b0e,%r9
+  8004ff:	00 00 00 
+  800502:	41 ff d1             	call   *%r9
+
+0000000000800505 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800505:	55                   	push   %rbp
+  800506:	48 89 e5             	mov    %rsp,%rbp
+  800509:	53                   	push   %rbx
+  80050a:	48 83 ec 08          	sub    $0x8,%rsp
+  80050e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800511:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800514:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800519:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80051e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800523:	be 00 00 00 00       	mov    $0x0,%esi
+  800528:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80052e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800530:	48 85 c0             	test   %rax,%rax
+  800533:	7f 06                	jg     80053b <sys_env_set_trapframe+0x36>
+}
+  800535:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800539:	c9                   	leave
+  80053a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80053b:	49 89 c0             	mov    %rax,%r8
+  80053e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800543:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  80054a:	00 00 00 
+  80054d:	be 26 00 00 00       	mov    $0x26,%esi
+  800552:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  800559:	00 00 00 
+  80055c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800561:	49 b9 0e 1b 80 00 00 	movabs $0x801b0e,%r9
+  800568:	00 00 00 
+  80056b:	41 ff d1             	call   *%r9
+
+000000000080056e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80056e:	55                   	push   %rbp
+  80056f:	48 89 e5             	mov    %rsp,%rbp
+  800572:	53                   	push   %rbx
+  800573:	48 83 ec 08          	sub    $0x8,%rsp
+  800577:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80057a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80057d:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800582:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800587:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80058c:	be 00 00 00 00       	mov    $0x0,%esi
+  800591:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800597:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800599:	48 85 c0             	test   %rax,%rax
+  80059c:	7f 06                	jg     8005a4 <sys_env_set_pgfault_upcall+0x36>
+}
+  80059e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005a2:	c9                   	leave
+  8005a3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005a4:	49 89 c0             	mov    %rax,%r8
+  8005a7:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8005ac:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  8005b3:	00 00 00 
+  8005b6:	be 26 00 00 00       	mov    $0x26,%esi
+  8005bb:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  8005c2:	00 00 00 
+  8005c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ca:	49 b9 0e 1b 80 00 00 	movabs $0x801b0e,%r9
+  8005d1:	00 00 00 
+  8005d4:	41 ff d1             	call   *%r9
+
+00000000008005d7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8005d7:	55                   	push   %rbp
+  8005d8:	48 89 e5             	mov    %rsp,%rbp
+  8005db:	53                   	push   %rbx
+  8005dc:	89 f8                	mov    %edi,%eax
+  8005de:	49 89 f1             	mov    %rsi,%r9
+  8005e1:	48 89 d3             	mov    %rdx,%rbx
+  8005e4:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8005e7:	49 63 f0             	movslq %r8d,%rsi
+  8005ea:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005ed:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005f2:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005fb:	cd 30                	int    $0x30
+}
+  8005fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800601:	c9                   	leave
+  800602:	c3                   	ret
+
+0000000000800603 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800603:	55                   	push   %rbp
+  800604:	48 89 e5             	mov    %rsp,%rbp
+  800607:	53                   	push   %rbx
+  800608:	48 83 ec 08          	sub    $0x8,%rsp
+  80060c:	48 89 fa             	mov    %rdi,%rdx
+  80060f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800612:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800617:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80061c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800621:	be 00 00 00 00       	mov    $0x0,%esi
+  800626:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80062c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80062e:	48 85 c0             	test   %rax,%rax
+  800631:	7f 06                	jg     800639 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800633:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800637:	c9                   	leave
+  800638:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800639:	49 89 c0             	mov    %rax,%r8
+  80063c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800641:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  800648:	00 00 00 
+  80064b:	be 26 00 00 00       	mov    $0x26,%esi
+  800650:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  800657:	00 00 00 
+  80065a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065f:	49 b9 0e 1b 80 00 00 	movabs $0x801b0e,%r9
+  800666:	00 00 00 
+  800669:	41 ff d1             	call   *%r9
+
+000000000080066c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80066c:	55                   	push   %rbp
+  80066d:	48 89 e5             	mov    %rsp,%rbp
+  800670:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800671:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800676:	ba 00 00 00 00       	mov    $0x0,%edx
+  80067b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800680:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800685:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80068a:	be 00 00 00 00       	mov    $0x0,%esi
+  80068f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800695:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800697:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80069b:	c9                   	leave
+  80069c:	c3                   	ret
+
+000000000080069d <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80069d:	55                   	push   %rbp
+  80069e:	48 89 e5             	mov    %rsp,%rbp
+  8006a1:	53                   	push   %rbx
+  8006a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8006a6:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8006a9:	48 63 ce             	movslq %esi,%rcx
+  8006ac:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006af:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8006be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006c4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8006c6:	48 85 c0             	test   %rax,%rax
+  8006c9:	7f 06                	jg     8006d1 <sys_sigqueue+0x34>
+}
+  8006cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006cf:	c9                   	leave
+  8006d0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006d1:	49 89 c0             	mov    %rax,%r8
+  8006d4:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8006d9:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  8006e0:	00 00 00 
+  8006e3:	be 26 00 00 00       	mov    $0x26,%esi
+  8006e8:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  8006ef:	00 00 00 
+  8006f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f7:	49 b9 0e 1b 80 00 00 	movabs $0x801b0e,%r9
+  8006fe:	00 00 00 
+  800701:	41 ff d1             	call   *%r9
+
+0000000000800704 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  800704:	55                   	push   %rbp
+  800705:	48 89 e5             	mov    %rsp,%rbp
+  800708:	53                   	push   %rbx
+  800709:	48 83 ec 08          	sub    $0x8,%rsp
+  80070d:	48 89 fa             	mov    %rdi,%rdx
+  800710:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800713:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800718:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80071d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800722:	be 00 00 00 00       	mov    $0x0,%esi
+  800727:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80072d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80072f:	48 85 c0             	test   %rax,%rax
+  800732:	7f 06                	jg     80073a <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  800734:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800738:	c9                   	leave
+  800739:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80073a:	49 89 c0             	mov    %rax,%r8
+  80073d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800742:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  800749:	00 00 00 
+  80074c:	be 26 00 00 00       	mov    $0x26,%esi
+  800751:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  800758:	00 00 00 
+  80075b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800760:	49 b9 0e 1b 80 00 00 	movabs $0x801b0e,%r9
+  800767:	00 00 00 
+  80076a:	41 ff d1             	call   *%r9
+
+000000000080076d <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80076d:	55                   	push   %rbp
+  80076e:	48 89 e5             	mov    %rsp,%rbp
+  800771:	53                   	push   %rbx
+  800772:	48 83 ec 08          	sub    $0x8,%rsp
+  800776:	48 89 f1             	mov    %rsi,%rcx
+  800779:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80077c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80077f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800784:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800789:	be 00 00 00 00       	mov    $0x0,%esi
+  80078e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800794:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800796:	48 85 c0             	test   %rax,%rax
+  800799:	7f 06                	jg     8007a1 <sys_sigaction+0x34>
+}
+  80079b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80079f:	c9                   	leave
+  8007a0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007a1:	49 89 c0             	mov    %rax,%r8
+  8007a4:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8007a9:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  8007b0:	00 00 00 
+  8007b3:	be 26 00 00 00       	mov    $0x26,%esi
+  8007b8:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  8007bf:	00 00 00 
+  8007c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c7:	49 b9 0e 1b 80 00 00 	movabs $0x801b0e,%r9
+  8007ce:	00 00 00 
+  8007d1:	41 ff d1             	call   *%r9
+
+00000000008007d4 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8007d4:	55                   	push   %rbp
+  8007d5:	48 89 e5             	mov    %rsp,%rbp
+  8007d8:	53                   	push   %rbx
+  8007d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8007dd:	48 89 f1             	mov    %rsi,%rcx
+  8007e0:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8007e3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8007e6:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8007eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8007f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8007fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8007fd:	48 85 c0             	test   %rax,%rax
+  800800:	7f 06                	jg     800808 <sys_sigprocmask+0x34>
+}
+  800802:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800806:	c9                   	leave
+  800807:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800808:	49 89 c0             	mov    %rax,%r8
+  80080b:	b9 13 00 00 00       	mov    $0x13,%ecx
+  800810:	48 ba 40 2b 80 00 00 	movabs $0x802b40,%rdx
+  800817:	00 00 00 
+  80081a:	be 26 00 00 00       	mov    $0x26,%esi
+  80081f:	48 bf 5f 2b 80 00 00 	movabs $0x802b5f,%rdi
+  800826:	00 00 00 
+  800829:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082e:	49 b9 0e 1b 80 00 00 	movabs $0x801b0e,%r9
+  800835:	00 00 00 
+  800838:	41 ff d1             	call   *%r9
+
+000000000080083b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80083b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800842:	ff ff ff 
+  800845:	48 01 f8             	add    %rdi,%rax
+  800848:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80084c:	c3                   	ret
+
+000000000080084d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80084d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800854:	ff ff ff 
+  800857:	48 01 f8             	add    %rdi,%rax
+  80085a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80085e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800864:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800868:	c3                   	ret
+
+0000000000800869 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800869:	55                   	push   %rbp
+  80086a:	48 89 e5             	mov    %rsp,%rbp
+  80086d:	41 57                	push   %r15
+  80086f:	41 56                	push   %r14
+  800871:	41 55                	push   %r13
+  800873:	41 54                	push   %r12
+  800875:	53                   	push   %rbx
+  800876:	48 83 ec 08          	sub    $0x8,%rsp
+  80087a:	49 89 ff             	mov    %rdi,%r15
+  80087d:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800882:	49 bd e7 17 80 00 00 	movabs $0x8017e7,%r13
+  800889:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80088c:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800892:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800895:	48 89 df             	mov    %rbx,%rdi
+  800898:	41 ff d5             	call   *%r13
+  80089b:	83 e0 04             	and    $0x4,%eax
+  80089e:	74 17                	je     8008b7 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8008a0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8008a7:	4c 39 f3             	cmp    %r14,%rbx
+  8008aa:	75 e6                	jne    800892 <fd_alloc+0x29>
+  8008ac:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8008b2:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8008b7:	4d 89 27             	mov    %r12,(%r15)
+}
+  8008ba:	48 83 c4 08          	add    $0x8,%rsp
+  8008be:	5b                   	pop    %rbx
+  8008bf:	41 5c                	pop    %r12
+  8008c1:	41 5d                	pop    %r13
+  8008c3:	41 5e                	pop    %r14
+  8008c5:	41 5f                	pop    %r15
+  8008c7:	5d                   	pop    %rbp
+  8008c8:	c3                   	ret
+
+00000000008008c9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8008c9:	83 ff 1f             	cmp    $0x1f,%edi
+  8008cc:	77 39                	ja     800907 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8008ce:	55                   	push   %rbp
+  8008cf:	48 89 e5             	mov    %rsp,%rbp
+  8008d2:	41 54                	push   %r12
+  8008d4:	53                   	push   %rbx
+  8008d5:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8008d8:	48 63 df             	movslq %edi,%rbx
+  8008db:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8008e2:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8008e6:	48 89 df             	mov    %rbx,%rdi
+  8008e9:	48 b8 e7 17 80 00 00 	movabs $0x8017e7,%rax
+  8008f0:	00 00 00 
+  8008f3:	ff d0                	call   *%rax
+  8008f5:	a8 04                	test   $0x4,%al
+  8008f7:	74 14                	je     80090d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8008f9:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8008fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800902:	5b                   	pop    %rbx
+  800903:	41 5c                	pop    %r12
+  800905:	5d                   	pop    %rbp
+  800906:	c3                   	ret
+        return -E_INVAL;
+  800907:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80090c:	c3                   	ret
+        return -E_INVAL;
+  80090d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800912:	eb ee                	jmp    800902 <fd_lookup+0x39>
+
+0000000000800914 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800914:	55                   	push   %rbp
+  800915:	48 89 e5             	mov    %rsp,%rbp
+  800918:	41 54                	push   %r12
+  80091a:	53                   	push   %rbx
+  80091b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80091e:	48 b8 00 2c 80 00 00 	movabs $0x802c00,%rax
+  800925:	00 00 00 
+  800928:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80092f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800932:	39 3b                	cmp    %edi,(%rbx)
+  800934:	74 47                	je     80097d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800936:	48 83 c0 08          	add    $0x8,%rax
+  80093a:	48 8b 18             	mov    (%rax),%rbx
+  80093d:	48 85 db             	test   %rbx,%rbx
+  800940:	75 f0                	jne    800932 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800942:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800949:	00 00 00 
+  80094c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800952:	89 fa                	mov    %edi,%edx
+  800954:	48 bf 70 2b 80 00 00 	movabs $0x802b70,%rdi
+  80095b:	00 00 00 
+  80095e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800963:	48 b9 5e 1c 80 00 00 	movabs $0x801c5e,%rcx
+  80096a:	00 00 00 
+  80096d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80096f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800974:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800978:	5b                   	pop    %rbx
+  800979:	41 5c                	pop    %r12
+  80097b:	5d                   	pop    %rbp
+  80097c:	c3                   	ret
+            return 0;
+  80097d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800982:	eb f0                	jmp    800974 <dev_lookup+0x60>
+
+0000000000800984 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800984:	55                   	push   %rbp
+  800985:	48 89 e5             	mov    %rsp,%rbp
+  800988:	41 55                	push   %r13
+  80098a:	41 54                	push   %r12
+  80098c:	53                   	push   %rbx
+  80098d:	48 83 ec 18          	sub    $0x18,%rsp
+  800991:	48 89 fb             	mov    %rdi,%rbx
+  800994:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800997:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80099e:	ff ff ff 
+  8009a1:	48 01 df             	add    %rbx,%rdi
+  8009a4:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8009a8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009ac:	48 b8 c9 08 80 00 00 	movabs $0x8008c9,%rax
+  8009b3:	00 00 00 
+  8009b6:	ff d0                	call   *%rax
+  8009b8:	41 89 c5             	mov    %eax,%r13d
+  8009bb:	85 c0                	test   %eax,%eax
+  8009bd:	78 06                	js     8009c5 <fd_close+0x41>
+  8009bf:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8009c3:	74 1a                	je     8009df <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8009c5:	45 84 e4             	test   %r12b,%r12b
+  8009c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009cd:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8009d1:	44 89 e8             	mov    %r13d,%eax
+  8009d4:	48 83 c4 18          	add    $0x18,%rsp
+  8009d8:	5b                   	pop    %rbx
+  8009d9:	41 5c                	pop    %r12
+  8009db:	41 5d                	pop    %r13
+  8009dd:	5d                   	pop    %rbp
+  8009de:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8009df:	8b 3b                	mov    (%rbx),%edi
+  8009e1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8009e5:	48 b8 14 09 80 00 00 	movabs $0x800914,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	41 89 c5             	mov    %eax,%r13d
+  8009f4:	85 c0                	test   %eax,%eax
+  8009f6:	78 1b                	js     800a13 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8009f8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8009fc:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800a00:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800a06:	48 85 c0             	test   %rax,%rax
+  800a09:	74 08                	je     800a13 <fd_close+0x8f>
+  800a0b:	48 89 df             	mov    %rbx,%rdi
+  800a0e:	ff d0                	call   *%rax
+  800a10:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800a13:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a18:	48 89 de             	mov    %rbx,%rsi
+  800a1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a20:	48 b8 65 03 80 00 00 	movabs $0x800365,%rax
+  800a27:	00 00 00 
+  800a2a:	ff d0                	call   *%rax
+    return res;
+  800a2c:	eb a3                	jmp    8009d1 <fd_close+0x4d>
+
+0000000000800a2e <close>:
+
+int
+close(int fdnum) {
+  800a2e:	55                   	push   %rbp
+  800a2f:	48 89 e5             	mov    %rsp,%rbp
+  800a32:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800a36:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800a3a:	48 b8 c9 08 80 00 00 	movabs $0x8008c9,%rax
+  800a41:	00 00 00 
+  800a44:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800a46:	85 c0                	test   %eax,%eax
+  800a48:	78 15                	js     800a5f <close+0x31>
+
+    return fd_close(fd, 1);
+  800a4a:	be 01 00 00 00       	mov    $0x1,%esi
+  800a4f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800a53:	48 b8 84 09 80 00 00 	movabs $0x800984,%rax
+  800a5a:	00 00 00 
+  800a5d:	ff d0                	call   *%rax
+}
+  800a5f:	c9                   	leave
+  800a60:	c3                   	ret
+
+0000000000800a61 <close_all>:
+
+void
+close_all(void) {
+  800a61:	55                   	push   %rbp
+  800a62:	48 89 e5             	mov    %rsp,%rbp
+  800a65:	41 54                	push   %r12
+  800a67:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800a68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a6d:	49 bc 2e 0a 80 00 00 	movabs $0x800a2e,%r12
+  800a74:	00 00 00 
+  800a77:	89 df                	mov    %ebx,%edi
+  800a79:	41 ff d4             	call   *%r12
+  800a7c:	83 c3 01             	add    $0x1,%ebx
+  800a7f:	83 fb 20             	cmp    $0x20,%ebx
+  800a82:	75 f3                	jne    800a77 <close_all+0x16>
+}
+  800a84:	5b                   	pop    %rbx
+  800a85:	41 5c                	pop    %r12
+  800a87:	5d                   	pop    %rbp
+  800a88:	c3                   	ret
+
+0000000000800a89 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800a89:	55                   	push   %rbp
+  800a8a:	48 89 e5             	mov    %rsp,%rbp
+  800a8d:	41 57                	push   %r15
+  800a8f:	41 56                	push   %r14
+  800a91:	41 55                	push   %r13
+  800a93:	41 54                	push   %r12
+  800a95:	53                   	push   %rbx
+  800a96:	48 83 ec 18          	sub    $0x18,%rsp
+  800a9a:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800a9d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800aa1:	48 b8 c9 08 80 00 00 	movabs $0x8008c9,%rax
+  800aa8:	00 00 00 
+  800aab:	ff d0                	call   *%rax
+  800aad:	89 c3                	mov    %eax,%ebx
+  800aaf:	85 c0                	test   %eax,%eax
+  800ab1:	0f 88 b8 00 00 00    	js     800b6f <dup+0xe6>
+    close(newfdnum);
+  800ab7:	44 89 e7             	mov    %r12d,%edi
+  800aba:	48 b8 2e 0a 80 00 00 	movabs $0x800a2e,%rax
+  800ac1:	00 00 00 
+  800ac4:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800ac6:	4d 63 ec             	movslq %r12d,%r13
+  800ac9:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800ad0:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800ad4:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800ad8:	4c 89 ff             	mov    %r15,%rdi
+  800adb:	49 be 4d 08 80 00 00 	movabs $0x80084d,%r14
+  800ae2:	00 00 00 
+  800ae5:	41 ff d6             	call   *%r14
+  800ae8:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800aeb:	4c 89 ef             	mov    %r13,%rdi
+  800aee:	41 ff d6             	call   *%r14
+  800af1:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800af4:	48 89 df             	mov    %rbx,%rdi
+  800af7:	48 b8 e7 17 80 00 00 	movabs $0x8017e7,%rax
+  800afe:	00 00 00 
+  800b01:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800b03:	a8 04                	test   $0x4,%al
+  800b05:	74 2b                	je     800b32 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800b07:	41 89 c1             	mov    %eax,%r9d
+  800b0a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800b10:	4c 89 f1             	mov    %r14,%rcx
+  800b13:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b18:	48 89 de             	mov    %rbx,%rsi
+  800b1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b20:	48 b8 00 03 80 00 00 	movabs $0x800300,%rax
+  800b27:	00 00 00 
+  800b2a:	ff d0                	call   *%rax
+  800b2c:	89 c3                	mov    %eax,%ebx
+  800b2e:	85 c0                	test   %eax,%eax
+  800b30:	78 4e                	js     800b80 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800b32:	4c 89 ff             	mov    %r15,%rdi
+  800b35:	48 b8 e7 17 80 00 00 	movabs $0x8017e7,%rax
+  800b3c:	00 00 00 
+  800b3f:	ff d0                	call   *%rax
+  800b41:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800b44:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800b4a:	4c 89 e9             	mov    %r13,%rcx
+  800b4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b52:	4c 89 fe             	mov    %r15,%rsi
+  800b55:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b5a:	48 b8 00 03 80 00 00 	movabs $0x800300,%rax
+  800b61:	00 00 00 
+  800b64:	ff d0                	call   *%rax
+  800b66:	89 c3                	mov    %eax,%ebx
+  800b68:	85 c0                	test   %eax,%eax
+  800b6a:	78 14                	js     800b80 <dup+0xf7>
+
+    return newfdnum;
+  800b6c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800b6f:	89 d8                	mov    %ebx,%eax
+  800b71:	48 83 c4 18          	add    $0x18,%rsp
+  800b75:	5b                   	pop    %rbx
+  800b76:	41 5c                	pop    %r12
+  800b78:	41 5d                	pop    %r13
+  800b7a:	41 5e                	pop    %r14
+  800b7c:	41 5f                	pop    %r15
+  800b7e:	5d                   	pop    %rbp
+  800b7f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800b80:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b85:	4c 89 ee             	mov    %r13,%rsi
+  800b88:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b8d:	49 bc 65 03 80 00 00 	movabs $0x800365,%r12
+  800b94:	00 00 00 
+  800b97:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800b9a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b9f:	4c 89 f6             	mov    %r14,%rsi
+  800ba2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ba7:	41 ff d4             	call   *%r12
+    return res;
+  800baa:	eb c3                	jmp    800b6f <dup+0xe6>
+
+0000000000800bac <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800bac:	55                   	push   %rbp
+  800bad:	48 89 e5             	mov    %rsp,%rbp
+  800bb0:	41 56                	push   %r14
+  800bb2:	41 55                	push   %r13
+  800bb4:	41 54                	push   %r12
+  800bb6:	53                   	push   %rbx
+  800bb7:	48 83 ec 10          	sub    $0x10,%rsp
+  800bbb:	89 fb                	mov    %edi,%ebx
+  800bbd:	49 89 f4             	mov    %rsi,%r12
+  800bc0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bc3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bc7:	48 b8 c9 08 80 00 00 	movabs $0x8008c9,%rax
+  800bce:	00 00 00 
+  800bd1:	ff d0                	call   *%rax
+  800bd3:	85 c0                	test   %eax,%eax
+  800bd5:	78 4c                	js     800c23 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bd7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bdb:	41 8b 3e             	mov    (%r14),%edi
+  800bde:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800be2:	48 b8 14 09 80 00 00 	movabs $0x800914,%rax
+  800be9:	00 00 00 
+  800bec:	ff d0                	call   *%rax
+  800bee:	85 c0                	test   %eax,%eax
+  800bf0:	78 35                	js     800c27 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800bf2:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800bf6:	83 e0 03             	and    $0x3,%eax
+  800bf9:	83 f8 01             	cmp    $0x1,%eax
+  800bfc:	74 2d                	je     800c2b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800bfe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c02:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800c06:	48 85 c0             	test   %rax,%rax
+  800c09:	74 56                	je     800c61 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800c0b:	4c 89 ea             	mov    %r13,%rdx
+  800c0e:	4c 89 e6             	mov    %r12,%rsi
+  800c11:	4c 89 f7             	mov    %r14,%rdi
+  800c14:	ff d0                	call   *%rax
+}
+  800c16:	48 83 c4 10          	add    $0x10,%rsp
+  800c1a:	5b                   	pop    %rbx
+  800c1b:	41 5c                	pop    %r12
+  800c1d:	41 5d                	pop    %r13
+  800c1f:	41 5e                	pop    %r14
+  800c21:	5d                   	pop    %rbp
+  800c22:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c23:	48 98                	cltq
+  800c25:	eb ef                	jmp    800c16 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c27:	48 98                	cltq
+  800c29:	eb eb                	jmp    800c16 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c2b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c32:	00 00 00 
+  800c35:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c3b:	89 da                	mov    %ebx,%edx
+  800c3d:	48 bf b1 2b 80 00 00 	movabs $0x802bb1,%rdi
+  800c44:	00 00 00 
+  800c47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4c:	48 b9 5e 1c 80 00 00 	movabs $0x801c5e,%rcx
+  800c53:	00 00 00 
+  800c56:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c58:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c5f:	eb b5                	jmp    800c16 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800c61:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c68:	eb ac                	jmp    800c16 <read+0x6a>
+
+0000000000800c6a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800c6a:	55                   	push   %rbp
+  800c6b:	48 89 e5             	mov    %rsp,%rbp
+  800c6e:	41 57                	push   %r15
+  800c70:	41 56                	push   %r14
+  800c72:	41 55                	push   %r13
+  800c74:	41 54                	push   %r12
+  800c76:	53                   	push   %rbx
+  800c77:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800c7b:	48 85 d2             	test   %rdx,%rdx
+  800c7e:	74 54                	je     800cd4 <readn+0x6a>
+  800c80:	41 89 fd             	mov    %edi,%r13d
+  800c83:	49 89 f6             	mov    %rsi,%r14
+  800c86:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800c89:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800c8e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800c93:	49 bf ac 0b 80 00 00 	movabs $0x800bac,%r15
+  800c9a:	00 00 00 
+  800c9d:	4c 89 e2             	mov    %r12,%rdx
+  800ca0:	48 29 f2             	sub    %rsi,%rdx
+  800ca3:	4c 01 f6             	add    %r14,%rsi
+  800ca6:	44 89 ef             	mov    %r13d,%edi
+  800ca9:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800cac:	85 c0                	test   %eax,%eax
+  800cae:	78 20                	js     800cd0 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800cb0:	01 c3                	add    %eax,%ebx
+  800cb2:	85 c0                	test   %eax,%eax
+  800cb4:	74 08                	je     800cbe <readn+0x54>
+  800cb6:	48 63 f3             	movslq %ebx,%rsi
+  800cb9:	4c 39 e6             	cmp    %r12,%rsi
+  800cbc:	72 df                	jb     800c9d <readn+0x33>
+    }
+    return res;
+  800cbe:	48 63 c3             	movslq %ebx,%rax
+}
+  800cc1:	48 83 c4 08          	add    $0x8,%rsp
+  800cc5:	5b                   	pop    %rbx
+  800cc6:	41 5c                	pop    %r12
+  800cc8:	41 5d                	pop    %r13
+  800cca:	41 5e                	pop    %r14
+  800ccc:	41 5f                	pop    %r15
+  800cce:	5d                   	pop    %rbp
+  800ccf:	c3                   	ret
+        if (inc < 0) return inc;
+  800cd0:	48 98                	cltq
+  800cd2:	eb ed                	jmp    800cc1 <readn+0x57>
+    int inc = 1, res = 0;
+  800cd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cd9:	eb e3                	jmp    800cbe <readn+0x54>
+
+0000000000800cdb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800cdb:	55                   	push   %rbp
+  800cdc:	48 89 e5             	mov    %rsp,%rbp
+  800cdf:	41 56                	push   %r14
+  800ce1:	41 55                	push   %r13
+  800ce3:	41 54                	push   %r12
+  800ce5:	53                   	push   %rbx
+  800ce6:	48 83 ec 10          	sub    $0x10,%rsp
+  800cea:	89 fb                	mov    %edi,%ebx
+  800cec:	49 89 f4             	mov    %rsi,%r12
+  800cef:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cf2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cf6:	48 b8 c9 08 80 00 00 	movabs $0x8008c9,%rax
+  800cfd:	00 00 00 
+  800d00:	ff d0                	call   *%rax
+  800d02:	85 c0                	test   %eax,%eax
+  800d04:	78 47                	js     800d4d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d06:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800d0a:	41 8b 3e             	mov    (%r14),%edi
+  800d0d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800d11:	48 b8 14 09 80 00 00 	movabs $0x800914,%rax
+  800d18:	00 00 00 
+  800d1b:	ff d0                	call   *%rax
+  800d1d:	85 c0                	test   %eax,%eax
+  800d1f:	78 30                	js     800d51 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d21:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800d26:	74 2d                	je     800d55 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d28:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d2c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800d30:	48 85 c0             	test   %rax,%rax
+  800d33:	74 56                	je     800d8b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800d35:	4c 89 ea             	mov    %r13,%rdx
+  800d38:	4c 89 e6             	mov    %r12,%rsi
+  800d3b:	4c 89 f7             	mov    %r14,%rdi
+  800d3e:	ff d0                	call   *%rax
+}
+  800d40:	48 83 c4 10          	add    $0x10,%rsp
+  800d44:	5b                   	pop    %rbx
+  800d45:	41 5c                	pop    %r12
+  800d47:	41 5d                	pop    %r13
+  800d49:	41 5e                	pop    %r14
+  800d4b:	5d                   	pop    %rbp
+  800d4c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d4d:	48 98                	cltq
+  800d4f:	eb ef                	jmp    800d40 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d51:	48 98                	cltq
+  800d53:	eb eb                	jmp    800d40 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800d55:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d5c:	00 00 00 
+  800d5f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800d65:	89 da                	mov    %ebx,%edx
+  800d67:	48 bf cd 2b 80 00 00 	movabs $0x802bcd,%rdi
+  800d6e:	00 00 00 
+  800d71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d76:	48 b9 5e 1c 80 00 00 	movabs $0x801c5e,%rcx
+  800d7d:	00 00 00 
+  800d80:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d82:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800d89:	eb b5                	jmp    800d40 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d8b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800d92:	eb ac                	jmp    800d40 <write+0x65>
+
+0000000000800d94 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800d94:	55                   	push   %rbp
+  800d95:	48 89 e5             	mov    %rsp,%rbp
+  800d98:	53                   	push   %rbx
+  800d99:	48 83 ec 18          	sub    $0x18,%rsp
+  800d9d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d9f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800da3:	48 b8 c9 08 80 00 00 	movabs $0x8008c9,%rax
+  800daa:	00 00 00 
+  800dad:	ff d0                	call   *%rax
+  800daf:	85 c0                	test   %eax,%eax
+  800db1:	78 0c                	js     800dbf <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800db3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800db7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800dba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dbf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800dc3:	c9                   	leave
+  800dc4:	c3                   	ret
+
+0000000000800dc5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800dc5:	55                   	push   %rbp
+  800dc6:	48 89 e5             	mov    %rsp,%rbp
+  800dc9:	41 55                	push   %r13
+  800dcb:	41 54                	push   %r12
+  800dcd:	53                   	push   %rbx
+  800dce:	48 83 ec 18          	sub    $0x18,%rsp
+  800dd2:	89 fb                	mov    %edi,%ebx
+  800dd4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800dd7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ddb:	48 b8 c9 08 80 00 00 	movabs $0x8008c9,%rax
+  800de2:	00 00 00 
+  800de5:	ff d0                	call   *%rax
+  800de7:	85 c0                	test   %eax,%eax
+  800de9:	78 38                	js     800e23 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800deb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800def:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800df3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800df7:	48 b8 14 09 80 00 00 	movabs $0x800914,%rax
+  800dfe:	00 00 00 
+  800e01:	ff d0                	call   *%rax
+  800e03:	85 c0                	test   %eax,%eax
+  800e05:	78 1c                	js     800e23 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800e07:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800e0c:	74 20                	je     800e2e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800e0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e12:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800e16:	48 85 c0             	test   %rax,%rax
+  800e19:	74 47                	je     800e62 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800e1b:	44 89 e6             	mov    %r12d,%esi
+  800e1e:	4c 89 ef             	mov    %r13,%rdi
+  800e21:	ff d0                	call   *%rax
+}
+  800e23:	48 83 c4 18          	add    $0x18,%rsp
+  800e27:	5b                   	pop    %rbx
+  800e28:	41 5c                	pop    %r12
+  800e2a:	41 5d                	pop    %r13
+  800e2c:	5d                   	pop    %rbp
+  800e2d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800e2e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800e35:	00 00 00 
+  800e38:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800e3e:	89 da                	mov    %ebx,%edx
+  800e40:	48 bf 90 2b 80 00 00 	movabs $0x802b90,%rdi
+  800e47:	00 00 00 
+  800e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4f:	48 b9 5e 1c 80 00 00 	movabs $0x801c5e,%rcx
+  800e56:	00 00 00 
+  800e59:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e60:	eb c1                	jmp    800e23 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800e62:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e67:	eb ba                	jmp    800e23 <ftruncate+0x5e>
+
+0000000000800e69 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800e69:	55                   	push   %rbp
+  800e6a:	48 89 e5             	mov    %rsp,%rbp
+  800e6d:	41 54                	push   %r12
+  800e6f:	53                   	push   %rbx
+  800e70:	48 83 ec 10          	sub    $0x10,%rsp
+  800e74:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e77:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e7b:	48 b8 c9 08 80 00 00 	movabs $0x8008c9,%rax
+  800e82:	00 00 00 
+  800e85:	ff d0                	call   *%rax
+  800e87:	85 c0                	test   %eax,%eax
+  800e89:	78 4e                	js     800ed9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e8b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800e8f:	41 8b 3c 24          	mov    (%r12),%edi
+  800e93:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800e97:	48 b8 14 09 80 00 00 	movabs $0x800914,%rax
+  800e9e:	00 00 00 
+  800ea1:	ff d0                	call   *%rax
+  800ea3:	85 c0                	test   %eax,%eax
+  800ea5:	78 32                	js     800ed9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800ea7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800eab:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800eb0:	74 30                	je     800ee2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800eb2:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800eb5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800ebc:	00 00 00 
+    stat->st_isdir = 0;
+  800ebf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800ec6:	00 00 00 
+    stat->st_dev = dev;
+  800ec9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800ed0:	48 89 de             	mov    %rbx,%rsi
+  800ed3:	4c 89 e7             	mov    %r12,%rdi
+  800ed6:	ff 50 28             	call   *0x28(%rax)
+}
+  800ed9:	48 83 c4 10          	add    $0x10,%rsp
+  800edd:	5b                   	pop    %rbx
+  800ede:	41 5c                	pop    %r12
+  800ee0:	5d                   	pop    %rbp
+  800ee1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800ee2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ee7:	eb f0                	jmp    800ed9 <fstat+0x70>
+
+0000000000800ee9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800ee9:	55                   	push   %rbp
+  800eea:	48 89 e5             	mov    %rsp,%rbp
+  800eed:	41 54                	push   %r12
+  800eef:	53                   	push   %rbx
+  800ef0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800ef3:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef8:	48 b8 6a 11 80 00 00 	movabs $0x80116a,%rax
+  800eff:	00 00 00 
+  800f02:	ff d0                	call   *%rax
+  800f04:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800f06:	85 c0                	test   %eax,%eax
+  800f08:	78 25                	js     800f2f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800f0a:	4c 89 e6             	mov    %r12,%rsi
+  800f0d:	89 c7                	mov    %eax,%edi
+  800f0f:	48 b8 69 0e 80 00 00 	movabs $0x800e69,%rax
+  800f16:	00 00 00 
+  800f19:	ff d0                	call   *%rax
+  800f1b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800f1e:	89 df                	mov    %ebx,%edi
+  800f20:	48 b8 2e 0a 80 00 00 	movabs $0x800a2e,%rax
+  800f27:	00 00 00 
+  800f2a:	ff d0                	call   *%rax
+
+    return res;
+  800f2c:	44 89 e3             	mov    %r12d,%ebx
+}
+  800f2f:	89 d8                	mov    %ebx,%eax
+  800f31:	5b                   	pop    %rbx
+  800f32:	41 5c                	pop    %r12
+  800f34:	5d                   	pop    %rbp
+  800f35:	c3                   	ret
+
+0000000000800f36 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800f36:	55                   	push   %rbp
+  800f37:	48 89 e5             	mov    %rsp,%rbp
+  800f3a:	41 54                	push   %r12
+  800f3c:	53                   	push   %rbx
+  800f3d:	48 83 ec 10          	sub    $0x10,%rsp
+  800f41:	41 89 fc             	mov    %edi,%r12d
+  800f44:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f47:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f4e:	00 00 00 
+  800f51:	83 38 00             	cmpl   $0x0,(%rax)
+  800f54:	74 5e                	je     800fb4 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800f56:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800f5c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800f61:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800f68:	00 00 00 
+  800f6b:	44 89 e6             	mov    %r12d,%esi
+  800f6e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f75:	00 00 00 
+  800f78:	8b 38                	mov    (%rax),%edi
+  800f7a:	48 b8 3f 2a 80 00 00 	movabs $0x802a3f,%rax
+  800f81:	00 00 00 
+  800f84:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800f86:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800f8d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800f8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f93:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800f97:	48 89 de             	mov    %rbx,%rsi
+  800f9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f9f:	48 b8 aa 29 80 00 00 	movabs $0x8029aa,%rax
+  800fa6:	00 00 00 
+  800fa9:	ff d0                	call   *%rax
+}
+  800fab:	48 83 c4 10          	add    $0x10,%rsp
+  800faf:	5b                   	pop    %rbx
+  800fb0:	41 5c                	pop    %r12
+  800fb2:	5d                   	pop    %rbp
+  800fb3:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800fb4:	bf 03 00 00 00       	mov    $0x3,%edi
+  800fb9:	48 b8 df 2a 80 00 00 	movabs $0x802adf,%rax
+  800fc0:	00 00 00 
+  800fc3:	ff d0                	call   *%rax
+  800fc5:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800fcc:	00 00 
+  800fce:	eb 86                	jmp    800f56 <fsipc+0x20>
+
+0000000000800fd0 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800fd0:	55                   	push   %rbp
+  800fd1:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800fd4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800fdb:	00 00 00 
+  800fde:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800fe1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800fe3:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800fe6:	be 00 00 00 00       	mov    $0x0,%esi
+  800feb:	bf 02 00 00 00       	mov    $0x2,%edi
+  800ff0:	48 b8 36 0f 80 00 00 	movabs $0x800f36,%rax
+  800ff7:	00 00 00 
+  800ffa:	ff d0                	call   *%rax
+}
+  800ffc:	5d                   	pop    %rbp
+  800ffd:	c3                   	ret
+
+0000000000800ffe <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800ffe:	55                   	push   %rbp
+  800fff:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801002:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801005:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80100c:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80100e:	be 00 00 00 00       	mov    $0x0,%esi
+  801013:	bf 06 00 00 00       	mov    $0x6,%edi
+  801018:	48 b8 36 0f 80 00 00 	movabs $0x800f36,%rax
+  80101f:	00 00 00 
+  801022:	ff d0                	call   *%rax
+}
+  801024:	5d                   	pop    %rbp
+  801025:	c3                   	ret
+
+0000000000801026 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801026:	55                   	push   %rbp
+  801027:	48 89 e5             	mov    %rsp,%rbp
+  80102a:	41 54                	push   %r12
+  80102c:	53                   	push   %rbx
+  80102d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801030:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801033:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80103a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80103c:	be 00 00 00 00       	mov    $0x0,%esi
+  801041:	bf 05 00 00 00       	mov    $0x5,%edi
+  801046:	48 b8 36 0f 80 00 00 	movabs $0x800f36,%rax
+  80104d:	00 00 00 
+  801050:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801052:	85 c0                	test   %eax,%eax
+  801054:	78 3d                	js     801093 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801056:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80105d:	00 00 00 
+  801060:	4c 89 e6             	mov    %r12,%rsi
+  801063:	48 89 df             	mov    %rbx,%rdi
+  801066:	48 b8 83 25 80 00 00 	movabs $0x802583,%rax
+  80106d:	00 00 00 
+  801070:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801072:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801079:	00 
+  80107a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801080:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801087:	00 
+  801088:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80108e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801093:	5b                   	pop    %rbx
+  801094:	41 5c                	pop    %r12
+  801096:	5d                   	pop    %rbp
+  801097:	c3                   	ret
+
+0000000000801098 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801098:	55                   	push   %rbp
+  801099:	48 89 e5             	mov    %rsp,%rbp
+  80109c:	41 54                	push   %r12
+  80109e:	53                   	push   %rbx
+  80109f:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8010a2:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8010a7:	48 39 c2             	cmp    %rax,%rdx
+  8010aa:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8010ae:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8010b1:	48 89 c2             	mov    %rax,%rdx
+  8010b4:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8010bb:	00 00 00 
+  8010be:	48 b8 e4 27 80 00 00 	movabs $0x8027e4,%rax
+  8010c5:	00 00 00 
+  8010c8:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8010ca:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8010d1:	00 00 00 
+  8010d4:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8010d9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8010db:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8010df:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8010e9:	48 b8 36 0f 80 00 00 	movabs $0x800f36,%rax
+  8010f0:	00 00 00 
+  8010f3:	ff d0                	call   *%rax
+  8010f5:	48 98                	cltq
+}
+  8010f7:	5b                   	pop    %rbx
+  8010f8:	41 5c                	pop    %r12
+  8010fa:	5d                   	pop    %rbp
+  8010fb:	c3                   	ret
+
+00000000008010fc <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8010fc:	55                   	push   %rbp
+  8010fd:	48 89 e5             	mov    %rsp,%rbp
+  801100:	41 54                	push   %r12
+  801102:	53                   	push   %rbx
+  801103:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801106:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80110d:	00 00 00 
+  801110:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801113:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  801115:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80111a:	48 39 ca             	cmp    %rcx,%rdx
+  80111d:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  801121:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  801125:	be 00 00 00 00       	mov    $0x0,%esi
+  80112a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80112f:	48 b8 36 0f 80 00 00 	movabs $0x800f36,%rax
+  801136:	00 00 00 
+  801139:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  80113b:	85 c0                	test   %eax,%eax
+  80113d:	78 27                	js     801166 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  80113f:	48 63 d8             	movslq %eax,%rbx
+  801142:	48 89 da             	mov    %rbx,%rdx
+  801145:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80114c:	00 00 00 
+  80114f:	4c 89 e7             	mov    %r12,%rdi
+  801152:	48 b8 e4 27 80 00 00 	movabs $0x8027e4,%rax
+  801159:	00 00 00 
+  80115c:	ff d0                	call   *%rax
+    return bytes_read;
+  80115e:	48 89 d8             	mov    %rbx,%rax
+}
+  801161:	5b                   	pop    %rbx
+  801162:	41 5c                	pop    %r12
+  801164:	5d                   	pop    %rbp
+  801165:	c3                   	ret
+        return bytes_read;
+  801166:	48 98                	cltq
+  801168:	eb f7                	jmp    801161 <devfile_read+0x65>
+
+000000000080116a <open>:
+open(const char *path, int mode) {
+  80116a:	55                   	push   %rbp
+  80116b:	48 89 e5             	mov    %rsp,%rbp
+  80116e:	41 55                	push   %r13
+  801170:	41 54                	push   %r12
+  801172:	53                   	push   %rbx
+  801173:	48 83 ec 18          	sub    $0x18,%rsp
+  801177:	49 89 fc             	mov    %rdi,%r12
+  80117a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80117d:	48 b8 45 25 80 00 00 	movabs $0x802545,%rax
+  801184:	00 00 00 
+  801187:	ff d0                	call   *%rax
+  801189:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80118f:	0f 87 8a 00 00 00    	ja     80121f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801195:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801199:	48 b8 69 08 80 00 00 	movabs $0x800869,%rax
+  8011a0:	00 00 00 
+  8011a3:	ff d0                	call   *%rax
+  8011a5:	89 c3                	mov    %eax,%ebx
+  8011a7:	85 c0                	test   %eax,%eax
+  8011a9:	78 50                	js     8011fb <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8011ab:	4c 89 e6             	mov    %r12,%rsi
+  8011ae:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8011b5:	00 00 00 
+  8011b8:	48 89 df             	mov    %rbx,%rdi
+  8011bb:	48 b8 83 25 80 00 00 	movabs $0x802583,%rax
+  8011c2:	00 00 00 
+  8011c5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011c7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011ce:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8011d2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011d7:	48 b8 36 0f 80 00 00 	movabs $0x800f36,%rax
+  8011de:	00 00 00 
+  8011e1:	ff d0                	call   *%rax
+  8011e3:	89 c3                	mov    %eax,%ebx
+  8011e5:	85 c0                	test   %eax,%eax
+  8011e7:	78 1f                	js     801208 <open+0x9e>
+    return fd2num(fd);
+  8011e9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8011ed:	48 b8 3b 08 80 00 00 	movabs $0x80083b,%rax
+  8011f4:	00 00 00 
+  8011f7:	ff d0                	call   *%rax
+  8011f9:	89 c3                	mov    %eax,%ebx
+}
+  8011fb:	89 d8                	mov    %ebx,%eax
+  8011fd:	48 83 c4 18          	add    $0x18,%rsp
+  801201:	5b                   	pop    %rbx
+  801202:	41 5c                	pop    %r12
+  801204:	41 5d                	pop    %r13
+  801206:	5d                   	pop    %rbp
+  801207:	c3                   	ret
+        fd_close(fd, 0);
+  801208:	be 00 00 00 00       	mov    $0x0,%esi
+  80120d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801211:	48 b8 84 09 80 00 00 	movabs $0x800984,%rax
+  801218:	00 00 00 
+  80121b:	ff d0                	call   *%rax
+        return res;
+  80121d:	eb dc                	jmp    8011fb <open+0x91>
+        return -E_BAD_PATH;
+  80121f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801224:	eb d5                	jmp    8011fb <open+0x91>
+
+0000000000801226 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801226:	55                   	push   %rbp
+  801227:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80122a:	be 00 00 00 00       	mov    $0x0,%esi
+  80122f:	bf 08 00 00 00       	mov    $0x8,%edi
+  801234:	48 b8 36 0f 80 00 00 	movabs $0x800f36,%rax
+  80123b:	00 00 00 
+  80123e:	ff d0                	call   *%rax
+}
+  801240:	5d                   	pop    %rbp
+  801241:	c3                   	ret
+
+0000000000801242 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801242:	55                   	push   %rbp
+  801243:	48 89 e5             	mov    %rsp,%rbp
+  801246:	41 54                	push   %r12
+  801248:	53                   	push   %rbx
+  801249:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80124c:	48 b8 4d 08 80 00 00 	movabs $0x80084d,%rax
+  801253:	00 00 00 
+  801256:	ff d0                	call   *%rax
+  801258:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80125b:	48 be 20 2c 80 00 00 	movabs $0x802c20,%rsi
+  801262:	00 00 00 
+  801265:	48 89 df             	mov    %rbx,%rdi
+  801268:	48 b8 83 25 80 00 00 	movabs $0x802583,%rax
+  80126f:	00 00 00 
+  801272:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801274:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801279:	41 2b 04 24          	sub    (%r12),%eax
+  80127d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801283:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80128a:	00 00 00 
+    stat->st_dev = &devpipe;
+  80128d:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  801294:	00 00 00 
+  801297:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80129e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a3:	5b                   	pop    %rbx
+  8012a4:	41 5c                	pop    %r12
+  8012a6:	5d                   	pop    %rbp
+  8012a7:	c3                   	ret
+
+00000000008012a8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8012a8:	55                   	push   %rbp
+  8012a9:	48 89 e5             	mov    %rsp,%rbp
+  8012ac:	41 54                	push   %r12
+  8012ae:	53                   	push   %rbx
+  8012af:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8012b2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012b7:	48 89 fe             	mov    %rdi,%rsi
+  8012ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012bf:	49 bc 65 03 80 00 00 	movabs $0x800365,%r12
+  8012c6:	00 00 00 
+  8012c9:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012cc:	48 89 df             	mov    %rbx,%rdi
+  8012cf:	48 b8 4d 08 80 00 00 	movabs $0x80084d,%rax
+  8012d6:	00 00 00 
+  8012d9:	ff d0                	call   *%rax
+  8012db:	48 89 c6             	mov    %rax,%rsi
+  8012de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012e8:	41 ff d4             	call   *%r12
+}
+  8012eb:	5b                   	pop    %rbx
+  8012ec:	41 5c                	pop    %r12
+  8012ee:	5d                   	pop    %rbp
+  8012ef:	c3                   	ret
+
+00000000008012f0 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8012f0:	55                   	push   %rbp
+  8012f1:	48 89 e5             	mov    %rsp,%rbp
+  8012f4:	41 57                	push   %r15
+  8012f6:	41 56                	push   %r14
+  8012f8:	41 55                	push   %r13
+  8012fa:	41 54                	push   %r12
+  8012fc:	53                   	push   %rbx
+  8012fd:	48 83 ec 18          	sub    $0x18,%rsp
+  801301:	49 89 fc             	mov    %rdi,%r12
+  801304:	49 89 f5             	mov    %rsi,%r13
+  801307:	49 89 d7             	mov    %rdx,%r15
+  80130a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80130e:	48 b8 4d 08 80 00 00 	movabs $0x80084d,%rax
+  801315:	00 00 00 
+  801318:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80131a:	4d 85 ff             	test   %r15,%r15
+  80131d:	0f 84 af 00 00 00    	je     8013d2 <devpipe_write+0xe2>
+  801323:	48 89 c3             	mov    %rax,%rbx
+  801326:	4c 89 f8             	mov    %r15,%rax
+  801329:	4d 89 ef             	mov    %r13,%r15
+  80132c:	4c 01 e8             	add    %r13,%rax
+  80132f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801333:	49 bd 6d 02 80 00 00 	movabs $0x80026d,%r13
+  80133a:	00 00 00 
+            sys_yield();
+  80133d:	49 be 0a 02 80 00 00 	movabs $0x80020a,%r14
+  801344:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801347:	8b 73 04             	mov    0x4(%rbx),%esi
+  80134a:	48 63 ce             	movslq %esi,%rcx
+  80134d:	48 63 03             	movslq (%rbx),%rax
+  801350:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801356:	48 39 c1             	cmp    %rax,%rcx
+  801359:	72 2e                	jb     801389 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80135b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801360:	48 89 da             	mov    %rbx,%rdx
+  801363:	be 00 10 00 00       	mov    $0x1000,%esi
+  801368:	4c 89 e7             	mov    %r12,%rdi
+  80136b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80136e:	85 c0                	test   %eax,%eax
+  801370:	74 66                	je     8013d8 <devpipe_write+0xe8>
+            sys_yield();
+  801372:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801375:	8b 73 04             	mov    0x4(%rbx),%esi
+  801378:	48 63 ce             	movslq %esi,%rcx
+  80137b:	48 63 03             	movslq (%rbx),%rax
+  80137e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801384:	48 39 c1             	cmp    %rax,%rcx
+  801387:	73 d2                	jae    80135b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801389:	41 0f b6 3f          	movzbl (%r15),%edi
+  80138d:	48 89 ca             	mov    %rcx,%rdx
+  801390:	48 c1 ea 03          	shr    $0x3,%rdx
+  801394:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80139b:	08 10 20 
+  80139e:	48 f7 e2             	mul    %rdx
+  8013a1:	48 c1 ea 06          	shr    $0x6,%rdx
+  8013a5:	48 89 d0             	mov    %rdx,%rax
+  8013a8:	48 c1 e0 09          	shl    $0x9,%rax
+  8013ac:	48 29 d0             	sub    %rdx,%rax
+  8013af:	48 c1 e0 03          	shl    $0x3,%rax
+  8013b3:	48 29 c1             	sub    %rax,%rcx
+  8013b6:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013bb:	83 c6 01             	add    $0x1,%esi
+  8013be:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013c1:	49 83 c7 01          	add    $0x1,%r15
+  8013c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013c9:	49 39 c7             	cmp    %rax,%r15
+  8013cc:	0f 85 75 ff ff ff    	jne    801347 <devpipe_write+0x57>
+    return n;
+  8013d2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8013d6:	eb 05                	jmp    8013dd <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8013d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013dd:	48 83 c4 18          	add    $0x18,%rsp
+  8013e1:	5b                   	pop    %rbx
+  8013e2:	41 5c                	pop    %r12
+  8013e4:	41 5d                	pop    %r13
+  8013e6:	41 5e                	pop    %r14
+  8013e8:	41 5f                	pop    %r15
+  8013ea:	5d                   	pop    %rbp
+  8013eb:	c3                   	ret
+
+00000000008013ec <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8013ec:	55                   	push   %rbp
+  8013ed:	48 89 e5             	mov    %rsp,%rbp
+  8013f0:	41 57                	push   %r15
+  8013f2:	41 56                	push   %r14
+  8013f4:	41 55                	push   %r13
+  8013f6:	41 54                	push   %r12
+  8013f8:	53                   	push   %rbx
+  8013f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8013fd:	49 89 fc             	mov    %rdi,%r12
+  801400:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801404:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801408:	48 b8 4d 08 80 00 00 	movabs $0x80084d,%rax
+  80140f:	00 00 00 
+  801412:	ff d0                	call   *%rax
+  801414:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801417:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80141d:	49 bd 6d 02 80 00 00 	movabs $0x80026d,%r13
+  801424:	00 00 00 
+            sys_yield();
+  801427:	49 be 0a 02 80 00 00 	movabs $0x80020a,%r14
+  80142e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801431:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801436:	74 7d                	je     8014b5 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801438:	8b 03                	mov    (%rbx),%eax
+  80143a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80143d:	75 26                	jne    801465 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80143f:	4d 85 ff             	test   %r15,%r15
+  801442:	75 77                	jne    8014bb <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801444:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801449:	48 89 da             	mov    %rbx,%rdx
+  80144c:	be 00 10 00 00       	mov    $0x1000,%esi
+  801451:	4c 89 e7             	mov    %r12,%rdi
+  801454:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801457:	85 c0                	test   %eax,%eax
+  801459:	74 72                	je     8014cd <devpipe_read+0xe1>
+            sys_yield();
+  80145b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80145e:	8b 03                	mov    (%rbx),%eax
+  801460:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801463:	74 df                	je     801444 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801465:	48 63 c8             	movslq %eax,%rcx
+  801468:	48 89 ca             	mov    %rcx,%rdx
+  80146b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80146f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801476:	08 10 20 
+  801479:	48 89 d0             	mov    %rdx,%rax
+  80147c:	48 f7 e6             	mul    %rsi
+  80147f:	48 c1 ea 06          	shr    $0x6,%rdx
+  801483:	48 89 d0             	mov    %rdx,%rax
+  801486:	48 c1 e0 09          	shl    $0x9,%rax
+  80148a:	48 29 d0             	sub    %rdx,%rax
+  80148d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801494:	00 
+  801495:	48 89 c8             	mov    %rcx,%rax
+  801498:	48 29 d0             	sub    %rdx,%rax
+  80149b:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8014a0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8014a4:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8014a8:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8014ab:	49 83 c7 01          	add    $0x1,%r15
+  8014af:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8014b3:	75 83                	jne    801438 <devpipe_read+0x4c>
+    return n;
+  8014b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014b9:	eb 03                	jmp    8014be <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014bb:	4c 89 f8             	mov    %r15,%rax
+}
+  8014be:	48 83 c4 18          	add    $0x18,%rsp
+  8014c2:	5b                   	pop    %rbx
+  8014c3:	41 5c                	pop    %r12
+  8014c5:	41 5d                	pop    %r13
+  8014c7:	41 5e                	pop    %r14
+  8014c9:	41 5f                	pop    %r15
+  8014cb:	5d                   	pop    %rbp
+  8014cc:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d2:	eb ea                	jmp    8014be <devpipe_read+0xd2>
+
+00000000008014d4 <pipe>:
+pipe(int pfd[2]) {
+  8014d4:	55                   	push   %rbp
+  8014d5:	48 89 e5             	mov    %rsp,%rbp
+  8014d8:	41 55                	push   %r13
+  8014da:	41 54                	push   %r12
+  8014dc:	53                   	push   %rbx
+  8014dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8014e1:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8014e4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8014e8:	48 b8 69 08 80 00 00 	movabs $0x800869,%rax
+  8014ef:	00 00 00 
+  8014f2:	ff d0                	call   *%rax
+  8014f4:	89 c3                	mov    %eax,%ebx
+  8014f6:	85 c0                	test   %eax,%eax
+  8014f8:	0f 88 a0 01 00 00    	js     80169e <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8014fe:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801503:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801508:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80150c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801511:	48 b8 99 02 80 00 00 	movabs $0x800299,%rax
+  801518:	00 00 00 
+  80151b:	ff d0                	call   *%rax
+  80151d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80151f:	85 c0                	test   %eax,%eax
+  801521:	0f 88 77 01 00 00    	js     80169e <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801527:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80152b:	48 b8 69 08 80 00 00 	movabs $0x800869,%rax
+  801532:	00 00 00 
+  801535:	ff d0                	call   *%rax
+  801537:	89 c3                	mov    %eax,%ebx
+  801539:	85 c0                	test   %eax,%eax
+  80153b:	0f 88 43 01 00 00    	js     801684 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801541:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801546:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80154b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80154f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801554:	48 b8 99 02 80 00 00 	movabs $0x800299,%rax
+  80155b:	00 00 00 
+  80155e:	ff d0                	call   *%rax
+  801560:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801562:	85 c0                	test   %eax,%eax
+  801564:	0f 88 1a 01 00 00    	js     801684 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80156a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80156e:	48 b8 4d 08 80 00 00 	movabs $0x80084d,%rax
+  801575:	00 00 00 
+  801578:	ff d0                	call   *%rax
+  80157a:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80157d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801582:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801587:	48 89 c6             	mov    %rax,%rsi
+  80158a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80158f:	48 b8 99 02 80 00 00 	movabs $0x800299,%rax
+  801596:	00 00 00 
+  801599:	ff d0                	call   *%rax
+  80159b:	89 c3                	mov    %eax,%ebx
+  80159d:	85 c0                	test   %eax,%eax
+  80159f:	0f 88 c5 00 00 00    	js     80166a <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8015a5:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8015a9:	48 b8 4d 08 80 00 00 	movabs $0x80084d,%rax
+  8015b0:	00 00 00 
+  8015b3:	ff d0                	call   *%rax
+  8015b5:	48 89 c1             	mov    %rax,%rcx
+  8015b8:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8015be:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8015c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015c9:	4c 89 ee             	mov    %r13,%rsi
+  8015cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015d1:	48 b8 00 03 80 00 00 	movabs $0x800300,%rax
+  8015d8:	00 00 00 
+  8015db:	ff d0                	call   *%rax
+  8015dd:	89 c3                	mov    %eax,%ebx
+  8015df:	85 c0                	test   %eax,%eax
+  8015e1:	78 6e                	js     801651 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8015e3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8015e8:	4c 89 ef             	mov    %r13,%rdi
+  8015eb:	48 b8 3b 02 80 00 00 	movabs $0x80023b,%rax
+  8015f2:	00 00 00 
+  8015f5:	ff d0                	call   *%rax
+  8015f7:	83 f8 02             	cmp    $0x2,%eax
+  8015fa:	0f 85 ab 00 00 00    	jne    8016ab <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801600:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  801607:	00 00 
+  801609:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80160d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80160f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801613:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80161a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80161e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801620:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801624:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80162b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80162f:	48 bb 3b 08 80 00 00 	movabs $0x80083b,%rbx
+  801636:	00 00 00 
+  801639:	ff d3                	call   *%rbx
+  80163b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80163f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801643:	ff d3                	call   *%rbx
+  801645:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80164a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164f:	eb 4d                	jmp    80169e <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  801651:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801656:	4c 89 ee             	mov    %r13,%rsi
+  801659:	bf 00 00 00 00       	mov    $0x0,%edi
+  80165e:	48 b8 65 03 80 00 00 	movabs $0x800365,%rax
+  801665:	00 00 00 
+  801668:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80166a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80166f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801673:	bf 00 00 00 00       	mov    $0x0,%edi
+  801678:	48 b8 65 03 80 00 00 	movabs $0x800365,%rax
+  80167f:	00 00 00 
+  801682:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  801684:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801689:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80168d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801692:	48 b8 65 03 80 00 00 	movabs $0x800365,%rax
+  801699:	00 00 00 
+  80169c:	ff d0                	call   *%rax
+}
+  80169e:	89 d8                	mov    %ebx,%eax
+  8016a0:	48 83 c4 18          	add    $0x18,%rsp
+  8016a4:	5b                   	pop    %rbx
+  8016a5:	41 5c                	pop    %r12
+  8016a7:	41 5d                	pop    %r13
+  8016a9:	5d                   	pop    %rbp
+  8016aa:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8016ab:	48 b9 50 2c 80 00 00 	movabs $0x802c50,%rcx
+  8016b2:	00 00 00 
+  8016b5:	48 ba 27 2c 80 00 00 	movabs $0x802c27,%rdx
+  8016bc:	00 00 00 
+  8016bf:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8016c4:	48 bf 3c 2c 80 00 00 	movabs $0x802c3c,%rdi
+  8016cb:	00 00 00 
+  8016ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d3:	49 b8 0e 1b 80 00 00 	movabs $0x801b0e,%r8
+  8016da:	00 00 00 
+  8016dd:	41 ff d0             	call   *%r8
+
+00000000008016e0 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8016e0:	55                   	push   %rbp
+  8016e1:	48 89 e5             	mov    %rsp,%rbp
+  8016e4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8016e8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8016ec:	48 b8 c9 08 80 00 00 	movabs $0x8008c9,%rax
+  8016f3:	00 00 00 
+  8016f6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8016f8:	85 c0                	test   %eax,%eax
+  8016fa:	78 35                	js     801731 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8016fc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801700:	48 b8 4d 08 80 00 00 	movabs $0x80084d,%rax
+  801707:	00 00 00 
+  80170a:	ff d0                	call   *%rax
+  80170c:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80170f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801714:	be 00 10 00 00       	mov    $0x1000,%esi
+  801719:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80171d:	48 b8 6d 02 80 00 00 	movabs $0x80026d,%rax
+  801724:	00 00 00 
+  801727:	ff d0                	call   *%rax
+  801729:	85 c0                	test   %eax,%eax
+  80172b:	0f 94 c0             	sete   %al
+  80172e:	0f b6 c0             	movzbl %al,%eax
+}
+  801731:	c9                   	leave
+  801732:	c3                   	ret
+
+0000000000801733 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801733:	48 89 f8             	mov    %rdi,%rax
+  801736:	48 c1 e8 27          	shr    $0x27,%rax
+  80173a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801741:	01 00 00 
+  801744:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801748:	f6 c2 01             	test   $0x1,%dl
+  80174b:	74 6d                	je     8017ba <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80174d:	48 89 f8             	mov    %rdi,%rax
+  801750:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801754:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80175b:	01 00 00 
+  80175e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801762:	f6 c2 01             	test   $0x1,%dl
+  801765:	74 62                	je     8017c9 <get_uvpt_entry+0x96>
+  801767:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80176e:	01 00 00 
+  801771:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801775:	f6 c2 80             	test   $0x80,%dl
+  801778:	75 4f                	jne    8017c9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80177a:	48 89 f8             	mov    %rdi,%rax
+  80177d:	48 c1 e8 15          	shr    $0x15,%rax
+  801781:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801788:	01 00 00 
+  80178b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80178f:	f6 c2 01             	test   $0x1,%dl
+  801792:	74 44                	je     8017d8 <get_uvpt_entry+0xa5>
+  801794:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80179b:	01 00 00 
+  80179e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017a2:	f6 c2 80             	test   $0x80,%dl
+  8017a5:	75 31                	jne    8017d8 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8017a7:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8017ab:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8017b2:	01 00 00 
+  8017b5:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8017b9:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017ba:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017c1:	01 00 00 
+  8017c4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017c8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017c9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017d0:	01 00 00 
+  8017d3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017d7:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017d8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017df:	01 00 00 
+  8017e2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017e6:	c3                   	ret
+
+00000000008017e7 <get_prot>:
+
+int
+get_prot(void *va) {
+  8017e7:	55                   	push   %rbp
+  8017e8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8017eb:	48 b8 33 17 80 00 00 	movabs $0x801733,%rax
+  8017f2:	00 00 00 
+  8017f5:	ff d0                	call   *%rax
+  8017f7:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8017fa:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8017ff:	89 c1                	mov    %eax,%ecx
+  801801:	83 c9 04             	or     $0x4,%ecx
+  801804:	f6 c2 01             	test   $0x1,%dl
+  801807:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80180a:	89 c1                	mov    %eax,%ecx
+  80180c:	83 c9 02             	or     $0x2,%ecx
+  80180f:	f6 c2 02             	test   $0x2,%dl
+  801812:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  801815:	89 c1                	mov    %eax,%ecx
+  801817:	83 c9 01             	or     $0x1,%ecx
+  80181a:	48 85 d2             	test   %rdx,%rdx
+  80181d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801820:	89 c1                	mov    %eax,%ecx
+  801822:	83 c9 40             	or     $0x40,%ecx
+  801825:	f6 c6 04             	test   $0x4,%dh
+  801828:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80182b:	5d                   	pop    %rbp
+  80182c:	c3                   	ret
+
+000000000080182d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80182d:	55                   	push   %rbp
+  80182e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801831:	48 b8 33 17 80 00 00 	movabs $0x801733,%rax
+  801838:	00 00 00 
+  80183b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80183d:	48 c1 e8 06          	shr    $0x6,%rax
+  801841:	83 e0 01             	and    $0x1,%eax
+}
+  801844:	5d                   	pop    %rbp
+  801845:	c3                   	ret
+
+0000000000801846 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  801846:	55                   	push   %rbp
+  801847:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80184a:	48 b8 33 17 80 00 00 	movabs $0x801733,%rax
+  801851:	00 00 00 
+  801854:	ff d0                	call   *%rax
+  801856:	83 e0 01             	and    $0x1,%eax
+}
+  801859:	5d                   	pop    %rbp
+  80185a:	c3                   	ret
+
+000000000080185b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80185b:	55                   	push   %rbp
+  80185c:	48 89 e5             	mov    %rsp,%rbp
+  80185f:	41 57                	push   %r15
+  801861:	41 56                	push   %r14
+  801863:	41 55                	push   %r13
+  801865:	41 54                	push   %r12
+  801867:	53                   	push   %rbx
+  801868:	48 83 ec 18          	sub    $0x18,%rsp
+  80186c:	49 89 ff             	mov    %rdi,%r15
+  80186f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  801873:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  801878:	49 bc 46 18 80 00 00 	movabs $0x801846,%r12
+  80187f:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  801882:	49 be e7 17 80 00 00 	movabs $0x8017e7,%r14
+  801889:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80188c:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  801893:	00 00 00 
+  801896:	eb 0c                	jmp    8018a4 <foreach_shared_region+0x49>
+  801898:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80189f:	4c 39 eb             	cmp    %r13,%rbx
+  8018a2:	74 38                	je     8018dc <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  8018a4:	48 89 df             	mov    %rbx,%rdi
+  8018a7:	41 ff d4             	call   *%r12
+  8018aa:	84 c0                	test   %al,%al
+  8018ac:	74 ea                	je     801898 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  8018ae:	48 89 df             	mov    %rbx,%rdi
+  8018b1:	41 ff d6             	call   *%r14
+  8018b4:	a8 40                	test   $0x40,%al
+  8018b6:	74 e0                	je     801898 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8018b8:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8018bf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8018c3:	48 89 df             	mov    %rbx,%rdi
+  8018c6:	41 ff d7             	call   *%r15
+        if (err)
+  8018c9:	85 c0                	test   %eax,%eax
+  8018cb:	74 cb                	je     801898 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8018cd:	48 83 c4 18          	add    $0x18,%rsp
+  8018d1:	5b                   	pop    %rbx
+  8018d2:	41 5c                	pop    %r12
+  8018d4:	41 5d                	pop    %r13
+  8018d6:	41 5e                	pop    %r14
+  8018d8:	41 5f                	pop    %r15
+  8018da:	5d                   	pop    %rbp
+  8018db:	c3                   	ret
+    return 0;
+  8018dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e1:	eb ea                	jmp    8018cd <foreach_shared_region+0x72>
+
+00000000008018e3 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8018e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e8:	c3                   	ret
+
+00000000008018e9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8018e9:	55                   	push   %rbp
+  8018ea:	48 89 e5             	mov    %rsp,%rbp
+  8018ed:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8018f0:	48 be 74 2c 80 00 00 	movabs $0x802c74,%rsi
+  8018f7:	00 00 00 
+  8018fa:	48 b8 83 25 80 00 00 	movabs $0x802583,%rax
+  801901:	00 00 00 
+  801904:	ff d0                	call   *%rax
+    return 0;
+}
+  801906:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190b:	5d                   	pop    %rbp
+  80190c:	c3                   	ret
+
+000000000080190d <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80190d:	55                   	push   %rbp
+  80190e:	48 89 e5             	mov    %rsp,%rbp
+  801911:	41 57                	push   %r15
+  801913:	41 56                	push   %r14
+  801915:	41 55                	push   %r13
+  801917:	41 54                	push   %r12
+  801919:	53                   	push   %rbx
+  80191a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801921:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801928:	48 85 d2             	test   %rdx,%rdx
+  80192b:	74 7a                	je     8019a7 <devcons_write+0x9a>
+  80192d:	49 89 d6             	mov    %rdx,%r14
+  801930:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801936:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80193b:	49 bf 7d 27 80 00 00 	movabs $0x80277d,%r15
+  801942:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801945:	4c 89 f3             	mov    %r14,%rbx
+  801948:	48 29 f3             	sub    %rsi,%rbx
+  80194b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801950:	48 39 c3             	cmp    %rax,%rbx
+  801953:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801957:	4c 63 eb             	movslq %ebx,%r13
+  80195a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801961:	48 01 c6             	add    %rax,%rsi
+  801964:	4c 89 ea             	mov    %r13,%rdx
+  801967:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80196e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801971:	4c 89 ee             	mov    %r13,%rsi
+  801974:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80197b:	48 b8 10 01 80 00 00 	movabs $0x800110,%rax
+  801982:	00 00 00 
+  801985:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801987:	41 01 dc             	add    %ebx,%r12d
+  80198a:	49 63 f4             	movslq %r12d,%rsi
+  80198d:	4c 39 f6             	cmp    %r14,%rsi
+  801990:	72 b3                	jb     801945 <devcons_write+0x38>
+    return res;
+  801992:	49 63 c4             	movslq %r12d,%rax
+}
+  801995:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80199c:	5b                   	pop    %rbx
+  80199d:	41 5c                	pop    %r12
+  80199f:	41 5d                	pop    %r13
+  8019a1:	41 5e                	pop    %r14
+  8019a3:	41 5f                	pop    %r15
+  8019a5:	5d                   	pop    %rbp
+  8019a6:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8019a7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8019ad:	eb e3                	jmp    801992 <devcons_write+0x85>
+
+00000000008019af <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8019af:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8019b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b7:	48 85 c0             	test   %rax,%rax
+  8019ba:	74 55                	je     801a11 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8019bc:	55                   	push   %rbp
+  8019bd:	48 89 e5             	mov    %rsp,%rbp
+  8019c0:	41 55                	push   %r13
+  8019c2:	41 54                	push   %r12
+  8019c4:	53                   	push   %rbx
+  8019c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8019c9:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8019cc:	48 bb 3d 01 80 00 00 	movabs $0x80013d,%rbx
+  8019d3:	00 00 00 
+  8019d6:	49 bc 0a 02 80 00 00 	movabs $0x80020a,%r12
+  8019dd:	00 00 00 
+  8019e0:	eb 03                	jmp    8019e5 <devcons_read+0x36>
+  8019e2:	41 ff d4             	call   *%r12
+  8019e5:	ff d3                	call   *%rbx
+  8019e7:	85 c0                	test   %eax,%eax
+  8019e9:	74 f7                	je     8019e2 <devcons_read+0x33>
+    if (c < 0) return c;
+  8019eb:	48 63 d0             	movslq %eax,%rdx
+  8019ee:	78 13                	js     801a03 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8019f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f5:	83 f8 04             	cmp    $0x4,%eax
+  8019f8:	74 09                	je     801a03 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8019fa:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8019fe:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801a03:	48 89 d0             	mov    %rdx,%rax
+  801a06:	48 83 c4 08          	add    $0x8,%rsp
+  801a0a:	5b                   	pop    %rbx
+  801a0b:	41 5c                	pop    %r12
+  801a0d:	41 5d                	pop    %r13
+  801a0f:	5d                   	pop    %rbp
+  801a10:	c3                   	ret
+  801a11:	48 89 d0             	mov    %rdx,%rax
+  801a14:	c3                   	ret
+
+0000000000801a15 <cputchar>:
+cputchar(int ch) {
+  801a15:	55                   	push   %rbp
+  801a16:	48 89 e5             	mov    %rsp,%rbp
+  801a19:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801a1d:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801a21:	be 01 00 00 00       	mov    $0x1,%esi
+  801a26:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801a2a:	48 b8 10 01 80 00 00 	movabs $0x800110,%rax
+  801a31:	00 00 00 
+  801a34:	ff d0                	call   *%rax
+}
+  801a36:	c9                   	leave
+  801a37:	c3                   	ret
+
+0000000000801a38 <getchar>:
+getchar(void) {
+  801a38:	55                   	push   %rbp
+  801a39:	48 89 e5             	mov    %rsp,%rbp
+  801a3c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801a40:	ba 01 00 00 00       	mov    $0x1,%edx
+  801a45:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801a49:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a4e:	48 b8 ac 0b 80 00 00 	movabs $0x800bac,%rax
+  801a55:	00 00 00 
+  801a58:	ff d0                	call   *%rax
+  801a5a:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801a5c:	85 c0                	test   %eax,%eax
+  801a5e:	78 06                	js     801a66 <getchar+0x2e>
+  801a60:	74 08                	je     801a6a <getchar+0x32>
+  801a62:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801a66:	89 d0                	mov    %edx,%eax
+  801a68:	c9                   	leave
+  801a69:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801a6a:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801a6f:	eb f5                	jmp    801a66 <getchar+0x2e>
+
+0000000000801a71 <iscons>:
+iscons(int fdnum) {
+  801a71:	55                   	push   %rbp
+  801a72:	48 89 e5             	mov    %rsp,%rbp
+  801a75:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801a79:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a7d:	48 b8 c9 08 80 00 00 	movabs $0x8008c9,%rax
+  801a84:	00 00 00 
+  801a87:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a89:	85 c0                	test   %eax,%eax
+  801a8b:	78 18                	js     801aa5 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801a8d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a91:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801a98:	00 00 00 
+  801a9b:	8b 00                	mov    (%rax),%eax
+  801a9d:	39 02                	cmp    %eax,(%rdx)
+  801a9f:	0f 94 c0             	sete   %al
+  801aa2:	0f b6 c0             	movzbl %al,%eax
+}
+  801aa5:	c9                   	leave
+  801aa6:	c3                   	ret
+
+0000000000801aa7 <opencons>:
+opencons(void) {
+  801aa7:	55                   	push   %rbp
+  801aa8:	48 89 e5             	mov    %rsp,%rbp
+  801aab:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801aaf:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801ab3:	48 b8 69 08 80 00 00 	movabs $0x800869,%rax
+  801aba:	00 00 00 
+  801abd:	ff d0                	call   *%rax
+  801abf:	85 c0                	test   %eax,%eax
+  801ac1:	78 49                	js     801b0c <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801ac3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ac8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801acd:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801ad1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ad6:	48 b8 99 02 80 00 00 	movabs $0x800299,%rax
+  801add:	00 00 00 
+  801ae0:	ff d0                	call   *%rax
+  801ae2:	85 c0                	test   %eax,%eax
+  801ae4:	78 26                	js     801b0c <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801ae6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801aea:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801af1:	00 00 
+  801af3:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801af5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801af9:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801b00:	48 b8 3b 08 80 00 00 	movabs $0x80083b,%rax
+  801b07:	00 00 00 
+  801b0a:	ff d0                	call   *%rax
+}
+  801b0c:	c9                   	leave
+  801b0d:	c3                   	ret
+
+0000000000801b0e <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801b0e:	55                   	push   %rbp
+  801b0f:	48 89 e5             	mov    %rsp,%rbp
+  801b12:	41 56                	push   %r14
+  801b14:	41 55                	push   %r13
+  801b16:	41 54                	push   %r12
+  801b18:	53                   	push   %rbx
+  801b19:	48 83 ec 50          	sub    $0x50,%rsp
+  801b1d:	49 89 fc             	mov    %rdi,%r12
+  801b20:	41 89 f5             	mov    %esi,%r13d
+  801b23:	48 89 d3             	mov    %rdx,%rbx
+  801b26:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b2a:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801b2e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801b32:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801b39:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b3d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801b41:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801b45:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801b49:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801b50:	00 00 00 
+  801b53:	4c 8b 30             	mov    (%rax),%r14
+  801b56:	48 b8 d9 01 80 00 00 	movabs $0x8001d9,%rax
+  801b5d:	00 00 00 
+  801b60:	ff d0                	call   *%rax
+  801b62:	89 c6                	mov    %eax,%esi
+  801b64:	45 89 e8             	mov    %r13d,%r8d
+  801b67:	4c 89 e1             	mov    %r12,%rcx
+  801b6a:	4c 89 f2             	mov    %r14,%rdx
+  801b6d:	48 bf 80 2c 80 00 00 	movabs $0x802c80,%rdi
+  801b74:	00 00 00 
+  801b77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b7c:	49 bc 5e 1c 80 00 00 	movabs $0x801c5e,%r12
+  801b83:	00 00 00 
+  801b86:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801b89:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801b8d:	48 89 df             	mov    %rbx,%rdi
+  801b90:	48 b8 fa 1b 80 00 00 	movabs $0x801bfa,%rax
+  801b97:	00 00 00 
+  801b9a:	ff d0                	call   *%rax
+    cprintf("\n");
+  801b9c:	48 bf cb 2b 80 00 00 	movabs $0x802bcb,%rdi
+  801ba3:	00 00 00 
+  801ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bab:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801bae:	cc                   	int3
+  801baf:	eb fd                	jmp    801bae <_panic+0xa0>
+
+0000000000801bb1 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801bb1:	55                   	push   %rbp
+  801bb2:	48 89 e5             	mov    %rsp,%rbp
+  801bb5:	53                   	push   %rbx
+  801bb6:	48 83 ec 08          	sub    $0x8,%rsp
+  801bba:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801bbd:	8b 06                	mov    (%rsi),%eax
+  801bbf:	8d 50 01             	lea    0x1(%rax),%edx
+  801bc2:	89 16                	mov    %edx,(%rsi)
+  801bc4:	48 98                	cltq
+  801bc6:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801bcb:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801bd1:	74 0a                	je     801bdd <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801bd3:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801bd7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bdb:	c9                   	leave
+  801bdc:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801bdd:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801be1:	be ff 00 00 00       	mov    $0xff,%esi
+  801be6:	48 b8 10 01 80 00 00 	movabs $0x800110,%rax
+  801bed:	00 00 00 
+  801bf0:	ff d0                	call   *%rax
+        state->offset = 0;
+  801bf2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801bf8:	eb d9                	jmp    801bd3 <putch+0x22>
+
+0000000000801bfa <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801bfa:	55                   	push   %rbp
+  801bfb:	48 89 e5             	mov    %rsp,%rbp
+  801bfe:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801c05:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801c08:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801c0f:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801c14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c19:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801c1c:	48 89 f1             	mov    %rsi,%rcx
+  801c1f:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801c26:	48 bf b1 1b 80 00 00 	movabs $0x801bb1,%rdi
+  801c2d:	00 00 00 
+  801c30:	48 b8 ae 1d 80 00 00 	movabs $0x801dae,%rax
+  801c37:	00 00 00 
+  801c3a:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801c3c:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801c43:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801c4a:	48 b8 10 01 80 00 00 	movabs $0x800110,%rax
+  801c51:	00 00 00 
+  801c54:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801c56:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801c5c:	c9                   	leave
+  801c5d:	c3                   	ret
+
+0000000000801c5e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801c5e:	55                   	push   %rbp
+  801c5f:	48 89 e5             	mov    %rsp,%rbp
+  801c62:	48 83 ec 50          	sub    $0x50,%rsp
+  801c66:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801c6a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801c6e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c72:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801c76:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801c7a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801c81:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c89:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801c8d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801c91:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801c95:	48 b8 fa 1b 80 00 00 	movabs $0x801bfa,%rax
+  801c9c:	00 00 00 
+  801c9f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801ca1:	c9                   	leave
+  801ca2:	c3                   	ret
+
+0000000000801ca3 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801ca3:	55                   	push   %rbp
+  801ca4:	48 89 e5             	mov    %rsp,%rbp
+  801ca7:	41 57                	push   %r15
+  801ca9:	41 56                	push   %r14
+  801cab:	41 55                	push   %r13
+  801cad:	41 54                	push   %r12
+  801caf:	53                   	push   %rbx
+  801cb0:	48 83 ec 18          	sub    $0x18,%rsp
+  801cb4:	49 89 fc             	mov    %rdi,%r12
+  801cb7:	49 89 f5             	mov    %rsi,%r13
+  801cba:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cbe:	8b 45 10             	mov    0x10(%rbp),%eax
+  801cc1:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801cc4:	41 89 cf             	mov    %ecx,%r15d
+  801cc7:	4c 39 fa             	cmp    %r15,%rdx
+  801cca:	73 5b                	jae    801d27 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801ccc:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801cd0:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801cd4:	85 db                	test   %ebx,%ebx
+  801cd6:	7e 0e                	jle    801ce6 <print_num+0x43>
+            putch(padc, put_arg);
+  801cd8:	4c 89 ee             	mov    %r13,%rsi
+  801cdb:	44 89 f7             	mov    %r14d,%edi
+  801cde:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801ce1:	83 eb 01             	sub    $0x1,%ebx
+  801ce4:	75 f2                	jne    801cd8 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801ce6:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801cea:	48 b9 b4 2c 80 00 00 	movabs $0x802cb4,%rcx
+  801cf1:	00 00 00 
+  801cf4:	48 b8 a3 2c 80 00 00 	movabs $0x802ca3,%rax
+  801cfb:	00 00 00 
+  801cfe:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801d02:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d06:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d0b:	49 f7 f7             	div    %r15
+  801d0e:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801d12:	4c 89 ee             	mov    %r13,%rsi
+  801d15:	41 ff d4             	call   *%r12
+}
+  801d18:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801d1c:	5b                   	pop    %rbx
+  801d1d:	41 5c                	pop    %r12
+  801d1f:	41 5d                	pop    %r13
+  801d21:	41 5e                	pop    %r14
+  801d23:	41 5f                	pop    %r15
+  801d25:	5d                   	pop    %rbp
+  801d26:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801d27:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d30:	49 f7 f7             	div    %r15
+  801d33:	48 83 ec 08          	sub    $0x8,%rsp
+  801d37:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801d3b:	52                   	push   %rdx
+  801d3c:	45 0f be c9          	movsbl %r9b,%r9d
+  801d40:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801d44:	48 89 c2             	mov    %rax,%rdx
+  801d47:	48 b8 a3 1c 80 00 00 	movabs $0x801ca3,%rax
+  801d4e:	00 00 00 
+  801d51:	ff d0                	call   *%rax
+  801d53:	48 83 c4 10          	add    $0x10,%rsp
+  801d57:	eb 8d                	jmp    801ce6 <print_num+0x43>
+
+0000000000801d59 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801d59:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801d5d:	48 8b 06             	mov    (%rsi),%rax
+  801d60:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801d64:	73 0a                	jae    801d70 <sprintputch+0x17>
+        *state->start++ = ch;
+  801d66:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d6a:	48 89 16             	mov    %rdx,(%rsi)
+  801d6d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801d70:	c3                   	ret
+
+0000000000801d71 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801d71:	55                   	push   %rbp
+  801d72:	48 89 e5             	mov    %rsp,%rbp
+  801d75:	48 83 ec 50          	sub    $0x50,%rsp
+  801d79:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d7d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d81:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801d85:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801d8c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d94:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801d98:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801d9c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801da0:	48 b8 ae 1d 80 00 00 	movabs $0x801dae,%rax
+  801da7:	00 00 00 
+  801daa:	ff d0                	call   *%rax
+}
+  801dac:	c9                   	leave
+  801dad:	c3                   	ret
+
+0000000000801dae <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801dae:	55                   	push   %rbp
+  801daf:	48 89 e5             	mov    %rsp,%rbp
+  801db2:	41 57                	push   %r15
+  801db4:	41 56                	push   %r14
+  801db6:	41 55                	push   %r13
+  801db8:	41 54                	push   %r12
+  801dba:	53                   	push   %rbx
+  801dbb:	48 83 ec 38          	sub    $0x38,%rsp
+  801dbf:	49 89 fe             	mov    %rdi,%r14
+  801dc2:	49 89 f5             	mov    %rsi,%r13
+  801dc5:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801dc8:	48 8b 01             	mov    (%rcx),%rax
+  801dcb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801dcf:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801dd3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dd7:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801ddb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801ddf:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801de3:	0f b6 3b             	movzbl (%rbx),%edi
+  801de6:	40 80 ff 25          	cmp    $0x25,%dil
+  801dea:	74 18                	je     801e04 <vprintfmt+0x56>
+            if (!ch) return;
+  801dec:	40 84 ff             	test   %dil,%dil
+  801def:	0f 84 b1 06 00 00    	je     8024a6 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801df5:	40 0f b6 ff          	movzbl %dil,%edi
+  801df9:	4c 89 ee             	mov    %r13,%rsi
+  801dfc:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801dff:	4c 89 e3             	mov    %r12,%rbx
+  801e02:	eb db                	jmp    801ddf <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801e04:	be 00 00 00 00       	mov    $0x0,%esi
+  801e09:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801e0d:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801e12:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e18:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801e1f:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e23:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801e28:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801e2d:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801e30:	83 e8 23             	sub    $0x23,%eax
+  801e33:	3c 57                	cmp    $0x57,%al
+  801e35:	0f 87 51 06 00 00    	ja     80248c <vprintfmt+0x6de>
+  801e3b:	0f b6 c0             	movzbl %al,%eax
+  801e3e:	48 b9 60 2e 80 00 00 	movabs $0x802e60,%rcx
+  801e45:	00 00 00 
+  801e48:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801e4b:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801e4e:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801e52:	eb cf                	jmp    801e23 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801e54:	49 89 dc             	mov    %rbx,%r12
+  801e57:	be 01 00 00 00       	mov    $0x1,%esi
+  801e5c:	eb c5                	jmp    801e23 <vprintfmt+0x75>
+            padc = ch;
+  801e5e:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801e62:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e65:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801e68:	eb b9                	jmp    801e23 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e6d:	83 f8 2f             	cmp    $0x2f,%eax
+  801e70:	77 24                	ja     801e96 <vprintfmt+0xe8>
+  801e72:	89 c1                	mov    %eax,%ecx
+  801e74:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801e78:	83 c0 08             	add    $0x8,%eax
+  801e7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e7e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801e81:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801e84:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801e88:	79 99                	jns    801e23 <vprintfmt+0x75>
+                width = precision;
+  801e8a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801e8e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e94:	eb 8d                	jmp    801e23 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e96:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e9a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801e9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ea2:	eb da                	jmp    801e7e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801ea4:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801ea9:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801ead:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801eb3:	3c 39                	cmp    $0x39,%al
+  801eb5:	77 1c                	ja     801ed3 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801eb7:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801ebb:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801ebf:	0f b6 c0             	movzbl %al,%eax
+  801ec2:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801ec7:	0f b6 03             	movzbl (%rbx),%eax
+  801eca:	3c 39                	cmp    $0x39,%al
+  801ecc:	76 e9                	jbe    801eb7 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801ece:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801ed1:	eb b1                	jmp    801e84 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801ed3:	49 89 dc             	mov    %rbx,%r12
+  801ed6:	eb ac                	jmp    801e84 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801ed8:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801edb:	85 c9                	test   %ecx,%ecx
+  801edd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee2:	0f 49 c1             	cmovns %ecx,%eax
+  801ee5:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801ee8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801eeb:	e9 33 ff ff ff       	jmp    801e23 <vprintfmt+0x75>
+            lflag++;
+  801ef0:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ef3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ef6:	e9 28 ff ff ff       	jmp    801e23 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801efb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801efe:	83 f8 2f             	cmp    $0x2f,%eax
+  801f01:	77 19                	ja     801f1c <vprintfmt+0x16e>
+  801f03:	89 c2                	mov    %eax,%edx
+  801f05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f09:	83 c0 08             	add    $0x8,%eax
+  801f0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f0f:	8b 3a                	mov    (%rdx),%edi
+  801f11:	4c 89 ee             	mov    %r13,%rsi
+  801f14:	41 ff d6             	call   *%r14
+            break;
+  801f17:	e9 c3 fe ff ff       	jmp    801ddf <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  801f1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f28:	eb e5                	jmp    801f0f <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  801f2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f2d:	83 f8 2f             	cmp    $0x2f,%eax
+  801f30:	77 5a                	ja     801f8c <vprintfmt+0x1de>
+  801f32:	89 c2                	mov    %eax,%edx
+  801f34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f38:	83 c0 08             	add    $0x8,%eax
+  801f3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801f3e:	8b 02                	mov    (%rdx),%eax
+  801f40:	89 c1                	mov    %eax,%ecx
+  801f42:	f7 d9                	neg    %ecx
+  801f44:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801f47:	83 f9 15             	cmp    $0x15,%ecx
+  801f4a:	7f 4e                	jg     801f9a <vprintfmt+0x1ec>
+  801f4c:	48 63 c1             	movslq %ecx,%rax
+  801f4f:	48 ba 20 31 80 00 00 	movabs $0x803120,%rdx
+  801f56:	00 00 00 
+  801f59:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801f5d:	48 85 c0             	test   %rax,%rax
+  801f60:	74 38                	je     801f9a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801f62:	48 89 c1             	mov    %rax,%rcx
+  801f65:	48 ba 39 2c 80 00 00 	movabs $0x802c39,%rdx
+  801f6c:	00 00 00 
+  801f6f:	4c 89 ee             	mov    %r13,%rsi
+  801f72:	4c 89 f7             	mov    %r14,%rdi
+  801f75:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7a:	49 b8 71 1d 80 00 00 	movabs $0x801d71,%r8
+  801f81:	00 00 00 
+  801f84:	41 ff d0             	call   *%r8
+  801f87:	e9 53 fe ff ff       	jmp    801ddf <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801f8c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f90:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f98:	eb a4                	jmp    801f3e <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801f9a:	48 ba cc 2c 80 00 00 	movabs $0x802ccc,%rdx
+  801fa1:	00 00 00 
+  801fa4:	4c 89 ee             	mov    %r13,%rsi
+  801fa7:	4c 89 f7             	mov    %r14,%rdi
+  801faa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801faf:	49 b8 71 1d 80 00 00 	movabs $0x801d71,%r8
+  801fb6:	00 00 00 
+  801fb9:	41 ff d0             	call   *%r8
+  801fbc:	e9 1e fe ff ff       	jmp    801ddf <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801fc1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fc4:	83 f8 2f             	cmp    $0x2f,%eax
+  801fc7:	77 6c                	ja     802035 <vprintfmt+0x287>
+  801fc9:	89 c2                	mov    %eax,%edx
+  801fcb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fcf:	83 c0 08             	add    $0x8,%eax
+  801fd2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fd5:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801fd8:	48 85 d2             	test   %rdx,%rdx
+  801fdb:	48 b8 c5 2c 80 00 00 	movabs $0x802cc5,%rax
+  801fe2:	00 00 00 
+  801fe5:	48 0f 45 c2          	cmovne %rdx,%rax
+  801fe9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801fed:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801ff1:	7e 06                	jle    801ff9 <vprintfmt+0x24b>
+  801ff3:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801ff7:	75 4a                	jne    802043 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ff9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801ffd:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  802001:	0f b6 00             	movzbl (%rax),%eax
+  802004:	84 c0                	test   %al,%al
+  802006:	0f 85 9a 00 00 00    	jne    8020a6 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80200c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80200f:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802013:	85 c0                	test   %eax,%eax
+  802015:	0f 8e c4 fd ff ff    	jle    801ddf <vprintfmt+0x31>
+  80201b:	4c 89 ee             	mov    %r13,%rsi
+  80201e:	bf 20 00 00 00       	mov    $0x20,%edi
+  802023:	41 ff d6             	call   *%r14
+  802026:	41 83 ec 01          	sub    $0x1,%r12d
+  80202a:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80202e:	75 eb                	jne    80201b <vprintfmt+0x26d>
+  802030:	e9 aa fd ff ff       	jmp    801ddf <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802035:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802039:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80203d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802041:	eb 92                	jmp    801fd5 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802043:	49 63 f7             	movslq %r15d,%rsi
+  802046:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80204a:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802051:	00 00 00 
+  802054:	ff d0                	call   *%rax
+  802056:	48 89 c2             	mov    %rax,%rdx
+  802059:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80205c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80205e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802061:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802064:	85 c0                	test   %eax,%eax
+  802066:	7e 91                	jle    801ff9 <vprintfmt+0x24b>
+  802068:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80206d:	4c 89 ee             	mov    %r13,%rsi
+  802070:	44 89 e7             	mov    %r12d,%edi
+  802073:	41 ff d6             	call   *%r14
+  802076:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80207a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80207d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802080:	75 eb                	jne    80206d <vprintfmt+0x2bf>
+  802082:	e9 72 ff ff ff       	jmp    801ff9 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802087:	0f b6 f8             	movzbl %al,%edi
+  80208a:	4c 89 ee             	mov    %r13,%rsi
+  80208d:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802090:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802094:	49 83 c4 01          	add    $0x1,%r12
+  802098:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80209e:	84 c0                	test   %al,%al
+  8020a0:	0f 84 66 ff ff ff    	je     80200c <vprintfmt+0x25e>
+  8020a6:	45 85 ff             	test   %r15d,%r15d
+  8020a9:	78 0a                	js     8020b5 <vprintfmt+0x307>
+  8020ab:	41 83 ef 01          	sub    $0x1,%r15d
+  8020af:	0f 88 57 ff ff ff    	js     80200c <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8020b5:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8020b9:	74 cc                	je     802087 <vprintfmt+0x2d9>
+  8020bb:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8020be:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8020c3:	80 fa 5e             	cmp    $0x5e,%dl
+  8020c6:	77 c2                	ja     80208a <vprintfmt+0x2dc>
+  8020c8:	eb bd                	jmp    802087 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8020ca:	40 84 f6             	test   %sil,%sil
+  8020cd:	75 26                	jne    8020f5 <vprintfmt+0x347>
+    switch (lflag) {
+  8020cf:	85 d2                	test   %edx,%edx
+  8020d1:	74 59                	je     80212c <vprintfmt+0x37e>
+  8020d3:	83 fa 01             	cmp    $0x1,%edx
+  8020d6:	74 7b                	je     802153 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8020d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020db:	83 f8 2f             	cmp    $0x2f,%eax
+  8020de:	0f 87 96 00 00 00    	ja     80217a <vprintfmt+0x3cc>
+  8020e4:	89 c2                	mov    %eax,%edx
+  8020e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020ea:	83 c0 08             	add    $0x8,%eax
+  8020ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020f0:	4c 8b 22             	mov    (%rdx),%r12
+  8020f3:	eb 17                	jmp    80210c <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8020f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8020fb:	77 21                	ja     80211e <vprintfmt+0x370>
+  8020fd:	89 c2                	mov    %eax,%edx
+  8020ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802103:	83 c0 08             	add    $0x8,%eax
+  802106:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802109:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80210c:	4d 85 e4             	test   %r12,%r12
+  80210f:	78 7a                	js     80218b <vprintfmt+0x3dd>
+            num = i;
+  802111:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802114:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802119:	e9 50 02 00 00       	jmp    80236e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80211e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802122:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802126:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80212a:	eb dd                	jmp    802109 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80212c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80212f:	83 f8 2f             	cmp    $0x2f,%eax
+  802132:	77 11                	ja     802145 <vprintfmt+0x397>
+  802134:	89 c2                	mov    %eax,%edx
+  802136:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80213a:	83 c0 08             	add    $0x8,%eax
+  80213d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802140:	4c 63 22             	movslq (%rdx),%r12
+  802143:	eb c7                	jmp    80210c <vprintfmt+0x35e>
+  802145:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802149:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80214d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802151:	eb ed                	jmp    802140 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802153:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802156:	83 f8 2f             	cmp    $0x2f,%eax
+  802159:	77 11                	ja     80216c <vprintfmt+0x3be>
+  80215b:	89 c2                	mov    %eax,%edx
+  80215d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802161:	83 c0 08             	add    $0x8,%eax
+  802164:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802167:	4c 8b 22             	mov    (%rdx),%r12
+  80216a:	eb a0                	jmp    80210c <vprintfmt+0x35e>
+  80216c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802170:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802174:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802178:	eb ed                	jmp    802167 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80217a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80217e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802182:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802186:	e9 65 ff ff ff       	jmp    8020f0 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80218b:	4c 89 ee             	mov    %r13,%rsi
+  80218e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802193:	41 ff d6             	call   *%r14
+                i = -i;
+  802196:	49 f7 dc             	neg    %r12
+  802199:	e9 73 ff ff ff       	jmp    802111 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80219e:	40 84 f6             	test   %sil,%sil
+  8021a1:	75 32                	jne    8021d5 <vprintfmt+0x427>
+    switch (lflag) {
+  8021a3:	85 d2                	test   %edx,%edx
+  8021a5:	74 5d                	je     802204 <vprintfmt+0x456>
+  8021a7:	83 fa 01             	cmp    $0x1,%edx
+  8021aa:	0f 84 82 00 00 00    	je     802232 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8021b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8021b6:	0f 87 a5 00 00 00    	ja     802261 <vprintfmt+0x4b3>
+  8021bc:	89 c2                	mov    %eax,%edx
+  8021be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021c2:	83 c0 08             	add    $0x8,%eax
+  8021c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021c8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021cb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8021d0:	e9 99 01 00 00       	jmp    80236e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8021d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8021db:	77 19                	ja     8021f6 <vprintfmt+0x448>
+  8021dd:	89 c2                	mov    %eax,%edx
+  8021df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021e3:	83 c0 08             	add    $0x8,%eax
+  8021e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021e9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021ec:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8021f1:	e9 78 01 00 00       	jmp    80236e <vprintfmt+0x5c0>
+  8021f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802202:	eb e5                	jmp    8021e9 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802204:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802207:	83 f8 2f             	cmp    $0x2f,%eax
+  80220a:	77 18                	ja     802224 <vprintfmt+0x476>
+  80220c:	89 c2                	mov    %eax,%edx
+  80220e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802212:	83 c0 08             	add    $0x8,%eax
+  802215:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802218:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80221a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80221f:	e9 4a 01 00 00       	jmp    80236e <vprintfmt+0x5c0>
+  802224:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802228:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80222c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802230:	eb e6                	jmp    802218 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802232:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802235:	83 f8 2f             	cmp    $0x2f,%eax
+  802238:	77 19                	ja     802253 <vprintfmt+0x4a5>
+  80223a:	89 c2                	mov    %eax,%edx
+  80223c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802240:	83 c0 08             	add    $0x8,%eax
+  802243:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802246:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802249:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80224e:	e9 1b 01 00 00       	jmp    80236e <vprintfmt+0x5c0>
+  802253:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802257:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80225b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80225f:	eb e5                	jmp    802246 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802261:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802265:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802269:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80226d:	e9 56 ff ff ff       	jmp    8021c8 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802272:	40 84 f6             	test   %sil,%sil
+  802275:	75 2e                	jne    8022a5 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802277:	85 d2                	test   %edx,%edx
+  802279:	74 59                	je     8022d4 <vprintfmt+0x526>
+  80227b:	83 fa 01             	cmp    $0x1,%edx
+  80227e:	74 7f                	je     8022ff <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802280:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802283:	83 f8 2f             	cmp    $0x2f,%eax
+  802286:	0f 87 9f 00 00 00    	ja     80232b <vprintfmt+0x57d>
+  80228c:	89 c2                	mov    %eax,%edx
+  80228e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802292:	83 c0 08             	add    $0x8,%eax
+  802295:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802298:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80229b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8022a0:	e9 c9 00 00 00       	jmp    80236e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8022a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8022ab:	77 19                	ja     8022c6 <vprintfmt+0x518>
+  8022ad:	89 c2                	mov    %eax,%edx
+  8022af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022b3:	83 c0 08             	add    $0x8,%eax
+  8022b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022b9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8022bc:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022c1:	e9 a8 00 00 00       	jmp    80236e <vprintfmt+0x5c0>
+  8022c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022d2:	eb e5                	jmp    8022b9 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8022d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8022da:	77 15                	ja     8022f1 <vprintfmt+0x543>
+  8022dc:	89 c2                	mov    %eax,%edx
+  8022de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022e2:	83 c0 08             	add    $0x8,%eax
+  8022e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022e8:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8022ea:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8022ef:	eb 7d                	jmp    80236e <vprintfmt+0x5c0>
+  8022f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022fd:	eb e9                	jmp    8022e8 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8022ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802302:	83 f8 2f             	cmp    $0x2f,%eax
+  802305:	77 16                	ja     80231d <vprintfmt+0x56f>
+  802307:	89 c2                	mov    %eax,%edx
+  802309:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80230d:	83 c0 08             	add    $0x8,%eax
+  802310:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802313:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802316:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80231b:	eb 51                	jmp    80236e <vprintfmt+0x5c0>
+  80231d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802321:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802325:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802329:	eb e8                	jmp    802313 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80232b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80232f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802333:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802337:	e9 5c ff ff ff       	jmp    802298 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80233c:	4c 89 ee             	mov    %r13,%rsi
+  80233f:	bf 30 00 00 00       	mov    $0x30,%edi
+  802344:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802347:	4c 89 ee             	mov    %r13,%rsi
+  80234a:	bf 78 00 00 00       	mov    $0x78,%edi
+  80234f:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802352:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802355:	83 f8 2f             	cmp    $0x2f,%eax
+  802358:	77 47                	ja     8023a1 <vprintfmt+0x5f3>
+  80235a:	89 c2                	mov    %eax,%edx
+  80235c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802360:	83 c0 08             	add    $0x8,%eax
+  802363:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802366:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802369:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80236e:	48 83 ec 08          	sub    $0x8,%rsp
+  802372:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802376:	0f 94 c0             	sete   %al
+  802379:	0f b6 c0             	movzbl %al,%eax
+  80237c:	50                   	push   %rax
+  80237d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802382:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802386:	4c 89 ee             	mov    %r13,%rsi
+  802389:	4c 89 f7             	mov    %r14,%rdi
+  80238c:	48 b8 a3 1c 80 00 00 	movabs $0x801ca3,%rax
+  802393:	00 00 00 
+  802396:	ff d0                	call   *%rax
+            break;
+  802398:	48 83 c4 10          	add    $0x10,%rsp
+  80239c:	e9 3e fa ff ff       	jmp    801ddf <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8023a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023ad:	eb b7                	jmp    802366 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8023af:	40 84 f6             	test   %sil,%sil
+  8023b2:	75 2b                	jne    8023df <vprintfmt+0x631>
+    switch (lflag) {
+  8023b4:	85 d2                	test   %edx,%edx
+  8023b6:	74 56                	je     80240e <vprintfmt+0x660>
+  8023b8:	83 fa 01             	cmp    $0x1,%edx
+  8023bb:	74 7f                	je     80243c <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8023bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8023c3:	0f 87 a2 00 00 00    	ja     80246b <vprintfmt+0x6bd>
+  8023c9:	89 c2                	mov    %eax,%edx
+  8023cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023cf:	83 c0 08             	add    $0x8,%eax
+  8023d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023d5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023d8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023dd:	eb 8f                	jmp    80236e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8023e5:	77 19                	ja     802400 <vprintfmt+0x652>
+  8023e7:	89 c2                	mov    %eax,%edx
+  8023e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023ed:	83 c0 08             	add    $0x8,%eax
+  8023f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023f3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023fb:	e9 6e ff ff ff       	jmp    80236e <vprintfmt+0x5c0>
+  802400:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802404:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802408:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80240c:	eb e5                	jmp    8023f3 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80240e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802411:	83 f8 2f             	cmp    $0x2f,%eax
+  802414:	77 18                	ja     80242e <vprintfmt+0x680>
+  802416:	89 c2                	mov    %eax,%edx
+  802418:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80241c:	83 c0 08             	add    $0x8,%eax
+  80241f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802422:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802424:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802429:	e9 40 ff ff ff       	jmp    80236e <vprintfmt+0x5c0>
+  80242e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802432:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802436:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80243a:	eb e6                	jmp    802422 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80243c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80243f:	83 f8 2f             	cmp    $0x2f,%eax
+  802442:	77 19                	ja     80245d <vprintfmt+0x6af>
+  802444:	89 c2                	mov    %eax,%edx
+  802446:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80244a:	83 c0 08             	add    $0x8,%eax
+  80244d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802450:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802453:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802458:	e9 11 ff ff ff       	jmp    80236e <vprintfmt+0x5c0>
+  80245d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802461:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802465:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802469:	eb e5                	jmp    802450 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80246b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80246f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802473:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802477:	e9 59 ff ff ff       	jmp    8023d5 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80247c:	4c 89 ee             	mov    %r13,%rsi
+  80247f:	bf 25 00 00 00       	mov    $0x25,%edi
+  802484:	41 ff d6             	call   *%r14
+            break;
+  802487:	e9 53 f9 ff ff       	jmp    801ddf <vprintfmt+0x31>
+            putch('%', put_arg);
+  80248c:	4c 89 ee             	mov    %r13,%rsi
+  80248f:	bf 25 00 00 00       	mov    $0x25,%edi
+  802494:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802497:	48 83 eb 01          	sub    $0x1,%rbx
+  80249b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80249f:	75 f6                	jne    802497 <vprintfmt+0x6e9>
+  8024a1:	e9 39 f9 ff ff       	jmp    801ddf <vprintfmt+0x31>
+}
+  8024a6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8024aa:	5b                   	pop    %rbx
+  8024ab:	41 5c                	pop    %r12
+  8024ad:	41 5d                	pop    %r13
+  8024af:	41 5e                	pop    %r14
+  8024b1:	41 5f                	pop    %r15
+  8024b3:	5d                   	pop    %rbp
+  8024b4:	c3                   	ret
+
+00000000008024b5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8024b5:	55                   	push   %rbp
+  8024b6:	48 89 e5             	mov    %rsp,%rbp
+  8024b9:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8024bd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8024c1:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8024c6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8024ca:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8024d1:	48 85 ff             	test   %rdi,%rdi
+  8024d4:	74 2b                	je     802501 <vsnprintf+0x4c>
+  8024d6:	48 85 f6             	test   %rsi,%rsi
+  8024d9:	74 26                	je     802501 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8024db:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024df:	48 bf 59 1d 80 00 00 	movabs $0x801d59,%rdi
+  8024e6:	00 00 00 
+  8024e9:	48 b8 ae 1d 80 00 00 	movabs $0x801dae,%rax
+  8024f0:	00 00 00 
+  8024f3:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8024f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024f9:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8024fc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8024ff:	c9                   	leave
+  802500:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802501:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802506:	eb f7                	jmp    8024ff <vsnprintf+0x4a>
+
+0000000000802508 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802508:	55                   	push   %rbp
+  802509:	48 89 e5             	mov    %rsp,%rbp
+  80250c:	48 83 ec 50          	sub    $0x50,%rsp
+  802510:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802514:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802518:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80251c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802523:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802527:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80252b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80252f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802533:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802537:	48 b8 b5 24 80 00 00 	movabs $0x8024b5,%rax
+  80253e:	00 00 00 
+  802541:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802543:	c9                   	leave
+  802544:	c3                   	ret
+
+0000000000802545 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802545:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802548:	74 10                	je     80255a <strlen+0x15>
+    size_t n = 0;
+  80254a:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80254f:	48 83 c0 01          	add    $0x1,%rax
+  802553:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802557:	75 f6                	jne    80254f <strlen+0xa>
+  802559:	c3                   	ret
+    size_t n = 0;
+  80255a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80255f:	c3                   	ret
+
+0000000000802560 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802560:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802563:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802568:	48 85 f6             	test   %rsi,%rsi
+  80256b:	74 11                	je     80257e <strnlen+0x1e>
+  80256d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802571:	74 0c                	je     80257f <strnlen+0x1f>
+  802573:	48 83 c2 01          	add    $0x1,%rdx
+  802577:	48 39 d0             	cmp    %rdx,%rax
+  80257a:	75 f1                	jne    80256d <strnlen+0xd>
+  80257c:	eb 04                	jmp    802582 <strnlen+0x22>
+  80257e:	c3                   	ret
+  80257f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802582:	c3                   	ret
+
+0000000000802583 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802583:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802586:	ba 00 00 00 00       	mov    $0x0,%edx
+  80258b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80258f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802592:	48 83 c2 01          	add    $0x1,%rdx
+  802596:	84 c9                	test   %cl,%cl
+  802598:	75 f1                	jne    80258b <strcpy+0x8>
+        ;
+    return res;
+}
+  80259a:	c3                   	ret
+
+000000000080259b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80259b:	55                   	push   %rbp
+  80259c:	48 89 e5             	mov    %rsp,%rbp
+  80259f:	41 54                	push   %r12
+  8025a1:	53                   	push   %rbx
+  8025a2:	48 89 fb             	mov    %rdi,%rbx
+  8025a5:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8025a8:	48 b8 45 25 80 00 00 	movabs $0x802545,%rax
+  8025af:	00 00 00 
+  8025b2:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8025b4:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8025b8:	4c 89 e6             	mov    %r12,%rsi
+  8025bb:	48 b8 83 25 80 00 00 	movabs $0x802583,%rax
+  8025c2:	00 00 00 
+  8025c5:	ff d0                	call   *%rax
+    return dst;
+}
+  8025c7:	48 89 d8             	mov    %rbx,%rax
+  8025ca:	5b                   	pop    %rbx
+  8025cb:	41 5c                	pop    %r12
+  8025cd:	5d                   	pop    %rbp
+  8025ce:	c3                   	ret
+
+00000000008025cf <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8025cf:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8025d2:	48 85 d2             	test   %rdx,%rdx
+  8025d5:	74 1f                	je     8025f6 <strncpy+0x27>
+  8025d7:	48 01 fa             	add    %rdi,%rdx
+  8025da:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8025dd:	48 83 c1 01          	add    $0x1,%rcx
+  8025e1:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8025e5:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8025e9:	41 80 f8 01          	cmp    $0x1,%r8b
+  8025ed:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8025f1:	48 39 ca             	cmp    %rcx,%rdx
+  8025f4:	75 e7                	jne    8025dd <strncpy+0xe>
+    }
+    return ret;
+}
+  8025f6:	c3                   	ret
+
+00000000008025f7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8025f7:	48 89 f8             	mov    %rdi,%rax
+  8025fa:	48 85 d2             	test   %rdx,%rdx
+  8025fd:	74 24                	je     802623 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8025ff:	48 83 ea 01          	sub    $0x1,%rdx
+  802603:	74 1b                	je     802620 <strlcpy+0x29>
+  802605:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802609:	0f b6 16             	movzbl (%rsi),%edx
+  80260c:	84 d2                	test   %dl,%dl
+  80260e:	74 10                	je     802620 <strlcpy+0x29>
+            *dst++ = *src++;
+  802610:	48 83 c6 01          	add    $0x1,%rsi
+  802614:	48 83 c0 01          	add    $0x1,%rax
+  802618:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80261b:	48 39 c8             	cmp    %rcx,%rax
+  80261e:	75 e9                	jne    802609 <strlcpy+0x12>
+        *dst = '\0';
+  802620:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802623:	48 29 f8             	sub    %rdi,%rax
+}
+  802626:	c3                   	ret
+
+0000000000802627 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802627:	0f b6 07             	movzbl (%rdi),%eax
+  80262a:	84 c0                	test   %al,%al
+  80262c:	74 13                	je     802641 <strcmp+0x1a>
+  80262e:	38 06                	cmp    %al,(%rsi)
+  802630:	75 0f                	jne    802641 <strcmp+0x1a>
+  802632:	48 83 c7 01          	add    $0x1,%rdi
+  802636:	48 83 c6 01          	add    $0x1,%rsi
+  80263a:	0f b6 07             	movzbl (%rdi),%eax
+  80263d:	84 c0                	test   %al,%al
+  80263f:	75 ed                	jne    80262e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802641:	0f b6 c0             	movzbl %al,%eax
+  802644:	0f b6 16             	movzbl (%rsi),%edx
+  802647:	29 d0                	sub    %edx,%eax
+}
+  802649:	c3                   	ret
+
+000000000080264a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80264a:	48 85 d2             	test   %rdx,%rdx
+  80264d:	74 1f                	je     80266e <strncmp+0x24>
+  80264f:	0f b6 07             	movzbl (%rdi),%eax
+  802652:	84 c0                	test   %al,%al
+  802654:	74 1e                	je     802674 <strncmp+0x2a>
+  802656:	3a 06                	cmp    (%rsi),%al
+  802658:	75 1a                	jne    802674 <strncmp+0x2a>
+  80265a:	48 83 c7 01          	add    $0x1,%rdi
+  80265e:	48 83 c6 01          	add    $0x1,%rsi
+  802662:	48 83 ea 01          	sub    $0x1,%rdx
+  802666:	75 e7                	jne    80264f <strncmp+0x5>
+
+    if (!n) return 0;
+  802668:	b8 00 00 00 00       	mov    $0x0,%eax
+  80266d:	c3                   	ret
+  80266e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802673:	c3                   	ret
+  802674:	48 85 d2             	test   %rdx,%rdx
+  802677:	74 09                	je     802682 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802679:	0f b6 07             	movzbl (%rdi),%eax
+  80267c:	0f b6 16             	movzbl (%rsi),%edx
+  80267f:	29 d0                	sub    %edx,%eax
+  802681:	c3                   	ret
+    if (!n) return 0;
+  802682:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802687:	c3                   	ret
+
+0000000000802688 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802688:	0f b6 17             	movzbl (%rdi),%edx
+  80268b:	84 d2                	test   %dl,%dl
+  80268d:	74 18                	je     8026a7 <strchr+0x1f>
+        if (*str == c) {
+  80268f:	0f be d2             	movsbl %dl,%edx
+  802692:	39 f2                	cmp    %esi,%edx
+  802694:	74 17                	je     8026ad <strchr+0x25>
+    for (; *str; str++) {
+  802696:	48 83 c7 01          	add    $0x1,%rdi
+  80269a:	0f b6 17             	movzbl (%rdi),%edx
+  80269d:	84 d2                	test   %dl,%dl
+  80269f:	75 ee                	jne    80268f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8026a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a6:	c3                   	ret
+  8026a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ac:	c3                   	ret
+  8026ad:	48 89 f8             	mov    %rdi,%rax
+}
+  8026b0:	c3                   	ret
+
+00000000008026b1 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8026b1:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8026b4:	0f b6 17             	movzbl (%rdi),%edx
+  8026b7:	84 d2                	test   %dl,%dl
+  8026b9:	74 13                	je     8026ce <strfind+0x1d>
+  8026bb:	0f be d2             	movsbl %dl,%edx
+  8026be:	39 f2                	cmp    %esi,%edx
+  8026c0:	74 0b                	je     8026cd <strfind+0x1c>
+  8026c2:	48 83 c0 01          	add    $0x1,%rax
+  8026c6:	0f b6 10             	movzbl (%rax),%edx
+  8026c9:	84 d2                	test   %dl,%dl
+  8026cb:	75 ee                	jne    8026bb <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8026cd:	c3                   	ret
+  8026ce:	c3                   	ret
+
+00000000008026cf <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8026cf:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8026d2:	48 89 f8             	mov    %rdi,%rax
+  8026d5:	48 f7 d8             	neg    %rax
+  8026d8:	83 e0 07             	and    $0x7,%eax
+  8026db:	49 89 d1             	mov    %rdx,%r9
+  8026de:	49 29 c1             	sub    %rax,%r9
+  8026e1:	78 36                	js     802719 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8026e3:	40 0f b6 c6          	movzbl %sil,%eax
+  8026e7:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8026ee:	01 01 01 
+  8026f1:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8026f5:	40 f6 c7 07          	test   $0x7,%dil
+  8026f9:	75 38                	jne    802733 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8026fb:	4c 89 c9             	mov    %r9,%rcx
+  8026fe:	48 c1 f9 03          	sar    $0x3,%rcx
+  802702:	74 0c                	je     802710 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802704:	fc                   	cld
+  802705:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802708:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80270c:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802710:	4d 85 c9             	test   %r9,%r9
+  802713:	75 45                	jne    80275a <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802715:	4c 89 c0             	mov    %r8,%rax
+  802718:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802719:	48 85 d2             	test   %rdx,%rdx
+  80271c:	74 f7                	je     802715 <memset+0x46>
+  80271e:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802721:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802724:	48 83 c0 01          	add    $0x1,%rax
+  802728:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80272c:	48 39 c2             	cmp    %rax,%rdx
+  80272f:	75 f3                	jne    802724 <memset+0x55>
+  802731:	eb e2                	jmp    802715 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802733:	40 f6 c7 01          	test   $0x1,%dil
+  802737:	74 06                	je     80273f <memset+0x70>
+  802739:	88 07                	mov    %al,(%rdi)
+  80273b:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80273f:	40 f6 c7 02          	test   $0x2,%dil
+  802743:	74 07                	je     80274c <memset+0x7d>
+  802745:	66 89 07             	mov    %ax,(%rdi)
+  802748:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80274c:	40 f6 c7 04          	test   $0x4,%dil
+  802750:	74 a9                	je     8026fb <memset+0x2c>
+  802752:	89 07                	mov    %eax,(%rdi)
+  802754:	48 83 c7 04          	add    $0x4,%rdi
+  802758:	eb a1                	jmp    8026fb <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80275a:	41 f6 c1 04          	test   $0x4,%r9b
+  80275e:	74 06                	je     802766 <memset+0x97>
+  802760:	89 07                	mov    %eax,(%rdi)
+  802762:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802766:	41 f6 c1 02          	test   $0x2,%r9b
+  80276a:	74 07                	je     802773 <memset+0xa4>
+  80276c:	66 89 07             	mov    %ax,(%rdi)
+  80276f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802773:	41 f6 c1 01          	test   $0x1,%r9b
+  802777:	74 9c                	je     802715 <memset+0x46>
+  802779:	88 07                	mov    %al,(%rdi)
+  80277b:	eb 98                	jmp    802715 <memset+0x46>
+
+000000000080277d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80277d:	48 89 f8             	mov    %rdi,%rax
+  802780:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802783:	48 39 fe             	cmp    %rdi,%rsi
+  802786:	73 3b                	jae    8027c3 <memmove+0x46>
+  802788:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80278c:	48 39 d7             	cmp    %rdx,%rdi
+  80278f:	73 32                	jae    8027c3 <memmove+0x46>
+        s += n;
+        d += n;
+  802791:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802795:	48 89 d6             	mov    %rdx,%rsi
+  802798:	48 09 fe             	or     %rdi,%rsi
+  80279b:	48 09 ce             	or     %rcx,%rsi
+  80279e:	40 f6 c6 07          	test   $0x7,%sil
+  8027a2:	75 12                	jne    8027b6 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8027a4:	48 83 ef 08          	sub    $0x8,%rdi
+  8027a8:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8027ac:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027b0:	fd                   	std
+  8027b1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8027b4:	fc                   	cld
+  8027b5:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8027b6:	48 83 ef 01          	sub    $0x1,%rdi
+  8027ba:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8027be:	fd                   	std
+  8027bf:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8027c1:	eb f1                	jmp    8027b4 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8027c3:	48 89 f2             	mov    %rsi,%rdx
+  8027c6:	48 09 c2             	or     %rax,%rdx
+  8027c9:	48 09 ca             	or     %rcx,%rdx
+  8027cc:	f6 c2 07             	test   $0x7,%dl
+  8027cf:	75 0c                	jne    8027dd <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8027d1:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027d5:	48 89 c7             	mov    %rax,%rdi
+  8027d8:	fc                   	cld
+  8027d9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8027dc:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8027dd:	48 89 c7             	mov    %rax,%rdi
+  8027e0:	fc                   	cld
+  8027e1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8027e3:	c3                   	ret
+
+00000000008027e4 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8027e4:	55                   	push   %rbp
+  8027e5:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8027e8:	48 b8 7d 27 80 00 00 	movabs $0x80277d,%rax
+  8027ef:	00 00 00 
+  8027f2:	ff d0                	call   *%rax
+}
+  8027f4:	5d                   	pop    %rbp
+  8027f5:	c3                   	ret
+
+00000000008027f6 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8027f6:	55                   	push   %rbp
+  8027f7:	48 89 e5             	mov    %rsp,%rbp
+  8027fa:	41 57                	push   %r15
+  8027fc:	41 56                	push   %r14
+  8027fe:	41 55                	push   %r13
+  802800:	41 54                	push   %r12
+  802802:	53                   	push   %rbx
+  802803:	48 83 ec 08          	sub    $0x8,%rsp
+  802807:	49 89 fe             	mov    %rdi,%r14
+  80280a:	49 89 f7             	mov    %rsi,%r15
+  80280d:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802810:	48 89 f7             	mov    %rsi,%rdi
+  802813:	48 b8 45 25 80 00 00 	movabs $0x802545,%rax
+  80281a:	00 00 00 
+  80281d:	ff d0                	call   *%rax
+  80281f:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802822:	48 89 de             	mov    %rbx,%rsi
+  802825:	4c 89 f7             	mov    %r14,%rdi
+  802828:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  80282f:	00 00 00 
+  802832:	ff d0                	call   *%rax
+  802834:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802837:	48 39 c3             	cmp    %rax,%rbx
+  80283a:	74 36                	je     802872 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80283c:	48 89 d8             	mov    %rbx,%rax
+  80283f:	4c 29 e8             	sub    %r13,%rax
+  802842:	49 39 c4             	cmp    %rax,%r12
+  802845:	73 31                	jae    802878 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802847:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80284c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802850:	4c 89 fe             	mov    %r15,%rsi
+  802853:	48 b8 e4 27 80 00 00 	movabs $0x8027e4,%rax
+  80285a:	00 00 00 
+  80285d:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80285f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802863:	48 83 c4 08          	add    $0x8,%rsp
+  802867:	5b                   	pop    %rbx
+  802868:	41 5c                	pop    %r12
+  80286a:	41 5d                	pop    %r13
+  80286c:	41 5e                	pop    %r14
+  80286e:	41 5f                	pop    %r15
+  802870:	5d                   	pop    %rbp
+  802871:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802872:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802876:	eb eb                	jmp    802863 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802878:	48 83 eb 01          	sub    $0x1,%rbx
+  80287c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802880:	48 89 da             	mov    %rbx,%rdx
+  802883:	4c 89 fe             	mov    %r15,%rsi
+  802886:	48 b8 e4 27 80 00 00 	movabs $0x8027e4,%rax
+  80288d:	00 00 00 
+  802890:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802892:	49 01 de             	add    %rbx,%r14
+  802895:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80289a:	eb c3                	jmp    80285f <strlcat+0x69>
+
+000000000080289c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80289c:	48 85 d2             	test   %rdx,%rdx
+  80289f:	74 2d                	je     8028ce <memcmp+0x32>
+  8028a1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8028a6:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8028aa:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8028af:	44 38 c1             	cmp    %r8b,%cl
+  8028b2:	75 0f                	jne    8028c3 <memcmp+0x27>
+    while (n-- > 0) {
+  8028b4:	48 83 c0 01          	add    $0x1,%rax
+  8028b8:	48 39 c2             	cmp    %rax,%rdx
+  8028bb:	75 e9                	jne    8028a6 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8028bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c2:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8028c3:	0f b6 c1             	movzbl %cl,%eax
+  8028c6:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8028ca:	44 29 c0             	sub    %r8d,%eax
+  8028cd:	c3                   	ret
+    return 0;
+  8028ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028d3:	c3                   	ret
+
+00000000008028d4 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8028d4:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8028d8:	48 39 c7             	cmp    %rax,%rdi
+  8028db:	73 0f                	jae    8028ec <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8028dd:	40 38 37             	cmp    %sil,(%rdi)
+  8028e0:	74 0e                	je     8028f0 <memfind+0x1c>
+    for (; src < end; src++) {
+  8028e2:	48 83 c7 01          	add    $0x1,%rdi
+  8028e6:	48 39 f8             	cmp    %rdi,%rax
+  8028e9:	75 f2                	jne    8028dd <memfind+0x9>
+  8028eb:	c3                   	ret
+  8028ec:	48 89 f8             	mov    %rdi,%rax
+  8028ef:	c3                   	ret
+  8028f0:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8028f3:	c3                   	ret
+
+00000000008028f4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8028f4:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8028f7:	0f b6 37             	movzbl (%rdi),%esi
+  8028fa:	40 80 fe 20          	cmp    $0x20,%sil
+  8028fe:	74 06                	je     802906 <strtol+0x12>
+  802900:	40 80 fe 09          	cmp    $0x9,%sil
+  802904:	75 13                	jne    802919 <strtol+0x25>
+  802906:	48 83 c7 01          	add    $0x1,%rdi
+  80290a:	0f b6 37             	movzbl (%rdi),%esi
+  80290d:	40 80 fe 20          	cmp    $0x20,%sil
+  802911:	74 f3                	je     802906 <strtol+0x12>
+  802913:	40 80 fe 09          	cmp    $0x9,%sil
+  802917:	74 ed                	je     802906 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802919:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80291c:	83 e0 fd             	and    $0xfffffffd,%eax
+  80291f:	3c 01                	cmp    $0x1,%al
+  802921:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802925:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80292b:	75 0f                	jne    80293c <strtol+0x48>
+  80292d:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802930:	74 14                	je     802946 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802932:	85 d2                	test   %edx,%edx
+  802934:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802939:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80293c:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802941:	4c 63 ca             	movslq %edx,%r9
+  802944:	eb 36                	jmp    80297c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802946:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80294a:	74 0f                	je     80295b <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80294c:	85 d2                	test   %edx,%edx
+  80294e:	75 ec                	jne    80293c <strtol+0x48>
+        s++;
+  802950:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802954:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802959:	eb e1                	jmp    80293c <strtol+0x48>
+        s += 2;
+  80295b:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80295f:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802964:	eb d6                	jmp    80293c <strtol+0x48>
+            dig -= '0';
+  802966:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802969:	44 0f b6 c1          	movzbl %cl,%r8d
+  80296d:	41 39 d0             	cmp    %edx,%r8d
+  802970:	7d 21                	jge    802993 <strtol+0x9f>
+        val = val * base + dig;
+  802972:	49 0f af c1          	imul   %r9,%rax
+  802976:	0f b6 c9             	movzbl %cl,%ecx
+  802979:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80297c:	48 83 c7 01          	add    $0x1,%rdi
+  802980:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802984:	80 f9 39             	cmp    $0x39,%cl
+  802987:	76 dd                	jbe    802966 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802989:	80 f9 7b             	cmp    $0x7b,%cl
+  80298c:	77 05                	ja     802993 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80298e:	83 e9 57             	sub    $0x57,%ecx
+  802991:	eb d6                	jmp    802969 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802993:	4d 85 d2             	test   %r10,%r10
+  802996:	74 03                	je     80299b <strtol+0xa7>
+  802998:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80299b:	48 89 c2             	mov    %rax,%rdx
+  80299e:	48 f7 da             	neg    %rdx
+  8029a1:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8029a5:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8029a9:	c3                   	ret
+
+00000000008029aa <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8029aa:	55                   	push   %rbp
+  8029ab:	48 89 e5             	mov    %rsp,%rbp
+  8029ae:	41 54                	push   %r12
+  8029b0:	53                   	push   %rbx
+  8029b1:	48 89 fb             	mov    %rdi,%rbx
+  8029b4:	48 89 f7             	mov    %rsi,%rdi
+  8029b7:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8029ba:	48 85 f6             	test   %rsi,%rsi
+  8029bd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029c4:	00 00 00 
+  8029c7:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8029cb:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029d0:	48 b8 03 06 80 00 00 	movabs $0x800603,%rax
+  8029d7:	00 00 00 
+  8029da:	ff d0                	call   *%rax
+    if (res < 0) {
+  8029dc:	85 c0                	test   %eax,%eax
+  8029de:	78 45                	js     802a25 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8029e0:	48 85 db             	test   %rbx,%rbx
+  8029e3:	74 12                	je     8029f7 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8029e5:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029ec:	00 00 00 
+  8029ef:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8029f5:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  8029f7:	4d 85 e4             	test   %r12,%r12
+  8029fa:	74 14                	je     802a10 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  8029fc:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a03:	00 00 00 
+  802a06:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802a0c:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802a10:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a17:	00 00 00 
+  802a1a:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802a20:	5b                   	pop    %rbx
+  802a21:	41 5c                	pop    %r12
+  802a23:	5d                   	pop    %rbp
+  802a24:	c3                   	ret
+        if (from_env_store)
+  802a25:	48 85 db             	test   %rbx,%rbx
+  802a28:	74 06                	je     802a30 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802a2a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802a30:	4d 85 e4             	test   %r12,%r12
+  802a33:	74 eb                	je     802a20 <ipc_recv+0x76>
+            *perm_store = 0;
+  802a35:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802a3c:	00 
+  802a3d:	eb e1                	jmp    802a20 <ipc_recv+0x76>
+
+0000000000802a3f <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802a3f:	55                   	push   %rbp
+  802a40:	48 89 e5             	mov    %rsp,%rbp
+  802a43:	41 57                	push   %r15
+  802a45:	41 56                	push   %r14
+  802a47:	41 55                	push   %r13
+  802a49:	41 54                	push   %r12
+  802a4b:	53                   	push   %rbx
+  802a4c:	48 83 ec 18          	sub    $0x18,%rsp
+  802a50:	41 89 fd             	mov    %edi,%r13d
+  802a53:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802a56:	48 89 d3             	mov    %rdx,%rbx
+  802a59:	49 89 cc             	mov    %rcx,%r12
+  802a5c:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a60:	48 85 d2             	test   %rdx,%rdx
+  802a63:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a6a:	00 00 00 
+  802a6d:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a71:	49 be d7 05 80 00 00 	movabs $0x8005d7,%r14
+  802a78:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802a7b:	49 bf 0a 02 80 00 00 	movabs $0x80020a,%r15
+  802a82:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a85:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802a88:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802a8c:	4c 89 e1             	mov    %r12,%rcx
+  802a8f:	48 89 da             	mov    %rbx,%rdx
+  802a92:	44 89 ef             	mov    %r13d,%edi
+  802a95:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802a98:	85 c0                	test   %eax,%eax
+  802a9a:	74 34                	je     802ad0 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802a9c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802a9f:	75 05                	jne    802aa6 <ipc_send+0x67>
+        sys_yield();
+  802aa1:	41 ff d7             	call   *%r15
+    while (true) {
+  802aa4:	eb df                	jmp    802a85 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802aa6:	48 ba ef 31 80 00 00 	movabs $0x8031ef,%rdx
+  802aad:	00 00 00 
+  802ab0:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802ab5:	48 bf 08 32 80 00 00 	movabs $0x803208,%rdi
+  802abc:	00 00 00 
+  802abf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac4:	48 b9 0e 1b 80 00 00 	movabs $0x801b0e,%rcx
+  802acb:	00 00 00 
+  802ace:	ff d1                	call   *%rcx
+    }
+}
+  802ad0:	48 83 c4 18          	add    $0x18,%rsp
+  802ad4:	5b                   	pop    %rbx
+  802ad5:	41 5c                	pop    %r12
+  802ad7:	41 5d                	pop    %r13
+  802ad9:	41 5e                	pop    %r14
+  802adb:	41 5f                	pop    %r15
+  802add:	5d                   	pop    %rbp
+  802ade:	c3                   	ret
+
+0000000000802adf <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802adf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802ae4:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802aeb:	00 00 00 
+  802aee:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802af5:	48 01 ca             	add    %rcx,%rdx
+  802af8:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802afe:	39 fa                	cmp    %edi,%edx
+  802b00:	74 12                	je     802b14 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802b02:	48 83 c0 01          	add    $0x1,%rax
+  802b06:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b0c:	75 e0                	jne    802aee <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802b0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b13:	c3                   	ret
+            return envs[i].env_id;
+  802b14:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802b1b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b22:	00 00 00 
+  802b25:	48 01 d0             	add    %rdx,%rax
+  802b28:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b2e:	c3                   	ret
+  802b2f:	90                   	nop
+
+0000000000802b30 <__rodata_start>:
+  802b30:	3c 75                	cmp    $0x75,%al
+  802b32:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b33:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b37:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b38:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802b3c:	1f                   	(bad)
+  802b3d:	44 00 00             	add    %r8b,(%rax)
+  802b40:	73 79                	jae    802bbb <__rodata_start+0x8b>
+  802b42:	73 63                	jae    802ba7 <__rodata_start+0x77>
+  802b44:	61                   	(bad)
+  802b45:	6c                   	insb   (%dx),%es:(%rdi)
+  802b46:	6c                   	insb   (%dx),%es:(%rdi)
+  802b47:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a08fc7 <__bss_end+0x72200fc7>
+  802b4d:	65 74 75             	gs je  802bc5 <__rodata_start+0x95>
+  802b50:	72 6e                	jb     802bc0 <__rodata_start+0x90>
+  802b52:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a08fd4 <__bss_end+0x28200fd4>
+  802b59:	28 
+  802b5a:	3e 20 30             	ds and %dh,(%rax)
+  802b5d:	29 00                	sub    %eax,(%rax)
+  802b5f:	6c                   	insb   (%dx),%es:(%rdi)
+  802b60:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802b67:	61                   	(bad)
+  802b68:	6c                   	insb   (%dx),%es:(%rdi)
+  802b69:	6c                   	insb   (%dx),%es:(%rdi)
+  802b6a:	2e 63 00             	cs movsxd (%rax),%eax
+  802b6d:	0f 1f 00             	nopl   (%rax)
+  802b70:	5b                   	pop    %rbx
+  802b71:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b76:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802b79:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b7d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b7e:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802b82:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802b89:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 8035f4 <error_string+0x4d4>
+  802b90:	5b                   	pop    %rbx
+  802b91:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b96:	20 66 74             	and    %ah,0x74(%rsi)
+  802b99:	72 75                	jb     802c10 <devtab+0x10>
+  802b9b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b9c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802b9f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4c0a <__bss_end+0x2d2ccc0a>
+  802ba6:	20 62 61             	and    %ah,0x61(%rdx)
+  802ba9:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802bad:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bb1:	5b                   	pop    %rbx
+  802bb2:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802bb7:	20 72 65             	and    %dh,0x65(%rdx)
+  802bba:	61                   	(bad)
+  802bbb:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4c26 <__bss_end+0x2d2ccc26>
+  802bc2:	20 62 61             	and    %ah,0x61(%rdx)
+  802bc5:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802bc9:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bcd:	5b                   	pop    %rbx
+  802bce:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802bd3:	20 77 72             	and    %dh,0x72(%rdi)
+  802bd6:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802bdd:	2d 
+  802bde:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802be3:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802be6:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802bf1:	00 00 00 
+  802bf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802bfb:	00 00 00 
+  802bfe:	66 90                	xchg   %ax,%ax
+
+0000000000802c00 <devtab>:
+  802c00:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802c10:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802c20:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802c30:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802c40:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802c50:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802c60:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802c70:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802c80:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802c90:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802ca0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802cb0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802cc0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802cd0:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802ce0:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802cf0:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802d00:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802d10:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802d20:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802d30:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802d40:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802d50:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802d60:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802d70:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802d80:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802d90:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802da0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802db0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802dc0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802dd0:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802de0:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802df0:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802e00:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802e10:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802e20:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802e30:	64 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     d.operation not 
+  802e40:	70 65 72 6d 69 74 74 65 64 00 66 2e 0f 1f 84 00     permitted.f.....
+  802e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
+  802e60:	4b 1e 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     K........$......
+  802e70:	7c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     |$.......$......
+  802e80:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  802e90:	8c 24 80 00 00 00 00 00 6a 1e 80 00 00 00 00 00     .$......j.......
+  802ea0:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  802eb0:	5e 1e 80 00 00 00 00 00 d8 1e 80 00 00 00 00 00     ^...............
+  802ec0:	8c 24 80 00 00 00 00 00 5e 1e 80 00 00 00 00 00     .$......^.......
+  802ed0:	a4 1e 80 00 00 00 00 00 a4 1e 80 00 00 00 00 00     ................
+  802ee0:	a4 1e 80 00 00 00 00 00 a4 1e 80 00 00 00 00 00     ................
+  802ef0:	a4 1e 80 00 00 00 00 00 a4 1e 80 00 00 00 00 00     ................
+  802f00:	a4 1e 80 00 00 00 00 00 a4 1e 80 00 00 00 00 00     ................
+  802f10:	a4 1e 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .........$......
+  802f20:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  802f30:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  802f40:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  802f50:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  802f60:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  802f70:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  802f80:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  802f90:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  802fa0:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  802fb0:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  802fc0:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  802fd0:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  802fe0:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  802ff0:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  803000:	8c 24 80 00 00 00 00 00 af 23 80 00 00 00 00 00     .$.......#......
+  803010:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  803020:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  803030:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  803040:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  803050:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  803060:	fb 1e 80 00 00 00 00 00 ca 20 80 00 00 00 00 00     ......... ......
+  803070:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  803080:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  803090:	2a 1f 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     *........$......
+  8030a0:	8c 24 80 00 00 00 00 00 f0 1e 80 00 00 00 00 00     .$..............
+  8030b0:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  8030c0:	72 22 80 00 00 00 00 00 3c 23 80 00 00 00 00 00     r"......<#......
+  8030d0:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  8030e0:	c1 1f 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .........$......
+  8030f0:	9e 21 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .!.......$......
+  803100:	8c 24 80 00 00 00 00 00 af 23 80 00 00 00 00 00     .$.......#......
+  803110:	8c 24 80 00 00 00 00 00 54 1e 80 00 00 00 00 00     .$......T.......
+
+0000000000803120 <error_string>:
+	...
+  803128:	d5 2c 80 00 00 00 00 00 e7 2c 80 00 00 00 00 00     .,.......,......
+  803138:	f7 2c 80 00 00 00 00 00 09 2d 80 00 00 00 00 00     .,.......-......
+  803148:	17 2d 80 00 00 00 00 00 2b 2d 80 00 00 00 00 00     .-......+-......
+  803158:	40 2d 80 00 00 00 00 00 53 2d 80 00 00 00 00 00     @-......S-......
+  803168:	65 2d 80 00 00 00 00 00 79 2d 80 00 00 00 00 00     e-......y-......
+  803178:	89 2d 80 00 00 00 00 00 9c 2d 80 00 00 00 00 00     .-.......-......
+  803188:	b3 2d 80 00 00 00 00 00 c9 2d 80 00 00 00 00 00     .-.......-......
+  803198:	e1 2d 80 00 00 00 00 00 f9 2d 80 00 00 00 00 00     .-.......-......
+  8031a8:	06 2e 80 00 00 00 00 00 d0 31 80 00 00 00 00 00     .........1......
+  8031b8:	1a 2e 80 00 00 00 00 00 00 00 00 00 00 00 00 00     ................
+  8031c8:	32 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     2.......file is 
+  8031d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8031e8:	75 74 61 62 6c 65 00 69 70 63 5f 73 65 6e 64 3a     utable.ipc_send:
+  8031f8:	20 66 61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00      failed to send.
+  803208:	6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00     lib/ipc.c.f.....
+  803218:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803228:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803238:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803248:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803258:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803268:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803278:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803288:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803298:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8032b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803308:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803318:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803328:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803338:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803348:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803358:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803368:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803378:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803388:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803398:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803408:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803418:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803428:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803438:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803448:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803458:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803468:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803478:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803488:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803498:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803508:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803518:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803528:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803538:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803548:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803558:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803568:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803578:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803588:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803598:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803608:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803618:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803628:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803638:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803648:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803658:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803668:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803678:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803688:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803698:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803708:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803718:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803728:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803738:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803748:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803758:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803768:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803778:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803788:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803798:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803808:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803818:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803828:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803838:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803848:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803858:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803868:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803878:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803888:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803898:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803908:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803918:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803928:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803938:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803948:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803958:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803968:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803978:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803988:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803998:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803aa8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ab8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ac8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ad8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ae8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803af8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ba8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bc8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bd8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803be8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bf8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ca8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ce8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cf8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803da8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803db8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803dc8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dd8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803de8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803df8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ea8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803eb8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ec8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ed8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ee8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ef8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fa8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fb8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fc8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fd8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fe8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ff8:	00 00 66 0f 1f 44 00 00                             ..f..D..
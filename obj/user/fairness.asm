@@ -0,0 +1,5703 @@
+
+obj/user/fairness:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 dc 00 00 00       	call   8000ff <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * (user/idle is env 0). */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+  800030:	48 83 ec 10          	sub    $0x10,%rsp
+    envid_t who, id;
+
+    id = sys_getenvid();
+  800034:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  80003b:	00 00 00 
+  80003e:	ff d0                	call   *%rax
+  800040:	89 c3                	mov    %eax,%ebx
+
+    if (thisenv == &envs[1]) {
+  800042:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800049:	00 00 00 
+  80004c:	48 b8 b0 06 c0 1f 80 	movabs $0x801fc006b0,%rax
+  800053:	00 00 00 
+  800056:	48 39 02             	cmp    %rax,(%rdx)
+  800059:	74 5e                	je     8000b9 <umain+0x94>
+        while (1) {
+            ipc_recv(&who, NULL, NULL, NULL);
+            cprintf("%x recv from %x\n", id, who);
+        }
+    } else {
+        cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  80005b:	48 b8 78 07 c0 1f 80 	movabs $0x801fc00778,%rax
+  800062:	00 00 00 
+  800065:	8b 10                	mov    (%rax),%edx
+  800067:	89 de                	mov    %ebx,%esi
+  800069:	48 bf f9 2b 80 00 00 	movabs $0x802bf9,%rdi
+  800070:	00 00 00 
+  800073:	b8 00 00 00 00       	mov    $0x0,%eax
+  800078:	48 b9 76 02 80 00 00 	movabs $0x800276,%rcx
+  80007f:	00 00 00 
+  800082:	ff d1                	call   *%rcx
+        while (1)
+            ipc_send(envs[1].env_id, 0, NULL, 0, 0);
+  800084:	49 bc 00 00 c0 1f 80 	movabs $0x801fc00000,%r12
+  80008b:	00 00 00 
+  80008e:	48 bb 82 17 80 00 00 	movabs $0x801782,%rbx
+  800095:	00 00 00 
+  800098:	41 8b bc 24 78 07 00 	mov    0x778(%r12),%edi
+  80009f:	00 
+  8000a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8000b5:	ff d3                	call   *%rbx
+        while (1)
+  8000b7:	eb df                	jmp    800098 <umain+0x73>
+            ipc_recv(&who, NULL, NULL, NULL);
+  8000b9:	49 be ed 16 80 00 00 	movabs $0x8016ed,%r14
+  8000c0:	00 00 00 
+            cprintf("%x recv from %x\n", id, who);
+  8000c3:	49 bd e8 2b 80 00 00 	movabs $0x802be8,%r13
+  8000ca:	00 00 00 
+  8000cd:	49 bc 76 02 80 00 00 	movabs $0x800276,%r12
+  8000d4:	00 00 00 
+            ipc_recv(&who, NULL, NULL, NULL);
+  8000d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e6:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8000ea:	41 ff d6             	call   *%r14
+            cprintf("%x recv from %x\n", id, who);
+  8000ed:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8000f0:	89 de                	mov    %ebx,%esi
+  8000f2:	4c 89 ef             	mov    %r13,%rdi
+  8000f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fa:	41 ff d4             	call   *%r12
+        while (1) {
+  8000fd:	eb d8                	jmp    8000d7 <umain+0xb2>
+
+00000000008000ff <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000ff:	55                   	push   %rbp
+  800100:	48 89 e5             	mov    %rsp,%rbp
+  800103:	41 56                	push   %r14
+  800105:	41 55                	push   %r13
+  800107:	41 54                	push   %r12
+  800109:	53                   	push   %rbx
+  80010a:	41 89 fd             	mov    %edi,%r13d
+  80010d:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800110:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800117:	00 00 00 
+  80011a:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800121:	00 00 00 
+  800124:	48 39 c2             	cmp    %rax,%rdx
+  800127:	73 17                	jae    800140 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800129:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80012c:	49 89 c4             	mov    %rax,%r12
+  80012f:	48 83 c3 08          	add    $0x8,%rbx
+  800133:	b8 00 00 00 00       	mov    $0x0,%eax
+  800138:	ff 53 f8             	call   *-0x8(%rbx)
+  80013b:	4c 39 e3             	cmp    %r12,%rbx
+  80013e:	72 ef                	jb     80012f <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800140:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  800147:	00 00 00 
+  80014a:	ff d0                	call   *%rax
+  80014c:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  80014f:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800156:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80015d:	00 00 00 
+  800160:	48 01 d0             	add    %rdx,%rax
+  800163:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80016a:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80016d:	45 85 ed             	test   %r13d,%r13d
+  800170:	7e 0d                	jle    80017f <libmain+0x80>
+  800172:	49 8b 06             	mov    (%r14),%rax
+  800175:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80017c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80017f:	4c 89 f6             	mov    %r14,%rsi
+  800182:	44 89 ef             	mov    %r13d,%edi
+  800185:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80018c:	00 00 00 
+  80018f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800191:	48 b8 a6 01 80 00 00 	movabs $0x8001a6,%rax
+  800198:	00 00 00 
+  80019b:	ff d0                	call   *%rax
+#endif
+}
+  80019d:	5b                   	pop    %rbx
+  80019e:	41 5c                	pop    %r12
+  8001a0:	41 5d                	pop    %r13
+  8001a2:	41 5e                	pop    %r14
+  8001a4:	5d                   	pop    %rbp
+  8001a5:	c3                   	ret
+
+00000000008001a6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001a6:	55                   	push   %rbp
+  8001a7:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001aa:	48 b8 98 1a 80 00 00 	movabs $0x801a98,%rax
+  8001b1:	00 00 00 
+  8001b4:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001bb:	48 b8 20 10 80 00 00 	movabs $0x801020,%rax
+  8001c2:	00 00 00 
+  8001c5:	ff d0                	call   *%rax
+}
+  8001c7:	5d                   	pop    %rbp
+  8001c8:	c3                   	ret
+
+00000000008001c9 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001c9:	55                   	push   %rbp
+  8001ca:	48 89 e5             	mov    %rsp,%rbp
+  8001cd:	53                   	push   %rbx
+  8001ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8001d2:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001d5:	8b 06                	mov    (%rsi),%eax
+  8001d7:	8d 50 01             	lea    0x1(%rax),%edx
+  8001da:	89 16                	mov    %edx,(%rsi)
+  8001dc:	48 98                	cltq
+  8001de:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001e3:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001e9:	74 0a                	je     8001f5 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001eb:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f3:	c9                   	leave
+  8001f4:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001f5:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001f9:	be ff 00 00 00       	mov    $0xff,%esi
+  8001fe:	48 b8 c2 0f 80 00 00 	movabs $0x800fc2,%rax
+  800205:	00 00 00 
+  800208:	ff d0                	call   *%rax
+        state->offset = 0;
+  80020a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800210:	eb d9                	jmp    8001eb <putch+0x22>
+
+0000000000800212 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800212:	55                   	push   %rbp
+  800213:	48 89 e5             	mov    %rsp,%rbp
+  800216:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80021d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800220:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800227:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80022c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800231:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800234:	48 89 f1             	mov    %rsi,%rcx
+  800237:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80023e:	48 bf c9 01 80 00 00 	movabs $0x8001c9,%rdi
+  800245:	00 00 00 
+  800248:	48 b8 c6 03 80 00 00 	movabs $0x8003c6,%rax
+  80024f:	00 00 00 
+  800252:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800254:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80025b:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800262:	48 b8 c2 0f 80 00 00 	movabs $0x800fc2,%rax
+  800269:	00 00 00 
+  80026c:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80026e:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800274:	c9                   	leave
+  800275:	c3                   	ret
+
+0000000000800276 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800276:	55                   	push   %rbp
+  800277:	48 89 e5             	mov    %rsp,%rbp
+  80027a:	48 83 ec 50          	sub    $0x50,%rsp
+  80027e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800282:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800286:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80028a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80028e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800292:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800299:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80029d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002a1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002a5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002a9:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002ad:	48 b8 12 02 80 00 00 	movabs $0x800212,%rax
+  8002b4:	00 00 00 
+  8002b7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002b9:	c9                   	leave
+  8002ba:	c3                   	ret
+
+00000000008002bb <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002bb:	55                   	push   %rbp
+  8002bc:	48 89 e5             	mov    %rsp,%rbp
+  8002bf:	41 57                	push   %r15
+  8002c1:	41 56                	push   %r14
+  8002c3:	41 55                	push   %r13
+  8002c5:	41 54                	push   %r12
+  8002c7:	53                   	push   %rbx
+  8002c8:	48 83 ec 18          	sub    $0x18,%rsp
+  8002cc:	49 89 fc             	mov    %rdi,%r12
+  8002cf:	49 89 f5             	mov    %rsi,%r13
+  8002d2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002d6:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002d9:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002dc:	41 89 cf             	mov    %ecx,%r15d
+  8002df:	4c 39 fa             	cmp    %r15,%rdx
+  8002e2:	73 5b                	jae    80033f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002e4:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002e8:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002ec:	85 db                	test   %ebx,%ebx
+  8002ee:	7e 0e                	jle    8002fe <print_num+0x43>
+            putch(padc, put_arg);
+  8002f0:	4c 89 ee             	mov    %r13,%rsi
+  8002f3:	44 89 f7             	mov    %r14d,%edi
+  8002f6:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002f9:	83 eb 01             	sub    $0x1,%ebx
+  8002fc:	75 f2                	jne    8002f0 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002fe:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800302:	48 b9 2b 2c 80 00 00 	movabs $0x802c2b,%rcx
+  800309:	00 00 00 
+  80030c:	48 b8 1a 2c 80 00 00 	movabs $0x802c1a,%rax
+  800313:	00 00 00 
+  800316:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80031a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80031e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800323:	49 f7 f7             	div    %r15
+  800326:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80032a:	4c 89 ee             	mov    %r13,%rsi
+  80032d:	41 ff d4             	call   *%r12
+}
+  800330:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800334:	5b                   	pop    %rbx
+  800335:	41 5c                	pop    %r12
+  800337:	41 5d                	pop    %r13
+  800339:	41 5e                	pop    %r14
+  80033b:	41 5f                	pop    %r15
+  80033d:	5d                   	pop    %rbp
+  80033e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80033f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800343:	ba 00 00 00 00       	mov    $0x0,%edx
+  800348:	49 f7 f7             	div    %r15
+  80034b:	48 83 ec 08          	sub    $0x8,%rsp
+  80034f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800353:	52                   	push   %rdx
+  800354:	45 0f be c9          	movsbl %r9b,%r9d
+  800358:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80035c:	48 89 c2             	mov    %rax,%rdx
+  80035f:	48 b8 bb 02 80 00 00 	movabs $0x8002bb,%rax
+  800366:	00 00 00 
+  800369:	ff d0                	call   *%rax
+  80036b:	48 83 c4 10          	add    $0x10,%rsp
+  80036f:	eb 8d                	jmp    8002fe <print_num+0x43>
+
+0000000000800371 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800371:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800375:	48 8b 06             	mov    (%rsi),%rax
+  800378:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80037c:	73 0a                	jae    800388 <sprintputch+0x17>
+        *state->start++ = ch;
+  80037e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800382:	48 89 16             	mov    %rdx,(%rsi)
+  800385:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800388:	c3                   	ret
+
+0000000000800389 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800389:	55                   	push   %rbp
+  80038a:	48 89 e5             	mov    %rsp,%rbp
+  80038d:	48 83 ec 50          	sub    $0x50,%rsp
+  800391:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800395:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800399:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80039d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003a4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003ac:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003b0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003b4:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003b8:	48 b8 c6 03 80 00 00 	movabs $0x8003c6,%rax
+  8003bf:	00 00 00 
+  8003c2:	ff d0                	call   *%rax
+}
+  8003c4:	c9                   	leave
+  8003c5:	c3                   	ret
+
+00000000008003c6 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003c6:	55                   	push   %rbp
+  8003c7:	48 89 e5             	mov    %rsp,%rbp
+  8003ca:	41 57                	push   %r15
+  8003cc:	41 56                	push   %r14
+  8003ce:	41 55                	push   %r13
+  8003d0:	41 54                	push   %r12
+  8003d2:	53                   	push   %rbx
+  8003d3:	48 83 ec 38          	sub    $0x38,%rsp
+  8003d7:	49 89 fe             	mov    %rdi,%r14
+  8003da:	49 89 f5             	mov    %rsi,%r13
+  8003dd:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003e0:	48 8b 01             	mov    (%rcx),%rax
+  8003e3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003e7:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003ef:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003f3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003f7:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003fb:	0f b6 3b             	movzbl (%rbx),%edi
+  8003fe:	40 80 ff 25          	cmp    $0x25,%dil
+  800402:	74 18                	je     80041c <vprintfmt+0x56>
+            if (!ch) return;
+  800404:	40 84 ff             	test   %dil,%dil
+  800407:	0f 84 b1 06 00 00    	je     800abe <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80040d:	40 0f b6 ff          	movzbl %dil,%edi
+  800411:	4c 89 ee             	mov    %r13,%rsi
+  800414:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800417:	4c 89 e3             	mov    %r12,%rbx
+  80041a:	eb db                	jmp    8003f7 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80041c:	be 00 00 00 00       	mov    $0x0,%esi
+  800421:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800425:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80042a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800430:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800437:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80043b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800440:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800445:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800448:	83 e8 23             	sub    $0x23,%eax
+  80044b:	3c 57                	cmp    $0x57,%al
+  80044d:	0f 87 51 06 00 00    	ja     800aa4 <vprintfmt+0x6de>
+  800453:	0f b6 c0             	movzbl %al,%eax
+  800456:	48 b9 e0 2d 80 00 00 	movabs $0x802de0,%rcx
+  80045d:	00 00 00 
+  800460:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800463:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800466:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80046a:	eb cf                	jmp    80043b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80046c:	49 89 dc             	mov    %rbx,%r12
+  80046f:	be 01 00 00 00       	mov    $0x1,%esi
+  800474:	eb c5                	jmp    80043b <vprintfmt+0x75>
+            padc = ch;
+  800476:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80047a:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80047d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800480:	eb b9                	jmp    80043b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800482:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800485:	83 f8 2f             	cmp    $0x2f,%eax
+  800488:	77 24                	ja     8004ae <vprintfmt+0xe8>
+  80048a:	89 c1                	mov    %eax,%ecx
+  80048c:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800490:	83 c0 08             	add    $0x8,%eax
+  800493:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800496:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800499:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80049c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004a0:	79 99                	jns    80043b <vprintfmt+0x75>
+                width = precision;
+  8004a2:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004a6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004ac:	eb 8d                	jmp    80043b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004ae:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004b2:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004ba:	eb da                	jmp    800496 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004bc:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004c1:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004c5:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004cb:	3c 39                	cmp    $0x39,%al
+  8004cd:	77 1c                	ja     8004eb <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004cf:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004d3:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004d7:	0f b6 c0             	movzbl %al,%eax
+  8004da:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004df:	0f b6 03             	movzbl (%rbx),%eax
+  8004e2:	3c 39                	cmp    $0x39,%al
+  8004e4:	76 e9                	jbe    8004cf <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004e6:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004e9:	eb b1                	jmp    80049c <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004eb:	49 89 dc             	mov    %rbx,%r12
+  8004ee:	eb ac                	jmp    80049c <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004f0:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004f3:	85 c9                	test   %ecx,%ecx
+  8004f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fa:	0f 49 c1             	cmovns %ecx,%eax
+  8004fd:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800500:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800503:	e9 33 ff ff ff       	jmp    80043b <vprintfmt+0x75>
+            lflag++;
+  800508:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80050b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80050e:	e9 28 ff ff ff       	jmp    80043b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800513:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800516:	83 f8 2f             	cmp    $0x2f,%eax
+  800519:	77 19                	ja     800534 <vprintfmt+0x16e>
+  80051b:	89 c2                	mov    %eax,%edx
+  80051d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800521:	83 c0 08             	add    $0x8,%eax
+  800524:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800527:	8b 3a                	mov    (%rdx),%edi
+  800529:	4c 89 ee             	mov    %r13,%rsi
+  80052c:	41 ff d6             	call   *%r14
+            break;
+  80052f:	e9 c3 fe ff ff       	jmp    8003f7 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800534:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800538:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80053c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800540:	eb e5                	jmp    800527 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800542:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800545:	83 f8 2f             	cmp    $0x2f,%eax
+  800548:	77 5a                	ja     8005a4 <vprintfmt+0x1de>
+  80054a:	89 c2                	mov    %eax,%edx
+  80054c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800550:	83 c0 08             	add    $0x8,%eax
+  800553:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800556:	8b 02                	mov    (%rdx),%eax
+  800558:	89 c1                	mov    %eax,%ecx
+  80055a:	f7 d9                	neg    %ecx
+  80055c:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80055f:	83 f9 15             	cmp    $0x15,%ecx
+  800562:	7f 4e                	jg     8005b2 <vprintfmt+0x1ec>
+  800564:	48 63 c1             	movslq %ecx,%rax
+  800567:	48 ba a0 30 80 00 00 	movabs $0x8030a0,%rdx
+  80056e:	00 00 00 
+  800571:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800575:	48 85 c0             	test   %rax,%rax
+  800578:	74 38                	je     8005b2 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80057a:	48 89 c1             	mov    %rax,%rcx
+  80057d:	48 ba 79 32 80 00 00 	movabs $0x803279,%rdx
+  800584:	00 00 00 
+  800587:	4c 89 ee             	mov    %r13,%rsi
+  80058a:	4c 89 f7             	mov    %r14,%rdi
+  80058d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800592:	49 b8 89 03 80 00 00 	movabs $0x800389,%r8
+  800599:	00 00 00 
+  80059c:	41 ff d0             	call   *%r8
+  80059f:	e9 53 fe ff ff       	jmp    8003f7 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b0:	eb a4                	jmp    800556 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005b2:	48 ba 43 2c 80 00 00 	movabs $0x802c43,%rdx
+  8005b9:	00 00 00 
+  8005bc:	4c 89 ee             	mov    %r13,%rsi
+  8005bf:	4c 89 f7             	mov    %r14,%rdi
+  8005c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c7:	49 b8 89 03 80 00 00 	movabs $0x800389,%r8
+  8005ce:	00 00 00 
+  8005d1:	41 ff d0             	call   *%r8
+  8005d4:	e9 1e fe ff ff       	jmp    8003f7 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8005df:	77 6c                	ja     80064d <vprintfmt+0x287>
+  8005e1:	89 c2                	mov    %eax,%edx
+  8005e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005e7:	83 c0 08             	add    $0x8,%eax
+  8005ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005ed:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005f0:	48 85 d2             	test   %rdx,%rdx
+  8005f3:	48 b8 3c 2c 80 00 00 	movabs $0x802c3c,%rax
+  8005fa:	00 00 00 
+  8005fd:	48 0f 45 c2          	cmovne %rdx,%rax
+  800601:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800605:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800609:	7e 06                	jle    800611 <vprintfmt+0x24b>
+  80060b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80060f:	75 4a                	jne    80065b <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800611:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800615:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800619:	0f b6 00             	movzbl (%rax),%eax
+  80061c:	84 c0                	test   %al,%al
+  80061e:	0f 85 9a 00 00 00    	jne    8006be <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800624:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800627:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80062b:	85 c0                	test   %eax,%eax
+  80062d:	0f 8e c4 fd ff ff    	jle    8003f7 <vprintfmt+0x31>
+  800633:	4c 89 ee             	mov    %r13,%rsi
+  800636:	bf 20 00 00 00       	mov    $0x20,%edi
+  80063b:	41 ff d6             	call   *%r14
+  80063e:	41 83 ec 01          	sub    $0x1,%r12d
+  800642:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800646:	75 eb                	jne    800633 <vprintfmt+0x26d>
+  800648:	e9 aa fd ff ff       	jmp    8003f7 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80064d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800651:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800655:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800659:	eb 92                	jmp    8005ed <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80065b:	49 63 f7             	movslq %r15d,%rsi
+  80065e:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800662:	48 b8 78 0b 80 00 00 	movabs $0x800b78,%rax
+  800669:	00 00 00 
+  80066c:	ff d0                	call   *%rax
+  80066e:	48 89 c2             	mov    %rax,%rdx
+  800671:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800674:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800676:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800679:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80067c:	85 c0                	test   %eax,%eax
+  80067e:	7e 91                	jle    800611 <vprintfmt+0x24b>
+  800680:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800685:	4c 89 ee             	mov    %r13,%rsi
+  800688:	44 89 e7             	mov    %r12d,%edi
+  80068b:	41 ff d6             	call   *%r14
+  80068e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800692:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800695:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800698:	75 eb                	jne    800685 <vprintfmt+0x2bf>
+  80069a:	e9 72 ff ff ff       	jmp    800611 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80069f:	0f b6 f8             	movzbl %al,%edi
+  8006a2:	4c 89 ee             	mov    %r13,%rsi
+  8006a5:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006a8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006ac:	49 83 c4 01          	add    $0x1,%r12
+  8006b0:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006b6:	84 c0                	test   %al,%al
+  8006b8:	0f 84 66 ff ff ff    	je     800624 <vprintfmt+0x25e>
+  8006be:	45 85 ff             	test   %r15d,%r15d
+  8006c1:	78 0a                	js     8006cd <vprintfmt+0x307>
+  8006c3:	41 83 ef 01          	sub    $0x1,%r15d
+  8006c7:	0f 88 57 ff ff ff    	js     800624 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006cd:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006d1:	74 cc                	je     80069f <vprintfmt+0x2d9>
+  8006d3:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006d6:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006db:	80 fa 5e             	cmp    $0x5e,%dl
+  8006de:	77 c2                	ja     8006a2 <vprintfmt+0x2dc>
+  8006e0:	eb bd                	jmp    80069f <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8006e2:	40 84 f6             	test   %sil,%sil
+  8006e5:	75 26                	jne    80070d <vprintfmt+0x347>
+    switch (lflag) {
+  8006e7:	85 d2                	test   %edx,%edx
+  8006e9:	74 59                	je     800744 <vprintfmt+0x37e>
+  8006eb:	83 fa 01             	cmp    $0x1,%edx
+  8006ee:	74 7b                	je     80076b <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f6:	0f 87 96 00 00 00    	ja     800792 <vprintfmt+0x3cc>
+  8006fc:	89 c2                	mov    %eax,%edx
+  8006fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800702:	83 c0 08             	add    $0x8,%eax
+  800705:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800708:	4c 8b 22             	mov    (%rdx),%r12
+  80070b:	eb 17                	jmp    800724 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80070d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800710:	83 f8 2f             	cmp    $0x2f,%eax
+  800713:	77 21                	ja     800736 <vprintfmt+0x370>
+  800715:	89 c2                	mov    %eax,%edx
+  800717:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80071b:	83 c0 08             	add    $0x8,%eax
+  80071e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800721:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800724:	4d 85 e4             	test   %r12,%r12
+  800727:	78 7a                	js     8007a3 <vprintfmt+0x3dd>
+            num = i;
+  800729:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80072c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800731:	e9 50 02 00 00       	jmp    800986 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800736:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80073a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80073e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800742:	eb dd                	jmp    800721 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800744:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800747:	83 f8 2f             	cmp    $0x2f,%eax
+  80074a:	77 11                	ja     80075d <vprintfmt+0x397>
+  80074c:	89 c2                	mov    %eax,%edx
+  80074e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800752:	83 c0 08             	add    $0x8,%eax
+  800755:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800758:	4c 63 22             	movslq (%rdx),%r12
+  80075b:	eb c7                	jmp    800724 <vprintfmt+0x35e>
+  80075d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800761:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800765:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800769:	eb ed                	jmp    800758 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80076b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076e:	83 f8 2f             	cmp    $0x2f,%eax
+  800771:	77 11                	ja     800784 <vprintfmt+0x3be>
+  800773:	89 c2                	mov    %eax,%edx
+  800775:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800779:	83 c0 08             	add    $0x8,%eax
+  80077c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077f:	4c 8b 22             	mov    (%rdx),%r12
+  800782:	eb a0                	jmp    800724 <vprintfmt+0x35e>
+  800784:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800788:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800790:	eb ed                	jmp    80077f <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800792:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800796:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80079a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80079e:	e9 65 ff ff ff       	jmp    800708 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007a3:	4c 89 ee             	mov    %r13,%rsi
+  8007a6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007ab:	41 ff d6             	call   *%r14
+                i = -i;
+  8007ae:	49 f7 dc             	neg    %r12
+  8007b1:	e9 73 ff ff ff       	jmp    800729 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007b6:	40 84 f6             	test   %sil,%sil
+  8007b9:	75 32                	jne    8007ed <vprintfmt+0x427>
+    switch (lflag) {
+  8007bb:	85 d2                	test   %edx,%edx
+  8007bd:	74 5d                	je     80081c <vprintfmt+0x456>
+  8007bf:	83 fa 01             	cmp    $0x1,%edx
+  8007c2:	0f 84 82 00 00 00    	je     80084a <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ce:	0f 87 a5 00 00 00    	ja     800879 <vprintfmt+0x4b3>
+  8007d4:	89 c2                	mov    %eax,%edx
+  8007d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007da:	83 c0 08             	add    $0x8,%eax
+  8007dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007e0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007e3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007e8:	e9 99 01 00 00       	jmp    800986 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f3:	77 19                	ja     80080e <vprintfmt+0x448>
+  8007f5:	89 c2                	mov    %eax,%edx
+  8007f7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fb:	83 c0 08             	add    $0x8,%eax
+  8007fe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800801:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800804:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800809:	e9 78 01 00 00       	jmp    800986 <vprintfmt+0x5c0>
+  80080e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800812:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800816:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081a:	eb e5                	jmp    800801 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80081c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081f:	83 f8 2f             	cmp    $0x2f,%eax
+  800822:	77 18                	ja     80083c <vprintfmt+0x476>
+  800824:	89 c2                	mov    %eax,%edx
+  800826:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082a:	83 c0 08             	add    $0x8,%eax
+  80082d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800830:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800832:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800837:	e9 4a 01 00 00       	jmp    800986 <vprintfmt+0x5c0>
+  80083c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800840:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800844:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800848:	eb e6                	jmp    800830 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80084a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084d:	83 f8 2f             	cmp    $0x2f,%eax
+  800850:	77 19                	ja     80086b <vprintfmt+0x4a5>
+  800852:	89 c2                	mov    %eax,%edx
+  800854:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800858:	83 c0 08             	add    $0x8,%eax
+  80085b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800861:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800866:	e9 1b 01 00 00       	jmp    800986 <vprintfmt+0x5c0>
+  80086b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800873:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800877:	eb e5                	jmp    80085e <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800879:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800881:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800885:	e9 56 ff ff ff       	jmp    8007e0 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80088a:	40 84 f6             	test   %sil,%sil
+  80088d:	75 2e                	jne    8008bd <vprintfmt+0x4f7>
+    switch (lflag) {
+  80088f:	85 d2                	test   %edx,%edx
+  800891:	74 59                	je     8008ec <vprintfmt+0x526>
+  800893:	83 fa 01             	cmp    $0x1,%edx
+  800896:	74 7f                	je     800917 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800898:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089b:	83 f8 2f             	cmp    $0x2f,%eax
+  80089e:	0f 87 9f 00 00 00    	ja     800943 <vprintfmt+0x57d>
+  8008a4:	89 c2                	mov    %eax,%edx
+  8008a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008aa:	83 c0 08             	add    $0x8,%eax
+  8008ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008b3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008b8:	e9 c9 00 00 00       	jmp    800986 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c3:	77 19                	ja     8008de <vprintfmt+0x518>
+  8008c5:	89 c2                	mov    %eax,%edx
+  8008c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008cb:	83 c0 08             	add    $0x8,%eax
+  8008ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008d4:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008d9:	e9 a8 00 00 00       	jmp    800986 <vprintfmt+0x5c0>
+  8008de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ea:	eb e5                	jmp    8008d1 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f2:	77 15                	ja     800909 <vprintfmt+0x543>
+  8008f4:	89 c2                	mov    %eax,%edx
+  8008f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008fa:	83 c0 08             	add    $0x8,%eax
+  8008fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800900:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800902:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800907:	eb 7d                	jmp    800986 <vprintfmt+0x5c0>
+  800909:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800911:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800915:	eb e9                	jmp    800900 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800917:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091a:	83 f8 2f             	cmp    $0x2f,%eax
+  80091d:	77 16                	ja     800935 <vprintfmt+0x56f>
+  80091f:	89 c2                	mov    %eax,%edx
+  800921:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800925:	83 c0 08             	add    $0x8,%eax
+  800928:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80092e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800933:	eb 51                	jmp    800986 <vprintfmt+0x5c0>
+  800935:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800939:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800941:	eb e8                	jmp    80092b <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800943:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800947:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094f:	e9 5c ff ff ff       	jmp    8008b0 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800954:	4c 89 ee             	mov    %r13,%rsi
+  800957:	bf 30 00 00 00       	mov    $0x30,%edi
+  80095c:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80095f:	4c 89 ee             	mov    %r13,%rsi
+  800962:	bf 78 00 00 00       	mov    $0x78,%edi
+  800967:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80096a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096d:	83 f8 2f             	cmp    $0x2f,%eax
+  800970:	77 47                	ja     8009b9 <vprintfmt+0x5f3>
+  800972:	89 c2                	mov    %eax,%edx
+  800974:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800978:	83 c0 08             	add    $0x8,%eax
+  80097b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800981:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800986:	48 83 ec 08          	sub    $0x8,%rsp
+  80098a:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80098e:	0f 94 c0             	sete   %al
+  800991:	0f b6 c0             	movzbl %al,%eax
+  800994:	50                   	push   %rax
+  800995:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80099a:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80099e:	4c 89 ee             	mov    %r13,%rsi
+  8009a1:	4c 89 f7             	mov    %r14,%rdi
+  8009a4:	48 b8 bb 02 80 00 00 	movabs $0x8002bb,%rax
+  8009ab:	00 00 00 
+  8009ae:	ff d0                	call   *%rax
+            break;
+  8009b0:	48 83 c4 10          	add    $0x10,%rsp
+  8009b4:	e9 3e fa ff ff       	jmp    8003f7 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c5:	eb b7                	jmp    80097e <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c7:	40 84 f6             	test   %sil,%sil
+  8009ca:	75 2b                	jne    8009f7 <vprintfmt+0x631>
+    switch (lflag) {
+  8009cc:	85 d2                	test   %edx,%edx
+  8009ce:	74 56                	je     800a26 <vprintfmt+0x660>
+  8009d0:	83 fa 01             	cmp    $0x1,%edx
+  8009d3:	74 7f                	je     800a54 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009db:	0f 87 a2 00 00 00    	ja     800a83 <vprintfmt+0x6bd>
+  8009e1:	89 c2                	mov    %eax,%edx
+  8009e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e7:	83 c0 08             	add    $0x8,%eax
+  8009ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ed:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009f0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009f5:	eb 8f                	jmp    800986 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fd:	77 19                	ja     800a18 <vprintfmt+0x652>
+  8009ff:	89 c2                	mov    %eax,%edx
+  800a01:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a05:	83 c0 08             	add    $0x8,%eax
+  800a08:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a0e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a13:	e9 6e ff ff ff       	jmp    800986 <vprintfmt+0x5c0>
+  800a18:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a24:	eb e5                	jmp    800a0b <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a29:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2c:	77 18                	ja     800a46 <vprintfmt+0x680>
+  800a2e:	89 c2                	mov    %eax,%edx
+  800a30:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a34:	83 c0 08             	add    $0x8,%eax
+  800a37:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a3c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a41:	e9 40 ff ff ff       	jmp    800986 <vprintfmt+0x5c0>
+  800a46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a52:	eb e6                	jmp    800a3a <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a54:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a57:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5a:	77 19                	ja     800a75 <vprintfmt+0x6af>
+  800a5c:	89 c2                	mov    %eax,%edx
+  800a5e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a62:	83 c0 08             	add    $0x8,%eax
+  800a65:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a68:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a6b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a70:	e9 11 ff ff ff       	jmp    800986 <vprintfmt+0x5c0>
+  800a75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a79:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a81:	eb e5                	jmp    800a68 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a83:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a87:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8f:	e9 59 ff ff ff       	jmp    8009ed <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a94:	4c 89 ee             	mov    %r13,%rsi
+  800a97:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a9c:	41 ff d6             	call   *%r14
+            break;
+  800a9f:	e9 53 f9 ff ff       	jmp    8003f7 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800aa4:	4c 89 ee             	mov    %r13,%rsi
+  800aa7:	bf 25 00 00 00       	mov    $0x25,%edi
+  800aac:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800aaf:	48 83 eb 01          	sub    $0x1,%rbx
+  800ab3:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ab7:	75 f6                	jne    800aaf <vprintfmt+0x6e9>
+  800ab9:	e9 39 f9 ff ff       	jmp    8003f7 <vprintfmt+0x31>
+}
+  800abe:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ac2:	5b                   	pop    %rbx
+  800ac3:	41 5c                	pop    %r12
+  800ac5:	41 5d                	pop    %r13
+  800ac7:	41 5e                	pop    %r14
+  800ac9:	41 5f                	pop    %r15
+  800acb:	5d                   	pop    %rbp
+  800acc:	c3                   	ret
+
+0000000000800acd <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800acd:	55                   	push   %rbp
+  800ace:	48 89 e5             	mov    %rsp,%rbp
+  800ad1:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ad5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ad9:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ade:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ae2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ae9:	48 85 ff             	test   %rdi,%rdi
+  800aec:	74 2b                	je     800b19 <vsnprintf+0x4c>
+  800aee:	48 85 f6             	test   %rsi,%rsi
+  800af1:	74 26                	je     800b19 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800af3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800af7:	48 bf 71 03 80 00 00 	movabs $0x800371,%rdi
+  800afe:	00 00 00 
+  800b01:	48 b8 c6 03 80 00 00 	movabs $0x8003c6,%rax
+  800b08:	00 00 00 
+  800b0b:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b11:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b14:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b17:	c9                   	leave
+  800b18:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b19:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b1e:	eb f7                	jmp    800b17 <vsnprintf+0x4a>
+
+0000000000800b20 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b20:	55                   	push   %rbp
+  800b21:	48 89 e5             	mov    %rsp,%rbp
+  800b24:	48 83 ec 50          	sub    $0x50,%rsp
+  800b28:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b2c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b30:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b34:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b3b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b3f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b43:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b47:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b4b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b4f:	48 b8 cd 0a 80 00 00 	movabs $0x800acd,%rax
+  800b56:	00 00 00 
+  800b59:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b5b:	c9                   	leave
+  800b5c:	c3                   	ret
+
+0000000000800b5d <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b5d:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b60:	74 10                	je     800b72 <strlen+0x15>
+    size_t n = 0;
+  800b62:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b67:	48 83 c0 01          	add    $0x1,%rax
+  800b6b:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b6f:	75 f6                	jne    800b67 <strlen+0xa>
+  800b71:	c3                   	ret
+    size_t n = 0;
+  800b72:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b77:	c3                   	ret
+
+0000000000800b78 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b78:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b7b:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b80:	48 85 f6             	test   %rsi,%rsi
+  800b83:	74 11                	je     800b96 <strnlen+0x1e>
+  800b85:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b89:	74 0c                	je     800b97 <strnlen+0x1f>
+  800b8b:	48 83 c2 01          	add    $0x1,%rdx
+  800b8f:	48 39 d0             	cmp    %rdx,%rax
+  800b92:	75 f1                	jne    800b85 <strnlen+0xd>
+  800b94:	eb 04                	jmp    800b9a <strnlen+0x22>
+  800b96:	c3                   	ret
+  800b97:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b9a:	c3                   	ret
+
+0000000000800b9b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b9b:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ba3:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ba7:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800baa:	48 83 c2 01          	add    $0x1,%rdx
+  800bae:	84 c9                	test   %cl,%cl
+  800bb0:	75 f1                	jne    800ba3 <strcpy+0x8>
+        ;
+    return res;
+}
+  800bb2:	c3                   	ret
+
+0000000000800bb3 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800bb3:	55                   	push   %rbp
+  800bb4:	48 89 e5             	mov    %rsp,%rbp
+  800bb7:	41 54                	push   %r12
+  800bb9:	53                   	push   %rbx
+  800bba:	48 89 fb             	mov    %rdi,%rbx
+  800bbd:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bc0:	48 b8 5d 0b 80 00 00 	movabs $0x800b5d,%rax
+  800bc7:	00 00 00 
+  800bca:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bcc:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bd0:	4c 89 e6             	mov    %r12,%rsi
+  800bd3:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  800bda:	00 00 00 
+  800bdd:	ff d0                	call   *%rax
+    return dst;
+}
+  800bdf:	48 89 d8             	mov    %rbx,%rax
+  800be2:	5b                   	pop    %rbx
+  800be3:	41 5c                	pop    %r12
+  800be5:	5d                   	pop    %rbp
+  800be6:	c3                   	ret
+
+0000000000800be7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800be7:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800bea:	48 85 d2             	test   %rdx,%rdx
+  800bed:	74 1f                	je     800c0e <strncpy+0x27>
+  800bef:	48 01 fa             	add    %rdi,%rdx
+  800bf2:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800bf5:	48 83 c1 01          	add    $0x1,%rcx
+  800bf9:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800bfd:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c01:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c05:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c09:	48 39 ca             	cmp    %rcx,%rdx
+  800c0c:	75 e7                	jne    800bf5 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c0e:	c3                   	ret
+
+0000000000800c0f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c0f:	48 89 f8             	mov    %rdi,%rax
+  800c12:	48 85 d2             	test   %rdx,%rdx
+  800c15:	74 24                	je     800c3b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c17:	48 83 ea 01          	sub    $0x1,%rdx
+  800c1b:	74 1b                	je     800c38 <strlcpy+0x29>
+  800c1d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c21:	0f b6 16             	movzbl (%rsi),%edx
+  800c24:	84 d2                	test   %dl,%dl
+  800c26:	74 10                	je     800c38 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c28:	48 83 c6 01          	add    $0x1,%rsi
+  800c2c:	48 83 c0 01          	add    $0x1,%rax
+  800c30:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c33:	48 39 c8             	cmp    %rcx,%rax
+  800c36:	75 e9                	jne    800c21 <strlcpy+0x12>
+        *dst = '\0';
+  800c38:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c3b:	48 29 f8             	sub    %rdi,%rax
+}
+  800c3e:	c3                   	ret
+
+0000000000800c3f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c3f:	0f b6 07             	movzbl (%rdi),%eax
+  800c42:	84 c0                	test   %al,%al
+  800c44:	74 13                	je     800c59 <strcmp+0x1a>
+  800c46:	38 06                	cmp    %al,(%rsi)
+  800c48:	75 0f                	jne    800c59 <strcmp+0x1a>
+  800c4a:	48 83 c7 01          	add    $0x1,%rdi
+  800c4e:	48 83 c6 01          	add    $0x1,%rsi
+  800c52:	0f b6 07             	movzbl (%rdi),%eax
+  800c55:	84 c0                	test   %al,%al
+  800c57:	75 ed                	jne    800c46 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c59:	0f b6 c0             	movzbl %al,%eax
+  800c5c:	0f b6 16             	movzbl (%rsi),%edx
+  800c5f:	29 d0                	sub    %edx,%eax
+}
+  800c61:	c3                   	ret
+
+0000000000800c62 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c62:	48 85 d2             	test   %rdx,%rdx
+  800c65:	74 1f                	je     800c86 <strncmp+0x24>
+  800c67:	0f b6 07             	movzbl (%rdi),%eax
+  800c6a:	84 c0                	test   %al,%al
+  800c6c:	74 1e                	je     800c8c <strncmp+0x2a>
+  800c6e:	3a 06                	cmp    (%rsi),%al
+  800c70:	75 1a                	jne    800c8c <strncmp+0x2a>
+  800c72:	48 83 c7 01          	add    $0x1,%rdi
+  800c76:	48 83 c6 01          	add    $0x1,%rsi
+  800c7a:	48 83 ea 01          	sub    $0x1,%rdx
+  800c7e:	75 e7                	jne    800c67 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c80:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c85:	c3                   	ret
+  800c86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8b:	c3                   	ret
+  800c8c:	48 85 d2             	test   %rdx,%rdx
+  800c8f:	74 09                	je     800c9a <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c91:	0f b6 07             	movzbl (%rdi),%eax
+  800c94:	0f b6 16             	movzbl (%rsi),%edx
+  800c97:	29 d0                	sub    %edx,%eax
+  800c99:	c3                   	ret
+    if (!n) return 0;
+  800c9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c9f:	c3                   	ret
+
+0000000000800ca0 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ca0:	0f b6 17             	movzbl (%rdi),%edx
+  800ca3:	84 d2                	test   %dl,%dl
+  800ca5:	74 18                	je     800cbf <strchr+0x1f>
+        if (*str == c) {
+  800ca7:	0f be d2             	movsbl %dl,%edx
+  800caa:	39 f2                	cmp    %esi,%edx
+  800cac:	74 17                	je     800cc5 <strchr+0x25>
+    for (; *str; str++) {
+  800cae:	48 83 c7 01          	add    $0x1,%rdi
+  800cb2:	0f b6 17             	movzbl (%rdi),%edx
+  800cb5:	84 d2                	test   %dl,%dl
+  800cb7:	75 ee                	jne    800ca7 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbe:	c3                   	ret
+  800cbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc4:	c3                   	ret
+  800cc5:	48 89 f8             	mov    %rdi,%rax
+}
+  800cc8:	c3                   	ret
+
+0000000000800cc9 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cc9:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800ccc:	0f b6 17             	movzbl (%rdi),%edx
+  800ccf:	84 d2                	test   %dl,%dl
+  800cd1:	74 13                	je     800ce6 <strfind+0x1d>
+  800cd3:	0f be d2             	movsbl %dl,%edx
+  800cd6:	39 f2                	cmp    %esi,%edx
+  800cd8:	74 0b                	je     800ce5 <strfind+0x1c>
+  800cda:	48 83 c0 01          	add    $0x1,%rax
+  800cde:	0f b6 10             	movzbl (%rax),%edx
+  800ce1:	84 d2                	test   %dl,%dl
+  800ce3:	75 ee                	jne    800cd3 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ce5:	c3                   	ret
+  800ce6:	c3                   	ret
+
+0000000000800ce7 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ce7:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800cea:	48 89 f8             	mov    %rdi,%rax
+  800ced:	48 f7 d8             	neg    %rax
+  800cf0:	83 e0 07             	and    $0x7,%eax
+  800cf3:	49 89 d1             	mov    %rdx,%r9
+  800cf6:	49 29 c1             	sub    %rax,%r9
+  800cf9:	78 36                	js     800d31 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800cfb:	40 0f b6 c6          	movzbl %sil,%eax
+  800cff:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d06:	01 01 01 
+  800d09:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d0d:	40 f6 c7 07          	test   $0x7,%dil
+  800d11:	75 38                	jne    800d4b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d13:	4c 89 c9             	mov    %r9,%rcx
+  800d16:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d1a:	74 0c                	je     800d28 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d1c:	fc                   	cld
+  800d1d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d20:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d24:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d28:	4d 85 c9             	test   %r9,%r9
+  800d2b:	75 45                	jne    800d72 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d2d:	4c 89 c0             	mov    %r8,%rax
+  800d30:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d31:	48 85 d2             	test   %rdx,%rdx
+  800d34:	74 f7                	je     800d2d <memset+0x46>
+  800d36:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d39:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d3c:	48 83 c0 01          	add    $0x1,%rax
+  800d40:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d44:	48 39 c2             	cmp    %rax,%rdx
+  800d47:	75 f3                	jne    800d3c <memset+0x55>
+  800d49:	eb e2                	jmp    800d2d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d4b:	40 f6 c7 01          	test   $0x1,%dil
+  800d4f:	74 06                	je     800d57 <memset+0x70>
+  800d51:	88 07                	mov    %al,(%rdi)
+  800d53:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d57:	40 f6 c7 02          	test   $0x2,%dil
+  800d5b:	74 07                	je     800d64 <memset+0x7d>
+  800d5d:	66 89 07             	mov    %ax,(%rdi)
+  800d60:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d64:	40 f6 c7 04          	test   $0x4,%dil
+  800d68:	74 a9                	je     800d13 <memset+0x2c>
+  800d6a:	89 07                	mov    %eax,(%rdi)
+  800d6c:	48 83 c7 04          	add    $0x4,%rdi
+  800d70:	eb a1                	jmp    800d13 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d72:	41 f6 c1 04          	test   $0x4,%r9b
+  800d76:	74 06                	je     800d7e <memset+0x97>
+  800d78:	89 07                	mov    %eax,(%rdi)
+  800d7a:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d7e:	41 f6 c1 02          	test   $0x2,%r9b
+  800d82:	74 07                	je     800d8b <memset+0xa4>
+  800d84:	66 89 07             	mov    %ax,(%rdi)
+  800d87:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d8b:	41 f6 c1 01          	test   $0x1,%r9b
+  800d8f:	74 9c                	je     800d2d <memset+0x46>
+  800d91:	88 07                	mov    %al,(%rdi)
+  800d93:	eb 98                	jmp    800d2d <memset+0x46>
+
+0000000000800d95 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d95:	48 89 f8             	mov    %rdi,%rax
+  800d98:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d9b:	48 39 fe             	cmp    %rdi,%rsi
+  800d9e:	73 3b                	jae    800ddb <memmove+0x46>
+  800da0:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800da4:	48 39 d7             	cmp    %rdx,%rdi
+  800da7:	73 32                	jae    800ddb <memmove+0x46>
+        s += n;
+        d += n;
+  800da9:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dad:	48 89 d6             	mov    %rdx,%rsi
+  800db0:	48 09 fe             	or     %rdi,%rsi
+  800db3:	48 09 ce             	or     %rcx,%rsi
+  800db6:	40 f6 c6 07          	test   $0x7,%sil
+  800dba:	75 12                	jne    800dce <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800dbc:	48 83 ef 08          	sub    $0x8,%rdi
+  800dc0:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800dc4:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dc8:	fd                   	std
+  800dc9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800dcc:	fc                   	cld
+  800dcd:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800dce:	48 83 ef 01          	sub    $0x1,%rdi
+  800dd2:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800dd6:	fd                   	std
+  800dd7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800dd9:	eb f1                	jmp    800dcc <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ddb:	48 89 f2             	mov    %rsi,%rdx
+  800dde:	48 09 c2             	or     %rax,%rdx
+  800de1:	48 09 ca             	or     %rcx,%rdx
+  800de4:	f6 c2 07             	test   $0x7,%dl
+  800de7:	75 0c                	jne    800df5 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800de9:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ded:	48 89 c7             	mov    %rax,%rdi
+  800df0:	fc                   	cld
+  800df1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800df4:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800df5:	48 89 c7             	mov    %rax,%rdi
+  800df8:	fc                   	cld
+  800df9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800dfb:	c3                   	ret
+
+0000000000800dfc <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800dfc:	55                   	push   %rbp
+  800dfd:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e00:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  800e07:	00 00 00 
+  800e0a:	ff d0                	call   *%rax
+}
+  800e0c:	5d                   	pop    %rbp
+  800e0d:	c3                   	ret
+
+0000000000800e0e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e0e:	55                   	push   %rbp
+  800e0f:	48 89 e5             	mov    %rsp,%rbp
+  800e12:	41 57                	push   %r15
+  800e14:	41 56                	push   %r14
+  800e16:	41 55                	push   %r13
+  800e18:	41 54                	push   %r12
+  800e1a:	53                   	push   %rbx
+  800e1b:	48 83 ec 08          	sub    $0x8,%rsp
+  800e1f:	49 89 fe             	mov    %rdi,%r14
+  800e22:	49 89 f7             	mov    %rsi,%r15
+  800e25:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e28:	48 89 f7             	mov    %rsi,%rdi
+  800e2b:	48 b8 5d 0b 80 00 00 	movabs $0x800b5d,%rax
+  800e32:	00 00 00 
+  800e35:	ff d0                	call   *%rax
+  800e37:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e3a:	48 89 de             	mov    %rbx,%rsi
+  800e3d:	4c 89 f7             	mov    %r14,%rdi
+  800e40:	48 b8 78 0b 80 00 00 	movabs $0x800b78,%rax
+  800e47:	00 00 00 
+  800e4a:	ff d0                	call   *%rax
+  800e4c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e4f:	48 39 c3             	cmp    %rax,%rbx
+  800e52:	74 36                	je     800e8a <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e54:	48 89 d8             	mov    %rbx,%rax
+  800e57:	4c 29 e8             	sub    %r13,%rax
+  800e5a:	49 39 c4             	cmp    %rax,%r12
+  800e5d:	73 31                	jae    800e90 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e5f:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e64:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e68:	4c 89 fe             	mov    %r15,%rsi
+  800e6b:	48 b8 fc 0d 80 00 00 	movabs $0x800dfc,%rax
+  800e72:	00 00 00 
+  800e75:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e77:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e7b:	48 83 c4 08          	add    $0x8,%rsp
+  800e7f:	5b                   	pop    %rbx
+  800e80:	41 5c                	pop    %r12
+  800e82:	41 5d                	pop    %r13
+  800e84:	41 5e                	pop    %r14
+  800e86:	41 5f                	pop    %r15
+  800e88:	5d                   	pop    %rbp
+  800e89:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e8a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e8e:	eb eb                	jmp    800e7b <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e90:	48 83 eb 01          	sub    $0x1,%rbx
+  800e94:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e98:	48 89 da             	mov    %rbx,%rdx
+  800e9b:	4c 89 fe             	mov    %r15,%rsi
+  800e9e:	48 b8 fc 0d 80 00 00 	movabs $0x800dfc,%rax
+  800ea5:	00 00 00 
+  800ea8:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800eaa:	49 01 de             	add    %rbx,%r14
+  800ead:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800eb2:	eb c3                	jmp    800e77 <strlcat+0x69>
+
+0000000000800eb4 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800eb4:	48 85 d2             	test   %rdx,%rdx
+  800eb7:	74 2d                	je     800ee6 <memcmp+0x32>
+  800eb9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ebe:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ec2:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ec7:	44 38 c1             	cmp    %r8b,%cl
+  800eca:	75 0f                	jne    800edb <memcmp+0x27>
+    while (n-- > 0) {
+  800ecc:	48 83 c0 01          	add    $0x1,%rax
+  800ed0:	48 39 c2             	cmp    %rax,%rdx
+  800ed3:	75 e9                	jne    800ebe <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eda:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800edb:	0f b6 c1             	movzbl %cl,%eax
+  800ede:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ee2:	44 29 c0             	sub    %r8d,%eax
+  800ee5:	c3                   	ret
+    return 0;
+  800ee6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800eeb:	c3                   	ret
+
+0000000000800eec <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800eec:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800ef0:	48 39 c7             	cmp    %rax,%rdi
+  800ef3:	73 0f                	jae    800f04 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800ef5:	40 38 37             	cmp    %sil,(%rdi)
+  800ef8:	74 0e                	je     800f08 <memfind+0x1c>
+    for (; src < end; src++) {
+  800efa:	48 83 c7 01          	add    $0x1,%rdi
+  800efe:	48 39 f8             	cmp    %rdi,%rax
+  800f01:	75 f2                	jne    800ef5 <memfind+0x9>
+  800f03:	c3                   	ret
+  800f04:	48 89 f8             	mov    %rdi,%rax
+  800f07:	c3                   	ret
+  800f08:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f0b:	c3                   	ret
+
+0000000000800f0c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f0c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f0f:	0f b6 37             	movzbl (%rdi),%esi
+  800f12:	40 80 fe 20          	cmp    $0x20,%sil
+  800f16:	74 06                	je     800f1e <strtol+0x12>
+  800f18:	40 80 fe 09          	cmp    $0x9,%sil
+  800f1c:	75 13                	jne    800f31 <strtol+0x25>
+  800f1e:	48 83 c7 01          	add    $0x1,%rdi
+  800f22:	0f b6 37             	movzbl (%rdi),%esi
+  800f25:	40 80 fe 20          	cmp    $0x20,%sil
+  800f29:	74 f3                	je     800f1e <strtol+0x12>
+  800f2b:	40 80 fe 09          	cmp    $0x9,%sil
+  800f2f:	74 ed                	je     800f1e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f31:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f34:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f37:	3c 01                	cmp    $0x1,%al
+  800f39:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f3d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f43:	75 0f                	jne    800f54 <strtol+0x48>
+  800f45:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f48:	74 14                	je     800f5e <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f4a:	85 d2                	test   %edx,%edx
+  800f4c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f51:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f54:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f59:	4c 63 ca             	movslq %edx,%r9
+  800f5c:	eb 36                	jmp    800f94 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f5e:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f62:	74 0f                	je     800f73 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f64:	85 d2                	test   %edx,%edx
+  800f66:	75 ec                	jne    800f54 <strtol+0x48>
+        s++;
+  800f68:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f6c:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f71:	eb e1                	jmp    800f54 <strtol+0x48>
+        s += 2;
+  800f73:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f77:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f7c:	eb d6                	jmp    800f54 <strtol+0x48>
+            dig -= '0';
+  800f7e:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f81:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f85:	41 39 d0             	cmp    %edx,%r8d
+  800f88:	7d 21                	jge    800fab <strtol+0x9f>
+        val = val * base + dig;
+  800f8a:	49 0f af c1          	imul   %r9,%rax
+  800f8e:	0f b6 c9             	movzbl %cl,%ecx
+  800f91:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f94:	48 83 c7 01          	add    $0x1,%rdi
+  800f98:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f9c:	80 f9 39             	cmp    $0x39,%cl
+  800f9f:	76 dd                	jbe    800f7e <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fa1:	80 f9 7b             	cmp    $0x7b,%cl
+  800fa4:	77 05                	ja     800fab <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fa6:	83 e9 57             	sub    $0x57,%ecx
+  800fa9:	eb d6                	jmp    800f81 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fab:	4d 85 d2             	test   %r10,%r10
+  800fae:	74 03                	je     800fb3 <strtol+0xa7>
+  800fb0:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fb3:	48 89 c2             	mov    %rax,%rdx
+  800fb6:	48 f7 da             	neg    %rdx
+  800fb9:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fbd:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fc1:	c3                   	ret
+
+0000000000800fc2 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800fc2:	55                   	push   %rbp
+  800fc3:	48 89 e5             	mov    %rsp,%rbp
+  800fc6:	53                   	push   %rbx
+  800fc7:	48 89 fa             	mov    %rdi,%rdx
+  800fca:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800fcd:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fd2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fdc:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fe7:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800fe9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fed:	c9                   	leave
+  800fee:	c3                   	ret
+
+0000000000800fef <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800fef:	55                   	push   %rbp
+  800ff0:	48 89 e5             	mov    %rsp,%rbp
+  800ff3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800ff4:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800ff9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ffe:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801003:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801008:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80100d:	be 00 00 00 00       	mov    $0x0,%esi
+  801012:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801018:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80101a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80101e:	c9                   	leave
+  80101f:	c3                   	ret
+
+0000000000801020 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801020:	55                   	push   %rbp
+  801021:	48 89 e5             	mov    %rsp,%rbp
+  801024:	53                   	push   %rbx
+  801025:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801029:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80102c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801031:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801036:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801040:	be 00 00 00 00       	mov    $0x0,%esi
+  801045:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80104b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80104d:	48 85 c0             	test   %rax,%rax
+  801050:	7f 06                	jg     801058 <sys_env_destroy+0x38>
+}
+  801052:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801056:	c9                   	leave
+  801057:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801058:	49 89 c0             	mov    %rax,%r8
+  80105b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801060:	48 ba 70 31 80 00 00 	movabs $0x803170,%rdx
+  801067:	00 00 00 
+  80106a:	be 26 00 00 00       	mov    $0x26,%esi
+  80106f:	48 bf 8f 31 80 00 00 	movabs $0x80318f,%rdi
+  801076:	00 00 00 
+  801079:	b8 00 00 00 00       	mov    $0x0,%eax
+  80107e:	49 b9 45 2b 80 00 00 	movabs $0x802b45,%r9
+  801085:	00 00 00 
+  801088:	41 ff d1             	call   *%r9
+
+000000000080108b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80108b:	55                   	push   %rbp
+  80108c:	48 89 e5             	mov    %rsp,%rbp
+  80108f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801090:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801095:	ba 00 00 00 00       	mov    $0x0,%edx
+  80109a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80109f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010b4:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010ba:	c9                   	leave
+  8010bb:	c3                   	ret
+
+00000000008010bc <sys_yield>:
+
+void
+sys_yield(void) {
+  8010bc:	55                   	push   %rbp
+  8010bd:	48 89 e5             	mov    %rsp,%rbp
+  8010c0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010c1:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010da:	be 00 00 00 00       	mov    $0x0,%esi
+  8010df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010e5:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010eb:	c9                   	leave
+  8010ec:	c3                   	ret
+
+00000000008010ed <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8010ed:	55                   	push   %rbp
+  8010ee:	48 89 e5             	mov    %rsp,%rbp
+  8010f1:	53                   	push   %rbx
+  8010f2:	48 89 fa             	mov    %rdi,%rdx
+  8010f5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010fd:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801104:	00 00 00 
+  801107:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80110c:	be 00 00 00 00       	mov    $0x0,%esi
+  801111:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801117:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801119:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80111d:	c9                   	leave
+  80111e:	c3                   	ret
+
+000000000080111f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80111f:	55                   	push   %rbp
+  801120:	48 89 e5             	mov    %rsp,%rbp
+  801123:	53                   	push   %rbx
+  801124:	49 89 f8             	mov    %rdi,%r8
+  801127:	48 89 d3             	mov    %rdx,%rbx
+  80112a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80112d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801132:	4c 89 c2             	mov    %r8,%rdx
+  801135:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801138:	be 00 00 00 00       	mov    $0x0,%esi
+  80113d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801143:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801145:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801149:	c9                   	leave
+  80114a:	c3                   	ret
+
+000000000080114b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80114b:	55                   	push   %rbp
+  80114c:	48 89 e5             	mov    %rsp,%rbp
+  80114f:	53                   	push   %rbx
+  801150:	48 83 ec 08          	sub    $0x8,%rsp
+  801154:	89 f8                	mov    %edi,%eax
+  801156:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801159:	48 63 f9             	movslq %ecx,%rdi
+  80115c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80115f:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801164:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801167:	be 00 00 00 00       	mov    $0x0,%esi
+  80116c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801172:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801174:	48 85 c0             	test   %rax,%rax
+  801177:	7f 06                	jg     80117f <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801179:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80117d:	c9                   	leave
+  80117e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80117f:	49 89 c0             	mov    %rax,%r8
+  801182:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801187:	48 ba 70 31 80 00 00 	movabs $0x803170,%rdx
+  80118e:	00 00 00 
+  801191:	be 26 00 00 00       	mov    $0x26,%esi
+  801196:	48 bf 8f 31 80 00 00 	movabs $0x80318f,%rdi
+  80119d:	00 00 00 
+  8011a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a5:	49 b9 45 2b 80 00 00 	movabs $0x802b45,%r9
+  8011ac:	00 00 00 
+  8011af:	41 ff d1             	call   *%r9
+
+00000000008011b2 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011b2:	55                   	push   %rbp
+  8011b3:	48 89 e5             	mov    %rsp,%rbp
+  8011b6:	53                   	push   %rbx
+  8011b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8011bb:	89 f8                	mov    %edi,%eax
+  8011bd:	49 89 f2             	mov    %rsi,%r10
+  8011c0:	48 89 cf             	mov    %rcx,%rdi
+  8011c3:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011c6:	48 63 da             	movslq %edx,%rbx
+  8011c9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011cc:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011d1:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d4:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8011d7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011d9:	48 85 c0             	test   %rax,%rax
+  8011dc:	7f 06                	jg     8011e4 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e2:	c9                   	leave
+  8011e3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011e4:	49 89 c0             	mov    %rax,%r8
+  8011e7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8011ec:	48 ba 70 31 80 00 00 	movabs $0x803170,%rdx
+  8011f3:	00 00 00 
+  8011f6:	be 26 00 00 00       	mov    $0x26,%esi
+  8011fb:	48 bf 8f 31 80 00 00 	movabs $0x80318f,%rdi
+  801202:	00 00 00 
+  801205:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120a:	49 b9 45 2b 80 00 00 	movabs $0x802b45,%r9
+  801211:	00 00 00 
+  801214:	41 ff d1             	call   *%r9
+
+0000000000801217 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801217:	55                   	push   %rbp
+  801218:	48 89 e5             	mov    %rsp,%rbp
+  80121b:	53                   	push   %rbx
+  80121c:	48 83 ec 08          	sub    $0x8,%rsp
+  801220:	48 89 f1             	mov    %rsi,%rcx
+  801223:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801226:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801229:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80122e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801233:	be 00 00 00 00       	mov    $0x0,%esi
+  801238:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80123e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801240:	48 85 c0             	test   %rax,%rax
+  801243:	7f 06                	jg     80124b <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801245:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801249:	c9                   	leave
+  80124a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80124b:	49 89 c0             	mov    %rax,%r8
+  80124e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801253:	48 ba 70 31 80 00 00 	movabs $0x803170,%rdx
+  80125a:	00 00 00 
+  80125d:	be 26 00 00 00       	mov    $0x26,%esi
+  801262:	48 bf 8f 31 80 00 00 	movabs $0x80318f,%rdi
+  801269:	00 00 00 
+  80126c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801271:	49 b9 45 2b 80 00 00 	movabs $0x802b45,%r9
+  801278:	00 00 00 
+  80127b:	41 ff d1             	call   *%r9
+
+000000000080127e <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  80127e:	55                   	push   %rbp
+  80127f:	48 89 e5             	mov    %rsp,%rbp
+  801282:	53                   	push   %rbx
+  801283:	48 83 ec 08          	sub    $0x8,%rsp
+  801287:	89 f8                	mov    %edi,%eax
+  801289:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  80128c:	48 63 f9             	movslq %ecx,%rdi
+  80128f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801292:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801297:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80129a:	be 00 00 00 00       	mov    $0x0,%esi
+  80129f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012a7:	48 85 c0             	test   %rax,%rax
+  8012aa:	7f 06                	jg     8012b2 <sys_region_advise+0x34>
+}
+  8012ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b0:	c9                   	leave
+  8012b1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012b2:	49 89 c0             	mov    %rax,%r8
+  8012b5:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8012ba:	48 ba 70 31 80 00 00 	movabs $0x803170,%rdx
+  8012c1:	00 00 00 
+  8012c4:	be 26 00 00 00       	mov    $0x26,%esi
+  8012c9:	48 bf 8f 31 80 00 00 	movabs $0x80318f,%rdi
+  8012d0:	00 00 00 
+  8012d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d8:	49 b9 45 2b 80 00 00 	movabs $0x802b45,%r9
+  8012df:	00 00 00 
+  8012e2:	41 ff d1             	call   *%r9
+
+00000000008012e5 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  8012e5:	55                   	push   %rbp
+  8012e6:	48 89 e5             	mov    %rsp,%rbp
+  8012e9:	53                   	push   %rbx
+  8012ea:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  8012ee:	48 63 ce             	movslq %esi,%rcx
+  8012f1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f4:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801303:	be 00 00 00 00       	mov    $0x0,%esi
+  801308:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80130e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801310:	48 85 c0             	test   %rax,%rax
+  801313:	7f 06                	jg     80131b <sys_env_set_nice+0x36>
+}
+  801315:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801319:	c9                   	leave
+  80131a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80131b:	49 89 c0             	mov    %rax,%r8
+  80131e:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801323:	48 ba 70 31 80 00 00 	movabs $0x803170,%rdx
+  80132a:	00 00 00 
+  80132d:	be 26 00 00 00       	mov    $0x26,%esi
+  801332:	48 bf 8f 31 80 00 00 	movabs $0x80318f,%rdi
+  801339:	00 00 00 
+  80133c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801341:	49 b9 45 2b 80 00 00 	movabs $0x802b45,%r9
+  801348:	00 00 00 
+  80134b:	41 ff d1             	call   *%r9
+
+000000000080134e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80134e:	55                   	push   %rbp
+  80134f:	48 89 e5             	mov    %rsp,%rbp
+  801352:	53                   	push   %rbx
+  801353:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801357:	48 63 ce             	movslq %esi,%rcx
+  80135a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80135d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801362:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801367:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80136c:	be 00 00 00 00       	mov    $0x0,%esi
+  801371:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801377:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801379:	48 85 c0             	test   %rax,%rax
+  80137c:	7f 06                	jg     801384 <sys_env_set_status+0x36>
+}
+  80137e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801382:	c9                   	leave
+  801383:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801384:	49 89 c0             	mov    %rax,%r8
+  801387:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80138c:	48 ba 70 31 80 00 00 	movabs $0x803170,%rdx
+  801393:	00 00 00 
+  801396:	be 26 00 00 00       	mov    $0x26,%esi
+  80139b:	48 bf 8f 31 80 00 00 	movabs $0x80318f,%rdi
+  8013a2:	00 00 00 
+  8013a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013aa:	49 b9 45 2b 80 00 00 	movabs $0x802b45,%r9
+  8013b1:	00 00 00 
+  8013b4:	41 ff d1             	call   *%r9
+
+00000000008013b7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013b7:	55                   	push   %rbp
+  8013b8:	48 89 e5             	mov    %rsp,%rbp
+  8013bb:	53                   	push   %rbx
+  8013bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8013c0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013c3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c6:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8013da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013e2:	48 85 c0             	test   %rax,%rax
+  8013e5:	7f 06                	jg     8013ed <sys_env_set_trapframe+0x36>
+}
+  8013e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013eb:	c9                   	leave
+  8013ec:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ed:	49 89 c0             	mov    %rax,%r8
+  8013f0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013f5:	48 ba 70 31 80 00 00 	movabs $0x803170,%rdx
+  8013fc:	00 00 00 
+  8013ff:	be 26 00 00 00       	mov    $0x26,%esi
+  801404:	48 bf 8f 31 80 00 00 	movabs $0x80318f,%rdi
+  80140b:	00 00 00 
+  80140e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801413:	49 b9 45 2b 80 00 00 	movabs $0x802b45,%r9
+  80141a:	00 00 00 
+  80141d:	41 ff d1             	call   *%r9
+
+0000000000801420 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801420:	55                   	push   %rbp
+  801421:	48 89 e5             	mov    %rsp,%rbp
+  801424:	53                   	push   %rbx
+  801425:	48 83 ec 08          	sub    $0x8,%rsp
+  801429:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80142c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80142f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801434:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801439:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143e:	be 00 00 00 00       	mov    $0x0,%esi
+  801443:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801449:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80144b:	48 85 c0             	test   %rax,%rax
+  80144e:	7f 06                	jg     801456 <sys_env_set_pgfault_upcall+0x36>
+}
+  801450:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801454:	c9                   	leave
+  801455:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801456:	49 89 c0             	mov    %rax,%r8
+  801459:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80145e:	48 ba 70 31 80 00 00 	movabs $0x803170,%rdx
+  801465:	00 00 00 
+  801468:	be 26 00 00 00       	mov    $0x26,%esi
+  80146d:	48 bf 8f 31 80 00 00 	movabs $0x80318f,%rdi
+  801474:	00 00 00 
+  801477:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147c:	49 b9 45 2b 80 00 00 	movabs $0x802b45,%r9
+  801483:	00 00 00 
+  801486:	41 ff d1             	call   *%r9
+
+0000000000801489 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801489:	55                   	push   %rbp
+  80148a:	48 89 e5             	mov    %rsp,%rbp
+  80148d:	53                   	push   %rbx
+  80148e:	89 f8                	mov    %edi,%eax
+  801490:	49 89 f1             	mov    %rsi,%r9
+  801493:	48 89 d3             	mov    %rdx,%rbx
+  801496:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801499:	49 63 f0             	movslq %r8d,%rsi
+  80149c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80149f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014a4:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ad:	cd 30                	int    $0x30
+}
+  8014af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b3:	c9                   	leave
+  8014b4:	c3                   	ret
+
+00000000008014b5 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8014b5:	55                   	push   %rbp
+  8014b6:	48 89 e5             	mov    %rsp,%rbp
+  8014b9:	53                   	push   %rbx
+  8014ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8014be:	48 89 fa             	mov    %rdi,%rdx
+  8014c1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c4:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ce:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014de:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014e0:	48 85 c0             	test   %rax,%rax
+  8014e3:	7f 06                	jg     8014eb <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e9:	c9                   	leave
+  8014ea:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014eb:	49 89 c0             	mov    %rax,%r8
+  8014ee:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014f3:	48 ba 70 31 80 00 00 	movabs $0x803170,%rdx
+  8014fa:	00 00 00 
+  8014fd:	be 26 00 00 00       	mov    $0x26,%esi
+  801502:	48 bf 8f 31 80 00 00 	movabs $0x80318f,%rdi
+  801509:	00 00 00 
+  80150c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801511:	49 b9 45 2b 80 00 00 	movabs $0x802b45,%r9
+  801518:	00 00 00 
+  80151b:	41 ff d1             	call   *%r9
+
+000000000080151e <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80151e:	55                   	push   %rbp
+  80151f:	48 89 e5             	mov    %rsp,%rbp
+  801522:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801523:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801528:	ba 00 00 00 00       	mov    $0x0,%edx
+  80152d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801532:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801537:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80153c:	be 00 00 00 00       	mov    $0x0,%esi
+  801541:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801547:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801549:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154d:	c9                   	leave
+  80154e:	c3                   	ret
+
+000000000080154f <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80154f:	55                   	push   %rbp
+  801550:	48 89 e5             	mov    %rsp,%rbp
+  801553:	53                   	push   %rbx
+  801554:	48 83 ec 08          	sub    $0x8,%rsp
+  801558:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  80155b:	48 63 ce             	movslq %esi,%rcx
+  80155e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801561:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801566:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80156b:	be 00 00 00 00       	mov    $0x0,%esi
+  801570:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801576:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801578:	48 85 c0             	test   %rax,%rax
+  80157b:	7f 06                	jg     801583 <sys_sigqueue+0x34>
+}
+  80157d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801581:	c9                   	leave
+  801582:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801583:	49 89 c0             	mov    %rax,%r8
+  801586:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80158b:	48 ba 70 31 80 00 00 	movabs $0x803170,%rdx
+  801592:	00 00 00 
+  801595:	be 26 00 00 00       	mov    $0x26,%esi
+  80159a:	48 bf 8f 31 80 00 00 	movabs $0x80318f,%rdi
+  8015a1:	00 00 00 
+  8015a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a9:	49 b9 45 2b 80 00 00 	movabs $0x802b45,%r9
+  8015b0:	00 00 00 
+  8015b3:	41 ff d1             	call   *%r9
+
+00000000008015b6 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8015b6:	55                   	push   %rbp
+  8015b7:	48 89 e5             	mov    %rsp,%rbp
+  8015ba:	53                   	push   %rbx
+  8015bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8015bf:	48 89 fa             	mov    %rdi,%rdx
+  8015c2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c5:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015cf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015df:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015e1:	48 85 c0             	test   %rax,%rax
+  8015e4:	7f 06                	jg     8015ec <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  8015e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ea:	c9                   	leave
+  8015eb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ec:	49 89 c0             	mov    %rax,%r8
+  8015ef:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8015f4:	48 ba 70 31 80 00 00 	movabs $0x803170,%rdx
+  8015fb:	00 00 00 
+  8015fe:	be 26 00 00 00       	mov    $0x26,%esi
+  801603:	48 bf 8f 31 80 00 00 	movabs $0x80318f,%rdi
+  80160a:	00 00 00 
+  80160d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801612:	49 b9 45 2b 80 00 00 	movabs $0x802b45,%r9
+  801619:	00 00 00 
+  80161c:	41 ff d1             	call   *%r9
+
+000000000080161f <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80161f:	55                   	push   %rbp
+  801620:	48 89 e5             	mov    %rsp,%rbp
+  801623:	53                   	push   %rbx
+  801624:	48 83 ec 08          	sub    $0x8,%rsp
+  801628:	48 89 f1             	mov    %rsi,%rcx
+  80162b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80162e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801631:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801636:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80163b:	be 00 00 00 00       	mov    $0x0,%esi
+  801640:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801646:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801648:	48 85 c0             	test   %rax,%rax
+  80164b:	7f 06                	jg     801653 <sys_sigaction+0x34>
+}
+  80164d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801651:	c9                   	leave
+  801652:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801653:	49 89 c0             	mov    %rax,%r8
+  801656:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80165b:	48 ba 70 31 80 00 00 	movabs $0x803170,%rdx
+  801662:	00 00 00 
+  801665:	be 26 00 00 00       	mov    $0x26,%esi
+  80166a:	48 bf 8f 31 80 00 00 	movabs $0x80318f,%rdi
+  801671:	00 00 00 
+  801674:	b8 00 00 00 00       	mov    $0x0,%eax
+  801679:	49 b9 45 2b 80 00 00 	movabs $0x802b45,%r9
+  801680:	00 00 00 
+  801683:	41 ff d1             	call   *%r9
+
+0000000000801686 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801686:	55                   	push   %rbp
+  801687:	48 89 e5             	mov    %rsp,%rbp
+  80168a:	53                   	push   %rbx
+  80168b:	48 83 ec 08          	sub    $0x8,%rsp
+  80168f:	48 89 f1             	mov    %rsi,%rcx
+  801692:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801695:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801698:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80169d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8016a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ad:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016af:	48 85 c0             	test   %rax,%rax
+  8016b2:	7f 06                	jg     8016ba <sys_sigprocmask+0x34>
+}
+  8016b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016b8:	c9                   	leave
+  8016b9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ba:	49 89 c0             	mov    %rax,%r8
+  8016bd:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8016c2:	48 ba 70 31 80 00 00 	movabs $0x803170,%rdx
+  8016c9:	00 00 00 
+  8016cc:	be 26 00 00 00       	mov    $0x26,%esi
+  8016d1:	48 bf 8f 31 80 00 00 	movabs $0x80318f,%rdi
+  8016d8:	00 00 00 
+  8016db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e0:	49 b9 45 2b 80 00 00 	movabs $0x802b45,%r9
+  8016e7:	00 00 00 
+  8016ea:	41 ff d1             	call   *%r9
+
+00000000008016ed <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8016ed:	55                   	push   %rbp
+  8016ee:	48 89 e5             	mov    %rsp,%rbp
+  8016f1:	41 54                	push   %r12
+  8016f3:	53                   	push   %rbx
+  8016f4:	48 89 fb             	mov    %rdi,%rbx
+  8016f7:	48 89 f7             	mov    %rsi,%rdi
+  8016fa:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8016fd:	48 85 f6             	test   %rsi,%rsi
+  801700:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801707:	00 00 00 
+  80170a:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  80170e:	be 00 10 00 00       	mov    $0x1000,%esi
+  801713:	48 b8 b5 14 80 00 00 	movabs $0x8014b5,%rax
+  80171a:	00 00 00 
+  80171d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80171f:	85 c0                	test   %eax,%eax
+  801721:	78 45                	js     801768 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  801723:	48 85 db             	test   %rbx,%rbx
+  801726:	74 12                	je     80173a <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  801728:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80172f:	00 00 00 
+  801732:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  801738:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  80173a:	4d 85 e4             	test   %r12,%r12
+  80173d:	74 14                	je     801753 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  80173f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801746:	00 00 00 
+  801749:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  80174f:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  801753:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80175a:	00 00 00 
+  80175d:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  801763:	5b                   	pop    %rbx
+  801764:	41 5c                	pop    %r12
+  801766:	5d                   	pop    %rbp
+  801767:	c3                   	ret
+        if (from_env_store)
+  801768:	48 85 db             	test   %rbx,%rbx
+  80176b:	74 06                	je     801773 <ipc_recv+0x86>
+            *from_env_store = 0;
+  80176d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  801773:	4d 85 e4             	test   %r12,%r12
+  801776:	74 eb                	je     801763 <ipc_recv+0x76>
+            *perm_store = 0;
+  801778:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80177f:	00 
+  801780:	eb e1                	jmp    801763 <ipc_recv+0x76>
+
+0000000000801782 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801782:	55                   	push   %rbp
+  801783:	48 89 e5             	mov    %rsp,%rbp
+  801786:	41 57                	push   %r15
+  801788:	41 56                	push   %r14
+  80178a:	41 55                	push   %r13
+  80178c:	41 54                	push   %r12
+  80178e:	53                   	push   %rbx
+  80178f:	48 83 ec 18          	sub    $0x18,%rsp
+  801793:	41 89 fd             	mov    %edi,%r13d
+  801796:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  801799:	48 89 d3             	mov    %rdx,%rbx
+  80179c:	49 89 cc             	mov    %rcx,%r12
+  80179f:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8017a3:	48 85 d2             	test   %rdx,%rdx
+  8017a6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8017ad:	00 00 00 
+  8017b0:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8017b4:	49 be 89 14 80 00 00 	movabs $0x801489,%r14
+  8017bb:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  8017be:	49 bf bc 10 80 00 00 	movabs $0x8010bc,%r15
+  8017c5:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8017c8:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8017cb:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8017cf:	4c 89 e1             	mov    %r12,%rcx
+  8017d2:	48 89 da             	mov    %rbx,%rdx
+  8017d5:	44 89 ef             	mov    %r13d,%edi
+  8017d8:	41 ff d6             	call   *%r14
+        if (res == 0)
+  8017db:	85 c0                	test   %eax,%eax
+  8017dd:	74 34                	je     801813 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  8017df:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8017e2:	75 05                	jne    8017e9 <ipc_send+0x67>
+        sys_yield();
+  8017e4:	41 ff d7             	call   *%r15
+    while (true) {
+  8017e7:	eb df                	jmp    8017c8 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  8017e9:	48 ba 9d 31 80 00 00 	movabs $0x80319d,%rdx
+  8017f0:	00 00 00 
+  8017f3:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8017f8:	48 bf b6 31 80 00 00 	movabs $0x8031b6,%rdi
+  8017ff:	00 00 00 
+  801802:	b8 00 00 00 00       	mov    $0x0,%eax
+  801807:	48 b9 45 2b 80 00 00 	movabs $0x802b45,%rcx
+  80180e:	00 00 00 
+  801811:	ff d1                	call   *%rcx
+    }
+}
+  801813:	48 83 c4 18          	add    $0x18,%rsp
+  801817:	5b                   	pop    %rbx
+  801818:	41 5c                	pop    %r12
+  80181a:	41 5d                	pop    %r13
+  80181c:	41 5e                	pop    %r14
+  80181e:	41 5f                	pop    %r15
+  801820:	5d                   	pop    %rbp
+  801821:	c3                   	ret
+
+0000000000801822 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801822:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  801827:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80182e:	00 00 00 
+  801831:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  801838:	48 01 ca             	add    %rcx,%rdx
+  80183b:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  801841:	39 fa                	cmp    %edi,%edx
+  801843:	74 12                	je     801857 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  801845:	48 83 c0 01          	add    $0x1,%rax
+  801849:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80184f:	75 e0                	jne    801831 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801851:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801856:	c3                   	ret
+            return envs[i].env_id;
+  801857:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80185e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801865:	00 00 00 
+  801868:	48 01 d0             	add    %rdx,%rax
+  80186b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801871:	c3                   	ret
+
+0000000000801872 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801872:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801879:	ff ff ff 
+  80187c:	48 01 f8             	add    %rdi,%rax
+  80187f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801883:	c3                   	ret
+
+0000000000801884 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801884:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80188b:	ff ff ff 
+  80188e:	48 01 f8             	add    %rdi,%rax
+  801891:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801895:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80189b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80189f:	c3                   	ret
+
+00000000008018a0 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8018a0:	55                   	push   %rbp
+  8018a1:	48 89 e5             	mov    %rsp,%rbp
+  8018a4:	41 57                	push   %r15
+  8018a6:	41 56                	push   %r14
+  8018a8:	41 55                	push   %r13
+  8018aa:	41 54                	push   %r12
+  8018ac:	53                   	push   %rbx
+  8018ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8018b1:	49 89 ff             	mov    %rdi,%r15
+  8018b4:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8018b9:	49 bd 1e 28 80 00 00 	movabs $0x80281e,%r13
+  8018c0:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8018c3:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8018c9:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8018cc:	48 89 df             	mov    %rbx,%rdi
+  8018cf:	41 ff d5             	call   *%r13
+  8018d2:	83 e0 04             	and    $0x4,%eax
+  8018d5:	74 17                	je     8018ee <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8018d7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018de:	4c 39 f3             	cmp    %r14,%rbx
+  8018e1:	75 e6                	jne    8018c9 <fd_alloc+0x29>
+  8018e3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8018e9:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8018ee:	4d 89 27             	mov    %r12,(%r15)
+}
+  8018f1:	48 83 c4 08          	add    $0x8,%rsp
+  8018f5:	5b                   	pop    %rbx
+  8018f6:	41 5c                	pop    %r12
+  8018f8:	41 5d                	pop    %r13
+  8018fa:	41 5e                	pop    %r14
+  8018fc:	41 5f                	pop    %r15
+  8018fe:	5d                   	pop    %rbp
+  8018ff:	c3                   	ret
+
+0000000000801900 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801900:	83 ff 1f             	cmp    $0x1f,%edi
+  801903:	77 39                	ja     80193e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801905:	55                   	push   %rbp
+  801906:	48 89 e5             	mov    %rsp,%rbp
+  801909:	41 54                	push   %r12
+  80190b:	53                   	push   %rbx
+  80190c:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80190f:	48 63 df             	movslq %edi,%rbx
+  801912:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801919:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80191d:	48 89 df             	mov    %rbx,%rdi
+  801920:	48 b8 1e 28 80 00 00 	movabs $0x80281e,%rax
+  801927:	00 00 00 
+  80192a:	ff d0                	call   *%rax
+  80192c:	a8 04                	test   $0x4,%al
+  80192e:	74 14                	je     801944 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801930:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801934:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801939:	5b                   	pop    %rbx
+  80193a:	41 5c                	pop    %r12
+  80193c:	5d                   	pop    %rbp
+  80193d:	c3                   	ret
+        return -E_INVAL;
+  80193e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801943:	c3                   	ret
+        return -E_INVAL;
+  801944:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801949:	eb ee                	jmp    801939 <fd_lookup+0x39>
+
+000000000080194b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80194b:	55                   	push   %rbp
+  80194c:	48 89 e5             	mov    %rsp,%rbp
+  80194f:	41 54                	push   %r12
+  801951:	53                   	push   %rbx
+  801952:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801955:	48 b8 40 32 80 00 00 	movabs $0x803240,%rax
+  80195c:	00 00 00 
+  80195f:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801966:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801969:	39 3b                	cmp    %edi,(%rbx)
+  80196b:	74 47                	je     8019b4 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80196d:	48 83 c0 08          	add    $0x8,%rax
+  801971:	48 8b 18             	mov    (%rax),%rbx
+  801974:	48 85 db             	test   %rbx,%rbx
+  801977:	75 f0                	jne    801969 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801979:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801980:	00 00 00 
+  801983:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801989:	89 fa                	mov    %edi,%edx
+  80198b:	48 bf c0 31 80 00 00 	movabs $0x8031c0,%rdi
+  801992:	00 00 00 
+  801995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199a:	48 b9 76 02 80 00 00 	movabs $0x800276,%rcx
+  8019a1:	00 00 00 
+  8019a4:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8019a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8019ab:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8019af:	5b                   	pop    %rbx
+  8019b0:	41 5c                	pop    %r12
+  8019b2:	5d                   	pop    %rbp
+  8019b3:	c3                   	ret
+            return 0;
+  8019b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b9:	eb f0                	jmp    8019ab <dev_lookup+0x60>
+
+00000000008019bb <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8019bb:	55                   	push   %rbp
+  8019bc:	48 89 e5             	mov    %rsp,%rbp
+  8019bf:	41 55                	push   %r13
+  8019c1:	41 54                	push   %r12
+  8019c3:	53                   	push   %rbx
+  8019c4:	48 83 ec 18          	sub    $0x18,%rsp
+  8019c8:	48 89 fb             	mov    %rdi,%rbx
+  8019cb:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019ce:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8019d5:	ff ff ff 
+  8019d8:	48 01 df             	add    %rbx,%rdi
+  8019db:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8019df:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019e3:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  8019ea:	00 00 00 
+  8019ed:	ff d0                	call   *%rax
+  8019ef:	41 89 c5             	mov    %eax,%r13d
+  8019f2:	85 c0                	test   %eax,%eax
+  8019f4:	78 06                	js     8019fc <fd_close+0x41>
+  8019f6:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8019fa:	74 1a                	je     801a16 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8019fc:	45 84 e4             	test   %r12b,%r12b
+  8019ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a04:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a08:	44 89 e8             	mov    %r13d,%eax
+  801a0b:	48 83 c4 18          	add    $0x18,%rsp
+  801a0f:	5b                   	pop    %rbx
+  801a10:	41 5c                	pop    %r12
+  801a12:	41 5d                	pop    %r13
+  801a14:	5d                   	pop    %rbp
+  801a15:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a16:	8b 3b                	mov    (%rbx),%edi
+  801a18:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a1c:	48 b8 4b 19 80 00 00 	movabs $0x80194b,%rax
+  801a23:	00 00 00 
+  801a26:	ff d0                	call   *%rax
+  801a28:	41 89 c5             	mov    %eax,%r13d
+  801a2b:	85 c0                	test   %eax,%eax
+  801a2d:	78 1b                	js     801a4a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a2f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a33:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801a37:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a3d:	48 85 c0             	test   %rax,%rax
+  801a40:	74 08                	je     801a4a <fd_close+0x8f>
+  801a42:	48 89 df             	mov    %rbx,%rdi
+  801a45:	ff d0                	call   *%rax
+  801a47:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a4a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a4f:	48 89 de             	mov    %rbx,%rsi
+  801a52:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a57:	48 b8 17 12 80 00 00 	movabs $0x801217,%rax
+  801a5e:	00 00 00 
+  801a61:	ff d0                	call   *%rax
+    return res;
+  801a63:	eb a3                	jmp    801a08 <fd_close+0x4d>
+
+0000000000801a65 <close>:
+
+int
+close(int fdnum) {
+  801a65:	55                   	push   %rbp
+  801a66:	48 89 e5             	mov    %rsp,%rbp
+  801a69:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a6d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a71:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  801a78:	00 00 00 
+  801a7b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a7d:	85 c0                	test   %eax,%eax
+  801a7f:	78 15                	js     801a96 <close+0x31>
+
+    return fd_close(fd, 1);
+  801a81:	be 01 00 00 00       	mov    $0x1,%esi
+  801a86:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a8a:	48 b8 bb 19 80 00 00 	movabs $0x8019bb,%rax
+  801a91:	00 00 00 
+  801a94:	ff d0                	call   *%rax
+}
+  801a96:	c9                   	leave
+  801a97:	c3                   	ret
+
+0000000000801a98 <close_all>:
+
+void
+close_all(void) {
+  801a98:	55                   	push   %rbp
+  801a99:	48 89 e5             	mov    %rsp,%rbp
+  801a9c:	41 54                	push   %r12
+  801a9e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aa4:	49 bc 65 1a 80 00 00 	movabs $0x801a65,%r12
+  801aab:	00 00 00 
+  801aae:	89 df                	mov    %ebx,%edi
+  801ab0:	41 ff d4             	call   *%r12
+  801ab3:	83 c3 01             	add    $0x1,%ebx
+  801ab6:	83 fb 20             	cmp    $0x20,%ebx
+  801ab9:	75 f3                	jne    801aae <close_all+0x16>
+}
+  801abb:	5b                   	pop    %rbx
+  801abc:	41 5c                	pop    %r12
+  801abe:	5d                   	pop    %rbp
+  801abf:	c3                   	ret
+
+0000000000801ac0 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801ac0:	55                   	push   %rbp
+  801ac1:	48 89 e5             	mov    %rsp,%rbp
+  801ac4:	41 57                	push   %r15
+  801ac6:	41 56                	push   %r14
+  801ac8:	41 55                	push   %r13
+  801aca:	41 54                	push   %r12
+  801acc:	53                   	push   %rbx
+  801acd:	48 83 ec 18          	sub    $0x18,%rsp
+  801ad1:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801ad4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ad8:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  801adf:	00 00 00 
+  801ae2:	ff d0                	call   *%rax
+  801ae4:	89 c3                	mov    %eax,%ebx
+  801ae6:	85 c0                	test   %eax,%eax
+  801ae8:	0f 88 b8 00 00 00    	js     801ba6 <dup+0xe6>
+    close(newfdnum);
+  801aee:	44 89 e7             	mov    %r12d,%edi
+  801af1:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  801af8:	00 00 00 
+  801afb:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801afd:	4d 63 ec             	movslq %r12d,%r13
+  801b00:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801b07:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801b0b:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b0f:	4c 89 ff             	mov    %r15,%rdi
+  801b12:	49 be 84 18 80 00 00 	movabs $0x801884,%r14
+  801b19:	00 00 00 
+  801b1c:	41 ff d6             	call   *%r14
+  801b1f:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b22:	4c 89 ef             	mov    %r13,%rdi
+  801b25:	41 ff d6             	call   *%r14
+  801b28:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b2b:	48 89 df             	mov    %rbx,%rdi
+  801b2e:	48 b8 1e 28 80 00 00 	movabs $0x80281e,%rax
+  801b35:	00 00 00 
+  801b38:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801b3a:	a8 04                	test   $0x4,%al
+  801b3c:	74 2b                	je     801b69 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801b3e:	41 89 c1             	mov    %eax,%r9d
+  801b41:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b47:	4c 89 f1             	mov    %r14,%rcx
+  801b4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b4f:	48 89 de             	mov    %rbx,%rsi
+  801b52:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b57:	48 b8 b2 11 80 00 00 	movabs $0x8011b2,%rax
+  801b5e:	00 00 00 
+  801b61:	ff d0                	call   *%rax
+  801b63:	89 c3                	mov    %eax,%ebx
+  801b65:	85 c0                	test   %eax,%eax
+  801b67:	78 4e                	js     801bb7 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801b69:	4c 89 ff             	mov    %r15,%rdi
+  801b6c:	48 b8 1e 28 80 00 00 	movabs $0x80281e,%rax
+  801b73:	00 00 00 
+  801b76:	ff d0                	call   *%rax
+  801b78:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b7b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b81:	4c 89 e9             	mov    %r13,%rcx
+  801b84:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b89:	4c 89 fe             	mov    %r15,%rsi
+  801b8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b91:	48 b8 b2 11 80 00 00 	movabs $0x8011b2,%rax
+  801b98:	00 00 00 
+  801b9b:	ff d0                	call   *%rax
+  801b9d:	89 c3                	mov    %eax,%ebx
+  801b9f:	85 c0                	test   %eax,%eax
+  801ba1:	78 14                	js     801bb7 <dup+0xf7>
+
+    return newfdnum;
+  801ba3:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ba6:	89 d8                	mov    %ebx,%eax
+  801ba8:	48 83 c4 18          	add    $0x18,%rsp
+  801bac:	5b                   	pop    %rbx
+  801bad:	41 5c                	pop    %r12
+  801baf:	41 5d                	pop    %r13
+  801bb1:	41 5e                	pop    %r14
+  801bb3:	41 5f                	pop    %r15
+  801bb5:	5d                   	pop    %rbp
+  801bb6:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801bb7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bbc:	4c 89 ee             	mov    %r13,%rsi
+  801bbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bc4:	49 bc 17 12 80 00 00 	movabs $0x801217,%r12
+  801bcb:	00 00 00 
+  801bce:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801bd1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bd6:	4c 89 f6             	mov    %r14,%rsi
+  801bd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bde:	41 ff d4             	call   *%r12
+    return res;
+  801be1:	eb c3                	jmp    801ba6 <dup+0xe6>
+
+0000000000801be3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801be3:	55                   	push   %rbp
+  801be4:	48 89 e5             	mov    %rsp,%rbp
+  801be7:	41 56                	push   %r14
+  801be9:	41 55                	push   %r13
+  801beb:	41 54                	push   %r12
+  801bed:	53                   	push   %rbx
+  801bee:	48 83 ec 10          	sub    $0x10,%rsp
+  801bf2:	89 fb                	mov    %edi,%ebx
+  801bf4:	49 89 f4             	mov    %rsi,%r12
+  801bf7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bfa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bfe:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  801c05:	00 00 00 
+  801c08:	ff d0                	call   *%rax
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	78 4c                	js     801c5a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c0e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c12:	41 8b 3e             	mov    (%r14),%edi
+  801c15:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c19:	48 b8 4b 19 80 00 00 	movabs $0x80194b,%rax
+  801c20:	00 00 00 
+  801c23:	ff d0                	call   *%rax
+  801c25:	85 c0                	test   %eax,%eax
+  801c27:	78 35                	js     801c5e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c29:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c2d:	83 e0 03             	and    $0x3,%eax
+  801c30:	83 f8 01             	cmp    $0x1,%eax
+  801c33:	74 2d                	je     801c62 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c35:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c39:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c3d:	48 85 c0             	test   %rax,%rax
+  801c40:	74 56                	je     801c98 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c42:	4c 89 ea             	mov    %r13,%rdx
+  801c45:	4c 89 e6             	mov    %r12,%rsi
+  801c48:	4c 89 f7             	mov    %r14,%rdi
+  801c4b:	ff d0                	call   *%rax
+}
+  801c4d:	48 83 c4 10          	add    $0x10,%rsp
+  801c51:	5b                   	pop    %rbx
+  801c52:	41 5c                	pop    %r12
+  801c54:	41 5d                	pop    %r13
+  801c56:	41 5e                	pop    %r14
+  801c58:	5d                   	pop    %rbp
+  801c59:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c5a:	48 98                	cltq
+  801c5c:	eb ef                	jmp    801c4d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c5e:	48 98                	cltq
+  801c60:	eb eb                	jmp    801c4d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c62:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c69:	00 00 00 
+  801c6c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c72:	89 da                	mov    %ebx,%edx
+  801c74:	48 bf 01 32 80 00 00 	movabs $0x803201,%rdi
+  801c7b:	00 00 00 
+  801c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c83:	48 b9 76 02 80 00 00 	movabs $0x800276,%rcx
+  801c8a:	00 00 00 
+  801c8d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c8f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c96:	eb b5                	jmp    801c4d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c98:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c9f:	eb ac                	jmp    801c4d <read+0x6a>
+
+0000000000801ca1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801ca1:	55                   	push   %rbp
+  801ca2:	48 89 e5             	mov    %rsp,%rbp
+  801ca5:	41 57                	push   %r15
+  801ca7:	41 56                	push   %r14
+  801ca9:	41 55                	push   %r13
+  801cab:	41 54                	push   %r12
+  801cad:	53                   	push   %rbx
+  801cae:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801cb2:	48 85 d2             	test   %rdx,%rdx
+  801cb5:	74 54                	je     801d0b <readn+0x6a>
+  801cb7:	41 89 fd             	mov    %edi,%r13d
+  801cba:	49 89 f6             	mov    %rsi,%r14
+  801cbd:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801cc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801cc5:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801cca:	49 bf e3 1b 80 00 00 	movabs $0x801be3,%r15
+  801cd1:	00 00 00 
+  801cd4:	4c 89 e2             	mov    %r12,%rdx
+  801cd7:	48 29 f2             	sub    %rsi,%rdx
+  801cda:	4c 01 f6             	add    %r14,%rsi
+  801cdd:	44 89 ef             	mov    %r13d,%edi
+  801ce0:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801ce3:	85 c0                	test   %eax,%eax
+  801ce5:	78 20                	js     801d07 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ce7:	01 c3                	add    %eax,%ebx
+  801ce9:	85 c0                	test   %eax,%eax
+  801ceb:	74 08                	je     801cf5 <readn+0x54>
+  801ced:	48 63 f3             	movslq %ebx,%rsi
+  801cf0:	4c 39 e6             	cmp    %r12,%rsi
+  801cf3:	72 df                	jb     801cd4 <readn+0x33>
+    }
+    return res;
+  801cf5:	48 63 c3             	movslq %ebx,%rax
+}
+  801cf8:	48 83 c4 08          	add    $0x8,%rsp
+  801cfc:	5b                   	pop    %rbx
+  801cfd:	41 5c                	pop    %r12
+  801cff:	41 5d                	pop    %r13
+  801d01:	41 5e                	pop    %r14
+  801d03:	41 5f                	pop    %r15
+  801d05:	5d                   	pop    %rbp
+  801d06:	c3                   	ret
+        if (inc < 0) return inc;
+  801d07:	48 98                	cltq
+  801d09:	eb ed                	jmp    801cf8 <readn+0x57>
+    int inc = 1, res = 0;
+  801d0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d10:	eb e3                	jmp    801cf5 <readn+0x54>
+
+0000000000801d12 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d12:	55                   	push   %rbp
+  801d13:	48 89 e5             	mov    %rsp,%rbp
+  801d16:	41 56                	push   %r14
+  801d18:	41 55                	push   %r13
+  801d1a:	41 54                	push   %r12
+  801d1c:	53                   	push   %rbx
+  801d1d:	48 83 ec 10          	sub    $0x10,%rsp
+  801d21:	89 fb                	mov    %edi,%ebx
+  801d23:	49 89 f4             	mov    %rsi,%r12
+  801d26:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d29:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d2d:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  801d34:	00 00 00 
+  801d37:	ff d0                	call   *%rax
+  801d39:	85 c0                	test   %eax,%eax
+  801d3b:	78 47                	js     801d84 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d3d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d41:	41 8b 3e             	mov    (%r14),%edi
+  801d44:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d48:	48 b8 4b 19 80 00 00 	movabs $0x80194b,%rax
+  801d4f:	00 00 00 
+  801d52:	ff d0                	call   *%rax
+  801d54:	85 c0                	test   %eax,%eax
+  801d56:	78 30                	js     801d88 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d58:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d5d:	74 2d                	je     801d8c <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d5f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d63:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d67:	48 85 c0             	test   %rax,%rax
+  801d6a:	74 56                	je     801dc2 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801d6c:	4c 89 ea             	mov    %r13,%rdx
+  801d6f:	4c 89 e6             	mov    %r12,%rsi
+  801d72:	4c 89 f7             	mov    %r14,%rdi
+  801d75:	ff d0                	call   *%rax
+}
+  801d77:	48 83 c4 10          	add    $0x10,%rsp
+  801d7b:	5b                   	pop    %rbx
+  801d7c:	41 5c                	pop    %r12
+  801d7e:	41 5d                	pop    %r13
+  801d80:	41 5e                	pop    %r14
+  801d82:	5d                   	pop    %rbp
+  801d83:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d84:	48 98                	cltq
+  801d86:	eb ef                	jmp    801d77 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d88:	48 98                	cltq
+  801d8a:	eb eb                	jmp    801d77 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d8c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d93:	00 00 00 
+  801d96:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d9c:	89 da                	mov    %ebx,%edx
+  801d9e:	48 bf 1d 32 80 00 00 	movabs $0x80321d,%rdi
+  801da5:	00 00 00 
+  801da8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dad:	48 b9 76 02 80 00 00 	movabs $0x800276,%rcx
+  801db4:	00 00 00 
+  801db7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801db9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dc0:	eb b5                	jmp    801d77 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dc2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dc9:	eb ac                	jmp    801d77 <write+0x65>
+
+0000000000801dcb <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801dcb:	55                   	push   %rbp
+  801dcc:	48 89 e5             	mov    %rsp,%rbp
+  801dcf:	53                   	push   %rbx
+  801dd0:	48 83 ec 18          	sub    $0x18,%rsp
+  801dd4:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dd6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dda:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  801de1:	00 00 00 
+  801de4:	ff d0                	call   *%rax
+  801de6:	85 c0                	test   %eax,%eax
+  801de8:	78 0c                	js     801df6 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801dea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dee:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801df1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801df6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dfa:	c9                   	leave
+  801dfb:	c3                   	ret
+
+0000000000801dfc <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801dfc:	55                   	push   %rbp
+  801dfd:	48 89 e5             	mov    %rsp,%rbp
+  801e00:	41 55                	push   %r13
+  801e02:	41 54                	push   %r12
+  801e04:	53                   	push   %rbx
+  801e05:	48 83 ec 18          	sub    $0x18,%rsp
+  801e09:	89 fb                	mov    %edi,%ebx
+  801e0b:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e0e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e12:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  801e19:	00 00 00 
+  801e1c:	ff d0                	call   *%rax
+  801e1e:	85 c0                	test   %eax,%eax
+  801e20:	78 38                	js     801e5a <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e22:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e26:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e2a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e2e:	48 b8 4b 19 80 00 00 	movabs $0x80194b,%rax
+  801e35:	00 00 00 
+  801e38:	ff d0                	call   *%rax
+  801e3a:	85 c0                	test   %eax,%eax
+  801e3c:	78 1c                	js     801e5a <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e3e:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e43:	74 20                	je     801e65 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e45:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e49:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801e4d:	48 85 c0             	test   %rax,%rax
+  801e50:	74 47                	je     801e99 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e52:	44 89 e6             	mov    %r12d,%esi
+  801e55:	4c 89 ef             	mov    %r13,%rdi
+  801e58:	ff d0                	call   *%rax
+}
+  801e5a:	48 83 c4 18          	add    $0x18,%rsp
+  801e5e:	5b                   	pop    %rbx
+  801e5f:	41 5c                	pop    %r12
+  801e61:	41 5d                	pop    %r13
+  801e63:	5d                   	pop    %rbp
+  801e64:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801e65:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e6c:	00 00 00 
+  801e6f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e75:	89 da                	mov    %ebx,%edx
+  801e77:	48 bf e0 31 80 00 00 	movabs $0x8031e0,%rdi
+  801e7e:	00 00 00 
+  801e81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e86:	48 b9 76 02 80 00 00 	movabs $0x800276,%rcx
+  801e8d:	00 00 00 
+  801e90:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e92:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e97:	eb c1                	jmp    801e5a <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e99:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e9e:	eb ba                	jmp    801e5a <ftruncate+0x5e>
+
+0000000000801ea0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801ea0:	55                   	push   %rbp
+  801ea1:	48 89 e5             	mov    %rsp,%rbp
+  801ea4:	41 54                	push   %r12
+  801ea6:	53                   	push   %rbx
+  801ea7:	48 83 ec 10          	sub    $0x10,%rsp
+  801eab:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eae:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801eb2:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  801eb9:	00 00 00 
+  801ebc:	ff d0                	call   *%rax
+  801ebe:	85 c0                	test   %eax,%eax
+  801ec0:	78 4e                	js     801f10 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ec2:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ec6:	41 8b 3c 24          	mov    (%r12),%edi
+  801eca:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ece:	48 b8 4b 19 80 00 00 	movabs $0x80194b,%rax
+  801ed5:	00 00 00 
+  801ed8:	ff d0                	call   *%rax
+  801eda:	85 c0                	test   %eax,%eax
+  801edc:	78 32                	js     801f10 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ede:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ee2:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801ee7:	74 30                	je     801f19 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801ee9:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801eec:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801ef3:	00 00 00 
+    stat->st_isdir = 0;
+  801ef6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801efd:	00 00 00 
+    stat->st_dev = dev;
+  801f00:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f07:	48 89 de             	mov    %rbx,%rsi
+  801f0a:	4c 89 e7             	mov    %r12,%rdi
+  801f0d:	ff 50 28             	call   *0x28(%rax)
+}
+  801f10:	48 83 c4 10          	add    $0x10,%rsp
+  801f14:	5b                   	pop    %rbx
+  801f15:	41 5c                	pop    %r12
+  801f17:	5d                   	pop    %rbp
+  801f18:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f19:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f1e:	eb f0                	jmp    801f10 <fstat+0x70>
+
+0000000000801f20 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f20:	55                   	push   %rbp
+  801f21:	48 89 e5             	mov    %rsp,%rbp
+  801f24:	41 54                	push   %r12
+  801f26:	53                   	push   %rbx
+  801f27:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f2a:	be 00 00 00 00       	mov    $0x0,%esi
+  801f2f:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  801f36:	00 00 00 
+  801f39:	ff d0                	call   *%rax
+  801f3b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f3d:	85 c0                	test   %eax,%eax
+  801f3f:	78 25                	js     801f66 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f41:	4c 89 e6             	mov    %r12,%rsi
+  801f44:	89 c7                	mov    %eax,%edi
+  801f46:	48 b8 a0 1e 80 00 00 	movabs $0x801ea0,%rax
+  801f4d:	00 00 00 
+  801f50:	ff d0                	call   *%rax
+  801f52:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f55:	89 df                	mov    %ebx,%edi
+  801f57:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  801f5e:	00 00 00 
+  801f61:	ff d0                	call   *%rax
+
+    return res;
+  801f63:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f66:	89 d8                	mov    %ebx,%eax
+  801f68:	5b                   	pop    %rbx
+  801f69:	41 5c                	pop    %r12
+  801f6b:	5d                   	pop    %rbp
+  801f6c:	c3                   	ret
+
+0000000000801f6d <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801f6d:	55                   	push   %rbp
+  801f6e:	48 89 e5             	mov    %rsp,%rbp
+  801f71:	41 54                	push   %r12
+  801f73:	53                   	push   %rbx
+  801f74:	48 83 ec 10          	sub    $0x10,%rsp
+  801f78:	41 89 fc             	mov    %edi,%r12d
+  801f7b:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f7e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801f85:	00 00 00 
+  801f88:	83 38 00             	cmpl   $0x0,(%rax)
+  801f8b:	74 5e                	je     801feb <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801f8d:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801f93:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801f98:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801f9f:	00 00 00 
+  801fa2:	44 89 e6             	mov    %r12d,%esi
+  801fa5:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801fac:	00 00 00 
+  801faf:	8b 38                	mov    (%rax),%edi
+  801fb1:	48 b8 82 17 80 00 00 	movabs $0x801782,%rax
+  801fb8:	00 00 00 
+  801fbb:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801fbd:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801fc4:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801fc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fca:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801fce:	48 89 de             	mov    %rbx,%rsi
+  801fd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fd6:	48 b8 ed 16 80 00 00 	movabs $0x8016ed,%rax
+  801fdd:	00 00 00 
+  801fe0:	ff d0                	call   *%rax
+}
+  801fe2:	48 83 c4 10          	add    $0x10,%rsp
+  801fe6:	5b                   	pop    %rbx
+  801fe7:	41 5c                	pop    %r12
+  801fe9:	5d                   	pop    %rbp
+  801fea:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801feb:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ff0:	48 b8 22 18 80 00 00 	movabs $0x801822,%rax
+  801ff7:	00 00 00 
+  801ffa:	ff d0                	call   *%rax
+  801ffc:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802003:	00 00 
+  802005:	eb 86                	jmp    801f8d <fsipc+0x20>
+
+0000000000802007 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802007:	55                   	push   %rbp
+  802008:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80200b:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802012:	00 00 00 
+  802015:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802018:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80201a:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80201d:	be 00 00 00 00       	mov    $0x0,%esi
+  802022:	bf 02 00 00 00       	mov    $0x2,%edi
+  802027:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  80202e:	00 00 00 
+  802031:	ff d0                	call   *%rax
+}
+  802033:	5d                   	pop    %rbp
+  802034:	c3                   	ret
+
+0000000000802035 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802035:	55                   	push   %rbp
+  802036:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802039:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80203c:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802043:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802045:	be 00 00 00 00       	mov    $0x0,%esi
+  80204a:	bf 06 00 00 00       	mov    $0x6,%edi
+  80204f:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  802056:	00 00 00 
+  802059:	ff d0                	call   *%rax
+}
+  80205b:	5d                   	pop    %rbp
+  80205c:	c3                   	ret
+
+000000000080205d <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80205d:	55                   	push   %rbp
+  80205e:	48 89 e5             	mov    %rsp,%rbp
+  802061:	41 54                	push   %r12
+  802063:	53                   	push   %rbx
+  802064:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802067:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80206a:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802071:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802073:	be 00 00 00 00       	mov    $0x0,%esi
+  802078:	bf 05 00 00 00       	mov    $0x5,%edi
+  80207d:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  802084:	00 00 00 
+  802087:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802089:	85 c0                	test   %eax,%eax
+  80208b:	78 3d                	js     8020ca <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80208d:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802094:	00 00 00 
+  802097:	4c 89 e6             	mov    %r12,%rsi
+  80209a:	48 89 df             	mov    %rbx,%rdi
+  80209d:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  8020a4:	00 00 00 
+  8020a7:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8020a9:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8020b0:	00 
+  8020b1:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020b7:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8020be:	00 
+  8020bf:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8020c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020ca:	5b                   	pop    %rbx
+  8020cb:	41 5c                	pop    %r12
+  8020cd:	5d                   	pop    %rbp
+  8020ce:	c3                   	ret
+
+00000000008020cf <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8020cf:	55                   	push   %rbp
+  8020d0:	48 89 e5             	mov    %rsp,%rbp
+  8020d3:	41 54                	push   %r12
+  8020d5:	53                   	push   %rbx
+  8020d6:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8020d9:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8020de:	48 39 c2             	cmp    %rax,%rdx
+  8020e1:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8020e5:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8020e8:	48 89 c2             	mov    %rax,%rdx
+  8020eb:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8020f2:	00 00 00 
+  8020f5:	48 b8 fc 0d 80 00 00 	movabs $0x800dfc,%rax
+  8020fc:	00 00 00 
+  8020ff:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802101:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802108:	00 00 00 
+  80210b:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802110:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802112:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  802116:	be 00 00 00 00       	mov    $0x0,%esi
+  80211b:	bf 04 00 00 00       	mov    $0x4,%edi
+  802120:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  802127:	00 00 00 
+  80212a:	ff d0                	call   *%rax
+  80212c:	48 98                	cltq
+}
+  80212e:	5b                   	pop    %rbx
+  80212f:	41 5c                	pop    %r12
+  802131:	5d                   	pop    %rbp
+  802132:	c3                   	ret
+
+0000000000802133 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802133:	55                   	push   %rbp
+  802134:	48 89 e5             	mov    %rsp,%rbp
+  802137:	41 54                	push   %r12
+  802139:	53                   	push   %rbx
+  80213a:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80213d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802144:	00 00 00 
+  802147:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80214a:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  80214c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802151:	48 39 ca             	cmp    %rcx,%rdx
+  802154:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  802158:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  80215c:	be 00 00 00 00       	mov    $0x0,%esi
+  802161:	bf 03 00 00 00       	mov    $0x3,%edi
+  802166:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  80216d:	00 00 00 
+  802170:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802172:	85 c0                	test   %eax,%eax
+  802174:	78 27                	js     80219d <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802176:	48 63 d8             	movslq %eax,%rbx
+  802179:	48 89 da             	mov    %rbx,%rdx
+  80217c:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802183:	00 00 00 
+  802186:	4c 89 e7             	mov    %r12,%rdi
+  802189:	48 b8 fc 0d 80 00 00 	movabs $0x800dfc,%rax
+  802190:	00 00 00 
+  802193:	ff d0                	call   *%rax
+    return bytes_read;
+  802195:	48 89 d8             	mov    %rbx,%rax
+}
+  802198:	5b                   	pop    %rbx
+  802199:	41 5c                	pop    %r12
+  80219b:	5d                   	pop    %rbp
+  80219c:	c3                   	ret
+        return bytes_read;
+  80219d:	48 98                	cltq
+  80219f:	eb f7                	jmp    802198 <devfile_read+0x65>
+
+00000000008021a1 <open>:
+open(const char *path, int mode) {
+  8021a1:	55                   	push   %rbp
+  8021a2:	48 89 e5             	mov    %rsp,%rbp
+  8021a5:	41 55                	push   %r13
+  8021a7:	41 54                	push   %r12
+  8021a9:	53                   	push   %rbx
+  8021aa:	48 83 ec 18          	sub    $0x18,%rsp
+  8021ae:	49 89 fc             	mov    %rdi,%r12
+  8021b1:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8021b4:	48 b8 5d 0b 80 00 00 	movabs $0x800b5d,%rax
+  8021bb:	00 00 00 
+  8021be:	ff d0                	call   *%rax
+  8021c0:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8021c6:	0f 87 8a 00 00 00    	ja     802256 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8021cc:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8021d0:	48 b8 a0 18 80 00 00 	movabs $0x8018a0,%rax
+  8021d7:	00 00 00 
+  8021da:	ff d0                	call   *%rax
+  8021dc:	89 c3                	mov    %eax,%ebx
+  8021de:	85 c0                	test   %eax,%eax
+  8021e0:	78 50                	js     802232 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8021e2:	4c 89 e6             	mov    %r12,%rsi
+  8021e5:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8021ec:	00 00 00 
+  8021ef:	48 89 df             	mov    %rbx,%rdi
+  8021f2:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  8021f9:	00 00 00 
+  8021fc:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8021fe:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802205:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802209:	bf 01 00 00 00       	mov    $0x1,%edi
+  80220e:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  802215:	00 00 00 
+  802218:	ff d0                	call   *%rax
+  80221a:	89 c3                	mov    %eax,%ebx
+  80221c:	85 c0                	test   %eax,%eax
+  80221e:	78 1f                	js     80223f <open+0x9e>
+    return fd2num(fd);
+  802220:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802224:	48 b8 72 18 80 00 00 	movabs $0x801872,%rax
+  80222b:	00 00 00 
+  80222e:	ff d0                	call   *%rax
+  802230:	89 c3                	mov    %eax,%ebx
+}
+  802232:	89 d8                	mov    %ebx,%eax
+  802234:	48 83 c4 18          	add    $0x18,%rsp
+  802238:	5b                   	pop    %rbx
+  802239:	41 5c                	pop    %r12
+  80223b:	41 5d                	pop    %r13
+  80223d:	5d                   	pop    %rbp
+  80223e:	c3                   	ret
+        fd_close(fd, 0);
+  80223f:	be 00 00 00 00       	mov    $0x0,%esi
+  802244:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802248:	48 b8 bb 19 80 00 00 	movabs $0x8019bb,%rax
+  80224f:	00 00 00 
+  802252:	ff d0                	call   *%rax
+        return res;
+  802254:	eb dc                	jmp    802232 <open+0x91>
+        return -E_BAD_PATH;
+  802256:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80225b:	eb d5                	jmp    802232 <open+0x91>
+
+000000000080225d <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80225d:	55                   	push   %rbp
+  80225e:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802261:	be 00 00 00 00       	mov    $0x0,%esi
+  802266:	bf 08 00 00 00       	mov    $0x8,%edi
+  80226b:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  802272:	00 00 00 
+  802275:	ff d0                	call   *%rax
+}
+  802277:	5d                   	pop    %rbp
+  802278:	c3                   	ret
+
+0000000000802279 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802279:	55                   	push   %rbp
+  80227a:	48 89 e5             	mov    %rsp,%rbp
+  80227d:	41 54                	push   %r12
+  80227f:	53                   	push   %rbx
+  802280:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802283:	48 b8 84 18 80 00 00 	movabs $0x801884,%rax
+  80228a:	00 00 00 
+  80228d:	ff d0                	call   *%rax
+  80228f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802292:	48 be 60 32 80 00 00 	movabs $0x803260,%rsi
+  802299:	00 00 00 
+  80229c:	48 89 df             	mov    %rbx,%rdi
+  80229f:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  8022a6:	00 00 00 
+  8022a9:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8022ab:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8022b0:	41 2b 04 24          	sub    (%r12),%eax
+  8022b4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8022ba:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8022c1:	00 00 00 
+    stat->st_dev = &devpipe;
+  8022c4:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8022cb:	00 00 00 
+  8022ce:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8022d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022da:	5b                   	pop    %rbx
+  8022db:	41 5c                	pop    %r12
+  8022dd:	5d                   	pop    %rbp
+  8022de:	c3                   	ret
+
+00000000008022df <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8022df:	55                   	push   %rbp
+  8022e0:	48 89 e5             	mov    %rsp,%rbp
+  8022e3:	41 54                	push   %r12
+  8022e5:	53                   	push   %rbx
+  8022e6:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8022e9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022ee:	48 89 fe             	mov    %rdi,%rsi
+  8022f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022f6:	49 bc 17 12 80 00 00 	movabs $0x801217,%r12
+  8022fd:	00 00 00 
+  802300:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802303:	48 89 df             	mov    %rbx,%rdi
+  802306:	48 b8 84 18 80 00 00 	movabs $0x801884,%rax
+  80230d:	00 00 00 
+  802310:	ff d0                	call   *%rax
+  802312:	48 89 c6             	mov    %rax,%rsi
+  802315:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80231a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80231f:	41 ff d4             	call   *%r12
+}
+  802322:	5b                   	pop    %rbx
+  802323:	41 5c                	pop    %r12
+  802325:	5d                   	pop    %rbp
+  802326:	c3                   	ret
+
+0000000000802327 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802327:	55                   	push   %rbp
+  802328:	48 89 e5             	mov    %rsp,%rbp
+  80232b:	41 57                	push   %r15
+  80232d:	41 56                	push   %r14
+  80232f:	41 55                	push   %r13
+  802331:	41 54                	push   %r12
+  802333:	53                   	push   %rbx
+  802334:	48 83 ec 18          	sub    $0x18,%rsp
+  802338:	49 89 fc             	mov    %rdi,%r12
+  80233b:	49 89 f5             	mov    %rsi,%r13
+  80233e:	49 89 d7             	mov    %rdx,%r15
+  802341:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802345:	48 b8 84 18 80 00 00 	movabs $0x801884,%rax
+  80234c:	00 00 00 
+  80234f:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802351:	4d 85 ff             	test   %r15,%r15
+  802354:	0f 84 af 00 00 00    	je     802409 <devpipe_write+0xe2>
+  80235a:	48 89 c3             	mov    %rax,%rbx
+  80235d:	4c 89 f8             	mov    %r15,%rax
+  802360:	4d 89 ef             	mov    %r13,%r15
+  802363:	4c 01 e8             	add    %r13,%rax
+  802366:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80236a:	49 bd 1f 11 80 00 00 	movabs $0x80111f,%r13
+  802371:	00 00 00 
+            sys_yield();
+  802374:	49 be bc 10 80 00 00 	movabs $0x8010bc,%r14
+  80237b:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80237e:	8b 73 04             	mov    0x4(%rbx),%esi
+  802381:	48 63 ce             	movslq %esi,%rcx
+  802384:	48 63 03             	movslq (%rbx),%rax
+  802387:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80238d:	48 39 c1             	cmp    %rax,%rcx
+  802390:	72 2e                	jb     8023c0 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802392:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802397:	48 89 da             	mov    %rbx,%rdx
+  80239a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80239f:	4c 89 e7             	mov    %r12,%rdi
+  8023a2:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8023a5:	85 c0                	test   %eax,%eax
+  8023a7:	74 66                	je     80240f <devpipe_write+0xe8>
+            sys_yield();
+  8023a9:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8023ac:	8b 73 04             	mov    0x4(%rbx),%esi
+  8023af:	48 63 ce             	movslq %esi,%rcx
+  8023b2:	48 63 03             	movslq (%rbx),%rax
+  8023b5:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8023bb:	48 39 c1             	cmp    %rax,%rcx
+  8023be:	73 d2                	jae    802392 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8023c0:	41 0f b6 3f          	movzbl (%r15),%edi
+  8023c4:	48 89 ca             	mov    %rcx,%rdx
+  8023c7:	48 c1 ea 03          	shr    $0x3,%rdx
+  8023cb:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8023d2:	08 10 20 
+  8023d5:	48 f7 e2             	mul    %rdx
+  8023d8:	48 c1 ea 06          	shr    $0x6,%rdx
+  8023dc:	48 89 d0             	mov    %rdx,%rax
+  8023df:	48 c1 e0 09          	shl    $0x9,%rax
+  8023e3:	48 29 d0             	sub    %rdx,%rax
+  8023e6:	48 c1 e0 03          	shl    $0x3,%rax
+  8023ea:	48 29 c1             	sub    %rax,%rcx
+  8023ed:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8023f2:	83 c6 01             	add    $0x1,%esi
+  8023f5:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8023f8:	49 83 c7 01          	add    $0x1,%r15
+  8023fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802400:	49 39 c7             	cmp    %rax,%r15
+  802403:	0f 85 75 ff ff ff    	jne    80237e <devpipe_write+0x57>
+    return n;
+  802409:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80240d:	eb 05                	jmp    802414 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80240f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802414:	48 83 c4 18          	add    $0x18,%rsp
+  802418:	5b                   	pop    %rbx
+  802419:	41 5c                	pop    %r12
+  80241b:	41 5d                	pop    %r13
+  80241d:	41 5e                	pop    %r14
+  80241f:	41 5f                	pop    %r15
+  802421:	5d                   	pop    %rbp
+  802422:	c3                   	ret
+
+0000000000802423 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802423:	55                   	push   %rbp
+  802424:	48 89 e5             	mov    %rsp,%rbp
+  802427:	41 57                	push   %r15
+  802429:	41 56                	push   %r14
+  80242b:	41 55                	push   %r13
+  80242d:	41 54                	push   %r12
+  80242f:	53                   	push   %rbx
+  802430:	48 83 ec 18          	sub    $0x18,%rsp
+  802434:	49 89 fc             	mov    %rdi,%r12
+  802437:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80243b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80243f:	48 b8 84 18 80 00 00 	movabs $0x801884,%rax
+  802446:	00 00 00 
+  802449:	ff d0                	call   *%rax
+  80244b:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80244e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802454:	49 bd 1f 11 80 00 00 	movabs $0x80111f,%r13
+  80245b:	00 00 00 
+            sys_yield();
+  80245e:	49 be bc 10 80 00 00 	movabs $0x8010bc,%r14
+  802465:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802468:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80246d:	74 7d                	je     8024ec <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80246f:	8b 03                	mov    (%rbx),%eax
+  802471:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802474:	75 26                	jne    80249c <devpipe_read+0x79>
+            if (i > 0) return i;
+  802476:	4d 85 ff             	test   %r15,%r15
+  802479:	75 77                	jne    8024f2 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80247b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802480:	48 89 da             	mov    %rbx,%rdx
+  802483:	be 00 10 00 00       	mov    $0x1000,%esi
+  802488:	4c 89 e7             	mov    %r12,%rdi
+  80248b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80248e:	85 c0                	test   %eax,%eax
+  802490:	74 72                	je     802504 <devpipe_read+0xe1>
+            sys_yield();
+  802492:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802495:	8b 03                	mov    (%rbx),%eax
+  802497:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80249a:	74 df                	je     80247b <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80249c:	48 63 c8             	movslq %eax,%rcx
+  80249f:	48 89 ca             	mov    %rcx,%rdx
+  8024a2:	48 c1 ea 03          	shr    $0x3,%rdx
+  8024a6:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8024ad:	08 10 20 
+  8024b0:	48 89 d0             	mov    %rdx,%rax
+  8024b3:	48 f7 e6             	mul    %rsi
+  8024b6:	48 c1 ea 06          	shr    $0x6,%rdx
+  8024ba:	48 89 d0             	mov    %rdx,%rax
+  8024bd:	48 c1 e0 09          	shl    $0x9,%rax
+  8024c1:	48 29 d0             	sub    %rdx,%rax
+  8024c4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8024cb:	00 
+  8024cc:	48 89 c8             	mov    %rcx,%rax
+  8024cf:	48 29 d0             	sub    %rdx,%rax
+  8024d2:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8024d7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8024db:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8024df:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8024e2:	49 83 c7 01          	add    $0x1,%r15
+  8024e6:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8024ea:	75 83                	jne    80246f <devpipe_read+0x4c>
+    return n;
+  8024ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024f0:	eb 03                	jmp    8024f5 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8024f2:	4c 89 f8             	mov    %r15,%rax
+}
+  8024f5:	48 83 c4 18          	add    $0x18,%rsp
+  8024f9:	5b                   	pop    %rbx
+  8024fa:	41 5c                	pop    %r12
+  8024fc:	41 5d                	pop    %r13
+  8024fe:	41 5e                	pop    %r14
+  802500:	41 5f                	pop    %r15
+  802502:	5d                   	pop    %rbp
+  802503:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802504:	b8 00 00 00 00       	mov    $0x0,%eax
+  802509:	eb ea                	jmp    8024f5 <devpipe_read+0xd2>
+
+000000000080250b <pipe>:
+pipe(int pfd[2]) {
+  80250b:	55                   	push   %rbp
+  80250c:	48 89 e5             	mov    %rsp,%rbp
+  80250f:	41 55                	push   %r13
+  802511:	41 54                	push   %r12
+  802513:	53                   	push   %rbx
+  802514:	48 83 ec 18          	sub    $0x18,%rsp
+  802518:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80251b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80251f:	48 b8 a0 18 80 00 00 	movabs $0x8018a0,%rax
+  802526:	00 00 00 
+  802529:	ff d0                	call   *%rax
+  80252b:	89 c3                	mov    %eax,%ebx
+  80252d:	85 c0                	test   %eax,%eax
+  80252f:	0f 88 a0 01 00 00    	js     8026d5 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802535:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80253a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80253f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802543:	bf 00 00 00 00       	mov    $0x0,%edi
+  802548:	48 b8 4b 11 80 00 00 	movabs $0x80114b,%rax
+  80254f:	00 00 00 
+  802552:	ff d0                	call   *%rax
+  802554:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802556:	85 c0                	test   %eax,%eax
+  802558:	0f 88 77 01 00 00    	js     8026d5 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80255e:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802562:	48 b8 a0 18 80 00 00 	movabs $0x8018a0,%rax
+  802569:	00 00 00 
+  80256c:	ff d0                	call   *%rax
+  80256e:	89 c3                	mov    %eax,%ebx
+  802570:	85 c0                	test   %eax,%eax
+  802572:	0f 88 43 01 00 00    	js     8026bb <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802578:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80257d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802582:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802586:	bf 00 00 00 00       	mov    $0x0,%edi
+  80258b:	48 b8 4b 11 80 00 00 	movabs $0x80114b,%rax
+  802592:	00 00 00 
+  802595:	ff d0                	call   *%rax
+  802597:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802599:	85 c0                	test   %eax,%eax
+  80259b:	0f 88 1a 01 00 00    	js     8026bb <pipe+0x1b0>
+    va = fd2data(fd0);
+  8025a1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025a5:	48 b8 84 18 80 00 00 	movabs $0x801884,%rax
+  8025ac:	00 00 00 
+  8025af:	ff d0                	call   *%rax
+  8025b1:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8025b4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8025b9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025be:	48 89 c6             	mov    %rax,%rsi
+  8025c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025c6:	48 b8 4b 11 80 00 00 	movabs $0x80114b,%rax
+  8025cd:	00 00 00 
+  8025d0:	ff d0                	call   *%rax
+  8025d2:	89 c3                	mov    %eax,%ebx
+  8025d4:	85 c0                	test   %eax,%eax
+  8025d6:	0f 88 c5 00 00 00    	js     8026a1 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8025dc:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8025e0:	48 b8 84 18 80 00 00 	movabs $0x801884,%rax
+  8025e7:	00 00 00 
+  8025ea:	ff d0                	call   *%rax
+  8025ec:	48 89 c1             	mov    %rax,%rcx
+  8025ef:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8025f5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8025fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802600:	4c 89 ee             	mov    %r13,%rsi
+  802603:	bf 00 00 00 00       	mov    $0x0,%edi
+  802608:	48 b8 b2 11 80 00 00 	movabs $0x8011b2,%rax
+  80260f:	00 00 00 
+  802612:	ff d0                	call   *%rax
+  802614:	89 c3                	mov    %eax,%ebx
+  802616:	85 c0                	test   %eax,%eax
+  802618:	78 6e                	js     802688 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80261a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80261f:	4c 89 ef             	mov    %r13,%rdi
+  802622:	48 b8 ed 10 80 00 00 	movabs $0x8010ed,%rax
+  802629:	00 00 00 
+  80262c:	ff d0                	call   *%rax
+  80262e:	83 f8 02             	cmp    $0x2,%eax
+  802631:	0f 85 ab 00 00 00    	jne    8026e2 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802637:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80263e:	00 00 
+  802640:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802644:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802646:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80264a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802651:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802655:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802657:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80265b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802662:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802666:	48 bb 72 18 80 00 00 	movabs $0x801872,%rbx
+  80266d:	00 00 00 
+  802670:	ff d3                	call   *%rbx
+  802672:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802676:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80267a:	ff d3                	call   *%rbx
+  80267c:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802681:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802686:	eb 4d                	jmp    8026d5 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802688:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80268d:	4c 89 ee             	mov    %r13,%rsi
+  802690:	bf 00 00 00 00       	mov    $0x0,%edi
+  802695:	48 b8 17 12 80 00 00 	movabs $0x801217,%rax
+  80269c:	00 00 00 
+  80269f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8026a1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026a6:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8026aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026af:	48 b8 17 12 80 00 00 	movabs $0x801217,%rax
+  8026b6:	00 00 00 
+  8026b9:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8026bb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026c0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8026c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026c9:	48 b8 17 12 80 00 00 	movabs $0x801217,%rax
+  8026d0:	00 00 00 
+  8026d3:	ff d0                	call   *%rax
+}
+  8026d5:	89 d8                	mov    %ebx,%eax
+  8026d7:	48 83 c4 18          	add    $0x18,%rsp
+  8026db:	5b                   	pop    %rbx
+  8026dc:	41 5c                	pop    %r12
+  8026de:	41 5d                	pop    %r13
+  8026e0:	5d                   	pop    %rbp
+  8026e1:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8026e2:	48 b9 90 32 80 00 00 	movabs $0x803290,%rcx
+  8026e9:	00 00 00 
+  8026ec:	48 ba 67 32 80 00 00 	movabs $0x803267,%rdx
+  8026f3:	00 00 00 
+  8026f6:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8026fb:	48 bf 7c 32 80 00 00 	movabs $0x80327c,%rdi
+  802702:	00 00 00 
+  802705:	b8 00 00 00 00       	mov    $0x0,%eax
+  80270a:	49 b8 45 2b 80 00 00 	movabs $0x802b45,%r8
+  802711:	00 00 00 
+  802714:	41 ff d0             	call   *%r8
+
+0000000000802717 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802717:	55                   	push   %rbp
+  802718:	48 89 e5             	mov    %rsp,%rbp
+  80271b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80271f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802723:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  80272a:	00 00 00 
+  80272d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80272f:	85 c0                	test   %eax,%eax
+  802731:	78 35                	js     802768 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802733:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802737:	48 b8 84 18 80 00 00 	movabs $0x801884,%rax
+  80273e:	00 00 00 
+  802741:	ff d0                	call   *%rax
+  802743:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802746:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80274b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802750:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802754:	48 b8 1f 11 80 00 00 	movabs $0x80111f,%rax
+  80275b:	00 00 00 
+  80275e:	ff d0                	call   *%rax
+  802760:	85 c0                	test   %eax,%eax
+  802762:	0f 94 c0             	sete   %al
+  802765:	0f b6 c0             	movzbl %al,%eax
+}
+  802768:	c9                   	leave
+  802769:	c3                   	ret
+
+000000000080276a <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80276a:	48 89 f8             	mov    %rdi,%rax
+  80276d:	48 c1 e8 27          	shr    $0x27,%rax
+  802771:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802778:	01 00 00 
+  80277b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80277f:	f6 c2 01             	test   $0x1,%dl
+  802782:	74 6d                	je     8027f1 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802784:	48 89 f8             	mov    %rdi,%rax
+  802787:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80278b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802792:	01 00 00 
+  802795:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802799:	f6 c2 01             	test   $0x1,%dl
+  80279c:	74 62                	je     802800 <get_uvpt_entry+0x96>
+  80279e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8027a5:	01 00 00 
+  8027a8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8027ac:	f6 c2 80             	test   $0x80,%dl
+  8027af:	75 4f                	jne    802800 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8027b1:	48 89 f8             	mov    %rdi,%rax
+  8027b4:	48 c1 e8 15          	shr    $0x15,%rax
+  8027b8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8027bf:	01 00 00 
+  8027c2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8027c6:	f6 c2 01             	test   $0x1,%dl
+  8027c9:	74 44                	je     80280f <get_uvpt_entry+0xa5>
+  8027cb:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8027d2:	01 00 00 
+  8027d5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8027d9:	f6 c2 80             	test   $0x80,%dl
+  8027dc:	75 31                	jne    80280f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8027de:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8027e2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8027e9:	01 00 00 
+  8027ec:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8027f0:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8027f1:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8027f8:	01 00 00 
+  8027fb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027ff:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802800:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802807:	01 00 00 
+  80280a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80280e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80280f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802816:	01 00 00 
+  802819:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80281d:	c3                   	ret
+
+000000000080281e <get_prot>:
+
+int
+get_prot(void *va) {
+  80281e:	55                   	push   %rbp
+  80281f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802822:	48 b8 6a 27 80 00 00 	movabs $0x80276a,%rax
+  802829:	00 00 00 
+  80282c:	ff d0                	call   *%rax
+  80282e:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802831:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802836:	89 c1                	mov    %eax,%ecx
+  802838:	83 c9 04             	or     $0x4,%ecx
+  80283b:	f6 c2 01             	test   $0x1,%dl
+  80283e:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802841:	89 c1                	mov    %eax,%ecx
+  802843:	83 c9 02             	or     $0x2,%ecx
+  802846:	f6 c2 02             	test   $0x2,%dl
+  802849:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80284c:	89 c1                	mov    %eax,%ecx
+  80284e:	83 c9 01             	or     $0x1,%ecx
+  802851:	48 85 d2             	test   %rdx,%rdx
+  802854:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802857:	89 c1                	mov    %eax,%ecx
+  802859:	83 c9 40             	or     $0x40,%ecx
+  80285c:	f6 c6 04             	test   $0x4,%dh
+  80285f:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802862:	5d                   	pop    %rbp
+  802863:	c3                   	ret
+
+0000000000802864 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802864:	55                   	push   %rbp
+  802865:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802868:	48 b8 6a 27 80 00 00 	movabs $0x80276a,%rax
+  80286f:	00 00 00 
+  802872:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802874:	48 c1 e8 06          	shr    $0x6,%rax
+  802878:	83 e0 01             	and    $0x1,%eax
+}
+  80287b:	5d                   	pop    %rbp
+  80287c:	c3                   	ret
+
+000000000080287d <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80287d:	55                   	push   %rbp
+  80287e:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802881:	48 b8 6a 27 80 00 00 	movabs $0x80276a,%rax
+  802888:	00 00 00 
+  80288b:	ff d0                	call   *%rax
+  80288d:	83 e0 01             	and    $0x1,%eax
+}
+  802890:	5d                   	pop    %rbp
+  802891:	c3                   	ret
+
+0000000000802892 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802892:	55                   	push   %rbp
+  802893:	48 89 e5             	mov    %rsp,%rbp
+  802896:	41 57                	push   %r15
+  802898:	41 56                	push   %r14
+  80289a:	41 55                	push   %r13
+  80289c:	41 54                	push   %r12
+  80289e:	53                   	push   %rbx
+  80289f:	48 83 ec 18          	sub    $0x18,%rsp
+  8028a3:	49 89 ff             	mov    %rdi,%r15
+  8028a6:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8028aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  8028af:	49 bc 7d 28 80 00 00 	movabs $0x80287d,%r12
+  8028b6:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  8028b9:	49 be 1e 28 80 00 00 	movabs $0x80281e,%r14
+  8028c0:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8028c3:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  8028ca:	00 00 00 
+  8028cd:	eb 0c                	jmp    8028db <foreach_shared_region+0x49>
+  8028cf:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8028d6:	4c 39 eb             	cmp    %r13,%rbx
+  8028d9:	74 38                	je     802913 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  8028db:	48 89 df             	mov    %rbx,%rdi
+  8028de:	41 ff d4             	call   *%r12
+  8028e1:	84 c0                	test   %al,%al
+  8028e3:	74 ea                	je     8028cf <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  8028e5:	48 89 df             	mov    %rbx,%rdi
+  8028e8:	41 ff d6             	call   *%r14
+  8028eb:	a8 40                	test   $0x40,%al
+  8028ed:	74 e0                	je     8028cf <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8028ef:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8028f6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8028fa:	48 89 df             	mov    %rbx,%rdi
+  8028fd:	41 ff d7             	call   *%r15
+        if (err)
+  802900:	85 c0                	test   %eax,%eax
+  802902:	74 cb                	je     8028cf <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802904:	48 83 c4 18          	add    $0x18,%rsp
+  802908:	5b                   	pop    %rbx
+  802909:	41 5c                	pop    %r12
+  80290b:	41 5d                	pop    %r13
+  80290d:	41 5e                	pop    %r14
+  80290f:	41 5f                	pop    %r15
+  802911:	5d                   	pop    %rbp
+  802912:	c3                   	ret
+    return 0;
+  802913:	b8 00 00 00 00       	mov    $0x0,%eax
+  802918:	eb ea                	jmp    802904 <foreach_shared_region+0x72>
+
+000000000080291a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80291a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80291f:	c3                   	ret
+
+0000000000802920 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802920:	55                   	push   %rbp
+  802921:	48 89 e5             	mov    %rsp,%rbp
+  802924:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802927:	48 be b4 32 80 00 00 	movabs $0x8032b4,%rsi
+  80292e:	00 00 00 
+  802931:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  802938:	00 00 00 
+  80293b:	ff d0                	call   *%rax
+    return 0;
+}
+  80293d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802942:	5d                   	pop    %rbp
+  802943:	c3                   	ret
+
+0000000000802944 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802944:	55                   	push   %rbp
+  802945:	48 89 e5             	mov    %rsp,%rbp
+  802948:	41 57                	push   %r15
+  80294a:	41 56                	push   %r14
+  80294c:	41 55                	push   %r13
+  80294e:	41 54                	push   %r12
+  802950:	53                   	push   %rbx
+  802951:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802958:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80295f:	48 85 d2             	test   %rdx,%rdx
+  802962:	74 7a                	je     8029de <devcons_write+0x9a>
+  802964:	49 89 d6             	mov    %rdx,%r14
+  802967:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80296d:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802972:	49 bf 95 0d 80 00 00 	movabs $0x800d95,%r15
+  802979:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80297c:	4c 89 f3             	mov    %r14,%rbx
+  80297f:	48 29 f3             	sub    %rsi,%rbx
+  802982:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802987:	48 39 c3             	cmp    %rax,%rbx
+  80298a:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80298e:	4c 63 eb             	movslq %ebx,%r13
+  802991:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802998:	48 01 c6             	add    %rax,%rsi
+  80299b:	4c 89 ea             	mov    %r13,%rdx
+  80299e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8029a5:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8029a8:	4c 89 ee             	mov    %r13,%rsi
+  8029ab:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8029b2:	48 b8 c2 0f 80 00 00 	movabs $0x800fc2,%rax
+  8029b9:	00 00 00 
+  8029bc:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8029be:	41 01 dc             	add    %ebx,%r12d
+  8029c1:	49 63 f4             	movslq %r12d,%rsi
+  8029c4:	4c 39 f6             	cmp    %r14,%rsi
+  8029c7:	72 b3                	jb     80297c <devcons_write+0x38>
+    return res;
+  8029c9:	49 63 c4             	movslq %r12d,%rax
+}
+  8029cc:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8029d3:	5b                   	pop    %rbx
+  8029d4:	41 5c                	pop    %r12
+  8029d6:	41 5d                	pop    %r13
+  8029d8:	41 5e                	pop    %r14
+  8029da:	41 5f                	pop    %r15
+  8029dc:	5d                   	pop    %rbp
+  8029dd:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8029de:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8029e4:	eb e3                	jmp    8029c9 <devcons_write+0x85>
+
+00000000008029e6 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8029e6:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8029e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029ee:	48 85 c0             	test   %rax,%rax
+  8029f1:	74 55                	je     802a48 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8029f3:	55                   	push   %rbp
+  8029f4:	48 89 e5             	mov    %rsp,%rbp
+  8029f7:	41 55                	push   %r13
+  8029f9:	41 54                	push   %r12
+  8029fb:	53                   	push   %rbx
+  8029fc:	48 83 ec 08          	sub    $0x8,%rsp
+  802a00:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802a03:	48 bb ef 0f 80 00 00 	movabs $0x800fef,%rbx
+  802a0a:	00 00 00 
+  802a0d:	49 bc bc 10 80 00 00 	movabs $0x8010bc,%r12
+  802a14:	00 00 00 
+  802a17:	eb 03                	jmp    802a1c <devcons_read+0x36>
+  802a19:	41 ff d4             	call   *%r12
+  802a1c:	ff d3                	call   *%rbx
+  802a1e:	85 c0                	test   %eax,%eax
+  802a20:	74 f7                	je     802a19 <devcons_read+0x33>
+    if (c < 0) return c;
+  802a22:	48 63 d0             	movslq %eax,%rdx
+  802a25:	78 13                	js     802a3a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802a27:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a2c:	83 f8 04             	cmp    $0x4,%eax
+  802a2f:	74 09                	je     802a3a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802a31:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802a35:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802a3a:	48 89 d0             	mov    %rdx,%rax
+  802a3d:	48 83 c4 08          	add    $0x8,%rsp
+  802a41:	5b                   	pop    %rbx
+  802a42:	41 5c                	pop    %r12
+  802a44:	41 5d                	pop    %r13
+  802a46:	5d                   	pop    %rbp
+  802a47:	c3                   	ret
+  802a48:	48 89 d0             	mov    %rdx,%rax
+  802a4b:	c3                   	ret
+
+0000000000802a4c <cputchar>:
+cputchar(int ch) {
+  802a4c:	55                   	push   %rbp
+  802a4d:	48 89 e5             	mov    %rsp,%rbp
+  802a50:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802a54:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802a58:	be 01 00 00 00       	mov    $0x1,%esi
+  802a5d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802a61:	48 b8 c2 0f 80 00 00 	movabs $0x800fc2,%rax
+  802a68:	00 00 00 
+  802a6b:	ff d0                	call   *%rax
+}
+  802a6d:	c9                   	leave
+  802a6e:	c3                   	ret
+
+0000000000802a6f <getchar>:
+getchar(void) {
+  802a6f:	55                   	push   %rbp
+  802a70:	48 89 e5             	mov    %rsp,%rbp
+  802a73:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802a77:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a7c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802a80:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a85:	48 b8 e3 1b 80 00 00 	movabs $0x801be3,%rax
+  802a8c:	00 00 00 
+  802a8f:	ff d0                	call   *%rax
+  802a91:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802a93:	85 c0                	test   %eax,%eax
+  802a95:	78 06                	js     802a9d <getchar+0x2e>
+  802a97:	74 08                	je     802aa1 <getchar+0x32>
+  802a99:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802a9d:	89 d0                	mov    %edx,%eax
+  802a9f:	c9                   	leave
+  802aa0:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802aa1:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802aa6:	eb f5                	jmp    802a9d <getchar+0x2e>
+
+0000000000802aa8 <iscons>:
+iscons(int fdnum) {
+  802aa8:	55                   	push   %rbp
+  802aa9:	48 89 e5             	mov    %rsp,%rbp
+  802aac:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802ab0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802ab4:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  802abb:	00 00 00 
+  802abe:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ac0:	85 c0                	test   %eax,%eax
+  802ac2:	78 18                	js     802adc <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802ac4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ac8:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802acf:	00 00 00 
+  802ad2:	8b 00                	mov    (%rax),%eax
+  802ad4:	39 02                	cmp    %eax,(%rdx)
+  802ad6:	0f 94 c0             	sete   %al
+  802ad9:	0f b6 c0             	movzbl %al,%eax
+}
+  802adc:	c9                   	leave
+  802add:	c3                   	ret
+
+0000000000802ade <opencons>:
+opencons(void) {
+  802ade:	55                   	push   %rbp
+  802adf:	48 89 e5             	mov    %rsp,%rbp
+  802ae2:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ae6:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802aea:	48 b8 a0 18 80 00 00 	movabs $0x8018a0,%rax
+  802af1:	00 00 00 
+  802af4:	ff d0                	call   *%rax
+  802af6:	85 c0                	test   %eax,%eax
+  802af8:	78 49                	js     802b43 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802afa:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802aff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b04:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802b08:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b0d:	48 b8 4b 11 80 00 00 	movabs $0x80114b,%rax
+  802b14:	00 00 00 
+  802b17:	ff d0                	call   *%rax
+  802b19:	85 c0                	test   %eax,%eax
+  802b1b:	78 26                	js     802b43 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802b1d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b21:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802b28:	00 00 
+  802b2a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802b2c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802b30:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802b37:	48 b8 72 18 80 00 00 	movabs $0x801872,%rax
+  802b3e:	00 00 00 
+  802b41:	ff d0                	call   *%rax
+}
+  802b43:	c9                   	leave
+  802b44:	c3                   	ret
+
+0000000000802b45 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802b45:	55                   	push   %rbp
+  802b46:	48 89 e5             	mov    %rsp,%rbp
+  802b49:	41 56                	push   %r14
+  802b4b:	41 55                	push   %r13
+  802b4d:	41 54                	push   %r12
+  802b4f:	53                   	push   %rbx
+  802b50:	48 83 ec 50          	sub    $0x50,%rsp
+  802b54:	49 89 fc             	mov    %rdi,%r12
+  802b57:	41 89 f5             	mov    %esi,%r13d
+  802b5a:	48 89 d3             	mov    %rdx,%rbx
+  802b5d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802b61:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802b65:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802b69:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802b70:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802b74:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802b78:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802b7c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802b80:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802b87:	00 00 00 
+  802b8a:	4c 8b 30             	mov    (%rax),%r14
+  802b8d:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  802b94:	00 00 00 
+  802b97:	ff d0                	call   *%rax
+  802b99:	89 c6                	mov    %eax,%esi
+  802b9b:	45 89 e8             	mov    %r13d,%r8d
+  802b9e:	4c 89 e1             	mov    %r12,%rcx
+  802ba1:	4c 89 f2             	mov    %r14,%rdx
+  802ba4:	48 bf c0 32 80 00 00 	movabs $0x8032c0,%rdi
+  802bab:	00 00 00 
+  802bae:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb3:	49 bc 76 02 80 00 00 	movabs $0x800276,%r12
+  802bba:	00 00 00 
+  802bbd:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802bc0:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802bc4:	48 89 df             	mov    %rbx,%rdi
+  802bc7:	48 b8 12 02 80 00 00 	movabs $0x800212,%rax
+  802bce:	00 00 00 
+  802bd1:	ff d0                	call   *%rax
+    cprintf("\n");
+  802bd3:	48 bf 1b 32 80 00 00 	movabs $0x80321b,%rdi
+  802bda:	00 00 00 
+  802bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be2:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802be5:	cc                   	int3
+  802be6:	eb fd                	jmp    802be5 <_panic+0xa0>
+
+0000000000802be8 <__rodata_start>:
+  802be8:	25 78 20 72 65       	and    $0x65722078,%eax
+  802bed:	63 76 20             	movsxd 0x20(%rsi),%esi
+  802bf0:	66 72 6f             	data16 jb 802c62 <__rodata_start+0x7a>
+  802bf3:	6d                   	insl   (%dx),%es:(%rdi)
+  802bf4:	20 25 78 0a 00 25    	and    %ah,0x25000a78(%rip)        # 25803672 <__bss_end+0x24ffb672>
+  802bfa:	78 20                	js     802c1c <__rodata_start+0x34>
+  802bfc:	6c                   	insb   (%dx),%es:(%rdi)
+  802bfd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bfe:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bff:	70 20                	jo     802c21 <__rodata_start+0x39>
+  802c01:	73 65                	jae    802c68 <__rodata_start+0x80>
+  802c03:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c04:	64 69 6e 67 20 74 6f 	imul   $0x206f7420,%fs:0x67(%rsi),%ebp
+  802c0b:	20 
+  802c0c:	25 78 0a 00 3c       	and    $0x3c000a78,%eax
+  802c11:	75 6e                	jne    802c81 <__rodata_start+0x99>
+  802c13:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802c17:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c18:	3e 00 30             	ds add %dh,(%rax)
+  802c1b:	31 32                	xor    %esi,(%rdx)
+  802c1d:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802c24:	41                   	rex.B
+  802c25:	42                   	rex.X
+  802c26:	43                   	rex.XB
+  802c27:	44                   	rex.R
+  802c28:	45                   	rex.RB
+  802c29:	46 00 30             	rex.RX add %r14b,(%rax)
+  802c2c:	31 32                	xor    %esi,(%rdx)
+  802c2e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802c35:	61                   	(bad)
+  802c36:	62 63 64 65 66       	(bad)
+  802c3b:	00 28                	add    %ch,(%rax)
+  802c3d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c3e:	75 6c                	jne    802cac <__rodata_start+0xc4>
+  802c40:	6c                   	insb   (%dx),%es:(%rdi)
+  802c41:	29 00                	sub    %eax,(%rax)
+  802c43:	65 72 72             	gs jb  802cb8 <__rodata_start+0xd0>
+  802c46:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c47:	72 20                	jb     802c69 <__rodata_start+0x81>
+  802c49:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802c4e:	73 70                	jae    802cc0 <__rodata_start+0xd8>
+  802c50:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802c54:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802c5b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c5c:	72 00                	jb     802c5e <__rodata_start+0x76>
+  802c5e:	62 61 64 20 65       	(bad)
+  802c63:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c64:	76 69                	jbe    802ccf <__rodata_start+0xe7>
+  802c66:	72 6f                	jb     802cd7 <__rodata_start+0xef>
+  802c68:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c69:	6d                   	insl   (%dx),%es:(%rdi)
+  802c6a:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802c6c:	74 00                	je     802c6e <__rodata_start+0x86>
+  802c6e:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802c75:	20 70 61             	and    %dh,0x61(%rax)
+  802c78:	72 61                	jb     802cdb <__rodata_start+0xf3>
+  802c7a:	6d                   	insl   (%dx),%es:(%rdi)
+  802c7b:	65 74 65             	gs je  802ce3 <__rodata_start+0xfb>
+  802c7e:	72 00                	jb     802c80 <__rodata_start+0x98>
+  802c80:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c81:	75 74                	jne    802cf7 <__rodata_start+0x10f>
+  802c83:	20 6f 66             	and    %ch,0x66(%rdi)
+  802c86:	20 6d 65             	and    %ch,0x65(%rbp)
+  802c89:	6d                   	insl   (%dx),%es:(%rdi)
+  802c8a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c8b:	72 79                	jb     802d06 <__rodata_start+0x11e>
+  802c8d:	00 6f 75             	add    %ch,0x75(%rdi)
+  802c90:	74 20                	je     802cb2 <__rodata_start+0xca>
+  802c92:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c93:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802c97:	76 69                	jbe    802d02 <__rodata_start+0x11a>
+  802c99:	72 6f                	jb     802d0a <__rodata_start+0x122>
+  802c9b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c9c:	6d                   	insl   (%dx),%es:(%rdi)
+  802c9d:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802c9f:	74 73                	je     802d14 <__rodata_start+0x12c>
+  802ca1:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802ca4:	72 72                	jb     802d18 <__rodata_start+0x130>
+  802ca6:	75 70                	jne    802d18 <__rodata_start+0x130>
+  802ca8:	74 65                	je     802d0f <__rodata_start+0x127>
+  802caa:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802caf:	75 67                	jne    802d18 <__rodata_start+0x130>
+  802cb1:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802cb4:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802cb6:	00 73 65             	add    %dh,0x65(%rbx)
+  802cb9:	67 6d                	insl   (%dx),%es:(%edi)
+  802cbb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802cbd:	74 61                	je     802d20 <__rodata_start+0x138>
+  802cbf:	74 69                	je     802d2a <__rodata_start+0x142>
+  802cc1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cc2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cc3:	20 66 61             	and    %ah,0x61(%rsi)
+  802cc6:	75 6c                	jne    802d34 <__rodata_start+0x14c>
+  802cc8:	74 00                	je     802cca <__rodata_start+0xe2>
+  802cca:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802cd1:	20 45 4c             	and    %al,0x4c(%rbp)
+  802cd4:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802cd8:	61                   	(bad)
+  802cd9:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802cde:	20 73 75             	and    %dh,0x75(%rbx)
+  802ce1:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802ce4:	73 79                	jae    802d5f <__rodata_start+0x177>
+  802ce6:	73 74                	jae    802d5c <__rodata_start+0x174>
+  802ce8:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802cea:	20 63 61             	and    %ah,0x61(%rbx)
+  802ced:	6c                   	insb   (%dx),%es:(%rdi)
+  802cee:	6c                   	insb   (%dx),%es:(%rdi)
+  802cef:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802cf2:	74 72                	je     802d66 <__rodata_start+0x17e>
+  802cf4:	79 20                	jns    802d16 <__rodata_start+0x12e>
+  802cf6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cf7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cf8:	74 20                	je     802d1a <__rodata_start+0x132>
+  802cfa:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802cfc:	75 6e                	jne    802d6c <__rodata_start+0x184>
+  802cfe:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802d02:	76 20                	jbe    802d24 <__rodata_start+0x13c>
+  802d04:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802d0b:	72 65                	jb     802d72 <__rodata_start+0x18a>
+  802d0d:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802d10:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d11:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802d15:	65 78 70             	gs js  802d88 <__rodata_start+0x1a0>
+  802d18:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802d1d:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802d20:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802d24:	20 66 69             	and    %ah,0x69(%rsi)
+  802d27:	6c                   	insb   (%dx),%es:(%rdi)
+  802d28:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802d2c:	20 66 72             	and    %ah,0x72(%rsi)
+  802d2f:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802d34:	61                   	(bad)
+  802d35:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802d38:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d39:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d3a:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802d3e:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802d41:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d42:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d43:	20 6d 61             	and    %ch,0x61(%rbp)
+  802d46:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d47:	79 20                	jns    802d69 <__rodata_start+0x181>
+  802d49:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802d50:	72 65                	jb     802db7 <__rodata_start+0x1cf>
+  802d52:	20 6f 70             	and    %ch,0x70(%rdi)
+  802d55:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d57:	00 66 69             	add    %ah,0x69(%rsi)
+  802d5a:	6c                   	insb   (%dx),%es:(%rdi)
+  802d5b:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802d5f:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802d62:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d63:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802d66:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d67:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d68:	74 20                	je     802d8a <__rodata_start+0x1a2>
+  802d6a:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802d6c:	75 6e                	jne    802ddc <__rodata_start+0x1f4>
+  802d6e:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802d72:	76 61                	jbe    802dd5 <__rodata_start+0x1ed>
+  802d74:	6c                   	insb   (%dx),%es:(%rdi)
+  802d75:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802d7c:	00 
+  802d7d:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802d84:	72 65                	jb     802deb <__rodata_start+0x203>
+  802d86:	61                   	(bad)
+  802d87:	64 79 20             	fs jns 802daa <__rodata_start+0x1c2>
+  802d8a:	65 78 69             	gs js  802df6 <__rodata_start+0x20e>
+  802d8d:	73 74                	jae    802e03 <__rodata_start+0x21b>
+  802d8f:	73 00                	jae    802d91 <__rodata_start+0x1a9>
+  802d91:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d92:	70 65                	jo     802df9 <__rodata_start+0x211>
+  802d94:	72 61                	jb     802df7 <__rodata_start+0x20f>
+  802d96:	74 69                	je     802e01 <__rodata_start+0x219>
+  802d98:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d99:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d9a:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802d9d:	74 20                	je     802dbf <__rodata_start+0x1d7>
+  802d9f:	73 75                	jae    802e16 <__rodata_start+0x22e>
+  802da1:	70 70                	jo     802e13 <__rodata_start+0x22b>
+  802da3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802da4:	72 74                	jb     802e1a <__rodata_start+0x232>
+  802da6:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802dab:	65 72 61             	gs jb  802e0f <__rodata_start+0x227>
+  802dae:	74 69                	je     802e19 <__rodata_start+0x231>
+  802db0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802db1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802db2:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802db5:	74 20                	je     802dd7 <__rodata_start+0x1ef>
+  802db7:	70 65                	jo     802e1e <__rodata_start+0x236>
+  802db9:	72 6d                	jb     802e28 <__rodata_start+0x240>
+  802dbb:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  802dc2:	2e 
+  802dc3:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  802dca:	00 
+  802dcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802dd2:	00 00 00 
+  802dd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802ddc:	00 00 00 
+  802ddf:	90                   	nop
+  802de0:	63 04 80             	movsxd (%rax,%rax,4),%eax
+  802de3:	00 00                	add    %al,(%rax)
+  802de5:	00 00                	add    %al,(%rax)
+  802de7:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802dee:	00 00                	add    %al,(%rax)
+  802df0:	94                   	xchg   %eax,%esp
+  802df1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802df7:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802dfe:	00 00                	add    %al,(%rax)
+  802e00:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802e01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e07:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802e0e:	00 00                	add    %al,(%rax)
+  802e10:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802e11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e17:	00 82 04 80 00 00    	add    %al,0x8004(%rdx)
+  802e1d:	00 00                	add    %al,(%rax)
+  802e1f:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802e26:	00 00                	add    %al,(%rax)
+  802e28:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802e29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e2f:	00 76 04             	add    %dh,0x4(%rsi)
+  802e32:	80 00 00             	addb   $0x0,(%rax)
+  802e35:	00 00                	add    %al,(%rax)
+  802e37:	00 f0                	add    %dh,%al
+  802e39:	04 80                	add    $0x80,%al
+  802e3b:	00 00                	add    %al,(%rax)
+  802e3d:	00 00                	add    %al,(%rax)
+  802e3f:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802e46:	00 00                	add    %al,(%rax)
+  802e48:	76 04                	jbe    802e4e <__rodata_start+0x266>
+  802e4a:	80 00 00             	addb   $0x0,(%rax)
+  802e4d:	00 00                	add    %al,(%rax)
+  802e4f:	00 bc 04 80 00 00 00 	add    %bh,0x80(%rsp,%rax,1)
+  802e56:	00 00                	add    %al,(%rax)
+  802e58:	bc 04 80 00 00       	mov    $0x8004,%esp
+  802e5d:	00 00                	add    %al,(%rax)
+  802e5f:	00 bc 04 80 00 00 00 	add    %bh,0x80(%rsp,%rax,1)
+  802e66:	00 00                	add    %al,(%rax)
+  802e68:	bc 04 80 00 00       	mov    $0x8004,%esp
+  802e6d:	00 00                	add    %al,(%rax)
+  802e6f:	00 bc 04 80 00 00 00 	add    %bh,0x80(%rsp,%rax,1)
+  802e76:	00 00                	add    %al,(%rax)
+  802e78:	bc 04 80 00 00       	mov    $0x8004,%esp
+  802e7d:	00 00                	add    %al,(%rax)
+  802e7f:	00 bc 04 80 00 00 00 	add    %bh,0x80(%rsp,%rax,1)
+  802e86:	00 00                	add    %al,(%rax)
+  802e88:	bc 04 80 00 00       	mov    $0x8004,%esp
+  802e8d:	00 00                	add    %al,(%rax)
+  802e8f:	00 bc 04 80 00 00 00 	add    %bh,0x80(%rsp,%rax,1)
+  802e96:	00 00                	add    %al,(%rax)
+  802e98:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802e99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802e9f:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802ea6:	00 00                	add    %al,(%rax)
+  802ea8:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802ea9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802eaf:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802eb6:	00 00                	add    %al,(%rax)
+  802eb8:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802eb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ebf:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802ec6:	00 00                	add    %al,(%rax)
+  802ec8:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802ec9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ecf:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802ed6:	00 00                	add    %al,(%rax)
+  802ed8:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802ed9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802edf:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802ee6:	00 00                	add    %al,(%rax)
+  802ee8:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802ee9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802eef:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802ef6:	00 00                	add    %al,(%rax)
+  802ef8:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802ef9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802eff:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802f06:	00 00                	add    %al,(%rax)
+  802f08:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802f09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f0f:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802f16:	00 00                	add    %al,(%rax)
+  802f18:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802f19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f1f:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802f26:	00 00                	add    %al,(%rax)
+  802f28:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802f29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f2f:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802f36:	00 00                	add    %al,(%rax)
+  802f38:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802f39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f3f:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802f46:	00 00                	add    %al,(%rax)
+  802f48:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802f49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f4f:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802f56:	00 00                	add    %al,(%rax)
+  802f58:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802f59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f5f:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802f66:	00 00                	add    %al,(%rax)
+  802f68:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802f69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f6f:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802f76:	00 00                	add    %al,(%rax)
+  802f78:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802f79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f7f:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802f86:	00 00                	add    %al,(%rax)
+  802f88:	c7                   	(bad)
+  802f89:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f8f:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802f96:	00 00                	add    %al,(%rax)
+  802f98:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802f99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f9f:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802fa6:	00 00                	add    %al,(%rax)
+  802fa8:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802fa9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802faf:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802fb6:	00 00                	add    %al,(%rax)
+  802fb8:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802fb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fbf:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802fc6:	00 00                	add    %al,(%rax)
+  802fc8:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802fc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fcf:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802fd6:	00 00                	add    %al,(%rax)
+  802fd8:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802fd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fdf:	00 13                	add    %dl,(%rbx)
+  802fe1:	05 80 00 00 00       	add    $0x80,%eax
+  802fe6:	00 00                	add    %al,(%rax)
+  802fe8:	e2 06                	loop   802ff0 <__rodata_start+0x408>
+  802fea:	80 00 00             	addb   $0x0,(%rax)
+  802fed:	00 00                	add    %al,(%rax)
+  802fef:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  802ff6:	00 00                	add    %al,(%rax)
+  802ff8:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  802ff9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fff:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  803006:	00 00                	add    %al,(%rax)
+  803008:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  803009:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80300f:	00 42 05             	add    %al,0x5(%rdx)
+  803012:	80 00 00             	addb   $0x0,(%rax)
+  803015:	00 00                	add    %al,(%rax)
+  803017:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  80301e:	00 00                	add    %al,(%rax)
+  803020:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  803021:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803027:	00 08                	add    %cl,(%rax)
+  803029:	05 80 00 00 00       	add    $0x80,%eax
+  80302e:	00 00                	add    %al,(%rax)
+  803030:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  803031:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803037:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  80303e:	00 00                	add    %al,(%rax)
+  803040:	8a 08                	mov    (%rax),%cl
+  803042:	80 00 00             	addb   $0x0,(%rax)
+  803045:	00 00                	add    %al,(%rax)
+  803047:	00 54 09 80          	add    %dl,-0x80(%rcx,%rcx,1)
+  80304b:	00 00                	add    %al,(%rax)
+  80304d:	00 00                	add    %al,(%rax)
+  80304f:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  803056:	00 00                	add    %al,(%rax)
+  803058:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  803059:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80305f:	00 d9                	add    %bl,%cl
+  803061:	05 80 00 00 00       	add    $0x80,%eax
+  803066:	00 00                	add    %al,(%rax)
+  803068:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  803069:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80306f:	00 b6 07 80 00 00    	add    %dh,0x8007(%rsi)
+  803075:	00 00                	add    %al,(%rax)
+  803077:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  80307e:	00 00                	add    %al,(%rax)
+  803080:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  803081:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803087:	00 c7                	add    %al,%bh
+  803089:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80308f:	00 a4 0a 80 00 00 00 	add    %ah,0x80(%rdx,%rcx,1)
+  803096:	00 00                	add    %al,(%rax)
+  803098:	6c                   	insb   (%dx),%es:(%rdi)
+  803099:	04 80                	add    $0x80,%al
+  80309b:	00 00                	add    %al,(%rax)
+  80309d:	00 00                	add    %al,(%rax)
+	...
+
+00000000008030a0 <error_string>:
+	...
+  8030a8:	4c 2c 80 00 00 00 00 00 5e 2c 80 00 00 00 00 00     L,......^,......
+  8030b8:	6e 2c 80 00 00 00 00 00 80 2c 80 00 00 00 00 00     n,.......,......
+  8030c8:	8e 2c 80 00 00 00 00 00 a2 2c 80 00 00 00 00 00     .,.......,......
+  8030d8:	b7 2c 80 00 00 00 00 00 ca 2c 80 00 00 00 00 00     .,.......,......
+  8030e8:	dc 2c 80 00 00 00 00 00 f0 2c 80 00 00 00 00 00     .,.......,......
+  8030f8:	00 2d 80 00 00 00 00 00 13 2d 80 00 00 00 00 00     .-.......-......
+  803108:	2a 2d 80 00 00 00 00 00 40 2d 80 00 00 00 00 00     *-......@-......
+  803118:	58 2d 80 00 00 00 00 00 70 2d 80 00 00 00 00 00     X-......p-......
+  803128:	7d 2d 80 00 00 00 00 00 50 31 80 00 00 00 00 00     }-......P1......
+  803138:	91 2d 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .-..............
+  803148:	a9 2d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .-......file is 
+  803158:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803168:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803178:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803188:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803198:	6c 6c 2e 63 00 69 70 63 5f 73 65 6e 64 3a 20 66     ll.c.ipc_send: f
+  8031a8:	61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69     ailed to send.li
+  8031b8:	62 2f 69 70 63 2e 63 00 5b 25 30 38 78 5d 20 75     b/ipc.c.[%08x] u
+  8031c8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8031d8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8031e8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8031f8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803208:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803218:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803228:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803238:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803240 <devtab>:
+  803240:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803250:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803260:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803270:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803280:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803290:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8032a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8032b0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8032c0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8032d0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8032e0:	3a 20 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     : .f.........f..
+  8032f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803300:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803310:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803320:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803330:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803340:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803350:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803360:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803370:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803380:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803390:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8033d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803400:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803410:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803420:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803430:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803440:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803450:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803460:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803470:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803480:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803490:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803500:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803510:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803520:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803530:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803540:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803550:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803560:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803570:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803580:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803590:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803600:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803610:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803620:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803630:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803640:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803650:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803660:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803670:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803680:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803690:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803700:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
@@ -0,0 +1,5761 @@
+
+obj/user/fairshare:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 e1 03 00 00       	call   800404 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+static const int nices[NCHILD] = {0, 0, 3, 5};
+/* Scheduler weights of nices[] (see kern/sched.c) */
+static const uint64_t weights[NCHILD] = {1024, 1024, 526, 335};
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+  800030:	48 83 ec 10          	sub    $0x10,%rsp
+    envid_t children[NCHILD];
+
+    int res = sys_alloc_region(0, (void *)counters, PAGE_SIZE, PROT_RW | PROT_SHARE);
+  800034:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800039:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80003e:	be 00 00 00 10       	mov    $0x10000000,%esi
+  800043:	bf 00 00 00 00       	mov    $0x0,%edi
+  800048:	48 b8 f3 14 80 00 00 	movabs $0x8014f3,%rax
+  80004f:	00 00 00 
+  800052:	ff d0                	call   *%rax
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  800054:	85 c0                	test   %eax,%eax
+  800056:	0f 88 82 00 00 00    	js     8000de <umain+0xb9>
+  80005c:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+    for (int i = 0; i < NCHILD; i++) {
+        if ((children[i] = fork()) < 0) panic("fork: %i", children[i]);
+  800061:	49 bc 95 1a 80 00 00 	movabs $0x801a95,%r12
+  800068:	00 00 00 
+            while (!counters[NCHILD]) sys_yield();
+            if (sys_env_set_nice(0, nices[i] - 1) != -E_PERM) counters[NCHILD + 1]++;
+            if (sys_env_set_nice(0, nices[i]) < 0) counters[NCHILD + 1]++;
+            for (;;) counters[i]++;
+        }
+        if ((res = sys_env_set_nice(children[i], nices[i])) < 0)
+  80006b:	49 be 20 31 80 00 00 	movabs $0x803120,%r14
+  800072:	00 00 00 
+  800075:	49 bd 8d 16 80 00 00 	movabs $0x80168d,%r13
+  80007c:	00 00 00 
+        if ((children[i] = fork()) < 0) panic("fork: %i", children[i]);
+  80007f:	41 ff d4             	call   *%r12
+  800082:	89 c7                	mov    %eax,%edi
+  800084:	89 44 9d d0          	mov    %eax,-0x30(%rbp,%rbx,4)
+  800088:	85 c0                	test   %eax,%eax
+  80008a:	78 7f                	js     80010b <umain+0xe6>
+        if (!children[i]) {
+  80008c:	0f 84 a6 00 00 00    	je     800138 <umain+0x113>
+        if ((res = sys_env_set_nice(children[i], nices[i])) < 0)
+  800092:	41 8b 34 9e          	mov    (%r14,%rbx,4),%esi
+  800096:	41 ff d5             	call   *%r13
+  800099:	85 c0                	test   %eax,%eax
+  80009b:	0f 88 50 01 00 00    	js     8001f1 <umain+0x1cc>
+    for (int i = 0; i < NCHILD; i++) {
+  8000a1:	48 83 c3 01          	add    $0x1,%rbx
+  8000a5:	48 83 fb 04          	cmp    $0x4,%rbx
+  8000a9:	75 d4                	jne    80007f <umain+0x5a>
+            panic("sys_env_set_nice: %i", res);
+    }
+
+    int start = sys_gettime();
+  8000ab:	48 b8 c6 18 80 00 00 	movabs $0x8018c6,%rax
+  8000b2:	00 00 00 
+  8000b5:	ff d0                	call   *%rax
+  8000b7:	89 c3                	mov    %eax,%ebx
+    counters[NCHILD] = 1;
+  8000b9:	48 c7 04 25 20 00 00 	movq   $0x1,0x10000020
+  8000c0:	10 01 00 00 00 
+    while (sys_gettime() - start < SECONDS) sys_yield();
+  8000c5:	49 bc c6 18 80 00 00 	movabs $0x8018c6,%r12
+  8000cc:	00 00 00 
+  8000cf:	49 bd 64 14 80 00 00 	movabs $0x801464,%r13
+  8000d6:	00 00 00 
+  8000d9:	e9 43 01 00 00       	jmp    800221 <umain+0x1fc>
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  8000de:	89 c1                	mov    %eax,%ecx
+  8000e0:	48 ba f0 2f 80 00 00 	movabs $0x802ff0,%rdx
+  8000e7:	00 00 00 
+  8000ea:	be 18 00 00 00       	mov    $0x18,%esi
+  8000ef:	48 bf 05 30 80 00 00 	movabs $0x803005,%rdi
+  8000f6:	00 00 00 
+  8000f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fe:	49 b8 ce 04 80 00 00 	movabs $0x8004ce,%r8
+  800105:	00 00 00 
+  800108:	41 ff d0             	call   *%r8
+        if ((children[i] = fork()) < 0) panic("fork: %i", children[i]);
+  80010b:	89 c1                	mov    %eax,%ecx
+  80010d:	48 ba 16 30 80 00 00 	movabs $0x803016,%rdx
+  800114:	00 00 00 
+  800117:	be 1b 00 00 00       	mov    $0x1b,%esi
+  80011c:	48 bf 05 30 80 00 00 	movabs $0x803005,%rdi
+  800123:	00 00 00 
+  800126:	b8 00 00 00 00       	mov    $0x0,%eax
+  80012b:	49 b8 ce 04 80 00 00 	movabs $0x8004ce,%r8
+  800132:	00 00 00 
+  800135:	41 ff d0             	call   *%r8
+            while (!counters[NCHILD]) sys_yield();
+  800138:	48 8b 04 25 20 00 00 	mov    0x10000020,%rax
+  80013f:	10 
+  800140:	48 85 c0             	test   %rax,%rax
+  800143:	75 1a                	jne    80015f <umain+0x13a>
+  800145:	49 bc 64 14 80 00 00 	movabs $0x801464,%r12
+  80014c:	00 00 00 
+  80014f:	41 ff d4             	call   *%r12
+  800152:	48 8b 04 25 20 00 00 	mov    0x10000020,%rax
+  800159:	10 
+  80015a:	48 85 c0             	test   %rax,%rax
+  80015d:	74 f0                	je     80014f <umain+0x12a>
+  80015f:	41 89 dc             	mov    %ebx,%r12d
+            if (sys_env_set_nice(0, nices[i] - 1) != -E_PERM) counters[NCHILD + 1]++;
+  800162:	48 63 db             	movslq %ebx,%rbx
+  800165:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  80016c:	00 00 00 
+  80016f:	8b 34 98             	mov    (%rax,%rbx,4),%esi
+  800172:	83 ee 01             	sub    $0x1,%esi
+  800175:	bf 00 00 00 00       	mov    $0x0,%edi
+  80017a:	48 b8 8d 16 80 00 00 	movabs $0x80168d,%rax
+  800181:	00 00 00 
+  800184:	ff d0                	call   *%rax
+  800186:	83 f8 eb             	cmp    $0xffffffeb,%eax
+  800189:	74 14                	je     80019f <umain+0x17a>
+  80018b:	48 8b 04 25 28 00 00 	mov    0x10000028,%rax
+  800192:	10 
+  800193:	48 83 c0 01          	add    $0x1,%rax
+  800197:	48 89 04 25 28 00 00 	mov    %rax,0x10000028
+  80019e:	10 
+            if (sys_env_set_nice(0, nices[i]) < 0) counters[NCHILD + 1]++;
+  80019f:	49 63 c4             	movslq %r12d,%rax
+  8001a2:	48 ba 20 31 80 00 00 	movabs $0x803120,%rdx
+  8001a9:	00 00 00 
+  8001ac:	8b 34 82             	mov    (%rdx,%rax,4),%esi
+  8001af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001b4:	48 b8 8d 16 80 00 00 	movabs $0x80168d,%rax
+  8001bb:	00 00 00 
+  8001be:	ff d0                	call   *%rax
+  8001c0:	85 c0                	test   %eax,%eax
+  8001c2:	78 17                	js     8001db <umain+0x1b6>
+            for (;;) counters[i]++;
+  8001c4:	4d 63 e4             	movslq %r12d,%r12
+  8001c7:	4a 8d 14 e5 00 00 00 	lea    0x10000000(,%r12,8),%rdx
+  8001ce:	10 
+  8001cf:	48 8b 02             	mov    (%rdx),%rax
+  8001d2:	48 83 c0 01          	add    $0x1,%rax
+  8001d6:	48 89 02             	mov    %rax,(%rdx)
+  8001d9:	eb f4                	jmp    8001cf <umain+0x1aa>
+            if (sys_env_set_nice(0, nices[i]) < 0) counters[NCHILD + 1]++;
+  8001db:	48 8b 04 25 28 00 00 	mov    0x10000028,%rax
+  8001e2:	10 
+  8001e3:	48 83 c0 01          	add    $0x1,%rax
+  8001e7:	48 89 04 25 28 00 00 	mov    %rax,0x10000028
+  8001ee:	10 
+  8001ef:	eb d3                	jmp    8001c4 <umain+0x19f>
+            panic("sys_env_set_nice: %i", res);
+  8001f1:	89 c1                	mov    %eax,%ecx
+  8001f3:	48 ba 1f 30 80 00 00 	movabs $0x80301f,%rdx
+  8001fa:	00 00 00 
+  8001fd:	be 23 00 00 00       	mov    $0x23,%esi
+  800202:	48 bf 05 30 80 00 00 	movabs $0x803005,%rdi
+  800209:	00 00 00 
+  80020c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800211:	49 b8 ce 04 80 00 00 	movabs $0x8004ce,%r8
+  800218:	00 00 00 
+  80021b:	41 ff d0             	call   *%r8
+    while (sys_gettime() - start < SECONDS) sys_yield();
+  80021e:	41 ff d5             	call   *%r13
+  800221:	41 ff d4             	call   *%r12
+  800224:	29 d8                	sub    %ebx,%eax
+  800226:	83 f8 02             	cmp    $0x2,%eax
+  800229:	7e f3                	jle    80021e <umain+0x1f9>
+  80022b:	48 8d 5d d0          	lea    -0x30(%rbp),%rbx
+  80022f:	4c 8d 6d e0          	lea    -0x20(%rbp),%r13
+
+    for (int i = 0; i < NCHILD; i++)
+        sys_env_destroy(children[i]);
+  800233:	49 bc c8 13 80 00 00 	movabs $0x8013c8,%r12
+  80023a:	00 00 00 
+  80023d:	8b 3b                	mov    (%rbx),%edi
+  80023f:	41 ff d4             	call   *%r12
+    for (int i = 0; i < NCHILD; i++)
+  800242:	48 83 c3 04          	add    $0x4,%rbx
+  800246:	4c 39 eb             	cmp    %r13,%rbx
+  800249:	75 f2                	jne    80023d <umain+0x218>
+
+    if (!counters[0]) panic("child with nice 0 did not run");
+  80024b:	48 8b 04 25 00 00 00 	mov    0x10000000,%rax
+  800252:	10 
+  800253:	48 85 c0             	test   %rax,%rax
+  800256:	0f 84 1b 01 00 00    	je     800377 <umain+0x352>
+    if (counters[NCHILD + 1]) panic("child could lower its nice value");
+  80025c:	48 8b 04 25 28 00 00 	mov    0x10000028,%rax
+  800263:	10 
+  800264:	48 85 c0             	test   %rax,%rax
+  800267:	0f 85 2f 01 00 00    	jne    80039c <umain+0x377>
+
+    cprintf("nice  iterations  share of nice 0\n");
+  80026d:	48 bf a0 30 80 00 00 	movabs $0x8030a0,%rdi
+  800274:	00 00 00 
+  800277:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027c:	48 ba 1e 06 80 00 00 	movabs $0x80061e,%rdx
+  800283:	00 00 00 
+  800286:	ff d2                	call   *%rdx
+    for (int i = 0; i < NCHILD; i++)
+  800288:	49 bc 20 31 80 00 00 	movabs $0x803120,%r12
+  80028f:	00 00 00 
+    cprintf("nice  iterations  share of nice 0\n");
+  800292:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+        cprintf("%4d  %10lu  %lu%%\n", nices[i], (unsigned long)counters[i],
+  800297:	49 be 52 30 80 00 00 	movabs $0x803052,%r14
+  80029e:	00 00 00 
+  8002a1:	49 bd 1e 06 80 00 00 	movabs $0x80061e,%r13
+  8002a8:	00 00 00 
+                (unsigned long)(counters[i] * 100 / counters[0]));
+  8002ab:	48 8b 03             	mov    (%rbx),%rax
+  8002ae:	48 8b 0c 25 00 00 00 	mov    0x10000000,%rcx
+  8002b5:	10 
+        cprintf("%4d  %10lu  %lu%%\n", nices[i], (unsigned long)counters[i],
+  8002b6:	48 8b 3b             	mov    (%rbx),%rdi
+                (unsigned long)(counters[i] * 100 / counters[0]));
+  8002b9:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  8002bd:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  8002c1:	48 c1 e0 02          	shl    $0x2,%rax
+  8002c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ca:	48 f7 f1             	div    %rcx
+        cprintf("%4d  %10lu  %lu%%\n", nices[i], (unsigned long)counters[i],
+  8002cd:	41 8b 34 24          	mov    (%r12),%esi
+  8002d1:	48 89 c1             	mov    %rax,%rcx
+  8002d4:	48 89 fa             	mov    %rdi,%rdx
+  8002d7:	4c 89 f7             	mov    %r14,%rdi
+  8002da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002df:	41 ff d5             	call   *%r13
+    for (int i = 0; i < NCHILD; i++)
+  8002e2:	48 83 c3 08          	add    $0x8,%rbx
+  8002e6:	49 83 c4 04          	add    $0x4,%r12
+  8002ea:	48 81 fb 20 00 00 10 	cmp    $0x10000020,%rbx
+  8002f1:	75 b8                	jne    8002ab <umain+0x286>
+  8002f3:	b8 08 00 00 10       	mov    $0x10000008,%eax
+
+    /* Allow 25% deviation from the weight ratio */
+    for (int i = 1; i < NCHILD; i++) {
+  8002f8:	b9 01 00 00 00       	mov    $0x1,%ecx
+        uint64_t expected = counters[0] * weights[i] / weights[0];
+  8002fd:	48 bf 00 31 80 f0 ff 	movabs $0xfffffffff0803100,%rdi
+  800304:	ff ff ff 
+  800307:	4c 8b 0c 25 00 00 00 	mov    0x10000000,%r9
+  80030e:	10 
+  80030f:	4c 0f af 0c 07       	imul   (%rdi,%rax,1),%r9
+  800314:	49 c1 e9 0a          	shr    $0xa,%r9
+        if (counters[i] * 4 < expected * 3 || counters[i] * 4 > expected * 5)
+  800318:	49 89 c0             	mov    %rax,%r8
+  80031b:	48 8b 10             	mov    (%rax),%rdx
+  80031e:	48 c1 e2 02          	shl    $0x2,%rdx
+  800322:	4b 8d 34 49          	lea    (%r9,%r9,2),%rsi
+  800326:	48 39 f2             	cmp    %rsi,%rdx
+  800329:	0f 82 97 00 00 00    	jb     8003c6 <umain+0x3a1>
+  80032f:	48 8b 10             	mov    (%rax),%rdx
+  800332:	48 c1 e2 02          	shl    $0x2,%rdx
+  800336:	4b 8d 34 89          	lea    (%r9,%r9,4),%rsi
+  80033a:	48 39 d6             	cmp    %rdx,%rsi
+  80033d:	0f 82 83 00 00 00    	jb     8003c6 <umain+0x3a1>
+    for (int i = 1; i < NCHILD; i++) {
+  800343:	83 c1 01             	add    $0x1,%ecx
+  800346:	48 83 c0 08          	add    $0x8,%rax
+  80034a:	83 f9 04             	cmp    $0x4,%ecx
+  80034d:	75 b8                	jne    800307 <umain+0x2e2>
+            panic("nice %d got %lu iterations, expected about %lu",
+                  nices[i], (unsigned long)counters[i], (unsigned long)expected);
+    }
+    cprintf("fairshare: OK\n");
+  80034f:	48 bf 65 30 80 00 00 	movabs $0x803065,%rdi
+  800356:	00 00 00 
+  800359:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035e:	48 ba 1e 06 80 00 00 	movabs $0x80061e,%rdx
+  800365:	00 00 00 
+  800368:	ff d2                	call   *%rdx
+}
+  80036a:	48 83 c4 10          	add    $0x10,%rsp
+  80036e:	5b                   	pop    %rbx
+  80036f:	41 5c                	pop    %r12
+  800371:	41 5d                	pop    %r13
+  800373:	41 5e                	pop    %r14
+  800375:	5d                   	pop    %rbp
+  800376:	c3                   	ret
+    if (!counters[0]) panic("child with nice 0 did not run");
+  800377:	48 ba 34 30 80 00 00 	movabs $0x803034,%rdx
+  80037e:	00 00 00 
+  800381:	be 2d 00 00 00       	mov    $0x2d,%esi
+  800386:	48 bf 05 30 80 00 00 	movabs $0x803005,%rdi
+  80038d:	00 00 00 
+  800390:	48 b9 ce 04 80 00 00 	movabs $0x8004ce,%rcx
+  800397:	00 00 00 
+  80039a:	ff d1                	call   *%rcx
+    if (counters[NCHILD + 1]) panic("child could lower its nice value");
+  80039c:	48 ba 78 30 80 00 00 	movabs $0x803078,%rdx
+  8003a3:	00 00 00 
+  8003a6:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8003ab:	48 bf 05 30 80 00 00 	movabs $0x803005,%rdi
+  8003b2:	00 00 00 
+  8003b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ba:	48 b9 ce 04 80 00 00 	movabs $0x8004ce,%rcx
+  8003c1:	00 00 00 
+  8003c4:	ff d1                	call   *%rcx
+            panic("nice %d got %lu iterations, expected about %lu",
+  8003c6:	4d 8b 00             	mov    (%r8),%r8
+  8003c9:	48 63 c9             	movslq %ecx,%rcx
+  8003cc:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  8003d3:	00 00 00 
+  8003d6:	8b 0c 88             	mov    (%rax,%rcx,4),%ecx
+  8003d9:	48 ba c8 30 80 00 00 	movabs $0x8030c8,%rdx
+  8003e0:	00 00 00 
+  8003e3:	be 39 00 00 00       	mov    $0x39,%esi
+  8003e8:	48 bf 05 30 80 00 00 	movabs $0x803005,%rdi
+  8003ef:	00 00 00 
+  8003f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f7:	49 ba ce 04 80 00 00 	movabs $0x8004ce,%r10
+  8003fe:	00 00 00 
+  800401:	41 ff d2             	call   *%r10
+
+0000000000800404 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800404:	55                   	push   %rbp
+  800405:	48 89 e5             	mov    %rsp,%rbp
+  800408:	41 56                	push   %r14
+  80040a:	41 55                	push   %r13
+  80040c:	41 54                	push   %r12
+  80040e:	53                   	push   %rbx
+  80040f:	41 89 fd             	mov    %edi,%r13d
+  800412:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800415:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80041c:	00 00 00 
+  80041f:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800426:	00 00 00 
+  800429:	48 39 c2             	cmp    %rax,%rdx
+  80042c:	73 17                	jae    800445 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80042e:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800431:	49 89 c4             	mov    %rax,%r12
+  800434:	48 83 c3 08          	add    $0x8,%rbx
+  800438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043d:	ff 53 f8             	call   *-0x8(%rbx)
+  800440:	4c 39 e3             	cmp    %r12,%rbx
+  800443:	72 ef                	jb     800434 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800445:	48 b8 33 14 80 00 00 	movabs $0x801433,%rax
+  80044c:	00 00 00 
+  80044f:	ff d0                	call   *%rax
+  800451:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800454:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80045b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800462:	00 00 00 
+  800465:	48 01 d0             	add    %rdx,%rax
+  800468:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80046f:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800472:	45 85 ed             	test   %r13d,%r13d
+  800475:	7e 0d                	jle    800484 <libmain+0x80>
+  800477:	49 8b 06             	mov    (%r14),%rax
+  80047a:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800481:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800484:	4c 89 f6             	mov    %r14,%rsi
+  800487:	44 89 ef             	mov    %r13d,%edi
+  80048a:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800491:	00 00 00 
+  800494:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800496:	48 b8 ab 04 80 00 00 	movabs $0x8004ab,%rax
+  80049d:	00 00 00 
+  8004a0:	ff d0                	call   *%rax
+#endif
+}
+  8004a2:	5b                   	pop    %rbx
+  8004a3:	41 5c                	pop    %r12
+  8004a5:	41 5d                	pop    %r13
+  8004a7:	41 5e                	pop    %r14
+  8004a9:	5d                   	pop    %rbp
+  8004aa:	c3                   	ret
+
+00000000008004ab <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8004ab:	55                   	push   %rbp
+  8004ac:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8004af:	48 b8 bb 1d 80 00 00 	movabs $0x801dbb,%rax
+  8004b6:	00 00 00 
+  8004b9:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8004bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004c0:	48 b8 c8 13 80 00 00 	movabs $0x8013c8,%rax
+  8004c7:	00 00 00 
+  8004ca:	ff d0                	call   *%rax
+}
+  8004cc:	5d                   	pop    %rbp
+  8004cd:	c3                   	ret
+
+00000000008004ce <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8004ce:	55                   	push   %rbp
+  8004cf:	48 89 e5             	mov    %rsp,%rbp
+  8004d2:	41 56                	push   %r14
+  8004d4:	41 55                	push   %r13
+  8004d6:	41 54                	push   %r12
+  8004d8:	53                   	push   %rbx
+  8004d9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004dd:	49 89 fc             	mov    %rdi,%r12
+  8004e0:	41 89 f5             	mov    %esi,%r13d
+  8004e3:	48 89 d3             	mov    %rdx,%rbx
+  8004e6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8004ea:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8004ee:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8004f2:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8004f9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004fd:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800501:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800505:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800509:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800510:	00 00 00 
+  800513:	4c 8b 30             	mov    (%rax),%r14
+  800516:	48 b8 33 14 80 00 00 	movabs $0x801433,%rax
+  80051d:	00 00 00 
+  800520:	ff d0                	call   *%rax
+  800522:	89 c6                	mov    %eax,%esi
+  800524:	45 89 e8             	mov    %r13d,%r8d
+  800527:	4c 89 e1             	mov    %r12,%rcx
+  80052a:	4c 89 f2             	mov    %r14,%rdx
+  80052d:	48 bf 40 31 80 00 00 	movabs $0x803140,%rdi
+  800534:	00 00 00 
+  800537:	b8 00 00 00 00       	mov    $0x0,%eax
+  80053c:	49 bc 1e 06 80 00 00 	movabs $0x80061e,%r12
+  800543:	00 00 00 
+  800546:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800549:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80054d:	48 89 df             	mov    %rbx,%rdi
+  800550:	48 b8 ba 05 80 00 00 	movabs $0x8005ba,%rax
+  800557:	00 00 00 
+  80055a:	ff d0                	call   *%rax
+    cprintf("\n");
+  80055c:	48 bf 63 30 80 00 00 	movabs $0x803063,%rdi
+  800563:	00 00 00 
+  800566:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80056e:	cc                   	int3
+  80056f:	eb fd                	jmp    80056e <_panic+0xa0>
+
+0000000000800571 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800571:	55                   	push   %rbp
+  800572:	48 89 e5             	mov    %rsp,%rbp
+  800575:	53                   	push   %rbx
+  800576:	48 83 ec 08          	sub    $0x8,%rsp
+  80057a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80057d:	8b 06                	mov    (%rsi),%eax
+  80057f:	8d 50 01             	lea    0x1(%rax),%edx
+  800582:	89 16                	mov    %edx,(%rsi)
+  800584:	48 98                	cltq
+  800586:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80058b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800591:	74 0a                	je     80059d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800593:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800597:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80059b:	c9                   	leave
+  80059c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80059d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8005a1:	be ff 00 00 00       	mov    $0xff,%esi
+  8005a6:	48 b8 6a 13 80 00 00 	movabs $0x80136a,%rax
+  8005ad:	00 00 00 
+  8005b0:	ff d0                	call   *%rax
+        state->offset = 0;
+  8005b2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8005b8:	eb d9                	jmp    800593 <putch+0x22>
+
+00000000008005ba <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8005ba:	55                   	push   %rbp
+  8005bb:	48 89 e5             	mov    %rsp,%rbp
+  8005be:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8005c5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8005c8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8005cf:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8005d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8005dc:	48 89 f1             	mov    %rsi,%rcx
+  8005df:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8005e6:	48 bf 71 05 80 00 00 	movabs $0x800571,%rdi
+  8005ed:	00 00 00 
+  8005f0:	48 b8 6e 07 80 00 00 	movabs $0x80076e,%rax
+  8005f7:	00 00 00 
+  8005fa:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8005fc:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800603:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80060a:	48 b8 6a 13 80 00 00 	movabs $0x80136a,%rax
+  800611:	00 00 00 
+  800614:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800616:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80061c:	c9                   	leave
+  80061d:	c3                   	ret
+
+000000000080061e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80061e:	55                   	push   %rbp
+  80061f:	48 89 e5             	mov    %rsp,%rbp
+  800622:	48 83 ec 50          	sub    $0x50,%rsp
+  800626:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80062a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80062e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800632:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800636:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80063a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800641:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800645:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800649:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80064d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800651:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800655:	48 b8 ba 05 80 00 00 	movabs $0x8005ba,%rax
+  80065c:	00 00 00 
+  80065f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800661:	c9                   	leave
+  800662:	c3                   	ret
+
+0000000000800663 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800663:	55                   	push   %rbp
+  800664:	48 89 e5             	mov    %rsp,%rbp
+  800667:	41 57                	push   %r15
+  800669:	41 56                	push   %r14
+  80066b:	41 55                	push   %r13
+  80066d:	41 54                	push   %r12
+  80066f:	53                   	push   %rbx
+  800670:	48 83 ec 18          	sub    $0x18,%rsp
+  800674:	49 89 fc             	mov    %rdi,%r12
+  800677:	49 89 f5             	mov    %rsi,%r13
+  80067a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80067e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800681:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800684:	41 89 cf             	mov    %ecx,%r15d
+  800687:	4c 39 fa             	cmp    %r15,%rdx
+  80068a:	73 5b                	jae    8006e7 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80068c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800690:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800694:	85 db                	test   %ebx,%ebx
+  800696:	7e 0e                	jle    8006a6 <print_num+0x43>
+            putch(padc, put_arg);
+  800698:	4c 89 ee             	mov    %r13,%rsi
+  80069b:	44 89 f7             	mov    %r14d,%edi
+  80069e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8006a1:	83 eb 01             	sub    $0x1,%ebx
+  8006a4:	75 f2                	jne    800698 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8006a6:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8006aa:	48 b9 74 31 80 00 00 	movabs $0x803174,%rcx
+  8006b1:	00 00 00 
+  8006b4:	48 b8 63 31 80 00 00 	movabs $0x803163,%rax
+  8006bb:	00 00 00 
+  8006be:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8006c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006cb:	49 f7 f7             	div    %r15
+  8006ce:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8006d2:	4c 89 ee             	mov    %r13,%rsi
+  8006d5:	41 ff d4             	call   *%r12
+}
+  8006d8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8006dc:	5b                   	pop    %rbx
+  8006dd:	41 5c                	pop    %r12
+  8006df:	41 5d                	pop    %r13
+  8006e1:	41 5e                	pop    %r14
+  8006e3:	41 5f                	pop    %r15
+  8006e5:	5d                   	pop    %rbp
+  8006e6:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8006e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006f0:	49 f7 f7             	div    %r15
+  8006f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8006f7:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8006fb:	52                   	push   %rdx
+  8006fc:	45 0f be c9          	movsbl %r9b,%r9d
+  800700:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800704:	48 89 c2             	mov    %rax,%rdx
+  800707:	48 b8 63 06 80 00 00 	movabs $0x800663,%rax
+  80070e:	00 00 00 
+  800711:	ff d0                	call   *%rax
+  800713:	48 83 c4 10          	add    $0x10,%rsp
+  800717:	eb 8d                	jmp    8006a6 <print_num+0x43>
+
+0000000000800719 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800719:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80071d:	48 8b 06             	mov    (%rsi),%rax
+  800720:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800724:	73 0a                	jae    800730 <sprintputch+0x17>
+        *state->start++ = ch;
+  800726:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80072a:	48 89 16             	mov    %rdx,(%rsi)
+  80072d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800730:	c3                   	ret
+
+0000000000800731 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800731:	55                   	push   %rbp
+  800732:	48 89 e5             	mov    %rsp,%rbp
+  800735:	48 83 ec 50          	sub    $0x50,%rsp
+  800739:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80073d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800741:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800745:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80074c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800750:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800754:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800758:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80075c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800760:	48 b8 6e 07 80 00 00 	movabs $0x80076e,%rax
+  800767:	00 00 00 
+  80076a:	ff d0                	call   *%rax
+}
+  80076c:	c9                   	leave
+  80076d:	c3                   	ret
+
+000000000080076e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80076e:	55                   	push   %rbp
+  80076f:	48 89 e5             	mov    %rsp,%rbp
+  800772:	41 57                	push   %r15
+  800774:	41 56                	push   %r14
+  800776:	41 55                	push   %r13
+  800778:	41 54                	push   %r12
+  80077a:	53                   	push   %rbx
+  80077b:	48 83 ec 38          	sub    $0x38,%rsp
+  80077f:	49 89 fe             	mov    %rdi,%r14
+  800782:	49 89 f5             	mov    %rsi,%r13
+  800785:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800788:	48 8b 01             	mov    (%rcx),%rax
+  80078b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80078f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800793:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800797:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80079b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80079f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8007a3:	0f b6 3b             	movzbl (%rbx),%edi
+  8007a6:	40 80 ff 25          	cmp    $0x25,%dil
+  8007aa:	74 18                	je     8007c4 <vprintfmt+0x56>
+            if (!ch) return;
+  8007ac:	40 84 ff             	test   %dil,%dil
+  8007af:	0f 84 b1 06 00 00    	je     800e66 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8007b5:	40 0f b6 ff          	movzbl %dil,%edi
+  8007b9:	4c 89 ee             	mov    %r13,%rsi
+  8007bc:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8007bf:	4c 89 e3             	mov    %r12,%rbx
+  8007c2:	eb db                	jmp    80079f <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8007c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8007c9:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8007cd:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8007d2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007d8:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8007df:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007e3:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8007e8:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8007ed:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8007f0:	83 e8 23             	sub    $0x23,%eax
+  8007f3:	3c 57                	cmp    $0x57,%al
+  8007f5:	0f 87 51 06 00 00    	ja     800e4c <vprintfmt+0x6de>
+  8007fb:	0f b6 c0             	movzbl %al,%eax
+  8007fe:	48 b9 20 33 80 00 00 	movabs $0x803320,%rcx
+  800805:	00 00 00 
+  800808:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80080b:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80080e:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800812:	eb cf                	jmp    8007e3 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800814:	49 89 dc             	mov    %rbx,%r12
+  800817:	be 01 00 00 00       	mov    $0x1,%esi
+  80081c:	eb c5                	jmp    8007e3 <vprintfmt+0x75>
+            padc = ch;
+  80081e:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800822:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800825:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800828:	eb b9                	jmp    8007e3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80082a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082d:	83 f8 2f             	cmp    $0x2f,%eax
+  800830:	77 24                	ja     800856 <vprintfmt+0xe8>
+  800832:	89 c1                	mov    %eax,%ecx
+  800834:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800838:	83 c0 08             	add    $0x8,%eax
+  80083b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800841:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800844:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800848:	79 99                	jns    8007e3 <vprintfmt+0x75>
+                width = precision;
+  80084a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80084e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800854:	eb 8d                	jmp    8007e3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800856:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80085a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80085e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800862:	eb da                	jmp    80083e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800864:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800869:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80086d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800873:	3c 39                	cmp    $0x39,%al
+  800875:	77 1c                	ja     800893 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800877:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80087b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80087f:	0f b6 c0             	movzbl %al,%eax
+  800882:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800887:	0f b6 03             	movzbl (%rbx),%eax
+  80088a:	3c 39                	cmp    $0x39,%al
+  80088c:	76 e9                	jbe    800877 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80088e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800891:	eb b1                	jmp    800844 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800893:	49 89 dc             	mov    %rbx,%r12
+  800896:	eb ac                	jmp    800844 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800898:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80089b:	85 c9                	test   %ecx,%ecx
+  80089d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a2:	0f 49 c1             	cmovns %ecx,%eax
+  8008a5:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8008a8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008ab:	e9 33 ff ff ff       	jmp    8007e3 <vprintfmt+0x75>
+            lflag++;
+  8008b0:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8008b3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008b6:	e9 28 ff ff ff       	jmp    8007e3 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8008bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008be:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c1:	77 19                	ja     8008dc <vprintfmt+0x16e>
+  8008c3:	89 c2                	mov    %eax,%edx
+  8008c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c9:	83 c0 08             	add    $0x8,%eax
+  8008cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008cf:	8b 3a                	mov    (%rdx),%edi
+  8008d1:	4c 89 ee             	mov    %r13,%rsi
+  8008d4:	41 ff d6             	call   *%r14
+            break;
+  8008d7:	e9 c3 fe ff ff       	jmp    80079f <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8008dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e8:	eb e5                	jmp    8008cf <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8008ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f0:	77 5a                	ja     80094c <vprintfmt+0x1de>
+  8008f2:	89 c2                	mov    %eax,%edx
+  8008f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f8:	83 c0 08             	add    $0x8,%eax
+  8008fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8008fe:	8b 02                	mov    (%rdx),%eax
+  800900:	89 c1                	mov    %eax,%ecx
+  800902:	f7 d9                	neg    %ecx
+  800904:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800907:	83 f9 15             	cmp    $0x15,%ecx
+  80090a:	7f 4e                	jg     80095a <vprintfmt+0x1ec>
+  80090c:	48 63 c1             	movslq %ecx,%rax
+  80090f:	48 ba e0 35 80 00 00 	movabs $0x8035e0,%rdx
+  800916:	00 00 00 
+  800919:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80091d:	48 85 c0             	test   %rax,%rax
+  800920:	74 38                	je     80095a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800922:	48 89 c1             	mov    %rax,%rcx
+  800925:	48 ba d9 37 80 00 00 	movabs $0x8037d9,%rdx
+  80092c:	00 00 00 
+  80092f:	4c 89 ee             	mov    %r13,%rsi
+  800932:	4c 89 f7             	mov    %r14,%rdi
+  800935:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093a:	49 b8 31 07 80 00 00 	movabs $0x800731,%r8
+  800941:	00 00 00 
+  800944:	41 ff d0             	call   *%r8
+  800947:	e9 53 fe ff ff       	jmp    80079f <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80094c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800950:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800954:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800958:	eb a4                	jmp    8008fe <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80095a:	48 ba 8c 31 80 00 00 	movabs $0x80318c,%rdx
+  800961:	00 00 00 
+  800964:	4c 89 ee             	mov    %r13,%rsi
+  800967:	4c 89 f7             	mov    %r14,%rdi
+  80096a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096f:	49 b8 31 07 80 00 00 	movabs $0x800731,%r8
+  800976:	00 00 00 
+  800979:	41 ff d0             	call   *%r8
+  80097c:	e9 1e fe ff ff       	jmp    80079f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800981:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800984:	83 f8 2f             	cmp    $0x2f,%eax
+  800987:	77 6c                	ja     8009f5 <vprintfmt+0x287>
+  800989:	89 c2                	mov    %eax,%edx
+  80098b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098f:	83 c0 08             	add    $0x8,%eax
+  800992:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800995:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800998:	48 85 d2             	test   %rdx,%rdx
+  80099b:	48 b8 85 31 80 00 00 	movabs $0x803185,%rax
+  8009a2:	00 00 00 
+  8009a5:	48 0f 45 c2          	cmovne %rdx,%rax
+  8009a9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8009ad:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009b1:	7e 06                	jle    8009b9 <vprintfmt+0x24b>
+  8009b3:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8009b7:	75 4a                	jne    800a03 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009b9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009bd:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009c1:	0f b6 00             	movzbl (%rax),%eax
+  8009c4:	84 c0                	test   %al,%al
+  8009c6:	0f 85 9a 00 00 00    	jne    800a66 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8009cc:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009cf:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8009d3:	85 c0                	test   %eax,%eax
+  8009d5:	0f 8e c4 fd ff ff    	jle    80079f <vprintfmt+0x31>
+  8009db:	4c 89 ee             	mov    %r13,%rsi
+  8009de:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009e3:	41 ff d6             	call   *%r14
+  8009e6:	41 83 ec 01          	sub    $0x1,%r12d
+  8009ea:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8009ee:	75 eb                	jne    8009db <vprintfmt+0x26d>
+  8009f0:	e9 aa fd ff ff       	jmp    80079f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8009f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a01:	eb 92                	jmp    800995 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800a03:	49 63 f7             	movslq %r15d,%rsi
+  800a06:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800a0a:	48 b8 20 0f 80 00 00 	movabs $0x800f20,%rax
+  800a11:	00 00 00 
+  800a14:	ff d0                	call   *%rax
+  800a16:	48 89 c2             	mov    %rax,%rdx
+  800a19:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a1c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800a1e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800a21:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800a24:	85 c0                	test   %eax,%eax
+  800a26:	7e 91                	jle    8009b9 <vprintfmt+0x24b>
+  800a28:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800a2d:	4c 89 ee             	mov    %r13,%rsi
+  800a30:	44 89 e7             	mov    %r12d,%edi
+  800a33:	41 ff d6             	call   *%r14
+  800a36:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a3a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a3d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800a40:	75 eb                	jne    800a2d <vprintfmt+0x2bf>
+  800a42:	e9 72 ff ff ff       	jmp    8009b9 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a47:	0f b6 f8             	movzbl %al,%edi
+  800a4a:	4c 89 ee             	mov    %r13,%rsi
+  800a4d:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a50:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a54:	49 83 c4 01          	add    $0x1,%r12
+  800a58:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800a5e:	84 c0                	test   %al,%al
+  800a60:	0f 84 66 ff ff ff    	je     8009cc <vprintfmt+0x25e>
+  800a66:	45 85 ff             	test   %r15d,%r15d
+  800a69:	78 0a                	js     800a75 <vprintfmt+0x307>
+  800a6b:	41 83 ef 01          	sub    $0x1,%r15d
+  800a6f:	0f 88 57 ff ff ff    	js     8009cc <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a75:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a79:	74 cc                	je     800a47 <vprintfmt+0x2d9>
+  800a7b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a7e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a83:	80 fa 5e             	cmp    $0x5e,%dl
+  800a86:	77 c2                	ja     800a4a <vprintfmt+0x2dc>
+  800a88:	eb bd                	jmp    800a47 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a8a:	40 84 f6             	test   %sil,%sil
+  800a8d:	75 26                	jne    800ab5 <vprintfmt+0x347>
+    switch (lflag) {
+  800a8f:	85 d2                	test   %edx,%edx
+  800a91:	74 59                	je     800aec <vprintfmt+0x37e>
+  800a93:	83 fa 01             	cmp    $0x1,%edx
+  800a96:	74 7b                	je     800b13 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a9b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9e:	0f 87 96 00 00 00    	ja     800b3a <vprintfmt+0x3cc>
+  800aa4:	89 c2                	mov    %eax,%edx
+  800aa6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aaa:	83 c0 08             	add    $0x8,%eax
+  800aad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab0:	4c 8b 22             	mov    (%rdx),%r12
+  800ab3:	eb 17                	jmp    800acc <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800ab5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab8:	83 f8 2f             	cmp    $0x2f,%eax
+  800abb:	77 21                	ja     800ade <vprintfmt+0x370>
+  800abd:	89 c2                	mov    %eax,%edx
+  800abf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac3:	83 c0 08             	add    $0x8,%eax
+  800ac6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac9:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800acc:	4d 85 e4             	test   %r12,%r12
+  800acf:	78 7a                	js     800b4b <vprintfmt+0x3dd>
+            num = i;
+  800ad1:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800ad4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800ad9:	e9 50 02 00 00       	jmp    800d2e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ade:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aea:	eb dd                	jmp    800ac9 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800aec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aef:	83 f8 2f             	cmp    $0x2f,%eax
+  800af2:	77 11                	ja     800b05 <vprintfmt+0x397>
+  800af4:	89 c2                	mov    %eax,%edx
+  800af6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800afa:	83 c0 08             	add    $0x8,%eax
+  800afd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b00:	4c 63 22             	movslq (%rdx),%r12
+  800b03:	eb c7                	jmp    800acc <vprintfmt+0x35e>
+  800b05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b09:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b11:	eb ed                	jmp    800b00 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800b13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b16:	83 f8 2f             	cmp    $0x2f,%eax
+  800b19:	77 11                	ja     800b2c <vprintfmt+0x3be>
+  800b1b:	89 c2                	mov    %eax,%edx
+  800b1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b21:	83 c0 08             	add    $0x8,%eax
+  800b24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b27:	4c 8b 22             	mov    (%rdx),%r12
+  800b2a:	eb a0                	jmp    800acc <vprintfmt+0x35e>
+  800b2c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b30:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b34:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b38:	eb ed                	jmp    800b27 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800b3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b46:	e9 65 ff ff ff       	jmp    800ab0 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800b4b:	4c 89 ee             	mov    %r13,%rsi
+  800b4e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b53:	41 ff d6             	call   *%r14
+                i = -i;
+  800b56:	49 f7 dc             	neg    %r12
+  800b59:	e9 73 ff ff ff       	jmp    800ad1 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800b5e:	40 84 f6             	test   %sil,%sil
+  800b61:	75 32                	jne    800b95 <vprintfmt+0x427>
+    switch (lflag) {
+  800b63:	85 d2                	test   %edx,%edx
+  800b65:	74 5d                	je     800bc4 <vprintfmt+0x456>
+  800b67:	83 fa 01             	cmp    $0x1,%edx
+  800b6a:	0f 84 82 00 00 00    	je     800bf2 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800b70:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b73:	83 f8 2f             	cmp    $0x2f,%eax
+  800b76:	0f 87 a5 00 00 00    	ja     800c21 <vprintfmt+0x4b3>
+  800b7c:	89 c2                	mov    %eax,%edx
+  800b7e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b82:	83 c0 08             	add    $0x8,%eax
+  800b85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b88:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b8b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b90:	e9 99 01 00 00       	jmp    800d2e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b95:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b98:	83 f8 2f             	cmp    $0x2f,%eax
+  800b9b:	77 19                	ja     800bb6 <vprintfmt+0x448>
+  800b9d:	89 c2                	mov    %eax,%edx
+  800b9f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba3:	83 c0 08             	add    $0x8,%eax
+  800ba6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800bac:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bb1:	e9 78 01 00 00       	jmp    800d2e <vprintfmt+0x5c0>
+  800bb6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bbe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc2:	eb e5                	jmp    800ba9 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800bc4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc7:	83 f8 2f             	cmp    $0x2f,%eax
+  800bca:	77 18                	ja     800be4 <vprintfmt+0x476>
+  800bcc:	89 c2                	mov    %eax,%edx
+  800bce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd2:	83 c0 08             	add    $0x8,%eax
+  800bd5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd8:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800bda:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800bdf:	e9 4a 01 00 00       	jmp    800d2e <vprintfmt+0x5c0>
+  800be4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf0:	eb e6                	jmp    800bd8 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800bf2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf5:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf8:	77 19                	ja     800c13 <vprintfmt+0x4a5>
+  800bfa:	89 c2                	mov    %eax,%edx
+  800bfc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c00:	83 c0 08             	add    $0x8,%eax
+  800c03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c06:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c09:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800c0e:	e9 1b 01 00 00       	jmp    800d2e <vprintfmt+0x5c0>
+  800c13:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c17:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c1f:	eb e5                	jmp    800c06 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800c21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2d:	e9 56 ff ff ff       	jmp    800b88 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800c32:	40 84 f6             	test   %sil,%sil
+  800c35:	75 2e                	jne    800c65 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800c37:	85 d2                	test   %edx,%edx
+  800c39:	74 59                	je     800c94 <vprintfmt+0x526>
+  800c3b:	83 fa 01             	cmp    $0x1,%edx
+  800c3e:	74 7f                	je     800cbf <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800c40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c43:	83 f8 2f             	cmp    $0x2f,%eax
+  800c46:	0f 87 9f 00 00 00    	ja     800ceb <vprintfmt+0x57d>
+  800c4c:	89 c2                	mov    %eax,%edx
+  800c4e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c52:	83 c0 08             	add    $0x8,%eax
+  800c55:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c58:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c5b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c60:	e9 c9 00 00 00       	jmp    800d2e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c68:	83 f8 2f             	cmp    $0x2f,%eax
+  800c6b:	77 19                	ja     800c86 <vprintfmt+0x518>
+  800c6d:	89 c2                	mov    %eax,%edx
+  800c6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c73:	83 c0 08             	add    $0x8,%eax
+  800c76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c79:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c7c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c81:	e9 a8 00 00 00       	jmp    800d2e <vprintfmt+0x5c0>
+  800c86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c92:	eb e5                	jmp    800c79 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c97:	83 f8 2f             	cmp    $0x2f,%eax
+  800c9a:	77 15                	ja     800cb1 <vprintfmt+0x543>
+  800c9c:	89 c2                	mov    %eax,%edx
+  800c9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ca2:	83 c0 08             	add    $0x8,%eax
+  800ca5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ca8:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800caa:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800caf:	eb 7d                	jmp    800d2e <vprintfmt+0x5c0>
+  800cb1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cb5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cb9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cbd:	eb e9                	jmp    800ca8 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800cbf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cc2:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc5:	77 16                	ja     800cdd <vprintfmt+0x56f>
+  800cc7:	89 c2                	mov    %eax,%edx
+  800cc9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ccd:	83 c0 08             	add    $0x8,%eax
+  800cd0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800cd6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800cdb:	eb 51                	jmp    800d2e <vprintfmt+0x5c0>
+  800cdd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ce1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ce5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce9:	eb e8                	jmp    800cd3 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800ceb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf7:	e9 5c ff ff ff       	jmp    800c58 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800cfc:	4c 89 ee             	mov    %r13,%rsi
+  800cff:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d04:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800d07:	4c 89 ee             	mov    %r13,%rsi
+  800d0a:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d0f:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800d12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d15:	83 f8 2f             	cmp    $0x2f,%eax
+  800d18:	77 47                	ja     800d61 <vprintfmt+0x5f3>
+  800d1a:	89 c2                	mov    %eax,%edx
+  800d1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d20:	83 c0 08             	add    $0x8,%eax
+  800d23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d26:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d29:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800d2e:	48 83 ec 08          	sub    $0x8,%rsp
+  800d32:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800d36:	0f 94 c0             	sete   %al
+  800d39:	0f b6 c0             	movzbl %al,%eax
+  800d3c:	50                   	push   %rax
+  800d3d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800d42:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800d46:	4c 89 ee             	mov    %r13,%rsi
+  800d49:	4c 89 f7             	mov    %r14,%rdi
+  800d4c:	48 b8 63 06 80 00 00 	movabs $0x800663,%rax
+  800d53:	00 00 00 
+  800d56:	ff d0                	call   *%rax
+            break;
+  800d58:	48 83 c4 10          	add    $0x10,%rsp
+  800d5c:	e9 3e fa ff ff       	jmp    80079f <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800d61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d6d:	eb b7                	jmp    800d26 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800d6f:	40 84 f6             	test   %sil,%sil
+  800d72:	75 2b                	jne    800d9f <vprintfmt+0x631>
+    switch (lflag) {
+  800d74:	85 d2                	test   %edx,%edx
+  800d76:	74 56                	je     800dce <vprintfmt+0x660>
+  800d78:	83 fa 01             	cmp    $0x1,%edx
+  800d7b:	74 7f                	je     800dfc <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d7d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d80:	83 f8 2f             	cmp    $0x2f,%eax
+  800d83:	0f 87 a2 00 00 00    	ja     800e2b <vprintfmt+0x6bd>
+  800d89:	89 c2                	mov    %eax,%edx
+  800d8b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d8f:	83 c0 08             	add    $0x8,%eax
+  800d92:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d95:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d98:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d9d:	eb 8f                	jmp    800d2e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d9f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800da2:	83 f8 2f             	cmp    $0x2f,%eax
+  800da5:	77 19                	ja     800dc0 <vprintfmt+0x652>
+  800da7:	89 c2                	mov    %eax,%edx
+  800da9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dad:	83 c0 08             	add    $0x8,%eax
+  800db0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800db3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800db6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800dbb:	e9 6e ff ff ff       	jmp    800d2e <vprintfmt+0x5c0>
+  800dc0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dc4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dc8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dcc:	eb e5                	jmp    800db3 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800dce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dd1:	83 f8 2f             	cmp    $0x2f,%eax
+  800dd4:	77 18                	ja     800dee <vprintfmt+0x680>
+  800dd6:	89 c2                	mov    %eax,%edx
+  800dd8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ddc:	83 c0 08             	add    $0x8,%eax
+  800ddf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800de2:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800de4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800de9:	e9 40 ff ff ff       	jmp    800d2e <vprintfmt+0x5c0>
+  800dee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800df2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800df6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dfa:	eb e6                	jmp    800de2 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800dfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dff:	83 f8 2f             	cmp    $0x2f,%eax
+  800e02:	77 19                	ja     800e1d <vprintfmt+0x6af>
+  800e04:	89 c2                	mov    %eax,%edx
+  800e06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e0a:	83 c0 08             	add    $0x8,%eax
+  800e0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e10:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e13:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800e18:	e9 11 ff ff ff       	jmp    800d2e <vprintfmt+0x5c0>
+  800e1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e21:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e29:	eb e5                	jmp    800e10 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800e2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e37:	e9 59 ff ff ff       	jmp    800d95 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800e3c:	4c 89 ee             	mov    %r13,%rsi
+  800e3f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e44:	41 ff d6             	call   *%r14
+            break;
+  800e47:	e9 53 f9 ff ff       	jmp    80079f <vprintfmt+0x31>
+            putch('%', put_arg);
+  800e4c:	4c 89 ee             	mov    %r13,%rsi
+  800e4f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e54:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800e57:	48 83 eb 01          	sub    $0x1,%rbx
+  800e5b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e5f:	75 f6                	jne    800e57 <vprintfmt+0x6e9>
+  800e61:	e9 39 f9 ff ff       	jmp    80079f <vprintfmt+0x31>
+}
+  800e66:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e6a:	5b                   	pop    %rbx
+  800e6b:	41 5c                	pop    %r12
+  800e6d:	41 5d                	pop    %r13
+  800e6f:	41 5e                	pop    %r14
+  800e71:	41 5f                	pop    %r15
+  800e73:	5d                   	pop    %rbp
+  800e74:	c3                   	ret
+
+0000000000800e75 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e75:	55                   	push   %rbp
+  800e76:	48 89 e5             	mov    %rsp,%rbp
+  800e79:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e7d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e81:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e86:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e8a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e91:	48 85 ff             	test   %rdi,%rdi
+  800e94:	74 2b                	je     800ec1 <vsnprintf+0x4c>
+  800e96:	48 85 f6             	test   %rsi,%rsi
+  800e99:	74 26                	je     800ec1 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e9b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e9f:	48 bf 19 07 80 00 00 	movabs $0x800719,%rdi
+  800ea6:	00 00 00 
+  800ea9:	48 b8 6e 07 80 00 00 	movabs $0x80076e,%rax
+  800eb0:	00 00 00 
+  800eb3:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800eb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800eb9:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ebc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ebf:	c9                   	leave
+  800ec0:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ec1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ec6:	eb f7                	jmp    800ebf <vsnprintf+0x4a>
+
+0000000000800ec8 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ec8:	55                   	push   %rbp
+  800ec9:	48 89 e5             	mov    %rsp,%rbp
+  800ecc:	48 83 ec 50          	sub    $0x50,%rsp
+  800ed0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ed4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ed8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800edc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ee3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ee7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800eeb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800eef:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ef3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ef7:	48 b8 75 0e 80 00 00 	movabs $0x800e75,%rax
+  800efe:	00 00 00 
+  800f01:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800f03:	c9                   	leave
+  800f04:	c3                   	ret
+
+0000000000800f05 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800f05:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800f08:	74 10                	je     800f1a <strlen+0x15>
+    size_t n = 0;
+  800f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800f0f:	48 83 c0 01          	add    $0x1,%rax
+  800f13:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800f17:	75 f6                	jne    800f0f <strlen+0xa>
+  800f19:	c3                   	ret
+    size_t n = 0;
+  800f1a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800f1f:	c3                   	ret
+
+0000000000800f20 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800f20:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800f23:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800f28:	48 85 f6             	test   %rsi,%rsi
+  800f2b:	74 11                	je     800f3e <strnlen+0x1e>
+  800f2d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800f31:	74 0c                	je     800f3f <strnlen+0x1f>
+  800f33:	48 83 c2 01          	add    $0x1,%rdx
+  800f37:	48 39 d0             	cmp    %rdx,%rax
+  800f3a:	75 f1                	jne    800f2d <strnlen+0xd>
+  800f3c:	eb 04                	jmp    800f42 <strnlen+0x22>
+  800f3e:	c3                   	ret
+  800f3f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800f42:	c3                   	ret
+
+0000000000800f43 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800f43:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800f46:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f4b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f4f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800f52:	48 83 c2 01          	add    $0x1,%rdx
+  800f56:	84 c9                	test   %cl,%cl
+  800f58:	75 f1                	jne    800f4b <strcpy+0x8>
+        ;
+    return res;
+}
+  800f5a:	c3                   	ret
+
+0000000000800f5b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800f5b:	55                   	push   %rbp
+  800f5c:	48 89 e5             	mov    %rsp,%rbp
+  800f5f:	41 54                	push   %r12
+  800f61:	53                   	push   %rbx
+  800f62:	48 89 fb             	mov    %rdi,%rbx
+  800f65:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f68:	48 b8 05 0f 80 00 00 	movabs $0x800f05,%rax
+  800f6f:	00 00 00 
+  800f72:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f74:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f78:	4c 89 e6             	mov    %r12,%rsi
+  800f7b:	48 b8 43 0f 80 00 00 	movabs $0x800f43,%rax
+  800f82:	00 00 00 
+  800f85:	ff d0                	call   *%rax
+    return dst;
+}
+  800f87:	48 89 d8             	mov    %rbx,%rax
+  800f8a:	5b                   	pop    %rbx
+  800f8b:	41 5c                	pop    %r12
+  800f8d:	5d                   	pop    %rbp
+  800f8e:	c3                   	ret
+
+0000000000800f8f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f8f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f92:	48 85 d2             	test   %rdx,%rdx
+  800f95:	74 1f                	je     800fb6 <strncpy+0x27>
+  800f97:	48 01 fa             	add    %rdi,%rdx
+  800f9a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f9d:	48 83 c1 01          	add    $0x1,%rcx
+  800fa1:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800fa5:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800fa9:	41 80 f8 01          	cmp    $0x1,%r8b
+  800fad:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800fb1:	48 39 ca             	cmp    %rcx,%rdx
+  800fb4:	75 e7                	jne    800f9d <strncpy+0xe>
+    }
+    return ret;
+}
+  800fb6:	c3                   	ret
+
+0000000000800fb7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800fb7:	48 89 f8             	mov    %rdi,%rax
+  800fba:	48 85 d2             	test   %rdx,%rdx
+  800fbd:	74 24                	je     800fe3 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800fbf:	48 83 ea 01          	sub    $0x1,%rdx
+  800fc3:	74 1b                	je     800fe0 <strlcpy+0x29>
+  800fc5:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800fc9:	0f b6 16             	movzbl (%rsi),%edx
+  800fcc:	84 d2                	test   %dl,%dl
+  800fce:	74 10                	je     800fe0 <strlcpy+0x29>
+            *dst++ = *src++;
+  800fd0:	48 83 c6 01          	add    $0x1,%rsi
+  800fd4:	48 83 c0 01          	add    $0x1,%rax
+  800fd8:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800fdb:	48 39 c8             	cmp    %rcx,%rax
+  800fde:	75 e9                	jne    800fc9 <strlcpy+0x12>
+        *dst = '\0';
+  800fe0:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800fe3:	48 29 f8             	sub    %rdi,%rax
+}
+  800fe6:	c3                   	ret
+
+0000000000800fe7 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800fe7:	0f b6 07             	movzbl (%rdi),%eax
+  800fea:	84 c0                	test   %al,%al
+  800fec:	74 13                	je     801001 <strcmp+0x1a>
+  800fee:	38 06                	cmp    %al,(%rsi)
+  800ff0:	75 0f                	jne    801001 <strcmp+0x1a>
+  800ff2:	48 83 c7 01          	add    $0x1,%rdi
+  800ff6:	48 83 c6 01          	add    $0x1,%rsi
+  800ffa:	0f b6 07             	movzbl (%rdi),%eax
+  800ffd:	84 c0                	test   %al,%al
+  800fff:	75 ed                	jne    800fee <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801001:	0f b6 c0             	movzbl %al,%eax
+  801004:	0f b6 16             	movzbl (%rsi),%edx
+  801007:	29 d0                	sub    %edx,%eax
+}
+  801009:	c3                   	ret
+
+000000000080100a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80100a:	48 85 d2             	test   %rdx,%rdx
+  80100d:	74 1f                	je     80102e <strncmp+0x24>
+  80100f:	0f b6 07             	movzbl (%rdi),%eax
+  801012:	84 c0                	test   %al,%al
+  801014:	74 1e                	je     801034 <strncmp+0x2a>
+  801016:	3a 06                	cmp    (%rsi),%al
+  801018:	75 1a                	jne    801034 <strncmp+0x2a>
+  80101a:	48 83 c7 01          	add    $0x1,%rdi
+  80101e:	48 83 c6 01          	add    $0x1,%rsi
+  801022:	48 83 ea 01          	sub    $0x1,%rdx
+  801026:	75 e7                	jne    80100f <strncmp+0x5>
+
+    if (!n) return 0;
+  801028:	b8 00 00 00 00       	mov    $0x0,%eax
+  80102d:	c3                   	ret
+  80102e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801033:	c3                   	ret
+  801034:	48 85 d2             	test   %rdx,%rdx
+  801037:	74 09                	je     801042 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801039:	0f b6 07             	movzbl (%rdi),%eax
+  80103c:	0f b6 16             	movzbl (%rsi),%edx
+  80103f:	29 d0                	sub    %edx,%eax
+  801041:	c3                   	ret
+    if (!n) return 0;
+  801042:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801047:	c3                   	ret
+
+0000000000801048 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801048:	0f b6 17             	movzbl (%rdi),%edx
+  80104b:	84 d2                	test   %dl,%dl
+  80104d:	74 18                	je     801067 <strchr+0x1f>
+        if (*str == c) {
+  80104f:	0f be d2             	movsbl %dl,%edx
+  801052:	39 f2                	cmp    %esi,%edx
+  801054:	74 17                	je     80106d <strchr+0x25>
+    for (; *str; str++) {
+  801056:	48 83 c7 01          	add    $0x1,%rdi
+  80105a:	0f b6 17             	movzbl (%rdi),%edx
+  80105d:	84 d2                	test   %dl,%dl
+  80105f:	75 ee                	jne    80104f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801061:	b8 00 00 00 00       	mov    $0x0,%eax
+  801066:	c3                   	ret
+  801067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80106c:	c3                   	ret
+  80106d:	48 89 f8             	mov    %rdi,%rax
+}
+  801070:	c3                   	ret
+
+0000000000801071 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801071:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801074:	0f b6 17             	movzbl (%rdi),%edx
+  801077:	84 d2                	test   %dl,%dl
+  801079:	74 13                	je     80108e <strfind+0x1d>
+  80107b:	0f be d2             	movsbl %dl,%edx
+  80107e:	39 f2                	cmp    %esi,%edx
+  801080:	74 0b                	je     80108d <strfind+0x1c>
+  801082:	48 83 c0 01          	add    $0x1,%rax
+  801086:	0f b6 10             	movzbl (%rax),%edx
+  801089:	84 d2                	test   %dl,%dl
+  80108b:	75 ee                	jne    80107b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80108d:	c3                   	ret
+  80108e:	c3                   	ret
+
+000000000080108f <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80108f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801092:	48 89 f8             	mov    %rdi,%rax
+  801095:	48 f7 d8             	neg    %rax
+  801098:	83 e0 07             	and    $0x7,%eax
+  80109b:	49 89 d1             	mov    %rdx,%r9
+  80109e:	49 29 c1             	sub    %rax,%r9
+  8010a1:	78 36                	js     8010d9 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8010a3:	40 0f b6 c6          	movzbl %sil,%eax
+  8010a7:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8010ae:	01 01 01 
+  8010b1:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8010b5:	40 f6 c7 07          	test   $0x7,%dil
+  8010b9:	75 38                	jne    8010f3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8010bb:	4c 89 c9             	mov    %r9,%rcx
+  8010be:	48 c1 f9 03          	sar    $0x3,%rcx
+  8010c2:	74 0c                	je     8010d0 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8010c4:	fc                   	cld
+  8010c5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8010c8:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8010cc:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8010d0:	4d 85 c9             	test   %r9,%r9
+  8010d3:	75 45                	jne    80111a <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8010d5:	4c 89 c0             	mov    %r8,%rax
+  8010d8:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8010d9:	48 85 d2             	test   %rdx,%rdx
+  8010dc:	74 f7                	je     8010d5 <memset+0x46>
+  8010de:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8010e1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8010e4:	48 83 c0 01          	add    $0x1,%rax
+  8010e8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8010ec:	48 39 c2             	cmp    %rax,%rdx
+  8010ef:	75 f3                	jne    8010e4 <memset+0x55>
+  8010f1:	eb e2                	jmp    8010d5 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8010f3:	40 f6 c7 01          	test   $0x1,%dil
+  8010f7:	74 06                	je     8010ff <memset+0x70>
+  8010f9:	88 07                	mov    %al,(%rdi)
+  8010fb:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010ff:	40 f6 c7 02          	test   $0x2,%dil
+  801103:	74 07                	je     80110c <memset+0x7d>
+  801105:	66 89 07             	mov    %ax,(%rdi)
+  801108:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80110c:	40 f6 c7 04          	test   $0x4,%dil
+  801110:	74 a9                	je     8010bb <memset+0x2c>
+  801112:	89 07                	mov    %eax,(%rdi)
+  801114:	48 83 c7 04          	add    $0x4,%rdi
+  801118:	eb a1                	jmp    8010bb <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80111a:	41 f6 c1 04          	test   $0x4,%r9b
+  80111e:	74 06                	je     801126 <memset+0x97>
+  801120:	89 07                	mov    %eax,(%rdi)
+  801122:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801126:	41 f6 c1 02          	test   $0x2,%r9b
+  80112a:	74 07                	je     801133 <memset+0xa4>
+  80112c:	66 89 07             	mov    %ax,(%rdi)
+  80112f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801133:	41 f6 c1 01          	test   $0x1,%r9b
+  801137:	74 9c                	je     8010d5 <memset+0x46>
+  801139:	88 07                	mov    %al,(%rdi)
+  80113b:	eb 98                	jmp    8010d5 <memset+0x46>
+
+000000000080113d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80113d:	48 89 f8             	mov    %rdi,%rax
+  801140:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801143:	48 39 fe             	cmp    %rdi,%rsi
+  801146:	73 3b                	jae    801183 <memmove+0x46>
+  801148:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80114c:	48 39 d7             	cmp    %rdx,%rdi
+  80114f:	73 32                	jae    801183 <memmove+0x46>
+        s += n;
+        d += n;
+  801151:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801155:	48 89 d6             	mov    %rdx,%rsi
+  801158:	48 09 fe             	or     %rdi,%rsi
+  80115b:	48 09 ce             	or     %rcx,%rsi
+  80115e:	40 f6 c6 07          	test   $0x7,%sil
+  801162:	75 12                	jne    801176 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801164:	48 83 ef 08          	sub    $0x8,%rdi
+  801168:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80116c:	48 c1 e9 03          	shr    $0x3,%rcx
+  801170:	fd                   	std
+  801171:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801174:	fc                   	cld
+  801175:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801176:	48 83 ef 01          	sub    $0x1,%rdi
+  80117a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80117e:	fd                   	std
+  80117f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801181:	eb f1                	jmp    801174 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801183:	48 89 f2             	mov    %rsi,%rdx
+  801186:	48 09 c2             	or     %rax,%rdx
+  801189:	48 09 ca             	or     %rcx,%rdx
+  80118c:	f6 c2 07             	test   $0x7,%dl
+  80118f:	75 0c                	jne    80119d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801191:	48 c1 e9 03          	shr    $0x3,%rcx
+  801195:	48 89 c7             	mov    %rax,%rdi
+  801198:	fc                   	cld
+  801199:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80119c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80119d:	48 89 c7             	mov    %rax,%rdi
+  8011a0:	fc                   	cld
+  8011a1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8011a3:	c3                   	ret
+
+00000000008011a4 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8011a4:	55                   	push   %rbp
+  8011a5:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8011a8:	48 b8 3d 11 80 00 00 	movabs $0x80113d,%rax
+  8011af:	00 00 00 
+  8011b2:	ff d0                	call   *%rax
+}
+  8011b4:	5d                   	pop    %rbp
+  8011b5:	c3                   	ret
+
+00000000008011b6 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8011b6:	55                   	push   %rbp
+  8011b7:	48 89 e5             	mov    %rsp,%rbp
+  8011ba:	41 57                	push   %r15
+  8011bc:	41 56                	push   %r14
+  8011be:	41 55                	push   %r13
+  8011c0:	41 54                	push   %r12
+  8011c2:	53                   	push   %rbx
+  8011c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8011c7:	49 89 fe             	mov    %rdi,%r14
+  8011ca:	49 89 f7             	mov    %rsi,%r15
+  8011cd:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8011d0:	48 89 f7             	mov    %rsi,%rdi
+  8011d3:	48 b8 05 0f 80 00 00 	movabs $0x800f05,%rax
+  8011da:	00 00 00 
+  8011dd:	ff d0                	call   *%rax
+  8011df:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8011e2:	48 89 de             	mov    %rbx,%rsi
+  8011e5:	4c 89 f7             	mov    %r14,%rdi
+  8011e8:	48 b8 20 0f 80 00 00 	movabs $0x800f20,%rax
+  8011ef:	00 00 00 
+  8011f2:	ff d0                	call   *%rax
+  8011f4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011f7:	48 39 c3             	cmp    %rax,%rbx
+  8011fa:	74 36                	je     801232 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8011fc:	48 89 d8             	mov    %rbx,%rax
+  8011ff:	4c 29 e8             	sub    %r13,%rax
+  801202:	49 39 c4             	cmp    %rax,%r12
+  801205:	73 31                	jae    801238 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801207:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80120c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801210:	4c 89 fe             	mov    %r15,%rsi
+  801213:	48 b8 a4 11 80 00 00 	movabs $0x8011a4,%rax
+  80121a:	00 00 00 
+  80121d:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80121f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801223:	48 83 c4 08          	add    $0x8,%rsp
+  801227:	5b                   	pop    %rbx
+  801228:	41 5c                	pop    %r12
+  80122a:	41 5d                	pop    %r13
+  80122c:	41 5e                	pop    %r14
+  80122e:	41 5f                	pop    %r15
+  801230:	5d                   	pop    %rbp
+  801231:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801232:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801236:	eb eb                	jmp    801223 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801238:	48 83 eb 01          	sub    $0x1,%rbx
+  80123c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801240:	48 89 da             	mov    %rbx,%rdx
+  801243:	4c 89 fe             	mov    %r15,%rsi
+  801246:	48 b8 a4 11 80 00 00 	movabs $0x8011a4,%rax
+  80124d:	00 00 00 
+  801250:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801252:	49 01 de             	add    %rbx,%r14
+  801255:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80125a:	eb c3                	jmp    80121f <strlcat+0x69>
+
+000000000080125c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80125c:	48 85 d2             	test   %rdx,%rdx
+  80125f:	74 2d                	je     80128e <memcmp+0x32>
+  801261:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801266:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80126a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80126f:	44 38 c1             	cmp    %r8b,%cl
+  801272:	75 0f                	jne    801283 <memcmp+0x27>
+    while (n-- > 0) {
+  801274:	48 83 c0 01          	add    $0x1,%rax
+  801278:	48 39 c2             	cmp    %rax,%rdx
+  80127b:	75 e9                	jne    801266 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80127d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801282:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801283:	0f b6 c1             	movzbl %cl,%eax
+  801286:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80128a:	44 29 c0             	sub    %r8d,%eax
+  80128d:	c3                   	ret
+    return 0;
+  80128e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801293:	c3                   	ret
+
+0000000000801294 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801294:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801298:	48 39 c7             	cmp    %rax,%rdi
+  80129b:	73 0f                	jae    8012ac <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80129d:	40 38 37             	cmp    %sil,(%rdi)
+  8012a0:	74 0e                	je     8012b0 <memfind+0x1c>
+    for (; src < end; src++) {
+  8012a2:	48 83 c7 01          	add    $0x1,%rdi
+  8012a6:	48 39 f8             	cmp    %rdi,%rax
+  8012a9:	75 f2                	jne    80129d <memfind+0x9>
+  8012ab:	c3                   	ret
+  8012ac:	48 89 f8             	mov    %rdi,%rax
+  8012af:	c3                   	ret
+  8012b0:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8012b3:	c3                   	ret
+
+00000000008012b4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8012b4:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8012b7:	0f b6 37             	movzbl (%rdi),%esi
+  8012ba:	40 80 fe 20          	cmp    $0x20,%sil
+  8012be:	74 06                	je     8012c6 <strtol+0x12>
+  8012c0:	40 80 fe 09          	cmp    $0x9,%sil
+  8012c4:	75 13                	jne    8012d9 <strtol+0x25>
+  8012c6:	48 83 c7 01          	add    $0x1,%rdi
+  8012ca:	0f b6 37             	movzbl (%rdi),%esi
+  8012cd:	40 80 fe 20          	cmp    $0x20,%sil
+  8012d1:	74 f3                	je     8012c6 <strtol+0x12>
+  8012d3:	40 80 fe 09          	cmp    $0x9,%sil
+  8012d7:	74 ed                	je     8012c6 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8012d9:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8012dc:	83 e0 fd             	and    $0xfffffffd,%eax
+  8012df:	3c 01                	cmp    $0x1,%al
+  8012e1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8012e5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8012eb:	75 0f                	jne    8012fc <strtol+0x48>
+  8012ed:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8012f0:	74 14                	je     801306 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8012f2:	85 d2                	test   %edx,%edx
+  8012f4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012f9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8012fc:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801301:	4c 63 ca             	movslq %edx,%r9
+  801304:	eb 36                	jmp    80133c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801306:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80130a:	74 0f                	je     80131b <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80130c:	85 d2                	test   %edx,%edx
+  80130e:	75 ec                	jne    8012fc <strtol+0x48>
+        s++;
+  801310:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801314:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801319:	eb e1                	jmp    8012fc <strtol+0x48>
+        s += 2;
+  80131b:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80131f:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801324:	eb d6                	jmp    8012fc <strtol+0x48>
+            dig -= '0';
+  801326:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801329:	44 0f b6 c1          	movzbl %cl,%r8d
+  80132d:	41 39 d0             	cmp    %edx,%r8d
+  801330:	7d 21                	jge    801353 <strtol+0x9f>
+        val = val * base + dig;
+  801332:	49 0f af c1          	imul   %r9,%rax
+  801336:	0f b6 c9             	movzbl %cl,%ecx
+  801339:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80133c:	48 83 c7 01          	add    $0x1,%rdi
+  801340:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801344:	80 f9 39             	cmp    $0x39,%cl
+  801347:	76 dd                	jbe    801326 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801349:	80 f9 7b             	cmp    $0x7b,%cl
+  80134c:	77 05                	ja     801353 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80134e:	83 e9 57             	sub    $0x57,%ecx
+  801351:	eb d6                	jmp    801329 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801353:	4d 85 d2             	test   %r10,%r10
+  801356:	74 03                	je     80135b <strtol+0xa7>
+  801358:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80135b:	48 89 c2             	mov    %rax,%rdx
+  80135e:	48 f7 da             	neg    %rdx
+  801361:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801365:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801369:	c3                   	ret
+
+000000000080136a <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80136a:	55                   	push   %rbp
+  80136b:	48 89 e5             	mov    %rsp,%rbp
+  80136e:	53                   	push   %rbx
+  80136f:	48 89 fa             	mov    %rdi,%rdx
+  801372:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801375:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80137a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801384:	be 00 00 00 00       	mov    $0x0,%esi
+  801389:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80138f:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801391:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801395:	c9                   	leave
+  801396:	c3                   	ret
+
+0000000000801397 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801397:	55                   	push   %rbp
+  801398:	48 89 e5             	mov    %rsp,%rbp
+  80139b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80139c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c0:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c6:	c9                   	leave
+  8013c7:	c3                   	ret
+
+00000000008013c8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8013c8:	55                   	push   %rbp
+  8013c9:	48 89 e5             	mov    %rsp,%rbp
+  8013cc:	53                   	push   %rbx
+  8013cd:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8013d1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d4:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013f5:	48 85 c0             	test   %rax,%rax
+  8013f8:	7f 06                	jg     801400 <sys_env_destroy+0x38>
+}
+  8013fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013fe:	c9                   	leave
+  8013ff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801400:	49 89 c0             	mov    %rax,%r8
+  801403:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801408:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  80140f:	00 00 00 
+  801412:	be 26 00 00 00       	mov    $0x26,%esi
+  801417:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  80141e:	00 00 00 
+  801421:	b8 00 00 00 00       	mov    $0x0,%eax
+  801426:	49 b9 ce 04 80 00 00 	movabs $0x8004ce,%r9
+  80142d:	00 00 00 
+  801430:	41 ff d1             	call   *%r9
+
+0000000000801433 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801433:	55                   	push   %rbp
+  801434:	48 89 e5             	mov    %rsp,%rbp
+  801437:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801438:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80143d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801442:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801447:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801451:	be 00 00 00 00       	mov    $0x0,%esi
+  801456:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80145c:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80145e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801462:	c9                   	leave
+  801463:	c3                   	ret
+
+0000000000801464 <sys_yield>:
+
+void
+sys_yield(void) {
+  801464:	55                   	push   %rbp
+  801465:	48 89 e5             	mov    %rsp,%rbp
+  801468:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801469:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80146e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801473:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801478:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80147d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801482:	be 00 00 00 00       	mov    $0x0,%esi
+  801487:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80148d:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80148f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801493:	c9                   	leave
+  801494:	c3                   	ret
+
+0000000000801495 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801495:	55                   	push   %rbp
+  801496:	48 89 e5             	mov    %rsp,%rbp
+  801499:	53                   	push   %rbx
+  80149a:	48 89 fa             	mov    %rdi,%rdx
+  80149d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a5:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8014ac:	00 00 00 
+  8014af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014bf:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8014c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c5:	c9                   	leave
+  8014c6:	c3                   	ret
+
+00000000008014c7 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8014c7:	55                   	push   %rbp
+  8014c8:	48 89 e5             	mov    %rsp,%rbp
+  8014cb:	53                   	push   %rbx
+  8014cc:	49 89 f8             	mov    %rdi,%r8
+  8014cf:	48 89 d3             	mov    %rdx,%rbx
+  8014d2:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014d5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014da:	4c 89 c2             	mov    %r8,%rdx
+  8014dd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014eb:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8014ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f1:	c9                   	leave
+  8014f2:	c3                   	ret
+
+00000000008014f3 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8014f3:	55                   	push   %rbp
+  8014f4:	48 89 e5             	mov    %rsp,%rbp
+  8014f7:	53                   	push   %rbx
+  8014f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8014fc:	89 f8                	mov    %edi,%eax
+  8014fe:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801501:	48 63 f9             	movslq %ecx,%rdi
+  801504:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801507:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80150c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80150f:	be 00 00 00 00       	mov    $0x0,%esi
+  801514:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80151a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80151c:	48 85 c0             	test   %rax,%rax
+  80151f:	7f 06                	jg     801527 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801521:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801525:	c9                   	leave
+  801526:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801527:	49 89 c0             	mov    %rax,%r8
+  80152a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80152f:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  801536:	00 00 00 
+  801539:	be 26 00 00 00       	mov    $0x26,%esi
+  80153e:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  801545:	00 00 00 
+  801548:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154d:	49 b9 ce 04 80 00 00 	movabs $0x8004ce,%r9
+  801554:	00 00 00 
+  801557:	41 ff d1             	call   *%r9
+
+000000000080155a <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80155a:	55                   	push   %rbp
+  80155b:	48 89 e5             	mov    %rsp,%rbp
+  80155e:	53                   	push   %rbx
+  80155f:	48 83 ec 08          	sub    $0x8,%rsp
+  801563:	89 f8                	mov    %edi,%eax
+  801565:	49 89 f2             	mov    %rsi,%r10
+  801568:	48 89 cf             	mov    %rcx,%rdi
+  80156b:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80156e:	48 63 da             	movslq %edx,%rbx
+  801571:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801574:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801579:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80157c:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80157f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801581:	48 85 c0             	test   %rax,%rax
+  801584:	7f 06                	jg     80158c <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801586:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80158a:	c9                   	leave
+  80158b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80158c:	49 89 c0             	mov    %rax,%r8
+  80158f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801594:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  80159b:	00 00 00 
+  80159e:	be 26 00 00 00       	mov    $0x26,%esi
+  8015a3:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  8015aa:	00 00 00 
+  8015ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b2:	49 b9 ce 04 80 00 00 	movabs $0x8004ce,%r9
+  8015b9:	00 00 00 
+  8015bc:	41 ff d1             	call   *%r9
+
+00000000008015bf <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8015bf:	55                   	push   %rbp
+  8015c0:	48 89 e5             	mov    %rsp,%rbp
+  8015c3:	53                   	push   %rbx
+  8015c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8015c8:	48 89 f1             	mov    %rsi,%rcx
+  8015cb:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8015ce:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d1:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015db:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015e6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015e8:	48 85 c0             	test   %rax,%rax
+  8015eb:	7f 06                	jg     8015f3 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8015ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f1:	c9                   	leave
+  8015f2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f3:	49 89 c0             	mov    %rax,%r8
+  8015f6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015fb:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  801602:	00 00 00 
+  801605:	be 26 00 00 00       	mov    $0x26,%esi
+  80160a:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  801611:	00 00 00 
+  801614:	b8 00 00 00 00       	mov    $0x0,%eax
+  801619:	49 b9 ce 04 80 00 00 	movabs $0x8004ce,%r9
+  801620:	00 00 00 
+  801623:	41 ff d1             	call   *%r9
+
+0000000000801626 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801626:	55                   	push   %rbp
+  801627:	48 89 e5             	mov    %rsp,%rbp
+  80162a:	53                   	push   %rbx
+  80162b:	48 83 ec 08          	sub    $0x8,%rsp
+  80162f:	89 f8                	mov    %edi,%eax
+  801631:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801634:	48 63 f9             	movslq %ecx,%rdi
+  801637:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80163a:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80163f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801642:	be 00 00 00 00       	mov    $0x0,%esi
+  801647:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80164d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80164f:	48 85 c0             	test   %rax,%rax
+  801652:	7f 06                	jg     80165a <sys_region_advise+0x34>
+}
+  801654:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801658:	c9                   	leave
+  801659:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80165a:	49 89 c0             	mov    %rax,%r8
+  80165d:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801662:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  801669:	00 00 00 
+  80166c:	be 26 00 00 00       	mov    $0x26,%esi
+  801671:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  801678:	00 00 00 
+  80167b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801680:	49 b9 ce 04 80 00 00 	movabs $0x8004ce,%r9
+  801687:	00 00 00 
+  80168a:	41 ff d1             	call   *%r9
+
+000000000080168d <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  80168d:	55                   	push   %rbp
+  80168e:	48 89 e5             	mov    %rsp,%rbp
+  801691:	53                   	push   %rbx
+  801692:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801696:	48 63 ce             	movslq %esi,%rcx
+  801699:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80169c:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016b6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016b8:	48 85 c0             	test   %rax,%rax
+  8016bb:	7f 06                	jg     8016c3 <sys_env_set_nice+0x36>
+}
+  8016bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016c1:	c9                   	leave
+  8016c2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016c3:	49 89 c0             	mov    %rax,%r8
+  8016c6:	b9 15 00 00 00       	mov    $0x15,%ecx
+  8016cb:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  8016d2:	00 00 00 
+  8016d5:	be 26 00 00 00       	mov    $0x26,%esi
+  8016da:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  8016e1:	00 00 00 
+  8016e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e9:	49 b9 ce 04 80 00 00 	movabs $0x8004ce,%r9
+  8016f0:	00 00 00 
+  8016f3:	41 ff d1             	call   *%r9
+
+00000000008016f6 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8016f6:	55                   	push   %rbp
+  8016f7:	48 89 e5             	mov    %rsp,%rbp
+  8016fa:	53                   	push   %rbx
+  8016fb:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8016ff:	48 63 ce             	movslq %esi,%rcx
+  801702:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801705:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80170a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801714:	be 00 00 00 00       	mov    $0x0,%esi
+  801719:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80171f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801721:	48 85 c0             	test   %rax,%rax
+  801724:	7f 06                	jg     80172c <sys_env_set_status+0x36>
+}
+  801726:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80172a:	c9                   	leave
+  80172b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80172c:	49 89 c0             	mov    %rax,%r8
+  80172f:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801734:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  80173b:	00 00 00 
+  80173e:	be 26 00 00 00       	mov    $0x26,%esi
+  801743:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  80174a:	00 00 00 
+  80174d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801752:	49 b9 ce 04 80 00 00 	movabs $0x8004ce,%r9
+  801759:	00 00 00 
+  80175c:	41 ff d1             	call   *%r9
+
+000000000080175f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80175f:	55                   	push   %rbp
+  801760:	48 89 e5             	mov    %rsp,%rbp
+  801763:	53                   	push   %rbx
+  801764:	48 83 ec 08          	sub    $0x8,%rsp
+  801768:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80176b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80176e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801773:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801778:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80177d:	be 00 00 00 00       	mov    $0x0,%esi
+  801782:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801788:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80178a:	48 85 c0             	test   %rax,%rax
+  80178d:	7f 06                	jg     801795 <sys_env_set_trapframe+0x36>
+}
+  80178f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801793:	c9                   	leave
+  801794:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801795:	49 89 c0             	mov    %rax,%r8
+  801798:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80179d:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  8017a4:	00 00 00 
+  8017a7:	be 26 00 00 00       	mov    $0x26,%esi
+  8017ac:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  8017b3:	00 00 00 
+  8017b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017bb:	49 b9 ce 04 80 00 00 	movabs $0x8004ce,%r9
+  8017c2:	00 00 00 
+  8017c5:	41 ff d1             	call   *%r9
+
+00000000008017c8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8017c8:	55                   	push   %rbp
+  8017c9:	48 89 e5             	mov    %rsp,%rbp
+  8017cc:	53                   	push   %rbx
+  8017cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8017d1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8017d4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017d7:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8017eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017f3:	48 85 c0             	test   %rax,%rax
+  8017f6:	7f 06                	jg     8017fe <sys_env_set_pgfault_upcall+0x36>
+}
+  8017f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017fc:	c9                   	leave
+  8017fd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017fe:	49 89 c0             	mov    %rax,%r8
+  801801:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801806:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  80180d:	00 00 00 
+  801810:	be 26 00 00 00       	mov    $0x26,%esi
+  801815:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  80181c:	00 00 00 
+  80181f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801824:	49 b9 ce 04 80 00 00 	movabs $0x8004ce,%r9
+  80182b:	00 00 00 
+  80182e:	41 ff d1             	call   *%r9
+
+0000000000801831 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801831:	55                   	push   %rbp
+  801832:	48 89 e5             	mov    %rsp,%rbp
+  801835:	53                   	push   %rbx
+  801836:	89 f8                	mov    %edi,%eax
+  801838:	49 89 f1             	mov    %rsi,%r9
+  80183b:	48 89 d3             	mov    %rdx,%rbx
+  80183e:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801841:	49 63 f0             	movslq %r8d,%rsi
+  801844:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801847:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80184c:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80184f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801855:	cd 30                	int    $0x30
+}
+  801857:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80185b:	c9                   	leave
+  80185c:	c3                   	ret
+
+000000000080185d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80185d:	55                   	push   %rbp
+  80185e:	48 89 e5             	mov    %rsp,%rbp
+  801861:	53                   	push   %rbx
+  801862:	48 83 ec 08          	sub    $0x8,%rsp
+  801866:	48 89 fa             	mov    %rdi,%rdx
+  801869:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80186c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801871:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801876:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80187b:	be 00 00 00 00       	mov    $0x0,%esi
+  801880:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801886:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801888:	48 85 c0             	test   %rax,%rax
+  80188b:	7f 06                	jg     801893 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80188d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801891:	c9                   	leave
+  801892:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801893:	49 89 c0             	mov    %rax,%r8
+  801896:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80189b:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  8018a2:	00 00 00 
+  8018a5:	be 26 00 00 00       	mov    $0x26,%esi
+  8018aa:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  8018b1:	00 00 00 
+  8018b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b9:	49 b9 ce 04 80 00 00 	movabs $0x8004ce,%r9
+  8018c0:	00 00 00 
+  8018c3:	41 ff d1             	call   *%r9
+
+00000000008018c6 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8018c6:	55                   	push   %rbp
+  8018c7:	48 89 e5             	mov    %rsp,%rbp
+  8018ca:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018cb:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8018e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018ef:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8018f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018f5:	c9                   	leave
+  8018f6:	c3                   	ret
+
+00000000008018f7 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8018f7:	55                   	push   %rbp
+  8018f8:	48 89 e5             	mov    %rsp,%rbp
+  8018fb:	53                   	push   %rbx
+  8018fc:	48 83 ec 08          	sub    $0x8,%rsp
+  801900:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801903:	48 63 ce             	movslq %esi,%rcx
+  801906:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801909:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80190e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801913:	be 00 00 00 00       	mov    $0x0,%esi
+  801918:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80191e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801920:	48 85 c0             	test   %rax,%rax
+  801923:	7f 06                	jg     80192b <sys_sigqueue+0x34>
+}
+  801925:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801929:	c9                   	leave
+  80192a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80192b:	49 89 c0             	mov    %rax,%r8
+  80192e:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801933:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  80193a:	00 00 00 
+  80193d:	be 26 00 00 00       	mov    $0x26,%esi
+  801942:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  801949:	00 00 00 
+  80194c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801951:	49 b9 ce 04 80 00 00 	movabs $0x8004ce,%r9
+  801958:	00 00 00 
+  80195b:	41 ff d1             	call   *%r9
+
+000000000080195e <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  80195e:	55                   	push   %rbp
+  80195f:	48 89 e5             	mov    %rsp,%rbp
+  801962:	53                   	push   %rbx
+  801963:	48 83 ec 08          	sub    $0x8,%rsp
+  801967:	48 89 fa             	mov    %rdi,%rdx
+  80196a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80196d:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801972:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801977:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80197c:	be 00 00 00 00       	mov    $0x0,%esi
+  801981:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801987:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801989:	48 85 c0             	test   %rax,%rax
+  80198c:	7f 06                	jg     801994 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  80198e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801992:	c9                   	leave
+  801993:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801994:	49 89 c0             	mov    %rax,%r8
+  801997:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80199c:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  8019a3:	00 00 00 
+  8019a6:	be 26 00 00 00       	mov    $0x26,%esi
+  8019ab:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  8019b2:	00 00 00 
+  8019b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ba:	49 b9 ce 04 80 00 00 	movabs $0x8004ce,%r9
+  8019c1:	00 00 00 
+  8019c4:	41 ff d1             	call   *%r9
+
+00000000008019c7 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  8019c7:	55                   	push   %rbp
+  8019c8:	48 89 e5             	mov    %rsp,%rbp
+  8019cb:	53                   	push   %rbx
+  8019cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8019d0:	48 89 f1             	mov    %rsi,%rcx
+  8019d3:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  8019d6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019d9:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019de:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8019e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019ee:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019f0:	48 85 c0             	test   %rax,%rax
+  8019f3:	7f 06                	jg     8019fb <sys_sigaction+0x34>
+}
+  8019f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019f9:	c9                   	leave
+  8019fa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019fb:	49 89 c0             	mov    %rax,%r8
+  8019fe:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801a03:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  801a0a:	00 00 00 
+  801a0d:	be 26 00 00 00       	mov    $0x26,%esi
+  801a12:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  801a19:	00 00 00 
+  801a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a21:	49 b9 ce 04 80 00 00 	movabs $0x8004ce,%r9
+  801a28:	00 00 00 
+  801a2b:	41 ff d1             	call   *%r9
+
+0000000000801a2e <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801a2e:	55                   	push   %rbp
+  801a2f:	48 89 e5             	mov    %rsp,%rbp
+  801a32:	53                   	push   %rbx
+  801a33:	48 83 ec 08          	sub    $0x8,%rsp
+  801a37:	48 89 f1             	mov    %rsi,%rcx
+  801a3a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801a3d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a40:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a45:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a4a:	be 00 00 00 00       	mov    $0x0,%esi
+  801a4f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a55:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a57:	48 85 c0             	test   %rax,%rax
+  801a5a:	7f 06                	jg     801a62 <sys_sigprocmask+0x34>
+}
+  801a5c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a60:	c9                   	leave
+  801a61:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a62:	49 89 c0             	mov    %rax,%r8
+  801a65:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801a6a:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  801a71:	00 00 00 
+  801a74:	be 26 00 00 00       	mov    $0x26,%esi
+  801a79:	48 bf cf 36 80 00 00 	movabs $0x8036cf,%rdi
+  801a80:	00 00 00 
+  801a83:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a88:	49 b9 ce 04 80 00 00 	movabs $0x8004ce,%r9
+  801a8f:	00 00 00 
+  801a92:	41 ff d1             	call   *%r9
+
+0000000000801a95 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801a95:	55                   	push   %rbp
+  801a96:	48 89 e5             	mov    %rsp,%rbp
+  801a99:	41 54                	push   %r12
+  801a9b:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801a9c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801aa1:	cd 30                	int    $0x30
+  801aa3:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  801aa6:	85 c0                	test   %eax,%eax
+  801aa8:	78 76                	js     801b20 <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  801aaa:	74 7c                	je     801b28 <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  801aac:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801ab2:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801ab9:	00 00 00 
+  801abc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ac1:	89 c2                	mov    %eax,%edx
+  801ac3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ac8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801acd:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  801ad4:	00 00 00 
+  801ad7:	ff d0                	call   *%rax
+  801ad9:	85 c0                	test   %eax,%eax
+  801adb:	75 7a                	jne    801b57 <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  801add:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ae4:	00 00 00 
+  801ae7:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801aee:	44 89 e7             	mov    %r12d,%edi
+  801af1:	48 b8 c8 17 80 00 00 	movabs $0x8017c8,%rax
+  801af8:	00 00 00 
+  801afb:	ff d0                	call   *%rax
+  801afd:	85 c0                	test   %eax,%eax
+  801aff:	75 5e                	jne    801b5f <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  801b01:	be 02 00 00 00       	mov    $0x2,%esi
+  801b06:	44 89 e7             	mov    %r12d,%edi
+  801b09:	48 b8 f6 16 80 00 00 	movabs $0x8016f6,%rax
+  801b10:	00 00 00 
+  801b13:	ff d0                	call   *%rax
+        return -1;
+  801b15:	85 c0                	test   %eax,%eax
+  801b17:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801b1c:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  801b20:	44 89 e0             	mov    %r12d,%eax
+  801b23:	5b                   	pop    %rbx
+  801b24:	41 5c                	pop    %r12
+  801b26:	5d                   	pop    %rbp
+  801b27:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  801b28:	48 b8 33 14 80 00 00 	movabs $0x801433,%rax
+  801b2f:	00 00 00 
+  801b32:	ff d0                	call   *%rax
+  801b34:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  801b37:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  801b3e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801b45:	00 00 00 
+  801b48:	48 01 d0             	add    %rdx,%rax
+  801b4b:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  801b52:	00 00 00 
+        return 0;
+  801b55:	eb c9                	jmp    801b20 <fork+0x8b>
+        return -1;
+  801b57:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801b5d:	eb c1                	jmp    801b20 <fork+0x8b>
+        return -1;
+  801b5f:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801b65:	eb b9                	jmp    801b20 <fork+0x8b>
+
+0000000000801b67 <sfork>:
+
+envid_t
+sfork() {
+  801b67:	55                   	push   %rbp
+  801b68:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801b6b:	48 ba dd 36 80 00 00 	movabs $0x8036dd,%rdx
+  801b72:	00 00 00 
+  801b75:	be 2e 00 00 00       	mov    $0x2e,%esi
+  801b7a:	48 bf f8 36 80 00 00 	movabs $0x8036f8,%rdi
+  801b81:	00 00 00 
+  801b84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b89:	48 b9 ce 04 80 00 00 	movabs $0x8004ce,%rcx
+  801b90:	00 00 00 
+  801b93:	ff d1                	call   *%rcx
+
+0000000000801b95 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b95:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b9c:	ff ff ff 
+  801b9f:	48 01 f8             	add    %rdi,%rax
+  801ba2:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801ba6:	c3                   	ret
+
+0000000000801ba7 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ba7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801bae:	ff ff ff 
+  801bb1:	48 01 f8             	add    %rdi,%rax
+  801bb4:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801bb8:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801bbe:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801bc2:	c3                   	ret
+
+0000000000801bc3 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801bc3:	55                   	push   %rbp
+  801bc4:	48 89 e5             	mov    %rsp,%rbp
+  801bc7:	41 57                	push   %r15
+  801bc9:	41 56                	push   %r14
+  801bcb:	41 55                	push   %r13
+  801bcd:	41 54                	push   %r12
+  801bcf:	53                   	push   %rbx
+  801bd0:	48 83 ec 08          	sub    $0x8,%rsp
+  801bd4:	49 89 ff             	mov    %rdi,%r15
+  801bd7:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801bdc:	49 bd 41 2b 80 00 00 	movabs $0x802b41,%r13
+  801be3:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801be6:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801bec:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801bef:	48 89 df             	mov    %rbx,%rdi
+  801bf2:	41 ff d5             	call   *%r13
+  801bf5:	83 e0 04             	and    $0x4,%eax
+  801bf8:	74 17                	je     801c11 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801bfa:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801c01:	4c 39 f3             	cmp    %r14,%rbx
+  801c04:	75 e6                	jne    801bec <fd_alloc+0x29>
+  801c06:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801c0c:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801c11:	4d 89 27             	mov    %r12,(%r15)
+}
+  801c14:	48 83 c4 08          	add    $0x8,%rsp
+  801c18:	5b                   	pop    %rbx
+  801c19:	41 5c                	pop    %r12
+  801c1b:	41 5d                	pop    %r13
+  801c1d:	41 5e                	pop    %r14
+  801c1f:	41 5f                	pop    %r15
+  801c21:	5d                   	pop    %rbp
+  801c22:	c3                   	ret
+
+0000000000801c23 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801c23:	83 ff 1f             	cmp    $0x1f,%edi
+  801c26:	77 39                	ja     801c61 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801c28:	55                   	push   %rbp
+  801c29:	48 89 e5             	mov    %rsp,%rbp
+  801c2c:	41 54                	push   %r12
+  801c2e:	53                   	push   %rbx
+  801c2f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801c32:	48 63 df             	movslq %edi,%rbx
+  801c35:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801c3c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801c40:	48 89 df             	mov    %rbx,%rdi
+  801c43:	48 b8 41 2b 80 00 00 	movabs $0x802b41,%rax
+  801c4a:	00 00 00 
+  801c4d:	ff d0                	call   *%rax
+  801c4f:	a8 04                	test   $0x4,%al
+  801c51:	74 14                	je     801c67 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801c53:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801c57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c5c:	5b                   	pop    %rbx
+  801c5d:	41 5c                	pop    %r12
+  801c5f:	5d                   	pop    %rbp
+  801c60:	c3                   	ret
+        return -E_INVAL;
+  801c61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801c66:	c3                   	ret
+        return -E_INVAL;
+  801c67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c6c:	eb ee                	jmp    801c5c <fd_lookup+0x39>
+
+0000000000801c6e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801c6e:	55                   	push   %rbp
+  801c6f:	48 89 e5             	mov    %rsp,%rbp
+  801c72:	41 54                	push   %r12
+  801c74:	53                   	push   %rbx
+  801c75:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801c78:	48 b8 a0 37 80 00 00 	movabs $0x8037a0,%rax
+  801c7f:	00 00 00 
+  801c82:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801c89:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801c8c:	39 3b                	cmp    %edi,(%rbx)
+  801c8e:	74 47                	je     801cd7 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c90:	48 83 c0 08          	add    $0x8,%rax
+  801c94:	48 8b 18             	mov    (%rax),%rbx
+  801c97:	48 85 db             	test   %rbx,%rbx
+  801c9a:	75 f0                	jne    801c8c <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c9c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ca3:	00 00 00 
+  801ca6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cac:	89 fa                	mov    %edi,%edx
+  801cae:	48 bf 08 37 80 00 00 	movabs $0x803708,%rdi
+  801cb5:	00 00 00 
+  801cb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cbd:	48 b9 1e 06 80 00 00 	movabs $0x80061e,%rcx
+  801cc4:	00 00 00 
+  801cc7:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801cc9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801cce:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801cd2:	5b                   	pop    %rbx
+  801cd3:	41 5c                	pop    %r12
+  801cd5:	5d                   	pop    %rbp
+  801cd6:	c3                   	ret
+            return 0;
+  801cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cdc:	eb f0                	jmp    801cce <dev_lookup+0x60>
+
+0000000000801cde <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801cde:	55                   	push   %rbp
+  801cdf:	48 89 e5             	mov    %rsp,%rbp
+  801ce2:	41 55                	push   %r13
+  801ce4:	41 54                	push   %r12
+  801ce6:	53                   	push   %rbx
+  801ce7:	48 83 ec 18          	sub    $0x18,%rsp
+  801ceb:	48 89 fb             	mov    %rdi,%rbx
+  801cee:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cf1:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801cf8:	ff ff ff 
+  801cfb:	48 01 df             	add    %rbx,%rdi
+  801cfe:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801d02:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d06:	48 b8 23 1c 80 00 00 	movabs $0x801c23,%rax
+  801d0d:	00 00 00 
+  801d10:	ff d0                	call   *%rax
+  801d12:	41 89 c5             	mov    %eax,%r13d
+  801d15:	85 c0                	test   %eax,%eax
+  801d17:	78 06                	js     801d1f <fd_close+0x41>
+  801d19:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801d1d:	74 1a                	je     801d39 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801d1f:	45 84 e4             	test   %r12b,%r12b
+  801d22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d27:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801d2b:	44 89 e8             	mov    %r13d,%eax
+  801d2e:	48 83 c4 18          	add    $0x18,%rsp
+  801d32:	5b                   	pop    %rbx
+  801d33:	41 5c                	pop    %r12
+  801d35:	41 5d                	pop    %r13
+  801d37:	5d                   	pop    %rbp
+  801d38:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d39:	8b 3b                	mov    (%rbx),%edi
+  801d3b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d3f:	48 b8 6e 1c 80 00 00 	movabs $0x801c6e,%rax
+  801d46:	00 00 00 
+  801d49:	ff d0                	call   *%rax
+  801d4b:	41 89 c5             	mov    %eax,%r13d
+  801d4e:	85 c0                	test   %eax,%eax
+  801d50:	78 1b                	js     801d6d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801d52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d56:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d5a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801d60:	48 85 c0             	test   %rax,%rax
+  801d63:	74 08                	je     801d6d <fd_close+0x8f>
+  801d65:	48 89 df             	mov    %rbx,%rdi
+  801d68:	ff d0                	call   *%rax
+  801d6a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801d6d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d72:	48 89 de             	mov    %rbx,%rsi
+  801d75:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d7a:	48 b8 bf 15 80 00 00 	movabs $0x8015bf,%rax
+  801d81:	00 00 00 
+  801d84:	ff d0                	call   *%rax
+    return res;
+  801d86:	eb a3                	jmp    801d2b <fd_close+0x4d>
+
+0000000000801d88 <close>:
+
+int
+close(int fdnum) {
+  801d88:	55                   	push   %rbp
+  801d89:	48 89 e5             	mov    %rsp,%rbp
+  801d8c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d90:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d94:	48 b8 23 1c 80 00 00 	movabs $0x801c23,%rax
+  801d9b:	00 00 00 
+  801d9e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801da0:	85 c0                	test   %eax,%eax
+  801da2:	78 15                	js     801db9 <close+0x31>
+
+    return fd_close(fd, 1);
+  801da4:	be 01 00 00 00       	mov    $0x1,%esi
+  801da9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801dad:	48 b8 de 1c 80 00 00 	movabs $0x801cde,%rax
+  801db4:	00 00 00 
+  801db7:	ff d0                	call   *%rax
+}
+  801db9:	c9                   	leave
+  801dba:	c3                   	ret
+
+0000000000801dbb <close_all>:
+
+void
+close_all(void) {
+  801dbb:	55                   	push   %rbp
+  801dbc:	48 89 e5             	mov    %rsp,%rbp
+  801dbf:	41 54                	push   %r12
+  801dc1:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801dc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dc7:	49 bc 88 1d 80 00 00 	movabs $0x801d88,%r12
+  801dce:	00 00 00 
+  801dd1:	89 df                	mov    %ebx,%edi
+  801dd3:	41 ff d4             	call   *%r12
+  801dd6:	83 c3 01             	add    $0x1,%ebx
+  801dd9:	83 fb 20             	cmp    $0x20,%ebx
+  801ddc:	75 f3                	jne    801dd1 <close_all+0x16>
+}
+  801dde:	5b                   	pop    %rbx
+  801ddf:	41 5c                	pop    %r12
+  801de1:	5d                   	pop    %rbp
+  801de2:	c3                   	ret
+
+0000000000801de3 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801de3:	55                   	push   %rbp
+  801de4:	48 89 e5             	mov    %rsp,%rbp
+  801de7:	41 57                	push   %r15
+  801de9:	41 56                	push   %r14
+  801deb:	41 55                	push   %r13
+  801ded:	41 54                	push   %r12
+  801def:	53                   	push   %rbx
+  801df0:	48 83 ec 18          	sub    $0x18,%rsp
+  801df4:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801df7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801dfb:	48 b8 23 1c 80 00 00 	movabs $0x801c23,%rax
+  801e02:	00 00 00 
+  801e05:	ff d0                	call   *%rax
+  801e07:	89 c3                	mov    %eax,%ebx
+  801e09:	85 c0                	test   %eax,%eax
+  801e0b:	0f 88 b8 00 00 00    	js     801ec9 <dup+0xe6>
+    close(newfdnum);
+  801e11:	44 89 e7             	mov    %r12d,%edi
+  801e14:	48 b8 88 1d 80 00 00 	movabs $0x801d88,%rax
+  801e1b:	00 00 00 
+  801e1e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801e20:	4d 63 ec             	movslq %r12d,%r13
+  801e23:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801e2a:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801e2e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801e32:	4c 89 ff             	mov    %r15,%rdi
+  801e35:	49 be a7 1b 80 00 00 	movabs $0x801ba7,%r14
+  801e3c:	00 00 00 
+  801e3f:	41 ff d6             	call   *%r14
+  801e42:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801e45:	4c 89 ef             	mov    %r13,%rdi
+  801e48:	41 ff d6             	call   *%r14
+  801e4b:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801e4e:	48 89 df             	mov    %rbx,%rdi
+  801e51:	48 b8 41 2b 80 00 00 	movabs $0x802b41,%rax
+  801e58:	00 00 00 
+  801e5b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801e5d:	a8 04                	test   $0x4,%al
+  801e5f:	74 2b                	je     801e8c <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801e61:	41 89 c1             	mov    %eax,%r9d
+  801e64:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e6a:	4c 89 f1             	mov    %r14,%rcx
+  801e6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e72:	48 89 de             	mov    %rbx,%rsi
+  801e75:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e7a:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  801e81:	00 00 00 
+  801e84:	ff d0                	call   *%rax
+  801e86:	89 c3                	mov    %eax,%ebx
+  801e88:	85 c0                	test   %eax,%eax
+  801e8a:	78 4e                	js     801eda <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801e8c:	4c 89 ff             	mov    %r15,%rdi
+  801e8f:	48 b8 41 2b 80 00 00 	movabs $0x802b41,%rax
+  801e96:	00 00 00 
+  801e99:	ff d0                	call   *%rax
+  801e9b:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801e9e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ea4:	4c 89 e9             	mov    %r13,%rcx
+  801ea7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eac:	4c 89 fe             	mov    %r15,%rsi
+  801eaf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eb4:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  801ebb:	00 00 00 
+  801ebe:	ff d0                	call   *%rax
+  801ec0:	89 c3                	mov    %eax,%ebx
+  801ec2:	85 c0                	test   %eax,%eax
+  801ec4:	78 14                	js     801eda <dup+0xf7>
+
+    return newfdnum;
+  801ec6:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ec9:	89 d8                	mov    %ebx,%eax
+  801ecb:	48 83 c4 18          	add    $0x18,%rsp
+  801ecf:	5b                   	pop    %rbx
+  801ed0:	41 5c                	pop    %r12
+  801ed2:	41 5d                	pop    %r13
+  801ed4:	41 5e                	pop    %r14
+  801ed6:	41 5f                	pop    %r15
+  801ed8:	5d                   	pop    %rbp
+  801ed9:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801eda:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801edf:	4c 89 ee             	mov    %r13,%rsi
+  801ee2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ee7:	49 bc bf 15 80 00 00 	movabs $0x8015bf,%r12
+  801eee:	00 00 00 
+  801ef1:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801ef4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ef9:	4c 89 f6             	mov    %r14,%rsi
+  801efc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f01:	41 ff d4             	call   *%r12
+    return res;
+  801f04:	eb c3                	jmp    801ec9 <dup+0xe6>
+
+0000000000801f06 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801f06:	55                   	push   %rbp
+  801f07:	48 89 e5             	mov    %rsp,%rbp
+  801f0a:	41 56                	push   %r14
+  801f0c:	41 55                	push   %r13
+  801f0e:	41 54                	push   %r12
+  801f10:	53                   	push   %rbx
+  801f11:	48 83 ec 10          	sub    $0x10,%rsp
+  801f15:	89 fb                	mov    %edi,%ebx
+  801f17:	49 89 f4             	mov    %rsi,%r12
+  801f1a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f1d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f21:	48 b8 23 1c 80 00 00 	movabs $0x801c23,%rax
+  801f28:	00 00 00 
+  801f2b:	ff d0                	call   *%rax
+  801f2d:	85 c0                	test   %eax,%eax
+  801f2f:	78 4c                	js     801f7d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f31:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f35:	41 8b 3e             	mov    (%r14),%edi
+  801f38:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f3c:	48 b8 6e 1c 80 00 00 	movabs $0x801c6e,%rax
+  801f43:	00 00 00 
+  801f46:	ff d0                	call   *%rax
+  801f48:	85 c0                	test   %eax,%eax
+  801f4a:	78 35                	js     801f81 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f4c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801f50:	83 e0 03             	and    $0x3,%eax
+  801f53:	83 f8 01             	cmp    $0x1,%eax
+  801f56:	74 2d                	je     801f85 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f58:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f5c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f60:	48 85 c0             	test   %rax,%rax
+  801f63:	74 56                	je     801fbb <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801f65:	4c 89 ea             	mov    %r13,%rdx
+  801f68:	4c 89 e6             	mov    %r12,%rsi
+  801f6b:	4c 89 f7             	mov    %r14,%rdi
+  801f6e:	ff d0                	call   *%rax
+}
+  801f70:	48 83 c4 10          	add    $0x10,%rsp
+  801f74:	5b                   	pop    %rbx
+  801f75:	41 5c                	pop    %r12
+  801f77:	41 5d                	pop    %r13
+  801f79:	41 5e                	pop    %r14
+  801f7b:	5d                   	pop    %rbp
+  801f7c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f7d:	48 98                	cltq
+  801f7f:	eb ef                	jmp    801f70 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f81:	48 98                	cltq
+  801f83:	eb eb                	jmp    801f70 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f85:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f8c:	00 00 00 
+  801f8f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f95:	89 da                	mov    %ebx,%edx
+  801f97:	48 bf 49 37 80 00 00 	movabs $0x803749,%rdi
+  801f9e:	00 00 00 
+  801fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa6:	48 b9 1e 06 80 00 00 	movabs $0x80061e,%rcx
+  801fad:	00 00 00 
+  801fb0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fb2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fb9:	eb b5                	jmp    801f70 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801fbb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fc2:	eb ac                	jmp    801f70 <read+0x6a>
+
+0000000000801fc4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801fc4:	55                   	push   %rbp
+  801fc5:	48 89 e5             	mov    %rsp,%rbp
+  801fc8:	41 57                	push   %r15
+  801fca:	41 56                	push   %r14
+  801fcc:	41 55                	push   %r13
+  801fce:	41 54                	push   %r12
+  801fd0:	53                   	push   %rbx
+  801fd1:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801fd5:	48 85 d2             	test   %rdx,%rdx
+  801fd8:	74 54                	je     80202e <readn+0x6a>
+  801fda:	41 89 fd             	mov    %edi,%r13d
+  801fdd:	49 89 f6             	mov    %rsi,%r14
+  801fe0:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801fe3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801fe8:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801fed:	49 bf 06 1f 80 00 00 	movabs $0x801f06,%r15
+  801ff4:	00 00 00 
+  801ff7:	4c 89 e2             	mov    %r12,%rdx
+  801ffa:	48 29 f2             	sub    %rsi,%rdx
+  801ffd:	4c 01 f6             	add    %r14,%rsi
+  802000:	44 89 ef             	mov    %r13d,%edi
+  802003:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802006:	85 c0                	test   %eax,%eax
+  802008:	78 20                	js     80202a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80200a:	01 c3                	add    %eax,%ebx
+  80200c:	85 c0                	test   %eax,%eax
+  80200e:	74 08                	je     802018 <readn+0x54>
+  802010:	48 63 f3             	movslq %ebx,%rsi
+  802013:	4c 39 e6             	cmp    %r12,%rsi
+  802016:	72 df                	jb     801ff7 <readn+0x33>
+    }
+    return res;
+  802018:	48 63 c3             	movslq %ebx,%rax
+}
+  80201b:	48 83 c4 08          	add    $0x8,%rsp
+  80201f:	5b                   	pop    %rbx
+  802020:	41 5c                	pop    %r12
+  802022:	41 5d                	pop    %r13
+  802024:	41 5e                	pop    %r14
+  802026:	41 5f                	pop    %r15
+  802028:	5d                   	pop    %rbp
+  802029:	c3                   	ret
+        if (inc < 0) return inc;
+  80202a:	48 98                	cltq
+  80202c:	eb ed                	jmp    80201b <readn+0x57>
+    int inc = 1, res = 0;
+  80202e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802033:	eb e3                	jmp    802018 <readn+0x54>
+
+0000000000802035 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802035:	55                   	push   %rbp
+  802036:	48 89 e5             	mov    %rsp,%rbp
+  802039:	41 56                	push   %r14
+  80203b:	41 55                	push   %r13
+  80203d:	41 54                	push   %r12
+  80203f:	53                   	push   %rbx
+  802040:	48 83 ec 10          	sub    $0x10,%rsp
+  802044:	89 fb                	mov    %edi,%ebx
+  802046:	49 89 f4             	mov    %rsi,%r12
+  802049:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80204c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802050:	48 b8 23 1c 80 00 00 	movabs $0x801c23,%rax
+  802057:	00 00 00 
+  80205a:	ff d0                	call   *%rax
+  80205c:	85 c0                	test   %eax,%eax
+  80205e:	78 47                	js     8020a7 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802060:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802064:	41 8b 3e             	mov    (%r14),%edi
+  802067:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80206b:	48 b8 6e 1c 80 00 00 	movabs $0x801c6e,%rax
+  802072:	00 00 00 
+  802075:	ff d0                	call   *%rax
+  802077:	85 c0                	test   %eax,%eax
+  802079:	78 30                	js     8020ab <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80207b:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802080:	74 2d                	je     8020af <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802082:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802086:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80208a:	48 85 c0             	test   %rax,%rax
+  80208d:	74 56                	je     8020e5 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80208f:	4c 89 ea             	mov    %r13,%rdx
+  802092:	4c 89 e6             	mov    %r12,%rsi
+  802095:	4c 89 f7             	mov    %r14,%rdi
+  802098:	ff d0                	call   *%rax
+}
+  80209a:	48 83 c4 10          	add    $0x10,%rsp
+  80209e:	5b                   	pop    %rbx
+  80209f:	41 5c                	pop    %r12
+  8020a1:	41 5d                	pop    %r13
+  8020a3:	41 5e                	pop    %r14
+  8020a5:	5d                   	pop    %rbp
+  8020a6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020a7:	48 98                	cltq
+  8020a9:	eb ef                	jmp    80209a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020ab:	48 98                	cltq
+  8020ad:	eb eb                	jmp    80209a <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020af:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8020b6:	00 00 00 
+  8020b9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020bf:	89 da                	mov    %ebx,%edx
+  8020c1:	48 bf 65 37 80 00 00 	movabs $0x803765,%rdi
+  8020c8:	00 00 00 
+  8020cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d0:	48 b9 1e 06 80 00 00 	movabs $0x80061e,%rcx
+  8020d7:	00 00 00 
+  8020da:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020dc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020e3:	eb b5                	jmp    80209a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020e5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020ec:	eb ac                	jmp    80209a <write+0x65>
+
+00000000008020ee <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8020ee:	55                   	push   %rbp
+  8020ef:	48 89 e5             	mov    %rsp,%rbp
+  8020f2:	53                   	push   %rbx
+  8020f3:	48 83 ec 18          	sub    $0x18,%rsp
+  8020f7:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020f9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020fd:	48 b8 23 1c 80 00 00 	movabs $0x801c23,%rax
+  802104:	00 00 00 
+  802107:	ff d0                	call   *%rax
+  802109:	85 c0                	test   %eax,%eax
+  80210b:	78 0c                	js     802119 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80210d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802111:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802114:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802119:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80211d:	c9                   	leave
+  80211e:	c3                   	ret
+
+000000000080211f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80211f:	55                   	push   %rbp
+  802120:	48 89 e5             	mov    %rsp,%rbp
+  802123:	41 55                	push   %r13
+  802125:	41 54                	push   %r12
+  802127:	53                   	push   %rbx
+  802128:	48 83 ec 18          	sub    $0x18,%rsp
+  80212c:	89 fb                	mov    %edi,%ebx
+  80212e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802131:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802135:	48 b8 23 1c 80 00 00 	movabs $0x801c23,%rax
+  80213c:	00 00 00 
+  80213f:	ff d0                	call   *%rax
+  802141:	85 c0                	test   %eax,%eax
+  802143:	78 38                	js     80217d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802145:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802149:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80214d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802151:	48 b8 6e 1c 80 00 00 	movabs $0x801c6e,%rax
+  802158:	00 00 00 
+  80215b:	ff d0                	call   *%rax
+  80215d:	85 c0                	test   %eax,%eax
+  80215f:	78 1c                	js     80217d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802161:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802166:	74 20                	je     802188 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802168:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80216c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802170:	48 85 c0             	test   %rax,%rax
+  802173:	74 47                	je     8021bc <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802175:	44 89 e6             	mov    %r12d,%esi
+  802178:	4c 89 ef             	mov    %r13,%rdi
+  80217b:	ff d0                	call   *%rax
+}
+  80217d:	48 83 c4 18          	add    $0x18,%rsp
+  802181:	5b                   	pop    %rbx
+  802182:	41 5c                	pop    %r12
+  802184:	41 5d                	pop    %r13
+  802186:	5d                   	pop    %rbp
+  802187:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802188:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80218f:	00 00 00 
+  802192:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802198:	89 da                	mov    %ebx,%edx
+  80219a:	48 bf 28 37 80 00 00 	movabs $0x803728,%rdi
+  8021a1:	00 00 00 
+  8021a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a9:	48 b9 1e 06 80 00 00 	movabs $0x80061e,%rcx
+  8021b0:	00 00 00 
+  8021b3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021ba:	eb c1                	jmp    80217d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021bc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021c1:	eb ba                	jmp    80217d <ftruncate+0x5e>
+
+00000000008021c3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8021c3:	55                   	push   %rbp
+  8021c4:	48 89 e5             	mov    %rsp,%rbp
+  8021c7:	41 54                	push   %r12
+  8021c9:	53                   	push   %rbx
+  8021ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8021ce:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021d1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021d5:	48 b8 23 1c 80 00 00 	movabs $0x801c23,%rax
+  8021dc:	00 00 00 
+  8021df:	ff d0                	call   *%rax
+  8021e1:	85 c0                	test   %eax,%eax
+  8021e3:	78 4e                	js     802233 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021e5:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8021e9:	41 8b 3c 24          	mov    (%r12),%edi
+  8021ed:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8021f1:	48 b8 6e 1c 80 00 00 	movabs $0x801c6e,%rax
+  8021f8:	00 00 00 
+  8021fb:	ff d0                	call   *%rax
+  8021fd:	85 c0                	test   %eax,%eax
+  8021ff:	78 32                	js     802233 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802201:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802205:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80220a:	74 30                	je     80223c <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80220c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80220f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802216:	00 00 00 
+    stat->st_isdir = 0;
+  802219:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802220:	00 00 00 
+    stat->st_dev = dev;
+  802223:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80222a:	48 89 de             	mov    %rbx,%rsi
+  80222d:	4c 89 e7             	mov    %r12,%rdi
+  802230:	ff 50 28             	call   *0x28(%rax)
+}
+  802233:	48 83 c4 10          	add    $0x10,%rsp
+  802237:	5b                   	pop    %rbx
+  802238:	41 5c                	pop    %r12
+  80223a:	5d                   	pop    %rbp
+  80223b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80223c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802241:	eb f0                	jmp    802233 <fstat+0x70>
+
+0000000000802243 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802243:	55                   	push   %rbp
+  802244:	48 89 e5             	mov    %rsp,%rbp
+  802247:	41 54                	push   %r12
+  802249:	53                   	push   %rbx
+  80224a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80224d:	be 00 00 00 00       	mov    $0x0,%esi
+  802252:	48 b8 c4 24 80 00 00 	movabs $0x8024c4,%rax
+  802259:	00 00 00 
+  80225c:	ff d0                	call   *%rax
+  80225e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802260:	85 c0                	test   %eax,%eax
+  802262:	78 25                	js     802289 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802264:	4c 89 e6             	mov    %r12,%rsi
+  802267:	89 c7                	mov    %eax,%edi
+  802269:	48 b8 c3 21 80 00 00 	movabs $0x8021c3,%rax
+  802270:	00 00 00 
+  802273:	ff d0                	call   *%rax
+  802275:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802278:	89 df                	mov    %ebx,%edi
+  80227a:	48 b8 88 1d 80 00 00 	movabs $0x801d88,%rax
+  802281:	00 00 00 
+  802284:	ff d0                	call   *%rax
+
+    return res;
+  802286:	44 89 e3             	mov    %r12d,%ebx
+}
+  802289:	89 d8                	mov    %ebx,%eax
+  80228b:	5b                   	pop    %rbx
+  80228c:	41 5c                	pop    %r12
+  80228e:	5d                   	pop    %rbp
+  80228f:	c3                   	ret
+
+0000000000802290 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802290:	55                   	push   %rbp
+  802291:	48 89 e5             	mov    %rsp,%rbp
+  802294:	41 54                	push   %r12
+  802296:	53                   	push   %rbx
+  802297:	48 83 ec 10          	sub    $0x10,%rsp
+  80229b:	41 89 fc             	mov    %edi,%r12d
+  80229e:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022a1:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8022a8:	00 00 00 
+  8022ab:	83 38 00             	cmpl   $0x0,(%rax)
+  8022ae:	74 5e                	je     80230e <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8022b0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022b6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022bb:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8022c2:	00 00 00 
+  8022c5:	44 89 e6             	mov    %r12d,%esi
+  8022c8:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8022cf:	00 00 00 
+  8022d2:	8b 38                	mov    (%rax),%edi
+  8022d4:	48 b8 fd 2e 80 00 00 	movabs $0x802efd,%rax
+  8022db:	00 00 00 
+  8022de:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8022e0:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8022e7:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8022e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022ed:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8022f1:	48 89 de             	mov    %rbx,%rsi
+  8022f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022f9:	48 b8 68 2e 80 00 00 	movabs $0x802e68,%rax
+  802300:	00 00 00 
+  802303:	ff d0                	call   *%rax
+}
+  802305:	48 83 c4 10          	add    $0x10,%rsp
+  802309:	5b                   	pop    %rbx
+  80230a:	41 5c                	pop    %r12
+  80230c:	5d                   	pop    %rbp
+  80230d:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80230e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802313:	48 b8 9d 2f 80 00 00 	movabs $0x802f9d,%rax
+  80231a:	00 00 00 
+  80231d:	ff d0                	call   *%rax
+  80231f:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802326:	00 00 
+  802328:	eb 86                	jmp    8022b0 <fsipc+0x20>
+
+000000000080232a <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80232a:	55                   	push   %rbp
+  80232b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80232e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802335:	00 00 00 
+  802338:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80233b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80233d:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802340:	be 00 00 00 00       	mov    $0x0,%esi
+  802345:	bf 02 00 00 00       	mov    $0x2,%edi
+  80234a:	48 b8 90 22 80 00 00 	movabs $0x802290,%rax
+  802351:	00 00 00 
+  802354:	ff d0                	call   *%rax
+}
+  802356:	5d                   	pop    %rbp
+  802357:	c3                   	ret
+
+0000000000802358 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802358:	55                   	push   %rbp
+  802359:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80235c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80235f:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802366:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802368:	be 00 00 00 00       	mov    $0x0,%esi
+  80236d:	bf 06 00 00 00       	mov    $0x6,%edi
+  802372:	48 b8 90 22 80 00 00 	movabs $0x802290,%rax
+  802379:	00 00 00 
+  80237c:	ff d0                	call   *%rax
+}
+  80237e:	5d                   	pop    %rbp
+  80237f:	c3                   	ret
+
+0000000000802380 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802380:	55                   	push   %rbp
+  802381:	48 89 e5             	mov    %rsp,%rbp
+  802384:	41 54                	push   %r12
+  802386:	53                   	push   %rbx
+  802387:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80238a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80238d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802394:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802396:	be 00 00 00 00       	mov    $0x0,%esi
+  80239b:	bf 05 00 00 00       	mov    $0x5,%edi
+  8023a0:	48 b8 90 22 80 00 00 	movabs $0x802290,%rax
+  8023a7:	00 00 00 
+  8023aa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023ac:	85 c0                	test   %eax,%eax
+  8023ae:	78 3d                	js     8023ed <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8023b0:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8023b7:	00 00 00 
+  8023ba:	4c 89 e6             	mov    %r12,%rsi
+  8023bd:	48 89 df             	mov    %rbx,%rdi
+  8023c0:	48 b8 43 0f 80 00 00 	movabs $0x800f43,%rax
+  8023c7:	00 00 00 
+  8023ca:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8023cc:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8023d3:	00 
+  8023d4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8023da:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8023e1:	00 
+  8023e2:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8023e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023ed:	5b                   	pop    %rbx
+  8023ee:	41 5c                	pop    %r12
+  8023f0:	5d                   	pop    %rbp
+  8023f1:	c3                   	ret
+
+00000000008023f2 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8023f2:	55                   	push   %rbp
+  8023f3:	48 89 e5             	mov    %rsp,%rbp
+  8023f6:	41 54                	push   %r12
+  8023f8:	53                   	push   %rbx
+  8023f9:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8023fc:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802401:	48 39 c2             	cmp    %rax,%rdx
+  802404:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802408:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80240b:	48 89 c2             	mov    %rax,%rdx
+  80240e:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802415:	00 00 00 
+  802418:	48 b8 a4 11 80 00 00 	movabs $0x8011a4,%rax
+  80241f:	00 00 00 
+  802422:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802424:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80242b:	00 00 00 
+  80242e:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802433:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802435:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  802439:	be 00 00 00 00       	mov    $0x0,%esi
+  80243e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802443:	48 b8 90 22 80 00 00 	movabs $0x802290,%rax
+  80244a:	00 00 00 
+  80244d:	ff d0                	call   *%rax
+  80244f:	48 98                	cltq
+}
+  802451:	5b                   	pop    %rbx
+  802452:	41 5c                	pop    %r12
+  802454:	5d                   	pop    %rbp
+  802455:	c3                   	ret
+
+0000000000802456 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802456:	55                   	push   %rbp
+  802457:	48 89 e5             	mov    %rsp,%rbp
+  80245a:	41 54                	push   %r12
+  80245c:	53                   	push   %rbx
+  80245d:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802460:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802467:	00 00 00 
+  80246a:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80246d:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  80246f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802474:	48 39 ca             	cmp    %rcx,%rdx
+  802477:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  80247b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  80247f:	be 00 00 00 00       	mov    $0x0,%esi
+  802484:	bf 03 00 00 00       	mov    $0x3,%edi
+  802489:	48 b8 90 22 80 00 00 	movabs $0x802290,%rax
+  802490:	00 00 00 
+  802493:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802495:	85 c0                	test   %eax,%eax
+  802497:	78 27                	js     8024c0 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802499:	48 63 d8             	movslq %eax,%rbx
+  80249c:	48 89 da             	mov    %rbx,%rdx
+  80249f:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8024a6:	00 00 00 
+  8024a9:	4c 89 e7             	mov    %r12,%rdi
+  8024ac:	48 b8 a4 11 80 00 00 	movabs $0x8011a4,%rax
+  8024b3:	00 00 00 
+  8024b6:	ff d0                	call   *%rax
+    return bytes_read;
+  8024b8:	48 89 d8             	mov    %rbx,%rax
+}
+  8024bb:	5b                   	pop    %rbx
+  8024bc:	41 5c                	pop    %r12
+  8024be:	5d                   	pop    %rbp
+  8024bf:	c3                   	ret
+        return bytes_read;
+  8024c0:	48 98                	cltq
+  8024c2:	eb f7                	jmp    8024bb <devfile_read+0x65>
+
+00000000008024c4 <open>:
+open(const char *path, int mode) {
+  8024c4:	55                   	push   %rbp
+  8024c5:	48 89 e5             	mov    %rsp,%rbp
+  8024c8:	41 55                	push   %r13
+  8024ca:	41 54                	push   %r12
+  8024cc:	53                   	push   %rbx
+  8024cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8024d1:	49 89 fc             	mov    %rdi,%r12
+  8024d4:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8024d7:	48 b8 05 0f 80 00 00 	movabs $0x800f05,%rax
+  8024de:	00 00 00 
+  8024e1:	ff d0                	call   *%rax
+  8024e3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024e9:	0f 87 8a 00 00 00    	ja     802579 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8024ef:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8024f3:	48 b8 c3 1b 80 00 00 	movabs $0x801bc3,%rax
+  8024fa:	00 00 00 
+  8024fd:	ff d0                	call   *%rax
+  8024ff:	89 c3                	mov    %eax,%ebx
+  802501:	85 c0                	test   %eax,%eax
+  802503:	78 50                	js     802555 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802505:	4c 89 e6             	mov    %r12,%rsi
+  802508:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80250f:	00 00 00 
+  802512:	48 89 df             	mov    %rbx,%rdi
+  802515:	48 b8 43 0f 80 00 00 	movabs $0x800f43,%rax
+  80251c:	00 00 00 
+  80251f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802521:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802528:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80252c:	bf 01 00 00 00       	mov    $0x1,%edi
+  802531:	48 b8 90 22 80 00 00 	movabs $0x802290,%rax
+  802538:	00 00 00 
+  80253b:	ff d0                	call   *%rax
+  80253d:	89 c3                	mov    %eax,%ebx
+  80253f:	85 c0                	test   %eax,%eax
+  802541:	78 1f                	js     802562 <open+0x9e>
+    return fd2num(fd);
+  802543:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802547:	48 b8 95 1b 80 00 00 	movabs $0x801b95,%rax
+  80254e:	00 00 00 
+  802551:	ff d0                	call   *%rax
+  802553:	89 c3                	mov    %eax,%ebx
+}
+  802555:	89 d8                	mov    %ebx,%eax
+  802557:	48 83 c4 18          	add    $0x18,%rsp
+  80255b:	5b                   	pop    %rbx
+  80255c:	41 5c                	pop    %r12
+  80255e:	41 5d                	pop    %r13
+  802560:	5d                   	pop    %rbp
+  802561:	c3                   	ret
+        fd_close(fd, 0);
+  802562:	be 00 00 00 00       	mov    $0x0,%esi
+  802567:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80256b:	48 b8 de 1c 80 00 00 	movabs $0x801cde,%rax
+  802572:	00 00 00 
+  802575:	ff d0                	call   *%rax
+        return res;
+  802577:	eb dc                	jmp    802555 <open+0x91>
+        return -E_BAD_PATH;
+  802579:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80257e:	eb d5                	jmp    802555 <open+0x91>
+
+0000000000802580 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802580:	55                   	push   %rbp
+  802581:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802584:	be 00 00 00 00       	mov    $0x0,%esi
+  802589:	bf 08 00 00 00       	mov    $0x8,%edi
+  80258e:	48 b8 90 22 80 00 00 	movabs $0x802290,%rax
+  802595:	00 00 00 
+  802598:	ff d0                	call   *%rax
+}
+  80259a:	5d                   	pop    %rbp
+  80259b:	c3                   	ret
+
+000000000080259c <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80259c:	55                   	push   %rbp
+  80259d:	48 89 e5             	mov    %rsp,%rbp
+  8025a0:	41 54                	push   %r12
+  8025a2:	53                   	push   %rbx
+  8025a3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025a6:	48 b8 a7 1b 80 00 00 	movabs $0x801ba7,%rax
+  8025ad:	00 00 00 
+  8025b0:	ff d0                	call   *%rax
+  8025b2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8025b5:	48 be c0 37 80 00 00 	movabs $0x8037c0,%rsi
+  8025bc:	00 00 00 
+  8025bf:	48 89 df             	mov    %rbx,%rdi
+  8025c2:	48 b8 43 0f 80 00 00 	movabs $0x800f43,%rax
+  8025c9:	00 00 00 
+  8025cc:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8025ce:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8025d3:	41 2b 04 24          	sub    (%r12),%eax
+  8025d7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8025dd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8025e4:	00 00 00 
+    stat->st_dev = &devpipe;
+  8025e7:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8025ee:	00 00 00 
+  8025f1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8025f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025fd:	5b                   	pop    %rbx
+  8025fe:	41 5c                	pop    %r12
+  802600:	5d                   	pop    %rbp
+  802601:	c3                   	ret
+
+0000000000802602 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802602:	55                   	push   %rbp
+  802603:	48 89 e5             	mov    %rsp,%rbp
+  802606:	41 54                	push   %r12
+  802608:	53                   	push   %rbx
+  802609:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80260c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802611:	48 89 fe             	mov    %rdi,%rsi
+  802614:	bf 00 00 00 00       	mov    $0x0,%edi
+  802619:	49 bc bf 15 80 00 00 	movabs $0x8015bf,%r12
+  802620:	00 00 00 
+  802623:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802626:	48 89 df             	mov    %rbx,%rdi
+  802629:	48 b8 a7 1b 80 00 00 	movabs $0x801ba7,%rax
+  802630:	00 00 00 
+  802633:	ff d0                	call   *%rax
+  802635:	48 89 c6             	mov    %rax,%rsi
+  802638:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80263d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802642:	41 ff d4             	call   *%r12
+}
+  802645:	5b                   	pop    %rbx
+  802646:	41 5c                	pop    %r12
+  802648:	5d                   	pop    %rbp
+  802649:	c3                   	ret
+
+000000000080264a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80264a:	55                   	push   %rbp
+  80264b:	48 89 e5             	mov    %rsp,%rbp
+  80264e:	41 57                	push   %r15
+  802650:	41 56                	push   %r14
+  802652:	41 55                	push   %r13
+  802654:	41 54                	push   %r12
+  802656:	53                   	push   %rbx
+  802657:	48 83 ec 18          	sub    $0x18,%rsp
+  80265b:	49 89 fc             	mov    %rdi,%r12
+  80265e:	49 89 f5             	mov    %rsi,%r13
+  802661:	49 89 d7             	mov    %rdx,%r15
+  802664:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802668:	48 b8 a7 1b 80 00 00 	movabs $0x801ba7,%rax
+  80266f:	00 00 00 
+  802672:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802674:	4d 85 ff             	test   %r15,%r15
+  802677:	0f 84 af 00 00 00    	je     80272c <devpipe_write+0xe2>
+  80267d:	48 89 c3             	mov    %rax,%rbx
+  802680:	4c 89 f8             	mov    %r15,%rax
+  802683:	4d 89 ef             	mov    %r13,%r15
+  802686:	4c 01 e8             	add    %r13,%rax
+  802689:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80268d:	49 bd c7 14 80 00 00 	movabs $0x8014c7,%r13
+  802694:	00 00 00 
+            sys_yield();
+  802697:	49 be 64 14 80 00 00 	movabs $0x801464,%r14
+  80269e:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8026a1:	8b 73 04             	mov    0x4(%rbx),%esi
+  8026a4:	48 63 ce             	movslq %esi,%rcx
+  8026a7:	48 63 03             	movslq (%rbx),%rax
+  8026aa:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8026b0:	48 39 c1             	cmp    %rax,%rcx
+  8026b3:	72 2e                	jb     8026e3 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026b5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026ba:	48 89 da             	mov    %rbx,%rdx
+  8026bd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026c2:	4c 89 e7             	mov    %r12,%rdi
+  8026c5:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026c8:	85 c0                	test   %eax,%eax
+  8026ca:	74 66                	je     802732 <devpipe_write+0xe8>
+            sys_yield();
+  8026cc:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8026cf:	8b 73 04             	mov    0x4(%rbx),%esi
+  8026d2:	48 63 ce             	movslq %esi,%rcx
+  8026d5:	48 63 03             	movslq (%rbx),%rax
+  8026d8:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8026de:	48 39 c1             	cmp    %rax,%rcx
+  8026e1:	73 d2                	jae    8026b5 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8026e3:	41 0f b6 3f          	movzbl (%r15),%edi
+  8026e7:	48 89 ca             	mov    %rcx,%rdx
+  8026ea:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026ee:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8026f5:	08 10 20 
+  8026f8:	48 f7 e2             	mul    %rdx
+  8026fb:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026ff:	48 89 d0             	mov    %rdx,%rax
+  802702:	48 c1 e0 09          	shl    $0x9,%rax
+  802706:	48 29 d0             	sub    %rdx,%rax
+  802709:	48 c1 e0 03          	shl    $0x3,%rax
+  80270d:	48 29 c1             	sub    %rax,%rcx
+  802710:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802715:	83 c6 01             	add    $0x1,%esi
+  802718:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80271b:	49 83 c7 01          	add    $0x1,%r15
+  80271f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802723:	49 39 c7             	cmp    %rax,%r15
+  802726:	0f 85 75 ff ff ff    	jne    8026a1 <devpipe_write+0x57>
+    return n;
+  80272c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802730:	eb 05                	jmp    802737 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802732:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802737:	48 83 c4 18          	add    $0x18,%rsp
+  80273b:	5b                   	pop    %rbx
+  80273c:	41 5c                	pop    %r12
+  80273e:	41 5d                	pop    %r13
+  802740:	41 5e                	pop    %r14
+  802742:	41 5f                	pop    %r15
+  802744:	5d                   	pop    %rbp
+  802745:	c3                   	ret
+
+0000000000802746 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802746:	55                   	push   %rbp
+  802747:	48 89 e5             	mov    %rsp,%rbp
+  80274a:	41 57                	push   %r15
+  80274c:	41 56                	push   %r14
+  80274e:	41 55                	push   %r13
+  802750:	41 54                	push   %r12
+  802752:	53                   	push   %rbx
+  802753:	48 83 ec 18          	sub    $0x18,%rsp
+  802757:	49 89 fc             	mov    %rdi,%r12
+  80275a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80275e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802762:	48 b8 a7 1b 80 00 00 	movabs $0x801ba7,%rax
+  802769:	00 00 00 
+  80276c:	ff d0                	call   *%rax
+  80276e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802771:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802777:	49 bd c7 14 80 00 00 	movabs $0x8014c7,%r13
+  80277e:	00 00 00 
+            sys_yield();
+  802781:	49 be 64 14 80 00 00 	movabs $0x801464,%r14
+  802788:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80278b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802790:	74 7d                	je     80280f <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802792:	8b 03                	mov    (%rbx),%eax
+  802794:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802797:	75 26                	jne    8027bf <devpipe_read+0x79>
+            if (i > 0) return i;
+  802799:	4d 85 ff             	test   %r15,%r15
+  80279c:	75 77                	jne    802815 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80279e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8027a3:	48 89 da             	mov    %rbx,%rdx
+  8027a6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8027ab:	4c 89 e7             	mov    %r12,%rdi
+  8027ae:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8027b1:	85 c0                	test   %eax,%eax
+  8027b3:	74 72                	je     802827 <devpipe_read+0xe1>
+            sys_yield();
+  8027b5:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8027b8:	8b 03                	mov    (%rbx),%eax
+  8027ba:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8027bd:	74 df                	je     80279e <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8027bf:	48 63 c8             	movslq %eax,%rcx
+  8027c2:	48 89 ca             	mov    %rcx,%rdx
+  8027c5:	48 c1 ea 03          	shr    $0x3,%rdx
+  8027c9:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8027d0:	08 10 20 
+  8027d3:	48 89 d0             	mov    %rdx,%rax
+  8027d6:	48 f7 e6             	mul    %rsi
+  8027d9:	48 c1 ea 06          	shr    $0x6,%rdx
+  8027dd:	48 89 d0             	mov    %rdx,%rax
+  8027e0:	48 c1 e0 09          	shl    $0x9,%rax
+  8027e4:	48 29 d0             	sub    %rdx,%rax
+  8027e7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8027ee:	00 
+  8027ef:	48 89 c8             	mov    %rcx,%rax
+  8027f2:	48 29 d0             	sub    %rdx,%rax
+  8027f5:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8027fa:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8027fe:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802802:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802805:	49 83 c7 01          	add    $0x1,%r15
+  802809:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80280d:	75 83                	jne    802792 <devpipe_read+0x4c>
+    return n;
+  80280f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802813:	eb 03                	jmp    802818 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802815:	4c 89 f8             	mov    %r15,%rax
+}
+  802818:	48 83 c4 18          	add    $0x18,%rsp
+  80281c:	5b                   	pop    %rbx
+  80281d:	41 5c                	pop    %r12
+  80281f:	41 5d                	pop    %r13
+  802821:	41 5e                	pop    %r14
+  802823:	41 5f                	pop    %r15
+  802825:	5d                   	pop    %rbp
+  802826:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802827:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282c:	eb ea                	jmp    802818 <devpipe_read+0xd2>
+
+000000000080282e <pipe>:
+pipe(int pfd[2]) {
+  80282e:	55                   	push   %rbp
+  80282f:	48 89 e5             	mov    %rsp,%rbp
+  802832:	41 55                	push   %r13
+  802834:	41 54                	push   %r12
+  802836:	53                   	push   %rbx
+  802837:	48 83 ec 18          	sub    $0x18,%rsp
+  80283b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80283e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802842:	48 b8 c3 1b 80 00 00 	movabs $0x801bc3,%rax
+  802849:	00 00 00 
+  80284c:	ff d0                	call   *%rax
+  80284e:	89 c3                	mov    %eax,%ebx
+  802850:	85 c0                	test   %eax,%eax
+  802852:	0f 88 a0 01 00 00    	js     8029f8 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802858:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80285d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802862:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802866:	bf 00 00 00 00       	mov    $0x0,%edi
+  80286b:	48 b8 f3 14 80 00 00 	movabs $0x8014f3,%rax
+  802872:	00 00 00 
+  802875:	ff d0                	call   *%rax
+  802877:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802879:	85 c0                	test   %eax,%eax
+  80287b:	0f 88 77 01 00 00    	js     8029f8 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802881:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802885:	48 b8 c3 1b 80 00 00 	movabs $0x801bc3,%rax
+  80288c:	00 00 00 
+  80288f:	ff d0                	call   *%rax
+  802891:	89 c3                	mov    %eax,%ebx
+  802893:	85 c0                	test   %eax,%eax
+  802895:	0f 88 43 01 00 00    	js     8029de <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80289b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8028a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028a5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8028a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028ae:	48 b8 f3 14 80 00 00 	movabs $0x8014f3,%rax
+  8028b5:	00 00 00 
+  8028b8:	ff d0                	call   *%rax
+  8028ba:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8028bc:	85 c0                	test   %eax,%eax
+  8028be:	0f 88 1a 01 00 00    	js     8029de <pipe+0x1b0>
+    va = fd2data(fd0);
+  8028c4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028c8:	48 b8 a7 1b 80 00 00 	movabs $0x801ba7,%rax
+  8028cf:	00 00 00 
+  8028d2:	ff d0                	call   *%rax
+  8028d4:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8028d7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8028dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028e1:	48 89 c6             	mov    %rax,%rsi
+  8028e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028e9:	48 b8 f3 14 80 00 00 	movabs $0x8014f3,%rax
+  8028f0:	00 00 00 
+  8028f3:	ff d0                	call   *%rax
+  8028f5:	89 c3                	mov    %eax,%ebx
+  8028f7:	85 c0                	test   %eax,%eax
+  8028f9:	0f 88 c5 00 00 00    	js     8029c4 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8028ff:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802903:	48 b8 a7 1b 80 00 00 	movabs $0x801ba7,%rax
+  80290a:	00 00 00 
+  80290d:	ff d0                	call   *%rax
+  80290f:	48 89 c1             	mov    %rax,%rcx
+  802912:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802918:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80291e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802923:	4c 89 ee             	mov    %r13,%rsi
+  802926:	bf 00 00 00 00       	mov    $0x0,%edi
+  80292b:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  802932:	00 00 00 
+  802935:	ff d0                	call   *%rax
+  802937:	89 c3                	mov    %eax,%ebx
+  802939:	85 c0                	test   %eax,%eax
+  80293b:	78 6e                	js     8029ab <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80293d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802942:	4c 89 ef             	mov    %r13,%rdi
+  802945:	48 b8 95 14 80 00 00 	movabs $0x801495,%rax
+  80294c:	00 00 00 
+  80294f:	ff d0                	call   *%rax
+  802951:	83 f8 02             	cmp    $0x2,%eax
+  802954:	0f 85 ab 00 00 00    	jne    802a05 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80295a:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802961:	00 00 
+  802963:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802967:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802969:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80296d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802974:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802978:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80297a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80297e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802985:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802989:	48 bb 95 1b 80 00 00 	movabs $0x801b95,%rbx
+  802990:	00 00 00 
+  802993:	ff d3                	call   *%rbx
+  802995:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802999:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80299d:	ff d3                	call   *%rbx
+  80299f:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8029a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029a9:	eb 4d                	jmp    8029f8 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8029ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029b0:	4c 89 ee             	mov    %r13,%rsi
+  8029b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029b8:	48 b8 bf 15 80 00 00 	movabs $0x8015bf,%rax
+  8029bf:	00 00 00 
+  8029c2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8029c4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029c9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8029cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029d2:	48 b8 bf 15 80 00 00 	movabs $0x8015bf,%rax
+  8029d9:	00 00 00 
+  8029dc:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8029de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029e3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8029e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029ec:	48 b8 bf 15 80 00 00 	movabs $0x8015bf,%rax
+  8029f3:	00 00 00 
+  8029f6:	ff d0                	call   *%rax
+}
+  8029f8:	89 d8                	mov    %ebx,%eax
+  8029fa:	48 83 c4 18          	add    $0x18,%rsp
+  8029fe:	5b                   	pop    %rbx
+  8029ff:	41 5c                	pop    %r12
+  802a01:	41 5d                	pop    %r13
+  802a03:	5d                   	pop    %rbp
+  802a04:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802a05:	48 b9 f0 37 80 00 00 	movabs $0x8037f0,%rcx
+  802a0c:	00 00 00 
+  802a0f:	48 ba c7 37 80 00 00 	movabs $0x8037c7,%rdx
+  802a16:	00 00 00 
+  802a19:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802a1e:	48 bf dc 37 80 00 00 	movabs $0x8037dc,%rdi
+  802a25:	00 00 00 
+  802a28:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a2d:	49 b8 ce 04 80 00 00 	movabs $0x8004ce,%r8
+  802a34:	00 00 00 
+  802a37:	41 ff d0             	call   *%r8
+
+0000000000802a3a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802a3a:	55                   	push   %rbp
+  802a3b:	48 89 e5             	mov    %rsp,%rbp
+  802a3e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802a42:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802a46:	48 b8 23 1c 80 00 00 	movabs $0x801c23,%rax
+  802a4d:	00 00 00 
+  802a50:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a52:	85 c0                	test   %eax,%eax
+  802a54:	78 35                	js     802a8b <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802a56:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a5a:	48 b8 a7 1b 80 00 00 	movabs $0x801ba7,%rax
+  802a61:	00 00 00 
+  802a64:	ff d0                	call   *%rax
+  802a66:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802a69:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802a6e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a73:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a77:	48 b8 c7 14 80 00 00 	movabs $0x8014c7,%rax
+  802a7e:	00 00 00 
+  802a81:	ff d0                	call   *%rax
+  802a83:	85 c0                	test   %eax,%eax
+  802a85:	0f 94 c0             	sete   %al
+  802a88:	0f b6 c0             	movzbl %al,%eax
+}
+  802a8b:	c9                   	leave
+  802a8c:	c3                   	ret
+
+0000000000802a8d <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a8d:	48 89 f8             	mov    %rdi,%rax
+  802a90:	48 c1 e8 27          	shr    $0x27,%rax
+  802a94:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a9b:	01 00 00 
+  802a9e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802aa2:	f6 c2 01             	test   $0x1,%dl
+  802aa5:	74 6d                	je     802b14 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802aa7:	48 89 f8             	mov    %rdi,%rax
+  802aaa:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802aae:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802ab5:	01 00 00 
+  802ab8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802abc:	f6 c2 01             	test   $0x1,%dl
+  802abf:	74 62                	je     802b23 <get_uvpt_entry+0x96>
+  802ac1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802ac8:	01 00 00 
+  802acb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802acf:	f6 c2 80             	test   $0x80,%dl
+  802ad2:	75 4f                	jne    802b23 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802ad4:	48 89 f8             	mov    %rdi,%rax
+  802ad7:	48 c1 e8 15          	shr    $0x15,%rax
+  802adb:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802ae2:	01 00 00 
+  802ae5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ae9:	f6 c2 01             	test   $0x1,%dl
+  802aec:	74 44                	je     802b32 <get_uvpt_entry+0xa5>
+  802aee:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802af5:	01 00 00 
+  802af8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802afc:	f6 c2 80             	test   $0x80,%dl
+  802aff:	75 31                	jne    802b32 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802b01:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802b05:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b0c:	01 00 00 
+  802b0f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802b13:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802b14:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802b1b:	01 00 00 
+  802b1e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b22:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802b23:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802b2a:	01 00 00 
+  802b2d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b31:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802b32:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802b39:	01 00 00 
+  802b3c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b40:	c3                   	ret
+
+0000000000802b41 <get_prot>:
+
+int
+get_prot(void *va) {
+  802b41:	55                   	push   %rbp
+  802b42:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b45:	48 b8 8d 2a 80 00 00 	movabs $0x802a8d,%rax
+  802b4c:	00 00 00 
+  802b4f:	ff d0                	call   *%rax
+  802b51:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802b54:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802b59:	89 c1                	mov    %eax,%ecx
+  802b5b:	83 c9 04             	or     $0x4,%ecx
+  802b5e:	f6 c2 01             	test   $0x1,%dl
+  802b61:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802b64:	89 c1                	mov    %eax,%ecx
+  802b66:	83 c9 02             	or     $0x2,%ecx
+  802b69:	f6 c2 02             	test   $0x2,%dl
+  802b6c:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802b6f:	89 c1                	mov    %eax,%ecx
+  802b71:	83 c9 01             	or     $0x1,%ecx
+  802b74:	48 85 d2             	test   %rdx,%rdx
+  802b77:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802b7a:	89 c1                	mov    %eax,%ecx
+  802b7c:	83 c9 40             	or     $0x40,%ecx
+  802b7f:	f6 c6 04             	test   $0x4,%dh
+  802b82:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802b85:	5d                   	pop    %rbp
+  802b86:	c3                   	ret
+
+0000000000802b87 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802b87:	55                   	push   %rbp
+  802b88:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b8b:	48 b8 8d 2a 80 00 00 	movabs $0x802a8d,%rax
+  802b92:	00 00 00 
+  802b95:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802b97:	48 c1 e8 06          	shr    $0x6,%rax
+  802b9b:	83 e0 01             	and    $0x1,%eax
+}
+  802b9e:	5d                   	pop    %rbp
+  802b9f:	c3                   	ret
+
+0000000000802ba0 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802ba0:	55                   	push   %rbp
+  802ba1:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802ba4:	48 b8 8d 2a 80 00 00 	movabs $0x802a8d,%rax
+  802bab:	00 00 00 
+  802bae:	ff d0                	call   *%rax
+  802bb0:	83 e0 01             	and    $0x1,%eax
+}
+  802bb3:	5d                   	pop    %rbp
+  802bb4:	c3                   	ret
+
+0000000000802bb5 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802bb5:	55                   	push   %rbp
+  802bb6:	48 89 e5             	mov    %rsp,%rbp
+  802bb9:	41 57                	push   %r15
+  802bbb:	41 56                	push   %r14
+  802bbd:	41 55                	push   %r13
+  802bbf:	41 54                	push   %r12
+  802bc1:	53                   	push   %rbx
+  802bc2:	48 83 ec 18          	sub    $0x18,%rsp
+  802bc6:	49 89 ff             	mov    %rdi,%r15
+  802bc9:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802bcd:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802bd2:	49 bc a0 2b 80 00 00 	movabs $0x802ba0,%r12
+  802bd9:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802bdc:	49 be 41 2b 80 00 00 	movabs $0x802b41,%r14
+  802be3:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802be6:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802bed:	00 00 00 
+  802bf0:	eb 0c                	jmp    802bfe <foreach_shared_region+0x49>
+  802bf2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802bf9:	4c 39 eb             	cmp    %r13,%rbx
+  802bfc:	74 38                	je     802c36 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802bfe:	48 89 df             	mov    %rbx,%rdi
+  802c01:	41 ff d4             	call   *%r12
+  802c04:	84 c0                	test   %al,%al
+  802c06:	74 ea                	je     802bf2 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802c08:	48 89 df             	mov    %rbx,%rdi
+  802c0b:	41 ff d6             	call   *%r14
+  802c0e:	a8 40                	test   $0x40,%al
+  802c10:	74 e0                	je     802bf2 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802c12:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802c19:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802c1d:	48 89 df             	mov    %rbx,%rdi
+  802c20:	41 ff d7             	call   *%r15
+        if (err)
+  802c23:	85 c0                	test   %eax,%eax
+  802c25:	74 cb                	je     802bf2 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802c27:	48 83 c4 18          	add    $0x18,%rsp
+  802c2b:	5b                   	pop    %rbx
+  802c2c:	41 5c                	pop    %r12
+  802c2e:	41 5d                	pop    %r13
+  802c30:	41 5e                	pop    %r14
+  802c32:	41 5f                	pop    %r15
+  802c34:	5d                   	pop    %rbp
+  802c35:	c3                   	ret
+    return 0;
+  802c36:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c3b:	eb ea                	jmp    802c27 <foreach_shared_region+0x72>
+
+0000000000802c3d <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c42:	c3                   	ret
+
+0000000000802c43 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802c43:	55                   	push   %rbp
+  802c44:	48 89 e5             	mov    %rsp,%rbp
+  802c47:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802c4a:	48 be 14 38 80 00 00 	movabs $0x803814,%rsi
+  802c51:	00 00 00 
+  802c54:	48 b8 43 0f 80 00 00 	movabs $0x800f43,%rax
+  802c5b:	00 00 00 
+  802c5e:	ff d0                	call   *%rax
+    return 0;
+}
+  802c60:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c65:	5d                   	pop    %rbp
+  802c66:	c3                   	ret
+
+0000000000802c67 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c67:	55                   	push   %rbp
+  802c68:	48 89 e5             	mov    %rsp,%rbp
+  802c6b:	41 57                	push   %r15
+  802c6d:	41 56                	push   %r14
+  802c6f:	41 55                	push   %r13
+  802c71:	41 54                	push   %r12
+  802c73:	53                   	push   %rbx
+  802c74:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802c7b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802c82:	48 85 d2             	test   %rdx,%rdx
+  802c85:	74 7a                	je     802d01 <devcons_write+0x9a>
+  802c87:	49 89 d6             	mov    %rdx,%r14
+  802c8a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802c90:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802c95:	49 bf 3d 11 80 00 00 	movabs $0x80113d,%r15
+  802c9c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802c9f:	4c 89 f3             	mov    %r14,%rbx
+  802ca2:	48 29 f3             	sub    %rsi,%rbx
+  802ca5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802caa:	48 39 c3             	cmp    %rax,%rbx
+  802cad:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802cb1:	4c 63 eb             	movslq %ebx,%r13
+  802cb4:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802cbb:	48 01 c6             	add    %rax,%rsi
+  802cbe:	4c 89 ea             	mov    %r13,%rdx
+  802cc1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802cc8:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802ccb:	4c 89 ee             	mov    %r13,%rsi
+  802cce:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802cd5:	48 b8 6a 13 80 00 00 	movabs $0x80136a,%rax
+  802cdc:	00 00 00 
+  802cdf:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802ce1:	41 01 dc             	add    %ebx,%r12d
+  802ce4:	49 63 f4             	movslq %r12d,%rsi
+  802ce7:	4c 39 f6             	cmp    %r14,%rsi
+  802cea:	72 b3                	jb     802c9f <devcons_write+0x38>
+    return res;
+  802cec:	49 63 c4             	movslq %r12d,%rax
+}
+  802cef:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802cf6:	5b                   	pop    %rbx
+  802cf7:	41 5c                	pop    %r12
+  802cf9:	41 5d                	pop    %r13
+  802cfb:	41 5e                	pop    %r14
+  802cfd:	41 5f                	pop    %r15
+  802cff:	5d                   	pop    %rbp
+  802d00:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802d01:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d07:	eb e3                	jmp    802cec <devcons_write+0x85>
+
+0000000000802d09 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d09:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802d0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d11:	48 85 c0             	test   %rax,%rax
+  802d14:	74 55                	je     802d6b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d16:	55                   	push   %rbp
+  802d17:	48 89 e5             	mov    %rsp,%rbp
+  802d1a:	41 55                	push   %r13
+  802d1c:	41 54                	push   %r12
+  802d1e:	53                   	push   %rbx
+  802d1f:	48 83 ec 08          	sub    $0x8,%rsp
+  802d23:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802d26:	48 bb 97 13 80 00 00 	movabs $0x801397,%rbx
+  802d2d:	00 00 00 
+  802d30:	49 bc 64 14 80 00 00 	movabs $0x801464,%r12
+  802d37:	00 00 00 
+  802d3a:	eb 03                	jmp    802d3f <devcons_read+0x36>
+  802d3c:	41 ff d4             	call   *%r12
+  802d3f:	ff d3                	call   *%rbx
+  802d41:	85 c0                	test   %eax,%eax
+  802d43:	74 f7                	je     802d3c <devcons_read+0x33>
+    if (c < 0) return c;
+  802d45:	48 63 d0             	movslq %eax,%rdx
+  802d48:	78 13                	js     802d5d <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802d4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d4f:	83 f8 04             	cmp    $0x4,%eax
+  802d52:	74 09                	je     802d5d <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802d54:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802d58:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802d5d:	48 89 d0             	mov    %rdx,%rax
+  802d60:	48 83 c4 08          	add    $0x8,%rsp
+  802d64:	5b                   	pop    %rbx
+  802d65:	41 5c                	pop    %r12
+  802d67:	41 5d                	pop    %r13
+  802d69:	5d                   	pop    %rbp
+  802d6a:	c3                   	ret
+  802d6b:	48 89 d0             	mov    %rdx,%rax
+  802d6e:	c3                   	ret
+
+0000000000802d6f <cputchar>:
+cputchar(int ch) {
+  802d6f:	55                   	push   %rbp
+  802d70:	48 89 e5             	mov    %rsp,%rbp
+  802d73:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802d77:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802d7b:	be 01 00 00 00       	mov    $0x1,%esi
+  802d80:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802d84:	48 b8 6a 13 80 00 00 	movabs $0x80136a,%rax
+  802d8b:	00 00 00 
+  802d8e:	ff d0                	call   *%rax
+}
+  802d90:	c9                   	leave
+  802d91:	c3                   	ret
+
+0000000000802d92 <getchar>:
+getchar(void) {
+  802d92:	55                   	push   %rbp
+  802d93:	48 89 e5             	mov    %rsp,%rbp
+  802d96:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802d9a:	ba 01 00 00 00       	mov    $0x1,%edx
+  802d9f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802da3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802da8:	48 b8 06 1f 80 00 00 	movabs $0x801f06,%rax
+  802daf:	00 00 00 
+  802db2:	ff d0                	call   *%rax
+  802db4:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802db6:	85 c0                	test   %eax,%eax
+  802db8:	78 06                	js     802dc0 <getchar+0x2e>
+  802dba:	74 08                	je     802dc4 <getchar+0x32>
+  802dbc:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802dc0:	89 d0                	mov    %edx,%eax
+  802dc2:	c9                   	leave
+  802dc3:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802dc4:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802dc9:	eb f5                	jmp    802dc0 <getchar+0x2e>
+
+0000000000802dcb <iscons>:
+iscons(int fdnum) {
+  802dcb:	55                   	push   %rbp
+  802dcc:	48 89 e5             	mov    %rsp,%rbp
+  802dcf:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802dd3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802dd7:	48 b8 23 1c 80 00 00 	movabs $0x801c23,%rax
+  802dde:	00 00 00 
+  802de1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802de3:	85 c0                	test   %eax,%eax
+  802de5:	78 18                	js     802dff <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802de7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802deb:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802df2:	00 00 00 
+  802df5:	8b 00                	mov    (%rax),%eax
+  802df7:	39 02                	cmp    %eax,(%rdx)
+  802df9:	0f 94 c0             	sete   %al
+  802dfc:	0f b6 c0             	movzbl %al,%eax
+}
+  802dff:	c9                   	leave
+  802e00:	c3                   	ret
+
+0000000000802e01 <opencons>:
+opencons(void) {
+  802e01:	55                   	push   %rbp
+  802e02:	48 89 e5             	mov    %rsp,%rbp
+  802e05:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e09:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802e0d:	48 b8 c3 1b 80 00 00 	movabs $0x801bc3,%rax
+  802e14:	00 00 00 
+  802e17:	ff d0                	call   *%rax
+  802e19:	85 c0                	test   %eax,%eax
+  802e1b:	78 49                	js     802e66 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802e1d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e22:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e27:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802e2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e30:	48 b8 f3 14 80 00 00 	movabs $0x8014f3,%rax
+  802e37:	00 00 00 
+  802e3a:	ff d0                	call   *%rax
+  802e3c:	85 c0                	test   %eax,%eax
+  802e3e:	78 26                	js     802e66 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802e40:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e44:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802e4b:	00 00 
+  802e4d:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802e4f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802e53:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802e5a:	48 b8 95 1b 80 00 00 	movabs $0x801b95,%rax
+  802e61:	00 00 00 
+  802e64:	ff d0                	call   *%rax
+}
+  802e66:	c9                   	leave
+  802e67:	c3                   	ret
+
+0000000000802e68 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802e68:	55                   	push   %rbp
+  802e69:	48 89 e5             	mov    %rsp,%rbp
+  802e6c:	41 54                	push   %r12
+  802e6e:	53                   	push   %rbx
+  802e6f:	48 89 fb             	mov    %rdi,%rbx
+  802e72:	48 89 f7             	mov    %rsi,%rdi
+  802e75:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802e78:	48 85 f6             	test   %rsi,%rsi
+  802e7b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802e82:	00 00 00 
+  802e85:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802e89:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e8e:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  802e95:	00 00 00 
+  802e98:	ff d0                	call   *%rax
+    if (res < 0) {
+  802e9a:	85 c0                	test   %eax,%eax
+  802e9c:	78 45                	js     802ee3 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802e9e:	48 85 db             	test   %rbx,%rbx
+  802ea1:	74 12                	je     802eb5 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802ea3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802eaa:	00 00 00 
+  802ead:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802eb3:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802eb5:	4d 85 e4             	test   %r12,%r12
+  802eb8:	74 14                	je     802ece <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802eba:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802ec1:	00 00 00 
+  802ec4:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802eca:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802ece:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802ed5:	00 00 00 
+  802ed8:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802ede:	5b                   	pop    %rbx
+  802edf:	41 5c                	pop    %r12
+  802ee1:	5d                   	pop    %rbp
+  802ee2:	c3                   	ret
+        if (from_env_store)
+  802ee3:	48 85 db             	test   %rbx,%rbx
+  802ee6:	74 06                	je     802eee <ipc_recv+0x86>
+            *from_env_store = 0;
+  802ee8:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802eee:	4d 85 e4             	test   %r12,%r12
+  802ef1:	74 eb                	je     802ede <ipc_recv+0x76>
+            *perm_store = 0;
+  802ef3:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802efa:	00 
+  802efb:	eb e1                	jmp    802ede <ipc_recv+0x76>
+
+0000000000802efd <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802efd:	55                   	push   %rbp
+  802efe:	48 89 e5             	mov    %rsp,%rbp
+  802f01:	41 57                	push   %r15
+  802f03:	41 56                	push   %r14
+  802f05:	41 55                	push   %r13
+  802f07:	41 54                	push   %r12
+  802f09:	53                   	push   %rbx
+  802f0a:	48 83 ec 18          	sub    $0x18,%rsp
+  802f0e:	41 89 fd             	mov    %edi,%r13d
+  802f11:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802f14:	48 89 d3             	mov    %rdx,%rbx
+  802f17:	49 89 cc             	mov    %rcx,%r12
+  802f1a:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802f1e:	48 85 d2             	test   %rdx,%rdx
+  802f21:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f28:	00 00 00 
+  802f2b:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802f2f:	49 be 31 18 80 00 00 	movabs $0x801831,%r14
+  802f36:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802f39:	49 bf 64 14 80 00 00 	movabs $0x801464,%r15
+  802f40:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802f43:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802f46:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802f4a:	4c 89 e1             	mov    %r12,%rcx
+  802f4d:	48 89 da             	mov    %rbx,%rdx
+  802f50:	44 89 ef             	mov    %r13d,%edi
+  802f53:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802f56:	85 c0                	test   %eax,%eax
+  802f58:	74 34                	je     802f8e <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802f5a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802f5d:	75 05                	jne    802f64 <ipc_send+0x67>
+        sys_yield();
+  802f5f:	41 ff d7             	call   *%r15
+    while (true) {
+  802f62:	eb df                	jmp    802f43 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802f64:	48 ba 20 38 80 00 00 	movabs $0x803820,%rdx
+  802f6b:	00 00 00 
+  802f6e:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802f73:	48 bf 39 38 80 00 00 	movabs $0x803839,%rdi
+  802f7a:	00 00 00 
+  802f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f82:	48 b9 ce 04 80 00 00 	movabs $0x8004ce,%rcx
+  802f89:	00 00 00 
+  802f8c:	ff d1                	call   *%rcx
+    }
+}
+  802f8e:	48 83 c4 18          	add    $0x18,%rsp
+  802f92:	5b                   	pop    %rbx
+  802f93:	41 5c                	pop    %r12
+  802f95:	41 5d                	pop    %r13
+  802f97:	41 5e                	pop    %r14
+  802f99:	41 5f                	pop    %r15
+  802f9b:	5d                   	pop    %rbp
+  802f9c:	c3                   	ret
+
+0000000000802f9d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802f9d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802fa2:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802fa9:	00 00 00 
+  802fac:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802fb3:	48 01 ca             	add    %rcx,%rdx
+  802fb6:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802fbc:	39 fa                	cmp    %edi,%edx
+  802fbe:	74 12                	je     802fd2 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802fc0:	48 83 c0 01          	add    $0x1,%rax
+  802fc4:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802fca:	75 e0                	jne    802fac <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802fcc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fd1:	c3                   	ret
+            return envs[i].env_id;
+  802fd2:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802fd9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802fe0:	00 00 00 
+  802fe3:	48 01 d0             	add    %rdx,%rax
+  802fe6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802fec:	c3                   	ret
+  802fed:	0f 1f 00             	nopl   (%rax)
+
+0000000000802ff0 <__rodata_start>:
+  802ff0:	73 79                	jae    80306b <__rodata_start+0x7b>
+  802ff2:	73 5f                	jae    803053 <__rodata_start+0x63>
+  802ff4:	61                   	(bad)
+  802ff5:	6c                   	insb   (%dx),%es:(%rdi)
+  802ff6:	6c                   	insb   (%dx),%es:(%rdi)
+  802ff7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ff8:	63 5f 72             	movsxd 0x72(%rdi),%ebx
+  802ffb:	65 67 69 6f 6e 3a 20 	imul   $0x6925203a,%gs:0x6e(%edi),%ebp
+  803002:	25 69 
+  803004:	00 75 73             	add    %dh,0x73(%rbp)
+  803007:	65 72 2f             	gs jb  803039 <__rodata_start+0x49>
+  80300a:	66 61                	data16 (bad)
+  80300c:	69 72 73 68 61 72 65 	imul   $0x65726168,0x73(%rdx),%esi
+  803013:	2e 63 00             	cs movsxd (%rax),%eax
+  803016:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803018:	72 6b                	jb     803085 <__rodata_start+0x95>
+  80301a:	3a 20                	cmp    (%rax),%ah
+  80301c:	25 69 00 73 79       	and    $0x79730069,%eax
+  803021:	73 5f                	jae    803082 <__rodata_start+0x92>
+  803023:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803025:	76 5f                	jbe    803086 <__rodata_start+0x96>
+  803027:	73 65                	jae    80308e <__rodata_start+0x9e>
+  803029:	74 5f                	je     80308a <__rodata_start+0x9a>
+  80302b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80302c:	69 63 65 3a 20 25 69 	imul   $0x6925203a,0x65(%rbx),%esp
+  803033:	00 63 68             	add    %ah,0x68(%rbx)
+  803036:	69 6c 64 20 77 69 74 	imul   $0x68746977,0x20(%rsp,%riz,2),%ebp
+  80303d:	68 
+  80303e:	20 6e 69             	and    %ch,0x69(%rsi)
+  803041:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803044:	30 20                	xor    %ah,(%rax)
+  803046:	64 69 64 20 6e 6f 74 	imul   $0x7220746f,%fs:0x6e(%rax,%riz,1),%esp
+  80304d:	20 72 
+  80304f:	75 6e                	jne    8030bf <__rodata_start+0xcf>
+  803051:	00 25 34 64 20 20    	add    %ah,0x20206434(%rip)        # 20a0948b <__bss_end+0x2020148b>
+  803057:	25 31 30 6c 75       	and    $0x756c3031,%eax
+  80305c:	20 20                	and    %ah,(%rax)
+  80305e:	25 6c 75 25 25       	and    $0x2525756c,%eax
+  803063:	0a 00                	or     (%rax),%al
+  803065:	66 61                	data16 (bad)
+  803067:	69 72 73 68 61 72 65 	imul   $0x65726168,0x73(%rdx),%esi
+  80306e:	3a 20                	cmp    (%rax),%ah
+  803070:	4f                   	rex.WRXB
+  803071:	4b 0a 00             	rex.WXB or (%r8),%al
+  803074:	0f 1f 40 00          	nopl   0x0(%rax)
+  803078:	63 68 69             	movsxd 0x69(%rax),%ebp
+  80307b:	6c                   	insb   (%dx),%es:(%rdi)
+  80307c:	64 20 63 6f          	and    %ah,%fs:0x6f(%rbx)
+  803080:	75 6c                	jne    8030ee <__rodata_start+0xfe>
+  803082:	64 20 6c 6f 77       	and    %ch,%fs:0x77(%rdi,%rbp,2)
+  803087:	65 72 20             	gs jb  8030aa <__rodata_start+0xba>
+  80308a:	69 74 73 20 6e 69 63 	imul   $0x6563696e,0x20(%rbx,%rsi,2),%esi
+  803091:	65 
+  803092:	20 76 61             	and    %dh,0x61(%rsi)
+  803095:	6c                   	insb   (%dx),%es:(%rdi)
+  803096:	75 65                	jne    8030fd <__rodata_start+0x10d>
+	...
+  8030a0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030a1:	69 63 65 20 20 69 74 	imul   $0x74692020,0x65(%rbx),%esp
+  8030a8:	65 72 61             	gs jb  80310c <weights+0xc>
+  8030ab:	74 69                	je     803116 <weights+0x16>
+  8030ad:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030ae:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030af:	73 20                	jae    8030d1 <__rodata_start+0xe1>
+  8030b1:	20 73 68             	and    %dh,0x68(%rbx)
+  8030b4:	61                   	(bad)
+  8030b5:	72 65                	jb     80311c <weights+0x1c>
+  8030b7:	20 6f 66             	and    %ch,0x66(%rdi)
+  8030ba:	20 6e 69             	and    %ch,0x69(%rsi)
+  8030bd:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8030c0:	30 0a                	xor    %cl,(%rdx)
+  8030c2:	00 00                	add    %al,(%rax)
+  8030c4:	00 00                	add    %al,(%rax)
+  8030c6:	00 00                	add    %al,(%rax)
+  8030c8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030c9:	69 63 65 20 25 64 20 	imul   $0x20642520,0x65(%rbx),%esp
+  8030d0:	67 6f                	outsl  %ds:(%esi),(%dx)
+  8030d2:	74 20                	je     8030f4 <__rodata_start+0x104>
+  8030d4:	25 6c 75 20 69       	and    $0x6920756c,%eax
+  8030d9:	74 65                	je     803140 <nices+0x20>
+  8030db:	72 61                	jb     80313e <nices+0x1e>
+  8030dd:	74 69                	je     803148 <nices+0x28>
+  8030df:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030e0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030e1:	73 2c                	jae    80310f <weights+0xf>
+  8030e3:	20 65 78             	and    %ah,0x78(%rbp)
+  8030e6:	70 65                	jo     80314d <nices+0x2d>
+  8030e8:	63 74 65 64          	movsxd 0x64(%rbp,%riz,2),%esi
+  8030ec:	20 61 62             	and    %ah,0x62(%rcx)
+  8030ef:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030f0:	75 74                	jne    803166 <nices+0x46>
+  8030f2:	20 25 6c 75 00 66    	and    %ah,0x6600756c(%rip)        # 6680a664 <__bss_end+0x66002664>
+  8030f8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8030ff:	00 
+
+0000000000803100 <weights>:
+  803100:	00 04 00 00 00 00 00 00 00 04 00 00 00 00 00 00     ................
+  803110:	0e 02 00 00 00 00 00 00 4f 01 00 00 00 00 00 00     ........O.......
+
+0000000000803120 <nices>:
+	...
+  803128:	03 00 00 00 05 00 00 00 3c 75 6e 6b 6e 6f 77 6e     ........<unknown
+  803138:	3e 00 66 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     >.f..D..[%08x] u
+  803148:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  803158:	61 74 20 25 73 3a 25 64 3a 20 00 30 31 32 33 34     at %s:%d: .01234
+  803168:	35 36 37 38 39 41 42 43 44 45 46 00 30 31 32 33     56789ABCDEF.0123
+  803178:	34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75     456789abcdef.(nu
+  803188:	6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73     ll).error %d.uns
+  803198:	70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62     pecified error.b
+  8031a8:	61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69     ad environment.i
+  8031b8:	6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72     nvalid parameter
+  8031c8:	00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f     .out of memory.o
+  8031d8:	75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e     ut of environmen
+  8031e8:	74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62     ts.corrupted deb
+  8031f8:	75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61     ug info.segmenta
+  803208:	74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c     tion fault.inval
+  803218:	69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20     id ELF image.no 
+  803228:	73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c     such system call
+  803238:	00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64     .entry not found
+  803248:	00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76     .env is not recv
+  803258:	69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65     ing.unexpected e
+  803268:	6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72     nd of file.no fr
+  803278:	65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b     ee space on disk
+  803288:	00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20     .too many files 
+  803298:	61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72     are open.file or
+  8032a8:	20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64      block not found
+  8032b8:	00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69     .invalid path.fi
+  8032c8:	6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74     le already exist
+  8032d8:	73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     s.operation not 
+  8032e8:	73 75 70 70 6f 72 74 65 64 00 6f 70 65 72 61 74     supported.operat
+  8032f8:	69 6f 6e 20 6e 6f 74 20 70 65 72 6d 69 74 74 65     ion not permitte
+  803308:	64 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     d.f.........f...
+  803318:	84 00 00 00 00 00 66 90 0b 08 80 00 00 00 00 00     ......f.........
+  803328:	4c 0e 80 00 00 00 00 00 3c 0e 80 00 00 00 00 00     L.......<.......
+  803338:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  803348:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  803358:	2a 08 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     *.......L.......
+  803368:	4c 0e 80 00 00 00 00 00 1e 08 80 00 00 00 00 00     L...............
+  803378:	98 08 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     ........L.......
+  803388:	1e 08 80 00 00 00 00 00 64 08 80 00 00 00 00 00     ........d.......
+  803398:	64 08 80 00 00 00 00 00 64 08 80 00 00 00 00 00     d.......d.......
+  8033a8:	64 08 80 00 00 00 00 00 64 08 80 00 00 00 00 00     d.......d.......
+  8033b8:	64 08 80 00 00 00 00 00 64 08 80 00 00 00 00 00     d.......d.......
+  8033c8:	64 08 80 00 00 00 00 00 64 08 80 00 00 00 00 00     d.......d.......
+  8033d8:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  8033e8:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  8033f8:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  803408:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  803418:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  803428:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  803438:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  803448:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  803458:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  803468:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  803478:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  803488:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  803498:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  8034a8:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  8034b8:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  8034c8:	6f 0d 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     o.......L.......
+  8034d8:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  8034e8:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  8034f8:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  803508:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  803518:	4c 0e 80 00 00 00 00 00 bb 08 80 00 00 00 00 00     L...............
+  803528:	8a 0a 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     ........L.......
+  803538:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  803548:	4c 0e 80 00 00 00 00 00 ea 08 80 00 00 00 00 00     L...............
+  803558:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  803568:	b0 08 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     ........L.......
+  803578:	4c 0e 80 00 00 00 00 00 32 0c 80 00 00 00 00 00     L.......2.......
+  803588:	fc 0c 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     ........L.......
+  803598:	4c 0e 80 00 00 00 00 00 81 09 80 00 00 00 00 00     L...............
+  8035a8:	4c 0e 80 00 00 00 00 00 5e 0b 80 00 00 00 00 00     L.......^.......
+  8035b8:	4c 0e 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     L.......L.......
+  8035c8:	6f 0d 80 00 00 00 00 00 4c 0e 80 00 00 00 00 00     o.......L.......
+  8035d8:	14 08 80 00 00 00 00 00                             ........
+
+00000000008035e0 <error_string>:
+	...
+  8035e8:	95 31 80 00 00 00 00 00 a7 31 80 00 00 00 00 00     .1.......1......
+  8035f8:	b7 31 80 00 00 00 00 00 c9 31 80 00 00 00 00 00     .1.......1......
+  803608:	d7 31 80 00 00 00 00 00 eb 31 80 00 00 00 00 00     .1.......1......
+  803618:	00 32 80 00 00 00 00 00 13 32 80 00 00 00 00 00     .2.......2......
+  803628:	25 32 80 00 00 00 00 00 39 32 80 00 00 00 00 00     %2......92......
+  803638:	49 32 80 00 00 00 00 00 5c 32 80 00 00 00 00 00     I2......\2......
+  803648:	73 32 80 00 00 00 00 00 89 32 80 00 00 00 00 00     s2.......2......
+  803658:	a1 32 80 00 00 00 00 00 b9 32 80 00 00 00 00 00     .2.......2......
+  803668:	c6 32 80 00 00 00 00 00 90 36 80 00 00 00 00 00     .2.......6......
+  803678:	da 32 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .2..............
+  803688:	f2 32 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .2......file is 
+  803698:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8036a8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8036b8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8036c8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8036d8:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  8036e8:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  8036f8:	6c 69 62 2f 66 6f 72 6b 2e 63 00 0f 1f 44 00 00     lib/fork.c...D..
+  803708:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803718:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803728:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803738:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803748:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803758:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803768:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803778:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803788:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803798:	0f 1f 84 00 00 00 00 00                             ........
+
+00000000008037a0 <devtab>:
+  8037a0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8037b0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8037c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8037d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8037e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8037f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803800:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803810:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803820:	69 70 63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64     ipc_send: failed
+  803830:	20 74 6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63      to send.lib/ipc
+  803840:	2e 63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     .c.f.........f..
+  803850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
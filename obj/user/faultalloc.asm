@@ -0,0 +1,6310 @@
+
+obj/user/faultalloc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 0c 01 00 00       	call   80012f <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+/* Test user-level fault handler -- alloc pages to fix faults */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+    void *addr = (void *)utf->utf_fault_va;
+  80002e:	48 8b 1f             	mov    (%rdi),%rbx
+
+    cprintf("fault %lx\n", (unsigned long)addr);
+  800031:	48 89 de             	mov    %rbx,%rsi
+  800034:	48 bf 78 31 80 00 00 	movabs $0x803178,%rdi
+  80003b:	00 00 00 
+  80003e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800043:	48 ba 49 03 80 00 00 	movabs $0x800349,%rdx
+  80004a:	00 00 00 
+  80004d:	ff d2                	call   *%rdx
+    if ((r = sys_alloc_region(0, ROUNDDOWN(addr, PAGE_SIZE),
+  80004f:	48 89 de             	mov    %rbx,%rsi
+  800052:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  800059:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80005e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800063:	bf 00 00 00 00       	mov    $0x0,%edi
+  800068:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	85 c0                	test   %eax,%eax
+  800076:	78 32                	js     8000aa <handler+0x85>
+                              PAGE_SIZE, PROT_RW)) < 0)
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+    snprintf((char *)addr, 100, "this string was faulted in at %lx", (unsigned long)addr);
+  800078:	48 89 d9             	mov    %rbx,%rcx
+  80007b:	48 ba d0 31 80 00 00 	movabs $0x8031d0,%rdx
+  800082:	00 00 00 
+  800085:	be 64 00 00 00       	mov    $0x64,%esi
+  80008a:	48 89 df             	mov    %rbx,%rdi
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	49 b8 f3 0b 80 00 00 	movabs $0x800bf3,%r8
+  800099:	00 00 00 
+  80009c:	41 ff d0             	call   *%r8
+    return 1;
+}
+  80009f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+  8000aa:	41 89 c0             	mov    %eax,%r8d
+  8000ad:	48 89 d9             	mov    %rbx,%rcx
+  8000b0:	48 ba a0 31 80 00 00 	movabs $0x8031a0,%rdx
+  8000b7:	00 00 00 
+  8000ba:	be 0d 00 00 00       	mov    $0xd,%esi
+  8000bf:	48 bf 83 31 80 00 00 	movabs $0x803183,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	49 b9 f9 01 80 00 00 	movabs $0x8001f9,%r9
+  8000d5:	00 00 00 
+  8000d8:	41 ff d1             	call   *%r9
+
+00000000008000db <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000db:	55                   	push   %rbp
+  8000dc:	48 89 e5             	mov    %rsp,%rbp
+  8000df:	41 54                	push   %r12
+  8000e1:	53                   	push   %rbx
+    add_pgfault_handler(handler);
+  8000e2:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  8000e9:	00 00 00 
+  8000ec:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+    cprintf("%s\n", (char *)0xBeefDead);
+  8000f8:	be ad de ef be       	mov    $0xbeefdead,%esi
+  8000fd:	49 bc 95 31 80 00 00 	movabs $0x803195,%r12
+  800104:	00 00 00 
+  800107:	4c 89 e7             	mov    %r12,%rdi
+  80010a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010f:	48 bb 49 03 80 00 00 	movabs $0x800349,%rbx
+  800116:	00 00 00 
+  800119:	ff d3                	call   *%rbx
+    cprintf("%s\n", (char *)0xCafeBffe);
+  80011b:	be fe bf fe ca       	mov    $0xcafebffe,%esi
+  800120:	4c 89 e7             	mov    %r12,%rdi
+  800123:	b8 00 00 00 00       	mov    $0x0,%eax
+  800128:	ff d3                	call   *%rbx
+}
+  80012a:	5b                   	pop    %rbx
+  80012b:	41 5c                	pop    %r12
+  80012d:	5d                   	pop    %rbp
+  80012e:	c3                   	ret
+
+000000000080012f <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80012f:	55                   	push   %rbp
+  800130:	48 89 e5             	mov    %rsp,%rbp
+  800133:	41 56                	push   %r14
+  800135:	41 55                	push   %r13
+  800137:	41 54                	push   %r12
+  800139:	53                   	push   %rbx
+  80013a:	41 89 fd             	mov    %edi,%r13d
+  80013d:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800140:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800147:	00 00 00 
+  80014a:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800151:	00 00 00 
+  800154:	48 39 c2             	cmp    %rax,%rdx
+  800157:	73 17                	jae    800170 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800159:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80015c:	49 89 c4             	mov    %rax,%r12
+  80015f:	48 83 c3 08          	add    $0x8,%rbx
+  800163:	b8 00 00 00 00       	mov    $0x0,%eax
+  800168:	ff 53 f8             	call   *-0x8(%rbx)
+  80016b:	4c 39 e3             	cmp    %r12,%rbx
+  80016e:	72 ef                	jb     80015f <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800170:	48 b8 5e 11 80 00 00 	movabs $0x80115e,%rax
+  800177:	00 00 00 
+  80017a:	ff d0                	call   *%rax
+  80017c:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  80017f:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800186:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80018d:	00 00 00 
+  800190:	48 01 d0             	add    %rdx,%rax
+  800193:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80019a:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80019d:	45 85 ed             	test   %r13d,%r13d
+  8001a0:	7e 0d                	jle    8001af <libmain+0x80>
+  8001a2:	49 8b 06             	mov    (%r14),%rax
+  8001a5:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001ac:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001af:	4c 89 f6             	mov    %r14,%rsi
+  8001b2:	44 89 ef             	mov    %r13d,%edi
+  8001b5:	48 b8 db 00 80 00 00 	movabs $0x8000db,%rax
+  8001bc:	00 00 00 
+  8001bf:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001c1:	48 b8 d6 01 80 00 00 	movabs $0x8001d6,%rax
+  8001c8:	00 00 00 
+  8001cb:	ff d0                	call   *%rax
+#endif
+}
+  8001cd:	5b                   	pop    %rbx
+  8001ce:	41 5c                	pop    %r12
+  8001d0:	41 5d                	pop    %r13
+  8001d2:	41 5e                	pop    %r14
+  8001d4:	5d                   	pop    %rbp
+  8001d5:	c3                   	ret
+
+00000000008001d6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001d6:	55                   	push   %rbp
+  8001d7:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001da:	48 b8 63 1d 80 00 00 	movabs $0x801d63,%rax
+  8001e1:	00 00 00 
+  8001e4:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001eb:	48 b8 f3 10 80 00 00 	movabs $0x8010f3,%rax
+  8001f2:	00 00 00 
+  8001f5:	ff d0                	call   *%rax
+}
+  8001f7:	5d                   	pop    %rbp
+  8001f8:	c3                   	ret
+
+00000000008001f9 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8001f9:	55                   	push   %rbp
+  8001fa:	48 89 e5             	mov    %rsp,%rbp
+  8001fd:	41 56                	push   %r14
+  8001ff:	41 55                	push   %r13
+  800201:	41 54                	push   %r12
+  800203:	53                   	push   %rbx
+  800204:	48 83 ec 50          	sub    $0x50,%rsp
+  800208:	49 89 fc             	mov    %rdi,%r12
+  80020b:	41 89 f5             	mov    %esi,%r13d
+  80020e:	48 89 d3             	mov    %rdx,%rbx
+  800211:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800215:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800219:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80021d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800224:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800228:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80022c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800230:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800234:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80023b:	00 00 00 
+  80023e:	4c 8b 30             	mov    (%rax),%r14
+  800241:	48 b8 5e 11 80 00 00 	movabs $0x80115e,%rax
+  800248:	00 00 00 
+  80024b:	ff d0                	call   *%rax
+  80024d:	89 c6                	mov    %eax,%esi
+  80024f:	45 89 e8             	mov    %r13d,%r8d
+  800252:	4c 89 e1             	mov    %r12,%rcx
+  800255:	4c 89 f2             	mov    %r14,%rdx
+  800258:	48 bf 00 32 80 00 00 	movabs $0x803200,%rdi
+  80025f:	00 00 00 
+  800262:	b8 00 00 00 00       	mov    $0x0,%eax
+  800267:	49 bc 49 03 80 00 00 	movabs $0x800349,%r12
+  80026e:	00 00 00 
+  800271:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800274:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800278:	48 89 df             	mov    %rbx,%rdi
+  80027b:	48 b8 e5 02 80 00 00 	movabs $0x8002e5,%rax
+  800282:	00 00 00 
+  800285:	ff d0                	call   *%rax
+    cprintf("\n");
+  800287:	48 bf eb 38 80 00 00 	movabs $0x8038eb,%rdi
+  80028e:	00 00 00 
+  800291:	b8 00 00 00 00       	mov    $0x0,%eax
+  800296:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800299:	cc                   	int3
+  80029a:	eb fd                	jmp    800299 <_panic+0xa0>
+
+000000000080029c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80029c:	55                   	push   %rbp
+  80029d:	48 89 e5             	mov    %rsp,%rbp
+  8002a0:	53                   	push   %rbx
+  8002a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a5:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002a8:	8b 06                	mov    (%rsi),%eax
+  8002aa:	8d 50 01             	lea    0x1(%rax),%edx
+  8002ad:	89 16                	mov    %edx,(%rsi)
+  8002af:	48 98                	cltq
+  8002b1:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002b6:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002bc:	74 0a                	je     8002c8 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002be:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002c6:	c9                   	leave
+  8002c7:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002c8:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002cc:	be ff 00 00 00       	mov    $0xff,%esi
+  8002d1:	48 b8 95 10 80 00 00 	movabs $0x801095,%rax
+  8002d8:	00 00 00 
+  8002db:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002dd:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002e3:	eb d9                	jmp    8002be <putch+0x22>
+
+00000000008002e5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002e5:	55                   	push   %rbp
+  8002e6:	48 89 e5             	mov    %rsp,%rbp
+  8002e9:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002f0:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002f3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002fa:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800304:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800307:	48 89 f1             	mov    %rsi,%rcx
+  80030a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800311:	48 bf 9c 02 80 00 00 	movabs $0x80029c,%rdi
+  800318:	00 00 00 
+  80031b:	48 b8 99 04 80 00 00 	movabs $0x800499,%rax
+  800322:	00 00 00 
+  800325:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800327:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80032e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800335:	48 b8 95 10 80 00 00 	movabs $0x801095,%rax
+  80033c:	00 00 00 
+  80033f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800341:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800347:	c9                   	leave
+  800348:	c3                   	ret
+
+0000000000800349 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800349:	55                   	push   %rbp
+  80034a:	48 89 e5             	mov    %rsp,%rbp
+  80034d:	48 83 ec 50          	sub    $0x50,%rsp
+  800351:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800355:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800359:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80035d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800361:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800365:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80036c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800370:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800374:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800378:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80037c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800380:	48 b8 e5 02 80 00 00 	movabs $0x8002e5,%rax
+  800387:	00 00 00 
+  80038a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80038c:	c9                   	leave
+  80038d:	c3                   	ret
+
+000000000080038e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80038e:	55                   	push   %rbp
+  80038f:	48 89 e5             	mov    %rsp,%rbp
+  800392:	41 57                	push   %r15
+  800394:	41 56                	push   %r14
+  800396:	41 55                	push   %r13
+  800398:	41 54                	push   %r12
+  80039a:	53                   	push   %rbx
+  80039b:	48 83 ec 18          	sub    $0x18,%rsp
+  80039f:	49 89 fc             	mov    %rdi,%r12
+  8003a2:	49 89 f5             	mov    %rsi,%r13
+  8003a5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003a9:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003ac:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003af:	41 89 cf             	mov    %ecx,%r15d
+  8003b2:	4c 39 fa             	cmp    %r15,%rdx
+  8003b5:	73 5b                	jae    800412 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003b7:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003bb:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003bf:	85 db                	test   %ebx,%ebx
+  8003c1:	7e 0e                	jle    8003d1 <print_num+0x43>
+            putch(padc, put_arg);
+  8003c3:	4c 89 ee             	mov    %r13,%rsi
+  8003c6:	44 89 f7             	mov    %r14d,%edi
+  8003c9:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003cc:	83 eb 01             	sub    $0x1,%ebx
+  8003cf:	75 f2                	jne    8003c3 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003d1:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003d5:	48 b9 34 32 80 00 00 	movabs $0x803234,%rcx
+  8003dc:	00 00 00 
+  8003df:	48 b8 23 32 80 00 00 	movabs $0x803223,%rax
+  8003e6:	00 00 00 
+  8003e9:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003ed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003f6:	49 f7 f7             	div    %r15
+  8003f9:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003fd:	4c 89 ee             	mov    %r13,%rsi
+  800400:	41 ff d4             	call   *%r12
+}
+  800403:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800407:	5b                   	pop    %rbx
+  800408:	41 5c                	pop    %r12
+  80040a:	41 5d                	pop    %r13
+  80040c:	41 5e                	pop    %r14
+  80040e:	41 5f                	pop    %r15
+  800410:	5d                   	pop    %rbp
+  800411:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800412:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800416:	ba 00 00 00 00       	mov    $0x0,%edx
+  80041b:	49 f7 f7             	div    %r15
+  80041e:	48 83 ec 08          	sub    $0x8,%rsp
+  800422:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800426:	52                   	push   %rdx
+  800427:	45 0f be c9          	movsbl %r9b,%r9d
+  80042b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80042f:	48 89 c2             	mov    %rax,%rdx
+  800432:	48 b8 8e 03 80 00 00 	movabs $0x80038e,%rax
+  800439:	00 00 00 
+  80043c:	ff d0                	call   *%rax
+  80043e:	48 83 c4 10          	add    $0x10,%rsp
+  800442:	eb 8d                	jmp    8003d1 <print_num+0x43>
+
+0000000000800444 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800444:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800448:	48 8b 06             	mov    (%rsi),%rax
+  80044b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80044f:	73 0a                	jae    80045b <sprintputch+0x17>
+        *state->start++ = ch;
+  800451:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800455:	48 89 16             	mov    %rdx,(%rsi)
+  800458:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80045b:	c3                   	ret
+
+000000000080045c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80045c:	55                   	push   %rbp
+  80045d:	48 89 e5             	mov    %rsp,%rbp
+  800460:	48 83 ec 50          	sub    $0x50,%rsp
+  800464:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800468:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80046c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800470:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800477:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80047b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80047f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800483:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800487:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80048b:	48 b8 99 04 80 00 00 	movabs $0x800499,%rax
+  800492:	00 00 00 
+  800495:	ff d0                	call   *%rax
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+
+0000000000800499 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800499:	55                   	push   %rbp
+  80049a:	48 89 e5             	mov    %rsp,%rbp
+  80049d:	41 57                	push   %r15
+  80049f:	41 56                	push   %r14
+  8004a1:	41 55                	push   %r13
+  8004a3:	41 54                	push   %r12
+  8004a5:	53                   	push   %rbx
+  8004a6:	48 83 ec 38          	sub    $0x38,%rsp
+  8004aa:	49 89 fe             	mov    %rdi,%r14
+  8004ad:	49 89 f5             	mov    %rsi,%r13
+  8004b0:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004b3:	48 8b 01             	mov    (%rcx),%rax
+  8004b6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004ba:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004c2:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004ca:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004ce:	0f b6 3b             	movzbl (%rbx),%edi
+  8004d1:	40 80 ff 25          	cmp    $0x25,%dil
+  8004d5:	74 18                	je     8004ef <vprintfmt+0x56>
+            if (!ch) return;
+  8004d7:	40 84 ff             	test   %dil,%dil
+  8004da:	0f 84 b1 06 00 00    	je     800b91 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004e0:	40 0f b6 ff          	movzbl %dil,%edi
+  8004e4:	4c 89 ee             	mov    %r13,%rsi
+  8004e7:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004ea:	4c 89 e3             	mov    %r12,%rbx
+  8004ed:	eb db                	jmp    8004ca <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8004f4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004f8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004fd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800503:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80050a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80050e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800513:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800518:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80051b:	83 e8 23             	sub    $0x23,%eax
+  80051e:	3c 57                	cmp    $0x57,%al
+  800520:	0f 87 51 06 00 00    	ja     800b77 <vprintfmt+0x6de>
+  800526:	0f b6 c0             	movzbl %al,%eax
+  800529:	48 b9 e0 33 80 00 00 	movabs $0x8033e0,%rcx
+  800530:	00 00 00 
+  800533:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800536:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800539:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80053d:	eb cf                	jmp    80050e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80053f:	49 89 dc             	mov    %rbx,%r12
+  800542:	be 01 00 00 00       	mov    $0x1,%esi
+  800547:	eb c5                	jmp    80050e <vprintfmt+0x75>
+            padc = ch;
+  800549:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80054d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800550:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800553:	eb b9                	jmp    80050e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800555:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800558:	83 f8 2f             	cmp    $0x2f,%eax
+  80055b:	77 24                	ja     800581 <vprintfmt+0xe8>
+  80055d:	89 c1                	mov    %eax,%ecx
+  80055f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800563:	83 c0 08             	add    $0x8,%eax
+  800566:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800569:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80056c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80056f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800573:	79 99                	jns    80050e <vprintfmt+0x75>
+                width = precision;
+  800575:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800579:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80057f:	eb 8d                	jmp    80050e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800581:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800585:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800589:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80058d:	eb da                	jmp    800569 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80058f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800594:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800598:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80059e:	3c 39                	cmp    $0x39,%al
+  8005a0:	77 1c                	ja     8005be <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005a2:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005a6:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005aa:	0f b6 c0             	movzbl %al,%eax
+  8005ad:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005b2:	0f b6 03             	movzbl (%rbx),%eax
+  8005b5:	3c 39                	cmp    $0x39,%al
+  8005b7:	76 e9                	jbe    8005a2 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005b9:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005bc:	eb b1                	jmp    80056f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005be:	49 89 dc             	mov    %rbx,%r12
+  8005c1:	eb ac                	jmp    80056f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005c3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005c6:	85 c9                	test   %ecx,%ecx
+  8005c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005cd:	0f 49 c1             	cmovns %ecx,%eax
+  8005d0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005d3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005d6:	e9 33 ff ff ff       	jmp    80050e <vprintfmt+0x75>
+            lflag++;
+  8005db:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005de:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005e1:	e9 28 ff ff ff       	jmp    80050e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ec:	77 19                	ja     800607 <vprintfmt+0x16e>
+  8005ee:	89 c2                	mov    %eax,%edx
+  8005f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005f4:	83 c0 08             	add    $0x8,%eax
+  8005f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005fa:	8b 3a                	mov    (%rdx),%edi
+  8005fc:	4c 89 ee             	mov    %r13,%rsi
+  8005ff:	41 ff d6             	call   *%r14
+            break;
+  800602:	e9 c3 fe ff ff       	jmp    8004ca <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800607:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80060b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80060f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800613:	eb e5                	jmp    8005fa <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800615:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800618:	83 f8 2f             	cmp    $0x2f,%eax
+  80061b:	77 5a                	ja     800677 <vprintfmt+0x1de>
+  80061d:	89 c2                	mov    %eax,%edx
+  80061f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800623:	83 c0 08             	add    $0x8,%eax
+  800626:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800629:	8b 02                	mov    (%rdx),%eax
+  80062b:	89 c1                	mov    %eax,%ecx
+  80062d:	f7 d9                	neg    %ecx
+  80062f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800632:	83 f9 15             	cmp    $0x15,%ecx
+  800635:	7f 4e                	jg     800685 <vprintfmt+0x1ec>
+  800637:	48 63 c1             	movslq %ecx,%rax
+  80063a:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  800641:	00 00 00 
+  800644:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800648:	48 85 c0             	test   %rax,%rax
+  80064b:	74 38                	je     800685 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80064d:	48 89 c1             	mov    %rax,%rcx
+  800650:	48 ba 89 38 80 00 00 	movabs $0x803889,%rdx
+  800657:	00 00 00 
+  80065a:	4c 89 ee             	mov    %r13,%rsi
+  80065d:	4c 89 f7             	mov    %r14,%rdi
+  800660:	b8 00 00 00 00       	mov    $0x0,%eax
+  800665:	49 b8 5c 04 80 00 00 	movabs $0x80045c,%r8
+  80066c:	00 00 00 
+  80066f:	41 ff d0             	call   *%r8
+  800672:	e9 53 fe ff ff       	jmp    8004ca <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800677:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80067b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80067f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800683:	eb a4                	jmp    800629 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800685:	48 ba 4c 32 80 00 00 	movabs $0x80324c,%rdx
+  80068c:	00 00 00 
+  80068f:	4c 89 ee             	mov    %r13,%rsi
+  800692:	4c 89 f7             	mov    %r14,%rdi
+  800695:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069a:	49 b8 5c 04 80 00 00 	movabs $0x80045c,%r8
+  8006a1:	00 00 00 
+  8006a4:	41 ff d0             	call   *%r8
+  8006a7:	e9 1e fe ff ff       	jmp    8004ca <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006af:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b2:	77 6c                	ja     800720 <vprintfmt+0x287>
+  8006b4:	89 c2                	mov    %eax,%edx
+  8006b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ba:	83 c0 08             	add    $0x8,%eax
+  8006bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c0:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006c3:	48 85 d2             	test   %rdx,%rdx
+  8006c6:	48 b8 45 32 80 00 00 	movabs $0x803245,%rax
+  8006cd:	00 00 00 
+  8006d0:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006d4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006d8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006dc:	7e 06                	jle    8006e4 <vprintfmt+0x24b>
+  8006de:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006e2:	75 4a                	jne    80072e <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006e4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006e8:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006ec:	0f b6 00             	movzbl (%rax),%eax
+  8006ef:	84 c0                	test   %al,%al
+  8006f1:	0f 85 9a 00 00 00    	jne    800791 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8006f7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006fa:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006fe:	85 c0                	test   %eax,%eax
+  800700:	0f 8e c4 fd ff ff    	jle    8004ca <vprintfmt+0x31>
+  800706:	4c 89 ee             	mov    %r13,%rsi
+  800709:	bf 20 00 00 00       	mov    $0x20,%edi
+  80070e:	41 ff d6             	call   *%r14
+  800711:	41 83 ec 01          	sub    $0x1,%r12d
+  800715:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800719:	75 eb                	jne    800706 <vprintfmt+0x26d>
+  80071b:	e9 aa fd ff ff       	jmp    8004ca <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800720:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800724:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800728:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80072c:	eb 92                	jmp    8006c0 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80072e:	49 63 f7             	movslq %r15d,%rsi
+  800731:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800735:	48 b8 4b 0c 80 00 00 	movabs $0x800c4b,%rax
+  80073c:	00 00 00 
+  80073f:	ff d0                	call   *%rax
+  800741:	48 89 c2             	mov    %rax,%rdx
+  800744:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800747:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800749:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80074c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80074f:	85 c0                	test   %eax,%eax
+  800751:	7e 91                	jle    8006e4 <vprintfmt+0x24b>
+  800753:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800758:	4c 89 ee             	mov    %r13,%rsi
+  80075b:	44 89 e7             	mov    %r12d,%edi
+  80075e:	41 ff d6             	call   *%r14
+  800761:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800765:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800768:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80076b:	75 eb                	jne    800758 <vprintfmt+0x2bf>
+  80076d:	e9 72 ff ff ff       	jmp    8006e4 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800772:	0f b6 f8             	movzbl %al,%edi
+  800775:	4c 89 ee             	mov    %r13,%rsi
+  800778:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80077b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80077f:	49 83 c4 01          	add    $0x1,%r12
+  800783:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800789:	84 c0                	test   %al,%al
+  80078b:	0f 84 66 ff ff ff    	je     8006f7 <vprintfmt+0x25e>
+  800791:	45 85 ff             	test   %r15d,%r15d
+  800794:	78 0a                	js     8007a0 <vprintfmt+0x307>
+  800796:	41 83 ef 01          	sub    $0x1,%r15d
+  80079a:	0f 88 57 ff ff ff    	js     8006f7 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007a0:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007a4:	74 cc                	je     800772 <vprintfmt+0x2d9>
+  8007a6:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007a9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007ae:	80 fa 5e             	cmp    $0x5e,%dl
+  8007b1:	77 c2                	ja     800775 <vprintfmt+0x2dc>
+  8007b3:	eb bd                	jmp    800772 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007b5:	40 84 f6             	test   %sil,%sil
+  8007b8:	75 26                	jne    8007e0 <vprintfmt+0x347>
+    switch (lflag) {
+  8007ba:	85 d2                	test   %edx,%edx
+  8007bc:	74 59                	je     800817 <vprintfmt+0x37e>
+  8007be:	83 fa 01             	cmp    $0x1,%edx
+  8007c1:	74 7b                	je     80083e <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c9:	0f 87 96 00 00 00    	ja     800865 <vprintfmt+0x3cc>
+  8007cf:	89 c2                	mov    %eax,%edx
+  8007d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d5:	83 c0 08             	add    $0x8,%eax
+  8007d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007db:	4c 8b 22             	mov    (%rdx),%r12
+  8007de:	eb 17                	jmp    8007f7 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e6:	77 21                	ja     800809 <vprintfmt+0x370>
+  8007e8:	89 c2                	mov    %eax,%edx
+  8007ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ee:	83 c0 08             	add    $0x8,%eax
+  8007f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f4:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007f7:	4d 85 e4             	test   %r12,%r12
+  8007fa:	78 7a                	js     800876 <vprintfmt+0x3dd>
+            num = i;
+  8007fc:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007ff:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800804:	e9 50 02 00 00       	jmp    800a59 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800809:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80080d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800811:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800815:	eb dd                	jmp    8007f4 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800817:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081a:	83 f8 2f             	cmp    $0x2f,%eax
+  80081d:	77 11                	ja     800830 <vprintfmt+0x397>
+  80081f:	89 c2                	mov    %eax,%edx
+  800821:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800825:	83 c0 08             	add    $0x8,%eax
+  800828:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082b:	4c 63 22             	movslq (%rdx),%r12
+  80082e:	eb c7                	jmp    8007f7 <vprintfmt+0x35e>
+  800830:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800834:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800838:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083c:	eb ed                	jmp    80082b <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80083e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800841:	83 f8 2f             	cmp    $0x2f,%eax
+  800844:	77 11                	ja     800857 <vprintfmt+0x3be>
+  800846:	89 c2                	mov    %eax,%edx
+  800848:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084c:	83 c0 08             	add    $0x8,%eax
+  80084f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800852:	4c 8b 22             	mov    (%rdx),%r12
+  800855:	eb a0                	jmp    8007f7 <vprintfmt+0x35e>
+  800857:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800863:	eb ed                	jmp    800852 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800865:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800869:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800871:	e9 65 ff ff ff       	jmp    8007db <vprintfmt+0x342>
+                putch('-', put_arg);
+  800876:	4c 89 ee             	mov    %r13,%rsi
+  800879:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80087e:	41 ff d6             	call   *%r14
+                i = -i;
+  800881:	49 f7 dc             	neg    %r12
+  800884:	e9 73 ff ff ff       	jmp    8007fc <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800889:	40 84 f6             	test   %sil,%sil
+  80088c:	75 32                	jne    8008c0 <vprintfmt+0x427>
+    switch (lflag) {
+  80088e:	85 d2                	test   %edx,%edx
+  800890:	74 5d                	je     8008ef <vprintfmt+0x456>
+  800892:	83 fa 01             	cmp    $0x1,%edx
+  800895:	0f 84 82 00 00 00    	je     80091d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80089b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089e:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a1:	0f 87 a5 00 00 00    	ja     80094c <vprintfmt+0x4b3>
+  8008a7:	89 c2                	mov    %eax,%edx
+  8008a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ad:	83 c0 08             	add    $0x8,%eax
+  8008b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008bb:	e9 99 01 00 00       	jmp    800a59 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c6:	77 19                	ja     8008e1 <vprintfmt+0x448>
+  8008c8:	89 c2                	mov    %eax,%edx
+  8008ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ce:	83 c0 08             	add    $0x8,%eax
+  8008d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008d7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008dc:	e9 78 01 00 00       	jmp    800a59 <vprintfmt+0x5c0>
+  8008e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ed:	eb e5                	jmp    8008d4 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f5:	77 18                	ja     80090f <vprintfmt+0x476>
+  8008f7:	89 c2                	mov    %eax,%edx
+  8008f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008fd:	83 c0 08             	add    $0x8,%eax
+  800900:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800903:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800905:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80090a:	e9 4a 01 00 00       	jmp    800a59 <vprintfmt+0x5c0>
+  80090f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800913:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800917:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091b:	eb e6                	jmp    800903 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80091d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800920:	83 f8 2f             	cmp    $0x2f,%eax
+  800923:	77 19                	ja     80093e <vprintfmt+0x4a5>
+  800925:	89 c2                	mov    %eax,%edx
+  800927:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092b:	83 c0 08             	add    $0x8,%eax
+  80092e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800931:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800934:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800939:	e9 1b 01 00 00       	jmp    800a59 <vprintfmt+0x5c0>
+  80093e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800942:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800946:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094a:	eb e5                	jmp    800931 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80094c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800950:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800954:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800958:	e9 56 ff ff ff       	jmp    8008b3 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80095d:	40 84 f6             	test   %sil,%sil
+  800960:	75 2e                	jne    800990 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800962:	85 d2                	test   %edx,%edx
+  800964:	74 59                	je     8009bf <vprintfmt+0x526>
+  800966:	83 fa 01             	cmp    $0x1,%edx
+  800969:	74 7f                	je     8009ea <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80096b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096e:	83 f8 2f             	cmp    $0x2f,%eax
+  800971:	0f 87 9f 00 00 00    	ja     800a16 <vprintfmt+0x57d>
+  800977:	89 c2                	mov    %eax,%edx
+  800979:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097d:	83 c0 08             	add    $0x8,%eax
+  800980:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800983:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800986:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80098b:	e9 c9 00 00 00       	jmp    800a59 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800990:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800993:	83 f8 2f             	cmp    $0x2f,%eax
+  800996:	77 19                	ja     8009b1 <vprintfmt+0x518>
+  800998:	89 c2                	mov    %eax,%edx
+  80099a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099e:	83 c0 08             	add    $0x8,%eax
+  8009a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009a7:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009ac:	e9 a8 00 00 00       	jmp    800a59 <vprintfmt+0x5c0>
+  8009b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bd:	eb e5                	jmp    8009a4 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c5:	77 15                	ja     8009dc <vprintfmt+0x543>
+  8009c7:	89 c2                	mov    %eax,%edx
+  8009c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cd:	83 c0 08             	add    $0x8,%eax
+  8009d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d3:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8009d5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8009da:	eb 7d                	jmp    800a59 <vprintfmt+0x5c0>
+  8009dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e8:	eb e9                	jmp    8009d3 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f0:	77 16                	ja     800a08 <vprintfmt+0x56f>
+  8009f2:	89 c2                	mov    %eax,%edx
+  8009f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f8:	83 c0 08             	add    $0x8,%eax
+  8009fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a01:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a06:	eb 51                	jmp    800a59 <vprintfmt+0x5c0>
+  800a08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a14:	eb e8                	jmp    8009fe <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a22:	e9 5c ff ff ff       	jmp    800983 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a27:	4c 89 ee             	mov    %r13,%rsi
+  800a2a:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a2f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a32:	4c 89 ee             	mov    %r13,%rsi
+  800a35:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a3a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a3d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a40:	83 f8 2f             	cmp    $0x2f,%eax
+  800a43:	77 47                	ja     800a8c <vprintfmt+0x5f3>
+  800a45:	89 c2                	mov    %eax,%edx
+  800a47:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4b:	83 c0 08             	add    $0x8,%eax
+  800a4e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a51:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a54:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a59:	48 83 ec 08          	sub    $0x8,%rsp
+  800a5d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a61:	0f 94 c0             	sete   %al
+  800a64:	0f b6 c0             	movzbl %al,%eax
+  800a67:	50                   	push   %rax
+  800a68:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a6d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a71:	4c 89 ee             	mov    %r13,%rsi
+  800a74:	4c 89 f7             	mov    %r14,%rdi
+  800a77:	48 b8 8e 03 80 00 00 	movabs $0x80038e,%rax
+  800a7e:	00 00 00 
+  800a81:	ff d0                	call   *%rax
+            break;
+  800a83:	48 83 c4 10          	add    $0x10,%rsp
+  800a87:	e9 3e fa ff ff       	jmp    8004ca <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a8c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a90:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a98:	eb b7                	jmp    800a51 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a9a:	40 84 f6             	test   %sil,%sil
+  800a9d:	75 2b                	jne    800aca <vprintfmt+0x631>
+    switch (lflag) {
+  800a9f:	85 d2                	test   %edx,%edx
+  800aa1:	74 56                	je     800af9 <vprintfmt+0x660>
+  800aa3:	83 fa 01             	cmp    $0x1,%edx
+  800aa6:	74 7f                	je     800b27 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800aa8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aab:	83 f8 2f             	cmp    $0x2f,%eax
+  800aae:	0f 87 a2 00 00 00    	ja     800b56 <vprintfmt+0x6bd>
+  800ab4:	89 c2                	mov    %eax,%edx
+  800ab6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aba:	83 c0 08             	add    $0x8,%eax
+  800abd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ac3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ac8:	eb 8f                	jmp    800a59 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acd:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad0:	77 19                	ja     800aeb <vprintfmt+0x652>
+  800ad2:	89 c2                	mov    %eax,%edx
+  800ad4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad8:	83 c0 08             	add    $0x8,%eax
+  800adb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ade:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ae1:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ae6:	e9 6e ff ff ff       	jmp    800a59 <vprintfmt+0x5c0>
+  800aeb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af7:	eb e5                	jmp    800ade <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800af9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afc:	83 f8 2f             	cmp    $0x2f,%eax
+  800aff:	77 18                	ja     800b19 <vprintfmt+0x680>
+  800b01:	89 c2                	mov    %eax,%edx
+  800b03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b07:	83 c0 08             	add    $0x8,%eax
+  800b0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b0f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b14:	e9 40 ff ff ff       	jmp    800a59 <vprintfmt+0x5c0>
+  800b19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b25:	eb e6                	jmp    800b0d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2d:	77 19                	ja     800b48 <vprintfmt+0x6af>
+  800b2f:	89 c2                	mov    %eax,%edx
+  800b31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b35:	83 c0 08             	add    $0x8,%eax
+  800b38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b3e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b43:	e9 11 ff ff ff       	jmp    800a59 <vprintfmt+0x5c0>
+  800b48:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b50:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b54:	eb e5                	jmp    800b3b <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b56:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b62:	e9 59 ff ff ff       	jmp    800ac0 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b67:	4c 89 ee             	mov    %r13,%rsi
+  800b6a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b6f:	41 ff d6             	call   *%r14
+            break;
+  800b72:	e9 53 f9 ff ff       	jmp    8004ca <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b77:	4c 89 ee             	mov    %r13,%rsi
+  800b7a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b7f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b82:	48 83 eb 01          	sub    $0x1,%rbx
+  800b86:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b8a:	75 f6                	jne    800b82 <vprintfmt+0x6e9>
+  800b8c:	e9 39 f9 ff ff       	jmp    8004ca <vprintfmt+0x31>
+}
+  800b91:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b95:	5b                   	pop    %rbx
+  800b96:	41 5c                	pop    %r12
+  800b98:	41 5d                	pop    %r13
+  800b9a:	41 5e                	pop    %r14
+  800b9c:	41 5f                	pop    %r15
+  800b9e:	5d                   	pop    %rbp
+  800b9f:	c3                   	ret
+
+0000000000800ba0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ba0:	55                   	push   %rbp
+  800ba1:	48 89 e5             	mov    %rsp,%rbp
+  800ba4:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ba8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bac:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800bb1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800bb5:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800bbc:	48 85 ff             	test   %rdi,%rdi
+  800bbf:	74 2b                	je     800bec <vsnprintf+0x4c>
+  800bc1:	48 85 f6             	test   %rsi,%rsi
+  800bc4:	74 26                	je     800bec <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bc6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bca:	48 bf 44 04 80 00 00 	movabs $0x800444,%rdi
+  800bd1:	00 00 00 
+  800bd4:	48 b8 99 04 80 00 00 	movabs $0x800499,%rax
+  800bdb:	00 00 00 
+  800bde:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800be0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800be4:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800be7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bea:	c9                   	leave
+  800beb:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bf1:	eb f7                	jmp    800bea <vsnprintf+0x4a>
+
+0000000000800bf3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bf3:	55                   	push   %rbp
+  800bf4:	48 89 e5             	mov    %rsp,%rbp
+  800bf7:	48 83 ec 50          	sub    $0x50,%rsp
+  800bfb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800bff:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c03:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c07:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c0e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c16:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c1a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c1e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c22:	48 b8 a0 0b 80 00 00 	movabs $0x800ba0,%rax
+  800c29:	00 00 00 
+  800c2c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c2e:	c9                   	leave
+  800c2f:	c3                   	ret
+
+0000000000800c30 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c30:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c33:	74 10                	je     800c45 <strlen+0x15>
+    size_t n = 0;
+  800c35:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c3a:	48 83 c0 01          	add    $0x1,%rax
+  800c3e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c42:	75 f6                	jne    800c3a <strlen+0xa>
+  800c44:	c3                   	ret
+    size_t n = 0;
+  800c45:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c4a:	c3                   	ret
+
+0000000000800c4b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c4b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c4e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c53:	48 85 f6             	test   %rsi,%rsi
+  800c56:	74 11                	je     800c69 <strnlen+0x1e>
+  800c58:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c5c:	74 0c                	je     800c6a <strnlen+0x1f>
+  800c5e:	48 83 c2 01          	add    $0x1,%rdx
+  800c62:	48 39 d0             	cmp    %rdx,%rax
+  800c65:	75 f1                	jne    800c58 <strnlen+0xd>
+  800c67:	eb 04                	jmp    800c6d <strnlen+0x22>
+  800c69:	c3                   	ret
+  800c6a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c6d:	c3                   	ret
+
+0000000000800c6e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c6e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c71:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c76:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c7a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c7d:	48 83 c2 01          	add    $0x1,%rdx
+  800c81:	84 c9                	test   %cl,%cl
+  800c83:	75 f1                	jne    800c76 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c85:	c3                   	ret
+
+0000000000800c86 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c86:	55                   	push   %rbp
+  800c87:	48 89 e5             	mov    %rsp,%rbp
+  800c8a:	41 54                	push   %r12
+  800c8c:	53                   	push   %rbx
+  800c8d:	48 89 fb             	mov    %rdi,%rbx
+  800c90:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c93:	48 b8 30 0c 80 00 00 	movabs $0x800c30,%rax
+  800c9a:	00 00 00 
+  800c9d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c9f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ca3:	4c 89 e6             	mov    %r12,%rsi
+  800ca6:	48 b8 6e 0c 80 00 00 	movabs $0x800c6e,%rax
+  800cad:	00 00 00 
+  800cb0:	ff d0                	call   *%rax
+    return dst;
+}
+  800cb2:	48 89 d8             	mov    %rbx,%rax
+  800cb5:	5b                   	pop    %rbx
+  800cb6:	41 5c                	pop    %r12
+  800cb8:	5d                   	pop    %rbp
+  800cb9:	c3                   	ret
+
+0000000000800cba <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cba:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800cbd:	48 85 d2             	test   %rdx,%rdx
+  800cc0:	74 1f                	je     800ce1 <strncpy+0x27>
+  800cc2:	48 01 fa             	add    %rdi,%rdx
+  800cc5:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cc8:	48 83 c1 01          	add    $0x1,%rcx
+  800ccc:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cd0:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800cd4:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cd8:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800cdc:	48 39 ca             	cmp    %rcx,%rdx
+  800cdf:	75 e7                	jne    800cc8 <strncpy+0xe>
+    }
+    return ret;
+}
+  800ce1:	c3                   	ret
+
+0000000000800ce2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ce2:	48 89 f8             	mov    %rdi,%rax
+  800ce5:	48 85 d2             	test   %rdx,%rdx
+  800ce8:	74 24                	je     800d0e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800cea:	48 83 ea 01          	sub    $0x1,%rdx
+  800cee:	74 1b                	je     800d0b <strlcpy+0x29>
+  800cf0:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cf4:	0f b6 16             	movzbl (%rsi),%edx
+  800cf7:	84 d2                	test   %dl,%dl
+  800cf9:	74 10                	je     800d0b <strlcpy+0x29>
+            *dst++ = *src++;
+  800cfb:	48 83 c6 01          	add    $0x1,%rsi
+  800cff:	48 83 c0 01          	add    $0x1,%rax
+  800d03:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d06:	48 39 c8             	cmp    %rcx,%rax
+  800d09:	75 e9                	jne    800cf4 <strlcpy+0x12>
+        *dst = '\0';
+  800d0b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d0e:	48 29 f8             	sub    %rdi,%rax
+}
+  800d11:	c3                   	ret
+
+0000000000800d12 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d12:	0f b6 07             	movzbl (%rdi),%eax
+  800d15:	84 c0                	test   %al,%al
+  800d17:	74 13                	je     800d2c <strcmp+0x1a>
+  800d19:	38 06                	cmp    %al,(%rsi)
+  800d1b:	75 0f                	jne    800d2c <strcmp+0x1a>
+  800d1d:	48 83 c7 01          	add    $0x1,%rdi
+  800d21:	48 83 c6 01          	add    $0x1,%rsi
+  800d25:	0f b6 07             	movzbl (%rdi),%eax
+  800d28:	84 c0                	test   %al,%al
+  800d2a:	75 ed                	jne    800d19 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d2c:	0f b6 c0             	movzbl %al,%eax
+  800d2f:	0f b6 16             	movzbl (%rsi),%edx
+  800d32:	29 d0                	sub    %edx,%eax
+}
+  800d34:	c3                   	ret
+
+0000000000800d35 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d35:	48 85 d2             	test   %rdx,%rdx
+  800d38:	74 1f                	je     800d59 <strncmp+0x24>
+  800d3a:	0f b6 07             	movzbl (%rdi),%eax
+  800d3d:	84 c0                	test   %al,%al
+  800d3f:	74 1e                	je     800d5f <strncmp+0x2a>
+  800d41:	3a 06                	cmp    (%rsi),%al
+  800d43:	75 1a                	jne    800d5f <strncmp+0x2a>
+  800d45:	48 83 c7 01          	add    $0x1,%rdi
+  800d49:	48 83 c6 01          	add    $0x1,%rsi
+  800d4d:	48 83 ea 01          	sub    $0x1,%rdx
+  800d51:	75 e7                	jne    800d3a <strncmp+0x5>
+
+    if (!n) return 0;
+  800d53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d58:	c3                   	ret
+  800d59:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d5e:	c3                   	ret
+  800d5f:	48 85 d2             	test   %rdx,%rdx
+  800d62:	74 09                	je     800d6d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d64:	0f b6 07             	movzbl (%rdi),%eax
+  800d67:	0f b6 16             	movzbl (%rsi),%edx
+  800d6a:	29 d0                	sub    %edx,%eax
+  800d6c:	c3                   	ret
+    if (!n) return 0;
+  800d6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d72:	c3                   	ret
+
+0000000000800d73 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d73:	0f b6 17             	movzbl (%rdi),%edx
+  800d76:	84 d2                	test   %dl,%dl
+  800d78:	74 18                	je     800d92 <strchr+0x1f>
+        if (*str == c) {
+  800d7a:	0f be d2             	movsbl %dl,%edx
+  800d7d:	39 f2                	cmp    %esi,%edx
+  800d7f:	74 17                	je     800d98 <strchr+0x25>
+    for (; *str; str++) {
+  800d81:	48 83 c7 01          	add    $0x1,%rdi
+  800d85:	0f b6 17             	movzbl (%rdi),%edx
+  800d88:	84 d2                	test   %dl,%dl
+  800d8a:	75 ee                	jne    800d7a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d91:	c3                   	ret
+  800d92:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d97:	c3                   	ret
+  800d98:	48 89 f8             	mov    %rdi,%rax
+}
+  800d9b:	c3                   	ret
+
+0000000000800d9c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d9c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d9f:	0f b6 17             	movzbl (%rdi),%edx
+  800da2:	84 d2                	test   %dl,%dl
+  800da4:	74 13                	je     800db9 <strfind+0x1d>
+  800da6:	0f be d2             	movsbl %dl,%edx
+  800da9:	39 f2                	cmp    %esi,%edx
+  800dab:	74 0b                	je     800db8 <strfind+0x1c>
+  800dad:	48 83 c0 01          	add    $0x1,%rax
+  800db1:	0f b6 10             	movzbl (%rax),%edx
+  800db4:	84 d2                	test   %dl,%dl
+  800db6:	75 ee                	jne    800da6 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800db8:	c3                   	ret
+  800db9:	c3                   	ret
+
+0000000000800dba <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800dba:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800dbd:	48 89 f8             	mov    %rdi,%rax
+  800dc0:	48 f7 d8             	neg    %rax
+  800dc3:	83 e0 07             	and    $0x7,%eax
+  800dc6:	49 89 d1             	mov    %rdx,%r9
+  800dc9:	49 29 c1             	sub    %rax,%r9
+  800dcc:	78 36                	js     800e04 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800dce:	40 0f b6 c6          	movzbl %sil,%eax
+  800dd2:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800dd9:	01 01 01 
+  800ddc:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800de0:	40 f6 c7 07          	test   $0x7,%dil
+  800de4:	75 38                	jne    800e1e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800de6:	4c 89 c9             	mov    %r9,%rcx
+  800de9:	48 c1 f9 03          	sar    $0x3,%rcx
+  800ded:	74 0c                	je     800dfb <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800def:	fc                   	cld
+  800df0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800df3:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800df7:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800dfb:	4d 85 c9             	test   %r9,%r9
+  800dfe:	75 45                	jne    800e45 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e00:	4c 89 c0             	mov    %r8,%rax
+  800e03:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e04:	48 85 d2             	test   %rdx,%rdx
+  800e07:	74 f7                	je     800e00 <memset+0x46>
+  800e09:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e0c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e0f:	48 83 c0 01          	add    $0x1,%rax
+  800e13:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e17:	48 39 c2             	cmp    %rax,%rdx
+  800e1a:	75 f3                	jne    800e0f <memset+0x55>
+  800e1c:	eb e2                	jmp    800e00 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e1e:	40 f6 c7 01          	test   $0x1,%dil
+  800e22:	74 06                	je     800e2a <memset+0x70>
+  800e24:	88 07                	mov    %al,(%rdi)
+  800e26:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e2a:	40 f6 c7 02          	test   $0x2,%dil
+  800e2e:	74 07                	je     800e37 <memset+0x7d>
+  800e30:	66 89 07             	mov    %ax,(%rdi)
+  800e33:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e37:	40 f6 c7 04          	test   $0x4,%dil
+  800e3b:	74 a9                	je     800de6 <memset+0x2c>
+  800e3d:	89 07                	mov    %eax,(%rdi)
+  800e3f:	48 83 c7 04          	add    $0x4,%rdi
+  800e43:	eb a1                	jmp    800de6 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e45:	41 f6 c1 04          	test   $0x4,%r9b
+  800e49:	74 06                	je     800e51 <memset+0x97>
+  800e4b:	89 07                	mov    %eax,(%rdi)
+  800e4d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e51:	41 f6 c1 02          	test   $0x2,%r9b
+  800e55:	74 07                	je     800e5e <memset+0xa4>
+  800e57:	66 89 07             	mov    %ax,(%rdi)
+  800e5a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e5e:	41 f6 c1 01          	test   $0x1,%r9b
+  800e62:	74 9c                	je     800e00 <memset+0x46>
+  800e64:	88 07                	mov    %al,(%rdi)
+  800e66:	eb 98                	jmp    800e00 <memset+0x46>
+
+0000000000800e68 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e68:	48 89 f8             	mov    %rdi,%rax
+  800e6b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e6e:	48 39 fe             	cmp    %rdi,%rsi
+  800e71:	73 3b                	jae    800eae <memmove+0x46>
+  800e73:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e77:	48 39 d7             	cmp    %rdx,%rdi
+  800e7a:	73 32                	jae    800eae <memmove+0x46>
+        s += n;
+        d += n;
+  800e7c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e80:	48 89 d6             	mov    %rdx,%rsi
+  800e83:	48 09 fe             	or     %rdi,%rsi
+  800e86:	48 09 ce             	or     %rcx,%rsi
+  800e89:	40 f6 c6 07          	test   $0x7,%sil
+  800e8d:	75 12                	jne    800ea1 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e8f:	48 83 ef 08          	sub    $0x8,%rdi
+  800e93:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e97:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e9b:	fd                   	std
+  800e9c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e9f:	fc                   	cld
+  800ea0:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ea1:	48 83 ef 01          	sub    $0x1,%rdi
+  800ea5:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ea9:	fd                   	std
+  800eaa:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800eac:	eb f1                	jmp    800e9f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800eae:	48 89 f2             	mov    %rsi,%rdx
+  800eb1:	48 09 c2             	or     %rax,%rdx
+  800eb4:	48 09 ca             	or     %rcx,%rdx
+  800eb7:	f6 c2 07             	test   $0x7,%dl
+  800eba:	75 0c                	jne    800ec8 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ebc:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ec0:	48 89 c7             	mov    %rax,%rdi
+  800ec3:	fc                   	cld
+  800ec4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ec7:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ec8:	48 89 c7             	mov    %rax,%rdi
+  800ecb:	fc                   	cld
+  800ecc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800ece:	c3                   	ret
+
+0000000000800ecf <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800ecf:	55                   	push   %rbp
+  800ed0:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800ed3:	48 b8 68 0e 80 00 00 	movabs $0x800e68,%rax
+  800eda:	00 00 00 
+  800edd:	ff d0                	call   *%rax
+}
+  800edf:	5d                   	pop    %rbp
+  800ee0:	c3                   	ret
+
+0000000000800ee1 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ee1:	55                   	push   %rbp
+  800ee2:	48 89 e5             	mov    %rsp,%rbp
+  800ee5:	41 57                	push   %r15
+  800ee7:	41 56                	push   %r14
+  800ee9:	41 55                	push   %r13
+  800eeb:	41 54                	push   %r12
+  800eed:	53                   	push   %rbx
+  800eee:	48 83 ec 08          	sub    $0x8,%rsp
+  800ef2:	49 89 fe             	mov    %rdi,%r14
+  800ef5:	49 89 f7             	mov    %rsi,%r15
+  800ef8:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800efb:	48 89 f7             	mov    %rsi,%rdi
+  800efe:	48 b8 30 0c 80 00 00 	movabs $0x800c30,%rax
+  800f05:	00 00 00 
+  800f08:	ff d0                	call   *%rax
+  800f0a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f0d:	48 89 de             	mov    %rbx,%rsi
+  800f10:	4c 89 f7             	mov    %r14,%rdi
+  800f13:	48 b8 4b 0c 80 00 00 	movabs $0x800c4b,%rax
+  800f1a:	00 00 00 
+  800f1d:	ff d0                	call   *%rax
+  800f1f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f22:	48 39 c3             	cmp    %rax,%rbx
+  800f25:	74 36                	je     800f5d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f27:	48 89 d8             	mov    %rbx,%rax
+  800f2a:	4c 29 e8             	sub    %r13,%rax
+  800f2d:	49 39 c4             	cmp    %rax,%r12
+  800f30:	73 31                	jae    800f63 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f32:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f37:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f3b:	4c 89 fe             	mov    %r15,%rsi
+  800f3e:	48 b8 cf 0e 80 00 00 	movabs $0x800ecf,%rax
+  800f45:	00 00 00 
+  800f48:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f4a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f4e:	48 83 c4 08          	add    $0x8,%rsp
+  800f52:	5b                   	pop    %rbx
+  800f53:	41 5c                	pop    %r12
+  800f55:	41 5d                	pop    %r13
+  800f57:	41 5e                	pop    %r14
+  800f59:	41 5f                	pop    %r15
+  800f5b:	5d                   	pop    %rbp
+  800f5c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f5d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f61:	eb eb                	jmp    800f4e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f63:	48 83 eb 01          	sub    $0x1,%rbx
+  800f67:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f6b:	48 89 da             	mov    %rbx,%rdx
+  800f6e:	4c 89 fe             	mov    %r15,%rsi
+  800f71:	48 b8 cf 0e 80 00 00 	movabs $0x800ecf,%rax
+  800f78:	00 00 00 
+  800f7b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f7d:	49 01 de             	add    %rbx,%r14
+  800f80:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f85:	eb c3                	jmp    800f4a <strlcat+0x69>
+
+0000000000800f87 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f87:	48 85 d2             	test   %rdx,%rdx
+  800f8a:	74 2d                	je     800fb9 <memcmp+0x32>
+  800f8c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f91:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f95:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f9a:	44 38 c1             	cmp    %r8b,%cl
+  800f9d:	75 0f                	jne    800fae <memcmp+0x27>
+    while (n-- > 0) {
+  800f9f:	48 83 c0 01          	add    $0x1,%rax
+  800fa3:	48 39 c2             	cmp    %rax,%rdx
+  800fa6:	75 e9                	jne    800f91 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800fa8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fad:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800fae:	0f b6 c1             	movzbl %cl,%eax
+  800fb1:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800fb5:	44 29 c0             	sub    %r8d,%eax
+  800fb8:	c3                   	ret
+    return 0;
+  800fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fbe:	c3                   	ret
+
+0000000000800fbf <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fbf:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800fc3:	48 39 c7             	cmp    %rax,%rdi
+  800fc6:	73 0f                	jae    800fd7 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800fc8:	40 38 37             	cmp    %sil,(%rdi)
+  800fcb:	74 0e                	je     800fdb <memfind+0x1c>
+    for (; src < end; src++) {
+  800fcd:	48 83 c7 01          	add    $0x1,%rdi
+  800fd1:	48 39 f8             	cmp    %rdi,%rax
+  800fd4:	75 f2                	jne    800fc8 <memfind+0x9>
+  800fd6:	c3                   	ret
+  800fd7:	48 89 f8             	mov    %rdi,%rax
+  800fda:	c3                   	ret
+  800fdb:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800fde:	c3                   	ret
+
+0000000000800fdf <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800fdf:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fe2:	0f b6 37             	movzbl (%rdi),%esi
+  800fe5:	40 80 fe 20          	cmp    $0x20,%sil
+  800fe9:	74 06                	je     800ff1 <strtol+0x12>
+  800feb:	40 80 fe 09          	cmp    $0x9,%sil
+  800fef:	75 13                	jne    801004 <strtol+0x25>
+  800ff1:	48 83 c7 01          	add    $0x1,%rdi
+  800ff5:	0f b6 37             	movzbl (%rdi),%esi
+  800ff8:	40 80 fe 20          	cmp    $0x20,%sil
+  800ffc:	74 f3                	je     800ff1 <strtol+0x12>
+  800ffe:	40 80 fe 09          	cmp    $0x9,%sil
+  801002:	74 ed                	je     800ff1 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801004:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801007:	83 e0 fd             	and    $0xfffffffd,%eax
+  80100a:	3c 01                	cmp    $0x1,%al
+  80100c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801010:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801016:	75 0f                	jne    801027 <strtol+0x48>
+  801018:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80101b:	74 14                	je     801031 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80101d:	85 d2                	test   %edx,%edx
+  80101f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801024:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801027:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80102c:	4c 63 ca             	movslq %edx,%r9
+  80102f:	eb 36                	jmp    801067 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801031:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801035:	74 0f                	je     801046 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801037:	85 d2                	test   %edx,%edx
+  801039:	75 ec                	jne    801027 <strtol+0x48>
+        s++;
+  80103b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80103f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801044:	eb e1                	jmp    801027 <strtol+0x48>
+        s += 2;
+  801046:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80104a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80104f:	eb d6                	jmp    801027 <strtol+0x48>
+            dig -= '0';
+  801051:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801054:	44 0f b6 c1          	movzbl %cl,%r8d
+  801058:	41 39 d0             	cmp    %edx,%r8d
+  80105b:	7d 21                	jge    80107e <strtol+0x9f>
+        val = val * base + dig;
+  80105d:	49 0f af c1          	imul   %r9,%rax
+  801061:	0f b6 c9             	movzbl %cl,%ecx
+  801064:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801067:	48 83 c7 01          	add    $0x1,%rdi
+  80106b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80106f:	80 f9 39             	cmp    $0x39,%cl
+  801072:	76 dd                	jbe    801051 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801074:	80 f9 7b             	cmp    $0x7b,%cl
+  801077:	77 05                	ja     80107e <strtol+0x9f>
+            dig -= 'a' - 10;
+  801079:	83 e9 57             	sub    $0x57,%ecx
+  80107c:	eb d6                	jmp    801054 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80107e:	4d 85 d2             	test   %r10,%r10
+  801081:	74 03                	je     801086 <strtol+0xa7>
+  801083:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801086:	48 89 c2             	mov    %rax,%rdx
+  801089:	48 f7 da             	neg    %rdx
+  80108c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801090:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801094:	c3                   	ret
+
+0000000000801095 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801095:	55                   	push   %rbp
+  801096:	48 89 e5             	mov    %rsp,%rbp
+  801099:	53                   	push   %rbx
+  80109a:	48 89 fa             	mov    %rdi,%rdx
+  80109d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010a0:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010aa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010af:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010ba:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010c0:	c9                   	leave
+  8010c1:	c3                   	ret
+
+00000000008010c2 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010c2:	55                   	push   %rbp
+  8010c3:	48 89 e5             	mov    %rsp,%rbp
+  8010c6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010c7:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010eb:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010f1:	c9                   	leave
+  8010f2:	c3                   	ret
+
+00000000008010f3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8010f3:	55                   	push   %rbp
+  8010f4:	48 89 e5             	mov    %rsp,%rbp
+  8010f7:	53                   	push   %rbx
+  8010f8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010fc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010ff:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801104:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801109:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801113:	be 00 00 00 00       	mov    $0x0,%esi
+  801118:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80111e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801120:	48 85 c0             	test   %rax,%rax
+  801123:	7f 06                	jg     80112b <sys_env_destroy+0x38>
+}
+  801125:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801129:	c9                   	leave
+  80112a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80112b:	49 89 c0             	mov    %rax,%r8
+  80112e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801133:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  80113a:	00 00 00 
+  80113d:	be 26 00 00 00       	mov    $0x26,%esi
+  801142:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  801149:	00 00 00 
+  80114c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801151:	49 b9 f9 01 80 00 00 	movabs $0x8001f9,%r9
+  801158:	00 00 00 
+  80115b:	41 ff d1             	call   *%r9
+
+000000000080115e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80115e:	55                   	push   %rbp
+  80115f:	48 89 e5             	mov    %rsp,%rbp
+  801162:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801163:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801168:	ba 00 00 00 00       	mov    $0x0,%edx
+  80116d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801172:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801177:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80117c:	be 00 00 00 00       	mov    $0x0,%esi
+  801181:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801187:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801189:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80118d:	c9                   	leave
+  80118e:	c3                   	ret
+
+000000000080118f <sys_yield>:
+
+void
+sys_yield(void) {
+  80118f:	55                   	push   %rbp
+  801190:	48 89 e5             	mov    %rsp,%rbp
+  801193:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801194:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801199:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011b8:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011be:	c9                   	leave
+  8011bf:	c3                   	ret
+
+00000000008011c0 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011c0:	55                   	push   %rbp
+  8011c1:	48 89 e5             	mov    %rsp,%rbp
+  8011c4:	53                   	push   %rbx
+  8011c5:	48 89 fa             	mov    %rdi,%rdx
+  8011c8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011cb:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011d0:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8011d7:	00 00 00 
+  8011da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011df:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ea:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011f0:	c9                   	leave
+  8011f1:	c3                   	ret
+
+00000000008011f2 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011f2:	55                   	push   %rbp
+  8011f3:	48 89 e5             	mov    %rsp,%rbp
+  8011f6:	53                   	push   %rbx
+  8011f7:	49 89 f8             	mov    %rdi,%r8
+  8011fa:	48 89 d3             	mov    %rdx,%rbx
+  8011fd:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801200:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801205:	4c 89 c2             	mov    %r8,%rdx
+  801208:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80120b:	be 00 00 00 00       	mov    $0x0,%esi
+  801210:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801216:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801218:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80121c:	c9                   	leave
+  80121d:	c3                   	ret
+
+000000000080121e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80121e:	55                   	push   %rbp
+  80121f:	48 89 e5             	mov    %rsp,%rbp
+  801222:	53                   	push   %rbx
+  801223:	48 83 ec 08          	sub    $0x8,%rsp
+  801227:	89 f8                	mov    %edi,%eax
+  801229:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80122c:	48 63 f9             	movslq %ecx,%rdi
+  80122f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801232:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801237:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80123a:	be 00 00 00 00       	mov    $0x0,%esi
+  80123f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801245:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801247:	48 85 c0             	test   %rax,%rax
+  80124a:	7f 06                	jg     801252 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80124c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801250:	c9                   	leave
+  801251:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801252:	49 89 c0             	mov    %rax,%r8
+  801255:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80125a:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  801261:	00 00 00 
+  801264:	be 26 00 00 00       	mov    $0x26,%esi
+  801269:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  801270:	00 00 00 
+  801273:	b8 00 00 00 00       	mov    $0x0,%eax
+  801278:	49 b9 f9 01 80 00 00 	movabs $0x8001f9,%r9
+  80127f:	00 00 00 
+  801282:	41 ff d1             	call   *%r9
+
+0000000000801285 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801285:	55                   	push   %rbp
+  801286:	48 89 e5             	mov    %rsp,%rbp
+  801289:	53                   	push   %rbx
+  80128a:	48 83 ec 08          	sub    $0x8,%rsp
+  80128e:	89 f8                	mov    %edi,%eax
+  801290:	49 89 f2             	mov    %rsi,%r10
+  801293:	48 89 cf             	mov    %rcx,%rdi
+  801296:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801299:	48 63 da             	movslq %edx,%rbx
+  80129c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80129f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012a4:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a7:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012aa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012ac:	48 85 c0             	test   %rax,%rax
+  8012af:	7f 06                	jg     8012b7 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b5:	c9                   	leave
+  8012b6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012b7:	49 89 c0             	mov    %rax,%r8
+  8012ba:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012bf:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  8012c6:	00 00 00 
+  8012c9:	be 26 00 00 00       	mov    $0x26,%esi
+  8012ce:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  8012d5:	00 00 00 
+  8012d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012dd:	49 b9 f9 01 80 00 00 	movabs $0x8001f9,%r9
+  8012e4:	00 00 00 
+  8012e7:	41 ff d1             	call   *%r9
+
+00000000008012ea <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012ea:	55                   	push   %rbp
+  8012eb:	48 89 e5             	mov    %rsp,%rbp
+  8012ee:	53                   	push   %rbx
+  8012ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8012f3:	48 89 f1             	mov    %rsi,%rcx
+  8012f6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012f9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012fc:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801301:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801306:	be 00 00 00 00       	mov    $0x0,%esi
+  80130b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801311:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801313:	48 85 c0             	test   %rax,%rax
+  801316:	7f 06                	jg     80131e <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801318:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131c:	c9                   	leave
+  80131d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80131e:	49 89 c0             	mov    %rax,%r8
+  801321:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801326:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  80132d:	00 00 00 
+  801330:	be 26 00 00 00       	mov    $0x26,%esi
+  801335:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  80133c:	00 00 00 
+  80133f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801344:	49 b9 f9 01 80 00 00 	movabs $0x8001f9,%r9
+  80134b:	00 00 00 
+  80134e:	41 ff d1             	call   *%r9
+
+0000000000801351 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801351:	55                   	push   %rbp
+  801352:	48 89 e5             	mov    %rsp,%rbp
+  801355:	53                   	push   %rbx
+  801356:	48 83 ec 08          	sub    $0x8,%rsp
+  80135a:	89 f8                	mov    %edi,%eax
+  80135c:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  80135f:	48 63 f9             	movslq %ecx,%rdi
+  801362:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801365:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80136a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80136d:	be 00 00 00 00       	mov    $0x0,%esi
+  801372:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801378:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80137a:	48 85 c0             	test   %rax,%rax
+  80137d:	7f 06                	jg     801385 <sys_region_advise+0x34>
+}
+  80137f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801383:	c9                   	leave
+  801384:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801385:	49 89 c0             	mov    %rax,%r8
+  801388:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80138d:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  801394:	00 00 00 
+  801397:	be 26 00 00 00       	mov    $0x26,%esi
+  80139c:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  8013a3:	00 00 00 
+  8013a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ab:	49 b9 f9 01 80 00 00 	movabs $0x8001f9,%r9
+  8013b2:	00 00 00 
+  8013b5:	41 ff d1             	call   *%r9
+
+00000000008013b8 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  8013b8:	55                   	push   %rbp
+  8013b9:	48 89 e5             	mov    %rsp,%rbp
+  8013bc:	53                   	push   %rbx
+  8013bd:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  8013c1:	48 63 ce             	movslq %esi,%rcx
+  8013c4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c7:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013e3:	48 85 c0             	test   %rax,%rax
+  8013e6:	7f 06                	jg     8013ee <sys_env_set_nice+0x36>
+}
+  8013e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ec:	c9                   	leave
+  8013ed:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ee:	49 89 c0             	mov    %rax,%r8
+  8013f1:	b9 15 00 00 00       	mov    $0x15,%ecx
+  8013f6:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  8013fd:	00 00 00 
+  801400:	be 26 00 00 00       	mov    $0x26,%esi
+  801405:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  80140c:	00 00 00 
+  80140f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801414:	49 b9 f9 01 80 00 00 	movabs $0x8001f9,%r9
+  80141b:	00 00 00 
+  80141e:	41 ff d1             	call   *%r9
+
+0000000000801421 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801421:	55                   	push   %rbp
+  801422:	48 89 e5             	mov    %rsp,%rbp
+  801425:	53                   	push   %rbx
+  801426:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80142a:	48 63 ce             	movslq %esi,%rcx
+  80142d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801430:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801435:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143f:	be 00 00 00 00       	mov    $0x0,%esi
+  801444:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80144a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80144c:	48 85 c0             	test   %rax,%rax
+  80144f:	7f 06                	jg     801457 <sys_env_set_status+0x36>
+}
+  801451:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801455:	c9                   	leave
+  801456:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801457:	49 89 c0             	mov    %rax,%r8
+  80145a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80145f:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  801466:	00 00 00 
+  801469:	be 26 00 00 00       	mov    $0x26,%esi
+  80146e:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  801475:	00 00 00 
+  801478:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147d:	49 b9 f9 01 80 00 00 	movabs $0x8001f9,%r9
+  801484:	00 00 00 
+  801487:	41 ff d1             	call   *%r9
+
+000000000080148a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80148a:	55                   	push   %rbp
+  80148b:	48 89 e5             	mov    %rsp,%rbp
+  80148e:	53                   	push   %rbx
+  80148f:	48 83 ec 08          	sub    $0x8,%rsp
+  801493:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801496:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801499:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80149e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014b5:	48 85 c0             	test   %rax,%rax
+  8014b8:	7f 06                	jg     8014c0 <sys_env_set_trapframe+0x36>
+}
+  8014ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014be:	c9                   	leave
+  8014bf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c0:	49 89 c0             	mov    %rax,%r8
+  8014c3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8014c8:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  8014cf:	00 00 00 
+  8014d2:	be 26 00 00 00       	mov    $0x26,%esi
+  8014d7:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  8014de:	00 00 00 
+  8014e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e6:	49 b9 f9 01 80 00 00 	movabs $0x8001f9,%r9
+  8014ed:	00 00 00 
+  8014f0:	41 ff d1             	call   *%r9
+
+00000000008014f3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8014f3:	55                   	push   %rbp
+  8014f4:	48 89 e5             	mov    %rsp,%rbp
+  8014f7:	53                   	push   %rbx
+  8014f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8014fc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8014ff:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801502:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801507:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801511:	be 00 00 00 00       	mov    $0x0,%esi
+  801516:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80151c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80151e:	48 85 c0             	test   %rax,%rax
+  801521:	7f 06                	jg     801529 <sys_env_set_pgfault_upcall+0x36>
+}
+  801523:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801527:	c9                   	leave
+  801528:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801529:	49 89 c0             	mov    %rax,%r8
+  80152c:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801531:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  801538:	00 00 00 
+  80153b:	be 26 00 00 00       	mov    $0x26,%esi
+  801540:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  801547:	00 00 00 
+  80154a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154f:	49 b9 f9 01 80 00 00 	movabs $0x8001f9,%r9
+  801556:	00 00 00 
+  801559:	41 ff d1             	call   *%r9
+
+000000000080155c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80155c:	55                   	push   %rbp
+  80155d:	48 89 e5             	mov    %rsp,%rbp
+  801560:	53                   	push   %rbx
+  801561:	89 f8                	mov    %edi,%eax
+  801563:	49 89 f1             	mov    %rsi,%r9
+  801566:	48 89 d3             	mov    %rdx,%rbx
+  801569:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80156c:	49 63 f0             	movslq %r8d,%rsi
+  80156f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801572:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801577:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80157a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801580:	cd 30                	int    $0x30
+}
+  801582:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801586:	c9                   	leave
+  801587:	c3                   	ret
+
+0000000000801588 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801588:	55                   	push   %rbp
+  801589:	48 89 e5             	mov    %rsp,%rbp
+  80158c:	53                   	push   %rbx
+  80158d:	48 83 ec 08          	sub    $0x8,%rsp
+  801591:	48 89 fa             	mov    %rdi,%rdx
+  801594:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801597:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80159c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015b3:	48 85 c0             	test   %rax,%rax
+  8015b6:	7f 06                	jg     8015be <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015bc:	c9                   	leave
+  8015bd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015be:	49 89 c0             	mov    %rax,%r8
+  8015c1:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015c6:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  8015cd:	00 00 00 
+  8015d0:	be 26 00 00 00       	mov    $0x26,%esi
+  8015d5:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  8015dc:	00 00 00 
+  8015df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e4:	49 b9 f9 01 80 00 00 	movabs $0x8001f9,%r9
+  8015eb:	00 00 00 
+  8015ee:	41 ff d1             	call   *%r9
+
+00000000008015f1 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8015f1:	55                   	push   %rbp
+  8015f2:	48 89 e5             	mov    %rsp,%rbp
+  8015f5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f6:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801600:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801605:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80160a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80160f:	be 00 00 00 00       	mov    $0x0,%esi
+  801614:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80161a:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80161c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801620:	c9                   	leave
+  801621:	c3                   	ret
+
+0000000000801622 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  801622:	55                   	push   %rbp
+  801623:	48 89 e5             	mov    %rsp,%rbp
+  801626:	53                   	push   %rbx
+  801627:	48 83 ec 08          	sub    $0x8,%rsp
+  80162b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  80162e:	48 63 ce             	movslq %esi,%rcx
+  801631:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801634:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801639:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80163e:	be 00 00 00 00       	mov    $0x0,%esi
+  801643:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801649:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80164b:	48 85 c0             	test   %rax,%rax
+  80164e:	7f 06                	jg     801656 <sys_sigqueue+0x34>
+}
+  801650:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801654:	c9                   	leave
+  801655:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801656:	49 89 c0             	mov    %rax,%r8
+  801659:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80165e:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  801665:	00 00 00 
+  801668:	be 26 00 00 00       	mov    $0x26,%esi
+  80166d:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  801674:	00 00 00 
+  801677:	b8 00 00 00 00       	mov    $0x0,%eax
+  80167c:	49 b9 f9 01 80 00 00 	movabs $0x8001f9,%r9
+  801683:	00 00 00 
+  801686:	41 ff d1             	call   *%r9
+
+0000000000801689 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801689:	55                   	push   %rbp
+  80168a:	48 89 e5             	mov    %rsp,%rbp
+  80168d:	53                   	push   %rbx
+  80168e:	48 83 ec 08          	sub    $0x8,%rsp
+  801692:	48 89 fa             	mov    %rdi,%rdx
+  801695:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801698:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80169d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016b2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016b4:	48 85 c0             	test   %rax,%rax
+  8016b7:	7f 06                	jg     8016bf <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  8016b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016bd:	c9                   	leave
+  8016be:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016bf:	49 89 c0             	mov    %rax,%r8
+  8016c2:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8016c7:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  8016ce:	00 00 00 
+  8016d1:	be 26 00 00 00       	mov    $0x26,%esi
+  8016d6:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  8016dd:	00 00 00 
+  8016e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e5:	49 b9 f9 01 80 00 00 	movabs $0x8001f9,%r9
+  8016ec:	00 00 00 
+  8016ef:	41 ff d1             	call   *%r9
+
+00000000008016f2 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  8016f2:	55                   	push   %rbp
+  8016f3:	48 89 e5             	mov    %rsp,%rbp
+  8016f6:	53                   	push   %rbx
+  8016f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8016fb:	48 89 f1             	mov    %rsi,%rcx
+  8016fe:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801701:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801704:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801709:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80170e:	be 00 00 00 00       	mov    $0x0,%esi
+  801713:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801719:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80171b:	48 85 c0             	test   %rax,%rax
+  80171e:	7f 06                	jg     801726 <sys_sigaction+0x34>
+}
+  801720:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801724:	c9                   	leave
+  801725:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801726:	49 89 c0             	mov    %rax,%r8
+  801729:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80172e:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  801735:	00 00 00 
+  801738:	be 26 00 00 00       	mov    $0x26,%esi
+  80173d:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  801744:	00 00 00 
+  801747:	b8 00 00 00 00       	mov    $0x0,%eax
+  80174c:	49 b9 f9 01 80 00 00 	movabs $0x8001f9,%r9
+  801753:	00 00 00 
+  801756:	41 ff d1             	call   *%r9
+
+0000000000801759 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801759:	55                   	push   %rbp
+  80175a:	48 89 e5             	mov    %rsp,%rbp
+  80175d:	53                   	push   %rbx
+  80175e:	48 83 ec 08          	sub    $0x8,%rsp
+  801762:	48 89 f1             	mov    %rsi,%rcx
+  801765:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801768:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80176b:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801770:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801775:	be 00 00 00 00       	mov    $0x0,%esi
+  80177a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801780:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801782:	48 85 c0             	test   %rax,%rax
+  801785:	7f 06                	jg     80178d <sys_sigprocmask+0x34>
+}
+  801787:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80178b:	c9                   	leave
+  80178c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80178d:	49 89 c0             	mov    %rax,%r8
+  801790:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801795:	48 ba 70 37 80 00 00 	movabs $0x803770,%rdx
+  80179c:	00 00 00 
+  80179f:	be 26 00 00 00       	mov    $0x26,%esi
+  8017a4:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  8017ab:	00 00 00 
+  8017ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b3:	49 b9 f9 01 80 00 00 	movabs $0x8001f9,%r9
+  8017ba:	00 00 00 
+  8017bd:	41 ff d1             	call   *%r9
+
+00000000008017c0 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8017c0:	55                   	push   %rbp
+  8017c1:	48 89 e5             	mov    %rsp,%rbp
+  8017c4:	41 56                	push   %r14
+  8017c6:	41 55                	push   %r13
+  8017c8:	41 54                	push   %r12
+  8017ca:	53                   	push   %rbx
+  8017cb:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8017ce:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  8017d5:	00 00 00 
+  8017d8:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8017dc:	74 27                	je     801805 <_handle_vectored_pagefault+0x45>
+  8017de:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8017e3:	49 bd 20 50 80 00 00 	movabs $0x805020,%r13
+  8017ea:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8017ed:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8017f0:	4c 89 e7             	mov    %r12,%rdi
+  8017f3:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8017f8:	84 c0                	test   %al,%al
+  8017fa:	75 45                	jne    801841 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8017fc:	48 83 c3 01          	add    $0x1,%rbx
+  801800:	49 3b 1e             	cmp    (%r14),%rbx
+  801803:	72 eb                	jb     8017f0 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  801805:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80180c:	00 
+  80180d:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  801812:	4d 8b 04 24          	mov    (%r12),%r8
+  801816:	48 ba a0 37 80 00 00 	movabs $0x8037a0,%rdx
+  80181d:	00 00 00 
+  801820:	be 1d 00 00 00       	mov    $0x1d,%esi
+  801825:	48 bf 37 38 80 00 00 	movabs $0x803837,%rdi
+  80182c:	00 00 00 
+  80182f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801834:	49 ba f9 01 80 00 00 	movabs $0x8001f9,%r10
+  80183b:	00 00 00 
+  80183e:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  801841:	5b                   	pop    %rbx
+  801842:	41 5c                	pop    %r12
+  801844:	41 5d                	pop    %r13
+  801846:	41 5e                	pop    %r14
+  801848:	5d                   	pop    %rbp
+  801849:	c3                   	ret
+
+000000000080184a <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80184a:	55                   	push   %rbp
+  80184b:	48 89 e5             	mov    %rsp,%rbp
+  80184e:	53                   	push   %rbx
+  80184f:	48 83 ec 08          	sub    $0x8,%rsp
+  801853:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  801856:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  80185d:	00 00 00 
+  801860:	80 38 00             	cmpb   $0x0,(%rax)
+  801863:	74 61                	je     8018c6 <add_pgfault_handler+0x7c>
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801865:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  80186c:	00 00 00 
+  80186f:	48 8b 10             	mov    (%rax),%rdx
+  801872:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  801877:	48 b9 20 50 80 00 00 	movabs $0x805020,%rcx
+  80187e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801881:	48 85 d2             	test   %rdx,%rdx
+  801884:	74 19                	je     80189f <add_pgfault_handler+0x55>
+        if (handler == _pfhandler_vec[i]) return 0;
+  801886:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80188a:	74 2f                	je     8018bb <add_pgfault_handler+0x71>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80188c:	48 83 c0 01          	add    $0x1,%rax
+  801890:	48 39 d0             	cmp    %rdx,%rax
+  801893:	75 f1                	jne    801886 <add_pgfault_handler+0x3c>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  801895:	48 83 fa 08          	cmp    $0x8,%rdx
+  801899:	0f 84 f7 00 00 00    	je     801996 <add_pgfault_handler+0x14c>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80189f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8018a3:	48 a3 68 50 80 00 00 	movabs %rax,0x805068
+  8018aa:	00 00 00 
+  8018ad:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  8018b4:	00 00 00 
+  8018b7:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  8018bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018c4:	c9                   	leave
+  8018c5:	c3                   	ret
+        if (sys_alloc_region(CURENVID, ues_beg, PAGE_SIZE, PROT_RW))
+  8018c6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8018cb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018d0:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8018d7:	00 00 00 
+  8018da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018df:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  8018e6:	00 00 00 
+  8018e9:	ff d0                	call   *%rax
+  8018eb:	85 c0                	test   %eax,%eax
+  8018ed:	75 53                	jne    801942 <add_pgfault_handler+0xf8>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8018ef:	48 ba 68 50 80 00 00 	movabs $0x805068,%rdx
+  8018f6:	00 00 00 
+  8018f9:	48 8b 02             	mov    (%rdx),%rax
+  8018fc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801900:	48 89 0a             	mov    %rcx,(%rdx)
+  801903:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  80190a:	00 00 00 
+  80190d:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        if (sys_env_set_pgfault_upcall(CURENVID, _pgfault_upcall))
+  801911:	48 be 82 1a 80 00 00 	movabs $0x801a82,%rsi
+  801918:	00 00 00 
+  80191b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801920:	48 b8 f3 14 80 00 00 	movabs $0x8014f3,%rax
+  801927:	00 00 00 
+  80192a:	ff d0                	call   *%rax
+  80192c:	85 c0                	test   %eax,%eax
+  80192e:	75 3c                	jne    80196c <add_pgfault_handler+0x122>
+        _pfhandler_inititiallized = 1;
+  801930:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801937:	00 00 00 
+  80193a:	c6 00 01             	movb   $0x1,(%rax)
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80193d:	e9 79 ff ff ff       	jmp    8018bb <add_pgfault_handler+0x71>
+            panic("add_pgfault_handler: sys_alloc_region failed");
+  801942:	48 ba d0 37 80 00 00 	movabs $0x8037d0,%rdx
+  801949:	00 00 00 
+  80194c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801951:	48 bf 37 38 80 00 00 	movabs $0x803837,%rdi
+  801958:	00 00 00 
+  80195b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801960:	48 b9 f9 01 80 00 00 	movabs $0x8001f9,%rcx
+  801967:	00 00 00 
+  80196a:	ff d1                	call   *%rcx
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+  80196c:	48 ba 00 38 80 00 00 	movabs $0x803800,%rdx
+  801973:	00 00 00 
+  801976:	be 32 00 00 00       	mov    $0x32,%esi
+  80197b:	48 bf 37 38 80 00 00 	movabs $0x803837,%rdi
+  801982:	00 00 00 
+  801985:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198a:	48 b9 f9 01 80 00 00 	movabs $0x8001f9,%rcx
+  801991:	00 00 00 
+  801994:	ff d1                	call   *%rcx
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801996:	b9 fd ff ff ff       	mov    $0xfffffffd,%ecx
+  80199b:	48 ba 45 38 80 00 00 	movabs $0x803845,%rdx
+  8019a2:	00 00 00 
+  8019a5:	be 40 00 00 00       	mov    $0x40,%esi
+  8019aa:	48 bf 37 38 80 00 00 	movabs $0x803837,%rdi
+  8019b1:	00 00 00 
+  8019b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b9:	49 b8 f9 01 80 00 00 	movabs $0x8001f9,%r8
+  8019c0:	00 00 00 
+  8019c3:	41 ff d0             	call   *%r8
+
+00000000008019c6 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8019c6:	55                   	push   %rbp
+  8019c7:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8019ca:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8019d1:	00 00 00 
+  8019d4:	80 38 00             	cmpb   $0x0,(%rax)
+  8019d7:	74 33                	je     801a0c <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8019d9:	48 a1 68 50 80 00 00 	movabs 0x805068,%rax
+  8019e0:	00 00 00 
+  8019e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8019e8:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8019ef:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8019f2:	48 85 c0             	test   %rax,%rax
+  8019f5:	0f 84 85 00 00 00    	je     801a80 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8019fb:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8019ff:	74 40                	je     801a41 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801a01:	48 83 c1 01          	add    $0x1,%rcx
+  801a05:	48 39 c1             	cmp    %rax,%rcx
+  801a08:	75 f1                	jne    8019fb <remove_pgfault_handler+0x35>
+  801a0a:	eb 74                	jmp    801a80 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  801a0c:	48 b9 5d 38 80 00 00 	movabs $0x80385d,%rcx
+  801a13:	00 00 00 
+  801a16:	48 ba 77 38 80 00 00 	movabs $0x803877,%rdx
+  801a1d:	00 00 00 
+  801a20:	be 46 00 00 00       	mov    $0x46,%esi
+  801a25:	48 bf 37 38 80 00 00 	movabs $0x803837,%rdi
+  801a2c:	00 00 00 
+  801a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a34:	49 b8 f9 01 80 00 00 	movabs $0x8001f9,%r8
+  801a3b:	00 00 00 
+  801a3e:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  801a41:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  801a48:	00 
+  801a49:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a4d:	48 29 ca             	sub    %rcx,%rdx
+  801a50:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  801a57:	00 00 00 
+  801a5a:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  801a5e:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  801a63:	48 89 ce             	mov    %rcx,%rsi
+  801a66:	48 b8 68 0e 80 00 00 	movabs $0x800e68,%rax
+  801a6d:	00 00 00 
+  801a70:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  801a72:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  801a79:	00 00 00 
+  801a7c:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  801a80:	5d                   	pop    %rbp
+  801a81:	c3                   	ret
+
+0000000000801a82 <_pgfault_upcall>:
+.text
+.globl _pgfault_upcall
+.globl _signal_handler_trampoline
+_pgfault_upcall:
+_signal_handler_trampoline:
+    movq  %rsp,%rdi # passing the function argument (UTrapframe *) in rdi
+  801a82:	48 89 e7             	mov    %rsp,%rdi
+    # sizeof(struct EnqueuedSignal) == 56
+    # sizeof(curenv->env_sig_mask) == 4
+    # + 4 bytes of alignment
+    add $64, %rdi
+  801a85:	48 83 c7 40          	add    $0x40,%rdi
+
+    # load signo
+    mov (%rsp), %eax
+  801a89:	8b 04 24             	mov    (%rsp),%eax
+    test %eax, %eax
+  801a8c:	85 c0                	test   %eax,%eax
+    jnz _call_generic_signal_handler
+  801a8e:	75 0e                	jne    801a9e <_call_generic_signal_handler>
+
+    # Call the C page fault handler.
+    movabs $_handle_vectored_pagefault, %rax
+  801a90:	48 b8 c0 17 80 00 00 	movabs $0x8017c0,%rax
+  801a97:	00 00 00 
+    call *%rax
+  801a9a:	ff d0                	call   *%rax
+    jmp _return_from_handler
+  801a9c:	eb 0f                	jmp    801aad <_return_from_handler>
+
+0000000000801a9e <_call_generic_signal_handler>:
+
+_call_generic_signal_handler:
+    movq %rsp, %rsi # passing the function argument (EnqueuedSignal *) in rsi
+  801a9e:	48 89 e6             	mov    %rsp,%rsi
+    movabs $_generic_signal_handler, %rax
+  801aa1:	48 b8 e5 2b 80 00 00 	movabs $0x802be5,%rax
+  801aa8:	00 00 00 
+    call *%rax
+  801aab:	ff d0                	call   *%rax
+
+0000000000801aad <_return_from_handler>:
+
+_return_from_handler:
+    # ignore EnqueuedSignal and env_sig_mask
+    add $64, %rsp
+  801aad:	48 83 c4 40          	add    $0x40,%rsp
+    # put SIG_SETMASK as the first func arg
+    movq $3, %rdi
+  801ab1:	48 c7 c7 03 00 00 00 	mov    $0x3,%rdi
+    # load &env_sig_mask (as the second func arg)
+    lea -4(%rsp), %rsi
+  801ab8:	48 8d 74 24 fc       	lea    -0x4(%rsp),%rsi
+    # NULL as the third arg
+    xor %rdx, %rdx
+  801abd:	48 31 d2             	xor    %rdx,%rdx
+    # restore blocked signals mask
+    movabs $sys_sigprocmask, %rax
+  801ac0:	48 b8 59 17 80 00 00 	movabs $0x801759,%rax
+  801ac7:	00 00 00 
+    call *%rax
+  801aca:	ff d0                	call   *%rax
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    # ignore utf_fault_va, utf_err
+    addq $16, %rsp
+  801acc:	48 83 c4 10          	add    $0x10,%rsp
+    # restore utf_regs, save rax again
+    POPA
+  801ad0:	4c 8b 3c 24          	mov    (%rsp),%r15
+  801ad4:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  801ad9:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  801ade:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  801ae3:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  801ae8:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  801aed:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  801af2:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  801af7:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  801afc:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  801b01:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  801b06:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  801b0b:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  801b10:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  801b15:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  801b1a:	48 83 c4 78          	add    $0x78,%rsp
+    pushq %rax
+  801b1e:	50                   	push   %rax
+    # 16 utf_rflags
+    #  8 utf_rip
+    #  0 rax
+
+    # load utf_rip
+    movq 8(%rsp), %rax
+  801b1f:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    # save rbx to utf_rip
+    movq %rbx, 8(%rsp)
+  801b24:	48 89 5c 24 08       	mov    %rbx,0x8(%rsp)
+    # load utf_rsp
+    movq 24(%rsp), %rbx
+  801b29:	48 8b 5c 24 18       	mov    0x18(%rsp),%rbx
+    # store return address to *utf_stack
+    subq $8, 24(%rsp)
+  801b2e:	48 83 6c 24 18 08    	subq   $0x8,0x18(%rsp)
+    movq %rax, -8(%rbx)
+  801b34:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    # restore rax and rbx
+    popq %rax
+  801b38:	58                   	pop    %rax
+    popq %rbx
+  801b39:	5b                   	pop    %rbx
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+    popfq
+  801b3a:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    popq %rsp
+  801b3b:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  801b3c:	c3                   	ret
+
+0000000000801b3d <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b3d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b44:	ff ff ff 
+  801b47:	48 01 f8             	add    %rdi,%rax
+  801b4a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801b4e:	c3                   	ret
+
+0000000000801b4f <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b4f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b56:	ff ff ff 
+  801b59:	48 01 f8             	add    %rdi,%rax
+  801b5c:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801b60:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801b66:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801b6a:	c3                   	ret
+
+0000000000801b6b <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801b6b:	55                   	push   %rbp
+  801b6c:	48 89 e5             	mov    %rsp,%rbp
+  801b6f:	41 57                	push   %r15
+  801b71:	41 56                	push   %r14
+  801b73:	41 55                	push   %r13
+  801b75:	41 54                	push   %r12
+  801b77:	53                   	push   %rbx
+  801b78:	48 83 ec 08          	sub    $0x8,%rsp
+  801b7c:	49 89 ff             	mov    %rdi,%r15
+  801b7f:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801b84:	49 bd e9 2a 80 00 00 	movabs $0x802ae9,%r13
+  801b8b:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801b8e:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801b94:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801b97:	48 89 df             	mov    %rbx,%rdi
+  801b9a:	41 ff d5             	call   *%r13
+  801b9d:	83 e0 04             	and    $0x4,%eax
+  801ba0:	74 17                	je     801bb9 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801ba2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801ba9:	4c 39 f3             	cmp    %r14,%rbx
+  801bac:	75 e6                	jne    801b94 <fd_alloc+0x29>
+  801bae:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801bb4:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801bb9:	4d 89 27             	mov    %r12,(%r15)
+}
+  801bbc:	48 83 c4 08          	add    $0x8,%rsp
+  801bc0:	5b                   	pop    %rbx
+  801bc1:	41 5c                	pop    %r12
+  801bc3:	41 5d                	pop    %r13
+  801bc5:	41 5e                	pop    %r14
+  801bc7:	41 5f                	pop    %r15
+  801bc9:	5d                   	pop    %rbp
+  801bca:	c3                   	ret
+
+0000000000801bcb <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801bcb:	83 ff 1f             	cmp    $0x1f,%edi
+  801bce:	77 39                	ja     801c09 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801bd0:	55                   	push   %rbp
+  801bd1:	48 89 e5             	mov    %rsp,%rbp
+  801bd4:	41 54                	push   %r12
+  801bd6:	53                   	push   %rbx
+  801bd7:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801bda:	48 63 df             	movslq %edi,%rbx
+  801bdd:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801be4:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801be8:	48 89 df             	mov    %rbx,%rdi
+  801beb:	48 b8 e9 2a 80 00 00 	movabs $0x802ae9,%rax
+  801bf2:	00 00 00 
+  801bf5:	ff d0                	call   *%rax
+  801bf7:	a8 04                	test   $0x4,%al
+  801bf9:	74 14                	je     801c0f <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801bfb:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801bff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c04:	5b                   	pop    %rbx
+  801c05:	41 5c                	pop    %r12
+  801c07:	5d                   	pop    %rbp
+  801c08:	c3                   	ret
+        return -E_INVAL;
+  801c09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801c0e:	c3                   	ret
+        return -E_INVAL;
+  801c0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c14:	eb ee                	jmp    801c04 <fd_lookup+0x39>
+
+0000000000801c16 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801c16:	55                   	push   %rbp
+  801c17:	48 89 e5             	mov    %rsp,%rbp
+  801c1a:	41 54                	push   %r12
+  801c1c:	53                   	push   %rbx
+  801c1d:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801c20:	48 b8 20 39 80 00 00 	movabs $0x803920,%rax
+  801c27:	00 00 00 
+  801c2a:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801c31:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801c34:	39 3b                	cmp    %edi,(%rbx)
+  801c36:	74 47                	je     801c7f <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c38:	48 83 c0 08          	add    $0x8,%rax
+  801c3c:	48 8b 18             	mov    (%rax),%rbx
+  801c3f:	48 85 db             	test   %rbx,%rbx
+  801c42:	75 f0                	jne    801c34 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c44:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c4b:	00 00 00 
+  801c4e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c54:	89 fa                	mov    %edi,%edx
+  801c56:	48 bf 90 38 80 00 00 	movabs $0x803890,%rdi
+  801c5d:	00 00 00 
+  801c60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c65:	48 b9 49 03 80 00 00 	movabs $0x800349,%rcx
+  801c6c:	00 00 00 
+  801c6f:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801c71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801c76:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801c7a:	5b                   	pop    %rbx
+  801c7b:	41 5c                	pop    %r12
+  801c7d:	5d                   	pop    %rbp
+  801c7e:	c3                   	ret
+            return 0;
+  801c7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c84:	eb f0                	jmp    801c76 <dev_lookup+0x60>
+
+0000000000801c86 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801c86:	55                   	push   %rbp
+  801c87:	48 89 e5             	mov    %rsp,%rbp
+  801c8a:	41 55                	push   %r13
+  801c8c:	41 54                	push   %r12
+  801c8e:	53                   	push   %rbx
+  801c8f:	48 83 ec 18          	sub    $0x18,%rsp
+  801c93:	48 89 fb             	mov    %rdi,%rbx
+  801c96:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c99:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801ca0:	ff ff ff 
+  801ca3:	48 01 df             	add    %rbx,%rdi
+  801ca6:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801caa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cae:	48 b8 cb 1b 80 00 00 	movabs $0x801bcb,%rax
+  801cb5:	00 00 00 
+  801cb8:	ff d0                	call   *%rax
+  801cba:	41 89 c5             	mov    %eax,%r13d
+  801cbd:	85 c0                	test   %eax,%eax
+  801cbf:	78 06                	js     801cc7 <fd_close+0x41>
+  801cc1:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801cc5:	74 1a                	je     801ce1 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801cc7:	45 84 e4             	test   %r12b,%r12b
+  801cca:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ccf:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801cd3:	44 89 e8             	mov    %r13d,%eax
+  801cd6:	48 83 c4 18          	add    $0x18,%rsp
+  801cda:	5b                   	pop    %rbx
+  801cdb:	41 5c                	pop    %r12
+  801cdd:	41 5d                	pop    %r13
+  801cdf:	5d                   	pop    %rbp
+  801ce0:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ce1:	8b 3b                	mov    (%rbx),%edi
+  801ce3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ce7:	48 b8 16 1c 80 00 00 	movabs $0x801c16,%rax
+  801cee:	00 00 00 
+  801cf1:	ff d0                	call   *%rax
+  801cf3:	41 89 c5             	mov    %eax,%r13d
+  801cf6:	85 c0                	test   %eax,%eax
+  801cf8:	78 1b                	js     801d15 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801cfa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cfe:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d02:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801d08:	48 85 c0             	test   %rax,%rax
+  801d0b:	74 08                	je     801d15 <fd_close+0x8f>
+  801d0d:	48 89 df             	mov    %rbx,%rdi
+  801d10:	ff d0                	call   *%rax
+  801d12:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801d15:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d1a:	48 89 de             	mov    %rbx,%rsi
+  801d1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d22:	48 b8 ea 12 80 00 00 	movabs $0x8012ea,%rax
+  801d29:	00 00 00 
+  801d2c:	ff d0                	call   *%rax
+    return res;
+  801d2e:	eb a3                	jmp    801cd3 <fd_close+0x4d>
+
+0000000000801d30 <close>:
+
+int
+close(int fdnum) {
+  801d30:	55                   	push   %rbp
+  801d31:	48 89 e5             	mov    %rsp,%rbp
+  801d34:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d38:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d3c:	48 b8 cb 1b 80 00 00 	movabs $0x801bcb,%rax
+  801d43:	00 00 00 
+  801d46:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d48:	85 c0                	test   %eax,%eax
+  801d4a:	78 15                	js     801d61 <close+0x31>
+
+    return fd_close(fd, 1);
+  801d4c:	be 01 00 00 00       	mov    $0x1,%esi
+  801d51:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801d55:	48 b8 86 1c 80 00 00 	movabs $0x801c86,%rax
+  801d5c:	00 00 00 
+  801d5f:	ff d0                	call   *%rax
+}
+  801d61:	c9                   	leave
+  801d62:	c3                   	ret
+
+0000000000801d63 <close_all>:
+
+void
+close_all(void) {
+  801d63:	55                   	push   %rbp
+  801d64:	48 89 e5             	mov    %rsp,%rbp
+  801d67:	41 54                	push   %r12
+  801d69:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801d6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d6f:	49 bc 30 1d 80 00 00 	movabs $0x801d30,%r12
+  801d76:	00 00 00 
+  801d79:	89 df                	mov    %ebx,%edi
+  801d7b:	41 ff d4             	call   *%r12
+  801d7e:	83 c3 01             	add    $0x1,%ebx
+  801d81:	83 fb 20             	cmp    $0x20,%ebx
+  801d84:	75 f3                	jne    801d79 <close_all+0x16>
+}
+  801d86:	5b                   	pop    %rbx
+  801d87:	41 5c                	pop    %r12
+  801d89:	5d                   	pop    %rbp
+  801d8a:	c3                   	ret
+
+0000000000801d8b <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801d8b:	55                   	push   %rbp
+  801d8c:	48 89 e5             	mov    %rsp,%rbp
+  801d8f:	41 57                	push   %r15
+  801d91:	41 56                	push   %r14
+  801d93:	41 55                	push   %r13
+  801d95:	41 54                	push   %r12
+  801d97:	53                   	push   %rbx
+  801d98:	48 83 ec 18          	sub    $0x18,%rsp
+  801d9c:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801d9f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801da3:	48 b8 cb 1b 80 00 00 	movabs $0x801bcb,%rax
+  801daa:	00 00 00 
+  801dad:	ff d0                	call   *%rax
+  801daf:	89 c3                	mov    %eax,%ebx
+  801db1:	85 c0                	test   %eax,%eax
+  801db3:	0f 88 b8 00 00 00    	js     801e71 <dup+0xe6>
+    close(newfdnum);
+  801db9:	44 89 e7             	mov    %r12d,%edi
+  801dbc:	48 b8 30 1d 80 00 00 	movabs $0x801d30,%rax
+  801dc3:	00 00 00 
+  801dc6:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801dc8:	4d 63 ec             	movslq %r12d,%r13
+  801dcb:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801dd2:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801dd6:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801dda:	4c 89 ff             	mov    %r15,%rdi
+  801ddd:	49 be 4f 1b 80 00 00 	movabs $0x801b4f,%r14
+  801de4:	00 00 00 
+  801de7:	41 ff d6             	call   *%r14
+  801dea:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801ded:	4c 89 ef             	mov    %r13,%rdi
+  801df0:	41 ff d6             	call   *%r14
+  801df3:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801df6:	48 89 df             	mov    %rbx,%rdi
+  801df9:	48 b8 e9 2a 80 00 00 	movabs $0x802ae9,%rax
+  801e00:	00 00 00 
+  801e03:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801e05:	a8 04                	test   $0x4,%al
+  801e07:	74 2b                	je     801e34 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801e09:	41 89 c1             	mov    %eax,%r9d
+  801e0c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e12:	4c 89 f1             	mov    %r14,%rcx
+  801e15:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e1a:	48 89 de             	mov    %rbx,%rsi
+  801e1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e22:	48 b8 85 12 80 00 00 	movabs $0x801285,%rax
+  801e29:	00 00 00 
+  801e2c:	ff d0                	call   *%rax
+  801e2e:	89 c3                	mov    %eax,%ebx
+  801e30:	85 c0                	test   %eax,%eax
+  801e32:	78 4e                	js     801e82 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801e34:	4c 89 ff             	mov    %r15,%rdi
+  801e37:	48 b8 e9 2a 80 00 00 	movabs $0x802ae9,%rax
+  801e3e:	00 00 00 
+  801e41:	ff d0                	call   *%rax
+  801e43:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801e46:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e4c:	4c 89 e9             	mov    %r13,%rcx
+  801e4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e54:	4c 89 fe             	mov    %r15,%rsi
+  801e57:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e5c:	48 b8 85 12 80 00 00 	movabs $0x801285,%rax
+  801e63:	00 00 00 
+  801e66:	ff d0                	call   *%rax
+  801e68:	89 c3                	mov    %eax,%ebx
+  801e6a:	85 c0                	test   %eax,%eax
+  801e6c:	78 14                	js     801e82 <dup+0xf7>
+
+    return newfdnum;
+  801e6e:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801e71:	89 d8                	mov    %ebx,%eax
+  801e73:	48 83 c4 18          	add    $0x18,%rsp
+  801e77:	5b                   	pop    %rbx
+  801e78:	41 5c                	pop    %r12
+  801e7a:	41 5d                	pop    %r13
+  801e7c:	41 5e                	pop    %r14
+  801e7e:	41 5f                	pop    %r15
+  801e80:	5d                   	pop    %rbp
+  801e81:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801e82:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e87:	4c 89 ee             	mov    %r13,%rsi
+  801e8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e8f:	49 bc ea 12 80 00 00 	movabs $0x8012ea,%r12
+  801e96:	00 00 00 
+  801e99:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801e9c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ea1:	4c 89 f6             	mov    %r14,%rsi
+  801ea4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ea9:	41 ff d4             	call   *%r12
+    return res;
+  801eac:	eb c3                	jmp    801e71 <dup+0xe6>
+
+0000000000801eae <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801eae:	55                   	push   %rbp
+  801eaf:	48 89 e5             	mov    %rsp,%rbp
+  801eb2:	41 56                	push   %r14
+  801eb4:	41 55                	push   %r13
+  801eb6:	41 54                	push   %r12
+  801eb8:	53                   	push   %rbx
+  801eb9:	48 83 ec 10          	sub    $0x10,%rsp
+  801ebd:	89 fb                	mov    %edi,%ebx
+  801ebf:	49 89 f4             	mov    %rsi,%r12
+  801ec2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ec5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ec9:	48 b8 cb 1b 80 00 00 	movabs $0x801bcb,%rax
+  801ed0:	00 00 00 
+  801ed3:	ff d0                	call   *%rax
+  801ed5:	85 c0                	test   %eax,%eax
+  801ed7:	78 4c                	js     801f25 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ed9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801edd:	41 8b 3e             	mov    (%r14),%edi
+  801ee0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ee4:	48 b8 16 1c 80 00 00 	movabs $0x801c16,%rax
+  801eeb:	00 00 00 
+  801eee:	ff d0                	call   *%rax
+  801ef0:	85 c0                	test   %eax,%eax
+  801ef2:	78 35                	js     801f29 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ef4:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ef8:	83 e0 03             	and    $0x3,%eax
+  801efb:	83 f8 01             	cmp    $0x1,%eax
+  801efe:	74 2d                	je     801f2d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f00:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f04:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f08:	48 85 c0             	test   %rax,%rax
+  801f0b:	74 56                	je     801f63 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801f0d:	4c 89 ea             	mov    %r13,%rdx
+  801f10:	4c 89 e6             	mov    %r12,%rsi
+  801f13:	4c 89 f7             	mov    %r14,%rdi
+  801f16:	ff d0                	call   *%rax
+}
+  801f18:	48 83 c4 10          	add    $0x10,%rsp
+  801f1c:	5b                   	pop    %rbx
+  801f1d:	41 5c                	pop    %r12
+  801f1f:	41 5d                	pop    %r13
+  801f21:	41 5e                	pop    %r14
+  801f23:	5d                   	pop    %rbp
+  801f24:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f25:	48 98                	cltq
+  801f27:	eb ef                	jmp    801f18 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f29:	48 98                	cltq
+  801f2b:	eb eb                	jmp    801f18 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f2d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f34:	00 00 00 
+  801f37:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f3d:	89 da                	mov    %ebx,%edx
+  801f3f:	48 bf d1 38 80 00 00 	movabs $0x8038d1,%rdi
+  801f46:	00 00 00 
+  801f49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f4e:	48 b9 49 03 80 00 00 	movabs $0x800349,%rcx
+  801f55:	00 00 00 
+  801f58:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f5a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f61:	eb b5                	jmp    801f18 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f63:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f6a:	eb ac                	jmp    801f18 <read+0x6a>
+
+0000000000801f6c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801f6c:	55                   	push   %rbp
+  801f6d:	48 89 e5             	mov    %rsp,%rbp
+  801f70:	41 57                	push   %r15
+  801f72:	41 56                	push   %r14
+  801f74:	41 55                	push   %r13
+  801f76:	41 54                	push   %r12
+  801f78:	53                   	push   %rbx
+  801f79:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801f7d:	48 85 d2             	test   %rdx,%rdx
+  801f80:	74 54                	je     801fd6 <readn+0x6a>
+  801f82:	41 89 fd             	mov    %edi,%r13d
+  801f85:	49 89 f6             	mov    %rsi,%r14
+  801f88:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801f8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801f90:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801f95:	49 bf ae 1e 80 00 00 	movabs $0x801eae,%r15
+  801f9c:	00 00 00 
+  801f9f:	4c 89 e2             	mov    %r12,%rdx
+  801fa2:	48 29 f2             	sub    %rsi,%rdx
+  801fa5:	4c 01 f6             	add    %r14,%rsi
+  801fa8:	44 89 ef             	mov    %r13d,%edi
+  801fab:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801fae:	85 c0                	test   %eax,%eax
+  801fb0:	78 20                	js     801fd2 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801fb2:	01 c3                	add    %eax,%ebx
+  801fb4:	85 c0                	test   %eax,%eax
+  801fb6:	74 08                	je     801fc0 <readn+0x54>
+  801fb8:	48 63 f3             	movslq %ebx,%rsi
+  801fbb:	4c 39 e6             	cmp    %r12,%rsi
+  801fbe:	72 df                	jb     801f9f <readn+0x33>
+    }
+    return res;
+  801fc0:	48 63 c3             	movslq %ebx,%rax
+}
+  801fc3:	48 83 c4 08          	add    $0x8,%rsp
+  801fc7:	5b                   	pop    %rbx
+  801fc8:	41 5c                	pop    %r12
+  801fca:	41 5d                	pop    %r13
+  801fcc:	41 5e                	pop    %r14
+  801fce:	41 5f                	pop    %r15
+  801fd0:	5d                   	pop    %rbp
+  801fd1:	c3                   	ret
+        if (inc < 0) return inc;
+  801fd2:	48 98                	cltq
+  801fd4:	eb ed                	jmp    801fc3 <readn+0x57>
+    int inc = 1, res = 0;
+  801fd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fdb:	eb e3                	jmp    801fc0 <readn+0x54>
+
+0000000000801fdd <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801fdd:	55                   	push   %rbp
+  801fde:	48 89 e5             	mov    %rsp,%rbp
+  801fe1:	41 56                	push   %r14
+  801fe3:	41 55                	push   %r13
+  801fe5:	41 54                	push   %r12
+  801fe7:	53                   	push   %rbx
+  801fe8:	48 83 ec 10          	sub    $0x10,%rsp
+  801fec:	89 fb                	mov    %edi,%ebx
+  801fee:	49 89 f4             	mov    %rsi,%r12
+  801ff1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ff4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ff8:	48 b8 cb 1b 80 00 00 	movabs $0x801bcb,%rax
+  801fff:	00 00 00 
+  802002:	ff d0                	call   *%rax
+  802004:	85 c0                	test   %eax,%eax
+  802006:	78 47                	js     80204f <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802008:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80200c:	41 8b 3e             	mov    (%r14),%edi
+  80200f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802013:	48 b8 16 1c 80 00 00 	movabs $0x801c16,%rax
+  80201a:	00 00 00 
+  80201d:	ff d0                	call   *%rax
+  80201f:	85 c0                	test   %eax,%eax
+  802021:	78 30                	js     802053 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802023:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802028:	74 2d                	je     802057 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80202a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80202e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802032:	48 85 c0             	test   %rax,%rax
+  802035:	74 56                	je     80208d <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802037:	4c 89 ea             	mov    %r13,%rdx
+  80203a:	4c 89 e6             	mov    %r12,%rsi
+  80203d:	4c 89 f7             	mov    %r14,%rdi
+  802040:	ff d0                	call   *%rax
+}
+  802042:	48 83 c4 10          	add    $0x10,%rsp
+  802046:	5b                   	pop    %rbx
+  802047:	41 5c                	pop    %r12
+  802049:	41 5d                	pop    %r13
+  80204b:	41 5e                	pop    %r14
+  80204d:	5d                   	pop    %rbp
+  80204e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80204f:	48 98                	cltq
+  802051:	eb ef                	jmp    802042 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802053:	48 98                	cltq
+  802055:	eb eb                	jmp    802042 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802057:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80205e:	00 00 00 
+  802061:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802067:	89 da                	mov    %ebx,%edx
+  802069:	48 bf ed 38 80 00 00 	movabs $0x8038ed,%rdi
+  802070:	00 00 00 
+  802073:	b8 00 00 00 00       	mov    $0x0,%eax
+  802078:	48 b9 49 03 80 00 00 	movabs $0x800349,%rcx
+  80207f:	00 00 00 
+  802082:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802084:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80208b:	eb b5                	jmp    802042 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80208d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802094:	eb ac                	jmp    802042 <write+0x65>
+
+0000000000802096 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802096:	55                   	push   %rbp
+  802097:	48 89 e5             	mov    %rsp,%rbp
+  80209a:	53                   	push   %rbx
+  80209b:	48 83 ec 18          	sub    $0x18,%rsp
+  80209f:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020a1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020a5:	48 b8 cb 1b 80 00 00 	movabs $0x801bcb,%rax
+  8020ac:	00 00 00 
+  8020af:	ff d0                	call   *%rax
+  8020b1:	85 c0                	test   %eax,%eax
+  8020b3:	78 0c                	js     8020c1 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8020b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020b9:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8020bc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020c5:	c9                   	leave
+  8020c6:	c3                   	ret
+
+00000000008020c7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8020c7:	55                   	push   %rbp
+  8020c8:	48 89 e5             	mov    %rsp,%rbp
+  8020cb:	41 55                	push   %r13
+  8020cd:	41 54                	push   %r12
+  8020cf:	53                   	push   %rbx
+  8020d0:	48 83 ec 18          	sub    $0x18,%rsp
+  8020d4:	89 fb                	mov    %edi,%ebx
+  8020d6:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020d9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020dd:	48 b8 cb 1b 80 00 00 	movabs $0x801bcb,%rax
+  8020e4:	00 00 00 
+  8020e7:	ff d0                	call   *%rax
+  8020e9:	85 c0                	test   %eax,%eax
+  8020eb:	78 38                	js     802125 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020ed:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8020f1:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8020f5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020f9:	48 b8 16 1c 80 00 00 	movabs $0x801c16,%rax
+  802100:	00 00 00 
+  802103:	ff d0                	call   *%rax
+  802105:	85 c0                	test   %eax,%eax
+  802107:	78 1c                	js     802125 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802109:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80210e:	74 20                	je     802130 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802110:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802114:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802118:	48 85 c0             	test   %rax,%rax
+  80211b:	74 47                	je     802164 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80211d:	44 89 e6             	mov    %r12d,%esi
+  802120:	4c 89 ef             	mov    %r13,%rdi
+  802123:	ff d0                	call   *%rax
+}
+  802125:	48 83 c4 18          	add    $0x18,%rsp
+  802129:	5b                   	pop    %rbx
+  80212a:	41 5c                	pop    %r12
+  80212c:	41 5d                	pop    %r13
+  80212e:	5d                   	pop    %rbp
+  80212f:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802130:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802137:	00 00 00 
+  80213a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802140:	89 da                	mov    %ebx,%edx
+  802142:	48 bf b0 38 80 00 00 	movabs $0x8038b0,%rdi
+  802149:	00 00 00 
+  80214c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802151:	48 b9 49 03 80 00 00 	movabs $0x800349,%rcx
+  802158:	00 00 00 
+  80215b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80215d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802162:	eb c1                	jmp    802125 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802164:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802169:	eb ba                	jmp    802125 <ftruncate+0x5e>
+
+000000000080216b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80216b:	55                   	push   %rbp
+  80216c:	48 89 e5             	mov    %rsp,%rbp
+  80216f:	41 54                	push   %r12
+  802171:	53                   	push   %rbx
+  802172:	48 83 ec 10          	sub    $0x10,%rsp
+  802176:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802179:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80217d:	48 b8 cb 1b 80 00 00 	movabs $0x801bcb,%rax
+  802184:	00 00 00 
+  802187:	ff d0                	call   *%rax
+  802189:	85 c0                	test   %eax,%eax
+  80218b:	78 4e                	js     8021db <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80218d:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802191:	41 8b 3c 24          	mov    (%r12),%edi
+  802195:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802199:	48 b8 16 1c 80 00 00 	movabs $0x801c16,%rax
+  8021a0:	00 00 00 
+  8021a3:	ff d0                	call   *%rax
+  8021a5:	85 c0                	test   %eax,%eax
+  8021a7:	78 32                	js     8021db <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8021a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8021ad:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8021b2:	74 30                	je     8021e4 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8021b4:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8021b7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8021be:	00 00 00 
+    stat->st_isdir = 0;
+  8021c1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8021c8:	00 00 00 
+    stat->st_dev = dev;
+  8021cb:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8021d2:	48 89 de             	mov    %rbx,%rsi
+  8021d5:	4c 89 e7             	mov    %r12,%rdi
+  8021d8:	ff 50 28             	call   *0x28(%rax)
+}
+  8021db:	48 83 c4 10          	add    $0x10,%rsp
+  8021df:	5b                   	pop    %rbx
+  8021e0:	41 5c                	pop    %r12
+  8021e2:	5d                   	pop    %rbp
+  8021e3:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8021e4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021e9:	eb f0                	jmp    8021db <fstat+0x70>
+
+00000000008021eb <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8021eb:	55                   	push   %rbp
+  8021ec:	48 89 e5             	mov    %rsp,%rbp
+  8021ef:	41 54                	push   %r12
+  8021f1:	53                   	push   %rbx
+  8021f2:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8021f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8021fa:	48 b8 6c 24 80 00 00 	movabs $0x80246c,%rax
+  802201:	00 00 00 
+  802204:	ff d0                	call   *%rax
+  802206:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802208:	85 c0                	test   %eax,%eax
+  80220a:	78 25                	js     802231 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80220c:	4c 89 e6             	mov    %r12,%rsi
+  80220f:	89 c7                	mov    %eax,%edi
+  802211:	48 b8 6b 21 80 00 00 	movabs $0x80216b,%rax
+  802218:	00 00 00 
+  80221b:	ff d0                	call   *%rax
+  80221d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802220:	89 df                	mov    %ebx,%edi
+  802222:	48 b8 30 1d 80 00 00 	movabs $0x801d30,%rax
+  802229:	00 00 00 
+  80222c:	ff d0                	call   *%rax
+
+    return res;
+  80222e:	44 89 e3             	mov    %r12d,%ebx
+}
+  802231:	89 d8                	mov    %ebx,%eax
+  802233:	5b                   	pop    %rbx
+  802234:	41 5c                	pop    %r12
+  802236:	5d                   	pop    %rbp
+  802237:	c3                   	ret
+
+0000000000802238 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802238:	55                   	push   %rbp
+  802239:	48 89 e5             	mov    %rsp,%rbp
+  80223c:	41 54                	push   %r12
+  80223e:	53                   	push   %rbx
+  80223f:	48 83 ec 10          	sub    $0x10,%rsp
+  802243:	41 89 fc             	mov    %edi,%r12d
+  802246:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802249:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802250:	00 00 00 
+  802253:	83 38 00             	cmpl   $0x0,(%rax)
+  802256:	74 5e                	je     8022b6 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802258:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80225e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802263:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80226a:	00 00 00 
+  80226d:	44 89 e6             	mov    %r12d,%esi
+  802270:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802277:	00 00 00 
+  80227a:	8b 38                	mov    (%rax),%edi
+  80227c:	48 b8 82 30 80 00 00 	movabs $0x803082,%rax
+  802283:	00 00 00 
+  802286:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802288:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80228f:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802290:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802295:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802299:	48 89 de             	mov    %rbx,%rsi
+  80229c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022a1:	48 b8 ed 2f 80 00 00 	movabs $0x802fed,%rax
+  8022a8:	00 00 00 
+  8022ab:	ff d0                	call   *%rax
+}
+  8022ad:	48 83 c4 10          	add    $0x10,%rsp
+  8022b1:	5b                   	pop    %rbx
+  8022b2:	41 5c                	pop    %r12
+  8022b4:	5d                   	pop    %rbp
+  8022b5:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022b6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022bb:	48 b8 22 31 80 00 00 	movabs $0x803122,%rax
+  8022c2:	00 00 00 
+  8022c5:	ff d0                	call   *%rax
+  8022c7:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8022ce:	00 00 
+  8022d0:	eb 86                	jmp    802258 <fsipc+0x20>
+
+00000000008022d2 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8022d2:	55                   	push   %rbp
+  8022d3:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8022d6:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022dd:	00 00 00 
+  8022e0:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8022e3:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8022e5:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8022e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ed:	bf 02 00 00 00       	mov    $0x2,%edi
+  8022f2:	48 b8 38 22 80 00 00 	movabs $0x802238,%rax
+  8022f9:	00 00 00 
+  8022fc:	ff d0                	call   *%rax
+}
+  8022fe:	5d                   	pop    %rbp
+  8022ff:	c3                   	ret
+
+0000000000802300 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802300:	55                   	push   %rbp
+  802301:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802304:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802307:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80230e:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802310:	be 00 00 00 00       	mov    $0x0,%esi
+  802315:	bf 06 00 00 00       	mov    $0x6,%edi
+  80231a:	48 b8 38 22 80 00 00 	movabs $0x802238,%rax
+  802321:	00 00 00 
+  802324:	ff d0                	call   *%rax
+}
+  802326:	5d                   	pop    %rbp
+  802327:	c3                   	ret
+
+0000000000802328 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802328:	55                   	push   %rbp
+  802329:	48 89 e5             	mov    %rsp,%rbp
+  80232c:	41 54                	push   %r12
+  80232e:	53                   	push   %rbx
+  80232f:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802332:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802335:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80233c:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80233e:	be 00 00 00 00       	mov    $0x0,%esi
+  802343:	bf 05 00 00 00       	mov    $0x5,%edi
+  802348:	48 b8 38 22 80 00 00 	movabs $0x802238,%rax
+  80234f:	00 00 00 
+  802352:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802354:	85 c0                	test   %eax,%eax
+  802356:	78 3d                	js     802395 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802358:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80235f:	00 00 00 
+  802362:	4c 89 e6             	mov    %r12,%rsi
+  802365:	48 89 df             	mov    %rbx,%rdi
+  802368:	48 b8 6e 0c 80 00 00 	movabs $0x800c6e,%rax
+  80236f:	00 00 00 
+  802372:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802374:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80237b:	00 
+  80237c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802382:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802389:	00 
+  80238a:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802390:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802395:	5b                   	pop    %rbx
+  802396:	41 5c                	pop    %r12
+  802398:	5d                   	pop    %rbp
+  802399:	c3                   	ret
+
+000000000080239a <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80239a:	55                   	push   %rbp
+  80239b:	48 89 e5             	mov    %rsp,%rbp
+  80239e:	41 54                	push   %r12
+  8023a0:	53                   	push   %rbx
+  8023a1:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8023a4:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8023a9:	48 39 c2             	cmp    %rax,%rdx
+  8023ac:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8023b0:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8023b3:	48 89 c2             	mov    %rax,%rdx
+  8023b6:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8023bd:	00 00 00 
+  8023c0:	48 b8 cf 0e 80 00 00 	movabs $0x800ecf,%rax
+  8023c7:	00 00 00 
+  8023ca:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8023cc:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023d3:	00 00 00 
+  8023d6:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8023db:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8023dd:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8023e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8023e6:	bf 04 00 00 00       	mov    $0x4,%edi
+  8023eb:	48 b8 38 22 80 00 00 	movabs $0x802238,%rax
+  8023f2:	00 00 00 
+  8023f5:	ff d0                	call   *%rax
+  8023f7:	48 98                	cltq
+}
+  8023f9:	5b                   	pop    %rbx
+  8023fa:	41 5c                	pop    %r12
+  8023fc:	5d                   	pop    %rbp
+  8023fd:	c3                   	ret
+
+00000000008023fe <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023fe:	55                   	push   %rbp
+  8023ff:	48 89 e5             	mov    %rsp,%rbp
+  802402:	41 54                	push   %r12
+  802404:	53                   	push   %rbx
+  802405:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802408:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80240f:	00 00 00 
+  802412:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802415:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  802417:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80241c:	48 39 ca             	cmp    %rcx,%rdx
+  80241f:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  802423:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  802427:	be 00 00 00 00       	mov    $0x0,%esi
+  80242c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802431:	48 b8 38 22 80 00 00 	movabs $0x802238,%rax
+  802438:	00 00 00 
+  80243b:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  80243d:	85 c0                	test   %eax,%eax
+  80243f:	78 27                	js     802468 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802441:	48 63 d8             	movslq %eax,%rbx
+  802444:	48 89 da             	mov    %rbx,%rdx
+  802447:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80244e:	00 00 00 
+  802451:	4c 89 e7             	mov    %r12,%rdi
+  802454:	48 b8 cf 0e 80 00 00 	movabs $0x800ecf,%rax
+  80245b:	00 00 00 
+  80245e:	ff d0                	call   *%rax
+    return bytes_read;
+  802460:	48 89 d8             	mov    %rbx,%rax
+}
+  802463:	5b                   	pop    %rbx
+  802464:	41 5c                	pop    %r12
+  802466:	5d                   	pop    %rbp
+  802467:	c3                   	ret
+        return bytes_read;
+  802468:	48 98                	cltq
+  80246a:	eb f7                	jmp    802463 <devfile_read+0x65>
+
+000000000080246c <open>:
+open(const char *path, int mode) {
+  80246c:	55                   	push   %rbp
+  80246d:	48 89 e5             	mov    %rsp,%rbp
+  802470:	41 55                	push   %r13
+  802472:	41 54                	push   %r12
+  802474:	53                   	push   %rbx
+  802475:	48 83 ec 18          	sub    $0x18,%rsp
+  802479:	49 89 fc             	mov    %rdi,%r12
+  80247c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80247f:	48 b8 30 0c 80 00 00 	movabs $0x800c30,%rax
+  802486:	00 00 00 
+  802489:	ff d0                	call   *%rax
+  80248b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802491:	0f 87 8a 00 00 00    	ja     802521 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802497:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80249b:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  8024a2:	00 00 00 
+  8024a5:	ff d0                	call   *%rax
+  8024a7:	89 c3                	mov    %eax,%ebx
+  8024a9:	85 c0                	test   %eax,%eax
+  8024ab:	78 50                	js     8024fd <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8024ad:	4c 89 e6             	mov    %r12,%rsi
+  8024b0:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8024b7:	00 00 00 
+  8024ba:	48 89 df             	mov    %rbx,%rdi
+  8024bd:	48 b8 6e 0c 80 00 00 	movabs $0x800c6e,%rax
+  8024c4:	00 00 00 
+  8024c7:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8024c9:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8024d0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8024d4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8024d9:	48 b8 38 22 80 00 00 	movabs $0x802238,%rax
+  8024e0:	00 00 00 
+  8024e3:	ff d0                	call   *%rax
+  8024e5:	89 c3                	mov    %eax,%ebx
+  8024e7:	85 c0                	test   %eax,%eax
+  8024e9:	78 1f                	js     80250a <open+0x9e>
+    return fd2num(fd);
+  8024eb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024ef:	48 b8 3d 1b 80 00 00 	movabs $0x801b3d,%rax
+  8024f6:	00 00 00 
+  8024f9:	ff d0                	call   *%rax
+  8024fb:	89 c3                	mov    %eax,%ebx
+}
+  8024fd:	89 d8                	mov    %ebx,%eax
+  8024ff:	48 83 c4 18          	add    $0x18,%rsp
+  802503:	5b                   	pop    %rbx
+  802504:	41 5c                	pop    %r12
+  802506:	41 5d                	pop    %r13
+  802508:	5d                   	pop    %rbp
+  802509:	c3                   	ret
+        fd_close(fd, 0);
+  80250a:	be 00 00 00 00       	mov    $0x0,%esi
+  80250f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802513:	48 b8 86 1c 80 00 00 	movabs $0x801c86,%rax
+  80251a:	00 00 00 
+  80251d:	ff d0                	call   *%rax
+        return res;
+  80251f:	eb dc                	jmp    8024fd <open+0x91>
+        return -E_BAD_PATH;
+  802521:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802526:	eb d5                	jmp    8024fd <open+0x91>
+
+0000000000802528 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802528:	55                   	push   %rbp
+  802529:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80252c:	be 00 00 00 00       	mov    $0x0,%esi
+  802531:	bf 08 00 00 00       	mov    $0x8,%edi
+  802536:	48 b8 38 22 80 00 00 	movabs $0x802238,%rax
+  80253d:	00 00 00 
+  802540:	ff d0                	call   *%rax
+}
+  802542:	5d                   	pop    %rbp
+  802543:	c3                   	ret
+
+0000000000802544 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802544:	55                   	push   %rbp
+  802545:	48 89 e5             	mov    %rsp,%rbp
+  802548:	41 54                	push   %r12
+  80254a:	53                   	push   %rbx
+  80254b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80254e:	48 b8 4f 1b 80 00 00 	movabs $0x801b4f,%rax
+  802555:	00 00 00 
+  802558:	ff d0                	call   *%rax
+  80255a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80255d:	48 be 40 39 80 00 00 	movabs $0x803940,%rsi
+  802564:	00 00 00 
+  802567:	48 89 df             	mov    %rbx,%rdi
+  80256a:	48 b8 6e 0c 80 00 00 	movabs $0x800c6e,%rax
+  802571:	00 00 00 
+  802574:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802576:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80257b:	41 2b 04 24          	sub    (%r12),%eax
+  80257f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802585:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80258c:	00 00 00 
+    stat->st_dev = &devpipe;
+  80258f:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802596:	00 00 00 
+  802599:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8025a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a5:	5b                   	pop    %rbx
+  8025a6:	41 5c                	pop    %r12
+  8025a8:	5d                   	pop    %rbp
+  8025a9:	c3                   	ret
+
+00000000008025aa <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8025aa:	55                   	push   %rbp
+  8025ab:	48 89 e5             	mov    %rsp,%rbp
+  8025ae:	41 54                	push   %r12
+  8025b0:	53                   	push   %rbx
+  8025b1:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8025b4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025b9:	48 89 fe             	mov    %rdi,%rsi
+  8025bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025c1:	49 bc ea 12 80 00 00 	movabs $0x8012ea,%r12
+  8025c8:	00 00 00 
+  8025cb:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8025ce:	48 89 df             	mov    %rbx,%rdi
+  8025d1:	48 b8 4f 1b 80 00 00 	movabs $0x801b4f,%rax
+  8025d8:	00 00 00 
+  8025db:	ff d0                	call   *%rax
+  8025dd:	48 89 c6             	mov    %rax,%rsi
+  8025e0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025ea:	41 ff d4             	call   *%r12
+}
+  8025ed:	5b                   	pop    %rbx
+  8025ee:	41 5c                	pop    %r12
+  8025f0:	5d                   	pop    %rbp
+  8025f1:	c3                   	ret
+
+00000000008025f2 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8025f2:	55                   	push   %rbp
+  8025f3:	48 89 e5             	mov    %rsp,%rbp
+  8025f6:	41 57                	push   %r15
+  8025f8:	41 56                	push   %r14
+  8025fa:	41 55                	push   %r13
+  8025fc:	41 54                	push   %r12
+  8025fe:	53                   	push   %rbx
+  8025ff:	48 83 ec 18          	sub    $0x18,%rsp
+  802603:	49 89 fc             	mov    %rdi,%r12
+  802606:	49 89 f5             	mov    %rsi,%r13
+  802609:	49 89 d7             	mov    %rdx,%r15
+  80260c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802610:	48 b8 4f 1b 80 00 00 	movabs $0x801b4f,%rax
+  802617:	00 00 00 
+  80261a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80261c:	4d 85 ff             	test   %r15,%r15
+  80261f:	0f 84 af 00 00 00    	je     8026d4 <devpipe_write+0xe2>
+  802625:	48 89 c3             	mov    %rax,%rbx
+  802628:	4c 89 f8             	mov    %r15,%rax
+  80262b:	4d 89 ef             	mov    %r13,%r15
+  80262e:	4c 01 e8             	add    %r13,%rax
+  802631:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802635:	49 bd f2 11 80 00 00 	movabs $0x8011f2,%r13
+  80263c:	00 00 00 
+            sys_yield();
+  80263f:	49 be 8f 11 80 00 00 	movabs $0x80118f,%r14
+  802646:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802649:	8b 73 04             	mov    0x4(%rbx),%esi
+  80264c:	48 63 ce             	movslq %esi,%rcx
+  80264f:	48 63 03             	movslq (%rbx),%rax
+  802652:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802658:	48 39 c1             	cmp    %rax,%rcx
+  80265b:	72 2e                	jb     80268b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80265d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802662:	48 89 da             	mov    %rbx,%rdx
+  802665:	be 00 10 00 00       	mov    $0x1000,%esi
+  80266a:	4c 89 e7             	mov    %r12,%rdi
+  80266d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802670:	85 c0                	test   %eax,%eax
+  802672:	74 66                	je     8026da <devpipe_write+0xe8>
+            sys_yield();
+  802674:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802677:	8b 73 04             	mov    0x4(%rbx),%esi
+  80267a:	48 63 ce             	movslq %esi,%rcx
+  80267d:	48 63 03             	movslq (%rbx),%rax
+  802680:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802686:	48 39 c1             	cmp    %rax,%rcx
+  802689:	73 d2                	jae    80265d <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80268b:	41 0f b6 3f          	movzbl (%r15),%edi
+  80268f:	48 89 ca             	mov    %rcx,%rdx
+  802692:	48 c1 ea 03          	shr    $0x3,%rdx
+  802696:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80269d:	08 10 20 
+  8026a0:	48 f7 e2             	mul    %rdx
+  8026a3:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026a7:	48 89 d0             	mov    %rdx,%rax
+  8026aa:	48 c1 e0 09          	shl    $0x9,%rax
+  8026ae:	48 29 d0             	sub    %rdx,%rax
+  8026b1:	48 c1 e0 03          	shl    $0x3,%rax
+  8026b5:	48 29 c1             	sub    %rax,%rcx
+  8026b8:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8026bd:	83 c6 01             	add    $0x1,%esi
+  8026c0:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8026c3:	49 83 c7 01          	add    $0x1,%r15
+  8026c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026cb:	49 39 c7             	cmp    %rax,%r15
+  8026ce:	0f 85 75 ff ff ff    	jne    802649 <devpipe_write+0x57>
+    return n;
+  8026d4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8026d8:	eb 05                	jmp    8026df <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8026da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026df:	48 83 c4 18          	add    $0x18,%rsp
+  8026e3:	5b                   	pop    %rbx
+  8026e4:	41 5c                	pop    %r12
+  8026e6:	41 5d                	pop    %r13
+  8026e8:	41 5e                	pop    %r14
+  8026ea:	41 5f                	pop    %r15
+  8026ec:	5d                   	pop    %rbp
+  8026ed:	c3                   	ret
+
+00000000008026ee <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8026ee:	55                   	push   %rbp
+  8026ef:	48 89 e5             	mov    %rsp,%rbp
+  8026f2:	41 57                	push   %r15
+  8026f4:	41 56                	push   %r14
+  8026f6:	41 55                	push   %r13
+  8026f8:	41 54                	push   %r12
+  8026fa:	53                   	push   %rbx
+  8026fb:	48 83 ec 18          	sub    $0x18,%rsp
+  8026ff:	49 89 fc             	mov    %rdi,%r12
+  802702:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802706:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80270a:	48 b8 4f 1b 80 00 00 	movabs $0x801b4f,%rax
+  802711:	00 00 00 
+  802714:	ff d0                	call   *%rax
+  802716:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802719:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80271f:	49 bd f2 11 80 00 00 	movabs $0x8011f2,%r13
+  802726:	00 00 00 
+            sys_yield();
+  802729:	49 be 8f 11 80 00 00 	movabs $0x80118f,%r14
+  802730:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802733:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802738:	74 7d                	je     8027b7 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80273a:	8b 03                	mov    (%rbx),%eax
+  80273c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80273f:	75 26                	jne    802767 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802741:	4d 85 ff             	test   %r15,%r15
+  802744:	75 77                	jne    8027bd <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802746:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80274b:	48 89 da             	mov    %rbx,%rdx
+  80274e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802753:	4c 89 e7             	mov    %r12,%rdi
+  802756:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802759:	85 c0                	test   %eax,%eax
+  80275b:	74 72                	je     8027cf <devpipe_read+0xe1>
+            sys_yield();
+  80275d:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802760:	8b 03                	mov    (%rbx),%eax
+  802762:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802765:	74 df                	je     802746 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802767:	48 63 c8             	movslq %eax,%rcx
+  80276a:	48 89 ca             	mov    %rcx,%rdx
+  80276d:	48 c1 ea 03          	shr    $0x3,%rdx
+  802771:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802778:	08 10 20 
+  80277b:	48 89 d0             	mov    %rdx,%rax
+  80277e:	48 f7 e6             	mul    %rsi
+  802781:	48 c1 ea 06          	shr    $0x6,%rdx
+  802785:	48 89 d0             	mov    %rdx,%rax
+  802788:	48 c1 e0 09          	shl    $0x9,%rax
+  80278c:	48 29 d0             	sub    %rdx,%rax
+  80278f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802796:	00 
+  802797:	48 89 c8             	mov    %rcx,%rax
+  80279a:	48 29 d0             	sub    %rdx,%rax
+  80279d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8027a2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8027a6:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8027aa:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8027ad:	49 83 c7 01          	add    $0x1,%r15
+  8027b1:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8027b5:	75 83                	jne    80273a <devpipe_read+0x4c>
+    return n;
+  8027b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027bb:	eb 03                	jmp    8027c0 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8027bd:	4c 89 f8             	mov    %r15,%rax
+}
+  8027c0:	48 83 c4 18          	add    $0x18,%rsp
+  8027c4:	5b                   	pop    %rbx
+  8027c5:	41 5c                	pop    %r12
+  8027c7:	41 5d                	pop    %r13
+  8027c9:	41 5e                	pop    %r14
+  8027cb:	41 5f                	pop    %r15
+  8027cd:	5d                   	pop    %rbp
+  8027ce:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8027cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d4:	eb ea                	jmp    8027c0 <devpipe_read+0xd2>
+
+00000000008027d6 <pipe>:
+pipe(int pfd[2]) {
+  8027d6:	55                   	push   %rbp
+  8027d7:	48 89 e5             	mov    %rsp,%rbp
+  8027da:	41 55                	push   %r13
+  8027dc:	41 54                	push   %r12
+  8027de:	53                   	push   %rbx
+  8027df:	48 83 ec 18          	sub    $0x18,%rsp
+  8027e3:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027e6:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8027ea:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  8027f1:	00 00 00 
+  8027f4:	ff d0                	call   *%rax
+  8027f6:	89 c3                	mov    %eax,%ebx
+  8027f8:	85 c0                	test   %eax,%eax
+  8027fa:	0f 88 a0 01 00 00    	js     8029a0 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802800:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802805:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80280a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80280e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802813:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  80281a:	00 00 00 
+  80281d:	ff d0                	call   *%rax
+  80281f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802821:	85 c0                	test   %eax,%eax
+  802823:	0f 88 77 01 00 00    	js     8029a0 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802829:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80282d:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  802834:	00 00 00 
+  802837:	ff d0                	call   *%rax
+  802839:	89 c3                	mov    %eax,%ebx
+  80283b:	85 c0                	test   %eax,%eax
+  80283d:	0f 88 43 01 00 00    	js     802986 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802843:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802848:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80284d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802851:	bf 00 00 00 00       	mov    $0x0,%edi
+  802856:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  80285d:	00 00 00 
+  802860:	ff d0                	call   *%rax
+  802862:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802864:	85 c0                	test   %eax,%eax
+  802866:	0f 88 1a 01 00 00    	js     802986 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80286c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802870:	48 b8 4f 1b 80 00 00 	movabs $0x801b4f,%rax
+  802877:	00 00 00 
+  80287a:	ff d0                	call   *%rax
+  80287c:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80287f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802884:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802889:	48 89 c6             	mov    %rax,%rsi
+  80288c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802891:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  802898:	00 00 00 
+  80289b:	ff d0                	call   *%rax
+  80289d:	89 c3                	mov    %eax,%ebx
+  80289f:	85 c0                	test   %eax,%eax
+  8028a1:	0f 88 c5 00 00 00    	js     80296c <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8028a7:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028ab:	48 b8 4f 1b 80 00 00 	movabs $0x801b4f,%rax
+  8028b2:	00 00 00 
+  8028b5:	ff d0                	call   *%rax
+  8028b7:	48 89 c1             	mov    %rax,%rcx
+  8028ba:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8028c0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8028c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028cb:	4c 89 ee             	mov    %r13,%rsi
+  8028ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028d3:	48 b8 85 12 80 00 00 	movabs $0x801285,%rax
+  8028da:	00 00 00 
+  8028dd:	ff d0                	call   *%rax
+  8028df:	89 c3                	mov    %eax,%ebx
+  8028e1:	85 c0                	test   %eax,%eax
+  8028e3:	78 6e                	js     802953 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028e5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028ea:	4c 89 ef             	mov    %r13,%rdi
+  8028ed:	48 b8 c0 11 80 00 00 	movabs $0x8011c0,%rax
+  8028f4:	00 00 00 
+  8028f7:	ff d0                	call   *%rax
+  8028f9:	83 f8 02             	cmp    $0x2,%eax
+  8028fc:	0f 85 ab 00 00 00    	jne    8029ad <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802902:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802909:	00 00 
+  80290b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80290f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802911:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802915:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80291c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802920:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802922:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802926:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80292d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802931:	48 bb 3d 1b 80 00 00 	movabs $0x801b3d,%rbx
+  802938:	00 00 00 
+  80293b:	ff d3                	call   *%rbx
+  80293d:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802941:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802945:	ff d3                	call   *%rbx
+  802947:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80294c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802951:	eb 4d                	jmp    8029a0 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802953:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802958:	4c 89 ee             	mov    %r13,%rsi
+  80295b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802960:	48 b8 ea 12 80 00 00 	movabs $0x8012ea,%rax
+  802967:	00 00 00 
+  80296a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80296c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802971:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802975:	bf 00 00 00 00       	mov    $0x0,%edi
+  80297a:	48 b8 ea 12 80 00 00 	movabs $0x8012ea,%rax
+  802981:	00 00 00 
+  802984:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802986:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80298b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80298f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802994:	48 b8 ea 12 80 00 00 	movabs $0x8012ea,%rax
+  80299b:	00 00 00 
+  80299e:	ff d0                	call   *%rax
+}
+  8029a0:	89 d8                	mov    %ebx,%eax
+  8029a2:	48 83 c4 18          	add    $0x18,%rsp
+  8029a6:	5b                   	pop    %rbx
+  8029a7:	41 5c                	pop    %r12
+  8029a9:	41 5d                	pop    %r13
+  8029ab:	5d                   	pop    %rbp
+  8029ac:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8029ad:	48 b9 58 39 80 00 00 	movabs $0x803958,%rcx
+  8029b4:	00 00 00 
+  8029b7:	48 ba 77 38 80 00 00 	movabs $0x803877,%rdx
+  8029be:	00 00 00 
+  8029c1:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8029c6:	48 bf 47 39 80 00 00 	movabs $0x803947,%rdi
+  8029cd:	00 00 00 
+  8029d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d5:	49 b8 f9 01 80 00 00 	movabs $0x8001f9,%r8
+  8029dc:	00 00 00 
+  8029df:	41 ff d0             	call   *%r8
+
+00000000008029e2 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8029e2:	55                   	push   %rbp
+  8029e3:	48 89 e5             	mov    %rsp,%rbp
+  8029e6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8029ea:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8029ee:	48 b8 cb 1b 80 00 00 	movabs $0x801bcb,%rax
+  8029f5:	00 00 00 
+  8029f8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029fa:	85 c0                	test   %eax,%eax
+  8029fc:	78 35                	js     802a33 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8029fe:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a02:	48 b8 4f 1b 80 00 00 	movabs $0x801b4f,%rax
+  802a09:	00 00 00 
+  802a0c:	ff d0                	call   *%rax
+  802a0e:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802a11:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802a16:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a1b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a1f:	48 b8 f2 11 80 00 00 	movabs $0x8011f2,%rax
+  802a26:	00 00 00 
+  802a29:	ff d0                	call   *%rax
+  802a2b:	85 c0                	test   %eax,%eax
+  802a2d:	0f 94 c0             	sete   %al
+  802a30:	0f b6 c0             	movzbl %al,%eax
+}
+  802a33:	c9                   	leave
+  802a34:	c3                   	ret
+
+0000000000802a35 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a35:	48 89 f8             	mov    %rdi,%rax
+  802a38:	48 c1 e8 27          	shr    $0x27,%rax
+  802a3c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a43:	01 00 00 
+  802a46:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a4a:	f6 c2 01             	test   $0x1,%dl
+  802a4d:	74 6d                	je     802abc <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a4f:	48 89 f8             	mov    %rdi,%rax
+  802a52:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a56:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a5d:	01 00 00 
+  802a60:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a64:	f6 c2 01             	test   $0x1,%dl
+  802a67:	74 62                	je     802acb <get_uvpt_entry+0x96>
+  802a69:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a70:	01 00 00 
+  802a73:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a77:	f6 c2 80             	test   $0x80,%dl
+  802a7a:	75 4f                	jne    802acb <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a7c:	48 89 f8             	mov    %rdi,%rax
+  802a7f:	48 c1 e8 15          	shr    $0x15,%rax
+  802a83:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a8a:	01 00 00 
+  802a8d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a91:	f6 c2 01             	test   $0x1,%dl
+  802a94:	74 44                	je     802ada <get_uvpt_entry+0xa5>
+  802a96:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a9d:	01 00 00 
+  802aa0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802aa4:	f6 c2 80             	test   $0x80,%dl
+  802aa7:	75 31                	jne    802ada <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802aa9:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802aad:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ab4:	01 00 00 
+  802ab7:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802abb:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802abc:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802ac3:	01 00 00 
+  802ac6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802aca:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802acb:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802ad2:	01 00 00 
+  802ad5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ad9:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802ada:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802ae1:	01 00 00 
+  802ae4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ae8:	c3                   	ret
+
+0000000000802ae9 <get_prot>:
+
+int
+get_prot(void *va) {
+  802ae9:	55                   	push   %rbp
+  802aea:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802aed:	48 b8 35 2a 80 00 00 	movabs $0x802a35,%rax
+  802af4:	00 00 00 
+  802af7:	ff d0                	call   *%rax
+  802af9:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802afc:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802b01:	89 c1                	mov    %eax,%ecx
+  802b03:	83 c9 04             	or     $0x4,%ecx
+  802b06:	f6 c2 01             	test   $0x1,%dl
+  802b09:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802b0c:	89 c1                	mov    %eax,%ecx
+  802b0e:	83 c9 02             	or     $0x2,%ecx
+  802b11:	f6 c2 02             	test   $0x2,%dl
+  802b14:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802b17:	89 c1                	mov    %eax,%ecx
+  802b19:	83 c9 01             	or     $0x1,%ecx
+  802b1c:	48 85 d2             	test   %rdx,%rdx
+  802b1f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802b22:	89 c1                	mov    %eax,%ecx
+  802b24:	83 c9 40             	or     $0x40,%ecx
+  802b27:	f6 c6 04             	test   $0x4,%dh
+  802b2a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802b2d:	5d                   	pop    %rbp
+  802b2e:	c3                   	ret
+
+0000000000802b2f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802b2f:	55                   	push   %rbp
+  802b30:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b33:	48 b8 35 2a 80 00 00 	movabs $0x802a35,%rax
+  802b3a:	00 00 00 
+  802b3d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802b3f:	48 c1 e8 06          	shr    $0x6,%rax
+  802b43:	83 e0 01             	and    $0x1,%eax
+}
+  802b46:	5d                   	pop    %rbp
+  802b47:	c3                   	ret
+
+0000000000802b48 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802b48:	55                   	push   %rbp
+  802b49:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802b4c:	48 b8 35 2a 80 00 00 	movabs $0x802a35,%rax
+  802b53:	00 00 00 
+  802b56:	ff d0                	call   *%rax
+  802b58:	83 e0 01             	and    $0x1,%eax
+}
+  802b5b:	5d                   	pop    %rbp
+  802b5c:	c3                   	ret
+
+0000000000802b5d <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802b5d:	55                   	push   %rbp
+  802b5e:	48 89 e5             	mov    %rsp,%rbp
+  802b61:	41 57                	push   %r15
+  802b63:	41 56                	push   %r14
+  802b65:	41 55                	push   %r13
+  802b67:	41 54                	push   %r12
+  802b69:	53                   	push   %rbx
+  802b6a:	48 83 ec 18          	sub    $0x18,%rsp
+  802b6e:	49 89 ff             	mov    %rdi,%r15
+  802b71:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802b75:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802b7a:	49 bc 48 2b 80 00 00 	movabs $0x802b48,%r12
+  802b81:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802b84:	49 be e9 2a 80 00 00 	movabs $0x802ae9,%r14
+  802b8b:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802b8e:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802b95:	00 00 00 
+  802b98:	eb 0c                	jmp    802ba6 <foreach_shared_region+0x49>
+  802b9a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ba1:	4c 39 eb             	cmp    %r13,%rbx
+  802ba4:	74 38                	je     802bde <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802ba6:	48 89 df             	mov    %rbx,%rdi
+  802ba9:	41 ff d4             	call   *%r12
+  802bac:	84 c0                	test   %al,%al
+  802bae:	74 ea                	je     802b9a <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802bb0:	48 89 df             	mov    %rbx,%rdi
+  802bb3:	41 ff d6             	call   *%r14
+  802bb6:	a8 40                	test   $0x40,%al
+  802bb8:	74 e0                	je     802b9a <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802bba:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802bc1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802bc5:	48 89 df             	mov    %rbx,%rdi
+  802bc8:	41 ff d7             	call   *%r15
+        if (err)
+  802bcb:	85 c0                	test   %eax,%eax
+  802bcd:	74 cb                	je     802b9a <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802bcf:	48 83 c4 18          	add    $0x18,%rsp
+  802bd3:	5b                   	pop    %rbx
+  802bd4:	41 5c                	pop    %r12
+  802bd6:	41 5d                	pop    %r13
+  802bd8:	41 5e                	pop    %r14
+  802bda:	41 5f                	pop    %r15
+  802bdc:	5d                   	pop    %rbp
+  802bdd:	c3                   	ret
+    return 0;
+  802bde:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be3:	eb ea                	jmp    802bcf <foreach_shared_region+0x72>
+
+0000000000802be5 <_generic_signal_handler>:
+        (es->sa.sa_handler)(es->signo);
+    }
+}
+
+void
+_generic_signal_handler(struct UTrapframe *utf, struct EnqueuedSignal * es) {
+  802be5:	55                   	push   %rbp
+  802be6:	48 89 e5             	mov    %rsp,%rbp
+  802be9:	41 55                	push   %r13
+  802beb:	41 54                	push   %r12
+  802bed:	53                   	push   %rbx
+  802bee:	48 83 ec 08          	sub    $0x8,%rsp
+  802bf2:	49 89 fc             	mov    %rdi,%r12
+  802bf5:	48 89 f3             	mov    %rsi,%rbx
+    if (trace_signals)
+        cprintf("signals: env %x: begin generic handler for %d\n", sys_getenvid(), es->signo);
+  802bf8:	44 8b 2e             	mov    (%rsi),%r13d
+  802bfb:	48 b8 5e 11 80 00 00 	movabs $0x80115e,%rax
+  802c02:	00 00 00 
+  802c05:	ff d0                	call   *%rax
+  802c07:	89 c6                	mov    %eax,%esi
+  802c09:	44 89 ea             	mov    %r13d,%edx
+  802c0c:	48 bf 80 39 80 00 00 	movabs $0x803980,%rdi
+  802c13:	00 00 00 
+  802c16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1b:	48 b9 49 03 80 00 00 	movabs $0x800349,%rcx
+  802c22:	00 00 00 
+  802c25:	ff d1                	call   *%rcx
+    if (es->sa.sa_handler == SIG_DFL) {
+  802c27:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802c2b:	48 85 c0             	test   %rax,%rax
+  802c2e:	74 57                	je     802c87 <_generic_signal_handler+0xa2>
+    if (es->sa.sa_handler == SIG_IGN) {
+  802c30:	48 83 f8 01          	cmp    $0x1,%rax
+  802c34:	0f 84 c0 00 00 00    	je     802cfa <_generic_signal_handler+0x115>
+    if (es->sa.sa_flags & SA_SIGINFO) {
+  802c3a:	f6 43 14 04          	testb  $0x4,0x14(%rbx)
+  802c3e:	0f 84 ea 00 00 00    	je     802d2e <_generic_signal_handler+0x149>
+        (es->sa.sa_sigaction)(es->signo, &(es->info), utf);
+  802c44:	48 8d 73 18          	lea    0x18(%rbx),%rsi
+  802c48:	8b 3b                	mov    (%rbx),%edi
+  802c4a:	4c 89 e2             	mov    %r12,%rdx
+  802c4d:	ff d0                	call   *%rax
+
+    _generic_signal_handler_impl(utf, es);
+
+    if (trace_signals)
+        cprintf("signals: env %x: end generic handler for %d\n", sys_getenvid(), es->signo);
+  802c4f:	8b 1b                	mov    (%rbx),%ebx
+  802c51:	48 b8 5e 11 80 00 00 	movabs $0x80115e,%rax
+  802c58:	00 00 00 
+  802c5b:	ff d0                	call   *%rax
+  802c5d:	89 c6                	mov    %eax,%esi
+  802c5f:	89 da                	mov    %ebx,%edx
+  802c61:	48 bf 08 3a 80 00 00 	movabs $0x803a08,%rdi
+  802c68:	00 00 00 
+  802c6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c70:	48 b9 49 03 80 00 00 	movabs $0x800349,%rcx
+  802c77:	00 00 00 
+  802c7a:	ff d1                	call   *%rcx
+}
+  802c7c:	48 83 c4 08          	add    $0x8,%rsp
+  802c80:	5b                   	pop    %rbx
+  802c81:	41 5c                	pop    %r12
+  802c83:	41 5d                	pop    %r13
+  802c85:	5d                   	pop    %rbp
+  802c86:	c3                   	ret
+            cprintf("signals: env %x: exiting due to signal %d\n", sys_getenvid(), es->signo);
+  802c87:	8b 1b                	mov    (%rbx),%ebx
+  802c89:	48 b8 5e 11 80 00 00 	movabs $0x80115e,%rax
+  802c90:	00 00 00 
+  802c93:	ff d0                	call   *%rax
+  802c95:	89 c6                	mov    %eax,%esi
+  802c97:	89 da                	mov    %ebx,%edx
+  802c99:	48 bf b0 39 80 00 00 	movabs $0x8039b0,%rdi
+  802ca0:	00 00 00 
+  802ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca8:	48 b9 49 03 80 00 00 	movabs $0x800349,%rcx
+  802caf:	00 00 00 
+  802cb2:	ff d1                	call   *%rcx
+        sys_env_destroy(CURENVID);
+  802cb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cb9:	48 b8 f3 10 80 00 00 	movabs $0x8010f3,%rax
+  802cc0:	00 00 00 
+  802cc3:	ff d0                	call   *%rax
+        assert(false);
+  802cc5:	48 b9 35 3a 80 00 00 	movabs $0x803a35,%rcx
+  802ccc:	00 00 00 
+  802ccf:	48 ba 77 38 80 00 00 	movabs $0x803877,%rdx
+  802cd6:	00 00 00 
+  802cd9:	be 0c 00 00 00       	mov    $0xc,%esi
+  802cde:	48 bf 3b 3a 80 00 00 	movabs $0x803a3b,%rdi
+  802ce5:	00 00 00 
+  802ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ced:	49 b8 f9 01 80 00 00 	movabs $0x8001f9,%r8
+  802cf4:	00 00 00 
+  802cf7:	41 ff d0             	call   *%r8
+            cprintf("signals: env %x: ignoring signal %d\n", sys_getenvid(), es->signo);
+  802cfa:	44 8b 23             	mov    (%rbx),%r12d
+  802cfd:	48 b8 5e 11 80 00 00 	movabs $0x80115e,%rax
+  802d04:	00 00 00 
+  802d07:	ff d0                	call   *%rax
+  802d09:	89 c6                	mov    %eax,%esi
+  802d0b:	44 89 e2             	mov    %r12d,%edx
+  802d0e:	48 bf e0 39 80 00 00 	movabs $0x8039e0,%rdi
+  802d15:	00 00 00 
+  802d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1d:	48 b9 49 03 80 00 00 	movabs $0x800349,%rcx
+  802d24:	00 00 00 
+  802d27:	ff d1                	call   *%rcx
+        return;
+  802d29:	e9 21 ff ff ff       	jmp    802c4f <_generic_signal_handler+0x6a>
+        (es->sa.sa_handler)(es->signo);
+  802d2e:	8b 3b                	mov    (%rbx),%edi
+  802d30:	ff d0                	call   *%rax
+  802d32:	e9 18 ff ff ff       	jmp    802c4f <_generic_signal_handler+0x6a>
+
+0000000000802d37 <sigqueue>:
+
+int sigqueue(pid_t pid, int signo, const union sigval value) {
+  802d37:	55                   	push   %rbp
+  802d38:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigqueue(pid, signo, value);
+  802d3b:	48 b8 22 16 80 00 00 	movabs $0x801622,%rax
+  802d42:	00 00 00 
+  802d45:	ff d0                	call   *%rax
+}
+  802d47:	5d                   	pop    %rbp
+  802d48:	c3                   	ret
+
+0000000000802d49 <sigwait>:
+
+int sigwait(const sigset_t * set, int * sig) {
+  802d49:	55                   	push   %rbp
+  802d4a:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigwait(set, sig);
+  802d4d:	48 b8 89 16 80 00 00 	movabs $0x801689,%rax
+  802d54:	00 00 00 
+  802d57:	ff d0                	call   *%rax
+}
+  802d59:	5d                   	pop    %rbp
+  802d5a:	c3                   	ret
+
+0000000000802d5b <sigaction>:
+
+extern void _signal_handler_trampoline(void);
+
+int sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  802d5b:	55                   	push   %rbp
+  802d5c:	48 89 e5             	mov    %rsp,%rbp
+  802d5f:	41 55                	push   %r13
+  802d61:	41 54                	push   %r12
+  802d63:	53                   	push   %rbx
+  802d64:	48 83 ec 08          	sub    $0x8,%rsp
+  802d68:	89 fb                	mov    %edi,%ebx
+  802d6a:	49 89 f4             	mov    %rsi,%r12
+  802d6d:	49 89 d5             	mov    %rdx,%r13
+    int err = sys_env_set_pgfault_upcall(CURENVID, _signal_handler_trampoline);
+  802d70:	48 be 82 1a 80 00 00 	movabs $0x801a82,%rsi
+  802d77:	00 00 00 
+  802d7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d7f:	48 b8 f3 14 80 00 00 	movabs $0x8014f3,%rax
+  802d86:	00 00 00 
+  802d89:	ff d0                	call   *%rax
+    if (err)
+  802d8b:	85 c0                	test   %eax,%eax
+  802d8d:	74 0b                	je     802d9a <sigaction+0x3f>
+        return err;
+    return sys_sigaction(sig, act, oact);
+}
+  802d8f:	48 83 c4 08          	add    $0x8,%rsp
+  802d93:	5b                   	pop    %rbx
+  802d94:	41 5c                	pop    %r12
+  802d96:	41 5d                	pop    %r13
+  802d98:	5d                   	pop    %rbp
+  802d99:	c3                   	ret
+    return sys_sigaction(sig, act, oact);
+  802d9a:	4c 89 ea             	mov    %r13,%rdx
+  802d9d:	4c 89 e6             	mov    %r12,%rsi
+  802da0:	89 df                	mov    %ebx,%edi
+  802da2:	48 b8 f2 16 80 00 00 	movabs $0x8016f2,%rax
+  802da9:	00 00 00 
+  802dac:	ff d0                	call   *%rax
+  802dae:	eb df                	jmp    802d8f <sigaction+0x34>
+
+0000000000802db0 <sigprocmask>:
+
+int sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  802db0:	55                   	push   %rbp
+  802db1:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigprocmask(how, set, oldset);
+  802db4:	48 b8 59 17 80 00 00 	movabs $0x801759,%rax
+  802dbb:	00 00 00 
+  802dbe:	ff d0                	call   *%rax
+}
+  802dc0:	5d                   	pop    %rbp
+  802dc1:	c3                   	ret
+
+0000000000802dc2 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc7:	c3                   	ret
+
+0000000000802dc8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802dc8:	55                   	push   %rbp
+  802dc9:	48 89 e5             	mov    %rsp,%rbp
+  802dcc:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802dcf:	48 be 48 3a 80 00 00 	movabs $0x803a48,%rsi
+  802dd6:	00 00 00 
+  802dd9:	48 b8 6e 0c 80 00 00 	movabs $0x800c6e,%rax
+  802de0:	00 00 00 
+  802de3:	ff d0                	call   *%rax
+    return 0;
+}
+  802de5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dea:	5d                   	pop    %rbp
+  802deb:	c3                   	ret
+
+0000000000802dec <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802dec:	55                   	push   %rbp
+  802ded:	48 89 e5             	mov    %rsp,%rbp
+  802df0:	41 57                	push   %r15
+  802df2:	41 56                	push   %r14
+  802df4:	41 55                	push   %r13
+  802df6:	41 54                	push   %r12
+  802df8:	53                   	push   %rbx
+  802df9:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802e00:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802e07:	48 85 d2             	test   %rdx,%rdx
+  802e0a:	74 7a                	je     802e86 <devcons_write+0x9a>
+  802e0c:	49 89 d6             	mov    %rdx,%r14
+  802e0f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802e15:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802e1a:	49 bf 68 0e 80 00 00 	movabs $0x800e68,%r15
+  802e21:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802e24:	4c 89 f3             	mov    %r14,%rbx
+  802e27:	48 29 f3             	sub    %rsi,%rbx
+  802e2a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802e2f:	48 39 c3             	cmp    %rax,%rbx
+  802e32:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802e36:	4c 63 eb             	movslq %ebx,%r13
+  802e39:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802e40:	48 01 c6             	add    %rax,%rsi
+  802e43:	4c 89 ea             	mov    %r13,%rdx
+  802e46:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802e4d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802e50:	4c 89 ee             	mov    %r13,%rsi
+  802e53:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802e5a:	48 b8 95 10 80 00 00 	movabs $0x801095,%rax
+  802e61:	00 00 00 
+  802e64:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802e66:	41 01 dc             	add    %ebx,%r12d
+  802e69:	49 63 f4             	movslq %r12d,%rsi
+  802e6c:	4c 39 f6             	cmp    %r14,%rsi
+  802e6f:	72 b3                	jb     802e24 <devcons_write+0x38>
+    return res;
+  802e71:	49 63 c4             	movslq %r12d,%rax
+}
+  802e74:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802e7b:	5b                   	pop    %rbx
+  802e7c:	41 5c                	pop    %r12
+  802e7e:	41 5d                	pop    %r13
+  802e80:	41 5e                	pop    %r14
+  802e82:	41 5f                	pop    %r15
+  802e84:	5d                   	pop    %rbp
+  802e85:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802e86:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802e8c:	eb e3                	jmp    802e71 <devcons_write+0x85>
+
+0000000000802e8e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e8e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802e91:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e96:	48 85 c0             	test   %rax,%rax
+  802e99:	74 55                	je     802ef0 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e9b:	55                   	push   %rbp
+  802e9c:	48 89 e5             	mov    %rsp,%rbp
+  802e9f:	41 55                	push   %r13
+  802ea1:	41 54                	push   %r12
+  802ea3:	53                   	push   %rbx
+  802ea4:	48 83 ec 08          	sub    $0x8,%rsp
+  802ea8:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802eab:	48 bb c2 10 80 00 00 	movabs $0x8010c2,%rbx
+  802eb2:	00 00 00 
+  802eb5:	49 bc 8f 11 80 00 00 	movabs $0x80118f,%r12
+  802ebc:	00 00 00 
+  802ebf:	eb 03                	jmp    802ec4 <devcons_read+0x36>
+  802ec1:	41 ff d4             	call   *%r12
+  802ec4:	ff d3                	call   *%rbx
+  802ec6:	85 c0                	test   %eax,%eax
+  802ec8:	74 f7                	je     802ec1 <devcons_read+0x33>
+    if (c < 0) return c;
+  802eca:	48 63 d0             	movslq %eax,%rdx
+  802ecd:	78 13                	js     802ee2 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802ecf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ed4:	83 f8 04             	cmp    $0x4,%eax
+  802ed7:	74 09                	je     802ee2 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802ed9:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802edd:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802ee2:	48 89 d0             	mov    %rdx,%rax
+  802ee5:	48 83 c4 08          	add    $0x8,%rsp
+  802ee9:	5b                   	pop    %rbx
+  802eea:	41 5c                	pop    %r12
+  802eec:	41 5d                	pop    %r13
+  802eee:	5d                   	pop    %rbp
+  802eef:	c3                   	ret
+  802ef0:	48 89 d0             	mov    %rdx,%rax
+  802ef3:	c3                   	ret
+
+0000000000802ef4 <cputchar>:
+cputchar(int ch) {
+  802ef4:	55                   	push   %rbp
+  802ef5:	48 89 e5             	mov    %rsp,%rbp
+  802ef8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802efc:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802f00:	be 01 00 00 00       	mov    $0x1,%esi
+  802f05:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802f09:	48 b8 95 10 80 00 00 	movabs $0x801095,%rax
+  802f10:	00 00 00 
+  802f13:	ff d0                	call   *%rax
+}
+  802f15:	c9                   	leave
+  802f16:	c3                   	ret
+
+0000000000802f17 <getchar>:
+getchar(void) {
+  802f17:	55                   	push   %rbp
+  802f18:	48 89 e5             	mov    %rsp,%rbp
+  802f1b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802f1f:	ba 01 00 00 00       	mov    $0x1,%edx
+  802f24:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802f28:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f2d:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  802f34:	00 00 00 
+  802f37:	ff d0                	call   *%rax
+  802f39:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802f3b:	85 c0                	test   %eax,%eax
+  802f3d:	78 06                	js     802f45 <getchar+0x2e>
+  802f3f:	74 08                	je     802f49 <getchar+0x32>
+  802f41:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802f45:	89 d0                	mov    %edx,%eax
+  802f47:	c9                   	leave
+  802f48:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802f49:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802f4e:	eb f5                	jmp    802f45 <getchar+0x2e>
+
+0000000000802f50 <iscons>:
+iscons(int fdnum) {
+  802f50:	55                   	push   %rbp
+  802f51:	48 89 e5             	mov    %rsp,%rbp
+  802f54:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802f58:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f5c:	48 b8 cb 1b 80 00 00 	movabs $0x801bcb,%rax
+  802f63:	00 00 00 
+  802f66:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f68:	85 c0                	test   %eax,%eax
+  802f6a:	78 18                	js     802f84 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802f6c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f70:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802f77:	00 00 00 
+  802f7a:	8b 00                	mov    (%rax),%eax
+  802f7c:	39 02                	cmp    %eax,(%rdx)
+  802f7e:	0f 94 c0             	sete   %al
+  802f81:	0f b6 c0             	movzbl %al,%eax
+}
+  802f84:	c9                   	leave
+  802f85:	c3                   	ret
+
+0000000000802f86 <opencons>:
+opencons(void) {
+  802f86:	55                   	push   %rbp
+  802f87:	48 89 e5             	mov    %rsp,%rbp
+  802f8a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f8e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802f92:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  802f99:	00 00 00 
+  802f9c:	ff d0                	call   *%rax
+  802f9e:	85 c0                	test   %eax,%eax
+  802fa0:	78 49                	js     802feb <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802fa2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802fa7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fac:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802fb0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fb5:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  802fbc:	00 00 00 
+  802fbf:	ff d0                	call   *%rax
+  802fc1:	85 c0                	test   %eax,%eax
+  802fc3:	78 26                	js     802feb <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802fc5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802fc9:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802fd0:	00 00 
+  802fd2:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802fd4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fd8:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802fdf:	48 b8 3d 1b 80 00 00 	movabs $0x801b3d,%rax
+  802fe6:	00 00 00 
+  802fe9:	ff d0                	call   *%rax
+}
+  802feb:	c9                   	leave
+  802fec:	c3                   	ret
+
+0000000000802fed <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802fed:	55                   	push   %rbp
+  802fee:	48 89 e5             	mov    %rsp,%rbp
+  802ff1:	41 54                	push   %r12
+  802ff3:	53                   	push   %rbx
+  802ff4:	48 89 fb             	mov    %rdi,%rbx
+  802ff7:	48 89 f7             	mov    %rsi,%rdi
+  802ffa:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802ffd:	48 85 f6             	test   %rsi,%rsi
+  803000:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803007:	00 00 00 
+  80300a:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  80300e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803013:	48 b8 88 15 80 00 00 	movabs $0x801588,%rax
+  80301a:	00 00 00 
+  80301d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80301f:	85 c0                	test   %eax,%eax
+  803021:	78 45                	js     803068 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  803023:	48 85 db             	test   %rbx,%rbx
+  803026:	74 12                	je     80303a <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  803028:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80302f:	00 00 00 
+  803032:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  803038:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  80303a:	4d 85 e4             	test   %r12,%r12
+  80303d:	74 14                	je     803053 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  80303f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803046:	00 00 00 
+  803049:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  80304f:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  803053:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80305a:	00 00 00 
+  80305d:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  803063:	5b                   	pop    %rbx
+  803064:	41 5c                	pop    %r12
+  803066:	5d                   	pop    %rbp
+  803067:	c3                   	ret
+        if (from_env_store)
+  803068:	48 85 db             	test   %rbx,%rbx
+  80306b:	74 06                	je     803073 <ipc_recv+0x86>
+            *from_env_store = 0;
+  80306d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  803073:	4d 85 e4             	test   %r12,%r12
+  803076:	74 eb                	je     803063 <ipc_recv+0x76>
+            *perm_store = 0;
+  803078:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80307f:	00 
+  803080:	eb e1                	jmp    803063 <ipc_recv+0x76>
+
+0000000000803082 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803082:	55                   	push   %rbp
+  803083:	48 89 e5             	mov    %rsp,%rbp
+  803086:	41 57                	push   %r15
+  803088:	41 56                	push   %r14
+  80308a:	41 55                	push   %r13
+  80308c:	41 54                	push   %r12
+  80308e:	53                   	push   %rbx
+  80308f:	48 83 ec 18          	sub    $0x18,%rsp
+  803093:	41 89 fd             	mov    %edi,%r13d
+  803096:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803099:	48 89 d3             	mov    %rdx,%rbx
+  80309c:	49 89 cc             	mov    %rcx,%r12
+  80309f:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8030a3:	48 85 d2             	test   %rdx,%rdx
+  8030a6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8030ad:	00 00 00 
+  8030b0:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8030b4:	49 be 5c 15 80 00 00 	movabs $0x80155c,%r14
+  8030bb:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  8030be:	49 bf 8f 11 80 00 00 	movabs $0x80118f,%r15
+  8030c5:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8030c8:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8030cb:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8030cf:	4c 89 e1             	mov    %r12,%rcx
+  8030d2:	48 89 da             	mov    %rbx,%rdx
+  8030d5:	44 89 ef             	mov    %r13d,%edi
+  8030d8:	41 ff d6             	call   *%r14
+        if (res == 0)
+  8030db:	85 c0                	test   %eax,%eax
+  8030dd:	74 34                	je     803113 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  8030df:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8030e2:	75 05                	jne    8030e9 <ipc_send+0x67>
+        sys_yield();
+  8030e4:	41 ff d7             	call   *%r15
+    while (true) {
+  8030e7:	eb df                	jmp    8030c8 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  8030e9:	48 ba 54 3a 80 00 00 	movabs $0x803a54,%rdx
+  8030f0:	00 00 00 
+  8030f3:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8030f8:	48 bf 6d 3a 80 00 00 	movabs $0x803a6d,%rdi
+  8030ff:	00 00 00 
+  803102:	b8 00 00 00 00       	mov    $0x0,%eax
+  803107:	48 b9 f9 01 80 00 00 	movabs $0x8001f9,%rcx
+  80310e:	00 00 00 
+  803111:	ff d1                	call   *%rcx
+    }
+}
+  803113:	48 83 c4 18          	add    $0x18,%rsp
+  803117:	5b                   	pop    %rbx
+  803118:	41 5c                	pop    %r12
+  80311a:	41 5d                	pop    %r13
+  80311c:	41 5e                	pop    %r14
+  80311e:	41 5f                	pop    %r15
+  803120:	5d                   	pop    %rbp
+  803121:	c3                   	ret
+
+0000000000803122 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803122:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803127:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80312e:	00 00 00 
+  803131:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  803138:	48 01 ca             	add    %rcx,%rdx
+  80313b:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803141:	39 fa                	cmp    %edi,%edx
+  803143:	74 12                	je     803157 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803145:	48 83 c0 01          	add    $0x1,%rax
+  803149:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80314f:	75 e0                	jne    803131 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803151:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803156:	c3                   	ret
+            return envs[i].env_id;
+  803157:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80315e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803165:	00 00 00 
+  803168:	48 01 d0             	add    %rdx,%rax
+  80316b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803171:	c3                   	ret
+  803172:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000803178 <__rodata_start>:
+  803178:	66 61                	data16 (bad)
+  80317a:	75 6c                	jne    8031e8 <__rodata_start+0x70>
+  80317c:	74 20                	je     80319e <__rodata_start+0x26>
+  80317e:	25 6c 78 0a 00       	and    $0xa786c,%eax
+  803183:	75 73                	jne    8031f8 <__rodata_start+0x80>
+  803185:	65 72 2f             	gs jb  8031b7 <__rodata_start+0x3f>
+  803188:	66 61                	data16 (bad)
+  80318a:	75 6c                	jne    8031f8 <__rodata_start+0x80>
+  80318c:	74 61                	je     8031ef <__rodata_start+0x77>
+  80318e:	6c                   	insb   (%dx),%es:(%rdi)
+  80318f:	6c                   	insb   (%dx),%es:(%rdi)
+  803190:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803191:	63 2e                	movsxd (%rsi),%ebp
+  803193:	63 00                	movsxd (%rax),%eax
+  803195:	25 73 0a 00 0f       	and    $0xf000a73,%eax
+  80319a:	1f                   	(bad)
+  80319b:	80 00 00             	addb   $0x0,(%rax)
+  80319e:	00 00                	add    %al,(%rax)
+  8031a0:	61                   	(bad)
+  8031a1:	6c                   	insb   (%dx),%es:(%rdi)
+  8031a2:	6c                   	insb   (%dx),%es:(%rdi)
+  8031a3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031a4:	63 61 74             	movsxd 0x74(%rcx),%esp
+  8031a7:	69 6e 67 20 61 74 20 	imul   $0x20746120,0x67(%rsi),%ebp
+  8031ae:	25 6c 78 20 69       	and    $0x6920786c,%eax
+  8031b3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031b4:	20 70 61             	and    %dh,0x61(%rax)
+  8031b7:	67 65 20 66 61       	and    %ah,%gs:0x61(%esi)
+  8031bc:	75 6c                	jne    80322a <__rodata_start+0xb2>
+  8031be:	74 20                	je     8031e0 <__rodata_start+0x68>
+  8031c0:	68 61 6e 64 6c       	push   $0x6c646e61
+  8031c5:	65 72 3a             	gs jb  803202 <__rodata_start+0x8a>
+  8031c8:	20 25 69 00 00 00    	and    %ah,0x69(%rip)        # 803237 <__rodata_start+0xbf>
+  8031ce:	00 00                	add    %al,(%rax)
+  8031d0:	74 68                	je     80323a <__rodata_start+0xc2>
+  8031d2:	69 73 20 73 74 72 69 	imul   $0x69727473,0x20(%rbx),%esi
+  8031d9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031da:	67 20 77 61          	and    %dh,0x61(%edi)
+  8031de:	73 20                	jae    803200 <__rodata_start+0x88>
+  8031e0:	66 61                	data16 (bad)
+  8031e2:	75 6c                	jne    803250 <__rodata_start+0xd8>
+  8031e4:	74 65                	je     80324b <__rodata_start+0xd3>
+  8031e6:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  8031ea:	20 61 74             	and    %ah,0x74(%rcx)
+  8031ed:	20 25 6c 78 00 3c    	and    %ah,0x3c00786c(%rip)        # 3c80aa5f <__bss_end+0x3c002a5f>
+  8031f3:	75 6e                	jne    803263 <__rodata_start+0xeb>
+  8031f5:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8031f9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031fa:	3e 00 0f             	ds add %cl,(%rdi)
+  8031fd:	1f                   	(bad)
+  8031fe:	40 00 5b 25          	rex add %bl,0x25(%rbx)
+  803202:	30 38                	xor    %bh,(%rax)
+  803204:	78 5d                	js     803263 <__rodata_start+0xeb>
+  803206:	20 75 73             	and    %dh,0x73(%rbp)
+  803209:	65 72 20             	gs jb  80322c <__rodata_start+0xb4>
+  80320c:	70 61                	jo     80326f <__rodata_start+0xf7>
+  80320e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80320f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803216:	73 20                	jae    803238 <__rodata_start+0xc0>
+  803218:	61                   	(bad)
+  803219:	74 20                	je     80323b <__rodata_start+0xc3>
+  80321b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803220:	3a 20                	cmp    (%rax),%ah
+  803222:	00 30                	add    %dh,(%rax)
+  803224:	31 32                	xor    %esi,(%rdx)
+  803226:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80322d:	41                   	rex.B
+  80322e:	42                   	rex.X
+  80322f:	43                   	rex.XB
+  803230:	44                   	rex.R
+  803231:	45                   	rex.RB
+  803232:	46 00 30             	rex.RX add %r14b,(%rax)
+  803235:	31 32                	xor    %esi,(%rdx)
+  803237:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80323e:	61                   	(bad)
+  80323f:	62 63 64 65 66       	(bad)
+  803244:	00 28                	add    %ch,(%rax)
+  803246:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803247:	75 6c                	jne    8032b5 <__rodata_start+0x13d>
+  803249:	6c                   	insb   (%dx),%es:(%rdi)
+  80324a:	29 00                	sub    %eax,(%rax)
+  80324c:	65 72 72             	gs jb  8032c1 <__rodata_start+0x149>
+  80324f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803250:	72 20                	jb     803272 <__rodata_start+0xfa>
+  803252:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803257:	73 70                	jae    8032c9 <__rodata_start+0x151>
+  803259:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80325d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803264:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803265:	72 00                	jb     803267 <__rodata_start+0xef>
+  803267:	62 61 64 20 65       	(bad)
+  80326c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80326d:	76 69                	jbe    8032d8 <__rodata_start+0x160>
+  80326f:	72 6f                	jb     8032e0 <__rodata_start+0x168>
+  803271:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803272:	6d                   	insl   (%dx),%es:(%rdi)
+  803273:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803275:	74 00                	je     803277 <__rodata_start+0xff>
+  803277:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80327e:	20 70 61             	and    %dh,0x61(%rax)
+  803281:	72 61                	jb     8032e4 <__rodata_start+0x16c>
+  803283:	6d                   	insl   (%dx),%es:(%rdi)
+  803284:	65 74 65             	gs je  8032ec <__rodata_start+0x174>
+  803287:	72 00                	jb     803289 <__rodata_start+0x111>
+  803289:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80328a:	75 74                	jne    803300 <__rodata_start+0x188>
+  80328c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80328f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803292:	6d                   	insl   (%dx),%es:(%rdi)
+  803293:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803294:	72 79                	jb     80330f <__rodata_start+0x197>
+  803296:	00 6f 75             	add    %ch,0x75(%rdi)
+  803299:	74 20                	je     8032bb <__rodata_start+0x143>
+  80329b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80329c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8032a0:	76 69                	jbe    80330b <__rodata_start+0x193>
+  8032a2:	72 6f                	jb     803313 <__rodata_start+0x19b>
+  8032a4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032a5:	6d                   	insl   (%dx),%es:(%rdi)
+  8032a6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8032a8:	74 73                	je     80331d <__rodata_start+0x1a5>
+  8032aa:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8032ad:	72 72                	jb     803321 <__rodata_start+0x1a9>
+  8032af:	75 70                	jne    803321 <__rodata_start+0x1a9>
+  8032b1:	74 65                	je     803318 <__rodata_start+0x1a0>
+  8032b3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8032b8:	75 67                	jne    803321 <__rodata_start+0x1a9>
+  8032ba:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8032bd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8032bf:	00 73 65             	add    %dh,0x65(%rbx)
+  8032c2:	67 6d                	insl   (%dx),%es:(%edi)
+  8032c4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8032c6:	74 61                	je     803329 <__rodata_start+0x1b1>
+  8032c8:	74 69                	je     803333 <__rodata_start+0x1bb>
+  8032ca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032cb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032cc:	20 66 61             	and    %ah,0x61(%rsi)
+  8032cf:	75 6c                	jne    80333d <__rodata_start+0x1c5>
+  8032d1:	74 00                	je     8032d3 <__rodata_start+0x15b>
+  8032d3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8032da:	20 45 4c             	and    %al,0x4c(%rbp)
+  8032dd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8032e1:	61                   	(bad)
+  8032e2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8032e7:	20 73 75             	and    %dh,0x75(%rbx)
+  8032ea:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8032ed:	73 79                	jae    803368 <__rodata_start+0x1f0>
+  8032ef:	73 74                	jae    803365 <__rodata_start+0x1ed>
+  8032f1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8032f3:	20 63 61             	and    %ah,0x61(%rbx)
+  8032f6:	6c                   	insb   (%dx),%es:(%rdi)
+  8032f7:	6c                   	insb   (%dx),%es:(%rdi)
+  8032f8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8032fb:	74 72                	je     80336f <__rodata_start+0x1f7>
+  8032fd:	79 20                	jns    80331f <__rodata_start+0x1a7>
+  8032ff:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803300:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803301:	74 20                	je     803323 <__rodata_start+0x1ab>
+  803303:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803305:	75 6e                	jne    803375 <__rodata_start+0x1fd>
+  803307:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80330b:	76 20                	jbe    80332d <__rodata_start+0x1b5>
+  80330d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803314:	72 65                	jb     80337b <__rodata_start+0x203>
+  803316:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803319:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80331a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80331e:	65 78 70             	gs js  803391 <__rodata_start+0x219>
+  803321:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803326:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803329:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80332d:	20 66 69             	and    %ah,0x69(%rsi)
+  803330:	6c                   	insb   (%dx),%es:(%rdi)
+  803331:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803335:	20 66 72             	and    %ah,0x72(%rsi)
+  803338:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80333d:	61                   	(bad)
+  80333e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803341:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803342:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803343:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803347:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80334a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80334b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80334c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80334f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803350:	79 20                	jns    803372 <__rodata_start+0x1fa>
+  803352:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803359:	72 65                	jb     8033c0 <__rodata_start+0x248>
+  80335b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80335e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803360:	00 66 69             	add    %ah,0x69(%rsi)
+  803363:	6c                   	insb   (%dx),%es:(%rdi)
+  803364:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803368:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80336b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80336c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80336f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803370:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803371:	74 20                	je     803393 <__rodata_start+0x21b>
+  803373:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803375:	75 6e                	jne    8033e5 <__rodata_start+0x26d>
+  803377:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80337b:	76 61                	jbe    8033de <__rodata_start+0x266>
+  80337d:	6c                   	insb   (%dx),%es:(%rdi)
+  80337e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803385:	00 
+  803386:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80338d:	72 65                	jb     8033f4 <__rodata_start+0x27c>
+  80338f:	61                   	(bad)
+  803390:	64 79 20             	fs jns 8033b3 <__rodata_start+0x23b>
+  803393:	65 78 69             	gs js  8033ff <__rodata_start+0x287>
+  803396:	73 74                	jae    80340c <__rodata_start+0x294>
+  803398:	73 00                	jae    80339a <__rodata_start+0x222>
+  80339a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80339b:	70 65                	jo     803402 <__rodata_start+0x28a>
+  80339d:	72 61                	jb     803400 <__rodata_start+0x288>
+  80339f:	74 69                	je     80340a <__rodata_start+0x292>
+  8033a1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033a2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033a3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8033a6:	74 20                	je     8033c8 <__rodata_start+0x250>
+  8033a8:	73 75                	jae    80341f <__rodata_start+0x2a7>
+  8033aa:	70 70                	jo     80341c <__rodata_start+0x2a4>
+  8033ac:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033ad:	72 74                	jb     803423 <__rodata_start+0x2ab>
+  8033af:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8033b4:	65 72 61             	gs jb  803418 <__rodata_start+0x2a0>
+  8033b7:	74 69                	je     803422 <__rodata_start+0x2aa>
+  8033b9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033ba:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033bb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8033be:	74 20                	je     8033e0 <__rodata_start+0x268>
+  8033c0:	70 65                	jo     803427 <__rodata_start+0x2af>
+  8033c2:	72 6d                	jb     803431 <__rodata_start+0x2b9>
+  8033c4:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  8033cb:	2e 
+  8033cc:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8033d3:	00 
+  8033d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8033db:	00 00 00 
+  8033de:	66 90                	xchg   %ax,%ax
+  8033e0:	36 05 80 00 00 00    	ss add $0x80,%eax
+  8033e6:	00 00                	add    %al,(%rax)
+  8033e8:	77 0b                	ja     8033f5 <__rodata_start+0x27d>
+  8033ea:	80 00 00             	addb   $0x0,(%rax)
+  8033ed:	00 00                	add    %al,(%rax)
+  8033ef:	00 67 0b             	add    %ah,0xb(%rdi)
+  8033f2:	80 00 00             	addb   $0x0,(%rax)
+  8033f5:	00 00                	add    %al,(%rax)
+  8033f7:	00 77 0b             	add    %dh,0xb(%rdi)
+  8033fa:	80 00 00             	addb   $0x0,(%rax)
+  8033fd:	00 00                	add    %al,(%rax)
+  8033ff:	00 77 0b             	add    %dh,0xb(%rdi)
+  803402:	80 00 00             	addb   $0x0,(%rax)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 77 0b             	add    %dh,0xb(%rdi)
+  80340a:	80 00 00             	addb   $0x0,(%rax)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 77 0b             	add    %dh,0xb(%rdi)
+  803412:	80 00 00             	addb   $0x0,(%rax)
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 55 05             	add    %dl,0x5(%rbp)
+  80341a:	80 00 00             	addb   $0x0,(%rax)
+  80341d:	00 00                	add    %al,(%rax)
+  80341f:	00 77 0b             	add    %dh,0xb(%rdi)
+  803422:	80 00 00             	addb   $0x0,(%rax)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 77 0b             	add    %dh,0xb(%rdi)
+  80342a:	80 00 00             	addb   $0x0,(%rax)
+  80342d:	00 00                	add    %al,(%rax)
+  80342f:	00 49 05             	add    %cl,0x5(%rcx)
+  803432:	80 00 00             	addb   $0x0,(%rax)
+  803435:	00 00                	add    %al,(%rax)
+  803437:	00 c3                	add    %al,%bl
+  803439:	05 80 00 00 00       	add    $0x80,%eax
+  80343e:	00 00                	add    %al,(%rax)
+  803440:	77 0b                	ja     80344d <__rodata_start+0x2d5>
+  803442:	80 00 00             	addb   $0x0,(%rax)
+  803445:	00 00                	add    %al,(%rax)
+  803447:	00 49 05             	add    %cl,0x5(%rcx)
+  80344a:	80 00 00             	addb   $0x0,(%rax)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 8f 05 80 00 00    	add    %cl,0x8005(%rdi)
+  803455:	00 00                	add    %al,(%rax)
+  803457:	00 8f 05 80 00 00    	add    %cl,0x8005(%rdi)
+  80345d:	00 00                	add    %al,(%rax)
+  80345f:	00 8f 05 80 00 00    	add    %cl,0x8005(%rdi)
+  803465:	00 00                	add    %al,(%rax)
+  803467:	00 8f 05 80 00 00    	add    %cl,0x8005(%rdi)
+  80346d:	00 00                	add    %al,(%rax)
+  80346f:	00 8f 05 80 00 00    	add    %cl,0x8005(%rdi)
+  803475:	00 00                	add    %al,(%rax)
+  803477:	00 8f 05 80 00 00    	add    %cl,0x8005(%rdi)
+  80347d:	00 00                	add    %al,(%rax)
+  80347f:	00 8f 05 80 00 00    	add    %cl,0x8005(%rdi)
+  803485:	00 00                	add    %al,(%rax)
+  803487:	00 8f 05 80 00 00    	add    %cl,0x8005(%rdi)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 8f 05 80 00 00    	add    %cl,0x8005(%rdi)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 77 0b             	add    %dh,0xb(%rdi)
+  80349a:	80 00 00             	addb   $0x0,(%rax)
+  80349d:	00 00                	add    %al,(%rax)
+  80349f:	00 77 0b             	add    %dh,0xb(%rdi)
+  8034a2:	80 00 00             	addb   $0x0,(%rax)
+  8034a5:	00 00                	add    %al,(%rax)
+  8034a7:	00 77 0b             	add    %dh,0xb(%rdi)
+  8034aa:	80 00 00             	addb   $0x0,(%rax)
+  8034ad:	00 00                	add    %al,(%rax)
+  8034af:	00 77 0b             	add    %dh,0xb(%rdi)
+  8034b2:	80 00 00             	addb   $0x0,(%rax)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 77 0b             	add    %dh,0xb(%rdi)
+  8034ba:	80 00 00             	addb   $0x0,(%rax)
+  8034bd:	00 00                	add    %al,(%rax)
+  8034bf:	00 77 0b             	add    %dh,0xb(%rdi)
+  8034c2:	80 00 00             	addb   $0x0,(%rax)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 77 0b             	add    %dh,0xb(%rdi)
+  8034ca:	80 00 00             	addb   $0x0,(%rax)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 77 0b             	add    %dh,0xb(%rdi)
+  8034d2:	80 00 00             	addb   $0x0,(%rax)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 77 0b             	add    %dh,0xb(%rdi)
+  8034da:	80 00 00             	addb   $0x0,(%rax)
+  8034dd:	00 00                	add    %al,(%rax)
+  8034df:	00 77 0b             	add    %dh,0xb(%rdi)
+  8034e2:	80 00 00             	addb   $0x0,(%rax)
+  8034e5:	00 00                	add    %al,(%rax)
+  8034e7:	00 77 0b             	add    %dh,0xb(%rdi)
+  8034ea:	80 00 00             	addb   $0x0,(%rax)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 77 0b             	add    %dh,0xb(%rdi)
+  8034f2:	80 00 00             	addb   $0x0,(%rax)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 77 0b             	add    %dh,0xb(%rdi)
+  8034fa:	80 00 00             	addb   $0x0,(%rax)
+  8034fd:	00 00                	add    %al,(%rax)
+  8034ff:	00 77 0b             	add    %dh,0xb(%rdi)
+  803502:	80 00 00             	addb   $0x0,(%rax)
+  803505:	00 00                	add    %al,(%rax)
+  803507:	00 77 0b             	add    %dh,0xb(%rdi)
+  80350a:	80 00 00             	addb   $0x0,(%rax)
+  80350d:	00 00                	add    %al,(%rax)
+  80350f:	00 77 0b             	add    %dh,0xb(%rdi)
+  803512:	80 00 00             	addb   $0x0,(%rax)
+  803515:	00 00                	add    %al,(%rax)
+  803517:	00 77 0b             	add    %dh,0xb(%rdi)
+  80351a:	80 00 00             	addb   $0x0,(%rax)
+  80351d:	00 00                	add    %al,(%rax)
+  80351f:	00 77 0b             	add    %dh,0xb(%rdi)
+  803522:	80 00 00             	addb   $0x0,(%rax)
+  803525:	00 00                	add    %al,(%rax)
+  803527:	00 77 0b             	add    %dh,0xb(%rdi)
+  80352a:	80 00 00             	addb   $0x0,(%rax)
+  80352d:	00 00                	add    %al,(%rax)
+  80352f:	00 77 0b             	add    %dh,0xb(%rdi)
+  803532:	80 00 00             	addb   $0x0,(%rax)
+  803535:	00 00                	add    %al,(%rax)
+  803537:	00 77 0b             	add    %dh,0xb(%rdi)
+  80353a:	80 00 00             	addb   $0x0,(%rax)
+  80353d:	00 00                	add    %al,(%rax)
+  80353f:	00 77 0b             	add    %dh,0xb(%rdi)
+  803542:	80 00 00             	addb   $0x0,(%rax)
+  803545:	00 00                	add    %al,(%rax)
+  803547:	00 77 0b             	add    %dh,0xb(%rdi)
+  80354a:	80 00 00             	addb   $0x0,(%rax)
+  80354d:	00 00                	add    %al,(%rax)
+  80354f:	00 77 0b             	add    %dh,0xb(%rdi)
+  803552:	80 00 00             	addb   $0x0,(%rax)
+  803555:	00 00                	add    %al,(%rax)
+  803557:	00 77 0b             	add    %dh,0xb(%rdi)
+  80355a:	80 00 00             	addb   $0x0,(%rax)
+  80355d:	00 00                	add    %al,(%rax)
+  80355f:	00 77 0b             	add    %dh,0xb(%rdi)
+  803562:	80 00 00             	addb   $0x0,(%rax)
+  803565:	00 00                	add    %al,(%rax)
+  803567:	00 77 0b             	add    %dh,0xb(%rdi)
+  80356a:	80 00 00             	addb   $0x0,(%rax)
+  80356d:	00 00                	add    %al,(%rax)
+  80356f:	00 77 0b             	add    %dh,0xb(%rdi)
+  803572:	80 00 00             	addb   $0x0,(%rax)
+  803575:	00 00                	add    %al,(%rax)
+  803577:	00 77 0b             	add    %dh,0xb(%rdi)
+  80357a:	80 00 00             	addb   $0x0,(%rax)
+  80357d:	00 00                	add    %al,(%rax)
+  80357f:	00 77 0b             	add    %dh,0xb(%rdi)
+  803582:	80 00 00             	addb   $0x0,(%rax)
+  803585:	00 00                	add    %al,(%rax)
+  803587:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  80358d:	00 00                	add    %al,(%rax)
+  80358f:	00 77 0b             	add    %dh,0xb(%rdi)
+  803592:	80 00 00             	addb   $0x0,(%rax)
+  803595:	00 00                	add    %al,(%rax)
+  803597:	00 77 0b             	add    %dh,0xb(%rdi)
+  80359a:	80 00 00             	addb   $0x0,(%rax)
+  80359d:	00 00                	add    %al,(%rax)
+  80359f:	00 77 0b             	add    %dh,0xb(%rdi)
+  8035a2:	80 00 00             	addb   $0x0,(%rax)
+  8035a5:	00 00                	add    %al,(%rax)
+  8035a7:	00 77 0b             	add    %dh,0xb(%rdi)
+  8035aa:	80 00 00             	addb   $0x0,(%rax)
+  8035ad:	00 00                	add    %al,(%rax)
+  8035af:	00 77 0b             	add    %dh,0xb(%rdi)
+  8035b2:	80 00 00             	addb   $0x0,(%rax)
+  8035b5:	00 00                	add    %al,(%rax)
+  8035b7:	00 77 0b             	add    %dh,0xb(%rdi)
+  8035ba:	80 00 00             	addb   $0x0,(%rax)
+  8035bd:	00 00                	add    %al,(%rax)
+  8035bf:	00 77 0b             	add    %dh,0xb(%rdi)
+  8035c2:	80 00 00             	addb   $0x0,(%rax)
+  8035c5:	00 00                	add    %al,(%rax)
+  8035c7:	00 77 0b             	add    %dh,0xb(%rdi)
+  8035ca:	80 00 00             	addb   $0x0,(%rax)
+  8035cd:	00 00                	add    %al,(%rax)
+  8035cf:	00 77 0b             	add    %dh,0xb(%rdi)
+  8035d2:	80 00 00             	addb   $0x0,(%rax)
+  8035d5:	00 00                	add    %al,(%rax)
+  8035d7:	00 77 0b             	add    %dh,0xb(%rdi)
+  8035da:	80 00 00             	addb   $0x0,(%rax)
+  8035dd:	00 00                	add    %al,(%rax)
+  8035df:	00 e6                	add    %ah,%dh
+  8035e1:	05 80 00 00 00       	add    $0x80,%eax
+  8035e6:	00 00                	add    %al,(%rax)
+  8035e8:	b5 07                	mov    $0x7,%ch
+  8035ea:	80 00 00             	addb   $0x0,(%rax)
+  8035ed:	00 00                	add    %al,(%rax)
+  8035ef:	00 77 0b             	add    %dh,0xb(%rdi)
+  8035f2:	80 00 00             	addb   $0x0,(%rax)
+  8035f5:	00 00                	add    %al,(%rax)
+  8035f7:	00 77 0b             	add    %dh,0xb(%rdi)
+  8035fa:	80 00 00             	addb   $0x0,(%rax)
+  8035fd:	00 00                	add    %al,(%rax)
+  8035ff:	00 77 0b             	add    %dh,0xb(%rdi)
+  803602:	80 00 00             	addb   $0x0,(%rax)
+  803605:	00 00                	add    %al,(%rax)
+  803607:	00 77 0b             	add    %dh,0xb(%rdi)
+  80360a:	80 00 00             	addb   $0x0,(%rax)
+  80360d:	00 00                	add    %al,(%rax)
+  80360f:	00 15 06 80 00 00    	add    %dl,0x8006(%rip)        # 80b61b <__bss_end+0x361b>
+  803615:	00 00                	add    %al,(%rax)
+  803617:	00 77 0b             	add    %dh,0xb(%rdi)
+  80361a:	80 00 00             	addb   $0x0,(%rax)
+  80361d:	00 00                	add    %al,(%rax)
+  80361f:	00 77 0b             	add    %dh,0xb(%rdi)
+  803622:	80 00 00             	addb   $0x0,(%rax)
+  803625:	00 00                	add    %al,(%rax)
+  803627:	00 db                	add    %bl,%bl
+  803629:	05 80 00 00 00       	add    $0x80,%eax
+  80362e:	00 00                	add    %al,(%rax)
+  803630:	77 0b                	ja     80363d <__rodata_start+0x4c5>
+  803632:	80 00 00             	addb   $0x0,(%rax)
+  803635:	00 00                	add    %al,(%rax)
+  803637:	00 77 0b             	add    %dh,0xb(%rdi)
+  80363a:	80 00 00             	addb   $0x0,(%rax)
+  80363d:	00 00                	add    %al,(%rax)
+  80363f:	00 5d 09             	add    %bl,0x9(%rbp)
+  803642:	80 00 00             	addb   $0x0,(%rax)
+  803645:	00 00                	add    %al,(%rax)
+  803647:	00 27                	add    %ah,(%rdi)
+  803649:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80364f:	00 77 0b             	add    %dh,0xb(%rdi)
+  803652:	80 00 00             	addb   $0x0,(%rax)
+  803655:	00 00                	add    %al,(%rax)
+  803657:	00 77 0b             	add    %dh,0xb(%rdi)
+  80365a:	80 00 00             	addb   $0x0,(%rax)
+  80365d:	00 00                	add    %al,(%rax)
+  80365f:	00 ac 06 80 00 00 00 	add    %ch,0x80(%rsi,%rax,1)
+  803666:	00 00                	add    %al,(%rax)
+  803668:	77 0b                	ja     803675 <__rodata_start+0x4fd>
+  80366a:	80 00 00             	addb   $0x0,(%rax)
+  80366d:	00 00                	add    %al,(%rax)
+  80366f:	00 89 08 80 00 00    	add    %cl,0x8008(%rcx)
+  803675:	00 00                	add    %al,(%rax)
+  803677:	00 77 0b             	add    %dh,0xb(%rdi)
+  80367a:	80 00 00             	addb   $0x0,(%rax)
+  80367d:	00 00                	add    %al,(%rax)
+  80367f:	00 77 0b             	add    %dh,0xb(%rdi)
+  803682:	80 00 00             	addb   $0x0,(%rax)
+  803685:	00 00                	add    %al,(%rax)
+  803687:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  80368d:	00 00                	add    %al,(%rax)
+  80368f:	00 77 0b             	add    %dh,0xb(%rdi)
+  803692:	80 00 00             	addb   $0x0,(%rax)
+  803695:	00 00                	add    %al,(%rax)
+  803697:	00 3f                	add    %bh,(%rdi)
+  803699:	05 80 00 00 00       	add    $0x80,%eax
+	...
+
+00000000008036a0 <error_string>:
+	...
+  8036a8:	55 32 80 00 00 00 00 00 67 32 80 00 00 00 00 00     U2......g2......
+  8036b8:	77 32 80 00 00 00 00 00 89 32 80 00 00 00 00 00     w2.......2......
+  8036c8:	97 32 80 00 00 00 00 00 ab 32 80 00 00 00 00 00     .2.......2......
+  8036d8:	c0 32 80 00 00 00 00 00 d3 32 80 00 00 00 00 00     .2.......2......
+  8036e8:	e5 32 80 00 00 00 00 00 f9 32 80 00 00 00 00 00     .2.......2......
+  8036f8:	09 33 80 00 00 00 00 00 1c 33 80 00 00 00 00 00     .3.......3......
+  803708:	33 33 80 00 00 00 00 00 49 33 80 00 00 00 00 00     33......I3......
+  803718:	61 33 80 00 00 00 00 00 79 33 80 00 00 00 00 00     a3......y3......
+  803728:	86 33 80 00 00 00 00 00 50 37 80 00 00 00 00 00     .3......P7......
+  803738:	9a 33 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .3..............
+  803748:	b2 33 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .3......file is 
+  803758:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803768:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803778:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803788:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803798:	6c 6c 2e 63 00 0f 1f 00 55 73 65 72 73 70 61 63     ll.c....Userspac
+  8037a8:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  8037b8:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8037c8:	65 72 72 3d 25 78 0a 00 61 64 64 5f 70 67 66 61     err=%x..add_pgfa
+  8037d8:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  8037e8:	5f 61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61     _alloc_region fa
+  8037f8:	69 6c 65 64 00 00 00 00 61 64 64 5f 70 67 66 61     iled....add_pgfa
+  803808:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  803818:	5f 65 6e 76 5f 73 65 74 5f 70 67 66 61 75 6c 74     _env_set_pgfault
+  803828:	5f 75 70 63 61 6c 6c 20 66 61 69 6c 65 64 00 6c     _upcall failed.l
+  803838:	69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65 74     ib/pgfault.c.set
+  803848:	5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65 72     _pgfault_handler
+  803858:	3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72 5f     : %i._pfhandler_
+  803868:	69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00 61     inititiallized.a
+  803878:	73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65 64 3a     ssertion failed:
+  803888:	20 25 73 00 0f 1f 40 00 5b 25 30 38 78 5d 20 75      %s...@.[%08x] u
+  803898:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8038a8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8038b8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8038c8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8038d8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8038e8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8038f8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803908:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803918:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000803920 <devtab>:
+  803920:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803930:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803940:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  803950:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  803960:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  803970:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 0f 1f 40 00     _SIZE) == 2...@.
+  803980:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  803990:	20 62 65 67 69 6e 20 67 65 6e 65 72 69 63 20 68      begin generic h
+  8039a0:	61 6e 64 6c 65 72 20 66 6f 72 20 25 64 0a 00 00     andler for %d...
+  8039b0:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  8039c0:	20 65 78 69 74 69 6e 67 20 64 75 65 20 74 6f 20      exiting due to 
+  8039d0:	73 69 67 6e 61 6c 20 25 64 0a 00 00 00 00 00 00     signal %d.......
+  8039e0:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  8039f0:	20 69 67 6e 6f 72 69 6e 67 20 73 69 67 6e 61 6c      ignoring signal
+  803a00:	20 25 64 0a 00 00 00 00 73 69 67 6e 61 6c 73 3a      %d.....signals:
+  803a10:	20 65 6e 76 20 25 78 3a 20 65 6e 64 20 67 65 6e      env %x: end gen
+  803a20:	65 72 69 63 20 68 61 6e 64 6c 65 72 20 66 6f 72     eric handler for
+  803a30:	20 25 64 0a 00 66 61 6c 73 65 00 6c 69 62 2f 73      %d..false.lib/s
+  803a40:	69 67 6e 61 6c 2e 63 00 3c 63 6f 6e 73 3e 00 63     ignal.c.<cons>.c
+  803a50:	6f 6e 73 00 69 70 63 5f 73 65 6e 64 3a 20 66 61     ons.ipc_send: fa
+  803a60:	69 6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62     iled to send.lib
+  803a70:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  803a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
@@ -0,0 +1,6301 @@
+
+obj/user/faultallocbad:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ea 00 00 00       	call   80010d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+ * doesn't work because we sys_cputs instead of cprintf (exercise: why?) */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+    void *addr = (void *)utf->utf_fault_va;
+  80002e:	48 8b 1f             	mov    (%rdi),%rbx
+
+    cprintf("fault %lx\n", (unsigned long)addr);
+  800031:	48 89 de             	mov    %rbx,%rsi
+  800034:	48 bf 50 31 80 00 00 	movabs $0x803150,%rdi
+  80003b:	00 00 00 
+  80003e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800043:	48 ba 27 03 80 00 00 	movabs $0x800327,%rdx
+  80004a:	00 00 00 
+  80004d:	ff d2                	call   *%rdx
+    if ((r = sys_alloc_region(0, ROUNDDOWN(addr, PAGE_SIZE),
+  80004f:	48 89 de             	mov    %rbx,%rsi
+  800052:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  800059:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80005e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800063:	bf 00 00 00 00       	mov    $0x0,%edi
+  800068:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	85 c0                	test   %eax,%eax
+  800076:	78 32                	js     8000aa <handler+0x85>
+                              PAGE_SIZE, PROT_RW)) < 0)
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+    snprintf((char *)addr, 100, "this string was faulted in at %lx", (unsigned long)addr);
+  800078:	48 89 d9             	mov    %rbx,%rcx
+  80007b:	48 ba a0 31 80 00 00 	movabs $0x8031a0,%rdx
+  800082:	00 00 00 
+  800085:	be 64 00 00 00       	mov    $0x64,%esi
+  80008a:	48 89 df             	mov    %rbx,%rdi
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	49 b8 d1 0b 80 00 00 	movabs $0x800bd1,%r8
+  800099:	00 00 00 
+  80009c:	41 ff d0             	call   *%r8
+    return 1;
+}
+  80009f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+  8000aa:	41 89 c0             	mov    %eax,%r8d
+  8000ad:	48 89 d9             	mov    %rbx,%rcx
+  8000b0:	48 ba 70 31 80 00 00 	movabs $0x803170,%rdx
+  8000b7:	00 00 00 
+  8000ba:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000bf:	48 bf 5b 31 80 00 00 	movabs $0x80315b,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	49 b9 d7 01 80 00 00 	movabs $0x8001d7,%r9
+  8000d5:	00 00 00 
+  8000d8:	41 ff d1             	call   *%r9
+
+00000000008000db <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000db:	55                   	push   %rbp
+  8000dc:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(handler);
+  8000df:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  8000e6:	00 00 00 
+  8000e9:	48 b8 28 18 80 00 00 	movabs $0x801828,%rax
+  8000f0:	00 00 00 
+  8000f3:	ff d0                	call   *%rax
+    sys_cputs((char *)0xDEADBEEF, 4);
+  8000f5:	be 04 00 00 00       	mov    $0x4,%esi
+  8000fa:	bf ef be ad de       	mov    $0xdeadbeef,%edi
+  8000ff:	48 b8 73 10 80 00 00 	movabs $0x801073,%rax
+  800106:	00 00 00 
+  800109:	ff d0                	call   *%rax
+}
+  80010b:	5d                   	pop    %rbp
+  80010c:	c3                   	ret
+
+000000000080010d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80010d:	55                   	push   %rbp
+  80010e:	48 89 e5             	mov    %rsp,%rbp
+  800111:	41 56                	push   %r14
+  800113:	41 55                	push   %r13
+  800115:	41 54                	push   %r12
+  800117:	53                   	push   %rbx
+  800118:	41 89 fd             	mov    %edi,%r13d
+  80011b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80011e:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800125:	00 00 00 
+  800128:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80012f:	00 00 00 
+  800132:	48 39 c2             	cmp    %rax,%rdx
+  800135:	73 17                	jae    80014e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800137:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80013a:	49 89 c4             	mov    %rax,%r12
+  80013d:	48 83 c3 08          	add    $0x8,%rbx
+  800141:	b8 00 00 00 00       	mov    $0x0,%eax
+  800146:	ff 53 f8             	call   *-0x8(%rbx)
+  800149:	4c 39 e3             	cmp    %r12,%rbx
+  80014c:	72 ef                	jb     80013d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  80014e:	48 b8 3c 11 80 00 00 	movabs $0x80113c,%rax
+  800155:	00 00 00 
+  800158:	ff d0                	call   *%rax
+  80015a:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  80015d:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800164:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80016b:	00 00 00 
+  80016e:	48 01 d0             	add    %rdx,%rax
+  800171:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800178:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80017b:	45 85 ed             	test   %r13d,%r13d
+  80017e:	7e 0d                	jle    80018d <libmain+0x80>
+  800180:	49 8b 06             	mov    (%r14),%rax
+  800183:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80018a:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80018d:	4c 89 f6             	mov    %r14,%rsi
+  800190:	44 89 ef             	mov    %r13d,%edi
+  800193:	48 b8 db 00 80 00 00 	movabs $0x8000db,%rax
+  80019a:	00 00 00 
+  80019d:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80019f:	48 b8 b4 01 80 00 00 	movabs $0x8001b4,%rax
+  8001a6:	00 00 00 
+  8001a9:	ff d0                	call   *%rax
+#endif
+}
+  8001ab:	5b                   	pop    %rbx
+  8001ac:	41 5c                	pop    %r12
+  8001ae:	41 5d                	pop    %r13
+  8001b0:	41 5e                	pop    %r14
+  8001b2:	5d                   	pop    %rbp
+  8001b3:	c3                   	ret
+
+00000000008001b4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001b4:	55                   	push   %rbp
+  8001b5:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001b8:	48 b8 41 1d 80 00 00 	movabs $0x801d41,%rax
+  8001bf:	00 00 00 
+  8001c2:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c9:	48 b8 d1 10 80 00 00 	movabs $0x8010d1,%rax
+  8001d0:	00 00 00 
+  8001d3:	ff d0                	call   *%rax
+}
+  8001d5:	5d                   	pop    %rbp
+  8001d6:	c3                   	ret
+
+00000000008001d7 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8001d7:	55                   	push   %rbp
+  8001d8:	48 89 e5             	mov    %rsp,%rbp
+  8001db:	41 56                	push   %r14
+  8001dd:	41 55                	push   %r13
+  8001df:	41 54                	push   %r12
+  8001e1:	53                   	push   %rbx
+  8001e2:	48 83 ec 50          	sub    $0x50,%rsp
+  8001e6:	49 89 fc             	mov    %rdi,%r12
+  8001e9:	41 89 f5             	mov    %esi,%r13d
+  8001ec:	48 89 d3             	mov    %rdx,%rbx
+  8001ef:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8001f3:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8001f7:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8001fb:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800202:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800206:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80020a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80020e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800212:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800219:	00 00 00 
+  80021c:	4c 8b 30             	mov    (%rax),%r14
+  80021f:	48 b8 3c 11 80 00 00 	movabs $0x80113c,%rax
+  800226:	00 00 00 
+  800229:	ff d0                	call   *%rax
+  80022b:	89 c6                	mov    %eax,%esi
+  80022d:	45 89 e8             	mov    %r13d,%r8d
+  800230:	4c 89 e1             	mov    %r12,%rcx
+  800233:	4c 89 f2             	mov    %r14,%rdx
+  800236:	48 bf d0 31 80 00 00 	movabs $0x8031d0,%rdi
+  80023d:	00 00 00 
+  800240:	b8 00 00 00 00       	mov    $0x0,%eax
+  800245:	49 bc 27 03 80 00 00 	movabs $0x800327,%r12
+  80024c:	00 00 00 
+  80024f:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800252:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800256:	48 89 df             	mov    %rbx,%rdi
+  800259:	48 b8 c3 02 80 00 00 	movabs $0x8002c3,%rax
+  800260:	00 00 00 
+  800263:	ff d0                	call   *%rax
+    cprintf("\n");
+  800265:	48 bf ab 38 80 00 00 	movabs $0x8038ab,%rdi
+  80026c:	00 00 00 
+  80026f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800274:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800277:	cc                   	int3
+  800278:	eb fd                	jmp    800277 <_panic+0xa0>
+
+000000000080027a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80027a:	55                   	push   %rbp
+  80027b:	48 89 e5             	mov    %rsp,%rbp
+  80027e:	53                   	push   %rbx
+  80027f:	48 83 ec 08          	sub    $0x8,%rsp
+  800283:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800286:	8b 06                	mov    (%rsi),%eax
+  800288:	8d 50 01             	lea    0x1(%rax),%edx
+  80028b:	89 16                	mov    %edx,(%rsi)
+  80028d:	48 98                	cltq
+  80028f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800294:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80029a:	74 0a                	je     8002a6 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80029c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002a4:	c9                   	leave
+  8002a5:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002a6:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002aa:	be ff 00 00 00       	mov    $0xff,%esi
+  8002af:	48 b8 73 10 80 00 00 	movabs $0x801073,%rax
+  8002b6:	00 00 00 
+  8002b9:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002bb:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002c1:	eb d9                	jmp    80029c <putch+0x22>
+
+00000000008002c3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002c3:	55                   	push   %rbp
+  8002c4:	48 89 e5             	mov    %rsp,%rbp
+  8002c7:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002ce:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002d1:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002d8:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002e5:	48 89 f1             	mov    %rsi,%rcx
+  8002e8:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002ef:	48 bf 7a 02 80 00 00 	movabs $0x80027a,%rdi
+  8002f6:	00 00 00 
+  8002f9:	48 b8 77 04 80 00 00 	movabs $0x800477,%rax
+  800300:	00 00 00 
+  800303:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800305:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80030c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800313:	48 b8 73 10 80 00 00 	movabs $0x801073,%rax
+  80031a:	00 00 00 
+  80031d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80031f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800325:	c9                   	leave
+  800326:	c3                   	ret
+
+0000000000800327 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800327:	55                   	push   %rbp
+  800328:	48 89 e5             	mov    %rsp,%rbp
+  80032b:	48 83 ec 50          	sub    $0x50,%rsp
+  80032f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800333:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800337:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80033b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80033f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800343:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80034a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80034e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800352:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800356:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80035a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80035e:	48 b8 c3 02 80 00 00 	movabs $0x8002c3,%rax
+  800365:	00 00 00 
+  800368:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80036a:	c9                   	leave
+  80036b:	c3                   	ret
+
+000000000080036c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80036c:	55                   	push   %rbp
+  80036d:	48 89 e5             	mov    %rsp,%rbp
+  800370:	41 57                	push   %r15
+  800372:	41 56                	push   %r14
+  800374:	41 55                	push   %r13
+  800376:	41 54                	push   %r12
+  800378:	53                   	push   %rbx
+  800379:	48 83 ec 18          	sub    $0x18,%rsp
+  80037d:	49 89 fc             	mov    %rdi,%r12
+  800380:	49 89 f5             	mov    %rsi,%r13
+  800383:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800387:	8b 45 10             	mov    0x10(%rbp),%eax
+  80038a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80038d:	41 89 cf             	mov    %ecx,%r15d
+  800390:	4c 39 fa             	cmp    %r15,%rdx
+  800393:	73 5b                	jae    8003f0 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800395:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800399:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80039d:	85 db                	test   %ebx,%ebx
+  80039f:	7e 0e                	jle    8003af <print_num+0x43>
+            putch(padc, put_arg);
+  8003a1:	4c 89 ee             	mov    %r13,%rsi
+  8003a4:	44 89 f7             	mov    %r14d,%edi
+  8003a7:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003aa:	83 eb 01             	sub    $0x1,%ebx
+  8003ad:	75 f2                	jne    8003a1 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003af:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003b3:	48 b9 04 32 80 00 00 	movabs $0x803204,%rcx
+  8003ba:	00 00 00 
+  8003bd:	48 b8 f3 31 80 00 00 	movabs $0x8031f3,%rax
+  8003c4:	00 00 00 
+  8003c7:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003d4:	49 f7 f7             	div    %r15
+  8003d7:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003db:	4c 89 ee             	mov    %r13,%rsi
+  8003de:	41 ff d4             	call   *%r12
+}
+  8003e1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003e5:	5b                   	pop    %rbx
+  8003e6:	41 5c                	pop    %r12
+  8003e8:	41 5d                	pop    %r13
+  8003ea:	41 5e                	pop    %r14
+  8003ec:	41 5f                	pop    %r15
+  8003ee:	5d                   	pop    %rbp
+  8003ef:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003f9:	49 f7 f7             	div    %r15
+  8003fc:	48 83 ec 08          	sub    $0x8,%rsp
+  800400:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800404:	52                   	push   %rdx
+  800405:	45 0f be c9          	movsbl %r9b,%r9d
+  800409:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80040d:	48 89 c2             	mov    %rax,%rdx
+  800410:	48 b8 6c 03 80 00 00 	movabs $0x80036c,%rax
+  800417:	00 00 00 
+  80041a:	ff d0                	call   *%rax
+  80041c:	48 83 c4 10          	add    $0x10,%rsp
+  800420:	eb 8d                	jmp    8003af <print_num+0x43>
+
+0000000000800422 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800422:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800426:	48 8b 06             	mov    (%rsi),%rax
+  800429:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80042d:	73 0a                	jae    800439 <sprintputch+0x17>
+        *state->start++ = ch;
+  80042f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800433:	48 89 16             	mov    %rdx,(%rsi)
+  800436:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800439:	c3                   	ret
+
+000000000080043a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80043a:	55                   	push   %rbp
+  80043b:	48 89 e5             	mov    %rsp,%rbp
+  80043e:	48 83 ec 50          	sub    $0x50,%rsp
+  800442:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800446:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80044a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80044e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800455:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800459:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80045d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800461:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800465:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800469:	48 b8 77 04 80 00 00 	movabs $0x800477,%rax
+  800470:	00 00 00 
+  800473:	ff d0                	call   *%rax
+}
+  800475:	c9                   	leave
+  800476:	c3                   	ret
+
+0000000000800477 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800477:	55                   	push   %rbp
+  800478:	48 89 e5             	mov    %rsp,%rbp
+  80047b:	41 57                	push   %r15
+  80047d:	41 56                	push   %r14
+  80047f:	41 55                	push   %r13
+  800481:	41 54                	push   %r12
+  800483:	53                   	push   %rbx
+  800484:	48 83 ec 38          	sub    $0x38,%rsp
+  800488:	49 89 fe             	mov    %rdi,%r14
+  80048b:	49 89 f5             	mov    %rsi,%r13
+  80048e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800491:	48 8b 01             	mov    (%rcx),%rax
+  800494:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800498:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80049c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a0:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004a4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004a8:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004ac:	0f b6 3b             	movzbl (%rbx),%edi
+  8004af:	40 80 ff 25          	cmp    $0x25,%dil
+  8004b3:	74 18                	je     8004cd <vprintfmt+0x56>
+            if (!ch) return;
+  8004b5:	40 84 ff             	test   %dil,%dil
+  8004b8:	0f 84 b1 06 00 00    	je     800b6f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004be:	40 0f b6 ff          	movzbl %dil,%edi
+  8004c2:	4c 89 ee             	mov    %r13,%rsi
+  8004c5:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004c8:	4c 89 e3             	mov    %r12,%rbx
+  8004cb:	eb db                	jmp    8004a8 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8004d2:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004d6:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004db:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004e1:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004e8:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004ec:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004f1:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004f6:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004f9:	83 e8 23             	sub    $0x23,%eax
+  8004fc:	3c 57                	cmp    $0x57,%al
+  8004fe:	0f 87 51 06 00 00    	ja     800b55 <vprintfmt+0x6de>
+  800504:	0f b6 c0             	movzbl %al,%eax
+  800507:	48 b9 a0 33 80 00 00 	movabs $0x8033a0,%rcx
+  80050e:	00 00 00 
+  800511:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800514:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800517:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80051b:	eb cf                	jmp    8004ec <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80051d:	49 89 dc             	mov    %rbx,%r12
+  800520:	be 01 00 00 00       	mov    $0x1,%esi
+  800525:	eb c5                	jmp    8004ec <vprintfmt+0x75>
+            padc = ch;
+  800527:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80052b:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80052e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800531:	eb b9                	jmp    8004ec <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800533:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800536:	83 f8 2f             	cmp    $0x2f,%eax
+  800539:	77 24                	ja     80055f <vprintfmt+0xe8>
+  80053b:	89 c1                	mov    %eax,%ecx
+  80053d:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800541:	83 c0 08             	add    $0x8,%eax
+  800544:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800547:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80054a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80054d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800551:	79 99                	jns    8004ec <vprintfmt+0x75>
+                width = precision;
+  800553:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800557:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80055d:	eb 8d                	jmp    8004ec <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80055f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800563:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800567:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80056b:	eb da                	jmp    800547 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80056d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800572:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800576:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80057c:	3c 39                	cmp    $0x39,%al
+  80057e:	77 1c                	ja     80059c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800580:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800584:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800588:	0f b6 c0             	movzbl %al,%eax
+  80058b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800590:	0f b6 03             	movzbl (%rbx),%eax
+  800593:	3c 39                	cmp    $0x39,%al
+  800595:	76 e9                	jbe    800580 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800597:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80059a:	eb b1                	jmp    80054d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80059c:	49 89 dc             	mov    %rbx,%r12
+  80059f:	eb ac                	jmp    80054d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005a1:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005a4:	85 c9                	test   %ecx,%ecx
+  8005a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ab:	0f 49 c1             	cmovns %ecx,%eax
+  8005ae:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005b1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005b4:	e9 33 ff ff ff       	jmp    8004ec <vprintfmt+0x75>
+            lflag++;
+  8005b9:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005bc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005bf:	e9 28 ff ff ff       	jmp    8004ec <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ca:	77 19                	ja     8005e5 <vprintfmt+0x16e>
+  8005cc:	89 c2                	mov    %eax,%edx
+  8005ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005d2:	83 c0 08             	add    $0x8,%eax
+  8005d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005d8:	8b 3a                	mov    (%rdx),%edi
+  8005da:	4c 89 ee             	mov    %r13,%rsi
+  8005dd:	41 ff d6             	call   *%r14
+            break;
+  8005e0:	e9 c3 fe ff ff       	jmp    8004a8 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005f1:	eb e5                	jmp    8005d8 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8005f9:	77 5a                	ja     800655 <vprintfmt+0x1de>
+  8005fb:	89 c2                	mov    %eax,%edx
+  8005fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800601:	83 c0 08             	add    $0x8,%eax
+  800604:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800607:	8b 02                	mov    (%rdx),%eax
+  800609:	89 c1                	mov    %eax,%ecx
+  80060b:	f7 d9                	neg    %ecx
+  80060d:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800610:	83 f9 15             	cmp    $0x15,%ecx
+  800613:	7f 4e                	jg     800663 <vprintfmt+0x1ec>
+  800615:	48 63 c1             	movslq %ecx,%rax
+  800618:	48 ba 60 36 80 00 00 	movabs $0x803660,%rdx
+  80061f:	00 00 00 
+  800622:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800626:	48 85 c0             	test   %rax,%rax
+  800629:	74 38                	je     800663 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80062b:	48 89 c1             	mov    %rax,%rcx
+  80062e:	48 ba 49 38 80 00 00 	movabs $0x803849,%rdx
+  800635:	00 00 00 
+  800638:	4c 89 ee             	mov    %r13,%rsi
+  80063b:	4c 89 f7             	mov    %r14,%rdi
+  80063e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800643:	49 b8 3a 04 80 00 00 	movabs $0x80043a,%r8
+  80064a:	00 00 00 
+  80064d:	41 ff d0             	call   *%r8
+  800650:	e9 53 fe ff ff       	jmp    8004a8 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800655:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800659:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80065d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800661:	eb a4                	jmp    800607 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800663:	48 ba 1c 32 80 00 00 	movabs $0x80321c,%rdx
+  80066a:	00 00 00 
+  80066d:	4c 89 ee             	mov    %r13,%rsi
+  800670:	4c 89 f7             	mov    %r14,%rdi
+  800673:	b8 00 00 00 00       	mov    $0x0,%eax
+  800678:	49 b8 3a 04 80 00 00 	movabs $0x80043a,%r8
+  80067f:	00 00 00 
+  800682:	41 ff d0             	call   *%r8
+  800685:	e9 1e fe ff ff       	jmp    8004a8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80068a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068d:	83 f8 2f             	cmp    $0x2f,%eax
+  800690:	77 6c                	ja     8006fe <vprintfmt+0x287>
+  800692:	89 c2                	mov    %eax,%edx
+  800694:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800698:	83 c0 08             	add    $0x8,%eax
+  80069b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80069e:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006a1:	48 85 d2             	test   %rdx,%rdx
+  8006a4:	48 b8 15 32 80 00 00 	movabs $0x803215,%rax
+  8006ab:	00 00 00 
+  8006ae:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006b2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006b6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006ba:	7e 06                	jle    8006c2 <vprintfmt+0x24b>
+  8006bc:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006c0:	75 4a                	jne    80070c <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006c2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006c6:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006ca:	0f b6 00             	movzbl (%rax),%eax
+  8006cd:	84 c0                	test   %al,%al
+  8006cf:	0f 85 9a 00 00 00    	jne    80076f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8006d5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006d8:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006dc:	85 c0                	test   %eax,%eax
+  8006de:	0f 8e c4 fd ff ff    	jle    8004a8 <vprintfmt+0x31>
+  8006e4:	4c 89 ee             	mov    %r13,%rsi
+  8006e7:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006ec:	41 ff d6             	call   *%r14
+  8006ef:	41 83 ec 01          	sub    $0x1,%r12d
+  8006f3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006f7:	75 eb                	jne    8006e4 <vprintfmt+0x26d>
+  8006f9:	e9 aa fd ff ff       	jmp    8004a8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800702:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800706:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070a:	eb 92                	jmp    80069e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80070c:	49 63 f7             	movslq %r15d,%rsi
+  80070f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800713:	48 b8 29 0c 80 00 00 	movabs $0x800c29,%rax
+  80071a:	00 00 00 
+  80071d:	ff d0                	call   *%rax
+  80071f:	48 89 c2             	mov    %rax,%rdx
+  800722:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800725:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800727:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80072a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80072d:	85 c0                	test   %eax,%eax
+  80072f:	7e 91                	jle    8006c2 <vprintfmt+0x24b>
+  800731:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800736:	4c 89 ee             	mov    %r13,%rsi
+  800739:	44 89 e7             	mov    %r12d,%edi
+  80073c:	41 ff d6             	call   *%r14
+  80073f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800743:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800746:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800749:	75 eb                	jne    800736 <vprintfmt+0x2bf>
+  80074b:	e9 72 ff ff ff       	jmp    8006c2 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800750:	0f b6 f8             	movzbl %al,%edi
+  800753:	4c 89 ee             	mov    %r13,%rsi
+  800756:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800759:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80075d:	49 83 c4 01          	add    $0x1,%r12
+  800761:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800767:	84 c0                	test   %al,%al
+  800769:	0f 84 66 ff ff ff    	je     8006d5 <vprintfmt+0x25e>
+  80076f:	45 85 ff             	test   %r15d,%r15d
+  800772:	78 0a                	js     80077e <vprintfmt+0x307>
+  800774:	41 83 ef 01          	sub    $0x1,%r15d
+  800778:	0f 88 57 ff ff ff    	js     8006d5 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80077e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800782:	74 cc                	je     800750 <vprintfmt+0x2d9>
+  800784:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800787:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80078c:	80 fa 5e             	cmp    $0x5e,%dl
+  80078f:	77 c2                	ja     800753 <vprintfmt+0x2dc>
+  800791:	eb bd                	jmp    800750 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800793:	40 84 f6             	test   %sil,%sil
+  800796:	75 26                	jne    8007be <vprintfmt+0x347>
+    switch (lflag) {
+  800798:	85 d2                	test   %edx,%edx
+  80079a:	74 59                	je     8007f5 <vprintfmt+0x37e>
+  80079c:	83 fa 01             	cmp    $0x1,%edx
+  80079f:	74 7b                	je     80081c <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a7:	0f 87 96 00 00 00    	ja     800843 <vprintfmt+0x3cc>
+  8007ad:	89 c2                	mov    %eax,%edx
+  8007af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b3:	83 c0 08             	add    $0x8,%eax
+  8007b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b9:	4c 8b 22             	mov    (%rdx),%r12
+  8007bc:	eb 17                	jmp    8007d5 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c4:	77 21                	ja     8007e7 <vprintfmt+0x370>
+  8007c6:	89 c2                	mov    %eax,%edx
+  8007c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007cc:	83 c0 08             	add    $0x8,%eax
+  8007cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d2:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007d5:	4d 85 e4             	test   %r12,%r12
+  8007d8:	78 7a                	js     800854 <vprintfmt+0x3dd>
+            num = i;
+  8007da:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007dd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007e2:	e9 50 02 00 00       	jmp    800a37 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f3:	eb dd                	jmp    8007d2 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8007f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fb:	77 11                	ja     80080e <vprintfmt+0x397>
+  8007fd:	89 c2                	mov    %eax,%edx
+  8007ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800803:	83 c0 08             	add    $0x8,%eax
+  800806:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800809:	4c 63 22             	movslq (%rdx),%r12
+  80080c:	eb c7                	jmp    8007d5 <vprintfmt+0x35e>
+  80080e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800812:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800816:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081a:	eb ed                	jmp    800809 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80081c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081f:	83 f8 2f             	cmp    $0x2f,%eax
+  800822:	77 11                	ja     800835 <vprintfmt+0x3be>
+  800824:	89 c2                	mov    %eax,%edx
+  800826:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082a:	83 c0 08             	add    $0x8,%eax
+  80082d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800830:	4c 8b 22             	mov    (%rdx),%r12
+  800833:	eb a0                	jmp    8007d5 <vprintfmt+0x35e>
+  800835:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800839:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800841:	eb ed                	jmp    800830 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800843:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800847:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084f:	e9 65 ff ff ff       	jmp    8007b9 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800854:	4c 89 ee             	mov    %r13,%rsi
+  800857:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80085c:	41 ff d6             	call   *%r14
+                i = -i;
+  80085f:	49 f7 dc             	neg    %r12
+  800862:	e9 73 ff ff ff       	jmp    8007da <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800867:	40 84 f6             	test   %sil,%sil
+  80086a:	75 32                	jne    80089e <vprintfmt+0x427>
+    switch (lflag) {
+  80086c:	85 d2                	test   %edx,%edx
+  80086e:	74 5d                	je     8008cd <vprintfmt+0x456>
+  800870:	83 fa 01             	cmp    $0x1,%edx
+  800873:	0f 84 82 00 00 00    	je     8008fb <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800879:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087c:	83 f8 2f             	cmp    $0x2f,%eax
+  80087f:	0f 87 a5 00 00 00    	ja     80092a <vprintfmt+0x4b3>
+  800885:	89 c2                	mov    %eax,%edx
+  800887:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088b:	83 c0 08             	add    $0x8,%eax
+  80088e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800891:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800894:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800899:	e9 99 01 00 00       	jmp    800a37 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80089e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a4:	77 19                	ja     8008bf <vprintfmt+0x448>
+  8008a6:	89 c2                	mov    %eax,%edx
+  8008a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ac:	83 c0 08             	add    $0x8,%eax
+  8008af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008b5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008ba:	e9 78 01 00 00       	jmp    800a37 <vprintfmt+0x5c0>
+  8008bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cb:	eb e5                	jmp    8008b2 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d3:	77 18                	ja     8008ed <vprintfmt+0x476>
+  8008d5:	89 c2                	mov    %eax,%edx
+  8008d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008db:	83 c0 08             	add    $0x8,%eax
+  8008de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e1:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008e3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008e8:	e9 4a 01 00 00       	jmp    800a37 <vprintfmt+0x5c0>
+  8008ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f9:	eb e6                	jmp    8008e1 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8008fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800901:	77 19                	ja     80091c <vprintfmt+0x4a5>
+  800903:	89 c2                	mov    %eax,%edx
+  800905:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800909:	83 c0 08             	add    $0x8,%eax
+  80090c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800912:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800917:	e9 1b 01 00 00       	jmp    800a37 <vprintfmt+0x5c0>
+  80091c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800920:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800924:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800928:	eb e5                	jmp    80090f <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80092a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800932:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800936:	e9 56 ff ff ff       	jmp    800891 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80093b:	40 84 f6             	test   %sil,%sil
+  80093e:	75 2e                	jne    80096e <vprintfmt+0x4f7>
+    switch (lflag) {
+  800940:	85 d2                	test   %edx,%edx
+  800942:	74 59                	je     80099d <vprintfmt+0x526>
+  800944:	83 fa 01             	cmp    $0x1,%edx
+  800947:	74 7f                	je     8009c8 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800949:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094c:	83 f8 2f             	cmp    $0x2f,%eax
+  80094f:	0f 87 9f 00 00 00    	ja     8009f4 <vprintfmt+0x57d>
+  800955:	89 c2                	mov    %eax,%edx
+  800957:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095b:	83 c0 08             	add    $0x8,%eax
+  80095e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800961:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800964:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800969:	e9 c9 00 00 00       	jmp    800a37 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80096e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800971:	83 f8 2f             	cmp    $0x2f,%eax
+  800974:	77 19                	ja     80098f <vprintfmt+0x518>
+  800976:	89 c2                	mov    %eax,%edx
+  800978:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097c:	83 c0 08             	add    $0x8,%eax
+  80097f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800982:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800985:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80098a:	e9 a8 00 00 00       	jmp    800a37 <vprintfmt+0x5c0>
+  80098f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800993:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800997:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099b:	eb e5                	jmp    800982 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80099d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a3:	77 15                	ja     8009ba <vprintfmt+0x543>
+  8009a5:	89 c2                	mov    %eax,%edx
+  8009a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ab:	83 c0 08             	add    $0x8,%eax
+  8009ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b1:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8009b3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8009b8:	eb 7d                	jmp    800a37 <vprintfmt+0x5c0>
+  8009ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c6:	eb e9                	jmp    8009b1 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ce:	77 16                	ja     8009e6 <vprintfmt+0x56f>
+  8009d0:	89 c2                	mov    %eax,%edx
+  8009d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d6:	83 c0 08             	add    $0x8,%eax
+  8009d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009dc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009df:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8009e4:	eb 51                	jmp    800a37 <vprintfmt+0x5c0>
+  8009e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f2:	eb e8                	jmp    8009dc <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8009f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a00:	e9 5c ff ff ff       	jmp    800961 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a05:	4c 89 ee             	mov    %r13,%rsi
+  800a08:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a0d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a10:	4c 89 ee             	mov    %r13,%rsi
+  800a13:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a18:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a21:	77 47                	ja     800a6a <vprintfmt+0x5f3>
+  800a23:	89 c2                	mov    %eax,%edx
+  800a25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a29:	83 c0 08             	add    $0x8,%eax
+  800a2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a32:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a37:	48 83 ec 08          	sub    $0x8,%rsp
+  800a3b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a3f:	0f 94 c0             	sete   %al
+  800a42:	0f b6 c0             	movzbl %al,%eax
+  800a45:	50                   	push   %rax
+  800a46:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a4b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a4f:	4c 89 ee             	mov    %r13,%rsi
+  800a52:	4c 89 f7             	mov    %r14,%rdi
+  800a55:	48 b8 6c 03 80 00 00 	movabs $0x80036c,%rax
+  800a5c:	00 00 00 
+  800a5f:	ff d0                	call   *%rax
+            break;
+  800a61:	48 83 c4 10          	add    $0x10,%rsp
+  800a65:	e9 3e fa ff ff       	jmp    8004a8 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a76:	eb b7                	jmp    800a2f <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a78:	40 84 f6             	test   %sil,%sil
+  800a7b:	75 2b                	jne    800aa8 <vprintfmt+0x631>
+    switch (lflag) {
+  800a7d:	85 d2                	test   %edx,%edx
+  800a7f:	74 56                	je     800ad7 <vprintfmt+0x660>
+  800a81:	83 fa 01             	cmp    $0x1,%edx
+  800a84:	74 7f                	je     800b05 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a89:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8c:	0f 87 a2 00 00 00    	ja     800b34 <vprintfmt+0x6bd>
+  800a92:	89 c2                	mov    %eax,%edx
+  800a94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a98:	83 c0 08             	add    $0x8,%eax
+  800a9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aa1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800aa6:	eb 8f                	jmp    800a37 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aab:	83 f8 2f             	cmp    $0x2f,%eax
+  800aae:	77 19                	ja     800ac9 <vprintfmt+0x652>
+  800ab0:	89 c2                	mov    %eax,%edx
+  800ab2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab6:	83 c0 08             	add    $0x8,%eax
+  800ab9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800abf:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ac4:	e9 6e ff ff ff       	jmp    800a37 <vprintfmt+0x5c0>
+  800ac9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800acd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad5:	eb e5                	jmp    800abc <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800ad7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ada:	83 f8 2f             	cmp    $0x2f,%eax
+  800add:	77 18                	ja     800af7 <vprintfmt+0x680>
+  800adf:	89 c2                	mov    %eax,%edx
+  800ae1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae5:	83 c0 08             	add    $0x8,%eax
+  800ae8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aeb:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800aed:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800af2:	e9 40 ff ff ff       	jmp    800a37 <vprintfmt+0x5c0>
+  800af7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b03:	eb e6                	jmp    800aeb <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b08:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0b:	77 19                	ja     800b26 <vprintfmt+0x6af>
+  800b0d:	89 c2                	mov    %eax,%edx
+  800b0f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b13:	83 c0 08             	add    $0x8,%eax
+  800b16:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b19:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b1c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b21:	e9 11 ff ff ff       	jmp    800a37 <vprintfmt+0x5c0>
+  800b26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b32:	eb e5                	jmp    800b19 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b34:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b38:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b3c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b40:	e9 59 ff ff ff       	jmp    800a9e <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b45:	4c 89 ee             	mov    %r13,%rsi
+  800b48:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b4d:	41 ff d6             	call   *%r14
+            break;
+  800b50:	e9 53 f9 ff ff       	jmp    8004a8 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b55:	4c 89 ee             	mov    %r13,%rsi
+  800b58:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b5d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b60:	48 83 eb 01          	sub    $0x1,%rbx
+  800b64:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b68:	75 f6                	jne    800b60 <vprintfmt+0x6e9>
+  800b6a:	e9 39 f9 ff ff       	jmp    8004a8 <vprintfmt+0x31>
+}
+  800b6f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b73:	5b                   	pop    %rbx
+  800b74:	41 5c                	pop    %r12
+  800b76:	41 5d                	pop    %r13
+  800b78:	41 5e                	pop    %r14
+  800b7a:	41 5f                	pop    %r15
+  800b7c:	5d                   	pop    %rbp
+  800b7d:	c3                   	ret
+
+0000000000800b7e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b7e:	55                   	push   %rbp
+  800b7f:	48 89 e5             	mov    %rsp,%rbp
+  800b82:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b86:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b8a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b8f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b93:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b9a:	48 85 ff             	test   %rdi,%rdi
+  800b9d:	74 2b                	je     800bca <vsnprintf+0x4c>
+  800b9f:	48 85 f6             	test   %rsi,%rsi
+  800ba2:	74 26                	je     800bca <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ba4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ba8:	48 bf 22 04 80 00 00 	movabs $0x800422,%rdi
+  800baf:	00 00 00 
+  800bb2:	48 b8 77 04 80 00 00 	movabs $0x800477,%rax
+  800bb9:	00 00 00 
+  800bbc:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800bbe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bc2:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bc5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bc8:	c9                   	leave
+  800bc9:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bcf:	eb f7                	jmp    800bc8 <vsnprintf+0x4a>
+
+0000000000800bd1 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bd1:	55                   	push   %rbp
+  800bd2:	48 89 e5             	mov    %rsp,%rbp
+  800bd5:	48 83 ec 50          	sub    $0x50,%rsp
+  800bd9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800bdd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800be1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800be5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bec:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bf0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bf8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800bfc:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c00:	48 b8 7e 0b 80 00 00 	movabs $0x800b7e,%rax
+  800c07:	00 00 00 
+  800c0a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c0c:	c9                   	leave
+  800c0d:	c3                   	ret
+
+0000000000800c0e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c0e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c11:	74 10                	je     800c23 <strlen+0x15>
+    size_t n = 0;
+  800c13:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c18:	48 83 c0 01          	add    $0x1,%rax
+  800c1c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c20:	75 f6                	jne    800c18 <strlen+0xa>
+  800c22:	c3                   	ret
+    size_t n = 0;
+  800c23:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c28:	c3                   	ret
+
+0000000000800c29 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c29:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c2c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c31:	48 85 f6             	test   %rsi,%rsi
+  800c34:	74 11                	je     800c47 <strnlen+0x1e>
+  800c36:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c3a:	74 0c                	je     800c48 <strnlen+0x1f>
+  800c3c:	48 83 c2 01          	add    $0x1,%rdx
+  800c40:	48 39 d0             	cmp    %rdx,%rax
+  800c43:	75 f1                	jne    800c36 <strnlen+0xd>
+  800c45:	eb 04                	jmp    800c4b <strnlen+0x22>
+  800c47:	c3                   	ret
+  800c48:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c4b:	c3                   	ret
+
+0000000000800c4c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c4c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c54:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c58:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c5b:	48 83 c2 01          	add    $0x1,%rdx
+  800c5f:	84 c9                	test   %cl,%cl
+  800c61:	75 f1                	jne    800c54 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c63:	c3                   	ret
+
+0000000000800c64 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c64:	55                   	push   %rbp
+  800c65:	48 89 e5             	mov    %rsp,%rbp
+  800c68:	41 54                	push   %r12
+  800c6a:	53                   	push   %rbx
+  800c6b:	48 89 fb             	mov    %rdi,%rbx
+  800c6e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c71:	48 b8 0e 0c 80 00 00 	movabs $0x800c0e,%rax
+  800c78:	00 00 00 
+  800c7b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c7d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c81:	4c 89 e6             	mov    %r12,%rsi
+  800c84:	48 b8 4c 0c 80 00 00 	movabs $0x800c4c,%rax
+  800c8b:	00 00 00 
+  800c8e:	ff d0                	call   *%rax
+    return dst;
+}
+  800c90:	48 89 d8             	mov    %rbx,%rax
+  800c93:	5b                   	pop    %rbx
+  800c94:	41 5c                	pop    %r12
+  800c96:	5d                   	pop    %rbp
+  800c97:	c3                   	ret
+
+0000000000800c98 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c98:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c9b:	48 85 d2             	test   %rdx,%rdx
+  800c9e:	74 1f                	je     800cbf <strncpy+0x27>
+  800ca0:	48 01 fa             	add    %rdi,%rdx
+  800ca3:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ca6:	48 83 c1 01          	add    $0x1,%rcx
+  800caa:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cae:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800cb2:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cb6:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800cba:	48 39 ca             	cmp    %rcx,%rdx
+  800cbd:	75 e7                	jne    800ca6 <strncpy+0xe>
+    }
+    return ret;
+}
+  800cbf:	c3                   	ret
+
+0000000000800cc0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800cc0:	48 89 f8             	mov    %rdi,%rax
+  800cc3:	48 85 d2             	test   %rdx,%rdx
+  800cc6:	74 24                	je     800cec <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800cc8:	48 83 ea 01          	sub    $0x1,%rdx
+  800ccc:	74 1b                	je     800ce9 <strlcpy+0x29>
+  800cce:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cd2:	0f b6 16             	movzbl (%rsi),%edx
+  800cd5:	84 d2                	test   %dl,%dl
+  800cd7:	74 10                	je     800ce9 <strlcpy+0x29>
+            *dst++ = *src++;
+  800cd9:	48 83 c6 01          	add    $0x1,%rsi
+  800cdd:	48 83 c0 01          	add    $0x1,%rax
+  800ce1:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ce4:	48 39 c8             	cmp    %rcx,%rax
+  800ce7:	75 e9                	jne    800cd2 <strlcpy+0x12>
+        *dst = '\0';
+  800ce9:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cec:	48 29 f8             	sub    %rdi,%rax
+}
+  800cef:	c3                   	ret
+
+0000000000800cf0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800cf0:	0f b6 07             	movzbl (%rdi),%eax
+  800cf3:	84 c0                	test   %al,%al
+  800cf5:	74 13                	je     800d0a <strcmp+0x1a>
+  800cf7:	38 06                	cmp    %al,(%rsi)
+  800cf9:	75 0f                	jne    800d0a <strcmp+0x1a>
+  800cfb:	48 83 c7 01          	add    $0x1,%rdi
+  800cff:	48 83 c6 01          	add    $0x1,%rsi
+  800d03:	0f b6 07             	movzbl (%rdi),%eax
+  800d06:	84 c0                	test   %al,%al
+  800d08:	75 ed                	jne    800cf7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d0a:	0f b6 c0             	movzbl %al,%eax
+  800d0d:	0f b6 16             	movzbl (%rsi),%edx
+  800d10:	29 d0                	sub    %edx,%eax
+}
+  800d12:	c3                   	ret
+
+0000000000800d13 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d13:	48 85 d2             	test   %rdx,%rdx
+  800d16:	74 1f                	je     800d37 <strncmp+0x24>
+  800d18:	0f b6 07             	movzbl (%rdi),%eax
+  800d1b:	84 c0                	test   %al,%al
+  800d1d:	74 1e                	je     800d3d <strncmp+0x2a>
+  800d1f:	3a 06                	cmp    (%rsi),%al
+  800d21:	75 1a                	jne    800d3d <strncmp+0x2a>
+  800d23:	48 83 c7 01          	add    $0x1,%rdi
+  800d27:	48 83 c6 01          	add    $0x1,%rsi
+  800d2b:	48 83 ea 01          	sub    $0x1,%rdx
+  800d2f:	75 e7                	jne    800d18 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d36:	c3                   	ret
+  800d37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3c:	c3                   	ret
+  800d3d:	48 85 d2             	test   %rdx,%rdx
+  800d40:	74 09                	je     800d4b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d42:	0f b6 07             	movzbl (%rdi),%eax
+  800d45:	0f b6 16             	movzbl (%rsi),%edx
+  800d48:	29 d0                	sub    %edx,%eax
+  800d4a:	c3                   	ret
+    if (!n) return 0;
+  800d4b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d50:	c3                   	ret
+
+0000000000800d51 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d51:	0f b6 17             	movzbl (%rdi),%edx
+  800d54:	84 d2                	test   %dl,%dl
+  800d56:	74 18                	je     800d70 <strchr+0x1f>
+        if (*str == c) {
+  800d58:	0f be d2             	movsbl %dl,%edx
+  800d5b:	39 f2                	cmp    %esi,%edx
+  800d5d:	74 17                	je     800d76 <strchr+0x25>
+    for (; *str; str++) {
+  800d5f:	48 83 c7 01          	add    $0x1,%rdi
+  800d63:	0f b6 17             	movzbl (%rdi),%edx
+  800d66:	84 d2                	test   %dl,%dl
+  800d68:	75 ee                	jne    800d58 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d6f:	c3                   	ret
+  800d70:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d75:	c3                   	ret
+  800d76:	48 89 f8             	mov    %rdi,%rax
+}
+  800d79:	c3                   	ret
+
+0000000000800d7a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d7a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d7d:	0f b6 17             	movzbl (%rdi),%edx
+  800d80:	84 d2                	test   %dl,%dl
+  800d82:	74 13                	je     800d97 <strfind+0x1d>
+  800d84:	0f be d2             	movsbl %dl,%edx
+  800d87:	39 f2                	cmp    %esi,%edx
+  800d89:	74 0b                	je     800d96 <strfind+0x1c>
+  800d8b:	48 83 c0 01          	add    $0x1,%rax
+  800d8f:	0f b6 10             	movzbl (%rax),%edx
+  800d92:	84 d2                	test   %dl,%dl
+  800d94:	75 ee                	jne    800d84 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d96:	c3                   	ret
+  800d97:	c3                   	ret
+
+0000000000800d98 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d98:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d9b:	48 89 f8             	mov    %rdi,%rax
+  800d9e:	48 f7 d8             	neg    %rax
+  800da1:	83 e0 07             	and    $0x7,%eax
+  800da4:	49 89 d1             	mov    %rdx,%r9
+  800da7:	49 29 c1             	sub    %rax,%r9
+  800daa:	78 36                	js     800de2 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800dac:	40 0f b6 c6          	movzbl %sil,%eax
+  800db0:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800db7:	01 01 01 
+  800dba:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800dbe:	40 f6 c7 07          	test   $0x7,%dil
+  800dc2:	75 38                	jne    800dfc <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800dc4:	4c 89 c9             	mov    %r9,%rcx
+  800dc7:	48 c1 f9 03          	sar    $0x3,%rcx
+  800dcb:	74 0c                	je     800dd9 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800dcd:	fc                   	cld
+  800dce:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800dd1:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800dd5:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800dd9:	4d 85 c9             	test   %r9,%r9
+  800ddc:	75 45                	jne    800e23 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800dde:	4c 89 c0             	mov    %r8,%rax
+  800de1:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800de2:	48 85 d2             	test   %rdx,%rdx
+  800de5:	74 f7                	je     800dde <memset+0x46>
+  800de7:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800dea:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ded:	48 83 c0 01          	add    $0x1,%rax
+  800df1:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800df5:	48 39 c2             	cmp    %rax,%rdx
+  800df8:	75 f3                	jne    800ded <memset+0x55>
+  800dfa:	eb e2                	jmp    800dde <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800dfc:	40 f6 c7 01          	test   $0x1,%dil
+  800e00:	74 06                	je     800e08 <memset+0x70>
+  800e02:	88 07                	mov    %al,(%rdi)
+  800e04:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e08:	40 f6 c7 02          	test   $0x2,%dil
+  800e0c:	74 07                	je     800e15 <memset+0x7d>
+  800e0e:	66 89 07             	mov    %ax,(%rdi)
+  800e11:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e15:	40 f6 c7 04          	test   $0x4,%dil
+  800e19:	74 a9                	je     800dc4 <memset+0x2c>
+  800e1b:	89 07                	mov    %eax,(%rdi)
+  800e1d:	48 83 c7 04          	add    $0x4,%rdi
+  800e21:	eb a1                	jmp    800dc4 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e23:	41 f6 c1 04          	test   $0x4,%r9b
+  800e27:	74 06                	je     800e2f <memset+0x97>
+  800e29:	89 07                	mov    %eax,(%rdi)
+  800e2b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e2f:	41 f6 c1 02          	test   $0x2,%r9b
+  800e33:	74 07                	je     800e3c <memset+0xa4>
+  800e35:	66 89 07             	mov    %ax,(%rdi)
+  800e38:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e3c:	41 f6 c1 01          	test   $0x1,%r9b
+  800e40:	74 9c                	je     800dde <memset+0x46>
+  800e42:	88 07                	mov    %al,(%rdi)
+  800e44:	eb 98                	jmp    800dde <memset+0x46>
+
+0000000000800e46 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e46:	48 89 f8             	mov    %rdi,%rax
+  800e49:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e4c:	48 39 fe             	cmp    %rdi,%rsi
+  800e4f:	73 3b                	jae    800e8c <memmove+0x46>
+  800e51:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e55:	48 39 d7             	cmp    %rdx,%rdi
+  800e58:	73 32                	jae    800e8c <memmove+0x46>
+        s += n;
+        d += n;
+  800e5a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e5e:	48 89 d6             	mov    %rdx,%rsi
+  800e61:	48 09 fe             	or     %rdi,%rsi
+  800e64:	48 09 ce             	or     %rcx,%rsi
+  800e67:	40 f6 c6 07          	test   $0x7,%sil
+  800e6b:	75 12                	jne    800e7f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e6d:	48 83 ef 08          	sub    $0x8,%rdi
+  800e71:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e75:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e79:	fd                   	std
+  800e7a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e7d:	fc                   	cld
+  800e7e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e7f:	48 83 ef 01          	sub    $0x1,%rdi
+  800e83:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e87:	fd                   	std
+  800e88:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e8a:	eb f1                	jmp    800e7d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e8c:	48 89 f2             	mov    %rsi,%rdx
+  800e8f:	48 09 c2             	or     %rax,%rdx
+  800e92:	48 09 ca             	or     %rcx,%rdx
+  800e95:	f6 c2 07             	test   $0x7,%dl
+  800e98:	75 0c                	jne    800ea6 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e9a:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e9e:	48 89 c7             	mov    %rax,%rdi
+  800ea1:	fc                   	cld
+  800ea2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ea5:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ea6:	48 89 c7             	mov    %rax,%rdi
+  800ea9:	fc                   	cld
+  800eaa:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800eac:	c3                   	ret
+
+0000000000800ead <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800ead:	55                   	push   %rbp
+  800eae:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800eb1:	48 b8 46 0e 80 00 00 	movabs $0x800e46,%rax
+  800eb8:	00 00 00 
+  800ebb:	ff d0                	call   *%rax
+}
+  800ebd:	5d                   	pop    %rbp
+  800ebe:	c3                   	ret
+
+0000000000800ebf <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ebf:	55                   	push   %rbp
+  800ec0:	48 89 e5             	mov    %rsp,%rbp
+  800ec3:	41 57                	push   %r15
+  800ec5:	41 56                	push   %r14
+  800ec7:	41 55                	push   %r13
+  800ec9:	41 54                	push   %r12
+  800ecb:	53                   	push   %rbx
+  800ecc:	48 83 ec 08          	sub    $0x8,%rsp
+  800ed0:	49 89 fe             	mov    %rdi,%r14
+  800ed3:	49 89 f7             	mov    %rsi,%r15
+  800ed6:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800ed9:	48 89 f7             	mov    %rsi,%rdi
+  800edc:	48 b8 0e 0c 80 00 00 	movabs $0x800c0e,%rax
+  800ee3:	00 00 00 
+  800ee6:	ff d0                	call   *%rax
+  800ee8:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800eeb:	48 89 de             	mov    %rbx,%rsi
+  800eee:	4c 89 f7             	mov    %r14,%rdi
+  800ef1:	48 b8 29 0c 80 00 00 	movabs $0x800c29,%rax
+  800ef8:	00 00 00 
+  800efb:	ff d0                	call   *%rax
+  800efd:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f00:	48 39 c3             	cmp    %rax,%rbx
+  800f03:	74 36                	je     800f3b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f05:	48 89 d8             	mov    %rbx,%rax
+  800f08:	4c 29 e8             	sub    %r13,%rax
+  800f0b:	49 39 c4             	cmp    %rax,%r12
+  800f0e:	73 31                	jae    800f41 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f10:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f15:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f19:	4c 89 fe             	mov    %r15,%rsi
+  800f1c:	48 b8 ad 0e 80 00 00 	movabs $0x800ead,%rax
+  800f23:	00 00 00 
+  800f26:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f28:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f2c:	48 83 c4 08          	add    $0x8,%rsp
+  800f30:	5b                   	pop    %rbx
+  800f31:	41 5c                	pop    %r12
+  800f33:	41 5d                	pop    %r13
+  800f35:	41 5e                	pop    %r14
+  800f37:	41 5f                	pop    %r15
+  800f39:	5d                   	pop    %rbp
+  800f3a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f3b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f3f:	eb eb                	jmp    800f2c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f41:	48 83 eb 01          	sub    $0x1,%rbx
+  800f45:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f49:	48 89 da             	mov    %rbx,%rdx
+  800f4c:	4c 89 fe             	mov    %r15,%rsi
+  800f4f:	48 b8 ad 0e 80 00 00 	movabs $0x800ead,%rax
+  800f56:	00 00 00 
+  800f59:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f5b:	49 01 de             	add    %rbx,%r14
+  800f5e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f63:	eb c3                	jmp    800f28 <strlcat+0x69>
+
+0000000000800f65 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f65:	48 85 d2             	test   %rdx,%rdx
+  800f68:	74 2d                	je     800f97 <memcmp+0x32>
+  800f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f6f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f73:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f78:	44 38 c1             	cmp    %r8b,%cl
+  800f7b:	75 0f                	jne    800f8c <memcmp+0x27>
+    while (n-- > 0) {
+  800f7d:	48 83 c0 01          	add    $0x1,%rax
+  800f81:	48 39 c2             	cmp    %rax,%rdx
+  800f84:	75 e9                	jne    800f6f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f8c:	0f b6 c1             	movzbl %cl,%eax
+  800f8f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f93:	44 29 c0             	sub    %r8d,%eax
+  800f96:	c3                   	ret
+    return 0;
+  800f97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f9c:	c3                   	ret
+
+0000000000800f9d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f9d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800fa1:	48 39 c7             	cmp    %rax,%rdi
+  800fa4:	73 0f                	jae    800fb5 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800fa6:	40 38 37             	cmp    %sil,(%rdi)
+  800fa9:	74 0e                	je     800fb9 <memfind+0x1c>
+    for (; src < end; src++) {
+  800fab:	48 83 c7 01          	add    $0x1,%rdi
+  800faf:	48 39 f8             	cmp    %rdi,%rax
+  800fb2:	75 f2                	jne    800fa6 <memfind+0x9>
+  800fb4:	c3                   	ret
+  800fb5:	48 89 f8             	mov    %rdi,%rax
+  800fb8:	c3                   	ret
+  800fb9:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800fbc:	c3                   	ret
+
+0000000000800fbd <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800fbd:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fc0:	0f b6 37             	movzbl (%rdi),%esi
+  800fc3:	40 80 fe 20          	cmp    $0x20,%sil
+  800fc7:	74 06                	je     800fcf <strtol+0x12>
+  800fc9:	40 80 fe 09          	cmp    $0x9,%sil
+  800fcd:	75 13                	jne    800fe2 <strtol+0x25>
+  800fcf:	48 83 c7 01          	add    $0x1,%rdi
+  800fd3:	0f b6 37             	movzbl (%rdi),%esi
+  800fd6:	40 80 fe 20          	cmp    $0x20,%sil
+  800fda:	74 f3                	je     800fcf <strtol+0x12>
+  800fdc:	40 80 fe 09          	cmp    $0x9,%sil
+  800fe0:	74 ed                	je     800fcf <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800fe2:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800fe5:	83 e0 fd             	and    $0xfffffffd,%eax
+  800fe8:	3c 01                	cmp    $0x1,%al
+  800fea:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fee:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ff4:	75 0f                	jne    801005 <strtol+0x48>
+  800ff6:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ff9:	74 14                	je     80100f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ffb:	85 d2                	test   %edx,%edx
+  800ffd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801002:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801005:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80100a:	4c 63 ca             	movslq %edx,%r9
+  80100d:	eb 36                	jmp    801045 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80100f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801013:	74 0f                	je     801024 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801015:	85 d2                	test   %edx,%edx
+  801017:	75 ec                	jne    801005 <strtol+0x48>
+        s++;
+  801019:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80101d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801022:	eb e1                	jmp    801005 <strtol+0x48>
+        s += 2;
+  801024:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801028:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80102d:	eb d6                	jmp    801005 <strtol+0x48>
+            dig -= '0';
+  80102f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801032:	44 0f b6 c1          	movzbl %cl,%r8d
+  801036:	41 39 d0             	cmp    %edx,%r8d
+  801039:	7d 21                	jge    80105c <strtol+0x9f>
+        val = val * base + dig;
+  80103b:	49 0f af c1          	imul   %r9,%rax
+  80103f:	0f b6 c9             	movzbl %cl,%ecx
+  801042:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801045:	48 83 c7 01          	add    $0x1,%rdi
+  801049:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80104d:	80 f9 39             	cmp    $0x39,%cl
+  801050:	76 dd                	jbe    80102f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801052:	80 f9 7b             	cmp    $0x7b,%cl
+  801055:	77 05                	ja     80105c <strtol+0x9f>
+            dig -= 'a' - 10;
+  801057:	83 e9 57             	sub    $0x57,%ecx
+  80105a:	eb d6                	jmp    801032 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80105c:	4d 85 d2             	test   %r10,%r10
+  80105f:	74 03                	je     801064 <strtol+0xa7>
+  801061:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801064:	48 89 c2             	mov    %rax,%rdx
+  801067:	48 f7 da             	neg    %rdx
+  80106a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80106e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801072:	c3                   	ret
+
+0000000000801073 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801073:	55                   	push   %rbp
+  801074:	48 89 e5             	mov    %rsp,%rbp
+  801077:	53                   	push   %rbx
+  801078:	48 89 fa             	mov    %rdi,%rdx
+  80107b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80107e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801083:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801088:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80108d:	be 00 00 00 00       	mov    $0x0,%esi
+  801092:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801098:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80109a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80109e:	c9                   	leave
+  80109f:	c3                   	ret
+
+00000000008010a0 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010a0:	55                   	push   %rbp
+  8010a1:	48 89 e5             	mov    %rsp,%rbp
+  8010a4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010a5:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010af:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010be:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010c9:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010cf:	c9                   	leave
+  8010d0:	c3                   	ret
+
+00000000008010d1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8010d1:	55                   	push   %rbp
+  8010d2:	48 89 e5             	mov    %rsp,%rbp
+  8010d5:	53                   	push   %rbx
+  8010d6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010da:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010dd:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010fc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010fe:	48 85 c0             	test   %rax,%rax
+  801101:	7f 06                	jg     801109 <sys_env_destroy+0x38>
+}
+  801103:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801107:	c9                   	leave
+  801108:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801109:	49 89 c0             	mov    %rax,%r8
+  80110c:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801111:	48 ba 30 37 80 00 00 	movabs $0x803730,%rdx
+  801118:	00 00 00 
+  80111b:	be 26 00 00 00       	mov    $0x26,%esi
+  801120:	48 bf 4f 37 80 00 00 	movabs $0x80374f,%rdi
+  801127:	00 00 00 
+  80112a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80112f:	49 b9 d7 01 80 00 00 	movabs $0x8001d7,%r9
+  801136:	00 00 00 
+  801139:	41 ff d1             	call   *%r9
+
+000000000080113c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80113c:	55                   	push   %rbp
+  80113d:	48 89 e5             	mov    %rsp,%rbp
+  801140:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801141:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801146:	ba 00 00 00 00       	mov    $0x0,%edx
+  80114b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801150:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801155:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80115a:	be 00 00 00 00       	mov    $0x0,%esi
+  80115f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801165:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801167:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80116b:	c9                   	leave
+  80116c:	c3                   	ret
+
+000000000080116d <sys_yield>:
+
+void
+sys_yield(void) {
+  80116d:	55                   	push   %rbp
+  80116e:	48 89 e5             	mov    %rsp,%rbp
+  801171:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801172:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801177:	ba 00 00 00 00       	mov    $0x0,%edx
+  80117c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801181:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801186:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80118b:	be 00 00 00 00       	mov    $0x0,%esi
+  801190:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801196:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801198:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80119c:	c9                   	leave
+  80119d:	c3                   	ret
+
+000000000080119e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80119e:	55                   	push   %rbp
+  80119f:	48 89 e5             	mov    %rsp,%rbp
+  8011a2:	53                   	push   %rbx
+  8011a3:	48 89 fa             	mov    %rdi,%rdx
+  8011a6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011a9:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ae:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8011b5:	00 00 00 
+  8011b8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011c8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ce:	c9                   	leave
+  8011cf:	c3                   	ret
+
+00000000008011d0 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011d0:	55                   	push   %rbp
+  8011d1:	48 89 e5             	mov    %rsp,%rbp
+  8011d4:	53                   	push   %rbx
+  8011d5:	49 89 f8             	mov    %rdi,%r8
+  8011d8:	48 89 d3             	mov    %rdx,%rbx
+  8011db:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011de:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011e3:	4c 89 c2             	mov    %r8,%rdx
+  8011e6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f4:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8011f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011fa:	c9                   	leave
+  8011fb:	c3                   	ret
+
+00000000008011fc <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8011fc:	55                   	push   %rbp
+  8011fd:	48 89 e5             	mov    %rsp,%rbp
+  801200:	53                   	push   %rbx
+  801201:	48 83 ec 08          	sub    $0x8,%rsp
+  801205:	89 f8                	mov    %edi,%eax
+  801207:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80120a:	48 63 f9             	movslq %ecx,%rdi
+  80120d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801210:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801215:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801218:	be 00 00 00 00       	mov    $0x0,%esi
+  80121d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801223:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801225:	48 85 c0             	test   %rax,%rax
+  801228:	7f 06                	jg     801230 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80122a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80122e:	c9                   	leave
+  80122f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801230:	49 89 c0             	mov    %rax,%r8
+  801233:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801238:	48 ba 30 37 80 00 00 	movabs $0x803730,%rdx
+  80123f:	00 00 00 
+  801242:	be 26 00 00 00       	mov    $0x26,%esi
+  801247:	48 bf 4f 37 80 00 00 	movabs $0x80374f,%rdi
+  80124e:	00 00 00 
+  801251:	b8 00 00 00 00       	mov    $0x0,%eax
+  801256:	49 b9 d7 01 80 00 00 	movabs $0x8001d7,%r9
+  80125d:	00 00 00 
+  801260:	41 ff d1             	call   *%r9
+
+0000000000801263 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801263:	55                   	push   %rbp
+  801264:	48 89 e5             	mov    %rsp,%rbp
+  801267:	53                   	push   %rbx
+  801268:	48 83 ec 08          	sub    $0x8,%rsp
+  80126c:	89 f8                	mov    %edi,%eax
+  80126e:	49 89 f2             	mov    %rsi,%r10
+  801271:	48 89 cf             	mov    %rcx,%rdi
+  801274:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801277:	48 63 da             	movslq %edx,%rbx
+  80127a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80127d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801282:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801285:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801288:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80128a:	48 85 c0             	test   %rax,%rax
+  80128d:	7f 06                	jg     801295 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80128f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801293:	c9                   	leave
+  801294:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801295:	49 89 c0             	mov    %rax,%r8
+  801298:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80129d:	48 ba 30 37 80 00 00 	movabs $0x803730,%rdx
+  8012a4:	00 00 00 
+  8012a7:	be 26 00 00 00       	mov    $0x26,%esi
+  8012ac:	48 bf 4f 37 80 00 00 	movabs $0x80374f,%rdi
+  8012b3:	00 00 00 
+  8012b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012bb:	49 b9 d7 01 80 00 00 	movabs $0x8001d7,%r9
+  8012c2:	00 00 00 
+  8012c5:	41 ff d1             	call   *%r9
+
+00000000008012c8 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012c8:	55                   	push   %rbp
+  8012c9:	48 89 e5             	mov    %rsp,%rbp
+  8012cc:	53                   	push   %rbx
+  8012cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8012d1:	48 89 f1             	mov    %rsi,%rcx
+  8012d4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012d7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012da:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ef:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012f1:	48 85 c0             	test   %rax,%rax
+  8012f4:	7f 06                	jg     8012fc <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8012f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012fa:	c9                   	leave
+  8012fb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012fc:	49 89 c0             	mov    %rax,%r8
+  8012ff:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801304:	48 ba 30 37 80 00 00 	movabs $0x803730,%rdx
+  80130b:	00 00 00 
+  80130e:	be 26 00 00 00       	mov    $0x26,%esi
+  801313:	48 bf 4f 37 80 00 00 	movabs $0x80374f,%rdi
+  80131a:	00 00 00 
+  80131d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801322:	49 b9 d7 01 80 00 00 	movabs $0x8001d7,%r9
+  801329:	00 00 00 
+  80132c:	41 ff d1             	call   *%r9
+
+000000000080132f <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  80132f:	55                   	push   %rbp
+  801330:	48 89 e5             	mov    %rsp,%rbp
+  801333:	53                   	push   %rbx
+  801334:	48 83 ec 08          	sub    $0x8,%rsp
+  801338:	89 f8                	mov    %edi,%eax
+  80133a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  80133d:	48 63 f9             	movslq %ecx,%rdi
+  801340:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801343:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801348:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80134b:	be 00 00 00 00       	mov    $0x0,%esi
+  801350:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801356:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801358:	48 85 c0             	test   %rax,%rax
+  80135b:	7f 06                	jg     801363 <sys_region_advise+0x34>
+}
+  80135d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801361:	c9                   	leave
+  801362:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801363:	49 89 c0             	mov    %rax,%r8
+  801366:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80136b:	48 ba 30 37 80 00 00 	movabs $0x803730,%rdx
+  801372:	00 00 00 
+  801375:	be 26 00 00 00       	mov    $0x26,%esi
+  80137a:	48 bf 4f 37 80 00 00 	movabs $0x80374f,%rdi
+  801381:	00 00 00 
+  801384:	b8 00 00 00 00       	mov    $0x0,%eax
+  801389:	49 b9 d7 01 80 00 00 	movabs $0x8001d7,%r9
+  801390:	00 00 00 
+  801393:	41 ff d1             	call   *%r9
+
+0000000000801396 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801396:	55                   	push   %rbp
+  801397:	48 89 e5             	mov    %rsp,%rbp
+  80139a:	53                   	push   %rbx
+  80139b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80139f:	48 63 ce             	movslq %esi,%rcx
+  8013a2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a5:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013bf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013c1:	48 85 c0             	test   %rax,%rax
+  8013c4:	7f 06                	jg     8013cc <sys_env_set_nice+0x36>
+}
+  8013c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ca:	c9                   	leave
+  8013cb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013cc:	49 89 c0             	mov    %rax,%r8
+  8013cf:	b9 15 00 00 00       	mov    $0x15,%ecx
+  8013d4:	48 ba 30 37 80 00 00 	movabs $0x803730,%rdx
+  8013db:	00 00 00 
+  8013de:	be 26 00 00 00       	mov    $0x26,%esi
+  8013e3:	48 bf 4f 37 80 00 00 	movabs $0x80374f,%rdi
+  8013ea:	00 00 00 
+  8013ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f2:	49 b9 d7 01 80 00 00 	movabs $0x8001d7,%r9
+  8013f9:	00 00 00 
+  8013fc:	41 ff d1             	call   *%r9
+
+00000000008013ff <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8013ff:	55                   	push   %rbp
+  801400:	48 89 e5             	mov    %rsp,%rbp
+  801403:	53                   	push   %rbx
+  801404:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801408:	48 63 ce             	movslq %esi,%rcx
+  80140b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80140e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801413:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801418:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80141d:	be 00 00 00 00       	mov    $0x0,%esi
+  801422:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801428:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80142a:	48 85 c0             	test   %rax,%rax
+  80142d:	7f 06                	jg     801435 <sys_env_set_status+0x36>
+}
+  80142f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801433:	c9                   	leave
+  801434:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801435:	49 89 c0             	mov    %rax,%r8
+  801438:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80143d:	48 ba 30 37 80 00 00 	movabs $0x803730,%rdx
+  801444:	00 00 00 
+  801447:	be 26 00 00 00       	mov    $0x26,%esi
+  80144c:	48 bf 4f 37 80 00 00 	movabs $0x80374f,%rdi
+  801453:	00 00 00 
+  801456:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145b:	49 b9 d7 01 80 00 00 	movabs $0x8001d7,%r9
+  801462:	00 00 00 
+  801465:	41 ff d1             	call   *%r9
+
+0000000000801468 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801468:	55                   	push   %rbp
+  801469:	48 89 e5             	mov    %rsp,%rbp
+  80146c:	53                   	push   %rbx
+  80146d:	48 83 ec 08          	sub    $0x8,%rsp
+  801471:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801474:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801477:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80147c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801481:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801486:	be 00 00 00 00       	mov    $0x0,%esi
+  80148b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801491:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801493:	48 85 c0             	test   %rax,%rax
+  801496:	7f 06                	jg     80149e <sys_env_set_trapframe+0x36>
+}
+  801498:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80149c:	c9                   	leave
+  80149d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80149e:	49 89 c0             	mov    %rax,%r8
+  8014a1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8014a6:	48 ba 30 37 80 00 00 	movabs $0x803730,%rdx
+  8014ad:	00 00 00 
+  8014b0:	be 26 00 00 00       	mov    $0x26,%esi
+  8014b5:	48 bf 4f 37 80 00 00 	movabs $0x80374f,%rdi
+  8014bc:	00 00 00 
+  8014bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c4:	49 b9 d7 01 80 00 00 	movabs $0x8001d7,%r9
+  8014cb:	00 00 00 
+  8014ce:	41 ff d1             	call   *%r9
+
+00000000008014d1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8014d1:	55                   	push   %rbp
+  8014d2:	48 89 e5             	mov    %rsp,%rbp
+  8014d5:	53                   	push   %rbx
+  8014d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8014da:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8014dd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e0:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014fa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014fc:	48 85 c0             	test   %rax,%rax
+  8014ff:	7f 06                	jg     801507 <sys_env_set_pgfault_upcall+0x36>
+}
+  801501:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801505:	c9                   	leave
+  801506:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801507:	49 89 c0             	mov    %rax,%r8
+  80150a:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80150f:	48 ba 30 37 80 00 00 	movabs $0x803730,%rdx
+  801516:	00 00 00 
+  801519:	be 26 00 00 00       	mov    $0x26,%esi
+  80151e:	48 bf 4f 37 80 00 00 	movabs $0x80374f,%rdi
+  801525:	00 00 00 
+  801528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152d:	49 b9 d7 01 80 00 00 	movabs $0x8001d7,%r9
+  801534:	00 00 00 
+  801537:	41 ff d1             	call   *%r9
+
+000000000080153a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80153a:	55                   	push   %rbp
+  80153b:	48 89 e5             	mov    %rsp,%rbp
+  80153e:	53                   	push   %rbx
+  80153f:	89 f8                	mov    %edi,%eax
+  801541:	49 89 f1             	mov    %rsi,%r9
+  801544:	48 89 d3             	mov    %rdx,%rbx
+  801547:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80154a:	49 63 f0             	movslq %r8d,%rsi
+  80154d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801550:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801555:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801558:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80155e:	cd 30                	int    $0x30
+}
+  801560:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801564:	c9                   	leave
+  801565:	c3                   	ret
+
+0000000000801566 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801566:	55                   	push   %rbp
+  801567:	48 89 e5             	mov    %rsp,%rbp
+  80156a:	53                   	push   %rbx
+  80156b:	48 83 ec 08          	sub    $0x8,%rsp
+  80156f:	48 89 fa             	mov    %rdi,%rdx
+  801572:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801575:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80157a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801584:	be 00 00 00 00       	mov    $0x0,%esi
+  801589:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80158f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801591:	48 85 c0             	test   %rax,%rax
+  801594:	7f 06                	jg     80159c <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801596:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159a:	c9                   	leave
+  80159b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80159c:	49 89 c0             	mov    %rax,%r8
+  80159f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015a4:	48 ba 30 37 80 00 00 	movabs $0x803730,%rdx
+  8015ab:	00 00 00 
+  8015ae:	be 26 00 00 00       	mov    $0x26,%esi
+  8015b3:	48 bf 4f 37 80 00 00 	movabs $0x80374f,%rdi
+  8015ba:	00 00 00 
+  8015bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c2:	49 b9 d7 01 80 00 00 	movabs $0x8001d7,%r9
+  8015c9:	00 00 00 
+  8015cc:	41 ff d1             	call   *%r9
+
+00000000008015cf <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8015cf:	55                   	push   %rbp
+  8015d0:	48 89 e5             	mov    %rsp,%rbp
+  8015d3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d4:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015de:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f8:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015fe:	c9                   	leave
+  8015ff:	c3                   	ret
+
+0000000000801600 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  801600:	55                   	push   %rbp
+  801601:	48 89 e5             	mov    %rsp,%rbp
+  801604:	53                   	push   %rbx
+  801605:	48 83 ec 08          	sub    $0x8,%rsp
+  801609:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  80160c:	48 63 ce             	movslq %esi,%rcx
+  80160f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801612:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801617:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80161c:	be 00 00 00 00       	mov    $0x0,%esi
+  801621:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801627:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801629:	48 85 c0             	test   %rax,%rax
+  80162c:	7f 06                	jg     801634 <sys_sigqueue+0x34>
+}
+  80162e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801632:	c9                   	leave
+  801633:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801634:	49 89 c0             	mov    %rax,%r8
+  801637:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80163c:	48 ba 30 37 80 00 00 	movabs $0x803730,%rdx
+  801643:	00 00 00 
+  801646:	be 26 00 00 00       	mov    $0x26,%esi
+  80164b:	48 bf 4f 37 80 00 00 	movabs $0x80374f,%rdi
+  801652:	00 00 00 
+  801655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165a:	49 b9 d7 01 80 00 00 	movabs $0x8001d7,%r9
+  801661:	00 00 00 
+  801664:	41 ff d1             	call   *%r9
+
+0000000000801667 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801667:	55                   	push   %rbp
+  801668:	48 89 e5             	mov    %rsp,%rbp
+  80166b:	53                   	push   %rbx
+  80166c:	48 83 ec 08          	sub    $0x8,%rsp
+  801670:	48 89 fa             	mov    %rdi,%rdx
+  801673:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801676:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80167b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801680:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801685:	be 00 00 00 00       	mov    $0x0,%esi
+  80168a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801690:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801692:	48 85 c0             	test   %rax,%rax
+  801695:	7f 06                	jg     80169d <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801697:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80169b:	c9                   	leave
+  80169c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80169d:	49 89 c0             	mov    %rax,%r8
+  8016a0:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8016a5:	48 ba 30 37 80 00 00 	movabs $0x803730,%rdx
+  8016ac:	00 00 00 
+  8016af:	be 26 00 00 00       	mov    $0x26,%esi
+  8016b4:	48 bf 4f 37 80 00 00 	movabs $0x80374f,%rdi
+  8016bb:	00 00 00 
+  8016be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c3:	49 b9 d7 01 80 00 00 	movabs $0x8001d7,%r9
+  8016ca:	00 00 00 
+  8016cd:	41 ff d1             	call   *%r9
+
+00000000008016d0 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  8016d0:	55                   	push   %rbp
+  8016d1:	48 89 e5             	mov    %rsp,%rbp
+  8016d4:	53                   	push   %rbx
+  8016d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8016d9:	48 89 f1             	mov    %rsi,%rcx
+  8016dc:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  8016df:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e2:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016f9:	48 85 c0             	test   %rax,%rax
+  8016fc:	7f 06                	jg     801704 <sys_sigaction+0x34>
+}
+  8016fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801702:	c9                   	leave
+  801703:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801704:	49 89 c0             	mov    %rax,%r8
+  801707:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80170c:	48 ba 30 37 80 00 00 	movabs $0x803730,%rdx
+  801713:	00 00 00 
+  801716:	be 26 00 00 00       	mov    $0x26,%esi
+  80171b:	48 bf 4f 37 80 00 00 	movabs $0x80374f,%rdi
+  801722:	00 00 00 
+  801725:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172a:	49 b9 d7 01 80 00 00 	movabs $0x8001d7,%r9
+  801731:	00 00 00 
+  801734:	41 ff d1             	call   *%r9
+
+0000000000801737 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801737:	55                   	push   %rbp
+  801738:	48 89 e5             	mov    %rsp,%rbp
+  80173b:	53                   	push   %rbx
+  80173c:	48 83 ec 08          	sub    $0x8,%rsp
+  801740:	48 89 f1             	mov    %rsi,%rcx
+  801743:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801746:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801749:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80174e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801753:	be 00 00 00 00       	mov    $0x0,%esi
+  801758:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80175e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801760:	48 85 c0             	test   %rax,%rax
+  801763:	7f 06                	jg     80176b <sys_sigprocmask+0x34>
+}
+  801765:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801769:	c9                   	leave
+  80176a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80176b:	49 89 c0             	mov    %rax,%r8
+  80176e:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801773:	48 ba 30 37 80 00 00 	movabs $0x803730,%rdx
+  80177a:	00 00 00 
+  80177d:	be 26 00 00 00       	mov    $0x26,%esi
+  801782:	48 bf 4f 37 80 00 00 	movabs $0x80374f,%rdi
+  801789:	00 00 00 
+  80178c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801791:	49 b9 d7 01 80 00 00 	movabs $0x8001d7,%r9
+  801798:	00 00 00 
+  80179b:	41 ff d1             	call   *%r9
+
+000000000080179e <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80179e:	55                   	push   %rbp
+  80179f:	48 89 e5             	mov    %rsp,%rbp
+  8017a2:	41 56                	push   %r14
+  8017a4:	41 55                	push   %r13
+  8017a6:	41 54                	push   %r12
+  8017a8:	53                   	push   %rbx
+  8017a9:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8017ac:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  8017b3:	00 00 00 
+  8017b6:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8017ba:	74 27                	je     8017e3 <_handle_vectored_pagefault+0x45>
+  8017bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8017c1:	49 bd 20 50 80 00 00 	movabs $0x805020,%r13
+  8017c8:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8017cb:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8017ce:	4c 89 e7             	mov    %r12,%rdi
+  8017d1:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8017d6:	84 c0                	test   %al,%al
+  8017d8:	75 45                	jne    80181f <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8017da:	48 83 c3 01          	add    $0x1,%rbx
+  8017de:	49 3b 1e             	cmp    (%r14),%rbx
+  8017e1:	72 eb                	jb     8017ce <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8017e3:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8017ea:	00 
+  8017eb:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8017f0:	4d 8b 04 24          	mov    (%r12),%r8
+  8017f4:	48 ba 60 37 80 00 00 	movabs $0x803760,%rdx
+  8017fb:	00 00 00 
+  8017fe:	be 1d 00 00 00       	mov    $0x1d,%esi
+  801803:	48 bf f7 37 80 00 00 	movabs $0x8037f7,%rdi
+  80180a:	00 00 00 
+  80180d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801812:	49 ba d7 01 80 00 00 	movabs $0x8001d7,%r10
+  801819:	00 00 00 
+  80181c:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80181f:	5b                   	pop    %rbx
+  801820:	41 5c                	pop    %r12
+  801822:	41 5d                	pop    %r13
+  801824:	41 5e                	pop    %r14
+  801826:	5d                   	pop    %rbp
+  801827:	c3                   	ret
+
+0000000000801828 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  801828:	55                   	push   %rbp
+  801829:	48 89 e5             	mov    %rsp,%rbp
+  80182c:	53                   	push   %rbx
+  80182d:	48 83 ec 08          	sub    $0x8,%rsp
+  801831:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  801834:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  80183b:	00 00 00 
+  80183e:	80 38 00             	cmpb   $0x0,(%rax)
+  801841:	74 61                	je     8018a4 <add_pgfault_handler+0x7c>
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801843:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  80184a:	00 00 00 
+  80184d:	48 8b 10             	mov    (%rax),%rdx
+  801850:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  801855:	48 b9 20 50 80 00 00 	movabs $0x805020,%rcx
+  80185c:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80185f:	48 85 d2             	test   %rdx,%rdx
+  801862:	74 19                	je     80187d <add_pgfault_handler+0x55>
+        if (handler == _pfhandler_vec[i]) return 0;
+  801864:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  801868:	74 2f                	je     801899 <add_pgfault_handler+0x71>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80186a:	48 83 c0 01          	add    $0x1,%rax
+  80186e:	48 39 d0             	cmp    %rdx,%rax
+  801871:	75 f1                	jne    801864 <add_pgfault_handler+0x3c>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  801873:	48 83 fa 08          	cmp    $0x8,%rdx
+  801877:	0f 84 f7 00 00 00    	je     801974 <add_pgfault_handler+0x14c>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80187d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801881:	48 a3 68 50 80 00 00 	movabs %rax,0x805068
+  801888:	00 00 00 
+  80188b:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  801892:	00 00 00 
+  801895:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  801899:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a2:	c9                   	leave
+  8018a3:	c3                   	ret
+        if (sys_alloc_region(CURENVID, ues_beg, PAGE_SIZE, PROT_RW))
+  8018a4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8018a9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018ae:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8018b5:	00 00 00 
+  8018b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018bd:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  8018c4:	00 00 00 
+  8018c7:	ff d0                	call   *%rax
+  8018c9:	85 c0                	test   %eax,%eax
+  8018cb:	75 53                	jne    801920 <add_pgfault_handler+0xf8>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8018cd:	48 ba 68 50 80 00 00 	movabs $0x805068,%rdx
+  8018d4:	00 00 00 
+  8018d7:	48 8b 02             	mov    (%rdx),%rax
+  8018da:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8018de:	48 89 0a             	mov    %rcx,(%rdx)
+  8018e1:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8018e8:	00 00 00 
+  8018eb:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        if (sys_env_set_pgfault_upcall(CURENVID, _pgfault_upcall))
+  8018ef:	48 be 60 1a 80 00 00 	movabs $0x801a60,%rsi
+  8018f6:	00 00 00 
+  8018f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018fe:	48 b8 d1 14 80 00 00 	movabs $0x8014d1,%rax
+  801905:	00 00 00 
+  801908:	ff d0                	call   *%rax
+  80190a:	85 c0                	test   %eax,%eax
+  80190c:	75 3c                	jne    80194a <add_pgfault_handler+0x122>
+        _pfhandler_inititiallized = 1;
+  80190e:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801915:	00 00 00 
+  801918:	c6 00 01             	movb   $0x1,(%rax)
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80191b:	e9 79 ff ff ff       	jmp    801899 <add_pgfault_handler+0x71>
+            panic("add_pgfault_handler: sys_alloc_region failed");
+  801920:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  801927:	00 00 00 
+  80192a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80192f:	48 bf f7 37 80 00 00 	movabs $0x8037f7,%rdi
+  801936:	00 00 00 
+  801939:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193e:	48 b9 d7 01 80 00 00 	movabs $0x8001d7,%rcx
+  801945:	00 00 00 
+  801948:	ff d1                	call   *%rcx
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+  80194a:	48 ba c0 37 80 00 00 	movabs $0x8037c0,%rdx
+  801951:	00 00 00 
+  801954:	be 32 00 00 00       	mov    $0x32,%esi
+  801959:	48 bf f7 37 80 00 00 	movabs $0x8037f7,%rdi
+  801960:	00 00 00 
+  801963:	b8 00 00 00 00       	mov    $0x0,%eax
+  801968:	48 b9 d7 01 80 00 00 	movabs $0x8001d7,%rcx
+  80196f:	00 00 00 
+  801972:	ff d1                	call   *%rcx
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801974:	b9 fd ff ff ff       	mov    $0xfffffffd,%ecx
+  801979:	48 ba 05 38 80 00 00 	movabs $0x803805,%rdx
+  801980:	00 00 00 
+  801983:	be 40 00 00 00       	mov    $0x40,%esi
+  801988:	48 bf f7 37 80 00 00 	movabs $0x8037f7,%rdi
+  80198f:	00 00 00 
+  801992:	b8 00 00 00 00       	mov    $0x0,%eax
+  801997:	49 b8 d7 01 80 00 00 	movabs $0x8001d7,%r8
+  80199e:	00 00 00 
+  8019a1:	41 ff d0             	call   *%r8
+
+00000000008019a4 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8019a4:	55                   	push   %rbp
+  8019a5:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8019a8:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8019af:	00 00 00 
+  8019b2:	80 38 00             	cmpb   $0x0,(%rax)
+  8019b5:	74 33                	je     8019ea <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8019b7:	48 a1 68 50 80 00 00 	movabs 0x805068,%rax
+  8019be:	00 00 00 
+  8019c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8019c6:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8019cd:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8019d0:	48 85 c0             	test   %rax,%rax
+  8019d3:	0f 84 85 00 00 00    	je     801a5e <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8019d9:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8019dd:	74 40                	je     801a1f <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8019df:	48 83 c1 01          	add    $0x1,%rcx
+  8019e3:	48 39 c1             	cmp    %rax,%rcx
+  8019e6:	75 f1                	jne    8019d9 <remove_pgfault_handler+0x35>
+  8019e8:	eb 74                	jmp    801a5e <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8019ea:	48 b9 1d 38 80 00 00 	movabs $0x80381d,%rcx
+  8019f1:	00 00 00 
+  8019f4:	48 ba 37 38 80 00 00 	movabs $0x803837,%rdx
+  8019fb:	00 00 00 
+  8019fe:	be 46 00 00 00       	mov    $0x46,%esi
+  801a03:	48 bf f7 37 80 00 00 	movabs $0x8037f7,%rdi
+  801a0a:	00 00 00 
+  801a0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a12:	49 b8 d7 01 80 00 00 	movabs $0x8001d7,%r8
+  801a19:	00 00 00 
+  801a1c:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  801a1f:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  801a26:	00 
+  801a27:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a2b:	48 29 ca             	sub    %rcx,%rdx
+  801a2e:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  801a35:	00 00 00 
+  801a38:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  801a3c:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  801a41:	48 89 ce             	mov    %rcx,%rsi
+  801a44:	48 b8 46 0e 80 00 00 	movabs $0x800e46,%rax
+  801a4b:	00 00 00 
+  801a4e:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  801a50:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  801a57:	00 00 00 
+  801a5a:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  801a5e:	5d                   	pop    %rbp
+  801a5f:	c3                   	ret
+
+0000000000801a60 <_pgfault_upcall>:
+.text
+.globl _pgfault_upcall
+.globl _signal_handler_trampoline
+_pgfault_upcall:
+_signal_handler_trampoline:
+    movq  %rsp,%rdi # passing the function argument (UTrapframe *) in rdi
+  801a60:	48 89 e7             	mov    %rsp,%rdi
+    # sizeof(struct EnqueuedSignal) == 56
+    # sizeof(curenv->env_sig_mask) == 4
+    # + 4 bytes of alignment
+    add $64, %rdi
+  801a63:	48 83 c7 40          	add    $0x40,%rdi
+
+    # load signo
+    mov (%rsp), %eax
+  801a67:	8b 04 24             	mov    (%rsp),%eax
+    test %eax, %eax
+  801a6a:	85 c0                	test   %eax,%eax
+    jnz _call_generic_signal_handler
+  801a6c:	75 0e                	jne    801a7c <_call_generic_signal_handler>
+
+    # Call the C page fault handler.
+    movabs $_handle_vectored_pagefault, %rax
+  801a6e:	48 b8 9e 17 80 00 00 	movabs $0x80179e,%rax
+  801a75:	00 00 00 
+    call *%rax
+  801a78:	ff d0                	call   *%rax
+    jmp _return_from_handler
+  801a7a:	eb 0f                	jmp    801a8b <_return_from_handler>
+
+0000000000801a7c <_call_generic_signal_handler>:
+
+_call_generic_signal_handler:
+    movq %rsp, %rsi # passing the function argument (EnqueuedSignal *) in rsi
+  801a7c:	48 89 e6             	mov    %rsp,%rsi
+    movabs $_generic_signal_handler, %rax
+  801a7f:	48 b8 c3 2b 80 00 00 	movabs $0x802bc3,%rax
+  801a86:	00 00 00 
+    call *%rax
+  801a89:	ff d0                	call   *%rax
+
+0000000000801a8b <_return_from_handler>:
+
+_return_from_handler:
+    # ignore EnqueuedSignal and env_sig_mask
+    add $64, %rsp
+  801a8b:	48 83 c4 40          	add    $0x40,%rsp
+    # put SIG_SETMASK as the first func arg
+    movq $3, %rdi
+  801a8f:	48 c7 c7 03 00 00 00 	mov    $0x3,%rdi
+    # load &env_sig_mask (as the second func arg)
+    lea -4(%rsp), %rsi
+  801a96:	48 8d 74 24 fc       	lea    -0x4(%rsp),%rsi
+    # NULL as the third arg
+    xor %rdx, %rdx
+  801a9b:	48 31 d2             	xor    %rdx,%rdx
+    # restore blocked signals mask
+    movabs $sys_sigprocmask, %rax
+  801a9e:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  801aa5:	00 00 00 
+    call *%rax
+  801aa8:	ff d0                	call   *%rax
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    # ignore utf_fault_va, utf_err
+    addq $16, %rsp
+  801aaa:	48 83 c4 10          	add    $0x10,%rsp
+    # restore utf_regs, save rax again
+    POPA
+  801aae:	4c 8b 3c 24          	mov    (%rsp),%r15
+  801ab2:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  801ab7:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  801abc:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  801ac1:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  801ac6:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  801acb:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  801ad0:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  801ad5:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  801ada:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  801adf:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  801ae4:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  801ae9:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  801aee:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  801af3:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  801af8:	48 83 c4 78          	add    $0x78,%rsp
+    pushq %rax
+  801afc:	50                   	push   %rax
+    # 16 utf_rflags
+    #  8 utf_rip
+    #  0 rax
+
+    # load utf_rip
+    movq 8(%rsp), %rax
+  801afd:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    # save rbx to utf_rip
+    movq %rbx, 8(%rsp)
+  801b02:	48 89 5c 24 08       	mov    %rbx,0x8(%rsp)
+    # load utf_rsp
+    movq 24(%rsp), %rbx
+  801b07:	48 8b 5c 24 18       	mov    0x18(%rsp),%rbx
+    # store return address to *utf_stack
+    subq $8, 24(%rsp)
+  801b0c:	48 83 6c 24 18 08    	subq   $0x8,0x18(%rsp)
+    movq %rax, -8(%rbx)
+  801b12:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    # restore rax and rbx
+    popq %rax
+  801b16:	58                   	pop    %rax
+    popq %rbx
+  801b17:	5b                   	pop    %rbx
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+    popfq
+  801b18:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    popq %rsp
+  801b19:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  801b1a:	c3                   	ret
+
+0000000000801b1b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b1b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b22:	ff ff ff 
+  801b25:	48 01 f8             	add    %rdi,%rax
+  801b28:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801b2c:	c3                   	ret
+
+0000000000801b2d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b2d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b34:	ff ff ff 
+  801b37:	48 01 f8             	add    %rdi,%rax
+  801b3a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801b3e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801b44:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801b48:	c3                   	ret
+
+0000000000801b49 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801b49:	55                   	push   %rbp
+  801b4a:	48 89 e5             	mov    %rsp,%rbp
+  801b4d:	41 57                	push   %r15
+  801b4f:	41 56                	push   %r14
+  801b51:	41 55                	push   %r13
+  801b53:	41 54                	push   %r12
+  801b55:	53                   	push   %rbx
+  801b56:	48 83 ec 08          	sub    $0x8,%rsp
+  801b5a:	49 89 ff             	mov    %rdi,%r15
+  801b5d:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801b62:	49 bd c7 2a 80 00 00 	movabs $0x802ac7,%r13
+  801b69:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801b6c:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801b72:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801b75:	48 89 df             	mov    %rbx,%rdi
+  801b78:	41 ff d5             	call   *%r13
+  801b7b:	83 e0 04             	and    $0x4,%eax
+  801b7e:	74 17                	je     801b97 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801b80:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b87:	4c 39 f3             	cmp    %r14,%rbx
+  801b8a:	75 e6                	jne    801b72 <fd_alloc+0x29>
+  801b8c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801b92:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801b97:	4d 89 27             	mov    %r12,(%r15)
+}
+  801b9a:	48 83 c4 08          	add    $0x8,%rsp
+  801b9e:	5b                   	pop    %rbx
+  801b9f:	41 5c                	pop    %r12
+  801ba1:	41 5d                	pop    %r13
+  801ba3:	41 5e                	pop    %r14
+  801ba5:	41 5f                	pop    %r15
+  801ba7:	5d                   	pop    %rbp
+  801ba8:	c3                   	ret
+
+0000000000801ba9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801ba9:	83 ff 1f             	cmp    $0x1f,%edi
+  801bac:	77 39                	ja     801be7 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801bae:	55                   	push   %rbp
+  801baf:	48 89 e5             	mov    %rsp,%rbp
+  801bb2:	41 54                	push   %r12
+  801bb4:	53                   	push   %rbx
+  801bb5:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801bb8:	48 63 df             	movslq %edi,%rbx
+  801bbb:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801bc2:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801bc6:	48 89 df             	mov    %rbx,%rdi
+  801bc9:	48 b8 c7 2a 80 00 00 	movabs $0x802ac7,%rax
+  801bd0:	00 00 00 
+  801bd3:	ff d0                	call   *%rax
+  801bd5:	a8 04                	test   $0x4,%al
+  801bd7:	74 14                	je     801bed <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801bd9:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801be2:	5b                   	pop    %rbx
+  801be3:	41 5c                	pop    %r12
+  801be5:	5d                   	pop    %rbp
+  801be6:	c3                   	ret
+        return -E_INVAL;
+  801be7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801bec:	c3                   	ret
+        return -E_INVAL;
+  801bed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bf2:	eb ee                	jmp    801be2 <fd_lookup+0x39>
+
+0000000000801bf4 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801bf4:	55                   	push   %rbp
+  801bf5:	48 89 e5             	mov    %rsp,%rbp
+  801bf8:	41 54                	push   %r12
+  801bfa:	53                   	push   %rbx
+  801bfb:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801bfe:	48 b8 e0 38 80 00 00 	movabs $0x8038e0,%rax
+  801c05:	00 00 00 
+  801c08:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801c0f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801c12:	39 3b                	cmp    %edi,(%rbx)
+  801c14:	74 47                	je     801c5d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c16:	48 83 c0 08          	add    $0x8,%rax
+  801c1a:	48 8b 18             	mov    (%rax),%rbx
+  801c1d:	48 85 db             	test   %rbx,%rbx
+  801c20:	75 f0                	jne    801c12 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c22:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c29:	00 00 00 
+  801c2c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c32:	89 fa                	mov    %edi,%edx
+  801c34:	48 bf 50 38 80 00 00 	movabs $0x803850,%rdi
+  801c3b:	00 00 00 
+  801c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c43:	48 b9 27 03 80 00 00 	movabs $0x800327,%rcx
+  801c4a:	00 00 00 
+  801c4d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801c4f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801c54:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801c58:	5b                   	pop    %rbx
+  801c59:	41 5c                	pop    %r12
+  801c5b:	5d                   	pop    %rbp
+  801c5c:	c3                   	ret
+            return 0;
+  801c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c62:	eb f0                	jmp    801c54 <dev_lookup+0x60>
+
+0000000000801c64 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801c64:	55                   	push   %rbp
+  801c65:	48 89 e5             	mov    %rsp,%rbp
+  801c68:	41 55                	push   %r13
+  801c6a:	41 54                	push   %r12
+  801c6c:	53                   	push   %rbx
+  801c6d:	48 83 ec 18          	sub    $0x18,%rsp
+  801c71:	48 89 fb             	mov    %rdi,%rbx
+  801c74:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c77:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801c7e:	ff ff ff 
+  801c81:	48 01 df             	add    %rbx,%rdi
+  801c84:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801c88:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c8c:	48 b8 a9 1b 80 00 00 	movabs $0x801ba9,%rax
+  801c93:	00 00 00 
+  801c96:	ff d0                	call   *%rax
+  801c98:	41 89 c5             	mov    %eax,%r13d
+  801c9b:	85 c0                	test   %eax,%eax
+  801c9d:	78 06                	js     801ca5 <fd_close+0x41>
+  801c9f:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ca3:	74 1a                	je     801cbf <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ca5:	45 84 e4             	test   %r12b,%r12b
+  801ca8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cad:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801cb1:	44 89 e8             	mov    %r13d,%eax
+  801cb4:	48 83 c4 18          	add    $0x18,%rsp
+  801cb8:	5b                   	pop    %rbx
+  801cb9:	41 5c                	pop    %r12
+  801cbb:	41 5d                	pop    %r13
+  801cbd:	5d                   	pop    %rbp
+  801cbe:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801cbf:	8b 3b                	mov    (%rbx),%edi
+  801cc1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cc5:	48 b8 f4 1b 80 00 00 	movabs $0x801bf4,%rax
+  801ccc:	00 00 00 
+  801ccf:	ff d0                	call   *%rax
+  801cd1:	41 89 c5             	mov    %eax,%r13d
+  801cd4:	85 c0                	test   %eax,%eax
+  801cd6:	78 1b                	js     801cf3 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801cd8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cdc:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801ce0:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801ce6:	48 85 c0             	test   %rax,%rax
+  801ce9:	74 08                	je     801cf3 <fd_close+0x8f>
+  801ceb:	48 89 df             	mov    %rbx,%rdi
+  801cee:	ff d0                	call   *%rax
+  801cf0:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801cf3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cf8:	48 89 de             	mov    %rbx,%rsi
+  801cfb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d00:	48 b8 c8 12 80 00 00 	movabs $0x8012c8,%rax
+  801d07:	00 00 00 
+  801d0a:	ff d0                	call   *%rax
+    return res;
+  801d0c:	eb a3                	jmp    801cb1 <fd_close+0x4d>
+
+0000000000801d0e <close>:
+
+int
+close(int fdnum) {
+  801d0e:	55                   	push   %rbp
+  801d0f:	48 89 e5             	mov    %rsp,%rbp
+  801d12:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d16:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d1a:	48 b8 a9 1b 80 00 00 	movabs $0x801ba9,%rax
+  801d21:	00 00 00 
+  801d24:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d26:	85 c0                	test   %eax,%eax
+  801d28:	78 15                	js     801d3f <close+0x31>
+
+    return fd_close(fd, 1);
+  801d2a:	be 01 00 00 00       	mov    $0x1,%esi
+  801d2f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801d33:	48 b8 64 1c 80 00 00 	movabs $0x801c64,%rax
+  801d3a:	00 00 00 
+  801d3d:	ff d0                	call   *%rax
+}
+  801d3f:	c9                   	leave
+  801d40:	c3                   	ret
+
+0000000000801d41 <close_all>:
+
+void
+close_all(void) {
+  801d41:	55                   	push   %rbp
+  801d42:	48 89 e5             	mov    %rsp,%rbp
+  801d45:	41 54                	push   %r12
+  801d47:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801d48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d4d:	49 bc 0e 1d 80 00 00 	movabs $0x801d0e,%r12
+  801d54:	00 00 00 
+  801d57:	89 df                	mov    %ebx,%edi
+  801d59:	41 ff d4             	call   *%r12
+  801d5c:	83 c3 01             	add    $0x1,%ebx
+  801d5f:	83 fb 20             	cmp    $0x20,%ebx
+  801d62:	75 f3                	jne    801d57 <close_all+0x16>
+}
+  801d64:	5b                   	pop    %rbx
+  801d65:	41 5c                	pop    %r12
+  801d67:	5d                   	pop    %rbp
+  801d68:	c3                   	ret
+
+0000000000801d69 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801d69:	55                   	push   %rbp
+  801d6a:	48 89 e5             	mov    %rsp,%rbp
+  801d6d:	41 57                	push   %r15
+  801d6f:	41 56                	push   %r14
+  801d71:	41 55                	push   %r13
+  801d73:	41 54                	push   %r12
+  801d75:	53                   	push   %rbx
+  801d76:	48 83 ec 18          	sub    $0x18,%rsp
+  801d7a:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801d7d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801d81:	48 b8 a9 1b 80 00 00 	movabs $0x801ba9,%rax
+  801d88:	00 00 00 
+  801d8b:	ff d0                	call   *%rax
+  801d8d:	89 c3                	mov    %eax,%ebx
+  801d8f:	85 c0                	test   %eax,%eax
+  801d91:	0f 88 b8 00 00 00    	js     801e4f <dup+0xe6>
+    close(newfdnum);
+  801d97:	44 89 e7             	mov    %r12d,%edi
+  801d9a:	48 b8 0e 1d 80 00 00 	movabs $0x801d0e,%rax
+  801da1:	00 00 00 
+  801da4:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801da6:	4d 63 ec             	movslq %r12d,%r13
+  801da9:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801db0:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801db4:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801db8:	4c 89 ff             	mov    %r15,%rdi
+  801dbb:	49 be 2d 1b 80 00 00 	movabs $0x801b2d,%r14
+  801dc2:	00 00 00 
+  801dc5:	41 ff d6             	call   *%r14
+  801dc8:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801dcb:	4c 89 ef             	mov    %r13,%rdi
+  801dce:	41 ff d6             	call   *%r14
+  801dd1:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801dd4:	48 89 df             	mov    %rbx,%rdi
+  801dd7:	48 b8 c7 2a 80 00 00 	movabs $0x802ac7,%rax
+  801dde:	00 00 00 
+  801de1:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801de3:	a8 04                	test   $0x4,%al
+  801de5:	74 2b                	je     801e12 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801de7:	41 89 c1             	mov    %eax,%r9d
+  801dea:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801df0:	4c 89 f1             	mov    %r14,%rcx
+  801df3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df8:	48 89 de             	mov    %rbx,%rsi
+  801dfb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e00:	48 b8 63 12 80 00 00 	movabs $0x801263,%rax
+  801e07:	00 00 00 
+  801e0a:	ff d0                	call   *%rax
+  801e0c:	89 c3                	mov    %eax,%ebx
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	78 4e                	js     801e60 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801e12:	4c 89 ff             	mov    %r15,%rdi
+  801e15:	48 b8 c7 2a 80 00 00 	movabs $0x802ac7,%rax
+  801e1c:	00 00 00 
+  801e1f:	ff d0                	call   *%rax
+  801e21:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801e24:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e2a:	4c 89 e9             	mov    %r13,%rcx
+  801e2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e32:	4c 89 fe             	mov    %r15,%rsi
+  801e35:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e3a:	48 b8 63 12 80 00 00 	movabs $0x801263,%rax
+  801e41:	00 00 00 
+  801e44:	ff d0                	call   *%rax
+  801e46:	89 c3                	mov    %eax,%ebx
+  801e48:	85 c0                	test   %eax,%eax
+  801e4a:	78 14                	js     801e60 <dup+0xf7>
+
+    return newfdnum;
+  801e4c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801e4f:	89 d8                	mov    %ebx,%eax
+  801e51:	48 83 c4 18          	add    $0x18,%rsp
+  801e55:	5b                   	pop    %rbx
+  801e56:	41 5c                	pop    %r12
+  801e58:	41 5d                	pop    %r13
+  801e5a:	41 5e                	pop    %r14
+  801e5c:	41 5f                	pop    %r15
+  801e5e:	5d                   	pop    %rbp
+  801e5f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801e60:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e65:	4c 89 ee             	mov    %r13,%rsi
+  801e68:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e6d:	49 bc c8 12 80 00 00 	movabs $0x8012c8,%r12
+  801e74:	00 00 00 
+  801e77:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801e7a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e7f:	4c 89 f6             	mov    %r14,%rsi
+  801e82:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e87:	41 ff d4             	call   *%r12
+    return res;
+  801e8a:	eb c3                	jmp    801e4f <dup+0xe6>
+
+0000000000801e8c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801e8c:	55                   	push   %rbp
+  801e8d:	48 89 e5             	mov    %rsp,%rbp
+  801e90:	41 56                	push   %r14
+  801e92:	41 55                	push   %r13
+  801e94:	41 54                	push   %r12
+  801e96:	53                   	push   %rbx
+  801e97:	48 83 ec 10          	sub    $0x10,%rsp
+  801e9b:	89 fb                	mov    %edi,%ebx
+  801e9d:	49 89 f4             	mov    %rsi,%r12
+  801ea0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ea3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ea7:	48 b8 a9 1b 80 00 00 	movabs $0x801ba9,%rax
+  801eae:	00 00 00 
+  801eb1:	ff d0                	call   *%rax
+  801eb3:	85 c0                	test   %eax,%eax
+  801eb5:	78 4c                	js     801f03 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eb7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ebb:	41 8b 3e             	mov    (%r14),%edi
+  801ebe:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ec2:	48 b8 f4 1b 80 00 00 	movabs $0x801bf4,%rax
+  801ec9:	00 00 00 
+  801ecc:	ff d0                	call   *%rax
+  801ece:	85 c0                	test   %eax,%eax
+  801ed0:	78 35                	js     801f07 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ed2:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ed6:	83 e0 03             	and    $0x3,%eax
+  801ed9:	83 f8 01             	cmp    $0x1,%eax
+  801edc:	74 2d                	je     801f0b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ede:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ee2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ee6:	48 85 c0             	test   %rax,%rax
+  801ee9:	74 56                	je     801f41 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801eeb:	4c 89 ea             	mov    %r13,%rdx
+  801eee:	4c 89 e6             	mov    %r12,%rsi
+  801ef1:	4c 89 f7             	mov    %r14,%rdi
+  801ef4:	ff d0                	call   *%rax
+}
+  801ef6:	48 83 c4 10          	add    $0x10,%rsp
+  801efa:	5b                   	pop    %rbx
+  801efb:	41 5c                	pop    %r12
+  801efd:	41 5d                	pop    %r13
+  801eff:	41 5e                	pop    %r14
+  801f01:	5d                   	pop    %rbp
+  801f02:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f03:	48 98                	cltq
+  801f05:	eb ef                	jmp    801ef6 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f07:	48 98                	cltq
+  801f09:	eb eb                	jmp    801ef6 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f0b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f12:	00 00 00 
+  801f15:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f1b:	89 da                	mov    %ebx,%edx
+  801f1d:	48 bf 91 38 80 00 00 	movabs $0x803891,%rdi
+  801f24:	00 00 00 
+  801f27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2c:	48 b9 27 03 80 00 00 	movabs $0x800327,%rcx
+  801f33:	00 00 00 
+  801f36:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f38:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f3f:	eb b5                	jmp    801ef6 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f41:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f48:	eb ac                	jmp    801ef6 <read+0x6a>
+
+0000000000801f4a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801f4a:	55                   	push   %rbp
+  801f4b:	48 89 e5             	mov    %rsp,%rbp
+  801f4e:	41 57                	push   %r15
+  801f50:	41 56                	push   %r14
+  801f52:	41 55                	push   %r13
+  801f54:	41 54                	push   %r12
+  801f56:	53                   	push   %rbx
+  801f57:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801f5b:	48 85 d2             	test   %rdx,%rdx
+  801f5e:	74 54                	je     801fb4 <readn+0x6a>
+  801f60:	41 89 fd             	mov    %edi,%r13d
+  801f63:	49 89 f6             	mov    %rsi,%r14
+  801f66:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801f69:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801f6e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801f73:	49 bf 8c 1e 80 00 00 	movabs $0x801e8c,%r15
+  801f7a:	00 00 00 
+  801f7d:	4c 89 e2             	mov    %r12,%rdx
+  801f80:	48 29 f2             	sub    %rsi,%rdx
+  801f83:	4c 01 f6             	add    %r14,%rsi
+  801f86:	44 89 ef             	mov    %r13d,%edi
+  801f89:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801f8c:	85 c0                	test   %eax,%eax
+  801f8e:	78 20                	js     801fb0 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801f90:	01 c3                	add    %eax,%ebx
+  801f92:	85 c0                	test   %eax,%eax
+  801f94:	74 08                	je     801f9e <readn+0x54>
+  801f96:	48 63 f3             	movslq %ebx,%rsi
+  801f99:	4c 39 e6             	cmp    %r12,%rsi
+  801f9c:	72 df                	jb     801f7d <readn+0x33>
+    }
+    return res;
+  801f9e:	48 63 c3             	movslq %ebx,%rax
+}
+  801fa1:	48 83 c4 08          	add    $0x8,%rsp
+  801fa5:	5b                   	pop    %rbx
+  801fa6:	41 5c                	pop    %r12
+  801fa8:	41 5d                	pop    %r13
+  801faa:	41 5e                	pop    %r14
+  801fac:	41 5f                	pop    %r15
+  801fae:	5d                   	pop    %rbp
+  801faf:	c3                   	ret
+        if (inc < 0) return inc;
+  801fb0:	48 98                	cltq
+  801fb2:	eb ed                	jmp    801fa1 <readn+0x57>
+    int inc = 1, res = 0;
+  801fb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fb9:	eb e3                	jmp    801f9e <readn+0x54>
+
+0000000000801fbb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801fbb:	55                   	push   %rbp
+  801fbc:	48 89 e5             	mov    %rsp,%rbp
+  801fbf:	41 56                	push   %r14
+  801fc1:	41 55                	push   %r13
+  801fc3:	41 54                	push   %r12
+  801fc5:	53                   	push   %rbx
+  801fc6:	48 83 ec 10          	sub    $0x10,%rsp
+  801fca:	89 fb                	mov    %edi,%ebx
+  801fcc:	49 89 f4             	mov    %rsi,%r12
+  801fcf:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fd2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fd6:	48 b8 a9 1b 80 00 00 	movabs $0x801ba9,%rax
+  801fdd:	00 00 00 
+  801fe0:	ff d0                	call   *%rax
+  801fe2:	85 c0                	test   %eax,%eax
+  801fe4:	78 47                	js     80202d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fe6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801fea:	41 8b 3e             	mov    (%r14),%edi
+  801fed:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ff1:	48 b8 f4 1b 80 00 00 	movabs $0x801bf4,%rax
+  801ff8:	00 00 00 
+  801ffb:	ff d0                	call   *%rax
+  801ffd:	85 c0                	test   %eax,%eax
+  801fff:	78 30                	js     802031 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802001:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802006:	74 2d                	je     802035 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802008:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80200c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802010:	48 85 c0             	test   %rax,%rax
+  802013:	74 56                	je     80206b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802015:	4c 89 ea             	mov    %r13,%rdx
+  802018:	4c 89 e6             	mov    %r12,%rsi
+  80201b:	4c 89 f7             	mov    %r14,%rdi
+  80201e:	ff d0                	call   *%rax
+}
+  802020:	48 83 c4 10          	add    $0x10,%rsp
+  802024:	5b                   	pop    %rbx
+  802025:	41 5c                	pop    %r12
+  802027:	41 5d                	pop    %r13
+  802029:	41 5e                	pop    %r14
+  80202b:	5d                   	pop    %rbp
+  80202c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80202d:	48 98                	cltq
+  80202f:	eb ef                	jmp    802020 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802031:	48 98                	cltq
+  802033:	eb eb                	jmp    802020 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802035:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80203c:	00 00 00 
+  80203f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802045:	89 da                	mov    %ebx,%edx
+  802047:	48 bf ad 38 80 00 00 	movabs $0x8038ad,%rdi
+  80204e:	00 00 00 
+  802051:	b8 00 00 00 00       	mov    $0x0,%eax
+  802056:	48 b9 27 03 80 00 00 	movabs $0x800327,%rcx
+  80205d:	00 00 00 
+  802060:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802062:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802069:	eb b5                	jmp    802020 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80206b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802072:	eb ac                	jmp    802020 <write+0x65>
+
+0000000000802074 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802074:	55                   	push   %rbp
+  802075:	48 89 e5             	mov    %rsp,%rbp
+  802078:	53                   	push   %rbx
+  802079:	48 83 ec 18          	sub    $0x18,%rsp
+  80207d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80207f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802083:	48 b8 a9 1b 80 00 00 	movabs $0x801ba9,%rax
+  80208a:	00 00 00 
+  80208d:	ff d0                	call   *%rax
+  80208f:	85 c0                	test   %eax,%eax
+  802091:	78 0c                	js     80209f <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802093:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802097:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80209a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80209f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020a3:	c9                   	leave
+  8020a4:	c3                   	ret
+
+00000000008020a5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8020a5:	55                   	push   %rbp
+  8020a6:	48 89 e5             	mov    %rsp,%rbp
+  8020a9:	41 55                	push   %r13
+  8020ab:	41 54                	push   %r12
+  8020ad:	53                   	push   %rbx
+  8020ae:	48 83 ec 18          	sub    $0x18,%rsp
+  8020b2:	89 fb                	mov    %edi,%ebx
+  8020b4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020b7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020bb:	48 b8 a9 1b 80 00 00 	movabs $0x801ba9,%rax
+  8020c2:	00 00 00 
+  8020c5:	ff d0                	call   *%rax
+  8020c7:	85 c0                	test   %eax,%eax
+  8020c9:	78 38                	js     802103 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020cb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8020cf:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8020d3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020d7:	48 b8 f4 1b 80 00 00 	movabs $0x801bf4,%rax
+  8020de:	00 00 00 
+  8020e1:	ff d0                	call   *%rax
+  8020e3:	85 c0                	test   %eax,%eax
+  8020e5:	78 1c                	js     802103 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020e7:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8020ec:	74 20                	je     80210e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020ee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020f2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8020f6:	48 85 c0             	test   %rax,%rax
+  8020f9:	74 47                	je     802142 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8020fb:	44 89 e6             	mov    %r12d,%esi
+  8020fe:	4c 89 ef             	mov    %r13,%rdi
+  802101:	ff d0                	call   *%rax
+}
+  802103:	48 83 c4 18          	add    $0x18,%rsp
+  802107:	5b                   	pop    %rbx
+  802108:	41 5c                	pop    %r12
+  80210a:	41 5d                	pop    %r13
+  80210c:	5d                   	pop    %rbp
+  80210d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80210e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802115:	00 00 00 
+  802118:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80211e:	89 da                	mov    %ebx,%edx
+  802120:	48 bf 70 38 80 00 00 	movabs $0x803870,%rdi
+  802127:	00 00 00 
+  80212a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80212f:	48 b9 27 03 80 00 00 	movabs $0x800327,%rcx
+  802136:	00 00 00 
+  802139:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80213b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802140:	eb c1                	jmp    802103 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802142:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802147:	eb ba                	jmp    802103 <ftruncate+0x5e>
+
+0000000000802149 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802149:	55                   	push   %rbp
+  80214a:	48 89 e5             	mov    %rsp,%rbp
+  80214d:	41 54                	push   %r12
+  80214f:	53                   	push   %rbx
+  802150:	48 83 ec 10          	sub    $0x10,%rsp
+  802154:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802157:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80215b:	48 b8 a9 1b 80 00 00 	movabs $0x801ba9,%rax
+  802162:	00 00 00 
+  802165:	ff d0                	call   *%rax
+  802167:	85 c0                	test   %eax,%eax
+  802169:	78 4e                	js     8021b9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80216b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80216f:	41 8b 3c 24          	mov    (%r12),%edi
+  802173:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802177:	48 b8 f4 1b 80 00 00 	movabs $0x801bf4,%rax
+  80217e:	00 00 00 
+  802181:	ff d0                	call   *%rax
+  802183:	85 c0                	test   %eax,%eax
+  802185:	78 32                	js     8021b9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802187:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80218b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802190:	74 30                	je     8021c2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802192:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802195:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80219c:	00 00 00 
+    stat->st_isdir = 0;
+  80219f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8021a6:	00 00 00 
+    stat->st_dev = dev;
+  8021a9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8021b0:	48 89 de             	mov    %rbx,%rsi
+  8021b3:	4c 89 e7             	mov    %r12,%rdi
+  8021b6:	ff 50 28             	call   *0x28(%rax)
+}
+  8021b9:	48 83 c4 10          	add    $0x10,%rsp
+  8021bd:	5b                   	pop    %rbx
+  8021be:	41 5c                	pop    %r12
+  8021c0:	5d                   	pop    %rbp
+  8021c1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8021c2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021c7:	eb f0                	jmp    8021b9 <fstat+0x70>
+
+00000000008021c9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8021c9:	55                   	push   %rbp
+  8021ca:	48 89 e5             	mov    %rsp,%rbp
+  8021cd:	41 54                	push   %r12
+  8021cf:	53                   	push   %rbx
+  8021d0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8021d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8021d8:	48 b8 4a 24 80 00 00 	movabs $0x80244a,%rax
+  8021df:	00 00 00 
+  8021e2:	ff d0                	call   *%rax
+  8021e4:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8021e6:	85 c0                	test   %eax,%eax
+  8021e8:	78 25                	js     80220f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8021ea:	4c 89 e6             	mov    %r12,%rsi
+  8021ed:	89 c7                	mov    %eax,%edi
+  8021ef:	48 b8 49 21 80 00 00 	movabs $0x802149,%rax
+  8021f6:	00 00 00 
+  8021f9:	ff d0                	call   *%rax
+  8021fb:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8021fe:	89 df                	mov    %ebx,%edi
+  802200:	48 b8 0e 1d 80 00 00 	movabs $0x801d0e,%rax
+  802207:	00 00 00 
+  80220a:	ff d0                	call   *%rax
+
+    return res;
+  80220c:	44 89 e3             	mov    %r12d,%ebx
+}
+  80220f:	89 d8                	mov    %ebx,%eax
+  802211:	5b                   	pop    %rbx
+  802212:	41 5c                	pop    %r12
+  802214:	5d                   	pop    %rbp
+  802215:	c3                   	ret
+
+0000000000802216 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802216:	55                   	push   %rbp
+  802217:	48 89 e5             	mov    %rsp,%rbp
+  80221a:	41 54                	push   %r12
+  80221c:	53                   	push   %rbx
+  80221d:	48 83 ec 10          	sub    $0x10,%rsp
+  802221:	41 89 fc             	mov    %edi,%r12d
+  802224:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802227:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80222e:	00 00 00 
+  802231:	83 38 00             	cmpl   $0x0,(%rax)
+  802234:	74 5e                	je     802294 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802236:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80223c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802241:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802248:	00 00 00 
+  80224b:	44 89 e6             	mov    %r12d,%esi
+  80224e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802255:	00 00 00 
+  802258:	8b 38                	mov    (%rax),%edi
+  80225a:	48 b8 60 30 80 00 00 	movabs $0x803060,%rax
+  802261:	00 00 00 
+  802264:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802266:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80226d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80226e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802273:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802277:	48 89 de             	mov    %rbx,%rsi
+  80227a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80227f:	48 b8 cb 2f 80 00 00 	movabs $0x802fcb,%rax
+  802286:	00 00 00 
+  802289:	ff d0                	call   *%rax
+}
+  80228b:	48 83 c4 10          	add    $0x10,%rsp
+  80228f:	5b                   	pop    %rbx
+  802290:	41 5c                	pop    %r12
+  802292:	5d                   	pop    %rbp
+  802293:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802294:	bf 03 00 00 00       	mov    $0x3,%edi
+  802299:	48 b8 00 31 80 00 00 	movabs $0x803100,%rax
+  8022a0:	00 00 00 
+  8022a3:	ff d0                	call   *%rax
+  8022a5:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8022ac:	00 00 
+  8022ae:	eb 86                	jmp    802236 <fsipc+0x20>
+
+00000000008022b0 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8022b0:	55                   	push   %rbp
+  8022b1:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8022b4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022bb:	00 00 00 
+  8022be:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8022c1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8022c3:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8022c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8022cb:	bf 02 00 00 00       	mov    $0x2,%edi
+  8022d0:	48 b8 16 22 80 00 00 	movabs $0x802216,%rax
+  8022d7:	00 00 00 
+  8022da:	ff d0                	call   *%rax
+}
+  8022dc:	5d                   	pop    %rbp
+  8022dd:	c3                   	ret
+
+00000000008022de <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8022de:	55                   	push   %rbp
+  8022df:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8022e2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8022e5:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8022ec:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8022ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f3:	bf 06 00 00 00       	mov    $0x6,%edi
+  8022f8:	48 b8 16 22 80 00 00 	movabs $0x802216,%rax
+  8022ff:	00 00 00 
+  802302:	ff d0                	call   *%rax
+}
+  802304:	5d                   	pop    %rbp
+  802305:	c3                   	ret
+
+0000000000802306 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802306:	55                   	push   %rbp
+  802307:	48 89 e5             	mov    %rsp,%rbp
+  80230a:	41 54                	push   %r12
+  80230c:	53                   	push   %rbx
+  80230d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802310:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802313:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80231a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80231c:	be 00 00 00 00       	mov    $0x0,%esi
+  802321:	bf 05 00 00 00       	mov    $0x5,%edi
+  802326:	48 b8 16 22 80 00 00 	movabs $0x802216,%rax
+  80232d:	00 00 00 
+  802330:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802332:	85 c0                	test   %eax,%eax
+  802334:	78 3d                	js     802373 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802336:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80233d:	00 00 00 
+  802340:	4c 89 e6             	mov    %r12,%rsi
+  802343:	48 89 df             	mov    %rbx,%rdi
+  802346:	48 b8 4c 0c 80 00 00 	movabs $0x800c4c,%rax
+  80234d:	00 00 00 
+  802350:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802352:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802359:	00 
+  80235a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802360:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802367:	00 
+  802368:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80236e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802373:	5b                   	pop    %rbx
+  802374:	41 5c                	pop    %r12
+  802376:	5d                   	pop    %rbp
+  802377:	c3                   	ret
+
+0000000000802378 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802378:	55                   	push   %rbp
+  802379:	48 89 e5             	mov    %rsp,%rbp
+  80237c:	41 54                	push   %r12
+  80237e:	53                   	push   %rbx
+  80237f:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  802382:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802387:	48 39 c2             	cmp    %rax,%rdx
+  80238a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80238e:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802391:	48 89 c2             	mov    %rax,%rdx
+  802394:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80239b:	00 00 00 
+  80239e:	48 b8 ad 0e 80 00 00 	movabs $0x800ead,%rax
+  8023a5:	00 00 00 
+  8023a8:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8023aa:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023b1:	00 00 00 
+  8023b4:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8023b9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8023bb:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8023bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8023c9:	48 b8 16 22 80 00 00 	movabs $0x802216,%rax
+  8023d0:	00 00 00 
+  8023d3:	ff d0                	call   *%rax
+  8023d5:	48 98                	cltq
+}
+  8023d7:	5b                   	pop    %rbx
+  8023d8:	41 5c                	pop    %r12
+  8023da:	5d                   	pop    %rbp
+  8023db:	c3                   	ret
+
+00000000008023dc <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023dc:	55                   	push   %rbp
+  8023dd:	48 89 e5             	mov    %rsp,%rbp
+  8023e0:	41 54                	push   %r12
+  8023e2:	53                   	push   %rbx
+  8023e3:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023e6:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023ed:	00 00 00 
+  8023f0:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8023f3:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8023f5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8023fa:	48 39 ca             	cmp    %rcx,%rdx
+  8023fd:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  802401:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  802405:	be 00 00 00 00       	mov    $0x0,%esi
+  80240a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80240f:	48 b8 16 22 80 00 00 	movabs $0x802216,%rax
+  802416:	00 00 00 
+  802419:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  80241b:	85 c0                	test   %eax,%eax
+  80241d:	78 27                	js     802446 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  80241f:	48 63 d8             	movslq %eax,%rbx
+  802422:	48 89 da             	mov    %rbx,%rdx
+  802425:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80242c:	00 00 00 
+  80242f:	4c 89 e7             	mov    %r12,%rdi
+  802432:	48 b8 ad 0e 80 00 00 	movabs $0x800ead,%rax
+  802439:	00 00 00 
+  80243c:	ff d0                	call   *%rax
+    return bytes_read;
+  80243e:	48 89 d8             	mov    %rbx,%rax
+}
+  802441:	5b                   	pop    %rbx
+  802442:	41 5c                	pop    %r12
+  802444:	5d                   	pop    %rbp
+  802445:	c3                   	ret
+        return bytes_read;
+  802446:	48 98                	cltq
+  802448:	eb f7                	jmp    802441 <devfile_read+0x65>
+
+000000000080244a <open>:
+open(const char *path, int mode) {
+  80244a:	55                   	push   %rbp
+  80244b:	48 89 e5             	mov    %rsp,%rbp
+  80244e:	41 55                	push   %r13
+  802450:	41 54                	push   %r12
+  802452:	53                   	push   %rbx
+  802453:	48 83 ec 18          	sub    $0x18,%rsp
+  802457:	49 89 fc             	mov    %rdi,%r12
+  80245a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80245d:	48 b8 0e 0c 80 00 00 	movabs $0x800c0e,%rax
+  802464:	00 00 00 
+  802467:	ff d0                	call   *%rax
+  802469:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80246f:	0f 87 8a 00 00 00    	ja     8024ff <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802475:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802479:	48 b8 49 1b 80 00 00 	movabs $0x801b49,%rax
+  802480:	00 00 00 
+  802483:	ff d0                	call   *%rax
+  802485:	89 c3                	mov    %eax,%ebx
+  802487:	85 c0                	test   %eax,%eax
+  802489:	78 50                	js     8024db <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80248b:	4c 89 e6             	mov    %r12,%rsi
+  80248e:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802495:	00 00 00 
+  802498:	48 89 df             	mov    %rbx,%rdi
+  80249b:	48 b8 4c 0c 80 00 00 	movabs $0x800c4c,%rax
+  8024a2:	00 00 00 
+  8024a5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8024a7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8024ae:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8024b2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8024b7:	48 b8 16 22 80 00 00 	movabs $0x802216,%rax
+  8024be:	00 00 00 
+  8024c1:	ff d0                	call   *%rax
+  8024c3:	89 c3                	mov    %eax,%ebx
+  8024c5:	85 c0                	test   %eax,%eax
+  8024c7:	78 1f                	js     8024e8 <open+0x9e>
+    return fd2num(fd);
+  8024c9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024cd:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  8024d4:	00 00 00 
+  8024d7:	ff d0                	call   *%rax
+  8024d9:	89 c3                	mov    %eax,%ebx
+}
+  8024db:	89 d8                	mov    %ebx,%eax
+  8024dd:	48 83 c4 18          	add    $0x18,%rsp
+  8024e1:	5b                   	pop    %rbx
+  8024e2:	41 5c                	pop    %r12
+  8024e4:	41 5d                	pop    %r13
+  8024e6:	5d                   	pop    %rbp
+  8024e7:	c3                   	ret
+        fd_close(fd, 0);
+  8024e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ed:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024f1:	48 b8 64 1c 80 00 00 	movabs $0x801c64,%rax
+  8024f8:	00 00 00 
+  8024fb:	ff d0                	call   *%rax
+        return res;
+  8024fd:	eb dc                	jmp    8024db <open+0x91>
+        return -E_BAD_PATH;
+  8024ff:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802504:	eb d5                	jmp    8024db <open+0x91>
+
+0000000000802506 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802506:	55                   	push   %rbp
+  802507:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80250a:	be 00 00 00 00       	mov    $0x0,%esi
+  80250f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802514:	48 b8 16 22 80 00 00 	movabs $0x802216,%rax
+  80251b:	00 00 00 
+  80251e:	ff d0                	call   *%rax
+}
+  802520:	5d                   	pop    %rbp
+  802521:	c3                   	ret
+
+0000000000802522 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802522:	55                   	push   %rbp
+  802523:	48 89 e5             	mov    %rsp,%rbp
+  802526:	41 54                	push   %r12
+  802528:	53                   	push   %rbx
+  802529:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80252c:	48 b8 2d 1b 80 00 00 	movabs $0x801b2d,%rax
+  802533:	00 00 00 
+  802536:	ff d0                	call   *%rax
+  802538:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80253b:	48 be 00 39 80 00 00 	movabs $0x803900,%rsi
+  802542:	00 00 00 
+  802545:	48 89 df             	mov    %rbx,%rdi
+  802548:	48 b8 4c 0c 80 00 00 	movabs $0x800c4c,%rax
+  80254f:	00 00 00 
+  802552:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802554:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802559:	41 2b 04 24          	sub    (%r12),%eax
+  80255d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802563:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80256a:	00 00 00 
+    stat->st_dev = &devpipe;
+  80256d:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802574:	00 00 00 
+  802577:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80257e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802583:	5b                   	pop    %rbx
+  802584:	41 5c                	pop    %r12
+  802586:	5d                   	pop    %rbp
+  802587:	c3                   	ret
+
+0000000000802588 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802588:	55                   	push   %rbp
+  802589:	48 89 e5             	mov    %rsp,%rbp
+  80258c:	41 54                	push   %r12
+  80258e:	53                   	push   %rbx
+  80258f:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802592:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802597:	48 89 fe             	mov    %rdi,%rsi
+  80259a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80259f:	49 bc c8 12 80 00 00 	movabs $0x8012c8,%r12
+  8025a6:	00 00 00 
+  8025a9:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8025ac:	48 89 df             	mov    %rbx,%rdi
+  8025af:	48 b8 2d 1b 80 00 00 	movabs $0x801b2d,%rax
+  8025b6:	00 00 00 
+  8025b9:	ff d0                	call   *%rax
+  8025bb:	48 89 c6             	mov    %rax,%rsi
+  8025be:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025c8:	41 ff d4             	call   *%r12
+}
+  8025cb:	5b                   	pop    %rbx
+  8025cc:	41 5c                	pop    %r12
+  8025ce:	5d                   	pop    %rbp
+  8025cf:	c3                   	ret
+
+00000000008025d0 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8025d0:	55                   	push   %rbp
+  8025d1:	48 89 e5             	mov    %rsp,%rbp
+  8025d4:	41 57                	push   %r15
+  8025d6:	41 56                	push   %r14
+  8025d8:	41 55                	push   %r13
+  8025da:	41 54                	push   %r12
+  8025dc:	53                   	push   %rbx
+  8025dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8025e1:	49 89 fc             	mov    %rdi,%r12
+  8025e4:	49 89 f5             	mov    %rsi,%r13
+  8025e7:	49 89 d7             	mov    %rdx,%r15
+  8025ea:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025ee:	48 b8 2d 1b 80 00 00 	movabs $0x801b2d,%rax
+  8025f5:	00 00 00 
+  8025f8:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8025fa:	4d 85 ff             	test   %r15,%r15
+  8025fd:	0f 84 af 00 00 00    	je     8026b2 <devpipe_write+0xe2>
+  802603:	48 89 c3             	mov    %rax,%rbx
+  802606:	4c 89 f8             	mov    %r15,%rax
+  802609:	4d 89 ef             	mov    %r13,%r15
+  80260c:	4c 01 e8             	add    %r13,%rax
+  80260f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802613:	49 bd d0 11 80 00 00 	movabs $0x8011d0,%r13
+  80261a:	00 00 00 
+            sys_yield();
+  80261d:	49 be 6d 11 80 00 00 	movabs $0x80116d,%r14
+  802624:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802627:	8b 73 04             	mov    0x4(%rbx),%esi
+  80262a:	48 63 ce             	movslq %esi,%rcx
+  80262d:	48 63 03             	movslq (%rbx),%rax
+  802630:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802636:	48 39 c1             	cmp    %rax,%rcx
+  802639:	72 2e                	jb     802669 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80263b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802640:	48 89 da             	mov    %rbx,%rdx
+  802643:	be 00 10 00 00       	mov    $0x1000,%esi
+  802648:	4c 89 e7             	mov    %r12,%rdi
+  80264b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80264e:	85 c0                	test   %eax,%eax
+  802650:	74 66                	je     8026b8 <devpipe_write+0xe8>
+            sys_yield();
+  802652:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802655:	8b 73 04             	mov    0x4(%rbx),%esi
+  802658:	48 63 ce             	movslq %esi,%rcx
+  80265b:	48 63 03             	movslq (%rbx),%rax
+  80265e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802664:	48 39 c1             	cmp    %rax,%rcx
+  802667:	73 d2                	jae    80263b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802669:	41 0f b6 3f          	movzbl (%r15),%edi
+  80266d:	48 89 ca             	mov    %rcx,%rdx
+  802670:	48 c1 ea 03          	shr    $0x3,%rdx
+  802674:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80267b:	08 10 20 
+  80267e:	48 f7 e2             	mul    %rdx
+  802681:	48 c1 ea 06          	shr    $0x6,%rdx
+  802685:	48 89 d0             	mov    %rdx,%rax
+  802688:	48 c1 e0 09          	shl    $0x9,%rax
+  80268c:	48 29 d0             	sub    %rdx,%rax
+  80268f:	48 c1 e0 03          	shl    $0x3,%rax
+  802693:	48 29 c1             	sub    %rax,%rcx
+  802696:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80269b:	83 c6 01             	add    $0x1,%esi
+  80269e:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8026a1:	49 83 c7 01          	add    $0x1,%r15
+  8026a5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026a9:	49 39 c7             	cmp    %rax,%r15
+  8026ac:	0f 85 75 ff ff ff    	jne    802627 <devpipe_write+0x57>
+    return n;
+  8026b2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8026b6:	eb 05                	jmp    8026bd <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8026b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026bd:	48 83 c4 18          	add    $0x18,%rsp
+  8026c1:	5b                   	pop    %rbx
+  8026c2:	41 5c                	pop    %r12
+  8026c4:	41 5d                	pop    %r13
+  8026c6:	41 5e                	pop    %r14
+  8026c8:	41 5f                	pop    %r15
+  8026ca:	5d                   	pop    %rbp
+  8026cb:	c3                   	ret
+
+00000000008026cc <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8026cc:	55                   	push   %rbp
+  8026cd:	48 89 e5             	mov    %rsp,%rbp
+  8026d0:	41 57                	push   %r15
+  8026d2:	41 56                	push   %r14
+  8026d4:	41 55                	push   %r13
+  8026d6:	41 54                	push   %r12
+  8026d8:	53                   	push   %rbx
+  8026d9:	48 83 ec 18          	sub    $0x18,%rsp
+  8026dd:	49 89 fc             	mov    %rdi,%r12
+  8026e0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8026e4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8026e8:	48 b8 2d 1b 80 00 00 	movabs $0x801b2d,%rax
+  8026ef:	00 00 00 
+  8026f2:	ff d0                	call   *%rax
+  8026f4:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8026f7:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026fd:	49 bd d0 11 80 00 00 	movabs $0x8011d0,%r13
+  802704:	00 00 00 
+            sys_yield();
+  802707:	49 be 6d 11 80 00 00 	movabs $0x80116d,%r14
+  80270e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802711:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802716:	74 7d                	je     802795 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802718:	8b 03                	mov    (%rbx),%eax
+  80271a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80271d:	75 26                	jne    802745 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80271f:	4d 85 ff             	test   %r15,%r15
+  802722:	75 77                	jne    80279b <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802724:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802729:	48 89 da             	mov    %rbx,%rdx
+  80272c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802731:	4c 89 e7             	mov    %r12,%rdi
+  802734:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802737:	85 c0                	test   %eax,%eax
+  802739:	74 72                	je     8027ad <devpipe_read+0xe1>
+            sys_yield();
+  80273b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80273e:	8b 03                	mov    (%rbx),%eax
+  802740:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802743:	74 df                	je     802724 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802745:	48 63 c8             	movslq %eax,%rcx
+  802748:	48 89 ca             	mov    %rcx,%rdx
+  80274b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80274f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802756:	08 10 20 
+  802759:	48 89 d0             	mov    %rdx,%rax
+  80275c:	48 f7 e6             	mul    %rsi
+  80275f:	48 c1 ea 06          	shr    $0x6,%rdx
+  802763:	48 89 d0             	mov    %rdx,%rax
+  802766:	48 c1 e0 09          	shl    $0x9,%rax
+  80276a:	48 29 d0             	sub    %rdx,%rax
+  80276d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802774:	00 
+  802775:	48 89 c8             	mov    %rcx,%rax
+  802778:	48 29 d0             	sub    %rdx,%rax
+  80277b:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802780:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802784:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802788:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80278b:	49 83 c7 01          	add    $0x1,%r15
+  80278f:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802793:	75 83                	jne    802718 <devpipe_read+0x4c>
+    return n;
+  802795:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802799:	eb 03                	jmp    80279e <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80279b:	4c 89 f8             	mov    %r15,%rax
+}
+  80279e:	48 83 c4 18          	add    $0x18,%rsp
+  8027a2:	5b                   	pop    %rbx
+  8027a3:	41 5c                	pop    %r12
+  8027a5:	41 5d                	pop    %r13
+  8027a7:	41 5e                	pop    %r14
+  8027a9:	41 5f                	pop    %r15
+  8027ab:	5d                   	pop    %rbp
+  8027ac:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8027ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b2:	eb ea                	jmp    80279e <devpipe_read+0xd2>
+
+00000000008027b4 <pipe>:
+pipe(int pfd[2]) {
+  8027b4:	55                   	push   %rbp
+  8027b5:	48 89 e5             	mov    %rsp,%rbp
+  8027b8:	41 55                	push   %r13
+  8027ba:	41 54                	push   %r12
+  8027bc:	53                   	push   %rbx
+  8027bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8027c1:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027c4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8027c8:	48 b8 49 1b 80 00 00 	movabs $0x801b49,%rax
+  8027cf:	00 00 00 
+  8027d2:	ff d0                	call   *%rax
+  8027d4:	89 c3                	mov    %eax,%ebx
+  8027d6:	85 c0                	test   %eax,%eax
+  8027d8:	0f 88 a0 01 00 00    	js     80297e <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8027de:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027e8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8027ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027f1:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  8027f8:	00 00 00 
+  8027fb:	ff d0                	call   *%rax
+  8027fd:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027ff:	85 c0                	test   %eax,%eax
+  802801:	0f 88 77 01 00 00    	js     80297e <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802807:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80280b:	48 b8 49 1b 80 00 00 	movabs $0x801b49,%rax
+  802812:	00 00 00 
+  802815:	ff d0                	call   *%rax
+  802817:	89 c3                	mov    %eax,%ebx
+  802819:	85 c0                	test   %eax,%eax
+  80281b:	0f 88 43 01 00 00    	js     802964 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802821:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802826:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80282b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80282f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802834:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  80283b:	00 00 00 
+  80283e:	ff d0                	call   *%rax
+  802840:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802842:	85 c0                	test   %eax,%eax
+  802844:	0f 88 1a 01 00 00    	js     802964 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80284a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80284e:	48 b8 2d 1b 80 00 00 	movabs $0x801b2d,%rax
+  802855:	00 00 00 
+  802858:	ff d0                	call   *%rax
+  80285a:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80285d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802862:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802867:	48 89 c6             	mov    %rax,%rsi
+  80286a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80286f:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  802876:	00 00 00 
+  802879:	ff d0                	call   *%rax
+  80287b:	89 c3                	mov    %eax,%ebx
+  80287d:	85 c0                	test   %eax,%eax
+  80287f:	0f 88 c5 00 00 00    	js     80294a <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802885:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802889:	48 b8 2d 1b 80 00 00 	movabs $0x801b2d,%rax
+  802890:	00 00 00 
+  802893:	ff d0                	call   *%rax
+  802895:	48 89 c1             	mov    %rax,%rcx
+  802898:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80289e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8028a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028a9:	4c 89 ee             	mov    %r13,%rsi
+  8028ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028b1:	48 b8 63 12 80 00 00 	movabs $0x801263,%rax
+  8028b8:	00 00 00 
+  8028bb:	ff d0                	call   *%rax
+  8028bd:	89 c3                	mov    %eax,%ebx
+  8028bf:	85 c0                	test   %eax,%eax
+  8028c1:	78 6e                	js     802931 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028c3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028c8:	4c 89 ef             	mov    %r13,%rdi
+  8028cb:	48 b8 9e 11 80 00 00 	movabs $0x80119e,%rax
+  8028d2:	00 00 00 
+  8028d5:	ff d0                	call   *%rax
+  8028d7:	83 f8 02             	cmp    $0x2,%eax
+  8028da:	0f 85 ab 00 00 00    	jne    80298b <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8028e0:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8028e7:	00 00 
+  8028e9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028ed:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8028ef:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028f3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8028fa:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8028fe:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802900:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802904:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80290b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80290f:	48 bb 1b 1b 80 00 00 	movabs $0x801b1b,%rbx
+  802916:	00 00 00 
+  802919:	ff d3                	call   *%rbx
+  80291b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80291f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802923:	ff d3                	call   *%rbx
+  802925:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80292a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80292f:	eb 4d                	jmp    80297e <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802931:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802936:	4c 89 ee             	mov    %r13,%rsi
+  802939:	bf 00 00 00 00       	mov    $0x0,%edi
+  80293e:	48 b8 c8 12 80 00 00 	movabs $0x8012c8,%rax
+  802945:	00 00 00 
+  802948:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80294a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80294f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802953:	bf 00 00 00 00       	mov    $0x0,%edi
+  802958:	48 b8 c8 12 80 00 00 	movabs $0x8012c8,%rax
+  80295f:	00 00 00 
+  802962:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802964:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802969:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80296d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802972:	48 b8 c8 12 80 00 00 	movabs $0x8012c8,%rax
+  802979:	00 00 00 
+  80297c:	ff d0                	call   *%rax
+}
+  80297e:	89 d8                	mov    %ebx,%eax
+  802980:	48 83 c4 18          	add    $0x18,%rsp
+  802984:	5b                   	pop    %rbx
+  802985:	41 5c                	pop    %r12
+  802987:	41 5d                	pop    %r13
+  802989:	5d                   	pop    %rbp
+  80298a:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80298b:	48 b9 18 39 80 00 00 	movabs $0x803918,%rcx
+  802992:	00 00 00 
+  802995:	48 ba 37 38 80 00 00 	movabs $0x803837,%rdx
+  80299c:	00 00 00 
+  80299f:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8029a4:	48 bf 07 39 80 00 00 	movabs $0x803907,%rdi
+  8029ab:	00 00 00 
+  8029ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b3:	49 b8 d7 01 80 00 00 	movabs $0x8001d7,%r8
+  8029ba:	00 00 00 
+  8029bd:	41 ff d0             	call   *%r8
+
+00000000008029c0 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8029c0:	55                   	push   %rbp
+  8029c1:	48 89 e5             	mov    %rsp,%rbp
+  8029c4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8029c8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8029cc:	48 b8 a9 1b 80 00 00 	movabs $0x801ba9,%rax
+  8029d3:	00 00 00 
+  8029d6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029d8:	85 c0                	test   %eax,%eax
+  8029da:	78 35                	js     802a11 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8029dc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029e0:	48 b8 2d 1b 80 00 00 	movabs $0x801b2d,%rax
+  8029e7:	00 00 00 
+  8029ea:	ff d0                	call   *%rax
+  8029ec:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8029ef:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029f4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029f9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029fd:	48 b8 d0 11 80 00 00 	movabs $0x8011d0,%rax
+  802a04:	00 00 00 
+  802a07:	ff d0                	call   *%rax
+  802a09:	85 c0                	test   %eax,%eax
+  802a0b:	0f 94 c0             	sete   %al
+  802a0e:	0f b6 c0             	movzbl %al,%eax
+}
+  802a11:	c9                   	leave
+  802a12:	c3                   	ret
+
+0000000000802a13 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a13:	48 89 f8             	mov    %rdi,%rax
+  802a16:	48 c1 e8 27          	shr    $0x27,%rax
+  802a1a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a21:	01 00 00 
+  802a24:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a28:	f6 c2 01             	test   $0x1,%dl
+  802a2b:	74 6d                	je     802a9a <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a2d:	48 89 f8             	mov    %rdi,%rax
+  802a30:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a34:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a3b:	01 00 00 
+  802a3e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a42:	f6 c2 01             	test   $0x1,%dl
+  802a45:	74 62                	je     802aa9 <get_uvpt_entry+0x96>
+  802a47:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a4e:	01 00 00 
+  802a51:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a55:	f6 c2 80             	test   $0x80,%dl
+  802a58:	75 4f                	jne    802aa9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a5a:	48 89 f8             	mov    %rdi,%rax
+  802a5d:	48 c1 e8 15          	shr    $0x15,%rax
+  802a61:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a68:	01 00 00 
+  802a6b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a6f:	f6 c2 01             	test   $0x1,%dl
+  802a72:	74 44                	je     802ab8 <get_uvpt_entry+0xa5>
+  802a74:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a7b:	01 00 00 
+  802a7e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a82:	f6 c2 80             	test   $0x80,%dl
+  802a85:	75 31                	jne    802ab8 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a87:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a8b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a92:	01 00 00 
+  802a95:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a99:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a9a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802aa1:	01 00 00 
+  802aa4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802aa8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802aa9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802ab0:	01 00 00 
+  802ab3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ab7:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802ab8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802abf:	01 00 00 
+  802ac2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ac6:	c3                   	ret
+
+0000000000802ac7 <get_prot>:
+
+int
+get_prot(void *va) {
+  802ac7:	55                   	push   %rbp
+  802ac8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802acb:	48 b8 13 2a 80 00 00 	movabs $0x802a13,%rax
+  802ad2:	00 00 00 
+  802ad5:	ff d0                	call   *%rax
+  802ad7:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802ada:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802adf:	89 c1                	mov    %eax,%ecx
+  802ae1:	83 c9 04             	or     $0x4,%ecx
+  802ae4:	f6 c2 01             	test   $0x1,%dl
+  802ae7:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802aea:	89 c1                	mov    %eax,%ecx
+  802aec:	83 c9 02             	or     $0x2,%ecx
+  802aef:	f6 c2 02             	test   $0x2,%dl
+  802af2:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802af5:	89 c1                	mov    %eax,%ecx
+  802af7:	83 c9 01             	or     $0x1,%ecx
+  802afa:	48 85 d2             	test   %rdx,%rdx
+  802afd:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802b00:	89 c1                	mov    %eax,%ecx
+  802b02:	83 c9 40             	or     $0x40,%ecx
+  802b05:	f6 c6 04             	test   $0x4,%dh
+  802b08:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802b0b:	5d                   	pop    %rbp
+  802b0c:	c3                   	ret
+
+0000000000802b0d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802b0d:	55                   	push   %rbp
+  802b0e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b11:	48 b8 13 2a 80 00 00 	movabs $0x802a13,%rax
+  802b18:	00 00 00 
+  802b1b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802b1d:	48 c1 e8 06          	shr    $0x6,%rax
+  802b21:	83 e0 01             	and    $0x1,%eax
+}
+  802b24:	5d                   	pop    %rbp
+  802b25:	c3                   	ret
+
+0000000000802b26 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802b26:	55                   	push   %rbp
+  802b27:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802b2a:	48 b8 13 2a 80 00 00 	movabs $0x802a13,%rax
+  802b31:	00 00 00 
+  802b34:	ff d0                	call   *%rax
+  802b36:	83 e0 01             	and    $0x1,%eax
+}
+  802b39:	5d                   	pop    %rbp
+  802b3a:	c3                   	ret
+
+0000000000802b3b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802b3b:	55                   	push   %rbp
+  802b3c:	48 89 e5             	mov    %rsp,%rbp
+  802b3f:	41 57                	push   %r15
+  802b41:	41 56                	push   %r14
+  802b43:	41 55                	push   %r13
+  802b45:	41 54                	push   %r12
+  802b47:	53                   	push   %rbx
+  802b48:	48 83 ec 18          	sub    $0x18,%rsp
+  802b4c:	49 89 ff             	mov    %rdi,%r15
+  802b4f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802b53:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802b58:	49 bc 26 2b 80 00 00 	movabs $0x802b26,%r12
+  802b5f:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802b62:	49 be c7 2a 80 00 00 	movabs $0x802ac7,%r14
+  802b69:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802b6c:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802b73:	00 00 00 
+  802b76:	eb 0c                	jmp    802b84 <foreach_shared_region+0x49>
+  802b78:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b7f:	4c 39 eb             	cmp    %r13,%rbx
+  802b82:	74 38                	je     802bbc <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802b84:	48 89 df             	mov    %rbx,%rdi
+  802b87:	41 ff d4             	call   *%r12
+  802b8a:	84 c0                	test   %al,%al
+  802b8c:	74 ea                	je     802b78 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802b8e:	48 89 df             	mov    %rbx,%rdi
+  802b91:	41 ff d6             	call   *%r14
+  802b94:	a8 40                	test   $0x40,%al
+  802b96:	74 e0                	je     802b78 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802b98:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802b9f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802ba3:	48 89 df             	mov    %rbx,%rdi
+  802ba6:	41 ff d7             	call   *%r15
+        if (err)
+  802ba9:	85 c0                	test   %eax,%eax
+  802bab:	74 cb                	je     802b78 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802bad:	48 83 c4 18          	add    $0x18,%rsp
+  802bb1:	5b                   	pop    %rbx
+  802bb2:	41 5c                	pop    %r12
+  802bb4:	41 5d                	pop    %r13
+  802bb6:	41 5e                	pop    %r14
+  802bb8:	41 5f                	pop    %r15
+  802bba:	5d                   	pop    %rbp
+  802bbb:	c3                   	ret
+    return 0;
+  802bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc1:	eb ea                	jmp    802bad <foreach_shared_region+0x72>
+
+0000000000802bc3 <_generic_signal_handler>:
+        (es->sa.sa_handler)(es->signo);
+    }
+}
+
+void
+_generic_signal_handler(struct UTrapframe *utf, struct EnqueuedSignal * es) {
+  802bc3:	55                   	push   %rbp
+  802bc4:	48 89 e5             	mov    %rsp,%rbp
+  802bc7:	41 55                	push   %r13
+  802bc9:	41 54                	push   %r12
+  802bcb:	53                   	push   %rbx
+  802bcc:	48 83 ec 08          	sub    $0x8,%rsp
+  802bd0:	49 89 fc             	mov    %rdi,%r12
+  802bd3:	48 89 f3             	mov    %rsi,%rbx
+    if (trace_signals)
+        cprintf("signals: env %x: begin generic handler for %d\n", sys_getenvid(), es->signo);
+  802bd6:	44 8b 2e             	mov    (%rsi),%r13d
+  802bd9:	48 b8 3c 11 80 00 00 	movabs $0x80113c,%rax
+  802be0:	00 00 00 
+  802be3:	ff d0                	call   *%rax
+  802be5:	89 c6                	mov    %eax,%esi
+  802be7:	44 89 ea             	mov    %r13d,%edx
+  802bea:	48 bf 40 39 80 00 00 	movabs $0x803940,%rdi
+  802bf1:	00 00 00 
+  802bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf9:	48 b9 27 03 80 00 00 	movabs $0x800327,%rcx
+  802c00:	00 00 00 
+  802c03:	ff d1                	call   *%rcx
+    if (es->sa.sa_handler == SIG_DFL) {
+  802c05:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802c09:	48 85 c0             	test   %rax,%rax
+  802c0c:	74 57                	je     802c65 <_generic_signal_handler+0xa2>
+    if (es->sa.sa_handler == SIG_IGN) {
+  802c0e:	48 83 f8 01          	cmp    $0x1,%rax
+  802c12:	0f 84 c0 00 00 00    	je     802cd8 <_generic_signal_handler+0x115>
+    if (es->sa.sa_flags & SA_SIGINFO) {
+  802c18:	f6 43 14 04          	testb  $0x4,0x14(%rbx)
+  802c1c:	0f 84 ea 00 00 00    	je     802d0c <_generic_signal_handler+0x149>
+        (es->sa.sa_sigaction)(es->signo, &(es->info), utf);
+  802c22:	48 8d 73 18          	lea    0x18(%rbx),%rsi
+  802c26:	8b 3b                	mov    (%rbx),%edi
+  802c28:	4c 89 e2             	mov    %r12,%rdx
+  802c2b:	ff d0                	call   *%rax
+
+    _generic_signal_handler_impl(utf, es);
+
+    if (trace_signals)
+        cprintf("signals: env %x: end generic handler for %d\n", sys_getenvid(), es->signo);
+  802c2d:	8b 1b                	mov    (%rbx),%ebx
+  802c2f:	48 b8 3c 11 80 00 00 	movabs $0x80113c,%rax
+  802c36:	00 00 00 
+  802c39:	ff d0                	call   *%rax
+  802c3b:	89 c6                	mov    %eax,%esi
+  802c3d:	89 da                	mov    %ebx,%edx
+  802c3f:	48 bf c8 39 80 00 00 	movabs $0x8039c8,%rdi
+  802c46:	00 00 00 
+  802c49:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4e:	48 b9 27 03 80 00 00 	movabs $0x800327,%rcx
+  802c55:	00 00 00 
+  802c58:	ff d1                	call   *%rcx
+}
+  802c5a:	48 83 c4 08          	add    $0x8,%rsp
+  802c5e:	5b                   	pop    %rbx
+  802c5f:	41 5c                	pop    %r12
+  802c61:	41 5d                	pop    %r13
+  802c63:	5d                   	pop    %rbp
+  802c64:	c3                   	ret
+            cprintf("signals: env %x: exiting due to signal %d\n", sys_getenvid(), es->signo);
+  802c65:	8b 1b                	mov    (%rbx),%ebx
+  802c67:	48 b8 3c 11 80 00 00 	movabs $0x80113c,%rax
+  802c6e:	00 00 00 
+  802c71:	ff d0                	call   *%rax
+  802c73:	89 c6                	mov    %eax,%esi
+  802c75:	89 da                	mov    %ebx,%edx
+  802c77:	48 bf 70 39 80 00 00 	movabs $0x803970,%rdi
+  802c7e:	00 00 00 
+  802c81:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c86:	48 b9 27 03 80 00 00 	movabs $0x800327,%rcx
+  802c8d:	00 00 00 
+  802c90:	ff d1                	call   *%rcx
+        sys_env_destroy(CURENVID);
+  802c92:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c97:	48 b8 d1 10 80 00 00 	movabs $0x8010d1,%rax
+  802c9e:	00 00 00 
+  802ca1:	ff d0                	call   *%rax
+        assert(false);
+  802ca3:	48 b9 f5 39 80 00 00 	movabs $0x8039f5,%rcx
+  802caa:	00 00 00 
+  802cad:	48 ba 37 38 80 00 00 	movabs $0x803837,%rdx
+  802cb4:	00 00 00 
+  802cb7:	be 0c 00 00 00       	mov    $0xc,%esi
+  802cbc:	48 bf fb 39 80 00 00 	movabs $0x8039fb,%rdi
+  802cc3:	00 00 00 
+  802cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ccb:	49 b8 d7 01 80 00 00 	movabs $0x8001d7,%r8
+  802cd2:	00 00 00 
+  802cd5:	41 ff d0             	call   *%r8
+            cprintf("signals: env %x: ignoring signal %d\n", sys_getenvid(), es->signo);
+  802cd8:	44 8b 23             	mov    (%rbx),%r12d
+  802cdb:	48 b8 3c 11 80 00 00 	movabs $0x80113c,%rax
+  802ce2:	00 00 00 
+  802ce5:	ff d0                	call   *%rax
+  802ce7:	89 c6                	mov    %eax,%esi
+  802ce9:	44 89 e2             	mov    %r12d,%edx
+  802cec:	48 bf a0 39 80 00 00 	movabs $0x8039a0,%rdi
+  802cf3:	00 00 00 
+  802cf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cfb:	48 b9 27 03 80 00 00 	movabs $0x800327,%rcx
+  802d02:	00 00 00 
+  802d05:	ff d1                	call   *%rcx
+        return;
+  802d07:	e9 21 ff ff ff       	jmp    802c2d <_generic_signal_handler+0x6a>
+        (es->sa.sa_handler)(es->signo);
+  802d0c:	8b 3b                	mov    (%rbx),%edi
+  802d0e:	ff d0                	call   *%rax
+  802d10:	e9 18 ff ff ff       	jmp    802c2d <_generic_signal_handler+0x6a>
+
+0000000000802d15 <sigqueue>:
+
+int sigqueue(pid_t pid, int signo, const union sigval value) {
+  802d15:	55                   	push   %rbp
+  802d16:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigqueue(pid, signo, value);
+  802d19:	48 b8 00 16 80 00 00 	movabs $0x801600,%rax
+  802d20:	00 00 00 
+  802d23:	ff d0                	call   *%rax
+}
+  802d25:	5d                   	pop    %rbp
+  802d26:	c3                   	ret
+
+0000000000802d27 <sigwait>:
+
+int sigwait(const sigset_t * set, int * sig) {
+  802d27:	55                   	push   %rbp
+  802d28:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigwait(set, sig);
+  802d2b:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  802d32:	00 00 00 
+  802d35:	ff d0                	call   *%rax
+}
+  802d37:	5d                   	pop    %rbp
+  802d38:	c3                   	ret
+
+0000000000802d39 <sigaction>:
+
+extern void _signal_handler_trampoline(void);
+
+int sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  802d39:	55                   	push   %rbp
+  802d3a:	48 89 e5             	mov    %rsp,%rbp
+  802d3d:	41 55                	push   %r13
+  802d3f:	41 54                	push   %r12
+  802d41:	53                   	push   %rbx
+  802d42:	48 83 ec 08          	sub    $0x8,%rsp
+  802d46:	89 fb                	mov    %edi,%ebx
+  802d48:	49 89 f4             	mov    %rsi,%r12
+  802d4b:	49 89 d5             	mov    %rdx,%r13
+    int err = sys_env_set_pgfault_upcall(CURENVID, _signal_handler_trampoline);
+  802d4e:	48 be 60 1a 80 00 00 	movabs $0x801a60,%rsi
+  802d55:	00 00 00 
+  802d58:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d5d:	48 b8 d1 14 80 00 00 	movabs $0x8014d1,%rax
+  802d64:	00 00 00 
+  802d67:	ff d0                	call   *%rax
+    if (err)
+  802d69:	85 c0                	test   %eax,%eax
+  802d6b:	74 0b                	je     802d78 <sigaction+0x3f>
+        return err;
+    return sys_sigaction(sig, act, oact);
+}
+  802d6d:	48 83 c4 08          	add    $0x8,%rsp
+  802d71:	5b                   	pop    %rbx
+  802d72:	41 5c                	pop    %r12
+  802d74:	41 5d                	pop    %r13
+  802d76:	5d                   	pop    %rbp
+  802d77:	c3                   	ret
+    return sys_sigaction(sig, act, oact);
+  802d78:	4c 89 ea             	mov    %r13,%rdx
+  802d7b:	4c 89 e6             	mov    %r12,%rsi
+  802d7e:	89 df                	mov    %ebx,%edi
+  802d80:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  802d87:	00 00 00 
+  802d8a:	ff d0                	call   *%rax
+  802d8c:	eb df                	jmp    802d6d <sigaction+0x34>
+
+0000000000802d8e <sigprocmask>:
+
+int sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  802d8e:	55                   	push   %rbp
+  802d8f:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigprocmask(how, set, oldset);
+  802d92:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  802d99:	00 00 00 
+  802d9c:	ff d0                	call   *%rax
+}
+  802d9e:	5d                   	pop    %rbp
+  802d9f:	c3                   	ret
+
+0000000000802da0 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802da0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da5:	c3                   	ret
+
+0000000000802da6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802da6:	55                   	push   %rbp
+  802da7:	48 89 e5             	mov    %rsp,%rbp
+  802daa:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802dad:	48 be 08 3a 80 00 00 	movabs $0x803a08,%rsi
+  802db4:	00 00 00 
+  802db7:	48 b8 4c 0c 80 00 00 	movabs $0x800c4c,%rax
+  802dbe:	00 00 00 
+  802dc1:	ff d0                	call   *%rax
+    return 0;
+}
+  802dc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc8:	5d                   	pop    %rbp
+  802dc9:	c3                   	ret
+
+0000000000802dca <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802dca:	55                   	push   %rbp
+  802dcb:	48 89 e5             	mov    %rsp,%rbp
+  802dce:	41 57                	push   %r15
+  802dd0:	41 56                	push   %r14
+  802dd2:	41 55                	push   %r13
+  802dd4:	41 54                	push   %r12
+  802dd6:	53                   	push   %rbx
+  802dd7:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802dde:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802de5:	48 85 d2             	test   %rdx,%rdx
+  802de8:	74 7a                	je     802e64 <devcons_write+0x9a>
+  802dea:	49 89 d6             	mov    %rdx,%r14
+  802ded:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802df3:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802df8:	49 bf 46 0e 80 00 00 	movabs $0x800e46,%r15
+  802dff:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802e02:	4c 89 f3             	mov    %r14,%rbx
+  802e05:	48 29 f3             	sub    %rsi,%rbx
+  802e08:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802e0d:	48 39 c3             	cmp    %rax,%rbx
+  802e10:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802e14:	4c 63 eb             	movslq %ebx,%r13
+  802e17:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802e1e:	48 01 c6             	add    %rax,%rsi
+  802e21:	4c 89 ea             	mov    %r13,%rdx
+  802e24:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802e2b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802e2e:	4c 89 ee             	mov    %r13,%rsi
+  802e31:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802e38:	48 b8 73 10 80 00 00 	movabs $0x801073,%rax
+  802e3f:	00 00 00 
+  802e42:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802e44:	41 01 dc             	add    %ebx,%r12d
+  802e47:	49 63 f4             	movslq %r12d,%rsi
+  802e4a:	4c 39 f6             	cmp    %r14,%rsi
+  802e4d:	72 b3                	jb     802e02 <devcons_write+0x38>
+    return res;
+  802e4f:	49 63 c4             	movslq %r12d,%rax
+}
+  802e52:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802e59:	5b                   	pop    %rbx
+  802e5a:	41 5c                	pop    %r12
+  802e5c:	41 5d                	pop    %r13
+  802e5e:	41 5e                	pop    %r14
+  802e60:	41 5f                	pop    %r15
+  802e62:	5d                   	pop    %rbp
+  802e63:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802e64:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802e6a:	eb e3                	jmp    802e4f <devcons_write+0x85>
+
+0000000000802e6c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e6c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802e6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e74:	48 85 c0             	test   %rax,%rax
+  802e77:	74 55                	je     802ece <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e79:	55                   	push   %rbp
+  802e7a:	48 89 e5             	mov    %rsp,%rbp
+  802e7d:	41 55                	push   %r13
+  802e7f:	41 54                	push   %r12
+  802e81:	53                   	push   %rbx
+  802e82:	48 83 ec 08          	sub    $0x8,%rsp
+  802e86:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802e89:	48 bb a0 10 80 00 00 	movabs $0x8010a0,%rbx
+  802e90:	00 00 00 
+  802e93:	49 bc 6d 11 80 00 00 	movabs $0x80116d,%r12
+  802e9a:	00 00 00 
+  802e9d:	eb 03                	jmp    802ea2 <devcons_read+0x36>
+  802e9f:	41 ff d4             	call   *%r12
+  802ea2:	ff d3                	call   *%rbx
+  802ea4:	85 c0                	test   %eax,%eax
+  802ea6:	74 f7                	je     802e9f <devcons_read+0x33>
+    if (c < 0) return c;
+  802ea8:	48 63 d0             	movslq %eax,%rdx
+  802eab:	78 13                	js     802ec0 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802ead:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eb2:	83 f8 04             	cmp    $0x4,%eax
+  802eb5:	74 09                	je     802ec0 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802eb7:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802ebb:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802ec0:	48 89 d0             	mov    %rdx,%rax
+  802ec3:	48 83 c4 08          	add    $0x8,%rsp
+  802ec7:	5b                   	pop    %rbx
+  802ec8:	41 5c                	pop    %r12
+  802eca:	41 5d                	pop    %r13
+  802ecc:	5d                   	pop    %rbp
+  802ecd:	c3                   	ret
+  802ece:	48 89 d0             	mov    %rdx,%rax
+  802ed1:	c3                   	ret
+
+0000000000802ed2 <cputchar>:
+cputchar(int ch) {
+  802ed2:	55                   	push   %rbp
+  802ed3:	48 89 e5             	mov    %rsp,%rbp
+  802ed6:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802eda:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802ede:	be 01 00 00 00       	mov    $0x1,%esi
+  802ee3:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802ee7:	48 b8 73 10 80 00 00 	movabs $0x801073,%rax
+  802eee:	00 00 00 
+  802ef1:	ff d0                	call   *%rax
+}
+  802ef3:	c9                   	leave
+  802ef4:	c3                   	ret
+
+0000000000802ef5 <getchar>:
+getchar(void) {
+  802ef5:	55                   	push   %rbp
+  802ef6:	48 89 e5             	mov    %rsp,%rbp
+  802ef9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802efd:	ba 01 00 00 00       	mov    $0x1,%edx
+  802f02:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802f06:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f0b:	48 b8 8c 1e 80 00 00 	movabs $0x801e8c,%rax
+  802f12:	00 00 00 
+  802f15:	ff d0                	call   *%rax
+  802f17:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802f19:	85 c0                	test   %eax,%eax
+  802f1b:	78 06                	js     802f23 <getchar+0x2e>
+  802f1d:	74 08                	je     802f27 <getchar+0x32>
+  802f1f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802f23:	89 d0                	mov    %edx,%eax
+  802f25:	c9                   	leave
+  802f26:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802f27:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802f2c:	eb f5                	jmp    802f23 <getchar+0x2e>
+
+0000000000802f2e <iscons>:
+iscons(int fdnum) {
+  802f2e:	55                   	push   %rbp
+  802f2f:	48 89 e5             	mov    %rsp,%rbp
+  802f32:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802f36:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f3a:	48 b8 a9 1b 80 00 00 	movabs $0x801ba9,%rax
+  802f41:	00 00 00 
+  802f44:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f46:	85 c0                	test   %eax,%eax
+  802f48:	78 18                	js     802f62 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802f4a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f4e:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802f55:	00 00 00 
+  802f58:	8b 00                	mov    (%rax),%eax
+  802f5a:	39 02                	cmp    %eax,(%rdx)
+  802f5c:	0f 94 c0             	sete   %al
+  802f5f:	0f b6 c0             	movzbl %al,%eax
+}
+  802f62:	c9                   	leave
+  802f63:	c3                   	ret
+
+0000000000802f64 <opencons>:
+opencons(void) {
+  802f64:	55                   	push   %rbp
+  802f65:	48 89 e5             	mov    %rsp,%rbp
+  802f68:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f6c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802f70:	48 b8 49 1b 80 00 00 	movabs $0x801b49,%rax
+  802f77:	00 00 00 
+  802f7a:	ff d0                	call   *%rax
+  802f7c:	85 c0                	test   %eax,%eax
+  802f7e:	78 49                	js     802fc9 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802f80:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f85:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f8a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802f8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f93:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  802f9a:	00 00 00 
+  802f9d:	ff d0                	call   *%rax
+  802f9f:	85 c0                	test   %eax,%eax
+  802fa1:	78 26                	js     802fc9 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802fa3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802fa7:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802fae:	00 00 
+  802fb0:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802fb2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fb6:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802fbd:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  802fc4:	00 00 00 
+  802fc7:	ff d0                	call   *%rax
+}
+  802fc9:	c9                   	leave
+  802fca:	c3                   	ret
+
+0000000000802fcb <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802fcb:	55                   	push   %rbp
+  802fcc:	48 89 e5             	mov    %rsp,%rbp
+  802fcf:	41 54                	push   %r12
+  802fd1:	53                   	push   %rbx
+  802fd2:	48 89 fb             	mov    %rdi,%rbx
+  802fd5:	48 89 f7             	mov    %rsi,%rdi
+  802fd8:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802fdb:	48 85 f6             	test   %rsi,%rsi
+  802fde:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802fe5:	00 00 00 
+  802fe8:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802fec:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ff1:	48 b8 66 15 80 00 00 	movabs $0x801566,%rax
+  802ff8:	00 00 00 
+  802ffb:	ff d0                	call   *%rax
+    if (res < 0) {
+  802ffd:	85 c0                	test   %eax,%eax
+  802fff:	78 45                	js     803046 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  803001:	48 85 db             	test   %rbx,%rbx
+  803004:	74 12                	je     803018 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  803006:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80300d:	00 00 00 
+  803010:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  803016:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  803018:	4d 85 e4             	test   %r12,%r12
+  80301b:	74 14                	je     803031 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  80301d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803024:	00 00 00 
+  803027:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  80302d:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  803031:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803038:	00 00 00 
+  80303b:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  803041:	5b                   	pop    %rbx
+  803042:	41 5c                	pop    %r12
+  803044:	5d                   	pop    %rbp
+  803045:	c3                   	ret
+        if (from_env_store)
+  803046:	48 85 db             	test   %rbx,%rbx
+  803049:	74 06                	je     803051 <ipc_recv+0x86>
+            *from_env_store = 0;
+  80304b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  803051:	4d 85 e4             	test   %r12,%r12
+  803054:	74 eb                	je     803041 <ipc_recv+0x76>
+            *perm_store = 0;
+  803056:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80305d:	00 
+  80305e:	eb e1                	jmp    803041 <ipc_recv+0x76>
+
+0000000000803060 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803060:	55                   	push   %rbp
+  803061:	48 89 e5             	mov    %rsp,%rbp
+  803064:	41 57                	push   %r15
+  803066:	41 56                	push   %r14
+  803068:	41 55                	push   %r13
+  80306a:	41 54                	push   %r12
+  80306c:	53                   	push   %rbx
+  80306d:	48 83 ec 18          	sub    $0x18,%rsp
+  803071:	41 89 fd             	mov    %edi,%r13d
+  803074:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803077:	48 89 d3             	mov    %rdx,%rbx
+  80307a:	49 89 cc             	mov    %rcx,%r12
+  80307d:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  803081:	48 85 d2             	test   %rdx,%rdx
+  803084:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80308b:	00 00 00 
+  80308e:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803092:	49 be 3a 15 80 00 00 	movabs $0x80153a,%r14
+  803099:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  80309c:	49 bf 6d 11 80 00 00 	movabs $0x80116d,%r15
+  8030a3:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8030a6:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8030a9:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8030ad:	4c 89 e1             	mov    %r12,%rcx
+  8030b0:	48 89 da             	mov    %rbx,%rdx
+  8030b3:	44 89 ef             	mov    %r13d,%edi
+  8030b6:	41 ff d6             	call   *%r14
+        if (res == 0)
+  8030b9:	85 c0                	test   %eax,%eax
+  8030bb:	74 34                	je     8030f1 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  8030bd:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8030c0:	75 05                	jne    8030c7 <ipc_send+0x67>
+        sys_yield();
+  8030c2:	41 ff d7             	call   *%r15
+    while (true) {
+  8030c5:	eb df                	jmp    8030a6 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  8030c7:	48 ba 14 3a 80 00 00 	movabs $0x803a14,%rdx
+  8030ce:	00 00 00 
+  8030d1:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8030d6:	48 bf 2d 3a 80 00 00 	movabs $0x803a2d,%rdi
+  8030dd:	00 00 00 
+  8030e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030e5:	48 b9 d7 01 80 00 00 	movabs $0x8001d7,%rcx
+  8030ec:	00 00 00 
+  8030ef:	ff d1                	call   *%rcx
+    }
+}
+  8030f1:	48 83 c4 18          	add    $0x18,%rsp
+  8030f5:	5b                   	pop    %rbx
+  8030f6:	41 5c                	pop    %r12
+  8030f8:	41 5d                	pop    %r13
+  8030fa:	41 5e                	pop    %r14
+  8030fc:	41 5f                	pop    %r15
+  8030fe:	5d                   	pop    %rbp
+  8030ff:	c3                   	ret
+
+0000000000803100 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803100:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803105:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80310c:	00 00 00 
+  80310f:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  803116:	48 01 ca             	add    %rcx,%rdx
+  803119:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80311f:	39 fa                	cmp    %edi,%edx
+  803121:	74 12                	je     803135 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803123:	48 83 c0 01          	add    $0x1,%rax
+  803127:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80312d:	75 e0                	jne    80310f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80312f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803134:	c3                   	ret
+            return envs[i].env_id;
+  803135:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80313c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803143:	00 00 00 
+  803146:	48 01 d0             	add    %rdx,%rax
+  803149:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80314f:	c3                   	ret
+
+0000000000803150 <__rodata_start>:
+  803150:	66 61                	data16 (bad)
+  803152:	75 6c                	jne    8031c0 <__rodata_start+0x70>
+  803154:	74 20                	je     803176 <__rodata_start+0x26>
+  803156:	25 6c 78 0a 00       	and    $0xa786c,%eax
+  80315b:	75 73                	jne    8031d0 <__rodata_start+0x80>
+  80315d:	65 72 2f             	gs jb  80318f <__rodata_start+0x3f>
+  803160:	66 61                	data16 (bad)
+  803162:	75 6c                	jne    8031d0 <__rodata_start+0x80>
+  803164:	74 61                	je     8031c7 <__rodata_start+0x77>
+  803166:	6c                   	insb   (%dx),%es:(%rdi)
+  803167:	6c                   	insb   (%dx),%es:(%rdi)
+  803168:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803169:	63 62 61             	movsxd 0x61(%rdx),%esp
+  80316c:	64 2e 63 00          	fs movsxd %fs:(%rax),%eax
+  803170:	61                   	(bad)
+  803171:	6c                   	insb   (%dx),%es:(%rdi)
+  803172:	6c                   	insb   (%dx),%es:(%rdi)
+  803173:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803174:	63 61 74             	movsxd 0x74(%rcx),%esp
+  803177:	69 6e 67 20 61 74 20 	imul   $0x20746120,0x67(%rsi),%ebp
+  80317e:	25 6c 78 20 69       	and    $0x6920786c,%eax
+  803183:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803184:	20 70 61             	and    %dh,0x61(%rax)
+  803187:	67 65 20 66 61       	and    %ah,%gs:0x61(%esi)
+  80318c:	75 6c                	jne    8031fa <__rodata_start+0xaa>
+  80318e:	74 20                	je     8031b0 <__rodata_start+0x60>
+  803190:	68 61 6e 64 6c       	push   $0x6c646e61
+  803195:	65 72 3a             	gs jb  8031d2 <__rodata_start+0x82>
+  803198:	20 25 69 00 00 00    	and    %ah,0x69(%rip)        # 803207 <__rodata_start+0xb7>
+  80319e:	00 00                	add    %al,(%rax)
+  8031a0:	74 68                	je     80320a <__rodata_start+0xba>
+  8031a2:	69 73 20 73 74 72 69 	imul   $0x69727473,0x20(%rbx),%esi
+  8031a9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031aa:	67 20 77 61          	and    %dh,0x61(%edi)
+  8031ae:	73 20                	jae    8031d0 <__rodata_start+0x80>
+  8031b0:	66 61                	data16 (bad)
+  8031b2:	75 6c                	jne    803220 <__rodata_start+0xd0>
+  8031b4:	74 65                	je     80321b <__rodata_start+0xcb>
+  8031b6:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  8031ba:	20 61 74             	and    %ah,0x74(%rcx)
+  8031bd:	20 25 6c 78 00 3c    	and    %ah,0x3c00786c(%rip)        # 3c80aa2f <__bss_end+0x3c002a2f>
+  8031c3:	75 6e                	jne    803233 <__rodata_start+0xe3>
+  8031c5:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8031c9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031ca:	3e 00 0f             	ds add %cl,(%rdi)
+  8031cd:	1f                   	(bad)
+  8031ce:	40 00 5b 25          	rex add %bl,0x25(%rbx)
+  8031d2:	30 38                	xor    %bh,(%rax)
+  8031d4:	78 5d                	js     803233 <__rodata_start+0xe3>
+  8031d6:	20 75 73             	and    %dh,0x73(%rbp)
+  8031d9:	65 72 20             	gs jb  8031fc <__rodata_start+0xac>
+  8031dc:	70 61                	jo     80323f <__rodata_start+0xef>
+  8031de:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031df:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  8031e6:	73 20                	jae    803208 <__rodata_start+0xb8>
+  8031e8:	61                   	(bad)
+  8031e9:	74 20                	je     80320b <__rodata_start+0xbb>
+  8031eb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  8031f0:	3a 20                	cmp    (%rax),%ah
+  8031f2:	00 30                	add    %dh,(%rax)
+  8031f4:	31 32                	xor    %esi,(%rdx)
+  8031f6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8031fd:	41                   	rex.B
+  8031fe:	42                   	rex.X
+  8031ff:	43                   	rex.XB
+  803200:	44                   	rex.R
+  803201:	45                   	rex.RB
+  803202:	46 00 30             	rex.RX add %r14b,(%rax)
+  803205:	31 32                	xor    %esi,(%rdx)
+  803207:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80320e:	61                   	(bad)
+  80320f:	62 63 64 65 66       	(bad)
+  803214:	00 28                	add    %ch,(%rax)
+  803216:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803217:	75 6c                	jne    803285 <__rodata_start+0x135>
+  803219:	6c                   	insb   (%dx),%es:(%rdi)
+  80321a:	29 00                	sub    %eax,(%rax)
+  80321c:	65 72 72             	gs jb  803291 <__rodata_start+0x141>
+  80321f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803220:	72 20                	jb     803242 <__rodata_start+0xf2>
+  803222:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803227:	73 70                	jae    803299 <__rodata_start+0x149>
+  803229:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80322d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803234:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803235:	72 00                	jb     803237 <__rodata_start+0xe7>
+  803237:	62 61 64 20 65       	(bad)
+  80323c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80323d:	76 69                	jbe    8032a8 <__rodata_start+0x158>
+  80323f:	72 6f                	jb     8032b0 <__rodata_start+0x160>
+  803241:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803242:	6d                   	insl   (%dx),%es:(%rdi)
+  803243:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803245:	74 00                	je     803247 <__rodata_start+0xf7>
+  803247:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80324e:	20 70 61             	and    %dh,0x61(%rax)
+  803251:	72 61                	jb     8032b4 <__rodata_start+0x164>
+  803253:	6d                   	insl   (%dx),%es:(%rdi)
+  803254:	65 74 65             	gs je  8032bc <__rodata_start+0x16c>
+  803257:	72 00                	jb     803259 <__rodata_start+0x109>
+  803259:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80325a:	75 74                	jne    8032d0 <__rodata_start+0x180>
+  80325c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80325f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803262:	6d                   	insl   (%dx),%es:(%rdi)
+  803263:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803264:	72 79                	jb     8032df <__rodata_start+0x18f>
+  803266:	00 6f 75             	add    %ch,0x75(%rdi)
+  803269:	74 20                	je     80328b <__rodata_start+0x13b>
+  80326b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80326c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803270:	76 69                	jbe    8032db <__rodata_start+0x18b>
+  803272:	72 6f                	jb     8032e3 <__rodata_start+0x193>
+  803274:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803275:	6d                   	insl   (%dx),%es:(%rdi)
+  803276:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803278:	74 73                	je     8032ed <__rodata_start+0x19d>
+  80327a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80327d:	72 72                	jb     8032f1 <__rodata_start+0x1a1>
+  80327f:	75 70                	jne    8032f1 <__rodata_start+0x1a1>
+  803281:	74 65                	je     8032e8 <__rodata_start+0x198>
+  803283:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803288:	75 67                	jne    8032f1 <__rodata_start+0x1a1>
+  80328a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80328d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80328f:	00 73 65             	add    %dh,0x65(%rbx)
+  803292:	67 6d                	insl   (%dx),%es:(%edi)
+  803294:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803296:	74 61                	je     8032f9 <__rodata_start+0x1a9>
+  803298:	74 69                	je     803303 <__rodata_start+0x1b3>
+  80329a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80329b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80329c:	20 66 61             	and    %ah,0x61(%rsi)
+  80329f:	75 6c                	jne    80330d <__rodata_start+0x1bd>
+  8032a1:	74 00                	je     8032a3 <__rodata_start+0x153>
+  8032a3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8032aa:	20 45 4c             	and    %al,0x4c(%rbp)
+  8032ad:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8032b1:	61                   	(bad)
+  8032b2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8032b7:	20 73 75             	and    %dh,0x75(%rbx)
+  8032ba:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8032bd:	73 79                	jae    803338 <__rodata_start+0x1e8>
+  8032bf:	73 74                	jae    803335 <__rodata_start+0x1e5>
+  8032c1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8032c3:	20 63 61             	and    %ah,0x61(%rbx)
+  8032c6:	6c                   	insb   (%dx),%es:(%rdi)
+  8032c7:	6c                   	insb   (%dx),%es:(%rdi)
+  8032c8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8032cb:	74 72                	je     80333f <__rodata_start+0x1ef>
+  8032cd:	79 20                	jns    8032ef <__rodata_start+0x19f>
+  8032cf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032d0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032d1:	74 20                	je     8032f3 <__rodata_start+0x1a3>
+  8032d3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8032d5:	75 6e                	jne    803345 <__rodata_start+0x1f5>
+  8032d7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8032db:	76 20                	jbe    8032fd <__rodata_start+0x1ad>
+  8032dd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8032e4:	72 65                	jb     80334b <__rodata_start+0x1fb>
+  8032e6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8032e9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032ea:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8032ee:	65 78 70             	gs js  803361 <__rodata_start+0x211>
+  8032f1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8032f6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8032f9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8032fd:	20 66 69             	and    %ah,0x69(%rsi)
+  803300:	6c                   	insb   (%dx),%es:(%rdi)
+  803301:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803305:	20 66 72             	and    %ah,0x72(%rsi)
+  803308:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80330d:	61                   	(bad)
+  80330e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803311:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803312:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803313:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803317:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80331a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80331b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80331c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80331f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803320:	79 20                	jns    803342 <__rodata_start+0x1f2>
+  803322:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803329:	72 65                	jb     803390 <__rodata_start+0x240>
+  80332b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80332e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803330:	00 66 69             	add    %ah,0x69(%rsi)
+  803333:	6c                   	insb   (%dx),%es:(%rdi)
+  803334:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803338:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80333b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80333c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80333f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803340:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803341:	74 20                	je     803363 <__rodata_start+0x213>
+  803343:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803345:	75 6e                	jne    8033b5 <__rodata_start+0x265>
+  803347:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80334b:	76 61                	jbe    8033ae <__rodata_start+0x25e>
+  80334d:	6c                   	insb   (%dx),%es:(%rdi)
+  80334e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803355:	00 
+  803356:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80335d:	72 65                	jb     8033c4 <__rodata_start+0x274>
+  80335f:	61                   	(bad)
+  803360:	64 79 20             	fs jns 803383 <__rodata_start+0x233>
+  803363:	65 78 69             	gs js  8033cf <__rodata_start+0x27f>
+  803366:	73 74                	jae    8033dc <__rodata_start+0x28c>
+  803368:	73 00                	jae    80336a <__rodata_start+0x21a>
+  80336a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80336b:	70 65                	jo     8033d2 <__rodata_start+0x282>
+  80336d:	72 61                	jb     8033d0 <__rodata_start+0x280>
+  80336f:	74 69                	je     8033da <__rodata_start+0x28a>
+  803371:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803372:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803373:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803376:	74 20                	je     803398 <__rodata_start+0x248>
+  803378:	73 75                	jae    8033ef <__rodata_start+0x29f>
+  80337a:	70 70                	jo     8033ec <__rodata_start+0x29c>
+  80337c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80337d:	72 74                	jb     8033f3 <__rodata_start+0x2a3>
+  80337f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803384:	65 72 61             	gs jb  8033e8 <__rodata_start+0x298>
+  803387:	74 69                	je     8033f2 <__rodata_start+0x2a2>
+  803389:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80338a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80338b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80338e:	74 20                	je     8033b0 <__rodata_start+0x260>
+  803390:	70 65                	jo     8033f7 <__rodata_start+0x2a7>
+  803392:	72 6d                	jb     803401 <__rodata_start+0x2b1>
+  803394:	69 74 74 65 64 00 66 	imul   $0xf660064,0x65(%rsp,%rsi,2),%esi
+  80339b:	0f 
+  80339c:	1f                   	(bad)
+  80339d:	44 00 00             	add    %r8b,(%rax)
+  8033a0:	14 05                	adc    $0x5,%al
+  8033a2:	80 00 00             	addb   $0x0,(%rax)
+  8033a5:	00 00                	add    %al,(%rax)
+  8033a7:	00 55 0b             	add    %dl,0xb(%rbp)
+  8033aa:	80 00 00             	addb   $0x0,(%rax)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 45 0b             	add    %al,0xb(%rbp)
+  8033b2:	80 00 00             	addb   $0x0,(%rax)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 55 0b             	add    %dl,0xb(%rbp)
+  8033ba:	80 00 00             	addb   $0x0,(%rax)
+  8033bd:	00 00                	add    %al,(%rax)
+  8033bf:	00 55 0b             	add    %dl,0xb(%rbp)
+  8033c2:	80 00 00             	addb   $0x0,(%rax)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 55 0b             	add    %dl,0xb(%rbp)
+  8033ca:	80 00 00             	addb   $0x0,(%rax)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 55 0b             	add    %dl,0xb(%rbp)
+  8033d2:	80 00 00             	addb   $0x0,(%rax)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 33                	add    %dh,(%rbx)
+  8033d9:	05 80 00 00 00       	add    $0x80,%eax
+  8033de:	00 00                	add    %al,(%rax)
+  8033e0:	55                   	push   %rbp
+  8033e1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033e7:	00 55 0b             	add    %dl,0xb(%rbp)
+  8033ea:	80 00 00             	addb   $0x0,(%rax)
+  8033ed:	00 00                	add    %al,(%rax)
+  8033ef:	00 27                	add    %ah,(%rdi)
+  8033f1:	05 80 00 00 00       	add    $0x80,%eax
+  8033f6:	00 00                	add    %al,(%rax)
+  8033f8:	a1 05 80 00 00 00 00 	movabs 0x5500000000008005,%eax
+  8033ff:	00 55 
+  803401:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803407:	00 27                	add    %ah,(%rdi)
+  803409:	05 80 00 00 00       	add    $0x80,%eax
+  80340e:	00 00                	add    %al,(%rax)
+  803410:	6d                   	insl   (%dx),%es:(%rdi)
+  803411:	05 80 00 00 00       	add    $0x80,%eax
+  803416:	00 00                	add    %al,(%rax)
+  803418:	6d                   	insl   (%dx),%es:(%rdi)
+  803419:	05 80 00 00 00       	add    $0x80,%eax
+  80341e:	00 00                	add    %al,(%rax)
+  803420:	6d                   	insl   (%dx),%es:(%rdi)
+  803421:	05 80 00 00 00       	add    $0x80,%eax
+  803426:	00 00                	add    %al,(%rax)
+  803428:	6d                   	insl   (%dx),%es:(%rdi)
+  803429:	05 80 00 00 00       	add    $0x80,%eax
+  80342e:	00 00                	add    %al,(%rax)
+  803430:	6d                   	insl   (%dx),%es:(%rdi)
+  803431:	05 80 00 00 00       	add    $0x80,%eax
+  803436:	00 00                	add    %al,(%rax)
+  803438:	6d                   	insl   (%dx),%es:(%rdi)
+  803439:	05 80 00 00 00       	add    $0x80,%eax
+  80343e:	00 00                	add    %al,(%rax)
+  803440:	6d                   	insl   (%dx),%es:(%rdi)
+  803441:	05 80 00 00 00       	add    $0x80,%eax
+  803446:	00 00                	add    %al,(%rax)
+  803448:	6d                   	insl   (%dx),%es:(%rdi)
+  803449:	05 80 00 00 00       	add    $0x80,%eax
+  80344e:	00 00                	add    %al,(%rax)
+  803450:	6d                   	insl   (%dx),%es:(%rdi)
+  803451:	05 80 00 00 00       	add    $0x80,%eax
+  803456:	00 00                	add    %al,(%rax)
+  803458:	55                   	push   %rbp
+  803459:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80345f:	00 55 0b             	add    %dl,0xb(%rbp)
+  803462:	80 00 00             	addb   $0x0,(%rax)
+  803465:	00 00                	add    %al,(%rax)
+  803467:	00 55 0b             	add    %dl,0xb(%rbp)
+  80346a:	80 00 00             	addb   $0x0,(%rax)
+  80346d:	00 00                	add    %al,(%rax)
+  80346f:	00 55 0b             	add    %dl,0xb(%rbp)
+  803472:	80 00 00             	addb   $0x0,(%rax)
+  803475:	00 00                	add    %al,(%rax)
+  803477:	00 55 0b             	add    %dl,0xb(%rbp)
+  80347a:	80 00 00             	addb   $0x0,(%rax)
+  80347d:	00 00                	add    %al,(%rax)
+  80347f:	00 55 0b             	add    %dl,0xb(%rbp)
+  803482:	80 00 00             	addb   $0x0,(%rax)
+  803485:	00 00                	add    %al,(%rax)
+  803487:	00 55 0b             	add    %dl,0xb(%rbp)
+  80348a:	80 00 00             	addb   $0x0,(%rax)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 55 0b             	add    %dl,0xb(%rbp)
+  803492:	80 00 00             	addb   $0x0,(%rax)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 55 0b             	add    %dl,0xb(%rbp)
+  80349a:	80 00 00             	addb   $0x0,(%rax)
+  80349d:	00 00                	add    %al,(%rax)
+  80349f:	00 55 0b             	add    %dl,0xb(%rbp)
+  8034a2:	80 00 00             	addb   $0x0,(%rax)
+  8034a5:	00 00                	add    %al,(%rax)
+  8034a7:	00 55 0b             	add    %dl,0xb(%rbp)
+  8034aa:	80 00 00             	addb   $0x0,(%rax)
+  8034ad:	00 00                	add    %al,(%rax)
+  8034af:	00 55 0b             	add    %dl,0xb(%rbp)
+  8034b2:	80 00 00             	addb   $0x0,(%rax)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 55 0b             	add    %dl,0xb(%rbp)
+  8034ba:	80 00 00             	addb   $0x0,(%rax)
+  8034bd:	00 00                	add    %al,(%rax)
+  8034bf:	00 55 0b             	add    %dl,0xb(%rbp)
+  8034c2:	80 00 00             	addb   $0x0,(%rax)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 55 0b             	add    %dl,0xb(%rbp)
+  8034ca:	80 00 00             	addb   $0x0,(%rax)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 55 0b             	add    %dl,0xb(%rbp)
+  8034d2:	80 00 00             	addb   $0x0,(%rax)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 55 0b             	add    %dl,0xb(%rbp)
+  8034da:	80 00 00             	addb   $0x0,(%rax)
+  8034dd:	00 00                	add    %al,(%rax)
+  8034df:	00 55 0b             	add    %dl,0xb(%rbp)
+  8034e2:	80 00 00             	addb   $0x0,(%rax)
+  8034e5:	00 00                	add    %al,(%rax)
+  8034e7:	00 55 0b             	add    %dl,0xb(%rbp)
+  8034ea:	80 00 00             	addb   $0x0,(%rax)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 55 0b             	add    %dl,0xb(%rbp)
+  8034f2:	80 00 00             	addb   $0x0,(%rax)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 55 0b             	add    %dl,0xb(%rbp)
+  8034fa:	80 00 00             	addb   $0x0,(%rax)
+  8034fd:	00 00                	add    %al,(%rax)
+  8034ff:	00 55 0b             	add    %dl,0xb(%rbp)
+  803502:	80 00 00             	addb   $0x0,(%rax)
+  803505:	00 00                	add    %al,(%rax)
+  803507:	00 55 0b             	add    %dl,0xb(%rbp)
+  80350a:	80 00 00             	addb   $0x0,(%rax)
+  80350d:	00 00                	add    %al,(%rax)
+  80350f:	00 55 0b             	add    %dl,0xb(%rbp)
+  803512:	80 00 00             	addb   $0x0,(%rax)
+  803515:	00 00                	add    %al,(%rax)
+  803517:	00 55 0b             	add    %dl,0xb(%rbp)
+  80351a:	80 00 00             	addb   $0x0,(%rax)
+  80351d:	00 00                	add    %al,(%rax)
+  80351f:	00 55 0b             	add    %dl,0xb(%rbp)
+  803522:	80 00 00             	addb   $0x0,(%rax)
+  803525:	00 00                	add    %al,(%rax)
+  803527:	00 55 0b             	add    %dl,0xb(%rbp)
+  80352a:	80 00 00             	addb   $0x0,(%rax)
+  80352d:	00 00                	add    %al,(%rax)
+  80352f:	00 55 0b             	add    %dl,0xb(%rbp)
+  803532:	80 00 00             	addb   $0x0,(%rax)
+  803535:	00 00                	add    %al,(%rax)
+  803537:	00 55 0b             	add    %dl,0xb(%rbp)
+  80353a:	80 00 00             	addb   $0x0,(%rax)
+  80353d:	00 00                	add    %al,(%rax)
+  80353f:	00 55 0b             	add    %dl,0xb(%rbp)
+  803542:	80 00 00             	addb   $0x0,(%rax)
+  803545:	00 00                	add    %al,(%rax)
+  803547:	00 78 0a             	add    %bh,0xa(%rax)
+  80354a:	80 00 00             	addb   $0x0,(%rax)
+  80354d:	00 00                	add    %al,(%rax)
+  80354f:	00 55 0b             	add    %dl,0xb(%rbp)
+  803552:	80 00 00             	addb   $0x0,(%rax)
+  803555:	00 00                	add    %al,(%rax)
+  803557:	00 55 0b             	add    %dl,0xb(%rbp)
+  80355a:	80 00 00             	addb   $0x0,(%rax)
+  80355d:	00 00                	add    %al,(%rax)
+  80355f:	00 55 0b             	add    %dl,0xb(%rbp)
+  803562:	80 00 00             	addb   $0x0,(%rax)
+  803565:	00 00                	add    %al,(%rax)
+  803567:	00 55 0b             	add    %dl,0xb(%rbp)
+  80356a:	80 00 00             	addb   $0x0,(%rax)
+  80356d:	00 00                	add    %al,(%rax)
+  80356f:	00 55 0b             	add    %dl,0xb(%rbp)
+  803572:	80 00 00             	addb   $0x0,(%rax)
+  803575:	00 00                	add    %al,(%rax)
+  803577:	00 55 0b             	add    %dl,0xb(%rbp)
+  80357a:	80 00 00             	addb   $0x0,(%rax)
+  80357d:	00 00                	add    %al,(%rax)
+  80357f:	00 55 0b             	add    %dl,0xb(%rbp)
+  803582:	80 00 00             	addb   $0x0,(%rax)
+  803585:	00 00                	add    %al,(%rax)
+  803587:	00 55 0b             	add    %dl,0xb(%rbp)
+  80358a:	80 00 00             	addb   $0x0,(%rax)
+  80358d:	00 00                	add    %al,(%rax)
+  80358f:	00 55 0b             	add    %dl,0xb(%rbp)
+  803592:	80 00 00             	addb   $0x0,(%rax)
+  803595:	00 00                	add    %al,(%rax)
+  803597:	00 55 0b             	add    %dl,0xb(%rbp)
+  80359a:	80 00 00             	addb   $0x0,(%rax)
+  80359d:	00 00                	add    %al,(%rax)
+  80359f:	00 c4                	add    %al,%ah
+  8035a1:	05 80 00 00 00       	add    $0x80,%eax
+  8035a6:	00 00                	add    %al,(%rax)
+  8035a8:	93                   	xchg   %eax,%ebx
+  8035a9:	07                   	(bad)
+  8035aa:	80 00 00             	addb   $0x0,(%rax)
+  8035ad:	00 00                	add    %al,(%rax)
+  8035af:	00 55 0b             	add    %dl,0xb(%rbp)
+  8035b2:	80 00 00             	addb   $0x0,(%rax)
+  8035b5:	00 00                	add    %al,(%rax)
+  8035b7:	00 55 0b             	add    %dl,0xb(%rbp)
+  8035ba:	80 00 00             	addb   $0x0,(%rax)
+  8035bd:	00 00                	add    %al,(%rax)
+  8035bf:	00 55 0b             	add    %dl,0xb(%rbp)
+  8035c2:	80 00 00             	addb   $0x0,(%rax)
+  8035c5:	00 00                	add    %al,(%rax)
+  8035c7:	00 55 0b             	add    %dl,0xb(%rbp)
+  8035ca:	80 00 00             	addb   $0x0,(%rax)
+  8035cd:	00 00                	add    %al,(%rax)
+  8035cf:	00 f3                	add    %dh,%bl
+  8035d1:	05 80 00 00 00       	add    $0x80,%eax
+  8035d6:	00 00                	add    %al,(%rax)
+  8035d8:	55                   	push   %rbp
+  8035d9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8035df:	00 55 0b             	add    %dl,0xb(%rbp)
+  8035e2:	80 00 00             	addb   $0x0,(%rax)
+  8035e5:	00 00                	add    %al,(%rax)
+  8035e7:	00 b9 05 80 00 00    	add    %bh,0x8005(%rcx)
+  8035ed:	00 00                	add    %al,(%rax)
+  8035ef:	00 55 0b             	add    %dl,0xb(%rbp)
+  8035f2:	80 00 00             	addb   $0x0,(%rax)
+  8035f5:	00 00                	add    %al,(%rax)
+  8035f7:	00 55 0b             	add    %dl,0xb(%rbp)
+  8035fa:	80 00 00             	addb   $0x0,(%rax)
+  8035fd:	00 00                	add    %al,(%rax)
+  8035ff:	00 3b                	add    %bh,(%rbx)
+  803601:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803607:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80b617 <__bss_end+0x3617>
+  80360d:	00 00                	add    %al,(%rax)
+  80360f:	00 55 0b             	add    %dl,0xb(%rbp)
+  803612:	80 00 00             	addb   $0x0,(%rax)
+  803615:	00 00                	add    %al,(%rax)
+  803617:	00 55 0b             	add    %dl,0xb(%rbp)
+  80361a:	80 00 00             	addb   $0x0,(%rax)
+  80361d:	00 00                	add    %al,(%rax)
+  80361f:	00 8a 06 80 00 00    	add    %cl,0x8006(%rdx)
+  803625:	00 00                	add    %al,(%rax)
+  803627:	00 55 0b             	add    %dl,0xb(%rbp)
+  80362a:	80 00 00             	addb   $0x0,(%rax)
+  80362d:	00 00                	add    %al,(%rax)
+  80362f:	00 67 08             	add    %ah,0x8(%rdi)
+  803632:	80 00 00             	addb   $0x0,(%rax)
+  803635:	00 00                	add    %al,(%rax)
+  803637:	00 55 0b             	add    %dl,0xb(%rbp)
+  80363a:	80 00 00             	addb   $0x0,(%rax)
+  80363d:	00 00                	add    %al,(%rax)
+  80363f:	00 55 0b             	add    %dl,0xb(%rbp)
+  803642:	80 00 00             	addb   $0x0,(%rax)
+  803645:	00 00                	add    %al,(%rax)
+  803647:	00 78 0a             	add    %bh,0xa(%rax)
+  80364a:	80 00 00             	addb   $0x0,(%rax)
+  80364d:	00 00                	add    %al,(%rax)
+  80364f:	00 55 0b             	add    %dl,0xb(%rbp)
+  803652:	80 00 00             	addb   $0x0,(%rax)
+  803655:	00 00                	add    %al,(%rax)
+  803657:	00 1d 05 80 00 00    	add    %bl,0x8005(%rip)        # 80b662 <__bss_end+0x3662>
+  80365d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803660 <error_string>:
+	...
+  803668:	25 32 80 00 00 00 00 00 37 32 80 00 00 00 00 00     %2......72......
+  803678:	47 32 80 00 00 00 00 00 59 32 80 00 00 00 00 00     G2......Y2......
+  803688:	67 32 80 00 00 00 00 00 7b 32 80 00 00 00 00 00     g2......{2......
+  803698:	90 32 80 00 00 00 00 00 a3 32 80 00 00 00 00 00     .2.......2......
+  8036a8:	b5 32 80 00 00 00 00 00 c9 32 80 00 00 00 00 00     .2.......2......
+  8036b8:	d9 32 80 00 00 00 00 00 ec 32 80 00 00 00 00 00     .2.......2......
+  8036c8:	03 33 80 00 00 00 00 00 19 33 80 00 00 00 00 00     .3.......3......
+  8036d8:	31 33 80 00 00 00 00 00 49 33 80 00 00 00 00 00     13......I3......
+  8036e8:	56 33 80 00 00 00 00 00 10 37 80 00 00 00 00 00     V3.......7......
+  8036f8:	6a 33 80 00 00 00 00 00 00 00 00 00 00 00 00 00     j3..............
+  803708:	82 33 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .3......file is 
+  803718:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803728:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803738:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803748:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803758:	6c 6c 2e 63 00 0f 1f 00 55 73 65 72 73 70 61 63     ll.c....Userspac
+  803768:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  803778:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  803788:	65 72 72 3d 25 78 0a 00 61 64 64 5f 70 67 66 61     err=%x..add_pgfa
+  803798:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  8037a8:	5f 61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61     _alloc_region fa
+  8037b8:	69 6c 65 64 00 00 00 00 61 64 64 5f 70 67 66 61     iled....add_pgfa
+  8037c8:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  8037d8:	5f 65 6e 76 5f 73 65 74 5f 70 67 66 61 75 6c 74     _env_set_pgfault
+  8037e8:	5f 75 70 63 61 6c 6c 20 66 61 69 6c 65 64 00 6c     _upcall failed.l
+  8037f8:	69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65 74     ib/pgfault.c.set
+  803808:	5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65 72     _pgfault_handler
+  803818:	3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72 5f     : %i._pfhandler_
+  803828:	69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00 61     inititiallized.a
+  803838:	73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65 64 3a     ssertion failed:
+  803848:	20 25 73 00 0f 1f 40 00 5b 25 30 38 78 5d 20 75      %s...@.[%08x] u
+  803858:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803868:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803878:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803888:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803898:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8038a8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8038b8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8038c8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038d8:	84 00 00 00 00 00 66 90                             ......f.
+
+00000000008038e0 <devtab>:
+  8038e0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8038f0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803900:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  803910:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  803920:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  803930:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 0f 1f 40 00     _SIZE) == 2...@.
+  803940:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  803950:	20 62 65 67 69 6e 20 67 65 6e 65 72 69 63 20 68      begin generic h
+  803960:	61 6e 64 6c 65 72 20 66 6f 72 20 25 64 0a 00 00     andler for %d...
+  803970:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  803980:	20 65 78 69 74 69 6e 67 20 64 75 65 20 74 6f 20      exiting due to 
+  803990:	73 69 67 6e 61 6c 20 25 64 0a 00 00 00 00 00 00     signal %d.......
+  8039a0:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  8039b0:	20 69 67 6e 6f 72 69 6e 67 20 73 69 67 6e 61 6c      ignoring signal
+  8039c0:	20 25 64 0a 00 00 00 00 73 69 67 6e 61 6c 73 3a      %d.....signals:
+  8039d0:	20 65 6e 76 20 25 78 3a 20 65 6e 64 20 67 65 6e      env %x: end gen
+  8039e0:	65 72 69 63 20 68 61 6e 64 6c 65 72 20 66 6f 72     eric handler for
+  8039f0:	20 25 64 0a 00 66 61 6c 73 65 00 6c 69 62 2f 73      %d..false.lib/s
+  803a00:	69 67 6e 61 6c 2e 63 00 3c 63 6f 6e 73 3e 00 63     ignal.c.<cons>.c
+  803a10:	6f 6e 73 00 69 70 63 5f 73 65 6e 64 3a 20 66 61     ons.ipc_send: fa
+  803a20:	69 6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62     iled to send.lib
+  803a30:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  803a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
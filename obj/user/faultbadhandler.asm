@@ -0,0 +1,5397 @@
+
+obj/user/faultbadhandler:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4e 00 00 00       	call   800071 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * we outrun the stack with invocations of the user-level handler */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  800029:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80002e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800033:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80003a:	00 00 00 
+  80003d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800042:	48 b8 c4 02 80 00 00 	movabs $0x8002c4,%rax
+  800049:	00 00 00 
+  80004c:	ff d0                	call   *%rax
+    sys_env_set_pgfault_upcall(0, (void *)0xDEADBEEF);
+  80004e:	be ef be ad de       	mov    $0xdeadbeef,%esi
+  800053:	bf 00 00 00 00       	mov    $0x0,%edi
+  800058:	48 b8 99 05 80 00 00 	movabs $0x800599,%rax
+  80005f:	00 00 00 
+  800062:	ff d0                	call   *%rax
+    *(volatile int *)0 = 0;
+  800064:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80006b:	00 00 00 00 
+#endif
+}
+  80006f:	5d                   	pop    %rbp
+  800070:	c3                   	ret
+
+0000000000800071 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800071:	55                   	push   %rbp
+  800072:	48 89 e5             	mov    %rsp,%rbp
+  800075:	41 56                	push   %r14
+  800077:	41 55                	push   %r13
+  800079:	41 54                	push   %r12
+  80007b:	53                   	push   %rbx
+  80007c:	41 89 fd             	mov    %edi,%r13d
+  80007f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800082:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800089:	00 00 00 
+  80008c:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800093:	00 00 00 
+  800096:	48 39 c2             	cmp    %rax,%rdx
+  800099:	73 17                	jae    8000b2 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80009b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80009e:	49 89 c4             	mov    %rax,%r12
+  8000a1:	48 83 c3 08          	add    $0x8,%rbx
+  8000a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000aa:	ff 53 f8             	call   *-0x8(%rbx)
+  8000ad:	4c 39 e3             	cmp    %r12,%rbx
+  8000b0:	72 ef                	jb     8000a1 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8000b2:	48 b8 04 02 80 00 00 	movabs $0x800204,%rax
+  8000b9:	00 00 00 
+  8000bc:	ff d0                	call   *%rax
+  8000be:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8000c1:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8000c8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000cf:	00 00 00 
+  8000d2:	48 01 d0             	add    %rdx,%rax
+  8000d5:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000dc:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000df:	45 85 ed             	test   %r13d,%r13d
+  8000e2:	7e 0d                	jle    8000f1 <libmain+0x80>
+  8000e4:	49 8b 06             	mov    (%r14),%rax
+  8000e7:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000ee:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000f1:	4c 89 f6             	mov    %r14,%rsi
+  8000f4:	44 89 ef             	mov    %r13d,%edi
+  8000f7:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000fe:	00 00 00 
+  800101:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800103:	48 b8 18 01 80 00 00 	movabs $0x800118,%rax
+  80010a:	00 00 00 
+  80010d:	ff d0                	call   *%rax
+#endif
+}
+  80010f:	5b                   	pop    %rbx
+  800110:	41 5c                	pop    %r12
+  800112:	41 5d                	pop    %r13
+  800114:	41 5e                	pop    %r14
+  800116:	5d                   	pop    %rbp
+  800117:	c3                   	ret
+
+0000000000800118 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800118:	55                   	push   %rbp
+  800119:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80011c:	48 b8 8c 0a 80 00 00 	movabs $0x800a8c,%rax
+  800123:	00 00 00 
+  800126:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800128:	bf 00 00 00 00       	mov    $0x0,%edi
+  80012d:	48 b8 99 01 80 00 00 	movabs $0x800199,%rax
+  800134:	00 00 00 
+  800137:	ff d0                	call   *%rax
+}
+  800139:	5d                   	pop    %rbp
+  80013a:	c3                   	ret
+
+000000000080013b <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80013b:	55                   	push   %rbp
+  80013c:	48 89 e5             	mov    %rsp,%rbp
+  80013f:	53                   	push   %rbx
+  800140:	48 89 fa             	mov    %rdi,%rdx
+  800143:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800146:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80014b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800150:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800155:	be 00 00 00 00       	mov    $0x0,%esi
+  80015a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800160:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800162:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800166:	c9                   	leave
+  800167:	c3                   	ret
+
+0000000000800168 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800168:	55                   	push   %rbp
+  800169:	48 89 e5             	mov    %rsp,%rbp
+  80016c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80016d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800172:	ba 00 00 00 00       	mov    $0x0,%edx
+  800177:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80017c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800181:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800186:	be 00 00 00 00       	mov    $0x0,%esi
+  80018b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800191:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800193:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800197:	c9                   	leave
+  800198:	c3                   	ret
+
+0000000000800199 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800199:	55                   	push   %rbp
+  80019a:	48 89 e5             	mov    %rsp,%rbp
+  80019d:	53                   	push   %rbx
+  80019e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8001a2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8001a5:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8001be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001c4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001c6:	48 85 c0             	test   %rax,%rax
+  8001c9:	7f 06                	jg     8001d1 <sys_env_destroy+0x38>
+}
+  8001cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001cf:	c9                   	leave
+  8001d0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001d1:	49 89 c0             	mov    %rax,%r8
+  8001d4:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001d9:	48 ba 70 2b 80 00 00 	movabs $0x802b70,%rdx
+  8001e0:	00 00 00 
+  8001e3:	be 26 00 00 00       	mov    $0x26,%esi
+  8001e8:	48 bf 8f 2b 80 00 00 	movabs $0x802b8f,%rdi
+  8001ef:	00 00 00 
+  8001f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f7:	49 b9 39 1b 80 00 00 	movabs $0x801b39,%r9
+  8001fe:	00 00 00 
+  800201:	41 ff d1             	call   *%r9
+
+0000000000800204 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800204:	55                   	push   %rbp
+  800205:	48 89 e5             	mov    %rsp,%rbp
+  800208:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800209:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80020e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800213:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800218:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80021d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800222:	be 00 00 00 00       	mov    $0x0,%esi
+  800227:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80022d:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80022f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800233:	c9                   	leave
+  800234:	c3                   	ret
+
+0000000000800235 <sys_yield>:
+
+void
+sys_yield(void) {
+  800235:	55                   	push   %rbp
+  800236:	48 89 e5             	mov    %rsp,%rbp
+  800239:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80023a:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80023f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800244:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800249:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80024e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800253:	be 00 00 00 00       	mov    $0x0,%esi
+  800258:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80025e:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800260:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800264:	c9                   	leave
+  800265:	c3                   	ret
+
+0000000000800266 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800266:	55                   	push   %rbp
+  800267:	48 89 e5             	mov    %rsp,%rbp
+  80026a:	53                   	push   %rbx
+  80026b:	48 89 fa             	mov    %rdi,%rdx
+  80026e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800271:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800276:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80027d:	00 00 00 
+  800280:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800285:	be 00 00 00 00       	mov    $0x0,%esi
+  80028a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800290:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800292:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800296:	c9                   	leave
+  800297:	c3                   	ret
+
+0000000000800298 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800298:	55                   	push   %rbp
+  800299:	48 89 e5             	mov    %rsp,%rbp
+  80029c:	53                   	push   %rbx
+  80029d:	49 89 f8             	mov    %rdi,%r8
+  8002a0:	48 89 d3             	mov    %rdx,%rbx
+  8002a3:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002a6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002ab:	4c 89 c2             	mov    %r8,%rdx
+  8002ae:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002bc:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002c2:	c9                   	leave
+  8002c3:	c3                   	ret
+
+00000000008002c4 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002c4:	55                   	push   %rbp
+  8002c5:	48 89 e5             	mov    %rsp,%rbp
+  8002c8:	53                   	push   %rbx
+  8002c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8002cd:	89 f8                	mov    %edi,%eax
+  8002cf:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002d2:	48 63 f9             	movslq %ecx,%rdi
+  8002d5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002d8:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002dd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8002e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002eb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002ed:	48 85 c0             	test   %rax,%rax
+  8002f0:	7f 06                	jg     8002f8 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002f6:	c9                   	leave
+  8002f7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002f8:	49 89 c0             	mov    %rax,%r8
+  8002fb:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800300:	48 ba 70 2b 80 00 00 	movabs $0x802b70,%rdx
+  800307:	00 00 00 
+  80030a:	be 26 00 00 00       	mov    $0x26,%esi
+  80030f:	48 bf 8f 2b 80 00 00 	movabs $0x802b8f,%rdi
+  800316:	00 00 00 
+  800319:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031e:	49 b9 39 1b 80 00 00 	movabs $0x801b39,%r9
+  800325:	00 00 00 
+  800328:	41 ff d1             	call   *%r9
+
+000000000080032b <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80032b:	55                   	push   %rbp
+  80032c:	48 89 e5             	mov    %rsp,%rbp
+  80032f:	53                   	push   %rbx
+  800330:	48 83 ec 08          	sub    $0x8,%rsp
+  800334:	89 f8                	mov    %edi,%eax
+  800336:	49 89 f2             	mov    %rsi,%r10
+  800339:	48 89 cf             	mov    %rcx,%rdi
+  80033c:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80033f:	48 63 da             	movslq %edx,%rbx
+  800342:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800345:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80034a:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80034d:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800350:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800352:	48 85 c0             	test   %rax,%rax
+  800355:	7f 06                	jg     80035d <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800357:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80035b:	c9                   	leave
+  80035c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80035d:	49 89 c0             	mov    %rax,%r8
+  800360:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800365:	48 ba 70 2b 80 00 00 	movabs $0x802b70,%rdx
+  80036c:	00 00 00 
+  80036f:	be 26 00 00 00       	mov    $0x26,%esi
+  800374:	48 bf 8f 2b 80 00 00 	movabs $0x802b8f,%rdi
+  80037b:	00 00 00 
+  80037e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800383:	49 b9 39 1b 80 00 00 	movabs $0x801b39,%r9
+  80038a:	00 00 00 
+  80038d:	41 ff d1             	call   *%r9
+
+0000000000800390 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800390:	55                   	push   %rbp
+  800391:	48 89 e5             	mov    %rsp,%rbp
+  800394:	53                   	push   %rbx
+  800395:	48 83 ec 08          	sub    $0x8,%rsp
+  800399:	48 89 f1             	mov    %rsi,%rcx
+  80039c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80039f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003a2:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003a7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8003b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003b7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003b9:	48 85 c0             	test   %rax,%rax
+  8003bc:	7f 06                	jg     8003c4 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8003be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003c2:	c9                   	leave
+  8003c3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003c4:	49 89 c0             	mov    %rax,%r8
+  8003c7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003cc:	48 ba 70 2b 80 00 00 	movabs $0x802b70,%rdx
+  8003d3:	00 00 00 
+  8003d6:	be 26 00 00 00       	mov    $0x26,%esi
+  8003db:	48 bf 8f 2b 80 00 00 	movabs $0x802b8f,%rdi
+  8003e2:	00 00 00 
+  8003e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ea:	49 b9 39 1b 80 00 00 	movabs $0x801b39,%r9
+  8003f1:	00 00 00 
+  8003f4:	41 ff d1             	call   *%r9
+
+00000000008003f7 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8003f7:	55                   	push   %rbp
+  8003f8:	48 89 e5             	mov    %rsp,%rbp
+  8003fb:	53                   	push   %rbx
+  8003fc:	48 83 ec 08          	sub    $0x8,%rsp
+  800400:	89 f8                	mov    %edi,%eax
+  800402:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  800405:	48 63 f9             	movslq %ecx,%rdi
+  800408:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80040b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800410:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800413:	be 00 00 00 00       	mov    $0x0,%esi
+  800418:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80041e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800420:	48 85 c0             	test   %rax,%rax
+  800423:	7f 06                	jg     80042b <sys_region_advise+0x34>
+}
+  800425:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800429:	c9                   	leave
+  80042a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80042b:	49 89 c0             	mov    %rax,%r8
+  80042e:	b9 14 00 00 00       	mov    $0x14,%ecx
+  800433:	48 ba 70 2b 80 00 00 	movabs $0x802b70,%rdx
+  80043a:	00 00 00 
+  80043d:	be 26 00 00 00       	mov    $0x26,%esi
+  800442:	48 bf 8f 2b 80 00 00 	movabs $0x802b8f,%rdi
+  800449:	00 00 00 
+  80044c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800451:	49 b9 39 1b 80 00 00 	movabs $0x801b39,%r9
+  800458:	00 00 00 
+  80045b:	41 ff d1             	call   *%r9
+
+000000000080045e <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  80045e:	55                   	push   %rbp
+  80045f:	48 89 e5             	mov    %rsp,%rbp
+  800462:	53                   	push   %rbx
+  800463:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  800467:	48 63 ce             	movslq %esi,%rcx
+  80046a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80046d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800472:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800477:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80047c:	be 00 00 00 00       	mov    $0x0,%esi
+  800481:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800487:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800489:	48 85 c0             	test   %rax,%rax
+  80048c:	7f 06                	jg     800494 <sys_env_set_nice+0x36>
+}
+  80048e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800492:	c9                   	leave
+  800493:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800494:	49 89 c0             	mov    %rax,%r8
+  800497:	b9 15 00 00 00       	mov    $0x15,%ecx
+  80049c:	48 ba 70 2b 80 00 00 	movabs $0x802b70,%rdx
+  8004a3:	00 00 00 
+  8004a6:	be 26 00 00 00       	mov    $0x26,%esi
+  8004ab:	48 bf 8f 2b 80 00 00 	movabs $0x802b8f,%rdi
+  8004b2:	00 00 00 
+  8004b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ba:	49 b9 39 1b 80 00 00 	movabs $0x801b39,%r9
+  8004c1:	00 00 00 
+  8004c4:	41 ff d1             	call   *%r9
+
+00000000008004c7 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004c7:	55                   	push   %rbp
+  8004c8:	48 89 e5             	mov    %rsp,%rbp
+  8004cb:	53                   	push   %rbx
+  8004cc:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004d0:	48 63 ce             	movslq %esi,%rcx
+  8004d3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004d6:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004e0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8004ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004f0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004f2:	48 85 c0             	test   %rax,%rax
+  8004f5:	7f 06                	jg     8004fd <sys_env_set_status+0x36>
+}
+  8004f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004fb:	c9                   	leave
+  8004fc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004fd:	49 89 c0             	mov    %rax,%r8
+  800500:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800505:	48 ba 70 2b 80 00 00 	movabs $0x802b70,%rdx
+  80050c:	00 00 00 
+  80050f:	be 26 00 00 00       	mov    $0x26,%esi
+  800514:	48 bf 8f 2b 80 00 00 	movabs $0x802b8f,%rdi
+  80051b:	00 00 00 
+  80051e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800523:	49 b9 39 1b 80 00 00 	movabs $0x801b39,%r9
+  80052a:	00 00 00 
+  80052d:	41 ff d1             	call   *%r9
+
+0000000000800530 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800530:	55                   	push   %rbp
+  800531:	48 89 e5             	mov    %rsp,%rbp
+  800534:	53                   	push   %rbx
+  800535:	48 83 ec 08          	sub    $0x8,%rsp
+  800539:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80053c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80053f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800544:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800549:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80054e:	be 00 00 00 00       	mov    $0x0,%esi
+  800553:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800559:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80055b:	48 85 c0             	test   %rax,%rax
+  80055e:	7f 06                	jg     800566 <sys_env_set_trapframe+0x36>
+}
+  800560:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800564:	c9                   	leave
+  800565:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800566:	49 89 c0             	mov    %rax,%r8
+  800569:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80056e:	48 ba 70 2b 80 00 00 	movabs $0x802b70,%rdx
+  800575:	00 00 00 
+  800578:	be 26 00 00 00       	mov    $0x26,%esi
+  80057d:	48 bf 8f 2b 80 00 00 	movabs $0x802b8f,%rdi
+  800584:	00 00 00 
+  800587:	b8 00 00 00 00       	mov    $0x0,%eax
+  80058c:	49 b9 39 1b 80 00 00 	movabs $0x801b39,%r9
+  800593:	00 00 00 
+  800596:	41 ff d1             	call   *%r9
+
+0000000000800599 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800599:	55                   	push   %rbp
+  80059a:	48 89 e5             	mov    %rsp,%rbp
+  80059d:	53                   	push   %rbx
+  80059e:	48 83 ec 08          	sub    $0x8,%rsp
+  8005a2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005a5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005a8:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8005bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005c4:	48 85 c0             	test   %rax,%rax
+  8005c7:	7f 06                	jg     8005cf <sys_env_set_pgfault_upcall+0x36>
+}
+  8005c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005cd:	c9                   	leave
+  8005ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005cf:	49 89 c0             	mov    %rax,%r8
+  8005d2:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8005d7:	48 ba 70 2b 80 00 00 	movabs $0x802b70,%rdx
+  8005de:	00 00 00 
+  8005e1:	be 26 00 00 00       	mov    $0x26,%esi
+  8005e6:	48 bf 8f 2b 80 00 00 	movabs $0x802b8f,%rdi
+  8005ed:	00 00 00 
+  8005f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f5:	49 b9 39 1b 80 00 00 	movabs $0x801b39,%r9
+  8005fc:	00 00 00 
+  8005ff:	41 ff d1             	call   *%r9
+
+0000000000800602 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800602:	55                   	push   %rbp
+  800603:	48 89 e5             	mov    %rsp,%rbp
+  800606:	53                   	push   %rbx
+  800607:	89 f8                	mov    %edi,%eax
+  800609:	49 89 f1             	mov    %rsi,%r9
+  80060c:	48 89 d3             	mov    %rdx,%rbx
+  80060f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800612:	49 63 f0             	movslq %r8d,%rsi
+  800615:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800618:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80061d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800620:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800626:	cd 30                	int    $0x30
+}
+  800628:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80062c:	c9                   	leave
+  80062d:	c3                   	ret
+
+000000000080062e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80062e:	55                   	push   %rbp
+  80062f:	48 89 e5             	mov    %rsp,%rbp
+  800632:	53                   	push   %rbx
+  800633:	48 83 ec 08          	sub    $0x8,%rsp
+  800637:	48 89 fa             	mov    %rdi,%rdx
+  80063a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80063d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800642:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800647:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80064c:	be 00 00 00 00       	mov    $0x0,%esi
+  800651:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800657:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800659:	48 85 c0             	test   %rax,%rax
+  80065c:	7f 06                	jg     800664 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80065e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800662:	c9                   	leave
+  800663:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800664:	49 89 c0             	mov    %rax,%r8
+  800667:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80066c:	48 ba 70 2b 80 00 00 	movabs $0x802b70,%rdx
+  800673:	00 00 00 
+  800676:	be 26 00 00 00       	mov    $0x26,%esi
+  80067b:	48 bf 8f 2b 80 00 00 	movabs $0x802b8f,%rdi
+  800682:	00 00 00 
+  800685:	b8 00 00 00 00       	mov    $0x0,%eax
+  80068a:	49 b9 39 1b 80 00 00 	movabs $0x801b39,%r9
+  800691:	00 00 00 
+  800694:	41 ff d1             	call   *%r9
+
+0000000000800697 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800697:	55                   	push   %rbp
+  800698:	48 89 e5             	mov    %rsp,%rbp
+  80069b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80069c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8006ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006c0:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8006c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006c6:	c9                   	leave
+  8006c7:	c3                   	ret
+
+00000000008006c8 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8006c8:	55                   	push   %rbp
+  8006c9:	48 89 e5             	mov    %rsp,%rbp
+  8006cc:	53                   	push   %rbx
+  8006cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8006d1:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8006d4:	48 63 ce             	movslq %esi,%rcx
+  8006d7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006da:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8006e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006ef:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8006f1:	48 85 c0             	test   %rax,%rax
+  8006f4:	7f 06                	jg     8006fc <sys_sigqueue+0x34>
+}
+  8006f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006fa:	c9                   	leave
+  8006fb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006fc:	49 89 c0             	mov    %rax,%r8
+  8006ff:	b9 10 00 00 00       	mov    $0x10,%ecx
+  800704:	48 ba 70 2b 80 00 00 	movabs $0x802b70,%rdx
+  80070b:	00 00 00 
+  80070e:	be 26 00 00 00       	mov    $0x26,%esi
+  800713:	48 bf 8f 2b 80 00 00 	movabs $0x802b8f,%rdi
+  80071a:	00 00 00 
+  80071d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800722:	49 b9 39 1b 80 00 00 	movabs $0x801b39,%r9
+  800729:	00 00 00 
+  80072c:	41 ff d1             	call   *%r9
+
+000000000080072f <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  80072f:	55                   	push   %rbp
+  800730:	48 89 e5             	mov    %rsp,%rbp
+  800733:	53                   	push   %rbx
+  800734:	48 83 ec 08          	sub    $0x8,%rsp
+  800738:	48 89 fa             	mov    %rdi,%rdx
+  80073b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80073e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800743:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800748:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80074d:	be 00 00 00 00       	mov    $0x0,%esi
+  800752:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800758:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80075a:	48 85 c0             	test   %rax,%rax
+  80075d:	7f 06                	jg     800765 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  80075f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800763:	c9                   	leave
+  800764:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800765:	49 89 c0             	mov    %rax,%r8
+  800768:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80076d:	48 ba 70 2b 80 00 00 	movabs $0x802b70,%rdx
+  800774:	00 00 00 
+  800777:	be 26 00 00 00       	mov    $0x26,%esi
+  80077c:	48 bf 8f 2b 80 00 00 	movabs $0x802b8f,%rdi
+  800783:	00 00 00 
+  800786:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078b:	49 b9 39 1b 80 00 00 	movabs $0x801b39,%r9
+  800792:	00 00 00 
+  800795:	41 ff d1             	call   *%r9
+
+0000000000800798 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  800798:	55                   	push   %rbp
+  800799:	48 89 e5             	mov    %rsp,%rbp
+  80079c:	53                   	push   %rbx
+  80079d:	48 83 ec 08          	sub    $0x8,%rsp
+  8007a1:	48 89 f1             	mov    %rsi,%rcx
+  8007a4:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  8007a7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8007aa:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8007af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8007b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8007bf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8007c1:	48 85 c0             	test   %rax,%rax
+  8007c4:	7f 06                	jg     8007cc <sys_sigaction+0x34>
+}
+  8007c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007ca:	c9                   	leave
+  8007cb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007cc:	49 89 c0             	mov    %rax,%r8
+  8007cf:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8007d4:	48 ba 70 2b 80 00 00 	movabs $0x802b70,%rdx
+  8007db:	00 00 00 
+  8007de:	be 26 00 00 00       	mov    $0x26,%esi
+  8007e3:	48 bf 8f 2b 80 00 00 	movabs $0x802b8f,%rdi
+  8007ea:	00 00 00 
+  8007ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f2:	49 b9 39 1b 80 00 00 	movabs $0x801b39,%r9
+  8007f9:	00 00 00 
+  8007fc:	41 ff d1             	call   *%r9
+
+00000000008007ff <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8007ff:	55                   	push   %rbp
+  800800:	48 89 e5             	mov    %rsp,%rbp
+  800803:	53                   	push   %rbx
+  800804:	48 83 ec 08          	sub    $0x8,%rsp
+  800808:	48 89 f1             	mov    %rsi,%rcx
+  80080b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  80080e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800811:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800816:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80081b:	be 00 00 00 00       	mov    $0x0,%esi
+  800820:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800826:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800828:	48 85 c0             	test   %rax,%rax
+  80082b:	7f 06                	jg     800833 <sys_sigprocmask+0x34>
+}
+  80082d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800831:	c9                   	leave
+  800832:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800833:	49 89 c0             	mov    %rax,%r8
+  800836:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80083b:	48 ba 70 2b 80 00 00 	movabs $0x802b70,%rdx
+  800842:	00 00 00 
+  800845:	be 26 00 00 00       	mov    $0x26,%esi
+  80084a:	48 bf 8f 2b 80 00 00 	movabs $0x802b8f,%rdi
+  800851:	00 00 00 
+  800854:	b8 00 00 00 00       	mov    $0x0,%eax
+  800859:	49 b9 39 1b 80 00 00 	movabs $0x801b39,%r9
+  800860:	00 00 00 
+  800863:	41 ff d1             	call   *%r9
+
+0000000000800866 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800866:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80086d:	ff ff ff 
+  800870:	48 01 f8             	add    %rdi,%rax
+  800873:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800877:	c3                   	ret
+
+0000000000800878 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800878:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80087f:	ff ff ff 
+  800882:	48 01 f8             	add    %rdi,%rax
+  800885:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800889:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80088f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800893:	c3                   	ret
+
+0000000000800894 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800894:	55                   	push   %rbp
+  800895:	48 89 e5             	mov    %rsp,%rbp
+  800898:	41 57                	push   %r15
+  80089a:	41 56                	push   %r14
+  80089c:	41 55                	push   %r13
+  80089e:	41 54                	push   %r12
+  8008a0:	53                   	push   %rbx
+  8008a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8008a5:	49 89 ff             	mov    %rdi,%r15
+  8008a8:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8008ad:	49 bd 12 18 80 00 00 	movabs $0x801812,%r13
+  8008b4:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8008b7:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8008bd:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8008c0:	48 89 df             	mov    %rbx,%rdi
+  8008c3:	41 ff d5             	call   *%r13
+  8008c6:	83 e0 04             	and    $0x4,%eax
+  8008c9:	74 17                	je     8008e2 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8008cb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8008d2:	4c 39 f3             	cmp    %r14,%rbx
+  8008d5:	75 e6                	jne    8008bd <fd_alloc+0x29>
+  8008d7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8008dd:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8008e2:	4d 89 27             	mov    %r12,(%r15)
+}
+  8008e5:	48 83 c4 08          	add    $0x8,%rsp
+  8008e9:	5b                   	pop    %rbx
+  8008ea:	41 5c                	pop    %r12
+  8008ec:	41 5d                	pop    %r13
+  8008ee:	41 5e                	pop    %r14
+  8008f0:	41 5f                	pop    %r15
+  8008f2:	5d                   	pop    %rbp
+  8008f3:	c3                   	ret
+
+00000000008008f4 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8008f4:	83 ff 1f             	cmp    $0x1f,%edi
+  8008f7:	77 39                	ja     800932 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8008f9:	55                   	push   %rbp
+  8008fa:	48 89 e5             	mov    %rsp,%rbp
+  8008fd:	41 54                	push   %r12
+  8008ff:	53                   	push   %rbx
+  800900:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800903:	48 63 df             	movslq %edi,%rbx
+  800906:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80090d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800911:	48 89 df             	mov    %rbx,%rdi
+  800914:	48 b8 12 18 80 00 00 	movabs $0x801812,%rax
+  80091b:	00 00 00 
+  80091e:	ff d0                	call   *%rax
+  800920:	a8 04                	test   $0x4,%al
+  800922:	74 14                	je     800938 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800924:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800928:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80092d:	5b                   	pop    %rbx
+  80092e:	41 5c                	pop    %r12
+  800930:	5d                   	pop    %rbp
+  800931:	c3                   	ret
+        return -E_INVAL;
+  800932:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800937:	c3                   	ret
+        return -E_INVAL;
+  800938:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80093d:	eb ee                	jmp    80092d <fd_lookup+0x39>
+
+000000000080093f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80093f:	55                   	push   %rbp
+  800940:	48 89 e5             	mov    %rsp,%rbp
+  800943:	41 54                	push   %r12
+  800945:	53                   	push   %rbx
+  800946:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800949:	48 b8 20 2c 80 00 00 	movabs $0x802c20,%rax
+  800950:	00 00 00 
+  800953:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80095a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80095d:	39 3b                	cmp    %edi,(%rbx)
+  80095f:	74 47                	je     8009a8 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800961:	48 83 c0 08          	add    $0x8,%rax
+  800965:	48 8b 18             	mov    (%rax),%rbx
+  800968:	48 85 db             	test   %rbx,%rbx
+  80096b:	75 f0                	jne    80095d <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80096d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800974:	00 00 00 
+  800977:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80097d:	89 fa                	mov    %edi,%edx
+  80097f:	48 bf a0 2b 80 00 00 	movabs $0x802ba0,%rdi
+  800986:	00 00 00 
+  800989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098e:	48 b9 89 1c 80 00 00 	movabs $0x801c89,%rcx
+  800995:	00 00 00 
+  800998:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80099a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80099f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8009a3:	5b                   	pop    %rbx
+  8009a4:	41 5c                	pop    %r12
+  8009a6:	5d                   	pop    %rbp
+  8009a7:	c3                   	ret
+            return 0;
+  8009a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ad:	eb f0                	jmp    80099f <dev_lookup+0x60>
+
+00000000008009af <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8009af:	55                   	push   %rbp
+  8009b0:	48 89 e5             	mov    %rsp,%rbp
+  8009b3:	41 55                	push   %r13
+  8009b5:	41 54                	push   %r12
+  8009b7:	53                   	push   %rbx
+  8009b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8009bc:	48 89 fb             	mov    %rdi,%rbx
+  8009bf:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8009c2:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8009c9:	ff ff ff 
+  8009cc:	48 01 df             	add    %rbx,%rdi
+  8009cf:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8009d3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009d7:	48 b8 f4 08 80 00 00 	movabs $0x8008f4,%rax
+  8009de:	00 00 00 
+  8009e1:	ff d0                	call   *%rax
+  8009e3:	41 89 c5             	mov    %eax,%r13d
+  8009e6:	85 c0                	test   %eax,%eax
+  8009e8:	78 06                	js     8009f0 <fd_close+0x41>
+  8009ea:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8009ee:	74 1a                	je     800a0a <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8009f0:	45 84 e4             	test   %r12b,%r12b
+  8009f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f8:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8009fc:	44 89 e8             	mov    %r13d,%eax
+  8009ff:	48 83 c4 18          	add    $0x18,%rsp
+  800a03:	5b                   	pop    %rbx
+  800a04:	41 5c                	pop    %r12
+  800a06:	41 5d                	pop    %r13
+  800a08:	5d                   	pop    %rbp
+  800a09:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800a0a:	8b 3b                	mov    (%rbx),%edi
+  800a0c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a10:	48 b8 3f 09 80 00 00 	movabs $0x80093f,%rax
+  800a17:	00 00 00 
+  800a1a:	ff d0                	call   *%rax
+  800a1c:	41 89 c5             	mov    %eax,%r13d
+  800a1f:	85 c0                	test   %eax,%eax
+  800a21:	78 1b                	js     800a3e <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800a23:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a27:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800a2b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800a31:	48 85 c0             	test   %rax,%rax
+  800a34:	74 08                	je     800a3e <fd_close+0x8f>
+  800a36:	48 89 df             	mov    %rbx,%rdi
+  800a39:	ff d0                	call   *%rax
+  800a3b:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800a3e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a43:	48 89 de             	mov    %rbx,%rsi
+  800a46:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a4b:	48 b8 90 03 80 00 00 	movabs $0x800390,%rax
+  800a52:	00 00 00 
+  800a55:	ff d0                	call   *%rax
+    return res;
+  800a57:	eb a3                	jmp    8009fc <fd_close+0x4d>
+
+0000000000800a59 <close>:
+
+int
+close(int fdnum) {
+  800a59:	55                   	push   %rbp
+  800a5a:	48 89 e5             	mov    %rsp,%rbp
+  800a5d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800a61:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800a65:	48 b8 f4 08 80 00 00 	movabs $0x8008f4,%rax
+  800a6c:	00 00 00 
+  800a6f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800a71:	85 c0                	test   %eax,%eax
+  800a73:	78 15                	js     800a8a <close+0x31>
+
+    return fd_close(fd, 1);
+  800a75:	be 01 00 00 00       	mov    $0x1,%esi
+  800a7a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800a7e:	48 b8 af 09 80 00 00 	movabs $0x8009af,%rax
+  800a85:	00 00 00 
+  800a88:	ff d0                	call   *%rax
+}
+  800a8a:	c9                   	leave
+  800a8b:	c3                   	ret
+
+0000000000800a8c <close_all>:
+
+void
+close_all(void) {
+  800a8c:	55                   	push   %rbp
+  800a8d:	48 89 e5             	mov    %rsp,%rbp
+  800a90:	41 54                	push   %r12
+  800a92:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800a93:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a98:	49 bc 59 0a 80 00 00 	movabs $0x800a59,%r12
+  800a9f:	00 00 00 
+  800aa2:	89 df                	mov    %ebx,%edi
+  800aa4:	41 ff d4             	call   *%r12
+  800aa7:	83 c3 01             	add    $0x1,%ebx
+  800aaa:	83 fb 20             	cmp    $0x20,%ebx
+  800aad:	75 f3                	jne    800aa2 <close_all+0x16>
+}
+  800aaf:	5b                   	pop    %rbx
+  800ab0:	41 5c                	pop    %r12
+  800ab2:	5d                   	pop    %rbp
+  800ab3:	c3                   	ret
+
+0000000000800ab4 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800ab4:	55                   	push   %rbp
+  800ab5:	48 89 e5             	mov    %rsp,%rbp
+  800ab8:	41 57                	push   %r15
+  800aba:	41 56                	push   %r14
+  800abc:	41 55                	push   %r13
+  800abe:	41 54                	push   %r12
+  800ac0:	53                   	push   %rbx
+  800ac1:	48 83 ec 18          	sub    $0x18,%rsp
+  800ac5:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800ac8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800acc:	48 b8 f4 08 80 00 00 	movabs $0x8008f4,%rax
+  800ad3:	00 00 00 
+  800ad6:	ff d0                	call   *%rax
+  800ad8:	89 c3                	mov    %eax,%ebx
+  800ada:	85 c0                	test   %eax,%eax
+  800adc:	0f 88 b8 00 00 00    	js     800b9a <dup+0xe6>
+    close(newfdnum);
+  800ae2:	44 89 e7             	mov    %r12d,%edi
+  800ae5:	48 b8 59 0a 80 00 00 	movabs $0x800a59,%rax
+  800aec:	00 00 00 
+  800aef:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800af1:	4d 63 ec             	movslq %r12d,%r13
+  800af4:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800afb:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800aff:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800b03:	4c 89 ff             	mov    %r15,%rdi
+  800b06:	49 be 78 08 80 00 00 	movabs $0x800878,%r14
+  800b0d:	00 00 00 
+  800b10:	41 ff d6             	call   *%r14
+  800b13:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800b16:	4c 89 ef             	mov    %r13,%rdi
+  800b19:	41 ff d6             	call   *%r14
+  800b1c:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800b1f:	48 89 df             	mov    %rbx,%rdi
+  800b22:	48 b8 12 18 80 00 00 	movabs $0x801812,%rax
+  800b29:	00 00 00 
+  800b2c:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800b2e:	a8 04                	test   $0x4,%al
+  800b30:	74 2b                	je     800b5d <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800b32:	41 89 c1             	mov    %eax,%r9d
+  800b35:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800b3b:	4c 89 f1             	mov    %r14,%rcx
+  800b3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b43:	48 89 de             	mov    %rbx,%rsi
+  800b46:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b4b:	48 b8 2b 03 80 00 00 	movabs $0x80032b,%rax
+  800b52:	00 00 00 
+  800b55:	ff d0                	call   *%rax
+  800b57:	89 c3                	mov    %eax,%ebx
+  800b59:	85 c0                	test   %eax,%eax
+  800b5b:	78 4e                	js     800bab <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800b5d:	4c 89 ff             	mov    %r15,%rdi
+  800b60:	48 b8 12 18 80 00 00 	movabs $0x801812,%rax
+  800b67:	00 00 00 
+  800b6a:	ff d0                	call   *%rax
+  800b6c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800b6f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800b75:	4c 89 e9             	mov    %r13,%rcx
+  800b78:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b7d:	4c 89 fe             	mov    %r15,%rsi
+  800b80:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b85:	48 b8 2b 03 80 00 00 	movabs $0x80032b,%rax
+  800b8c:	00 00 00 
+  800b8f:	ff d0                	call   *%rax
+  800b91:	89 c3                	mov    %eax,%ebx
+  800b93:	85 c0                	test   %eax,%eax
+  800b95:	78 14                	js     800bab <dup+0xf7>
+
+    return newfdnum;
+  800b97:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800b9a:	89 d8                	mov    %ebx,%eax
+  800b9c:	48 83 c4 18          	add    $0x18,%rsp
+  800ba0:	5b                   	pop    %rbx
+  800ba1:	41 5c                	pop    %r12
+  800ba3:	41 5d                	pop    %r13
+  800ba5:	41 5e                	pop    %r14
+  800ba7:	41 5f                	pop    %r15
+  800ba9:	5d                   	pop    %rbp
+  800baa:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800bab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800bb0:	4c 89 ee             	mov    %r13,%rsi
+  800bb3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bb8:	49 bc 90 03 80 00 00 	movabs $0x800390,%r12
+  800bbf:	00 00 00 
+  800bc2:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800bc5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800bca:	4c 89 f6             	mov    %r14,%rsi
+  800bcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bd2:	41 ff d4             	call   *%r12
+    return res;
+  800bd5:	eb c3                	jmp    800b9a <dup+0xe6>
+
+0000000000800bd7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800bd7:	55                   	push   %rbp
+  800bd8:	48 89 e5             	mov    %rsp,%rbp
+  800bdb:	41 56                	push   %r14
+  800bdd:	41 55                	push   %r13
+  800bdf:	41 54                	push   %r12
+  800be1:	53                   	push   %rbx
+  800be2:	48 83 ec 10          	sub    $0x10,%rsp
+  800be6:	89 fb                	mov    %edi,%ebx
+  800be8:	49 89 f4             	mov    %rsi,%r12
+  800beb:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bee:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bf2:	48 b8 f4 08 80 00 00 	movabs $0x8008f4,%rax
+  800bf9:	00 00 00 
+  800bfc:	ff d0                	call   *%rax
+  800bfe:	85 c0                	test   %eax,%eax
+  800c00:	78 4c                	js     800c4e <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c02:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800c06:	41 8b 3e             	mov    (%r14),%edi
+  800c09:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c0d:	48 b8 3f 09 80 00 00 	movabs $0x80093f,%rax
+  800c14:	00 00 00 
+  800c17:	ff d0                	call   *%rax
+  800c19:	85 c0                	test   %eax,%eax
+  800c1b:	78 35                	js     800c52 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800c1d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800c21:	83 e0 03             	and    $0x3,%eax
+  800c24:	83 f8 01             	cmp    $0x1,%eax
+  800c27:	74 2d                	je     800c56 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800c29:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c2d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800c31:	48 85 c0             	test   %rax,%rax
+  800c34:	74 56                	je     800c8c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800c36:	4c 89 ea             	mov    %r13,%rdx
+  800c39:	4c 89 e6             	mov    %r12,%rsi
+  800c3c:	4c 89 f7             	mov    %r14,%rdi
+  800c3f:	ff d0                	call   *%rax
+}
+  800c41:	48 83 c4 10          	add    $0x10,%rsp
+  800c45:	5b                   	pop    %rbx
+  800c46:	41 5c                	pop    %r12
+  800c48:	41 5d                	pop    %r13
+  800c4a:	41 5e                	pop    %r14
+  800c4c:	5d                   	pop    %rbp
+  800c4d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c4e:	48 98                	cltq
+  800c50:	eb ef                	jmp    800c41 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c52:	48 98                	cltq
+  800c54:	eb eb                	jmp    800c41 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c56:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c5d:	00 00 00 
+  800c60:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c66:	89 da                	mov    %ebx,%edx
+  800c68:	48 bf e1 2b 80 00 00 	movabs $0x802be1,%rdi
+  800c6f:	00 00 00 
+  800c72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c77:	48 b9 89 1c 80 00 00 	movabs $0x801c89,%rcx
+  800c7e:	00 00 00 
+  800c81:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c83:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c8a:	eb b5                	jmp    800c41 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800c8c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c93:	eb ac                	jmp    800c41 <read+0x6a>
+
+0000000000800c95 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800c95:	55                   	push   %rbp
+  800c96:	48 89 e5             	mov    %rsp,%rbp
+  800c99:	41 57                	push   %r15
+  800c9b:	41 56                	push   %r14
+  800c9d:	41 55                	push   %r13
+  800c9f:	41 54                	push   %r12
+  800ca1:	53                   	push   %rbx
+  800ca2:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800ca6:	48 85 d2             	test   %rdx,%rdx
+  800ca9:	74 54                	je     800cff <readn+0x6a>
+  800cab:	41 89 fd             	mov    %edi,%r13d
+  800cae:	49 89 f6             	mov    %rsi,%r14
+  800cb1:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800cb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800cb9:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800cbe:	49 bf d7 0b 80 00 00 	movabs $0x800bd7,%r15
+  800cc5:	00 00 00 
+  800cc8:	4c 89 e2             	mov    %r12,%rdx
+  800ccb:	48 29 f2             	sub    %rsi,%rdx
+  800cce:	4c 01 f6             	add    %r14,%rsi
+  800cd1:	44 89 ef             	mov    %r13d,%edi
+  800cd4:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800cd7:	85 c0                	test   %eax,%eax
+  800cd9:	78 20                	js     800cfb <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800cdb:	01 c3                	add    %eax,%ebx
+  800cdd:	85 c0                	test   %eax,%eax
+  800cdf:	74 08                	je     800ce9 <readn+0x54>
+  800ce1:	48 63 f3             	movslq %ebx,%rsi
+  800ce4:	4c 39 e6             	cmp    %r12,%rsi
+  800ce7:	72 df                	jb     800cc8 <readn+0x33>
+    }
+    return res;
+  800ce9:	48 63 c3             	movslq %ebx,%rax
+}
+  800cec:	48 83 c4 08          	add    $0x8,%rsp
+  800cf0:	5b                   	pop    %rbx
+  800cf1:	41 5c                	pop    %r12
+  800cf3:	41 5d                	pop    %r13
+  800cf5:	41 5e                	pop    %r14
+  800cf7:	41 5f                	pop    %r15
+  800cf9:	5d                   	pop    %rbp
+  800cfa:	c3                   	ret
+        if (inc < 0) return inc;
+  800cfb:	48 98                	cltq
+  800cfd:	eb ed                	jmp    800cec <readn+0x57>
+    int inc = 1, res = 0;
+  800cff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d04:	eb e3                	jmp    800ce9 <readn+0x54>
+
+0000000000800d06 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800d06:	55                   	push   %rbp
+  800d07:	48 89 e5             	mov    %rsp,%rbp
+  800d0a:	41 56                	push   %r14
+  800d0c:	41 55                	push   %r13
+  800d0e:	41 54                	push   %r12
+  800d10:	53                   	push   %rbx
+  800d11:	48 83 ec 10          	sub    $0x10,%rsp
+  800d15:	89 fb                	mov    %edi,%ebx
+  800d17:	49 89 f4             	mov    %rsi,%r12
+  800d1a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d1d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800d21:	48 b8 f4 08 80 00 00 	movabs $0x8008f4,%rax
+  800d28:	00 00 00 
+  800d2b:	ff d0                	call   *%rax
+  800d2d:	85 c0                	test   %eax,%eax
+  800d2f:	78 47                	js     800d78 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d31:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800d35:	41 8b 3e             	mov    (%r14),%edi
+  800d38:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800d3c:	48 b8 3f 09 80 00 00 	movabs $0x80093f,%rax
+  800d43:	00 00 00 
+  800d46:	ff d0                	call   *%rax
+  800d48:	85 c0                	test   %eax,%eax
+  800d4a:	78 30                	js     800d7c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d4c:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800d51:	74 2d                	je     800d80 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d53:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d57:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800d5b:	48 85 c0             	test   %rax,%rax
+  800d5e:	74 56                	je     800db6 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800d60:	4c 89 ea             	mov    %r13,%rdx
+  800d63:	4c 89 e6             	mov    %r12,%rsi
+  800d66:	4c 89 f7             	mov    %r14,%rdi
+  800d69:	ff d0                	call   *%rax
+}
+  800d6b:	48 83 c4 10          	add    $0x10,%rsp
+  800d6f:	5b                   	pop    %rbx
+  800d70:	41 5c                	pop    %r12
+  800d72:	41 5d                	pop    %r13
+  800d74:	41 5e                	pop    %r14
+  800d76:	5d                   	pop    %rbp
+  800d77:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d78:	48 98                	cltq
+  800d7a:	eb ef                	jmp    800d6b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d7c:	48 98                	cltq
+  800d7e:	eb eb                	jmp    800d6b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800d80:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d87:	00 00 00 
+  800d8a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800d90:	89 da                	mov    %ebx,%edx
+  800d92:	48 bf fd 2b 80 00 00 	movabs $0x802bfd,%rdi
+  800d99:	00 00 00 
+  800d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da1:	48 b9 89 1c 80 00 00 	movabs $0x801c89,%rcx
+  800da8:	00 00 00 
+  800dab:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800dad:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800db4:	eb b5                	jmp    800d6b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800db6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800dbd:	eb ac                	jmp    800d6b <write+0x65>
+
+0000000000800dbf <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800dbf:	55                   	push   %rbp
+  800dc0:	48 89 e5             	mov    %rsp,%rbp
+  800dc3:	53                   	push   %rbx
+  800dc4:	48 83 ec 18          	sub    $0x18,%rsp
+  800dc8:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800dca:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800dce:	48 b8 f4 08 80 00 00 	movabs $0x8008f4,%rax
+  800dd5:	00 00 00 
+  800dd8:	ff d0                	call   *%rax
+  800dda:	85 c0                	test   %eax,%eax
+  800ddc:	78 0c                	js     800dea <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800dde:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800de2:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800de5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800dee:	c9                   	leave
+  800def:	c3                   	ret
+
+0000000000800df0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800df0:	55                   	push   %rbp
+  800df1:	48 89 e5             	mov    %rsp,%rbp
+  800df4:	41 55                	push   %r13
+  800df6:	41 54                	push   %r12
+  800df8:	53                   	push   %rbx
+  800df9:	48 83 ec 18          	sub    $0x18,%rsp
+  800dfd:	89 fb                	mov    %edi,%ebx
+  800dff:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e02:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800e06:	48 b8 f4 08 80 00 00 	movabs $0x8008f4,%rax
+  800e0d:	00 00 00 
+  800e10:	ff d0                	call   *%rax
+  800e12:	85 c0                	test   %eax,%eax
+  800e14:	78 38                	js     800e4e <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e16:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800e1a:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800e1e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e22:	48 b8 3f 09 80 00 00 	movabs $0x80093f,%rax
+  800e29:	00 00 00 
+  800e2c:	ff d0                	call   *%rax
+  800e2e:	85 c0                	test   %eax,%eax
+  800e30:	78 1c                	js     800e4e <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800e32:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800e37:	74 20                	je     800e59 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800e39:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e3d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800e41:	48 85 c0             	test   %rax,%rax
+  800e44:	74 47                	je     800e8d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800e46:	44 89 e6             	mov    %r12d,%esi
+  800e49:	4c 89 ef             	mov    %r13,%rdi
+  800e4c:	ff d0                	call   *%rax
+}
+  800e4e:	48 83 c4 18          	add    $0x18,%rsp
+  800e52:	5b                   	pop    %rbx
+  800e53:	41 5c                	pop    %r12
+  800e55:	41 5d                	pop    %r13
+  800e57:	5d                   	pop    %rbp
+  800e58:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800e59:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800e60:	00 00 00 
+  800e63:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800e69:	89 da                	mov    %ebx,%edx
+  800e6b:	48 bf c0 2b 80 00 00 	movabs $0x802bc0,%rdi
+  800e72:	00 00 00 
+  800e75:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7a:	48 b9 89 1c 80 00 00 	movabs $0x801c89,%rcx
+  800e81:	00 00 00 
+  800e84:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e8b:	eb c1                	jmp    800e4e <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800e8d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e92:	eb ba                	jmp    800e4e <ftruncate+0x5e>
+
+0000000000800e94 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800e94:	55                   	push   %rbp
+  800e95:	48 89 e5             	mov    %rsp,%rbp
+  800e98:	41 54                	push   %r12
+  800e9a:	53                   	push   %rbx
+  800e9b:	48 83 ec 10          	sub    $0x10,%rsp
+  800e9f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ea2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ea6:	48 b8 f4 08 80 00 00 	movabs $0x8008f4,%rax
+  800ead:	00 00 00 
+  800eb0:	ff d0                	call   *%rax
+  800eb2:	85 c0                	test   %eax,%eax
+  800eb4:	78 4e                	js     800f04 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800eb6:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800eba:	41 8b 3c 24          	mov    (%r12),%edi
+  800ebe:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800ec2:	48 b8 3f 09 80 00 00 	movabs $0x80093f,%rax
+  800ec9:	00 00 00 
+  800ecc:	ff d0                	call   *%rax
+  800ece:	85 c0                	test   %eax,%eax
+  800ed0:	78 32                	js     800f04 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800ed2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800ed6:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800edb:	74 30                	je     800f0d <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800edd:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800ee0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800ee7:	00 00 00 
+    stat->st_isdir = 0;
+  800eea:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800ef1:	00 00 00 
+    stat->st_dev = dev;
+  800ef4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800efb:	48 89 de             	mov    %rbx,%rsi
+  800efe:	4c 89 e7             	mov    %r12,%rdi
+  800f01:	ff 50 28             	call   *0x28(%rax)
+}
+  800f04:	48 83 c4 10          	add    $0x10,%rsp
+  800f08:	5b                   	pop    %rbx
+  800f09:	41 5c                	pop    %r12
+  800f0b:	5d                   	pop    %rbp
+  800f0c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800f0d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f12:	eb f0                	jmp    800f04 <fstat+0x70>
+
+0000000000800f14 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800f14:	55                   	push   %rbp
+  800f15:	48 89 e5             	mov    %rsp,%rbp
+  800f18:	41 54                	push   %r12
+  800f1a:	53                   	push   %rbx
+  800f1b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800f1e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f23:	48 b8 95 11 80 00 00 	movabs $0x801195,%rax
+  800f2a:	00 00 00 
+  800f2d:	ff d0                	call   *%rax
+  800f2f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800f31:	85 c0                	test   %eax,%eax
+  800f33:	78 25                	js     800f5a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800f35:	4c 89 e6             	mov    %r12,%rsi
+  800f38:	89 c7                	mov    %eax,%edi
+  800f3a:	48 b8 94 0e 80 00 00 	movabs $0x800e94,%rax
+  800f41:	00 00 00 
+  800f44:	ff d0                	call   *%rax
+  800f46:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800f49:	89 df                	mov    %ebx,%edi
+  800f4b:	48 b8 59 0a 80 00 00 	movabs $0x800a59,%rax
+  800f52:	00 00 00 
+  800f55:	ff d0                	call   *%rax
+
+    return res;
+  800f57:	44 89 e3             	mov    %r12d,%ebx
+}
+  800f5a:	89 d8                	mov    %ebx,%eax
+  800f5c:	5b                   	pop    %rbx
+  800f5d:	41 5c                	pop    %r12
+  800f5f:	5d                   	pop    %rbp
+  800f60:	c3                   	ret
+
+0000000000800f61 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800f61:	55                   	push   %rbp
+  800f62:	48 89 e5             	mov    %rsp,%rbp
+  800f65:	41 54                	push   %r12
+  800f67:	53                   	push   %rbx
+  800f68:	48 83 ec 10          	sub    $0x10,%rsp
+  800f6c:	41 89 fc             	mov    %edi,%r12d
+  800f6f:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f72:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f79:	00 00 00 
+  800f7c:	83 38 00             	cmpl   $0x0,(%rax)
+  800f7f:	74 5e                	je     800fdf <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800f81:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800f87:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800f8c:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800f93:	00 00 00 
+  800f96:	44 89 e6             	mov    %r12d,%esi
+  800f99:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800fa0:	00 00 00 
+  800fa3:	8b 38                	mov    (%rax),%edi
+  800fa5:	48 b8 6a 2a 80 00 00 	movabs $0x802a6a,%rax
+  800fac:	00 00 00 
+  800faf:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800fb1:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800fb8:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800fb9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fbe:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800fc2:	48 89 de             	mov    %rbx,%rsi
+  800fc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fca:	48 b8 d5 29 80 00 00 	movabs $0x8029d5,%rax
+  800fd1:	00 00 00 
+  800fd4:	ff d0                	call   *%rax
+}
+  800fd6:	48 83 c4 10          	add    $0x10,%rsp
+  800fda:	5b                   	pop    %rbx
+  800fdb:	41 5c                	pop    %r12
+  800fdd:	5d                   	pop    %rbp
+  800fde:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800fdf:	bf 03 00 00 00       	mov    $0x3,%edi
+  800fe4:	48 b8 0a 2b 80 00 00 	movabs $0x802b0a,%rax
+  800feb:	00 00 00 
+  800fee:	ff d0                	call   *%rax
+  800ff0:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800ff7:	00 00 
+  800ff9:	eb 86                	jmp    800f81 <fsipc+0x20>
+
+0000000000800ffb <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800ffb:	55                   	push   %rbp
+  800ffc:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800fff:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801006:	00 00 00 
+  801009:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80100c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80100e:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801011:	be 00 00 00 00       	mov    $0x0,%esi
+  801016:	bf 02 00 00 00       	mov    $0x2,%edi
+  80101b:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  801022:	00 00 00 
+  801025:	ff d0                	call   *%rax
+}
+  801027:	5d                   	pop    %rbp
+  801028:	c3                   	ret
+
+0000000000801029 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801029:	55                   	push   %rbp
+  80102a:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80102d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801030:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801037:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801039:	be 00 00 00 00       	mov    $0x0,%esi
+  80103e:	bf 06 00 00 00       	mov    $0x6,%edi
+  801043:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  80104a:	00 00 00 
+  80104d:	ff d0                	call   *%rax
+}
+  80104f:	5d                   	pop    %rbp
+  801050:	c3                   	ret
+
+0000000000801051 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801051:	55                   	push   %rbp
+  801052:	48 89 e5             	mov    %rsp,%rbp
+  801055:	41 54                	push   %r12
+  801057:	53                   	push   %rbx
+  801058:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80105b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80105e:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801065:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801067:	be 00 00 00 00       	mov    $0x0,%esi
+  80106c:	bf 05 00 00 00       	mov    $0x5,%edi
+  801071:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  801078:	00 00 00 
+  80107b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80107d:	85 c0                	test   %eax,%eax
+  80107f:	78 3d                	js     8010be <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801081:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801088:	00 00 00 
+  80108b:	4c 89 e6             	mov    %r12,%rsi
+  80108e:	48 89 df             	mov    %rbx,%rdi
+  801091:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  801098:	00 00 00 
+  80109b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80109d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8010a4:	00 
+  8010a5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8010ab:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8010b2:	00 
+  8010b3:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8010b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010be:	5b                   	pop    %rbx
+  8010bf:	41 5c                	pop    %r12
+  8010c1:	5d                   	pop    %rbp
+  8010c2:	c3                   	ret
+
+00000000008010c3 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8010c3:	55                   	push   %rbp
+  8010c4:	48 89 e5             	mov    %rsp,%rbp
+  8010c7:	41 54                	push   %r12
+  8010c9:	53                   	push   %rbx
+  8010ca:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8010cd:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8010d2:	48 39 c2             	cmp    %rax,%rdx
+  8010d5:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8010d9:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8010dc:	48 89 c2             	mov    %rax,%rdx
+  8010df:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8010e6:	00 00 00 
+  8010e9:	48 b8 0f 28 80 00 00 	movabs $0x80280f,%rax
+  8010f0:	00 00 00 
+  8010f3:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8010f5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8010fc:	00 00 00 
+  8010ff:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  801104:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  801106:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  80110a:	be 00 00 00 00       	mov    $0x0,%esi
+  80110f:	bf 04 00 00 00       	mov    $0x4,%edi
+  801114:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  80111b:	00 00 00 
+  80111e:	ff d0                	call   *%rax
+  801120:	48 98                	cltq
+}
+  801122:	5b                   	pop    %rbx
+  801123:	41 5c                	pop    %r12
+  801125:	5d                   	pop    %rbp
+  801126:	c3                   	ret
+
+0000000000801127 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801127:	55                   	push   %rbp
+  801128:	48 89 e5             	mov    %rsp,%rbp
+  80112b:	41 54                	push   %r12
+  80112d:	53                   	push   %rbx
+  80112e:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801131:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801138:	00 00 00 
+  80113b:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80113e:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  801140:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801145:	48 39 ca             	cmp    %rcx,%rdx
+  801148:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  80114c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  801150:	be 00 00 00 00       	mov    $0x0,%esi
+  801155:	bf 03 00 00 00       	mov    $0x3,%edi
+  80115a:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  801161:	00 00 00 
+  801164:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  801166:	85 c0                	test   %eax,%eax
+  801168:	78 27                	js     801191 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  80116a:	48 63 d8             	movslq %eax,%rbx
+  80116d:	48 89 da             	mov    %rbx,%rdx
+  801170:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801177:	00 00 00 
+  80117a:	4c 89 e7             	mov    %r12,%rdi
+  80117d:	48 b8 0f 28 80 00 00 	movabs $0x80280f,%rax
+  801184:	00 00 00 
+  801187:	ff d0                	call   *%rax
+    return bytes_read;
+  801189:	48 89 d8             	mov    %rbx,%rax
+}
+  80118c:	5b                   	pop    %rbx
+  80118d:	41 5c                	pop    %r12
+  80118f:	5d                   	pop    %rbp
+  801190:	c3                   	ret
+        return bytes_read;
+  801191:	48 98                	cltq
+  801193:	eb f7                	jmp    80118c <devfile_read+0x65>
+
+0000000000801195 <open>:
+open(const char *path, int mode) {
+  801195:	55                   	push   %rbp
+  801196:	48 89 e5             	mov    %rsp,%rbp
+  801199:	41 55                	push   %r13
+  80119b:	41 54                	push   %r12
+  80119d:	53                   	push   %rbx
+  80119e:	48 83 ec 18          	sub    $0x18,%rsp
+  8011a2:	49 89 fc             	mov    %rdi,%r12
+  8011a5:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8011a8:	48 b8 70 25 80 00 00 	movabs $0x802570,%rax
+  8011af:	00 00 00 
+  8011b2:	ff d0                	call   *%rax
+  8011b4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8011ba:	0f 87 8a 00 00 00    	ja     80124a <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8011c0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8011c4:	48 b8 94 08 80 00 00 	movabs $0x800894,%rax
+  8011cb:	00 00 00 
+  8011ce:	ff d0                	call   *%rax
+  8011d0:	89 c3                	mov    %eax,%ebx
+  8011d2:	85 c0                	test   %eax,%eax
+  8011d4:	78 50                	js     801226 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8011d6:	4c 89 e6             	mov    %r12,%rsi
+  8011d9:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8011e0:	00 00 00 
+  8011e3:	48 89 df             	mov    %rbx,%rdi
+  8011e6:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  8011ed:	00 00 00 
+  8011f0:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011f2:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011f9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8011fd:	bf 01 00 00 00       	mov    $0x1,%edi
+  801202:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  801209:	00 00 00 
+  80120c:	ff d0                	call   *%rax
+  80120e:	89 c3                	mov    %eax,%ebx
+  801210:	85 c0                	test   %eax,%eax
+  801212:	78 1f                	js     801233 <open+0x9e>
+    return fd2num(fd);
+  801214:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801218:	48 b8 66 08 80 00 00 	movabs $0x800866,%rax
+  80121f:	00 00 00 
+  801222:	ff d0                	call   *%rax
+  801224:	89 c3                	mov    %eax,%ebx
+}
+  801226:	89 d8                	mov    %ebx,%eax
+  801228:	48 83 c4 18          	add    $0x18,%rsp
+  80122c:	5b                   	pop    %rbx
+  80122d:	41 5c                	pop    %r12
+  80122f:	41 5d                	pop    %r13
+  801231:	5d                   	pop    %rbp
+  801232:	c3                   	ret
+        fd_close(fd, 0);
+  801233:	be 00 00 00 00       	mov    $0x0,%esi
+  801238:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80123c:	48 b8 af 09 80 00 00 	movabs $0x8009af,%rax
+  801243:	00 00 00 
+  801246:	ff d0                	call   *%rax
+        return res;
+  801248:	eb dc                	jmp    801226 <open+0x91>
+        return -E_BAD_PATH;
+  80124a:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80124f:	eb d5                	jmp    801226 <open+0x91>
+
+0000000000801251 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801251:	55                   	push   %rbp
+  801252:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801255:	be 00 00 00 00       	mov    $0x0,%esi
+  80125a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80125f:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  801266:	00 00 00 
+  801269:	ff d0                	call   *%rax
+}
+  80126b:	5d                   	pop    %rbp
+  80126c:	c3                   	ret
+
+000000000080126d <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80126d:	55                   	push   %rbp
+  80126e:	48 89 e5             	mov    %rsp,%rbp
+  801271:	41 54                	push   %r12
+  801273:	53                   	push   %rbx
+  801274:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801277:	48 b8 78 08 80 00 00 	movabs $0x800878,%rax
+  80127e:	00 00 00 
+  801281:	ff d0                	call   *%rax
+  801283:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801286:	48 be 40 2c 80 00 00 	movabs $0x802c40,%rsi
+  80128d:	00 00 00 
+  801290:	48 89 df             	mov    %rbx,%rdi
+  801293:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  80129a:	00 00 00 
+  80129d:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80129f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8012a4:	41 2b 04 24          	sub    (%r12),%eax
+  8012a8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8012ae:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8012b5:	00 00 00 
+    stat->st_dev = &devpipe;
+  8012b8:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8012bf:	00 00 00 
+  8012c2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8012c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ce:	5b                   	pop    %rbx
+  8012cf:	41 5c                	pop    %r12
+  8012d1:	5d                   	pop    %rbp
+  8012d2:	c3                   	ret
+
+00000000008012d3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8012d3:	55                   	push   %rbp
+  8012d4:	48 89 e5             	mov    %rsp,%rbp
+  8012d7:	41 54                	push   %r12
+  8012d9:	53                   	push   %rbx
+  8012da:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8012dd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012e2:	48 89 fe             	mov    %rdi,%rsi
+  8012e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012ea:	49 bc 90 03 80 00 00 	movabs $0x800390,%r12
+  8012f1:	00 00 00 
+  8012f4:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012f7:	48 89 df             	mov    %rbx,%rdi
+  8012fa:	48 b8 78 08 80 00 00 	movabs $0x800878,%rax
+  801301:	00 00 00 
+  801304:	ff d0                	call   *%rax
+  801306:	48 89 c6             	mov    %rax,%rsi
+  801309:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80130e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801313:	41 ff d4             	call   *%r12
+}
+  801316:	5b                   	pop    %rbx
+  801317:	41 5c                	pop    %r12
+  801319:	5d                   	pop    %rbp
+  80131a:	c3                   	ret
+
+000000000080131b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80131b:	55                   	push   %rbp
+  80131c:	48 89 e5             	mov    %rsp,%rbp
+  80131f:	41 57                	push   %r15
+  801321:	41 56                	push   %r14
+  801323:	41 55                	push   %r13
+  801325:	41 54                	push   %r12
+  801327:	53                   	push   %rbx
+  801328:	48 83 ec 18          	sub    $0x18,%rsp
+  80132c:	49 89 fc             	mov    %rdi,%r12
+  80132f:	49 89 f5             	mov    %rsi,%r13
+  801332:	49 89 d7             	mov    %rdx,%r15
+  801335:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801339:	48 b8 78 08 80 00 00 	movabs $0x800878,%rax
+  801340:	00 00 00 
+  801343:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801345:	4d 85 ff             	test   %r15,%r15
+  801348:	0f 84 af 00 00 00    	je     8013fd <devpipe_write+0xe2>
+  80134e:	48 89 c3             	mov    %rax,%rbx
+  801351:	4c 89 f8             	mov    %r15,%rax
+  801354:	4d 89 ef             	mov    %r13,%r15
+  801357:	4c 01 e8             	add    %r13,%rax
+  80135a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80135e:	49 bd 98 02 80 00 00 	movabs $0x800298,%r13
+  801365:	00 00 00 
+            sys_yield();
+  801368:	49 be 35 02 80 00 00 	movabs $0x800235,%r14
+  80136f:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801372:	8b 73 04             	mov    0x4(%rbx),%esi
+  801375:	48 63 ce             	movslq %esi,%rcx
+  801378:	48 63 03             	movslq (%rbx),%rax
+  80137b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801381:	48 39 c1             	cmp    %rax,%rcx
+  801384:	72 2e                	jb     8013b4 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801386:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80138b:	48 89 da             	mov    %rbx,%rdx
+  80138e:	be 00 10 00 00       	mov    $0x1000,%esi
+  801393:	4c 89 e7             	mov    %r12,%rdi
+  801396:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801399:	85 c0                	test   %eax,%eax
+  80139b:	74 66                	je     801403 <devpipe_write+0xe8>
+            sys_yield();
+  80139d:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8013a0:	8b 73 04             	mov    0x4(%rbx),%esi
+  8013a3:	48 63 ce             	movslq %esi,%rcx
+  8013a6:	48 63 03             	movslq (%rbx),%rax
+  8013a9:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8013af:	48 39 c1             	cmp    %rax,%rcx
+  8013b2:	73 d2                	jae    801386 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8013b4:	41 0f b6 3f          	movzbl (%r15),%edi
+  8013b8:	48 89 ca             	mov    %rcx,%rdx
+  8013bb:	48 c1 ea 03          	shr    $0x3,%rdx
+  8013bf:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8013c6:	08 10 20 
+  8013c9:	48 f7 e2             	mul    %rdx
+  8013cc:	48 c1 ea 06          	shr    $0x6,%rdx
+  8013d0:	48 89 d0             	mov    %rdx,%rax
+  8013d3:	48 c1 e0 09          	shl    $0x9,%rax
+  8013d7:	48 29 d0             	sub    %rdx,%rax
+  8013da:	48 c1 e0 03          	shl    $0x3,%rax
+  8013de:	48 29 c1             	sub    %rax,%rcx
+  8013e1:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013e6:	83 c6 01             	add    $0x1,%esi
+  8013e9:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013ec:	49 83 c7 01          	add    $0x1,%r15
+  8013f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013f4:	49 39 c7             	cmp    %rax,%r15
+  8013f7:	0f 85 75 ff ff ff    	jne    801372 <devpipe_write+0x57>
+    return n;
+  8013fd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801401:	eb 05                	jmp    801408 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801403:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801408:	48 83 c4 18          	add    $0x18,%rsp
+  80140c:	5b                   	pop    %rbx
+  80140d:	41 5c                	pop    %r12
+  80140f:	41 5d                	pop    %r13
+  801411:	41 5e                	pop    %r14
+  801413:	41 5f                	pop    %r15
+  801415:	5d                   	pop    %rbp
+  801416:	c3                   	ret
+
+0000000000801417 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801417:	55                   	push   %rbp
+  801418:	48 89 e5             	mov    %rsp,%rbp
+  80141b:	41 57                	push   %r15
+  80141d:	41 56                	push   %r14
+  80141f:	41 55                	push   %r13
+  801421:	41 54                	push   %r12
+  801423:	53                   	push   %rbx
+  801424:	48 83 ec 18          	sub    $0x18,%rsp
+  801428:	49 89 fc             	mov    %rdi,%r12
+  80142b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80142f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801433:	48 b8 78 08 80 00 00 	movabs $0x800878,%rax
+  80143a:	00 00 00 
+  80143d:	ff d0                	call   *%rax
+  80143f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801442:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801448:	49 bd 98 02 80 00 00 	movabs $0x800298,%r13
+  80144f:	00 00 00 
+            sys_yield();
+  801452:	49 be 35 02 80 00 00 	movabs $0x800235,%r14
+  801459:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80145c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801461:	74 7d                	je     8014e0 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801463:	8b 03                	mov    (%rbx),%eax
+  801465:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801468:	75 26                	jne    801490 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80146a:	4d 85 ff             	test   %r15,%r15
+  80146d:	75 77                	jne    8014e6 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80146f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801474:	48 89 da             	mov    %rbx,%rdx
+  801477:	be 00 10 00 00       	mov    $0x1000,%esi
+  80147c:	4c 89 e7             	mov    %r12,%rdi
+  80147f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801482:	85 c0                	test   %eax,%eax
+  801484:	74 72                	je     8014f8 <devpipe_read+0xe1>
+            sys_yield();
+  801486:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801489:	8b 03                	mov    (%rbx),%eax
+  80148b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80148e:	74 df                	je     80146f <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801490:	48 63 c8             	movslq %eax,%rcx
+  801493:	48 89 ca             	mov    %rcx,%rdx
+  801496:	48 c1 ea 03          	shr    $0x3,%rdx
+  80149a:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8014a1:	08 10 20 
+  8014a4:	48 89 d0             	mov    %rdx,%rax
+  8014a7:	48 f7 e6             	mul    %rsi
+  8014aa:	48 c1 ea 06          	shr    $0x6,%rdx
+  8014ae:	48 89 d0             	mov    %rdx,%rax
+  8014b1:	48 c1 e0 09          	shl    $0x9,%rax
+  8014b5:	48 29 d0             	sub    %rdx,%rax
+  8014b8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8014bf:	00 
+  8014c0:	48 89 c8             	mov    %rcx,%rax
+  8014c3:	48 29 d0             	sub    %rdx,%rax
+  8014c6:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8014cb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8014cf:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8014d3:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8014d6:	49 83 c7 01          	add    $0x1,%r15
+  8014da:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8014de:	75 83                	jne    801463 <devpipe_read+0x4c>
+    return n;
+  8014e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014e4:	eb 03                	jmp    8014e9 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014e6:	4c 89 f8             	mov    %r15,%rax
+}
+  8014e9:	48 83 c4 18          	add    $0x18,%rsp
+  8014ed:	5b                   	pop    %rbx
+  8014ee:	41 5c                	pop    %r12
+  8014f0:	41 5d                	pop    %r13
+  8014f2:	41 5e                	pop    %r14
+  8014f4:	41 5f                	pop    %r15
+  8014f6:	5d                   	pop    %rbp
+  8014f7:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014fd:	eb ea                	jmp    8014e9 <devpipe_read+0xd2>
+
+00000000008014ff <pipe>:
+pipe(int pfd[2]) {
+  8014ff:	55                   	push   %rbp
+  801500:	48 89 e5             	mov    %rsp,%rbp
+  801503:	41 55                	push   %r13
+  801505:	41 54                	push   %r12
+  801507:	53                   	push   %rbx
+  801508:	48 83 ec 18          	sub    $0x18,%rsp
+  80150c:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80150f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801513:	48 b8 94 08 80 00 00 	movabs $0x800894,%rax
+  80151a:	00 00 00 
+  80151d:	ff d0                	call   *%rax
+  80151f:	89 c3                	mov    %eax,%ebx
+  801521:	85 c0                	test   %eax,%eax
+  801523:	0f 88 a0 01 00 00    	js     8016c9 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  801529:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80152e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801533:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801537:	bf 00 00 00 00       	mov    $0x0,%edi
+  80153c:	48 b8 c4 02 80 00 00 	movabs $0x8002c4,%rax
+  801543:	00 00 00 
+  801546:	ff d0                	call   *%rax
+  801548:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80154a:	85 c0                	test   %eax,%eax
+  80154c:	0f 88 77 01 00 00    	js     8016c9 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801552:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801556:	48 b8 94 08 80 00 00 	movabs $0x800894,%rax
+  80155d:	00 00 00 
+  801560:	ff d0                	call   *%rax
+  801562:	89 c3                	mov    %eax,%ebx
+  801564:	85 c0                	test   %eax,%eax
+  801566:	0f 88 43 01 00 00    	js     8016af <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80156c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801571:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801576:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80157a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80157f:	48 b8 c4 02 80 00 00 	movabs $0x8002c4,%rax
+  801586:	00 00 00 
+  801589:	ff d0                	call   *%rax
+  80158b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80158d:	85 c0                	test   %eax,%eax
+  80158f:	0f 88 1a 01 00 00    	js     8016af <pipe+0x1b0>
+    va = fd2data(fd0);
+  801595:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801599:	48 b8 78 08 80 00 00 	movabs $0x800878,%rax
+  8015a0:	00 00 00 
+  8015a3:	ff d0                	call   *%rax
+  8015a5:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8015a8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8015ad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8015b2:	48 89 c6             	mov    %rax,%rsi
+  8015b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015ba:	48 b8 c4 02 80 00 00 	movabs $0x8002c4,%rax
+  8015c1:	00 00 00 
+  8015c4:	ff d0                	call   *%rax
+  8015c6:	89 c3                	mov    %eax,%ebx
+  8015c8:	85 c0                	test   %eax,%eax
+  8015ca:	0f 88 c5 00 00 00    	js     801695 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8015d0:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8015d4:	48 b8 78 08 80 00 00 	movabs $0x800878,%rax
+  8015db:	00 00 00 
+  8015de:	ff d0                	call   *%rax
+  8015e0:	48 89 c1             	mov    %rax,%rcx
+  8015e3:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8015e9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8015ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f4:	4c 89 ee             	mov    %r13,%rsi
+  8015f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015fc:	48 b8 2b 03 80 00 00 	movabs $0x80032b,%rax
+  801603:	00 00 00 
+  801606:	ff d0                	call   *%rax
+  801608:	89 c3                	mov    %eax,%ebx
+  80160a:	85 c0                	test   %eax,%eax
+  80160c:	78 6e                	js     80167c <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80160e:	be 00 10 00 00       	mov    $0x1000,%esi
+  801613:	4c 89 ef             	mov    %r13,%rdi
+  801616:	48 b8 66 02 80 00 00 	movabs $0x800266,%rax
+  80161d:	00 00 00 
+  801620:	ff d0                	call   *%rax
+  801622:	83 f8 02             	cmp    $0x2,%eax
+  801625:	0f 85 ab 00 00 00    	jne    8016d6 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80162b:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  801632:	00 00 
+  801634:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801638:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80163a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80163e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801645:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801649:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80164b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80164f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801656:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80165a:	48 bb 66 08 80 00 00 	movabs $0x800866,%rbx
+  801661:	00 00 00 
+  801664:	ff d3                	call   *%rbx
+  801666:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80166a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80166e:	ff d3                	call   *%rbx
+  801670:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  801675:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80167a:	eb 4d                	jmp    8016c9 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80167c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801681:	4c 89 ee             	mov    %r13,%rsi
+  801684:	bf 00 00 00 00       	mov    $0x0,%edi
+  801689:	48 b8 90 03 80 00 00 	movabs $0x800390,%rax
+  801690:	00 00 00 
+  801693:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  801695:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80169a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80169e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016a3:	48 b8 90 03 80 00 00 	movabs $0x800390,%rax
+  8016aa:	00 00 00 
+  8016ad:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8016af:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8016b4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8016b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016bd:	48 b8 90 03 80 00 00 	movabs $0x800390,%rax
+  8016c4:	00 00 00 
+  8016c7:	ff d0                	call   *%rax
+}
+  8016c9:	89 d8                	mov    %ebx,%eax
+  8016cb:	48 83 c4 18          	add    $0x18,%rsp
+  8016cf:	5b                   	pop    %rbx
+  8016d0:	41 5c                	pop    %r12
+  8016d2:	41 5d                	pop    %r13
+  8016d4:	5d                   	pop    %rbp
+  8016d5:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8016d6:	48 b9 70 2c 80 00 00 	movabs $0x802c70,%rcx
+  8016dd:	00 00 00 
+  8016e0:	48 ba 47 2c 80 00 00 	movabs $0x802c47,%rdx
+  8016e7:	00 00 00 
+  8016ea:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8016ef:	48 bf 5c 2c 80 00 00 	movabs $0x802c5c,%rdi
+  8016f6:	00 00 00 
+  8016f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fe:	49 b8 39 1b 80 00 00 	movabs $0x801b39,%r8
+  801705:	00 00 00 
+  801708:	41 ff d0             	call   *%r8
+
+000000000080170b <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80170b:	55                   	push   %rbp
+  80170c:	48 89 e5             	mov    %rsp,%rbp
+  80170f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801713:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801717:	48 b8 f4 08 80 00 00 	movabs $0x8008f4,%rax
+  80171e:	00 00 00 
+  801721:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801723:	85 c0                	test   %eax,%eax
+  801725:	78 35                	js     80175c <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  801727:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80172b:	48 b8 78 08 80 00 00 	movabs $0x800878,%rax
+  801732:	00 00 00 
+  801735:	ff d0                	call   *%rax
+  801737:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80173a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80173f:	be 00 10 00 00       	mov    $0x1000,%esi
+  801744:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801748:	48 b8 98 02 80 00 00 	movabs $0x800298,%rax
+  80174f:	00 00 00 
+  801752:	ff d0                	call   *%rax
+  801754:	85 c0                	test   %eax,%eax
+  801756:	0f 94 c0             	sete   %al
+  801759:	0f b6 c0             	movzbl %al,%eax
+}
+  80175c:	c9                   	leave
+  80175d:	c3                   	ret
+
+000000000080175e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80175e:	48 89 f8             	mov    %rdi,%rax
+  801761:	48 c1 e8 27          	shr    $0x27,%rax
+  801765:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80176c:	01 00 00 
+  80176f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801773:	f6 c2 01             	test   $0x1,%dl
+  801776:	74 6d                	je     8017e5 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801778:	48 89 f8             	mov    %rdi,%rax
+  80177b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80177f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801786:	01 00 00 
+  801789:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80178d:	f6 c2 01             	test   $0x1,%dl
+  801790:	74 62                	je     8017f4 <get_uvpt_entry+0x96>
+  801792:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801799:	01 00 00 
+  80179c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017a0:	f6 c2 80             	test   $0x80,%dl
+  8017a3:	75 4f                	jne    8017f4 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017a5:	48 89 f8             	mov    %rdi,%rax
+  8017a8:	48 c1 e8 15          	shr    $0x15,%rax
+  8017ac:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017b3:	01 00 00 
+  8017b6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017ba:	f6 c2 01             	test   $0x1,%dl
+  8017bd:	74 44                	je     801803 <get_uvpt_entry+0xa5>
+  8017bf:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017c6:	01 00 00 
+  8017c9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017cd:	f6 c2 80             	test   $0x80,%dl
+  8017d0:	75 31                	jne    801803 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8017d2:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8017d6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8017dd:	01 00 00 
+  8017e0:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8017e4:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017e5:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017ec:	01 00 00 
+  8017ef:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017f3:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017f4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017fb:	01 00 00 
+  8017fe:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801802:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801803:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80180a:	01 00 00 
+  80180d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801811:	c3                   	ret
+
+0000000000801812 <get_prot>:
+
+int
+get_prot(void *va) {
+  801812:	55                   	push   %rbp
+  801813:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801816:	48 b8 5e 17 80 00 00 	movabs $0x80175e,%rax
+  80181d:	00 00 00 
+  801820:	ff d0                	call   *%rax
+  801822:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  801825:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80182a:	89 c1                	mov    %eax,%ecx
+  80182c:	83 c9 04             	or     $0x4,%ecx
+  80182f:	f6 c2 01             	test   $0x1,%dl
+  801832:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  801835:	89 c1                	mov    %eax,%ecx
+  801837:	83 c9 02             	or     $0x2,%ecx
+  80183a:	f6 c2 02             	test   $0x2,%dl
+  80183d:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  801840:	89 c1                	mov    %eax,%ecx
+  801842:	83 c9 01             	or     $0x1,%ecx
+  801845:	48 85 d2             	test   %rdx,%rdx
+  801848:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80184b:	89 c1                	mov    %eax,%ecx
+  80184d:	83 c9 40             	or     $0x40,%ecx
+  801850:	f6 c6 04             	test   $0x4,%dh
+  801853:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  801856:	5d                   	pop    %rbp
+  801857:	c3                   	ret
+
+0000000000801858 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  801858:	55                   	push   %rbp
+  801859:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80185c:	48 b8 5e 17 80 00 00 	movabs $0x80175e,%rax
+  801863:	00 00 00 
+  801866:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  801868:	48 c1 e8 06          	shr    $0x6,%rax
+  80186c:	83 e0 01             	and    $0x1,%eax
+}
+  80186f:	5d                   	pop    %rbp
+  801870:	c3                   	ret
+
+0000000000801871 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  801871:	55                   	push   %rbp
+  801872:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  801875:	48 b8 5e 17 80 00 00 	movabs $0x80175e,%rax
+  80187c:	00 00 00 
+  80187f:	ff d0                	call   *%rax
+  801881:	83 e0 01             	and    $0x1,%eax
+}
+  801884:	5d                   	pop    %rbp
+  801885:	c3                   	ret
+
+0000000000801886 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  801886:	55                   	push   %rbp
+  801887:	48 89 e5             	mov    %rsp,%rbp
+  80188a:	41 57                	push   %r15
+  80188c:	41 56                	push   %r14
+  80188e:	41 55                	push   %r13
+  801890:	41 54                	push   %r12
+  801892:	53                   	push   %rbx
+  801893:	48 83 ec 18          	sub    $0x18,%rsp
+  801897:	49 89 ff             	mov    %rdi,%r15
+  80189a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80189e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  8018a3:	49 bc 71 18 80 00 00 	movabs $0x801871,%r12
+  8018aa:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  8018ad:	49 be 12 18 80 00 00 	movabs $0x801812,%r14
+  8018b4:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8018b7:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  8018be:	00 00 00 
+  8018c1:	eb 0c                	jmp    8018cf <foreach_shared_region+0x49>
+  8018c3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018ca:	4c 39 eb             	cmp    %r13,%rbx
+  8018cd:	74 38                	je     801907 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  8018cf:	48 89 df             	mov    %rbx,%rdi
+  8018d2:	41 ff d4             	call   *%r12
+  8018d5:	84 c0                	test   %al,%al
+  8018d7:	74 ea                	je     8018c3 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  8018d9:	48 89 df             	mov    %rbx,%rdi
+  8018dc:	41 ff d6             	call   *%r14
+  8018df:	a8 40                	test   $0x40,%al
+  8018e1:	74 e0                	je     8018c3 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8018e3:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8018ea:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8018ee:	48 89 df             	mov    %rbx,%rdi
+  8018f1:	41 ff d7             	call   *%r15
+        if (err)
+  8018f4:	85 c0                	test   %eax,%eax
+  8018f6:	74 cb                	je     8018c3 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8018f8:	48 83 c4 18          	add    $0x18,%rsp
+  8018fc:	5b                   	pop    %rbx
+  8018fd:	41 5c                	pop    %r12
+  8018ff:	41 5d                	pop    %r13
+  801901:	41 5e                	pop    %r14
+  801903:	41 5f                	pop    %r15
+  801905:	5d                   	pop    %rbp
+  801906:	c3                   	ret
+    return 0;
+  801907:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190c:	eb ea                	jmp    8018f8 <foreach_shared_region+0x72>
+
+000000000080190e <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80190e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801913:	c3                   	ret
+
+0000000000801914 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  801914:	55                   	push   %rbp
+  801915:	48 89 e5             	mov    %rsp,%rbp
+  801918:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80191b:	48 be 94 2c 80 00 00 	movabs $0x802c94,%rsi
+  801922:	00 00 00 
+  801925:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  80192c:	00 00 00 
+  80192f:	ff d0                	call   *%rax
+    return 0;
+}
+  801931:	b8 00 00 00 00       	mov    $0x0,%eax
+  801936:	5d                   	pop    %rbp
+  801937:	c3                   	ret
+
+0000000000801938 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801938:	55                   	push   %rbp
+  801939:	48 89 e5             	mov    %rsp,%rbp
+  80193c:	41 57                	push   %r15
+  80193e:	41 56                	push   %r14
+  801940:	41 55                	push   %r13
+  801942:	41 54                	push   %r12
+  801944:	53                   	push   %rbx
+  801945:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80194c:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801953:	48 85 d2             	test   %rdx,%rdx
+  801956:	74 7a                	je     8019d2 <devcons_write+0x9a>
+  801958:	49 89 d6             	mov    %rdx,%r14
+  80195b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801961:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801966:	49 bf a8 27 80 00 00 	movabs $0x8027a8,%r15
+  80196d:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801970:	4c 89 f3             	mov    %r14,%rbx
+  801973:	48 29 f3             	sub    %rsi,%rbx
+  801976:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80197b:	48 39 c3             	cmp    %rax,%rbx
+  80197e:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801982:	4c 63 eb             	movslq %ebx,%r13
+  801985:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80198c:	48 01 c6             	add    %rax,%rsi
+  80198f:	4c 89 ea             	mov    %r13,%rdx
+  801992:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801999:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80199c:	4c 89 ee             	mov    %r13,%rsi
+  80199f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8019a6:	48 b8 3b 01 80 00 00 	movabs $0x80013b,%rax
+  8019ad:	00 00 00 
+  8019b0:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8019b2:	41 01 dc             	add    %ebx,%r12d
+  8019b5:	49 63 f4             	movslq %r12d,%rsi
+  8019b8:	4c 39 f6             	cmp    %r14,%rsi
+  8019bb:	72 b3                	jb     801970 <devcons_write+0x38>
+    return res;
+  8019bd:	49 63 c4             	movslq %r12d,%rax
+}
+  8019c0:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8019c7:	5b                   	pop    %rbx
+  8019c8:	41 5c                	pop    %r12
+  8019ca:	41 5d                	pop    %r13
+  8019cc:	41 5e                	pop    %r14
+  8019ce:	41 5f                	pop    %r15
+  8019d0:	5d                   	pop    %rbp
+  8019d1:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8019d2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8019d8:	eb e3                	jmp    8019bd <devcons_write+0x85>
+
+00000000008019da <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8019da:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8019dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e2:	48 85 c0             	test   %rax,%rax
+  8019e5:	74 55                	je     801a3c <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8019e7:	55                   	push   %rbp
+  8019e8:	48 89 e5             	mov    %rsp,%rbp
+  8019eb:	41 55                	push   %r13
+  8019ed:	41 54                	push   %r12
+  8019ef:	53                   	push   %rbx
+  8019f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8019f4:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8019f7:	48 bb 68 01 80 00 00 	movabs $0x800168,%rbx
+  8019fe:	00 00 00 
+  801a01:	49 bc 35 02 80 00 00 	movabs $0x800235,%r12
+  801a08:	00 00 00 
+  801a0b:	eb 03                	jmp    801a10 <devcons_read+0x36>
+  801a0d:	41 ff d4             	call   *%r12
+  801a10:	ff d3                	call   *%rbx
+  801a12:	85 c0                	test   %eax,%eax
+  801a14:	74 f7                	je     801a0d <devcons_read+0x33>
+    if (c < 0) return c;
+  801a16:	48 63 d0             	movslq %eax,%rdx
+  801a19:	78 13                	js     801a2e <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  801a1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a20:	83 f8 04             	cmp    $0x4,%eax
+  801a23:	74 09                	je     801a2e <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801a25:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801a29:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801a2e:	48 89 d0             	mov    %rdx,%rax
+  801a31:	48 83 c4 08          	add    $0x8,%rsp
+  801a35:	5b                   	pop    %rbx
+  801a36:	41 5c                	pop    %r12
+  801a38:	41 5d                	pop    %r13
+  801a3a:	5d                   	pop    %rbp
+  801a3b:	c3                   	ret
+  801a3c:	48 89 d0             	mov    %rdx,%rax
+  801a3f:	c3                   	ret
+
+0000000000801a40 <cputchar>:
+cputchar(int ch) {
+  801a40:	55                   	push   %rbp
+  801a41:	48 89 e5             	mov    %rsp,%rbp
+  801a44:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801a48:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801a4c:	be 01 00 00 00       	mov    $0x1,%esi
+  801a51:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801a55:	48 b8 3b 01 80 00 00 	movabs $0x80013b,%rax
+  801a5c:	00 00 00 
+  801a5f:	ff d0                	call   *%rax
+}
+  801a61:	c9                   	leave
+  801a62:	c3                   	ret
+
+0000000000801a63 <getchar>:
+getchar(void) {
+  801a63:	55                   	push   %rbp
+  801a64:	48 89 e5             	mov    %rsp,%rbp
+  801a67:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801a6b:	ba 01 00 00 00       	mov    $0x1,%edx
+  801a70:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801a74:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a79:	48 b8 d7 0b 80 00 00 	movabs $0x800bd7,%rax
+  801a80:	00 00 00 
+  801a83:	ff d0                	call   *%rax
+  801a85:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801a87:	85 c0                	test   %eax,%eax
+  801a89:	78 06                	js     801a91 <getchar+0x2e>
+  801a8b:	74 08                	je     801a95 <getchar+0x32>
+  801a8d:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801a91:	89 d0                	mov    %edx,%eax
+  801a93:	c9                   	leave
+  801a94:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801a95:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801a9a:	eb f5                	jmp    801a91 <getchar+0x2e>
+
+0000000000801a9c <iscons>:
+iscons(int fdnum) {
+  801a9c:	55                   	push   %rbp
+  801a9d:	48 89 e5             	mov    %rsp,%rbp
+  801aa0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801aa4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801aa8:	48 b8 f4 08 80 00 00 	movabs $0x8008f4,%rax
+  801aaf:	00 00 00 
+  801ab2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ab4:	85 c0                	test   %eax,%eax
+  801ab6:	78 18                	js     801ad0 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801ab8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801abc:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801ac3:	00 00 00 
+  801ac6:	8b 00                	mov    (%rax),%eax
+  801ac8:	39 02                	cmp    %eax,(%rdx)
+  801aca:	0f 94 c0             	sete   %al
+  801acd:	0f b6 c0             	movzbl %al,%eax
+}
+  801ad0:	c9                   	leave
+  801ad1:	c3                   	ret
+
+0000000000801ad2 <opencons>:
+opencons(void) {
+  801ad2:	55                   	push   %rbp
+  801ad3:	48 89 e5             	mov    %rsp,%rbp
+  801ad6:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801ada:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801ade:	48 b8 94 08 80 00 00 	movabs $0x800894,%rax
+  801ae5:	00 00 00 
+  801ae8:	ff d0                	call   *%rax
+  801aea:	85 c0                	test   %eax,%eax
+  801aec:	78 49                	js     801b37 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801aee:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801af3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801af8:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801afc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b01:	48 b8 c4 02 80 00 00 	movabs $0x8002c4,%rax
+  801b08:	00 00 00 
+  801b0b:	ff d0                	call   *%rax
+  801b0d:	85 c0                	test   %eax,%eax
+  801b0f:	78 26                	js     801b37 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801b11:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b15:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801b1c:	00 00 
+  801b1e:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801b20:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b24:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801b2b:	48 b8 66 08 80 00 00 	movabs $0x800866,%rax
+  801b32:	00 00 00 
+  801b35:	ff d0                	call   *%rax
+}
+  801b37:	c9                   	leave
+  801b38:	c3                   	ret
+
+0000000000801b39 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801b39:	55                   	push   %rbp
+  801b3a:	48 89 e5             	mov    %rsp,%rbp
+  801b3d:	41 56                	push   %r14
+  801b3f:	41 55                	push   %r13
+  801b41:	41 54                	push   %r12
+  801b43:	53                   	push   %rbx
+  801b44:	48 83 ec 50          	sub    $0x50,%rsp
+  801b48:	49 89 fc             	mov    %rdi,%r12
+  801b4b:	41 89 f5             	mov    %esi,%r13d
+  801b4e:	48 89 d3             	mov    %rdx,%rbx
+  801b51:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b55:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801b59:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801b5d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801b64:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b68:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801b6c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801b70:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801b74:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801b7b:	00 00 00 
+  801b7e:	4c 8b 30             	mov    (%rax),%r14
+  801b81:	48 b8 04 02 80 00 00 	movabs $0x800204,%rax
+  801b88:	00 00 00 
+  801b8b:	ff d0                	call   *%rax
+  801b8d:	89 c6                	mov    %eax,%esi
+  801b8f:	45 89 e8             	mov    %r13d,%r8d
+  801b92:	4c 89 e1             	mov    %r12,%rcx
+  801b95:	4c 89 f2             	mov    %r14,%rdx
+  801b98:	48 bf a0 2c 80 00 00 	movabs $0x802ca0,%rdi
+  801b9f:	00 00 00 
+  801ba2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba7:	49 bc 89 1c 80 00 00 	movabs $0x801c89,%r12
+  801bae:	00 00 00 
+  801bb1:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801bb4:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801bb8:	48 89 df             	mov    %rbx,%rdi
+  801bbb:	48 b8 25 1c 80 00 00 	movabs $0x801c25,%rax
+  801bc2:	00 00 00 
+  801bc5:	ff d0                	call   *%rax
+    cprintf("\n");
+  801bc7:	48 bf fb 2b 80 00 00 	movabs $0x802bfb,%rdi
+  801bce:	00 00 00 
+  801bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd6:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801bd9:	cc                   	int3
+  801bda:	eb fd                	jmp    801bd9 <_panic+0xa0>
+
+0000000000801bdc <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801bdc:	55                   	push   %rbp
+  801bdd:	48 89 e5             	mov    %rsp,%rbp
+  801be0:	53                   	push   %rbx
+  801be1:	48 83 ec 08          	sub    $0x8,%rsp
+  801be5:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801be8:	8b 06                	mov    (%rsi),%eax
+  801bea:	8d 50 01             	lea    0x1(%rax),%edx
+  801bed:	89 16                	mov    %edx,(%rsi)
+  801bef:	48 98                	cltq
+  801bf1:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801bf6:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801bfc:	74 0a                	je     801c08 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801bfe:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801c02:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c06:	c9                   	leave
+  801c07:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801c08:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801c0c:	be ff 00 00 00       	mov    $0xff,%esi
+  801c11:	48 b8 3b 01 80 00 00 	movabs $0x80013b,%rax
+  801c18:	00 00 00 
+  801c1b:	ff d0                	call   *%rax
+        state->offset = 0;
+  801c1d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801c23:	eb d9                	jmp    801bfe <putch+0x22>
+
+0000000000801c25 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801c25:	55                   	push   %rbp
+  801c26:	48 89 e5             	mov    %rsp,%rbp
+  801c29:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801c30:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801c33:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801c3a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c44:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801c47:	48 89 f1             	mov    %rsi,%rcx
+  801c4a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801c51:	48 bf dc 1b 80 00 00 	movabs $0x801bdc,%rdi
+  801c58:	00 00 00 
+  801c5b:	48 b8 d9 1d 80 00 00 	movabs $0x801dd9,%rax
+  801c62:	00 00 00 
+  801c65:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801c67:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801c6e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801c75:	48 b8 3b 01 80 00 00 	movabs $0x80013b,%rax
+  801c7c:	00 00 00 
+  801c7f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801c81:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801c87:	c9                   	leave
+  801c88:	c3                   	ret
+
+0000000000801c89 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801c89:	55                   	push   %rbp
+  801c8a:	48 89 e5             	mov    %rsp,%rbp
+  801c8d:	48 83 ec 50          	sub    $0x50,%rsp
+  801c91:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801c95:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801c99:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c9d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801ca1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801ca5:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801cac:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801cb0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cb4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801cb8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801cbc:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801cc0:	48 b8 25 1c 80 00 00 	movabs $0x801c25,%rax
+  801cc7:	00 00 00 
+  801cca:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801ccc:	c9                   	leave
+  801ccd:	c3                   	ret
+
+0000000000801cce <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801cce:	55                   	push   %rbp
+  801ccf:	48 89 e5             	mov    %rsp,%rbp
+  801cd2:	41 57                	push   %r15
+  801cd4:	41 56                	push   %r14
+  801cd6:	41 55                	push   %r13
+  801cd8:	41 54                	push   %r12
+  801cda:	53                   	push   %rbx
+  801cdb:	48 83 ec 18          	sub    $0x18,%rsp
+  801cdf:	49 89 fc             	mov    %rdi,%r12
+  801ce2:	49 89 f5             	mov    %rsi,%r13
+  801ce5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ce9:	8b 45 10             	mov    0x10(%rbp),%eax
+  801cec:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801cef:	41 89 cf             	mov    %ecx,%r15d
+  801cf2:	4c 39 fa             	cmp    %r15,%rdx
+  801cf5:	73 5b                	jae    801d52 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801cf7:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801cfb:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801cff:	85 db                	test   %ebx,%ebx
+  801d01:	7e 0e                	jle    801d11 <print_num+0x43>
+            putch(padc, put_arg);
+  801d03:	4c 89 ee             	mov    %r13,%rsi
+  801d06:	44 89 f7             	mov    %r14d,%edi
+  801d09:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801d0c:	83 eb 01             	sub    $0x1,%ebx
+  801d0f:	75 f2                	jne    801d03 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801d11:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801d15:	48 b9 d4 2c 80 00 00 	movabs $0x802cd4,%rcx
+  801d1c:	00 00 00 
+  801d1f:	48 b8 c3 2c 80 00 00 	movabs $0x802cc3,%rax
+  801d26:	00 00 00 
+  801d29:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801d2d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d31:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d36:	49 f7 f7             	div    %r15
+  801d39:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801d3d:	4c 89 ee             	mov    %r13,%rsi
+  801d40:	41 ff d4             	call   *%r12
+}
+  801d43:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801d47:	5b                   	pop    %rbx
+  801d48:	41 5c                	pop    %r12
+  801d4a:	41 5d                	pop    %r13
+  801d4c:	41 5e                	pop    %r14
+  801d4e:	41 5f                	pop    %r15
+  801d50:	5d                   	pop    %rbp
+  801d51:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801d52:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d56:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d5b:	49 f7 f7             	div    %r15
+  801d5e:	48 83 ec 08          	sub    $0x8,%rsp
+  801d62:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801d66:	52                   	push   %rdx
+  801d67:	45 0f be c9          	movsbl %r9b,%r9d
+  801d6b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801d6f:	48 89 c2             	mov    %rax,%rdx
+  801d72:	48 b8 ce 1c 80 00 00 	movabs $0x801cce,%rax
+  801d79:	00 00 00 
+  801d7c:	ff d0                	call   *%rax
+  801d7e:	48 83 c4 10          	add    $0x10,%rsp
+  801d82:	eb 8d                	jmp    801d11 <print_num+0x43>
+
+0000000000801d84 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801d84:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801d88:	48 8b 06             	mov    (%rsi),%rax
+  801d8b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801d8f:	73 0a                	jae    801d9b <sprintputch+0x17>
+        *state->start++ = ch;
+  801d91:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d95:	48 89 16             	mov    %rdx,(%rsi)
+  801d98:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801d9b:	c3                   	ret
+
+0000000000801d9c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801d9c:	55                   	push   %rbp
+  801d9d:	48 89 e5             	mov    %rsp,%rbp
+  801da0:	48 83 ec 50          	sub    $0x50,%rsp
+  801da4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801da8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801dac:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801db0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801db7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801dbb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dbf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801dc3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801dc7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801dcb:	48 b8 d9 1d 80 00 00 	movabs $0x801dd9,%rax
+  801dd2:	00 00 00 
+  801dd5:	ff d0                	call   *%rax
+}
+  801dd7:	c9                   	leave
+  801dd8:	c3                   	ret
+
+0000000000801dd9 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801dd9:	55                   	push   %rbp
+  801dda:	48 89 e5             	mov    %rsp,%rbp
+  801ddd:	41 57                	push   %r15
+  801ddf:	41 56                	push   %r14
+  801de1:	41 55                	push   %r13
+  801de3:	41 54                	push   %r12
+  801de5:	53                   	push   %rbx
+  801de6:	48 83 ec 38          	sub    $0x38,%rsp
+  801dea:	49 89 fe             	mov    %rdi,%r14
+  801ded:	49 89 f5             	mov    %rsi,%r13
+  801df0:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801df3:	48 8b 01             	mov    (%rcx),%rax
+  801df6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801dfa:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801dfe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e02:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801e06:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801e0a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801e0e:	0f b6 3b             	movzbl (%rbx),%edi
+  801e11:	40 80 ff 25          	cmp    $0x25,%dil
+  801e15:	74 18                	je     801e2f <vprintfmt+0x56>
+            if (!ch) return;
+  801e17:	40 84 ff             	test   %dil,%dil
+  801e1a:	0f 84 b1 06 00 00    	je     8024d1 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801e20:	40 0f b6 ff          	movzbl %dil,%edi
+  801e24:	4c 89 ee             	mov    %r13,%rsi
+  801e27:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801e2a:	4c 89 e3             	mov    %r12,%rbx
+  801e2d:	eb db                	jmp    801e0a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801e2f:	be 00 00 00 00       	mov    $0x0,%esi
+  801e34:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801e38:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801e3d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e43:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801e4a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e4e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801e53:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801e58:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801e5b:	83 e8 23             	sub    $0x23,%eax
+  801e5e:	3c 57                	cmp    $0x57,%al
+  801e60:	0f 87 51 06 00 00    	ja     8024b7 <vprintfmt+0x6de>
+  801e66:	0f b6 c0             	movzbl %al,%eax
+  801e69:	48 b9 80 2e 80 00 00 	movabs $0x802e80,%rcx
+  801e70:	00 00 00 
+  801e73:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801e76:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801e79:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801e7d:	eb cf                	jmp    801e4e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801e7f:	49 89 dc             	mov    %rbx,%r12
+  801e82:	be 01 00 00 00       	mov    $0x1,%esi
+  801e87:	eb c5                	jmp    801e4e <vprintfmt+0x75>
+            padc = ch;
+  801e89:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801e8d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e90:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801e93:	eb b9                	jmp    801e4e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e95:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e98:	83 f8 2f             	cmp    $0x2f,%eax
+  801e9b:	77 24                	ja     801ec1 <vprintfmt+0xe8>
+  801e9d:	89 c1                	mov    %eax,%ecx
+  801e9f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801ea3:	83 c0 08             	add    $0x8,%eax
+  801ea6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ea9:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801eac:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801eaf:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801eb3:	79 99                	jns    801e4e <vprintfmt+0x75>
+                width = precision;
+  801eb5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801eb9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801ebf:	eb 8d                	jmp    801e4e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801ec1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801ec5:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801ec9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ecd:	eb da                	jmp    801ea9 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801ecf:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801ed4:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801ed8:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801ede:	3c 39                	cmp    $0x39,%al
+  801ee0:	77 1c                	ja     801efe <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801ee2:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801ee6:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801eea:	0f b6 c0             	movzbl %al,%eax
+  801eed:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801ef2:	0f b6 03             	movzbl (%rbx),%eax
+  801ef5:	3c 39                	cmp    $0x39,%al
+  801ef7:	76 e9                	jbe    801ee2 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801ef9:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801efc:	eb b1                	jmp    801eaf <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801efe:	49 89 dc             	mov    %rbx,%r12
+  801f01:	eb ac                	jmp    801eaf <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801f03:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801f06:	85 c9                	test   %ecx,%ecx
+  801f08:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f0d:	0f 49 c1             	cmovns %ecx,%eax
+  801f10:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801f13:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f16:	e9 33 ff ff ff       	jmp    801e4e <vprintfmt+0x75>
+            lflag++;
+  801f1b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801f1e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f21:	e9 28 ff ff ff       	jmp    801e4e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801f26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f29:	83 f8 2f             	cmp    $0x2f,%eax
+  801f2c:	77 19                	ja     801f47 <vprintfmt+0x16e>
+  801f2e:	89 c2                	mov    %eax,%edx
+  801f30:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f34:	83 c0 08             	add    $0x8,%eax
+  801f37:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f3a:	8b 3a                	mov    (%rdx),%edi
+  801f3c:	4c 89 ee             	mov    %r13,%rsi
+  801f3f:	41 ff d6             	call   *%r14
+            break;
+  801f42:	e9 c3 fe ff ff       	jmp    801e0a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  801f47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f53:	eb e5                	jmp    801f3a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  801f55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f58:	83 f8 2f             	cmp    $0x2f,%eax
+  801f5b:	77 5a                	ja     801fb7 <vprintfmt+0x1de>
+  801f5d:	89 c2                	mov    %eax,%edx
+  801f5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f63:	83 c0 08             	add    $0x8,%eax
+  801f66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801f69:	8b 02                	mov    (%rdx),%eax
+  801f6b:	89 c1                	mov    %eax,%ecx
+  801f6d:	f7 d9                	neg    %ecx
+  801f6f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801f72:	83 f9 15             	cmp    $0x15,%ecx
+  801f75:	7f 4e                	jg     801fc5 <vprintfmt+0x1ec>
+  801f77:	48 63 c1             	movslq %ecx,%rax
+  801f7a:	48 ba 40 31 80 00 00 	movabs $0x803140,%rdx
+  801f81:	00 00 00 
+  801f84:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801f88:	48 85 c0             	test   %rax,%rax
+  801f8b:	74 38                	je     801fc5 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801f8d:	48 89 c1             	mov    %rax,%rcx
+  801f90:	48 ba 59 2c 80 00 00 	movabs $0x802c59,%rdx
+  801f97:	00 00 00 
+  801f9a:	4c 89 ee             	mov    %r13,%rsi
+  801f9d:	4c 89 f7             	mov    %r14,%rdi
+  801fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa5:	49 b8 9c 1d 80 00 00 	movabs $0x801d9c,%r8
+  801fac:	00 00 00 
+  801faf:	41 ff d0             	call   *%r8
+  801fb2:	e9 53 fe ff ff       	jmp    801e0a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801fb7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fbb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fbf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fc3:	eb a4                	jmp    801f69 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801fc5:	48 ba ec 2c 80 00 00 	movabs $0x802cec,%rdx
+  801fcc:	00 00 00 
+  801fcf:	4c 89 ee             	mov    %r13,%rsi
+  801fd2:	4c 89 f7             	mov    %r14,%rdi
+  801fd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fda:	49 b8 9c 1d 80 00 00 	movabs $0x801d9c,%r8
+  801fe1:	00 00 00 
+  801fe4:	41 ff d0             	call   *%r8
+  801fe7:	e9 1e fe ff ff       	jmp    801e0a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801fec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fef:	83 f8 2f             	cmp    $0x2f,%eax
+  801ff2:	77 6c                	ja     802060 <vprintfmt+0x287>
+  801ff4:	89 c2                	mov    %eax,%edx
+  801ff6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ffa:	83 c0 08             	add    $0x8,%eax
+  801ffd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802000:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  802003:	48 85 d2             	test   %rdx,%rdx
+  802006:	48 b8 e5 2c 80 00 00 	movabs $0x802ce5,%rax
+  80200d:	00 00 00 
+  802010:	48 0f 45 c2          	cmovne %rdx,%rax
+  802014:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  802018:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80201c:	7e 06                	jle    802024 <vprintfmt+0x24b>
+  80201e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802022:	75 4a                	jne    80206e <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802024:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802028:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80202c:	0f b6 00             	movzbl (%rax),%eax
+  80202f:	84 c0                	test   %al,%al
+  802031:	0f 85 9a 00 00 00    	jne    8020d1 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  802037:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80203a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80203e:	85 c0                	test   %eax,%eax
+  802040:	0f 8e c4 fd ff ff    	jle    801e0a <vprintfmt+0x31>
+  802046:	4c 89 ee             	mov    %r13,%rsi
+  802049:	bf 20 00 00 00       	mov    $0x20,%edi
+  80204e:	41 ff d6             	call   *%r14
+  802051:	41 83 ec 01          	sub    $0x1,%r12d
+  802055:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802059:	75 eb                	jne    802046 <vprintfmt+0x26d>
+  80205b:	e9 aa fd ff ff       	jmp    801e0a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802060:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802064:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802068:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80206c:	eb 92                	jmp    802000 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80206e:	49 63 f7             	movslq %r15d,%rsi
+  802071:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802075:	48 b8 8b 25 80 00 00 	movabs $0x80258b,%rax
+  80207c:	00 00 00 
+  80207f:	ff d0                	call   *%rax
+  802081:	48 89 c2             	mov    %rax,%rdx
+  802084:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802087:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802089:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80208c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80208f:	85 c0                	test   %eax,%eax
+  802091:	7e 91                	jle    802024 <vprintfmt+0x24b>
+  802093:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802098:	4c 89 ee             	mov    %r13,%rsi
+  80209b:	44 89 e7             	mov    %r12d,%edi
+  80209e:	41 ff d6             	call   *%r14
+  8020a1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8020a5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8020a8:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8020ab:	75 eb                	jne    802098 <vprintfmt+0x2bf>
+  8020ad:	e9 72 ff ff ff       	jmp    802024 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8020b2:	0f b6 f8             	movzbl %al,%edi
+  8020b5:	4c 89 ee             	mov    %r13,%rsi
+  8020b8:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8020bb:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8020bf:	49 83 c4 01          	add    $0x1,%r12
+  8020c3:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8020c9:	84 c0                	test   %al,%al
+  8020cb:	0f 84 66 ff ff ff    	je     802037 <vprintfmt+0x25e>
+  8020d1:	45 85 ff             	test   %r15d,%r15d
+  8020d4:	78 0a                	js     8020e0 <vprintfmt+0x307>
+  8020d6:	41 83 ef 01          	sub    $0x1,%r15d
+  8020da:	0f 88 57 ff ff ff    	js     802037 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8020e0:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8020e4:	74 cc                	je     8020b2 <vprintfmt+0x2d9>
+  8020e6:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8020e9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8020ee:	80 fa 5e             	cmp    $0x5e,%dl
+  8020f1:	77 c2                	ja     8020b5 <vprintfmt+0x2dc>
+  8020f3:	eb bd                	jmp    8020b2 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8020f5:	40 84 f6             	test   %sil,%sil
+  8020f8:	75 26                	jne    802120 <vprintfmt+0x347>
+    switch (lflag) {
+  8020fa:	85 d2                	test   %edx,%edx
+  8020fc:	74 59                	je     802157 <vprintfmt+0x37e>
+  8020fe:	83 fa 01             	cmp    $0x1,%edx
+  802101:	74 7b                	je     80217e <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802103:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802106:	83 f8 2f             	cmp    $0x2f,%eax
+  802109:	0f 87 96 00 00 00    	ja     8021a5 <vprintfmt+0x3cc>
+  80210f:	89 c2                	mov    %eax,%edx
+  802111:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802115:	83 c0 08             	add    $0x8,%eax
+  802118:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80211b:	4c 8b 22             	mov    (%rdx),%r12
+  80211e:	eb 17                	jmp    802137 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802120:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802123:	83 f8 2f             	cmp    $0x2f,%eax
+  802126:	77 21                	ja     802149 <vprintfmt+0x370>
+  802128:	89 c2                	mov    %eax,%edx
+  80212a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80212e:	83 c0 08             	add    $0x8,%eax
+  802131:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802134:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802137:	4d 85 e4             	test   %r12,%r12
+  80213a:	78 7a                	js     8021b6 <vprintfmt+0x3dd>
+            num = i;
+  80213c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80213f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802144:	e9 50 02 00 00       	jmp    802399 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802149:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80214d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802151:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802155:	eb dd                	jmp    802134 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802157:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80215a:	83 f8 2f             	cmp    $0x2f,%eax
+  80215d:	77 11                	ja     802170 <vprintfmt+0x397>
+  80215f:	89 c2                	mov    %eax,%edx
+  802161:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802165:	83 c0 08             	add    $0x8,%eax
+  802168:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80216b:	4c 63 22             	movslq (%rdx),%r12
+  80216e:	eb c7                	jmp    802137 <vprintfmt+0x35e>
+  802170:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802174:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802178:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80217c:	eb ed                	jmp    80216b <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80217e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802181:	83 f8 2f             	cmp    $0x2f,%eax
+  802184:	77 11                	ja     802197 <vprintfmt+0x3be>
+  802186:	89 c2                	mov    %eax,%edx
+  802188:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80218c:	83 c0 08             	add    $0x8,%eax
+  80218f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802192:	4c 8b 22             	mov    (%rdx),%r12
+  802195:	eb a0                	jmp    802137 <vprintfmt+0x35e>
+  802197:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80219b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80219f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021a3:	eb ed                	jmp    802192 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8021a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021b1:	e9 65 ff ff ff       	jmp    80211b <vprintfmt+0x342>
+                putch('-', put_arg);
+  8021b6:	4c 89 ee             	mov    %r13,%rsi
+  8021b9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8021be:	41 ff d6             	call   *%r14
+                i = -i;
+  8021c1:	49 f7 dc             	neg    %r12
+  8021c4:	e9 73 ff ff ff       	jmp    80213c <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8021c9:	40 84 f6             	test   %sil,%sil
+  8021cc:	75 32                	jne    802200 <vprintfmt+0x427>
+    switch (lflag) {
+  8021ce:	85 d2                	test   %edx,%edx
+  8021d0:	74 5d                	je     80222f <vprintfmt+0x456>
+  8021d2:	83 fa 01             	cmp    $0x1,%edx
+  8021d5:	0f 84 82 00 00 00    	je     80225d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8021db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021de:	83 f8 2f             	cmp    $0x2f,%eax
+  8021e1:	0f 87 a5 00 00 00    	ja     80228c <vprintfmt+0x4b3>
+  8021e7:	89 c2                	mov    %eax,%edx
+  8021e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021ed:	83 c0 08             	add    $0x8,%eax
+  8021f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021f3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8021fb:	e9 99 01 00 00       	jmp    802399 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802200:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802203:	83 f8 2f             	cmp    $0x2f,%eax
+  802206:	77 19                	ja     802221 <vprintfmt+0x448>
+  802208:	89 c2                	mov    %eax,%edx
+  80220a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80220e:	83 c0 08             	add    $0x8,%eax
+  802211:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802214:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802217:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80221c:	e9 78 01 00 00       	jmp    802399 <vprintfmt+0x5c0>
+  802221:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802225:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802229:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80222d:	eb e5                	jmp    802214 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80222f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802232:	83 f8 2f             	cmp    $0x2f,%eax
+  802235:	77 18                	ja     80224f <vprintfmt+0x476>
+  802237:	89 c2                	mov    %eax,%edx
+  802239:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80223d:	83 c0 08             	add    $0x8,%eax
+  802240:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802243:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802245:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80224a:	e9 4a 01 00 00       	jmp    802399 <vprintfmt+0x5c0>
+  80224f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802253:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802257:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80225b:	eb e6                	jmp    802243 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80225d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802260:	83 f8 2f             	cmp    $0x2f,%eax
+  802263:	77 19                	ja     80227e <vprintfmt+0x4a5>
+  802265:	89 c2                	mov    %eax,%edx
+  802267:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80226b:	83 c0 08             	add    $0x8,%eax
+  80226e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802271:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802274:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802279:	e9 1b 01 00 00       	jmp    802399 <vprintfmt+0x5c0>
+  80227e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802282:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802286:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80228a:	eb e5                	jmp    802271 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80228c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802290:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802294:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802298:	e9 56 ff ff ff       	jmp    8021f3 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80229d:	40 84 f6             	test   %sil,%sil
+  8022a0:	75 2e                	jne    8022d0 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8022a2:	85 d2                	test   %edx,%edx
+  8022a4:	74 59                	je     8022ff <vprintfmt+0x526>
+  8022a6:	83 fa 01             	cmp    $0x1,%edx
+  8022a9:	74 7f                	je     80232a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8022ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8022b1:	0f 87 9f 00 00 00    	ja     802356 <vprintfmt+0x57d>
+  8022b7:	89 c2                	mov    %eax,%edx
+  8022b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022bd:	83 c0 08             	add    $0x8,%eax
+  8022c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022c3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8022c6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8022cb:	e9 c9 00 00 00       	jmp    802399 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8022d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8022d6:	77 19                	ja     8022f1 <vprintfmt+0x518>
+  8022d8:	89 c2                	mov    %eax,%edx
+  8022da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022de:	83 c0 08             	add    $0x8,%eax
+  8022e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022e4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8022e7:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022ec:	e9 a8 00 00 00       	jmp    802399 <vprintfmt+0x5c0>
+  8022f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022fd:	eb e5                	jmp    8022e4 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8022ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802302:	83 f8 2f             	cmp    $0x2f,%eax
+  802305:	77 15                	ja     80231c <vprintfmt+0x543>
+  802307:	89 c2                	mov    %eax,%edx
+  802309:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80230d:	83 c0 08             	add    $0x8,%eax
+  802310:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802313:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802315:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80231a:	eb 7d                	jmp    802399 <vprintfmt+0x5c0>
+  80231c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802320:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802324:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802328:	eb e9                	jmp    802313 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80232a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80232d:	83 f8 2f             	cmp    $0x2f,%eax
+  802330:	77 16                	ja     802348 <vprintfmt+0x56f>
+  802332:	89 c2                	mov    %eax,%edx
+  802334:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802338:	83 c0 08             	add    $0x8,%eax
+  80233b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80233e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802341:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802346:	eb 51                	jmp    802399 <vprintfmt+0x5c0>
+  802348:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80234c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802350:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802354:	eb e8                	jmp    80233e <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802356:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80235a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80235e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802362:	e9 5c ff ff ff       	jmp    8022c3 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802367:	4c 89 ee             	mov    %r13,%rsi
+  80236a:	bf 30 00 00 00       	mov    $0x30,%edi
+  80236f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802372:	4c 89 ee             	mov    %r13,%rsi
+  802375:	bf 78 00 00 00       	mov    $0x78,%edi
+  80237a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80237d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802380:	83 f8 2f             	cmp    $0x2f,%eax
+  802383:	77 47                	ja     8023cc <vprintfmt+0x5f3>
+  802385:	89 c2                	mov    %eax,%edx
+  802387:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80238b:	83 c0 08             	add    $0x8,%eax
+  80238e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802391:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802394:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802399:	48 83 ec 08          	sub    $0x8,%rsp
+  80239d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8023a1:	0f 94 c0             	sete   %al
+  8023a4:	0f b6 c0             	movzbl %al,%eax
+  8023a7:	50                   	push   %rax
+  8023a8:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8023ad:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8023b1:	4c 89 ee             	mov    %r13,%rsi
+  8023b4:	4c 89 f7             	mov    %r14,%rdi
+  8023b7:	48 b8 ce 1c 80 00 00 	movabs $0x801cce,%rax
+  8023be:	00 00 00 
+  8023c1:	ff d0                	call   *%rax
+            break;
+  8023c3:	48 83 c4 10          	add    $0x10,%rsp
+  8023c7:	e9 3e fa ff ff       	jmp    801e0a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8023cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023d8:	eb b7                	jmp    802391 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8023da:	40 84 f6             	test   %sil,%sil
+  8023dd:	75 2b                	jne    80240a <vprintfmt+0x631>
+    switch (lflag) {
+  8023df:	85 d2                	test   %edx,%edx
+  8023e1:	74 56                	je     802439 <vprintfmt+0x660>
+  8023e3:	83 fa 01             	cmp    $0x1,%edx
+  8023e6:	74 7f                	je     802467 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8023e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8023ee:	0f 87 a2 00 00 00    	ja     802496 <vprintfmt+0x6bd>
+  8023f4:	89 c2                	mov    %eax,%edx
+  8023f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023fa:	83 c0 08             	add    $0x8,%eax
+  8023fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802400:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802403:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802408:	eb 8f                	jmp    802399 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80240a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80240d:	83 f8 2f             	cmp    $0x2f,%eax
+  802410:	77 19                	ja     80242b <vprintfmt+0x652>
+  802412:	89 c2                	mov    %eax,%edx
+  802414:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802418:	83 c0 08             	add    $0x8,%eax
+  80241b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80241e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802421:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802426:	e9 6e ff ff ff       	jmp    802399 <vprintfmt+0x5c0>
+  80242b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80242f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802433:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802437:	eb e5                	jmp    80241e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802439:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80243c:	83 f8 2f             	cmp    $0x2f,%eax
+  80243f:	77 18                	ja     802459 <vprintfmt+0x680>
+  802441:	89 c2                	mov    %eax,%edx
+  802443:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802447:	83 c0 08             	add    $0x8,%eax
+  80244a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80244d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80244f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802454:	e9 40 ff ff ff       	jmp    802399 <vprintfmt+0x5c0>
+  802459:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80245d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802461:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802465:	eb e6                	jmp    80244d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802467:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80246a:	83 f8 2f             	cmp    $0x2f,%eax
+  80246d:	77 19                	ja     802488 <vprintfmt+0x6af>
+  80246f:	89 c2                	mov    %eax,%edx
+  802471:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802475:	83 c0 08             	add    $0x8,%eax
+  802478:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80247b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80247e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802483:	e9 11 ff ff ff       	jmp    802399 <vprintfmt+0x5c0>
+  802488:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80248c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802490:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802494:	eb e5                	jmp    80247b <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802496:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80249a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80249e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024a2:	e9 59 ff ff ff       	jmp    802400 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8024a7:	4c 89 ee             	mov    %r13,%rsi
+  8024aa:	bf 25 00 00 00       	mov    $0x25,%edi
+  8024af:	41 ff d6             	call   *%r14
+            break;
+  8024b2:	e9 53 f9 ff ff       	jmp    801e0a <vprintfmt+0x31>
+            putch('%', put_arg);
+  8024b7:	4c 89 ee             	mov    %r13,%rsi
+  8024ba:	bf 25 00 00 00       	mov    $0x25,%edi
+  8024bf:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8024c2:	48 83 eb 01          	sub    $0x1,%rbx
+  8024c6:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8024ca:	75 f6                	jne    8024c2 <vprintfmt+0x6e9>
+  8024cc:	e9 39 f9 ff ff       	jmp    801e0a <vprintfmt+0x31>
+}
+  8024d1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8024d5:	5b                   	pop    %rbx
+  8024d6:	41 5c                	pop    %r12
+  8024d8:	41 5d                	pop    %r13
+  8024da:	41 5e                	pop    %r14
+  8024dc:	41 5f                	pop    %r15
+  8024de:	5d                   	pop    %rbp
+  8024df:	c3                   	ret
+
+00000000008024e0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8024e0:	55                   	push   %rbp
+  8024e1:	48 89 e5             	mov    %rsp,%rbp
+  8024e4:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8024e8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8024ec:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8024f1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8024f5:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8024fc:	48 85 ff             	test   %rdi,%rdi
+  8024ff:	74 2b                	je     80252c <vsnprintf+0x4c>
+  802501:	48 85 f6             	test   %rsi,%rsi
+  802504:	74 26                	je     80252c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802506:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80250a:	48 bf 84 1d 80 00 00 	movabs $0x801d84,%rdi
+  802511:	00 00 00 
+  802514:	48 b8 d9 1d 80 00 00 	movabs $0x801dd9,%rax
+  80251b:	00 00 00 
+  80251e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802520:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802524:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802527:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80252a:	c9                   	leave
+  80252b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80252c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802531:	eb f7                	jmp    80252a <vsnprintf+0x4a>
+
+0000000000802533 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802533:	55                   	push   %rbp
+  802534:	48 89 e5             	mov    %rsp,%rbp
+  802537:	48 83 ec 50          	sub    $0x50,%rsp
+  80253b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80253f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802543:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802547:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80254e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802552:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802556:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80255a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80255e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802562:	48 b8 e0 24 80 00 00 	movabs $0x8024e0,%rax
+  802569:	00 00 00 
+  80256c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80256e:	c9                   	leave
+  80256f:	c3                   	ret
+
+0000000000802570 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802570:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802573:	74 10                	je     802585 <strlen+0x15>
+    size_t n = 0;
+  802575:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80257a:	48 83 c0 01          	add    $0x1,%rax
+  80257e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802582:	75 f6                	jne    80257a <strlen+0xa>
+  802584:	c3                   	ret
+    size_t n = 0;
+  802585:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80258a:	c3                   	ret
+
+000000000080258b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80258b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80258e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802593:	48 85 f6             	test   %rsi,%rsi
+  802596:	74 11                	je     8025a9 <strnlen+0x1e>
+  802598:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80259c:	74 0c                	je     8025aa <strnlen+0x1f>
+  80259e:	48 83 c2 01          	add    $0x1,%rdx
+  8025a2:	48 39 d0             	cmp    %rdx,%rax
+  8025a5:	75 f1                	jne    802598 <strnlen+0xd>
+  8025a7:	eb 04                	jmp    8025ad <strnlen+0x22>
+  8025a9:	c3                   	ret
+  8025aa:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8025ad:	c3                   	ret
+
+00000000008025ae <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8025ae:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8025b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025b6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8025ba:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8025bd:	48 83 c2 01          	add    $0x1,%rdx
+  8025c1:	84 c9                	test   %cl,%cl
+  8025c3:	75 f1                	jne    8025b6 <strcpy+0x8>
+        ;
+    return res;
+}
+  8025c5:	c3                   	ret
+
+00000000008025c6 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8025c6:	55                   	push   %rbp
+  8025c7:	48 89 e5             	mov    %rsp,%rbp
+  8025ca:	41 54                	push   %r12
+  8025cc:	53                   	push   %rbx
+  8025cd:	48 89 fb             	mov    %rdi,%rbx
+  8025d0:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8025d3:	48 b8 70 25 80 00 00 	movabs $0x802570,%rax
+  8025da:	00 00 00 
+  8025dd:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8025df:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8025e3:	4c 89 e6             	mov    %r12,%rsi
+  8025e6:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  8025ed:	00 00 00 
+  8025f0:	ff d0                	call   *%rax
+    return dst;
+}
+  8025f2:	48 89 d8             	mov    %rbx,%rax
+  8025f5:	5b                   	pop    %rbx
+  8025f6:	41 5c                	pop    %r12
+  8025f8:	5d                   	pop    %rbp
+  8025f9:	c3                   	ret
+
+00000000008025fa <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8025fa:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8025fd:	48 85 d2             	test   %rdx,%rdx
+  802600:	74 1f                	je     802621 <strncpy+0x27>
+  802602:	48 01 fa             	add    %rdi,%rdx
+  802605:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802608:	48 83 c1 01          	add    $0x1,%rcx
+  80260c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802610:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802614:	41 80 f8 01          	cmp    $0x1,%r8b
+  802618:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80261c:	48 39 ca             	cmp    %rcx,%rdx
+  80261f:	75 e7                	jne    802608 <strncpy+0xe>
+    }
+    return ret;
+}
+  802621:	c3                   	ret
+
+0000000000802622 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802622:	48 89 f8             	mov    %rdi,%rax
+  802625:	48 85 d2             	test   %rdx,%rdx
+  802628:	74 24                	je     80264e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80262a:	48 83 ea 01          	sub    $0x1,%rdx
+  80262e:	74 1b                	je     80264b <strlcpy+0x29>
+  802630:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802634:	0f b6 16             	movzbl (%rsi),%edx
+  802637:	84 d2                	test   %dl,%dl
+  802639:	74 10                	je     80264b <strlcpy+0x29>
+            *dst++ = *src++;
+  80263b:	48 83 c6 01          	add    $0x1,%rsi
+  80263f:	48 83 c0 01          	add    $0x1,%rax
+  802643:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802646:	48 39 c8             	cmp    %rcx,%rax
+  802649:	75 e9                	jne    802634 <strlcpy+0x12>
+        *dst = '\0';
+  80264b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80264e:	48 29 f8             	sub    %rdi,%rax
+}
+  802651:	c3                   	ret
+
+0000000000802652 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802652:	0f b6 07             	movzbl (%rdi),%eax
+  802655:	84 c0                	test   %al,%al
+  802657:	74 13                	je     80266c <strcmp+0x1a>
+  802659:	38 06                	cmp    %al,(%rsi)
+  80265b:	75 0f                	jne    80266c <strcmp+0x1a>
+  80265d:	48 83 c7 01          	add    $0x1,%rdi
+  802661:	48 83 c6 01          	add    $0x1,%rsi
+  802665:	0f b6 07             	movzbl (%rdi),%eax
+  802668:	84 c0                	test   %al,%al
+  80266a:	75 ed                	jne    802659 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80266c:	0f b6 c0             	movzbl %al,%eax
+  80266f:	0f b6 16             	movzbl (%rsi),%edx
+  802672:	29 d0                	sub    %edx,%eax
+}
+  802674:	c3                   	ret
+
+0000000000802675 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802675:	48 85 d2             	test   %rdx,%rdx
+  802678:	74 1f                	je     802699 <strncmp+0x24>
+  80267a:	0f b6 07             	movzbl (%rdi),%eax
+  80267d:	84 c0                	test   %al,%al
+  80267f:	74 1e                	je     80269f <strncmp+0x2a>
+  802681:	3a 06                	cmp    (%rsi),%al
+  802683:	75 1a                	jne    80269f <strncmp+0x2a>
+  802685:	48 83 c7 01          	add    $0x1,%rdi
+  802689:	48 83 c6 01          	add    $0x1,%rsi
+  80268d:	48 83 ea 01          	sub    $0x1,%rdx
+  802691:	75 e7                	jne    80267a <strncmp+0x5>
+
+    if (!n) return 0;
+  802693:	b8 00 00 00 00       	mov    $0x0,%eax
+  802698:	c3                   	ret
+  802699:	b8 00 00 00 00       	mov    $0x0,%eax
+  80269e:	c3                   	ret
+  80269f:	48 85 d2             	test   %rdx,%rdx
+  8026a2:	74 09                	je     8026ad <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8026a4:	0f b6 07             	movzbl (%rdi),%eax
+  8026a7:	0f b6 16             	movzbl (%rsi),%edx
+  8026aa:	29 d0                	sub    %edx,%eax
+  8026ac:	c3                   	ret
+    if (!n) return 0;
+  8026ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026b2:	c3                   	ret
+
+00000000008026b3 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8026b3:	0f b6 17             	movzbl (%rdi),%edx
+  8026b6:	84 d2                	test   %dl,%dl
+  8026b8:	74 18                	je     8026d2 <strchr+0x1f>
+        if (*str == c) {
+  8026ba:	0f be d2             	movsbl %dl,%edx
+  8026bd:	39 f2                	cmp    %esi,%edx
+  8026bf:	74 17                	je     8026d8 <strchr+0x25>
+    for (; *str; str++) {
+  8026c1:	48 83 c7 01          	add    $0x1,%rdi
+  8026c5:	0f b6 17             	movzbl (%rdi),%edx
+  8026c8:	84 d2                	test   %dl,%dl
+  8026ca:	75 ee                	jne    8026ba <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8026cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d1:	c3                   	ret
+  8026d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d7:	c3                   	ret
+  8026d8:	48 89 f8             	mov    %rdi,%rax
+}
+  8026db:	c3                   	ret
+
+00000000008026dc <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8026dc:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8026df:	0f b6 17             	movzbl (%rdi),%edx
+  8026e2:	84 d2                	test   %dl,%dl
+  8026e4:	74 13                	je     8026f9 <strfind+0x1d>
+  8026e6:	0f be d2             	movsbl %dl,%edx
+  8026e9:	39 f2                	cmp    %esi,%edx
+  8026eb:	74 0b                	je     8026f8 <strfind+0x1c>
+  8026ed:	48 83 c0 01          	add    $0x1,%rax
+  8026f1:	0f b6 10             	movzbl (%rax),%edx
+  8026f4:	84 d2                	test   %dl,%dl
+  8026f6:	75 ee                	jne    8026e6 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8026f8:	c3                   	ret
+  8026f9:	c3                   	ret
+
+00000000008026fa <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8026fa:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8026fd:	48 89 f8             	mov    %rdi,%rax
+  802700:	48 f7 d8             	neg    %rax
+  802703:	83 e0 07             	and    $0x7,%eax
+  802706:	49 89 d1             	mov    %rdx,%r9
+  802709:	49 29 c1             	sub    %rax,%r9
+  80270c:	78 36                	js     802744 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80270e:	40 0f b6 c6          	movzbl %sil,%eax
+  802712:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802719:	01 01 01 
+  80271c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802720:	40 f6 c7 07          	test   $0x7,%dil
+  802724:	75 38                	jne    80275e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802726:	4c 89 c9             	mov    %r9,%rcx
+  802729:	48 c1 f9 03          	sar    $0x3,%rcx
+  80272d:	74 0c                	je     80273b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80272f:	fc                   	cld
+  802730:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802733:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802737:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80273b:	4d 85 c9             	test   %r9,%r9
+  80273e:	75 45                	jne    802785 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802740:	4c 89 c0             	mov    %r8,%rax
+  802743:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802744:	48 85 d2             	test   %rdx,%rdx
+  802747:	74 f7                	je     802740 <memset+0x46>
+  802749:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80274c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80274f:	48 83 c0 01          	add    $0x1,%rax
+  802753:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802757:	48 39 c2             	cmp    %rax,%rdx
+  80275a:	75 f3                	jne    80274f <memset+0x55>
+  80275c:	eb e2                	jmp    802740 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80275e:	40 f6 c7 01          	test   $0x1,%dil
+  802762:	74 06                	je     80276a <memset+0x70>
+  802764:	88 07                	mov    %al,(%rdi)
+  802766:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80276a:	40 f6 c7 02          	test   $0x2,%dil
+  80276e:	74 07                	je     802777 <memset+0x7d>
+  802770:	66 89 07             	mov    %ax,(%rdi)
+  802773:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802777:	40 f6 c7 04          	test   $0x4,%dil
+  80277b:	74 a9                	je     802726 <memset+0x2c>
+  80277d:	89 07                	mov    %eax,(%rdi)
+  80277f:	48 83 c7 04          	add    $0x4,%rdi
+  802783:	eb a1                	jmp    802726 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802785:	41 f6 c1 04          	test   $0x4,%r9b
+  802789:	74 06                	je     802791 <memset+0x97>
+  80278b:	89 07                	mov    %eax,(%rdi)
+  80278d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802791:	41 f6 c1 02          	test   $0x2,%r9b
+  802795:	74 07                	je     80279e <memset+0xa4>
+  802797:	66 89 07             	mov    %ax,(%rdi)
+  80279a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80279e:	41 f6 c1 01          	test   $0x1,%r9b
+  8027a2:	74 9c                	je     802740 <memset+0x46>
+  8027a4:	88 07                	mov    %al,(%rdi)
+  8027a6:	eb 98                	jmp    802740 <memset+0x46>
+
+00000000008027a8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8027a8:	48 89 f8             	mov    %rdi,%rax
+  8027ab:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8027ae:	48 39 fe             	cmp    %rdi,%rsi
+  8027b1:	73 3b                	jae    8027ee <memmove+0x46>
+  8027b3:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8027b7:	48 39 d7             	cmp    %rdx,%rdi
+  8027ba:	73 32                	jae    8027ee <memmove+0x46>
+        s += n;
+        d += n;
+  8027bc:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8027c0:	48 89 d6             	mov    %rdx,%rsi
+  8027c3:	48 09 fe             	or     %rdi,%rsi
+  8027c6:	48 09 ce             	or     %rcx,%rsi
+  8027c9:	40 f6 c6 07          	test   $0x7,%sil
+  8027cd:	75 12                	jne    8027e1 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8027cf:	48 83 ef 08          	sub    $0x8,%rdi
+  8027d3:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8027d7:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027db:	fd                   	std
+  8027dc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8027df:	fc                   	cld
+  8027e0:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8027e1:	48 83 ef 01          	sub    $0x1,%rdi
+  8027e5:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8027e9:	fd                   	std
+  8027ea:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8027ec:	eb f1                	jmp    8027df <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8027ee:	48 89 f2             	mov    %rsi,%rdx
+  8027f1:	48 09 c2             	or     %rax,%rdx
+  8027f4:	48 09 ca             	or     %rcx,%rdx
+  8027f7:	f6 c2 07             	test   $0x7,%dl
+  8027fa:	75 0c                	jne    802808 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8027fc:	48 c1 e9 03          	shr    $0x3,%rcx
+  802800:	48 89 c7             	mov    %rax,%rdi
+  802803:	fc                   	cld
+  802804:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802807:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802808:	48 89 c7             	mov    %rax,%rdi
+  80280b:	fc                   	cld
+  80280c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80280e:	c3                   	ret
+
+000000000080280f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80280f:	55                   	push   %rbp
+  802810:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802813:	48 b8 a8 27 80 00 00 	movabs $0x8027a8,%rax
+  80281a:	00 00 00 
+  80281d:	ff d0                	call   *%rax
+}
+  80281f:	5d                   	pop    %rbp
+  802820:	c3                   	ret
+
+0000000000802821 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802821:	55                   	push   %rbp
+  802822:	48 89 e5             	mov    %rsp,%rbp
+  802825:	41 57                	push   %r15
+  802827:	41 56                	push   %r14
+  802829:	41 55                	push   %r13
+  80282b:	41 54                	push   %r12
+  80282d:	53                   	push   %rbx
+  80282e:	48 83 ec 08          	sub    $0x8,%rsp
+  802832:	49 89 fe             	mov    %rdi,%r14
+  802835:	49 89 f7             	mov    %rsi,%r15
+  802838:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80283b:	48 89 f7             	mov    %rsi,%rdi
+  80283e:	48 b8 70 25 80 00 00 	movabs $0x802570,%rax
+  802845:	00 00 00 
+  802848:	ff d0                	call   *%rax
+  80284a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80284d:	48 89 de             	mov    %rbx,%rsi
+  802850:	4c 89 f7             	mov    %r14,%rdi
+  802853:	48 b8 8b 25 80 00 00 	movabs $0x80258b,%rax
+  80285a:	00 00 00 
+  80285d:	ff d0                	call   *%rax
+  80285f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802862:	48 39 c3             	cmp    %rax,%rbx
+  802865:	74 36                	je     80289d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802867:	48 89 d8             	mov    %rbx,%rax
+  80286a:	4c 29 e8             	sub    %r13,%rax
+  80286d:	49 39 c4             	cmp    %rax,%r12
+  802870:	73 31                	jae    8028a3 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802872:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802877:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80287b:	4c 89 fe             	mov    %r15,%rsi
+  80287e:	48 b8 0f 28 80 00 00 	movabs $0x80280f,%rax
+  802885:	00 00 00 
+  802888:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80288a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80288e:	48 83 c4 08          	add    $0x8,%rsp
+  802892:	5b                   	pop    %rbx
+  802893:	41 5c                	pop    %r12
+  802895:	41 5d                	pop    %r13
+  802897:	41 5e                	pop    %r14
+  802899:	41 5f                	pop    %r15
+  80289b:	5d                   	pop    %rbp
+  80289c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80289d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8028a1:	eb eb                	jmp    80288e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8028a3:	48 83 eb 01          	sub    $0x1,%rbx
+  8028a7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8028ab:	48 89 da             	mov    %rbx,%rdx
+  8028ae:	4c 89 fe             	mov    %r15,%rsi
+  8028b1:	48 b8 0f 28 80 00 00 	movabs $0x80280f,%rax
+  8028b8:	00 00 00 
+  8028bb:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8028bd:	49 01 de             	add    %rbx,%r14
+  8028c0:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8028c5:	eb c3                	jmp    80288a <strlcat+0x69>
+
+00000000008028c7 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8028c7:	48 85 d2             	test   %rdx,%rdx
+  8028ca:	74 2d                	je     8028f9 <memcmp+0x32>
+  8028cc:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8028d1:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8028d5:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8028da:	44 38 c1             	cmp    %r8b,%cl
+  8028dd:	75 0f                	jne    8028ee <memcmp+0x27>
+    while (n-- > 0) {
+  8028df:	48 83 c0 01          	add    $0x1,%rax
+  8028e3:	48 39 c2             	cmp    %rax,%rdx
+  8028e6:	75 e9                	jne    8028d1 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8028e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ed:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8028ee:	0f b6 c1             	movzbl %cl,%eax
+  8028f1:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8028f5:	44 29 c0             	sub    %r8d,%eax
+  8028f8:	c3                   	ret
+    return 0;
+  8028f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028fe:	c3                   	ret
+
+00000000008028ff <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8028ff:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802903:	48 39 c7             	cmp    %rax,%rdi
+  802906:	73 0f                	jae    802917 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802908:	40 38 37             	cmp    %sil,(%rdi)
+  80290b:	74 0e                	je     80291b <memfind+0x1c>
+    for (; src < end; src++) {
+  80290d:	48 83 c7 01          	add    $0x1,%rdi
+  802911:	48 39 f8             	cmp    %rdi,%rax
+  802914:	75 f2                	jne    802908 <memfind+0x9>
+  802916:	c3                   	ret
+  802917:	48 89 f8             	mov    %rdi,%rax
+  80291a:	c3                   	ret
+  80291b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80291e:	c3                   	ret
+
+000000000080291f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80291f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802922:	0f b6 37             	movzbl (%rdi),%esi
+  802925:	40 80 fe 20          	cmp    $0x20,%sil
+  802929:	74 06                	je     802931 <strtol+0x12>
+  80292b:	40 80 fe 09          	cmp    $0x9,%sil
+  80292f:	75 13                	jne    802944 <strtol+0x25>
+  802931:	48 83 c7 01          	add    $0x1,%rdi
+  802935:	0f b6 37             	movzbl (%rdi),%esi
+  802938:	40 80 fe 20          	cmp    $0x20,%sil
+  80293c:	74 f3                	je     802931 <strtol+0x12>
+  80293e:	40 80 fe 09          	cmp    $0x9,%sil
+  802942:	74 ed                	je     802931 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802944:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802947:	83 e0 fd             	and    $0xfffffffd,%eax
+  80294a:	3c 01                	cmp    $0x1,%al
+  80294c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802950:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802956:	75 0f                	jne    802967 <strtol+0x48>
+  802958:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80295b:	74 14                	je     802971 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80295d:	85 d2                	test   %edx,%edx
+  80295f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802964:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802967:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80296c:	4c 63 ca             	movslq %edx,%r9
+  80296f:	eb 36                	jmp    8029a7 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802971:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802975:	74 0f                	je     802986 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802977:	85 d2                	test   %edx,%edx
+  802979:	75 ec                	jne    802967 <strtol+0x48>
+        s++;
+  80297b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80297f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802984:	eb e1                	jmp    802967 <strtol+0x48>
+        s += 2;
+  802986:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80298a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80298f:	eb d6                	jmp    802967 <strtol+0x48>
+            dig -= '0';
+  802991:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802994:	44 0f b6 c1          	movzbl %cl,%r8d
+  802998:	41 39 d0             	cmp    %edx,%r8d
+  80299b:	7d 21                	jge    8029be <strtol+0x9f>
+        val = val * base + dig;
+  80299d:	49 0f af c1          	imul   %r9,%rax
+  8029a1:	0f b6 c9             	movzbl %cl,%ecx
+  8029a4:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8029a7:	48 83 c7 01          	add    $0x1,%rdi
+  8029ab:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8029af:	80 f9 39             	cmp    $0x39,%cl
+  8029b2:	76 dd                	jbe    802991 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8029b4:	80 f9 7b             	cmp    $0x7b,%cl
+  8029b7:	77 05                	ja     8029be <strtol+0x9f>
+            dig -= 'a' - 10;
+  8029b9:	83 e9 57             	sub    $0x57,%ecx
+  8029bc:	eb d6                	jmp    802994 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8029be:	4d 85 d2             	test   %r10,%r10
+  8029c1:	74 03                	je     8029c6 <strtol+0xa7>
+  8029c3:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8029c6:	48 89 c2             	mov    %rax,%rdx
+  8029c9:	48 f7 da             	neg    %rdx
+  8029cc:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8029d0:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8029d4:	c3                   	ret
+
+00000000008029d5 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8029d5:	55                   	push   %rbp
+  8029d6:	48 89 e5             	mov    %rsp,%rbp
+  8029d9:	41 54                	push   %r12
+  8029db:	53                   	push   %rbx
+  8029dc:	48 89 fb             	mov    %rdi,%rbx
+  8029df:	48 89 f7             	mov    %rsi,%rdi
+  8029e2:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8029e5:	48 85 f6             	test   %rsi,%rsi
+  8029e8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029ef:	00 00 00 
+  8029f2:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8029f6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029fb:	48 b8 2e 06 80 00 00 	movabs $0x80062e,%rax
+  802a02:	00 00 00 
+  802a05:	ff d0                	call   *%rax
+    if (res < 0) {
+  802a07:	85 c0                	test   %eax,%eax
+  802a09:	78 45                	js     802a50 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802a0b:	48 85 db             	test   %rbx,%rbx
+  802a0e:	74 12                	je     802a22 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802a10:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a17:	00 00 00 
+  802a1a:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802a20:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802a22:	4d 85 e4             	test   %r12,%r12
+  802a25:	74 14                	je     802a3b <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802a27:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a2e:	00 00 00 
+  802a31:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802a37:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802a3b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a42:	00 00 00 
+  802a45:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802a4b:	5b                   	pop    %rbx
+  802a4c:	41 5c                	pop    %r12
+  802a4e:	5d                   	pop    %rbp
+  802a4f:	c3                   	ret
+        if (from_env_store)
+  802a50:	48 85 db             	test   %rbx,%rbx
+  802a53:	74 06                	je     802a5b <ipc_recv+0x86>
+            *from_env_store = 0;
+  802a55:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802a5b:	4d 85 e4             	test   %r12,%r12
+  802a5e:	74 eb                	je     802a4b <ipc_recv+0x76>
+            *perm_store = 0;
+  802a60:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802a67:	00 
+  802a68:	eb e1                	jmp    802a4b <ipc_recv+0x76>
+
+0000000000802a6a <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802a6a:	55                   	push   %rbp
+  802a6b:	48 89 e5             	mov    %rsp,%rbp
+  802a6e:	41 57                	push   %r15
+  802a70:	41 56                	push   %r14
+  802a72:	41 55                	push   %r13
+  802a74:	41 54                	push   %r12
+  802a76:	53                   	push   %rbx
+  802a77:	48 83 ec 18          	sub    $0x18,%rsp
+  802a7b:	41 89 fd             	mov    %edi,%r13d
+  802a7e:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802a81:	48 89 d3             	mov    %rdx,%rbx
+  802a84:	49 89 cc             	mov    %rcx,%r12
+  802a87:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a8b:	48 85 d2             	test   %rdx,%rdx
+  802a8e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a95:	00 00 00 
+  802a98:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a9c:	49 be 02 06 80 00 00 	movabs $0x800602,%r14
+  802aa3:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802aa6:	49 bf 35 02 80 00 00 	movabs $0x800235,%r15
+  802aad:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802ab0:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802ab3:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802ab7:	4c 89 e1             	mov    %r12,%rcx
+  802aba:	48 89 da             	mov    %rbx,%rdx
+  802abd:	44 89 ef             	mov    %r13d,%edi
+  802ac0:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802ac3:	85 c0                	test   %eax,%eax
+  802ac5:	74 34                	je     802afb <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802ac7:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802aca:	75 05                	jne    802ad1 <ipc_send+0x67>
+        sys_yield();
+  802acc:	41 ff d7             	call   *%r15
+    while (true) {
+  802acf:	eb df                	jmp    802ab0 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802ad1:	48 ba 0f 32 80 00 00 	movabs $0x80320f,%rdx
+  802ad8:	00 00 00 
+  802adb:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802ae0:	48 bf 28 32 80 00 00 	movabs $0x803228,%rdi
+  802ae7:	00 00 00 
+  802aea:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aef:	48 b9 39 1b 80 00 00 	movabs $0x801b39,%rcx
+  802af6:	00 00 00 
+  802af9:	ff d1                	call   *%rcx
+    }
+}
+  802afb:	48 83 c4 18          	add    $0x18,%rsp
+  802aff:	5b                   	pop    %rbx
+  802b00:	41 5c                	pop    %r12
+  802b02:	41 5d                	pop    %r13
+  802b04:	41 5e                	pop    %r14
+  802b06:	41 5f                	pop    %r15
+  802b08:	5d                   	pop    %rbp
+  802b09:	c3                   	ret
+
+0000000000802b0a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802b0f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802b16:	00 00 00 
+  802b19:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802b20:	48 01 ca             	add    %rcx,%rdx
+  802b23:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802b29:	39 fa                	cmp    %edi,%edx
+  802b2b:	74 12                	je     802b3f <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802b2d:	48 83 c0 01          	add    $0x1,%rax
+  802b31:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b37:	75 e0                	jne    802b19 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802b39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b3e:	c3                   	ret
+            return envs[i].env_id;
+  802b3f:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802b46:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b4d:	00 00 00 
+  802b50:	48 01 d0             	add    %rdx,%rax
+  802b53:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b59:	c3                   	ret
+  802b5a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802b60 <__rodata_start>:
+  802b60:	3c 75                	cmp    $0x75,%al
+  802b62:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b63:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b67:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b68:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802b6c:	1f                   	(bad)
+  802b6d:	44 00 00             	add    %r8b,(%rax)
+  802b70:	73 79                	jae    802beb <__rodata_start+0x8b>
+  802b72:	73 63                	jae    802bd7 <__rodata_start+0x77>
+  802b74:	61                   	(bad)
+  802b75:	6c                   	insb   (%dx),%es:(%rdi)
+  802b76:	6c                   	insb   (%dx),%es:(%rdi)
+  802b77:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a08ff7 <__bss_end+0x72200ff7>
+  802b7d:	65 74 75             	gs je  802bf5 <__rodata_start+0x95>
+  802b80:	72 6e                	jb     802bf0 <__rodata_start+0x90>
+  802b82:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09004 <__bss_end+0x28201004>
+  802b89:	28 
+  802b8a:	3e 20 30             	ds and %dh,(%rax)
+  802b8d:	29 00                	sub    %eax,(%rax)
+  802b8f:	6c                   	insb   (%dx),%es:(%rdi)
+  802b90:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802b97:	61                   	(bad)
+  802b98:	6c                   	insb   (%dx),%es:(%rdi)
+  802b99:	6c                   	insb   (%dx),%es:(%rdi)
+  802b9a:	2e 63 00             	cs movsxd (%rax),%eax
+  802b9d:	0f 1f 00             	nopl   (%rax)
+  802ba0:	5b                   	pop    %rbx
+  802ba1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802ba6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802ba9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802bad:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bae:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802bb2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802bb9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 803624 <error_string+0x4e4>
+  802bc0:	5b                   	pop    %rbx
+  802bc1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802bc6:	20 66 74             	and    %ah,0x74(%rsi)
+  802bc9:	72 75                	jb     802c40 <devtab+0x20>
+  802bcb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bcc:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802bcf:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4c3a <__bss_end+0x2d2ccc3a>
+  802bd6:	20 62 61             	and    %ah,0x61(%rdx)
+  802bd9:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802bdd:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802be1:	5b                   	pop    %rbx
+  802be2:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802be7:	20 72 65             	and    %dh,0x65(%rdx)
+  802bea:	61                   	(bad)
+  802beb:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4c56 <__bss_end+0x2d2ccc56>
+  802bf2:	20 62 61             	and    %ah,0x61(%rdx)
+  802bf5:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802bf9:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bfd:	5b                   	pop    %rbx
+  802bfe:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802c03:	20 77 72             	and    %dh,0x72(%rdi)
+  802c06:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802c0d:	2d 
+  802c0e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802c13:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802c16:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802c1a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802c20 <devtab>:
+  802c20:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802c30:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802c40:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802c50:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802c60:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802c70:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802c80:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802c90:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802ca0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802cb0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802cc0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802cd0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802ce0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802cf0:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802d00:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802d10:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802d20:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802d30:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802d40:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802d50:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802d60:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802d70:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802d80:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802d90:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802da0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802db0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802dc0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802dd0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802de0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802df0:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802e00:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802e10:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802e20:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802e30:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802e40:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802e50:	64 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     d.operation not 
+  802e60:	70 65 72 6d 69 74 74 65 64 00 66 2e 0f 1f 84 00     permitted.f.....
+  802e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
+  802e80:	76 1e 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     v........$......
+  802e90:	a7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  802ea0:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  802eb0:	b7 24 80 00 00 00 00 00 95 1e 80 00 00 00 00 00     .$..............
+  802ec0:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  802ed0:	89 1e 80 00 00 00 00 00 03 1f 80 00 00 00 00 00     ................
+  802ee0:	b7 24 80 00 00 00 00 00 89 1e 80 00 00 00 00 00     .$..............
+  802ef0:	cf 1e 80 00 00 00 00 00 cf 1e 80 00 00 00 00 00     ................
+  802f00:	cf 1e 80 00 00 00 00 00 cf 1e 80 00 00 00 00 00     ................
+  802f10:	cf 1e 80 00 00 00 00 00 cf 1e 80 00 00 00 00 00     ................
+  802f20:	cf 1e 80 00 00 00 00 00 cf 1e 80 00 00 00 00 00     ................
+  802f30:	cf 1e 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .........$......
+  802f40:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  802f50:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  802f60:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  802f70:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  802f80:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  802f90:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  802fa0:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  802fb0:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  802fc0:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  802fd0:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  802fe0:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  802ff0:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  803000:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  803010:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  803020:	b7 24 80 00 00 00 00 00 da 23 80 00 00 00 00 00     .$.......#......
+  803030:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  803040:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  803050:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  803060:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  803070:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  803080:	26 1f 80 00 00 00 00 00 f5 20 80 00 00 00 00 00     &........ ......
+  803090:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  8030a0:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  8030b0:	55 1f 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     U........$......
+  8030c0:	b7 24 80 00 00 00 00 00 1b 1f 80 00 00 00 00 00     .$..............
+  8030d0:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  8030e0:	9d 22 80 00 00 00 00 00 67 23 80 00 00 00 00 00     ."......g#......
+  8030f0:	b7 24 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .$.......$......
+  803100:	ec 1f 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .........$......
+  803110:	c9 21 80 00 00 00 00 00 b7 24 80 00 00 00 00 00     .!.......$......
+  803120:	b7 24 80 00 00 00 00 00 da 23 80 00 00 00 00 00     .$.......#......
+  803130:	b7 24 80 00 00 00 00 00 7f 1e 80 00 00 00 00 00     .$..............
+
+0000000000803140 <error_string>:
+	...
+  803148:	f5 2c 80 00 00 00 00 00 07 2d 80 00 00 00 00 00     .,.......-......
+  803158:	17 2d 80 00 00 00 00 00 29 2d 80 00 00 00 00 00     .-......)-......
+  803168:	37 2d 80 00 00 00 00 00 4b 2d 80 00 00 00 00 00     7-......K-......
+  803178:	60 2d 80 00 00 00 00 00 73 2d 80 00 00 00 00 00     `-......s-......
+  803188:	85 2d 80 00 00 00 00 00 99 2d 80 00 00 00 00 00     .-.......-......
+  803198:	a9 2d 80 00 00 00 00 00 bc 2d 80 00 00 00 00 00     .-.......-......
+  8031a8:	d3 2d 80 00 00 00 00 00 e9 2d 80 00 00 00 00 00     .-.......-......
+  8031b8:	01 2e 80 00 00 00 00 00 19 2e 80 00 00 00 00 00     ................
+  8031c8:	26 2e 80 00 00 00 00 00 f0 31 80 00 00 00 00 00     &........1......
+  8031d8:	3a 2e 80 00 00 00 00 00 00 00 00 00 00 00 00 00     :...............
+  8031e8:	52 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     R.......file is 
+  8031f8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803208:	75 74 61 62 6c 65 00 69 70 63 5f 73 65 6e 64 3a     utable.ipc_send:
+  803218:	20 66 61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00      failed to send.
+  803228:	6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00     lib/ipc.c.f.....
+  803238:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803248:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803258:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803268:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803278:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803288:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803298:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8032d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803308:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803318:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803328:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803338:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803348:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803358:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803368:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803378:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803388:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803398:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803408:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803418:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803428:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803438:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803448:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803458:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803468:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803478:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803488:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803498:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803508:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803518:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803528:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803538:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803548:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803558:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803568:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803578:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803588:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803598:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803608:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803618:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803628:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803638:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803648:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803658:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803668:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803678:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803688:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803698:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803708:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803718:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803728:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803738:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803748:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803758:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803768:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803778:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803788:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803798:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803808:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803818:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803828:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803838:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803848:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803858:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803868:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803878:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803888:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803898:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803908:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803918:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803928:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803938:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803948:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803958:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803968:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803978:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803988:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803998:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803aa8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ab8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ac8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ad8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ae8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803af8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ba8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bb8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bc8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bd8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803be8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bf8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ca8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cb8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cc8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cd8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ce8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cf8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803da8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803db8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dc8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803dd8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803de8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803df8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ea8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803eb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ec8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ed8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ee8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ef8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fa8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fb8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fc8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fd8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fe8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ff8:	00 00 00 00 0f 1f 40 00                             ......@.
@@ -0,0 +1,6181 @@
+
+obj/user/faultdie:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 72 00 00 00       	call   800095 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+/* Test user-level fault handler -- just exit when we fault */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = (void *)utf->utf_fault_va;
+    uint64_t err = utf->utf_err;
+    cprintf("i faulted at va %lx, err %x\n",
+  800029:	8b 57 08             	mov    0x8(%rdi),%edx
+  80002c:	83 e2 07             	and    $0x7,%edx
+  80002f:	48 8b 37             	mov    (%rdi),%rsi
+  800032:	48 bf d8 30 80 00 00 	movabs $0x8030d8,%rdi
+  800039:	00 00 00 
+  80003c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800041:	48 b9 0c 02 80 00 00 	movabs $0x80020c,%rcx
+  800048:	00 00 00 
+  80004b:	ff d1                	call   *%rcx
+            (unsigned long)addr, (unsigned)(err & 7));
+    sys_env_destroy(sys_getenvid());
+  80004d:	48 b8 21 10 80 00 00 	movabs $0x801021,%rax
+  800054:	00 00 00 
+  800057:	ff d0                	call   *%rax
+  800059:	89 c7                	mov    %eax,%edi
+  80005b:	48 b8 b6 0f 80 00 00 	movabs $0x800fb6,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+    return 1;
+}
+  800067:	b8 01 00 00 00       	mov    $0x1,%eax
+  80006c:	5d                   	pop    %rbp
+  80006d:	c3                   	ret
+
+000000000080006e <umain>:
+
+void
+umain(int argc, char **argv) {
+  80006e:	55                   	push   %rbp
+  80006f:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(handler);
+  800072:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  800079:	00 00 00 
+  80007c:	48 b8 0d 17 80 00 00 	movabs $0x80170d,%rax
+  800083:	00 00 00 
+  800086:	ff d0                	call   *%rax
+    *(volatile int *)0xDEADBEEF = 0;
+  800088:	b8 ef be ad de       	mov    $0xdeadbeef,%eax
+  80008d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  800093:	5d                   	pop    %rbp
+  800094:	c3                   	ret
+
+0000000000800095 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800095:	55                   	push   %rbp
+  800096:	48 89 e5             	mov    %rsp,%rbp
+  800099:	41 56                	push   %r14
+  80009b:	41 55                	push   %r13
+  80009d:	41 54                	push   %r12
+  80009f:	53                   	push   %rbx
+  8000a0:	41 89 fd             	mov    %edi,%r13d
+  8000a3:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000a6:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8000ad:	00 00 00 
+  8000b0:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8000b7:	00 00 00 
+  8000ba:	48 39 c2             	cmp    %rax,%rdx
+  8000bd:	73 17                	jae    8000d6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8000bf:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000c2:	49 89 c4             	mov    %rax,%r12
+  8000c5:	48 83 c3 08          	add    $0x8,%rbx
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	ff 53 f8             	call   *-0x8(%rbx)
+  8000d1:	4c 39 e3             	cmp    %r12,%rbx
+  8000d4:	72 ef                	jb     8000c5 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8000d6:	48 b8 21 10 80 00 00 	movabs $0x801021,%rax
+  8000dd:	00 00 00 
+  8000e0:	ff d0                	call   *%rax
+  8000e2:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8000e5:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8000ec:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000f3:	00 00 00 
+  8000f6:	48 01 d0             	add    %rdx,%rax
+  8000f9:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800100:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800103:	45 85 ed             	test   %r13d,%r13d
+  800106:	7e 0d                	jle    800115 <libmain+0x80>
+  800108:	49 8b 06             	mov    (%r14),%rax
+  80010b:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800112:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800115:	4c 89 f6             	mov    %r14,%rsi
+  800118:	44 89 ef             	mov    %r13d,%edi
+  80011b:	48 b8 6e 00 80 00 00 	movabs $0x80006e,%rax
+  800122:	00 00 00 
+  800125:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800127:	48 b8 3c 01 80 00 00 	movabs $0x80013c,%rax
+  80012e:	00 00 00 
+  800131:	ff d0                	call   *%rax
+#endif
+}
+  800133:	5b                   	pop    %rbx
+  800134:	41 5c                	pop    %r12
+  800136:	41 5d                	pop    %r13
+  800138:	41 5e                	pop    %r14
+  80013a:	5d                   	pop    %rbp
+  80013b:	c3                   	ret
+
+000000000080013c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80013c:	55                   	push   %rbp
+  80013d:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800140:	48 b8 26 1c 80 00 00 	movabs $0x801c26,%rax
+  800147:	00 00 00 
+  80014a:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80014c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800151:	48 b8 b6 0f 80 00 00 	movabs $0x800fb6,%rax
+  800158:	00 00 00 
+  80015b:	ff d0                	call   *%rax
+}
+  80015d:	5d                   	pop    %rbp
+  80015e:	c3                   	ret
+
+000000000080015f <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80015f:	55                   	push   %rbp
+  800160:	48 89 e5             	mov    %rsp,%rbp
+  800163:	53                   	push   %rbx
+  800164:	48 83 ec 08          	sub    $0x8,%rsp
+  800168:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80016b:	8b 06                	mov    (%rsi),%eax
+  80016d:	8d 50 01             	lea    0x1(%rax),%edx
+  800170:	89 16                	mov    %edx,(%rsi)
+  800172:	48 98                	cltq
+  800174:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800179:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80017f:	74 0a                	je     80018b <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800181:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800185:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800189:	c9                   	leave
+  80018a:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80018b:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80018f:	be ff 00 00 00       	mov    $0xff,%esi
+  800194:	48 b8 58 0f 80 00 00 	movabs $0x800f58,%rax
+  80019b:	00 00 00 
+  80019e:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001a0:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001a6:	eb d9                	jmp    800181 <putch+0x22>
+
+00000000008001a8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001a8:	55                   	push   %rbp
+  8001a9:	48 89 e5             	mov    %rsp,%rbp
+  8001ac:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001b3:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8001b6:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8001bd:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8001c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001ca:	48 89 f1             	mov    %rsi,%rcx
+  8001cd:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001d4:	48 bf 5f 01 80 00 00 	movabs $0x80015f,%rdi
+  8001db:	00 00 00 
+  8001de:	48 b8 5c 03 80 00 00 	movabs $0x80035c,%rax
+  8001e5:	00 00 00 
+  8001e8:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001ea:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001f1:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001f8:	48 b8 58 0f 80 00 00 	movabs $0x800f58,%rax
+  8001ff:	00 00 00 
+  800202:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800204:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80020a:	c9                   	leave
+  80020b:	c3                   	ret
+
+000000000080020c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80020c:	55                   	push   %rbp
+  80020d:	48 89 e5             	mov    %rsp,%rbp
+  800210:	48 83 ec 50          	sub    $0x50,%rsp
+  800214:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800218:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80021c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800220:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800224:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800228:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80022f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800233:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800237:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80023b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80023f:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800243:	48 b8 a8 01 80 00 00 	movabs $0x8001a8,%rax
+  80024a:	00 00 00 
+  80024d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80024f:	c9                   	leave
+  800250:	c3                   	ret
+
+0000000000800251 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800251:	55                   	push   %rbp
+  800252:	48 89 e5             	mov    %rsp,%rbp
+  800255:	41 57                	push   %r15
+  800257:	41 56                	push   %r14
+  800259:	41 55                	push   %r13
+  80025b:	41 54                	push   %r12
+  80025d:	53                   	push   %rbx
+  80025e:	48 83 ec 18          	sub    $0x18,%rsp
+  800262:	49 89 fc             	mov    %rdi,%r12
+  800265:	49 89 f5             	mov    %rsi,%r13
+  800268:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80026c:	8b 45 10             	mov    0x10(%rbp),%eax
+  80026f:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800272:	41 89 cf             	mov    %ecx,%r15d
+  800275:	4c 39 fa             	cmp    %r15,%rdx
+  800278:	73 5b                	jae    8002d5 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80027a:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80027e:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800282:	85 db                	test   %ebx,%ebx
+  800284:	7e 0e                	jle    800294 <print_num+0x43>
+            putch(padc, put_arg);
+  800286:	4c 89 ee             	mov    %r13,%rsi
+  800289:	44 89 f7             	mov    %r14d,%edi
+  80028c:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80028f:	83 eb 01             	sub    $0x1,%ebx
+  800292:	75 f2                	jne    800286 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800294:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800298:	48 b9 10 31 80 00 00 	movabs $0x803110,%rcx
+  80029f:	00 00 00 
+  8002a2:	48 b8 ff 30 80 00 00 	movabs $0x8030ff,%rax
+  8002a9:	00 00 00 
+  8002ac:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8002b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b9:	49 f7 f7             	div    %r15
+  8002bc:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8002c0:	4c 89 ee             	mov    %r13,%rsi
+  8002c3:	41 ff d4             	call   *%r12
+}
+  8002c6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002ca:	5b                   	pop    %rbx
+  8002cb:	41 5c                	pop    %r12
+  8002cd:	41 5d                	pop    %r13
+  8002cf:	41 5e                	pop    %r14
+  8002d1:	41 5f                	pop    %r15
+  8002d3:	5d                   	pop    %rbp
+  8002d4:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002de:	49 f7 f7             	div    %r15
+  8002e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8002e5:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002e9:	52                   	push   %rdx
+  8002ea:	45 0f be c9          	movsbl %r9b,%r9d
+  8002ee:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002f2:	48 89 c2             	mov    %rax,%rdx
+  8002f5:	48 b8 51 02 80 00 00 	movabs $0x800251,%rax
+  8002fc:	00 00 00 
+  8002ff:	ff d0                	call   *%rax
+  800301:	48 83 c4 10          	add    $0x10,%rsp
+  800305:	eb 8d                	jmp    800294 <print_num+0x43>
+
+0000000000800307 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800307:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80030b:	48 8b 06             	mov    (%rsi),%rax
+  80030e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800312:	73 0a                	jae    80031e <sprintputch+0x17>
+        *state->start++ = ch;
+  800314:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800318:	48 89 16             	mov    %rdx,(%rsi)
+  80031b:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80031e:	c3                   	ret
+
+000000000080031f <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80031f:	55                   	push   %rbp
+  800320:	48 89 e5             	mov    %rsp,%rbp
+  800323:	48 83 ec 50          	sub    $0x50,%rsp
+  800327:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80032b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80032f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800333:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80033a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80033e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800342:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800346:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80034a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80034e:	48 b8 5c 03 80 00 00 	movabs $0x80035c,%rax
+  800355:	00 00 00 
+  800358:	ff d0                	call   *%rax
+}
+  80035a:	c9                   	leave
+  80035b:	c3                   	ret
+
+000000000080035c <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80035c:	55                   	push   %rbp
+  80035d:	48 89 e5             	mov    %rsp,%rbp
+  800360:	41 57                	push   %r15
+  800362:	41 56                	push   %r14
+  800364:	41 55                	push   %r13
+  800366:	41 54                	push   %r12
+  800368:	53                   	push   %rbx
+  800369:	48 83 ec 38          	sub    $0x38,%rsp
+  80036d:	49 89 fe             	mov    %rdi,%r14
+  800370:	49 89 f5             	mov    %rsi,%r13
+  800373:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800376:	48 8b 01             	mov    (%rcx),%rax
+  800379:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80037d:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800381:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800385:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800389:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80038d:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800391:	0f b6 3b             	movzbl (%rbx),%edi
+  800394:	40 80 ff 25          	cmp    $0x25,%dil
+  800398:	74 18                	je     8003b2 <vprintfmt+0x56>
+            if (!ch) return;
+  80039a:	40 84 ff             	test   %dil,%dil
+  80039d:	0f 84 b1 06 00 00    	je     800a54 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003a3:	40 0f b6 ff          	movzbl %dil,%edi
+  8003a7:	4c 89 ee             	mov    %r13,%rsi
+  8003aa:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8003ad:	4c 89 e3             	mov    %r12,%rbx
+  8003b0:	eb db                	jmp    80038d <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8003b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8003b7:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8003bb:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8003c0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003c6:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003cd:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003d1:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003d6:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003db:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003de:	83 e8 23             	sub    $0x23,%eax
+  8003e1:	3c 57                	cmp    $0x57,%al
+  8003e3:	0f 87 51 06 00 00    	ja     800a3a <vprintfmt+0x6de>
+  8003e9:	0f b6 c0             	movzbl %al,%eax
+  8003ec:	48 b9 c0 32 80 00 00 	movabs $0x8032c0,%rcx
+  8003f3:	00 00 00 
+  8003f6:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003f9:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003fc:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800400:	eb cf                	jmp    8003d1 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800402:	49 89 dc             	mov    %rbx,%r12
+  800405:	be 01 00 00 00       	mov    $0x1,%esi
+  80040a:	eb c5                	jmp    8003d1 <vprintfmt+0x75>
+            padc = ch;
+  80040c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800410:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800413:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800416:	eb b9                	jmp    8003d1 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800418:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80041b:	83 f8 2f             	cmp    $0x2f,%eax
+  80041e:	77 24                	ja     800444 <vprintfmt+0xe8>
+  800420:	89 c1                	mov    %eax,%ecx
+  800422:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800426:	83 c0 08             	add    $0x8,%eax
+  800429:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80042c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80042f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800432:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800436:	79 99                	jns    8003d1 <vprintfmt+0x75>
+                width = precision;
+  800438:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80043c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800442:	eb 8d                	jmp    8003d1 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800444:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800448:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80044c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800450:	eb da                	jmp    80042c <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800452:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800457:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80045b:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800461:	3c 39                	cmp    $0x39,%al
+  800463:	77 1c                	ja     800481 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800465:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800469:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80046d:	0f b6 c0             	movzbl %al,%eax
+  800470:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800475:	0f b6 03             	movzbl (%rbx),%eax
+  800478:	3c 39                	cmp    $0x39,%al
+  80047a:	76 e9                	jbe    800465 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80047c:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80047f:	eb b1                	jmp    800432 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800481:	49 89 dc             	mov    %rbx,%r12
+  800484:	eb ac                	jmp    800432 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800486:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800489:	85 c9                	test   %ecx,%ecx
+  80048b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800490:	0f 49 c1             	cmovns %ecx,%eax
+  800493:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800496:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800499:	e9 33 ff ff ff       	jmp    8003d1 <vprintfmt+0x75>
+            lflag++;
+  80049e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004a1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004a4:	e9 28 ff ff ff       	jmp    8003d1 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8004af:	77 19                	ja     8004ca <vprintfmt+0x16e>
+  8004b1:	89 c2                	mov    %eax,%edx
+  8004b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004b7:	83 c0 08             	add    $0x8,%eax
+  8004ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004bd:	8b 3a                	mov    (%rdx),%edi
+  8004bf:	4c 89 ee             	mov    %r13,%rsi
+  8004c2:	41 ff d6             	call   *%r14
+            break;
+  8004c5:	e9 c3 fe ff ff       	jmp    80038d <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004d6:	eb e5                	jmp    8004bd <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004db:	83 f8 2f             	cmp    $0x2f,%eax
+  8004de:	77 5a                	ja     80053a <vprintfmt+0x1de>
+  8004e0:	89 c2                	mov    %eax,%edx
+  8004e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004e6:	83 c0 08             	add    $0x8,%eax
+  8004e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004ec:	8b 02                	mov    (%rdx),%eax
+  8004ee:	89 c1                	mov    %eax,%ecx
+  8004f0:	f7 d9                	neg    %ecx
+  8004f2:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004f5:	83 f9 15             	cmp    $0x15,%ecx
+  8004f8:	7f 4e                	jg     800548 <vprintfmt+0x1ec>
+  8004fa:	48 63 c1             	movslq %ecx,%rax
+  8004fd:	48 ba 80 35 80 00 00 	movabs $0x803580,%rdx
+  800504:	00 00 00 
+  800507:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80050b:	48 85 c0             	test   %rax,%rax
+  80050e:	74 38                	je     800548 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800510:	48 89 c1             	mov    %rax,%rcx
+  800513:	48 ba 69 37 80 00 00 	movabs $0x803769,%rdx
+  80051a:	00 00 00 
+  80051d:	4c 89 ee             	mov    %r13,%rsi
+  800520:	4c 89 f7             	mov    %r14,%rdi
+  800523:	b8 00 00 00 00       	mov    $0x0,%eax
+  800528:	49 b8 1f 03 80 00 00 	movabs $0x80031f,%r8
+  80052f:	00 00 00 
+  800532:	41 ff d0             	call   *%r8
+  800535:	e9 53 fe ff ff       	jmp    80038d <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80053a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80053e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800542:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800546:	eb a4                	jmp    8004ec <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800548:	48 ba 28 31 80 00 00 	movabs $0x803128,%rdx
+  80054f:	00 00 00 
+  800552:	4c 89 ee             	mov    %r13,%rsi
+  800555:	4c 89 f7             	mov    %r14,%rdi
+  800558:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055d:	49 b8 1f 03 80 00 00 	movabs $0x80031f,%r8
+  800564:	00 00 00 
+  800567:	41 ff d0             	call   *%r8
+  80056a:	e9 1e fe ff ff       	jmp    80038d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80056f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800572:	83 f8 2f             	cmp    $0x2f,%eax
+  800575:	77 6c                	ja     8005e3 <vprintfmt+0x287>
+  800577:	89 c2                	mov    %eax,%edx
+  800579:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80057d:	83 c0 08             	add    $0x8,%eax
+  800580:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800583:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800586:	48 85 d2             	test   %rdx,%rdx
+  800589:	48 b8 21 31 80 00 00 	movabs $0x803121,%rax
+  800590:	00 00 00 
+  800593:	48 0f 45 c2          	cmovne %rdx,%rax
+  800597:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80059b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80059f:	7e 06                	jle    8005a7 <vprintfmt+0x24b>
+  8005a1:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005a5:	75 4a                	jne    8005f1 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005a7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005ab:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8005af:	0f b6 00             	movzbl (%rax),%eax
+  8005b2:	84 c0                	test   %al,%al
+  8005b4:	0f 85 9a 00 00 00    	jne    800654 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8005ba:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005bd:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8005c1:	85 c0                	test   %eax,%eax
+  8005c3:	0f 8e c4 fd ff ff    	jle    80038d <vprintfmt+0x31>
+  8005c9:	4c 89 ee             	mov    %r13,%rsi
+  8005cc:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005d1:	41 ff d6             	call   *%r14
+  8005d4:	41 83 ec 01          	sub    $0x1,%r12d
+  8005d8:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005dc:	75 eb                	jne    8005c9 <vprintfmt+0x26d>
+  8005de:	e9 aa fd ff ff       	jmp    80038d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005ef:	eb 92                	jmp    800583 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005f1:	49 63 f7             	movslq %r15d,%rsi
+  8005f4:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005f8:	48 b8 0e 0b 80 00 00 	movabs $0x800b0e,%rax
+  8005ff:	00 00 00 
+  800602:	ff d0                	call   *%rax
+  800604:	48 89 c2             	mov    %rax,%rdx
+  800607:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80060a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80060c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80060f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800612:	85 c0                	test   %eax,%eax
+  800614:	7e 91                	jle    8005a7 <vprintfmt+0x24b>
+  800616:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80061b:	4c 89 ee             	mov    %r13,%rsi
+  80061e:	44 89 e7             	mov    %r12d,%edi
+  800621:	41 ff d6             	call   *%r14
+  800624:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800628:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80062b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80062e:	75 eb                	jne    80061b <vprintfmt+0x2bf>
+  800630:	e9 72 ff ff ff       	jmp    8005a7 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800635:	0f b6 f8             	movzbl %al,%edi
+  800638:	4c 89 ee             	mov    %r13,%rsi
+  80063b:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80063e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800642:	49 83 c4 01          	add    $0x1,%r12
+  800646:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80064c:	84 c0                	test   %al,%al
+  80064e:	0f 84 66 ff ff ff    	je     8005ba <vprintfmt+0x25e>
+  800654:	45 85 ff             	test   %r15d,%r15d
+  800657:	78 0a                	js     800663 <vprintfmt+0x307>
+  800659:	41 83 ef 01          	sub    $0x1,%r15d
+  80065d:	0f 88 57 ff ff ff    	js     8005ba <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800663:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800667:	74 cc                	je     800635 <vprintfmt+0x2d9>
+  800669:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80066c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800671:	80 fa 5e             	cmp    $0x5e,%dl
+  800674:	77 c2                	ja     800638 <vprintfmt+0x2dc>
+  800676:	eb bd                	jmp    800635 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800678:	40 84 f6             	test   %sil,%sil
+  80067b:	75 26                	jne    8006a3 <vprintfmt+0x347>
+    switch (lflag) {
+  80067d:	85 d2                	test   %edx,%edx
+  80067f:	74 59                	je     8006da <vprintfmt+0x37e>
+  800681:	83 fa 01             	cmp    $0x1,%edx
+  800684:	74 7b                	je     800701 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800686:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800689:	83 f8 2f             	cmp    $0x2f,%eax
+  80068c:	0f 87 96 00 00 00    	ja     800728 <vprintfmt+0x3cc>
+  800692:	89 c2                	mov    %eax,%edx
+  800694:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800698:	83 c0 08             	add    $0x8,%eax
+  80069b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80069e:	4c 8b 22             	mov    (%rdx),%r12
+  8006a1:	eb 17                	jmp    8006ba <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a9:	77 21                	ja     8006cc <vprintfmt+0x370>
+  8006ab:	89 c2                	mov    %eax,%edx
+  8006ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b1:	83 c0 08             	add    $0x8,%eax
+  8006b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b7:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8006ba:	4d 85 e4             	test   %r12,%r12
+  8006bd:	78 7a                	js     800739 <vprintfmt+0x3dd>
+            num = i;
+  8006bf:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8006c2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8006c7:	e9 50 02 00 00       	jmp    80091c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8006cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d8:	eb dd                	jmp    8006b7 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e0:	77 11                	ja     8006f3 <vprintfmt+0x397>
+  8006e2:	89 c2                	mov    %eax,%edx
+  8006e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e8:	83 c0 08             	add    $0x8,%eax
+  8006eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ee:	4c 63 22             	movslq (%rdx),%r12
+  8006f1:	eb c7                	jmp    8006ba <vprintfmt+0x35e>
+  8006f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ff:	eb ed                	jmp    8006ee <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800701:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800704:	83 f8 2f             	cmp    $0x2f,%eax
+  800707:	77 11                	ja     80071a <vprintfmt+0x3be>
+  800709:	89 c2                	mov    %eax,%edx
+  80070b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80070f:	83 c0 08             	add    $0x8,%eax
+  800712:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800715:	4c 8b 22             	mov    (%rdx),%r12
+  800718:	eb a0                	jmp    8006ba <vprintfmt+0x35e>
+  80071a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80071e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800722:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800726:	eb ed                	jmp    800715 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800728:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80072c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800730:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800734:	e9 65 ff ff ff       	jmp    80069e <vprintfmt+0x342>
+                putch('-', put_arg);
+  800739:	4c 89 ee             	mov    %r13,%rsi
+  80073c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800741:	41 ff d6             	call   *%r14
+                i = -i;
+  800744:	49 f7 dc             	neg    %r12
+  800747:	e9 73 ff ff ff       	jmp    8006bf <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80074c:	40 84 f6             	test   %sil,%sil
+  80074f:	75 32                	jne    800783 <vprintfmt+0x427>
+    switch (lflag) {
+  800751:	85 d2                	test   %edx,%edx
+  800753:	74 5d                	je     8007b2 <vprintfmt+0x456>
+  800755:	83 fa 01             	cmp    $0x1,%edx
+  800758:	0f 84 82 00 00 00    	je     8007e0 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80075e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800761:	83 f8 2f             	cmp    $0x2f,%eax
+  800764:	0f 87 a5 00 00 00    	ja     80080f <vprintfmt+0x4b3>
+  80076a:	89 c2                	mov    %eax,%edx
+  80076c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800770:	83 c0 08             	add    $0x8,%eax
+  800773:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800776:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800779:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80077e:	e9 99 01 00 00       	jmp    80091c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800783:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800786:	83 f8 2f             	cmp    $0x2f,%eax
+  800789:	77 19                	ja     8007a4 <vprintfmt+0x448>
+  80078b:	89 c2                	mov    %eax,%edx
+  80078d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800791:	83 c0 08             	add    $0x8,%eax
+  800794:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800797:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80079a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80079f:	e9 78 01 00 00       	jmp    80091c <vprintfmt+0x5c0>
+  8007a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b0:	eb e5                	jmp    800797 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8007b2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b8:	77 18                	ja     8007d2 <vprintfmt+0x476>
+  8007ba:	89 c2                	mov    %eax,%edx
+  8007bc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c0:	83 c0 08             	add    $0x8,%eax
+  8007c3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c6:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8007c8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007cd:	e9 4a 01 00 00       	jmp    80091c <vprintfmt+0x5c0>
+  8007d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007de:	eb e6                	jmp    8007c6 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e6:	77 19                	ja     800801 <vprintfmt+0x4a5>
+  8007e8:	89 c2                	mov    %eax,%edx
+  8007ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ee:	83 c0 08             	add    $0x8,%eax
+  8007f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007f7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007fc:	e9 1b 01 00 00       	jmp    80091c <vprintfmt+0x5c0>
+  800801:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800805:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800809:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80080d:	eb e5                	jmp    8007f4 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80080f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800813:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800817:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081b:	e9 56 ff ff ff       	jmp    800776 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800820:	40 84 f6             	test   %sil,%sil
+  800823:	75 2e                	jne    800853 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800825:	85 d2                	test   %edx,%edx
+  800827:	74 59                	je     800882 <vprintfmt+0x526>
+  800829:	83 fa 01             	cmp    $0x1,%edx
+  80082c:	74 7f                	je     8008ad <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80082e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800831:	83 f8 2f             	cmp    $0x2f,%eax
+  800834:	0f 87 9f 00 00 00    	ja     8008d9 <vprintfmt+0x57d>
+  80083a:	89 c2                	mov    %eax,%edx
+  80083c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800840:	83 c0 08             	add    $0x8,%eax
+  800843:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800846:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800849:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80084e:	e9 c9 00 00 00       	jmp    80091c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800853:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800856:	83 f8 2f             	cmp    $0x2f,%eax
+  800859:	77 19                	ja     800874 <vprintfmt+0x518>
+  80085b:	89 c2                	mov    %eax,%edx
+  80085d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800861:	83 c0 08             	add    $0x8,%eax
+  800864:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800867:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80086a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80086f:	e9 a8 00 00 00       	jmp    80091c <vprintfmt+0x5c0>
+  800874:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800878:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800880:	eb e5                	jmp    800867 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800882:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800885:	83 f8 2f             	cmp    $0x2f,%eax
+  800888:	77 15                	ja     80089f <vprintfmt+0x543>
+  80088a:	89 c2                	mov    %eax,%edx
+  80088c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800890:	83 c0 08             	add    $0x8,%eax
+  800893:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800896:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800898:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80089d:	eb 7d                	jmp    80091c <vprintfmt+0x5c0>
+  80089f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ab:	eb e9                	jmp    800896 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8008ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b3:	77 16                	ja     8008cb <vprintfmt+0x56f>
+  8008b5:	89 c2                	mov    %eax,%edx
+  8008b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bb:	83 c0 08             	add    $0x8,%eax
+  8008be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008c4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8008c9:	eb 51                	jmp    80091c <vprintfmt+0x5c0>
+  8008cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d7:	eb e8                	jmp    8008c1 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e5:	e9 5c ff ff ff       	jmp    800846 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008ea:	4c 89 ee             	mov    %r13,%rsi
+  8008ed:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008f2:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008f5:	4c 89 ee             	mov    %r13,%rsi
+  8008f8:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008fd:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800900:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800903:	83 f8 2f             	cmp    $0x2f,%eax
+  800906:	77 47                	ja     80094f <vprintfmt+0x5f3>
+  800908:	89 c2                	mov    %eax,%edx
+  80090a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090e:	83 c0 08             	add    $0x8,%eax
+  800911:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800914:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800917:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80091c:	48 83 ec 08          	sub    $0x8,%rsp
+  800920:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800924:	0f 94 c0             	sete   %al
+  800927:	0f b6 c0             	movzbl %al,%eax
+  80092a:	50                   	push   %rax
+  80092b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800930:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800934:	4c 89 ee             	mov    %r13,%rsi
+  800937:	4c 89 f7             	mov    %r14,%rdi
+  80093a:	48 b8 51 02 80 00 00 	movabs $0x800251,%rax
+  800941:	00 00 00 
+  800944:	ff d0                	call   *%rax
+            break;
+  800946:	48 83 c4 10          	add    $0x10,%rsp
+  80094a:	e9 3e fa ff ff       	jmp    80038d <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80094f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800953:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800957:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095b:	eb b7                	jmp    800914 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80095d:	40 84 f6             	test   %sil,%sil
+  800960:	75 2b                	jne    80098d <vprintfmt+0x631>
+    switch (lflag) {
+  800962:	85 d2                	test   %edx,%edx
+  800964:	74 56                	je     8009bc <vprintfmt+0x660>
+  800966:	83 fa 01             	cmp    $0x1,%edx
+  800969:	74 7f                	je     8009ea <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80096b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096e:	83 f8 2f             	cmp    $0x2f,%eax
+  800971:	0f 87 a2 00 00 00    	ja     800a19 <vprintfmt+0x6bd>
+  800977:	89 c2                	mov    %eax,%edx
+  800979:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097d:	83 c0 08             	add    $0x8,%eax
+  800980:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800983:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800986:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80098b:	eb 8f                	jmp    80091c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80098d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800990:	83 f8 2f             	cmp    $0x2f,%eax
+  800993:	77 19                	ja     8009ae <vprintfmt+0x652>
+  800995:	89 c2                	mov    %eax,%edx
+  800997:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099b:	83 c0 08             	add    $0x8,%eax
+  80099e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009a4:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009a9:	e9 6e ff ff ff       	jmp    80091c <vprintfmt+0x5c0>
+  8009ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ba:	eb e5                	jmp    8009a1 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8009bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c2:	77 18                	ja     8009dc <vprintfmt+0x680>
+  8009c4:	89 c2                	mov    %eax,%edx
+  8009c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ca:	83 c0 08             	add    $0x8,%eax
+  8009cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d0:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009d2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009d7:	e9 40 ff ff ff       	jmp    80091c <vprintfmt+0x5c0>
+  8009dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e8:	eb e6                	jmp    8009d0 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f0:	77 19                	ja     800a0b <vprintfmt+0x6af>
+  8009f2:	89 c2                	mov    %eax,%edx
+  8009f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f8:	83 c0 08             	add    $0x8,%eax
+  8009fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a01:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a06:	e9 11 ff ff ff       	jmp    80091c <vprintfmt+0x5c0>
+  800a0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a17:	eb e5                	jmp    8009fe <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a25:	e9 59 ff ff ff       	jmp    800983 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a2a:	4c 89 ee             	mov    %r13,%rsi
+  800a2d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a32:	41 ff d6             	call   *%r14
+            break;
+  800a35:	e9 53 f9 ff ff       	jmp    80038d <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a3a:	4c 89 ee             	mov    %r13,%rsi
+  800a3d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a42:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a45:	48 83 eb 01          	sub    $0x1,%rbx
+  800a49:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a4d:	75 f6                	jne    800a45 <vprintfmt+0x6e9>
+  800a4f:	e9 39 f9 ff ff       	jmp    80038d <vprintfmt+0x31>
+}
+  800a54:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a58:	5b                   	pop    %rbx
+  800a59:	41 5c                	pop    %r12
+  800a5b:	41 5d                	pop    %r13
+  800a5d:	41 5e                	pop    %r14
+  800a5f:	41 5f                	pop    %r15
+  800a61:	5d                   	pop    %rbp
+  800a62:	c3                   	ret
+
+0000000000800a63 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a63:	55                   	push   %rbp
+  800a64:	48 89 e5             	mov    %rsp,%rbp
+  800a67:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a6b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a6f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a74:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a78:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a7f:	48 85 ff             	test   %rdi,%rdi
+  800a82:	74 2b                	je     800aaf <vsnprintf+0x4c>
+  800a84:	48 85 f6             	test   %rsi,%rsi
+  800a87:	74 26                	je     800aaf <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a89:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a8d:	48 bf 07 03 80 00 00 	movabs $0x800307,%rdi
+  800a94:	00 00 00 
+  800a97:	48 b8 5c 03 80 00 00 	movabs $0x80035c,%rax
+  800a9e:	00 00 00 
+  800aa1:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800aa3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aa7:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800aaa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800aad:	c9                   	leave
+  800aae:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800aaf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ab4:	eb f7                	jmp    800aad <vsnprintf+0x4a>
+
+0000000000800ab6 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ab6:	55                   	push   %rbp
+  800ab7:	48 89 e5             	mov    %rsp,%rbp
+  800aba:	48 83 ec 50          	sub    $0x50,%rsp
+  800abe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ac2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ac6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800aca:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ad1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ad5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800add:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ae1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ae5:	48 b8 63 0a 80 00 00 	movabs $0x800a63,%rax
+  800aec:	00 00 00 
+  800aef:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800af1:	c9                   	leave
+  800af2:	c3                   	ret
+
+0000000000800af3 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800af3:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800af6:	74 10                	je     800b08 <strlen+0x15>
+    size_t n = 0;
+  800af8:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800afd:	48 83 c0 01          	add    $0x1,%rax
+  800b01:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b05:	75 f6                	jne    800afd <strlen+0xa>
+  800b07:	c3                   	ret
+    size_t n = 0;
+  800b08:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b0d:	c3                   	ret
+
+0000000000800b0e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b0e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b11:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b16:	48 85 f6             	test   %rsi,%rsi
+  800b19:	74 11                	je     800b2c <strnlen+0x1e>
+  800b1b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b1f:	74 0c                	je     800b2d <strnlen+0x1f>
+  800b21:	48 83 c2 01          	add    $0x1,%rdx
+  800b25:	48 39 d0             	cmp    %rdx,%rax
+  800b28:	75 f1                	jne    800b1b <strnlen+0xd>
+  800b2a:	eb 04                	jmp    800b30 <strnlen+0x22>
+  800b2c:	c3                   	ret
+  800b2d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b30:	c3                   	ret
+
+0000000000800b31 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b31:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b34:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b39:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b3d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b40:	48 83 c2 01          	add    $0x1,%rdx
+  800b44:	84 c9                	test   %cl,%cl
+  800b46:	75 f1                	jne    800b39 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b48:	c3                   	ret
+
+0000000000800b49 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b49:	55                   	push   %rbp
+  800b4a:	48 89 e5             	mov    %rsp,%rbp
+  800b4d:	41 54                	push   %r12
+  800b4f:	53                   	push   %rbx
+  800b50:	48 89 fb             	mov    %rdi,%rbx
+  800b53:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b56:	48 b8 f3 0a 80 00 00 	movabs $0x800af3,%rax
+  800b5d:	00 00 00 
+  800b60:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b62:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b66:	4c 89 e6             	mov    %r12,%rsi
+  800b69:	48 b8 31 0b 80 00 00 	movabs $0x800b31,%rax
+  800b70:	00 00 00 
+  800b73:	ff d0                	call   *%rax
+    return dst;
+}
+  800b75:	48 89 d8             	mov    %rbx,%rax
+  800b78:	5b                   	pop    %rbx
+  800b79:	41 5c                	pop    %r12
+  800b7b:	5d                   	pop    %rbp
+  800b7c:	c3                   	ret
+
+0000000000800b7d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b7d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b80:	48 85 d2             	test   %rdx,%rdx
+  800b83:	74 1f                	je     800ba4 <strncpy+0x27>
+  800b85:	48 01 fa             	add    %rdi,%rdx
+  800b88:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b8b:	48 83 c1 01          	add    $0x1,%rcx
+  800b8f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b93:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b97:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b9b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b9f:	48 39 ca             	cmp    %rcx,%rdx
+  800ba2:	75 e7                	jne    800b8b <strncpy+0xe>
+    }
+    return ret;
+}
+  800ba4:	c3                   	ret
+
+0000000000800ba5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ba5:	48 89 f8             	mov    %rdi,%rax
+  800ba8:	48 85 d2             	test   %rdx,%rdx
+  800bab:	74 24                	je     800bd1 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bad:	48 83 ea 01          	sub    $0x1,%rdx
+  800bb1:	74 1b                	je     800bce <strlcpy+0x29>
+  800bb3:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800bb7:	0f b6 16             	movzbl (%rsi),%edx
+  800bba:	84 d2                	test   %dl,%dl
+  800bbc:	74 10                	je     800bce <strlcpy+0x29>
+            *dst++ = *src++;
+  800bbe:	48 83 c6 01          	add    $0x1,%rsi
+  800bc2:	48 83 c0 01          	add    $0x1,%rax
+  800bc6:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800bc9:	48 39 c8             	cmp    %rcx,%rax
+  800bcc:	75 e9                	jne    800bb7 <strlcpy+0x12>
+        *dst = '\0';
+  800bce:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bd1:	48 29 f8             	sub    %rdi,%rax
+}
+  800bd4:	c3                   	ret
+
+0000000000800bd5 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800bd5:	0f b6 07             	movzbl (%rdi),%eax
+  800bd8:	84 c0                	test   %al,%al
+  800bda:	74 13                	je     800bef <strcmp+0x1a>
+  800bdc:	38 06                	cmp    %al,(%rsi)
+  800bde:	75 0f                	jne    800bef <strcmp+0x1a>
+  800be0:	48 83 c7 01          	add    $0x1,%rdi
+  800be4:	48 83 c6 01          	add    $0x1,%rsi
+  800be8:	0f b6 07             	movzbl (%rdi),%eax
+  800beb:	84 c0                	test   %al,%al
+  800bed:	75 ed                	jne    800bdc <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bef:	0f b6 c0             	movzbl %al,%eax
+  800bf2:	0f b6 16             	movzbl (%rsi),%edx
+  800bf5:	29 d0                	sub    %edx,%eax
+}
+  800bf7:	c3                   	ret
+
+0000000000800bf8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bf8:	48 85 d2             	test   %rdx,%rdx
+  800bfb:	74 1f                	je     800c1c <strncmp+0x24>
+  800bfd:	0f b6 07             	movzbl (%rdi),%eax
+  800c00:	84 c0                	test   %al,%al
+  800c02:	74 1e                	je     800c22 <strncmp+0x2a>
+  800c04:	3a 06                	cmp    (%rsi),%al
+  800c06:	75 1a                	jne    800c22 <strncmp+0x2a>
+  800c08:	48 83 c7 01          	add    $0x1,%rdi
+  800c0c:	48 83 c6 01          	add    $0x1,%rsi
+  800c10:	48 83 ea 01          	sub    $0x1,%rdx
+  800c14:	75 e7                	jne    800bfd <strncmp+0x5>
+
+    if (!n) return 0;
+  800c16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1b:	c3                   	ret
+  800c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c21:	c3                   	ret
+  800c22:	48 85 d2             	test   %rdx,%rdx
+  800c25:	74 09                	je     800c30 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c27:	0f b6 07             	movzbl (%rdi),%eax
+  800c2a:	0f b6 16             	movzbl (%rsi),%edx
+  800c2d:	29 d0                	sub    %edx,%eax
+  800c2f:	c3                   	ret
+    if (!n) return 0;
+  800c30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c35:	c3                   	ret
+
+0000000000800c36 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c36:	0f b6 17             	movzbl (%rdi),%edx
+  800c39:	84 d2                	test   %dl,%dl
+  800c3b:	74 18                	je     800c55 <strchr+0x1f>
+        if (*str == c) {
+  800c3d:	0f be d2             	movsbl %dl,%edx
+  800c40:	39 f2                	cmp    %esi,%edx
+  800c42:	74 17                	je     800c5b <strchr+0x25>
+    for (; *str; str++) {
+  800c44:	48 83 c7 01          	add    $0x1,%rdi
+  800c48:	0f b6 17             	movzbl (%rdi),%edx
+  800c4b:	84 d2                	test   %dl,%dl
+  800c4d:	75 ee                	jne    800c3d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c54:	c3                   	ret
+  800c55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5a:	c3                   	ret
+  800c5b:	48 89 f8             	mov    %rdi,%rax
+}
+  800c5e:	c3                   	ret
+
+0000000000800c5f <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c5f:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c62:	0f b6 17             	movzbl (%rdi),%edx
+  800c65:	84 d2                	test   %dl,%dl
+  800c67:	74 13                	je     800c7c <strfind+0x1d>
+  800c69:	0f be d2             	movsbl %dl,%edx
+  800c6c:	39 f2                	cmp    %esi,%edx
+  800c6e:	74 0b                	je     800c7b <strfind+0x1c>
+  800c70:	48 83 c0 01          	add    $0x1,%rax
+  800c74:	0f b6 10             	movzbl (%rax),%edx
+  800c77:	84 d2                	test   %dl,%dl
+  800c79:	75 ee                	jne    800c69 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c7b:	c3                   	ret
+  800c7c:	c3                   	ret
+
+0000000000800c7d <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c7d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c80:	48 89 f8             	mov    %rdi,%rax
+  800c83:	48 f7 d8             	neg    %rax
+  800c86:	83 e0 07             	and    $0x7,%eax
+  800c89:	49 89 d1             	mov    %rdx,%r9
+  800c8c:	49 29 c1             	sub    %rax,%r9
+  800c8f:	78 36                	js     800cc7 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c91:	40 0f b6 c6          	movzbl %sil,%eax
+  800c95:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c9c:	01 01 01 
+  800c9f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ca3:	40 f6 c7 07          	test   $0x7,%dil
+  800ca7:	75 38                	jne    800ce1 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ca9:	4c 89 c9             	mov    %r9,%rcx
+  800cac:	48 c1 f9 03          	sar    $0x3,%rcx
+  800cb0:	74 0c                	je     800cbe <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800cb2:	fc                   	cld
+  800cb3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800cb6:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800cba:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800cbe:	4d 85 c9             	test   %r9,%r9
+  800cc1:	75 45                	jne    800d08 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800cc3:	4c 89 c0             	mov    %r8,%rax
+  800cc6:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800cc7:	48 85 d2             	test   %rdx,%rdx
+  800cca:	74 f7                	je     800cc3 <memset+0x46>
+  800ccc:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ccf:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800cd2:	48 83 c0 01          	add    $0x1,%rax
+  800cd6:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800cda:	48 39 c2             	cmp    %rax,%rdx
+  800cdd:	75 f3                	jne    800cd2 <memset+0x55>
+  800cdf:	eb e2                	jmp    800cc3 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ce1:	40 f6 c7 01          	test   $0x1,%dil
+  800ce5:	74 06                	je     800ced <memset+0x70>
+  800ce7:	88 07                	mov    %al,(%rdi)
+  800ce9:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ced:	40 f6 c7 02          	test   $0x2,%dil
+  800cf1:	74 07                	je     800cfa <memset+0x7d>
+  800cf3:	66 89 07             	mov    %ax,(%rdi)
+  800cf6:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cfa:	40 f6 c7 04          	test   $0x4,%dil
+  800cfe:	74 a9                	je     800ca9 <memset+0x2c>
+  800d00:	89 07                	mov    %eax,(%rdi)
+  800d02:	48 83 c7 04          	add    $0x4,%rdi
+  800d06:	eb a1                	jmp    800ca9 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d08:	41 f6 c1 04          	test   $0x4,%r9b
+  800d0c:	74 06                	je     800d14 <memset+0x97>
+  800d0e:	89 07                	mov    %eax,(%rdi)
+  800d10:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d14:	41 f6 c1 02          	test   $0x2,%r9b
+  800d18:	74 07                	je     800d21 <memset+0xa4>
+  800d1a:	66 89 07             	mov    %ax,(%rdi)
+  800d1d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d21:	41 f6 c1 01          	test   $0x1,%r9b
+  800d25:	74 9c                	je     800cc3 <memset+0x46>
+  800d27:	88 07                	mov    %al,(%rdi)
+  800d29:	eb 98                	jmp    800cc3 <memset+0x46>
+
+0000000000800d2b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d2b:	48 89 f8             	mov    %rdi,%rax
+  800d2e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d31:	48 39 fe             	cmp    %rdi,%rsi
+  800d34:	73 3b                	jae    800d71 <memmove+0x46>
+  800d36:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d3a:	48 39 d7             	cmp    %rdx,%rdi
+  800d3d:	73 32                	jae    800d71 <memmove+0x46>
+        s += n;
+        d += n;
+  800d3f:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d43:	48 89 d6             	mov    %rdx,%rsi
+  800d46:	48 09 fe             	or     %rdi,%rsi
+  800d49:	48 09 ce             	or     %rcx,%rsi
+  800d4c:	40 f6 c6 07          	test   $0x7,%sil
+  800d50:	75 12                	jne    800d64 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d52:	48 83 ef 08          	sub    $0x8,%rdi
+  800d56:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d5a:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d5e:	fd                   	std
+  800d5f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d62:	fc                   	cld
+  800d63:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d64:	48 83 ef 01          	sub    $0x1,%rdi
+  800d68:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d6c:	fd                   	std
+  800d6d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d6f:	eb f1                	jmp    800d62 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d71:	48 89 f2             	mov    %rsi,%rdx
+  800d74:	48 09 c2             	or     %rax,%rdx
+  800d77:	48 09 ca             	or     %rcx,%rdx
+  800d7a:	f6 c2 07             	test   $0x7,%dl
+  800d7d:	75 0c                	jne    800d8b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d7f:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d83:	48 89 c7             	mov    %rax,%rdi
+  800d86:	fc                   	cld
+  800d87:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d8a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d8b:	48 89 c7             	mov    %rax,%rdi
+  800d8e:	fc                   	cld
+  800d8f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d91:	c3                   	ret
+
+0000000000800d92 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d92:	55                   	push   %rbp
+  800d93:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d96:	48 b8 2b 0d 80 00 00 	movabs $0x800d2b,%rax
+  800d9d:	00 00 00 
+  800da0:	ff d0                	call   *%rax
+}
+  800da2:	5d                   	pop    %rbp
+  800da3:	c3                   	ret
+
+0000000000800da4 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800da4:	55                   	push   %rbp
+  800da5:	48 89 e5             	mov    %rsp,%rbp
+  800da8:	41 57                	push   %r15
+  800daa:	41 56                	push   %r14
+  800dac:	41 55                	push   %r13
+  800dae:	41 54                	push   %r12
+  800db0:	53                   	push   %rbx
+  800db1:	48 83 ec 08          	sub    $0x8,%rsp
+  800db5:	49 89 fe             	mov    %rdi,%r14
+  800db8:	49 89 f7             	mov    %rsi,%r15
+  800dbb:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800dbe:	48 89 f7             	mov    %rsi,%rdi
+  800dc1:	48 b8 f3 0a 80 00 00 	movabs $0x800af3,%rax
+  800dc8:	00 00 00 
+  800dcb:	ff d0                	call   *%rax
+  800dcd:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800dd0:	48 89 de             	mov    %rbx,%rsi
+  800dd3:	4c 89 f7             	mov    %r14,%rdi
+  800dd6:	48 b8 0e 0b 80 00 00 	movabs $0x800b0e,%rax
+  800ddd:	00 00 00 
+  800de0:	ff d0                	call   *%rax
+  800de2:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800de5:	48 39 c3             	cmp    %rax,%rbx
+  800de8:	74 36                	je     800e20 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800dea:	48 89 d8             	mov    %rbx,%rax
+  800ded:	4c 29 e8             	sub    %r13,%rax
+  800df0:	49 39 c4             	cmp    %rax,%r12
+  800df3:	73 31                	jae    800e26 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800df5:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dfa:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dfe:	4c 89 fe             	mov    %r15,%rsi
+  800e01:	48 b8 92 0d 80 00 00 	movabs $0x800d92,%rax
+  800e08:	00 00 00 
+  800e0b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e0d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e11:	48 83 c4 08          	add    $0x8,%rsp
+  800e15:	5b                   	pop    %rbx
+  800e16:	41 5c                	pop    %r12
+  800e18:	41 5d                	pop    %r13
+  800e1a:	41 5e                	pop    %r14
+  800e1c:	41 5f                	pop    %r15
+  800e1e:	5d                   	pop    %rbp
+  800e1f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e20:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e24:	eb eb                	jmp    800e11 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e26:	48 83 eb 01          	sub    $0x1,%rbx
+  800e2a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e2e:	48 89 da             	mov    %rbx,%rdx
+  800e31:	4c 89 fe             	mov    %r15,%rsi
+  800e34:	48 b8 92 0d 80 00 00 	movabs $0x800d92,%rax
+  800e3b:	00 00 00 
+  800e3e:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e40:	49 01 de             	add    %rbx,%r14
+  800e43:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e48:	eb c3                	jmp    800e0d <strlcat+0x69>
+
+0000000000800e4a <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e4a:	48 85 d2             	test   %rdx,%rdx
+  800e4d:	74 2d                	je     800e7c <memcmp+0x32>
+  800e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e54:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e58:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e5d:	44 38 c1             	cmp    %r8b,%cl
+  800e60:	75 0f                	jne    800e71 <memcmp+0x27>
+    while (n-- > 0) {
+  800e62:	48 83 c0 01          	add    $0x1,%rax
+  800e66:	48 39 c2             	cmp    %rax,%rdx
+  800e69:	75 e9                	jne    800e54 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e70:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e71:	0f b6 c1             	movzbl %cl,%eax
+  800e74:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e78:	44 29 c0             	sub    %r8d,%eax
+  800e7b:	c3                   	ret
+    return 0;
+  800e7c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e81:	c3                   	ret
+
+0000000000800e82 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e82:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e86:	48 39 c7             	cmp    %rax,%rdi
+  800e89:	73 0f                	jae    800e9a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e8b:	40 38 37             	cmp    %sil,(%rdi)
+  800e8e:	74 0e                	je     800e9e <memfind+0x1c>
+    for (; src < end; src++) {
+  800e90:	48 83 c7 01          	add    $0x1,%rdi
+  800e94:	48 39 f8             	cmp    %rdi,%rax
+  800e97:	75 f2                	jne    800e8b <memfind+0x9>
+  800e99:	c3                   	ret
+  800e9a:	48 89 f8             	mov    %rdi,%rax
+  800e9d:	c3                   	ret
+  800e9e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800ea1:	c3                   	ret
+
+0000000000800ea2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800ea2:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800ea5:	0f b6 37             	movzbl (%rdi),%esi
+  800ea8:	40 80 fe 20          	cmp    $0x20,%sil
+  800eac:	74 06                	je     800eb4 <strtol+0x12>
+  800eae:	40 80 fe 09          	cmp    $0x9,%sil
+  800eb2:	75 13                	jne    800ec7 <strtol+0x25>
+  800eb4:	48 83 c7 01          	add    $0x1,%rdi
+  800eb8:	0f b6 37             	movzbl (%rdi),%esi
+  800ebb:	40 80 fe 20          	cmp    $0x20,%sil
+  800ebf:	74 f3                	je     800eb4 <strtol+0x12>
+  800ec1:	40 80 fe 09          	cmp    $0x9,%sil
+  800ec5:	74 ed                	je     800eb4 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800ec7:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800eca:	83 e0 fd             	and    $0xfffffffd,%eax
+  800ecd:	3c 01                	cmp    $0x1,%al
+  800ecf:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ed3:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ed9:	75 0f                	jne    800eea <strtol+0x48>
+  800edb:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ede:	74 14                	je     800ef4 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ee0:	85 d2                	test   %edx,%edx
+  800ee2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ee7:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800eea:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800eef:	4c 63 ca             	movslq %edx,%r9
+  800ef2:	eb 36                	jmp    800f2a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ef4:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ef8:	74 0f                	je     800f09 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800efa:	85 d2                	test   %edx,%edx
+  800efc:	75 ec                	jne    800eea <strtol+0x48>
+        s++;
+  800efe:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f02:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f07:	eb e1                	jmp    800eea <strtol+0x48>
+        s += 2;
+  800f09:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f0d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f12:	eb d6                	jmp    800eea <strtol+0x48>
+            dig -= '0';
+  800f14:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f17:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f1b:	41 39 d0             	cmp    %edx,%r8d
+  800f1e:	7d 21                	jge    800f41 <strtol+0x9f>
+        val = val * base + dig;
+  800f20:	49 0f af c1          	imul   %r9,%rax
+  800f24:	0f b6 c9             	movzbl %cl,%ecx
+  800f27:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f2a:	48 83 c7 01          	add    $0x1,%rdi
+  800f2e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f32:	80 f9 39             	cmp    $0x39,%cl
+  800f35:	76 dd                	jbe    800f14 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f37:	80 f9 7b             	cmp    $0x7b,%cl
+  800f3a:	77 05                	ja     800f41 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f3c:	83 e9 57             	sub    $0x57,%ecx
+  800f3f:	eb d6                	jmp    800f17 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f41:	4d 85 d2             	test   %r10,%r10
+  800f44:	74 03                	je     800f49 <strtol+0xa7>
+  800f46:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f49:	48 89 c2             	mov    %rax,%rdx
+  800f4c:	48 f7 da             	neg    %rdx
+  800f4f:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f53:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f57:	c3                   	ret
+
+0000000000800f58 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f58:	55                   	push   %rbp
+  800f59:	48 89 e5             	mov    %rsp,%rbp
+  800f5c:	53                   	push   %rbx
+  800f5d:	48 89 fa             	mov    %rdi,%rdx
+  800f60:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f63:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f72:	be 00 00 00 00       	mov    $0x0,%esi
+  800f77:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f7d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f83:	c9                   	leave
+  800f84:	c3                   	ret
+
+0000000000800f85 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f85:	55                   	push   %rbp
+  800f86:	48 89 e5             	mov    %rsp,%rbp
+  800f89:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f8a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f94:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f99:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fa3:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fae:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800fb0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fb4:	c9                   	leave
+  800fb5:	c3                   	ret
+
+0000000000800fb6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800fb6:	55                   	push   %rbp
+  800fb7:	48 89 e5             	mov    %rsp,%rbp
+  800fba:	53                   	push   %rbx
+  800fbb:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800fbf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800fc2:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fc7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fd6:	be 00 00 00 00       	mov    $0x0,%esi
+  800fdb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fe1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800fe3:	48 85 c0             	test   %rax,%rax
+  800fe6:	7f 06                	jg     800fee <sys_env_destroy+0x38>
+}
+  800fe8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fec:	c9                   	leave
+  800fed:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fee:	49 89 c0             	mov    %rax,%r8
+  800ff1:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800ff6:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  800ffd:	00 00 00 
+  801000:	be 26 00 00 00       	mov    $0x26,%esi
+  801005:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  80100c:	00 00 00 
+  80100f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801014:	49 b9 b0 2e 80 00 00 	movabs $0x802eb0,%r9
+  80101b:	00 00 00 
+  80101e:	41 ff d1             	call   *%r9
+
+0000000000801021 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801021:	55                   	push   %rbp
+  801022:	48 89 e5             	mov    %rsp,%rbp
+  801025:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801026:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80102b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801030:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801035:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80103f:	be 00 00 00 00       	mov    $0x0,%esi
+  801044:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80104a:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80104c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801050:	c9                   	leave
+  801051:	c3                   	ret
+
+0000000000801052 <sys_yield>:
+
+void
+sys_yield(void) {
+  801052:	55                   	push   %rbp
+  801053:	48 89 e5             	mov    %rsp,%rbp
+  801056:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801057:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80105c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801061:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801066:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801070:	be 00 00 00 00       	mov    $0x0,%esi
+  801075:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80107b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80107d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801081:	c9                   	leave
+  801082:	c3                   	ret
+
+0000000000801083 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801083:	55                   	push   %rbp
+  801084:	48 89 e5             	mov    %rsp,%rbp
+  801087:	53                   	push   %rbx
+  801088:	48 89 fa             	mov    %rdi,%rdx
+  80108b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80108e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801093:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80109a:	00 00 00 
+  80109d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010ad:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8010af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010b3:	c9                   	leave
+  8010b4:	c3                   	ret
+
+00000000008010b5 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8010b5:	55                   	push   %rbp
+  8010b6:	48 89 e5             	mov    %rsp,%rbp
+  8010b9:	53                   	push   %rbx
+  8010ba:	49 89 f8             	mov    %rdi,%r8
+  8010bd:	48 89 d3             	mov    %rdx,%rbx
+  8010c0:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010c3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c8:	4c 89 c2             	mov    %r8,%rdx
+  8010cb:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010d9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8010db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010df:	c9                   	leave
+  8010e0:	c3                   	ret
+
+00000000008010e1 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8010e1:	55                   	push   %rbp
+  8010e2:	48 89 e5             	mov    %rsp,%rbp
+  8010e5:	53                   	push   %rbx
+  8010e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8010ea:	89 f8                	mov    %edi,%eax
+  8010ec:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010ef:	48 63 f9             	movslq %ecx,%rdi
+  8010f2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f5:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010fa:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801102:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801108:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80110a:	48 85 c0             	test   %rax,%rax
+  80110d:	7f 06                	jg     801115 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80110f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801113:	c9                   	leave
+  801114:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801115:	49 89 c0             	mov    %rax,%r8
+  801118:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80111d:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801124:	00 00 00 
+  801127:	be 26 00 00 00       	mov    $0x26,%esi
+  80112c:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801133:	00 00 00 
+  801136:	b8 00 00 00 00       	mov    $0x0,%eax
+  80113b:	49 b9 b0 2e 80 00 00 	movabs $0x802eb0,%r9
+  801142:	00 00 00 
+  801145:	41 ff d1             	call   *%r9
+
+0000000000801148 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801148:	55                   	push   %rbp
+  801149:	48 89 e5             	mov    %rsp,%rbp
+  80114c:	53                   	push   %rbx
+  80114d:	48 83 ec 08          	sub    $0x8,%rsp
+  801151:	89 f8                	mov    %edi,%eax
+  801153:	49 89 f2             	mov    %rsi,%r10
+  801156:	48 89 cf             	mov    %rcx,%rdi
+  801159:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80115c:	48 63 da             	movslq %edx,%rbx
+  80115f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801162:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801167:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80116a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80116d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80116f:	48 85 c0             	test   %rax,%rax
+  801172:	7f 06                	jg     80117a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801174:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801178:	c9                   	leave
+  801179:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80117a:	49 89 c0             	mov    %rax,%r8
+  80117d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801182:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801189:	00 00 00 
+  80118c:	be 26 00 00 00       	mov    $0x26,%esi
+  801191:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801198:	00 00 00 
+  80119b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a0:	49 b9 b0 2e 80 00 00 	movabs $0x802eb0,%r9
+  8011a7:	00 00 00 
+  8011aa:	41 ff d1             	call   *%r9
+
+00000000008011ad <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8011ad:	55                   	push   %rbp
+  8011ae:	48 89 e5             	mov    %rsp,%rbp
+  8011b1:	53                   	push   %rbx
+  8011b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8011b6:	48 89 f1             	mov    %rsi,%rcx
+  8011b9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8011bc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011bf:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011c4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011d4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011d6:	48 85 c0             	test   %rax,%rax
+  8011d9:	7f 06                	jg     8011e1 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8011db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011df:	c9                   	leave
+  8011e0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011e1:	49 89 c0             	mov    %rax,%r8
+  8011e4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011e9:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  8011f0:	00 00 00 
+  8011f3:	be 26 00 00 00       	mov    $0x26,%esi
+  8011f8:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  8011ff:	00 00 00 
+  801202:	b8 00 00 00 00       	mov    $0x0,%eax
+  801207:	49 b9 b0 2e 80 00 00 	movabs $0x802eb0,%r9
+  80120e:	00 00 00 
+  801211:	41 ff d1             	call   *%r9
+
+0000000000801214 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801214:	55                   	push   %rbp
+  801215:	48 89 e5             	mov    %rsp,%rbp
+  801218:	53                   	push   %rbx
+  801219:	48 83 ec 08          	sub    $0x8,%rsp
+  80121d:	89 f8                	mov    %edi,%eax
+  80121f:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801222:	48 63 f9             	movslq %ecx,%rdi
+  801225:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801228:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80122d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801230:	be 00 00 00 00       	mov    $0x0,%esi
+  801235:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80123b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80123d:	48 85 c0             	test   %rax,%rax
+  801240:	7f 06                	jg     801248 <sys_region_advise+0x34>
+}
+  801242:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801246:	c9                   	leave
+  801247:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801248:	49 89 c0             	mov    %rax,%r8
+  80124b:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801250:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801257:	00 00 00 
+  80125a:	be 26 00 00 00       	mov    $0x26,%esi
+  80125f:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801266:	00 00 00 
+  801269:	b8 00 00 00 00       	mov    $0x0,%eax
+  80126e:	49 b9 b0 2e 80 00 00 	movabs $0x802eb0,%r9
+  801275:	00 00 00 
+  801278:	41 ff d1             	call   *%r9
+
+000000000080127b <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  80127b:	55                   	push   %rbp
+  80127c:	48 89 e5             	mov    %rsp,%rbp
+  80127f:	53                   	push   %rbx
+  801280:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801284:	48 63 ce             	movslq %esi,%rcx
+  801287:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80128a:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80128f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801294:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801299:	be 00 00 00 00       	mov    $0x0,%esi
+  80129e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012a6:	48 85 c0             	test   %rax,%rax
+  8012a9:	7f 06                	jg     8012b1 <sys_env_set_nice+0x36>
+}
+  8012ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012af:	c9                   	leave
+  8012b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012b1:	49 89 c0             	mov    %rax,%r8
+  8012b4:	b9 15 00 00 00       	mov    $0x15,%ecx
+  8012b9:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  8012c0:	00 00 00 
+  8012c3:	be 26 00 00 00       	mov    $0x26,%esi
+  8012c8:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  8012cf:	00 00 00 
+  8012d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d7:	49 b9 b0 2e 80 00 00 	movabs $0x802eb0,%r9
+  8012de:	00 00 00 
+  8012e1:	41 ff d1             	call   *%r9
+
+00000000008012e4 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8012e4:	55                   	push   %rbp
+  8012e5:	48 89 e5             	mov    %rsp,%rbp
+  8012e8:	53                   	push   %rbx
+  8012e9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012ed:	48 63 ce             	movslq %esi,%rcx
+  8012f0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f3:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801302:	be 00 00 00 00       	mov    $0x0,%esi
+  801307:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80130d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80130f:	48 85 c0             	test   %rax,%rax
+  801312:	7f 06                	jg     80131a <sys_env_set_status+0x36>
+}
+  801314:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801318:	c9                   	leave
+  801319:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80131a:	49 89 c0             	mov    %rax,%r8
+  80131d:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801322:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801329:	00 00 00 
+  80132c:	be 26 00 00 00       	mov    $0x26,%esi
+  801331:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801338:	00 00 00 
+  80133b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801340:	49 b9 b0 2e 80 00 00 	movabs $0x802eb0,%r9
+  801347:	00 00 00 
+  80134a:	41 ff d1             	call   *%r9
+
+000000000080134d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80134d:	55                   	push   %rbp
+  80134e:	48 89 e5             	mov    %rsp,%rbp
+  801351:	53                   	push   %rbx
+  801352:	48 83 ec 08          	sub    $0x8,%rsp
+  801356:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801359:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80135c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801361:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801366:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80136b:	be 00 00 00 00       	mov    $0x0,%esi
+  801370:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801376:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801378:	48 85 c0             	test   %rax,%rax
+  80137b:	7f 06                	jg     801383 <sys_env_set_trapframe+0x36>
+}
+  80137d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801381:	c9                   	leave
+  801382:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801383:	49 89 c0             	mov    %rax,%r8
+  801386:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80138b:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801392:	00 00 00 
+  801395:	be 26 00 00 00       	mov    $0x26,%esi
+  80139a:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  8013a1:	00 00 00 
+  8013a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a9:	49 b9 b0 2e 80 00 00 	movabs $0x802eb0,%r9
+  8013b0:	00 00 00 
+  8013b3:	41 ff d1             	call   *%r9
+
+00000000008013b6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8013b6:	55                   	push   %rbp
+  8013b7:	48 89 e5             	mov    %rsp,%rbp
+  8013ba:	53                   	push   %rbx
+  8013bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8013bf:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8013c2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c5:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013cf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013df:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013e1:	48 85 c0             	test   %rax,%rax
+  8013e4:	7f 06                	jg     8013ec <sys_env_set_pgfault_upcall+0x36>
+}
+  8013e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ea:	c9                   	leave
+  8013eb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ec:	49 89 c0             	mov    %rax,%r8
+  8013ef:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013f4:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  8013fb:	00 00 00 
+  8013fe:	be 26 00 00 00       	mov    $0x26,%esi
+  801403:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  80140a:	00 00 00 
+  80140d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801412:	49 b9 b0 2e 80 00 00 	movabs $0x802eb0,%r9
+  801419:	00 00 00 
+  80141c:	41 ff d1             	call   *%r9
+
+000000000080141f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80141f:	55                   	push   %rbp
+  801420:	48 89 e5             	mov    %rsp,%rbp
+  801423:	53                   	push   %rbx
+  801424:	89 f8                	mov    %edi,%eax
+  801426:	49 89 f1             	mov    %rsi,%r9
+  801429:	48 89 d3             	mov    %rdx,%rbx
+  80142c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80142f:	49 63 f0             	movslq %r8d,%rsi
+  801432:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801435:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80143a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801443:	cd 30                	int    $0x30
+}
+  801445:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801449:	c9                   	leave
+  80144a:	c3                   	ret
+
+000000000080144b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80144b:	55                   	push   %rbp
+  80144c:	48 89 e5             	mov    %rsp,%rbp
+  80144f:	53                   	push   %rbx
+  801450:	48 83 ec 08          	sub    $0x8,%rsp
+  801454:	48 89 fa             	mov    %rdi,%rdx
+  801457:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80145a:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80145f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801464:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801469:	be 00 00 00 00       	mov    $0x0,%esi
+  80146e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801474:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801476:	48 85 c0             	test   %rax,%rax
+  801479:	7f 06                	jg     801481 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80147b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147f:	c9                   	leave
+  801480:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801481:	49 89 c0             	mov    %rax,%r8
+  801484:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801489:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801490:	00 00 00 
+  801493:	be 26 00 00 00       	mov    $0x26,%esi
+  801498:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  80149f:	00 00 00 
+  8014a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a7:	49 b9 b0 2e 80 00 00 	movabs $0x802eb0,%r9
+  8014ae:	00 00 00 
+  8014b1:	41 ff d1             	call   *%r9
+
+00000000008014b4 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8014b4:	55                   	push   %rbp
+  8014b5:	48 89 e5             	mov    %rsp,%rbp
+  8014b8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b9:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014dd:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e3:	c9                   	leave
+  8014e4:	c3                   	ret
+
+00000000008014e5 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8014e5:	55                   	push   %rbp
+  8014e6:	48 89 e5             	mov    %rsp,%rbp
+  8014e9:	53                   	push   %rbx
+  8014ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ee:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8014f1:	48 63 ce             	movslq %esi,%rcx
+  8014f4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f7:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801501:	be 00 00 00 00       	mov    $0x0,%esi
+  801506:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80150c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80150e:	48 85 c0             	test   %rax,%rax
+  801511:	7f 06                	jg     801519 <sys_sigqueue+0x34>
+}
+  801513:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801517:	c9                   	leave
+  801518:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801519:	49 89 c0             	mov    %rax,%r8
+  80151c:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801521:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801528:	00 00 00 
+  80152b:	be 26 00 00 00       	mov    $0x26,%esi
+  801530:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801537:	00 00 00 
+  80153a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153f:	49 b9 b0 2e 80 00 00 	movabs $0x802eb0,%r9
+  801546:	00 00 00 
+  801549:	41 ff d1             	call   *%r9
+
+000000000080154c <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  80154c:	55                   	push   %rbp
+  80154d:	48 89 e5             	mov    %rsp,%rbp
+  801550:	53                   	push   %rbx
+  801551:	48 83 ec 08          	sub    $0x8,%rsp
+  801555:	48 89 fa             	mov    %rdi,%rdx
+  801558:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80155b:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801560:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801565:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80156a:	be 00 00 00 00       	mov    $0x0,%esi
+  80156f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801575:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801577:	48 85 c0             	test   %rax,%rax
+  80157a:	7f 06                	jg     801582 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  80157c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801580:	c9                   	leave
+  801581:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801582:	49 89 c0             	mov    %rax,%r8
+  801585:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80158a:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801591:	00 00 00 
+  801594:	be 26 00 00 00       	mov    $0x26,%esi
+  801599:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  8015a0:	00 00 00 
+  8015a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a8:	49 b9 b0 2e 80 00 00 	movabs $0x802eb0,%r9
+  8015af:	00 00 00 
+  8015b2:	41 ff d1             	call   *%r9
+
+00000000008015b5 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  8015b5:	55                   	push   %rbp
+  8015b6:	48 89 e5             	mov    %rsp,%rbp
+  8015b9:	53                   	push   %rbx
+  8015ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8015be:	48 89 f1             	mov    %rsi,%rcx
+  8015c1:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  8015c4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c7:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015de:	48 85 c0             	test   %rax,%rax
+  8015e1:	7f 06                	jg     8015e9 <sys_sigaction+0x34>
+}
+  8015e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e7:	c9                   	leave
+  8015e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015e9:	49 89 c0             	mov    %rax,%r8
+  8015ec:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8015f1:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  8015f8:	00 00 00 
+  8015fb:	be 26 00 00 00       	mov    $0x26,%esi
+  801600:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801607:	00 00 00 
+  80160a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160f:	49 b9 b0 2e 80 00 00 	movabs $0x802eb0,%r9
+  801616:	00 00 00 
+  801619:	41 ff d1             	call   *%r9
+
+000000000080161c <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  80161c:	55                   	push   %rbp
+  80161d:	48 89 e5             	mov    %rsp,%rbp
+  801620:	53                   	push   %rbx
+  801621:	48 83 ec 08          	sub    $0x8,%rsp
+  801625:	48 89 f1             	mov    %rsi,%rcx
+  801628:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  80162b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80162e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801633:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801638:	be 00 00 00 00       	mov    $0x0,%esi
+  80163d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801643:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801645:	48 85 c0             	test   %rax,%rax
+  801648:	7f 06                	jg     801650 <sys_sigprocmask+0x34>
+}
+  80164a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80164e:	c9                   	leave
+  80164f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801650:	49 89 c0             	mov    %rax,%r8
+  801653:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801658:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  80165f:	00 00 00 
+  801662:	be 26 00 00 00       	mov    $0x26,%esi
+  801667:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  80166e:	00 00 00 
+  801671:	b8 00 00 00 00       	mov    $0x0,%eax
+  801676:	49 b9 b0 2e 80 00 00 	movabs $0x802eb0,%r9
+  80167d:	00 00 00 
+  801680:	41 ff d1             	call   *%r9
+
+0000000000801683 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  801683:	55                   	push   %rbp
+  801684:	48 89 e5             	mov    %rsp,%rbp
+  801687:	41 56                	push   %r14
+  801689:	41 55                	push   %r13
+  80168b:	41 54                	push   %r12
+  80168d:	53                   	push   %rbx
+  80168e:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801691:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  801698:	00 00 00 
+  80169b:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80169f:	74 27                	je     8016c8 <_handle_vectored_pagefault+0x45>
+  8016a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8016a6:	49 bd 20 50 80 00 00 	movabs $0x805020,%r13
+  8016ad:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8016b0:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8016b3:	4c 89 e7             	mov    %r12,%rdi
+  8016b6:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8016bb:	84 c0                	test   %al,%al
+  8016bd:	75 45                	jne    801704 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8016bf:	48 83 c3 01          	add    $0x1,%rbx
+  8016c3:	49 3b 1e             	cmp    (%r14),%rbx
+  8016c6:	72 eb                	jb     8016b3 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8016c8:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8016cf:	00 
+  8016d0:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8016d5:	4d 8b 04 24          	mov    (%r12),%r8
+  8016d9:	48 ba 80 36 80 00 00 	movabs $0x803680,%rdx
+  8016e0:	00 00 00 
+  8016e3:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8016e8:	48 bf 17 37 80 00 00 	movabs $0x803717,%rdi
+  8016ef:	00 00 00 
+  8016f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f7:	49 ba b0 2e 80 00 00 	movabs $0x802eb0,%r10
+  8016fe:	00 00 00 
+  801701:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  801704:	5b                   	pop    %rbx
+  801705:	41 5c                	pop    %r12
+  801707:	41 5d                	pop    %r13
+  801709:	41 5e                	pop    %r14
+  80170b:	5d                   	pop    %rbp
+  80170c:	c3                   	ret
+
+000000000080170d <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80170d:	55                   	push   %rbp
+  80170e:	48 89 e5             	mov    %rsp,%rbp
+  801711:	53                   	push   %rbx
+  801712:	48 83 ec 08          	sub    $0x8,%rsp
+  801716:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  801719:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801720:	00 00 00 
+  801723:	80 38 00             	cmpb   $0x0,(%rax)
+  801726:	74 61                	je     801789 <add_pgfault_handler+0x7c>
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801728:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  80172f:	00 00 00 
+  801732:	48 8b 10             	mov    (%rax),%rdx
+  801735:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80173a:	48 b9 20 50 80 00 00 	movabs $0x805020,%rcx
+  801741:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801744:	48 85 d2             	test   %rdx,%rdx
+  801747:	74 19                	je     801762 <add_pgfault_handler+0x55>
+        if (handler == _pfhandler_vec[i]) return 0;
+  801749:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80174d:	74 2f                	je     80177e <add_pgfault_handler+0x71>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80174f:	48 83 c0 01          	add    $0x1,%rax
+  801753:	48 39 d0             	cmp    %rdx,%rax
+  801756:	75 f1                	jne    801749 <add_pgfault_handler+0x3c>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  801758:	48 83 fa 08          	cmp    $0x8,%rdx
+  80175c:	0f 84 f7 00 00 00    	je     801859 <add_pgfault_handler+0x14c>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801762:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801766:	48 a3 68 50 80 00 00 	movabs %rax,0x805068
+  80176d:	00 00 00 
+  801770:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  801777:	00 00 00 
+  80177a:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  80177e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801783:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801787:	c9                   	leave
+  801788:	c3                   	ret
+        if (sys_alloc_region(CURENVID, ues_beg, PAGE_SIZE, PROT_RW))
+  801789:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80178e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801793:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80179a:	00 00 00 
+  80179d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017a2:	48 b8 e1 10 80 00 00 	movabs $0x8010e1,%rax
+  8017a9:	00 00 00 
+  8017ac:	ff d0                	call   *%rax
+  8017ae:	85 c0                	test   %eax,%eax
+  8017b0:	75 53                	jne    801805 <add_pgfault_handler+0xf8>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8017b2:	48 ba 68 50 80 00 00 	movabs $0x805068,%rdx
+  8017b9:	00 00 00 
+  8017bc:	48 8b 02             	mov    (%rdx),%rax
+  8017bf:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8017c3:	48 89 0a             	mov    %rcx,(%rdx)
+  8017c6:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8017cd:	00 00 00 
+  8017d0:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        if (sys_env_set_pgfault_upcall(CURENVID, _pgfault_upcall))
+  8017d4:	48 be 45 19 80 00 00 	movabs $0x801945,%rsi
+  8017db:	00 00 00 
+  8017de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017e3:	48 b8 b6 13 80 00 00 	movabs $0x8013b6,%rax
+  8017ea:	00 00 00 
+  8017ed:	ff d0                	call   *%rax
+  8017ef:	85 c0                	test   %eax,%eax
+  8017f1:	75 3c                	jne    80182f <add_pgfault_handler+0x122>
+        _pfhandler_inititiallized = 1;
+  8017f3:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8017fa:	00 00 00 
+  8017fd:	c6 00 01             	movb   $0x1,(%rax)
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801800:	e9 79 ff ff ff       	jmp    80177e <add_pgfault_handler+0x71>
+            panic("add_pgfault_handler: sys_alloc_region failed");
+  801805:	48 ba b0 36 80 00 00 	movabs $0x8036b0,%rdx
+  80180c:	00 00 00 
+  80180f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801814:	48 bf 17 37 80 00 00 	movabs $0x803717,%rdi
+  80181b:	00 00 00 
+  80181e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801823:	48 b9 b0 2e 80 00 00 	movabs $0x802eb0,%rcx
+  80182a:	00 00 00 
+  80182d:	ff d1                	call   *%rcx
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+  80182f:	48 ba e0 36 80 00 00 	movabs $0x8036e0,%rdx
+  801836:	00 00 00 
+  801839:	be 32 00 00 00       	mov    $0x32,%esi
+  80183e:	48 bf 17 37 80 00 00 	movabs $0x803717,%rdi
+  801845:	00 00 00 
+  801848:	b8 00 00 00 00       	mov    $0x0,%eax
+  80184d:	48 b9 b0 2e 80 00 00 	movabs $0x802eb0,%rcx
+  801854:	00 00 00 
+  801857:	ff d1                	call   *%rcx
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801859:	b9 fd ff ff ff       	mov    $0xfffffffd,%ecx
+  80185e:	48 ba 25 37 80 00 00 	movabs $0x803725,%rdx
+  801865:	00 00 00 
+  801868:	be 40 00 00 00       	mov    $0x40,%esi
+  80186d:	48 bf 17 37 80 00 00 	movabs $0x803717,%rdi
+  801874:	00 00 00 
+  801877:	b8 00 00 00 00       	mov    $0x0,%eax
+  80187c:	49 b8 b0 2e 80 00 00 	movabs $0x802eb0,%r8
+  801883:	00 00 00 
+  801886:	41 ff d0             	call   *%r8
+
+0000000000801889 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  801889:	55                   	push   %rbp
+  80188a:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80188d:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801894:	00 00 00 
+  801897:	80 38 00             	cmpb   $0x0,(%rax)
+  80189a:	74 33                	je     8018cf <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80189c:	48 a1 68 50 80 00 00 	movabs 0x805068,%rax
+  8018a3:	00 00 00 
+  8018a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8018ab:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8018b2:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8018b5:	48 85 c0             	test   %rax,%rax
+  8018b8:	0f 84 85 00 00 00    	je     801943 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8018be:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8018c2:	74 40                	je     801904 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8018c4:	48 83 c1 01          	add    $0x1,%rcx
+  8018c8:	48 39 c1             	cmp    %rax,%rcx
+  8018cb:	75 f1                	jne    8018be <remove_pgfault_handler+0x35>
+  8018cd:	eb 74                	jmp    801943 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8018cf:	48 b9 3d 37 80 00 00 	movabs $0x80373d,%rcx
+  8018d6:	00 00 00 
+  8018d9:	48 ba 57 37 80 00 00 	movabs $0x803757,%rdx
+  8018e0:	00 00 00 
+  8018e3:	be 46 00 00 00       	mov    $0x46,%esi
+  8018e8:	48 bf 17 37 80 00 00 	movabs $0x803717,%rdi
+  8018ef:	00 00 00 
+  8018f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f7:	49 b8 b0 2e 80 00 00 	movabs $0x802eb0,%r8
+  8018fe:	00 00 00 
+  801901:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  801904:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80190b:	00 
+  80190c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801910:	48 29 ca             	sub    %rcx,%rdx
+  801913:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  80191a:	00 00 00 
+  80191d:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  801921:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  801926:	48 89 ce             	mov    %rcx,%rsi
+  801929:	48 b8 2b 0d 80 00 00 	movabs $0x800d2b,%rax
+  801930:	00 00 00 
+  801933:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  801935:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  80193c:	00 00 00 
+  80193f:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  801943:	5d                   	pop    %rbp
+  801944:	c3                   	ret
+
+0000000000801945 <_pgfault_upcall>:
+.text
+.globl _pgfault_upcall
+.globl _signal_handler_trampoline
+_pgfault_upcall:
+_signal_handler_trampoline:
+    movq  %rsp,%rdi # passing the function argument (UTrapframe *) in rdi
+  801945:	48 89 e7             	mov    %rsp,%rdi
+    # sizeof(struct EnqueuedSignal) == 56
+    # sizeof(curenv->env_sig_mask) == 4
+    # + 4 bytes of alignment
+    add $64, %rdi
+  801948:	48 83 c7 40          	add    $0x40,%rdi
+
+    # load signo
+    mov (%rsp), %eax
+  80194c:	8b 04 24             	mov    (%rsp),%eax
+    test %eax, %eax
+  80194f:	85 c0                	test   %eax,%eax
+    jnz _call_generic_signal_handler
+  801951:	75 0e                	jne    801961 <_call_generic_signal_handler>
+
+    # Call the C page fault handler.
+    movabs $_handle_vectored_pagefault, %rax
+  801953:	48 b8 83 16 80 00 00 	movabs $0x801683,%rax
+  80195a:	00 00 00 
+    call *%rax
+  80195d:	ff d0                	call   *%rax
+    jmp _return_from_handler
+  80195f:	eb 0f                	jmp    801970 <_return_from_handler>
+
+0000000000801961 <_call_generic_signal_handler>:
+
+_call_generic_signal_handler:
+    movq %rsp, %rsi # passing the function argument (EnqueuedSignal *) in rsi
+  801961:	48 89 e6             	mov    %rsp,%rsi
+    movabs $_generic_signal_handler, %rax
+  801964:	48 b8 a8 2a 80 00 00 	movabs $0x802aa8,%rax
+  80196b:	00 00 00 
+    call *%rax
+  80196e:	ff d0                	call   *%rax
+
+0000000000801970 <_return_from_handler>:
+
+_return_from_handler:
+    # ignore EnqueuedSignal and env_sig_mask
+    add $64, %rsp
+  801970:	48 83 c4 40          	add    $0x40,%rsp
+    # put SIG_SETMASK as the first func arg
+    movq $3, %rdi
+  801974:	48 c7 c7 03 00 00 00 	mov    $0x3,%rdi
+    # load &env_sig_mask (as the second func arg)
+    lea -4(%rsp), %rsi
+  80197b:	48 8d 74 24 fc       	lea    -0x4(%rsp),%rsi
+    # NULL as the third arg
+    xor %rdx, %rdx
+  801980:	48 31 d2             	xor    %rdx,%rdx
+    # restore blocked signals mask
+    movabs $sys_sigprocmask, %rax
+  801983:	48 b8 1c 16 80 00 00 	movabs $0x80161c,%rax
+  80198a:	00 00 00 
+    call *%rax
+  80198d:	ff d0                	call   *%rax
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    # ignore utf_fault_va, utf_err
+    addq $16, %rsp
+  80198f:	48 83 c4 10          	add    $0x10,%rsp
+    # restore utf_regs, save rax again
+    POPA
+  801993:	4c 8b 3c 24          	mov    (%rsp),%r15
+  801997:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80199c:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8019a1:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8019a6:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8019ab:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8019b0:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8019b5:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8019ba:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8019bf:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8019c4:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8019c9:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8019ce:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8019d3:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8019d8:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8019dd:	48 83 c4 78          	add    $0x78,%rsp
+    pushq %rax
+  8019e1:	50                   	push   %rax
+    # 16 utf_rflags
+    #  8 utf_rip
+    #  0 rax
+
+    # load utf_rip
+    movq 8(%rsp), %rax
+  8019e2:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    # save rbx to utf_rip
+    movq %rbx, 8(%rsp)
+  8019e7:	48 89 5c 24 08       	mov    %rbx,0x8(%rsp)
+    # load utf_rsp
+    movq 24(%rsp), %rbx
+  8019ec:	48 8b 5c 24 18       	mov    0x18(%rsp),%rbx
+    # store return address to *utf_stack
+    subq $8, 24(%rsp)
+  8019f1:	48 83 6c 24 18 08    	subq   $0x8,0x18(%rsp)
+    movq %rax, -8(%rbx)
+  8019f7:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    # restore rax and rbx
+    popq %rax
+  8019fb:	58                   	pop    %rax
+    popq %rbx
+  8019fc:	5b                   	pop    %rbx
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+    popfq
+  8019fd:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    popq %rsp
+  8019fe:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8019ff:	c3                   	ret
+
+0000000000801a00 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a00:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a07:	ff ff ff 
+  801a0a:	48 01 f8             	add    %rdi,%rax
+  801a0d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a11:	c3                   	ret
+
+0000000000801a12 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a12:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a19:	ff ff ff 
+  801a1c:	48 01 f8             	add    %rdi,%rax
+  801a1f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a23:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801a29:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801a2d:	c3                   	ret
+
+0000000000801a2e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801a2e:	55                   	push   %rbp
+  801a2f:	48 89 e5             	mov    %rsp,%rbp
+  801a32:	41 57                	push   %r15
+  801a34:	41 56                	push   %r14
+  801a36:	41 55                	push   %r13
+  801a38:	41 54                	push   %r12
+  801a3a:	53                   	push   %rbx
+  801a3b:	48 83 ec 08          	sub    $0x8,%rsp
+  801a3f:	49 89 ff             	mov    %rdi,%r15
+  801a42:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a47:	49 bd ac 29 80 00 00 	movabs $0x8029ac,%r13
+  801a4e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801a51:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801a57:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801a5a:	48 89 df             	mov    %rbx,%rdi
+  801a5d:	41 ff d5             	call   *%r13
+  801a60:	83 e0 04             	and    $0x4,%eax
+  801a63:	74 17                	je     801a7c <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801a65:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a6c:	4c 39 f3             	cmp    %r14,%rbx
+  801a6f:	75 e6                	jne    801a57 <fd_alloc+0x29>
+  801a71:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a77:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a7c:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a7f:	48 83 c4 08          	add    $0x8,%rsp
+  801a83:	5b                   	pop    %rbx
+  801a84:	41 5c                	pop    %r12
+  801a86:	41 5d                	pop    %r13
+  801a88:	41 5e                	pop    %r14
+  801a8a:	41 5f                	pop    %r15
+  801a8c:	5d                   	pop    %rbp
+  801a8d:	c3                   	ret
+
+0000000000801a8e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a8e:	83 ff 1f             	cmp    $0x1f,%edi
+  801a91:	77 39                	ja     801acc <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a93:	55                   	push   %rbp
+  801a94:	48 89 e5             	mov    %rsp,%rbp
+  801a97:	41 54                	push   %r12
+  801a99:	53                   	push   %rbx
+  801a9a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a9d:	48 63 df             	movslq %edi,%rbx
+  801aa0:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801aa7:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801aab:	48 89 df             	mov    %rbx,%rdi
+  801aae:	48 b8 ac 29 80 00 00 	movabs $0x8029ac,%rax
+  801ab5:	00 00 00 
+  801ab8:	ff d0                	call   *%rax
+  801aba:	a8 04                	test   $0x4,%al
+  801abc:	74 14                	je     801ad2 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801abe:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ac7:	5b                   	pop    %rbx
+  801ac8:	41 5c                	pop    %r12
+  801aca:	5d                   	pop    %rbp
+  801acb:	c3                   	ret
+        return -E_INVAL;
+  801acc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801ad1:	c3                   	ret
+        return -E_INVAL;
+  801ad2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ad7:	eb ee                	jmp    801ac7 <fd_lookup+0x39>
+
+0000000000801ad9 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801ad9:	55                   	push   %rbp
+  801ada:	48 89 e5             	mov    %rsp,%rbp
+  801add:	41 54                	push   %r12
+  801adf:	53                   	push   %rbx
+  801ae0:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801ae3:	48 b8 00 38 80 00 00 	movabs $0x803800,%rax
+  801aea:	00 00 00 
+  801aed:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801af4:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801af7:	39 3b                	cmp    %edi,(%rbx)
+  801af9:	74 47                	je     801b42 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801afb:	48 83 c0 08          	add    $0x8,%rax
+  801aff:	48 8b 18             	mov    (%rax),%rbx
+  801b02:	48 85 db             	test   %rbx,%rbx
+  801b05:	75 f0                	jne    801af7 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b07:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b0e:	00 00 00 
+  801b11:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b17:	89 fa                	mov    %edi,%edx
+  801b19:	48 bf 70 37 80 00 00 	movabs $0x803770,%rdi
+  801b20:	00 00 00 
+  801b23:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b28:	48 b9 0c 02 80 00 00 	movabs $0x80020c,%rcx
+  801b2f:	00 00 00 
+  801b32:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b39:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b3d:	5b                   	pop    %rbx
+  801b3e:	41 5c                	pop    %r12
+  801b40:	5d                   	pop    %rbp
+  801b41:	c3                   	ret
+            return 0;
+  801b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b47:	eb f0                	jmp    801b39 <dev_lookup+0x60>
+
+0000000000801b49 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b49:	55                   	push   %rbp
+  801b4a:	48 89 e5             	mov    %rsp,%rbp
+  801b4d:	41 55                	push   %r13
+  801b4f:	41 54                	push   %r12
+  801b51:	53                   	push   %rbx
+  801b52:	48 83 ec 18          	sub    $0x18,%rsp
+  801b56:	48 89 fb             	mov    %rdi,%rbx
+  801b59:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b5c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b63:	ff ff ff 
+  801b66:	48 01 df             	add    %rbx,%rdi
+  801b69:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b6d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b71:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  801b78:	00 00 00 
+  801b7b:	ff d0                	call   *%rax
+  801b7d:	41 89 c5             	mov    %eax,%r13d
+  801b80:	85 c0                	test   %eax,%eax
+  801b82:	78 06                	js     801b8a <fd_close+0x41>
+  801b84:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b88:	74 1a                	je     801ba4 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b8a:	45 84 e4             	test   %r12b,%r12b
+  801b8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b92:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b96:	44 89 e8             	mov    %r13d,%eax
+  801b99:	48 83 c4 18          	add    $0x18,%rsp
+  801b9d:	5b                   	pop    %rbx
+  801b9e:	41 5c                	pop    %r12
+  801ba0:	41 5d                	pop    %r13
+  801ba2:	5d                   	pop    %rbp
+  801ba3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ba4:	8b 3b                	mov    (%rbx),%edi
+  801ba6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801baa:	48 b8 d9 1a 80 00 00 	movabs $0x801ad9,%rax
+  801bb1:	00 00 00 
+  801bb4:	ff d0                	call   *%rax
+  801bb6:	41 89 c5             	mov    %eax,%r13d
+  801bb9:	85 c0                	test   %eax,%eax
+  801bbb:	78 1b                	js     801bd8 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801bbd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bc1:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801bc5:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801bcb:	48 85 c0             	test   %rax,%rax
+  801bce:	74 08                	je     801bd8 <fd_close+0x8f>
+  801bd0:	48 89 df             	mov    %rbx,%rdi
+  801bd3:	ff d0                	call   *%rax
+  801bd5:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801bd8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bdd:	48 89 de             	mov    %rbx,%rsi
+  801be0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801be5:	48 b8 ad 11 80 00 00 	movabs $0x8011ad,%rax
+  801bec:	00 00 00 
+  801bef:	ff d0                	call   *%rax
+    return res;
+  801bf1:	eb a3                	jmp    801b96 <fd_close+0x4d>
+
+0000000000801bf3 <close>:
+
+int
+close(int fdnum) {
+  801bf3:	55                   	push   %rbp
+  801bf4:	48 89 e5             	mov    %rsp,%rbp
+  801bf7:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801bfb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801bff:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  801c06:	00 00 00 
+  801c09:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c0b:	85 c0                	test   %eax,%eax
+  801c0d:	78 15                	js     801c24 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c0f:	be 01 00 00 00       	mov    $0x1,%esi
+  801c14:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c18:	48 b8 49 1b 80 00 00 	movabs $0x801b49,%rax
+  801c1f:	00 00 00 
+  801c22:	ff d0                	call   *%rax
+}
+  801c24:	c9                   	leave
+  801c25:	c3                   	ret
+
+0000000000801c26 <close_all>:
+
+void
+close_all(void) {
+  801c26:	55                   	push   %rbp
+  801c27:	48 89 e5             	mov    %rsp,%rbp
+  801c2a:	41 54                	push   %r12
+  801c2c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c32:	49 bc f3 1b 80 00 00 	movabs $0x801bf3,%r12
+  801c39:	00 00 00 
+  801c3c:	89 df                	mov    %ebx,%edi
+  801c3e:	41 ff d4             	call   *%r12
+  801c41:	83 c3 01             	add    $0x1,%ebx
+  801c44:	83 fb 20             	cmp    $0x20,%ebx
+  801c47:	75 f3                	jne    801c3c <close_all+0x16>
+}
+  801c49:	5b                   	pop    %rbx
+  801c4a:	41 5c                	pop    %r12
+  801c4c:	5d                   	pop    %rbp
+  801c4d:	c3                   	ret
+
+0000000000801c4e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c4e:	55                   	push   %rbp
+  801c4f:	48 89 e5             	mov    %rsp,%rbp
+  801c52:	41 57                	push   %r15
+  801c54:	41 56                	push   %r14
+  801c56:	41 55                	push   %r13
+  801c58:	41 54                	push   %r12
+  801c5a:	53                   	push   %rbx
+  801c5b:	48 83 ec 18          	sub    $0x18,%rsp
+  801c5f:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c62:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c66:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  801c6d:	00 00 00 
+  801c70:	ff d0                	call   *%rax
+  801c72:	89 c3                	mov    %eax,%ebx
+  801c74:	85 c0                	test   %eax,%eax
+  801c76:	0f 88 b8 00 00 00    	js     801d34 <dup+0xe6>
+    close(newfdnum);
+  801c7c:	44 89 e7             	mov    %r12d,%edi
+  801c7f:	48 b8 f3 1b 80 00 00 	movabs $0x801bf3,%rax
+  801c86:	00 00 00 
+  801c89:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c8b:	4d 63 ec             	movslq %r12d,%r13
+  801c8e:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c95:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c99:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c9d:	4c 89 ff             	mov    %r15,%rdi
+  801ca0:	49 be 12 1a 80 00 00 	movabs $0x801a12,%r14
+  801ca7:	00 00 00 
+  801caa:	41 ff d6             	call   *%r14
+  801cad:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801cb0:	4c 89 ef             	mov    %r13,%rdi
+  801cb3:	41 ff d6             	call   *%r14
+  801cb6:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801cb9:	48 89 df             	mov    %rbx,%rdi
+  801cbc:	48 b8 ac 29 80 00 00 	movabs $0x8029ac,%rax
+  801cc3:	00 00 00 
+  801cc6:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801cc8:	a8 04                	test   $0x4,%al
+  801cca:	74 2b                	je     801cf7 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ccc:	41 89 c1             	mov    %eax,%r9d
+  801ccf:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cd5:	4c 89 f1             	mov    %r14,%rcx
+  801cd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cdd:	48 89 de             	mov    %rbx,%rsi
+  801ce0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ce5:	48 b8 48 11 80 00 00 	movabs $0x801148,%rax
+  801cec:	00 00 00 
+  801cef:	ff d0                	call   *%rax
+  801cf1:	89 c3                	mov    %eax,%ebx
+  801cf3:	85 c0                	test   %eax,%eax
+  801cf5:	78 4e                	js     801d45 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801cf7:	4c 89 ff             	mov    %r15,%rdi
+  801cfa:	48 b8 ac 29 80 00 00 	movabs $0x8029ac,%rax
+  801d01:	00 00 00 
+  801d04:	ff d0                	call   *%rax
+  801d06:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d09:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d0f:	4c 89 e9             	mov    %r13,%rcx
+  801d12:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d17:	4c 89 fe             	mov    %r15,%rsi
+  801d1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d1f:	48 b8 48 11 80 00 00 	movabs $0x801148,%rax
+  801d26:	00 00 00 
+  801d29:	ff d0                	call   *%rax
+  801d2b:	89 c3                	mov    %eax,%ebx
+  801d2d:	85 c0                	test   %eax,%eax
+  801d2f:	78 14                	js     801d45 <dup+0xf7>
+
+    return newfdnum;
+  801d31:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d34:	89 d8                	mov    %ebx,%eax
+  801d36:	48 83 c4 18          	add    $0x18,%rsp
+  801d3a:	5b                   	pop    %rbx
+  801d3b:	41 5c                	pop    %r12
+  801d3d:	41 5d                	pop    %r13
+  801d3f:	41 5e                	pop    %r14
+  801d41:	41 5f                	pop    %r15
+  801d43:	5d                   	pop    %rbp
+  801d44:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d45:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d4a:	4c 89 ee             	mov    %r13,%rsi
+  801d4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d52:	49 bc ad 11 80 00 00 	movabs $0x8011ad,%r12
+  801d59:	00 00 00 
+  801d5c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d5f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d64:	4c 89 f6             	mov    %r14,%rsi
+  801d67:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d6c:	41 ff d4             	call   *%r12
+    return res;
+  801d6f:	eb c3                	jmp    801d34 <dup+0xe6>
+
+0000000000801d71 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d71:	55                   	push   %rbp
+  801d72:	48 89 e5             	mov    %rsp,%rbp
+  801d75:	41 56                	push   %r14
+  801d77:	41 55                	push   %r13
+  801d79:	41 54                	push   %r12
+  801d7b:	53                   	push   %rbx
+  801d7c:	48 83 ec 10          	sub    $0x10,%rsp
+  801d80:	89 fb                	mov    %edi,%ebx
+  801d82:	49 89 f4             	mov    %rsi,%r12
+  801d85:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d88:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d8c:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  801d93:	00 00 00 
+  801d96:	ff d0                	call   *%rax
+  801d98:	85 c0                	test   %eax,%eax
+  801d9a:	78 4c                	js     801de8 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d9c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801da0:	41 8b 3e             	mov    (%r14),%edi
+  801da3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801da7:	48 b8 d9 1a 80 00 00 	movabs $0x801ad9,%rax
+  801dae:	00 00 00 
+  801db1:	ff d0                	call   *%rax
+  801db3:	85 c0                	test   %eax,%eax
+  801db5:	78 35                	js     801dec <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801db7:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801dbb:	83 e0 03             	and    $0x3,%eax
+  801dbe:	83 f8 01             	cmp    $0x1,%eax
+  801dc1:	74 2d                	je     801df0 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dc3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dc7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801dcb:	48 85 c0             	test   %rax,%rax
+  801dce:	74 56                	je     801e26 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801dd0:	4c 89 ea             	mov    %r13,%rdx
+  801dd3:	4c 89 e6             	mov    %r12,%rsi
+  801dd6:	4c 89 f7             	mov    %r14,%rdi
+  801dd9:	ff d0                	call   *%rax
+}
+  801ddb:	48 83 c4 10          	add    $0x10,%rsp
+  801ddf:	5b                   	pop    %rbx
+  801de0:	41 5c                	pop    %r12
+  801de2:	41 5d                	pop    %r13
+  801de4:	41 5e                	pop    %r14
+  801de6:	5d                   	pop    %rbp
+  801de7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801de8:	48 98                	cltq
+  801dea:	eb ef                	jmp    801ddb <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dec:	48 98                	cltq
+  801dee:	eb eb                	jmp    801ddb <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801df0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801df7:	00 00 00 
+  801dfa:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e00:	89 da                	mov    %ebx,%edx
+  801e02:	48 bf b1 37 80 00 00 	movabs $0x8037b1,%rdi
+  801e09:	00 00 00 
+  801e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e11:	48 b9 0c 02 80 00 00 	movabs $0x80020c,%rcx
+  801e18:	00 00 00 
+  801e1b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e1d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e24:	eb b5                	jmp    801ddb <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e26:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e2d:	eb ac                	jmp    801ddb <read+0x6a>
+
+0000000000801e2f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e2f:	55                   	push   %rbp
+  801e30:	48 89 e5             	mov    %rsp,%rbp
+  801e33:	41 57                	push   %r15
+  801e35:	41 56                	push   %r14
+  801e37:	41 55                	push   %r13
+  801e39:	41 54                	push   %r12
+  801e3b:	53                   	push   %rbx
+  801e3c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e40:	48 85 d2             	test   %rdx,%rdx
+  801e43:	74 54                	je     801e99 <readn+0x6a>
+  801e45:	41 89 fd             	mov    %edi,%r13d
+  801e48:	49 89 f6             	mov    %rsi,%r14
+  801e4b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e53:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e58:	49 bf 71 1d 80 00 00 	movabs $0x801d71,%r15
+  801e5f:	00 00 00 
+  801e62:	4c 89 e2             	mov    %r12,%rdx
+  801e65:	48 29 f2             	sub    %rsi,%rdx
+  801e68:	4c 01 f6             	add    %r14,%rsi
+  801e6b:	44 89 ef             	mov    %r13d,%edi
+  801e6e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e71:	85 c0                	test   %eax,%eax
+  801e73:	78 20                	js     801e95 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e75:	01 c3                	add    %eax,%ebx
+  801e77:	85 c0                	test   %eax,%eax
+  801e79:	74 08                	je     801e83 <readn+0x54>
+  801e7b:	48 63 f3             	movslq %ebx,%rsi
+  801e7e:	4c 39 e6             	cmp    %r12,%rsi
+  801e81:	72 df                	jb     801e62 <readn+0x33>
+    }
+    return res;
+  801e83:	48 63 c3             	movslq %ebx,%rax
+}
+  801e86:	48 83 c4 08          	add    $0x8,%rsp
+  801e8a:	5b                   	pop    %rbx
+  801e8b:	41 5c                	pop    %r12
+  801e8d:	41 5d                	pop    %r13
+  801e8f:	41 5e                	pop    %r14
+  801e91:	41 5f                	pop    %r15
+  801e93:	5d                   	pop    %rbp
+  801e94:	c3                   	ret
+        if (inc < 0) return inc;
+  801e95:	48 98                	cltq
+  801e97:	eb ed                	jmp    801e86 <readn+0x57>
+    int inc = 1, res = 0;
+  801e99:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e9e:	eb e3                	jmp    801e83 <readn+0x54>
+
+0000000000801ea0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ea0:	55                   	push   %rbp
+  801ea1:	48 89 e5             	mov    %rsp,%rbp
+  801ea4:	41 56                	push   %r14
+  801ea6:	41 55                	push   %r13
+  801ea8:	41 54                	push   %r12
+  801eaa:	53                   	push   %rbx
+  801eab:	48 83 ec 10          	sub    $0x10,%rsp
+  801eaf:	89 fb                	mov    %edi,%ebx
+  801eb1:	49 89 f4             	mov    %rsi,%r12
+  801eb4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eb7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ebb:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  801ec2:	00 00 00 
+  801ec5:	ff d0                	call   *%rax
+  801ec7:	85 c0                	test   %eax,%eax
+  801ec9:	78 47                	js     801f12 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ecb:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ecf:	41 8b 3e             	mov    (%r14),%edi
+  801ed2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ed6:	48 b8 d9 1a 80 00 00 	movabs $0x801ad9,%rax
+  801edd:	00 00 00 
+  801ee0:	ff d0                	call   *%rax
+  801ee2:	85 c0                	test   %eax,%eax
+  801ee4:	78 30                	js     801f16 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ee6:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801eeb:	74 2d                	je     801f1a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801eed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ef1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ef5:	48 85 c0             	test   %rax,%rax
+  801ef8:	74 56                	je     801f50 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801efa:	4c 89 ea             	mov    %r13,%rdx
+  801efd:	4c 89 e6             	mov    %r12,%rsi
+  801f00:	4c 89 f7             	mov    %r14,%rdi
+  801f03:	ff d0                	call   *%rax
+}
+  801f05:	48 83 c4 10          	add    $0x10,%rsp
+  801f09:	5b                   	pop    %rbx
+  801f0a:	41 5c                	pop    %r12
+  801f0c:	41 5d                	pop    %r13
+  801f0e:	41 5e                	pop    %r14
+  801f10:	5d                   	pop    %rbp
+  801f11:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f12:	48 98                	cltq
+  801f14:	eb ef                	jmp    801f05 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f16:	48 98                	cltq
+  801f18:	eb eb                	jmp    801f05 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f1a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f21:	00 00 00 
+  801f24:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f2a:	89 da                	mov    %ebx,%edx
+  801f2c:	48 bf cd 37 80 00 00 	movabs $0x8037cd,%rdi
+  801f33:	00 00 00 
+  801f36:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f3b:	48 b9 0c 02 80 00 00 	movabs $0x80020c,%rcx
+  801f42:	00 00 00 
+  801f45:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f47:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f4e:	eb b5                	jmp    801f05 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f50:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f57:	eb ac                	jmp    801f05 <write+0x65>
+
+0000000000801f59 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f59:	55                   	push   %rbp
+  801f5a:	48 89 e5             	mov    %rsp,%rbp
+  801f5d:	53                   	push   %rbx
+  801f5e:	48 83 ec 18          	sub    $0x18,%rsp
+  801f62:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f64:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f68:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  801f6f:	00 00 00 
+  801f72:	ff d0                	call   *%rax
+  801f74:	85 c0                	test   %eax,%eax
+  801f76:	78 0c                	js     801f84 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f78:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f7c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f84:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f88:	c9                   	leave
+  801f89:	c3                   	ret
+
+0000000000801f8a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f8a:	55                   	push   %rbp
+  801f8b:	48 89 e5             	mov    %rsp,%rbp
+  801f8e:	41 55                	push   %r13
+  801f90:	41 54                	push   %r12
+  801f92:	53                   	push   %rbx
+  801f93:	48 83 ec 18          	sub    $0x18,%rsp
+  801f97:	89 fb                	mov    %edi,%ebx
+  801f99:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f9c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fa0:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  801fa7:	00 00 00 
+  801faa:	ff d0                	call   *%rax
+  801fac:	85 c0                	test   %eax,%eax
+  801fae:	78 38                	js     801fe8 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fb0:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801fb4:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801fb8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fbc:	48 b8 d9 1a 80 00 00 	movabs $0x801ad9,%rax
+  801fc3:	00 00 00 
+  801fc6:	ff d0                	call   *%rax
+  801fc8:	85 c0                	test   %eax,%eax
+  801fca:	78 1c                	js     801fe8 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fcc:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801fd1:	74 20                	je     801ff3 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fd3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fd7:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801fdb:	48 85 c0             	test   %rax,%rax
+  801fde:	74 47                	je     802027 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801fe0:	44 89 e6             	mov    %r12d,%esi
+  801fe3:	4c 89 ef             	mov    %r13,%rdi
+  801fe6:	ff d0                	call   *%rax
+}
+  801fe8:	48 83 c4 18          	add    $0x18,%rsp
+  801fec:	5b                   	pop    %rbx
+  801fed:	41 5c                	pop    %r12
+  801fef:	41 5d                	pop    %r13
+  801ff1:	5d                   	pop    %rbp
+  801ff2:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ff3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ffa:	00 00 00 
+  801ffd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802003:	89 da                	mov    %ebx,%edx
+  802005:	48 bf 90 37 80 00 00 	movabs $0x803790,%rdi
+  80200c:	00 00 00 
+  80200f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802014:	48 b9 0c 02 80 00 00 	movabs $0x80020c,%rcx
+  80201b:	00 00 00 
+  80201e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802020:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802025:	eb c1                	jmp    801fe8 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802027:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80202c:	eb ba                	jmp    801fe8 <ftruncate+0x5e>
+
+000000000080202e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80202e:	55                   	push   %rbp
+  80202f:	48 89 e5             	mov    %rsp,%rbp
+  802032:	41 54                	push   %r12
+  802034:	53                   	push   %rbx
+  802035:	48 83 ec 10          	sub    $0x10,%rsp
+  802039:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80203c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802040:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  802047:	00 00 00 
+  80204a:	ff d0                	call   *%rax
+  80204c:	85 c0                	test   %eax,%eax
+  80204e:	78 4e                	js     80209e <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802050:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802054:	41 8b 3c 24          	mov    (%r12),%edi
+  802058:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80205c:	48 b8 d9 1a 80 00 00 	movabs $0x801ad9,%rax
+  802063:	00 00 00 
+  802066:	ff d0                	call   *%rax
+  802068:	85 c0                	test   %eax,%eax
+  80206a:	78 32                	js     80209e <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80206c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802070:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802075:	74 30                	je     8020a7 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802077:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80207a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802081:	00 00 00 
+    stat->st_isdir = 0;
+  802084:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80208b:	00 00 00 
+    stat->st_dev = dev;
+  80208e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802095:	48 89 de             	mov    %rbx,%rsi
+  802098:	4c 89 e7             	mov    %r12,%rdi
+  80209b:	ff 50 28             	call   *0x28(%rax)
+}
+  80209e:	48 83 c4 10          	add    $0x10,%rsp
+  8020a2:	5b                   	pop    %rbx
+  8020a3:	41 5c                	pop    %r12
+  8020a5:	5d                   	pop    %rbp
+  8020a6:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020a7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020ac:	eb f0                	jmp    80209e <fstat+0x70>
+
+00000000008020ae <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8020ae:	55                   	push   %rbp
+  8020af:	48 89 e5             	mov    %rsp,%rbp
+  8020b2:	41 54                	push   %r12
+  8020b4:	53                   	push   %rbx
+  8020b5:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8020b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8020bd:	48 b8 2f 23 80 00 00 	movabs $0x80232f,%rax
+  8020c4:	00 00 00 
+  8020c7:	ff d0                	call   *%rax
+  8020c9:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8020cb:	85 c0                	test   %eax,%eax
+  8020cd:	78 25                	js     8020f4 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8020cf:	4c 89 e6             	mov    %r12,%rsi
+  8020d2:	89 c7                	mov    %eax,%edi
+  8020d4:	48 b8 2e 20 80 00 00 	movabs $0x80202e,%rax
+  8020db:	00 00 00 
+  8020de:	ff d0                	call   *%rax
+  8020e0:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8020e3:	89 df                	mov    %ebx,%edi
+  8020e5:	48 b8 f3 1b 80 00 00 	movabs $0x801bf3,%rax
+  8020ec:	00 00 00 
+  8020ef:	ff d0                	call   *%rax
+
+    return res;
+  8020f1:	44 89 e3             	mov    %r12d,%ebx
+}
+  8020f4:	89 d8                	mov    %ebx,%eax
+  8020f6:	5b                   	pop    %rbx
+  8020f7:	41 5c                	pop    %r12
+  8020f9:	5d                   	pop    %rbp
+  8020fa:	c3                   	ret
+
+00000000008020fb <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  8020fb:	55                   	push   %rbp
+  8020fc:	48 89 e5             	mov    %rsp,%rbp
+  8020ff:	41 54                	push   %r12
+  802101:	53                   	push   %rbx
+  802102:	48 83 ec 10          	sub    $0x10,%rsp
+  802106:	41 89 fc             	mov    %edi,%r12d
+  802109:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80210c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802113:	00 00 00 
+  802116:	83 38 00             	cmpl   $0x0,(%rax)
+  802119:	74 5e                	je     802179 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80211b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802121:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802126:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80212d:	00 00 00 
+  802130:	44 89 e6             	mov    %r12d,%esi
+  802133:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80213a:	00 00 00 
+  80213d:	8b 38                	mov    (%rax),%edi
+  80213f:	48 b8 e8 2f 80 00 00 	movabs $0x802fe8,%rax
+  802146:	00 00 00 
+  802149:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  80214b:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802152:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802153:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802158:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80215c:	48 89 de             	mov    %rbx,%rsi
+  80215f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802164:	48 b8 53 2f 80 00 00 	movabs $0x802f53,%rax
+  80216b:	00 00 00 
+  80216e:	ff d0                	call   *%rax
+}
+  802170:	48 83 c4 10          	add    $0x10,%rsp
+  802174:	5b                   	pop    %rbx
+  802175:	41 5c                	pop    %r12
+  802177:	5d                   	pop    %rbp
+  802178:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802179:	bf 03 00 00 00       	mov    $0x3,%edi
+  80217e:	48 b8 88 30 80 00 00 	movabs $0x803088,%rax
+  802185:	00 00 00 
+  802188:	ff d0                	call   *%rax
+  80218a:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802191:	00 00 
+  802193:	eb 86                	jmp    80211b <fsipc+0x20>
+
+0000000000802195 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802195:	55                   	push   %rbp
+  802196:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802199:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8021a0:	00 00 00 
+  8021a3:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8021a6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8021a8:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8021ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b0:	bf 02 00 00 00       	mov    $0x2,%edi
+  8021b5:	48 b8 fb 20 80 00 00 	movabs $0x8020fb,%rax
+  8021bc:	00 00 00 
+  8021bf:	ff d0                	call   *%rax
+}
+  8021c1:	5d                   	pop    %rbp
+  8021c2:	c3                   	ret
+
+00000000008021c3 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8021c3:	55                   	push   %rbp
+  8021c4:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8021c7:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8021ca:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021d1:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8021d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8021d8:	bf 06 00 00 00       	mov    $0x6,%edi
+  8021dd:	48 b8 fb 20 80 00 00 	movabs $0x8020fb,%rax
+  8021e4:	00 00 00 
+  8021e7:	ff d0                	call   *%rax
+}
+  8021e9:	5d                   	pop    %rbp
+  8021ea:	c3                   	ret
+
+00000000008021eb <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8021eb:	55                   	push   %rbp
+  8021ec:	48 89 e5             	mov    %rsp,%rbp
+  8021ef:	41 54                	push   %r12
+  8021f1:	53                   	push   %rbx
+  8021f2:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8021f5:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8021f8:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021ff:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802201:	be 00 00 00 00       	mov    $0x0,%esi
+  802206:	bf 05 00 00 00       	mov    $0x5,%edi
+  80220b:	48 b8 fb 20 80 00 00 	movabs $0x8020fb,%rax
+  802212:	00 00 00 
+  802215:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802217:	85 c0                	test   %eax,%eax
+  802219:	78 3d                	js     802258 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80221b:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802222:	00 00 00 
+  802225:	4c 89 e6             	mov    %r12,%rsi
+  802228:	48 89 df             	mov    %rbx,%rdi
+  80222b:	48 b8 31 0b 80 00 00 	movabs $0x800b31,%rax
+  802232:	00 00 00 
+  802235:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802237:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80223e:	00 
+  80223f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802245:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80224c:	00 
+  80224d:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802253:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802258:	5b                   	pop    %rbx
+  802259:	41 5c                	pop    %r12
+  80225b:	5d                   	pop    %rbp
+  80225c:	c3                   	ret
+
+000000000080225d <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80225d:	55                   	push   %rbp
+  80225e:	48 89 e5             	mov    %rsp,%rbp
+  802261:	41 54                	push   %r12
+  802263:	53                   	push   %rbx
+  802264:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  802267:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80226c:	48 39 c2             	cmp    %rax,%rdx
+  80226f:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802273:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802276:	48 89 c2             	mov    %rax,%rdx
+  802279:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802280:	00 00 00 
+  802283:	48 b8 92 0d 80 00 00 	movabs $0x800d92,%rax
+  80228a:	00 00 00 
+  80228d:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80228f:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802296:	00 00 00 
+  802299:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80229e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8022a0:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8022a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022ae:	48 b8 fb 20 80 00 00 	movabs $0x8020fb,%rax
+  8022b5:	00 00 00 
+  8022b8:	ff d0                	call   *%rax
+  8022ba:	48 98                	cltq
+}
+  8022bc:	5b                   	pop    %rbx
+  8022bd:	41 5c                	pop    %r12
+  8022bf:	5d                   	pop    %rbp
+  8022c0:	c3                   	ret
+
+00000000008022c1 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8022c1:	55                   	push   %rbp
+  8022c2:	48 89 e5             	mov    %rsp,%rbp
+  8022c5:	41 54                	push   %r12
+  8022c7:	53                   	push   %rbx
+  8022c8:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022cb:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022d2:	00 00 00 
+  8022d5:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8022d8:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8022da:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022df:	48 39 ca             	cmp    %rcx,%rdx
+  8022e2:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8022e6:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8022ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ef:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022f4:	48 b8 fb 20 80 00 00 	movabs $0x8020fb,%rax
+  8022fb:	00 00 00 
+  8022fe:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802300:	85 c0                	test   %eax,%eax
+  802302:	78 27                	js     80232b <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802304:	48 63 d8             	movslq %eax,%rbx
+  802307:	48 89 da             	mov    %rbx,%rdx
+  80230a:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802311:	00 00 00 
+  802314:	4c 89 e7             	mov    %r12,%rdi
+  802317:	48 b8 92 0d 80 00 00 	movabs $0x800d92,%rax
+  80231e:	00 00 00 
+  802321:	ff d0                	call   *%rax
+    return bytes_read;
+  802323:	48 89 d8             	mov    %rbx,%rax
+}
+  802326:	5b                   	pop    %rbx
+  802327:	41 5c                	pop    %r12
+  802329:	5d                   	pop    %rbp
+  80232a:	c3                   	ret
+        return bytes_read;
+  80232b:	48 98                	cltq
+  80232d:	eb f7                	jmp    802326 <devfile_read+0x65>
+
+000000000080232f <open>:
+open(const char *path, int mode) {
+  80232f:	55                   	push   %rbp
+  802330:	48 89 e5             	mov    %rsp,%rbp
+  802333:	41 55                	push   %r13
+  802335:	41 54                	push   %r12
+  802337:	53                   	push   %rbx
+  802338:	48 83 ec 18          	sub    $0x18,%rsp
+  80233c:	49 89 fc             	mov    %rdi,%r12
+  80233f:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802342:	48 b8 f3 0a 80 00 00 	movabs $0x800af3,%rax
+  802349:	00 00 00 
+  80234c:	ff d0                	call   *%rax
+  80234e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802354:	0f 87 8a 00 00 00    	ja     8023e4 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80235a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80235e:	48 b8 2e 1a 80 00 00 	movabs $0x801a2e,%rax
+  802365:	00 00 00 
+  802368:	ff d0                	call   *%rax
+  80236a:	89 c3                	mov    %eax,%ebx
+  80236c:	85 c0                	test   %eax,%eax
+  80236e:	78 50                	js     8023c0 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802370:	4c 89 e6             	mov    %r12,%rsi
+  802373:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80237a:	00 00 00 
+  80237d:	48 89 df             	mov    %rbx,%rdi
+  802380:	48 b8 31 0b 80 00 00 	movabs $0x800b31,%rax
+  802387:	00 00 00 
+  80238a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80238c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802393:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802397:	bf 01 00 00 00       	mov    $0x1,%edi
+  80239c:	48 b8 fb 20 80 00 00 	movabs $0x8020fb,%rax
+  8023a3:	00 00 00 
+  8023a6:	ff d0                	call   *%rax
+  8023a8:	89 c3                	mov    %eax,%ebx
+  8023aa:	85 c0                	test   %eax,%eax
+  8023ac:	78 1f                	js     8023cd <open+0x9e>
+    return fd2num(fd);
+  8023ae:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8023b2:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  8023b9:	00 00 00 
+  8023bc:	ff d0                	call   *%rax
+  8023be:	89 c3                	mov    %eax,%ebx
+}
+  8023c0:	89 d8                	mov    %ebx,%eax
+  8023c2:	48 83 c4 18          	add    $0x18,%rsp
+  8023c6:	5b                   	pop    %rbx
+  8023c7:	41 5c                	pop    %r12
+  8023c9:	41 5d                	pop    %r13
+  8023cb:	5d                   	pop    %rbp
+  8023cc:	c3                   	ret
+        fd_close(fd, 0);
+  8023cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8023d6:	48 b8 49 1b 80 00 00 	movabs $0x801b49,%rax
+  8023dd:	00 00 00 
+  8023e0:	ff d0                	call   *%rax
+        return res;
+  8023e2:	eb dc                	jmp    8023c0 <open+0x91>
+        return -E_BAD_PATH;
+  8023e4:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8023e9:	eb d5                	jmp    8023c0 <open+0x91>
+
+00000000008023eb <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8023eb:	55                   	push   %rbp
+  8023ec:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8023ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f4:	bf 08 00 00 00       	mov    $0x8,%edi
+  8023f9:	48 b8 fb 20 80 00 00 	movabs $0x8020fb,%rax
+  802400:	00 00 00 
+  802403:	ff d0                	call   *%rax
+}
+  802405:	5d                   	pop    %rbp
+  802406:	c3                   	ret
+
+0000000000802407 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802407:	55                   	push   %rbp
+  802408:	48 89 e5             	mov    %rsp,%rbp
+  80240b:	41 54                	push   %r12
+  80240d:	53                   	push   %rbx
+  80240e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802411:	48 b8 12 1a 80 00 00 	movabs $0x801a12,%rax
+  802418:	00 00 00 
+  80241b:	ff d0                	call   *%rax
+  80241d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802420:	48 be 20 38 80 00 00 	movabs $0x803820,%rsi
+  802427:	00 00 00 
+  80242a:	48 89 df             	mov    %rbx,%rdi
+  80242d:	48 b8 31 0b 80 00 00 	movabs $0x800b31,%rax
+  802434:	00 00 00 
+  802437:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802439:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80243e:	41 2b 04 24          	sub    (%r12),%eax
+  802442:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802448:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80244f:	00 00 00 
+    stat->st_dev = &devpipe;
+  802452:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802459:	00 00 00 
+  80245c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802463:	b8 00 00 00 00       	mov    $0x0,%eax
+  802468:	5b                   	pop    %rbx
+  802469:	41 5c                	pop    %r12
+  80246b:	5d                   	pop    %rbp
+  80246c:	c3                   	ret
+
+000000000080246d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80246d:	55                   	push   %rbp
+  80246e:	48 89 e5             	mov    %rsp,%rbp
+  802471:	41 54                	push   %r12
+  802473:	53                   	push   %rbx
+  802474:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802477:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80247c:	48 89 fe             	mov    %rdi,%rsi
+  80247f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802484:	49 bc ad 11 80 00 00 	movabs $0x8011ad,%r12
+  80248b:	00 00 00 
+  80248e:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802491:	48 89 df             	mov    %rbx,%rdi
+  802494:	48 b8 12 1a 80 00 00 	movabs $0x801a12,%rax
+  80249b:	00 00 00 
+  80249e:	ff d0                	call   *%rax
+  8024a0:	48 89 c6             	mov    %rax,%rsi
+  8024a3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024ad:	41 ff d4             	call   *%r12
+}
+  8024b0:	5b                   	pop    %rbx
+  8024b1:	41 5c                	pop    %r12
+  8024b3:	5d                   	pop    %rbp
+  8024b4:	c3                   	ret
+
+00000000008024b5 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8024b5:	55                   	push   %rbp
+  8024b6:	48 89 e5             	mov    %rsp,%rbp
+  8024b9:	41 57                	push   %r15
+  8024bb:	41 56                	push   %r14
+  8024bd:	41 55                	push   %r13
+  8024bf:	41 54                	push   %r12
+  8024c1:	53                   	push   %rbx
+  8024c2:	48 83 ec 18          	sub    $0x18,%rsp
+  8024c6:	49 89 fc             	mov    %rdi,%r12
+  8024c9:	49 89 f5             	mov    %rsi,%r13
+  8024cc:	49 89 d7             	mov    %rdx,%r15
+  8024cf:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024d3:	48 b8 12 1a 80 00 00 	movabs $0x801a12,%rax
+  8024da:	00 00 00 
+  8024dd:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8024df:	4d 85 ff             	test   %r15,%r15
+  8024e2:	0f 84 af 00 00 00    	je     802597 <devpipe_write+0xe2>
+  8024e8:	48 89 c3             	mov    %rax,%rbx
+  8024eb:	4c 89 f8             	mov    %r15,%rax
+  8024ee:	4d 89 ef             	mov    %r13,%r15
+  8024f1:	4c 01 e8             	add    %r13,%rax
+  8024f4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8024f8:	49 bd b5 10 80 00 00 	movabs $0x8010b5,%r13
+  8024ff:	00 00 00 
+            sys_yield();
+  802502:	49 be 52 10 80 00 00 	movabs $0x801052,%r14
+  802509:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80250c:	8b 73 04             	mov    0x4(%rbx),%esi
+  80250f:	48 63 ce             	movslq %esi,%rcx
+  802512:	48 63 03             	movslq (%rbx),%rax
+  802515:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80251b:	48 39 c1             	cmp    %rax,%rcx
+  80251e:	72 2e                	jb     80254e <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802520:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802525:	48 89 da             	mov    %rbx,%rdx
+  802528:	be 00 10 00 00       	mov    $0x1000,%esi
+  80252d:	4c 89 e7             	mov    %r12,%rdi
+  802530:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802533:	85 c0                	test   %eax,%eax
+  802535:	74 66                	je     80259d <devpipe_write+0xe8>
+            sys_yield();
+  802537:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80253a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80253d:	48 63 ce             	movslq %esi,%rcx
+  802540:	48 63 03             	movslq (%rbx),%rax
+  802543:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802549:	48 39 c1             	cmp    %rax,%rcx
+  80254c:	73 d2                	jae    802520 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80254e:	41 0f b6 3f          	movzbl (%r15),%edi
+  802552:	48 89 ca             	mov    %rcx,%rdx
+  802555:	48 c1 ea 03          	shr    $0x3,%rdx
+  802559:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802560:	08 10 20 
+  802563:	48 f7 e2             	mul    %rdx
+  802566:	48 c1 ea 06          	shr    $0x6,%rdx
+  80256a:	48 89 d0             	mov    %rdx,%rax
+  80256d:	48 c1 e0 09          	shl    $0x9,%rax
+  802571:	48 29 d0             	sub    %rdx,%rax
+  802574:	48 c1 e0 03          	shl    $0x3,%rax
+  802578:	48 29 c1             	sub    %rax,%rcx
+  80257b:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802580:	83 c6 01             	add    $0x1,%esi
+  802583:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802586:	49 83 c7 01          	add    $0x1,%r15
+  80258a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80258e:	49 39 c7             	cmp    %rax,%r15
+  802591:	0f 85 75 ff ff ff    	jne    80250c <devpipe_write+0x57>
+    return n;
+  802597:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80259b:	eb 05                	jmp    8025a2 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80259d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025a2:	48 83 c4 18          	add    $0x18,%rsp
+  8025a6:	5b                   	pop    %rbx
+  8025a7:	41 5c                	pop    %r12
+  8025a9:	41 5d                	pop    %r13
+  8025ab:	41 5e                	pop    %r14
+  8025ad:	41 5f                	pop    %r15
+  8025af:	5d                   	pop    %rbp
+  8025b0:	c3                   	ret
+
+00000000008025b1 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8025b1:	55                   	push   %rbp
+  8025b2:	48 89 e5             	mov    %rsp,%rbp
+  8025b5:	41 57                	push   %r15
+  8025b7:	41 56                	push   %r14
+  8025b9:	41 55                	push   %r13
+  8025bb:	41 54                	push   %r12
+  8025bd:	53                   	push   %rbx
+  8025be:	48 83 ec 18          	sub    $0x18,%rsp
+  8025c2:	49 89 fc             	mov    %rdi,%r12
+  8025c5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8025c9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025cd:	48 b8 12 1a 80 00 00 	movabs $0x801a12,%rax
+  8025d4:	00 00 00 
+  8025d7:	ff d0                	call   *%rax
+  8025d9:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8025dc:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025e2:	49 bd b5 10 80 00 00 	movabs $0x8010b5,%r13
+  8025e9:	00 00 00 
+            sys_yield();
+  8025ec:	49 be 52 10 80 00 00 	movabs $0x801052,%r14
+  8025f3:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8025f6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8025fb:	74 7d                	je     80267a <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8025fd:	8b 03                	mov    (%rbx),%eax
+  8025ff:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802602:	75 26                	jne    80262a <devpipe_read+0x79>
+            if (i > 0) return i;
+  802604:	4d 85 ff             	test   %r15,%r15
+  802607:	75 77                	jne    802680 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802609:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80260e:	48 89 da             	mov    %rbx,%rdx
+  802611:	be 00 10 00 00       	mov    $0x1000,%esi
+  802616:	4c 89 e7             	mov    %r12,%rdi
+  802619:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80261c:	85 c0                	test   %eax,%eax
+  80261e:	74 72                	je     802692 <devpipe_read+0xe1>
+            sys_yield();
+  802620:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802623:	8b 03                	mov    (%rbx),%eax
+  802625:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802628:	74 df                	je     802609 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80262a:	48 63 c8             	movslq %eax,%rcx
+  80262d:	48 89 ca             	mov    %rcx,%rdx
+  802630:	48 c1 ea 03          	shr    $0x3,%rdx
+  802634:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80263b:	08 10 20 
+  80263e:	48 89 d0             	mov    %rdx,%rax
+  802641:	48 f7 e6             	mul    %rsi
+  802644:	48 c1 ea 06          	shr    $0x6,%rdx
+  802648:	48 89 d0             	mov    %rdx,%rax
+  80264b:	48 c1 e0 09          	shl    $0x9,%rax
+  80264f:	48 29 d0             	sub    %rdx,%rax
+  802652:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802659:	00 
+  80265a:	48 89 c8             	mov    %rcx,%rax
+  80265d:	48 29 d0             	sub    %rdx,%rax
+  802660:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802665:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802669:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80266d:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802670:	49 83 c7 01          	add    $0x1,%r15
+  802674:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802678:	75 83                	jne    8025fd <devpipe_read+0x4c>
+    return n;
+  80267a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80267e:	eb 03                	jmp    802683 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802680:	4c 89 f8             	mov    %r15,%rax
+}
+  802683:	48 83 c4 18          	add    $0x18,%rsp
+  802687:	5b                   	pop    %rbx
+  802688:	41 5c                	pop    %r12
+  80268a:	41 5d                	pop    %r13
+  80268c:	41 5e                	pop    %r14
+  80268e:	41 5f                	pop    %r15
+  802690:	5d                   	pop    %rbp
+  802691:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802692:	b8 00 00 00 00       	mov    $0x0,%eax
+  802697:	eb ea                	jmp    802683 <devpipe_read+0xd2>
+
+0000000000802699 <pipe>:
+pipe(int pfd[2]) {
+  802699:	55                   	push   %rbp
+  80269a:	48 89 e5             	mov    %rsp,%rbp
+  80269d:	41 55                	push   %r13
+  80269f:	41 54                	push   %r12
+  8026a1:	53                   	push   %rbx
+  8026a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8026a6:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8026a9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8026ad:	48 b8 2e 1a 80 00 00 	movabs $0x801a2e,%rax
+  8026b4:	00 00 00 
+  8026b7:	ff d0                	call   *%rax
+  8026b9:	89 c3                	mov    %eax,%ebx
+  8026bb:	85 c0                	test   %eax,%eax
+  8026bd:	0f 88 a0 01 00 00    	js     802863 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8026c3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8026c8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026cd:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8026d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026d6:	48 b8 e1 10 80 00 00 	movabs $0x8010e1,%rax
+  8026dd:	00 00 00 
+  8026e0:	ff d0                	call   *%rax
+  8026e2:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8026e4:	85 c0                	test   %eax,%eax
+  8026e6:	0f 88 77 01 00 00    	js     802863 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8026ec:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8026f0:	48 b8 2e 1a 80 00 00 	movabs $0x801a2e,%rax
+  8026f7:	00 00 00 
+  8026fa:	ff d0                	call   *%rax
+  8026fc:	89 c3                	mov    %eax,%ebx
+  8026fe:	85 c0                	test   %eax,%eax
+  802700:	0f 88 43 01 00 00    	js     802849 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802706:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80270b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802710:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802714:	bf 00 00 00 00       	mov    $0x0,%edi
+  802719:	48 b8 e1 10 80 00 00 	movabs $0x8010e1,%rax
+  802720:	00 00 00 
+  802723:	ff d0                	call   *%rax
+  802725:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802727:	85 c0                	test   %eax,%eax
+  802729:	0f 88 1a 01 00 00    	js     802849 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80272f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802733:	48 b8 12 1a 80 00 00 	movabs $0x801a12,%rax
+  80273a:	00 00 00 
+  80273d:	ff d0                	call   *%rax
+  80273f:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802742:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802747:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80274c:	48 89 c6             	mov    %rax,%rsi
+  80274f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802754:	48 b8 e1 10 80 00 00 	movabs $0x8010e1,%rax
+  80275b:	00 00 00 
+  80275e:	ff d0                	call   *%rax
+  802760:	89 c3                	mov    %eax,%ebx
+  802762:	85 c0                	test   %eax,%eax
+  802764:	0f 88 c5 00 00 00    	js     80282f <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80276a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80276e:	48 b8 12 1a 80 00 00 	movabs $0x801a12,%rax
+  802775:	00 00 00 
+  802778:	ff d0                	call   *%rax
+  80277a:	48 89 c1             	mov    %rax,%rcx
+  80277d:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802783:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802789:	ba 00 00 00 00       	mov    $0x0,%edx
+  80278e:	4c 89 ee             	mov    %r13,%rsi
+  802791:	bf 00 00 00 00       	mov    $0x0,%edi
+  802796:	48 b8 48 11 80 00 00 	movabs $0x801148,%rax
+  80279d:	00 00 00 
+  8027a0:	ff d0                	call   *%rax
+  8027a2:	89 c3                	mov    %eax,%ebx
+  8027a4:	85 c0                	test   %eax,%eax
+  8027a6:	78 6e                	js     802816 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8027a8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8027ad:	4c 89 ef             	mov    %r13,%rdi
+  8027b0:	48 b8 83 10 80 00 00 	movabs $0x801083,%rax
+  8027b7:	00 00 00 
+  8027ba:	ff d0                	call   *%rax
+  8027bc:	83 f8 02             	cmp    $0x2,%eax
+  8027bf:	0f 85 ab 00 00 00    	jne    802870 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8027c5:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8027cc:	00 00 
+  8027ce:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8027d2:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8027d4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8027d8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8027df:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8027e3:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8027e5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027e9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8027f0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027f4:	48 bb 00 1a 80 00 00 	movabs $0x801a00,%rbx
+  8027fb:	00 00 00 
+  8027fe:	ff d3                	call   *%rbx
+  802800:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802804:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802808:	ff d3                	call   *%rbx
+  80280a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80280f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802814:	eb 4d                	jmp    802863 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802816:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80281b:	4c 89 ee             	mov    %r13,%rsi
+  80281e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802823:	48 b8 ad 11 80 00 00 	movabs $0x8011ad,%rax
+  80282a:	00 00 00 
+  80282d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80282f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802834:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802838:	bf 00 00 00 00       	mov    $0x0,%edi
+  80283d:	48 b8 ad 11 80 00 00 	movabs $0x8011ad,%rax
+  802844:	00 00 00 
+  802847:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802849:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80284e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802852:	bf 00 00 00 00       	mov    $0x0,%edi
+  802857:	48 b8 ad 11 80 00 00 	movabs $0x8011ad,%rax
+  80285e:	00 00 00 
+  802861:	ff d0                	call   *%rax
+}
+  802863:	89 d8                	mov    %ebx,%eax
+  802865:	48 83 c4 18          	add    $0x18,%rsp
+  802869:	5b                   	pop    %rbx
+  80286a:	41 5c                	pop    %r12
+  80286c:	41 5d                	pop    %r13
+  80286e:	5d                   	pop    %rbp
+  80286f:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802870:	48 b9 38 38 80 00 00 	movabs $0x803838,%rcx
+  802877:	00 00 00 
+  80287a:	48 ba 57 37 80 00 00 	movabs $0x803757,%rdx
+  802881:	00 00 00 
+  802884:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802889:	48 bf 27 38 80 00 00 	movabs $0x803827,%rdi
+  802890:	00 00 00 
+  802893:	b8 00 00 00 00       	mov    $0x0,%eax
+  802898:	49 b8 b0 2e 80 00 00 	movabs $0x802eb0,%r8
+  80289f:	00 00 00 
+  8028a2:	41 ff d0             	call   *%r8
+
+00000000008028a5 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8028a5:	55                   	push   %rbp
+  8028a6:	48 89 e5             	mov    %rsp,%rbp
+  8028a9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8028ad:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8028b1:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  8028b8:	00 00 00 
+  8028bb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028bd:	85 c0                	test   %eax,%eax
+  8028bf:	78 35                	js     8028f6 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8028c1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8028c5:	48 b8 12 1a 80 00 00 	movabs $0x801a12,%rax
+  8028cc:	00 00 00 
+  8028cf:	ff d0                	call   *%rax
+  8028d1:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8028d4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8028d9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028de:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8028e2:	48 b8 b5 10 80 00 00 	movabs $0x8010b5,%rax
+  8028e9:	00 00 00 
+  8028ec:	ff d0                	call   *%rax
+  8028ee:	85 c0                	test   %eax,%eax
+  8028f0:	0f 94 c0             	sete   %al
+  8028f3:	0f b6 c0             	movzbl %al,%eax
+}
+  8028f6:	c9                   	leave
+  8028f7:	c3                   	ret
+
+00000000008028f8 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8028f8:	48 89 f8             	mov    %rdi,%rax
+  8028fb:	48 c1 e8 27          	shr    $0x27,%rax
+  8028ff:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802906:	01 00 00 
+  802909:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80290d:	f6 c2 01             	test   $0x1,%dl
+  802910:	74 6d                	je     80297f <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802912:	48 89 f8             	mov    %rdi,%rax
+  802915:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802919:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802920:	01 00 00 
+  802923:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802927:	f6 c2 01             	test   $0x1,%dl
+  80292a:	74 62                	je     80298e <get_uvpt_entry+0x96>
+  80292c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802933:	01 00 00 
+  802936:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80293a:	f6 c2 80             	test   $0x80,%dl
+  80293d:	75 4f                	jne    80298e <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80293f:	48 89 f8             	mov    %rdi,%rax
+  802942:	48 c1 e8 15          	shr    $0x15,%rax
+  802946:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80294d:	01 00 00 
+  802950:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802954:	f6 c2 01             	test   $0x1,%dl
+  802957:	74 44                	je     80299d <get_uvpt_entry+0xa5>
+  802959:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802960:	01 00 00 
+  802963:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802967:	f6 c2 80             	test   $0x80,%dl
+  80296a:	75 31                	jne    80299d <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80296c:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802970:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802977:	01 00 00 
+  80297a:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80297e:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80297f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802986:	01 00 00 
+  802989:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80298d:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80298e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802995:	01 00 00 
+  802998:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80299c:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80299d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8029a4:	01 00 00 
+  8029a7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029ab:	c3                   	ret
+
+00000000008029ac <get_prot>:
+
+int
+get_prot(void *va) {
+  8029ac:	55                   	push   %rbp
+  8029ad:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8029b0:	48 b8 f8 28 80 00 00 	movabs $0x8028f8,%rax
+  8029b7:	00 00 00 
+  8029ba:	ff d0                	call   *%rax
+  8029bc:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8029bf:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8029c4:	89 c1                	mov    %eax,%ecx
+  8029c6:	83 c9 04             	or     $0x4,%ecx
+  8029c9:	f6 c2 01             	test   $0x1,%dl
+  8029cc:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8029cf:	89 c1                	mov    %eax,%ecx
+  8029d1:	83 c9 02             	or     $0x2,%ecx
+  8029d4:	f6 c2 02             	test   $0x2,%dl
+  8029d7:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8029da:	89 c1                	mov    %eax,%ecx
+  8029dc:	83 c9 01             	or     $0x1,%ecx
+  8029df:	48 85 d2             	test   %rdx,%rdx
+  8029e2:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8029e5:	89 c1                	mov    %eax,%ecx
+  8029e7:	83 c9 40             	or     $0x40,%ecx
+  8029ea:	f6 c6 04             	test   $0x4,%dh
+  8029ed:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8029f0:	5d                   	pop    %rbp
+  8029f1:	c3                   	ret
+
+00000000008029f2 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8029f2:	55                   	push   %rbp
+  8029f3:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8029f6:	48 b8 f8 28 80 00 00 	movabs $0x8028f8,%rax
+  8029fd:	00 00 00 
+  802a00:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802a02:	48 c1 e8 06          	shr    $0x6,%rax
+  802a06:	83 e0 01             	and    $0x1,%eax
+}
+  802a09:	5d                   	pop    %rbp
+  802a0a:	c3                   	ret
+
+0000000000802a0b <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802a0b:	55                   	push   %rbp
+  802a0c:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802a0f:	48 b8 f8 28 80 00 00 	movabs $0x8028f8,%rax
+  802a16:	00 00 00 
+  802a19:	ff d0                	call   *%rax
+  802a1b:	83 e0 01             	and    $0x1,%eax
+}
+  802a1e:	5d                   	pop    %rbp
+  802a1f:	c3                   	ret
+
+0000000000802a20 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802a20:	55                   	push   %rbp
+  802a21:	48 89 e5             	mov    %rsp,%rbp
+  802a24:	41 57                	push   %r15
+  802a26:	41 56                	push   %r14
+  802a28:	41 55                	push   %r13
+  802a2a:	41 54                	push   %r12
+  802a2c:	53                   	push   %rbx
+  802a2d:	48 83 ec 18          	sub    $0x18,%rsp
+  802a31:	49 89 ff             	mov    %rdi,%r15
+  802a34:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802a38:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802a3d:	49 bc 0b 2a 80 00 00 	movabs $0x802a0b,%r12
+  802a44:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802a47:	49 be ac 29 80 00 00 	movabs $0x8029ac,%r14
+  802a4e:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802a51:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802a58:	00 00 00 
+  802a5b:	eb 0c                	jmp    802a69 <foreach_shared_region+0x49>
+  802a5d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802a64:	4c 39 eb             	cmp    %r13,%rbx
+  802a67:	74 38                	je     802aa1 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802a69:	48 89 df             	mov    %rbx,%rdi
+  802a6c:	41 ff d4             	call   *%r12
+  802a6f:	84 c0                	test   %al,%al
+  802a71:	74 ea                	je     802a5d <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802a73:	48 89 df             	mov    %rbx,%rdi
+  802a76:	41 ff d6             	call   *%r14
+  802a79:	a8 40                	test   $0x40,%al
+  802a7b:	74 e0                	je     802a5d <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802a7d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802a84:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802a88:	48 89 df             	mov    %rbx,%rdi
+  802a8b:	41 ff d7             	call   *%r15
+        if (err)
+  802a8e:	85 c0                	test   %eax,%eax
+  802a90:	74 cb                	je     802a5d <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802a92:	48 83 c4 18          	add    $0x18,%rsp
+  802a96:	5b                   	pop    %rbx
+  802a97:	41 5c                	pop    %r12
+  802a99:	41 5d                	pop    %r13
+  802a9b:	41 5e                	pop    %r14
+  802a9d:	41 5f                	pop    %r15
+  802a9f:	5d                   	pop    %rbp
+  802aa0:	c3                   	ret
+    return 0;
+  802aa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa6:	eb ea                	jmp    802a92 <foreach_shared_region+0x72>
+
+0000000000802aa8 <_generic_signal_handler>:
+        (es->sa.sa_handler)(es->signo);
+    }
+}
+
+void
+_generic_signal_handler(struct UTrapframe *utf, struct EnqueuedSignal * es) {
+  802aa8:	55                   	push   %rbp
+  802aa9:	48 89 e5             	mov    %rsp,%rbp
+  802aac:	41 55                	push   %r13
+  802aae:	41 54                	push   %r12
+  802ab0:	53                   	push   %rbx
+  802ab1:	48 83 ec 08          	sub    $0x8,%rsp
+  802ab5:	49 89 fc             	mov    %rdi,%r12
+  802ab8:	48 89 f3             	mov    %rsi,%rbx
+    if (trace_signals)
+        cprintf("signals: env %x: begin generic handler for %d\n", sys_getenvid(), es->signo);
+  802abb:	44 8b 2e             	mov    (%rsi),%r13d
+  802abe:	48 b8 21 10 80 00 00 	movabs $0x801021,%rax
+  802ac5:	00 00 00 
+  802ac8:	ff d0                	call   *%rax
+  802aca:	89 c6                	mov    %eax,%esi
+  802acc:	44 89 ea             	mov    %r13d,%edx
+  802acf:	48 bf 60 38 80 00 00 	movabs $0x803860,%rdi
+  802ad6:	00 00 00 
+  802ad9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ade:	48 b9 0c 02 80 00 00 	movabs $0x80020c,%rcx
+  802ae5:	00 00 00 
+  802ae8:	ff d1                	call   *%rcx
+    if (es->sa.sa_handler == SIG_DFL) {
+  802aea:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802aee:	48 85 c0             	test   %rax,%rax
+  802af1:	74 57                	je     802b4a <_generic_signal_handler+0xa2>
+    if (es->sa.sa_handler == SIG_IGN) {
+  802af3:	48 83 f8 01          	cmp    $0x1,%rax
+  802af7:	0f 84 c0 00 00 00    	je     802bbd <_generic_signal_handler+0x115>
+    if (es->sa.sa_flags & SA_SIGINFO) {
+  802afd:	f6 43 14 04          	testb  $0x4,0x14(%rbx)
+  802b01:	0f 84 ea 00 00 00    	je     802bf1 <_generic_signal_handler+0x149>
+        (es->sa.sa_sigaction)(es->signo, &(es->info), utf);
+  802b07:	48 8d 73 18          	lea    0x18(%rbx),%rsi
+  802b0b:	8b 3b                	mov    (%rbx),%edi
+  802b0d:	4c 89 e2             	mov    %r12,%rdx
+  802b10:	ff d0                	call   *%rax
+
+    _generic_signal_handler_impl(utf, es);
+
+    if (trace_signals)
+        cprintf("signals: env %x: end generic handler for %d\n", sys_getenvid(), es->signo);
+  802b12:	8b 1b                	mov    (%rbx),%ebx
+  802b14:	48 b8 21 10 80 00 00 	movabs $0x801021,%rax
+  802b1b:	00 00 00 
+  802b1e:	ff d0                	call   *%rax
+  802b20:	89 c6                	mov    %eax,%esi
+  802b22:	89 da                	mov    %ebx,%edx
+  802b24:	48 bf e8 38 80 00 00 	movabs $0x8038e8,%rdi
+  802b2b:	00 00 00 
+  802b2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b33:	48 b9 0c 02 80 00 00 	movabs $0x80020c,%rcx
+  802b3a:	00 00 00 
+  802b3d:	ff d1                	call   *%rcx
+}
+  802b3f:	48 83 c4 08          	add    $0x8,%rsp
+  802b43:	5b                   	pop    %rbx
+  802b44:	41 5c                	pop    %r12
+  802b46:	41 5d                	pop    %r13
+  802b48:	5d                   	pop    %rbp
+  802b49:	c3                   	ret
+            cprintf("signals: env %x: exiting due to signal %d\n", sys_getenvid(), es->signo);
+  802b4a:	8b 1b                	mov    (%rbx),%ebx
+  802b4c:	48 b8 21 10 80 00 00 	movabs $0x801021,%rax
+  802b53:	00 00 00 
+  802b56:	ff d0                	call   *%rax
+  802b58:	89 c6                	mov    %eax,%esi
+  802b5a:	89 da                	mov    %ebx,%edx
+  802b5c:	48 bf 90 38 80 00 00 	movabs $0x803890,%rdi
+  802b63:	00 00 00 
+  802b66:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b6b:	48 b9 0c 02 80 00 00 	movabs $0x80020c,%rcx
+  802b72:	00 00 00 
+  802b75:	ff d1                	call   *%rcx
+        sys_env_destroy(CURENVID);
+  802b77:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b7c:	48 b8 b6 0f 80 00 00 	movabs $0x800fb6,%rax
+  802b83:	00 00 00 
+  802b86:	ff d0                	call   *%rax
+        assert(false);
+  802b88:	48 b9 15 39 80 00 00 	movabs $0x803915,%rcx
+  802b8f:	00 00 00 
+  802b92:	48 ba 57 37 80 00 00 	movabs $0x803757,%rdx
+  802b99:	00 00 00 
+  802b9c:	be 0c 00 00 00       	mov    $0xc,%esi
+  802ba1:	48 bf 1b 39 80 00 00 	movabs $0x80391b,%rdi
+  802ba8:	00 00 00 
+  802bab:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb0:	49 b8 b0 2e 80 00 00 	movabs $0x802eb0,%r8
+  802bb7:	00 00 00 
+  802bba:	41 ff d0             	call   *%r8
+            cprintf("signals: env %x: ignoring signal %d\n", sys_getenvid(), es->signo);
+  802bbd:	44 8b 23             	mov    (%rbx),%r12d
+  802bc0:	48 b8 21 10 80 00 00 	movabs $0x801021,%rax
+  802bc7:	00 00 00 
+  802bca:	ff d0                	call   *%rax
+  802bcc:	89 c6                	mov    %eax,%esi
+  802bce:	44 89 e2             	mov    %r12d,%edx
+  802bd1:	48 bf c0 38 80 00 00 	movabs $0x8038c0,%rdi
+  802bd8:	00 00 00 
+  802bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be0:	48 b9 0c 02 80 00 00 	movabs $0x80020c,%rcx
+  802be7:	00 00 00 
+  802bea:	ff d1                	call   *%rcx
+        return;
+  802bec:	e9 21 ff ff ff       	jmp    802b12 <_generic_signal_handler+0x6a>
+        (es->sa.sa_handler)(es->signo);
+  802bf1:	8b 3b                	mov    (%rbx),%edi
+  802bf3:	ff d0                	call   *%rax
+  802bf5:	e9 18 ff ff ff       	jmp    802b12 <_generic_signal_handler+0x6a>
+
+0000000000802bfa <sigqueue>:
+
+int sigqueue(pid_t pid, int signo, const union sigval value) {
+  802bfa:	55                   	push   %rbp
+  802bfb:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigqueue(pid, signo, value);
+  802bfe:	48 b8 e5 14 80 00 00 	movabs $0x8014e5,%rax
+  802c05:	00 00 00 
+  802c08:	ff d0                	call   *%rax
+}
+  802c0a:	5d                   	pop    %rbp
+  802c0b:	c3                   	ret
+
+0000000000802c0c <sigwait>:
+
+int sigwait(const sigset_t * set, int * sig) {
+  802c0c:	55                   	push   %rbp
+  802c0d:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigwait(set, sig);
+  802c10:	48 b8 4c 15 80 00 00 	movabs $0x80154c,%rax
+  802c17:	00 00 00 
+  802c1a:	ff d0                	call   *%rax
+}
+  802c1c:	5d                   	pop    %rbp
+  802c1d:	c3                   	ret
+
+0000000000802c1e <sigaction>:
+
+extern void _signal_handler_trampoline(void);
+
+int sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  802c1e:	55                   	push   %rbp
+  802c1f:	48 89 e5             	mov    %rsp,%rbp
+  802c22:	41 55                	push   %r13
+  802c24:	41 54                	push   %r12
+  802c26:	53                   	push   %rbx
+  802c27:	48 83 ec 08          	sub    $0x8,%rsp
+  802c2b:	89 fb                	mov    %edi,%ebx
+  802c2d:	49 89 f4             	mov    %rsi,%r12
+  802c30:	49 89 d5             	mov    %rdx,%r13
+    int err = sys_env_set_pgfault_upcall(CURENVID, _signal_handler_trampoline);
+  802c33:	48 be 45 19 80 00 00 	movabs $0x801945,%rsi
+  802c3a:	00 00 00 
+  802c3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c42:	48 b8 b6 13 80 00 00 	movabs $0x8013b6,%rax
+  802c49:	00 00 00 
+  802c4c:	ff d0                	call   *%rax
+    if (err)
+  802c4e:	85 c0                	test   %eax,%eax
+  802c50:	74 0b                	je     802c5d <sigaction+0x3f>
+        return err;
+    return sys_sigaction(sig, act, oact);
+}
+  802c52:	48 83 c4 08          	add    $0x8,%rsp
+  802c56:	5b                   	pop    %rbx
+  802c57:	41 5c                	pop    %r12
+  802c59:	41 5d                	pop    %r13
+  802c5b:	5d                   	pop    %rbp
+  802c5c:	c3                   	ret
+    return sys_sigaction(sig, act, oact);
+  802c5d:	4c 89 ea             	mov    %r13,%rdx
+  802c60:	4c 89 e6             	mov    %r12,%rsi
+  802c63:	89 df                	mov    %ebx,%edi
+  802c65:	48 b8 b5 15 80 00 00 	movabs $0x8015b5,%rax
+  802c6c:	00 00 00 
+  802c6f:	ff d0                	call   *%rax
+  802c71:	eb df                	jmp    802c52 <sigaction+0x34>
+
+0000000000802c73 <sigprocmask>:
+
+int sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  802c73:	55                   	push   %rbp
+  802c74:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigprocmask(how, set, oldset);
+  802c77:	48 b8 1c 16 80 00 00 	movabs $0x80161c,%rax
+  802c7e:	00 00 00 
+  802c81:	ff d0                	call   *%rax
+}
+  802c83:	5d                   	pop    %rbp
+  802c84:	c3                   	ret
+
+0000000000802c85 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802c85:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8a:	c3                   	ret
+
+0000000000802c8b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802c8b:	55                   	push   %rbp
+  802c8c:	48 89 e5             	mov    %rsp,%rbp
+  802c8f:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802c92:	48 be 28 39 80 00 00 	movabs $0x803928,%rsi
+  802c99:	00 00 00 
+  802c9c:	48 b8 31 0b 80 00 00 	movabs $0x800b31,%rax
+  802ca3:	00 00 00 
+  802ca6:	ff d0                	call   *%rax
+    return 0;
+}
+  802ca8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cad:	5d                   	pop    %rbp
+  802cae:	c3                   	ret
+
+0000000000802caf <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802caf:	55                   	push   %rbp
+  802cb0:	48 89 e5             	mov    %rsp,%rbp
+  802cb3:	41 57                	push   %r15
+  802cb5:	41 56                	push   %r14
+  802cb7:	41 55                	push   %r13
+  802cb9:	41 54                	push   %r12
+  802cbb:	53                   	push   %rbx
+  802cbc:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802cc3:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802cca:	48 85 d2             	test   %rdx,%rdx
+  802ccd:	74 7a                	je     802d49 <devcons_write+0x9a>
+  802ccf:	49 89 d6             	mov    %rdx,%r14
+  802cd2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802cd8:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802cdd:	49 bf 2b 0d 80 00 00 	movabs $0x800d2b,%r15
+  802ce4:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802ce7:	4c 89 f3             	mov    %r14,%rbx
+  802cea:	48 29 f3             	sub    %rsi,%rbx
+  802ced:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802cf2:	48 39 c3             	cmp    %rax,%rbx
+  802cf5:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802cf9:	4c 63 eb             	movslq %ebx,%r13
+  802cfc:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d03:	48 01 c6             	add    %rax,%rsi
+  802d06:	4c 89 ea             	mov    %r13,%rdx
+  802d09:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d10:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802d13:	4c 89 ee             	mov    %r13,%rsi
+  802d16:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d1d:	48 b8 58 0f 80 00 00 	movabs $0x800f58,%rax
+  802d24:	00 00 00 
+  802d27:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802d29:	41 01 dc             	add    %ebx,%r12d
+  802d2c:	49 63 f4             	movslq %r12d,%rsi
+  802d2f:	4c 39 f6             	cmp    %r14,%rsi
+  802d32:	72 b3                	jb     802ce7 <devcons_write+0x38>
+    return res;
+  802d34:	49 63 c4             	movslq %r12d,%rax
+}
+  802d37:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802d3e:	5b                   	pop    %rbx
+  802d3f:	41 5c                	pop    %r12
+  802d41:	41 5d                	pop    %r13
+  802d43:	41 5e                	pop    %r14
+  802d45:	41 5f                	pop    %r15
+  802d47:	5d                   	pop    %rbp
+  802d48:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802d49:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d4f:	eb e3                	jmp    802d34 <devcons_write+0x85>
+
+0000000000802d51 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d51:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802d54:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d59:	48 85 c0             	test   %rax,%rax
+  802d5c:	74 55                	je     802db3 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d5e:	55                   	push   %rbp
+  802d5f:	48 89 e5             	mov    %rsp,%rbp
+  802d62:	41 55                	push   %r13
+  802d64:	41 54                	push   %r12
+  802d66:	53                   	push   %rbx
+  802d67:	48 83 ec 08          	sub    $0x8,%rsp
+  802d6b:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802d6e:	48 bb 85 0f 80 00 00 	movabs $0x800f85,%rbx
+  802d75:	00 00 00 
+  802d78:	49 bc 52 10 80 00 00 	movabs $0x801052,%r12
+  802d7f:	00 00 00 
+  802d82:	eb 03                	jmp    802d87 <devcons_read+0x36>
+  802d84:	41 ff d4             	call   *%r12
+  802d87:	ff d3                	call   *%rbx
+  802d89:	85 c0                	test   %eax,%eax
+  802d8b:	74 f7                	je     802d84 <devcons_read+0x33>
+    if (c < 0) return c;
+  802d8d:	48 63 d0             	movslq %eax,%rdx
+  802d90:	78 13                	js     802da5 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802d92:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d97:	83 f8 04             	cmp    $0x4,%eax
+  802d9a:	74 09                	je     802da5 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802d9c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802da0:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802da5:	48 89 d0             	mov    %rdx,%rax
+  802da8:	48 83 c4 08          	add    $0x8,%rsp
+  802dac:	5b                   	pop    %rbx
+  802dad:	41 5c                	pop    %r12
+  802daf:	41 5d                	pop    %r13
+  802db1:	5d                   	pop    %rbp
+  802db2:	c3                   	ret
+  802db3:	48 89 d0             	mov    %rdx,%rax
+  802db6:	c3                   	ret
+
+0000000000802db7 <cputchar>:
+cputchar(int ch) {
+  802db7:	55                   	push   %rbp
+  802db8:	48 89 e5             	mov    %rsp,%rbp
+  802dbb:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802dbf:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802dc3:	be 01 00 00 00       	mov    $0x1,%esi
+  802dc8:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802dcc:	48 b8 58 0f 80 00 00 	movabs $0x800f58,%rax
+  802dd3:	00 00 00 
+  802dd6:	ff d0                	call   *%rax
+}
+  802dd8:	c9                   	leave
+  802dd9:	c3                   	ret
+
+0000000000802dda <getchar>:
+getchar(void) {
+  802dda:	55                   	push   %rbp
+  802ddb:	48 89 e5             	mov    %rsp,%rbp
+  802dde:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802de2:	ba 01 00 00 00       	mov    $0x1,%edx
+  802de7:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802deb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802df0:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  802df7:	00 00 00 
+  802dfa:	ff d0                	call   *%rax
+  802dfc:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802dfe:	85 c0                	test   %eax,%eax
+  802e00:	78 06                	js     802e08 <getchar+0x2e>
+  802e02:	74 08                	je     802e0c <getchar+0x32>
+  802e04:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e08:	89 d0                	mov    %edx,%eax
+  802e0a:	c9                   	leave
+  802e0b:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e0c:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802e11:	eb f5                	jmp    802e08 <getchar+0x2e>
+
+0000000000802e13 <iscons>:
+iscons(int fdnum) {
+  802e13:	55                   	push   %rbp
+  802e14:	48 89 e5             	mov    %rsp,%rbp
+  802e17:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802e1b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e1f:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  802e26:	00 00 00 
+  802e29:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e2b:	85 c0                	test   %eax,%eax
+  802e2d:	78 18                	js     802e47 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802e2f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e33:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802e3a:	00 00 00 
+  802e3d:	8b 00                	mov    (%rax),%eax
+  802e3f:	39 02                	cmp    %eax,(%rdx)
+  802e41:	0f 94 c0             	sete   %al
+  802e44:	0f b6 c0             	movzbl %al,%eax
+}
+  802e47:	c9                   	leave
+  802e48:	c3                   	ret
+
+0000000000802e49 <opencons>:
+opencons(void) {
+  802e49:	55                   	push   %rbp
+  802e4a:	48 89 e5             	mov    %rsp,%rbp
+  802e4d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e51:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802e55:	48 b8 2e 1a 80 00 00 	movabs $0x801a2e,%rax
+  802e5c:	00 00 00 
+  802e5f:	ff d0                	call   *%rax
+  802e61:	85 c0                	test   %eax,%eax
+  802e63:	78 49                	js     802eae <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802e65:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e6a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e6f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802e73:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e78:	48 b8 e1 10 80 00 00 	movabs $0x8010e1,%rax
+  802e7f:	00 00 00 
+  802e82:	ff d0                	call   *%rax
+  802e84:	85 c0                	test   %eax,%eax
+  802e86:	78 26                	js     802eae <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802e88:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e8c:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802e93:	00 00 
+  802e95:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802e97:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802e9b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802ea2:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  802ea9:	00 00 00 
+  802eac:	ff d0                	call   *%rax
+}
+  802eae:	c9                   	leave
+  802eaf:	c3                   	ret
+
+0000000000802eb0 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802eb0:	55                   	push   %rbp
+  802eb1:	48 89 e5             	mov    %rsp,%rbp
+  802eb4:	41 56                	push   %r14
+  802eb6:	41 55                	push   %r13
+  802eb8:	41 54                	push   %r12
+  802eba:	53                   	push   %rbx
+  802ebb:	48 83 ec 50          	sub    $0x50,%rsp
+  802ebf:	49 89 fc             	mov    %rdi,%r12
+  802ec2:	41 89 f5             	mov    %esi,%r13d
+  802ec5:	48 89 d3             	mov    %rdx,%rbx
+  802ec8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802ecc:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802ed0:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802ed4:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802edb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802edf:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802ee3:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802ee7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802eeb:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802ef2:	00 00 00 
+  802ef5:	4c 8b 30             	mov    (%rax),%r14
+  802ef8:	48 b8 21 10 80 00 00 	movabs $0x801021,%rax
+  802eff:	00 00 00 
+  802f02:	ff d0                	call   *%rax
+  802f04:	89 c6                	mov    %eax,%esi
+  802f06:	45 89 e8             	mov    %r13d,%r8d
+  802f09:	4c 89 e1             	mov    %r12,%rcx
+  802f0c:	4c 89 f2             	mov    %r14,%rdx
+  802f0f:	48 bf 38 39 80 00 00 	movabs $0x803938,%rdi
+  802f16:	00 00 00 
+  802f19:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f1e:	49 bc 0c 02 80 00 00 	movabs $0x80020c,%r12
+  802f25:	00 00 00 
+  802f28:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802f2b:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802f2f:	48 89 df             	mov    %rbx,%rdi
+  802f32:	48 b8 a8 01 80 00 00 	movabs $0x8001a8,%rax
+  802f39:	00 00 00 
+  802f3c:	ff d0                	call   *%rax
+    cprintf("\n");
+  802f3e:	48 bf cb 37 80 00 00 	movabs $0x8037cb,%rdi
+  802f45:	00 00 00 
+  802f48:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f4d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802f50:	cc                   	int3
+  802f51:	eb fd                	jmp    802f50 <_panic+0xa0>
+
+0000000000802f53 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802f53:	55                   	push   %rbp
+  802f54:	48 89 e5             	mov    %rsp,%rbp
+  802f57:	41 54                	push   %r12
+  802f59:	53                   	push   %rbx
+  802f5a:	48 89 fb             	mov    %rdi,%rbx
+  802f5d:	48 89 f7             	mov    %rsi,%rdi
+  802f60:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802f63:	48 85 f6             	test   %rsi,%rsi
+  802f66:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f6d:	00 00 00 
+  802f70:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802f74:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f79:	48 b8 4b 14 80 00 00 	movabs $0x80144b,%rax
+  802f80:	00 00 00 
+  802f83:	ff d0                	call   *%rax
+    if (res < 0) {
+  802f85:	85 c0                	test   %eax,%eax
+  802f87:	78 45                	js     802fce <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802f89:	48 85 db             	test   %rbx,%rbx
+  802f8c:	74 12                	je     802fa0 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802f8e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f95:	00 00 00 
+  802f98:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802f9e:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802fa0:	4d 85 e4             	test   %r12,%r12
+  802fa3:	74 14                	je     802fb9 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802fa5:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802fac:	00 00 00 
+  802faf:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802fb5:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802fb9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802fc0:	00 00 00 
+  802fc3:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802fc9:	5b                   	pop    %rbx
+  802fca:	41 5c                	pop    %r12
+  802fcc:	5d                   	pop    %rbp
+  802fcd:	c3                   	ret
+        if (from_env_store)
+  802fce:	48 85 db             	test   %rbx,%rbx
+  802fd1:	74 06                	je     802fd9 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802fd3:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802fd9:	4d 85 e4             	test   %r12,%r12
+  802fdc:	74 eb                	je     802fc9 <ipc_recv+0x76>
+            *perm_store = 0;
+  802fde:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802fe5:	00 
+  802fe6:	eb e1                	jmp    802fc9 <ipc_recv+0x76>
+
+0000000000802fe8 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802fe8:	55                   	push   %rbp
+  802fe9:	48 89 e5             	mov    %rsp,%rbp
+  802fec:	41 57                	push   %r15
+  802fee:	41 56                	push   %r14
+  802ff0:	41 55                	push   %r13
+  802ff2:	41 54                	push   %r12
+  802ff4:	53                   	push   %rbx
+  802ff5:	48 83 ec 18          	sub    $0x18,%rsp
+  802ff9:	41 89 fd             	mov    %edi,%r13d
+  802ffc:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802fff:	48 89 d3             	mov    %rdx,%rbx
+  803002:	49 89 cc             	mov    %rcx,%r12
+  803005:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  803009:	48 85 d2             	test   %rdx,%rdx
+  80300c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803013:	00 00 00 
+  803016:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80301a:	49 be 1f 14 80 00 00 	movabs $0x80141f,%r14
+  803021:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  803024:	49 bf 52 10 80 00 00 	movabs $0x801052,%r15
+  80302b:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80302e:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803031:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  803035:	4c 89 e1             	mov    %r12,%rcx
+  803038:	48 89 da             	mov    %rbx,%rdx
+  80303b:	44 89 ef             	mov    %r13d,%edi
+  80303e:	41 ff d6             	call   *%r14
+        if (res == 0)
+  803041:	85 c0                	test   %eax,%eax
+  803043:	74 34                	je     803079 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  803045:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803048:	75 05                	jne    80304f <ipc_send+0x67>
+        sys_yield();
+  80304a:	41 ff d7             	call   *%r15
+    while (true) {
+  80304d:	eb df                	jmp    80302e <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  80304f:	48 ba 5b 39 80 00 00 	movabs $0x80395b,%rdx
+  803056:	00 00 00 
+  803059:	be 3e 00 00 00       	mov    $0x3e,%esi
+  80305e:	48 bf 74 39 80 00 00 	movabs $0x803974,%rdi
+  803065:	00 00 00 
+  803068:	b8 00 00 00 00       	mov    $0x0,%eax
+  80306d:	48 b9 b0 2e 80 00 00 	movabs $0x802eb0,%rcx
+  803074:	00 00 00 
+  803077:	ff d1                	call   *%rcx
+    }
+}
+  803079:	48 83 c4 18          	add    $0x18,%rsp
+  80307d:	5b                   	pop    %rbx
+  80307e:	41 5c                	pop    %r12
+  803080:	41 5d                	pop    %r13
+  803082:	41 5e                	pop    %r14
+  803084:	41 5f                	pop    %r15
+  803086:	5d                   	pop    %rbp
+  803087:	c3                   	ret
+
+0000000000803088 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803088:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80308d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803094:	00 00 00 
+  803097:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  80309e:	48 01 ca             	add    %rcx,%rdx
+  8030a1:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8030a7:	39 fa                	cmp    %edi,%edx
+  8030a9:	74 12                	je     8030bd <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8030ab:	48 83 c0 01          	add    $0x1,%rax
+  8030af:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8030b5:	75 e0                	jne    803097 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8030b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030bc:	c3                   	ret
+            return envs[i].env_id;
+  8030bd:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8030c4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8030cb:	00 00 00 
+  8030ce:	48 01 d0             	add    %rdx,%rax
+  8030d1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8030d7:	c3                   	ret
+
+00000000008030d8 <__rodata_start>:
+  8030d8:	69 20 66 61 75 6c    	imul   $0x6c756166,(%rax),%esp
+  8030de:	74 65                	je     803145 <__rodata_start+0x6d>
+  8030e0:	64 20 61 74          	and    %ah,%fs:0x74(%rcx)
+  8030e4:	20 76 61             	and    %dh,0x61(%rsi)
+  8030e7:	20 25 6c 78 2c 20    	and    %ah,0x202c786c(%rip)        # 20aca959 <__bss_end+0x202c2959>
+  8030ed:	65 72 72             	gs jb  803162 <__rodata_start+0x8a>
+  8030f0:	20 25 78 0a 00 3c    	and    %ah,0x3c000a78(%rip)        # 3c803b6e <__bss_end+0x3bffbb6e>
+  8030f6:	75 6e                	jne    803166 <__rodata_start+0x8e>
+  8030f8:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8030fc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030fd:	3e 00 30             	ds add %dh,(%rax)
+  803100:	31 32                	xor    %esi,(%rdx)
+  803102:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803109:	41                   	rex.B
+  80310a:	42                   	rex.X
+  80310b:	43                   	rex.XB
+  80310c:	44                   	rex.R
+  80310d:	45                   	rex.RB
+  80310e:	46 00 30             	rex.RX add %r14b,(%rax)
+  803111:	31 32                	xor    %esi,(%rdx)
+  803113:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80311a:	61                   	(bad)
+  80311b:	62 63 64 65 66       	(bad)
+  803120:	00 28                	add    %ch,(%rax)
+  803122:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803123:	75 6c                	jne    803191 <__rodata_start+0xb9>
+  803125:	6c                   	insb   (%dx),%es:(%rdi)
+  803126:	29 00                	sub    %eax,(%rax)
+  803128:	65 72 72             	gs jb  80319d <__rodata_start+0xc5>
+  80312b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80312c:	72 20                	jb     80314e <__rodata_start+0x76>
+  80312e:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803133:	73 70                	jae    8031a5 <__rodata_start+0xcd>
+  803135:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803139:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803140:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803141:	72 00                	jb     803143 <__rodata_start+0x6b>
+  803143:	62 61 64 20 65       	(bad)
+  803148:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803149:	76 69                	jbe    8031b4 <__rodata_start+0xdc>
+  80314b:	72 6f                	jb     8031bc <__rodata_start+0xe4>
+  80314d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80314e:	6d                   	insl   (%dx),%es:(%rdi)
+  80314f:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803151:	74 00                	je     803153 <__rodata_start+0x7b>
+  803153:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80315a:	20 70 61             	and    %dh,0x61(%rax)
+  80315d:	72 61                	jb     8031c0 <__rodata_start+0xe8>
+  80315f:	6d                   	insl   (%dx),%es:(%rdi)
+  803160:	65 74 65             	gs je  8031c8 <__rodata_start+0xf0>
+  803163:	72 00                	jb     803165 <__rodata_start+0x8d>
+  803165:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803166:	75 74                	jne    8031dc <__rodata_start+0x104>
+  803168:	20 6f 66             	and    %ch,0x66(%rdi)
+  80316b:	20 6d 65             	and    %ch,0x65(%rbp)
+  80316e:	6d                   	insl   (%dx),%es:(%rdi)
+  80316f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803170:	72 79                	jb     8031eb <__rodata_start+0x113>
+  803172:	00 6f 75             	add    %ch,0x75(%rdi)
+  803175:	74 20                	je     803197 <__rodata_start+0xbf>
+  803177:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803178:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80317c:	76 69                	jbe    8031e7 <__rodata_start+0x10f>
+  80317e:	72 6f                	jb     8031ef <__rodata_start+0x117>
+  803180:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803181:	6d                   	insl   (%dx),%es:(%rdi)
+  803182:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803184:	74 73                	je     8031f9 <__rodata_start+0x121>
+  803186:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803189:	72 72                	jb     8031fd <__rodata_start+0x125>
+  80318b:	75 70                	jne    8031fd <__rodata_start+0x125>
+  80318d:	74 65                	je     8031f4 <__rodata_start+0x11c>
+  80318f:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803194:	75 67                	jne    8031fd <__rodata_start+0x125>
+  803196:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803199:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80319b:	00 73 65             	add    %dh,0x65(%rbx)
+  80319e:	67 6d                	insl   (%dx),%es:(%edi)
+  8031a0:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8031a2:	74 61                	je     803205 <__rodata_start+0x12d>
+  8031a4:	74 69                	je     80320f <__rodata_start+0x137>
+  8031a6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031a7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031a8:	20 66 61             	and    %ah,0x61(%rsi)
+  8031ab:	75 6c                	jne    803219 <__rodata_start+0x141>
+  8031ad:	74 00                	je     8031af <__rodata_start+0xd7>
+  8031af:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8031b6:	20 45 4c             	and    %al,0x4c(%rbp)
+  8031b9:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8031bd:	61                   	(bad)
+  8031be:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8031c3:	20 73 75             	and    %dh,0x75(%rbx)
+  8031c6:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8031c9:	73 79                	jae    803244 <__rodata_start+0x16c>
+  8031cb:	73 74                	jae    803241 <__rodata_start+0x169>
+  8031cd:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8031cf:	20 63 61             	and    %ah,0x61(%rbx)
+  8031d2:	6c                   	insb   (%dx),%es:(%rdi)
+  8031d3:	6c                   	insb   (%dx),%es:(%rdi)
+  8031d4:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8031d7:	74 72                	je     80324b <__rodata_start+0x173>
+  8031d9:	79 20                	jns    8031fb <__rodata_start+0x123>
+  8031db:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031dc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031dd:	74 20                	je     8031ff <__rodata_start+0x127>
+  8031df:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8031e1:	75 6e                	jne    803251 <__rodata_start+0x179>
+  8031e3:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8031e7:	76 20                	jbe    803209 <__rodata_start+0x131>
+  8031e9:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8031f0:	72 65                	jb     803257 <__rodata_start+0x17f>
+  8031f2:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8031f5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031f6:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8031fa:	65 78 70             	gs js  80326d <__rodata_start+0x195>
+  8031fd:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803202:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803205:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803209:	20 66 69             	and    %ah,0x69(%rsi)
+  80320c:	6c                   	insb   (%dx),%es:(%rdi)
+  80320d:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803211:	20 66 72             	and    %ah,0x72(%rsi)
+  803214:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803219:	61                   	(bad)
+  80321a:	63 65 20             	movsxd 0x20(%rbp),%esp
+  80321d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80321e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80321f:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803223:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803226:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803227:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803228:	20 6d 61             	and    %ch,0x61(%rbp)
+  80322b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80322c:	79 20                	jns    80324e <__rodata_start+0x176>
+  80322e:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803235:	72 65                	jb     80329c <__rodata_start+0x1c4>
+  803237:	20 6f 70             	and    %ch,0x70(%rdi)
+  80323a:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80323c:	00 66 69             	add    %ah,0x69(%rsi)
+  80323f:	6c                   	insb   (%dx),%es:(%rdi)
+  803240:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803244:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803247:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803248:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80324b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80324c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80324d:	74 20                	je     80326f <__rodata_start+0x197>
+  80324f:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803251:	75 6e                	jne    8032c1 <__rodata_start+0x1e9>
+  803253:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803257:	76 61                	jbe    8032ba <__rodata_start+0x1e2>
+  803259:	6c                   	insb   (%dx),%es:(%rdi)
+  80325a:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803261:	00 
+  803262:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803269:	72 65                	jb     8032d0 <__rodata_start+0x1f8>
+  80326b:	61                   	(bad)
+  80326c:	64 79 20             	fs jns 80328f <__rodata_start+0x1b7>
+  80326f:	65 78 69             	gs js  8032db <__rodata_start+0x203>
+  803272:	73 74                	jae    8032e8 <__rodata_start+0x210>
+  803274:	73 00                	jae    803276 <__rodata_start+0x19e>
+  803276:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803277:	70 65                	jo     8032de <__rodata_start+0x206>
+  803279:	72 61                	jb     8032dc <__rodata_start+0x204>
+  80327b:	74 69                	je     8032e6 <__rodata_start+0x20e>
+  80327d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80327e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80327f:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803282:	74 20                	je     8032a4 <__rodata_start+0x1cc>
+  803284:	73 75                	jae    8032fb <__rodata_start+0x223>
+  803286:	70 70                	jo     8032f8 <__rodata_start+0x220>
+  803288:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803289:	72 74                	jb     8032ff <__rodata_start+0x227>
+  80328b:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803290:	65 72 61             	gs jb  8032f4 <__rodata_start+0x21c>
+  803293:	74 69                	je     8032fe <__rodata_start+0x226>
+  803295:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803296:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803297:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80329a:	74 20                	je     8032bc <__rodata_start+0x1e4>
+  80329c:	70 65                	jo     803303 <__rodata_start+0x22b>
+  80329e:	72 6d                	jb     80330d <__rodata_start+0x235>
+  8032a0:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  8032a7:	2e 
+  8032a8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8032af:	00 
+  8032b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8032b7:	00 00 00 
+  8032ba:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  8032c0:	f9                   	stc
+  8032c1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8032c7:	00 3a                	add    %bh,(%rdx)
+  8032c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032cf:	00 2a                	add    %ch,(%rdx)
+  8032d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032d7:	00 3a                	add    %bh,(%rdx)
+  8032d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032df:	00 3a                	add    %bh,(%rdx)
+  8032e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032e7:	00 3a                	add    %bh,(%rdx)
+  8032e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032ef:	00 3a                	add    %bh,(%rdx)
+  8032f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032f7:	00 18                	add    %bl,(%rax)
+  8032f9:	04 80                	add    $0x80,%al
+  8032fb:	00 00                	add    %al,(%rax)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 3a                	add    %bh,(%rdx)
+  803301:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803307:	00 3a                	add    %bh,(%rdx)
+  803309:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80330f:	00 0c 04             	add    %cl,(%rsp,%rax,1)
+  803312:	80 00 00             	addb   $0x0,(%rax)
+  803315:	00 00                	add    %al,(%rax)
+  803317:	00 86 04 80 00 00    	add    %al,0x8004(%rsi)
+  80331d:	00 00                	add    %al,(%rax)
+  80331f:	00 3a                	add    %bh,(%rdx)
+  803321:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803327:	00 0c 04             	add    %cl,(%rsp,%rax,1)
+  80332a:	80 00 00             	addb   $0x0,(%rax)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 52 04             	add    %dl,0x4(%rdx)
+  803332:	80 00 00             	addb   $0x0,(%rax)
+  803335:	00 00                	add    %al,(%rax)
+  803337:	00 52 04             	add    %dl,0x4(%rdx)
+  80333a:	80 00 00             	addb   $0x0,(%rax)
+  80333d:	00 00                	add    %al,(%rax)
+  80333f:	00 52 04             	add    %dl,0x4(%rdx)
+  803342:	80 00 00             	addb   $0x0,(%rax)
+  803345:	00 00                	add    %al,(%rax)
+  803347:	00 52 04             	add    %dl,0x4(%rdx)
+  80334a:	80 00 00             	addb   $0x0,(%rax)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 52 04             	add    %dl,0x4(%rdx)
+  803352:	80 00 00             	addb   $0x0,(%rax)
+  803355:	00 00                	add    %al,(%rax)
+  803357:	00 52 04             	add    %dl,0x4(%rdx)
+  80335a:	80 00 00             	addb   $0x0,(%rax)
+  80335d:	00 00                	add    %al,(%rax)
+  80335f:	00 52 04             	add    %dl,0x4(%rdx)
+  803362:	80 00 00             	addb   $0x0,(%rax)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 52 04             	add    %dl,0x4(%rdx)
+  80336a:	80 00 00             	addb   $0x0,(%rax)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 52 04             	add    %dl,0x4(%rdx)
+  803372:	80 00 00             	addb   $0x0,(%rax)
+  803375:	00 00                	add    %al,(%rax)
+  803377:	00 3a                	add    %bh,(%rdx)
+  803379:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80337f:	00 3a                	add    %bh,(%rdx)
+  803381:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803387:	00 3a                	add    %bh,(%rdx)
+  803389:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80338f:	00 3a                	add    %bh,(%rdx)
+  803391:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803397:	00 3a                	add    %bh,(%rdx)
+  803399:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80339f:	00 3a                	add    %bh,(%rdx)
+  8033a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8033a7:	00 3a                	add    %bh,(%rdx)
+  8033a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8033af:	00 3a                	add    %bh,(%rdx)
+  8033b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8033b7:	00 3a                	add    %bh,(%rdx)
+  8033b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8033bf:	00 3a                	add    %bh,(%rdx)
+  8033c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8033c7:	00 3a                	add    %bh,(%rdx)
+  8033c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8033cf:	00 3a                	add    %bh,(%rdx)
+  8033d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8033d7:	00 3a                	add    %bh,(%rdx)
+  8033d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8033df:	00 3a                	add    %bh,(%rdx)
+  8033e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8033e7:	00 3a                	add    %bh,(%rdx)
+  8033e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8033ef:	00 3a                	add    %bh,(%rdx)
+  8033f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8033f7:	00 3a                	add    %bh,(%rdx)
+  8033f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8033ff:	00 3a                	add    %bh,(%rdx)
+  803401:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803407:	00 3a                	add    %bh,(%rdx)
+  803409:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80340f:	00 3a                	add    %bh,(%rdx)
+  803411:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803417:	00 3a                	add    %bh,(%rdx)
+  803419:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80341f:	00 3a                	add    %bh,(%rdx)
+  803421:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803427:	00 3a                	add    %bh,(%rdx)
+  803429:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80342f:	00 3a                	add    %bh,(%rdx)
+  803431:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803437:	00 3a                	add    %bh,(%rdx)
+  803439:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80343f:	00 3a                	add    %bh,(%rdx)
+  803441:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803447:	00 3a                	add    %bh,(%rdx)
+  803449:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80344f:	00 3a                	add    %bh,(%rdx)
+  803451:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803457:	00 3a                	add    %bh,(%rdx)
+  803459:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80345f:	00 3a                	add    %bh,(%rdx)
+  803461:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803467:	00 5d 09             	add    %bl,0x9(%rbp)
+  80346a:	80 00 00             	addb   $0x0,(%rax)
+  80346d:	00 00                	add    %al,(%rax)
+  80346f:	00 3a                	add    %bh,(%rdx)
+  803471:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803477:	00 3a                	add    %bh,(%rdx)
+  803479:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80347f:	00 3a                	add    %bh,(%rdx)
+  803481:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803487:	00 3a                	add    %bh,(%rdx)
+  803489:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80348f:	00 3a                	add    %bh,(%rdx)
+  803491:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803497:	00 3a                	add    %bh,(%rdx)
+  803499:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80349f:	00 3a                	add    %bh,(%rdx)
+  8034a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8034a7:	00 3a                	add    %bh,(%rdx)
+  8034a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8034af:	00 3a                	add    %bh,(%rdx)
+  8034b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8034b7:	00 3a                	add    %bh,(%rdx)
+  8034b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8034bf:	00 a9 04 80 00 00    	add    %ch,0x8004(%rcx)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 78 06             	add    %bh,0x6(%rax)
+  8034ca:	80 00 00             	addb   $0x0,(%rax)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 3a                	add    %bh,(%rdx)
+  8034d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8034d7:	00 3a                	add    %bh,(%rdx)
+  8034d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8034df:	00 3a                	add    %bh,(%rdx)
+  8034e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8034e7:	00 3a                	add    %bh,(%rdx)
+  8034e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8034ef:	00 d8                	add    %bl,%al
+  8034f1:	04 80                	add    $0x80,%al
+  8034f3:	00 00                	add    %al,(%rax)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 3a                	add    %bh,(%rdx)
+  8034f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8034ff:	00 3a                	add    %bh,(%rdx)
+  803501:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803507:	00 9e 04 80 00 00    	add    %bl,0x8004(%rsi)
+  80350d:	00 00                	add    %al,(%rax)
+  80350f:	00 3a                	add    %bh,(%rdx)
+  803511:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803517:	00 3a                	add    %bh,(%rdx)
+  803519:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80351f:	00 20                	add    %ah,(%rax)
+  803521:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803527:	00 ea                	add    %ch,%dl
+  803529:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80352f:	00 3a                	add    %bh,(%rdx)
+  803531:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803537:	00 3a                	add    %bh,(%rdx)
+  803539:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80353f:	00 6f 05             	add    %ch,0x5(%rdi)
+  803542:	80 00 00             	addb   $0x0,(%rax)
+  803545:	00 00                	add    %al,(%rax)
+  803547:	00 3a                	add    %bh,(%rdx)
+  803549:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80354f:	00 4c 07 80          	add    %cl,-0x80(%rdi,%rax,1)
+  803553:	00 00                	add    %al,(%rax)
+  803555:	00 00                	add    %al,(%rax)
+  803557:	00 3a                	add    %bh,(%rdx)
+  803559:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80355f:	00 3a                	add    %bh,(%rdx)
+  803561:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803567:	00 5d 09             	add    %bl,0x9(%rbp)
+  80356a:	80 00 00             	addb   $0x0,(%rax)
+  80356d:	00 00                	add    %al,(%rax)
+  80356f:	00 3a                	add    %bh,(%rdx)
+  803571:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803577:	00 02                	add    %al,(%rdx)
+  803579:	04 80                	add    $0x80,%al
+  80357b:	00 00                	add    %al,(%rax)
+  80357d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803580 <error_string>:
+	...
+  803588:	31 31 80 00 00 00 00 00 43 31 80 00 00 00 00 00     11......C1......
+  803598:	53 31 80 00 00 00 00 00 65 31 80 00 00 00 00 00     S1......e1......
+  8035a8:	73 31 80 00 00 00 00 00 87 31 80 00 00 00 00 00     s1.......1......
+  8035b8:	9c 31 80 00 00 00 00 00 af 31 80 00 00 00 00 00     .1.......1......
+  8035c8:	c1 31 80 00 00 00 00 00 d5 31 80 00 00 00 00 00     .1.......1......
+  8035d8:	e5 31 80 00 00 00 00 00 f8 31 80 00 00 00 00 00     .1.......1......
+  8035e8:	0f 32 80 00 00 00 00 00 25 32 80 00 00 00 00 00     .2......%2......
+  8035f8:	3d 32 80 00 00 00 00 00 55 32 80 00 00 00 00 00     =2......U2......
+  803608:	62 32 80 00 00 00 00 00 30 36 80 00 00 00 00 00     b2......06......
+  803618:	76 32 80 00 00 00 00 00 00 00 00 00 00 00 00 00     v2..............
+  803628:	8e 32 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .2......file is 
+  803638:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803648:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803658:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803668:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803678:	6c 6c 2e 63 00 0f 1f 00 55 73 65 72 73 70 61 63     ll.c....Userspac
+  803688:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  803698:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8036a8:	65 72 72 3d 25 78 0a 00 61 64 64 5f 70 67 66 61     err=%x..add_pgfa
+  8036b8:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  8036c8:	5f 61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61     _alloc_region fa
+  8036d8:	69 6c 65 64 00 00 00 00 61 64 64 5f 70 67 66 61     iled....add_pgfa
+  8036e8:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  8036f8:	5f 65 6e 76 5f 73 65 74 5f 70 67 66 61 75 6c 74     _env_set_pgfault
+  803708:	5f 75 70 63 61 6c 6c 20 66 61 69 6c 65 64 00 6c     _upcall failed.l
+  803718:	69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65 74     ib/pgfault.c.set
+  803728:	5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65 72     _pgfault_handler
+  803738:	3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72 5f     : %i._pfhandler_
+  803748:	69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00 61     inititiallized.a
+  803758:	73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65 64 3a     ssertion failed:
+  803768:	20 25 73 00 0f 1f 40 00 5b 25 30 38 78 5d 20 75      %s...@.[%08x] u
+  803778:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803788:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803798:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8037a8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8037b8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8037c8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8037d8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8037e8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037f8:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000803800 <devtab>:
+  803800:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803810:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803820:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  803830:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  803840:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  803850:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 0f 1f 40 00     _SIZE) == 2...@.
+  803860:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  803870:	20 62 65 67 69 6e 20 67 65 6e 65 72 69 63 20 68      begin generic h
+  803880:	61 6e 64 6c 65 72 20 66 6f 72 20 25 64 0a 00 00     andler for %d...
+  803890:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  8038a0:	20 65 78 69 74 69 6e 67 20 64 75 65 20 74 6f 20      exiting due to 
+  8038b0:	73 69 67 6e 61 6c 20 25 64 0a 00 00 00 00 00 00     signal %d.......
+  8038c0:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  8038d0:	20 69 67 6e 6f 72 69 6e 67 20 73 69 67 6e 61 6c      ignoring signal
+  8038e0:	20 25 64 0a 00 00 00 00 73 69 67 6e 61 6c 73 3a      %d.....signals:
+  8038f0:	20 65 6e 76 20 25 78 3a 20 65 6e 64 20 67 65 6e      env %x: end gen
+  803900:	65 72 69 63 20 68 61 6e 64 6c 65 72 20 66 6f 72     eric handler for
+  803910:	20 25 64 0a 00 66 61 6c 73 65 00 6c 69 62 2f 73      %d..false.lib/s
+  803920:	69 67 6e 61 6c 2e 63 00 3c 63 6f 6e 73 3e 00 63     ignal.c.<cons>.c
+  803930:	6f 6e 73 00 0f 1f 40 00 5b 25 30 38 78 5d 20 75     ons...@.[%08x] u
+  803940:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  803950:	61 74 20 25 73 3a 25 64 3a 20 00 69 70 63 5f 73     at %s:%d: .ipc_s
+  803960:	65 6e 64 3a 20 66 61 69 6c 65 64 20 74 6f 20 73     end: failed to s
+  803970:	65 6e 64 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     end.lib/ipc.c.f.
+  803980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
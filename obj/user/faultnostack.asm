@@ -0,0 +1,5893 @@
+
+obj/user/faultnostack:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2e 00 00 00       	call   800051 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    sys_env_set_pgfault_upcall(0, (void *)_pgfault_upcall);
+  800029:	48 be 46 08 80 00 00 	movabs $0x800846,%rsi
+  800030:	00 00 00 
+  800033:	bf 00 00 00 00       	mov    $0x0,%edi
+  800038:	48 b8 79 05 80 00 00 	movabs $0x800579,%rax
+  80003f:	00 00 00 
+  800042:	ff d0                	call   *%rax
+    *(volatile int *)0 = 0;
+  800044:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80004b:	00 00 00 00 
+#endif
+}
+  80004f:	5d                   	pop    %rbp
+  800050:	c3                   	ret
+
+0000000000800051 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800051:	55                   	push   %rbp
+  800052:	48 89 e5             	mov    %rsp,%rbp
+  800055:	41 56                	push   %r14
+  800057:	41 55                	push   %r13
+  800059:	41 54                	push   %r12
+  80005b:	53                   	push   %rbx
+  80005c:	41 89 fd             	mov    %edi,%r13d
+  80005f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800062:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800069:	00 00 00 
+  80006c:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800073:	00 00 00 
+  800076:	48 39 c2             	cmp    %rax,%rdx
+  800079:	73 17                	jae    800092 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80007b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007e:	49 89 c4             	mov    %rax,%r12
+  800081:	48 83 c3 08          	add    $0x8,%rbx
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	ff 53 f8             	call   *-0x8(%rbx)
+  80008d:	4c 39 e3             	cmp    %r12,%rbx
+  800090:	72 ef                	jb     800081 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800092:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  800099:	00 00 00 
+  80009c:	ff d0                	call   *%rax
+  80009e:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8000a1:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8000a8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000af:	00 00 00 
+  8000b2:	48 01 d0             	add    %rdx,%rax
+  8000b5:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000bc:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000bf:	45 85 ed             	test   %r13d,%r13d
+  8000c2:	7e 0d                	jle    8000d1 <libmain+0x80>
+  8000c4:	49 8b 06             	mov    (%r14),%rax
+  8000c7:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000ce:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d1:	4c 89 f6             	mov    %r14,%rsi
+  8000d4:	44 89 ef             	mov    %r13d,%edi
+  8000d7:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000de:	00 00 00 
+  8000e1:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e3:	48 b8 f8 00 80 00 00 	movabs $0x8000f8,%rax
+  8000ea:	00 00 00 
+  8000ed:	ff d0                	call   *%rax
+#endif
+}
+  8000ef:	5b                   	pop    %rbx
+  8000f0:	41 5c                	pop    %r12
+  8000f2:	41 5d                	pop    %r13
+  8000f4:	41 5e                	pop    %r14
+  8000f6:	5d                   	pop    %rbp
+  8000f7:	c3                   	ret
+
+00000000008000f8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f8:	55                   	push   %rbp
+  8000f9:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000fc:	48 b8 27 0b 80 00 00 	movabs $0x800b27,%rax
+  800103:	00 00 00 
+  800106:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800108:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010d:	48 b8 79 01 80 00 00 	movabs $0x800179,%rax
+  800114:	00 00 00 
+  800117:	ff d0                	call   *%rax
+}
+  800119:	5d                   	pop    %rbp
+  80011a:	c3                   	ret
+
+000000000080011b <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80011b:	55                   	push   %rbp
+  80011c:	48 89 e5             	mov    %rsp,%rbp
+  80011f:	53                   	push   %rbx
+  800120:	48 89 fa             	mov    %rdi,%rdx
+  800123:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800126:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80012b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800130:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800135:	be 00 00 00 00       	mov    $0x0,%esi
+  80013a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800140:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800142:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800146:	c9                   	leave
+  800147:	c3                   	ret
+
+0000000000800148 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800148:	55                   	push   %rbp
+  800149:	48 89 e5             	mov    %rsp,%rbp
+  80014c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80014d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800152:	ba 00 00 00 00       	mov    $0x0,%edx
+  800157:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80015c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800161:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800166:	be 00 00 00 00       	mov    $0x0,%esi
+  80016b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800171:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800173:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800177:	c9                   	leave
+  800178:	c3                   	ret
+
+0000000000800179 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800179:	55                   	push   %rbp
+  80017a:	48 89 e5             	mov    %rsp,%rbp
+  80017d:	53                   	push   %rbx
+  80017e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800182:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800185:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80018a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80018f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800194:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800199:	be 00 00 00 00       	mov    $0x0,%esi
+  80019e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001a6:	48 85 c0             	test   %rax,%rax
+  8001a9:	7f 06                	jg     8001b1 <sys_env_destroy+0x38>
+}
+  8001ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001af:	c9                   	leave
+  8001b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001b1:	49 89 c0             	mov    %rax,%r8
+  8001b4:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001b9:	48 ba a8 30 80 00 00 	movabs $0x8030a8,%rdx
+  8001c0:	00 00 00 
+  8001c3:	be 26 00 00 00       	mov    $0x26,%esi
+  8001c8:	48 bf c7 30 80 00 00 	movabs $0x8030c7,%rdi
+  8001cf:	00 00 00 
+  8001d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d7:	49 b9 b1 1d 80 00 00 	movabs $0x801db1,%r9
+  8001de:	00 00 00 
+  8001e1:	41 ff d1             	call   *%r9
+
+00000000008001e4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001e4:	55                   	push   %rbp
+  8001e5:	48 89 e5             	mov    %rsp,%rbp
+  8001e8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001e9:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800202:	be 00 00 00 00       	mov    $0x0,%esi
+  800207:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80020d:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80020f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800213:	c9                   	leave
+  800214:	c3                   	ret
+
+0000000000800215 <sys_yield>:
+
+void
+sys_yield(void) {
+  800215:	55                   	push   %rbp
+  800216:	48 89 e5             	mov    %rsp,%rbp
+  800219:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80021a:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80021f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800224:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800229:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80022e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800233:	be 00 00 00 00       	mov    $0x0,%esi
+  800238:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80023e:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800240:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800244:	c9                   	leave
+  800245:	c3                   	ret
+
+0000000000800246 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800246:	55                   	push   %rbp
+  800247:	48 89 e5             	mov    %rsp,%rbp
+  80024a:	53                   	push   %rbx
+  80024b:	48 89 fa             	mov    %rdi,%rdx
+  80024e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800251:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800256:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80025d:	00 00 00 
+  800260:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800265:	be 00 00 00 00       	mov    $0x0,%esi
+  80026a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800270:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800272:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800276:	c9                   	leave
+  800277:	c3                   	ret
+
+0000000000800278 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800278:	55                   	push   %rbp
+  800279:	48 89 e5             	mov    %rsp,%rbp
+  80027c:	53                   	push   %rbx
+  80027d:	49 89 f8             	mov    %rdi,%r8
+  800280:	48 89 d3             	mov    %rdx,%rbx
+  800283:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800286:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80028b:	4c 89 c2             	mov    %r8,%rdx
+  80028e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800291:	be 00 00 00 00       	mov    $0x0,%esi
+  800296:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80029c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80029e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002a2:	c9                   	leave
+  8002a3:	c3                   	ret
+
+00000000008002a4 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002a4:	55                   	push   %rbp
+  8002a5:	48 89 e5             	mov    %rsp,%rbp
+  8002a8:	53                   	push   %rbx
+  8002a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ad:	89 f8                	mov    %edi,%eax
+  8002af:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002b2:	48 63 f9             	movslq %ecx,%rdi
+  8002b5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002b8:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002bd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8002c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002cb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002cd:	48 85 c0             	test   %rax,%rax
+  8002d0:	7f 06                	jg     8002d8 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002d6:	c9                   	leave
+  8002d7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002d8:	49 89 c0             	mov    %rax,%r8
+  8002db:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002e0:	48 ba a8 30 80 00 00 	movabs $0x8030a8,%rdx
+  8002e7:	00 00 00 
+  8002ea:	be 26 00 00 00       	mov    $0x26,%esi
+  8002ef:	48 bf c7 30 80 00 00 	movabs $0x8030c7,%rdi
+  8002f6:	00 00 00 
+  8002f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fe:	49 b9 b1 1d 80 00 00 	movabs $0x801db1,%r9
+  800305:	00 00 00 
+  800308:	41 ff d1             	call   *%r9
+
+000000000080030b <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80030b:	55                   	push   %rbp
+  80030c:	48 89 e5             	mov    %rsp,%rbp
+  80030f:	53                   	push   %rbx
+  800310:	48 83 ec 08          	sub    $0x8,%rsp
+  800314:	89 f8                	mov    %edi,%eax
+  800316:	49 89 f2             	mov    %rsi,%r10
+  800319:	48 89 cf             	mov    %rcx,%rdi
+  80031c:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80031f:	48 63 da             	movslq %edx,%rbx
+  800322:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800325:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80032a:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80032d:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800330:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800332:	48 85 c0             	test   %rax,%rax
+  800335:	7f 06                	jg     80033d <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800337:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80033b:	c9                   	leave
+  80033c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80033d:	49 89 c0             	mov    %rax,%r8
+  800340:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800345:	48 ba a8 30 80 00 00 	movabs $0x8030a8,%rdx
+  80034c:	00 00 00 
+  80034f:	be 26 00 00 00       	mov    $0x26,%esi
+  800354:	48 bf c7 30 80 00 00 	movabs $0x8030c7,%rdi
+  80035b:	00 00 00 
+  80035e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800363:	49 b9 b1 1d 80 00 00 	movabs $0x801db1,%r9
+  80036a:	00 00 00 
+  80036d:	41 ff d1             	call   *%r9
+
+0000000000800370 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800370:	55                   	push   %rbp
+  800371:	48 89 e5             	mov    %rsp,%rbp
+  800374:	53                   	push   %rbx
+  800375:	48 83 ec 08          	sub    $0x8,%rsp
+  800379:	48 89 f1             	mov    %rsi,%rcx
+  80037c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80037f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800382:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800387:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80038c:	be 00 00 00 00       	mov    $0x0,%esi
+  800391:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800397:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800399:	48 85 c0             	test   %rax,%rax
+  80039c:	7f 06                	jg     8003a4 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80039e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003a2:	c9                   	leave
+  8003a3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003a4:	49 89 c0             	mov    %rax,%r8
+  8003a7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003ac:	48 ba a8 30 80 00 00 	movabs $0x8030a8,%rdx
+  8003b3:	00 00 00 
+  8003b6:	be 26 00 00 00       	mov    $0x26,%esi
+  8003bb:	48 bf c7 30 80 00 00 	movabs $0x8030c7,%rdi
+  8003c2:	00 00 00 
+  8003c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ca:	49 b9 b1 1d 80 00 00 	movabs $0x801db1,%r9
+  8003d1:	00 00 00 
+  8003d4:	41 ff d1             	call   *%r9
+
+00000000008003d7 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8003d7:	55                   	push   %rbp
+  8003d8:	48 89 e5             	mov    %rsp,%rbp
+  8003db:	53                   	push   %rbx
+  8003dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8003e0:	89 f8                	mov    %edi,%eax
+  8003e2:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8003e5:	48 63 f9             	movslq %ecx,%rdi
+  8003e8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003eb:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003f0:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8003f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003fe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800400:	48 85 c0             	test   %rax,%rax
+  800403:	7f 06                	jg     80040b <sys_region_advise+0x34>
+}
+  800405:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800409:	c9                   	leave
+  80040a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80040b:	49 89 c0             	mov    %rax,%r8
+  80040e:	b9 14 00 00 00       	mov    $0x14,%ecx
+  800413:	48 ba a8 30 80 00 00 	movabs $0x8030a8,%rdx
+  80041a:	00 00 00 
+  80041d:	be 26 00 00 00       	mov    $0x26,%esi
+  800422:	48 bf c7 30 80 00 00 	movabs $0x8030c7,%rdi
+  800429:	00 00 00 
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	49 b9 b1 1d 80 00 00 	movabs $0x801db1,%r9
+  800438:	00 00 00 
+  80043b:	41 ff d1             	call   *%r9
+
+000000000080043e <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  80043e:	55                   	push   %rbp
+  80043f:	48 89 e5             	mov    %rsp,%rbp
+  800442:	53                   	push   %rbx
+  800443:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  800447:	48 63 ce             	movslq %esi,%rcx
+  80044a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80044d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800452:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800457:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80045c:	be 00 00 00 00       	mov    $0x0,%esi
+  800461:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800467:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800469:	48 85 c0             	test   %rax,%rax
+  80046c:	7f 06                	jg     800474 <sys_env_set_nice+0x36>
+}
+  80046e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800472:	c9                   	leave
+  800473:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800474:	49 89 c0             	mov    %rax,%r8
+  800477:	b9 15 00 00 00       	mov    $0x15,%ecx
+  80047c:	48 ba a8 30 80 00 00 	movabs $0x8030a8,%rdx
+  800483:	00 00 00 
+  800486:	be 26 00 00 00       	mov    $0x26,%esi
+  80048b:	48 bf c7 30 80 00 00 	movabs $0x8030c7,%rdi
+  800492:	00 00 00 
+  800495:	b8 00 00 00 00       	mov    $0x0,%eax
+  80049a:	49 b9 b1 1d 80 00 00 	movabs $0x801db1,%r9
+  8004a1:	00 00 00 
+  8004a4:	41 ff d1             	call   *%r9
+
+00000000008004a7 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004a7:	55                   	push   %rbp
+  8004a8:	48 89 e5             	mov    %rsp,%rbp
+  8004ab:	53                   	push   %rbx
+  8004ac:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004b0:	48 63 ce             	movslq %esi,%rcx
+  8004b3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004b6:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8004ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004d0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004d2:	48 85 c0             	test   %rax,%rax
+  8004d5:	7f 06                	jg     8004dd <sys_env_set_status+0x36>
+}
+  8004d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004db:	c9                   	leave
+  8004dc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004dd:	49 89 c0             	mov    %rax,%r8
+  8004e0:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004e5:	48 ba a8 30 80 00 00 	movabs $0x8030a8,%rdx
+  8004ec:	00 00 00 
+  8004ef:	be 26 00 00 00       	mov    $0x26,%esi
+  8004f4:	48 bf c7 30 80 00 00 	movabs $0x8030c7,%rdi
+  8004fb:	00 00 00 
+  8004fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800503:	49 b9 b1 1d 80 00 00 	movabs $0x801db1,%r9
+  80050a:	00 00 00 
+  80050d:	41 ff d1             	call   *%r9
+
+0000000000800510 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800510:	55                   	push   %rbp
+  800511:	48 89 e5             	mov    %rsp,%rbp
+  800514:	53                   	push   %rbx
+  800515:	48 83 ec 08          	sub    $0x8,%rsp
+  800519:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80051c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80051f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800524:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800529:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80052e:	be 00 00 00 00       	mov    $0x0,%esi
+  800533:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800539:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80053b:	48 85 c0             	test   %rax,%rax
+  80053e:	7f 06                	jg     800546 <sys_env_set_trapframe+0x36>
+}
+  800540:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800544:	c9                   	leave
+  800545:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800546:	49 89 c0             	mov    %rax,%r8
+  800549:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80054e:	48 ba a8 30 80 00 00 	movabs $0x8030a8,%rdx
+  800555:	00 00 00 
+  800558:	be 26 00 00 00       	mov    $0x26,%esi
+  80055d:	48 bf c7 30 80 00 00 	movabs $0x8030c7,%rdi
+  800564:	00 00 00 
+  800567:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056c:	49 b9 b1 1d 80 00 00 	movabs $0x801db1,%r9
+  800573:	00 00 00 
+  800576:	41 ff d1             	call   *%r9
+
+0000000000800579 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800579:	55                   	push   %rbp
+  80057a:	48 89 e5             	mov    %rsp,%rbp
+  80057d:	53                   	push   %rbx
+  80057e:	48 83 ec 08          	sub    $0x8,%rsp
+  800582:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800585:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800588:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80058d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800592:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800597:	be 00 00 00 00       	mov    $0x0,%esi
+  80059c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005a4:	48 85 c0             	test   %rax,%rax
+  8005a7:	7f 06                	jg     8005af <sys_env_set_pgfault_upcall+0x36>
+}
+  8005a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005ad:	c9                   	leave
+  8005ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005af:	49 89 c0             	mov    %rax,%r8
+  8005b2:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8005b7:	48 ba a8 30 80 00 00 	movabs $0x8030a8,%rdx
+  8005be:	00 00 00 
+  8005c1:	be 26 00 00 00       	mov    $0x26,%esi
+  8005c6:	48 bf c7 30 80 00 00 	movabs $0x8030c7,%rdi
+  8005cd:	00 00 00 
+  8005d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d5:	49 b9 b1 1d 80 00 00 	movabs $0x801db1,%r9
+  8005dc:	00 00 00 
+  8005df:	41 ff d1             	call   *%r9
+
+00000000008005e2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	53                   	push   %rbx
+  8005e7:	89 f8                	mov    %edi,%eax
+  8005e9:	49 89 f1             	mov    %rsi,%r9
+  8005ec:	48 89 d3             	mov    %rdx,%rbx
+  8005ef:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8005f2:	49 63 f0             	movslq %r8d,%rsi
+  8005f5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005f8:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005fd:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800600:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800606:	cd 30                	int    $0x30
+}
+  800608:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80060c:	c9                   	leave
+  80060d:	c3                   	ret
+
+000000000080060e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80060e:	55                   	push   %rbp
+  80060f:	48 89 e5             	mov    %rsp,%rbp
+  800612:	53                   	push   %rbx
+  800613:	48 83 ec 08          	sub    $0x8,%rsp
+  800617:	48 89 fa             	mov    %rdi,%rdx
+  80061a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80061d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800622:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800627:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80062c:	be 00 00 00 00       	mov    $0x0,%esi
+  800631:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800637:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800639:	48 85 c0             	test   %rax,%rax
+  80063c:	7f 06                	jg     800644 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80063e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800642:	c9                   	leave
+  800643:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800644:	49 89 c0             	mov    %rax,%r8
+  800647:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80064c:	48 ba a8 30 80 00 00 	movabs $0x8030a8,%rdx
+  800653:	00 00 00 
+  800656:	be 26 00 00 00       	mov    $0x26,%esi
+  80065b:	48 bf c7 30 80 00 00 	movabs $0x8030c7,%rdi
+  800662:	00 00 00 
+  800665:	b8 00 00 00 00       	mov    $0x0,%eax
+  80066a:	49 b9 b1 1d 80 00 00 	movabs $0x801db1,%r9
+  800671:	00 00 00 
+  800674:	41 ff d1             	call   *%r9
+
+0000000000800677 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800677:	55                   	push   %rbp
+  800678:	48 89 e5             	mov    %rsp,%rbp
+  80067b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80067c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800681:	ba 00 00 00 00       	mov    $0x0,%edx
+  800686:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80068b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800690:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006a0:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8006a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006a6:	c9                   	leave
+  8006a7:	c3                   	ret
+
+00000000008006a8 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8006a8:	55                   	push   %rbp
+  8006a9:	48 89 e5             	mov    %rsp,%rbp
+  8006ac:	53                   	push   %rbx
+  8006ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8006b1:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8006b4:	48 63 ce             	movslq %esi,%rcx
+  8006b7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006ba:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8006c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006cf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8006d1:	48 85 c0             	test   %rax,%rax
+  8006d4:	7f 06                	jg     8006dc <sys_sigqueue+0x34>
+}
+  8006d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006da:	c9                   	leave
+  8006db:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006dc:	49 89 c0             	mov    %rax,%r8
+  8006df:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8006e4:	48 ba a8 30 80 00 00 	movabs $0x8030a8,%rdx
+  8006eb:	00 00 00 
+  8006ee:	be 26 00 00 00       	mov    $0x26,%esi
+  8006f3:	48 bf c7 30 80 00 00 	movabs $0x8030c7,%rdi
+  8006fa:	00 00 00 
+  8006fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800702:	49 b9 b1 1d 80 00 00 	movabs $0x801db1,%r9
+  800709:	00 00 00 
+  80070c:	41 ff d1             	call   *%r9
+
+000000000080070f <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  80070f:	55                   	push   %rbp
+  800710:	48 89 e5             	mov    %rsp,%rbp
+  800713:	53                   	push   %rbx
+  800714:	48 83 ec 08          	sub    $0x8,%rsp
+  800718:	48 89 fa             	mov    %rdi,%rdx
+  80071b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80071e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800723:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800728:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80072d:	be 00 00 00 00       	mov    $0x0,%esi
+  800732:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800738:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80073a:	48 85 c0             	test   %rax,%rax
+  80073d:	7f 06                	jg     800745 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  80073f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800743:	c9                   	leave
+  800744:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800745:	49 89 c0             	mov    %rax,%r8
+  800748:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80074d:	48 ba a8 30 80 00 00 	movabs $0x8030a8,%rdx
+  800754:	00 00 00 
+  800757:	be 26 00 00 00       	mov    $0x26,%esi
+  80075c:	48 bf c7 30 80 00 00 	movabs $0x8030c7,%rdi
+  800763:	00 00 00 
+  800766:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076b:	49 b9 b1 1d 80 00 00 	movabs $0x801db1,%r9
+  800772:	00 00 00 
+  800775:	41 ff d1             	call   *%r9
+
+0000000000800778 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  800778:	55                   	push   %rbp
+  800779:	48 89 e5             	mov    %rsp,%rbp
+  80077c:	53                   	push   %rbx
+  80077d:	48 83 ec 08          	sub    $0x8,%rsp
+  800781:	48 89 f1             	mov    %rsi,%rcx
+  800784:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  800787:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80078a:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80078f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800794:	be 00 00 00 00       	mov    $0x0,%esi
+  800799:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80079f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8007a1:	48 85 c0             	test   %rax,%rax
+  8007a4:	7f 06                	jg     8007ac <sys_sigaction+0x34>
+}
+  8007a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007aa:	c9                   	leave
+  8007ab:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007ac:	49 89 c0             	mov    %rax,%r8
+  8007af:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8007b4:	48 ba a8 30 80 00 00 	movabs $0x8030a8,%rdx
+  8007bb:	00 00 00 
+  8007be:	be 26 00 00 00       	mov    $0x26,%esi
+  8007c3:	48 bf c7 30 80 00 00 	movabs $0x8030c7,%rdi
+  8007ca:	00 00 00 
+  8007cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d2:	49 b9 b1 1d 80 00 00 	movabs $0x801db1,%r9
+  8007d9:	00 00 00 
+  8007dc:	41 ff d1             	call   *%r9
+
+00000000008007df <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8007df:	55                   	push   %rbp
+  8007e0:	48 89 e5             	mov    %rsp,%rbp
+  8007e3:	53                   	push   %rbx
+  8007e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8007e8:	48 89 f1             	mov    %rsi,%rcx
+  8007eb:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8007ee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8007f1:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8007f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007fb:	be 00 00 00 00       	mov    $0x0,%esi
+  800800:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800806:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800808:	48 85 c0             	test   %rax,%rax
+  80080b:	7f 06                	jg     800813 <sys_sigprocmask+0x34>
+}
+  80080d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800811:	c9                   	leave
+  800812:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800813:	49 89 c0             	mov    %rax,%r8
+  800816:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80081b:	48 ba a8 30 80 00 00 	movabs $0x8030a8,%rdx
+  800822:	00 00 00 
+  800825:	be 26 00 00 00       	mov    $0x26,%esi
+  80082a:	48 bf c7 30 80 00 00 	movabs $0x8030c7,%rdi
+  800831:	00 00 00 
+  800834:	b8 00 00 00 00       	mov    $0x0,%eax
+  800839:	49 b9 b1 1d 80 00 00 	movabs $0x801db1,%r9
+  800840:	00 00 00 
+  800843:	41 ff d1             	call   *%r9
+
+0000000000800846 <_pgfault_upcall>:
+.text
+.globl _pgfault_upcall
+.globl _signal_handler_trampoline
+_pgfault_upcall:
+_signal_handler_trampoline:
+    movq  %rsp,%rdi # passing the function argument (UTrapframe *) in rdi
+  800846:	48 89 e7             	mov    %rsp,%rdi
+    # sizeof(struct EnqueuedSignal) == 56
+    # sizeof(curenv->env_sig_mask) == 4
+    # + 4 bytes of alignment
+    add $64, %rdi
+  800849:	48 83 c7 40          	add    $0x40,%rdi
+
+    # load signo
+    mov (%rsp), %eax
+  80084d:	8b 04 24             	mov    (%rsp),%eax
+    test %eax, %eax
+  800850:	85 c0                	test   %eax,%eax
+    jnz _call_generic_signal_handler
+  800852:	75 0e                	jne    800862 <_call_generic_signal_handler>
+
+    # Call the C page fault handler.
+    movabs $_handle_vectored_pagefault, %rax
+  800854:	48 b8 4d 2c 80 00 00 	movabs $0x802c4d,%rax
+  80085b:	00 00 00 
+    call *%rax
+  80085e:	ff d0                	call   *%rax
+    jmp _return_from_handler
+  800860:	eb 0f                	jmp    800871 <_return_from_handler>
+
+0000000000800862 <_call_generic_signal_handler>:
+
+_call_generic_signal_handler:
+    movq %rsp, %rsi # passing the function argument (EnqueuedSignal *) in rsi
+  800862:	48 89 e6             	mov    %rsp,%rsi
+    movabs $_generic_signal_handler, %rax
+  800865:	48 b8 a9 19 80 00 00 	movabs $0x8019a9,%rax
+  80086c:	00 00 00 
+    call *%rax
+  80086f:	ff d0                	call   *%rax
+
+0000000000800871 <_return_from_handler>:
+
+_return_from_handler:
+    # ignore EnqueuedSignal and env_sig_mask
+    add $64, %rsp
+  800871:	48 83 c4 40          	add    $0x40,%rsp
+    # put SIG_SETMASK as the first func arg
+    movq $3, %rdi
+  800875:	48 c7 c7 03 00 00 00 	mov    $0x3,%rdi
+    # load &env_sig_mask (as the second func arg)
+    lea -4(%rsp), %rsi
+  80087c:	48 8d 74 24 fc       	lea    -0x4(%rsp),%rsi
+    # NULL as the third arg
+    xor %rdx, %rdx
+  800881:	48 31 d2             	xor    %rdx,%rdx
+    # restore blocked signals mask
+    movabs $sys_sigprocmask, %rax
+  800884:	48 b8 df 07 80 00 00 	movabs $0x8007df,%rax
+  80088b:	00 00 00 
+    call *%rax
+  80088e:	ff d0                	call   *%rax
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    # ignore utf_fault_va, utf_err
+    addq $16, %rsp
+  800890:	48 83 c4 10          	add    $0x10,%rsp
+    # restore utf_regs, save rax again
+    POPA
+  800894:	4c 8b 3c 24          	mov    (%rsp),%r15
+  800898:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80089d:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8008a2:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8008a7:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8008ac:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8008b1:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8008b6:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8008bb:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8008c0:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8008c5:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8008ca:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8008cf:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8008d4:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8008d9:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8008de:	48 83 c4 78          	add    $0x78,%rsp
+    pushq %rax
+  8008e2:	50                   	push   %rax
+    # 16 utf_rflags
+    #  8 utf_rip
+    #  0 rax
+
+    # load utf_rip
+    movq 8(%rsp), %rax
+  8008e3:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    # save rbx to utf_rip
+    movq %rbx, 8(%rsp)
+  8008e8:	48 89 5c 24 08       	mov    %rbx,0x8(%rsp)
+    # load utf_rsp
+    movq 24(%rsp), %rbx
+  8008ed:	48 8b 5c 24 18       	mov    0x18(%rsp),%rbx
+    # store return address to *utf_stack
+    subq $8, 24(%rsp)
+  8008f2:	48 83 6c 24 18 08    	subq   $0x8,0x18(%rsp)
+    movq %rax, -8(%rbx)
+  8008f8:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    # restore rax and rbx
+    popq %rax
+  8008fc:	58                   	pop    %rax
+    popq %rbx
+  8008fd:	5b                   	pop    %rbx
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+    popfq
+  8008fe:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    popq %rsp
+  8008ff:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  800900:	c3                   	ret
+
+0000000000800901 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800901:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800908:	ff ff ff 
+  80090b:	48 01 f8             	add    %rdi,%rax
+  80090e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800912:	c3                   	ret
+
+0000000000800913 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800913:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80091a:	ff ff ff 
+  80091d:	48 01 f8             	add    %rdi,%rax
+  800920:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800924:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80092a:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80092e:	c3                   	ret
+
+000000000080092f <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80092f:	55                   	push   %rbp
+  800930:	48 89 e5             	mov    %rsp,%rbp
+  800933:	41 57                	push   %r15
+  800935:	41 56                	push   %r14
+  800937:	41 55                	push   %r13
+  800939:	41 54                	push   %r12
+  80093b:	53                   	push   %rbx
+  80093c:	48 83 ec 08          	sub    $0x8,%rsp
+  800940:	49 89 ff             	mov    %rdi,%r15
+  800943:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800948:	49 bd ad 18 80 00 00 	movabs $0x8018ad,%r13
+  80094f:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800952:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800958:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80095b:	48 89 df             	mov    %rbx,%rdi
+  80095e:	41 ff d5             	call   *%r13
+  800961:	83 e0 04             	and    $0x4,%eax
+  800964:	74 17                	je     80097d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800966:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80096d:	4c 39 f3             	cmp    %r14,%rbx
+  800970:	75 e6                	jne    800958 <fd_alloc+0x29>
+  800972:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800978:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80097d:	4d 89 27             	mov    %r12,(%r15)
+}
+  800980:	48 83 c4 08          	add    $0x8,%rsp
+  800984:	5b                   	pop    %rbx
+  800985:	41 5c                	pop    %r12
+  800987:	41 5d                	pop    %r13
+  800989:	41 5e                	pop    %r14
+  80098b:	41 5f                	pop    %r15
+  80098d:	5d                   	pop    %rbp
+  80098e:	c3                   	ret
+
+000000000080098f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80098f:	83 ff 1f             	cmp    $0x1f,%edi
+  800992:	77 39                	ja     8009cd <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800994:	55                   	push   %rbp
+  800995:	48 89 e5             	mov    %rsp,%rbp
+  800998:	41 54                	push   %r12
+  80099a:	53                   	push   %rbx
+  80099b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80099e:	48 63 df             	movslq %edi,%rbx
+  8009a1:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8009a8:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8009ac:	48 89 df             	mov    %rbx,%rdi
+  8009af:	48 b8 ad 18 80 00 00 	movabs $0x8018ad,%rax
+  8009b6:	00 00 00 
+  8009b9:	ff d0                	call   *%rax
+  8009bb:	a8 04                	test   $0x4,%al
+  8009bd:	74 14                	je     8009d3 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8009bf:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8009c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009c8:	5b                   	pop    %rbx
+  8009c9:	41 5c                	pop    %r12
+  8009cb:	5d                   	pop    %rbp
+  8009cc:	c3                   	ret
+        return -E_INVAL;
+  8009cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8009d2:	c3                   	ret
+        return -E_INVAL;
+  8009d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009d8:	eb ee                	jmp    8009c8 <fd_lookup+0x39>
+
+00000000008009da <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8009da:	55                   	push   %rbp
+  8009db:	48 89 e5             	mov    %rsp,%rbp
+  8009de:	41 54                	push   %r12
+  8009e0:	53                   	push   %rbx
+  8009e1:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8009e4:	48 b8 60 31 80 00 00 	movabs $0x803160,%rax
+  8009eb:	00 00 00 
+  8009ee:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8009f5:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8009f8:	39 3b                	cmp    %edi,(%rbx)
+  8009fa:	74 47                	je     800a43 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8009fc:	48 83 c0 08          	add    $0x8,%rax
+  800a00:	48 8b 18             	mov    (%rax),%rbx
+  800a03:	48 85 db             	test   %rbx,%rbx
+  800a06:	75 f0                	jne    8009f8 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800a08:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800a0f:	00 00 00 
+  800a12:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a18:	89 fa                	mov    %edi,%edx
+  800a1a:	48 bf d8 30 80 00 00 	movabs $0x8030d8,%rdi
+  800a21:	00 00 00 
+  800a24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a29:	48 b9 01 1f 80 00 00 	movabs $0x801f01,%rcx
+  800a30:	00 00 00 
+  800a33:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800a35:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800a3a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800a3e:	5b                   	pop    %rbx
+  800a3f:	41 5c                	pop    %r12
+  800a41:	5d                   	pop    %rbp
+  800a42:	c3                   	ret
+            return 0;
+  800a43:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a48:	eb f0                	jmp    800a3a <dev_lookup+0x60>
+
+0000000000800a4a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800a4a:	55                   	push   %rbp
+  800a4b:	48 89 e5             	mov    %rsp,%rbp
+  800a4e:	41 55                	push   %r13
+  800a50:	41 54                	push   %r12
+  800a52:	53                   	push   %rbx
+  800a53:	48 83 ec 18          	sub    $0x18,%rsp
+  800a57:	48 89 fb             	mov    %rdi,%rbx
+  800a5a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800a5d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800a64:	ff ff ff 
+  800a67:	48 01 df             	add    %rbx,%rdi
+  800a6a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800a6e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a72:	48 b8 8f 09 80 00 00 	movabs $0x80098f,%rax
+  800a79:	00 00 00 
+  800a7c:	ff d0                	call   *%rax
+  800a7e:	41 89 c5             	mov    %eax,%r13d
+  800a81:	85 c0                	test   %eax,%eax
+  800a83:	78 06                	js     800a8b <fd_close+0x41>
+  800a85:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800a89:	74 1a                	je     800aa5 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800a8b:	45 84 e4             	test   %r12b,%r12b
+  800a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a93:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800a97:	44 89 e8             	mov    %r13d,%eax
+  800a9a:	48 83 c4 18          	add    $0x18,%rsp
+  800a9e:	5b                   	pop    %rbx
+  800a9f:	41 5c                	pop    %r12
+  800aa1:	41 5d                	pop    %r13
+  800aa3:	5d                   	pop    %rbp
+  800aa4:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800aa5:	8b 3b                	mov    (%rbx),%edi
+  800aa7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800aab:	48 b8 da 09 80 00 00 	movabs $0x8009da,%rax
+  800ab2:	00 00 00 
+  800ab5:	ff d0                	call   *%rax
+  800ab7:	41 89 c5             	mov    %eax,%r13d
+  800aba:	85 c0                	test   %eax,%eax
+  800abc:	78 1b                	js     800ad9 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800abe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ac2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800ac6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800acc:	48 85 c0             	test   %rax,%rax
+  800acf:	74 08                	je     800ad9 <fd_close+0x8f>
+  800ad1:	48 89 df             	mov    %rbx,%rdi
+  800ad4:	ff d0                	call   *%rax
+  800ad6:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800ad9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ade:	48 89 de             	mov    %rbx,%rsi
+  800ae1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ae6:	48 b8 70 03 80 00 00 	movabs $0x800370,%rax
+  800aed:	00 00 00 
+  800af0:	ff d0                	call   *%rax
+    return res;
+  800af2:	eb a3                	jmp    800a97 <fd_close+0x4d>
+
+0000000000800af4 <close>:
+
+int
+close(int fdnum) {
+  800af4:	55                   	push   %rbp
+  800af5:	48 89 e5             	mov    %rsp,%rbp
+  800af8:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800afc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800b00:	48 b8 8f 09 80 00 00 	movabs $0x80098f,%rax
+  800b07:	00 00 00 
+  800b0a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800b0c:	85 c0                	test   %eax,%eax
+  800b0e:	78 15                	js     800b25 <close+0x31>
+
+    return fd_close(fd, 1);
+  800b10:	be 01 00 00 00       	mov    $0x1,%esi
+  800b15:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800b19:	48 b8 4a 0a 80 00 00 	movabs $0x800a4a,%rax
+  800b20:	00 00 00 
+  800b23:	ff d0                	call   *%rax
+}
+  800b25:	c9                   	leave
+  800b26:	c3                   	ret
+
+0000000000800b27 <close_all>:
+
+void
+close_all(void) {
+  800b27:	55                   	push   %rbp
+  800b28:	48 89 e5             	mov    %rsp,%rbp
+  800b2b:	41 54                	push   %r12
+  800b2d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800b2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b33:	49 bc f4 0a 80 00 00 	movabs $0x800af4,%r12
+  800b3a:	00 00 00 
+  800b3d:	89 df                	mov    %ebx,%edi
+  800b3f:	41 ff d4             	call   *%r12
+  800b42:	83 c3 01             	add    $0x1,%ebx
+  800b45:	83 fb 20             	cmp    $0x20,%ebx
+  800b48:	75 f3                	jne    800b3d <close_all+0x16>
+}
+  800b4a:	5b                   	pop    %rbx
+  800b4b:	41 5c                	pop    %r12
+  800b4d:	5d                   	pop    %rbp
+  800b4e:	c3                   	ret
+
+0000000000800b4f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800b4f:	55                   	push   %rbp
+  800b50:	48 89 e5             	mov    %rsp,%rbp
+  800b53:	41 57                	push   %r15
+  800b55:	41 56                	push   %r14
+  800b57:	41 55                	push   %r13
+  800b59:	41 54                	push   %r12
+  800b5b:	53                   	push   %rbx
+  800b5c:	48 83 ec 18          	sub    $0x18,%rsp
+  800b60:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800b63:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800b67:	48 b8 8f 09 80 00 00 	movabs $0x80098f,%rax
+  800b6e:	00 00 00 
+  800b71:	ff d0                	call   *%rax
+  800b73:	89 c3                	mov    %eax,%ebx
+  800b75:	85 c0                	test   %eax,%eax
+  800b77:	0f 88 b8 00 00 00    	js     800c35 <dup+0xe6>
+    close(newfdnum);
+  800b7d:	44 89 e7             	mov    %r12d,%edi
+  800b80:	48 b8 f4 0a 80 00 00 	movabs $0x800af4,%rax
+  800b87:	00 00 00 
+  800b8a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800b8c:	4d 63 ec             	movslq %r12d,%r13
+  800b8f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800b96:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800b9a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800b9e:	4c 89 ff             	mov    %r15,%rdi
+  800ba1:	49 be 13 09 80 00 00 	movabs $0x800913,%r14
+  800ba8:	00 00 00 
+  800bab:	41 ff d6             	call   *%r14
+  800bae:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800bb1:	4c 89 ef             	mov    %r13,%rdi
+  800bb4:	41 ff d6             	call   *%r14
+  800bb7:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800bba:	48 89 df             	mov    %rbx,%rdi
+  800bbd:	48 b8 ad 18 80 00 00 	movabs $0x8018ad,%rax
+  800bc4:	00 00 00 
+  800bc7:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800bc9:	a8 04                	test   $0x4,%al
+  800bcb:	74 2b                	je     800bf8 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800bcd:	41 89 c1             	mov    %eax,%r9d
+  800bd0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800bd6:	4c 89 f1             	mov    %r14,%rcx
+  800bd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bde:	48 89 de             	mov    %rbx,%rsi
+  800be1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800be6:	48 b8 0b 03 80 00 00 	movabs $0x80030b,%rax
+  800bed:	00 00 00 
+  800bf0:	ff d0                	call   *%rax
+  800bf2:	89 c3                	mov    %eax,%ebx
+  800bf4:	85 c0                	test   %eax,%eax
+  800bf6:	78 4e                	js     800c46 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800bf8:	4c 89 ff             	mov    %r15,%rdi
+  800bfb:	48 b8 ad 18 80 00 00 	movabs $0x8018ad,%rax
+  800c02:	00 00 00 
+  800c05:	ff d0                	call   *%rax
+  800c07:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800c0a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800c10:	4c 89 e9             	mov    %r13,%rcx
+  800c13:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c18:	4c 89 fe             	mov    %r15,%rsi
+  800c1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c20:	48 b8 0b 03 80 00 00 	movabs $0x80030b,%rax
+  800c27:	00 00 00 
+  800c2a:	ff d0                	call   *%rax
+  800c2c:	89 c3                	mov    %eax,%ebx
+  800c2e:	85 c0                	test   %eax,%eax
+  800c30:	78 14                	js     800c46 <dup+0xf7>
+
+    return newfdnum;
+  800c32:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800c35:	89 d8                	mov    %ebx,%eax
+  800c37:	48 83 c4 18          	add    $0x18,%rsp
+  800c3b:	5b                   	pop    %rbx
+  800c3c:	41 5c                	pop    %r12
+  800c3e:	41 5d                	pop    %r13
+  800c40:	41 5e                	pop    %r14
+  800c42:	41 5f                	pop    %r15
+  800c44:	5d                   	pop    %rbp
+  800c45:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800c46:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800c4b:	4c 89 ee             	mov    %r13,%rsi
+  800c4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c53:	49 bc 70 03 80 00 00 	movabs $0x800370,%r12
+  800c5a:	00 00 00 
+  800c5d:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800c60:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800c65:	4c 89 f6             	mov    %r14,%rsi
+  800c68:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c6d:	41 ff d4             	call   *%r12
+    return res;
+  800c70:	eb c3                	jmp    800c35 <dup+0xe6>
+
+0000000000800c72 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800c72:	55                   	push   %rbp
+  800c73:	48 89 e5             	mov    %rsp,%rbp
+  800c76:	41 56                	push   %r14
+  800c78:	41 55                	push   %r13
+  800c7a:	41 54                	push   %r12
+  800c7c:	53                   	push   %rbx
+  800c7d:	48 83 ec 10          	sub    $0x10,%rsp
+  800c81:	89 fb                	mov    %edi,%ebx
+  800c83:	49 89 f4             	mov    %rsi,%r12
+  800c86:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c89:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c8d:	48 b8 8f 09 80 00 00 	movabs $0x80098f,%rax
+  800c94:	00 00 00 
+  800c97:	ff d0                	call   *%rax
+  800c99:	85 c0                	test   %eax,%eax
+  800c9b:	78 4c                	js     800ce9 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c9d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800ca1:	41 8b 3e             	mov    (%r14),%edi
+  800ca4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ca8:	48 b8 da 09 80 00 00 	movabs $0x8009da,%rax
+  800caf:	00 00 00 
+  800cb2:	ff d0                	call   *%rax
+  800cb4:	85 c0                	test   %eax,%eax
+  800cb6:	78 35                	js     800ced <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800cb8:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800cbc:	83 e0 03             	and    $0x3,%eax
+  800cbf:	83 f8 01             	cmp    $0x1,%eax
+  800cc2:	74 2d                	je     800cf1 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800cc4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800cc8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800ccc:	48 85 c0             	test   %rax,%rax
+  800ccf:	74 56                	je     800d27 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800cd1:	4c 89 ea             	mov    %r13,%rdx
+  800cd4:	4c 89 e6             	mov    %r12,%rsi
+  800cd7:	4c 89 f7             	mov    %r14,%rdi
+  800cda:	ff d0                	call   *%rax
+}
+  800cdc:	48 83 c4 10          	add    $0x10,%rsp
+  800ce0:	5b                   	pop    %rbx
+  800ce1:	41 5c                	pop    %r12
+  800ce3:	41 5d                	pop    %r13
+  800ce5:	41 5e                	pop    %r14
+  800ce7:	5d                   	pop    %rbp
+  800ce8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ce9:	48 98                	cltq
+  800ceb:	eb ef                	jmp    800cdc <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ced:	48 98                	cltq
+  800cef:	eb eb                	jmp    800cdc <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800cf1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800cf8:	00 00 00 
+  800cfb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800d01:	89 da                	mov    %ebx,%edx
+  800d03:	48 bf 19 31 80 00 00 	movabs $0x803119,%rdi
+  800d0a:	00 00 00 
+  800d0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d12:	48 b9 01 1f 80 00 00 	movabs $0x801f01,%rcx
+  800d19:	00 00 00 
+  800d1c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d1e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800d25:	eb b5                	jmp    800cdc <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800d27:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800d2e:	eb ac                	jmp    800cdc <read+0x6a>
+
+0000000000800d30 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800d30:	55                   	push   %rbp
+  800d31:	48 89 e5             	mov    %rsp,%rbp
+  800d34:	41 57                	push   %r15
+  800d36:	41 56                	push   %r14
+  800d38:	41 55                	push   %r13
+  800d3a:	41 54                	push   %r12
+  800d3c:	53                   	push   %rbx
+  800d3d:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800d41:	48 85 d2             	test   %rdx,%rdx
+  800d44:	74 54                	je     800d9a <readn+0x6a>
+  800d46:	41 89 fd             	mov    %edi,%r13d
+  800d49:	49 89 f6             	mov    %rsi,%r14
+  800d4c:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800d4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800d54:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800d59:	49 bf 72 0c 80 00 00 	movabs $0x800c72,%r15
+  800d60:	00 00 00 
+  800d63:	4c 89 e2             	mov    %r12,%rdx
+  800d66:	48 29 f2             	sub    %rsi,%rdx
+  800d69:	4c 01 f6             	add    %r14,%rsi
+  800d6c:	44 89 ef             	mov    %r13d,%edi
+  800d6f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800d72:	85 c0                	test   %eax,%eax
+  800d74:	78 20                	js     800d96 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800d76:	01 c3                	add    %eax,%ebx
+  800d78:	85 c0                	test   %eax,%eax
+  800d7a:	74 08                	je     800d84 <readn+0x54>
+  800d7c:	48 63 f3             	movslq %ebx,%rsi
+  800d7f:	4c 39 e6             	cmp    %r12,%rsi
+  800d82:	72 df                	jb     800d63 <readn+0x33>
+    }
+    return res;
+  800d84:	48 63 c3             	movslq %ebx,%rax
+}
+  800d87:	48 83 c4 08          	add    $0x8,%rsp
+  800d8b:	5b                   	pop    %rbx
+  800d8c:	41 5c                	pop    %r12
+  800d8e:	41 5d                	pop    %r13
+  800d90:	41 5e                	pop    %r14
+  800d92:	41 5f                	pop    %r15
+  800d94:	5d                   	pop    %rbp
+  800d95:	c3                   	ret
+        if (inc < 0) return inc;
+  800d96:	48 98                	cltq
+  800d98:	eb ed                	jmp    800d87 <readn+0x57>
+    int inc = 1, res = 0;
+  800d9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d9f:	eb e3                	jmp    800d84 <readn+0x54>
+
+0000000000800da1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800da1:	55                   	push   %rbp
+  800da2:	48 89 e5             	mov    %rsp,%rbp
+  800da5:	41 56                	push   %r14
+  800da7:	41 55                	push   %r13
+  800da9:	41 54                	push   %r12
+  800dab:	53                   	push   %rbx
+  800dac:	48 83 ec 10          	sub    $0x10,%rsp
+  800db0:	89 fb                	mov    %edi,%ebx
+  800db2:	49 89 f4             	mov    %rsi,%r12
+  800db5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800db8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800dbc:	48 b8 8f 09 80 00 00 	movabs $0x80098f,%rax
+  800dc3:	00 00 00 
+  800dc6:	ff d0                	call   *%rax
+  800dc8:	85 c0                	test   %eax,%eax
+  800dca:	78 47                	js     800e13 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800dcc:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800dd0:	41 8b 3e             	mov    (%r14),%edi
+  800dd3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800dd7:	48 b8 da 09 80 00 00 	movabs $0x8009da,%rax
+  800dde:	00 00 00 
+  800de1:	ff d0                	call   *%rax
+  800de3:	85 c0                	test   %eax,%eax
+  800de5:	78 30                	js     800e17 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800de7:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800dec:	74 2d                	je     800e1b <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800dee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800df2:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800df6:	48 85 c0             	test   %rax,%rax
+  800df9:	74 56                	je     800e51 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800dfb:	4c 89 ea             	mov    %r13,%rdx
+  800dfe:	4c 89 e6             	mov    %r12,%rsi
+  800e01:	4c 89 f7             	mov    %r14,%rdi
+  800e04:	ff d0                	call   *%rax
+}
+  800e06:	48 83 c4 10          	add    $0x10,%rsp
+  800e0a:	5b                   	pop    %rbx
+  800e0b:	41 5c                	pop    %r12
+  800e0d:	41 5d                	pop    %r13
+  800e0f:	41 5e                	pop    %r14
+  800e11:	5d                   	pop    %rbp
+  800e12:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e13:	48 98                	cltq
+  800e15:	eb ef                	jmp    800e06 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e17:	48 98                	cltq
+  800e19:	eb eb                	jmp    800e06 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800e1b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800e22:	00 00 00 
+  800e25:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800e2b:	89 da                	mov    %ebx,%edx
+  800e2d:	48 bf 35 31 80 00 00 	movabs $0x803135,%rdi
+  800e34:	00 00 00 
+  800e37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3c:	48 b9 01 1f 80 00 00 	movabs $0x801f01,%rcx
+  800e43:	00 00 00 
+  800e46:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e48:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800e4f:	eb b5                	jmp    800e06 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800e51:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800e58:	eb ac                	jmp    800e06 <write+0x65>
+
+0000000000800e5a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800e5a:	55                   	push   %rbp
+  800e5b:	48 89 e5             	mov    %rsp,%rbp
+  800e5e:	53                   	push   %rbx
+  800e5f:	48 83 ec 18          	sub    $0x18,%rsp
+  800e63:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e65:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e69:	48 b8 8f 09 80 00 00 	movabs $0x80098f,%rax
+  800e70:	00 00 00 
+  800e73:	ff d0                	call   *%rax
+  800e75:	85 c0                	test   %eax,%eax
+  800e77:	78 0c                	js     800e85 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800e79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e7d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800e80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e85:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e89:	c9                   	leave
+  800e8a:	c3                   	ret
+
+0000000000800e8b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800e8b:	55                   	push   %rbp
+  800e8c:	48 89 e5             	mov    %rsp,%rbp
+  800e8f:	41 55                	push   %r13
+  800e91:	41 54                	push   %r12
+  800e93:	53                   	push   %rbx
+  800e94:	48 83 ec 18          	sub    $0x18,%rsp
+  800e98:	89 fb                	mov    %edi,%ebx
+  800e9a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e9d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ea1:	48 b8 8f 09 80 00 00 	movabs $0x80098f,%rax
+  800ea8:	00 00 00 
+  800eab:	ff d0                	call   *%rax
+  800ead:	85 c0                	test   %eax,%eax
+  800eaf:	78 38                	js     800ee9 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800eb1:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800eb5:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800eb9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ebd:	48 b8 da 09 80 00 00 	movabs $0x8009da,%rax
+  800ec4:	00 00 00 
+  800ec7:	ff d0                	call   *%rax
+  800ec9:	85 c0                	test   %eax,%eax
+  800ecb:	78 1c                	js     800ee9 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800ecd:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800ed2:	74 20                	je     800ef4 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800ed4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ed8:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800edc:	48 85 c0             	test   %rax,%rax
+  800edf:	74 47                	je     800f28 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800ee1:	44 89 e6             	mov    %r12d,%esi
+  800ee4:	4c 89 ef             	mov    %r13,%rdi
+  800ee7:	ff d0                	call   *%rax
+}
+  800ee9:	48 83 c4 18          	add    $0x18,%rsp
+  800eed:	5b                   	pop    %rbx
+  800eee:	41 5c                	pop    %r12
+  800ef0:	41 5d                	pop    %r13
+  800ef2:	5d                   	pop    %rbp
+  800ef3:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800ef4:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800efb:	00 00 00 
+  800efe:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800f04:	89 da                	mov    %ebx,%edx
+  800f06:	48 bf f8 30 80 00 00 	movabs $0x8030f8,%rdi
+  800f0d:	00 00 00 
+  800f10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f15:	48 b9 01 1f 80 00 00 	movabs $0x801f01,%rcx
+  800f1c:	00 00 00 
+  800f1f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800f21:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f26:	eb c1                	jmp    800ee9 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800f28:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f2d:	eb ba                	jmp    800ee9 <ftruncate+0x5e>
+
+0000000000800f2f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800f2f:	55                   	push   %rbp
+  800f30:	48 89 e5             	mov    %rsp,%rbp
+  800f33:	41 54                	push   %r12
+  800f35:	53                   	push   %rbx
+  800f36:	48 83 ec 10          	sub    $0x10,%rsp
+  800f3a:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f3d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f41:	48 b8 8f 09 80 00 00 	movabs $0x80098f,%rax
+  800f48:	00 00 00 
+  800f4b:	ff d0                	call   *%rax
+  800f4d:	85 c0                	test   %eax,%eax
+  800f4f:	78 4e                	js     800f9f <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f51:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800f55:	41 8b 3c 24          	mov    (%r12),%edi
+  800f59:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800f5d:	48 b8 da 09 80 00 00 	movabs $0x8009da,%rax
+  800f64:	00 00 00 
+  800f67:	ff d0                	call   *%rax
+  800f69:	85 c0                	test   %eax,%eax
+  800f6b:	78 32                	js     800f9f <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800f6d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800f71:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800f76:	74 30                	je     800fa8 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800f78:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800f7b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800f82:	00 00 00 
+    stat->st_isdir = 0;
+  800f85:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800f8c:	00 00 00 
+    stat->st_dev = dev;
+  800f8f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800f96:	48 89 de             	mov    %rbx,%rsi
+  800f99:	4c 89 e7             	mov    %r12,%rdi
+  800f9c:	ff 50 28             	call   *0x28(%rax)
+}
+  800f9f:	48 83 c4 10          	add    $0x10,%rsp
+  800fa3:	5b                   	pop    %rbx
+  800fa4:	41 5c                	pop    %r12
+  800fa6:	5d                   	pop    %rbp
+  800fa7:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800fa8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800fad:	eb f0                	jmp    800f9f <fstat+0x70>
+
+0000000000800faf <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800faf:	55                   	push   %rbp
+  800fb0:	48 89 e5             	mov    %rsp,%rbp
+  800fb3:	41 54                	push   %r12
+  800fb5:	53                   	push   %rbx
+  800fb6:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800fb9:	be 00 00 00 00       	mov    $0x0,%esi
+  800fbe:	48 b8 30 12 80 00 00 	movabs $0x801230,%rax
+  800fc5:	00 00 00 
+  800fc8:	ff d0                	call   *%rax
+  800fca:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800fcc:	85 c0                	test   %eax,%eax
+  800fce:	78 25                	js     800ff5 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800fd0:	4c 89 e6             	mov    %r12,%rsi
+  800fd3:	89 c7                	mov    %eax,%edi
+  800fd5:	48 b8 2f 0f 80 00 00 	movabs $0x800f2f,%rax
+  800fdc:	00 00 00 
+  800fdf:	ff d0                	call   *%rax
+  800fe1:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800fe4:	89 df                	mov    %ebx,%edi
+  800fe6:	48 b8 f4 0a 80 00 00 	movabs $0x800af4,%rax
+  800fed:	00 00 00 
+  800ff0:	ff d0                	call   *%rax
+
+    return res;
+  800ff2:	44 89 e3             	mov    %r12d,%ebx
+}
+  800ff5:	89 d8                	mov    %ebx,%eax
+  800ff7:	5b                   	pop    %rbx
+  800ff8:	41 5c                	pop    %r12
+  800ffa:	5d                   	pop    %rbp
+  800ffb:	c3                   	ret
+
+0000000000800ffc <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800ffc:	55                   	push   %rbp
+  800ffd:	48 89 e5             	mov    %rsp,%rbp
+  801000:	41 54                	push   %r12
+  801002:	53                   	push   %rbx
+  801003:	48 83 ec 10          	sub    $0x10,%rsp
+  801007:	41 89 fc             	mov    %edi,%r12d
+  80100a:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80100d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801014:	00 00 00 
+  801017:	83 38 00             	cmpl   $0x0,(%rax)
+  80101a:	74 5e                	je     80107a <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80101c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801022:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801027:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80102e:	00 00 00 
+  801031:	44 89 e6             	mov    %r12d,%esi
+  801034:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80103b:	00 00 00 
+  80103e:	8b 38                	mov    (%rax),%edi
+  801040:	48 b8 a4 2f 80 00 00 	movabs $0x802fa4,%rax
+  801047:	00 00 00 
+  80104a:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  80104c:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801053:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801054:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801059:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80105d:	48 89 de             	mov    %rbx,%rsi
+  801060:	bf 00 00 00 00       	mov    $0x0,%edi
+  801065:	48 b8 0f 2f 80 00 00 	movabs $0x802f0f,%rax
+  80106c:	00 00 00 
+  80106f:	ff d0                	call   *%rax
+}
+  801071:	48 83 c4 10          	add    $0x10,%rsp
+  801075:	5b                   	pop    %rbx
+  801076:	41 5c                	pop    %r12
+  801078:	5d                   	pop    %rbp
+  801079:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80107a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80107f:	48 b8 44 30 80 00 00 	movabs $0x803044,%rax
+  801086:	00 00 00 
+  801089:	ff d0                	call   *%rax
+  80108b:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801092:	00 00 
+  801094:	eb 86                	jmp    80101c <fsipc+0x20>
+
+0000000000801096 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801096:	55                   	push   %rbp
+  801097:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80109a:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8010a1:	00 00 00 
+  8010a4:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8010a7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8010a9:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8010ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b1:	bf 02 00 00 00       	mov    $0x2,%edi
+  8010b6:	48 b8 fc 0f 80 00 00 	movabs $0x800ffc,%rax
+  8010bd:	00 00 00 
+  8010c0:	ff d0                	call   *%rax
+}
+  8010c2:	5d                   	pop    %rbp
+  8010c3:	c3                   	ret
+
+00000000008010c4 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8010c4:	55                   	push   %rbp
+  8010c5:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8010c8:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8010cb:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8010d2:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8010d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d9:	bf 06 00 00 00       	mov    $0x6,%edi
+  8010de:	48 b8 fc 0f 80 00 00 	movabs $0x800ffc,%rax
+  8010e5:	00 00 00 
+  8010e8:	ff d0                	call   *%rax
+}
+  8010ea:	5d                   	pop    %rbp
+  8010eb:	c3                   	ret
+
+00000000008010ec <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8010ec:	55                   	push   %rbp
+  8010ed:	48 89 e5             	mov    %rsp,%rbp
+  8010f0:	41 54                	push   %r12
+  8010f2:	53                   	push   %rbx
+  8010f3:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8010f6:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8010f9:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801100:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801102:	be 00 00 00 00       	mov    $0x0,%esi
+  801107:	bf 05 00 00 00       	mov    $0x5,%edi
+  80110c:	48 b8 fc 0f 80 00 00 	movabs $0x800ffc,%rax
+  801113:	00 00 00 
+  801116:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801118:	85 c0                	test   %eax,%eax
+  80111a:	78 3d                	js     801159 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80111c:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801123:	00 00 00 
+  801126:	4c 89 e6             	mov    %r12,%rsi
+  801129:	48 89 df             	mov    %rbx,%rdi
+  80112c:	48 b8 26 28 80 00 00 	movabs $0x802826,%rax
+  801133:	00 00 00 
+  801136:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801138:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80113f:	00 
+  801140:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801146:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80114d:	00 
+  80114e:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801154:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801159:	5b                   	pop    %rbx
+  80115a:	41 5c                	pop    %r12
+  80115c:	5d                   	pop    %rbp
+  80115d:	c3                   	ret
+
+000000000080115e <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80115e:	55                   	push   %rbp
+  80115f:	48 89 e5             	mov    %rsp,%rbp
+  801162:	41 54                	push   %r12
+  801164:	53                   	push   %rbx
+  801165:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  801168:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80116d:	48 39 c2             	cmp    %rax,%rdx
+  801170:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801174:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801177:	48 89 c2             	mov    %rax,%rdx
+  80117a:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801181:	00 00 00 
+  801184:	48 b8 87 2a 80 00 00 	movabs $0x802a87,%rax
+  80118b:	00 00 00 
+  80118e:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801190:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801197:	00 00 00 
+  80119a:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80119f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8011a1:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8011a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011aa:	bf 04 00 00 00       	mov    $0x4,%edi
+  8011af:	48 b8 fc 0f 80 00 00 	movabs $0x800ffc,%rax
+  8011b6:	00 00 00 
+  8011b9:	ff d0                	call   *%rax
+  8011bb:	48 98                	cltq
+}
+  8011bd:	5b                   	pop    %rbx
+  8011be:	41 5c                	pop    %r12
+  8011c0:	5d                   	pop    %rbp
+  8011c1:	c3                   	ret
+
+00000000008011c2 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8011c2:	55                   	push   %rbp
+  8011c3:	48 89 e5             	mov    %rsp,%rbp
+  8011c6:	41 54                	push   %r12
+  8011c8:	53                   	push   %rbx
+  8011c9:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8011cc:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8011d3:	00 00 00 
+  8011d6:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8011d9:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8011db:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8011e0:	48 39 ca             	cmp    %rcx,%rdx
+  8011e3:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8011e7:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8011eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f0:	bf 03 00 00 00       	mov    $0x3,%edi
+  8011f5:	48 b8 fc 0f 80 00 00 	movabs $0x800ffc,%rax
+  8011fc:	00 00 00 
+  8011ff:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  801201:	85 c0                	test   %eax,%eax
+  801203:	78 27                	js     80122c <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  801205:	48 63 d8             	movslq %eax,%rbx
+  801208:	48 89 da             	mov    %rbx,%rdx
+  80120b:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801212:	00 00 00 
+  801215:	4c 89 e7             	mov    %r12,%rdi
+  801218:	48 b8 87 2a 80 00 00 	movabs $0x802a87,%rax
+  80121f:	00 00 00 
+  801222:	ff d0                	call   *%rax
+    return bytes_read;
+  801224:	48 89 d8             	mov    %rbx,%rax
+}
+  801227:	5b                   	pop    %rbx
+  801228:	41 5c                	pop    %r12
+  80122a:	5d                   	pop    %rbp
+  80122b:	c3                   	ret
+        return bytes_read;
+  80122c:	48 98                	cltq
+  80122e:	eb f7                	jmp    801227 <devfile_read+0x65>
+
+0000000000801230 <open>:
+open(const char *path, int mode) {
+  801230:	55                   	push   %rbp
+  801231:	48 89 e5             	mov    %rsp,%rbp
+  801234:	41 55                	push   %r13
+  801236:	41 54                	push   %r12
+  801238:	53                   	push   %rbx
+  801239:	48 83 ec 18          	sub    $0x18,%rsp
+  80123d:	49 89 fc             	mov    %rdi,%r12
+  801240:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801243:	48 b8 e8 27 80 00 00 	movabs $0x8027e8,%rax
+  80124a:	00 00 00 
+  80124d:	ff d0                	call   *%rax
+  80124f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801255:	0f 87 8a 00 00 00    	ja     8012e5 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80125b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80125f:	48 b8 2f 09 80 00 00 	movabs $0x80092f,%rax
+  801266:	00 00 00 
+  801269:	ff d0                	call   *%rax
+  80126b:	89 c3                	mov    %eax,%ebx
+  80126d:	85 c0                	test   %eax,%eax
+  80126f:	78 50                	js     8012c1 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801271:	4c 89 e6             	mov    %r12,%rsi
+  801274:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80127b:	00 00 00 
+  80127e:	48 89 df             	mov    %rbx,%rdi
+  801281:	48 b8 26 28 80 00 00 	movabs $0x802826,%rax
+  801288:	00 00 00 
+  80128b:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80128d:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801294:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801298:	bf 01 00 00 00       	mov    $0x1,%edi
+  80129d:	48 b8 fc 0f 80 00 00 	movabs $0x800ffc,%rax
+  8012a4:	00 00 00 
+  8012a7:	ff d0                	call   *%rax
+  8012a9:	89 c3                	mov    %eax,%ebx
+  8012ab:	85 c0                	test   %eax,%eax
+  8012ad:	78 1f                	js     8012ce <open+0x9e>
+    return fd2num(fd);
+  8012af:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8012b3:	48 b8 01 09 80 00 00 	movabs $0x800901,%rax
+  8012ba:	00 00 00 
+  8012bd:	ff d0                	call   *%rax
+  8012bf:	89 c3                	mov    %eax,%ebx
+}
+  8012c1:	89 d8                	mov    %ebx,%eax
+  8012c3:	48 83 c4 18          	add    $0x18,%rsp
+  8012c7:	5b                   	pop    %rbx
+  8012c8:	41 5c                	pop    %r12
+  8012ca:	41 5d                	pop    %r13
+  8012cc:	5d                   	pop    %rbp
+  8012cd:	c3                   	ret
+        fd_close(fd, 0);
+  8012ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8012d7:	48 b8 4a 0a 80 00 00 	movabs $0x800a4a,%rax
+  8012de:	00 00 00 
+  8012e1:	ff d0                	call   *%rax
+        return res;
+  8012e3:	eb dc                	jmp    8012c1 <open+0x91>
+        return -E_BAD_PATH;
+  8012e5:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8012ea:	eb d5                	jmp    8012c1 <open+0x91>
+
+00000000008012ec <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8012ec:	55                   	push   %rbp
+  8012ed:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8012f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f5:	bf 08 00 00 00       	mov    $0x8,%edi
+  8012fa:	48 b8 fc 0f 80 00 00 	movabs $0x800ffc,%rax
+  801301:	00 00 00 
+  801304:	ff d0                	call   *%rax
+}
+  801306:	5d                   	pop    %rbp
+  801307:	c3                   	ret
+
+0000000000801308 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801308:	55                   	push   %rbp
+  801309:	48 89 e5             	mov    %rsp,%rbp
+  80130c:	41 54                	push   %r12
+  80130e:	53                   	push   %rbx
+  80130f:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801312:	48 b8 13 09 80 00 00 	movabs $0x800913,%rax
+  801319:	00 00 00 
+  80131c:	ff d0                	call   *%rax
+  80131e:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801321:	48 be 80 31 80 00 00 	movabs $0x803180,%rsi
+  801328:	00 00 00 
+  80132b:	48 89 df             	mov    %rbx,%rdi
+  80132e:	48 b8 26 28 80 00 00 	movabs $0x802826,%rax
+  801335:	00 00 00 
+  801338:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80133a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80133f:	41 2b 04 24          	sub    (%r12),%eax
+  801343:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801349:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801350:	00 00 00 
+    stat->st_dev = &devpipe;
+  801353:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80135a:	00 00 00 
+  80135d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801364:	b8 00 00 00 00       	mov    $0x0,%eax
+  801369:	5b                   	pop    %rbx
+  80136a:	41 5c                	pop    %r12
+  80136c:	5d                   	pop    %rbp
+  80136d:	c3                   	ret
+
+000000000080136e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80136e:	55                   	push   %rbp
+  80136f:	48 89 e5             	mov    %rsp,%rbp
+  801372:	41 54                	push   %r12
+  801374:	53                   	push   %rbx
+  801375:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801378:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80137d:	48 89 fe             	mov    %rdi,%rsi
+  801380:	bf 00 00 00 00       	mov    $0x0,%edi
+  801385:	49 bc 70 03 80 00 00 	movabs $0x800370,%r12
+  80138c:	00 00 00 
+  80138f:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  801392:	48 89 df             	mov    %rbx,%rdi
+  801395:	48 b8 13 09 80 00 00 	movabs $0x800913,%rax
+  80139c:	00 00 00 
+  80139f:	ff d0                	call   *%rax
+  8013a1:	48 89 c6             	mov    %rax,%rsi
+  8013a4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8013a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013ae:	41 ff d4             	call   *%r12
+}
+  8013b1:	5b                   	pop    %rbx
+  8013b2:	41 5c                	pop    %r12
+  8013b4:	5d                   	pop    %rbp
+  8013b5:	c3                   	ret
+
+00000000008013b6 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8013b6:	55                   	push   %rbp
+  8013b7:	48 89 e5             	mov    %rsp,%rbp
+  8013ba:	41 57                	push   %r15
+  8013bc:	41 56                	push   %r14
+  8013be:	41 55                	push   %r13
+  8013c0:	41 54                	push   %r12
+  8013c2:	53                   	push   %rbx
+  8013c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8013c7:	49 89 fc             	mov    %rdi,%r12
+  8013ca:	49 89 f5             	mov    %rsi,%r13
+  8013cd:	49 89 d7             	mov    %rdx,%r15
+  8013d0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8013d4:	48 b8 13 09 80 00 00 	movabs $0x800913,%rax
+  8013db:	00 00 00 
+  8013de:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8013e0:	4d 85 ff             	test   %r15,%r15
+  8013e3:	0f 84 af 00 00 00    	je     801498 <devpipe_write+0xe2>
+  8013e9:	48 89 c3             	mov    %rax,%rbx
+  8013ec:	4c 89 f8             	mov    %r15,%rax
+  8013ef:	4d 89 ef             	mov    %r13,%r15
+  8013f2:	4c 01 e8             	add    %r13,%rax
+  8013f5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8013f9:	49 bd 78 02 80 00 00 	movabs $0x800278,%r13
+  801400:	00 00 00 
+            sys_yield();
+  801403:	49 be 15 02 80 00 00 	movabs $0x800215,%r14
+  80140a:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80140d:	8b 73 04             	mov    0x4(%rbx),%esi
+  801410:	48 63 ce             	movslq %esi,%rcx
+  801413:	48 63 03             	movslq (%rbx),%rax
+  801416:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80141c:	48 39 c1             	cmp    %rax,%rcx
+  80141f:	72 2e                	jb     80144f <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801421:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801426:	48 89 da             	mov    %rbx,%rdx
+  801429:	be 00 10 00 00       	mov    $0x1000,%esi
+  80142e:	4c 89 e7             	mov    %r12,%rdi
+  801431:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801434:	85 c0                	test   %eax,%eax
+  801436:	74 66                	je     80149e <devpipe_write+0xe8>
+            sys_yield();
+  801438:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80143b:	8b 73 04             	mov    0x4(%rbx),%esi
+  80143e:	48 63 ce             	movslq %esi,%rcx
+  801441:	48 63 03             	movslq (%rbx),%rax
+  801444:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80144a:	48 39 c1             	cmp    %rax,%rcx
+  80144d:	73 d2                	jae    801421 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80144f:	41 0f b6 3f          	movzbl (%r15),%edi
+  801453:	48 89 ca             	mov    %rcx,%rdx
+  801456:	48 c1 ea 03          	shr    $0x3,%rdx
+  80145a:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  801461:	08 10 20 
+  801464:	48 f7 e2             	mul    %rdx
+  801467:	48 c1 ea 06          	shr    $0x6,%rdx
+  80146b:	48 89 d0             	mov    %rdx,%rax
+  80146e:	48 c1 e0 09          	shl    $0x9,%rax
+  801472:	48 29 d0             	sub    %rdx,%rax
+  801475:	48 c1 e0 03          	shl    $0x3,%rax
+  801479:	48 29 c1             	sub    %rax,%rcx
+  80147c:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  801481:	83 c6 01             	add    $0x1,%esi
+  801484:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801487:	49 83 c7 01          	add    $0x1,%r15
+  80148b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80148f:	49 39 c7             	cmp    %rax,%r15
+  801492:	0f 85 75 ff ff ff    	jne    80140d <devpipe_write+0x57>
+    return n;
+  801498:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80149c:	eb 05                	jmp    8014a3 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80149e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014a3:	48 83 c4 18          	add    $0x18,%rsp
+  8014a7:	5b                   	pop    %rbx
+  8014a8:	41 5c                	pop    %r12
+  8014aa:	41 5d                	pop    %r13
+  8014ac:	41 5e                	pop    %r14
+  8014ae:	41 5f                	pop    %r15
+  8014b0:	5d                   	pop    %rbp
+  8014b1:	c3                   	ret
+
+00000000008014b2 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8014b2:	55                   	push   %rbp
+  8014b3:	48 89 e5             	mov    %rsp,%rbp
+  8014b6:	41 57                	push   %r15
+  8014b8:	41 56                	push   %r14
+  8014ba:	41 55                	push   %r13
+  8014bc:	41 54                	push   %r12
+  8014be:	53                   	push   %rbx
+  8014bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8014c3:	49 89 fc             	mov    %rdi,%r12
+  8014c6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8014ca:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8014ce:	48 b8 13 09 80 00 00 	movabs $0x800913,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+  8014da:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8014dd:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8014e3:	49 bd 78 02 80 00 00 	movabs $0x800278,%r13
+  8014ea:	00 00 00 
+            sys_yield();
+  8014ed:	49 be 15 02 80 00 00 	movabs $0x800215,%r14
+  8014f4:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8014f7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8014fc:	74 7d                	je     80157b <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8014fe:	8b 03                	mov    (%rbx),%eax
+  801500:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801503:	75 26                	jne    80152b <devpipe_read+0x79>
+            if (i > 0) return i;
+  801505:	4d 85 ff             	test   %r15,%r15
+  801508:	75 77                	jne    801581 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80150a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80150f:	48 89 da             	mov    %rbx,%rdx
+  801512:	be 00 10 00 00       	mov    $0x1000,%esi
+  801517:	4c 89 e7             	mov    %r12,%rdi
+  80151a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80151d:	85 c0                	test   %eax,%eax
+  80151f:	74 72                	je     801593 <devpipe_read+0xe1>
+            sys_yield();
+  801521:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801524:	8b 03                	mov    (%rbx),%eax
+  801526:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801529:	74 df                	je     80150a <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80152b:	48 63 c8             	movslq %eax,%rcx
+  80152e:	48 89 ca             	mov    %rcx,%rdx
+  801531:	48 c1 ea 03          	shr    $0x3,%rdx
+  801535:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80153c:	08 10 20 
+  80153f:	48 89 d0             	mov    %rdx,%rax
+  801542:	48 f7 e6             	mul    %rsi
+  801545:	48 c1 ea 06          	shr    $0x6,%rdx
+  801549:	48 89 d0             	mov    %rdx,%rax
+  80154c:	48 c1 e0 09          	shl    $0x9,%rax
+  801550:	48 29 d0             	sub    %rdx,%rax
+  801553:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80155a:	00 
+  80155b:	48 89 c8             	mov    %rcx,%rax
+  80155e:	48 29 d0             	sub    %rdx,%rax
+  801561:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801566:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80156a:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80156e:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801571:	49 83 c7 01          	add    $0x1,%r15
+  801575:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801579:	75 83                	jne    8014fe <devpipe_read+0x4c>
+    return n;
+  80157b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80157f:	eb 03                	jmp    801584 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  801581:	4c 89 f8             	mov    %r15,%rax
+}
+  801584:	48 83 c4 18          	add    $0x18,%rsp
+  801588:	5b                   	pop    %rbx
+  801589:	41 5c                	pop    %r12
+  80158b:	41 5d                	pop    %r13
+  80158d:	41 5e                	pop    %r14
+  80158f:	41 5f                	pop    %r15
+  801591:	5d                   	pop    %rbp
+  801592:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  801593:	b8 00 00 00 00       	mov    $0x0,%eax
+  801598:	eb ea                	jmp    801584 <devpipe_read+0xd2>
+
+000000000080159a <pipe>:
+pipe(int pfd[2]) {
+  80159a:	55                   	push   %rbp
+  80159b:	48 89 e5             	mov    %rsp,%rbp
+  80159e:	41 55                	push   %r13
+  8015a0:	41 54                	push   %r12
+  8015a2:	53                   	push   %rbx
+  8015a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8015a7:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8015aa:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8015ae:	48 b8 2f 09 80 00 00 	movabs $0x80092f,%rax
+  8015b5:	00 00 00 
+  8015b8:	ff d0                	call   *%rax
+  8015ba:	89 c3                	mov    %eax,%ebx
+  8015bc:	85 c0                	test   %eax,%eax
+  8015be:	0f 88 a0 01 00 00    	js     801764 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8015c4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8015c9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8015ce:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8015d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015d7:	48 b8 a4 02 80 00 00 	movabs $0x8002a4,%rax
+  8015de:	00 00 00 
+  8015e1:	ff d0                	call   *%rax
+  8015e3:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8015e5:	85 c0                	test   %eax,%eax
+  8015e7:	0f 88 77 01 00 00    	js     801764 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8015ed:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8015f1:	48 b8 2f 09 80 00 00 	movabs $0x80092f,%rax
+  8015f8:	00 00 00 
+  8015fb:	ff d0                	call   *%rax
+  8015fd:	89 c3                	mov    %eax,%ebx
+  8015ff:	85 c0                	test   %eax,%eax
+  801601:	0f 88 43 01 00 00    	js     80174a <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801607:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80160c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801611:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801615:	bf 00 00 00 00       	mov    $0x0,%edi
+  80161a:	48 b8 a4 02 80 00 00 	movabs $0x8002a4,%rax
+  801621:	00 00 00 
+  801624:	ff d0                	call   *%rax
+  801626:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801628:	85 c0                	test   %eax,%eax
+  80162a:	0f 88 1a 01 00 00    	js     80174a <pipe+0x1b0>
+    va = fd2data(fd0);
+  801630:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801634:	48 b8 13 09 80 00 00 	movabs $0x800913,%rax
+  80163b:	00 00 00 
+  80163e:	ff d0                	call   *%rax
+  801640:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801643:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801648:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80164d:	48 89 c6             	mov    %rax,%rsi
+  801650:	bf 00 00 00 00       	mov    $0x0,%edi
+  801655:	48 b8 a4 02 80 00 00 	movabs $0x8002a4,%rax
+  80165c:	00 00 00 
+  80165f:	ff d0                	call   *%rax
+  801661:	89 c3                	mov    %eax,%ebx
+  801663:	85 c0                	test   %eax,%eax
+  801665:	0f 88 c5 00 00 00    	js     801730 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80166b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80166f:	48 b8 13 09 80 00 00 	movabs $0x800913,%rax
+  801676:	00 00 00 
+  801679:	ff d0                	call   *%rax
+  80167b:	48 89 c1             	mov    %rax,%rcx
+  80167e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  801684:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80168a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80168f:	4c 89 ee             	mov    %r13,%rsi
+  801692:	bf 00 00 00 00       	mov    $0x0,%edi
+  801697:	48 b8 0b 03 80 00 00 	movabs $0x80030b,%rax
+  80169e:	00 00 00 
+  8016a1:	ff d0                	call   *%rax
+  8016a3:	89 c3                	mov    %eax,%ebx
+  8016a5:	85 c0                	test   %eax,%eax
+  8016a7:	78 6e                	js     801717 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8016a9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8016ae:	4c 89 ef             	mov    %r13,%rdi
+  8016b1:	48 b8 46 02 80 00 00 	movabs $0x800246,%rax
+  8016b8:	00 00 00 
+  8016bb:	ff d0                	call   *%rax
+  8016bd:	83 f8 02             	cmp    $0x2,%eax
+  8016c0:	0f 85 ab 00 00 00    	jne    801771 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8016c6:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8016cd:	00 00 
+  8016cf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8016d3:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8016d5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8016d9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8016e0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8016e4:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8016e6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8016ea:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8016f1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8016f5:	48 bb 01 09 80 00 00 	movabs $0x800901,%rbx
+  8016fc:	00 00 00 
+  8016ff:	ff d3                	call   *%rbx
+  801701:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801705:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801709:	ff d3                	call   *%rbx
+  80170b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  801710:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801715:	eb 4d                	jmp    801764 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  801717:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80171c:	4c 89 ee             	mov    %r13,%rsi
+  80171f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801724:	48 b8 70 03 80 00 00 	movabs $0x800370,%rax
+  80172b:	00 00 00 
+  80172e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  801730:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801735:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801739:	bf 00 00 00 00       	mov    $0x0,%edi
+  80173e:	48 b8 70 03 80 00 00 	movabs $0x800370,%rax
+  801745:	00 00 00 
+  801748:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80174a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80174f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801753:	bf 00 00 00 00       	mov    $0x0,%edi
+  801758:	48 b8 70 03 80 00 00 	movabs $0x800370,%rax
+  80175f:	00 00 00 
+  801762:	ff d0                	call   *%rax
+}
+  801764:	89 d8                	mov    %ebx,%eax
+  801766:	48 83 c4 18          	add    $0x18,%rsp
+  80176a:	5b                   	pop    %rbx
+  80176b:	41 5c                	pop    %r12
+  80176d:	41 5d                	pop    %r13
+  80176f:	5d                   	pop    %rbp
+  801770:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801771:	48 b9 b0 31 80 00 00 	movabs $0x8031b0,%rcx
+  801778:	00 00 00 
+  80177b:	48 ba 87 31 80 00 00 	movabs $0x803187,%rdx
+  801782:	00 00 00 
+  801785:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80178a:	48 bf 9c 31 80 00 00 	movabs $0x80319c,%rdi
+  801791:	00 00 00 
+  801794:	b8 00 00 00 00       	mov    $0x0,%eax
+  801799:	49 b8 b1 1d 80 00 00 	movabs $0x801db1,%r8
+  8017a0:	00 00 00 
+  8017a3:	41 ff d0             	call   *%r8
+
+00000000008017a6 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8017a6:	55                   	push   %rbp
+  8017a7:	48 89 e5             	mov    %rsp,%rbp
+  8017aa:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8017ae:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8017b2:	48 b8 8f 09 80 00 00 	movabs $0x80098f,%rax
+  8017b9:	00 00 00 
+  8017bc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8017be:	85 c0                	test   %eax,%eax
+  8017c0:	78 35                	js     8017f7 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8017c2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8017c6:	48 b8 13 09 80 00 00 	movabs $0x800913,%rax
+  8017cd:	00 00 00 
+  8017d0:	ff d0                	call   *%rax
+  8017d2:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8017d5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8017da:	be 00 10 00 00       	mov    $0x1000,%esi
+  8017df:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8017e3:	48 b8 78 02 80 00 00 	movabs $0x800278,%rax
+  8017ea:	00 00 00 
+  8017ed:	ff d0                	call   *%rax
+  8017ef:	85 c0                	test   %eax,%eax
+  8017f1:	0f 94 c0             	sete   %al
+  8017f4:	0f b6 c0             	movzbl %al,%eax
+}
+  8017f7:	c9                   	leave
+  8017f8:	c3                   	ret
+
+00000000008017f9 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017f9:	48 89 f8             	mov    %rdi,%rax
+  8017fc:	48 c1 e8 27          	shr    $0x27,%rax
+  801800:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801807:	01 00 00 
+  80180a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80180e:	f6 c2 01             	test   $0x1,%dl
+  801811:	74 6d                	je     801880 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801813:	48 89 f8             	mov    %rdi,%rax
+  801816:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80181a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801821:	01 00 00 
+  801824:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801828:	f6 c2 01             	test   $0x1,%dl
+  80182b:	74 62                	je     80188f <get_uvpt_entry+0x96>
+  80182d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801834:	01 00 00 
+  801837:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80183b:	f6 c2 80             	test   $0x80,%dl
+  80183e:	75 4f                	jne    80188f <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801840:	48 89 f8             	mov    %rdi,%rax
+  801843:	48 c1 e8 15          	shr    $0x15,%rax
+  801847:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80184e:	01 00 00 
+  801851:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801855:	f6 c2 01             	test   $0x1,%dl
+  801858:	74 44                	je     80189e <get_uvpt_entry+0xa5>
+  80185a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801861:	01 00 00 
+  801864:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801868:	f6 c2 80             	test   $0x80,%dl
+  80186b:	75 31                	jne    80189e <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80186d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  801871:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801878:	01 00 00 
+  80187b:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80187f:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801880:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801887:	01 00 00 
+  80188a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80188e:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80188f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801896:	01 00 00 
+  801899:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80189d:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80189e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8018a5:	01 00 00 
+  8018a8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8018ac:	c3                   	ret
+
+00000000008018ad <get_prot>:
+
+int
+get_prot(void *va) {
+  8018ad:	55                   	push   %rbp
+  8018ae:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8018b1:	48 b8 f9 17 80 00 00 	movabs $0x8017f9,%rax
+  8018b8:	00 00 00 
+  8018bb:	ff d0                	call   *%rax
+  8018bd:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8018c0:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8018c5:	89 c1                	mov    %eax,%ecx
+  8018c7:	83 c9 04             	or     $0x4,%ecx
+  8018ca:	f6 c2 01             	test   $0x1,%dl
+  8018cd:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8018d0:	89 c1                	mov    %eax,%ecx
+  8018d2:	83 c9 02             	or     $0x2,%ecx
+  8018d5:	f6 c2 02             	test   $0x2,%dl
+  8018d8:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8018db:	89 c1                	mov    %eax,%ecx
+  8018dd:	83 c9 01             	or     $0x1,%ecx
+  8018e0:	48 85 d2             	test   %rdx,%rdx
+  8018e3:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8018e6:	89 c1                	mov    %eax,%ecx
+  8018e8:	83 c9 40             	or     $0x40,%ecx
+  8018eb:	f6 c6 04             	test   $0x4,%dh
+  8018ee:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8018f1:	5d                   	pop    %rbp
+  8018f2:	c3                   	ret
+
+00000000008018f3 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8018f3:	55                   	push   %rbp
+  8018f4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8018f7:	48 b8 f9 17 80 00 00 	movabs $0x8017f9,%rax
+  8018fe:	00 00 00 
+  801901:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  801903:	48 c1 e8 06          	shr    $0x6,%rax
+  801907:	83 e0 01             	and    $0x1,%eax
+}
+  80190a:	5d                   	pop    %rbp
+  80190b:	c3                   	ret
+
+000000000080190c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80190c:	55                   	push   %rbp
+  80190d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  801910:	48 b8 f9 17 80 00 00 	movabs $0x8017f9,%rax
+  801917:	00 00 00 
+  80191a:	ff d0                	call   *%rax
+  80191c:	83 e0 01             	and    $0x1,%eax
+}
+  80191f:	5d                   	pop    %rbp
+  801920:	c3                   	ret
+
+0000000000801921 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  801921:	55                   	push   %rbp
+  801922:	48 89 e5             	mov    %rsp,%rbp
+  801925:	41 57                	push   %r15
+  801927:	41 56                	push   %r14
+  801929:	41 55                	push   %r13
+  80192b:	41 54                	push   %r12
+  80192d:	53                   	push   %rbx
+  80192e:	48 83 ec 18          	sub    $0x18,%rsp
+  801932:	49 89 ff             	mov    %rdi,%r15
+  801935:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  801939:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  80193e:	49 bc 0c 19 80 00 00 	movabs $0x80190c,%r12
+  801945:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  801948:	49 be ad 18 80 00 00 	movabs $0x8018ad,%r14
+  80194f:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  801952:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  801959:	00 00 00 
+  80195c:	eb 0c                	jmp    80196a <foreach_shared_region+0x49>
+  80195e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801965:	4c 39 eb             	cmp    %r13,%rbx
+  801968:	74 38                	je     8019a2 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  80196a:	48 89 df             	mov    %rbx,%rdi
+  80196d:	41 ff d4             	call   *%r12
+  801970:	84 c0                	test   %al,%al
+  801972:	74 ea                	je     80195e <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  801974:	48 89 df             	mov    %rbx,%rdi
+  801977:	41 ff d6             	call   *%r14
+  80197a:	a8 40                	test   $0x40,%al
+  80197c:	74 e0                	je     80195e <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  80197e:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  801985:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801989:	48 89 df             	mov    %rbx,%rdi
+  80198c:	41 ff d7             	call   *%r15
+        if (err)
+  80198f:	85 c0                	test   %eax,%eax
+  801991:	74 cb                	je     80195e <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  801993:	48 83 c4 18          	add    $0x18,%rsp
+  801997:	5b                   	pop    %rbx
+  801998:	41 5c                	pop    %r12
+  80199a:	41 5d                	pop    %r13
+  80199c:	41 5e                	pop    %r14
+  80199e:	41 5f                	pop    %r15
+  8019a0:	5d                   	pop    %rbp
+  8019a1:	c3                   	ret
+    return 0;
+  8019a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a7:	eb ea                	jmp    801993 <foreach_shared_region+0x72>
+
+00000000008019a9 <_generic_signal_handler>:
+        (es->sa.sa_handler)(es->signo);
+    }
+}
+
+void
+_generic_signal_handler(struct UTrapframe *utf, struct EnqueuedSignal * es) {
+  8019a9:	55                   	push   %rbp
+  8019aa:	48 89 e5             	mov    %rsp,%rbp
+  8019ad:	41 55                	push   %r13
+  8019af:	41 54                	push   %r12
+  8019b1:	53                   	push   %rbx
+  8019b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8019b6:	49 89 fc             	mov    %rdi,%r12
+  8019b9:	48 89 f3             	mov    %rsi,%rbx
+    if (trace_signals)
+        cprintf("signals: env %x: begin generic handler for %d\n", sys_getenvid(), es->signo);
+  8019bc:	44 8b 2e             	mov    (%rsi),%r13d
+  8019bf:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  8019c6:	00 00 00 
+  8019c9:	ff d0                	call   *%rax
+  8019cb:	89 c6                	mov    %eax,%esi
+  8019cd:	44 89 ea             	mov    %r13d,%edx
+  8019d0:	48 bf d8 31 80 00 00 	movabs $0x8031d8,%rdi
+  8019d7:	00 00 00 
+  8019da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019df:	48 b9 01 1f 80 00 00 	movabs $0x801f01,%rcx
+  8019e6:	00 00 00 
+  8019e9:	ff d1                	call   *%rcx
+    if (es->sa.sa_handler == SIG_DFL) {
+  8019eb:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8019ef:	48 85 c0             	test   %rax,%rax
+  8019f2:	74 57                	je     801a4b <_generic_signal_handler+0xa2>
+    if (es->sa.sa_handler == SIG_IGN) {
+  8019f4:	48 83 f8 01          	cmp    $0x1,%rax
+  8019f8:	0f 84 c0 00 00 00    	je     801abe <_generic_signal_handler+0x115>
+    if (es->sa.sa_flags & SA_SIGINFO) {
+  8019fe:	f6 43 14 04          	testb  $0x4,0x14(%rbx)
+  801a02:	0f 84 ea 00 00 00    	je     801af2 <_generic_signal_handler+0x149>
+        (es->sa.sa_sigaction)(es->signo, &(es->info), utf);
+  801a08:	48 8d 73 18          	lea    0x18(%rbx),%rsi
+  801a0c:	8b 3b                	mov    (%rbx),%edi
+  801a0e:	4c 89 e2             	mov    %r12,%rdx
+  801a11:	ff d0                	call   *%rax
+
+    _generic_signal_handler_impl(utf, es);
+
+    if (trace_signals)
+        cprintf("signals: env %x: end generic handler for %d\n", sys_getenvid(), es->signo);
+  801a13:	8b 1b                	mov    (%rbx),%ebx
+  801a15:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  801a1c:	00 00 00 
+  801a1f:	ff d0                	call   *%rax
+  801a21:	89 c6                	mov    %eax,%esi
+  801a23:	89 da                	mov    %ebx,%edx
+  801a25:	48 bf 60 32 80 00 00 	movabs $0x803260,%rdi
+  801a2c:	00 00 00 
+  801a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a34:	48 b9 01 1f 80 00 00 	movabs $0x801f01,%rcx
+  801a3b:	00 00 00 
+  801a3e:	ff d1                	call   *%rcx
+}
+  801a40:	48 83 c4 08          	add    $0x8,%rsp
+  801a44:	5b                   	pop    %rbx
+  801a45:	41 5c                	pop    %r12
+  801a47:	41 5d                	pop    %r13
+  801a49:	5d                   	pop    %rbp
+  801a4a:	c3                   	ret
+            cprintf("signals: env %x: exiting due to signal %d\n", sys_getenvid(), es->signo);
+  801a4b:	8b 1b                	mov    (%rbx),%ebx
+  801a4d:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  801a54:	00 00 00 
+  801a57:	ff d0                	call   *%rax
+  801a59:	89 c6                	mov    %eax,%esi
+  801a5b:	89 da                	mov    %ebx,%edx
+  801a5d:	48 bf 08 32 80 00 00 	movabs $0x803208,%rdi
+  801a64:	00 00 00 
+  801a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6c:	48 b9 01 1f 80 00 00 	movabs $0x801f01,%rcx
+  801a73:	00 00 00 
+  801a76:	ff d1                	call   *%rcx
+        sys_env_destroy(CURENVID);
+  801a78:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a7d:	48 b8 79 01 80 00 00 	movabs $0x800179,%rax
+  801a84:	00 00 00 
+  801a87:	ff d0                	call   *%rax
+        assert(false);
+  801a89:	48 b9 8d 32 80 00 00 	movabs $0x80328d,%rcx
+  801a90:	00 00 00 
+  801a93:	48 ba 87 31 80 00 00 	movabs $0x803187,%rdx
+  801a9a:	00 00 00 
+  801a9d:	be 0c 00 00 00       	mov    $0xc,%esi
+  801aa2:	48 bf 93 32 80 00 00 	movabs $0x803293,%rdi
+  801aa9:	00 00 00 
+  801aac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab1:	49 b8 b1 1d 80 00 00 	movabs $0x801db1,%r8
+  801ab8:	00 00 00 
+  801abb:	41 ff d0             	call   *%r8
+            cprintf("signals: env %x: ignoring signal %d\n", sys_getenvid(), es->signo);
+  801abe:	44 8b 23             	mov    (%rbx),%r12d
+  801ac1:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  801ac8:	00 00 00 
+  801acb:	ff d0                	call   *%rax
+  801acd:	89 c6                	mov    %eax,%esi
+  801acf:	44 89 e2             	mov    %r12d,%edx
+  801ad2:	48 bf 38 32 80 00 00 	movabs $0x803238,%rdi
+  801ad9:	00 00 00 
+  801adc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae1:	48 b9 01 1f 80 00 00 	movabs $0x801f01,%rcx
+  801ae8:	00 00 00 
+  801aeb:	ff d1                	call   *%rcx
+        return;
+  801aed:	e9 21 ff ff ff       	jmp    801a13 <_generic_signal_handler+0x6a>
+        (es->sa.sa_handler)(es->signo);
+  801af2:	8b 3b                	mov    (%rbx),%edi
+  801af4:	ff d0                	call   *%rax
+  801af6:	e9 18 ff ff ff       	jmp    801a13 <_generic_signal_handler+0x6a>
+
+0000000000801afb <sigqueue>:
+
+int sigqueue(pid_t pid, int signo, const union sigval value) {
+  801afb:	55                   	push   %rbp
+  801afc:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigqueue(pid, signo, value);
+  801aff:	48 b8 a8 06 80 00 00 	movabs $0x8006a8,%rax
+  801b06:	00 00 00 
+  801b09:	ff d0                	call   *%rax
+}
+  801b0b:	5d                   	pop    %rbp
+  801b0c:	c3                   	ret
+
+0000000000801b0d <sigwait>:
+
+int sigwait(const sigset_t * set, int * sig) {
+  801b0d:	55                   	push   %rbp
+  801b0e:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigwait(set, sig);
+  801b11:	48 b8 0f 07 80 00 00 	movabs $0x80070f,%rax
+  801b18:	00 00 00 
+  801b1b:	ff d0                	call   *%rax
+}
+  801b1d:	5d                   	pop    %rbp
+  801b1e:	c3                   	ret
+
+0000000000801b1f <sigaction>:
+
+extern void _signal_handler_trampoline(void);
+
+int sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801b1f:	55                   	push   %rbp
+  801b20:	48 89 e5             	mov    %rsp,%rbp
+  801b23:	41 55                	push   %r13
+  801b25:	41 54                	push   %r12
+  801b27:	53                   	push   %rbx
+  801b28:	48 83 ec 08          	sub    $0x8,%rsp
+  801b2c:	89 fb                	mov    %edi,%ebx
+  801b2e:	49 89 f4             	mov    %rsi,%r12
+  801b31:	49 89 d5             	mov    %rdx,%r13
+    int err = sys_env_set_pgfault_upcall(CURENVID, _signal_handler_trampoline);
+  801b34:	48 be 46 08 80 00 00 	movabs $0x800846,%rsi
+  801b3b:	00 00 00 
+  801b3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b43:	48 b8 79 05 80 00 00 	movabs $0x800579,%rax
+  801b4a:	00 00 00 
+  801b4d:	ff d0                	call   *%rax
+    if (err)
+  801b4f:	85 c0                	test   %eax,%eax
+  801b51:	74 0b                	je     801b5e <sigaction+0x3f>
+        return err;
+    return sys_sigaction(sig, act, oact);
+}
+  801b53:	48 83 c4 08          	add    $0x8,%rsp
+  801b57:	5b                   	pop    %rbx
+  801b58:	41 5c                	pop    %r12
+  801b5a:	41 5d                	pop    %r13
+  801b5c:	5d                   	pop    %rbp
+  801b5d:	c3                   	ret
+    return sys_sigaction(sig, act, oact);
+  801b5e:	4c 89 ea             	mov    %r13,%rdx
+  801b61:	4c 89 e6             	mov    %r12,%rsi
+  801b64:	89 df                	mov    %ebx,%edi
+  801b66:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  801b6d:	00 00 00 
+  801b70:	ff d0                	call   *%rax
+  801b72:	eb df                	jmp    801b53 <sigaction+0x34>
+
+0000000000801b74 <sigprocmask>:
+
+int sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801b74:	55                   	push   %rbp
+  801b75:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigprocmask(how, set, oldset);
+  801b78:	48 b8 df 07 80 00 00 	movabs $0x8007df,%rax
+  801b7f:	00 00 00 
+  801b82:	ff d0                	call   *%rax
+}
+  801b84:	5d                   	pop    %rbp
+  801b85:	c3                   	ret
+
+0000000000801b86 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  801b86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b8b:	c3                   	ret
+
+0000000000801b8c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  801b8c:	55                   	push   %rbp
+  801b8d:	48 89 e5             	mov    %rsp,%rbp
+  801b90:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  801b93:	48 be a0 32 80 00 00 	movabs $0x8032a0,%rsi
+  801b9a:	00 00 00 
+  801b9d:	48 b8 26 28 80 00 00 	movabs $0x802826,%rax
+  801ba4:	00 00 00 
+  801ba7:	ff d0                	call   *%rax
+    return 0;
+}
+  801ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bae:	5d                   	pop    %rbp
+  801baf:	c3                   	ret
+
+0000000000801bb0 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801bb0:	55                   	push   %rbp
+  801bb1:	48 89 e5             	mov    %rsp,%rbp
+  801bb4:	41 57                	push   %r15
+  801bb6:	41 56                	push   %r14
+  801bb8:	41 55                	push   %r13
+  801bba:	41 54                	push   %r12
+  801bbc:	53                   	push   %rbx
+  801bbd:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801bc4:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801bcb:	48 85 d2             	test   %rdx,%rdx
+  801bce:	74 7a                	je     801c4a <devcons_write+0x9a>
+  801bd0:	49 89 d6             	mov    %rdx,%r14
+  801bd3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801bd9:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801bde:	49 bf 20 2a 80 00 00 	movabs $0x802a20,%r15
+  801be5:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801be8:	4c 89 f3             	mov    %r14,%rbx
+  801beb:	48 29 f3             	sub    %rsi,%rbx
+  801bee:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801bf3:	48 39 c3             	cmp    %rax,%rbx
+  801bf6:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801bfa:	4c 63 eb             	movslq %ebx,%r13
+  801bfd:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801c04:	48 01 c6             	add    %rax,%rsi
+  801c07:	4c 89 ea             	mov    %r13,%rdx
+  801c0a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801c11:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801c14:	4c 89 ee             	mov    %r13,%rsi
+  801c17:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801c1e:	48 b8 1b 01 80 00 00 	movabs $0x80011b,%rax
+  801c25:	00 00 00 
+  801c28:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801c2a:	41 01 dc             	add    %ebx,%r12d
+  801c2d:	49 63 f4             	movslq %r12d,%rsi
+  801c30:	4c 39 f6             	cmp    %r14,%rsi
+  801c33:	72 b3                	jb     801be8 <devcons_write+0x38>
+    return res;
+  801c35:	49 63 c4             	movslq %r12d,%rax
+}
+  801c38:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801c3f:	5b                   	pop    %rbx
+  801c40:	41 5c                	pop    %r12
+  801c42:	41 5d                	pop    %r13
+  801c44:	41 5e                	pop    %r14
+  801c46:	41 5f                	pop    %r15
+  801c48:	5d                   	pop    %rbp
+  801c49:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801c4a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801c50:	eb e3                	jmp    801c35 <devcons_write+0x85>
+
+0000000000801c52 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801c52:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801c55:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c5a:	48 85 c0             	test   %rax,%rax
+  801c5d:	74 55                	je     801cb4 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801c5f:	55                   	push   %rbp
+  801c60:	48 89 e5             	mov    %rsp,%rbp
+  801c63:	41 55                	push   %r13
+  801c65:	41 54                	push   %r12
+  801c67:	53                   	push   %rbx
+  801c68:	48 83 ec 08          	sub    $0x8,%rsp
+  801c6c:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  801c6f:	48 bb 48 01 80 00 00 	movabs $0x800148,%rbx
+  801c76:	00 00 00 
+  801c79:	49 bc 15 02 80 00 00 	movabs $0x800215,%r12
+  801c80:	00 00 00 
+  801c83:	eb 03                	jmp    801c88 <devcons_read+0x36>
+  801c85:	41 ff d4             	call   *%r12
+  801c88:	ff d3                	call   *%rbx
+  801c8a:	85 c0                	test   %eax,%eax
+  801c8c:	74 f7                	je     801c85 <devcons_read+0x33>
+    if (c < 0) return c;
+  801c8e:	48 63 d0             	movslq %eax,%rdx
+  801c91:	78 13                	js     801ca6 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  801c93:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c98:	83 f8 04             	cmp    $0x4,%eax
+  801c9b:	74 09                	je     801ca6 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801c9d:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801ca1:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801ca6:	48 89 d0             	mov    %rdx,%rax
+  801ca9:	48 83 c4 08          	add    $0x8,%rsp
+  801cad:	5b                   	pop    %rbx
+  801cae:	41 5c                	pop    %r12
+  801cb0:	41 5d                	pop    %r13
+  801cb2:	5d                   	pop    %rbp
+  801cb3:	c3                   	ret
+  801cb4:	48 89 d0             	mov    %rdx,%rax
+  801cb7:	c3                   	ret
+
+0000000000801cb8 <cputchar>:
+cputchar(int ch) {
+  801cb8:	55                   	push   %rbp
+  801cb9:	48 89 e5             	mov    %rsp,%rbp
+  801cbc:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801cc0:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801cc4:	be 01 00 00 00       	mov    $0x1,%esi
+  801cc9:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801ccd:	48 b8 1b 01 80 00 00 	movabs $0x80011b,%rax
+  801cd4:	00 00 00 
+  801cd7:	ff d0                	call   *%rax
+}
+  801cd9:	c9                   	leave
+  801cda:	c3                   	ret
+
+0000000000801cdb <getchar>:
+getchar(void) {
+  801cdb:	55                   	push   %rbp
+  801cdc:	48 89 e5             	mov    %rsp,%rbp
+  801cdf:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801ce3:	ba 01 00 00 00       	mov    $0x1,%edx
+  801ce8:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801cec:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cf1:	48 b8 72 0c 80 00 00 	movabs $0x800c72,%rax
+  801cf8:	00 00 00 
+  801cfb:	ff d0                	call   *%rax
+  801cfd:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801cff:	85 c0                	test   %eax,%eax
+  801d01:	78 06                	js     801d09 <getchar+0x2e>
+  801d03:	74 08                	je     801d0d <getchar+0x32>
+  801d05:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801d09:	89 d0                	mov    %edx,%eax
+  801d0b:	c9                   	leave
+  801d0c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801d0d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801d12:	eb f5                	jmp    801d09 <getchar+0x2e>
+
+0000000000801d14 <iscons>:
+iscons(int fdnum) {
+  801d14:	55                   	push   %rbp
+  801d15:	48 89 e5             	mov    %rsp,%rbp
+  801d18:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801d1c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d20:	48 b8 8f 09 80 00 00 	movabs $0x80098f,%rax
+  801d27:	00 00 00 
+  801d2a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d2c:	85 c0                	test   %eax,%eax
+  801d2e:	78 18                	js     801d48 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801d30:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d34:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801d3b:	00 00 00 
+  801d3e:	8b 00                	mov    (%rax),%eax
+  801d40:	39 02                	cmp    %eax,(%rdx)
+  801d42:	0f 94 c0             	sete   %al
+  801d45:	0f b6 c0             	movzbl %al,%eax
+}
+  801d48:	c9                   	leave
+  801d49:	c3                   	ret
+
+0000000000801d4a <opencons>:
+opencons(void) {
+  801d4a:	55                   	push   %rbp
+  801d4b:	48 89 e5             	mov    %rsp,%rbp
+  801d4e:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801d52:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801d56:	48 b8 2f 09 80 00 00 	movabs $0x80092f,%rax
+  801d5d:	00 00 00 
+  801d60:	ff d0                	call   *%rax
+  801d62:	85 c0                	test   %eax,%eax
+  801d64:	78 49                	js     801daf <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801d66:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801d6b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d70:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801d74:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d79:	48 b8 a4 02 80 00 00 	movabs $0x8002a4,%rax
+  801d80:	00 00 00 
+  801d83:	ff d0                	call   *%rax
+  801d85:	85 c0                	test   %eax,%eax
+  801d87:	78 26                	js     801daf <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801d89:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d8d:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801d94:	00 00 
+  801d96:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801d98:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801d9c:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801da3:	48 b8 01 09 80 00 00 	movabs $0x800901,%rax
+  801daa:	00 00 00 
+  801dad:	ff d0                	call   *%rax
+}
+  801daf:	c9                   	leave
+  801db0:	c3                   	ret
+
+0000000000801db1 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801db1:	55                   	push   %rbp
+  801db2:	48 89 e5             	mov    %rsp,%rbp
+  801db5:	41 56                	push   %r14
+  801db7:	41 55                	push   %r13
+  801db9:	41 54                	push   %r12
+  801dbb:	53                   	push   %rbx
+  801dbc:	48 83 ec 50          	sub    $0x50,%rsp
+  801dc0:	49 89 fc             	mov    %rdi,%r12
+  801dc3:	41 89 f5             	mov    %esi,%r13d
+  801dc6:	48 89 d3             	mov    %rdx,%rbx
+  801dc9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801dcd:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801dd1:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801dd5:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801ddc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801de0:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801de4:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801de8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801dec:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801df3:	00 00 00 
+  801df6:	4c 8b 30             	mov    (%rax),%r14
+  801df9:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  801e00:	00 00 00 
+  801e03:	ff d0                	call   *%rax
+  801e05:	89 c6                	mov    %eax,%esi
+  801e07:	45 89 e8             	mov    %r13d,%r8d
+  801e0a:	4c 89 e1             	mov    %r12,%rcx
+  801e0d:	4c 89 f2             	mov    %r14,%rdx
+  801e10:	48 bf b0 32 80 00 00 	movabs $0x8032b0,%rdi
+  801e17:	00 00 00 
+  801e1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1f:	49 bc 01 1f 80 00 00 	movabs $0x801f01,%r12
+  801e26:	00 00 00 
+  801e29:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801e2c:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801e30:	48 89 df             	mov    %rbx,%rdi
+  801e33:	48 b8 9d 1e 80 00 00 	movabs $0x801e9d,%rax
+  801e3a:	00 00 00 
+  801e3d:	ff d0                	call   *%rax
+    cprintf("\n");
+  801e3f:	48 bf 33 31 80 00 00 	movabs $0x803133,%rdi
+  801e46:	00 00 00 
+  801e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4e:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801e51:	cc                   	int3
+  801e52:	eb fd                	jmp    801e51 <_panic+0xa0>
+
+0000000000801e54 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801e54:	55                   	push   %rbp
+  801e55:	48 89 e5             	mov    %rsp,%rbp
+  801e58:	53                   	push   %rbx
+  801e59:	48 83 ec 08          	sub    $0x8,%rsp
+  801e5d:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801e60:	8b 06                	mov    (%rsi),%eax
+  801e62:	8d 50 01             	lea    0x1(%rax),%edx
+  801e65:	89 16                	mov    %edx,(%rsi)
+  801e67:	48 98                	cltq
+  801e69:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801e6e:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801e74:	74 0a                	je     801e80 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801e76:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801e7a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e7e:	c9                   	leave
+  801e7f:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801e80:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801e84:	be ff 00 00 00       	mov    $0xff,%esi
+  801e89:	48 b8 1b 01 80 00 00 	movabs $0x80011b,%rax
+  801e90:	00 00 00 
+  801e93:	ff d0                	call   *%rax
+        state->offset = 0;
+  801e95:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801e9b:	eb d9                	jmp    801e76 <putch+0x22>
+
+0000000000801e9d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801e9d:	55                   	push   %rbp
+  801e9e:	48 89 e5             	mov    %rsp,%rbp
+  801ea1:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801ea8:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801eab:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801eb2:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ebc:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801ebf:	48 89 f1             	mov    %rsi,%rcx
+  801ec2:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801ec9:	48 bf 54 1e 80 00 00 	movabs $0x801e54,%rdi
+  801ed0:	00 00 00 
+  801ed3:	48 b8 51 20 80 00 00 	movabs $0x802051,%rax
+  801eda:	00 00 00 
+  801edd:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801edf:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801ee6:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801eed:	48 b8 1b 01 80 00 00 	movabs $0x80011b,%rax
+  801ef4:	00 00 00 
+  801ef7:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801ef9:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801eff:	c9                   	leave
+  801f00:	c3                   	ret
+
+0000000000801f01 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801f01:	55                   	push   %rbp
+  801f02:	48 89 e5             	mov    %rsp,%rbp
+  801f05:	48 83 ec 50          	sub    $0x50,%rsp
+  801f09:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801f0d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801f11:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f15:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f19:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801f1d:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801f24:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f2c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f30:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801f34:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801f38:	48 b8 9d 1e 80 00 00 	movabs $0x801e9d,%rax
+  801f3f:	00 00 00 
+  801f42:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801f44:	c9                   	leave
+  801f45:	c3                   	ret
+
+0000000000801f46 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801f46:	55                   	push   %rbp
+  801f47:	48 89 e5             	mov    %rsp,%rbp
+  801f4a:	41 57                	push   %r15
+  801f4c:	41 56                	push   %r14
+  801f4e:	41 55                	push   %r13
+  801f50:	41 54                	push   %r12
+  801f52:	53                   	push   %rbx
+  801f53:	48 83 ec 18          	sub    $0x18,%rsp
+  801f57:	49 89 fc             	mov    %rdi,%r12
+  801f5a:	49 89 f5             	mov    %rsi,%r13
+  801f5d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801f61:	8b 45 10             	mov    0x10(%rbp),%eax
+  801f64:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801f67:	41 89 cf             	mov    %ecx,%r15d
+  801f6a:	4c 39 fa             	cmp    %r15,%rdx
+  801f6d:	73 5b                	jae    801fca <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801f6f:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801f73:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801f77:	85 db                	test   %ebx,%ebx
+  801f79:	7e 0e                	jle    801f89 <print_num+0x43>
+            putch(padc, put_arg);
+  801f7b:	4c 89 ee             	mov    %r13,%rsi
+  801f7e:	44 89 f7             	mov    %r14d,%edi
+  801f81:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801f84:	83 eb 01             	sub    $0x1,%ebx
+  801f87:	75 f2                	jne    801f7b <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801f89:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801f8d:	48 b9 e4 32 80 00 00 	movabs $0x8032e4,%rcx
+  801f94:	00 00 00 
+  801f97:	48 b8 d3 32 80 00 00 	movabs $0x8032d3,%rax
+  801f9e:	00 00 00 
+  801fa1:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801fa5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fa9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fae:	49 f7 f7             	div    %r15
+  801fb1:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801fb5:	4c 89 ee             	mov    %r13,%rsi
+  801fb8:	41 ff d4             	call   *%r12
+}
+  801fbb:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801fbf:	5b                   	pop    %rbx
+  801fc0:	41 5c                	pop    %r12
+  801fc2:	41 5d                	pop    %r13
+  801fc4:	41 5e                	pop    %r14
+  801fc6:	41 5f                	pop    %r15
+  801fc8:	5d                   	pop    %rbp
+  801fc9:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801fca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fce:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd3:	49 f7 f7             	div    %r15
+  801fd6:	48 83 ec 08          	sub    $0x8,%rsp
+  801fda:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801fde:	52                   	push   %rdx
+  801fdf:	45 0f be c9          	movsbl %r9b,%r9d
+  801fe3:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801fe7:	48 89 c2             	mov    %rax,%rdx
+  801fea:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  801ff1:	00 00 00 
+  801ff4:	ff d0                	call   *%rax
+  801ff6:	48 83 c4 10          	add    $0x10,%rsp
+  801ffa:	eb 8d                	jmp    801f89 <print_num+0x43>
+
+0000000000801ffc <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801ffc:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802000:	48 8b 06             	mov    (%rsi),%rax
+  802003:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802007:	73 0a                	jae    802013 <sprintputch+0x17>
+        *state->start++ = ch;
+  802009:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80200d:	48 89 16             	mov    %rdx,(%rsi)
+  802010:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  802013:	c3                   	ret
+
+0000000000802014 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  802014:	55                   	push   %rbp
+  802015:	48 89 e5             	mov    %rsp,%rbp
+  802018:	48 83 ec 50          	sub    $0x50,%rsp
+  80201c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802020:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802024:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802028:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80202f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802033:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802037:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80203b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80203f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802043:	48 b8 51 20 80 00 00 	movabs $0x802051,%rax
+  80204a:	00 00 00 
+  80204d:	ff d0                	call   *%rax
+}
+  80204f:	c9                   	leave
+  802050:	c3                   	ret
+
+0000000000802051 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802051:	55                   	push   %rbp
+  802052:	48 89 e5             	mov    %rsp,%rbp
+  802055:	41 57                	push   %r15
+  802057:	41 56                	push   %r14
+  802059:	41 55                	push   %r13
+  80205b:	41 54                	push   %r12
+  80205d:	53                   	push   %rbx
+  80205e:	48 83 ec 38          	sub    $0x38,%rsp
+  802062:	49 89 fe             	mov    %rdi,%r14
+  802065:	49 89 f5             	mov    %rsi,%r13
+  802068:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80206b:	48 8b 01             	mov    (%rcx),%rax
+  80206e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802072:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802076:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80207a:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80207e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  802082:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802086:	0f b6 3b             	movzbl (%rbx),%edi
+  802089:	40 80 ff 25          	cmp    $0x25,%dil
+  80208d:	74 18                	je     8020a7 <vprintfmt+0x56>
+            if (!ch) return;
+  80208f:	40 84 ff             	test   %dil,%dil
+  802092:	0f 84 b1 06 00 00    	je     802749 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802098:	40 0f b6 ff          	movzbl %dil,%edi
+  80209c:	4c 89 ee             	mov    %r13,%rsi
+  80209f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8020a2:	4c 89 e3             	mov    %r12,%rbx
+  8020a5:	eb db                	jmp    802082 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8020a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ac:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8020b0:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8020b5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8020bb:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8020c2:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8020c6:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8020cb:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8020d0:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8020d3:	83 e8 23             	sub    $0x23,%eax
+  8020d6:	3c 57                	cmp    $0x57,%al
+  8020d8:	0f 87 51 06 00 00    	ja     80272f <vprintfmt+0x6de>
+  8020de:	0f b6 c0             	movzbl %al,%eax
+  8020e1:	48 b9 80 34 80 00 00 	movabs $0x803480,%rcx
+  8020e8:	00 00 00 
+  8020eb:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8020ee:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8020f1:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8020f5:	eb cf                	jmp    8020c6 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8020f7:	49 89 dc             	mov    %rbx,%r12
+  8020fa:	be 01 00 00 00       	mov    $0x1,%esi
+  8020ff:	eb c5                	jmp    8020c6 <vprintfmt+0x75>
+            padc = ch;
+  802101:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  802105:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802108:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80210b:	eb b9                	jmp    8020c6 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80210d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802110:	83 f8 2f             	cmp    $0x2f,%eax
+  802113:	77 24                	ja     802139 <vprintfmt+0xe8>
+  802115:	89 c1                	mov    %eax,%ecx
+  802117:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80211b:	83 c0 08             	add    $0x8,%eax
+  80211e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802121:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802124:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802127:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80212b:	79 99                	jns    8020c6 <vprintfmt+0x75>
+                width = precision;
+  80212d:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802131:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802137:	eb 8d                	jmp    8020c6 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802139:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80213d:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802141:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802145:	eb da                	jmp    802121 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802147:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80214c:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802150:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802156:	3c 39                	cmp    $0x39,%al
+  802158:	77 1c                	ja     802176 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80215a:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80215e:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802162:	0f b6 c0             	movzbl %al,%eax
+  802165:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80216a:	0f b6 03             	movzbl (%rbx),%eax
+  80216d:	3c 39                	cmp    $0x39,%al
+  80216f:	76 e9                	jbe    80215a <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802171:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802174:	eb b1                	jmp    802127 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802176:	49 89 dc             	mov    %rbx,%r12
+  802179:	eb ac                	jmp    802127 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80217b:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80217e:	85 c9                	test   %ecx,%ecx
+  802180:	b8 00 00 00 00       	mov    $0x0,%eax
+  802185:	0f 49 c1             	cmovns %ecx,%eax
+  802188:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80218b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80218e:	e9 33 ff ff ff       	jmp    8020c6 <vprintfmt+0x75>
+            lflag++;
+  802193:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802196:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802199:	e9 28 ff ff ff       	jmp    8020c6 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80219e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8021a4:	77 19                	ja     8021bf <vprintfmt+0x16e>
+  8021a6:	89 c2                	mov    %eax,%edx
+  8021a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021ac:	83 c0 08             	add    $0x8,%eax
+  8021af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021b2:	8b 3a                	mov    (%rdx),%edi
+  8021b4:	4c 89 ee             	mov    %r13,%rsi
+  8021b7:	41 ff d6             	call   *%r14
+            break;
+  8021ba:	e9 c3 fe ff ff       	jmp    802082 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8021bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021cb:	eb e5                	jmp    8021b2 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8021cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8021d3:	77 5a                	ja     80222f <vprintfmt+0x1de>
+  8021d5:	89 c2                	mov    %eax,%edx
+  8021d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021db:	83 c0 08             	add    $0x8,%eax
+  8021de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8021e1:	8b 02                	mov    (%rdx),%eax
+  8021e3:	89 c1                	mov    %eax,%ecx
+  8021e5:	f7 d9                	neg    %ecx
+  8021e7:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8021ea:	83 f9 15             	cmp    $0x15,%ecx
+  8021ed:	7f 4e                	jg     80223d <vprintfmt+0x1ec>
+  8021ef:	48 63 c1             	movslq %ecx,%rax
+  8021f2:	48 ba 40 37 80 00 00 	movabs $0x803740,%rdx
+  8021f9:	00 00 00 
+  8021fc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802200:	48 85 c0             	test   %rax,%rax
+  802203:	74 38                	je     80223d <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802205:	48 89 c1             	mov    %rax,%rcx
+  802208:	48 ba 99 31 80 00 00 	movabs $0x803199,%rdx
+  80220f:	00 00 00 
+  802212:	4c 89 ee             	mov    %r13,%rsi
+  802215:	4c 89 f7             	mov    %r14,%rdi
+  802218:	b8 00 00 00 00       	mov    $0x0,%eax
+  80221d:	49 b8 14 20 80 00 00 	movabs $0x802014,%r8
+  802224:	00 00 00 
+  802227:	41 ff d0             	call   *%r8
+  80222a:	e9 53 fe ff ff       	jmp    802082 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80222f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802233:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802237:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80223b:	eb a4                	jmp    8021e1 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80223d:	48 ba fc 32 80 00 00 	movabs $0x8032fc,%rdx
+  802244:	00 00 00 
+  802247:	4c 89 ee             	mov    %r13,%rsi
+  80224a:	4c 89 f7             	mov    %r14,%rdi
+  80224d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802252:	49 b8 14 20 80 00 00 	movabs $0x802014,%r8
+  802259:	00 00 00 
+  80225c:	41 ff d0             	call   *%r8
+  80225f:	e9 1e fe ff ff       	jmp    802082 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802264:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802267:	83 f8 2f             	cmp    $0x2f,%eax
+  80226a:	77 6c                	ja     8022d8 <vprintfmt+0x287>
+  80226c:	89 c2                	mov    %eax,%edx
+  80226e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802272:	83 c0 08             	add    $0x8,%eax
+  802275:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802278:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80227b:	48 85 d2             	test   %rdx,%rdx
+  80227e:	48 b8 f5 32 80 00 00 	movabs $0x8032f5,%rax
+  802285:	00 00 00 
+  802288:	48 0f 45 c2          	cmovne %rdx,%rax
+  80228c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  802290:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802294:	7e 06                	jle    80229c <vprintfmt+0x24b>
+  802296:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80229a:	75 4a                	jne    8022e6 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80229c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8022a0:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8022a4:	0f b6 00             	movzbl (%rax),%eax
+  8022a7:	84 c0                	test   %al,%al
+  8022a9:	0f 85 9a 00 00 00    	jne    802349 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8022af:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8022b2:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8022b6:	85 c0                	test   %eax,%eax
+  8022b8:	0f 8e c4 fd ff ff    	jle    802082 <vprintfmt+0x31>
+  8022be:	4c 89 ee             	mov    %r13,%rsi
+  8022c1:	bf 20 00 00 00       	mov    $0x20,%edi
+  8022c6:	41 ff d6             	call   *%r14
+  8022c9:	41 83 ec 01          	sub    $0x1,%r12d
+  8022cd:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8022d1:	75 eb                	jne    8022be <vprintfmt+0x26d>
+  8022d3:	e9 aa fd ff ff       	jmp    802082 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8022d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022e4:	eb 92                	jmp    802278 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8022e6:	49 63 f7             	movslq %r15d,%rsi
+  8022e9:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8022ed:	48 b8 03 28 80 00 00 	movabs $0x802803,%rax
+  8022f4:	00 00 00 
+  8022f7:	ff d0                	call   *%rax
+  8022f9:	48 89 c2             	mov    %rax,%rdx
+  8022fc:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8022ff:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802301:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802304:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802307:	85 c0                	test   %eax,%eax
+  802309:	7e 91                	jle    80229c <vprintfmt+0x24b>
+  80230b:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802310:	4c 89 ee             	mov    %r13,%rsi
+  802313:	44 89 e7             	mov    %r12d,%edi
+  802316:	41 ff d6             	call   *%r14
+  802319:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80231d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802320:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802323:	75 eb                	jne    802310 <vprintfmt+0x2bf>
+  802325:	e9 72 ff ff ff       	jmp    80229c <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80232a:	0f b6 f8             	movzbl %al,%edi
+  80232d:	4c 89 ee             	mov    %r13,%rsi
+  802330:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802333:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802337:	49 83 c4 01          	add    $0x1,%r12
+  80233b:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802341:	84 c0                	test   %al,%al
+  802343:	0f 84 66 ff ff ff    	je     8022af <vprintfmt+0x25e>
+  802349:	45 85 ff             	test   %r15d,%r15d
+  80234c:	78 0a                	js     802358 <vprintfmt+0x307>
+  80234e:	41 83 ef 01          	sub    $0x1,%r15d
+  802352:	0f 88 57 ff ff ff    	js     8022af <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802358:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80235c:	74 cc                	je     80232a <vprintfmt+0x2d9>
+  80235e:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802361:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802366:	80 fa 5e             	cmp    $0x5e,%dl
+  802369:	77 c2                	ja     80232d <vprintfmt+0x2dc>
+  80236b:	eb bd                	jmp    80232a <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80236d:	40 84 f6             	test   %sil,%sil
+  802370:	75 26                	jne    802398 <vprintfmt+0x347>
+    switch (lflag) {
+  802372:	85 d2                	test   %edx,%edx
+  802374:	74 59                	je     8023cf <vprintfmt+0x37e>
+  802376:	83 fa 01             	cmp    $0x1,%edx
+  802379:	74 7b                	je     8023f6 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80237b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80237e:	83 f8 2f             	cmp    $0x2f,%eax
+  802381:	0f 87 96 00 00 00    	ja     80241d <vprintfmt+0x3cc>
+  802387:	89 c2                	mov    %eax,%edx
+  802389:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80238d:	83 c0 08             	add    $0x8,%eax
+  802390:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802393:	4c 8b 22             	mov    (%rdx),%r12
+  802396:	eb 17                	jmp    8023af <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802398:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80239b:	83 f8 2f             	cmp    $0x2f,%eax
+  80239e:	77 21                	ja     8023c1 <vprintfmt+0x370>
+  8023a0:	89 c2                	mov    %eax,%edx
+  8023a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023a6:	83 c0 08             	add    $0x8,%eax
+  8023a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023ac:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8023af:	4d 85 e4             	test   %r12,%r12
+  8023b2:	78 7a                	js     80242e <vprintfmt+0x3dd>
+            num = i;
+  8023b4:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8023b7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8023bc:	e9 50 02 00 00       	jmp    802611 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023cd:	eb dd                	jmp    8023ac <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8023cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8023d5:	77 11                	ja     8023e8 <vprintfmt+0x397>
+  8023d7:	89 c2                	mov    %eax,%edx
+  8023d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023dd:	83 c0 08             	add    $0x8,%eax
+  8023e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023e3:	4c 63 22             	movslq (%rdx),%r12
+  8023e6:	eb c7                	jmp    8023af <vprintfmt+0x35e>
+  8023e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023f4:	eb ed                	jmp    8023e3 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8023f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8023fc:	77 11                	ja     80240f <vprintfmt+0x3be>
+  8023fe:	89 c2                	mov    %eax,%edx
+  802400:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802404:	83 c0 08             	add    $0x8,%eax
+  802407:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80240a:	4c 8b 22             	mov    (%rdx),%r12
+  80240d:	eb a0                	jmp    8023af <vprintfmt+0x35e>
+  80240f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802413:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802417:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80241b:	eb ed                	jmp    80240a <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80241d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802421:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802425:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802429:	e9 65 ff ff ff       	jmp    802393 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80242e:	4c 89 ee             	mov    %r13,%rsi
+  802431:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802436:	41 ff d6             	call   *%r14
+                i = -i;
+  802439:	49 f7 dc             	neg    %r12
+  80243c:	e9 73 ff ff ff       	jmp    8023b4 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802441:	40 84 f6             	test   %sil,%sil
+  802444:	75 32                	jne    802478 <vprintfmt+0x427>
+    switch (lflag) {
+  802446:	85 d2                	test   %edx,%edx
+  802448:	74 5d                	je     8024a7 <vprintfmt+0x456>
+  80244a:	83 fa 01             	cmp    $0x1,%edx
+  80244d:	0f 84 82 00 00 00    	je     8024d5 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802453:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802456:	83 f8 2f             	cmp    $0x2f,%eax
+  802459:	0f 87 a5 00 00 00    	ja     802504 <vprintfmt+0x4b3>
+  80245f:	89 c2                	mov    %eax,%edx
+  802461:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802465:	83 c0 08             	add    $0x8,%eax
+  802468:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80246b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80246e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802473:	e9 99 01 00 00       	jmp    802611 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802478:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80247b:	83 f8 2f             	cmp    $0x2f,%eax
+  80247e:	77 19                	ja     802499 <vprintfmt+0x448>
+  802480:	89 c2                	mov    %eax,%edx
+  802482:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802486:	83 c0 08             	add    $0x8,%eax
+  802489:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80248c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80248f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802494:	e9 78 01 00 00       	jmp    802611 <vprintfmt+0x5c0>
+  802499:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80249d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024a5:	eb e5                	jmp    80248c <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8024a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8024ad:	77 18                	ja     8024c7 <vprintfmt+0x476>
+  8024af:	89 c2                	mov    %eax,%edx
+  8024b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024b5:	83 c0 08             	add    $0x8,%eax
+  8024b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024bb:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8024bd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8024c2:	e9 4a 01 00 00       	jmp    802611 <vprintfmt+0x5c0>
+  8024c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024d3:	eb e6                	jmp    8024bb <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8024d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8024db:	77 19                	ja     8024f6 <vprintfmt+0x4a5>
+  8024dd:	89 c2                	mov    %eax,%edx
+  8024df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024e3:	83 c0 08             	add    $0x8,%eax
+  8024e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024e9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8024ec:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8024f1:	e9 1b 01 00 00       	jmp    802611 <vprintfmt+0x5c0>
+  8024f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802502:	eb e5                	jmp    8024e9 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802504:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802508:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80250c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802510:	e9 56 ff ff ff       	jmp    80246b <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802515:	40 84 f6             	test   %sil,%sil
+  802518:	75 2e                	jne    802548 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80251a:	85 d2                	test   %edx,%edx
+  80251c:	74 59                	je     802577 <vprintfmt+0x526>
+  80251e:	83 fa 01             	cmp    $0x1,%edx
+  802521:	74 7f                	je     8025a2 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802523:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802526:	83 f8 2f             	cmp    $0x2f,%eax
+  802529:	0f 87 9f 00 00 00    	ja     8025ce <vprintfmt+0x57d>
+  80252f:	89 c2                	mov    %eax,%edx
+  802531:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802535:	83 c0 08             	add    $0x8,%eax
+  802538:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80253b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80253e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802543:	e9 c9 00 00 00       	jmp    802611 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802548:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80254b:	83 f8 2f             	cmp    $0x2f,%eax
+  80254e:	77 19                	ja     802569 <vprintfmt+0x518>
+  802550:	89 c2                	mov    %eax,%edx
+  802552:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802556:	83 c0 08             	add    $0x8,%eax
+  802559:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80255c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80255f:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802564:	e9 a8 00 00 00       	jmp    802611 <vprintfmt+0x5c0>
+  802569:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80256d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802571:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802575:	eb e5                	jmp    80255c <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802577:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80257a:	83 f8 2f             	cmp    $0x2f,%eax
+  80257d:	77 15                	ja     802594 <vprintfmt+0x543>
+  80257f:	89 c2                	mov    %eax,%edx
+  802581:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802585:	83 c0 08             	add    $0x8,%eax
+  802588:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80258b:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80258d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802592:	eb 7d                	jmp    802611 <vprintfmt+0x5c0>
+  802594:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802598:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80259c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025a0:	eb e9                	jmp    80258b <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8025a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8025a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8025a8:	77 16                	ja     8025c0 <vprintfmt+0x56f>
+  8025aa:	89 c2                	mov    %eax,%edx
+  8025ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8025b0:	83 c0 08             	add    $0x8,%eax
+  8025b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8025b6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8025b9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8025be:	eb 51                	jmp    802611 <vprintfmt+0x5c0>
+  8025c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8025c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8025c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025cc:	eb e8                	jmp    8025b6 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8025ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8025d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8025d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025da:	e9 5c ff ff ff       	jmp    80253b <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8025df:	4c 89 ee             	mov    %r13,%rsi
+  8025e2:	bf 30 00 00 00       	mov    $0x30,%edi
+  8025e7:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8025ea:	4c 89 ee             	mov    %r13,%rsi
+  8025ed:	bf 78 00 00 00       	mov    $0x78,%edi
+  8025f2:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8025f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8025f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8025fb:	77 47                	ja     802644 <vprintfmt+0x5f3>
+  8025fd:	89 c2                	mov    %eax,%edx
+  8025ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802603:	83 c0 08             	add    $0x8,%eax
+  802606:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802609:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80260c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802611:	48 83 ec 08          	sub    $0x8,%rsp
+  802615:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802619:	0f 94 c0             	sete   %al
+  80261c:	0f b6 c0             	movzbl %al,%eax
+  80261f:	50                   	push   %rax
+  802620:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802625:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802629:	4c 89 ee             	mov    %r13,%rsi
+  80262c:	4c 89 f7             	mov    %r14,%rdi
+  80262f:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  802636:	00 00 00 
+  802639:	ff d0                	call   *%rax
+            break;
+  80263b:	48 83 c4 10          	add    $0x10,%rsp
+  80263f:	e9 3e fa ff ff       	jmp    802082 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802644:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802648:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80264c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802650:	eb b7                	jmp    802609 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802652:	40 84 f6             	test   %sil,%sil
+  802655:	75 2b                	jne    802682 <vprintfmt+0x631>
+    switch (lflag) {
+  802657:	85 d2                	test   %edx,%edx
+  802659:	74 56                	je     8026b1 <vprintfmt+0x660>
+  80265b:	83 fa 01             	cmp    $0x1,%edx
+  80265e:	74 7f                	je     8026df <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  802660:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802663:	83 f8 2f             	cmp    $0x2f,%eax
+  802666:	0f 87 a2 00 00 00    	ja     80270e <vprintfmt+0x6bd>
+  80266c:	89 c2                	mov    %eax,%edx
+  80266e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802672:	83 c0 08             	add    $0x8,%eax
+  802675:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802678:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80267b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802680:	eb 8f                	jmp    802611 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802682:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802685:	83 f8 2f             	cmp    $0x2f,%eax
+  802688:	77 19                	ja     8026a3 <vprintfmt+0x652>
+  80268a:	89 c2                	mov    %eax,%edx
+  80268c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802690:	83 c0 08             	add    $0x8,%eax
+  802693:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802696:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802699:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80269e:	e9 6e ff ff ff       	jmp    802611 <vprintfmt+0x5c0>
+  8026a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8026a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8026ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026af:	eb e5                	jmp    802696 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8026b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8026b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8026b7:	77 18                	ja     8026d1 <vprintfmt+0x680>
+  8026b9:	89 c2                	mov    %eax,%edx
+  8026bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8026bf:	83 c0 08             	add    $0x8,%eax
+  8026c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8026c5:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8026c7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8026cc:	e9 40 ff ff ff       	jmp    802611 <vprintfmt+0x5c0>
+  8026d1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8026d5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8026d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026dd:	eb e6                	jmp    8026c5 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8026df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8026e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8026e5:	77 19                	ja     802700 <vprintfmt+0x6af>
+  8026e7:	89 c2                	mov    %eax,%edx
+  8026e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8026ed:	83 c0 08             	add    $0x8,%eax
+  8026f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8026f3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8026f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8026fb:	e9 11 ff ff ff       	jmp    802611 <vprintfmt+0x5c0>
+  802700:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802704:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802708:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80270c:	eb e5                	jmp    8026f3 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80270e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802712:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802716:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80271a:	e9 59 ff ff ff       	jmp    802678 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80271f:	4c 89 ee             	mov    %r13,%rsi
+  802722:	bf 25 00 00 00       	mov    $0x25,%edi
+  802727:	41 ff d6             	call   *%r14
+            break;
+  80272a:	e9 53 f9 ff ff       	jmp    802082 <vprintfmt+0x31>
+            putch('%', put_arg);
+  80272f:	4c 89 ee             	mov    %r13,%rsi
+  802732:	bf 25 00 00 00       	mov    $0x25,%edi
+  802737:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80273a:	48 83 eb 01          	sub    $0x1,%rbx
+  80273e:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802742:	75 f6                	jne    80273a <vprintfmt+0x6e9>
+  802744:	e9 39 f9 ff ff       	jmp    802082 <vprintfmt+0x31>
+}
+  802749:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80274d:	5b                   	pop    %rbx
+  80274e:	41 5c                	pop    %r12
+  802750:	41 5d                	pop    %r13
+  802752:	41 5e                	pop    %r14
+  802754:	41 5f                	pop    %r15
+  802756:	5d                   	pop    %rbp
+  802757:	c3                   	ret
+
+0000000000802758 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802758:	55                   	push   %rbp
+  802759:	48 89 e5             	mov    %rsp,%rbp
+  80275c:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802760:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802764:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802769:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80276d:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802774:	48 85 ff             	test   %rdi,%rdi
+  802777:	74 2b                	je     8027a4 <vsnprintf+0x4c>
+  802779:	48 85 f6             	test   %rsi,%rsi
+  80277c:	74 26                	je     8027a4 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80277e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802782:	48 bf fc 1f 80 00 00 	movabs $0x801ffc,%rdi
+  802789:	00 00 00 
+  80278c:	48 b8 51 20 80 00 00 	movabs $0x802051,%rax
+  802793:	00 00 00 
+  802796:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802798:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80279c:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80279f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8027a2:	c9                   	leave
+  8027a3:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8027a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027a9:	eb f7                	jmp    8027a2 <vsnprintf+0x4a>
+
+00000000008027ab <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8027ab:	55                   	push   %rbp
+  8027ac:	48 89 e5             	mov    %rsp,%rbp
+  8027af:	48 83 ec 50          	sub    $0x50,%rsp
+  8027b3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8027b7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8027bb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8027bf:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8027c6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8027ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027ce:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8027d2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8027d6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8027da:	48 b8 58 27 80 00 00 	movabs $0x802758,%rax
+  8027e1:	00 00 00 
+  8027e4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8027e6:	c9                   	leave
+  8027e7:	c3                   	ret
+
+00000000008027e8 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8027e8:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8027eb:	74 10                	je     8027fd <strlen+0x15>
+    size_t n = 0;
+  8027ed:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8027f2:	48 83 c0 01          	add    $0x1,%rax
+  8027f6:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8027fa:	75 f6                	jne    8027f2 <strlen+0xa>
+  8027fc:	c3                   	ret
+    size_t n = 0;
+  8027fd:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802802:	c3                   	ret
+
+0000000000802803 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802803:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802806:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80280b:	48 85 f6             	test   %rsi,%rsi
+  80280e:	74 11                	je     802821 <strnlen+0x1e>
+  802810:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802814:	74 0c                	je     802822 <strnlen+0x1f>
+  802816:	48 83 c2 01          	add    $0x1,%rdx
+  80281a:	48 39 d0             	cmp    %rdx,%rax
+  80281d:	75 f1                	jne    802810 <strnlen+0xd>
+  80281f:	eb 04                	jmp    802825 <strnlen+0x22>
+  802821:	c3                   	ret
+  802822:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802825:	c3                   	ret
+
+0000000000802826 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802826:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802829:	ba 00 00 00 00       	mov    $0x0,%edx
+  80282e:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802832:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802835:	48 83 c2 01          	add    $0x1,%rdx
+  802839:	84 c9                	test   %cl,%cl
+  80283b:	75 f1                	jne    80282e <strcpy+0x8>
+        ;
+    return res;
+}
+  80283d:	c3                   	ret
+
+000000000080283e <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80283e:	55                   	push   %rbp
+  80283f:	48 89 e5             	mov    %rsp,%rbp
+  802842:	41 54                	push   %r12
+  802844:	53                   	push   %rbx
+  802845:	48 89 fb             	mov    %rdi,%rbx
+  802848:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80284b:	48 b8 e8 27 80 00 00 	movabs $0x8027e8,%rax
+  802852:	00 00 00 
+  802855:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802857:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80285b:	4c 89 e6             	mov    %r12,%rsi
+  80285e:	48 b8 26 28 80 00 00 	movabs $0x802826,%rax
+  802865:	00 00 00 
+  802868:	ff d0                	call   *%rax
+    return dst;
+}
+  80286a:	48 89 d8             	mov    %rbx,%rax
+  80286d:	5b                   	pop    %rbx
+  80286e:	41 5c                	pop    %r12
+  802870:	5d                   	pop    %rbp
+  802871:	c3                   	ret
+
+0000000000802872 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802872:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802875:	48 85 d2             	test   %rdx,%rdx
+  802878:	74 1f                	je     802899 <strncpy+0x27>
+  80287a:	48 01 fa             	add    %rdi,%rdx
+  80287d:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802880:	48 83 c1 01          	add    $0x1,%rcx
+  802884:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802888:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80288c:	41 80 f8 01          	cmp    $0x1,%r8b
+  802890:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802894:	48 39 ca             	cmp    %rcx,%rdx
+  802897:	75 e7                	jne    802880 <strncpy+0xe>
+    }
+    return ret;
+}
+  802899:	c3                   	ret
+
+000000000080289a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80289a:	48 89 f8             	mov    %rdi,%rax
+  80289d:	48 85 d2             	test   %rdx,%rdx
+  8028a0:	74 24                	je     8028c6 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8028a2:	48 83 ea 01          	sub    $0x1,%rdx
+  8028a6:	74 1b                	je     8028c3 <strlcpy+0x29>
+  8028a8:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8028ac:	0f b6 16             	movzbl (%rsi),%edx
+  8028af:	84 d2                	test   %dl,%dl
+  8028b1:	74 10                	je     8028c3 <strlcpy+0x29>
+            *dst++ = *src++;
+  8028b3:	48 83 c6 01          	add    $0x1,%rsi
+  8028b7:	48 83 c0 01          	add    $0x1,%rax
+  8028bb:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8028be:	48 39 c8             	cmp    %rcx,%rax
+  8028c1:	75 e9                	jne    8028ac <strlcpy+0x12>
+        *dst = '\0';
+  8028c3:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8028c6:	48 29 f8             	sub    %rdi,%rax
+}
+  8028c9:	c3                   	ret
+
+00000000008028ca <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8028ca:	0f b6 07             	movzbl (%rdi),%eax
+  8028cd:	84 c0                	test   %al,%al
+  8028cf:	74 13                	je     8028e4 <strcmp+0x1a>
+  8028d1:	38 06                	cmp    %al,(%rsi)
+  8028d3:	75 0f                	jne    8028e4 <strcmp+0x1a>
+  8028d5:	48 83 c7 01          	add    $0x1,%rdi
+  8028d9:	48 83 c6 01          	add    $0x1,%rsi
+  8028dd:	0f b6 07             	movzbl (%rdi),%eax
+  8028e0:	84 c0                	test   %al,%al
+  8028e2:	75 ed                	jne    8028d1 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8028e4:	0f b6 c0             	movzbl %al,%eax
+  8028e7:	0f b6 16             	movzbl (%rsi),%edx
+  8028ea:	29 d0                	sub    %edx,%eax
+}
+  8028ec:	c3                   	ret
+
+00000000008028ed <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8028ed:	48 85 d2             	test   %rdx,%rdx
+  8028f0:	74 1f                	je     802911 <strncmp+0x24>
+  8028f2:	0f b6 07             	movzbl (%rdi),%eax
+  8028f5:	84 c0                	test   %al,%al
+  8028f7:	74 1e                	je     802917 <strncmp+0x2a>
+  8028f9:	3a 06                	cmp    (%rsi),%al
+  8028fb:	75 1a                	jne    802917 <strncmp+0x2a>
+  8028fd:	48 83 c7 01          	add    $0x1,%rdi
+  802901:	48 83 c6 01          	add    $0x1,%rsi
+  802905:	48 83 ea 01          	sub    $0x1,%rdx
+  802909:	75 e7                	jne    8028f2 <strncmp+0x5>
+
+    if (!n) return 0;
+  80290b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802910:	c3                   	ret
+  802911:	b8 00 00 00 00       	mov    $0x0,%eax
+  802916:	c3                   	ret
+  802917:	48 85 d2             	test   %rdx,%rdx
+  80291a:	74 09                	je     802925 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80291c:	0f b6 07             	movzbl (%rdi),%eax
+  80291f:	0f b6 16             	movzbl (%rsi),%edx
+  802922:	29 d0                	sub    %edx,%eax
+  802924:	c3                   	ret
+    if (!n) return 0;
+  802925:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80292a:	c3                   	ret
+
+000000000080292b <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80292b:	0f b6 17             	movzbl (%rdi),%edx
+  80292e:	84 d2                	test   %dl,%dl
+  802930:	74 18                	je     80294a <strchr+0x1f>
+        if (*str == c) {
+  802932:	0f be d2             	movsbl %dl,%edx
+  802935:	39 f2                	cmp    %esi,%edx
+  802937:	74 17                	je     802950 <strchr+0x25>
+    for (; *str; str++) {
+  802939:	48 83 c7 01          	add    $0x1,%rdi
+  80293d:	0f b6 17             	movzbl (%rdi),%edx
+  802940:	84 d2                	test   %dl,%dl
+  802942:	75 ee                	jne    802932 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802944:	b8 00 00 00 00       	mov    $0x0,%eax
+  802949:	c3                   	ret
+  80294a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294f:	c3                   	ret
+  802950:	48 89 f8             	mov    %rdi,%rax
+}
+  802953:	c3                   	ret
+
+0000000000802954 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802954:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802957:	0f b6 17             	movzbl (%rdi),%edx
+  80295a:	84 d2                	test   %dl,%dl
+  80295c:	74 13                	je     802971 <strfind+0x1d>
+  80295e:	0f be d2             	movsbl %dl,%edx
+  802961:	39 f2                	cmp    %esi,%edx
+  802963:	74 0b                	je     802970 <strfind+0x1c>
+  802965:	48 83 c0 01          	add    $0x1,%rax
+  802969:	0f b6 10             	movzbl (%rax),%edx
+  80296c:	84 d2                	test   %dl,%dl
+  80296e:	75 ee                	jne    80295e <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802970:	c3                   	ret
+  802971:	c3                   	ret
+
+0000000000802972 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802972:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802975:	48 89 f8             	mov    %rdi,%rax
+  802978:	48 f7 d8             	neg    %rax
+  80297b:	83 e0 07             	and    $0x7,%eax
+  80297e:	49 89 d1             	mov    %rdx,%r9
+  802981:	49 29 c1             	sub    %rax,%r9
+  802984:	78 36                	js     8029bc <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802986:	40 0f b6 c6          	movzbl %sil,%eax
+  80298a:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802991:	01 01 01 
+  802994:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802998:	40 f6 c7 07          	test   $0x7,%dil
+  80299c:	75 38                	jne    8029d6 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80299e:	4c 89 c9             	mov    %r9,%rcx
+  8029a1:	48 c1 f9 03          	sar    $0x3,%rcx
+  8029a5:	74 0c                	je     8029b3 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8029a7:	fc                   	cld
+  8029a8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8029ab:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8029af:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8029b3:	4d 85 c9             	test   %r9,%r9
+  8029b6:	75 45                	jne    8029fd <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8029b8:	4c 89 c0             	mov    %r8,%rax
+  8029bb:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8029bc:	48 85 d2             	test   %rdx,%rdx
+  8029bf:	74 f7                	je     8029b8 <memset+0x46>
+  8029c1:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8029c4:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8029c7:	48 83 c0 01          	add    $0x1,%rax
+  8029cb:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8029cf:	48 39 c2             	cmp    %rax,%rdx
+  8029d2:	75 f3                	jne    8029c7 <memset+0x55>
+  8029d4:	eb e2                	jmp    8029b8 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8029d6:	40 f6 c7 01          	test   $0x1,%dil
+  8029da:	74 06                	je     8029e2 <memset+0x70>
+  8029dc:	88 07                	mov    %al,(%rdi)
+  8029de:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8029e2:	40 f6 c7 02          	test   $0x2,%dil
+  8029e6:	74 07                	je     8029ef <memset+0x7d>
+  8029e8:	66 89 07             	mov    %ax,(%rdi)
+  8029eb:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8029ef:	40 f6 c7 04          	test   $0x4,%dil
+  8029f3:	74 a9                	je     80299e <memset+0x2c>
+  8029f5:	89 07                	mov    %eax,(%rdi)
+  8029f7:	48 83 c7 04          	add    $0x4,%rdi
+  8029fb:	eb a1                	jmp    80299e <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8029fd:	41 f6 c1 04          	test   $0x4,%r9b
+  802a01:	74 06                	je     802a09 <memset+0x97>
+  802a03:	89 07                	mov    %eax,(%rdi)
+  802a05:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802a09:	41 f6 c1 02          	test   $0x2,%r9b
+  802a0d:	74 07                	je     802a16 <memset+0xa4>
+  802a0f:	66 89 07             	mov    %ax,(%rdi)
+  802a12:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802a16:	41 f6 c1 01          	test   $0x1,%r9b
+  802a1a:	74 9c                	je     8029b8 <memset+0x46>
+  802a1c:	88 07                	mov    %al,(%rdi)
+  802a1e:	eb 98                	jmp    8029b8 <memset+0x46>
+
+0000000000802a20 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802a20:	48 89 f8             	mov    %rdi,%rax
+  802a23:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802a26:	48 39 fe             	cmp    %rdi,%rsi
+  802a29:	73 3b                	jae    802a66 <memmove+0x46>
+  802a2b:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802a2f:	48 39 d7             	cmp    %rdx,%rdi
+  802a32:	73 32                	jae    802a66 <memmove+0x46>
+        s += n;
+        d += n;
+  802a34:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802a38:	48 89 d6             	mov    %rdx,%rsi
+  802a3b:	48 09 fe             	or     %rdi,%rsi
+  802a3e:	48 09 ce             	or     %rcx,%rsi
+  802a41:	40 f6 c6 07          	test   $0x7,%sil
+  802a45:	75 12                	jne    802a59 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802a47:	48 83 ef 08          	sub    $0x8,%rdi
+  802a4b:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802a4f:	48 c1 e9 03          	shr    $0x3,%rcx
+  802a53:	fd                   	std
+  802a54:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802a57:	fc                   	cld
+  802a58:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802a59:	48 83 ef 01          	sub    $0x1,%rdi
+  802a5d:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802a61:	fd                   	std
+  802a62:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802a64:	eb f1                	jmp    802a57 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802a66:	48 89 f2             	mov    %rsi,%rdx
+  802a69:	48 09 c2             	or     %rax,%rdx
+  802a6c:	48 09 ca             	or     %rcx,%rdx
+  802a6f:	f6 c2 07             	test   $0x7,%dl
+  802a72:	75 0c                	jne    802a80 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802a74:	48 c1 e9 03          	shr    $0x3,%rcx
+  802a78:	48 89 c7             	mov    %rax,%rdi
+  802a7b:	fc                   	cld
+  802a7c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802a7f:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802a80:	48 89 c7             	mov    %rax,%rdi
+  802a83:	fc                   	cld
+  802a84:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802a86:	c3                   	ret
+
+0000000000802a87 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802a87:	55                   	push   %rbp
+  802a88:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802a8b:	48 b8 20 2a 80 00 00 	movabs $0x802a20,%rax
+  802a92:	00 00 00 
+  802a95:	ff d0                	call   *%rax
+}
+  802a97:	5d                   	pop    %rbp
+  802a98:	c3                   	ret
+
+0000000000802a99 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802a99:	55                   	push   %rbp
+  802a9a:	48 89 e5             	mov    %rsp,%rbp
+  802a9d:	41 57                	push   %r15
+  802a9f:	41 56                	push   %r14
+  802aa1:	41 55                	push   %r13
+  802aa3:	41 54                	push   %r12
+  802aa5:	53                   	push   %rbx
+  802aa6:	48 83 ec 08          	sub    $0x8,%rsp
+  802aaa:	49 89 fe             	mov    %rdi,%r14
+  802aad:	49 89 f7             	mov    %rsi,%r15
+  802ab0:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802ab3:	48 89 f7             	mov    %rsi,%rdi
+  802ab6:	48 b8 e8 27 80 00 00 	movabs $0x8027e8,%rax
+  802abd:	00 00 00 
+  802ac0:	ff d0                	call   *%rax
+  802ac2:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802ac5:	48 89 de             	mov    %rbx,%rsi
+  802ac8:	4c 89 f7             	mov    %r14,%rdi
+  802acb:	48 b8 03 28 80 00 00 	movabs $0x802803,%rax
+  802ad2:	00 00 00 
+  802ad5:	ff d0                	call   *%rax
+  802ad7:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802ada:	48 39 c3             	cmp    %rax,%rbx
+  802add:	74 36                	je     802b15 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802adf:	48 89 d8             	mov    %rbx,%rax
+  802ae2:	4c 29 e8             	sub    %r13,%rax
+  802ae5:	49 39 c4             	cmp    %rax,%r12
+  802ae8:	73 31                	jae    802b1b <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802aea:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802aef:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802af3:	4c 89 fe             	mov    %r15,%rsi
+  802af6:	48 b8 87 2a 80 00 00 	movabs $0x802a87,%rax
+  802afd:	00 00 00 
+  802b00:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802b02:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802b06:	48 83 c4 08          	add    $0x8,%rsp
+  802b0a:	5b                   	pop    %rbx
+  802b0b:	41 5c                	pop    %r12
+  802b0d:	41 5d                	pop    %r13
+  802b0f:	41 5e                	pop    %r14
+  802b11:	41 5f                	pop    %r15
+  802b13:	5d                   	pop    %rbp
+  802b14:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802b15:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802b19:	eb eb                	jmp    802b06 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802b1b:	48 83 eb 01          	sub    $0x1,%rbx
+  802b1f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802b23:	48 89 da             	mov    %rbx,%rdx
+  802b26:	4c 89 fe             	mov    %r15,%rsi
+  802b29:	48 b8 87 2a 80 00 00 	movabs $0x802a87,%rax
+  802b30:	00 00 00 
+  802b33:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802b35:	49 01 de             	add    %rbx,%r14
+  802b38:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802b3d:	eb c3                	jmp    802b02 <strlcat+0x69>
+
+0000000000802b3f <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802b3f:	48 85 d2             	test   %rdx,%rdx
+  802b42:	74 2d                	je     802b71 <memcmp+0x32>
+  802b44:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802b49:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802b4d:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802b52:	44 38 c1             	cmp    %r8b,%cl
+  802b55:	75 0f                	jne    802b66 <memcmp+0x27>
+    while (n-- > 0) {
+  802b57:	48 83 c0 01          	add    $0x1,%rax
+  802b5b:	48 39 c2             	cmp    %rax,%rdx
+  802b5e:	75 e9                	jne    802b49 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b65:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802b66:	0f b6 c1             	movzbl %cl,%eax
+  802b69:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802b6d:	44 29 c0             	sub    %r8d,%eax
+  802b70:	c3                   	ret
+    return 0;
+  802b71:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b76:	c3                   	ret
+
+0000000000802b77 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802b77:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802b7b:	48 39 c7             	cmp    %rax,%rdi
+  802b7e:	73 0f                	jae    802b8f <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802b80:	40 38 37             	cmp    %sil,(%rdi)
+  802b83:	74 0e                	je     802b93 <memfind+0x1c>
+    for (; src < end; src++) {
+  802b85:	48 83 c7 01          	add    $0x1,%rdi
+  802b89:	48 39 f8             	cmp    %rdi,%rax
+  802b8c:	75 f2                	jne    802b80 <memfind+0x9>
+  802b8e:	c3                   	ret
+  802b8f:	48 89 f8             	mov    %rdi,%rax
+  802b92:	c3                   	ret
+  802b93:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802b96:	c3                   	ret
+
+0000000000802b97 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802b97:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802b9a:	0f b6 37             	movzbl (%rdi),%esi
+  802b9d:	40 80 fe 20          	cmp    $0x20,%sil
+  802ba1:	74 06                	je     802ba9 <strtol+0x12>
+  802ba3:	40 80 fe 09          	cmp    $0x9,%sil
+  802ba7:	75 13                	jne    802bbc <strtol+0x25>
+  802ba9:	48 83 c7 01          	add    $0x1,%rdi
+  802bad:	0f b6 37             	movzbl (%rdi),%esi
+  802bb0:	40 80 fe 20          	cmp    $0x20,%sil
+  802bb4:	74 f3                	je     802ba9 <strtol+0x12>
+  802bb6:	40 80 fe 09          	cmp    $0x9,%sil
+  802bba:	74 ed                	je     802ba9 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802bbc:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802bbf:	83 e0 fd             	and    $0xfffffffd,%eax
+  802bc2:	3c 01                	cmp    $0x1,%al
+  802bc4:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802bc8:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802bce:	75 0f                	jne    802bdf <strtol+0x48>
+  802bd0:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802bd3:	74 14                	je     802be9 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802bd5:	85 d2                	test   %edx,%edx
+  802bd7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802bdc:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802be4:	4c 63 ca             	movslq %edx,%r9
+  802be7:	eb 36                	jmp    802c1f <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802be9:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802bed:	74 0f                	je     802bfe <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802bef:	85 d2                	test   %edx,%edx
+  802bf1:	75 ec                	jne    802bdf <strtol+0x48>
+        s++;
+  802bf3:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802bf7:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802bfc:	eb e1                	jmp    802bdf <strtol+0x48>
+        s += 2;
+  802bfe:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802c02:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802c07:	eb d6                	jmp    802bdf <strtol+0x48>
+            dig -= '0';
+  802c09:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802c0c:	44 0f b6 c1          	movzbl %cl,%r8d
+  802c10:	41 39 d0             	cmp    %edx,%r8d
+  802c13:	7d 21                	jge    802c36 <strtol+0x9f>
+        val = val * base + dig;
+  802c15:	49 0f af c1          	imul   %r9,%rax
+  802c19:	0f b6 c9             	movzbl %cl,%ecx
+  802c1c:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802c1f:	48 83 c7 01          	add    $0x1,%rdi
+  802c23:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802c27:	80 f9 39             	cmp    $0x39,%cl
+  802c2a:	76 dd                	jbe    802c09 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802c2c:	80 f9 7b             	cmp    $0x7b,%cl
+  802c2f:	77 05                	ja     802c36 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802c31:	83 e9 57             	sub    $0x57,%ecx
+  802c34:	eb d6                	jmp    802c0c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802c36:	4d 85 d2             	test   %r10,%r10
+  802c39:	74 03                	je     802c3e <strtol+0xa7>
+  802c3b:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802c3e:	48 89 c2             	mov    %rax,%rdx
+  802c41:	48 f7 da             	neg    %rdx
+  802c44:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802c48:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802c4c:	c3                   	ret
+
+0000000000802c4d <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  802c4d:	55                   	push   %rbp
+  802c4e:	48 89 e5             	mov    %rsp,%rbp
+  802c51:	41 56                	push   %r14
+  802c53:	41 55                	push   %r13
+  802c55:	41 54                	push   %r12
+  802c57:	53                   	push   %rbx
+  802c58:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802c5b:	48 b8 68 70 80 00 00 	movabs $0x807068,%rax
+  802c62:	00 00 00 
+  802c65:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802c69:	74 27                	je     802c92 <_handle_vectored_pagefault+0x45>
+  802c6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  802c70:	49 bd 20 70 80 00 00 	movabs $0x807020,%r13
+  802c77:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802c7a:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  802c7d:	4c 89 e7             	mov    %r12,%rdi
+  802c80:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  802c85:	84 c0                	test   %al,%al
+  802c87:	75 45                	jne    802cce <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802c89:	48 83 c3 01          	add    $0x1,%rbx
+  802c8d:	49 3b 1e             	cmp    (%r14),%rbx
+  802c90:	72 eb                	jb     802c7d <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  802c92:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  802c99:	00 
+  802c9a:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  802c9f:	4d 8b 04 24          	mov    (%r12),%r8
+  802ca3:	48 ba 10 38 80 00 00 	movabs $0x803810,%rdx
+  802caa:	00 00 00 
+  802cad:	be 1d 00 00 00       	mov    $0x1d,%esi
+  802cb2:	48 bf a7 38 80 00 00 	movabs $0x8038a7,%rdi
+  802cb9:	00 00 00 
+  802cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc1:	49 ba b1 1d 80 00 00 	movabs $0x801db1,%r10
+  802cc8:	00 00 00 
+  802ccb:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  802cce:	5b                   	pop    %rbx
+  802ccf:	41 5c                	pop    %r12
+  802cd1:	41 5d                	pop    %r13
+  802cd3:	41 5e                	pop    %r14
+  802cd5:	5d                   	pop    %rbp
+  802cd6:	c3                   	ret
+
+0000000000802cd7 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  802cd7:	55                   	push   %rbp
+  802cd8:	48 89 e5             	mov    %rsp,%rbp
+  802cdb:	53                   	push   %rbx
+  802cdc:	48 83 ec 08          	sub    $0x8,%rsp
+  802ce0:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  802ce3:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  802cea:	00 00 00 
+  802ced:	80 38 00             	cmpb   $0x0,(%rax)
+  802cf0:	74 61                	je     802d53 <add_pgfault_handler+0x7c>
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802cf2:	48 b8 68 70 80 00 00 	movabs $0x807068,%rax
+  802cf9:	00 00 00 
+  802cfc:	48 8b 10             	mov    (%rax),%rdx
+  802cff:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  802d04:	48 b9 20 70 80 00 00 	movabs $0x807020,%rcx
+  802d0b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802d0e:	48 85 d2             	test   %rdx,%rdx
+  802d11:	74 19                	je     802d2c <add_pgfault_handler+0x55>
+        if (handler == _pfhandler_vec[i]) return 0;
+  802d13:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  802d17:	74 2f                	je     802d48 <add_pgfault_handler+0x71>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802d19:	48 83 c0 01          	add    $0x1,%rax
+  802d1d:	48 39 d0             	cmp    %rdx,%rax
+  802d20:	75 f1                	jne    802d13 <add_pgfault_handler+0x3c>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  802d22:	48 83 fa 08          	cmp    $0x8,%rdx
+  802d26:	0f 84 f7 00 00 00    	je     802e23 <add_pgfault_handler+0x14c>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  802d2c:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802d30:	48 a3 68 70 80 00 00 	movabs %rax,0x807068
+  802d37:	00 00 00 
+  802d3a:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  802d41:	00 00 00 
+  802d44:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  802d48:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d51:	c9                   	leave
+  802d52:	c3                   	ret
+        if (sys_alloc_region(CURENVID, ues_beg, PAGE_SIZE, PROT_RW))
+  802d53:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802d58:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d5d:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  802d64:	00 00 00 
+  802d67:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d6c:	48 b8 a4 02 80 00 00 	movabs $0x8002a4,%rax
+  802d73:	00 00 00 
+  802d76:	ff d0                	call   *%rax
+  802d78:	85 c0                	test   %eax,%eax
+  802d7a:	75 53                	jne    802dcf <add_pgfault_handler+0xf8>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  802d7c:	48 ba 68 70 80 00 00 	movabs $0x807068,%rdx
+  802d83:	00 00 00 
+  802d86:	48 8b 02             	mov    (%rdx),%rax
+  802d89:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802d8d:	48 89 0a             	mov    %rcx,(%rdx)
+  802d90:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  802d97:	00 00 00 
+  802d9a:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        if (sys_env_set_pgfault_upcall(CURENVID, _pgfault_upcall))
+  802d9e:	48 be 46 08 80 00 00 	movabs $0x800846,%rsi
+  802da5:	00 00 00 
+  802da8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dad:	48 b8 79 05 80 00 00 	movabs $0x800579,%rax
+  802db4:	00 00 00 
+  802db7:	ff d0                	call   *%rax
+  802db9:	85 c0                	test   %eax,%eax
+  802dbb:	75 3c                	jne    802df9 <add_pgfault_handler+0x122>
+        _pfhandler_inititiallized = 1;
+  802dbd:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  802dc4:	00 00 00 
+  802dc7:	c6 00 01             	movb   $0x1,(%rax)
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  802dca:	e9 79 ff ff ff       	jmp    802d48 <add_pgfault_handler+0x71>
+            panic("add_pgfault_handler: sys_alloc_region failed");
+  802dcf:	48 ba 40 38 80 00 00 	movabs $0x803840,%rdx
+  802dd6:	00 00 00 
+  802dd9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802dde:	48 bf a7 38 80 00 00 	movabs $0x8038a7,%rdi
+  802de5:	00 00 00 
+  802de8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ded:	48 b9 b1 1d 80 00 00 	movabs $0x801db1,%rcx
+  802df4:	00 00 00 
+  802df7:	ff d1                	call   *%rcx
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+  802df9:	48 ba 70 38 80 00 00 	movabs $0x803870,%rdx
+  802e00:	00 00 00 
+  802e03:	be 32 00 00 00       	mov    $0x32,%esi
+  802e08:	48 bf a7 38 80 00 00 	movabs $0x8038a7,%rdi
+  802e0f:	00 00 00 
+  802e12:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e17:	48 b9 b1 1d 80 00 00 	movabs $0x801db1,%rcx
+  802e1e:	00 00 00 
+  802e21:	ff d1                	call   *%rcx
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  802e23:	b9 fd ff ff ff       	mov    $0xfffffffd,%ecx
+  802e28:	48 ba b5 38 80 00 00 	movabs $0x8038b5,%rdx
+  802e2f:	00 00 00 
+  802e32:	be 40 00 00 00       	mov    $0x40,%esi
+  802e37:	48 bf a7 38 80 00 00 	movabs $0x8038a7,%rdi
+  802e3e:	00 00 00 
+  802e41:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e46:	49 b8 b1 1d 80 00 00 	movabs $0x801db1,%r8
+  802e4d:	00 00 00 
+  802e50:	41 ff d0             	call   *%r8
+
+0000000000802e53 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  802e53:	55                   	push   %rbp
+  802e54:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  802e57:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  802e5e:	00 00 00 
+  802e61:	80 38 00             	cmpb   $0x0,(%rax)
+  802e64:	74 33                	je     802e99 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802e66:	48 a1 68 70 80 00 00 	movabs 0x807068,%rax
+  802e6d:	00 00 00 
+  802e70:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  802e75:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  802e7c:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802e7f:	48 85 c0             	test   %rax,%rax
+  802e82:	0f 84 85 00 00 00    	je     802f0d <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  802e88:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  802e8c:	74 40                	je     802ece <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802e8e:	48 83 c1 01          	add    $0x1,%rcx
+  802e92:	48 39 c1             	cmp    %rax,%rcx
+  802e95:	75 f1                	jne    802e88 <remove_pgfault_handler+0x35>
+  802e97:	eb 74                	jmp    802f0d <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  802e99:	48 b9 cd 38 80 00 00 	movabs $0x8038cd,%rcx
+  802ea0:	00 00 00 
+  802ea3:	48 ba 87 31 80 00 00 	movabs $0x803187,%rdx
+  802eaa:	00 00 00 
+  802ead:	be 46 00 00 00       	mov    $0x46,%esi
+  802eb2:	48 bf a7 38 80 00 00 	movabs $0x8038a7,%rdi
+  802eb9:	00 00 00 
+  802ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec1:	49 b8 b1 1d 80 00 00 	movabs $0x801db1,%r8
+  802ec8:	00 00 00 
+  802ecb:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  802ece:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  802ed5:	00 
+  802ed6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802eda:	48 29 ca             	sub    %rcx,%rdx
+  802edd:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  802ee4:	00 00 00 
+  802ee7:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  802eeb:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  802ef0:	48 89 ce             	mov    %rcx,%rsi
+  802ef3:	48 b8 20 2a 80 00 00 	movabs $0x802a20,%rax
+  802efa:	00 00 00 
+  802efd:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  802eff:	48 b8 68 70 80 00 00 	movabs $0x807068,%rax
+  802f06:	00 00 00 
+  802f09:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  802f0d:	5d                   	pop    %rbp
+  802f0e:	c3                   	ret
+
+0000000000802f0f <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802f0f:	55                   	push   %rbp
+  802f10:	48 89 e5             	mov    %rsp,%rbp
+  802f13:	41 54                	push   %r12
+  802f15:	53                   	push   %rbx
+  802f16:	48 89 fb             	mov    %rdi,%rbx
+  802f19:	48 89 f7             	mov    %rsi,%rdi
+  802f1c:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802f1f:	48 85 f6             	test   %rsi,%rsi
+  802f22:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f29:	00 00 00 
+  802f2c:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802f30:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f35:	48 b8 0e 06 80 00 00 	movabs $0x80060e,%rax
+  802f3c:	00 00 00 
+  802f3f:	ff d0                	call   *%rax
+    if (res < 0) {
+  802f41:	85 c0                	test   %eax,%eax
+  802f43:	78 45                	js     802f8a <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802f45:	48 85 db             	test   %rbx,%rbx
+  802f48:	74 12                	je     802f5c <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802f4a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f51:	00 00 00 
+  802f54:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802f5a:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802f5c:	4d 85 e4             	test   %r12,%r12
+  802f5f:	74 14                	je     802f75 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802f61:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f68:	00 00 00 
+  802f6b:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802f71:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802f75:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f7c:	00 00 00 
+  802f7f:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802f85:	5b                   	pop    %rbx
+  802f86:	41 5c                	pop    %r12
+  802f88:	5d                   	pop    %rbp
+  802f89:	c3                   	ret
+        if (from_env_store)
+  802f8a:	48 85 db             	test   %rbx,%rbx
+  802f8d:	74 06                	je     802f95 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802f8f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802f95:	4d 85 e4             	test   %r12,%r12
+  802f98:	74 eb                	je     802f85 <ipc_recv+0x76>
+            *perm_store = 0;
+  802f9a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802fa1:	00 
+  802fa2:	eb e1                	jmp    802f85 <ipc_recv+0x76>
+
+0000000000802fa4 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802fa4:	55                   	push   %rbp
+  802fa5:	48 89 e5             	mov    %rsp,%rbp
+  802fa8:	41 57                	push   %r15
+  802faa:	41 56                	push   %r14
+  802fac:	41 55                	push   %r13
+  802fae:	41 54                	push   %r12
+  802fb0:	53                   	push   %rbx
+  802fb1:	48 83 ec 18          	sub    $0x18,%rsp
+  802fb5:	41 89 fd             	mov    %edi,%r13d
+  802fb8:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802fbb:	48 89 d3             	mov    %rdx,%rbx
+  802fbe:	49 89 cc             	mov    %rcx,%r12
+  802fc1:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802fc5:	48 85 d2             	test   %rdx,%rdx
+  802fc8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802fcf:	00 00 00 
+  802fd2:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802fd6:	49 be e2 05 80 00 00 	movabs $0x8005e2,%r14
+  802fdd:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802fe0:	49 bf 15 02 80 00 00 	movabs $0x800215,%r15
+  802fe7:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802fea:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802fed:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802ff1:	4c 89 e1             	mov    %r12,%rcx
+  802ff4:	48 89 da             	mov    %rbx,%rdx
+  802ff7:	44 89 ef             	mov    %r13d,%edi
+  802ffa:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802ffd:	85 c0                	test   %eax,%eax
+  802fff:	74 34                	je     803035 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  803001:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803004:	75 05                	jne    80300b <ipc_send+0x67>
+        sys_yield();
+  803006:	41 ff d7             	call   *%r15
+    while (true) {
+  803009:	eb df                	jmp    802fea <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  80300b:	48 ba e7 38 80 00 00 	movabs $0x8038e7,%rdx
+  803012:	00 00 00 
+  803015:	be 3e 00 00 00       	mov    $0x3e,%esi
+  80301a:	48 bf 00 39 80 00 00 	movabs $0x803900,%rdi
+  803021:	00 00 00 
+  803024:	b8 00 00 00 00       	mov    $0x0,%eax
+  803029:	48 b9 b1 1d 80 00 00 	movabs $0x801db1,%rcx
+  803030:	00 00 00 
+  803033:	ff d1                	call   *%rcx
+    }
+}
+  803035:	48 83 c4 18          	add    $0x18,%rsp
+  803039:	5b                   	pop    %rbx
+  80303a:	41 5c                	pop    %r12
+  80303c:	41 5d                	pop    %r13
+  80303e:	41 5e                	pop    %r14
+  803040:	41 5f                	pop    %r15
+  803042:	5d                   	pop    %rbp
+  803043:	c3                   	ret
+
+0000000000803044 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803044:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803049:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803050:	00 00 00 
+  803053:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  80305a:	48 01 ca             	add    %rcx,%rdx
+  80305d:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803063:	39 fa                	cmp    %edi,%edx
+  803065:	74 12                	je     803079 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803067:	48 83 c0 01          	add    $0x1,%rax
+  80306b:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  803071:	75 e0                	jne    803053 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803073:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803078:	c3                   	ret
+            return envs[i].env_id;
+  803079:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  803080:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803087:	00 00 00 
+  80308a:	48 01 d0             	add    %rdx,%rax
+  80308d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803093:	c3                   	ret
+  803094:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000803098 <__rodata_start>:
+  803098:	3c 75                	cmp    $0x75,%al
+  80309a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80309b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80309f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030a0:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  8030a4:	1f                   	(bad)
+  8030a5:	44 00 00             	add    %r8b,(%rax)
+  8030a8:	73 79                	jae    803123 <__rodata_start+0x8b>
+  8030aa:	73 63                	jae    80310f <__rodata_start+0x77>
+  8030ac:	61                   	(bad)
+  8030ad:	6c                   	insb   (%dx),%es:(%rdi)
+  8030ae:	6c                   	insb   (%dx),%es:(%rdi)
+  8030af:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a0952f <__bss_end+0x7220152f>
+  8030b5:	65 74 75             	gs je  80312d <__rodata_start+0x95>
+  8030b8:	72 6e                	jb     803128 <__rodata_start+0x90>
+  8030ba:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a0953c <__bss_end+0x2820153c>
+  8030c1:	28 
+  8030c2:	3e 20 30             	ds and %dh,(%rax)
+  8030c5:	29 00                	sub    %eax,(%rax)
+  8030c7:	6c                   	insb   (%dx),%es:(%rdi)
+  8030c8:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8030cf:	61                   	(bad)
+  8030d0:	6c                   	insb   (%dx),%es:(%rdi)
+  8030d1:	6c                   	insb   (%dx),%es:(%rdi)
+  8030d2:	2e 63 00             	cs movsxd (%rax),%eax
+  8030d5:	0f 1f 00             	nopl   (%rax)
+  8030d8:	5b                   	pop    %rbx
+  8030d9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8030de:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8030e1:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8030e5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030e6:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8030ea:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8030f1:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 803b5c <error_string+0x41c>
+  8030f8:	5b                   	pop    %rbx
+  8030f9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8030fe:	20 66 74             	and    %ah,0x74(%rsi)
+  803101:	72 75                	jb     803178 <devtab+0x18>
+  803103:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803104:	63 61 74             	movsxd 0x74(%rcx),%esp
+  803107:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad5172 <__bss_end+0x2d2cd172>
+  80310e:	20 62 61             	and    %ah,0x61(%rdx)
+  803111:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803115:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803119:	5b                   	pop    %rbx
+  80311a:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80311f:	20 72 65             	and    %dh,0x65(%rdx)
+  803122:	61                   	(bad)
+  803123:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad518e <__bss_end+0x2d2cd18e>
+  80312a:	20 62 61             	and    %ah,0x61(%rdx)
+  80312d:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803131:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803135:	5b                   	pop    %rbx
+  803136:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80313b:	20 77 72             	and    %dh,0x72(%rdi)
+  80313e:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  803145:	2d 
+  803146:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  80314b:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  80314e:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803152:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803159:	00 00 00 
+  80315c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000803160 <devtab>:
+  803160:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803170:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803180:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803190:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8031a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8031b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8031c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8031d0:	3d 20 32 00 0f 1f 40 00 73 69 67 6e 61 6c 73 3a     = 2...@.signals:
+  8031e0:	20 65 6e 76 20 25 78 3a 20 62 65 67 69 6e 20 67      env %x: begin g
+  8031f0:	65 6e 65 72 69 63 20 68 61 6e 64 6c 65 72 20 66     eneric handler f
+  803200:	6f 72 20 25 64 0a 00 00 73 69 67 6e 61 6c 73 3a     or %d...signals:
+  803210:	20 65 6e 76 20 25 78 3a 20 65 78 69 74 69 6e 67      env %x: exiting
+  803220:	20 64 75 65 20 74 6f 20 73 69 67 6e 61 6c 20 25      due to signal %
+  803230:	64 0a 00 00 00 00 00 00 73 69 67 6e 61 6c 73 3a     d.......signals:
+  803240:	20 65 6e 76 20 25 78 3a 20 69 67 6e 6f 72 69 6e      env %x: ignorin
+  803250:	67 20 73 69 67 6e 61 6c 20 25 64 0a 00 00 00 00     g signal %d.....
+  803260:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  803270:	20 65 6e 64 20 67 65 6e 65 72 69 63 20 68 61 6e      end generic han
+  803280:	64 6c 65 72 20 66 6f 72 20 25 64 0a 00 66 61 6c     dler for %d..fal
+  803290:	73 65 00 6c 69 62 2f 73 69 67 6e 61 6c 2e 63 00     se.lib/signal.c.
+  8032a0:	3c 63 6f 6e 73 3e 00 63 6f 6e 73 00 0f 1f 40 00     <cons>.cons...@.
+  8032b0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8032c0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8032d0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  8032e0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  8032f0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  803300:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  803310:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  803320:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  803330:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  803340:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  803350:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  803360:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  803370:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  803380:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  803390:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8033a0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8033b0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8033c0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  8033d0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  8033e0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  8033f0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  803400:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  803410:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  803420:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  803430:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  803440:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  803450:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  803460:	64 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     d.operation not 
+  803470:	70 65 72 6d 69 74 74 65 64 00 66 0f 1f 44 00 00     permitted.f..D..
+  803480:	ee 20 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     . ....../'......
+  803490:	1f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     .'....../'......
+  8034a0:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  8034b0:	2f 27 80 00 00 00 00 00 0d 21 80 00 00 00 00 00     /'.......!......
+  8034c0:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  8034d0:	01 21 80 00 00 00 00 00 7b 21 80 00 00 00 00 00     .!......{!......
+  8034e0:	2f 27 80 00 00 00 00 00 01 21 80 00 00 00 00 00     /'.......!......
+  8034f0:	47 21 80 00 00 00 00 00 47 21 80 00 00 00 00 00     G!......G!......
+  803500:	47 21 80 00 00 00 00 00 47 21 80 00 00 00 00 00     G!......G!......
+  803510:	47 21 80 00 00 00 00 00 47 21 80 00 00 00 00 00     G!......G!......
+  803520:	47 21 80 00 00 00 00 00 47 21 80 00 00 00 00 00     G!......G!......
+  803530:	47 21 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     G!....../'......
+  803540:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  803550:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  803560:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  803570:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  803580:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  803590:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  8035a0:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  8035b0:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  8035c0:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  8035d0:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  8035e0:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  8035f0:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  803600:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  803610:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  803620:	2f 27 80 00 00 00 00 00 52 26 80 00 00 00 00 00     /'......R&......
+  803630:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  803640:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  803650:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  803660:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  803670:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  803680:	9e 21 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     .!......m#......
+  803690:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  8036a0:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  8036b0:	cd 21 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     .!....../'......
+  8036c0:	2f 27 80 00 00 00 00 00 93 21 80 00 00 00 00 00     /'.......!......
+  8036d0:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  8036e0:	15 25 80 00 00 00 00 00 df 25 80 00 00 00 00 00     .%.......%......
+  8036f0:	2f 27 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     /'....../'......
+  803700:	64 22 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     d"....../'......
+  803710:	41 24 80 00 00 00 00 00 2f 27 80 00 00 00 00 00     A$....../'......
+  803720:	2f 27 80 00 00 00 00 00 52 26 80 00 00 00 00 00     /'......R&......
+  803730:	2f 27 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     /'....... ......
+
+0000000000803740 <error_string>:
+	...
+  803748:	05 33 80 00 00 00 00 00 17 33 80 00 00 00 00 00     .3.......3......
+  803758:	27 33 80 00 00 00 00 00 39 33 80 00 00 00 00 00     '3......93......
+  803768:	47 33 80 00 00 00 00 00 5b 33 80 00 00 00 00 00     G3......[3......
+  803778:	70 33 80 00 00 00 00 00 83 33 80 00 00 00 00 00     p3.......3......
+  803788:	95 33 80 00 00 00 00 00 a9 33 80 00 00 00 00 00     .3.......3......
+  803798:	b9 33 80 00 00 00 00 00 cc 33 80 00 00 00 00 00     .3.......3......
+  8037a8:	e3 33 80 00 00 00 00 00 f9 33 80 00 00 00 00 00     .3.......3......
+  8037b8:	11 34 80 00 00 00 00 00 29 34 80 00 00 00 00 00     .4......)4......
+  8037c8:	36 34 80 00 00 00 00 00 f0 37 80 00 00 00 00 00     64.......7......
+  8037d8:	4a 34 80 00 00 00 00 00 00 00 00 00 00 00 00 00     J4..............
+  8037e8:	62 34 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     b4......file is 
+  8037f8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803808:	75 74 61 62 6c 65 00 90 55 73 65 72 73 70 61 63     utable..Userspac
+  803818:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  803828:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  803838:	65 72 72 3d 25 78 0a 00 61 64 64 5f 70 67 66 61     err=%x..add_pgfa
+  803848:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  803858:	5f 61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61     _alloc_region fa
+  803868:	69 6c 65 64 00 00 00 00 61 64 64 5f 70 67 66 61     iled....add_pgfa
+  803878:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  803888:	5f 65 6e 76 5f 73 65 74 5f 70 67 66 61 75 6c 74     _env_set_pgfault
+  803898:	5f 75 70 63 61 6c 6c 20 66 61 69 6c 65 64 00 6c     _upcall failed.l
+  8038a8:	69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65 74     ib/pgfault.c.set
+  8038b8:	5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65 72     _pgfault_handler
+  8038c8:	3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72 5f     : %i._pfhandler_
+  8038d8:	69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00 69     inititiallized.i
+  8038e8:	70 63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64 20     pc_send: failed 
+  8038f8:	74 6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63 2e     to send.lib/ipc.
+  803908:	63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     c.f.........f...
+  803918:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803928:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803938:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803948:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803958:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803968:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803978:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803988:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803998:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803aa8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ab8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ac8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ad8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ae8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803af8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ba8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803be8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bf8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ca8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cb8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cc8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cd8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ce8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cf8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803da8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803db8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dc8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dd8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803de8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803df8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ea8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803eb8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ec8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ed8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ee8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ef8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fa8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fc8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fd8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fe8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ff8:	84 00 00 00 00 00 66 90                             ......f.
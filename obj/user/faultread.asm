@@ -0,0 +1,5664 @@
+
+obj/user/faultread:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2a 00 00 00       	call   80004d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Buggy program - faults with a read from location zero */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    cprintf("I read %08x from location 0!\n", *(volatile unsigned *)0);
+  800029:	8b 34 25 00 00 00 00 	mov    0x0,%esi
+  800030:	48 bf 38 2b 80 00 00 	movabs $0x802b38,%rdi
+  800037:	00 00 00 
+  80003a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003f:	48 ba c4 01 80 00 00 	movabs $0x8001c4,%rdx
+  800046:	00 00 00 
+  800049:	ff d2                	call   *%rdx
+#endif
+}
+  80004b:	5d                   	pop    %rbp
+  80004c:	c3                   	ret
+
+000000000080004d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80004d:	55                   	push   %rbp
+  80004e:	48 89 e5             	mov    %rsp,%rbp
+  800051:	41 56                	push   %r14
+  800053:	41 55                	push   %r13
+  800055:	41 54                	push   %r12
+  800057:	53                   	push   %rbx
+  800058:	41 89 fd             	mov    %edi,%r13d
+  80005b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005e:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800065:	00 00 00 
+  800068:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80006f:	00 00 00 
+  800072:	48 39 c2             	cmp    %rax,%rdx
+  800075:	73 17                	jae    80008e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800077:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007a:	49 89 c4             	mov    %rax,%r12
+  80007d:	48 83 c3 08          	add    $0x8,%rbx
+  800081:	b8 00 00 00 00       	mov    $0x0,%eax
+  800086:	ff 53 f8             	call   *-0x8(%rbx)
+  800089:	4c 39 e3             	cmp    %r12,%rbx
+  80008c:	72 ef                	jb     80007d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  80008e:	48 b8 d9 0f 80 00 00 	movabs $0x800fd9,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+  80009a:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  80009d:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8000a4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000ab:	00 00 00 
+  8000ae:	48 01 d0             	add    %rdx,%rax
+  8000b1:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000b8:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000bb:	45 85 ed             	test   %r13d,%r13d
+  8000be:	7e 0d                	jle    8000cd <libmain+0x80>
+  8000c0:	49 8b 06             	mov    (%r14),%rax
+  8000c3:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000ca:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000cd:	4c 89 f6             	mov    %r14,%rsi
+  8000d0:	44 89 ef             	mov    %r13d,%edi
+  8000d3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000da:	00 00 00 
+  8000dd:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000df:	48 b8 f4 00 80 00 00 	movabs $0x8000f4,%rax
+  8000e6:	00 00 00 
+  8000e9:	ff d0                	call   *%rax
+#endif
+}
+  8000eb:	5b                   	pop    %rbx
+  8000ec:	41 5c                	pop    %r12
+  8000ee:	41 5d                	pop    %r13
+  8000f0:	41 5e                	pop    %r14
+  8000f2:	5d                   	pop    %rbp
+  8000f3:	c3                   	ret
+
+00000000008000f4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f4:	55                   	push   %rbp
+  8000f5:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000f8:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  8000ff:	00 00 00 
+  800102:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800104:	bf 00 00 00 00       	mov    $0x0,%edi
+  800109:	48 b8 6e 0f 80 00 00 	movabs $0x800f6e,%rax
+  800110:	00 00 00 
+  800113:	ff d0                	call   *%rax
+}
+  800115:	5d                   	pop    %rbp
+  800116:	c3                   	ret
+
+0000000000800117 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800117:	55                   	push   %rbp
+  800118:	48 89 e5             	mov    %rsp,%rbp
+  80011b:	53                   	push   %rbx
+  80011c:	48 83 ec 08          	sub    $0x8,%rsp
+  800120:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800123:	8b 06                	mov    (%rsi),%eax
+  800125:	8d 50 01             	lea    0x1(%rax),%edx
+  800128:	89 16                	mov    %edx,(%rsi)
+  80012a:	48 98                	cltq
+  80012c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800131:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800137:	74 0a                	je     800143 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800139:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80013d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800141:	c9                   	leave
+  800142:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800143:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800147:	be ff 00 00 00       	mov    $0xff,%esi
+  80014c:	48 b8 10 0f 80 00 00 	movabs $0x800f10,%rax
+  800153:	00 00 00 
+  800156:	ff d0                	call   *%rax
+        state->offset = 0;
+  800158:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80015e:	eb d9                	jmp    800139 <putch+0x22>
+
+0000000000800160 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800160:	55                   	push   %rbp
+  800161:	48 89 e5             	mov    %rsp,%rbp
+  800164:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80016b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80016e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800175:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80017a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800182:	48 89 f1             	mov    %rsi,%rcx
+  800185:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80018c:	48 bf 17 01 80 00 00 	movabs $0x800117,%rdi
+  800193:	00 00 00 
+  800196:	48 b8 14 03 80 00 00 	movabs $0x800314,%rax
+  80019d:	00 00 00 
+  8001a0:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001a2:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001a9:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001b0:	48 b8 10 0f 80 00 00 	movabs $0x800f10,%rax
+  8001b7:	00 00 00 
+  8001ba:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001bc:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001c2:	c9                   	leave
+  8001c3:	c3                   	ret
+
+00000000008001c4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001c4:	55                   	push   %rbp
+  8001c5:	48 89 e5             	mov    %rsp,%rbp
+  8001c8:	48 83 ec 50          	sub    $0x50,%rsp
+  8001cc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001d0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001d4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001d8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001dc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001e0:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001e7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8001ef:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8001f3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8001f7:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8001fb:	48 b8 60 01 80 00 00 	movabs $0x800160,%rax
+  800202:	00 00 00 
+  800205:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+0000000000800209 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800209:	55                   	push   %rbp
+  80020a:	48 89 e5             	mov    %rsp,%rbp
+  80020d:	41 57                	push   %r15
+  80020f:	41 56                	push   %r14
+  800211:	41 55                	push   %r13
+  800213:	41 54                	push   %r12
+  800215:	53                   	push   %rbx
+  800216:	48 83 ec 18          	sub    $0x18,%rsp
+  80021a:	49 89 fc             	mov    %rdi,%r12
+  80021d:	49 89 f5             	mov    %rsi,%r13
+  800220:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800224:	8b 45 10             	mov    0x10(%rbp),%eax
+  800227:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80022a:	41 89 cf             	mov    %ecx,%r15d
+  80022d:	4c 39 fa             	cmp    %r15,%rdx
+  800230:	73 5b                	jae    80028d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800232:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800236:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80023a:	85 db                	test   %ebx,%ebx
+  80023c:	7e 0e                	jle    80024c <print_num+0x43>
+            putch(padc, put_arg);
+  80023e:	4c 89 ee             	mov    %r13,%rsi
+  800241:	44 89 f7             	mov    %r14d,%edi
+  800244:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800247:	83 eb 01             	sub    $0x1,%ebx
+  80024a:	75 f2                	jne    80023e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80024c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800250:	48 b9 71 2b 80 00 00 	movabs $0x802b71,%rcx
+  800257:	00 00 00 
+  80025a:	48 b8 60 2b 80 00 00 	movabs $0x802b60,%rax
+  800261:	00 00 00 
+  800264:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800268:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80026c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800271:	49 f7 f7             	div    %r15
+  800274:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800278:	4c 89 ee             	mov    %r13,%rsi
+  80027b:	41 ff d4             	call   *%r12
+}
+  80027e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800282:	5b                   	pop    %rbx
+  800283:	41 5c                	pop    %r12
+  800285:	41 5d                	pop    %r13
+  800287:	41 5e                	pop    %r14
+  800289:	41 5f                	pop    %r15
+  80028b:	5d                   	pop    %rbp
+  80028c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80028d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800291:	ba 00 00 00 00       	mov    $0x0,%edx
+  800296:	49 f7 f7             	div    %r15
+  800299:	48 83 ec 08          	sub    $0x8,%rsp
+  80029d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002a1:	52                   	push   %rdx
+  8002a2:	45 0f be c9          	movsbl %r9b,%r9d
+  8002a6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002aa:	48 89 c2             	mov    %rax,%rdx
+  8002ad:	48 b8 09 02 80 00 00 	movabs $0x800209,%rax
+  8002b4:	00 00 00 
+  8002b7:	ff d0                	call   *%rax
+  8002b9:	48 83 c4 10          	add    $0x10,%rsp
+  8002bd:	eb 8d                	jmp    80024c <print_num+0x43>
+
+00000000008002bf <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002bf:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002c3:	48 8b 06             	mov    (%rsi),%rax
+  8002c6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002ca:	73 0a                	jae    8002d6 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002cc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002d0:	48 89 16             	mov    %rdx,(%rsi)
+  8002d3:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002d6:	c3                   	ret
+
+00000000008002d7 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002d7:	55                   	push   %rbp
+  8002d8:	48 89 e5             	mov    %rsp,%rbp
+  8002db:	48 83 ec 50          	sub    $0x50,%rsp
+  8002df:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002e3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002e7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002eb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8002f2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002fa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002fe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800302:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800306:	48 b8 14 03 80 00 00 	movabs $0x800314,%rax
+  80030d:	00 00 00 
+  800310:	ff d0                	call   *%rax
+}
+  800312:	c9                   	leave
+  800313:	c3                   	ret
+
+0000000000800314 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800314:	55                   	push   %rbp
+  800315:	48 89 e5             	mov    %rsp,%rbp
+  800318:	41 57                	push   %r15
+  80031a:	41 56                	push   %r14
+  80031c:	41 55                	push   %r13
+  80031e:	41 54                	push   %r12
+  800320:	53                   	push   %rbx
+  800321:	48 83 ec 38          	sub    $0x38,%rsp
+  800325:	49 89 fe             	mov    %rdi,%r14
+  800328:	49 89 f5             	mov    %rsi,%r13
+  80032b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80032e:	48 8b 01             	mov    (%rcx),%rax
+  800331:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800335:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800339:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80033d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800341:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800345:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800349:	0f b6 3b             	movzbl (%rbx),%edi
+  80034c:	40 80 ff 25          	cmp    $0x25,%dil
+  800350:	74 18                	je     80036a <vprintfmt+0x56>
+            if (!ch) return;
+  800352:	40 84 ff             	test   %dil,%dil
+  800355:	0f 84 b1 06 00 00    	je     800a0c <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80035b:	40 0f b6 ff          	movzbl %dil,%edi
+  80035f:	4c 89 ee             	mov    %r13,%rsi
+  800362:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800365:	4c 89 e3             	mov    %r12,%rbx
+  800368:	eb db                	jmp    800345 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80036a:	be 00 00 00 00       	mov    $0x0,%esi
+  80036f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800373:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800378:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80037e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800385:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800389:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80038e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800393:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800396:	83 e8 23             	sub    $0x23,%eax
+  800399:	3c 57                	cmp    $0x57,%al
+  80039b:	0f 87 51 06 00 00    	ja     8009f2 <vprintfmt+0x6de>
+  8003a1:	0f b6 c0             	movzbl %al,%eax
+  8003a4:	48 b9 20 2d 80 00 00 	movabs $0x802d20,%rcx
+  8003ab:	00 00 00 
+  8003ae:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003b1:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003b4:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003b8:	eb cf                	jmp    800389 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003ba:	49 89 dc             	mov    %rbx,%r12
+  8003bd:	be 01 00 00 00       	mov    $0x1,%esi
+  8003c2:	eb c5                	jmp    800389 <vprintfmt+0x75>
+            padc = ch;
+  8003c4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003c8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003cb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003ce:	eb b9                	jmp    800389 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8003d6:	77 24                	ja     8003fc <vprintfmt+0xe8>
+  8003d8:	89 c1                	mov    %eax,%ecx
+  8003da:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003de:	83 c0 08             	add    $0x8,%eax
+  8003e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003e4:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003e7:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003ea:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003ee:	79 99                	jns    800389 <vprintfmt+0x75>
+                width = precision;
+  8003f0:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8003f4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003fa:	eb 8d                	jmp    800389 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003fc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800400:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800404:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800408:	eb da                	jmp    8003e4 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80040a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80040f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800413:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800419:	3c 39                	cmp    $0x39,%al
+  80041b:	77 1c                	ja     800439 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80041d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800421:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800425:	0f b6 c0             	movzbl %al,%eax
+  800428:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80042d:	0f b6 03             	movzbl (%rbx),%eax
+  800430:	3c 39                	cmp    $0x39,%al
+  800432:	76 e9                	jbe    80041d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800434:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800437:	eb b1                	jmp    8003ea <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800439:	49 89 dc             	mov    %rbx,%r12
+  80043c:	eb ac                	jmp    8003ea <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80043e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800441:	85 c9                	test   %ecx,%ecx
+  800443:	b8 00 00 00 00       	mov    $0x0,%eax
+  800448:	0f 49 c1             	cmovns %ecx,%eax
+  80044b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80044e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800451:	e9 33 ff ff ff       	jmp    800389 <vprintfmt+0x75>
+            lflag++;
+  800456:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800459:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80045c:	e9 28 ff ff ff       	jmp    800389 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800461:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800464:	83 f8 2f             	cmp    $0x2f,%eax
+  800467:	77 19                	ja     800482 <vprintfmt+0x16e>
+  800469:	89 c2                	mov    %eax,%edx
+  80046b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80046f:	83 c0 08             	add    $0x8,%eax
+  800472:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800475:	8b 3a                	mov    (%rdx),%edi
+  800477:	4c 89 ee             	mov    %r13,%rsi
+  80047a:	41 ff d6             	call   *%r14
+            break;
+  80047d:	e9 c3 fe ff ff       	jmp    800345 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800482:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800486:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80048a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80048e:	eb e5                	jmp    800475 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800490:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800493:	83 f8 2f             	cmp    $0x2f,%eax
+  800496:	77 5a                	ja     8004f2 <vprintfmt+0x1de>
+  800498:	89 c2                	mov    %eax,%edx
+  80049a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80049e:	83 c0 08             	add    $0x8,%eax
+  8004a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004a4:	8b 02                	mov    (%rdx),%eax
+  8004a6:	89 c1                	mov    %eax,%ecx
+  8004a8:	f7 d9                	neg    %ecx
+  8004aa:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004ad:	83 f9 15             	cmp    $0x15,%ecx
+  8004b0:	7f 4e                	jg     800500 <vprintfmt+0x1ec>
+  8004b2:	48 63 c1             	movslq %ecx,%rax
+  8004b5:	48 ba e0 2f 80 00 00 	movabs $0x802fe0,%rdx
+  8004bc:	00 00 00 
+  8004bf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004c3:	48 85 c0             	test   %rax,%rax
+  8004c6:	74 38                	je     800500 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004c8:	48 89 c1             	mov    %rax,%rcx
+  8004cb:	48 ba 99 31 80 00 00 	movabs $0x803199,%rdx
+  8004d2:	00 00 00 
+  8004d5:	4c 89 ee             	mov    %r13,%rsi
+  8004d8:	4c 89 f7             	mov    %r14,%rdi
+  8004db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e0:	49 b8 d7 02 80 00 00 	movabs $0x8002d7,%r8
+  8004e7:	00 00 00 
+  8004ea:	41 ff d0             	call   *%r8
+  8004ed:	e9 53 fe ff ff       	jmp    800345 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8004f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004fe:	eb a4                	jmp    8004a4 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800500:	48 ba 89 2b 80 00 00 	movabs $0x802b89,%rdx
+  800507:	00 00 00 
+  80050a:	4c 89 ee             	mov    %r13,%rsi
+  80050d:	4c 89 f7             	mov    %r14,%rdi
+  800510:	b8 00 00 00 00       	mov    $0x0,%eax
+  800515:	49 b8 d7 02 80 00 00 	movabs $0x8002d7,%r8
+  80051c:	00 00 00 
+  80051f:	41 ff d0             	call   *%r8
+  800522:	e9 1e fe ff ff       	jmp    800345 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800527:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80052a:	83 f8 2f             	cmp    $0x2f,%eax
+  80052d:	77 6c                	ja     80059b <vprintfmt+0x287>
+  80052f:	89 c2                	mov    %eax,%edx
+  800531:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800535:	83 c0 08             	add    $0x8,%eax
+  800538:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80053b:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80053e:	48 85 d2             	test   %rdx,%rdx
+  800541:	48 b8 82 2b 80 00 00 	movabs $0x802b82,%rax
+  800548:	00 00 00 
+  80054b:	48 0f 45 c2          	cmovne %rdx,%rax
+  80054f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800553:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800557:	7e 06                	jle    80055f <vprintfmt+0x24b>
+  800559:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80055d:	75 4a                	jne    8005a9 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80055f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800563:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800567:	0f b6 00             	movzbl (%rax),%eax
+  80056a:	84 c0                	test   %al,%al
+  80056c:	0f 85 9a 00 00 00    	jne    80060c <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800572:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800575:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800579:	85 c0                	test   %eax,%eax
+  80057b:	0f 8e c4 fd ff ff    	jle    800345 <vprintfmt+0x31>
+  800581:	4c 89 ee             	mov    %r13,%rsi
+  800584:	bf 20 00 00 00       	mov    $0x20,%edi
+  800589:	41 ff d6             	call   *%r14
+  80058c:	41 83 ec 01          	sub    $0x1,%r12d
+  800590:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800594:	75 eb                	jne    800581 <vprintfmt+0x26d>
+  800596:	e9 aa fd ff ff       	jmp    800345 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80059b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80059f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a7:	eb 92                	jmp    80053b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005a9:	49 63 f7             	movslq %r15d,%rsi
+  8005ac:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005b0:	48 b8 c6 0a 80 00 00 	movabs $0x800ac6,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+  8005bc:	48 89 c2             	mov    %rax,%rdx
+  8005bf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005c2:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005c4:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005c7:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005ca:	85 c0                	test   %eax,%eax
+  8005cc:	7e 91                	jle    80055f <vprintfmt+0x24b>
+  8005ce:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005d3:	4c 89 ee             	mov    %r13,%rsi
+  8005d6:	44 89 e7             	mov    %r12d,%edi
+  8005d9:	41 ff d6             	call   *%r14
+  8005dc:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005e0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005e3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005e6:	75 eb                	jne    8005d3 <vprintfmt+0x2bf>
+  8005e8:	e9 72 ff ff ff       	jmp    80055f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005ed:	0f b6 f8             	movzbl %al,%edi
+  8005f0:	4c 89 ee             	mov    %r13,%rsi
+  8005f3:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005f6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005fa:	49 83 c4 01          	add    $0x1,%r12
+  8005fe:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800604:	84 c0                	test   %al,%al
+  800606:	0f 84 66 ff ff ff    	je     800572 <vprintfmt+0x25e>
+  80060c:	45 85 ff             	test   %r15d,%r15d
+  80060f:	78 0a                	js     80061b <vprintfmt+0x307>
+  800611:	41 83 ef 01          	sub    $0x1,%r15d
+  800615:	0f 88 57 ff ff ff    	js     800572 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80061b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80061f:	74 cc                	je     8005ed <vprintfmt+0x2d9>
+  800621:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800624:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800629:	80 fa 5e             	cmp    $0x5e,%dl
+  80062c:	77 c2                	ja     8005f0 <vprintfmt+0x2dc>
+  80062e:	eb bd                	jmp    8005ed <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800630:	40 84 f6             	test   %sil,%sil
+  800633:	75 26                	jne    80065b <vprintfmt+0x347>
+    switch (lflag) {
+  800635:	85 d2                	test   %edx,%edx
+  800637:	74 59                	je     800692 <vprintfmt+0x37e>
+  800639:	83 fa 01             	cmp    $0x1,%edx
+  80063c:	74 7b                	je     8006b9 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80063e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800641:	83 f8 2f             	cmp    $0x2f,%eax
+  800644:	0f 87 96 00 00 00    	ja     8006e0 <vprintfmt+0x3cc>
+  80064a:	89 c2                	mov    %eax,%edx
+  80064c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800650:	83 c0 08             	add    $0x8,%eax
+  800653:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800656:	4c 8b 22             	mov    (%rdx),%r12
+  800659:	eb 17                	jmp    800672 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80065b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80065e:	83 f8 2f             	cmp    $0x2f,%eax
+  800661:	77 21                	ja     800684 <vprintfmt+0x370>
+  800663:	89 c2                	mov    %eax,%edx
+  800665:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800669:	83 c0 08             	add    $0x8,%eax
+  80066c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80066f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800672:	4d 85 e4             	test   %r12,%r12
+  800675:	78 7a                	js     8006f1 <vprintfmt+0x3dd>
+            num = i;
+  800677:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80067a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80067f:	e9 50 02 00 00       	jmp    8008d4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800684:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800688:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80068c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800690:	eb dd                	jmp    80066f <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800692:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800695:	83 f8 2f             	cmp    $0x2f,%eax
+  800698:	77 11                	ja     8006ab <vprintfmt+0x397>
+  80069a:	89 c2                	mov    %eax,%edx
+  80069c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a0:	83 c0 08             	add    $0x8,%eax
+  8006a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a6:	4c 63 22             	movslq (%rdx),%r12
+  8006a9:	eb c7                	jmp    800672 <vprintfmt+0x35e>
+  8006ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b7:	eb ed                	jmp    8006a6 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8006bf:	77 11                	ja     8006d2 <vprintfmt+0x3be>
+  8006c1:	89 c2                	mov    %eax,%edx
+  8006c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c7:	83 c0 08             	add    $0x8,%eax
+  8006ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006cd:	4c 8b 22             	mov    (%rdx),%r12
+  8006d0:	eb a0                	jmp    800672 <vprintfmt+0x35e>
+  8006d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006de:	eb ed                	jmp    8006cd <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ec:	e9 65 ff ff ff       	jmp    800656 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8006f1:	4c 89 ee             	mov    %r13,%rsi
+  8006f4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8006f9:	41 ff d6             	call   *%r14
+                i = -i;
+  8006fc:	49 f7 dc             	neg    %r12
+  8006ff:	e9 73 ff ff ff       	jmp    800677 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800704:	40 84 f6             	test   %sil,%sil
+  800707:	75 32                	jne    80073b <vprintfmt+0x427>
+    switch (lflag) {
+  800709:	85 d2                	test   %edx,%edx
+  80070b:	74 5d                	je     80076a <vprintfmt+0x456>
+  80070d:	83 fa 01             	cmp    $0x1,%edx
+  800710:	0f 84 82 00 00 00    	je     800798 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800716:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800719:	83 f8 2f             	cmp    $0x2f,%eax
+  80071c:	0f 87 a5 00 00 00    	ja     8007c7 <vprintfmt+0x4b3>
+  800722:	89 c2                	mov    %eax,%edx
+  800724:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800728:	83 c0 08             	add    $0x8,%eax
+  80072b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80072e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800731:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800736:	e9 99 01 00 00       	jmp    8008d4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80073b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073e:	83 f8 2f             	cmp    $0x2f,%eax
+  800741:	77 19                	ja     80075c <vprintfmt+0x448>
+  800743:	89 c2                	mov    %eax,%edx
+  800745:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800749:	83 c0 08             	add    $0x8,%eax
+  80074c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800752:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800757:	e9 78 01 00 00       	jmp    8008d4 <vprintfmt+0x5c0>
+  80075c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800760:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800764:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800768:	eb e5                	jmp    80074f <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80076a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076d:	83 f8 2f             	cmp    $0x2f,%eax
+  800770:	77 18                	ja     80078a <vprintfmt+0x476>
+  800772:	89 c2                	mov    %eax,%edx
+  800774:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800778:	83 c0 08             	add    $0x8,%eax
+  80077b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800780:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800785:	e9 4a 01 00 00       	jmp    8008d4 <vprintfmt+0x5c0>
+  80078a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800792:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800796:	eb e6                	jmp    80077e <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800798:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079b:	83 f8 2f             	cmp    $0x2f,%eax
+  80079e:	77 19                	ja     8007b9 <vprintfmt+0x4a5>
+  8007a0:	89 c2                	mov    %eax,%edx
+  8007a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a6:	83 c0 08             	add    $0x8,%eax
+  8007a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ac:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007af:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007b4:	e9 1b 01 00 00       	jmp    8008d4 <vprintfmt+0x5c0>
+  8007b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c5:	eb e5                	jmp    8007ac <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d3:	e9 56 ff ff ff       	jmp    80072e <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007d8:	40 84 f6             	test   %sil,%sil
+  8007db:	75 2e                	jne    80080b <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007dd:	85 d2                	test   %edx,%edx
+  8007df:	74 59                	je     80083a <vprintfmt+0x526>
+  8007e1:	83 fa 01             	cmp    $0x1,%edx
+  8007e4:	74 7f                	je     800865 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ec:	0f 87 9f 00 00 00    	ja     800891 <vprintfmt+0x57d>
+  8007f2:	89 c2                	mov    %eax,%edx
+  8007f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f8:	83 c0 08             	add    $0x8,%eax
+  8007fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007fe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800801:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800806:	e9 c9 00 00 00       	jmp    8008d4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80080b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080e:	83 f8 2f             	cmp    $0x2f,%eax
+  800811:	77 19                	ja     80082c <vprintfmt+0x518>
+  800813:	89 c2                	mov    %eax,%edx
+  800815:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800819:	83 c0 08             	add    $0x8,%eax
+  80081c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800822:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800827:	e9 a8 00 00 00       	jmp    8008d4 <vprintfmt+0x5c0>
+  80082c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800830:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800834:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800838:	eb e5                	jmp    80081f <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80083a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083d:	83 f8 2f             	cmp    $0x2f,%eax
+  800840:	77 15                	ja     800857 <vprintfmt+0x543>
+  800842:	89 c2                	mov    %eax,%edx
+  800844:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800848:	83 c0 08             	add    $0x8,%eax
+  80084b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084e:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800850:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800855:	eb 7d                	jmp    8008d4 <vprintfmt+0x5c0>
+  800857:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800863:	eb e9                	jmp    80084e <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800865:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800868:	83 f8 2f             	cmp    $0x2f,%eax
+  80086b:	77 16                	ja     800883 <vprintfmt+0x56f>
+  80086d:	89 c2                	mov    %eax,%edx
+  80086f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800873:	83 c0 08             	add    $0x8,%eax
+  800876:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800879:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80087c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800881:	eb 51                	jmp    8008d4 <vprintfmt+0x5c0>
+  800883:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800887:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088f:	eb e8                	jmp    800879 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800891:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800895:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800899:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089d:	e9 5c ff ff ff       	jmp    8007fe <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008a2:	4c 89 ee             	mov    %r13,%rsi
+  8008a5:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008aa:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008ad:	4c 89 ee             	mov    %r13,%rsi
+  8008b0:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008b5:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8008be:	77 47                	ja     800907 <vprintfmt+0x5f3>
+  8008c0:	89 c2                	mov    %eax,%edx
+  8008c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c6:	83 c0 08             	add    $0x8,%eax
+  8008c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008cc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008cf:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8008d8:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008dc:	0f 94 c0             	sete   %al
+  8008df:	0f b6 c0             	movzbl %al,%eax
+  8008e2:	50                   	push   %rax
+  8008e3:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008e8:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008ec:	4c 89 ee             	mov    %r13,%rsi
+  8008ef:	4c 89 f7             	mov    %r14,%rdi
+  8008f2:	48 b8 09 02 80 00 00 	movabs $0x800209,%rax
+  8008f9:	00 00 00 
+  8008fc:	ff d0                	call   *%rax
+            break;
+  8008fe:	48 83 c4 10          	add    $0x10,%rsp
+  800902:	e9 3e fa ff ff       	jmp    800345 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800907:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80090f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800913:	eb b7                	jmp    8008cc <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800915:	40 84 f6             	test   %sil,%sil
+  800918:	75 2b                	jne    800945 <vprintfmt+0x631>
+    switch (lflag) {
+  80091a:	85 d2                	test   %edx,%edx
+  80091c:	74 56                	je     800974 <vprintfmt+0x660>
+  80091e:	83 fa 01             	cmp    $0x1,%edx
+  800921:	74 7f                	je     8009a2 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800923:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800926:	83 f8 2f             	cmp    $0x2f,%eax
+  800929:	0f 87 a2 00 00 00    	ja     8009d1 <vprintfmt+0x6bd>
+  80092f:	89 c2                	mov    %eax,%edx
+  800931:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800935:	83 c0 08             	add    $0x8,%eax
+  800938:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80093e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800943:	eb 8f                	jmp    8008d4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800945:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800948:	83 f8 2f             	cmp    $0x2f,%eax
+  80094b:	77 19                	ja     800966 <vprintfmt+0x652>
+  80094d:	89 c2                	mov    %eax,%edx
+  80094f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800953:	83 c0 08             	add    $0x8,%eax
+  800956:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800959:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80095c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800961:	e9 6e ff ff ff       	jmp    8008d4 <vprintfmt+0x5c0>
+  800966:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800972:	eb e5                	jmp    800959 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800974:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800977:	83 f8 2f             	cmp    $0x2f,%eax
+  80097a:	77 18                	ja     800994 <vprintfmt+0x680>
+  80097c:	89 c2                	mov    %eax,%edx
+  80097e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800982:	83 c0 08             	add    $0x8,%eax
+  800985:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800988:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80098a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80098f:	e9 40 ff ff ff       	jmp    8008d4 <vprintfmt+0x5c0>
+  800994:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800998:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a0:	eb e6                	jmp    800988 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a8:	77 19                	ja     8009c3 <vprintfmt+0x6af>
+  8009aa:	89 c2                	mov    %eax,%edx
+  8009ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b0:	83 c0 08             	add    $0x8,%eax
+  8009b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009b9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009be:	e9 11 ff ff ff       	jmp    8008d4 <vprintfmt+0x5c0>
+  8009c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cf:	eb e5                	jmp    8009b6 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009d1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009dd:	e9 59 ff ff ff       	jmp    80093b <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009e2:	4c 89 ee             	mov    %r13,%rsi
+  8009e5:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009ea:	41 ff d6             	call   *%r14
+            break;
+  8009ed:	e9 53 f9 ff ff       	jmp    800345 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8009f2:	4c 89 ee             	mov    %r13,%rsi
+  8009f5:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009fa:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8009fd:	48 83 eb 01          	sub    $0x1,%rbx
+  800a01:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a05:	75 f6                	jne    8009fd <vprintfmt+0x6e9>
+  800a07:	e9 39 f9 ff ff       	jmp    800345 <vprintfmt+0x31>
+}
+  800a0c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a10:	5b                   	pop    %rbx
+  800a11:	41 5c                	pop    %r12
+  800a13:	41 5d                	pop    %r13
+  800a15:	41 5e                	pop    %r14
+  800a17:	41 5f                	pop    %r15
+  800a19:	5d                   	pop    %rbp
+  800a1a:	c3                   	ret
+
+0000000000800a1b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a1b:	55                   	push   %rbp
+  800a1c:	48 89 e5             	mov    %rsp,%rbp
+  800a1f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a23:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a27:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a2c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a30:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a37:	48 85 ff             	test   %rdi,%rdi
+  800a3a:	74 2b                	je     800a67 <vsnprintf+0x4c>
+  800a3c:	48 85 f6             	test   %rsi,%rsi
+  800a3f:	74 26                	je     800a67 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a41:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a45:	48 bf bf 02 80 00 00 	movabs $0x8002bf,%rdi
+  800a4c:	00 00 00 
+  800a4f:	48 b8 14 03 80 00 00 	movabs $0x800314,%rax
+  800a56:	00 00 00 
+  800a59:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a5f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a62:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a65:	c9                   	leave
+  800a66:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a6c:	eb f7                	jmp    800a65 <vsnprintf+0x4a>
+
+0000000000800a6e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a6e:	55                   	push   %rbp
+  800a6f:	48 89 e5             	mov    %rsp,%rbp
+  800a72:	48 83 ec 50          	sub    $0x50,%rsp
+  800a76:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a7a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a7e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a82:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a89:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a91:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800a95:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800a99:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800a9d:	48 b8 1b 0a 80 00 00 	movabs $0x800a1b,%rax
+  800aa4:	00 00 00 
+  800aa7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800aa9:	c9                   	leave
+  800aaa:	c3                   	ret
+
+0000000000800aab <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800aab:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800aae:	74 10                	je     800ac0 <strlen+0x15>
+    size_t n = 0;
+  800ab0:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ab5:	48 83 c0 01          	add    $0x1,%rax
+  800ab9:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800abd:	75 f6                	jne    800ab5 <strlen+0xa>
+  800abf:	c3                   	ret
+    size_t n = 0;
+  800ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ac5:	c3                   	ret
+
+0000000000800ac6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ac6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ac9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ace:	48 85 f6             	test   %rsi,%rsi
+  800ad1:	74 11                	je     800ae4 <strnlen+0x1e>
+  800ad3:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ad7:	74 0c                	je     800ae5 <strnlen+0x1f>
+  800ad9:	48 83 c2 01          	add    $0x1,%rdx
+  800add:	48 39 d0             	cmp    %rdx,%rax
+  800ae0:	75 f1                	jne    800ad3 <strnlen+0xd>
+  800ae2:	eb 04                	jmp    800ae8 <strnlen+0x22>
+  800ae4:	c3                   	ret
+  800ae5:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ae8:	c3                   	ret
+
+0000000000800ae9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ae9:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800aec:	ba 00 00 00 00       	mov    $0x0,%edx
+  800af1:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800af5:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800af8:	48 83 c2 01          	add    $0x1,%rdx
+  800afc:	84 c9                	test   %cl,%cl
+  800afe:	75 f1                	jne    800af1 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b00:	c3                   	ret
+
+0000000000800b01 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b01:	55                   	push   %rbp
+  800b02:	48 89 e5             	mov    %rsp,%rbp
+  800b05:	41 54                	push   %r12
+  800b07:	53                   	push   %rbx
+  800b08:	48 89 fb             	mov    %rdi,%rbx
+  800b0b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b0e:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  800b15:	00 00 00 
+  800b18:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b1a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b1e:	4c 89 e6             	mov    %r12,%rsi
+  800b21:	48 b8 e9 0a 80 00 00 	movabs $0x800ae9,%rax
+  800b28:	00 00 00 
+  800b2b:	ff d0                	call   *%rax
+    return dst;
+}
+  800b2d:	48 89 d8             	mov    %rbx,%rax
+  800b30:	5b                   	pop    %rbx
+  800b31:	41 5c                	pop    %r12
+  800b33:	5d                   	pop    %rbp
+  800b34:	c3                   	ret
+
+0000000000800b35 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b35:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b38:	48 85 d2             	test   %rdx,%rdx
+  800b3b:	74 1f                	je     800b5c <strncpy+0x27>
+  800b3d:	48 01 fa             	add    %rdi,%rdx
+  800b40:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b43:	48 83 c1 01          	add    $0x1,%rcx
+  800b47:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b4b:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b4f:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b53:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b57:	48 39 ca             	cmp    %rcx,%rdx
+  800b5a:	75 e7                	jne    800b43 <strncpy+0xe>
+    }
+    return ret;
+}
+  800b5c:	c3                   	ret
+
+0000000000800b5d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b5d:	48 89 f8             	mov    %rdi,%rax
+  800b60:	48 85 d2             	test   %rdx,%rdx
+  800b63:	74 24                	je     800b89 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b65:	48 83 ea 01          	sub    $0x1,%rdx
+  800b69:	74 1b                	je     800b86 <strlcpy+0x29>
+  800b6b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b6f:	0f b6 16             	movzbl (%rsi),%edx
+  800b72:	84 d2                	test   %dl,%dl
+  800b74:	74 10                	je     800b86 <strlcpy+0x29>
+            *dst++ = *src++;
+  800b76:	48 83 c6 01          	add    $0x1,%rsi
+  800b7a:	48 83 c0 01          	add    $0x1,%rax
+  800b7e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b81:	48 39 c8             	cmp    %rcx,%rax
+  800b84:	75 e9                	jne    800b6f <strlcpy+0x12>
+        *dst = '\0';
+  800b86:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800b89:	48 29 f8             	sub    %rdi,%rax
+}
+  800b8c:	c3                   	ret
+
+0000000000800b8d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800b8d:	0f b6 07             	movzbl (%rdi),%eax
+  800b90:	84 c0                	test   %al,%al
+  800b92:	74 13                	je     800ba7 <strcmp+0x1a>
+  800b94:	38 06                	cmp    %al,(%rsi)
+  800b96:	75 0f                	jne    800ba7 <strcmp+0x1a>
+  800b98:	48 83 c7 01          	add    $0x1,%rdi
+  800b9c:	48 83 c6 01          	add    $0x1,%rsi
+  800ba0:	0f b6 07             	movzbl (%rdi),%eax
+  800ba3:	84 c0                	test   %al,%al
+  800ba5:	75 ed                	jne    800b94 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ba7:	0f b6 c0             	movzbl %al,%eax
+  800baa:	0f b6 16             	movzbl (%rsi),%edx
+  800bad:	29 d0                	sub    %edx,%eax
+}
+  800baf:	c3                   	ret
+
+0000000000800bb0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bb0:	48 85 d2             	test   %rdx,%rdx
+  800bb3:	74 1f                	je     800bd4 <strncmp+0x24>
+  800bb5:	0f b6 07             	movzbl (%rdi),%eax
+  800bb8:	84 c0                	test   %al,%al
+  800bba:	74 1e                	je     800bda <strncmp+0x2a>
+  800bbc:	3a 06                	cmp    (%rsi),%al
+  800bbe:	75 1a                	jne    800bda <strncmp+0x2a>
+  800bc0:	48 83 c7 01          	add    $0x1,%rdi
+  800bc4:	48 83 c6 01          	add    $0x1,%rsi
+  800bc8:	48 83 ea 01          	sub    $0x1,%rdx
+  800bcc:	75 e7                	jne    800bb5 <strncmp+0x5>
+
+    if (!n) return 0;
+  800bce:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd3:	c3                   	ret
+  800bd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd9:	c3                   	ret
+  800bda:	48 85 d2             	test   %rdx,%rdx
+  800bdd:	74 09                	je     800be8 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bdf:	0f b6 07             	movzbl (%rdi),%eax
+  800be2:	0f b6 16             	movzbl (%rsi),%edx
+  800be5:	29 d0                	sub    %edx,%eax
+  800be7:	c3                   	ret
+    if (!n) return 0;
+  800be8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bed:	c3                   	ret
+
+0000000000800bee <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800bee:	0f b6 17             	movzbl (%rdi),%edx
+  800bf1:	84 d2                	test   %dl,%dl
+  800bf3:	74 18                	je     800c0d <strchr+0x1f>
+        if (*str == c) {
+  800bf5:	0f be d2             	movsbl %dl,%edx
+  800bf8:	39 f2                	cmp    %esi,%edx
+  800bfa:	74 17                	je     800c13 <strchr+0x25>
+    for (; *str; str++) {
+  800bfc:	48 83 c7 01          	add    $0x1,%rdi
+  800c00:	0f b6 17             	movzbl (%rdi),%edx
+  800c03:	84 d2                	test   %dl,%dl
+  800c05:	75 ee                	jne    800bf5 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c07:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c0c:	c3                   	ret
+  800c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c12:	c3                   	ret
+  800c13:	48 89 f8             	mov    %rdi,%rax
+}
+  800c16:	c3                   	ret
+
+0000000000800c17 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c17:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c1a:	0f b6 17             	movzbl (%rdi),%edx
+  800c1d:	84 d2                	test   %dl,%dl
+  800c1f:	74 13                	je     800c34 <strfind+0x1d>
+  800c21:	0f be d2             	movsbl %dl,%edx
+  800c24:	39 f2                	cmp    %esi,%edx
+  800c26:	74 0b                	je     800c33 <strfind+0x1c>
+  800c28:	48 83 c0 01          	add    $0x1,%rax
+  800c2c:	0f b6 10             	movzbl (%rax),%edx
+  800c2f:	84 d2                	test   %dl,%dl
+  800c31:	75 ee                	jne    800c21 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c33:	c3                   	ret
+  800c34:	c3                   	ret
+
+0000000000800c35 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c35:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c38:	48 89 f8             	mov    %rdi,%rax
+  800c3b:	48 f7 d8             	neg    %rax
+  800c3e:	83 e0 07             	and    $0x7,%eax
+  800c41:	49 89 d1             	mov    %rdx,%r9
+  800c44:	49 29 c1             	sub    %rax,%r9
+  800c47:	78 36                	js     800c7f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c49:	40 0f b6 c6          	movzbl %sil,%eax
+  800c4d:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c54:	01 01 01 
+  800c57:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c5b:	40 f6 c7 07          	test   $0x7,%dil
+  800c5f:	75 38                	jne    800c99 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c61:	4c 89 c9             	mov    %r9,%rcx
+  800c64:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c68:	74 0c                	je     800c76 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c6a:	fc                   	cld
+  800c6b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c6e:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c72:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c76:	4d 85 c9             	test   %r9,%r9
+  800c79:	75 45                	jne    800cc0 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c7b:	4c 89 c0             	mov    %r8,%rax
+  800c7e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c7f:	48 85 d2             	test   %rdx,%rdx
+  800c82:	74 f7                	je     800c7b <memset+0x46>
+  800c84:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c87:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800c8a:	48 83 c0 01          	add    $0x1,%rax
+  800c8e:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800c92:	48 39 c2             	cmp    %rax,%rdx
+  800c95:	75 f3                	jne    800c8a <memset+0x55>
+  800c97:	eb e2                	jmp    800c7b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800c99:	40 f6 c7 01          	test   $0x1,%dil
+  800c9d:	74 06                	je     800ca5 <memset+0x70>
+  800c9f:	88 07                	mov    %al,(%rdi)
+  800ca1:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ca5:	40 f6 c7 02          	test   $0x2,%dil
+  800ca9:	74 07                	je     800cb2 <memset+0x7d>
+  800cab:	66 89 07             	mov    %ax,(%rdi)
+  800cae:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cb2:	40 f6 c7 04          	test   $0x4,%dil
+  800cb6:	74 a9                	je     800c61 <memset+0x2c>
+  800cb8:	89 07                	mov    %eax,(%rdi)
+  800cba:	48 83 c7 04          	add    $0x4,%rdi
+  800cbe:	eb a1                	jmp    800c61 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cc0:	41 f6 c1 04          	test   $0x4,%r9b
+  800cc4:	74 06                	je     800ccc <memset+0x97>
+  800cc6:	89 07                	mov    %eax,(%rdi)
+  800cc8:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ccc:	41 f6 c1 02          	test   $0x2,%r9b
+  800cd0:	74 07                	je     800cd9 <memset+0xa4>
+  800cd2:	66 89 07             	mov    %ax,(%rdi)
+  800cd5:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800cd9:	41 f6 c1 01          	test   $0x1,%r9b
+  800cdd:	74 9c                	je     800c7b <memset+0x46>
+  800cdf:	88 07                	mov    %al,(%rdi)
+  800ce1:	eb 98                	jmp    800c7b <memset+0x46>
+
+0000000000800ce3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ce3:	48 89 f8             	mov    %rdi,%rax
+  800ce6:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ce9:	48 39 fe             	cmp    %rdi,%rsi
+  800cec:	73 3b                	jae    800d29 <memmove+0x46>
+  800cee:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800cf2:	48 39 d7             	cmp    %rdx,%rdi
+  800cf5:	73 32                	jae    800d29 <memmove+0x46>
+        s += n;
+        d += n;
+  800cf7:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800cfb:	48 89 d6             	mov    %rdx,%rsi
+  800cfe:	48 09 fe             	or     %rdi,%rsi
+  800d01:	48 09 ce             	or     %rcx,%rsi
+  800d04:	40 f6 c6 07          	test   $0x7,%sil
+  800d08:	75 12                	jne    800d1c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d0a:	48 83 ef 08          	sub    $0x8,%rdi
+  800d0e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d12:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d16:	fd                   	std
+  800d17:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d1a:	fc                   	cld
+  800d1b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d1c:	48 83 ef 01          	sub    $0x1,%rdi
+  800d20:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d24:	fd                   	std
+  800d25:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d27:	eb f1                	jmp    800d1a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d29:	48 89 f2             	mov    %rsi,%rdx
+  800d2c:	48 09 c2             	or     %rax,%rdx
+  800d2f:	48 09 ca             	or     %rcx,%rdx
+  800d32:	f6 c2 07             	test   $0x7,%dl
+  800d35:	75 0c                	jne    800d43 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d37:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d3b:	48 89 c7             	mov    %rax,%rdi
+  800d3e:	fc                   	cld
+  800d3f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d42:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d43:	48 89 c7             	mov    %rax,%rdi
+  800d46:	fc                   	cld
+  800d47:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d49:	c3                   	ret
+
+0000000000800d4a <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d4a:	55                   	push   %rbp
+  800d4b:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d4e:	48 b8 e3 0c 80 00 00 	movabs $0x800ce3,%rax
+  800d55:	00 00 00 
+  800d58:	ff d0                	call   *%rax
+}
+  800d5a:	5d                   	pop    %rbp
+  800d5b:	c3                   	ret
+
+0000000000800d5c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d5c:	55                   	push   %rbp
+  800d5d:	48 89 e5             	mov    %rsp,%rbp
+  800d60:	41 57                	push   %r15
+  800d62:	41 56                	push   %r14
+  800d64:	41 55                	push   %r13
+  800d66:	41 54                	push   %r12
+  800d68:	53                   	push   %rbx
+  800d69:	48 83 ec 08          	sub    $0x8,%rsp
+  800d6d:	49 89 fe             	mov    %rdi,%r14
+  800d70:	49 89 f7             	mov    %rsi,%r15
+  800d73:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d76:	48 89 f7             	mov    %rsi,%rdi
+  800d79:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  800d80:	00 00 00 
+  800d83:	ff d0                	call   *%rax
+  800d85:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d88:	48 89 de             	mov    %rbx,%rsi
+  800d8b:	4c 89 f7             	mov    %r14,%rdi
+  800d8e:	48 b8 c6 0a 80 00 00 	movabs $0x800ac6,%rax
+  800d95:	00 00 00 
+  800d98:	ff d0                	call   *%rax
+  800d9a:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800d9d:	48 39 c3             	cmp    %rax,%rbx
+  800da0:	74 36                	je     800dd8 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800da2:	48 89 d8             	mov    %rbx,%rax
+  800da5:	4c 29 e8             	sub    %r13,%rax
+  800da8:	49 39 c4             	cmp    %rax,%r12
+  800dab:	73 31                	jae    800dde <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800dad:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800db2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800db6:	4c 89 fe             	mov    %r15,%rsi
+  800db9:	48 b8 4a 0d 80 00 00 	movabs $0x800d4a,%rax
+  800dc0:	00 00 00 
+  800dc3:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dc5:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800dc9:	48 83 c4 08          	add    $0x8,%rsp
+  800dcd:	5b                   	pop    %rbx
+  800dce:	41 5c                	pop    %r12
+  800dd0:	41 5d                	pop    %r13
+  800dd2:	41 5e                	pop    %r14
+  800dd4:	41 5f                	pop    %r15
+  800dd6:	5d                   	pop    %rbp
+  800dd7:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800dd8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ddc:	eb eb                	jmp    800dc9 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800dde:	48 83 eb 01          	sub    $0x1,%rbx
+  800de2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800de6:	48 89 da             	mov    %rbx,%rdx
+  800de9:	4c 89 fe             	mov    %r15,%rsi
+  800dec:	48 b8 4a 0d 80 00 00 	movabs $0x800d4a,%rax
+  800df3:	00 00 00 
+  800df6:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800df8:	49 01 de             	add    %rbx,%r14
+  800dfb:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e00:	eb c3                	jmp    800dc5 <strlcat+0x69>
+
+0000000000800e02 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e02:	48 85 d2             	test   %rdx,%rdx
+  800e05:	74 2d                	je     800e34 <memcmp+0x32>
+  800e07:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e0c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e10:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e15:	44 38 c1             	cmp    %r8b,%cl
+  800e18:	75 0f                	jne    800e29 <memcmp+0x27>
+    while (n-- > 0) {
+  800e1a:	48 83 c0 01          	add    $0x1,%rax
+  800e1e:	48 39 c2             	cmp    %rax,%rdx
+  800e21:	75 e9                	jne    800e0c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e28:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e29:	0f b6 c1             	movzbl %cl,%eax
+  800e2c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e30:	44 29 c0             	sub    %r8d,%eax
+  800e33:	c3                   	ret
+    return 0;
+  800e34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e39:	c3                   	ret
+
+0000000000800e3a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e3a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e3e:	48 39 c7             	cmp    %rax,%rdi
+  800e41:	73 0f                	jae    800e52 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e43:	40 38 37             	cmp    %sil,(%rdi)
+  800e46:	74 0e                	je     800e56 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e48:	48 83 c7 01          	add    $0x1,%rdi
+  800e4c:	48 39 f8             	cmp    %rdi,%rax
+  800e4f:	75 f2                	jne    800e43 <memfind+0x9>
+  800e51:	c3                   	ret
+  800e52:	48 89 f8             	mov    %rdi,%rax
+  800e55:	c3                   	ret
+  800e56:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e59:	c3                   	ret
+
+0000000000800e5a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e5a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e5d:	0f b6 37             	movzbl (%rdi),%esi
+  800e60:	40 80 fe 20          	cmp    $0x20,%sil
+  800e64:	74 06                	je     800e6c <strtol+0x12>
+  800e66:	40 80 fe 09          	cmp    $0x9,%sil
+  800e6a:	75 13                	jne    800e7f <strtol+0x25>
+  800e6c:	48 83 c7 01          	add    $0x1,%rdi
+  800e70:	0f b6 37             	movzbl (%rdi),%esi
+  800e73:	40 80 fe 20          	cmp    $0x20,%sil
+  800e77:	74 f3                	je     800e6c <strtol+0x12>
+  800e79:	40 80 fe 09          	cmp    $0x9,%sil
+  800e7d:	74 ed                	je     800e6c <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e7f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e82:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e85:	3c 01                	cmp    $0x1,%al
+  800e87:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800e8b:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800e91:	75 0f                	jne    800ea2 <strtol+0x48>
+  800e93:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800e96:	74 14                	je     800eac <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800e98:	85 d2                	test   %edx,%edx
+  800e9a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e9f:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ea2:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ea7:	4c 63 ca             	movslq %edx,%r9
+  800eaa:	eb 36                	jmp    800ee2 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eac:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800eb0:	74 0f                	je     800ec1 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800eb2:	85 d2                	test   %edx,%edx
+  800eb4:	75 ec                	jne    800ea2 <strtol+0x48>
+        s++;
+  800eb6:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800eba:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ebf:	eb e1                	jmp    800ea2 <strtol+0x48>
+        s += 2;
+  800ec1:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ec5:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800eca:	eb d6                	jmp    800ea2 <strtol+0x48>
+            dig -= '0';
+  800ecc:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ecf:	44 0f b6 c1          	movzbl %cl,%r8d
+  800ed3:	41 39 d0             	cmp    %edx,%r8d
+  800ed6:	7d 21                	jge    800ef9 <strtol+0x9f>
+        val = val * base + dig;
+  800ed8:	49 0f af c1          	imul   %r9,%rax
+  800edc:	0f b6 c9             	movzbl %cl,%ecx
+  800edf:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800ee2:	48 83 c7 01          	add    $0x1,%rdi
+  800ee6:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800eea:	80 f9 39             	cmp    $0x39,%cl
+  800eed:	76 dd                	jbe    800ecc <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800eef:	80 f9 7b             	cmp    $0x7b,%cl
+  800ef2:	77 05                	ja     800ef9 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800ef4:	83 e9 57             	sub    $0x57,%ecx
+  800ef7:	eb d6                	jmp    800ecf <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800ef9:	4d 85 d2             	test   %r10,%r10
+  800efc:	74 03                	je     800f01 <strtol+0xa7>
+  800efe:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f01:	48 89 c2             	mov    %rax,%rdx
+  800f04:	48 f7 da             	neg    %rdx
+  800f07:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f0b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f0f:	c3                   	ret
+
+0000000000800f10 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f10:	55                   	push   %rbp
+  800f11:	48 89 e5             	mov    %rsp,%rbp
+  800f14:	53                   	push   %rbx
+  800f15:	48 89 fa             	mov    %rdi,%rdx
+  800f18:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f25:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f2a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f2f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f35:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f37:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f3b:	c9                   	leave
+  800f3c:	c3                   	ret
+
+0000000000800f3d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f3d:	55                   	push   %rbp
+  800f3e:	48 89 e5             	mov    %rsp,%rbp
+  800f41:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f42:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f47:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f56:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f5b:	be 00 00 00 00       	mov    $0x0,%esi
+  800f60:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f66:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f68:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f6c:	c9                   	leave
+  800f6d:	c3                   	ret
+
+0000000000800f6e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800f6e:	55                   	push   %rbp
+  800f6f:	48 89 e5             	mov    %rsp,%rbp
+  800f72:	53                   	push   %rbx
+  800f73:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f77:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800f7a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f89:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f8e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f93:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f99:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800f9b:	48 85 c0             	test   %rax,%rax
+  800f9e:	7f 06                	jg     800fa6 <sys_env_destroy+0x38>
+}
+  800fa0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fa4:	c9                   	leave
+  800fa5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fa6:	49 89 c0             	mov    %rax,%r8
+  800fa9:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fae:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  800fb5:	00 00 00 
+  800fb8:	be 26 00 00 00       	mov    $0x26,%esi
+  800fbd:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  800fc4:	00 00 00 
+  800fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fcc:	49 b9 0e 29 80 00 00 	movabs $0x80290e,%r9
+  800fd3:	00 00 00 
+  800fd6:	41 ff d1             	call   *%r9
+
+0000000000800fd9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800fd9:	55                   	push   %rbp
+  800fda:	48 89 e5             	mov    %rsp,%rbp
+  800fdd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800fde:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fe3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ff7:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801002:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801004:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801008:	c9                   	leave
+  801009:	c3                   	ret
+
+000000000080100a <sys_yield>:
+
+void
+sys_yield(void) {
+  80100a:	55                   	push   %rbp
+  80100b:	48 89 e5             	mov    %rsp,%rbp
+  80100e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80100f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801014:	ba 00 00 00 00       	mov    $0x0,%edx
+  801019:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80101e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801023:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801028:	be 00 00 00 00       	mov    $0x0,%esi
+  80102d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801033:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801035:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801039:	c9                   	leave
+  80103a:	c3                   	ret
+
+000000000080103b <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80103b:	55                   	push   %rbp
+  80103c:	48 89 e5             	mov    %rsp,%rbp
+  80103f:	53                   	push   %rbx
+  801040:	48 89 fa             	mov    %rdi,%rdx
+  801043:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801046:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80104b:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801052:	00 00 00 
+  801055:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80105a:	be 00 00 00 00       	mov    $0x0,%esi
+  80105f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801065:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801067:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80106b:	c9                   	leave
+  80106c:	c3                   	ret
+
+000000000080106d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80106d:	55                   	push   %rbp
+  80106e:	48 89 e5             	mov    %rsp,%rbp
+  801071:	53                   	push   %rbx
+  801072:	49 89 f8             	mov    %rdi,%r8
+  801075:	48 89 d3             	mov    %rdx,%rbx
+  801078:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80107b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801080:	4c 89 c2             	mov    %r8,%rdx
+  801083:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801086:	be 00 00 00 00       	mov    $0x0,%esi
+  80108b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801091:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801093:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801097:	c9                   	leave
+  801098:	c3                   	ret
+
+0000000000801099 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801099:	55                   	push   %rbp
+  80109a:	48 89 e5             	mov    %rsp,%rbp
+  80109d:	53                   	push   %rbx
+  80109e:	48 83 ec 08          	sub    $0x8,%rsp
+  8010a2:	89 f8                	mov    %edi,%eax
+  8010a4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010a7:	48 63 f9             	movslq %ecx,%rdi
+  8010aa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010ad:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010b2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010c2:	48 85 c0             	test   %rax,%rax
+  8010c5:	7f 06                	jg     8010cd <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8010c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010cb:	c9                   	leave
+  8010cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010cd:	49 89 c0             	mov    %rax,%r8
+  8010d0:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8010d5:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8010dc:	00 00 00 
+  8010df:	be 26 00 00 00       	mov    $0x26,%esi
+  8010e4:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  8010eb:	00 00 00 
+  8010ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f3:	49 b9 0e 29 80 00 00 	movabs $0x80290e,%r9
+  8010fa:	00 00 00 
+  8010fd:	41 ff d1             	call   *%r9
+
+0000000000801100 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801100:	55                   	push   %rbp
+  801101:	48 89 e5             	mov    %rsp,%rbp
+  801104:	53                   	push   %rbx
+  801105:	48 83 ec 08          	sub    $0x8,%rsp
+  801109:	89 f8                	mov    %edi,%eax
+  80110b:	49 89 f2             	mov    %rsi,%r10
+  80110e:	48 89 cf             	mov    %rcx,%rdi
+  801111:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801114:	48 63 da             	movslq %edx,%rbx
+  801117:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80111a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80111f:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801122:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801125:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801127:	48 85 c0             	test   %rax,%rax
+  80112a:	7f 06                	jg     801132 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80112c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801130:	c9                   	leave
+  801131:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801132:	49 89 c0             	mov    %rax,%r8
+  801135:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80113a:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  801141:	00 00 00 
+  801144:	be 26 00 00 00       	mov    $0x26,%esi
+  801149:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  801150:	00 00 00 
+  801153:	b8 00 00 00 00       	mov    $0x0,%eax
+  801158:	49 b9 0e 29 80 00 00 	movabs $0x80290e,%r9
+  80115f:	00 00 00 
+  801162:	41 ff d1             	call   *%r9
+
+0000000000801165 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801165:	55                   	push   %rbp
+  801166:	48 89 e5             	mov    %rsp,%rbp
+  801169:	53                   	push   %rbx
+  80116a:	48 83 ec 08          	sub    $0x8,%rsp
+  80116e:	48 89 f1             	mov    %rsi,%rcx
+  801171:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801174:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801177:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80117c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801181:	be 00 00 00 00       	mov    $0x0,%esi
+  801186:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80118c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80118e:	48 85 c0             	test   %rax,%rax
+  801191:	7f 06                	jg     801199 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801193:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801197:	c9                   	leave
+  801198:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801199:	49 89 c0             	mov    %rax,%r8
+  80119c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011a1:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8011a8:	00 00 00 
+  8011ab:	be 26 00 00 00       	mov    $0x26,%esi
+  8011b0:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  8011b7:	00 00 00 
+  8011ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011bf:	49 b9 0e 29 80 00 00 	movabs $0x80290e,%r9
+  8011c6:	00 00 00 
+  8011c9:	41 ff d1             	call   *%r9
+
+00000000008011cc <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8011cc:	55                   	push   %rbp
+  8011cd:	48 89 e5             	mov    %rsp,%rbp
+  8011d0:	53                   	push   %rbx
+  8011d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8011d5:	89 f8                	mov    %edi,%eax
+  8011d7:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8011da:	48 63 f9             	movslq %ecx,%rdi
+  8011dd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011e0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011e5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011f5:	48 85 c0             	test   %rax,%rax
+  8011f8:	7f 06                	jg     801200 <sys_region_advise+0x34>
+}
+  8011fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011fe:	c9                   	leave
+  8011ff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801200:	49 89 c0             	mov    %rax,%r8
+  801203:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801208:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  80120f:	00 00 00 
+  801212:	be 26 00 00 00       	mov    $0x26,%esi
+  801217:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  80121e:	00 00 00 
+  801221:	b8 00 00 00 00       	mov    $0x0,%eax
+  801226:	49 b9 0e 29 80 00 00 	movabs $0x80290e,%r9
+  80122d:	00 00 00 
+  801230:	41 ff d1             	call   *%r9
+
+0000000000801233 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801233:	55                   	push   %rbp
+  801234:	48 89 e5             	mov    %rsp,%rbp
+  801237:	53                   	push   %rbx
+  801238:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80123c:	48 63 ce             	movslq %esi,%rcx
+  80123f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801242:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801247:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801251:	be 00 00 00 00       	mov    $0x0,%esi
+  801256:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80125c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80125e:	48 85 c0             	test   %rax,%rax
+  801261:	7f 06                	jg     801269 <sys_env_set_nice+0x36>
+}
+  801263:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801267:	c9                   	leave
+  801268:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801269:	49 89 c0             	mov    %rax,%r8
+  80126c:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801271:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  801278:	00 00 00 
+  80127b:	be 26 00 00 00       	mov    $0x26,%esi
+  801280:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  801287:	00 00 00 
+  80128a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80128f:	49 b9 0e 29 80 00 00 	movabs $0x80290e,%r9
+  801296:	00 00 00 
+  801299:	41 ff d1             	call   *%r9
+
+000000000080129c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80129c:	55                   	push   %rbp
+  80129d:	48 89 e5             	mov    %rsp,%rbp
+  8012a0:	53                   	push   %rbx
+  8012a1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012a5:	48 63 ce             	movslq %esi,%rcx
+  8012a8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ab:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8012bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012c7:	48 85 c0             	test   %rax,%rax
+  8012ca:	7f 06                	jg     8012d2 <sys_env_set_status+0x36>
+}
+  8012cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d0:	c9                   	leave
+  8012d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d2:	49 89 c0             	mov    %rax,%r8
+  8012d5:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012da:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8012e1:	00 00 00 
+  8012e4:	be 26 00 00 00       	mov    $0x26,%esi
+  8012e9:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  8012f0:	00 00 00 
+  8012f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f8:	49 b9 0e 29 80 00 00 	movabs $0x80290e,%r9
+  8012ff:	00 00 00 
+  801302:	41 ff d1             	call   *%r9
+
+0000000000801305 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801305:	55                   	push   %rbp
+  801306:	48 89 e5             	mov    %rsp,%rbp
+  801309:	53                   	push   %rbx
+  80130a:	48 83 ec 08          	sub    $0x8,%rsp
+  80130e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801311:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801314:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801319:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801323:	be 00 00 00 00       	mov    $0x0,%esi
+  801328:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80132e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801330:	48 85 c0             	test   %rax,%rax
+  801333:	7f 06                	jg     80133b <sys_env_set_trapframe+0x36>
+}
+  801335:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801339:	c9                   	leave
+  80133a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80133b:	49 89 c0             	mov    %rax,%r8
+  80133e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801343:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  80134a:	00 00 00 
+  80134d:	be 26 00 00 00       	mov    $0x26,%esi
+  801352:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  801359:	00 00 00 
+  80135c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801361:	49 b9 0e 29 80 00 00 	movabs $0x80290e,%r9
+  801368:	00 00 00 
+  80136b:	41 ff d1             	call   *%r9
+
+000000000080136e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80136e:	55                   	push   %rbp
+  80136f:	48 89 e5             	mov    %rsp,%rbp
+  801372:	53                   	push   %rbx
+  801373:	48 83 ec 08          	sub    $0x8,%rsp
+  801377:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80137a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80137d:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801382:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801387:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80138c:	be 00 00 00 00       	mov    $0x0,%esi
+  801391:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801397:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801399:	48 85 c0             	test   %rax,%rax
+  80139c:	7f 06                	jg     8013a4 <sys_env_set_pgfault_upcall+0x36>
+}
+  80139e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a2:	c9                   	leave
+  8013a3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013a4:	49 89 c0             	mov    %rax,%r8
+  8013a7:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013ac:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8013b3:	00 00 00 
+  8013b6:	be 26 00 00 00       	mov    $0x26,%esi
+  8013bb:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  8013c2:	00 00 00 
+  8013c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ca:	49 b9 0e 29 80 00 00 	movabs $0x80290e,%r9
+  8013d1:	00 00 00 
+  8013d4:	41 ff d1             	call   *%r9
+
+00000000008013d7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013d7:	55                   	push   %rbp
+  8013d8:	48 89 e5             	mov    %rsp,%rbp
+  8013db:	53                   	push   %rbx
+  8013dc:	89 f8                	mov    %edi,%eax
+  8013de:	49 89 f1             	mov    %rsi,%r9
+  8013e1:	48 89 d3             	mov    %rdx,%rbx
+  8013e4:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8013e7:	49 63 f0             	movslq %r8d,%rsi
+  8013ea:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ed:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013f2:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013fb:	cd 30                	int    $0x30
+}
+  8013fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801401:	c9                   	leave
+  801402:	c3                   	ret
+
+0000000000801403 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801403:	55                   	push   %rbp
+  801404:	48 89 e5             	mov    %rsp,%rbp
+  801407:	53                   	push   %rbx
+  801408:	48 83 ec 08          	sub    $0x8,%rsp
+  80140c:	48 89 fa             	mov    %rdi,%rdx
+  80140f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801412:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801417:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801421:	be 00 00 00 00       	mov    $0x0,%esi
+  801426:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80142c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80142e:	48 85 c0             	test   %rax,%rax
+  801431:	7f 06                	jg     801439 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801433:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801437:	c9                   	leave
+  801438:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801439:	49 89 c0             	mov    %rax,%r8
+  80143c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801441:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  801448:	00 00 00 
+  80144b:	be 26 00 00 00       	mov    $0x26,%esi
+  801450:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  801457:	00 00 00 
+  80145a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145f:	49 b9 0e 29 80 00 00 	movabs $0x80290e,%r9
+  801466:	00 00 00 
+  801469:	41 ff d1             	call   *%r9
+
+000000000080146c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80146c:	55                   	push   %rbp
+  80146d:	48 89 e5             	mov    %rsp,%rbp
+  801470:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801471:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801476:	ba 00 00 00 00       	mov    $0x0,%edx
+  80147b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801480:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801485:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148a:	be 00 00 00 00       	mov    $0x0,%esi
+  80148f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801495:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801497:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80149b:	c9                   	leave
+  80149c:	c3                   	ret
+
+000000000080149d <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80149d:	55                   	push   %rbp
+  80149e:	48 89 e5             	mov    %rsp,%rbp
+  8014a1:	53                   	push   %rbx
+  8014a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8014a6:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8014a9:	48 63 ce             	movslq %esi,%rcx
+  8014ac:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014af:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c6:	48 85 c0             	test   %rax,%rax
+  8014c9:	7f 06                	jg     8014d1 <sys_sigqueue+0x34>
+}
+  8014cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014cf:	c9                   	leave
+  8014d0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d1:	49 89 c0             	mov    %rax,%r8
+  8014d4:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8014d9:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8014e0:	00 00 00 
+  8014e3:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e8:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  8014ef:	00 00 00 
+  8014f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f7:	49 b9 0e 29 80 00 00 	movabs $0x80290e,%r9
+  8014fe:	00 00 00 
+  801501:	41 ff d1             	call   *%r9
+
+0000000000801504 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801504:	55                   	push   %rbp
+  801505:	48 89 e5             	mov    %rsp,%rbp
+  801508:	53                   	push   %rbx
+  801509:	48 83 ec 08          	sub    $0x8,%rsp
+  80150d:	48 89 fa             	mov    %rdi,%rdx
+  801510:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801513:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801518:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801522:	be 00 00 00 00       	mov    $0x0,%esi
+  801527:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80152d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80152f:	48 85 c0             	test   %rax,%rax
+  801532:	7f 06                	jg     80153a <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801534:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801538:	c9                   	leave
+  801539:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80153a:	49 89 c0             	mov    %rax,%r8
+  80153d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801542:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  801549:	00 00 00 
+  80154c:	be 26 00 00 00       	mov    $0x26,%esi
+  801551:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  801558:	00 00 00 
+  80155b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801560:	49 b9 0e 29 80 00 00 	movabs $0x80290e,%r9
+  801567:	00 00 00 
+  80156a:	41 ff d1             	call   *%r9
+
+000000000080156d <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80156d:	55                   	push   %rbp
+  80156e:	48 89 e5             	mov    %rsp,%rbp
+  801571:	53                   	push   %rbx
+  801572:	48 83 ec 08          	sub    $0x8,%rsp
+  801576:	48 89 f1             	mov    %rsi,%rcx
+  801579:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80157c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80157f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801584:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801589:	be 00 00 00 00       	mov    $0x0,%esi
+  80158e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801594:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801596:	48 85 c0             	test   %rax,%rax
+  801599:	7f 06                	jg     8015a1 <sys_sigaction+0x34>
+}
+  80159b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159f:	c9                   	leave
+  8015a0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015a1:	49 89 c0             	mov    %rax,%r8
+  8015a4:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8015a9:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8015b0:	00 00 00 
+  8015b3:	be 26 00 00 00       	mov    $0x26,%esi
+  8015b8:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  8015bf:	00 00 00 
+  8015c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c7:	49 b9 0e 29 80 00 00 	movabs $0x80290e,%r9
+  8015ce:	00 00 00 
+  8015d1:	41 ff d1             	call   *%r9
+
+00000000008015d4 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8015d4:	55                   	push   %rbp
+  8015d5:	48 89 e5             	mov    %rsp,%rbp
+  8015d8:	53                   	push   %rbx
+  8015d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8015dd:	48 89 f1             	mov    %rsi,%rcx
+  8015e0:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8015e3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e6:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015fd:	48 85 c0             	test   %rax,%rax
+  801600:	7f 06                	jg     801608 <sys_sigprocmask+0x34>
+}
+  801602:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801606:	c9                   	leave
+  801607:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801608:	49 89 c0             	mov    %rax,%r8
+  80160b:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801610:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  801617:	00 00 00 
+  80161a:	be 26 00 00 00       	mov    $0x26,%esi
+  80161f:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  801626:	00 00 00 
+  801629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162e:	49 b9 0e 29 80 00 00 	movabs $0x80290e,%r9
+  801635:	00 00 00 
+  801638:	41 ff d1             	call   *%r9
+
+000000000080163b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80163b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801642:	ff ff ff 
+  801645:	48 01 f8             	add    %rdi,%rax
+  801648:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80164c:	c3                   	ret
+
+000000000080164d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80164d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801654:	ff ff ff 
+  801657:	48 01 f8             	add    %rdi,%rax
+  80165a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80165e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801664:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801668:	c3                   	ret
+
+0000000000801669 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801669:	55                   	push   %rbp
+  80166a:	48 89 e5             	mov    %rsp,%rbp
+  80166d:	41 57                	push   %r15
+  80166f:	41 56                	push   %r14
+  801671:	41 55                	push   %r13
+  801673:	41 54                	push   %r12
+  801675:	53                   	push   %rbx
+  801676:	48 83 ec 08          	sub    $0x8,%rsp
+  80167a:	49 89 ff             	mov    %rdi,%r15
+  80167d:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801682:	49 bd e7 25 80 00 00 	movabs $0x8025e7,%r13
+  801689:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80168c:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801692:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801695:	48 89 df             	mov    %rbx,%rdi
+  801698:	41 ff d5             	call   *%r13
+  80169b:	83 e0 04             	and    $0x4,%eax
+  80169e:	74 17                	je     8016b7 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8016a0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8016a7:	4c 39 f3             	cmp    %r14,%rbx
+  8016aa:	75 e6                	jne    801692 <fd_alloc+0x29>
+  8016ac:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8016b2:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8016b7:	4d 89 27             	mov    %r12,(%r15)
+}
+  8016ba:	48 83 c4 08          	add    $0x8,%rsp
+  8016be:	5b                   	pop    %rbx
+  8016bf:	41 5c                	pop    %r12
+  8016c1:	41 5d                	pop    %r13
+  8016c3:	41 5e                	pop    %r14
+  8016c5:	41 5f                	pop    %r15
+  8016c7:	5d                   	pop    %rbp
+  8016c8:	c3                   	ret
+
+00000000008016c9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8016c9:	83 ff 1f             	cmp    $0x1f,%edi
+  8016cc:	77 39                	ja     801707 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8016ce:	55                   	push   %rbp
+  8016cf:	48 89 e5             	mov    %rsp,%rbp
+  8016d2:	41 54                	push   %r12
+  8016d4:	53                   	push   %rbx
+  8016d5:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8016d8:	48 63 df             	movslq %edi,%rbx
+  8016db:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8016e2:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8016e6:	48 89 df             	mov    %rbx,%rdi
+  8016e9:	48 b8 e7 25 80 00 00 	movabs $0x8025e7,%rax
+  8016f0:	00 00 00 
+  8016f3:	ff d0                	call   *%rax
+  8016f5:	a8 04                	test   $0x4,%al
+  8016f7:	74 14                	je     80170d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8016f9:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8016fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801702:	5b                   	pop    %rbx
+  801703:	41 5c                	pop    %r12
+  801705:	5d                   	pop    %rbp
+  801706:	c3                   	ret
+        return -E_INVAL;
+  801707:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80170c:	c3                   	ret
+        return -E_INVAL;
+  80170d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801712:	eb ee                	jmp    801702 <fd_lookup+0x39>
+
+0000000000801714 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801714:	55                   	push   %rbp
+  801715:	48 89 e5             	mov    %rsp,%rbp
+  801718:	41 54                	push   %r12
+  80171a:	53                   	push   %rbx
+  80171b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80171e:	48 b8 60 31 80 00 00 	movabs $0x803160,%rax
+  801725:	00 00 00 
+  801728:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80172f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801732:	39 3b                	cmp    %edi,(%rbx)
+  801734:	74 47                	je     80177d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801736:	48 83 c0 08          	add    $0x8,%rax
+  80173a:	48 8b 18             	mov    (%rax),%rbx
+  80173d:	48 85 db             	test   %rbx,%rbx
+  801740:	75 f0                	jne    801732 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801742:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801749:	00 00 00 
+  80174c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801752:	89 fa                	mov    %edi,%edx
+  801754:	48 bf e0 30 80 00 00 	movabs $0x8030e0,%rdi
+  80175b:	00 00 00 
+  80175e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801763:	48 b9 c4 01 80 00 00 	movabs $0x8001c4,%rcx
+  80176a:	00 00 00 
+  80176d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80176f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801774:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801778:	5b                   	pop    %rbx
+  801779:	41 5c                	pop    %r12
+  80177b:	5d                   	pop    %rbp
+  80177c:	c3                   	ret
+            return 0;
+  80177d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801782:	eb f0                	jmp    801774 <dev_lookup+0x60>
+
+0000000000801784 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801784:	55                   	push   %rbp
+  801785:	48 89 e5             	mov    %rsp,%rbp
+  801788:	41 55                	push   %r13
+  80178a:	41 54                	push   %r12
+  80178c:	53                   	push   %rbx
+  80178d:	48 83 ec 18          	sub    $0x18,%rsp
+  801791:	48 89 fb             	mov    %rdi,%rbx
+  801794:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801797:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80179e:	ff ff ff 
+  8017a1:	48 01 df             	add    %rbx,%rdi
+  8017a4:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8017a8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8017ac:	48 b8 c9 16 80 00 00 	movabs $0x8016c9,%rax
+  8017b3:	00 00 00 
+  8017b6:	ff d0                	call   *%rax
+  8017b8:	41 89 c5             	mov    %eax,%r13d
+  8017bb:	85 c0                	test   %eax,%eax
+  8017bd:	78 06                	js     8017c5 <fd_close+0x41>
+  8017bf:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8017c3:	74 1a                	je     8017df <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8017c5:	45 84 e4             	test   %r12b,%r12b
+  8017c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017cd:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8017d1:	44 89 e8             	mov    %r13d,%eax
+  8017d4:	48 83 c4 18          	add    $0x18,%rsp
+  8017d8:	5b                   	pop    %rbx
+  8017d9:	41 5c                	pop    %r12
+  8017db:	41 5d                	pop    %r13
+  8017dd:	5d                   	pop    %rbp
+  8017de:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017df:	8b 3b                	mov    (%rbx),%edi
+  8017e1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8017e5:	48 b8 14 17 80 00 00 	movabs $0x801714,%rax
+  8017ec:	00 00 00 
+  8017ef:	ff d0                	call   *%rax
+  8017f1:	41 89 c5             	mov    %eax,%r13d
+  8017f4:	85 c0                	test   %eax,%eax
+  8017f6:	78 1b                	js     801813 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8017f8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8017fc:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801800:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801806:	48 85 c0             	test   %rax,%rax
+  801809:	74 08                	je     801813 <fd_close+0x8f>
+  80180b:	48 89 df             	mov    %rbx,%rdi
+  80180e:	ff d0                	call   *%rax
+  801810:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801813:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801818:	48 89 de             	mov    %rbx,%rsi
+  80181b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801820:	48 b8 65 11 80 00 00 	movabs $0x801165,%rax
+  801827:	00 00 00 
+  80182a:	ff d0                	call   *%rax
+    return res;
+  80182c:	eb a3                	jmp    8017d1 <fd_close+0x4d>
+
+000000000080182e <close>:
+
+int
+close(int fdnum) {
+  80182e:	55                   	push   %rbp
+  80182f:	48 89 e5             	mov    %rsp,%rbp
+  801832:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801836:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80183a:	48 b8 c9 16 80 00 00 	movabs $0x8016c9,%rax
+  801841:	00 00 00 
+  801844:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801846:	85 c0                	test   %eax,%eax
+  801848:	78 15                	js     80185f <close+0x31>
+
+    return fd_close(fd, 1);
+  80184a:	be 01 00 00 00       	mov    $0x1,%esi
+  80184f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801853:	48 b8 84 17 80 00 00 	movabs $0x801784,%rax
+  80185a:	00 00 00 
+  80185d:	ff d0                	call   *%rax
+}
+  80185f:	c9                   	leave
+  801860:	c3                   	ret
+
+0000000000801861 <close_all>:
+
+void
+close_all(void) {
+  801861:	55                   	push   %rbp
+  801862:	48 89 e5             	mov    %rsp,%rbp
+  801865:	41 54                	push   %r12
+  801867:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801868:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80186d:	49 bc 2e 18 80 00 00 	movabs $0x80182e,%r12
+  801874:	00 00 00 
+  801877:	89 df                	mov    %ebx,%edi
+  801879:	41 ff d4             	call   *%r12
+  80187c:	83 c3 01             	add    $0x1,%ebx
+  80187f:	83 fb 20             	cmp    $0x20,%ebx
+  801882:	75 f3                	jne    801877 <close_all+0x16>
+}
+  801884:	5b                   	pop    %rbx
+  801885:	41 5c                	pop    %r12
+  801887:	5d                   	pop    %rbp
+  801888:	c3                   	ret
+
+0000000000801889 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801889:	55                   	push   %rbp
+  80188a:	48 89 e5             	mov    %rsp,%rbp
+  80188d:	41 57                	push   %r15
+  80188f:	41 56                	push   %r14
+  801891:	41 55                	push   %r13
+  801893:	41 54                	push   %r12
+  801895:	53                   	push   %rbx
+  801896:	48 83 ec 18          	sub    $0x18,%rsp
+  80189a:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80189d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8018a1:	48 b8 c9 16 80 00 00 	movabs $0x8016c9,%rax
+  8018a8:	00 00 00 
+  8018ab:	ff d0                	call   *%rax
+  8018ad:	89 c3                	mov    %eax,%ebx
+  8018af:	85 c0                	test   %eax,%eax
+  8018b1:	0f 88 b8 00 00 00    	js     80196f <dup+0xe6>
+    close(newfdnum);
+  8018b7:	44 89 e7             	mov    %r12d,%edi
+  8018ba:	48 b8 2e 18 80 00 00 	movabs $0x80182e,%rax
+  8018c1:	00 00 00 
+  8018c4:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8018c6:	4d 63 ec             	movslq %r12d,%r13
+  8018c9:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8018d0:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8018d4:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8018d8:	4c 89 ff             	mov    %r15,%rdi
+  8018db:	49 be 4d 16 80 00 00 	movabs $0x80164d,%r14
+  8018e2:	00 00 00 
+  8018e5:	41 ff d6             	call   *%r14
+  8018e8:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8018eb:	4c 89 ef             	mov    %r13,%rdi
+  8018ee:	41 ff d6             	call   *%r14
+  8018f1:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8018f4:	48 89 df             	mov    %rbx,%rdi
+  8018f7:	48 b8 e7 25 80 00 00 	movabs $0x8025e7,%rax
+  8018fe:	00 00 00 
+  801901:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801903:	a8 04                	test   $0x4,%al
+  801905:	74 2b                	je     801932 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801907:	41 89 c1             	mov    %eax,%r9d
+  80190a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801910:	4c 89 f1             	mov    %r14,%rcx
+  801913:	ba 00 00 00 00       	mov    $0x0,%edx
+  801918:	48 89 de             	mov    %rbx,%rsi
+  80191b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801920:	48 b8 00 11 80 00 00 	movabs $0x801100,%rax
+  801927:	00 00 00 
+  80192a:	ff d0                	call   *%rax
+  80192c:	89 c3                	mov    %eax,%ebx
+  80192e:	85 c0                	test   %eax,%eax
+  801930:	78 4e                	js     801980 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801932:	4c 89 ff             	mov    %r15,%rdi
+  801935:	48 b8 e7 25 80 00 00 	movabs $0x8025e7,%rax
+  80193c:	00 00 00 
+  80193f:	ff d0                	call   *%rax
+  801941:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801944:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80194a:	4c 89 e9             	mov    %r13,%rcx
+  80194d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801952:	4c 89 fe             	mov    %r15,%rsi
+  801955:	bf 00 00 00 00       	mov    $0x0,%edi
+  80195a:	48 b8 00 11 80 00 00 	movabs $0x801100,%rax
+  801961:	00 00 00 
+  801964:	ff d0                	call   *%rax
+  801966:	89 c3                	mov    %eax,%ebx
+  801968:	85 c0                	test   %eax,%eax
+  80196a:	78 14                	js     801980 <dup+0xf7>
+
+    return newfdnum;
+  80196c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80196f:	89 d8                	mov    %ebx,%eax
+  801971:	48 83 c4 18          	add    $0x18,%rsp
+  801975:	5b                   	pop    %rbx
+  801976:	41 5c                	pop    %r12
+  801978:	41 5d                	pop    %r13
+  80197a:	41 5e                	pop    %r14
+  80197c:	41 5f                	pop    %r15
+  80197e:	5d                   	pop    %rbp
+  80197f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801980:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801985:	4c 89 ee             	mov    %r13,%rsi
+  801988:	bf 00 00 00 00       	mov    $0x0,%edi
+  80198d:	49 bc 65 11 80 00 00 	movabs $0x801165,%r12
+  801994:	00 00 00 
+  801997:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80199a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80199f:	4c 89 f6             	mov    %r14,%rsi
+  8019a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019a7:	41 ff d4             	call   *%r12
+    return res;
+  8019aa:	eb c3                	jmp    80196f <dup+0xe6>
+
+00000000008019ac <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8019ac:	55                   	push   %rbp
+  8019ad:	48 89 e5             	mov    %rsp,%rbp
+  8019b0:	41 56                	push   %r14
+  8019b2:	41 55                	push   %r13
+  8019b4:	41 54                	push   %r12
+  8019b6:	53                   	push   %rbx
+  8019b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8019bb:	89 fb                	mov    %edi,%ebx
+  8019bd:	49 89 f4             	mov    %rsi,%r12
+  8019c0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019c3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019c7:	48 b8 c9 16 80 00 00 	movabs $0x8016c9,%rax
+  8019ce:	00 00 00 
+  8019d1:	ff d0                	call   *%rax
+  8019d3:	85 c0                	test   %eax,%eax
+  8019d5:	78 4c                	js     801a23 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019d7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019db:	41 8b 3e             	mov    (%r14),%edi
+  8019de:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019e2:	48 b8 14 17 80 00 00 	movabs $0x801714,%rax
+  8019e9:	00 00 00 
+  8019ec:	ff d0                	call   *%rax
+  8019ee:	85 c0                	test   %eax,%eax
+  8019f0:	78 35                	js     801a27 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019f2:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019f6:	83 e0 03             	and    $0x3,%eax
+  8019f9:	83 f8 01             	cmp    $0x1,%eax
+  8019fc:	74 2d                	je     801a2b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8019fe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a02:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801a06:	48 85 c0             	test   %rax,%rax
+  801a09:	74 56                	je     801a61 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801a0b:	4c 89 ea             	mov    %r13,%rdx
+  801a0e:	4c 89 e6             	mov    %r12,%rsi
+  801a11:	4c 89 f7             	mov    %r14,%rdi
+  801a14:	ff d0                	call   *%rax
+}
+  801a16:	48 83 c4 10          	add    $0x10,%rsp
+  801a1a:	5b                   	pop    %rbx
+  801a1b:	41 5c                	pop    %r12
+  801a1d:	41 5d                	pop    %r13
+  801a1f:	41 5e                	pop    %r14
+  801a21:	5d                   	pop    %rbp
+  801a22:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a23:	48 98                	cltq
+  801a25:	eb ef                	jmp    801a16 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a27:	48 98                	cltq
+  801a29:	eb eb                	jmp    801a16 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a2b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a32:	00 00 00 
+  801a35:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a3b:	89 da                	mov    %ebx,%edx
+  801a3d:	48 bf 21 31 80 00 00 	movabs $0x803121,%rdi
+  801a44:	00 00 00 
+  801a47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a4c:	48 b9 c4 01 80 00 00 	movabs $0x8001c4,%rcx
+  801a53:	00 00 00 
+  801a56:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a58:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a5f:	eb b5                	jmp    801a16 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a61:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a68:	eb ac                	jmp    801a16 <read+0x6a>
+
+0000000000801a6a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a6a:	55                   	push   %rbp
+  801a6b:	48 89 e5             	mov    %rsp,%rbp
+  801a6e:	41 57                	push   %r15
+  801a70:	41 56                	push   %r14
+  801a72:	41 55                	push   %r13
+  801a74:	41 54                	push   %r12
+  801a76:	53                   	push   %rbx
+  801a77:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a7b:	48 85 d2             	test   %rdx,%rdx
+  801a7e:	74 54                	je     801ad4 <readn+0x6a>
+  801a80:	41 89 fd             	mov    %edi,%r13d
+  801a83:	49 89 f6             	mov    %rsi,%r14
+  801a86:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801a89:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801a8e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801a93:	49 bf ac 19 80 00 00 	movabs $0x8019ac,%r15
+  801a9a:	00 00 00 
+  801a9d:	4c 89 e2             	mov    %r12,%rdx
+  801aa0:	48 29 f2             	sub    %rsi,%rdx
+  801aa3:	4c 01 f6             	add    %r14,%rsi
+  801aa6:	44 89 ef             	mov    %r13d,%edi
+  801aa9:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801aac:	85 c0                	test   %eax,%eax
+  801aae:	78 20                	js     801ad0 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ab0:	01 c3                	add    %eax,%ebx
+  801ab2:	85 c0                	test   %eax,%eax
+  801ab4:	74 08                	je     801abe <readn+0x54>
+  801ab6:	48 63 f3             	movslq %ebx,%rsi
+  801ab9:	4c 39 e6             	cmp    %r12,%rsi
+  801abc:	72 df                	jb     801a9d <readn+0x33>
+    }
+    return res;
+  801abe:	48 63 c3             	movslq %ebx,%rax
+}
+  801ac1:	48 83 c4 08          	add    $0x8,%rsp
+  801ac5:	5b                   	pop    %rbx
+  801ac6:	41 5c                	pop    %r12
+  801ac8:	41 5d                	pop    %r13
+  801aca:	41 5e                	pop    %r14
+  801acc:	41 5f                	pop    %r15
+  801ace:	5d                   	pop    %rbp
+  801acf:	c3                   	ret
+        if (inc < 0) return inc;
+  801ad0:	48 98                	cltq
+  801ad2:	eb ed                	jmp    801ac1 <readn+0x57>
+    int inc = 1, res = 0;
+  801ad4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad9:	eb e3                	jmp    801abe <readn+0x54>
+
+0000000000801adb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801adb:	55                   	push   %rbp
+  801adc:	48 89 e5             	mov    %rsp,%rbp
+  801adf:	41 56                	push   %r14
+  801ae1:	41 55                	push   %r13
+  801ae3:	41 54                	push   %r12
+  801ae5:	53                   	push   %rbx
+  801ae6:	48 83 ec 10          	sub    $0x10,%rsp
+  801aea:	89 fb                	mov    %edi,%ebx
+  801aec:	49 89 f4             	mov    %rsi,%r12
+  801aef:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801af2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801af6:	48 b8 c9 16 80 00 00 	movabs $0x8016c9,%rax
+  801afd:	00 00 00 
+  801b00:	ff d0                	call   *%rax
+  801b02:	85 c0                	test   %eax,%eax
+  801b04:	78 47                	js     801b4d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b06:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b0a:	41 8b 3e             	mov    (%r14),%edi
+  801b0d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b11:	48 b8 14 17 80 00 00 	movabs $0x801714,%rax
+  801b18:	00 00 00 
+  801b1b:	ff d0                	call   *%rax
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	78 30                	js     801b51 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b21:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b26:	74 2d                	je     801b55 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b28:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b2c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b30:	48 85 c0             	test   %rax,%rax
+  801b33:	74 56                	je     801b8b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b35:	4c 89 ea             	mov    %r13,%rdx
+  801b38:	4c 89 e6             	mov    %r12,%rsi
+  801b3b:	4c 89 f7             	mov    %r14,%rdi
+  801b3e:	ff d0                	call   *%rax
+}
+  801b40:	48 83 c4 10          	add    $0x10,%rsp
+  801b44:	5b                   	pop    %rbx
+  801b45:	41 5c                	pop    %r12
+  801b47:	41 5d                	pop    %r13
+  801b49:	41 5e                	pop    %r14
+  801b4b:	5d                   	pop    %rbp
+  801b4c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b4d:	48 98                	cltq
+  801b4f:	eb ef                	jmp    801b40 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b51:	48 98                	cltq
+  801b53:	eb eb                	jmp    801b40 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b55:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b5c:	00 00 00 
+  801b5f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b65:	89 da                	mov    %ebx,%edx
+  801b67:	48 bf 3d 31 80 00 00 	movabs $0x80313d,%rdi
+  801b6e:	00 00 00 
+  801b71:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b76:	48 b9 c4 01 80 00 00 	movabs $0x8001c4,%rcx
+  801b7d:	00 00 00 
+  801b80:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b82:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b89:	eb b5                	jmp    801b40 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b8b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b92:	eb ac                	jmp    801b40 <write+0x65>
+
+0000000000801b94 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801b94:	55                   	push   %rbp
+  801b95:	48 89 e5             	mov    %rsp,%rbp
+  801b98:	53                   	push   %rbx
+  801b99:	48 83 ec 18          	sub    $0x18,%rsp
+  801b9d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b9f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ba3:	48 b8 c9 16 80 00 00 	movabs $0x8016c9,%rax
+  801baa:	00 00 00 
+  801bad:	ff d0                	call   *%rax
+  801baf:	85 c0                	test   %eax,%eax
+  801bb1:	78 0c                	js     801bbf <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801bb3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bb7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801bba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bbf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bc3:	c9                   	leave
+  801bc4:	c3                   	ret
+
+0000000000801bc5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801bc5:	55                   	push   %rbp
+  801bc6:	48 89 e5             	mov    %rsp,%rbp
+  801bc9:	41 55                	push   %r13
+  801bcb:	41 54                	push   %r12
+  801bcd:	53                   	push   %rbx
+  801bce:	48 83 ec 18          	sub    $0x18,%rsp
+  801bd2:	89 fb                	mov    %edi,%ebx
+  801bd4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bd7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bdb:	48 b8 c9 16 80 00 00 	movabs $0x8016c9,%rax
+  801be2:	00 00 00 
+  801be5:	ff d0                	call   *%rax
+  801be7:	85 c0                	test   %eax,%eax
+  801be9:	78 38                	js     801c23 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801beb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801bef:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801bf3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bf7:	48 b8 14 17 80 00 00 	movabs $0x801714,%rax
+  801bfe:	00 00 00 
+  801c01:	ff d0                	call   *%rax
+  801c03:	85 c0                	test   %eax,%eax
+  801c05:	78 1c                	js     801c23 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c07:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c0c:	74 20                	je     801c2e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c12:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801c16:	48 85 c0             	test   %rax,%rax
+  801c19:	74 47                	je     801c62 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c1b:	44 89 e6             	mov    %r12d,%esi
+  801c1e:	4c 89 ef             	mov    %r13,%rdi
+  801c21:	ff d0                	call   *%rax
+}
+  801c23:	48 83 c4 18          	add    $0x18,%rsp
+  801c27:	5b                   	pop    %rbx
+  801c28:	41 5c                	pop    %r12
+  801c2a:	41 5d                	pop    %r13
+  801c2c:	5d                   	pop    %rbp
+  801c2d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c2e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c35:	00 00 00 
+  801c38:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c3e:	89 da                	mov    %ebx,%edx
+  801c40:	48 bf 00 31 80 00 00 	movabs $0x803100,%rdi
+  801c47:	00 00 00 
+  801c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c4f:	48 b9 c4 01 80 00 00 	movabs $0x8001c4,%rcx
+  801c56:	00 00 00 
+  801c59:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c60:	eb c1                	jmp    801c23 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c62:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c67:	eb ba                	jmp    801c23 <ftruncate+0x5e>
+
+0000000000801c69 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801c69:	55                   	push   %rbp
+  801c6a:	48 89 e5             	mov    %rsp,%rbp
+  801c6d:	41 54                	push   %r12
+  801c6f:	53                   	push   %rbx
+  801c70:	48 83 ec 10          	sub    $0x10,%rsp
+  801c74:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c77:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c7b:	48 b8 c9 16 80 00 00 	movabs $0x8016c9,%rax
+  801c82:	00 00 00 
+  801c85:	ff d0                	call   *%rax
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	78 4e                	js     801cd9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c8b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c8f:	41 8b 3c 24          	mov    (%r12),%edi
+  801c93:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c97:	48 b8 14 17 80 00 00 	movabs $0x801714,%rax
+  801c9e:	00 00 00 
+  801ca1:	ff d0                	call   *%rax
+  801ca3:	85 c0                	test   %eax,%eax
+  801ca5:	78 32                	js     801cd9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ca7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801cab:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801cb0:	74 30                	je     801ce2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801cb2:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801cb5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801cbc:	00 00 00 
+    stat->st_isdir = 0;
+  801cbf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801cc6:	00 00 00 
+    stat->st_dev = dev;
+  801cc9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801cd0:	48 89 de             	mov    %rbx,%rsi
+  801cd3:	4c 89 e7             	mov    %r12,%rdi
+  801cd6:	ff 50 28             	call   *0x28(%rax)
+}
+  801cd9:	48 83 c4 10          	add    $0x10,%rsp
+  801cdd:	5b                   	pop    %rbx
+  801cde:	41 5c                	pop    %r12
+  801ce0:	5d                   	pop    %rbp
+  801ce1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ce2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ce7:	eb f0                	jmp    801cd9 <fstat+0x70>
+
+0000000000801ce9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801ce9:	55                   	push   %rbp
+  801cea:	48 89 e5             	mov    %rsp,%rbp
+  801ced:	41 54                	push   %r12
+  801cef:	53                   	push   %rbx
+  801cf0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801cf3:	be 00 00 00 00       	mov    $0x0,%esi
+  801cf8:	48 b8 6a 1f 80 00 00 	movabs $0x801f6a,%rax
+  801cff:	00 00 00 
+  801d02:	ff d0                	call   *%rax
+  801d04:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d06:	85 c0                	test   %eax,%eax
+  801d08:	78 25                	js     801d2f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d0a:	4c 89 e6             	mov    %r12,%rsi
+  801d0d:	89 c7                	mov    %eax,%edi
+  801d0f:	48 b8 69 1c 80 00 00 	movabs $0x801c69,%rax
+  801d16:	00 00 00 
+  801d19:	ff d0                	call   *%rax
+  801d1b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d1e:	89 df                	mov    %ebx,%edi
+  801d20:	48 b8 2e 18 80 00 00 	movabs $0x80182e,%rax
+  801d27:	00 00 00 
+  801d2a:	ff d0                	call   *%rax
+
+    return res;
+  801d2c:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d2f:	89 d8                	mov    %ebx,%eax
+  801d31:	5b                   	pop    %rbx
+  801d32:	41 5c                	pop    %r12
+  801d34:	5d                   	pop    %rbp
+  801d35:	c3                   	ret
+
+0000000000801d36 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801d36:	55                   	push   %rbp
+  801d37:	48 89 e5             	mov    %rsp,%rbp
+  801d3a:	41 54                	push   %r12
+  801d3c:	53                   	push   %rbx
+  801d3d:	48 83 ec 10          	sub    $0x10,%rsp
+  801d41:	41 89 fc             	mov    %edi,%r12d
+  801d44:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d47:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801d4e:	00 00 00 
+  801d51:	83 38 00             	cmpl   $0x0,(%rax)
+  801d54:	74 5e                	je     801db4 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801d56:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801d5c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d61:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801d68:	00 00 00 
+  801d6b:	44 89 e6             	mov    %r12d,%esi
+  801d6e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801d75:	00 00 00 
+  801d78:	8b 38                	mov    (%rax),%edi
+  801d7a:	48 b8 46 2a 80 00 00 	movabs $0x802a46,%rax
+  801d81:	00 00 00 
+  801d84:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801d86:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801d8d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801d8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d93:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801d97:	48 89 de             	mov    %rbx,%rsi
+  801d9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d9f:	48 b8 b1 29 80 00 00 	movabs $0x8029b1,%rax
+  801da6:	00 00 00 
+  801da9:	ff d0                	call   *%rax
+}
+  801dab:	48 83 c4 10          	add    $0x10,%rsp
+  801daf:	5b                   	pop    %rbx
+  801db0:	41 5c                	pop    %r12
+  801db2:	5d                   	pop    %rbp
+  801db3:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801db4:	bf 03 00 00 00       	mov    $0x3,%edi
+  801db9:	48 b8 e6 2a 80 00 00 	movabs $0x802ae6,%rax
+  801dc0:	00 00 00 
+  801dc3:	ff d0                	call   *%rax
+  801dc5:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801dcc:	00 00 
+  801dce:	eb 86                	jmp    801d56 <fsipc+0x20>
+
+0000000000801dd0 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801dd0:	55                   	push   %rbp
+  801dd1:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801dd4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801ddb:	00 00 00 
+  801dde:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801de1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801de3:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801de6:	be 00 00 00 00       	mov    $0x0,%esi
+  801deb:	bf 02 00 00 00       	mov    $0x2,%edi
+  801df0:	48 b8 36 1d 80 00 00 	movabs $0x801d36,%rax
+  801df7:	00 00 00 
+  801dfa:	ff d0                	call   *%rax
+}
+  801dfc:	5d                   	pop    %rbp
+  801dfd:	c3                   	ret
+
+0000000000801dfe <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801dfe:	55                   	push   %rbp
+  801dff:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e02:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801e05:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801e0c:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801e0e:	be 00 00 00 00       	mov    $0x0,%esi
+  801e13:	bf 06 00 00 00       	mov    $0x6,%edi
+  801e18:	48 b8 36 1d 80 00 00 	movabs $0x801d36,%rax
+  801e1f:	00 00 00 
+  801e22:	ff d0                	call   *%rax
+}
+  801e24:	5d                   	pop    %rbp
+  801e25:	c3                   	ret
+
+0000000000801e26 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801e26:	55                   	push   %rbp
+  801e27:	48 89 e5             	mov    %rsp,%rbp
+  801e2a:	41 54                	push   %r12
+  801e2c:	53                   	push   %rbx
+  801e2d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e30:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801e33:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801e3a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801e3c:	be 00 00 00 00       	mov    $0x0,%esi
+  801e41:	bf 05 00 00 00       	mov    $0x5,%edi
+  801e46:	48 b8 36 1d 80 00 00 	movabs $0x801d36,%rax
+  801e4d:	00 00 00 
+  801e50:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e52:	85 c0                	test   %eax,%eax
+  801e54:	78 3d                	js     801e93 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e56:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801e5d:	00 00 00 
+  801e60:	4c 89 e6             	mov    %r12,%rsi
+  801e63:	48 89 df             	mov    %rbx,%rdi
+  801e66:	48 b8 e9 0a 80 00 00 	movabs $0x800ae9,%rax
+  801e6d:	00 00 00 
+  801e70:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801e72:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801e79:	00 
+  801e7a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e80:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801e87:	00 
+  801e88:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801e8e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e93:	5b                   	pop    %rbx
+  801e94:	41 5c                	pop    %r12
+  801e96:	5d                   	pop    %rbp
+  801e97:	c3                   	ret
+
+0000000000801e98 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801e98:	55                   	push   %rbp
+  801e99:	48 89 e5             	mov    %rsp,%rbp
+  801e9c:	41 54                	push   %r12
+  801e9e:	53                   	push   %rbx
+  801e9f:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  801ea2:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  801ea7:	48 39 c2             	cmp    %rax,%rdx
+  801eaa:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801eae:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801eb1:	48 89 c2             	mov    %rax,%rdx
+  801eb4:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801ebb:	00 00 00 
+  801ebe:	48 b8 4a 0d 80 00 00 	movabs $0x800d4a,%rax
+  801ec5:	00 00 00 
+  801ec8:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801eca:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801ed1:	00 00 00 
+  801ed4:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  801ed9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  801edb:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  801edf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee4:	bf 04 00 00 00       	mov    $0x4,%edi
+  801ee9:	48 b8 36 1d 80 00 00 	movabs $0x801d36,%rax
+  801ef0:	00 00 00 
+  801ef3:	ff d0                	call   *%rax
+  801ef5:	48 98                	cltq
+}
+  801ef7:	5b                   	pop    %rbx
+  801ef8:	41 5c                	pop    %r12
+  801efa:	5d                   	pop    %rbp
+  801efb:	c3                   	ret
+
+0000000000801efc <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801efc:	55                   	push   %rbp
+  801efd:	48 89 e5             	mov    %rsp,%rbp
+  801f00:	41 54                	push   %r12
+  801f02:	53                   	push   %rbx
+  801f03:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f06:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801f0d:	00 00 00 
+  801f10:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801f13:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  801f15:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801f1a:	48 39 ca             	cmp    %rcx,%rdx
+  801f1d:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  801f21:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  801f25:	be 00 00 00 00       	mov    $0x0,%esi
+  801f2a:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f2f:	48 b8 36 1d 80 00 00 	movabs $0x801d36,%rax
+  801f36:	00 00 00 
+  801f39:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  801f3b:	85 c0                	test   %eax,%eax
+  801f3d:	78 27                	js     801f66 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  801f3f:	48 63 d8             	movslq %eax,%rbx
+  801f42:	48 89 da             	mov    %rbx,%rdx
+  801f45:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801f4c:	00 00 00 
+  801f4f:	4c 89 e7             	mov    %r12,%rdi
+  801f52:	48 b8 4a 0d 80 00 00 	movabs $0x800d4a,%rax
+  801f59:	00 00 00 
+  801f5c:	ff d0                	call   *%rax
+    return bytes_read;
+  801f5e:	48 89 d8             	mov    %rbx,%rax
+}
+  801f61:	5b                   	pop    %rbx
+  801f62:	41 5c                	pop    %r12
+  801f64:	5d                   	pop    %rbp
+  801f65:	c3                   	ret
+        return bytes_read;
+  801f66:	48 98                	cltq
+  801f68:	eb f7                	jmp    801f61 <devfile_read+0x65>
+
+0000000000801f6a <open>:
+open(const char *path, int mode) {
+  801f6a:	55                   	push   %rbp
+  801f6b:	48 89 e5             	mov    %rsp,%rbp
+  801f6e:	41 55                	push   %r13
+  801f70:	41 54                	push   %r12
+  801f72:	53                   	push   %rbx
+  801f73:	48 83 ec 18          	sub    $0x18,%rsp
+  801f77:	49 89 fc             	mov    %rdi,%r12
+  801f7a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801f7d:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  801f84:	00 00 00 
+  801f87:	ff d0                	call   *%rax
+  801f89:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801f8f:	0f 87 8a 00 00 00    	ja     80201f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801f95:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801f99:	48 b8 69 16 80 00 00 	movabs $0x801669,%rax
+  801fa0:	00 00 00 
+  801fa3:	ff d0                	call   *%rax
+  801fa5:	89 c3                	mov    %eax,%ebx
+  801fa7:	85 c0                	test   %eax,%eax
+  801fa9:	78 50                	js     801ffb <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801fab:	4c 89 e6             	mov    %r12,%rsi
+  801fae:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801fb5:	00 00 00 
+  801fb8:	48 89 df             	mov    %rbx,%rdi
+  801fbb:	48 b8 e9 0a 80 00 00 	movabs $0x800ae9,%rax
+  801fc2:	00 00 00 
+  801fc5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801fc7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801fce:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801fd2:	bf 01 00 00 00       	mov    $0x1,%edi
+  801fd7:	48 b8 36 1d 80 00 00 	movabs $0x801d36,%rax
+  801fde:	00 00 00 
+  801fe1:	ff d0                	call   *%rax
+  801fe3:	89 c3                	mov    %eax,%ebx
+  801fe5:	85 c0                	test   %eax,%eax
+  801fe7:	78 1f                	js     802008 <open+0x9e>
+    return fd2num(fd);
+  801fe9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801fed:	48 b8 3b 16 80 00 00 	movabs $0x80163b,%rax
+  801ff4:	00 00 00 
+  801ff7:	ff d0                	call   *%rax
+  801ff9:	89 c3                	mov    %eax,%ebx
+}
+  801ffb:	89 d8                	mov    %ebx,%eax
+  801ffd:	48 83 c4 18          	add    $0x18,%rsp
+  802001:	5b                   	pop    %rbx
+  802002:	41 5c                	pop    %r12
+  802004:	41 5d                	pop    %r13
+  802006:	5d                   	pop    %rbp
+  802007:	c3                   	ret
+        fd_close(fd, 0);
+  802008:	be 00 00 00 00       	mov    $0x0,%esi
+  80200d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802011:	48 b8 84 17 80 00 00 	movabs $0x801784,%rax
+  802018:	00 00 00 
+  80201b:	ff d0                	call   *%rax
+        return res;
+  80201d:	eb dc                	jmp    801ffb <open+0x91>
+        return -E_BAD_PATH;
+  80201f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802024:	eb d5                	jmp    801ffb <open+0x91>
+
+0000000000802026 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802026:	55                   	push   %rbp
+  802027:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80202a:	be 00 00 00 00       	mov    $0x0,%esi
+  80202f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802034:	48 b8 36 1d 80 00 00 	movabs $0x801d36,%rax
+  80203b:	00 00 00 
+  80203e:	ff d0                	call   *%rax
+}
+  802040:	5d                   	pop    %rbp
+  802041:	c3                   	ret
+
+0000000000802042 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802042:	55                   	push   %rbp
+  802043:	48 89 e5             	mov    %rsp,%rbp
+  802046:	41 54                	push   %r12
+  802048:	53                   	push   %rbx
+  802049:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80204c:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  802053:	00 00 00 
+  802056:	ff d0                	call   *%rax
+  802058:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80205b:	48 be 80 31 80 00 00 	movabs $0x803180,%rsi
+  802062:	00 00 00 
+  802065:	48 89 df             	mov    %rbx,%rdi
+  802068:	48 b8 e9 0a 80 00 00 	movabs $0x800ae9,%rax
+  80206f:	00 00 00 
+  802072:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802074:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802079:	41 2b 04 24          	sub    (%r12),%eax
+  80207d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802083:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80208a:	00 00 00 
+    stat->st_dev = &devpipe;
+  80208d:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802094:	00 00 00 
+  802097:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80209e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a3:	5b                   	pop    %rbx
+  8020a4:	41 5c                	pop    %r12
+  8020a6:	5d                   	pop    %rbp
+  8020a7:	c3                   	ret
+
+00000000008020a8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8020a8:	55                   	push   %rbp
+  8020a9:	48 89 e5             	mov    %rsp,%rbp
+  8020ac:	41 54                	push   %r12
+  8020ae:	53                   	push   %rbx
+  8020af:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8020b2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020b7:	48 89 fe             	mov    %rdi,%rsi
+  8020ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020bf:	49 bc 65 11 80 00 00 	movabs $0x801165,%r12
+  8020c6:	00 00 00 
+  8020c9:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8020cc:	48 89 df             	mov    %rbx,%rdi
+  8020cf:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  8020d6:	00 00 00 
+  8020d9:	ff d0                	call   *%rax
+  8020db:	48 89 c6             	mov    %rax,%rsi
+  8020de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020e8:	41 ff d4             	call   *%r12
+}
+  8020eb:	5b                   	pop    %rbx
+  8020ec:	41 5c                	pop    %r12
+  8020ee:	5d                   	pop    %rbp
+  8020ef:	c3                   	ret
+
+00000000008020f0 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8020f0:	55                   	push   %rbp
+  8020f1:	48 89 e5             	mov    %rsp,%rbp
+  8020f4:	41 57                	push   %r15
+  8020f6:	41 56                	push   %r14
+  8020f8:	41 55                	push   %r13
+  8020fa:	41 54                	push   %r12
+  8020fc:	53                   	push   %rbx
+  8020fd:	48 83 ec 18          	sub    $0x18,%rsp
+  802101:	49 89 fc             	mov    %rdi,%r12
+  802104:	49 89 f5             	mov    %rsi,%r13
+  802107:	49 89 d7             	mov    %rdx,%r15
+  80210a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80210e:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  802115:	00 00 00 
+  802118:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80211a:	4d 85 ff             	test   %r15,%r15
+  80211d:	0f 84 af 00 00 00    	je     8021d2 <devpipe_write+0xe2>
+  802123:	48 89 c3             	mov    %rax,%rbx
+  802126:	4c 89 f8             	mov    %r15,%rax
+  802129:	4d 89 ef             	mov    %r13,%r15
+  80212c:	4c 01 e8             	add    %r13,%rax
+  80212f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802133:	49 bd 6d 10 80 00 00 	movabs $0x80106d,%r13
+  80213a:	00 00 00 
+            sys_yield();
+  80213d:	49 be 0a 10 80 00 00 	movabs $0x80100a,%r14
+  802144:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802147:	8b 73 04             	mov    0x4(%rbx),%esi
+  80214a:	48 63 ce             	movslq %esi,%rcx
+  80214d:	48 63 03             	movslq (%rbx),%rax
+  802150:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802156:	48 39 c1             	cmp    %rax,%rcx
+  802159:	72 2e                	jb     802189 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80215b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802160:	48 89 da             	mov    %rbx,%rdx
+  802163:	be 00 10 00 00       	mov    $0x1000,%esi
+  802168:	4c 89 e7             	mov    %r12,%rdi
+  80216b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80216e:	85 c0                	test   %eax,%eax
+  802170:	74 66                	je     8021d8 <devpipe_write+0xe8>
+            sys_yield();
+  802172:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802175:	8b 73 04             	mov    0x4(%rbx),%esi
+  802178:	48 63 ce             	movslq %esi,%rcx
+  80217b:	48 63 03             	movslq (%rbx),%rax
+  80217e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802184:	48 39 c1             	cmp    %rax,%rcx
+  802187:	73 d2                	jae    80215b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802189:	41 0f b6 3f          	movzbl (%r15),%edi
+  80218d:	48 89 ca             	mov    %rcx,%rdx
+  802190:	48 c1 ea 03          	shr    $0x3,%rdx
+  802194:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80219b:	08 10 20 
+  80219e:	48 f7 e2             	mul    %rdx
+  8021a1:	48 c1 ea 06          	shr    $0x6,%rdx
+  8021a5:	48 89 d0             	mov    %rdx,%rax
+  8021a8:	48 c1 e0 09          	shl    $0x9,%rax
+  8021ac:	48 29 d0             	sub    %rdx,%rax
+  8021af:	48 c1 e0 03          	shl    $0x3,%rax
+  8021b3:	48 29 c1             	sub    %rax,%rcx
+  8021b6:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8021bb:	83 c6 01             	add    $0x1,%esi
+  8021be:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8021c1:	49 83 c7 01          	add    $0x1,%r15
+  8021c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021c9:	49 39 c7             	cmp    %rax,%r15
+  8021cc:	0f 85 75 ff ff ff    	jne    802147 <devpipe_write+0x57>
+    return n;
+  8021d2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021d6:	eb 05                	jmp    8021dd <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8021d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021dd:	48 83 c4 18          	add    $0x18,%rsp
+  8021e1:	5b                   	pop    %rbx
+  8021e2:	41 5c                	pop    %r12
+  8021e4:	41 5d                	pop    %r13
+  8021e6:	41 5e                	pop    %r14
+  8021e8:	41 5f                	pop    %r15
+  8021ea:	5d                   	pop    %rbp
+  8021eb:	c3                   	ret
+
+00000000008021ec <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8021ec:	55                   	push   %rbp
+  8021ed:	48 89 e5             	mov    %rsp,%rbp
+  8021f0:	41 57                	push   %r15
+  8021f2:	41 56                	push   %r14
+  8021f4:	41 55                	push   %r13
+  8021f6:	41 54                	push   %r12
+  8021f8:	53                   	push   %rbx
+  8021f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8021fd:	49 89 fc             	mov    %rdi,%r12
+  802200:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802204:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802208:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  80220f:	00 00 00 
+  802212:	ff d0                	call   *%rax
+  802214:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802217:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80221d:	49 bd 6d 10 80 00 00 	movabs $0x80106d,%r13
+  802224:	00 00 00 
+            sys_yield();
+  802227:	49 be 0a 10 80 00 00 	movabs $0x80100a,%r14
+  80222e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802231:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802236:	74 7d                	je     8022b5 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802238:	8b 03                	mov    (%rbx),%eax
+  80223a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80223d:	75 26                	jne    802265 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80223f:	4d 85 ff             	test   %r15,%r15
+  802242:	75 77                	jne    8022bb <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802244:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802249:	48 89 da             	mov    %rbx,%rdx
+  80224c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802251:	4c 89 e7             	mov    %r12,%rdi
+  802254:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802257:	85 c0                	test   %eax,%eax
+  802259:	74 72                	je     8022cd <devpipe_read+0xe1>
+            sys_yield();
+  80225b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80225e:	8b 03                	mov    (%rbx),%eax
+  802260:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802263:	74 df                	je     802244 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802265:	48 63 c8             	movslq %eax,%rcx
+  802268:	48 89 ca             	mov    %rcx,%rdx
+  80226b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80226f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802276:	08 10 20 
+  802279:	48 89 d0             	mov    %rdx,%rax
+  80227c:	48 f7 e6             	mul    %rsi
+  80227f:	48 c1 ea 06          	shr    $0x6,%rdx
+  802283:	48 89 d0             	mov    %rdx,%rax
+  802286:	48 c1 e0 09          	shl    $0x9,%rax
+  80228a:	48 29 d0             	sub    %rdx,%rax
+  80228d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802294:	00 
+  802295:	48 89 c8             	mov    %rcx,%rax
+  802298:	48 29 d0             	sub    %rdx,%rax
+  80229b:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8022a0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8022a4:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8022a8:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8022ab:	49 83 c7 01          	add    $0x1,%r15
+  8022af:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8022b3:	75 83                	jne    802238 <devpipe_read+0x4c>
+    return n;
+  8022b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022b9:	eb 03                	jmp    8022be <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8022bb:	4c 89 f8             	mov    %r15,%rax
+}
+  8022be:	48 83 c4 18          	add    $0x18,%rsp
+  8022c2:	5b                   	pop    %rbx
+  8022c3:	41 5c                	pop    %r12
+  8022c5:	41 5d                	pop    %r13
+  8022c7:	41 5e                	pop    %r14
+  8022c9:	41 5f                	pop    %r15
+  8022cb:	5d                   	pop    %rbp
+  8022cc:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8022cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d2:	eb ea                	jmp    8022be <devpipe_read+0xd2>
+
+00000000008022d4 <pipe>:
+pipe(int pfd[2]) {
+  8022d4:	55                   	push   %rbp
+  8022d5:	48 89 e5             	mov    %rsp,%rbp
+  8022d8:	41 55                	push   %r13
+  8022da:	41 54                	push   %r12
+  8022dc:	53                   	push   %rbx
+  8022dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8022e1:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022e4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8022e8:	48 b8 69 16 80 00 00 	movabs $0x801669,%rax
+  8022ef:	00 00 00 
+  8022f2:	ff d0                	call   *%rax
+  8022f4:	89 c3                	mov    %eax,%ebx
+  8022f6:	85 c0                	test   %eax,%eax
+  8022f8:	0f 88 a0 01 00 00    	js     80249e <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8022fe:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802303:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802308:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80230c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802311:	48 b8 99 10 80 00 00 	movabs $0x801099,%rax
+  802318:	00 00 00 
+  80231b:	ff d0                	call   *%rax
+  80231d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80231f:	85 c0                	test   %eax,%eax
+  802321:	0f 88 77 01 00 00    	js     80249e <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802327:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80232b:	48 b8 69 16 80 00 00 	movabs $0x801669,%rax
+  802332:	00 00 00 
+  802335:	ff d0                	call   *%rax
+  802337:	89 c3                	mov    %eax,%ebx
+  802339:	85 c0                	test   %eax,%eax
+  80233b:	0f 88 43 01 00 00    	js     802484 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802341:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802346:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80234b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80234f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802354:	48 b8 99 10 80 00 00 	movabs $0x801099,%rax
+  80235b:	00 00 00 
+  80235e:	ff d0                	call   *%rax
+  802360:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802362:	85 c0                	test   %eax,%eax
+  802364:	0f 88 1a 01 00 00    	js     802484 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80236a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80236e:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  802375:	00 00 00 
+  802378:	ff d0                	call   *%rax
+  80237a:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80237d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802382:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802387:	48 89 c6             	mov    %rax,%rsi
+  80238a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80238f:	48 b8 99 10 80 00 00 	movabs $0x801099,%rax
+  802396:	00 00 00 
+  802399:	ff d0                	call   *%rax
+  80239b:	89 c3                	mov    %eax,%ebx
+  80239d:	85 c0                	test   %eax,%eax
+  80239f:	0f 88 c5 00 00 00    	js     80246a <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8023a5:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8023a9:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  8023b0:	00 00 00 
+  8023b3:	ff d0                	call   *%rax
+  8023b5:	48 89 c1             	mov    %rax,%rcx
+  8023b8:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8023be:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c9:	4c 89 ee             	mov    %r13,%rsi
+  8023cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023d1:	48 b8 00 11 80 00 00 	movabs $0x801100,%rax
+  8023d8:	00 00 00 
+  8023db:	ff d0                	call   *%rax
+  8023dd:	89 c3                	mov    %eax,%ebx
+  8023df:	85 c0                	test   %eax,%eax
+  8023e1:	78 6e                	js     802451 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8023e3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8023e8:	4c 89 ef             	mov    %r13,%rdi
+  8023eb:	48 b8 3b 10 80 00 00 	movabs $0x80103b,%rax
+  8023f2:	00 00 00 
+  8023f5:	ff d0                	call   *%rax
+  8023f7:	83 f8 02             	cmp    $0x2,%eax
+  8023fa:	0f 85 ab 00 00 00    	jne    8024ab <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802400:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802407:	00 00 
+  802409:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80240d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80240f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802413:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80241a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80241e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802420:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802424:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80242b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80242f:	48 bb 3b 16 80 00 00 	movabs $0x80163b,%rbx
+  802436:	00 00 00 
+  802439:	ff d3                	call   *%rbx
+  80243b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80243f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802443:	ff d3                	call   *%rbx
+  802445:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80244a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80244f:	eb 4d                	jmp    80249e <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802451:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802456:	4c 89 ee             	mov    %r13,%rsi
+  802459:	bf 00 00 00 00       	mov    $0x0,%edi
+  80245e:	48 b8 65 11 80 00 00 	movabs $0x801165,%rax
+  802465:	00 00 00 
+  802468:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80246a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80246f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802473:	bf 00 00 00 00       	mov    $0x0,%edi
+  802478:	48 b8 65 11 80 00 00 	movabs $0x801165,%rax
+  80247f:	00 00 00 
+  802482:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802484:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802489:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80248d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802492:	48 b8 65 11 80 00 00 	movabs $0x801165,%rax
+  802499:	00 00 00 
+  80249c:	ff d0                	call   *%rax
+}
+  80249e:	89 d8                	mov    %ebx,%eax
+  8024a0:	48 83 c4 18          	add    $0x18,%rsp
+  8024a4:	5b                   	pop    %rbx
+  8024a5:	41 5c                	pop    %r12
+  8024a7:	41 5d                	pop    %r13
+  8024a9:	5d                   	pop    %rbp
+  8024aa:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8024ab:	48 b9 b0 31 80 00 00 	movabs $0x8031b0,%rcx
+  8024b2:	00 00 00 
+  8024b5:	48 ba 87 31 80 00 00 	movabs $0x803187,%rdx
+  8024bc:	00 00 00 
+  8024bf:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8024c4:	48 bf 9c 31 80 00 00 	movabs $0x80319c,%rdi
+  8024cb:	00 00 00 
+  8024ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d3:	49 b8 0e 29 80 00 00 	movabs $0x80290e,%r8
+  8024da:	00 00 00 
+  8024dd:	41 ff d0             	call   *%r8
+
+00000000008024e0 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8024e0:	55                   	push   %rbp
+  8024e1:	48 89 e5             	mov    %rsp,%rbp
+  8024e4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8024e8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024ec:	48 b8 c9 16 80 00 00 	movabs $0x8016c9,%rax
+  8024f3:	00 00 00 
+  8024f6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024f8:	85 c0                	test   %eax,%eax
+  8024fa:	78 35                	js     802531 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8024fc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802500:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  802507:	00 00 00 
+  80250a:	ff d0                	call   *%rax
+  80250c:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80250f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802514:	be 00 10 00 00       	mov    $0x1000,%esi
+  802519:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80251d:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  802524:	00 00 00 
+  802527:	ff d0                	call   *%rax
+  802529:	85 c0                	test   %eax,%eax
+  80252b:	0f 94 c0             	sete   %al
+  80252e:	0f b6 c0             	movzbl %al,%eax
+}
+  802531:	c9                   	leave
+  802532:	c3                   	ret
+
+0000000000802533 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802533:	48 89 f8             	mov    %rdi,%rax
+  802536:	48 c1 e8 27          	shr    $0x27,%rax
+  80253a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802541:	01 00 00 
+  802544:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802548:	f6 c2 01             	test   $0x1,%dl
+  80254b:	74 6d                	je     8025ba <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80254d:	48 89 f8             	mov    %rdi,%rax
+  802550:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802554:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80255b:	01 00 00 
+  80255e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802562:	f6 c2 01             	test   $0x1,%dl
+  802565:	74 62                	je     8025c9 <get_uvpt_entry+0x96>
+  802567:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80256e:	01 00 00 
+  802571:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802575:	f6 c2 80             	test   $0x80,%dl
+  802578:	75 4f                	jne    8025c9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80257a:	48 89 f8             	mov    %rdi,%rax
+  80257d:	48 c1 e8 15          	shr    $0x15,%rax
+  802581:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802588:	01 00 00 
+  80258b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80258f:	f6 c2 01             	test   $0x1,%dl
+  802592:	74 44                	je     8025d8 <get_uvpt_entry+0xa5>
+  802594:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80259b:	01 00 00 
+  80259e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025a2:	f6 c2 80             	test   $0x80,%dl
+  8025a5:	75 31                	jne    8025d8 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8025a7:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8025ab:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8025b2:	01 00 00 
+  8025b5:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8025b9:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8025ba:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8025c1:	01 00 00 
+  8025c4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025c8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025c9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8025d0:	01 00 00 
+  8025d3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025d7:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025d8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025df:	01 00 00 
+  8025e2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025e6:	c3                   	ret
+
+00000000008025e7 <get_prot>:
+
+int
+get_prot(void *va) {
+  8025e7:	55                   	push   %rbp
+  8025e8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8025eb:	48 b8 33 25 80 00 00 	movabs $0x802533,%rax
+  8025f2:	00 00 00 
+  8025f5:	ff d0                	call   *%rax
+  8025f7:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8025fa:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8025ff:	89 c1                	mov    %eax,%ecx
+  802601:	83 c9 04             	or     $0x4,%ecx
+  802604:	f6 c2 01             	test   $0x1,%dl
+  802607:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80260a:	89 c1                	mov    %eax,%ecx
+  80260c:	83 c9 02             	or     $0x2,%ecx
+  80260f:	f6 c2 02             	test   $0x2,%dl
+  802612:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802615:	89 c1                	mov    %eax,%ecx
+  802617:	83 c9 01             	or     $0x1,%ecx
+  80261a:	48 85 d2             	test   %rdx,%rdx
+  80261d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802620:	89 c1                	mov    %eax,%ecx
+  802622:	83 c9 40             	or     $0x40,%ecx
+  802625:	f6 c6 04             	test   $0x4,%dh
+  802628:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80262b:	5d                   	pop    %rbp
+  80262c:	c3                   	ret
+
+000000000080262d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80262d:	55                   	push   %rbp
+  80262e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802631:	48 b8 33 25 80 00 00 	movabs $0x802533,%rax
+  802638:	00 00 00 
+  80263b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80263d:	48 c1 e8 06          	shr    $0x6,%rax
+  802641:	83 e0 01             	and    $0x1,%eax
+}
+  802644:	5d                   	pop    %rbp
+  802645:	c3                   	ret
+
+0000000000802646 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802646:	55                   	push   %rbp
+  802647:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80264a:	48 b8 33 25 80 00 00 	movabs $0x802533,%rax
+  802651:	00 00 00 
+  802654:	ff d0                	call   *%rax
+  802656:	83 e0 01             	and    $0x1,%eax
+}
+  802659:	5d                   	pop    %rbp
+  80265a:	c3                   	ret
+
+000000000080265b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80265b:	55                   	push   %rbp
+  80265c:	48 89 e5             	mov    %rsp,%rbp
+  80265f:	41 57                	push   %r15
+  802661:	41 56                	push   %r14
+  802663:	41 55                	push   %r13
+  802665:	41 54                	push   %r12
+  802667:	53                   	push   %rbx
+  802668:	48 83 ec 18          	sub    $0x18,%rsp
+  80266c:	49 89 ff             	mov    %rdi,%r15
+  80266f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802673:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802678:	49 bc 46 26 80 00 00 	movabs $0x802646,%r12
+  80267f:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802682:	49 be e7 25 80 00 00 	movabs $0x8025e7,%r14
+  802689:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80268c:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802693:	00 00 00 
+  802696:	eb 0c                	jmp    8026a4 <foreach_shared_region+0x49>
+  802698:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80269f:	4c 39 eb             	cmp    %r13,%rbx
+  8026a2:	74 38                	je     8026dc <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  8026a4:	48 89 df             	mov    %rbx,%rdi
+  8026a7:	41 ff d4             	call   *%r12
+  8026aa:	84 c0                	test   %al,%al
+  8026ac:	74 ea                	je     802698 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  8026ae:	48 89 df             	mov    %rbx,%rdi
+  8026b1:	41 ff d6             	call   *%r14
+  8026b4:	a8 40                	test   $0x40,%al
+  8026b6:	74 e0                	je     802698 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8026b8:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8026bf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8026c3:	48 89 df             	mov    %rbx,%rdi
+  8026c6:	41 ff d7             	call   *%r15
+        if (err)
+  8026c9:	85 c0                	test   %eax,%eax
+  8026cb:	74 cb                	je     802698 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8026cd:	48 83 c4 18          	add    $0x18,%rsp
+  8026d1:	5b                   	pop    %rbx
+  8026d2:	41 5c                	pop    %r12
+  8026d4:	41 5d                	pop    %r13
+  8026d6:	41 5e                	pop    %r14
+  8026d8:	41 5f                	pop    %r15
+  8026da:	5d                   	pop    %rbp
+  8026db:	c3                   	ret
+    return 0;
+  8026dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026e1:	eb ea                	jmp    8026cd <foreach_shared_region+0x72>
+
+00000000008026e3 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8026e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026e8:	c3                   	ret
+
+00000000008026e9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8026e9:	55                   	push   %rbp
+  8026ea:	48 89 e5             	mov    %rsp,%rbp
+  8026ed:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8026f0:	48 be d4 31 80 00 00 	movabs $0x8031d4,%rsi
+  8026f7:	00 00 00 
+  8026fa:	48 b8 e9 0a 80 00 00 	movabs $0x800ae9,%rax
+  802701:	00 00 00 
+  802704:	ff d0                	call   *%rax
+    return 0;
+}
+  802706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80270b:	5d                   	pop    %rbp
+  80270c:	c3                   	ret
+
+000000000080270d <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80270d:	55                   	push   %rbp
+  80270e:	48 89 e5             	mov    %rsp,%rbp
+  802711:	41 57                	push   %r15
+  802713:	41 56                	push   %r14
+  802715:	41 55                	push   %r13
+  802717:	41 54                	push   %r12
+  802719:	53                   	push   %rbx
+  80271a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802721:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802728:	48 85 d2             	test   %rdx,%rdx
+  80272b:	74 7a                	je     8027a7 <devcons_write+0x9a>
+  80272d:	49 89 d6             	mov    %rdx,%r14
+  802730:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802736:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80273b:	49 bf e3 0c 80 00 00 	movabs $0x800ce3,%r15
+  802742:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802745:	4c 89 f3             	mov    %r14,%rbx
+  802748:	48 29 f3             	sub    %rsi,%rbx
+  80274b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802750:	48 39 c3             	cmp    %rax,%rbx
+  802753:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802757:	4c 63 eb             	movslq %ebx,%r13
+  80275a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802761:	48 01 c6             	add    %rax,%rsi
+  802764:	4c 89 ea             	mov    %r13,%rdx
+  802767:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80276e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802771:	4c 89 ee             	mov    %r13,%rsi
+  802774:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80277b:	48 b8 10 0f 80 00 00 	movabs $0x800f10,%rax
+  802782:	00 00 00 
+  802785:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802787:	41 01 dc             	add    %ebx,%r12d
+  80278a:	49 63 f4             	movslq %r12d,%rsi
+  80278d:	4c 39 f6             	cmp    %r14,%rsi
+  802790:	72 b3                	jb     802745 <devcons_write+0x38>
+    return res;
+  802792:	49 63 c4             	movslq %r12d,%rax
+}
+  802795:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80279c:	5b                   	pop    %rbx
+  80279d:	41 5c                	pop    %r12
+  80279f:	41 5d                	pop    %r13
+  8027a1:	41 5e                	pop    %r14
+  8027a3:	41 5f                	pop    %r15
+  8027a5:	5d                   	pop    %rbp
+  8027a6:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8027a7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8027ad:	eb e3                	jmp    802792 <devcons_write+0x85>
+
+00000000008027af <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8027af:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8027b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b7:	48 85 c0             	test   %rax,%rax
+  8027ba:	74 55                	je     802811 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8027bc:	55                   	push   %rbp
+  8027bd:	48 89 e5             	mov    %rsp,%rbp
+  8027c0:	41 55                	push   %r13
+  8027c2:	41 54                	push   %r12
+  8027c4:	53                   	push   %rbx
+  8027c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8027c9:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8027cc:	48 bb 3d 0f 80 00 00 	movabs $0x800f3d,%rbx
+  8027d3:	00 00 00 
+  8027d6:	49 bc 0a 10 80 00 00 	movabs $0x80100a,%r12
+  8027dd:	00 00 00 
+  8027e0:	eb 03                	jmp    8027e5 <devcons_read+0x36>
+  8027e2:	41 ff d4             	call   *%r12
+  8027e5:	ff d3                	call   *%rbx
+  8027e7:	85 c0                	test   %eax,%eax
+  8027e9:	74 f7                	je     8027e2 <devcons_read+0x33>
+    if (c < 0) return c;
+  8027eb:	48 63 d0             	movslq %eax,%rdx
+  8027ee:	78 13                	js     802803 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8027f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f5:	83 f8 04             	cmp    $0x4,%eax
+  8027f8:	74 09                	je     802803 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8027fa:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8027fe:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802803:	48 89 d0             	mov    %rdx,%rax
+  802806:	48 83 c4 08          	add    $0x8,%rsp
+  80280a:	5b                   	pop    %rbx
+  80280b:	41 5c                	pop    %r12
+  80280d:	41 5d                	pop    %r13
+  80280f:	5d                   	pop    %rbp
+  802810:	c3                   	ret
+  802811:	48 89 d0             	mov    %rdx,%rax
+  802814:	c3                   	ret
+
+0000000000802815 <cputchar>:
+cputchar(int ch) {
+  802815:	55                   	push   %rbp
+  802816:	48 89 e5             	mov    %rsp,%rbp
+  802819:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80281d:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802821:	be 01 00 00 00       	mov    $0x1,%esi
+  802826:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80282a:	48 b8 10 0f 80 00 00 	movabs $0x800f10,%rax
+  802831:	00 00 00 
+  802834:	ff d0                	call   *%rax
+}
+  802836:	c9                   	leave
+  802837:	c3                   	ret
+
+0000000000802838 <getchar>:
+getchar(void) {
+  802838:	55                   	push   %rbp
+  802839:	48 89 e5             	mov    %rsp,%rbp
+  80283c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802840:	ba 01 00 00 00       	mov    $0x1,%edx
+  802845:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802849:	bf 00 00 00 00       	mov    $0x0,%edi
+  80284e:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  802855:	00 00 00 
+  802858:	ff d0                	call   *%rax
+  80285a:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80285c:	85 c0                	test   %eax,%eax
+  80285e:	78 06                	js     802866 <getchar+0x2e>
+  802860:	74 08                	je     80286a <getchar+0x32>
+  802862:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802866:	89 d0                	mov    %edx,%eax
+  802868:	c9                   	leave
+  802869:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80286a:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80286f:	eb f5                	jmp    802866 <getchar+0x2e>
+
+0000000000802871 <iscons>:
+iscons(int fdnum) {
+  802871:	55                   	push   %rbp
+  802872:	48 89 e5             	mov    %rsp,%rbp
+  802875:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802879:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80287d:	48 b8 c9 16 80 00 00 	movabs $0x8016c9,%rax
+  802884:	00 00 00 
+  802887:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802889:	85 c0                	test   %eax,%eax
+  80288b:	78 18                	js     8028a5 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80288d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802891:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802898:	00 00 00 
+  80289b:	8b 00                	mov    (%rax),%eax
+  80289d:	39 02                	cmp    %eax,(%rdx)
+  80289f:	0f 94 c0             	sete   %al
+  8028a2:	0f b6 c0             	movzbl %al,%eax
+}
+  8028a5:	c9                   	leave
+  8028a6:	c3                   	ret
+
+00000000008028a7 <opencons>:
+opencons(void) {
+  8028a7:	55                   	push   %rbp
+  8028a8:	48 89 e5             	mov    %rsp,%rbp
+  8028ab:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8028af:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8028b3:	48 b8 69 16 80 00 00 	movabs $0x801669,%rax
+  8028ba:	00 00 00 
+  8028bd:	ff d0                	call   *%rax
+  8028bf:	85 c0                	test   %eax,%eax
+  8028c1:	78 49                	js     80290c <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8028c3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8028c8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028cd:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8028d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028d6:	48 b8 99 10 80 00 00 	movabs $0x801099,%rax
+  8028dd:	00 00 00 
+  8028e0:	ff d0                	call   *%rax
+  8028e2:	85 c0                	test   %eax,%eax
+  8028e4:	78 26                	js     80290c <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8028e6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028ea:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  8028f1:	00 00 
+  8028f3:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8028f5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8028f9:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802900:	48 b8 3b 16 80 00 00 	movabs $0x80163b,%rax
+  802907:	00 00 00 
+  80290a:	ff d0                	call   *%rax
+}
+  80290c:	c9                   	leave
+  80290d:	c3                   	ret
+
+000000000080290e <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80290e:	55                   	push   %rbp
+  80290f:	48 89 e5             	mov    %rsp,%rbp
+  802912:	41 56                	push   %r14
+  802914:	41 55                	push   %r13
+  802916:	41 54                	push   %r12
+  802918:	53                   	push   %rbx
+  802919:	48 83 ec 50          	sub    $0x50,%rsp
+  80291d:	49 89 fc             	mov    %rdi,%r12
+  802920:	41 89 f5             	mov    %esi,%r13d
+  802923:	48 89 d3             	mov    %rdx,%rbx
+  802926:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80292a:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80292e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802932:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802939:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80293d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802941:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802945:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802949:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802950:	00 00 00 
+  802953:	4c 8b 30             	mov    (%rax),%r14
+  802956:	48 b8 d9 0f 80 00 00 	movabs $0x800fd9,%rax
+  80295d:	00 00 00 
+  802960:	ff d0                	call   *%rax
+  802962:	89 c6                	mov    %eax,%esi
+  802964:	45 89 e8             	mov    %r13d,%r8d
+  802967:	4c 89 e1             	mov    %r12,%rcx
+  80296a:	4c 89 f2             	mov    %r14,%rdx
+  80296d:	48 bf e0 31 80 00 00 	movabs $0x8031e0,%rdi
+  802974:	00 00 00 
+  802977:	b8 00 00 00 00       	mov    $0x0,%eax
+  80297c:	49 bc c4 01 80 00 00 	movabs $0x8001c4,%r12
+  802983:	00 00 00 
+  802986:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802989:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80298d:	48 89 df             	mov    %rbx,%rdi
+  802990:	48 b8 60 01 80 00 00 	movabs $0x800160,%rax
+  802997:	00 00 00 
+  80299a:	ff d0                	call   *%rax
+    cprintf("\n");
+  80299c:	48 bf 54 2b 80 00 00 	movabs $0x802b54,%rdi
+  8029a3:	00 00 00 
+  8029a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ab:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8029ae:	cc                   	int3
+  8029af:	eb fd                	jmp    8029ae <_panic+0xa0>
+
+00000000008029b1 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8029b1:	55                   	push   %rbp
+  8029b2:	48 89 e5             	mov    %rsp,%rbp
+  8029b5:	41 54                	push   %r12
+  8029b7:	53                   	push   %rbx
+  8029b8:	48 89 fb             	mov    %rdi,%rbx
+  8029bb:	48 89 f7             	mov    %rsi,%rdi
+  8029be:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8029c1:	48 85 f6             	test   %rsi,%rsi
+  8029c4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029cb:	00 00 00 
+  8029ce:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8029d2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029d7:	48 b8 03 14 80 00 00 	movabs $0x801403,%rax
+  8029de:	00 00 00 
+  8029e1:	ff d0                	call   *%rax
+    if (res < 0) {
+  8029e3:	85 c0                	test   %eax,%eax
+  8029e5:	78 45                	js     802a2c <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8029e7:	48 85 db             	test   %rbx,%rbx
+  8029ea:	74 12                	je     8029fe <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8029ec:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029f3:	00 00 00 
+  8029f6:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8029fc:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  8029fe:	4d 85 e4             	test   %r12,%r12
+  802a01:	74 14                	je     802a17 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802a03:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a0a:	00 00 00 
+  802a0d:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802a13:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802a17:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a1e:	00 00 00 
+  802a21:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802a27:	5b                   	pop    %rbx
+  802a28:	41 5c                	pop    %r12
+  802a2a:	5d                   	pop    %rbp
+  802a2b:	c3                   	ret
+        if (from_env_store)
+  802a2c:	48 85 db             	test   %rbx,%rbx
+  802a2f:	74 06                	je     802a37 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802a31:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802a37:	4d 85 e4             	test   %r12,%r12
+  802a3a:	74 eb                	je     802a27 <ipc_recv+0x76>
+            *perm_store = 0;
+  802a3c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802a43:	00 
+  802a44:	eb e1                	jmp    802a27 <ipc_recv+0x76>
+
+0000000000802a46 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802a46:	55                   	push   %rbp
+  802a47:	48 89 e5             	mov    %rsp,%rbp
+  802a4a:	41 57                	push   %r15
+  802a4c:	41 56                	push   %r14
+  802a4e:	41 55                	push   %r13
+  802a50:	41 54                	push   %r12
+  802a52:	53                   	push   %rbx
+  802a53:	48 83 ec 18          	sub    $0x18,%rsp
+  802a57:	41 89 fd             	mov    %edi,%r13d
+  802a5a:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802a5d:	48 89 d3             	mov    %rdx,%rbx
+  802a60:	49 89 cc             	mov    %rcx,%r12
+  802a63:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a67:	48 85 d2             	test   %rdx,%rdx
+  802a6a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a71:	00 00 00 
+  802a74:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a78:	49 be d7 13 80 00 00 	movabs $0x8013d7,%r14
+  802a7f:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802a82:	49 bf 0a 10 80 00 00 	movabs $0x80100a,%r15
+  802a89:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a8c:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802a8f:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802a93:	4c 89 e1             	mov    %r12,%rcx
+  802a96:	48 89 da             	mov    %rbx,%rdx
+  802a99:	44 89 ef             	mov    %r13d,%edi
+  802a9c:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802a9f:	85 c0                	test   %eax,%eax
+  802aa1:	74 34                	je     802ad7 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802aa3:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802aa6:	75 05                	jne    802aad <ipc_send+0x67>
+        sys_yield();
+  802aa8:	41 ff d7             	call   *%r15
+    while (true) {
+  802aab:	eb df                	jmp    802a8c <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802aad:	48 ba 03 32 80 00 00 	movabs $0x803203,%rdx
+  802ab4:	00 00 00 
+  802ab7:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802abc:	48 bf 1c 32 80 00 00 	movabs $0x80321c,%rdi
+  802ac3:	00 00 00 
+  802ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802acb:	48 b9 0e 29 80 00 00 	movabs $0x80290e,%rcx
+  802ad2:	00 00 00 
+  802ad5:	ff d1                	call   *%rcx
+    }
+}
+  802ad7:	48 83 c4 18          	add    $0x18,%rsp
+  802adb:	5b                   	pop    %rbx
+  802adc:	41 5c                	pop    %r12
+  802ade:	41 5d                	pop    %r13
+  802ae0:	41 5e                	pop    %r14
+  802ae2:	41 5f                	pop    %r15
+  802ae4:	5d                   	pop    %rbp
+  802ae5:	c3                   	ret
+
+0000000000802ae6 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802aeb:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802af2:	00 00 00 
+  802af5:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802afc:	48 01 ca             	add    %rcx,%rdx
+  802aff:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802b05:	39 fa                	cmp    %edi,%edx
+  802b07:	74 12                	je     802b1b <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802b09:	48 83 c0 01          	add    $0x1,%rax
+  802b0d:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b13:	75 e0                	jne    802af5 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802b15:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b1a:	c3                   	ret
+            return envs[i].env_id;
+  802b1b:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802b22:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b29:	00 00 00 
+  802b2c:	48 01 d0             	add    %rdx,%rax
+  802b2f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b35:	c3                   	ret
+  802b36:	66 90                	xchg   %ax,%ax
+
+0000000000802b38 <__rodata_start>:
+  802b38:	49 20 72 65          	rex.WB and %sil,0x65(%r10)
+  802b3c:	61                   	(bad)
+  802b3d:	64 20 25 30 38 78 20 	and    %ah,%fs:0x20783830(%rip)        # 20f86374 <__bss_end+0x2077e374>
+  802b44:	66 72 6f             	data16 jb 802bb6 <__rodata_start+0x7e>
+  802b47:	6d                   	insl   (%dx),%es:(%rdi)
+  802b48:	20 6c 6f 63          	and    %ch,0x63(%rdi,%rbp,2)
+  802b4c:	61                   	(bad)
+  802b4d:	74 69                	je     802bb8 <__rodata_start+0x80>
+  802b4f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802b50:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b51:	20 30                	and    %dh,(%rax)
+  802b53:	21 0a                	and    %ecx,(%rdx)
+  802b55:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  802b5c:	77 6e                	ja     802bcc <__rodata_start+0x94>
+  802b5e:	3e 00 30             	ds add %dh,(%rax)
+  802b61:	31 32                	xor    %esi,(%rdx)
+  802b63:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802b6a:	41                   	rex.B
+  802b6b:	42                   	rex.X
+  802b6c:	43                   	rex.XB
+  802b6d:	44                   	rex.R
+  802b6e:	45                   	rex.RB
+  802b6f:	46 00 30             	rex.RX add %r14b,(%rax)
+  802b72:	31 32                	xor    %esi,(%rdx)
+  802b74:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802b7b:	61                   	(bad)
+  802b7c:	62 63 64 65 66       	(bad)
+  802b81:	00 28                	add    %ch,(%rax)
+  802b83:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b84:	75 6c                	jne    802bf2 <__rodata_start+0xba>
+  802b86:	6c                   	insb   (%dx),%es:(%rdi)
+  802b87:	29 00                	sub    %eax,(%rax)
+  802b89:	65 72 72             	gs jb  802bfe <__rodata_start+0xc6>
+  802b8c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802b8d:	72 20                	jb     802baf <__rodata_start+0x77>
+  802b8f:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802b94:	73 70                	jae    802c06 <__rodata_start+0xce>
+  802b96:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802b9a:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802ba1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ba2:	72 00                	jb     802ba4 <__rodata_start+0x6c>
+  802ba4:	62 61 64 20 65       	(bad)
+  802ba9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802baa:	76 69                	jbe    802c15 <__rodata_start+0xdd>
+  802bac:	72 6f                	jb     802c1d <__rodata_start+0xe5>
+  802bae:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802baf:	6d                   	insl   (%dx),%es:(%rdi)
+  802bb0:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802bb2:	74 00                	je     802bb4 <__rodata_start+0x7c>
+  802bb4:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802bbb:	20 70 61             	and    %dh,0x61(%rax)
+  802bbe:	72 61                	jb     802c21 <__rodata_start+0xe9>
+  802bc0:	6d                   	insl   (%dx),%es:(%rdi)
+  802bc1:	65 74 65             	gs je  802c29 <__rodata_start+0xf1>
+  802bc4:	72 00                	jb     802bc6 <__rodata_start+0x8e>
+  802bc6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bc7:	75 74                	jne    802c3d <__rodata_start+0x105>
+  802bc9:	20 6f 66             	and    %ch,0x66(%rdi)
+  802bcc:	20 6d 65             	and    %ch,0x65(%rbp)
+  802bcf:	6d                   	insl   (%dx),%es:(%rdi)
+  802bd0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bd1:	72 79                	jb     802c4c <__rodata_start+0x114>
+  802bd3:	00 6f 75             	add    %ch,0x75(%rdi)
+  802bd6:	74 20                	je     802bf8 <__rodata_start+0xc0>
+  802bd8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bd9:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802bdd:	76 69                	jbe    802c48 <__rodata_start+0x110>
+  802bdf:	72 6f                	jb     802c50 <__rodata_start+0x118>
+  802be1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802be2:	6d                   	insl   (%dx),%es:(%rdi)
+  802be3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802be5:	74 73                	je     802c5a <__rodata_start+0x122>
+  802be7:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802bea:	72 72                	jb     802c5e <__rodata_start+0x126>
+  802bec:	75 70                	jne    802c5e <__rodata_start+0x126>
+  802bee:	74 65                	je     802c55 <__rodata_start+0x11d>
+  802bf0:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802bf5:	75 67                	jne    802c5e <__rodata_start+0x126>
+  802bf7:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802bfa:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802bfc:	00 73 65             	add    %dh,0x65(%rbx)
+  802bff:	67 6d                	insl   (%dx),%es:(%edi)
+  802c01:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802c03:	74 61                	je     802c66 <__rodata_start+0x12e>
+  802c05:	74 69                	je     802c70 <__rodata_start+0x138>
+  802c07:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c08:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c09:	20 66 61             	and    %ah,0x61(%rsi)
+  802c0c:	75 6c                	jne    802c7a <__rodata_start+0x142>
+  802c0e:	74 00                	je     802c10 <__rodata_start+0xd8>
+  802c10:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802c17:	20 45 4c             	and    %al,0x4c(%rbp)
+  802c1a:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802c1e:	61                   	(bad)
+  802c1f:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802c24:	20 73 75             	and    %dh,0x75(%rbx)
+  802c27:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802c2a:	73 79                	jae    802ca5 <__rodata_start+0x16d>
+  802c2c:	73 74                	jae    802ca2 <__rodata_start+0x16a>
+  802c2e:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802c30:	20 63 61             	and    %ah,0x61(%rbx)
+  802c33:	6c                   	insb   (%dx),%es:(%rdi)
+  802c34:	6c                   	insb   (%dx),%es:(%rdi)
+  802c35:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802c38:	74 72                	je     802cac <__rodata_start+0x174>
+  802c3a:	79 20                	jns    802c5c <__rodata_start+0x124>
+  802c3c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c3d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c3e:	74 20                	je     802c60 <__rodata_start+0x128>
+  802c40:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802c42:	75 6e                	jne    802cb2 <__rodata_start+0x17a>
+  802c44:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802c48:	76 20                	jbe    802c6a <__rodata_start+0x132>
+  802c4a:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802c51:	72 65                	jb     802cb8 <__rodata_start+0x180>
+  802c53:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802c56:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c57:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802c5b:	65 78 70             	gs js  802cce <__rodata_start+0x196>
+  802c5e:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802c63:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802c66:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802c6a:	20 66 69             	and    %ah,0x69(%rsi)
+  802c6d:	6c                   	insb   (%dx),%es:(%rdi)
+  802c6e:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802c72:	20 66 72             	and    %ah,0x72(%rsi)
+  802c75:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802c7a:	61                   	(bad)
+  802c7b:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802c7e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c7f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c80:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802c84:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802c87:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c88:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c89:	20 6d 61             	and    %ch,0x61(%rbp)
+  802c8c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c8d:	79 20                	jns    802caf <__rodata_start+0x177>
+  802c8f:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802c96:	72 65                	jb     802cfd <__rodata_start+0x1c5>
+  802c98:	20 6f 70             	and    %ch,0x70(%rdi)
+  802c9b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802c9d:	00 66 69             	add    %ah,0x69(%rsi)
+  802ca0:	6c                   	insb   (%dx),%es:(%rdi)
+  802ca1:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802ca5:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802ca8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ca9:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802cac:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cad:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cae:	74 20                	je     802cd0 <__rodata_start+0x198>
+  802cb0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802cb2:	75 6e                	jne    802d22 <__rodata_start+0x1ea>
+  802cb4:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802cb8:	76 61                	jbe    802d1b <__rodata_start+0x1e3>
+  802cba:	6c                   	insb   (%dx),%es:(%rdi)
+  802cbb:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802cc2:	00 
+  802cc3:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802cca:	72 65                	jb     802d31 <__rodata_start+0x1f9>
+  802ccc:	61                   	(bad)
+  802ccd:	64 79 20             	fs jns 802cf0 <__rodata_start+0x1b8>
+  802cd0:	65 78 69             	gs js  802d3c <__rodata_start+0x204>
+  802cd3:	73 74                	jae    802d49 <__rodata_start+0x211>
+  802cd5:	73 00                	jae    802cd7 <__rodata_start+0x19f>
+  802cd7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cd8:	70 65                	jo     802d3f <__rodata_start+0x207>
+  802cda:	72 61                	jb     802d3d <__rodata_start+0x205>
+  802cdc:	74 69                	je     802d47 <__rodata_start+0x20f>
+  802cde:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cdf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ce0:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802ce3:	74 20                	je     802d05 <__rodata_start+0x1cd>
+  802ce5:	73 75                	jae    802d5c <__rodata_start+0x224>
+  802ce7:	70 70                	jo     802d59 <__rodata_start+0x221>
+  802ce9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cea:	72 74                	jb     802d60 <__rodata_start+0x228>
+  802cec:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802cf1:	65 72 61             	gs jb  802d55 <__rodata_start+0x21d>
+  802cf4:	74 69                	je     802d5f <__rodata_start+0x227>
+  802cf6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cf7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cf8:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802cfb:	74 20                	je     802d1d <__rodata_start+0x1e5>
+  802cfd:	70 65                	jo     802d64 <__rodata_start+0x22c>
+  802cff:	72 6d                	jb     802d6e <__rodata_start+0x236>
+  802d01:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  802d08:	2e 
+  802d09:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  802d10:	00 
+  802d11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802d18:	00 00 00 
+  802d1b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+  802d20:	b1 03                	mov    $0x3,%cl
+  802d22:	80 00 00             	addb   $0x0,(%rax)
+  802d25:	00 00                	add    %al,(%rax)
+  802d27:	00 f2                	add    %dh,%dl
+  802d29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d2f:	00 e2                	add    %ah,%dl
+  802d31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d37:	00 f2                	add    %dh,%dl
+  802d39:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d3f:	00 f2                	add    %dh,%dl
+  802d41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d47:	00 f2                	add    %dh,%dl
+  802d49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d4f:	00 f2                	add    %dh,%dl
+  802d51:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d57:	00 d0                	add    %dl,%al
+  802d59:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d5f:	00 f2                	add    %dh,%dl
+  802d61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d67:	00 f2                	add    %dh,%dl
+  802d69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d6f:	00 c4                	add    %al,%ah
+  802d71:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d77:	00 3e                	add    %bh,(%rsi)
+  802d79:	04 80                	add    $0x80,%al
+  802d7b:	00 00                	add    %al,(%rax)
+  802d7d:	00 00                	add    %al,(%rax)
+  802d7f:	00 f2                	add    %dh,%dl
+  802d81:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d87:	00 c4                	add    %al,%ah
+  802d89:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d8f:	00 0a                	add    %cl,(%rdx)
+  802d91:	04 80                	add    $0x80,%al
+  802d93:	00 00                	add    %al,(%rax)
+  802d95:	00 00                	add    %al,(%rax)
+  802d97:	00 0a                	add    %cl,(%rdx)
+  802d99:	04 80                	add    $0x80,%al
+  802d9b:	00 00                	add    %al,(%rax)
+  802d9d:	00 00                	add    %al,(%rax)
+  802d9f:	00 0a                	add    %cl,(%rdx)
+  802da1:	04 80                	add    $0x80,%al
+  802da3:	00 00                	add    %al,(%rax)
+  802da5:	00 00                	add    %al,(%rax)
+  802da7:	00 0a                	add    %cl,(%rdx)
+  802da9:	04 80                	add    $0x80,%al
+  802dab:	00 00                	add    %al,(%rax)
+  802dad:	00 00                	add    %al,(%rax)
+  802daf:	00 0a                	add    %cl,(%rdx)
+  802db1:	04 80                	add    $0x80,%al
+  802db3:	00 00                	add    %al,(%rax)
+  802db5:	00 00                	add    %al,(%rax)
+  802db7:	00 0a                	add    %cl,(%rdx)
+  802db9:	04 80                	add    $0x80,%al
+  802dbb:	00 00                	add    %al,(%rax)
+  802dbd:	00 00                	add    %al,(%rax)
+  802dbf:	00 0a                	add    %cl,(%rdx)
+  802dc1:	04 80                	add    $0x80,%al
+  802dc3:	00 00                	add    %al,(%rax)
+  802dc5:	00 00                	add    %al,(%rax)
+  802dc7:	00 0a                	add    %cl,(%rdx)
+  802dc9:	04 80                	add    $0x80,%al
+  802dcb:	00 00                	add    %al,(%rax)
+  802dcd:	00 00                	add    %al,(%rax)
+  802dcf:	00 0a                	add    %cl,(%rdx)
+  802dd1:	04 80                	add    $0x80,%al
+  802dd3:	00 00                	add    %al,(%rax)
+  802dd5:	00 00                	add    %al,(%rax)
+  802dd7:	00 f2                	add    %dh,%dl
+  802dd9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ddf:	00 f2                	add    %dh,%dl
+  802de1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802de7:	00 f2                	add    %dh,%dl
+  802de9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802def:	00 f2                	add    %dh,%dl
+  802df1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802df7:	00 f2                	add    %dh,%dl
+  802df9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802dff:	00 f2                	add    %dh,%dl
+  802e01:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e07:	00 f2                	add    %dh,%dl
+  802e09:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e0f:	00 f2                	add    %dh,%dl
+  802e11:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e17:	00 f2                	add    %dh,%dl
+  802e19:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e1f:	00 f2                	add    %dh,%dl
+  802e21:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e27:	00 f2                	add    %dh,%dl
+  802e29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e2f:	00 f2                	add    %dh,%dl
+  802e31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e37:	00 f2                	add    %dh,%dl
+  802e39:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e3f:	00 f2                	add    %dh,%dl
+  802e41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e47:	00 f2                	add    %dh,%dl
+  802e49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e4f:	00 f2                	add    %dh,%dl
+  802e51:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e57:	00 f2                	add    %dh,%dl
+  802e59:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e5f:	00 f2                	add    %dh,%dl
+  802e61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e67:	00 f2                	add    %dh,%dl
+  802e69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e6f:	00 f2                	add    %dh,%dl
+  802e71:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e77:	00 f2                	add    %dh,%dl
+  802e79:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e7f:	00 f2                	add    %dh,%dl
+  802e81:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e87:	00 f2                	add    %dh,%dl
+  802e89:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e8f:	00 f2                	add    %dh,%dl
+  802e91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e97:	00 f2                	add    %dh,%dl
+  802e99:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e9f:	00 f2                	add    %dh,%dl
+  802ea1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ea7:	00 f2                	add    %dh,%dl
+  802ea9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eaf:	00 f2                	add    %dh,%dl
+  802eb1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eb7:	00 f2                	add    %dh,%dl
+  802eb9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ebf:	00 f2                	add    %dh,%dl
+  802ec1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ec7:	00 15 09 80 00 00    	add    %dl,0x8009(%rip)        # 80aed6 <__bss_end+0x2ed6>
+  802ecd:	00 00                	add    %al,(%rax)
+  802ecf:	00 f2                	add    %dh,%dl
+  802ed1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ed7:	00 f2                	add    %dh,%dl
+  802ed9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802edf:	00 f2                	add    %dh,%dl
+  802ee1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ee7:	00 f2                	add    %dh,%dl
+  802ee9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eef:	00 f2                	add    %dh,%dl
+  802ef1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ef7:	00 f2                	add    %dh,%dl
+  802ef9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eff:	00 f2                	add    %dh,%dl
+  802f01:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f07:	00 f2                	add    %dh,%dl
+  802f09:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f0f:	00 f2                	add    %dh,%dl
+  802f11:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f17:	00 f2                	add    %dh,%dl
+  802f19:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f1f:	00 61 04             	add    %ah,0x4(%rcx)
+  802f22:	80 00 00             	addb   $0x0,(%rax)
+  802f25:	00 00                	add    %al,(%rax)
+  802f27:	00 30                	add    %dh,(%rax)
+  802f29:	06                   	(bad)
+  802f2a:	80 00 00             	addb   $0x0,(%rax)
+  802f2d:	00 00                	add    %al,(%rax)
+  802f2f:	00 f2                	add    %dh,%dl
+  802f31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f37:	00 f2                	add    %dh,%dl
+  802f39:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f3f:	00 f2                	add    %dh,%dl
+  802f41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f47:	00 f2                	add    %dh,%dl
+  802f49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f4f:	00 90 04 80 00 00    	add    %dl,0x8004(%rax)
+  802f55:	00 00                	add    %al,(%rax)
+  802f57:	00 f2                	add    %dh,%dl
+  802f59:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f5f:	00 f2                	add    %dh,%dl
+  802f61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f67:	00 56 04             	add    %dl,0x4(%rsi)
+  802f6a:	80 00 00             	addb   $0x0,(%rax)
+  802f6d:	00 00                	add    %al,(%rax)
+  802f6f:	00 f2                	add    %dh,%dl
+  802f71:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f77:	00 f2                	add    %dh,%dl
+  802f79:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f7f:	00 d8                	add    %bl,%al
+  802f81:	07                   	(bad)
+  802f82:	80 00 00             	addb   $0x0,(%rax)
+  802f85:	00 00                	add    %al,(%rax)
+  802f87:	00 a2 08 80 00 00    	add    %ah,0x8008(%rdx)
+  802f8d:	00 00                	add    %al,(%rax)
+  802f8f:	00 f2                	add    %dh,%dl
+  802f91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f97:	00 f2                	add    %dh,%dl
+  802f99:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f9f:	00 27                	add    %ah,(%rdi)
+  802fa1:	05 80 00 00 00       	add    $0x80,%eax
+  802fa6:	00 00                	add    %al,(%rax)
+  802fa8:	f2 09 80 00 00 00 00 	repnz or %eax,0x0(%rax)
+  802faf:	00 04 07             	add    %al,(%rdi,%rax,1)
+  802fb2:	80 00 00             	addb   $0x0,(%rax)
+  802fb5:	00 00                	add    %al,(%rax)
+  802fb7:	00 f2                	add    %dh,%dl
+  802fb9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fbf:	00 f2                	add    %dh,%dl
+  802fc1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fc7:	00 15 09 80 00 00    	add    %dl,0x8009(%rip)        # 80afd6 <__bss_end+0x2fd6>
+  802fcd:	00 00                	add    %al,(%rax)
+  802fcf:	00 f2                	add    %dh,%dl
+  802fd1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fd7:	00 ba 03 80 00 00    	add    %bh,0x8003(%rdx)
+  802fdd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000802fe0 <error_string>:
+	...
+  802fe8:	92 2b 80 00 00 00 00 00 a4 2b 80 00 00 00 00 00     .+.......+......
+  802ff8:	b4 2b 80 00 00 00 00 00 c6 2b 80 00 00 00 00 00     .+.......+......
+  803008:	d4 2b 80 00 00 00 00 00 e8 2b 80 00 00 00 00 00     .+.......+......
+  803018:	fd 2b 80 00 00 00 00 00 10 2c 80 00 00 00 00 00     .+.......,......
+  803028:	22 2c 80 00 00 00 00 00 36 2c 80 00 00 00 00 00     ",......6,......
+  803038:	46 2c 80 00 00 00 00 00 59 2c 80 00 00 00 00 00     F,......Y,......
+  803048:	70 2c 80 00 00 00 00 00 86 2c 80 00 00 00 00 00     p,.......,......
+  803058:	9e 2c 80 00 00 00 00 00 b6 2c 80 00 00 00 00 00     .,.......,......
+  803068:	c3 2c 80 00 00 00 00 00 90 30 80 00 00 00 00 00     .,.......0......
+  803078:	d7 2c 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .,..............
+  803088:	ef 2c 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .,......file is 
+  803098:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8030a8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8030b8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8030c8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8030d8:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  8030e8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8030f8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803108:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803118:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803128:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803138:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803148:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803158:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803160 <devtab>:
+  803160:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803170:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803180:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803190:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8031a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8031b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8031c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8031d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8031e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8031f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803200:	3a 20 00 69 70 63 5f 73 65 6e 64 3a 20 66 61 69     : .ipc_send: fai
+  803210:	6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62 2f     led to send.lib/
+  803220:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803230:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803240:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803250:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803260:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803270:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803280:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803290:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8032e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803300:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803310:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803320:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803330:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803340:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803350:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803360:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803370:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803380:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803390:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803400:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803410:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803420:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803430:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803440:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803450:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803460:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803470:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803480:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803490:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803500:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803510:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803520:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803530:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803540:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803550:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803560:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803570:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803580:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803590:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803600:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803610:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803620:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803630:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803640:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803650:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803660:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803670:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803680:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803690:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803700:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803710:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803720:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803730:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803740:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803750:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803760:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803770:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803780:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803790:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803800:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803810:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
@@ -0,0 +1,5663 @@
+
+obj/user/faultreadkernel:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2f 00 00 00       	call   800052 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Buggy program - faults with a read from kernel space */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("I read %08x from location 0x8040000000!\n", *(unsigned *)0x8040000000);
+  800029:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  800030:	00 00 00 
+  800033:	8b 30                	mov    (%rax),%esi
+  800035:	48 bf 40 2b 80 00 00 	movabs $0x802b40,%rdi
+  80003c:	00 00 00 
+  80003f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800044:	48 ba c9 01 80 00 00 	movabs $0x8001c9,%rdx
+  80004b:	00 00 00 
+  80004e:	ff d2                	call   *%rdx
+}
+  800050:	5d                   	pop    %rbp
+  800051:	c3                   	ret
+
+0000000000800052 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 56                	push   %r14
+  800058:	41 55                	push   %r13
+  80005a:	41 54                	push   %r12
+  80005c:	53                   	push   %rbx
+  80005d:	41 89 fd             	mov    %edi,%r13d
+  800060:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800063:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80006a:	00 00 00 
+  80006d:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800074:	00 00 00 
+  800077:	48 39 c2             	cmp    %rax,%rdx
+  80007a:	73 17                	jae    800093 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80007c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007f:	49 89 c4             	mov    %rax,%r12
+  800082:	48 83 c3 08          	add    $0x8,%rbx
+  800086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008b:	ff 53 f8             	call   *-0x8(%rbx)
+  80008e:	4c 39 e3             	cmp    %r12,%rbx
+  800091:	72 ef                	jb     800082 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800093:	48 b8 de 0f 80 00 00 	movabs $0x800fde,%rax
+  80009a:	00 00 00 
+  80009d:	ff d0                	call   *%rax
+  80009f:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8000a2:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8000a9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000b0:	00 00 00 
+  8000b3:	48 01 d0             	add    %rdx,%rax
+  8000b6:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000bd:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000c0:	45 85 ed             	test   %r13d,%r13d
+  8000c3:	7e 0d                	jle    8000d2 <libmain+0x80>
+  8000c5:	49 8b 06             	mov    (%r14),%rax
+  8000c8:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000cf:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d2:	4c 89 f6             	mov    %r14,%rsi
+  8000d5:	44 89 ef             	mov    %r13d,%edi
+  8000d8:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000df:	00 00 00 
+  8000e2:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e4:	48 b8 f9 00 80 00 00 	movabs $0x8000f9,%rax
+  8000eb:	00 00 00 
+  8000ee:	ff d0                	call   *%rax
+#endif
+}
+  8000f0:	5b                   	pop    %rbx
+  8000f1:	41 5c                	pop    %r12
+  8000f3:	41 5d                	pop    %r13
+  8000f5:	41 5e                	pop    %r14
+  8000f7:	5d                   	pop    %rbp
+  8000f8:	c3                   	ret
+
+00000000008000f9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f9:	55                   	push   %rbp
+  8000fa:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000fd:	48 b8 66 18 80 00 00 	movabs $0x801866,%rax
+  800104:	00 00 00 
+  800107:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800109:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010e:	48 b8 73 0f 80 00 00 	movabs $0x800f73,%rax
+  800115:	00 00 00 
+  800118:	ff d0                	call   *%rax
+}
+  80011a:	5d                   	pop    %rbp
+  80011b:	c3                   	ret
+
+000000000080011c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80011c:	55                   	push   %rbp
+  80011d:	48 89 e5             	mov    %rsp,%rbp
+  800120:	53                   	push   %rbx
+  800121:	48 83 ec 08          	sub    $0x8,%rsp
+  800125:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800128:	8b 06                	mov    (%rsi),%eax
+  80012a:	8d 50 01             	lea    0x1(%rax),%edx
+  80012d:	89 16                	mov    %edx,(%rsi)
+  80012f:	48 98                	cltq
+  800131:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800136:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80013c:	74 0a                	je     800148 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80013e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800142:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800146:	c9                   	leave
+  800147:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800148:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80014c:	be ff 00 00 00       	mov    $0xff,%esi
+  800151:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  800158:	00 00 00 
+  80015b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80015d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800163:	eb d9                	jmp    80013e <putch+0x22>
+
+0000000000800165 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800165:	55                   	push   %rbp
+  800166:	48 89 e5             	mov    %rsp,%rbp
+  800169:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800170:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800173:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80017a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80017f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800184:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800187:	48 89 f1             	mov    %rsi,%rcx
+  80018a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800191:	48 bf 1c 01 80 00 00 	movabs $0x80011c,%rdi
+  800198:	00 00 00 
+  80019b:	48 b8 19 03 80 00 00 	movabs $0x800319,%rax
+  8001a2:	00 00 00 
+  8001a5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001a7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001ae:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001b5:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  8001bc:	00 00 00 
+  8001bf:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001c1:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001c7:	c9                   	leave
+  8001c8:	c3                   	ret
+
+00000000008001c9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001c9:	55                   	push   %rbp
+  8001ca:	48 89 e5             	mov    %rsp,%rbp
+  8001cd:	48 83 ec 50          	sub    $0x50,%rsp
+  8001d1:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001d5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001d9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001dd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001e1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001e5:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001ec:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8001f4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8001f8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8001fc:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800200:	48 b8 65 01 80 00 00 	movabs $0x800165,%rax
+  800207:	00 00 00 
+  80020a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80020c:	c9                   	leave
+  80020d:	c3                   	ret
+
+000000000080020e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80020e:	55                   	push   %rbp
+  80020f:	48 89 e5             	mov    %rsp,%rbp
+  800212:	41 57                	push   %r15
+  800214:	41 56                	push   %r14
+  800216:	41 55                	push   %r13
+  800218:	41 54                	push   %r12
+  80021a:	53                   	push   %rbx
+  80021b:	48 83 ec 18          	sub    $0x18,%rsp
+  80021f:	49 89 fc             	mov    %rdi,%r12
+  800222:	49 89 f5             	mov    %rsi,%r13
+  800225:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800229:	8b 45 10             	mov    0x10(%rbp),%eax
+  80022c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80022f:	41 89 cf             	mov    %ecx,%r15d
+  800232:	4c 39 fa             	cmp    %r15,%rdx
+  800235:	73 5b                	jae    800292 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800237:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80023b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80023f:	85 db                	test   %ebx,%ebx
+  800241:	7e 0e                	jle    800251 <print_num+0x43>
+            putch(padc, put_arg);
+  800243:	4c 89 ee             	mov    %r13,%rsi
+  800246:	44 89 f7             	mov    %r14d,%edi
+  800249:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80024c:	83 eb 01             	sub    $0x1,%ebx
+  80024f:	75 f2                	jne    800243 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800251:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800255:	48 b9 84 2b 80 00 00 	movabs $0x802b84,%rcx
+  80025c:	00 00 00 
+  80025f:	48 b8 73 2b 80 00 00 	movabs $0x802b73,%rax
+  800266:	00 00 00 
+  800269:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80026d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800271:	ba 00 00 00 00       	mov    $0x0,%edx
+  800276:	49 f7 f7             	div    %r15
+  800279:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80027d:	4c 89 ee             	mov    %r13,%rsi
+  800280:	41 ff d4             	call   *%r12
+}
+  800283:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800287:	5b                   	pop    %rbx
+  800288:	41 5c                	pop    %r12
+  80028a:	41 5d                	pop    %r13
+  80028c:	41 5e                	pop    %r14
+  80028e:	41 5f                	pop    %r15
+  800290:	5d                   	pop    %rbp
+  800291:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800292:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800296:	ba 00 00 00 00       	mov    $0x0,%edx
+  80029b:	49 f7 f7             	div    %r15
+  80029e:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002a6:	52                   	push   %rdx
+  8002a7:	45 0f be c9          	movsbl %r9b,%r9d
+  8002ab:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002af:	48 89 c2             	mov    %rax,%rdx
+  8002b2:	48 b8 0e 02 80 00 00 	movabs $0x80020e,%rax
+  8002b9:	00 00 00 
+  8002bc:	ff d0                	call   *%rax
+  8002be:	48 83 c4 10          	add    $0x10,%rsp
+  8002c2:	eb 8d                	jmp    800251 <print_num+0x43>
+
+00000000008002c4 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002c4:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002c8:	48 8b 06             	mov    (%rsi),%rax
+  8002cb:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002cf:	73 0a                	jae    8002db <sprintputch+0x17>
+        *state->start++ = ch;
+  8002d1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002d5:	48 89 16             	mov    %rdx,(%rsi)
+  8002d8:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002db:	c3                   	ret
+
+00000000008002dc <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002dc:	55                   	push   %rbp
+  8002dd:	48 89 e5             	mov    %rsp,%rbp
+  8002e0:	48 83 ec 50          	sub    $0x50,%rsp
+  8002e4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002e8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002ec:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002f0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8002f7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002ff:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800303:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800307:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80030b:	48 b8 19 03 80 00 00 	movabs $0x800319,%rax
+  800312:	00 00 00 
+  800315:	ff d0                	call   *%rax
+}
+  800317:	c9                   	leave
+  800318:	c3                   	ret
+
+0000000000800319 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800319:	55                   	push   %rbp
+  80031a:	48 89 e5             	mov    %rsp,%rbp
+  80031d:	41 57                	push   %r15
+  80031f:	41 56                	push   %r14
+  800321:	41 55                	push   %r13
+  800323:	41 54                	push   %r12
+  800325:	53                   	push   %rbx
+  800326:	48 83 ec 38          	sub    $0x38,%rsp
+  80032a:	49 89 fe             	mov    %rdi,%r14
+  80032d:	49 89 f5             	mov    %rsi,%r13
+  800330:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800333:	48 8b 01             	mov    (%rcx),%rax
+  800336:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80033a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80033e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800342:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800346:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80034a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80034e:	0f b6 3b             	movzbl (%rbx),%edi
+  800351:	40 80 ff 25          	cmp    $0x25,%dil
+  800355:	74 18                	je     80036f <vprintfmt+0x56>
+            if (!ch) return;
+  800357:	40 84 ff             	test   %dil,%dil
+  80035a:	0f 84 b1 06 00 00    	je     800a11 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800360:	40 0f b6 ff          	movzbl %dil,%edi
+  800364:	4c 89 ee             	mov    %r13,%rsi
+  800367:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80036a:	4c 89 e3             	mov    %r12,%rbx
+  80036d:	eb db                	jmp    80034a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80036f:	be 00 00 00 00       	mov    $0x0,%esi
+  800374:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800378:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80037d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800383:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80038a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80038e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800393:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800398:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80039b:	83 e8 23             	sub    $0x23,%eax
+  80039e:	3c 57                	cmp    $0x57,%al
+  8003a0:	0f 87 51 06 00 00    	ja     8009f7 <vprintfmt+0x6de>
+  8003a6:	0f b6 c0             	movzbl %al,%eax
+  8003a9:	48 b9 20 2d 80 00 00 	movabs $0x802d20,%rcx
+  8003b0:	00 00 00 
+  8003b3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003b6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003b9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003bd:	eb cf                	jmp    80038e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003bf:	49 89 dc             	mov    %rbx,%r12
+  8003c2:	be 01 00 00 00       	mov    $0x1,%esi
+  8003c7:	eb c5                	jmp    80038e <vprintfmt+0x75>
+            padc = ch;
+  8003c9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003cd:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003d0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003d3:	eb b9                	jmp    80038e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8003db:	77 24                	ja     800401 <vprintfmt+0xe8>
+  8003dd:	89 c1                	mov    %eax,%ecx
+  8003df:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003e3:	83 c0 08             	add    $0x8,%eax
+  8003e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003e9:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003ec:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003ef:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003f3:	79 99                	jns    80038e <vprintfmt+0x75>
+                width = precision;
+  8003f5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8003f9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003ff:	eb 8d                	jmp    80038e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800401:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800405:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800409:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80040d:	eb da                	jmp    8003e9 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80040f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800414:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800418:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80041e:	3c 39                	cmp    $0x39,%al
+  800420:	77 1c                	ja     80043e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800422:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800426:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80042a:	0f b6 c0             	movzbl %al,%eax
+  80042d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800432:	0f b6 03             	movzbl (%rbx),%eax
+  800435:	3c 39                	cmp    $0x39,%al
+  800437:	76 e9                	jbe    800422 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800439:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80043c:	eb b1                	jmp    8003ef <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80043e:	49 89 dc             	mov    %rbx,%r12
+  800441:	eb ac                	jmp    8003ef <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800443:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800446:	85 c9                	test   %ecx,%ecx
+  800448:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044d:	0f 49 c1             	cmovns %ecx,%eax
+  800450:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800453:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800456:	e9 33 ff ff ff       	jmp    80038e <vprintfmt+0x75>
+            lflag++;
+  80045b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80045e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800461:	e9 28 ff ff ff       	jmp    80038e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800466:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800469:	83 f8 2f             	cmp    $0x2f,%eax
+  80046c:	77 19                	ja     800487 <vprintfmt+0x16e>
+  80046e:	89 c2                	mov    %eax,%edx
+  800470:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800474:	83 c0 08             	add    $0x8,%eax
+  800477:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80047a:	8b 3a                	mov    (%rdx),%edi
+  80047c:	4c 89 ee             	mov    %r13,%rsi
+  80047f:	41 ff d6             	call   *%r14
+            break;
+  800482:	e9 c3 fe ff ff       	jmp    80034a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800487:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80048b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80048f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800493:	eb e5                	jmp    80047a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800495:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800498:	83 f8 2f             	cmp    $0x2f,%eax
+  80049b:	77 5a                	ja     8004f7 <vprintfmt+0x1de>
+  80049d:	89 c2                	mov    %eax,%edx
+  80049f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004a3:	83 c0 08             	add    $0x8,%eax
+  8004a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004a9:	8b 02                	mov    (%rdx),%eax
+  8004ab:	89 c1                	mov    %eax,%ecx
+  8004ad:	f7 d9                	neg    %ecx
+  8004af:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004b2:	83 f9 15             	cmp    $0x15,%ecx
+  8004b5:	7f 4e                	jg     800505 <vprintfmt+0x1ec>
+  8004b7:	48 63 c1             	movslq %ecx,%rax
+  8004ba:	48 ba e0 2f 80 00 00 	movabs $0x802fe0,%rdx
+  8004c1:	00 00 00 
+  8004c4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004c8:	48 85 c0             	test   %rax,%rax
+  8004cb:	74 38                	je     800505 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004cd:	48 89 c1             	mov    %rax,%rcx
+  8004d0:	48 ba 99 31 80 00 00 	movabs $0x803199,%rdx
+  8004d7:	00 00 00 
+  8004da:	4c 89 ee             	mov    %r13,%rsi
+  8004dd:	4c 89 f7             	mov    %r14,%rdi
+  8004e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e5:	49 b8 dc 02 80 00 00 	movabs $0x8002dc,%r8
+  8004ec:	00 00 00 
+  8004ef:	41 ff d0             	call   *%r8
+  8004f2:	e9 53 fe ff ff       	jmp    80034a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8004f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800503:	eb a4                	jmp    8004a9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800505:	48 ba 9c 2b 80 00 00 	movabs $0x802b9c,%rdx
+  80050c:	00 00 00 
+  80050f:	4c 89 ee             	mov    %r13,%rsi
+  800512:	4c 89 f7             	mov    %r14,%rdi
+  800515:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051a:	49 b8 dc 02 80 00 00 	movabs $0x8002dc,%r8
+  800521:	00 00 00 
+  800524:	41 ff d0             	call   *%r8
+  800527:	e9 1e fe ff ff       	jmp    80034a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80052c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80052f:	83 f8 2f             	cmp    $0x2f,%eax
+  800532:	77 6c                	ja     8005a0 <vprintfmt+0x287>
+  800534:	89 c2                	mov    %eax,%edx
+  800536:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80053a:	83 c0 08             	add    $0x8,%eax
+  80053d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800540:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800543:	48 85 d2             	test   %rdx,%rdx
+  800546:	48 b8 95 2b 80 00 00 	movabs $0x802b95,%rax
+  80054d:	00 00 00 
+  800550:	48 0f 45 c2          	cmovne %rdx,%rax
+  800554:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800558:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80055c:	7e 06                	jle    800564 <vprintfmt+0x24b>
+  80055e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800562:	75 4a                	jne    8005ae <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800564:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800568:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80056c:	0f b6 00             	movzbl (%rax),%eax
+  80056f:	84 c0                	test   %al,%al
+  800571:	0f 85 9a 00 00 00    	jne    800611 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800577:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80057a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80057e:	85 c0                	test   %eax,%eax
+  800580:	0f 8e c4 fd ff ff    	jle    80034a <vprintfmt+0x31>
+  800586:	4c 89 ee             	mov    %r13,%rsi
+  800589:	bf 20 00 00 00       	mov    $0x20,%edi
+  80058e:	41 ff d6             	call   *%r14
+  800591:	41 83 ec 01          	sub    $0x1,%r12d
+  800595:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800599:	75 eb                	jne    800586 <vprintfmt+0x26d>
+  80059b:	e9 aa fd ff ff       	jmp    80034a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005a4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005ac:	eb 92                	jmp    800540 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005ae:	49 63 f7             	movslq %r15d,%rsi
+  8005b1:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005b5:	48 b8 cb 0a 80 00 00 	movabs $0x800acb,%rax
+  8005bc:	00 00 00 
+  8005bf:	ff d0                	call   *%rax
+  8005c1:	48 89 c2             	mov    %rax,%rdx
+  8005c4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005c7:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005c9:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005cc:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005cf:	85 c0                	test   %eax,%eax
+  8005d1:	7e 91                	jle    800564 <vprintfmt+0x24b>
+  8005d3:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005d8:	4c 89 ee             	mov    %r13,%rsi
+  8005db:	44 89 e7             	mov    %r12d,%edi
+  8005de:	41 ff d6             	call   *%r14
+  8005e1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005e5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005e8:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005eb:	75 eb                	jne    8005d8 <vprintfmt+0x2bf>
+  8005ed:	e9 72 ff ff ff       	jmp    800564 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005f2:	0f b6 f8             	movzbl %al,%edi
+  8005f5:	4c 89 ee             	mov    %r13,%rsi
+  8005f8:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005fb:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005ff:	49 83 c4 01          	add    $0x1,%r12
+  800603:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800609:	84 c0                	test   %al,%al
+  80060b:	0f 84 66 ff ff ff    	je     800577 <vprintfmt+0x25e>
+  800611:	45 85 ff             	test   %r15d,%r15d
+  800614:	78 0a                	js     800620 <vprintfmt+0x307>
+  800616:	41 83 ef 01          	sub    $0x1,%r15d
+  80061a:	0f 88 57 ff ff ff    	js     800577 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800620:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800624:	74 cc                	je     8005f2 <vprintfmt+0x2d9>
+  800626:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800629:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80062e:	80 fa 5e             	cmp    $0x5e,%dl
+  800631:	77 c2                	ja     8005f5 <vprintfmt+0x2dc>
+  800633:	eb bd                	jmp    8005f2 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800635:	40 84 f6             	test   %sil,%sil
+  800638:	75 26                	jne    800660 <vprintfmt+0x347>
+    switch (lflag) {
+  80063a:	85 d2                	test   %edx,%edx
+  80063c:	74 59                	je     800697 <vprintfmt+0x37e>
+  80063e:	83 fa 01             	cmp    $0x1,%edx
+  800641:	74 7b                	je     8006be <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800643:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800646:	83 f8 2f             	cmp    $0x2f,%eax
+  800649:	0f 87 96 00 00 00    	ja     8006e5 <vprintfmt+0x3cc>
+  80064f:	89 c2                	mov    %eax,%edx
+  800651:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800655:	83 c0 08             	add    $0x8,%eax
+  800658:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80065b:	4c 8b 22             	mov    (%rdx),%r12
+  80065e:	eb 17                	jmp    800677 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800660:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800663:	83 f8 2f             	cmp    $0x2f,%eax
+  800666:	77 21                	ja     800689 <vprintfmt+0x370>
+  800668:	89 c2                	mov    %eax,%edx
+  80066a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80066e:	83 c0 08             	add    $0x8,%eax
+  800671:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800674:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800677:	4d 85 e4             	test   %r12,%r12
+  80067a:	78 7a                	js     8006f6 <vprintfmt+0x3dd>
+            num = i;
+  80067c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80067f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800684:	e9 50 02 00 00       	jmp    8008d9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800689:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80068d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800691:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800695:	eb dd                	jmp    800674 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800697:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80069a:	83 f8 2f             	cmp    $0x2f,%eax
+  80069d:	77 11                	ja     8006b0 <vprintfmt+0x397>
+  80069f:	89 c2                	mov    %eax,%edx
+  8006a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a5:	83 c0 08             	add    $0x8,%eax
+  8006a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ab:	4c 63 22             	movslq (%rdx),%r12
+  8006ae:	eb c7                	jmp    800677 <vprintfmt+0x35e>
+  8006b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006bc:	eb ed                	jmp    8006ab <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c4:	77 11                	ja     8006d7 <vprintfmt+0x3be>
+  8006c6:	89 c2                	mov    %eax,%edx
+  8006c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006cc:	83 c0 08             	add    $0x8,%eax
+  8006cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006d2:	4c 8b 22             	mov    (%rdx),%r12
+  8006d5:	eb a0                	jmp    800677 <vprintfmt+0x35e>
+  8006d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e3:	eb ed                	jmp    8006d2 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f1:	e9 65 ff ff ff       	jmp    80065b <vprintfmt+0x342>
+                putch('-', put_arg);
+  8006f6:	4c 89 ee             	mov    %r13,%rsi
+  8006f9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8006fe:	41 ff d6             	call   *%r14
+                i = -i;
+  800701:	49 f7 dc             	neg    %r12
+  800704:	e9 73 ff ff ff       	jmp    80067c <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800709:	40 84 f6             	test   %sil,%sil
+  80070c:	75 32                	jne    800740 <vprintfmt+0x427>
+    switch (lflag) {
+  80070e:	85 d2                	test   %edx,%edx
+  800710:	74 5d                	je     80076f <vprintfmt+0x456>
+  800712:	83 fa 01             	cmp    $0x1,%edx
+  800715:	0f 84 82 00 00 00    	je     80079d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80071b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071e:	83 f8 2f             	cmp    $0x2f,%eax
+  800721:	0f 87 a5 00 00 00    	ja     8007cc <vprintfmt+0x4b3>
+  800727:	89 c2                	mov    %eax,%edx
+  800729:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072d:	83 c0 08             	add    $0x8,%eax
+  800730:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800733:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800736:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80073b:	e9 99 01 00 00       	jmp    8008d9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800740:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800743:	83 f8 2f             	cmp    $0x2f,%eax
+  800746:	77 19                	ja     800761 <vprintfmt+0x448>
+  800748:	89 c2                	mov    %eax,%edx
+  80074a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80074e:	83 c0 08             	add    $0x8,%eax
+  800751:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800754:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800757:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80075c:	e9 78 01 00 00       	jmp    8008d9 <vprintfmt+0x5c0>
+  800761:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800765:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800769:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80076d:	eb e5                	jmp    800754 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80076f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800772:	83 f8 2f             	cmp    $0x2f,%eax
+  800775:	77 18                	ja     80078f <vprintfmt+0x476>
+  800777:	89 c2                	mov    %eax,%edx
+  800779:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80077d:	83 c0 08             	add    $0x8,%eax
+  800780:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800783:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800785:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80078a:	e9 4a 01 00 00       	jmp    8008d9 <vprintfmt+0x5c0>
+  80078f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800793:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800797:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80079b:	eb e6                	jmp    800783 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80079d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a3:	77 19                	ja     8007be <vprintfmt+0x4a5>
+  8007a5:	89 c2                	mov    %eax,%edx
+  8007a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ab:	83 c0 08             	add    $0x8,%eax
+  8007ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007b4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007b9:	e9 1b 01 00 00       	jmp    8008d9 <vprintfmt+0x5c0>
+  8007be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ca:	eb e5                	jmp    8007b1 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d8:	e9 56 ff ff ff       	jmp    800733 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007dd:	40 84 f6             	test   %sil,%sil
+  8007e0:	75 2e                	jne    800810 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007e2:	85 d2                	test   %edx,%edx
+  8007e4:	74 59                	je     80083f <vprintfmt+0x526>
+  8007e6:	83 fa 01             	cmp    $0x1,%edx
+  8007e9:	74 7f                	je     80086a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f1:	0f 87 9f 00 00 00    	ja     800896 <vprintfmt+0x57d>
+  8007f7:	89 c2                	mov    %eax,%edx
+  8007f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fd:	83 c0 08             	add    $0x8,%eax
+  800800:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800803:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800806:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80080b:	e9 c9 00 00 00       	jmp    8008d9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800810:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800813:	83 f8 2f             	cmp    $0x2f,%eax
+  800816:	77 19                	ja     800831 <vprintfmt+0x518>
+  800818:	89 c2                	mov    %eax,%edx
+  80081a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081e:	83 c0 08             	add    $0x8,%eax
+  800821:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800824:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800827:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80082c:	e9 a8 00 00 00       	jmp    8008d9 <vprintfmt+0x5c0>
+  800831:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800835:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800839:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083d:	eb e5                	jmp    800824 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80083f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800842:	83 f8 2f             	cmp    $0x2f,%eax
+  800845:	77 15                	ja     80085c <vprintfmt+0x543>
+  800847:	89 c2                	mov    %eax,%edx
+  800849:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084d:	83 c0 08             	add    $0x8,%eax
+  800850:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800853:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800855:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80085a:	eb 7d                	jmp    8008d9 <vprintfmt+0x5c0>
+  80085c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800860:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800864:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800868:	eb e9                	jmp    800853 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80086a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086d:	83 f8 2f             	cmp    $0x2f,%eax
+  800870:	77 16                	ja     800888 <vprintfmt+0x56f>
+  800872:	89 c2                	mov    %eax,%edx
+  800874:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800878:	83 c0 08             	add    $0x8,%eax
+  80087b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800881:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800886:	eb 51                	jmp    8008d9 <vprintfmt+0x5c0>
+  800888:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800890:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800894:	eb e8                	jmp    80087e <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800896:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a2:	e9 5c ff ff ff       	jmp    800803 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008a7:	4c 89 ee             	mov    %r13,%rsi
+  8008aa:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008af:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008b2:	4c 89 ee             	mov    %r13,%rsi
+  8008b5:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008ba:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c3:	77 47                	ja     80090c <vprintfmt+0x5f3>
+  8008c5:	89 c2                	mov    %eax,%edx
+  8008c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008cb:	83 c0 08             	add    $0x8,%eax
+  8008ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008d4:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8008dd:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008e1:	0f 94 c0             	sete   %al
+  8008e4:	0f b6 c0             	movzbl %al,%eax
+  8008e7:	50                   	push   %rax
+  8008e8:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008ed:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008f1:	4c 89 ee             	mov    %r13,%rsi
+  8008f4:	4c 89 f7             	mov    %r14,%rdi
+  8008f7:	48 b8 0e 02 80 00 00 	movabs $0x80020e,%rax
+  8008fe:	00 00 00 
+  800901:	ff d0                	call   *%rax
+            break;
+  800903:	48 83 c4 10          	add    $0x10,%rsp
+  800907:	e9 3e fa ff ff       	jmp    80034a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80090c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800910:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800914:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800918:	eb b7                	jmp    8008d1 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80091a:	40 84 f6             	test   %sil,%sil
+  80091d:	75 2b                	jne    80094a <vprintfmt+0x631>
+    switch (lflag) {
+  80091f:	85 d2                	test   %edx,%edx
+  800921:	74 56                	je     800979 <vprintfmt+0x660>
+  800923:	83 fa 01             	cmp    $0x1,%edx
+  800926:	74 7f                	je     8009a7 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800928:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092b:	83 f8 2f             	cmp    $0x2f,%eax
+  80092e:	0f 87 a2 00 00 00    	ja     8009d6 <vprintfmt+0x6bd>
+  800934:	89 c2                	mov    %eax,%edx
+  800936:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093a:	83 c0 08             	add    $0x8,%eax
+  80093d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800940:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800943:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800948:	eb 8f                	jmp    8008d9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80094a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094d:	83 f8 2f             	cmp    $0x2f,%eax
+  800950:	77 19                	ja     80096b <vprintfmt+0x652>
+  800952:	89 c2                	mov    %eax,%edx
+  800954:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800958:	83 c0 08             	add    $0x8,%eax
+  80095b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800961:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800966:	e9 6e ff ff ff       	jmp    8008d9 <vprintfmt+0x5c0>
+  80096b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800973:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800977:	eb e5                	jmp    80095e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800979:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097c:	83 f8 2f             	cmp    $0x2f,%eax
+  80097f:	77 18                	ja     800999 <vprintfmt+0x680>
+  800981:	89 c2                	mov    %eax,%edx
+  800983:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800987:	83 c0 08             	add    $0x8,%eax
+  80098a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80098f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800994:	e9 40 ff ff ff       	jmp    8008d9 <vprintfmt+0x5c0>
+  800999:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a5:	eb e6                	jmp    80098d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ad:	77 19                	ja     8009c8 <vprintfmt+0x6af>
+  8009af:	89 c2                	mov    %eax,%edx
+  8009b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b5:	83 c0 08             	add    $0x8,%eax
+  8009b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009be:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009c3:	e9 11 ff ff ff       	jmp    8008d9 <vprintfmt+0x5c0>
+  8009c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d4:	eb e5                	jmp    8009bb <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e2:	e9 59 ff ff ff       	jmp    800940 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009e7:	4c 89 ee             	mov    %r13,%rsi
+  8009ea:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009ef:	41 ff d6             	call   *%r14
+            break;
+  8009f2:	e9 53 f9 ff ff       	jmp    80034a <vprintfmt+0x31>
+            putch('%', put_arg);
+  8009f7:	4c 89 ee             	mov    %r13,%rsi
+  8009fa:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009ff:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a02:	48 83 eb 01          	sub    $0x1,%rbx
+  800a06:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a0a:	75 f6                	jne    800a02 <vprintfmt+0x6e9>
+  800a0c:	e9 39 f9 ff ff       	jmp    80034a <vprintfmt+0x31>
+}
+  800a11:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a15:	5b                   	pop    %rbx
+  800a16:	41 5c                	pop    %r12
+  800a18:	41 5d                	pop    %r13
+  800a1a:	41 5e                	pop    %r14
+  800a1c:	41 5f                	pop    %r15
+  800a1e:	5d                   	pop    %rbp
+  800a1f:	c3                   	ret
+
+0000000000800a20 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a20:	55                   	push   %rbp
+  800a21:	48 89 e5             	mov    %rsp,%rbp
+  800a24:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a28:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a2c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a31:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a35:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a3c:	48 85 ff             	test   %rdi,%rdi
+  800a3f:	74 2b                	je     800a6c <vsnprintf+0x4c>
+  800a41:	48 85 f6             	test   %rsi,%rsi
+  800a44:	74 26                	je     800a6c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a46:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a4a:	48 bf c4 02 80 00 00 	movabs $0x8002c4,%rdi
+  800a51:	00 00 00 
+  800a54:	48 b8 19 03 80 00 00 	movabs $0x800319,%rax
+  800a5b:	00 00 00 
+  800a5e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a60:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a64:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a67:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a6a:	c9                   	leave
+  800a6b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a71:	eb f7                	jmp    800a6a <vsnprintf+0x4a>
+
+0000000000800a73 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a73:	55                   	push   %rbp
+  800a74:	48 89 e5             	mov    %rsp,%rbp
+  800a77:	48 83 ec 50          	sub    $0x50,%rsp
+  800a7b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a7f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a83:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a87:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a8e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a96:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800a9a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800a9e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800aa2:	48 b8 20 0a 80 00 00 	movabs $0x800a20,%rax
+  800aa9:	00 00 00 
+  800aac:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800aae:	c9                   	leave
+  800aaf:	c3                   	ret
+
+0000000000800ab0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ab0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ab3:	74 10                	je     800ac5 <strlen+0x15>
+    size_t n = 0;
+  800ab5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800aba:	48 83 c0 01          	add    $0x1,%rax
+  800abe:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ac2:	75 f6                	jne    800aba <strlen+0xa>
+  800ac4:	c3                   	ret
+    size_t n = 0;
+  800ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800aca:	c3                   	ret
+
+0000000000800acb <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800acb:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ace:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ad3:	48 85 f6             	test   %rsi,%rsi
+  800ad6:	74 11                	je     800ae9 <strnlen+0x1e>
+  800ad8:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800adc:	74 0c                	je     800aea <strnlen+0x1f>
+  800ade:	48 83 c2 01          	add    $0x1,%rdx
+  800ae2:	48 39 d0             	cmp    %rdx,%rax
+  800ae5:	75 f1                	jne    800ad8 <strnlen+0xd>
+  800ae7:	eb 04                	jmp    800aed <strnlen+0x22>
+  800ae9:	c3                   	ret
+  800aea:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800aed:	c3                   	ret
+
+0000000000800aee <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800aee:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800af1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800af6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800afa:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800afd:	48 83 c2 01          	add    $0x1,%rdx
+  800b01:	84 c9                	test   %cl,%cl
+  800b03:	75 f1                	jne    800af6 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b05:	c3                   	ret
+
+0000000000800b06 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b06:	55                   	push   %rbp
+  800b07:	48 89 e5             	mov    %rsp,%rbp
+  800b0a:	41 54                	push   %r12
+  800b0c:	53                   	push   %rbx
+  800b0d:	48 89 fb             	mov    %rdi,%rbx
+  800b10:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b13:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  800b1a:	00 00 00 
+  800b1d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b1f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b23:	4c 89 e6             	mov    %r12,%rsi
+  800b26:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  800b2d:	00 00 00 
+  800b30:	ff d0                	call   *%rax
+    return dst;
+}
+  800b32:	48 89 d8             	mov    %rbx,%rax
+  800b35:	5b                   	pop    %rbx
+  800b36:	41 5c                	pop    %r12
+  800b38:	5d                   	pop    %rbp
+  800b39:	c3                   	ret
+
+0000000000800b3a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b3a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b3d:	48 85 d2             	test   %rdx,%rdx
+  800b40:	74 1f                	je     800b61 <strncpy+0x27>
+  800b42:	48 01 fa             	add    %rdi,%rdx
+  800b45:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b48:	48 83 c1 01          	add    $0x1,%rcx
+  800b4c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b50:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b54:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b58:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b5c:	48 39 ca             	cmp    %rcx,%rdx
+  800b5f:	75 e7                	jne    800b48 <strncpy+0xe>
+    }
+    return ret;
+}
+  800b61:	c3                   	ret
+
+0000000000800b62 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b62:	48 89 f8             	mov    %rdi,%rax
+  800b65:	48 85 d2             	test   %rdx,%rdx
+  800b68:	74 24                	je     800b8e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b6a:	48 83 ea 01          	sub    $0x1,%rdx
+  800b6e:	74 1b                	je     800b8b <strlcpy+0x29>
+  800b70:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b74:	0f b6 16             	movzbl (%rsi),%edx
+  800b77:	84 d2                	test   %dl,%dl
+  800b79:	74 10                	je     800b8b <strlcpy+0x29>
+            *dst++ = *src++;
+  800b7b:	48 83 c6 01          	add    $0x1,%rsi
+  800b7f:	48 83 c0 01          	add    $0x1,%rax
+  800b83:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b86:	48 39 c8             	cmp    %rcx,%rax
+  800b89:	75 e9                	jne    800b74 <strlcpy+0x12>
+        *dst = '\0';
+  800b8b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800b8e:	48 29 f8             	sub    %rdi,%rax
+}
+  800b91:	c3                   	ret
+
+0000000000800b92 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800b92:	0f b6 07             	movzbl (%rdi),%eax
+  800b95:	84 c0                	test   %al,%al
+  800b97:	74 13                	je     800bac <strcmp+0x1a>
+  800b99:	38 06                	cmp    %al,(%rsi)
+  800b9b:	75 0f                	jne    800bac <strcmp+0x1a>
+  800b9d:	48 83 c7 01          	add    $0x1,%rdi
+  800ba1:	48 83 c6 01          	add    $0x1,%rsi
+  800ba5:	0f b6 07             	movzbl (%rdi),%eax
+  800ba8:	84 c0                	test   %al,%al
+  800baa:	75 ed                	jne    800b99 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bac:	0f b6 c0             	movzbl %al,%eax
+  800baf:	0f b6 16             	movzbl (%rsi),%edx
+  800bb2:	29 d0                	sub    %edx,%eax
+}
+  800bb4:	c3                   	ret
+
+0000000000800bb5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bb5:	48 85 d2             	test   %rdx,%rdx
+  800bb8:	74 1f                	je     800bd9 <strncmp+0x24>
+  800bba:	0f b6 07             	movzbl (%rdi),%eax
+  800bbd:	84 c0                	test   %al,%al
+  800bbf:	74 1e                	je     800bdf <strncmp+0x2a>
+  800bc1:	3a 06                	cmp    (%rsi),%al
+  800bc3:	75 1a                	jne    800bdf <strncmp+0x2a>
+  800bc5:	48 83 c7 01          	add    $0x1,%rdi
+  800bc9:	48 83 c6 01          	add    $0x1,%rsi
+  800bcd:	48 83 ea 01          	sub    $0x1,%rdx
+  800bd1:	75 e7                	jne    800bba <strncmp+0x5>
+
+    if (!n) return 0;
+  800bd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd8:	c3                   	ret
+  800bd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bde:	c3                   	ret
+  800bdf:	48 85 d2             	test   %rdx,%rdx
+  800be2:	74 09                	je     800bed <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800be4:	0f b6 07             	movzbl (%rdi),%eax
+  800be7:	0f b6 16             	movzbl (%rsi),%edx
+  800bea:	29 d0                	sub    %edx,%eax
+  800bec:	c3                   	ret
+    if (!n) return 0;
+  800bed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bf2:	c3                   	ret
+
+0000000000800bf3 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800bf3:	0f b6 17             	movzbl (%rdi),%edx
+  800bf6:	84 d2                	test   %dl,%dl
+  800bf8:	74 18                	je     800c12 <strchr+0x1f>
+        if (*str == c) {
+  800bfa:	0f be d2             	movsbl %dl,%edx
+  800bfd:	39 f2                	cmp    %esi,%edx
+  800bff:	74 17                	je     800c18 <strchr+0x25>
+    for (; *str; str++) {
+  800c01:	48 83 c7 01          	add    $0x1,%rdi
+  800c05:	0f b6 17             	movzbl (%rdi),%edx
+  800c08:	84 d2                	test   %dl,%dl
+  800c0a:	75 ee                	jne    800bfa <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c11:	c3                   	ret
+  800c12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c17:	c3                   	ret
+  800c18:	48 89 f8             	mov    %rdi,%rax
+}
+  800c1b:	c3                   	ret
+
+0000000000800c1c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c1c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c1f:	0f b6 17             	movzbl (%rdi),%edx
+  800c22:	84 d2                	test   %dl,%dl
+  800c24:	74 13                	je     800c39 <strfind+0x1d>
+  800c26:	0f be d2             	movsbl %dl,%edx
+  800c29:	39 f2                	cmp    %esi,%edx
+  800c2b:	74 0b                	je     800c38 <strfind+0x1c>
+  800c2d:	48 83 c0 01          	add    $0x1,%rax
+  800c31:	0f b6 10             	movzbl (%rax),%edx
+  800c34:	84 d2                	test   %dl,%dl
+  800c36:	75 ee                	jne    800c26 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c38:	c3                   	ret
+  800c39:	c3                   	ret
+
+0000000000800c3a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c3a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c3d:	48 89 f8             	mov    %rdi,%rax
+  800c40:	48 f7 d8             	neg    %rax
+  800c43:	83 e0 07             	and    $0x7,%eax
+  800c46:	49 89 d1             	mov    %rdx,%r9
+  800c49:	49 29 c1             	sub    %rax,%r9
+  800c4c:	78 36                	js     800c84 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c4e:	40 0f b6 c6          	movzbl %sil,%eax
+  800c52:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c59:	01 01 01 
+  800c5c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c60:	40 f6 c7 07          	test   $0x7,%dil
+  800c64:	75 38                	jne    800c9e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c66:	4c 89 c9             	mov    %r9,%rcx
+  800c69:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c6d:	74 0c                	je     800c7b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c6f:	fc                   	cld
+  800c70:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c73:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c77:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c7b:	4d 85 c9             	test   %r9,%r9
+  800c7e:	75 45                	jne    800cc5 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c80:	4c 89 c0             	mov    %r8,%rax
+  800c83:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c84:	48 85 d2             	test   %rdx,%rdx
+  800c87:	74 f7                	je     800c80 <memset+0x46>
+  800c89:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c8c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800c8f:	48 83 c0 01          	add    $0x1,%rax
+  800c93:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800c97:	48 39 c2             	cmp    %rax,%rdx
+  800c9a:	75 f3                	jne    800c8f <memset+0x55>
+  800c9c:	eb e2                	jmp    800c80 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800c9e:	40 f6 c7 01          	test   $0x1,%dil
+  800ca2:	74 06                	je     800caa <memset+0x70>
+  800ca4:	88 07                	mov    %al,(%rdi)
+  800ca6:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800caa:	40 f6 c7 02          	test   $0x2,%dil
+  800cae:	74 07                	je     800cb7 <memset+0x7d>
+  800cb0:	66 89 07             	mov    %ax,(%rdi)
+  800cb3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cb7:	40 f6 c7 04          	test   $0x4,%dil
+  800cbb:	74 a9                	je     800c66 <memset+0x2c>
+  800cbd:	89 07                	mov    %eax,(%rdi)
+  800cbf:	48 83 c7 04          	add    $0x4,%rdi
+  800cc3:	eb a1                	jmp    800c66 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cc5:	41 f6 c1 04          	test   $0x4,%r9b
+  800cc9:	74 06                	je     800cd1 <memset+0x97>
+  800ccb:	89 07                	mov    %eax,(%rdi)
+  800ccd:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cd1:	41 f6 c1 02          	test   $0x2,%r9b
+  800cd5:	74 07                	je     800cde <memset+0xa4>
+  800cd7:	66 89 07             	mov    %ax,(%rdi)
+  800cda:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800cde:	41 f6 c1 01          	test   $0x1,%r9b
+  800ce2:	74 9c                	je     800c80 <memset+0x46>
+  800ce4:	88 07                	mov    %al,(%rdi)
+  800ce6:	eb 98                	jmp    800c80 <memset+0x46>
+
+0000000000800ce8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ce8:	48 89 f8             	mov    %rdi,%rax
+  800ceb:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800cee:	48 39 fe             	cmp    %rdi,%rsi
+  800cf1:	73 3b                	jae    800d2e <memmove+0x46>
+  800cf3:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800cf7:	48 39 d7             	cmp    %rdx,%rdi
+  800cfa:	73 32                	jae    800d2e <memmove+0x46>
+        s += n;
+        d += n;
+  800cfc:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d00:	48 89 d6             	mov    %rdx,%rsi
+  800d03:	48 09 fe             	or     %rdi,%rsi
+  800d06:	48 09 ce             	or     %rcx,%rsi
+  800d09:	40 f6 c6 07          	test   $0x7,%sil
+  800d0d:	75 12                	jne    800d21 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d0f:	48 83 ef 08          	sub    $0x8,%rdi
+  800d13:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d17:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d1b:	fd                   	std
+  800d1c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d1f:	fc                   	cld
+  800d20:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d21:	48 83 ef 01          	sub    $0x1,%rdi
+  800d25:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d29:	fd                   	std
+  800d2a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d2c:	eb f1                	jmp    800d1f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d2e:	48 89 f2             	mov    %rsi,%rdx
+  800d31:	48 09 c2             	or     %rax,%rdx
+  800d34:	48 09 ca             	or     %rcx,%rdx
+  800d37:	f6 c2 07             	test   $0x7,%dl
+  800d3a:	75 0c                	jne    800d48 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d3c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d40:	48 89 c7             	mov    %rax,%rdi
+  800d43:	fc                   	cld
+  800d44:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d47:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d48:	48 89 c7             	mov    %rax,%rdi
+  800d4b:	fc                   	cld
+  800d4c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d4e:	c3                   	ret
+
+0000000000800d4f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d4f:	55                   	push   %rbp
+  800d50:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d53:	48 b8 e8 0c 80 00 00 	movabs $0x800ce8,%rax
+  800d5a:	00 00 00 
+  800d5d:	ff d0                	call   *%rax
+}
+  800d5f:	5d                   	pop    %rbp
+  800d60:	c3                   	ret
+
+0000000000800d61 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d61:	55                   	push   %rbp
+  800d62:	48 89 e5             	mov    %rsp,%rbp
+  800d65:	41 57                	push   %r15
+  800d67:	41 56                	push   %r14
+  800d69:	41 55                	push   %r13
+  800d6b:	41 54                	push   %r12
+  800d6d:	53                   	push   %rbx
+  800d6e:	48 83 ec 08          	sub    $0x8,%rsp
+  800d72:	49 89 fe             	mov    %rdi,%r14
+  800d75:	49 89 f7             	mov    %rsi,%r15
+  800d78:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d7b:	48 89 f7             	mov    %rsi,%rdi
+  800d7e:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  800d85:	00 00 00 
+  800d88:	ff d0                	call   *%rax
+  800d8a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d8d:	48 89 de             	mov    %rbx,%rsi
+  800d90:	4c 89 f7             	mov    %r14,%rdi
+  800d93:	48 b8 cb 0a 80 00 00 	movabs $0x800acb,%rax
+  800d9a:	00 00 00 
+  800d9d:	ff d0                	call   *%rax
+  800d9f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800da2:	48 39 c3             	cmp    %rax,%rbx
+  800da5:	74 36                	je     800ddd <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800da7:	48 89 d8             	mov    %rbx,%rax
+  800daa:	4c 29 e8             	sub    %r13,%rax
+  800dad:	49 39 c4             	cmp    %rax,%r12
+  800db0:	73 31                	jae    800de3 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800db2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800db7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dbb:	4c 89 fe             	mov    %r15,%rsi
+  800dbe:	48 b8 4f 0d 80 00 00 	movabs $0x800d4f,%rax
+  800dc5:	00 00 00 
+  800dc8:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dca:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800dce:	48 83 c4 08          	add    $0x8,%rsp
+  800dd2:	5b                   	pop    %rbx
+  800dd3:	41 5c                	pop    %r12
+  800dd5:	41 5d                	pop    %r13
+  800dd7:	41 5e                	pop    %r14
+  800dd9:	41 5f                	pop    %r15
+  800ddb:	5d                   	pop    %rbp
+  800ddc:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ddd:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800de1:	eb eb                	jmp    800dce <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800de3:	48 83 eb 01          	sub    $0x1,%rbx
+  800de7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800deb:	48 89 da             	mov    %rbx,%rdx
+  800dee:	4c 89 fe             	mov    %r15,%rsi
+  800df1:	48 b8 4f 0d 80 00 00 	movabs $0x800d4f,%rax
+  800df8:	00 00 00 
+  800dfb:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800dfd:	49 01 de             	add    %rbx,%r14
+  800e00:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e05:	eb c3                	jmp    800dca <strlcat+0x69>
+
+0000000000800e07 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e07:	48 85 d2             	test   %rdx,%rdx
+  800e0a:	74 2d                	je     800e39 <memcmp+0x32>
+  800e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e11:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e15:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e1a:	44 38 c1             	cmp    %r8b,%cl
+  800e1d:	75 0f                	jne    800e2e <memcmp+0x27>
+    while (n-- > 0) {
+  800e1f:	48 83 c0 01          	add    $0x1,%rax
+  800e23:	48 39 c2             	cmp    %rax,%rdx
+  800e26:	75 e9                	jne    800e11 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e2e:	0f b6 c1             	movzbl %cl,%eax
+  800e31:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e35:	44 29 c0             	sub    %r8d,%eax
+  800e38:	c3                   	ret
+    return 0;
+  800e39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e3e:	c3                   	ret
+
+0000000000800e3f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e3f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e43:	48 39 c7             	cmp    %rax,%rdi
+  800e46:	73 0f                	jae    800e57 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e48:	40 38 37             	cmp    %sil,(%rdi)
+  800e4b:	74 0e                	je     800e5b <memfind+0x1c>
+    for (; src < end; src++) {
+  800e4d:	48 83 c7 01          	add    $0x1,%rdi
+  800e51:	48 39 f8             	cmp    %rdi,%rax
+  800e54:	75 f2                	jne    800e48 <memfind+0x9>
+  800e56:	c3                   	ret
+  800e57:	48 89 f8             	mov    %rdi,%rax
+  800e5a:	c3                   	ret
+  800e5b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e5e:	c3                   	ret
+
+0000000000800e5f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e5f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e62:	0f b6 37             	movzbl (%rdi),%esi
+  800e65:	40 80 fe 20          	cmp    $0x20,%sil
+  800e69:	74 06                	je     800e71 <strtol+0x12>
+  800e6b:	40 80 fe 09          	cmp    $0x9,%sil
+  800e6f:	75 13                	jne    800e84 <strtol+0x25>
+  800e71:	48 83 c7 01          	add    $0x1,%rdi
+  800e75:	0f b6 37             	movzbl (%rdi),%esi
+  800e78:	40 80 fe 20          	cmp    $0x20,%sil
+  800e7c:	74 f3                	je     800e71 <strtol+0x12>
+  800e7e:	40 80 fe 09          	cmp    $0x9,%sil
+  800e82:	74 ed                	je     800e71 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e84:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e87:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e8a:	3c 01                	cmp    $0x1,%al
+  800e8c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800e90:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800e96:	75 0f                	jne    800ea7 <strtol+0x48>
+  800e98:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800e9b:	74 14                	je     800eb1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800e9d:	85 d2                	test   %edx,%edx
+  800e9f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ea4:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800eac:	4c 63 ca             	movslq %edx,%r9
+  800eaf:	eb 36                	jmp    800ee7 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eb1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800eb5:	74 0f                	je     800ec6 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800eb7:	85 d2                	test   %edx,%edx
+  800eb9:	75 ec                	jne    800ea7 <strtol+0x48>
+        s++;
+  800ebb:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ebf:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ec4:	eb e1                	jmp    800ea7 <strtol+0x48>
+        s += 2;
+  800ec6:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800eca:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ecf:	eb d6                	jmp    800ea7 <strtol+0x48>
+            dig -= '0';
+  800ed1:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ed4:	44 0f b6 c1          	movzbl %cl,%r8d
+  800ed8:	41 39 d0             	cmp    %edx,%r8d
+  800edb:	7d 21                	jge    800efe <strtol+0x9f>
+        val = val * base + dig;
+  800edd:	49 0f af c1          	imul   %r9,%rax
+  800ee1:	0f b6 c9             	movzbl %cl,%ecx
+  800ee4:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800ee7:	48 83 c7 01          	add    $0x1,%rdi
+  800eeb:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800eef:	80 f9 39             	cmp    $0x39,%cl
+  800ef2:	76 dd                	jbe    800ed1 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800ef4:	80 f9 7b             	cmp    $0x7b,%cl
+  800ef7:	77 05                	ja     800efe <strtol+0x9f>
+            dig -= 'a' - 10;
+  800ef9:	83 e9 57             	sub    $0x57,%ecx
+  800efc:	eb d6                	jmp    800ed4 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800efe:	4d 85 d2             	test   %r10,%r10
+  800f01:	74 03                	je     800f06 <strtol+0xa7>
+  800f03:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f06:	48 89 c2             	mov    %rax,%rdx
+  800f09:	48 f7 da             	neg    %rdx
+  800f0c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f10:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f14:	c3                   	ret
+
+0000000000800f15 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f15:	55                   	push   %rbp
+  800f16:	48 89 e5             	mov    %rsp,%rbp
+  800f19:	53                   	push   %rbx
+  800f1a:	48 89 fa             	mov    %rdi,%rdx
+  800f1d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f20:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f2f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f34:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f3a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f3c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f40:	c9                   	leave
+  800f41:	c3                   	ret
+
+0000000000800f42 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f42:	55                   	push   %rbp
+  800f43:	48 89 e5             	mov    %rsp,%rbp
+  800f46:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f47:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f51:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f56:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f60:	be 00 00 00 00       	mov    $0x0,%esi
+  800f65:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f6b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f6d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f71:	c9                   	leave
+  800f72:	c3                   	ret
+
+0000000000800f73 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800f73:	55                   	push   %rbp
+  800f74:	48 89 e5             	mov    %rsp,%rbp
+  800f77:	53                   	push   %rbx
+  800f78:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f7c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800f7f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f84:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f93:	be 00 00 00 00       	mov    $0x0,%esi
+  800f98:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f9e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800fa0:	48 85 c0             	test   %rax,%rax
+  800fa3:	7f 06                	jg     800fab <sys_env_destroy+0x38>
+}
+  800fa5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fa9:	c9                   	leave
+  800faa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fab:	49 89 c0             	mov    %rax,%r8
+  800fae:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fb3:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  800fba:	00 00 00 
+  800fbd:	be 26 00 00 00       	mov    $0x26,%esi
+  800fc2:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  800fc9:	00 00 00 
+  800fcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd1:	49 b9 13 29 80 00 00 	movabs $0x802913,%r9
+  800fd8:	00 00 00 
+  800fdb:	41 ff d1             	call   *%r9
+
+0000000000800fde <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800fde:	55                   	push   %rbp
+  800fdf:	48 89 e5             	mov    %rsp,%rbp
+  800fe2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800fe3:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fe8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fed:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800ff2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ffc:	be 00 00 00 00       	mov    $0x0,%esi
+  801001:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801007:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801009:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80100d:	c9                   	leave
+  80100e:	c3                   	ret
+
+000000000080100f <sys_yield>:
+
+void
+sys_yield(void) {
+  80100f:	55                   	push   %rbp
+  801010:	48 89 e5             	mov    %rsp,%rbp
+  801013:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801014:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801019:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801023:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801028:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80102d:	be 00 00 00 00       	mov    $0x0,%esi
+  801032:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801038:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80103a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80103e:	c9                   	leave
+  80103f:	c3                   	ret
+
+0000000000801040 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801040:	55                   	push   %rbp
+  801041:	48 89 e5             	mov    %rsp,%rbp
+  801044:	53                   	push   %rbx
+  801045:	48 89 fa             	mov    %rdi,%rdx
+  801048:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80104b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801050:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801057:	00 00 00 
+  80105a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80105f:	be 00 00 00 00       	mov    $0x0,%esi
+  801064:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80106a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80106c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801070:	c9                   	leave
+  801071:	c3                   	ret
+
+0000000000801072 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801072:	55                   	push   %rbp
+  801073:	48 89 e5             	mov    %rsp,%rbp
+  801076:	53                   	push   %rbx
+  801077:	49 89 f8             	mov    %rdi,%r8
+  80107a:	48 89 d3             	mov    %rdx,%rbx
+  80107d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801080:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801085:	4c 89 c2             	mov    %r8,%rdx
+  801088:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80108b:	be 00 00 00 00       	mov    $0x0,%esi
+  801090:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801096:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801098:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80109c:	c9                   	leave
+  80109d:	c3                   	ret
+
+000000000080109e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80109e:	55                   	push   %rbp
+  80109f:	48 89 e5             	mov    %rsp,%rbp
+  8010a2:	53                   	push   %rbx
+  8010a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8010a7:	89 f8                	mov    %edi,%eax
+  8010a9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010ac:	48 63 f9             	movslq %ecx,%rdi
+  8010af:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010b2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010b7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8010bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010c7:	48 85 c0             	test   %rax,%rax
+  8010ca:	7f 06                	jg     8010d2 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8010cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010d0:	c9                   	leave
+  8010d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010d2:	49 89 c0             	mov    %rax,%r8
+  8010d5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8010da:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8010e1:	00 00 00 
+  8010e4:	be 26 00 00 00       	mov    $0x26,%esi
+  8010e9:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  8010f0:	00 00 00 
+  8010f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f8:	49 b9 13 29 80 00 00 	movabs $0x802913,%r9
+  8010ff:	00 00 00 
+  801102:	41 ff d1             	call   *%r9
+
+0000000000801105 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801105:	55                   	push   %rbp
+  801106:	48 89 e5             	mov    %rsp,%rbp
+  801109:	53                   	push   %rbx
+  80110a:	48 83 ec 08          	sub    $0x8,%rsp
+  80110e:	89 f8                	mov    %edi,%eax
+  801110:	49 89 f2             	mov    %rsi,%r10
+  801113:	48 89 cf             	mov    %rcx,%rdi
+  801116:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801119:	48 63 da             	movslq %edx,%rbx
+  80111c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80111f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801124:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801127:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80112a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80112c:	48 85 c0             	test   %rax,%rax
+  80112f:	7f 06                	jg     801137 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801131:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801135:	c9                   	leave
+  801136:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801137:	49 89 c0             	mov    %rax,%r8
+  80113a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80113f:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  801146:	00 00 00 
+  801149:	be 26 00 00 00       	mov    $0x26,%esi
+  80114e:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  801155:	00 00 00 
+  801158:	b8 00 00 00 00       	mov    $0x0,%eax
+  80115d:	49 b9 13 29 80 00 00 	movabs $0x802913,%r9
+  801164:	00 00 00 
+  801167:	41 ff d1             	call   *%r9
+
+000000000080116a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80116a:	55                   	push   %rbp
+  80116b:	48 89 e5             	mov    %rsp,%rbp
+  80116e:	53                   	push   %rbx
+  80116f:	48 83 ec 08          	sub    $0x8,%rsp
+  801173:	48 89 f1             	mov    %rsi,%rcx
+  801176:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801179:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80117c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801181:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801186:	be 00 00 00 00       	mov    $0x0,%esi
+  80118b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801191:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801193:	48 85 c0             	test   %rax,%rax
+  801196:	7f 06                	jg     80119e <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801198:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80119c:	c9                   	leave
+  80119d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80119e:	49 89 c0             	mov    %rax,%r8
+  8011a1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011a6:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8011ad:	00 00 00 
+  8011b0:	be 26 00 00 00       	mov    $0x26,%esi
+  8011b5:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  8011bc:	00 00 00 
+  8011bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c4:	49 b9 13 29 80 00 00 	movabs $0x802913,%r9
+  8011cb:	00 00 00 
+  8011ce:	41 ff d1             	call   *%r9
+
+00000000008011d1 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8011d1:	55                   	push   %rbp
+  8011d2:	48 89 e5             	mov    %rsp,%rbp
+  8011d5:	53                   	push   %rbx
+  8011d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8011da:	89 f8                	mov    %edi,%eax
+  8011dc:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8011df:	48 63 f9             	movslq %ecx,%rdi
+  8011e2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011e5:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011ea:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011fa:	48 85 c0             	test   %rax,%rax
+  8011fd:	7f 06                	jg     801205 <sys_region_advise+0x34>
+}
+  8011ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801203:	c9                   	leave
+  801204:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801205:	49 89 c0             	mov    %rax,%r8
+  801208:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80120d:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  801214:	00 00 00 
+  801217:	be 26 00 00 00       	mov    $0x26,%esi
+  80121c:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  801223:	00 00 00 
+  801226:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122b:	49 b9 13 29 80 00 00 	movabs $0x802913,%r9
+  801232:	00 00 00 
+  801235:	41 ff d1             	call   *%r9
+
+0000000000801238 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801238:	55                   	push   %rbp
+  801239:	48 89 e5             	mov    %rsp,%rbp
+  80123c:	53                   	push   %rbx
+  80123d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801241:	48 63 ce             	movslq %esi,%rcx
+  801244:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801247:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80124c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801251:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801256:	be 00 00 00 00       	mov    $0x0,%esi
+  80125b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801261:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801263:	48 85 c0             	test   %rax,%rax
+  801266:	7f 06                	jg     80126e <sys_env_set_nice+0x36>
+}
+  801268:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80126c:	c9                   	leave
+  80126d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80126e:	49 89 c0             	mov    %rax,%r8
+  801271:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801276:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  80127d:	00 00 00 
+  801280:	be 26 00 00 00       	mov    $0x26,%esi
+  801285:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  80128c:	00 00 00 
+  80128f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801294:	49 b9 13 29 80 00 00 	movabs $0x802913,%r9
+  80129b:	00 00 00 
+  80129e:	41 ff d1             	call   *%r9
+
+00000000008012a1 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8012a1:	55                   	push   %rbp
+  8012a2:	48 89 e5             	mov    %rsp,%rbp
+  8012a5:	53                   	push   %rbx
+  8012a6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012aa:	48 63 ce             	movslq %esi,%rcx
+  8012ad:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b0:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ca:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012cc:	48 85 c0             	test   %rax,%rax
+  8012cf:	7f 06                	jg     8012d7 <sys_env_set_status+0x36>
+}
+  8012d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d5:	c9                   	leave
+  8012d6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d7:	49 89 c0             	mov    %rax,%r8
+  8012da:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012df:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8012e6:	00 00 00 
+  8012e9:	be 26 00 00 00       	mov    $0x26,%esi
+  8012ee:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  8012f5:	00 00 00 
+  8012f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012fd:	49 b9 13 29 80 00 00 	movabs $0x802913,%r9
+  801304:	00 00 00 
+  801307:	41 ff d1             	call   *%r9
+
+000000000080130a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80130a:	55                   	push   %rbp
+  80130b:	48 89 e5             	mov    %rsp,%rbp
+  80130e:	53                   	push   %rbx
+  80130f:	48 83 ec 08          	sub    $0x8,%rsp
+  801313:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801316:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801319:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80131e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801323:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801328:	be 00 00 00 00       	mov    $0x0,%esi
+  80132d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801333:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801335:	48 85 c0             	test   %rax,%rax
+  801338:	7f 06                	jg     801340 <sys_env_set_trapframe+0x36>
+}
+  80133a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80133e:	c9                   	leave
+  80133f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801340:	49 89 c0             	mov    %rax,%r8
+  801343:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801348:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  80134f:	00 00 00 
+  801352:	be 26 00 00 00       	mov    $0x26,%esi
+  801357:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  80135e:	00 00 00 
+  801361:	b8 00 00 00 00       	mov    $0x0,%eax
+  801366:	49 b9 13 29 80 00 00 	movabs $0x802913,%r9
+  80136d:	00 00 00 
+  801370:	41 ff d1             	call   *%r9
+
+0000000000801373 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801373:	55                   	push   %rbp
+  801374:	48 89 e5             	mov    %rsp,%rbp
+  801377:	53                   	push   %rbx
+  801378:	48 83 ec 08          	sub    $0x8,%rsp
+  80137c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80137f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801382:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801387:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801391:	be 00 00 00 00       	mov    $0x0,%esi
+  801396:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80139c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80139e:	48 85 c0             	test   %rax,%rax
+  8013a1:	7f 06                	jg     8013a9 <sys_env_set_pgfault_upcall+0x36>
+}
+  8013a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a7:	c9                   	leave
+  8013a8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013a9:	49 89 c0             	mov    %rax,%r8
+  8013ac:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013b1:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8013b8:	00 00 00 
+  8013bb:	be 26 00 00 00       	mov    $0x26,%esi
+  8013c0:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  8013c7:	00 00 00 
+  8013ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013cf:	49 b9 13 29 80 00 00 	movabs $0x802913,%r9
+  8013d6:	00 00 00 
+  8013d9:	41 ff d1             	call   *%r9
+
+00000000008013dc <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013dc:	55                   	push   %rbp
+  8013dd:	48 89 e5             	mov    %rsp,%rbp
+  8013e0:	53                   	push   %rbx
+  8013e1:	89 f8                	mov    %edi,%eax
+  8013e3:	49 89 f1             	mov    %rsi,%r9
+  8013e6:	48 89 d3             	mov    %rdx,%rbx
+  8013e9:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8013ec:	49 63 f0             	movslq %r8d,%rsi
+  8013ef:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f2:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013f7:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801400:	cd 30                	int    $0x30
+}
+  801402:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801406:	c9                   	leave
+  801407:	c3                   	ret
+
+0000000000801408 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801408:	55                   	push   %rbp
+  801409:	48 89 e5             	mov    %rsp,%rbp
+  80140c:	53                   	push   %rbx
+  80140d:	48 83 ec 08          	sub    $0x8,%rsp
+  801411:	48 89 fa             	mov    %rdi,%rdx
+  801414:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801417:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80141c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801421:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801426:	be 00 00 00 00       	mov    $0x0,%esi
+  80142b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801431:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801433:	48 85 c0             	test   %rax,%rax
+  801436:	7f 06                	jg     80143e <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801438:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80143c:	c9                   	leave
+  80143d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80143e:	49 89 c0             	mov    %rax,%r8
+  801441:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801446:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  80144d:	00 00 00 
+  801450:	be 26 00 00 00       	mov    $0x26,%esi
+  801455:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  80145c:	00 00 00 
+  80145f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801464:	49 b9 13 29 80 00 00 	movabs $0x802913,%r9
+  80146b:	00 00 00 
+  80146e:	41 ff d1             	call   *%r9
+
+0000000000801471 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801471:	55                   	push   %rbp
+  801472:	48 89 e5             	mov    %rsp,%rbp
+  801475:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801476:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80147b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801480:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801485:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148f:	be 00 00 00 00       	mov    $0x0,%esi
+  801494:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80149a:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80149c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a0:	c9                   	leave
+  8014a1:	c3                   	ret
+
+00000000008014a2 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8014a2:	55                   	push   %rbp
+  8014a3:	48 89 e5             	mov    %rsp,%rbp
+  8014a6:	53                   	push   %rbx
+  8014a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ab:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8014ae:	48 63 ce             	movslq %esi,%rcx
+  8014b1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b4:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014be:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014cb:	48 85 c0             	test   %rax,%rax
+  8014ce:	7f 06                	jg     8014d6 <sys_sigqueue+0x34>
+}
+  8014d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d4:	c9                   	leave
+  8014d5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d6:	49 89 c0             	mov    %rax,%r8
+  8014d9:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8014de:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8014e5:	00 00 00 
+  8014e8:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ed:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  8014f4:	00 00 00 
+  8014f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014fc:	49 b9 13 29 80 00 00 	movabs $0x802913,%r9
+  801503:	00 00 00 
+  801506:	41 ff d1             	call   *%r9
+
+0000000000801509 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801509:	55                   	push   %rbp
+  80150a:	48 89 e5             	mov    %rsp,%rbp
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 08          	sub    $0x8,%rsp
+  801512:	48 89 fa             	mov    %rdi,%rdx
+  801515:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801518:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80151d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801522:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801527:	be 00 00 00 00       	mov    $0x0,%esi
+  80152c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801532:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801534:	48 85 c0             	test   %rax,%rax
+  801537:	7f 06                	jg     80153f <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801539:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80153d:	c9                   	leave
+  80153e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80153f:	49 89 c0             	mov    %rax,%r8
+  801542:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801547:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  80154e:	00 00 00 
+  801551:	be 26 00 00 00       	mov    $0x26,%esi
+  801556:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  80155d:	00 00 00 
+  801560:	b8 00 00 00 00       	mov    $0x0,%eax
+  801565:	49 b9 13 29 80 00 00 	movabs $0x802913,%r9
+  80156c:	00 00 00 
+  80156f:	41 ff d1             	call   *%r9
+
+0000000000801572 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801572:	55                   	push   %rbp
+  801573:	48 89 e5             	mov    %rsp,%rbp
+  801576:	53                   	push   %rbx
+  801577:	48 83 ec 08          	sub    $0x8,%rsp
+  80157b:	48 89 f1             	mov    %rsi,%rcx
+  80157e:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801581:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801584:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801589:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80158e:	be 00 00 00 00       	mov    $0x0,%esi
+  801593:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801599:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80159b:	48 85 c0             	test   %rax,%rax
+  80159e:	7f 06                	jg     8015a6 <sys_sigaction+0x34>
+}
+  8015a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a4:	c9                   	leave
+  8015a5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015a6:	49 89 c0             	mov    %rax,%r8
+  8015a9:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8015ae:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8015b5:	00 00 00 
+  8015b8:	be 26 00 00 00       	mov    $0x26,%esi
+  8015bd:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  8015c4:	00 00 00 
+  8015c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015cc:	49 b9 13 29 80 00 00 	movabs $0x802913,%r9
+  8015d3:	00 00 00 
+  8015d6:	41 ff d1             	call   *%r9
+
+00000000008015d9 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8015d9:	55                   	push   %rbp
+  8015da:	48 89 e5             	mov    %rsp,%rbp
+  8015dd:	53                   	push   %rbx
+  8015de:	48 83 ec 08          	sub    $0x8,%rsp
+  8015e2:	48 89 f1             	mov    %rsi,%rcx
+  8015e5:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8015e8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015eb:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8015fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801600:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801602:	48 85 c0             	test   %rax,%rax
+  801605:	7f 06                	jg     80160d <sys_sigprocmask+0x34>
+}
+  801607:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80160b:	c9                   	leave
+  80160c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80160d:	49 89 c0             	mov    %rax,%r8
+  801610:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801615:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  80161c:	00 00 00 
+  80161f:	be 26 00 00 00       	mov    $0x26,%esi
+  801624:	48 bf cf 30 80 00 00 	movabs $0x8030cf,%rdi
+  80162b:	00 00 00 
+  80162e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801633:	49 b9 13 29 80 00 00 	movabs $0x802913,%r9
+  80163a:	00 00 00 
+  80163d:	41 ff d1             	call   *%r9
+
+0000000000801640 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801640:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801647:	ff ff ff 
+  80164a:	48 01 f8             	add    %rdi,%rax
+  80164d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801651:	c3                   	ret
+
+0000000000801652 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801652:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801659:	ff ff ff 
+  80165c:	48 01 f8             	add    %rdi,%rax
+  80165f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801663:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801669:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80166d:	c3                   	ret
+
+000000000080166e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80166e:	55                   	push   %rbp
+  80166f:	48 89 e5             	mov    %rsp,%rbp
+  801672:	41 57                	push   %r15
+  801674:	41 56                	push   %r14
+  801676:	41 55                	push   %r13
+  801678:	41 54                	push   %r12
+  80167a:	53                   	push   %rbx
+  80167b:	48 83 ec 08          	sub    $0x8,%rsp
+  80167f:	49 89 ff             	mov    %rdi,%r15
+  801682:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801687:	49 bd ec 25 80 00 00 	movabs $0x8025ec,%r13
+  80168e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801691:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801697:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80169a:	48 89 df             	mov    %rbx,%rdi
+  80169d:	41 ff d5             	call   *%r13
+  8016a0:	83 e0 04             	and    $0x4,%eax
+  8016a3:	74 17                	je     8016bc <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8016a5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8016ac:	4c 39 f3             	cmp    %r14,%rbx
+  8016af:	75 e6                	jne    801697 <fd_alloc+0x29>
+  8016b1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8016b7:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8016bc:	4d 89 27             	mov    %r12,(%r15)
+}
+  8016bf:	48 83 c4 08          	add    $0x8,%rsp
+  8016c3:	5b                   	pop    %rbx
+  8016c4:	41 5c                	pop    %r12
+  8016c6:	41 5d                	pop    %r13
+  8016c8:	41 5e                	pop    %r14
+  8016ca:	41 5f                	pop    %r15
+  8016cc:	5d                   	pop    %rbp
+  8016cd:	c3                   	ret
+
+00000000008016ce <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8016ce:	83 ff 1f             	cmp    $0x1f,%edi
+  8016d1:	77 39                	ja     80170c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8016d3:	55                   	push   %rbp
+  8016d4:	48 89 e5             	mov    %rsp,%rbp
+  8016d7:	41 54                	push   %r12
+  8016d9:	53                   	push   %rbx
+  8016da:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8016dd:	48 63 df             	movslq %edi,%rbx
+  8016e0:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8016e7:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8016eb:	48 89 df             	mov    %rbx,%rdi
+  8016ee:	48 b8 ec 25 80 00 00 	movabs $0x8025ec,%rax
+  8016f5:	00 00 00 
+  8016f8:	ff d0                	call   *%rax
+  8016fa:	a8 04                	test   $0x4,%al
+  8016fc:	74 14                	je     801712 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8016fe:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801702:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801707:	5b                   	pop    %rbx
+  801708:	41 5c                	pop    %r12
+  80170a:	5d                   	pop    %rbp
+  80170b:	c3                   	ret
+        return -E_INVAL;
+  80170c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801711:	c3                   	ret
+        return -E_INVAL;
+  801712:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801717:	eb ee                	jmp    801707 <fd_lookup+0x39>
+
+0000000000801719 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801719:	55                   	push   %rbp
+  80171a:	48 89 e5             	mov    %rsp,%rbp
+  80171d:	41 54                	push   %r12
+  80171f:	53                   	push   %rbx
+  801720:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801723:	48 b8 60 31 80 00 00 	movabs $0x803160,%rax
+  80172a:	00 00 00 
+  80172d:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801734:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801737:	39 3b                	cmp    %edi,(%rbx)
+  801739:	74 47                	je     801782 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80173b:	48 83 c0 08          	add    $0x8,%rax
+  80173f:	48 8b 18             	mov    (%rax),%rbx
+  801742:	48 85 db             	test   %rbx,%rbx
+  801745:	75 f0                	jne    801737 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801747:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80174e:	00 00 00 
+  801751:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801757:	89 fa                	mov    %edi,%edx
+  801759:	48 bf e0 30 80 00 00 	movabs $0x8030e0,%rdi
+  801760:	00 00 00 
+  801763:	b8 00 00 00 00       	mov    $0x0,%eax
+  801768:	48 b9 c9 01 80 00 00 	movabs $0x8001c9,%rcx
+  80176f:	00 00 00 
+  801772:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801774:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801779:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80177d:	5b                   	pop    %rbx
+  80177e:	41 5c                	pop    %r12
+  801780:	5d                   	pop    %rbp
+  801781:	c3                   	ret
+            return 0;
+  801782:	b8 00 00 00 00       	mov    $0x0,%eax
+  801787:	eb f0                	jmp    801779 <dev_lookup+0x60>
+
+0000000000801789 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801789:	55                   	push   %rbp
+  80178a:	48 89 e5             	mov    %rsp,%rbp
+  80178d:	41 55                	push   %r13
+  80178f:	41 54                	push   %r12
+  801791:	53                   	push   %rbx
+  801792:	48 83 ec 18          	sub    $0x18,%rsp
+  801796:	48 89 fb             	mov    %rdi,%rbx
+  801799:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80179c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8017a3:	ff ff ff 
+  8017a6:	48 01 df             	add    %rbx,%rdi
+  8017a9:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8017ad:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8017b1:	48 b8 ce 16 80 00 00 	movabs $0x8016ce,%rax
+  8017b8:	00 00 00 
+  8017bb:	ff d0                	call   *%rax
+  8017bd:	41 89 c5             	mov    %eax,%r13d
+  8017c0:	85 c0                	test   %eax,%eax
+  8017c2:	78 06                	js     8017ca <fd_close+0x41>
+  8017c4:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8017c8:	74 1a                	je     8017e4 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8017ca:	45 84 e4             	test   %r12b,%r12b
+  8017cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d2:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8017d6:	44 89 e8             	mov    %r13d,%eax
+  8017d9:	48 83 c4 18          	add    $0x18,%rsp
+  8017dd:	5b                   	pop    %rbx
+  8017de:	41 5c                	pop    %r12
+  8017e0:	41 5d                	pop    %r13
+  8017e2:	5d                   	pop    %rbp
+  8017e3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017e4:	8b 3b                	mov    (%rbx),%edi
+  8017e6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8017ea:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  8017f1:	00 00 00 
+  8017f4:	ff d0                	call   *%rax
+  8017f6:	41 89 c5             	mov    %eax,%r13d
+  8017f9:	85 c0                	test   %eax,%eax
+  8017fb:	78 1b                	js     801818 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8017fd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801801:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801805:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80180b:	48 85 c0             	test   %rax,%rax
+  80180e:	74 08                	je     801818 <fd_close+0x8f>
+  801810:	48 89 df             	mov    %rbx,%rdi
+  801813:	ff d0                	call   *%rax
+  801815:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801818:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80181d:	48 89 de             	mov    %rbx,%rsi
+  801820:	bf 00 00 00 00       	mov    $0x0,%edi
+  801825:	48 b8 6a 11 80 00 00 	movabs $0x80116a,%rax
+  80182c:	00 00 00 
+  80182f:	ff d0                	call   *%rax
+    return res;
+  801831:	eb a3                	jmp    8017d6 <fd_close+0x4d>
+
+0000000000801833 <close>:
+
+int
+close(int fdnum) {
+  801833:	55                   	push   %rbp
+  801834:	48 89 e5             	mov    %rsp,%rbp
+  801837:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80183b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80183f:	48 b8 ce 16 80 00 00 	movabs $0x8016ce,%rax
+  801846:	00 00 00 
+  801849:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80184b:	85 c0                	test   %eax,%eax
+  80184d:	78 15                	js     801864 <close+0x31>
+
+    return fd_close(fd, 1);
+  80184f:	be 01 00 00 00       	mov    $0x1,%esi
+  801854:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801858:	48 b8 89 17 80 00 00 	movabs $0x801789,%rax
+  80185f:	00 00 00 
+  801862:	ff d0                	call   *%rax
+}
+  801864:	c9                   	leave
+  801865:	c3                   	ret
+
+0000000000801866 <close_all>:
+
+void
+close_all(void) {
+  801866:	55                   	push   %rbp
+  801867:	48 89 e5             	mov    %rsp,%rbp
+  80186a:	41 54                	push   %r12
+  80186c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80186d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801872:	49 bc 33 18 80 00 00 	movabs $0x801833,%r12
+  801879:	00 00 00 
+  80187c:	89 df                	mov    %ebx,%edi
+  80187e:	41 ff d4             	call   *%r12
+  801881:	83 c3 01             	add    $0x1,%ebx
+  801884:	83 fb 20             	cmp    $0x20,%ebx
+  801887:	75 f3                	jne    80187c <close_all+0x16>
+}
+  801889:	5b                   	pop    %rbx
+  80188a:	41 5c                	pop    %r12
+  80188c:	5d                   	pop    %rbp
+  80188d:	c3                   	ret
+
+000000000080188e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80188e:	55                   	push   %rbp
+  80188f:	48 89 e5             	mov    %rsp,%rbp
+  801892:	41 57                	push   %r15
+  801894:	41 56                	push   %r14
+  801896:	41 55                	push   %r13
+  801898:	41 54                	push   %r12
+  80189a:	53                   	push   %rbx
+  80189b:	48 83 ec 18          	sub    $0x18,%rsp
+  80189f:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8018a2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8018a6:	48 b8 ce 16 80 00 00 	movabs $0x8016ce,%rax
+  8018ad:	00 00 00 
+  8018b0:	ff d0                	call   *%rax
+  8018b2:	89 c3                	mov    %eax,%ebx
+  8018b4:	85 c0                	test   %eax,%eax
+  8018b6:	0f 88 b8 00 00 00    	js     801974 <dup+0xe6>
+    close(newfdnum);
+  8018bc:	44 89 e7             	mov    %r12d,%edi
+  8018bf:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  8018c6:	00 00 00 
+  8018c9:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8018cb:	4d 63 ec             	movslq %r12d,%r13
+  8018ce:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8018d5:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8018d9:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8018dd:	4c 89 ff             	mov    %r15,%rdi
+  8018e0:	49 be 52 16 80 00 00 	movabs $0x801652,%r14
+  8018e7:	00 00 00 
+  8018ea:	41 ff d6             	call   *%r14
+  8018ed:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8018f0:	4c 89 ef             	mov    %r13,%rdi
+  8018f3:	41 ff d6             	call   *%r14
+  8018f6:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8018f9:	48 89 df             	mov    %rbx,%rdi
+  8018fc:	48 b8 ec 25 80 00 00 	movabs $0x8025ec,%rax
+  801903:	00 00 00 
+  801906:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801908:	a8 04                	test   $0x4,%al
+  80190a:	74 2b                	je     801937 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80190c:	41 89 c1             	mov    %eax,%r9d
+  80190f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801915:	4c 89 f1             	mov    %r14,%rcx
+  801918:	ba 00 00 00 00       	mov    $0x0,%edx
+  80191d:	48 89 de             	mov    %rbx,%rsi
+  801920:	bf 00 00 00 00       	mov    $0x0,%edi
+  801925:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  80192c:	00 00 00 
+  80192f:	ff d0                	call   *%rax
+  801931:	89 c3                	mov    %eax,%ebx
+  801933:	85 c0                	test   %eax,%eax
+  801935:	78 4e                	js     801985 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801937:	4c 89 ff             	mov    %r15,%rdi
+  80193a:	48 b8 ec 25 80 00 00 	movabs $0x8025ec,%rax
+  801941:	00 00 00 
+  801944:	ff d0                	call   *%rax
+  801946:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801949:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80194f:	4c 89 e9             	mov    %r13,%rcx
+  801952:	ba 00 00 00 00       	mov    $0x0,%edx
+  801957:	4c 89 fe             	mov    %r15,%rsi
+  80195a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80195f:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  801966:	00 00 00 
+  801969:	ff d0                	call   *%rax
+  80196b:	89 c3                	mov    %eax,%ebx
+  80196d:	85 c0                	test   %eax,%eax
+  80196f:	78 14                	js     801985 <dup+0xf7>
+
+    return newfdnum;
+  801971:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801974:	89 d8                	mov    %ebx,%eax
+  801976:	48 83 c4 18          	add    $0x18,%rsp
+  80197a:	5b                   	pop    %rbx
+  80197b:	41 5c                	pop    %r12
+  80197d:	41 5d                	pop    %r13
+  80197f:	41 5e                	pop    %r14
+  801981:	41 5f                	pop    %r15
+  801983:	5d                   	pop    %rbp
+  801984:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801985:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80198a:	4c 89 ee             	mov    %r13,%rsi
+  80198d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801992:	49 bc 6a 11 80 00 00 	movabs $0x80116a,%r12
+  801999:	00 00 00 
+  80199c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80199f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019a4:	4c 89 f6             	mov    %r14,%rsi
+  8019a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019ac:	41 ff d4             	call   *%r12
+    return res;
+  8019af:	eb c3                	jmp    801974 <dup+0xe6>
+
+00000000008019b1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8019b1:	55                   	push   %rbp
+  8019b2:	48 89 e5             	mov    %rsp,%rbp
+  8019b5:	41 56                	push   %r14
+  8019b7:	41 55                	push   %r13
+  8019b9:	41 54                	push   %r12
+  8019bb:	53                   	push   %rbx
+  8019bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8019c0:	89 fb                	mov    %edi,%ebx
+  8019c2:	49 89 f4             	mov    %rsi,%r12
+  8019c5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019c8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019cc:	48 b8 ce 16 80 00 00 	movabs $0x8016ce,%rax
+  8019d3:	00 00 00 
+  8019d6:	ff d0                	call   *%rax
+  8019d8:	85 c0                	test   %eax,%eax
+  8019da:	78 4c                	js     801a28 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019dc:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019e0:	41 8b 3e             	mov    (%r14),%edi
+  8019e3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019e7:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  8019ee:	00 00 00 
+  8019f1:	ff d0                	call   *%rax
+  8019f3:	85 c0                	test   %eax,%eax
+  8019f5:	78 35                	js     801a2c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019f7:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019fb:	83 e0 03             	and    $0x3,%eax
+  8019fe:	83 f8 01             	cmp    $0x1,%eax
+  801a01:	74 2d                	je     801a30 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a03:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a07:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801a0b:	48 85 c0             	test   %rax,%rax
+  801a0e:	74 56                	je     801a66 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801a10:	4c 89 ea             	mov    %r13,%rdx
+  801a13:	4c 89 e6             	mov    %r12,%rsi
+  801a16:	4c 89 f7             	mov    %r14,%rdi
+  801a19:	ff d0                	call   *%rax
+}
+  801a1b:	48 83 c4 10          	add    $0x10,%rsp
+  801a1f:	5b                   	pop    %rbx
+  801a20:	41 5c                	pop    %r12
+  801a22:	41 5d                	pop    %r13
+  801a24:	41 5e                	pop    %r14
+  801a26:	5d                   	pop    %rbp
+  801a27:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a28:	48 98                	cltq
+  801a2a:	eb ef                	jmp    801a1b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a2c:	48 98                	cltq
+  801a2e:	eb eb                	jmp    801a1b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a30:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a37:	00 00 00 
+  801a3a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a40:	89 da                	mov    %ebx,%edx
+  801a42:	48 bf 21 31 80 00 00 	movabs $0x803121,%rdi
+  801a49:	00 00 00 
+  801a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a51:	48 b9 c9 01 80 00 00 	movabs $0x8001c9,%rcx
+  801a58:	00 00 00 
+  801a5b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a5d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a64:	eb b5                	jmp    801a1b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a66:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a6d:	eb ac                	jmp    801a1b <read+0x6a>
+
+0000000000801a6f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a6f:	55                   	push   %rbp
+  801a70:	48 89 e5             	mov    %rsp,%rbp
+  801a73:	41 57                	push   %r15
+  801a75:	41 56                	push   %r14
+  801a77:	41 55                	push   %r13
+  801a79:	41 54                	push   %r12
+  801a7b:	53                   	push   %rbx
+  801a7c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a80:	48 85 d2             	test   %rdx,%rdx
+  801a83:	74 54                	je     801ad9 <readn+0x6a>
+  801a85:	41 89 fd             	mov    %edi,%r13d
+  801a88:	49 89 f6             	mov    %rsi,%r14
+  801a8b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801a8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801a93:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801a98:	49 bf b1 19 80 00 00 	movabs $0x8019b1,%r15
+  801a9f:	00 00 00 
+  801aa2:	4c 89 e2             	mov    %r12,%rdx
+  801aa5:	48 29 f2             	sub    %rsi,%rdx
+  801aa8:	4c 01 f6             	add    %r14,%rsi
+  801aab:	44 89 ef             	mov    %r13d,%edi
+  801aae:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801ab1:	85 c0                	test   %eax,%eax
+  801ab3:	78 20                	js     801ad5 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ab5:	01 c3                	add    %eax,%ebx
+  801ab7:	85 c0                	test   %eax,%eax
+  801ab9:	74 08                	je     801ac3 <readn+0x54>
+  801abb:	48 63 f3             	movslq %ebx,%rsi
+  801abe:	4c 39 e6             	cmp    %r12,%rsi
+  801ac1:	72 df                	jb     801aa2 <readn+0x33>
+    }
+    return res;
+  801ac3:	48 63 c3             	movslq %ebx,%rax
+}
+  801ac6:	48 83 c4 08          	add    $0x8,%rsp
+  801aca:	5b                   	pop    %rbx
+  801acb:	41 5c                	pop    %r12
+  801acd:	41 5d                	pop    %r13
+  801acf:	41 5e                	pop    %r14
+  801ad1:	41 5f                	pop    %r15
+  801ad3:	5d                   	pop    %rbp
+  801ad4:	c3                   	ret
+        if (inc < 0) return inc;
+  801ad5:	48 98                	cltq
+  801ad7:	eb ed                	jmp    801ac6 <readn+0x57>
+    int inc = 1, res = 0;
+  801ad9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ade:	eb e3                	jmp    801ac3 <readn+0x54>
+
+0000000000801ae0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ae0:	55                   	push   %rbp
+  801ae1:	48 89 e5             	mov    %rsp,%rbp
+  801ae4:	41 56                	push   %r14
+  801ae6:	41 55                	push   %r13
+  801ae8:	41 54                	push   %r12
+  801aea:	53                   	push   %rbx
+  801aeb:	48 83 ec 10          	sub    $0x10,%rsp
+  801aef:	89 fb                	mov    %edi,%ebx
+  801af1:	49 89 f4             	mov    %rsi,%r12
+  801af4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801af7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801afb:	48 b8 ce 16 80 00 00 	movabs $0x8016ce,%rax
+  801b02:	00 00 00 
+  801b05:	ff d0                	call   *%rax
+  801b07:	85 c0                	test   %eax,%eax
+  801b09:	78 47                	js     801b52 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b0b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b0f:	41 8b 3e             	mov    (%r14),%edi
+  801b12:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b16:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  801b1d:	00 00 00 
+  801b20:	ff d0                	call   *%rax
+  801b22:	85 c0                	test   %eax,%eax
+  801b24:	78 30                	js     801b56 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b26:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b2b:	74 2d                	je     801b5a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b2d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b31:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b35:	48 85 c0             	test   %rax,%rax
+  801b38:	74 56                	je     801b90 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b3a:	4c 89 ea             	mov    %r13,%rdx
+  801b3d:	4c 89 e6             	mov    %r12,%rsi
+  801b40:	4c 89 f7             	mov    %r14,%rdi
+  801b43:	ff d0                	call   *%rax
+}
+  801b45:	48 83 c4 10          	add    $0x10,%rsp
+  801b49:	5b                   	pop    %rbx
+  801b4a:	41 5c                	pop    %r12
+  801b4c:	41 5d                	pop    %r13
+  801b4e:	41 5e                	pop    %r14
+  801b50:	5d                   	pop    %rbp
+  801b51:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b52:	48 98                	cltq
+  801b54:	eb ef                	jmp    801b45 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b56:	48 98                	cltq
+  801b58:	eb eb                	jmp    801b45 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b5a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b61:	00 00 00 
+  801b64:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b6a:	89 da                	mov    %ebx,%edx
+  801b6c:	48 bf 3d 31 80 00 00 	movabs $0x80313d,%rdi
+  801b73:	00 00 00 
+  801b76:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b7b:	48 b9 c9 01 80 00 00 	movabs $0x8001c9,%rcx
+  801b82:	00 00 00 
+  801b85:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b87:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b8e:	eb b5                	jmp    801b45 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b90:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b97:	eb ac                	jmp    801b45 <write+0x65>
+
+0000000000801b99 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801b99:	55                   	push   %rbp
+  801b9a:	48 89 e5             	mov    %rsp,%rbp
+  801b9d:	53                   	push   %rbx
+  801b9e:	48 83 ec 18          	sub    $0x18,%rsp
+  801ba2:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ba4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ba8:	48 b8 ce 16 80 00 00 	movabs $0x8016ce,%rax
+  801baf:	00 00 00 
+  801bb2:	ff d0                	call   *%rax
+  801bb4:	85 c0                	test   %eax,%eax
+  801bb6:	78 0c                	js     801bc4 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801bb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bbc:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801bbf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bc4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bc8:	c9                   	leave
+  801bc9:	c3                   	ret
+
+0000000000801bca <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801bca:	55                   	push   %rbp
+  801bcb:	48 89 e5             	mov    %rsp,%rbp
+  801bce:	41 55                	push   %r13
+  801bd0:	41 54                	push   %r12
+  801bd2:	53                   	push   %rbx
+  801bd3:	48 83 ec 18          	sub    $0x18,%rsp
+  801bd7:	89 fb                	mov    %edi,%ebx
+  801bd9:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bdc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801be0:	48 b8 ce 16 80 00 00 	movabs $0x8016ce,%rax
+  801be7:	00 00 00 
+  801bea:	ff d0                	call   *%rax
+  801bec:	85 c0                	test   %eax,%eax
+  801bee:	78 38                	js     801c28 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bf0:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801bf4:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801bf8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bfc:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  801c03:	00 00 00 
+  801c06:	ff d0                	call   *%rax
+  801c08:	85 c0                	test   %eax,%eax
+  801c0a:	78 1c                	js     801c28 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c0c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c11:	74 20                	je     801c33 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c13:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c17:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801c1b:	48 85 c0             	test   %rax,%rax
+  801c1e:	74 47                	je     801c67 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c20:	44 89 e6             	mov    %r12d,%esi
+  801c23:	4c 89 ef             	mov    %r13,%rdi
+  801c26:	ff d0                	call   *%rax
+}
+  801c28:	48 83 c4 18          	add    $0x18,%rsp
+  801c2c:	5b                   	pop    %rbx
+  801c2d:	41 5c                	pop    %r12
+  801c2f:	41 5d                	pop    %r13
+  801c31:	5d                   	pop    %rbp
+  801c32:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c33:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c3a:	00 00 00 
+  801c3d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c43:	89 da                	mov    %ebx,%edx
+  801c45:	48 bf 00 31 80 00 00 	movabs $0x803100,%rdi
+  801c4c:	00 00 00 
+  801c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c54:	48 b9 c9 01 80 00 00 	movabs $0x8001c9,%rcx
+  801c5b:	00 00 00 
+  801c5e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c60:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c65:	eb c1                	jmp    801c28 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c67:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c6c:	eb ba                	jmp    801c28 <ftruncate+0x5e>
+
+0000000000801c6e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801c6e:	55                   	push   %rbp
+  801c6f:	48 89 e5             	mov    %rsp,%rbp
+  801c72:	41 54                	push   %r12
+  801c74:	53                   	push   %rbx
+  801c75:	48 83 ec 10          	sub    $0x10,%rsp
+  801c79:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c7c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c80:	48 b8 ce 16 80 00 00 	movabs $0x8016ce,%rax
+  801c87:	00 00 00 
+  801c8a:	ff d0                	call   *%rax
+  801c8c:	85 c0                	test   %eax,%eax
+  801c8e:	78 4e                	js     801cde <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c90:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c94:	41 8b 3c 24          	mov    (%r12),%edi
+  801c98:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c9c:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  801ca3:	00 00 00 
+  801ca6:	ff d0                	call   *%rax
+  801ca8:	85 c0                	test   %eax,%eax
+  801caa:	78 32                	js     801cde <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801cac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801cb0:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801cb5:	74 30                	je     801ce7 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801cb7:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801cba:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801cc1:	00 00 00 
+    stat->st_isdir = 0;
+  801cc4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ccb:	00 00 00 
+    stat->st_dev = dev;
+  801cce:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801cd5:	48 89 de             	mov    %rbx,%rsi
+  801cd8:	4c 89 e7             	mov    %r12,%rdi
+  801cdb:	ff 50 28             	call   *0x28(%rax)
+}
+  801cde:	48 83 c4 10          	add    $0x10,%rsp
+  801ce2:	5b                   	pop    %rbx
+  801ce3:	41 5c                	pop    %r12
+  801ce5:	5d                   	pop    %rbp
+  801ce6:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ce7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801cec:	eb f0                	jmp    801cde <fstat+0x70>
+
+0000000000801cee <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801cee:	55                   	push   %rbp
+  801cef:	48 89 e5             	mov    %rsp,%rbp
+  801cf2:	41 54                	push   %r12
+  801cf4:	53                   	push   %rbx
+  801cf5:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801cf8:	be 00 00 00 00       	mov    $0x0,%esi
+  801cfd:	48 b8 6f 1f 80 00 00 	movabs $0x801f6f,%rax
+  801d04:	00 00 00 
+  801d07:	ff d0                	call   *%rax
+  801d09:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d0b:	85 c0                	test   %eax,%eax
+  801d0d:	78 25                	js     801d34 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d0f:	4c 89 e6             	mov    %r12,%rsi
+  801d12:	89 c7                	mov    %eax,%edi
+  801d14:	48 b8 6e 1c 80 00 00 	movabs $0x801c6e,%rax
+  801d1b:	00 00 00 
+  801d1e:	ff d0                	call   *%rax
+  801d20:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d23:	89 df                	mov    %ebx,%edi
+  801d25:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  801d2c:	00 00 00 
+  801d2f:	ff d0                	call   *%rax
+
+    return res;
+  801d31:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d34:	89 d8                	mov    %ebx,%eax
+  801d36:	5b                   	pop    %rbx
+  801d37:	41 5c                	pop    %r12
+  801d39:	5d                   	pop    %rbp
+  801d3a:	c3                   	ret
+
+0000000000801d3b <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801d3b:	55                   	push   %rbp
+  801d3c:	48 89 e5             	mov    %rsp,%rbp
+  801d3f:	41 54                	push   %r12
+  801d41:	53                   	push   %rbx
+  801d42:	48 83 ec 10          	sub    $0x10,%rsp
+  801d46:	41 89 fc             	mov    %edi,%r12d
+  801d49:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d4c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801d53:	00 00 00 
+  801d56:	83 38 00             	cmpl   $0x0,(%rax)
+  801d59:	74 5e                	je     801db9 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801d5b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801d61:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d66:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801d6d:	00 00 00 
+  801d70:	44 89 e6             	mov    %r12d,%esi
+  801d73:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801d7a:	00 00 00 
+  801d7d:	8b 38                	mov    (%rax),%edi
+  801d7f:	48 b8 4b 2a 80 00 00 	movabs $0x802a4b,%rax
+  801d86:	00 00 00 
+  801d89:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801d8b:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801d92:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801d93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d98:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801d9c:	48 89 de             	mov    %rbx,%rsi
+  801d9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801da4:	48 b8 b6 29 80 00 00 	movabs $0x8029b6,%rax
+  801dab:	00 00 00 
+  801dae:	ff d0                	call   *%rax
+}
+  801db0:	48 83 c4 10          	add    $0x10,%rsp
+  801db4:	5b                   	pop    %rbx
+  801db5:	41 5c                	pop    %r12
+  801db7:	5d                   	pop    %rbp
+  801db8:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801db9:	bf 03 00 00 00       	mov    $0x3,%edi
+  801dbe:	48 b8 eb 2a 80 00 00 	movabs $0x802aeb,%rax
+  801dc5:	00 00 00 
+  801dc8:	ff d0                	call   *%rax
+  801dca:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801dd1:	00 00 
+  801dd3:	eb 86                	jmp    801d5b <fsipc+0x20>
+
+0000000000801dd5 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801dd5:	55                   	push   %rbp
+  801dd6:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801dd9:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801de0:	00 00 00 
+  801de3:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801de6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801de8:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801deb:	be 00 00 00 00       	mov    $0x0,%esi
+  801df0:	bf 02 00 00 00       	mov    $0x2,%edi
+  801df5:	48 b8 3b 1d 80 00 00 	movabs $0x801d3b,%rax
+  801dfc:	00 00 00 
+  801dff:	ff d0                	call   *%rax
+}
+  801e01:	5d                   	pop    %rbp
+  801e02:	c3                   	ret
+
+0000000000801e03 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801e03:	55                   	push   %rbp
+  801e04:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e07:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801e0a:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801e11:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801e13:	be 00 00 00 00       	mov    $0x0,%esi
+  801e18:	bf 06 00 00 00       	mov    $0x6,%edi
+  801e1d:	48 b8 3b 1d 80 00 00 	movabs $0x801d3b,%rax
+  801e24:	00 00 00 
+  801e27:	ff d0                	call   *%rax
+}
+  801e29:	5d                   	pop    %rbp
+  801e2a:	c3                   	ret
+
+0000000000801e2b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801e2b:	55                   	push   %rbp
+  801e2c:	48 89 e5             	mov    %rsp,%rbp
+  801e2f:	41 54                	push   %r12
+  801e31:	53                   	push   %rbx
+  801e32:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e35:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801e38:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801e3f:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801e41:	be 00 00 00 00       	mov    $0x0,%esi
+  801e46:	bf 05 00 00 00       	mov    $0x5,%edi
+  801e4b:	48 b8 3b 1d 80 00 00 	movabs $0x801d3b,%rax
+  801e52:	00 00 00 
+  801e55:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e57:	85 c0                	test   %eax,%eax
+  801e59:	78 3d                	js     801e98 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e5b:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801e62:	00 00 00 
+  801e65:	4c 89 e6             	mov    %r12,%rsi
+  801e68:	48 89 df             	mov    %rbx,%rdi
+  801e6b:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  801e72:	00 00 00 
+  801e75:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801e77:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801e7e:	00 
+  801e7f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e85:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801e8c:	00 
+  801e8d:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801e93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e98:	5b                   	pop    %rbx
+  801e99:	41 5c                	pop    %r12
+  801e9b:	5d                   	pop    %rbp
+  801e9c:	c3                   	ret
+
+0000000000801e9d <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801e9d:	55                   	push   %rbp
+  801e9e:	48 89 e5             	mov    %rsp,%rbp
+  801ea1:	41 54                	push   %r12
+  801ea3:	53                   	push   %rbx
+  801ea4:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  801ea7:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  801eac:	48 39 c2             	cmp    %rax,%rdx
+  801eaf:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801eb3:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801eb6:	48 89 c2             	mov    %rax,%rdx
+  801eb9:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801ec0:	00 00 00 
+  801ec3:	48 b8 4f 0d 80 00 00 	movabs $0x800d4f,%rax
+  801eca:	00 00 00 
+  801ecd:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ecf:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801ed6:	00 00 00 
+  801ed9:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  801ede:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  801ee0:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  801ee4:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee9:	bf 04 00 00 00       	mov    $0x4,%edi
+  801eee:	48 b8 3b 1d 80 00 00 	movabs $0x801d3b,%rax
+  801ef5:	00 00 00 
+  801ef8:	ff d0                	call   *%rax
+  801efa:	48 98                	cltq
+}
+  801efc:	5b                   	pop    %rbx
+  801efd:	41 5c                	pop    %r12
+  801eff:	5d                   	pop    %rbp
+  801f00:	c3                   	ret
+
+0000000000801f01 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801f01:	55                   	push   %rbp
+  801f02:	48 89 e5             	mov    %rsp,%rbp
+  801f05:	41 54                	push   %r12
+  801f07:	53                   	push   %rbx
+  801f08:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f0b:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801f12:	00 00 00 
+  801f15:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801f18:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  801f1a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801f1f:	48 39 ca             	cmp    %rcx,%rdx
+  801f22:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  801f26:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  801f2a:	be 00 00 00 00       	mov    $0x0,%esi
+  801f2f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f34:	48 b8 3b 1d 80 00 00 	movabs $0x801d3b,%rax
+  801f3b:	00 00 00 
+  801f3e:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  801f40:	85 c0                	test   %eax,%eax
+  801f42:	78 27                	js     801f6b <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  801f44:	48 63 d8             	movslq %eax,%rbx
+  801f47:	48 89 da             	mov    %rbx,%rdx
+  801f4a:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801f51:	00 00 00 
+  801f54:	4c 89 e7             	mov    %r12,%rdi
+  801f57:	48 b8 4f 0d 80 00 00 	movabs $0x800d4f,%rax
+  801f5e:	00 00 00 
+  801f61:	ff d0                	call   *%rax
+    return bytes_read;
+  801f63:	48 89 d8             	mov    %rbx,%rax
+}
+  801f66:	5b                   	pop    %rbx
+  801f67:	41 5c                	pop    %r12
+  801f69:	5d                   	pop    %rbp
+  801f6a:	c3                   	ret
+        return bytes_read;
+  801f6b:	48 98                	cltq
+  801f6d:	eb f7                	jmp    801f66 <devfile_read+0x65>
+
+0000000000801f6f <open>:
+open(const char *path, int mode) {
+  801f6f:	55                   	push   %rbp
+  801f70:	48 89 e5             	mov    %rsp,%rbp
+  801f73:	41 55                	push   %r13
+  801f75:	41 54                	push   %r12
+  801f77:	53                   	push   %rbx
+  801f78:	48 83 ec 18          	sub    $0x18,%rsp
+  801f7c:	49 89 fc             	mov    %rdi,%r12
+  801f7f:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801f82:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  801f89:	00 00 00 
+  801f8c:	ff d0                	call   *%rax
+  801f8e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801f94:	0f 87 8a 00 00 00    	ja     802024 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801f9a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801f9e:	48 b8 6e 16 80 00 00 	movabs $0x80166e,%rax
+  801fa5:	00 00 00 
+  801fa8:	ff d0                	call   *%rax
+  801faa:	89 c3                	mov    %eax,%ebx
+  801fac:	85 c0                	test   %eax,%eax
+  801fae:	78 50                	js     802000 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801fb0:	4c 89 e6             	mov    %r12,%rsi
+  801fb3:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801fba:	00 00 00 
+  801fbd:	48 89 df             	mov    %rbx,%rdi
+  801fc0:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  801fc7:	00 00 00 
+  801fca:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801fcc:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801fd3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801fd7:	bf 01 00 00 00       	mov    $0x1,%edi
+  801fdc:	48 b8 3b 1d 80 00 00 	movabs $0x801d3b,%rax
+  801fe3:	00 00 00 
+  801fe6:	ff d0                	call   *%rax
+  801fe8:	89 c3                	mov    %eax,%ebx
+  801fea:	85 c0                	test   %eax,%eax
+  801fec:	78 1f                	js     80200d <open+0x9e>
+    return fd2num(fd);
+  801fee:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801ff2:	48 b8 40 16 80 00 00 	movabs $0x801640,%rax
+  801ff9:	00 00 00 
+  801ffc:	ff d0                	call   *%rax
+  801ffe:	89 c3                	mov    %eax,%ebx
+}
+  802000:	89 d8                	mov    %ebx,%eax
+  802002:	48 83 c4 18          	add    $0x18,%rsp
+  802006:	5b                   	pop    %rbx
+  802007:	41 5c                	pop    %r12
+  802009:	41 5d                	pop    %r13
+  80200b:	5d                   	pop    %rbp
+  80200c:	c3                   	ret
+        fd_close(fd, 0);
+  80200d:	be 00 00 00 00       	mov    $0x0,%esi
+  802012:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802016:	48 b8 89 17 80 00 00 	movabs $0x801789,%rax
+  80201d:	00 00 00 
+  802020:	ff d0                	call   *%rax
+        return res;
+  802022:	eb dc                	jmp    802000 <open+0x91>
+        return -E_BAD_PATH;
+  802024:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802029:	eb d5                	jmp    802000 <open+0x91>
+
+000000000080202b <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80202b:	55                   	push   %rbp
+  80202c:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80202f:	be 00 00 00 00       	mov    $0x0,%esi
+  802034:	bf 08 00 00 00       	mov    $0x8,%edi
+  802039:	48 b8 3b 1d 80 00 00 	movabs $0x801d3b,%rax
+  802040:	00 00 00 
+  802043:	ff d0                	call   *%rax
+}
+  802045:	5d                   	pop    %rbp
+  802046:	c3                   	ret
+
+0000000000802047 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802047:	55                   	push   %rbp
+  802048:	48 89 e5             	mov    %rsp,%rbp
+  80204b:	41 54                	push   %r12
+  80204d:	53                   	push   %rbx
+  80204e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802051:	48 b8 52 16 80 00 00 	movabs $0x801652,%rax
+  802058:	00 00 00 
+  80205b:	ff d0                	call   *%rax
+  80205d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802060:	48 be 80 31 80 00 00 	movabs $0x803180,%rsi
+  802067:	00 00 00 
+  80206a:	48 89 df             	mov    %rbx,%rdi
+  80206d:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  802074:	00 00 00 
+  802077:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802079:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80207e:	41 2b 04 24          	sub    (%r12),%eax
+  802082:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802088:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80208f:	00 00 00 
+    stat->st_dev = &devpipe;
+  802092:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802099:	00 00 00 
+  80209c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8020a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a8:	5b                   	pop    %rbx
+  8020a9:	41 5c                	pop    %r12
+  8020ab:	5d                   	pop    %rbp
+  8020ac:	c3                   	ret
+
+00000000008020ad <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8020ad:	55                   	push   %rbp
+  8020ae:	48 89 e5             	mov    %rsp,%rbp
+  8020b1:	41 54                	push   %r12
+  8020b3:	53                   	push   %rbx
+  8020b4:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8020b7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020bc:	48 89 fe             	mov    %rdi,%rsi
+  8020bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020c4:	49 bc 6a 11 80 00 00 	movabs $0x80116a,%r12
+  8020cb:	00 00 00 
+  8020ce:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8020d1:	48 89 df             	mov    %rbx,%rdi
+  8020d4:	48 b8 52 16 80 00 00 	movabs $0x801652,%rax
+  8020db:	00 00 00 
+  8020de:	ff d0                	call   *%rax
+  8020e0:	48 89 c6             	mov    %rax,%rsi
+  8020e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020ed:	41 ff d4             	call   *%r12
+}
+  8020f0:	5b                   	pop    %rbx
+  8020f1:	41 5c                	pop    %r12
+  8020f3:	5d                   	pop    %rbp
+  8020f4:	c3                   	ret
+
+00000000008020f5 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8020f5:	55                   	push   %rbp
+  8020f6:	48 89 e5             	mov    %rsp,%rbp
+  8020f9:	41 57                	push   %r15
+  8020fb:	41 56                	push   %r14
+  8020fd:	41 55                	push   %r13
+  8020ff:	41 54                	push   %r12
+  802101:	53                   	push   %rbx
+  802102:	48 83 ec 18          	sub    $0x18,%rsp
+  802106:	49 89 fc             	mov    %rdi,%r12
+  802109:	49 89 f5             	mov    %rsi,%r13
+  80210c:	49 89 d7             	mov    %rdx,%r15
+  80210f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802113:	48 b8 52 16 80 00 00 	movabs $0x801652,%rax
+  80211a:	00 00 00 
+  80211d:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80211f:	4d 85 ff             	test   %r15,%r15
+  802122:	0f 84 af 00 00 00    	je     8021d7 <devpipe_write+0xe2>
+  802128:	48 89 c3             	mov    %rax,%rbx
+  80212b:	4c 89 f8             	mov    %r15,%rax
+  80212e:	4d 89 ef             	mov    %r13,%r15
+  802131:	4c 01 e8             	add    %r13,%rax
+  802134:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802138:	49 bd 72 10 80 00 00 	movabs $0x801072,%r13
+  80213f:	00 00 00 
+            sys_yield();
+  802142:	49 be 0f 10 80 00 00 	movabs $0x80100f,%r14
+  802149:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80214c:	8b 73 04             	mov    0x4(%rbx),%esi
+  80214f:	48 63 ce             	movslq %esi,%rcx
+  802152:	48 63 03             	movslq (%rbx),%rax
+  802155:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80215b:	48 39 c1             	cmp    %rax,%rcx
+  80215e:	72 2e                	jb     80218e <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802160:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802165:	48 89 da             	mov    %rbx,%rdx
+  802168:	be 00 10 00 00       	mov    $0x1000,%esi
+  80216d:	4c 89 e7             	mov    %r12,%rdi
+  802170:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802173:	85 c0                	test   %eax,%eax
+  802175:	74 66                	je     8021dd <devpipe_write+0xe8>
+            sys_yield();
+  802177:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80217a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80217d:	48 63 ce             	movslq %esi,%rcx
+  802180:	48 63 03             	movslq (%rbx),%rax
+  802183:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802189:	48 39 c1             	cmp    %rax,%rcx
+  80218c:	73 d2                	jae    802160 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80218e:	41 0f b6 3f          	movzbl (%r15),%edi
+  802192:	48 89 ca             	mov    %rcx,%rdx
+  802195:	48 c1 ea 03          	shr    $0x3,%rdx
+  802199:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8021a0:	08 10 20 
+  8021a3:	48 f7 e2             	mul    %rdx
+  8021a6:	48 c1 ea 06          	shr    $0x6,%rdx
+  8021aa:	48 89 d0             	mov    %rdx,%rax
+  8021ad:	48 c1 e0 09          	shl    $0x9,%rax
+  8021b1:	48 29 d0             	sub    %rdx,%rax
+  8021b4:	48 c1 e0 03          	shl    $0x3,%rax
+  8021b8:	48 29 c1             	sub    %rax,%rcx
+  8021bb:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8021c0:	83 c6 01             	add    $0x1,%esi
+  8021c3:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8021c6:	49 83 c7 01          	add    $0x1,%r15
+  8021ca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021ce:	49 39 c7             	cmp    %rax,%r15
+  8021d1:	0f 85 75 ff ff ff    	jne    80214c <devpipe_write+0x57>
+    return n;
+  8021d7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021db:	eb 05                	jmp    8021e2 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8021dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021e2:	48 83 c4 18          	add    $0x18,%rsp
+  8021e6:	5b                   	pop    %rbx
+  8021e7:	41 5c                	pop    %r12
+  8021e9:	41 5d                	pop    %r13
+  8021eb:	41 5e                	pop    %r14
+  8021ed:	41 5f                	pop    %r15
+  8021ef:	5d                   	pop    %rbp
+  8021f0:	c3                   	ret
+
+00000000008021f1 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8021f1:	55                   	push   %rbp
+  8021f2:	48 89 e5             	mov    %rsp,%rbp
+  8021f5:	41 57                	push   %r15
+  8021f7:	41 56                	push   %r14
+  8021f9:	41 55                	push   %r13
+  8021fb:	41 54                	push   %r12
+  8021fd:	53                   	push   %rbx
+  8021fe:	48 83 ec 18          	sub    $0x18,%rsp
+  802202:	49 89 fc             	mov    %rdi,%r12
+  802205:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802209:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80220d:	48 b8 52 16 80 00 00 	movabs $0x801652,%rax
+  802214:	00 00 00 
+  802217:	ff d0                	call   *%rax
+  802219:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80221c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802222:	49 bd 72 10 80 00 00 	movabs $0x801072,%r13
+  802229:	00 00 00 
+            sys_yield();
+  80222c:	49 be 0f 10 80 00 00 	movabs $0x80100f,%r14
+  802233:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802236:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80223b:	74 7d                	je     8022ba <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80223d:	8b 03                	mov    (%rbx),%eax
+  80223f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802242:	75 26                	jne    80226a <devpipe_read+0x79>
+            if (i > 0) return i;
+  802244:	4d 85 ff             	test   %r15,%r15
+  802247:	75 77                	jne    8022c0 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802249:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80224e:	48 89 da             	mov    %rbx,%rdx
+  802251:	be 00 10 00 00       	mov    $0x1000,%esi
+  802256:	4c 89 e7             	mov    %r12,%rdi
+  802259:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80225c:	85 c0                	test   %eax,%eax
+  80225e:	74 72                	je     8022d2 <devpipe_read+0xe1>
+            sys_yield();
+  802260:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802263:	8b 03                	mov    (%rbx),%eax
+  802265:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802268:	74 df                	je     802249 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80226a:	48 63 c8             	movslq %eax,%rcx
+  80226d:	48 89 ca             	mov    %rcx,%rdx
+  802270:	48 c1 ea 03          	shr    $0x3,%rdx
+  802274:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80227b:	08 10 20 
+  80227e:	48 89 d0             	mov    %rdx,%rax
+  802281:	48 f7 e6             	mul    %rsi
+  802284:	48 c1 ea 06          	shr    $0x6,%rdx
+  802288:	48 89 d0             	mov    %rdx,%rax
+  80228b:	48 c1 e0 09          	shl    $0x9,%rax
+  80228f:	48 29 d0             	sub    %rdx,%rax
+  802292:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802299:	00 
+  80229a:	48 89 c8             	mov    %rcx,%rax
+  80229d:	48 29 d0             	sub    %rdx,%rax
+  8022a0:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8022a5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8022a9:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8022ad:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8022b0:	49 83 c7 01          	add    $0x1,%r15
+  8022b4:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8022b8:	75 83                	jne    80223d <devpipe_read+0x4c>
+    return n;
+  8022ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022be:	eb 03                	jmp    8022c3 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8022c0:	4c 89 f8             	mov    %r15,%rax
+}
+  8022c3:	48 83 c4 18          	add    $0x18,%rsp
+  8022c7:	5b                   	pop    %rbx
+  8022c8:	41 5c                	pop    %r12
+  8022ca:	41 5d                	pop    %r13
+  8022cc:	41 5e                	pop    %r14
+  8022ce:	41 5f                	pop    %r15
+  8022d0:	5d                   	pop    %rbp
+  8022d1:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8022d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d7:	eb ea                	jmp    8022c3 <devpipe_read+0xd2>
+
+00000000008022d9 <pipe>:
+pipe(int pfd[2]) {
+  8022d9:	55                   	push   %rbp
+  8022da:	48 89 e5             	mov    %rsp,%rbp
+  8022dd:	41 55                	push   %r13
+  8022df:	41 54                	push   %r12
+  8022e1:	53                   	push   %rbx
+  8022e2:	48 83 ec 18          	sub    $0x18,%rsp
+  8022e6:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022e9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8022ed:	48 b8 6e 16 80 00 00 	movabs $0x80166e,%rax
+  8022f4:	00 00 00 
+  8022f7:	ff d0                	call   *%rax
+  8022f9:	89 c3                	mov    %eax,%ebx
+  8022fb:	85 c0                	test   %eax,%eax
+  8022fd:	0f 88 a0 01 00 00    	js     8024a3 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802303:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802308:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80230d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802311:	bf 00 00 00 00       	mov    $0x0,%edi
+  802316:	48 b8 9e 10 80 00 00 	movabs $0x80109e,%rax
+  80231d:	00 00 00 
+  802320:	ff d0                	call   *%rax
+  802322:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802324:	85 c0                	test   %eax,%eax
+  802326:	0f 88 77 01 00 00    	js     8024a3 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80232c:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802330:	48 b8 6e 16 80 00 00 	movabs $0x80166e,%rax
+  802337:	00 00 00 
+  80233a:	ff d0                	call   *%rax
+  80233c:	89 c3                	mov    %eax,%ebx
+  80233e:	85 c0                	test   %eax,%eax
+  802340:	0f 88 43 01 00 00    	js     802489 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802346:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80234b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802350:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802354:	bf 00 00 00 00       	mov    $0x0,%edi
+  802359:	48 b8 9e 10 80 00 00 	movabs $0x80109e,%rax
+  802360:	00 00 00 
+  802363:	ff d0                	call   *%rax
+  802365:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802367:	85 c0                	test   %eax,%eax
+  802369:	0f 88 1a 01 00 00    	js     802489 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80236f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802373:	48 b8 52 16 80 00 00 	movabs $0x801652,%rax
+  80237a:	00 00 00 
+  80237d:	ff d0                	call   *%rax
+  80237f:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802382:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802387:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80238c:	48 89 c6             	mov    %rax,%rsi
+  80238f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802394:	48 b8 9e 10 80 00 00 	movabs $0x80109e,%rax
+  80239b:	00 00 00 
+  80239e:	ff d0                	call   *%rax
+  8023a0:	89 c3                	mov    %eax,%ebx
+  8023a2:	85 c0                	test   %eax,%eax
+  8023a4:	0f 88 c5 00 00 00    	js     80246f <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8023aa:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8023ae:	48 b8 52 16 80 00 00 	movabs $0x801652,%rax
+  8023b5:	00 00 00 
+  8023b8:	ff d0                	call   *%rax
+  8023ba:	48 89 c1             	mov    %rax,%rcx
+  8023bd:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8023c3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ce:	4c 89 ee             	mov    %r13,%rsi
+  8023d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023d6:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  8023dd:	00 00 00 
+  8023e0:	ff d0                	call   *%rax
+  8023e2:	89 c3                	mov    %eax,%ebx
+  8023e4:	85 c0                	test   %eax,%eax
+  8023e6:	78 6e                	js     802456 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8023e8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8023ed:	4c 89 ef             	mov    %r13,%rdi
+  8023f0:	48 b8 40 10 80 00 00 	movabs $0x801040,%rax
+  8023f7:	00 00 00 
+  8023fa:	ff d0                	call   *%rax
+  8023fc:	83 f8 02             	cmp    $0x2,%eax
+  8023ff:	0f 85 ab 00 00 00    	jne    8024b0 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802405:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80240c:	00 00 
+  80240e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802412:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802414:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802418:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80241f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802423:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802425:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802429:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802430:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802434:	48 bb 40 16 80 00 00 	movabs $0x801640,%rbx
+  80243b:	00 00 00 
+  80243e:	ff d3                	call   *%rbx
+  802440:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802444:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802448:	ff d3                	call   *%rbx
+  80244a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80244f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802454:	eb 4d                	jmp    8024a3 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802456:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80245b:	4c 89 ee             	mov    %r13,%rsi
+  80245e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802463:	48 b8 6a 11 80 00 00 	movabs $0x80116a,%rax
+  80246a:	00 00 00 
+  80246d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80246f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802474:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802478:	bf 00 00 00 00       	mov    $0x0,%edi
+  80247d:	48 b8 6a 11 80 00 00 	movabs $0x80116a,%rax
+  802484:	00 00 00 
+  802487:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802489:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80248e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802492:	bf 00 00 00 00       	mov    $0x0,%edi
+  802497:	48 b8 6a 11 80 00 00 	movabs $0x80116a,%rax
+  80249e:	00 00 00 
+  8024a1:	ff d0                	call   *%rax
+}
+  8024a3:	89 d8                	mov    %ebx,%eax
+  8024a5:	48 83 c4 18          	add    $0x18,%rsp
+  8024a9:	5b                   	pop    %rbx
+  8024aa:	41 5c                	pop    %r12
+  8024ac:	41 5d                	pop    %r13
+  8024ae:	5d                   	pop    %rbp
+  8024af:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8024b0:	48 b9 b0 31 80 00 00 	movabs $0x8031b0,%rcx
+  8024b7:	00 00 00 
+  8024ba:	48 ba 87 31 80 00 00 	movabs $0x803187,%rdx
+  8024c1:	00 00 00 
+  8024c4:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8024c9:	48 bf 9c 31 80 00 00 	movabs $0x80319c,%rdi
+  8024d0:	00 00 00 
+  8024d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d8:	49 b8 13 29 80 00 00 	movabs $0x802913,%r8
+  8024df:	00 00 00 
+  8024e2:	41 ff d0             	call   *%r8
+
+00000000008024e5 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8024e5:	55                   	push   %rbp
+  8024e6:	48 89 e5             	mov    %rsp,%rbp
+  8024e9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8024ed:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024f1:	48 b8 ce 16 80 00 00 	movabs $0x8016ce,%rax
+  8024f8:	00 00 00 
+  8024fb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024fd:	85 c0                	test   %eax,%eax
+  8024ff:	78 35                	js     802536 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802501:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802505:	48 b8 52 16 80 00 00 	movabs $0x801652,%rax
+  80250c:	00 00 00 
+  80250f:	ff d0                	call   *%rax
+  802511:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802514:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802519:	be 00 10 00 00       	mov    $0x1000,%esi
+  80251e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802522:	48 b8 72 10 80 00 00 	movabs $0x801072,%rax
+  802529:	00 00 00 
+  80252c:	ff d0                	call   *%rax
+  80252e:	85 c0                	test   %eax,%eax
+  802530:	0f 94 c0             	sete   %al
+  802533:	0f b6 c0             	movzbl %al,%eax
+}
+  802536:	c9                   	leave
+  802537:	c3                   	ret
+
+0000000000802538 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802538:	48 89 f8             	mov    %rdi,%rax
+  80253b:	48 c1 e8 27          	shr    $0x27,%rax
+  80253f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802546:	01 00 00 
+  802549:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80254d:	f6 c2 01             	test   $0x1,%dl
+  802550:	74 6d                	je     8025bf <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802552:	48 89 f8             	mov    %rdi,%rax
+  802555:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802559:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802560:	01 00 00 
+  802563:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802567:	f6 c2 01             	test   $0x1,%dl
+  80256a:	74 62                	je     8025ce <get_uvpt_entry+0x96>
+  80256c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802573:	01 00 00 
+  802576:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80257a:	f6 c2 80             	test   $0x80,%dl
+  80257d:	75 4f                	jne    8025ce <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80257f:	48 89 f8             	mov    %rdi,%rax
+  802582:	48 c1 e8 15          	shr    $0x15,%rax
+  802586:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80258d:	01 00 00 
+  802590:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802594:	f6 c2 01             	test   $0x1,%dl
+  802597:	74 44                	je     8025dd <get_uvpt_entry+0xa5>
+  802599:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025a0:	01 00 00 
+  8025a3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025a7:	f6 c2 80             	test   $0x80,%dl
+  8025aa:	75 31                	jne    8025dd <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8025ac:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8025b0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8025b7:	01 00 00 
+  8025ba:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8025be:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8025bf:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8025c6:	01 00 00 
+  8025c9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025cd:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025ce:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8025d5:	01 00 00 
+  8025d8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025dc:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025dd:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025e4:	01 00 00 
+  8025e7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025eb:	c3                   	ret
+
+00000000008025ec <get_prot>:
+
+int
+get_prot(void *va) {
+  8025ec:	55                   	push   %rbp
+  8025ed:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8025f0:	48 b8 38 25 80 00 00 	movabs $0x802538,%rax
+  8025f7:	00 00 00 
+  8025fa:	ff d0                	call   *%rax
+  8025fc:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8025ff:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802604:	89 c1                	mov    %eax,%ecx
+  802606:	83 c9 04             	or     $0x4,%ecx
+  802609:	f6 c2 01             	test   $0x1,%dl
+  80260c:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80260f:	89 c1                	mov    %eax,%ecx
+  802611:	83 c9 02             	or     $0x2,%ecx
+  802614:	f6 c2 02             	test   $0x2,%dl
+  802617:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80261a:	89 c1                	mov    %eax,%ecx
+  80261c:	83 c9 01             	or     $0x1,%ecx
+  80261f:	48 85 d2             	test   %rdx,%rdx
+  802622:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802625:	89 c1                	mov    %eax,%ecx
+  802627:	83 c9 40             	or     $0x40,%ecx
+  80262a:	f6 c6 04             	test   $0x4,%dh
+  80262d:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802630:	5d                   	pop    %rbp
+  802631:	c3                   	ret
+
+0000000000802632 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802632:	55                   	push   %rbp
+  802633:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802636:	48 b8 38 25 80 00 00 	movabs $0x802538,%rax
+  80263d:	00 00 00 
+  802640:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802642:	48 c1 e8 06          	shr    $0x6,%rax
+  802646:	83 e0 01             	and    $0x1,%eax
+}
+  802649:	5d                   	pop    %rbp
+  80264a:	c3                   	ret
+
+000000000080264b <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80264b:	55                   	push   %rbp
+  80264c:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80264f:	48 b8 38 25 80 00 00 	movabs $0x802538,%rax
+  802656:	00 00 00 
+  802659:	ff d0                	call   *%rax
+  80265b:	83 e0 01             	and    $0x1,%eax
+}
+  80265e:	5d                   	pop    %rbp
+  80265f:	c3                   	ret
+
+0000000000802660 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802660:	55                   	push   %rbp
+  802661:	48 89 e5             	mov    %rsp,%rbp
+  802664:	41 57                	push   %r15
+  802666:	41 56                	push   %r14
+  802668:	41 55                	push   %r13
+  80266a:	41 54                	push   %r12
+  80266c:	53                   	push   %rbx
+  80266d:	48 83 ec 18          	sub    $0x18,%rsp
+  802671:	49 89 ff             	mov    %rdi,%r15
+  802674:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802678:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  80267d:	49 bc 4b 26 80 00 00 	movabs $0x80264b,%r12
+  802684:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802687:	49 be ec 25 80 00 00 	movabs $0x8025ec,%r14
+  80268e:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802691:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802698:	00 00 00 
+  80269b:	eb 0c                	jmp    8026a9 <foreach_shared_region+0x49>
+  80269d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8026a4:	4c 39 eb             	cmp    %r13,%rbx
+  8026a7:	74 38                	je     8026e1 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  8026a9:	48 89 df             	mov    %rbx,%rdi
+  8026ac:	41 ff d4             	call   *%r12
+  8026af:	84 c0                	test   %al,%al
+  8026b1:	74 ea                	je     80269d <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  8026b3:	48 89 df             	mov    %rbx,%rdi
+  8026b6:	41 ff d6             	call   *%r14
+  8026b9:	a8 40                	test   $0x40,%al
+  8026bb:	74 e0                	je     80269d <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8026bd:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8026c4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8026c8:	48 89 df             	mov    %rbx,%rdi
+  8026cb:	41 ff d7             	call   *%r15
+        if (err)
+  8026ce:	85 c0                	test   %eax,%eax
+  8026d0:	74 cb                	je     80269d <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8026d2:	48 83 c4 18          	add    $0x18,%rsp
+  8026d6:	5b                   	pop    %rbx
+  8026d7:	41 5c                	pop    %r12
+  8026d9:	41 5d                	pop    %r13
+  8026db:	41 5e                	pop    %r14
+  8026dd:	41 5f                	pop    %r15
+  8026df:	5d                   	pop    %rbp
+  8026e0:	c3                   	ret
+    return 0;
+  8026e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026e6:	eb ea                	jmp    8026d2 <foreach_shared_region+0x72>
+
+00000000008026e8 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8026e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ed:	c3                   	ret
+
+00000000008026ee <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8026ee:	55                   	push   %rbp
+  8026ef:	48 89 e5             	mov    %rsp,%rbp
+  8026f2:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8026f5:	48 be d4 31 80 00 00 	movabs $0x8031d4,%rsi
+  8026fc:	00 00 00 
+  8026ff:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  802706:	00 00 00 
+  802709:	ff d0                	call   *%rax
+    return 0;
+}
+  80270b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802710:	5d                   	pop    %rbp
+  802711:	c3                   	ret
+
+0000000000802712 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802712:	55                   	push   %rbp
+  802713:	48 89 e5             	mov    %rsp,%rbp
+  802716:	41 57                	push   %r15
+  802718:	41 56                	push   %r14
+  80271a:	41 55                	push   %r13
+  80271c:	41 54                	push   %r12
+  80271e:	53                   	push   %rbx
+  80271f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802726:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80272d:	48 85 d2             	test   %rdx,%rdx
+  802730:	74 7a                	je     8027ac <devcons_write+0x9a>
+  802732:	49 89 d6             	mov    %rdx,%r14
+  802735:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80273b:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802740:	49 bf e8 0c 80 00 00 	movabs $0x800ce8,%r15
+  802747:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80274a:	4c 89 f3             	mov    %r14,%rbx
+  80274d:	48 29 f3             	sub    %rsi,%rbx
+  802750:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802755:	48 39 c3             	cmp    %rax,%rbx
+  802758:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80275c:	4c 63 eb             	movslq %ebx,%r13
+  80275f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802766:	48 01 c6             	add    %rax,%rsi
+  802769:	4c 89 ea             	mov    %r13,%rdx
+  80276c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802773:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802776:	4c 89 ee             	mov    %r13,%rsi
+  802779:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802780:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  802787:	00 00 00 
+  80278a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80278c:	41 01 dc             	add    %ebx,%r12d
+  80278f:	49 63 f4             	movslq %r12d,%rsi
+  802792:	4c 39 f6             	cmp    %r14,%rsi
+  802795:	72 b3                	jb     80274a <devcons_write+0x38>
+    return res;
+  802797:	49 63 c4             	movslq %r12d,%rax
+}
+  80279a:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8027a1:	5b                   	pop    %rbx
+  8027a2:	41 5c                	pop    %r12
+  8027a4:	41 5d                	pop    %r13
+  8027a6:	41 5e                	pop    %r14
+  8027a8:	41 5f                	pop    %r15
+  8027aa:	5d                   	pop    %rbp
+  8027ab:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8027ac:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8027b2:	eb e3                	jmp    802797 <devcons_write+0x85>
+
+00000000008027b4 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8027b4:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8027b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027bc:	48 85 c0             	test   %rax,%rax
+  8027bf:	74 55                	je     802816 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8027c1:	55                   	push   %rbp
+  8027c2:	48 89 e5             	mov    %rsp,%rbp
+  8027c5:	41 55                	push   %r13
+  8027c7:	41 54                	push   %r12
+  8027c9:	53                   	push   %rbx
+  8027ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8027ce:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8027d1:	48 bb 42 0f 80 00 00 	movabs $0x800f42,%rbx
+  8027d8:	00 00 00 
+  8027db:	49 bc 0f 10 80 00 00 	movabs $0x80100f,%r12
+  8027e2:	00 00 00 
+  8027e5:	eb 03                	jmp    8027ea <devcons_read+0x36>
+  8027e7:	41 ff d4             	call   *%r12
+  8027ea:	ff d3                	call   *%rbx
+  8027ec:	85 c0                	test   %eax,%eax
+  8027ee:	74 f7                	je     8027e7 <devcons_read+0x33>
+    if (c < 0) return c;
+  8027f0:	48 63 d0             	movslq %eax,%rdx
+  8027f3:	78 13                	js     802808 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8027f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027fa:	83 f8 04             	cmp    $0x4,%eax
+  8027fd:	74 09                	je     802808 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8027ff:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802803:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802808:	48 89 d0             	mov    %rdx,%rax
+  80280b:	48 83 c4 08          	add    $0x8,%rsp
+  80280f:	5b                   	pop    %rbx
+  802810:	41 5c                	pop    %r12
+  802812:	41 5d                	pop    %r13
+  802814:	5d                   	pop    %rbp
+  802815:	c3                   	ret
+  802816:	48 89 d0             	mov    %rdx,%rax
+  802819:	c3                   	ret
+
+000000000080281a <cputchar>:
+cputchar(int ch) {
+  80281a:	55                   	push   %rbp
+  80281b:	48 89 e5             	mov    %rsp,%rbp
+  80281e:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802822:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802826:	be 01 00 00 00       	mov    $0x1,%esi
+  80282b:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80282f:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  802836:	00 00 00 
+  802839:	ff d0                	call   *%rax
+}
+  80283b:	c9                   	leave
+  80283c:	c3                   	ret
+
+000000000080283d <getchar>:
+getchar(void) {
+  80283d:	55                   	push   %rbp
+  80283e:	48 89 e5             	mov    %rsp,%rbp
+  802841:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802845:	ba 01 00 00 00       	mov    $0x1,%edx
+  80284a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80284e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802853:	48 b8 b1 19 80 00 00 	movabs $0x8019b1,%rax
+  80285a:	00 00 00 
+  80285d:	ff d0                	call   *%rax
+  80285f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802861:	85 c0                	test   %eax,%eax
+  802863:	78 06                	js     80286b <getchar+0x2e>
+  802865:	74 08                	je     80286f <getchar+0x32>
+  802867:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80286b:	89 d0                	mov    %edx,%eax
+  80286d:	c9                   	leave
+  80286e:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80286f:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802874:	eb f5                	jmp    80286b <getchar+0x2e>
+
+0000000000802876 <iscons>:
+iscons(int fdnum) {
+  802876:	55                   	push   %rbp
+  802877:	48 89 e5             	mov    %rsp,%rbp
+  80287a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80287e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802882:	48 b8 ce 16 80 00 00 	movabs $0x8016ce,%rax
+  802889:	00 00 00 
+  80288c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80288e:	85 c0                	test   %eax,%eax
+  802890:	78 18                	js     8028aa <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802892:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802896:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  80289d:	00 00 00 
+  8028a0:	8b 00                	mov    (%rax),%eax
+  8028a2:	39 02                	cmp    %eax,(%rdx)
+  8028a4:	0f 94 c0             	sete   %al
+  8028a7:	0f b6 c0             	movzbl %al,%eax
+}
+  8028aa:	c9                   	leave
+  8028ab:	c3                   	ret
+
+00000000008028ac <opencons>:
+opencons(void) {
+  8028ac:	55                   	push   %rbp
+  8028ad:	48 89 e5             	mov    %rsp,%rbp
+  8028b0:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8028b4:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8028b8:	48 b8 6e 16 80 00 00 	movabs $0x80166e,%rax
+  8028bf:	00 00 00 
+  8028c2:	ff d0                	call   *%rax
+  8028c4:	85 c0                	test   %eax,%eax
+  8028c6:	78 49                	js     802911 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8028c8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8028cd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028d2:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8028d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028db:	48 b8 9e 10 80 00 00 	movabs $0x80109e,%rax
+  8028e2:	00 00 00 
+  8028e5:	ff d0                	call   *%rax
+  8028e7:	85 c0                	test   %eax,%eax
+  8028e9:	78 26                	js     802911 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8028eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028ef:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  8028f6:	00 00 
+  8028f8:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8028fa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8028fe:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802905:	48 b8 40 16 80 00 00 	movabs $0x801640,%rax
+  80290c:	00 00 00 
+  80290f:	ff d0                	call   *%rax
+}
+  802911:	c9                   	leave
+  802912:	c3                   	ret
+
+0000000000802913 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802913:	55                   	push   %rbp
+  802914:	48 89 e5             	mov    %rsp,%rbp
+  802917:	41 56                	push   %r14
+  802919:	41 55                	push   %r13
+  80291b:	41 54                	push   %r12
+  80291d:	53                   	push   %rbx
+  80291e:	48 83 ec 50          	sub    $0x50,%rsp
+  802922:	49 89 fc             	mov    %rdi,%r12
+  802925:	41 89 f5             	mov    %esi,%r13d
+  802928:	48 89 d3             	mov    %rdx,%rbx
+  80292b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80292f:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802933:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802937:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80293e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802942:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802946:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80294a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80294e:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802955:	00 00 00 
+  802958:	4c 8b 30             	mov    (%rax),%r14
+  80295b:	48 b8 de 0f 80 00 00 	movabs $0x800fde,%rax
+  802962:	00 00 00 
+  802965:	ff d0                	call   *%rax
+  802967:	89 c6                	mov    %eax,%esi
+  802969:	45 89 e8             	mov    %r13d,%r8d
+  80296c:	4c 89 e1             	mov    %r12,%rcx
+  80296f:	4c 89 f2             	mov    %r14,%rdx
+  802972:	48 bf e0 31 80 00 00 	movabs $0x8031e0,%rdi
+  802979:	00 00 00 
+  80297c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802981:	49 bc c9 01 80 00 00 	movabs $0x8001c9,%r12
+  802988:	00 00 00 
+  80298b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80298e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802992:	48 89 df             	mov    %rbx,%rdi
+  802995:	48 b8 65 01 80 00 00 	movabs $0x800165,%rax
+  80299c:	00 00 00 
+  80299f:	ff d0                	call   *%rax
+    cprintf("\n");
+  8029a1:	48 bf 3b 31 80 00 00 	movabs $0x80313b,%rdi
+  8029a8:	00 00 00 
+  8029ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b0:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8029b3:	cc                   	int3
+  8029b4:	eb fd                	jmp    8029b3 <_panic+0xa0>
+
+00000000008029b6 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8029b6:	55                   	push   %rbp
+  8029b7:	48 89 e5             	mov    %rsp,%rbp
+  8029ba:	41 54                	push   %r12
+  8029bc:	53                   	push   %rbx
+  8029bd:	48 89 fb             	mov    %rdi,%rbx
+  8029c0:	48 89 f7             	mov    %rsi,%rdi
+  8029c3:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8029c6:	48 85 f6             	test   %rsi,%rsi
+  8029c9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029d0:	00 00 00 
+  8029d3:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8029d7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029dc:	48 b8 08 14 80 00 00 	movabs $0x801408,%rax
+  8029e3:	00 00 00 
+  8029e6:	ff d0                	call   *%rax
+    if (res < 0) {
+  8029e8:	85 c0                	test   %eax,%eax
+  8029ea:	78 45                	js     802a31 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8029ec:	48 85 db             	test   %rbx,%rbx
+  8029ef:	74 12                	je     802a03 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8029f1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029f8:	00 00 00 
+  8029fb:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802a01:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802a03:	4d 85 e4             	test   %r12,%r12
+  802a06:	74 14                	je     802a1c <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802a08:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a0f:	00 00 00 
+  802a12:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802a18:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802a1c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a23:	00 00 00 
+  802a26:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802a2c:	5b                   	pop    %rbx
+  802a2d:	41 5c                	pop    %r12
+  802a2f:	5d                   	pop    %rbp
+  802a30:	c3                   	ret
+        if (from_env_store)
+  802a31:	48 85 db             	test   %rbx,%rbx
+  802a34:	74 06                	je     802a3c <ipc_recv+0x86>
+            *from_env_store = 0;
+  802a36:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802a3c:	4d 85 e4             	test   %r12,%r12
+  802a3f:	74 eb                	je     802a2c <ipc_recv+0x76>
+            *perm_store = 0;
+  802a41:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802a48:	00 
+  802a49:	eb e1                	jmp    802a2c <ipc_recv+0x76>
+
+0000000000802a4b <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802a4b:	55                   	push   %rbp
+  802a4c:	48 89 e5             	mov    %rsp,%rbp
+  802a4f:	41 57                	push   %r15
+  802a51:	41 56                	push   %r14
+  802a53:	41 55                	push   %r13
+  802a55:	41 54                	push   %r12
+  802a57:	53                   	push   %rbx
+  802a58:	48 83 ec 18          	sub    $0x18,%rsp
+  802a5c:	41 89 fd             	mov    %edi,%r13d
+  802a5f:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802a62:	48 89 d3             	mov    %rdx,%rbx
+  802a65:	49 89 cc             	mov    %rcx,%r12
+  802a68:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a6c:	48 85 d2             	test   %rdx,%rdx
+  802a6f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a76:	00 00 00 
+  802a79:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a7d:	49 be dc 13 80 00 00 	movabs $0x8013dc,%r14
+  802a84:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802a87:	49 bf 0f 10 80 00 00 	movabs $0x80100f,%r15
+  802a8e:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a91:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802a94:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802a98:	4c 89 e1             	mov    %r12,%rcx
+  802a9b:	48 89 da             	mov    %rbx,%rdx
+  802a9e:	44 89 ef             	mov    %r13d,%edi
+  802aa1:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802aa4:	85 c0                	test   %eax,%eax
+  802aa6:	74 34                	je     802adc <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802aa8:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802aab:	75 05                	jne    802ab2 <ipc_send+0x67>
+        sys_yield();
+  802aad:	41 ff d7             	call   *%r15
+    while (true) {
+  802ab0:	eb df                	jmp    802a91 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802ab2:	48 ba 03 32 80 00 00 	movabs $0x803203,%rdx
+  802ab9:	00 00 00 
+  802abc:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802ac1:	48 bf 1c 32 80 00 00 	movabs $0x80321c,%rdi
+  802ac8:	00 00 00 
+  802acb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad0:	48 b9 13 29 80 00 00 	movabs $0x802913,%rcx
+  802ad7:	00 00 00 
+  802ada:	ff d1                	call   *%rcx
+    }
+}
+  802adc:	48 83 c4 18          	add    $0x18,%rsp
+  802ae0:	5b                   	pop    %rbx
+  802ae1:	41 5c                	pop    %r12
+  802ae3:	41 5d                	pop    %r13
+  802ae5:	41 5e                	pop    %r14
+  802ae7:	41 5f                	pop    %r15
+  802ae9:	5d                   	pop    %rbp
+  802aea:	c3                   	ret
+
+0000000000802aeb <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802aeb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802af0:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802af7:	00 00 00 
+  802afa:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802b01:	48 01 ca             	add    %rcx,%rdx
+  802b04:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802b0a:	39 fa                	cmp    %edi,%edx
+  802b0c:	74 12                	je     802b20 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802b0e:	48 83 c0 01          	add    $0x1,%rax
+  802b12:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b18:	75 e0                	jne    802afa <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802b1a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b1f:	c3                   	ret
+            return envs[i].env_id;
+  802b20:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802b27:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b2e:	00 00 00 
+  802b31:	48 01 d0             	add    %rdx,%rax
+  802b34:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b3a:	c3                   	ret
+  802b3b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000802b40 <__rodata_start>:
+  802b40:	49 20 72 65          	rex.WB and %sil,0x65(%r10)
+  802b44:	61                   	(bad)
+  802b45:	64 20 25 30 38 78 20 	and    %ah,%fs:0x20783830(%rip)        # 20f8637c <__bss_end+0x2077e37c>
+  802b4c:	66 72 6f             	data16 jb 802bbe <__rodata_start+0x7e>
+  802b4f:	6d                   	insl   (%dx),%es:(%rdi)
+  802b50:	20 6c 6f 63          	and    %ch,0x63(%rdi,%rbp,2)
+  802b54:	61                   	(bad)
+  802b55:	74 69                	je     802bc0 <__rodata_start+0x80>
+  802b57:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802b58:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b59:	20 30                	and    %dh,(%rax)
+  802b5b:	78 38                	js     802b95 <__rodata_start+0x55>
+  802b5d:	30 34 30             	xor    %dh,(%rax,%rsi,1)
+  802b60:	30 30                	xor    %dh,(%rax)
+  802b62:	30 30                	xor    %dh,(%rax)
+  802b64:	30 30                	xor    %dh,(%rax)
+  802b66:	21 0a                	and    %ecx,(%rdx)
+  802b68:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  802b6f:	77 6e                	ja     802bdf <__rodata_start+0x9f>
+  802b71:	3e 00 30             	ds add %dh,(%rax)
+  802b74:	31 32                	xor    %esi,(%rdx)
+  802b76:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802b7d:	41                   	rex.B
+  802b7e:	42                   	rex.X
+  802b7f:	43                   	rex.XB
+  802b80:	44                   	rex.R
+  802b81:	45                   	rex.RB
+  802b82:	46 00 30             	rex.RX add %r14b,(%rax)
+  802b85:	31 32                	xor    %esi,(%rdx)
+  802b87:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802b8e:	61                   	(bad)
+  802b8f:	62 63 64 65 66       	(bad)
+  802b94:	00 28                	add    %ch,(%rax)
+  802b96:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b97:	75 6c                	jne    802c05 <__rodata_start+0xc5>
+  802b99:	6c                   	insb   (%dx),%es:(%rdi)
+  802b9a:	29 00                	sub    %eax,(%rax)
+  802b9c:	65 72 72             	gs jb  802c11 <__rodata_start+0xd1>
+  802b9f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ba0:	72 20                	jb     802bc2 <__rodata_start+0x82>
+  802ba2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802ba7:	73 70                	jae    802c19 <__rodata_start+0xd9>
+  802ba9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802bad:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802bb4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bb5:	72 00                	jb     802bb7 <__rodata_start+0x77>
+  802bb7:	62 61 64 20 65       	(bad)
+  802bbc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bbd:	76 69                	jbe    802c28 <__rodata_start+0xe8>
+  802bbf:	72 6f                	jb     802c30 <__rodata_start+0xf0>
+  802bc1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bc2:	6d                   	insl   (%dx),%es:(%rdi)
+  802bc3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802bc5:	74 00                	je     802bc7 <__rodata_start+0x87>
+  802bc7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802bce:	20 70 61             	and    %dh,0x61(%rax)
+  802bd1:	72 61                	jb     802c34 <__rodata_start+0xf4>
+  802bd3:	6d                   	insl   (%dx),%es:(%rdi)
+  802bd4:	65 74 65             	gs je  802c3c <__rodata_start+0xfc>
+  802bd7:	72 00                	jb     802bd9 <__rodata_start+0x99>
+  802bd9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bda:	75 74                	jne    802c50 <__rodata_start+0x110>
+  802bdc:	20 6f 66             	and    %ch,0x66(%rdi)
+  802bdf:	20 6d 65             	and    %ch,0x65(%rbp)
+  802be2:	6d                   	insl   (%dx),%es:(%rdi)
+  802be3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802be4:	72 79                	jb     802c5f <__rodata_start+0x11f>
+  802be6:	00 6f 75             	add    %ch,0x75(%rdi)
+  802be9:	74 20                	je     802c0b <__rodata_start+0xcb>
+  802beb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bec:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802bf0:	76 69                	jbe    802c5b <__rodata_start+0x11b>
+  802bf2:	72 6f                	jb     802c63 <__rodata_start+0x123>
+  802bf4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bf5:	6d                   	insl   (%dx),%es:(%rdi)
+  802bf6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802bf8:	74 73                	je     802c6d <__rodata_start+0x12d>
+  802bfa:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802bfd:	72 72                	jb     802c71 <__rodata_start+0x131>
+  802bff:	75 70                	jne    802c71 <__rodata_start+0x131>
+  802c01:	74 65                	je     802c68 <__rodata_start+0x128>
+  802c03:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802c08:	75 67                	jne    802c71 <__rodata_start+0x131>
+  802c0a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802c0d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802c0f:	00 73 65             	add    %dh,0x65(%rbx)
+  802c12:	67 6d                	insl   (%dx),%es:(%edi)
+  802c14:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802c16:	74 61                	je     802c79 <__rodata_start+0x139>
+  802c18:	74 69                	je     802c83 <__rodata_start+0x143>
+  802c1a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c1b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c1c:	20 66 61             	and    %ah,0x61(%rsi)
+  802c1f:	75 6c                	jne    802c8d <__rodata_start+0x14d>
+  802c21:	74 00                	je     802c23 <__rodata_start+0xe3>
+  802c23:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802c2a:	20 45 4c             	and    %al,0x4c(%rbp)
+  802c2d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802c31:	61                   	(bad)
+  802c32:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802c37:	20 73 75             	and    %dh,0x75(%rbx)
+  802c3a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802c3d:	73 79                	jae    802cb8 <__rodata_start+0x178>
+  802c3f:	73 74                	jae    802cb5 <__rodata_start+0x175>
+  802c41:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802c43:	20 63 61             	and    %ah,0x61(%rbx)
+  802c46:	6c                   	insb   (%dx),%es:(%rdi)
+  802c47:	6c                   	insb   (%dx),%es:(%rdi)
+  802c48:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802c4b:	74 72                	je     802cbf <__rodata_start+0x17f>
+  802c4d:	79 20                	jns    802c6f <__rodata_start+0x12f>
+  802c4f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c50:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c51:	74 20                	je     802c73 <__rodata_start+0x133>
+  802c53:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802c55:	75 6e                	jne    802cc5 <__rodata_start+0x185>
+  802c57:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802c5b:	76 20                	jbe    802c7d <__rodata_start+0x13d>
+  802c5d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802c64:	72 65                	jb     802ccb <__rodata_start+0x18b>
+  802c66:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802c69:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c6a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802c6e:	65 78 70             	gs js  802ce1 <__rodata_start+0x1a1>
+  802c71:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802c76:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802c79:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802c7d:	20 66 69             	and    %ah,0x69(%rsi)
+  802c80:	6c                   	insb   (%dx),%es:(%rdi)
+  802c81:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802c85:	20 66 72             	and    %ah,0x72(%rsi)
+  802c88:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802c8d:	61                   	(bad)
+  802c8e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802c91:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c92:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c93:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802c97:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802c9a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c9b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c9c:	20 6d 61             	and    %ch,0x61(%rbp)
+  802c9f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ca0:	79 20                	jns    802cc2 <__rodata_start+0x182>
+  802ca2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802ca9:	72 65                	jb     802d10 <__rodata_start+0x1d0>
+  802cab:	20 6f 70             	and    %ch,0x70(%rdi)
+  802cae:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802cb0:	00 66 69             	add    %ah,0x69(%rsi)
+  802cb3:	6c                   	insb   (%dx),%es:(%rdi)
+  802cb4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802cb8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802cbb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cbc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802cbf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cc0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cc1:	74 20                	je     802ce3 <__rodata_start+0x1a3>
+  802cc3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802cc5:	75 6e                	jne    802d35 <__rodata_start+0x1f5>
+  802cc7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802ccb:	76 61                	jbe    802d2e <__rodata_start+0x1ee>
+  802ccd:	6c                   	insb   (%dx),%es:(%rdi)
+  802cce:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802cd5:	00 
+  802cd6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802cdd:	72 65                	jb     802d44 <__rodata_start+0x204>
+  802cdf:	61                   	(bad)
+  802ce0:	64 79 20             	fs jns 802d03 <__rodata_start+0x1c3>
+  802ce3:	65 78 69             	gs js  802d4f <__rodata_start+0x20f>
+  802ce6:	73 74                	jae    802d5c <__rodata_start+0x21c>
+  802ce8:	73 00                	jae    802cea <__rodata_start+0x1aa>
+  802cea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ceb:	70 65                	jo     802d52 <__rodata_start+0x212>
+  802ced:	72 61                	jb     802d50 <__rodata_start+0x210>
+  802cef:	74 69                	je     802d5a <__rodata_start+0x21a>
+  802cf1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cf2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cf3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802cf6:	74 20                	je     802d18 <__rodata_start+0x1d8>
+  802cf8:	73 75                	jae    802d6f <__rodata_start+0x22f>
+  802cfa:	70 70                	jo     802d6c <__rodata_start+0x22c>
+  802cfc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cfd:	72 74                	jb     802d73 <__rodata_start+0x233>
+  802cff:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802d04:	65 72 61             	gs jb  802d68 <__rodata_start+0x228>
+  802d07:	74 69                	je     802d72 <__rodata_start+0x232>
+  802d09:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d0a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d0b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802d0e:	74 20                	je     802d30 <__rodata_start+0x1f0>
+  802d10:	70 65                	jo     802d77 <__rodata_start+0x237>
+  802d12:	72 6d                	jb     802d81 <__rodata_start+0x241>
+  802d14:	69 74 74 65 64 00 66 	imul   $0xf660064,0x65(%rsp,%rsi,2),%esi
+  802d1b:	0f 
+  802d1c:	1f                   	(bad)
+  802d1d:	44 00 00             	add    %r8b,(%rax)
+  802d20:	b6 03                	mov    $0x3,%dh
+  802d22:	80 00 00             	addb   $0x0,(%rax)
+  802d25:	00 00                	add    %al,(%rax)
+  802d27:	00 f7                	add    %dh,%bh
+  802d29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d2f:	00 e7                	add    %ah,%bh
+  802d31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d37:	00 f7                	add    %dh,%bh
+  802d39:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d3f:	00 f7                	add    %dh,%bh
+  802d41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d47:	00 f7                	add    %dh,%bh
+  802d49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d4f:	00 f7                	add    %dh,%bh
+  802d51:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d57:	00 d5                	add    %dl,%ch
+  802d59:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d5f:	00 f7                	add    %dh,%bh
+  802d61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d67:	00 f7                	add    %dh,%bh
+  802d69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d6f:	00 c9                	add    %cl,%cl
+  802d71:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d77:	00 43 04             	add    %al,0x4(%rbx)
+  802d7a:	80 00 00             	addb   $0x0,(%rax)
+  802d7d:	00 00                	add    %al,(%rax)
+  802d7f:	00 f7                	add    %dh,%bh
+  802d81:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d87:	00 c9                	add    %cl,%cl
+  802d89:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d8f:	00 0f                	add    %cl,(%rdi)
+  802d91:	04 80                	add    $0x80,%al
+  802d93:	00 00                	add    %al,(%rax)
+  802d95:	00 00                	add    %al,(%rax)
+  802d97:	00 0f                	add    %cl,(%rdi)
+  802d99:	04 80                	add    $0x80,%al
+  802d9b:	00 00                	add    %al,(%rax)
+  802d9d:	00 00                	add    %al,(%rax)
+  802d9f:	00 0f                	add    %cl,(%rdi)
+  802da1:	04 80                	add    $0x80,%al
+  802da3:	00 00                	add    %al,(%rax)
+  802da5:	00 00                	add    %al,(%rax)
+  802da7:	00 0f                	add    %cl,(%rdi)
+  802da9:	04 80                	add    $0x80,%al
+  802dab:	00 00                	add    %al,(%rax)
+  802dad:	00 00                	add    %al,(%rax)
+  802daf:	00 0f                	add    %cl,(%rdi)
+  802db1:	04 80                	add    $0x80,%al
+  802db3:	00 00                	add    %al,(%rax)
+  802db5:	00 00                	add    %al,(%rax)
+  802db7:	00 0f                	add    %cl,(%rdi)
+  802db9:	04 80                	add    $0x80,%al
+  802dbb:	00 00                	add    %al,(%rax)
+  802dbd:	00 00                	add    %al,(%rax)
+  802dbf:	00 0f                	add    %cl,(%rdi)
+  802dc1:	04 80                	add    $0x80,%al
+  802dc3:	00 00                	add    %al,(%rax)
+  802dc5:	00 00                	add    %al,(%rax)
+  802dc7:	00 0f                	add    %cl,(%rdi)
+  802dc9:	04 80                	add    $0x80,%al
+  802dcb:	00 00                	add    %al,(%rax)
+  802dcd:	00 00                	add    %al,(%rax)
+  802dcf:	00 0f                	add    %cl,(%rdi)
+  802dd1:	04 80                	add    $0x80,%al
+  802dd3:	00 00                	add    %al,(%rax)
+  802dd5:	00 00                	add    %al,(%rax)
+  802dd7:	00 f7                	add    %dh,%bh
+  802dd9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ddf:	00 f7                	add    %dh,%bh
+  802de1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802de7:	00 f7                	add    %dh,%bh
+  802de9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802def:	00 f7                	add    %dh,%bh
+  802df1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802df7:	00 f7                	add    %dh,%bh
+  802df9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802dff:	00 f7                	add    %dh,%bh
+  802e01:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e07:	00 f7                	add    %dh,%bh
+  802e09:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e0f:	00 f7                	add    %dh,%bh
+  802e11:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e17:	00 f7                	add    %dh,%bh
+  802e19:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e1f:	00 f7                	add    %dh,%bh
+  802e21:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e27:	00 f7                	add    %dh,%bh
+  802e29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e2f:	00 f7                	add    %dh,%bh
+  802e31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e37:	00 f7                	add    %dh,%bh
+  802e39:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e3f:	00 f7                	add    %dh,%bh
+  802e41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e47:	00 f7                	add    %dh,%bh
+  802e49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e4f:	00 f7                	add    %dh,%bh
+  802e51:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e57:	00 f7                	add    %dh,%bh
+  802e59:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e5f:	00 f7                	add    %dh,%bh
+  802e61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e67:	00 f7                	add    %dh,%bh
+  802e69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e6f:	00 f7                	add    %dh,%bh
+  802e71:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e77:	00 f7                	add    %dh,%bh
+  802e79:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e7f:	00 f7                	add    %dh,%bh
+  802e81:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e87:	00 f7                	add    %dh,%bh
+  802e89:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e8f:	00 f7                	add    %dh,%bh
+  802e91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e97:	00 f7                	add    %dh,%bh
+  802e99:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e9f:	00 f7                	add    %dh,%bh
+  802ea1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ea7:	00 f7                	add    %dh,%bh
+  802ea9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eaf:	00 f7                	add    %dh,%bh
+  802eb1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eb7:	00 f7                	add    %dh,%bh
+  802eb9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ebf:	00 f7                	add    %dh,%bh
+  802ec1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ec7:	00 1a                	add    %bl,(%rdx)
+  802ec9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ecf:	00 f7                	add    %dh,%bh
+  802ed1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ed7:	00 f7                	add    %dh,%bh
+  802ed9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802edf:	00 f7                	add    %dh,%bh
+  802ee1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ee7:	00 f7                	add    %dh,%bh
+  802ee9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eef:	00 f7                	add    %dh,%bh
+  802ef1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ef7:	00 f7                	add    %dh,%bh
+  802ef9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eff:	00 f7                	add    %dh,%bh
+  802f01:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f07:	00 f7                	add    %dh,%bh
+  802f09:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f0f:	00 f7                	add    %dh,%bh
+  802f11:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f17:	00 f7                	add    %dh,%bh
+  802f19:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f1f:	00 66 04             	add    %ah,0x4(%rsi)
+  802f22:	80 00 00             	addb   $0x0,(%rax)
+  802f25:	00 00                	add    %al,(%rax)
+  802f27:	00 35 06 80 00 00    	add    %dh,0x8006(%rip)        # 80af33 <__bss_end+0x2f33>
+  802f2d:	00 00                	add    %al,(%rax)
+  802f2f:	00 f7                	add    %dh,%bh
+  802f31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f37:	00 f7                	add    %dh,%bh
+  802f39:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f3f:	00 f7                	add    %dh,%bh
+  802f41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f47:	00 f7                	add    %dh,%bh
+  802f49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f4f:	00 95 04 80 00 00    	add    %dl,0x8004(%rbp)
+  802f55:	00 00                	add    %al,(%rax)
+  802f57:	00 f7                	add    %dh,%bh
+  802f59:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f5f:	00 f7                	add    %dh,%bh
+  802f61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f67:	00 5b 04             	add    %bl,0x4(%rbx)
+  802f6a:	80 00 00             	addb   $0x0,(%rax)
+  802f6d:	00 00                	add    %al,(%rax)
+  802f6f:	00 f7                	add    %dh,%bh
+  802f71:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f77:	00 f7                	add    %dh,%bh
+  802f79:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f7f:	00 dd                	add    %bl,%ch
+  802f81:	07                   	(bad)
+  802f82:	80 00 00             	addb   $0x0,(%rax)
+  802f85:	00 00                	add    %al,(%rax)
+  802f87:	00 a7 08 80 00 00    	add    %ah,0x8008(%rdi)
+  802f8d:	00 00                	add    %al,(%rax)
+  802f8f:	00 f7                	add    %dh,%bh
+  802f91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f97:	00 f7                	add    %dh,%bh
+  802f99:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f9f:	00 2c 05 80 00 00 00 	add    %ch,0x80(,%rax,1)
+  802fa6:	00 00                	add    %al,(%rax)
+  802fa8:	f7 09 80 00 00 00    	testl  $0x80,(%rcx)
+  802fae:	00 00                	add    %al,(%rax)
+  802fb0:	09 07                	or     %eax,(%rdi)
+  802fb2:	80 00 00             	addb   $0x0,(%rax)
+  802fb5:	00 00                	add    %al,(%rax)
+  802fb7:	00 f7                	add    %dh,%bh
+  802fb9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fbf:	00 f7                	add    %dh,%bh
+  802fc1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fc7:	00 1a                	add    %bl,(%rdx)
+  802fc9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fcf:	00 f7                	add    %dh,%bh
+  802fd1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fd7:	00 bf 03 80 00 00    	add    %bh,0x8003(%rdi)
+  802fdd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000802fe0 <error_string>:
+	...
+  802fe8:	a5 2b 80 00 00 00 00 00 b7 2b 80 00 00 00 00 00     .+.......+......
+  802ff8:	c7 2b 80 00 00 00 00 00 d9 2b 80 00 00 00 00 00     .+.......+......
+  803008:	e7 2b 80 00 00 00 00 00 fb 2b 80 00 00 00 00 00     .+.......+......
+  803018:	10 2c 80 00 00 00 00 00 23 2c 80 00 00 00 00 00     .,......#,......
+  803028:	35 2c 80 00 00 00 00 00 49 2c 80 00 00 00 00 00     5,......I,......
+  803038:	59 2c 80 00 00 00 00 00 6c 2c 80 00 00 00 00 00     Y,......l,......
+  803048:	83 2c 80 00 00 00 00 00 99 2c 80 00 00 00 00 00     .,.......,......
+  803058:	b1 2c 80 00 00 00 00 00 c9 2c 80 00 00 00 00 00     .,.......,......
+  803068:	d6 2c 80 00 00 00 00 00 90 30 80 00 00 00 00 00     .,.......0......
+  803078:	ea 2c 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .,..............
+  803088:	02 2d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .-......file is 
+  803098:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8030a8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8030b8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8030c8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8030d8:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  8030e8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8030f8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803108:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803118:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803128:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803138:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803148:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803158:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803160 <devtab>:
+  803160:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803170:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803180:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803190:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8031a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8031b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8031c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8031d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8031e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8031f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803200:	3a 20 00 69 70 63 5f 73 65 6e 64 3a 20 66 61 69     : .ipc_send: fai
+  803210:	6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62 2f     led to send.lib/
+  803220:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803230:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803240:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803250:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803260:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803270:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803280:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803290:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8032e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803300:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803310:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803320:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803330:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803340:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803350:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803360:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803370:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803380:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803390:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803400:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803410:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803420:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803430:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803440:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803450:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803460:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803470:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803480:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803490:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803500:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803510:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803520:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803530:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803540:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803550:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803560:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803570:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803580:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803590:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803600:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803610:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803620:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803630:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803640:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803650:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803660:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803670:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803680:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803690:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803700:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803710:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803720:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803730:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803740:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803750:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803760:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803770:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803780:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803790:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803800:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803810:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
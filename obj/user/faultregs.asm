@@ -0,0 +1,7124 @@
+
+obj/user/faultregs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ba 0c 00 00       	call   800cdd <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <check_regs>:
+
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs *a, const char *an, struct regs *b, const char *bn,
+           const char *testname) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+  800036:	49 89 fc             	mov    %rdi,%r12
+  800039:	48 89 d3             	mov    %rdx,%rbx
+  80003c:	4d 89 c6             	mov    %r8,%r14
+    int mismatch = 0;
+
+    cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  80003f:	48 89 f2             	mov    %rsi,%rdx
+  800042:	48 be 53 3d 80 00 00 	movabs $0x803d53,%rsi
+  800049:	00 00 00 
+  80004c:	48 bf 20 3d 80 00 00 	movabs $0x803d20,%rdi
+  800053:	00 00 00 
+  800056:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005b:	49 bd f7 0e 80 00 00 	movabs $0x800ef7,%r13
+  800062:	00 00 00 
+  800065:	41 ff d5             	call   *%r13
+            cprintf("MISMATCH\n");                                                             \
+            mismatch = 1;                                                                      \
+        }                                                                                      \
+    } while (0)
+
+    CHECK(r14, regs.reg_r14);
+  800068:	48 8b 4b 08          	mov    0x8(%rbx),%rcx
+  80006c:	49 8b 54 24 08       	mov    0x8(%r12),%rdx
+  800071:	48 be 30 3d 80 00 00 	movabs $0x803d30,%rsi
+  800078:	00 00 00 
+  80007b:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  800082:	00 00 00 
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	41 ff d5             	call   *%r13
+  80008d:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  800091:	49 39 44 24 08       	cmp    %rax,0x8(%r12)
+  800096:	0f 84 48 06 00 00    	je     8006e4 <check_regs+0x6bf>
+  80009c:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  8000a3:	00 00 00 
+  8000a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ab:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  8000b2:	00 00 00 
+  8000b5:	ff d2                	call   *%rdx
+  8000b7:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r13, regs.reg_r13);
+  8000bd:	48 8b 4b 10          	mov    0x10(%rbx),%rcx
+  8000c1:	49 8b 54 24 10       	mov    0x10(%r12),%rdx
+  8000c6:	48 be 54 3d 80 00 00 	movabs $0x803d54,%rsi
+  8000cd:	00 00 00 
+  8000d0:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  8000d7:	00 00 00 
+  8000da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000df:	49 b8 f7 0e 80 00 00 	movabs $0x800ef7,%r8
+  8000e6:	00 00 00 
+  8000e9:	41 ff d0             	call   *%r8
+  8000ec:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8000f0:	49 39 44 24 10       	cmp    %rax,0x10(%r12)
+  8000f5:	0f 84 06 06 00 00    	je     800701 <check_regs+0x6dc>
+  8000fb:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  800102:	00 00 00 
+  800105:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010a:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800111:	00 00 00 
+  800114:	ff d2                	call   *%rdx
+  800116:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r12, regs.reg_r12);
+  80011c:	48 8b 4b 18          	mov    0x18(%rbx),%rcx
+  800120:	49 8b 54 24 18       	mov    0x18(%r12),%rdx
+  800125:	48 be 58 3d 80 00 00 	movabs $0x803d58,%rsi
+  80012c:	00 00 00 
+  80012f:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	49 b8 f7 0e 80 00 00 	movabs $0x800ef7,%r8
+  800145:	00 00 00 
+  800148:	41 ff d0             	call   *%r8
+  80014b:	48 8b 43 18          	mov    0x18(%rbx),%rax
+  80014f:	49 39 44 24 18       	cmp    %rax,0x18(%r12)
+  800154:	0f 84 c7 05 00 00    	je     800721 <check_regs+0x6fc>
+  80015a:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  800161:	00 00 00 
+  800164:	b8 00 00 00 00       	mov    $0x0,%eax
+  800169:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800170:	00 00 00 
+  800173:	ff d2                	call   *%rdx
+  800175:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r11, regs.reg_r11);
+  80017b:	48 8b 4b 20          	mov    0x20(%rbx),%rcx
+  80017f:	49 8b 54 24 20       	mov    0x20(%r12),%rdx
+  800184:	48 be 5c 3d 80 00 00 	movabs $0x803d5c,%rsi
+  80018b:	00 00 00 
+  80018e:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  800195:	00 00 00 
+  800198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019d:	49 b8 f7 0e 80 00 00 	movabs $0x800ef7,%r8
+  8001a4:	00 00 00 
+  8001a7:	41 ff d0             	call   *%r8
+  8001aa:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8001ae:	49 39 44 24 20       	cmp    %rax,0x20(%r12)
+  8001b3:	0f 84 88 05 00 00    	je     800741 <check_regs+0x71c>
+  8001b9:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  8001c0:	00 00 00 
+  8001c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c8:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  8001cf:	00 00 00 
+  8001d2:	ff d2                	call   *%rdx
+  8001d4:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r10, regs.reg_r10);
+  8001da:	48 8b 4b 28          	mov    0x28(%rbx),%rcx
+  8001de:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  8001e3:	48 be 60 3d 80 00 00 	movabs $0x803d60,%rsi
+  8001ea:	00 00 00 
+  8001ed:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  8001f4:	00 00 00 
+  8001f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fc:	49 b8 f7 0e 80 00 00 	movabs $0x800ef7,%r8
+  800203:	00 00 00 
+  800206:	41 ff d0             	call   *%r8
+  800209:	48 8b 43 28          	mov    0x28(%rbx),%rax
+  80020d:	49 39 44 24 28       	cmp    %rax,0x28(%r12)
+  800212:	0f 84 49 05 00 00    	je     800761 <check_regs+0x73c>
+  800218:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  80021f:	00 00 00 
+  800222:	b8 00 00 00 00       	mov    $0x0,%eax
+  800227:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  80022e:	00 00 00 
+  800231:	ff d2                	call   *%rdx
+  800233:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rsi, regs.reg_rsi);
+  800239:	48 8b 4b 40          	mov    0x40(%rbx),%rcx
+  80023d:	49 8b 54 24 40       	mov    0x40(%r12),%rdx
+  800242:	48 be 64 3d 80 00 00 	movabs $0x803d64,%rsi
+  800249:	00 00 00 
+  80024c:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  800253:	00 00 00 
+  800256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025b:	49 b8 f7 0e 80 00 00 	movabs $0x800ef7,%r8
+  800262:	00 00 00 
+  800265:	41 ff d0             	call   *%r8
+  800268:	48 8b 43 40          	mov    0x40(%rbx),%rax
+  80026c:	49 39 44 24 40       	cmp    %rax,0x40(%r12)
+  800271:	0f 84 0a 05 00 00    	je     800781 <check_regs+0x75c>
+  800277:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  80027e:	00 00 00 
+  800281:	b8 00 00 00 00       	mov    $0x0,%eax
+  800286:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  80028d:	00 00 00 
+  800290:	ff d2                	call   *%rdx
+  800292:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdi, regs.reg_rdi);
+  800298:	48 8b 4b 48          	mov    0x48(%rbx),%rcx
+  80029c:	49 8b 54 24 48       	mov    0x48(%r12),%rdx
+  8002a1:	48 be 68 3d 80 00 00 	movabs $0x803d68,%rsi
+  8002a8:	00 00 00 
+  8002ab:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  8002b2:	00 00 00 
+  8002b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ba:	49 b8 f7 0e 80 00 00 	movabs $0x800ef7,%r8
+  8002c1:	00 00 00 
+  8002c4:	41 ff d0             	call   *%r8
+  8002c7:	48 8b 43 48          	mov    0x48(%rbx),%rax
+  8002cb:	49 39 44 24 48       	cmp    %rax,0x48(%r12)
+  8002d0:	0f 84 cb 04 00 00    	je     8007a1 <check_regs+0x77c>
+  8002d6:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  8002dd:	00 00 00 
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  8002ec:	00 00 00 
+  8002ef:	ff d2                	call   *%rdx
+  8002f1:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdi, regs.reg_rdi);
+  8002f7:	48 8b 4b 48          	mov    0x48(%rbx),%rcx
+  8002fb:	49 8b 54 24 48       	mov    0x48(%r12),%rdx
+  800300:	48 be 68 3d 80 00 00 	movabs $0x803d68,%rsi
+  800307:	00 00 00 
+  80030a:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  800311:	00 00 00 
+  800314:	b8 00 00 00 00       	mov    $0x0,%eax
+  800319:	49 b8 f7 0e 80 00 00 	movabs $0x800ef7,%r8
+  800320:	00 00 00 
+  800323:	41 ff d0             	call   *%r8
+  800326:	48 8b 43 48          	mov    0x48(%rbx),%rax
+  80032a:	49 39 44 24 48       	cmp    %rax,0x48(%r12)
+  80032f:	0f 84 8c 04 00 00    	je     8007c1 <check_regs+0x79c>
+  800335:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  80033c:	00 00 00 
+  80033f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800344:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  80034b:	00 00 00 
+  80034e:	ff d2                	call   *%rdx
+  800350:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rsi, regs.reg_rsi);
+  800356:	48 8b 4b 40          	mov    0x40(%rbx),%rcx
+  80035a:	49 8b 54 24 40       	mov    0x40(%r12),%rdx
+  80035f:	48 be 64 3d 80 00 00 	movabs $0x803d64,%rsi
+  800366:	00 00 00 
+  800369:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  800370:	00 00 00 
+  800373:	b8 00 00 00 00       	mov    $0x0,%eax
+  800378:	49 b8 f7 0e 80 00 00 	movabs $0x800ef7,%r8
+  80037f:	00 00 00 
+  800382:	41 ff d0             	call   *%r8
+  800385:	48 8b 43 40          	mov    0x40(%rbx),%rax
+  800389:	49 39 44 24 40       	cmp    %rax,0x40(%r12)
+  80038e:	0f 84 4d 04 00 00    	je     8007e1 <check_regs+0x7bc>
+  800394:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  80039b:	00 00 00 
+  80039e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a3:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  8003aa:	00 00 00 
+  8003ad:	ff d2                	call   *%rdx
+  8003af:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rbp, regs.reg_rbp);
+  8003b5:	48 8b 4b 50          	mov    0x50(%rbx),%rcx
+  8003b9:	49 8b 54 24 50       	mov    0x50(%r12),%rdx
+  8003be:	48 be 6c 3d 80 00 00 	movabs $0x803d6c,%rsi
+  8003c5:	00 00 00 
+  8003c8:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  8003cf:	00 00 00 
+  8003d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d7:	49 b8 f7 0e 80 00 00 	movabs $0x800ef7,%r8
+  8003de:	00 00 00 
+  8003e1:	41 ff d0             	call   *%r8
+  8003e4:	48 8b 43 50          	mov    0x50(%rbx),%rax
+  8003e8:	49 39 44 24 50       	cmp    %rax,0x50(%r12)
+  8003ed:	0f 84 0e 04 00 00    	je     800801 <check_regs+0x7dc>
+  8003f3:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  8003fa:	00 00 00 
+  8003fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800402:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800409:	00 00 00 
+  80040c:	ff d2                	call   *%rdx
+  80040e:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rbx, regs.reg_rbx);
+  800414:	48 8b 4b 68          	mov    0x68(%rbx),%rcx
+  800418:	49 8b 54 24 68       	mov    0x68(%r12),%rdx
+  80041d:	48 be 70 3d 80 00 00 	movabs $0x803d70,%rsi
+  800424:	00 00 00 
+  800427:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  80042e:	00 00 00 
+  800431:	b8 00 00 00 00       	mov    $0x0,%eax
+  800436:	49 b8 f7 0e 80 00 00 	movabs $0x800ef7,%r8
+  80043d:	00 00 00 
+  800440:	41 ff d0             	call   *%r8
+  800443:	48 8b 43 68          	mov    0x68(%rbx),%rax
+  800447:	49 39 44 24 68       	cmp    %rax,0x68(%r12)
+  80044c:	0f 84 cf 03 00 00    	je     800821 <check_regs+0x7fc>
+  800452:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  800459:	00 00 00 
+  80045c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800461:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800468:	00 00 00 
+  80046b:	ff d2                	call   *%rdx
+  80046d:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdx, regs.reg_rdx);
+  800473:	48 8b 4b 58          	mov    0x58(%rbx),%rcx
+  800477:	49 8b 54 24 58       	mov    0x58(%r12),%rdx
+  80047c:	48 be 74 3d 80 00 00 	movabs $0x803d74,%rsi
+  800483:	00 00 00 
+  800486:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  80048d:	00 00 00 
+  800490:	b8 00 00 00 00       	mov    $0x0,%eax
+  800495:	49 b8 f7 0e 80 00 00 	movabs $0x800ef7,%r8
+  80049c:	00 00 00 
+  80049f:	41 ff d0             	call   *%r8
+  8004a2:	48 8b 43 58          	mov    0x58(%rbx),%rax
+  8004a6:	49 39 44 24 58       	cmp    %rax,0x58(%r12)
+  8004ab:	0f 84 90 03 00 00    	je     800841 <check_regs+0x81c>
+  8004b1:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  8004b8:	00 00 00 
+  8004bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c0:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  8004c7:	00 00 00 
+  8004ca:	ff d2                	call   *%rdx
+  8004cc:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rcx, regs.reg_rcx);
+  8004d2:	48 8b 4b 60          	mov    0x60(%rbx),%rcx
+  8004d6:	49 8b 54 24 60       	mov    0x60(%r12),%rdx
+  8004db:	48 be 78 3d 80 00 00 	movabs $0x803d78,%rsi
+  8004e2:	00 00 00 
+  8004e5:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  8004ec:	00 00 00 
+  8004ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f4:	49 b8 f7 0e 80 00 00 	movabs $0x800ef7,%r8
+  8004fb:	00 00 00 
+  8004fe:	41 ff d0             	call   *%r8
+  800501:	48 8b 43 60          	mov    0x60(%rbx),%rax
+  800505:	49 39 44 24 60       	cmp    %rax,0x60(%r12)
+  80050a:	0f 84 51 03 00 00    	je     800861 <check_regs+0x83c>
+  800510:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  800517:	00 00 00 
+  80051a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051f:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800526:	00 00 00 
+  800529:	ff d2                	call   *%rdx
+  80052b:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rax, regs.reg_rax);
+  800531:	48 8b 4b 70          	mov    0x70(%rbx),%rcx
+  800535:	49 8b 54 24 70       	mov    0x70(%r12),%rdx
+  80053a:	48 be 7c 3d 80 00 00 	movabs $0x803d7c,%rsi
+  800541:	00 00 00 
+  800544:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  80054b:	00 00 00 
+  80054e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800553:	49 b8 f7 0e 80 00 00 	movabs $0x800ef7,%r8
+  80055a:	00 00 00 
+  80055d:	41 ff d0             	call   *%r8
+  800560:	48 8b 43 70          	mov    0x70(%rbx),%rax
+  800564:	49 39 44 24 70       	cmp    %rax,0x70(%r12)
+  800569:	0f 84 12 03 00 00    	je     800881 <check_regs+0x85c>
+  80056f:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  800576:	00 00 00 
+  800579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057e:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800585:	00 00 00 
+  800588:	ff d2                	call   *%rdx
+  80058a:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rip, rip);
+  800590:	48 8b 4b 78          	mov    0x78(%rbx),%rcx
+  800594:	49 8b 54 24 78       	mov    0x78(%r12),%rdx
+  800599:	48 be 80 3d 80 00 00 	movabs $0x803d80,%rsi
+  8005a0:	00 00 00 
+  8005a3:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  8005aa:	00 00 00 
+  8005ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b2:	49 b8 f7 0e 80 00 00 	movabs $0x800ef7,%r8
+  8005b9:	00 00 00 
+  8005bc:	41 ff d0             	call   *%r8
+  8005bf:	48 8b 43 78          	mov    0x78(%rbx),%rax
+  8005c3:	49 39 44 24 78       	cmp    %rax,0x78(%r12)
+  8005c8:	0f 84 d3 02 00 00    	je     8008a1 <check_regs+0x87c>
+  8005ce:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  8005d5:	00 00 00 
+  8005d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005dd:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  8005e4:	00 00 00 
+  8005e7:	ff d2                	call   *%rdx
+  8005e9:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rflags, rflags);
+  8005ef:	48 8b 8b 80 00 00 00 	mov    0x80(%rbx),%rcx
+  8005f6:	49 8b 94 24 80 00 00 	mov    0x80(%r12),%rdx
+  8005fd:	00 
+  8005fe:	48 be 84 3d 80 00 00 	movabs $0x803d84,%rsi
+  800605:	00 00 00 
+  800608:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  80060f:	00 00 00 
+  800612:	b8 00 00 00 00       	mov    $0x0,%eax
+  800617:	49 b8 f7 0e 80 00 00 	movabs $0x800ef7,%r8
+  80061e:	00 00 00 
+  800621:	41 ff d0             	call   *%r8
+  800624:	48 8b 83 80 00 00 00 	mov    0x80(%rbx),%rax
+  80062b:	49 39 84 24 80 00 00 	cmp    %rax,0x80(%r12)
+  800632:	00 
+  800633:	0f 84 88 02 00 00    	je     8008c1 <check_regs+0x89c>
+  800639:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  800640:	00 00 00 
+  800643:	b8 00 00 00 00       	mov    $0x0,%eax
+  800648:	49 bd f7 0e 80 00 00 	movabs $0x800ef7,%r13
+  80064f:	00 00 00 
+  800652:	41 ff d5             	call   *%r13
+    CHECK(rsp, rsp);
+  800655:	48 8b 8b 88 00 00 00 	mov    0x88(%rbx),%rcx
+  80065c:	49 8b 94 24 88 00 00 	mov    0x88(%r12),%rdx
+  800663:	00 
+  800664:	48 be 8b 3d 80 00 00 	movabs $0x803d8b,%rsi
+  80066b:	00 00 00 
+  80066e:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  800675:	00 00 00 
+  800678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067d:	41 ff d5             	call   *%r13
+  800680:	48 8b 83 88 00 00 00 	mov    0x88(%rbx),%rax
+  800687:	49 39 84 24 88 00 00 	cmp    %rax,0x88(%r12)
+  80068e:	00 
+  80068f:	0f 84 ea 02 00 00    	je     80097f <check_regs+0x95a>
+  800695:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  80069c:	00 00 00 
+  80069f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a4:	48 bb f7 0e 80 00 00 	movabs $0x800ef7,%rbx
+  8006ab:	00 00 00 
+  8006ae:	ff d3                	call   *%rbx
+
+#undef CHECK
+
+    cprintf("Registers %s ", testname);
+  8006b0:	4c 89 f6             	mov    %r14,%rsi
+  8006b3:	48 bf 8f 3d 80 00 00 	movabs $0x803d8f,%rdi
+  8006ba:	00 00 00 
+  8006bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c2:	ff d3                	call   *%rbx
+    if (!mismatch)
+        cprintf("OK\n");
+    else
+        cprintf("MISMATCH\n");
+  8006c4:	48 bf 4a 3d 80 00 00 	movabs $0x803d4a,%rdi
+  8006cb:	00 00 00 
+  8006ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d3:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  8006da:	00 00 00 
+  8006dd:	ff d2                	call   *%rdx
+}
+  8006df:	e9 8c 02 00 00       	jmp    800970 <check_regs+0x94b>
+    CHECK(r14, regs.reg_r14);
+  8006e4:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  8006eb:	00 00 00 
+  8006ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f3:	41 ff d5             	call   *%r13
+    int mismatch = 0;
+  8006f6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8006fc:	e9 bc f9 ff ff       	jmp    8000bd <check_regs+0x98>
+    CHECK(r13, regs.reg_r13);
+  800701:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  800708:	00 00 00 
+  80070b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800710:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800717:	00 00 00 
+  80071a:	ff d2                	call   *%rdx
+  80071c:	e9 fb f9 ff ff       	jmp    80011c <check_regs+0xf7>
+    CHECK(r12, regs.reg_r12);
+  800721:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  800728:	00 00 00 
+  80072b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800730:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800737:	00 00 00 
+  80073a:	ff d2                	call   *%rdx
+  80073c:	e9 3a fa ff ff       	jmp    80017b <check_regs+0x156>
+    CHECK(r11, regs.reg_r11);
+  800741:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  800748:	00 00 00 
+  80074b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800750:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800757:	00 00 00 
+  80075a:	ff d2                	call   *%rdx
+  80075c:	e9 79 fa ff ff       	jmp    8001da <check_regs+0x1b5>
+    CHECK(r10, regs.reg_r10);
+  800761:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  800768:	00 00 00 
+  80076b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800770:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800777:	00 00 00 
+  80077a:	ff d2                	call   *%rdx
+  80077c:	e9 b8 fa ff ff       	jmp    800239 <check_regs+0x214>
+    CHECK(rsi, regs.reg_rsi);
+  800781:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  800788:	00 00 00 
+  80078b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800790:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800797:	00 00 00 
+  80079a:	ff d2                	call   *%rdx
+  80079c:	e9 f7 fa ff ff       	jmp    800298 <check_regs+0x273>
+    CHECK(rdi, regs.reg_rdi);
+  8007a1:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  8007a8:	00 00 00 
+  8007ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b0:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  8007b7:	00 00 00 
+  8007ba:	ff d2                	call   *%rdx
+  8007bc:	e9 36 fb ff ff       	jmp    8002f7 <check_regs+0x2d2>
+    CHECK(rdi, regs.reg_rdi);
+  8007c1:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  8007c8:	00 00 00 
+  8007cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d0:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  8007d7:	00 00 00 
+  8007da:	ff d2                	call   *%rdx
+  8007dc:	e9 75 fb ff ff       	jmp    800356 <check_regs+0x331>
+    CHECK(rsi, regs.reg_rsi);
+  8007e1:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  8007e8:	00 00 00 
+  8007eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f0:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  8007f7:	00 00 00 
+  8007fa:	ff d2                	call   *%rdx
+  8007fc:	e9 b4 fb ff ff       	jmp    8003b5 <check_regs+0x390>
+    CHECK(rbp, regs.reg_rbp);
+  800801:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  800808:	00 00 00 
+  80080b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800810:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800817:	00 00 00 
+  80081a:	ff d2                	call   *%rdx
+  80081c:	e9 f3 fb ff ff       	jmp    800414 <check_regs+0x3ef>
+    CHECK(rbx, regs.reg_rbx);
+  800821:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  800828:	00 00 00 
+  80082b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800830:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800837:	00 00 00 
+  80083a:	ff d2                	call   *%rdx
+  80083c:	e9 32 fc ff ff       	jmp    800473 <check_regs+0x44e>
+    CHECK(rdx, regs.reg_rdx);
+  800841:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  800848:	00 00 00 
+  80084b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800850:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800857:	00 00 00 
+  80085a:	ff d2                	call   *%rdx
+  80085c:	e9 71 fc ff ff       	jmp    8004d2 <check_regs+0x4ad>
+    CHECK(rcx, regs.reg_rcx);
+  800861:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  800868:	00 00 00 
+  80086b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800870:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800877:	00 00 00 
+  80087a:	ff d2                	call   *%rdx
+  80087c:	e9 b0 fc ff ff       	jmp    800531 <check_regs+0x50c>
+    CHECK(rax, regs.reg_rax);
+  800881:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  800888:	00 00 00 
+  80088b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800890:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800897:	00 00 00 
+  80089a:	ff d2                	call   *%rdx
+  80089c:	e9 ef fc ff ff       	jmp    800590 <check_regs+0x56b>
+    CHECK(rip, rip);
+  8008a1:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  8008a8:	00 00 00 
+  8008ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b0:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  8008b7:	00 00 00 
+  8008ba:	ff d2                	call   *%rdx
+  8008bc:	e9 2e fd ff ff       	jmp    8005ef <check_regs+0x5ca>
+    CHECK(rflags, rflags);
+  8008c1:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  8008c8:	00 00 00 
+  8008cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d0:	49 bf f7 0e 80 00 00 	movabs $0x800ef7,%r15
+  8008d7:	00 00 00 
+  8008da:	41 ff d7             	call   *%r15
+    CHECK(rsp, rsp);
+  8008dd:	48 8b 8b 88 00 00 00 	mov    0x88(%rbx),%rcx
+  8008e4:	49 8b 94 24 88 00 00 	mov    0x88(%r12),%rdx
+  8008eb:	00 
+  8008ec:	48 be 8b 3d 80 00 00 	movabs $0x803d8b,%rsi
+  8008f3:	00 00 00 
+  8008f6:	48 bf 34 3d 80 00 00 	movabs $0x803d34,%rdi
+  8008fd:	00 00 00 
+  800900:	b8 00 00 00 00       	mov    $0x0,%eax
+  800905:	41 ff d7             	call   *%r15
+  800908:	48 8b 83 88 00 00 00 	mov    0x88(%rbx),%rax
+  80090f:	49 39 84 24 88 00 00 	cmp    %rax,0x88(%r12)
+  800916:	00 
+  800917:	0f 85 78 fd ff ff    	jne    800695 <check_regs+0x670>
+  80091d:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  800924:	00 00 00 
+  800927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092c:	48 bb f7 0e 80 00 00 	movabs $0x800ef7,%rbx
+  800933:	00 00 00 
+  800936:	ff d3                	call   *%rbx
+    cprintf("Registers %s ", testname);
+  800938:	4c 89 f6             	mov    %r14,%rsi
+  80093b:	48 bf 8f 3d 80 00 00 	movabs $0x803d8f,%rdi
+  800942:	00 00 00 
+  800945:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094a:	ff d3                	call   *%rbx
+    if (!mismatch)
+  80094c:	45 85 ed             	test   %r13d,%r13d
+  80094f:	0f 85 6f fd ff ff    	jne    8006c4 <check_regs+0x69f>
+        cprintf("OK\n");
+  800955:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  80095c:	00 00 00 
+  80095f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800964:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  80096b:	00 00 00 
+  80096e:	ff d2                	call   *%rdx
+}
+  800970:	48 83 c4 08          	add    $0x8,%rsp
+  800974:	5b                   	pop    %rbx
+  800975:	41 5c                	pop    %r12
+  800977:	41 5d                	pop    %r13
+  800979:	41 5e                	pop    %r14
+  80097b:	41 5f                	pop    %r15
+  80097d:	5d                   	pop    %rbp
+  80097e:	c3                   	ret
+    CHECK(rsp, rsp);
+  80097f:	48 bf 46 3d 80 00 00 	movabs $0x803d46,%rdi
+  800986:	00 00 00 
+  800989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098e:	48 bb f7 0e 80 00 00 	movabs $0x800ef7,%rbx
+  800995:	00 00 00 
+  800998:	ff d3                	call   *%rbx
+    cprintf("Registers %s ", testname);
+  80099a:	4c 89 f6             	mov    %r14,%rsi
+  80099d:	48 bf 8f 3d 80 00 00 	movabs $0x803d8f,%rdi
+  8009a4:	00 00 00 
+  8009a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ac:	ff d3                	call   *%rbx
+    if (!mismatch)
+  8009ae:	e9 11 fd ff ff       	jmp    8006c4 <check_regs+0x69f>
+
+00000000008009b3 <pgfault>:
+
+static bool
+pgfault(struct UTrapframe *utf) {
+  8009b3:	55                   	push   %rbp
+  8009b4:	48 89 e5             	mov    %rsp,%rbp
+    int r;
+
+    if (utf->utf_fault_va != (uint64_t)UTEMP)
+  8009b7:	48 8b 0f             	mov    (%rdi),%rcx
+  8009ba:	48 81 f9 00 00 40 00 	cmp    $0x400000,%rcx
+  8009c1:	0f 85 13 01 00 00    	jne    800ada <pgfault+0x127>
+        panic("pgfault expected at UTEMP, got 0x%08lx (rip %08lx)",
+              (unsigned long)utf->utf_fault_va, (unsigned long)utf->utf_rip);
+
+    /* Check registers in UTrapframe */
+    during.regs = utf->utf_regs;
+  8009c7:	48 be a0 60 80 00 00 	movabs $0x8060a0,%rsi
+  8009ce:	00 00 00 
+  8009d1:	48 8b 57 10          	mov    0x10(%rdi),%rdx
+  8009d5:	48 89 16             	mov    %rdx,(%rsi)
+  8009d8:	48 8b 57 18          	mov    0x18(%rdi),%rdx
+  8009dc:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  8009e0:	48 8b 57 20          	mov    0x20(%rdi),%rdx
+  8009e4:	48 89 56 10          	mov    %rdx,0x10(%rsi)
+  8009e8:	48 8b 57 28          	mov    0x28(%rdi),%rdx
+  8009ec:	48 89 56 18          	mov    %rdx,0x18(%rsi)
+  8009f0:	48 8b 57 30          	mov    0x30(%rdi),%rdx
+  8009f4:	48 89 56 20          	mov    %rdx,0x20(%rsi)
+  8009f8:	48 8b 57 38          	mov    0x38(%rdi),%rdx
+  8009fc:	48 89 56 28          	mov    %rdx,0x28(%rsi)
+  800a00:	48 8b 57 40          	mov    0x40(%rdi),%rdx
+  800a04:	48 89 56 30          	mov    %rdx,0x30(%rsi)
+  800a08:	48 8b 57 48          	mov    0x48(%rdi),%rdx
+  800a0c:	48 89 56 38          	mov    %rdx,0x38(%rsi)
+  800a10:	48 8b 57 50          	mov    0x50(%rdi),%rdx
+  800a14:	48 89 56 40          	mov    %rdx,0x40(%rsi)
+  800a18:	48 8b 57 58          	mov    0x58(%rdi),%rdx
+  800a1c:	48 89 56 48          	mov    %rdx,0x48(%rsi)
+  800a20:	48 8b 57 60          	mov    0x60(%rdi),%rdx
+  800a24:	48 89 56 50          	mov    %rdx,0x50(%rsi)
+  800a28:	48 8b 57 68          	mov    0x68(%rdi),%rdx
+  800a2c:	48 89 56 58          	mov    %rdx,0x58(%rsi)
+  800a30:	48 8b 57 70          	mov    0x70(%rdi),%rdx
+  800a34:	48 89 56 60          	mov    %rdx,0x60(%rsi)
+  800a38:	48 8b 57 78          	mov    0x78(%rdi),%rdx
+  800a3c:	48 89 56 68          	mov    %rdx,0x68(%rsi)
+  800a40:	48 8b 97 80 00 00 00 	mov    0x80(%rdi),%rdx
+  800a47:	48 89 56 70          	mov    %rdx,0x70(%rsi)
+    during.rip = utf->utf_rip;
+  800a4b:	48 8b 97 88 00 00 00 	mov    0x88(%rdi),%rdx
+  800a52:	48 89 56 78          	mov    %rdx,0x78(%rsi)
+    during.rflags = utf->utf_rflags & 0xfff;
+  800a56:	48 8b 97 90 00 00 00 	mov    0x90(%rdi),%rdx
+  800a5d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  800a63:	48 89 96 80 00 00 00 	mov    %rdx,0x80(%rsi)
+    during.rsp = utf->utf_rsp;
+  800a6a:	48 8b 87 98 00 00 00 	mov    0x98(%rdi),%rax
+  800a71:	48 89 86 88 00 00 00 	mov    %rax,0x88(%rsi)
+    check_regs(&before, "before", &during, "during", "in UTrapframe");
+  800a78:	49 b8 ae 3d 80 00 00 	movabs $0x803dae,%r8
+  800a7f:	00 00 00 
+  800a82:	48 b9 bc 3d 80 00 00 	movabs $0x803dbc,%rcx
+  800a89:	00 00 00 
+  800a8c:	48 89 f2             	mov    %rsi,%rdx
+  800a8f:	48 be c3 3d 80 00 00 	movabs $0x803dc3,%rsi
+  800a96:	00 00 00 
+  800a99:	48 bf 40 61 80 00 00 	movabs $0x806140,%rdi
+  800aa0:	00 00 00 
+  800aa3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800aaa:	00 00 00 
+  800aad:	ff d0                	call   *%rax
+    ;
+
+    /* Map UTEMP so the write succeeds */
+    if ((r = sys_alloc_region(0, UTEMP, PAGE_SIZE, PROT_RW)) < 0)
+  800aaf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800ab4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ab9:	be 00 00 40 00       	mov    $0x400000,%esi
+  800abe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ac3:	48 b8 cc 1d 80 00 00 	movabs $0x801dcc,%rax
+  800aca:	00 00 00 
+  800acd:	ff d0                	call   *%rax
+  800acf:	85 c0                	test   %eax,%eax
+  800ad1:	78 39                	js     800b0c <pgfault+0x159>
+        panic("sys_page_alloc: %i", r);
+    return 1;
+}
+  800ad3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ad8:	5d                   	pop    %rbp
+  800ad9:	c3                   	ret
+        panic("pgfault expected at UTEMP, got 0x%08lx (rip %08lx)",
+  800ada:	4c 8b 87 88 00 00 00 	mov    0x88(%rdi),%r8
+  800ae1:	48 ba f8 3d 80 00 00 	movabs $0x803df8,%rdx
+  800ae8:	00 00 00 
+  800aeb:	be 62 00 00 00       	mov    $0x62,%esi
+  800af0:	48 bf 9d 3d 80 00 00 	movabs $0x803d9d,%rdi
+  800af7:	00 00 00 
+  800afa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aff:	49 b9 a7 0d 80 00 00 	movabs $0x800da7,%r9
+  800b06:	00 00 00 
+  800b09:	41 ff d1             	call   *%r9
+        panic("sys_page_alloc: %i", r);
+  800b0c:	89 c1                	mov    %eax,%ecx
+  800b0e:	48 ba ca 3d 80 00 00 	movabs $0x803dca,%rdx
+  800b15:	00 00 00 
+  800b18:	be 6f 00 00 00       	mov    $0x6f,%esi
+  800b1d:	48 bf 9d 3d 80 00 00 	movabs $0x803d9d,%rdi
+  800b24:	00 00 00 
+  800b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2c:	49 b8 a7 0d 80 00 00 	movabs $0x800da7,%r8
+  800b33:	00 00 00 
+  800b36:	41 ff d0             	call   *%r8
+
+0000000000800b39 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800b39:	55                   	push   %rbp
+  800b3a:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(pgfault);
+  800b3d:	48 bf b3 09 80 00 00 	movabs $0x8009b3,%rdi
+  800b44:	00 00 00 
+  800b47:	48 b8 f8 23 80 00 00 	movabs $0x8023f8,%rax
+  800b4e:	00 00 00 
+  800b51:	ff d0                	call   *%rax
+
+    __asm __volatile(
+  800b53:	48 b8 40 61 80 00 00 	movabs $0x806140,%rax
+  800b5a:	00 00 00 
+  800b5d:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800b64:	00 00 00 
+  800b67:	50                   	push   %rax
+  800b68:	52                   	push   %rdx
+  800b69:	50                   	push   %rax
+  800b6a:	9c                   	pushf
+  800b6b:	58                   	pop    %rax
+  800b6c:	48 0d d4 08 00 00    	or     $0x8d4,%rax
+  800b72:	50                   	push   %rax
+  800b73:	9d                   	popf
+  800b74:	4c 8b 7c 24 10       	mov    0x10(%rsp),%r15
+  800b79:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  800b80:	48 8d 04 25 cc 0b 80 	lea    0x800bcc,%rax
+  800b87:	00 
+  800b88:	49 89 47 78          	mov    %rax,0x78(%r15)
+  800b8c:	58                   	pop    %rax
+  800b8d:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  800b91:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  800b95:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  800b99:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  800b9d:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  800ba1:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  800ba5:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  800ba9:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  800bad:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  800bb1:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  800bb5:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  800bb9:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  800bbd:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  800bc1:	49 89 47 70          	mov    %rax,0x70(%r15)
+  800bc5:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  800bcc:	c7 04 25 00 00 40 00 	movl   $0x2a,0x400000
+  800bd3:	2a 00 00 00 
+  800bd7:	4c 8b 3c 24          	mov    (%rsp),%r15
+  800bdb:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  800bdf:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  800be3:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  800be7:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  800beb:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  800bef:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  800bf3:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  800bf7:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  800bfb:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  800bff:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  800c03:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  800c07:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  800c0b:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  800c0f:	49 89 47 70          	mov    %rax,0x70(%r15)
+  800c13:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  800c1a:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  800c1f:	4d 8b 77 08          	mov    0x8(%r15),%r14
+  800c23:	4d 8b 6f 10          	mov    0x10(%r15),%r13
+  800c27:	4d 8b 67 18          	mov    0x18(%r15),%r12
+  800c2b:	4d 8b 5f 20          	mov    0x20(%r15),%r11
+  800c2f:	4d 8b 57 28          	mov    0x28(%r15),%r10
+  800c33:	4d 8b 4f 30          	mov    0x30(%r15),%r9
+  800c37:	4d 8b 47 38          	mov    0x38(%r15),%r8
+  800c3b:	49 8b 77 40          	mov    0x40(%r15),%rsi
+  800c3f:	49 8b 7f 48          	mov    0x48(%r15),%rdi
+  800c43:	49 8b 6f 50          	mov    0x50(%r15),%rbp
+  800c47:	49 8b 57 58          	mov    0x58(%r15),%rdx
+  800c4b:	49 8b 4f 60          	mov    0x60(%r15),%rcx
+  800c4f:	49 8b 5f 68          	mov    0x68(%r15),%rbx
+  800c53:	49 8b 47 70          	mov    0x70(%r15),%rax
+  800c57:	49 8b a7 88 00 00 00 	mov    0x88(%r15),%rsp
+  800c5e:	50                   	push   %rax
+  800c5f:	9c                   	pushf
+  800c60:	58                   	pop    %rax
+  800c61:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  800c66:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  800c6d:	58                   	pop    %rax
+            : "memory", "cc");
+
+    /* Check UTEMP to roughly determine that EIP was restored
+     * correctly (of course, we probably wouldn't get this far if
+     * it weren't) */
+    if (*(int *)UTEMP != 42)
+  800c6e:	83 3c 25 00 00 40 00 	cmpl   $0x2a,0x400000
+  800c75:	2a 
+  800c76:	75 48                	jne    800cc0 <umain+0x187>
+        cprintf("RIP after page-fault MISMATCH\n");
+    after.rip = before.rip;
+  800c78:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800c7f:	00 00 00 
+  800c82:	48 bf 40 61 80 00 00 	movabs $0x806140,%rdi
+  800c89:	00 00 00 
+  800c8c:	48 8b 47 78          	mov    0x78(%rdi),%rax
+  800c90:	48 89 42 78          	mov    %rax,0x78(%rdx)
+
+    check_regs(&before, "before", &after, "after", "after page-fault");
+  800c94:	49 b8 dd 3d 80 00 00 	movabs $0x803ddd,%r8
+  800c9b:	00 00 00 
+  800c9e:	48 b9 ee 3d 80 00 00 	movabs $0x803dee,%rcx
+  800ca5:	00 00 00 
+  800ca8:	48 be c3 3d 80 00 00 	movabs $0x803dc3,%rsi
+  800caf:	00 00 00 
+  800cb2:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800cb9:	00 00 00 
+  800cbc:	ff d0                	call   *%rax
+}
+  800cbe:	5d                   	pop    %rbp
+  800cbf:	c3                   	ret
+        cprintf("RIP after page-fault MISMATCH\n");
+  800cc0:	48 bf 30 3e 80 00 00 	movabs $0x803e30,%rdi
+  800cc7:	00 00 00 
+  800cca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccf:	48 ba f7 0e 80 00 00 	movabs $0x800ef7,%rdx
+  800cd6:	00 00 00 
+  800cd9:	ff d2                	call   *%rdx
+  800cdb:	eb 9b                	jmp    800c78 <umain+0x13f>
+
+0000000000800cdd <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800cdd:	55                   	push   %rbp
+  800cde:	48 89 e5             	mov    %rsp,%rbp
+  800ce1:	41 56                	push   %r14
+  800ce3:	41 55                	push   %r13
+  800ce5:	41 54                	push   %r12
+  800ce7:	53                   	push   %rbx
+  800ce8:	41 89 fd             	mov    %edi,%r13d
+  800ceb:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800cee:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  800cf5:	00 00 00 
+  800cf8:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  800cff:	00 00 00 
+  800d02:	48 39 c2             	cmp    %rax,%rdx
+  800d05:	73 17                	jae    800d1e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800d07:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800d0a:	49 89 c4             	mov    %rax,%r12
+  800d0d:	48 83 c3 08          	add    $0x8,%rbx
+  800d11:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d16:	ff 53 f8             	call   *-0x8(%rbx)
+  800d19:	4c 39 e3             	cmp    %r12,%rbx
+  800d1c:	72 ef                	jb     800d0d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800d1e:	48 b8 0c 1d 80 00 00 	movabs $0x801d0c,%rax
+  800d25:	00 00 00 
+  800d28:	ff d0                	call   *%rax
+  800d2a:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800d2d:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800d34:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800d3b:	00 00 00 
+  800d3e:	48 01 d0             	add    %rdx,%rax
+  800d41:	48 a3 d0 61 80 00 00 	movabs %rax,0x8061d0
+  800d48:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800d4b:	45 85 ed             	test   %r13d,%r13d
+  800d4e:	7e 0d                	jle    800d5d <libmain+0x80>
+  800d50:	49 8b 06             	mov    (%r14),%rax
+  800d53:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800d5a:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800d5d:	4c 89 f6             	mov    %r14,%rsi
+  800d60:	44 89 ef             	mov    %r13d,%edi
+  800d63:	48 b8 39 0b 80 00 00 	movabs $0x800b39,%rax
+  800d6a:	00 00 00 
+  800d6d:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800d6f:	48 b8 84 0d 80 00 00 	movabs $0x800d84,%rax
+  800d76:	00 00 00 
+  800d79:	ff d0                	call   *%rax
+#endif
+}
+  800d7b:	5b                   	pop    %rbx
+  800d7c:	41 5c                	pop    %r12
+  800d7e:	41 5d                	pop    %r13
+  800d80:	41 5e                	pop    %r14
+  800d82:	5d                   	pop    %rbp
+  800d83:	c3                   	ret
+
+0000000000800d84 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800d84:	55                   	push   %rbp
+  800d85:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800d88:	48 b8 11 29 80 00 00 	movabs $0x802911,%rax
+  800d8f:	00 00 00 
+  800d92:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800d94:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d99:	48 b8 a1 1c 80 00 00 	movabs $0x801ca1,%rax
+  800da0:	00 00 00 
+  800da3:	ff d0                	call   *%rax
+}
+  800da5:	5d                   	pop    %rbp
+  800da6:	c3                   	ret
+
+0000000000800da7 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800da7:	55                   	push   %rbp
+  800da8:	48 89 e5             	mov    %rsp,%rbp
+  800dab:	41 56                	push   %r14
+  800dad:	41 55                	push   %r13
+  800daf:	41 54                	push   %r12
+  800db1:	53                   	push   %rbx
+  800db2:	48 83 ec 50          	sub    $0x50,%rsp
+  800db6:	49 89 fc             	mov    %rdi,%r12
+  800db9:	41 89 f5             	mov    %esi,%r13d
+  800dbc:	48 89 d3             	mov    %rdx,%rbx
+  800dbf:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800dc3:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800dc7:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dcb:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800dd2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dd6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800dda:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800dde:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800de2:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800de9:	00 00 00 
+  800dec:	4c 8b 30             	mov    (%rax),%r14
+  800def:	48 b8 0c 1d 80 00 00 	movabs $0x801d0c,%rax
+  800df6:	00 00 00 
+  800df9:	ff d0                	call   *%rax
+  800dfb:	89 c6                	mov    %eax,%esi
+  800dfd:	45 89 e8             	mov    %r13d,%r8d
+  800e00:	4c 89 e1             	mov    %r12,%rcx
+  800e03:	4c 89 f2             	mov    %r14,%rdx
+  800e06:	48 bf 60 3e 80 00 00 	movabs $0x803e60,%rdi
+  800e0d:	00 00 00 
+  800e10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e15:	49 bc f7 0e 80 00 00 	movabs $0x800ef7,%r12
+  800e1c:	00 00 00 
+  800e1f:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800e22:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800e26:	48 89 df             	mov    %rbx,%rdi
+  800e29:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  800e30:	00 00 00 
+  800e33:	ff d0                	call   *%rax
+    cprintf("\n");
+  800e35:	48 bf 52 3d 80 00 00 	movabs $0x803d52,%rdi
+  800e3c:	00 00 00 
+  800e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e44:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800e47:	cc                   	int3
+  800e48:	eb fd                	jmp    800e47 <_panic+0xa0>
+
+0000000000800e4a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800e4a:	55                   	push   %rbp
+  800e4b:	48 89 e5             	mov    %rsp,%rbp
+  800e4e:	53                   	push   %rbx
+  800e4f:	48 83 ec 08          	sub    $0x8,%rsp
+  800e53:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800e56:	8b 06                	mov    (%rsi),%eax
+  800e58:	8d 50 01             	lea    0x1(%rax),%edx
+  800e5b:	89 16                	mov    %edx,(%rsi)
+  800e5d:	48 98                	cltq
+  800e5f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800e64:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800e6a:	74 0a                	je     800e76 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800e6c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800e70:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e74:	c9                   	leave
+  800e75:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800e76:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800e7a:	be ff 00 00 00       	mov    $0xff,%esi
+  800e7f:	48 b8 43 1c 80 00 00 	movabs $0x801c43,%rax
+  800e86:	00 00 00 
+  800e89:	ff d0                	call   *%rax
+        state->offset = 0;
+  800e8b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800e91:	eb d9                	jmp    800e6c <putch+0x22>
+
+0000000000800e93 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800e93:	55                   	push   %rbp
+  800e94:	48 89 e5             	mov    %rsp,%rbp
+  800e97:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800e9e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800ea1:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800ea8:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800ead:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800eb5:	48 89 f1             	mov    %rsi,%rcx
+  800eb8:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800ebf:	48 bf 4a 0e 80 00 00 	movabs $0x800e4a,%rdi
+  800ec6:	00 00 00 
+  800ec9:	48 b8 47 10 80 00 00 	movabs $0x801047,%rax
+  800ed0:	00 00 00 
+  800ed3:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800ed5:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800edc:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800ee3:	48 b8 43 1c 80 00 00 	movabs $0x801c43,%rax
+  800eea:	00 00 00 
+  800eed:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800eef:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800ef5:	c9                   	leave
+  800ef6:	c3                   	ret
+
+0000000000800ef7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800ef7:	55                   	push   %rbp
+  800ef8:	48 89 e5             	mov    %rsp,%rbp
+  800efb:	48 83 ec 50          	sub    $0x50,%rsp
+  800eff:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800f03:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800f07:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f0b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f0f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800f13:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800f1a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f22:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f26:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800f2a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800f2e:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  800f35:	00 00 00 
+  800f38:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800f3a:	c9                   	leave
+  800f3b:	c3                   	ret
+
+0000000000800f3c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800f3c:	55                   	push   %rbp
+  800f3d:	48 89 e5             	mov    %rsp,%rbp
+  800f40:	41 57                	push   %r15
+  800f42:	41 56                	push   %r14
+  800f44:	41 55                	push   %r13
+  800f46:	41 54                	push   %r12
+  800f48:	53                   	push   %rbx
+  800f49:	48 83 ec 18          	sub    $0x18,%rsp
+  800f4d:	49 89 fc             	mov    %rdi,%r12
+  800f50:	49 89 f5             	mov    %rsi,%r13
+  800f53:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800f57:	8b 45 10             	mov    0x10(%rbp),%eax
+  800f5a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800f5d:	41 89 cf             	mov    %ecx,%r15d
+  800f60:	4c 39 fa             	cmp    %r15,%rdx
+  800f63:	73 5b                	jae    800fc0 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800f65:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800f69:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800f6d:	85 db                	test   %ebx,%ebx
+  800f6f:	7e 0e                	jle    800f7f <print_num+0x43>
+            putch(padc, put_arg);
+  800f71:	4c 89 ee             	mov    %r13,%rsi
+  800f74:	44 89 f7             	mov    %r14d,%edi
+  800f77:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800f7a:	83 eb 01             	sub    $0x1,%ebx
+  800f7d:	75 f2                	jne    800f71 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800f7f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800f83:	48 b9 94 3e 80 00 00 	movabs $0x803e94,%rcx
+  800f8a:	00 00 00 
+  800f8d:	48 b8 83 3e 80 00 00 	movabs $0x803e83,%rax
+  800f94:	00 00 00 
+  800f97:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800f9b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa4:	49 f7 f7             	div    %r15
+  800fa7:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800fab:	4c 89 ee             	mov    %r13,%rsi
+  800fae:	41 ff d4             	call   *%r12
+}
+  800fb1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800fb5:	5b                   	pop    %rbx
+  800fb6:	41 5c                	pop    %r12
+  800fb8:	41 5d                	pop    %r13
+  800fba:	41 5e                	pop    %r14
+  800fbc:	41 5f                	pop    %r15
+  800fbe:	5d                   	pop    %rbp
+  800fbf:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800fc0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc9:	49 f7 f7             	div    %r15
+  800fcc:	48 83 ec 08          	sub    $0x8,%rsp
+  800fd0:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800fd4:	52                   	push   %rdx
+  800fd5:	45 0f be c9          	movsbl %r9b,%r9d
+  800fd9:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800fdd:	48 89 c2             	mov    %rax,%rdx
+  800fe0:	48 b8 3c 0f 80 00 00 	movabs $0x800f3c,%rax
+  800fe7:	00 00 00 
+  800fea:	ff d0                	call   *%rax
+  800fec:	48 83 c4 10          	add    $0x10,%rsp
+  800ff0:	eb 8d                	jmp    800f7f <print_num+0x43>
+
+0000000000800ff2 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800ff2:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800ff6:	48 8b 06             	mov    (%rsi),%rax
+  800ff9:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800ffd:	73 0a                	jae    801009 <sprintputch+0x17>
+        *state->start++ = ch;
+  800fff:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801003:	48 89 16             	mov    %rdx,(%rsi)
+  801006:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801009:	c3                   	ret
+
+000000000080100a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80100a:	55                   	push   %rbp
+  80100b:	48 89 e5             	mov    %rsp,%rbp
+  80100e:	48 83 ec 50          	sub    $0x50,%rsp
+  801012:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801016:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80101a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80101e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801025:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801029:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80102d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801031:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801035:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801039:	48 b8 47 10 80 00 00 	movabs $0x801047,%rax
+  801040:	00 00 00 
+  801043:	ff d0                	call   *%rax
+}
+  801045:	c9                   	leave
+  801046:	c3                   	ret
+
+0000000000801047 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801047:	55                   	push   %rbp
+  801048:	48 89 e5             	mov    %rsp,%rbp
+  80104b:	41 57                	push   %r15
+  80104d:	41 56                	push   %r14
+  80104f:	41 55                	push   %r13
+  801051:	41 54                	push   %r12
+  801053:	53                   	push   %rbx
+  801054:	48 83 ec 38          	sub    $0x38,%rsp
+  801058:	49 89 fe             	mov    %rdi,%r14
+  80105b:	49 89 f5             	mov    %rsi,%r13
+  80105e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801061:	48 8b 01             	mov    (%rcx),%rax
+  801064:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801068:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80106c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801070:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801074:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801078:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80107c:	0f b6 3b             	movzbl (%rbx),%edi
+  80107f:	40 80 ff 25          	cmp    $0x25,%dil
+  801083:	74 18                	je     80109d <vprintfmt+0x56>
+            if (!ch) return;
+  801085:	40 84 ff             	test   %dil,%dil
+  801088:	0f 84 b1 06 00 00    	je     80173f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80108e:	40 0f b6 ff          	movzbl %dil,%edi
+  801092:	4c 89 ee             	mov    %r13,%rsi
+  801095:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801098:	4c 89 e3             	mov    %r12,%rbx
+  80109b:	eb db                	jmp    801078 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80109d:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a2:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8010a6:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8010ab:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8010b1:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8010b8:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8010bc:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8010c1:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8010c6:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8010c9:	83 e8 23             	sub    $0x23,%eax
+  8010cc:	3c 57                	cmp    $0x57,%al
+  8010ce:	0f 87 51 06 00 00    	ja     801725 <vprintfmt+0x6de>
+  8010d4:	0f b6 c0             	movzbl %al,%eax
+  8010d7:	48 b9 40 40 80 00 00 	movabs $0x804040,%rcx
+  8010de:	00 00 00 
+  8010e1:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8010e4:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8010e7:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8010eb:	eb cf                	jmp    8010bc <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8010ed:	49 89 dc             	mov    %rbx,%r12
+  8010f0:	be 01 00 00 00       	mov    $0x1,%esi
+  8010f5:	eb c5                	jmp    8010bc <vprintfmt+0x75>
+            padc = ch;
+  8010f7:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8010fb:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8010fe:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801101:	eb b9                	jmp    8010bc <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801103:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801106:	83 f8 2f             	cmp    $0x2f,%eax
+  801109:	77 24                	ja     80112f <vprintfmt+0xe8>
+  80110b:	89 c1                	mov    %eax,%ecx
+  80110d:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801111:	83 c0 08             	add    $0x8,%eax
+  801114:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801117:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80111a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80111d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801121:	79 99                	jns    8010bc <vprintfmt+0x75>
+                width = precision;
+  801123:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801127:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80112d:	eb 8d                	jmp    8010bc <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80112f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801133:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801137:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80113b:	eb da                	jmp    801117 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80113d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801142:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801146:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80114c:	3c 39                	cmp    $0x39,%al
+  80114e:	77 1c                	ja     80116c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801150:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801154:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801158:	0f b6 c0             	movzbl %al,%eax
+  80115b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801160:	0f b6 03             	movzbl (%rbx),%eax
+  801163:	3c 39                	cmp    $0x39,%al
+  801165:	76 e9                	jbe    801150 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801167:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80116a:	eb b1                	jmp    80111d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80116c:	49 89 dc             	mov    %rbx,%r12
+  80116f:	eb ac                	jmp    80111d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801171:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801174:	85 c9                	test   %ecx,%ecx
+  801176:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117b:	0f 49 c1             	cmovns %ecx,%eax
+  80117e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801181:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801184:	e9 33 ff ff ff       	jmp    8010bc <vprintfmt+0x75>
+            lflag++;
+  801189:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80118c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80118f:	e9 28 ff ff ff       	jmp    8010bc <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801194:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801197:	83 f8 2f             	cmp    $0x2f,%eax
+  80119a:	77 19                	ja     8011b5 <vprintfmt+0x16e>
+  80119c:	89 c2                	mov    %eax,%edx
+  80119e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011a2:	83 c0 08             	add    $0x8,%eax
+  8011a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011a8:	8b 3a                	mov    (%rdx),%edi
+  8011aa:	4c 89 ee             	mov    %r13,%rsi
+  8011ad:	41 ff d6             	call   *%r14
+            break;
+  8011b0:	e9 c3 fe ff ff       	jmp    801078 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8011b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011c1:	eb e5                	jmp    8011a8 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8011c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8011c9:	77 5a                	ja     801225 <vprintfmt+0x1de>
+  8011cb:	89 c2                	mov    %eax,%edx
+  8011cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011d1:	83 c0 08             	add    $0x8,%eax
+  8011d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8011d7:	8b 02                	mov    (%rdx),%eax
+  8011d9:	89 c1                	mov    %eax,%ecx
+  8011db:	f7 d9                	neg    %ecx
+  8011dd:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8011e0:	83 f9 15             	cmp    $0x15,%ecx
+  8011e3:	7f 4e                	jg     801233 <vprintfmt+0x1ec>
+  8011e5:	48 63 c1             	movslq %ecx,%rax
+  8011e8:	48 ba 00 43 80 00 00 	movabs $0x804300,%rdx
+  8011ef:	00 00 00 
+  8011f2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8011f6:	48 85 c0             	test   %rax,%rax
+  8011f9:	74 38                	je     801233 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8011fb:	48 89 c1             	mov    %rax,%rcx
+  8011fe:	48 ba e9 44 80 00 00 	movabs $0x8044e9,%rdx
+  801205:	00 00 00 
+  801208:	4c 89 ee             	mov    %r13,%rsi
+  80120b:	4c 89 f7             	mov    %r14,%rdi
+  80120e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801213:	49 b8 0a 10 80 00 00 	movabs $0x80100a,%r8
+  80121a:	00 00 00 
+  80121d:	41 ff d0             	call   *%r8
+  801220:	e9 53 fe ff ff       	jmp    801078 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801225:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801229:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80122d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801231:	eb a4                	jmp    8011d7 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801233:	48 ba ac 3e 80 00 00 	movabs $0x803eac,%rdx
+  80123a:	00 00 00 
+  80123d:	4c 89 ee             	mov    %r13,%rsi
+  801240:	4c 89 f7             	mov    %r14,%rdi
+  801243:	b8 00 00 00 00       	mov    $0x0,%eax
+  801248:	49 b8 0a 10 80 00 00 	movabs $0x80100a,%r8
+  80124f:	00 00 00 
+  801252:	41 ff d0             	call   *%r8
+  801255:	e9 1e fe ff ff       	jmp    801078 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80125a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80125d:	83 f8 2f             	cmp    $0x2f,%eax
+  801260:	77 6c                	ja     8012ce <vprintfmt+0x287>
+  801262:	89 c2                	mov    %eax,%edx
+  801264:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801268:	83 c0 08             	add    $0x8,%eax
+  80126b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80126e:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801271:	48 85 d2             	test   %rdx,%rdx
+  801274:	48 b8 a5 3e 80 00 00 	movabs $0x803ea5,%rax
+  80127b:	00 00 00 
+  80127e:	48 0f 45 c2          	cmovne %rdx,%rax
+  801282:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801286:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80128a:	7e 06                	jle    801292 <vprintfmt+0x24b>
+  80128c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801290:	75 4a                	jne    8012dc <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801292:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801296:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80129a:	0f b6 00             	movzbl (%rax),%eax
+  80129d:	84 c0                	test   %al,%al
+  80129f:	0f 85 9a 00 00 00    	jne    80133f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8012a5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8012a8:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8012ac:	85 c0                	test   %eax,%eax
+  8012ae:	0f 8e c4 fd ff ff    	jle    801078 <vprintfmt+0x31>
+  8012b4:	4c 89 ee             	mov    %r13,%rsi
+  8012b7:	bf 20 00 00 00       	mov    $0x20,%edi
+  8012bc:	41 ff d6             	call   *%r14
+  8012bf:	41 83 ec 01          	sub    $0x1,%r12d
+  8012c3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8012c7:	75 eb                	jne    8012b4 <vprintfmt+0x26d>
+  8012c9:	e9 aa fd ff ff       	jmp    801078 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8012ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012da:	eb 92                	jmp    80126e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8012dc:	49 63 f7             	movslq %r15d,%rsi
+  8012df:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8012e3:	48 b8 f9 17 80 00 00 	movabs $0x8017f9,%rax
+  8012ea:	00 00 00 
+  8012ed:	ff d0                	call   *%rax
+  8012ef:	48 89 c2             	mov    %rax,%rdx
+  8012f2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8012f5:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8012f7:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8012fa:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8012fd:	85 c0                	test   %eax,%eax
+  8012ff:	7e 91                	jle    801292 <vprintfmt+0x24b>
+  801301:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801306:	4c 89 ee             	mov    %r13,%rsi
+  801309:	44 89 e7             	mov    %r12d,%edi
+  80130c:	41 ff d6             	call   *%r14
+  80130f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801313:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801316:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801319:	75 eb                	jne    801306 <vprintfmt+0x2bf>
+  80131b:	e9 72 ff ff ff       	jmp    801292 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801320:	0f b6 f8             	movzbl %al,%edi
+  801323:	4c 89 ee             	mov    %r13,%rsi
+  801326:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801329:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80132d:	49 83 c4 01          	add    $0x1,%r12
+  801331:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801337:	84 c0                	test   %al,%al
+  801339:	0f 84 66 ff ff ff    	je     8012a5 <vprintfmt+0x25e>
+  80133f:	45 85 ff             	test   %r15d,%r15d
+  801342:	78 0a                	js     80134e <vprintfmt+0x307>
+  801344:	41 83 ef 01          	sub    $0x1,%r15d
+  801348:	0f 88 57 ff ff ff    	js     8012a5 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80134e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801352:	74 cc                	je     801320 <vprintfmt+0x2d9>
+  801354:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801357:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80135c:	80 fa 5e             	cmp    $0x5e,%dl
+  80135f:	77 c2                	ja     801323 <vprintfmt+0x2dc>
+  801361:	eb bd                	jmp    801320 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  801363:	40 84 f6             	test   %sil,%sil
+  801366:	75 26                	jne    80138e <vprintfmt+0x347>
+    switch (lflag) {
+  801368:	85 d2                	test   %edx,%edx
+  80136a:	74 59                	je     8013c5 <vprintfmt+0x37e>
+  80136c:	83 fa 01             	cmp    $0x1,%edx
+  80136f:	74 7b                	je     8013ec <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  801371:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801374:	83 f8 2f             	cmp    $0x2f,%eax
+  801377:	0f 87 96 00 00 00    	ja     801413 <vprintfmt+0x3cc>
+  80137d:	89 c2                	mov    %eax,%edx
+  80137f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801383:	83 c0 08             	add    $0x8,%eax
+  801386:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801389:	4c 8b 22             	mov    (%rdx),%r12
+  80138c:	eb 17                	jmp    8013a5 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80138e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801391:	83 f8 2f             	cmp    $0x2f,%eax
+  801394:	77 21                	ja     8013b7 <vprintfmt+0x370>
+  801396:	89 c2                	mov    %eax,%edx
+  801398:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80139c:	83 c0 08             	add    $0x8,%eax
+  80139f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013a2:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8013a5:	4d 85 e4             	test   %r12,%r12
+  8013a8:	78 7a                	js     801424 <vprintfmt+0x3dd>
+            num = i;
+  8013aa:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8013ad:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8013b2:	e9 50 02 00 00       	jmp    801607 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8013b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013c3:	eb dd                	jmp    8013a2 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8013c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8013cb:	77 11                	ja     8013de <vprintfmt+0x397>
+  8013cd:	89 c2                	mov    %eax,%edx
+  8013cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013d3:	83 c0 08             	add    $0x8,%eax
+  8013d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013d9:	4c 63 22             	movslq (%rdx),%r12
+  8013dc:	eb c7                	jmp    8013a5 <vprintfmt+0x35e>
+  8013de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013ea:	eb ed                	jmp    8013d9 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8013ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8013f2:	77 11                	ja     801405 <vprintfmt+0x3be>
+  8013f4:	89 c2                	mov    %eax,%edx
+  8013f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013fa:	83 c0 08             	add    $0x8,%eax
+  8013fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801400:	4c 8b 22             	mov    (%rdx),%r12
+  801403:	eb a0                	jmp    8013a5 <vprintfmt+0x35e>
+  801405:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801409:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80140d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801411:	eb ed                	jmp    801400 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  801413:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801417:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80141b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80141f:	e9 65 ff ff ff       	jmp    801389 <vprintfmt+0x342>
+                putch('-', put_arg);
+  801424:	4c 89 ee             	mov    %r13,%rsi
+  801427:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80142c:	41 ff d6             	call   *%r14
+                i = -i;
+  80142f:	49 f7 dc             	neg    %r12
+  801432:	e9 73 ff ff ff       	jmp    8013aa <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  801437:	40 84 f6             	test   %sil,%sil
+  80143a:	75 32                	jne    80146e <vprintfmt+0x427>
+    switch (lflag) {
+  80143c:	85 d2                	test   %edx,%edx
+  80143e:	74 5d                	je     80149d <vprintfmt+0x456>
+  801440:	83 fa 01             	cmp    $0x1,%edx
+  801443:	0f 84 82 00 00 00    	je     8014cb <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  801449:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80144c:	83 f8 2f             	cmp    $0x2f,%eax
+  80144f:	0f 87 a5 00 00 00    	ja     8014fa <vprintfmt+0x4b3>
+  801455:	89 c2                	mov    %eax,%edx
+  801457:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80145b:	83 c0 08             	add    $0x8,%eax
+  80145e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801461:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801464:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801469:	e9 99 01 00 00       	jmp    801607 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80146e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801471:	83 f8 2f             	cmp    $0x2f,%eax
+  801474:	77 19                	ja     80148f <vprintfmt+0x448>
+  801476:	89 c2                	mov    %eax,%edx
+  801478:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80147c:	83 c0 08             	add    $0x8,%eax
+  80147f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801482:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801485:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80148a:	e9 78 01 00 00       	jmp    801607 <vprintfmt+0x5c0>
+  80148f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801493:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801497:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80149b:	eb e5                	jmp    801482 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80149d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8014a3:	77 18                	ja     8014bd <vprintfmt+0x476>
+  8014a5:	89 c2                	mov    %eax,%edx
+  8014a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014ab:	83 c0 08             	add    $0x8,%eax
+  8014ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014b1:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8014b3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8014b8:	e9 4a 01 00 00       	jmp    801607 <vprintfmt+0x5c0>
+  8014bd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014c1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c9:	eb e6                	jmp    8014b1 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8014cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8014d1:	77 19                	ja     8014ec <vprintfmt+0x4a5>
+  8014d3:	89 c2                	mov    %eax,%edx
+  8014d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014d9:	83 c0 08             	add    $0x8,%eax
+  8014dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014df:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8014e2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8014e7:	e9 1b 01 00 00       	jmp    801607 <vprintfmt+0x5c0>
+  8014ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014f8:	eb e5                	jmp    8014df <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8014fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801502:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801506:	e9 56 ff ff ff       	jmp    801461 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80150b:	40 84 f6             	test   %sil,%sil
+  80150e:	75 2e                	jne    80153e <vprintfmt+0x4f7>
+    switch (lflag) {
+  801510:	85 d2                	test   %edx,%edx
+  801512:	74 59                	je     80156d <vprintfmt+0x526>
+  801514:	83 fa 01             	cmp    $0x1,%edx
+  801517:	74 7f                	je     801598 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  801519:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80151c:	83 f8 2f             	cmp    $0x2f,%eax
+  80151f:	0f 87 9f 00 00 00    	ja     8015c4 <vprintfmt+0x57d>
+  801525:	89 c2                	mov    %eax,%edx
+  801527:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80152b:	83 c0 08             	add    $0x8,%eax
+  80152e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801531:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801534:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801539:	e9 c9 00 00 00       	jmp    801607 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80153e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801541:	83 f8 2f             	cmp    $0x2f,%eax
+  801544:	77 19                	ja     80155f <vprintfmt+0x518>
+  801546:	89 c2                	mov    %eax,%edx
+  801548:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80154c:	83 c0 08             	add    $0x8,%eax
+  80154f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801552:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801555:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80155a:	e9 a8 00 00 00       	jmp    801607 <vprintfmt+0x5c0>
+  80155f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801563:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801567:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80156b:	eb e5                	jmp    801552 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80156d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801570:	83 f8 2f             	cmp    $0x2f,%eax
+  801573:	77 15                	ja     80158a <vprintfmt+0x543>
+  801575:	89 c2                	mov    %eax,%edx
+  801577:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80157b:	83 c0 08             	add    $0x8,%eax
+  80157e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801581:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801583:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801588:	eb 7d                	jmp    801607 <vprintfmt+0x5c0>
+  80158a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80158e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801592:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801596:	eb e9                	jmp    801581 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  801598:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80159b:	83 f8 2f             	cmp    $0x2f,%eax
+  80159e:	77 16                	ja     8015b6 <vprintfmt+0x56f>
+  8015a0:	89 c2                	mov    %eax,%edx
+  8015a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015a6:	83 c0 08             	add    $0x8,%eax
+  8015a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015ac:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8015af:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8015b4:	eb 51                	jmp    801607 <vprintfmt+0x5c0>
+  8015b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015ba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015c2:	eb e8                	jmp    8015ac <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8015c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015d0:	e9 5c ff ff ff       	jmp    801531 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8015d5:	4c 89 ee             	mov    %r13,%rsi
+  8015d8:	bf 30 00 00 00       	mov    $0x30,%edi
+  8015dd:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8015e0:	4c 89 ee             	mov    %r13,%rsi
+  8015e3:	bf 78 00 00 00       	mov    $0x78,%edi
+  8015e8:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8015eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8015f1:	77 47                	ja     80163a <vprintfmt+0x5f3>
+  8015f3:	89 c2                	mov    %eax,%edx
+  8015f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015f9:	83 c0 08             	add    $0x8,%eax
+  8015fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015ff:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801602:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801607:	48 83 ec 08          	sub    $0x8,%rsp
+  80160b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80160f:	0f 94 c0             	sete   %al
+  801612:	0f b6 c0             	movzbl %al,%eax
+  801615:	50                   	push   %rax
+  801616:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80161b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80161f:	4c 89 ee             	mov    %r13,%rsi
+  801622:	4c 89 f7             	mov    %r14,%rdi
+  801625:	48 b8 3c 0f 80 00 00 	movabs $0x800f3c,%rax
+  80162c:	00 00 00 
+  80162f:	ff d0                	call   *%rax
+            break;
+  801631:	48 83 c4 10          	add    $0x10,%rsp
+  801635:	e9 3e fa ff ff       	jmp    801078 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80163a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80163e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801642:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801646:	eb b7                	jmp    8015ff <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  801648:	40 84 f6             	test   %sil,%sil
+  80164b:	75 2b                	jne    801678 <vprintfmt+0x631>
+    switch (lflag) {
+  80164d:	85 d2                	test   %edx,%edx
+  80164f:	74 56                	je     8016a7 <vprintfmt+0x660>
+  801651:	83 fa 01             	cmp    $0x1,%edx
+  801654:	74 7f                	je     8016d5 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  801656:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801659:	83 f8 2f             	cmp    $0x2f,%eax
+  80165c:	0f 87 a2 00 00 00    	ja     801704 <vprintfmt+0x6bd>
+  801662:	89 c2                	mov    %eax,%edx
+  801664:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801668:	83 c0 08             	add    $0x8,%eax
+  80166b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80166e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801671:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801676:	eb 8f                	jmp    801607 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801678:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80167b:	83 f8 2f             	cmp    $0x2f,%eax
+  80167e:	77 19                	ja     801699 <vprintfmt+0x652>
+  801680:	89 c2                	mov    %eax,%edx
+  801682:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801686:	83 c0 08             	add    $0x8,%eax
+  801689:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80168c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80168f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801694:	e9 6e ff ff ff       	jmp    801607 <vprintfmt+0x5c0>
+  801699:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80169d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016a5:	eb e5                	jmp    80168c <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8016a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8016ad:	77 18                	ja     8016c7 <vprintfmt+0x680>
+  8016af:	89 c2                	mov    %eax,%edx
+  8016b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016b5:	83 c0 08             	add    $0x8,%eax
+  8016b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016bb:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8016bd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8016c2:	e9 40 ff ff ff       	jmp    801607 <vprintfmt+0x5c0>
+  8016c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016d3:	eb e6                	jmp    8016bb <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8016d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8016db:	77 19                	ja     8016f6 <vprintfmt+0x6af>
+  8016dd:	89 c2                	mov    %eax,%edx
+  8016df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016e3:	83 c0 08             	add    $0x8,%eax
+  8016e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016e9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8016ec:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8016f1:	e9 11 ff ff ff       	jmp    801607 <vprintfmt+0x5c0>
+  8016f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801702:	eb e5                	jmp    8016e9 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801704:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801708:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80170c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801710:	e9 59 ff ff ff       	jmp    80166e <vprintfmt+0x627>
+            putch(ch, put_arg);
+  801715:	4c 89 ee             	mov    %r13,%rsi
+  801718:	bf 25 00 00 00       	mov    $0x25,%edi
+  80171d:	41 ff d6             	call   *%r14
+            break;
+  801720:	e9 53 f9 ff ff       	jmp    801078 <vprintfmt+0x31>
+            putch('%', put_arg);
+  801725:	4c 89 ee             	mov    %r13,%rsi
+  801728:	bf 25 00 00 00       	mov    $0x25,%edi
+  80172d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801730:	48 83 eb 01          	sub    $0x1,%rbx
+  801734:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801738:	75 f6                	jne    801730 <vprintfmt+0x6e9>
+  80173a:	e9 39 f9 ff ff       	jmp    801078 <vprintfmt+0x31>
+}
+  80173f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801743:	5b                   	pop    %rbx
+  801744:	41 5c                	pop    %r12
+  801746:	41 5d                	pop    %r13
+  801748:	41 5e                	pop    %r14
+  80174a:	41 5f                	pop    %r15
+  80174c:	5d                   	pop    %rbp
+  80174d:	c3                   	ret
+
+000000000080174e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80174e:	55                   	push   %rbp
+  80174f:	48 89 e5             	mov    %rsp,%rbp
+  801752:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801756:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80175a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80175f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801763:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80176a:	48 85 ff             	test   %rdi,%rdi
+  80176d:	74 2b                	je     80179a <vsnprintf+0x4c>
+  80176f:	48 85 f6             	test   %rsi,%rsi
+  801772:	74 26                	je     80179a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801774:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801778:	48 bf f2 0f 80 00 00 	movabs $0x800ff2,%rdi
+  80177f:	00 00 00 
+  801782:	48 b8 47 10 80 00 00 	movabs $0x801047,%rax
+  801789:	00 00 00 
+  80178c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80178e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801792:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801795:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801798:	c9                   	leave
+  801799:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80179a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80179f:	eb f7                	jmp    801798 <vsnprintf+0x4a>
+
+00000000008017a1 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8017a1:	55                   	push   %rbp
+  8017a2:	48 89 e5             	mov    %rsp,%rbp
+  8017a5:	48 83 ec 50          	sub    $0x50,%rsp
+  8017a9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017ad:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017b1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8017b5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017bc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017c4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017c8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8017cc:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017d0:	48 b8 4e 17 80 00 00 	movabs $0x80174e,%rax
+  8017d7:	00 00 00 
+  8017da:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8017dc:	c9                   	leave
+  8017dd:	c3                   	ret
+
+00000000008017de <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8017de:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8017e1:	74 10                	je     8017f3 <strlen+0x15>
+    size_t n = 0;
+  8017e3:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8017e8:	48 83 c0 01          	add    $0x1,%rax
+  8017ec:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8017f0:	75 f6                	jne    8017e8 <strlen+0xa>
+  8017f2:	c3                   	ret
+    size_t n = 0;
+  8017f3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8017f8:	c3                   	ret
+
+00000000008017f9 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8017f9:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8017fc:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801801:	48 85 f6             	test   %rsi,%rsi
+  801804:	74 11                	je     801817 <strnlen+0x1e>
+  801806:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80180a:	74 0c                	je     801818 <strnlen+0x1f>
+  80180c:	48 83 c2 01          	add    $0x1,%rdx
+  801810:	48 39 d0             	cmp    %rdx,%rax
+  801813:	75 f1                	jne    801806 <strnlen+0xd>
+  801815:	eb 04                	jmp    80181b <strnlen+0x22>
+  801817:	c3                   	ret
+  801818:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80181b:	c3                   	ret
+
+000000000080181c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80181c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80181f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801824:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801828:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80182b:	48 83 c2 01          	add    $0x1,%rdx
+  80182f:	84 c9                	test   %cl,%cl
+  801831:	75 f1                	jne    801824 <strcpy+0x8>
+        ;
+    return res;
+}
+  801833:	c3                   	ret
+
+0000000000801834 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801834:	55                   	push   %rbp
+  801835:	48 89 e5             	mov    %rsp,%rbp
+  801838:	41 54                	push   %r12
+  80183a:	53                   	push   %rbx
+  80183b:	48 89 fb             	mov    %rdi,%rbx
+  80183e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801841:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  801848:	00 00 00 
+  80184b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80184d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801851:	4c 89 e6             	mov    %r12,%rsi
+  801854:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  80185b:	00 00 00 
+  80185e:	ff d0                	call   *%rax
+    return dst;
+}
+  801860:	48 89 d8             	mov    %rbx,%rax
+  801863:	5b                   	pop    %rbx
+  801864:	41 5c                	pop    %r12
+  801866:	5d                   	pop    %rbp
+  801867:	c3                   	ret
+
+0000000000801868 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801868:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80186b:	48 85 d2             	test   %rdx,%rdx
+  80186e:	74 1f                	je     80188f <strncpy+0x27>
+  801870:	48 01 fa             	add    %rdi,%rdx
+  801873:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801876:	48 83 c1 01          	add    $0x1,%rcx
+  80187a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80187e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801882:	41 80 f8 01          	cmp    $0x1,%r8b
+  801886:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80188a:	48 39 ca             	cmp    %rcx,%rdx
+  80188d:	75 e7                	jne    801876 <strncpy+0xe>
+    }
+    return ret;
+}
+  80188f:	c3                   	ret
+
+0000000000801890 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801890:	48 89 f8             	mov    %rdi,%rax
+  801893:	48 85 d2             	test   %rdx,%rdx
+  801896:	74 24                	je     8018bc <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801898:	48 83 ea 01          	sub    $0x1,%rdx
+  80189c:	74 1b                	je     8018b9 <strlcpy+0x29>
+  80189e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8018a2:	0f b6 16             	movzbl (%rsi),%edx
+  8018a5:	84 d2                	test   %dl,%dl
+  8018a7:	74 10                	je     8018b9 <strlcpy+0x29>
+            *dst++ = *src++;
+  8018a9:	48 83 c6 01          	add    $0x1,%rsi
+  8018ad:	48 83 c0 01          	add    $0x1,%rax
+  8018b1:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8018b4:	48 39 c8             	cmp    %rcx,%rax
+  8018b7:	75 e9                	jne    8018a2 <strlcpy+0x12>
+        *dst = '\0';
+  8018b9:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8018bc:	48 29 f8             	sub    %rdi,%rax
+}
+  8018bf:	c3                   	ret
+
+00000000008018c0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8018c0:	0f b6 07             	movzbl (%rdi),%eax
+  8018c3:	84 c0                	test   %al,%al
+  8018c5:	74 13                	je     8018da <strcmp+0x1a>
+  8018c7:	38 06                	cmp    %al,(%rsi)
+  8018c9:	75 0f                	jne    8018da <strcmp+0x1a>
+  8018cb:	48 83 c7 01          	add    $0x1,%rdi
+  8018cf:	48 83 c6 01          	add    $0x1,%rsi
+  8018d3:	0f b6 07             	movzbl (%rdi),%eax
+  8018d6:	84 c0                	test   %al,%al
+  8018d8:	75 ed                	jne    8018c7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8018da:	0f b6 c0             	movzbl %al,%eax
+  8018dd:	0f b6 16             	movzbl (%rsi),%edx
+  8018e0:	29 d0                	sub    %edx,%eax
+}
+  8018e2:	c3                   	ret
+
+00000000008018e3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8018e3:	48 85 d2             	test   %rdx,%rdx
+  8018e6:	74 1f                	je     801907 <strncmp+0x24>
+  8018e8:	0f b6 07             	movzbl (%rdi),%eax
+  8018eb:	84 c0                	test   %al,%al
+  8018ed:	74 1e                	je     80190d <strncmp+0x2a>
+  8018ef:	3a 06                	cmp    (%rsi),%al
+  8018f1:	75 1a                	jne    80190d <strncmp+0x2a>
+  8018f3:	48 83 c7 01          	add    $0x1,%rdi
+  8018f7:	48 83 c6 01          	add    $0x1,%rsi
+  8018fb:	48 83 ea 01          	sub    $0x1,%rdx
+  8018ff:	75 e7                	jne    8018e8 <strncmp+0x5>
+
+    if (!n) return 0;
+  801901:	b8 00 00 00 00       	mov    $0x0,%eax
+  801906:	c3                   	ret
+  801907:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190c:	c3                   	ret
+  80190d:	48 85 d2             	test   %rdx,%rdx
+  801910:	74 09                	je     80191b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801912:	0f b6 07             	movzbl (%rdi),%eax
+  801915:	0f b6 16             	movzbl (%rsi),%edx
+  801918:	29 d0                	sub    %edx,%eax
+  80191a:	c3                   	ret
+    if (!n) return 0;
+  80191b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801920:	c3                   	ret
+
+0000000000801921 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801921:	0f b6 17             	movzbl (%rdi),%edx
+  801924:	84 d2                	test   %dl,%dl
+  801926:	74 18                	je     801940 <strchr+0x1f>
+        if (*str == c) {
+  801928:	0f be d2             	movsbl %dl,%edx
+  80192b:	39 f2                	cmp    %esi,%edx
+  80192d:	74 17                	je     801946 <strchr+0x25>
+    for (; *str; str++) {
+  80192f:	48 83 c7 01          	add    $0x1,%rdi
+  801933:	0f b6 17             	movzbl (%rdi),%edx
+  801936:	84 d2                	test   %dl,%dl
+  801938:	75 ee                	jne    801928 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80193a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193f:	c3                   	ret
+  801940:	b8 00 00 00 00       	mov    $0x0,%eax
+  801945:	c3                   	ret
+  801946:	48 89 f8             	mov    %rdi,%rax
+}
+  801949:	c3                   	ret
+
+000000000080194a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80194a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80194d:	0f b6 17             	movzbl (%rdi),%edx
+  801950:	84 d2                	test   %dl,%dl
+  801952:	74 13                	je     801967 <strfind+0x1d>
+  801954:	0f be d2             	movsbl %dl,%edx
+  801957:	39 f2                	cmp    %esi,%edx
+  801959:	74 0b                	je     801966 <strfind+0x1c>
+  80195b:	48 83 c0 01          	add    $0x1,%rax
+  80195f:	0f b6 10             	movzbl (%rax),%edx
+  801962:	84 d2                	test   %dl,%dl
+  801964:	75 ee                	jne    801954 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801966:	c3                   	ret
+  801967:	c3                   	ret
+
+0000000000801968 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801968:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80196b:	48 89 f8             	mov    %rdi,%rax
+  80196e:	48 f7 d8             	neg    %rax
+  801971:	83 e0 07             	and    $0x7,%eax
+  801974:	49 89 d1             	mov    %rdx,%r9
+  801977:	49 29 c1             	sub    %rax,%r9
+  80197a:	78 36                	js     8019b2 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80197c:	40 0f b6 c6          	movzbl %sil,%eax
+  801980:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801987:	01 01 01 
+  80198a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80198e:	40 f6 c7 07          	test   $0x7,%dil
+  801992:	75 38                	jne    8019cc <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801994:	4c 89 c9             	mov    %r9,%rcx
+  801997:	48 c1 f9 03          	sar    $0x3,%rcx
+  80199b:	74 0c                	je     8019a9 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80199d:	fc                   	cld
+  80199e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8019a1:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8019a5:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8019a9:	4d 85 c9             	test   %r9,%r9
+  8019ac:	75 45                	jne    8019f3 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8019ae:	4c 89 c0             	mov    %r8,%rax
+  8019b1:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8019b2:	48 85 d2             	test   %rdx,%rdx
+  8019b5:	74 f7                	je     8019ae <memset+0x46>
+  8019b7:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8019ba:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8019bd:	48 83 c0 01          	add    $0x1,%rax
+  8019c1:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8019c5:	48 39 c2             	cmp    %rax,%rdx
+  8019c8:	75 f3                	jne    8019bd <memset+0x55>
+  8019ca:	eb e2                	jmp    8019ae <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8019cc:	40 f6 c7 01          	test   $0x1,%dil
+  8019d0:	74 06                	je     8019d8 <memset+0x70>
+  8019d2:	88 07                	mov    %al,(%rdi)
+  8019d4:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8019d8:	40 f6 c7 02          	test   $0x2,%dil
+  8019dc:	74 07                	je     8019e5 <memset+0x7d>
+  8019de:	66 89 07             	mov    %ax,(%rdi)
+  8019e1:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8019e5:	40 f6 c7 04          	test   $0x4,%dil
+  8019e9:	74 a9                	je     801994 <memset+0x2c>
+  8019eb:	89 07                	mov    %eax,(%rdi)
+  8019ed:	48 83 c7 04          	add    $0x4,%rdi
+  8019f1:	eb a1                	jmp    801994 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8019f3:	41 f6 c1 04          	test   $0x4,%r9b
+  8019f7:	74 06                	je     8019ff <memset+0x97>
+  8019f9:	89 07                	mov    %eax,(%rdi)
+  8019fb:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8019ff:	41 f6 c1 02          	test   $0x2,%r9b
+  801a03:	74 07                	je     801a0c <memset+0xa4>
+  801a05:	66 89 07             	mov    %ax,(%rdi)
+  801a08:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801a0c:	41 f6 c1 01          	test   $0x1,%r9b
+  801a10:	74 9c                	je     8019ae <memset+0x46>
+  801a12:	88 07                	mov    %al,(%rdi)
+  801a14:	eb 98                	jmp    8019ae <memset+0x46>
+
+0000000000801a16 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801a16:	48 89 f8             	mov    %rdi,%rax
+  801a19:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801a1c:	48 39 fe             	cmp    %rdi,%rsi
+  801a1f:	73 3b                	jae    801a5c <memmove+0x46>
+  801a21:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801a25:	48 39 d7             	cmp    %rdx,%rdi
+  801a28:	73 32                	jae    801a5c <memmove+0x46>
+        s += n;
+        d += n;
+  801a2a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801a2e:	48 89 d6             	mov    %rdx,%rsi
+  801a31:	48 09 fe             	or     %rdi,%rsi
+  801a34:	48 09 ce             	or     %rcx,%rsi
+  801a37:	40 f6 c6 07          	test   $0x7,%sil
+  801a3b:	75 12                	jne    801a4f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801a3d:	48 83 ef 08          	sub    $0x8,%rdi
+  801a41:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801a45:	48 c1 e9 03          	shr    $0x3,%rcx
+  801a49:	fd                   	std
+  801a4a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801a4d:	fc                   	cld
+  801a4e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801a4f:	48 83 ef 01          	sub    $0x1,%rdi
+  801a53:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801a57:	fd                   	std
+  801a58:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801a5a:	eb f1                	jmp    801a4d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801a5c:	48 89 f2             	mov    %rsi,%rdx
+  801a5f:	48 09 c2             	or     %rax,%rdx
+  801a62:	48 09 ca             	or     %rcx,%rdx
+  801a65:	f6 c2 07             	test   $0x7,%dl
+  801a68:	75 0c                	jne    801a76 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801a6a:	48 c1 e9 03          	shr    $0x3,%rcx
+  801a6e:	48 89 c7             	mov    %rax,%rdi
+  801a71:	fc                   	cld
+  801a72:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801a75:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801a76:	48 89 c7             	mov    %rax,%rdi
+  801a79:	fc                   	cld
+  801a7a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801a7c:	c3                   	ret
+
+0000000000801a7d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801a7d:	55                   	push   %rbp
+  801a7e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801a81:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  801a88:	00 00 00 
+  801a8b:	ff d0                	call   *%rax
+}
+  801a8d:	5d                   	pop    %rbp
+  801a8e:	c3                   	ret
+
+0000000000801a8f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801a8f:	55                   	push   %rbp
+  801a90:	48 89 e5             	mov    %rsp,%rbp
+  801a93:	41 57                	push   %r15
+  801a95:	41 56                	push   %r14
+  801a97:	41 55                	push   %r13
+  801a99:	41 54                	push   %r12
+  801a9b:	53                   	push   %rbx
+  801a9c:	48 83 ec 08          	sub    $0x8,%rsp
+  801aa0:	49 89 fe             	mov    %rdi,%r14
+  801aa3:	49 89 f7             	mov    %rsi,%r15
+  801aa6:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801aa9:	48 89 f7             	mov    %rsi,%rdi
+  801aac:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  801ab3:	00 00 00 
+  801ab6:	ff d0                	call   *%rax
+  801ab8:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801abb:	48 89 de             	mov    %rbx,%rsi
+  801abe:	4c 89 f7             	mov    %r14,%rdi
+  801ac1:	48 b8 f9 17 80 00 00 	movabs $0x8017f9,%rax
+  801ac8:	00 00 00 
+  801acb:	ff d0                	call   *%rax
+  801acd:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801ad0:	48 39 c3             	cmp    %rax,%rbx
+  801ad3:	74 36                	je     801b0b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801ad5:	48 89 d8             	mov    %rbx,%rax
+  801ad8:	4c 29 e8             	sub    %r13,%rax
+  801adb:	49 39 c4             	cmp    %rax,%r12
+  801ade:	73 31                	jae    801b11 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801ae0:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801ae5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801ae9:	4c 89 fe             	mov    %r15,%rsi
+  801aec:	48 b8 7d 1a 80 00 00 	movabs $0x801a7d,%rax
+  801af3:	00 00 00 
+  801af6:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801af8:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801afc:	48 83 c4 08          	add    $0x8,%rsp
+  801b00:	5b                   	pop    %rbx
+  801b01:	41 5c                	pop    %r12
+  801b03:	41 5d                	pop    %r13
+  801b05:	41 5e                	pop    %r14
+  801b07:	41 5f                	pop    %r15
+  801b09:	5d                   	pop    %rbp
+  801b0a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801b0b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801b0f:	eb eb                	jmp    801afc <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801b11:	48 83 eb 01          	sub    $0x1,%rbx
+  801b15:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801b19:	48 89 da             	mov    %rbx,%rdx
+  801b1c:	4c 89 fe             	mov    %r15,%rsi
+  801b1f:	48 b8 7d 1a 80 00 00 	movabs $0x801a7d,%rax
+  801b26:	00 00 00 
+  801b29:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801b2b:	49 01 de             	add    %rbx,%r14
+  801b2e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801b33:	eb c3                	jmp    801af8 <strlcat+0x69>
+
+0000000000801b35 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801b35:	48 85 d2             	test   %rdx,%rdx
+  801b38:	74 2d                	je     801b67 <memcmp+0x32>
+  801b3a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801b3f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801b43:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801b48:	44 38 c1             	cmp    %r8b,%cl
+  801b4b:	75 0f                	jne    801b5c <memcmp+0x27>
+    while (n-- > 0) {
+  801b4d:	48 83 c0 01          	add    $0x1,%rax
+  801b51:	48 39 c2             	cmp    %rax,%rdx
+  801b54:	75 e9                	jne    801b3f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801b56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801b5c:	0f b6 c1             	movzbl %cl,%eax
+  801b5f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801b63:	44 29 c0             	sub    %r8d,%eax
+  801b66:	c3                   	ret
+    return 0;
+  801b67:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b6c:	c3                   	ret
+
+0000000000801b6d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801b6d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801b71:	48 39 c7             	cmp    %rax,%rdi
+  801b74:	73 0f                	jae    801b85 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801b76:	40 38 37             	cmp    %sil,(%rdi)
+  801b79:	74 0e                	je     801b89 <memfind+0x1c>
+    for (; src < end; src++) {
+  801b7b:	48 83 c7 01          	add    $0x1,%rdi
+  801b7f:	48 39 f8             	cmp    %rdi,%rax
+  801b82:	75 f2                	jne    801b76 <memfind+0x9>
+  801b84:	c3                   	ret
+  801b85:	48 89 f8             	mov    %rdi,%rax
+  801b88:	c3                   	ret
+  801b89:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801b8c:	c3                   	ret
+
+0000000000801b8d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801b8d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801b90:	0f b6 37             	movzbl (%rdi),%esi
+  801b93:	40 80 fe 20          	cmp    $0x20,%sil
+  801b97:	74 06                	je     801b9f <strtol+0x12>
+  801b99:	40 80 fe 09          	cmp    $0x9,%sil
+  801b9d:	75 13                	jne    801bb2 <strtol+0x25>
+  801b9f:	48 83 c7 01          	add    $0x1,%rdi
+  801ba3:	0f b6 37             	movzbl (%rdi),%esi
+  801ba6:	40 80 fe 20          	cmp    $0x20,%sil
+  801baa:	74 f3                	je     801b9f <strtol+0x12>
+  801bac:	40 80 fe 09          	cmp    $0x9,%sil
+  801bb0:	74 ed                	je     801b9f <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801bb2:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801bb5:	83 e0 fd             	and    $0xfffffffd,%eax
+  801bb8:	3c 01                	cmp    $0x1,%al
+  801bba:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801bbe:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801bc4:	75 0f                	jne    801bd5 <strtol+0x48>
+  801bc6:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801bc9:	74 14                	je     801bdf <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801bcb:	85 d2                	test   %edx,%edx
+  801bcd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801bd2:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801bda:	4c 63 ca             	movslq %edx,%r9
+  801bdd:	eb 36                	jmp    801c15 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801bdf:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801be3:	74 0f                	je     801bf4 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801be5:	85 d2                	test   %edx,%edx
+  801be7:	75 ec                	jne    801bd5 <strtol+0x48>
+        s++;
+  801be9:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801bed:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801bf2:	eb e1                	jmp    801bd5 <strtol+0x48>
+        s += 2;
+  801bf4:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801bf8:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801bfd:	eb d6                	jmp    801bd5 <strtol+0x48>
+            dig -= '0';
+  801bff:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801c02:	44 0f b6 c1          	movzbl %cl,%r8d
+  801c06:	41 39 d0             	cmp    %edx,%r8d
+  801c09:	7d 21                	jge    801c2c <strtol+0x9f>
+        val = val * base + dig;
+  801c0b:	49 0f af c1          	imul   %r9,%rax
+  801c0f:	0f b6 c9             	movzbl %cl,%ecx
+  801c12:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801c15:	48 83 c7 01          	add    $0x1,%rdi
+  801c19:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801c1d:	80 f9 39             	cmp    $0x39,%cl
+  801c20:	76 dd                	jbe    801bff <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801c22:	80 f9 7b             	cmp    $0x7b,%cl
+  801c25:	77 05                	ja     801c2c <strtol+0x9f>
+            dig -= 'a' - 10;
+  801c27:	83 e9 57             	sub    $0x57,%ecx
+  801c2a:	eb d6                	jmp    801c02 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801c2c:	4d 85 d2             	test   %r10,%r10
+  801c2f:	74 03                	je     801c34 <strtol+0xa7>
+  801c31:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801c34:	48 89 c2             	mov    %rax,%rdx
+  801c37:	48 f7 da             	neg    %rdx
+  801c3a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801c3e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801c42:	c3                   	ret
+
+0000000000801c43 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801c43:	55                   	push   %rbp
+  801c44:	48 89 e5             	mov    %rsp,%rbp
+  801c47:	53                   	push   %rbx
+  801c48:	48 89 fa             	mov    %rdi,%rdx
+  801c4b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c58:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c5d:	be 00 00 00 00       	mov    $0x0,%esi
+  801c62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c68:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801c6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c6e:	c9                   	leave
+  801c6f:	c3                   	ret
+
+0000000000801c70 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801c70:	55                   	push   %rbp
+  801c71:	48 89 e5             	mov    %rsp,%rbp
+  801c74:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c75:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c89:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c8e:	be 00 00 00 00       	mov    $0x0,%esi
+  801c93:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c99:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c9b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c9f:	c9                   	leave
+  801ca0:	c3                   	ret
+
+0000000000801ca1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801ca1:	55                   	push   %rbp
+  801ca2:	48 89 e5             	mov    %rsp,%rbp
+  801ca5:	53                   	push   %rbx
+  801ca6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801caa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801cad:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cb7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cbc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cc1:	be 00 00 00 00       	mov    $0x0,%esi
+  801cc6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ccc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801cce:	48 85 c0             	test   %rax,%rax
+  801cd1:	7f 06                	jg     801cd9 <sys_env_destroy+0x38>
+}
+  801cd3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cd7:	c9                   	leave
+  801cd8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801cd9:	49 89 c0             	mov    %rax,%r8
+  801cdc:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801ce1:	48 ba d0 43 80 00 00 	movabs $0x8043d0,%rdx
+  801ce8:	00 00 00 
+  801ceb:	be 26 00 00 00       	mov    $0x26,%esi
+  801cf0:	48 bf ef 43 80 00 00 	movabs $0x8043ef,%rdi
+  801cf7:	00 00 00 
+  801cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cff:	49 b9 a7 0d 80 00 00 	movabs $0x800da7,%r9
+  801d06:	00 00 00 
+  801d09:	41 ff d1             	call   *%r9
+
+0000000000801d0c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801d0c:	55                   	push   %rbp
+  801d0d:	48 89 e5             	mov    %rsp,%rbp
+  801d10:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d11:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d16:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d25:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d2a:	be 00 00 00 00       	mov    $0x0,%esi
+  801d2f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d35:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d37:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d3b:	c9                   	leave
+  801d3c:	c3                   	ret
+
+0000000000801d3d <sys_yield>:
+
+void
+sys_yield(void) {
+  801d3d:	55                   	push   %rbp
+  801d3e:	48 89 e5             	mov    %rsp,%rbp
+  801d41:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d42:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d47:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d56:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d5b:	be 00 00 00 00       	mov    $0x0,%esi
+  801d60:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d66:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d68:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d6c:	c9                   	leave
+  801d6d:	c3                   	ret
+
+0000000000801d6e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801d6e:	55                   	push   %rbp
+  801d6f:	48 89 e5             	mov    %rsp,%rbp
+  801d72:	53                   	push   %rbx
+  801d73:	48 89 fa             	mov    %rdi,%rdx
+  801d76:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801d79:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d7e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801d85:	00 00 00 
+  801d88:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d8d:	be 00 00 00 00       	mov    $0x0,%esi
+  801d92:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d98:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801d9a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d9e:	c9                   	leave
+  801d9f:	c3                   	ret
+
+0000000000801da0 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801da0:	55                   	push   %rbp
+  801da1:	48 89 e5             	mov    %rsp,%rbp
+  801da4:	53                   	push   %rbx
+  801da5:	49 89 f8             	mov    %rdi,%r8
+  801da8:	48 89 d3             	mov    %rdx,%rbx
+  801dab:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801dae:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801db3:	4c 89 c2             	mov    %r8,%rdx
+  801db6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801db9:	be 00 00 00 00       	mov    $0x0,%esi
+  801dbe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801dc4:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801dc6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dca:	c9                   	leave
+  801dcb:	c3                   	ret
+
+0000000000801dcc <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801dcc:	55                   	push   %rbp
+  801dcd:	48 89 e5             	mov    %rsp,%rbp
+  801dd0:	53                   	push   %rbx
+  801dd1:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd5:	89 f8                	mov    %edi,%eax
+  801dd7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801dda:	48 63 f9             	movslq %ecx,%rdi
+  801ddd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801de0:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801de5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801de8:	be 00 00 00 00       	mov    $0x0,%esi
+  801ded:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801df3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801df5:	48 85 c0             	test   %rax,%rax
+  801df8:	7f 06                	jg     801e00 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801dfa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dfe:	c9                   	leave
+  801dff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e00:	49 89 c0             	mov    %rax,%r8
+  801e03:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801e08:	48 ba d0 43 80 00 00 	movabs $0x8043d0,%rdx
+  801e0f:	00 00 00 
+  801e12:	be 26 00 00 00       	mov    $0x26,%esi
+  801e17:	48 bf ef 43 80 00 00 	movabs $0x8043ef,%rdi
+  801e1e:	00 00 00 
+  801e21:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e26:	49 b9 a7 0d 80 00 00 	movabs $0x800da7,%r9
+  801e2d:	00 00 00 
+  801e30:	41 ff d1             	call   *%r9
+
+0000000000801e33 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801e33:	55                   	push   %rbp
+  801e34:	48 89 e5             	mov    %rsp,%rbp
+  801e37:	53                   	push   %rbx
+  801e38:	48 83 ec 08          	sub    $0x8,%rsp
+  801e3c:	89 f8                	mov    %edi,%eax
+  801e3e:	49 89 f2             	mov    %rsi,%r10
+  801e41:	48 89 cf             	mov    %rcx,%rdi
+  801e44:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801e47:	48 63 da             	movslq %edx,%rbx
+  801e4a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e4d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e52:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e55:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801e58:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e5a:	48 85 c0             	test   %rax,%rax
+  801e5d:	7f 06                	jg     801e65 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801e5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e63:	c9                   	leave
+  801e64:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e65:	49 89 c0             	mov    %rax,%r8
+  801e68:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801e6d:	48 ba d0 43 80 00 00 	movabs $0x8043d0,%rdx
+  801e74:	00 00 00 
+  801e77:	be 26 00 00 00       	mov    $0x26,%esi
+  801e7c:	48 bf ef 43 80 00 00 	movabs $0x8043ef,%rdi
+  801e83:	00 00 00 
+  801e86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8b:	49 b9 a7 0d 80 00 00 	movabs $0x800da7,%r9
+  801e92:	00 00 00 
+  801e95:	41 ff d1             	call   *%r9
+
+0000000000801e98 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801e98:	55                   	push   %rbp
+  801e99:	48 89 e5             	mov    %rsp,%rbp
+  801e9c:	53                   	push   %rbx
+  801e9d:	48 83 ec 08          	sub    $0x8,%rsp
+  801ea1:	48 89 f1             	mov    %rsi,%rcx
+  801ea4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801ea7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801eaa:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801eaf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801eb4:	be 00 00 00 00       	mov    $0x0,%esi
+  801eb9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ebf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ec1:	48 85 c0             	test   %rax,%rax
+  801ec4:	7f 06                	jg     801ecc <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801ec6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eca:	c9                   	leave
+  801ecb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ecc:	49 89 c0             	mov    %rax,%r8
+  801ecf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801ed4:	48 ba d0 43 80 00 00 	movabs $0x8043d0,%rdx
+  801edb:	00 00 00 
+  801ede:	be 26 00 00 00       	mov    $0x26,%esi
+  801ee3:	48 bf ef 43 80 00 00 	movabs $0x8043ef,%rdi
+  801eea:	00 00 00 
+  801eed:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef2:	49 b9 a7 0d 80 00 00 	movabs $0x800da7,%r9
+  801ef9:	00 00 00 
+  801efc:	41 ff d1             	call   *%r9
+
+0000000000801eff <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801eff:	55                   	push   %rbp
+  801f00:	48 89 e5             	mov    %rsp,%rbp
+  801f03:	53                   	push   %rbx
+  801f04:	48 83 ec 08          	sub    $0x8,%rsp
+  801f08:	89 f8                	mov    %edi,%eax
+  801f0a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801f0d:	48 63 f9             	movslq %ecx,%rdi
+  801f10:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f13:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f18:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f1b:	be 00 00 00 00       	mov    $0x0,%esi
+  801f20:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f26:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f28:	48 85 c0             	test   %rax,%rax
+  801f2b:	7f 06                	jg     801f33 <sys_region_advise+0x34>
+}
+  801f2d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f31:	c9                   	leave
+  801f32:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f33:	49 89 c0             	mov    %rax,%r8
+  801f36:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801f3b:	48 ba d0 43 80 00 00 	movabs $0x8043d0,%rdx
+  801f42:	00 00 00 
+  801f45:	be 26 00 00 00       	mov    $0x26,%esi
+  801f4a:	48 bf ef 43 80 00 00 	movabs $0x8043ef,%rdi
+  801f51:	00 00 00 
+  801f54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f59:	49 b9 a7 0d 80 00 00 	movabs $0x800da7,%r9
+  801f60:	00 00 00 
+  801f63:	41 ff d1             	call   *%r9
+
+0000000000801f66 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801f66:	55                   	push   %rbp
+  801f67:	48 89 e5             	mov    %rsp,%rbp
+  801f6a:	53                   	push   %rbx
+  801f6b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801f6f:	48 63 ce             	movslq %esi,%rcx
+  801f72:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f75:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f7f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f84:	be 00 00 00 00       	mov    $0x0,%esi
+  801f89:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f8f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f91:	48 85 c0             	test   %rax,%rax
+  801f94:	7f 06                	jg     801f9c <sys_env_set_nice+0x36>
+}
+  801f96:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f9a:	c9                   	leave
+  801f9b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f9c:	49 89 c0             	mov    %rax,%r8
+  801f9f:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801fa4:	48 ba d0 43 80 00 00 	movabs $0x8043d0,%rdx
+  801fab:	00 00 00 
+  801fae:	be 26 00 00 00       	mov    $0x26,%esi
+  801fb3:	48 bf ef 43 80 00 00 	movabs $0x8043ef,%rdi
+  801fba:	00 00 00 
+  801fbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc2:	49 b9 a7 0d 80 00 00 	movabs $0x800da7,%r9
+  801fc9:	00 00 00 
+  801fcc:	41 ff d1             	call   *%r9
+
+0000000000801fcf <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801fcf:	55                   	push   %rbp
+  801fd0:	48 89 e5             	mov    %rsp,%rbp
+  801fd3:	53                   	push   %rbx
+  801fd4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801fd8:	48 63 ce             	movslq %esi,%rcx
+  801fdb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801fde:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801fe3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fe8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fed:	be 00 00 00 00       	mov    $0x0,%esi
+  801ff2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ff8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ffa:	48 85 c0             	test   %rax,%rax
+  801ffd:	7f 06                	jg     802005 <sys_env_set_status+0x36>
+}
+  801fff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802003:	c9                   	leave
+  802004:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802005:	49 89 c0             	mov    %rax,%r8
+  802008:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80200d:	48 ba d0 43 80 00 00 	movabs $0x8043d0,%rdx
+  802014:	00 00 00 
+  802017:	be 26 00 00 00       	mov    $0x26,%esi
+  80201c:	48 bf ef 43 80 00 00 	movabs $0x8043ef,%rdi
+  802023:	00 00 00 
+  802026:	b8 00 00 00 00       	mov    $0x0,%eax
+  80202b:	49 b9 a7 0d 80 00 00 	movabs $0x800da7,%r9
+  802032:	00 00 00 
+  802035:	41 ff d1             	call   *%r9
+
+0000000000802038 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802038:	55                   	push   %rbp
+  802039:	48 89 e5             	mov    %rsp,%rbp
+  80203c:	53                   	push   %rbx
+  80203d:	48 83 ec 08          	sub    $0x8,%rsp
+  802041:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  802044:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802047:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80204c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802051:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802056:	be 00 00 00 00       	mov    $0x0,%esi
+  80205b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802061:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802063:	48 85 c0             	test   %rax,%rax
+  802066:	7f 06                	jg     80206e <sys_env_set_trapframe+0x36>
+}
+  802068:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80206c:	c9                   	leave
+  80206d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80206e:	49 89 c0             	mov    %rax,%r8
+  802071:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802076:	48 ba d0 43 80 00 00 	movabs $0x8043d0,%rdx
+  80207d:	00 00 00 
+  802080:	be 26 00 00 00       	mov    $0x26,%esi
+  802085:	48 bf ef 43 80 00 00 	movabs $0x8043ef,%rdi
+  80208c:	00 00 00 
+  80208f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802094:	49 b9 a7 0d 80 00 00 	movabs $0x800da7,%r9
+  80209b:	00 00 00 
+  80209e:	41 ff d1             	call   *%r9
+
+00000000008020a1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8020a1:	55                   	push   %rbp
+  8020a2:	48 89 e5             	mov    %rsp,%rbp
+  8020a5:	53                   	push   %rbx
+  8020a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8020aa:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8020ad:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8020b0:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8020b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8020bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8020c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8020ca:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8020cc:	48 85 c0             	test   %rax,%rax
+  8020cf:	7f 06                	jg     8020d7 <sys_env_set_pgfault_upcall+0x36>
+}
+  8020d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020d5:	c9                   	leave
+  8020d6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8020d7:	49 89 c0             	mov    %rax,%r8
+  8020da:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8020df:	48 ba d0 43 80 00 00 	movabs $0x8043d0,%rdx
+  8020e6:	00 00 00 
+  8020e9:	be 26 00 00 00       	mov    $0x26,%esi
+  8020ee:	48 bf ef 43 80 00 00 	movabs $0x8043ef,%rdi
+  8020f5:	00 00 00 
+  8020f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020fd:	49 b9 a7 0d 80 00 00 	movabs $0x800da7,%r9
+  802104:	00 00 00 
+  802107:	41 ff d1             	call   *%r9
+
+000000000080210a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80210a:	55                   	push   %rbp
+  80210b:	48 89 e5             	mov    %rsp,%rbp
+  80210e:	53                   	push   %rbx
+  80210f:	89 f8                	mov    %edi,%eax
+  802111:	49 89 f1             	mov    %rsi,%r9
+  802114:	48 89 d3             	mov    %rdx,%rbx
+  802117:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80211a:	49 63 f0             	movslq %r8d,%rsi
+  80211d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802120:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802125:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802128:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80212e:	cd 30                	int    $0x30
+}
+  802130:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802134:	c9                   	leave
+  802135:	c3                   	ret
+
+0000000000802136 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802136:	55                   	push   %rbp
+  802137:	48 89 e5             	mov    %rsp,%rbp
+  80213a:	53                   	push   %rbx
+  80213b:	48 83 ec 08          	sub    $0x8,%rsp
+  80213f:	48 89 fa             	mov    %rdi,%rdx
+  802142:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802145:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80214a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80214f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802154:	be 00 00 00 00       	mov    $0x0,%esi
+  802159:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80215f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802161:	48 85 c0             	test   %rax,%rax
+  802164:	7f 06                	jg     80216c <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802166:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80216a:	c9                   	leave
+  80216b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80216c:	49 89 c0             	mov    %rax,%r8
+  80216f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  802174:	48 ba d0 43 80 00 00 	movabs $0x8043d0,%rdx
+  80217b:	00 00 00 
+  80217e:	be 26 00 00 00       	mov    $0x26,%esi
+  802183:	48 bf ef 43 80 00 00 	movabs $0x8043ef,%rdi
+  80218a:	00 00 00 
+  80218d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802192:	49 b9 a7 0d 80 00 00 	movabs $0x800da7,%r9
+  802199:	00 00 00 
+  80219c:	41 ff d1             	call   *%r9
+
+000000000080219f <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80219f:	55                   	push   %rbp
+  8021a0:	48 89 e5             	mov    %rsp,%rbp
+  8021a3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8021a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8021a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8021b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021b8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8021c8:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8021ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021ce:	c9                   	leave
+  8021cf:	c3                   	ret
+
+00000000008021d0 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8021d0:	55                   	push   %rbp
+  8021d1:	48 89 e5             	mov    %rsp,%rbp
+  8021d4:	53                   	push   %rbx
+  8021d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8021d9:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8021dc:	48 63 ce             	movslq %esi,%rcx
+  8021df:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8021e2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8021e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8021f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8021f9:	48 85 c0             	test   %rax,%rax
+  8021fc:	7f 06                	jg     802204 <sys_sigqueue+0x34>
+}
+  8021fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802202:	c9                   	leave
+  802203:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802204:	49 89 c0             	mov    %rax,%r8
+  802207:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80220c:	48 ba d0 43 80 00 00 	movabs $0x8043d0,%rdx
+  802213:	00 00 00 
+  802216:	be 26 00 00 00       	mov    $0x26,%esi
+  80221b:	48 bf ef 43 80 00 00 	movabs $0x8043ef,%rdi
+  802222:	00 00 00 
+  802225:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222a:	49 b9 a7 0d 80 00 00 	movabs $0x800da7,%r9
+  802231:	00 00 00 
+  802234:	41 ff d1             	call   *%r9
+
+0000000000802237 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  802237:	55                   	push   %rbp
+  802238:	48 89 e5             	mov    %rsp,%rbp
+  80223b:	53                   	push   %rbx
+  80223c:	48 83 ec 08          	sub    $0x8,%rsp
+  802240:	48 89 fa             	mov    %rdi,%rdx
+  802243:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802246:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80224b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802250:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802255:	be 00 00 00 00       	mov    $0x0,%esi
+  80225a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802260:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802262:	48 85 c0             	test   %rax,%rax
+  802265:	7f 06                	jg     80226d <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  802267:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80226b:	c9                   	leave
+  80226c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80226d:	49 89 c0             	mov    %rax,%r8
+  802270:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802275:	48 ba d0 43 80 00 00 	movabs $0x8043d0,%rdx
+  80227c:	00 00 00 
+  80227f:	be 26 00 00 00       	mov    $0x26,%esi
+  802284:	48 bf ef 43 80 00 00 	movabs $0x8043ef,%rdi
+  80228b:	00 00 00 
+  80228e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802293:	49 b9 a7 0d 80 00 00 	movabs $0x800da7,%r9
+  80229a:	00 00 00 
+  80229d:	41 ff d1             	call   *%r9
+
+00000000008022a0 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  8022a0:	55                   	push   %rbp
+  8022a1:	48 89 e5             	mov    %rsp,%rbp
+  8022a4:	53                   	push   %rbx
+  8022a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8022a9:	48 89 f1             	mov    %rsi,%rcx
+  8022ac:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  8022af:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8022b2:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8022b7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8022bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8022c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8022c7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8022c9:	48 85 c0             	test   %rax,%rax
+  8022cc:	7f 06                	jg     8022d4 <sys_sigaction+0x34>
+}
+  8022ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022d2:	c9                   	leave
+  8022d3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8022d4:	49 89 c0             	mov    %rax,%r8
+  8022d7:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8022dc:	48 ba d0 43 80 00 00 	movabs $0x8043d0,%rdx
+  8022e3:	00 00 00 
+  8022e6:	be 26 00 00 00       	mov    $0x26,%esi
+  8022eb:	48 bf ef 43 80 00 00 	movabs $0x8043ef,%rdi
+  8022f2:	00 00 00 
+  8022f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022fa:	49 b9 a7 0d 80 00 00 	movabs $0x800da7,%r9
+  802301:	00 00 00 
+  802304:	41 ff d1             	call   *%r9
+
+0000000000802307 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  802307:	55                   	push   %rbp
+  802308:	48 89 e5             	mov    %rsp,%rbp
+  80230b:	53                   	push   %rbx
+  80230c:	48 83 ec 08          	sub    $0x8,%rsp
+  802310:	48 89 f1             	mov    %rsi,%rcx
+  802313:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  802316:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802319:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80231e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802323:	be 00 00 00 00       	mov    $0x0,%esi
+  802328:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80232e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802330:	48 85 c0             	test   %rax,%rax
+  802333:	7f 06                	jg     80233b <sys_sigprocmask+0x34>
+}
+  802335:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802339:	c9                   	leave
+  80233a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80233b:	49 89 c0             	mov    %rax,%r8
+  80233e:	b9 13 00 00 00       	mov    $0x13,%ecx
+  802343:	48 ba d0 43 80 00 00 	movabs $0x8043d0,%rdx
+  80234a:	00 00 00 
+  80234d:	be 26 00 00 00       	mov    $0x26,%esi
+  802352:	48 bf ef 43 80 00 00 	movabs $0x8043ef,%rdi
+  802359:	00 00 00 
+  80235c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802361:	49 b9 a7 0d 80 00 00 	movabs $0x800da7,%r9
+  802368:	00 00 00 
+  80236b:	41 ff d1             	call   *%r9
+
+000000000080236e <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80236e:	55                   	push   %rbp
+  80236f:	48 89 e5             	mov    %rsp,%rbp
+  802372:	41 56                	push   %r14
+  802374:	41 55                	push   %r13
+  802376:	41 54                	push   %r12
+  802378:	53                   	push   %rbx
+  802379:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80237c:	48 b8 28 62 80 00 00 	movabs $0x806228,%rax
+  802383:	00 00 00 
+  802386:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80238a:	74 27                	je     8023b3 <_handle_vectored_pagefault+0x45>
+  80238c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  802391:	49 bd e0 61 80 00 00 	movabs $0x8061e0,%r13
+  802398:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80239b:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80239e:	4c 89 e7             	mov    %r12,%rdi
+  8023a1:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8023a6:	84 c0                	test   %al,%al
+  8023a8:	75 45                	jne    8023ef <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8023aa:	48 83 c3 01          	add    $0x1,%rbx
+  8023ae:	49 3b 1e             	cmp    (%r14),%rbx
+  8023b1:	72 eb                	jb     80239e <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8023b3:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8023ba:	00 
+  8023bb:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8023c0:	4d 8b 04 24          	mov    (%r12),%r8
+  8023c4:	48 ba 00 44 80 00 00 	movabs $0x804400,%rdx
+  8023cb:	00 00 00 
+  8023ce:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8023d3:	48 bf 97 44 80 00 00 	movabs $0x804497,%rdi
+  8023da:	00 00 00 
+  8023dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e2:	49 ba a7 0d 80 00 00 	movabs $0x800da7,%r10
+  8023e9:	00 00 00 
+  8023ec:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8023ef:	5b                   	pop    %rbx
+  8023f0:	41 5c                	pop    %r12
+  8023f2:	41 5d                	pop    %r13
+  8023f4:	41 5e                	pop    %r14
+  8023f6:	5d                   	pop    %rbp
+  8023f7:	c3                   	ret
+
+00000000008023f8 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8023f8:	55                   	push   %rbp
+  8023f9:	48 89 e5             	mov    %rsp,%rbp
+  8023fc:	53                   	push   %rbx
+  8023fd:	48 83 ec 08          	sub    $0x8,%rsp
+  802401:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  802404:	48 b8 20 62 80 00 00 	movabs $0x806220,%rax
+  80240b:	00 00 00 
+  80240e:	80 38 00             	cmpb   $0x0,(%rax)
+  802411:	74 61                	je     802474 <add_pgfault_handler+0x7c>
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802413:	48 b8 28 62 80 00 00 	movabs $0x806228,%rax
+  80241a:	00 00 00 
+  80241d:	48 8b 10             	mov    (%rax),%rdx
+  802420:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  802425:	48 b9 e0 61 80 00 00 	movabs $0x8061e0,%rcx
+  80242c:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80242f:	48 85 d2             	test   %rdx,%rdx
+  802432:	74 19                	je     80244d <add_pgfault_handler+0x55>
+        if (handler == _pfhandler_vec[i]) return 0;
+  802434:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  802438:	74 2f                	je     802469 <add_pgfault_handler+0x71>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80243a:	48 83 c0 01          	add    $0x1,%rax
+  80243e:	48 39 d0             	cmp    %rdx,%rax
+  802441:	75 f1                	jne    802434 <add_pgfault_handler+0x3c>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  802443:	48 83 fa 08          	cmp    $0x8,%rdx
+  802447:	0f 84 f7 00 00 00    	je     802544 <add_pgfault_handler+0x14c>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80244d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802451:	48 a3 28 62 80 00 00 	movabs %rax,0x806228
+  802458:	00 00 00 
+  80245b:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  802462:	00 00 00 
+  802465:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  802469:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802472:	c9                   	leave
+  802473:	c3                   	ret
+        if (sys_alloc_region(CURENVID, ues_beg, PAGE_SIZE, PROT_RW))
+  802474:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802479:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80247e:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  802485:	00 00 00 
+  802488:	bf 00 00 00 00       	mov    $0x0,%edi
+  80248d:	48 b8 cc 1d 80 00 00 	movabs $0x801dcc,%rax
+  802494:	00 00 00 
+  802497:	ff d0                	call   *%rax
+  802499:	85 c0                	test   %eax,%eax
+  80249b:	75 53                	jne    8024f0 <add_pgfault_handler+0xf8>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80249d:	48 ba 28 62 80 00 00 	movabs $0x806228,%rdx
+  8024a4:	00 00 00 
+  8024a7:	48 8b 02             	mov    (%rdx),%rax
+  8024aa:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8024ae:	48 89 0a             	mov    %rcx,(%rdx)
+  8024b1:	48 ba e0 61 80 00 00 	movabs $0x8061e0,%rdx
+  8024b8:	00 00 00 
+  8024bb:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        if (sys_env_set_pgfault_upcall(CURENVID, _pgfault_upcall))
+  8024bf:	48 be 30 26 80 00 00 	movabs $0x802630,%rsi
+  8024c6:	00 00 00 
+  8024c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024ce:	48 b8 a1 20 80 00 00 	movabs $0x8020a1,%rax
+  8024d5:	00 00 00 
+  8024d8:	ff d0                	call   *%rax
+  8024da:	85 c0                	test   %eax,%eax
+  8024dc:	75 3c                	jne    80251a <add_pgfault_handler+0x122>
+        _pfhandler_inititiallized = 1;
+  8024de:	48 b8 20 62 80 00 00 	movabs $0x806220,%rax
+  8024e5:	00 00 00 
+  8024e8:	c6 00 01             	movb   $0x1,(%rax)
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8024eb:	e9 79 ff ff ff       	jmp    802469 <add_pgfault_handler+0x71>
+            panic("add_pgfault_handler: sys_alloc_region failed");
+  8024f0:	48 ba 30 44 80 00 00 	movabs $0x804430,%rdx
+  8024f7:	00 00 00 
+  8024fa:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8024ff:	48 bf 97 44 80 00 00 	movabs $0x804497,%rdi
+  802506:	00 00 00 
+  802509:	b8 00 00 00 00       	mov    $0x0,%eax
+  80250e:	48 b9 a7 0d 80 00 00 	movabs $0x800da7,%rcx
+  802515:	00 00 00 
+  802518:	ff d1                	call   *%rcx
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+  80251a:	48 ba 60 44 80 00 00 	movabs $0x804460,%rdx
+  802521:	00 00 00 
+  802524:	be 32 00 00 00       	mov    $0x32,%esi
+  802529:	48 bf 97 44 80 00 00 	movabs $0x804497,%rdi
+  802530:	00 00 00 
+  802533:	b8 00 00 00 00       	mov    $0x0,%eax
+  802538:	48 b9 a7 0d 80 00 00 	movabs $0x800da7,%rcx
+  80253f:	00 00 00 
+  802542:	ff d1                	call   *%rcx
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  802544:	b9 fd ff ff ff       	mov    $0xfffffffd,%ecx
+  802549:	48 ba a5 44 80 00 00 	movabs $0x8044a5,%rdx
+  802550:	00 00 00 
+  802553:	be 40 00 00 00       	mov    $0x40,%esi
+  802558:	48 bf 97 44 80 00 00 	movabs $0x804497,%rdi
+  80255f:	00 00 00 
+  802562:	b8 00 00 00 00       	mov    $0x0,%eax
+  802567:	49 b8 a7 0d 80 00 00 	movabs $0x800da7,%r8
+  80256e:	00 00 00 
+  802571:	41 ff d0             	call   *%r8
+
+0000000000802574 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  802574:	55                   	push   %rbp
+  802575:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  802578:	48 b8 20 62 80 00 00 	movabs $0x806220,%rax
+  80257f:	00 00 00 
+  802582:	80 38 00             	cmpb   $0x0,(%rax)
+  802585:	74 33                	je     8025ba <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802587:	48 a1 28 62 80 00 00 	movabs 0x806228,%rax
+  80258e:	00 00 00 
+  802591:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  802596:	48 ba e0 61 80 00 00 	movabs $0x8061e0,%rdx
+  80259d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8025a0:	48 85 c0             	test   %rax,%rax
+  8025a3:	0f 84 85 00 00 00    	je     80262e <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8025a9:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8025ad:	74 40                	je     8025ef <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8025af:	48 83 c1 01          	add    $0x1,%rcx
+  8025b3:	48 39 c1             	cmp    %rax,%rcx
+  8025b6:	75 f1                	jne    8025a9 <remove_pgfault_handler+0x35>
+  8025b8:	eb 74                	jmp    80262e <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8025ba:	48 b9 bd 44 80 00 00 	movabs $0x8044bd,%rcx
+  8025c1:	00 00 00 
+  8025c4:	48 ba d7 44 80 00 00 	movabs $0x8044d7,%rdx
+  8025cb:	00 00 00 
+  8025ce:	be 46 00 00 00       	mov    $0x46,%esi
+  8025d3:	48 bf 97 44 80 00 00 	movabs $0x804497,%rdi
+  8025da:	00 00 00 
+  8025dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e2:	49 b8 a7 0d 80 00 00 	movabs $0x800da7,%r8
+  8025e9:	00 00 00 
+  8025ec:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8025ef:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8025f6:	00 
+  8025f7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8025fb:	48 29 ca             	sub    %rcx,%rdx
+  8025fe:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  802605:	00 00 00 
+  802608:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80260c:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  802611:	48 89 ce             	mov    %rcx,%rsi
+  802614:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  80261b:	00 00 00 
+  80261e:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  802620:	48 b8 28 62 80 00 00 	movabs $0x806228,%rax
+  802627:	00 00 00 
+  80262a:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80262e:	5d                   	pop    %rbp
+  80262f:	c3                   	ret
+
+0000000000802630 <_pgfault_upcall>:
+.text
+.globl _pgfault_upcall
+.globl _signal_handler_trampoline
+_pgfault_upcall:
+_signal_handler_trampoline:
+    movq  %rsp,%rdi # passing the function argument (UTrapframe *) in rdi
+  802630:	48 89 e7             	mov    %rsp,%rdi
+    # sizeof(struct EnqueuedSignal) == 56
+    # sizeof(curenv->env_sig_mask) == 4
+    # + 4 bytes of alignment
+    add $64, %rdi
+  802633:	48 83 c7 40          	add    $0x40,%rdi
+
+    # load signo
+    mov (%rsp), %eax
+  802637:	8b 04 24             	mov    (%rsp),%eax
+    test %eax, %eax
+  80263a:	85 c0                	test   %eax,%eax
+    jnz _call_generic_signal_handler
+  80263c:	75 0e                	jne    80264c <_call_generic_signal_handler>
+
+    # Call the C page fault handler.
+    movabs $_handle_vectored_pagefault, %rax
+  80263e:	48 b8 6e 23 80 00 00 	movabs $0x80236e,%rax
+  802645:	00 00 00 
+    call *%rax
+  802648:	ff d0                	call   *%rax
+    jmp _return_from_handler
+  80264a:	eb 0f                	jmp    80265b <_return_from_handler>
+
+000000000080264c <_call_generic_signal_handler>:
+
+_call_generic_signal_handler:
+    movq %rsp, %rsi # passing the function argument (EnqueuedSignal *) in rsi
+  80264c:	48 89 e6             	mov    %rsp,%rsi
+    movabs $_generic_signal_handler, %rax
+  80264f:	48 b8 93 37 80 00 00 	movabs $0x803793,%rax
+  802656:	00 00 00 
+    call *%rax
+  802659:	ff d0                	call   *%rax
+
+000000000080265b <_return_from_handler>:
+
+_return_from_handler:
+    # ignore EnqueuedSignal and env_sig_mask
+    add $64, %rsp
+  80265b:	48 83 c4 40          	add    $0x40,%rsp
+    # put SIG_SETMASK as the first func arg
+    movq $3, %rdi
+  80265f:	48 c7 c7 03 00 00 00 	mov    $0x3,%rdi
+    # load &env_sig_mask (as the second func arg)
+    lea -4(%rsp), %rsi
+  802666:	48 8d 74 24 fc       	lea    -0x4(%rsp),%rsi
+    # NULL as the third arg
+    xor %rdx, %rdx
+  80266b:	48 31 d2             	xor    %rdx,%rdx
+    # restore blocked signals mask
+    movabs $sys_sigprocmask, %rax
+  80266e:	48 b8 07 23 80 00 00 	movabs $0x802307,%rax
+  802675:	00 00 00 
+    call *%rax
+  802678:	ff d0                	call   *%rax
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    # ignore utf_fault_va, utf_err
+    addq $16, %rsp
+  80267a:	48 83 c4 10          	add    $0x10,%rsp
+    # restore utf_regs, save rax again
+    POPA
+  80267e:	4c 8b 3c 24          	mov    (%rsp),%r15
+  802682:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  802687:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  80268c:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  802691:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  802696:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  80269b:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8026a0:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8026a5:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8026aa:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8026af:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8026b4:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8026b9:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8026be:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8026c3:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8026c8:	48 83 c4 78          	add    $0x78,%rsp
+    pushq %rax
+  8026cc:	50                   	push   %rax
+    # 16 utf_rflags
+    #  8 utf_rip
+    #  0 rax
+
+    # load utf_rip
+    movq 8(%rsp), %rax
+  8026cd:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    # save rbx to utf_rip
+    movq %rbx, 8(%rsp)
+  8026d2:	48 89 5c 24 08       	mov    %rbx,0x8(%rsp)
+    # load utf_rsp
+    movq 24(%rsp), %rbx
+  8026d7:	48 8b 5c 24 18       	mov    0x18(%rsp),%rbx
+    # store return address to *utf_stack
+    subq $8, 24(%rsp)
+  8026dc:	48 83 6c 24 18 08    	subq   $0x8,0x18(%rsp)
+    movq %rax, -8(%rbx)
+  8026e2:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    # restore rax and rbx
+    popq %rax
+  8026e6:	58                   	pop    %rax
+    popq %rbx
+  8026e7:	5b                   	pop    %rbx
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+    popfq
+  8026e8:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    popq %rsp
+  8026e9:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8026ea:	c3                   	ret
+
+00000000008026eb <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8026eb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8026f2:	ff ff ff 
+  8026f5:	48 01 f8             	add    %rdi,%rax
+  8026f8:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8026fc:	c3                   	ret
+
+00000000008026fd <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8026fd:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802704:	ff ff ff 
+  802707:	48 01 f8             	add    %rdi,%rax
+  80270a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80270e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802714:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802718:	c3                   	ret
+
+0000000000802719 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802719:	55                   	push   %rbp
+  80271a:	48 89 e5             	mov    %rsp,%rbp
+  80271d:	41 57                	push   %r15
+  80271f:	41 56                	push   %r14
+  802721:	41 55                	push   %r13
+  802723:	41 54                	push   %r12
+  802725:	53                   	push   %rbx
+  802726:	48 83 ec 08          	sub    $0x8,%rsp
+  80272a:	49 89 ff             	mov    %rdi,%r15
+  80272d:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802732:	49 bd 97 36 80 00 00 	movabs $0x803697,%r13
+  802739:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80273c:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802742:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802745:	48 89 df             	mov    %rbx,%rdi
+  802748:	41 ff d5             	call   *%r13
+  80274b:	83 e0 04             	and    $0x4,%eax
+  80274e:	74 17                	je     802767 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802750:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802757:	4c 39 f3             	cmp    %r14,%rbx
+  80275a:	75 e6                	jne    802742 <fd_alloc+0x29>
+  80275c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802762:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802767:	4d 89 27             	mov    %r12,(%r15)
+}
+  80276a:	48 83 c4 08          	add    $0x8,%rsp
+  80276e:	5b                   	pop    %rbx
+  80276f:	41 5c                	pop    %r12
+  802771:	41 5d                	pop    %r13
+  802773:	41 5e                	pop    %r14
+  802775:	41 5f                	pop    %r15
+  802777:	5d                   	pop    %rbp
+  802778:	c3                   	ret
+
+0000000000802779 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802779:	83 ff 1f             	cmp    $0x1f,%edi
+  80277c:	77 39                	ja     8027b7 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80277e:	55                   	push   %rbp
+  80277f:	48 89 e5             	mov    %rsp,%rbp
+  802782:	41 54                	push   %r12
+  802784:	53                   	push   %rbx
+  802785:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802788:	48 63 df             	movslq %edi,%rbx
+  80278b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802792:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802796:	48 89 df             	mov    %rbx,%rdi
+  802799:	48 b8 97 36 80 00 00 	movabs $0x803697,%rax
+  8027a0:	00 00 00 
+  8027a3:	ff d0                	call   *%rax
+  8027a5:	a8 04                	test   $0x4,%al
+  8027a7:	74 14                	je     8027bd <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8027a9:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8027ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027b2:	5b                   	pop    %rbx
+  8027b3:	41 5c                	pop    %r12
+  8027b5:	5d                   	pop    %rbp
+  8027b6:	c3                   	ret
+        return -E_INVAL;
+  8027b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8027bc:	c3                   	ret
+        return -E_INVAL;
+  8027bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027c2:	eb ee                	jmp    8027b2 <fd_lookup+0x39>
+
+00000000008027c4 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8027c4:	55                   	push   %rbp
+  8027c5:	48 89 e5             	mov    %rsp,%rbp
+  8027c8:	41 54                	push   %r12
+  8027ca:	53                   	push   %rbx
+  8027cb:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8027ce:	48 b8 80 45 80 00 00 	movabs $0x804580,%rax
+  8027d5:	00 00 00 
+  8027d8:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  8027df:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8027e2:	39 3b                	cmp    %edi,(%rbx)
+  8027e4:	74 47                	je     80282d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8027e6:	48 83 c0 08          	add    $0x8,%rax
+  8027ea:	48 8b 18             	mov    (%rax),%rbx
+  8027ed:	48 85 db             	test   %rbx,%rbx
+  8027f0:	75 f0                	jne    8027e2 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8027f2:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  8027f9:	00 00 00 
+  8027fc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802802:	89 fa                	mov    %edi,%edx
+  802804:	48 bf f0 44 80 00 00 	movabs $0x8044f0,%rdi
+  80280b:	00 00 00 
+  80280e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802813:	48 b9 f7 0e 80 00 00 	movabs $0x800ef7,%rcx
+  80281a:	00 00 00 
+  80281d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80281f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802824:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802828:	5b                   	pop    %rbx
+  802829:	41 5c                	pop    %r12
+  80282b:	5d                   	pop    %rbp
+  80282c:	c3                   	ret
+            return 0;
+  80282d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802832:	eb f0                	jmp    802824 <dev_lookup+0x60>
+
+0000000000802834 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802834:	55                   	push   %rbp
+  802835:	48 89 e5             	mov    %rsp,%rbp
+  802838:	41 55                	push   %r13
+  80283a:	41 54                	push   %r12
+  80283c:	53                   	push   %rbx
+  80283d:	48 83 ec 18          	sub    $0x18,%rsp
+  802841:	48 89 fb             	mov    %rdi,%rbx
+  802844:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802847:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80284e:	ff ff ff 
+  802851:	48 01 df             	add    %rbx,%rdi
+  802854:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802858:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80285c:	48 b8 79 27 80 00 00 	movabs $0x802779,%rax
+  802863:	00 00 00 
+  802866:	ff d0                	call   *%rax
+  802868:	41 89 c5             	mov    %eax,%r13d
+  80286b:	85 c0                	test   %eax,%eax
+  80286d:	78 06                	js     802875 <fd_close+0x41>
+  80286f:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802873:	74 1a                	je     80288f <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802875:	45 84 e4             	test   %r12b,%r12b
+  802878:	b8 00 00 00 00       	mov    $0x0,%eax
+  80287d:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802881:	44 89 e8             	mov    %r13d,%eax
+  802884:	48 83 c4 18          	add    $0x18,%rsp
+  802888:	5b                   	pop    %rbx
+  802889:	41 5c                	pop    %r12
+  80288b:	41 5d                	pop    %r13
+  80288d:	5d                   	pop    %rbp
+  80288e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80288f:	8b 3b                	mov    (%rbx),%edi
+  802891:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802895:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  80289c:	00 00 00 
+  80289f:	ff d0                	call   *%rax
+  8028a1:	41 89 c5             	mov    %eax,%r13d
+  8028a4:	85 c0                	test   %eax,%eax
+  8028a6:	78 1b                	js     8028c3 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8028a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028ac:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8028b0:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8028b6:	48 85 c0             	test   %rax,%rax
+  8028b9:	74 08                	je     8028c3 <fd_close+0x8f>
+  8028bb:	48 89 df             	mov    %rbx,%rdi
+  8028be:	ff d0                	call   *%rax
+  8028c0:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8028c3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028c8:	48 89 de             	mov    %rbx,%rsi
+  8028cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028d0:	48 b8 98 1e 80 00 00 	movabs $0x801e98,%rax
+  8028d7:	00 00 00 
+  8028da:	ff d0                	call   *%rax
+    return res;
+  8028dc:	eb a3                	jmp    802881 <fd_close+0x4d>
+
+00000000008028de <close>:
+
+int
+close(int fdnum) {
+  8028de:	55                   	push   %rbp
+  8028df:	48 89 e5             	mov    %rsp,%rbp
+  8028e2:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8028e6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8028ea:	48 b8 79 27 80 00 00 	movabs $0x802779,%rax
+  8028f1:	00 00 00 
+  8028f4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028f6:	85 c0                	test   %eax,%eax
+  8028f8:	78 15                	js     80290f <close+0x31>
+
+    return fd_close(fd, 1);
+  8028fa:	be 01 00 00 00       	mov    $0x1,%esi
+  8028ff:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802903:	48 b8 34 28 80 00 00 	movabs $0x802834,%rax
+  80290a:	00 00 00 
+  80290d:	ff d0                	call   *%rax
+}
+  80290f:	c9                   	leave
+  802910:	c3                   	ret
+
+0000000000802911 <close_all>:
+
+void
+close_all(void) {
+  802911:	55                   	push   %rbp
+  802912:	48 89 e5             	mov    %rsp,%rbp
+  802915:	41 54                	push   %r12
+  802917:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802918:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80291d:	49 bc de 28 80 00 00 	movabs $0x8028de,%r12
+  802924:	00 00 00 
+  802927:	89 df                	mov    %ebx,%edi
+  802929:	41 ff d4             	call   *%r12
+  80292c:	83 c3 01             	add    $0x1,%ebx
+  80292f:	83 fb 20             	cmp    $0x20,%ebx
+  802932:	75 f3                	jne    802927 <close_all+0x16>
+}
+  802934:	5b                   	pop    %rbx
+  802935:	41 5c                	pop    %r12
+  802937:	5d                   	pop    %rbp
+  802938:	c3                   	ret
+
+0000000000802939 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802939:	55                   	push   %rbp
+  80293a:	48 89 e5             	mov    %rsp,%rbp
+  80293d:	41 57                	push   %r15
+  80293f:	41 56                	push   %r14
+  802941:	41 55                	push   %r13
+  802943:	41 54                	push   %r12
+  802945:	53                   	push   %rbx
+  802946:	48 83 ec 18          	sub    $0x18,%rsp
+  80294a:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80294d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802951:	48 b8 79 27 80 00 00 	movabs $0x802779,%rax
+  802958:	00 00 00 
+  80295b:	ff d0                	call   *%rax
+  80295d:	89 c3                	mov    %eax,%ebx
+  80295f:	85 c0                	test   %eax,%eax
+  802961:	0f 88 b8 00 00 00    	js     802a1f <dup+0xe6>
+    close(newfdnum);
+  802967:	44 89 e7             	mov    %r12d,%edi
+  80296a:	48 b8 de 28 80 00 00 	movabs $0x8028de,%rax
+  802971:	00 00 00 
+  802974:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802976:	4d 63 ec             	movslq %r12d,%r13
+  802979:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802980:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802984:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802988:	4c 89 ff             	mov    %r15,%rdi
+  80298b:	49 be fd 26 80 00 00 	movabs $0x8026fd,%r14
+  802992:	00 00 00 
+  802995:	41 ff d6             	call   *%r14
+  802998:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80299b:	4c 89 ef             	mov    %r13,%rdi
+  80299e:	41 ff d6             	call   *%r14
+  8029a1:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8029a4:	48 89 df             	mov    %rbx,%rdi
+  8029a7:	48 b8 97 36 80 00 00 	movabs $0x803697,%rax
+  8029ae:	00 00 00 
+  8029b1:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8029b3:	a8 04                	test   $0x4,%al
+  8029b5:	74 2b                	je     8029e2 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8029b7:	41 89 c1             	mov    %eax,%r9d
+  8029ba:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8029c0:	4c 89 f1             	mov    %r14,%rcx
+  8029c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029c8:	48 89 de             	mov    %rbx,%rsi
+  8029cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029d0:	48 b8 33 1e 80 00 00 	movabs $0x801e33,%rax
+  8029d7:	00 00 00 
+  8029da:	ff d0                	call   *%rax
+  8029dc:	89 c3                	mov    %eax,%ebx
+  8029de:	85 c0                	test   %eax,%eax
+  8029e0:	78 4e                	js     802a30 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8029e2:	4c 89 ff             	mov    %r15,%rdi
+  8029e5:	48 b8 97 36 80 00 00 	movabs $0x803697,%rax
+  8029ec:	00 00 00 
+  8029ef:	ff d0                	call   *%rax
+  8029f1:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8029f4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8029fa:	4c 89 e9             	mov    %r13,%rcx
+  8029fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a02:	4c 89 fe             	mov    %r15,%rsi
+  802a05:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a0a:	48 b8 33 1e 80 00 00 	movabs $0x801e33,%rax
+  802a11:	00 00 00 
+  802a14:	ff d0                	call   *%rax
+  802a16:	89 c3                	mov    %eax,%ebx
+  802a18:	85 c0                	test   %eax,%eax
+  802a1a:	78 14                	js     802a30 <dup+0xf7>
+
+    return newfdnum;
+  802a1c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802a1f:	89 d8                	mov    %ebx,%eax
+  802a21:	48 83 c4 18          	add    $0x18,%rsp
+  802a25:	5b                   	pop    %rbx
+  802a26:	41 5c                	pop    %r12
+  802a28:	41 5d                	pop    %r13
+  802a2a:	41 5e                	pop    %r14
+  802a2c:	41 5f                	pop    %r15
+  802a2e:	5d                   	pop    %rbp
+  802a2f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802a30:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a35:	4c 89 ee             	mov    %r13,%rsi
+  802a38:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a3d:	49 bc 98 1e 80 00 00 	movabs $0x801e98,%r12
+  802a44:	00 00 00 
+  802a47:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802a4a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a4f:	4c 89 f6             	mov    %r14,%rsi
+  802a52:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a57:	41 ff d4             	call   *%r12
+    return res;
+  802a5a:	eb c3                	jmp    802a1f <dup+0xe6>
+
+0000000000802a5c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802a5c:	55                   	push   %rbp
+  802a5d:	48 89 e5             	mov    %rsp,%rbp
+  802a60:	41 56                	push   %r14
+  802a62:	41 55                	push   %r13
+  802a64:	41 54                	push   %r12
+  802a66:	53                   	push   %rbx
+  802a67:	48 83 ec 10          	sub    $0x10,%rsp
+  802a6b:	89 fb                	mov    %edi,%ebx
+  802a6d:	49 89 f4             	mov    %rsi,%r12
+  802a70:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a73:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802a77:	48 b8 79 27 80 00 00 	movabs $0x802779,%rax
+  802a7e:	00 00 00 
+  802a81:	ff d0                	call   *%rax
+  802a83:	85 c0                	test   %eax,%eax
+  802a85:	78 4c                	js     802ad3 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a87:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802a8b:	41 8b 3e             	mov    (%r14),%edi
+  802a8e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802a92:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  802a99:	00 00 00 
+  802a9c:	ff d0                	call   *%rax
+  802a9e:	85 c0                	test   %eax,%eax
+  802aa0:	78 35                	js     802ad7 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802aa2:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802aa6:	83 e0 03             	and    $0x3,%eax
+  802aa9:	83 f8 01             	cmp    $0x1,%eax
+  802aac:	74 2d                	je     802adb <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802aae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ab2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802ab6:	48 85 c0             	test   %rax,%rax
+  802ab9:	74 56                	je     802b11 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802abb:	4c 89 ea             	mov    %r13,%rdx
+  802abe:	4c 89 e6             	mov    %r12,%rsi
+  802ac1:	4c 89 f7             	mov    %r14,%rdi
+  802ac4:	ff d0                	call   *%rax
+}
+  802ac6:	48 83 c4 10          	add    $0x10,%rsp
+  802aca:	5b                   	pop    %rbx
+  802acb:	41 5c                	pop    %r12
+  802acd:	41 5d                	pop    %r13
+  802acf:	41 5e                	pop    %r14
+  802ad1:	5d                   	pop    %rbp
+  802ad2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802ad3:	48 98                	cltq
+  802ad5:	eb ef                	jmp    802ac6 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802ad7:	48 98                	cltq
+  802ad9:	eb eb                	jmp    802ac6 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802adb:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  802ae2:	00 00 00 
+  802ae5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802aeb:	89 da                	mov    %ebx,%edx
+  802aed:	48 bf 31 45 80 00 00 	movabs $0x804531,%rdi
+  802af4:	00 00 00 
+  802af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802afc:	48 b9 f7 0e 80 00 00 	movabs $0x800ef7,%rcx
+  802b03:	00 00 00 
+  802b06:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802b08:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802b0f:	eb b5                	jmp    802ac6 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802b11:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802b18:	eb ac                	jmp    802ac6 <read+0x6a>
+
+0000000000802b1a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802b1a:	55                   	push   %rbp
+  802b1b:	48 89 e5             	mov    %rsp,%rbp
+  802b1e:	41 57                	push   %r15
+  802b20:	41 56                	push   %r14
+  802b22:	41 55                	push   %r13
+  802b24:	41 54                	push   %r12
+  802b26:	53                   	push   %rbx
+  802b27:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802b2b:	48 85 d2             	test   %rdx,%rdx
+  802b2e:	74 54                	je     802b84 <readn+0x6a>
+  802b30:	41 89 fd             	mov    %edi,%r13d
+  802b33:	49 89 f6             	mov    %rsi,%r14
+  802b36:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802b39:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802b3e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802b43:	49 bf 5c 2a 80 00 00 	movabs $0x802a5c,%r15
+  802b4a:	00 00 00 
+  802b4d:	4c 89 e2             	mov    %r12,%rdx
+  802b50:	48 29 f2             	sub    %rsi,%rdx
+  802b53:	4c 01 f6             	add    %r14,%rsi
+  802b56:	44 89 ef             	mov    %r13d,%edi
+  802b59:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802b5c:	85 c0                	test   %eax,%eax
+  802b5e:	78 20                	js     802b80 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802b60:	01 c3                	add    %eax,%ebx
+  802b62:	85 c0                	test   %eax,%eax
+  802b64:	74 08                	je     802b6e <readn+0x54>
+  802b66:	48 63 f3             	movslq %ebx,%rsi
+  802b69:	4c 39 e6             	cmp    %r12,%rsi
+  802b6c:	72 df                	jb     802b4d <readn+0x33>
+    }
+    return res;
+  802b6e:	48 63 c3             	movslq %ebx,%rax
+}
+  802b71:	48 83 c4 08          	add    $0x8,%rsp
+  802b75:	5b                   	pop    %rbx
+  802b76:	41 5c                	pop    %r12
+  802b78:	41 5d                	pop    %r13
+  802b7a:	41 5e                	pop    %r14
+  802b7c:	41 5f                	pop    %r15
+  802b7e:	5d                   	pop    %rbp
+  802b7f:	c3                   	ret
+        if (inc < 0) return inc;
+  802b80:	48 98                	cltq
+  802b82:	eb ed                	jmp    802b71 <readn+0x57>
+    int inc = 1, res = 0;
+  802b84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b89:	eb e3                	jmp    802b6e <readn+0x54>
+
+0000000000802b8b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802b8b:	55                   	push   %rbp
+  802b8c:	48 89 e5             	mov    %rsp,%rbp
+  802b8f:	41 56                	push   %r14
+  802b91:	41 55                	push   %r13
+  802b93:	41 54                	push   %r12
+  802b95:	53                   	push   %rbx
+  802b96:	48 83 ec 10          	sub    $0x10,%rsp
+  802b9a:	89 fb                	mov    %edi,%ebx
+  802b9c:	49 89 f4             	mov    %rsi,%r12
+  802b9f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802ba2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802ba6:	48 b8 79 27 80 00 00 	movabs $0x802779,%rax
+  802bad:	00 00 00 
+  802bb0:	ff d0                	call   *%rax
+  802bb2:	85 c0                	test   %eax,%eax
+  802bb4:	78 47                	js     802bfd <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802bb6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802bba:	41 8b 3e             	mov    (%r14),%edi
+  802bbd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802bc1:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  802bc8:	00 00 00 
+  802bcb:	ff d0                	call   *%rax
+  802bcd:	85 c0                	test   %eax,%eax
+  802bcf:	78 30                	js     802c01 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802bd1:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802bd6:	74 2d                	je     802c05 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802bd8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802bdc:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802be0:	48 85 c0             	test   %rax,%rax
+  802be3:	74 56                	je     802c3b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802be5:	4c 89 ea             	mov    %r13,%rdx
+  802be8:	4c 89 e6             	mov    %r12,%rsi
+  802beb:	4c 89 f7             	mov    %r14,%rdi
+  802bee:	ff d0                	call   *%rax
+}
+  802bf0:	48 83 c4 10          	add    $0x10,%rsp
+  802bf4:	5b                   	pop    %rbx
+  802bf5:	41 5c                	pop    %r12
+  802bf7:	41 5d                	pop    %r13
+  802bf9:	41 5e                	pop    %r14
+  802bfb:	5d                   	pop    %rbp
+  802bfc:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802bfd:	48 98                	cltq
+  802bff:	eb ef                	jmp    802bf0 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802c01:	48 98                	cltq
+  802c03:	eb eb                	jmp    802bf0 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802c05:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  802c0c:	00 00 00 
+  802c0f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802c15:	89 da                	mov    %ebx,%edx
+  802c17:	48 bf 4d 45 80 00 00 	movabs $0x80454d,%rdi
+  802c1e:	00 00 00 
+  802c21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c26:	48 b9 f7 0e 80 00 00 	movabs $0x800ef7,%rcx
+  802c2d:	00 00 00 
+  802c30:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802c32:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802c39:	eb b5                	jmp    802bf0 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802c3b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802c42:	eb ac                	jmp    802bf0 <write+0x65>
+
+0000000000802c44 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802c44:	55                   	push   %rbp
+  802c45:	48 89 e5             	mov    %rsp,%rbp
+  802c48:	53                   	push   %rbx
+  802c49:	48 83 ec 18          	sub    $0x18,%rsp
+  802c4d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c4f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802c53:	48 b8 79 27 80 00 00 	movabs $0x802779,%rax
+  802c5a:	00 00 00 
+  802c5d:	ff d0                	call   *%rax
+  802c5f:	85 c0                	test   %eax,%eax
+  802c61:	78 0c                	js     802c6f <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802c63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c67:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c6f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c73:	c9                   	leave
+  802c74:	c3                   	ret
+
+0000000000802c75 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802c75:	55                   	push   %rbp
+  802c76:	48 89 e5             	mov    %rsp,%rbp
+  802c79:	41 55                	push   %r13
+  802c7b:	41 54                	push   %r12
+  802c7d:	53                   	push   %rbx
+  802c7e:	48 83 ec 18          	sub    $0x18,%rsp
+  802c82:	89 fb                	mov    %edi,%ebx
+  802c84:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c87:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802c8b:	48 b8 79 27 80 00 00 	movabs $0x802779,%rax
+  802c92:	00 00 00 
+  802c95:	ff d0                	call   *%rax
+  802c97:	85 c0                	test   %eax,%eax
+  802c99:	78 38                	js     802cd3 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802c9b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802c9f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802ca3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802ca7:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  802cae:	00 00 00 
+  802cb1:	ff d0                	call   *%rax
+  802cb3:	85 c0                	test   %eax,%eax
+  802cb5:	78 1c                	js     802cd3 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802cb7:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802cbc:	74 20                	je     802cde <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802cbe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cc2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802cc6:	48 85 c0             	test   %rax,%rax
+  802cc9:	74 47                	je     802d12 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802ccb:	44 89 e6             	mov    %r12d,%esi
+  802cce:	4c 89 ef             	mov    %r13,%rdi
+  802cd1:	ff d0                	call   *%rax
+}
+  802cd3:	48 83 c4 18          	add    $0x18,%rsp
+  802cd7:	5b                   	pop    %rbx
+  802cd8:	41 5c                	pop    %r12
+  802cda:	41 5d                	pop    %r13
+  802cdc:	5d                   	pop    %rbp
+  802cdd:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802cde:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  802ce5:	00 00 00 
+  802ce8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802cee:	89 da                	mov    %ebx,%edx
+  802cf0:	48 bf 10 45 80 00 00 	movabs $0x804510,%rdi
+  802cf7:	00 00 00 
+  802cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cff:	48 b9 f7 0e 80 00 00 	movabs $0x800ef7,%rcx
+  802d06:	00 00 00 
+  802d09:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802d0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d10:	eb c1                	jmp    802cd3 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802d12:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802d17:	eb ba                	jmp    802cd3 <ftruncate+0x5e>
+
+0000000000802d19 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802d19:	55                   	push   %rbp
+  802d1a:	48 89 e5             	mov    %rsp,%rbp
+  802d1d:	41 54                	push   %r12
+  802d1f:	53                   	push   %rbx
+  802d20:	48 83 ec 10          	sub    $0x10,%rsp
+  802d24:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802d27:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802d2b:	48 b8 79 27 80 00 00 	movabs $0x802779,%rax
+  802d32:	00 00 00 
+  802d35:	ff d0                	call   *%rax
+  802d37:	85 c0                	test   %eax,%eax
+  802d39:	78 4e                	js     802d89 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802d3b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802d3f:	41 8b 3c 24          	mov    (%r12),%edi
+  802d43:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802d47:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  802d4e:	00 00 00 
+  802d51:	ff d0                	call   *%rax
+  802d53:	85 c0                	test   %eax,%eax
+  802d55:	78 32                	js     802d89 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802d57:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d5b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802d60:	74 30                	je     802d92 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802d62:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802d65:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802d6c:	00 00 00 
+    stat->st_isdir = 0;
+  802d6f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802d76:	00 00 00 
+    stat->st_dev = dev;
+  802d79:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802d80:	48 89 de             	mov    %rbx,%rsi
+  802d83:	4c 89 e7             	mov    %r12,%rdi
+  802d86:	ff 50 28             	call   *0x28(%rax)
+}
+  802d89:	48 83 c4 10          	add    $0x10,%rsp
+  802d8d:	5b                   	pop    %rbx
+  802d8e:	41 5c                	pop    %r12
+  802d90:	5d                   	pop    %rbp
+  802d91:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802d92:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802d97:	eb f0                	jmp    802d89 <fstat+0x70>
+
+0000000000802d99 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802d99:	55                   	push   %rbp
+  802d9a:	48 89 e5             	mov    %rsp,%rbp
+  802d9d:	41 54                	push   %r12
+  802d9f:	53                   	push   %rbx
+  802da0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802da3:	be 00 00 00 00       	mov    $0x0,%esi
+  802da8:	48 b8 1a 30 80 00 00 	movabs $0x80301a,%rax
+  802daf:	00 00 00 
+  802db2:	ff d0                	call   *%rax
+  802db4:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802db6:	85 c0                	test   %eax,%eax
+  802db8:	78 25                	js     802ddf <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802dba:	4c 89 e6             	mov    %r12,%rsi
+  802dbd:	89 c7                	mov    %eax,%edi
+  802dbf:	48 b8 19 2d 80 00 00 	movabs $0x802d19,%rax
+  802dc6:	00 00 00 
+  802dc9:	ff d0                	call   *%rax
+  802dcb:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802dce:	89 df                	mov    %ebx,%edi
+  802dd0:	48 b8 de 28 80 00 00 	movabs $0x8028de,%rax
+  802dd7:	00 00 00 
+  802dda:	ff d0                	call   *%rax
+
+    return res;
+  802ddc:	44 89 e3             	mov    %r12d,%ebx
+}
+  802ddf:	89 d8                	mov    %ebx,%eax
+  802de1:	5b                   	pop    %rbx
+  802de2:	41 5c                	pop    %r12
+  802de4:	5d                   	pop    %rbp
+  802de5:	c3                   	ret
+
+0000000000802de6 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802de6:	55                   	push   %rbp
+  802de7:	48 89 e5             	mov    %rsp,%rbp
+  802dea:	41 54                	push   %r12
+  802dec:	53                   	push   %rbx
+  802ded:	48 83 ec 10          	sub    $0x10,%rsp
+  802df1:	41 89 fc             	mov    %edi,%r12d
+  802df4:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802df7:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802dfe:	00 00 00 
+  802e01:	83 38 00             	cmpl   $0x0,(%rax)
+  802e04:	74 5e                	je     802e64 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802e06:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802e0c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802e11:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802e18:	00 00 00 
+  802e1b:	44 89 e6             	mov    %r12d,%esi
+  802e1e:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802e25:	00 00 00 
+  802e28:	8b 38                	mov    (%rax),%edi
+  802e2a:	48 b8 30 3c 80 00 00 	movabs $0x803c30,%rax
+  802e31:	00 00 00 
+  802e34:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802e36:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802e3d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802e3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e43:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802e47:	48 89 de             	mov    %rbx,%rsi
+  802e4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e4f:	48 b8 9b 3b 80 00 00 	movabs $0x803b9b,%rax
+  802e56:	00 00 00 
+  802e59:	ff d0                	call   *%rax
+}
+  802e5b:	48 83 c4 10          	add    $0x10,%rsp
+  802e5f:	5b                   	pop    %rbx
+  802e60:	41 5c                	pop    %r12
+  802e62:	5d                   	pop    %rbp
+  802e63:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802e64:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e69:	48 b8 d0 3c 80 00 00 	movabs $0x803cd0,%rax
+  802e70:	00 00 00 
+  802e73:	ff d0                	call   *%rax
+  802e75:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802e7c:	00 00 
+  802e7e:	eb 86                	jmp    802e06 <fsipc+0x20>
+
+0000000000802e80 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802e80:	55                   	push   %rbp
+  802e81:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802e84:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802e8b:	00 00 00 
+  802e8e:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802e91:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802e93:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802e96:	be 00 00 00 00       	mov    $0x0,%esi
+  802e9b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ea0:	48 b8 e6 2d 80 00 00 	movabs $0x802de6,%rax
+  802ea7:	00 00 00 
+  802eaa:	ff d0                	call   *%rax
+}
+  802eac:	5d                   	pop    %rbp
+  802ead:	c3                   	ret
+
+0000000000802eae <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802eae:	55                   	push   %rbp
+  802eaf:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802eb2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802eb5:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802ebc:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802ebe:	be 00 00 00 00       	mov    $0x0,%esi
+  802ec3:	bf 06 00 00 00       	mov    $0x6,%edi
+  802ec8:	48 b8 e6 2d 80 00 00 	movabs $0x802de6,%rax
+  802ecf:	00 00 00 
+  802ed2:	ff d0                	call   *%rax
+}
+  802ed4:	5d                   	pop    %rbp
+  802ed5:	c3                   	ret
+
+0000000000802ed6 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802ed6:	55                   	push   %rbp
+  802ed7:	48 89 e5             	mov    %rsp,%rbp
+  802eda:	41 54                	push   %r12
+  802edc:	53                   	push   %rbx
+  802edd:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802ee0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802ee3:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802eea:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802eec:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef1:	bf 05 00 00 00       	mov    $0x5,%edi
+  802ef6:	48 b8 e6 2d 80 00 00 	movabs $0x802de6,%rax
+  802efd:	00 00 00 
+  802f00:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f02:	85 c0                	test   %eax,%eax
+  802f04:	78 3d                	js     802f43 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802f06:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802f0d:	00 00 00 
+  802f10:	4c 89 e6             	mov    %r12,%rsi
+  802f13:	48 89 df             	mov    %rbx,%rdi
+  802f16:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  802f1d:	00 00 00 
+  802f20:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802f22:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802f29:	00 
+  802f2a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802f30:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802f37:	00 
+  802f38:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802f3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f43:	5b                   	pop    %rbx
+  802f44:	41 5c                	pop    %r12
+  802f46:	5d                   	pop    %rbp
+  802f47:	c3                   	ret
+
+0000000000802f48 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802f48:	55                   	push   %rbp
+  802f49:	48 89 e5             	mov    %rsp,%rbp
+  802f4c:	41 54                	push   %r12
+  802f4e:	53                   	push   %rbx
+  802f4f:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  802f52:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802f57:	48 39 c2             	cmp    %rax,%rdx
+  802f5a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802f5e:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802f61:	48 89 c2             	mov    %rax,%rdx
+  802f64:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802f6b:	00 00 00 
+  802f6e:	48 b8 7d 1a 80 00 00 	movabs $0x801a7d,%rax
+  802f75:	00 00 00 
+  802f78:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802f7a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802f81:	00 00 00 
+  802f84:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802f89:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802f8b:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  802f8f:	be 00 00 00 00       	mov    $0x0,%esi
+  802f94:	bf 04 00 00 00       	mov    $0x4,%edi
+  802f99:	48 b8 e6 2d 80 00 00 	movabs $0x802de6,%rax
+  802fa0:	00 00 00 
+  802fa3:	ff d0                	call   *%rax
+  802fa5:	48 98                	cltq
+}
+  802fa7:	5b                   	pop    %rbx
+  802fa8:	41 5c                	pop    %r12
+  802faa:	5d                   	pop    %rbp
+  802fab:	c3                   	ret
+
+0000000000802fac <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802fac:	55                   	push   %rbp
+  802fad:	48 89 e5             	mov    %rsp,%rbp
+  802fb0:	41 54                	push   %r12
+  802fb2:	53                   	push   %rbx
+  802fb3:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802fb6:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802fbd:	00 00 00 
+  802fc0:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802fc3:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  802fc5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802fca:	48 39 ca             	cmp    %rcx,%rdx
+  802fcd:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  802fd1:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  802fd5:	be 00 00 00 00       	mov    $0x0,%esi
+  802fda:	bf 03 00 00 00       	mov    $0x3,%edi
+  802fdf:	48 b8 e6 2d 80 00 00 	movabs $0x802de6,%rax
+  802fe6:	00 00 00 
+  802fe9:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802feb:	85 c0                	test   %eax,%eax
+  802fed:	78 27                	js     803016 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802fef:	48 63 d8             	movslq %eax,%rbx
+  802ff2:	48 89 da             	mov    %rbx,%rdx
+  802ff5:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  802ffc:	00 00 00 
+  802fff:	4c 89 e7             	mov    %r12,%rdi
+  803002:	48 b8 7d 1a 80 00 00 	movabs $0x801a7d,%rax
+  803009:	00 00 00 
+  80300c:	ff d0                	call   *%rax
+    return bytes_read;
+  80300e:	48 89 d8             	mov    %rbx,%rax
+}
+  803011:	5b                   	pop    %rbx
+  803012:	41 5c                	pop    %r12
+  803014:	5d                   	pop    %rbp
+  803015:	c3                   	ret
+        return bytes_read;
+  803016:	48 98                	cltq
+  803018:	eb f7                	jmp    803011 <devfile_read+0x65>
+
+000000000080301a <open>:
+open(const char *path, int mode) {
+  80301a:	55                   	push   %rbp
+  80301b:	48 89 e5             	mov    %rsp,%rbp
+  80301e:	41 55                	push   %r13
+  803020:	41 54                	push   %r12
+  803022:	53                   	push   %rbx
+  803023:	48 83 ec 18          	sub    $0x18,%rsp
+  803027:	49 89 fc             	mov    %rdi,%r12
+  80302a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80302d:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  803034:	00 00 00 
+  803037:	ff d0                	call   *%rax
+  803039:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80303f:	0f 87 8a 00 00 00    	ja     8030cf <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803045:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803049:	48 b8 19 27 80 00 00 	movabs $0x802719,%rax
+  803050:	00 00 00 
+  803053:	ff d0                	call   *%rax
+  803055:	89 c3                	mov    %eax,%ebx
+  803057:	85 c0                	test   %eax,%eax
+  803059:	78 50                	js     8030ab <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80305b:	4c 89 e6             	mov    %r12,%rsi
+  80305e:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  803065:	00 00 00 
+  803068:	48 89 df             	mov    %rbx,%rdi
+  80306b:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  803072:	00 00 00 
+  803075:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803077:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80307e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803082:	bf 01 00 00 00       	mov    $0x1,%edi
+  803087:	48 b8 e6 2d 80 00 00 	movabs $0x802de6,%rax
+  80308e:	00 00 00 
+  803091:	ff d0                	call   *%rax
+  803093:	89 c3                	mov    %eax,%ebx
+  803095:	85 c0                	test   %eax,%eax
+  803097:	78 1f                	js     8030b8 <open+0x9e>
+    return fd2num(fd);
+  803099:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80309d:	48 b8 eb 26 80 00 00 	movabs $0x8026eb,%rax
+  8030a4:	00 00 00 
+  8030a7:	ff d0                	call   *%rax
+  8030a9:	89 c3                	mov    %eax,%ebx
+}
+  8030ab:	89 d8                	mov    %ebx,%eax
+  8030ad:	48 83 c4 18          	add    $0x18,%rsp
+  8030b1:	5b                   	pop    %rbx
+  8030b2:	41 5c                	pop    %r12
+  8030b4:	41 5d                	pop    %r13
+  8030b6:	5d                   	pop    %rbp
+  8030b7:	c3                   	ret
+        fd_close(fd, 0);
+  8030b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8030bd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030c1:	48 b8 34 28 80 00 00 	movabs $0x802834,%rax
+  8030c8:	00 00 00 
+  8030cb:	ff d0                	call   *%rax
+        return res;
+  8030cd:	eb dc                	jmp    8030ab <open+0x91>
+        return -E_BAD_PATH;
+  8030cf:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8030d4:	eb d5                	jmp    8030ab <open+0x91>
+
+00000000008030d6 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8030d6:	55                   	push   %rbp
+  8030d7:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8030da:	be 00 00 00 00       	mov    $0x0,%esi
+  8030df:	bf 08 00 00 00       	mov    $0x8,%edi
+  8030e4:	48 b8 e6 2d 80 00 00 	movabs $0x802de6,%rax
+  8030eb:	00 00 00 
+  8030ee:	ff d0                	call   *%rax
+}
+  8030f0:	5d                   	pop    %rbp
+  8030f1:	c3                   	ret
+
+00000000008030f2 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8030f2:	55                   	push   %rbp
+  8030f3:	48 89 e5             	mov    %rsp,%rbp
+  8030f6:	41 54                	push   %r12
+  8030f8:	53                   	push   %rbx
+  8030f9:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8030fc:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  803103:	00 00 00 
+  803106:	ff d0                	call   *%rax
+  803108:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80310b:	48 be a0 45 80 00 00 	movabs $0x8045a0,%rsi
+  803112:	00 00 00 
+  803115:	48 89 df             	mov    %rbx,%rdi
+  803118:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  80311f:	00 00 00 
+  803122:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803124:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803129:	41 2b 04 24          	sub    (%r12),%eax
+  80312d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803133:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80313a:	00 00 00 
+    stat->st_dev = &devpipe;
+  80313d:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  803144:	00 00 00 
+  803147:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80314e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803153:	5b                   	pop    %rbx
+  803154:	41 5c                	pop    %r12
+  803156:	5d                   	pop    %rbp
+  803157:	c3                   	ret
+
+0000000000803158 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803158:	55                   	push   %rbp
+  803159:	48 89 e5             	mov    %rsp,%rbp
+  80315c:	41 54                	push   %r12
+  80315e:	53                   	push   %rbx
+  80315f:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803162:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803167:	48 89 fe             	mov    %rdi,%rsi
+  80316a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80316f:	49 bc 98 1e 80 00 00 	movabs $0x801e98,%r12
+  803176:	00 00 00 
+  803179:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80317c:	48 89 df             	mov    %rbx,%rdi
+  80317f:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  803186:	00 00 00 
+  803189:	ff d0                	call   *%rax
+  80318b:	48 89 c6             	mov    %rax,%rsi
+  80318e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803193:	bf 00 00 00 00       	mov    $0x0,%edi
+  803198:	41 ff d4             	call   *%r12
+}
+  80319b:	5b                   	pop    %rbx
+  80319c:	41 5c                	pop    %r12
+  80319e:	5d                   	pop    %rbp
+  80319f:	c3                   	ret
+
+00000000008031a0 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8031a0:	55                   	push   %rbp
+  8031a1:	48 89 e5             	mov    %rsp,%rbp
+  8031a4:	41 57                	push   %r15
+  8031a6:	41 56                	push   %r14
+  8031a8:	41 55                	push   %r13
+  8031aa:	41 54                	push   %r12
+  8031ac:	53                   	push   %rbx
+  8031ad:	48 83 ec 18          	sub    $0x18,%rsp
+  8031b1:	49 89 fc             	mov    %rdi,%r12
+  8031b4:	49 89 f5             	mov    %rsi,%r13
+  8031b7:	49 89 d7             	mov    %rdx,%r15
+  8031ba:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8031be:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  8031c5:	00 00 00 
+  8031c8:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8031ca:	4d 85 ff             	test   %r15,%r15
+  8031cd:	0f 84 af 00 00 00    	je     803282 <devpipe_write+0xe2>
+  8031d3:	48 89 c3             	mov    %rax,%rbx
+  8031d6:	4c 89 f8             	mov    %r15,%rax
+  8031d9:	4d 89 ef             	mov    %r13,%r15
+  8031dc:	4c 01 e8             	add    %r13,%rax
+  8031df:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8031e3:	49 bd a0 1d 80 00 00 	movabs $0x801da0,%r13
+  8031ea:	00 00 00 
+            sys_yield();
+  8031ed:	49 be 3d 1d 80 00 00 	movabs $0x801d3d,%r14
+  8031f4:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8031f7:	8b 73 04             	mov    0x4(%rbx),%esi
+  8031fa:	48 63 ce             	movslq %esi,%rcx
+  8031fd:	48 63 03             	movslq (%rbx),%rax
+  803200:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803206:	48 39 c1             	cmp    %rax,%rcx
+  803209:	72 2e                	jb     803239 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80320b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803210:	48 89 da             	mov    %rbx,%rdx
+  803213:	be 00 10 00 00       	mov    $0x1000,%esi
+  803218:	4c 89 e7             	mov    %r12,%rdi
+  80321b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80321e:	85 c0                	test   %eax,%eax
+  803220:	74 66                	je     803288 <devpipe_write+0xe8>
+            sys_yield();
+  803222:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803225:	8b 73 04             	mov    0x4(%rbx),%esi
+  803228:	48 63 ce             	movslq %esi,%rcx
+  80322b:	48 63 03             	movslq (%rbx),%rax
+  80322e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803234:	48 39 c1             	cmp    %rax,%rcx
+  803237:	73 d2                	jae    80320b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803239:	41 0f b6 3f          	movzbl (%r15),%edi
+  80323d:	48 89 ca             	mov    %rcx,%rdx
+  803240:	48 c1 ea 03          	shr    $0x3,%rdx
+  803244:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80324b:	08 10 20 
+  80324e:	48 f7 e2             	mul    %rdx
+  803251:	48 c1 ea 06          	shr    $0x6,%rdx
+  803255:	48 89 d0             	mov    %rdx,%rax
+  803258:	48 c1 e0 09          	shl    $0x9,%rax
+  80325c:	48 29 d0             	sub    %rdx,%rax
+  80325f:	48 c1 e0 03          	shl    $0x3,%rax
+  803263:	48 29 c1             	sub    %rax,%rcx
+  803266:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80326b:	83 c6 01             	add    $0x1,%esi
+  80326e:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803271:	49 83 c7 01          	add    $0x1,%r15
+  803275:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803279:	49 39 c7             	cmp    %rax,%r15
+  80327c:	0f 85 75 ff ff ff    	jne    8031f7 <devpipe_write+0x57>
+    return n;
+  803282:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803286:	eb 05                	jmp    80328d <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803288:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80328d:	48 83 c4 18          	add    $0x18,%rsp
+  803291:	5b                   	pop    %rbx
+  803292:	41 5c                	pop    %r12
+  803294:	41 5d                	pop    %r13
+  803296:	41 5e                	pop    %r14
+  803298:	41 5f                	pop    %r15
+  80329a:	5d                   	pop    %rbp
+  80329b:	c3                   	ret
+
+000000000080329c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80329c:	55                   	push   %rbp
+  80329d:	48 89 e5             	mov    %rsp,%rbp
+  8032a0:	41 57                	push   %r15
+  8032a2:	41 56                	push   %r14
+  8032a4:	41 55                	push   %r13
+  8032a6:	41 54                	push   %r12
+  8032a8:	53                   	push   %rbx
+  8032a9:	48 83 ec 18          	sub    $0x18,%rsp
+  8032ad:	49 89 fc             	mov    %rdi,%r12
+  8032b0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8032b4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8032b8:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  8032bf:	00 00 00 
+  8032c2:	ff d0                	call   *%rax
+  8032c4:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8032c7:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8032cd:	49 bd a0 1d 80 00 00 	movabs $0x801da0,%r13
+  8032d4:	00 00 00 
+            sys_yield();
+  8032d7:	49 be 3d 1d 80 00 00 	movabs $0x801d3d,%r14
+  8032de:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8032e1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8032e6:	74 7d                	je     803365 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8032e8:	8b 03                	mov    (%rbx),%eax
+  8032ea:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8032ed:	75 26                	jne    803315 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8032ef:	4d 85 ff             	test   %r15,%r15
+  8032f2:	75 77                	jne    80336b <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8032f4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8032f9:	48 89 da             	mov    %rbx,%rdx
+  8032fc:	be 00 10 00 00       	mov    $0x1000,%esi
+  803301:	4c 89 e7             	mov    %r12,%rdi
+  803304:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803307:	85 c0                	test   %eax,%eax
+  803309:	74 72                	je     80337d <devpipe_read+0xe1>
+            sys_yield();
+  80330b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80330e:	8b 03                	mov    (%rbx),%eax
+  803310:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803313:	74 df                	je     8032f4 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803315:	48 63 c8             	movslq %eax,%rcx
+  803318:	48 89 ca             	mov    %rcx,%rdx
+  80331b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80331f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803326:	08 10 20 
+  803329:	48 89 d0             	mov    %rdx,%rax
+  80332c:	48 f7 e6             	mul    %rsi
+  80332f:	48 c1 ea 06          	shr    $0x6,%rdx
+  803333:	48 89 d0             	mov    %rdx,%rax
+  803336:	48 c1 e0 09          	shl    $0x9,%rax
+  80333a:	48 29 d0             	sub    %rdx,%rax
+  80333d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803344:	00 
+  803345:	48 89 c8             	mov    %rcx,%rax
+  803348:	48 29 d0             	sub    %rdx,%rax
+  80334b:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803350:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803354:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803358:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80335b:	49 83 c7 01          	add    $0x1,%r15
+  80335f:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803363:	75 83                	jne    8032e8 <devpipe_read+0x4c>
+    return n;
+  803365:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803369:	eb 03                	jmp    80336e <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80336b:	4c 89 f8             	mov    %r15,%rax
+}
+  80336e:	48 83 c4 18          	add    $0x18,%rsp
+  803372:	5b                   	pop    %rbx
+  803373:	41 5c                	pop    %r12
+  803375:	41 5d                	pop    %r13
+  803377:	41 5e                	pop    %r14
+  803379:	41 5f                	pop    %r15
+  80337b:	5d                   	pop    %rbp
+  80337c:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80337d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803382:	eb ea                	jmp    80336e <devpipe_read+0xd2>
+
+0000000000803384 <pipe>:
+pipe(int pfd[2]) {
+  803384:	55                   	push   %rbp
+  803385:	48 89 e5             	mov    %rsp,%rbp
+  803388:	41 55                	push   %r13
+  80338a:	41 54                	push   %r12
+  80338c:	53                   	push   %rbx
+  80338d:	48 83 ec 18          	sub    $0x18,%rsp
+  803391:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803394:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803398:	48 b8 19 27 80 00 00 	movabs $0x802719,%rax
+  80339f:	00 00 00 
+  8033a2:	ff d0                	call   *%rax
+  8033a4:	89 c3                	mov    %eax,%ebx
+  8033a6:	85 c0                	test   %eax,%eax
+  8033a8:	0f 88 a0 01 00 00    	js     80354e <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8033ae:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8033b3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033b8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8033bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033c1:	48 b8 cc 1d 80 00 00 	movabs $0x801dcc,%rax
+  8033c8:	00 00 00 
+  8033cb:	ff d0                	call   *%rax
+  8033cd:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8033cf:	85 c0                	test   %eax,%eax
+  8033d1:	0f 88 77 01 00 00    	js     80354e <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8033d7:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8033db:	48 b8 19 27 80 00 00 	movabs $0x802719,%rax
+  8033e2:	00 00 00 
+  8033e5:	ff d0                	call   *%rax
+  8033e7:	89 c3                	mov    %eax,%ebx
+  8033e9:	85 c0                	test   %eax,%eax
+  8033eb:	0f 88 43 01 00 00    	js     803534 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8033f1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8033f6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033fb:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8033ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  803404:	48 b8 cc 1d 80 00 00 	movabs $0x801dcc,%rax
+  80340b:	00 00 00 
+  80340e:	ff d0                	call   *%rax
+  803410:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803412:	85 c0                	test   %eax,%eax
+  803414:	0f 88 1a 01 00 00    	js     803534 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80341a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80341e:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  803425:	00 00 00 
+  803428:	ff d0                	call   *%rax
+  80342a:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80342d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803432:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803437:	48 89 c6             	mov    %rax,%rsi
+  80343a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80343f:	48 b8 cc 1d 80 00 00 	movabs $0x801dcc,%rax
+  803446:	00 00 00 
+  803449:	ff d0                	call   *%rax
+  80344b:	89 c3                	mov    %eax,%ebx
+  80344d:	85 c0                	test   %eax,%eax
+  80344f:	0f 88 c5 00 00 00    	js     80351a <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803455:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803459:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  803460:	00 00 00 
+  803463:	ff d0                	call   *%rax
+  803465:	48 89 c1             	mov    %rax,%rcx
+  803468:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80346e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803474:	ba 00 00 00 00       	mov    $0x0,%edx
+  803479:	4c 89 ee             	mov    %r13,%rsi
+  80347c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803481:	48 b8 33 1e 80 00 00 	movabs $0x801e33,%rax
+  803488:	00 00 00 
+  80348b:	ff d0                	call   *%rax
+  80348d:	89 c3                	mov    %eax,%ebx
+  80348f:	85 c0                	test   %eax,%eax
+  803491:	78 6e                	js     803501 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803493:	be 00 10 00 00       	mov    $0x1000,%esi
+  803498:	4c 89 ef             	mov    %r13,%rdi
+  80349b:	48 b8 6e 1d 80 00 00 	movabs $0x801d6e,%rax
+  8034a2:	00 00 00 
+  8034a5:	ff d0                	call   *%rax
+  8034a7:	83 f8 02             	cmp    $0x2,%eax
+  8034aa:	0f 85 ab 00 00 00    	jne    80355b <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8034b0:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8034b7:	00 00 
+  8034b9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8034bd:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8034bf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8034c3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8034ca:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8034ce:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8034d0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034d4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8034db:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034df:	48 bb eb 26 80 00 00 	movabs $0x8026eb,%rbx
+  8034e6:	00 00 00 
+  8034e9:	ff d3                	call   *%rbx
+  8034eb:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8034ef:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8034f3:	ff d3                	call   *%rbx
+  8034f5:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8034fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034ff:	eb 4d                	jmp    80354e <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803501:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803506:	4c 89 ee             	mov    %r13,%rsi
+  803509:	bf 00 00 00 00       	mov    $0x0,%edi
+  80350e:	48 b8 98 1e 80 00 00 	movabs $0x801e98,%rax
+  803515:	00 00 00 
+  803518:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80351a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80351f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803523:	bf 00 00 00 00       	mov    $0x0,%edi
+  803528:	48 b8 98 1e 80 00 00 	movabs $0x801e98,%rax
+  80352f:	00 00 00 
+  803532:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803534:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803539:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80353d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803542:	48 b8 98 1e 80 00 00 	movabs $0x801e98,%rax
+  803549:	00 00 00 
+  80354c:	ff d0                	call   *%rax
+}
+  80354e:	89 d8                	mov    %ebx,%eax
+  803550:	48 83 c4 18          	add    $0x18,%rsp
+  803554:	5b                   	pop    %rbx
+  803555:	41 5c                	pop    %r12
+  803557:	41 5d                	pop    %r13
+  803559:	5d                   	pop    %rbp
+  80355a:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80355b:	48 b9 b8 45 80 00 00 	movabs $0x8045b8,%rcx
+  803562:	00 00 00 
+  803565:	48 ba d7 44 80 00 00 	movabs $0x8044d7,%rdx
+  80356c:	00 00 00 
+  80356f:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803574:	48 bf a7 45 80 00 00 	movabs $0x8045a7,%rdi
+  80357b:	00 00 00 
+  80357e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803583:	49 b8 a7 0d 80 00 00 	movabs $0x800da7,%r8
+  80358a:	00 00 00 
+  80358d:	41 ff d0             	call   *%r8
+
+0000000000803590 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803590:	55                   	push   %rbp
+  803591:	48 89 e5             	mov    %rsp,%rbp
+  803594:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803598:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80359c:	48 b8 79 27 80 00 00 	movabs $0x802779,%rax
+  8035a3:	00 00 00 
+  8035a6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035a8:	85 c0                	test   %eax,%eax
+  8035aa:	78 35                	js     8035e1 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8035ac:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8035b0:	48 b8 fd 26 80 00 00 	movabs $0x8026fd,%rax
+  8035b7:	00 00 00 
+  8035ba:	ff d0                	call   *%rax
+  8035bc:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8035bf:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8035c4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8035c9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8035cd:	48 b8 a0 1d 80 00 00 	movabs $0x801da0,%rax
+  8035d4:	00 00 00 
+  8035d7:	ff d0                	call   *%rax
+  8035d9:	85 c0                	test   %eax,%eax
+  8035db:	0f 94 c0             	sete   %al
+  8035de:	0f b6 c0             	movzbl %al,%eax
+}
+  8035e1:	c9                   	leave
+  8035e2:	c3                   	ret
+
+00000000008035e3 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8035e3:	48 89 f8             	mov    %rdi,%rax
+  8035e6:	48 c1 e8 27          	shr    $0x27,%rax
+  8035ea:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8035f1:	01 00 00 
+  8035f4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8035f8:	f6 c2 01             	test   $0x1,%dl
+  8035fb:	74 6d                	je     80366a <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8035fd:	48 89 f8             	mov    %rdi,%rax
+  803600:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803604:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80360b:	01 00 00 
+  80360e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803612:	f6 c2 01             	test   $0x1,%dl
+  803615:	74 62                	je     803679 <get_uvpt_entry+0x96>
+  803617:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80361e:	01 00 00 
+  803621:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803625:	f6 c2 80             	test   $0x80,%dl
+  803628:	75 4f                	jne    803679 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80362a:	48 89 f8             	mov    %rdi,%rax
+  80362d:	48 c1 e8 15          	shr    $0x15,%rax
+  803631:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803638:	01 00 00 
+  80363b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80363f:	f6 c2 01             	test   $0x1,%dl
+  803642:	74 44                	je     803688 <get_uvpt_entry+0xa5>
+  803644:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80364b:	01 00 00 
+  80364e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803652:	f6 c2 80             	test   $0x80,%dl
+  803655:	75 31                	jne    803688 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803657:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80365b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803662:	01 00 00 
+  803665:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803669:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80366a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803671:	01 00 00 
+  803674:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803678:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803679:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803680:	01 00 00 
+  803683:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803687:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803688:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80368f:	01 00 00 
+  803692:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803696:	c3                   	ret
+
+0000000000803697 <get_prot>:
+
+int
+get_prot(void *va) {
+  803697:	55                   	push   %rbp
+  803698:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80369b:	48 b8 e3 35 80 00 00 	movabs $0x8035e3,%rax
+  8036a2:	00 00 00 
+  8036a5:	ff d0                	call   *%rax
+  8036a7:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8036aa:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8036af:	89 c1                	mov    %eax,%ecx
+  8036b1:	83 c9 04             	or     $0x4,%ecx
+  8036b4:	f6 c2 01             	test   $0x1,%dl
+  8036b7:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8036ba:	89 c1                	mov    %eax,%ecx
+  8036bc:	83 c9 02             	or     $0x2,%ecx
+  8036bf:	f6 c2 02             	test   $0x2,%dl
+  8036c2:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8036c5:	89 c1                	mov    %eax,%ecx
+  8036c7:	83 c9 01             	or     $0x1,%ecx
+  8036ca:	48 85 d2             	test   %rdx,%rdx
+  8036cd:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8036d0:	89 c1                	mov    %eax,%ecx
+  8036d2:	83 c9 40             	or     $0x40,%ecx
+  8036d5:	f6 c6 04             	test   $0x4,%dh
+  8036d8:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8036db:	5d                   	pop    %rbp
+  8036dc:	c3                   	ret
+
+00000000008036dd <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8036dd:	55                   	push   %rbp
+  8036de:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8036e1:	48 b8 e3 35 80 00 00 	movabs $0x8035e3,%rax
+  8036e8:	00 00 00 
+  8036eb:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8036ed:	48 c1 e8 06          	shr    $0x6,%rax
+  8036f1:	83 e0 01             	and    $0x1,%eax
+}
+  8036f4:	5d                   	pop    %rbp
+  8036f5:	c3                   	ret
+
+00000000008036f6 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8036f6:	55                   	push   %rbp
+  8036f7:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8036fa:	48 b8 e3 35 80 00 00 	movabs $0x8035e3,%rax
+  803701:	00 00 00 
+  803704:	ff d0                	call   *%rax
+  803706:	83 e0 01             	and    $0x1,%eax
+}
+  803709:	5d                   	pop    %rbp
+  80370a:	c3                   	ret
+
+000000000080370b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80370b:	55                   	push   %rbp
+  80370c:	48 89 e5             	mov    %rsp,%rbp
+  80370f:	41 57                	push   %r15
+  803711:	41 56                	push   %r14
+  803713:	41 55                	push   %r13
+  803715:	41 54                	push   %r12
+  803717:	53                   	push   %rbx
+  803718:	48 83 ec 18          	sub    $0x18,%rsp
+  80371c:	49 89 ff             	mov    %rdi,%r15
+  80371f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  803723:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  803728:	49 bc f6 36 80 00 00 	movabs $0x8036f6,%r12
+  80372f:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  803732:	49 be 97 36 80 00 00 	movabs $0x803697,%r14
+  803739:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80373c:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  803743:	00 00 00 
+  803746:	eb 0c                	jmp    803754 <foreach_shared_region+0x49>
+  803748:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80374f:	4c 39 eb             	cmp    %r13,%rbx
+  803752:	74 38                	je     80378c <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  803754:	48 89 df             	mov    %rbx,%rdi
+  803757:	41 ff d4             	call   *%r12
+  80375a:	84 c0                	test   %al,%al
+  80375c:	74 ea                	je     803748 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  80375e:	48 89 df             	mov    %rbx,%rdi
+  803761:	41 ff d6             	call   *%r14
+  803764:	a8 40                	test   $0x40,%al
+  803766:	74 e0                	je     803748 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  803768:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80376f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803773:	48 89 df             	mov    %rbx,%rdi
+  803776:	41 ff d7             	call   *%r15
+        if (err)
+  803779:	85 c0                	test   %eax,%eax
+  80377b:	74 cb                	je     803748 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  80377d:	48 83 c4 18          	add    $0x18,%rsp
+  803781:	5b                   	pop    %rbx
+  803782:	41 5c                	pop    %r12
+  803784:	41 5d                	pop    %r13
+  803786:	41 5e                	pop    %r14
+  803788:	41 5f                	pop    %r15
+  80378a:	5d                   	pop    %rbp
+  80378b:	c3                   	ret
+    return 0;
+  80378c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803791:	eb ea                	jmp    80377d <foreach_shared_region+0x72>
+
+0000000000803793 <_generic_signal_handler>:
+        (es->sa.sa_handler)(es->signo);
+    }
+}
+
+void
+_generic_signal_handler(struct UTrapframe *utf, struct EnqueuedSignal * es) {
+  803793:	55                   	push   %rbp
+  803794:	48 89 e5             	mov    %rsp,%rbp
+  803797:	41 55                	push   %r13
+  803799:	41 54                	push   %r12
+  80379b:	53                   	push   %rbx
+  80379c:	48 83 ec 08          	sub    $0x8,%rsp
+  8037a0:	49 89 fc             	mov    %rdi,%r12
+  8037a3:	48 89 f3             	mov    %rsi,%rbx
+    if (trace_signals)
+        cprintf("signals: env %x: begin generic handler for %d\n", sys_getenvid(), es->signo);
+  8037a6:	44 8b 2e             	mov    (%rsi),%r13d
+  8037a9:	48 b8 0c 1d 80 00 00 	movabs $0x801d0c,%rax
+  8037b0:	00 00 00 
+  8037b3:	ff d0                	call   *%rax
+  8037b5:	89 c6                	mov    %eax,%esi
+  8037b7:	44 89 ea             	mov    %r13d,%edx
+  8037ba:	48 bf e0 45 80 00 00 	movabs $0x8045e0,%rdi
+  8037c1:	00 00 00 
+  8037c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c9:	48 b9 f7 0e 80 00 00 	movabs $0x800ef7,%rcx
+  8037d0:	00 00 00 
+  8037d3:	ff d1                	call   *%rcx
+    if (es->sa.sa_handler == SIG_DFL) {
+  8037d5:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8037d9:	48 85 c0             	test   %rax,%rax
+  8037dc:	74 57                	je     803835 <_generic_signal_handler+0xa2>
+    if (es->sa.sa_handler == SIG_IGN) {
+  8037de:	48 83 f8 01          	cmp    $0x1,%rax
+  8037e2:	0f 84 c0 00 00 00    	je     8038a8 <_generic_signal_handler+0x115>
+    if (es->sa.sa_flags & SA_SIGINFO) {
+  8037e8:	f6 43 14 04          	testb  $0x4,0x14(%rbx)
+  8037ec:	0f 84 ea 00 00 00    	je     8038dc <_generic_signal_handler+0x149>
+        (es->sa.sa_sigaction)(es->signo, &(es->info), utf);
+  8037f2:	48 8d 73 18          	lea    0x18(%rbx),%rsi
+  8037f6:	8b 3b                	mov    (%rbx),%edi
+  8037f8:	4c 89 e2             	mov    %r12,%rdx
+  8037fb:	ff d0                	call   *%rax
+
+    _generic_signal_handler_impl(utf, es);
+
+    if (trace_signals)
+        cprintf("signals: env %x: end generic handler for %d\n", sys_getenvid(), es->signo);
+  8037fd:	8b 1b                	mov    (%rbx),%ebx
+  8037ff:	48 b8 0c 1d 80 00 00 	movabs $0x801d0c,%rax
+  803806:	00 00 00 
+  803809:	ff d0                	call   *%rax
+  80380b:	89 c6                	mov    %eax,%esi
+  80380d:	89 da                	mov    %ebx,%edx
+  80380f:	48 bf 68 46 80 00 00 	movabs $0x804668,%rdi
+  803816:	00 00 00 
+  803819:	b8 00 00 00 00       	mov    $0x0,%eax
+  80381e:	48 b9 f7 0e 80 00 00 	movabs $0x800ef7,%rcx
+  803825:	00 00 00 
+  803828:	ff d1                	call   *%rcx
+}
+  80382a:	48 83 c4 08          	add    $0x8,%rsp
+  80382e:	5b                   	pop    %rbx
+  80382f:	41 5c                	pop    %r12
+  803831:	41 5d                	pop    %r13
+  803833:	5d                   	pop    %rbp
+  803834:	c3                   	ret
+            cprintf("signals: env %x: exiting due to signal %d\n", sys_getenvid(), es->signo);
+  803835:	8b 1b                	mov    (%rbx),%ebx
+  803837:	48 b8 0c 1d 80 00 00 	movabs $0x801d0c,%rax
+  80383e:	00 00 00 
+  803841:	ff d0                	call   *%rax
+  803843:	89 c6                	mov    %eax,%esi
+  803845:	89 da                	mov    %ebx,%edx
+  803847:	48 bf 10 46 80 00 00 	movabs $0x804610,%rdi
+  80384e:	00 00 00 
+  803851:	b8 00 00 00 00       	mov    $0x0,%eax
+  803856:	48 b9 f7 0e 80 00 00 	movabs $0x800ef7,%rcx
+  80385d:	00 00 00 
+  803860:	ff d1                	call   *%rcx
+        sys_env_destroy(CURENVID);
+  803862:	bf 00 00 00 00       	mov    $0x0,%edi
+  803867:	48 b8 a1 1c 80 00 00 	movabs $0x801ca1,%rax
+  80386e:	00 00 00 
+  803871:	ff d0                	call   *%rax
+        assert(false);
+  803873:	48 b9 95 46 80 00 00 	movabs $0x804695,%rcx
+  80387a:	00 00 00 
+  80387d:	48 ba d7 44 80 00 00 	movabs $0x8044d7,%rdx
+  803884:	00 00 00 
+  803887:	be 0c 00 00 00       	mov    $0xc,%esi
+  80388c:	48 bf 9b 46 80 00 00 	movabs $0x80469b,%rdi
+  803893:	00 00 00 
+  803896:	b8 00 00 00 00       	mov    $0x0,%eax
+  80389b:	49 b8 a7 0d 80 00 00 	movabs $0x800da7,%r8
+  8038a2:	00 00 00 
+  8038a5:	41 ff d0             	call   *%r8
+            cprintf("signals: env %x: ignoring signal %d\n", sys_getenvid(), es->signo);
+  8038a8:	44 8b 23             	mov    (%rbx),%r12d
+  8038ab:	48 b8 0c 1d 80 00 00 	movabs $0x801d0c,%rax
+  8038b2:	00 00 00 
+  8038b5:	ff d0                	call   *%rax
+  8038b7:	89 c6                	mov    %eax,%esi
+  8038b9:	44 89 e2             	mov    %r12d,%edx
+  8038bc:	48 bf 40 46 80 00 00 	movabs $0x804640,%rdi
+  8038c3:	00 00 00 
+  8038c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038cb:	48 b9 f7 0e 80 00 00 	movabs $0x800ef7,%rcx
+  8038d2:	00 00 00 
+  8038d5:	ff d1                	call   *%rcx
+        return;
+  8038d7:	e9 21 ff ff ff       	jmp    8037fd <_generic_signal_handler+0x6a>
+        (es->sa.sa_handler)(es->signo);
+  8038dc:	8b 3b                	mov    (%rbx),%edi
+  8038de:	ff d0                	call   *%rax
+  8038e0:	e9 18 ff ff ff       	jmp    8037fd <_generic_signal_handler+0x6a>
+
+00000000008038e5 <sigqueue>:
+
+int sigqueue(pid_t pid, int signo, const union sigval value) {
+  8038e5:	55                   	push   %rbp
+  8038e6:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigqueue(pid, signo, value);
+  8038e9:	48 b8 d0 21 80 00 00 	movabs $0x8021d0,%rax
+  8038f0:	00 00 00 
+  8038f3:	ff d0                	call   *%rax
+}
+  8038f5:	5d                   	pop    %rbp
+  8038f6:	c3                   	ret
+
+00000000008038f7 <sigwait>:
+
+int sigwait(const sigset_t * set, int * sig) {
+  8038f7:	55                   	push   %rbp
+  8038f8:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigwait(set, sig);
+  8038fb:	48 b8 37 22 80 00 00 	movabs $0x802237,%rax
+  803902:	00 00 00 
+  803905:	ff d0                	call   *%rax
+}
+  803907:	5d                   	pop    %rbp
+  803908:	c3                   	ret
+
+0000000000803909 <sigaction>:
+
+extern void _signal_handler_trampoline(void);
+
+int sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  803909:	55                   	push   %rbp
+  80390a:	48 89 e5             	mov    %rsp,%rbp
+  80390d:	41 55                	push   %r13
+  80390f:	41 54                	push   %r12
+  803911:	53                   	push   %rbx
+  803912:	48 83 ec 08          	sub    $0x8,%rsp
+  803916:	89 fb                	mov    %edi,%ebx
+  803918:	49 89 f4             	mov    %rsi,%r12
+  80391b:	49 89 d5             	mov    %rdx,%r13
+    int err = sys_env_set_pgfault_upcall(CURENVID, _signal_handler_trampoline);
+  80391e:	48 be 30 26 80 00 00 	movabs $0x802630,%rsi
+  803925:	00 00 00 
+  803928:	bf 00 00 00 00       	mov    $0x0,%edi
+  80392d:	48 b8 a1 20 80 00 00 	movabs $0x8020a1,%rax
+  803934:	00 00 00 
+  803937:	ff d0                	call   *%rax
+    if (err)
+  803939:	85 c0                	test   %eax,%eax
+  80393b:	74 0b                	je     803948 <sigaction+0x3f>
+        return err;
+    return sys_sigaction(sig, act, oact);
+}
+  80393d:	48 83 c4 08          	add    $0x8,%rsp
+  803941:	5b                   	pop    %rbx
+  803942:	41 5c                	pop    %r12
+  803944:	41 5d                	pop    %r13
+  803946:	5d                   	pop    %rbp
+  803947:	c3                   	ret
+    return sys_sigaction(sig, act, oact);
+  803948:	4c 89 ea             	mov    %r13,%rdx
+  80394b:	4c 89 e6             	mov    %r12,%rsi
+  80394e:	89 df                	mov    %ebx,%edi
+  803950:	48 b8 a0 22 80 00 00 	movabs $0x8022a0,%rax
+  803957:	00 00 00 
+  80395a:	ff d0                	call   *%rax
+  80395c:	eb df                	jmp    80393d <sigaction+0x34>
+
+000000000080395e <sigprocmask>:
+
+int sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  80395e:	55                   	push   %rbp
+  80395f:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigprocmask(how, set, oldset);
+  803962:	48 b8 07 23 80 00 00 	movabs $0x802307,%rax
+  803969:	00 00 00 
+  80396c:	ff d0                	call   *%rax
+}
+  80396e:	5d                   	pop    %rbp
+  80396f:	c3                   	ret
+
+0000000000803970 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803970:	b8 00 00 00 00       	mov    $0x0,%eax
+  803975:	c3                   	ret
+
+0000000000803976 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803976:	55                   	push   %rbp
+  803977:	48 89 e5             	mov    %rsp,%rbp
+  80397a:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80397d:	48 be a8 46 80 00 00 	movabs $0x8046a8,%rsi
+  803984:	00 00 00 
+  803987:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  80398e:	00 00 00 
+  803991:	ff d0                	call   *%rax
+    return 0;
+}
+  803993:	b8 00 00 00 00       	mov    $0x0,%eax
+  803998:	5d                   	pop    %rbp
+  803999:	c3                   	ret
+
+000000000080399a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80399a:	55                   	push   %rbp
+  80399b:	48 89 e5             	mov    %rsp,%rbp
+  80399e:	41 57                	push   %r15
+  8039a0:	41 56                	push   %r14
+  8039a2:	41 55                	push   %r13
+  8039a4:	41 54                	push   %r12
+  8039a6:	53                   	push   %rbx
+  8039a7:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8039ae:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8039b5:	48 85 d2             	test   %rdx,%rdx
+  8039b8:	74 7a                	je     803a34 <devcons_write+0x9a>
+  8039ba:	49 89 d6             	mov    %rdx,%r14
+  8039bd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8039c3:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8039c8:	49 bf 16 1a 80 00 00 	movabs $0x801a16,%r15
+  8039cf:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8039d2:	4c 89 f3             	mov    %r14,%rbx
+  8039d5:	48 29 f3             	sub    %rsi,%rbx
+  8039d8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8039dd:	48 39 c3             	cmp    %rax,%rbx
+  8039e0:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8039e4:	4c 63 eb             	movslq %ebx,%r13
+  8039e7:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8039ee:	48 01 c6             	add    %rax,%rsi
+  8039f1:	4c 89 ea             	mov    %r13,%rdx
+  8039f4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8039fb:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8039fe:	4c 89 ee             	mov    %r13,%rsi
+  803a01:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803a08:	48 b8 43 1c 80 00 00 	movabs $0x801c43,%rax
+  803a0f:	00 00 00 
+  803a12:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803a14:	41 01 dc             	add    %ebx,%r12d
+  803a17:	49 63 f4             	movslq %r12d,%rsi
+  803a1a:	4c 39 f6             	cmp    %r14,%rsi
+  803a1d:	72 b3                	jb     8039d2 <devcons_write+0x38>
+    return res;
+  803a1f:	49 63 c4             	movslq %r12d,%rax
+}
+  803a22:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803a29:	5b                   	pop    %rbx
+  803a2a:	41 5c                	pop    %r12
+  803a2c:	41 5d                	pop    %r13
+  803a2e:	41 5e                	pop    %r14
+  803a30:	41 5f                	pop    %r15
+  803a32:	5d                   	pop    %rbp
+  803a33:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803a34:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803a3a:	eb e3                	jmp    803a1f <devcons_write+0x85>
+
+0000000000803a3c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a3c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803a3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a44:	48 85 c0             	test   %rax,%rax
+  803a47:	74 55                	je     803a9e <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a49:	55                   	push   %rbp
+  803a4a:	48 89 e5             	mov    %rsp,%rbp
+  803a4d:	41 55                	push   %r13
+  803a4f:	41 54                	push   %r12
+  803a51:	53                   	push   %rbx
+  803a52:	48 83 ec 08          	sub    $0x8,%rsp
+  803a56:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803a59:	48 bb 70 1c 80 00 00 	movabs $0x801c70,%rbx
+  803a60:	00 00 00 
+  803a63:	49 bc 3d 1d 80 00 00 	movabs $0x801d3d,%r12
+  803a6a:	00 00 00 
+  803a6d:	eb 03                	jmp    803a72 <devcons_read+0x36>
+  803a6f:	41 ff d4             	call   *%r12
+  803a72:	ff d3                	call   *%rbx
+  803a74:	85 c0                	test   %eax,%eax
+  803a76:	74 f7                	je     803a6f <devcons_read+0x33>
+    if (c < 0) return c;
+  803a78:	48 63 d0             	movslq %eax,%rdx
+  803a7b:	78 13                	js     803a90 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803a7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a82:	83 f8 04             	cmp    $0x4,%eax
+  803a85:	74 09                	je     803a90 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803a87:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803a8b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803a90:	48 89 d0             	mov    %rdx,%rax
+  803a93:	48 83 c4 08          	add    $0x8,%rsp
+  803a97:	5b                   	pop    %rbx
+  803a98:	41 5c                	pop    %r12
+  803a9a:	41 5d                	pop    %r13
+  803a9c:	5d                   	pop    %rbp
+  803a9d:	c3                   	ret
+  803a9e:	48 89 d0             	mov    %rdx,%rax
+  803aa1:	c3                   	ret
+
+0000000000803aa2 <cputchar>:
+cputchar(int ch) {
+  803aa2:	55                   	push   %rbp
+  803aa3:	48 89 e5             	mov    %rsp,%rbp
+  803aa6:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803aaa:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803aae:	be 01 00 00 00       	mov    $0x1,%esi
+  803ab3:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803ab7:	48 b8 43 1c 80 00 00 	movabs $0x801c43,%rax
+  803abe:	00 00 00 
+  803ac1:	ff d0                	call   *%rax
+}
+  803ac3:	c9                   	leave
+  803ac4:	c3                   	ret
+
+0000000000803ac5 <getchar>:
+getchar(void) {
+  803ac5:	55                   	push   %rbp
+  803ac6:	48 89 e5             	mov    %rsp,%rbp
+  803ac9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803acd:	ba 01 00 00 00       	mov    $0x1,%edx
+  803ad2:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803ad6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803adb:	48 b8 5c 2a 80 00 00 	movabs $0x802a5c,%rax
+  803ae2:	00 00 00 
+  803ae5:	ff d0                	call   *%rax
+  803ae7:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803ae9:	85 c0                	test   %eax,%eax
+  803aeb:	78 06                	js     803af3 <getchar+0x2e>
+  803aed:	74 08                	je     803af7 <getchar+0x32>
+  803aef:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803af3:	89 d0                	mov    %edx,%eax
+  803af5:	c9                   	leave
+  803af6:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803af7:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803afc:	eb f5                	jmp    803af3 <getchar+0x2e>
+
+0000000000803afe <iscons>:
+iscons(int fdnum) {
+  803afe:	55                   	push   %rbp
+  803aff:	48 89 e5             	mov    %rsp,%rbp
+  803b02:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b06:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b0a:	48 b8 79 27 80 00 00 	movabs $0x802779,%rax
+  803b11:	00 00 00 
+  803b14:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b16:	85 c0                	test   %eax,%eax
+  803b18:	78 18                	js     803b32 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803b1a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803b1e:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  803b25:	00 00 00 
+  803b28:	8b 00                	mov    (%rax),%eax
+  803b2a:	39 02                	cmp    %eax,(%rdx)
+  803b2c:	0f 94 c0             	sete   %al
+  803b2f:	0f b6 c0             	movzbl %al,%eax
+}
+  803b32:	c9                   	leave
+  803b33:	c3                   	ret
+
+0000000000803b34 <opencons>:
+opencons(void) {
+  803b34:	55                   	push   %rbp
+  803b35:	48 89 e5             	mov    %rsp,%rbp
+  803b38:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803b3c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803b40:	48 b8 19 27 80 00 00 	movabs $0x802719,%rax
+  803b47:	00 00 00 
+  803b4a:	ff d0                	call   *%rax
+  803b4c:	85 c0                	test   %eax,%eax
+  803b4e:	78 49                	js     803b99 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803b50:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b55:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b5a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803b5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b63:	48 b8 cc 1d 80 00 00 	movabs $0x801dcc,%rax
+  803b6a:	00 00 00 
+  803b6d:	ff d0                	call   *%rax
+  803b6f:	85 c0                	test   %eax,%eax
+  803b71:	78 26                	js     803b99 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803b73:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803b77:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  803b7e:	00 00 
+  803b80:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803b82:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b86:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803b8d:	48 b8 eb 26 80 00 00 	movabs $0x8026eb,%rax
+  803b94:	00 00 00 
+  803b97:	ff d0                	call   *%rax
+}
+  803b99:	c9                   	leave
+  803b9a:	c3                   	ret
+
+0000000000803b9b <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b9b:	55                   	push   %rbp
+  803b9c:	48 89 e5             	mov    %rsp,%rbp
+  803b9f:	41 54                	push   %r12
+  803ba1:	53                   	push   %rbx
+  803ba2:	48 89 fb             	mov    %rdi,%rbx
+  803ba5:	48 89 f7             	mov    %rsi,%rdi
+  803ba8:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  803bab:	48 85 f6             	test   %rsi,%rsi
+  803bae:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803bb5:	00 00 00 
+  803bb8:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  803bbc:	be 00 10 00 00       	mov    $0x1000,%esi
+  803bc1:	48 b8 36 21 80 00 00 	movabs $0x802136,%rax
+  803bc8:	00 00 00 
+  803bcb:	ff d0                	call   *%rax
+    if (res < 0) {
+  803bcd:	85 c0                	test   %eax,%eax
+  803bcf:	78 45                	js     803c16 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  803bd1:	48 85 db             	test   %rbx,%rbx
+  803bd4:	74 12                	je     803be8 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  803bd6:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  803bdd:	00 00 00 
+  803be0:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  803be6:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  803be8:	4d 85 e4             	test   %r12,%r12
+  803beb:	74 14                	je     803c01 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  803bed:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  803bf4:	00 00 00 
+  803bf7:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  803bfd:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  803c01:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  803c08:	00 00 00 
+  803c0b:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  803c11:	5b                   	pop    %rbx
+  803c12:	41 5c                	pop    %r12
+  803c14:	5d                   	pop    %rbp
+  803c15:	c3                   	ret
+        if (from_env_store)
+  803c16:	48 85 db             	test   %rbx,%rbx
+  803c19:	74 06                	je     803c21 <ipc_recv+0x86>
+            *from_env_store = 0;
+  803c1b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  803c21:	4d 85 e4             	test   %r12,%r12
+  803c24:	74 eb                	je     803c11 <ipc_recv+0x76>
+            *perm_store = 0;
+  803c26:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803c2d:	00 
+  803c2e:	eb e1                	jmp    803c11 <ipc_recv+0x76>
+
+0000000000803c30 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803c30:	55                   	push   %rbp
+  803c31:	48 89 e5             	mov    %rsp,%rbp
+  803c34:	41 57                	push   %r15
+  803c36:	41 56                	push   %r14
+  803c38:	41 55                	push   %r13
+  803c3a:	41 54                	push   %r12
+  803c3c:	53                   	push   %rbx
+  803c3d:	48 83 ec 18          	sub    $0x18,%rsp
+  803c41:	41 89 fd             	mov    %edi,%r13d
+  803c44:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803c47:	48 89 d3             	mov    %rdx,%rbx
+  803c4a:	49 89 cc             	mov    %rcx,%r12
+  803c4d:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  803c51:	48 85 d2             	test   %rdx,%rdx
+  803c54:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803c5b:	00 00 00 
+  803c5e:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803c62:	49 be 0a 21 80 00 00 	movabs $0x80210a,%r14
+  803c69:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  803c6c:	49 bf 3d 1d 80 00 00 	movabs $0x801d3d,%r15
+  803c73:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803c76:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803c79:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  803c7d:	4c 89 e1             	mov    %r12,%rcx
+  803c80:	48 89 da             	mov    %rbx,%rdx
+  803c83:	44 89 ef             	mov    %r13d,%edi
+  803c86:	41 ff d6             	call   *%r14
+        if (res == 0)
+  803c89:	85 c0                	test   %eax,%eax
+  803c8b:	74 34                	je     803cc1 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  803c8d:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803c90:	75 05                	jne    803c97 <ipc_send+0x67>
+        sys_yield();
+  803c92:	41 ff d7             	call   *%r15
+    while (true) {
+  803c95:	eb df                	jmp    803c76 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  803c97:	48 ba b4 46 80 00 00 	movabs $0x8046b4,%rdx
+  803c9e:	00 00 00 
+  803ca1:	be 3e 00 00 00       	mov    $0x3e,%esi
+  803ca6:	48 bf cd 46 80 00 00 	movabs $0x8046cd,%rdi
+  803cad:	00 00 00 
+  803cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cb5:	48 b9 a7 0d 80 00 00 	movabs $0x800da7,%rcx
+  803cbc:	00 00 00 
+  803cbf:	ff d1                	call   *%rcx
+    }
+}
+  803cc1:	48 83 c4 18          	add    $0x18,%rsp
+  803cc5:	5b                   	pop    %rbx
+  803cc6:	41 5c                	pop    %r12
+  803cc8:	41 5d                	pop    %r13
+  803cca:	41 5e                	pop    %r14
+  803ccc:	41 5f                	pop    %r15
+  803cce:	5d                   	pop    %rbp
+  803ccf:	c3                   	ret
+
+0000000000803cd0 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803cd5:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803cdc:	00 00 00 
+  803cdf:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  803ce6:	48 01 ca             	add    %rcx,%rdx
+  803ce9:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803cef:	39 fa                	cmp    %edi,%edx
+  803cf1:	74 12                	je     803d05 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803cf3:	48 83 c0 01          	add    $0x1,%rax
+  803cf7:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  803cfd:	75 e0                	jne    803cdf <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803cff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d04:	c3                   	ret
+            return envs[i].env_id;
+  803d05:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  803d0c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803d13:	00 00 00 
+  803d16:	48 01 d0             	add    %rdx,%rax
+  803d19:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803d1f:	c3                   	ret
+
+0000000000803d20 <__rodata_start>:
+  803d20:	25 2d 36 73 20       	and    $0x2073362d,%eax
+  803d25:	25 2d 38 73 20       	and    $0x2073382d,%eax
+  803d2a:	25 2d 38 73 0a       	and    $0xa73382d,%eax
+  803d2f:	00 72 31             	add    %dh,0x31(%rdx)
+  803d32:	34 00                	xor    $0x0,%al
+  803d34:	25 2d 36 73 20       	and    $0x2073362d,%eax
+  803d39:	25 30 38 6c 78       	and    $0x786c3830,%eax
+  803d3e:	20 25 30 38 6c 78    	and    %ah,0x786c3830(%rip)        # 78ec7574 <__bss_end+0x786be574>
+  803d44:	20 00                	and    %al,(%rax)
+  803d46:	4f                   	rex.WRXB
+  803d47:	4b 0a 00             	rex.WXB or (%r8),%al
+  803d4a:	4d                   	rex.WRB
+  803d4b:	49 53                	rex.WB push %r11
+  803d4d:	4d                   	rex.WRB
+  803d4e:	41 54                	push   %r12
+  803d50:	43                   	rex.XB
+  803d51:	48 0a 00             	rex.W or (%rax),%al
+  803d54:	72 31                	jb     803d87 <__rodata_start+0x67>
+  803d56:	33 00                	xor    (%rax),%eax
+  803d58:	72 31                	jb     803d8b <__rodata_start+0x6b>
+  803d5a:	32 00                	xor    (%rax),%al
+  803d5c:	72 31                	jb     803d8f <__rodata_start+0x6f>
+  803d5e:	31 00                	xor    %eax,(%rax)
+  803d60:	72 31                	jb     803d93 <__rodata_start+0x73>
+  803d62:	30 00                	xor    %al,(%rax)
+  803d64:	72 73                	jb     803dd9 <__rodata_start+0xb9>
+  803d66:	69 00 72 64 69 00    	imul   $0x696472,(%rax),%eax
+  803d6c:	72 62                	jb     803dd0 <__rodata_start+0xb0>
+  803d6e:	70 00                	jo     803d70 <__rodata_start+0x50>
+  803d70:	72 62                	jb     803dd4 <__rodata_start+0xb4>
+  803d72:	78 00                	js     803d74 <__rodata_start+0x54>
+  803d74:	72 64                	jb     803dda <__rodata_start+0xba>
+  803d76:	78 00                	js     803d78 <__rodata_start+0x58>
+  803d78:	72 63                	jb     803ddd <__rodata_start+0xbd>
+  803d7a:	78 00                	js     803d7c <__rodata_start+0x5c>
+  803d7c:	72 61                	jb     803ddf <__rodata_start+0xbf>
+  803d7e:	78 00                	js     803d80 <__rodata_start+0x60>
+  803d80:	72 69                	jb     803deb <__rodata_start+0xcb>
+  803d82:	70 00                	jo     803d84 <__rodata_start+0x64>
+  803d84:	72 66                	jb     803dec <__rodata_start+0xcc>
+  803d86:	6c                   	insb   (%dx),%es:(%rdi)
+  803d87:	61                   	(bad)
+  803d88:	67 73 00             	addr32 jae 803d8b <__rodata_start+0x6b>
+  803d8b:	72 73                	jb     803e00 <__rodata_start+0xe0>
+  803d8d:	70 00                	jo     803d8f <__rodata_start+0x6f>
+  803d8f:	52                   	push   %rdx
+  803d90:	65 67 69 73 74 65 72 	imul   $0x20737265,%gs:0x74(%ebx),%esi
+  803d97:	73 20 
+  803d99:	25 73 20 00 75       	and    $0x75002073,%eax
+  803d9e:	73 65                	jae    803e05 <__rodata_start+0xe5>
+  803da0:	72 2f                	jb     803dd1 <__rodata_start+0xb1>
+  803da2:	66 61                	data16 (bad)
+  803da4:	75 6c                	jne    803e12 <__rodata_start+0xf2>
+  803da6:	74 72                	je     803e1a <__rodata_start+0xfa>
+  803da8:	65 67 73 2e          	gs addr32 jae 803dda <__rodata_start+0xba>
+  803dac:	63 00                	movsxd (%rax),%eax
+  803dae:	69 6e 20 55 54 72 61 	imul   $0x61725455,0x20(%rsi),%ebp
+  803db5:	70 66                	jo     803e1d <__rodata_start+0xfd>
+  803db7:	72 61                	jb     803e1a <__rodata_start+0xfa>
+  803db9:	6d                   	insl   (%dx),%es:(%rdi)
+  803dba:	65 00 64 75 72       	add    %ah,%gs:0x72(%rbp,%rsi,2)
+  803dbf:	69 6e 67 00 62 65 66 	imul   $0x66656200,0x67(%rsi),%ebp
+  803dc6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803dc7:	72 65                	jb     803e2e <__rodata_start+0x10e>
+  803dc9:	00 73 79             	add    %dh,0x79(%rbx)
+  803dcc:	73 5f                	jae    803e2d <__rodata_start+0x10d>
+  803dce:	70 61                	jo     803e31 <__rodata_start+0x111>
+  803dd0:	67 65 5f             	addr32 gs pop %rdi
+  803dd3:	61                   	(bad)
+  803dd4:	6c                   	insb   (%dx),%es:(%rdi)
+  803dd5:	6c                   	insb   (%dx),%es:(%rdi)
+  803dd6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803dd7:	63 3a                	movsxd (%rdx),%edi
+  803dd9:	20 25 69 00 61 66    	and    %ah,0x66610069(%rip)        # 66e13e48 <__bss_end+0x6660ae48>
+  803ddf:	74 65                	je     803e46 <__rodata_start+0x126>
+  803de1:	72 20                	jb     803e03 <__rodata_start+0xe3>
+  803de3:	70 61                	jo     803e46 <__rodata_start+0x126>
+  803de5:	67 65 2d 66 61 75 6c 	addr32 gs sub $0x6c756166,%eax
+  803dec:	74 00                	je     803dee <__rodata_start+0xce>
+  803dee:	61                   	(bad)
+  803def:	66 74 65             	data16 je 803e57 <__rodata_start+0x137>
+  803df2:	72 00                	jb     803df4 <__rodata_start+0xd4>
+  803df4:	0f 1f 40 00          	nopl   0x0(%rax)
+  803df8:	70 67                	jo     803e61 <__rodata_start+0x141>
+  803dfa:	66 61                	data16 (bad)
+  803dfc:	75 6c                	jne    803e6a <__rodata_start+0x14a>
+  803dfe:	74 20                	je     803e20 <__rodata_start+0x100>
+  803e00:	65 78 70             	gs js  803e73 <__rodata_start+0x153>
+  803e03:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803e08:	20 61 74             	and    %ah,0x74(%rcx)
+  803e0b:	20 55 54             	and    %dl,0x54(%rbp)
+  803e0e:	45                   	rex.RB
+  803e0f:	4d 50                	rex.WRB push %r8
+  803e11:	2c 20                	sub    $0x20,%al
+  803e13:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803e15:	74 20                	je     803e37 <__rodata_start+0x117>
+  803e17:	30 78 25             	xor    %bh,0x25(%rax)
+  803e1a:	30 38                	xor    %bh,(%rax)
+  803e1c:	6c                   	insb   (%dx),%es:(%rdi)
+  803e1d:	78 20                	js     803e3f <__rodata_start+0x11f>
+  803e1f:	28 72 69             	sub    %dh,0x69(%rdx)
+  803e22:	70 20                	jo     803e44 <__rodata_start+0x124>
+  803e24:	25 30 38 6c 78       	and    $0x786c3830,%eax
+  803e29:	29 00                	sub    %eax,(%rax)
+  803e2b:	00 00                	add    %al,(%rax)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 52 49             	add    %dl,0x49(%rdx)
+  803e32:	50                   	push   %rax
+  803e33:	20 61 66             	and    %ah,0x66(%rcx)
+  803e36:	74 65                	je     803e9d <__rodata_start+0x17d>
+  803e38:	72 20                	jb     803e5a <__rodata_start+0x13a>
+  803e3a:	70 61                	jo     803e9d <__rodata_start+0x17d>
+  803e3c:	67 65 2d 66 61 75 6c 	addr32 gs sub $0x6c756166,%eax
+  803e43:	74 20                	je     803e65 <__rodata_start+0x145>
+  803e45:	4d                   	rex.WRB
+  803e46:	49 53                	rex.WB push %r11
+  803e48:	4d                   	rex.WRB
+  803e49:	41 54                	push   %r12
+  803e4b:	43                   	rex.XB
+  803e4c:	48 0a 00             	rex.W or (%rax),%al
+  803e4f:	3c 75                	cmp    $0x75,%al
+  803e51:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e52:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803e56:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e57:	3e 00 0f             	ds add %cl,(%rdi)
+  803e5a:	1f                   	(bad)
+  803e5b:	80 00 00             	addb   $0x0,(%rax)
+  803e5e:	00 00                	add    %al,(%rax)
+  803e60:	5b                   	pop    %rbx
+  803e61:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803e66:	20 75 73             	and    %dh,0x73(%rbp)
+  803e69:	65 72 20             	gs jb  803e8c <__rodata_start+0x16c>
+  803e6c:	70 61                	jo     803ecf <__rodata_start+0x1af>
+  803e6e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e6f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803e76:	73 20                	jae    803e98 <__rodata_start+0x178>
+  803e78:	61                   	(bad)
+  803e79:	74 20                	je     803e9b <__rodata_start+0x17b>
+  803e7b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803e80:	3a 20                	cmp    (%rax),%ah
+  803e82:	00 30                	add    %dh,(%rax)
+  803e84:	31 32                	xor    %esi,(%rdx)
+  803e86:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803e8d:	41                   	rex.B
+  803e8e:	42                   	rex.X
+  803e8f:	43                   	rex.XB
+  803e90:	44                   	rex.R
+  803e91:	45                   	rex.RB
+  803e92:	46 00 30             	rex.RX add %r14b,(%rax)
+  803e95:	31 32                	xor    %esi,(%rdx)
+  803e97:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803e9e:	61                   	(bad)
+  803e9f:	62 63 64 65 66       	(bad)
+  803ea4:	00 28                	add    %ch,(%rax)
+  803ea6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ea7:	75 6c                	jne    803f15 <__rodata_start+0x1f5>
+  803ea9:	6c                   	insb   (%dx),%es:(%rdi)
+  803eaa:	29 00                	sub    %eax,(%rax)
+  803eac:	65 72 72             	gs jb  803f21 <__rodata_start+0x201>
+  803eaf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803eb0:	72 20                	jb     803ed2 <__rodata_start+0x1b2>
+  803eb2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803eb7:	73 70                	jae    803f29 <__rodata_start+0x209>
+  803eb9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803ebd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803ec4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ec5:	72 00                	jb     803ec7 <__rodata_start+0x1a7>
+  803ec7:	62 61 64 20 65       	(bad)
+  803ecc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ecd:	76 69                	jbe    803f38 <__rodata_start+0x218>
+  803ecf:	72 6f                	jb     803f40 <__rodata_start+0x220>
+  803ed1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ed2:	6d                   	insl   (%dx),%es:(%rdi)
+  803ed3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ed5:	74 00                	je     803ed7 <__rodata_start+0x1b7>
+  803ed7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803ede:	20 70 61             	and    %dh,0x61(%rax)
+  803ee1:	72 61                	jb     803f44 <__rodata_start+0x224>
+  803ee3:	6d                   	insl   (%dx),%es:(%rdi)
+  803ee4:	65 74 65             	gs je  803f4c <__rodata_start+0x22c>
+  803ee7:	72 00                	jb     803ee9 <__rodata_start+0x1c9>
+  803ee9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803eea:	75 74                	jne    803f60 <__rodata_start+0x240>
+  803eec:	20 6f 66             	and    %ch,0x66(%rdi)
+  803eef:	20 6d 65             	and    %ch,0x65(%rbp)
+  803ef2:	6d                   	insl   (%dx),%es:(%rdi)
+  803ef3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ef4:	72 79                	jb     803f6f <__rodata_start+0x24f>
+  803ef6:	00 6f 75             	add    %ch,0x75(%rdi)
+  803ef9:	74 20                	je     803f1b <__rodata_start+0x1fb>
+  803efb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803efc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803f00:	76 69                	jbe    803f6b <__rodata_start+0x24b>
+  803f02:	72 6f                	jb     803f73 <__rodata_start+0x253>
+  803f04:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f05:	6d                   	insl   (%dx),%es:(%rdi)
+  803f06:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803f08:	74 73                	je     803f7d <__rodata_start+0x25d>
+  803f0a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803f0d:	72 72                	jb     803f81 <__rodata_start+0x261>
+  803f0f:	75 70                	jne    803f81 <__rodata_start+0x261>
+  803f11:	74 65                	je     803f78 <__rodata_start+0x258>
+  803f13:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803f18:	75 67                	jne    803f81 <__rodata_start+0x261>
+  803f1a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803f1d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803f1f:	00 73 65             	add    %dh,0x65(%rbx)
+  803f22:	67 6d                	insl   (%dx),%es:(%edi)
+  803f24:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803f26:	74 61                	je     803f89 <__rodata_start+0x269>
+  803f28:	74 69                	je     803f93 <__rodata_start+0x273>
+  803f2a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f2b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f2c:	20 66 61             	and    %ah,0x61(%rsi)
+  803f2f:	75 6c                	jne    803f9d <__rodata_start+0x27d>
+  803f31:	74 00                	je     803f33 <__rodata_start+0x213>
+  803f33:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803f3a:	20 45 4c             	and    %al,0x4c(%rbp)
+  803f3d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803f41:	61                   	(bad)
+  803f42:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803f47:	20 73 75             	and    %dh,0x75(%rbx)
+  803f4a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803f4d:	73 79                	jae    803fc8 <__rodata_start+0x2a8>
+  803f4f:	73 74                	jae    803fc5 <__rodata_start+0x2a5>
+  803f51:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803f53:	20 63 61             	and    %ah,0x61(%rbx)
+  803f56:	6c                   	insb   (%dx),%es:(%rdi)
+  803f57:	6c                   	insb   (%dx),%es:(%rdi)
+  803f58:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803f5b:	74 72                	je     803fcf <__rodata_start+0x2af>
+  803f5d:	79 20                	jns    803f7f <__rodata_start+0x25f>
+  803f5f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f60:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f61:	74 20                	je     803f83 <__rodata_start+0x263>
+  803f63:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803f65:	75 6e                	jne    803fd5 <__rodata_start+0x2b5>
+  803f67:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803f6b:	76 20                	jbe    803f8d <__rodata_start+0x26d>
+  803f6d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803f74:	72 65                	jb     803fdb <__rodata_start+0x2bb>
+  803f76:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803f79:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f7a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803f7e:	65 78 70             	gs js  803ff1 <__rodata_start+0x2d1>
+  803f81:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803f86:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803f89:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803f8d:	20 66 69             	and    %ah,0x69(%rsi)
+  803f90:	6c                   	insb   (%dx),%es:(%rdi)
+  803f91:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803f95:	20 66 72             	and    %ah,0x72(%rsi)
+  803f98:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803f9d:	61                   	(bad)
+  803f9e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803fa1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803fa2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803fa3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803fa7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803faa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803fab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803fac:	20 6d 61             	and    %ch,0x61(%rbp)
+  803faf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803fb0:	79 20                	jns    803fd2 <__rodata_start+0x2b2>
+  803fb2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803fb9:	72 65                	jb     804020 <__rodata_start+0x300>
+  803fbb:	20 6f 70             	and    %ch,0x70(%rdi)
+  803fbe:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803fc0:	00 66 69             	add    %ah,0x69(%rsi)
+  803fc3:	6c                   	insb   (%dx),%es:(%rdi)
+  803fc4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803fc8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803fcb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803fcc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803fcf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803fd0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803fd1:	74 20                	je     803ff3 <__rodata_start+0x2d3>
+  803fd3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803fd5:	75 6e                	jne    804045 <__rodata_start+0x325>
+  803fd7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803fdb:	76 61                	jbe    80403e <__rodata_start+0x31e>
+  803fdd:	6c                   	insb   (%dx),%es:(%rdi)
+  803fde:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803fe5:	00 
+  803fe6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803fed:	72 65                	jb     804054 <__rodata_start+0x334>
+  803fef:	61                   	(bad)
+  803ff0:	64 79 20             	fs jns 804013 <__rodata_start+0x2f3>
+  803ff3:	65 78 69             	gs js  80405f <__rodata_start+0x33f>
+  803ff6:	73 74                	jae    80406c <__rodata_start+0x34c>
+  803ff8:	73 00                	jae    803ffa <__rodata_start+0x2da>
+  803ffa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ffb:	70 65                	jo     804062 <__rodata_start+0x342>
+  803ffd:	72 61                	jb     804060 <__rodata_start+0x340>
+  803fff:	74 69                	je     80406a <__rodata_start+0x34a>
+  804001:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804002:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804003:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804006:	74 20                	je     804028 <__rodata_start+0x308>
+  804008:	73 75                	jae    80407f <__rodata_start+0x35f>
+  80400a:	70 70                	jo     80407c <__rodata_start+0x35c>
+  80400c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80400d:	72 74                	jb     804083 <__rodata_start+0x363>
+  80400f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  804014:	65 72 61             	gs jb  804078 <__rodata_start+0x358>
+  804017:	74 69                	je     804082 <__rodata_start+0x362>
+  804019:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80401a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80401b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80401e:	74 20                	je     804040 <__rodata_start+0x320>
+  804020:	70 65                	jo     804087 <__rodata_start+0x367>
+  804022:	72 6d                	jb     804091 <__rodata_start+0x371>
+  804024:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  80402b:	2e 
+  80402c:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804033:	00 
+  804034:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80403b:	00 00 00 
+  80403e:	66 90                	xchg   %ax,%ax
+  804040:	e4 10                	in     $0x10,%al
+  804042:	80 00 00             	addb   $0x0,(%rax)
+  804045:	00 00                	add    %al,(%rax)
+  804047:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c064 <__bss_end+0x3064>
+  80404d:	00 00                	add    %al,(%rax)
+  80404f:	00 15 17 80 00 00    	add    %dl,0x8017(%rip)        # 80c06c <__bss_end+0x306c>
+  804055:	00 00                	add    %al,(%rax)
+  804057:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c074 <__bss_end+0x3074>
+  80405d:	00 00                	add    %al,(%rax)
+  80405f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c07c <__bss_end+0x307c>
+  804065:	00 00                	add    %al,(%rax)
+  804067:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c084 <__bss_end+0x3084>
+  80406d:	00 00                	add    %al,(%rax)
+  80406f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c08c <__bss_end+0x308c>
+  804075:	00 00                	add    %al,(%rax)
+  804077:	00 03                	add    %al,(%rbx)
+  804079:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80407f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c09c <__bss_end+0x309c>
+  804085:	00 00                	add    %al,(%rax)
+  804087:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c0a4 <__bss_end+0x30a4>
+  80408d:	00 00                	add    %al,(%rax)
+  80408f:	00 f7                	add    %dh,%bh
+  804091:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+  804097:	00 71 11             	add    %dh,0x11(%rcx)
+  80409a:	80 00 00             	addb   $0x0,(%rax)
+  80409d:	00 00                	add    %al,(%rax)
+  80409f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c0bc <__bss_end+0x30bc>
+  8040a5:	00 00                	add    %al,(%rax)
+  8040a7:	00 f7                	add    %dh,%bh
+  8040a9:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+  8040af:	00 3d 11 80 00 00    	add    %bh,0x8011(%rip)        # 80c0c6 <__bss_end+0x30c6>
+  8040b5:	00 00                	add    %al,(%rax)
+  8040b7:	00 3d 11 80 00 00    	add    %bh,0x8011(%rip)        # 80c0ce <__bss_end+0x30ce>
+  8040bd:	00 00                	add    %al,(%rax)
+  8040bf:	00 3d 11 80 00 00    	add    %bh,0x8011(%rip)        # 80c0d6 <__bss_end+0x30d6>
+  8040c5:	00 00                	add    %al,(%rax)
+  8040c7:	00 3d 11 80 00 00    	add    %bh,0x8011(%rip)        # 80c0de <__bss_end+0x30de>
+  8040cd:	00 00                	add    %al,(%rax)
+  8040cf:	00 3d 11 80 00 00    	add    %bh,0x8011(%rip)        # 80c0e6 <__bss_end+0x30e6>
+  8040d5:	00 00                	add    %al,(%rax)
+  8040d7:	00 3d 11 80 00 00    	add    %bh,0x8011(%rip)        # 80c0ee <__bss_end+0x30ee>
+  8040dd:	00 00                	add    %al,(%rax)
+  8040df:	00 3d 11 80 00 00    	add    %bh,0x8011(%rip)        # 80c0f6 <__bss_end+0x30f6>
+  8040e5:	00 00                	add    %al,(%rax)
+  8040e7:	00 3d 11 80 00 00    	add    %bh,0x8011(%rip)        # 80c0fe <__bss_end+0x30fe>
+  8040ed:	00 00                	add    %al,(%rax)
+  8040ef:	00 3d 11 80 00 00    	add    %bh,0x8011(%rip)        # 80c106 <__bss_end+0x3106>
+  8040f5:	00 00                	add    %al,(%rax)
+  8040f7:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c114 <__bss_end+0x3114>
+  8040fd:	00 00                	add    %al,(%rax)
+  8040ff:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c11c <__bss_end+0x311c>
+  804105:	00 00                	add    %al,(%rax)
+  804107:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c124 <__bss_end+0x3124>
+  80410d:	00 00                	add    %al,(%rax)
+  80410f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c12c <__bss_end+0x312c>
+  804115:	00 00                	add    %al,(%rax)
+  804117:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c134 <__bss_end+0x3134>
+  80411d:	00 00                	add    %al,(%rax)
+  80411f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c13c <__bss_end+0x313c>
+  804125:	00 00                	add    %al,(%rax)
+  804127:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c144 <__bss_end+0x3144>
+  80412d:	00 00                	add    %al,(%rax)
+  80412f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c14c <__bss_end+0x314c>
+  804135:	00 00                	add    %al,(%rax)
+  804137:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c154 <__bss_end+0x3154>
+  80413d:	00 00                	add    %al,(%rax)
+  80413f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c15c <__bss_end+0x315c>
+  804145:	00 00                	add    %al,(%rax)
+  804147:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c164 <__bss_end+0x3164>
+  80414d:	00 00                	add    %al,(%rax)
+  80414f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c16c <__bss_end+0x316c>
+  804155:	00 00                	add    %al,(%rax)
+  804157:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c174 <__bss_end+0x3174>
+  80415d:	00 00                	add    %al,(%rax)
+  80415f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c17c <__bss_end+0x317c>
+  804165:	00 00                	add    %al,(%rax)
+  804167:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c184 <__bss_end+0x3184>
+  80416d:	00 00                	add    %al,(%rax)
+  80416f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c18c <__bss_end+0x318c>
+  804175:	00 00                	add    %al,(%rax)
+  804177:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c194 <__bss_end+0x3194>
+  80417d:	00 00                	add    %al,(%rax)
+  80417f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c19c <__bss_end+0x319c>
+  804185:	00 00                	add    %al,(%rax)
+  804187:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c1a4 <__bss_end+0x31a4>
+  80418d:	00 00                	add    %al,(%rax)
+  80418f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c1ac <__bss_end+0x31ac>
+  804195:	00 00                	add    %al,(%rax)
+  804197:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c1b4 <__bss_end+0x31b4>
+  80419d:	00 00                	add    %al,(%rax)
+  80419f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c1bc <__bss_end+0x31bc>
+  8041a5:	00 00                	add    %al,(%rax)
+  8041a7:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c1c4 <__bss_end+0x31c4>
+  8041ad:	00 00                	add    %al,(%rax)
+  8041af:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c1cc <__bss_end+0x31cc>
+  8041b5:	00 00                	add    %al,(%rax)
+  8041b7:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c1d4 <__bss_end+0x31d4>
+  8041bd:	00 00                	add    %al,(%rax)
+  8041bf:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c1dc <__bss_end+0x31dc>
+  8041c5:	00 00                	add    %al,(%rax)
+  8041c7:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c1e4 <__bss_end+0x31e4>
+  8041cd:	00 00                	add    %al,(%rax)
+  8041cf:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c1ec <__bss_end+0x31ec>
+  8041d5:	00 00                	add    %al,(%rax)
+  8041d7:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c1f4 <__bss_end+0x31f4>
+  8041dd:	00 00                	add    %al,(%rax)
+  8041df:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c1fc <__bss_end+0x31fc>
+  8041e5:	00 00                	add    %al,(%rax)
+  8041e7:	00 48 16             	add    %cl,0x16(%rax)
+  8041ea:	80 00 00             	addb   $0x0,(%rax)
+  8041ed:	00 00                	add    %al,(%rax)
+  8041ef:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c20c <__bss_end+0x320c>
+  8041f5:	00 00                	add    %al,(%rax)
+  8041f7:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c214 <__bss_end+0x3214>
+  8041fd:	00 00                	add    %al,(%rax)
+  8041ff:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c21c <__bss_end+0x321c>
+  804205:	00 00                	add    %al,(%rax)
+  804207:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c224 <__bss_end+0x3224>
+  80420d:	00 00                	add    %al,(%rax)
+  80420f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c22c <__bss_end+0x322c>
+  804215:	00 00                	add    %al,(%rax)
+  804217:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c234 <__bss_end+0x3234>
+  80421d:	00 00                	add    %al,(%rax)
+  80421f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c23c <__bss_end+0x323c>
+  804225:	00 00                	add    %al,(%rax)
+  804227:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c244 <__bss_end+0x3244>
+  80422d:	00 00                	add    %al,(%rax)
+  80422f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c24c <__bss_end+0x324c>
+  804235:	00 00                	add    %al,(%rax)
+  804237:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c254 <__bss_end+0x3254>
+  80423d:	00 00                	add    %al,(%rax)
+  80423f:	00 94 11 80 00 00 00 	add    %dl,0x80(%rcx,%rdx,1)
+  804246:	00 00                	add    %al,(%rax)
+  804248:	63 13                	movsxd (%rbx),%edx
+  80424a:	80 00 00             	addb   $0x0,(%rax)
+  80424d:	00 00                	add    %al,(%rax)
+  80424f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c26c <__bss_end+0x326c>
+  804255:	00 00                	add    %al,(%rax)
+  804257:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c274 <__bss_end+0x3274>
+  80425d:	00 00                	add    %al,(%rax)
+  80425f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c27c <__bss_end+0x327c>
+  804265:	00 00                	add    %al,(%rax)
+  804267:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c284 <__bss_end+0x3284>
+  80426d:	00 00                	add    %al,(%rax)
+  80426f:	00 c3                	add    %al,%bl
+  804271:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  804277:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c294 <__bss_end+0x3294>
+  80427d:	00 00                	add    %al,(%rax)
+  80427f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c29c <__bss_end+0x329c>
+  804285:	00 00                	add    %al,(%rax)
+  804287:	00 89 11 80 00 00    	add    %cl,0x8011(%rcx)
+  80428d:	00 00                	add    %al,(%rax)
+  80428f:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c2ac <__bss_end+0x32ac>
+  804295:	00 00                	add    %al,(%rax)
+  804297:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c2b4 <__bss_end+0x32b4>
+  80429d:	00 00                	add    %al,(%rax)
+  80429f:	00 0b                	add    %cl,(%rbx)
+  8042a1:	15 80 00 00 00       	adc    $0x80,%eax
+  8042a6:	00 00                	add    %al,(%rax)
+  8042a8:	d5                   	(bad)
+  8042a9:	15 80 00 00 00       	adc    $0x80,%eax
+  8042ae:	00 00                	add    %al,(%rax)
+  8042b0:	25 17 80 00 00       	and    $0x8017,%eax
+  8042b5:	00 00                	add    %al,(%rax)
+  8042b7:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c2d4 <__bss_end+0x32d4>
+  8042bd:	00 00                	add    %al,(%rax)
+  8042bf:	00 5a 12             	add    %bl,0x12(%rdx)
+  8042c2:	80 00 00             	addb   $0x0,(%rax)
+  8042c5:	00 00                	add    %al,(%rax)
+  8042c7:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c2e4 <__bss_end+0x32e4>
+  8042cd:	00 00                	add    %al,(%rax)
+  8042cf:	00 37                	add    %dh,(%rdi)
+  8042d1:	14 80                	adc    $0x80,%al
+  8042d3:	00 00                	add    %al,(%rax)
+  8042d5:	00 00                	add    %al,(%rax)
+  8042d7:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c2f4 <__bss_end+0x32f4>
+  8042dd:	00 00                	add    %al,(%rax)
+  8042df:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c2fc <__bss_end+0x32fc>
+  8042e5:	00 00                	add    %al,(%rax)
+  8042e7:	00 48 16             	add    %cl,0x16(%rax)
+  8042ea:	80 00 00             	addb   $0x0,(%rax)
+  8042ed:	00 00                	add    %al,(%rax)
+  8042ef:	00 25 17 80 00 00    	add    %ah,0x8017(%rip)        # 80c30c <__bss_end+0x330c>
+  8042f5:	00 00                	add    %al,(%rax)
+  8042f7:	00 ed                	add    %ch,%ch
+  8042f9:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+	...
+
+0000000000804300 <error_string>:
+	...
+  804308:	b5 3e 80 00 00 00 00 00 c7 3e 80 00 00 00 00 00     .>.......>......
+  804318:	d7 3e 80 00 00 00 00 00 e9 3e 80 00 00 00 00 00     .>.......>......
+  804328:	f7 3e 80 00 00 00 00 00 0b 3f 80 00 00 00 00 00     .>.......?......
+  804338:	20 3f 80 00 00 00 00 00 33 3f 80 00 00 00 00 00      ?......3?......
+  804348:	45 3f 80 00 00 00 00 00 59 3f 80 00 00 00 00 00     E?......Y?......
+  804358:	69 3f 80 00 00 00 00 00 7c 3f 80 00 00 00 00 00     i?......|?......
+  804368:	93 3f 80 00 00 00 00 00 a9 3f 80 00 00 00 00 00     .?.......?......
+  804378:	c1 3f 80 00 00 00 00 00 d9 3f 80 00 00 00 00 00     .?.......?......
+  804388:	e6 3f 80 00 00 00 00 00 b0 43 80 00 00 00 00 00     .?.......C......
+  804398:	fa 3f 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .?..............
+  8043a8:	12 40 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .@......file is 
+  8043b8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8043c8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8043d8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8043e8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8043f8:	6c 6c 2e 63 00 0f 1f 00 55 73 65 72 73 70 61 63     ll.c....Userspac
+  804408:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  804418:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  804428:	65 72 72 3d 25 78 0a 00 61 64 64 5f 70 67 66 61     err=%x..add_pgfa
+  804438:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  804448:	5f 61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61     _alloc_region fa
+  804458:	69 6c 65 64 00 00 00 00 61 64 64 5f 70 67 66 61     iled....add_pgfa
+  804468:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  804478:	5f 65 6e 76 5f 73 65 74 5f 70 67 66 61 75 6c 74     _env_set_pgfault
+  804488:	5f 75 70 63 61 6c 6c 20 66 61 69 6c 65 64 00 6c     _upcall failed.l
+  804498:	69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65 74     ib/pgfault.c.set
+  8044a8:	5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65 72     _pgfault_handler
+  8044b8:	3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72 5f     : %i._pfhandler_
+  8044c8:	69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00 61     inititiallized.a
+  8044d8:	73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65 64 3a     ssertion failed:
+  8044e8:	20 25 73 00 0f 1f 40 00 5b 25 30 38 78 5d 20 75      %s...@.[%08x] u
+  8044f8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804508:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  804518:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804528:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804538:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804548:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804558:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804568:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804578:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000804580 <devtab>:
+  804580:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804590:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  8045a0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8045b0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8045c0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8045d0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 0f 1f 40 00     _SIZE) == 2...@.
+  8045e0:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  8045f0:	20 62 65 67 69 6e 20 67 65 6e 65 72 69 63 20 68      begin generic h
+  804600:	61 6e 64 6c 65 72 20 66 6f 72 20 25 64 0a 00 00     andler for %d...
+  804610:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  804620:	20 65 78 69 74 69 6e 67 20 64 75 65 20 74 6f 20      exiting due to 
+  804630:	73 69 67 6e 61 6c 20 25 64 0a 00 00 00 00 00 00     signal %d.......
+  804640:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  804650:	20 69 67 6e 6f 72 69 6e 67 20 73 69 67 6e 61 6c      ignoring signal
+  804660:	20 25 64 0a 00 00 00 00 73 69 67 6e 61 6c 73 3a      %d.....signals:
+  804670:	20 65 6e 76 20 25 78 3a 20 65 6e 64 20 67 65 6e      env %x: end gen
+  804680:	65 72 69 63 20 68 61 6e 64 6c 65 72 20 66 6f 72     eric handler for
+  804690:	20 25 64 0a 00 66 61 6c 73 65 00 6c 69 62 2f 73      %d..false.lib/s
+  8046a0:	69 67 6e 61 6c 2e 63 00 3c 63 6f 6e 73 3e 00 63     ignal.c.<cons>.c
+  8046b0:	6f 6e 73 00 69 70 63 5f 73 65 6e 64 3a 20 66 61     ons.ipc_send: fa
+  8046c0:	69 6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62     iled to send.lib
+  8046d0:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8046e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8046f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804700:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804710:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804720:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804730:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804740:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804750:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804760:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804770:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804780:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804790:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8047a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8047b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8047c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8047d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8047e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8047f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8048a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8048b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8048c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8048d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8048e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8048f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8049b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8049c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8049d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8049e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
@@ -0,0 +1,5381 @@
+
+obj/user/faultwrite:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 0e 00 00 00       	call   800031 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+#ifndef __clang_analyzer__
+    *(volatile unsigned *)0 = 0;
+  800025:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80002c:	00 00 00 00 
+#endif
+}
+  800030:	c3                   	ret
+
+0000000000800031 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800031:	55                   	push   %rbp
+  800032:	48 89 e5             	mov    %rsp,%rbp
+  800035:	41 56                	push   %r14
+  800037:	41 55                	push   %r13
+  800039:	41 54                	push   %r12
+  80003b:	53                   	push   %rbx
+  80003c:	41 89 fd             	mov    %edi,%r13d
+  80003f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800042:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800049:	00 00 00 
+  80004c:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800053:	00 00 00 
+  800056:	48 39 c2             	cmp    %rax,%rdx
+  800059:	73 17                	jae    800072 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80005b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005e:	49 89 c4             	mov    %rax,%r12
+  800061:	48 83 c3 08          	add    $0x8,%rbx
+  800065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006a:	ff 53 f8             	call   *-0x8(%rbx)
+  80006d:	4c 39 e3             	cmp    %r12,%rbx
+  800070:	72 ef                	jb     800061 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800072:	48 b8 c4 01 80 00 00 	movabs $0x8001c4,%rax
+  800079:	00 00 00 
+  80007c:	ff d0                	call   *%rax
+  80007e:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800081:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800088:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80008f:	00 00 00 
+  800092:	48 01 d0             	add    %rdx,%rax
+  800095:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80009c:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80009f:	45 85 ed             	test   %r13d,%r13d
+  8000a2:	7e 0d                	jle    8000b1 <libmain+0x80>
+  8000a4:	49 8b 06             	mov    (%r14),%rax
+  8000a7:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000ae:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000b1:	4c 89 f6             	mov    %r14,%rsi
+  8000b4:	44 89 ef             	mov    %r13d,%edi
+  8000b7:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000be:	00 00 00 
+  8000c1:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000c3:	48 b8 d8 00 80 00 00 	movabs $0x8000d8,%rax
+  8000ca:	00 00 00 
+  8000cd:	ff d0                	call   *%rax
+#endif
+}
+  8000cf:	5b                   	pop    %rbx
+  8000d0:	41 5c                	pop    %r12
+  8000d2:	41 5d                	pop    %r13
+  8000d4:	41 5e                	pop    %r14
+  8000d6:	5d                   	pop    %rbp
+  8000d7:	c3                   	ret
+
+00000000008000d8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000d8:	55                   	push   %rbp
+  8000d9:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000dc:	48 b8 4c 0a 80 00 00 	movabs $0x800a4c,%rax
+  8000e3:	00 00 00 
+  8000e6:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ed:	48 b8 59 01 80 00 00 	movabs $0x800159,%rax
+  8000f4:	00 00 00 
+  8000f7:	ff d0                	call   *%rax
+}
+  8000f9:	5d                   	pop    %rbp
+  8000fa:	c3                   	ret
+
+00000000008000fb <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000fb:	55                   	push   %rbp
+  8000fc:	48 89 e5             	mov    %rsp,%rbp
+  8000ff:	53                   	push   %rbx
+  800100:	48 89 fa             	mov    %rdi,%rdx
+  800103:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800106:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80010b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800110:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800115:	be 00 00 00 00       	mov    $0x0,%esi
+  80011a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800120:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800122:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800126:	c9                   	leave
+  800127:	c3                   	ret
+
+0000000000800128 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800128:	55                   	push   %rbp
+  800129:	48 89 e5             	mov    %rsp,%rbp
+  80012c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80012d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800132:	ba 00 00 00 00       	mov    $0x0,%edx
+  800137:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80013c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800141:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800146:	be 00 00 00 00       	mov    $0x0,%esi
+  80014b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800151:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800153:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800157:	c9                   	leave
+  800158:	c3                   	ret
+
+0000000000800159 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800159:	55                   	push   %rbp
+  80015a:	48 89 e5             	mov    %rsp,%rbp
+  80015d:	53                   	push   %rbx
+  80015e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800162:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800165:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80016a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80016f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800174:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800179:	be 00 00 00 00       	mov    $0x0,%esi
+  80017e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800184:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800186:	48 85 c0             	test   %rax,%rax
+  800189:	7f 06                	jg     800191 <sys_env_destroy+0x38>
+}
+  80018b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80018f:	c9                   	leave
+  800190:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800191:	49 89 c0             	mov    %rax,%r8
+  800194:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800199:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  8001a0:	00 00 00 
+  8001a3:	be 26 00 00 00       	mov    $0x26,%esi
+  8001a8:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  8001af:	00 00 00 
+  8001b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b7:	49 b9 f9 1a 80 00 00 	movabs $0x801af9,%r9
+  8001be:	00 00 00 
+  8001c1:	41 ff d1             	call   *%r9
+
+00000000008001c4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001c4:	55                   	push   %rbp
+  8001c5:	48 89 e5             	mov    %rsp,%rbp
+  8001c8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001c9:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001ed:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f3:	c9                   	leave
+  8001f4:	c3                   	ret
+
+00000000008001f5 <sys_yield>:
+
+void
+sys_yield(void) {
+  8001f5:	55                   	push   %rbp
+  8001f6:	48 89 e5             	mov    %rsp,%rbp
+  8001f9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001fa:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800204:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800209:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80020e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800213:	be 00 00 00 00       	mov    $0x0,%esi
+  800218:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80021e:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800220:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800224:	c9                   	leave
+  800225:	c3                   	ret
+
+0000000000800226 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800226:	55                   	push   %rbp
+  800227:	48 89 e5             	mov    %rsp,%rbp
+  80022a:	53                   	push   %rbx
+  80022b:	48 89 fa             	mov    %rdi,%rdx
+  80022e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800231:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800236:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80023d:	00 00 00 
+  800240:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800245:	be 00 00 00 00       	mov    $0x0,%esi
+  80024a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800250:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800252:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800256:	c9                   	leave
+  800257:	c3                   	ret
+
+0000000000800258 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800258:	55                   	push   %rbp
+  800259:	48 89 e5             	mov    %rsp,%rbp
+  80025c:	53                   	push   %rbx
+  80025d:	49 89 f8             	mov    %rdi,%r8
+  800260:	48 89 d3             	mov    %rdx,%rbx
+  800263:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800266:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80026b:	4c 89 c2             	mov    %r8,%rdx
+  80026e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800271:	be 00 00 00 00       	mov    $0x0,%esi
+  800276:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80027c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80027e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800282:	c9                   	leave
+  800283:	c3                   	ret
+
+0000000000800284 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800284:	55                   	push   %rbp
+  800285:	48 89 e5             	mov    %rsp,%rbp
+  800288:	53                   	push   %rbx
+  800289:	48 83 ec 08          	sub    $0x8,%rsp
+  80028d:	89 f8                	mov    %edi,%eax
+  80028f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800292:	48 63 f9             	movslq %ecx,%rdi
+  800295:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800298:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80029d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002ab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002ad:	48 85 c0             	test   %rax,%rax
+  8002b0:	7f 06                	jg     8002b8 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002b6:	c9                   	leave
+  8002b7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002b8:	49 89 c0             	mov    %rax,%r8
+  8002bb:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002c0:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  8002c7:	00 00 00 
+  8002ca:	be 26 00 00 00       	mov    $0x26,%esi
+  8002cf:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  8002d6:	00 00 00 
+  8002d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002de:	49 b9 f9 1a 80 00 00 	movabs $0x801af9,%r9
+  8002e5:	00 00 00 
+  8002e8:	41 ff d1             	call   *%r9
+
+00000000008002eb <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002eb:	55                   	push   %rbp
+  8002ec:	48 89 e5             	mov    %rsp,%rbp
+  8002ef:	53                   	push   %rbx
+  8002f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8002f4:	89 f8                	mov    %edi,%eax
+  8002f6:	49 89 f2             	mov    %rsi,%r10
+  8002f9:	48 89 cf             	mov    %rcx,%rdi
+  8002fc:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002ff:	48 63 da             	movslq %edx,%rbx
+  800302:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800305:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80030a:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80030d:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800310:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800312:	48 85 c0             	test   %rax,%rax
+  800315:	7f 06                	jg     80031d <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800317:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80031b:	c9                   	leave
+  80031c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80031d:	49 89 c0             	mov    %rax,%r8
+  800320:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800325:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  80032c:	00 00 00 
+  80032f:	be 26 00 00 00       	mov    $0x26,%esi
+  800334:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  80033b:	00 00 00 
+  80033e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800343:	49 b9 f9 1a 80 00 00 	movabs $0x801af9,%r9
+  80034a:	00 00 00 
+  80034d:	41 ff d1             	call   *%r9
+
+0000000000800350 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	53                   	push   %rbx
+  800355:	48 83 ec 08          	sub    $0x8,%rsp
+  800359:	48 89 f1             	mov    %rsi,%rcx
+  80035c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80035f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800362:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800367:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80036c:	be 00 00 00 00       	mov    $0x0,%esi
+  800371:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800377:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800379:	48 85 c0             	test   %rax,%rax
+  80037c:	7f 06                	jg     800384 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80037e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800382:	c9                   	leave
+  800383:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800384:	49 89 c0             	mov    %rax,%r8
+  800387:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80038c:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  800393:	00 00 00 
+  800396:	be 26 00 00 00       	mov    $0x26,%esi
+  80039b:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  8003a2:	00 00 00 
+  8003a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003aa:	49 b9 f9 1a 80 00 00 	movabs $0x801af9,%r9
+  8003b1:	00 00 00 
+  8003b4:	41 ff d1             	call   *%r9
+
+00000000008003b7 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8003b7:	55                   	push   %rbp
+  8003b8:	48 89 e5             	mov    %rsp,%rbp
+  8003bb:	53                   	push   %rbx
+  8003bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8003c0:	89 f8                	mov    %edi,%eax
+  8003c2:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8003c5:	48 63 f9             	movslq %ecx,%rdi
+  8003c8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003cb:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003d0:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8003d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003de:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003e0:	48 85 c0             	test   %rax,%rax
+  8003e3:	7f 06                	jg     8003eb <sys_region_advise+0x34>
+}
+  8003e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003e9:	c9                   	leave
+  8003ea:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003eb:	49 89 c0             	mov    %rax,%r8
+  8003ee:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8003f3:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  8003fa:	00 00 00 
+  8003fd:	be 26 00 00 00       	mov    $0x26,%esi
+  800402:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  800409:	00 00 00 
+  80040c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800411:	49 b9 f9 1a 80 00 00 	movabs $0x801af9,%r9
+  800418:	00 00 00 
+  80041b:	41 ff d1             	call   *%r9
+
+000000000080041e <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  80041e:	55                   	push   %rbp
+  80041f:	48 89 e5             	mov    %rsp,%rbp
+  800422:	53                   	push   %rbx
+  800423:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  800427:	48 63 ce             	movslq %esi,%rcx
+  80042a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80042d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800432:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800437:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80043c:	be 00 00 00 00       	mov    $0x0,%esi
+  800441:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800447:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800449:	48 85 c0             	test   %rax,%rax
+  80044c:	7f 06                	jg     800454 <sys_env_set_nice+0x36>
+}
+  80044e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800452:	c9                   	leave
+  800453:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800454:	49 89 c0             	mov    %rax,%r8
+  800457:	b9 15 00 00 00       	mov    $0x15,%ecx
+  80045c:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  800463:	00 00 00 
+  800466:	be 26 00 00 00       	mov    $0x26,%esi
+  80046b:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  800472:	00 00 00 
+  800475:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047a:	49 b9 f9 1a 80 00 00 	movabs $0x801af9,%r9
+  800481:	00 00 00 
+  800484:	41 ff d1             	call   *%r9
+
+0000000000800487 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800487:	55                   	push   %rbp
+  800488:	48 89 e5             	mov    %rsp,%rbp
+  80048b:	53                   	push   %rbx
+  80048c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800490:	48 63 ce             	movslq %esi,%rcx
+  800493:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800496:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80049b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8004aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004b0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004b2:	48 85 c0             	test   %rax,%rax
+  8004b5:	7f 06                	jg     8004bd <sys_env_set_status+0x36>
+}
+  8004b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004bb:	c9                   	leave
+  8004bc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004bd:	49 89 c0             	mov    %rax,%r8
+  8004c0:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004c5:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  8004cc:	00 00 00 
+  8004cf:	be 26 00 00 00       	mov    $0x26,%esi
+  8004d4:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  8004db:	00 00 00 
+  8004de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e3:	49 b9 f9 1a 80 00 00 	movabs $0x801af9,%r9
+  8004ea:	00 00 00 
+  8004ed:	41 ff d1             	call   *%r9
+
+00000000008004f0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8004f0:	55                   	push   %rbp
+  8004f1:	48 89 e5             	mov    %rsp,%rbp
+  8004f4:	53                   	push   %rbx
+  8004f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004f9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8004fc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004ff:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800504:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800509:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80050e:	be 00 00 00 00       	mov    $0x0,%esi
+  800513:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800519:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80051b:	48 85 c0             	test   %rax,%rax
+  80051e:	7f 06                	jg     800526 <sys_env_set_trapframe+0x36>
+}
+  800520:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800524:	c9                   	leave
+  800525:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800526:	49 89 c0             	mov    %rax,%r8
+  800529:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80052e:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  800535:	00 00 00 
+  800538:	be 26 00 00 00       	mov    $0x26,%esi
+  80053d:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  800544:	00 00 00 
+  800547:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054c:	49 b9 f9 1a 80 00 00 	movabs $0x801af9,%r9
+  800553:	00 00 00 
+  800556:	41 ff d1             	call   *%r9
+
+0000000000800559 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800559:	55                   	push   %rbp
+  80055a:	48 89 e5             	mov    %rsp,%rbp
+  80055d:	53                   	push   %rbx
+  80055e:	48 83 ec 08          	sub    $0x8,%rsp
+  800562:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800565:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800568:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80056d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800572:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800577:	be 00 00 00 00       	mov    $0x0,%esi
+  80057c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800582:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800584:	48 85 c0             	test   %rax,%rax
+  800587:	7f 06                	jg     80058f <sys_env_set_pgfault_upcall+0x36>
+}
+  800589:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80058d:	c9                   	leave
+  80058e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80058f:	49 89 c0             	mov    %rax,%r8
+  800592:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800597:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  80059e:	00 00 00 
+  8005a1:	be 26 00 00 00       	mov    $0x26,%esi
+  8005a6:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  8005ad:	00 00 00 
+  8005b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b5:	49 b9 f9 1a 80 00 00 	movabs $0x801af9,%r9
+  8005bc:	00 00 00 
+  8005bf:	41 ff d1             	call   *%r9
+
+00000000008005c2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8005c2:	55                   	push   %rbp
+  8005c3:	48 89 e5             	mov    %rsp,%rbp
+  8005c6:	53                   	push   %rbx
+  8005c7:	89 f8                	mov    %edi,%eax
+  8005c9:	49 89 f1             	mov    %rsi,%r9
+  8005cc:	48 89 d3             	mov    %rdx,%rbx
+  8005cf:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8005d2:	49 63 f0             	movslq %r8d,%rsi
+  8005d5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005d8:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005dd:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005e6:	cd 30                	int    $0x30
+}
+  8005e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005ec:	c9                   	leave
+  8005ed:	c3                   	ret
+
+00000000008005ee <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8005ee:	55                   	push   %rbp
+  8005ef:	48 89 e5             	mov    %rsp,%rbp
+  8005f2:	53                   	push   %rbx
+  8005f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8005f7:	48 89 fa             	mov    %rdi,%rdx
+  8005fa:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8005fd:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800602:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800607:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800617:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800619:	48 85 c0             	test   %rax,%rax
+  80061c:	7f 06                	jg     800624 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80061e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800622:	c9                   	leave
+  800623:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800624:	49 89 c0             	mov    %rax,%r8
+  800627:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80062c:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  800633:	00 00 00 
+  800636:	be 26 00 00 00       	mov    $0x26,%esi
+  80063b:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  800642:	00 00 00 
+  800645:	b8 00 00 00 00       	mov    $0x0,%eax
+  80064a:	49 b9 f9 1a 80 00 00 	movabs $0x801af9,%r9
+  800651:	00 00 00 
+  800654:	41 ff d1             	call   *%r9
+
+0000000000800657 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800657:	55                   	push   %rbp
+  800658:	48 89 e5             	mov    %rsp,%rbp
+  80065b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80065c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800661:	ba 00 00 00 00       	mov    $0x0,%edx
+  800666:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80066b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800670:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800675:	be 00 00 00 00       	mov    $0x0,%esi
+  80067a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800680:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800682:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800686:	c9                   	leave
+  800687:	c3                   	ret
+
+0000000000800688 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  800688:	55                   	push   %rbp
+  800689:	48 89 e5             	mov    %rsp,%rbp
+  80068c:	53                   	push   %rbx
+  80068d:	48 83 ec 08          	sub    $0x8,%rsp
+  800691:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  800694:	48 63 ce             	movslq %esi,%rcx
+  800697:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80069a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80069f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8006a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006af:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8006b1:	48 85 c0             	test   %rax,%rax
+  8006b4:	7f 06                	jg     8006bc <sys_sigqueue+0x34>
+}
+  8006b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006ba:	c9                   	leave
+  8006bb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006bc:	49 89 c0             	mov    %rax,%r8
+  8006bf:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8006c4:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  8006cb:	00 00 00 
+  8006ce:	be 26 00 00 00       	mov    $0x26,%esi
+  8006d3:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  8006da:	00 00 00 
+  8006dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e2:	49 b9 f9 1a 80 00 00 	movabs $0x801af9,%r9
+  8006e9:	00 00 00 
+  8006ec:	41 ff d1             	call   *%r9
+
+00000000008006ef <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8006ef:	55                   	push   %rbp
+  8006f0:	48 89 e5             	mov    %rsp,%rbp
+  8006f3:	53                   	push   %rbx
+  8006f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8006f8:	48 89 fa             	mov    %rdi,%rdx
+  8006fb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8006fe:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800703:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800708:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80070d:	be 00 00 00 00       	mov    $0x0,%esi
+  800712:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800718:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80071a:	48 85 c0             	test   %rax,%rax
+  80071d:	7f 06                	jg     800725 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  80071f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800723:	c9                   	leave
+  800724:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800725:	49 89 c0             	mov    %rax,%r8
+  800728:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80072d:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  800734:	00 00 00 
+  800737:	be 26 00 00 00       	mov    $0x26,%esi
+  80073c:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  800743:	00 00 00 
+  800746:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074b:	49 b9 f9 1a 80 00 00 	movabs $0x801af9,%r9
+  800752:	00 00 00 
+  800755:	41 ff d1             	call   *%r9
+
+0000000000800758 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  800758:	55                   	push   %rbp
+  800759:	48 89 e5             	mov    %rsp,%rbp
+  80075c:	53                   	push   %rbx
+  80075d:	48 83 ec 08          	sub    $0x8,%rsp
+  800761:	48 89 f1             	mov    %rsi,%rcx
+  800764:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  800767:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80076a:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80076f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800774:	be 00 00 00 00       	mov    $0x0,%esi
+  800779:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80077f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800781:	48 85 c0             	test   %rax,%rax
+  800784:	7f 06                	jg     80078c <sys_sigaction+0x34>
+}
+  800786:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80078a:	c9                   	leave
+  80078b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80078c:	49 89 c0             	mov    %rax,%r8
+  80078f:	b9 12 00 00 00       	mov    $0x12,%ecx
+  800794:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  80079b:	00 00 00 
+  80079e:	be 26 00 00 00       	mov    $0x26,%esi
+  8007a3:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  8007aa:	00 00 00 
+  8007ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b2:	49 b9 f9 1a 80 00 00 	movabs $0x801af9,%r9
+  8007b9:	00 00 00 
+  8007bc:	41 ff d1             	call   *%r9
+
+00000000008007bf <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8007bf:	55                   	push   %rbp
+  8007c0:	48 89 e5             	mov    %rsp,%rbp
+  8007c3:	53                   	push   %rbx
+  8007c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8007c8:	48 89 f1             	mov    %rsi,%rcx
+  8007cb:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8007ce:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8007d1:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8007d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007db:	be 00 00 00 00       	mov    $0x0,%esi
+  8007e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8007e6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8007e8:	48 85 c0             	test   %rax,%rax
+  8007eb:	7f 06                	jg     8007f3 <sys_sigprocmask+0x34>
+}
+  8007ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007f1:	c9                   	leave
+  8007f2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007f3:	49 89 c0             	mov    %rax,%r8
+  8007f6:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8007fb:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  800802:	00 00 00 
+  800805:	be 26 00 00 00       	mov    $0x26,%esi
+  80080a:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  800811:	00 00 00 
+  800814:	b8 00 00 00 00       	mov    $0x0,%eax
+  800819:	49 b9 f9 1a 80 00 00 	movabs $0x801af9,%r9
+  800820:	00 00 00 
+  800823:	41 ff d1             	call   *%r9
+
+0000000000800826 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800826:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80082d:	ff ff ff 
+  800830:	48 01 f8             	add    %rdi,%rax
+  800833:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800837:	c3                   	ret
+
+0000000000800838 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800838:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80083f:	ff ff ff 
+  800842:	48 01 f8             	add    %rdi,%rax
+  800845:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800849:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80084f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800853:	c3                   	ret
+
+0000000000800854 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800854:	55                   	push   %rbp
+  800855:	48 89 e5             	mov    %rsp,%rbp
+  800858:	41 57                	push   %r15
+  80085a:	41 56                	push   %r14
+  80085c:	41 55                	push   %r13
+  80085e:	41 54                	push   %r12
+  800860:	53                   	push   %rbx
+  800861:	48 83 ec 08          	sub    $0x8,%rsp
+  800865:	49 89 ff             	mov    %rdi,%r15
+  800868:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80086d:	49 bd d2 17 80 00 00 	movabs $0x8017d2,%r13
+  800874:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800877:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80087d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800880:	48 89 df             	mov    %rbx,%rdi
+  800883:	41 ff d5             	call   *%r13
+  800886:	83 e0 04             	and    $0x4,%eax
+  800889:	74 17                	je     8008a2 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80088b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800892:	4c 39 f3             	cmp    %r14,%rbx
+  800895:	75 e6                	jne    80087d <fd_alloc+0x29>
+  800897:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80089d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8008a2:	4d 89 27             	mov    %r12,(%r15)
+}
+  8008a5:	48 83 c4 08          	add    $0x8,%rsp
+  8008a9:	5b                   	pop    %rbx
+  8008aa:	41 5c                	pop    %r12
+  8008ac:	41 5d                	pop    %r13
+  8008ae:	41 5e                	pop    %r14
+  8008b0:	41 5f                	pop    %r15
+  8008b2:	5d                   	pop    %rbp
+  8008b3:	c3                   	ret
+
+00000000008008b4 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8008b4:	83 ff 1f             	cmp    $0x1f,%edi
+  8008b7:	77 39                	ja     8008f2 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8008b9:	55                   	push   %rbp
+  8008ba:	48 89 e5             	mov    %rsp,%rbp
+  8008bd:	41 54                	push   %r12
+  8008bf:	53                   	push   %rbx
+  8008c0:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8008c3:	48 63 df             	movslq %edi,%rbx
+  8008c6:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8008cd:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8008d1:	48 89 df             	mov    %rbx,%rdi
+  8008d4:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  8008db:	00 00 00 
+  8008de:	ff d0                	call   *%rax
+  8008e0:	a8 04                	test   $0x4,%al
+  8008e2:	74 14                	je     8008f8 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8008e4:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8008e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008ed:	5b                   	pop    %rbx
+  8008ee:	41 5c                	pop    %r12
+  8008f0:	5d                   	pop    %rbp
+  8008f1:	c3                   	ret
+        return -E_INVAL;
+  8008f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8008f7:	c3                   	ret
+        return -E_INVAL;
+  8008f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008fd:	eb ee                	jmp    8008ed <fd_lookup+0x39>
+
+00000000008008ff <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8008ff:	55                   	push   %rbp
+  800900:	48 89 e5             	mov    %rsp,%rbp
+  800903:	41 54                	push   %r12
+  800905:	53                   	push   %rbx
+  800906:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800909:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  800910:	00 00 00 
+  800913:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80091a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80091d:	39 3b                	cmp    %edi,(%rbx)
+  80091f:	74 47                	je     800968 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800921:	48 83 c0 08          	add    $0x8,%rax
+  800925:	48 8b 18             	mov    (%rax),%rbx
+  800928:	48 85 db             	test   %rbx,%rbx
+  80092b:	75 f0                	jne    80091d <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80092d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800934:	00 00 00 
+  800937:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80093d:	89 fa                	mov    %edi,%edx
+  80093f:	48 bf 60 2b 80 00 00 	movabs $0x802b60,%rdi
+  800946:	00 00 00 
+  800949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094e:	48 b9 49 1c 80 00 00 	movabs $0x801c49,%rcx
+  800955:	00 00 00 
+  800958:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80095a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80095f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800963:	5b                   	pop    %rbx
+  800964:	41 5c                	pop    %r12
+  800966:	5d                   	pop    %rbp
+  800967:	c3                   	ret
+            return 0;
+  800968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096d:	eb f0                	jmp    80095f <dev_lookup+0x60>
+
+000000000080096f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80096f:	55                   	push   %rbp
+  800970:	48 89 e5             	mov    %rsp,%rbp
+  800973:	41 55                	push   %r13
+  800975:	41 54                	push   %r12
+  800977:	53                   	push   %rbx
+  800978:	48 83 ec 18          	sub    $0x18,%rsp
+  80097c:	48 89 fb             	mov    %rdi,%rbx
+  80097f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800982:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800989:	ff ff ff 
+  80098c:	48 01 df             	add    %rbx,%rdi
+  80098f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800993:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800997:	48 b8 b4 08 80 00 00 	movabs $0x8008b4,%rax
+  80099e:	00 00 00 
+  8009a1:	ff d0                	call   *%rax
+  8009a3:	41 89 c5             	mov    %eax,%r13d
+  8009a6:	85 c0                	test   %eax,%eax
+  8009a8:	78 06                	js     8009b0 <fd_close+0x41>
+  8009aa:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8009ae:	74 1a                	je     8009ca <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8009b0:	45 84 e4             	test   %r12b,%r12b
+  8009b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b8:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8009bc:	44 89 e8             	mov    %r13d,%eax
+  8009bf:	48 83 c4 18          	add    $0x18,%rsp
+  8009c3:	5b                   	pop    %rbx
+  8009c4:	41 5c                	pop    %r12
+  8009c6:	41 5d                	pop    %r13
+  8009c8:	5d                   	pop    %rbp
+  8009c9:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8009ca:	8b 3b                	mov    (%rbx),%edi
+  8009cc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8009d0:	48 b8 ff 08 80 00 00 	movabs $0x8008ff,%rax
+  8009d7:	00 00 00 
+  8009da:	ff d0                	call   *%rax
+  8009dc:	41 89 c5             	mov    %eax,%r13d
+  8009df:	85 c0                	test   %eax,%eax
+  8009e1:	78 1b                	js     8009fe <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8009e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8009e7:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8009eb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8009f1:	48 85 c0             	test   %rax,%rax
+  8009f4:	74 08                	je     8009fe <fd_close+0x8f>
+  8009f6:	48 89 df             	mov    %rbx,%rdi
+  8009f9:	ff d0                	call   *%rax
+  8009fb:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8009fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a03:	48 89 de             	mov    %rbx,%rsi
+  800a06:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a0b:	48 b8 50 03 80 00 00 	movabs $0x800350,%rax
+  800a12:	00 00 00 
+  800a15:	ff d0                	call   *%rax
+    return res;
+  800a17:	eb a3                	jmp    8009bc <fd_close+0x4d>
+
+0000000000800a19 <close>:
+
+int
+close(int fdnum) {
+  800a19:	55                   	push   %rbp
+  800a1a:	48 89 e5             	mov    %rsp,%rbp
+  800a1d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800a21:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800a25:	48 b8 b4 08 80 00 00 	movabs $0x8008b4,%rax
+  800a2c:	00 00 00 
+  800a2f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800a31:	85 c0                	test   %eax,%eax
+  800a33:	78 15                	js     800a4a <close+0x31>
+
+    return fd_close(fd, 1);
+  800a35:	be 01 00 00 00       	mov    $0x1,%esi
+  800a3a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800a3e:	48 b8 6f 09 80 00 00 	movabs $0x80096f,%rax
+  800a45:	00 00 00 
+  800a48:	ff d0                	call   *%rax
+}
+  800a4a:	c9                   	leave
+  800a4b:	c3                   	ret
+
+0000000000800a4c <close_all>:
+
+void
+close_all(void) {
+  800a4c:	55                   	push   %rbp
+  800a4d:	48 89 e5             	mov    %rsp,%rbp
+  800a50:	41 54                	push   %r12
+  800a52:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800a53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a58:	49 bc 19 0a 80 00 00 	movabs $0x800a19,%r12
+  800a5f:	00 00 00 
+  800a62:	89 df                	mov    %ebx,%edi
+  800a64:	41 ff d4             	call   *%r12
+  800a67:	83 c3 01             	add    $0x1,%ebx
+  800a6a:	83 fb 20             	cmp    $0x20,%ebx
+  800a6d:	75 f3                	jne    800a62 <close_all+0x16>
+}
+  800a6f:	5b                   	pop    %rbx
+  800a70:	41 5c                	pop    %r12
+  800a72:	5d                   	pop    %rbp
+  800a73:	c3                   	ret
+
+0000000000800a74 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800a74:	55                   	push   %rbp
+  800a75:	48 89 e5             	mov    %rsp,%rbp
+  800a78:	41 57                	push   %r15
+  800a7a:	41 56                	push   %r14
+  800a7c:	41 55                	push   %r13
+  800a7e:	41 54                	push   %r12
+  800a80:	53                   	push   %rbx
+  800a81:	48 83 ec 18          	sub    $0x18,%rsp
+  800a85:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800a88:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800a8c:	48 b8 b4 08 80 00 00 	movabs $0x8008b4,%rax
+  800a93:	00 00 00 
+  800a96:	ff d0                	call   *%rax
+  800a98:	89 c3                	mov    %eax,%ebx
+  800a9a:	85 c0                	test   %eax,%eax
+  800a9c:	0f 88 b8 00 00 00    	js     800b5a <dup+0xe6>
+    close(newfdnum);
+  800aa2:	44 89 e7             	mov    %r12d,%edi
+  800aa5:	48 b8 19 0a 80 00 00 	movabs $0x800a19,%rax
+  800aac:	00 00 00 
+  800aaf:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800ab1:	4d 63 ec             	movslq %r12d,%r13
+  800ab4:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800abb:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800abf:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800ac3:	4c 89 ff             	mov    %r15,%rdi
+  800ac6:	49 be 38 08 80 00 00 	movabs $0x800838,%r14
+  800acd:	00 00 00 
+  800ad0:	41 ff d6             	call   *%r14
+  800ad3:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800ad6:	4c 89 ef             	mov    %r13,%rdi
+  800ad9:	41 ff d6             	call   *%r14
+  800adc:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800adf:	48 89 df             	mov    %rbx,%rdi
+  800ae2:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  800ae9:	00 00 00 
+  800aec:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800aee:	a8 04                	test   $0x4,%al
+  800af0:	74 2b                	je     800b1d <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800af2:	41 89 c1             	mov    %eax,%r9d
+  800af5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800afb:	4c 89 f1             	mov    %r14,%rcx
+  800afe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b03:	48 89 de             	mov    %rbx,%rsi
+  800b06:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b0b:	48 b8 eb 02 80 00 00 	movabs $0x8002eb,%rax
+  800b12:	00 00 00 
+  800b15:	ff d0                	call   *%rax
+  800b17:	89 c3                	mov    %eax,%ebx
+  800b19:	85 c0                	test   %eax,%eax
+  800b1b:	78 4e                	js     800b6b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800b1d:	4c 89 ff             	mov    %r15,%rdi
+  800b20:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  800b27:	00 00 00 
+  800b2a:	ff d0                	call   *%rax
+  800b2c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800b2f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800b35:	4c 89 e9             	mov    %r13,%rcx
+  800b38:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b3d:	4c 89 fe             	mov    %r15,%rsi
+  800b40:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b45:	48 b8 eb 02 80 00 00 	movabs $0x8002eb,%rax
+  800b4c:	00 00 00 
+  800b4f:	ff d0                	call   *%rax
+  800b51:	89 c3                	mov    %eax,%ebx
+  800b53:	85 c0                	test   %eax,%eax
+  800b55:	78 14                	js     800b6b <dup+0xf7>
+
+    return newfdnum;
+  800b57:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800b5a:	89 d8                	mov    %ebx,%eax
+  800b5c:	48 83 c4 18          	add    $0x18,%rsp
+  800b60:	5b                   	pop    %rbx
+  800b61:	41 5c                	pop    %r12
+  800b63:	41 5d                	pop    %r13
+  800b65:	41 5e                	pop    %r14
+  800b67:	41 5f                	pop    %r15
+  800b69:	5d                   	pop    %rbp
+  800b6a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800b6b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b70:	4c 89 ee             	mov    %r13,%rsi
+  800b73:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b78:	49 bc 50 03 80 00 00 	movabs $0x800350,%r12
+  800b7f:	00 00 00 
+  800b82:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800b85:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b8a:	4c 89 f6             	mov    %r14,%rsi
+  800b8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b92:	41 ff d4             	call   *%r12
+    return res;
+  800b95:	eb c3                	jmp    800b5a <dup+0xe6>
+
+0000000000800b97 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800b97:	55                   	push   %rbp
+  800b98:	48 89 e5             	mov    %rsp,%rbp
+  800b9b:	41 56                	push   %r14
+  800b9d:	41 55                	push   %r13
+  800b9f:	41 54                	push   %r12
+  800ba1:	53                   	push   %rbx
+  800ba2:	48 83 ec 10          	sub    $0x10,%rsp
+  800ba6:	89 fb                	mov    %edi,%ebx
+  800ba8:	49 89 f4             	mov    %rsi,%r12
+  800bab:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bae:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bb2:	48 b8 b4 08 80 00 00 	movabs $0x8008b4,%rax
+  800bb9:	00 00 00 
+  800bbc:	ff d0                	call   *%rax
+  800bbe:	85 c0                	test   %eax,%eax
+  800bc0:	78 4c                	js     800c0e <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bc2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bc6:	41 8b 3e             	mov    (%r14),%edi
+  800bc9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bcd:	48 b8 ff 08 80 00 00 	movabs $0x8008ff,%rax
+  800bd4:	00 00 00 
+  800bd7:	ff d0                	call   *%rax
+  800bd9:	85 c0                	test   %eax,%eax
+  800bdb:	78 35                	js     800c12 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800bdd:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800be1:	83 e0 03             	and    $0x3,%eax
+  800be4:	83 f8 01             	cmp    $0x1,%eax
+  800be7:	74 2d                	je     800c16 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800be9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bed:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800bf1:	48 85 c0             	test   %rax,%rax
+  800bf4:	74 56                	je     800c4c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800bf6:	4c 89 ea             	mov    %r13,%rdx
+  800bf9:	4c 89 e6             	mov    %r12,%rsi
+  800bfc:	4c 89 f7             	mov    %r14,%rdi
+  800bff:	ff d0                	call   *%rax
+}
+  800c01:	48 83 c4 10          	add    $0x10,%rsp
+  800c05:	5b                   	pop    %rbx
+  800c06:	41 5c                	pop    %r12
+  800c08:	41 5d                	pop    %r13
+  800c0a:	41 5e                	pop    %r14
+  800c0c:	5d                   	pop    %rbp
+  800c0d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c0e:	48 98                	cltq
+  800c10:	eb ef                	jmp    800c01 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c12:	48 98                	cltq
+  800c14:	eb eb                	jmp    800c01 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c16:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c1d:	00 00 00 
+  800c20:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c26:	89 da                	mov    %ebx,%edx
+  800c28:	48 bf a1 2b 80 00 00 	movabs $0x802ba1,%rdi
+  800c2f:	00 00 00 
+  800c32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c37:	48 b9 49 1c 80 00 00 	movabs $0x801c49,%rcx
+  800c3e:	00 00 00 
+  800c41:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c43:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c4a:	eb b5                	jmp    800c01 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800c4c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c53:	eb ac                	jmp    800c01 <read+0x6a>
+
+0000000000800c55 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800c55:	55                   	push   %rbp
+  800c56:	48 89 e5             	mov    %rsp,%rbp
+  800c59:	41 57                	push   %r15
+  800c5b:	41 56                	push   %r14
+  800c5d:	41 55                	push   %r13
+  800c5f:	41 54                	push   %r12
+  800c61:	53                   	push   %rbx
+  800c62:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800c66:	48 85 d2             	test   %rdx,%rdx
+  800c69:	74 54                	je     800cbf <readn+0x6a>
+  800c6b:	41 89 fd             	mov    %edi,%r13d
+  800c6e:	49 89 f6             	mov    %rsi,%r14
+  800c71:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800c74:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800c79:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800c7e:	49 bf 97 0b 80 00 00 	movabs $0x800b97,%r15
+  800c85:	00 00 00 
+  800c88:	4c 89 e2             	mov    %r12,%rdx
+  800c8b:	48 29 f2             	sub    %rsi,%rdx
+  800c8e:	4c 01 f6             	add    %r14,%rsi
+  800c91:	44 89 ef             	mov    %r13d,%edi
+  800c94:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800c97:	85 c0                	test   %eax,%eax
+  800c99:	78 20                	js     800cbb <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800c9b:	01 c3                	add    %eax,%ebx
+  800c9d:	85 c0                	test   %eax,%eax
+  800c9f:	74 08                	je     800ca9 <readn+0x54>
+  800ca1:	48 63 f3             	movslq %ebx,%rsi
+  800ca4:	4c 39 e6             	cmp    %r12,%rsi
+  800ca7:	72 df                	jb     800c88 <readn+0x33>
+    }
+    return res;
+  800ca9:	48 63 c3             	movslq %ebx,%rax
+}
+  800cac:	48 83 c4 08          	add    $0x8,%rsp
+  800cb0:	5b                   	pop    %rbx
+  800cb1:	41 5c                	pop    %r12
+  800cb3:	41 5d                	pop    %r13
+  800cb5:	41 5e                	pop    %r14
+  800cb7:	41 5f                	pop    %r15
+  800cb9:	5d                   	pop    %rbp
+  800cba:	c3                   	ret
+        if (inc < 0) return inc;
+  800cbb:	48 98                	cltq
+  800cbd:	eb ed                	jmp    800cac <readn+0x57>
+    int inc = 1, res = 0;
+  800cbf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc4:	eb e3                	jmp    800ca9 <readn+0x54>
+
+0000000000800cc6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800cc6:	55                   	push   %rbp
+  800cc7:	48 89 e5             	mov    %rsp,%rbp
+  800cca:	41 56                	push   %r14
+  800ccc:	41 55                	push   %r13
+  800cce:	41 54                	push   %r12
+  800cd0:	53                   	push   %rbx
+  800cd1:	48 83 ec 10          	sub    $0x10,%rsp
+  800cd5:	89 fb                	mov    %edi,%ebx
+  800cd7:	49 89 f4             	mov    %rsi,%r12
+  800cda:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cdd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ce1:	48 b8 b4 08 80 00 00 	movabs $0x8008b4,%rax
+  800ce8:	00 00 00 
+  800ceb:	ff d0                	call   *%rax
+  800ced:	85 c0                	test   %eax,%eax
+  800cef:	78 47                	js     800d38 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cf1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800cf5:	41 8b 3e             	mov    (%r14),%edi
+  800cf8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cfc:	48 b8 ff 08 80 00 00 	movabs $0x8008ff,%rax
+  800d03:	00 00 00 
+  800d06:	ff d0                	call   *%rax
+  800d08:	85 c0                	test   %eax,%eax
+  800d0a:	78 30                	js     800d3c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d0c:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800d11:	74 2d                	je     800d40 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d13:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d17:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800d1b:	48 85 c0             	test   %rax,%rax
+  800d1e:	74 56                	je     800d76 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800d20:	4c 89 ea             	mov    %r13,%rdx
+  800d23:	4c 89 e6             	mov    %r12,%rsi
+  800d26:	4c 89 f7             	mov    %r14,%rdi
+  800d29:	ff d0                	call   *%rax
+}
+  800d2b:	48 83 c4 10          	add    $0x10,%rsp
+  800d2f:	5b                   	pop    %rbx
+  800d30:	41 5c                	pop    %r12
+  800d32:	41 5d                	pop    %r13
+  800d34:	41 5e                	pop    %r14
+  800d36:	5d                   	pop    %rbp
+  800d37:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d38:	48 98                	cltq
+  800d3a:	eb ef                	jmp    800d2b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d3c:	48 98                	cltq
+  800d3e:	eb eb                	jmp    800d2b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800d40:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d47:	00 00 00 
+  800d4a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800d50:	89 da                	mov    %ebx,%edx
+  800d52:	48 bf bd 2b 80 00 00 	movabs $0x802bbd,%rdi
+  800d59:	00 00 00 
+  800d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d61:	48 b9 49 1c 80 00 00 	movabs $0x801c49,%rcx
+  800d68:	00 00 00 
+  800d6b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d6d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800d74:	eb b5                	jmp    800d2b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d76:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800d7d:	eb ac                	jmp    800d2b <write+0x65>
+
+0000000000800d7f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800d7f:	55                   	push   %rbp
+  800d80:	48 89 e5             	mov    %rsp,%rbp
+  800d83:	53                   	push   %rbx
+  800d84:	48 83 ec 18          	sub    $0x18,%rsp
+  800d88:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d8a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d8e:	48 b8 b4 08 80 00 00 	movabs $0x8008b4,%rax
+  800d95:	00 00 00 
+  800d98:	ff d0                	call   *%rax
+  800d9a:	85 c0                	test   %eax,%eax
+  800d9c:	78 0c                	js     800daa <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800d9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800da2:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800da5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800daa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800dae:	c9                   	leave
+  800daf:	c3                   	ret
+
+0000000000800db0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800db0:	55                   	push   %rbp
+  800db1:	48 89 e5             	mov    %rsp,%rbp
+  800db4:	41 55                	push   %r13
+  800db6:	41 54                	push   %r12
+  800db8:	53                   	push   %rbx
+  800db9:	48 83 ec 18          	sub    $0x18,%rsp
+  800dbd:	89 fb                	mov    %edi,%ebx
+  800dbf:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800dc2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800dc6:	48 b8 b4 08 80 00 00 	movabs $0x8008b4,%rax
+  800dcd:	00 00 00 
+  800dd0:	ff d0                	call   *%rax
+  800dd2:	85 c0                	test   %eax,%eax
+  800dd4:	78 38                	js     800e0e <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800dd6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800dda:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800dde:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800de2:	48 b8 ff 08 80 00 00 	movabs $0x8008ff,%rax
+  800de9:	00 00 00 
+  800dec:	ff d0                	call   *%rax
+  800dee:	85 c0                	test   %eax,%eax
+  800df0:	78 1c                	js     800e0e <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800df2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800df7:	74 20                	je     800e19 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800df9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800dfd:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800e01:	48 85 c0             	test   %rax,%rax
+  800e04:	74 47                	je     800e4d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800e06:	44 89 e6             	mov    %r12d,%esi
+  800e09:	4c 89 ef             	mov    %r13,%rdi
+  800e0c:	ff d0                	call   *%rax
+}
+  800e0e:	48 83 c4 18          	add    $0x18,%rsp
+  800e12:	5b                   	pop    %rbx
+  800e13:	41 5c                	pop    %r12
+  800e15:	41 5d                	pop    %r13
+  800e17:	5d                   	pop    %rbp
+  800e18:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800e19:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800e20:	00 00 00 
+  800e23:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800e29:	89 da                	mov    %ebx,%edx
+  800e2b:	48 bf 80 2b 80 00 00 	movabs $0x802b80,%rdi
+  800e32:	00 00 00 
+  800e35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3a:	48 b9 49 1c 80 00 00 	movabs $0x801c49,%rcx
+  800e41:	00 00 00 
+  800e44:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e46:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e4b:	eb c1                	jmp    800e0e <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800e4d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e52:	eb ba                	jmp    800e0e <ftruncate+0x5e>
+
+0000000000800e54 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800e54:	55                   	push   %rbp
+  800e55:	48 89 e5             	mov    %rsp,%rbp
+  800e58:	41 54                	push   %r12
+  800e5a:	53                   	push   %rbx
+  800e5b:	48 83 ec 10          	sub    $0x10,%rsp
+  800e5f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e62:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e66:	48 b8 b4 08 80 00 00 	movabs $0x8008b4,%rax
+  800e6d:	00 00 00 
+  800e70:	ff d0                	call   *%rax
+  800e72:	85 c0                	test   %eax,%eax
+  800e74:	78 4e                	js     800ec4 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e76:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800e7a:	41 8b 3c 24          	mov    (%r12),%edi
+  800e7e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800e82:	48 b8 ff 08 80 00 00 	movabs $0x8008ff,%rax
+  800e89:	00 00 00 
+  800e8c:	ff d0                	call   *%rax
+  800e8e:	85 c0                	test   %eax,%eax
+  800e90:	78 32                	js     800ec4 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800e92:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e96:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800e9b:	74 30                	je     800ecd <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800e9d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800ea0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800ea7:	00 00 00 
+    stat->st_isdir = 0;
+  800eaa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800eb1:	00 00 00 
+    stat->st_dev = dev;
+  800eb4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800ebb:	48 89 de             	mov    %rbx,%rsi
+  800ebe:	4c 89 e7             	mov    %r12,%rdi
+  800ec1:	ff 50 28             	call   *0x28(%rax)
+}
+  800ec4:	48 83 c4 10          	add    $0x10,%rsp
+  800ec8:	5b                   	pop    %rbx
+  800ec9:	41 5c                	pop    %r12
+  800ecb:	5d                   	pop    %rbp
+  800ecc:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800ecd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ed2:	eb f0                	jmp    800ec4 <fstat+0x70>
+
+0000000000800ed4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800ed4:	55                   	push   %rbp
+  800ed5:	48 89 e5             	mov    %rsp,%rbp
+  800ed8:	41 54                	push   %r12
+  800eda:	53                   	push   %rbx
+  800edb:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800ede:	be 00 00 00 00       	mov    $0x0,%esi
+  800ee3:	48 b8 55 11 80 00 00 	movabs $0x801155,%rax
+  800eea:	00 00 00 
+  800eed:	ff d0                	call   *%rax
+  800eef:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800ef1:	85 c0                	test   %eax,%eax
+  800ef3:	78 25                	js     800f1a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800ef5:	4c 89 e6             	mov    %r12,%rsi
+  800ef8:	89 c7                	mov    %eax,%edi
+  800efa:	48 b8 54 0e 80 00 00 	movabs $0x800e54,%rax
+  800f01:	00 00 00 
+  800f04:	ff d0                	call   *%rax
+  800f06:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800f09:	89 df                	mov    %ebx,%edi
+  800f0b:	48 b8 19 0a 80 00 00 	movabs $0x800a19,%rax
+  800f12:	00 00 00 
+  800f15:	ff d0                	call   *%rax
+
+    return res;
+  800f17:	44 89 e3             	mov    %r12d,%ebx
+}
+  800f1a:	89 d8                	mov    %ebx,%eax
+  800f1c:	5b                   	pop    %rbx
+  800f1d:	41 5c                	pop    %r12
+  800f1f:	5d                   	pop    %rbp
+  800f20:	c3                   	ret
+
+0000000000800f21 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800f21:	55                   	push   %rbp
+  800f22:	48 89 e5             	mov    %rsp,%rbp
+  800f25:	41 54                	push   %r12
+  800f27:	53                   	push   %rbx
+  800f28:	48 83 ec 10          	sub    $0x10,%rsp
+  800f2c:	41 89 fc             	mov    %edi,%r12d
+  800f2f:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f32:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f39:	00 00 00 
+  800f3c:	83 38 00             	cmpl   $0x0,(%rax)
+  800f3f:	74 5e                	je     800f9f <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800f41:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800f47:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800f4c:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800f53:	00 00 00 
+  800f56:	44 89 e6             	mov    %r12d,%esi
+  800f59:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f60:	00 00 00 
+  800f63:	8b 38                	mov    (%rax),%edi
+  800f65:	48 b8 2a 2a 80 00 00 	movabs $0x802a2a,%rax
+  800f6c:	00 00 00 
+  800f6f:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800f71:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800f78:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800f79:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f7e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800f82:	48 89 de             	mov    %rbx,%rsi
+  800f85:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f8a:	48 b8 95 29 80 00 00 	movabs $0x802995,%rax
+  800f91:	00 00 00 
+  800f94:	ff d0                	call   *%rax
+}
+  800f96:	48 83 c4 10          	add    $0x10,%rsp
+  800f9a:	5b                   	pop    %rbx
+  800f9b:	41 5c                	pop    %r12
+  800f9d:	5d                   	pop    %rbp
+  800f9e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f9f:	bf 03 00 00 00       	mov    $0x3,%edi
+  800fa4:	48 b8 ca 2a 80 00 00 	movabs $0x802aca,%rax
+  800fab:	00 00 00 
+  800fae:	ff d0                	call   *%rax
+  800fb0:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800fb7:	00 00 
+  800fb9:	eb 86                	jmp    800f41 <fsipc+0x20>
+
+0000000000800fbb <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800fbb:	55                   	push   %rbp
+  800fbc:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800fbf:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800fc6:	00 00 00 
+  800fc9:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800fcc:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800fce:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800fd1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd6:	bf 02 00 00 00       	mov    $0x2,%edi
+  800fdb:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  800fe2:	00 00 00 
+  800fe5:	ff d0                	call   *%rax
+}
+  800fe7:	5d                   	pop    %rbp
+  800fe8:	c3                   	ret
+
+0000000000800fe9 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800fe9:	55                   	push   %rbp
+  800fea:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800fed:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800ff0:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800ff7:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  800ff9:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffe:	bf 06 00 00 00       	mov    $0x6,%edi
+  801003:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  80100a:	00 00 00 
+  80100d:	ff d0                	call   *%rax
+}
+  80100f:	5d                   	pop    %rbp
+  801010:	c3                   	ret
+
+0000000000801011 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801011:	55                   	push   %rbp
+  801012:	48 89 e5             	mov    %rsp,%rbp
+  801015:	41 54                	push   %r12
+  801017:	53                   	push   %rbx
+  801018:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80101b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80101e:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801025:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801027:	be 00 00 00 00       	mov    $0x0,%esi
+  80102c:	bf 05 00 00 00       	mov    $0x5,%edi
+  801031:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  801038:	00 00 00 
+  80103b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80103d:	85 c0                	test   %eax,%eax
+  80103f:	78 3d                	js     80107e <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801041:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801048:	00 00 00 
+  80104b:	4c 89 e6             	mov    %r12,%rsi
+  80104e:	48 89 df             	mov    %rbx,%rdi
+  801051:	48 b8 6e 25 80 00 00 	movabs $0x80256e,%rax
+  801058:	00 00 00 
+  80105b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80105d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801064:	00 
+  801065:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80106b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801072:	00 
+  801073:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801079:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80107e:	5b                   	pop    %rbx
+  80107f:	41 5c                	pop    %r12
+  801081:	5d                   	pop    %rbp
+  801082:	c3                   	ret
+
+0000000000801083 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801083:	55                   	push   %rbp
+  801084:	48 89 e5             	mov    %rsp,%rbp
+  801087:	41 54                	push   %r12
+  801089:	53                   	push   %rbx
+  80108a:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  80108d:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  801092:	48 39 c2             	cmp    %rax,%rdx
+  801095:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801099:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80109c:	48 89 c2             	mov    %rax,%rdx
+  80109f:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8010a6:	00 00 00 
+  8010a9:	48 b8 cf 27 80 00 00 	movabs $0x8027cf,%rax
+  8010b0:	00 00 00 
+  8010b3:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8010b5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8010bc:	00 00 00 
+  8010bf:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8010c4:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8010c6:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8010ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8010cf:	bf 04 00 00 00       	mov    $0x4,%edi
+  8010d4:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  8010db:	00 00 00 
+  8010de:	ff d0                	call   *%rax
+  8010e0:	48 98                	cltq
+}
+  8010e2:	5b                   	pop    %rbx
+  8010e3:	41 5c                	pop    %r12
+  8010e5:	5d                   	pop    %rbp
+  8010e6:	c3                   	ret
+
+00000000008010e7 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8010e7:	55                   	push   %rbp
+  8010e8:	48 89 e5             	mov    %rsp,%rbp
+  8010eb:	41 54                	push   %r12
+  8010ed:	53                   	push   %rbx
+  8010ee:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8010f1:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8010f8:	00 00 00 
+  8010fb:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8010fe:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  801100:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801105:	48 39 ca             	cmp    %rcx,%rdx
+  801108:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  80110c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  801110:	be 00 00 00 00       	mov    $0x0,%esi
+  801115:	bf 03 00 00 00       	mov    $0x3,%edi
+  80111a:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  801121:	00 00 00 
+  801124:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  801126:	85 c0                	test   %eax,%eax
+  801128:	78 27                	js     801151 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  80112a:	48 63 d8             	movslq %eax,%rbx
+  80112d:	48 89 da             	mov    %rbx,%rdx
+  801130:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801137:	00 00 00 
+  80113a:	4c 89 e7             	mov    %r12,%rdi
+  80113d:	48 b8 cf 27 80 00 00 	movabs $0x8027cf,%rax
+  801144:	00 00 00 
+  801147:	ff d0                	call   *%rax
+    return bytes_read;
+  801149:	48 89 d8             	mov    %rbx,%rax
+}
+  80114c:	5b                   	pop    %rbx
+  80114d:	41 5c                	pop    %r12
+  80114f:	5d                   	pop    %rbp
+  801150:	c3                   	ret
+        return bytes_read;
+  801151:	48 98                	cltq
+  801153:	eb f7                	jmp    80114c <devfile_read+0x65>
+
+0000000000801155 <open>:
+open(const char *path, int mode) {
+  801155:	55                   	push   %rbp
+  801156:	48 89 e5             	mov    %rsp,%rbp
+  801159:	41 55                	push   %r13
+  80115b:	41 54                	push   %r12
+  80115d:	53                   	push   %rbx
+  80115e:	48 83 ec 18          	sub    $0x18,%rsp
+  801162:	49 89 fc             	mov    %rdi,%r12
+  801165:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801168:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  80116f:	00 00 00 
+  801172:	ff d0                	call   *%rax
+  801174:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80117a:	0f 87 8a 00 00 00    	ja     80120a <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801180:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801184:	48 b8 54 08 80 00 00 	movabs $0x800854,%rax
+  80118b:	00 00 00 
+  80118e:	ff d0                	call   *%rax
+  801190:	89 c3                	mov    %eax,%ebx
+  801192:	85 c0                	test   %eax,%eax
+  801194:	78 50                	js     8011e6 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801196:	4c 89 e6             	mov    %r12,%rsi
+  801199:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8011a0:	00 00 00 
+  8011a3:	48 89 df             	mov    %rbx,%rdi
+  8011a6:	48 b8 6e 25 80 00 00 	movabs $0x80256e,%rax
+  8011ad:	00 00 00 
+  8011b0:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011b2:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011b9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8011bd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011c2:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  8011c9:	00 00 00 
+  8011cc:	ff d0                	call   *%rax
+  8011ce:	89 c3                	mov    %eax,%ebx
+  8011d0:	85 c0                	test   %eax,%eax
+  8011d2:	78 1f                	js     8011f3 <open+0x9e>
+    return fd2num(fd);
+  8011d4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8011d8:	48 b8 26 08 80 00 00 	movabs $0x800826,%rax
+  8011df:	00 00 00 
+  8011e2:	ff d0                	call   *%rax
+  8011e4:	89 c3                	mov    %eax,%ebx
+}
+  8011e6:	89 d8                	mov    %ebx,%eax
+  8011e8:	48 83 c4 18          	add    $0x18,%rsp
+  8011ec:	5b                   	pop    %rbx
+  8011ed:	41 5c                	pop    %r12
+  8011ef:	41 5d                	pop    %r13
+  8011f1:	5d                   	pop    %rbp
+  8011f2:	c3                   	ret
+        fd_close(fd, 0);
+  8011f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8011fc:	48 b8 6f 09 80 00 00 	movabs $0x80096f,%rax
+  801203:	00 00 00 
+  801206:	ff d0                	call   *%rax
+        return res;
+  801208:	eb dc                	jmp    8011e6 <open+0x91>
+        return -E_BAD_PATH;
+  80120a:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80120f:	eb d5                	jmp    8011e6 <open+0x91>
+
+0000000000801211 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801211:	55                   	push   %rbp
+  801212:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801215:	be 00 00 00 00       	mov    $0x0,%esi
+  80121a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80121f:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  801226:	00 00 00 
+  801229:	ff d0                	call   *%rax
+}
+  80122b:	5d                   	pop    %rbp
+  80122c:	c3                   	ret
+
+000000000080122d <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80122d:	55                   	push   %rbp
+  80122e:	48 89 e5             	mov    %rsp,%rbp
+  801231:	41 54                	push   %r12
+  801233:	53                   	push   %rbx
+  801234:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801237:	48 b8 38 08 80 00 00 	movabs $0x800838,%rax
+  80123e:	00 00 00 
+  801241:	ff d0                	call   *%rax
+  801243:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801246:	48 be 00 2c 80 00 00 	movabs $0x802c00,%rsi
+  80124d:	00 00 00 
+  801250:	48 89 df             	mov    %rbx,%rdi
+  801253:	48 b8 6e 25 80 00 00 	movabs $0x80256e,%rax
+  80125a:	00 00 00 
+  80125d:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80125f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801264:	41 2b 04 24          	sub    (%r12),%eax
+  801268:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80126e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801275:	00 00 00 
+    stat->st_dev = &devpipe;
+  801278:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80127f:	00 00 00 
+  801282:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801289:	b8 00 00 00 00       	mov    $0x0,%eax
+  80128e:	5b                   	pop    %rbx
+  80128f:	41 5c                	pop    %r12
+  801291:	5d                   	pop    %rbp
+  801292:	c3                   	ret
+
+0000000000801293 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801293:	55                   	push   %rbp
+  801294:	48 89 e5             	mov    %rsp,%rbp
+  801297:	41 54                	push   %r12
+  801299:	53                   	push   %rbx
+  80129a:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80129d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012a2:	48 89 fe             	mov    %rdi,%rsi
+  8012a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012aa:	49 bc 50 03 80 00 00 	movabs $0x800350,%r12
+  8012b1:	00 00 00 
+  8012b4:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012b7:	48 89 df             	mov    %rbx,%rdi
+  8012ba:	48 b8 38 08 80 00 00 	movabs $0x800838,%rax
+  8012c1:	00 00 00 
+  8012c4:	ff d0                	call   *%rax
+  8012c6:	48 89 c6             	mov    %rax,%rsi
+  8012c9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012d3:	41 ff d4             	call   *%r12
+}
+  8012d6:	5b                   	pop    %rbx
+  8012d7:	41 5c                	pop    %r12
+  8012d9:	5d                   	pop    %rbp
+  8012da:	c3                   	ret
+
+00000000008012db <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8012db:	55                   	push   %rbp
+  8012dc:	48 89 e5             	mov    %rsp,%rbp
+  8012df:	41 57                	push   %r15
+  8012e1:	41 56                	push   %r14
+  8012e3:	41 55                	push   %r13
+  8012e5:	41 54                	push   %r12
+  8012e7:	53                   	push   %rbx
+  8012e8:	48 83 ec 18          	sub    $0x18,%rsp
+  8012ec:	49 89 fc             	mov    %rdi,%r12
+  8012ef:	49 89 f5             	mov    %rsi,%r13
+  8012f2:	49 89 d7             	mov    %rdx,%r15
+  8012f5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8012f9:	48 b8 38 08 80 00 00 	movabs $0x800838,%rax
+  801300:	00 00 00 
+  801303:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801305:	4d 85 ff             	test   %r15,%r15
+  801308:	0f 84 af 00 00 00    	je     8013bd <devpipe_write+0xe2>
+  80130e:	48 89 c3             	mov    %rax,%rbx
+  801311:	4c 89 f8             	mov    %r15,%rax
+  801314:	4d 89 ef             	mov    %r13,%r15
+  801317:	4c 01 e8             	add    %r13,%rax
+  80131a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80131e:	49 bd 58 02 80 00 00 	movabs $0x800258,%r13
+  801325:	00 00 00 
+            sys_yield();
+  801328:	49 be f5 01 80 00 00 	movabs $0x8001f5,%r14
+  80132f:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801332:	8b 73 04             	mov    0x4(%rbx),%esi
+  801335:	48 63 ce             	movslq %esi,%rcx
+  801338:	48 63 03             	movslq (%rbx),%rax
+  80133b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801341:	48 39 c1             	cmp    %rax,%rcx
+  801344:	72 2e                	jb     801374 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801346:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80134b:	48 89 da             	mov    %rbx,%rdx
+  80134e:	be 00 10 00 00       	mov    $0x1000,%esi
+  801353:	4c 89 e7             	mov    %r12,%rdi
+  801356:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801359:	85 c0                	test   %eax,%eax
+  80135b:	74 66                	je     8013c3 <devpipe_write+0xe8>
+            sys_yield();
+  80135d:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801360:	8b 73 04             	mov    0x4(%rbx),%esi
+  801363:	48 63 ce             	movslq %esi,%rcx
+  801366:	48 63 03             	movslq (%rbx),%rax
+  801369:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80136f:	48 39 c1             	cmp    %rax,%rcx
+  801372:	73 d2                	jae    801346 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801374:	41 0f b6 3f          	movzbl (%r15),%edi
+  801378:	48 89 ca             	mov    %rcx,%rdx
+  80137b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80137f:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  801386:	08 10 20 
+  801389:	48 f7 e2             	mul    %rdx
+  80138c:	48 c1 ea 06          	shr    $0x6,%rdx
+  801390:	48 89 d0             	mov    %rdx,%rax
+  801393:	48 c1 e0 09          	shl    $0x9,%rax
+  801397:	48 29 d0             	sub    %rdx,%rax
+  80139a:	48 c1 e0 03          	shl    $0x3,%rax
+  80139e:	48 29 c1             	sub    %rax,%rcx
+  8013a1:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013a6:	83 c6 01             	add    $0x1,%esi
+  8013a9:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013ac:	49 83 c7 01          	add    $0x1,%r15
+  8013b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013b4:	49 39 c7             	cmp    %rax,%r15
+  8013b7:	0f 85 75 ff ff ff    	jne    801332 <devpipe_write+0x57>
+    return n;
+  8013bd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8013c1:	eb 05                	jmp    8013c8 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8013c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013c8:	48 83 c4 18          	add    $0x18,%rsp
+  8013cc:	5b                   	pop    %rbx
+  8013cd:	41 5c                	pop    %r12
+  8013cf:	41 5d                	pop    %r13
+  8013d1:	41 5e                	pop    %r14
+  8013d3:	41 5f                	pop    %r15
+  8013d5:	5d                   	pop    %rbp
+  8013d6:	c3                   	ret
+
+00000000008013d7 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8013d7:	55                   	push   %rbp
+  8013d8:	48 89 e5             	mov    %rsp,%rbp
+  8013db:	41 57                	push   %r15
+  8013dd:	41 56                	push   %r14
+  8013df:	41 55                	push   %r13
+  8013e1:	41 54                	push   %r12
+  8013e3:	53                   	push   %rbx
+  8013e4:	48 83 ec 18          	sub    $0x18,%rsp
+  8013e8:	49 89 fc             	mov    %rdi,%r12
+  8013eb:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8013ef:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8013f3:	48 b8 38 08 80 00 00 	movabs $0x800838,%rax
+  8013fa:	00 00 00 
+  8013fd:	ff d0                	call   *%rax
+  8013ff:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801402:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801408:	49 bd 58 02 80 00 00 	movabs $0x800258,%r13
+  80140f:	00 00 00 
+            sys_yield();
+  801412:	49 be f5 01 80 00 00 	movabs $0x8001f5,%r14
+  801419:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80141c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801421:	74 7d                	je     8014a0 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801423:	8b 03                	mov    (%rbx),%eax
+  801425:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801428:	75 26                	jne    801450 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80142a:	4d 85 ff             	test   %r15,%r15
+  80142d:	75 77                	jne    8014a6 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80142f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801434:	48 89 da             	mov    %rbx,%rdx
+  801437:	be 00 10 00 00       	mov    $0x1000,%esi
+  80143c:	4c 89 e7             	mov    %r12,%rdi
+  80143f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801442:	85 c0                	test   %eax,%eax
+  801444:	74 72                	je     8014b8 <devpipe_read+0xe1>
+            sys_yield();
+  801446:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801449:	8b 03                	mov    (%rbx),%eax
+  80144b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80144e:	74 df                	je     80142f <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801450:	48 63 c8             	movslq %eax,%rcx
+  801453:	48 89 ca             	mov    %rcx,%rdx
+  801456:	48 c1 ea 03          	shr    $0x3,%rdx
+  80145a:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801461:	08 10 20 
+  801464:	48 89 d0             	mov    %rdx,%rax
+  801467:	48 f7 e6             	mul    %rsi
+  80146a:	48 c1 ea 06          	shr    $0x6,%rdx
+  80146e:	48 89 d0             	mov    %rdx,%rax
+  801471:	48 c1 e0 09          	shl    $0x9,%rax
+  801475:	48 29 d0             	sub    %rdx,%rax
+  801478:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80147f:	00 
+  801480:	48 89 c8             	mov    %rcx,%rax
+  801483:	48 29 d0             	sub    %rdx,%rax
+  801486:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80148b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80148f:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801493:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801496:	49 83 c7 01          	add    $0x1,%r15
+  80149a:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80149e:	75 83                	jne    801423 <devpipe_read+0x4c>
+    return n;
+  8014a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014a4:	eb 03                	jmp    8014a9 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014a6:	4c 89 f8             	mov    %r15,%rax
+}
+  8014a9:	48 83 c4 18          	add    $0x18,%rsp
+  8014ad:	5b                   	pop    %rbx
+  8014ae:	41 5c                	pop    %r12
+  8014b0:	41 5d                	pop    %r13
+  8014b2:	41 5e                	pop    %r14
+  8014b4:	41 5f                	pop    %r15
+  8014b6:	5d                   	pop    %rbp
+  8014b7:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014bd:	eb ea                	jmp    8014a9 <devpipe_read+0xd2>
+
+00000000008014bf <pipe>:
+pipe(int pfd[2]) {
+  8014bf:	55                   	push   %rbp
+  8014c0:	48 89 e5             	mov    %rsp,%rbp
+  8014c3:	41 55                	push   %r13
+  8014c5:	41 54                	push   %r12
+  8014c7:	53                   	push   %rbx
+  8014c8:	48 83 ec 18          	sub    $0x18,%rsp
+  8014cc:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8014cf:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8014d3:	48 b8 54 08 80 00 00 	movabs $0x800854,%rax
+  8014da:	00 00 00 
+  8014dd:	ff d0                	call   *%rax
+  8014df:	89 c3                	mov    %eax,%ebx
+  8014e1:	85 c0                	test   %eax,%eax
+  8014e3:	0f 88 a0 01 00 00    	js     801689 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8014e9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8014ee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8014f3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8014f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014fc:	48 b8 84 02 80 00 00 	movabs $0x800284,%rax
+  801503:	00 00 00 
+  801506:	ff d0                	call   *%rax
+  801508:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80150a:	85 c0                	test   %eax,%eax
+  80150c:	0f 88 77 01 00 00    	js     801689 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801512:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801516:	48 b8 54 08 80 00 00 	movabs $0x800854,%rax
+  80151d:	00 00 00 
+  801520:	ff d0                	call   *%rax
+  801522:	89 c3                	mov    %eax,%ebx
+  801524:	85 c0                	test   %eax,%eax
+  801526:	0f 88 43 01 00 00    	js     80166f <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80152c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801531:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801536:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80153a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80153f:	48 b8 84 02 80 00 00 	movabs $0x800284,%rax
+  801546:	00 00 00 
+  801549:	ff d0                	call   *%rax
+  80154b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80154d:	85 c0                	test   %eax,%eax
+  80154f:	0f 88 1a 01 00 00    	js     80166f <pipe+0x1b0>
+    va = fd2data(fd0);
+  801555:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801559:	48 b8 38 08 80 00 00 	movabs $0x800838,%rax
+  801560:	00 00 00 
+  801563:	ff d0                	call   *%rax
+  801565:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801568:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80156d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801572:	48 89 c6             	mov    %rax,%rsi
+  801575:	bf 00 00 00 00       	mov    $0x0,%edi
+  80157a:	48 b8 84 02 80 00 00 	movabs $0x800284,%rax
+  801581:	00 00 00 
+  801584:	ff d0                	call   *%rax
+  801586:	89 c3                	mov    %eax,%ebx
+  801588:	85 c0                	test   %eax,%eax
+  80158a:	0f 88 c5 00 00 00    	js     801655 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801590:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801594:	48 b8 38 08 80 00 00 	movabs $0x800838,%rax
+  80159b:	00 00 00 
+  80159e:	ff d0                	call   *%rax
+  8015a0:	48 89 c1             	mov    %rax,%rcx
+  8015a3:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8015a9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8015af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b4:	4c 89 ee             	mov    %r13,%rsi
+  8015b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015bc:	48 b8 eb 02 80 00 00 	movabs $0x8002eb,%rax
+  8015c3:	00 00 00 
+  8015c6:	ff d0                	call   *%rax
+  8015c8:	89 c3                	mov    %eax,%ebx
+  8015ca:	85 c0                	test   %eax,%eax
+  8015cc:	78 6e                	js     80163c <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8015ce:	be 00 10 00 00       	mov    $0x1000,%esi
+  8015d3:	4c 89 ef             	mov    %r13,%rdi
+  8015d6:	48 b8 26 02 80 00 00 	movabs $0x800226,%rax
+  8015dd:	00 00 00 
+  8015e0:	ff d0                	call   *%rax
+  8015e2:	83 f8 02             	cmp    $0x2,%eax
+  8015e5:	0f 85 ab 00 00 00    	jne    801696 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8015eb:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8015f2:	00 00 
+  8015f4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8015f8:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8015fa:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8015fe:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801605:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801609:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80160b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80160f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801616:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80161a:	48 bb 26 08 80 00 00 	movabs $0x800826,%rbx
+  801621:	00 00 00 
+  801624:	ff d3                	call   *%rbx
+  801626:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80162a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80162e:	ff d3                	call   *%rbx
+  801630:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  801635:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163a:	eb 4d                	jmp    801689 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80163c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801641:	4c 89 ee             	mov    %r13,%rsi
+  801644:	bf 00 00 00 00       	mov    $0x0,%edi
+  801649:	48 b8 50 03 80 00 00 	movabs $0x800350,%rax
+  801650:	00 00 00 
+  801653:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  801655:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80165a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80165e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801663:	48 b8 50 03 80 00 00 	movabs $0x800350,%rax
+  80166a:	00 00 00 
+  80166d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80166f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801674:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801678:	bf 00 00 00 00       	mov    $0x0,%edi
+  80167d:	48 b8 50 03 80 00 00 	movabs $0x800350,%rax
+  801684:	00 00 00 
+  801687:	ff d0                	call   *%rax
+}
+  801689:	89 d8                	mov    %ebx,%eax
+  80168b:	48 83 c4 18          	add    $0x18,%rsp
+  80168f:	5b                   	pop    %rbx
+  801690:	41 5c                	pop    %r12
+  801692:	41 5d                	pop    %r13
+  801694:	5d                   	pop    %rbp
+  801695:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801696:	48 b9 30 2c 80 00 00 	movabs $0x802c30,%rcx
+  80169d:	00 00 00 
+  8016a0:	48 ba 07 2c 80 00 00 	movabs $0x802c07,%rdx
+  8016a7:	00 00 00 
+  8016aa:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8016af:	48 bf 1c 2c 80 00 00 	movabs $0x802c1c,%rdi
+  8016b6:	00 00 00 
+  8016b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016be:	49 b8 f9 1a 80 00 00 	movabs $0x801af9,%r8
+  8016c5:	00 00 00 
+  8016c8:	41 ff d0             	call   *%r8
+
+00000000008016cb <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8016cb:	55                   	push   %rbp
+  8016cc:	48 89 e5             	mov    %rsp,%rbp
+  8016cf:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8016d3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8016d7:	48 b8 b4 08 80 00 00 	movabs $0x8008b4,%rax
+  8016de:	00 00 00 
+  8016e1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8016e3:	85 c0                	test   %eax,%eax
+  8016e5:	78 35                	js     80171c <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8016e7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8016eb:	48 b8 38 08 80 00 00 	movabs $0x800838,%rax
+  8016f2:	00 00 00 
+  8016f5:	ff d0                	call   *%rax
+  8016f7:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8016fa:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8016ff:	be 00 10 00 00       	mov    $0x1000,%esi
+  801704:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801708:	48 b8 58 02 80 00 00 	movabs $0x800258,%rax
+  80170f:	00 00 00 
+  801712:	ff d0                	call   *%rax
+  801714:	85 c0                	test   %eax,%eax
+  801716:	0f 94 c0             	sete   %al
+  801719:	0f b6 c0             	movzbl %al,%eax
+}
+  80171c:	c9                   	leave
+  80171d:	c3                   	ret
+
+000000000080171e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80171e:	48 89 f8             	mov    %rdi,%rax
+  801721:	48 c1 e8 27          	shr    $0x27,%rax
+  801725:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80172c:	01 00 00 
+  80172f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801733:	f6 c2 01             	test   $0x1,%dl
+  801736:	74 6d                	je     8017a5 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801738:	48 89 f8             	mov    %rdi,%rax
+  80173b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80173f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801746:	01 00 00 
+  801749:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80174d:	f6 c2 01             	test   $0x1,%dl
+  801750:	74 62                	je     8017b4 <get_uvpt_entry+0x96>
+  801752:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801759:	01 00 00 
+  80175c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801760:	f6 c2 80             	test   $0x80,%dl
+  801763:	75 4f                	jne    8017b4 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801765:	48 89 f8             	mov    %rdi,%rax
+  801768:	48 c1 e8 15          	shr    $0x15,%rax
+  80176c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801773:	01 00 00 
+  801776:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80177a:	f6 c2 01             	test   $0x1,%dl
+  80177d:	74 44                	je     8017c3 <get_uvpt_entry+0xa5>
+  80177f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801786:	01 00 00 
+  801789:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80178d:	f6 c2 80             	test   $0x80,%dl
+  801790:	75 31                	jne    8017c3 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  801792:	48 c1 ef 0c          	shr    $0xc,%rdi
+  801796:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80179d:	01 00 00 
+  8017a0:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8017a4:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017a5:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017ac:	01 00 00 
+  8017af:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017b3:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017b4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017bb:	01 00 00 
+  8017be:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017c2:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017c3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017ca:	01 00 00 
+  8017cd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017d1:	c3                   	ret
+
+00000000008017d2 <get_prot>:
+
+int
+get_prot(void *va) {
+  8017d2:	55                   	push   %rbp
+  8017d3:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8017d6:	48 b8 1e 17 80 00 00 	movabs $0x80171e,%rax
+  8017dd:	00 00 00 
+  8017e0:	ff d0                	call   *%rax
+  8017e2:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8017e5:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8017ea:	89 c1                	mov    %eax,%ecx
+  8017ec:	83 c9 04             	or     $0x4,%ecx
+  8017ef:	f6 c2 01             	test   $0x1,%dl
+  8017f2:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8017f5:	89 c1                	mov    %eax,%ecx
+  8017f7:	83 c9 02             	or     $0x2,%ecx
+  8017fa:	f6 c2 02             	test   $0x2,%dl
+  8017fd:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  801800:	89 c1                	mov    %eax,%ecx
+  801802:	83 c9 01             	or     $0x1,%ecx
+  801805:	48 85 d2             	test   %rdx,%rdx
+  801808:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80180b:	89 c1                	mov    %eax,%ecx
+  80180d:	83 c9 40             	or     $0x40,%ecx
+  801810:	f6 c6 04             	test   $0x4,%dh
+  801813:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  801816:	5d                   	pop    %rbp
+  801817:	c3                   	ret
+
+0000000000801818 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  801818:	55                   	push   %rbp
+  801819:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80181c:	48 b8 1e 17 80 00 00 	movabs $0x80171e,%rax
+  801823:	00 00 00 
+  801826:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  801828:	48 c1 e8 06          	shr    $0x6,%rax
+  80182c:	83 e0 01             	and    $0x1,%eax
+}
+  80182f:	5d                   	pop    %rbp
+  801830:	c3                   	ret
+
+0000000000801831 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  801831:	55                   	push   %rbp
+  801832:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  801835:	48 b8 1e 17 80 00 00 	movabs $0x80171e,%rax
+  80183c:	00 00 00 
+  80183f:	ff d0                	call   *%rax
+  801841:	83 e0 01             	and    $0x1,%eax
+}
+  801844:	5d                   	pop    %rbp
+  801845:	c3                   	ret
+
+0000000000801846 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  801846:	55                   	push   %rbp
+  801847:	48 89 e5             	mov    %rsp,%rbp
+  80184a:	41 57                	push   %r15
+  80184c:	41 56                	push   %r14
+  80184e:	41 55                	push   %r13
+  801850:	41 54                	push   %r12
+  801852:	53                   	push   %rbx
+  801853:	48 83 ec 18          	sub    $0x18,%rsp
+  801857:	49 89 ff             	mov    %rdi,%r15
+  80185a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80185e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  801863:	49 bc 31 18 80 00 00 	movabs $0x801831,%r12
+  80186a:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  80186d:	49 be d2 17 80 00 00 	movabs $0x8017d2,%r14
+  801874:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  801877:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  80187e:	00 00 00 
+  801881:	eb 0c                	jmp    80188f <foreach_shared_region+0x49>
+  801883:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80188a:	4c 39 eb             	cmp    %r13,%rbx
+  80188d:	74 38                	je     8018c7 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  80188f:	48 89 df             	mov    %rbx,%rdi
+  801892:	41 ff d4             	call   *%r12
+  801895:	84 c0                	test   %al,%al
+  801897:	74 ea                	je     801883 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  801899:	48 89 df             	mov    %rbx,%rdi
+  80189c:	41 ff d6             	call   *%r14
+  80189f:	a8 40                	test   $0x40,%al
+  8018a1:	74 e0                	je     801883 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8018a3:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8018aa:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8018ae:	48 89 df             	mov    %rbx,%rdi
+  8018b1:	41 ff d7             	call   *%r15
+        if (err)
+  8018b4:	85 c0                	test   %eax,%eax
+  8018b6:	74 cb                	je     801883 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8018b8:	48 83 c4 18          	add    $0x18,%rsp
+  8018bc:	5b                   	pop    %rbx
+  8018bd:	41 5c                	pop    %r12
+  8018bf:	41 5d                	pop    %r13
+  8018c1:	41 5e                	pop    %r14
+  8018c3:	41 5f                	pop    %r15
+  8018c5:	5d                   	pop    %rbp
+  8018c6:	c3                   	ret
+    return 0;
+  8018c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018cc:	eb ea                	jmp    8018b8 <foreach_shared_region+0x72>
+
+00000000008018ce <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8018ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d3:	c3                   	ret
+
+00000000008018d4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8018d4:	55                   	push   %rbp
+  8018d5:	48 89 e5             	mov    %rsp,%rbp
+  8018d8:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8018db:	48 be 54 2c 80 00 00 	movabs $0x802c54,%rsi
+  8018e2:	00 00 00 
+  8018e5:	48 b8 6e 25 80 00 00 	movabs $0x80256e,%rax
+  8018ec:	00 00 00 
+  8018ef:	ff d0                	call   *%rax
+    return 0;
+}
+  8018f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f6:	5d                   	pop    %rbp
+  8018f7:	c3                   	ret
+
+00000000008018f8 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8018f8:	55                   	push   %rbp
+  8018f9:	48 89 e5             	mov    %rsp,%rbp
+  8018fc:	41 57                	push   %r15
+  8018fe:	41 56                	push   %r14
+  801900:	41 55                	push   %r13
+  801902:	41 54                	push   %r12
+  801904:	53                   	push   %rbx
+  801905:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80190c:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801913:	48 85 d2             	test   %rdx,%rdx
+  801916:	74 7a                	je     801992 <devcons_write+0x9a>
+  801918:	49 89 d6             	mov    %rdx,%r14
+  80191b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801921:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801926:	49 bf 68 27 80 00 00 	movabs $0x802768,%r15
+  80192d:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801930:	4c 89 f3             	mov    %r14,%rbx
+  801933:	48 29 f3             	sub    %rsi,%rbx
+  801936:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80193b:	48 39 c3             	cmp    %rax,%rbx
+  80193e:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801942:	4c 63 eb             	movslq %ebx,%r13
+  801945:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80194c:	48 01 c6             	add    %rax,%rsi
+  80194f:	4c 89 ea             	mov    %r13,%rdx
+  801952:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801959:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80195c:	4c 89 ee             	mov    %r13,%rsi
+  80195f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801966:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  80196d:	00 00 00 
+  801970:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801972:	41 01 dc             	add    %ebx,%r12d
+  801975:	49 63 f4             	movslq %r12d,%rsi
+  801978:	4c 39 f6             	cmp    %r14,%rsi
+  80197b:	72 b3                	jb     801930 <devcons_write+0x38>
+    return res;
+  80197d:	49 63 c4             	movslq %r12d,%rax
+}
+  801980:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801987:	5b                   	pop    %rbx
+  801988:	41 5c                	pop    %r12
+  80198a:	41 5d                	pop    %r13
+  80198c:	41 5e                	pop    %r14
+  80198e:	41 5f                	pop    %r15
+  801990:	5d                   	pop    %rbp
+  801991:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801992:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801998:	eb e3                	jmp    80197d <devcons_write+0x85>
+
+000000000080199a <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80199a:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80199d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a2:	48 85 c0             	test   %rax,%rax
+  8019a5:	74 55                	je     8019fc <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8019a7:	55                   	push   %rbp
+  8019a8:	48 89 e5             	mov    %rsp,%rbp
+  8019ab:	41 55                	push   %r13
+  8019ad:	41 54                	push   %r12
+  8019af:	53                   	push   %rbx
+  8019b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8019b4:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8019b7:	48 bb 28 01 80 00 00 	movabs $0x800128,%rbx
+  8019be:	00 00 00 
+  8019c1:	49 bc f5 01 80 00 00 	movabs $0x8001f5,%r12
+  8019c8:	00 00 00 
+  8019cb:	eb 03                	jmp    8019d0 <devcons_read+0x36>
+  8019cd:	41 ff d4             	call   *%r12
+  8019d0:	ff d3                	call   *%rbx
+  8019d2:	85 c0                	test   %eax,%eax
+  8019d4:	74 f7                	je     8019cd <devcons_read+0x33>
+    if (c < 0) return c;
+  8019d6:	48 63 d0             	movslq %eax,%rdx
+  8019d9:	78 13                	js     8019ee <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8019db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e0:	83 f8 04             	cmp    $0x4,%eax
+  8019e3:	74 09                	je     8019ee <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8019e5:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8019e9:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8019ee:	48 89 d0             	mov    %rdx,%rax
+  8019f1:	48 83 c4 08          	add    $0x8,%rsp
+  8019f5:	5b                   	pop    %rbx
+  8019f6:	41 5c                	pop    %r12
+  8019f8:	41 5d                	pop    %r13
+  8019fa:	5d                   	pop    %rbp
+  8019fb:	c3                   	ret
+  8019fc:	48 89 d0             	mov    %rdx,%rax
+  8019ff:	c3                   	ret
+
+0000000000801a00 <cputchar>:
+cputchar(int ch) {
+  801a00:	55                   	push   %rbp
+  801a01:	48 89 e5             	mov    %rsp,%rbp
+  801a04:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801a08:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801a0c:	be 01 00 00 00       	mov    $0x1,%esi
+  801a11:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801a15:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  801a1c:	00 00 00 
+  801a1f:	ff d0                	call   *%rax
+}
+  801a21:	c9                   	leave
+  801a22:	c3                   	ret
+
+0000000000801a23 <getchar>:
+getchar(void) {
+  801a23:	55                   	push   %rbp
+  801a24:	48 89 e5             	mov    %rsp,%rbp
+  801a27:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801a2b:	ba 01 00 00 00       	mov    $0x1,%edx
+  801a30:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801a34:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a39:	48 b8 97 0b 80 00 00 	movabs $0x800b97,%rax
+  801a40:	00 00 00 
+  801a43:	ff d0                	call   *%rax
+  801a45:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801a47:	85 c0                	test   %eax,%eax
+  801a49:	78 06                	js     801a51 <getchar+0x2e>
+  801a4b:	74 08                	je     801a55 <getchar+0x32>
+  801a4d:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801a51:	89 d0                	mov    %edx,%eax
+  801a53:	c9                   	leave
+  801a54:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801a55:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801a5a:	eb f5                	jmp    801a51 <getchar+0x2e>
+
+0000000000801a5c <iscons>:
+iscons(int fdnum) {
+  801a5c:	55                   	push   %rbp
+  801a5d:	48 89 e5             	mov    %rsp,%rbp
+  801a60:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801a64:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a68:	48 b8 b4 08 80 00 00 	movabs $0x8008b4,%rax
+  801a6f:	00 00 00 
+  801a72:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a74:	85 c0                	test   %eax,%eax
+  801a76:	78 18                	js     801a90 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801a78:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a7c:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801a83:	00 00 00 
+  801a86:	8b 00                	mov    (%rax),%eax
+  801a88:	39 02                	cmp    %eax,(%rdx)
+  801a8a:	0f 94 c0             	sete   %al
+  801a8d:	0f b6 c0             	movzbl %al,%eax
+}
+  801a90:	c9                   	leave
+  801a91:	c3                   	ret
+
+0000000000801a92 <opencons>:
+opencons(void) {
+  801a92:	55                   	push   %rbp
+  801a93:	48 89 e5             	mov    %rsp,%rbp
+  801a96:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801a9a:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801a9e:	48 b8 54 08 80 00 00 	movabs $0x800854,%rax
+  801aa5:	00 00 00 
+  801aa8:	ff d0                	call   *%rax
+  801aaa:	85 c0                	test   %eax,%eax
+  801aac:	78 49                	js     801af7 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801aae:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ab3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ab8:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801abc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ac1:	48 b8 84 02 80 00 00 	movabs $0x800284,%rax
+  801ac8:	00 00 00 
+  801acb:	ff d0                	call   *%rax
+  801acd:	85 c0                	test   %eax,%eax
+  801acf:	78 26                	js     801af7 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801ad1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ad5:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801adc:	00 00 
+  801ade:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801ae0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801ae4:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801aeb:	48 b8 26 08 80 00 00 	movabs $0x800826,%rax
+  801af2:	00 00 00 
+  801af5:	ff d0                	call   *%rax
+}
+  801af7:	c9                   	leave
+  801af8:	c3                   	ret
+
+0000000000801af9 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801af9:	55                   	push   %rbp
+  801afa:	48 89 e5             	mov    %rsp,%rbp
+  801afd:	41 56                	push   %r14
+  801aff:	41 55                	push   %r13
+  801b01:	41 54                	push   %r12
+  801b03:	53                   	push   %rbx
+  801b04:	48 83 ec 50          	sub    $0x50,%rsp
+  801b08:	49 89 fc             	mov    %rdi,%r12
+  801b0b:	41 89 f5             	mov    %esi,%r13d
+  801b0e:	48 89 d3             	mov    %rdx,%rbx
+  801b11:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b15:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801b19:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801b1d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801b24:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b28:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801b2c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801b30:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801b34:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801b3b:	00 00 00 
+  801b3e:	4c 8b 30             	mov    (%rax),%r14
+  801b41:	48 b8 c4 01 80 00 00 	movabs $0x8001c4,%rax
+  801b48:	00 00 00 
+  801b4b:	ff d0                	call   *%rax
+  801b4d:	89 c6                	mov    %eax,%esi
+  801b4f:	45 89 e8             	mov    %r13d,%r8d
+  801b52:	4c 89 e1             	mov    %r12,%rcx
+  801b55:	4c 89 f2             	mov    %r14,%rdx
+  801b58:	48 bf 60 2c 80 00 00 	movabs $0x802c60,%rdi
+  801b5f:	00 00 00 
+  801b62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b67:	49 bc 49 1c 80 00 00 	movabs $0x801c49,%r12
+  801b6e:	00 00 00 
+  801b71:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801b74:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801b78:	48 89 df             	mov    %rbx,%rdi
+  801b7b:	48 b8 e5 1b 80 00 00 	movabs $0x801be5,%rax
+  801b82:	00 00 00 
+  801b85:	ff d0                	call   *%rax
+    cprintf("\n");
+  801b87:	48 bf bb 2b 80 00 00 	movabs $0x802bbb,%rdi
+  801b8e:	00 00 00 
+  801b91:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b96:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801b99:	cc                   	int3
+  801b9a:	eb fd                	jmp    801b99 <_panic+0xa0>
+
+0000000000801b9c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801b9c:	55                   	push   %rbp
+  801b9d:	48 89 e5             	mov    %rsp,%rbp
+  801ba0:	53                   	push   %rbx
+  801ba1:	48 83 ec 08          	sub    $0x8,%rsp
+  801ba5:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801ba8:	8b 06                	mov    (%rsi),%eax
+  801baa:	8d 50 01             	lea    0x1(%rax),%edx
+  801bad:	89 16                	mov    %edx,(%rsi)
+  801baf:	48 98                	cltq
+  801bb1:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801bb6:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801bbc:	74 0a                	je     801bc8 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801bbe:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801bc2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bc6:	c9                   	leave
+  801bc7:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801bc8:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801bcc:	be ff 00 00 00       	mov    $0xff,%esi
+  801bd1:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  801bd8:	00 00 00 
+  801bdb:	ff d0                	call   *%rax
+        state->offset = 0;
+  801bdd:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801be3:	eb d9                	jmp    801bbe <putch+0x22>
+
+0000000000801be5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801be5:	55                   	push   %rbp
+  801be6:	48 89 e5             	mov    %rsp,%rbp
+  801be9:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801bf0:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801bf3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801bfa:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801bff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c04:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801c07:	48 89 f1             	mov    %rsi,%rcx
+  801c0a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801c11:	48 bf 9c 1b 80 00 00 	movabs $0x801b9c,%rdi
+  801c18:	00 00 00 
+  801c1b:	48 b8 99 1d 80 00 00 	movabs $0x801d99,%rax
+  801c22:	00 00 00 
+  801c25:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801c27:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801c2e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801c35:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  801c3c:	00 00 00 
+  801c3f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801c41:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801c47:	c9                   	leave
+  801c48:	c3                   	ret
+
+0000000000801c49 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801c49:	55                   	push   %rbp
+  801c4a:	48 89 e5             	mov    %rsp,%rbp
+  801c4d:	48 83 ec 50          	sub    $0x50,%rsp
+  801c51:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801c55:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801c59:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c5d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801c61:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801c65:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801c6c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c74:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801c78:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801c7c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801c80:	48 b8 e5 1b 80 00 00 	movabs $0x801be5,%rax
+  801c87:	00 00 00 
+  801c8a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801c8c:	c9                   	leave
+  801c8d:	c3                   	ret
+
+0000000000801c8e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801c8e:	55                   	push   %rbp
+  801c8f:	48 89 e5             	mov    %rsp,%rbp
+  801c92:	41 57                	push   %r15
+  801c94:	41 56                	push   %r14
+  801c96:	41 55                	push   %r13
+  801c98:	41 54                	push   %r12
+  801c9a:	53                   	push   %rbx
+  801c9b:	48 83 ec 18          	sub    $0x18,%rsp
+  801c9f:	49 89 fc             	mov    %rdi,%r12
+  801ca2:	49 89 f5             	mov    %rsi,%r13
+  801ca5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ca9:	8b 45 10             	mov    0x10(%rbp),%eax
+  801cac:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801caf:	41 89 cf             	mov    %ecx,%r15d
+  801cb2:	4c 39 fa             	cmp    %r15,%rdx
+  801cb5:	73 5b                	jae    801d12 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801cb7:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801cbb:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801cbf:	85 db                	test   %ebx,%ebx
+  801cc1:	7e 0e                	jle    801cd1 <print_num+0x43>
+            putch(padc, put_arg);
+  801cc3:	4c 89 ee             	mov    %r13,%rsi
+  801cc6:	44 89 f7             	mov    %r14d,%edi
+  801cc9:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801ccc:	83 eb 01             	sub    $0x1,%ebx
+  801ccf:	75 f2                	jne    801cc3 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801cd1:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801cd5:	48 b9 94 2c 80 00 00 	movabs $0x802c94,%rcx
+  801cdc:	00 00 00 
+  801cdf:	48 b8 83 2c 80 00 00 	movabs $0x802c83,%rax
+  801ce6:	00 00 00 
+  801ce9:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801ced:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cf1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cf6:	49 f7 f7             	div    %r15
+  801cf9:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801cfd:	4c 89 ee             	mov    %r13,%rsi
+  801d00:	41 ff d4             	call   *%r12
+}
+  801d03:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801d07:	5b                   	pop    %rbx
+  801d08:	41 5c                	pop    %r12
+  801d0a:	41 5d                	pop    %r13
+  801d0c:	41 5e                	pop    %r14
+  801d0e:	41 5f                	pop    %r15
+  801d10:	5d                   	pop    %rbp
+  801d11:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801d12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d16:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d1b:	49 f7 f7             	div    %r15
+  801d1e:	48 83 ec 08          	sub    $0x8,%rsp
+  801d22:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801d26:	52                   	push   %rdx
+  801d27:	45 0f be c9          	movsbl %r9b,%r9d
+  801d2b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801d2f:	48 89 c2             	mov    %rax,%rdx
+  801d32:	48 b8 8e 1c 80 00 00 	movabs $0x801c8e,%rax
+  801d39:	00 00 00 
+  801d3c:	ff d0                	call   *%rax
+  801d3e:	48 83 c4 10          	add    $0x10,%rsp
+  801d42:	eb 8d                	jmp    801cd1 <print_num+0x43>
+
+0000000000801d44 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801d44:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801d48:	48 8b 06             	mov    (%rsi),%rax
+  801d4b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801d4f:	73 0a                	jae    801d5b <sprintputch+0x17>
+        *state->start++ = ch;
+  801d51:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d55:	48 89 16             	mov    %rdx,(%rsi)
+  801d58:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801d5b:	c3                   	ret
+
+0000000000801d5c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801d5c:	55                   	push   %rbp
+  801d5d:	48 89 e5             	mov    %rsp,%rbp
+  801d60:	48 83 ec 50          	sub    $0x50,%rsp
+  801d64:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d68:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d6c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801d70:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801d77:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d7f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801d83:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801d87:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801d8b:	48 b8 99 1d 80 00 00 	movabs $0x801d99,%rax
+  801d92:	00 00 00 
+  801d95:	ff d0                	call   *%rax
+}
+  801d97:	c9                   	leave
+  801d98:	c3                   	ret
+
+0000000000801d99 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801d99:	55                   	push   %rbp
+  801d9a:	48 89 e5             	mov    %rsp,%rbp
+  801d9d:	41 57                	push   %r15
+  801d9f:	41 56                	push   %r14
+  801da1:	41 55                	push   %r13
+  801da3:	41 54                	push   %r12
+  801da5:	53                   	push   %rbx
+  801da6:	48 83 ec 38          	sub    $0x38,%rsp
+  801daa:	49 89 fe             	mov    %rdi,%r14
+  801dad:	49 89 f5             	mov    %rsi,%r13
+  801db0:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801db3:	48 8b 01             	mov    (%rcx),%rax
+  801db6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801dba:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801dbe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dc2:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801dc6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801dca:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801dce:	0f b6 3b             	movzbl (%rbx),%edi
+  801dd1:	40 80 ff 25          	cmp    $0x25,%dil
+  801dd5:	74 18                	je     801def <vprintfmt+0x56>
+            if (!ch) return;
+  801dd7:	40 84 ff             	test   %dil,%dil
+  801dda:	0f 84 b1 06 00 00    	je     802491 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801de0:	40 0f b6 ff          	movzbl %dil,%edi
+  801de4:	4c 89 ee             	mov    %r13,%rsi
+  801de7:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801dea:	4c 89 e3             	mov    %r12,%rbx
+  801ded:	eb db                	jmp    801dca <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801def:	be 00 00 00 00       	mov    $0x0,%esi
+  801df4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801df8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801dfd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e03:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801e0a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e0e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801e13:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801e18:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801e1b:	83 e8 23             	sub    $0x23,%eax
+  801e1e:	3c 57                	cmp    $0x57,%al
+  801e20:	0f 87 51 06 00 00    	ja     802477 <vprintfmt+0x6de>
+  801e26:	0f b6 c0             	movzbl %al,%eax
+  801e29:	48 b9 40 2e 80 00 00 	movabs $0x802e40,%rcx
+  801e30:	00 00 00 
+  801e33:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801e36:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801e39:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801e3d:	eb cf                	jmp    801e0e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801e3f:	49 89 dc             	mov    %rbx,%r12
+  801e42:	be 01 00 00 00       	mov    $0x1,%esi
+  801e47:	eb c5                	jmp    801e0e <vprintfmt+0x75>
+            padc = ch;
+  801e49:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801e4d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e50:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801e53:	eb b9                	jmp    801e0e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e58:	83 f8 2f             	cmp    $0x2f,%eax
+  801e5b:	77 24                	ja     801e81 <vprintfmt+0xe8>
+  801e5d:	89 c1                	mov    %eax,%ecx
+  801e5f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801e63:	83 c0 08             	add    $0x8,%eax
+  801e66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e69:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801e6c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801e6f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801e73:	79 99                	jns    801e0e <vprintfmt+0x75>
+                width = precision;
+  801e75:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801e79:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e7f:	eb 8d                	jmp    801e0e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e81:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e85:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801e89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e8d:	eb da                	jmp    801e69 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801e8f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801e94:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801e98:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801e9e:	3c 39                	cmp    $0x39,%al
+  801ea0:	77 1c                	ja     801ebe <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801ea2:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801ea6:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801eaa:	0f b6 c0             	movzbl %al,%eax
+  801ead:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801eb2:	0f b6 03             	movzbl (%rbx),%eax
+  801eb5:	3c 39                	cmp    $0x39,%al
+  801eb7:	76 e9                	jbe    801ea2 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801eb9:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801ebc:	eb b1                	jmp    801e6f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801ebe:	49 89 dc             	mov    %rbx,%r12
+  801ec1:	eb ac                	jmp    801e6f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801ec3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801ec6:	85 c9                	test   %ecx,%ecx
+  801ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ecd:	0f 49 c1             	cmovns %ecx,%eax
+  801ed0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801ed3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ed6:	e9 33 ff ff ff       	jmp    801e0e <vprintfmt+0x75>
+            lflag++;
+  801edb:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ede:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ee1:	e9 28 ff ff ff       	jmp    801e0e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801ee6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ee9:	83 f8 2f             	cmp    $0x2f,%eax
+  801eec:	77 19                	ja     801f07 <vprintfmt+0x16e>
+  801eee:	89 c2                	mov    %eax,%edx
+  801ef0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ef4:	83 c0 08             	add    $0x8,%eax
+  801ef7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801efa:	8b 3a                	mov    (%rdx),%edi
+  801efc:	4c 89 ee             	mov    %r13,%rsi
+  801eff:	41 ff d6             	call   *%r14
+            break;
+  801f02:	e9 c3 fe ff ff       	jmp    801dca <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  801f07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f13:	eb e5                	jmp    801efa <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  801f15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f18:	83 f8 2f             	cmp    $0x2f,%eax
+  801f1b:	77 5a                	ja     801f77 <vprintfmt+0x1de>
+  801f1d:	89 c2                	mov    %eax,%edx
+  801f1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f23:	83 c0 08             	add    $0x8,%eax
+  801f26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801f29:	8b 02                	mov    (%rdx),%eax
+  801f2b:	89 c1                	mov    %eax,%ecx
+  801f2d:	f7 d9                	neg    %ecx
+  801f2f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801f32:	83 f9 15             	cmp    $0x15,%ecx
+  801f35:	7f 4e                	jg     801f85 <vprintfmt+0x1ec>
+  801f37:	48 63 c1             	movslq %ecx,%rax
+  801f3a:	48 ba 00 31 80 00 00 	movabs $0x803100,%rdx
+  801f41:	00 00 00 
+  801f44:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801f48:	48 85 c0             	test   %rax,%rax
+  801f4b:	74 38                	je     801f85 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801f4d:	48 89 c1             	mov    %rax,%rcx
+  801f50:	48 ba 19 2c 80 00 00 	movabs $0x802c19,%rdx
+  801f57:	00 00 00 
+  801f5a:	4c 89 ee             	mov    %r13,%rsi
+  801f5d:	4c 89 f7             	mov    %r14,%rdi
+  801f60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f65:	49 b8 5c 1d 80 00 00 	movabs $0x801d5c,%r8
+  801f6c:	00 00 00 
+  801f6f:	41 ff d0             	call   *%r8
+  801f72:	e9 53 fe ff ff       	jmp    801dca <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801f77:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f7b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f83:	eb a4                	jmp    801f29 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801f85:	48 ba ac 2c 80 00 00 	movabs $0x802cac,%rdx
+  801f8c:	00 00 00 
+  801f8f:	4c 89 ee             	mov    %r13,%rsi
+  801f92:	4c 89 f7             	mov    %r14,%rdi
+  801f95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9a:	49 b8 5c 1d 80 00 00 	movabs $0x801d5c,%r8
+  801fa1:	00 00 00 
+  801fa4:	41 ff d0             	call   *%r8
+  801fa7:	e9 1e fe ff ff       	jmp    801dca <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801fac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801faf:	83 f8 2f             	cmp    $0x2f,%eax
+  801fb2:	77 6c                	ja     802020 <vprintfmt+0x287>
+  801fb4:	89 c2                	mov    %eax,%edx
+  801fb6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fba:	83 c0 08             	add    $0x8,%eax
+  801fbd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fc0:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801fc3:	48 85 d2             	test   %rdx,%rdx
+  801fc6:	48 b8 a5 2c 80 00 00 	movabs $0x802ca5,%rax
+  801fcd:	00 00 00 
+  801fd0:	48 0f 45 c2          	cmovne %rdx,%rax
+  801fd4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801fd8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801fdc:	7e 06                	jle    801fe4 <vprintfmt+0x24b>
+  801fde:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801fe2:	75 4a                	jne    80202e <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801fe4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801fe8:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801fec:	0f b6 00             	movzbl (%rax),%eax
+  801fef:	84 c0                	test   %al,%al
+  801ff1:	0f 85 9a 00 00 00    	jne    802091 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  801ff7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ffa:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801ffe:	85 c0                	test   %eax,%eax
+  802000:	0f 8e c4 fd ff ff    	jle    801dca <vprintfmt+0x31>
+  802006:	4c 89 ee             	mov    %r13,%rsi
+  802009:	bf 20 00 00 00       	mov    $0x20,%edi
+  80200e:	41 ff d6             	call   *%r14
+  802011:	41 83 ec 01          	sub    $0x1,%r12d
+  802015:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802019:	75 eb                	jne    802006 <vprintfmt+0x26d>
+  80201b:	e9 aa fd ff ff       	jmp    801dca <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802020:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802024:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802028:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80202c:	eb 92                	jmp    801fc0 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80202e:	49 63 f7             	movslq %r15d,%rsi
+  802031:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802035:	48 b8 4b 25 80 00 00 	movabs $0x80254b,%rax
+  80203c:	00 00 00 
+  80203f:	ff d0                	call   *%rax
+  802041:	48 89 c2             	mov    %rax,%rdx
+  802044:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802047:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802049:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80204c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80204f:	85 c0                	test   %eax,%eax
+  802051:	7e 91                	jle    801fe4 <vprintfmt+0x24b>
+  802053:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802058:	4c 89 ee             	mov    %r13,%rsi
+  80205b:	44 89 e7             	mov    %r12d,%edi
+  80205e:	41 ff d6             	call   *%r14
+  802061:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802065:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802068:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80206b:	75 eb                	jne    802058 <vprintfmt+0x2bf>
+  80206d:	e9 72 ff ff ff       	jmp    801fe4 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802072:	0f b6 f8             	movzbl %al,%edi
+  802075:	4c 89 ee             	mov    %r13,%rsi
+  802078:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80207b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80207f:	49 83 c4 01          	add    $0x1,%r12
+  802083:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802089:	84 c0                	test   %al,%al
+  80208b:	0f 84 66 ff ff ff    	je     801ff7 <vprintfmt+0x25e>
+  802091:	45 85 ff             	test   %r15d,%r15d
+  802094:	78 0a                	js     8020a0 <vprintfmt+0x307>
+  802096:	41 83 ef 01          	sub    $0x1,%r15d
+  80209a:	0f 88 57 ff ff ff    	js     801ff7 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8020a0:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8020a4:	74 cc                	je     802072 <vprintfmt+0x2d9>
+  8020a6:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8020a9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8020ae:	80 fa 5e             	cmp    $0x5e,%dl
+  8020b1:	77 c2                	ja     802075 <vprintfmt+0x2dc>
+  8020b3:	eb bd                	jmp    802072 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8020b5:	40 84 f6             	test   %sil,%sil
+  8020b8:	75 26                	jne    8020e0 <vprintfmt+0x347>
+    switch (lflag) {
+  8020ba:	85 d2                	test   %edx,%edx
+  8020bc:	74 59                	je     802117 <vprintfmt+0x37e>
+  8020be:	83 fa 01             	cmp    $0x1,%edx
+  8020c1:	74 7b                	je     80213e <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8020c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8020c9:	0f 87 96 00 00 00    	ja     802165 <vprintfmt+0x3cc>
+  8020cf:	89 c2                	mov    %eax,%edx
+  8020d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020d5:	83 c0 08             	add    $0x8,%eax
+  8020d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020db:	4c 8b 22             	mov    (%rdx),%r12
+  8020de:	eb 17                	jmp    8020f7 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8020e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8020e6:	77 21                	ja     802109 <vprintfmt+0x370>
+  8020e8:	89 c2                	mov    %eax,%edx
+  8020ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020ee:	83 c0 08             	add    $0x8,%eax
+  8020f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020f4:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8020f7:	4d 85 e4             	test   %r12,%r12
+  8020fa:	78 7a                	js     802176 <vprintfmt+0x3dd>
+            num = i;
+  8020fc:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8020ff:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802104:	e9 50 02 00 00       	jmp    802359 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802109:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80210d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802111:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802115:	eb dd                	jmp    8020f4 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802117:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80211a:	83 f8 2f             	cmp    $0x2f,%eax
+  80211d:	77 11                	ja     802130 <vprintfmt+0x397>
+  80211f:	89 c2                	mov    %eax,%edx
+  802121:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802125:	83 c0 08             	add    $0x8,%eax
+  802128:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80212b:	4c 63 22             	movslq (%rdx),%r12
+  80212e:	eb c7                	jmp    8020f7 <vprintfmt+0x35e>
+  802130:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802134:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802138:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80213c:	eb ed                	jmp    80212b <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80213e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802141:	83 f8 2f             	cmp    $0x2f,%eax
+  802144:	77 11                	ja     802157 <vprintfmt+0x3be>
+  802146:	89 c2                	mov    %eax,%edx
+  802148:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80214c:	83 c0 08             	add    $0x8,%eax
+  80214f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802152:	4c 8b 22             	mov    (%rdx),%r12
+  802155:	eb a0                	jmp    8020f7 <vprintfmt+0x35e>
+  802157:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80215b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80215f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802163:	eb ed                	jmp    802152 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802165:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802169:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80216d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802171:	e9 65 ff ff ff       	jmp    8020db <vprintfmt+0x342>
+                putch('-', put_arg);
+  802176:	4c 89 ee             	mov    %r13,%rsi
+  802179:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80217e:	41 ff d6             	call   *%r14
+                i = -i;
+  802181:	49 f7 dc             	neg    %r12
+  802184:	e9 73 ff ff ff       	jmp    8020fc <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802189:	40 84 f6             	test   %sil,%sil
+  80218c:	75 32                	jne    8021c0 <vprintfmt+0x427>
+    switch (lflag) {
+  80218e:	85 d2                	test   %edx,%edx
+  802190:	74 5d                	je     8021ef <vprintfmt+0x456>
+  802192:	83 fa 01             	cmp    $0x1,%edx
+  802195:	0f 84 82 00 00 00    	je     80221d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80219b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80219e:	83 f8 2f             	cmp    $0x2f,%eax
+  8021a1:	0f 87 a5 00 00 00    	ja     80224c <vprintfmt+0x4b3>
+  8021a7:	89 c2                	mov    %eax,%edx
+  8021a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021ad:	83 c0 08             	add    $0x8,%eax
+  8021b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021b3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8021bb:	e9 99 01 00 00       	jmp    802359 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8021c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8021c6:	77 19                	ja     8021e1 <vprintfmt+0x448>
+  8021c8:	89 c2                	mov    %eax,%edx
+  8021ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021ce:	83 c0 08             	add    $0x8,%eax
+  8021d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021d4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021d7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8021dc:	e9 78 01 00 00       	jmp    802359 <vprintfmt+0x5c0>
+  8021e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021ed:	eb e5                	jmp    8021d4 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8021ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8021f5:	77 18                	ja     80220f <vprintfmt+0x476>
+  8021f7:	89 c2                	mov    %eax,%edx
+  8021f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021fd:	83 c0 08             	add    $0x8,%eax
+  802200:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802203:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802205:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80220a:	e9 4a 01 00 00       	jmp    802359 <vprintfmt+0x5c0>
+  80220f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802213:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802217:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80221b:	eb e6                	jmp    802203 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80221d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802220:	83 f8 2f             	cmp    $0x2f,%eax
+  802223:	77 19                	ja     80223e <vprintfmt+0x4a5>
+  802225:	89 c2                	mov    %eax,%edx
+  802227:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80222b:	83 c0 08             	add    $0x8,%eax
+  80222e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802231:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802234:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802239:	e9 1b 01 00 00       	jmp    802359 <vprintfmt+0x5c0>
+  80223e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802242:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802246:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80224a:	eb e5                	jmp    802231 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80224c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802250:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802254:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802258:	e9 56 ff ff ff       	jmp    8021b3 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80225d:	40 84 f6             	test   %sil,%sil
+  802260:	75 2e                	jne    802290 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802262:	85 d2                	test   %edx,%edx
+  802264:	74 59                	je     8022bf <vprintfmt+0x526>
+  802266:	83 fa 01             	cmp    $0x1,%edx
+  802269:	74 7f                	je     8022ea <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80226b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80226e:	83 f8 2f             	cmp    $0x2f,%eax
+  802271:	0f 87 9f 00 00 00    	ja     802316 <vprintfmt+0x57d>
+  802277:	89 c2                	mov    %eax,%edx
+  802279:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80227d:	83 c0 08             	add    $0x8,%eax
+  802280:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802283:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802286:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80228b:	e9 c9 00 00 00       	jmp    802359 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802290:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802293:	83 f8 2f             	cmp    $0x2f,%eax
+  802296:	77 19                	ja     8022b1 <vprintfmt+0x518>
+  802298:	89 c2                	mov    %eax,%edx
+  80229a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80229e:	83 c0 08             	add    $0x8,%eax
+  8022a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022a4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8022a7:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022ac:	e9 a8 00 00 00       	jmp    802359 <vprintfmt+0x5c0>
+  8022b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022bd:	eb e5                	jmp    8022a4 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8022bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8022c5:	77 15                	ja     8022dc <vprintfmt+0x543>
+  8022c7:	89 c2                	mov    %eax,%edx
+  8022c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022cd:	83 c0 08             	add    $0x8,%eax
+  8022d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022d3:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8022d5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8022da:	eb 7d                	jmp    802359 <vprintfmt+0x5c0>
+  8022dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022e8:	eb e9                	jmp    8022d3 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8022ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8022f0:	77 16                	ja     802308 <vprintfmt+0x56f>
+  8022f2:	89 c2                	mov    %eax,%edx
+  8022f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022f8:	83 c0 08             	add    $0x8,%eax
+  8022fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022fe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802301:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802306:	eb 51                	jmp    802359 <vprintfmt+0x5c0>
+  802308:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80230c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802310:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802314:	eb e8                	jmp    8022fe <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802316:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80231a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80231e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802322:	e9 5c ff ff ff       	jmp    802283 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802327:	4c 89 ee             	mov    %r13,%rsi
+  80232a:	bf 30 00 00 00       	mov    $0x30,%edi
+  80232f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802332:	4c 89 ee             	mov    %r13,%rsi
+  802335:	bf 78 00 00 00       	mov    $0x78,%edi
+  80233a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80233d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802340:	83 f8 2f             	cmp    $0x2f,%eax
+  802343:	77 47                	ja     80238c <vprintfmt+0x5f3>
+  802345:	89 c2                	mov    %eax,%edx
+  802347:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80234b:	83 c0 08             	add    $0x8,%eax
+  80234e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802351:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802354:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802359:	48 83 ec 08          	sub    $0x8,%rsp
+  80235d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802361:	0f 94 c0             	sete   %al
+  802364:	0f b6 c0             	movzbl %al,%eax
+  802367:	50                   	push   %rax
+  802368:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80236d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802371:	4c 89 ee             	mov    %r13,%rsi
+  802374:	4c 89 f7             	mov    %r14,%rdi
+  802377:	48 b8 8e 1c 80 00 00 	movabs $0x801c8e,%rax
+  80237e:	00 00 00 
+  802381:	ff d0                	call   *%rax
+            break;
+  802383:	48 83 c4 10          	add    $0x10,%rsp
+  802387:	e9 3e fa ff ff       	jmp    801dca <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80238c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802390:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802394:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802398:	eb b7                	jmp    802351 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80239a:	40 84 f6             	test   %sil,%sil
+  80239d:	75 2b                	jne    8023ca <vprintfmt+0x631>
+    switch (lflag) {
+  80239f:	85 d2                	test   %edx,%edx
+  8023a1:	74 56                	je     8023f9 <vprintfmt+0x660>
+  8023a3:	83 fa 01             	cmp    $0x1,%edx
+  8023a6:	74 7f                	je     802427 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8023a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8023ae:	0f 87 a2 00 00 00    	ja     802456 <vprintfmt+0x6bd>
+  8023b4:	89 c2                	mov    %eax,%edx
+  8023b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023ba:	83 c0 08             	add    $0x8,%eax
+  8023bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023c0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023c3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023c8:	eb 8f                	jmp    802359 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8023d0:	77 19                	ja     8023eb <vprintfmt+0x652>
+  8023d2:	89 c2                	mov    %eax,%edx
+  8023d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023d8:	83 c0 08             	add    $0x8,%eax
+  8023db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023de:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023e1:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023e6:	e9 6e ff ff ff       	jmp    802359 <vprintfmt+0x5c0>
+  8023eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023f7:	eb e5                	jmp    8023de <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8023f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8023ff:	77 18                	ja     802419 <vprintfmt+0x680>
+  802401:	89 c2                	mov    %eax,%edx
+  802403:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802407:	83 c0 08             	add    $0x8,%eax
+  80240a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80240d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80240f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802414:	e9 40 ff ff ff       	jmp    802359 <vprintfmt+0x5c0>
+  802419:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80241d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802421:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802425:	eb e6                	jmp    80240d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802427:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80242a:	83 f8 2f             	cmp    $0x2f,%eax
+  80242d:	77 19                	ja     802448 <vprintfmt+0x6af>
+  80242f:	89 c2                	mov    %eax,%edx
+  802431:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802435:	83 c0 08             	add    $0x8,%eax
+  802438:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80243b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80243e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802443:	e9 11 ff ff ff       	jmp    802359 <vprintfmt+0x5c0>
+  802448:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80244c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802450:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802454:	eb e5                	jmp    80243b <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802456:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80245a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80245e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802462:	e9 59 ff ff ff       	jmp    8023c0 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802467:	4c 89 ee             	mov    %r13,%rsi
+  80246a:	bf 25 00 00 00       	mov    $0x25,%edi
+  80246f:	41 ff d6             	call   *%r14
+            break;
+  802472:	e9 53 f9 ff ff       	jmp    801dca <vprintfmt+0x31>
+            putch('%', put_arg);
+  802477:	4c 89 ee             	mov    %r13,%rsi
+  80247a:	bf 25 00 00 00       	mov    $0x25,%edi
+  80247f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802482:	48 83 eb 01          	sub    $0x1,%rbx
+  802486:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80248a:	75 f6                	jne    802482 <vprintfmt+0x6e9>
+  80248c:	e9 39 f9 ff ff       	jmp    801dca <vprintfmt+0x31>
+}
+  802491:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802495:	5b                   	pop    %rbx
+  802496:	41 5c                	pop    %r12
+  802498:	41 5d                	pop    %r13
+  80249a:	41 5e                	pop    %r14
+  80249c:	41 5f                	pop    %r15
+  80249e:	5d                   	pop    %rbp
+  80249f:	c3                   	ret
+
+00000000008024a0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8024a0:	55                   	push   %rbp
+  8024a1:	48 89 e5             	mov    %rsp,%rbp
+  8024a4:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8024a8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8024ac:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8024b1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8024b5:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8024bc:	48 85 ff             	test   %rdi,%rdi
+  8024bf:	74 2b                	je     8024ec <vsnprintf+0x4c>
+  8024c1:	48 85 f6             	test   %rsi,%rsi
+  8024c4:	74 26                	je     8024ec <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8024c6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024ca:	48 bf 44 1d 80 00 00 	movabs $0x801d44,%rdi
+  8024d1:	00 00 00 
+  8024d4:	48 b8 99 1d 80 00 00 	movabs $0x801d99,%rax
+  8024db:	00 00 00 
+  8024de:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8024e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024e4:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8024e7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8024ea:	c9                   	leave
+  8024eb:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8024ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024f1:	eb f7                	jmp    8024ea <vsnprintf+0x4a>
+
+00000000008024f3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8024f3:	55                   	push   %rbp
+  8024f4:	48 89 e5             	mov    %rsp,%rbp
+  8024f7:	48 83 ec 50          	sub    $0x50,%rsp
+  8024fb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8024ff:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802503:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802507:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80250e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802512:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802516:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80251a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80251e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802522:	48 b8 a0 24 80 00 00 	movabs $0x8024a0,%rax
+  802529:	00 00 00 
+  80252c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80252e:	c9                   	leave
+  80252f:	c3                   	ret
+
+0000000000802530 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802530:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802533:	74 10                	je     802545 <strlen+0x15>
+    size_t n = 0;
+  802535:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80253a:	48 83 c0 01          	add    $0x1,%rax
+  80253e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802542:	75 f6                	jne    80253a <strlen+0xa>
+  802544:	c3                   	ret
+    size_t n = 0;
+  802545:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80254a:	c3                   	ret
+
+000000000080254b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80254b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80254e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802553:	48 85 f6             	test   %rsi,%rsi
+  802556:	74 11                	je     802569 <strnlen+0x1e>
+  802558:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80255c:	74 0c                	je     80256a <strnlen+0x1f>
+  80255e:	48 83 c2 01          	add    $0x1,%rdx
+  802562:	48 39 d0             	cmp    %rdx,%rax
+  802565:	75 f1                	jne    802558 <strnlen+0xd>
+  802567:	eb 04                	jmp    80256d <strnlen+0x22>
+  802569:	c3                   	ret
+  80256a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80256d:	c3                   	ret
+
+000000000080256e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80256e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802571:	ba 00 00 00 00       	mov    $0x0,%edx
+  802576:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80257a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80257d:	48 83 c2 01          	add    $0x1,%rdx
+  802581:	84 c9                	test   %cl,%cl
+  802583:	75 f1                	jne    802576 <strcpy+0x8>
+        ;
+    return res;
+}
+  802585:	c3                   	ret
+
+0000000000802586 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802586:	55                   	push   %rbp
+  802587:	48 89 e5             	mov    %rsp,%rbp
+  80258a:	41 54                	push   %r12
+  80258c:	53                   	push   %rbx
+  80258d:	48 89 fb             	mov    %rdi,%rbx
+  802590:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802593:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  80259a:	00 00 00 
+  80259d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80259f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8025a3:	4c 89 e6             	mov    %r12,%rsi
+  8025a6:	48 b8 6e 25 80 00 00 	movabs $0x80256e,%rax
+  8025ad:	00 00 00 
+  8025b0:	ff d0                	call   *%rax
+    return dst;
+}
+  8025b2:	48 89 d8             	mov    %rbx,%rax
+  8025b5:	5b                   	pop    %rbx
+  8025b6:	41 5c                	pop    %r12
+  8025b8:	5d                   	pop    %rbp
+  8025b9:	c3                   	ret
+
+00000000008025ba <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8025ba:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8025bd:	48 85 d2             	test   %rdx,%rdx
+  8025c0:	74 1f                	je     8025e1 <strncpy+0x27>
+  8025c2:	48 01 fa             	add    %rdi,%rdx
+  8025c5:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8025c8:	48 83 c1 01          	add    $0x1,%rcx
+  8025cc:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8025d0:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8025d4:	41 80 f8 01          	cmp    $0x1,%r8b
+  8025d8:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8025dc:	48 39 ca             	cmp    %rcx,%rdx
+  8025df:	75 e7                	jne    8025c8 <strncpy+0xe>
+    }
+    return ret;
+}
+  8025e1:	c3                   	ret
+
+00000000008025e2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8025e2:	48 89 f8             	mov    %rdi,%rax
+  8025e5:	48 85 d2             	test   %rdx,%rdx
+  8025e8:	74 24                	je     80260e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8025ea:	48 83 ea 01          	sub    $0x1,%rdx
+  8025ee:	74 1b                	je     80260b <strlcpy+0x29>
+  8025f0:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8025f4:	0f b6 16             	movzbl (%rsi),%edx
+  8025f7:	84 d2                	test   %dl,%dl
+  8025f9:	74 10                	je     80260b <strlcpy+0x29>
+            *dst++ = *src++;
+  8025fb:	48 83 c6 01          	add    $0x1,%rsi
+  8025ff:	48 83 c0 01          	add    $0x1,%rax
+  802603:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802606:	48 39 c8             	cmp    %rcx,%rax
+  802609:	75 e9                	jne    8025f4 <strlcpy+0x12>
+        *dst = '\0';
+  80260b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80260e:	48 29 f8             	sub    %rdi,%rax
+}
+  802611:	c3                   	ret
+
+0000000000802612 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802612:	0f b6 07             	movzbl (%rdi),%eax
+  802615:	84 c0                	test   %al,%al
+  802617:	74 13                	je     80262c <strcmp+0x1a>
+  802619:	38 06                	cmp    %al,(%rsi)
+  80261b:	75 0f                	jne    80262c <strcmp+0x1a>
+  80261d:	48 83 c7 01          	add    $0x1,%rdi
+  802621:	48 83 c6 01          	add    $0x1,%rsi
+  802625:	0f b6 07             	movzbl (%rdi),%eax
+  802628:	84 c0                	test   %al,%al
+  80262a:	75 ed                	jne    802619 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80262c:	0f b6 c0             	movzbl %al,%eax
+  80262f:	0f b6 16             	movzbl (%rsi),%edx
+  802632:	29 d0                	sub    %edx,%eax
+}
+  802634:	c3                   	ret
+
+0000000000802635 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802635:	48 85 d2             	test   %rdx,%rdx
+  802638:	74 1f                	je     802659 <strncmp+0x24>
+  80263a:	0f b6 07             	movzbl (%rdi),%eax
+  80263d:	84 c0                	test   %al,%al
+  80263f:	74 1e                	je     80265f <strncmp+0x2a>
+  802641:	3a 06                	cmp    (%rsi),%al
+  802643:	75 1a                	jne    80265f <strncmp+0x2a>
+  802645:	48 83 c7 01          	add    $0x1,%rdi
+  802649:	48 83 c6 01          	add    $0x1,%rsi
+  80264d:	48 83 ea 01          	sub    $0x1,%rdx
+  802651:	75 e7                	jne    80263a <strncmp+0x5>
+
+    if (!n) return 0;
+  802653:	b8 00 00 00 00       	mov    $0x0,%eax
+  802658:	c3                   	ret
+  802659:	b8 00 00 00 00       	mov    $0x0,%eax
+  80265e:	c3                   	ret
+  80265f:	48 85 d2             	test   %rdx,%rdx
+  802662:	74 09                	je     80266d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802664:	0f b6 07             	movzbl (%rdi),%eax
+  802667:	0f b6 16             	movzbl (%rsi),%edx
+  80266a:	29 d0                	sub    %edx,%eax
+  80266c:	c3                   	ret
+    if (!n) return 0;
+  80266d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802672:	c3                   	ret
+
+0000000000802673 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802673:	0f b6 17             	movzbl (%rdi),%edx
+  802676:	84 d2                	test   %dl,%dl
+  802678:	74 18                	je     802692 <strchr+0x1f>
+        if (*str == c) {
+  80267a:	0f be d2             	movsbl %dl,%edx
+  80267d:	39 f2                	cmp    %esi,%edx
+  80267f:	74 17                	je     802698 <strchr+0x25>
+    for (; *str; str++) {
+  802681:	48 83 c7 01          	add    $0x1,%rdi
+  802685:	0f b6 17             	movzbl (%rdi),%edx
+  802688:	84 d2                	test   %dl,%dl
+  80268a:	75 ee                	jne    80267a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80268c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802691:	c3                   	ret
+  802692:	b8 00 00 00 00       	mov    $0x0,%eax
+  802697:	c3                   	ret
+  802698:	48 89 f8             	mov    %rdi,%rax
+}
+  80269b:	c3                   	ret
+
+000000000080269c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80269c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80269f:	0f b6 17             	movzbl (%rdi),%edx
+  8026a2:	84 d2                	test   %dl,%dl
+  8026a4:	74 13                	je     8026b9 <strfind+0x1d>
+  8026a6:	0f be d2             	movsbl %dl,%edx
+  8026a9:	39 f2                	cmp    %esi,%edx
+  8026ab:	74 0b                	je     8026b8 <strfind+0x1c>
+  8026ad:	48 83 c0 01          	add    $0x1,%rax
+  8026b1:	0f b6 10             	movzbl (%rax),%edx
+  8026b4:	84 d2                	test   %dl,%dl
+  8026b6:	75 ee                	jne    8026a6 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8026b8:	c3                   	ret
+  8026b9:	c3                   	ret
+
+00000000008026ba <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8026ba:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8026bd:	48 89 f8             	mov    %rdi,%rax
+  8026c0:	48 f7 d8             	neg    %rax
+  8026c3:	83 e0 07             	and    $0x7,%eax
+  8026c6:	49 89 d1             	mov    %rdx,%r9
+  8026c9:	49 29 c1             	sub    %rax,%r9
+  8026cc:	78 36                	js     802704 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8026ce:	40 0f b6 c6          	movzbl %sil,%eax
+  8026d2:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8026d9:	01 01 01 
+  8026dc:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8026e0:	40 f6 c7 07          	test   $0x7,%dil
+  8026e4:	75 38                	jne    80271e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8026e6:	4c 89 c9             	mov    %r9,%rcx
+  8026e9:	48 c1 f9 03          	sar    $0x3,%rcx
+  8026ed:	74 0c                	je     8026fb <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8026ef:	fc                   	cld
+  8026f0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8026f3:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8026f7:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8026fb:	4d 85 c9             	test   %r9,%r9
+  8026fe:	75 45                	jne    802745 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802700:	4c 89 c0             	mov    %r8,%rax
+  802703:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802704:	48 85 d2             	test   %rdx,%rdx
+  802707:	74 f7                	je     802700 <memset+0x46>
+  802709:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80270c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80270f:	48 83 c0 01          	add    $0x1,%rax
+  802713:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802717:	48 39 c2             	cmp    %rax,%rdx
+  80271a:	75 f3                	jne    80270f <memset+0x55>
+  80271c:	eb e2                	jmp    802700 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80271e:	40 f6 c7 01          	test   $0x1,%dil
+  802722:	74 06                	je     80272a <memset+0x70>
+  802724:	88 07                	mov    %al,(%rdi)
+  802726:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80272a:	40 f6 c7 02          	test   $0x2,%dil
+  80272e:	74 07                	je     802737 <memset+0x7d>
+  802730:	66 89 07             	mov    %ax,(%rdi)
+  802733:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802737:	40 f6 c7 04          	test   $0x4,%dil
+  80273b:	74 a9                	je     8026e6 <memset+0x2c>
+  80273d:	89 07                	mov    %eax,(%rdi)
+  80273f:	48 83 c7 04          	add    $0x4,%rdi
+  802743:	eb a1                	jmp    8026e6 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802745:	41 f6 c1 04          	test   $0x4,%r9b
+  802749:	74 06                	je     802751 <memset+0x97>
+  80274b:	89 07                	mov    %eax,(%rdi)
+  80274d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802751:	41 f6 c1 02          	test   $0x2,%r9b
+  802755:	74 07                	je     80275e <memset+0xa4>
+  802757:	66 89 07             	mov    %ax,(%rdi)
+  80275a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80275e:	41 f6 c1 01          	test   $0x1,%r9b
+  802762:	74 9c                	je     802700 <memset+0x46>
+  802764:	88 07                	mov    %al,(%rdi)
+  802766:	eb 98                	jmp    802700 <memset+0x46>
+
+0000000000802768 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802768:	48 89 f8             	mov    %rdi,%rax
+  80276b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80276e:	48 39 fe             	cmp    %rdi,%rsi
+  802771:	73 3b                	jae    8027ae <memmove+0x46>
+  802773:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802777:	48 39 d7             	cmp    %rdx,%rdi
+  80277a:	73 32                	jae    8027ae <memmove+0x46>
+        s += n;
+        d += n;
+  80277c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802780:	48 89 d6             	mov    %rdx,%rsi
+  802783:	48 09 fe             	or     %rdi,%rsi
+  802786:	48 09 ce             	or     %rcx,%rsi
+  802789:	40 f6 c6 07          	test   $0x7,%sil
+  80278d:	75 12                	jne    8027a1 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80278f:	48 83 ef 08          	sub    $0x8,%rdi
+  802793:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802797:	48 c1 e9 03          	shr    $0x3,%rcx
+  80279b:	fd                   	std
+  80279c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80279f:	fc                   	cld
+  8027a0:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8027a1:	48 83 ef 01          	sub    $0x1,%rdi
+  8027a5:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8027a9:	fd                   	std
+  8027aa:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8027ac:	eb f1                	jmp    80279f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8027ae:	48 89 f2             	mov    %rsi,%rdx
+  8027b1:	48 09 c2             	or     %rax,%rdx
+  8027b4:	48 09 ca             	or     %rcx,%rdx
+  8027b7:	f6 c2 07             	test   $0x7,%dl
+  8027ba:	75 0c                	jne    8027c8 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8027bc:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027c0:	48 89 c7             	mov    %rax,%rdi
+  8027c3:	fc                   	cld
+  8027c4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8027c7:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8027c8:	48 89 c7             	mov    %rax,%rdi
+  8027cb:	fc                   	cld
+  8027cc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8027ce:	c3                   	ret
+
+00000000008027cf <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8027cf:	55                   	push   %rbp
+  8027d0:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8027d3:	48 b8 68 27 80 00 00 	movabs $0x802768,%rax
+  8027da:	00 00 00 
+  8027dd:	ff d0                	call   *%rax
+}
+  8027df:	5d                   	pop    %rbp
+  8027e0:	c3                   	ret
+
+00000000008027e1 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8027e1:	55                   	push   %rbp
+  8027e2:	48 89 e5             	mov    %rsp,%rbp
+  8027e5:	41 57                	push   %r15
+  8027e7:	41 56                	push   %r14
+  8027e9:	41 55                	push   %r13
+  8027eb:	41 54                	push   %r12
+  8027ed:	53                   	push   %rbx
+  8027ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8027f2:	49 89 fe             	mov    %rdi,%r14
+  8027f5:	49 89 f7             	mov    %rsi,%r15
+  8027f8:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8027fb:	48 89 f7             	mov    %rsi,%rdi
+  8027fe:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  802805:	00 00 00 
+  802808:	ff d0                	call   *%rax
+  80280a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80280d:	48 89 de             	mov    %rbx,%rsi
+  802810:	4c 89 f7             	mov    %r14,%rdi
+  802813:	48 b8 4b 25 80 00 00 	movabs $0x80254b,%rax
+  80281a:	00 00 00 
+  80281d:	ff d0                	call   *%rax
+  80281f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802822:	48 39 c3             	cmp    %rax,%rbx
+  802825:	74 36                	je     80285d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802827:	48 89 d8             	mov    %rbx,%rax
+  80282a:	4c 29 e8             	sub    %r13,%rax
+  80282d:	49 39 c4             	cmp    %rax,%r12
+  802830:	73 31                	jae    802863 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802832:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802837:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80283b:	4c 89 fe             	mov    %r15,%rsi
+  80283e:	48 b8 cf 27 80 00 00 	movabs $0x8027cf,%rax
+  802845:	00 00 00 
+  802848:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80284a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80284e:	48 83 c4 08          	add    $0x8,%rsp
+  802852:	5b                   	pop    %rbx
+  802853:	41 5c                	pop    %r12
+  802855:	41 5d                	pop    %r13
+  802857:	41 5e                	pop    %r14
+  802859:	41 5f                	pop    %r15
+  80285b:	5d                   	pop    %rbp
+  80285c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80285d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802861:	eb eb                	jmp    80284e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802863:	48 83 eb 01          	sub    $0x1,%rbx
+  802867:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80286b:	48 89 da             	mov    %rbx,%rdx
+  80286e:	4c 89 fe             	mov    %r15,%rsi
+  802871:	48 b8 cf 27 80 00 00 	movabs $0x8027cf,%rax
+  802878:	00 00 00 
+  80287b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80287d:	49 01 de             	add    %rbx,%r14
+  802880:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802885:	eb c3                	jmp    80284a <strlcat+0x69>
+
+0000000000802887 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802887:	48 85 d2             	test   %rdx,%rdx
+  80288a:	74 2d                	je     8028b9 <memcmp+0x32>
+  80288c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802891:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802895:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80289a:	44 38 c1             	cmp    %r8b,%cl
+  80289d:	75 0f                	jne    8028ae <memcmp+0x27>
+    while (n-- > 0) {
+  80289f:	48 83 c0 01          	add    $0x1,%rax
+  8028a3:	48 39 c2             	cmp    %rax,%rdx
+  8028a6:	75 e9                	jne    802891 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8028a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ad:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8028ae:	0f b6 c1             	movzbl %cl,%eax
+  8028b1:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8028b5:	44 29 c0             	sub    %r8d,%eax
+  8028b8:	c3                   	ret
+    return 0;
+  8028b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028be:	c3                   	ret
+
+00000000008028bf <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8028bf:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8028c3:	48 39 c7             	cmp    %rax,%rdi
+  8028c6:	73 0f                	jae    8028d7 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8028c8:	40 38 37             	cmp    %sil,(%rdi)
+  8028cb:	74 0e                	je     8028db <memfind+0x1c>
+    for (; src < end; src++) {
+  8028cd:	48 83 c7 01          	add    $0x1,%rdi
+  8028d1:	48 39 f8             	cmp    %rdi,%rax
+  8028d4:	75 f2                	jne    8028c8 <memfind+0x9>
+  8028d6:	c3                   	ret
+  8028d7:	48 89 f8             	mov    %rdi,%rax
+  8028da:	c3                   	ret
+  8028db:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8028de:	c3                   	ret
+
+00000000008028df <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8028df:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8028e2:	0f b6 37             	movzbl (%rdi),%esi
+  8028e5:	40 80 fe 20          	cmp    $0x20,%sil
+  8028e9:	74 06                	je     8028f1 <strtol+0x12>
+  8028eb:	40 80 fe 09          	cmp    $0x9,%sil
+  8028ef:	75 13                	jne    802904 <strtol+0x25>
+  8028f1:	48 83 c7 01          	add    $0x1,%rdi
+  8028f5:	0f b6 37             	movzbl (%rdi),%esi
+  8028f8:	40 80 fe 20          	cmp    $0x20,%sil
+  8028fc:	74 f3                	je     8028f1 <strtol+0x12>
+  8028fe:	40 80 fe 09          	cmp    $0x9,%sil
+  802902:	74 ed                	je     8028f1 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802904:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802907:	83 e0 fd             	and    $0xfffffffd,%eax
+  80290a:	3c 01                	cmp    $0x1,%al
+  80290c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802910:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802916:	75 0f                	jne    802927 <strtol+0x48>
+  802918:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80291b:	74 14                	je     802931 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80291d:	85 d2                	test   %edx,%edx
+  80291f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802924:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802927:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80292c:	4c 63 ca             	movslq %edx,%r9
+  80292f:	eb 36                	jmp    802967 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802931:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802935:	74 0f                	je     802946 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802937:	85 d2                	test   %edx,%edx
+  802939:	75 ec                	jne    802927 <strtol+0x48>
+        s++;
+  80293b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80293f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802944:	eb e1                	jmp    802927 <strtol+0x48>
+        s += 2;
+  802946:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80294a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80294f:	eb d6                	jmp    802927 <strtol+0x48>
+            dig -= '0';
+  802951:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802954:	44 0f b6 c1          	movzbl %cl,%r8d
+  802958:	41 39 d0             	cmp    %edx,%r8d
+  80295b:	7d 21                	jge    80297e <strtol+0x9f>
+        val = val * base + dig;
+  80295d:	49 0f af c1          	imul   %r9,%rax
+  802961:	0f b6 c9             	movzbl %cl,%ecx
+  802964:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802967:	48 83 c7 01          	add    $0x1,%rdi
+  80296b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80296f:	80 f9 39             	cmp    $0x39,%cl
+  802972:	76 dd                	jbe    802951 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802974:	80 f9 7b             	cmp    $0x7b,%cl
+  802977:	77 05                	ja     80297e <strtol+0x9f>
+            dig -= 'a' - 10;
+  802979:	83 e9 57             	sub    $0x57,%ecx
+  80297c:	eb d6                	jmp    802954 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80297e:	4d 85 d2             	test   %r10,%r10
+  802981:	74 03                	je     802986 <strtol+0xa7>
+  802983:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802986:	48 89 c2             	mov    %rax,%rdx
+  802989:	48 f7 da             	neg    %rdx
+  80298c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802990:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802994:	c3                   	ret
+
+0000000000802995 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802995:	55                   	push   %rbp
+  802996:	48 89 e5             	mov    %rsp,%rbp
+  802999:	41 54                	push   %r12
+  80299b:	53                   	push   %rbx
+  80299c:	48 89 fb             	mov    %rdi,%rbx
+  80299f:	48 89 f7             	mov    %rsi,%rdi
+  8029a2:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8029a5:	48 85 f6             	test   %rsi,%rsi
+  8029a8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029af:	00 00 00 
+  8029b2:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8029b6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029bb:	48 b8 ee 05 80 00 00 	movabs $0x8005ee,%rax
+  8029c2:	00 00 00 
+  8029c5:	ff d0                	call   *%rax
+    if (res < 0) {
+  8029c7:	85 c0                	test   %eax,%eax
+  8029c9:	78 45                	js     802a10 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8029cb:	48 85 db             	test   %rbx,%rbx
+  8029ce:	74 12                	je     8029e2 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8029d0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029d7:	00 00 00 
+  8029da:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8029e0:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  8029e2:	4d 85 e4             	test   %r12,%r12
+  8029e5:	74 14                	je     8029fb <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  8029e7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029ee:	00 00 00 
+  8029f1:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8029f7:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  8029fb:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a02:	00 00 00 
+  802a05:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802a0b:	5b                   	pop    %rbx
+  802a0c:	41 5c                	pop    %r12
+  802a0e:	5d                   	pop    %rbp
+  802a0f:	c3                   	ret
+        if (from_env_store)
+  802a10:	48 85 db             	test   %rbx,%rbx
+  802a13:	74 06                	je     802a1b <ipc_recv+0x86>
+            *from_env_store = 0;
+  802a15:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802a1b:	4d 85 e4             	test   %r12,%r12
+  802a1e:	74 eb                	je     802a0b <ipc_recv+0x76>
+            *perm_store = 0;
+  802a20:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802a27:	00 
+  802a28:	eb e1                	jmp    802a0b <ipc_recv+0x76>
+
+0000000000802a2a <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802a2a:	55                   	push   %rbp
+  802a2b:	48 89 e5             	mov    %rsp,%rbp
+  802a2e:	41 57                	push   %r15
+  802a30:	41 56                	push   %r14
+  802a32:	41 55                	push   %r13
+  802a34:	41 54                	push   %r12
+  802a36:	53                   	push   %rbx
+  802a37:	48 83 ec 18          	sub    $0x18,%rsp
+  802a3b:	41 89 fd             	mov    %edi,%r13d
+  802a3e:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802a41:	48 89 d3             	mov    %rdx,%rbx
+  802a44:	49 89 cc             	mov    %rcx,%r12
+  802a47:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a4b:	48 85 d2             	test   %rdx,%rdx
+  802a4e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a55:	00 00 00 
+  802a58:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a5c:	49 be c2 05 80 00 00 	movabs $0x8005c2,%r14
+  802a63:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802a66:	49 bf f5 01 80 00 00 	movabs $0x8001f5,%r15
+  802a6d:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a70:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802a73:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802a77:	4c 89 e1             	mov    %r12,%rcx
+  802a7a:	48 89 da             	mov    %rbx,%rdx
+  802a7d:	44 89 ef             	mov    %r13d,%edi
+  802a80:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802a83:	85 c0                	test   %eax,%eax
+  802a85:	74 34                	je     802abb <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802a87:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802a8a:	75 05                	jne    802a91 <ipc_send+0x67>
+        sys_yield();
+  802a8c:	41 ff d7             	call   *%r15
+    while (true) {
+  802a8f:	eb df                	jmp    802a70 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802a91:	48 ba cf 31 80 00 00 	movabs $0x8031cf,%rdx
+  802a98:	00 00 00 
+  802a9b:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802aa0:	48 bf e8 31 80 00 00 	movabs $0x8031e8,%rdi
+  802aa7:	00 00 00 
+  802aaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aaf:	48 b9 f9 1a 80 00 00 	movabs $0x801af9,%rcx
+  802ab6:	00 00 00 
+  802ab9:	ff d1                	call   *%rcx
+    }
+}
+  802abb:	48 83 c4 18          	add    $0x18,%rsp
+  802abf:	5b                   	pop    %rbx
+  802ac0:	41 5c                	pop    %r12
+  802ac2:	41 5d                	pop    %r13
+  802ac4:	41 5e                	pop    %r14
+  802ac6:	41 5f                	pop    %r15
+  802ac8:	5d                   	pop    %rbp
+  802ac9:	c3                   	ret
+
+0000000000802aca <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802aca:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802acf:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802ad6:	00 00 00 
+  802ad9:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802ae0:	48 01 ca             	add    %rcx,%rdx
+  802ae3:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802ae9:	39 fa                	cmp    %edi,%edx
+  802aeb:	74 12                	je     802aff <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802aed:	48 83 c0 01          	add    $0x1,%rax
+  802af1:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802af7:	75 e0                	jne    802ad9 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802af9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802afe:	c3                   	ret
+            return envs[i].env_id;
+  802aff:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802b06:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b0d:	00 00 00 
+  802b10:	48 01 d0             	add    %rdx,%rax
+  802b13:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b19:	c3                   	ret
+  802b1a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802b20 <__rodata_start>:
+  802b20:	3c 75                	cmp    $0x75,%al
+  802b22:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b23:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b27:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b28:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802b2c:	1f                   	(bad)
+  802b2d:	44 00 00             	add    %r8b,(%rax)
+  802b30:	73 79                	jae    802bab <__rodata_start+0x8b>
+  802b32:	73 63                	jae    802b97 <__rodata_start+0x77>
+  802b34:	61                   	(bad)
+  802b35:	6c                   	insb   (%dx),%es:(%rdi)
+  802b36:	6c                   	insb   (%dx),%es:(%rdi)
+  802b37:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a08fb7 <__bss_end+0x72200fb7>
+  802b3d:	65 74 75             	gs je  802bb5 <__rodata_start+0x95>
+  802b40:	72 6e                	jb     802bb0 <__rodata_start+0x90>
+  802b42:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a08fc4 <__bss_end+0x28200fc4>
+  802b49:	28 
+  802b4a:	3e 20 30             	ds and %dh,(%rax)
+  802b4d:	29 00                	sub    %eax,(%rax)
+  802b4f:	6c                   	insb   (%dx),%es:(%rdi)
+  802b50:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802b57:	61                   	(bad)
+  802b58:	6c                   	insb   (%dx),%es:(%rdi)
+  802b59:	6c                   	insb   (%dx),%es:(%rdi)
+  802b5a:	2e 63 00             	cs movsxd (%rax),%eax
+  802b5d:	0f 1f 00             	nopl   (%rax)
+  802b60:	5b                   	pop    %rbx
+  802b61:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b66:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802b69:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b6d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b6e:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802b72:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802b79:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 8035e4 <error_string+0x4e4>
+  802b80:	5b                   	pop    %rbx
+  802b81:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b86:	20 66 74             	and    %ah,0x74(%rsi)
+  802b89:	72 75                	jb     802c00 <devtab+0x20>
+  802b8b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b8c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802b8f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4bfa <__bss_end+0x2d2ccbfa>
+  802b96:	20 62 61             	and    %ah,0x61(%rdx)
+  802b99:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802b9d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802ba1:	5b                   	pop    %rbx
+  802ba2:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802ba7:	20 72 65             	and    %dh,0x65(%rdx)
+  802baa:	61                   	(bad)
+  802bab:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4c16 <__bss_end+0x2d2ccc16>
+  802bb2:	20 62 61             	and    %ah,0x61(%rdx)
+  802bb5:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802bb9:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bbd:	5b                   	pop    %rbx
+  802bbe:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802bc3:	20 77 72             	and    %dh,0x72(%rdi)
+  802bc6:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802bcd:	2d 
+  802bce:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802bd3:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802bd6:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bda:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802be0 <devtab>:
+  802be0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802bf0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802c00:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802c10:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802c20:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802c30:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802c40:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802c50:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802c60:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802c70:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802c80:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802c90:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802ca0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802cb0:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802cc0:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802cd0:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802ce0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802cf0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802d00:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802d10:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802d20:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802d30:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802d40:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802d50:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802d60:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802d70:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802d80:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802d90:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802da0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802db0:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802dc0:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802dd0:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802de0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802df0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802e00:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802e10:	64 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     d.operation not 
+  802e20:	70 65 72 6d 69 74 74 65 64 00 66 2e 0f 1f 84 00     permitted.f.....
+  802e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
+  802e40:	36 1e 80 00 00 00 00 00 77 24 80 00 00 00 00 00     6.......w$......
+  802e50:	67 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     g$......w$......
+  802e60:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  802e70:	77 24 80 00 00 00 00 00 55 1e 80 00 00 00 00 00     w$......U.......
+  802e80:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  802e90:	49 1e 80 00 00 00 00 00 c3 1e 80 00 00 00 00 00     I...............
+  802ea0:	77 24 80 00 00 00 00 00 49 1e 80 00 00 00 00 00     w$......I.......
+  802eb0:	8f 1e 80 00 00 00 00 00 8f 1e 80 00 00 00 00 00     ................
+  802ec0:	8f 1e 80 00 00 00 00 00 8f 1e 80 00 00 00 00 00     ................
+  802ed0:	8f 1e 80 00 00 00 00 00 8f 1e 80 00 00 00 00 00     ................
+  802ee0:	8f 1e 80 00 00 00 00 00 8f 1e 80 00 00 00 00 00     ................
+  802ef0:	8f 1e 80 00 00 00 00 00 77 24 80 00 00 00 00 00     ........w$......
+  802f00:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  802f10:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  802f20:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  802f30:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  802f40:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  802f50:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  802f60:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  802f70:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  802f80:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  802f90:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  802fa0:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  802fb0:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  802fc0:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  802fd0:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  802fe0:	77 24 80 00 00 00 00 00 9a 23 80 00 00 00 00 00     w$.......#......
+  802ff0:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  803000:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  803010:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  803020:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  803030:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  803040:	e6 1e 80 00 00 00 00 00 b5 20 80 00 00 00 00 00     ......... ......
+  803050:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  803060:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  803070:	15 1f 80 00 00 00 00 00 77 24 80 00 00 00 00 00     ........w$......
+  803080:	77 24 80 00 00 00 00 00 db 1e 80 00 00 00 00 00     w$..............
+  803090:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  8030a0:	5d 22 80 00 00 00 00 00 27 23 80 00 00 00 00 00     ]"......'#......
+  8030b0:	77 24 80 00 00 00 00 00 77 24 80 00 00 00 00 00     w$......w$......
+  8030c0:	ac 1f 80 00 00 00 00 00 77 24 80 00 00 00 00 00     ........w$......
+  8030d0:	89 21 80 00 00 00 00 00 77 24 80 00 00 00 00 00     .!......w$......
+  8030e0:	77 24 80 00 00 00 00 00 9a 23 80 00 00 00 00 00     w$.......#......
+  8030f0:	77 24 80 00 00 00 00 00 3f 1e 80 00 00 00 00 00     w$......?.......
+
+0000000000803100 <error_string>:
+	...
+  803108:	b5 2c 80 00 00 00 00 00 c7 2c 80 00 00 00 00 00     .,.......,......
+  803118:	d7 2c 80 00 00 00 00 00 e9 2c 80 00 00 00 00 00     .,.......,......
+  803128:	f7 2c 80 00 00 00 00 00 0b 2d 80 00 00 00 00 00     .,.......-......
+  803138:	20 2d 80 00 00 00 00 00 33 2d 80 00 00 00 00 00      -......3-......
+  803148:	45 2d 80 00 00 00 00 00 59 2d 80 00 00 00 00 00     E-......Y-......
+  803158:	69 2d 80 00 00 00 00 00 7c 2d 80 00 00 00 00 00     i-......|-......
+  803168:	93 2d 80 00 00 00 00 00 a9 2d 80 00 00 00 00 00     .-.......-......
+  803178:	c1 2d 80 00 00 00 00 00 d9 2d 80 00 00 00 00 00     .-.......-......
+  803188:	e6 2d 80 00 00 00 00 00 b0 31 80 00 00 00 00 00     .-.......1......
+  803198:	fa 2d 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .-..............
+  8031a8:	12 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ........file is 
+  8031b8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8031c8:	75 74 61 62 6c 65 00 69 70 63 5f 73 65 6e 64 3a     utable.ipc_send:
+  8031d8:	20 66 61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00      failed to send.
+  8031e8:	6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00     lib/ipc.c.f.....
+  8031f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803208:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803218:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803228:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803238:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803248:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803258:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803268:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803278:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803288:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803298:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8032e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803308:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803318:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803328:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803338:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803348:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803358:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803368:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803378:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803388:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803398:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803408:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803418:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803428:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803438:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803448:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803458:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803468:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803478:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803488:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803498:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803508:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803518:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803528:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803538:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803548:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803558:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803568:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803578:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803588:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803598:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803608:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803618:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803628:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803638:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803648:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803658:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803668:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803678:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803688:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803698:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803708:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803718:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803728:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803738:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803748:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803758:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803768:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803778:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803788:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803798:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803808:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803818:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803828:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803838:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803848:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803858:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803868:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803878:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803888:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803898:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803908:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803918:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803928:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803938:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803948:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803958:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803968:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803978:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803988:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803998:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803aa8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ab8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ac8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ad8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ae8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803af8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ba8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bb8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bc8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bd8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803be8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bf8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ca8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cb8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cc8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cd8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ce8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cf8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803da8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803db8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dc8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dd8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803de8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803df8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ea8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803eb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ec8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ed8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ee8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ef8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fa8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fe8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ff8:	0f 1f 84 00 00 00 00 00                             ........
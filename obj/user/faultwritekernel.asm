@@ -0,0 +1,5381 @@
+
+obj/user/faultwritekernel:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 13 00 00 00       	call   800036 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    *(volatile unsigned *)0x8040000000 = 0;
+  800025:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  80002c:	00 00 00 
+  80002f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  800035:	c3                   	ret
+
+0000000000800036 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800036:	55                   	push   %rbp
+  800037:	48 89 e5             	mov    %rsp,%rbp
+  80003a:	41 56                	push   %r14
+  80003c:	41 55                	push   %r13
+  80003e:	41 54                	push   %r12
+  800040:	53                   	push   %rbx
+  800041:	41 89 fd             	mov    %edi,%r13d
+  800044:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800047:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80004e:	00 00 00 
+  800051:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800058:	00 00 00 
+  80005b:	48 39 c2             	cmp    %rax,%rdx
+  80005e:	73 17                	jae    800077 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800060:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800063:	49 89 c4             	mov    %rax,%r12
+  800066:	48 83 c3 08          	add    $0x8,%rbx
+  80006a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006f:	ff 53 f8             	call   *-0x8(%rbx)
+  800072:	4c 39 e3             	cmp    %r12,%rbx
+  800075:	72 ef                	jb     800066 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800077:	48 b8 c9 01 80 00 00 	movabs $0x8001c9,%rax
+  80007e:	00 00 00 
+  800081:	ff d0                	call   *%rax
+  800083:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800086:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80008d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800094:	00 00 00 
+  800097:	48 01 d0             	add    %rdx,%rax
+  80009a:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000a1:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000a4:	45 85 ed             	test   %r13d,%r13d
+  8000a7:	7e 0d                	jle    8000b6 <libmain+0x80>
+  8000a9:	49 8b 06             	mov    (%r14),%rax
+  8000ac:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000b3:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000b6:	4c 89 f6             	mov    %r14,%rsi
+  8000b9:	44 89 ef             	mov    %r13d,%edi
+  8000bc:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000c3:	00 00 00 
+  8000c6:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000c8:	48 b8 dd 00 80 00 00 	movabs $0x8000dd,%rax
+  8000cf:	00 00 00 
+  8000d2:	ff d0                	call   *%rax
+#endif
+}
+  8000d4:	5b                   	pop    %rbx
+  8000d5:	41 5c                	pop    %r12
+  8000d7:	41 5d                	pop    %r13
+  8000d9:	41 5e                	pop    %r14
+  8000db:	5d                   	pop    %rbp
+  8000dc:	c3                   	ret
+
+00000000008000dd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000dd:	55                   	push   %rbp
+  8000de:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000e1:	48 b8 51 0a 80 00 00 	movabs $0x800a51,%rax
+  8000e8:	00 00 00 
+  8000eb:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000f2:	48 b8 5e 01 80 00 00 	movabs $0x80015e,%rax
+  8000f9:	00 00 00 
+  8000fc:	ff d0                	call   *%rax
+}
+  8000fe:	5d                   	pop    %rbp
+  8000ff:	c3                   	ret
+
+0000000000800100 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800100:	55                   	push   %rbp
+  800101:	48 89 e5             	mov    %rsp,%rbp
+  800104:	53                   	push   %rbx
+  800105:	48 89 fa             	mov    %rdi,%rdx
+  800108:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80010b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800110:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800115:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80011a:	be 00 00 00 00       	mov    $0x0,%esi
+  80011f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800125:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800127:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80012b:	c9                   	leave
+  80012c:	c3                   	ret
+
+000000000080012d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80012d:	55                   	push   %rbp
+  80012e:	48 89 e5             	mov    %rsp,%rbp
+  800131:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800132:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800137:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800141:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800146:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80014b:	be 00 00 00 00       	mov    $0x0,%esi
+  800150:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800156:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800158:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80015c:	c9                   	leave
+  80015d:	c3                   	ret
+
+000000000080015e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80015e:	55                   	push   %rbp
+  80015f:	48 89 e5             	mov    %rsp,%rbp
+  800162:	53                   	push   %rbx
+  800163:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800167:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80016a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80016f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800174:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800179:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80017e:	be 00 00 00 00       	mov    $0x0,%esi
+  800183:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800189:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80018b:	48 85 c0             	test   %rax,%rax
+  80018e:	7f 06                	jg     800196 <sys_env_destroy+0x38>
+}
+  800190:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800194:	c9                   	leave
+  800195:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800196:	49 89 c0             	mov    %rax,%r8
+  800199:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80019e:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  8001a5:	00 00 00 
+  8001a8:	be 26 00 00 00       	mov    $0x26,%esi
+  8001ad:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  8001b4:	00 00 00 
+  8001b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bc:	49 b9 fe 1a 80 00 00 	movabs $0x801afe,%r9
+  8001c3:	00 00 00 
+  8001c6:	41 ff d1             	call   *%r9
+
+00000000008001c9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001c9:	55                   	push   %rbp
+  8001ca:	48 89 e5             	mov    %rsp,%rbp
+  8001cd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001ce:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001f2:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f8:	c9                   	leave
+  8001f9:	c3                   	ret
+
+00000000008001fa <sys_yield>:
+
+void
+sys_yield(void) {
+  8001fa:	55                   	push   %rbp
+  8001fb:	48 89 e5             	mov    %rsp,%rbp
+  8001fe:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001ff:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800204:	ba 00 00 00 00       	mov    $0x0,%edx
+  800209:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80020e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800213:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800218:	be 00 00 00 00       	mov    $0x0,%esi
+  80021d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800223:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800225:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800229:	c9                   	leave
+  80022a:	c3                   	ret
+
+000000000080022b <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80022b:	55                   	push   %rbp
+  80022c:	48 89 e5             	mov    %rsp,%rbp
+  80022f:	53                   	push   %rbx
+  800230:	48 89 fa             	mov    %rdi,%rdx
+  800233:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800236:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80023b:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800242:	00 00 00 
+  800245:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80024a:	be 00 00 00 00       	mov    $0x0,%esi
+  80024f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800255:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800257:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80025b:	c9                   	leave
+  80025c:	c3                   	ret
+
+000000000080025d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80025d:	55                   	push   %rbp
+  80025e:	48 89 e5             	mov    %rsp,%rbp
+  800261:	53                   	push   %rbx
+  800262:	49 89 f8             	mov    %rdi,%r8
+  800265:	48 89 d3             	mov    %rdx,%rbx
+  800268:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80026b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800270:	4c 89 c2             	mov    %r8,%rdx
+  800273:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800276:	be 00 00 00 00       	mov    $0x0,%esi
+  80027b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800281:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800283:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800287:	c9                   	leave
+  800288:	c3                   	ret
+
+0000000000800289 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800289:	55                   	push   %rbp
+  80028a:	48 89 e5             	mov    %rsp,%rbp
+  80028d:	53                   	push   %rbx
+  80028e:	48 83 ec 08          	sub    $0x8,%rsp
+  800292:	89 f8                	mov    %edi,%eax
+  800294:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800297:	48 63 f9             	movslq %ecx,%rdi
+  80029a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80029d:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002a2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8002aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002b0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002b2:	48 85 c0             	test   %rax,%rax
+  8002b5:	7f 06                	jg     8002bd <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002bb:	c9                   	leave
+  8002bc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002bd:	49 89 c0             	mov    %rax,%r8
+  8002c0:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002c5:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  8002cc:	00 00 00 
+  8002cf:	be 26 00 00 00       	mov    $0x26,%esi
+  8002d4:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  8002db:	00 00 00 
+  8002de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e3:	49 b9 fe 1a 80 00 00 	movabs $0x801afe,%r9
+  8002ea:	00 00 00 
+  8002ed:	41 ff d1             	call   *%r9
+
+00000000008002f0 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002f0:	55                   	push   %rbp
+  8002f1:	48 89 e5             	mov    %rsp,%rbp
+  8002f4:	53                   	push   %rbx
+  8002f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8002f9:	89 f8                	mov    %edi,%eax
+  8002fb:	49 89 f2             	mov    %rsi,%r10
+  8002fe:	48 89 cf             	mov    %rcx,%rdi
+  800301:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800304:	48 63 da             	movslq %edx,%rbx
+  800307:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80030a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80030f:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800312:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800315:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800317:	48 85 c0             	test   %rax,%rax
+  80031a:	7f 06                	jg     800322 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80031c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800320:	c9                   	leave
+  800321:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800322:	49 89 c0             	mov    %rax,%r8
+  800325:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80032a:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  800331:	00 00 00 
+  800334:	be 26 00 00 00       	mov    $0x26,%esi
+  800339:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  800340:	00 00 00 
+  800343:	b8 00 00 00 00       	mov    $0x0,%eax
+  800348:	49 b9 fe 1a 80 00 00 	movabs $0x801afe,%r9
+  80034f:	00 00 00 
+  800352:	41 ff d1             	call   *%r9
+
+0000000000800355 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800355:	55                   	push   %rbp
+  800356:	48 89 e5             	mov    %rsp,%rbp
+  800359:	53                   	push   %rbx
+  80035a:	48 83 ec 08          	sub    $0x8,%rsp
+  80035e:	48 89 f1             	mov    %rsi,%rcx
+  800361:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800364:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800367:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80036c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800371:	be 00 00 00 00       	mov    $0x0,%esi
+  800376:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80037c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80037e:	48 85 c0             	test   %rax,%rax
+  800381:	7f 06                	jg     800389 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800383:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800387:	c9                   	leave
+  800388:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800389:	49 89 c0             	mov    %rax,%r8
+  80038c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800391:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  800398:	00 00 00 
+  80039b:	be 26 00 00 00       	mov    $0x26,%esi
+  8003a0:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  8003a7:	00 00 00 
+  8003aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003af:	49 b9 fe 1a 80 00 00 	movabs $0x801afe,%r9
+  8003b6:	00 00 00 
+  8003b9:	41 ff d1             	call   *%r9
+
+00000000008003bc <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8003bc:	55                   	push   %rbp
+  8003bd:	48 89 e5             	mov    %rsp,%rbp
+  8003c0:	53                   	push   %rbx
+  8003c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8003c5:	89 f8                	mov    %edi,%eax
+  8003c7:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8003ca:	48 63 f9             	movslq %ecx,%rdi
+  8003cd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003d0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003d5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8003dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003e3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003e5:	48 85 c0             	test   %rax,%rax
+  8003e8:	7f 06                	jg     8003f0 <sys_region_advise+0x34>
+}
+  8003ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003ee:	c9                   	leave
+  8003ef:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003f0:	49 89 c0             	mov    %rax,%r8
+  8003f3:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8003f8:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  8003ff:	00 00 00 
+  800402:	be 26 00 00 00       	mov    $0x26,%esi
+  800407:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  80040e:	00 00 00 
+  800411:	b8 00 00 00 00       	mov    $0x0,%eax
+  800416:	49 b9 fe 1a 80 00 00 	movabs $0x801afe,%r9
+  80041d:	00 00 00 
+  800420:	41 ff d1             	call   *%r9
+
+0000000000800423 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  800423:	55                   	push   %rbp
+  800424:	48 89 e5             	mov    %rsp,%rbp
+  800427:	53                   	push   %rbx
+  800428:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80042c:	48 63 ce             	movslq %esi,%rcx
+  80042f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800432:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800437:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80043c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800441:	be 00 00 00 00       	mov    $0x0,%esi
+  800446:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80044c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80044e:	48 85 c0             	test   %rax,%rax
+  800451:	7f 06                	jg     800459 <sys_env_set_nice+0x36>
+}
+  800453:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800457:	c9                   	leave
+  800458:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800459:	49 89 c0             	mov    %rax,%r8
+  80045c:	b9 15 00 00 00       	mov    $0x15,%ecx
+  800461:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  800468:	00 00 00 
+  80046b:	be 26 00 00 00       	mov    $0x26,%esi
+  800470:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  800477:	00 00 00 
+  80047a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047f:	49 b9 fe 1a 80 00 00 	movabs $0x801afe,%r9
+  800486:	00 00 00 
+  800489:	41 ff d1             	call   *%r9
+
+000000000080048c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80048c:	55                   	push   %rbp
+  80048d:	48 89 e5             	mov    %rsp,%rbp
+  800490:	53                   	push   %rbx
+  800491:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800495:	48 63 ce             	movslq %esi,%rcx
+  800498:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80049b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004a5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8004af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004b5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004b7:	48 85 c0             	test   %rax,%rax
+  8004ba:	7f 06                	jg     8004c2 <sys_env_set_status+0x36>
+}
+  8004bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004c0:	c9                   	leave
+  8004c1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004c2:	49 89 c0             	mov    %rax,%r8
+  8004c5:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004ca:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  8004d1:	00 00 00 
+  8004d4:	be 26 00 00 00       	mov    $0x26,%esi
+  8004d9:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  8004e0:	00 00 00 
+  8004e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e8:	49 b9 fe 1a 80 00 00 	movabs $0x801afe,%r9
+  8004ef:	00 00 00 
+  8004f2:	41 ff d1             	call   *%r9
+
+00000000008004f5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8004f5:	55                   	push   %rbp
+  8004f6:	48 89 e5             	mov    %rsp,%rbp
+  8004f9:	53                   	push   %rbx
+  8004fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8004fe:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800501:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800504:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800509:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80050e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800513:	be 00 00 00 00       	mov    $0x0,%esi
+  800518:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80051e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800520:	48 85 c0             	test   %rax,%rax
+  800523:	7f 06                	jg     80052b <sys_env_set_trapframe+0x36>
+}
+  800525:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800529:	c9                   	leave
+  80052a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80052b:	49 89 c0             	mov    %rax,%r8
+  80052e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800533:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  80053a:	00 00 00 
+  80053d:	be 26 00 00 00       	mov    $0x26,%esi
+  800542:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  800549:	00 00 00 
+  80054c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800551:	49 b9 fe 1a 80 00 00 	movabs $0x801afe,%r9
+  800558:	00 00 00 
+  80055b:	41 ff d1             	call   *%r9
+
+000000000080055e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80055e:	55                   	push   %rbp
+  80055f:	48 89 e5             	mov    %rsp,%rbp
+  800562:	53                   	push   %rbx
+  800563:	48 83 ec 08          	sub    $0x8,%rsp
+  800567:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80056a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80056d:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800572:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800577:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80057c:	be 00 00 00 00       	mov    $0x0,%esi
+  800581:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800587:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800589:	48 85 c0             	test   %rax,%rax
+  80058c:	7f 06                	jg     800594 <sys_env_set_pgfault_upcall+0x36>
+}
+  80058e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800592:	c9                   	leave
+  800593:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800594:	49 89 c0             	mov    %rax,%r8
+  800597:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80059c:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  8005a3:	00 00 00 
+  8005a6:	be 26 00 00 00       	mov    $0x26,%esi
+  8005ab:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  8005b2:	00 00 00 
+  8005b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ba:	49 b9 fe 1a 80 00 00 	movabs $0x801afe,%r9
+  8005c1:	00 00 00 
+  8005c4:	41 ff d1             	call   *%r9
+
+00000000008005c7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8005c7:	55                   	push   %rbp
+  8005c8:	48 89 e5             	mov    %rsp,%rbp
+  8005cb:	53                   	push   %rbx
+  8005cc:	89 f8                	mov    %edi,%eax
+  8005ce:	49 89 f1             	mov    %rsi,%r9
+  8005d1:	48 89 d3             	mov    %rdx,%rbx
+  8005d4:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8005d7:	49 63 f0             	movslq %r8d,%rsi
+  8005da:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005dd:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005e2:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005eb:	cd 30                	int    $0x30
+}
+  8005ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005f1:	c9                   	leave
+  8005f2:	c3                   	ret
+
+00000000008005f3 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8005f3:	55                   	push   %rbp
+  8005f4:	48 89 e5             	mov    %rsp,%rbp
+  8005f7:	53                   	push   %rbx
+  8005f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8005fc:	48 89 fa             	mov    %rdi,%rdx
+  8005ff:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800602:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800607:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80060c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800611:	be 00 00 00 00       	mov    $0x0,%esi
+  800616:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80061c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80061e:	48 85 c0             	test   %rax,%rax
+  800621:	7f 06                	jg     800629 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800623:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800627:	c9                   	leave
+  800628:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800629:	49 89 c0             	mov    %rax,%r8
+  80062c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800631:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  800638:	00 00 00 
+  80063b:	be 26 00 00 00       	mov    $0x26,%esi
+  800640:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  800647:	00 00 00 
+  80064a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80064f:	49 b9 fe 1a 80 00 00 	movabs $0x801afe,%r9
+  800656:	00 00 00 
+  800659:	41 ff d1             	call   *%r9
+
+000000000080065c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80065c:	55                   	push   %rbp
+  80065d:	48 89 e5             	mov    %rsp,%rbp
+  800660:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800661:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800666:	ba 00 00 00 00       	mov    $0x0,%edx
+  80066b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800670:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800675:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80067a:	be 00 00 00 00       	mov    $0x0,%esi
+  80067f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800685:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800687:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80068b:	c9                   	leave
+  80068c:	c3                   	ret
+
+000000000080068d <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80068d:	55                   	push   %rbp
+  80068e:	48 89 e5             	mov    %rsp,%rbp
+  800691:	53                   	push   %rbx
+  800692:	48 83 ec 08          	sub    $0x8,%rsp
+  800696:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  800699:	48 63 ce             	movslq %esi,%rcx
+  80069c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80069f:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006a4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8006ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006b4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8006b6:	48 85 c0             	test   %rax,%rax
+  8006b9:	7f 06                	jg     8006c1 <sys_sigqueue+0x34>
+}
+  8006bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006bf:	c9                   	leave
+  8006c0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006c1:	49 89 c0             	mov    %rax,%r8
+  8006c4:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8006c9:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  8006d0:	00 00 00 
+  8006d3:	be 26 00 00 00       	mov    $0x26,%esi
+  8006d8:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  8006df:	00 00 00 
+  8006e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e7:	49 b9 fe 1a 80 00 00 	movabs $0x801afe,%r9
+  8006ee:	00 00 00 
+  8006f1:	41 ff d1             	call   *%r9
+
+00000000008006f4 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8006f4:	55                   	push   %rbp
+  8006f5:	48 89 e5             	mov    %rsp,%rbp
+  8006f8:	53                   	push   %rbx
+  8006f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8006fd:	48 89 fa             	mov    %rdi,%rdx
+  800700:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800703:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800708:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80070d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800712:	be 00 00 00 00       	mov    $0x0,%esi
+  800717:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80071d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80071f:	48 85 c0             	test   %rax,%rax
+  800722:	7f 06                	jg     80072a <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  800724:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800728:	c9                   	leave
+  800729:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80072a:	49 89 c0             	mov    %rax,%r8
+  80072d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800732:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  800739:	00 00 00 
+  80073c:	be 26 00 00 00       	mov    $0x26,%esi
+  800741:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  800748:	00 00 00 
+  80074b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800750:	49 b9 fe 1a 80 00 00 	movabs $0x801afe,%r9
+  800757:	00 00 00 
+  80075a:	41 ff d1             	call   *%r9
+
+000000000080075d <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80075d:	55                   	push   %rbp
+  80075e:	48 89 e5             	mov    %rsp,%rbp
+  800761:	53                   	push   %rbx
+  800762:	48 83 ec 08          	sub    $0x8,%rsp
+  800766:	48 89 f1             	mov    %rsi,%rcx
+  800769:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80076c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80076f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800774:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800779:	be 00 00 00 00       	mov    $0x0,%esi
+  80077e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800784:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800786:	48 85 c0             	test   %rax,%rax
+  800789:	7f 06                	jg     800791 <sys_sigaction+0x34>
+}
+  80078b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80078f:	c9                   	leave
+  800790:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800791:	49 89 c0             	mov    %rax,%r8
+  800794:	b9 12 00 00 00       	mov    $0x12,%ecx
+  800799:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  8007a0:	00 00 00 
+  8007a3:	be 26 00 00 00       	mov    $0x26,%esi
+  8007a8:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  8007af:	00 00 00 
+  8007b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b7:	49 b9 fe 1a 80 00 00 	movabs $0x801afe,%r9
+  8007be:	00 00 00 
+  8007c1:	41 ff d1             	call   *%r9
+
+00000000008007c4 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8007c4:	55                   	push   %rbp
+  8007c5:	48 89 e5             	mov    %rsp,%rbp
+  8007c8:	53                   	push   %rbx
+  8007c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8007cd:	48 89 f1             	mov    %rsi,%rcx
+  8007d0:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8007d3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8007d6:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8007db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8007e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8007eb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8007ed:	48 85 c0             	test   %rax,%rax
+  8007f0:	7f 06                	jg     8007f8 <sys_sigprocmask+0x34>
+}
+  8007f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007f6:	c9                   	leave
+  8007f7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007f8:	49 89 c0             	mov    %rax,%r8
+  8007fb:	b9 13 00 00 00       	mov    $0x13,%ecx
+  800800:	48 ba 30 2b 80 00 00 	movabs $0x802b30,%rdx
+  800807:	00 00 00 
+  80080a:	be 26 00 00 00       	mov    $0x26,%esi
+  80080f:	48 bf 4f 2b 80 00 00 	movabs $0x802b4f,%rdi
+  800816:	00 00 00 
+  800819:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081e:	49 b9 fe 1a 80 00 00 	movabs $0x801afe,%r9
+  800825:	00 00 00 
+  800828:	41 ff d1             	call   *%r9
+
+000000000080082b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80082b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800832:	ff ff ff 
+  800835:	48 01 f8             	add    %rdi,%rax
+  800838:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80083c:	c3                   	ret
+
+000000000080083d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80083d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800844:	ff ff ff 
+  800847:	48 01 f8             	add    %rdi,%rax
+  80084a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80084e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800854:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800858:	c3                   	ret
+
+0000000000800859 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800859:	55                   	push   %rbp
+  80085a:	48 89 e5             	mov    %rsp,%rbp
+  80085d:	41 57                	push   %r15
+  80085f:	41 56                	push   %r14
+  800861:	41 55                	push   %r13
+  800863:	41 54                	push   %r12
+  800865:	53                   	push   %rbx
+  800866:	48 83 ec 08          	sub    $0x8,%rsp
+  80086a:	49 89 ff             	mov    %rdi,%r15
+  80086d:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800872:	49 bd d7 17 80 00 00 	movabs $0x8017d7,%r13
+  800879:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80087c:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800882:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800885:	48 89 df             	mov    %rbx,%rdi
+  800888:	41 ff d5             	call   *%r13
+  80088b:	83 e0 04             	and    $0x4,%eax
+  80088e:	74 17                	je     8008a7 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800890:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800897:	4c 39 f3             	cmp    %r14,%rbx
+  80089a:	75 e6                	jne    800882 <fd_alloc+0x29>
+  80089c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8008a2:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8008a7:	4d 89 27             	mov    %r12,(%r15)
+}
+  8008aa:	48 83 c4 08          	add    $0x8,%rsp
+  8008ae:	5b                   	pop    %rbx
+  8008af:	41 5c                	pop    %r12
+  8008b1:	41 5d                	pop    %r13
+  8008b3:	41 5e                	pop    %r14
+  8008b5:	41 5f                	pop    %r15
+  8008b7:	5d                   	pop    %rbp
+  8008b8:	c3                   	ret
+
+00000000008008b9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8008b9:	83 ff 1f             	cmp    $0x1f,%edi
+  8008bc:	77 39                	ja     8008f7 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8008be:	55                   	push   %rbp
+  8008bf:	48 89 e5             	mov    %rsp,%rbp
+  8008c2:	41 54                	push   %r12
+  8008c4:	53                   	push   %rbx
+  8008c5:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8008c8:	48 63 df             	movslq %edi,%rbx
+  8008cb:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8008d2:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8008d6:	48 89 df             	mov    %rbx,%rdi
+  8008d9:	48 b8 d7 17 80 00 00 	movabs $0x8017d7,%rax
+  8008e0:	00 00 00 
+  8008e3:	ff d0                	call   *%rax
+  8008e5:	a8 04                	test   $0x4,%al
+  8008e7:	74 14                	je     8008fd <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8008e9:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8008ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008f2:	5b                   	pop    %rbx
+  8008f3:	41 5c                	pop    %r12
+  8008f5:	5d                   	pop    %rbp
+  8008f6:	c3                   	ret
+        return -E_INVAL;
+  8008f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8008fc:	c3                   	ret
+        return -E_INVAL;
+  8008fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800902:	eb ee                	jmp    8008f2 <fd_lookup+0x39>
+
+0000000000800904 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800904:	55                   	push   %rbp
+  800905:	48 89 e5             	mov    %rsp,%rbp
+  800908:	41 54                	push   %r12
+  80090a:	53                   	push   %rbx
+  80090b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80090e:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  800915:	00 00 00 
+  800918:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80091f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800922:	39 3b                	cmp    %edi,(%rbx)
+  800924:	74 47                	je     80096d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800926:	48 83 c0 08          	add    $0x8,%rax
+  80092a:	48 8b 18             	mov    (%rax),%rbx
+  80092d:	48 85 db             	test   %rbx,%rbx
+  800930:	75 f0                	jne    800922 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800932:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800939:	00 00 00 
+  80093c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800942:	89 fa                	mov    %edi,%edx
+  800944:	48 bf 60 2b 80 00 00 	movabs $0x802b60,%rdi
+  80094b:	00 00 00 
+  80094e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800953:	48 b9 4e 1c 80 00 00 	movabs $0x801c4e,%rcx
+  80095a:	00 00 00 
+  80095d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80095f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800964:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800968:	5b                   	pop    %rbx
+  800969:	41 5c                	pop    %r12
+  80096b:	5d                   	pop    %rbp
+  80096c:	c3                   	ret
+            return 0;
+  80096d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800972:	eb f0                	jmp    800964 <dev_lookup+0x60>
+
+0000000000800974 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800974:	55                   	push   %rbp
+  800975:	48 89 e5             	mov    %rsp,%rbp
+  800978:	41 55                	push   %r13
+  80097a:	41 54                	push   %r12
+  80097c:	53                   	push   %rbx
+  80097d:	48 83 ec 18          	sub    $0x18,%rsp
+  800981:	48 89 fb             	mov    %rdi,%rbx
+  800984:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800987:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80098e:	ff ff ff 
+  800991:	48 01 df             	add    %rbx,%rdi
+  800994:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800998:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80099c:	48 b8 b9 08 80 00 00 	movabs $0x8008b9,%rax
+  8009a3:	00 00 00 
+  8009a6:	ff d0                	call   *%rax
+  8009a8:	41 89 c5             	mov    %eax,%r13d
+  8009ab:	85 c0                	test   %eax,%eax
+  8009ad:	78 06                	js     8009b5 <fd_close+0x41>
+  8009af:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8009b3:	74 1a                	je     8009cf <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8009b5:	45 84 e4             	test   %r12b,%r12b
+  8009b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009bd:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8009c1:	44 89 e8             	mov    %r13d,%eax
+  8009c4:	48 83 c4 18          	add    $0x18,%rsp
+  8009c8:	5b                   	pop    %rbx
+  8009c9:	41 5c                	pop    %r12
+  8009cb:	41 5d                	pop    %r13
+  8009cd:	5d                   	pop    %rbp
+  8009ce:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8009cf:	8b 3b                	mov    (%rbx),%edi
+  8009d1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8009d5:	48 b8 04 09 80 00 00 	movabs $0x800904,%rax
+  8009dc:	00 00 00 
+  8009df:	ff d0                	call   *%rax
+  8009e1:	41 89 c5             	mov    %eax,%r13d
+  8009e4:	85 c0                	test   %eax,%eax
+  8009e6:	78 1b                	js     800a03 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8009e8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8009ec:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8009f0:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8009f6:	48 85 c0             	test   %rax,%rax
+  8009f9:	74 08                	je     800a03 <fd_close+0x8f>
+  8009fb:	48 89 df             	mov    %rbx,%rdi
+  8009fe:	ff d0                	call   *%rax
+  800a00:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800a03:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a08:	48 89 de             	mov    %rbx,%rsi
+  800a0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a10:	48 b8 55 03 80 00 00 	movabs $0x800355,%rax
+  800a17:	00 00 00 
+  800a1a:	ff d0                	call   *%rax
+    return res;
+  800a1c:	eb a3                	jmp    8009c1 <fd_close+0x4d>
+
+0000000000800a1e <close>:
+
+int
+close(int fdnum) {
+  800a1e:	55                   	push   %rbp
+  800a1f:	48 89 e5             	mov    %rsp,%rbp
+  800a22:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800a26:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800a2a:	48 b8 b9 08 80 00 00 	movabs $0x8008b9,%rax
+  800a31:	00 00 00 
+  800a34:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800a36:	85 c0                	test   %eax,%eax
+  800a38:	78 15                	js     800a4f <close+0x31>
+
+    return fd_close(fd, 1);
+  800a3a:	be 01 00 00 00       	mov    $0x1,%esi
+  800a3f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800a43:	48 b8 74 09 80 00 00 	movabs $0x800974,%rax
+  800a4a:	00 00 00 
+  800a4d:	ff d0                	call   *%rax
+}
+  800a4f:	c9                   	leave
+  800a50:	c3                   	ret
+
+0000000000800a51 <close_all>:
+
+void
+close_all(void) {
+  800a51:	55                   	push   %rbp
+  800a52:	48 89 e5             	mov    %rsp,%rbp
+  800a55:	41 54                	push   %r12
+  800a57:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800a58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a5d:	49 bc 1e 0a 80 00 00 	movabs $0x800a1e,%r12
+  800a64:	00 00 00 
+  800a67:	89 df                	mov    %ebx,%edi
+  800a69:	41 ff d4             	call   *%r12
+  800a6c:	83 c3 01             	add    $0x1,%ebx
+  800a6f:	83 fb 20             	cmp    $0x20,%ebx
+  800a72:	75 f3                	jne    800a67 <close_all+0x16>
+}
+  800a74:	5b                   	pop    %rbx
+  800a75:	41 5c                	pop    %r12
+  800a77:	5d                   	pop    %rbp
+  800a78:	c3                   	ret
+
+0000000000800a79 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800a79:	55                   	push   %rbp
+  800a7a:	48 89 e5             	mov    %rsp,%rbp
+  800a7d:	41 57                	push   %r15
+  800a7f:	41 56                	push   %r14
+  800a81:	41 55                	push   %r13
+  800a83:	41 54                	push   %r12
+  800a85:	53                   	push   %rbx
+  800a86:	48 83 ec 18          	sub    $0x18,%rsp
+  800a8a:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800a8d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800a91:	48 b8 b9 08 80 00 00 	movabs $0x8008b9,%rax
+  800a98:	00 00 00 
+  800a9b:	ff d0                	call   *%rax
+  800a9d:	89 c3                	mov    %eax,%ebx
+  800a9f:	85 c0                	test   %eax,%eax
+  800aa1:	0f 88 b8 00 00 00    	js     800b5f <dup+0xe6>
+    close(newfdnum);
+  800aa7:	44 89 e7             	mov    %r12d,%edi
+  800aaa:	48 b8 1e 0a 80 00 00 	movabs $0x800a1e,%rax
+  800ab1:	00 00 00 
+  800ab4:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800ab6:	4d 63 ec             	movslq %r12d,%r13
+  800ab9:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800ac0:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800ac4:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800ac8:	4c 89 ff             	mov    %r15,%rdi
+  800acb:	49 be 3d 08 80 00 00 	movabs $0x80083d,%r14
+  800ad2:	00 00 00 
+  800ad5:	41 ff d6             	call   *%r14
+  800ad8:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800adb:	4c 89 ef             	mov    %r13,%rdi
+  800ade:	41 ff d6             	call   *%r14
+  800ae1:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800ae4:	48 89 df             	mov    %rbx,%rdi
+  800ae7:	48 b8 d7 17 80 00 00 	movabs $0x8017d7,%rax
+  800aee:	00 00 00 
+  800af1:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800af3:	a8 04                	test   $0x4,%al
+  800af5:	74 2b                	je     800b22 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800af7:	41 89 c1             	mov    %eax,%r9d
+  800afa:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800b00:	4c 89 f1             	mov    %r14,%rcx
+  800b03:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b08:	48 89 de             	mov    %rbx,%rsi
+  800b0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b10:	48 b8 f0 02 80 00 00 	movabs $0x8002f0,%rax
+  800b17:	00 00 00 
+  800b1a:	ff d0                	call   *%rax
+  800b1c:	89 c3                	mov    %eax,%ebx
+  800b1e:	85 c0                	test   %eax,%eax
+  800b20:	78 4e                	js     800b70 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800b22:	4c 89 ff             	mov    %r15,%rdi
+  800b25:	48 b8 d7 17 80 00 00 	movabs $0x8017d7,%rax
+  800b2c:	00 00 00 
+  800b2f:	ff d0                	call   *%rax
+  800b31:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800b34:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800b3a:	4c 89 e9             	mov    %r13,%rcx
+  800b3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b42:	4c 89 fe             	mov    %r15,%rsi
+  800b45:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b4a:	48 b8 f0 02 80 00 00 	movabs $0x8002f0,%rax
+  800b51:	00 00 00 
+  800b54:	ff d0                	call   *%rax
+  800b56:	89 c3                	mov    %eax,%ebx
+  800b58:	85 c0                	test   %eax,%eax
+  800b5a:	78 14                	js     800b70 <dup+0xf7>
+
+    return newfdnum;
+  800b5c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800b5f:	89 d8                	mov    %ebx,%eax
+  800b61:	48 83 c4 18          	add    $0x18,%rsp
+  800b65:	5b                   	pop    %rbx
+  800b66:	41 5c                	pop    %r12
+  800b68:	41 5d                	pop    %r13
+  800b6a:	41 5e                	pop    %r14
+  800b6c:	41 5f                	pop    %r15
+  800b6e:	5d                   	pop    %rbp
+  800b6f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800b70:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b75:	4c 89 ee             	mov    %r13,%rsi
+  800b78:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b7d:	49 bc 55 03 80 00 00 	movabs $0x800355,%r12
+  800b84:	00 00 00 
+  800b87:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800b8a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b8f:	4c 89 f6             	mov    %r14,%rsi
+  800b92:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b97:	41 ff d4             	call   *%r12
+    return res;
+  800b9a:	eb c3                	jmp    800b5f <dup+0xe6>
+
+0000000000800b9c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800b9c:	55                   	push   %rbp
+  800b9d:	48 89 e5             	mov    %rsp,%rbp
+  800ba0:	41 56                	push   %r14
+  800ba2:	41 55                	push   %r13
+  800ba4:	41 54                	push   %r12
+  800ba6:	53                   	push   %rbx
+  800ba7:	48 83 ec 10          	sub    $0x10,%rsp
+  800bab:	89 fb                	mov    %edi,%ebx
+  800bad:	49 89 f4             	mov    %rsi,%r12
+  800bb0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bb3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bb7:	48 b8 b9 08 80 00 00 	movabs $0x8008b9,%rax
+  800bbe:	00 00 00 
+  800bc1:	ff d0                	call   *%rax
+  800bc3:	85 c0                	test   %eax,%eax
+  800bc5:	78 4c                	js     800c13 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bc7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bcb:	41 8b 3e             	mov    (%r14),%edi
+  800bce:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bd2:	48 b8 04 09 80 00 00 	movabs $0x800904,%rax
+  800bd9:	00 00 00 
+  800bdc:	ff d0                	call   *%rax
+  800bde:	85 c0                	test   %eax,%eax
+  800be0:	78 35                	js     800c17 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800be2:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800be6:	83 e0 03             	and    $0x3,%eax
+  800be9:	83 f8 01             	cmp    $0x1,%eax
+  800bec:	74 2d                	je     800c1b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800bee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bf2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800bf6:	48 85 c0             	test   %rax,%rax
+  800bf9:	74 56                	je     800c51 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800bfb:	4c 89 ea             	mov    %r13,%rdx
+  800bfe:	4c 89 e6             	mov    %r12,%rsi
+  800c01:	4c 89 f7             	mov    %r14,%rdi
+  800c04:	ff d0                	call   *%rax
+}
+  800c06:	48 83 c4 10          	add    $0x10,%rsp
+  800c0a:	5b                   	pop    %rbx
+  800c0b:	41 5c                	pop    %r12
+  800c0d:	41 5d                	pop    %r13
+  800c0f:	41 5e                	pop    %r14
+  800c11:	5d                   	pop    %rbp
+  800c12:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c13:	48 98                	cltq
+  800c15:	eb ef                	jmp    800c06 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c17:	48 98                	cltq
+  800c19:	eb eb                	jmp    800c06 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c1b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c22:	00 00 00 
+  800c25:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c2b:	89 da                	mov    %ebx,%edx
+  800c2d:	48 bf a1 2b 80 00 00 	movabs $0x802ba1,%rdi
+  800c34:	00 00 00 
+  800c37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3c:	48 b9 4e 1c 80 00 00 	movabs $0x801c4e,%rcx
+  800c43:	00 00 00 
+  800c46:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c48:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c4f:	eb b5                	jmp    800c06 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800c51:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c58:	eb ac                	jmp    800c06 <read+0x6a>
+
+0000000000800c5a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800c5a:	55                   	push   %rbp
+  800c5b:	48 89 e5             	mov    %rsp,%rbp
+  800c5e:	41 57                	push   %r15
+  800c60:	41 56                	push   %r14
+  800c62:	41 55                	push   %r13
+  800c64:	41 54                	push   %r12
+  800c66:	53                   	push   %rbx
+  800c67:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800c6b:	48 85 d2             	test   %rdx,%rdx
+  800c6e:	74 54                	je     800cc4 <readn+0x6a>
+  800c70:	41 89 fd             	mov    %edi,%r13d
+  800c73:	49 89 f6             	mov    %rsi,%r14
+  800c76:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800c79:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800c7e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800c83:	49 bf 9c 0b 80 00 00 	movabs $0x800b9c,%r15
+  800c8a:	00 00 00 
+  800c8d:	4c 89 e2             	mov    %r12,%rdx
+  800c90:	48 29 f2             	sub    %rsi,%rdx
+  800c93:	4c 01 f6             	add    %r14,%rsi
+  800c96:	44 89 ef             	mov    %r13d,%edi
+  800c99:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800c9c:	85 c0                	test   %eax,%eax
+  800c9e:	78 20                	js     800cc0 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800ca0:	01 c3                	add    %eax,%ebx
+  800ca2:	85 c0                	test   %eax,%eax
+  800ca4:	74 08                	je     800cae <readn+0x54>
+  800ca6:	48 63 f3             	movslq %ebx,%rsi
+  800ca9:	4c 39 e6             	cmp    %r12,%rsi
+  800cac:	72 df                	jb     800c8d <readn+0x33>
+    }
+    return res;
+  800cae:	48 63 c3             	movslq %ebx,%rax
+}
+  800cb1:	48 83 c4 08          	add    $0x8,%rsp
+  800cb5:	5b                   	pop    %rbx
+  800cb6:	41 5c                	pop    %r12
+  800cb8:	41 5d                	pop    %r13
+  800cba:	41 5e                	pop    %r14
+  800cbc:	41 5f                	pop    %r15
+  800cbe:	5d                   	pop    %rbp
+  800cbf:	c3                   	ret
+        if (inc < 0) return inc;
+  800cc0:	48 98                	cltq
+  800cc2:	eb ed                	jmp    800cb1 <readn+0x57>
+    int inc = 1, res = 0;
+  800cc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc9:	eb e3                	jmp    800cae <readn+0x54>
+
+0000000000800ccb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800ccb:	55                   	push   %rbp
+  800ccc:	48 89 e5             	mov    %rsp,%rbp
+  800ccf:	41 56                	push   %r14
+  800cd1:	41 55                	push   %r13
+  800cd3:	41 54                	push   %r12
+  800cd5:	53                   	push   %rbx
+  800cd6:	48 83 ec 10          	sub    $0x10,%rsp
+  800cda:	89 fb                	mov    %edi,%ebx
+  800cdc:	49 89 f4             	mov    %rsi,%r12
+  800cdf:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ce2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ce6:	48 b8 b9 08 80 00 00 	movabs $0x8008b9,%rax
+  800ced:	00 00 00 
+  800cf0:	ff d0                	call   *%rax
+  800cf2:	85 c0                	test   %eax,%eax
+  800cf4:	78 47                	js     800d3d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cf6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800cfa:	41 8b 3e             	mov    (%r14),%edi
+  800cfd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800d01:	48 b8 04 09 80 00 00 	movabs $0x800904,%rax
+  800d08:	00 00 00 
+  800d0b:	ff d0                	call   *%rax
+  800d0d:	85 c0                	test   %eax,%eax
+  800d0f:	78 30                	js     800d41 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d11:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800d16:	74 2d                	je     800d45 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d18:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d1c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800d20:	48 85 c0             	test   %rax,%rax
+  800d23:	74 56                	je     800d7b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800d25:	4c 89 ea             	mov    %r13,%rdx
+  800d28:	4c 89 e6             	mov    %r12,%rsi
+  800d2b:	4c 89 f7             	mov    %r14,%rdi
+  800d2e:	ff d0                	call   *%rax
+}
+  800d30:	48 83 c4 10          	add    $0x10,%rsp
+  800d34:	5b                   	pop    %rbx
+  800d35:	41 5c                	pop    %r12
+  800d37:	41 5d                	pop    %r13
+  800d39:	41 5e                	pop    %r14
+  800d3b:	5d                   	pop    %rbp
+  800d3c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d3d:	48 98                	cltq
+  800d3f:	eb ef                	jmp    800d30 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d41:	48 98                	cltq
+  800d43:	eb eb                	jmp    800d30 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800d45:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d4c:	00 00 00 
+  800d4f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800d55:	89 da                	mov    %ebx,%edx
+  800d57:	48 bf bd 2b 80 00 00 	movabs $0x802bbd,%rdi
+  800d5e:	00 00 00 
+  800d61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d66:	48 b9 4e 1c 80 00 00 	movabs $0x801c4e,%rcx
+  800d6d:	00 00 00 
+  800d70:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d72:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800d79:	eb b5                	jmp    800d30 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d7b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800d82:	eb ac                	jmp    800d30 <write+0x65>
+
+0000000000800d84 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800d84:	55                   	push   %rbp
+  800d85:	48 89 e5             	mov    %rsp,%rbp
+  800d88:	53                   	push   %rbx
+  800d89:	48 83 ec 18          	sub    $0x18,%rsp
+  800d8d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d8f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d93:	48 b8 b9 08 80 00 00 	movabs $0x8008b9,%rax
+  800d9a:	00 00 00 
+  800d9d:	ff d0                	call   *%rax
+  800d9f:	85 c0                	test   %eax,%eax
+  800da1:	78 0c                	js     800daf <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800da3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800da7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800daa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800daf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800db3:	c9                   	leave
+  800db4:	c3                   	ret
+
+0000000000800db5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800db5:	55                   	push   %rbp
+  800db6:	48 89 e5             	mov    %rsp,%rbp
+  800db9:	41 55                	push   %r13
+  800dbb:	41 54                	push   %r12
+  800dbd:	53                   	push   %rbx
+  800dbe:	48 83 ec 18          	sub    $0x18,%rsp
+  800dc2:	89 fb                	mov    %edi,%ebx
+  800dc4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800dc7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800dcb:	48 b8 b9 08 80 00 00 	movabs $0x8008b9,%rax
+  800dd2:	00 00 00 
+  800dd5:	ff d0                	call   *%rax
+  800dd7:	85 c0                	test   %eax,%eax
+  800dd9:	78 38                	js     800e13 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ddb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800ddf:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800de3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800de7:	48 b8 04 09 80 00 00 	movabs $0x800904,%rax
+  800dee:	00 00 00 
+  800df1:	ff d0                	call   *%rax
+  800df3:	85 c0                	test   %eax,%eax
+  800df5:	78 1c                	js     800e13 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800df7:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800dfc:	74 20                	je     800e1e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800dfe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e02:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800e06:	48 85 c0             	test   %rax,%rax
+  800e09:	74 47                	je     800e52 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800e0b:	44 89 e6             	mov    %r12d,%esi
+  800e0e:	4c 89 ef             	mov    %r13,%rdi
+  800e11:	ff d0                	call   *%rax
+}
+  800e13:	48 83 c4 18          	add    $0x18,%rsp
+  800e17:	5b                   	pop    %rbx
+  800e18:	41 5c                	pop    %r12
+  800e1a:	41 5d                	pop    %r13
+  800e1c:	5d                   	pop    %rbp
+  800e1d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800e1e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800e25:	00 00 00 
+  800e28:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800e2e:	89 da                	mov    %ebx,%edx
+  800e30:	48 bf 80 2b 80 00 00 	movabs $0x802b80,%rdi
+  800e37:	00 00 00 
+  800e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3f:	48 b9 4e 1c 80 00 00 	movabs $0x801c4e,%rcx
+  800e46:	00 00 00 
+  800e49:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e50:	eb c1                	jmp    800e13 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800e52:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e57:	eb ba                	jmp    800e13 <ftruncate+0x5e>
+
+0000000000800e59 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800e59:	55                   	push   %rbp
+  800e5a:	48 89 e5             	mov    %rsp,%rbp
+  800e5d:	41 54                	push   %r12
+  800e5f:	53                   	push   %rbx
+  800e60:	48 83 ec 10          	sub    $0x10,%rsp
+  800e64:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e67:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e6b:	48 b8 b9 08 80 00 00 	movabs $0x8008b9,%rax
+  800e72:	00 00 00 
+  800e75:	ff d0                	call   *%rax
+  800e77:	85 c0                	test   %eax,%eax
+  800e79:	78 4e                	js     800ec9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e7b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800e7f:	41 8b 3c 24          	mov    (%r12),%edi
+  800e83:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800e87:	48 b8 04 09 80 00 00 	movabs $0x800904,%rax
+  800e8e:	00 00 00 
+  800e91:	ff d0                	call   *%rax
+  800e93:	85 c0                	test   %eax,%eax
+  800e95:	78 32                	js     800ec9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800e97:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e9b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800ea0:	74 30                	je     800ed2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800ea2:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800ea5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800eac:	00 00 00 
+    stat->st_isdir = 0;
+  800eaf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800eb6:	00 00 00 
+    stat->st_dev = dev;
+  800eb9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800ec0:	48 89 de             	mov    %rbx,%rsi
+  800ec3:	4c 89 e7             	mov    %r12,%rdi
+  800ec6:	ff 50 28             	call   *0x28(%rax)
+}
+  800ec9:	48 83 c4 10          	add    $0x10,%rsp
+  800ecd:	5b                   	pop    %rbx
+  800ece:	41 5c                	pop    %r12
+  800ed0:	5d                   	pop    %rbp
+  800ed1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800ed2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ed7:	eb f0                	jmp    800ec9 <fstat+0x70>
+
+0000000000800ed9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800ed9:	55                   	push   %rbp
+  800eda:	48 89 e5             	mov    %rsp,%rbp
+  800edd:	41 54                	push   %r12
+  800edf:	53                   	push   %rbx
+  800ee0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800ee3:	be 00 00 00 00       	mov    $0x0,%esi
+  800ee8:	48 b8 5a 11 80 00 00 	movabs $0x80115a,%rax
+  800eef:	00 00 00 
+  800ef2:	ff d0                	call   *%rax
+  800ef4:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800ef6:	85 c0                	test   %eax,%eax
+  800ef8:	78 25                	js     800f1f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800efa:	4c 89 e6             	mov    %r12,%rsi
+  800efd:	89 c7                	mov    %eax,%edi
+  800eff:	48 b8 59 0e 80 00 00 	movabs $0x800e59,%rax
+  800f06:	00 00 00 
+  800f09:	ff d0                	call   *%rax
+  800f0b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800f0e:	89 df                	mov    %ebx,%edi
+  800f10:	48 b8 1e 0a 80 00 00 	movabs $0x800a1e,%rax
+  800f17:	00 00 00 
+  800f1a:	ff d0                	call   *%rax
+
+    return res;
+  800f1c:	44 89 e3             	mov    %r12d,%ebx
+}
+  800f1f:	89 d8                	mov    %ebx,%eax
+  800f21:	5b                   	pop    %rbx
+  800f22:	41 5c                	pop    %r12
+  800f24:	5d                   	pop    %rbp
+  800f25:	c3                   	ret
+
+0000000000800f26 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800f26:	55                   	push   %rbp
+  800f27:	48 89 e5             	mov    %rsp,%rbp
+  800f2a:	41 54                	push   %r12
+  800f2c:	53                   	push   %rbx
+  800f2d:	48 83 ec 10          	sub    $0x10,%rsp
+  800f31:	41 89 fc             	mov    %edi,%r12d
+  800f34:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f37:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f3e:	00 00 00 
+  800f41:	83 38 00             	cmpl   $0x0,(%rax)
+  800f44:	74 5e                	je     800fa4 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800f46:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800f4c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800f51:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800f58:	00 00 00 
+  800f5b:	44 89 e6             	mov    %r12d,%esi
+  800f5e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f65:	00 00 00 
+  800f68:	8b 38                	mov    (%rax),%edi
+  800f6a:	48 b8 2f 2a 80 00 00 	movabs $0x802a2f,%rax
+  800f71:	00 00 00 
+  800f74:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800f76:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800f7d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800f7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f83:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800f87:	48 89 de             	mov    %rbx,%rsi
+  800f8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f8f:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  800f96:	00 00 00 
+  800f99:	ff d0                	call   *%rax
+}
+  800f9b:	48 83 c4 10          	add    $0x10,%rsp
+  800f9f:	5b                   	pop    %rbx
+  800fa0:	41 5c                	pop    %r12
+  800fa2:	5d                   	pop    %rbp
+  800fa3:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800fa4:	bf 03 00 00 00       	mov    $0x3,%edi
+  800fa9:	48 b8 cf 2a 80 00 00 	movabs $0x802acf,%rax
+  800fb0:	00 00 00 
+  800fb3:	ff d0                	call   *%rax
+  800fb5:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800fbc:	00 00 
+  800fbe:	eb 86                	jmp    800f46 <fsipc+0x20>
+
+0000000000800fc0 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800fc0:	55                   	push   %rbp
+  800fc1:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800fc4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800fcb:	00 00 00 
+  800fce:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800fd1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800fd3:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800fd6:	be 00 00 00 00       	mov    $0x0,%esi
+  800fdb:	bf 02 00 00 00       	mov    $0x2,%edi
+  800fe0:	48 b8 26 0f 80 00 00 	movabs $0x800f26,%rax
+  800fe7:	00 00 00 
+  800fea:	ff d0                	call   *%rax
+}
+  800fec:	5d                   	pop    %rbp
+  800fed:	c3                   	ret
+
+0000000000800fee <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800fee:	55                   	push   %rbp
+  800fef:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800ff2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800ff5:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800ffc:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  800ffe:	be 00 00 00 00       	mov    $0x0,%esi
+  801003:	bf 06 00 00 00       	mov    $0x6,%edi
+  801008:	48 b8 26 0f 80 00 00 	movabs $0x800f26,%rax
+  80100f:	00 00 00 
+  801012:	ff d0                	call   *%rax
+}
+  801014:	5d                   	pop    %rbp
+  801015:	c3                   	ret
+
+0000000000801016 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801016:	55                   	push   %rbp
+  801017:	48 89 e5             	mov    %rsp,%rbp
+  80101a:	41 54                	push   %r12
+  80101c:	53                   	push   %rbx
+  80101d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801020:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801023:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80102a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80102c:	be 00 00 00 00       	mov    $0x0,%esi
+  801031:	bf 05 00 00 00       	mov    $0x5,%edi
+  801036:	48 b8 26 0f 80 00 00 	movabs $0x800f26,%rax
+  80103d:	00 00 00 
+  801040:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801042:	85 c0                	test   %eax,%eax
+  801044:	78 3d                	js     801083 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801046:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80104d:	00 00 00 
+  801050:	4c 89 e6             	mov    %r12,%rsi
+  801053:	48 89 df             	mov    %rbx,%rdi
+  801056:	48 b8 73 25 80 00 00 	movabs $0x802573,%rax
+  80105d:	00 00 00 
+  801060:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801062:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801069:	00 
+  80106a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801070:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801077:	00 
+  801078:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80107e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801083:	5b                   	pop    %rbx
+  801084:	41 5c                	pop    %r12
+  801086:	5d                   	pop    %rbp
+  801087:	c3                   	ret
+
+0000000000801088 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801088:	55                   	push   %rbp
+  801089:	48 89 e5             	mov    %rsp,%rbp
+  80108c:	41 54                	push   %r12
+  80108e:	53                   	push   %rbx
+  80108f:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  801092:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  801097:	48 39 c2             	cmp    %rax,%rdx
+  80109a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80109e:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8010a1:	48 89 c2             	mov    %rax,%rdx
+  8010a4:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8010ab:	00 00 00 
+  8010ae:	48 b8 d4 27 80 00 00 	movabs $0x8027d4,%rax
+  8010b5:	00 00 00 
+  8010b8:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8010ba:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8010c1:	00 00 00 
+  8010c4:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8010c9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8010cb:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8010cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8010d9:	48 b8 26 0f 80 00 00 	movabs $0x800f26,%rax
+  8010e0:	00 00 00 
+  8010e3:	ff d0                	call   *%rax
+  8010e5:	48 98                	cltq
+}
+  8010e7:	5b                   	pop    %rbx
+  8010e8:	41 5c                	pop    %r12
+  8010ea:	5d                   	pop    %rbp
+  8010eb:	c3                   	ret
+
+00000000008010ec <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8010ec:	55                   	push   %rbp
+  8010ed:	48 89 e5             	mov    %rsp,%rbp
+  8010f0:	41 54                	push   %r12
+  8010f2:	53                   	push   %rbx
+  8010f3:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8010f6:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8010fd:	00 00 00 
+  801100:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801103:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  801105:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80110a:	48 39 ca             	cmp    %rcx,%rdx
+  80110d:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  801111:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  801115:	be 00 00 00 00       	mov    $0x0,%esi
+  80111a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80111f:	48 b8 26 0f 80 00 00 	movabs $0x800f26,%rax
+  801126:	00 00 00 
+  801129:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  80112b:	85 c0                	test   %eax,%eax
+  80112d:	78 27                	js     801156 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  80112f:	48 63 d8             	movslq %eax,%rbx
+  801132:	48 89 da             	mov    %rbx,%rdx
+  801135:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80113c:	00 00 00 
+  80113f:	4c 89 e7             	mov    %r12,%rdi
+  801142:	48 b8 d4 27 80 00 00 	movabs $0x8027d4,%rax
+  801149:	00 00 00 
+  80114c:	ff d0                	call   *%rax
+    return bytes_read;
+  80114e:	48 89 d8             	mov    %rbx,%rax
+}
+  801151:	5b                   	pop    %rbx
+  801152:	41 5c                	pop    %r12
+  801154:	5d                   	pop    %rbp
+  801155:	c3                   	ret
+        return bytes_read;
+  801156:	48 98                	cltq
+  801158:	eb f7                	jmp    801151 <devfile_read+0x65>
+
+000000000080115a <open>:
+open(const char *path, int mode) {
+  80115a:	55                   	push   %rbp
+  80115b:	48 89 e5             	mov    %rsp,%rbp
+  80115e:	41 55                	push   %r13
+  801160:	41 54                	push   %r12
+  801162:	53                   	push   %rbx
+  801163:	48 83 ec 18          	sub    $0x18,%rsp
+  801167:	49 89 fc             	mov    %rdi,%r12
+  80116a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80116d:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  801174:	00 00 00 
+  801177:	ff d0                	call   *%rax
+  801179:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80117f:	0f 87 8a 00 00 00    	ja     80120f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801185:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801189:	48 b8 59 08 80 00 00 	movabs $0x800859,%rax
+  801190:	00 00 00 
+  801193:	ff d0                	call   *%rax
+  801195:	89 c3                	mov    %eax,%ebx
+  801197:	85 c0                	test   %eax,%eax
+  801199:	78 50                	js     8011eb <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80119b:	4c 89 e6             	mov    %r12,%rsi
+  80119e:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8011a5:	00 00 00 
+  8011a8:	48 89 df             	mov    %rbx,%rdi
+  8011ab:	48 b8 73 25 80 00 00 	movabs $0x802573,%rax
+  8011b2:	00 00 00 
+  8011b5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011b7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011be:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8011c2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011c7:	48 b8 26 0f 80 00 00 	movabs $0x800f26,%rax
+  8011ce:	00 00 00 
+  8011d1:	ff d0                	call   *%rax
+  8011d3:	89 c3                	mov    %eax,%ebx
+  8011d5:	85 c0                	test   %eax,%eax
+  8011d7:	78 1f                	js     8011f8 <open+0x9e>
+    return fd2num(fd);
+  8011d9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8011dd:	48 b8 2b 08 80 00 00 	movabs $0x80082b,%rax
+  8011e4:	00 00 00 
+  8011e7:	ff d0                	call   *%rax
+  8011e9:	89 c3                	mov    %eax,%ebx
+}
+  8011eb:	89 d8                	mov    %ebx,%eax
+  8011ed:	48 83 c4 18          	add    $0x18,%rsp
+  8011f1:	5b                   	pop    %rbx
+  8011f2:	41 5c                	pop    %r12
+  8011f4:	41 5d                	pop    %r13
+  8011f6:	5d                   	pop    %rbp
+  8011f7:	c3                   	ret
+        fd_close(fd, 0);
+  8011f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801201:	48 b8 74 09 80 00 00 	movabs $0x800974,%rax
+  801208:	00 00 00 
+  80120b:	ff d0                	call   *%rax
+        return res;
+  80120d:	eb dc                	jmp    8011eb <open+0x91>
+        return -E_BAD_PATH;
+  80120f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801214:	eb d5                	jmp    8011eb <open+0x91>
+
+0000000000801216 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801216:	55                   	push   %rbp
+  801217:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80121a:	be 00 00 00 00       	mov    $0x0,%esi
+  80121f:	bf 08 00 00 00       	mov    $0x8,%edi
+  801224:	48 b8 26 0f 80 00 00 	movabs $0x800f26,%rax
+  80122b:	00 00 00 
+  80122e:	ff d0                	call   *%rax
+}
+  801230:	5d                   	pop    %rbp
+  801231:	c3                   	ret
+
+0000000000801232 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801232:	55                   	push   %rbp
+  801233:	48 89 e5             	mov    %rsp,%rbp
+  801236:	41 54                	push   %r12
+  801238:	53                   	push   %rbx
+  801239:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80123c:	48 b8 3d 08 80 00 00 	movabs $0x80083d,%rax
+  801243:	00 00 00 
+  801246:	ff d0                	call   *%rax
+  801248:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80124b:	48 be 00 2c 80 00 00 	movabs $0x802c00,%rsi
+  801252:	00 00 00 
+  801255:	48 89 df             	mov    %rbx,%rdi
+  801258:	48 b8 73 25 80 00 00 	movabs $0x802573,%rax
+  80125f:	00 00 00 
+  801262:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801264:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801269:	41 2b 04 24          	sub    (%r12),%eax
+  80126d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801273:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80127a:	00 00 00 
+    stat->st_dev = &devpipe;
+  80127d:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  801284:	00 00 00 
+  801287:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80128e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801293:	5b                   	pop    %rbx
+  801294:	41 5c                	pop    %r12
+  801296:	5d                   	pop    %rbp
+  801297:	c3                   	ret
+
+0000000000801298 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801298:	55                   	push   %rbp
+  801299:	48 89 e5             	mov    %rsp,%rbp
+  80129c:	41 54                	push   %r12
+  80129e:	53                   	push   %rbx
+  80129f:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8012a2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012a7:	48 89 fe             	mov    %rdi,%rsi
+  8012aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012af:	49 bc 55 03 80 00 00 	movabs $0x800355,%r12
+  8012b6:	00 00 00 
+  8012b9:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012bc:	48 89 df             	mov    %rbx,%rdi
+  8012bf:	48 b8 3d 08 80 00 00 	movabs $0x80083d,%rax
+  8012c6:	00 00 00 
+  8012c9:	ff d0                	call   *%rax
+  8012cb:	48 89 c6             	mov    %rax,%rsi
+  8012ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012d8:	41 ff d4             	call   *%r12
+}
+  8012db:	5b                   	pop    %rbx
+  8012dc:	41 5c                	pop    %r12
+  8012de:	5d                   	pop    %rbp
+  8012df:	c3                   	ret
+
+00000000008012e0 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8012e0:	55                   	push   %rbp
+  8012e1:	48 89 e5             	mov    %rsp,%rbp
+  8012e4:	41 57                	push   %r15
+  8012e6:	41 56                	push   %r14
+  8012e8:	41 55                	push   %r13
+  8012ea:	41 54                	push   %r12
+  8012ec:	53                   	push   %rbx
+  8012ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8012f1:	49 89 fc             	mov    %rdi,%r12
+  8012f4:	49 89 f5             	mov    %rsi,%r13
+  8012f7:	49 89 d7             	mov    %rdx,%r15
+  8012fa:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8012fe:	48 b8 3d 08 80 00 00 	movabs $0x80083d,%rax
+  801305:	00 00 00 
+  801308:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80130a:	4d 85 ff             	test   %r15,%r15
+  80130d:	0f 84 af 00 00 00    	je     8013c2 <devpipe_write+0xe2>
+  801313:	48 89 c3             	mov    %rax,%rbx
+  801316:	4c 89 f8             	mov    %r15,%rax
+  801319:	4d 89 ef             	mov    %r13,%r15
+  80131c:	4c 01 e8             	add    %r13,%rax
+  80131f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801323:	49 bd 5d 02 80 00 00 	movabs $0x80025d,%r13
+  80132a:	00 00 00 
+            sys_yield();
+  80132d:	49 be fa 01 80 00 00 	movabs $0x8001fa,%r14
+  801334:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801337:	8b 73 04             	mov    0x4(%rbx),%esi
+  80133a:	48 63 ce             	movslq %esi,%rcx
+  80133d:	48 63 03             	movslq (%rbx),%rax
+  801340:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801346:	48 39 c1             	cmp    %rax,%rcx
+  801349:	72 2e                	jb     801379 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80134b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801350:	48 89 da             	mov    %rbx,%rdx
+  801353:	be 00 10 00 00       	mov    $0x1000,%esi
+  801358:	4c 89 e7             	mov    %r12,%rdi
+  80135b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80135e:	85 c0                	test   %eax,%eax
+  801360:	74 66                	je     8013c8 <devpipe_write+0xe8>
+            sys_yield();
+  801362:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801365:	8b 73 04             	mov    0x4(%rbx),%esi
+  801368:	48 63 ce             	movslq %esi,%rcx
+  80136b:	48 63 03             	movslq (%rbx),%rax
+  80136e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801374:	48 39 c1             	cmp    %rax,%rcx
+  801377:	73 d2                	jae    80134b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801379:	41 0f b6 3f          	movzbl (%r15),%edi
+  80137d:	48 89 ca             	mov    %rcx,%rdx
+  801380:	48 c1 ea 03          	shr    $0x3,%rdx
+  801384:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80138b:	08 10 20 
+  80138e:	48 f7 e2             	mul    %rdx
+  801391:	48 c1 ea 06          	shr    $0x6,%rdx
+  801395:	48 89 d0             	mov    %rdx,%rax
+  801398:	48 c1 e0 09          	shl    $0x9,%rax
+  80139c:	48 29 d0             	sub    %rdx,%rax
+  80139f:	48 c1 e0 03          	shl    $0x3,%rax
+  8013a3:	48 29 c1             	sub    %rax,%rcx
+  8013a6:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013ab:	83 c6 01             	add    $0x1,%esi
+  8013ae:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013b1:	49 83 c7 01          	add    $0x1,%r15
+  8013b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013b9:	49 39 c7             	cmp    %rax,%r15
+  8013bc:	0f 85 75 ff ff ff    	jne    801337 <devpipe_write+0x57>
+    return n;
+  8013c2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8013c6:	eb 05                	jmp    8013cd <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8013c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013cd:	48 83 c4 18          	add    $0x18,%rsp
+  8013d1:	5b                   	pop    %rbx
+  8013d2:	41 5c                	pop    %r12
+  8013d4:	41 5d                	pop    %r13
+  8013d6:	41 5e                	pop    %r14
+  8013d8:	41 5f                	pop    %r15
+  8013da:	5d                   	pop    %rbp
+  8013db:	c3                   	ret
+
+00000000008013dc <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8013dc:	55                   	push   %rbp
+  8013dd:	48 89 e5             	mov    %rsp,%rbp
+  8013e0:	41 57                	push   %r15
+  8013e2:	41 56                	push   %r14
+  8013e4:	41 55                	push   %r13
+  8013e6:	41 54                	push   %r12
+  8013e8:	53                   	push   %rbx
+  8013e9:	48 83 ec 18          	sub    $0x18,%rsp
+  8013ed:	49 89 fc             	mov    %rdi,%r12
+  8013f0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8013f4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8013f8:	48 b8 3d 08 80 00 00 	movabs $0x80083d,%rax
+  8013ff:	00 00 00 
+  801402:	ff d0                	call   *%rax
+  801404:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801407:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80140d:	49 bd 5d 02 80 00 00 	movabs $0x80025d,%r13
+  801414:	00 00 00 
+            sys_yield();
+  801417:	49 be fa 01 80 00 00 	movabs $0x8001fa,%r14
+  80141e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801421:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801426:	74 7d                	je     8014a5 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801428:	8b 03                	mov    (%rbx),%eax
+  80142a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80142d:	75 26                	jne    801455 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80142f:	4d 85 ff             	test   %r15,%r15
+  801432:	75 77                	jne    8014ab <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801434:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801439:	48 89 da             	mov    %rbx,%rdx
+  80143c:	be 00 10 00 00       	mov    $0x1000,%esi
+  801441:	4c 89 e7             	mov    %r12,%rdi
+  801444:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801447:	85 c0                	test   %eax,%eax
+  801449:	74 72                	je     8014bd <devpipe_read+0xe1>
+            sys_yield();
+  80144b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80144e:	8b 03                	mov    (%rbx),%eax
+  801450:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801453:	74 df                	je     801434 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801455:	48 63 c8             	movslq %eax,%rcx
+  801458:	48 89 ca             	mov    %rcx,%rdx
+  80145b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80145f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801466:	08 10 20 
+  801469:	48 89 d0             	mov    %rdx,%rax
+  80146c:	48 f7 e6             	mul    %rsi
+  80146f:	48 c1 ea 06          	shr    $0x6,%rdx
+  801473:	48 89 d0             	mov    %rdx,%rax
+  801476:	48 c1 e0 09          	shl    $0x9,%rax
+  80147a:	48 29 d0             	sub    %rdx,%rax
+  80147d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801484:	00 
+  801485:	48 89 c8             	mov    %rcx,%rax
+  801488:	48 29 d0             	sub    %rdx,%rax
+  80148b:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801490:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801494:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801498:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80149b:	49 83 c7 01          	add    $0x1,%r15
+  80149f:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8014a3:	75 83                	jne    801428 <devpipe_read+0x4c>
+    return n;
+  8014a5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014a9:	eb 03                	jmp    8014ae <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014ab:	4c 89 f8             	mov    %r15,%rax
+}
+  8014ae:	48 83 c4 18          	add    $0x18,%rsp
+  8014b2:	5b                   	pop    %rbx
+  8014b3:	41 5c                	pop    %r12
+  8014b5:	41 5d                	pop    %r13
+  8014b7:	41 5e                	pop    %r14
+  8014b9:	41 5f                	pop    %r15
+  8014bb:	5d                   	pop    %rbp
+  8014bc:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c2:	eb ea                	jmp    8014ae <devpipe_read+0xd2>
+
+00000000008014c4 <pipe>:
+pipe(int pfd[2]) {
+  8014c4:	55                   	push   %rbp
+  8014c5:	48 89 e5             	mov    %rsp,%rbp
+  8014c8:	41 55                	push   %r13
+  8014ca:	41 54                	push   %r12
+  8014cc:	53                   	push   %rbx
+  8014cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8014d1:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8014d4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8014d8:	48 b8 59 08 80 00 00 	movabs $0x800859,%rax
+  8014df:	00 00 00 
+  8014e2:	ff d0                	call   *%rax
+  8014e4:	89 c3                	mov    %eax,%ebx
+  8014e6:	85 c0                	test   %eax,%eax
+  8014e8:	0f 88 a0 01 00 00    	js     80168e <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8014ee:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8014f3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8014f8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8014fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801501:	48 b8 89 02 80 00 00 	movabs $0x800289,%rax
+  801508:	00 00 00 
+  80150b:	ff d0                	call   *%rax
+  80150d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80150f:	85 c0                	test   %eax,%eax
+  801511:	0f 88 77 01 00 00    	js     80168e <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801517:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80151b:	48 b8 59 08 80 00 00 	movabs $0x800859,%rax
+  801522:	00 00 00 
+  801525:	ff d0                	call   *%rax
+  801527:	89 c3                	mov    %eax,%ebx
+  801529:	85 c0                	test   %eax,%eax
+  80152b:	0f 88 43 01 00 00    	js     801674 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801531:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801536:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80153b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80153f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801544:	48 b8 89 02 80 00 00 	movabs $0x800289,%rax
+  80154b:	00 00 00 
+  80154e:	ff d0                	call   *%rax
+  801550:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801552:	85 c0                	test   %eax,%eax
+  801554:	0f 88 1a 01 00 00    	js     801674 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80155a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80155e:	48 b8 3d 08 80 00 00 	movabs $0x80083d,%rax
+  801565:	00 00 00 
+  801568:	ff d0                	call   *%rax
+  80156a:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80156d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801572:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801577:	48 89 c6             	mov    %rax,%rsi
+  80157a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80157f:	48 b8 89 02 80 00 00 	movabs $0x800289,%rax
+  801586:	00 00 00 
+  801589:	ff d0                	call   *%rax
+  80158b:	89 c3                	mov    %eax,%ebx
+  80158d:	85 c0                	test   %eax,%eax
+  80158f:	0f 88 c5 00 00 00    	js     80165a <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801595:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801599:	48 b8 3d 08 80 00 00 	movabs $0x80083d,%rax
+  8015a0:	00 00 00 
+  8015a3:	ff d0                	call   *%rax
+  8015a5:	48 89 c1             	mov    %rax,%rcx
+  8015a8:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8015ae:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8015b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b9:	4c 89 ee             	mov    %r13,%rsi
+  8015bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c1:	48 b8 f0 02 80 00 00 	movabs $0x8002f0,%rax
+  8015c8:	00 00 00 
+  8015cb:	ff d0                	call   *%rax
+  8015cd:	89 c3                	mov    %eax,%ebx
+  8015cf:	85 c0                	test   %eax,%eax
+  8015d1:	78 6e                	js     801641 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8015d3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8015d8:	4c 89 ef             	mov    %r13,%rdi
+  8015db:	48 b8 2b 02 80 00 00 	movabs $0x80022b,%rax
+  8015e2:	00 00 00 
+  8015e5:	ff d0                	call   *%rax
+  8015e7:	83 f8 02             	cmp    $0x2,%eax
+  8015ea:	0f 85 ab 00 00 00    	jne    80169b <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8015f0:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8015f7:	00 00 
+  8015f9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8015fd:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8015ff:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801603:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80160a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80160e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801610:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801614:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80161b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80161f:	48 bb 2b 08 80 00 00 	movabs $0x80082b,%rbx
+  801626:	00 00 00 
+  801629:	ff d3                	call   *%rbx
+  80162b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80162f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801633:	ff d3                	call   *%rbx
+  801635:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80163a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163f:	eb 4d                	jmp    80168e <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  801641:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801646:	4c 89 ee             	mov    %r13,%rsi
+  801649:	bf 00 00 00 00       	mov    $0x0,%edi
+  80164e:	48 b8 55 03 80 00 00 	movabs $0x800355,%rax
+  801655:	00 00 00 
+  801658:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80165a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80165f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801663:	bf 00 00 00 00       	mov    $0x0,%edi
+  801668:	48 b8 55 03 80 00 00 	movabs $0x800355,%rax
+  80166f:	00 00 00 
+  801672:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  801674:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801679:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80167d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801682:	48 b8 55 03 80 00 00 	movabs $0x800355,%rax
+  801689:	00 00 00 
+  80168c:	ff d0                	call   *%rax
+}
+  80168e:	89 d8                	mov    %ebx,%eax
+  801690:	48 83 c4 18          	add    $0x18,%rsp
+  801694:	5b                   	pop    %rbx
+  801695:	41 5c                	pop    %r12
+  801697:	41 5d                	pop    %r13
+  801699:	5d                   	pop    %rbp
+  80169a:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80169b:	48 b9 30 2c 80 00 00 	movabs $0x802c30,%rcx
+  8016a2:	00 00 00 
+  8016a5:	48 ba 07 2c 80 00 00 	movabs $0x802c07,%rdx
+  8016ac:	00 00 00 
+  8016af:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8016b4:	48 bf 1c 2c 80 00 00 	movabs $0x802c1c,%rdi
+  8016bb:	00 00 00 
+  8016be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c3:	49 b8 fe 1a 80 00 00 	movabs $0x801afe,%r8
+  8016ca:	00 00 00 
+  8016cd:	41 ff d0             	call   *%r8
+
+00000000008016d0 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8016d0:	55                   	push   %rbp
+  8016d1:	48 89 e5             	mov    %rsp,%rbp
+  8016d4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8016d8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8016dc:	48 b8 b9 08 80 00 00 	movabs $0x8008b9,%rax
+  8016e3:	00 00 00 
+  8016e6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8016e8:	85 c0                	test   %eax,%eax
+  8016ea:	78 35                	js     801721 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8016ec:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8016f0:	48 b8 3d 08 80 00 00 	movabs $0x80083d,%rax
+  8016f7:	00 00 00 
+  8016fa:	ff d0                	call   *%rax
+  8016fc:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8016ff:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801704:	be 00 10 00 00       	mov    $0x1000,%esi
+  801709:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80170d:	48 b8 5d 02 80 00 00 	movabs $0x80025d,%rax
+  801714:	00 00 00 
+  801717:	ff d0                	call   *%rax
+  801719:	85 c0                	test   %eax,%eax
+  80171b:	0f 94 c0             	sete   %al
+  80171e:	0f b6 c0             	movzbl %al,%eax
+}
+  801721:	c9                   	leave
+  801722:	c3                   	ret
+
+0000000000801723 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801723:	48 89 f8             	mov    %rdi,%rax
+  801726:	48 c1 e8 27          	shr    $0x27,%rax
+  80172a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801731:	01 00 00 
+  801734:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801738:	f6 c2 01             	test   $0x1,%dl
+  80173b:	74 6d                	je     8017aa <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80173d:	48 89 f8             	mov    %rdi,%rax
+  801740:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801744:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80174b:	01 00 00 
+  80174e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801752:	f6 c2 01             	test   $0x1,%dl
+  801755:	74 62                	je     8017b9 <get_uvpt_entry+0x96>
+  801757:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80175e:	01 00 00 
+  801761:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801765:	f6 c2 80             	test   $0x80,%dl
+  801768:	75 4f                	jne    8017b9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80176a:	48 89 f8             	mov    %rdi,%rax
+  80176d:	48 c1 e8 15          	shr    $0x15,%rax
+  801771:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801778:	01 00 00 
+  80177b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80177f:	f6 c2 01             	test   $0x1,%dl
+  801782:	74 44                	je     8017c8 <get_uvpt_entry+0xa5>
+  801784:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80178b:	01 00 00 
+  80178e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801792:	f6 c2 80             	test   $0x80,%dl
+  801795:	75 31                	jne    8017c8 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  801797:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80179b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8017a2:	01 00 00 
+  8017a5:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8017a9:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017aa:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017b1:	01 00 00 
+  8017b4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017b8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017b9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017c0:	01 00 00 
+  8017c3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017c7:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017c8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017cf:	01 00 00 
+  8017d2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017d6:	c3                   	ret
+
+00000000008017d7 <get_prot>:
+
+int
+get_prot(void *va) {
+  8017d7:	55                   	push   %rbp
+  8017d8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8017db:	48 b8 23 17 80 00 00 	movabs $0x801723,%rax
+  8017e2:	00 00 00 
+  8017e5:	ff d0                	call   *%rax
+  8017e7:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8017ea:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8017ef:	89 c1                	mov    %eax,%ecx
+  8017f1:	83 c9 04             	or     $0x4,%ecx
+  8017f4:	f6 c2 01             	test   $0x1,%dl
+  8017f7:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8017fa:	89 c1                	mov    %eax,%ecx
+  8017fc:	83 c9 02             	or     $0x2,%ecx
+  8017ff:	f6 c2 02             	test   $0x2,%dl
+  801802:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  801805:	89 c1                	mov    %eax,%ecx
+  801807:	83 c9 01             	or     $0x1,%ecx
+  80180a:	48 85 d2             	test   %rdx,%rdx
+  80180d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801810:	89 c1                	mov    %eax,%ecx
+  801812:	83 c9 40             	or     $0x40,%ecx
+  801815:	f6 c6 04             	test   $0x4,%dh
+  801818:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80181b:	5d                   	pop    %rbp
+  80181c:	c3                   	ret
+
+000000000080181d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80181d:	55                   	push   %rbp
+  80181e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801821:	48 b8 23 17 80 00 00 	movabs $0x801723,%rax
+  801828:	00 00 00 
+  80182b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80182d:	48 c1 e8 06          	shr    $0x6,%rax
+  801831:	83 e0 01             	and    $0x1,%eax
+}
+  801834:	5d                   	pop    %rbp
+  801835:	c3                   	ret
+
+0000000000801836 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  801836:	55                   	push   %rbp
+  801837:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80183a:	48 b8 23 17 80 00 00 	movabs $0x801723,%rax
+  801841:	00 00 00 
+  801844:	ff d0                	call   *%rax
+  801846:	83 e0 01             	and    $0x1,%eax
+}
+  801849:	5d                   	pop    %rbp
+  80184a:	c3                   	ret
+
+000000000080184b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80184b:	55                   	push   %rbp
+  80184c:	48 89 e5             	mov    %rsp,%rbp
+  80184f:	41 57                	push   %r15
+  801851:	41 56                	push   %r14
+  801853:	41 55                	push   %r13
+  801855:	41 54                	push   %r12
+  801857:	53                   	push   %rbx
+  801858:	48 83 ec 18          	sub    $0x18,%rsp
+  80185c:	49 89 ff             	mov    %rdi,%r15
+  80185f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  801863:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  801868:	49 bc 36 18 80 00 00 	movabs $0x801836,%r12
+  80186f:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  801872:	49 be d7 17 80 00 00 	movabs $0x8017d7,%r14
+  801879:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80187c:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  801883:	00 00 00 
+  801886:	eb 0c                	jmp    801894 <foreach_shared_region+0x49>
+  801888:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80188f:	4c 39 eb             	cmp    %r13,%rbx
+  801892:	74 38                	je     8018cc <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  801894:	48 89 df             	mov    %rbx,%rdi
+  801897:	41 ff d4             	call   *%r12
+  80189a:	84 c0                	test   %al,%al
+  80189c:	74 ea                	je     801888 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  80189e:	48 89 df             	mov    %rbx,%rdi
+  8018a1:	41 ff d6             	call   *%r14
+  8018a4:	a8 40                	test   $0x40,%al
+  8018a6:	74 e0                	je     801888 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8018a8:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8018af:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8018b3:	48 89 df             	mov    %rbx,%rdi
+  8018b6:	41 ff d7             	call   *%r15
+        if (err)
+  8018b9:	85 c0                	test   %eax,%eax
+  8018bb:	74 cb                	je     801888 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8018bd:	48 83 c4 18          	add    $0x18,%rsp
+  8018c1:	5b                   	pop    %rbx
+  8018c2:	41 5c                	pop    %r12
+  8018c4:	41 5d                	pop    %r13
+  8018c6:	41 5e                	pop    %r14
+  8018c8:	41 5f                	pop    %r15
+  8018ca:	5d                   	pop    %rbp
+  8018cb:	c3                   	ret
+    return 0;
+  8018cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d1:	eb ea                	jmp    8018bd <foreach_shared_region+0x72>
+
+00000000008018d3 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8018d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d8:	c3                   	ret
+
+00000000008018d9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8018d9:	55                   	push   %rbp
+  8018da:	48 89 e5             	mov    %rsp,%rbp
+  8018dd:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8018e0:	48 be 54 2c 80 00 00 	movabs $0x802c54,%rsi
+  8018e7:	00 00 00 
+  8018ea:	48 b8 73 25 80 00 00 	movabs $0x802573,%rax
+  8018f1:	00 00 00 
+  8018f4:	ff d0                	call   *%rax
+    return 0;
+}
+  8018f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018fb:	5d                   	pop    %rbp
+  8018fc:	c3                   	ret
+
+00000000008018fd <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8018fd:	55                   	push   %rbp
+  8018fe:	48 89 e5             	mov    %rsp,%rbp
+  801901:	41 57                	push   %r15
+  801903:	41 56                	push   %r14
+  801905:	41 55                	push   %r13
+  801907:	41 54                	push   %r12
+  801909:	53                   	push   %rbx
+  80190a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801911:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801918:	48 85 d2             	test   %rdx,%rdx
+  80191b:	74 7a                	je     801997 <devcons_write+0x9a>
+  80191d:	49 89 d6             	mov    %rdx,%r14
+  801920:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801926:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80192b:	49 bf 6d 27 80 00 00 	movabs $0x80276d,%r15
+  801932:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801935:	4c 89 f3             	mov    %r14,%rbx
+  801938:	48 29 f3             	sub    %rsi,%rbx
+  80193b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801940:	48 39 c3             	cmp    %rax,%rbx
+  801943:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801947:	4c 63 eb             	movslq %ebx,%r13
+  80194a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801951:	48 01 c6             	add    %rax,%rsi
+  801954:	4c 89 ea             	mov    %r13,%rdx
+  801957:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80195e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801961:	4c 89 ee             	mov    %r13,%rsi
+  801964:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80196b:	48 b8 00 01 80 00 00 	movabs $0x800100,%rax
+  801972:	00 00 00 
+  801975:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801977:	41 01 dc             	add    %ebx,%r12d
+  80197a:	49 63 f4             	movslq %r12d,%rsi
+  80197d:	4c 39 f6             	cmp    %r14,%rsi
+  801980:	72 b3                	jb     801935 <devcons_write+0x38>
+    return res;
+  801982:	49 63 c4             	movslq %r12d,%rax
+}
+  801985:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80198c:	5b                   	pop    %rbx
+  80198d:	41 5c                	pop    %r12
+  80198f:	41 5d                	pop    %r13
+  801991:	41 5e                	pop    %r14
+  801993:	41 5f                	pop    %r15
+  801995:	5d                   	pop    %rbp
+  801996:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801997:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80199d:	eb e3                	jmp    801982 <devcons_write+0x85>
+
+000000000080199f <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80199f:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8019a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a7:	48 85 c0             	test   %rax,%rax
+  8019aa:	74 55                	je     801a01 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8019ac:	55                   	push   %rbp
+  8019ad:	48 89 e5             	mov    %rsp,%rbp
+  8019b0:	41 55                	push   %r13
+  8019b2:	41 54                	push   %r12
+  8019b4:	53                   	push   %rbx
+  8019b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8019b9:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8019bc:	48 bb 2d 01 80 00 00 	movabs $0x80012d,%rbx
+  8019c3:	00 00 00 
+  8019c6:	49 bc fa 01 80 00 00 	movabs $0x8001fa,%r12
+  8019cd:	00 00 00 
+  8019d0:	eb 03                	jmp    8019d5 <devcons_read+0x36>
+  8019d2:	41 ff d4             	call   *%r12
+  8019d5:	ff d3                	call   *%rbx
+  8019d7:	85 c0                	test   %eax,%eax
+  8019d9:	74 f7                	je     8019d2 <devcons_read+0x33>
+    if (c < 0) return c;
+  8019db:	48 63 d0             	movslq %eax,%rdx
+  8019de:	78 13                	js     8019f3 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8019e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e5:	83 f8 04             	cmp    $0x4,%eax
+  8019e8:	74 09                	je     8019f3 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8019ea:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8019ee:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8019f3:	48 89 d0             	mov    %rdx,%rax
+  8019f6:	48 83 c4 08          	add    $0x8,%rsp
+  8019fa:	5b                   	pop    %rbx
+  8019fb:	41 5c                	pop    %r12
+  8019fd:	41 5d                	pop    %r13
+  8019ff:	5d                   	pop    %rbp
+  801a00:	c3                   	ret
+  801a01:	48 89 d0             	mov    %rdx,%rax
+  801a04:	c3                   	ret
+
+0000000000801a05 <cputchar>:
+cputchar(int ch) {
+  801a05:	55                   	push   %rbp
+  801a06:	48 89 e5             	mov    %rsp,%rbp
+  801a09:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801a0d:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801a11:	be 01 00 00 00       	mov    $0x1,%esi
+  801a16:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801a1a:	48 b8 00 01 80 00 00 	movabs $0x800100,%rax
+  801a21:	00 00 00 
+  801a24:	ff d0                	call   *%rax
+}
+  801a26:	c9                   	leave
+  801a27:	c3                   	ret
+
+0000000000801a28 <getchar>:
+getchar(void) {
+  801a28:	55                   	push   %rbp
+  801a29:	48 89 e5             	mov    %rsp,%rbp
+  801a2c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801a30:	ba 01 00 00 00       	mov    $0x1,%edx
+  801a35:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801a39:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a3e:	48 b8 9c 0b 80 00 00 	movabs $0x800b9c,%rax
+  801a45:	00 00 00 
+  801a48:	ff d0                	call   *%rax
+  801a4a:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801a4c:	85 c0                	test   %eax,%eax
+  801a4e:	78 06                	js     801a56 <getchar+0x2e>
+  801a50:	74 08                	je     801a5a <getchar+0x32>
+  801a52:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801a56:	89 d0                	mov    %edx,%eax
+  801a58:	c9                   	leave
+  801a59:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801a5a:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801a5f:	eb f5                	jmp    801a56 <getchar+0x2e>
+
+0000000000801a61 <iscons>:
+iscons(int fdnum) {
+  801a61:	55                   	push   %rbp
+  801a62:	48 89 e5             	mov    %rsp,%rbp
+  801a65:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801a69:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a6d:	48 b8 b9 08 80 00 00 	movabs $0x8008b9,%rax
+  801a74:	00 00 00 
+  801a77:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a79:	85 c0                	test   %eax,%eax
+  801a7b:	78 18                	js     801a95 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801a7d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a81:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801a88:	00 00 00 
+  801a8b:	8b 00                	mov    (%rax),%eax
+  801a8d:	39 02                	cmp    %eax,(%rdx)
+  801a8f:	0f 94 c0             	sete   %al
+  801a92:	0f b6 c0             	movzbl %al,%eax
+}
+  801a95:	c9                   	leave
+  801a96:	c3                   	ret
+
+0000000000801a97 <opencons>:
+opencons(void) {
+  801a97:	55                   	push   %rbp
+  801a98:	48 89 e5             	mov    %rsp,%rbp
+  801a9b:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801a9f:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801aa3:	48 b8 59 08 80 00 00 	movabs $0x800859,%rax
+  801aaa:	00 00 00 
+  801aad:	ff d0                	call   *%rax
+  801aaf:	85 c0                	test   %eax,%eax
+  801ab1:	78 49                	js     801afc <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801ab3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ab8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801abd:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801ac1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ac6:	48 b8 89 02 80 00 00 	movabs $0x800289,%rax
+  801acd:	00 00 00 
+  801ad0:	ff d0                	call   *%rax
+  801ad2:	85 c0                	test   %eax,%eax
+  801ad4:	78 26                	js     801afc <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801ad6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ada:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801ae1:	00 00 
+  801ae3:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801ae5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801ae9:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801af0:	48 b8 2b 08 80 00 00 	movabs $0x80082b,%rax
+  801af7:	00 00 00 
+  801afa:	ff d0                	call   *%rax
+}
+  801afc:	c9                   	leave
+  801afd:	c3                   	ret
+
+0000000000801afe <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801afe:	55                   	push   %rbp
+  801aff:	48 89 e5             	mov    %rsp,%rbp
+  801b02:	41 56                	push   %r14
+  801b04:	41 55                	push   %r13
+  801b06:	41 54                	push   %r12
+  801b08:	53                   	push   %rbx
+  801b09:	48 83 ec 50          	sub    $0x50,%rsp
+  801b0d:	49 89 fc             	mov    %rdi,%r12
+  801b10:	41 89 f5             	mov    %esi,%r13d
+  801b13:	48 89 d3             	mov    %rdx,%rbx
+  801b16:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b1a:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801b1e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801b22:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801b29:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b2d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801b31:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801b35:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801b39:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801b40:	00 00 00 
+  801b43:	4c 8b 30             	mov    (%rax),%r14
+  801b46:	48 b8 c9 01 80 00 00 	movabs $0x8001c9,%rax
+  801b4d:	00 00 00 
+  801b50:	ff d0                	call   *%rax
+  801b52:	89 c6                	mov    %eax,%esi
+  801b54:	45 89 e8             	mov    %r13d,%r8d
+  801b57:	4c 89 e1             	mov    %r12,%rcx
+  801b5a:	4c 89 f2             	mov    %r14,%rdx
+  801b5d:	48 bf 60 2c 80 00 00 	movabs $0x802c60,%rdi
+  801b64:	00 00 00 
+  801b67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b6c:	49 bc 4e 1c 80 00 00 	movabs $0x801c4e,%r12
+  801b73:	00 00 00 
+  801b76:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801b79:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801b7d:	48 89 df             	mov    %rbx,%rdi
+  801b80:	48 b8 ea 1b 80 00 00 	movabs $0x801bea,%rax
+  801b87:	00 00 00 
+  801b8a:	ff d0                	call   *%rax
+    cprintf("\n");
+  801b8c:	48 bf bb 2b 80 00 00 	movabs $0x802bbb,%rdi
+  801b93:	00 00 00 
+  801b96:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801b9e:	cc                   	int3
+  801b9f:	eb fd                	jmp    801b9e <_panic+0xa0>
+
+0000000000801ba1 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801ba1:	55                   	push   %rbp
+  801ba2:	48 89 e5             	mov    %rsp,%rbp
+  801ba5:	53                   	push   %rbx
+  801ba6:	48 83 ec 08          	sub    $0x8,%rsp
+  801baa:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801bad:	8b 06                	mov    (%rsi),%eax
+  801baf:	8d 50 01             	lea    0x1(%rax),%edx
+  801bb2:	89 16                	mov    %edx,(%rsi)
+  801bb4:	48 98                	cltq
+  801bb6:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801bbb:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801bc1:	74 0a                	je     801bcd <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801bc3:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801bc7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bcb:	c9                   	leave
+  801bcc:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801bcd:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801bd1:	be ff 00 00 00       	mov    $0xff,%esi
+  801bd6:	48 b8 00 01 80 00 00 	movabs $0x800100,%rax
+  801bdd:	00 00 00 
+  801be0:	ff d0                	call   *%rax
+        state->offset = 0;
+  801be2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801be8:	eb d9                	jmp    801bc3 <putch+0x22>
+
+0000000000801bea <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801bea:	55                   	push   %rbp
+  801beb:	48 89 e5             	mov    %rsp,%rbp
+  801bee:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801bf5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801bf8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801bff:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801c04:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c09:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801c0c:	48 89 f1             	mov    %rsi,%rcx
+  801c0f:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801c16:	48 bf a1 1b 80 00 00 	movabs $0x801ba1,%rdi
+  801c1d:	00 00 00 
+  801c20:	48 b8 9e 1d 80 00 00 	movabs $0x801d9e,%rax
+  801c27:	00 00 00 
+  801c2a:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801c2c:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801c33:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801c3a:	48 b8 00 01 80 00 00 	movabs $0x800100,%rax
+  801c41:	00 00 00 
+  801c44:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801c46:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801c4c:	c9                   	leave
+  801c4d:	c3                   	ret
+
+0000000000801c4e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801c4e:	55                   	push   %rbp
+  801c4f:	48 89 e5             	mov    %rsp,%rbp
+  801c52:	48 83 ec 50          	sub    $0x50,%rsp
+  801c56:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801c5a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801c5e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c62:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801c66:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801c6a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801c71:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c79:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801c7d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801c81:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801c85:	48 b8 ea 1b 80 00 00 	movabs $0x801bea,%rax
+  801c8c:	00 00 00 
+  801c8f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801c91:	c9                   	leave
+  801c92:	c3                   	ret
+
+0000000000801c93 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801c93:	55                   	push   %rbp
+  801c94:	48 89 e5             	mov    %rsp,%rbp
+  801c97:	41 57                	push   %r15
+  801c99:	41 56                	push   %r14
+  801c9b:	41 55                	push   %r13
+  801c9d:	41 54                	push   %r12
+  801c9f:	53                   	push   %rbx
+  801ca0:	48 83 ec 18          	sub    $0x18,%rsp
+  801ca4:	49 89 fc             	mov    %rdi,%r12
+  801ca7:	49 89 f5             	mov    %rsi,%r13
+  801caa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cae:	8b 45 10             	mov    0x10(%rbp),%eax
+  801cb1:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801cb4:	41 89 cf             	mov    %ecx,%r15d
+  801cb7:	4c 39 fa             	cmp    %r15,%rdx
+  801cba:	73 5b                	jae    801d17 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801cbc:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801cc0:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801cc4:	85 db                	test   %ebx,%ebx
+  801cc6:	7e 0e                	jle    801cd6 <print_num+0x43>
+            putch(padc, put_arg);
+  801cc8:	4c 89 ee             	mov    %r13,%rsi
+  801ccb:	44 89 f7             	mov    %r14d,%edi
+  801cce:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801cd1:	83 eb 01             	sub    $0x1,%ebx
+  801cd4:	75 f2                	jne    801cc8 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801cd6:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801cda:	48 b9 94 2c 80 00 00 	movabs $0x802c94,%rcx
+  801ce1:	00 00 00 
+  801ce4:	48 b8 83 2c 80 00 00 	movabs $0x802c83,%rax
+  801ceb:	00 00 00 
+  801cee:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801cf2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cfb:	49 f7 f7             	div    %r15
+  801cfe:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801d02:	4c 89 ee             	mov    %r13,%rsi
+  801d05:	41 ff d4             	call   *%r12
+}
+  801d08:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801d0c:	5b                   	pop    %rbx
+  801d0d:	41 5c                	pop    %r12
+  801d0f:	41 5d                	pop    %r13
+  801d11:	41 5e                	pop    %r14
+  801d13:	41 5f                	pop    %r15
+  801d15:	5d                   	pop    %rbp
+  801d16:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801d17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d20:	49 f7 f7             	div    %r15
+  801d23:	48 83 ec 08          	sub    $0x8,%rsp
+  801d27:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801d2b:	52                   	push   %rdx
+  801d2c:	45 0f be c9          	movsbl %r9b,%r9d
+  801d30:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801d34:	48 89 c2             	mov    %rax,%rdx
+  801d37:	48 b8 93 1c 80 00 00 	movabs $0x801c93,%rax
+  801d3e:	00 00 00 
+  801d41:	ff d0                	call   *%rax
+  801d43:	48 83 c4 10          	add    $0x10,%rsp
+  801d47:	eb 8d                	jmp    801cd6 <print_num+0x43>
+
+0000000000801d49 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801d49:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801d4d:	48 8b 06             	mov    (%rsi),%rax
+  801d50:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801d54:	73 0a                	jae    801d60 <sprintputch+0x17>
+        *state->start++ = ch;
+  801d56:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d5a:	48 89 16             	mov    %rdx,(%rsi)
+  801d5d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801d60:	c3                   	ret
+
+0000000000801d61 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801d61:	55                   	push   %rbp
+  801d62:	48 89 e5             	mov    %rsp,%rbp
+  801d65:	48 83 ec 50          	sub    $0x50,%rsp
+  801d69:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d6d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d71:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801d75:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801d7c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d84:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801d88:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801d8c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801d90:	48 b8 9e 1d 80 00 00 	movabs $0x801d9e,%rax
+  801d97:	00 00 00 
+  801d9a:	ff d0                	call   *%rax
+}
+  801d9c:	c9                   	leave
+  801d9d:	c3                   	ret
+
+0000000000801d9e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801d9e:	55                   	push   %rbp
+  801d9f:	48 89 e5             	mov    %rsp,%rbp
+  801da2:	41 57                	push   %r15
+  801da4:	41 56                	push   %r14
+  801da6:	41 55                	push   %r13
+  801da8:	41 54                	push   %r12
+  801daa:	53                   	push   %rbx
+  801dab:	48 83 ec 38          	sub    $0x38,%rsp
+  801daf:	49 89 fe             	mov    %rdi,%r14
+  801db2:	49 89 f5             	mov    %rsi,%r13
+  801db5:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801db8:	48 8b 01             	mov    (%rcx),%rax
+  801dbb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801dbf:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801dc3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dc7:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801dcb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801dcf:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801dd3:	0f b6 3b             	movzbl (%rbx),%edi
+  801dd6:	40 80 ff 25          	cmp    $0x25,%dil
+  801dda:	74 18                	je     801df4 <vprintfmt+0x56>
+            if (!ch) return;
+  801ddc:	40 84 ff             	test   %dil,%dil
+  801ddf:	0f 84 b1 06 00 00    	je     802496 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801de5:	40 0f b6 ff          	movzbl %dil,%edi
+  801de9:	4c 89 ee             	mov    %r13,%rsi
+  801dec:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801def:	4c 89 e3             	mov    %r12,%rbx
+  801df2:	eb db                	jmp    801dcf <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801df4:	be 00 00 00 00       	mov    $0x0,%esi
+  801df9:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801dfd:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801e02:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e08:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801e0f:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e13:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801e18:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801e1d:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801e20:	83 e8 23             	sub    $0x23,%eax
+  801e23:	3c 57                	cmp    $0x57,%al
+  801e25:	0f 87 51 06 00 00    	ja     80247c <vprintfmt+0x6de>
+  801e2b:	0f b6 c0             	movzbl %al,%eax
+  801e2e:	48 b9 40 2e 80 00 00 	movabs $0x802e40,%rcx
+  801e35:	00 00 00 
+  801e38:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801e3b:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801e3e:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801e42:	eb cf                	jmp    801e13 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801e44:	49 89 dc             	mov    %rbx,%r12
+  801e47:	be 01 00 00 00       	mov    $0x1,%esi
+  801e4c:	eb c5                	jmp    801e13 <vprintfmt+0x75>
+            padc = ch;
+  801e4e:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801e52:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e55:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801e58:	eb b9                	jmp    801e13 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e5a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e5d:	83 f8 2f             	cmp    $0x2f,%eax
+  801e60:	77 24                	ja     801e86 <vprintfmt+0xe8>
+  801e62:	89 c1                	mov    %eax,%ecx
+  801e64:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801e68:	83 c0 08             	add    $0x8,%eax
+  801e6b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e6e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801e71:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801e74:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801e78:	79 99                	jns    801e13 <vprintfmt+0x75>
+                width = precision;
+  801e7a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801e7e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e84:	eb 8d                	jmp    801e13 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e86:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e8a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801e8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e92:	eb da                	jmp    801e6e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801e94:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801e99:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801e9d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801ea3:	3c 39                	cmp    $0x39,%al
+  801ea5:	77 1c                	ja     801ec3 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801ea7:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801eab:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801eaf:	0f b6 c0             	movzbl %al,%eax
+  801eb2:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801eb7:	0f b6 03             	movzbl (%rbx),%eax
+  801eba:	3c 39                	cmp    $0x39,%al
+  801ebc:	76 e9                	jbe    801ea7 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801ebe:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801ec1:	eb b1                	jmp    801e74 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801ec3:	49 89 dc             	mov    %rbx,%r12
+  801ec6:	eb ac                	jmp    801e74 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801ec8:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801ecb:	85 c9                	test   %ecx,%ecx
+  801ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed2:	0f 49 c1             	cmovns %ecx,%eax
+  801ed5:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801ed8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801edb:	e9 33 ff ff ff       	jmp    801e13 <vprintfmt+0x75>
+            lflag++;
+  801ee0:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ee3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ee6:	e9 28 ff ff ff       	jmp    801e13 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801eeb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801eee:	83 f8 2f             	cmp    $0x2f,%eax
+  801ef1:	77 19                	ja     801f0c <vprintfmt+0x16e>
+  801ef3:	89 c2                	mov    %eax,%edx
+  801ef5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ef9:	83 c0 08             	add    $0x8,%eax
+  801efc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eff:	8b 3a                	mov    (%rdx),%edi
+  801f01:	4c 89 ee             	mov    %r13,%rsi
+  801f04:	41 ff d6             	call   *%r14
+            break;
+  801f07:	e9 c3 fe ff ff       	jmp    801dcf <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  801f0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f18:	eb e5                	jmp    801eff <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  801f1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f1d:	83 f8 2f             	cmp    $0x2f,%eax
+  801f20:	77 5a                	ja     801f7c <vprintfmt+0x1de>
+  801f22:	89 c2                	mov    %eax,%edx
+  801f24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f28:	83 c0 08             	add    $0x8,%eax
+  801f2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801f2e:	8b 02                	mov    (%rdx),%eax
+  801f30:	89 c1                	mov    %eax,%ecx
+  801f32:	f7 d9                	neg    %ecx
+  801f34:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801f37:	83 f9 15             	cmp    $0x15,%ecx
+  801f3a:	7f 4e                	jg     801f8a <vprintfmt+0x1ec>
+  801f3c:	48 63 c1             	movslq %ecx,%rax
+  801f3f:	48 ba 00 31 80 00 00 	movabs $0x803100,%rdx
+  801f46:	00 00 00 
+  801f49:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801f4d:	48 85 c0             	test   %rax,%rax
+  801f50:	74 38                	je     801f8a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801f52:	48 89 c1             	mov    %rax,%rcx
+  801f55:	48 ba 19 2c 80 00 00 	movabs $0x802c19,%rdx
+  801f5c:	00 00 00 
+  801f5f:	4c 89 ee             	mov    %r13,%rsi
+  801f62:	4c 89 f7             	mov    %r14,%rdi
+  801f65:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f6a:	49 b8 61 1d 80 00 00 	movabs $0x801d61,%r8
+  801f71:	00 00 00 
+  801f74:	41 ff d0             	call   *%r8
+  801f77:	e9 53 fe ff ff       	jmp    801dcf <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801f7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f80:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f88:	eb a4                	jmp    801f2e <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801f8a:	48 ba ac 2c 80 00 00 	movabs $0x802cac,%rdx
+  801f91:	00 00 00 
+  801f94:	4c 89 ee             	mov    %r13,%rsi
+  801f97:	4c 89 f7             	mov    %r14,%rdi
+  801f9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9f:	49 b8 61 1d 80 00 00 	movabs $0x801d61,%r8
+  801fa6:	00 00 00 
+  801fa9:	41 ff d0             	call   *%r8
+  801fac:	e9 1e fe ff ff       	jmp    801dcf <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801fb1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fb4:	83 f8 2f             	cmp    $0x2f,%eax
+  801fb7:	77 6c                	ja     802025 <vprintfmt+0x287>
+  801fb9:	89 c2                	mov    %eax,%edx
+  801fbb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fbf:	83 c0 08             	add    $0x8,%eax
+  801fc2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fc5:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801fc8:	48 85 d2             	test   %rdx,%rdx
+  801fcb:	48 b8 a5 2c 80 00 00 	movabs $0x802ca5,%rax
+  801fd2:	00 00 00 
+  801fd5:	48 0f 45 c2          	cmovne %rdx,%rax
+  801fd9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801fdd:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801fe1:	7e 06                	jle    801fe9 <vprintfmt+0x24b>
+  801fe3:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801fe7:	75 4a                	jne    802033 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801fe9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801fed:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801ff1:	0f b6 00             	movzbl (%rax),%eax
+  801ff4:	84 c0                	test   %al,%al
+  801ff6:	0f 85 9a 00 00 00    	jne    802096 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  801ffc:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801fff:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802003:	85 c0                	test   %eax,%eax
+  802005:	0f 8e c4 fd ff ff    	jle    801dcf <vprintfmt+0x31>
+  80200b:	4c 89 ee             	mov    %r13,%rsi
+  80200e:	bf 20 00 00 00       	mov    $0x20,%edi
+  802013:	41 ff d6             	call   *%r14
+  802016:	41 83 ec 01          	sub    $0x1,%r12d
+  80201a:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80201e:	75 eb                	jne    80200b <vprintfmt+0x26d>
+  802020:	e9 aa fd ff ff       	jmp    801dcf <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802025:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802029:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80202d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802031:	eb 92                	jmp    801fc5 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802033:	49 63 f7             	movslq %r15d,%rsi
+  802036:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80203a:	48 b8 50 25 80 00 00 	movabs $0x802550,%rax
+  802041:	00 00 00 
+  802044:	ff d0                	call   *%rax
+  802046:	48 89 c2             	mov    %rax,%rdx
+  802049:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80204c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80204e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802051:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802054:	85 c0                	test   %eax,%eax
+  802056:	7e 91                	jle    801fe9 <vprintfmt+0x24b>
+  802058:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80205d:	4c 89 ee             	mov    %r13,%rsi
+  802060:	44 89 e7             	mov    %r12d,%edi
+  802063:	41 ff d6             	call   *%r14
+  802066:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80206a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80206d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802070:	75 eb                	jne    80205d <vprintfmt+0x2bf>
+  802072:	e9 72 ff ff ff       	jmp    801fe9 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802077:	0f b6 f8             	movzbl %al,%edi
+  80207a:	4c 89 ee             	mov    %r13,%rsi
+  80207d:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802080:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802084:	49 83 c4 01          	add    $0x1,%r12
+  802088:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80208e:	84 c0                	test   %al,%al
+  802090:	0f 84 66 ff ff ff    	je     801ffc <vprintfmt+0x25e>
+  802096:	45 85 ff             	test   %r15d,%r15d
+  802099:	78 0a                	js     8020a5 <vprintfmt+0x307>
+  80209b:	41 83 ef 01          	sub    $0x1,%r15d
+  80209f:	0f 88 57 ff ff ff    	js     801ffc <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8020a5:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8020a9:	74 cc                	je     802077 <vprintfmt+0x2d9>
+  8020ab:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8020ae:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8020b3:	80 fa 5e             	cmp    $0x5e,%dl
+  8020b6:	77 c2                	ja     80207a <vprintfmt+0x2dc>
+  8020b8:	eb bd                	jmp    802077 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8020ba:	40 84 f6             	test   %sil,%sil
+  8020bd:	75 26                	jne    8020e5 <vprintfmt+0x347>
+    switch (lflag) {
+  8020bf:	85 d2                	test   %edx,%edx
+  8020c1:	74 59                	je     80211c <vprintfmt+0x37e>
+  8020c3:	83 fa 01             	cmp    $0x1,%edx
+  8020c6:	74 7b                	je     802143 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8020c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8020ce:	0f 87 96 00 00 00    	ja     80216a <vprintfmt+0x3cc>
+  8020d4:	89 c2                	mov    %eax,%edx
+  8020d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020da:	83 c0 08             	add    $0x8,%eax
+  8020dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020e0:	4c 8b 22             	mov    (%rdx),%r12
+  8020e3:	eb 17                	jmp    8020fc <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8020e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8020eb:	77 21                	ja     80210e <vprintfmt+0x370>
+  8020ed:	89 c2                	mov    %eax,%edx
+  8020ef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020f3:	83 c0 08             	add    $0x8,%eax
+  8020f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020f9:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8020fc:	4d 85 e4             	test   %r12,%r12
+  8020ff:	78 7a                	js     80217b <vprintfmt+0x3dd>
+            num = i;
+  802101:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802104:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802109:	e9 50 02 00 00       	jmp    80235e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80210e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802112:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802116:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80211a:	eb dd                	jmp    8020f9 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80211c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80211f:	83 f8 2f             	cmp    $0x2f,%eax
+  802122:	77 11                	ja     802135 <vprintfmt+0x397>
+  802124:	89 c2                	mov    %eax,%edx
+  802126:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80212a:	83 c0 08             	add    $0x8,%eax
+  80212d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802130:	4c 63 22             	movslq (%rdx),%r12
+  802133:	eb c7                	jmp    8020fc <vprintfmt+0x35e>
+  802135:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802139:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80213d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802141:	eb ed                	jmp    802130 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802143:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802146:	83 f8 2f             	cmp    $0x2f,%eax
+  802149:	77 11                	ja     80215c <vprintfmt+0x3be>
+  80214b:	89 c2                	mov    %eax,%edx
+  80214d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802151:	83 c0 08             	add    $0x8,%eax
+  802154:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802157:	4c 8b 22             	mov    (%rdx),%r12
+  80215a:	eb a0                	jmp    8020fc <vprintfmt+0x35e>
+  80215c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802160:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802164:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802168:	eb ed                	jmp    802157 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80216a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80216e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802172:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802176:	e9 65 ff ff ff       	jmp    8020e0 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80217b:	4c 89 ee             	mov    %r13,%rsi
+  80217e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802183:	41 ff d6             	call   *%r14
+                i = -i;
+  802186:	49 f7 dc             	neg    %r12
+  802189:	e9 73 ff ff ff       	jmp    802101 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80218e:	40 84 f6             	test   %sil,%sil
+  802191:	75 32                	jne    8021c5 <vprintfmt+0x427>
+    switch (lflag) {
+  802193:	85 d2                	test   %edx,%edx
+  802195:	74 5d                	je     8021f4 <vprintfmt+0x456>
+  802197:	83 fa 01             	cmp    $0x1,%edx
+  80219a:	0f 84 82 00 00 00    	je     802222 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8021a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8021a6:	0f 87 a5 00 00 00    	ja     802251 <vprintfmt+0x4b3>
+  8021ac:	89 c2                	mov    %eax,%edx
+  8021ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021b2:	83 c0 08             	add    $0x8,%eax
+  8021b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021b8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021bb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8021c0:	e9 99 01 00 00       	jmp    80235e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8021c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8021cb:	77 19                	ja     8021e6 <vprintfmt+0x448>
+  8021cd:	89 c2                	mov    %eax,%edx
+  8021cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021d3:	83 c0 08             	add    $0x8,%eax
+  8021d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021d9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021dc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8021e1:	e9 78 01 00 00       	jmp    80235e <vprintfmt+0x5c0>
+  8021e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021f2:	eb e5                	jmp    8021d9 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8021f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8021fa:	77 18                	ja     802214 <vprintfmt+0x476>
+  8021fc:	89 c2                	mov    %eax,%edx
+  8021fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802202:	83 c0 08             	add    $0x8,%eax
+  802205:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802208:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80220a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80220f:	e9 4a 01 00 00       	jmp    80235e <vprintfmt+0x5c0>
+  802214:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802218:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80221c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802220:	eb e6                	jmp    802208 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802222:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802225:	83 f8 2f             	cmp    $0x2f,%eax
+  802228:	77 19                	ja     802243 <vprintfmt+0x4a5>
+  80222a:	89 c2                	mov    %eax,%edx
+  80222c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802230:	83 c0 08             	add    $0x8,%eax
+  802233:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802236:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802239:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80223e:	e9 1b 01 00 00       	jmp    80235e <vprintfmt+0x5c0>
+  802243:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802247:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80224b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80224f:	eb e5                	jmp    802236 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802251:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802255:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802259:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80225d:	e9 56 ff ff ff       	jmp    8021b8 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802262:	40 84 f6             	test   %sil,%sil
+  802265:	75 2e                	jne    802295 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802267:	85 d2                	test   %edx,%edx
+  802269:	74 59                	je     8022c4 <vprintfmt+0x526>
+  80226b:	83 fa 01             	cmp    $0x1,%edx
+  80226e:	74 7f                	je     8022ef <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802270:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802273:	83 f8 2f             	cmp    $0x2f,%eax
+  802276:	0f 87 9f 00 00 00    	ja     80231b <vprintfmt+0x57d>
+  80227c:	89 c2                	mov    %eax,%edx
+  80227e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802282:	83 c0 08             	add    $0x8,%eax
+  802285:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802288:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80228b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802290:	e9 c9 00 00 00       	jmp    80235e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802295:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802298:	83 f8 2f             	cmp    $0x2f,%eax
+  80229b:	77 19                	ja     8022b6 <vprintfmt+0x518>
+  80229d:	89 c2                	mov    %eax,%edx
+  80229f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022a3:	83 c0 08             	add    $0x8,%eax
+  8022a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022a9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8022ac:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022b1:	e9 a8 00 00 00       	jmp    80235e <vprintfmt+0x5c0>
+  8022b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022ba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022c2:	eb e5                	jmp    8022a9 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8022c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8022ca:	77 15                	ja     8022e1 <vprintfmt+0x543>
+  8022cc:	89 c2                	mov    %eax,%edx
+  8022ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022d2:	83 c0 08             	add    $0x8,%eax
+  8022d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022d8:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8022da:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8022df:	eb 7d                	jmp    80235e <vprintfmt+0x5c0>
+  8022e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022ed:	eb e9                	jmp    8022d8 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8022ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8022f5:	77 16                	ja     80230d <vprintfmt+0x56f>
+  8022f7:	89 c2                	mov    %eax,%edx
+  8022f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022fd:	83 c0 08             	add    $0x8,%eax
+  802300:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802303:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802306:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80230b:	eb 51                	jmp    80235e <vprintfmt+0x5c0>
+  80230d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802311:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802315:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802319:	eb e8                	jmp    802303 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80231b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80231f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802323:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802327:	e9 5c ff ff ff       	jmp    802288 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80232c:	4c 89 ee             	mov    %r13,%rsi
+  80232f:	bf 30 00 00 00       	mov    $0x30,%edi
+  802334:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802337:	4c 89 ee             	mov    %r13,%rsi
+  80233a:	bf 78 00 00 00       	mov    $0x78,%edi
+  80233f:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802342:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802345:	83 f8 2f             	cmp    $0x2f,%eax
+  802348:	77 47                	ja     802391 <vprintfmt+0x5f3>
+  80234a:	89 c2                	mov    %eax,%edx
+  80234c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802350:	83 c0 08             	add    $0x8,%eax
+  802353:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802356:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802359:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80235e:	48 83 ec 08          	sub    $0x8,%rsp
+  802362:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802366:	0f 94 c0             	sete   %al
+  802369:	0f b6 c0             	movzbl %al,%eax
+  80236c:	50                   	push   %rax
+  80236d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802372:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802376:	4c 89 ee             	mov    %r13,%rsi
+  802379:	4c 89 f7             	mov    %r14,%rdi
+  80237c:	48 b8 93 1c 80 00 00 	movabs $0x801c93,%rax
+  802383:	00 00 00 
+  802386:	ff d0                	call   *%rax
+            break;
+  802388:	48 83 c4 10          	add    $0x10,%rsp
+  80238c:	e9 3e fa ff ff       	jmp    801dcf <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802391:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802395:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802399:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80239d:	eb b7                	jmp    802356 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80239f:	40 84 f6             	test   %sil,%sil
+  8023a2:	75 2b                	jne    8023cf <vprintfmt+0x631>
+    switch (lflag) {
+  8023a4:	85 d2                	test   %edx,%edx
+  8023a6:	74 56                	je     8023fe <vprintfmt+0x660>
+  8023a8:	83 fa 01             	cmp    $0x1,%edx
+  8023ab:	74 7f                	je     80242c <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8023ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8023b3:	0f 87 a2 00 00 00    	ja     80245b <vprintfmt+0x6bd>
+  8023b9:	89 c2                	mov    %eax,%edx
+  8023bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023bf:	83 c0 08             	add    $0x8,%eax
+  8023c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023c5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023c8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023cd:	eb 8f                	jmp    80235e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8023d5:	77 19                	ja     8023f0 <vprintfmt+0x652>
+  8023d7:	89 c2                	mov    %eax,%edx
+  8023d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023dd:	83 c0 08             	add    $0x8,%eax
+  8023e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023e3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023eb:	e9 6e ff ff ff       	jmp    80235e <vprintfmt+0x5c0>
+  8023f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023fc:	eb e5                	jmp    8023e3 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8023fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802401:	83 f8 2f             	cmp    $0x2f,%eax
+  802404:	77 18                	ja     80241e <vprintfmt+0x680>
+  802406:	89 c2                	mov    %eax,%edx
+  802408:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80240c:	83 c0 08             	add    $0x8,%eax
+  80240f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802412:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802414:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802419:	e9 40 ff ff ff       	jmp    80235e <vprintfmt+0x5c0>
+  80241e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802422:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802426:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80242a:	eb e6                	jmp    802412 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80242c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80242f:	83 f8 2f             	cmp    $0x2f,%eax
+  802432:	77 19                	ja     80244d <vprintfmt+0x6af>
+  802434:	89 c2                	mov    %eax,%edx
+  802436:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80243a:	83 c0 08             	add    $0x8,%eax
+  80243d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802440:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802443:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802448:	e9 11 ff ff ff       	jmp    80235e <vprintfmt+0x5c0>
+  80244d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802451:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802455:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802459:	eb e5                	jmp    802440 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80245b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80245f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802463:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802467:	e9 59 ff ff ff       	jmp    8023c5 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80246c:	4c 89 ee             	mov    %r13,%rsi
+  80246f:	bf 25 00 00 00       	mov    $0x25,%edi
+  802474:	41 ff d6             	call   *%r14
+            break;
+  802477:	e9 53 f9 ff ff       	jmp    801dcf <vprintfmt+0x31>
+            putch('%', put_arg);
+  80247c:	4c 89 ee             	mov    %r13,%rsi
+  80247f:	bf 25 00 00 00       	mov    $0x25,%edi
+  802484:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802487:	48 83 eb 01          	sub    $0x1,%rbx
+  80248b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80248f:	75 f6                	jne    802487 <vprintfmt+0x6e9>
+  802491:	e9 39 f9 ff ff       	jmp    801dcf <vprintfmt+0x31>
+}
+  802496:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80249a:	5b                   	pop    %rbx
+  80249b:	41 5c                	pop    %r12
+  80249d:	41 5d                	pop    %r13
+  80249f:	41 5e                	pop    %r14
+  8024a1:	41 5f                	pop    %r15
+  8024a3:	5d                   	pop    %rbp
+  8024a4:	c3                   	ret
+
+00000000008024a5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8024a5:	55                   	push   %rbp
+  8024a6:	48 89 e5             	mov    %rsp,%rbp
+  8024a9:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8024ad:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8024b1:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8024b6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8024ba:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8024c1:	48 85 ff             	test   %rdi,%rdi
+  8024c4:	74 2b                	je     8024f1 <vsnprintf+0x4c>
+  8024c6:	48 85 f6             	test   %rsi,%rsi
+  8024c9:	74 26                	je     8024f1 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8024cb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024cf:	48 bf 49 1d 80 00 00 	movabs $0x801d49,%rdi
+  8024d6:	00 00 00 
+  8024d9:	48 b8 9e 1d 80 00 00 	movabs $0x801d9e,%rax
+  8024e0:	00 00 00 
+  8024e3:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8024e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024e9:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8024ec:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8024ef:	c9                   	leave
+  8024f0:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8024f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024f6:	eb f7                	jmp    8024ef <vsnprintf+0x4a>
+
+00000000008024f8 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8024f8:	55                   	push   %rbp
+  8024f9:	48 89 e5             	mov    %rsp,%rbp
+  8024fc:	48 83 ec 50          	sub    $0x50,%rsp
+  802500:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802504:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802508:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80250c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802513:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802517:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80251b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80251f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802523:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802527:	48 b8 a5 24 80 00 00 	movabs $0x8024a5,%rax
+  80252e:	00 00 00 
+  802531:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802533:	c9                   	leave
+  802534:	c3                   	ret
+
+0000000000802535 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802535:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802538:	74 10                	je     80254a <strlen+0x15>
+    size_t n = 0;
+  80253a:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80253f:	48 83 c0 01          	add    $0x1,%rax
+  802543:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802547:	75 f6                	jne    80253f <strlen+0xa>
+  802549:	c3                   	ret
+    size_t n = 0;
+  80254a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80254f:	c3                   	ret
+
+0000000000802550 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802550:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802553:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802558:	48 85 f6             	test   %rsi,%rsi
+  80255b:	74 11                	je     80256e <strnlen+0x1e>
+  80255d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802561:	74 0c                	je     80256f <strnlen+0x1f>
+  802563:	48 83 c2 01          	add    $0x1,%rdx
+  802567:	48 39 d0             	cmp    %rdx,%rax
+  80256a:	75 f1                	jne    80255d <strnlen+0xd>
+  80256c:	eb 04                	jmp    802572 <strnlen+0x22>
+  80256e:	c3                   	ret
+  80256f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802572:	c3                   	ret
+
+0000000000802573 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802573:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802576:	ba 00 00 00 00       	mov    $0x0,%edx
+  80257b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80257f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802582:	48 83 c2 01          	add    $0x1,%rdx
+  802586:	84 c9                	test   %cl,%cl
+  802588:	75 f1                	jne    80257b <strcpy+0x8>
+        ;
+    return res;
+}
+  80258a:	c3                   	ret
+
+000000000080258b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80258b:	55                   	push   %rbp
+  80258c:	48 89 e5             	mov    %rsp,%rbp
+  80258f:	41 54                	push   %r12
+  802591:	53                   	push   %rbx
+  802592:	48 89 fb             	mov    %rdi,%rbx
+  802595:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802598:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  80259f:	00 00 00 
+  8025a2:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8025a4:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8025a8:	4c 89 e6             	mov    %r12,%rsi
+  8025ab:	48 b8 73 25 80 00 00 	movabs $0x802573,%rax
+  8025b2:	00 00 00 
+  8025b5:	ff d0                	call   *%rax
+    return dst;
+}
+  8025b7:	48 89 d8             	mov    %rbx,%rax
+  8025ba:	5b                   	pop    %rbx
+  8025bb:	41 5c                	pop    %r12
+  8025bd:	5d                   	pop    %rbp
+  8025be:	c3                   	ret
+
+00000000008025bf <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8025bf:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8025c2:	48 85 d2             	test   %rdx,%rdx
+  8025c5:	74 1f                	je     8025e6 <strncpy+0x27>
+  8025c7:	48 01 fa             	add    %rdi,%rdx
+  8025ca:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8025cd:	48 83 c1 01          	add    $0x1,%rcx
+  8025d1:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8025d5:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8025d9:	41 80 f8 01          	cmp    $0x1,%r8b
+  8025dd:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8025e1:	48 39 ca             	cmp    %rcx,%rdx
+  8025e4:	75 e7                	jne    8025cd <strncpy+0xe>
+    }
+    return ret;
+}
+  8025e6:	c3                   	ret
+
+00000000008025e7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8025e7:	48 89 f8             	mov    %rdi,%rax
+  8025ea:	48 85 d2             	test   %rdx,%rdx
+  8025ed:	74 24                	je     802613 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8025ef:	48 83 ea 01          	sub    $0x1,%rdx
+  8025f3:	74 1b                	je     802610 <strlcpy+0x29>
+  8025f5:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8025f9:	0f b6 16             	movzbl (%rsi),%edx
+  8025fc:	84 d2                	test   %dl,%dl
+  8025fe:	74 10                	je     802610 <strlcpy+0x29>
+            *dst++ = *src++;
+  802600:	48 83 c6 01          	add    $0x1,%rsi
+  802604:	48 83 c0 01          	add    $0x1,%rax
+  802608:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80260b:	48 39 c8             	cmp    %rcx,%rax
+  80260e:	75 e9                	jne    8025f9 <strlcpy+0x12>
+        *dst = '\0';
+  802610:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802613:	48 29 f8             	sub    %rdi,%rax
+}
+  802616:	c3                   	ret
+
+0000000000802617 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802617:	0f b6 07             	movzbl (%rdi),%eax
+  80261a:	84 c0                	test   %al,%al
+  80261c:	74 13                	je     802631 <strcmp+0x1a>
+  80261e:	38 06                	cmp    %al,(%rsi)
+  802620:	75 0f                	jne    802631 <strcmp+0x1a>
+  802622:	48 83 c7 01          	add    $0x1,%rdi
+  802626:	48 83 c6 01          	add    $0x1,%rsi
+  80262a:	0f b6 07             	movzbl (%rdi),%eax
+  80262d:	84 c0                	test   %al,%al
+  80262f:	75 ed                	jne    80261e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802631:	0f b6 c0             	movzbl %al,%eax
+  802634:	0f b6 16             	movzbl (%rsi),%edx
+  802637:	29 d0                	sub    %edx,%eax
+}
+  802639:	c3                   	ret
+
+000000000080263a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80263a:	48 85 d2             	test   %rdx,%rdx
+  80263d:	74 1f                	je     80265e <strncmp+0x24>
+  80263f:	0f b6 07             	movzbl (%rdi),%eax
+  802642:	84 c0                	test   %al,%al
+  802644:	74 1e                	je     802664 <strncmp+0x2a>
+  802646:	3a 06                	cmp    (%rsi),%al
+  802648:	75 1a                	jne    802664 <strncmp+0x2a>
+  80264a:	48 83 c7 01          	add    $0x1,%rdi
+  80264e:	48 83 c6 01          	add    $0x1,%rsi
+  802652:	48 83 ea 01          	sub    $0x1,%rdx
+  802656:	75 e7                	jne    80263f <strncmp+0x5>
+
+    if (!n) return 0;
+  802658:	b8 00 00 00 00       	mov    $0x0,%eax
+  80265d:	c3                   	ret
+  80265e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802663:	c3                   	ret
+  802664:	48 85 d2             	test   %rdx,%rdx
+  802667:	74 09                	je     802672 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802669:	0f b6 07             	movzbl (%rdi),%eax
+  80266c:	0f b6 16             	movzbl (%rsi),%edx
+  80266f:	29 d0                	sub    %edx,%eax
+  802671:	c3                   	ret
+    if (!n) return 0;
+  802672:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802677:	c3                   	ret
+
+0000000000802678 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802678:	0f b6 17             	movzbl (%rdi),%edx
+  80267b:	84 d2                	test   %dl,%dl
+  80267d:	74 18                	je     802697 <strchr+0x1f>
+        if (*str == c) {
+  80267f:	0f be d2             	movsbl %dl,%edx
+  802682:	39 f2                	cmp    %esi,%edx
+  802684:	74 17                	je     80269d <strchr+0x25>
+    for (; *str; str++) {
+  802686:	48 83 c7 01          	add    $0x1,%rdi
+  80268a:	0f b6 17             	movzbl (%rdi),%edx
+  80268d:	84 d2                	test   %dl,%dl
+  80268f:	75 ee                	jne    80267f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802691:	b8 00 00 00 00       	mov    $0x0,%eax
+  802696:	c3                   	ret
+  802697:	b8 00 00 00 00       	mov    $0x0,%eax
+  80269c:	c3                   	ret
+  80269d:	48 89 f8             	mov    %rdi,%rax
+}
+  8026a0:	c3                   	ret
+
+00000000008026a1 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8026a1:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8026a4:	0f b6 17             	movzbl (%rdi),%edx
+  8026a7:	84 d2                	test   %dl,%dl
+  8026a9:	74 13                	je     8026be <strfind+0x1d>
+  8026ab:	0f be d2             	movsbl %dl,%edx
+  8026ae:	39 f2                	cmp    %esi,%edx
+  8026b0:	74 0b                	je     8026bd <strfind+0x1c>
+  8026b2:	48 83 c0 01          	add    $0x1,%rax
+  8026b6:	0f b6 10             	movzbl (%rax),%edx
+  8026b9:	84 d2                	test   %dl,%dl
+  8026bb:	75 ee                	jne    8026ab <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8026bd:	c3                   	ret
+  8026be:	c3                   	ret
+
+00000000008026bf <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8026bf:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8026c2:	48 89 f8             	mov    %rdi,%rax
+  8026c5:	48 f7 d8             	neg    %rax
+  8026c8:	83 e0 07             	and    $0x7,%eax
+  8026cb:	49 89 d1             	mov    %rdx,%r9
+  8026ce:	49 29 c1             	sub    %rax,%r9
+  8026d1:	78 36                	js     802709 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8026d3:	40 0f b6 c6          	movzbl %sil,%eax
+  8026d7:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8026de:	01 01 01 
+  8026e1:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8026e5:	40 f6 c7 07          	test   $0x7,%dil
+  8026e9:	75 38                	jne    802723 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8026eb:	4c 89 c9             	mov    %r9,%rcx
+  8026ee:	48 c1 f9 03          	sar    $0x3,%rcx
+  8026f2:	74 0c                	je     802700 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8026f4:	fc                   	cld
+  8026f5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8026f8:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8026fc:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802700:	4d 85 c9             	test   %r9,%r9
+  802703:	75 45                	jne    80274a <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802705:	4c 89 c0             	mov    %r8,%rax
+  802708:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802709:	48 85 d2             	test   %rdx,%rdx
+  80270c:	74 f7                	je     802705 <memset+0x46>
+  80270e:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802711:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802714:	48 83 c0 01          	add    $0x1,%rax
+  802718:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80271c:	48 39 c2             	cmp    %rax,%rdx
+  80271f:	75 f3                	jne    802714 <memset+0x55>
+  802721:	eb e2                	jmp    802705 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802723:	40 f6 c7 01          	test   $0x1,%dil
+  802727:	74 06                	je     80272f <memset+0x70>
+  802729:	88 07                	mov    %al,(%rdi)
+  80272b:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80272f:	40 f6 c7 02          	test   $0x2,%dil
+  802733:	74 07                	je     80273c <memset+0x7d>
+  802735:	66 89 07             	mov    %ax,(%rdi)
+  802738:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80273c:	40 f6 c7 04          	test   $0x4,%dil
+  802740:	74 a9                	je     8026eb <memset+0x2c>
+  802742:	89 07                	mov    %eax,(%rdi)
+  802744:	48 83 c7 04          	add    $0x4,%rdi
+  802748:	eb a1                	jmp    8026eb <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80274a:	41 f6 c1 04          	test   $0x4,%r9b
+  80274e:	74 06                	je     802756 <memset+0x97>
+  802750:	89 07                	mov    %eax,(%rdi)
+  802752:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802756:	41 f6 c1 02          	test   $0x2,%r9b
+  80275a:	74 07                	je     802763 <memset+0xa4>
+  80275c:	66 89 07             	mov    %ax,(%rdi)
+  80275f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802763:	41 f6 c1 01          	test   $0x1,%r9b
+  802767:	74 9c                	je     802705 <memset+0x46>
+  802769:	88 07                	mov    %al,(%rdi)
+  80276b:	eb 98                	jmp    802705 <memset+0x46>
+
+000000000080276d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80276d:	48 89 f8             	mov    %rdi,%rax
+  802770:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802773:	48 39 fe             	cmp    %rdi,%rsi
+  802776:	73 3b                	jae    8027b3 <memmove+0x46>
+  802778:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80277c:	48 39 d7             	cmp    %rdx,%rdi
+  80277f:	73 32                	jae    8027b3 <memmove+0x46>
+        s += n;
+        d += n;
+  802781:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802785:	48 89 d6             	mov    %rdx,%rsi
+  802788:	48 09 fe             	or     %rdi,%rsi
+  80278b:	48 09 ce             	or     %rcx,%rsi
+  80278e:	40 f6 c6 07          	test   $0x7,%sil
+  802792:	75 12                	jne    8027a6 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802794:	48 83 ef 08          	sub    $0x8,%rdi
+  802798:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80279c:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027a0:	fd                   	std
+  8027a1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8027a4:	fc                   	cld
+  8027a5:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8027a6:	48 83 ef 01          	sub    $0x1,%rdi
+  8027aa:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8027ae:	fd                   	std
+  8027af:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8027b1:	eb f1                	jmp    8027a4 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8027b3:	48 89 f2             	mov    %rsi,%rdx
+  8027b6:	48 09 c2             	or     %rax,%rdx
+  8027b9:	48 09 ca             	or     %rcx,%rdx
+  8027bc:	f6 c2 07             	test   $0x7,%dl
+  8027bf:	75 0c                	jne    8027cd <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8027c1:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027c5:	48 89 c7             	mov    %rax,%rdi
+  8027c8:	fc                   	cld
+  8027c9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8027cc:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8027cd:	48 89 c7             	mov    %rax,%rdi
+  8027d0:	fc                   	cld
+  8027d1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8027d3:	c3                   	ret
+
+00000000008027d4 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8027d4:	55                   	push   %rbp
+  8027d5:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8027d8:	48 b8 6d 27 80 00 00 	movabs $0x80276d,%rax
+  8027df:	00 00 00 
+  8027e2:	ff d0                	call   *%rax
+}
+  8027e4:	5d                   	pop    %rbp
+  8027e5:	c3                   	ret
+
+00000000008027e6 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8027e6:	55                   	push   %rbp
+  8027e7:	48 89 e5             	mov    %rsp,%rbp
+  8027ea:	41 57                	push   %r15
+  8027ec:	41 56                	push   %r14
+  8027ee:	41 55                	push   %r13
+  8027f0:	41 54                	push   %r12
+  8027f2:	53                   	push   %rbx
+  8027f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8027f7:	49 89 fe             	mov    %rdi,%r14
+  8027fa:	49 89 f7             	mov    %rsi,%r15
+  8027fd:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802800:	48 89 f7             	mov    %rsi,%rdi
+  802803:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  80280a:	00 00 00 
+  80280d:	ff d0                	call   *%rax
+  80280f:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802812:	48 89 de             	mov    %rbx,%rsi
+  802815:	4c 89 f7             	mov    %r14,%rdi
+  802818:	48 b8 50 25 80 00 00 	movabs $0x802550,%rax
+  80281f:	00 00 00 
+  802822:	ff d0                	call   *%rax
+  802824:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802827:	48 39 c3             	cmp    %rax,%rbx
+  80282a:	74 36                	je     802862 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80282c:	48 89 d8             	mov    %rbx,%rax
+  80282f:	4c 29 e8             	sub    %r13,%rax
+  802832:	49 39 c4             	cmp    %rax,%r12
+  802835:	73 31                	jae    802868 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802837:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80283c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802840:	4c 89 fe             	mov    %r15,%rsi
+  802843:	48 b8 d4 27 80 00 00 	movabs $0x8027d4,%rax
+  80284a:	00 00 00 
+  80284d:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80284f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802853:	48 83 c4 08          	add    $0x8,%rsp
+  802857:	5b                   	pop    %rbx
+  802858:	41 5c                	pop    %r12
+  80285a:	41 5d                	pop    %r13
+  80285c:	41 5e                	pop    %r14
+  80285e:	41 5f                	pop    %r15
+  802860:	5d                   	pop    %rbp
+  802861:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802862:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802866:	eb eb                	jmp    802853 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802868:	48 83 eb 01          	sub    $0x1,%rbx
+  80286c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802870:	48 89 da             	mov    %rbx,%rdx
+  802873:	4c 89 fe             	mov    %r15,%rsi
+  802876:	48 b8 d4 27 80 00 00 	movabs $0x8027d4,%rax
+  80287d:	00 00 00 
+  802880:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802882:	49 01 de             	add    %rbx,%r14
+  802885:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80288a:	eb c3                	jmp    80284f <strlcat+0x69>
+
+000000000080288c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80288c:	48 85 d2             	test   %rdx,%rdx
+  80288f:	74 2d                	je     8028be <memcmp+0x32>
+  802891:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802896:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80289a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80289f:	44 38 c1             	cmp    %r8b,%cl
+  8028a2:	75 0f                	jne    8028b3 <memcmp+0x27>
+    while (n-- > 0) {
+  8028a4:	48 83 c0 01          	add    $0x1,%rax
+  8028a8:	48 39 c2             	cmp    %rax,%rdx
+  8028ab:	75 e9                	jne    802896 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8028ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b2:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8028b3:	0f b6 c1             	movzbl %cl,%eax
+  8028b6:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8028ba:	44 29 c0             	sub    %r8d,%eax
+  8028bd:	c3                   	ret
+    return 0;
+  8028be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028c3:	c3                   	ret
+
+00000000008028c4 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8028c4:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8028c8:	48 39 c7             	cmp    %rax,%rdi
+  8028cb:	73 0f                	jae    8028dc <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8028cd:	40 38 37             	cmp    %sil,(%rdi)
+  8028d0:	74 0e                	je     8028e0 <memfind+0x1c>
+    for (; src < end; src++) {
+  8028d2:	48 83 c7 01          	add    $0x1,%rdi
+  8028d6:	48 39 f8             	cmp    %rdi,%rax
+  8028d9:	75 f2                	jne    8028cd <memfind+0x9>
+  8028db:	c3                   	ret
+  8028dc:	48 89 f8             	mov    %rdi,%rax
+  8028df:	c3                   	ret
+  8028e0:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8028e3:	c3                   	ret
+
+00000000008028e4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8028e4:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8028e7:	0f b6 37             	movzbl (%rdi),%esi
+  8028ea:	40 80 fe 20          	cmp    $0x20,%sil
+  8028ee:	74 06                	je     8028f6 <strtol+0x12>
+  8028f0:	40 80 fe 09          	cmp    $0x9,%sil
+  8028f4:	75 13                	jne    802909 <strtol+0x25>
+  8028f6:	48 83 c7 01          	add    $0x1,%rdi
+  8028fa:	0f b6 37             	movzbl (%rdi),%esi
+  8028fd:	40 80 fe 20          	cmp    $0x20,%sil
+  802901:	74 f3                	je     8028f6 <strtol+0x12>
+  802903:	40 80 fe 09          	cmp    $0x9,%sil
+  802907:	74 ed                	je     8028f6 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802909:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80290c:	83 e0 fd             	and    $0xfffffffd,%eax
+  80290f:	3c 01                	cmp    $0x1,%al
+  802911:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802915:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80291b:	75 0f                	jne    80292c <strtol+0x48>
+  80291d:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802920:	74 14                	je     802936 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802922:	85 d2                	test   %edx,%edx
+  802924:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802929:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80292c:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802931:	4c 63 ca             	movslq %edx,%r9
+  802934:	eb 36                	jmp    80296c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802936:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80293a:	74 0f                	je     80294b <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80293c:	85 d2                	test   %edx,%edx
+  80293e:	75 ec                	jne    80292c <strtol+0x48>
+        s++;
+  802940:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802944:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802949:	eb e1                	jmp    80292c <strtol+0x48>
+        s += 2;
+  80294b:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80294f:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802954:	eb d6                	jmp    80292c <strtol+0x48>
+            dig -= '0';
+  802956:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802959:	44 0f b6 c1          	movzbl %cl,%r8d
+  80295d:	41 39 d0             	cmp    %edx,%r8d
+  802960:	7d 21                	jge    802983 <strtol+0x9f>
+        val = val * base + dig;
+  802962:	49 0f af c1          	imul   %r9,%rax
+  802966:	0f b6 c9             	movzbl %cl,%ecx
+  802969:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80296c:	48 83 c7 01          	add    $0x1,%rdi
+  802970:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802974:	80 f9 39             	cmp    $0x39,%cl
+  802977:	76 dd                	jbe    802956 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802979:	80 f9 7b             	cmp    $0x7b,%cl
+  80297c:	77 05                	ja     802983 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80297e:	83 e9 57             	sub    $0x57,%ecx
+  802981:	eb d6                	jmp    802959 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802983:	4d 85 d2             	test   %r10,%r10
+  802986:	74 03                	je     80298b <strtol+0xa7>
+  802988:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80298b:	48 89 c2             	mov    %rax,%rdx
+  80298e:	48 f7 da             	neg    %rdx
+  802991:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802995:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802999:	c3                   	ret
+
+000000000080299a <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80299a:	55                   	push   %rbp
+  80299b:	48 89 e5             	mov    %rsp,%rbp
+  80299e:	41 54                	push   %r12
+  8029a0:	53                   	push   %rbx
+  8029a1:	48 89 fb             	mov    %rdi,%rbx
+  8029a4:	48 89 f7             	mov    %rsi,%rdi
+  8029a7:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8029aa:	48 85 f6             	test   %rsi,%rsi
+  8029ad:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029b4:	00 00 00 
+  8029b7:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8029bb:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029c0:	48 b8 f3 05 80 00 00 	movabs $0x8005f3,%rax
+  8029c7:	00 00 00 
+  8029ca:	ff d0                	call   *%rax
+    if (res < 0) {
+  8029cc:	85 c0                	test   %eax,%eax
+  8029ce:	78 45                	js     802a15 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8029d0:	48 85 db             	test   %rbx,%rbx
+  8029d3:	74 12                	je     8029e7 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8029d5:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029dc:	00 00 00 
+  8029df:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8029e5:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  8029e7:	4d 85 e4             	test   %r12,%r12
+  8029ea:	74 14                	je     802a00 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  8029ec:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029f3:	00 00 00 
+  8029f6:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8029fc:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802a00:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a07:	00 00 00 
+  802a0a:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802a10:	5b                   	pop    %rbx
+  802a11:	41 5c                	pop    %r12
+  802a13:	5d                   	pop    %rbp
+  802a14:	c3                   	ret
+        if (from_env_store)
+  802a15:	48 85 db             	test   %rbx,%rbx
+  802a18:	74 06                	je     802a20 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802a1a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802a20:	4d 85 e4             	test   %r12,%r12
+  802a23:	74 eb                	je     802a10 <ipc_recv+0x76>
+            *perm_store = 0;
+  802a25:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802a2c:	00 
+  802a2d:	eb e1                	jmp    802a10 <ipc_recv+0x76>
+
+0000000000802a2f <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802a2f:	55                   	push   %rbp
+  802a30:	48 89 e5             	mov    %rsp,%rbp
+  802a33:	41 57                	push   %r15
+  802a35:	41 56                	push   %r14
+  802a37:	41 55                	push   %r13
+  802a39:	41 54                	push   %r12
+  802a3b:	53                   	push   %rbx
+  802a3c:	48 83 ec 18          	sub    $0x18,%rsp
+  802a40:	41 89 fd             	mov    %edi,%r13d
+  802a43:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802a46:	48 89 d3             	mov    %rdx,%rbx
+  802a49:	49 89 cc             	mov    %rcx,%r12
+  802a4c:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a50:	48 85 d2             	test   %rdx,%rdx
+  802a53:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a5a:	00 00 00 
+  802a5d:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a61:	49 be c7 05 80 00 00 	movabs $0x8005c7,%r14
+  802a68:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802a6b:	49 bf fa 01 80 00 00 	movabs $0x8001fa,%r15
+  802a72:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a75:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802a78:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802a7c:	4c 89 e1             	mov    %r12,%rcx
+  802a7f:	48 89 da             	mov    %rbx,%rdx
+  802a82:	44 89 ef             	mov    %r13d,%edi
+  802a85:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802a88:	85 c0                	test   %eax,%eax
+  802a8a:	74 34                	je     802ac0 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802a8c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802a8f:	75 05                	jne    802a96 <ipc_send+0x67>
+        sys_yield();
+  802a91:	41 ff d7             	call   *%r15
+    while (true) {
+  802a94:	eb df                	jmp    802a75 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802a96:	48 ba cf 31 80 00 00 	movabs $0x8031cf,%rdx
+  802a9d:	00 00 00 
+  802aa0:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802aa5:	48 bf e8 31 80 00 00 	movabs $0x8031e8,%rdi
+  802aac:	00 00 00 
+  802aaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab4:	48 b9 fe 1a 80 00 00 	movabs $0x801afe,%rcx
+  802abb:	00 00 00 
+  802abe:	ff d1                	call   *%rcx
+    }
+}
+  802ac0:	48 83 c4 18          	add    $0x18,%rsp
+  802ac4:	5b                   	pop    %rbx
+  802ac5:	41 5c                	pop    %r12
+  802ac7:	41 5d                	pop    %r13
+  802ac9:	41 5e                	pop    %r14
+  802acb:	41 5f                	pop    %r15
+  802acd:	5d                   	pop    %rbp
+  802ace:	c3                   	ret
+
+0000000000802acf <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802acf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802ad4:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802adb:	00 00 00 
+  802ade:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802ae5:	48 01 ca             	add    %rcx,%rdx
+  802ae8:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802aee:	39 fa                	cmp    %edi,%edx
+  802af0:	74 12                	je     802b04 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802af2:	48 83 c0 01          	add    $0x1,%rax
+  802af6:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802afc:	75 e0                	jne    802ade <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802afe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b03:	c3                   	ret
+            return envs[i].env_id;
+  802b04:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802b0b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b12:	00 00 00 
+  802b15:	48 01 d0             	add    %rdx,%rax
+  802b18:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b1e:	c3                   	ret
+  802b1f:	90                   	nop
+
+0000000000802b20 <__rodata_start>:
+  802b20:	3c 75                	cmp    $0x75,%al
+  802b22:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b23:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b27:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b28:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802b2c:	1f                   	(bad)
+  802b2d:	44 00 00             	add    %r8b,(%rax)
+  802b30:	73 79                	jae    802bab <__rodata_start+0x8b>
+  802b32:	73 63                	jae    802b97 <__rodata_start+0x77>
+  802b34:	61                   	(bad)
+  802b35:	6c                   	insb   (%dx),%es:(%rdi)
+  802b36:	6c                   	insb   (%dx),%es:(%rdi)
+  802b37:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a08fb7 <__bss_end+0x72200fb7>
+  802b3d:	65 74 75             	gs je  802bb5 <__rodata_start+0x95>
+  802b40:	72 6e                	jb     802bb0 <__rodata_start+0x90>
+  802b42:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a08fc4 <__bss_end+0x28200fc4>
+  802b49:	28 
+  802b4a:	3e 20 30             	ds and %dh,(%rax)
+  802b4d:	29 00                	sub    %eax,(%rax)
+  802b4f:	6c                   	insb   (%dx),%es:(%rdi)
+  802b50:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802b57:	61                   	(bad)
+  802b58:	6c                   	insb   (%dx),%es:(%rdi)
+  802b59:	6c                   	insb   (%dx),%es:(%rdi)
+  802b5a:	2e 63 00             	cs movsxd (%rax),%eax
+  802b5d:	0f 1f 00             	nopl   (%rax)
+  802b60:	5b                   	pop    %rbx
+  802b61:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b66:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802b69:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b6d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b6e:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802b72:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802b79:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 8035e4 <error_string+0x4e4>
+  802b80:	5b                   	pop    %rbx
+  802b81:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b86:	20 66 74             	and    %ah,0x74(%rsi)
+  802b89:	72 75                	jb     802c00 <devtab+0x20>
+  802b8b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b8c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802b8f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4bfa <__bss_end+0x2d2ccbfa>
+  802b96:	20 62 61             	and    %ah,0x61(%rdx)
+  802b99:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802b9d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802ba1:	5b                   	pop    %rbx
+  802ba2:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802ba7:	20 72 65             	and    %dh,0x65(%rdx)
+  802baa:	61                   	(bad)
+  802bab:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4c16 <__bss_end+0x2d2ccc16>
+  802bb2:	20 62 61             	and    %ah,0x61(%rdx)
+  802bb5:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802bb9:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bbd:	5b                   	pop    %rbx
+  802bbe:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802bc3:	20 77 72             	and    %dh,0x72(%rdi)
+  802bc6:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802bcd:	2d 
+  802bce:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802bd3:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802bd6:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bda:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802be0 <devtab>:
+  802be0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802bf0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802c00:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802c10:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802c20:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802c30:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802c40:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802c50:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802c60:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802c70:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802c80:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802c90:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802ca0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802cb0:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802cc0:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802cd0:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802ce0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802cf0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802d00:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802d10:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802d20:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802d30:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802d40:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802d50:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802d60:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802d70:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802d80:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802d90:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802da0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802db0:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802dc0:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802dd0:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802de0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802df0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802e00:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802e10:	64 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     d.operation not 
+  802e20:	70 65 72 6d 69 74 74 65 64 00 66 2e 0f 1f 84 00     permitted.f.....
+  802e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
+  802e40:	3b 1e 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     ;.......|$......
+  802e50:	6c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     l$......|$......
+  802e60:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  802e70:	7c 24 80 00 00 00 00 00 5a 1e 80 00 00 00 00 00     |$......Z.......
+  802e80:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  802e90:	4e 1e 80 00 00 00 00 00 c8 1e 80 00 00 00 00 00     N...............
+  802ea0:	7c 24 80 00 00 00 00 00 4e 1e 80 00 00 00 00 00     |$......N.......
+  802eb0:	94 1e 80 00 00 00 00 00 94 1e 80 00 00 00 00 00     ................
+  802ec0:	94 1e 80 00 00 00 00 00 94 1e 80 00 00 00 00 00     ................
+  802ed0:	94 1e 80 00 00 00 00 00 94 1e 80 00 00 00 00 00     ................
+  802ee0:	94 1e 80 00 00 00 00 00 94 1e 80 00 00 00 00 00     ................
+  802ef0:	94 1e 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     ........|$......
+  802f00:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  802f10:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  802f20:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  802f30:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  802f40:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  802f50:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  802f60:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  802f70:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  802f80:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  802f90:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  802fa0:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  802fb0:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  802fc0:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  802fd0:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  802fe0:	7c 24 80 00 00 00 00 00 9f 23 80 00 00 00 00 00     |$.......#......
+  802ff0:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  803000:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  803010:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  803020:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  803030:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  803040:	eb 1e 80 00 00 00 00 00 ba 20 80 00 00 00 00 00     ......... ......
+  803050:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  803060:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  803070:	1a 1f 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     ........|$......
+  803080:	7c 24 80 00 00 00 00 00 e0 1e 80 00 00 00 00 00     |$..............
+  803090:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  8030a0:	62 22 80 00 00 00 00 00 2c 23 80 00 00 00 00 00     b"......,#......
+  8030b0:	7c 24 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     |$......|$......
+  8030c0:	b1 1f 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     ........|$......
+  8030d0:	8e 21 80 00 00 00 00 00 7c 24 80 00 00 00 00 00     .!......|$......
+  8030e0:	7c 24 80 00 00 00 00 00 9f 23 80 00 00 00 00 00     |$.......#......
+  8030f0:	7c 24 80 00 00 00 00 00 44 1e 80 00 00 00 00 00     |$......D.......
+
+0000000000803100 <error_string>:
+	...
+  803108:	b5 2c 80 00 00 00 00 00 c7 2c 80 00 00 00 00 00     .,.......,......
+  803118:	d7 2c 80 00 00 00 00 00 e9 2c 80 00 00 00 00 00     .,.......,......
+  803128:	f7 2c 80 00 00 00 00 00 0b 2d 80 00 00 00 00 00     .,.......-......
+  803138:	20 2d 80 00 00 00 00 00 33 2d 80 00 00 00 00 00      -......3-......
+  803148:	45 2d 80 00 00 00 00 00 59 2d 80 00 00 00 00 00     E-......Y-......
+  803158:	69 2d 80 00 00 00 00 00 7c 2d 80 00 00 00 00 00     i-......|-......
+  803168:	93 2d 80 00 00 00 00 00 a9 2d 80 00 00 00 00 00     .-.......-......
+  803178:	c1 2d 80 00 00 00 00 00 d9 2d 80 00 00 00 00 00     .-.......-......
+  803188:	e6 2d 80 00 00 00 00 00 b0 31 80 00 00 00 00 00     .-.......1......
+  803198:	fa 2d 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .-..............
+  8031a8:	12 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ........file is 
+  8031b8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8031c8:	75 74 61 62 6c 65 00 69 70 63 5f 73 65 6e 64 3a     utable.ipc_send:
+  8031d8:	20 66 61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00      failed to send.
+  8031e8:	6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00     lib/ipc.c.f.....
+  8031f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803208:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803218:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803228:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803238:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803248:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803258:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803268:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803278:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803288:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803298:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8032e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803308:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803318:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803328:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803338:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803348:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803358:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803368:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803378:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803388:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803398:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803408:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803418:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803428:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803438:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803448:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803458:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803468:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803478:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803488:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803498:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803508:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803518:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803528:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803538:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803548:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803558:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803568:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803578:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803588:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803598:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803608:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803618:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803628:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803638:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803648:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803658:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803668:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803678:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803688:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803698:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803708:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803718:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803728:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803738:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803748:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803758:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803768:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803778:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803788:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803798:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803808:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803818:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803828:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803838:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803848:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803858:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803868:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803878:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803888:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803898:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803908:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803918:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803928:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803938:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803948:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803958:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803968:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803978:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803988:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803998:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803aa8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ab8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ac8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ad8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ae8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803af8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ba8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bb8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bc8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bd8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803be8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bf8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ca8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cb8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cc8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cd8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ce8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cf8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803da8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803db8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dc8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dd8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803de8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803df8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ea8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803eb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ec8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ed8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ee8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ef8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fa8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fe8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ff8:	0f 1f 84 00 00 00 00 00                             ........
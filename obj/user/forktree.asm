@@ -0,0 +1,5831 @@
+
+obj/user/forktree:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ff 00 00 00       	call   800122 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <forktree>:
+        exit();
+    }
+}
+
+void
+forktree(const char *cur) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 54                	push   %r12
+  80002b:	53                   	push   %rbx
+  80002c:	48 89 fb             	mov    %rdi,%rbx
+    cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80002f:	48 b8 ae 10 80 00 00 	movabs $0x8010ae,%rax
+  800036:	00 00 00 
+  800039:	ff d0                	call   *%rax
+  80003b:	89 c6                	mov    %eax,%esi
+  80003d:	48 89 da             	mov    %rbx,%rdx
+  800040:	48 bf 10 2d 80 00 00 	movabs $0x802d10,%rdi
+  800047:	00 00 00 
+  80004a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004f:	48 b9 99 02 80 00 00 	movabs $0x800299,%rcx
+  800056:	00 00 00 
+  800059:	ff d1                	call   *%rcx
+
+    forkchild(cur, '0');
+  80005b:	be 30 00 00 00       	mov    $0x30,%esi
+  800060:	48 89 df             	mov    %rbx,%rdi
+  800063:	49 bc 80 00 80 00 00 	movabs $0x800080,%r12
+  80006a:	00 00 00 
+  80006d:	41 ff d4             	call   *%r12
+    forkchild(cur, '1');
+  800070:	be 31 00 00 00       	mov    $0x31,%esi
+  800075:	48 89 df             	mov    %rbx,%rdi
+  800078:	41 ff d4             	call   *%r12
+}
+  80007b:	5b                   	pop    %rbx
+  80007c:	41 5c                	pop    %r12
+  80007e:	5d                   	pop    %rbp
+  80007f:	c3                   	ret
+
+0000000000800080 <forkchild>:
+forkchild(const char *cur, char branch) {
+  800080:	55                   	push   %rbp
+  800081:	48 89 e5             	mov    %rsp,%rbp
+  800084:	41 54                	push   %r12
+  800086:	53                   	push   %rbx
+  800087:	48 83 ec 10          	sub    $0x10,%rsp
+  80008b:	48 89 fb             	mov    %rdi,%rbx
+  80008e:	41 89 f4             	mov    %esi,%r12d
+    if (strlen(cur) >= DEPTH)
+  800091:	48 b8 80 0b 80 00 00 	movabs $0x800b80,%rax
+  800098:	00 00 00 
+  80009b:	ff d0                	call   *%rax
+  80009d:	48 83 f8 02          	cmp    $0x2,%rax
+  8000a1:	76 09                	jbe    8000ac <forkchild+0x2c>
+}
+  8000a3:	48 83 c4 10          	add    $0x10,%rsp
+  8000a7:	5b                   	pop    %rbx
+  8000a8:	41 5c                	pop    %r12
+  8000aa:	5d                   	pop    %rbp
+  8000ab:	c3                   	ret
+    snprintf(nxt, DEPTH + 1, "%s%c", cur, branch);
+  8000ac:	45 0f be c4          	movsbl %r12b,%r8d
+  8000b0:	48 89 d9             	mov    %rbx,%rcx
+  8000b3:	48 ba 21 2d 80 00 00 	movabs $0x802d21,%rdx
+  8000ba:	00 00 00 
+  8000bd:	be 04 00 00 00       	mov    $0x4,%esi
+  8000c2:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8000c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000cb:	49 b9 43 0b 80 00 00 	movabs $0x800b43,%r9
+  8000d2:	00 00 00 
+  8000d5:	41 ff d1             	call   *%r9
+    if (fork() == 0) {
+  8000d8:	48 b8 10 17 80 00 00 	movabs $0x801710,%rax
+  8000df:	00 00 00 
+  8000e2:	ff d0                	call   *%rax
+  8000e4:	85 c0                	test   %eax,%eax
+  8000e6:	75 bb                	jne    8000a3 <forkchild+0x23>
+        forktree(nxt);
+  8000e8:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8000ec:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+        exit();
+  8000f8:	48 b8 c9 01 80 00 00 	movabs $0x8001c9,%rax
+  8000ff:	00 00 00 
+  800102:	ff d0                	call   *%rax
+  800104:	eb 9d                	jmp    8000a3 <forkchild+0x23>
+
+0000000000800106 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800106:	55                   	push   %rbp
+  800107:	48 89 e5             	mov    %rsp,%rbp
+    forktree("");
+  80010a:	48 bf 20 2d 80 00 00 	movabs $0x802d20,%rdi
+  800111:	00 00 00 
+  800114:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80011b:	00 00 00 
+  80011e:	ff d0                	call   *%rax
+}
+  800120:	5d                   	pop    %rbp
+  800121:	c3                   	ret
+
+0000000000800122 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800122:	55                   	push   %rbp
+  800123:	48 89 e5             	mov    %rsp,%rbp
+  800126:	41 56                	push   %r14
+  800128:	41 55                	push   %r13
+  80012a:	41 54                	push   %r12
+  80012c:	53                   	push   %rbx
+  80012d:	41 89 fd             	mov    %edi,%r13d
+  800130:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800133:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80013a:	00 00 00 
+  80013d:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800144:	00 00 00 
+  800147:	48 39 c2             	cmp    %rax,%rdx
+  80014a:	73 17                	jae    800163 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80014c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80014f:	49 89 c4             	mov    %rax,%r12
+  800152:	48 83 c3 08          	add    $0x8,%rbx
+  800156:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015b:	ff 53 f8             	call   *-0x8(%rbx)
+  80015e:	4c 39 e3             	cmp    %r12,%rbx
+  800161:	72 ef                	jb     800152 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800163:	48 b8 ae 10 80 00 00 	movabs $0x8010ae,%rax
+  80016a:	00 00 00 
+  80016d:	ff d0                	call   *%rax
+  80016f:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800172:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800179:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800180:	00 00 00 
+  800183:	48 01 d0             	add    %rdx,%rax
+  800186:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80018d:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800190:	45 85 ed             	test   %r13d,%r13d
+  800193:	7e 0d                	jle    8001a2 <libmain+0x80>
+  800195:	49 8b 06             	mov    (%r14),%rax
+  800198:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80019f:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001a2:	4c 89 f6             	mov    %r14,%rsi
+  8001a5:	44 89 ef             	mov    %r13d,%edi
+  8001a8:	48 b8 06 01 80 00 00 	movabs $0x800106,%rax
+  8001af:	00 00 00 
+  8001b2:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001b4:	48 b8 c9 01 80 00 00 	movabs $0x8001c9,%rax
+  8001bb:	00 00 00 
+  8001be:	ff d0                	call   *%rax
+#endif
+}
+  8001c0:	5b                   	pop    %rbx
+  8001c1:	41 5c                	pop    %r12
+  8001c3:	41 5d                	pop    %r13
+  8001c5:	41 5e                	pop    %r14
+  8001c7:	5d                   	pop    %rbp
+  8001c8:	c3                   	ret
+
+00000000008001c9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001c9:	55                   	push   %rbp
+  8001ca:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001cd:	48 b8 36 1a 80 00 00 	movabs $0x801a36,%rax
+  8001d4:	00 00 00 
+  8001d7:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001de:	48 b8 43 10 80 00 00 	movabs $0x801043,%rax
+  8001e5:	00 00 00 
+  8001e8:	ff d0                	call   *%rax
+}
+  8001ea:	5d                   	pop    %rbp
+  8001eb:	c3                   	ret
+
+00000000008001ec <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001ec:	55                   	push   %rbp
+  8001ed:	48 89 e5             	mov    %rsp,%rbp
+  8001f0:	53                   	push   %rbx
+  8001f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8001f5:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001f8:	8b 06                	mov    (%rsi),%eax
+  8001fa:	8d 50 01             	lea    0x1(%rax),%edx
+  8001fd:	89 16                	mov    %edx,(%rsi)
+  8001ff:	48 98                	cltq
+  800201:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800206:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80020c:	74 0a                	je     800218 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80020e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800212:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800216:	c9                   	leave
+  800217:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800218:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80021c:	be ff 00 00 00       	mov    $0xff,%esi
+  800221:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  800228:	00 00 00 
+  80022b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80022d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800233:	eb d9                	jmp    80020e <putch+0x22>
+
+0000000000800235 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800235:	55                   	push   %rbp
+  800236:	48 89 e5             	mov    %rsp,%rbp
+  800239:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800240:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800243:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80024a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80024f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800254:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800257:	48 89 f1             	mov    %rsi,%rcx
+  80025a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800261:	48 bf ec 01 80 00 00 	movabs $0x8001ec,%rdi
+  800268:	00 00 00 
+  80026b:	48 b8 e9 03 80 00 00 	movabs $0x8003e9,%rax
+  800272:	00 00 00 
+  800275:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800277:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80027e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800285:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  80028c:	00 00 00 
+  80028f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800291:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800297:	c9                   	leave
+  800298:	c3                   	ret
+
+0000000000800299 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800299:	55                   	push   %rbp
+  80029a:	48 89 e5             	mov    %rsp,%rbp
+  80029d:	48 83 ec 50          	sub    $0x50,%rsp
+  8002a1:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002a5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002a9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002ad:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002b1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002b5:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002bc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002c4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002c8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002cc:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002d0:	48 b8 35 02 80 00 00 	movabs $0x800235,%rax
+  8002d7:	00 00 00 
+  8002da:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002dc:	c9                   	leave
+  8002dd:	c3                   	ret
+
+00000000008002de <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002de:	55                   	push   %rbp
+  8002df:	48 89 e5             	mov    %rsp,%rbp
+  8002e2:	41 57                	push   %r15
+  8002e4:	41 56                	push   %r14
+  8002e6:	41 55                	push   %r13
+  8002e8:	41 54                	push   %r12
+  8002ea:	53                   	push   %rbx
+  8002eb:	48 83 ec 18          	sub    $0x18,%rsp
+  8002ef:	49 89 fc             	mov    %rdi,%r12
+  8002f2:	49 89 f5             	mov    %rsi,%r13
+  8002f5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002f9:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002fc:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002ff:	41 89 cf             	mov    %ecx,%r15d
+  800302:	4c 39 fa             	cmp    %r15,%rdx
+  800305:	73 5b                	jae    800362 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800307:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80030b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80030f:	85 db                	test   %ebx,%ebx
+  800311:	7e 0e                	jle    800321 <print_num+0x43>
+            putch(padc, put_arg);
+  800313:	4c 89 ee             	mov    %r13,%rsi
+  800316:	44 89 f7             	mov    %r14d,%edi
+  800319:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80031c:	83 eb 01             	sub    $0x1,%ebx
+  80031f:	75 f2                	jne    800313 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800321:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800325:	48 b9 41 2d 80 00 00 	movabs $0x802d41,%rcx
+  80032c:	00 00 00 
+  80032f:	48 b8 30 2d 80 00 00 	movabs $0x802d30,%rax
+  800336:	00 00 00 
+  800339:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80033d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800341:	ba 00 00 00 00       	mov    $0x0,%edx
+  800346:	49 f7 f7             	div    %r15
+  800349:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80034d:	4c 89 ee             	mov    %r13,%rsi
+  800350:	41 ff d4             	call   *%r12
+}
+  800353:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800357:	5b                   	pop    %rbx
+  800358:	41 5c                	pop    %r12
+  80035a:	41 5d                	pop    %r13
+  80035c:	41 5e                	pop    %r14
+  80035e:	41 5f                	pop    %r15
+  800360:	5d                   	pop    %rbp
+  800361:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800362:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800366:	ba 00 00 00 00       	mov    $0x0,%edx
+  80036b:	49 f7 f7             	div    %r15
+  80036e:	48 83 ec 08          	sub    $0x8,%rsp
+  800372:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800376:	52                   	push   %rdx
+  800377:	45 0f be c9          	movsbl %r9b,%r9d
+  80037b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80037f:	48 89 c2             	mov    %rax,%rdx
+  800382:	48 b8 de 02 80 00 00 	movabs $0x8002de,%rax
+  800389:	00 00 00 
+  80038c:	ff d0                	call   *%rax
+  80038e:	48 83 c4 10          	add    $0x10,%rsp
+  800392:	eb 8d                	jmp    800321 <print_num+0x43>
+
+0000000000800394 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800394:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800398:	48 8b 06             	mov    (%rsi),%rax
+  80039b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80039f:	73 0a                	jae    8003ab <sprintputch+0x17>
+        *state->start++ = ch;
+  8003a1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003a5:	48 89 16             	mov    %rdx,(%rsi)
+  8003a8:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003ab:	c3                   	ret
+
+00000000008003ac <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003ac:	55                   	push   %rbp
+  8003ad:	48 89 e5             	mov    %rsp,%rbp
+  8003b0:	48 83 ec 50          	sub    $0x50,%rsp
+  8003b4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003b8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003bc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003c0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003c7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003cf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003d3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003d7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003db:	48 b8 e9 03 80 00 00 	movabs $0x8003e9,%rax
+  8003e2:	00 00 00 
+  8003e5:	ff d0                	call   *%rax
+}
+  8003e7:	c9                   	leave
+  8003e8:	c3                   	ret
+
+00000000008003e9 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003e9:	55                   	push   %rbp
+  8003ea:	48 89 e5             	mov    %rsp,%rbp
+  8003ed:	41 57                	push   %r15
+  8003ef:	41 56                	push   %r14
+  8003f1:	41 55                	push   %r13
+  8003f3:	41 54                	push   %r12
+  8003f5:	53                   	push   %rbx
+  8003f6:	48 83 ec 38          	sub    $0x38,%rsp
+  8003fa:	49 89 fe             	mov    %rdi,%r14
+  8003fd:	49 89 f5             	mov    %rsi,%r13
+  800400:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800403:	48 8b 01             	mov    (%rcx),%rax
+  800406:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80040a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80040e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800412:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800416:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80041a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80041e:	0f b6 3b             	movzbl (%rbx),%edi
+  800421:	40 80 ff 25          	cmp    $0x25,%dil
+  800425:	74 18                	je     80043f <vprintfmt+0x56>
+            if (!ch) return;
+  800427:	40 84 ff             	test   %dil,%dil
+  80042a:	0f 84 b1 06 00 00    	je     800ae1 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800430:	40 0f b6 ff          	movzbl %dil,%edi
+  800434:	4c 89 ee             	mov    %r13,%rsi
+  800437:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80043a:	4c 89 e3             	mov    %r12,%rbx
+  80043d:	eb db                	jmp    80041a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80043f:	be 00 00 00 00       	mov    $0x0,%esi
+  800444:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800448:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80044d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800453:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80045a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80045e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800463:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800468:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80046b:	83 e8 23             	sub    $0x23,%eax
+  80046e:	3c 57                	cmp    $0x57,%al
+  800470:	0f 87 51 06 00 00    	ja     800ac7 <vprintfmt+0x6de>
+  800476:	0f b6 c0             	movzbl %al,%eax
+  800479:	48 b9 e0 2e 80 00 00 	movabs $0x802ee0,%rcx
+  800480:	00 00 00 
+  800483:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800486:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800489:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80048d:	eb cf                	jmp    80045e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80048f:	49 89 dc             	mov    %rbx,%r12
+  800492:	be 01 00 00 00       	mov    $0x1,%esi
+  800497:	eb c5                	jmp    80045e <vprintfmt+0x75>
+            padc = ch;
+  800499:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80049d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004a0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004a3:	eb b9                	jmp    80045e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8004ab:	77 24                	ja     8004d1 <vprintfmt+0xe8>
+  8004ad:	89 c1                	mov    %eax,%ecx
+  8004af:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004b3:	83 c0 08             	add    $0x8,%eax
+  8004b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004b9:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004bc:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004bf:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004c3:	79 99                	jns    80045e <vprintfmt+0x75>
+                width = precision;
+  8004c5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004c9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004cf:	eb 8d                	jmp    80045e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004d1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004d5:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004dd:	eb da                	jmp    8004b9 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004df:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004e4:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004e8:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004ee:	3c 39                	cmp    $0x39,%al
+  8004f0:	77 1c                	ja     80050e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004f2:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004f6:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004fa:	0f b6 c0             	movzbl %al,%eax
+  8004fd:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800502:	0f b6 03             	movzbl (%rbx),%eax
+  800505:	3c 39                	cmp    $0x39,%al
+  800507:	76 e9                	jbe    8004f2 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800509:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80050c:	eb b1                	jmp    8004bf <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80050e:	49 89 dc             	mov    %rbx,%r12
+  800511:	eb ac                	jmp    8004bf <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800513:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800516:	85 c9                	test   %ecx,%ecx
+  800518:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051d:	0f 49 c1             	cmovns %ecx,%eax
+  800520:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800523:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800526:	e9 33 ff ff ff       	jmp    80045e <vprintfmt+0x75>
+            lflag++;
+  80052b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80052e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800531:	e9 28 ff ff ff       	jmp    80045e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800536:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800539:	83 f8 2f             	cmp    $0x2f,%eax
+  80053c:	77 19                	ja     800557 <vprintfmt+0x16e>
+  80053e:	89 c2                	mov    %eax,%edx
+  800540:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800544:	83 c0 08             	add    $0x8,%eax
+  800547:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80054a:	8b 3a                	mov    (%rdx),%edi
+  80054c:	4c 89 ee             	mov    %r13,%rsi
+  80054f:	41 ff d6             	call   *%r14
+            break;
+  800552:	e9 c3 fe ff ff       	jmp    80041a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800557:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80055b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80055f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800563:	eb e5                	jmp    80054a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800565:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800568:	83 f8 2f             	cmp    $0x2f,%eax
+  80056b:	77 5a                	ja     8005c7 <vprintfmt+0x1de>
+  80056d:	89 c2                	mov    %eax,%edx
+  80056f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800573:	83 c0 08             	add    $0x8,%eax
+  800576:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800579:	8b 02                	mov    (%rdx),%eax
+  80057b:	89 c1                	mov    %eax,%ecx
+  80057d:	f7 d9                	neg    %ecx
+  80057f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800582:	83 f9 15             	cmp    $0x15,%ecx
+  800585:	7f 4e                	jg     8005d5 <vprintfmt+0x1ec>
+  800587:	48 63 c1             	movslq %ecx,%rax
+  80058a:	48 ba a0 31 80 00 00 	movabs $0x8031a0,%rdx
+  800591:	00 00 00 
+  800594:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800598:	48 85 c0             	test   %rax,%rax
+  80059b:	74 38                	je     8005d5 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80059d:	48 89 c1             	mov    %rax,%rcx
+  8005a0:	48 ba 99 33 80 00 00 	movabs $0x803399,%rdx
+  8005a7:	00 00 00 
+  8005aa:	4c 89 ee             	mov    %r13,%rsi
+  8005ad:	4c 89 f7             	mov    %r14,%rdi
+  8005b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b5:	49 b8 ac 03 80 00 00 	movabs $0x8003ac,%r8
+  8005bc:	00 00 00 
+  8005bf:	41 ff d0             	call   *%r8
+  8005c2:	e9 53 fe ff ff       	jmp    80041a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d3:	eb a4                	jmp    800579 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005d5:	48 ba 59 2d 80 00 00 	movabs $0x802d59,%rdx
+  8005dc:	00 00 00 
+  8005df:	4c 89 ee             	mov    %r13,%rsi
+  8005e2:	4c 89 f7             	mov    %r14,%rdi
+  8005e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ea:	49 b8 ac 03 80 00 00 	movabs $0x8003ac,%r8
+  8005f1:	00 00 00 
+  8005f4:	41 ff d0             	call   *%r8
+  8005f7:	e9 1e fe ff ff       	jmp    80041a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005ff:	83 f8 2f             	cmp    $0x2f,%eax
+  800602:	77 6c                	ja     800670 <vprintfmt+0x287>
+  800604:	89 c2                	mov    %eax,%edx
+  800606:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80060a:	83 c0 08             	add    $0x8,%eax
+  80060d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800610:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800613:	48 85 d2             	test   %rdx,%rdx
+  800616:	48 b8 52 2d 80 00 00 	movabs $0x802d52,%rax
+  80061d:	00 00 00 
+  800620:	48 0f 45 c2          	cmovne %rdx,%rax
+  800624:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800628:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80062c:	7e 06                	jle    800634 <vprintfmt+0x24b>
+  80062e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800632:	75 4a                	jne    80067e <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800634:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800638:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80063c:	0f b6 00             	movzbl (%rax),%eax
+  80063f:	84 c0                	test   %al,%al
+  800641:	0f 85 9a 00 00 00    	jne    8006e1 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800647:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80064a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80064e:	85 c0                	test   %eax,%eax
+  800650:	0f 8e c4 fd ff ff    	jle    80041a <vprintfmt+0x31>
+  800656:	4c 89 ee             	mov    %r13,%rsi
+  800659:	bf 20 00 00 00       	mov    $0x20,%edi
+  80065e:	41 ff d6             	call   *%r14
+  800661:	41 83 ec 01          	sub    $0x1,%r12d
+  800665:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800669:	75 eb                	jne    800656 <vprintfmt+0x26d>
+  80066b:	e9 aa fd ff ff       	jmp    80041a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800670:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800674:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800678:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80067c:	eb 92                	jmp    800610 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80067e:	49 63 f7             	movslq %r15d,%rsi
+  800681:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800685:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	48 89 c2             	mov    %rax,%rdx
+  800694:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800697:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800699:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80069c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80069f:	85 c0                	test   %eax,%eax
+  8006a1:	7e 91                	jle    800634 <vprintfmt+0x24b>
+  8006a3:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006a8:	4c 89 ee             	mov    %r13,%rsi
+  8006ab:	44 89 e7             	mov    %r12d,%edi
+  8006ae:	41 ff d6             	call   *%r14
+  8006b1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006b5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006b8:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006bb:	75 eb                	jne    8006a8 <vprintfmt+0x2bf>
+  8006bd:	e9 72 ff ff ff       	jmp    800634 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006c2:	0f b6 f8             	movzbl %al,%edi
+  8006c5:	4c 89 ee             	mov    %r13,%rsi
+  8006c8:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006cb:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006cf:	49 83 c4 01          	add    $0x1,%r12
+  8006d3:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006d9:	84 c0                	test   %al,%al
+  8006db:	0f 84 66 ff ff ff    	je     800647 <vprintfmt+0x25e>
+  8006e1:	45 85 ff             	test   %r15d,%r15d
+  8006e4:	78 0a                	js     8006f0 <vprintfmt+0x307>
+  8006e6:	41 83 ef 01          	sub    $0x1,%r15d
+  8006ea:	0f 88 57 ff ff ff    	js     800647 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006f0:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006f4:	74 cc                	je     8006c2 <vprintfmt+0x2d9>
+  8006f6:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006f9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006fe:	80 fa 5e             	cmp    $0x5e,%dl
+  800701:	77 c2                	ja     8006c5 <vprintfmt+0x2dc>
+  800703:	eb bd                	jmp    8006c2 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800705:	40 84 f6             	test   %sil,%sil
+  800708:	75 26                	jne    800730 <vprintfmt+0x347>
+    switch (lflag) {
+  80070a:	85 d2                	test   %edx,%edx
+  80070c:	74 59                	je     800767 <vprintfmt+0x37e>
+  80070e:	83 fa 01             	cmp    $0x1,%edx
+  800711:	74 7b                	je     80078e <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800713:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800716:	83 f8 2f             	cmp    $0x2f,%eax
+  800719:	0f 87 96 00 00 00    	ja     8007b5 <vprintfmt+0x3cc>
+  80071f:	89 c2                	mov    %eax,%edx
+  800721:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800725:	83 c0 08             	add    $0x8,%eax
+  800728:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80072b:	4c 8b 22             	mov    (%rdx),%r12
+  80072e:	eb 17                	jmp    800747 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800730:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800733:	83 f8 2f             	cmp    $0x2f,%eax
+  800736:	77 21                	ja     800759 <vprintfmt+0x370>
+  800738:	89 c2                	mov    %eax,%edx
+  80073a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073e:	83 c0 08             	add    $0x8,%eax
+  800741:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800744:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800747:	4d 85 e4             	test   %r12,%r12
+  80074a:	78 7a                	js     8007c6 <vprintfmt+0x3dd>
+            num = i;
+  80074c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80074f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800754:	e9 50 02 00 00       	jmp    8009a9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800759:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80075d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800761:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800765:	eb dd                	jmp    800744 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800767:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076a:	83 f8 2f             	cmp    $0x2f,%eax
+  80076d:	77 11                	ja     800780 <vprintfmt+0x397>
+  80076f:	89 c2                	mov    %eax,%edx
+  800771:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800775:	83 c0 08             	add    $0x8,%eax
+  800778:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077b:	4c 63 22             	movslq (%rdx),%r12
+  80077e:	eb c7                	jmp    800747 <vprintfmt+0x35e>
+  800780:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800784:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800788:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80078c:	eb ed                	jmp    80077b <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80078e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800791:	83 f8 2f             	cmp    $0x2f,%eax
+  800794:	77 11                	ja     8007a7 <vprintfmt+0x3be>
+  800796:	89 c2                	mov    %eax,%edx
+  800798:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80079c:	83 c0 08             	add    $0x8,%eax
+  80079f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a2:	4c 8b 22             	mov    (%rdx),%r12
+  8007a5:	eb a0                	jmp    800747 <vprintfmt+0x35e>
+  8007a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b3:	eb ed                	jmp    8007a2 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c1:	e9 65 ff ff ff       	jmp    80072b <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007c6:	4c 89 ee             	mov    %r13,%rsi
+  8007c9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007ce:	41 ff d6             	call   *%r14
+                i = -i;
+  8007d1:	49 f7 dc             	neg    %r12
+  8007d4:	e9 73 ff ff ff       	jmp    80074c <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007d9:	40 84 f6             	test   %sil,%sil
+  8007dc:	75 32                	jne    800810 <vprintfmt+0x427>
+    switch (lflag) {
+  8007de:	85 d2                	test   %edx,%edx
+  8007e0:	74 5d                	je     80083f <vprintfmt+0x456>
+  8007e2:	83 fa 01             	cmp    $0x1,%edx
+  8007e5:	0f 84 82 00 00 00    	je     80086d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f1:	0f 87 a5 00 00 00    	ja     80089c <vprintfmt+0x4b3>
+  8007f7:	89 c2                	mov    %eax,%edx
+  8007f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fd:	83 c0 08             	add    $0x8,%eax
+  800800:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800803:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800806:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80080b:	e9 99 01 00 00       	jmp    8009a9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800810:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800813:	83 f8 2f             	cmp    $0x2f,%eax
+  800816:	77 19                	ja     800831 <vprintfmt+0x448>
+  800818:	89 c2                	mov    %eax,%edx
+  80081a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081e:	83 c0 08             	add    $0x8,%eax
+  800821:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800824:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800827:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80082c:	e9 78 01 00 00       	jmp    8009a9 <vprintfmt+0x5c0>
+  800831:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800835:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800839:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083d:	eb e5                	jmp    800824 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80083f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800842:	83 f8 2f             	cmp    $0x2f,%eax
+  800845:	77 18                	ja     80085f <vprintfmt+0x476>
+  800847:	89 c2                	mov    %eax,%edx
+  800849:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084d:	83 c0 08             	add    $0x8,%eax
+  800850:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800853:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800855:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80085a:	e9 4a 01 00 00       	jmp    8009a9 <vprintfmt+0x5c0>
+  80085f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800863:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800867:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086b:	eb e6                	jmp    800853 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80086d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800870:	83 f8 2f             	cmp    $0x2f,%eax
+  800873:	77 19                	ja     80088e <vprintfmt+0x4a5>
+  800875:	89 c2                	mov    %eax,%edx
+  800877:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087b:	83 c0 08             	add    $0x8,%eax
+  80087e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800881:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800884:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800889:	e9 1b 01 00 00       	jmp    8009a9 <vprintfmt+0x5c0>
+  80088e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800892:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800896:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089a:	eb e5                	jmp    800881 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80089c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a8:	e9 56 ff ff ff       	jmp    800803 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ad:	40 84 f6             	test   %sil,%sil
+  8008b0:	75 2e                	jne    8008e0 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008b2:	85 d2                	test   %edx,%edx
+  8008b4:	74 59                	je     80090f <vprintfmt+0x526>
+  8008b6:	83 fa 01             	cmp    $0x1,%edx
+  8008b9:	74 7f                	je     80093a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008be:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c1:	0f 87 9f 00 00 00    	ja     800966 <vprintfmt+0x57d>
+  8008c7:	89 c2                	mov    %eax,%edx
+  8008c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008cd:	83 c0 08             	add    $0x8,%eax
+  8008d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008d6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008db:	e9 c9 00 00 00       	jmp    8009a9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e6:	77 19                	ja     800901 <vprintfmt+0x518>
+  8008e8:	89 c2                	mov    %eax,%edx
+  8008ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ee:	83 c0 08             	add    $0x8,%eax
+  8008f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008f7:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008fc:	e9 a8 00 00 00       	jmp    8009a9 <vprintfmt+0x5c0>
+  800901:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800905:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800909:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80090d:	eb e5                	jmp    8008f4 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80090f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800912:	83 f8 2f             	cmp    $0x2f,%eax
+  800915:	77 15                	ja     80092c <vprintfmt+0x543>
+  800917:	89 c2                	mov    %eax,%edx
+  800919:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091d:	83 c0 08             	add    $0x8,%eax
+  800920:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800923:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800925:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80092a:	eb 7d                	jmp    8009a9 <vprintfmt+0x5c0>
+  80092c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800930:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800934:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800938:	eb e9                	jmp    800923 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80093a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093d:	83 f8 2f             	cmp    $0x2f,%eax
+  800940:	77 16                	ja     800958 <vprintfmt+0x56f>
+  800942:	89 c2                	mov    %eax,%edx
+  800944:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800948:	83 c0 08             	add    $0x8,%eax
+  80094b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800951:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800956:	eb 51                	jmp    8009a9 <vprintfmt+0x5c0>
+  800958:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800960:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800964:	eb e8                	jmp    80094e <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800966:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800972:	e9 5c ff ff ff       	jmp    8008d3 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800977:	4c 89 ee             	mov    %r13,%rsi
+  80097a:	bf 30 00 00 00       	mov    $0x30,%edi
+  80097f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800982:	4c 89 ee             	mov    %r13,%rsi
+  800985:	bf 78 00 00 00       	mov    $0x78,%edi
+  80098a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80098d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800990:	83 f8 2f             	cmp    $0x2f,%eax
+  800993:	77 47                	ja     8009dc <vprintfmt+0x5f3>
+  800995:	89 c2                	mov    %eax,%edx
+  800997:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099b:	83 c0 08             	add    $0x8,%eax
+  80099e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009a4:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8009ad:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009b1:	0f 94 c0             	sete   %al
+  8009b4:	0f b6 c0             	movzbl %al,%eax
+  8009b7:	50                   	push   %rax
+  8009b8:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009bd:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009c1:	4c 89 ee             	mov    %r13,%rsi
+  8009c4:	4c 89 f7             	mov    %r14,%rdi
+  8009c7:	48 b8 de 02 80 00 00 	movabs $0x8002de,%rax
+  8009ce:	00 00 00 
+  8009d1:	ff d0                	call   *%rax
+            break;
+  8009d3:	48 83 c4 10          	add    $0x10,%rsp
+  8009d7:	e9 3e fa ff ff       	jmp    80041a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e8:	eb b7                	jmp    8009a1 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ea:	40 84 f6             	test   %sil,%sil
+  8009ed:	75 2b                	jne    800a1a <vprintfmt+0x631>
+    switch (lflag) {
+  8009ef:	85 d2                	test   %edx,%edx
+  8009f1:	74 56                	je     800a49 <vprintfmt+0x660>
+  8009f3:	83 fa 01             	cmp    $0x1,%edx
+  8009f6:	74 7f                	je     800a77 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fe:	0f 87 a2 00 00 00    	ja     800aa6 <vprintfmt+0x6bd>
+  800a04:	89 c2                	mov    %eax,%edx
+  800a06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0a:	83 c0 08             	add    $0x8,%eax
+  800a0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a10:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a13:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a18:	eb 8f                	jmp    8009a9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a20:	77 19                	ja     800a3b <vprintfmt+0x652>
+  800a22:	89 c2                	mov    %eax,%edx
+  800a24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a28:	83 c0 08             	add    $0x8,%eax
+  800a2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a31:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a36:	e9 6e ff ff ff       	jmp    8009a9 <vprintfmt+0x5c0>
+  800a3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a47:	eb e5                	jmp    800a2e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4f:	77 18                	ja     800a69 <vprintfmt+0x680>
+  800a51:	89 c2                	mov    %eax,%edx
+  800a53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a57:	83 c0 08             	add    $0x8,%eax
+  800a5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a5f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a64:	e9 40 ff ff ff       	jmp    8009a9 <vprintfmt+0x5c0>
+  800a69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a75:	eb e6                	jmp    800a5d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7d:	77 19                	ja     800a98 <vprintfmt+0x6af>
+  800a7f:	89 c2                	mov    %eax,%edx
+  800a81:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a85:	83 c0 08             	add    $0x8,%eax
+  800a88:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a8b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a8e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a93:	e9 11 ff ff ff       	jmp    8009a9 <vprintfmt+0x5c0>
+  800a98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa4:	eb e5                	jmp    800a8b <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800aa6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aaa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab2:	e9 59 ff ff ff       	jmp    800a10 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ab7:	4c 89 ee             	mov    %r13,%rsi
+  800aba:	bf 25 00 00 00       	mov    $0x25,%edi
+  800abf:	41 ff d6             	call   *%r14
+            break;
+  800ac2:	e9 53 f9 ff ff       	jmp    80041a <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ac7:	4c 89 ee             	mov    %r13,%rsi
+  800aca:	bf 25 00 00 00       	mov    $0x25,%edi
+  800acf:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800ad2:	48 83 eb 01          	sub    $0x1,%rbx
+  800ad6:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ada:	75 f6                	jne    800ad2 <vprintfmt+0x6e9>
+  800adc:	e9 39 f9 ff ff       	jmp    80041a <vprintfmt+0x31>
+}
+  800ae1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ae5:	5b                   	pop    %rbx
+  800ae6:	41 5c                	pop    %r12
+  800ae8:	41 5d                	pop    %r13
+  800aea:	41 5e                	pop    %r14
+  800aec:	41 5f                	pop    %r15
+  800aee:	5d                   	pop    %rbp
+  800aef:	c3                   	ret
+
+0000000000800af0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800af0:	55                   	push   %rbp
+  800af1:	48 89 e5             	mov    %rsp,%rbp
+  800af4:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800af8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800afc:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b01:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b05:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b0c:	48 85 ff             	test   %rdi,%rdi
+  800b0f:	74 2b                	je     800b3c <vsnprintf+0x4c>
+  800b11:	48 85 f6             	test   %rsi,%rsi
+  800b14:	74 26                	je     800b3c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b16:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b1a:	48 bf 94 03 80 00 00 	movabs $0x800394,%rdi
+  800b21:	00 00 00 
+  800b24:	48 b8 e9 03 80 00 00 	movabs $0x8003e9,%rax
+  800b2b:	00 00 00 
+  800b2e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b34:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b37:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b3a:	c9                   	leave
+  800b3b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b41:	eb f7                	jmp    800b3a <vsnprintf+0x4a>
+
+0000000000800b43 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b43:	55                   	push   %rbp
+  800b44:	48 89 e5             	mov    %rsp,%rbp
+  800b47:	48 83 ec 50          	sub    $0x50,%rsp
+  800b4b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b4f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b53:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b57:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b5e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b66:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b6a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b6e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b72:	48 b8 f0 0a 80 00 00 	movabs $0x800af0,%rax
+  800b79:	00 00 00 
+  800b7c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b7e:	c9                   	leave
+  800b7f:	c3                   	ret
+
+0000000000800b80 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b80:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b83:	74 10                	je     800b95 <strlen+0x15>
+    size_t n = 0;
+  800b85:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b8a:	48 83 c0 01          	add    $0x1,%rax
+  800b8e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b92:	75 f6                	jne    800b8a <strlen+0xa>
+  800b94:	c3                   	ret
+    size_t n = 0;
+  800b95:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b9a:	c3                   	ret
+
+0000000000800b9b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b9b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b9e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ba3:	48 85 f6             	test   %rsi,%rsi
+  800ba6:	74 11                	je     800bb9 <strnlen+0x1e>
+  800ba8:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bac:	74 0c                	je     800bba <strnlen+0x1f>
+  800bae:	48 83 c2 01          	add    $0x1,%rdx
+  800bb2:	48 39 d0             	cmp    %rdx,%rax
+  800bb5:	75 f1                	jne    800ba8 <strnlen+0xd>
+  800bb7:	eb 04                	jmp    800bbd <strnlen+0x22>
+  800bb9:	c3                   	ret
+  800bba:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bbd:	c3                   	ret
+
+0000000000800bbe <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bbe:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bc6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bca:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bcd:	48 83 c2 01          	add    $0x1,%rdx
+  800bd1:	84 c9                	test   %cl,%cl
+  800bd3:	75 f1                	jne    800bc6 <strcpy+0x8>
+        ;
+    return res;
+}
+  800bd5:	c3                   	ret
+
+0000000000800bd6 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800bd6:	55                   	push   %rbp
+  800bd7:	48 89 e5             	mov    %rsp,%rbp
+  800bda:	41 54                	push   %r12
+  800bdc:	53                   	push   %rbx
+  800bdd:	48 89 fb             	mov    %rdi,%rbx
+  800be0:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800be3:	48 b8 80 0b 80 00 00 	movabs $0x800b80,%rax
+  800bea:	00 00 00 
+  800bed:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bef:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bf3:	4c 89 e6             	mov    %r12,%rsi
+  800bf6:	48 b8 be 0b 80 00 00 	movabs $0x800bbe,%rax
+  800bfd:	00 00 00 
+  800c00:	ff d0                	call   *%rax
+    return dst;
+}
+  800c02:	48 89 d8             	mov    %rbx,%rax
+  800c05:	5b                   	pop    %rbx
+  800c06:	41 5c                	pop    %r12
+  800c08:	5d                   	pop    %rbp
+  800c09:	c3                   	ret
+
+0000000000800c0a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c0a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c0d:	48 85 d2             	test   %rdx,%rdx
+  800c10:	74 1f                	je     800c31 <strncpy+0x27>
+  800c12:	48 01 fa             	add    %rdi,%rdx
+  800c15:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c18:	48 83 c1 01          	add    $0x1,%rcx
+  800c1c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c20:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c24:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c28:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c2c:	48 39 ca             	cmp    %rcx,%rdx
+  800c2f:	75 e7                	jne    800c18 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c31:	c3                   	ret
+
+0000000000800c32 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c32:	48 89 f8             	mov    %rdi,%rax
+  800c35:	48 85 d2             	test   %rdx,%rdx
+  800c38:	74 24                	je     800c5e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c3a:	48 83 ea 01          	sub    $0x1,%rdx
+  800c3e:	74 1b                	je     800c5b <strlcpy+0x29>
+  800c40:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c44:	0f b6 16             	movzbl (%rsi),%edx
+  800c47:	84 d2                	test   %dl,%dl
+  800c49:	74 10                	je     800c5b <strlcpy+0x29>
+            *dst++ = *src++;
+  800c4b:	48 83 c6 01          	add    $0x1,%rsi
+  800c4f:	48 83 c0 01          	add    $0x1,%rax
+  800c53:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c56:	48 39 c8             	cmp    %rcx,%rax
+  800c59:	75 e9                	jne    800c44 <strlcpy+0x12>
+        *dst = '\0';
+  800c5b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c5e:	48 29 f8             	sub    %rdi,%rax
+}
+  800c61:	c3                   	ret
+
+0000000000800c62 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c62:	0f b6 07             	movzbl (%rdi),%eax
+  800c65:	84 c0                	test   %al,%al
+  800c67:	74 13                	je     800c7c <strcmp+0x1a>
+  800c69:	38 06                	cmp    %al,(%rsi)
+  800c6b:	75 0f                	jne    800c7c <strcmp+0x1a>
+  800c6d:	48 83 c7 01          	add    $0x1,%rdi
+  800c71:	48 83 c6 01          	add    $0x1,%rsi
+  800c75:	0f b6 07             	movzbl (%rdi),%eax
+  800c78:	84 c0                	test   %al,%al
+  800c7a:	75 ed                	jne    800c69 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c7c:	0f b6 c0             	movzbl %al,%eax
+  800c7f:	0f b6 16             	movzbl (%rsi),%edx
+  800c82:	29 d0                	sub    %edx,%eax
+}
+  800c84:	c3                   	ret
+
+0000000000800c85 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c85:	48 85 d2             	test   %rdx,%rdx
+  800c88:	74 1f                	je     800ca9 <strncmp+0x24>
+  800c8a:	0f b6 07             	movzbl (%rdi),%eax
+  800c8d:	84 c0                	test   %al,%al
+  800c8f:	74 1e                	je     800caf <strncmp+0x2a>
+  800c91:	3a 06                	cmp    (%rsi),%al
+  800c93:	75 1a                	jne    800caf <strncmp+0x2a>
+  800c95:	48 83 c7 01          	add    $0x1,%rdi
+  800c99:	48 83 c6 01          	add    $0x1,%rsi
+  800c9d:	48 83 ea 01          	sub    $0x1,%rdx
+  800ca1:	75 e7                	jne    800c8a <strncmp+0x5>
+
+    if (!n) return 0;
+  800ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca8:	c3                   	ret
+  800ca9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cae:	c3                   	ret
+  800caf:	48 85 d2             	test   %rdx,%rdx
+  800cb2:	74 09                	je     800cbd <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cb4:	0f b6 07             	movzbl (%rdi),%eax
+  800cb7:	0f b6 16             	movzbl (%rsi),%edx
+  800cba:	29 d0                	sub    %edx,%eax
+  800cbc:	c3                   	ret
+    if (!n) return 0;
+  800cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cc2:	c3                   	ret
+
+0000000000800cc3 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cc3:	0f b6 17             	movzbl (%rdi),%edx
+  800cc6:	84 d2                	test   %dl,%dl
+  800cc8:	74 18                	je     800ce2 <strchr+0x1f>
+        if (*str == c) {
+  800cca:	0f be d2             	movsbl %dl,%edx
+  800ccd:	39 f2                	cmp    %esi,%edx
+  800ccf:	74 17                	je     800ce8 <strchr+0x25>
+    for (; *str; str++) {
+  800cd1:	48 83 c7 01          	add    $0x1,%rdi
+  800cd5:	0f b6 17             	movzbl (%rdi),%edx
+  800cd8:	84 d2                	test   %dl,%dl
+  800cda:	75 ee                	jne    800cca <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce1:	c3                   	ret
+  800ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce7:	c3                   	ret
+  800ce8:	48 89 f8             	mov    %rdi,%rax
+}
+  800ceb:	c3                   	ret
+
+0000000000800cec <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cec:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cef:	0f b6 17             	movzbl (%rdi),%edx
+  800cf2:	84 d2                	test   %dl,%dl
+  800cf4:	74 13                	je     800d09 <strfind+0x1d>
+  800cf6:	0f be d2             	movsbl %dl,%edx
+  800cf9:	39 f2                	cmp    %esi,%edx
+  800cfb:	74 0b                	je     800d08 <strfind+0x1c>
+  800cfd:	48 83 c0 01          	add    $0x1,%rax
+  800d01:	0f b6 10             	movzbl (%rax),%edx
+  800d04:	84 d2                	test   %dl,%dl
+  800d06:	75 ee                	jne    800cf6 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d08:	c3                   	ret
+  800d09:	c3                   	ret
+
+0000000000800d0a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d0a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d0d:	48 89 f8             	mov    %rdi,%rax
+  800d10:	48 f7 d8             	neg    %rax
+  800d13:	83 e0 07             	and    $0x7,%eax
+  800d16:	49 89 d1             	mov    %rdx,%r9
+  800d19:	49 29 c1             	sub    %rax,%r9
+  800d1c:	78 36                	js     800d54 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d1e:	40 0f b6 c6          	movzbl %sil,%eax
+  800d22:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d29:	01 01 01 
+  800d2c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d30:	40 f6 c7 07          	test   $0x7,%dil
+  800d34:	75 38                	jne    800d6e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d36:	4c 89 c9             	mov    %r9,%rcx
+  800d39:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d3d:	74 0c                	je     800d4b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d3f:	fc                   	cld
+  800d40:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d43:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d47:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d4b:	4d 85 c9             	test   %r9,%r9
+  800d4e:	75 45                	jne    800d95 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d50:	4c 89 c0             	mov    %r8,%rax
+  800d53:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d54:	48 85 d2             	test   %rdx,%rdx
+  800d57:	74 f7                	je     800d50 <memset+0x46>
+  800d59:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d5c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d5f:	48 83 c0 01          	add    $0x1,%rax
+  800d63:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d67:	48 39 c2             	cmp    %rax,%rdx
+  800d6a:	75 f3                	jne    800d5f <memset+0x55>
+  800d6c:	eb e2                	jmp    800d50 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d6e:	40 f6 c7 01          	test   $0x1,%dil
+  800d72:	74 06                	je     800d7a <memset+0x70>
+  800d74:	88 07                	mov    %al,(%rdi)
+  800d76:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d7a:	40 f6 c7 02          	test   $0x2,%dil
+  800d7e:	74 07                	je     800d87 <memset+0x7d>
+  800d80:	66 89 07             	mov    %ax,(%rdi)
+  800d83:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d87:	40 f6 c7 04          	test   $0x4,%dil
+  800d8b:	74 a9                	je     800d36 <memset+0x2c>
+  800d8d:	89 07                	mov    %eax,(%rdi)
+  800d8f:	48 83 c7 04          	add    $0x4,%rdi
+  800d93:	eb a1                	jmp    800d36 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d95:	41 f6 c1 04          	test   $0x4,%r9b
+  800d99:	74 06                	je     800da1 <memset+0x97>
+  800d9b:	89 07                	mov    %eax,(%rdi)
+  800d9d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800da1:	41 f6 c1 02          	test   $0x2,%r9b
+  800da5:	74 07                	je     800dae <memset+0xa4>
+  800da7:	66 89 07             	mov    %ax,(%rdi)
+  800daa:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800dae:	41 f6 c1 01          	test   $0x1,%r9b
+  800db2:	74 9c                	je     800d50 <memset+0x46>
+  800db4:	88 07                	mov    %al,(%rdi)
+  800db6:	eb 98                	jmp    800d50 <memset+0x46>
+
+0000000000800db8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800db8:	48 89 f8             	mov    %rdi,%rax
+  800dbb:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800dbe:	48 39 fe             	cmp    %rdi,%rsi
+  800dc1:	73 3b                	jae    800dfe <memmove+0x46>
+  800dc3:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800dc7:	48 39 d7             	cmp    %rdx,%rdi
+  800dca:	73 32                	jae    800dfe <memmove+0x46>
+        s += n;
+        d += n;
+  800dcc:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dd0:	48 89 d6             	mov    %rdx,%rsi
+  800dd3:	48 09 fe             	or     %rdi,%rsi
+  800dd6:	48 09 ce             	or     %rcx,%rsi
+  800dd9:	40 f6 c6 07          	test   $0x7,%sil
+  800ddd:	75 12                	jne    800df1 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ddf:	48 83 ef 08          	sub    $0x8,%rdi
+  800de3:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800de7:	48 c1 e9 03          	shr    $0x3,%rcx
+  800deb:	fd                   	std
+  800dec:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800def:	fc                   	cld
+  800df0:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800df1:	48 83 ef 01          	sub    $0x1,%rdi
+  800df5:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800df9:	fd                   	std
+  800dfa:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800dfc:	eb f1                	jmp    800def <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dfe:	48 89 f2             	mov    %rsi,%rdx
+  800e01:	48 09 c2             	or     %rax,%rdx
+  800e04:	48 09 ca             	or     %rcx,%rdx
+  800e07:	f6 c2 07             	test   $0x7,%dl
+  800e0a:	75 0c                	jne    800e18 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e0c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e10:	48 89 c7             	mov    %rax,%rdi
+  800e13:	fc                   	cld
+  800e14:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e17:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e18:	48 89 c7             	mov    %rax,%rdi
+  800e1b:	fc                   	cld
+  800e1c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e1e:	c3                   	ret
+
+0000000000800e1f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e1f:	55                   	push   %rbp
+  800e20:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e23:	48 b8 b8 0d 80 00 00 	movabs $0x800db8,%rax
+  800e2a:	00 00 00 
+  800e2d:	ff d0                	call   *%rax
+}
+  800e2f:	5d                   	pop    %rbp
+  800e30:	c3                   	ret
+
+0000000000800e31 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e31:	55                   	push   %rbp
+  800e32:	48 89 e5             	mov    %rsp,%rbp
+  800e35:	41 57                	push   %r15
+  800e37:	41 56                	push   %r14
+  800e39:	41 55                	push   %r13
+  800e3b:	41 54                	push   %r12
+  800e3d:	53                   	push   %rbx
+  800e3e:	48 83 ec 08          	sub    $0x8,%rsp
+  800e42:	49 89 fe             	mov    %rdi,%r14
+  800e45:	49 89 f7             	mov    %rsi,%r15
+  800e48:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e4b:	48 89 f7             	mov    %rsi,%rdi
+  800e4e:	48 b8 80 0b 80 00 00 	movabs $0x800b80,%rax
+  800e55:	00 00 00 
+  800e58:	ff d0                	call   *%rax
+  800e5a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e5d:	48 89 de             	mov    %rbx,%rsi
+  800e60:	4c 89 f7             	mov    %r14,%rdi
+  800e63:	48 b8 9b 0b 80 00 00 	movabs $0x800b9b,%rax
+  800e6a:	00 00 00 
+  800e6d:	ff d0                	call   *%rax
+  800e6f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e72:	48 39 c3             	cmp    %rax,%rbx
+  800e75:	74 36                	je     800ead <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e77:	48 89 d8             	mov    %rbx,%rax
+  800e7a:	4c 29 e8             	sub    %r13,%rax
+  800e7d:	49 39 c4             	cmp    %rax,%r12
+  800e80:	73 31                	jae    800eb3 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e82:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e87:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e8b:	4c 89 fe             	mov    %r15,%rsi
+  800e8e:	48 b8 1f 0e 80 00 00 	movabs $0x800e1f,%rax
+  800e95:	00 00 00 
+  800e98:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e9a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e9e:	48 83 c4 08          	add    $0x8,%rsp
+  800ea2:	5b                   	pop    %rbx
+  800ea3:	41 5c                	pop    %r12
+  800ea5:	41 5d                	pop    %r13
+  800ea7:	41 5e                	pop    %r14
+  800ea9:	41 5f                	pop    %r15
+  800eab:	5d                   	pop    %rbp
+  800eac:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ead:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800eb1:	eb eb                	jmp    800e9e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800eb3:	48 83 eb 01          	sub    $0x1,%rbx
+  800eb7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ebb:	48 89 da             	mov    %rbx,%rdx
+  800ebe:	4c 89 fe             	mov    %r15,%rsi
+  800ec1:	48 b8 1f 0e 80 00 00 	movabs $0x800e1f,%rax
+  800ec8:	00 00 00 
+  800ecb:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ecd:	49 01 de             	add    %rbx,%r14
+  800ed0:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ed5:	eb c3                	jmp    800e9a <strlcat+0x69>
+
+0000000000800ed7 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ed7:	48 85 d2             	test   %rdx,%rdx
+  800eda:	74 2d                	je     800f09 <memcmp+0x32>
+  800edc:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ee1:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ee5:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800eea:	44 38 c1             	cmp    %r8b,%cl
+  800eed:	75 0f                	jne    800efe <memcmp+0x27>
+    while (n-- > 0) {
+  800eef:	48 83 c0 01          	add    $0x1,%rax
+  800ef3:	48 39 c2             	cmp    %rax,%rdx
+  800ef6:	75 e9                	jne    800ee1 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800ef8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800efd:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800efe:	0f b6 c1             	movzbl %cl,%eax
+  800f01:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f05:	44 29 c0             	sub    %r8d,%eax
+  800f08:	c3                   	ret
+    return 0;
+  800f09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f0e:	c3                   	ret
+
+0000000000800f0f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f0f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f13:	48 39 c7             	cmp    %rax,%rdi
+  800f16:	73 0f                	jae    800f27 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f18:	40 38 37             	cmp    %sil,(%rdi)
+  800f1b:	74 0e                	je     800f2b <memfind+0x1c>
+    for (; src < end; src++) {
+  800f1d:	48 83 c7 01          	add    $0x1,%rdi
+  800f21:	48 39 f8             	cmp    %rdi,%rax
+  800f24:	75 f2                	jne    800f18 <memfind+0x9>
+  800f26:	c3                   	ret
+  800f27:	48 89 f8             	mov    %rdi,%rax
+  800f2a:	c3                   	ret
+  800f2b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f2e:	c3                   	ret
+
+0000000000800f2f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f2f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f32:	0f b6 37             	movzbl (%rdi),%esi
+  800f35:	40 80 fe 20          	cmp    $0x20,%sil
+  800f39:	74 06                	je     800f41 <strtol+0x12>
+  800f3b:	40 80 fe 09          	cmp    $0x9,%sil
+  800f3f:	75 13                	jne    800f54 <strtol+0x25>
+  800f41:	48 83 c7 01          	add    $0x1,%rdi
+  800f45:	0f b6 37             	movzbl (%rdi),%esi
+  800f48:	40 80 fe 20          	cmp    $0x20,%sil
+  800f4c:	74 f3                	je     800f41 <strtol+0x12>
+  800f4e:	40 80 fe 09          	cmp    $0x9,%sil
+  800f52:	74 ed                	je     800f41 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f54:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f57:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f5a:	3c 01                	cmp    $0x1,%al
+  800f5c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f60:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f66:	75 0f                	jne    800f77 <strtol+0x48>
+  800f68:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f6b:	74 14                	je     800f81 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f6d:	85 d2                	test   %edx,%edx
+  800f6f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f74:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f77:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f7c:	4c 63 ca             	movslq %edx,%r9
+  800f7f:	eb 36                	jmp    800fb7 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f81:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f85:	74 0f                	je     800f96 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f87:	85 d2                	test   %edx,%edx
+  800f89:	75 ec                	jne    800f77 <strtol+0x48>
+        s++;
+  800f8b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f8f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f94:	eb e1                	jmp    800f77 <strtol+0x48>
+        s += 2;
+  800f96:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f9a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f9f:	eb d6                	jmp    800f77 <strtol+0x48>
+            dig -= '0';
+  800fa1:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fa4:	44 0f b6 c1          	movzbl %cl,%r8d
+  800fa8:	41 39 d0             	cmp    %edx,%r8d
+  800fab:	7d 21                	jge    800fce <strtol+0x9f>
+        val = val * base + dig;
+  800fad:	49 0f af c1          	imul   %r9,%rax
+  800fb1:	0f b6 c9             	movzbl %cl,%ecx
+  800fb4:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fb7:	48 83 c7 01          	add    $0x1,%rdi
+  800fbb:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800fbf:	80 f9 39             	cmp    $0x39,%cl
+  800fc2:	76 dd                	jbe    800fa1 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fc4:	80 f9 7b             	cmp    $0x7b,%cl
+  800fc7:	77 05                	ja     800fce <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fc9:	83 e9 57             	sub    $0x57,%ecx
+  800fcc:	eb d6                	jmp    800fa4 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fce:	4d 85 d2             	test   %r10,%r10
+  800fd1:	74 03                	je     800fd6 <strtol+0xa7>
+  800fd3:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fd6:	48 89 c2             	mov    %rax,%rdx
+  800fd9:	48 f7 da             	neg    %rdx
+  800fdc:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fe0:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fe4:	c3                   	ret
+
+0000000000800fe5 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800fe5:	55                   	push   %rbp
+  800fe6:	48 89 e5             	mov    %rsp,%rbp
+  800fe9:	53                   	push   %rbx
+  800fea:	48 89 fa             	mov    %rdi,%rdx
+  800fed:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800ff5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fff:	be 00 00 00 00       	mov    $0x0,%esi
+  801004:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80100a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80100c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801010:	c9                   	leave
+  801011:	c3                   	ret
+
+0000000000801012 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801012:	55                   	push   %rbp
+  801013:	48 89 e5             	mov    %rsp,%rbp
+  801016:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801017:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80101c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801021:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801026:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801030:	be 00 00 00 00       	mov    $0x0,%esi
+  801035:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80103b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80103d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801041:	c9                   	leave
+  801042:	c3                   	ret
+
+0000000000801043 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801043:	55                   	push   %rbp
+  801044:	48 89 e5             	mov    %rsp,%rbp
+  801047:	53                   	push   %rbx
+  801048:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80104c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80104f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801054:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801059:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801063:	be 00 00 00 00       	mov    $0x0,%esi
+  801068:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80106e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801070:	48 85 c0             	test   %rax,%rax
+  801073:	7f 06                	jg     80107b <sys_env_destroy+0x38>
+}
+  801075:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801079:	c9                   	leave
+  80107a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80107b:	49 89 c0             	mov    %rax,%r8
+  80107e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801083:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  80108a:	00 00 00 
+  80108d:	be 26 00 00 00       	mov    $0x26,%esi
+  801092:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  801099:	00 00 00 
+  80109c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a1:	49 b9 e3 2a 80 00 00 	movabs $0x802ae3,%r9
+  8010a8:	00 00 00 
+  8010ab:	41 ff d1             	call   *%r9
+
+00000000008010ae <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8010ae:	55                   	push   %rbp
+  8010af:	48 89 e5             	mov    %rsp,%rbp
+  8010b2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010b3:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010d7:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010dd:	c9                   	leave
+  8010de:	c3                   	ret
+
+00000000008010df <sys_yield>:
+
+void
+sys_yield(void) {
+  8010df:	55                   	push   %rbp
+  8010e0:	48 89 e5             	mov    %rsp,%rbp
+  8010e3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010e4:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801102:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801108:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80110a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80110e:	c9                   	leave
+  80110f:	c3                   	ret
+
+0000000000801110 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801110:	55                   	push   %rbp
+  801111:	48 89 e5             	mov    %rsp,%rbp
+  801114:	53                   	push   %rbx
+  801115:	48 89 fa             	mov    %rdi,%rdx
+  801118:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80111b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801120:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801127:	00 00 00 
+  80112a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80112f:	be 00 00 00 00       	mov    $0x0,%esi
+  801134:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80113a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80113c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801140:	c9                   	leave
+  801141:	c3                   	ret
+
+0000000000801142 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801142:	55                   	push   %rbp
+  801143:	48 89 e5             	mov    %rsp,%rbp
+  801146:	53                   	push   %rbx
+  801147:	49 89 f8             	mov    %rdi,%r8
+  80114a:	48 89 d3             	mov    %rdx,%rbx
+  80114d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801150:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801155:	4c 89 c2             	mov    %r8,%rdx
+  801158:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80115b:	be 00 00 00 00       	mov    $0x0,%esi
+  801160:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801166:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801168:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80116c:	c9                   	leave
+  80116d:	c3                   	ret
+
+000000000080116e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80116e:	55                   	push   %rbp
+  80116f:	48 89 e5             	mov    %rsp,%rbp
+  801172:	53                   	push   %rbx
+  801173:	48 83 ec 08          	sub    $0x8,%rsp
+  801177:	89 f8                	mov    %edi,%eax
+  801179:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80117c:	48 63 f9             	movslq %ecx,%rdi
+  80117f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801182:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801187:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80118a:	be 00 00 00 00       	mov    $0x0,%esi
+  80118f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801195:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801197:	48 85 c0             	test   %rax,%rax
+  80119a:	7f 06                	jg     8011a2 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80119c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a0:	c9                   	leave
+  8011a1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011a2:	49 89 c0             	mov    %rax,%r8
+  8011a5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011aa:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  8011b1:	00 00 00 
+  8011b4:	be 26 00 00 00       	mov    $0x26,%esi
+  8011b9:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  8011c0:	00 00 00 
+  8011c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c8:	49 b9 e3 2a 80 00 00 	movabs $0x802ae3,%r9
+  8011cf:	00 00 00 
+  8011d2:	41 ff d1             	call   *%r9
+
+00000000008011d5 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011d5:	55                   	push   %rbp
+  8011d6:	48 89 e5             	mov    %rsp,%rbp
+  8011d9:	53                   	push   %rbx
+  8011da:	48 83 ec 08          	sub    $0x8,%rsp
+  8011de:	89 f8                	mov    %edi,%eax
+  8011e0:	49 89 f2             	mov    %rsi,%r10
+  8011e3:	48 89 cf             	mov    %rcx,%rdi
+  8011e6:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011e9:	48 63 da             	movslq %edx,%rbx
+  8011ec:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ef:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011f4:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f7:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8011fa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011fc:	48 85 c0             	test   %rax,%rax
+  8011ff:	7f 06                	jg     801207 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801201:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801205:	c9                   	leave
+  801206:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801207:	49 89 c0             	mov    %rax,%r8
+  80120a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80120f:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  801216:	00 00 00 
+  801219:	be 26 00 00 00       	mov    $0x26,%esi
+  80121e:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  801225:	00 00 00 
+  801228:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122d:	49 b9 e3 2a 80 00 00 	movabs $0x802ae3,%r9
+  801234:	00 00 00 
+  801237:	41 ff d1             	call   *%r9
+
+000000000080123a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80123a:	55                   	push   %rbp
+  80123b:	48 89 e5             	mov    %rsp,%rbp
+  80123e:	53                   	push   %rbx
+  80123f:	48 83 ec 08          	sub    $0x8,%rsp
+  801243:	48 89 f1             	mov    %rsi,%rcx
+  801246:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801249:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80124c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801251:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801256:	be 00 00 00 00       	mov    $0x0,%esi
+  80125b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801261:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801263:	48 85 c0             	test   %rax,%rax
+  801266:	7f 06                	jg     80126e <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801268:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80126c:	c9                   	leave
+  80126d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80126e:	49 89 c0             	mov    %rax,%r8
+  801271:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801276:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  80127d:	00 00 00 
+  801280:	be 26 00 00 00       	mov    $0x26,%esi
+  801285:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  80128c:	00 00 00 
+  80128f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801294:	49 b9 e3 2a 80 00 00 	movabs $0x802ae3,%r9
+  80129b:	00 00 00 
+  80129e:	41 ff d1             	call   *%r9
+
+00000000008012a1 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8012a1:	55                   	push   %rbp
+  8012a2:	48 89 e5             	mov    %rsp,%rbp
+  8012a5:	53                   	push   %rbx
+  8012a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8012aa:	89 f8                	mov    %edi,%eax
+  8012ac:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8012af:	48 63 f9             	movslq %ecx,%rdi
+  8012b2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b5:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012ba:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012ca:	48 85 c0             	test   %rax,%rax
+  8012cd:	7f 06                	jg     8012d5 <sys_region_advise+0x34>
+}
+  8012cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d3:	c9                   	leave
+  8012d4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d5:	49 89 c0             	mov    %rax,%r8
+  8012d8:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8012dd:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  8012e4:	00 00 00 
+  8012e7:	be 26 00 00 00       	mov    $0x26,%esi
+  8012ec:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  8012f3:	00 00 00 
+  8012f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012fb:	49 b9 e3 2a 80 00 00 	movabs $0x802ae3,%r9
+  801302:	00 00 00 
+  801305:	41 ff d1             	call   *%r9
+
+0000000000801308 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801308:	55                   	push   %rbp
+  801309:	48 89 e5             	mov    %rsp,%rbp
+  80130c:	53                   	push   %rbx
+  80130d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801311:	48 63 ce             	movslq %esi,%rcx
+  801314:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801317:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80131c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801321:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801326:	be 00 00 00 00       	mov    $0x0,%esi
+  80132b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801331:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801333:	48 85 c0             	test   %rax,%rax
+  801336:	7f 06                	jg     80133e <sys_env_set_nice+0x36>
+}
+  801338:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80133c:	c9                   	leave
+  80133d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80133e:	49 89 c0             	mov    %rax,%r8
+  801341:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801346:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  80134d:	00 00 00 
+  801350:	be 26 00 00 00       	mov    $0x26,%esi
+  801355:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  80135c:	00 00 00 
+  80135f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801364:	49 b9 e3 2a 80 00 00 	movabs $0x802ae3,%r9
+  80136b:	00 00 00 
+  80136e:	41 ff d1             	call   *%r9
+
+0000000000801371 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801371:	55                   	push   %rbp
+  801372:	48 89 e5             	mov    %rsp,%rbp
+  801375:	53                   	push   %rbx
+  801376:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80137a:	48 63 ce             	movslq %esi,%rcx
+  80137d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801380:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801385:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80138f:	be 00 00 00 00       	mov    $0x0,%esi
+  801394:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80139a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80139c:	48 85 c0             	test   %rax,%rax
+  80139f:	7f 06                	jg     8013a7 <sys_env_set_status+0x36>
+}
+  8013a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a5:	c9                   	leave
+  8013a6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013a7:	49 89 c0             	mov    %rax,%r8
+  8013aa:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013af:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  8013b6:	00 00 00 
+  8013b9:	be 26 00 00 00       	mov    $0x26,%esi
+  8013be:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  8013c5:	00 00 00 
+  8013c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013cd:	49 b9 e3 2a 80 00 00 	movabs $0x802ae3,%r9
+  8013d4:	00 00 00 
+  8013d7:	41 ff d1             	call   *%r9
+
+00000000008013da <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013da:	55                   	push   %rbp
+  8013db:	48 89 e5             	mov    %rsp,%rbp
+  8013de:	53                   	push   %rbx
+  8013df:	48 83 ec 08          	sub    $0x8,%rsp
+  8013e3:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013e6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013e9:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801403:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801405:	48 85 c0             	test   %rax,%rax
+  801408:	7f 06                	jg     801410 <sys_env_set_trapframe+0x36>
+}
+  80140a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80140e:	c9                   	leave
+  80140f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801410:	49 89 c0             	mov    %rax,%r8
+  801413:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801418:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  80141f:	00 00 00 
+  801422:	be 26 00 00 00       	mov    $0x26,%esi
+  801427:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  80142e:	00 00 00 
+  801431:	b8 00 00 00 00       	mov    $0x0,%eax
+  801436:	49 b9 e3 2a 80 00 00 	movabs $0x802ae3,%r9
+  80143d:	00 00 00 
+  801440:	41 ff d1             	call   *%r9
+
+0000000000801443 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801443:	55                   	push   %rbp
+  801444:	48 89 e5             	mov    %rsp,%rbp
+  801447:	53                   	push   %rbx
+  801448:	48 83 ec 08          	sub    $0x8,%rsp
+  80144c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80144f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801452:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801457:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80145c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801461:	be 00 00 00 00       	mov    $0x0,%esi
+  801466:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80146c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80146e:	48 85 c0             	test   %rax,%rax
+  801471:	7f 06                	jg     801479 <sys_env_set_pgfault_upcall+0x36>
+}
+  801473:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801477:	c9                   	leave
+  801478:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801479:	49 89 c0             	mov    %rax,%r8
+  80147c:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801481:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  801488:	00 00 00 
+  80148b:	be 26 00 00 00       	mov    $0x26,%esi
+  801490:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  801497:	00 00 00 
+  80149a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80149f:	49 b9 e3 2a 80 00 00 	movabs $0x802ae3,%r9
+  8014a6:	00 00 00 
+  8014a9:	41 ff d1             	call   *%r9
+
+00000000008014ac <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014ac:	55                   	push   %rbp
+  8014ad:	48 89 e5             	mov    %rsp,%rbp
+  8014b0:	53                   	push   %rbx
+  8014b1:	89 f8                	mov    %edi,%eax
+  8014b3:	49 89 f1             	mov    %rsi,%r9
+  8014b6:	48 89 d3             	mov    %rdx,%rbx
+  8014b9:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014bc:	49 63 f0             	movslq %r8d,%rsi
+  8014bf:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c2:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014c7:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d0:	cd 30                	int    $0x30
+}
+  8014d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d6:	c9                   	leave
+  8014d7:	c3                   	ret
+
+00000000008014d8 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8014d8:	55                   	push   %rbp
+  8014d9:	48 89 e5             	mov    %rsp,%rbp
+  8014dc:	53                   	push   %rbx
+  8014dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8014e1:	48 89 fa             	mov    %rdi,%rdx
+  8014e4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e7:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801501:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801503:	48 85 c0             	test   %rax,%rax
+  801506:	7f 06                	jg     80150e <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801508:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80150c:	c9                   	leave
+  80150d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80150e:	49 89 c0             	mov    %rax,%r8
+  801511:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801516:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  80151d:	00 00 00 
+  801520:	be 26 00 00 00       	mov    $0x26,%esi
+  801525:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  80152c:	00 00 00 
+  80152f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801534:	49 b9 e3 2a 80 00 00 	movabs $0x802ae3,%r9
+  80153b:	00 00 00 
+  80153e:	41 ff d1             	call   *%r9
+
+0000000000801541 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801541:	55                   	push   %rbp
+  801542:	48 89 e5             	mov    %rsp,%rbp
+  801545:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801546:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80154b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801550:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801555:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80155f:	be 00 00 00 00       	mov    $0x0,%esi
+  801564:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80156a:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80156c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801570:	c9                   	leave
+  801571:	c3                   	ret
+
+0000000000801572 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  801572:	55                   	push   %rbp
+  801573:	48 89 e5             	mov    %rsp,%rbp
+  801576:	53                   	push   %rbx
+  801577:	48 83 ec 08          	sub    $0x8,%rsp
+  80157b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  80157e:	48 63 ce             	movslq %esi,%rcx
+  801581:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801584:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801589:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80158e:	be 00 00 00 00       	mov    $0x0,%esi
+  801593:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801599:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80159b:	48 85 c0             	test   %rax,%rax
+  80159e:	7f 06                	jg     8015a6 <sys_sigqueue+0x34>
+}
+  8015a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a4:	c9                   	leave
+  8015a5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015a6:	49 89 c0             	mov    %rax,%r8
+  8015a9:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8015ae:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  8015b5:	00 00 00 
+  8015b8:	be 26 00 00 00       	mov    $0x26,%esi
+  8015bd:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  8015c4:	00 00 00 
+  8015c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015cc:	49 b9 e3 2a 80 00 00 	movabs $0x802ae3,%r9
+  8015d3:	00 00 00 
+  8015d6:	41 ff d1             	call   *%r9
+
+00000000008015d9 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8015d9:	55                   	push   %rbp
+  8015da:	48 89 e5             	mov    %rsp,%rbp
+  8015dd:	53                   	push   %rbx
+  8015de:	48 83 ec 08          	sub    $0x8,%rsp
+  8015e2:	48 89 fa             	mov    %rdi,%rdx
+  8015e5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e8:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801602:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801604:	48 85 c0             	test   %rax,%rax
+  801607:	7f 06                	jg     80160f <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801609:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80160d:	c9                   	leave
+  80160e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80160f:	49 89 c0             	mov    %rax,%r8
+  801612:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801617:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  80161e:	00 00 00 
+  801621:	be 26 00 00 00       	mov    $0x26,%esi
+  801626:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  80162d:	00 00 00 
+  801630:	b8 00 00 00 00       	mov    $0x0,%eax
+  801635:	49 b9 e3 2a 80 00 00 	movabs $0x802ae3,%r9
+  80163c:	00 00 00 
+  80163f:	41 ff d1             	call   *%r9
+
+0000000000801642 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801642:	55                   	push   %rbp
+  801643:	48 89 e5             	mov    %rsp,%rbp
+  801646:	53                   	push   %rbx
+  801647:	48 83 ec 08          	sub    $0x8,%rsp
+  80164b:	48 89 f1             	mov    %rsi,%rcx
+  80164e:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801651:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801654:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801659:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80165e:	be 00 00 00 00       	mov    $0x0,%esi
+  801663:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801669:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80166b:	48 85 c0             	test   %rax,%rax
+  80166e:	7f 06                	jg     801676 <sys_sigaction+0x34>
+}
+  801670:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801674:	c9                   	leave
+  801675:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801676:	49 89 c0             	mov    %rax,%r8
+  801679:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80167e:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  801685:	00 00 00 
+  801688:	be 26 00 00 00       	mov    $0x26,%esi
+  80168d:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  801694:	00 00 00 
+  801697:	b8 00 00 00 00       	mov    $0x0,%eax
+  80169c:	49 b9 e3 2a 80 00 00 	movabs $0x802ae3,%r9
+  8016a3:	00 00 00 
+  8016a6:	41 ff d1             	call   *%r9
+
+00000000008016a9 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8016a9:	55                   	push   %rbp
+  8016aa:	48 89 e5             	mov    %rsp,%rbp
+  8016ad:	53                   	push   %rbx
+  8016ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8016b2:	48 89 f1             	mov    %rsi,%rcx
+  8016b5:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8016b8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016bb:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016d2:	48 85 c0             	test   %rax,%rax
+  8016d5:	7f 06                	jg     8016dd <sys_sigprocmask+0x34>
+}
+  8016d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016db:	c9                   	leave
+  8016dc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016dd:	49 89 c0             	mov    %rax,%r8
+  8016e0:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8016e5:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  8016ec:	00 00 00 
+  8016ef:	be 26 00 00 00       	mov    $0x26,%esi
+  8016f4:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  8016fb:	00 00 00 
+  8016fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801703:	49 b9 e3 2a 80 00 00 	movabs $0x802ae3,%r9
+  80170a:	00 00 00 
+  80170d:	41 ff d1             	call   *%r9
+
+0000000000801710 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801710:	55                   	push   %rbp
+  801711:	48 89 e5             	mov    %rsp,%rbp
+  801714:	41 54                	push   %r12
+  801716:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801717:	b8 08 00 00 00       	mov    $0x8,%eax
+  80171c:	cd 30                	int    $0x30
+  80171e:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  801721:	85 c0                	test   %eax,%eax
+  801723:	78 76                	js     80179b <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  801725:	74 7c                	je     8017a3 <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  801727:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80172d:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801734:	00 00 00 
+  801737:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80173c:	89 c2                	mov    %eax,%edx
+  80173e:	be 00 00 00 00       	mov    $0x0,%esi
+  801743:	bf 00 00 00 00       	mov    $0x0,%edi
+  801748:	48 b8 d5 11 80 00 00 	movabs $0x8011d5,%rax
+  80174f:	00 00 00 
+  801752:	ff d0                	call   *%rax
+  801754:	85 c0                	test   %eax,%eax
+  801756:	75 7a                	jne    8017d2 <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  801758:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80175f:	00 00 00 
+  801762:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801769:	44 89 e7             	mov    %r12d,%edi
+  80176c:	48 b8 43 14 80 00 00 	movabs $0x801443,%rax
+  801773:	00 00 00 
+  801776:	ff d0                	call   *%rax
+  801778:	85 c0                	test   %eax,%eax
+  80177a:	75 5e                	jne    8017da <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  80177c:	be 02 00 00 00       	mov    $0x2,%esi
+  801781:	44 89 e7             	mov    %r12d,%edi
+  801784:	48 b8 71 13 80 00 00 	movabs $0x801371,%rax
+  80178b:	00 00 00 
+  80178e:	ff d0                	call   *%rax
+        return -1;
+  801790:	85 c0                	test   %eax,%eax
+  801792:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801797:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  80179b:	44 89 e0             	mov    %r12d,%eax
+  80179e:	5b                   	pop    %rbx
+  80179f:	41 5c                	pop    %r12
+  8017a1:	5d                   	pop    %rbp
+  8017a2:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  8017a3:	48 b8 ae 10 80 00 00 	movabs $0x8010ae,%rax
+  8017aa:	00 00 00 
+  8017ad:	ff d0                	call   *%rax
+  8017af:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  8017b2:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8017b9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8017c0:	00 00 00 
+  8017c3:	48 01 d0             	add    %rdx,%rax
+  8017c6:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8017cd:	00 00 00 
+        return 0;
+  8017d0:	eb c9                	jmp    80179b <fork+0x8b>
+        return -1;
+  8017d2:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8017d8:	eb c1                	jmp    80179b <fork+0x8b>
+        return -1;
+  8017da:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8017e0:	eb b9                	jmp    80179b <fork+0x8b>
+
+00000000008017e2 <sfork>:
+
+envid_t
+sfork() {
+  8017e2:	55                   	push   %rbp
+  8017e3:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8017e6:	48 ba 9d 32 80 00 00 	movabs $0x80329d,%rdx
+  8017ed:	00 00 00 
+  8017f0:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8017f5:	48 bf b8 32 80 00 00 	movabs $0x8032b8,%rdi
+  8017fc:	00 00 00 
+  8017ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801804:	48 b9 e3 2a 80 00 00 	movabs $0x802ae3,%rcx
+  80180b:	00 00 00 
+  80180e:	ff d1                	call   *%rcx
+
+0000000000801810 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801810:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801817:	ff ff ff 
+  80181a:	48 01 f8             	add    %rdi,%rax
+  80181d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801821:	c3                   	ret
+
+0000000000801822 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801822:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801829:	ff ff ff 
+  80182c:	48 01 f8             	add    %rdi,%rax
+  80182f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801833:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801839:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80183d:	c3                   	ret
+
+000000000080183e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80183e:	55                   	push   %rbp
+  80183f:	48 89 e5             	mov    %rsp,%rbp
+  801842:	41 57                	push   %r15
+  801844:	41 56                	push   %r14
+  801846:	41 55                	push   %r13
+  801848:	41 54                	push   %r12
+  80184a:	53                   	push   %rbx
+  80184b:	48 83 ec 08          	sub    $0x8,%rsp
+  80184f:	49 89 ff             	mov    %rdi,%r15
+  801852:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801857:	49 bd bc 27 80 00 00 	movabs $0x8027bc,%r13
+  80185e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801861:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801867:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80186a:	48 89 df             	mov    %rbx,%rdi
+  80186d:	41 ff d5             	call   *%r13
+  801870:	83 e0 04             	and    $0x4,%eax
+  801873:	74 17                	je     80188c <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801875:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80187c:	4c 39 f3             	cmp    %r14,%rbx
+  80187f:	75 e6                	jne    801867 <fd_alloc+0x29>
+  801881:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801887:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80188c:	4d 89 27             	mov    %r12,(%r15)
+}
+  80188f:	48 83 c4 08          	add    $0x8,%rsp
+  801893:	5b                   	pop    %rbx
+  801894:	41 5c                	pop    %r12
+  801896:	41 5d                	pop    %r13
+  801898:	41 5e                	pop    %r14
+  80189a:	41 5f                	pop    %r15
+  80189c:	5d                   	pop    %rbp
+  80189d:	c3                   	ret
+
+000000000080189e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80189e:	83 ff 1f             	cmp    $0x1f,%edi
+  8018a1:	77 39                	ja     8018dc <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8018a3:	55                   	push   %rbp
+  8018a4:	48 89 e5             	mov    %rsp,%rbp
+  8018a7:	41 54                	push   %r12
+  8018a9:	53                   	push   %rbx
+  8018aa:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8018ad:	48 63 df             	movslq %edi,%rbx
+  8018b0:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8018b7:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8018bb:	48 89 df             	mov    %rbx,%rdi
+  8018be:	48 b8 bc 27 80 00 00 	movabs $0x8027bc,%rax
+  8018c5:	00 00 00 
+  8018c8:	ff d0                	call   *%rax
+  8018ca:	a8 04                	test   $0x4,%al
+  8018cc:	74 14                	je     8018e2 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8018ce:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8018d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018d7:	5b                   	pop    %rbx
+  8018d8:	41 5c                	pop    %r12
+  8018da:	5d                   	pop    %rbp
+  8018db:	c3                   	ret
+        return -E_INVAL;
+  8018dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018e1:	c3                   	ret
+        return -E_INVAL;
+  8018e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018e7:	eb ee                	jmp    8018d7 <fd_lookup+0x39>
+
+00000000008018e9 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8018e9:	55                   	push   %rbp
+  8018ea:	48 89 e5             	mov    %rsp,%rbp
+  8018ed:	41 54                	push   %r12
+  8018ef:	53                   	push   %rbx
+  8018f0:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8018f3:	48 b8 60 33 80 00 00 	movabs $0x803360,%rax
+  8018fa:	00 00 00 
+  8018fd:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801904:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801907:	39 3b                	cmp    %edi,(%rbx)
+  801909:	74 47                	je     801952 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80190b:	48 83 c0 08          	add    $0x8,%rax
+  80190f:	48 8b 18             	mov    (%rax),%rbx
+  801912:	48 85 db             	test   %rbx,%rbx
+  801915:	75 f0                	jne    801907 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801917:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80191e:	00 00 00 
+  801921:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801927:	89 fa                	mov    %edi,%edx
+  801929:	48 bf c8 32 80 00 00 	movabs $0x8032c8,%rdi
+  801930:	00 00 00 
+  801933:	b8 00 00 00 00       	mov    $0x0,%eax
+  801938:	48 b9 99 02 80 00 00 	movabs $0x800299,%rcx
+  80193f:	00 00 00 
+  801942:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801944:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801949:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80194d:	5b                   	pop    %rbx
+  80194e:	41 5c                	pop    %r12
+  801950:	5d                   	pop    %rbp
+  801951:	c3                   	ret
+            return 0;
+  801952:	b8 00 00 00 00       	mov    $0x0,%eax
+  801957:	eb f0                	jmp    801949 <dev_lookup+0x60>
+
+0000000000801959 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801959:	55                   	push   %rbp
+  80195a:	48 89 e5             	mov    %rsp,%rbp
+  80195d:	41 55                	push   %r13
+  80195f:	41 54                	push   %r12
+  801961:	53                   	push   %rbx
+  801962:	48 83 ec 18          	sub    $0x18,%rsp
+  801966:	48 89 fb             	mov    %rdi,%rbx
+  801969:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80196c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801973:	ff ff ff 
+  801976:	48 01 df             	add    %rbx,%rdi
+  801979:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80197d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801981:	48 b8 9e 18 80 00 00 	movabs $0x80189e,%rax
+  801988:	00 00 00 
+  80198b:	ff d0                	call   *%rax
+  80198d:	41 89 c5             	mov    %eax,%r13d
+  801990:	85 c0                	test   %eax,%eax
+  801992:	78 06                	js     80199a <fd_close+0x41>
+  801994:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801998:	74 1a                	je     8019b4 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80199a:	45 84 e4             	test   %r12b,%r12b
+  80199d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a2:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8019a6:	44 89 e8             	mov    %r13d,%eax
+  8019a9:	48 83 c4 18          	add    $0x18,%rsp
+  8019ad:	5b                   	pop    %rbx
+  8019ae:	41 5c                	pop    %r12
+  8019b0:	41 5d                	pop    %r13
+  8019b2:	5d                   	pop    %rbp
+  8019b3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019b4:	8b 3b                	mov    (%rbx),%edi
+  8019b6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019ba:	48 b8 e9 18 80 00 00 	movabs $0x8018e9,%rax
+  8019c1:	00 00 00 
+  8019c4:	ff d0                	call   *%rax
+  8019c6:	41 89 c5             	mov    %eax,%r13d
+  8019c9:	85 c0                	test   %eax,%eax
+  8019cb:	78 1b                	js     8019e8 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8019cd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019d1:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8019d5:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019db:	48 85 c0             	test   %rax,%rax
+  8019de:	74 08                	je     8019e8 <fd_close+0x8f>
+  8019e0:	48 89 df             	mov    %rbx,%rdi
+  8019e3:	ff d0                	call   *%rax
+  8019e5:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8019e8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019ed:	48 89 de             	mov    %rbx,%rsi
+  8019f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019f5:	48 b8 3a 12 80 00 00 	movabs $0x80123a,%rax
+  8019fc:	00 00 00 
+  8019ff:	ff d0                	call   *%rax
+    return res;
+  801a01:	eb a3                	jmp    8019a6 <fd_close+0x4d>
+
+0000000000801a03 <close>:
+
+int
+close(int fdnum) {
+  801a03:	55                   	push   %rbp
+  801a04:	48 89 e5             	mov    %rsp,%rbp
+  801a07:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a0b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a0f:	48 b8 9e 18 80 00 00 	movabs $0x80189e,%rax
+  801a16:	00 00 00 
+  801a19:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a1b:	85 c0                	test   %eax,%eax
+  801a1d:	78 15                	js     801a34 <close+0x31>
+
+    return fd_close(fd, 1);
+  801a1f:	be 01 00 00 00       	mov    $0x1,%esi
+  801a24:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a28:	48 b8 59 19 80 00 00 	movabs $0x801959,%rax
+  801a2f:	00 00 00 
+  801a32:	ff d0                	call   *%rax
+}
+  801a34:	c9                   	leave
+  801a35:	c3                   	ret
+
+0000000000801a36 <close_all>:
+
+void
+close_all(void) {
+  801a36:	55                   	push   %rbp
+  801a37:	48 89 e5             	mov    %rsp,%rbp
+  801a3a:	41 54                	push   %r12
+  801a3c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a42:	49 bc 03 1a 80 00 00 	movabs $0x801a03,%r12
+  801a49:	00 00 00 
+  801a4c:	89 df                	mov    %ebx,%edi
+  801a4e:	41 ff d4             	call   *%r12
+  801a51:	83 c3 01             	add    $0x1,%ebx
+  801a54:	83 fb 20             	cmp    $0x20,%ebx
+  801a57:	75 f3                	jne    801a4c <close_all+0x16>
+}
+  801a59:	5b                   	pop    %rbx
+  801a5a:	41 5c                	pop    %r12
+  801a5c:	5d                   	pop    %rbp
+  801a5d:	c3                   	ret
+
+0000000000801a5e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a5e:	55                   	push   %rbp
+  801a5f:	48 89 e5             	mov    %rsp,%rbp
+  801a62:	41 57                	push   %r15
+  801a64:	41 56                	push   %r14
+  801a66:	41 55                	push   %r13
+  801a68:	41 54                	push   %r12
+  801a6a:	53                   	push   %rbx
+  801a6b:	48 83 ec 18          	sub    $0x18,%rsp
+  801a6f:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a72:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a76:	48 b8 9e 18 80 00 00 	movabs $0x80189e,%rax
+  801a7d:	00 00 00 
+  801a80:	ff d0                	call   *%rax
+  801a82:	89 c3                	mov    %eax,%ebx
+  801a84:	85 c0                	test   %eax,%eax
+  801a86:	0f 88 b8 00 00 00    	js     801b44 <dup+0xe6>
+    close(newfdnum);
+  801a8c:	44 89 e7             	mov    %r12d,%edi
+  801a8f:	48 b8 03 1a 80 00 00 	movabs $0x801a03,%rax
+  801a96:	00 00 00 
+  801a99:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801a9b:	4d 63 ec             	movslq %r12d,%r13
+  801a9e:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801aa5:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801aa9:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801aad:	4c 89 ff             	mov    %r15,%rdi
+  801ab0:	49 be 22 18 80 00 00 	movabs $0x801822,%r14
+  801ab7:	00 00 00 
+  801aba:	41 ff d6             	call   *%r14
+  801abd:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801ac0:	4c 89 ef             	mov    %r13,%rdi
+  801ac3:	41 ff d6             	call   *%r14
+  801ac6:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801ac9:	48 89 df             	mov    %rbx,%rdi
+  801acc:	48 b8 bc 27 80 00 00 	movabs $0x8027bc,%rax
+  801ad3:	00 00 00 
+  801ad6:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801ad8:	a8 04                	test   $0x4,%al
+  801ada:	74 2b                	je     801b07 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801adc:	41 89 c1             	mov    %eax,%r9d
+  801adf:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ae5:	4c 89 f1             	mov    %r14,%rcx
+  801ae8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aed:	48 89 de             	mov    %rbx,%rsi
+  801af0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801af5:	48 b8 d5 11 80 00 00 	movabs $0x8011d5,%rax
+  801afc:	00 00 00 
+  801aff:	ff d0                	call   *%rax
+  801b01:	89 c3                	mov    %eax,%ebx
+  801b03:	85 c0                	test   %eax,%eax
+  801b05:	78 4e                	js     801b55 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801b07:	4c 89 ff             	mov    %r15,%rdi
+  801b0a:	48 b8 bc 27 80 00 00 	movabs $0x8027bc,%rax
+  801b11:	00 00 00 
+  801b14:	ff d0                	call   *%rax
+  801b16:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b19:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b1f:	4c 89 e9             	mov    %r13,%rcx
+  801b22:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b27:	4c 89 fe             	mov    %r15,%rsi
+  801b2a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b2f:	48 b8 d5 11 80 00 00 	movabs $0x8011d5,%rax
+  801b36:	00 00 00 
+  801b39:	ff d0                	call   *%rax
+  801b3b:	89 c3                	mov    %eax,%ebx
+  801b3d:	85 c0                	test   %eax,%eax
+  801b3f:	78 14                	js     801b55 <dup+0xf7>
+
+    return newfdnum;
+  801b41:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801b44:	89 d8                	mov    %ebx,%eax
+  801b46:	48 83 c4 18          	add    $0x18,%rsp
+  801b4a:	5b                   	pop    %rbx
+  801b4b:	41 5c                	pop    %r12
+  801b4d:	41 5d                	pop    %r13
+  801b4f:	41 5e                	pop    %r14
+  801b51:	41 5f                	pop    %r15
+  801b53:	5d                   	pop    %rbp
+  801b54:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b55:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b5a:	4c 89 ee             	mov    %r13,%rsi
+  801b5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b62:	49 bc 3a 12 80 00 00 	movabs $0x80123a,%r12
+  801b69:	00 00 00 
+  801b6c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801b6f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b74:	4c 89 f6             	mov    %r14,%rsi
+  801b77:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b7c:	41 ff d4             	call   *%r12
+    return res;
+  801b7f:	eb c3                	jmp    801b44 <dup+0xe6>
+
+0000000000801b81 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801b81:	55                   	push   %rbp
+  801b82:	48 89 e5             	mov    %rsp,%rbp
+  801b85:	41 56                	push   %r14
+  801b87:	41 55                	push   %r13
+  801b89:	41 54                	push   %r12
+  801b8b:	53                   	push   %rbx
+  801b8c:	48 83 ec 10          	sub    $0x10,%rsp
+  801b90:	89 fb                	mov    %edi,%ebx
+  801b92:	49 89 f4             	mov    %rsi,%r12
+  801b95:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b98:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b9c:	48 b8 9e 18 80 00 00 	movabs $0x80189e,%rax
+  801ba3:	00 00 00 
+  801ba6:	ff d0                	call   *%rax
+  801ba8:	85 c0                	test   %eax,%eax
+  801baa:	78 4c                	js     801bf8 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bac:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bb0:	41 8b 3e             	mov    (%r14),%edi
+  801bb3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bb7:	48 b8 e9 18 80 00 00 	movabs $0x8018e9,%rax
+  801bbe:	00 00 00 
+  801bc1:	ff d0                	call   *%rax
+  801bc3:	85 c0                	test   %eax,%eax
+  801bc5:	78 35                	js     801bfc <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801bc7:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801bcb:	83 e0 03             	and    $0x3,%eax
+  801bce:	83 f8 01             	cmp    $0x1,%eax
+  801bd1:	74 2d                	je     801c00 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801bd3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bd7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801bdb:	48 85 c0             	test   %rax,%rax
+  801bde:	74 56                	je     801c36 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801be0:	4c 89 ea             	mov    %r13,%rdx
+  801be3:	4c 89 e6             	mov    %r12,%rsi
+  801be6:	4c 89 f7             	mov    %r14,%rdi
+  801be9:	ff d0                	call   *%rax
+}
+  801beb:	48 83 c4 10          	add    $0x10,%rsp
+  801bef:	5b                   	pop    %rbx
+  801bf0:	41 5c                	pop    %r12
+  801bf2:	41 5d                	pop    %r13
+  801bf4:	41 5e                	pop    %r14
+  801bf6:	5d                   	pop    %rbp
+  801bf7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bf8:	48 98                	cltq
+  801bfa:	eb ef                	jmp    801beb <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bfc:	48 98                	cltq
+  801bfe:	eb eb                	jmp    801beb <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c00:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c07:	00 00 00 
+  801c0a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c10:	89 da                	mov    %ebx,%edx
+  801c12:	48 bf 09 33 80 00 00 	movabs $0x803309,%rdi
+  801c19:	00 00 00 
+  801c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c21:	48 b9 99 02 80 00 00 	movabs $0x800299,%rcx
+  801c28:	00 00 00 
+  801c2b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c2d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c34:	eb b5                	jmp    801beb <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c36:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c3d:	eb ac                	jmp    801beb <read+0x6a>
+
+0000000000801c3f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c3f:	55                   	push   %rbp
+  801c40:	48 89 e5             	mov    %rsp,%rbp
+  801c43:	41 57                	push   %r15
+  801c45:	41 56                	push   %r14
+  801c47:	41 55                	push   %r13
+  801c49:	41 54                	push   %r12
+  801c4b:	53                   	push   %rbx
+  801c4c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c50:	48 85 d2             	test   %rdx,%rdx
+  801c53:	74 54                	je     801ca9 <readn+0x6a>
+  801c55:	41 89 fd             	mov    %edi,%r13d
+  801c58:	49 89 f6             	mov    %rsi,%r14
+  801c5b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801c5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801c63:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801c68:	49 bf 81 1b 80 00 00 	movabs $0x801b81,%r15
+  801c6f:	00 00 00 
+  801c72:	4c 89 e2             	mov    %r12,%rdx
+  801c75:	48 29 f2             	sub    %rsi,%rdx
+  801c78:	4c 01 f6             	add    %r14,%rsi
+  801c7b:	44 89 ef             	mov    %r13d,%edi
+  801c7e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801c81:	85 c0                	test   %eax,%eax
+  801c83:	78 20                	js     801ca5 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801c85:	01 c3                	add    %eax,%ebx
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	74 08                	je     801c93 <readn+0x54>
+  801c8b:	48 63 f3             	movslq %ebx,%rsi
+  801c8e:	4c 39 e6             	cmp    %r12,%rsi
+  801c91:	72 df                	jb     801c72 <readn+0x33>
+    }
+    return res;
+  801c93:	48 63 c3             	movslq %ebx,%rax
+}
+  801c96:	48 83 c4 08          	add    $0x8,%rsp
+  801c9a:	5b                   	pop    %rbx
+  801c9b:	41 5c                	pop    %r12
+  801c9d:	41 5d                	pop    %r13
+  801c9f:	41 5e                	pop    %r14
+  801ca1:	41 5f                	pop    %r15
+  801ca3:	5d                   	pop    %rbp
+  801ca4:	c3                   	ret
+        if (inc < 0) return inc;
+  801ca5:	48 98                	cltq
+  801ca7:	eb ed                	jmp    801c96 <readn+0x57>
+    int inc = 1, res = 0;
+  801ca9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cae:	eb e3                	jmp    801c93 <readn+0x54>
+
+0000000000801cb0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801cb0:	55                   	push   %rbp
+  801cb1:	48 89 e5             	mov    %rsp,%rbp
+  801cb4:	41 56                	push   %r14
+  801cb6:	41 55                	push   %r13
+  801cb8:	41 54                	push   %r12
+  801cba:	53                   	push   %rbx
+  801cbb:	48 83 ec 10          	sub    $0x10,%rsp
+  801cbf:	89 fb                	mov    %edi,%ebx
+  801cc1:	49 89 f4             	mov    %rsi,%r12
+  801cc4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cc7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ccb:	48 b8 9e 18 80 00 00 	movabs $0x80189e,%rax
+  801cd2:	00 00 00 
+  801cd5:	ff d0                	call   *%rax
+  801cd7:	85 c0                	test   %eax,%eax
+  801cd9:	78 47                	js     801d22 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cdb:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cdf:	41 8b 3e             	mov    (%r14),%edi
+  801ce2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ce6:	48 b8 e9 18 80 00 00 	movabs $0x8018e9,%rax
+  801ced:	00 00 00 
+  801cf0:	ff d0                	call   *%rax
+  801cf2:	85 c0                	test   %eax,%eax
+  801cf4:	78 30                	js     801d26 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cf6:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801cfb:	74 2d                	je     801d2a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801cfd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d01:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d05:	48 85 c0             	test   %rax,%rax
+  801d08:	74 56                	je     801d60 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801d0a:	4c 89 ea             	mov    %r13,%rdx
+  801d0d:	4c 89 e6             	mov    %r12,%rsi
+  801d10:	4c 89 f7             	mov    %r14,%rdi
+  801d13:	ff d0                	call   *%rax
+}
+  801d15:	48 83 c4 10          	add    $0x10,%rsp
+  801d19:	5b                   	pop    %rbx
+  801d1a:	41 5c                	pop    %r12
+  801d1c:	41 5d                	pop    %r13
+  801d1e:	41 5e                	pop    %r14
+  801d20:	5d                   	pop    %rbp
+  801d21:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d22:	48 98                	cltq
+  801d24:	eb ef                	jmp    801d15 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d26:	48 98                	cltq
+  801d28:	eb eb                	jmp    801d15 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d2a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d31:	00 00 00 
+  801d34:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d3a:	89 da                	mov    %ebx,%edx
+  801d3c:	48 bf 25 33 80 00 00 	movabs $0x803325,%rdi
+  801d43:	00 00 00 
+  801d46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d4b:	48 b9 99 02 80 00 00 	movabs $0x800299,%rcx
+  801d52:	00 00 00 
+  801d55:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d57:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d5e:	eb b5                	jmp    801d15 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d60:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d67:	eb ac                	jmp    801d15 <write+0x65>
+
+0000000000801d69 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801d69:	55                   	push   %rbp
+  801d6a:	48 89 e5             	mov    %rsp,%rbp
+  801d6d:	53                   	push   %rbx
+  801d6e:	48 83 ec 18          	sub    $0x18,%rsp
+  801d72:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d74:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d78:	48 b8 9e 18 80 00 00 	movabs $0x80189e,%rax
+  801d7f:	00 00 00 
+  801d82:	ff d0                	call   *%rax
+  801d84:	85 c0                	test   %eax,%eax
+  801d86:	78 0c                	js     801d94 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801d88:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d8c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801d8f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d94:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d98:	c9                   	leave
+  801d99:	c3                   	ret
+
+0000000000801d9a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801d9a:	55                   	push   %rbp
+  801d9b:	48 89 e5             	mov    %rsp,%rbp
+  801d9e:	41 55                	push   %r13
+  801da0:	41 54                	push   %r12
+  801da2:	53                   	push   %rbx
+  801da3:	48 83 ec 18          	sub    $0x18,%rsp
+  801da7:	89 fb                	mov    %edi,%ebx
+  801da9:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dac:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801db0:	48 b8 9e 18 80 00 00 	movabs $0x80189e,%rax
+  801db7:	00 00 00 
+  801dba:	ff d0                	call   *%rax
+  801dbc:	85 c0                	test   %eax,%eax
+  801dbe:	78 38                	js     801df8 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dc0:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801dc4:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801dc8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dcc:	48 b8 e9 18 80 00 00 	movabs $0x8018e9,%rax
+  801dd3:	00 00 00 
+  801dd6:	ff d0                	call   *%rax
+  801dd8:	85 c0                	test   %eax,%eax
+  801dda:	78 1c                	js     801df8 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ddc:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801de1:	74 20                	je     801e03 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801de3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801de7:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801deb:	48 85 c0             	test   %rax,%rax
+  801dee:	74 47                	je     801e37 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801df0:	44 89 e6             	mov    %r12d,%esi
+  801df3:	4c 89 ef             	mov    %r13,%rdi
+  801df6:	ff d0                	call   *%rax
+}
+  801df8:	48 83 c4 18          	add    $0x18,%rsp
+  801dfc:	5b                   	pop    %rbx
+  801dfd:	41 5c                	pop    %r12
+  801dff:	41 5d                	pop    %r13
+  801e01:	5d                   	pop    %rbp
+  801e02:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801e03:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e0a:	00 00 00 
+  801e0d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e13:	89 da                	mov    %ebx,%edx
+  801e15:	48 bf e8 32 80 00 00 	movabs $0x8032e8,%rdi
+  801e1c:	00 00 00 
+  801e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e24:	48 b9 99 02 80 00 00 	movabs $0x800299,%rcx
+  801e2b:	00 00 00 
+  801e2e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e30:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e35:	eb c1                	jmp    801df8 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e37:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e3c:	eb ba                	jmp    801df8 <ftruncate+0x5e>
+
+0000000000801e3e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e3e:	55                   	push   %rbp
+  801e3f:	48 89 e5             	mov    %rsp,%rbp
+  801e42:	41 54                	push   %r12
+  801e44:	53                   	push   %rbx
+  801e45:	48 83 ec 10          	sub    $0x10,%rsp
+  801e49:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e4c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e50:	48 b8 9e 18 80 00 00 	movabs $0x80189e,%rax
+  801e57:	00 00 00 
+  801e5a:	ff d0                	call   *%rax
+  801e5c:	85 c0                	test   %eax,%eax
+  801e5e:	78 4e                	js     801eae <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e60:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e64:	41 8b 3c 24          	mov    (%r12),%edi
+  801e68:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e6c:	48 b8 e9 18 80 00 00 	movabs $0x8018e9,%rax
+  801e73:	00 00 00 
+  801e76:	ff d0                	call   *%rax
+  801e78:	85 c0                	test   %eax,%eax
+  801e7a:	78 32                	js     801eae <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e7c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e80:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801e85:	74 30                	je     801eb7 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801e87:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801e8a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801e91:	00 00 00 
+    stat->st_isdir = 0;
+  801e94:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801e9b:	00 00 00 
+    stat->st_dev = dev;
+  801e9e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801ea5:	48 89 de             	mov    %rbx,%rsi
+  801ea8:	4c 89 e7             	mov    %r12,%rdi
+  801eab:	ff 50 28             	call   *0x28(%rax)
+}
+  801eae:	48 83 c4 10          	add    $0x10,%rsp
+  801eb2:	5b                   	pop    %rbx
+  801eb3:	41 5c                	pop    %r12
+  801eb5:	5d                   	pop    %rbp
+  801eb6:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801eb7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ebc:	eb f0                	jmp    801eae <fstat+0x70>
+
+0000000000801ebe <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801ebe:	55                   	push   %rbp
+  801ebf:	48 89 e5             	mov    %rsp,%rbp
+  801ec2:	41 54                	push   %r12
+  801ec4:	53                   	push   %rbx
+  801ec5:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801ec8:	be 00 00 00 00       	mov    $0x0,%esi
+  801ecd:	48 b8 3f 21 80 00 00 	movabs $0x80213f,%rax
+  801ed4:	00 00 00 
+  801ed7:	ff d0                	call   *%rax
+  801ed9:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801edb:	85 c0                	test   %eax,%eax
+  801edd:	78 25                	js     801f04 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801edf:	4c 89 e6             	mov    %r12,%rsi
+  801ee2:	89 c7                	mov    %eax,%edi
+  801ee4:	48 b8 3e 1e 80 00 00 	movabs $0x801e3e,%rax
+  801eeb:	00 00 00 
+  801eee:	ff d0                	call   *%rax
+  801ef0:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801ef3:	89 df                	mov    %ebx,%edi
+  801ef5:	48 b8 03 1a 80 00 00 	movabs $0x801a03,%rax
+  801efc:	00 00 00 
+  801eff:	ff d0                	call   *%rax
+
+    return res;
+  801f01:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f04:	89 d8                	mov    %ebx,%eax
+  801f06:	5b                   	pop    %rbx
+  801f07:	41 5c                	pop    %r12
+  801f09:	5d                   	pop    %rbp
+  801f0a:	c3                   	ret
+
+0000000000801f0b <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801f0b:	55                   	push   %rbp
+  801f0c:	48 89 e5             	mov    %rsp,%rbp
+  801f0f:	41 54                	push   %r12
+  801f11:	53                   	push   %rbx
+  801f12:	48 83 ec 10          	sub    $0x10,%rsp
+  801f16:	41 89 fc             	mov    %edi,%r12d
+  801f19:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f1c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801f23:	00 00 00 
+  801f26:	83 38 00             	cmpl   $0x0,(%rax)
+  801f29:	74 5e                	je     801f89 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801f2b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801f31:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801f36:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801f3d:	00 00 00 
+  801f40:	44 89 e6             	mov    %r12d,%esi
+  801f43:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801f4a:	00 00 00 
+  801f4d:	8b 38                	mov    (%rax),%edi
+  801f4f:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  801f56:	00 00 00 
+  801f59:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801f5b:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801f62:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801f63:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f68:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801f6c:	48 89 de             	mov    %rbx,%rsi
+  801f6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f74:	48 b8 86 2b 80 00 00 	movabs $0x802b86,%rax
+  801f7b:	00 00 00 
+  801f7e:	ff d0                	call   *%rax
+}
+  801f80:	48 83 c4 10          	add    $0x10,%rsp
+  801f84:	5b                   	pop    %rbx
+  801f85:	41 5c                	pop    %r12
+  801f87:	5d                   	pop    %rbp
+  801f88:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f89:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f8e:	48 b8 bb 2c 80 00 00 	movabs $0x802cbb,%rax
+  801f95:	00 00 00 
+  801f98:	ff d0                	call   *%rax
+  801f9a:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801fa1:	00 00 
+  801fa3:	eb 86                	jmp    801f2b <fsipc+0x20>
+
+0000000000801fa5 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801fa5:	55                   	push   %rbp
+  801fa6:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801fa9:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801fb0:	00 00 00 
+  801fb3:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801fb6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801fb8:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801fbb:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc0:	bf 02 00 00 00       	mov    $0x2,%edi
+  801fc5:	48 b8 0b 1f 80 00 00 	movabs $0x801f0b,%rax
+  801fcc:	00 00 00 
+  801fcf:	ff d0                	call   *%rax
+}
+  801fd1:	5d                   	pop    %rbp
+  801fd2:	c3                   	ret
+
+0000000000801fd3 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801fd3:	55                   	push   %rbp
+  801fd4:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801fd7:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801fda:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801fe1:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801fe3:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe8:	bf 06 00 00 00       	mov    $0x6,%edi
+  801fed:	48 b8 0b 1f 80 00 00 	movabs $0x801f0b,%rax
+  801ff4:	00 00 00 
+  801ff7:	ff d0                	call   *%rax
+}
+  801ff9:	5d                   	pop    %rbp
+  801ffa:	c3                   	ret
+
+0000000000801ffb <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801ffb:	55                   	push   %rbp
+  801ffc:	48 89 e5             	mov    %rsp,%rbp
+  801fff:	41 54                	push   %r12
+  802001:	53                   	push   %rbx
+  802002:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802005:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802008:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80200f:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802011:	be 00 00 00 00       	mov    $0x0,%esi
+  802016:	bf 05 00 00 00       	mov    $0x5,%edi
+  80201b:	48 b8 0b 1f 80 00 00 	movabs $0x801f0b,%rax
+  802022:	00 00 00 
+  802025:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802027:	85 c0                	test   %eax,%eax
+  802029:	78 3d                	js     802068 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80202b:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802032:	00 00 00 
+  802035:	4c 89 e6             	mov    %r12,%rsi
+  802038:	48 89 df             	mov    %rbx,%rdi
+  80203b:	48 b8 be 0b 80 00 00 	movabs $0x800bbe,%rax
+  802042:	00 00 00 
+  802045:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802047:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80204e:	00 
+  80204f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802055:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80205c:	00 
+  80205d:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802063:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802068:	5b                   	pop    %rbx
+  802069:	41 5c                	pop    %r12
+  80206b:	5d                   	pop    %rbp
+  80206c:	c3                   	ret
+
+000000000080206d <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80206d:	55                   	push   %rbp
+  80206e:	48 89 e5             	mov    %rsp,%rbp
+  802071:	41 54                	push   %r12
+  802073:	53                   	push   %rbx
+  802074:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  802077:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80207c:	48 39 c2             	cmp    %rax,%rdx
+  80207f:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802083:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802086:	48 89 c2             	mov    %rax,%rdx
+  802089:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802090:	00 00 00 
+  802093:	48 b8 1f 0e 80 00 00 	movabs $0x800e1f,%rax
+  80209a:	00 00 00 
+  80209d:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80209f:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8020a6:	00 00 00 
+  8020a9:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8020ae:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8020b0:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8020b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8020be:	48 b8 0b 1f 80 00 00 	movabs $0x801f0b,%rax
+  8020c5:	00 00 00 
+  8020c8:	ff d0                	call   *%rax
+  8020ca:	48 98                	cltq
+}
+  8020cc:	5b                   	pop    %rbx
+  8020cd:	41 5c                	pop    %r12
+  8020cf:	5d                   	pop    %rbp
+  8020d0:	c3                   	ret
+
+00000000008020d1 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8020d1:	55                   	push   %rbp
+  8020d2:	48 89 e5             	mov    %rsp,%rbp
+  8020d5:	41 54                	push   %r12
+  8020d7:	53                   	push   %rbx
+  8020d8:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020db:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8020e2:	00 00 00 
+  8020e5:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8020e8:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8020ea:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020ef:	48 39 ca             	cmp    %rcx,%rdx
+  8020f2:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8020f6:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8020fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ff:	bf 03 00 00 00       	mov    $0x3,%edi
+  802104:	48 b8 0b 1f 80 00 00 	movabs $0x801f0b,%rax
+  80210b:	00 00 00 
+  80210e:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802110:	85 c0                	test   %eax,%eax
+  802112:	78 27                	js     80213b <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802114:	48 63 d8             	movslq %eax,%rbx
+  802117:	48 89 da             	mov    %rbx,%rdx
+  80211a:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802121:	00 00 00 
+  802124:	4c 89 e7             	mov    %r12,%rdi
+  802127:	48 b8 1f 0e 80 00 00 	movabs $0x800e1f,%rax
+  80212e:	00 00 00 
+  802131:	ff d0                	call   *%rax
+    return bytes_read;
+  802133:	48 89 d8             	mov    %rbx,%rax
+}
+  802136:	5b                   	pop    %rbx
+  802137:	41 5c                	pop    %r12
+  802139:	5d                   	pop    %rbp
+  80213a:	c3                   	ret
+        return bytes_read;
+  80213b:	48 98                	cltq
+  80213d:	eb f7                	jmp    802136 <devfile_read+0x65>
+
+000000000080213f <open>:
+open(const char *path, int mode) {
+  80213f:	55                   	push   %rbp
+  802140:	48 89 e5             	mov    %rsp,%rbp
+  802143:	41 55                	push   %r13
+  802145:	41 54                	push   %r12
+  802147:	53                   	push   %rbx
+  802148:	48 83 ec 18          	sub    $0x18,%rsp
+  80214c:	49 89 fc             	mov    %rdi,%r12
+  80214f:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802152:	48 b8 80 0b 80 00 00 	movabs $0x800b80,%rax
+  802159:	00 00 00 
+  80215c:	ff d0                	call   *%rax
+  80215e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802164:	0f 87 8a 00 00 00    	ja     8021f4 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80216a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80216e:	48 b8 3e 18 80 00 00 	movabs $0x80183e,%rax
+  802175:	00 00 00 
+  802178:	ff d0                	call   *%rax
+  80217a:	89 c3                	mov    %eax,%ebx
+  80217c:	85 c0                	test   %eax,%eax
+  80217e:	78 50                	js     8021d0 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802180:	4c 89 e6             	mov    %r12,%rsi
+  802183:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80218a:	00 00 00 
+  80218d:	48 89 df             	mov    %rbx,%rdi
+  802190:	48 b8 be 0b 80 00 00 	movabs $0x800bbe,%rax
+  802197:	00 00 00 
+  80219a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80219c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021a3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8021a7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8021ac:	48 b8 0b 1f 80 00 00 	movabs $0x801f0b,%rax
+  8021b3:	00 00 00 
+  8021b6:	ff d0                	call   *%rax
+  8021b8:	89 c3                	mov    %eax,%ebx
+  8021ba:	85 c0                	test   %eax,%eax
+  8021bc:	78 1f                	js     8021dd <open+0x9e>
+    return fd2num(fd);
+  8021be:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8021c2:	48 b8 10 18 80 00 00 	movabs $0x801810,%rax
+  8021c9:	00 00 00 
+  8021cc:	ff d0                	call   *%rax
+  8021ce:	89 c3                	mov    %eax,%ebx
+}
+  8021d0:	89 d8                	mov    %ebx,%eax
+  8021d2:	48 83 c4 18          	add    $0x18,%rsp
+  8021d6:	5b                   	pop    %rbx
+  8021d7:	41 5c                	pop    %r12
+  8021d9:	41 5d                	pop    %r13
+  8021db:	5d                   	pop    %rbp
+  8021dc:	c3                   	ret
+        fd_close(fd, 0);
+  8021dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8021e6:	48 b8 59 19 80 00 00 	movabs $0x801959,%rax
+  8021ed:	00 00 00 
+  8021f0:	ff d0                	call   *%rax
+        return res;
+  8021f2:	eb dc                	jmp    8021d0 <open+0x91>
+        return -E_BAD_PATH;
+  8021f4:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8021f9:	eb d5                	jmp    8021d0 <open+0x91>
+
+00000000008021fb <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8021fb:	55                   	push   %rbp
+  8021fc:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8021ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802204:	bf 08 00 00 00       	mov    $0x8,%edi
+  802209:	48 b8 0b 1f 80 00 00 	movabs $0x801f0b,%rax
+  802210:	00 00 00 
+  802213:	ff d0                	call   *%rax
+}
+  802215:	5d                   	pop    %rbp
+  802216:	c3                   	ret
+
+0000000000802217 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802217:	55                   	push   %rbp
+  802218:	48 89 e5             	mov    %rsp,%rbp
+  80221b:	41 54                	push   %r12
+  80221d:	53                   	push   %rbx
+  80221e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802221:	48 b8 22 18 80 00 00 	movabs $0x801822,%rax
+  802228:	00 00 00 
+  80222b:	ff d0                	call   *%rax
+  80222d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802230:	48 be 80 33 80 00 00 	movabs $0x803380,%rsi
+  802237:	00 00 00 
+  80223a:	48 89 df             	mov    %rbx,%rdi
+  80223d:	48 b8 be 0b 80 00 00 	movabs $0x800bbe,%rax
+  802244:	00 00 00 
+  802247:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802249:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80224e:	41 2b 04 24          	sub    (%r12),%eax
+  802252:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802258:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80225f:	00 00 00 
+    stat->st_dev = &devpipe;
+  802262:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802269:	00 00 00 
+  80226c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802273:	b8 00 00 00 00       	mov    $0x0,%eax
+  802278:	5b                   	pop    %rbx
+  802279:	41 5c                	pop    %r12
+  80227b:	5d                   	pop    %rbp
+  80227c:	c3                   	ret
+
+000000000080227d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80227d:	55                   	push   %rbp
+  80227e:	48 89 e5             	mov    %rsp,%rbp
+  802281:	41 54                	push   %r12
+  802283:	53                   	push   %rbx
+  802284:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802287:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80228c:	48 89 fe             	mov    %rdi,%rsi
+  80228f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802294:	49 bc 3a 12 80 00 00 	movabs $0x80123a,%r12
+  80229b:	00 00 00 
+  80229e:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8022a1:	48 89 df             	mov    %rbx,%rdi
+  8022a4:	48 b8 22 18 80 00 00 	movabs $0x801822,%rax
+  8022ab:	00 00 00 
+  8022ae:	ff d0                	call   *%rax
+  8022b0:	48 89 c6             	mov    %rax,%rsi
+  8022b3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022bd:	41 ff d4             	call   *%r12
+}
+  8022c0:	5b                   	pop    %rbx
+  8022c1:	41 5c                	pop    %r12
+  8022c3:	5d                   	pop    %rbp
+  8022c4:	c3                   	ret
+
+00000000008022c5 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8022c5:	55                   	push   %rbp
+  8022c6:	48 89 e5             	mov    %rsp,%rbp
+  8022c9:	41 57                	push   %r15
+  8022cb:	41 56                	push   %r14
+  8022cd:	41 55                	push   %r13
+  8022cf:	41 54                	push   %r12
+  8022d1:	53                   	push   %rbx
+  8022d2:	48 83 ec 18          	sub    $0x18,%rsp
+  8022d6:	49 89 fc             	mov    %rdi,%r12
+  8022d9:	49 89 f5             	mov    %rsi,%r13
+  8022dc:	49 89 d7             	mov    %rdx,%r15
+  8022df:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8022e3:	48 b8 22 18 80 00 00 	movabs $0x801822,%rax
+  8022ea:	00 00 00 
+  8022ed:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8022ef:	4d 85 ff             	test   %r15,%r15
+  8022f2:	0f 84 af 00 00 00    	je     8023a7 <devpipe_write+0xe2>
+  8022f8:	48 89 c3             	mov    %rax,%rbx
+  8022fb:	4c 89 f8             	mov    %r15,%rax
+  8022fe:	4d 89 ef             	mov    %r13,%r15
+  802301:	4c 01 e8             	add    %r13,%rax
+  802304:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802308:	49 bd 42 11 80 00 00 	movabs $0x801142,%r13
+  80230f:	00 00 00 
+            sys_yield();
+  802312:	49 be df 10 80 00 00 	movabs $0x8010df,%r14
+  802319:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80231c:	8b 73 04             	mov    0x4(%rbx),%esi
+  80231f:	48 63 ce             	movslq %esi,%rcx
+  802322:	48 63 03             	movslq (%rbx),%rax
+  802325:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80232b:	48 39 c1             	cmp    %rax,%rcx
+  80232e:	72 2e                	jb     80235e <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802330:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802335:	48 89 da             	mov    %rbx,%rdx
+  802338:	be 00 10 00 00       	mov    $0x1000,%esi
+  80233d:	4c 89 e7             	mov    %r12,%rdi
+  802340:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802343:	85 c0                	test   %eax,%eax
+  802345:	74 66                	je     8023ad <devpipe_write+0xe8>
+            sys_yield();
+  802347:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80234a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80234d:	48 63 ce             	movslq %esi,%rcx
+  802350:	48 63 03             	movslq (%rbx),%rax
+  802353:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802359:	48 39 c1             	cmp    %rax,%rcx
+  80235c:	73 d2                	jae    802330 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80235e:	41 0f b6 3f          	movzbl (%r15),%edi
+  802362:	48 89 ca             	mov    %rcx,%rdx
+  802365:	48 c1 ea 03          	shr    $0x3,%rdx
+  802369:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802370:	08 10 20 
+  802373:	48 f7 e2             	mul    %rdx
+  802376:	48 c1 ea 06          	shr    $0x6,%rdx
+  80237a:	48 89 d0             	mov    %rdx,%rax
+  80237d:	48 c1 e0 09          	shl    $0x9,%rax
+  802381:	48 29 d0             	sub    %rdx,%rax
+  802384:	48 c1 e0 03          	shl    $0x3,%rax
+  802388:	48 29 c1             	sub    %rax,%rcx
+  80238b:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802390:	83 c6 01             	add    $0x1,%esi
+  802393:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802396:	49 83 c7 01          	add    $0x1,%r15
+  80239a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80239e:	49 39 c7             	cmp    %rax,%r15
+  8023a1:	0f 85 75 ff ff ff    	jne    80231c <devpipe_write+0x57>
+    return n;
+  8023a7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023ab:	eb 05                	jmp    8023b2 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8023ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023b2:	48 83 c4 18          	add    $0x18,%rsp
+  8023b6:	5b                   	pop    %rbx
+  8023b7:	41 5c                	pop    %r12
+  8023b9:	41 5d                	pop    %r13
+  8023bb:	41 5e                	pop    %r14
+  8023bd:	41 5f                	pop    %r15
+  8023bf:	5d                   	pop    %rbp
+  8023c0:	c3                   	ret
+
+00000000008023c1 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8023c1:	55                   	push   %rbp
+  8023c2:	48 89 e5             	mov    %rsp,%rbp
+  8023c5:	41 57                	push   %r15
+  8023c7:	41 56                	push   %r14
+  8023c9:	41 55                	push   %r13
+  8023cb:	41 54                	push   %r12
+  8023cd:	53                   	push   %rbx
+  8023ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8023d2:	49 89 fc             	mov    %rdi,%r12
+  8023d5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8023d9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8023dd:	48 b8 22 18 80 00 00 	movabs $0x801822,%rax
+  8023e4:	00 00 00 
+  8023e7:	ff d0                	call   *%rax
+  8023e9:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8023ec:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8023f2:	49 bd 42 11 80 00 00 	movabs $0x801142,%r13
+  8023f9:	00 00 00 
+            sys_yield();
+  8023fc:	49 be df 10 80 00 00 	movabs $0x8010df,%r14
+  802403:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802406:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80240b:	74 7d                	je     80248a <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80240d:	8b 03                	mov    (%rbx),%eax
+  80240f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802412:	75 26                	jne    80243a <devpipe_read+0x79>
+            if (i > 0) return i;
+  802414:	4d 85 ff             	test   %r15,%r15
+  802417:	75 77                	jne    802490 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802419:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80241e:	48 89 da             	mov    %rbx,%rdx
+  802421:	be 00 10 00 00       	mov    $0x1000,%esi
+  802426:	4c 89 e7             	mov    %r12,%rdi
+  802429:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80242c:	85 c0                	test   %eax,%eax
+  80242e:	74 72                	je     8024a2 <devpipe_read+0xe1>
+            sys_yield();
+  802430:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802433:	8b 03                	mov    (%rbx),%eax
+  802435:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802438:	74 df                	je     802419 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80243a:	48 63 c8             	movslq %eax,%rcx
+  80243d:	48 89 ca             	mov    %rcx,%rdx
+  802440:	48 c1 ea 03          	shr    $0x3,%rdx
+  802444:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80244b:	08 10 20 
+  80244e:	48 89 d0             	mov    %rdx,%rax
+  802451:	48 f7 e6             	mul    %rsi
+  802454:	48 c1 ea 06          	shr    $0x6,%rdx
+  802458:	48 89 d0             	mov    %rdx,%rax
+  80245b:	48 c1 e0 09          	shl    $0x9,%rax
+  80245f:	48 29 d0             	sub    %rdx,%rax
+  802462:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802469:	00 
+  80246a:	48 89 c8             	mov    %rcx,%rax
+  80246d:	48 29 d0             	sub    %rdx,%rax
+  802470:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802475:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802479:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80247d:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802480:	49 83 c7 01          	add    $0x1,%r15
+  802484:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802488:	75 83                	jne    80240d <devpipe_read+0x4c>
+    return n;
+  80248a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80248e:	eb 03                	jmp    802493 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802490:	4c 89 f8             	mov    %r15,%rax
+}
+  802493:	48 83 c4 18          	add    $0x18,%rsp
+  802497:	5b                   	pop    %rbx
+  802498:	41 5c                	pop    %r12
+  80249a:	41 5d                	pop    %r13
+  80249c:	41 5e                	pop    %r14
+  80249e:	41 5f                	pop    %r15
+  8024a0:	5d                   	pop    %rbp
+  8024a1:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8024a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a7:	eb ea                	jmp    802493 <devpipe_read+0xd2>
+
+00000000008024a9 <pipe>:
+pipe(int pfd[2]) {
+  8024a9:	55                   	push   %rbp
+  8024aa:	48 89 e5             	mov    %rsp,%rbp
+  8024ad:	41 55                	push   %r13
+  8024af:	41 54                	push   %r12
+  8024b1:	53                   	push   %rbx
+  8024b2:	48 83 ec 18          	sub    $0x18,%rsp
+  8024b6:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8024b9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8024bd:	48 b8 3e 18 80 00 00 	movabs $0x80183e,%rax
+  8024c4:	00 00 00 
+  8024c7:	ff d0                	call   *%rax
+  8024c9:	89 c3                	mov    %eax,%ebx
+  8024cb:	85 c0                	test   %eax,%eax
+  8024cd:	0f 88 a0 01 00 00    	js     802673 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8024d3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8024d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024dd:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8024e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024e6:	48 b8 6e 11 80 00 00 	movabs $0x80116e,%rax
+  8024ed:	00 00 00 
+  8024f0:	ff d0                	call   *%rax
+  8024f2:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8024f4:	85 c0                	test   %eax,%eax
+  8024f6:	0f 88 77 01 00 00    	js     802673 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8024fc:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802500:	48 b8 3e 18 80 00 00 	movabs $0x80183e,%rax
+  802507:	00 00 00 
+  80250a:	ff d0                	call   *%rax
+  80250c:	89 c3                	mov    %eax,%ebx
+  80250e:	85 c0                	test   %eax,%eax
+  802510:	0f 88 43 01 00 00    	js     802659 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802516:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80251b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802520:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802524:	bf 00 00 00 00       	mov    $0x0,%edi
+  802529:	48 b8 6e 11 80 00 00 	movabs $0x80116e,%rax
+  802530:	00 00 00 
+  802533:	ff d0                	call   *%rax
+  802535:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802537:	85 c0                	test   %eax,%eax
+  802539:	0f 88 1a 01 00 00    	js     802659 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80253f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802543:	48 b8 22 18 80 00 00 	movabs $0x801822,%rax
+  80254a:	00 00 00 
+  80254d:	ff d0                	call   *%rax
+  80254f:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802552:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802557:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80255c:	48 89 c6             	mov    %rax,%rsi
+  80255f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802564:	48 b8 6e 11 80 00 00 	movabs $0x80116e,%rax
+  80256b:	00 00 00 
+  80256e:	ff d0                	call   *%rax
+  802570:	89 c3                	mov    %eax,%ebx
+  802572:	85 c0                	test   %eax,%eax
+  802574:	0f 88 c5 00 00 00    	js     80263f <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80257a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80257e:	48 b8 22 18 80 00 00 	movabs $0x801822,%rax
+  802585:	00 00 00 
+  802588:	ff d0                	call   *%rax
+  80258a:	48 89 c1             	mov    %rax,%rcx
+  80258d:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802593:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802599:	ba 00 00 00 00       	mov    $0x0,%edx
+  80259e:	4c 89 ee             	mov    %r13,%rsi
+  8025a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025a6:	48 b8 d5 11 80 00 00 	movabs $0x8011d5,%rax
+  8025ad:	00 00 00 
+  8025b0:	ff d0                	call   *%rax
+  8025b2:	89 c3                	mov    %eax,%ebx
+  8025b4:	85 c0                	test   %eax,%eax
+  8025b6:	78 6e                	js     802626 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8025b8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025bd:	4c 89 ef             	mov    %r13,%rdi
+  8025c0:	48 b8 10 11 80 00 00 	movabs $0x801110,%rax
+  8025c7:	00 00 00 
+  8025ca:	ff d0                	call   *%rax
+  8025cc:	83 f8 02             	cmp    $0x2,%eax
+  8025cf:	0f 85 ab 00 00 00    	jne    802680 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8025d5:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8025dc:	00 00 
+  8025de:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8025e2:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8025e4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8025e8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8025ef:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8025f3:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8025f5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025f9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802600:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802604:	48 bb 10 18 80 00 00 	movabs $0x801810,%rbx
+  80260b:	00 00 00 
+  80260e:	ff d3                	call   *%rbx
+  802610:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802614:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802618:	ff d3                	call   *%rbx
+  80261a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80261f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802624:	eb 4d                	jmp    802673 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802626:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80262b:	4c 89 ee             	mov    %r13,%rsi
+  80262e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802633:	48 b8 3a 12 80 00 00 	movabs $0x80123a,%rax
+  80263a:	00 00 00 
+  80263d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80263f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802644:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802648:	bf 00 00 00 00       	mov    $0x0,%edi
+  80264d:	48 b8 3a 12 80 00 00 	movabs $0x80123a,%rax
+  802654:	00 00 00 
+  802657:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802659:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80265e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802662:	bf 00 00 00 00       	mov    $0x0,%edi
+  802667:	48 b8 3a 12 80 00 00 	movabs $0x80123a,%rax
+  80266e:	00 00 00 
+  802671:	ff d0                	call   *%rax
+}
+  802673:	89 d8                	mov    %ebx,%eax
+  802675:	48 83 c4 18          	add    $0x18,%rsp
+  802679:	5b                   	pop    %rbx
+  80267a:	41 5c                	pop    %r12
+  80267c:	41 5d                	pop    %r13
+  80267e:	5d                   	pop    %rbp
+  80267f:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802680:	48 b9 b0 33 80 00 00 	movabs $0x8033b0,%rcx
+  802687:	00 00 00 
+  80268a:	48 ba 87 33 80 00 00 	movabs $0x803387,%rdx
+  802691:	00 00 00 
+  802694:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802699:	48 bf 9c 33 80 00 00 	movabs $0x80339c,%rdi
+  8026a0:	00 00 00 
+  8026a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a8:	49 b8 e3 2a 80 00 00 	movabs $0x802ae3,%r8
+  8026af:	00 00 00 
+  8026b2:	41 ff d0             	call   *%r8
+
+00000000008026b5 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8026b5:	55                   	push   %rbp
+  8026b6:	48 89 e5             	mov    %rsp,%rbp
+  8026b9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8026bd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8026c1:	48 b8 9e 18 80 00 00 	movabs $0x80189e,%rax
+  8026c8:	00 00 00 
+  8026cb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026cd:	85 c0                	test   %eax,%eax
+  8026cf:	78 35                	js     802706 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8026d1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8026d5:	48 b8 22 18 80 00 00 	movabs $0x801822,%rax
+  8026dc:	00 00 00 
+  8026df:	ff d0                	call   *%rax
+  8026e1:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026e4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026e9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026ee:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8026f2:	48 b8 42 11 80 00 00 	movabs $0x801142,%rax
+  8026f9:	00 00 00 
+  8026fc:	ff d0                	call   *%rax
+  8026fe:	85 c0                	test   %eax,%eax
+  802700:	0f 94 c0             	sete   %al
+  802703:	0f b6 c0             	movzbl %al,%eax
+}
+  802706:	c9                   	leave
+  802707:	c3                   	ret
+
+0000000000802708 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802708:	48 89 f8             	mov    %rdi,%rax
+  80270b:	48 c1 e8 27          	shr    $0x27,%rax
+  80270f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802716:	01 00 00 
+  802719:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80271d:	f6 c2 01             	test   $0x1,%dl
+  802720:	74 6d                	je     80278f <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802722:	48 89 f8             	mov    %rdi,%rax
+  802725:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802729:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802730:	01 00 00 
+  802733:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802737:	f6 c2 01             	test   $0x1,%dl
+  80273a:	74 62                	je     80279e <get_uvpt_entry+0x96>
+  80273c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802743:	01 00 00 
+  802746:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80274a:	f6 c2 80             	test   $0x80,%dl
+  80274d:	75 4f                	jne    80279e <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80274f:	48 89 f8             	mov    %rdi,%rax
+  802752:	48 c1 e8 15          	shr    $0x15,%rax
+  802756:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80275d:	01 00 00 
+  802760:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802764:	f6 c2 01             	test   $0x1,%dl
+  802767:	74 44                	je     8027ad <get_uvpt_entry+0xa5>
+  802769:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802770:	01 00 00 
+  802773:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802777:	f6 c2 80             	test   $0x80,%dl
+  80277a:	75 31                	jne    8027ad <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80277c:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802780:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802787:	01 00 00 
+  80278a:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80278e:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80278f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802796:	01 00 00 
+  802799:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80279d:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80279e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8027a5:	01 00 00 
+  8027a8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027ac:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8027ad:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8027b4:	01 00 00 
+  8027b7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027bb:	c3                   	ret
+
+00000000008027bc <get_prot>:
+
+int
+get_prot(void *va) {
+  8027bc:	55                   	push   %rbp
+  8027bd:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8027c0:	48 b8 08 27 80 00 00 	movabs $0x802708,%rax
+  8027c7:	00 00 00 
+  8027ca:	ff d0                	call   *%rax
+  8027cc:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8027cf:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8027d4:	89 c1                	mov    %eax,%ecx
+  8027d6:	83 c9 04             	or     $0x4,%ecx
+  8027d9:	f6 c2 01             	test   $0x1,%dl
+  8027dc:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8027df:	89 c1                	mov    %eax,%ecx
+  8027e1:	83 c9 02             	or     $0x2,%ecx
+  8027e4:	f6 c2 02             	test   $0x2,%dl
+  8027e7:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8027ea:	89 c1                	mov    %eax,%ecx
+  8027ec:	83 c9 01             	or     $0x1,%ecx
+  8027ef:	48 85 d2             	test   %rdx,%rdx
+  8027f2:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8027f5:	89 c1                	mov    %eax,%ecx
+  8027f7:	83 c9 40             	or     $0x40,%ecx
+  8027fa:	f6 c6 04             	test   $0x4,%dh
+  8027fd:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802800:	5d                   	pop    %rbp
+  802801:	c3                   	ret
+
+0000000000802802 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802802:	55                   	push   %rbp
+  802803:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802806:	48 b8 08 27 80 00 00 	movabs $0x802708,%rax
+  80280d:	00 00 00 
+  802810:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802812:	48 c1 e8 06          	shr    $0x6,%rax
+  802816:	83 e0 01             	and    $0x1,%eax
+}
+  802819:	5d                   	pop    %rbp
+  80281a:	c3                   	ret
+
+000000000080281b <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80281b:	55                   	push   %rbp
+  80281c:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80281f:	48 b8 08 27 80 00 00 	movabs $0x802708,%rax
+  802826:	00 00 00 
+  802829:	ff d0                	call   *%rax
+  80282b:	83 e0 01             	and    $0x1,%eax
+}
+  80282e:	5d                   	pop    %rbp
+  80282f:	c3                   	ret
+
+0000000000802830 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802830:	55                   	push   %rbp
+  802831:	48 89 e5             	mov    %rsp,%rbp
+  802834:	41 57                	push   %r15
+  802836:	41 56                	push   %r14
+  802838:	41 55                	push   %r13
+  80283a:	41 54                	push   %r12
+  80283c:	53                   	push   %rbx
+  80283d:	48 83 ec 18          	sub    $0x18,%rsp
+  802841:	49 89 ff             	mov    %rdi,%r15
+  802844:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802848:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  80284d:	49 bc 1b 28 80 00 00 	movabs $0x80281b,%r12
+  802854:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802857:	49 be bc 27 80 00 00 	movabs $0x8027bc,%r14
+  80285e:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802861:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802868:	00 00 00 
+  80286b:	eb 0c                	jmp    802879 <foreach_shared_region+0x49>
+  80286d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802874:	4c 39 eb             	cmp    %r13,%rbx
+  802877:	74 38                	je     8028b1 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802879:	48 89 df             	mov    %rbx,%rdi
+  80287c:	41 ff d4             	call   *%r12
+  80287f:	84 c0                	test   %al,%al
+  802881:	74 ea                	je     80286d <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802883:	48 89 df             	mov    %rbx,%rdi
+  802886:	41 ff d6             	call   *%r14
+  802889:	a8 40                	test   $0x40,%al
+  80288b:	74 e0                	je     80286d <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  80288d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802894:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802898:	48 89 df             	mov    %rbx,%rdi
+  80289b:	41 ff d7             	call   *%r15
+        if (err)
+  80289e:	85 c0                	test   %eax,%eax
+  8028a0:	74 cb                	je     80286d <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8028a2:	48 83 c4 18          	add    $0x18,%rsp
+  8028a6:	5b                   	pop    %rbx
+  8028a7:	41 5c                	pop    %r12
+  8028a9:	41 5d                	pop    %r13
+  8028ab:	41 5e                	pop    %r14
+  8028ad:	41 5f                	pop    %r15
+  8028af:	5d                   	pop    %rbp
+  8028b0:	c3                   	ret
+    return 0;
+  8028b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b6:	eb ea                	jmp    8028a2 <foreach_shared_region+0x72>
+
+00000000008028b8 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8028b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bd:	c3                   	ret
+
+00000000008028be <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8028be:	55                   	push   %rbp
+  8028bf:	48 89 e5             	mov    %rsp,%rbp
+  8028c2:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8028c5:	48 be d4 33 80 00 00 	movabs $0x8033d4,%rsi
+  8028cc:	00 00 00 
+  8028cf:	48 b8 be 0b 80 00 00 	movabs $0x800bbe,%rax
+  8028d6:	00 00 00 
+  8028d9:	ff d0                	call   *%rax
+    return 0;
+}
+  8028db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e0:	5d                   	pop    %rbp
+  8028e1:	c3                   	ret
+
+00000000008028e2 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8028e2:	55                   	push   %rbp
+  8028e3:	48 89 e5             	mov    %rsp,%rbp
+  8028e6:	41 57                	push   %r15
+  8028e8:	41 56                	push   %r14
+  8028ea:	41 55                	push   %r13
+  8028ec:	41 54                	push   %r12
+  8028ee:	53                   	push   %rbx
+  8028ef:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8028f6:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8028fd:	48 85 d2             	test   %rdx,%rdx
+  802900:	74 7a                	je     80297c <devcons_write+0x9a>
+  802902:	49 89 d6             	mov    %rdx,%r14
+  802905:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80290b:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802910:	49 bf b8 0d 80 00 00 	movabs $0x800db8,%r15
+  802917:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80291a:	4c 89 f3             	mov    %r14,%rbx
+  80291d:	48 29 f3             	sub    %rsi,%rbx
+  802920:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802925:	48 39 c3             	cmp    %rax,%rbx
+  802928:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80292c:	4c 63 eb             	movslq %ebx,%r13
+  80292f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802936:	48 01 c6             	add    %rax,%rsi
+  802939:	4c 89 ea             	mov    %r13,%rdx
+  80293c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802943:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802946:	4c 89 ee             	mov    %r13,%rsi
+  802949:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802950:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  802957:	00 00 00 
+  80295a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80295c:	41 01 dc             	add    %ebx,%r12d
+  80295f:	49 63 f4             	movslq %r12d,%rsi
+  802962:	4c 39 f6             	cmp    %r14,%rsi
+  802965:	72 b3                	jb     80291a <devcons_write+0x38>
+    return res;
+  802967:	49 63 c4             	movslq %r12d,%rax
+}
+  80296a:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802971:	5b                   	pop    %rbx
+  802972:	41 5c                	pop    %r12
+  802974:	41 5d                	pop    %r13
+  802976:	41 5e                	pop    %r14
+  802978:	41 5f                	pop    %r15
+  80297a:	5d                   	pop    %rbp
+  80297b:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80297c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802982:	eb e3                	jmp    802967 <devcons_write+0x85>
+
+0000000000802984 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802984:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802987:	ba 00 00 00 00       	mov    $0x0,%edx
+  80298c:	48 85 c0             	test   %rax,%rax
+  80298f:	74 55                	je     8029e6 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802991:	55                   	push   %rbp
+  802992:	48 89 e5             	mov    %rsp,%rbp
+  802995:	41 55                	push   %r13
+  802997:	41 54                	push   %r12
+  802999:	53                   	push   %rbx
+  80299a:	48 83 ec 08          	sub    $0x8,%rsp
+  80299e:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8029a1:	48 bb 12 10 80 00 00 	movabs $0x801012,%rbx
+  8029a8:	00 00 00 
+  8029ab:	49 bc df 10 80 00 00 	movabs $0x8010df,%r12
+  8029b2:	00 00 00 
+  8029b5:	eb 03                	jmp    8029ba <devcons_read+0x36>
+  8029b7:	41 ff d4             	call   *%r12
+  8029ba:	ff d3                	call   *%rbx
+  8029bc:	85 c0                	test   %eax,%eax
+  8029be:	74 f7                	je     8029b7 <devcons_read+0x33>
+    if (c < 0) return c;
+  8029c0:	48 63 d0             	movslq %eax,%rdx
+  8029c3:	78 13                	js     8029d8 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8029c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029ca:	83 f8 04             	cmp    $0x4,%eax
+  8029cd:	74 09                	je     8029d8 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8029cf:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8029d3:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8029d8:	48 89 d0             	mov    %rdx,%rax
+  8029db:	48 83 c4 08          	add    $0x8,%rsp
+  8029df:	5b                   	pop    %rbx
+  8029e0:	41 5c                	pop    %r12
+  8029e2:	41 5d                	pop    %r13
+  8029e4:	5d                   	pop    %rbp
+  8029e5:	c3                   	ret
+  8029e6:	48 89 d0             	mov    %rdx,%rax
+  8029e9:	c3                   	ret
+
+00000000008029ea <cputchar>:
+cputchar(int ch) {
+  8029ea:	55                   	push   %rbp
+  8029eb:	48 89 e5             	mov    %rsp,%rbp
+  8029ee:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8029f2:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8029f6:	be 01 00 00 00       	mov    $0x1,%esi
+  8029fb:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8029ff:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  802a06:	00 00 00 
+  802a09:	ff d0                	call   *%rax
+}
+  802a0b:	c9                   	leave
+  802a0c:	c3                   	ret
+
+0000000000802a0d <getchar>:
+getchar(void) {
+  802a0d:	55                   	push   %rbp
+  802a0e:	48 89 e5             	mov    %rsp,%rbp
+  802a11:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802a15:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a1a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802a1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a23:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  802a2a:	00 00 00 
+  802a2d:	ff d0                	call   *%rax
+  802a2f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802a31:	85 c0                	test   %eax,%eax
+  802a33:	78 06                	js     802a3b <getchar+0x2e>
+  802a35:	74 08                	je     802a3f <getchar+0x32>
+  802a37:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802a3b:	89 d0                	mov    %edx,%eax
+  802a3d:	c9                   	leave
+  802a3e:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802a3f:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802a44:	eb f5                	jmp    802a3b <getchar+0x2e>
+
+0000000000802a46 <iscons>:
+iscons(int fdnum) {
+  802a46:	55                   	push   %rbp
+  802a47:	48 89 e5             	mov    %rsp,%rbp
+  802a4a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802a4e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802a52:	48 b8 9e 18 80 00 00 	movabs $0x80189e,%rax
+  802a59:	00 00 00 
+  802a5c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a5e:	85 c0                	test   %eax,%eax
+  802a60:	78 18                	js     802a7a <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802a62:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a66:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802a6d:	00 00 00 
+  802a70:	8b 00                	mov    (%rax),%eax
+  802a72:	39 02                	cmp    %eax,(%rdx)
+  802a74:	0f 94 c0             	sete   %al
+  802a77:	0f b6 c0             	movzbl %al,%eax
+}
+  802a7a:	c9                   	leave
+  802a7b:	c3                   	ret
+
+0000000000802a7c <opencons>:
+opencons(void) {
+  802a7c:	55                   	push   %rbp
+  802a7d:	48 89 e5             	mov    %rsp,%rbp
+  802a80:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802a84:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802a88:	48 b8 3e 18 80 00 00 	movabs $0x80183e,%rax
+  802a8f:	00 00 00 
+  802a92:	ff d0                	call   *%rax
+  802a94:	85 c0                	test   %eax,%eax
+  802a96:	78 49                	js     802ae1 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802a98:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802a9d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802aa2:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802aa6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aab:	48 b8 6e 11 80 00 00 	movabs $0x80116e,%rax
+  802ab2:	00 00 00 
+  802ab5:	ff d0                	call   *%rax
+  802ab7:	85 c0                	test   %eax,%eax
+  802ab9:	78 26                	js     802ae1 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802abb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802abf:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802ac6:	00 00 
+  802ac8:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802aca:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802ace:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802ad5:	48 b8 10 18 80 00 00 	movabs $0x801810,%rax
+  802adc:	00 00 00 
+  802adf:	ff d0                	call   *%rax
+}
+  802ae1:	c9                   	leave
+  802ae2:	c3                   	ret
+
+0000000000802ae3 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802ae3:	55                   	push   %rbp
+  802ae4:	48 89 e5             	mov    %rsp,%rbp
+  802ae7:	41 56                	push   %r14
+  802ae9:	41 55                	push   %r13
+  802aeb:	41 54                	push   %r12
+  802aed:	53                   	push   %rbx
+  802aee:	48 83 ec 50          	sub    $0x50,%rsp
+  802af2:	49 89 fc             	mov    %rdi,%r12
+  802af5:	41 89 f5             	mov    %esi,%r13d
+  802af8:	48 89 d3             	mov    %rdx,%rbx
+  802afb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802aff:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802b03:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802b07:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802b0e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802b12:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802b16:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802b1a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802b1e:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802b25:	00 00 00 
+  802b28:	4c 8b 30             	mov    (%rax),%r14
+  802b2b:	48 b8 ae 10 80 00 00 	movabs $0x8010ae,%rax
+  802b32:	00 00 00 
+  802b35:	ff d0                	call   *%rax
+  802b37:	89 c6                	mov    %eax,%esi
+  802b39:	45 89 e8             	mov    %r13d,%r8d
+  802b3c:	4c 89 e1             	mov    %r12,%rcx
+  802b3f:	4c 89 f2             	mov    %r14,%rdx
+  802b42:	48 bf e0 33 80 00 00 	movabs $0x8033e0,%rdi
+  802b49:	00 00 00 
+  802b4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b51:	49 bc 99 02 80 00 00 	movabs $0x800299,%r12
+  802b58:	00 00 00 
+  802b5b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802b5e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802b62:	48 89 df             	mov    %rbx,%rdi
+  802b65:	48 b8 35 02 80 00 00 	movabs $0x800235,%rax
+  802b6c:	00 00 00 
+  802b6f:	ff d0                	call   *%rax
+    cprintf("\n");
+  802b71:	48 bf 1f 2d 80 00 00 	movabs $0x802d1f,%rdi
+  802b78:	00 00 00 
+  802b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b80:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802b83:	cc                   	int3
+  802b84:	eb fd                	jmp    802b83 <_panic+0xa0>
+
+0000000000802b86 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802b86:	55                   	push   %rbp
+  802b87:	48 89 e5             	mov    %rsp,%rbp
+  802b8a:	41 54                	push   %r12
+  802b8c:	53                   	push   %rbx
+  802b8d:	48 89 fb             	mov    %rdi,%rbx
+  802b90:	48 89 f7             	mov    %rsi,%rdi
+  802b93:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802b96:	48 85 f6             	test   %rsi,%rsi
+  802b99:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ba0:	00 00 00 
+  802ba3:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802ba7:	be 00 10 00 00       	mov    $0x1000,%esi
+  802bac:	48 b8 d8 14 80 00 00 	movabs $0x8014d8,%rax
+  802bb3:	00 00 00 
+  802bb6:	ff d0                	call   *%rax
+    if (res < 0) {
+  802bb8:	85 c0                	test   %eax,%eax
+  802bba:	78 45                	js     802c01 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802bbc:	48 85 db             	test   %rbx,%rbx
+  802bbf:	74 12                	je     802bd3 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802bc1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802bc8:	00 00 00 
+  802bcb:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802bd1:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802bd3:	4d 85 e4             	test   %r12,%r12
+  802bd6:	74 14                	je     802bec <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802bd8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802bdf:	00 00 00 
+  802be2:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802be8:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802bec:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802bf3:	00 00 00 
+  802bf6:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802bfc:	5b                   	pop    %rbx
+  802bfd:	41 5c                	pop    %r12
+  802bff:	5d                   	pop    %rbp
+  802c00:	c3                   	ret
+        if (from_env_store)
+  802c01:	48 85 db             	test   %rbx,%rbx
+  802c04:	74 06                	je     802c0c <ipc_recv+0x86>
+            *from_env_store = 0;
+  802c06:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802c0c:	4d 85 e4             	test   %r12,%r12
+  802c0f:	74 eb                	je     802bfc <ipc_recv+0x76>
+            *perm_store = 0;
+  802c11:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802c18:	00 
+  802c19:	eb e1                	jmp    802bfc <ipc_recv+0x76>
+
+0000000000802c1b <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802c1b:	55                   	push   %rbp
+  802c1c:	48 89 e5             	mov    %rsp,%rbp
+  802c1f:	41 57                	push   %r15
+  802c21:	41 56                	push   %r14
+  802c23:	41 55                	push   %r13
+  802c25:	41 54                	push   %r12
+  802c27:	53                   	push   %rbx
+  802c28:	48 83 ec 18          	sub    $0x18,%rsp
+  802c2c:	41 89 fd             	mov    %edi,%r13d
+  802c2f:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802c32:	48 89 d3             	mov    %rdx,%rbx
+  802c35:	49 89 cc             	mov    %rcx,%r12
+  802c38:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802c3c:	48 85 d2             	test   %rdx,%rdx
+  802c3f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802c46:	00 00 00 
+  802c49:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802c4d:	49 be ac 14 80 00 00 	movabs $0x8014ac,%r14
+  802c54:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802c57:	49 bf df 10 80 00 00 	movabs $0x8010df,%r15
+  802c5e:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802c61:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802c64:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802c68:	4c 89 e1             	mov    %r12,%rcx
+  802c6b:	48 89 da             	mov    %rbx,%rdx
+  802c6e:	44 89 ef             	mov    %r13d,%edi
+  802c71:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802c74:	85 c0                	test   %eax,%eax
+  802c76:	74 34                	je     802cac <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802c78:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802c7b:	75 05                	jne    802c82 <ipc_send+0x67>
+        sys_yield();
+  802c7d:	41 ff d7             	call   *%r15
+    while (true) {
+  802c80:	eb df                	jmp    802c61 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802c82:	48 ba 03 34 80 00 00 	movabs $0x803403,%rdx
+  802c89:	00 00 00 
+  802c8c:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802c91:	48 bf 1c 34 80 00 00 	movabs $0x80341c,%rdi
+  802c98:	00 00 00 
+  802c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca0:	48 b9 e3 2a 80 00 00 	movabs $0x802ae3,%rcx
+  802ca7:	00 00 00 
+  802caa:	ff d1                	call   *%rcx
+    }
+}
+  802cac:	48 83 c4 18          	add    $0x18,%rsp
+  802cb0:	5b                   	pop    %rbx
+  802cb1:	41 5c                	pop    %r12
+  802cb3:	41 5d                	pop    %r13
+  802cb5:	41 5e                	pop    %r14
+  802cb7:	41 5f                	pop    %r15
+  802cb9:	5d                   	pop    %rbp
+  802cba:	c3                   	ret
+
+0000000000802cbb <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802cbb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802cc0:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802cc7:	00 00 00 
+  802cca:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802cd1:	48 01 ca             	add    %rcx,%rdx
+  802cd4:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802cda:	39 fa                	cmp    %edi,%edx
+  802cdc:	74 12                	je     802cf0 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802cde:	48 83 c0 01          	add    $0x1,%rax
+  802ce2:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802ce8:	75 e0                	jne    802cca <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802cea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cef:	c3                   	ret
+            return envs[i].env_id;
+  802cf0:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802cf7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802cfe:	00 00 00 
+  802d01:	48 01 d0             	add    %rdx,%rax
+  802d04:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802d0a:	c3                   	ret
+  802d0b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000802d10 <__rodata_start>:
+  802d10:	25 30 34 78 3a       	and    $0x3a783430,%eax
+  802d15:	20 49 20             	and    %cl,0x20(%rcx)
+  802d18:	61                   	(bad)
+  802d19:	6d                   	insl   (%dx),%es:(%rdi)
+  802d1a:	20 27                	and    %ah,(%rdi)
+  802d1c:	25 73 27 0a 00       	and    $0xa2773,%eax
+  802d21:	25 73 25 63 00       	and    $0x632573,%eax
+  802d26:	3c 75                	cmp    $0x75,%al
+  802d28:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d29:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802d2d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d2e:	3e 00 30             	ds add %dh,(%rax)
+  802d31:	31 32                	xor    %esi,(%rdx)
+  802d33:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802d3a:	41                   	rex.B
+  802d3b:	42                   	rex.X
+  802d3c:	43                   	rex.XB
+  802d3d:	44                   	rex.R
+  802d3e:	45                   	rex.RB
+  802d3f:	46 00 30             	rex.RX add %r14b,(%rax)
+  802d42:	31 32                	xor    %esi,(%rdx)
+  802d44:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802d4b:	61                   	(bad)
+  802d4c:	62 63 64 65 66       	(bad)
+  802d51:	00 28                	add    %ch,(%rax)
+  802d53:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d54:	75 6c                	jne    802dc2 <__rodata_start+0xb2>
+  802d56:	6c                   	insb   (%dx),%es:(%rdi)
+  802d57:	29 00                	sub    %eax,(%rax)
+  802d59:	65 72 72             	gs jb  802dce <__rodata_start+0xbe>
+  802d5c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d5d:	72 20                	jb     802d7f <__rodata_start+0x6f>
+  802d5f:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802d64:	73 70                	jae    802dd6 <__rodata_start+0xc6>
+  802d66:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802d6a:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802d71:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d72:	72 00                	jb     802d74 <__rodata_start+0x64>
+  802d74:	62 61 64 20 65       	(bad)
+  802d79:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d7a:	76 69                	jbe    802de5 <__rodata_start+0xd5>
+  802d7c:	72 6f                	jb     802ded <__rodata_start+0xdd>
+  802d7e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d7f:	6d                   	insl   (%dx),%es:(%rdi)
+  802d80:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d82:	74 00                	je     802d84 <__rodata_start+0x74>
+  802d84:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802d8b:	20 70 61             	and    %dh,0x61(%rax)
+  802d8e:	72 61                	jb     802df1 <__rodata_start+0xe1>
+  802d90:	6d                   	insl   (%dx),%es:(%rdi)
+  802d91:	65 74 65             	gs je  802df9 <__rodata_start+0xe9>
+  802d94:	72 00                	jb     802d96 <__rodata_start+0x86>
+  802d96:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d97:	75 74                	jne    802e0d <__rodata_start+0xfd>
+  802d99:	20 6f 66             	and    %ch,0x66(%rdi)
+  802d9c:	20 6d 65             	and    %ch,0x65(%rbp)
+  802d9f:	6d                   	insl   (%dx),%es:(%rdi)
+  802da0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802da1:	72 79                	jb     802e1c <__rodata_start+0x10c>
+  802da3:	00 6f 75             	add    %ch,0x75(%rdi)
+  802da6:	74 20                	je     802dc8 <__rodata_start+0xb8>
+  802da8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802da9:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802dad:	76 69                	jbe    802e18 <__rodata_start+0x108>
+  802daf:	72 6f                	jb     802e20 <__rodata_start+0x110>
+  802db1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802db2:	6d                   	insl   (%dx),%es:(%rdi)
+  802db3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802db5:	74 73                	je     802e2a <__rodata_start+0x11a>
+  802db7:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802dba:	72 72                	jb     802e2e <__rodata_start+0x11e>
+  802dbc:	75 70                	jne    802e2e <__rodata_start+0x11e>
+  802dbe:	74 65                	je     802e25 <__rodata_start+0x115>
+  802dc0:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802dc5:	75 67                	jne    802e2e <__rodata_start+0x11e>
+  802dc7:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802dca:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802dcc:	00 73 65             	add    %dh,0x65(%rbx)
+  802dcf:	67 6d                	insl   (%dx),%es:(%edi)
+  802dd1:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802dd3:	74 61                	je     802e36 <__rodata_start+0x126>
+  802dd5:	74 69                	je     802e40 <__rodata_start+0x130>
+  802dd7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dd8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dd9:	20 66 61             	and    %ah,0x61(%rsi)
+  802ddc:	75 6c                	jne    802e4a <__rodata_start+0x13a>
+  802dde:	74 00                	je     802de0 <__rodata_start+0xd0>
+  802de0:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802de7:	20 45 4c             	and    %al,0x4c(%rbp)
+  802dea:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802dee:	61                   	(bad)
+  802def:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802df4:	20 73 75             	and    %dh,0x75(%rbx)
+  802df7:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802dfa:	73 79                	jae    802e75 <__rodata_start+0x165>
+  802dfc:	73 74                	jae    802e72 <__rodata_start+0x162>
+  802dfe:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802e00:	20 63 61             	and    %ah,0x61(%rbx)
+  802e03:	6c                   	insb   (%dx),%es:(%rdi)
+  802e04:	6c                   	insb   (%dx),%es:(%rdi)
+  802e05:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802e08:	74 72                	je     802e7c <__rodata_start+0x16c>
+  802e0a:	79 20                	jns    802e2c <__rodata_start+0x11c>
+  802e0c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e0d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e0e:	74 20                	je     802e30 <__rodata_start+0x120>
+  802e10:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e12:	75 6e                	jne    802e82 <__rodata_start+0x172>
+  802e14:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802e18:	76 20                	jbe    802e3a <__rodata_start+0x12a>
+  802e1a:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802e21:	72 65                	jb     802e88 <__rodata_start+0x178>
+  802e23:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802e26:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e27:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802e2b:	65 78 70             	gs js  802e9e <__rodata_start+0x18e>
+  802e2e:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802e33:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802e36:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802e3a:	20 66 69             	and    %ah,0x69(%rsi)
+  802e3d:	6c                   	insb   (%dx),%es:(%rdi)
+  802e3e:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802e42:	20 66 72             	and    %ah,0x72(%rsi)
+  802e45:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802e4a:	61                   	(bad)
+  802e4b:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802e4e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e4f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e50:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802e54:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802e57:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e58:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e59:	20 6d 61             	and    %ch,0x61(%rbp)
+  802e5c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e5d:	79 20                	jns    802e7f <__rodata_start+0x16f>
+  802e5f:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802e66:	72 65                	jb     802ecd <__rodata_start+0x1bd>
+  802e68:	20 6f 70             	and    %ch,0x70(%rdi)
+  802e6b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e6d:	00 66 69             	add    %ah,0x69(%rsi)
+  802e70:	6c                   	insb   (%dx),%es:(%rdi)
+  802e71:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802e75:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802e78:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e79:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802e7c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e7d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e7e:	74 20                	je     802ea0 <__rodata_start+0x190>
+  802e80:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e82:	75 6e                	jne    802ef2 <__rodata_start+0x1e2>
+  802e84:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802e88:	76 61                	jbe    802eeb <__rodata_start+0x1db>
+  802e8a:	6c                   	insb   (%dx),%es:(%rdi)
+  802e8b:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802e92:	00 
+  802e93:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802e9a:	72 65                	jb     802f01 <__rodata_start+0x1f1>
+  802e9c:	61                   	(bad)
+  802e9d:	64 79 20             	fs jns 802ec0 <__rodata_start+0x1b0>
+  802ea0:	65 78 69             	gs js  802f0c <__rodata_start+0x1fc>
+  802ea3:	73 74                	jae    802f19 <__rodata_start+0x209>
+  802ea5:	73 00                	jae    802ea7 <__rodata_start+0x197>
+  802ea7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ea8:	70 65                	jo     802f0f <__rodata_start+0x1ff>
+  802eaa:	72 61                	jb     802f0d <__rodata_start+0x1fd>
+  802eac:	74 69                	je     802f17 <__rodata_start+0x207>
+  802eae:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eaf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802eb0:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802eb3:	74 20                	je     802ed5 <__rodata_start+0x1c5>
+  802eb5:	73 75                	jae    802f2c <__rodata_start+0x21c>
+  802eb7:	70 70                	jo     802f29 <__rodata_start+0x219>
+  802eb9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eba:	72 74                	jb     802f30 <__rodata_start+0x220>
+  802ebc:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802ec1:	65 72 61             	gs jb  802f25 <__rodata_start+0x215>
+  802ec4:	74 69                	je     802f2f <__rodata_start+0x21f>
+  802ec6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ec7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ec8:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802ecb:	74 20                	je     802eed <__rodata_start+0x1dd>
+  802ecd:	70 65                	jo     802f34 <__rodata_start+0x224>
+  802ecf:	72 6d                	jb     802f3e <__rodata_start+0x22e>
+  802ed1:	69 74 74 65 64 00 66 	imul   $0xf660064,0x65(%rsp,%rsi,2),%esi
+  802ed8:	0f 
+  802ed9:	1f                   	(bad)
+  802eda:	84 00                	test   %al,(%rax)
+  802edc:	00 00                	add    %al,(%rax)
+  802ede:	00 00                	add    %al,(%rax)
+  802ee0:	86 04 80             	xchg   %al,(%rax,%rax,4)
+  802ee3:	00 00                	add    %al,(%rax)
+  802ee5:	00 00                	add    %al,(%rax)
+  802ee7:	00 c7                	add    %al,%bh
+  802ee9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802eef:	00 b7 0a 80 00 00    	add    %dh,0x800a(%rdi)
+  802ef5:	00 00                	add    %al,(%rax)
+  802ef7:	00 c7                	add    %al,%bh
+  802ef9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802eff:	00 c7                	add    %al,%bh
+  802f01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f07:	00 c7                	add    %al,%bh
+  802f09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f0f:	00 c7                	add    %al,%bh
+  802f11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f17:	00 a5 04 80 00 00    	add    %ah,0x8004(%rbp)
+  802f1d:	00 00                	add    %al,(%rax)
+  802f1f:	00 c7                	add    %al,%bh
+  802f21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f27:	00 c7                	add    %al,%bh
+  802f29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f2f:	00 99 04 80 00 00    	add    %bl,0x8004(%rcx)
+  802f35:	00 00                	add    %al,(%rax)
+  802f37:	00 13                	add    %dl,(%rbx)
+  802f39:	05 80 00 00 00       	add    $0x80,%eax
+  802f3e:	00 00                	add    %al,(%rax)
+  802f40:	c7                   	(bad)
+  802f41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f47:	00 99 04 80 00 00    	add    %bl,0x8004(%rcx)
+  802f4d:	00 00                	add    %al,(%rax)
+  802f4f:	00 df                	add    %bl,%bh
+  802f51:	04 80                	add    $0x80,%al
+  802f53:	00 00                	add    %al,(%rax)
+  802f55:	00 00                	add    %al,(%rax)
+  802f57:	00 df                	add    %bl,%bh
+  802f59:	04 80                	add    $0x80,%al
+  802f5b:	00 00                	add    %al,(%rax)
+  802f5d:	00 00                	add    %al,(%rax)
+  802f5f:	00 df                	add    %bl,%bh
+  802f61:	04 80                	add    $0x80,%al
+  802f63:	00 00                	add    %al,(%rax)
+  802f65:	00 00                	add    %al,(%rax)
+  802f67:	00 df                	add    %bl,%bh
+  802f69:	04 80                	add    $0x80,%al
+  802f6b:	00 00                	add    %al,(%rax)
+  802f6d:	00 00                	add    %al,(%rax)
+  802f6f:	00 df                	add    %bl,%bh
+  802f71:	04 80                	add    $0x80,%al
+  802f73:	00 00                	add    %al,(%rax)
+  802f75:	00 00                	add    %al,(%rax)
+  802f77:	00 df                	add    %bl,%bh
+  802f79:	04 80                	add    $0x80,%al
+  802f7b:	00 00                	add    %al,(%rax)
+  802f7d:	00 00                	add    %al,(%rax)
+  802f7f:	00 df                	add    %bl,%bh
+  802f81:	04 80                	add    $0x80,%al
+  802f83:	00 00                	add    %al,(%rax)
+  802f85:	00 00                	add    %al,(%rax)
+  802f87:	00 df                	add    %bl,%bh
+  802f89:	04 80                	add    $0x80,%al
+  802f8b:	00 00                	add    %al,(%rax)
+  802f8d:	00 00                	add    %al,(%rax)
+  802f8f:	00 df                	add    %bl,%bh
+  802f91:	04 80                	add    $0x80,%al
+  802f93:	00 00                	add    %al,(%rax)
+  802f95:	00 00                	add    %al,(%rax)
+  802f97:	00 c7                	add    %al,%bh
+  802f99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f9f:	00 c7                	add    %al,%bh
+  802fa1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fa7:	00 c7                	add    %al,%bh
+  802fa9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802faf:	00 c7                	add    %al,%bh
+  802fb1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fb7:	00 c7                	add    %al,%bh
+  802fb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fbf:	00 c7                	add    %al,%bh
+  802fc1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fc7:	00 c7                	add    %al,%bh
+  802fc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fcf:	00 c7                	add    %al,%bh
+  802fd1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fd7:	00 c7                	add    %al,%bh
+  802fd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fdf:	00 c7                	add    %al,%bh
+  802fe1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fe7:	00 c7                	add    %al,%bh
+  802fe9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fef:	00 c7                	add    %al,%bh
+  802ff1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ff7:	00 c7                	add    %al,%bh
+  802ff9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fff:	00 c7                	add    %al,%bh
+  803001:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803007:	00 c7                	add    %al,%bh
+  803009:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80300f:	00 c7                	add    %al,%bh
+  803011:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803017:	00 c7                	add    %al,%bh
+  803019:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80301f:	00 c7                	add    %al,%bh
+  803021:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803027:	00 c7                	add    %al,%bh
+  803029:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80302f:	00 c7                	add    %al,%bh
+  803031:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803037:	00 c7                	add    %al,%bh
+  803039:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80303f:	00 c7                	add    %al,%bh
+  803041:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803047:	00 c7                	add    %al,%bh
+  803049:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80304f:	00 c7                	add    %al,%bh
+  803051:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803057:	00 c7                	add    %al,%bh
+  803059:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80305f:	00 c7                	add    %al,%bh
+  803061:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803067:	00 c7                	add    %al,%bh
+  803069:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80306f:	00 c7                	add    %al,%bh
+  803071:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803077:	00 c7                	add    %al,%bh
+  803079:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80307f:	00 c7                	add    %al,%bh
+  803081:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803087:	00 ea                	add    %ch,%dl
+  803089:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80308f:	00 c7                	add    %al,%bh
+  803091:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803097:	00 c7                	add    %al,%bh
+  803099:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80309f:	00 c7                	add    %al,%bh
+  8030a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030a7:	00 c7                	add    %al,%bh
+  8030a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030af:	00 c7                	add    %al,%bh
+  8030b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030b7:	00 c7                	add    %al,%bh
+  8030b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030bf:	00 c7                	add    %al,%bh
+  8030c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030c7:	00 c7                	add    %al,%bh
+  8030c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030cf:	00 c7                	add    %al,%bh
+  8030d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030d7:	00 c7                	add    %al,%bh
+  8030d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030df:	00 36                	add    %dh,(%rsi)
+  8030e1:	05 80 00 00 00       	add    $0x80,%eax
+  8030e6:	00 00                	add    %al,(%rax)
+  8030e8:	05 07 80 00 00       	add    $0x8007,%eax
+  8030ed:	00 00                	add    %al,(%rax)
+  8030ef:	00 c7                	add    %al,%bh
+  8030f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030f7:	00 c7                	add    %al,%bh
+  8030f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030ff:	00 c7                	add    %al,%bh
+  803101:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803107:	00 c7                	add    %al,%bh
+  803109:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80310f:	00 65 05             	add    %ah,0x5(%rbp)
+  803112:	80 00 00             	addb   $0x0,(%rax)
+  803115:	00 00                	add    %al,(%rax)
+  803117:	00 c7                	add    %al,%bh
+  803119:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80311f:	00 c7                	add    %al,%bh
+  803121:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803127:	00 2b                	add    %ch,(%rbx)
+  803129:	05 80 00 00 00       	add    $0x80,%eax
+  80312e:	00 00                	add    %al,(%rax)
+  803130:	c7                   	(bad)
+  803131:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803137:	00 c7                	add    %al,%bh
+  803139:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80313f:	00 ad 08 80 00 00    	add    %ch,0x8008(%rbp)
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 77 09             	add    %dh,0x9(%rdi)
+  80314a:	80 00 00             	addb   $0x0,(%rax)
+  80314d:	00 00                	add    %al,(%rax)
+  80314f:	00 c7                	add    %al,%bh
+  803151:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803157:	00 c7                	add    %al,%bh
+  803159:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80315f:	00 fc                	add    %bh,%ah
+  803161:	05 80 00 00 00       	add    $0x80,%eax
+  803166:	00 00                	add    %al,(%rax)
+  803168:	c7                   	(bad)
+  803169:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80316f:	00 d9                	add    %bl,%cl
+  803171:	07                   	(bad)
+  803172:	80 00 00             	addb   $0x0,(%rax)
+  803175:	00 00                	add    %al,(%rax)
+  803177:	00 c7                	add    %al,%bh
+  803179:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80317f:	00 c7                	add    %al,%bh
+  803181:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803187:	00 ea                	add    %ch,%dl
+  803189:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80318f:	00 c7                	add    %al,%bh
+  803191:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803197:	00 8f 04 80 00 00    	add    %cl,0x8004(%rdi)
+  80319d:	00 00                	add    %al,(%rax)
+	...
+
+00000000008031a0 <error_string>:
+	...
+  8031a8:	62 2d 80 00 00 00 00 00 74 2d 80 00 00 00 00 00     b-......t-......
+  8031b8:	84 2d 80 00 00 00 00 00 96 2d 80 00 00 00 00 00     .-.......-......
+  8031c8:	a4 2d 80 00 00 00 00 00 b8 2d 80 00 00 00 00 00     .-.......-......
+  8031d8:	cd 2d 80 00 00 00 00 00 e0 2d 80 00 00 00 00 00     .-.......-......
+  8031e8:	f2 2d 80 00 00 00 00 00 06 2e 80 00 00 00 00 00     .-..............
+  8031f8:	16 2e 80 00 00 00 00 00 29 2e 80 00 00 00 00 00     ........).......
+  803208:	40 2e 80 00 00 00 00 00 56 2e 80 00 00 00 00 00     @.......V.......
+  803218:	6e 2e 80 00 00 00 00 00 86 2e 80 00 00 00 00 00     n...............
+  803228:	93 2e 80 00 00 00 00 00 50 32 80 00 00 00 00 00     ........P2......
+  803238:	a7 2e 80 00 00 00 00 00 00 00 00 00 00 00 00 00     ................
+  803248:	bf 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ........file is 
+  803258:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803268:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803278:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803288:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803298:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  8032a8:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  8032b8:	6c 69 62 2f 66 6f 72 6b 2e 63 00 0f 1f 44 00 00     lib/fork.c...D..
+  8032c8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8032d8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8032e8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8032f8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803308:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803318:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803328:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803338:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803348:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803358:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000803360 <devtab>:
+  803360:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803370:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803380:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803390:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8033a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8033b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8033c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8033d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8033e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8033f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803400:	3a 20 00 69 70 63 5f 73 65 6e 64 3a 20 66 61 69     : .ipc_send: fai
+  803410:	6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62 2f     led to send.lib/
+  803420:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803430:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803440:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803450:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803460:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803470:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803480:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803490:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803500:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803510:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803520:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803530:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803540:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803550:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803560:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803570:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803580:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803590:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803600:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803610:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803620:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803630:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803640:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803650:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803660:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803670:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803680:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803690:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803700:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803710:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803720:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803730:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803740:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803750:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803760:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803770:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803780:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803790:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803800:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
@@ -0,0 +1,5649 @@
+
+obj/user/hello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4d 00 00 00       	call   800070 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* hello, world */
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    cprintf("hello, world\n");
+  80002e:	48 bf 60 2b 80 00 00 	movabs $0x802b60,%rdi
+  800035:	00 00 00 
+  800038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003d:	48 bb e7 01 80 00 00 	movabs $0x8001e7,%rbx
+  800044:	00 00 00 
+  800047:	ff d3                	call   *%rbx
+    cprintf("i am environment %08x\n", thisenv->env_id);
+  800049:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800050:	00 00 00 
+  800053:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800059:	48 bf 6e 2b 80 00 00 	movabs $0x802b6e,%rdi
+  800060:	00 00 00 
+  800063:	b8 00 00 00 00       	mov    $0x0,%eax
+  800068:	ff d3                	call   *%rbx
+}
+  80006a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80006e:	c9                   	leave
+  80006f:	c3                   	ret
+
+0000000000800070 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800070:	55                   	push   %rbp
+  800071:	48 89 e5             	mov    %rsp,%rbp
+  800074:	41 56                	push   %r14
+  800076:	41 55                	push   %r13
+  800078:	41 54                	push   %r12
+  80007a:	53                   	push   %rbx
+  80007b:	41 89 fd             	mov    %edi,%r13d
+  80007e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800081:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800088:	00 00 00 
+  80008b:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800092:	00 00 00 
+  800095:	48 39 c2             	cmp    %rax,%rdx
+  800098:	73 17                	jae    8000b1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80009a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80009d:	49 89 c4             	mov    %rax,%r12
+  8000a0:	48 83 c3 08          	add    $0x8,%rbx
+  8000a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a9:	ff 53 f8             	call   *-0x8(%rbx)
+  8000ac:	4c 39 e3             	cmp    %r12,%rbx
+  8000af:	72 ef                	jb     8000a0 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8000b1:	48 b8 fc 0f 80 00 00 	movabs $0x800ffc,%rax
+  8000b8:	00 00 00 
+  8000bb:	ff d0                	call   *%rax
+  8000bd:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8000c0:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8000c7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000ce:	00 00 00 
+  8000d1:	48 01 d0             	add    %rdx,%rax
+  8000d4:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000db:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000de:	45 85 ed             	test   %r13d,%r13d
+  8000e1:	7e 0d                	jle    8000f0 <libmain+0x80>
+  8000e3:	49 8b 06             	mov    (%r14),%rax
+  8000e6:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000ed:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000f0:	4c 89 f6             	mov    %r14,%rsi
+  8000f3:	44 89 ef             	mov    %r13d,%edi
+  8000f6:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000fd:	00 00 00 
+  800100:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800102:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  800109:	00 00 00 
+  80010c:	ff d0                	call   *%rax
+#endif
+}
+  80010e:	5b                   	pop    %rbx
+  80010f:	41 5c                	pop    %r12
+  800111:	41 5d                	pop    %r13
+  800113:	41 5e                	pop    %r14
+  800115:	5d                   	pop    %rbp
+  800116:	c3                   	ret
+
+0000000000800117 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800117:	55                   	push   %rbp
+  800118:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80011b:	48 b8 84 18 80 00 00 	movabs $0x801884,%rax
+  800122:	00 00 00 
+  800125:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800127:	bf 00 00 00 00       	mov    $0x0,%edi
+  80012c:	48 b8 91 0f 80 00 00 	movabs $0x800f91,%rax
+  800133:	00 00 00 
+  800136:	ff d0                	call   *%rax
+}
+  800138:	5d                   	pop    %rbp
+  800139:	c3                   	ret
+
+000000000080013a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80013a:	55                   	push   %rbp
+  80013b:	48 89 e5             	mov    %rsp,%rbp
+  80013e:	53                   	push   %rbx
+  80013f:	48 83 ec 08          	sub    $0x8,%rsp
+  800143:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800146:	8b 06                	mov    (%rsi),%eax
+  800148:	8d 50 01             	lea    0x1(%rax),%edx
+  80014b:	89 16                	mov    %edx,(%rsi)
+  80014d:	48 98                	cltq
+  80014f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800154:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80015a:	74 0a                	je     800166 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80015c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800160:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800164:	c9                   	leave
+  800165:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800166:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80016a:	be ff 00 00 00       	mov    $0xff,%esi
+  80016f:	48 b8 33 0f 80 00 00 	movabs $0x800f33,%rax
+  800176:	00 00 00 
+  800179:	ff d0                	call   *%rax
+        state->offset = 0;
+  80017b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800181:	eb d9                	jmp    80015c <putch+0x22>
+
+0000000000800183 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800183:	55                   	push   %rbp
+  800184:	48 89 e5             	mov    %rsp,%rbp
+  800187:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80018e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800191:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800198:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80019d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001a5:	48 89 f1             	mov    %rsi,%rcx
+  8001a8:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001af:	48 bf 3a 01 80 00 00 	movabs $0x80013a,%rdi
+  8001b6:	00 00 00 
+  8001b9:	48 b8 37 03 80 00 00 	movabs $0x800337,%rax
+  8001c0:	00 00 00 
+  8001c3:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001c5:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001cc:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001d3:	48 b8 33 0f 80 00 00 	movabs $0x800f33,%rax
+  8001da:	00 00 00 
+  8001dd:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001df:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001e5:	c9                   	leave
+  8001e6:	c3                   	ret
+
+00000000008001e7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001e7:	55                   	push   %rbp
+  8001e8:	48 89 e5             	mov    %rsp,%rbp
+  8001eb:	48 83 ec 50          	sub    $0x50,%rsp
+  8001ef:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001f3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001f7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001fb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001ff:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800203:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80020a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80020e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800212:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800216:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80021a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80021e:	48 b8 83 01 80 00 00 	movabs $0x800183,%rax
+  800225:	00 00 00 
+  800228:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80022a:	c9                   	leave
+  80022b:	c3                   	ret
+
+000000000080022c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80022c:	55                   	push   %rbp
+  80022d:	48 89 e5             	mov    %rsp,%rbp
+  800230:	41 57                	push   %r15
+  800232:	41 56                	push   %r14
+  800234:	41 55                	push   %r13
+  800236:	41 54                	push   %r12
+  800238:	53                   	push   %rbx
+  800239:	48 83 ec 18          	sub    $0x18,%rsp
+  80023d:	49 89 fc             	mov    %rdi,%r12
+  800240:	49 89 f5             	mov    %rsi,%r13
+  800243:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800247:	8b 45 10             	mov    0x10(%rbp),%eax
+  80024a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80024d:	41 89 cf             	mov    %ecx,%r15d
+  800250:	4c 39 fa             	cmp    %r15,%rdx
+  800253:	73 5b                	jae    8002b0 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800255:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800259:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80025d:	85 db                	test   %ebx,%ebx
+  80025f:	7e 0e                	jle    80026f <print_num+0x43>
+            putch(padc, put_arg);
+  800261:	4c 89 ee             	mov    %r13,%rsi
+  800264:	44 89 f7             	mov    %r14d,%edi
+  800267:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80026a:	83 eb 01             	sub    $0x1,%ebx
+  80026d:	75 f2                	jne    800261 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80026f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800273:	48 b9 a0 2b 80 00 00 	movabs $0x802ba0,%rcx
+  80027a:	00 00 00 
+  80027d:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  800284:	00 00 00 
+  800287:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80028b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80028f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800294:	49 f7 f7             	div    %r15
+  800297:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80029b:	4c 89 ee             	mov    %r13,%rsi
+  80029e:	41 ff d4             	call   *%r12
+}
+  8002a1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002a5:	5b                   	pop    %rbx
+  8002a6:	41 5c                	pop    %r12
+  8002a8:	41 5d                	pop    %r13
+  8002aa:	41 5e                	pop    %r14
+  8002ac:	41 5f                	pop    %r15
+  8002ae:	5d                   	pop    %rbp
+  8002af:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b9:	49 f7 f7             	div    %r15
+  8002bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8002c0:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002c4:	52                   	push   %rdx
+  8002c5:	45 0f be c9          	movsbl %r9b,%r9d
+  8002c9:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002cd:	48 89 c2             	mov    %rax,%rdx
+  8002d0:	48 b8 2c 02 80 00 00 	movabs $0x80022c,%rax
+  8002d7:	00 00 00 
+  8002da:	ff d0                	call   *%rax
+  8002dc:	48 83 c4 10          	add    $0x10,%rsp
+  8002e0:	eb 8d                	jmp    80026f <print_num+0x43>
+
+00000000008002e2 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002e2:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002e6:	48 8b 06             	mov    (%rsi),%rax
+  8002e9:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002ed:	73 0a                	jae    8002f9 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002ef:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002f3:	48 89 16             	mov    %rdx,(%rsi)
+  8002f6:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002f9:	c3                   	ret
+
+00000000008002fa <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002fa:	55                   	push   %rbp
+  8002fb:	48 89 e5             	mov    %rsp,%rbp
+  8002fe:	48 83 ec 50          	sub    $0x50,%rsp
+  800302:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800306:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80030a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80030e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800315:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800319:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80031d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800321:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800325:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800329:	48 b8 37 03 80 00 00 	movabs $0x800337,%rax
+  800330:	00 00 00 
+  800333:	ff d0                	call   *%rax
+}
+  800335:	c9                   	leave
+  800336:	c3                   	ret
+
+0000000000800337 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800337:	55                   	push   %rbp
+  800338:	48 89 e5             	mov    %rsp,%rbp
+  80033b:	41 57                	push   %r15
+  80033d:	41 56                	push   %r14
+  80033f:	41 55                	push   %r13
+  800341:	41 54                	push   %r12
+  800343:	53                   	push   %rbx
+  800344:	48 83 ec 38          	sub    $0x38,%rsp
+  800348:	49 89 fe             	mov    %rdi,%r14
+  80034b:	49 89 f5             	mov    %rsi,%r13
+  80034e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800351:	48 8b 01             	mov    (%rcx),%rax
+  800354:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800358:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80035c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800360:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800364:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800368:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80036c:	0f b6 3b             	movzbl (%rbx),%edi
+  80036f:	40 80 ff 25          	cmp    $0x25,%dil
+  800373:	74 18                	je     80038d <vprintfmt+0x56>
+            if (!ch) return;
+  800375:	40 84 ff             	test   %dil,%dil
+  800378:	0f 84 b1 06 00 00    	je     800a2f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80037e:	40 0f b6 ff          	movzbl %dil,%edi
+  800382:	4c 89 ee             	mov    %r13,%rsi
+  800385:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800388:	4c 89 e3             	mov    %r12,%rbx
+  80038b:	eb db                	jmp    800368 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80038d:	be 00 00 00 00       	mov    $0x0,%esi
+  800392:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800396:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80039b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003a1:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003a8:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003ac:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003b1:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003b6:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003b9:	83 e8 23             	sub    $0x23,%eax
+  8003bc:	3c 57                	cmp    $0x57,%al
+  8003be:	0f 87 51 06 00 00    	ja     800a15 <vprintfmt+0x6de>
+  8003c4:	0f b6 c0             	movzbl %al,%eax
+  8003c7:	48 b9 40 2d 80 00 00 	movabs $0x802d40,%rcx
+  8003ce:	00 00 00 
+  8003d1:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003d4:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003d7:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003db:	eb cf                	jmp    8003ac <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003dd:	49 89 dc             	mov    %rbx,%r12
+  8003e0:	be 01 00 00 00       	mov    $0x1,%esi
+  8003e5:	eb c5                	jmp    8003ac <vprintfmt+0x75>
+            padc = ch;
+  8003e7:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003eb:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003ee:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003f1:	eb b9                	jmp    8003ac <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8003f9:	77 24                	ja     80041f <vprintfmt+0xe8>
+  8003fb:	89 c1                	mov    %eax,%ecx
+  8003fd:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800401:	83 c0 08             	add    $0x8,%eax
+  800404:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800407:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80040a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80040d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800411:	79 99                	jns    8003ac <vprintfmt+0x75>
+                width = precision;
+  800413:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800417:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80041d:	eb 8d                	jmp    8003ac <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80041f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800423:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800427:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80042b:	eb da                	jmp    800407 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80042d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800432:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800436:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80043c:	3c 39                	cmp    $0x39,%al
+  80043e:	77 1c                	ja     80045c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800440:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800444:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800448:	0f b6 c0             	movzbl %al,%eax
+  80044b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800450:	0f b6 03             	movzbl (%rbx),%eax
+  800453:	3c 39                	cmp    $0x39,%al
+  800455:	76 e9                	jbe    800440 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800457:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80045a:	eb b1                	jmp    80040d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80045c:	49 89 dc             	mov    %rbx,%r12
+  80045f:	eb ac                	jmp    80040d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800461:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800464:	85 c9                	test   %ecx,%ecx
+  800466:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046b:	0f 49 c1             	cmovns %ecx,%eax
+  80046e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800471:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800474:	e9 33 ff ff ff       	jmp    8003ac <vprintfmt+0x75>
+            lflag++;
+  800479:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80047c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80047f:	e9 28 ff ff ff       	jmp    8003ac <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800484:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800487:	83 f8 2f             	cmp    $0x2f,%eax
+  80048a:	77 19                	ja     8004a5 <vprintfmt+0x16e>
+  80048c:	89 c2                	mov    %eax,%edx
+  80048e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800492:	83 c0 08             	add    $0x8,%eax
+  800495:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800498:	8b 3a                	mov    (%rdx),%edi
+  80049a:	4c 89 ee             	mov    %r13,%rsi
+  80049d:	41 ff d6             	call   *%r14
+            break;
+  8004a0:	e9 c3 fe ff ff       	jmp    800368 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004b1:	eb e5                	jmp    800498 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8004b9:	77 5a                	ja     800515 <vprintfmt+0x1de>
+  8004bb:	89 c2                	mov    %eax,%edx
+  8004bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004c1:	83 c0 08             	add    $0x8,%eax
+  8004c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004c7:	8b 02                	mov    (%rdx),%eax
+  8004c9:	89 c1                	mov    %eax,%ecx
+  8004cb:	f7 d9                	neg    %ecx
+  8004cd:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004d0:	83 f9 15             	cmp    $0x15,%ecx
+  8004d3:	7f 4e                	jg     800523 <vprintfmt+0x1ec>
+  8004d5:	48 63 c1             	movslq %ecx,%rax
+  8004d8:	48 ba 00 30 80 00 00 	movabs $0x803000,%rdx
+  8004df:	00 00 00 
+  8004e2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004e6:	48 85 c0             	test   %rax,%rax
+  8004e9:	74 38                	je     800523 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004eb:	48 89 c1             	mov    %rax,%rcx
+  8004ee:	48 ba b9 31 80 00 00 	movabs $0x8031b9,%rdx
+  8004f5:	00 00 00 
+  8004f8:	4c 89 ee             	mov    %r13,%rsi
+  8004fb:	4c 89 f7             	mov    %r14,%rdi
+  8004fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800503:	49 b8 fa 02 80 00 00 	movabs $0x8002fa,%r8
+  80050a:	00 00 00 
+  80050d:	41 ff d0             	call   *%r8
+  800510:	e9 53 fe ff ff       	jmp    800368 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800515:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800519:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80051d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800521:	eb a4                	jmp    8004c7 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800523:	48 ba b8 2b 80 00 00 	movabs $0x802bb8,%rdx
+  80052a:	00 00 00 
+  80052d:	4c 89 ee             	mov    %r13,%rsi
+  800530:	4c 89 f7             	mov    %r14,%rdi
+  800533:	b8 00 00 00 00       	mov    $0x0,%eax
+  800538:	49 b8 fa 02 80 00 00 	movabs $0x8002fa,%r8
+  80053f:	00 00 00 
+  800542:	41 ff d0             	call   *%r8
+  800545:	e9 1e fe ff ff       	jmp    800368 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80054a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80054d:	83 f8 2f             	cmp    $0x2f,%eax
+  800550:	77 6c                	ja     8005be <vprintfmt+0x287>
+  800552:	89 c2                	mov    %eax,%edx
+  800554:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800558:	83 c0 08             	add    $0x8,%eax
+  80055b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80055e:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800561:	48 85 d2             	test   %rdx,%rdx
+  800564:	48 b8 b1 2b 80 00 00 	movabs $0x802bb1,%rax
+  80056b:	00 00 00 
+  80056e:	48 0f 45 c2          	cmovne %rdx,%rax
+  800572:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800576:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80057a:	7e 06                	jle    800582 <vprintfmt+0x24b>
+  80057c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800580:	75 4a                	jne    8005cc <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800582:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800586:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80058a:	0f b6 00             	movzbl (%rax),%eax
+  80058d:	84 c0                	test   %al,%al
+  80058f:	0f 85 9a 00 00 00    	jne    80062f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800595:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800598:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80059c:	85 c0                	test   %eax,%eax
+  80059e:	0f 8e c4 fd ff ff    	jle    800368 <vprintfmt+0x31>
+  8005a4:	4c 89 ee             	mov    %r13,%rsi
+  8005a7:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005ac:	41 ff d6             	call   *%r14
+  8005af:	41 83 ec 01          	sub    $0x1,%r12d
+  8005b3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005b7:	75 eb                	jne    8005a4 <vprintfmt+0x26d>
+  8005b9:	e9 aa fd ff ff       	jmp    800368 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005ca:	eb 92                	jmp    80055e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005cc:	49 63 f7             	movslq %r15d,%rsi
+  8005cf:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005d3:	48 b8 e9 0a 80 00 00 	movabs $0x800ae9,%rax
+  8005da:	00 00 00 
+  8005dd:	ff d0                	call   *%rax
+  8005df:	48 89 c2             	mov    %rax,%rdx
+  8005e2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005e5:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005e7:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005ea:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005ed:	85 c0                	test   %eax,%eax
+  8005ef:	7e 91                	jle    800582 <vprintfmt+0x24b>
+  8005f1:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005f6:	4c 89 ee             	mov    %r13,%rsi
+  8005f9:	44 89 e7             	mov    %r12d,%edi
+  8005fc:	41 ff d6             	call   *%r14
+  8005ff:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800603:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800606:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800609:	75 eb                	jne    8005f6 <vprintfmt+0x2bf>
+  80060b:	e9 72 ff ff ff       	jmp    800582 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800610:	0f b6 f8             	movzbl %al,%edi
+  800613:	4c 89 ee             	mov    %r13,%rsi
+  800616:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800619:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80061d:	49 83 c4 01          	add    $0x1,%r12
+  800621:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800627:	84 c0                	test   %al,%al
+  800629:	0f 84 66 ff ff ff    	je     800595 <vprintfmt+0x25e>
+  80062f:	45 85 ff             	test   %r15d,%r15d
+  800632:	78 0a                	js     80063e <vprintfmt+0x307>
+  800634:	41 83 ef 01          	sub    $0x1,%r15d
+  800638:	0f 88 57 ff ff ff    	js     800595 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80063e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800642:	74 cc                	je     800610 <vprintfmt+0x2d9>
+  800644:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800647:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80064c:	80 fa 5e             	cmp    $0x5e,%dl
+  80064f:	77 c2                	ja     800613 <vprintfmt+0x2dc>
+  800651:	eb bd                	jmp    800610 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800653:	40 84 f6             	test   %sil,%sil
+  800656:	75 26                	jne    80067e <vprintfmt+0x347>
+    switch (lflag) {
+  800658:	85 d2                	test   %edx,%edx
+  80065a:	74 59                	je     8006b5 <vprintfmt+0x37e>
+  80065c:	83 fa 01             	cmp    $0x1,%edx
+  80065f:	74 7b                	je     8006dc <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800661:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800664:	83 f8 2f             	cmp    $0x2f,%eax
+  800667:	0f 87 96 00 00 00    	ja     800703 <vprintfmt+0x3cc>
+  80066d:	89 c2                	mov    %eax,%edx
+  80066f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800673:	83 c0 08             	add    $0x8,%eax
+  800676:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800679:	4c 8b 22             	mov    (%rdx),%r12
+  80067c:	eb 17                	jmp    800695 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80067e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800681:	83 f8 2f             	cmp    $0x2f,%eax
+  800684:	77 21                	ja     8006a7 <vprintfmt+0x370>
+  800686:	89 c2                	mov    %eax,%edx
+  800688:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80068c:	83 c0 08             	add    $0x8,%eax
+  80068f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800692:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800695:	4d 85 e4             	test   %r12,%r12
+  800698:	78 7a                	js     800714 <vprintfmt+0x3dd>
+            num = i;
+  80069a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80069d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8006a2:	e9 50 02 00 00       	jmp    8008f7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8006a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b3:	eb dd                	jmp    800692 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006bb:	77 11                	ja     8006ce <vprintfmt+0x397>
+  8006bd:	89 c2                	mov    %eax,%edx
+  8006bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c3:	83 c0 08             	add    $0x8,%eax
+  8006c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c9:	4c 63 22             	movslq (%rdx),%r12
+  8006cc:	eb c7                	jmp    800695 <vprintfmt+0x35e>
+  8006ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006da:	eb ed                	jmp    8006c9 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006df:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e2:	77 11                	ja     8006f5 <vprintfmt+0x3be>
+  8006e4:	89 c2                	mov    %eax,%edx
+  8006e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ea:	83 c0 08             	add    $0x8,%eax
+  8006ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f0:	4c 8b 22             	mov    (%rdx),%r12
+  8006f3:	eb a0                	jmp    800695 <vprintfmt+0x35e>
+  8006f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800701:	eb ed                	jmp    8006f0 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800703:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800707:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80070b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070f:	e9 65 ff ff ff       	jmp    800679 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800714:	4c 89 ee             	mov    %r13,%rsi
+  800717:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80071c:	41 ff d6             	call   *%r14
+                i = -i;
+  80071f:	49 f7 dc             	neg    %r12
+  800722:	e9 73 ff ff ff       	jmp    80069a <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800727:	40 84 f6             	test   %sil,%sil
+  80072a:	75 32                	jne    80075e <vprintfmt+0x427>
+    switch (lflag) {
+  80072c:	85 d2                	test   %edx,%edx
+  80072e:	74 5d                	je     80078d <vprintfmt+0x456>
+  800730:	83 fa 01             	cmp    $0x1,%edx
+  800733:	0f 84 82 00 00 00    	je     8007bb <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800739:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073c:	83 f8 2f             	cmp    $0x2f,%eax
+  80073f:	0f 87 a5 00 00 00    	ja     8007ea <vprintfmt+0x4b3>
+  800745:	89 c2                	mov    %eax,%edx
+  800747:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80074b:	83 c0 08             	add    $0x8,%eax
+  80074e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800751:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800754:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800759:	e9 99 01 00 00       	jmp    8008f7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80075e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800761:	83 f8 2f             	cmp    $0x2f,%eax
+  800764:	77 19                	ja     80077f <vprintfmt+0x448>
+  800766:	89 c2                	mov    %eax,%edx
+  800768:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076c:	83 c0 08             	add    $0x8,%eax
+  80076f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800772:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800775:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80077a:	e9 78 01 00 00       	jmp    8008f7 <vprintfmt+0x5c0>
+  80077f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800783:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800787:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80078b:	eb e5                	jmp    800772 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80078d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800790:	83 f8 2f             	cmp    $0x2f,%eax
+  800793:	77 18                	ja     8007ad <vprintfmt+0x476>
+  800795:	89 c2                	mov    %eax,%edx
+  800797:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80079b:	83 c0 08             	add    $0x8,%eax
+  80079e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a1:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8007a3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007a8:	e9 4a 01 00 00       	jmp    8008f7 <vprintfmt+0x5c0>
+  8007ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b9:	eb e6                	jmp    8007a1 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007be:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c1:	77 19                	ja     8007dc <vprintfmt+0x4a5>
+  8007c3:	89 c2                	mov    %eax,%edx
+  8007c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c9:	83 c0 08             	add    $0x8,%eax
+  8007cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007cf:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007d2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007d7:	e9 1b 01 00 00       	jmp    8008f7 <vprintfmt+0x5c0>
+  8007dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e8:	eb e5                	jmp    8007cf <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f6:	e9 56 ff ff ff       	jmp    800751 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007fb:	40 84 f6             	test   %sil,%sil
+  8007fe:	75 2e                	jne    80082e <vprintfmt+0x4f7>
+    switch (lflag) {
+  800800:	85 d2                	test   %edx,%edx
+  800802:	74 59                	je     80085d <vprintfmt+0x526>
+  800804:	83 fa 01             	cmp    $0x1,%edx
+  800807:	74 7f                	je     800888 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800809:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080c:	83 f8 2f             	cmp    $0x2f,%eax
+  80080f:	0f 87 9f 00 00 00    	ja     8008b4 <vprintfmt+0x57d>
+  800815:	89 c2                	mov    %eax,%edx
+  800817:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081b:	83 c0 08             	add    $0x8,%eax
+  80081e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800821:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800824:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800829:	e9 c9 00 00 00       	jmp    8008f7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80082e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800831:	83 f8 2f             	cmp    $0x2f,%eax
+  800834:	77 19                	ja     80084f <vprintfmt+0x518>
+  800836:	89 c2                	mov    %eax,%edx
+  800838:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083c:	83 c0 08             	add    $0x8,%eax
+  80083f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800842:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800845:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80084a:	e9 a8 00 00 00       	jmp    8008f7 <vprintfmt+0x5c0>
+  80084f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800853:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800857:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085b:	eb e5                	jmp    800842 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80085d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800860:	83 f8 2f             	cmp    $0x2f,%eax
+  800863:	77 15                	ja     80087a <vprintfmt+0x543>
+  800865:	89 c2                	mov    %eax,%edx
+  800867:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086b:	83 c0 08             	add    $0x8,%eax
+  80086e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800871:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800873:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800878:	eb 7d                	jmp    8008f7 <vprintfmt+0x5c0>
+  80087a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800882:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800886:	eb e9                	jmp    800871 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800888:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088b:	83 f8 2f             	cmp    $0x2f,%eax
+  80088e:	77 16                	ja     8008a6 <vprintfmt+0x56f>
+  800890:	89 c2                	mov    %eax,%edx
+  800892:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800896:	83 c0 08             	add    $0x8,%eax
+  800899:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80089f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8008a4:	eb 51                	jmp    8008f7 <vprintfmt+0x5c0>
+  8008a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b2:	eb e8                	jmp    80089c <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008b4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c0:	e9 5c ff ff ff       	jmp    800821 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008c5:	4c 89 ee             	mov    %r13,%rsi
+  8008c8:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008cd:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008d0:	4c 89 ee             	mov    %r13,%rsi
+  8008d3:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008d8:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008de:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e1:	77 47                	ja     80092a <vprintfmt+0x5f3>
+  8008e3:	89 c2                	mov    %eax,%edx
+  8008e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e9:	83 c0 08             	add    $0x8,%eax
+  8008ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ef:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008f2:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8008fb:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008ff:	0f 94 c0             	sete   %al
+  800902:	0f b6 c0             	movzbl %al,%eax
+  800905:	50                   	push   %rax
+  800906:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80090b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80090f:	4c 89 ee             	mov    %r13,%rsi
+  800912:	4c 89 f7             	mov    %r14,%rdi
+  800915:	48 b8 2c 02 80 00 00 	movabs $0x80022c,%rax
+  80091c:	00 00 00 
+  80091f:	ff d0                	call   *%rax
+            break;
+  800921:	48 83 c4 10          	add    $0x10,%rsp
+  800925:	e9 3e fa ff ff       	jmp    800368 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80092a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800932:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800936:	eb b7                	jmp    8008ef <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800938:	40 84 f6             	test   %sil,%sil
+  80093b:	75 2b                	jne    800968 <vprintfmt+0x631>
+    switch (lflag) {
+  80093d:	85 d2                	test   %edx,%edx
+  80093f:	74 56                	je     800997 <vprintfmt+0x660>
+  800941:	83 fa 01             	cmp    $0x1,%edx
+  800944:	74 7f                	je     8009c5 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800946:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800949:	83 f8 2f             	cmp    $0x2f,%eax
+  80094c:	0f 87 a2 00 00 00    	ja     8009f4 <vprintfmt+0x6bd>
+  800952:	89 c2                	mov    %eax,%edx
+  800954:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800958:	83 c0 08             	add    $0x8,%eax
+  80095b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800961:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800966:	eb 8f                	jmp    8008f7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800968:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096b:	83 f8 2f             	cmp    $0x2f,%eax
+  80096e:	77 19                	ja     800989 <vprintfmt+0x652>
+  800970:	89 c2                	mov    %eax,%edx
+  800972:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800976:	83 c0 08             	add    $0x8,%eax
+  800979:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80097f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800984:	e9 6e ff ff ff       	jmp    8008f7 <vprintfmt+0x5c0>
+  800989:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80098d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800991:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800995:	eb e5                	jmp    80097c <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800997:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099a:	83 f8 2f             	cmp    $0x2f,%eax
+  80099d:	77 18                	ja     8009b7 <vprintfmt+0x680>
+  80099f:	89 c2                	mov    %eax,%edx
+  8009a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a5:	83 c0 08             	add    $0x8,%eax
+  8009a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ab:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009ad:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009b2:	e9 40 ff ff ff       	jmp    8008f7 <vprintfmt+0x5c0>
+  8009b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c3:	eb e6                	jmp    8009ab <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009cb:	77 19                	ja     8009e6 <vprintfmt+0x6af>
+  8009cd:	89 c2                	mov    %eax,%edx
+  8009cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d3:	83 c0 08             	add    $0x8,%eax
+  8009d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009dc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009e1:	e9 11 ff ff ff       	jmp    8008f7 <vprintfmt+0x5c0>
+  8009e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f2:	eb e5                	jmp    8009d9 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a00:	e9 59 ff ff ff       	jmp    80095e <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a05:	4c 89 ee             	mov    %r13,%rsi
+  800a08:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a0d:	41 ff d6             	call   *%r14
+            break;
+  800a10:	e9 53 f9 ff ff       	jmp    800368 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a15:	4c 89 ee             	mov    %r13,%rsi
+  800a18:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a1d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a20:	48 83 eb 01          	sub    $0x1,%rbx
+  800a24:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a28:	75 f6                	jne    800a20 <vprintfmt+0x6e9>
+  800a2a:	e9 39 f9 ff ff       	jmp    800368 <vprintfmt+0x31>
+}
+  800a2f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a33:	5b                   	pop    %rbx
+  800a34:	41 5c                	pop    %r12
+  800a36:	41 5d                	pop    %r13
+  800a38:	41 5e                	pop    %r14
+  800a3a:	41 5f                	pop    %r15
+  800a3c:	5d                   	pop    %rbp
+  800a3d:	c3                   	ret
+
+0000000000800a3e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a3e:	55                   	push   %rbp
+  800a3f:	48 89 e5             	mov    %rsp,%rbp
+  800a42:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a46:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a4a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a4f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a53:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a5a:	48 85 ff             	test   %rdi,%rdi
+  800a5d:	74 2b                	je     800a8a <vsnprintf+0x4c>
+  800a5f:	48 85 f6             	test   %rsi,%rsi
+  800a62:	74 26                	je     800a8a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a64:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a68:	48 bf e2 02 80 00 00 	movabs $0x8002e2,%rdi
+  800a6f:	00 00 00 
+  800a72:	48 b8 37 03 80 00 00 	movabs $0x800337,%rax
+  800a79:	00 00 00 
+  800a7c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a82:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a85:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a88:	c9                   	leave
+  800a89:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a8a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a8f:	eb f7                	jmp    800a88 <vsnprintf+0x4a>
+
+0000000000800a91 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a91:	55                   	push   %rbp
+  800a92:	48 89 e5             	mov    %rsp,%rbp
+  800a95:	48 83 ec 50          	sub    $0x50,%rsp
+  800a99:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a9d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800aa1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800aa5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800aac:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ab0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ab8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800abc:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ac0:	48 b8 3e 0a 80 00 00 	movabs $0x800a3e,%rax
+  800ac7:	00 00 00 
+  800aca:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800acc:	c9                   	leave
+  800acd:	c3                   	ret
+
+0000000000800ace <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ace:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ad1:	74 10                	je     800ae3 <strlen+0x15>
+    size_t n = 0;
+  800ad3:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ad8:	48 83 c0 01          	add    $0x1,%rax
+  800adc:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ae0:	75 f6                	jne    800ad8 <strlen+0xa>
+  800ae2:	c3                   	ret
+    size_t n = 0;
+  800ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ae8:	c3                   	ret
+
+0000000000800ae9 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ae9:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800aec:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800af1:	48 85 f6             	test   %rsi,%rsi
+  800af4:	74 11                	je     800b07 <strnlen+0x1e>
+  800af6:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800afa:	74 0c                	je     800b08 <strnlen+0x1f>
+  800afc:	48 83 c2 01          	add    $0x1,%rdx
+  800b00:	48 39 d0             	cmp    %rdx,%rax
+  800b03:	75 f1                	jne    800af6 <strnlen+0xd>
+  800b05:	eb 04                	jmp    800b0b <strnlen+0x22>
+  800b07:	c3                   	ret
+  800b08:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b0b:	c3                   	ret
+
+0000000000800b0c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b0c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b14:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b18:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b1b:	48 83 c2 01          	add    $0x1,%rdx
+  800b1f:	84 c9                	test   %cl,%cl
+  800b21:	75 f1                	jne    800b14 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b23:	c3                   	ret
+
+0000000000800b24 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b24:	55                   	push   %rbp
+  800b25:	48 89 e5             	mov    %rsp,%rbp
+  800b28:	41 54                	push   %r12
+  800b2a:	53                   	push   %rbx
+  800b2b:	48 89 fb             	mov    %rdi,%rbx
+  800b2e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b31:	48 b8 ce 0a 80 00 00 	movabs $0x800ace,%rax
+  800b38:	00 00 00 
+  800b3b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b3d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b41:	4c 89 e6             	mov    %r12,%rsi
+  800b44:	48 b8 0c 0b 80 00 00 	movabs $0x800b0c,%rax
+  800b4b:	00 00 00 
+  800b4e:	ff d0                	call   *%rax
+    return dst;
+}
+  800b50:	48 89 d8             	mov    %rbx,%rax
+  800b53:	5b                   	pop    %rbx
+  800b54:	41 5c                	pop    %r12
+  800b56:	5d                   	pop    %rbp
+  800b57:	c3                   	ret
+
+0000000000800b58 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b58:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b5b:	48 85 d2             	test   %rdx,%rdx
+  800b5e:	74 1f                	je     800b7f <strncpy+0x27>
+  800b60:	48 01 fa             	add    %rdi,%rdx
+  800b63:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b66:	48 83 c1 01          	add    $0x1,%rcx
+  800b6a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b6e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b72:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b76:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b7a:	48 39 ca             	cmp    %rcx,%rdx
+  800b7d:	75 e7                	jne    800b66 <strncpy+0xe>
+    }
+    return ret;
+}
+  800b7f:	c3                   	ret
+
+0000000000800b80 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b80:	48 89 f8             	mov    %rdi,%rax
+  800b83:	48 85 d2             	test   %rdx,%rdx
+  800b86:	74 24                	je     800bac <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b88:	48 83 ea 01          	sub    $0x1,%rdx
+  800b8c:	74 1b                	je     800ba9 <strlcpy+0x29>
+  800b8e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b92:	0f b6 16             	movzbl (%rsi),%edx
+  800b95:	84 d2                	test   %dl,%dl
+  800b97:	74 10                	je     800ba9 <strlcpy+0x29>
+            *dst++ = *src++;
+  800b99:	48 83 c6 01          	add    $0x1,%rsi
+  800b9d:	48 83 c0 01          	add    $0x1,%rax
+  800ba1:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ba4:	48 39 c8             	cmp    %rcx,%rax
+  800ba7:	75 e9                	jne    800b92 <strlcpy+0x12>
+        *dst = '\0';
+  800ba9:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bac:	48 29 f8             	sub    %rdi,%rax
+}
+  800baf:	c3                   	ret
+
+0000000000800bb0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800bb0:	0f b6 07             	movzbl (%rdi),%eax
+  800bb3:	84 c0                	test   %al,%al
+  800bb5:	74 13                	je     800bca <strcmp+0x1a>
+  800bb7:	38 06                	cmp    %al,(%rsi)
+  800bb9:	75 0f                	jne    800bca <strcmp+0x1a>
+  800bbb:	48 83 c7 01          	add    $0x1,%rdi
+  800bbf:	48 83 c6 01          	add    $0x1,%rsi
+  800bc3:	0f b6 07             	movzbl (%rdi),%eax
+  800bc6:	84 c0                	test   %al,%al
+  800bc8:	75 ed                	jne    800bb7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bca:	0f b6 c0             	movzbl %al,%eax
+  800bcd:	0f b6 16             	movzbl (%rsi),%edx
+  800bd0:	29 d0                	sub    %edx,%eax
+}
+  800bd2:	c3                   	ret
+
+0000000000800bd3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bd3:	48 85 d2             	test   %rdx,%rdx
+  800bd6:	74 1f                	je     800bf7 <strncmp+0x24>
+  800bd8:	0f b6 07             	movzbl (%rdi),%eax
+  800bdb:	84 c0                	test   %al,%al
+  800bdd:	74 1e                	je     800bfd <strncmp+0x2a>
+  800bdf:	3a 06                	cmp    (%rsi),%al
+  800be1:	75 1a                	jne    800bfd <strncmp+0x2a>
+  800be3:	48 83 c7 01          	add    $0x1,%rdi
+  800be7:	48 83 c6 01          	add    $0x1,%rsi
+  800beb:	48 83 ea 01          	sub    $0x1,%rdx
+  800bef:	75 e7                	jne    800bd8 <strncmp+0x5>
+
+    if (!n) return 0;
+  800bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf6:	c3                   	ret
+  800bf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfc:	c3                   	ret
+  800bfd:	48 85 d2             	test   %rdx,%rdx
+  800c00:	74 09                	je     800c0b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c02:	0f b6 07             	movzbl (%rdi),%eax
+  800c05:	0f b6 16             	movzbl (%rsi),%edx
+  800c08:	29 d0                	sub    %edx,%eax
+  800c0a:	c3                   	ret
+    if (!n) return 0;
+  800c0b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c10:	c3                   	ret
+
+0000000000800c11 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c11:	0f b6 17             	movzbl (%rdi),%edx
+  800c14:	84 d2                	test   %dl,%dl
+  800c16:	74 18                	je     800c30 <strchr+0x1f>
+        if (*str == c) {
+  800c18:	0f be d2             	movsbl %dl,%edx
+  800c1b:	39 f2                	cmp    %esi,%edx
+  800c1d:	74 17                	je     800c36 <strchr+0x25>
+    for (; *str; str++) {
+  800c1f:	48 83 c7 01          	add    $0x1,%rdi
+  800c23:	0f b6 17             	movzbl (%rdi),%edx
+  800c26:	84 d2                	test   %dl,%dl
+  800c28:	75 ee                	jne    800c18 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2f:	c3                   	ret
+  800c30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c35:	c3                   	ret
+  800c36:	48 89 f8             	mov    %rdi,%rax
+}
+  800c39:	c3                   	ret
+
+0000000000800c3a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c3a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c3d:	0f b6 17             	movzbl (%rdi),%edx
+  800c40:	84 d2                	test   %dl,%dl
+  800c42:	74 13                	je     800c57 <strfind+0x1d>
+  800c44:	0f be d2             	movsbl %dl,%edx
+  800c47:	39 f2                	cmp    %esi,%edx
+  800c49:	74 0b                	je     800c56 <strfind+0x1c>
+  800c4b:	48 83 c0 01          	add    $0x1,%rax
+  800c4f:	0f b6 10             	movzbl (%rax),%edx
+  800c52:	84 d2                	test   %dl,%dl
+  800c54:	75 ee                	jne    800c44 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c56:	c3                   	ret
+  800c57:	c3                   	ret
+
+0000000000800c58 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c58:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c5b:	48 89 f8             	mov    %rdi,%rax
+  800c5e:	48 f7 d8             	neg    %rax
+  800c61:	83 e0 07             	and    $0x7,%eax
+  800c64:	49 89 d1             	mov    %rdx,%r9
+  800c67:	49 29 c1             	sub    %rax,%r9
+  800c6a:	78 36                	js     800ca2 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c6c:	40 0f b6 c6          	movzbl %sil,%eax
+  800c70:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c77:	01 01 01 
+  800c7a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c7e:	40 f6 c7 07          	test   $0x7,%dil
+  800c82:	75 38                	jne    800cbc <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c84:	4c 89 c9             	mov    %r9,%rcx
+  800c87:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c8b:	74 0c                	je     800c99 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c8d:	fc                   	cld
+  800c8e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c91:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c95:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c99:	4d 85 c9             	test   %r9,%r9
+  800c9c:	75 45                	jne    800ce3 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c9e:	4c 89 c0             	mov    %r8,%rax
+  800ca1:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ca2:	48 85 d2             	test   %rdx,%rdx
+  800ca5:	74 f7                	je     800c9e <memset+0x46>
+  800ca7:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800caa:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800cad:	48 83 c0 01          	add    $0x1,%rax
+  800cb1:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800cb5:	48 39 c2             	cmp    %rax,%rdx
+  800cb8:	75 f3                	jne    800cad <memset+0x55>
+  800cba:	eb e2                	jmp    800c9e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800cbc:	40 f6 c7 01          	test   $0x1,%dil
+  800cc0:	74 06                	je     800cc8 <memset+0x70>
+  800cc2:	88 07                	mov    %al,(%rdi)
+  800cc4:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cc8:	40 f6 c7 02          	test   $0x2,%dil
+  800ccc:	74 07                	je     800cd5 <memset+0x7d>
+  800cce:	66 89 07             	mov    %ax,(%rdi)
+  800cd1:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cd5:	40 f6 c7 04          	test   $0x4,%dil
+  800cd9:	74 a9                	je     800c84 <memset+0x2c>
+  800cdb:	89 07                	mov    %eax,(%rdi)
+  800cdd:	48 83 c7 04          	add    $0x4,%rdi
+  800ce1:	eb a1                	jmp    800c84 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ce3:	41 f6 c1 04          	test   $0x4,%r9b
+  800ce7:	74 06                	je     800cef <memset+0x97>
+  800ce9:	89 07                	mov    %eax,(%rdi)
+  800ceb:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cef:	41 f6 c1 02          	test   $0x2,%r9b
+  800cf3:	74 07                	je     800cfc <memset+0xa4>
+  800cf5:	66 89 07             	mov    %ax,(%rdi)
+  800cf8:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800cfc:	41 f6 c1 01          	test   $0x1,%r9b
+  800d00:	74 9c                	je     800c9e <memset+0x46>
+  800d02:	88 07                	mov    %al,(%rdi)
+  800d04:	eb 98                	jmp    800c9e <memset+0x46>
+
+0000000000800d06 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d06:	48 89 f8             	mov    %rdi,%rax
+  800d09:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d0c:	48 39 fe             	cmp    %rdi,%rsi
+  800d0f:	73 3b                	jae    800d4c <memmove+0x46>
+  800d11:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d15:	48 39 d7             	cmp    %rdx,%rdi
+  800d18:	73 32                	jae    800d4c <memmove+0x46>
+        s += n;
+        d += n;
+  800d1a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d1e:	48 89 d6             	mov    %rdx,%rsi
+  800d21:	48 09 fe             	or     %rdi,%rsi
+  800d24:	48 09 ce             	or     %rcx,%rsi
+  800d27:	40 f6 c6 07          	test   $0x7,%sil
+  800d2b:	75 12                	jne    800d3f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d2d:	48 83 ef 08          	sub    $0x8,%rdi
+  800d31:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d35:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d39:	fd                   	std
+  800d3a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d3d:	fc                   	cld
+  800d3e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d3f:	48 83 ef 01          	sub    $0x1,%rdi
+  800d43:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d47:	fd                   	std
+  800d48:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d4a:	eb f1                	jmp    800d3d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d4c:	48 89 f2             	mov    %rsi,%rdx
+  800d4f:	48 09 c2             	or     %rax,%rdx
+  800d52:	48 09 ca             	or     %rcx,%rdx
+  800d55:	f6 c2 07             	test   $0x7,%dl
+  800d58:	75 0c                	jne    800d66 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d5a:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d5e:	48 89 c7             	mov    %rax,%rdi
+  800d61:	fc                   	cld
+  800d62:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d65:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d66:	48 89 c7             	mov    %rax,%rdi
+  800d69:	fc                   	cld
+  800d6a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d6c:	c3                   	ret
+
+0000000000800d6d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d6d:	55                   	push   %rbp
+  800d6e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d71:	48 b8 06 0d 80 00 00 	movabs $0x800d06,%rax
+  800d78:	00 00 00 
+  800d7b:	ff d0                	call   *%rax
+}
+  800d7d:	5d                   	pop    %rbp
+  800d7e:	c3                   	ret
+
+0000000000800d7f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d7f:	55                   	push   %rbp
+  800d80:	48 89 e5             	mov    %rsp,%rbp
+  800d83:	41 57                	push   %r15
+  800d85:	41 56                	push   %r14
+  800d87:	41 55                	push   %r13
+  800d89:	41 54                	push   %r12
+  800d8b:	53                   	push   %rbx
+  800d8c:	48 83 ec 08          	sub    $0x8,%rsp
+  800d90:	49 89 fe             	mov    %rdi,%r14
+  800d93:	49 89 f7             	mov    %rsi,%r15
+  800d96:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d99:	48 89 f7             	mov    %rsi,%rdi
+  800d9c:	48 b8 ce 0a 80 00 00 	movabs $0x800ace,%rax
+  800da3:	00 00 00 
+  800da6:	ff d0                	call   *%rax
+  800da8:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800dab:	48 89 de             	mov    %rbx,%rsi
+  800dae:	4c 89 f7             	mov    %r14,%rdi
+  800db1:	48 b8 e9 0a 80 00 00 	movabs $0x800ae9,%rax
+  800db8:	00 00 00 
+  800dbb:	ff d0                	call   *%rax
+  800dbd:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800dc0:	48 39 c3             	cmp    %rax,%rbx
+  800dc3:	74 36                	je     800dfb <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800dc5:	48 89 d8             	mov    %rbx,%rax
+  800dc8:	4c 29 e8             	sub    %r13,%rax
+  800dcb:	49 39 c4             	cmp    %rax,%r12
+  800dce:	73 31                	jae    800e01 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800dd0:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dd5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dd9:	4c 89 fe             	mov    %r15,%rsi
+  800ddc:	48 b8 6d 0d 80 00 00 	movabs $0x800d6d,%rax
+  800de3:	00 00 00 
+  800de6:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800de8:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800dec:	48 83 c4 08          	add    $0x8,%rsp
+  800df0:	5b                   	pop    %rbx
+  800df1:	41 5c                	pop    %r12
+  800df3:	41 5d                	pop    %r13
+  800df5:	41 5e                	pop    %r14
+  800df7:	41 5f                	pop    %r15
+  800df9:	5d                   	pop    %rbp
+  800dfa:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800dfb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800dff:	eb eb                	jmp    800dec <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e01:	48 83 eb 01          	sub    $0x1,%rbx
+  800e05:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e09:	48 89 da             	mov    %rbx,%rdx
+  800e0c:	4c 89 fe             	mov    %r15,%rsi
+  800e0f:	48 b8 6d 0d 80 00 00 	movabs $0x800d6d,%rax
+  800e16:	00 00 00 
+  800e19:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e1b:	49 01 de             	add    %rbx,%r14
+  800e1e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e23:	eb c3                	jmp    800de8 <strlcat+0x69>
+
+0000000000800e25 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e25:	48 85 d2             	test   %rdx,%rdx
+  800e28:	74 2d                	je     800e57 <memcmp+0x32>
+  800e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e2f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e33:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e38:	44 38 c1             	cmp    %r8b,%cl
+  800e3b:	75 0f                	jne    800e4c <memcmp+0x27>
+    while (n-- > 0) {
+  800e3d:	48 83 c0 01          	add    $0x1,%rax
+  800e41:	48 39 c2             	cmp    %rax,%rdx
+  800e44:	75 e9                	jne    800e2f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e46:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e4c:	0f b6 c1             	movzbl %cl,%eax
+  800e4f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e53:	44 29 c0             	sub    %r8d,%eax
+  800e56:	c3                   	ret
+    return 0;
+  800e57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e5c:	c3                   	ret
+
+0000000000800e5d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e5d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e61:	48 39 c7             	cmp    %rax,%rdi
+  800e64:	73 0f                	jae    800e75 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e66:	40 38 37             	cmp    %sil,(%rdi)
+  800e69:	74 0e                	je     800e79 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e6b:	48 83 c7 01          	add    $0x1,%rdi
+  800e6f:	48 39 f8             	cmp    %rdi,%rax
+  800e72:	75 f2                	jne    800e66 <memfind+0x9>
+  800e74:	c3                   	ret
+  800e75:	48 89 f8             	mov    %rdi,%rax
+  800e78:	c3                   	ret
+  800e79:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e7c:	c3                   	ret
+
+0000000000800e7d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e7d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e80:	0f b6 37             	movzbl (%rdi),%esi
+  800e83:	40 80 fe 20          	cmp    $0x20,%sil
+  800e87:	74 06                	je     800e8f <strtol+0x12>
+  800e89:	40 80 fe 09          	cmp    $0x9,%sil
+  800e8d:	75 13                	jne    800ea2 <strtol+0x25>
+  800e8f:	48 83 c7 01          	add    $0x1,%rdi
+  800e93:	0f b6 37             	movzbl (%rdi),%esi
+  800e96:	40 80 fe 20          	cmp    $0x20,%sil
+  800e9a:	74 f3                	je     800e8f <strtol+0x12>
+  800e9c:	40 80 fe 09          	cmp    $0x9,%sil
+  800ea0:	74 ed                	je     800e8f <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800ea2:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800ea5:	83 e0 fd             	and    $0xfffffffd,%eax
+  800ea8:	3c 01                	cmp    $0x1,%al
+  800eaa:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eae:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800eb4:	75 0f                	jne    800ec5 <strtol+0x48>
+  800eb6:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800eb9:	74 14                	je     800ecf <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ebb:	85 d2                	test   %edx,%edx
+  800ebd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ec2:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ec5:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800eca:	4c 63 ca             	movslq %edx,%r9
+  800ecd:	eb 36                	jmp    800f05 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ecf:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ed3:	74 0f                	je     800ee4 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ed5:	85 d2                	test   %edx,%edx
+  800ed7:	75 ec                	jne    800ec5 <strtol+0x48>
+        s++;
+  800ed9:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800edd:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ee2:	eb e1                	jmp    800ec5 <strtol+0x48>
+        s += 2;
+  800ee4:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ee8:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800eed:	eb d6                	jmp    800ec5 <strtol+0x48>
+            dig -= '0';
+  800eef:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ef2:	44 0f b6 c1          	movzbl %cl,%r8d
+  800ef6:	41 39 d0             	cmp    %edx,%r8d
+  800ef9:	7d 21                	jge    800f1c <strtol+0x9f>
+        val = val * base + dig;
+  800efb:	49 0f af c1          	imul   %r9,%rax
+  800eff:	0f b6 c9             	movzbl %cl,%ecx
+  800f02:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f05:	48 83 c7 01          	add    $0x1,%rdi
+  800f09:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f0d:	80 f9 39             	cmp    $0x39,%cl
+  800f10:	76 dd                	jbe    800eef <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f12:	80 f9 7b             	cmp    $0x7b,%cl
+  800f15:	77 05                	ja     800f1c <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f17:	83 e9 57             	sub    $0x57,%ecx
+  800f1a:	eb d6                	jmp    800ef2 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f1c:	4d 85 d2             	test   %r10,%r10
+  800f1f:	74 03                	je     800f24 <strtol+0xa7>
+  800f21:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f24:	48 89 c2             	mov    %rax,%rdx
+  800f27:	48 f7 da             	neg    %rdx
+  800f2a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f2e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f32:	c3                   	ret
+
+0000000000800f33 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f33:	55                   	push   %rbp
+  800f34:	48 89 e5             	mov    %rsp,%rbp
+  800f37:	53                   	push   %rbx
+  800f38:	48 89 fa             	mov    %rdi,%rdx
+  800f3b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f3e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f48:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f4d:	be 00 00 00 00       	mov    $0x0,%esi
+  800f52:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f58:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f5a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f5e:	c9                   	leave
+  800f5f:	c3                   	ret
+
+0000000000800f60 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f60:	55                   	push   %rbp
+  800f61:	48 89 e5             	mov    %rsp,%rbp
+  800f64:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f65:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f74:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f79:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f7e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f83:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f89:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f8b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f8f:	c9                   	leave
+  800f90:	c3                   	ret
+
+0000000000800f91 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800f91:	55                   	push   %rbp
+  800f92:	48 89 e5             	mov    %rsp,%rbp
+  800f95:	53                   	push   %rbx
+  800f96:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f9a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800f9d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fa2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fa7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fb1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fbc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800fbe:	48 85 c0             	test   %rax,%rax
+  800fc1:	7f 06                	jg     800fc9 <sys_env_destroy+0x38>
+}
+  800fc3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fc7:	c9                   	leave
+  800fc8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fc9:	49 89 c0             	mov    %rax,%r8
+  800fcc:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fd1:	48 ba d0 30 80 00 00 	movabs $0x8030d0,%rdx
+  800fd8:	00 00 00 
+  800fdb:	be 26 00 00 00       	mov    $0x26,%esi
+  800fe0:	48 bf ef 30 80 00 00 	movabs $0x8030ef,%rdi
+  800fe7:	00 00 00 
+  800fea:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fef:	49 b9 31 29 80 00 00 	movabs $0x802931,%r9
+  800ff6:	00 00 00 
+  800ff9:	41 ff d1             	call   *%r9
+
+0000000000800ffc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800ffc:	55                   	push   %rbp
+  800ffd:	48 89 e5             	mov    %rsp,%rbp
+  801000:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801001:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801006:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801010:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801015:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80101a:	be 00 00 00 00       	mov    $0x0,%esi
+  80101f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801025:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801027:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80102b:	c9                   	leave
+  80102c:	c3                   	ret
+
+000000000080102d <sys_yield>:
+
+void
+sys_yield(void) {
+  80102d:	55                   	push   %rbp
+  80102e:	48 89 e5             	mov    %rsp,%rbp
+  801031:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801032:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801037:	ba 00 00 00 00       	mov    $0x0,%edx
+  80103c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801041:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801046:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80104b:	be 00 00 00 00       	mov    $0x0,%esi
+  801050:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801056:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801058:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80105c:	c9                   	leave
+  80105d:	c3                   	ret
+
+000000000080105e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80105e:	55                   	push   %rbp
+  80105f:	48 89 e5             	mov    %rsp,%rbp
+  801062:	53                   	push   %rbx
+  801063:	48 89 fa             	mov    %rdi,%rdx
+  801066:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801069:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80106e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801075:	00 00 00 
+  801078:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80107d:	be 00 00 00 00       	mov    $0x0,%esi
+  801082:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801088:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80108a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80108e:	c9                   	leave
+  80108f:	c3                   	ret
+
+0000000000801090 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801090:	55                   	push   %rbp
+  801091:	48 89 e5             	mov    %rsp,%rbp
+  801094:	53                   	push   %rbx
+  801095:	49 89 f8             	mov    %rdi,%r8
+  801098:	48 89 d3             	mov    %rdx,%rbx
+  80109b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80109e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010a3:	4c 89 c2             	mov    %r8,%rdx
+  8010a6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010b4:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8010b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010ba:	c9                   	leave
+  8010bb:	c3                   	ret
+
+00000000008010bc <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8010bc:	55                   	push   %rbp
+  8010bd:	48 89 e5             	mov    %rsp,%rbp
+  8010c0:	53                   	push   %rbx
+  8010c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8010c5:	89 f8                	mov    %edi,%eax
+  8010c7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010ca:	48 63 f9             	movslq %ecx,%rdi
+  8010cd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010d0:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010d5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8010dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010e3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010e5:	48 85 c0             	test   %rax,%rax
+  8010e8:	7f 06                	jg     8010f0 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8010ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010ee:	c9                   	leave
+  8010ef:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010f0:	49 89 c0             	mov    %rax,%r8
+  8010f3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8010f8:	48 ba d0 30 80 00 00 	movabs $0x8030d0,%rdx
+  8010ff:	00 00 00 
+  801102:	be 26 00 00 00       	mov    $0x26,%esi
+  801107:	48 bf ef 30 80 00 00 	movabs $0x8030ef,%rdi
+  80110e:	00 00 00 
+  801111:	b8 00 00 00 00       	mov    $0x0,%eax
+  801116:	49 b9 31 29 80 00 00 	movabs $0x802931,%r9
+  80111d:	00 00 00 
+  801120:	41 ff d1             	call   *%r9
+
+0000000000801123 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801123:	55                   	push   %rbp
+  801124:	48 89 e5             	mov    %rsp,%rbp
+  801127:	53                   	push   %rbx
+  801128:	48 83 ec 08          	sub    $0x8,%rsp
+  80112c:	89 f8                	mov    %edi,%eax
+  80112e:	49 89 f2             	mov    %rsi,%r10
+  801131:	48 89 cf             	mov    %rcx,%rdi
+  801134:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801137:	48 63 da             	movslq %edx,%rbx
+  80113a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80113d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801142:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801145:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801148:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80114a:	48 85 c0             	test   %rax,%rax
+  80114d:	7f 06                	jg     801155 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80114f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801153:	c9                   	leave
+  801154:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801155:	49 89 c0             	mov    %rax,%r8
+  801158:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80115d:	48 ba d0 30 80 00 00 	movabs $0x8030d0,%rdx
+  801164:	00 00 00 
+  801167:	be 26 00 00 00       	mov    $0x26,%esi
+  80116c:	48 bf ef 30 80 00 00 	movabs $0x8030ef,%rdi
+  801173:	00 00 00 
+  801176:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117b:	49 b9 31 29 80 00 00 	movabs $0x802931,%r9
+  801182:	00 00 00 
+  801185:	41 ff d1             	call   *%r9
+
+0000000000801188 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801188:	55                   	push   %rbp
+  801189:	48 89 e5             	mov    %rsp,%rbp
+  80118c:	53                   	push   %rbx
+  80118d:	48 83 ec 08          	sub    $0x8,%rsp
+  801191:	48 89 f1             	mov    %rsi,%rcx
+  801194:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801197:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80119a:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80119f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011af:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011b1:	48 85 c0             	test   %rax,%rax
+  8011b4:	7f 06                	jg     8011bc <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8011b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ba:	c9                   	leave
+  8011bb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011bc:	49 89 c0             	mov    %rax,%r8
+  8011bf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011c4:	48 ba d0 30 80 00 00 	movabs $0x8030d0,%rdx
+  8011cb:	00 00 00 
+  8011ce:	be 26 00 00 00       	mov    $0x26,%esi
+  8011d3:	48 bf ef 30 80 00 00 	movabs $0x8030ef,%rdi
+  8011da:	00 00 00 
+  8011dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e2:	49 b9 31 29 80 00 00 	movabs $0x802931,%r9
+  8011e9:	00 00 00 
+  8011ec:	41 ff d1             	call   *%r9
+
+00000000008011ef <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8011ef:	55                   	push   %rbp
+  8011f0:	48 89 e5             	mov    %rsp,%rbp
+  8011f3:	53                   	push   %rbx
+  8011f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8011f8:	89 f8                	mov    %edi,%eax
+  8011fa:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8011fd:	48 63 f9             	movslq %ecx,%rdi
+  801200:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801203:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801208:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80120b:	be 00 00 00 00       	mov    $0x0,%esi
+  801210:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801216:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801218:	48 85 c0             	test   %rax,%rax
+  80121b:	7f 06                	jg     801223 <sys_region_advise+0x34>
+}
+  80121d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801221:	c9                   	leave
+  801222:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801223:	49 89 c0             	mov    %rax,%r8
+  801226:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80122b:	48 ba d0 30 80 00 00 	movabs $0x8030d0,%rdx
+  801232:	00 00 00 
+  801235:	be 26 00 00 00       	mov    $0x26,%esi
+  80123a:	48 bf ef 30 80 00 00 	movabs $0x8030ef,%rdi
+  801241:	00 00 00 
+  801244:	b8 00 00 00 00       	mov    $0x0,%eax
+  801249:	49 b9 31 29 80 00 00 	movabs $0x802931,%r9
+  801250:	00 00 00 
+  801253:	41 ff d1             	call   *%r9
+
+0000000000801256 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801256:	55                   	push   %rbp
+  801257:	48 89 e5             	mov    %rsp,%rbp
+  80125a:	53                   	push   %rbx
+  80125b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80125f:	48 63 ce             	movslq %esi,%rcx
+  801262:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801265:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80126a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801274:	be 00 00 00 00       	mov    $0x0,%esi
+  801279:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80127f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801281:	48 85 c0             	test   %rax,%rax
+  801284:	7f 06                	jg     80128c <sys_env_set_nice+0x36>
+}
+  801286:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80128a:	c9                   	leave
+  80128b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80128c:	49 89 c0             	mov    %rax,%r8
+  80128f:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801294:	48 ba d0 30 80 00 00 	movabs $0x8030d0,%rdx
+  80129b:	00 00 00 
+  80129e:	be 26 00 00 00       	mov    $0x26,%esi
+  8012a3:	48 bf ef 30 80 00 00 	movabs $0x8030ef,%rdi
+  8012aa:	00 00 00 
+  8012ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b2:	49 b9 31 29 80 00 00 	movabs $0x802931,%r9
+  8012b9:	00 00 00 
+  8012bc:	41 ff d1             	call   *%r9
+
+00000000008012bf <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8012bf:	55                   	push   %rbp
+  8012c0:	48 89 e5             	mov    %rsp,%rbp
+  8012c3:	53                   	push   %rbx
+  8012c4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012c8:	48 63 ce             	movslq %esi,%rcx
+  8012cb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ce:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012ea:	48 85 c0             	test   %rax,%rax
+  8012ed:	7f 06                	jg     8012f5 <sys_env_set_status+0x36>
+}
+  8012ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f3:	c9                   	leave
+  8012f4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012f5:	49 89 c0             	mov    %rax,%r8
+  8012f8:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012fd:	48 ba d0 30 80 00 00 	movabs $0x8030d0,%rdx
+  801304:	00 00 00 
+  801307:	be 26 00 00 00       	mov    $0x26,%esi
+  80130c:	48 bf ef 30 80 00 00 	movabs $0x8030ef,%rdi
+  801313:	00 00 00 
+  801316:	b8 00 00 00 00       	mov    $0x0,%eax
+  80131b:	49 b9 31 29 80 00 00 	movabs $0x802931,%r9
+  801322:	00 00 00 
+  801325:	41 ff d1             	call   *%r9
+
+0000000000801328 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801328:	55                   	push   %rbp
+  801329:	48 89 e5             	mov    %rsp,%rbp
+  80132c:	53                   	push   %rbx
+  80132d:	48 83 ec 08          	sub    $0x8,%rsp
+  801331:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801334:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801337:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80133c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801341:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801346:	be 00 00 00 00       	mov    $0x0,%esi
+  80134b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801351:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801353:	48 85 c0             	test   %rax,%rax
+  801356:	7f 06                	jg     80135e <sys_env_set_trapframe+0x36>
+}
+  801358:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135c:	c9                   	leave
+  80135d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80135e:	49 89 c0             	mov    %rax,%r8
+  801361:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801366:	48 ba d0 30 80 00 00 	movabs $0x8030d0,%rdx
+  80136d:	00 00 00 
+  801370:	be 26 00 00 00       	mov    $0x26,%esi
+  801375:	48 bf ef 30 80 00 00 	movabs $0x8030ef,%rdi
+  80137c:	00 00 00 
+  80137f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801384:	49 b9 31 29 80 00 00 	movabs $0x802931,%r9
+  80138b:	00 00 00 
+  80138e:	41 ff d1             	call   *%r9
+
+0000000000801391 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801391:	55                   	push   %rbp
+  801392:	48 89 e5             	mov    %rsp,%rbp
+  801395:	53                   	push   %rbx
+  801396:	48 83 ec 08          	sub    $0x8,%rsp
+  80139a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80139d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a0:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013aa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013af:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ba:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013bc:	48 85 c0             	test   %rax,%rax
+  8013bf:	7f 06                	jg     8013c7 <sys_env_set_pgfault_upcall+0x36>
+}
+  8013c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c5:	c9                   	leave
+  8013c6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c7:	49 89 c0             	mov    %rax,%r8
+  8013ca:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013cf:	48 ba d0 30 80 00 00 	movabs $0x8030d0,%rdx
+  8013d6:	00 00 00 
+  8013d9:	be 26 00 00 00       	mov    $0x26,%esi
+  8013de:	48 bf ef 30 80 00 00 	movabs $0x8030ef,%rdi
+  8013e5:	00 00 00 
+  8013e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ed:	49 b9 31 29 80 00 00 	movabs $0x802931,%r9
+  8013f4:	00 00 00 
+  8013f7:	41 ff d1             	call   *%r9
+
+00000000008013fa <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013fa:	55                   	push   %rbp
+  8013fb:	48 89 e5             	mov    %rsp,%rbp
+  8013fe:	53                   	push   %rbx
+  8013ff:	89 f8                	mov    %edi,%eax
+  801401:	49 89 f1             	mov    %rsi,%r9
+  801404:	48 89 d3             	mov    %rdx,%rbx
+  801407:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80140a:	49 63 f0             	movslq %r8d,%rsi
+  80140d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801410:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801415:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801418:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80141e:	cd 30                	int    $0x30
+}
+  801420:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801424:	c9                   	leave
+  801425:	c3                   	ret
+
+0000000000801426 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801426:	55                   	push   %rbp
+  801427:	48 89 e5             	mov    %rsp,%rbp
+  80142a:	53                   	push   %rbx
+  80142b:	48 83 ec 08          	sub    $0x8,%rsp
+  80142f:	48 89 fa             	mov    %rdi,%rdx
+  801432:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801435:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80143a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801444:	be 00 00 00 00       	mov    $0x0,%esi
+  801449:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80144f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801451:	48 85 c0             	test   %rax,%rax
+  801454:	7f 06                	jg     80145c <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801456:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80145a:	c9                   	leave
+  80145b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80145c:	49 89 c0             	mov    %rax,%r8
+  80145f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801464:	48 ba d0 30 80 00 00 	movabs $0x8030d0,%rdx
+  80146b:	00 00 00 
+  80146e:	be 26 00 00 00       	mov    $0x26,%esi
+  801473:	48 bf ef 30 80 00 00 	movabs $0x8030ef,%rdi
+  80147a:	00 00 00 
+  80147d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801482:	49 b9 31 29 80 00 00 	movabs $0x802931,%r9
+  801489:	00 00 00 
+  80148c:	41 ff d1             	call   *%r9
+
+000000000080148f <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80148f:	55                   	push   %rbp
+  801490:	48 89 e5             	mov    %rsp,%rbp
+  801493:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801494:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801499:	ba 00 00 00 00       	mov    $0x0,%edx
+  80149e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b8:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014be:	c9                   	leave
+  8014bf:	c3                   	ret
+
+00000000008014c0 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8014c0:	55                   	push   %rbp
+  8014c1:	48 89 e5             	mov    %rsp,%rbp
+  8014c4:	53                   	push   %rbx
+  8014c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8014c9:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8014cc:	48 63 ce             	movslq %esi,%rcx
+  8014cf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014e9:	48 85 c0             	test   %rax,%rax
+  8014ec:	7f 06                	jg     8014f4 <sys_sigqueue+0x34>
+}
+  8014ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f2:	c9                   	leave
+  8014f3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014f4:	49 89 c0             	mov    %rax,%r8
+  8014f7:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8014fc:	48 ba d0 30 80 00 00 	movabs $0x8030d0,%rdx
+  801503:	00 00 00 
+  801506:	be 26 00 00 00       	mov    $0x26,%esi
+  80150b:	48 bf ef 30 80 00 00 	movabs $0x8030ef,%rdi
+  801512:	00 00 00 
+  801515:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151a:	49 b9 31 29 80 00 00 	movabs $0x802931,%r9
+  801521:	00 00 00 
+  801524:	41 ff d1             	call   *%r9
+
+0000000000801527 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801527:	55                   	push   %rbp
+  801528:	48 89 e5             	mov    %rsp,%rbp
+  80152b:	53                   	push   %rbx
+  80152c:	48 83 ec 08          	sub    $0x8,%rsp
+  801530:	48 89 fa             	mov    %rdi,%rdx
+  801533:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801536:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80153b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801540:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801545:	be 00 00 00 00       	mov    $0x0,%esi
+  80154a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801550:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801552:	48 85 c0             	test   %rax,%rax
+  801555:	7f 06                	jg     80155d <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801557:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80155b:	c9                   	leave
+  80155c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80155d:	49 89 c0             	mov    %rax,%r8
+  801560:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801565:	48 ba d0 30 80 00 00 	movabs $0x8030d0,%rdx
+  80156c:	00 00 00 
+  80156f:	be 26 00 00 00       	mov    $0x26,%esi
+  801574:	48 bf ef 30 80 00 00 	movabs $0x8030ef,%rdi
+  80157b:	00 00 00 
+  80157e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801583:	49 b9 31 29 80 00 00 	movabs $0x802931,%r9
+  80158a:	00 00 00 
+  80158d:	41 ff d1             	call   *%r9
+
+0000000000801590 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801590:	55                   	push   %rbp
+  801591:	48 89 e5             	mov    %rsp,%rbp
+  801594:	53                   	push   %rbx
+  801595:	48 83 ec 08          	sub    $0x8,%rsp
+  801599:	48 89 f1             	mov    %rsi,%rcx
+  80159c:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80159f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015a2:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015a7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015b9:	48 85 c0             	test   %rax,%rax
+  8015bc:	7f 06                	jg     8015c4 <sys_sigaction+0x34>
+}
+  8015be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c2:	c9                   	leave
+  8015c3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015c4:	49 89 c0             	mov    %rax,%r8
+  8015c7:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8015cc:	48 ba d0 30 80 00 00 	movabs $0x8030d0,%rdx
+  8015d3:	00 00 00 
+  8015d6:	be 26 00 00 00       	mov    $0x26,%esi
+  8015db:	48 bf ef 30 80 00 00 	movabs $0x8030ef,%rdi
+  8015e2:	00 00 00 
+  8015e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ea:	49 b9 31 29 80 00 00 	movabs $0x802931,%r9
+  8015f1:	00 00 00 
+  8015f4:	41 ff d1             	call   *%r9
+
+00000000008015f7 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8015f7:	55                   	push   %rbp
+  8015f8:	48 89 e5             	mov    %rsp,%rbp
+  8015fb:	53                   	push   %rbx
+  8015fc:	48 83 ec 08          	sub    $0x8,%rsp
+  801600:	48 89 f1             	mov    %rsi,%rcx
+  801603:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801606:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801609:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80160e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801613:	be 00 00 00 00       	mov    $0x0,%esi
+  801618:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80161e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801620:	48 85 c0             	test   %rax,%rax
+  801623:	7f 06                	jg     80162b <sys_sigprocmask+0x34>
+}
+  801625:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801629:	c9                   	leave
+  80162a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80162b:	49 89 c0             	mov    %rax,%r8
+  80162e:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801633:	48 ba d0 30 80 00 00 	movabs $0x8030d0,%rdx
+  80163a:	00 00 00 
+  80163d:	be 26 00 00 00       	mov    $0x26,%esi
+  801642:	48 bf ef 30 80 00 00 	movabs $0x8030ef,%rdi
+  801649:	00 00 00 
+  80164c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801651:	49 b9 31 29 80 00 00 	movabs $0x802931,%r9
+  801658:	00 00 00 
+  80165b:	41 ff d1             	call   *%r9
+
+000000000080165e <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80165e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801665:	ff ff ff 
+  801668:	48 01 f8             	add    %rdi,%rax
+  80166b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80166f:	c3                   	ret
+
+0000000000801670 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801670:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801677:	ff ff ff 
+  80167a:	48 01 f8             	add    %rdi,%rax
+  80167d:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801681:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801687:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80168b:	c3                   	ret
+
+000000000080168c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80168c:	55                   	push   %rbp
+  80168d:	48 89 e5             	mov    %rsp,%rbp
+  801690:	41 57                	push   %r15
+  801692:	41 56                	push   %r14
+  801694:	41 55                	push   %r13
+  801696:	41 54                	push   %r12
+  801698:	53                   	push   %rbx
+  801699:	48 83 ec 08          	sub    $0x8,%rsp
+  80169d:	49 89 ff             	mov    %rdi,%r15
+  8016a0:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8016a5:	49 bd 0a 26 80 00 00 	movabs $0x80260a,%r13
+  8016ac:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8016af:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8016b5:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8016b8:	48 89 df             	mov    %rbx,%rdi
+  8016bb:	41 ff d5             	call   *%r13
+  8016be:	83 e0 04             	and    $0x4,%eax
+  8016c1:	74 17                	je     8016da <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8016c3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8016ca:	4c 39 f3             	cmp    %r14,%rbx
+  8016cd:	75 e6                	jne    8016b5 <fd_alloc+0x29>
+  8016cf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8016d5:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8016da:	4d 89 27             	mov    %r12,(%r15)
+}
+  8016dd:	48 83 c4 08          	add    $0x8,%rsp
+  8016e1:	5b                   	pop    %rbx
+  8016e2:	41 5c                	pop    %r12
+  8016e4:	41 5d                	pop    %r13
+  8016e6:	41 5e                	pop    %r14
+  8016e8:	41 5f                	pop    %r15
+  8016ea:	5d                   	pop    %rbp
+  8016eb:	c3                   	ret
+
+00000000008016ec <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8016ec:	83 ff 1f             	cmp    $0x1f,%edi
+  8016ef:	77 39                	ja     80172a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8016f1:	55                   	push   %rbp
+  8016f2:	48 89 e5             	mov    %rsp,%rbp
+  8016f5:	41 54                	push   %r12
+  8016f7:	53                   	push   %rbx
+  8016f8:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8016fb:	48 63 df             	movslq %edi,%rbx
+  8016fe:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801705:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801709:	48 89 df             	mov    %rbx,%rdi
+  80170c:	48 b8 0a 26 80 00 00 	movabs $0x80260a,%rax
+  801713:	00 00 00 
+  801716:	ff d0                	call   *%rax
+  801718:	a8 04                	test   $0x4,%al
+  80171a:	74 14                	je     801730 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80171c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801720:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801725:	5b                   	pop    %rbx
+  801726:	41 5c                	pop    %r12
+  801728:	5d                   	pop    %rbp
+  801729:	c3                   	ret
+        return -E_INVAL;
+  80172a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80172f:	c3                   	ret
+        return -E_INVAL;
+  801730:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801735:	eb ee                	jmp    801725 <fd_lookup+0x39>
+
+0000000000801737 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801737:	55                   	push   %rbp
+  801738:	48 89 e5             	mov    %rsp,%rbp
+  80173b:	41 54                	push   %r12
+  80173d:	53                   	push   %rbx
+  80173e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801741:	48 b8 80 31 80 00 00 	movabs $0x803180,%rax
+  801748:	00 00 00 
+  80174b:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801752:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801755:	39 3b                	cmp    %edi,(%rbx)
+  801757:	74 47                	je     8017a0 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801759:	48 83 c0 08          	add    $0x8,%rax
+  80175d:	48 8b 18             	mov    (%rax),%rbx
+  801760:	48 85 db             	test   %rbx,%rbx
+  801763:	75 f0                	jne    801755 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801765:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80176c:	00 00 00 
+  80176f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801775:	89 fa                	mov    %edi,%edx
+  801777:	48 bf 00 31 80 00 00 	movabs $0x803100,%rdi
+  80177e:	00 00 00 
+  801781:	b8 00 00 00 00       	mov    $0x0,%eax
+  801786:	48 b9 e7 01 80 00 00 	movabs $0x8001e7,%rcx
+  80178d:	00 00 00 
+  801790:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801792:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801797:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80179b:	5b                   	pop    %rbx
+  80179c:	41 5c                	pop    %r12
+  80179e:	5d                   	pop    %rbp
+  80179f:	c3                   	ret
+            return 0;
+  8017a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a5:	eb f0                	jmp    801797 <dev_lookup+0x60>
+
+00000000008017a7 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8017a7:	55                   	push   %rbp
+  8017a8:	48 89 e5             	mov    %rsp,%rbp
+  8017ab:	41 55                	push   %r13
+  8017ad:	41 54                	push   %r12
+  8017af:	53                   	push   %rbx
+  8017b0:	48 83 ec 18          	sub    $0x18,%rsp
+  8017b4:	48 89 fb             	mov    %rdi,%rbx
+  8017b7:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017ba:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8017c1:	ff ff ff 
+  8017c4:	48 01 df             	add    %rbx,%rdi
+  8017c7:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8017cb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8017cf:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  8017d6:	00 00 00 
+  8017d9:	ff d0                	call   *%rax
+  8017db:	41 89 c5             	mov    %eax,%r13d
+  8017de:	85 c0                	test   %eax,%eax
+  8017e0:	78 06                	js     8017e8 <fd_close+0x41>
+  8017e2:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8017e6:	74 1a                	je     801802 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8017e8:	45 84 e4             	test   %r12b,%r12b
+  8017eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f0:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8017f4:	44 89 e8             	mov    %r13d,%eax
+  8017f7:	48 83 c4 18          	add    $0x18,%rsp
+  8017fb:	5b                   	pop    %rbx
+  8017fc:	41 5c                	pop    %r12
+  8017fe:	41 5d                	pop    %r13
+  801800:	5d                   	pop    %rbp
+  801801:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801802:	8b 3b                	mov    (%rbx),%edi
+  801804:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801808:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  80180f:	00 00 00 
+  801812:	ff d0                	call   *%rax
+  801814:	41 89 c5             	mov    %eax,%r13d
+  801817:	85 c0                	test   %eax,%eax
+  801819:	78 1b                	js     801836 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80181b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80181f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801823:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801829:	48 85 c0             	test   %rax,%rax
+  80182c:	74 08                	je     801836 <fd_close+0x8f>
+  80182e:	48 89 df             	mov    %rbx,%rdi
+  801831:	ff d0                	call   *%rax
+  801833:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801836:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80183b:	48 89 de             	mov    %rbx,%rsi
+  80183e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801843:	48 b8 88 11 80 00 00 	movabs $0x801188,%rax
+  80184a:	00 00 00 
+  80184d:	ff d0                	call   *%rax
+    return res;
+  80184f:	eb a3                	jmp    8017f4 <fd_close+0x4d>
+
+0000000000801851 <close>:
+
+int
+close(int fdnum) {
+  801851:	55                   	push   %rbp
+  801852:	48 89 e5             	mov    %rsp,%rbp
+  801855:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801859:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80185d:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  801864:	00 00 00 
+  801867:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801869:	85 c0                	test   %eax,%eax
+  80186b:	78 15                	js     801882 <close+0x31>
+
+    return fd_close(fd, 1);
+  80186d:	be 01 00 00 00       	mov    $0x1,%esi
+  801872:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801876:	48 b8 a7 17 80 00 00 	movabs $0x8017a7,%rax
+  80187d:	00 00 00 
+  801880:	ff d0                	call   *%rax
+}
+  801882:	c9                   	leave
+  801883:	c3                   	ret
+
+0000000000801884 <close_all>:
+
+void
+close_all(void) {
+  801884:	55                   	push   %rbp
+  801885:	48 89 e5             	mov    %rsp,%rbp
+  801888:	41 54                	push   %r12
+  80188a:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80188b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801890:	49 bc 51 18 80 00 00 	movabs $0x801851,%r12
+  801897:	00 00 00 
+  80189a:	89 df                	mov    %ebx,%edi
+  80189c:	41 ff d4             	call   *%r12
+  80189f:	83 c3 01             	add    $0x1,%ebx
+  8018a2:	83 fb 20             	cmp    $0x20,%ebx
+  8018a5:	75 f3                	jne    80189a <close_all+0x16>
+}
+  8018a7:	5b                   	pop    %rbx
+  8018a8:	41 5c                	pop    %r12
+  8018aa:	5d                   	pop    %rbp
+  8018ab:	c3                   	ret
+
+00000000008018ac <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8018ac:	55                   	push   %rbp
+  8018ad:	48 89 e5             	mov    %rsp,%rbp
+  8018b0:	41 57                	push   %r15
+  8018b2:	41 56                	push   %r14
+  8018b4:	41 55                	push   %r13
+  8018b6:	41 54                	push   %r12
+  8018b8:	53                   	push   %rbx
+  8018b9:	48 83 ec 18          	sub    $0x18,%rsp
+  8018bd:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8018c0:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8018c4:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  8018cb:	00 00 00 
+  8018ce:	ff d0                	call   *%rax
+  8018d0:	89 c3                	mov    %eax,%ebx
+  8018d2:	85 c0                	test   %eax,%eax
+  8018d4:	0f 88 b8 00 00 00    	js     801992 <dup+0xe6>
+    close(newfdnum);
+  8018da:	44 89 e7             	mov    %r12d,%edi
+  8018dd:	48 b8 51 18 80 00 00 	movabs $0x801851,%rax
+  8018e4:	00 00 00 
+  8018e7:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8018e9:	4d 63 ec             	movslq %r12d,%r13
+  8018ec:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8018f3:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8018f7:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8018fb:	4c 89 ff             	mov    %r15,%rdi
+  8018fe:	49 be 70 16 80 00 00 	movabs $0x801670,%r14
+  801905:	00 00 00 
+  801908:	41 ff d6             	call   *%r14
+  80190b:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80190e:	4c 89 ef             	mov    %r13,%rdi
+  801911:	41 ff d6             	call   *%r14
+  801914:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801917:	48 89 df             	mov    %rbx,%rdi
+  80191a:	48 b8 0a 26 80 00 00 	movabs $0x80260a,%rax
+  801921:	00 00 00 
+  801924:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801926:	a8 04                	test   $0x4,%al
+  801928:	74 2b                	je     801955 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80192a:	41 89 c1             	mov    %eax,%r9d
+  80192d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801933:	4c 89 f1             	mov    %r14,%rcx
+  801936:	ba 00 00 00 00       	mov    $0x0,%edx
+  80193b:	48 89 de             	mov    %rbx,%rsi
+  80193e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801943:	48 b8 23 11 80 00 00 	movabs $0x801123,%rax
+  80194a:	00 00 00 
+  80194d:	ff d0                	call   *%rax
+  80194f:	89 c3                	mov    %eax,%ebx
+  801951:	85 c0                	test   %eax,%eax
+  801953:	78 4e                	js     8019a3 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801955:	4c 89 ff             	mov    %r15,%rdi
+  801958:	48 b8 0a 26 80 00 00 	movabs $0x80260a,%rax
+  80195f:	00 00 00 
+  801962:	ff d0                	call   *%rax
+  801964:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801967:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80196d:	4c 89 e9             	mov    %r13,%rcx
+  801970:	ba 00 00 00 00       	mov    $0x0,%edx
+  801975:	4c 89 fe             	mov    %r15,%rsi
+  801978:	bf 00 00 00 00       	mov    $0x0,%edi
+  80197d:	48 b8 23 11 80 00 00 	movabs $0x801123,%rax
+  801984:	00 00 00 
+  801987:	ff d0                	call   *%rax
+  801989:	89 c3                	mov    %eax,%ebx
+  80198b:	85 c0                	test   %eax,%eax
+  80198d:	78 14                	js     8019a3 <dup+0xf7>
+
+    return newfdnum;
+  80198f:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801992:	89 d8                	mov    %ebx,%eax
+  801994:	48 83 c4 18          	add    $0x18,%rsp
+  801998:	5b                   	pop    %rbx
+  801999:	41 5c                	pop    %r12
+  80199b:	41 5d                	pop    %r13
+  80199d:	41 5e                	pop    %r14
+  80199f:	41 5f                	pop    %r15
+  8019a1:	5d                   	pop    %rbp
+  8019a2:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8019a3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019a8:	4c 89 ee             	mov    %r13,%rsi
+  8019ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019b0:	49 bc 88 11 80 00 00 	movabs $0x801188,%r12
+  8019b7:	00 00 00 
+  8019ba:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8019bd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019c2:	4c 89 f6             	mov    %r14,%rsi
+  8019c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019ca:	41 ff d4             	call   *%r12
+    return res;
+  8019cd:	eb c3                	jmp    801992 <dup+0xe6>
+
+00000000008019cf <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8019cf:	55                   	push   %rbp
+  8019d0:	48 89 e5             	mov    %rsp,%rbp
+  8019d3:	41 56                	push   %r14
+  8019d5:	41 55                	push   %r13
+  8019d7:	41 54                	push   %r12
+  8019d9:	53                   	push   %rbx
+  8019da:	48 83 ec 10          	sub    $0x10,%rsp
+  8019de:	89 fb                	mov    %edi,%ebx
+  8019e0:	49 89 f4             	mov    %rsi,%r12
+  8019e3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019e6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019ea:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  8019f1:	00 00 00 
+  8019f4:	ff d0                	call   *%rax
+  8019f6:	85 c0                	test   %eax,%eax
+  8019f8:	78 4c                	js     801a46 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019fa:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019fe:	41 8b 3e             	mov    (%r14),%edi
+  801a01:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a05:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  801a0c:	00 00 00 
+  801a0f:	ff d0                	call   *%rax
+  801a11:	85 c0                	test   %eax,%eax
+  801a13:	78 35                	js     801a4a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a15:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a19:	83 e0 03             	and    $0x3,%eax
+  801a1c:	83 f8 01             	cmp    $0x1,%eax
+  801a1f:	74 2d                	je     801a4e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a21:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a25:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801a29:	48 85 c0             	test   %rax,%rax
+  801a2c:	74 56                	je     801a84 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801a2e:	4c 89 ea             	mov    %r13,%rdx
+  801a31:	4c 89 e6             	mov    %r12,%rsi
+  801a34:	4c 89 f7             	mov    %r14,%rdi
+  801a37:	ff d0                	call   *%rax
+}
+  801a39:	48 83 c4 10          	add    $0x10,%rsp
+  801a3d:	5b                   	pop    %rbx
+  801a3e:	41 5c                	pop    %r12
+  801a40:	41 5d                	pop    %r13
+  801a42:	41 5e                	pop    %r14
+  801a44:	5d                   	pop    %rbp
+  801a45:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a46:	48 98                	cltq
+  801a48:	eb ef                	jmp    801a39 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a4a:	48 98                	cltq
+  801a4c:	eb eb                	jmp    801a39 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a4e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a55:	00 00 00 
+  801a58:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a5e:	89 da                	mov    %ebx,%edx
+  801a60:	48 bf 41 31 80 00 00 	movabs $0x803141,%rdi
+  801a67:	00 00 00 
+  801a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6f:	48 b9 e7 01 80 00 00 	movabs $0x8001e7,%rcx
+  801a76:	00 00 00 
+  801a79:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a7b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a82:	eb b5                	jmp    801a39 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a84:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a8b:	eb ac                	jmp    801a39 <read+0x6a>
+
+0000000000801a8d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a8d:	55                   	push   %rbp
+  801a8e:	48 89 e5             	mov    %rsp,%rbp
+  801a91:	41 57                	push   %r15
+  801a93:	41 56                	push   %r14
+  801a95:	41 55                	push   %r13
+  801a97:	41 54                	push   %r12
+  801a99:	53                   	push   %rbx
+  801a9a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a9e:	48 85 d2             	test   %rdx,%rdx
+  801aa1:	74 54                	je     801af7 <readn+0x6a>
+  801aa3:	41 89 fd             	mov    %edi,%r13d
+  801aa6:	49 89 f6             	mov    %rsi,%r14
+  801aa9:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801aac:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801ab1:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ab6:	49 bf cf 19 80 00 00 	movabs $0x8019cf,%r15
+  801abd:	00 00 00 
+  801ac0:	4c 89 e2             	mov    %r12,%rdx
+  801ac3:	48 29 f2             	sub    %rsi,%rdx
+  801ac6:	4c 01 f6             	add    %r14,%rsi
+  801ac9:	44 89 ef             	mov    %r13d,%edi
+  801acc:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801acf:	85 c0                	test   %eax,%eax
+  801ad1:	78 20                	js     801af3 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ad3:	01 c3                	add    %eax,%ebx
+  801ad5:	85 c0                	test   %eax,%eax
+  801ad7:	74 08                	je     801ae1 <readn+0x54>
+  801ad9:	48 63 f3             	movslq %ebx,%rsi
+  801adc:	4c 39 e6             	cmp    %r12,%rsi
+  801adf:	72 df                	jb     801ac0 <readn+0x33>
+    }
+    return res;
+  801ae1:	48 63 c3             	movslq %ebx,%rax
+}
+  801ae4:	48 83 c4 08          	add    $0x8,%rsp
+  801ae8:	5b                   	pop    %rbx
+  801ae9:	41 5c                	pop    %r12
+  801aeb:	41 5d                	pop    %r13
+  801aed:	41 5e                	pop    %r14
+  801aef:	41 5f                	pop    %r15
+  801af1:	5d                   	pop    %rbp
+  801af2:	c3                   	ret
+        if (inc < 0) return inc;
+  801af3:	48 98                	cltq
+  801af5:	eb ed                	jmp    801ae4 <readn+0x57>
+    int inc = 1, res = 0;
+  801af7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801afc:	eb e3                	jmp    801ae1 <readn+0x54>
+
+0000000000801afe <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801afe:	55                   	push   %rbp
+  801aff:	48 89 e5             	mov    %rsp,%rbp
+  801b02:	41 56                	push   %r14
+  801b04:	41 55                	push   %r13
+  801b06:	41 54                	push   %r12
+  801b08:	53                   	push   %rbx
+  801b09:	48 83 ec 10          	sub    $0x10,%rsp
+  801b0d:	89 fb                	mov    %edi,%ebx
+  801b0f:	49 89 f4             	mov    %rsi,%r12
+  801b12:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b15:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b19:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  801b20:	00 00 00 
+  801b23:	ff d0                	call   *%rax
+  801b25:	85 c0                	test   %eax,%eax
+  801b27:	78 47                	js     801b70 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b29:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b2d:	41 8b 3e             	mov    (%r14),%edi
+  801b30:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b34:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  801b3b:	00 00 00 
+  801b3e:	ff d0                	call   *%rax
+  801b40:	85 c0                	test   %eax,%eax
+  801b42:	78 30                	js     801b74 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b44:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b49:	74 2d                	je     801b78 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b4b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b4f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b53:	48 85 c0             	test   %rax,%rax
+  801b56:	74 56                	je     801bae <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b58:	4c 89 ea             	mov    %r13,%rdx
+  801b5b:	4c 89 e6             	mov    %r12,%rsi
+  801b5e:	4c 89 f7             	mov    %r14,%rdi
+  801b61:	ff d0                	call   *%rax
+}
+  801b63:	48 83 c4 10          	add    $0x10,%rsp
+  801b67:	5b                   	pop    %rbx
+  801b68:	41 5c                	pop    %r12
+  801b6a:	41 5d                	pop    %r13
+  801b6c:	41 5e                	pop    %r14
+  801b6e:	5d                   	pop    %rbp
+  801b6f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b70:	48 98                	cltq
+  801b72:	eb ef                	jmp    801b63 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b74:	48 98                	cltq
+  801b76:	eb eb                	jmp    801b63 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b78:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b7f:	00 00 00 
+  801b82:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b88:	89 da                	mov    %ebx,%edx
+  801b8a:	48 bf 5d 31 80 00 00 	movabs $0x80315d,%rdi
+  801b91:	00 00 00 
+  801b94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b99:	48 b9 e7 01 80 00 00 	movabs $0x8001e7,%rcx
+  801ba0:	00 00 00 
+  801ba3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ba5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801bac:	eb b5                	jmp    801b63 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801bae:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801bb5:	eb ac                	jmp    801b63 <write+0x65>
+
+0000000000801bb7 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801bb7:	55                   	push   %rbp
+  801bb8:	48 89 e5             	mov    %rsp,%rbp
+  801bbb:	53                   	push   %rbx
+  801bbc:	48 83 ec 18          	sub    $0x18,%rsp
+  801bc0:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bc2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801bc6:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  801bcd:	00 00 00 
+  801bd0:	ff d0                	call   *%rax
+  801bd2:	85 c0                	test   %eax,%eax
+  801bd4:	78 0c                	js     801be2 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801bd6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bda:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801be2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801be6:	c9                   	leave
+  801be7:	c3                   	ret
+
+0000000000801be8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801be8:	55                   	push   %rbp
+  801be9:	48 89 e5             	mov    %rsp,%rbp
+  801bec:	41 55                	push   %r13
+  801bee:	41 54                	push   %r12
+  801bf0:	53                   	push   %rbx
+  801bf1:	48 83 ec 18          	sub    $0x18,%rsp
+  801bf5:	89 fb                	mov    %edi,%ebx
+  801bf7:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bfa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bfe:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  801c05:	00 00 00 
+  801c08:	ff d0                	call   *%rax
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	78 38                	js     801c46 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c0e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801c12:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c16:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c1a:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  801c21:	00 00 00 
+  801c24:	ff d0                	call   *%rax
+  801c26:	85 c0                	test   %eax,%eax
+  801c28:	78 1c                	js     801c46 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c2a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c2f:	74 20                	je     801c51 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c31:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c35:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801c39:	48 85 c0             	test   %rax,%rax
+  801c3c:	74 47                	je     801c85 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c3e:	44 89 e6             	mov    %r12d,%esi
+  801c41:	4c 89 ef             	mov    %r13,%rdi
+  801c44:	ff d0                	call   *%rax
+}
+  801c46:	48 83 c4 18          	add    $0x18,%rsp
+  801c4a:	5b                   	pop    %rbx
+  801c4b:	41 5c                	pop    %r12
+  801c4d:	41 5d                	pop    %r13
+  801c4f:	5d                   	pop    %rbp
+  801c50:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c51:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c58:	00 00 00 
+  801c5b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c61:	89 da                	mov    %ebx,%edx
+  801c63:	48 bf 20 31 80 00 00 	movabs $0x803120,%rdi
+  801c6a:	00 00 00 
+  801c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c72:	48 b9 e7 01 80 00 00 	movabs $0x8001e7,%rcx
+  801c79:	00 00 00 
+  801c7c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c83:	eb c1                	jmp    801c46 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c85:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c8a:	eb ba                	jmp    801c46 <ftruncate+0x5e>
+
+0000000000801c8c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801c8c:	55                   	push   %rbp
+  801c8d:	48 89 e5             	mov    %rsp,%rbp
+  801c90:	41 54                	push   %r12
+  801c92:	53                   	push   %rbx
+  801c93:	48 83 ec 10          	sub    $0x10,%rsp
+  801c97:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c9a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c9e:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  801ca5:	00 00 00 
+  801ca8:	ff d0                	call   *%rax
+  801caa:	85 c0                	test   %eax,%eax
+  801cac:	78 4e                	js     801cfc <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cae:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801cb2:	41 8b 3c 24          	mov    (%r12),%edi
+  801cb6:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801cba:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  801cc1:	00 00 00 
+  801cc4:	ff d0                	call   *%rax
+  801cc6:	85 c0                	test   %eax,%eax
+  801cc8:	78 32                	js     801cfc <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801cca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801cce:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801cd3:	74 30                	je     801d05 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801cd5:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801cd8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801cdf:	00 00 00 
+    stat->st_isdir = 0;
+  801ce2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ce9:	00 00 00 
+    stat->st_dev = dev;
+  801cec:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801cf3:	48 89 de             	mov    %rbx,%rsi
+  801cf6:	4c 89 e7             	mov    %r12,%rdi
+  801cf9:	ff 50 28             	call   *0x28(%rax)
+}
+  801cfc:	48 83 c4 10          	add    $0x10,%rsp
+  801d00:	5b                   	pop    %rbx
+  801d01:	41 5c                	pop    %r12
+  801d03:	5d                   	pop    %rbp
+  801d04:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d05:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d0a:	eb f0                	jmp    801cfc <fstat+0x70>
+
+0000000000801d0c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801d0c:	55                   	push   %rbp
+  801d0d:	48 89 e5             	mov    %rsp,%rbp
+  801d10:	41 54                	push   %r12
+  801d12:	53                   	push   %rbx
+  801d13:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d16:	be 00 00 00 00       	mov    $0x0,%esi
+  801d1b:	48 b8 8d 1f 80 00 00 	movabs $0x801f8d,%rax
+  801d22:	00 00 00 
+  801d25:	ff d0                	call   *%rax
+  801d27:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d29:	85 c0                	test   %eax,%eax
+  801d2b:	78 25                	js     801d52 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d2d:	4c 89 e6             	mov    %r12,%rsi
+  801d30:	89 c7                	mov    %eax,%edi
+  801d32:	48 b8 8c 1c 80 00 00 	movabs $0x801c8c,%rax
+  801d39:	00 00 00 
+  801d3c:	ff d0                	call   *%rax
+  801d3e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d41:	89 df                	mov    %ebx,%edi
+  801d43:	48 b8 51 18 80 00 00 	movabs $0x801851,%rax
+  801d4a:	00 00 00 
+  801d4d:	ff d0                	call   *%rax
+
+    return res;
+  801d4f:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d52:	89 d8                	mov    %ebx,%eax
+  801d54:	5b                   	pop    %rbx
+  801d55:	41 5c                	pop    %r12
+  801d57:	5d                   	pop    %rbp
+  801d58:	c3                   	ret
+
+0000000000801d59 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801d59:	55                   	push   %rbp
+  801d5a:	48 89 e5             	mov    %rsp,%rbp
+  801d5d:	41 54                	push   %r12
+  801d5f:	53                   	push   %rbx
+  801d60:	48 83 ec 10          	sub    $0x10,%rsp
+  801d64:	41 89 fc             	mov    %edi,%r12d
+  801d67:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d6a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801d71:	00 00 00 
+  801d74:	83 38 00             	cmpl   $0x0,(%rax)
+  801d77:	74 5e                	je     801dd7 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801d79:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801d7f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d84:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801d8b:	00 00 00 
+  801d8e:	44 89 e6             	mov    %r12d,%esi
+  801d91:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801d98:	00 00 00 
+  801d9b:	8b 38                	mov    (%rax),%edi
+  801d9d:	48 b8 69 2a 80 00 00 	movabs $0x802a69,%rax
+  801da4:	00 00 00 
+  801da7:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801da9:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801db0:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801db1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801db6:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801dba:	48 89 de             	mov    %rbx,%rsi
+  801dbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dc2:	48 b8 d4 29 80 00 00 	movabs $0x8029d4,%rax
+  801dc9:	00 00 00 
+  801dcc:	ff d0                	call   *%rax
+}
+  801dce:	48 83 c4 10          	add    $0x10,%rsp
+  801dd2:	5b                   	pop    %rbx
+  801dd3:	41 5c                	pop    %r12
+  801dd5:	5d                   	pop    %rbp
+  801dd6:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801dd7:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ddc:	48 b8 09 2b 80 00 00 	movabs $0x802b09,%rax
+  801de3:	00 00 00 
+  801de6:	ff d0                	call   *%rax
+  801de8:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801def:	00 00 
+  801df1:	eb 86                	jmp    801d79 <fsipc+0x20>
+
+0000000000801df3 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801df3:	55                   	push   %rbp
+  801df4:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801df7:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801dfe:	00 00 00 
+  801e01:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801e04:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801e06:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801e09:	be 00 00 00 00       	mov    $0x0,%esi
+  801e0e:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e13:	48 b8 59 1d 80 00 00 	movabs $0x801d59,%rax
+  801e1a:	00 00 00 
+  801e1d:	ff d0                	call   *%rax
+}
+  801e1f:	5d                   	pop    %rbp
+  801e20:	c3                   	ret
+
+0000000000801e21 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801e21:	55                   	push   %rbp
+  801e22:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e25:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801e28:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801e2f:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801e31:	be 00 00 00 00       	mov    $0x0,%esi
+  801e36:	bf 06 00 00 00       	mov    $0x6,%edi
+  801e3b:	48 b8 59 1d 80 00 00 	movabs $0x801d59,%rax
+  801e42:	00 00 00 
+  801e45:	ff d0                	call   *%rax
+}
+  801e47:	5d                   	pop    %rbp
+  801e48:	c3                   	ret
+
+0000000000801e49 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801e49:	55                   	push   %rbp
+  801e4a:	48 89 e5             	mov    %rsp,%rbp
+  801e4d:	41 54                	push   %r12
+  801e4f:	53                   	push   %rbx
+  801e50:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e53:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801e56:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801e5d:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801e5f:	be 00 00 00 00       	mov    $0x0,%esi
+  801e64:	bf 05 00 00 00       	mov    $0x5,%edi
+  801e69:	48 b8 59 1d 80 00 00 	movabs $0x801d59,%rax
+  801e70:	00 00 00 
+  801e73:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e75:	85 c0                	test   %eax,%eax
+  801e77:	78 3d                	js     801eb6 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e79:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801e80:	00 00 00 
+  801e83:	4c 89 e6             	mov    %r12,%rsi
+  801e86:	48 89 df             	mov    %rbx,%rdi
+  801e89:	48 b8 0c 0b 80 00 00 	movabs $0x800b0c,%rax
+  801e90:	00 00 00 
+  801e93:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801e95:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801e9c:	00 
+  801e9d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ea3:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801eaa:	00 
+  801eab:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eb6:	5b                   	pop    %rbx
+  801eb7:	41 5c                	pop    %r12
+  801eb9:	5d                   	pop    %rbp
+  801eba:	c3                   	ret
+
+0000000000801ebb <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801ebb:	55                   	push   %rbp
+  801ebc:	48 89 e5             	mov    %rsp,%rbp
+  801ebf:	41 54                	push   %r12
+  801ec1:	53                   	push   %rbx
+  801ec2:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  801ec5:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  801eca:	48 39 c2             	cmp    %rax,%rdx
+  801ecd:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801ed1:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801ed4:	48 89 c2             	mov    %rax,%rdx
+  801ed7:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801ede:	00 00 00 
+  801ee1:	48 b8 6d 0d 80 00 00 	movabs $0x800d6d,%rax
+  801ee8:	00 00 00 
+  801eeb:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801eed:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801ef4:	00 00 00 
+  801ef7:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  801efc:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  801efe:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  801f02:	be 00 00 00 00       	mov    $0x0,%esi
+  801f07:	bf 04 00 00 00       	mov    $0x4,%edi
+  801f0c:	48 b8 59 1d 80 00 00 	movabs $0x801d59,%rax
+  801f13:	00 00 00 
+  801f16:	ff d0                	call   *%rax
+  801f18:	48 98                	cltq
+}
+  801f1a:	5b                   	pop    %rbx
+  801f1b:	41 5c                	pop    %r12
+  801f1d:	5d                   	pop    %rbp
+  801f1e:	c3                   	ret
+
+0000000000801f1f <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801f1f:	55                   	push   %rbp
+  801f20:	48 89 e5             	mov    %rsp,%rbp
+  801f23:	41 54                	push   %r12
+  801f25:	53                   	push   %rbx
+  801f26:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f29:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801f30:	00 00 00 
+  801f33:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801f36:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  801f38:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801f3d:	48 39 ca             	cmp    %rcx,%rdx
+  801f40:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  801f44:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  801f48:	be 00 00 00 00       	mov    $0x0,%esi
+  801f4d:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f52:	48 b8 59 1d 80 00 00 	movabs $0x801d59,%rax
+  801f59:	00 00 00 
+  801f5c:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  801f5e:	85 c0                	test   %eax,%eax
+  801f60:	78 27                	js     801f89 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  801f62:	48 63 d8             	movslq %eax,%rbx
+  801f65:	48 89 da             	mov    %rbx,%rdx
+  801f68:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801f6f:	00 00 00 
+  801f72:	4c 89 e7             	mov    %r12,%rdi
+  801f75:	48 b8 6d 0d 80 00 00 	movabs $0x800d6d,%rax
+  801f7c:	00 00 00 
+  801f7f:	ff d0                	call   *%rax
+    return bytes_read;
+  801f81:	48 89 d8             	mov    %rbx,%rax
+}
+  801f84:	5b                   	pop    %rbx
+  801f85:	41 5c                	pop    %r12
+  801f87:	5d                   	pop    %rbp
+  801f88:	c3                   	ret
+        return bytes_read;
+  801f89:	48 98                	cltq
+  801f8b:	eb f7                	jmp    801f84 <devfile_read+0x65>
+
+0000000000801f8d <open>:
+open(const char *path, int mode) {
+  801f8d:	55                   	push   %rbp
+  801f8e:	48 89 e5             	mov    %rsp,%rbp
+  801f91:	41 55                	push   %r13
+  801f93:	41 54                	push   %r12
+  801f95:	53                   	push   %rbx
+  801f96:	48 83 ec 18          	sub    $0x18,%rsp
+  801f9a:	49 89 fc             	mov    %rdi,%r12
+  801f9d:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801fa0:	48 b8 ce 0a 80 00 00 	movabs $0x800ace,%rax
+  801fa7:	00 00 00 
+  801faa:	ff d0                	call   *%rax
+  801fac:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801fb2:	0f 87 8a 00 00 00    	ja     802042 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801fb8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801fbc:	48 b8 8c 16 80 00 00 	movabs $0x80168c,%rax
+  801fc3:	00 00 00 
+  801fc6:	ff d0                	call   *%rax
+  801fc8:	89 c3                	mov    %eax,%ebx
+  801fca:	85 c0                	test   %eax,%eax
+  801fcc:	78 50                	js     80201e <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801fce:	4c 89 e6             	mov    %r12,%rsi
+  801fd1:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801fd8:	00 00 00 
+  801fdb:	48 89 df             	mov    %rbx,%rdi
+  801fde:	48 b8 0c 0b 80 00 00 	movabs $0x800b0c,%rax
+  801fe5:	00 00 00 
+  801fe8:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801fea:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ff1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801ff5:	bf 01 00 00 00       	mov    $0x1,%edi
+  801ffa:	48 b8 59 1d 80 00 00 	movabs $0x801d59,%rax
+  802001:	00 00 00 
+  802004:	ff d0                	call   *%rax
+  802006:	89 c3                	mov    %eax,%ebx
+  802008:	85 c0                	test   %eax,%eax
+  80200a:	78 1f                	js     80202b <open+0x9e>
+    return fd2num(fd);
+  80200c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802010:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  802017:	00 00 00 
+  80201a:	ff d0                	call   *%rax
+  80201c:	89 c3                	mov    %eax,%ebx
+}
+  80201e:	89 d8                	mov    %ebx,%eax
+  802020:	48 83 c4 18          	add    $0x18,%rsp
+  802024:	5b                   	pop    %rbx
+  802025:	41 5c                	pop    %r12
+  802027:	41 5d                	pop    %r13
+  802029:	5d                   	pop    %rbp
+  80202a:	c3                   	ret
+        fd_close(fd, 0);
+  80202b:	be 00 00 00 00       	mov    $0x0,%esi
+  802030:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802034:	48 b8 a7 17 80 00 00 	movabs $0x8017a7,%rax
+  80203b:	00 00 00 
+  80203e:	ff d0                	call   *%rax
+        return res;
+  802040:	eb dc                	jmp    80201e <open+0x91>
+        return -E_BAD_PATH;
+  802042:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802047:	eb d5                	jmp    80201e <open+0x91>
+
+0000000000802049 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802049:	55                   	push   %rbp
+  80204a:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80204d:	be 00 00 00 00       	mov    $0x0,%esi
+  802052:	bf 08 00 00 00       	mov    $0x8,%edi
+  802057:	48 b8 59 1d 80 00 00 	movabs $0x801d59,%rax
+  80205e:	00 00 00 
+  802061:	ff d0                	call   *%rax
+}
+  802063:	5d                   	pop    %rbp
+  802064:	c3                   	ret
+
+0000000000802065 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802065:	55                   	push   %rbp
+  802066:	48 89 e5             	mov    %rsp,%rbp
+  802069:	41 54                	push   %r12
+  80206b:	53                   	push   %rbx
+  80206c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80206f:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  802076:	00 00 00 
+  802079:	ff d0                	call   *%rax
+  80207b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80207e:	48 be a0 31 80 00 00 	movabs $0x8031a0,%rsi
+  802085:	00 00 00 
+  802088:	48 89 df             	mov    %rbx,%rdi
+  80208b:	48 b8 0c 0b 80 00 00 	movabs $0x800b0c,%rax
+  802092:	00 00 00 
+  802095:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802097:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80209c:	41 2b 04 24          	sub    (%r12),%eax
+  8020a0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8020a6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020ad:	00 00 00 
+    stat->st_dev = &devpipe;
+  8020b0:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8020b7:	00 00 00 
+  8020ba:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8020c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c6:	5b                   	pop    %rbx
+  8020c7:	41 5c                	pop    %r12
+  8020c9:	5d                   	pop    %rbp
+  8020ca:	c3                   	ret
+
+00000000008020cb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8020cb:	55                   	push   %rbp
+  8020cc:	48 89 e5             	mov    %rsp,%rbp
+  8020cf:	41 54                	push   %r12
+  8020d1:	53                   	push   %rbx
+  8020d2:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8020d5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020da:	48 89 fe             	mov    %rdi,%rsi
+  8020dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020e2:	49 bc 88 11 80 00 00 	movabs $0x801188,%r12
+  8020e9:	00 00 00 
+  8020ec:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8020ef:	48 89 df             	mov    %rbx,%rdi
+  8020f2:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  8020f9:	00 00 00 
+  8020fc:	ff d0                	call   *%rax
+  8020fe:	48 89 c6             	mov    %rax,%rsi
+  802101:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802106:	bf 00 00 00 00       	mov    $0x0,%edi
+  80210b:	41 ff d4             	call   *%r12
+}
+  80210e:	5b                   	pop    %rbx
+  80210f:	41 5c                	pop    %r12
+  802111:	5d                   	pop    %rbp
+  802112:	c3                   	ret
+
+0000000000802113 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802113:	55                   	push   %rbp
+  802114:	48 89 e5             	mov    %rsp,%rbp
+  802117:	41 57                	push   %r15
+  802119:	41 56                	push   %r14
+  80211b:	41 55                	push   %r13
+  80211d:	41 54                	push   %r12
+  80211f:	53                   	push   %rbx
+  802120:	48 83 ec 18          	sub    $0x18,%rsp
+  802124:	49 89 fc             	mov    %rdi,%r12
+  802127:	49 89 f5             	mov    %rsi,%r13
+  80212a:	49 89 d7             	mov    %rdx,%r15
+  80212d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802131:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  802138:	00 00 00 
+  80213b:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80213d:	4d 85 ff             	test   %r15,%r15
+  802140:	0f 84 af 00 00 00    	je     8021f5 <devpipe_write+0xe2>
+  802146:	48 89 c3             	mov    %rax,%rbx
+  802149:	4c 89 f8             	mov    %r15,%rax
+  80214c:	4d 89 ef             	mov    %r13,%r15
+  80214f:	4c 01 e8             	add    %r13,%rax
+  802152:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802156:	49 bd 90 10 80 00 00 	movabs $0x801090,%r13
+  80215d:	00 00 00 
+            sys_yield();
+  802160:	49 be 2d 10 80 00 00 	movabs $0x80102d,%r14
+  802167:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80216a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80216d:	48 63 ce             	movslq %esi,%rcx
+  802170:	48 63 03             	movslq (%rbx),%rax
+  802173:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802179:	48 39 c1             	cmp    %rax,%rcx
+  80217c:	72 2e                	jb     8021ac <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80217e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802183:	48 89 da             	mov    %rbx,%rdx
+  802186:	be 00 10 00 00       	mov    $0x1000,%esi
+  80218b:	4c 89 e7             	mov    %r12,%rdi
+  80218e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802191:	85 c0                	test   %eax,%eax
+  802193:	74 66                	je     8021fb <devpipe_write+0xe8>
+            sys_yield();
+  802195:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802198:	8b 73 04             	mov    0x4(%rbx),%esi
+  80219b:	48 63 ce             	movslq %esi,%rcx
+  80219e:	48 63 03             	movslq (%rbx),%rax
+  8021a1:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8021a7:	48 39 c1             	cmp    %rax,%rcx
+  8021aa:	73 d2                	jae    80217e <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021ac:	41 0f b6 3f          	movzbl (%r15),%edi
+  8021b0:	48 89 ca             	mov    %rcx,%rdx
+  8021b3:	48 c1 ea 03          	shr    $0x3,%rdx
+  8021b7:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8021be:	08 10 20 
+  8021c1:	48 f7 e2             	mul    %rdx
+  8021c4:	48 c1 ea 06          	shr    $0x6,%rdx
+  8021c8:	48 89 d0             	mov    %rdx,%rax
+  8021cb:	48 c1 e0 09          	shl    $0x9,%rax
+  8021cf:	48 29 d0             	sub    %rdx,%rax
+  8021d2:	48 c1 e0 03          	shl    $0x3,%rax
+  8021d6:	48 29 c1             	sub    %rax,%rcx
+  8021d9:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8021de:	83 c6 01             	add    $0x1,%esi
+  8021e1:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8021e4:	49 83 c7 01          	add    $0x1,%r15
+  8021e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021ec:	49 39 c7             	cmp    %rax,%r15
+  8021ef:	0f 85 75 ff ff ff    	jne    80216a <devpipe_write+0x57>
+    return n;
+  8021f5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021f9:	eb 05                	jmp    802200 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8021fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802200:	48 83 c4 18          	add    $0x18,%rsp
+  802204:	5b                   	pop    %rbx
+  802205:	41 5c                	pop    %r12
+  802207:	41 5d                	pop    %r13
+  802209:	41 5e                	pop    %r14
+  80220b:	41 5f                	pop    %r15
+  80220d:	5d                   	pop    %rbp
+  80220e:	c3                   	ret
+
+000000000080220f <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80220f:	55                   	push   %rbp
+  802210:	48 89 e5             	mov    %rsp,%rbp
+  802213:	41 57                	push   %r15
+  802215:	41 56                	push   %r14
+  802217:	41 55                	push   %r13
+  802219:	41 54                	push   %r12
+  80221b:	53                   	push   %rbx
+  80221c:	48 83 ec 18          	sub    $0x18,%rsp
+  802220:	49 89 fc             	mov    %rdi,%r12
+  802223:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802227:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80222b:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  802232:	00 00 00 
+  802235:	ff d0                	call   *%rax
+  802237:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80223a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802240:	49 bd 90 10 80 00 00 	movabs $0x801090,%r13
+  802247:	00 00 00 
+            sys_yield();
+  80224a:	49 be 2d 10 80 00 00 	movabs $0x80102d,%r14
+  802251:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802254:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802259:	74 7d                	je     8022d8 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80225b:	8b 03                	mov    (%rbx),%eax
+  80225d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802260:	75 26                	jne    802288 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802262:	4d 85 ff             	test   %r15,%r15
+  802265:	75 77                	jne    8022de <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802267:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80226c:	48 89 da             	mov    %rbx,%rdx
+  80226f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802274:	4c 89 e7             	mov    %r12,%rdi
+  802277:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80227a:	85 c0                	test   %eax,%eax
+  80227c:	74 72                	je     8022f0 <devpipe_read+0xe1>
+            sys_yield();
+  80227e:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802281:	8b 03                	mov    (%rbx),%eax
+  802283:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802286:	74 df                	je     802267 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802288:	48 63 c8             	movslq %eax,%rcx
+  80228b:	48 89 ca             	mov    %rcx,%rdx
+  80228e:	48 c1 ea 03          	shr    $0x3,%rdx
+  802292:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802299:	08 10 20 
+  80229c:	48 89 d0             	mov    %rdx,%rax
+  80229f:	48 f7 e6             	mul    %rsi
+  8022a2:	48 c1 ea 06          	shr    $0x6,%rdx
+  8022a6:	48 89 d0             	mov    %rdx,%rax
+  8022a9:	48 c1 e0 09          	shl    $0x9,%rax
+  8022ad:	48 29 d0             	sub    %rdx,%rax
+  8022b0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8022b7:	00 
+  8022b8:	48 89 c8             	mov    %rcx,%rax
+  8022bb:	48 29 d0             	sub    %rdx,%rax
+  8022be:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8022c3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8022c7:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8022cb:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8022ce:	49 83 c7 01          	add    $0x1,%r15
+  8022d2:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8022d6:	75 83                	jne    80225b <devpipe_read+0x4c>
+    return n;
+  8022d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022dc:	eb 03                	jmp    8022e1 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8022de:	4c 89 f8             	mov    %r15,%rax
+}
+  8022e1:	48 83 c4 18          	add    $0x18,%rsp
+  8022e5:	5b                   	pop    %rbx
+  8022e6:	41 5c                	pop    %r12
+  8022e8:	41 5d                	pop    %r13
+  8022ea:	41 5e                	pop    %r14
+  8022ec:	41 5f                	pop    %r15
+  8022ee:	5d                   	pop    %rbp
+  8022ef:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8022f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f5:	eb ea                	jmp    8022e1 <devpipe_read+0xd2>
+
+00000000008022f7 <pipe>:
+pipe(int pfd[2]) {
+  8022f7:	55                   	push   %rbp
+  8022f8:	48 89 e5             	mov    %rsp,%rbp
+  8022fb:	41 55                	push   %r13
+  8022fd:	41 54                	push   %r12
+  8022ff:	53                   	push   %rbx
+  802300:	48 83 ec 18          	sub    $0x18,%rsp
+  802304:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802307:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80230b:	48 b8 8c 16 80 00 00 	movabs $0x80168c,%rax
+  802312:	00 00 00 
+  802315:	ff d0                	call   *%rax
+  802317:	89 c3                	mov    %eax,%ebx
+  802319:	85 c0                	test   %eax,%eax
+  80231b:	0f 88 a0 01 00 00    	js     8024c1 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802321:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802326:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80232b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80232f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802334:	48 b8 bc 10 80 00 00 	movabs $0x8010bc,%rax
+  80233b:	00 00 00 
+  80233e:	ff d0                	call   *%rax
+  802340:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802342:	85 c0                	test   %eax,%eax
+  802344:	0f 88 77 01 00 00    	js     8024c1 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80234a:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80234e:	48 b8 8c 16 80 00 00 	movabs $0x80168c,%rax
+  802355:	00 00 00 
+  802358:	ff d0                	call   *%rax
+  80235a:	89 c3                	mov    %eax,%ebx
+  80235c:	85 c0                	test   %eax,%eax
+  80235e:	0f 88 43 01 00 00    	js     8024a7 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802364:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802369:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80236e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802372:	bf 00 00 00 00       	mov    $0x0,%edi
+  802377:	48 b8 bc 10 80 00 00 	movabs $0x8010bc,%rax
+  80237e:	00 00 00 
+  802381:	ff d0                	call   *%rax
+  802383:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802385:	85 c0                	test   %eax,%eax
+  802387:	0f 88 1a 01 00 00    	js     8024a7 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80238d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802391:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  802398:	00 00 00 
+  80239b:	ff d0                	call   *%rax
+  80239d:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8023a0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8023a5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023aa:	48 89 c6             	mov    %rax,%rsi
+  8023ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023b2:	48 b8 bc 10 80 00 00 	movabs $0x8010bc,%rax
+  8023b9:	00 00 00 
+  8023bc:	ff d0                	call   *%rax
+  8023be:	89 c3                	mov    %eax,%ebx
+  8023c0:	85 c0                	test   %eax,%eax
+  8023c2:	0f 88 c5 00 00 00    	js     80248d <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8023c8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8023cc:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  8023d3:	00 00 00 
+  8023d6:	ff d0                	call   *%rax
+  8023d8:	48 89 c1             	mov    %rax,%rcx
+  8023db:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8023e1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ec:	4c 89 ee             	mov    %r13,%rsi
+  8023ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023f4:	48 b8 23 11 80 00 00 	movabs $0x801123,%rax
+  8023fb:	00 00 00 
+  8023fe:	ff d0                	call   *%rax
+  802400:	89 c3                	mov    %eax,%ebx
+  802402:	85 c0                	test   %eax,%eax
+  802404:	78 6e                	js     802474 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802406:	be 00 10 00 00       	mov    $0x1000,%esi
+  80240b:	4c 89 ef             	mov    %r13,%rdi
+  80240e:	48 b8 5e 10 80 00 00 	movabs $0x80105e,%rax
+  802415:	00 00 00 
+  802418:	ff d0                	call   *%rax
+  80241a:	83 f8 02             	cmp    $0x2,%eax
+  80241d:	0f 85 ab 00 00 00    	jne    8024ce <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802423:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80242a:	00 00 
+  80242c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802430:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802432:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802436:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80243d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802441:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802443:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802447:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80244e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802452:	48 bb 5e 16 80 00 00 	movabs $0x80165e,%rbx
+  802459:	00 00 00 
+  80245c:	ff d3                	call   *%rbx
+  80245e:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802462:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802466:	ff d3                	call   *%rbx
+  802468:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80246d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802472:	eb 4d                	jmp    8024c1 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802474:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802479:	4c 89 ee             	mov    %r13,%rsi
+  80247c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802481:	48 b8 88 11 80 00 00 	movabs $0x801188,%rax
+  802488:	00 00 00 
+  80248b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80248d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802492:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802496:	bf 00 00 00 00       	mov    $0x0,%edi
+  80249b:	48 b8 88 11 80 00 00 	movabs $0x801188,%rax
+  8024a2:	00 00 00 
+  8024a5:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8024a7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024ac:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8024b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024b5:	48 b8 88 11 80 00 00 	movabs $0x801188,%rax
+  8024bc:	00 00 00 
+  8024bf:	ff d0                	call   *%rax
+}
+  8024c1:	89 d8                	mov    %ebx,%eax
+  8024c3:	48 83 c4 18          	add    $0x18,%rsp
+  8024c7:	5b                   	pop    %rbx
+  8024c8:	41 5c                	pop    %r12
+  8024ca:	41 5d                	pop    %r13
+  8024cc:	5d                   	pop    %rbp
+  8024cd:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8024ce:	48 b9 d0 31 80 00 00 	movabs $0x8031d0,%rcx
+  8024d5:	00 00 00 
+  8024d8:	48 ba a7 31 80 00 00 	movabs $0x8031a7,%rdx
+  8024df:	00 00 00 
+  8024e2:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8024e7:	48 bf bc 31 80 00 00 	movabs $0x8031bc,%rdi
+  8024ee:	00 00 00 
+  8024f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f6:	49 b8 31 29 80 00 00 	movabs $0x802931,%r8
+  8024fd:	00 00 00 
+  802500:	41 ff d0             	call   *%r8
+
+0000000000802503 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802503:	55                   	push   %rbp
+  802504:	48 89 e5             	mov    %rsp,%rbp
+  802507:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80250b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80250f:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  802516:	00 00 00 
+  802519:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80251b:	85 c0                	test   %eax,%eax
+  80251d:	78 35                	js     802554 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80251f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802523:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  80252a:	00 00 00 
+  80252d:	ff d0                	call   *%rax
+  80252f:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802532:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802537:	be 00 10 00 00       	mov    $0x1000,%esi
+  80253c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802540:	48 b8 90 10 80 00 00 	movabs $0x801090,%rax
+  802547:	00 00 00 
+  80254a:	ff d0                	call   *%rax
+  80254c:	85 c0                	test   %eax,%eax
+  80254e:	0f 94 c0             	sete   %al
+  802551:	0f b6 c0             	movzbl %al,%eax
+}
+  802554:	c9                   	leave
+  802555:	c3                   	ret
+
+0000000000802556 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802556:	48 89 f8             	mov    %rdi,%rax
+  802559:	48 c1 e8 27          	shr    $0x27,%rax
+  80255d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802564:	01 00 00 
+  802567:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80256b:	f6 c2 01             	test   $0x1,%dl
+  80256e:	74 6d                	je     8025dd <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802570:	48 89 f8             	mov    %rdi,%rax
+  802573:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802577:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80257e:	01 00 00 
+  802581:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802585:	f6 c2 01             	test   $0x1,%dl
+  802588:	74 62                	je     8025ec <get_uvpt_entry+0x96>
+  80258a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802591:	01 00 00 
+  802594:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802598:	f6 c2 80             	test   $0x80,%dl
+  80259b:	75 4f                	jne    8025ec <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80259d:	48 89 f8             	mov    %rdi,%rax
+  8025a0:	48 c1 e8 15          	shr    $0x15,%rax
+  8025a4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025ab:	01 00 00 
+  8025ae:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025b2:	f6 c2 01             	test   $0x1,%dl
+  8025b5:	74 44                	je     8025fb <get_uvpt_entry+0xa5>
+  8025b7:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025be:	01 00 00 
+  8025c1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025c5:	f6 c2 80             	test   $0x80,%dl
+  8025c8:	75 31                	jne    8025fb <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8025ca:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8025ce:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8025d5:	01 00 00 
+  8025d8:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8025dc:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8025dd:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8025e4:	01 00 00 
+  8025e7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025eb:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025ec:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8025f3:	01 00 00 
+  8025f6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025fa:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025fb:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802602:	01 00 00 
+  802605:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802609:	c3                   	ret
+
+000000000080260a <get_prot>:
+
+int
+get_prot(void *va) {
+  80260a:	55                   	push   %rbp
+  80260b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80260e:	48 b8 56 25 80 00 00 	movabs $0x802556,%rax
+  802615:	00 00 00 
+  802618:	ff d0                	call   *%rax
+  80261a:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80261d:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802622:	89 c1                	mov    %eax,%ecx
+  802624:	83 c9 04             	or     $0x4,%ecx
+  802627:	f6 c2 01             	test   $0x1,%dl
+  80262a:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80262d:	89 c1                	mov    %eax,%ecx
+  80262f:	83 c9 02             	or     $0x2,%ecx
+  802632:	f6 c2 02             	test   $0x2,%dl
+  802635:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802638:	89 c1                	mov    %eax,%ecx
+  80263a:	83 c9 01             	or     $0x1,%ecx
+  80263d:	48 85 d2             	test   %rdx,%rdx
+  802640:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802643:	89 c1                	mov    %eax,%ecx
+  802645:	83 c9 40             	or     $0x40,%ecx
+  802648:	f6 c6 04             	test   $0x4,%dh
+  80264b:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80264e:	5d                   	pop    %rbp
+  80264f:	c3                   	ret
+
+0000000000802650 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802650:	55                   	push   %rbp
+  802651:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802654:	48 b8 56 25 80 00 00 	movabs $0x802556,%rax
+  80265b:	00 00 00 
+  80265e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802660:	48 c1 e8 06          	shr    $0x6,%rax
+  802664:	83 e0 01             	and    $0x1,%eax
+}
+  802667:	5d                   	pop    %rbp
+  802668:	c3                   	ret
+
+0000000000802669 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802669:	55                   	push   %rbp
+  80266a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80266d:	48 b8 56 25 80 00 00 	movabs $0x802556,%rax
+  802674:	00 00 00 
+  802677:	ff d0                	call   *%rax
+  802679:	83 e0 01             	and    $0x1,%eax
+}
+  80267c:	5d                   	pop    %rbp
+  80267d:	c3                   	ret
+
+000000000080267e <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80267e:	55                   	push   %rbp
+  80267f:	48 89 e5             	mov    %rsp,%rbp
+  802682:	41 57                	push   %r15
+  802684:	41 56                	push   %r14
+  802686:	41 55                	push   %r13
+  802688:	41 54                	push   %r12
+  80268a:	53                   	push   %rbx
+  80268b:	48 83 ec 18          	sub    $0x18,%rsp
+  80268f:	49 89 ff             	mov    %rdi,%r15
+  802692:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802696:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  80269b:	49 bc 69 26 80 00 00 	movabs $0x802669,%r12
+  8026a2:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  8026a5:	49 be 0a 26 80 00 00 	movabs $0x80260a,%r14
+  8026ac:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8026af:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  8026b6:	00 00 00 
+  8026b9:	eb 0c                	jmp    8026c7 <foreach_shared_region+0x49>
+  8026bb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8026c2:	4c 39 eb             	cmp    %r13,%rbx
+  8026c5:	74 38                	je     8026ff <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  8026c7:	48 89 df             	mov    %rbx,%rdi
+  8026ca:	41 ff d4             	call   *%r12
+  8026cd:	84 c0                	test   %al,%al
+  8026cf:	74 ea                	je     8026bb <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  8026d1:	48 89 df             	mov    %rbx,%rdi
+  8026d4:	41 ff d6             	call   *%r14
+  8026d7:	a8 40                	test   $0x40,%al
+  8026d9:	74 e0                	je     8026bb <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8026db:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8026e2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8026e6:	48 89 df             	mov    %rbx,%rdi
+  8026e9:	41 ff d7             	call   *%r15
+        if (err)
+  8026ec:	85 c0                	test   %eax,%eax
+  8026ee:	74 cb                	je     8026bb <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8026f0:	48 83 c4 18          	add    $0x18,%rsp
+  8026f4:	5b                   	pop    %rbx
+  8026f5:	41 5c                	pop    %r12
+  8026f7:	41 5d                	pop    %r13
+  8026f9:	41 5e                	pop    %r14
+  8026fb:	41 5f                	pop    %r15
+  8026fd:	5d                   	pop    %rbp
+  8026fe:	c3                   	ret
+    return 0;
+  8026ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802704:	eb ea                	jmp    8026f0 <foreach_shared_region+0x72>
+
+0000000000802706 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80270b:	c3                   	ret
+
+000000000080270c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80270c:	55                   	push   %rbp
+  80270d:	48 89 e5             	mov    %rsp,%rbp
+  802710:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802713:	48 be f4 31 80 00 00 	movabs $0x8031f4,%rsi
+  80271a:	00 00 00 
+  80271d:	48 b8 0c 0b 80 00 00 	movabs $0x800b0c,%rax
+  802724:	00 00 00 
+  802727:	ff d0                	call   *%rax
+    return 0;
+}
+  802729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272e:	5d                   	pop    %rbp
+  80272f:	c3                   	ret
+
+0000000000802730 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802730:	55                   	push   %rbp
+  802731:	48 89 e5             	mov    %rsp,%rbp
+  802734:	41 57                	push   %r15
+  802736:	41 56                	push   %r14
+  802738:	41 55                	push   %r13
+  80273a:	41 54                	push   %r12
+  80273c:	53                   	push   %rbx
+  80273d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802744:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80274b:	48 85 d2             	test   %rdx,%rdx
+  80274e:	74 7a                	je     8027ca <devcons_write+0x9a>
+  802750:	49 89 d6             	mov    %rdx,%r14
+  802753:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802759:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80275e:	49 bf 06 0d 80 00 00 	movabs $0x800d06,%r15
+  802765:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802768:	4c 89 f3             	mov    %r14,%rbx
+  80276b:	48 29 f3             	sub    %rsi,%rbx
+  80276e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802773:	48 39 c3             	cmp    %rax,%rbx
+  802776:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80277a:	4c 63 eb             	movslq %ebx,%r13
+  80277d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802784:	48 01 c6             	add    %rax,%rsi
+  802787:	4c 89 ea             	mov    %r13,%rdx
+  80278a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802791:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802794:	4c 89 ee             	mov    %r13,%rsi
+  802797:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80279e:	48 b8 33 0f 80 00 00 	movabs $0x800f33,%rax
+  8027a5:	00 00 00 
+  8027a8:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8027aa:	41 01 dc             	add    %ebx,%r12d
+  8027ad:	49 63 f4             	movslq %r12d,%rsi
+  8027b0:	4c 39 f6             	cmp    %r14,%rsi
+  8027b3:	72 b3                	jb     802768 <devcons_write+0x38>
+    return res;
+  8027b5:	49 63 c4             	movslq %r12d,%rax
+}
+  8027b8:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8027bf:	5b                   	pop    %rbx
+  8027c0:	41 5c                	pop    %r12
+  8027c2:	41 5d                	pop    %r13
+  8027c4:	41 5e                	pop    %r14
+  8027c6:	41 5f                	pop    %r15
+  8027c8:	5d                   	pop    %rbp
+  8027c9:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8027ca:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8027d0:	eb e3                	jmp    8027b5 <devcons_write+0x85>
+
+00000000008027d2 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8027d2:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8027d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027da:	48 85 c0             	test   %rax,%rax
+  8027dd:	74 55                	je     802834 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8027df:	55                   	push   %rbp
+  8027e0:	48 89 e5             	mov    %rsp,%rbp
+  8027e3:	41 55                	push   %r13
+  8027e5:	41 54                	push   %r12
+  8027e7:	53                   	push   %rbx
+  8027e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8027ec:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8027ef:	48 bb 60 0f 80 00 00 	movabs $0x800f60,%rbx
+  8027f6:	00 00 00 
+  8027f9:	49 bc 2d 10 80 00 00 	movabs $0x80102d,%r12
+  802800:	00 00 00 
+  802803:	eb 03                	jmp    802808 <devcons_read+0x36>
+  802805:	41 ff d4             	call   *%r12
+  802808:	ff d3                	call   *%rbx
+  80280a:	85 c0                	test   %eax,%eax
+  80280c:	74 f7                	je     802805 <devcons_read+0x33>
+    if (c < 0) return c;
+  80280e:	48 63 d0             	movslq %eax,%rdx
+  802811:	78 13                	js     802826 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802813:	ba 00 00 00 00       	mov    $0x0,%edx
+  802818:	83 f8 04             	cmp    $0x4,%eax
+  80281b:	74 09                	je     802826 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80281d:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802821:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802826:	48 89 d0             	mov    %rdx,%rax
+  802829:	48 83 c4 08          	add    $0x8,%rsp
+  80282d:	5b                   	pop    %rbx
+  80282e:	41 5c                	pop    %r12
+  802830:	41 5d                	pop    %r13
+  802832:	5d                   	pop    %rbp
+  802833:	c3                   	ret
+  802834:	48 89 d0             	mov    %rdx,%rax
+  802837:	c3                   	ret
+
+0000000000802838 <cputchar>:
+cputchar(int ch) {
+  802838:	55                   	push   %rbp
+  802839:	48 89 e5             	mov    %rsp,%rbp
+  80283c:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802840:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802844:	be 01 00 00 00       	mov    $0x1,%esi
+  802849:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80284d:	48 b8 33 0f 80 00 00 	movabs $0x800f33,%rax
+  802854:	00 00 00 
+  802857:	ff d0                	call   *%rax
+}
+  802859:	c9                   	leave
+  80285a:	c3                   	ret
+
+000000000080285b <getchar>:
+getchar(void) {
+  80285b:	55                   	push   %rbp
+  80285c:	48 89 e5             	mov    %rsp,%rbp
+  80285f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802863:	ba 01 00 00 00       	mov    $0x1,%edx
+  802868:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80286c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802871:	48 b8 cf 19 80 00 00 	movabs $0x8019cf,%rax
+  802878:	00 00 00 
+  80287b:	ff d0                	call   *%rax
+  80287d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80287f:	85 c0                	test   %eax,%eax
+  802881:	78 06                	js     802889 <getchar+0x2e>
+  802883:	74 08                	je     80288d <getchar+0x32>
+  802885:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802889:	89 d0                	mov    %edx,%eax
+  80288b:	c9                   	leave
+  80288c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80288d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802892:	eb f5                	jmp    802889 <getchar+0x2e>
+
+0000000000802894 <iscons>:
+iscons(int fdnum) {
+  802894:	55                   	push   %rbp
+  802895:	48 89 e5             	mov    %rsp,%rbp
+  802898:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80289c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8028a0:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  8028a7:	00 00 00 
+  8028aa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028ac:	85 c0                	test   %eax,%eax
+  8028ae:	78 18                	js     8028c8 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8028b0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028b4:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  8028bb:	00 00 00 
+  8028be:	8b 00                	mov    (%rax),%eax
+  8028c0:	39 02                	cmp    %eax,(%rdx)
+  8028c2:	0f 94 c0             	sete   %al
+  8028c5:	0f b6 c0             	movzbl %al,%eax
+}
+  8028c8:	c9                   	leave
+  8028c9:	c3                   	ret
+
+00000000008028ca <opencons>:
+opencons(void) {
+  8028ca:	55                   	push   %rbp
+  8028cb:	48 89 e5             	mov    %rsp,%rbp
+  8028ce:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8028d2:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8028d6:	48 b8 8c 16 80 00 00 	movabs $0x80168c,%rax
+  8028dd:	00 00 00 
+  8028e0:	ff d0                	call   *%rax
+  8028e2:	85 c0                	test   %eax,%eax
+  8028e4:	78 49                	js     80292f <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8028e6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8028eb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028f0:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8028f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028f9:	48 b8 bc 10 80 00 00 	movabs $0x8010bc,%rax
+  802900:	00 00 00 
+  802903:	ff d0                	call   *%rax
+  802905:	85 c0                	test   %eax,%eax
+  802907:	78 26                	js     80292f <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802909:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80290d:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802914:	00 00 
+  802916:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802918:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80291c:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802923:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  80292a:	00 00 00 
+  80292d:	ff d0                	call   *%rax
+}
+  80292f:	c9                   	leave
+  802930:	c3                   	ret
+
+0000000000802931 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802931:	55                   	push   %rbp
+  802932:	48 89 e5             	mov    %rsp,%rbp
+  802935:	41 56                	push   %r14
+  802937:	41 55                	push   %r13
+  802939:	41 54                	push   %r12
+  80293b:	53                   	push   %rbx
+  80293c:	48 83 ec 50          	sub    $0x50,%rsp
+  802940:	49 89 fc             	mov    %rdi,%r12
+  802943:	41 89 f5             	mov    %esi,%r13d
+  802946:	48 89 d3             	mov    %rdx,%rbx
+  802949:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80294d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802951:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802955:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80295c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802960:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802964:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802968:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80296c:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802973:	00 00 00 
+  802976:	4c 8b 30             	mov    (%rax),%r14
+  802979:	48 b8 fc 0f 80 00 00 	movabs $0x800ffc,%rax
+  802980:	00 00 00 
+  802983:	ff d0                	call   *%rax
+  802985:	89 c6                	mov    %eax,%esi
+  802987:	45 89 e8             	mov    %r13d,%r8d
+  80298a:	4c 89 e1             	mov    %r12,%rcx
+  80298d:	4c 89 f2             	mov    %r14,%rdx
+  802990:	48 bf 00 32 80 00 00 	movabs $0x803200,%rdi
+  802997:	00 00 00 
+  80299a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299f:	49 bc e7 01 80 00 00 	movabs $0x8001e7,%r12
+  8029a6:	00 00 00 
+  8029a9:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8029ac:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8029b0:	48 89 df             	mov    %rbx,%rdi
+  8029b3:	48 b8 83 01 80 00 00 	movabs $0x800183,%rax
+  8029ba:	00 00 00 
+  8029bd:	ff d0                	call   *%rax
+    cprintf("\n");
+  8029bf:	48 bf 6c 2b 80 00 00 	movabs $0x802b6c,%rdi
+  8029c6:	00 00 00 
+  8029c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ce:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8029d1:	cc                   	int3
+  8029d2:	eb fd                	jmp    8029d1 <_panic+0xa0>
+
+00000000008029d4 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8029d4:	55                   	push   %rbp
+  8029d5:	48 89 e5             	mov    %rsp,%rbp
+  8029d8:	41 54                	push   %r12
+  8029da:	53                   	push   %rbx
+  8029db:	48 89 fb             	mov    %rdi,%rbx
+  8029de:	48 89 f7             	mov    %rsi,%rdi
+  8029e1:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8029e4:	48 85 f6             	test   %rsi,%rsi
+  8029e7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029ee:	00 00 00 
+  8029f1:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8029f5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029fa:	48 b8 26 14 80 00 00 	movabs $0x801426,%rax
+  802a01:	00 00 00 
+  802a04:	ff d0                	call   *%rax
+    if (res < 0) {
+  802a06:	85 c0                	test   %eax,%eax
+  802a08:	78 45                	js     802a4f <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802a0a:	48 85 db             	test   %rbx,%rbx
+  802a0d:	74 12                	je     802a21 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802a0f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a16:	00 00 00 
+  802a19:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802a1f:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802a21:	4d 85 e4             	test   %r12,%r12
+  802a24:	74 14                	je     802a3a <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802a26:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a2d:	00 00 00 
+  802a30:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802a36:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802a3a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a41:	00 00 00 
+  802a44:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802a4a:	5b                   	pop    %rbx
+  802a4b:	41 5c                	pop    %r12
+  802a4d:	5d                   	pop    %rbp
+  802a4e:	c3                   	ret
+        if (from_env_store)
+  802a4f:	48 85 db             	test   %rbx,%rbx
+  802a52:	74 06                	je     802a5a <ipc_recv+0x86>
+            *from_env_store = 0;
+  802a54:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802a5a:	4d 85 e4             	test   %r12,%r12
+  802a5d:	74 eb                	je     802a4a <ipc_recv+0x76>
+            *perm_store = 0;
+  802a5f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802a66:	00 
+  802a67:	eb e1                	jmp    802a4a <ipc_recv+0x76>
+
+0000000000802a69 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802a69:	55                   	push   %rbp
+  802a6a:	48 89 e5             	mov    %rsp,%rbp
+  802a6d:	41 57                	push   %r15
+  802a6f:	41 56                	push   %r14
+  802a71:	41 55                	push   %r13
+  802a73:	41 54                	push   %r12
+  802a75:	53                   	push   %rbx
+  802a76:	48 83 ec 18          	sub    $0x18,%rsp
+  802a7a:	41 89 fd             	mov    %edi,%r13d
+  802a7d:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802a80:	48 89 d3             	mov    %rdx,%rbx
+  802a83:	49 89 cc             	mov    %rcx,%r12
+  802a86:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a8a:	48 85 d2             	test   %rdx,%rdx
+  802a8d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a94:	00 00 00 
+  802a97:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a9b:	49 be fa 13 80 00 00 	movabs $0x8013fa,%r14
+  802aa2:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802aa5:	49 bf 2d 10 80 00 00 	movabs $0x80102d,%r15
+  802aac:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802aaf:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802ab2:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802ab6:	4c 89 e1             	mov    %r12,%rcx
+  802ab9:	48 89 da             	mov    %rbx,%rdx
+  802abc:	44 89 ef             	mov    %r13d,%edi
+  802abf:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802ac2:	85 c0                	test   %eax,%eax
+  802ac4:	74 34                	je     802afa <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802ac6:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802ac9:	75 05                	jne    802ad0 <ipc_send+0x67>
+        sys_yield();
+  802acb:	41 ff d7             	call   *%r15
+    while (true) {
+  802ace:	eb df                	jmp    802aaf <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802ad0:	48 ba 23 32 80 00 00 	movabs $0x803223,%rdx
+  802ad7:	00 00 00 
+  802ada:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802adf:	48 bf 3c 32 80 00 00 	movabs $0x80323c,%rdi
+  802ae6:	00 00 00 
+  802ae9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aee:	48 b9 31 29 80 00 00 	movabs $0x802931,%rcx
+  802af5:	00 00 00 
+  802af8:	ff d1                	call   *%rcx
+    }
+}
+  802afa:	48 83 c4 18          	add    $0x18,%rsp
+  802afe:	5b                   	pop    %rbx
+  802aff:	41 5c                	pop    %r12
+  802b01:	41 5d                	pop    %r13
+  802b03:	41 5e                	pop    %r14
+  802b05:	41 5f                	pop    %r15
+  802b07:	5d                   	pop    %rbp
+  802b08:	c3                   	ret
+
+0000000000802b09 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802b09:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802b0e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802b15:	00 00 00 
+  802b18:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802b1f:	48 01 ca             	add    %rcx,%rdx
+  802b22:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802b28:	39 fa                	cmp    %edi,%edx
+  802b2a:	74 12                	je     802b3e <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802b2c:	48 83 c0 01          	add    $0x1,%rax
+  802b30:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b36:	75 e0                	jne    802b18 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802b38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b3d:	c3                   	ret
+            return envs[i].env_id;
+  802b3e:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802b45:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b4c:	00 00 00 
+  802b4f:	48 01 d0             	add    %rdx,%rax
+  802b52:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b58:	c3                   	ret
+  802b59:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000802b60 <__rodata_start>:
+  802b60:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  802b65:	2c 20                	sub    $0x20,%al
+  802b67:	77 6f                	ja     802bd8 <__rodata_start+0x78>
+  802b69:	72 6c                	jb     802bd7 <__rodata_start+0x77>
+  802b6b:	64 0a 00             	or     %fs:(%rax),%al
+  802b6e:	69 20 61 6d 20 65    	imul   $0x65206d61,(%rax),%esp
+  802b74:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b75:	76 69                	jbe    802be0 <__rodata_start+0x80>
+  802b77:	72 6f                	jb     802be8 <__rodata_start+0x88>
+  802b79:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b7a:	6d                   	insl   (%dx),%es:(%rdi)
+  802b7b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802b7d:	74 20                	je     802b9f <__rodata_start+0x3f>
+  802b7f:	25 30 38 78 0a       	and    $0xa783830,%eax
+  802b84:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  802b8b:	77 6e                	ja     802bfb <__rodata_start+0x9b>
+  802b8d:	3e 00 30             	ds add %dh,(%rax)
+  802b90:	31 32                	xor    %esi,(%rdx)
+  802b92:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802b99:	41                   	rex.B
+  802b9a:	42                   	rex.X
+  802b9b:	43                   	rex.XB
+  802b9c:	44                   	rex.R
+  802b9d:	45                   	rex.RB
+  802b9e:	46 00 30             	rex.RX add %r14b,(%rax)
+  802ba1:	31 32                	xor    %esi,(%rdx)
+  802ba3:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802baa:	61                   	(bad)
+  802bab:	62 63 64 65 66       	(bad)
+  802bb0:	00 28                	add    %ch,(%rax)
+  802bb2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bb3:	75 6c                	jne    802c21 <__rodata_start+0xc1>
+  802bb5:	6c                   	insb   (%dx),%es:(%rdi)
+  802bb6:	29 00                	sub    %eax,(%rax)
+  802bb8:	65 72 72             	gs jb  802c2d <__rodata_start+0xcd>
+  802bbb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bbc:	72 20                	jb     802bde <__rodata_start+0x7e>
+  802bbe:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802bc3:	73 70                	jae    802c35 <__rodata_start+0xd5>
+  802bc5:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802bc9:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802bd0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bd1:	72 00                	jb     802bd3 <__rodata_start+0x73>
+  802bd3:	62 61 64 20 65       	(bad)
+  802bd8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bd9:	76 69                	jbe    802c44 <__rodata_start+0xe4>
+  802bdb:	72 6f                	jb     802c4c <__rodata_start+0xec>
+  802bdd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bde:	6d                   	insl   (%dx),%es:(%rdi)
+  802bdf:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802be1:	74 00                	je     802be3 <__rodata_start+0x83>
+  802be3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802bea:	20 70 61             	and    %dh,0x61(%rax)
+  802bed:	72 61                	jb     802c50 <__rodata_start+0xf0>
+  802bef:	6d                   	insl   (%dx),%es:(%rdi)
+  802bf0:	65 74 65             	gs je  802c58 <__rodata_start+0xf8>
+  802bf3:	72 00                	jb     802bf5 <__rodata_start+0x95>
+  802bf5:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bf6:	75 74                	jne    802c6c <__rodata_start+0x10c>
+  802bf8:	20 6f 66             	and    %ch,0x66(%rdi)
+  802bfb:	20 6d 65             	and    %ch,0x65(%rbp)
+  802bfe:	6d                   	insl   (%dx),%es:(%rdi)
+  802bff:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c00:	72 79                	jb     802c7b <__rodata_start+0x11b>
+  802c02:	00 6f 75             	add    %ch,0x75(%rdi)
+  802c05:	74 20                	je     802c27 <__rodata_start+0xc7>
+  802c07:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c08:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802c0c:	76 69                	jbe    802c77 <__rodata_start+0x117>
+  802c0e:	72 6f                	jb     802c7f <__rodata_start+0x11f>
+  802c10:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c11:	6d                   	insl   (%dx),%es:(%rdi)
+  802c12:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802c14:	74 73                	je     802c89 <__rodata_start+0x129>
+  802c16:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802c19:	72 72                	jb     802c8d <__rodata_start+0x12d>
+  802c1b:	75 70                	jne    802c8d <__rodata_start+0x12d>
+  802c1d:	74 65                	je     802c84 <__rodata_start+0x124>
+  802c1f:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802c24:	75 67                	jne    802c8d <__rodata_start+0x12d>
+  802c26:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802c29:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802c2b:	00 73 65             	add    %dh,0x65(%rbx)
+  802c2e:	67 6d                	insl   (%dx),%es:(%edi)
+  802c30:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802c32:	74 61                	je     802c95 <__rodata_start+0x135>
+  802c34:	74 69                	je     802c9f <__rodata_start+0x13f>
+  802c36:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c37:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c38:	20 66 61             	and    %ah,0x61(%rsi)
+  802c3b:	75 6c                	jne    802ca9 <__rodata_start+0x149>
+  802c3d:	74 00                	je     802c3f <__rodata_start+0xdf>
+  802c3f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802c46:	20 45 4c             	and    %al,0x4c(%rbp)
+  802c49:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802c4d:	61                   	(bad)
+  802c4e:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802c53:	20 73 75             	and    %dh,0x75(%rbx)
+  802c56:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802c59:	73 79                	jae    802cd4 <__rodata_start+0x174>
+  802c5b:	73 74                	jae    802cd1 <__rodata_start+0x171>
+  802c5d:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802c5f:	20 63 61             	and    %ah,0x61(%rbx)
+  802c62:	6c                   	insb   (%dx),%es:(%rdi)
+  802c63:	6c                   	insb   (%dx),%es:(%rdi)
+  802c64:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802c67:	74 72                	je     802cdb <__rodata_start+0x17b>
+  802c69:	79 20                	jns    802c8b <__rodata_start+0x12b>
+  802c6b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c6c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c6d:	74 20                	je     802c8f <__rodata_start+0x12f>
+  802c6f:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802c71:	75 6e                	jne    802ce1 <__rodata_start+0x181>
+  802c73:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802c77:	76 20                	jbe    802c99 <__rodata_start+0x139>
+  802c79:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802c80:	72 65                	jb     802ce7 <__rodata_start+0x187>
+  802c82:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802c85:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c86:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802c8a:	65 78 70             	gs js  802cfd <__rodata_start+0x19d>
+  802c8d:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802c92:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802c95:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802c99:	20 66 69             	and    %ah,0x69(%rsi)
+  802c9c:	6c                   	insb   (%dx),%es:(%rdi)
+  802c9d:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802ca1:	20 66 72             	and    %ah,0x72(%rsi)
+  802ca4:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802ca9:	61                   	(bad)
+  802caa:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802cad:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cae:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802caf:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802cb3:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802cb6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cb7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cb8:	20 6d 61             	and    %ch,0x61(%rbp)
+  802cbb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cbc:	79 20                	jns    802cde <__rodata_start+0x17e>
+  802cbe:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802cc5:	72 65                	jb     802d2c <__rodata_start+0x1cc>
+  802cc7:	20 6f 70             	and    %ch,0x70(%rdi)
+  802cca:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802ccc:	00 66 69             	add    %ah,0x69(%rsi)
+  802ccf:	6c                   	insb   (%dx),%es:(%rdi)
+  802cd0:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802cd4:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802cd7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cd8:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802cdb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cdc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cdd:	74 20                	je     802cff <__rodata_start+0x19f>
+  802cdf:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802ce1:	75 6e                	jne    802d51 <__rodata_start+0x1f1>
+  802ce3:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802ce7:	76 61                	jbe    802d4a <__rodata_start+0x1ea>
+  802ce9:	6c                   	insb   (%dx),%es:(%rdi)
+  802cea:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802cf1:	00 
+  802cf2:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802cf9:	72 65                	jb     802d60 <__rodata_start+0x200>
+  802cfb:	61                   	(bad)
+  802cfc:	64 79 20             	fs jns 802d1f <__rodata_start+0x1bf>
+  802cff:	65 78 69             	gs js  802d6b <__rodata_start+0x20b>
+  802d02:	73 74                	jae    802d78 <__rodata_start+0x218>
+  802d04:	73 00                	jae    802d06 <__rodata_start+0x1a6>
+  802d06:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d07:	70 65                	jo     802d6e <__rodata_start+0x20e>
+  802d09:	72 61                	jb     802d6c <__rodata_start+0x20c>
+  802d0b:	74 69                	je     802d76 <__rodata_start+0x216>
+  802d0d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d0e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d0f:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802d12:	74 20                	je     802d34 <__rodata_start+0x1d4>
+  802d14:	73 75                	jae    802d8b <__rodata_start+0x22b>
+  802d16:	70 70                	jo     802d88 <__rodata_start+0x228>
+  802d18:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d19:	72 74                	jb     802d8f <__rodata_start+0x22f>
+  802d1b:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802d20:	65 72 61             	gs jb  802d84 <__rodata_start+0x224>
+  802d23:	74 69                	je     802d8e <__rodata_start+0x22e>
+  802d25:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d26:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d27:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802d2a:	74 20                	je     802d4c <__rodata_start+0x1ec>
+  802d2c:	70 65                	jo     802d93 <__rodata_start+0x233>
+  802d2e:	72 6d                	jb     802d9d <__rodata_start+0x23d>
+  802d30:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  802d37:	2e 
+  802d38:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  802d3f:	00 
+  802d40:	d4                   	(bad)
+  802d41:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d47:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ad57 <__bss_end+0x2d57>
+  802d4d:	00 00                	add    %al,(%rax)
+  802d4f:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80ad5f <__bss_end+0x2d5f>
+  802d55:	00 00                	add    %al,(%rax)
+  802d57:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ad67 <__bss_end+0x2d67>
+  802d5d:	00 00                	add    %al,(%rax)
+  802d5f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ad6f <__bss_end+0x2d6f>
+  802d65:	00 00                	add    %al,(%rax)
+  802d67:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ad77 <__bss_end+0x2d77>
+  802d6d:	00 00                	add    %al,(%rax)
+  802d6f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ad7f <__bss_end+0x2d7f>
+  802d75:	00 00                	add    %al,(%rax)
+  802d77:	00 f3                	add    %dh,%bl
+  802d79:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d7f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ad8f <__bss_end+0x2d8f>
+  802d85:	00 00                	add    %al,(%rax)
+  802d87:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ad97 <__bss_end+0x2d97>
+  802d8d:	00 00                	add    %al,(%rax)
+  802d8f:	00 e7                	add    %ah,%bh
+  802d91:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d97:	00 61 04             	add    %ah,0x4(%rcx)
+  802d9a:	80 00 00             	addb   $0x0,(%rax)
+  802d9d:	00 00                	add    %al,(%rax)
+  802d9f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80adaf <__bss_end+0x2daf>
+  802da5:	00 00                	add    %al,(%rax)
+  802da7:	00 e7                	add    %ah,%bh
+  802da9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802daf:	00 2d 04 80 00 00    	add    %ch,0x8004(%rip)        # 80adb9 <__bss_end+0x2db9>
+  802db5:	00 00                	add    %al,(%rax)
+  802db7:	00 2d 04 80 00 00    	add    %ch,0x8004(%rip)        # 80adc1 <__bss_end+0x2dc1>
+  802dbd:	00 00                	add    %al,(%rax)
+  802dbf:	00 2d 04 80 00 00    	add    %ch,0x8004(%rip)        # 80adc9 <__bss_end+0x2dc9>
+  802dc5:	00 00                	add    %al,(%rax)
+  802dc7:	00 2d 04 80 00 00    	add    %ch,0x8004(%rip)        # 80add1 <__bss_end+0x2dd1>
+  802dcd:	00 00                	add    %al,(%rax)
+  802dcf:	00 2d 04 80 00 00    	add    %ch,0x8004(%rip)        # 80add9 <__bss_end+0x2dd9>
+  802dd5:	00 00                	add    %al,(%rax)
+  802dd7:	00 2d 04 80 00 00    	add    %ch,0x8004(%rip)        # 80ade1 <__bss_end+0x2de1>
+  802ddd:	00 00                	add    %al,(%rax)
+  802ddf:	00 2d 04 80 00 00    	add    %ch,0x8004(%rip)        # 80ade9 <__bss_end+0x2de9>
+  802de5:	00 00                	add    %al,(%rax)
+  802de7:	00 2d 04 80 00 00    	add    %ch,0x8004(%rip)        # 80adf1 <__bss_end+0x2df1>
+  802ded:	00 00                	add    %al,(%rax)
+  802def:	00 2d 04 80 00 00    	add    %ch,0x8004(%rip)        # 80adf9 <__bss_end+0x2df9>
+  802df5:	00 00                	add    %al,(%rax)
+  802df7:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae07 <__bss_end+0x2e07>
+  802dfd:	00 00                	add    %al,(%rax)
+  802dff:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae0f <__bss_end+0x2e0f>
+  802e05:	00 00                	add    %al,(%rax)
+  802e07:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae17 <__bss_end+0x2e17>
+  802e0d:	00 00                	add    %al,(%rax)
+  802e0f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae1f <__bss_end+0x2e1f>
+  802e15:	00 00                	add    %al,(%rax)
+  802e17:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae27 <__bss_end+0x2e27>
+  802e1d:	00 00                	add    %al,(%rax)
+  802e1f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae2f <__bss_end+0x2e2f>
+  802e25:	00 00                	add    %al,(%rax)
+  802e27:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae37 <__bss_end+0x2e37>
+  802e2d:	00 00                	add    %al,(%rax)
+  802e2f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae3f <__bss_end+0x2e3f>
+  802e35:	00 00                	add    %al,(%rax)
+  802e37:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae47 <__bss_end+0x2e47>
+  802e3d:	00 00                	add    %al,(%rax)
+  802e3f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae4f <__bss_end+0x2e4f>
+  802e45:	00 00                	add    %al,(%rax)
+  802e47:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae57 <__bss_end+0x2e57>
+  802e4d:	00 00                	add    %al,(%rax)
+  802e4f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae5f <__bss_end+0x2e5f>
+  802e55:	00 00                	add    %al,(%rax)
+  802e57:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae67 <__bss_end+0x2e67>
+  802e5d:	00 00                	add    %al,(%rax)
+  802e5f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae6f <__bss_end+0x2e6f>
+  802e65:	00 00                	add    %al,(%rax)
+  802e67:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae77 <__bss_end+0x2e77>
+  802e6d:	00 00                	add    %al,(%rax)
+  802e6f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae7f <__bss_end+0x2e7f>
+  802e75:	00 00                	add    %al,(%rax)
+  802e77:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae87 <__bss_end+0x2e87>
+  802e7d:	00 00                	add    %al,(%rax)
+  802e7f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae8f <__bss_end+0x2e8f>
+  802e85:	00 00                	add    %al,(%rax)
+  802e87:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae97 <__bss_end+0x2e97>
+  802e8d:	00 00                	add    %al,(%rax)
+  802e8f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80ae9f <__bss_end+0x2e9f>
+  802e95:	00 00                	add    %al,(%rax)
+  802e97:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80aea7 <__bss_end+0x2ea7>
+  802e9d:	00 00                	add    %al,(%rax)
+  802e9f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80aeaf <__bss_end+0x2eaf>
+  802ea5:	00 00                	add    %al,(%rax)
+  802ea7:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80aeb7 <__bss_end+0x2eb7>
+  802ead:	00 00                	add    %al,(%rax)
+  802eaf:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80aebf <__bss_end+0x2ebf>
+  802eb5:	00 00                	add    %al,(%rax)
+  802eb7:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80aec7 <__bss_end+0x2ec7>
+  802ebd:	00 00                	add    %al,(%rax)
+  802ebf:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80aecf <__bss_end+0x2ecf>
+  802ec5:	00 00                	add    %al,(%rax)
+  802ec7:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80aed7 <__bss_end+0x2ed7>
+  802ecd:	00 00                	add    %al,(%rax)
+  802ecf:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80aedf <__bss_end+0x2edf>
+  802ed5:	00 00                	add    %al,(%rax)
+  802ed7:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80aee7 <__bss_end+0x2ee7>
+  802edd:	00 00                	add    %al,(%rax)
+  802edf:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80aeef <__bss_end+0x2eef>
+  802ee5:	00 00                	add    %al,(%rax)
+  802ee7:	00 38                	add    %bh,(%rax)
+  802ee9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eef:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80aeff <__bss_end+0x2eff>
+  802ef5:	00 00                	add    %al,(%rax)
+  802ef7:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80af07 <__bss_end+0x2f07>
+  802efd:	00 00                	add    %al,(%rax)
+  802eff:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80af0f <__bss_end+0x2f0f>
+  802f05:	00 00                	add    %al,(%rax)
+  802f07:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80af17 <__bss_end+0x2f17>
+  802f0d:	00 00                	add    %al,(%rax)
+  802f0f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80af1f <__bss_end+0x2f1f>
+  802f15:	00 00                	add    %al,(%rax)
+  802f17:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80af27 <__bss_end+0x2f27>
+  802f1d:	00 00                	add    %al,(%rax)
+  802f1f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80af2f <__bss_end+0x2f2f>
+  802f25:	00 00                	add    %al,(%rax)
+  802f27:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80af37 <__bss_end+0x2f37>
+  802f2d:	00 00                	add    %al,(%rax)
+  802f2f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80af3f <__bss_end+0x2f3f>
+  802f35:	00 00                	add    %al,(%rax)
+  802f37:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80af47 <__bss_end+0x2f47>
+  802f3d:	00 00                	add    %al,(%rax)
+  802f3f:	00 84 04 80 00 00 00 	add    %al,0x80(%rsp,%rax,1)
+  802f46:	00 00                	add    %al,(%rax)
+  802f48:	53                   	push   %rbx
+  802f49:	06                   	(bad)
+  802f4a:	80 00 00             	addb   $0x0,(%rax)
+  802f4d:	00 00                	add    %al,(%rax)
+  802f4f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80af5f <__bss_end+0x2f5f>
+  802f55:	00 00                	add    %al,(%rax)
+  802f57:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80af67 <__bss_end+0x2f67>
+  802f5d:	00 00                	add    %al,(%rax)
+  802f5f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80af6f <__bss_end+0x2f6f>
+  802f65:	00 00                	add    %al,(%rax)
+  802f67:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80af77 <__bss_end+0x2f77>
+  802f6d:	00 00                	add    %al,(%rax)
+  802f6f:	00 b3 04 80 00 00    	add    %dh,0x8004(%rbx)
+  802f75:	00 00                	add    %al,(%rax)
+  802f77:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80af87 <__bss_end+0x2f87>
+  802f7d:	00 00                	add    %al,(%rax)
+  802f7f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80af8f <__bss_end+0x2f8f>
+  802f85:	00 00                	add    %al,(%rax)
+  802f87:	00 79 04             	add    %bh,0x4(%rcx)
+  802f8a:	80 00 00             	addb   $0x0,(%rax)
+  802f8d:	00 00                	add    %al,(%rax)
+  802f8f:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80af9f <__bss_end+0x2f9f>
+  802f95:	00 00                	add    %al,(%rax)
+  802f97:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80afa7 <__bss_end+0x2fa7>
+  802f9d:	00 00                	add    %al,(%rax)
+  802f9f:	00 fb                	add    %bh,%bl
+  802fa1:	07                   	(bad)
+  802fa2:	80 00 00             	addb   $0x0,(%rax)
+  802fa5:	00 00                	add    %al,(%rax)
+  802fa7:	00 c5                	add    %al,%ch
+  802fa9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  802faf:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80afbf <__bss_end+0x2fbf>
+  802fb5:	00 00                	add    %al,(%rax)
+  802fb7:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80afc7 <__bss_end+0x2fc7>
+  802fbd:	00 00                	add    %al,(%rax)
+  802fbf:	00 4a 05             	add    %cl,0x5(%rdx)
+  802fc2:	80 00 00             	addb   $0x0,(%rax)
+  802fc5:	00 00                	add    %al,(%rax)
+  802fc7:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80afd7 <__bss_end+0x2fd7>
+  802fcd:	00 00                	add    %al,(%rax)
+  802fcf:	00 27                	add    %ah,(%rdi)
+  802fd1:	07                   	(bad)
+  802fd2:	80 00 00             	addb   $0x0,(%rax)
+  802fd5:	00 00                	add    %al,(%rax)
+  802fd7:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80afe7 <__bss_end+0x2fe7>
+  802fdd:	00 00                	add    %al,(%rax)
+  802fdf:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80afef <__bss_end+0x2fef>
+  802fe5:	00 00                	add    %al,(%rax)
+  802fe7:	00 38                	add    %bh,(%rax)
+  802fe9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fef:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80afff <__bss_end+0x2fff>
+  802ff5:	00 00                	add    %al,(%rax)
+  802ff7:	00 dd                	add    %bl,%ch
+  802ff9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000803000 <error_string>:
+	...
+  803008:	c1 2b 80 00 00 00 00 00 d3 2b 80 00 00 00 00 00     .+.......+......
+  803018:	e3 2b 80 00 00 00 00 00 f5 2b 80 00 00 00 00 00     .+.......+......
+  803028:	03 2c 80 00 00 00 00 00 17 2c 80 00 00 00 00 00     .,.......,......
+  803038:	2c 2c 80 00 00 00 00 00 3f 2c 80 00 00 00 00 00     ,,......?,......
+  803048:	51 2c 80 00 00 00 00 00 65 2c 80 00 00 00 00 00     Q,......e,......
+  803058:	75 2c 80 00 00 00 00 00 88 2c 80 00 00 00 00 00     u,.......,......
+  803068:	9f 2c 80 00 00 00 00 00 b5 2c 80 00 00 00 00 00     .,.......,......
+  803078:	cd 2c 80 00 00 00 00 00 e5 2c 80 00 00 00 00 00     .,.......,......
+  803088:	f2 2c 80 00 00 00 00 00 b0 30 80 00 00 00 00 00     .,.......0......
+  803098:	06 2d 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .-..............
+  8030a8:	1e 2d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .-......file is 
+  8030b8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8030c8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8030d8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8030e8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8030f8:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803108:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803118:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803128:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803138:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803148:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803158:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803168:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803178:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803180 <devtab>:
+  803180:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803190:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8031a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8031b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8031c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8031d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8031e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8031f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803200:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803210:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803220:	3a 20 00 69 70 63 5f 73 65 6e 64 3a 20 66 61 69     : .ipc_send: fai
+  803230:	6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62 2f     led to send.lib/
+  803240:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803250:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803260:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803270:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803280:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803290:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8032b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803300:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803310:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803320:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803330:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803340:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803350:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803360:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803370:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803380:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803390:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803400:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803410:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803420:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803430:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803440:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803450:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803460:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803470:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803480:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803490:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803500:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803510:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803520:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803530:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803540:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803550:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803560:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803570:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803580:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803590:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803600:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803610:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803620:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803630:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803640:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803650:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803660:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803670:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803680:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803690:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803700:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803710:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803720:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803730:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803740:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803750:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803760:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803770:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803780:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803790:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803800:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
@@ -0,0 +1,6012 @@
+
+obj/user/hugealloc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 58 02 00 00       	call   80027b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+static uint64_t *const table2m = (uint64_t *)0x40000000;
+static uint64_t *const table1g = (uint64_t *)0x80000000;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_alloc_region(0, table2m, REGION_2M, PROT_RW | ALLOC_HUGE_2M);
+  800029:	b9 06 10 00 00       	mov    $0x1006,%ecx
+  80002e:	ba 00 00 80 00       	mov    $0x800000,%edx
+  800033:	be 00 00 00 40       	mov    $0x40000000,%esi
+  800038:	bf 00 00 00 00       	mov    $0x0,%edi
+  80003d:	48 b8 6a 13 80 00 00 	movabs $0x80136a,%rax
+  800044:	00 00 00 
+  800047:	ff d0                	call   *%rax
+    if (res < 0) panic("sys_alloc_region(ALLOC_HUGE_2M): %i", res);
+  800049:	85 c0                	test   %eax,%eax
+  80004b:	0f 88 0a 01 00 00    	js     80015b <umain+0x136>
+  800051:	ba 00 00 00 40       	mov    $0x40000000,%edx
+
+    for (size_t i = 0; i < REGION_2M / sizeof(*table2m); i++) {
+  800056:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (table2m[i]) panic("table2m[%zu] is not zero", i);
+  80005b:	48 8b 0a             	mov    (%rdx),%rcx
+  80005e:	48 85 c9             	test   %rcx,%rcx
+  800061:	0f 85 21 01 00 00    	jne    800188 <umain+0x163>
+        table2m[i] = i;
+  800067:	48 89 02             	mov    %rax,(%rdx)
+    for (size_t i = 0; i < REGION_2M / sizeof(*table2m); i++) {
+  80006a:	48 83 c0 01          	add    $0x1,%rax
+  80006e:	48 83 c2 08          	add    $0x8,%rdx
+  800072:	48 3d 00 00 10 00    	cmp    $0x100000,%rax
+  800078:	75 e1                	jne    80005b <umain+0x36>
+  80007a:	b8 00 00 00 40       	mov    $0x40000000,%eax
+    }
+    for (size_t i = 0; i < REGION_2M / sizeof(*table2m); i++)
+        if (table2m[i] != i) panic("table2m[%zu] is corrupted", i);
+  80007f:	48 39 08             	cmp    %rcx,(%rax)
+  800082:	0f 85 2e 01 00 00    	jne    8001b6 <umain+0x191>
+    for (size_t i = 0; i < REGION_2M / sizeof(*table2m); i++)
+  800088:	48 83 c1 01          	add    $0x1,%rcx
+  80008c:	48 83 c0 08          	add    $0x8,%rax
+  800090:	48 81 f9 00 00 10 00 	cmp    $0x100000,%rcx
+  800097:	75 e6                	jne    80007f <umain+0x5a>
+    cprintf("2MB pages: OK\n");
+  800099:	48 bf 58 2e 80 00 00 	movabs $0x802e58,%rdi
+  8000a0:	00 00 00 
+  8000a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a8:	48 ba 95 04 80 00 00 	movabs $0x800495,%rdx
+  8000af:	00 00 00 
+  8000b2:	ff d2                	call   *%rdx
+
+    res = sys_alloc_region(0, (void *)table2m + PAGE_SIZE, HUGE_PAGE_SIZE, PROT_RW | ALLOC_HUGE_2M);
+  8000b4:	b9 06 10 00 00       	mov    $0x1006,%ecx
+  8000b9:	ba 00 00 20 00       	mov    $0x200000,%edx
+  8000be:	be 00 10 00 40       	mov    $0x40001000,%esi
+  8000c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000c8:	48 b8 6a 13 80 00 00 	movabs $0x80136a,%rax
+  8000cf:	00 00 00 
+  8000d2:	ff d0                	call   *%rax
+    if (res != -E_INVAL) panic("misaligned ALLOC_HUGE_2M: %i", res);
+  8000d4:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8000d7:	0f 85 04 01 00 00    	jne    8001e1 <umain+0x1bc>
+
+    res = sys_alloc_region(0, table1g, 1ULL << 30, PROT_RW | ALLOC_HUGE_1G);
+  8000dd:	b9 06 20 00 00       	mov    $0x2006,%ecx
+  8000e2:	ba 00 00 00 40       	mov    $0x40000000,%edx
+  8000e7:	be 00 00 00 80       	mov    $0x80000000,%esi
+  8000ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000f1:	48 b8 6a 13 80 00 00 	movabs $0x80136a,%rax
+  8000f8:	00 00 00 
+  8000fb:	ff d0                	call   *%rax
+    if (res == -E_NOT_SUPP)
+  8000fd:	83 f8 ed             	cmp    $0xffffffed,%eax
+  800100:	0f 84 08 01 00 00    	je     80020e <umain+0x1e9>
+        cprintf("1GB pages: not supported by CPU\n");
+    else if (res == -E_NO_MEM)
+  800106:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  800109:	0f 84 1f 01 00 00    	je     80022e <umain+0x209>
+        cprintf("1GB pages: no free 1GB block (expected with -m 512M)\n");
+    else if (res < 0)
+  80010f:	85 c0                	test   %eax,%eax
+  800111:	0f 88 37 01 00 00    	js     80024e <umain+0x229>
+        panic("sys_alloc_region(ALLOC_HUGE_1G): %i", res);
+    else {
+        table1g[0] = 1;
+  800117:	b8 00 00 00 80       	mov    $0x80000000,%eax
+  80011c:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+        cprintf("1GB pages: OK\n");
+  800123:	48 bf 84 2e 80 00 00 	movabs $0x802e84,%rdi
+  80012a:	00 00 00 
+  80012d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800132:	48 ba 95 04 80 00 00 	movabs $0x800495,%rdx
+  800139:	00 00 00 
+  80013c:	ff d2                	call   *%rdx
+    }
+
+    sys_unmap_region(0, table2m, REGION_2M);
+  80013e:	ba 00 00 80 00       	mov    $0x800000,%edx
+  800143:	be 00 00 00 40       	mov    $0x40000000,%esi
+  800148:	bf 00 00 00 00       	mov    $0x0,%edi
+  80014d:	48 b8 36 14 80 00 00 	movabs $0x801436,%rax
+  800154:	00 00 00 
+  800157:	ff d0                	call   *%rax
+}
+  800159:	5d                   	pop    %rbp
+  80015a:	c3                   	ret
+    if (res < 0) panic("sys_alloc_region(ALLOC_HUGE_2M): %i", res);
+  80015b:	89 c1                	mov    %eax,%ecx
+  80015d:	48 ba 68 2d 80 00 00 	movabs $0x802d68,%rdx
+  800164:	00 00 00 
+  800167:	be 12 00 00 00       	mov    $0x12,%esi
+  80016c:	48 bf 14 2e 80 00 00 	movabs $0x802e14,%rdi
+  800173:	00 00 00 
+  800176:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017b:	49 b8 45 03 80 00 00 	movabs $0x800345,%r8
+  800182:	00 00 00 
+  800185:	41 ff d0             	call   *%r8
+        if (table2m[i]) panic("table2m[%zu] is not zero", i);
+  800188:	48 89 c1             	mov    %rax,%rcx
+  80018b:	48 ba 25 2e 80 00 00 	movabs $0x802e25,%rdx
+  800192:	00 00 00 
+  800195:	be 15 00 00 00       	mov    $0x15,%esi
+  80019a:	48 bf 14 2e 80 00 00 	movabs $0x802e14,%rdi
+  8001a1:	00 00 00 
+  8001a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a9:	49 b8 45 03 80 00 00 	movabs $0x800345,%r8
+  8001b0:	00 00 00 
+  8001b3:	41 ff d0             	call   *%r8
+        if (table2m[i] != i) panic("table2m[%zu] is corrupted", i);
+  8001b6:	48 ba 3e 2e 80 00 00 	movabs $0x802e3e,%rdx
+  8001bd:	00 00 00 
+  8001c0:	be 19 00 00 00       	mov    $0x19,%esi
+  8001c5:	48 bf 14 2e 80 00 00 	movabs $0x802e14,%rdi
+  8001cc:	00 00 00 
+  8001cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d4:	49 b8 45 03 80 00 00 	movabs $0x800345,%r8
+  8001db:	00 00 00 
+  8001de:	41 ff d0             	call   *%r8
+    if (res != -E_INVAL) panic("misaligned ALLOC_HUGE_2M: %i", res);
+  8001e1:	89 c1                	mov    %eax,%ecx
+  8001e3:	48 ba 67 2e 80 00 00 	movabs $0x802e67,%rdx
+  8001ea:	00 00 00 
+  8001ed:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8001f2:	48 bf 14 2e 80 00 00 	movabs $0x802e14,%rdi
+  8001f9:	00 00 00 
+  8001fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800201:	49 b8 45 03 80 00 00 	movabs $0x800345,%r8
+  800208:	00 00 00 
+  80020b:	41 ff d0             	call   *%r8
+        cprintf("1GB pages: not supported by CPU\n");
+  80020e:	48 bf 90 2d 80 00 00 	movabs $0x802d90,%rdi
+  800215:	00 00 00 
+  800218:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021d:	48 ba 95 04 80 00 00 	movabs $0x800495,%rdx
+  800224:	00 00 00 
+  800227:	ff d2                	call   *%rdx
+  800229:	e9 10 ff ff ff       	jmp    80013e <umain+0x119>
+        cprintf("1GB pages: no free 1GB block (expected with -m 512M)\n");
+  80022e:	48 bf b8 2d 80 00 00 	movabs $0x802db8,%rdi
+  800235:	00 00 00 
+  800238:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023d:	48 ba 95 04 80 00 00 	movabs $0x800495,%rdx
+  800244:	00 00 00 
+  800247:	ff d2                	call   *%rdx
+  800249:	e9 f0 fe ff ff       	jmp    80013e <umain+0x119>
+        panic("sys_alloc_region(ALLOC_HUGE_1G): %i", res);
+  80024e:	89 c1                	mov    %eax,%ecx
+  800250:	48 ba f0 2d 80 00 00 	movabs $0x802df0,%rdx
+  800257:	00 00 00 
+  80025a:	be 25 00 00 00       	mov    $0x25,%esi
+  80025f:	48 bf 14 2e 80 00 00 	movabs $0x802e14,%rdi
+  800266:	00 00 00 
+  800269:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026e:	49 b8 45 03 80 00 00 	movabs $0x800345,%r8
+  800275:	00 00 00 
+  800278:	41 ff d0             	call   *%r8
+
+000000000080027b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80027b:	55                   	push   %rbp
+  80027c:	48 89 e5             	mov    %rsp,%rbp
+  80027f:	41 56                	push   %r14
+  800281:	41 55                	push   %r13
+  800283:	41 54                	push   %r12
+  800285:	53                   	push   %rbx
+  800286:	41 89 fd             	mov    %edi,%r13d
+  800289:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80028c:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800293:	00 00 00 
+  800296:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80029d:	00 00 00 
+  8002a0:	48 39 c2             	cmp    %rax,%rdx
+  8002a3:	73 17                	jae    8002bc <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8002a5:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002a8:	49 89 c4             	mov    %rax,%r12
+  8002ab:	48 83 c3 08          	add    $0x8,%rbx
+  8002af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b4:	ff 53 f8             	call   *-0x8(%rbx)
+  8002b7:	4c 39 e3             	cmp    %r12,%rbx
+  8002ba:	72 ef                	jb     8002ab <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8002bc:	48 b8 aa 12 80 00 00 	movabs $0x8012aa,%rax
+  8002c3:	00 00 00 
+  8002c6:	ff d0                	call   *%rax
+  8002c8:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8002cb:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8002d2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8002d9:	00 00 00 
+  8002dc:	48 01 d0             	add    %rdx,%rax
+  8002df:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8002e6:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002e9:	45 85 ed             	test   %r13d,%r13d
+  8002ec:	7e 0d                	jle    8002fb <libmain+0x80>
+  8002ee:	49 8b 06             	mov    (%r14),%rax
+  8002f1:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8002f8:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002fb:	4c 89 f6             	mov    %r14,%rsi
+  8002fe:	44 89 ef             	mov    %r13d,%edi
+  800301:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800308:	00 00 00 
+  80030b:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80030d:	48 b8 22 03 80 00 00 	movabs $0x800322,%rax
+  800314:	00 00 00 
+  800317:	ff d0                	call   *%rax
+#endif
+}
+  800319:	5b                   	pop    %rbx
+  80031a:	41 5c                	pop    %r12
+  80031c:	41 5d                	pop    %r13
+  80031e:	41 5e                	pop    %r14
+  800320:	5d                   	pop    %rbp
+  800321:	c3                   	ret
+
+0000000000800322 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800322:	55                   	push   %rbp
+  800323:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800326:	48 b8 32 1b 80 00 00 	movabs $0x801b32,%rax
+  80032d:	00 00 00 
+  800330:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800332:	bf 00 00 00 00       	mov    $0x0,%edi
+  800337:	48 b8 3f 12 80 00 00 	movabs $0x80123f,%rax
+  80033e:	00 00 00 
+  800341:	ff d0                	call   *%rax
+}
+  800343:	5d                   	pop    %rbp
+  800344:	c3                   	ret
+
+0000000000800345 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800345:	55                   	push   %rbp
+  800346:	48 89 e5             	mov    %rsp,%rbp
+  800349:	41 56                	push   %r14
+  80034b:	41 55                	push   %r13
+  80034d:	41 54                	push   %r12
+  80034f:	53                   	push   %rbx
+  800350:	48 83 ec 50          	sub    $0x50,%rsp
+  800354:	49 89 fc             	mov    %rdi,%r12
+  800357:	41 89 f5             	mov    %esi,%r13d
+  80035a:	48 89 d3             	mov    %rdx,%rbx
+  80035d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800361:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800365:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800369:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800370:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800374:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800378:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80037c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800380:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800387:	00 00 00 
+  80038a:	4c 8b 30             	mov    (%rax),%r14
+  80038d:	48 b8 aa 12 80 00 00 	movabs $0x8012aa,%rax
+  800394:	00 00 00 
+  800397:	ff d0                	call   *%rax
+  800399:	89 c6                	mov    %eax,%esi
+  80039b:	45 89 e8             	mov    %r13d,%r8d
+  80039e:	4c 89 e1             	mov    %r12,%rcx
+  8003a1:	4c 89 f2             	mov    %r14,%rdx
+  8003a4:	48 bf a0 2e 80 00 00 	movabs $0x802ea0,%rdi
+  8003ab:	00 00 00 
+  8003ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b3:	49 bc 95 04 80 00 00 	movabs $0x800495,%r12
+  8003ba:	00 00 00 
+  8003bd:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8003c0:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8003c4:	48 89 df             	mov    %rbx,%rdi
+  8003c7:	48 b8 31 04 80 00 00 	movabs $0x800431,%rax
+  8003ce:	00 00 00 
+  8003d1:	ff d0                	call   *%rax
+    cprintf("\n");
+  8003d3:	48 bf 91 2e 80 00 00 	movabs $0x802e91,%rdi
+  8003da:	00 00 00 
+  8003dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e2:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003e5:	cc                   	int3
+  8003e6:	eb fd                	jmp    8003e5 <_panic+0xa0>
+
+00000000008003e8 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003e8:	55                   	push   %rbp
+  8003e9:	48 89 e5             	mov    %rsp,%rbp
+  8003ec:	53                   	push   %rbx
+  8003ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8003f1:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003f4:	8b 06                	mov    (%rsi),%eax
+  8003f6:	8d 50 01             	lea    0x1(%rax),%edx
+  8003f9:	89 16                	mov    %edx,(%rsi)
+  8003fb:	48 98                	cltq
+  8003fd:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800402:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800408:	74 0a                	je     800414 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80040a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80040e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800412:	c9                   	leave
+  800413:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800414:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800418:	be ff 00 00 00       	mov    $0xff,%esi
+  80041d:	48 b8 e1 11 80 00 00 	movabs $0x8011e1,%rax
+  800424:	00 00 00 
+  800427:	ff d0                	call   *%rax
+        state->offset = 0;
+  800429:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80042f:	eb d9                	jmp    80040a <putch+0x22>
+
+0000000000800431 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800431:	55                   	push   %rbp
+  800432:	48 89 e5             	mov    %rsp,%rbp
+  800435:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80043c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80043f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800446:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80044b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800450:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800453:	48 89 f1             	mov    %rsi,%rcx
+  800456:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80045d:	48 bf e8 03 80 00 00 	movabs $0x8003e8,%rdi
+  800464:	00 00 00 
+  800467:	48 b8 e5 05 80 00 00 	movabs $0x8005e5,%rax
+  80046e:	00 00 00 
+  800471:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800473:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80047a:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800481:	48 b8 e1 11 80 00 00 	movabs $0x8011e1,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80048d:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800493:	c9                   	leave
+  800494:	c3                   	ret
+
+0000000000800495 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800495:	55                   	push   %rbp
+  800496:	48 89 e5             	mov    %rsp,%rbp
+  800499:	48 83 ec 50          	sub    $0x50,%rsp
+  80049d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004a1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004a5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004a9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004ad:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8004b1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8004b8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004c0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004c4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8004c8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8004cc:	48 b8 31 04 80 00 00 	movabs $0x800431,%rax
+  8004d3:	00 00 00 
+  8004d6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8004d8:	c9                   	leave
+  8004d9:	c3                   	ret
+
+00000000008004da <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8004da:	55                   	push   %rbp
+  8004db:	48 89 e5             	mov    %rsp,%rbp
+  8004de:	41 57                	push   %r15
+  8004e0:	41 56                	push   %r14
+  8004e2:	41 55                	push   %r13
+  8004e4:	41 54                	push   %r12
+  8004e6:	53                   	push   %rbx
+  8004e7:	48 83 ec 18          	sub    $0x18,%rsp
+  8004eb:	49 89 fc             	mov    %rdi,%r12
+  8004ee:	49 89 f5             	mov    %rsi,%r13
+  8004f1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004f5:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004f8:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8004fb:	41 89 cf             	mov    %ecx,%r15d
+  8004fe:	4c 39 fa             	cmp    %r15,%rdx
+  800501:	73 5b                	jae    80055e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800503:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800507:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80050b:	85 db                	test   %ebx,%ebx
+  80050d:	7e 0e                	jle    80051d <print_num+0x43>
+            putch(padc, put_arg);
+  80050f:	4c 89 ee             	mov    %r13,%rsi
+  800512:	44 89 f7             	mov    %r14d,%edi
+  800515:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800518:	83 eb 01             	sub    $0x1,%ebx
+  80051b:	75 f2                	jne    80050f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80051d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800521:	48 b9 d4 2e 80 00 00 	movabs $0x802ed4,%rcx
+  800528:	00 00 00 
+  80052b:	48 b8 c3 2e 80 00 00 	movabs $0x802ec3,%rax
+  800532:	00 00 00 
+  800535:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800539:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80053d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800542:	49 f7 f7             	div    %r15
+  800545:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800549:	4c 89 ee             	mov    %r13,%rsi
+  80054c:	41 ff d4             	call   *%r12
+}
+  80054f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800553:	5b                   	pop    %rbx
+  800554:	41 5c                	pop    %r12
+  800556:	41 5d                	pop    %r13
+  800558:	41 5e                	pop    %r14
+  80055a:	41 5f                	pop    %r15
+  80055c:	5d                   	pop    %rbp
+  80055d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80055e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800562:	ba 00 00 00 00       	mov    $0x0,%edx
+  800567:	49 f7 f7             	div    %r15
+  80056a:	48 83 ec 08          	sub    $0x8,%rsp
+  80056e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800572:	52                   	push   %rdx
+  800573:	45 0f be c9          	movsbl %r9b,%r9d
+  800577:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80057b:	48 89 c2             	mov    %rax,%rdx
+  80057e:	48 b8 da 04 80 00 00 	movabs $0x8004da,%rax
+  800585:	00 00 00 
+  800588:	ff d0                	call   *%rax
+  80058a:	48 83 c4 10          	add    $0x10,%rsp
+  80058e:	eb 8d                	jmp    80051d <print_num+0x43>
+
+0000000000800590 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800590:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800594:	48 8b 06             	mov    (%rsi),%rax
+  800597:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80059b:	73 0a                	jae    8005a7 <sprintputch+0x17>
+        *state->start++ = ch;
+  80059d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8005a1:	48 89 16             	mov    %rdx,(%rsi)
+  8005a4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8005a7:	c3                   	ret
+
+00000000008005a8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8005a8:	55                   	push   %rbp
+  8005a9:	48 89 e5             	mov    %rsp,%rbp
+  8005ac:	48 83 ec 50          	sub    $0x50,%rsp
+  8005b0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005b4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005b8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8005bc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8005c3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005cb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005cf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8005d3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8005d7:	48 b8 e5 05 80 00 00 	movabs $0x8005e5,%rax
+  8005de:	00 00 00 
+  8005e1:	ff d0                	call   *%rax
+}
+  8005e3:	c9                   	leave
+  8005e4:	c3                   	ret
+
+00000000008005e5 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005e5:	55                   	push   %rbp
+  8005e6:	48 89 e5             	mov    %rsp,%rbp
+  8005e9:	41 57                	push   %r15
+  8005eb:	41 56                	push   %r14
+  8005ed:	41 55                	push   %r13
+  8005ef:	41 54                	push   %r12
+  8005f1:	53                   	push   %rbx
+  8005f2:	48 83 ec 38          	sub    $0x38,%rsp
+  8005f6:	49 89 fe             	mov    %rdi,%r14
+  8005f9:	49 89 f5             	mov    %rsi,%r13
+  8005fc:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8005ff:	48 8b 01             	mov    (%rcx),%rax
+  800602:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800606:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80060a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80060e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800612:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800616:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80061a:	0f b6 3b             	movzbl (%rbx),%edi
+  80061d:	40 80 ff 25          	cmp    $0x25,%dil
+  800621:	74 18                	je     80063b <vprintfmt+0x56>
+            if (!ch) return;
+  800623:	40 84 ff             	test   %dil,%dil
+  800626:	0f 84 b1 06 00 00    	je     800cdd <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80062c:	40 0f b6 ff          	movzbl %dil,%edi
+  800630:	4c 89 ee             	mov    %r13,%rsi
+  800633:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800636:	4c 89 e3             	mov    %r12,%rbx
+  800639:	eb db                	jmp    800616 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80063b:	be 00 00 00 00       	mov    $0x0,%esi
+  800640:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800644:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800649:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80064f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800656:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80065a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80065f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800664:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800667:	83 e8 23             	sub    $0x23,%eax
+  80066a:	3c 57                	cmp    $0x57,%al
+  80066c:	0f 87 51 06 00 00    	ja     800cc3 <vprintfmt+0x6de>
+  800672:	0f b6 c0             	movzbl %al,%eax
+  800675:	48 b9 80 30 80 00 00 	movabs $0x803080,%rcx
+  80067c:	00 00 00 
+  80067f:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800682:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800685:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800689:	eb cf                	jmp    80065a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80068b:	49 89 dc             	mov    %rbx,%r12
+  80068e:	be 01 00 00 00       	mov    $0x1,%esi
+  800693:	eb c5                	jmp    80065a <vprintfmt+0x75>
+            padc = ch;
+  800695:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800699:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80069c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80069f:	eb b9                	jmp    80065a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a7:	77 24                	ja     8006cd <vprintfmt+0xe8>
+  8006a9:	89 c1                	mov    %eax,%ecx
+  8006ab:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8006af:	83 c0 08             	add    $0x8,%eax
+  8006b2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b5:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8006b8:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8006bb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006bf:	79 99                	jns    80065a <vprintfmt+0x75>
+                width = precision;
+  8006c1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8006c5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006cb:	eb 8d                	jmp    80065a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006cd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8006d1:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8006d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d9:	eb da                	jmp    8006b5 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8006db:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006e0:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006e4:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006ea:	3c 39                	cmp    $0x39,%al
+  8006ec:	77 1c                	ja     80070a <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006ee:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006f2:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006f6:	0f b6 c0             	movzbl %al,%eax
+  8006f9:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006fe:	0f b6 03             	movzbl (%rbx),%eax
+  800701:	3c 39                	cmp    $0x39,%al
+  800703:	76 e9                	jbe    8006ee <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800705:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800708:	eb b1                	jmp    8006bb <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80070a:	49 89 dc             	mov    %rbx,%r12
+  80070d:	eb ac                	jmp    8006bb <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80070f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800712:	85 c9                	test   %ecx,%ecx
+  800714:	b8 00 00 00 00       	mov    $0x0,%eax
+  800719:	0f 49 c1             	cmovns %ecx,%eax
+  80071c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80071f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800722:	e9 33 ff ff ff       	jmp    80065a <vprintfmt+0x75>
+            lflag++;
+  800727:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80072a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80072d:	e9 28 ff ff ff       	jmp    80065a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800732:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800735:	83 f8 2f             	cmp    $0x2f,%eax
+  800738:	77 19                	ja     800753 <vprintfmt+0x16e>
+  80073a:	89 c2                	mov    %eax,%edx
+  80073c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800740:	83 c0 08             	add    $0x8,%eax
+  800743:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800746:	8b 3a                	mov    (%rdx),%edi
+  800748:	4c 89 ee             	mov    %r13,%rsi
+  80074b:	41 ff d6             	call   *%r14
+            break;
+  80074e:	e9 c3 fe ff ff       	jmp    800616 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800753:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800757:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80075b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075f:	eb e5                	jmp    800746 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800761:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800764:	83 f8 2f             	cmp    $0x2f,%eax
+  800767:	77 5a                	ja     8007c3 <vprintfmt+0x1de>
+  800769:	89 c2                	mov    %eax,%edx
+  80076b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076f:	83 c0 08             	add    $0x8,%eax
+  800772:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800775:	8b 02                	mov    (%rdx),%eax
+  800777:	89 c1                	mov    %eax,%ecx
+  800779:	f7 d9                	neg    %ecx
+  80077b:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80077e:	83 f9 15             	cmp    $0x15,%ecx
+  800781:	7f 4e                	jg     8007d1 <vprintfmt+0x1ec>
+  800783:	48 63 c1             	movslq %ecx,%rax
+  800786:	48 ba 40 33 80 00 00 	movabs $0x803340,%rdx
+  80078d:	00 00 00 
+  800790:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800794:	48 85 c0             	test   %rax,%rax
+  800797:	74 38                	je     8007d1 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800799:	48 89 c1             	mov    %rax,%rcx
+  80079c:	48 ba f9 34 80 00 00 	movabs $0x8034f9,%rdx
+  8007a3:	00 00 00 
+  8007a6:	4c 89 ee             	mov    %r13,%rsi
+  8007a9:	4c 89 f7             	mov    %r14,%rdi
+  8007ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b1:	49 b8 a8 05 80 00 00 	movabs $0x8005a8,%r8
+  8007b8:	00 00 00 
+  8007bb:	41 ff d0             	call   *%r8
+  8007be:	e9 53 fe ff ff       	jmp    800616 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8007c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007cf:	eb a4                	jmp    800775 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8007d1:	48 ba ec 2e 80 00 00 	movabs $0x802eec,%rdx
+  8007d8:	00 00 00 
+  8007db:	4c 89 ee             	mov    %r13,%rsi
+  8007de:	4c 89 f7             	mov    %r14,%rdi
+  8007e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e6:	49 b8 a8 05 80 00 00 	movabs $0x8005a8,%r8
+  8007ed:	00 00 00 
+  8007f0:	41 ff d0             	call   *%r8
+  8007f3:	e9 1e fe ff ff       	jmp    800616 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fe:	77 6c                	ja     80086c <vprintfmt+0x287>
+  800800:	89 c2                	mov    %eax,%edx
+  800802:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800806:	83 c0 08             	add    $0x8,%eax
+  800809:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080c:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80080f:	48 85 d2             	test   %rdx,%rdx
+  800812:	48 b8 e5 2e 80 00 00 	movabs $0x802ee5,%rax
+  800819:	00 00 00 
+  80081c:	48 0f 45 c2          	cmovne %rdx,%rax
+  800820:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800824:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800828:	7e 06                	jle    800830 <vprintfmt+0x24b>
+  80082a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80082e:	75 4a                	jne    80087a <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800830:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800834:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800838:	0f b6 00             	movzbl (%rax),%eax
+  80083b:	84 c0                	test   %al,%al
+  80083d:	0f 85 9a 00 00 00    	jne    8008dd <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800843:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800846:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80084a:	85 c0                	test   %eax,%eax
+  80084c:	0f 8e c4 fd ff ff    	jle    800616 <vprintfmt+0x31>
+  800852:	4c 89 ee             	mov    %r13,%rsi
+  800855:	bf 20 00 00 00       	mov    $0x20,%edi
+  80085a:	41 ff d6             	call   *%r14
+  80085d:	41 83 ec 01          	sub    $0x1,%r12d
+  800861:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800865:	75 eb                	jne    800852 <vprintfmt+0x26d>
+  800867:	e9 aa fd ff ff       	jmp    800616 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80086c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800870:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800874:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800878:	eb 92                	jmp    80080c <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80087a:	49 63 f7             	movslq %r15d,%rsi
+  80087d:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800881:	48 b8 97 0d 80 00 00 	movabs $0x800d97,%rax
+  800888:	00 00 00 
+  80088b:	ff d0                	call   *%rax
+  80088d:	48 89 c2             	mov    %rax,%rdx
+  800890:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800893:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800895:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800898:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80089b:	85 c0                	test   %eax,%eax
+  80089d:	7e 91                	jle    800830 <vprintfmt+0x24b>
+  80089f:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8008a4:	4c 89 ee             	mov    %r13,%rsi
+  8008a7:	44 89 e7             	mov    %r12d,%edi
+  8008aa:	41 ff d6             	call   *%r14
+  8008ad:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008b1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008b4:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8008b7:	75 eb                	jne    8008a4 <vprintfmt+0x2bf>
+  8008b9:	e9 72 ff ff ff       	jmp    800830 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008be:	0f b6 f8             	movzbl %al,%edi
+  8008c1:	4c 89 ee             	mov    %r13,%rsi
+  8008c4:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008c7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008cb:	49 83 c4 01          	add    $0x1,%r12
+  8008cf:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8008d5:	84 c0                	test   %al,%al
+  8008d7:	0f 84 66 ff ff ff    	je     800843 <vprintfmt+0x25e>
+  8008dd:	45 85 ff             	test   %r15d,%r15d
+  8008e0:	78 0a                	js     8008ec <vprintfmt+0x307>
+  8008e2:	41 83 ef 01          	sub    $0x1,%r15d
+  8008e6:	0f 88 57 ff ff ff    	js     800843 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008ec:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008f0:	74 cc                	je     8008be <vprintfmt+0x2d9>
+  8008f2:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008f5:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008fa:	80 fa 5e             	cmp    $0x5e,%dl
+  8008fd:	77 c2                	ja     8008c1 <vprintfmt+0x2dc>
+  8008ff:	eb bd                	jmp    8008be <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800901:	40 84 f6             	test   %sil,%sil
+  800904:	75 26                	jne    80092c <vprintfmt+0x347>
+    switch (lflag) {
+  800906:	85 d2                	test   %edx,%edx
+  800908:	74 59                	je     800963 <vprintfmt+0x37e>
+  80090a:	83 fa 01             	cmp    $0x1,%edx
+  80090d:	74 7b                	je     80098a <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80090f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800912:	83 f8 2f             	cmp    $0x2f,%eax
+  800915:	0f 87 96 00 00 00    	ja     8009b1 <vprintfmt+0x3cc>
+  80091b:	89 c2                	mov    %eax,%edx
+  80091d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800921:	83 c0 08             	add    $0x8,%eax
+  800924:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800927:	4c 8b 22             	mov    (%rdx),%r12
+  80092a:	eb 17                	jmp    800943 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80092c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092f:	83 f8 2f             	cmp    $0x2f,%eax
+  800932:	77 21                	ja     800955 <vprintfmt+0x370>
+  800934:	89 c2                	mov    %eax,%edx
+  800936:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093a:	83 c0 08             	add    $0x8,%eax
+  80093d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800940:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800943:	4d 85 e4             	test   %r12,%r12
+  800946:	78 7a                	js     8009c2 <vprintfmt+0x3dd>
+            num = i;
+  800948:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80094b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800950:	e9 50 02 00 00       	jmp    800ba5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800955:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800959:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800961:	eb dd                	jmp    800940 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800963:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800966:	83 f8 2f             	cmp    $0x2f,%eax
+  800969:	77 11                	ja     80097c <vprintfmt+0x397>
+  80096b:	89 c2                	mov    %eax,%edx
+  80096d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800971:	83 c0 08             	add    $0x8,%eax
+  800974:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800977:	4c 63 22             	movslq (%rdx),%r12
+  80097a:	eb c7                	jmp    800943 <vprintfmt+0x35e>
+  80097c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800980:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800984:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800988:	eb ed                	jmp    800977 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80098a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098d:	83 f8 2f             	cmp    $0x2f,%eax
+  800990:	77 11                	ja     8009a3 <vprintfmt+0x3be>
+  800992:	89 c2                	mov    %eax,%edx
+  800994:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800998:	83 c0 08             	add    $0x8,%eax
+  80099b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099e:	4c 8b 22             	mov    (%rdx),%r12
+  8009a1:	eb a0                	jmp    800943 <vprintfmt+0x35e>
+  8009a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009af:	eb ed                	jmp    80099e <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8009b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bd:	e9 65 ff ff ff       	jmp    800927 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8009c2:	4c 89 ee             	mov    %r13,%rsi
+  8009c5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009ca:	41 ff d6             	call   *%r14
+                i = -i;
+  8009cd:	49 f7 dc             	neg    %r12
+  8009d0:	e9 73 ff ff ff       	jmp    800948 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d5:	40 84 f6             	test   %sil,%sil
+  8009d8:	75 32                	jne    800a0c <vprintfmt+0x427>
+    switch (lflag) {
+  8009da:	85 d2                	test   %edx,%edx
+  8009dc:	74 5d                	je     800a3b <vprintfmt+0x456>
+  8009de:	83 fa 01             	cmp    $0x1,%edx
+  8009e1:	0f 84 82 00 00 00    	je     800a69 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8009e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ed:	0f 87 a5 00 00 00    	ja     800a98 <vprintfmt+0x4b3>
+  8009f3:	89 c2                	mov    %eax,%edx
+  8009f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f9:	83 c0 08             	add    $0x8,%eax
+  8009fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ff:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a02:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a07:	e9 99 01 00 00       	jmp    800ba5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a12:	77 19                	ja     800a2d <vprintfmt+0x448>
+  800a14:	89 c2                	mov    %eax,%edx
+  800a16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1a:	83 c0 08             	add    $0x8,%eax
+  800a1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a20:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a23:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a28:	e9 78 01 00 00       	jmp    800ba5 <vprintfmt+0x5c0>
+  800a2d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a31:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a35:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a39:	eb e5                	jmp    800a20 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a3e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a41:	77 18                	ja     800a5b <vprintfmt+0x476>
+  800a43:	89 c2                	mov    %eax,%edx
+  800a45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a49:	83 c0 08             	add    $0x8,%eax
+  800a4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a51:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a56:	e9 4a 01 00 00       	jmp    800ba5 <vprintfmt+0x5c0>
+  800a5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a67:	eb e6                	jmp    800a4f <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6f:	77 19                	ja     800a8a <vprintfmt+0x4a5>
+  800a71:	89 c2                	mov    %eax,%edx
+  800a73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a77:	83 c0 08             	add    $0x8,%eax
+  800a7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a80:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a85:	e9 1b 01 00 00       	jmp    800ba5 <vprintfmt+0x5c0>
+  800a8a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a96:	eb e5                	jmp    800a7d <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa4:	e9 56 ff ff ff       	jmp    8009ff <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa9:	40 84 f6             	test   %sil,%sil
+  800aac:	75 2e                	jne    800adc <vprintfmt+0x4f7>
+    switch (lflag) {
+  800aae:	85 d2                	test   %edx,%edx
+  800ab0:	74 59                	je     800b0b <vprintfmt+0x526>
+  800ab2:	83 fa 01             	cmp    $0x1,%edx
+  800ab5:	74 7f                	je     800b36 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800ab7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aba:	83 f8 2f             	cmp    $0x2f,%eax
+  800abd:	0f 87 9f 00 00 00    	ja     800b62 <vprintfmt+0x57d>
+  800ac3:	89 c2                	mov    %eax,%edx
+  800ac5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac9:	83 c0 08             	add    $0x8,%eax
+  800acc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800acf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ad2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ad7:	e9 c9 00 00 00       	jmp    800ba5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800adc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800adf:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae2:	77 19                	ja     800afd <vprintfmt+0x518>
+  800ae4:	89 c2                	mov    %eax,%edx
+  800ae6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aea:	83 c0 08             	add    $0x8,%eax
+  800aed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800af3:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800af8:	e9 a8 00 00 00       	jmp    800ba5 <vprintfmt+0x5c0>
+  800afd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b01:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b09:	eb e5                	jmp    800af0 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b11:	77 15                	ja     800b28 <vprintfmt+0x543>
+  800b13:	89 c2                	mov    %eax,%edx
+  800b15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b19:	83 c0 08             	add    $0x8,%eax
+  800b1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1f:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b21:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b26:	eb 7d                	jmp    800ba5 <vprintfmt+0x5c0>
+  800b28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b34:	eb e9                	jmp    800b1f <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b39:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3c:	77 16                	ja     800b54 <vprintfmt+0x56f>
+  800b3e:	89 c2                	mov    %eax,%edx
+  800b40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b44:	83 c0 08             	add    $0x8,%eax
+  800b47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b4d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b52:	eb 51                	jmp    800ba5 <vprintfmt+0x5c0>
+  800b54:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b58:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b60:	eb e8                	jmp    800b4a <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b62:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b66:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6e:	e9 5c ff ff ff       	jmp    800acf <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b73:	4c 89 ee             	mov    %r13,%rsi
+  800b76:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b7b:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b7e:	4c 89 ee             	mov    %r13,%rsi
+  800b81:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b86:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b89:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8f:	77 47                	ja     800bd8 <vprintfmt+0x5f3>
+  800b91:	89 c2                	mov    %eax,%edx
+  800b93:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b97:	83 c0 08             	add    $0x8,%eax
+  800b9a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b9d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ba0:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ba5:	48 83 ec 08          	sub    $0x8,%rsp
+  800ba9:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800bad:	0f 94 c0             	sete   %al
+  800bb0:	0f b6 c0             	movzbl %al,%eax
+  800bb3:	50                   	push   %rax
+  800bb4:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800bb9:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800bbd:	4c 89 ee             	mov    %r13,%rsi
+  800bc0:	4c 89 f7             	mov    %r14,%rdi
+  800bc3:	48 b8 da 04 80 00 00 	movabs $0x8004da,%rax
+  800bca:	00 00 00 
+  800bcd:	ff d0                	call   *%rax
+            break;
+  800bcf:	48 83 c4 10          	add    $0x10,%rsp
+  800bd3:	e9 3e fa ff ff       	jmp    800616 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800bd8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bdc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be4:	eb b7                	jmp    800b9d <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800be6:	40 84 f6             	test   %sil,%sil
+  800be9:	75 2b                	jne    800c16 <vprintfmt+0x631>
+    switch (lflag) {
+  800beb:	85 d2                	test   %edx,%edx
+  800bed:	74 56                	je     800c45 <vprintfmt+0x660>
+  800bef:	83 fa 01             	cmp    $0x1,%edx
+  800bf2:	74 7f                	je     800c73 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800bf4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf7:	83 f8 2f             	cmp    $0x2f,%eax
+  800bfa:	0f 87 a2 00 00 00    	ja     800ca2 <vprintfmt+0x6bd>
+  800c00:	89 c2                	mov    %eax,%edx
+  800c02:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c06:	83 c0 08             	add    $0x8,%eax
+  800c09:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c0c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c0f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c14:	eb 8f                	jmp    800ba5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c16:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c19:	83 f8 2f             	cmp    $0x2f,%eax
+  800c1c:	77 19                	ja     800c37 <vprintfmt+0x652>
+  800c1e:	89 c2                	mov    %eax,%edx
+  800c20:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c24:	83 c0 08             	add    $0x8,%eax
+  800c27:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c2a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c2d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c32:	e9 6e ff ff ff       	jmp    800ba5 <vprintfmt+0x5c0>
+  800c37:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c3b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c3f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c43:	eb e5                	jmp    800c2a <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c48:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4b:	77 18                	ja     800c65 <vprintfmt+0x680>
+  800c4d:	89 c2                	mov    %eax,%edx
+  800c4f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c53:	83 c0 08             	add    $0x8,%eax
+  800c56:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c59:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c5b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c60:	e9 40 ff ff ff       	jmp    800ba5 <vprintfmt+0x5c0>
+  800c65:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c69:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c6d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c71:	eb e6                	jmp    800c59 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c76:	83 f8 2f             	cmp    $0x2f,%eax
+  800c79:	77 19                	ja     800c94 <vprintfmt+0x6af>
+  800c7b:	89 c2                	mov    %eax,%edx
+  800c7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c81:	83 c0 08             	add    $0x8,%eax
+  800c84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c87:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c8a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c8f:	e9 11 ff ff ff       	jmp    800ba5 <vprintfmt+0x5c0>
+  800c94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c98:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca0:	eb e5                	jmp    800c87 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ca2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800caa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cae:	e9 59 ff ff ff       	jmp    800c0c <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800cb3:	4c 89 ee             	mov    %r13,%rsi
+  800cb6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cbb:	41 ff d6             	call   *%r14
+            break;
+  800cbe:	e9 53 f9 ff ff       	jmp    800616 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800cc3:	4c 89 ee             	mov    %r13,%rsi
+  800cc6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ccb:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800cce:	48 83 eb 01          	sub    $0x1,%rbx
+  800cd2:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800cd6:	75 f6                	jne    800cce <vprintfmt+0x6e9>
+  800cd8:	e9 39 f9 ff ff       	jmp    800616 <vprintfmt+0x31>
+}
+  800cdd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ce1:	5b                   	pop    %rbx
+  800ce2:	41 5c                	pop    %r12
+  800ce4:	41 5d                	pop    %r13
+  800ce6:	41 5e                	pop    %r14
+  800ce8:	41 5f                	pop    %r15
+  800cea:	5d                   	pop    %rbp
+  800ceb:	c3                   	ret
+
+0000000000800cec <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800cec:	55                   	push   %rbp
+  800ced:	48 89 e5             	mov    %rsp,%rbp
+  800cf0:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800cf4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800cf8:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800cfd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d01:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d08:	48 85 ff             	test   %rdi,%rdi
+  800d0b:	74 2b                	je     800d38 <vsnprintf+0x4c>
+  800d0d:	48 85 f6             	test   %rsi,%rsi
+  800d10:	74 26                	je     800d38 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d12:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d16:	48 bf 90 05 80 00 00 	movabs $0x800590,%rdi
+  800d1d:	00 00 00 
+  800d20:	48 b8 e5 05 80 00 00 	movabs $0x8005e5,%rax
+  800d27:	00 00 00 
+  800d2a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d30:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d33:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d36:	c9                   	leave
+  800d37:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d38:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d3d:	eb f7                	jmp    800d36 <vsnprintf+0x4a>
+
+0000000000800d3f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d3f:	55                   	push   %rbp
+  800d40:	48 89 e5             	mov    %rsp,%rbp
+  800d43:	48 83 ec 50          	sub    $0x50,%rsp
+  800d47:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d4b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d4f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d53:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d5a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d62:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d66:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d6a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d6e:	48 b8 ec 0c 80 00 00 	movabs $0x800cec,%rax
+  800d75:	00 00 00 
+  800d78:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d7a:	c9                   	leave
+  800d7b:	c3                   	ret
+
+0000000000800d7c <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d7c:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d7f:	74 10                	je     800d91 <strlen+0x15>
+    size_t n = 0;
+  800d81:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d86:	48 83 c0 01          	add    $0x1,%rax
+  800d8a:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d8e:	75 f6                	jne    800d86 <strlen+0xa>
+  800d90:	c3                   	ret
+    size_t n = 0;
+  800d91:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d96:	c3                   	ret
+
+0000000000800d97 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d97:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d9a:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d9f:	48 85 f6             	test   %rsi,%rsi
+  800da2:	74 11                	je     800db5 <strnlen+0x1e>
+  800da4:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800da8:	74 0c                	je     800db6 <strnlen+0x1f>
+  800daa:	48 83 c2 01          	add    $0x1,%rdx
+  800dae:	48 39 d0             	cmp    %rdx,%rax
+  800db1:	75 f1                	jne    800da4 <strnlen+0xd>
+  800db3:	eb 04                	jmp    800db9 <strnlen+0x22>
+  800db5:	c3                   	ret
+  800db6:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800db9:	c3                   	ret
+
+0000000000800dba <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800dba:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800dbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc2:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800dc6:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800dc9:	48 83 c2 01          	add    $0x1,%rdx
+  800dcd:	84 c9                	test   %cl,%cl
+  800dcf:	75 f1                	jne    800dc2 <strcpy+0x8>
+        ;
+    return res;
+}
+  800dd1:	c3                   	ret
+
+0000000000800dd2 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800dd2:	55                   	push   %rbp
+  800dd3:	48 89 e5             	mov    %rsp,%rbp
+  800dd6:	41 54                	push   %r12
+  800dd8:	53                   	push   %rbx
+  800dd9:	48 89 fb             	mov    %rdi,%rbx
+  800ddc:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ddf:	48 b8 7c 0d 80 00 00 	movabs $0x800d7c,%rax
+  800de6:	00 00 00 
+  800de9:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800deb:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800def:	4c 89 e6             	mov    %r12,%rsi
+  800df2:	48 b8 ba 0d 80 00 00 	movabs $0x800dba,%rax
+  800df9:	00 00 00 
+  800dfc:	ff d0                	call   *%rax
+    return dst;
+}
+  800dfe:	48 89 d8             	mov    %rbx,%rax
+  800e01:	5b                   	pop    %rbx
+  800e02:	41 5c                	pop    %r12
+  800e04:	5d                   	pop    %rbp
+  800e05:	c3                   	ret
+
+0000000000800e06 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e06:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e09:	48 85 d2             	test   %rdx,%rdx
+  800e0c:	74 1f                	je     800e2d <strncpy+0x27>
+  800e0e:	48 01 fa             	add    %rdi,%rdx
+  800e11:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e14:	48 83 c1 01          	add    $0x1,%rcx
+  800e18:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e1c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e20:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e24:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e28:	48 39 ca             	cmp    %rcx,%rdx
+  800e2b:	75 e7                	jne    800e14 <strncpy+0xe>
+    }
+    return ret;
+}
+  800e2d:	c3                   	ret
+
+0000000000800e2e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e2e:	48 89 f8             	mov    %rdi,%rax
+  800e31:	48 85 d2             	test   %rdx,%rdx
+  800e34:	74 24                	je     800e5a <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e36:	48 83 ea 01          	sub    $0x1,%rdx
+  800e3a:	74 1b                	je     800e57 <strlcpy+0x29>
+  800e3c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e40:	0f b6 16             	movzbl (%rsi),%edx
+  800e43:	84 d2                	test   %dl,%dl
+  800e45:	74 10                	je     800e57 <strlcpy+0x29>
+            *dst++ = *src++;
+  800e47:	48 83 c6 01          	add    $0x1,%rsi
+  800e4b:	48 83 c0 01          	add    $0x1,%rax
+  800e4f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e52:	48 39 c8             	cmp    %rcx,%rax
+  800e55:	75 e9                	jne    800e40 <strlcpy+0x12>
+        *dst = '\0';
+  800e57:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e5a:	48 29 f8             	sub    %rdi,%rax
+}
+  800e5d:	c3                   	ret
+
+0000000000800e5e <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e5e:	0f b6 07             	movzbl (%rdi),%eax
+  800e61:	84 c0                	test   %al,%al
+  800e63:	74 13                	je     800e78 <strcmp+0x1a>
+  800e65:	38 06                	cmp    %al,(%rsi)
+  800e67:	75 0f                	jne    800e78 <strcmp+0x1a>
+  800e69:	48 83 c7 01          	add    $0x1,%rdi
+  800e6d:	48 83 c6 01          	add    $0x1,%rsi
+  800e71:	0f b6 07             	movzbl (%rdi),%eax
+  800e74:	84 c0                	test   %al,%al
+  800e76:	75 ed                	jne    800e65 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e78:	0f b6 c0             	movzbl %al,%eax
+  800e7b:	0f b6 16             	movzbl (%rsi),%edx
+  800e7e:	29 d0                	sub    %edx,%eax
+}
+  800e80:	c3                   	ret
+
+0000000000800e81 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e81:	48 85 d2             	test   %rdx,%rdx
+  800e84:	74 1f                	je     800ea5 <strncmp+0x24>
+  800e86:	0f b6 07             	movzbl (%rdi),%eax
+  800e89:	84 c0                	test   %al,%al
+  800e8b:	74 1e                	je     800eab <strncmp+0x2a>
+  800e8d:	3a 06                	cmp    (%rsi),%al
+  800e8f:	75 1a                	jne    800eab <strncmp+0x2a>
+  800e91:	48 83 c7 01          	add    $0x1,%rdi
+  800e95:	48 83 c6 01          	add    $0x1,%rsi
+  800e99:	48 83 ea 01          	sub    $0x1,%rdx
+  800e9d:	75 e7                	jne    800e86 <strncmp+0x5>
+
+    if (!n) return 0;
+  800e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea4:	c3                   	ret
+  800ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eaa:	c3                   	ret
+  800eab:	48 85 d2             	test   %rdx,%rdx
+  800eae:	74 09                	je     800eb9 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800eb0:	0f b6 07             	movzbl (%rdi),%eax
+  800eb3:	0f b6 16             	movzbl (%rsi),%edx
+  800eb6:	29 d0                	sub    %edx,%eax
+  800eb8:	c3                   	ret
+    if (!n) return 0;
+  800eb9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ebe:	c3                   	ret
+
+0000000000800ebf <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ebf:	0f b6 17             	movzbl (%rdi),%edx
+  800ec2:	84 d2                	test   %dl,%dl
+  800ec4:	74 18                	je     800ede <strchr+0x1f>
+        if (*str == c) {
+  800ec6:	0f be d2             	movsbl %dl,%edx
+  800ec9:	39 f2                	cmp    %esi,%edx
+  800ecb:	74 17                	je     800ee4 <strchr+0x25>
+    for (; *str; str++) {
+  800ecd:	48 83 c7 01          	add    $0x1,%rdi
+  800ed1:	0f b6 17             	movzbl (%rdi),%edx
+  800ed4:	84 d2                	test   %dl,%dl
+  800ed6:	75 ee                	jne    800ec6 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800edd:	c3                   	ret
+  800ede:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee3:	c3                   	ret
+  800ee4:	48 89 f8             	mov    %rdi,%rax
+}
+  800ee7:	c3                   	ret
+
+0000000000800ee8 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800ee8:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800eeb:	0f b6 17             	movzbl (%rdi),%edx
+  800eee:	84 d2                	test   %dl,%dl
+  800ef0:	74 13                	je     800f05 <strfind+0x1d>
+  800ef2:	0f be d2             	movsbl %dl,%edx
+  800ef5:	39 f2                	cmp    %esi,%edx
+  800ef7:	74 0b                	je     800f04 <strfind+0x1c>
+  800ef9:	48 83 c0 01          	add    $0x1,%rax
+  800efd:	0f b6 10             	movzbl (%rax),%edx
+  800f00:	84 d2                	test   %dl,%dl
+  800f02:	75 ee                	jne    800ef2 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f04:	c3                   	ret
+  800f05:	c3                   	ret
+
+0000000000800f06 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f06:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f09:	48 89 f8             	mov    %rdi,%rax
+  800f0c:	48 f7 d8             	neg    %rax
+  800f0f:	83 e0 07             	and    $0x7,%eax
+  800f12:	49 89 d1             	mov    %rdx,%r9
+  800f15:	49 29 c1             	sub    %rax,%r9
+  800f18:	78 36                	js     800f50 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f1a:	40 0f b6 c6          	movzbl %sil,%eax
+  800f1e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f25:	01 01 01 
+  800f28:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f2c:	40 f6 c7 07          	test   $0x7,%dil
+  800f30:	75 38                	jne    800f6a <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f32:	4c 89 c9             	mov    %r9,%rcx
+  800f35:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f39:	74 0c                	je     800f47 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f3b:	fc                   	cld
+  800f3c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f3f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f43:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f47:	4d 85 c9             	test   %r9,%r9
+  800f4a:	75 45                	jne    800f91 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f4c:	4c 89 c0             	mov    %r8,%rax
+  800f4f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f50:	48 85 d2             	test   %rdx,%rdx
+  800f53:	74 f7                	je     800f4c <memset+0x46>
+  800f55:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f58:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f5b:	48 83 c0 01          	add    $0x1,%rax
+  800f5f:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f63:	48 39 c2             	cmp    %rax,%rdx
+  800f66:	75 f3                	jne    800f5b <memset+0x55>
+  800f68:	eb e2                	jmp    800f4c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f6a:	40 f6 c7 01          	test   $0x1,%dil
+  800f6e:	74 06                	je     800f76 <memset+0x70>
+  800f70:	88 07                	mov    %al,(%rdi)
+  800f72:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f76:	40 f6 c7 02          	test   $0x2,%dil
+  800f7a:	74 07                	je     800f83 <memset+0x7d>
+  800f7c:	66 89 07             	mov    %ax,(%rdi)
+  800f7f:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f83:	40 f6 c7 04          	test   $0x4,%dil
+  800f87:	74 a9                	je     800f32 <memset+0x2c>
+  800f89:	89 07                	mov    %eax,(%rdi)
+  800f8b:	48 83 c7 04          	add    $0x4,%rdi
+  800f8f:	eb a1                	jmp    800f32 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f91:	41 f6 c1 04          	test   $0x4,%r9b
+  800f95:	74 06                	je     800f9d <memset+0x97>
+  800f97:	89 07                	mov    %eax,(%rdi)
+  800f99:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f9d:	41 f6 c1 02          	test   $0x2,%r9b
+  800fa1:	74 07                	je     800faa <memset+0xa4>
+  800fa3:	66 89 07             	mov    %ax,(%rdi)
+  800fa6:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800faa:	41 f6 c1 01          	test   $0x1,%r9b
+  800fae:	74 9c                	je     800f4c <memset+0x46>
+  800fb0:	88 07                	mov    %al,(%rdi)
+  800fb2:	eb 98                	jmp    800f4c <memset+0x46>
+
+0000000000800fb4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800fb4:	48 89 f8             	mov    %rdi,%rax
+  800fb7:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800fba:	48 39 fe             	cmp    %rdi,%rsi
+  800fbd:	73 3b                	jae    800ffa <memmove+0x46>
+  800fbf:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800fc3:	48 39 d7             	cmp    %rdx,%rdi
+  800fc6:	73 32                	jae    800ffa <memmove+0x46>
+        s += n;
+        d += n;
+  800fc8:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fcc:	48 89 d6             	mov    %rdx,%rsi
+  800fcf:	48 09 fe             	or     %rdi,%rsi
+  800fd2:	48 09 ce             	or     %rcx,%rsi
+  800fd5:	40 f6 c6 07          	test   $0x7,%sil
+  800fd9:	75 12                	jne    800fed <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fdb:	48 83 ef 08          	sub    $0x8,%rdi
+  800fdf:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fe3:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fe7:	fd                   	std
+  800fe8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800feb:	fc                   	cld
+  800fec:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800fed:	48 83 ef 01          	sub    $0x1,%rdi
+  800ff1:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ff5:	fd                   	std
+  800ff6:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800ff8:	eb f1                	jmp    800feb <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ffa:	48 89 f2             	mov    %rsi,%rdx
+  800ffd:	48 09 c2             	or     %rax,%rdx
+  801000:	48 09 ca             	or     %rcx,%rdx
+  801003:	f6 c2 07             	test   $0x7,%dl
+  801006:	75 0c                	jne    801014 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801008:	48 c1 e9 03          	shr    $0x3,%rcx
+  80100c:	48 89 c7             	mov    %rax,%rdi
+  80100f:	fc                   	cld
+  801010:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801013:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801014:	48 89 c7             	mov    %rax,%rdi
+  801017:	fc                   	cld
+  801018:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80101a:	c3                   	ret
+
+000000000080101b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80101b:	55                   	push   %rbp
+  80101c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80101f:	48 b8 b4 0f 80 00 00 	movabs $0x800fb4,%rax
+  801026:	00 00 00 
+  801029:	ff d0                	call   *%rax
+}
+  80102b:	5d                   	pop    %rbp
+  80102c:	c3                   	ret
+
+000000000080102d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80102d:	55                   	push   %rbp
+  80102e:	48 89 e5             	mov    %rsp,%rbp
+  801031:	41 57                	push   %r15
+  801033:	41 56                	push   %r14
+  801035:	41 55                	push   %r13
+  801037:	41 54                	push   %r12
+  801039:	53                   	push   %rbx
+  80103a:	48 83 ec 08          	sub    $0x8,%rsp
+  80103e:	49 89 fe             	mov    %rdi,%r14
+  801041:	49 89 f7             	mov    %rsi,%r15
+  801044:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801047:	48 89 f7             	mov    %rsi,%rdi
+  80104a:	48 b8 7c 0d 80 00 00 	movabs $0x800d7c,%rax
+  801051:	00 00 00 
+  801054:	ff d0                	call   *%rax
+  801056:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801059:	48 89 de             	mov    %rbx,%rsi
+  80105c:	4c 89 f7             	mov    %r14,%rdi
+  80105f:	48 b8 97 0d 80 00 00 	movabs $0x800d97,%rax
+  801066:	00 00 00 
+  801069:	ff d0                	call   *%rax
+  80106b:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80106e:	48 39 c3             	cmp    %rax,%rbx
+  801071:	74 36                	je     8010a9 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801073:	48 89 d8             	mov    %rbx,%rax
+  801076:	4c 29 e8             	sub    %r13,%rax
+  801079:	49 39 c4             	cmp    %rax,%r12
+  80107c:	73 31                	jae    8010af <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80107e:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801083:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801087:	4c 89 fe             	mov    %r15,%rsi
+  80108a:	48 b8 1b 10 80 00 00 	movabs $0x80101b,%rax
+  801091:	00 00 00 
+  801094:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801096:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80109a:	48 83 c4 08          	add    $0x8,%rsp
+  80109e:	5b                   	pop    %rbx
+  80109f:	41 5c                	pop    %r12
+  8010a1:	41 5d                	pop    %r13
+  8010a3:	41 5e                	pop    %r14
+  8010a5:	41 5f                	pop    %r15
+  8010a7:	5d                   	pop    %rbp
+  8010a8:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010a9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010ad:	eb eb                	jmp    80109a <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8010af:	48 83 eb 01          	sub    $0x1,%rbx
+  8010b3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010b7:	48 89 da             	mov    %rbx,%rdx
+  8010ba:	4c 89 fe             	mov    %r15,%rsi
+  8010bd:	48 b8 1b 10 80 00 00 	movabs $0x80101b,%rax
+  8010c4:	00 00 00 
+  8010c7:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8010c9:	49 01 de             	add    %rbx,%r14
+  8010cc:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8010d1:	eb c3                	jmp    801096 <strlcat+0x69>
+
+00000000008010d3 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8010d3:	48 85 d2             	test   %rdx,%rdx
+  8010d6:	74 2d                	je     801105 <memcmp+0x32>
+  8010d8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010dd:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010e1:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010e6:	44 38 c1             	cmp    %r8b,%cl
+  8010e9:	75 0f                	jne    8010fa <memcmp+0x27>
+    while (n-- > 0) {
+  8010eb:	48 83 c0 01          	add    $0x1,%rax
+  8010ef:	48 39 c2             	cmp    %rax,%rdx
+  8010f2:	75 e9                	jne    8010dd <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f9:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010fa:	0f b6 c1             	movzbl %cl,%eax
+  8010fd:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801101:	44 29 c0             	sub    %r8d,%eax
+  801104:	c3                   	ret
+    return 0;
+  801105:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80110a:	c3                   	ret
+
+000000000080110b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80110b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80110f:	48 39 c7             	cmp    %rax,%rdi
+  801112:	73 0f                	jae    801123 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801114:	40 38 37             	cmp    %sil,(%rdi)
+  801117:	74 0e                	je     801127 <memfind+0x1c>
+    for (; src < end; src++) {
+  801119:	48 83 c7 01          	add    $0x1,%rdi
+  80111d:	48 39 f8             	cmp    %rdi,%rax
+  801120:	75 f2                	jne    801114 <memfind+0x9>
+  801122:	c3                   	ret
+  801123:	48 89 f8             	mov    %rdi,%rax
+  801126:	c3                   	ret
+  801127:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80112a:	c3                   	ret
+
+000000000080112b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80112b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80112e:	0f b6 37             	movzbl (%rdi),%esi
+  801131:	40 80 fe 20          	cmp    $0x20,%sil
+  801135:	74 06                	je     80113d <strtol+0x12>
+  801137:	40 80 fe 09          	cmp    $0x9,%sil
+  80113b:	75 13                	jne    801150 <strtol+0x25>
+  80113d:	48 83 c7 01          	add    $0x1,%rdi
+  801141:	0f b6 37             	movzbl (%rdi),%esi
+  801144:	40 80 fe 20          	cmp    $0x20,%sil
+  801148:	74 f3                	je     80113d <strtol+0x12>
+  80114a:	40 80 fe 09          	cmp    $0x9,%sil
+  80114e:	74 ed                	je     80113d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801150:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801153:	83 e0 fd             	and    $0xfffffffd,%eax
+  801156:	3c 01                	cmp    $0x1,%al
+  801158:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80115c:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801162:	75 0f                	jne    801173 <strtol+0x48>
+  801164:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801167:	74 14                	je     80117d <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801169:	85 d2                	test   %edx,%edx
+  80116b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801170:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801173:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801178:	4c 63 ca             	movslq %edx,%r9
+  80117b:	eb 36                	jmp    8011b3 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80117d:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801181:	74 0f                	je     801192 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801183:	85 d2                	test   %edx,%edx
+  801185:	75 ec                	jne    801173 <strtol+0x48>
+        s++;
+  801187:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80118b:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801190:	eb e1                	jmp    801173 <strtol+0x48>
+        s += 2;
+  801192:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801196:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80119b:	eb d6                	jmp    801173 <strtol+0x48>
+            dig -= '0';
+  80119d:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8011a0:	44 0f b6 c1          	movzbl %cl,%r8d
+  8011a4:	41 39 d0             	cmp    %edx,%r8d
+  8011a7:	7d 21                	jge    8011ca <strtol+0x9f>
+        val = val * base + dig;
+  8011a9:	49 0f af c1          	imul   %r9,%rax
+  8011ad:	0f b6 c9             	movzbl %cl,%ecx
+  8011b0:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8011b3:	48 83 c7 01          	add    $0x1,%rdi
+  8011b7:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8011bb:	80 f9 39             	cmp    $0x39,%cl
+  8011be:	76 dd                	jbe    80119d <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8011c0:	80 f9 7b             	cmp    $0x7b,%cl
+  8011c3:	77 05                	ja     8011ca <strtol+0x9f>
+            dig -= 'a' - 10;
+  8011c5:	83 e9 57             	sub    $0x57,%ecx
+  8011c8:	eb d6                	jmp    8011a0 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8011ca:	4d 85 d2             	test   %r10,%r10
+  8011cd:	74 03                	je     8011d2 <strtol+0xa7>
+  8011cf:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8011d2:	48 89 c2             	mov    %rax,%rdx
+  8011d5:	48 f7 da             	neg    %rdx
+  8011d8:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011dc:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011e0:	c3                   	ret
+
+00000000008011e1 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011e1:	55                   	push   %rbp
+  8011e2:	48 89 e5             	mov    %rsp,%rbp
+  8011e5:	53                   	push   %rbx
+  8011e6:	48 89 fa             	mov    %rdi,%rdx
+  8011e9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ec:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801200:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801206:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801208:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80120c:	c9                   	leave
+  80120d:	c3                   	ret
+
+000000000080120e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80120e:	55                   	push   %rbp
+  80120f:	48 89 e5             	mov    %rsp,%rbp
+  801212:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801213:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801218:	ba 00 00 00 00       	mov    $0x0,%edx
+  80121d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801222:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801227:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80122c:	be 00 00 00 00       	mov    $0x0,%esi
+  801231:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801237:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801239:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80123d:	c9                   	leave
+  80123e:	c3                   	ret
+
+000000000080123f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80123f:	55                   	push   %rbp
+  801240:	48 89 e5             	mov    %rsp,%rbp
+  801243:	53                   	push   %rbx
+  801244:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801248:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80124b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801250:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801255:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80125f:	be 00 00 00 00       	mov    $0x0,%esi
+  801264:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80126a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80126c:	48 85 c0             	test   %rax,%rax
+  80126f:	7f 06                	jg     801277 <sys_env_destroy+0x38>
+}
+  801271:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801275:	c9                   	leave
+  801276:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801277:	49 89 c0             	mov    %rax,%r8
+  80127a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80127f:	48 ba 10 34 80 00 00 	movabs $0x803410,%rdx
+  801286:	00 00 00 
+  801289:	be 26 00 00 00       	mov    $0x26,%esi
+  80128e:	48 bf 2f 34 80 00 00 	movabs $0x80342f,%rdi
+  801295:	00 00 00 
+  801298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129d:	49 b9 45 03 80 00 00 	movabs $0x800345,%r9
+  8012a4:	00 00 00 
+  8012a7:	41 ff d1             	call   *%r9
+
+00000000008012aa <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8012aa:	55                   	push   %rbp
+  8012ab:	48 89 e5             	mov    %rsp,%rbp
+  8012ae:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012af:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d3:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d9:	c9                   	leave
+  8012da:	c3                   	ret
+
+00000000008012db <sys_yield>:
+
+void
+sys_yield(void) {
+  8012db:	55                   	push   %rbp
+  8012dc:	48 89 e5             	mov    %rsp,%rbp
+  8012df:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801304:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801306:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130a:	c9                   	leave
+  80130b:	c3                   	ret
+
+000000000080130c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80130c:	55                   	push   %rbp
+  80130d:	48 89 e5             	mov    %rsp,%rbp
+  801310:	53                   	push   %rbx
+  801311:	48 89 fa             	mov    %rdi,%rdx
+  801314:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801317:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80131c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801323:	00 00 00 
+  801326:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80132b:	be 00 00 00 00       	mov    $0x0,%esi
+  801330:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801336:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801338:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80133c:	c9                   	leave
+  80133d:	c3                   	ret
+
+000000000080133e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80133e:	55                   	push   %rbp
+  80133f:	48 89 e5             	mov    %rsp,%rbp
+  801342:	53                   	push   %rbx
+  801343:	49 89 f8             	mov    %rdi,%r8
+  801346:	48 89 d3             	mov    %rdx,%rbx
+  801349:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80134c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801351:	4c 89 c2             	mov    %r8,%rdx
+  801354:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801357:	be 00 00 00 00       	mov    $0x0,%esi
+  80135c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801362:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801364:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801368:	c9                   	leave
+  801369:	c3                   	ret
+
+000000000080136a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80136a:	55                   	push   %rbp
+  80136b:	48 89 e5             	mov    %rsp,%rbp
+  80136e:	53                   	push   %rbx
+  80136f:	48 83 ec 08          	sub    $0x8,%rsp
+  801373:	89 f8                	mov    %edi,%eax
+  801375:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801378:	48 63 f9             	movslq %ecx,%rdi
+  80137b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80137e:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801383:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801386:	be 00 00 00 00       	mov    $0x0,%esi
+  80138b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801391:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801393:	48 85 c0             	test   %rax,%rax
+  801396:	7f 06                	jg     80139e <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801398:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80139c:	c9                   	leave
+  80139d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80139e:	49 89 c0             	mov    %rax,%r8
+  8013a1:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013a6:	48 ba 10 34 80 00 00 	movabs $0x803410,%rdx
+  8013ad:	00 00 00 
+  8013b0:	be 26 00 00 00       	mov    $0x26,%esi
+  8013b5:	48 bf 2f 34 80 00 00 	movabs $0x80342f,%rdi
+  8013bc:	00 00 00 
+  8013bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c4:	49 b9 45 03 80 00 00 	movabs $0x800345,%r9
+  8013cb:	00 00 00 
+  8013ce:	41 ff d1             	call   *%r9
+
+00000000008013d1 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013d1:	55                   	push   %rbp
+  8013d2:	48 89 e5             	mov    %rsp,%rbp
+  8013d5:	53                   	push   %rbx
+  8013d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8013da:	89 f8                	mov    %edi,%eax
+  8013dc:	49 89 f2             	mov    %rsi,%r10
+  8013df:	48 89 cf             	mov    %rcx,%rdi
+  8013e2:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013e5:	48 63 da             	movslq %edx,%rbx
+  8013e8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013eb:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013f0:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f3:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013f6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013f8:	48 85 c0             	test   %rax,%rax
+  8013fb:	7f 06                	jg     801403 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801401:	c9                   	leave
+  801402:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801403:	49 89 c0             	mov    %rax,%r8
+  801406:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80140b:	48 ba 10 34 80 00 00 	movabs $0x803410,%rdx
+  801412:	00 00 00 
+  801415:	be 26 00 00 00       	mov    $0x26,%esi
+  80141a:	48 bf 2f 34 80 00 00 	movabs $0x80342f,%rdi
+  801421:	00 00 00 
+  801424:	b8 00 00 00 00       	mov    $0x0,%eax
+  801429:	49 b9 45 03 80 00 00 	movabs $0x800345,%r9
+  801430:	00 00 00 
+  801433:	41 ff d1             	call   *%r9
+
+0000000000801436 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801436:	55                   	push   %rbp
+  801437:	48 89 e5             	mov    %rsp,%rbp
+  80143a:	53                   	push   %rbx
+  80143b:	48 83 ec 08          	sub    $0x8,%rsp
+  80143f:	48 89 f1             	mov    %rsi,%rcx
+  801442:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801445:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801448:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80144d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801452:	be 00 00 00 00       	mov    $0x0,%esi
+  801457:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80145d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80145f:	48 85 c0             	test   %rax,%rax
+  801462:	7f 06                	jg     80146a <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801464:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801468:	c9                   	leave
+  801469:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80146a:	49 89 c0             	mov    %rax,%r8
+  80146d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801472:	48 ba 10 34 80 00 00 	movabs $0x803410,%rdx
+  801479:	00 00 00 
+  80147c:	be 26 00 00 00       	mov    $0x26,%esi
+  801481:	48 bf 2f 34 80 00 00 	movabs $0x80342f,%rdi
+  801488:	00 00 00 
+  80148b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801490:	49 b9 45 03 80 00 00 	movabs $0x800345,%r9
+  801497:	00 00 00 
+  80149a:	41 ff d1             	call   *%r9
+
+000000000080149d <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  80149d:	55                   	push   %rbp
+  80149e:	48 89 e5             	mov    %rsp,%rbp
+  8014a1:	53                   	push   %rbx
+  8014a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8014a6:	89 f8                	mov    %edi,%eax
+  8014a8:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8014ab:	48 63 f9             	movslq %ecx,%rdi
+  8014ae:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b1:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014b6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c6:	48 85 c0             	test   %rax,%rax
+  8014c9:	7f 06                	jg     8014d1 <sys_region_advise+0x34>
+}
+  8014cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014cf:	c9                   	leave
+  8014d0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d1:	49 89 c0             	mov    %rax,%r8
+  8014d4:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8014d9:	48 ba 10 34 80 00 00 	movabs $0x803410,%rdx
+  8014e0:	00 00 00 
+  8014e3:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e8:	48 bf 2f 34 80 00 00 	movabs $0x80342f,%rdi
+  8014ef:	00 00 00 
+  8014f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f7:	49 b9 45 03 80 00 00 	movabs $0x800345,%r9
+  8014fe:	00 00 00 
+  801501:	41 ff d1             	call   *%r9
+
+0000000000801504 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801504:	55                   	push   %rbp
+  801505:	48 89 e5             	mov    %rsp,%rbp
+  801508:	53                   	push   %rbx
+  801509:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80150d:	48 63 ce             	movslq %esi,%rcx
+  801510:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801513:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801518:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801522:	be 00 00 00 00       	mov    $0x0,%esi
+  801527:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80152d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80152f:	48 85 c0             	test   %rax,%rax
+  801532:	7f 06                	jg     80153a <sys_env_set_nice+0x36>
+}
+  801534:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801538:	c9                   	leave
+  801539:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80153a:	49 89 c0             	mov    %rax,%r8
+  80153d:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801542:	48 ba 10 34 80 00 00 	movabs $0x803410,%rdx
+  801549:	00 00 00 
+  80154c:	be 26 00 00 00       	mov    $0x26,%esi
+  801551:	48 bf 2f 34 80 00 00 	movabs $0x80342f,%rdi
+  801558:	00 00 00 
+  80155b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801560:	49 b9 45 03 80 00 00 	movabs $0x800345,%r9
+  801567:	00 00 00 
+  80156a:	41 ff d1             	call   *%r9
+
+000000000080156d <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80156d:	55                   	push   %rbp
+  80156e:	48 89 e5             	mov    %rsp,%rbp
+  801571:	53                   	push   %rbx
+  801572:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801576:	48 63 ce             	movslq %esi,%rcx
+  801579:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80157c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801581:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801586:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80158b:	be 00 00 00 00       	mov    $0x0,%esi
+  801590:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801596:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801598:	48 85 c0             	test   %rax,%rax
+  80159b:	7f 06                	jg     8015a3 <sys_env_set_status+0x36>
+}
+  80159d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a1:	c9                   	leave
+  8015a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015a3:	49 89 c0             	mov    %rax,%r8
+  8015a6:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8015ab:	48 ba 10 34 80 00 00 	movabs $0x803410,%rdx
+  8015b2:	00 00 00 
+  8015b5:	be 26 00 00 00       	mov    $0x26,%esi
+  8015ba:	48 bf 2f 34 80 00 00 	movabs $0x80342f,%rdi
+  8015c1:	00 00 00 
+  8015c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c9:	49 b9 45 03 80 00 00 	movabs $0x800345,%r9
+  8015d0:	00 00 00 
+  8015d3:	41 ff d1             	call   *%r9
+
+00000000008015d6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8015d6:	55                   	push   %rbp
+  8015d7:	48 89 e5             	mov    %rsp,%rbp
+  8015da:	53                   	push   %rbx
+  8015db:	48 83 ec 08          	sub    $0x8,%rsp
+  8015df:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8015e2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e5:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ff:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801601:	48 85 c0             	test   %rax,%rax
+  801604:	7f 06                	jg     80160c <sys_env_set_trapframe+0x36>
+}
+  801606:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80160a:	c9                   	leave
+  80160b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80160c:	49 89 c0             	mov    %rax,%r8
+  80160f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801614:	48 ba 10 34 80 00 00 	movabs $0x803410,%rdx
+  80161b:	00 00 00 
+  80161e:	be 26 00 00 00       	mov    $0x26,%esi
+  801623:	48 bf 2f 34 80 00 00 	movabs $0x80342f,%rdi
+  80162a:	00 00 00 
+  80162d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801632:	49 b9 45 03 80 00 00 	movabs $0x800345,%r9
+  801639:	00 00 00 
+  80163c:	41 ff d1             	call   *%r9
+
+000000000080163f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80163f:	55                   	push   %rbp
+  801640:	48 89 e5             	mov    %rsp,%rbp
+  801643:	53                   	push   %rbx
+  801644:	48 83 ec 08          	sub    $0x8,%rsp
+  801648:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80164b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80164e:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801653:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801658:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80165d:	be 00 00 00 00       	mov    $0x0,%esi
+  801662:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801668:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80166a:	48 85 c0             	test   %rax,%rax
+  80166d:	7f 06                	jg     801675 <sys_env_set_pgfault_upcall+0x36>
+}
+  80166f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801673:	c9                   	leave
+  801674:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801675:	49 89 c0             	mov    %rax,%r8
+  801678:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80167d:	48 ba 10 34 80 00 00 	movabs $0x803410,%rdx
+  801684:	00 00 00 
+  801687:	be 26 00 00 00       	mov    $0x26,%esi
+  80168c:	48 bf 2f 34 80 00 00 	movabs $0x80342f,%rdi
+  801693:	00 00 00 
+  801696:	b8 00 00 00 00       	mov    $0x0,%eax
+  80169b:	49 b9 45 03 80 00 00 	movabs $0x800345,%r9
+  8016a2:	00 00 00 
+  8016a5:	41 ff d1             	call   *%r9
+
+00000000008016a8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016a8:	55                   	push   %rbp
+  8016a9:	48 89 e5             	mov    %rsp,%rbp
+  8016ac:	53                   	push   %rbx
+  8016ad:	89 f8                	mov    %edi,%eax
+  8016af:	49 89 f1             	mov    %rsi,%r9
+  8016b2:	48 89 d3             	mov    %rdx,%rbx
+  8016b5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016b8:	49 63 f0             	movslq %r8d,%rsi
+  8016bb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016be:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016c3:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016cc:	cd 30                	int    $0x30
+}
+  8016ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d2:	c9                   	leave
+  8016d3:	c3                   	ret
+
+00000000008016d4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8016d4:	55                   	push   %rbp
+  8016d5:	48 89 e5             	mov    %rsp,%rbp
+  8016d8:	53                   	push   %rbx
+  8016d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8016dd:	48 89 fa             	mov    %rdi,%rdx
+  8016e0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e3:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ed:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016fd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016ff:	48 85 c0             	test   %rax,%rax
+  801702:	7f 06                	jg     80170a <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801704:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801708:	c9                   	leave
+  801709:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80170a:	49 89 c0             	mov    %rax,%r8
+  80170d:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801712:	48 ba 10 34 80 00 00 	movabs $0x803410,%rdx
+  801719:	00 00 00 
+  80171c:	be 26 00 00 00       	mov    $0x26,%esi
+  801721:	48 bf 2f 34 80 00 00 	movabs $0x80342f,%rdi
+  801728:	00 00 00 
+  80172b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801730:	49 b9 45 03 80 00 00 	movabs $0x800345,%r9
+  801737:	00 00 00 
+  80173a:	41 ff d1             	call   *%r9
+
+000000000080173d <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80173d:	55                   	push   %rbp
+  80173e:	48 89 e5             	mov    %rsp,%rbp
+  801741:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801742:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801747:	ba 00 00 00 00       	mov    $0x0,%edx
+  80174c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801751:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801756:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80175b:	be 00 00 00 00       	mov    $0x0,%esi
+  801760:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801766:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801768:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80176c:	c9                   	leave
+  80176d:	c3                   	ret
+
+000000000080176e <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80176e:	55                   	push   %rbp
+  80176f:	48 89 e5             	mov    %rsp,%rbp
+  801772:	53                   	push   %rbx
+  801773:	48 83 ec 08          	sub    $0x8,%rsp
+  801777:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  80177a:	48 63 ce             	movslq %esi,%rcx
+  80177d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801780:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801785:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80178a:	be 00 00 00 00       	mov    $0x0,%esi
+  80178f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801795:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801797:	48 85 c0             	test   %rax,%rax
+  80179a:	7f 06                	jg     8017a2 <sys_sigqueue+0x34>
+}
+  80179c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017a0:	c9                   	leave
+  8017a1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017a2:	49 89 c0             	mov    %rax,%r8
+  8017a5:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8017aa:	48 ba 10 34 80 00 00 	movabs $0x803410,%rdx
+  8017b1:	00 00 00 
+  8017b4:	be 26 00 00 00       	mov    $0x26,%esi
+  8017b9:	48 bf 2f 34 80 00 00 	movabs $0x80342f,%rdi
+  8017c0:	00 00 00 
+  8017c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c8:	49 b9 45 03 80 00 00 	movabs $0x800345,%r9
+  8017cf:	00 00 00 
+  8017d2:	41 ff d1             	call   *%r9
+
+00000000008017d5 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8017d5:	55                   	push   %rbp
+  8017d6:	48 89 e5             	mov    %rsp,%rbp
+  8017d9:	53                   	push   %rbx
+  8017da:	48 83 ec 08          	sub    $0x8,%rsp
+  8017de:	48 89 fa             	mov    %rdi,%rdx
+  8017e1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e4:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017fe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801800:	48 85 c0             	test   %rax,%rax
+  801803:	7f 06                	jg     80180b <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801805:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801809:	c9                   	leave
+  80180a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80180b:	49 89 c0             	mov    %rax,%r8
+  80180e:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801813:	48 ba 10 34 80 00 00 	movabs $0x803410,%rdx
+  80181a:	00 00 00 
+  80181d:	be 26 00 00 00       	mov    $0x26,%esi
+  801822:	48 bf 2f 34 80 00 00 	movabs $0x80342f,%rdi
+  801829:	00 00 00 
+  80182c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801831:	49 b9 45 03 80 00 00 	movabs $0x800345,%r9
+  801838:	00 00 00 
+  80183b:	41 ff d1             	call   *%r9
+
+000000000080183e <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80183e:	55                   	push   %rbp
+  80183f:	48 89 e5             	mov    %rsp,%rbp
+  801842:	53                   	push   %rbx
+  801843:	48 83 ec 08          	sub    $0x8,%rsp
+  801847:	48 89 f1             	mov    %rsi,%rcx
+  80184a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80184d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801850:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801855:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80185a:	be 00 00 00 00       	mov    $0x0,%esi
+  80185f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801865:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801867:	48 85 c0             	test   %rax,%rax
+  80186a:	7f 06                	jg     801872 <sys_sigaction+0x34>
+}
+  80186c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801870:	c9                   	leave
+  801871:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801872:	49 89 c0             	mov    %rax,%r8
+  801875:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80187a:	48 ba 10 34 80 00 00 	movabs $0x803410,%rdx
+  801881:	00 00 00 
+  801884:	be 26 00 00 00       	mov    $0x26,%esi
+  801889:	48 bf 2f 34 80 00 00 	movabs $0x80342f,%rdi
+  801890:	00 00 00 
+  801893:	b8 00 00 00 00       	mov    $0x0,%eax
+  801898:	49 b9 45 03 80 00 00 	movabs $0x800345,%r9
+  80189f:	00 00 00 
+  8018a2:	41 ff d1             	call   *%r9
+
+00000000008018a5 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8018a5:	55                   	push   %rbp
+  8018a6:	48 89 e5             	mov    %rsp,%rbp
+  8018a9:	53                   	push   %rbx
+  8018aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8018ae:	48 89 f1             	mov    %rsi,%rcx
+  8018b1:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8018b4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018b7:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018ce:	48 85 c0             	test   %rax,%rax
+  8018d1:	7f 06                	jg     8018d9 <sys_sigprocmask+0x34>
+}
+  8018d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018d7:	c9                   	leave
+  8018d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018d9:	49 89 c0             	mov    %rax,%r8
+  8018dc:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8018e1:	48 ba 10 34 80 00 00 	movabs $0x803410,%rdx
+  8018e8:	00 00 00 
+  8018eb:	be 26 00 00 00       	mov    $0x26,%esi
+  8018f0:	48 bf 2f 34 80 00 00 	movabs $0x80342f,%rdi
+  8018f7:	00 00 00 
+  8018fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ff:	49 b9 45 03 80 00 00 	movabs $0x800345,%r9
+  801906:	00 00 00 
+  801909:	41 ff d1             	call   *%r9
+
+000000000080190c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80190c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801913:	ff ff ff 
+  801916:	48 01 f8             	add    %rdi,%rax
+  801919:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80191d:	c3                   	ret
+
+000000000080191e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80191e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801925:	ff ff ff 
+  801928:	48 01 f8             	add    %rdi,%rax
+  80192b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80192f:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801935:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801939:	c3                   	ret
+
+000000000080193a <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80193a:	55                   	push   %rbp
+  80193b:	48 89 e5             	mov    %rsp,%rbp
+  80193e:	41 57                	push   %r15
+  801940:	41 56                	push   %r14
+  801942:	41 55                	push   %r13
+  801944:	41 54                	push   %r12
+  801946:	53                   	push   %rbx
+  801947:	48 83 ec 08          	sub    $0x8,%rsp
+  80194b:	49 89 ff             	mov    %rdi,%r15
+  80194e:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801953:	49 bd b8 28 80 00 00 	movabs $0x8028b8,%r13
+  80195a:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80195d:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801963:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801966:	48 89 df             	mov    %rbx,%rdi
+  801969:	41 ff d5             	call   *%r13
+  80196c:	83 e0 04             	and    $0x4,%eax
+  80196f:	74 17                	je     801988 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801971:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801978:	4c 39 f3             	cmp    %r14,%rbx
+  80197b:	75 e6                	jne    801963 <fd_alloc+0x29>
+  80197d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801983:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801988:	4d 89 27             	mov    %r12,(%r15)
+}
+  80198b:	48 83 c4 08          	add    $0x8,%rsp
+  80198f:	5b                   	pop    %rbx
+  801990:	41 5c                	pop    %r12
+  801992:	41 5d                	pop    %r13
+  801994:	41 5e                	pop    %r14
+  801996:	41 5f                	pop    %r15
+  801998:	5d                   	pop    %rbp
+  801999:	c3                   	ret
+
+000000000080199a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80199a:	83 ff 1f             	cmp    $0x1f,%edi
+  80199d:	77 39                	ja     8019d8 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80199f:	55                   	push   %rbp
+  8019a0:	48 89 e5             	mov    %rsp,%rbp
+  8019a3:	41 54                	push   %r12
+  8019a5:	53                   	push   %rbx
+  8019a6:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8019a9:	48 63 df             	movslq %edi,%rbx
+  8019ac:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019b3:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8019b7:	48 89 df             	mov    %rbx,%rdi
+  8019ba:	48 b8 b8 28 80 00 00 	movabs $0x8028b8,%rax
+  8019c1:	00 00 00 
+  8019c4:	ff d0                	call   *%rax
+  8019c6:	a8 04                	test   $0x4,%al
+  8019c8:	74 14                	je     8019de <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8019ca:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8019ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019d3:	5b                   	pop    %rbx
+  8019d4:	41 5c                	pop    %r12
+  8019d6:	5d                   	pop    %rbp
+  8019d7:	c3                   	ret
+        return -E_INVAL;
+  8019d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8019dd:	c3                   	ret
+        return -E_INVAL;
+  8019de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019e3:	eb ee                	jmp    8019d3 <fd_lookup+0x39>
+
+00000000008019e5 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8019e5:	55                   	push   %rbp
+  8019e6:	48 89 e5             	mov    %rsp,%rbp
+  8019e9:	41 54                	push   %r12
+  8019eb:	53                   	push   %rbx
+  8019ec:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8019ef:	48 b8 c0 34 80 00 00 	movabs $0x8034c0,%rax
+  8019f6:	00 00 00 
+  8019f9:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801a00:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a03:	39 3b                	cmp    %edi,(%rbx)
+  801a05:	74 47                	je     801a4e <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a07:	48 83 c0 08          	add    $0x8,%rax
+  801a0b:	48 8b 18             	mov    (%rax),%rbx
+  801a0e:	48 85 db             	test   %rbx,%rbx
+  801a11:	75 f0                	jne    801a03 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a13:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a1a:	00 00 00 
+  801a1d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a23:	89 fa                	mov    %edi,%edx
+  801a25:	48 bf 40 34 80 00 00 	movabs $0x803440,%rdi
+  801a2c:	00 00 00 
+  801a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a34:	48 b9 95 04 80 00 00 	movabs $0x800495,%rcx
+  801a3b:	00 00 00 
+  801a3e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a40:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a45:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a49:	5b                   	pop    %rbx
+  801a4a:	41 5c                	pop    %r12
+  801a4c:	5d                   	pop    %rbp
+  801a4d:	c3                   	ret
+            return 0;
+  801a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a53:	eb f0                	jmp    801a45 <dev_lookup+0x60>
+
+0000000000801a55 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a55:	55                   	push   %rbp
+  801a56:	48 89 e5             	mov    %rsp,%rbp
+  801a59:	41 55                	push   %r13
+  801a5b:	41 54                	push   %r12
+  801a5d:	53                   	push   %rbx
+  801a5e:	48 83 ec 18          	sub    $0x18,%rsp
+  801a62:	48 89 fb             	mov    %rdi,%rbx
+  801a65:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a68:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a6f:	ff ff ff 
+  801a72:	48 01 df             	add    %rbx,%rdi
+  801a75:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a79:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a7d:	48 b8 9a 19 80 00 00 	movabs $0x80199a,%rax
+  801a84:	00 00 00 
+  801a87:	ff d0                	call   *%rax
+  801a89:	41 89 c5             	mov    %eax,%r13d
+  801a8c:	85 c0                	test   %eax,%eax
+  801a8e:	78 06                	js     801a96 <fd_close+0x41>
+  801a90:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a94:	74 1a                	je     801ab0 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a96:	45 84 e4             	test   %r12b,%r12b
+  801a99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801aa2:	44 89 e8             	mov    %r13d,%eax
+  801aa5:	48 83 c4 18          	add    $0x18,%rsp
+  801aa9:	5b                   	pop    %rbx
+  801aaa:	41 5c                	pop    %r12
+  801aac:	41 5d                	pop    %r13
+  801aae:	5d                   	pop    %rbp
+  801aaf:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ab0:	8b 3b                	mov    (%rbx),%edi
+  801ab2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ab6:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801abd:	00 00 00 
+  801ac0:	ff d0                	call   *%rax
+  801ac2:	41 89 c5             	mov    %eax,%r13d
+  801ac5:	85 c0                	test   %eax,%eax
+  801ac7:	78 1b                	js     801ae4 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801ac9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801acd:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801ad1:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801ad7:	48 85 c0             	test   %rax,%rax
+  801ada:	74 08                	je     801ae4 <fd_close+0x8f>
+  801adc:	48 89 df             	mov    %rbx,%rdi
+  801adf:	ff d0                	call   *%rax
+  801ae1:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801ae4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ae9:	48 89 de             	mov    %rbx,%rsi
+  801aec:	bf 00 00 00 00       	mov    $0x0,%edi
+  801af1:	48 b8 36 14 80 00 00 	movabs $0x801436,%rax
+  801af8:	00 00 00 
+  801afb:	ff d0                	call   *%rax
+    return res;
+  801afd:	eb a3                	jmp    801aa2 <fd_close+0x4d>
+
+0000000000801aff <close>:
+
+int
+close(int fdnum) {
+  801aff:	55                   	push   %rbp
+  801b00:	48 89 e5             	mov    %rsp,%rbp
+  801b03:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b07:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b0b:	48 b8 9a 19 80 00 00 	movabs $0x80199a,%rax
+  801b12:	00 00 00 
+  801b15:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b17:	85 c0                	test   %eax,%eax
+  801b19:	78 15                	js     801b30 <close+0x31>
+
+    return fd_close(fd, 1);
+  801b1b:	be 01 00 00 00       	mov    $0x1,%esi
+  801b20:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b24:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  801b2b:	00 00 00 
+  801b2e:	ff d0                	call   *%rax
+}
+  801b30:	c9                   	leave
+  801b31:	c3                   	ret
+
+0000000000801b32 <close_all>:
+
+void
+close_all(void) {
+  801b32:	55                   	push   %rbp
+  801b33:	48 89 e5             	mov    %rsp,%rbp
+  801b36:	41 54                	push   %r12
+  801b38:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b39:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b3e:	49 bc ff 1a 80 00 00 	movabs $0x801aff,%r12
+  801b45:	00 00 00 
+  801b48:	89 df                	mov    %ebx,%edi
+  801b4a:	41 ff d4             	call   *%r12
+  801b4d:	83 c3 01             	add    $0x1,%ebx
+  801b50:	83 fb 20             	cmp    $0x20,%ebx
+  801b53:	75 f3                	jne    801b48 <close_all+0x16>
+}
+  801b55:	5b                   	pop    %rbx
+  801b56:	41 5c                	pop    %r12
+  801b58:	5d                   	pop    %rbp
+  801b59:	c3                   	ret
+
+0000000000801b5a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b5a:	55                   	push   %rbp
+  801b5b:	48 89 e5             	mov    %rsp,%rbp
+  801b5e:	41 57                	push   %r15
+  801b60:	41 56                	push   %r14
+  801b62:	41 55                	push   %r13
+  801b64:	41 54                	push   %r12
+  801b66:	53                   	push   %rbx
+  801b67:	48 83 ec 18          	sub    $0x18,%rsp
+  801b6b:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b6e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b72:	48 b8 9a 19 80 00 00 	movabs $0x80199a,%rax
+  801b79:	00 00 00 
+  801b7c:	ff d0                	call   *%rax
+  801b7e:	89 c3                	mov    %eax,%ebx
+  801b80:	85 c0                	test   %eax,%eax
+  801b82:	0f 88 b8 00 00 00    	js     801c40 <dup+0xe6>
+    close(newfdnum);
+  801b88:	44 89 e7             	mov    %r12d,%edi
+  801b8b:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  801b92:	00 00 00 
+  801b95:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b97:	4d 63 ec             	movslq %r12d,%r13
+  801b9a:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801ba1:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801ba5:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ba9:	4c 89 ff             	mov    %r15,%rdi
+  801bac:	49 be 1e 19 80 00 00 	movabs $0x80191e,%r14
+  801bb3:	00 00 00 
+  801bb6:	41 ff d6             	call   *%r14
+  801bb9:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801bbc:	4c 89 ef             	mov    %r13,%rdi
+  801bbf:	41 ff d6             	call   *%r14
+  801bc2:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801bc5:	48 89 df             	mov    %rbx,%rdi
+  801bc8:	48 b8 b8 28 80 00 00 	movabs $0x8028b8,%rax
+  801bcf:	00 00 00 
+  801bd2:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801bd4:	a8 04                	test   $0x4,%al
+  801bd6:	74 2b                	je     801c03 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801bd8:	41 89 c1             	mov    %eax,%r9d
+  801bdb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801be1:	4c 89 f1             	mov    %r14,%rcx
+  801be4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801be9:	48 89 de             	mov    %rbx,%rsi
+  801bec:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bf1:	48 b8 d1 13 80 00 00 	movabs $0x8013d1,%rax
+  801bf8:	00 00 00 
+  801bfb:	ff d0                	call   *%rax
+  801bfd:	89 c3                	mov    %eax,%ebx
+  801bff:	85 c0                	test   %eax,%eax
+  801c01:	78 4e                	js     801c51 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c03:	4c 89 ff             	mov    %r15,%rdi
+  801c06:	48 b8 b8 28 80 00 00 	movabs $0x8028b8,%rax
+  801c0d:	00 00 00 
+  801c10:	ff d0                	call   *%rax
+  801c12:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c15:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c1b:	4c 89 e9             	mov    %r13,%rcx
+  801c1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c23:	4c 89 fe             	mov    %r15,%rsi
+  801c26:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c2b:	48 b8 d1 13 80 00 00 	movabs $0x8013d1,%rax
+  801c32:	00 00 00 
+  801c35:	ff d0                	call   *%rax
+  801c37:	89 c3                	mov    %eax,%ebx
+  801c39:	85 c0                	test   %eax,%eax
+  801c3b:	78 14                	js     801c51 <dup+0xf7>
+
+    return newfdnum;
+  801c3d:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c40:	89 d8                	mov    %ebx,%eax
+  801c42:	48 83 c4 18          	add    $0x18,%rsp
+  801c46:	5b                   	pop    %rbx
+  801c47:	41 5c                	pop    %r12
+  801c49:	41 5d                	pop    %r13
+  801c4b:	41 5e                	pop    %r14
+  801c4d:	41 5f                	pop    %r15
+  801c4f:	5d                   	pop    %rbp
+  801c50:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c51:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c56:	4c 89 ee             	mov    %r13,%rsi
+  801c59:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c5e:	49 bc 36 14 80 00 00 	movabs $0x801436,%r12
+  801c65:	00 00 00 
+  801c68:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c6b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c70:	4c 89 f6             	mov    %r14,%rsi
+  801c73:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c78:	41 ff d4             	call   *%r12
+    return res;
+  801c7b:	eb c3                	jmp    801c40 <dup+0xe6>
+
+0000000000801c7d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c7d:	55                   	push   %rbp
+  801c7e:	48 89 e5             	mov    %rsp,%rbp
+  801c81:	41 56                	push   %r14
+  801c83:	41 55                	push   %r13
+  801c85:	41 54                	push   %r12
+  801c87:	53                   	push   %rbx
+  801c88:	48 83 ec 10          	sub    $0x10,%rsp
+  801c8c:	89 fb                	mov    %edi,%ebx
+  801c8e:	49 89 f4             	mov    %rsi,%r12
+  801c91:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c94:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c98:	48 b8 9a 19 80 00 00 	movabs $0x80199a,%rax
+  801c9f:	00 00 00 
+  801ca2:	ff d0                	call   *%rax
+  801ca4:	85 c0                	test   %eax,%eax
+  801ca6:	78 4c                	js     801cf4 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ca8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cac:	41 8b 3e             	mov    (%r14),%edi
+  801caf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cb3:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801cba:	00 00 00 
+  801cbd:	ff d0                	call   *%rax
+  801cbf:	85 c0                	test   %eax,%eax
+  801cc1:	78 35                	js     801cf8 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cc3:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801cc7:	83 e0 03             	and    $0x3,%eax
+  801cca:	83 f8 01             	cmp    $0x1,%eax
+  801ccd:	74 2d                	je     801cfc <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ccf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cd3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801cd7:	48 85 c0             	test   %rax,%rax
+  801cda:	74 56                	je     801d32 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801cdc:	4c 89 ea             	mov    %r13,%rdx
+  801cdf:	4c 89 e6             	mov    %r12,%rsi
+  801ce2:	4c 89 f7             	mov    %r14,%rdi
+  801ce5:	ff d0                	call   *%rax
+}
+  801ce7:	48 83 c4 10          	add    $0x10,%rsp
+  801ceb:	5b                   	pop    %rbx
+  801cec:	41 5c                	pop    %r12
+  801cee:	41 5d                	pop    %r13
+  801cf0:	41 5e                	pop    %r14
+  801cf2:	5d                   	pop    %rbp
+  801cf3:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cf4:	48 98                	cltq
+  801cf6:	eb ef                	jmp    801ce7 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cf8:	48 98                	cltq
+  801cfa:	eb eb                	jmp    801ce7 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cfc:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d03:	00 00 00 
+  801d06:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d0c:	89 da                	mov    %ebx,%edx
+  801d0e:	48 bf 81 34 80 00 00 	movabs $0x803481,%rdi
+  801d15:	00 00 00 
+  801d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d1d:	48 b9 95 04 80 00 00 	movabs $0x800495,%rcx
+  801d24:	00 00 00 
+  801d27:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d29:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d30:	eb b5                	jmp    801ce7 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d32:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d39:	eb ac                	jmp    801ce7 <read+0x6a>
+
+0000000000801d3b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d3b:	55                   	push   %rbp
+  801d3c:	48 89 e5             	mov    %rsp,%rbp
+  801d3f:	41 57                	push   %r15
+  801d41:	41 56                	push   %r14
+  801d43:	41 55                	push   %r13
+  801d45:	41 54                	push   %r12
+  801d47:	53                   	push   %rbx
+  801d48:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d4c:	48 85 d2             	test   %rdx,%rdx
+  801d4f:	74 54                	je     801da5 <readn+0x6a>
+  801d51:	41 89 fd             	mov    %edi,%r13d
+  801d54:	49 89 f6             	mov    %rsi,%r14
+  801d57:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d5f:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d64:	49 bf 7d 1c 80 00 00 	movabs $0x801c7d,%r15
+  801d6b:	00 00 00 
+  801d6e:	4c 89 e2             	mov    %r12,%rdx
+  801d71:	48 29 f2             	sub    %rsi,%rdx
+  801d74:	4c 01 f6             	add    %r14,%rsi
+  801d77:	44 89 ef             	mov    %r13d,%edi
+  801d7a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d7d:	85 c0                	test   %eax,%eax
+  801d7f:	78 20                	js     801da1 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d81:	01 c3                	add    %eax,%ebx
+  801d83:	85 c0                	test   %eax,%eax
+  801d85:	74 08                	je     801d8f <readn+0x54>
+  801d87:	48 63 f3             	movslq %ebx,%rsi
+  801d8a:	4c 39 e6             	cmp    %r12,%rsi
+  801d8d:	72 df                	jb     801d6e <readn+0x33>
+    }
+    return res;
+  801d8f:	48 63 c3             	movslq %ebx,%rax
+}
+  801d92:	48 83 c4 08          	add    $0x8,%rsp
+  801d96:	5b                   	pop    %rbx
+  801d97:	41 5c                	pop    %r12
+  801d99:	41 5d                	pop    %r13
+  801d9b:	41 5e                	pop    %r14
+  801d9d:	41 5f                	pop    %r15
+  801d9f:	5d                   	pop    %rbp
+  801da0:	c3                   	ret
+        if (inc < 0) return inc;
+  801da1:	48 98                	cltq
+  801da3:	eb ed                	jmp    801d92 <readn+0x57>
+    int inc = 1, res = 0;
+  801da5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801daa:	eb e3                	jmp    801d8f <readn+0x54>
+
+0000000000801dac <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801dac:	55                   	push   %rbp
+  801dad:	48 89 e5             	mov    %rsp,%rbp
+  801db0:	41 56                	push   %r14
+  801db2:	41 55                	push   %r13
+  801db4:	41 54                	push   %r12
+  801db6:	53                   	push   %rbx
+  801db7:	48 83 ec 10          	sub    $0x10,%rsp
+  801dbb:	89 fb                	mov    %edi,%ebx
+  801dbd:	49 89 f4             	mov    %rsi,%r12
+  801dc0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dc3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dc7:	48 b8 9a 19 80 00 00 	movabs $0x80199a,%rax
+  801dce:	00 00 00 
+  801dd1:	ff d0                	call   *%rax
+  801dd3:	85 c0                	test   %eax,%eax
+  801dd5:	78 47                	js     801e1e <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dd7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ddb:	41 8b 3e             	mov    (%r14),%edi
+  801dde:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801de2:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801de9:	00 00 00 
+  801dec:	ff d0                	call   *%rax
+  801dee:	85 c0                	test   %eax,%eax
+  801df0:	78 30                	js     801e22 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801df2:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801df7:	74 2d                	je     801e26 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801df9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dfd:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e01:	48 85 c0             	test   %rax,%rax
+  801e04:	74 56                	je     801e5c <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e06:	4c 89 ea             	mov    %r13,%rdx
+  801e09:	4c 89 e6             	mov    %r12,%rsi
+  801e0c:	4c 89 f7             	mov    %r14,%rdi
+  801e0f:	ff d0                	call   *%rax
+}
+  801e11:	48 83 c4 10          	add    $0x10,%rsp
+  801e15:	5b                   	pop    %rbx
+  801e16:	41 5c                	pop    %r12
+  801e18:	41 5d                	pop    %r13
+  801e1a:	41 5e                	pop    %r14
+  801e1c:	5d                   	pop    %rbp
+  801e1d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e1e:	48 98                	cltq
+  801e20:	eb ef                	jmp    801e11 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e22:	48 98                	cltq
+  801e24:	eb eb                	jmp    801e11 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e26:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e2d:	00 00 00 
+  801e30:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e36:	89 da                	mov    %ebx,%edx
+  801e38:	48 bf 9d 34 80 00 00 	movabs $0x80349d,%rdi
+  801e3f:	00 00 00 
+  801e42:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e47:	48 b9 95 04 80 00 00 	movabs $0x800495,%rcx
+  801e4e:	00 00 00 
+  801e51:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e53:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e5a:	eb b5                	jmp    801e11 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e5c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e63:	eb ac                	jmp    801e11 <write+0x65>
+
+0000000000801e65 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e65:	55                   	push   %rbp
+  801e66:	48 89 e5             	mov    %rsp,%rbp
+  801e69:	53                   	push   %rbx
+  801e6a:	48 83 ec 18          	sub    $0x18,%rsp
+  801e6e:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e70:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e74:	48 b8 9a 19 80 00 00 	movabs $0x80199a,%rax
+  801e7b:	00 00 00 
+  801e7e:	ff d0                	call   *%rax
+  801e80:	85 c0                	test   %eax,%eax
+  801e82:	78 0c                	js     801e90 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801e84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e88:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801e8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e90:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e94:	c9                   	leave
+  801e95:	c3                   	ret
+
+0000000000801e96 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e96:	55                   	push   %rbp
+  801e97:	48 89 e5             	mov    %rsp,%rbp
+  801e9a:	41 55                	push   %r13
+  801e9c:	41 54                	push   %r12
+  801e9e:	53                   	push   %rbx
+  801e9f:	48 83 ec 18          	sub    $0x18,%rsp
+  801ea3:	89 fb                	mov    %edi,%ebx
+  801ea5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ea8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801eac:	48 b8 9a 19 80 00 00 	movabs $0x80199a,%rax
+  801eb3:	00 00 00 
+  801eb6:	ff d0                	call   *%rax
+  801eb8:	85 c0                	test   %eax,%eax
+  801eba:	78 38                	js     801ef4 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ebc:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ec0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ec4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ec8:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801ecf:	00 00 00 
+  801ed2:	ff d0                	call   *%rax
+  801ed4:	85 c0                	test   %eax,%eax
+  801ed6:	78 1c                	js     801ef4 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ed8:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801edd:	74 20                	je     801eff <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801edf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ee3:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801ee7:	48 85 c0             	test   %rax,%rax
+  801eea:	74 47                	je     801f33 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801eec:	44 89 e6             	mov    %r12d,%esi
+  801eef:	4c 89 ef             	mov    %r13,%rdi
+  801ef2:	ff d0                	call   *%rax
+}
+  801ef4:	48 83 c4 18          	add    $0x18,%rsp
+  801ef8:	5b                   	pop    %rbx
+  801ef9:	41 5c                	pop    %r12
+  801efb:	41 5d                	pop    %r13
+  801efd:	5d                   	pop    %rbp
+  801efe:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801eff:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f06:	00 00 00 
+  801f09:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f0f:	89 da                	mov    %ebx,%edx
+  801f11:	48 bf 60 34 80 00 00 	movabs $0x803460,%rdi
+  801f18:	00 00 00 
+  801f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f20:	48 b9 95 04 80 00 00 	movabs $0x800495,%rcx
+  801f27:	00 00 00 
+  801f2a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f2c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f31:	eb c1                	jmp    801ef4 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f33:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f38:	eb ba                	jmp    801ef4 <ftruncate+0x5e>
+
+0000000000801f3a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f3a:	55                   	push   %rbp
+  801f3b:	48 89 e5             	mov    %rsp,%rbp
+  801f3e:	41 54                	push   %r12
+  801f40:	53                   	push   %rbx
+  801f41:	48 83 ec 10          	sub    $0x10,%rsp
+  801f45:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f48:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f4c:	48 b8 9a 19 80 00 00 	movabs $0x80199a,%rax
+  801f53:	00 00 00 
+  801f56:	ff d0                	call   *%rax
+  801f58:	85 c0                	test   %eax,%eax
+  801f5a:	78 4e                	js     801faa <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f5c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f60:	41 8b 3c 24          	mov    (%r12),%edi
+  801f64:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f68:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801f6f:	00 00 00 
+  801f72:	ff d0                	call   *%rax
+  801f74:	85 c0                	test   %eax,%eax
+  801f76:	78 32                	js     801faa <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f78:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f7c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f81:	74 30                	je     801fb3 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f83:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f86:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f8d:	00 00 00 
+    stat->st_isdir = 0;
+  801f90:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f97:	00 00 00 
+    stat->st_dev = dev;
+  801f9a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801fa1:	48 89 de             	mov    %rbx,%rsi
+  801fa4:	4c 89 e7             	mov    %r12,%rdi
+  801fa7:	ff 50 28             	call   *0x28(%rax)
+}
+  801faa:	48 83 c4 10          	add    $0x10,%rsp
+  801fae:	5b                   	pop    %rbx
+  801faf:	41 5c                	pop    %r12
+  801fb1:	5d                   	pop    %rbp
+  801fb2:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fb3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fb8:	eb f0                	jmp    801faa <fstat+0x70>
+
+0000000000801fba <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801fba:	55                   	push   %rbp
+  801fbb:	48 89 e5             	mov    %rsp,%rbp
+  801fbe:	41 54                	push   %r12
+  801fc0:	53                   	push   %rbx
+  801fc1:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801fc4:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc9:	48 b8 3b 22 80 00 00 	movabs $0x80223b,%rax
+  801fd0:	00 00 00 
+  801fd3:	ff d0                	call   *%rax
+  801fd5:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801fd7:	85 c0                	test   %eax,%eax
+  801fd9:	78 25                	js     802000 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801fdb:	4c 89 e6             	mov    %r12,%rsi
+  801fde:	89 c7                	mov    %eax,%edi
+  801fe0:	48 b8 3a 1f 80 00 00 	movabs $0x801f3a,%rax
+  801fe7:	00 00 00 
+  801fea:	ff d0                	call   *%rax
+  801fec:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801fef:	89 df                	mov    %ebx,%edi
+  801ff1:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  801ff8:	00 00 00 
+  801ffb:	ff d0                	call   *%rax
+
+    return res;
+  801ffd:	44 89 e3             	mov    %r12d,%ebx
+}
+  802000:	89 d8                	mov    %ebx,%eax
+  802002:	5b                   	pop    %rbx
+  802003:	41 5c                	pop    %r12
+  802005:	5d                   	pop    %rbp
+  802006:	c3                   	ret
+
+0000000000802007 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802007:	55                   	push   %rbp
+  802008:	48 89 e5             	mov    %rsp,%rbp
+  80200b:	41 54                	push   %r12
+  80200d:	53                   	push   %rbx
+  80200e:	48 83 ec 10          	sub    $0x10,%rsp
+  802012:	41 89 fc             	mov    %edi,%r12d
+  802015:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802018:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80201f:	00 00 00 
+  802022:	83 38 00             	cmpl   $0x0,(%rax)
+  802025:	74 5e                	je     802085 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802027:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80202d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802032:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802039:	00 00 00 
+  80203c:	44 89 e6             	mov    %r12d,%esi
+  80203f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802046:	00 00 00 
+  802049:	8b 38                	mov    (%rax),%edi
+  80204b:	48 b8 74 2c 80 00 00 	movabs $0x802c74,%rax
+  802052:	00 00 00 
+  802055:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802057:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80205e:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80205f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802064:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802068:	48 89 de             	mov    %rbx,%rsi
+  80206b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802070:	48 b8 df 2b 80 00 00 	movabs $0x802bdf,%rax
+  802077:	00 00 00 
+  80207a:	ff d0                	call   *%rax
+}
+  80207c:	48 83 c4 10          	add    $0x10,%rsp
+  802080:	5b                   	pop    %rbx
+  802081:	41 5c                	pop    %r12
+  802083:	5d                   	pop    %rbp
+  802084:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802085:	bf 03 00 00 00       	mov    $0x3,%edi
+  80208a:	48 b8 14 2d 80 00 00 	movabs $0x802d14,%rax
+  802091:	00 00 00 
+  802094:	ff d0                	call   *%rax
+  802096:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80209d:	00 00 
+  80209f:	eb 86                	jmp    802027 <fsipc+0x20>
+
+00000000008020a1 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8020a1:	55                   	push   %rbp
+  8020a2:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8020a5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8020ac:	00 00 00 
+  8020af:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8020b2:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8020b4:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8020b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8020bc:	bf 02 00 00 00       	mov    $0x2,%edi
+  8020c1:	48 b8 07 20 80 00 00 	movabs $0x802007,%rax
+  8020c8:	00 00 00 
+  8020cb:	ff d0                	call   *%rax
+}
+  8020cd:	5d                   	pop    %rbp
+  8020ce:	c3                   	ret
+
+00000000008020cf <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8020cf:	55                   	push   %rbp
+  8020d0:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8020d3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8020d6:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8020dd:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8020df:	be 00 00 00 00       	mov    $0x0,%esi
+  8020e4:	bf 06 00 00 00       	mov    $0x6,%edi
+  8020e9:	48 b8 07 20 80 00 00 	movabs $0x802007,%rax
+  8020f0:	00 00 00 
+  8020f3:	ff d0                	call   *%rax
+}
+  8020f5:	5d                   	pop    %rbp
+  8020f6:	c3                   	ret
+
+00000000008020f7 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8020f7:	55                   	push   %rbp
+  8020f8:	48 89 e5             	mov    %rsp,%rbp
+  8020fb:	41 54                	push   %r12
+  8020fd:	53                   	push   %rbx
+  8020fe:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802101:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802104:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80210b:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80210d:	be 00 00 00 00       	mov    $0x0,%esi
+  802112:	bf 05 00 00 00       	mov    $0x5,%edi
+  802117:	48 b8 07 20 80 00 00 	movabs $0x802007,%rax
+  80211e:	00 00 00 
+  802121:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802123:	85 c0                	test   %eax,%eax
+  802125:	78 3d                	js     802164 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802127:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80212e:	00 00 00 
+  802131:	4c 89 e6             	mov    %r12,%rsi
+  802134:	48 89 df             	mov    %rbx,%rdi
+  802137:	48 b8 ba 0d 80 00 00 	movabs $0x800dba,%rax
+  80213e:	00 00 00 
+  802141:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802143:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80214a:	00 
+  80214b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802151:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802158:	00 
+  802159:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80215f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802164:	5b                   	pop    %rbx
+  802165:	41 5c                	pop    %r12
+  802167:	5d                   	pop    %rbp
+  802168:	c3                   	ret
+
+0000000000802169 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802169:	55                   	push   %rbp
+  80216a:	48 89 e5             	mov    %rsp,%rbp
+  80216d:	41 54                	push   %r12
+  80216f:	53                   	push   %rbx
+  802170:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  802173:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802178:	48 39 c2             	cmp    %rax,%rdx
+  80217b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80217f:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802182:	48 89 c2             	mov    %rax,%rdx
+  802185:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80218c:	00 00 00 
+  80218f:	48 b8 1b 10 80 00 00 	movabs $0x80101b,%rax
+  802196:	00 00 00 
+  802199:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80219b:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8021a2:	00 00 00 
+  8021a5:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8021aa:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8021ac:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8021b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8021ba:	48 b8 07 20 80 00 00 	movabs $0x802007,%rax
+  8021c1:	00 00 00 
+  8021c4:	ff d0                	call   *%rax
+  8021c6:	48 98                	cltq
+}
+  8021c8:	5b                   	pop    %rbx
+  8021c9:	41 5c                	pop    %r12
+  8021cb:	5d                   	pop    %rbp
+  8021cc:	c3                   	ret
+
+00000000008021cd <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8021cd:	55                   	push   %rbp
+  8021ce:	48 89 e5             	mov    %rsp,%rbp
+  8021d1:	41 54                	push   %r12
+  8021d3:	53                   	push   %rbx
+  8021d4:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8021d7:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8021de:	00 00 00 
+  8021e1:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8021e4:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8021e6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021eb:	48 39 ca             	cmp    %rcx,%rdx
+  8021ee:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8021f2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8021f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021fb:	bf 03 00 00 00       	mov    $0x3,%edi
+  802200:	48 b8 07 20 80 00 00 	movabs $0x802007,%rax
+  802207:	00 00 00 
+  80220a:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  80220c:	85 c0                	test   %eax,%eax
+  80220e:	78 27                	js     802237 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802210:	48 63 d8             	movslq %eax,%rbx
+  802213:	48 89 da             	mov    %rbx,%rdx
+  802216:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80221d:	00 00 00 
+  802220:	4c 89 e7             	mov    %r12,%rdi
+  802223:	48 b8 1b 10 80 00 00 	movabs $0x80101b,%rax
+  80222a:	00 00 00 
+  80222d:	ff d0                	call   *%rax
+    return bytes_read;
+  80222f:	48 89 d8             	mov    %rbx,%rax
+}
+  802232:	5b                   	pop    %rbx
+  802233:	41 5c                	pop    %r12
+  802235:	5d                   	pop    %rbp
+  802236:	c3                   	ret
+        return bytes_read;
+  802237:	48 98                	cltq
+  802239:	eb f7                	jmp    802232 <devfile_read+0x65>
+
+000000000080223b <open>:
+open(const char *path, int mode) {
+  80223b:	55                   	push   %rbp
+  80223c:	48 89 e5             	mov    %rsp,%rbp
+  80223f:	41 55                	push   %r13
+  802241:	41 54                	push   %r12
+  802243:	53                   	push   %rbx
+  802244:	48 83 ec 18          	sub    $0x18,%rsp
+  802248:	49 89 fc             	mov    %rdi,%r12
+  80224b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80224e:	48 b8 7c 0d 80 00 00 	movabs $0x800d7c,%rax
+  802255:	00 00 00 
+  802258:	ff d0                	call   *%rax
+  80225a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802260:	0f 87 8a 00 00 00    	ja     8022f0 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802266:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80226a:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  802271:	00 00 00 
+  802274:	ff d0                	call   *%rax
+  802276:	89 c3                	mov    %eax,%ebx
+  802278:	85 c0                	test   %eax,%eax
+  80227a:	78 50                	js     8022cc <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80227c:	4c 89 e6             	mov    %r12,%rsi
+  80227f:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802286:	00 00 00 
+  802289:	48 89 df             	mov    %rbx,%rdi
+  80228c:	48 b8 ba 0d 80 00 00 	movabs $0x800dba,%rax
+  802293:	00 00 00 
+  802296:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802298:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80229f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8022a3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8022a8:	48 b8 07 20 80 00 00 	movabs $0x802007,%rax
+  8022af:	00 00 00 
+  8022b2:	ff d0                	call   *%rax
+  8022b4:	89 c3                	mov    %eax,%ebx
+  8022b6:	85 c0                	test   %eax,%eax
+  8022b8:	78 1f                	js     8022d9 <open+0x9e>
+    return fd2num(fd);
+  8022ba:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022be:	48 b8 0c 19 80 00 00 	movabs $0x80190c,%rax
+  8022c5:	00 00 00 
+  8022c8:	ff d0                	call   *%rax
+  8022ca:	89 c3                	mov    %eax,%ebx
+}
+  8022cc:	89 d8                	mov    %ebx,%eax
+  8022ce:	48 83 c4 18          	add    $0x18,%rsp
+  8022d2:	5b                   	pop    %rbx
+  8022d3:	41 5c                	pop    %r12
+  8022d5:	41 5d                	pop    %r13
+  8022d7:	5d                   	pop    %rbp
+  8022d8:	c3                   	ret
+        fd_close(fd, 0);
+  8022d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8022de:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022e2:	48 b8 55 1a 80 00 00 	movabs $0x801a55,%rax
+  8022e9:	00 00 00 
+  8022ec:	ff d0                	call   *%rax
+        return res;
+  8022ee:	eb dc                	jmp    8022cc <open+0x91>
+        return -E_BAD_PATH;
+  8022f0:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8022f5:	eb d5                	jmp    8022cc <open+0x91>
+
+00000000008022f7 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8022f7:	55                   	push   %rbp
+  8022f8:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8022fb:	be 00 00 00 00       	mov    $0x0,%esi
+  802300:	bf 08 00 00 00       	mov    $0x8,%edi
+  802305:	48 b8 07 20 80 00 00 	movabs $0x802007,%rax
+  80230c:	00 00 00 
+  80230f:	ff d0                	call   *%rax
+}
+  802311:	5d                   	pop    %rbp
+  802312:	c3                   	ret
+
+0000000000802313 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802313:	55                   	push   %rbp
+  802314:	48 89 e5             	mov    %rsp,%rbp
+  802317:	41 54                	push   %r12
+  802319:	53                   	push   %rbx
+  80231a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80231d:	48 b8 1e 19 80 00 00 	movabs $0x80191e,%rax
+  802324:	00 00 00 
+  802327:	ff d0                	call   *%rax
+  802329:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80232c:	48 be e0 34 80 00 00 	movabs $0x8034e0,%rsi
+  802333:	00 00 00 
+  802336:	48 89 df             	mov    %rbx,%rdi
+  802339:	48 b8 ba 0d 80 00 00 	movabs $0x800dba,%rax
+  802340:	00 00 00 
+  802343:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802345:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80234a:	41 2b 04 24          	sub    (%r12),%eax
+  80234e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802354:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80235b:	00 00 00 
+    stat->st_dev = &devpipe;
+  80235e:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802365:	00 00 00 
+  802368:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80236f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802374:	5b                   	pop    %rbx
+  802375:	41 5c                	pop    %r12
+  802377:	5d                   	pop    %rbp
+  802378:	c3                   	ret
+
+0000000000802379 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802379:	55                   	push   %rbp
+  80237a:	48 89 e5             	mov    %rsp,%rbp
+  80237d:	41 54                	push   %r12
+  80237f:	53                   	push   %rbx
+  802380:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802383:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802388:	48 89 fe             	mov    %rdi,%rsi
+  80238b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802390:	49 bc 36 14 80 00 00 	movabs $0x801436,%r12
+  802397:	00 00 00 
+  80239a:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80239d:	48 89 df             	mov    %rbx,%rdi
+  8023a0:	48 b8 1e 19 80 00 00 	movabs $0x80191e,%rax
+  8023a7:	00 00 00 
+  8023aa:	ff d0                	call   *%rax
+  8023ac:	48 89 c6             	mov    %rax,%rsi
+  8023af:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023b9:	41 ff d4             	call   *%r12
+}
+  8023bc:	5b                   	pop    %rbx
+  8023bd:	41 5c                	pop    %r12
+  8023bf:	5d                   	pop    %rbp
+  8023c0:	c3                   	ret
+
+00000000008023c1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8023c1:	55                   	push   %rbp
+  8023c2:	48 89 e5             	mov    %rsp,%rbp
+  8023c5:	41 57                	push   %r15
+  8023c7:	41 56                	push   %r14
+  8023c9:	41 55                	push   %r13
+  8023cb:	41 54                	push   %r12
+  8023cd:	53                   	push   %rbx
+  8023ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8023d2:	49 89 fc             	mov    %rdi,%r12
+  8023d5:	49 89 f5             	mov    %rsi,%r13
+  8023d8:	49 89 d7             	mov    %rdx,%r15
+  8023db:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8023df:	48 b8 1e 19 80 00 00 	movabs $0x80191e,%rax
+  8023e6:	00 00 00 
+  8023e9:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8023eb:	4d 85 ff             	test   %r15,%r15
+  8023ee:	0f 84 af 00 00 00    	je     8024a3 <devpipe_write+0xe2>
+  8023f4:	48 89 c3             	mov    %rax,%rbx
+  8023f7:	4c 89 f8             	mov    %r15,%rax
+  8023fa:	4d 89 ef             	mov    %r13,%r15
+  8023fd:	4c 01 e8             	add    %r13,%rax
+  802400:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802404:	49 bd 3e 13 80 00 00 	movabs $0x80133e,%r13
+  80240b:	00 00 00 
+            sys_yield();
+  80240e:	49 be db 12 80 00 00 	movabs $0x8012db,%r14
+  802415:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802418:	8b 73 04             	mov    0x4(%rbx),%esi
+  80241b:	48 63 ce             	movslq %esi,%rcx
+  80241e:	48 63 03             	movslq (%rbx),%rax
+  802421:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802427:	48 39 c1             	cmp    %rax,%rcx
+  80242a:	72 2e                	jb     80245a <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80242c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802431:	48 89 da             	mov    %rbx,%rdx
+  802434:	be 00 10 00 00       	mov    $0x1000,%esi
+  802439:	4c 89 e7             	mov    %r12,%rdi
+  80243c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80243f:	85 c0                	test   %eax,%eax
+  802441:	74 66                	je     8024a9 <devpipe_write+0xe8>
+            sys_yield();
+  802443:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802446:	8b 73 04             	mov    0x4(%rbx),%esi
+  802449:	48 63 ce             	movslq %esi,%rcx
+  80244c:	48 63 03             	movslq (%rbx),%rax
+  80244f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802455:	48 39 c1             	cmp    %rax,%rcx
+  802458:	73 d2                	jae    80242c <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80245a:	41 0f b6 3f          	movzbl (%r15),%edi
+  80245e:	48 89 ca             	mov    %rcx,%rdx
+  802461:	48 c1 ea 03          	shr    $0x3,%rdx
+  802465:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80246c:	08 10 20 
+  80246f:	48 f7 e2             	mul    %rdx
+  802472:	48 c1 ea 06          	shr    $0x6,%rdx
+  802476:	48 89 d0             	mov    %rdx,%rax
+  802479:	48 c1 e0 09          	shl    $0x9,%rax
+  80247d:	48 29 d0             	sub    %rdx,%rax
+  802480:	48 c1 e0 03          	shl    $0x3,%rax
+  802484:	48 29 c1             	sub    %rax,%rcx
+  802487:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80248c:	83 c6 01             	add    $0x1,%esi
+  80248f:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802492:	49 83 c7 01          	add    $0x1,%r15
+  802496:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80249a:	49 39 c7             	cmp    %rax,%r15
+  80249d:	0f 85 75 ff ff ff    	jne    802418 <devpipe_write+0x57>
+    return n;
+  8024a3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8024a7:	eb 05                	jmp    8024ae <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8024a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024ae:	48 83 c4 18          	add    $0x18,%rsp
+  8024b2:	5b                   	pop    %rbx
+  8024b3:	41 5c                	pop    %r12
+  8024b5:	41 5d                	pop    %r13
+  8024b7:	41 5e                	pop    %r14
+  8024b9:	41 5f                	pop    %r15
+  8024bb:	5d                   	pop    %rbp
+  8024bc:	c3                   	ret
+
+00000000008024bd <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8024bd:	55                   	push   %rbp
+  8024be:	48 89 e5             	mov    %rsp,%rbp
+  8024c1:	41 57                	push   %r15
+  8024c3:	41 56                	push   %r14
+  8024c5:	41 55                	push   %r13
+  8024c7:	41 54                	push   %r12
+  8024c9:	53                   	push   %rbx
+  8024ca:	48 83 ec 18          	sub    $0x18,%rsp
+  8024ce:	49 89 fc             	mov    %rdi,%r12
+  8024d1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8024d5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024d9:	48 b8 1e 19 80 00 00 	movabs $0x80191e,%rax
+  8024e0:	00 00 00 
+  8024e3:	ff d0                	call   *%rax
+  8024e5:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8024e8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8024ee:	49 bd 3e 13 80 00 00 	movabs $0x80133e,%r13
+  8024f5:	00 00 00 
+            sys_yield();
+  8024f8:	49 be db 12 80 00 00 	movabs $0x8012db,%r14
+  8024ff:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802502:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802507:	74 7d                	je     802586 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802509:	8b 03                	mov    (%rbx),%eax
+  80250b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80250e:	75 26                	jne    802536 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802510:	4d 85 ff             	test   %r15,%r15
+  802513:	75 77                	jne    80258c <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802515:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80251a:	48 89 da             	mov    %rbx,%rdx
+  80251d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802522:	4c 89 e7             	mov    %r12,%rdi
+  802525:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802528:	85 c0                	test   %eax,%eax
+  80252a:	74 72                	je     80259e <devpipe_read+0xe1>
+            sys_yield();
+  80252c:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80252f:	8b 03                	mov    (%rbx),%eax
+  802531:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802534:	74 df                	je     802515 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802536:	48 63 c8             	movslq %eax,%rcx
+  802539:	48 89 ca             	mov    %rcx,%rdx
+  80253c:	48 c1 ea 03          	shr    $0x3,%rdx
+  802540:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802547:	08 10 20 
+  80254a:	48 89 d0             	mov    %rdx,%rax
+  80254d:	48 f7 e6             	mul    %rsi
+  802550:	48 c1 ea 06          	shr    $0x6,%rdx
+  802554:	48 89 d0             	mov    %rdx,%rax
+  802557:	48 c1 e0 09          	shl    $0x9,%rax
+  80255b:	48 29 d0             	sub    %rdx,%rax
+  80255e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802565:	00 
+  802566:	48 89 c8             	mov    %rcx,%rax
+  802569:	48 29 d0             	sub    %rdx,%rax
+  80256c:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802571:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802575:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802579:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80257c:	49 83 c7 01          	add    $0x1,%r15
+  802580:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802584:	75 83                	jne    802509 <devpipe_read+0x4c>
+    return n;
+  802586:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80258a:	eb 03                	jmp    80258f <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80258c:	4c 89 f8             	mov    %r15,%rax
+}
+  80258f:	48 83 c4 18          	add    $0x18,%rsp
+  802593:	5b                   	pop    %rbx
+  802594:	41 5c                	pop    %r12
+  802596:	41 5d                	pop    %r13
+  802598:	41 5e                	pop    %r14
+  80259a:	41 5f                	pop    %r15
+  80259c:	5d                   	pop    %rbp
+  80259d:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80259e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a3:	eb ea                	jmp    80258f <devpipe_read+0xd2>
+
+00000000008025a5 <pipe>:
+pipe(int pfd[2]) {
+  8025a5:	55                   	push   %rbp
+  8025a6:	48 89 e5             	mov    %rsp,%rbp
+  8025a9:	41 55                	push   %r13
+  8025ab:	41 54                	push   %r12
+  8025ad:	53                   	push   %rbx
+  8025ae:	48 83 ec 18          	sub    $0x18,%rsp
+  8025b2:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8025b5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8025b9:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  8025c0:	00 00 00 
+  8025c3:	ff d0                	call   *%rax
+  8025c5:	89 c3                	mov    %eax,%ebx
+  8025c7:	85 c0                	test   %eax,%eax
+  8025c9:	0f 88 a0 01 00 00    	js     80276f <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8025cf:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8025d4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025d9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8025dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025e2:	48 b8 6a 13 80 00 00 	movabs $0x80136a,%rax
+  8025e9:	00 00 00 
+  8025ec:	ff d0                	call   *%rax
+  8025ee:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8025f0:	85 c0                	test   %eax,%eax
+  8025f2:	0f 88 77 01 00 00    	js     80276f <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8025f8:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8025fc:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  802603:	00 00 00 
+  802606:	ff d0                	call   *%rax
+  802608:	89 c3                	mov    %eax,%ebx
+  80260a:	85 c0                	test   %eax,%eax
+  80260c:	0f 88 43 01 00 00    	js     802755 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802612:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802617:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80261c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802620:	bf 00 00 00 00       	mov    $0x0,%edi
+  802625:	48 b8 6a 13 80 00 00 	movabs $0x80136a,%rax
+  80262c:	00 00 00 
+  80262f:	ff d0                	call   *%rax
+  802631:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802633:	85 c0                	test   %eax,%eax
+  802635:	0f 88 1a 01 00 00    	js     802755 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80263b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80263f:	48 b8 1e 19 80 00 00 	movabs $0x80191e,%rax
+  802646:	00 00 00 
+  802649:	ff d0                	call   *%rax
+  80264b:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80264e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802653:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802658:	48 89 c6             	mov    %rax,%rsi
+  80265b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802660:	48 b8 6a 13 80 00 00 	movabs $0x80136a,%rax
+  802667:	00 00 00 
+  80266a:	ff d0                	call   *%rax
+  80266c:	89 c3                	mov    %eax,%ebx
+  80266e:	85 c0                	test   %eax,%eax
+  802670:	0f 88 c5 00 00 00    	js     80273b <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802676:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80267a:	48 b8 1e 19 80 00 00 	movabs $0x80191e,%rax
+  802681:	00 00 00 
+  802684:	ff d0                	call   *%rax
+  802686:	48 89 c1             	mov    %rax,%rcx
+  802689:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80268f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802695:	ba 00 00 00 00       	mov    $0x0,%edx
+  80269a:	4c 89 ee             	mov    %r13,%rsi
+  80269d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026a2:	48 b8 d1 13 80 00 00 	movabs $0x8013d1,%rax
+  8026a9:	00 00 00 
+  8026ac:	ff d0                	call   *%rax
+  8026ae:	89 c3                	mov    %eax,%ebx
+  8026b0:	85 c0                	test   %eax,%eax
+  8026b2:	78 6e                	js     802722 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8026b4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026b9:	4c 89 ef             	mov    %r13,%rdi
+  8026bc:	48 b8 0c 13 80 00 00 	movabs $0x80130c,%rax
+  8026c3:	00 00 00 
+  8026c6:	ff d0                	call   *%rax
+  8026c8:	83 f8 02             	cmp    $0x2,%eax
+  8026cb:	0f 85 ab 00 00 00    	jne    80277c <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8026d1:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8026d8:	00 00 
+  8026da:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8026de:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8026e0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8026e4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8026eb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8026ef:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8026f1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026f5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8026fc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802700:	48 bb 0c 19 80 00 00 	movabs $0x80190c,%rbx
+  802707:	00 00 00 
+  80270a:	ff d3                	call   *%rbx
+  80270c:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802710:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802714:	ff d3                	call   *%rbx
+  802716:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80271b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802720:	eb 4d                	jmp    80276f <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802722:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802727:	4c 89 ee             	mov    %r13,%rsi
+  80272a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80272f:	48 b8 36 14 80 00 00 	movabs $0x801436,%rax
+  802736:	00 00 00 
+  802739:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80273b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802740:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802744:	bf 00 00 00 00       	mov    $0x0,%edi
+  802749:	48 b8 36 14 80 00 00 	movabs $0x801436,%rax
+  802750:	00 00 00 
+  802753:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802755:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80275a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80275e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802763:	48 b8 36 14 80 00 00 	movabs $0x801436,%rax
+  80276a:	00 00 00 
+  80276d:	ff d0                	call   *%rax
+}
+  80276f:	89 d8                	mov    %ebx,%eax
+  802771:	48 83 c4 18          	add    $0x18,%rsp
+  802775:	5b                   	pop    %rbx
+  802776:	41 5c                	pop    %r12
+  802778:	41 5d                	pop    %r13
+  80277a:	5d                   	pop    %rbp
+  80277b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80277c:	48 b9 10 35 80 00 00 	movabs $0x803510,%rcx
+  802783:	00 00 00 
+  802786:	48 ba e7 34 80 00 00 	movabs $0x8034e7,%rdx
+  80278d:	00 00 00 
+  802790:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802795:	48 bf fc 34 80 00 00 	movabs $0x8034fc,%rdi
+  80279c:	00 00 00 
+  80279f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a4:	49 b8 45 03 80 00 00 	movabs $0x800345,%r8
+  8027ab:	00 00 00 
+  8027ae:	41 ff d0             	call   *%r8
+
+00000000008027b1 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8027b1:	55                   	push   %rbp
+  8027b2:	48 89 e5             	mov    %rsp,%rbp
+  8027b5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8027b9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8027bd:	48 b8 9a 19 80 00 00 	movabs $0x80199a,%rax
+  8027c4:	00 00 00 
+  8027c7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8027c9:	85 c0                	test   %eax,%eax
+  8027cb:	78 35                	js     802802 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8027cd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8027d1:	48 b8 1e 19 80 00 00 	movabs $0x80191e,%rax
+  8027d8:	00 00 00 
+  8027db:	ff d0                	call   *%rax
+  8027dd:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8027e0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8027e5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8027ea:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8027ee:	48 b8 3e 13 80 00 00 	movabs $0x80133e,%rax
+  8027f5:	00 00 00 
+  8027f8:	ff d0                	call   *%rax
+  8027fa:	85 c0                	test   %eax,%eax
+  8027fc:	0f 94 c0             	sete   %al
+  8027ff:	0f b6 c0             	movzbl %al,%eax
+}
+  802802:	c9                   	leave
+  802803:	c3                   	ret
+
+0000000000802804 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802804:	48 89 f8             	mov    %rdi,%rax
+  802807:	48 c1 e8 27          	shr    $0x27,%rax
+  80280b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802812:	01 00 00 
+  802815:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802819:	f6 c2 01             	test   $0x1,%dl
+  80281c:	74 6d                	je     80288b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80281e:	48 89 f8             	mov    %rdi,%rax
+  802821:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802825:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80282c:	01 00 00 
+  80282f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802833:	f6 c2 01             	test   $0x1,%dl
+  802836:	74 62                	je     80289a <get_uvpt_entry+0x96>
+  802838:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80283f:	01 00 00 
+  802842:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802846:	f6 c2 80             	test   $0x80,%dl
+  802849:	75 4f                	jne    80289a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80284b:	48 89 f8             	mov    %rdi,%rax
+  80284e:	48 c1 e8 15          	shr    $0x15,%rax
+  802852:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802859:	01 00 00 
+  80285c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802860:	f6 c2 01             	test   $0x1,%dl
+  802863:	74 44                	je     8028a9 <get_uvpt_entry+0xa5>
+  802865:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80286c:	01 00 00 
+  80286f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802873:	f6 c2 80             	test   $0x80,%dl
+  802876:	75 31                	jne    8028a9 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802878:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80287c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802883:	01 00 00 
+  802886:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80288a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80288b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802892:	01 00 00 
+  802895:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802899:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80289a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8028a1:	01 00 00 
+  8028a4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8028a8:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8028a9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8028b0:	01 00 00 
+  8028b3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8028b7:	c3                   	ret
+
+00000000008028b8 <get_prot>:
+
+int
+get_prot(void *va) {
+  8028b8:	55                   	push   %rbp
+  8028b9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8028bc:	48 b8 04 28 80 00 00 	movabs $0x802804,%rax
+  8028c3:	00 00 00 
+  8028c6:	ff d0                	call   *%rax
+  8028c8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8028cb:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8028d0:	89 c1                	mov    %eax,%ecx
+  8028d2:	83 c9 04             	or     $0x4,%ecx
+  8028d5:	f6 c2 01             	test   $0x1,%dl
+  8028d8:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8028db:	89 c1                	mov    %eax,%ecx
+  8028dd:	83 c9 02             	or     $0x2,%ecx
+  8028e0:	f6 c2 02             	test   $0x2,%dl
+  8028e3:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8028e6:	89 c1                	mov    %eax,%ecx
+  8028e8:	83 c9 01             	or     $0x1,%ecx
+  8028eb:	48 85 d2             	test   %rdx,%rdx
+  8028ee:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8028f1:	89 c1                	mov    %eax,%ecx
+  8028f3:	83 c9 40             	or     $0x40,%ecx
+  8028f6:	f6 c6 04             	test   $0x4,%dh
+  8028f9:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8028fc:	5d                   	pop    %rbp
+  8028fd:	c3                   	ret
+
+00000000008028fe <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8028fe:	55                   	push   %rbp
+  8028ff:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802902:	48 b8 04 28 80 00 00 	movabs $0x802804,%rax
+  802909:	00 00 00 
+  80290c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80290e:	48 c1 e8 06          	shr    $0x6,%rax
+  802912:	83 e0 01             	and    $0x1,%eax
+}
+  802915:	5d                   	pop    %rbp
+  802916:	c3                   	ret
+
+0000000000802917 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802917:	55                   	push   %rbp
+  802918:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80291b:	48 b8 04 28 80 00 00 	movabs $0x802804,%rax
+  802922:	00 00 00 
+  802925:	ff d0                	call   *%rax
+  802927:	83 e0 01             	and    $0x1,%eax
+}
+  80292a:	5d                   	pop    %rbp
+  80292b:	c3                   	ret
+
+000000000080292c <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80292c:	55                   	push   %rbp
+  80292d:	48 89 e5             	mov    %rsp,%rbp
+  802930:	41 57                	push   %r15
+  802932:	41 56                	push   %r14
+  802934:	41 55                	push   %r13
+  802936:	41 54                	push   %r12
+  802938:	53                   	push   %rbx
+  802939:	48 83 ec 18          	sub    $0x18,%rsp
+  80293d:	49 89 ff             	mov    %rdi,%r15
+  802940:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802944:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802949:	49 bc 17 29 80 00 00 	movabs $0x802917,%r12
+  802950:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802953:	49 be b8 28 80 00 00 	movabs $0x8028b8,%r14
+  80295a:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80295d:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802964:	00 00 00 
+  802967:	eb 0c                	jmp    802975 <foreach_shared_region+0x49>
+  802969:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802970:	4c 39 eb             	cmp    %r13,%rbx
+  802973:	74 38                	je     8029ad <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802975:	48 89 df             	mov    %rbx,%rdi
+  802978:	41 ff d4             	call   *%r12
+  80297b:	84 c0                	test   %al,%al
+  80297d:	74 ea                	je     802969 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  80297f:	48 89 df             	mov    %rbx,%rdi
+  802982:	41 ff d6             	call   *%r14
+  802985:	a8 40                	test   $0x40,%al
+  802987:	74 e0                	je     802969 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802989:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802990:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802994:	48 89 df             	mov    %rbx,%rdi
+  802997:	41 ff d7             	call   *%r15
+        if (err)
+  80299a:	85 c0                	test   %eax,%eax
+  80299c:	74 cb                	je     802969 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  80299e:	48 83 c4 18          	add    $0x18,%rsp
+  8029a2:	5b                   	pop    %rbx
+  8029a3:	41 5c                	pop    %r12
+  8029a5:	41 5d                	pop    %r13
+  8029a7:	41 5e                	pop    %r14
+  8029a9:	41 5f                	pop    %r15
+  8029ab:	5d                   	pop    %rbp
+  8029ac:	c3                   	ret
+    return 0;
+  8029ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b2:	eb ea                	jmp    80299e <foreach_shared_region+0x72>
+
+00000000008029b4 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b9:	c3                   	ret
+
+00000000008029ba <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8029ba:	55                   	push   %rbp
+  8029bb:	48 89 e5             	mov    %rsp,%rbp
+  8029be:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8029c1:	48 be 34 35 80 00 00 	movabs $0x803534,%rsi
+  8029c8:	00 00 00 
+  8029cb:	48 b8 ba 0d 80 00 00 	movabs $0x800dba,%rax
+  8029d2:	00 00 00 
+  8029d5:	ff d0                	call   *%rax
+    return 0;
+}
+  8029d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029dc:	5d                   	pop    %rbp
+  8029dd:	c3                   	ret
+
+00000000008029de <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8029de:	55                   	push   %rbp
+  8029df:	48 89 e5             	mov    %rsp,%rbp
+  8029e2:	41 57                	push   %r15
+  8029e4:	41 56                	push   %r14
+  8029e6:	41 55                	push   %r13
+  8029e8:	41 54                	push   %r12
+  8029ea:	53                   	push   %rbx
+  8029eb:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8029f2:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8029f9:	48 85 d2             	test   %rdx,%rdx
+  8029fc:	74 7a                	je     802a78 <devcons_write+0x9a>
+  8029fe:	49 89 d6             	mov    %rdx,%r14
+  802a01:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a07:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802a0c:	49 bf b4 0f 80 00 00 	movabs $0x800fb4,%r15
+  802a13:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a16:	4c 89 f3             	mov    %r14,%rbx
+  802a19:	48 29 f3             	sub    %rsi,%rbx
+  802a1c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a21:	48 39 c3             	cmp    %rax,%rbx
+  802a24:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a28:	4c 63 eb             	movslq %ebx,%r13
+  802a2b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a32:	48 01 c6             	add    %rax,%rsi
+  802a35:	4c 89 ea             	mov    %r13,%rdx
+  802a38:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a3f:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a42:	4c 89 ee             	mov    %r13,%rsi
+  802a45:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a4c:	48 b8 e1 11 80 00 00 	movabs $0x8011e1,%rax
+  802a53:	00 00 00 
+  802a56:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a58:	41 01 dc             	add    %ebx,%r12d
+  802a5b:	49 63 f4             	movslq %r12d,%rsi
+  802a5e:	4c 39 f6             	cmp    %r14,%rsi
+  802a61:	72 b3                	jb     802a16 <devcons_write+0x38>
+    return res;
+  802a63:	49 63 c4             	movslq %r12d,%rax
+}
+  802a66:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802a6d:	5b                   	pop    %rbx
+  802a6e:	41 5c                	pop    %r12
+  802a70:	41 5d                	pop    %r13
+  802a72:	41 5e                	pop    %r14
+  802a74:	41 5f                	pop    %r15
+  802a76:	5d                   	pop    %rbp
+  802a77:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802a78:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a7e:	eb e3                	jmp    802a63 <devcons_write+0x85>
+
+0000000000802a80 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a80:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802a83:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a88:	48 85 c0             	test   %rax,%rax
+  802a8b:	74 55                	je     802ae2 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a8d:	55                   	push   %rbp
+  802a8e:	48 89 e5             	mov    %rsp,%rbp
+  802a91:	41 55                	push   %r13
+  802a93:	41 54                	push   %r12
+  802a95:	53                   	push   %rbx
+  802a96:	48 83 ec 08          	sub    $0x8,%rsp
+  802a9a:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802a9d:	48 bb 0e 12 80 00 00 	movabs $0x80120e,%rbx
+  802aa4:	00 00 00 
+  802aa7:	49 bc db 12 80 00 00 	movabs $0x8012db,%r12
+  802aae:	00 00 00 
+  802ab1:	eb 03                	jmp    802ab6 <devcons_read+0x36>
+  802ab3:	41 ff d4             	call   *%r12
+  802ab6:	ff d3                	call   *%rbx
+  802ab8:	85 c0                	test   %eax,%eax
+  802aba:	74 f7                	je     802ab3 <devcons_read+0x33>
+    if (c < 0) return c;
+  802abc:	48 63 d0             	movslq %eax,%rdx
+  802abf:	78 13                	js     802ad4 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802ac1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ac6:	83 f8 04             	cmp    $0x4,%eax
+  802ac9:	74 09                	je     802ad4 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802acb:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802acf:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802ad4:	48 89 d0             	mov    %rdx,%rax
+  802ad7:	48 83 c4 08          	add    $0x8,%rsp
+  802adb:	5b                   	pop    %rbx
+  802adc:	41 5c                	pop    %r12
+  802ade:	41 5d                	pop    %r13
+  802ae0:	5d                   	pop    %rbp
+  802ae1:	c3                   	ret
+  802ae2:	48 89 d0             	mov    %rdx,%rax
+  802ae5:	c3                   	ret
+
+0000000000802ae6 <cputchar>:
+cputchar(int ch) {
+  802ae6:	55                   	push   %rbp
+  802ae7:	48 89 e5             	mov    %rsp,%rbp
+  802aea:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802aee:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802af2:	be 01 00 00 00       	mov    $0x1,%esi
+  802af7:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802afb:	48 b8 e1 11 80 00 00 	movabs $0x8011e1,%rax
+  802b02:	00 00 00 
+  802b05:	ff d0                	call   *%rax
+}
+  802b07:	c9                   	leave
+  802b08:	c3                   	ret
+
+0000000000802b09 <getchar>:
+getchar(void) {
+  802b09:	55                   	push   %rbp
+  802b0a:	48 89 e5             	mov    %rsp,%rbp
+  802b0d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b11:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b16:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b1f:	48 b8 7d 1c 80 00 00 	movabs $0x801c7d,%rax
+  802b26:	00 00 00 
+  802b29:	ff d0                	call   *%rax
+  802b2b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b2d:	85 c0                	test   %eax,%eax
+  802b2f:	78 06                	js     802b37 <getchar+0x2e>
+  802b31:	74 08                	je     802b3b <getchar+0x32>
+  802b33:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b37:	89 d0                	mov    %edx,%eax
+  802b39:	c9                   	leave
+  802b3a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b3b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b40:	eb f5                	jmp    802b37 <getchar+0x2e>
+
+0000000000802b42 <iscons>:
+iscons(int fdnum) {
+  802b42:	55                   	push   %rbp
+  802b43:	48 89 e5             	mov    %rsp,%rbp
+  802b46:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b4a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b4e:	48 b8 9a 19 80 00 00 	movabs $0x80199a,%rax
+  802b55:	00 00 00 
+  802b58:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b5a:	85 c0                	test   %eax,%eax
+  802b5c:	78 18                	js     802b76 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802b5e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b62:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802b69:	00 00 00 
+  802b6c:	8b 00                	mov    (%rax),%eax
+  802b6e:	39 02                	cmp    %eax,(%rdx)
+  802b70:	0f 94 c0             	sete   %al
+  802b73:	0f b6 c0             	movzbl %al,%eax
+}
+  802b76:	c9                   	leave
+  802b77:	c3                   	ret
+
+0000000000802b78 <opencons>:
+opencons(void) {
+  802b78:	55                   	push   %rbp
+  802b79:	48 89 e5             	mov    %rsp,%rbp
+  802b7c:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b80:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802b84:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  802b8b:	00 00 00 
+  802b8e:	ff d0                	call   *%rax
+  802b90:	85 c0                	test   %eax,%eax
+  802b92:	78 49                	js     802bdd <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802b94:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b99:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b9e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802ba2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba7:	48 b8 6a 13 80 00 00 	movabs $0x80136a,%rax
+  802bae:	00 00 00 
+  802bb1:	ff d0                	call   *%rax
+  802bb3:	85 c0                	test   %eax,%eax
+  802bb5:	78 26                	js     802bdd <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802bb7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bbb:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802bc2:	00 00 
+  802bc4:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802bc6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802bca:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802bd1:	48 b8 0c 19 80 00 00 	movabs $0x80190c,%rax
+  802bd8:	00 00 00 
+  802bdb:	ff d0                	call   *%rax
+}
+  802bdd:	c9                   	leave
+  802bde:	c3                   	ret
+
+0000000000802bdf <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802bdf:	55                   	push   %rbp
+  802be0:	48 89 e5             	mov    %rsp,%rbp
+  802be3:	41 54                	push   %r12
+  802be5:	53                   	push   %rbx
+  802be6:	48 89 fb             	mov    %rdi,%rbx
+  802be9:	48 89 f7             	mov    %rsi,%rdi
+  802bec:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802bef:	48 85 f6             	test   %rsi,%rsi
+  802bf2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bf9:	00 00 00 
+  802bfc:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802c00:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c05:	48 b8 d4 16 80 00 00 	movabs $0x8016d4,%rax
+  802c0c:	00 00 00 
+  802c0f:	ff d0                	call   *%rax
+    if (res < 0) {
+  802c11:	85 c0                	test   %eax,%eax
+  802c13:	78 45                	js     802c5a <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802c15:	48 85 db             	test   %rbx,%rbx
+  802c18:	74 12                	je     802c2c <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802c1a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802c21:	00 00 00 
+  802c24:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802c2a:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802c2c:	4d 85 e4             	test   %r12,%r12
+  802c2f:	74 14                	je     802c45 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802c31:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802c38:	00 00 00 
+  802c3b:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802c41:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802c45:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802c4c:	00 00 00 
+  802c4f:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802c55:	5b                   	pop    %rbx
+  802c56:	41 5c                	pop    %r12
+  802c58:	5d                   	pop    %rbp
+  802c59:	c3                   	ret
+        if (from_env_store)
+  802c5a:	48 85 db             	test   %rbx,%rbx
+  802c5d:	74 06                	je     802c65 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802c5f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802c65:	4d 85 e4             	test   %r12,%r12
+  802c68:	74 eb                	je     802c55 <ipc_recv+0x76>
+            *perm_store = 0;
+  802c6a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802c71:	00 
+  802c72:	eb e1                	jmp    802c55 <ipc_recv+0x76>
+
+0000000000802c74 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802c74:	55                   	push   %rbp
+  802c75:	48 89 e5             	mov    %rsp,%rbp
+  802c78:	41 57                	push   %r15
+  802c7a:	41 56                	push   %r14
+  802c7c:	41 55                	push   %r13
+  802c7e:	41 54                	push   %r12
+  802c80:	53                   	push   %rbx
+  802c81:	48 83 ec 18          	sub    $0x18,%rsp
+  802c85:	41 89 fd             	mov    %edi,%r13d
+  802c88:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802c8b:	48 89 d3             	mov    %rdx,%rbx
+  802c8e:	49 89 cc             	mov    %rcx,%r12
+  802c91:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802c95:	48 85 d2             	test   %rdx,%rdx
+  802c98:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802c9f:	00 00 00 
+  802ca2:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802ca6:	49 be a8 16 80 00 00 	movabs $0x8016a8,%r14
+  802cad:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802cb0:	49 bf db 12 80 00 00 	movabs $0x8012db,%r15
+  802cb7:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802cba:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802cbd:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802cc1:	4c 89 e1             	mov    %r12,%rcx
+  802cc4:	48 89 da             	mov    %rbx,%rdx
+  802cc7:	44 89 ef             	mov    %r13d,%edi
+  802cca:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802ccd:	85 c0                	test   %eax,%eax
+  802ccf:	74 34                	je     802d05 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802cd1:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802cd4:	75 05                	jne    802cdb <ipc_send+0x67>
+        sys_yield();
+  802cd6:	41 ff d7             	call   *%r15
+    while (true) {
+  802cd9:	eb df                	jmp    802cba <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802cdb:	48 ba 40 35 80 00 00 	movabs $0x803540,%rdx
+  802ce2:	00 00 00 
+  802ce5:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802cea:	48 bf 59 35 80 00 00 	movabs $0x803559,%rdi
+  802cf1:	00 00 00 
+  802cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf9:	48 b9 45 03 80 00 00 	movabs $0x800345,%rcx
+  802d00:	00 00 00 
+  802d03:	ff d1                	call   *%rcx
+    }
+}
+  802d05:	48 83 c4 18          	add    $0x18,%rsp
+  802d09:	5b                   	pop    %rbx
+  802d0a:	41 5c                	pop    %r12
+  802d0c:	41 5d                	pop    %r13
+  802d0e:	41 5e                	pop    %r14
+  802d10:	41 5f                	pop    %r15
+  802d12:	5d                   	pop    %rbp
+  802d13:	c3                   	ret
+
+0000000000802d14 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802d14:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802d19:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802d20:	00 00 00 
+  802d23:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802d2a:	48 01 ca             	add    %rcx,%rdx
+  802d2d:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802d33:	39 fa                	cmp    %edi,%edx
+  802d35:	74 12                	je     802d49 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802d37:	48 83 c0 01          	add    $0x1,%rax
+  802d3b:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802d41:	75 e0                	jne    802d23 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802d43:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d48:	c3                   	ret
+            return envs[i].env_id;
+  802d49:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802d50:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802d57:	00 00 00 
+  802d5a:	48 01 d0             	add    %rdx,%rax
+  802d5d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802d63:	c3                   	ret
+  802d64:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000802d68 <__rodata_start>:
+  802d68:	73 79                	jae    802de3 <__rodata_start+0x7b>
+  802d6a:	73 5f                	jae    802dcb <__rodata_start+0x63>
+  802d6c:	61                   	(bad)
+  802d6d:	6c                   	insb   (%dx),%es:(%rdi)
+  802d6e:	6c                   	insb   (%dx),%es:(%rdi)
+  802d6f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d70:	63 5f 72             	movsxd 0x72(%rdi),%ebx
+  802d73:	65 67 69 6f 6e 28 41 	imul   $0x4c4c4128,%gs:0x6e(%edi),%ebp
+  802d7a:	4c 4c 
+  802d7c:	4f                   	rex.WRXB
+  802d7d:	43 5f                	rex.XB pop %r15
+  802d7f:	48 55                	rex.W push %rbp
+  802d81:	47                   	rex.RXB
+  802d82:	45 5f                	rex.RB pop %r15
+  802d84:	32 4d 29             	xor    0x29(%rbp),%cl
+  802d87:	3a 20                	cmp    (%rax),%ah
+  802d89:	25 69 00 00 00       	and    $0x69,%eax
+  802d8e:	00 00                	add    %al,(%rax)
+  802d90:	31 47 42             	xor    %eax,0x42(%rdi)
+  802d93:	20 70 61             	and    %dh,0x61(%rax)
+  802d96:	67 65 73 3a          	addr32 gs jae 802dd4 <__rodata_start+0x6c>
+  802d9a:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802d9d:	74 20                	je     802dbf <__rodata_start+0x57>
+  802d9f:	73 75                	jae    802e16 <__rodata_start+0xae>
+  802da1:	70 70                	jo     802e13 <__rodata_start+0xab>
+  802da3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802da4:	72 74                	jb     802e1a <__rodata_start+0xb2>
+  802da6:	65 64 20 62 79       	gs and %ah,%fs:0x79(%rdx)
+  802dab:	20 43 50             	and    %al,0x50(%rbx)
+  802dae:	55                   	push   %rbp
+  802daf:	0a 00                	or     (%rax),%al
+  802db1:	00 00                	add    %al,(%rax)
+  802db3:	00 00                	add    %al,(%rax)
+  802db5:	00 00                	add    %al,(%rax)
+  802db7:	00 31                	add    %dh,(%rcx)
+  802db9:	47                   	rex.RXB
+  802dba:	42 20 70 61          	rex.X and %sil,0x61(%rax)
+  802dbe:	67 65 73 3a          	addr32 gs jae 802dfc <__rodata_start+0x94>
+  802dc2:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802dc5:	20 66 72             	and    %ah,0x72(%rsi)
+  802dc8:	65 65 20 31          	gs and %dh,%gs:(%rcx)
+  802dcc:	47                   	rex.RXB
+  802dcd:	42 20 62 6c          	rex.X and %spl,0x6c(%rdx)
+  802dd1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dd2:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802dd5:	28 65 78             	sub    %ah,0x78(%rbp)
+  802dd8:	70 65                	jo     802e3f <__rodata_start+0xd7>
+  802dda:	63 74 65 64          	movsxd 0x64(%rbp,%riz,2),%esi
+  802dde:	20 77 69             	and    %dh,0x69(%rdi)
+  802de1:	74 68                	je     802e4b <__rodata_start+0xe3>
+  802de3:	20 2d 6d 20 35 31    	and    %ch,0x3135206d(%rip)        # 31b54e56 <__bss_end+0x3134ce56>
+  802de9:	32 4d 29             	xor    0x29(%rbp),%cl
+  802dec:	0a 00                	or     (%rax),%al
+  802dee:	00 00                	add    %al,(%rax)
+  802df0:	73 79                	jae    802e6b <__rodata_start+0x103>
+  802df2:	73 5f                	jae    802e53 <__rodata_start+0xeb>
+  802df4:	61                   	(bad)
+  802df5:	6c                   	insb   (%dx),%es:(%rdi)
+  802df6:	6c                   	insb   (%dx),%es:(%rdi)
+  802df7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802df8:	63 5f 72             	movsxd 0x72(%rdi),%ebx
+  802dfb:	65 67 69 6f 6e 28 41 	imul   $0x4c4c4128,%gs:0x6e(%edi),%ebp
+  802e02:	4c 4c 
+  802e04:	4f                   	rex.WRXB
+  802e05:	43 5f                	rex.XB pop %r15
+  802e07:	48 55                	rex.W push %rbp
+  802e09:	47                   	rex.RXB
+  802e0a:	45 5f                	rex.RB pop %r15
+  802e0c:	31 47 29             	xor    %eax,0x29(%rdi)
+  802e0f:	3a 20                	cmp    (%rax),%ah
+  802e11:	25 69 00 75 73       	and    $0x73750069,%eax
+  802e16:	65 72 2f             	gs jb  802e48 <__rodata_start+0xe0>
+  802e19:	68 75 67 65 61       	push   $0x61656775
+  802e1e:	6c                   	insb   (%dx),%es:(%rdi)
+  802e1f:	6c                   	insb   (%dx),%es:(%rdi)
+  802e20:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e21:	63 2e                	movsxd (%rsi),%ebp
+  802e23:	63 00                	movsxd (%rax),%eax
+  802e25:	74 61                	je     802e88 <__rodata_start+0x120>
+  802e27:	62                   	(bad)
+  802e28:	6c                   	insb   (%dx),%es:(%rdi)
+  802e29:	65 32 6d 5b          	xor    %gs:0x5b(%rbp),%ch
+  802e2d:	25 7a 75 5d 20       	and    $0x205d757a,%eax
+  802e32:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802e39:	7a 65                	jp     802ea0 <__rodata_start+0x138>
+  802e3b:	72 6f                	jb     802eac <__rodata_start+0x144>
+  802e3d:	00 74 61 62          	add    %dh,0x62(%rcx,%riz,2)
+  802e41:	6c                   	insb   (%dx),%es:(%rdi)
+  802e42:	65 32 6d 5b          	xor    %gs:0x5b(%rbp),%ch
+  802e46:	25 7a 75 5d 20       	and    $0x205d757a,%eax
+  802e4b:	69 73 20 63 6f 72 72 	imul   $0x72726f63,0x20(%rbx),%esi
+  802e52:	75 70                	jne    802ec4 <__rodata_start+0x15c>
+  802e54:	74 65                	je     802ebb <__rodata_start+0x153>
+  802e56:	64 00 32             	add    %dh,%fs:(%rdx)
+  802e59:	4d                   	rex.WRB
+  802e5a:	42 20 70 61          	rex.X and %sil,0x61(%rax)
+  802e5e:	67 65 73 3a          	addr32 gs jae 802e9c <__rodata_start+0x134>
+  802e62:	20 4f 4b             	and    %cl,0x4b(%rdi)
+  802e65:	0a 00                	or     (%rax),%al
+  802e67:	6d                   	insl   (%dx),%es:(%rdi)
+  802e68:	69 73 61 6c 69 67 6e 	imul   $0x6e67696c,0x61(%rbx),%esi
+  802e6f:	65 64 20 41 4c       	gs and %al,%fs:0x4c(%rcx)
+  802e74:	4c                   	rex.WR
+  802e75:	4f                   	rex.WRXB
+  802e76:	43 5f                	rex.XB pop %r15
+  802e78:	48 55                	rex.W push %rbp
+  802e7a:	47                   	rex.RXB
+  802e7b:	45 5f                	rex.RB pop %r15
+  802e7d:	32 4d 3a             	xor    0x3a(%rbp),%cl
+  802e80:	20 25 69 00 31 47    	and    %ah,0x47310069(%rip)        # 47b12eef <__bss_end+0x4730aeef>
+  802e86:	42 20 70 61          	rex.X and %sil,0x61(%rax)
+  802e8a:	67 65 73 3a          	addr32 gs jae 802ec8 <__rodata_start+0x160>
+  802e8e:	20 4f 4b             	and    %cl,0x4b(%rdi)
+  802e91:	0a 00                	or     (%rax),%al
+  802e93:	3c 75                	cmp    $0x75,%al
+  802e95:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e96:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802e9a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e9b:	3e 00 0f             	ds add %cl,(%rdi)
+  802e9e:	1f                   	(bad)
+  802e9f:	00 5b 25             	add    %bl,0x25(%rbx)
+  802ea2:	30 38                	xor    %bh,(%rax)
+  802ea4:	78 5d                	js     802f03 <__rodata_start+0x19b>
+  802ea6:	20 75 73             	and    %dh,0x73(%rbp)
+  802ea9:	65 72 20             	gs jb  802ecc <__rodata_start+0x164>
+  802eac:	70 61                	jo     802f0f <__rodata_start+0x1a7>
+  802eae:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802eaf:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  802eb6:	73 20                	jae    802ed8 <__rodata_start+0x170>
+  802eb8:	61                   	(bad)
+  802eb9:	74 20                	je     802edb <__rodata_start+0x173>
+  802ebb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  802ec0:	3a 20                	cmp    (%rax),%ah
+  802ec2:	00 30                	add    %dh,(%rax)
+  802ec4:	31 32                	xor    %esi,(%rdx)
+  802ec6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802ecd:	41                   	rex.B
+  802ece:	42                   	rex.X
+  802ecf:	43                   	rex.XB
+  802ed0:	44                   	rex.R
+  802ed1:	45                   	rex.RB
+  802ed2:	46 00 30             	rex.RX add %r14b,(%rax)
+  802ed5:	31 32                	xor    %esi,(%rdx)
+  802ed7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802ede:	61                   	(bad)
+  802edf:	62 63 64 65 66       	(bad)
+  802ee4:	00 28                	add    %ch,(%rax)
+  802ee6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ee7:	75 6c                	jne    802f55 <__rodata_start+0x1ed>
+  802ee9:	6c                   	insb   (%dx),%es:(%rdi)
+  802eea:	29 00                	sub    %eax,(%rax)
+  802eec:	65 72 72             	gs jb  802f61 <__rodata_start+0x1f9>
+  802eef:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ef0:	72 20                	jb     802f12 <__rodata_start+0x1aa>
+  802ef2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802ef7:	73 70                	jae    802f69 <__rodata_start+0x201>
+  802ef9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802efd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802f04:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f05:	72 00                	jb     802f07 <__rodata_start+0x19f>
+  802f07:	62 61 64 20 65       	(bad)
+  802f0c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f0d:	76 69                	jbe    802f78 <__rodata_start+0x210>
+  802f0f:	72 6f                	jb     802f80 <__rodata_start+0x218>
+  802f11:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f12:	6d                   	insl   (%dx),%es:(%rdi)
+  802f13:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f15:	74 00                	je     802f17 <__rodata_start+0x1af>
+  802f17:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802f1e:	20 70 61             	and    %dh,0x61(%rax)
+  802f21:	72 61                	jb     802f84 <__rodata_start+0x21c>
+  802f23:	6d                   	insl   (%dx),%es:(%rdi)
+  802f24:	65 74 65             	gs je  802f8c <__rodata_start+0x224>
+  802f27:	72 00                	jb     802f29 <__rodata_start+0x1c1>
+  802f29:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f2a:	75 74                	jne    802fa0 <__rodata_start+0x238>
+  802f2c:	20 6f 66             	and    %ch,0x66(%rdi)
+  802f2f:	20 6d 65             	and    %ch,0x65(%rbp)
+  802f32:	6d                   	insl   (%dx),%es:(%rdi)
+  802f33:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f34:	72 79                	jb     802faf <__rodata_start+0x247>
+  802f36:	00 6f 75             	add    %ch,0x75(%rdi)
+  802f39:	74 20                	je     802f5b <__rodata_start+0x1f3>
+  802f3b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f3c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802f40:	76 69                	jbe    802fab <__rodata_start+0x243>
+  802f42:	72 6f                	jb     802fb3 <__rodata_start+0x24b>
+  802f44:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f45:	6d                   	insl   (%dx),%es:(%rdi)
+  802f46:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f48:	74 73                	je     802fbd <__rodata_start+0x255>
+  802f4a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802f4d:	72 72                	jb     802fc1 <__rodata_start+0x259>
+  802f4f:	75 70                	jne    802fc1 <__rodata_start+0x259>
+  802f51:	74 65                	je     802fb8 <__rodata_start+0x250>
+  802f53:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802f58:	75 67                	jne    802fc1 <__rodata_start+0x259>
+  802f5a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802f5d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802f5f:	00 73 65             	add    %dh,0x65(%rbx)
+  802f62:	67 6d                	insl   (%dx),%es:(%edi)
+  802f64:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f66:	74 61                	je     802fc9 <__rodata_start+0x261>
+  802f68:	74 69                	je     802fd3 <__rodata_start+0x26b>
+  802f6a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f6b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f6c:	20 66 61             	and    %ah,0x61(%rsi)
+  802f6f:	75 6c                	jne    802fdd <__rodata_start+0x275>
+  802f71:	74 00                	je     802f73 <__rodata_start+0x20b>
+  802f73:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802f7a:	20 45 4c             	and    %al,0x4c(%rbp)
+  802f7d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802f81:	61                   	(bad)
+  802f82:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802f87:	20 73 75             	and    %dh,0x75(%rbx)
+  802f8a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802f8d:	73 79                	jae    803008 <__rodata_start+0x2a0>
+  802f8f:	73 74                	jae    803005 <__rodata_start+0x29d>
+  802f91:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802f93:	20 63 61             	and    %ah,0x61(%rbx)
+  802f96:	6c                   	insb   (%dx),%es:(%rdi)
+  802f97:	6c                   	insb   (%dx),%es:(%rdi)
+  802f98:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802f9b:	74 72                	je     80300f <__rodata_start+0x2a7>
+  802f9d:	79 20                	jns    802fbf <__rodata_start+0x257>
+  802f9f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fa0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fa1:	74 20                	je     802fc3 <__rodata_start+0x25b>
+  802fa3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802fa5:	75 6e                	jne    803015 <__rodata_start+0x2ad>
+  802fa7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802fab:	76 20                	jbe    802fcd <__rodata_start+0x265>
+  802fad:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802fb4:	72 65                	jb     80301b <__rodata_start+0x2b3>
+  802fb6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802fb9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fba:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802fbe:	65 78 70             	gs js  803031 <__rodata_start+0x2c9>
+  802fc1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802fc6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802fc9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802fcd:	20 66 69             	and    %ah,0x69(%rsi)
+  802fd0:	6c                   	insb   (%dx),%es:(%rdi)
+  802fd1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802fd5:	20 66 72             	and    %ah,0x72(%rsi)
+  802fd8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802fdd:	61                   	(bad)
+  802fde:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802fe1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fe2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fe3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802fe7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802fea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802feb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fec:	20 6d 61             	and    %ch,0x61(%rbp)
+  802fef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ff0:	79 20                	jns    803012 <__rodata_start+0x2aa>
+  802ff2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802ff9:	72 65                	jb     803060 <__rodata_start+0x2f8>
+  802ffb:	20 6f 70             	and    %ch,0x70(%rdi)
+  802ffe:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803000:	00 66 69             	add    %ah,0x69(%rsi)
+  803003:	6c                   	insb   (%dx),%es:(%rdi)
+  803004:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803008:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80300b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80300c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80300f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803010:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803011:	74 20                	je     803033 <__rodata_start+0x2cb>
+  803013:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803015:	75 6e                	jne    803085 <__rodata_start+0x31d>
+  803017:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80301b:	76 61                	jbe    80307e <__rodata_start+0x316>
+  80301d:	6c                   	insb   (%dx),%es:(%rdi)
+  80301e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803025:	00 
+  803026:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80302d:	72 65                	jb     803094 <__rodata_start+0x32c>
+  80302f:	61                   	(bad)
+  803030:	64 79 20             	fs jns 803053 <__rodata_start+0x2eb>
+  803033:	65 78 69             	gs js  80309f <__rodata_start+0x337>
+  803036:	73 74                	jae    8030ac <__rodata_start+0x344>
+  803038:	73 00                	jae    80303a <__rodata_start+0x2d2>
+  80303a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80303b:	70 65                	jo     8030a2 <__rodata_start+0x33a>
+  80303d:	72 61                	jb     8030a0 <__rodata_start+0x338>
+  80303f:	74 69                	je     8030aa <__rodata_start+0x342>
+  803041:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803042:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803043:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803046:	74 20                	je     803068 <__rodata_start+0x300>
+  803048:	73 75                	jae    8030bf <__rodata_start+0x357>
+  80304a:	70 70                	jo     8030bc <__rodata_start+0x354>
+  80304c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80304d:	72 74                	jb     8030c3 <__rodata_start+0x35b>
+  80304f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803054:	65 72 61             	gs jb  8030b8 <__rodata_start+0x350>
+  803057:	74 69                	je     8030c2 <__rodata_start+0x35a>
+  803059:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80305a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80305b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80305e:	74 20                	je     803080 <__rodata_start+0x318>
+  803060:	70 65                	jo     8030c7 <__rodata_start+0x35f>
+  803062:	72 6d                	jb     8030d1 <__rodata_start+0x369>
+  803064:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  80306b:	2e 
+  80306c:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803073:	00 
+  803074:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80307b:	00 00 00 
+  80307e:	66 90                	xchg   %ax,%ax
+  803080:	82                   	(bad)
+  803081:	06                   	(bad)
+  803082:	80 00 00             	addb   $0x0,(%rax)
+  803085:	00 00                	add    %al,(%rax)
+  803087:	00 c3                	add    %al,%bl
+  803089:	0c 80                	or     $0x80,%al
+  80308b:	00 00                	add    %al,(%rax)
+  80308d:	00 00                	add    %al,(%rax)
+  80308f:	00 b3 0c 80 00 00    	add    %dh,0x800c(%rbx)
+  803095:	00 00                	add    %al,(%rax)
+  803097:	00 c3                	add    %al,%bl
+  803099:	0c 80                	or     $0x80,%al
+  80309b:	00 00                	add    %al,(%rax)
+  80309d:	00 00                	add    %al,(%rax)
+  80309f:	00 c3                	add    %al,%bl
+  8030a1:	0c 80                	or     $0x80,%al
+  8030a3:	00 00                	add    %al,(%rax)
+  8030a5:	00 00                	add    %al,(%rax)
+  8030a7:	00 c3                	add    %al,%bl
+  8030a9:	0c 80                	or     $0x80,%al
+  8030ab:	00 00                	add    %al,(%rax)
+  8030ad:	00 00                	add    %al,(%rax)
+  8030af:	00 c3                	add    %al,%bl
+  8030b1:	0c 80                	or     $0x80,%al
+  8030b3:	00 00                	add    %al,(%rax)
+  8030b5:	00 00                	add    %al,(%rax)
+  8030b7:	00 a1 06 80 00 00    	add    %ah,0x8006(%rcx)
+  8030bd:	00 00                	add    %al,(%rax)
+  8030bf:	00 c3                	add    %al,%bl
+  8030c1:	0c 80                	or     $0x80,%al
+  8030c3:	00 00                	add    %al,(%rax)
+  8030c5:	00 00                	add    %al,(%rax)
+  8030c7:	00 c3                	add    %al,%bl
+  8030c9:	0c 80                	or     $0x80,%al
+  8030cb:	00 00                	add    %al,(%rax)
+  8030cd:	00 00                	add    %al,(%rax)
+  8030cf:	00 95 06 80 00 00    	add    %dl,0x8006(%rbp)
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 0f                	add    %cl,(%rdi)
+  8030d9:	07                   	(bad)
+  8030da:	80 00 00             	addb   $0x0,(%rax)
+  8030dd:	00 00                	add    %al,(%rax)
+  8030df:	00 c3                	add    %al,%bl
+  8030e1:	0c 80                	or     $0x80,%al
+  8030e3:	00 00                	add    %al,(%rax)
+  8030e5:	00 00                	add    %al,(%rax)
+  8030e7:	00 95 06 80 00 00    	add    %dl,0x8006(%rbp)
+  8030ed:	00 00                	add    %al,(%rax)
+  8030ef:	00 db                	add    %bl,%bl
+  8030f1:	06                   	(bad)
+  8030f2:	80 00 00             	addb   $0x0,(%rax)
+  8030f5:	00 00                	add    %al,(%rax)
+  8030f7:	00 db                	add    %bl,%bl
+  8030f9:	06                   	(bad)
+  8030fa:	80 00 00             	addb   $0x0,(%rax)
+  8030fd:	00 00                	add    %al,(%rax)
+  8030ff:	00 db                	add    %bl,%bl
+  803101:	06                   	(bad)
+  803102:	80 00 00             	addb   $0x0,(%rax)
+  803105:	00 00                	add    %al,(%rax)
+  803107:	00 db                	add    %bl,%bl
+  803109:	06                   	(bad)
+  80310a:	80 00 00             	addb   $0x0,(%rax)
+  80310d:	00 00                	add    %al,(%rax)
+  80310f:	00 db                	add    %bl,%bl
+  803111:	06                   	(bad)
+  803112:	80 00 00             	addb   $0x0,(%rax)
+  803115:	00 00                	add    %al,(%rax)
+  803117:	00 db                	add    %bl,%bl
+  803119:	06                   	(bad)
+  80311a:	80 00 00             	addb   $0x0,(%rax)
+  80311d:	00 00                	add    %al,(%rax)
+  80311f:	00 db                	add    %bl,%bl
+  803121:	06                   	(bad)
+  803122:	80 00 00             	addb   $0x0,(%rax)
+  803125:	00 00                	add    %al,(%rax)
+  803127:	00 db                	add    %bl,%bl
+  803129:	06                   	(bad)
+  80312a:	80 00 00             	addb   $0x0,(%rax)
+  80312d:	00 00                	add    %al,(%rax)
+  80312f:	00 db                	add    %bl,%bl
+  803131:	06                   	(bad)
+  803132:	80 00 00             	addb   $0x0,(%rax)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 c3                	add    %al,%bl
+  803139:	0c 80                	or     $0x80,%al
+  80313b:	00 00                	add    %al,(%rax)
+  80313d:	00 00                	add    %al,(%rax)
+  80313f:	00 c3                	add    %al,%bl
+  803141:	0c 80                	or     $0x80,%al
+  803143:	00 00                	add    %al,(%rax)
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 c3                	add    %al,%bl
+  803149:	0c 80                	or     $0x80,%al
+  80314b:	00 00                	add    %al,(%rax)
+  80314d:	00 00                	add    %al,(%rax)
+  80314f:	00 c3                	add    %al,%bl
+  803151:	0c 80                	or     $0x80,%al
+  803153:	00 00                	add    %al,(%rax)
+  803155:	00 00                	add    %al,(%rax)
+  803157:	00 c3                	add    %al,%bl
+  803159:	0c 80                	or     $0x80,%al
+  80315b:	00 00                	add    %al,(%rax)
+  80315d:	00 00                	add    %al,(%rax)
+  80315f:	00 c3                	add    %al,%bl
+  803161:	0c 80                	or     $0x80,%al
+  803163:	00 00                	add    %al,(%rax)
+  803165:	00 00                	add    %al,(%rax)
+  803167:	00 c3                	add    %al,%bl
+  803169:	0c 80                	or     $0x80,%al
+  80316b:	00 00                	add    %al,(%rax)
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 c3                	add    %al,%bl
+  803171:	0c 80                	or     $0x80,%al
+  803173:	00 00                	add    %al,(%rax)
+  803175:	00 00                	add    %al,(%rax)
+  803177:	00 c3                	add    %al,%bl
+  803179:	0c 80                	or     $0x80,%al
+  80317b:	00 00                	add    %al,(%rax)
+  80317d:	00 00                	add    %al,(%rax)
+  80317f:	00 c3                	add    %al,%bl
+  803181:	0c 80                	or     $0x80,%al
+  803183:	00 00                	add    %al,(%rax)
+  803185:	00 00                	add    %al,(%rax)
+  803187:	00 c3                	add    %al,%bl
+  803189:	0c 80                	or     $0x80,%al
+  80318b:	00 00                	add    %al,(%rax)
+  80318d:	00 00                	add    %al,(%rax)
+  80318f:	00 c3                	add    %al,%bl
+  803191:	0c 80                	or     $0x80,%al
+  803193:	00 00                	add    %al,(%rax)
+  803195:	00 00                	add    %al,(%rax)
+  803197:	00 c3                	add    %al,%bl
+  803199:	0c 80                	or     $0x80,%al
+  80319b:	00 00                	add    %al,(%rax)
+  80319d:	00 00                	add    %al,(%rax)
+  80319f:	00 c3                	add    %al,%bl
+  8031a1:	0c 80                	or     $0x80,%al
+  8031a3:	00 00                	add    %al,(%rax)
+  8031a5:	00 00                	add    %al,(%rax)
+  8031a7:	00 c3                	add    %al,%bl
+  8031a9:	0c 80                	or     $0x80,%al
+  8031ab:	00 00                	add    %al,(%rax)
+  8031ad:	00 00                	add    %al,(%rax)
+  8031af:	00 c3                	add    %al,%bl
+  8031b1:	0c 80                	or     $0x80,%al
+  8031b3:	00 00                	add    %al,(%rax)
+  8031b5:	00 00                	add    %al,(%rax)
+  8031b7:	00 c3                	add    %al,%bl
+  8031b9:	0c 80                	or     $0x80,%al
+  8031bb:	00 00                	add    %al,(%rax)
+  8031bd:	00 00                	add    %al,(%rax)
+  8031bf:	00 c3                	add    %al,%bl
+  8031c1:	0c 80                	or     $0x80,%al
+  8031c3:	00 00                	add    %al,(%rax)
+  8031c5:	00 00                	add    %al,(%rax)
+  8031c7:	00 c3                	add    %al,%bl
+  8031c9:	0c 80                	or     $0x80,%al
+  8031cb:	00 00                	add    %al,(%rax)
+  8031cd:	00 00                	add    %al,(%rax)
+  8031cf:	00 c3                	add    %al,%bl
+  8031d1:	0c 80                	or     $0x80,%al
+  8031d3:	00 00                	add    %al,(%rax)
+  8031d5:	00 00                	add    %al,(%rax)
+  8031d7:	00 c3                	add    %al,%bl
+  8031d9:	0c 80                	or     $0x80,%al
+  8031db:	00 00                	add    %al,(%rax)
+  8031dd:	00 00                	add    %al,(%rax)
+  8031df:	00 c3                	add    %al,%bl
+  8031e1:	0c 80                	or     $0x80,%al
+  8031e3:	00 00                	add    %al,(%rax)
+  8031e5:	00 00                	add    %al,(%rax)
+  8031e7:	00 c3                	add    %al,%bl
+  8031e9:	0c 80                	or     $0x80,%al
+  8031eb:	00 00                	add    %al,(%rax)
+  8031ed:	00 00                	add    %al,(%rax)
+  8031ef:	00 c3                	add    %al,%bl
+  8031f1:	0c 80                	or     $0x80,%al
+  8031f3:	00 00                	add    %al,(%rax)
+  8031f5:	00 00                	add    %al,(%rax)
+  8031f7:	00 c3                	add    %al,%bl
+  8031f9:	0c 80                	or     $0x80,%al
+  8031fb:	00 00                	add    %al,(%rax)
+  8031fd:	00 00                	add    %al,(%rax)
+  8031ff:	00 c3                	add    %al,%bl
+  803201:	0c 80                	or     $0x80,%al
+  803203:	00 00                	add    %al,(%rax)
+  803205:	00 00                	add    %al,(%rax)
+  803207:	00 c3                	add    %al,%bl
+  803209:	0c 80                	or     $0x80,%al
+  80320b:	00 00                	add    %al,(%rax)
+  80320d:	00 00                	add    %al,(%rax)
+  80320f:	00 c3                	add    %al,%bl
+  803211:	0c 80                	or     $0x80,%al
+  803213:	00 00                	add    %al,(%rax)
+  803215:	00 00                	add    %al,(%rax)
+  803217:	00 c3                	add    %al,%bl
+  803219:	0c 80                	or     $0x80,%al
+  80321b:	00 00                	add    %al,(%rax)
+  80321d:	00 00                	add    %al,(%rax)
+  80321f:	00 c3                	add    %al,%bl
+  803221:	0c 80                	or     $0x80,%al
+  803223:	00 00                	add    %al,(%rax)
+  803225:	00 00                	add    %al,(%rax)
+  803227:	00 e6                	add    %ah,%dh
+  803229:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80322f:	00 c3                	add    %al,%bl
+  803231:	0c 80                	or     $0x80,%al
+  803233:	00 00                	add    %al,(%rax)
+  803235:	00 00                	add    %al,(%rax)
+  803237:	00 c3                	add    %al,%bl
+  803239:	0c 80                	or     $0x80,%al
+  80323b:	00 00                	add    %al,(%rax)
+  80323d:	00 00                	add    %al,(%rax)
+  80323f:	00 c3                	add    %al,%bl
+  803241:	0c 80                	or     $0x80,%al
+  803243:	00 00                	add    %al,(%rax)
+  803245:	00 00                	add    %al,(%rax)
+  803247:	00 c3                	add    %al,%bl
+  803249:	0c 80                	or     $0x80,%al
+  80324b:	00 00                	add    %al,(%rax)
+  80324d:	00 00                	add    %al,(%rax)
+  80324f:	00 c3                	add    %al,%bl
+  803251:	0c 80                	or     $0x80,%al
+  803253:	00 00                	add    %al,(%rax)
+  803255:	00 00                	add    %al,(%rax)
+  803257:	00 c3                	add    %al,%bl
+  803259:	0c 80                	or     $0x80,%al
+  80325b:	00 00                	add    %al,(%rax)
+  80325d:	00 00                	add    %al,(%rax)
+  80325f:	00 c3                	add    %al,%bl
+  803261:	0c 80                	or     $0x80,%al
+  803263:	00 00                	add    %al,(%rax)
+  803265:	00 00                	add    %al,(%rax)
+  803267:	00 c3                	add    %al,%bl
+  803269:	0c 80                	or     $0x80,%al
+  80326b:	00 00                	add    %al,(%rax)
+  80326d:	00 00                	add    %al,(%rax)
+  80326f:	00 c3                	add    %al,%bl
+  803271:	0c 80                	or     $0x80,%al
+  803273:	00 00                	add    %al,(%rax)
+  803275:	00 00                	add    %al,(%rax)
+  803277:	00 c3                	add    %al,%bl
+  803279:	0c 80                	or     $0x80,%al
+  80327b:	00 00                	add    %al,(%rax)
+  80327d:	00 00                	add    %al,(%rax)
+  80327f:	00 32                	add    %dh,(%rdx)
+  803281:	07                   	(bad)
+  803282:	80 00 00             	addb   $0x0,(%rax)
+  803285:	00 00                	add    %al,(%rax)
+  803287:	00 01                	add    %al,(%rcx)
+  803289:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80328f:	00 c3                	add    %al,%bl
+  803291:	0c 80                	or     $0x80,%al
+  803293:	00 00                	add    %al,(%rax)
+  803295:	00 00                	add    %al,(%rax)
+  803297:	00 c3                	add    %al,%bl
+  803299:	0c 80                	or     $0x80,%al
+  80329b:	00 00                	add    %al,(%rax)
+  80329d:	00 00                	add    %al,(%rax)
+  80329f:	00 c3                	add    %al,%bl
+  8032a1:	0c 80                	or     $0x80,%al
+  8032a3:	00 00                	add    %al,(%rax)
+  8032a5:	00 00                	add    %al,(%rax)
+  8032a7:	00 c3                	add    %al,%bl
+  8032a9:	0c 80                	or     $0x80,%al
+  8032ab:	00 00                	add    %al,(%rax)
+  8032ad:	00 00                	add    %al,(%rax)
+  8032af:	00 61 07             	add    %ah,0x7(%rcx)
+  8032b2:	80 00 00             	addb   $0x0,(%rax)
+  8032b5:	00 00                	add    %al,(%rax)
+  8032b7:	00 c3                	add    %al,%bl
+  8032b9:	0c 80                	or     $0x80,%al
+  8032bb:	00 00                	add    %al,(%rax)
+  8032bd:	00 00                	add    %al,(%rax)
+  8032bf:	00 c3                	add    %al,%bl
+  8032c1:	0c 80                	or     $0x80,%al
+  8032c3:	00 00                	add    %al,(%rax)
+  8032c5:	00 00                	add    %al,(%rax)
+  8032c7:	00 27                	add    %ah,(%rdi)
+  8032c9:	07                   	(bad)
+  8032ca:	80 00 00             	addb   $0x0,(%rax)
+  8032cd:	00 00                	add    %al,(%rax)
+  8032cf:	00 c3                	add    %al,%bl
+  8032d1:	0c 80                	or     $0x80,%al
+  8032d3:	00 00                	add    %al,(%rax)
+  8032d5:	00 00                	add    %al,(%rax)
+  8032d7:	00 c3                	add    %al,%bl
+  8032d9:	0c 80                	or     $0x80,%al
+  8032db:	00 00                	add    %al,(%rax)
+  8032dd:	00 00                	add    %al,(%rax)
+  8032df:	00 a9 0a 80 00 00    	add    %ch,0x800a(%rcx)
+  8032e5:	00 00                	add    %al,(%rax)
+  8032e7:	00 73 0b             	add    %dh,0xb(%rbx)
+  8032ea:	80 00 00             	addb   $0x0,(%rax)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 c3                	add    %al,%bl
+  8032f1:	0c 80                	or     $0x80,%al
+  8032f3:	00 00                	add    %al,(%rax)
+  8032f5:	00 00                	add    %al,(%rax)
+  8032f7:	00 c3                	add    %al,%bl
+  8032f9:	0c 80                	or     $0x80,%al
+  8032fb:	00 00                	add    %al,(%rax)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 f8                	add    %bh,%al
+  803301:	07                   	(bad)
+  803302:	80 00 00             	addb   $0x0,(%rax)
+  803305:	00 00                	add    %al,(%rax)
+  803307:	00 c3                	add    %al,%bl
+  803309:	0c 80                	or     $0x80,%al
+  80330b:	00 00                	add    %al,(%rax)
+  80330d:	00 00                	add    %al,(%rax)
+  80330f:	00 d5                	add    %dl,%ch
+  803311:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803317:	00 c3                	add    %al,%bl
+  803319:	0c 80                	or     $0x80,%al
+  80331b:	00 00                	add    %al,(%rax)
+  80331d:	00 00                	add    %al,(%rax)
+  80331f:	00 c3                	add    %al,%bl
+  803321:	0c 80                	or     $0x80,%al
+  803323:	00 00                	add    %al,(%rax)
+  803325:	00 00                	add    %al,(%rax)
+  803327:	00 e6                	add    %ah,%dh
+  803329:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80332f:	00 c3                	add    %al,%bl
+  803331:	0c 80                	or     $0x80,%al
+  803333:	00 00                	add    %al,(%rax)
+  803335:	00 00                	add    %al,(%rax)
+  803337:	00 8b 06 80 00 00    	add    %cl,0x8006(%rbx)
+  80333d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803340 <error_string>:
+	...
+  803348:	f5 2e 80 00 00 00 00 00 07 2f 80 00 00 00 00 00     ........./......
+  803358:	17 2f 80 00 00 00 00 00 29 2f 80 00 00 00 00 00     ./......)/......
+  803368:	37 2f 80 00 00 00 00 00 4b 2f 80 00 00 00 00 00     7/......K/......
+  803378:	60 2f 80 00 00 00 00 00 73 2f 80 00 00 00 00 00     `/......s/......
+  803388:	85 2f 80 00 00 00 00 00 99 2f 80 00 00 00 00 00     ./......./......
+  803398:	a9 2f 80 00 00 00 00 00 bc 2f 80 00 00 00 00 00     ./......./......
+  8033a8:	d3 2f 80 00 00 00 00 00 e9 2f 80 00 00 00 00 00     ./......./......
+  8033b8:	01 30 80 00 00 00 00 00 19 30 80 00 00 00 00 00     .0.......0......
+  8033c8:	26 30 80 00 00 00 00 00 f0 33 80 00 00 00 00 00     &0.......3......
+  8033d8:	3a 30 80 00 00 00 00 00 00 00 00 00 00 00 00 00     :0..............
+  8033e8:	52 30 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     R0......file is 
+  8033f8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803408:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803418:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803428:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803438:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803448:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803458:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803468:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803478:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803488:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803498:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8034a8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8034b8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008034c0 <devtab>:
+  8034c0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8034d0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8034e0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8034f0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803500:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803510:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803520:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803530:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803540:	69 70 63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64     ipc_send: failed
+  803550:	20 74 6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63      to send.lib/ipc
+  803560:	2e 63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     .c.f.........f..
+  803570:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803580:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803590:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803600:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803610:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803620:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803630:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803640:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803650:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803660:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803670:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803680:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803690:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803700:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
@@ -0,0 +1,6409 @@
+
+obj/user/icode:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c9 01 00 00       	call   8001ec <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 81 ec 18 02 00 00 	sub    $0x218,%rsp
+    int fd, n, r;
+    char buf[512 + 1];
+
+    binaryname = "icode";
+  800035:	48 b8 20 35 80 00 00 	movabs $0x803520,%rax
+  80003c:	00 00 00 
+  80003f:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800046:	00 00 00 
+
+    cprintf("icode startup\n");
+  800049:	48 bf 26 35 80 00 00 	movabs $0x803526,%rdi
+  800050:	00 00 00 
+  800053:	b8 00 00 00 00       	mov    $0x0,%eax
+  800058:	48 bb 06 04 80 00 00 	movabs $0x800406,%rbx
+  80005f:	00 00 00 
+  800062:	ff d3                	call   *%rbx
+
+    cprintf("icode: open /motd\n");
+  800064:	48 bf 35 35 80 00 00 	movabs $0x803535,%rdi
+  80006b:	00 00 00 
+  80006e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800073:	ff d3                	call   *%rbx
+    if ((fd = open("/motd", O_RDONLY)) < 0)
+  800075:	be 00 00 00 00       	mov    $0x0,%esi
+  80007a:	48 bf 48 35 80 00 00 	movabs $0x803548,%rdi
+  800081:	00 00 00 
+  800084:	48 b8 ac 21 80 00 00 	movabs $0x8021ac,%rax
+  80008b:	00 00 00 
+  80008e:	ff d0                	call   *%rax
+  800090:	89 c3                	mov    %eax,%ebx
+  800092:	85 c0                	test   %eax,%eax
+  800094:	78 31                	js     8000c7 <umain+0xa2>
+        panic("icode: open /motd: %i", fd);
+
+    cprintf("icode: read /motd\n");
+  800096:	48 bf 71 35 80 00 00 	movabs $0x803571,%rdi
+  80009d:	00 00 00 
+  8000a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a5:	48 ba 06 04 80 00 00 	movabs $0x800406,%rdx
+  8000ac:	00 00 00 
+  8000af:	ff d2                	call   *%rdx
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  8000b1:	49 bc ee 1b 80 00 00 	movabs $0x801bee,%r12
+  8000b8:	00 00 00 
+        sys_cputs(buf, n);
+  8000bb:	49 bd 52 11 80 00 00 	movabs $0x801152,%r13
+  8000c2:	00 00 00 
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  8000c5:	eb 3a                	jmp    800101 <umain+0xdc>
+        panic("icode: open /motd: %i", fd);
+  8000c7:	89 c1                	mov    %eax,%ecx
+  8000c9:	48 ba 4e 35 80 00 00 	movabs $0x80354e,%rdx
+  8000d0:	00 00 00 
+  8000d3:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000d8:	48 bf 64 35 80 00 00 	movabs $0x803564,%rdi
+  8000df:	00 00 00 
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e7:	49 b8 b6 02 80 00 00 	movabs $0x8002b6,%r8
+  8000ee:	00 00 00 
+  8000f1:	41 ff d0             	call   *%r8
+        sys_cputs(buf, n);
+  8000f4:	48 63 f0             	movslq %eax,%rsi
+  8000f7:	48 8d bd df fd ff ff 	lea    -0x221(%rbp),%rdi
+  8000fe:	41 ff d5             	call   *%r13
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  800101:	ba 00 02 00 00       	mov    $0x200,%edx
+  800106:	48 8d b5 df fd ff ff 	lea    -0x221(%rbp),%rsi
+  80010d:	89 df                	mov    %ebx,%edi
+  80010f:	41 ff d4             	call   *%r12
+  800112:	85 c0                	test   %eax,%eax
+  800114:	7f de                	jg     8000f4 <umain+0xcf>
+
+    cprintf("icode: close /motd\n");
+  800116:	48 bf 84 35 80 00 00 	movabs $0x803584,%rdi
+  80011d:	00 00 00 
+  800120:	b8 00 00 00 00       	mov    $0x0,%eax
+  800125:	49 bc 06 04 80 00 00 	movabs $0x800406,%r12
+  80012c:	00 00 00 
+  80012f:	41 ff d4             	call   *%r12
+    close(fd);
+  800132:	89 df                	mov    %ebx,%edi
+  800134:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  80013b:	00 00 00 
+  80013e:	ff d0                	call   *%rax
+
+    cprintf("icode: spawn /init\n");
+  800140:	48 bf 98 35 80 00 00 	movabs $0x803598,%rdi
+  800147:	00 00 00 
+  80014a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014f:	41 ff d4             	call   *%r12
+    if ((r = spawnl("/init", "init", "initarg1", "initarg2", (char *)0)) < 0)
+  800152:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800158:	48 b9 ac 35 80 00 00 	movabs $0x8035ac,%rcx
+  80015f:	00 00 00 
+  800162:	48 ba b5 35 80 00 00 	movabs $0x8035b5,%rdx
+  800169:	00 00 00 
+  80016c:	48 be bf 35 80 00 00 	movabs $0x8035bf,%rsi
+  800173:	00 00 00 
+  800176:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  80017d:	00 00 00 
+  800180:	b8 00 00 00 00       	mov    $0x0,%eax
+  800185:	49 b9 c2 29 80 00 00 	movabs $0x8029c2,%r9
+  80018c:	00 00 00 
+  80018f:	41 ff d1             	call   *%r9
+  800192:	85 c0                	test   %eax,%eax
+  800194:	78 29                	js     8001bf <umain+0x19a>
+        panic("icode: spawn /init: %i", r);
+
+    cprintf("icode: exiting\n");
+  800196:	48 bf db 35 80 00 00 	movabs $0x8035db,%rdi
+  80019d:	00 00 00 
+  8001a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a5:	48 ba 06 04 80 00 00 	movabs $0x800406,%rdx
+  8001ac:	00 00 00 
+  8001af:	ff d2                	call   *%rdx
+}
+  8001b1:	48 81 c4 18 02 00 00 	add    $0x218,%rsp
+  8001b8:	5b                   	pop    %rbx
+  8001b9:	41 5c                	pop    %r12
+  8001bb:	41 5d                	pop    %r13
+  8001bd:	5d                   	pop    %rbp
+  8001be:	c3                   	ret
+        panic("icode: spawn /init: %i", r);
+  8001bf:	89 c1                	mov    %eax,%ecx
+  8001c1:	48 ba c4 35 80 00 00 	movabs $0x8035c4,%rdx
+  8001c8:	00 00 00 
+  8001cb:	be 19 00 00 00       	mov    $0x19,%esi
+  8001d0:	48 bf 64 35 80 00 00 	movabs $0x803564,%rdi
+  8001d7:	00 00 00 
+  8001da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001df:	49 b8 b6 02 80 00 00 	movabs $0x8002b6,%r8
+  8001e6:	00 00 00 
+  8001e9:	41 ff d0             	call   *%r8
+
+00000000008001ec <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001ec:	55                   	push   %rbp
+  8001ed:	48 89 e5             	mov    %rsp,%rbp
+  8001f0:	41 56                	push   %r14
+  8001f2:	41 55                	push   %r13
+  8001f4:	41 54                	push   %r12
+  8001f6:	53                   	push   %rbx
+  8001f7:	41 89 fd             	mov    %edi,%r13d
+  8001fa:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001fd:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800204:	00 00 00 
+  800207:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80020e:	00 00 00 
+  800211:	48 39 c2             	cmp    %rax,%rdx
+  800214:	73 17                	jae    80022d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800216:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800219:	49 89 c4             	mov    %rax,%r12
+  80021c:	48 83 c3 08          	add    $0x8,%rbx
+  800220:	b8 00 00 00 00       	mov    $0x0,%eax
+  800225:	ff 53 f8             	call   *-0x8(%rbx)
+  800228:	4c 39 e3             	cmp    %r12,%rbx
+  80022b:	72 ef                	jb     80021c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  80022d:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  800234:	00 00 00 
+  800237:	ff d0                	call   *%rax
+  800239:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  80023c:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800243:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80024a:	00 00 00 
+  80024d:	48 01 d0             	add    %rdx,%rax
+  800250:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800257:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80025a:	45 85 ed             	test   %r13d,%r13d
+  80025d:	7e 0d                	jle    80026c <libmain+0x80>
+  80025f:	49 8b 06             	mov    (%r14),%rax
+  800262:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800269:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80026c:	4c 89 f6             	mov    %r14,%rsi
+  80026f:	44 89 ef             	mov    %r13d,%edi
+  800272:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800279:	00 00 00 
+  80027c:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80027e:	48 b8 93 02 80 00 00 	movabs $0x800293,%rax
+  800285:	00 00 00 
+  800288:	ff d0                	call   *%rax
+#endif
+}
+  80028a:	5b                   	pop    %rbx
+  80028b:	41 5c                	pop    %r12
+  80028d:	41 5d                	pop    %r13
+  80028f:	41 5e                	pop    %r14
+  800291:	5d                   	pop    %rbp
+  800292:	c3                   	ret
+
+0000000000800293 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800293:	55                   	push   %rbp
+  800294:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800297:	48 b8 a3 1a 80 00 00 	movabs $0x801aa3,%rax
+  80029e:	00 00 00 
+  8002a1:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002a8:	48 b8 b0 11 80 00 00 	movabs $0x8011b0,%rax
+  8002af:	00 00 00 
+  8002b2:	ff d0                	call   *%rax
+}
+  8002b4:	5d                   	pop    %rbp
+  8002b5:	c3                   	ret
+
+00000000008002b6 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8002b6:	55                   	push   %rbp
+  8002b7:	48 89 e5             	mov    %rsp,%rbp
+  8002ba:	41 56                	push   %r14
+  8002bc:	41 55                	push   %r13
+  8002be:	41 54                	push   %r12
+  8002c0:	53                   	push   %rbx
+  8002c1:	48 83 ec 50          	sub    $0x50,%rsp
+  8002c5:	49 89 fc             	mov    %rdi,%r12
+  8002c8:	41 89 f5             	mov    %esi,%r13d
+  8002cb:	48 89 d3             	mov    %rdx,%rbx
+  8002ce:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002d2:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002d6:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002da:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8002e1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002e5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002e9:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002ed:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002f1:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8002f8:	00 00 00 
+  8002fb:	4c 8b 30             	mov    (%rax),%r14
+  8002fe:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  800305:	00 00 00 
+  800308:	ff d0                	call   *%rax
+  80030a:	89 c6                	mov    %eax,%esi
+  80030c:	45 89 e8             	mov    %r13d,%r8d
+  80030f:	4c 89 e1             	mov    %r12,%rcx
+  800312:	4c 89 f2             	mov    %r14,%rdx
+  800315:	48 bf f8 35 80 00 00 	movabs $0x8035f8,%rdi
+  80031c:	00 00 00 
+  80031f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800324:	49 bc 06 04 80 00 00 	movabs $0x800406,%r12
+  80032b:	00 00 00 
+  80032e:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800331:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800335:	48 89 df             	mov    %rbx,%rdi
+  800338:	48 b8 a2 03 80 00 00 	movabs $0x8003a2,%rax
+  80033f:	00 00 00 
+  800342:	ff d0                	call   *%rax
+    cprintf("\n");
+  800344:	48 bf 82 35 80 00 00 	movabs $0x803582,%rdi
+  80034b:	00 00 00 
+  80034e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800353:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800356:	cc                   	int3
+  800357:	eb fd                	jmp    800356 <_panic+0xa0>
+
+0000000000800359 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800359:	55                   	push   %rbp
+  80035a:	48 89 e5             	mov    %rsp,%rbp
+  80035d:	53                   	push   %rbx
+  80035e:	48 83 ec 08          	sub    $0x8,%rsp
+  800362:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800365:	8b 06                	mov    (%rsi),%eax
+  800367:	8d 50 01             	lea    0x1(%rax),%edx
+  80036a:	89 16                	mov    %edx,(%rsi)
+  80036c:	48 98                	cltq
+  80036e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800373:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800379:	74 0a                	je     800385 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80037b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80037f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800383:	c9                   	leave
+  800384:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800385:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800389:	be ff 00 00 00       	mov    $0xff,%esi
+  80038e:	48 b8 52 11 80 00 00 	movabs $0x801152,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+        state->offset = 0;
+  80039a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003a0:	eb d9                	jmp    80037b <putch+0x22>
+
+00000000008003a2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003a2:	55                   	push   %rbp
+  8003a3:	48 89 e5             	mov    %rsp,%rbp
+  8003a6:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003ad:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8003b0:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8003b7:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8003bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c1:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003c4:	48 89 f1             	mov    %rsi,%rcx
+  8003c7:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8003ce:	48 bf 59 03 80 00 00 	movabs $0x800359,%rdi
+  8003d5:	00 00 00 
+  8003d8:	48 b8 56 05 80 00 00 	movabs $0x800556,%rax
+  8003df:	00 00 00 
+  8003e2:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003e4:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003eb:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003f2:	48 b8 52 11 80 00 00 	movabs $0x801152,%rax
+  8003f9:	00 00 00 
+  8003fc:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003fe:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800404:	c9                   	leave
+  800405:	c3                   	ret
+
+0000000000800406 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800406:	55                   	push   %rbp
+  800407:	48 89 e5             	mov    %rsp,%rbp
+  80040a:	48 83 ec 50          	sub    $0x50,%rsp
+  80040e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800412:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800416:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80041a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80041e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800422:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800429:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80042d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800431:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800435:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800439:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80043d:	48 b8 a2 03 80 00 00 	movabs $0x8003a2,%rax
+  800444:	00 00 00 
+  800447:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800449:	c9                   	leave
+  80044a:	c3                   	ret
+
+000000000080044b <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80044b:	55                   	push   %rbp
+  80044c:	48 89 e5             	mov    %rsp,%rbp
+  80044f:	41 57                	push   %r15
+  800451:	41 56                	push   %r14
+  800453:	41 55                	push   %r13
+  800455:	41 54                	push   %r12
+  800457:	53                   	push   %rbx
+  800458:	48 83 ec 18          	sub    $0x18,%rsp
+  80045c:	49 89 fc             	mov    %rdi,%r12
+  80045f:	49 89 f5             	mov    %rsi,%r13
+  800462:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800466:	8b 45 10             	mov    0x10(%rbp),%eax
+  800469:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80046c:	41 89 cf             	mov    %ecx,%r15d
+  80046f:	4c 39 fa             	cmp    %r15,%rdx
+  800472:	73 5b                	jae    8004cf <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800474:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800478:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80047c:	85 db                	test   %ebx,%ebx
+  80047e:	7e 0e                	jle    80048e <print_num+0x43>
+            putch(padc, put_arg);
+  800480:	4c 89 ee             	mov    %r13,%rsi
+  800483:	44 89 f7             	mov    %r14d,%edi
+  800486:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800489:	83 eb 01             	sub    $0x1,%ebx
+  80048c:	75 f2                	jne    800480 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80048e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800492:	48 b9 2c 36 80 00 00 	movabs $0x80362c,%rcx
+  800499:	00 00 00 
+  80049c:	48 b8 1b 36 80 00 00 	movabs $0x80361b,%rax
+  8004a3:	00 00 00 
+  8004a6:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8004aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004b3:	49 f7 f7             	div    %r15
+  8004b6:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8004ba:	4c 89 ee             	mov    %r13,%rsi
+  8004bd:	41 ff d4             	call   *%r12
+}
+  8004c0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004c4:	5b                   	pop    %rbx
+  8004c5:	41 5c                	pop    %r12
+  8004c7:	41 5d                	pop    %r13
+  8004c9:	41 5e                	pop    %r14
+  8004cb:	41 5f                	pop    %r15
+  8004cd:	5d                   	pop    %rbp
+  8004ce:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8004cf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d8:	49 f7 f7             	div    %r15
+  8004db:	48 83 ec 08          	sub    $0x8,%rsp
+  8004df:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004e3:	52                   	push   %rdx
+  8004e4:	45 0f be c9          	movsbl %r9b,%r9d
+  8004e8:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004ec:	48 89 c2             	mov    %rax,%rdx
+  8004ef:	48 b8 4b 04 80 00 00 	movabs $0x80044b,%rax
+  8004f6:	00 00 00 
+  8004f9:	ff d0                	call   *%rax
+  8004fb:	48 83 c4 10          	add    $0x10,%rsp
+  8004ff:	eb 8d                	jmp    80048e <print_num+0x43>
+
+0000000000800501 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800501:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800505:	48 8b 06             	mov    (%rsi),%rax
+  800508:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80050c:	73 0a                	jae    800518 <sprintputch+0x17>
+        *state->start++ = ch;
+  80050e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800512:	48 89 16             	mov    %rdx,(%rsi)
+  800515:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800518:	c3                   	ret
+
+0000000000800519 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800519:	55                   	push   %rbp
+  80051a:	48 89 e5             	mov    %rsp,%rbp
+  80051d:	48 83 ec 50          	sub    $0x50,%rsp
+  800521:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800525:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800529:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80052d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800534:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800538:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80053c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800540:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800544:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800548:	48 b8 56 05 80 00 00 	movabs $0x800556,%rax
+  80054f:	00 00 00 
+  800552:	ff d0                	call   *%rax
+}
+  800554:	c9                   	leave
+  800555:	c3                   	ret
+
+0000000000800556 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800556:	55                   	push   %rbp
+  800557:	48 89 e5             	mov    %rsp,%rbp
+  80055a:	41 57                	push   %r15
+  80055c:	41 56                	push   %r14
+  80055e:	41 55                	push   %r13
+  800560:	41 54                	push   %r12
+  800562:	53                   	push   %rbx
+  800563:	48 83 ec 38          	sub    $0x38,%rsp
+  800567:	49 89 fe             	mov    %rdi,%r14
+  80056a:	49 89 f5             	mov    %rsi,%r13
+  80056d:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800570:	48 8b 01             	mov    (%rcx),%rax
+  800573:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800577:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80057b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80057f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800583:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800587:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80058b:	0f b6 3b             	movzbl (%rbx),%edi
+  80058e:	40 80 ff 25          	cmp    $0x25,%dil
+  800592:	74 18                	je     8005ac <vprintfmt+0x56>
+            if (!ch) return;
+  800594:	40 84 ff             	test   %dil,%dil
+  800597:	0f 84 b1 06 00 00    	je     800c4e <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80059d:	40 0f b6 ff          	movzbl %dil,%edi
+  8005a1:	4c 89 ee             	mov    %r13,%rsi
+  8005a4:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005a7:	4c 89 e3             	mov    %r12,%rbx
+  8005aa:	eb db                	jmp    800587 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8005ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8005b1:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8005b5:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8005ba:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005c0:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005c7:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005cb:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005d0:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005d5:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005d8:	83 e8 23             	sub    $0x23,%eax
+  8005db:	3c 57                	cmp    $0x57,%al
+  8005dd:	0f 87 51 06 00 00    	ja     800c34 <vprintfmt+0x6de>
+  8005e3:	0f b6 c0             	movzbl %al,%eax
+  8005e6:	48 b9 e0 37 80 00 00 	movabs $0x8037e0,%rcx
+  8005ed:	00 00 00 
+  8005f0:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005f3:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005f6:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005fa:	eb cf                	jmp    8005cb <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005fc:	49 89 dc             	mov    %rbx,%r12
+  8005ff:	be 01 00 00 00       	mov    $0x1,%esi
+  800604:	eb c5                	jmp    8005cb <vprintfmt+0x75>
+            padc = ch;
+  800606:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80060a:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80060d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800610:	eb b9                	jmp    8005cb <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800612:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800615:	83 f8 2f             	cmp    $0x2f,%eax
+  800618:	77 24                	ja     80063e <vprintfmt+0xe8>
+  80061a:	89 c1                	mov    %eax,%ecx
+  80061c:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800620:	83 c0 08             	add    $0x8,%eax
+  800623:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800626:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800629:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80062c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800630:	79 99                	jns    8005cb <vprintfmt+0x75>
+                width = precision;
+  800632:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800636:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80063c:	eb 8d                	jmp    8005cb <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80063e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800642:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800646:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80064a:	eb da                	jmp    800626 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80064c:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800651:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800655:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80065b:	3c 39                	cmp    $0x39,%al
+  80065d:	77 1c                	ja     80067b <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80065f:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800663:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800667:	0f b6 c0             	movzbl %al,%eax
+  80066a:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80066f:	0f b6 03             	movzbl (%rbx),%eax
+  800672:	3c 39                	cmp    $0x39,%al
+  800674:	76 e9                	jbe    80065f <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800676:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800679:	eb b1                	jmp    80062c <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80067b:	49 89 dc             	mov    %rbx,%r12
+  80067e:	eb ac                	jmp    80062c <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800680:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800683:	85 c9                	test   %ecx,%ecx
+  800685:	b8 00 00 00 00       	mov    $0x0,%eax
+  80068a:	0f 49 c1             	cmovns %ecx,%eax
+  80068d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800690:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800693:	e9 33 ff ff ff       	jmp    8005cb <vprintfmt+0x75>
+            lflag++;
+  800698:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80069b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80069e:	e9 28 ff ff ff       	jmp    8005cb <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a9:	77 19                	ja     8006c4 <vprintfmt+0x16e>
+  8006ab:	89 c2                	mov    %eax,%edx
+  8006ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b1:	83 c0 08             	add    $0x8,%eax
+  8006b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b7:	8b 3a                	mov    (%rdx),%edi
+  8006b9:	4c 89 ee             	mov    %r13,%rsi
+  8006bc:	41 ff d6             	call   *%r14
+            break;
+  8006bf:	e9 c3 fe ff ff       	jmp    800587 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d0:	eb e5                	jmp    8006b7 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d8:	77 5a                	ja     800734 <vprintfmt+0x1de>
+  8006da:	89 c2                	mov    %eax,%edx
+  8006dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e0:	83 c0 08             	add    $0x8,%eax
+  8006e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006e6:	8b 02                	mov    (%rdx),%eax
+  8006e8:	89 c1                	mov    %eax,%ecx
+  8006ea:	f7 d9                	neg    %ecx
+  8006ec:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006ef:	83 f9 15             	cmp    $0x15,%ecx
+  8006f2:	7f 4e                	jg     800742 <vprintfmt+0x1ec>
+  8006f4:	48 63 c1             	movslq %ecx,%rax
+  8006f7:	48 ba a0 3a 80 00 00 	movabs $0x803aa0,%rdx
+  8006fe:	00 00 00 
+  800701:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800705:	48 85 c0             	test   %rax,%rax
+  800708:	74 38                	je     800742 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80070a:	48 89 c1             	mov    %rax,%rcx
+  80070d:	48 ba cc 3c 80 00 00 	movabs $0x803ccc,%rdx
+  800714:	00 00 00 
+  800717:	4c 89 ee             	mov    %r13,%rsi
+  80071a:	4c 89 f7             	mov    %r14,%rdi
+  80071d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800722:	49 b8 19 05 80 00 00 	movabs $0x800519,%r8
+  800729:	00 00 00 
+  80072c:	41 ff d0             	call   *%r8
+  80072f:	e9 53 fe ff ff       	jmp    800587 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800734:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800738:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80073c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800740:	eb a4                	jmp    8006e6 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800742:	48 ba 44 36 80 00 00 	movabs $0x803644,%rdx
+  800749:	00 00 00 
+  80074c:	4c 89 ee             	mov    %r13,%rsi
+  80074f:	4c 89 f7             	mov    %r14,%rdi
+  800752:	b8 00 00 00 00       	mov    $0x0,%eax
+  800757:	49 b8 19 05 80 00 00 	movabs $0x800519,%r8
+  80075e:	00 00 00 
+  800761:	41 ff d0             	call   *%r8
+  800764:	e9 1e fe ff ff       	jmp    800587 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800769:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076c:	83 f8 2f             	cmp    $0x2f,%eax
+  80076f:	77 6c                	ja     8007dd <vprintfmt+0x287>
+  800771:	89 c2                	mov    %eax,%edx
+  800773:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800777:	83 c0 08             	add    $0x8,%eax
+  80077a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077d:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800780:	48 85 d2             	test   %rdx,%rdx
+  800783:	48 b8 3d 36 80 00 00 	movabs $0x80363d,%rax
+  80078a:	00 00 00 
+  80078d:	48 0f 45 c2          	cmovne %rdx,%rax
+  800791:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800795:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800799:	7e 06                	jle    8007a1 <vprintfmt+0x24b>
+  80079b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80079f:	75 4a                	jne    8007eb <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007a1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007a5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8007a9:	0f b6 00             	movzbl (%rax),%eax
+  8007ac:	84 c0                	test   %al,%al
+  8007ae:	0f 85 9a 00 00 00    	jne    80084e <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8007b4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007b7:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007bb:	85 c0                	test   %eax,%eax
+  8007bd:	0f 8e c4 fd ff ff    	jle    800587 <vprintfmt+0x31>
+  8007c3:	4c 89 ee             	mov    %r13,%rsi
+  8007c6:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007cb:	41 ff d6             	call   *%r14
+  8007ce:	41 83 ec 01          	sub    $0x1,%r12d
+  8007d2:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007d6:	75 eb                	jne    8007c3 <vprintfmt+0x26d>
+  8007d8:	e9 aa fd ff ff       	jmp    800587 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e9:	eb 92                	jmp    80077d <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007eb:	49 63 f7             	movslq %r15d,%rsi
+  8007ee:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007f2:	48 b8 08 0d 80 00 00 	movabs $0x800d08,%rax
+  8007f9:	00 00 00 
+  8007fc:	ff d0                	call   *%rax
+  8007fe:	48 89 c2             	mov    %rax,%rdx
+  800801:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800804:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800806:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800809:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80080c:	85 c0                	test   %eax,%eax
+  80080e:	7e 91                	jle    8007a1 <vprintfmt+0x24b>
+  800810:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800815:	4c 89 ee             	mov    %r13,%rsi
+  800818:	44 89 e7             	mov    %r12d,%edi
+  80081b:	41 ff d6             	call   *%r14
+  80081e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800822:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800825:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800828:	75 eb                	jne    800815 <vprintfmt+0x2bf>
+  80082a:	e9 72 ff ff ff       	jmp    8007a1 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80082f:	0f b6 f8             	movzbl %al,%edi
+  800832:	4c 89 ee             	mov    %r13,%rsi
+  800835:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800838:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80083c:	49 83 c4 01          	add    $0x1,%r12
+  800840:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800846:	84 c0                	test   %al,%al
+  800848:	0f 84 66 ff ff ff    	je     8007b4 <vprintfmt+0x25e>
+  80084e:	45 85 ff             	test   %r15d,%r15d
+  800851:	78 0a                	js     80085d <vprintfmt+0x307>
+  800853:	41 83 ef 01          	sub    $0x1,%r15d
+  800857:	0f 88 57 ff ff ff    	js     8007b4 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80085d:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800861:	74 cc                	je     80082f <vprintfmt+0x2d9>
+  800863:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800866:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80086b:	80 fa 5e             	cmp    $0x5e,%dl
+  80086e:	77 c2                	ja     800832 <vprintfmt+0x2dc>
+  800870:	eb bd                	jmp    80082f <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800872:	40 84 f6             	test   %sil,%sil
+  800875:	75 26                	jne    80089d <vprintfmt+0x347>
+    switch (lflag) {
+  800877:	85 d2                	test   %edx,%edx
+  800879:	74 59                	je     8008d4 <vprintfmt+0x37e>
+  80087b:	83 fa 01             	cmp    $0x1,%edx
+  80087e:	74 7b                	je     8008fb <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800880:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800883:	83 f8 2f             	cmp    $0x2f,%eax
+  800886:	0f 87 96 00 00 00    	ja     800922 <vprintfmt+0x3cc>
+  80088c:	89 c2                	mov    %eax,%edx
+  80088e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800892:	83 c0 08             	add    $0x8,%eax
+  800895:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800898:	4c 8b 22             	mov    (%rdx),%r12
+  80089b:	eb 17                	jmp    8008b4 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80089d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a3:	77 21                	ja     8008c6 <vprintfmt+0x370>
+  8008a5:	89 c2                	mov    %eax,%edx
+  8008a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ab:	83 c0 08             	add    $0x8,%eax
+  8008ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b1:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8008b4:	4d 85 e4             	test   %r12,%r12
+  8008b7:	78 7a                	js     800933 <vprintfmt+0x3dd>
+            num = i;
+  8008b9:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8008bc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8008c1:	e9 50 02 00 00       	jmp    800b16 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d2:	eb dd                	jmp    8008b1 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8008d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008da:	77 11                	ja     8008ed <vprintfmt+0x397>
+  8008dc:	89 c2                	mov    %eax,%edx
+  8008de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e2:	83 c0 08             	add    $0x8,%eax
+  8008e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e8:	4c 63 22             	movslq (%rdx),%r12
+  8008eb:	eb c7                	jmp    8008b4 <vprintfmt+0x35e>
+  8008ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f9:	eb ed                	jmp    8008e8 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800901:	77 11                	ja     800914 <vprintfmt+0x3be>
+  800903:	89 c2                	mov    %eax,%edx
+  800905:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800909:	83 c0 08             	add    $0x8,%eax
+  80090c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090f:	4c 8b 22             	mov    (%rdx),%r12
+  800912:	eb a0                	jmp    8008b4 <vprintfmt+0x35e>
+  800914:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800918:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800920:	eb ed                	jmp    80090f <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800922:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800926:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092e:	e9 65 ff ff ff       	jmp    800898 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800933:	4c 89 ee             	mov    %r13,%rsi
+  800936:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80093b:	41 ff d6             	call   *%r14
+                i = -i;
+  80093e:	49 f7 dc             	neg    %r12
+  800941:	e9 73 ff ff ff       	jmp    8008b9 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800946:	40 84 f6             	test   %sil,%sil
+  800949:	75 32                	jne    80097d <vprintfmt+0x427>
+    switch (lflag) {
+  80094b:	85 d2                	test   %edx,%edx
+  80094d:	74 5d                	je     8009ac <vprintfmt+0x456>
+  80094f:	83 fa 01             	cmp    $0x1,%edx
+  800952:	0f 84 82 00 00 00    	je     8009da <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800958:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095b:	83 f8 2f             	cmp    $0x2f,%eax
+  80095e:	0f 87 a5 00 00 00    	ja     800a09 <vprintfmt+0x4b3>
+  800964:	89 c2                	mov    %eax,%edx
+  800966:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096a:	83 c0 08             	add    $0x8,%eax
+  80096d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800970:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800973:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800978:	e9 99 01 00 00       	jmp    800b16 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80097d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800980:	83 f8 2f             	cmp    $0x2f,%eax
+  800983:	77 19                	ja     80099e <vprintfmt+0x448>
+  800985:	89 c2                	mov    %eax,%edx
+  800987:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098b:	83 c0 08             	add    $0x8,%eax
+  80098e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800991:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800994:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800999:	e9 78 01 00 00       	jmp    800b16 <vprintfmt+0x5c0>
+  80099e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009aa:	eb e5                	jmp    800991 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8009ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009af:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b2:	77 18                	ja     8009cc <vprintfmt+0x476>
+  8009b4:	89 c2                	mov    %eax,%edx
+  8009b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ba:	83 c0 08             	add    $0x8,%eax
+  8009bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c0:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8009c2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8009c7:	e9 4a 01 00 00       	jmp    800b16 <vprintfmt+0x5c0>
+  8009cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d8:	eb e6                	jmp    8009c0 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8009da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e0:	77 19                	ja     8009fb <vprintfmt+0x4a5>
+  8009e2:	89 c2                	mov    %eax,%edx
+  8009e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e8:	83 c0 08             	add    $0x8,%eax
+  8009eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ee:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009f1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009f6:	e9 1b 01 00 00       	jmp    800b16 <vprintfmt+0x5c0>
+  8009fb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a07:	eb e5                	jmp    8009ee <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a15:	e9 56 ff ff ff       	jmp    800970 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a1a:	40 84 f6             	test   %sil,%sil
+  800a1d:	75 2e                	jne    800a4d <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a1f:	85 d2                	test   %edx,%edx
+  800a21:	74 59                	je     800a7c <vprintfmt+0x526>
+  800a23:	83 fa 01             	cmp    $0x1,%edx
+  800a26:	74 7f                	je     800aa7 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2e:	0f 87 9f 00 00 00    	ja     800ad3 <vprintfmt+0x57d>
+  800a34:	89 c2                	mov    %eax,%edx
+  800a36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3a:	83 c0 08             	add    $0x8,%eax
+  800a3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a40:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a43:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a48:	e9 c9 00 00 00       	jmp    800b16 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a50:	83 f8 2f             	cmp    $0x2f,%eax
+  800a53:	77 19                	ja     800a6e <vprintfmt+0x518>
+  800a55:	89 c2                	mov    %eax,%edx
+  800a57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5b:	83 c0 08             	add    $0x8,%eax
+  800a5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a61:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a64:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a69:	e9 a8 00 00 00       	jmp    800b16 <vprintfmt+0x5c0>
+  800a6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7a:	eb e5                	jmp    800a61 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a82:	77 15                	ja     800a99 <vprintfmt+0x543>
+  800a84:	89 c2                	mov    %eax,%edx
+  800a86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8a:	83 c0 08             	add    $0x8,%eax
+  800a8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a90:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a92:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a97:	eb 7d                	jmp    800b16 <vprintfmt+0x5c0>
+  800a99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa5:	eb e9                	jmp    800a90 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800aa7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aaa:	83 f8 2f             	cmp    $0x2f,%eax
+  800aad:	77 16                	ja     800ac5 <vprintfmt+0x56f>
+  800aaf:	89 c2                	mov    %eax,%edx
+  800ab1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab5:	83 c0 08             	add    $0x8,%eax
+  800ab8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800abe:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800ac3:	eb 51                	jmp    800b16 <vprintfmt+0x5c0>
+  800ac5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad1:	eb e8                	jmp    800abb <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800ad3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800adb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800adf:	e9 5c ff ff ff       	jmp    800a40 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800ae4:	4c 89 ee             	mov    %r13,%rsi
+  800ae7:	bf 30 00 00 00       	mov    $0x30,%edi
+  800aec:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800aef:	4c 89 ee             	mov    %r13,%rsi
+  800af2:	bf 78 00 00 00       	mov    $0x78,%edi
+  800af7:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800afa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afd:	83 f8 2f             	cmp    $0x2f,%eax
+  800b00:	77 47                	ja     800b49 <vprintfmt+0x5f3>
+  800b02:	89 c2                	mov    %eax,%edx
+  800b04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b08:	83 c0 08             	add    $0x8,%eax
+  800b0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b11:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b16:	48 83 ec 08          	sub    $0x8,%rsp
+  800b1a:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b1e:	0f 94 c0             	sete   %al
+  800b21:	0f b6 c0             	movzbl %al,%eax
+  800b24:	50                   	push   %rax
+  800b25:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b2a:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b2e:	4c 89 ee             	mov    %r13,%rsi
+  800b31:	4c 89 f7             	mov    %r14,%rdi
+  800b34:	48 b8 4b 04 80 00 00 	movabs $0x80044b,%rax
+  800b3b:	00 00 00 
+  800b3e:	ff d0                	call   *%rax
+            break;
+  800b40:	48 83 c4 10          	add    $0x10,%rsp
+  800b44:	e9 3e fa ff ff       	jmp    800587 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b55:	eb b7                	jmp    800b0e <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b57:	40 84 f6             	test   %sil,%sil
+  800b5a:	75 2b                	jne    800b87 <vprintfmt+0x631>
+    switch (lflag) {
+  800b5c:	85 d2                	test   %edx,%edx
+  800b5e:	74 56                	je     800bb6 <vprintfmt+0x660>
+  800b60:	83 fa 01             	cmp    $0x1,%edx
+  800b63:	74 7f                	je     800be4 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b68:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6b:	0f 87 a2 00 00 00    	ja     800c13 <vprintfmt+0x6bd>
+  800b71:	89 c2                	mov    %eax,%edx
+  800b73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b77:	83 c0 08             	add    $0x8,%eax
+  800b7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b7d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b80:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b85:	eb 8f                	jmp    800b16 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b87:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8d:	77 19                	ja     800ba8 <vprintfmt+0x652>
+  800b8f:	89 c2                	mov    %eax,%edx
+  800b91:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b95:	83 c0 08             	add    $0x8,%eax
+  800b98:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b9b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b9e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ba3:	e9 6e ff ff ff       	jmp    800b16 <vprintfmt+0x5c0>
+  800ba8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb4:	eb e5                	jmp    800b9b <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800bb6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb9:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbc:	77 18                	ja     800bd6 <vprintfmt+0x680>
+  800bbe:	89 c2                	mov    %eax,%edx
+  800bc0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc4:	83 c0 08             	add    $0x8,%eax
+  800bc7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bca:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800bcc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800bd1:	e9 40 ff ff ff       	jmp    800b16 <vprintfmt+0x5c0>
+  800bd6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bda:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bde:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be2:	eb e6                	jmp    800bca <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800be4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be7:	83 f8 2f             	cmp    $0x2f,%eax
+  800bea:	77 19                	ja     800c05 <vprintfmt+0x6af>
+  800bec:	89 c2                	mov    %eax,%edx
+  800bee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf2:	83 c0 08             	add    $0x8,%eax
+  800bf5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bfb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c00:	e9 11 ff ff ff       	jmp    800b16 <vprintfmt+0x5c0>
+  800c05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c09:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c11:	eb e5                	jmp    800bf8 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c13:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c17:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c1f:	e9 59 ff ff ff       	jmp    800b7d <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c24:	4c 89 ee             	mov    %r13,%rsi
+  800c27:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c2c:	41 ff d6             	call   *%r14
+            break;
+  800c2f:	e9 53 f9 ff ff       	jmp    800587 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c34:	4c 89 ee             	mov    %r13,%rsi
+  800c37:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c3c:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c3f:	48 83 eb 01          	sub    $0x1,%rbx
+  800c43:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c47:	75 f6                	jne    800c3f <vprintfmt+0x6e9>
+  800c49:	e9 39 f9 ff ff       	jmp    800587 <vprintfmt+0x31>
+}
+  800c4e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c52:	5b                   	pop    %rbx
+  800c53:	41 5c                	pop    %r12
+  800c55:	41 5d                	pop    %r13
+  800c57:	41 5e                	pop    %r14
+  800c59:	41 5f                	pop    %r15
+  800c5b:	5d                   	pop    %rbp
+  800c5c:	c3                   	ret
+
+0000000000800c5d <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c5d:	55                   	push   %rbp
+  800c5e:	48 89 e5             	mov    %rsp,%rbp
+  800c61:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c65:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c69:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c6e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c72:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c79:	48 85 ff             	test   %rdi,%rdi
+  800c7c:	74 2b                	je     800ca9 <vsnprintf+0x4c>
+  800c7e:	48 85 f6             	test   %rsi,%rsi
+  800c81:	74 26                	je     800ca9 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c83:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c87:	48 bf 01 05 80 00 00 	movabs $0x800501,%rdi
+  800c8e:	00 00 00 
+  800c91:	48 b8 56 05 80 00 00 	movabs $0x800556,%rax
+  800c98:	00 00 00 
+  800c9b:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ca1:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ca4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ca7:	c9                   	leave
+  800ca8:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ca9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cae:	eb f7                	jmp    800ca7 <vsnprintf+0x4a>
+
+0000000000800cb0 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800cb0:	55                   	push   %rbp
+  800cb1:	48 89 e5             	mov    %rsp,%rbp
+  800cb4:	48 83 ec 50          	sub    $0x50,%rsp
+  800cb8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800cbc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800cc0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800cc4:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ccb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ccf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cd7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800cdb:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800cdf:	48 b8 5d 0c 80 00 00 	movabs $0x800c5d,%rax
+  800ce6:	00 00 00 
+  800ce9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ceb:	c9                   	leave
+  800cec:	c3                   	ret
+
+0000000000800ced <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ced:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800cf0:	74 10                	je     800d02 <strlen+0x15>
+    size_t n = 0;
+  800cf2:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800cf7:	48 83 c0 01          	add    $0x1,%rax
+  800cfb:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800cff:	75 f6                	jne    800cf7 <strlen+0xa>
+  800d01:	c3                   	ret
+    size_t n = 0;
+  800d02:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d07:	c3                   	ret
+
+0000000000800d08 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d08:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d0b:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d10:	48 85 f6             	test   %rsi,%rsi
+  800d13:	74 11                	je     800d26 <strnlen+0x1e>
+  800d15:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d19:	74 0c                	je     800d27 <strnlen+0x1f>
+  800d1b:	48 83 c2 01          	add    $0x1,%rdx
+  800d1f:	48 39 d0             	cmp    %rdx,%rax
+  800d22:	75 f1                	jne    800d15 <strnlen+0xd>
+  800d24:	eb 04                	jmp    800d2a <strnlen+0x22>
+  800d26:	c3                   	ret
+  800d27:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d2a:	c3                   	ret
+
+0000000000800d2b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d2b:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d33:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d37:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d3a:	48 83 c2 01          	add    $0x1,%rdx
+  800d3e:	84 c9                	test   %cl,%cl
+  800d40:	75 f1                	jne    800d33 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d42:	c3                   	ret
+
+0000000000800d43 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d43:	55                   	push   %rbp
+  800d44:	48 89 e5             	mov    %rsp,%rbp
+  800d47:	41 54                	push   %r12
+  800d49:	53                   	push   %rbx
+  800d4a:	48 89 fb             	mov    %rdi,%rbx
+  800d4d:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d50:	48 b8 ed 0c 80 00 00 	movabs $0x800ced,%rax
+  800d57:	00 00 00 
+  800d5a:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d5c:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d60:	4c 89 e6             	mov    %r12,%rsi
+  800d63:	48 b8 2b 0d 80 00 00 	movabs $0x800d2b,%rax
+  800d6a:	00 00 00 
+  800d6d:	ff d0                	call   *%rax
+    return dst;
+}
+  800d6f:	48 89 d8             	mov    %rbx,%rax
+  800d72:	5b                   	pop    %rbx
+  800d73:	41 5c                	pop    %r12
+  800d75:	5d                   	pop    %rbp
+  800d76:	c3                   	ret
+
+0000000000800d77 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d77:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d7a:	48 85 d2             	test   %rdx,%rdx
+  800d7d:	74 1f                	je     800d9e <strncpy+0x27>
+  800d7f:	48 01 fa             	add    %rdi,%rdx
+  800d82:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d85:	48 83 c1 01          	add    $0x1,%rcx
+  800d89:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d8d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d91:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d95:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d99:	48 39 ca             	cmp    %rcx,%rdx
+  800d9c:	75 e7                	jne    800d85 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d9e:	c3                   	ret
+
+0000000000800d9f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d9f:	48 89 f8             	mov    %rdi,%rax
+  800da2:	48 85 d2             	test   %rdx,%rdx
+  800da5:	74 24                	je     800dcb <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800da7:	48 83 ea 01          	sub    $0x1,%rdx
+  800dab:	74 1b                	je     800dc8 <strlcpy+0x29>
+  800dad:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800db1:	0f b6 16             	movzbl (%rsi),%edx
+  800db4:	84 d2                	test   %dl,%dl
+  800db6:	74 10                	je     800dc8 <strlcpy+0x29>
+            *dst++ = *src++;
+  800db8:	48 83 c6 01          	add    $0x1,%rsi
+  800dbc:	48 83 c0 01          	add    $0x1,%rax
+  800dc0:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800dc3:	48 39 c8             	cmp    %rcx,%rax
+  800dc6:	75 e9                	jne    800db1 <strlcpy+0x12>
+        *dst = '\0';
+  800dc8:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800dcb:	48 29 f8             	sub    %rdi,%rax
+}
+  800dce:	c3                   	ret
+
+0000000000800dcf <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800dcf:	0f b6 07             	movzbl (%rdi),%eax
+  800dd2:	84 c0                	test   %al,%al
+  800dd4:	74 13                	je     800de9 <strcmp+0x1a>
+  800dd6:	38 06                	cmp    %al,(%rsi)
+  800dd8:	75 0f                	jne    800de9 <strcmp+0x1a>
+  800dda:	48 83 c7 01          	add    $0x1,%rdi
+  800dde:	48 83 c6 01          	add    $0x1,%rsi
+  800de2:	0f b6 07             	movzbl (%rdi),%eax
+  800de5:	84 c0                	test   %al,%al
+  800de7:	75 ed                	jne    800dd6 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800de9:	0f b6 c0             	movzbl %al,%eax
+  800dec:	0f b6 16             	movzbl (%rsi),%edx
+  800def:	29 d0                	sub    %edx,%eax
+}
+  800df1:	c3                   	ret
+
+0000000000800df2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800df2:	48 85 d2             	test   %rdx,%rdx
+  800df5:	74 1f                	je     800e16 <strncmp+0x24>
+  800df7:	0f b6 07             	movzbl (%rdi),%eax
+  800dfa:	84 c0                	test   %al,%al
+  800dfc:	74 1e                	je     800e1c <strncmp+0x2a>
+  800dfe:	3a 06                	cmp    (%rsi),%al
+  800e00:	75 1a                	jne    800e1c <strncmp+0x2a>
+  800e02:	48 83 c7 01          	add    $0x1,%rdi
+  800e06:	48 83 c6 01          	add    $0x1,%rsi
+  800e0a:	48 83 ea 01          	sub    $0x1,%rdx
+  800e0e:	75 e7                	jne    800df7 <strncmp+0x5>
+
+    if (!n) return 0;
+  800e10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e15:	c3                   	ret
+  800e16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1b:	c3                   	ret
+  800e1c:	48 85 d2             	test   %rdx,%rdx
+  800e1f:	74 09                	je     800e2a <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e21:	0f b6 07             	movzbl (%rdi),%eax
+  800e24:	0f b6 16             	movzbl (%rsi),%edx
+  800e27:	29 d0                	sub    %edx,%eax
+  800e29:	c3                   	ret
+    if (!n) return 0;
+  800e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e2f:	c3                   	ret
+
+0000000000800e30 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e30:	0f b6 17             	movzbl (%rdi),%edx
+  800e33:	84 d2                	test   %dl,%dl
+  800e35:	74 18                	je     800e4f <strchr+0x1f>
+        if (*str == c) {
+  800e37:	0f be d2             	movsbl %dl,%edx
+  800e3a:	39 f2                	cmp    %esi,%edx
+  800e3c:	74 17                	je     800e55 <strchr+0x25>
+    for (; *str; str++) {
+  800e3e:	48 83 c7 01          	add    $0x1,%rdi
+  800e42:	0f b6 17             	movzbl (%rdi),%edx
+  800e45:	84 d2                	test   %dl,%dl
+  800e47:	75 ee                	jne    800e37 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4e:	c3                   	ret
+  800e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e54:	c3                   	ret
+  800e55:	48 89 f8             	mov    %rdi,%rax
+}
+  800e58:	c3                   	ret
+
+0000000000800e59 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e59:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e5c:	0f b6 17             	movzbl (%rdi),%edx
+  800e5f:	84 d2                	test   %dl,%dl
+  800e61:	74 13                	je     800e76 <strfind+0x1d>
+  800e63:	0f be d2             	movsbl %dl,%edx
+  800e66:	39 f2                	cmp    %esi,%edx
+  800e68:	74 0b                	je     800e75 <strfind+0x1c>
+  800e6a:	48 83 c0 01          	add    $0x1,%rax
+  800e6e:	0f b6 10             	movzbl (%rax),%edx
+  800e71:	84 d2                	test   %dl,%dl
+  800e73:	75 ee                	jne    800e63 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e75:	c3                   	ret
+  800e76:	c3                   	ret
+
+0000000000800e77 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e77:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e7a:	48 89 f8             	mov    %rdi,%rax
+  800e7d:	48 f7 d8             	neg    %rax
+  800e80:	83 e0 07             	and    $0x7,%eax
+  800e83:	49 89 d1             	mov    %rdx,%r9
+  800e86:	49 29 c1             	sub    %rax,%r9
+  800e89:	78 36                	js     800ec1 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e8b:	40 0f b6 c6          	movzbl %sil,%eax
+  800e8f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e96:	01 01 01 
+  800e99:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e9d:	40 f6 c7 07          	test   $0x7,%dil
+  800ea1:	75 38                	jne    800edb <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ea3:	4c 89 c9             	mov    %r9,%rcx
+  800ea6:	48 c1 f9 03          	sar    $0x3,%rcx
+  800eaa:	74 0c                	je     800eb8 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800eac:	fc                   	cld
+  800ead:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800eb0:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800eb4:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800eb8:	4d 85 c9             	test   %r9,%r9
+  800ebb:	75 45                	jne    800f02 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ebd:	4c 89 c0             	mov    %r8,%rax
+  800ec0:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ec1:	48 85 d2             	test   %rdx,%rdx
+  800ec4:	74 f7                	je     800ebd <memset+0x46>
+  800ec6:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ec9:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ecc:	48 83 c0 01          	add    $0x1,%rax
+  800ed0:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ed4:	48 39 c2             	cmp    %rax,%rdx
+  800ed7:	75 f3                	jne    800ecc <memset+0x55>
+  800ed9:	eb e2                	jmp    800ebd <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800edb:	40 f6 c7 01          	test   $0x1,%dil
+  800edf:	74 06                	je     800ee7 <memset+0x70>
+  800ee1:	88 07                	mov    %al,(%rdi)
+  800ee3:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ee7:	40 f6 c7 02          	test   $0x2,%dil
+  800eeb:	74 07                	je     800ef4 <memset+0x7d>
+  800eed:	66 89 07             	mov    %ax,(%rdi)
+  800ef0:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ef4:	40 f6 c7 04          	test   $0x4,%dil
+  800ef8:	74 a9                	je     800ea3 <memset+0x2c>
+  800efa:	89 07                	mov    %eax,(%rdi)
+  800efc:	48 83 c7 04          	add    $0x4,%rdi
+  800f00:	eb a1                	jmp    800ea3 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f02:	41 f6 c1 04          	test   $0x4,%r9b
+  800f06:	74 06                	je     800f0e <memset+0x97>
+  800f08:	89 07                	mov    %eax,(%rdi)
+  800f0a:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f0e:	41 f6 c1 02          	test   $0x2,%r9b
+  800f12:	74 07                	je     800f1b <memset+0xa4>
+  800f14:	66 89 07             	mov    %ax,(%rdi)
+  800f17:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f1b:	41 f6 c1 01          	test   $0x1,%r9b
+  800f1f:	74 9c                	je     800ebd <memset+0x46>
+  800f21:	88 07                	mov    %al,(%rdi)
+  800f23:	eb 98                	jmp    800ebd <memset+0x46>
+
+0000000000800f25 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f25:	48 89 f8             	mov    %rdi,%rax
+  800f28:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f2b:	48 39 fe             	cmp    %rdi,%rsi
+  800f2e:	73 3b                	jae    800f6b <memmove+0x46>
+  800f30:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f34:	48 39 d7             	cmp    %rdx,%rdi
+  800f37:	73 32                	jae    800f6b <memmove+0x46>
+        s += n;
+        d += n;
+  800f39:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f3d:	48 89 d6             	mov    %rdx,%rsi
+  800f40:	48 09 fe             	or     %rdi,%rsi
+  800f43:	48 09 ce             	or     %rcx,%rsi
+  800f46:	40 f6 c6 07          	test   $0x7,%sil
+  800f4a:	75 12                	jne    800f5e <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f4c:	48 83 ef 08          	sub    $0x8,%rdi
+  800f50:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f54:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f58:	fd                   	std
+  800f59:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f5c:	fc                   	cld
+  800f5d:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f5e:	48 83 ef 01          	sub    $0x1,%rdi
+  800f62:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f66:	fd                   	std
+  800f67:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f69:	eb f1                	jmp    800f5c <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f6b:	48 89 f2             	mov    %rsi,%rdx
+  800f6e:	48 09 c2             	or     %rax,%rdx
+  800f71:	48 09 ca             	or     %rcx,%rdx
+  800f74:	f6 c2 07             	test   $0x7,%dl
+  800f77:	75 0c                	jne    800f85 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f79:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f7d:	48 89 c7             	mov    %rax,%rdi
+  800f80:	fc                   	cld
+  800f81:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f84:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f85:	48 89 c7             	mov    %rax,%rdi
+  800f88:	fc                   	cld
+  800f89:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f8b:	c3                   	ret
+
+0000000000800f8c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f8c:	55                   	push   %rbp
+  800f8d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f90:	48 b8 25 0f 80 00 00 	movabs $0x800f25,%rax
+  800f97:	00 00 00 
+  800f9a:	ff d0                	call   *%rax
+}
+  800f9c:	5d                   	pop    %rbp
+  800f9d:	c3                   	ret
+
+0000000000800f9e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f9e:	55                   	push   %rbp
+  800f9f:	48 89 e5             	mov    %rsp,%rbp
+  800fa2:	41 57                	push   %r15
+  800fa4:	41 56                	push   %r14
+  800fa6:	41 55                	push   %r13
+  800fa8:	41 54                	push   %r12
+  800faa:	53                   	push   %rbx
+  800fab:	48 83 ec 08          	sub    $0x8,%rsp
+  800faf:	49 89 fe             	mov    %rdi,%r14
+  800fb2:	49 89 f7             	mov    %rsi,%r15
+  800fb5:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800fb8:	48 89 f7             	mov    %rsi,%rdi
+  800fbb:	48 b8 ed 0c 80 00 00 	movabs $0x800ced,%rax
+  800fc2:	00 00 00 
+  800fc5:	ff d0                	call   *%rax
+  800fc7:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800fca:	48 89 de             	mov    %rbx,%rsi
+  800fcd:	4c 89 f7             	mov    %r14,%rdi
+  800fd0:	48 b8 08 0d 80 00 00 	movabs $0x800d08,%rax
+  800fd7:	00 00 00 
+  800fda:	ff d0                	call   *%rax
+  800fdc:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fdf:	48 39 c3             	cmp    %rax,%rbx
+  800fe2:	74 36                	je     80101a <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800fe4:	48 89 d8             	mov    %rbx,%rax
+  800fe7:	4c 29 e8             	sub    %r13,%rax
+  800fea:	49 39 c4             	cmp    %rax,%r12
+  800fed:	73 31                	jae    801020 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800fef:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800ff4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ff8:	4c 89 fe             	mov    %r15,%rsi
+  800ffb:	48 b8 8c 0f 80 00 00 	movabs $0x800f8c,%rax
+  801002:	00 00 00 
+  801005:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801007:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80100b:	48 83 c4 08          	add    $0x8,%rsp
+  80100f:	5b                   	pop    %rbx
+  801010:	41 5c                	pop    %r12
+  801012:	41 5d                	pop    %r13
+  801014:	41 5e                	pop    %r14
+  801016:	41 5f                	pop    %r15
+  801018:	5d                   	pop    %rbp
+  801019:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80101a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80101e:	eb eb                	jmp    80100b <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801020:	48 83 eb 01          	sub    $0x1,%rbx
+  801024:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801028:	48 89 da             	mov    %rbx,%rdx
+  80102b:	4c 89 fe             	mov    %r15,%rsi
+  80102e:	48 b8 8c 0f 80 00 00 	movabs $0x800f8c,%rax
+  801035:	00 00 00 
+  801038:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80103a:	49 01 de             	add    %rbx,%r14
+  80103d:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801042:	eb c3                	jmp    801007 <strlcat+0x69>
+
+0000000000801044 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801044:	48 85 d2             	test   %rdx,%rdx
+  801047:	74 2d                	je     801076 <memcmp+0x32>
+  801049:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80104e:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801052:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801057:	44 38 c1             	cmp    %r8b,%cl
+  80105a:	75 0f                	jne    80106b <memcmp+0x27>
+    while (n-- > 0) {
+  80105c:	48 83 c0 01          	add    $0x1,%rax
+  801060:	48 39 c2             	cmp    %rax,%rdx
+  801063:	75 e9                	jne    80104e <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80106a:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80106b:	0f b6 c1             	movzbl %cl,%eax
+  80106e:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801072:	44 29 c0             	sub    %r8d,%eax
+  801075:	c3                   	ret
+    return 0;
+  801076:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80107b:	c3                   	ret
+
+000000000080107c <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80107c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801080:	48 39 c7             	cmp    %rax,%rdi
+  801083:	73 0f                	jae    801094 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801085:	40 38 37             	cmp    %sil,(%rdi)
+  801088:	74 0e                	je     801098 <memfind+0x1c>
+    for (; src < end; src++) {
+  80108a:	48 83 c7 01          	add    $0x1,%rdi
+  80108e:	48 39 f8             	cmp    %rdi,%rax
+  801091:	75 f2                	jne    801085 <memfind+0x9>
+  801093:	c3                   	ret
+  801094:	48 89 f8             	mov    %rdi,%rax
+  801097:	c3                   	ret
+  801098:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80109b:	c3                   	ret
+
+000000000080109c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80109c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80109f:	0f b6 37             	movzbl (%rdi),%esi
+  8010a2:	40 80 fe 20          	cmp    $0x20,%sil
+  8010a6:	74 06                	je     8010ae <strtol+0x12>
+  8010a8:	40 80 fe 09          	cmp    $0x9,%sil
+  8010ac:	75 13                	jne    8010c1 <strtol+0x25>
+  8010ae:	48 83 c7 01          	add    $0x1,%rdi
+  8010b2:	0f b6 37             	movzbl (%rdi),%esi
+  8010b5:	40 80 fe 20          	cmp    $0x20,%sil
+  8010b9:	74 f3                	je     8010ae <strtol+0x12>
+  8010bb:	40 80 fe 09          	cmp    $0x9,%sil
+  8010bf:	74 ed                	je     8010ae <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8010c1:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8010c4:	83 e0 fd             	and    $0xfffffffd,%eax
+  8010c7:	3c 01                	cmp    $0x1,%al
+  8010c9:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010cd:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010d3:	75 0f                	jne    8010e4 <strtol+0x48>
+  8010d5:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010d8:	74 14                	je     8010ee <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010da:	85 d2                	test   %edx,%edx
+  8010dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010e1:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010e4:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010e9:	4c 63 ca             	movslq %edx,%r9
+  8010ec:	eb 36                	jmp    801124 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010ee:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010f2:	74 0f                	je     801103 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010f4:	85 d2                	test   %edx,%edx
+  8010f6:	75 ec                	jne    8010e4 <strtol+0x48>
+        s++;
+  8010f8:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010fc:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801101:	eb e1                	jmp    8010e4 <strtol+0x48>
+        s += 2;
+  801103:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801107:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80110c:	eb d6                	jmp    8010e4 <strtol+0x48>
+            dig -= '0';
+  80110e:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801111:	44 0f b6 c1          	movzbl %cl,%r8d
+  801115:	41 39 d0             	cmp    %edx,%r8d
+  801118:	7d 21                	jge    80113b <strtol+0x9f>
+        val = val * base + dig;
+  80111a:	49 0f af c1          	imul   %r9,%rax
+  80111e:	0f b6 c9             	movzbl %cl,%ecx
+  801121:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801124:	48 83 c7 01          	add    $0x1,%rdi
+  801128:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80112c:	80 f9 39             	cmp    $0x39,%cl
+  80112f:	76 dd                	jbe    80110e <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801131:	80 f9 7b             	cmp    $0x7b,%cl
+  801134:	77 05                	ja     80113b <strtol+0x9f>
+            dig -= 'a' - 10;
+  801136:	83 e9 57             	sub    $0x57,%ecx
+  801139:	eb d6                	jmp    801111 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80113b:	4d 85 d2             	test   %r10,%r10
+  80113e:	74 03                	je     801143 <strtol+0xa7>
+  801140:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801143:	48 89 c2             	mov    %rax,%rdx
+  801146:	48 f7 da             	neg    %rdx
+  801149:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80114d:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801151:	c3                   	ret
+
+0000000000801152 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801152:	55                   	push   %rbp
+  801153:	48 89 e5             	mov    %rsp,%rbp
+  801156:	53                   	push   %rbx
+  801157:	48 89 fa             	mov    %rdi,%rdx
+  80115a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80115d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801162:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801167:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80116c:	be 00 00 00 00       	mov    $0x0,%esi
+  801171:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801177:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801179:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80117d:	c9                   	leave
+  80117e:	c3                   	ret
+
+000000000080117f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80117f:	55                   	push   %rbp
+  801180:	48 89 e5             	mov    %rsp,%rbp
+  801183:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801184:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801189:	ba 00 00 00 00       	mov    $0x0,%edx
+  80118e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801193:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801198:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80119d:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011a8:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ae:	c9                   	leave
+  8011af:	c3                   	ret
+
+00000000008011b0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8011b0:	55                   	push   %rbp
+  8011b1:	48 89 e5             	mov    %rsp,%rbp
+  8011b4:	53                   	push   %rbx
+  8011b5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8011b9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011bc:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011cb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011db:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011dd:	48 85 c0             	test   %rax,%rax
+  8011e0:	7f 06                	jg     8011e8 <sys_env_destroy+0x38>
+}
+  8011e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e6:	c9                   	leave
+  8011e7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011e8:	49 89 c0             	mov    %rax,%r8
+  8011eb:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011f0:	48 ba 70 3b 80 00 00 	movabs $0x803b70,%rdx
+  8011f7:	00 00 00 
+  8011fa:	be 26 00 00 00       	mov    $0x26,%esi
+  8011ff:	48 bf 8f 3b 80 00 00 	movabs $0x803b8f,%rdi
+  801206:	00 00 00 
+  801209:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120e:	49 b9 b6 02 80 00 00 	movabs $0x8002b6,%r9
+  801215:	00 00 00 
+  801218:	41 ff d1             	call   *%r9
+
+000000000080121b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80121b:	55                   	push   %rbp
+  80121c:	48 89 e5             	mov    %rsp,%rbp
+  80121f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801220:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801225:	ba 00 00 00 00       	mov    $0x0,%edx
+  80122a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80122f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801234:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801239:	be 00 00 00 00       	mov    $0x0,%esi
+  80123e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801244:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801246:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124a:	c9                   	leave
+  80124b:	c3                   	ret
+
+000000000080124c <sys_yield>:
+
+void
+sys_yield(void) {
+  80124c:	55                   	push   %rbp
+  80124d:	48 89 e5             	mov    %rsp,%rbp
+  801250:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801251:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801256:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801260:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801265:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80126a:	be 00 00 00 00       	mov    $0x0,%esi
+  80126f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801275:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801277:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127b:	c9                   	leave
+  80127c:	c3                   	ret
+
+000000000080127d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80127d:	55                   	push   %rbp
+  80127e:	48 89 e5             	mov    %rsp,%rbp
+  801281:	53                   	push   %rbx
+  801282:	48 89 fa             	mov    %rdi,%rdx
+  801285:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801288:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80128d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801294:	00 00 00 
+  801297:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ad:	c9                   	leave
+  8012ae:	c3                   	ret
+
+00000000008012af <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012af:	55                   	push   %rbp
+  8012b0:	48 89 e5             	mov    %rsp,%rbp
+  8012b3:	53                   	push   %rbx
+  8012b4:	49 89 f8             	mov    %rdi,%r8
+  8012b7:	48 89 d3             	mov    %rdx,%rbx
+  8012ba:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012bd:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012c2:	4c 89 c2             	mov    %r8,%rdx
+  8012c5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d3:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d9:	c9                   	leave
+  8012da:	c3                   	ret
+
+00000000008012db <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012db:	55                   	push   %rbp
+  8012dc:	48 89 e5             	mov    %rsp,%rbp
+  8012df:	53                   	push   %rbx
+  8012e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8012e4:	89 f8                	mov    %edi,%eax
+  8012e6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012e9:	48 63 f9             	movslq %ecx,%rdi
+  8012ec:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ef:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012f4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801302:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801304:	48 85 c0             	test   %rax,%rax
+  801307:	7f 06                	jg     80130f <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801309:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130d:	c9                   	leave
+  80130e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80130f:	49 89 c0             	mov    %rax,%r8
+  801312:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801317:	48 ba 70 3b 80 00 00 	movabs $0x803b70,%rdx
+  80131e:	00 00 00 
+  801321:	be 26 00 00 00       	mov    $0x26,%esi
+  801326:	48 bf 8f 3b 80 00 00 	movabs $0x803b8f,%rdi
+  80132d:	00 00 00 
+  801330:	b8 00 00 00 00       	mov    $0x0,%eax
+  801335:	49 b9 b6 02 80 00 00 	movabs $0x8002b6,%r9
+  80133c:	00 00 00 
+  80133f:	41 ff d1             	call   *%r9
+
+0000000000801342 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801342:	55                   	push   %rbp
+  801343:	48 89 e5             	mov    %rsp,%rbp
+  801346:	53                   	push   %rbx
+  801347:	48 83 ec 08          	sub    $0x8,%rsp
+  80134b:	89 f8                	mov    %edi,%eax
+  80134d:	49 89 f2             	mov    %rsi,%r10
+  801350:	48 89 cf             	mov    %rcx,%rdi
+  801353:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801356:	48 63 da             	movslq %edx,%rbx
+  801359:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80135c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801361:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801364:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801367:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801369:	48 85 c0             	test   %rax,%rax
+  80136c:	7f 06                	jg     801374 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80136e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801372:	c9                   	leave
+  801373:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801374:	49 89 c0             	mov    %rax,%r8
+  801377:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80137c:	48 ba 70 3b 80 00 00 	movabs $0x803b70,%rdx
+  801383:	00 00 00 
+  801386:	be 26 00 00 00       	mov    $0x26,%esi
+  80138b:	48 bf 8f 3b 80 00 00 	movabs $0x803b8f,%rdi
+  801392:	00 00 00 
+  801395:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139a:	49 b9 b6 02 80 00 00 	movabs $0x8002b6,%r9
+  8013a1:	00 00 00 
+  8013a4:	41 ff d1             	call   *%r9
+
+00000000008013a7 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013a7:	55                   	push   %rbp
+  8013a8:	48 89 e5             	mov    %rsp,%rbp
+  8013ab:	53                   	push   %rbx
+  8013ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8013b0:	48 89 f1             	mov    %rsi,%rcx
+  8013b3:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8013b6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b9:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ce:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013d0:	48 85 c0             	test   %rax,%rax
+  8013d3:	7f 06                	jg     8013db <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d9:	c9                   	leave
+  8013da:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013db:	49 89 c0             	mov    %rax,%r8
+  8013de:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013e3:	48 ba 70 3b 80 00 00 	movabs $0x803b70,%rdx
+  8013ea:	00 00 00 
+  8013ed:	be 26 00 00 00       	mov    $0x26,%esi
+  8013f2:	48 bf 8f 3b 80 00 00 	movabs $0x803b8f,%rdi
+  8013f9:	00 00 00 
+  8013fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801401:	49 b9 b6 02 80 00 00 	movabs $0x8002b6,%r9
+  801408:	00 00 00 
+  80140b:	41 ff d1             	call   *%r9
+
+000000000080140e <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  80140e:	55                   	push   %rbp
+  80140f:	48 89 e5             	mov    %rsp,%rbp
+  801412:	53                   	push   %rbx
+  801413:	48 83 ec 08          	sub    $0x8,%rsp
+  801417:	89 f8                	mov    %edi,%eax
+  801419:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  80141c:	48 63 f9             	movslq %ecx,%rdi
+  80141f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801422:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801427:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80142a:	be 00 00 00 00       	mov    $0x0,%esi
+  80142f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801435:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801437:	48 85 c0             	test   %rax,%rax
+  80143a:	7f 06                	jg     801442 <sys_region_advise+0x34>
+}
+  80143c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801440:	c9                   	leave
+  801441:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801442:	49 89 c0             	mov    %rax,%r8
+  801445:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80144a:	48 ba 70 3b 80 00 00 	movabs $0x803b70,%rdx
+  801451:	00 00 00 
+  801454:	be 26 00 00 00       	mov    $0x26,%esi
+  801459:	48 bf 8f 3b 80 00 00 	movabs $0x803b8f,%rdi
+  801460:	00 00 00 
+  801463:	b8 00 00 00 00       	mov    $0x0,%eax
+  801468:	49 b9 b6 02 80 00 00 	movabs $0x8002b6,%r9
+  80146f:	00 00 00 
+  801472:	41 ff d1             	call   *%r9
+
+0000000000801475 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801475:	55                   	push   %rbp
+  801476:	48 89 e5             	mov    %rsp,%rbp
+  801479:	53                   	push   %rbx
+  80147a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80147e:	48 63 ce             	movslq %esi,%rcx
+  801481:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801484:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801489:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801493:	be 00 00 00 00       	mov    $0x0,%esi
+  801498:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80149e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a0:	48 85 c0             	test   %rax,%rax
+  8014a3:	7f 06                	jg     8014ab <sys_env_set_nice+0x36>
+}
+  8014a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a9:	c9                   	leave
+  8014aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ab:	49 89 c0             	mov    %rax,%r8
+  8014ae:	b9 15 00 00 00       	mov    $0x15,%ecx
+  8014b3:	48 ba 70 3b 80 00 00 	movabs $0x803b70,%rdx
+  8014ba:	00 00 00 
+  8014bd:	be 26 00 00 00       	mov    $0x26,%esi
+  8014c2:	48 bf 8f 3b 80 00 00 	movabs $0x803b8f,%rdi
+  8014c9:	00 00 00 
+  8014cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d1:	49 b9 b6 02 80 00 00 	movabs $0x8002b6,%r9
+  8014d8:	00 00 00 
+  8014db:	41 ff d1             	call   *%r9
+
+00000000008014de <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014de:	55                   	push   %rbp
+  8014df:	48 89 e5             	mov    %rsp,%rbp
+  8014e2:	53                   	push   %rbx
+  8014e3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014e7:	48 63 ce             	movslq %esi,%rcx
+  8014ea:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ed:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801501:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801507:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801509:	48 85 c0             	test   %rax,%rax
+  80150c:	7f 06                	jg     801514 <sys_env_set_status+0x36>
+}
+  80150e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801512:	c9                   	leave
+  801513:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801514:	49 89 c0             	mov    %rax,%r8
+  801517:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80151c:	48 ba 70 3b 80 00 00 	movabs $0x803b70,%rdx
+  801523:	00 00 00 
+  801526:	be 26 00 00 00       	mov    $0x26,%esi
+  80152b:	48 bf 8f 3b 80 00 00 	movabs $0x803b8f,%rdi
+  801532:	00 00 00 
+  801535:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153a:	49 b9 b6 02 80 00 00 	movabs $0x8002b6,%r9
+  801541:	00 00 00 
+  801544:	41 ff d1             	call   *%r9
+
+0000000000801547 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801547:	55                   	push   %rbp
+  801548:	48 89 e5             	mov    %rsp,%rbp
+  80154b:	53                   	push   %rbx
+  80154c:	48 83 ec 08          	sub    $0x8,%rsp
+  801550:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801553:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801556:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80155b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801560:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801565:	be 00 00 00 00       	mov    $0x0,%esi
+  80156a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801570:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801572:	48 85 c0             	test   %rax,%rax
+  801575:	7f 06                	jg     80157d <sys_env_set_trapframe+0x36>
+}
+  801577:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80157b:	c9                   	leave
+  80157c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80157d:	49 89 c0             	mov    %rax,%r8
+  801580:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801585:	48 ba 70 3b 80 00 00 	movabs $0x803b70,%rdx
+  80158c:	00 00 00 
+  80158f:	be 26 00 00 00       	mov    $0x26,%esi
+  801594:	48 bf 8f 3b 80 00 00 	movabs $0x803b8f,%rdi
+  80159b:	00 00 00 
+  80159e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a3:	49 b9 b6 02 80 00 00 	movabs $0x8002b6,%r9
+  8015aa:	00 00 00 
+  8015ad:	41 ff d1             	call   *%r9
+
+00000000008015b0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015b0:	55                   	push   %rbp
+  8015b1:	48 89 e5             	mov    %rsp,%rbp
+  8015b4:	53                   	push   %rbx
+  8015b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8015b9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015bc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015bf:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015db:	48 85 c0             	test   %rax,%rax
+  8015de:	7f 06                	jg     8015e6 <sys_env_set_pgfault_upcall+0x36>
+}
+  8015e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e4:	c9                   	leave
+  8015e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015e6:	49 89 c0             	mov    %rax,%r8
+  8015e9:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015ee:	48 ba 70 3b 80 00 00 	movabs $0x803b70,%rdx
+  8015f5:	00 00 00 
+  8015f8:	be 26 00 00 00       	mov    $0x26,%esi
+  8015fd:	48 bf 8f 3b 80 00 00 	movabs $0x803b8f,%rdi
+  801604:	00 00 00 
+  801607:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160c:	49 b9 b6 02 80 00 00 	movabs $0x8002b6,%r9
+  801613:	00 00 00 
+  801616:	41 ff d1             	call   *%r9
+
+0000000000801619 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801619:	55                   	push   %rbp
+  80161a:	48 89 e5             	mov    %rsp,%rbp
+  80161d:	53                   	push   %rbx
+  80161e:	89 f8                	mov    %edi,%eax
+  801620:	49 89 f1             	mov    %rsi,%r9
+  801623:	48 89 d3             	mov    %rdx,%rbx
+  801626:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801629:	49 63 f0             	movslq %r8d,%rsi
+  80162c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80162f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801634:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801637:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80163d:	cd 30                	int    $0x30
+}
+  80163f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801643:	c9                   	leave
+  801644:	c3                   	ret
+
+0000000000801645 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801645:	55                   	push   %rbp
+  801646:	48 89 e5             	mov    %rsp,%rbp
+  801649:	53                   	push   %rbx
+  80164a:	48 83 ec 08          	sub    $0x8,%rsp
+  80164e:	48 89 fa             	mov    %rdi,%rdx
+  801651:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801654:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801659:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801663:	be 00 00 00 00       	mov    $0x0,%esi
+  801668:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80166e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801670:	48 85 c0             	test   %rax,%rax
+  801673:	7f 06                	jg     80167b <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801675:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801679:	c9                   	leave
+  80167a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80167b:	49 89 c0             	mov    %rax,%r8
+  80167e:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801683:	48 ba 70 3b 80 00 00 	movabs $0x803b70,%rdx
+  80168a:	00 00 00 
+  80168d:	be 26 00 00 00       	mov    $0x26,%esi
+  801692:	48 bf 8f 3b 80 00 00 	movabs $0x803b8f,%rdi
+  801699:	00 00 00 
+  80169c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a1:	49 b9 b6 02 80 00 00 	movabs $0x8002b6,%r9
+  8016a8:	00 00 00 
+  8016ab:	41 ff d1             	call   *%r9
+
+00000000008016ae <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8016ae:	55                   	push   %rbp
+  8016af:	48 89 e5             	mov    %rsp,%rbp
+  8016b2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d7:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016dd:	c9                   	leave
+  8016de:	c3                   	ret
+
+00000000008016df <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8016df:	55                   	push   %rbp
+  8016e0:	48 89 e5             	mov    %rsp,%rbp
+  8016e3:	53                   	push   %rbx
+  8016e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8016e8:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8016eb:	48 63 ce             	movslq %esi,%rcx
+  8016ee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801700:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801706:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801708:	48 85 c0             	test   %rax,%rax
+  80170b:	7f 06                	jg     801713 <sys_sigqueue+0x34>
+}
+  80170d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801711:	c9                   	leave
+  801712:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801713:	49 89 c0             	mov    %rax,%r8
+  801716:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80171b:	48 ba 70 3b 80 00 00 	movabs $0x803b70,%rdx
+  801722:	00 00 00 
+  801725:	be 26 00 00 00       	mov    $0x26,%esi
+  80172a:	48 bf 8f 3b 80 00 00 	movabs $0x803b8f,%rdi
+  801731:	00 00 00 
+  801734:	b8 00 00 00 00       	mov    $0x0,%eax
+  801739:	49 b9 b6 02 80 00 00 	movabs $0x8002b6,%r9
+  801740:	00 00 00 
+  801743:	41 ff d1             	call   *%r9
+
+0000000000801746 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801746:	55                   	push   %rbp
+  801747:	48 89 e5             	mov    %rsp,%rbp
+  80174a:	53                   	push   %rbx
+  80174b:	48 83 ec 08          	sub    $0x8,%rsp
+  80174f:	48 89 fa             	mov    %rdi,%rdx
+  801752:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801755:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80175a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801764:	be 00 00 00 00       	mov    $0x0,%esi
+  801769:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80176f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801771:	48 85 c0             	test   %rax,%rax
+  801774:	7f 06                	jg     80177c <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801776:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80177a:	c9                   	leave
+  80177b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80177c:	49 89 c0             	mov    %rax,%r8
+  80177f:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801784:	48 ba 70 3b 80 00 00 	movabs $0x803b70,%rdx
+  80178b:	00 00 00 
+  80178e:	be 26 00 00 00       	mov    $0x26,%esi
+  801793:	48 bf 8f 3b 80 00 00 	movabs $0x803b8f,%rdi
+  80179a:	00 00 00 
+  80179d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a2:	49 b9 b6 02 80 00 00 	movabs $0x8002b6,%r9
+  8017a9:	00 00 00 
+  8017ac:	41 ff d1             	call   *%r9
+
+00000000008017af <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  8017af:	55                   	push   %rbp
+  8017b0:	48 89 e5             	mov    %rsp,%rbp
+  8017b3:	53                   	push   %rbx
+  8017b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8017b8:	48 89 f1             	mov    %rsi,%rcx
+  8017bb:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  8017be:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017c1:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017d6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017d8:	48 85 c0             	test   %rax,%rax
+  8017db:	7f 06                	jg     8017e3 <sys_sigaction+0x34>
+}
+  8017dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e1:	c9                   	leave
+  8017e2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017e3:	49 89 c0             	mov    %rax,%r8
+  8017e6:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8017eb:	48 ba 70 3b 80 00 00 	movabs $0x803b70,%rdx
+  8017f2:	00 00 00 
+  8017f5:	be 26 00 00 00       	mov    $0x26,%esi
+  8017fa:	48 bf 8f 3b 80 00 00 	movabs $0x803b8f,%rdi
+  801801:	00 00 00 
+  801804:	b8 00 00 00 00       	mov    $0x0,%eax
+  801809:	49 b9 b6 02 80 00 00 	movabs $0x8002b6,%r9
+  801810:	00 00 00 
+  801813:	41 ff d1             	call   *%r9
+
+0000000000801816 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801816:	55                   	push   %rbp
+  801817:	48 89 e5             	mov    %rsp,%rbp
+  80181a:	53                   	push   %rbx
+  80181b:	48 83 ec 08          	sub    $0x8,%rsp
+  80181f:	48 89 f1             	mov    %rsi,%rcx
+  801822:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801825:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801828:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80182d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801832:	be 00 00 00 00       	mov    $0x0,%esi
+  801837:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80183d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80183f:	48 85 c0             	test   %rax,%rax
+  801842:	7f 06                	jg     80184a <sys_sigprocmask+0x34>
+}
+  801844:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801848:	c9                   	leave
+  801849:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80184a:	49 89 c0             	mov    %rax,%r8
+  80184d:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801852:	48 ba 70 3b 80 00 00 	movabs $0x803b70,%rdx
+  801859:	00 00 00 
+  80185c:	be 26 00 00 00       	mov    $0x26,%esi
+  801861:	48 bf 8f 3b 80 00 00 	movabs $0x803b8f,%rdi
+  801868:	00 00 00 
+  80186b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801870:	49 b9 b6 02 80 00 00 	movabs $0x8002b6,%r9
+  801877:	00 00 00 
+  80187a:	41 ff d1             	call   *%r9
+
+000000000080187d <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80187d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801884:	ff ff ff 
+  801887:	48 01 f8             	add    %rdi,%rax
+  80188a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80188e:	c3                   	ret
+
+000000000080188f <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80188f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801896:	ff ff ff 
+  801899:	48 01 f8             	add    %rdi,%rax
+  80189c:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8018a0:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8018a6:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8018aa:	c3                   	ret
+
+00000000008018ab <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8018ab:	55                   	push   %rbp
+  8018ac:	48 89 e5             	mov    %rsp,%rbp
+  8018af:	41 57                	push   %r15
+  8018b1:	41 56                	push   %r14
+  8018b3:	41 55                	push   %r13
+  8018b5:	41 54                	push   %r12
+  8018b7:	53                   	push   %rbx
+  8018b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8018bc:	49 89 ff             	mov    %rdi,%r15
+  8018bf:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8018c4:	49 bd 71 30 80 00 00 	movabs $0x803071,%r13
+  8018cb:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8018ce:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8018d4:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8018d7:	48 89 df             	mov    %rbx,%rdi
+  8018da:	41 ff d5             	call   *%r13
+  8018dd:	83 e0 04             	and    $0x4,%eax
+  8018e0:	74 17                	je     8018f9 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8018e2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018e9:	4c 39 f3             	cmp    %r14,%rbx
+  8018ec:	75 e6                	jne    8018d4 <fd_alloc+0x29>
+  8018ee:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8018f4:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8018f9:	4d 89 27             	mov    %r12,(%r15)
+}
+  8018fc:	48 83 c4 08          	add    $0x8,%rsp
+  801900:	5b                   	pop    %rbx
+  801901:	41 5c                	pop    %r12
+  801903:	41 5d                	pop    %r13
+  801905:	41 5e                	pop    %r14
+  801907:	41 5f                	pop    %r15
+  801909:	5d                   	pop    %rbp
+  80190a:	c3                   	ret
+
+000000000080190b <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80190b:	83 ff 1f             	cmp    $0x1f,%edi
+  80190e:	77 39                	ja     801949 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801910:	55                   	push   %rbp
+  801911:	48 89 e5             	mov    %rsp,%rbp
+  801914:	41 54                	push   %r12
+  801916:	53                   	push   %rbx
+  801917:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80191a:	48 63 df             	movslq %edi,%rbx
+  80191d:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801924:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801928:	48 89 df             	mov    %rbx,%rdi
+  80192b:	48 b8 71 30 80 00 00 	movabs $0x803071,%rax
+  801932:	00 00 00 
+  801935:	ff d0                	call   *%rax
+  801937:	a8 04                	test   $0x4,%al
+  801939:	74 14                	je     80194f <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80193b:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80193f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801944:	5b                   	pop    %rbx
+  801945:	41 5c                	pop    %r12
+  801947:	5d                   	pop    %rbp
+  801948:	c3                   	ret
+        return -E_INVAL;
+  801949:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80194e:	c3                   	ret
+        return -E_INVAL;
+  80194f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801954:	eb ee                	jmp    801944 <fd_lookup+0x39>
+
+0000000000801956 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801956:	55                   	push   %rbp
+  801957:	48 89 e5             	mov    %rsp,%rbp
+  80195a:	41 54                	push   %r12
+  80195c:	53                   	push   %rbx
+  80195d:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801960:	48 b8 20 3c 80 00 00 	movabs $0x803c20,%rax
+  801967:	00 00 00 
+  80196a:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801971:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801974:	39 3b                	cmp    %edi,(%rbx)
+  801976:	74 47                	je     8019bf <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801978:	48 83 c0 08          	add    $0x8,%rax
+  80197c:	48 8b 18             	mov    (%rax),%rbx
+  80197f:	48 85 db             	test   %rbx,%rbx
+  801982:	75 f0                	jne    801974 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801984:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80198b:	00 00 00 
+  80198e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801994:	89 fa                	mov    %edi,%edx
+  801996:	48 bf a0 3b 80 00 00 	movabs $0x803ba0,%rdi
+  80199d:	00 00 00 
+  8019a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a5:	48 b9 06 04 80 00 00 	movabs $0x800406,%rcx
+  8019ac:	00 00 00 
+  8019af:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8019b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8019b6:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8019ba:	5b                   	pop    %rbx
+  8019bb:	41 5c                	pop    %r12
+  8019bd:	5d                   	pop    %rbp
+  8019be:	c3                   	ret
+            return 0;
+  8019bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c4:	eb f0                	jmp    8019b6 <dev_lookup+0x60>
+
+00000000008019c6 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8019c6:	55                   	push   %rbp
+  8019c7:	48 89 e5             	mov    %rsp,%rbp
+  8019ca:	41 55                	push   %r13
+  8019cc:	41 54                	push   %r12
+  8019ce:	53                   	push   %rbx
+  8019cf:	48 83 ec 18          	sub    $0x18,%rsp
+  8019d3:	48 89 fb             	mov    %rdi,%rbx
+  8019d6:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019d9:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8019e0:	ff ff ff 
+  8019e3:	48 01 df             	add    %rbx,%rdi
+  8019e6:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8019ea:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019ee:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  8019f5:	00 00 00 
+  8019f8:	ff d0                	call   *%rax
+  8019fa:	41 89 c5             	mov    %eax,%r13d
+  8019fd:	85 c0                	test   %eax,%eax
+  8019ff:	78 06                	js     801a07 <fd_close+0x41>
+  801a01:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a05:	74 1a                	je     801a21 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a07:	45 84 e4             	test   %r12b,%r12b
+  801a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0f:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a13:	44 89 e8             	mov    %r13d,%eax
+  801a16:	48 83 c4 18          	add    $0x18,%rsp
+  801a1a:	5b                   	pop    %rbx
+  801a1b:	41 5c                	pop    %r12
+  801a1d:	41 5d                	pop    %r13
+  801a1f:	5d                   	pop    %rbp
+  801a20:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a21:	8b 3b                	mov    (%rbx),%edi
+  801a23:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a27:	48 b8 56 19 80 00 00 	movabs $0x801956,%rax
+  801a2e:	00 00 00 
+  801a31:	ff d0                	call   *%rax
+  801a33:	41 89 c5             	mov    %eax,%r13d
+  801a36:	85 c0                	test   %eax,%eax
+  801a38:	78 1b                	js     801a55 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a3a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a3e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801a42:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a48:	48 85 c0             	test   %rax,%rax
+  801a4b:	74 08                	je     801a55 <fd_close+0x8f>
+  801a4d:	48 89 df             	mov    %rbx,%rdi
+  801a50:	ff d0                	call   *%rax
+  801a52:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a55:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a5a:	48 89 de             	mov    %rbx,%rsi
+  801a5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a62:	48 b8 a7 13 80 00 00 	movabs $0x8013a7,%rax
+  801a69:	00 00 00 
+  801a6c:	ff d0                	call   *%rax
+    return res;
+  801a6e:	eb a3                	jmp    801a13 <fd_close+0x4d>
+
+0000000000801a70 <close>:
+
+int
+close(int fdnum) {
+  801a70:	55                   	push   %rbp
+  801a71:	48 89 e5             	mov    %rsp,%rbp
+  801a74:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a78:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a7c:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  801a83:	00 00 00 
+  801a86:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a88:	85 c0                	test   %eax,%eax
+  801a8a:	78 15                	js     801aa1 <close+0x31>
+
+    return fd_close(fd, 1);
+  801a8c:	be 01 00 00 00       	mov    $0x1,%esi
+  801a91:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a95:	48 b8 c6 19 80 00 00 	movabs $0x8019c6,%rax
+  801a9c:	00 00 00 
+  801a9f:	ff d0                	call   *%rax
+}
+  801aa1:	c9                   	leave
+  801aa2:	c3                   	ret
+
+0000000000801aa3 <close_all>:
+
+void
+close_all(void) {
+  801aa3:	55                   	push   %rbp
+  801aa4:	48 89 e5             	mov    %rsp,%rbp
+  801aa7:	41 54                	push   %r12
+  801aa9:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801aaa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aaf:	49 bc 70 1a 80 00 00 	movabs $0x801a70,%r12
+  801ab6:	00 00 00 
+  801ab9:	89 df                	mov    %ebx,%edi
+  801abb:	41 ff d4             	call   *%r12
+  801abe:	83 c3 01             	add    $0x1,%ebx
+  801ac1:	83 fb 20             	cmp    $0x20,%ebx
+  801ac4:	75 f3                	jne    801ab9 <close_all+0x16>
+}
+  801ac6:	5b                   	pop    %rbx
+  801ac7:	41 5c                	pop    %r12
+  801ac9:	5d                   	pop    %rbp
+  801aca:	c3                   	ret
+
+0000000000801acb <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801acb:	55                   	push   %rbp
+  801acc:	48 89 e5             	mov    %rsp,%rbp
+  801acf:	41 57                	push   %r15
+  801ad1:	41 56                	push   %r14
+  801ad3:	41 55                	push   %r13
+  801ad5:	41 54                	push   %r12
+  801ad7:	53                   	push   %rbx
+  801ad8:	48 83 ec 18          	sub    $0x18,%rsp
+  801adc:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801adf:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ae3:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  801aea:	00 00 00 
+  801aed:	ff d0                	call   *%rax
+  801aef:	89 c3                	mov    %eax,%ebx
+  801af1:	85 c0                	test   %eax,%eax
+  801af3:	0f 88 b8 00 00 00    	js     801bb1 <dup+0xe6>
+    close(newfdnum);
+  801af9:	44 89 e7             	mov    %r12d,%edi
+  801afc:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  801b03:	00 00 00 
+  801b06:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b08:	4d 63 ec             	movslq %r12d,%r13
+  801b0b:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801b12:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801b16:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b1a:	4c 89 ff             	mov    %r15,%rdi
+  801b1d:	49 be 8f 18 80 00 00 	movabs $0x80188f,%r14
+  801b24:	00 00 00 
+  801b27:	41 ff d6             	call   *%r14
+  801b2a:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b2d:	4c 89 ef             	mov    %r13,%rdi
+  801b30:	41 ff d6             	call   *%r14
+  801b33:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b36:	48 89 df             	mov    %rbx,%rdi
+  801b39:	48 b8 71 30 80 00 00 	movabs $0x803071,%rax
+  801b40:	00 00 00 
+  801b43:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801b45:	a8 04                	test   $0x4,%al
+  801b47:	74 2b                	je     801b74 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801b49:	41 89 c1             	mov    %eax,%r9d
+  801b4c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b52:	4c 89 f1             	mov    %r14,%rcx
+  801b55:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5a:	48 89 de             	mov    %rbx,%rsi
+  801b5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b62:	48 b8 42 13 80 00 00 	movabs $0x801342,%rax
+  801b69:	00 00 00 
+  801b6c:	ff d0                	call   *%rax
+  801b6e:	89 c3                	mov    %eax,%ebx
+  801b70:	85 c0                	test   %eax,%eax
+  801b72:	78 4e                	js     801bc2 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801b74:	4c 89 ff             	mov    %r15,%rdi
+  801b77:	48 b8 71 30 80 00 00 	movabs $0x803071,%rax
+  801b7e:	00 00 00 
+  801b81:	ff d0                	call   *%rax
+  801b83:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b86:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b8c:	4c 89 e9             	mov    %r13,%rcx
+  801b8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b94:	4c 89 fe             	mov    %r15,%rsi
+  801b97:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b9c:	48 b8 42 13 80 00 00 	movabs $0x801342,%rax
+  801ba3:	00 00 00 
+  801ba6:	ff d0                	call   *%rax
+  801ba8:	89 c3                	mov    %eax,%ebx
+  801baa:	85 c0                	test   %eax,%eax
+  801bac:	78 14                	js     801bc2 <dup+0xf7>
+
+    return newfdnum;
+  801bae:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801bb1:	89 d8                	mov    %ebx,%eax
+  801bb3:	48 83 c4 18          	add    $0x18,%rsp
+  801bb7:	5b                   	pop    %rbx
+  801bb8:	41 5c                	pop    %r12
+  801bba:	41 5d                	pop    %r13
+  801bbc:	41 5e                	pop    %r14
+  801bbe:	41 5f                	pop    %r15
+  801bc0:	5d                   	pop    %rbp
+  801bc1:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801bc2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bc7:	4c 89 ee             	mov    %r13,%rsi
+  801bca:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bcf:	49 bc a7 13 80 00 00 	movabs $0x8013a7,%r12
+  801bd6:	00 00 00 
+  801bd9:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801bdc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801be1:	4c 89 f6             	mov    %r14,%rsi
+  801be4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801be9:	41 ff d4             	call   *%r12
+    return res;
+  801bec:	eb c3                	jmp    801bb1 <dup+0xe6>
+
+0000000000801bee <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801bee:	55                   	push   %rbp
+  801bef:	48 89 e5             	mov    %rsp,%rbp
+  801bf2:	41 56                	push   %r14
+  801bf4:	41 55                	push   %r13
+  801bf6:	41 54                	push   %r12
+  801bf8:	53                   	push   %rbx
+  801bf9:	48 83 ec 10          	sub    $0x10,%rsp
+  801bfd:	89 fb                	mov    %edi,%ebx
+  801bff:	49 89 f4             	mov    %rsi,%r12
+  801c02:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c05:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c09:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  801c10:	00 00 00 
+  801c13:	ff d0                	call   *%rax
+  801c15:	85 c0                	test   %eax,%eax
+  801c17:	78 4c                	js     801c65 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c19:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c1d:	41 8b 3e             	mov    (%r14),%edi
+  801c20:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c24:	48 b8 56 19 80 00 00 	movabs $0x801956,%rax
+  801c2b:	00 00 00 
+  801c2e:	ff d0                	call   *%rax
+  801c30:	85 c0                	test   %eax,%eax
+  801c32:	78 35                	js     801c69 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c34:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c38:	83 e0 03             	and    $0x3,%eax
+  801c3b:	83 f8 01             	cmp    $0x1,%eax
+  801c3e:	74 2d                	je     801c6d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c40:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c44:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c48:	48 85 c0             	test   %rax,%rax
+  801c4b:	74 56                	je     801ca3 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c4d:	4c 89 ea             	mov    %r13,%rdx
+  801c50:	4c 89 e6             	mov    %r12,%rsi
+  801c53:	4c 89 f7             	mov    %r14,%rdi
+  801c56:	ff d0                	call   *%rax
+}
+  801c58:	48 83 c4 10          	add    $0x10,%rsp
+  801c5c:	5b                   	pop    %rbx
+  801c5d:	41 5c                	pop    %r12
+  801c5f:	41 5d                	pop    %r13
+  801c61:	41 5e                	pop    %r14
+  801c63:	5d                   	pop    %rbp
+  801c64:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c65:	48 98                	cltq
+  801c67:	eb ef                	jmp    801c58 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c69:	48 98                	cltq
+  801c6b:	eb eb                	jmp    801c58 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c6d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c74:	00 00 00 
+  801c77:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c7d:	89 da                	mov    %ebx,%edx
+  801c7f:	48 bf e1 3b 80 00 00 	movabs $0x803be1,%rdi
+  801c86:	00 00 00 
+  801c89:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c8e:	48 b9 06 04 80 00 00 	movabs $0x800406,%rcx
+  801c95:	00 00 00 
+  801c98:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c9a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ca1:	eb b5                	jmp    801c58 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ca3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801caa:	eb ac                	jmp    801c58 <read+0x6a>
+
+0000000000801cac <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801cac:	55                   	push   %rbp
+  801cad:	48 89 e5             	mov    %rsp,%rbp
+  801cb0:	41 57                	push   %r15
+  801cb2:	41 56                	push   %r14
+  801cb4:	41 55                	push   %r13
+  801cb6:	41 54                	push   %r12
+  801cb8:	53                   	push   %rbx
+  801cb9:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801cbd:	48 85 d2             	test   %rdx,%rdx
+  801cc0:	74 54                	je     801d16 <readn+0x6a>
+  801cc2:	41 89 fd             	mov    %edi,%r13d
+  801cc5:	49 89 f6             	mov    %rsi,%r14
+  801cc8:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801ccb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801cd0:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801cd5:	49 bf ee 1b 80 00 00 	movabs $0x801bee,%r15
+  801cdc:	00 00 00 
+  801cdf:	4c 89 e2             	mov    %r12,%rdx
+  801ce2:	48 29 f2             	sub    %rsi,%rdx
+  801ce5:	4c 01 f6             	add    %r14,%rsi
+  801ce8:	44 89 ef             	mov    %r13d,%edi
+  801ceb:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801cee:	85 c0                	test   %eax,%eax
+  801cf0:	78 20                	js     801d12 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801cf2:	01 c3                	add    %eax,%ebx
+  801cf4:	85 c0                	test   %eax,%eax
+  801cf6:	74 08                	je     801d00 <readn+0x54>
+  801cf8:	48 63 f3             	movslq %ebx,%rsi
+  801cfb:	4c 39 e6             	cmp    %r12,%rsi
+  801cfe:	72 df                	jb     801cdf <readn+0x33>
+    }
+    return res;
+  801d00:	48 63 c3             	movslq %ebx,%rax
+}
+  801d03:	48 83 c4 08          	add    $0x8,%rsp
+  801d07:	5b                   	pop    %rbx
+  801d08:	41 5c                	pop    %r12
+  801d0a:	41 5d                	pop    %r13
+  801d0c:	41 5e                	pop    %r14
+  801d0e:	41 5f                	pop    %r15
+  801d10:	5d                   	pop    %rbp
+  801d11:	c3                   	ret
+        if (inc < 0) return inc;
+  801d12:	48 98                	cltq
+  801d14:	eb ed                	jmp    801d03 <readn+0x57>
+    int inc = 1, res = 0;
+  801d16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d1b:	eb e3                	jmp    801d00 <readn+0x54>
+
+0000000000801d1d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d1d:	55                   	push   %rbp
+  801d1e:	48 89 e5             	mov    %rsp,%rbp
+  801d21:	41 56                	push   %r14
+  801d23:	41 55                	push   %r13
+  801d25:	41 54                	push   %r12
+  801d27:	53                   	push   %rbx
+  801d28:	48 83 ec 10          	sub    $0x10,%rsp
+  801d2c:	89 fb                	mov    %edi,%ebx
+  801d2e:	49 89 f4             	mov    %rsi,%r12
+  801d31:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d34:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d38:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  801d3f:	00 00 00 
+  801d42:	ff d0                	call   *%rax
+  801d44:	85 c0                	test   %eax,%eax
+  801d46:	78 47                	js     801d8f <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d48:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d4c:	41 8b 3e             	mov    (%r14),%edi
+  801d4f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d53:	48 b8 56 19 80 00 00 	movabs $0x801956,%rax
+  801d5a:	00 00 00 
+  801d5d:	ff d0                	call   *%rax
+  801d5f:	85 c0                	test   %eax,%eax
+  801d61:	78 30                	js     801d93 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d63:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d68:	74 2d                	je     801d97 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d6a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d6e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d72:	48 85 c0             	test   %rax,%rax
+  801d75:	74 56                	je     801dcd <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801d77:	4c 89 ea             	mov    %r13,%rdx
+  801d7a:	4c 89 e6             	mov    %r12,%rsi
+  801d7d:	4c 89 f7             	mov    %r14,%rdi
+  801d80:	ff d0                	call   *%rax
+}
+  801d82:	48 83 c4 10          	add    $0x10,%rsp
+  801d86:	5b                   	pop    %rbx
+  801d87:	41 5c                	pop    %r12
+  801d89:	41 5d                	pop    %r13
+  801d8b:	41 5e                	pop    %r14
+  801d8d:	5d                   	pop    %rbp
+  801d8e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d8f:	48 98                	cltq
+  801d91:	eb ef                	jmp    801d82 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d93:	48 98                	cltq
+  801d95:	eb eb                	jmp    801d82 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d97:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d9e:	00 00 00 
+  801da1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801da7:	89 da                	mov    %ebx,%edx
+  801da9:	48 bf fd 3b 80 00 00 	movabs $0x803bfd,%rdi
+  801db0:	00 00 00 
+  801db3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db8:	48 b9 06 04 80 00 00 	movabs $0x800406,%rcx
+  801dbf:	00 00 00 
+  801dc2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801dc4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dcb:	eb b5                	jmp    801d82 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dcd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dd4:	eb ac                	jmp    801d82 <write+0x65>
+
+0000000000801dd6 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801dd6:	55                   	push   %rbp
+  801dd7:	48 89 e5             	mov    %rsp,%rbp
+  801dda:	53                   	push   %rbx
+  801ddb:	48 83 ec 18          	sub    $0x18,%rsp
+  801ddf:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801de1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801de5:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  801dec:	00 00 00 
+  801def:	ff d0                	call   *%rax
+  801df1:	85 c0                	test   %eax,%eax
+  801df3:	78 0c                	js     801e01 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801df5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801df9:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801dfc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e01:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e05:	c9                   	leave
+  801e06:	c3                   	ret
+
+0000000000801e07 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e07:	55                   	push   %rbp
+  801e08:	48 89 e5             	mov    %rsp,%rbp
+  801e0b:	41 55                	push   %r13
+  801e0d:	41 54                	push   %r12
+  801e0f:	53                   	push   %rbx
+  801e10:	48 83 ec 18          	sub    $0x18,%rsp
+  801e14:	89 fb                	mov    %edi,%ebx
+  801e16:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e19:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e1d:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  801e24:	00 00 00 
+  801e27:	ff d0                	call   *%rax
+  801e29:	85 c0                	test   %eax,%eax
+  801e2b:	78 38                	js     801e65 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e2d:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e31:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e35:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e39:	48 b8 56 19 80 00 00 	movabs $0x801956,%rax
+  801e40:	00 00 00 
+  801e43:	ff d0                	call   *%rax
+  801e45:	85 c0                	test   %eax,%eax
+  801e47:	78 1c                	js     801e65 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e49:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e4e:	74 20                	je     801e70 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e50:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e54:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801e58:	48 85 c0             	test   %rax,%rax
+  801e5b:	74 47                	je     801ea4 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e5d:	44 89 e6             	mov    %r12d,%esi
+  801e60:	4c 89 ef             	mov    %r13,%rdi
+  801e63:	ff d0                	call   *%rax
+}
+  801e65:	48 83 c4 18          	add    $0x18,%rsp
+  801e69:	5b                   	pop    %rbx
+  801e6a:	41 5c                	pop    %r12
+  801e6c:	41 5d                	pop    %r13
+  801e6e:	5d                   	pop    %rbp
+  801e6f:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801e70:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e77:	00 00 00 
+  801e7a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e80:	89 da                	mov    %ebx,%edx
+  801e82:	48 bf c0 3b 80 00 00 	movabs $0x803bc0,%rdi
+  801e89:	00 00 00 
+  801e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e91:	48 b9 06 04 80 00 00 	movabs $0x800406,%rcx
+  801e98:	00 00 00 
+  801e9b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e9d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ea2:	eb c1                	jmp    801e65 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ea4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ea9:	eb ba                	jmp    801e65 <ftruncate+0x5e>
+
+0000000000801eab <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801eab:	55                   	push   %rbp
+  801eac:	48 89 e5             	mov    %rsp,%rbp
+  801eaf:	41 54                	push   %r12
+  801eb1:	53                   	push   %rbx
+  801eb2:	48 83 ec 10          	sub    $0x10,%rsp
+  801eb6:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eb9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ebd:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  801ec4:	00 00 00 
+  801ec7:	ff d0                	call   *%rax
+  801ec9:	85 c0                	test   %eax,%eax
+  801ecb:	78 4e                	js     801f1b <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ecd:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ed1:	41 8b 3c 24          	mov    (%r12),%edi
+  801ed5:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ed9:	48 b8 56 19 80 00 00 	movabs $0x801956,%rax
+  801ee0:	00 00 00 
+  801ee3:	ff d0                	call   *%rax
+  801ee5:	85 c0                	test   %eax,%eax
+  801ee7:	78 32                	js     801f1b <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ee9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801eed:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801ef2:	74 30                	je     801f24 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801ef4:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801ef7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801efe:	00 00 00 
+    stat->st_isdir = 0;
+  801f01:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f08:	00 00 00 
+    stat->st_dev = dev;
+  801f0b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f12:	48 89 de             	mov    %rbx,%rsi
+  801f15:	4c 89 e7             	mov    %r12,%rdi
+  801f18:	ff 50 28             	call   *0x28(%rax)
+}
+  801f1b:	48 83 c4 10          	add    $0x10,%rsp
+  801f1f:	5b                   	pop    %rbx
+  801f20:	41 5c                	pop    %r12
+  801f22:	5d                   	pop    %rbp
+  801f23:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f24:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f29:	eb f0                	jmp    801f1b <fstat+0x70>
+
+0000000000801f2b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f2b:	55                   	push   %rbp
+  801f2c:	48 89 e5             	mov    %rsp,%rbp
+  801f2f:	41 54                	push   %r12
+  801f31:	53                   	push   %rbx
+  801f32:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f35:	be 00 00 00 00       	mov    $0x0,%esi
+  801f3a:	48 b8 ac 21 80 00 00 	movabs $0x8021ac,%rax
+  801f41:	00 00 00 
+  801f44:	ff d0                	call   *%rax
+  801f46:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f48:	85 c0                	test   %eax,%eax
+  801f4a:	78 25                	js     801f71 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f4c:	4c 89 e6             	mov    %r12,%rsi
+  801f4f:	89 c7                	mov    %eax,%edi
+  801f51:	48 b8 ab 1e 80 00 00 	movabs $0x801eab,%rax
+  801f58:	00 00 00 
+  801f5b:	ff d0                	call   *%rax
+  801f5d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f60:	89 df                	mov    %ebx,%edi
+  801f62:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  801f69:	00 00 00 
+  801f6c:	ff d0                	call   *%rax
+
+    return res;
+  801f6e:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f71:	89 d8                	mov    %ebx,%eax
+  801f73:	5b                   	pop    %rbx
+  801f74:	41 5c                	pop    %r12
+  801f76:	5d                   	pop    %rbp
+  801f77:	c3                   	ret
+
+0000000000801f78 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801f78:	55                   	push   %rbp
+  801f79:	48 89 e5             	mov    %rsp,%rbp
+  801f7c:	41 54                	push   %r12
+  801f7e:	53                   	push   %rbx
+  801f7f:	48 83 ec 10          	sub    $0x10,%rsp
+  801f83:	41 89 fc             	mov    %edi,%r12d
+  801f86:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f89:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801f90:	00 00 00 
+  801f93:	83 38 00             	cmpl   $0x0,(%rax)
+  801f96:	74 5e                	je     801ff6 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801f98:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801f9e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801fa3:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801faa:	00 00 00 
+  801fad:	44 89 e6             	mov    %r12d,%esi
+  801fb0:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801fb7:	00 00 00 
+  801fba:	8b 38                	mov    (%rax),%edi
+  801fbc:	48 b8 2d 34 80 00 00 	movabs $0x80342d,%rax
+  801fc3:	00 00 00 
+  801fc6:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801fc8:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801fcf:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801fd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fd5:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801fd9:	48 89 de             	mov    %rbx,%rsi
+  801fdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fe1:	48 b8 98 33 80 00 00 	movabs $0x803398,%rax
+  801fe8:	00 00 00 
+  801feb:	ff d0                	call   *%rax
+}
+  801fed:	48 83 c4 10          	add    $0x10,%rsp
+  801ff1:	5b                   	pop    %rbx
+  801ff2:	41 5c                	pop    %r12
+  801ff4:	5d                   	pop    %rbp
+  801ff5:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ff6:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ffb:	48 b8 cd 34 80 00 00 	movabs $0x8034cd,%rax
+  802002:	00 00 00 
+  802005:	ff d0                	call   *%rax
+  802007:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80200e:	00 00 
+  802010:	eb 86                	jmp    801f98 <fsipc+0x20>
+
+0000000000802012 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802012:	55                   	push   %rbp
+  802013:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802016:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80201d:	00 00 00 
+  802020:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802023:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802025:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802028:	be 00 00 00 00       	mov    $0x0,%esi
+  80202d:	bf 02 00 00 00       	mov    $0x2,%edi
+  802032:	48 b8 78 1f 80 00 00 	movabs $0x801f78,%rax
+  802039:	00 00 00 
+  80203c:	ff d0                	call   *%rax
+}
+  80203e:	5d                   	pop    %rbp
+  80203f:	c3                   	ret
+
+0000000000802040 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802040:	55                   	push   %rbp
+  802041:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802044:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802047:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80204e:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802050:	be 00 00 00 00       	mov    $0x0,%esi
+  802055:	bf 06 00 00 00       	mov    $0x6,%edi
+  80205a:	48 b8 78 1f 80 00 00 	movabs $0x801f78,%rax
+  802061:	00 00 00 
+  802064:	ff d0                	call   *%rax
+}
+  802066:	5d                   	pop    %rbp
+  802067:	c3                   	ret
+
+0000000000802068 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802068:	55                   	push   %rbp
+  802069:	48 89 e5             	mov    %rsp,%rbp
+  80206c:	41 54                	push   %r12
+  80206e:	53                   	push   %rbx
+  80206f:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802072:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802075:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80207c:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80207e:	be 00 00 00 00       	mov    $0x0,%esi
+  802083:	bf 05 00 00 00       	mov    $0x5,%edi
+  802088:	48 b8 78 1f 80 00 00 	movabs $0x801f78,%rax
+  80208f:	00 00 00 
+  802092:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802094:	85 c0                	test   %eax,%eax
+  802096:	78 3d                	js     8020d5 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802098:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80209f:	00 00 00 
+  8020a2:	4c 89 e6             	mov    %r12,%rsi
+  8020a5:	48 89 df             	mov    %rbx,%rdi
+  8020a8:	48 b8 2b 0d 80 00 00 	movabs $0x800d2b,%rax
+  8020af:	00 00 00 
+  8020b2:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8020b4:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8020bb:	00 
+  8020bc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020c2:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8020c9:	00 
+  8020ca:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8020d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020d5:	5b                   	pop    %rbx
+  8020d6:	41 5c                	pop    %r12
+  8020d8:	5d                   	pop    %rbp
+  8020d9:	c3                   	ret
+
+00000000008020da <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8020da:	55                   	push   %rbp
+  8020db:	48 89 e5             	mov    %rsp,%rbp
+  8020de:	41 54                	push   %r12
+  8020e0:	53                   	push   %rbx
+  8020e1:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8020e4:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8020e9:	48 39 c2             	cmp    %rax,%rdx
+  8020ec:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8020f0:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8020f3:	48 89 c2             	mov    %rax,%rdx
+  8020f6:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8020fd:	00 00 00 
+  802100:	48 b8 8c 0f 80 00 00 	movabs $0x800f8c,%rax
+  802107:	00 00 00 
+  80210a:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80210c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802113:	00 00 00 
+  802116:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80211b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  80211d:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  802121:	be 00 00 00 00       	mov    $0x0,%esi
+  802126:	bf 04 00 00 00       	mov    $0x4,%edi
+  80212b:	48 b8 78 1f 80 00 00 	movabs $0x801f78,%rax
+  802132:	00 00 00 
+  802135:	ff d0                	call   *%rax
+  802137:	48 98                	cltq
+}
+  802139:	5b                   	pop    %rbx
+  80213a:	41 5c                	pop    %r12
+  80213c:	5d                   	pop    %rbp
+  80213d:	c3                   	ret
+
+000000000080213e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80213e:	55                   	push   %rbp
+  80213f:	48 89 e5             	mov    %rsp,%rbp
+  802142:	41 54                	push   %r12
+  802144:	53                   	push   %rbx
+  802145:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802148:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80214f:	00 00 00 
+  802152:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802155:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  802157:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80215c:	48 39 ca             	cmp    %rcx,%rdx
+  80215f:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  802163:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  802167:	be 00 00 00 00       	mov    $0x0,%esi
+  80216c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802171:	48 b8 78 1f 80 00 00 	movabs $0x801f78,%rax
+  802178:	00 00 00 
+  80217b:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  80217d:	85 c0                	test   %eax,%eax
+  80217f:	78 27                	js     8021a8 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802181:	48 63 d8             	movslq %eax,%rbx
+  802184:	48 89 da             	mov    %rbx,%rdx
+  802187:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80218e:	00 00 00 
+  802191:	4c 89 e7             	mov    %r12,%rdi
+  802194:	48 b8 8c 0f 80 00 00 	movabs $0x800f8c,%rax
+  80219b:	00 00 00 
+  80219e:	ff d0                	call   *%rax
+    return bytes_read;
+  8021a0:	48 89 d8             	mov    %rbx,%rax
+}
+  8021a3:	5b                   	pop    %rbx
+  8021a4:	41 5c                	pop    %r12
+  8021a6:	5d                   	pop    %rbp
+  8021a7:	c3                   	ret
+        return bytes_read;
+  8021a8:	48 98                	cltq
+  8021aa:	eb f7                	jmp    8021a3 <devfile_read+0x65>
+
+00000000008021ac <open>:
+open(const char *path, int mode) {
+  8021ac:	55                   	push   %rbp
+  8021ad:	48 89 e5             	mov    %rsp,%rbp
+  8021b0:	41 55                	push   %r13
+  8021b2:	41 54                	push   %r12
+  8021b4:	53                   	push   %rbx
+  8021b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8021b9:	49 89 fc             	mov    %rdi,%r12
+  8021bc:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8021bf:	48 b8 ed 0c 80 00 00 	movabs $0x800ced,%rax
+  8021c6:	00 00 00 
+  8021c9:	ff d0                	call   *%rax
+  8021cb:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8021d1:	0f 87 8a 00 00 00    	ja     802261 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8021d7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8021db:	48 b8 ab 18 80 00 00 	movabs $0x8018ab,%rax
+  8021e2:	00 00 00 
+  8021e5:	ff d0                	call   *%rax
+  8021e7:	89 c3                	mov    %eax,%ebx
+  8021e9:	85 c0                	test   %eax,%eax
+  8021eb:	78 50                	js     80223d <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8021ed:	4c 89 e6             	mov    %r12,%rsi
+  8021f0:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8021f7:	00 00 00 
+  8021fa:	48 89 df             	mov    %rbx,%rdi
+  8021fd:	48 b8 2b 0d 80 00 00 	movabs $0x800d2b,%rax
+  802204:	00 00 00 
+  802207:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802209:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802210:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802214:	bf 01 00 00 00       	mov    $0x1,%edi
+  802219:	48 b8 78 1f 80 00 00 	movabs $0x801f78,%rax
+  802220:	00 00 00 
+  802223:	ff d0                	call   *%rax
+  802225:	89 c3                	mov    %eax,%ebx
+  802227:	85 c0                	test   %eax,%eax
+  802229:	78 1f                	js     80224a <open+0x9e>
+    return fd2num(fd);
+  80222b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80222f:	48 b8 7d 18 80 00 00 	movabs $0x80187d,%rax
+  802236:	00 00 00 
+  802239:	ff d0                	call   *%rax
+  80223b:	89 c3                	mov    %eax,%ebx
+}
+  80223d:	89 d8                	mov    %ebx,%eax
+  80223f:	48 83 c4 18          	add    $0x18,%rsp
+  802243:	5b                   	pop    %rbx
+  802244:	41 5c                	pop    %r12
+  802246:	41 5d                	pop    %r13
+  802248:	5d                   	pop    %rbp
+  802249:	c3                   	ret
+        fd_close(fd, 0);
+  80224a:	be 00 00 00 00       	mov    $0x0,%esi
+  80224f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802253:	48 b8 c6 19 80 00 00 	movabs $0x8019c6,%rax
+  80225a:	00 00 00 
+  80225d:	ff d0                	call   *%rax
+        return res;
+  80225f:	eb dc                	jmp    80223d <open+0x91>
+        return -E_BAD_PATH;
+  802261:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802266:	eb d5                	jmp    80223d <open+0x91>
+
+0000000000802268 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802268:	55                   	push   %rbp
+  802269:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80226c:	be 00 00 00 00       	mov    $0x0,%esi
+  802271:	bf 08 00 00 00       	mov    $0x8,%edi
+  802276:	48 b8 78 1f 80 00 00 	movabs $0x801f78,%rax
+  80227d:	00 00 00 
+  802280:	ff d0                	call   *%rax
+}
+  802282:	5d                   	pop    %rbp
+  802283:	c3                   	ret
+
+0000000000802284 <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  802284:	55                   	push   %rbp
+  802285:	48 89 e5             	mov    %rsp,%rbp
+  802288:	41 55                	push   %r13
+  80228a:	41 54                	push   %r12
+  80228c:	53                   	push   %rbx
+  80228d:	48 83 ec 08          	sub    $0x8,%rsp
+  802291:	48 89 fb             	mov    %rdi,%rbx
+  802294:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  802297:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  80229a:	48 b8 71 30 80 00 00 	movabs $0x803071,%rax
+  8022a1:	00 00 00 
+  8022a4:	ff d0                	call   *%rax
+  8022a6:	41 89 c1             	mov    %eax,%r9d
+  8022a9:	4d 89 e0             	mov    %r12,%r8
+  8022ac:	49 29 d8             	sub    %rbx,%r8
+  8022af:	48 89 d9             	mov    %rbx,%rcx
+  8022b2:	44 89 ea             	mov    %r13d,%edx
+  8022b5:	48 89 de             	mov    %rbx,%rsi
+  8022b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022bd:	48 b8 42 13 80 00 00 	movabs $0x801342,%rax
+  8022c4:	00 00 00 
+  8022c7:	ff d0                	call   *%rax
+}
+  8022c9:	48 83 c4 08          	add    $0x8,%rsp
+  8022cd:	5b                   	pop    %rbx
+  8022ce:	41 5c                	pop    %r12
+  8022d0:	41 5d                	pop    %r13
+  8022d2:	5d                   	pop    %rbp
+  8022d3:	c3                   	ret
+
+00000000008022d4 <spawn>:
+spawn(const char *prog, const char **argv) {
+  8022d4:	55                   	push   %rbp
+  8022d5:	48 89 e5             	mov    %rsp,%rbp
+  8022d8:	41 57                	push   %r15
+  8022da:	41 56                	push   %r14
+  8022dc:	41 55                	push   %r13
+  8022de:	41 54                	push   %r12
+  8022e0:	53                   	push   %rbx
+  8022e1:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  8022e8:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  8022eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f0:	48 b8 ac 21 80 00 00 	movabs $0x8021ac,%rax
+  8022f7:	00 00 00 
+  8022fa:	ff d0                	call   *%rax
+  8022fc:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+    if (fd < 0) return fd;
+  802302:	85 c0                	test   %eax,%eax
+  802304:	0f 88 51 06 00 00    	js     80295b <spawn+0x687>
+  80230a:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  80230c:	ba 00 02 00 00       	mov    $0x200,%edx
+  802311:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  802318:	48 b8 ac 1c 80 00 00 	movabs $0x801cac,%rax
+  80231f:	00 00 00 
+  802322:	ff d0                	call   *%rax
+  802324:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  802326:	3d 00 02 00 00       	cmp    $0x200,%eax
+  80232b:	0f 85 76 02 00 00    	jne    8025a7 <spawn+0x2d3>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  802331:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  802338:	ff ff 00 
+  80233b:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  802342:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  802349:	01 01 00 
+  80234c:	48 39 d0             	cmp    %rdx,%rax
+  80234f:	0f 85 8e 02 00 00    	jne    8025e3 <spawn+0x30f>
+        elf->e_type != ET_EXEC /* executable */ ||
+  802355:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  80235c:	00 3e 00 
+  80235f:	0f 85 7e 02 00 00    	jne    8025e3 <spawn+0x30f>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802365:	b8 08 00 00 00       	mov    $0x8,%eax
+  80236a:	cd 30                	int    $0x30
+  80236c:	41 89 c6             	mov    %eax,%r14d
+  80236f:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  802371:	85 c0                	test   %eax,%eax
+  802373:	0f 88 ca 05 00 00    	js     802943 <spawn+0x66f>
+    envid_t child = res;
+  802379:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  80237f:	0f b6 c0             	movzbl %al,%eax
+  802382:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802389:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  802390:	00 00 00 
+  802393:	48 01 c6             	add    %rax,%rsi
+  802396:	48 8b 06             	mov    (%rsi),%rax
+  802399:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  8023a0:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  8023a7:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  8023ae:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  8023b5:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  8023bc:	48 29 ce             	sub    %rcx,%rsi
+  8023bf:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  8023c5:	c1 e9 03             	shr    $0x3,%ecx
+  8023c8:	89 c9                	mov    %ecx,%ecx
+  8023ca:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  8023cd:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  8023d4:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  8023db:	49 8b 3c 24          	mov    (%r12),%rdi
+  8023df:	48 85 ff             	test   %rdi,%rdi
+  8023e2:	0f 84 8b 05 00 00    	je     802973 <spawn+0x69f>
+  8023e8:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  8023ee:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  8023f4:	48 bb ed 0c 80 00 00 	movabs $0x800ced,%rbx
+  8023fb:	00 00 00 
+  8023fe:	ff d3                	call   *%rbx
+  802400:	4c 01 f8             	add    %r15,%rax
+  802403:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  802407:	4c 89 ea             	mov    %r13,%rdx
+  80240a:	49 83 c5 01          	add    $0x1,%r13
+  80240e:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  802413:	48 85 ff             	test   %rdi,%rdi
+  802416:	75 e6                	jne    8023fe <spawn+0x12a>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  802418:	49 89 d5             	mov    %rdx,%r13
+  80241b:	48 89 95 e0 fc ff ff 	mov    %rdx,-0x320(%rbp)
+  802422:	48 f7 d0             	not    %rax
+  802425:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  80242c:	49 89 df             	mov    %rbx,%r15
+  80242f:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  802433:	4c 89 bd f0 fc ff ff 	mov    %r15,-0x310(%rbp)
+  80243a:	89 d0                	mov    %edx,%eax
+  80243c:	83 c0 01             	add    $0x1,%eax
+  80243f:	48 98                	cltq
+  802441:	48 c1 e0 03          	shl    $0x3,%rax
+  802445:	49 29 c7             	sub    %rax,%r15
+  802448:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  80244f:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  802453:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  802459:	0f 86 cb 04 00 00    	jbe    80292a <spawn+0x656>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  80245f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802464:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802469:	be 00 00 40 00       	mov    $0x400000,%esi
+  80246e:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  802475:	00 00 00 
+  802478:	ff d0                	call   *%rax
+  80247a:	85 c0                	test   %eax,%eax
+  80247c:	0f 88 ad 04 00 00    	js     80292f <spawn+0x65b>
+    for (i = 0; i < argc; i++) {
+  802482:	4c 89 e8             	mov    %r13,%rax
+  802485:	45 85 ed             	test   %r13d,%r13d
+  802488:	7e 54                	jle    8024de <spawn+0x20a>
+  80248a:	4d 89 fd             	mov    %r15,%r13
+  80248d:	48 98                	cltq
+  80248f:	4d 8d 3c c7          	lea    (%r15,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  802493:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  80249a:	00 00 00 
+  80249d:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  8024a4:	ff 
+  8024a5:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  8024a9:	49 8b 34 24          	mov    (%r12),%rsi
+  8024ad:	48 89 df             	mov    %rbx,%rdi
+  8024b0:	48 b8 2b 0d 80 00 00 	movabs $0x800d2b,%rax
+  8024b7:	00 00 00 
+  8024ba:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  8024bc:	49 8b 3c 24          	mov    (%r12),%rdi
+  8024c0:	48 b8 ed 0c 80 00 00 	movabs $0x800ced,%rax
+  8024c7:	00 00 00 
+  8024ca:	ff d0                	call   *%rax
+  8024cc:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  8024d1:	49 83 c5 08          	add    $0x8,%r13
+  8024d5:	49 83 c4 08          	add    $0x8,%r12
+  8024d9:	4d 39 fd             	cmp    %r15,%r13
+  8024dc:	75 b5                	jne    802493 <spawn+0x1bf>
+    argv_store[argc] = 0;
+  8024de:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  8024e5:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  8024ec:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8024ed:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  8024f4:	0f 85 30 01 00 00    	jne    80262a <spawn+0x356>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  8024fa:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  802501:	00 00 00 
+  802504:	48 8b 9d e8 fc ff ff 	mov    -0x318(%rbp),%rbx
+  80250b:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  802512:	ff 
+  802513:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  802517:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  80251e:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  802522:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  802529:	00 00 00 
+  80252c:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  802533:	ff 
+  802534:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  80253b:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  802541:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  802547:	44 89 f2             	mov    %r14d,%edx
+  80254a:	be 00 00 40 00       	mov    $0x400000,%esi
+  80254f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802554:	48 b8 42 13 80 00 00 	movabs $0x801342,%rax
+  80255b:	00 00 00 
+  80255e:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  802560:	48 bb a7 13 80 00 00 	movabs $0x8013a7,%rbx
+  802567:	00 00 00 
+  80256a:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80256f:	be 00 00 40 00       	mov    $0x400000,%esi
+  802574:	bf 00 00 00 00       	mov    $0x0,%edi
+  802579:	ff d3                	call   *%rbx
+  80257b:	85 c0                	test   %eax,%eax
+  80257d:	78 eb                	js     80256a <spawn+0x296>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80257f:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  802586:	4c 8d a4 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r12
+  80258d:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80258e:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  802595:	00 
+  802596:	0f 84 87 02 00 00    	je     802823 <spawn+0x54f>
+  80259c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8025a2:	e9 fe 00 00 00       	jmp    8026a5 <spawn+0x3d1>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  8025a7:	48 bf 40 3c 80 00 00 	movabs $0x803c40,%rdi
+  8025ae:	00 00 00 
+  8025b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b6:	48 ba 06 04 80 00 00 	movabs $0x800406,%rdx
+  8025bd:	00 00 00 
+  8025c0:	ff d2                	call   *%rdx
+        close(fd);
+  8025c2:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  8025c8:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  8025cf:	00 00 00 
+  8025d2:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8025d4:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  8025db:	ff ff ff 
+  8025de:	e9 78 03 00 00       	jmp    80295b <spawn+0x687>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8025e3:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  8025e8:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  8025ee:	48 bf a0 3c 80 00 00 	movabs $0x803ca0,%rdi
+  8025f5:	00 00 00 
+  8025f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025fd:	48 b9 06 04 80 00 00 	movabs $0x800406,%rcx
+  802604:	00 00 00 
+  802607:	ff d1                	call   *%rcx
+        close(fd);
+  802609:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  80260f:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  802616:	00 00 00 
+  802619:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  80261b:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  802622:	ff ff ff 
+  802625:	e9 31 03 00 00       	jmp    80295b <spawn+0x687>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  80262a:	48 b9 70 3c 80 00 00 	movabs $0x803c70,%rcx
+  802631:	00 00 00 
+  802634:	48 ba ba 3c 80 00 00 	movabs $0x803cba,%rdx
+  80263b:	00 00 00 
+  80263e:	be f0 00 00 00       	mov    $0xf0,%esi
+  802643:	48 bf cf 3c 80 00 00 	movabs $0x803ccf,%rdi
+  80264a:	00 00 00 
+  80264d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802652:	49 b8 b6 02 80 00 00 	movabs $0x8002b6,%r8
+  802659:	00 00 00 
+  80265c:	41 ff d0             	call   *%r8
+        if (err)
+            return err;
+    }
+
+    /* Allocate filesz in parent to UTEMP */
+    int err = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+  80265f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802664:	4c 89 ea             	mov    %r13,%rdx
+  802667:	be 00 00 40 00       	mov    $0x400000,%esi
+  80266c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802671:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  802678:	00 00 00 
+  80267b:	ff d0                	call   *%rax
+    if (err)
+  80267d:	85 c0                	test   %eax,%eax
+  80267f:	0f 84 d2 00 00 00    	je     802757 <spawn+0x483>
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  802685:	85 c0                	test   %eax,%eax
+  802687:	0f 88 99 02 00 00    	js     802926 <spawn+0x652>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80268d:	49 83 c7 01          	add    $0x1,%r15
+  802691:	49 83 c4 38          	add    $0x38,%r12
+  802695:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  80269c:	49 39 c7             	cmp    %rax,%r15
+  80269f:	0f 83 7e 01 00 00    	jae    802823 <spawn+0x54f>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  8026a5:	41 83 3c 24 01       	cmpl   $0x1,(%r12)
+  8026aa:	75 e1                	jne    80268d <spawn+0x3b9>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  8026ac:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8026b1:	41 89 c6             	mov    %eax,%r14d
+  8026b4:	41 83 e6 02          	and    $0x2,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  8026b8:	44 89 f2             	mov    %r14d,%edx
+  8026bb:	83 ca 04             	or     $0x4,%edx
+  8026be:	a8 04                	test   $0x4,%al
+  8026c0:	44 0f 45 f2          	cmovne %edx,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  8026c4:	44 89 f2             	mov    %r14d,%edx
+  8026c7:	83 ca 01             	or     $0x1,%edx
+  8026ca:	a8 01                	test   $0x1,%al
+  8026cc:	44 0f 45 f2          	cmovne %edx,%r14d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  8026d0:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  8026d5:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  8026db:	4d 8b 6c 24 20       	mov    0x20(%r12),%r13
+  8026e0:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  8026e5:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  8026ea:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  8026f0:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  8026f6:	89 d9                	mov    %ebx,%ecx
+  8026f8:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8026fe:	74 14                	je     802714 <spawn+0x440>
+        va -= res;
+  802700:	48 63 f1             	movslq %ecx,%rsi
+  802703:	48 29 f3             	sub    %rsi,%rbx
+        memsz += res;
+  802706:	48 01 f2             	add    %rsi,%rdx
+        filesz += res;
+  802709:	49 01 f5             	add    %rsi,%r13
+        fileoffset -= res;
+  80270c:	29 c8                	sub    %ecx,%eax
+  80270e:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    filesz = ROUNDUP(filesz, PAGE_SIZE);
+  802714:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80271b:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    if (filesz < memsz) {
+  802722:	49 39 d5             	cmp    %rdx,%r13
+  802725:	0f 83 34 ff ff ff    	jae    80265f <spawn+0x38b>
+        int err = sys_alloc_region(child, (void *)va + filesz, memsz - filesz, PROT_RW);
+  80272b:	4c 29 ea             	sub    %r13,%rdx
+  80272e:	49 8d 74 1d 00       	lea    0x0(%r13,%rbx,1),%rsi
+  802733:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802738:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  80273e:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  802745:	00 00 00 
+  802748:	ff d0                	call   *%rax
+        if (err)
+  80274a:	85 c0                	test   %eax,%eax
+  80274c:	0f 84 0d ff ff ff    	je     80265f <spawn+0x38b>
+  802752:	e9 2e ff ff ff       	jmp    802685 <spawn+0x3b1>
+        return err;
+
+    /* seek() fd to fileoffset  */
+    err = seek(fd, fileoffset);
+  802757:	8b b5 f0 fc ff ff    	mov    -0x310(%rbp),%esi
+  80275d:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802763:	48 b8 d6 1d 80 00 00 	movabs $0x801dd6,%rax
+  80276a:	00 00 00 
+  80276d:	ff d0                	call   *%rax
+    if (err)
+  80276f:	85 c0                	test   %eax,%eax
+  802771:	0f 85 0e ff ff ff    	jne    802685 <spawn+0x3b1>
+        return err;
+
+    /* read filesz to UTEMP */
+    ssize_t bytes_read = readn(fd, UTEMP, filesz);
+  802777:	4c 89 ea             	mov    %r13,%rdx
+  80277a:	be 00 00 40 00       	mov    $0x400000,%esi
+  80277f:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802785:	48 b8 ac 1c 80 00 00 	movabs $0x801cac,%rax
+  80278c:	00 00 00 
+  80278f:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802791:	48 85 c0             	test   %rax,%rax
+  802794:	0f 88 eb fe ff ff    	js     802685 <spawn+0x3b1>
+        return bytes_read;
+    assert(bytes_read == filesz);
+  80279a:	4c 39 e8             	cmp    %r13,%rax
+  80279d:	75 4f                	jne    8027ee <spawn+0x51a>
+
+    /* Map read section conents to child */
+    err = sys_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+  80279f:	45 89 f1             	mov    %r14d,%r9d
+  8027a2:	41 80 c9 80          	or     $0x80,%r9b
+  8027a6:	4d 89 e8             	mov    %r13,%r8
+  8027a9:	48 89 d9             	mov    %rbx,%rcx
+  8027ac:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  8027b2:	be 00 00 40 00       	mov    $0x400000,%esi
+  8027b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027bc:	48 b8 42 13 80 00 00 	movabs $0x801342,%rax
+  8027c3:	00 00 00 
+  8027c6:	ff d0                	call   *%rax
+    if (err)
+  8027c8:	85 c0                	test   %eax,%eax
+  8027ca:	0f 85 b5 fe ff ff    	jne    802685 <spawn+0x3b1>
+        return err;
+
+    /* Unmap it from parent */
+    err = sys_unmap_region(CURENVID, UTEMP, filesz);
+  8027d0:	4c 89 ea             	mov    %r13,%rdx
+  8027d3:	be 00 00 40 00       	mov    $0x400000,%esi
+  8027d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027dd:	48 b8 a7 13 80 00 00 	movabs $0x8013a7,%rax
+  8027e4:	00 00 00 
+  8027e7:	ff d0                	call   *%rax
+    if (err)
+  8027e9:	e9 97 fe ff ff       	jmp    802685 <spawn+0x3b1>
+    assert(bytes_read == filesz);
+  8027ee:	48 b9 db 3c 80 00 00 	movabs $0x803cdb,%rcx
+  8027f5:	00 00 00 
+  8027f8:	48 ba ba 3c 80 00 00 	movabs $0x803cba,%rdx
+  8027ff:	00 00 00 
+  802802:	be 2f 01 00 00       	mov    $0x12f,%esi
+  802807:	48 bf cf 3c 80 00 00 	movabs $0x803ccf,%rdi
+  80280e:	00 00 00 
+  802811:	b8 00 00 00 00       	mov    $0x0,%eax
+  802816:	49 b8 b6 02 80 00 00 	movabs $0x8002b6,%r8
+  80281d:	00 00 00 
+  802820:	41 ff d0             	call   *%r8
+    close(fd);
+  802823:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802829:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  802830:	00 00 00 
+  802833:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  802835:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  80283c:	48 bf 84 22 80 00 00 	movabs $0x802284,%rdi
+  802843:	00 00 00 
+  802846:	48 b8 e5 30 80 00 00 	movabs $0x8030e5,%rax
+  80284d:	00 00 00 
+  802850:	ff d0                	call   *%rax
+  802852:	85 c0                	test   %eax,%eax
+  802854:	78 49                	js     80289f <spawn+0x5cb>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802856:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  80285d:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802863:	48 b8 47 15 80 00 00 	movabs $0x801547,%rax
+  80286a:	00 00 00 
+  80286d:	ff d0                	call   *%rax
+  80286f:	85 c0                	test   %eax,%eax
+  802871:	78 59                	js     8028cc <spawn+0x5f8>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802873:	be 02 00 00 00       	mov    $0x2,%esi
+  802878:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  80287e:	48 b8 de 14 80 00 00 	movabs $0x8014de,%rax
+  802885:	00 00 00 
+  802888:	ff d0                	call   *%rax
+  80288a:	85 c0                	test   %eax,%eax
+  80288c:	78 6b                	js     8028f9 <spawn+0x625>
+    return child;
+  80288e:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  802894:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+  80289a:	e9 bc 00 00 00       	jmp    80295b <spawn+0x687>
+        panic("copy_shared_region: %i", res);
+  80289f:	89 c1                	mov    %eax,%ecx
+  8028a1:	48 ba f0 3c 80 00 00 	movabs $0x803cf0,%rdx
+  8028a8:	00 00 00 
+  8028ab:	be 84 00 00 00       	mov    $0x84,%esi
+  8028b0:	48 bf cf 3c 80 00 00 	movabs $0x803ccf,%rdi
+  8028b7:	00 00 00 
+  8028ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bf:	49 b8 b6 02 80 00 00 	movabs $0x8002b6,%r8
+  8028c6:	00 00 00 
+  8028c9:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  8028cc:	89 c1                	mov    %eax,%ecx
+  8028ce:	48 ba 07 3d 80 00 00 	movabs $0x803d07,%rdx
+  8028d5:	00 00 00 
+  8028d8:	be 87 00 00 00       	mov    $0x87,%esi
+  8028dd:	48 bf cf 3c 80 00 00 	movabs $0x803ccf,%rdi
+  8028e4:	00 00 00 
+  8028e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ec:	49 b8 b6 02 80 00 00 	movabs $0x8002b6,%r8
+  8028f3:	00 00 00 
+  8028f6:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8028f9:	89 c1                	mov    %eax,%ecx
+  8028fb:	48 ba 21 3d 80 00 00 	movabs $0x803d21,%rdx
+  802902:	00 00 00 
+  802905:	be 8a 00 00 00       	mov    $0x8a,%esi
+  80290a:	48 bf cf 3c 80 00 00 	movabs $0x803ccf,%rdi
+  802911:	00 00 00 
+  802914:	b8 00 00 00 00       	mov    $0x0,%eax
+  802919:	49 b8 b6 02 80 00 00 	movabs $0x8002b6,%r8
+  802920:	00 00 00 
+  802923:	41 ff d0             	call   *%r8
+  802926:	89 c3                	mov    %eax,%ebx
+  802928:	eb 07                	jmp    802931 <spawn+0x65d>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  80292a:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80292f:	89 c3                	mov    %eax,%ebx
+    sys_env_destroy(child);
+  802931:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802937:	48 b8 b0 11 80 00 00 	movabs $0x8011b0,%rax
+  80293e:	00 00 00 
+  802941:	ff d0                	call   *%rax
+    close(fd);
+  802943:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802949:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  802950:	00 00 00 
+  802953:	ff d0                	call   *%rax
+    return res;
+  802955:	89 9d fc fc ff ff    	mov    %ebx,-0x304(%rbp)
+}
+  80295b:	8b 85 fc fc ff ff    	mov    -0x304(%rbp),%eax
+  802961:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  802968:	5b                   	pop    %rbx
+  802969:	41 5c                	pop    %r12
+  80296b:	41 5d                	pop    %r13
+  80296d:	41 5e                	pop    %r14
+  80296f:	41 5f                	pop    %r15
+  802971:	5d                   	pop    %rbp
+  802972:	c3                   	ret
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  802973:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802978:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80297d:	be 00 00 40 00       	mov    $0x400000,%esi
+  802982:	bf 00 00 00 00       	mov    $0x0,%edi
+  802987:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  80298e:	00 00 00 
+  802991:	ff d0                	call   *%rax
+  802993:	85 c0                	test   %eax,%eax
+  802995:	78 98                	js     80292f <spawn+0x65b>
+    for (argc = 0; argv[argc] != 0; argc++)
+  802997:	48 c7 85 e0 fc ff ff 	movq   $0x0,-0x320(%rbp)
+  80299e:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8029a2:	48 c7 85 e8 fc ff ff 	movq   $0x40fff8,-0x318(%rbp)
+  8029a9:	f8 ff 40 00 
+  8029ad:	48 c7 85 f0 fc ff ff 	movq   $0x410000,-0x310(%rbp)
+  8029b4:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8029b8:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  8029bd:	e9 1c fb ff ff       	jmp    8024de <spawn+0x20a>
+
+00000000008029c2 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  8029c2:	55                   	push   %rbp
+  8029c3:	48 89 e5             	mov    %rsp,%rbp
+  8029c6:	48 83 ec 50          	sub    $0x50,%rsp
+  8029ca:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8029ce:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8029d2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8029d6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  8029da:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8029e1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8029e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029e9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8029ed:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  8029f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  8029f6:	eb 15                	jmp    802a0d <spawnl+0x4b>
+  8029f8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8029fc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a04:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802a08:	74 1c                	je     802a26 <spawnl+0x64>
+  802a0a:	83 c1 01             	add    $0x1,%ecx
+  802a0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a10:	83 f8 2f             	cmp    $0x2f,%eax
+  802a13:	77 e3                	ja     8029f8 <spawnl+0x36>
+  802a15:	89 c2                	mov    %eax,%edx
+  802a17:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  802a1b:	4c 01 d2             	add    %r10,%rdx
+  802a1e:	83 c0 08             	add    $0x8,%eax
+  802a21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802a24:	eb de                	jmp    802a04 <spawnl+0x42>
+    const char *argv[argc + 2];
+  802a26:	8d 41 02             	lea    0x2(%rcx),%eax
+  802a29:	48 98                	cltq
+  802a2b:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  802a32:	00 
+  802a33:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  802a37:	48 29 c4             	sub    %rax,%rsp
+  802a3a:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  802a3f:	4c 89 c0             	mov    %r8,%rax
+  802a42:	48 c1 e8 03          	shr    $0x3,%rax
+  802a46:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  802a4a:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  802a51:	00 
+    argv[argc + 1] = NULL;
+  802a52:	8d 41 01             	lea    0x1(%rcx),%eax
+  802a55:	48 98                	cltq
+  802a57:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  802a5e:	00 
+    va_start(vl, arg0);
+  802a5f:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802a66:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802a6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a6e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802a72:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  802a76:	85 c9                	test   %ecx,%ecx
+  802a78:	74 41                	je     802abb <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802a7a:	49 89 c1             	mov    %rax,%r9
+  802a7d:	49 8d 40 08          	lea    0x8(%r8),%rax
+  802a81:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  802a84:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  802a89:	eb 1b                	jmp    802aa6 <spawnl+0xe4>
+  802a8b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802a8f:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  802a93:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  802a97:	48 8b 11             	mov    (%rcx),%rdx
+  802a9a:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  802a9d:	48 83 c0 08          	add    $0x8,%rax
+  802aa1:	48 39 f0             	cmp    %rsi,%rax
+  802aa4:	74 15                	je     802abb <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802aa6:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802aa9:	83 fa 2f             	cmp    $0x2f,%edx
+  802aac:	77 dd                	ja     802a8b <spawnl+0xc9>
+  802aae:	89 d1                	mov    %edx,%ecx
+  802ab0:	4c 01 c9             	add    %r9,%rcx
+  802ab3:	83 c2 08             	add    $0x8,%edx
+  802ab6:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  802ab9:	eb dc                	jmp    802a97 <spawnl+0xd5>
+    return spawn(prog, argv);
+  802abb:	4c 89 c6             	mov    %r8,%rsi
+  802abe:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  802ac5:	00 00 00 
+  802ac8:	ff d0                	call   *%rax
+}
+  802aca:	c9                   	leave
+  802acb:	c3                   	ret
+
+0000000000802acc <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802acc:	55                   	push   %rbp
+  802acd:	48 89 e5             	mov    %rsp,%rbp
+  802ad0:	41 54                	push   %r12
+  802ad2:	53                   	push   %rbx
+  802ad3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ad6:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  802add:	00 00 00 
+  802ae0:	ff d0                	call   *%rax
+  802ae2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802ae5:	48 be 38 3d 80 00 00 	movabs $0x803d38,%rsi
+  802aec:	00 00 00 
+  802aef:	48 89 df             	mov    %rbx,%rdi
+  802af2:	48 b8 2b 0d 80 00 00 	movabs $0x800d2b,%rax
+  802af9:	00 00 00 
+  802afc:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802afe:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802b03:	41 2b 04 24          	sub    (%r12),%eax
+  802b07:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802b0d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802b14:	00 00 00 
+    stat->st_dev = &devpipe;
+  802b17:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802b1e:	00 00 00 
+  802b21:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802b28:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b2d:	5b                   	pop    %rbx
+  802b2e:	41 5c                	pop    %r12
+  802b30:	5d                   	pop    %rbp
+  802b31:	c3                   	ret
+
+0000000000802b32 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802b32:	55                   	push   %rbp
+  802b33:	48 89 e5             	mov    %rsp,%rbp
+  802b36:	41 54                	push   %r12
+  802b38:	53                   	push   %rbx
+  802b39:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802b3c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b41:	48 89 fe             	mov    %rdi,%rsi
+  802b44:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b49:	49 bc a7 13 80 00 00 	movabs $0x8013a7,%r12
+  802b50:	00 00 00 
+  802b53:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802b56:	48 89 df             	mov    %rbx,%rdi
+  802b59:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  802b60:	00 00 00 
+  802b63:	ff d0                	call   *%rax
+  802b65:	48 89 c6             	mov    %rax,%rsi
+  802b68:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b72:	41 ff d4             	call   *%r12
+}
+  802b75:	5b                   	pop    %rbx
+  802b76:	41 5c                	pop    %r12
+  802b78:	5d                   	pop    %rbp
+  802b79:	c3                   	ret
+
+0000000000802b7a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802b7a:	55                   	push   %rbp
+  802b7b:	48 89 e5             	mov    %rsp,%rbp
+  802b7e:	41 57                	push   %r15
+  802b80:	41 56                	push   %r14
+  802b82:	41 55                	push   %r13
+  802b84:	41 54                	push   %r12
+  802b86:	53                   	push   %rbx
+  802b87:	48 83 ec 18          	sub    $0x18,%rsp
+  802b8b:	49 89 fc             	mov    %rdi,%r12
+  802b8e:	49 89 f5             	mov    %rsi,%r13
+  802b91:	49 89 d7             	mov    %rdx,%r15
+  802b94:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802b98:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  802b9f:	00 00 00 
+  802ba2:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802ba4:	4d 85 ff             	test   %r15,%r15
+  802ba7:	0f 84 af 00 00 00    	je     802c5c <devpipe_write+0xe2>
+  802bad:	48 89 c3             	mov    %rax,%rbx
+  802bb0:	4c 89 f8             	mov    %r15,%rax
+  802bb3:	4d 89 ef             	mov    %r13,%r15
+  802bb6:	4c 01 e8             	add    %r13,%rax
+  802bb9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802bbd:	49 bd af 12 80 00 00 	movabs $0x8012af,%r13
+  802bc4:	00 00 00 
+            sys_yield();
+  802bc7:	49 be 4c 12 80 00 00 	movabs $0x80124c,%r14
+  802bce:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802bd1:	8b 73 04             	mov    0x4(%rbx),%esi
+  802bd4:	48 63 ce             	movslq %esi,%rcx
+  802bd7:	48 63 03             	movslq (%rbx),%rax
+  802bda:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802be0:	48 39 c1             	cmp    %rax,%rcx
+  802be3:	72 2e                	jb     802c13 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802be5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802bea:	48 89 da             	mov    %rbx,%rdx
+  802bed:	be 00 10 00 00       	mov    $0x1000,%esi
+  802bf2:	4c 89 e7             	mov    %r12,%rdi
+  802bf5:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802bf8:	85 c0                	test   %eax,%eax
+  802bfa:	74 66                	je     802c62 <devpipe_write+0xe8>
+            sys_yield();
+  802bfc:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802bff:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c02:	48 63 ce             	movslq %esi,%rcx
+  802c05:	48 63 03             	movslq (%rbx),%rax
+  802c08:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802c0e:	48 39 c1             	cmp    %rax,%rcx
+  802c11:	73 d2                	jae    802be5 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802c13:	41 0f b6 3f          	movzbl (%r15),%edi
+  802c17:	48 89 ca             	mov    %rcx,%rdx
+  802c1a:	48 c1 ea 03          	shr    $0x3,%rdx
+  802c1e:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802c25:	08 10 20 
+  802c28:	48 f7 e2             	mul    %rdx
+  802c2b:	48 c1 ea 06          	shr    $0x6,%rdx
+  802c2f:	48 89 d0             	mov    %rdx,%rax
+  802c32:	48 c1 e0 09          	shl    $0x9,%rax
+  802c36:	48 29 d0             	sub    %rdx,%rax
+  802c39:	48 c1 e0 03          	shl    $0x3,%rax
+  802c3d:	48 29 c1             	sub    %rax,%rcx
+  802c40:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802c45:	83 c6 01             	add    $0x1,%esi
+  802c48:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802c4b:	49 83 c7 01          	add    $0x1,%r15
+  802c4f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c53:	49 39 c7             	cmp    %rax,%r15
+  802c56:	0f 85 75 ff ff ff    	jne    802bd1 <devpipe_write+0x57>
+    return n;
+  802c5c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c60:	eb 05                	jmp    802c67 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802c62:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c67:	48 83 c4 18          	add    $0x18,%rsp
+  802c6b:	5b                   	pop    %rbx
+  802c6c:	41 5c                	pop    %r12
+  802c6e:	41 5d                	pop    %r13
+  802c70:	41 5e                	pop    %r14
+  802c72:	41 5f                	pop    %r15
+  802c74:	5d                   	pop    %rbp
+  802c75:	c3                   	ret
+
+0000000000802c76 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802c76:	55                   	push   %rbp
+  802c77:	48 89 e5             	mov    %rsp,%rbp
+  802c7a:	41 57                	push   %r15
+  802c7c:	41 56                	push   %r14
+  802c7e:	41 55                	push   %r13
+  802c80:	41 54                	push   %r12
+  802c82:	53                   	push   %rbx
+  802c83:	48 83 ec 18          	sub    $0x18,%rsp
+  802c87:	49 89 fc             	mov    %rdi,%r12
+  802c8a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802c8e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802c92:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  802c99:	00 00 00 
+  802c9c:	ff d0                	call   *%rax
+  802c9e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802ca1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ca7:	49 bd af 12 80 00 00 	movabs $0x8012af,%r13
+  802cae:	00 00 00 
+            sys_yield();
+  802cb1:	49 be 4c 12 80 00 00 	movabs $0x80124c,%r14
+  802cb8:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802cbb:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802cc0:	74 7d                	je     802d3f <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802cc2:	8b 03                	mov    (%rbx),%eax
+  802cc4:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802cc7:	75 26                	jne    802cef <devpipe_read+0x79>
+            if (i > 0) return i;
+  802cc9:	4d 85 ff             	test   %r15,%r15
+  802ccc:	75 77                	jne    802d45 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802cce:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802cd3:	48 89 da             	mov    %rbx,%rdx
+  802cd6:	be 00 10 00 00       	mov    $0x1000,%esi
+  802cdb:	4c 89 e7             	mov    %r12,%rdi
+  802cde:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802ce1:	85 c0                	test   %eax,%eax
+  802ce3:	74 72                	je     802d57 <devpipe_read+0xe1>
+            sys_yield();
+  802ce5:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802ce8:	8b 03                	mov    (%rbx),%eax
+  802cea:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802ced:	74 df                	je     802cce <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802cef:	48 63 c8             	movslq %eax,%rcx
+  802cf2:	48 89 ca             	mov    %rcx,%rdx
+  802cf5:	48 c1 ea 03          	shr    $0x3,%rdx
+  802cf9:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802d00:	08 10 20 
+  802d03:	48 89 d0             	mov    %rdx,%rax
+  802d06:	48 f7 e6             	mul    %rsi
+  802d09:	48 c1 ea 06          	shr    $0x6,%rdx
+  802d0d:	48 89 d0             	mov    %rdx,%rax
+  802d10:	48 c1 e0 09          	shl    $0x9,%rax
+  802d14:	48 29 d0             	sub    %rdx,%rax
+  802d17:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802d1e:	00 
+  802d1f:	48 89 c8             	mov    %rcx,%rax
+  802d22:	48 29 d0             	sub    %rdx,%rax
+  802d25:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802d2a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802d2e:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802d32:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802d35:	49 83 c7 01          	add    $0x1,%r15
+  802d39:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802d3d:	75 83                	jne    802cc2 <devpipe_read+0x4c>
+    return n;
+  802d3f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d43:	eb 03                	jmp    802d48 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802d45:	4c 89 f8             	mov    %r15,%rax
+}
+  802d48:	48 83 c4 18          	add    $0x18,%rsp
+  802d4c:	5b                   	pop    %rbx
+  802d4d:	41 5c                	pop    %r12
+  802d4f:	41 5d                	pop    %r13
+  802d51:	41 5e                	pop    %r14
+  802d53:	41 5f                	pop    %r15
+  802d55:	5d                   	pop    %rbp
+  802d56:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802d57:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d5c:	eb ea                	jmp    802d48 <devpipe_read+0xd2>
+
+0000000000802d5e <pipe>:
+pipe(int pfd[2]) {
+  802d5e:	55                   	push   %rbp
+  802d5f:	48 89 e5             	mov    %rsp,%rbp
+  802d62:	41 55                	push   %r13
+  802d64:	41 54                	push   %r12
+  802d66:	53                   	push   %rbx
+  802d67:	48 83 ec 18          	sub    $0x18,%rsp
+  802d6b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802d6e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802d72:	48 b8 ab 18 80 00 00 	movabs $0x8018ab,%rax
+  802d79:	00 00 00 
+  802d7c:	ff d0                	call   *%rax
+  802d7e:	89 c3                	mov    %eax,%ebx
+  802d80:	85 c0                	test   %eax,%eax
+  802d82:	0f 88 a0 01 00 00    	js     802f28 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802d88:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802d8d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d92:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d96:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d9b:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  802da2:	00 00 00 
+  802da5:	ff d0                	call   *%rax
+  802da7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802da9:	85 c0                	test   %eax,%eax
+  802dab:	0f 88 77 01 00 00    	js     802f28 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802db1:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802db5:	48 b8 ab 18 80 00 00 	movabs $0x8018ab,%rax
+  802dbc:	00 00 00 
+  802dbf:	ff d0                	call   *%rax
+  802dc1:	89 c3                	mov    %eax,%ebx
+  802dc3:	85 c0                	test   %eax,%eax
+  802dc5:	0f 88 43 01 00 00    	js     802f0e <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802dcb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802dd0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802dd5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802dd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dde:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  802de5:	00 00 00 
+  802de8:	ff d0                	call   *%rax
+  802dea:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802dec:	85 c0                	test   %eax,%eax
+  802dee:	0f 88 1a 01 00 00    	js     802f0e <pipe+0x1b0>
+    va = fd2data(fd0);
+  802df4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802df8:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  802dff:	00 00 00 
+  802e02:	ff d0                	call   *%rax
+  802e04:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802e07:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e0c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e11:	48 89 c6             	mov    %rax,%rsi
+  802e14:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e19:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  802e20:	00 00 00 
+  802e23:	ff d0                	call   *%rax
+  802e25:	89 c3                	mov    %eax,%ebx
+  802e27:	85 c0                	test   %eax,%eax
+  802e29:	0f 88 c5 00 00 00    	js     802ef4 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802e2f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802e33:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  802e3a:	00 00 00 
+  802e3d:	ff d0                	call   *%rax
+  802e3f:	48 89 c1             	mov    %rax,%rcx
+  802e42:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802e48:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802e4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e53:	4c 89 ee             	mov    %r13,%rsi
+  802e56:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e5b:	48 b8 42 13 80 00 00 	movabs $0x801342,%rax
+  802e62:	00 00 00 
+  802e65:	ff d0                	call   *%rax
+  802e67:	89 c3                	mov    %eax,%ebx
+  802e69:	85 c0                	test   %eax,%eax
+  802e6b:	78 6e                	js     802edb <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802e6d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e72:	4c 89 ef             	mov    %r13,%rdi
+  802e75:	48 b8 7d 12 80 00 00 	movabs $0x80127d,%rax
+  802e7c:	00 00 00 
+  802e7f:	ff d0                	call   *%rax
+  802e81:	83 f8 02             	cmp    $0x2,%eax
+  802e84:	0f 85 ab 00 00 00    	jne    802f35 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802e8a:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802e91:	00 00 
+  802e93:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802e97:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802e99:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802e9d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802ea4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ea8:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802eaa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802eae:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802eb5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802eb9:	48 bb 7d 18 80 00 00 	movabs $0x80187d,%rbx
+  802ec0:	00 00 00 
+  802ec3:	ff d3                	call   *%rbx
+  802ec5:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802ec9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802ecd:	ff d3                	call   *%rbx
+  802ecf:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802ed4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ed9:	eb 4d                	jmp    802f28 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802edb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ee0:	4c 89 ee             	mov    %r13,%rsi
+  802ee3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ee8:	48 b8 a7 13 80 00 00 	movabs $0x8013a7,%rax
+  802eef:	00 00 00 
+  802ef2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802ef4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ef9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802efd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f02:	48 b8 a7 13 80 00 00 	movabs $0x8013a7,%rax
+  802f09:	00 00 00 
+  802f0c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802f0e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f13:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f17:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f1c:	48 b8 a7 13 80 00 00 	movabs $0x8013a7,%rax
+  802f23:	00 00 00 
+  802f26:	ff d0                	call   *%rax
+}
+  802f28:	89 d8                	mov    %ebx,%eax
+  802f2a:	48 83 c4 18          	add    $0x18,%rsp
+  802f2e:	5b                   	pop    %rbx
+  802f2f:	41 5c                	pop    %r12
+  802f31:	41 5d                	pop    %r13
+  802f33:	5d                   	pop    %rbp
+  802f34:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802f35:	48 b9 50 3d 80 00 00 	movabs $0x803d50,%rcx
+  802f3c:	00 00 00 
+  802f3f:	48 ba ba 3c 80 00 00 	movabs $0x803cba,%rdx
+  802f46:	00 00 00 
+  802f49:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802f4e:	48 bf 3f 3d 80 00 00 	movabs $0x803d3f,%rdi
+  802f55:	00 00 00 
+  802f58:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f5d:	49 b8 b6 02 80 00 00 	movabs $0x8002b6,%r8
+  802f64:	00 00 00 
+  802f67:	41 ff d0             	call   *%r8
+
+0000000000802f6a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802f6a:	55                   	push   %rbp
+  802f6b:	48 89 e5             	mov    %rsp,%rbp
+  802f6e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802f72:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f76:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  802f7d:	00 00 00 
+  802f80:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f82:	85 c0                	test   %eax,%eax
+  802f84:	78 35                	js     802fbb <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802f86:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f8a:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  802f91:	00 00 00 
+  802f94:	ff d0                	call   *%rax
+  802f96:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802f99:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802f9e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802fa3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fa7:	48 b8 af 12 80 00 00 	movabs $0x8012af,%rax
+  802fae:	00 00 00 
+  802fb1:	ff d0                	call   *%rax
+  802fb3:	85 c0                	test   %eax,%eax
+  802fb5:	0f 94 c0             	sete   %al
+  802fb8:	0f b6 c0             	movzbl %al,%eax
+}
+  802fbb:	c9                   	leave
+  802fbc:	c3                   	ret
+
+0000000000802fbd <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802fbd:	48 89 f8             	mov    %rdi,%rax
+  802fc0:	48 c1 e8 27          	shr    $0x27,%rax
+  802fc4:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802fcb:	01 00 00 
+  802fce:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802fd2:	f6 c2 01             	test   $0x1,%dl
+  802fd5:	74 6d                	je     803044 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802fd7:	48 89 f8             	mov    %rdi,%rax
+  802fda:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802fde:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802fe5:	01 00 00 
+  802fe8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802fec:	f6 c2 01             	test   $0x1,%dl
+  802fef:	74 62                	je     803053 <get_uvpt_entry+0x96>
+  802ff1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802ff8:	01 00 00 
+  802ffb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802fff:	f6 c2 80             	test   $0x80,%dl
+  803002:	75 4f                	jne    803053 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803004:	48 89 f8             	mov    %rdi,%rax
+  803007:	48 c1 e8 15          	shr    $0x15,%rax
+  80300b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803012:	01 00 00 
+  803015:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803019:	f6 c2 01             	test   $0x1,%dl
+  80301c:	74 44                	je     803062 <get_uvpt_entry+0xa5>
+  80301e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803025:	01 00 00 
+  803028:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80302c:	f6 c2 80             	test   $0x80,%dl
+  80302f:	75 31                	jne    803062 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803031:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803035:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80303c:	01 00 00 
+  80303f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803043:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803044:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80304b:	01 00 00 
+  80304e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803052:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803053:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80305a:	01 00 00 
+  80305d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803061:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803062:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803069:	01 00 00 
+  80306c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803070:	c3                   	ret
+
+0000000000803071 <get_prot>:
+
+int
+get_prot(void *va) {
+  803071:	55                   	push   %rbp
+  803072:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803075:	48 b8 bd 2f 80 00 00 	movabs $0x802fbd,%rax
+  80307c:	00 00 00 
+  80307f:	ff d0                	call   *%rax
+  803081:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803084:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803089:	89 c1                	mov    %eax,%ecx
+  80308b:	83 c9 04             	or     $0x4,%ecx
+  80308e:	f6 c2 01             	test   $0x1,%dl
+  803091:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803094:	89 c1                	mov    %eax,%ecx
+  803096:	83 c9 02             	or     $0x2,%ecx
+  803099:	f6 c2 02             	test   $0x2,%dl
+  80309c:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80309f:	89 c1                	mov    %eax,%ecx
+  8030a1:	83 c9 01             	or     $0x1,%ecx
+  8030a4:	48 85 d2             	test   %rdx,%rdx
+  8030a7:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8030aa:	89 c1                	mov    %eax,%ecx
+  8030ac:	83 c9 40             	or     $0x40,%ecx
+  8030af:	f6 c6 04             	test   $0x4,%dh
+  8030b2:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8030b5:	5d                   	pop    %rbp
+  8030b6:	c3                   	ret
+
+00000000008030b7 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8030b7:	55                   	push   %rbp
+  8030b8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8030bb:	48 b8 bd 2f 80 00 00 	movabs $0x802fbd,%rax
+  8030c2:	00 00 00 
+  8030c5:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8030c7:	48 c1 e8 06          	shr    $0x6,%rax
+  8030cb:	83 e0 01             	and    $0x1,%eax
+}
+  8030ce:	5d                   	pop    %rbp
+  8030cf:	c3                   	ret
+
+00000000008030d0 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8030d0:	55                   	push   %rbp
+  8030d1:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8030d4:	48 b8 bd 2f 80 00 00 	movabs $0x802fbd,%rax
+  8030db:	00 00 00 
+  8030de:	ff d0                	call   *%rax
+  8030e0:	83 e0 01             	and    $0x1,%eax
+}
+  8030e3:	5d                   	pop    %rbp
+  8030e4:	c3                   	ret
+
+00000000008030e5 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8030e5:	55                   	push   %rbp
+  8030e6:	48 89 e5             	mov    %rsp,%rbp
+  8030e9:	41 57                	push   %r15
+  8030eb:	41 56                	push   %r14
+  8030ed:	41 55                	push   %r13
+  8030ef:	41 54                	push   %r12
+  8030f1:	53                   	push   %rbx
+  8030f2:	48 83 ec 18          	sub    $0x18,%rsp
+  8030f6:	49 89 ff             	mov    %rdi,%r15
+  8030f9:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8030fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  803102:	49 bc d0 30 80 00 00 	movabs $0x8030d0,%r12
+  803109:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  80310c:	49 be 71 30 80 00 00 	movabs $0x803071,%r14
+  803113:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  803116:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  80311d:	00 00 00 
+  803120:	eb 0c                	jmp    80312e <foreach_shared_region+0x49>
+  803122:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803129:	4c 39 eb             	cmp    %r13,%rbx
+  80312c:	74 38                	je     803166 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  80312e:	48 89 df             	mov    %rbx,%rdi
+  803131:	41 ff d4             	call   *%r12
+  803134:	84 c0                	test   %al,%al
+  803136:	74 ea                	je     803122 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  803138:	48 89 df             	mov    %rbx,%rdi
+  80313b:	41 ff d6             	call   *%r14
+  80313e:	a8 40                	test   $0x40,%al
+  803140:	74 e0                	je     803122 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  803142:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803149:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80314d:	48 89 df             	mov    %rbx,%rdi
+  803150:	41 ff d7             	call   *%r15
+        if (err)
+  803153:	85 c0                	test   %eax,%eax
+  803155:	74 cb                	je     803122 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  803157:	48 83 c4 18          	add    $0x18,%rsp
+  80315b:	5b                   	pop    %rbx
+  80315c:	41 5c                	pop    %r12
+  80315e:	41 5d                	pop    %r13
+  803160:	41 5e                	pop    %r14
+  803162:	41 5f                	pop    %r15
+  803164:	5d                   	pop    %rbp
+  803165:	c3                   	ret
+    return 0;
+  803166:	b8 00 00 00 00       	mov    $0x0,%eax
+  80316b:	eb ea                	jmp    803157 <foreach_shared_region+0x72>
+
+000000000080316d <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80316d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803172:	c3                   	ret
+
+0000000000803173 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803173:	55                   	push   %rbp
+  803174:	48 89 e5             	mov    %rsp,%rbp
+  803177:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80317a:	48 be 74 3d 80 00 00 	movabs $0x803d74,%rsi
+  803181:	00 00 00 
+  803184:	48 b8 2b 0d 80 00 00 	movabs $0x800d2b,%rax
+  80318b:	00 00 00 
+  80318e:	ff d0                	call   *%rax
+    return 0;
+}
+  803190:	b8 00 00 00 00       	mov    $0x0,%eax
+  803195:	5d                   	pop    %rbp
+  803196:	c3                   	ret
+
+0000000000803197 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803197:	55                   	push   %rbp
+  803198:	48 89 e5             	mov    %rsp,%rbp
+  80319b:	41 57                	push   %r15
+  80319d:	41 56                	push   %r14
+  80319f:	41 55                	push   %r13
+  8031a1:	41 54                	push   %r12
+  8031a3:	53                   	push   %rbx
+  8031a4:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8031ab:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8031b2:	48 85 d2             	test   %rdx,%rdx
+  8031b5:	74 7a                	je     803231 <devcons_write+0x9a>
+  8031b7:	49 89 d6             	mov    %rdx,%r14
+  8031ba:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8031c0:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8031c5:	49 bf 25 0f 80 00 00 	movabs $0x800f25,%r15
+  8031cc:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8031cf:	4c 89 f3             	mov    %r14,%rbx
+  8031d2:	48 29 f3             	sub    %rsi,%rbx
+  8031d5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8031da:	48 39 c3             	cmp    %rax,%rbx
+  8031dd:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8031e1:	4c 63 eb             	movslq %ebx,%r13
+  8031e4:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8031eb:	48 01 c6             	add    %rax,%rsi
+  8031ee:	4c 89 ea             	mov    %r13,%rdx
+  8031f1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031f8:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8031fb:	4c 89 ee             	mov    %r13,%rsi
+  8031fe:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803205:	48 b8 52 11 80 00 00 	movabs $0x801152,%rax
+  80320c:	00 00 00 
+  80320f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803211:	41 01 dc             	add    %ebx,%r12d
+  803214:	49 63 f4             	movslq %r12d,%rsi
+  803217:	4c 39 f6             	cmp    %r14,%rsi
+  80321a:	72 b3                	jb     8031cf <devcons_write+0x38>
+    return res;
+  80321c:	49 63 c4             	movslq %r12d,%rax
+}
+  80321f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803226:	5b                   	pop    %rbx
+  803227:	41 5c                	pop    %r12
+  803229:	41 5d                	pop    %r13
+  80322b:	41 5e                	pop    %r14
+  80322d:	41 5f                	pop    %r15
+  80322f:	5d                   	pop    %rbp
+  803230:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803231:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803237:	eb e3                	jmp    80321c <devcons_write+0x85>
+
+0000000000803239 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803239:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80323c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803241:	48 85 c0             	test   %rax,%rax
+  803244:	74 55                	je     80329b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803246:	55                   	push   %rbp
+  803247:	48 89 e5             	mov    %rsp,%rbp
+  80324a:	41 55                	push   %r13
+  80324c:	41 54                	push   %r12
+  80324e:	53                   	push   %rbx
+  80324f:	48 83 ec 08          	sub    $0x8,%rsp
+  803253:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803256:	48 bb 7f 11 80 00 00 	movabs $0x80117f,%rbx
+  80325d:	00 00 00 
+  803260:	49 bc 4c 12 80 00 00 	movabs $0x80124c,%r12
+  803267:	00 00 00 
+  80326a:	eb 03                	jmp    80326f <devcons_read+0x36>
+  80326c:	41 ff d4             	call   *%r12
+  80326f:	ff d3                	call   *%rbx
+  803271:	85 c0                	test   %eax,%eax
+  803273:	74 f7                	je     80326c <devcons_read+0x33>
+    if (c < 0) return c;
+  803275:	48 63 d0             	movslq %eax,%rdx
+  803278:	78 13                	js     80328d <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80327a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80327f:	83 f8 04             	cmp    $0x4,%eax
+  803282:	74 09                	je     80328d <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803284:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803288:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80328d:	48 89 d0             	mov    %rdx,%rax
+  803290:	48 83 c4 08          	add    $0x8,%rsp
+  803294:	5b                   	pop    %rbx
+  803295:	41 5c                	pop    %r12
+  803297:	41 5d                	pop    %r13
+  803299:	5d                   	pop    %rbp
+  80329a:	c3                   	ret
+  80329b:	48 89 d0             	mov    %rdx,%rax
+  80329e:	c3                   	ret
+
+000000000080329f <cputchar>:
+cputchar(int ch) {
+  80329f:	55                   	push   %rbp
+  8032a0:	48 89 e5             	mov    %rsp,%rbp
+  8032a3:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8032a7:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8032ab:	be 01 00 00 00       	mov    $0x1,%esi
+  8032b0:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8032b4:	48 b8 52 11 80 00 00 	movabs $0x801152,%rax
+  8032bb:	00 00 00 
+  8032be:	ff d0                	call   *%rax
+}
+  8032c0:	c9                   	leave
+  8032c1:	c3                   	ret
+
+00000000008032c2 <getchar>:
+getchar(void) {
+  8032c2:	55                   	push   %rbp
+  8032c3:	48 89 e5             	mov    %rsp,%rbp
+  8032c6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8032ca:	ba 01 00 00 00       	mov    $0x1,%edx
+  8032cf:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8032d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032d8:	48 b8 ee 1b 80 00 00 	movabs $0x801bee,%rax
+  8032df:	00 00 00 
+  8032e2:	ff d0                	call   *%rax
+  8032e4:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8032e6:	85 c0                	test   %eax,%eax
+  8032e8:	78 06                	js     8032f0 <getchar+0x2e>
+  8032ea:	74 08                	je     8032f4 <getchar+0x32>
+  8032ec:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8032f0:	89 d0                	mov    %edx,%eax
+  8032f2:	c9                   	leave
+  8032f3:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8032f4:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8032f9:	eb f5                	jmp    8032f0 <getchar+0x2e>
+
+00000000008032fb <iscons>:
+iscons(int fdnum) {
+  8032fb:	55                   	push   %rbp
+  8032fc:	48 89 e5             	mov    %rsp,%rbp
+  8032ff:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803303:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803307:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  80330e:	00 00 00 
+  803311:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803313:	85 c0                	test   %eax,%eax
+  803315:	78 18                	js     80332f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803317:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80331b:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  803322:	00 00 00 
+  803325:	8b 00                	mov    (%rax),%eax
+  803327:	39 02                	cmp    %eax,(%rdx)
+  803329:	0f 94 c0             	sete   %al
+  80332c:	0f b6 c0             	movzbl %al,%eax
+}
+  80332f:	c9                   	leave
+  803330:	c3                   	ret
+
+0000000000803331 <opencons>:
+opencons(void) {
+  803331:	55                   	push   %rbp
+  803332:	48 89 e5             	mov    %rsp,%rbp
+  803335:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803339:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80333d:	48 b8 ab 18 80 00 00 	movabs $0x8018ab,%rax
+  803344:	00 00 00 
+  803347:	ff d0                	call   *%rax
+  803349:	85 c0                	test   %eax,%eax
+  80334b:	78 49                	js     803396 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80334d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803352:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803357:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80335b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803360:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  803367:	00 00 00 
+  80336a:	ff d0                	call   *%rax
+  80336c:	85 c0                	test   %eax,%eax
+  80336e:	78 26                	js     803396 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803370:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803374:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  80337b:	00 00 
+  80337d:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80337f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803383:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80338a:	48 b8 7d 18 80 00 00 	movabs $0x80187d,%rax
+  803391:	00 00 00 
+  803394:	ff d0                	call   *%rax
+}
+  803396:	c9                   	leave
+  803397:	c3                   	ret
+
+0000000000803398 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803398:	55                   	push   %rbp
+  803399:	48 89 e5             	mov    %rsp,%rbp
+  80339c:	41 54                	push   %r12
+  80339e:	53                   	push   %rbx
+  80339f:	48 89 fb             	mov    %rdi,%rbx
+  8033a2:	48 89 f7             	mov    %rsi,%rdi
+  8033a5:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8033a8:	48 85 f6             	test   %rsi,%rsi
+  8033ab:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8033b2:	00 00 00 
+  8033b5:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8033b9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8033be:	48 b8 45 16 80 00 00 	movabs $0x801645,%rax
+  8033c5:	00 00 00 
+  8033c8:	ff d0                	call   *%rax
+    if (res < 0) {
+  8033ca:	85 c0                	test   %eax,%eax
+  8033cc:	78 45                	js     803413 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8033ce:	48 85 db             	test   %rbx,%rbx
+  8033d1:	74 12                	je     8033e5 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8033d3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8033da:	00 00 00 
+  8033dd:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8033e3:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  8033e5:	4d 85 e4             	test   %r12,%r12
+  8033e8:	74 14                	je     8033fe <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  8033ea:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8033f1:	00 00 00 
+  8033f4:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8033fa:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  8033fe:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803405:	00 00 00 
+  803408:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  80340e:	5b                   	pop    %rbx
+  80340f:	41 5c                	pop    %r12
+  803411:	5d                   	pop    %rbp
+  803412:	c3                   	ret
+        if (from_env_store)
+  803413:	48 85 db             	test   %rbx,%rbx
+  803416:	74 06                	je     80341e <ipc_recv+0x86>
+            *from_env_store = 0;
+  803418:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  80341e:	4d 85 e4             	test   %r12,%r12
+  803421:	74 eb                	je     80340e <ipc_recv+0x76>
+            *perm_store = 0;
+  803423:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80342a:	00 
+  80342b:	eb e1                	jmp    80340e <ipc_recv+0x76>
+
+000000000080342d <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80342d:	55                   	push   %rbp
+  80342e:	48 89 e5             	mov    %rsp,%rbp
+  803431:	41 57                	push   %r15
+  803433:	41 56                	push   %r14
+  803435:	41 55                	push   %r13
+  803437:	41 54                	push   %r12
+  803439:	53                   	push   %rbx
+  80343a:	48 83 ec 18          	sub    $0x18,%rsp
+  80343e:	41 89 fd             	mov    %edi,%r13d
+  803441:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803444:	48 89 d3             	mov    %rdx,%rbx
+  803447:	49 89 cc             	mov    %rcx,%r12
+  80344a:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  80344e:	48 85 d2             	test   %rdx,%rdx
+  803451:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803458:	00 00 00 
+  80345b:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80345f:	49 be 19 16 80 00 00 	movabs $0x801619,%r14
+  803466:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  803469:	49 bf 4c 12 80 00 00 	movabs $0x80124c,%r15
+  803470:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803473:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803476:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  80347a:	4c 89 e1             	mov    %r12,%rcx
+  80347d:	48 89 da             	mov    %rbx,%rdx
+  803480:	44 89 ef             	mov    %r13d,%edi
+  803483:	41 ff d6             	call   *%r14
+        if (res == 0)
+  803486:	85 c0                	test   %eax,%eax
+  803488:	74 34                	je     8034be <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  80348a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80348d:	75 05                	jne    803494 <ipc_send+0x67>
+        sys_yield();
+  80348f:	41 ff d7             	call   *%r15
+    while (true) {
+  803492:	eb df                	jmp    803473 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  803494:	48 ba 80 3d 80 00 00 	movabs $0x803d80,%rdx
+  80349b:	00 00 00 
+  80349e:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8034a3:	48 bf 99 3d 80 00 00 	movabs $0x803d99,%rdi
+  8034aa:	00 00 00 
+  8034ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b2:	48 b9 b6 02 80 00 00 	movabs $0x8002b6,%rcx
+  8034b9:	00 00 00 
+  8034bc:	ff d1                	call   *%rcx
+    }
+}
+  8034be:	48 83 c4 18          	add    $0x18,%rsp
+  8034c2:	5b                   	pop    %rbx
+  8034c3:	41 5c                	pop    %r12
+  8034c5:	41 5d                	pop    %r13
+  8034c7:	41 5e                	pop    %r14
+  8034c9:	41 5f                	pop    %r15
+  8034cb:	5d                   	pop    %rbp
+  8034cc:	c3                   	ret
+
+00000000008034cd <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8034cd:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8034d2:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8034d9:	00 00 00 
+  8034dc:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  8034e3:	48 01 ca             	add    %rcx,%rdx
+  8034e6:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8034ec:	39 fa                	cmp    %edi,%edx
+  8034ee:	74 12                	je     803502 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8034f0:	48 83 c0 01          	add    $0x1,%rax
+  8034f4:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8034fa:	75 e0                	jne    8034dc <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8034fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803501:	c3                   	ret
+            return envs[i].env_id;
+  803502:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  803509:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803510:	00 00 00 
+  803513:	48 01 d0             	add    %rdx,%rax
+  803516:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80351c:	c3                   	ret
+  80351d:	0f 1f 00             	nopl   (%rax)
+
+0000000000803520 <__rodata_start>:
+  803520:	69 63 6f 64 65 00 69 	imul   $0x69006564,0x6f(%rbx),%esp
+  803527:	63 6f 64             	movsxd 0x64(%rdi),%ebp
+  80352a:	65 20 73 74          	and    %dh,%gs:0x74(%rbx)
+  80352e:	61                   	(bad)
+  80352f:	72 74                	jb     8035a5 <__rodata_start+0x85>
+  803531:	75 70                	jne    8035a3 <__rodata_start+0x83>
+  803533:	0a 00                	or     (%rax),%al
+  803535:	69 63 6f 64 65 3a 20 	imul   $0x203a6564,0x6f(%rbx),%esp
+  80353c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80353d:	70 65                	jo     8035a4 <__rodata_start+0x84>
+  80353f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803540:	20 2f                	and    %ch,(%rdi)
+  803542:	6d                   	insl   (%dx),%es:(%rdi)
+  803543:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803544:	74 64                	je     8035aa <__rodata_start+0x8a>
+  803546:	0a 00                	or     (%rax),%al
+  803548:	2f                   	(bad)
+  803549:	6d                   	insl   (%dx),%es:(%rdi)
+  80354a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80354b:	74 64                	je     8035b1 <__rodata_start+0x91>
+  80354d:	00 69 63             	add    %ch,0x63(%rcx)
+  803550:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803551:	64 65 3a 20          	fs cmp %gs:(%rax),%ah
+  803555:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803556:	70 65                	jo     8035bd <__rodata_start+0x9d>
+  803558:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803559:	20 2f                	and    %ch,(%rdi)
+  80355b:	6d                   	insl   (%dx),%es:(%rdi)
+  80355c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80355d:	74 64                	je     8035c3 <__rodata_start+0xa3>
+  80355f:	3a 20                	cmp    (%rax),%ah
+  803561:	25 69 00 75 73       	and    $0x73750069,%eax
+  803566:	65 72 2f             	gs jb  803598 <__rodata_start+0x78>
+  803569:	69 63 6f 64 65 2e 63 	imul   $0x632e6564,0x6f(%rbx),%esp
+  803570:	00 69 63             	add    %ch,0x63(%rcx)
+  803573:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803574:	64 65 3a 20          	fs cmp %gs:(%rax),%ah
+  803578:	72 65                	jb     8035df <__rodata_start+0xbf>
+  80357a:	61                   	(bad)
+  80357b:	64 20 2f             	and    %ch,%fs:(%rdi)
+  80357e:	6d                   	insl   (%dx),%es:(%rdi)
+  80357f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803580:	74 64                	je     8035e6 <__rodata_start+0xc6>
+  803582:	0a 00                	or     (%rax),%al
+  803584:	69 63 6f 64 65 3a 20 	imul   $0x203a6564,0x6f(%rbx),%esp
+  80358b:	63 6c 6f 73          	movsxd 0x73(%rdi,%rbp,2),%ebp
+  80358f:	65 20 2f             	and    %ch,%gs:(%rdi)
+  803592:	6d                   	insl   (%dx),%es:(%rdi)
+  803593:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803594:	74 64                	je     8035fa <__rodata_start+0xda>
+  803596:	0a 00                	or     (%rax),%al
+  803598:	69 63 6f 64 65 3a 20 	imul   $0x203a6564,0x6f(%rbx),%esp
+  80359f:	73 70                	jae    803611 <__rodata_start+0xf1>
+  8035a1:	61                   	(bad)
+  8035a2:	77 6e                	ja     803612 <__rodata_start+0xf2>
+  8035a4:	20 2f                	and    %ch,(%rdi)
+  8035a6:	69 6e 69 74 0a 00 69 	imul   $0x69000a74,0x69(%rsi),%ebp
+  8035ad:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035ae:	69 74 61 72 67 32 00 	imul   $0x69003267,0x72(%rcx,%riz,2),%esi
+  8035b5:	69 
+  8035b6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035b7:	69 74 61 72 67 31 00 	imul   $0x2f003167,0x72(%rcx,%riz,2),%esi
+  8035be:	2f 
+  8035bf:	69 6e 69 74 00 69 63 	imul   $0x63690074,0x69(%rsi),%ebp
+  8035c6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035c7:	64 65 3a 20          	fs cmp %gs:(%rax),%ah
+  8035cb:	73 70                	jae    80363d <__rodata_start+0x11d>
+  8035cd:	61                   	(bad)
+  8035ce:	77 6e                	ja     80363e <__rodata_start+0x11e>
+  8035d0:	20 2f                	and    %ch,(%rdi)
+  8035d2:	69 6e 69 74 3a 20 25 	imul   $0x25203a74,0x69(%rsi),%ebp
+  8035d9:	69 00 69 63 6f 64    	imul   $0x646f6369,(%rax),%eax
+  8035df:	65 3a 20             	cmp    %gs:(%rax),%ah
+  8035e2:	65 78 69             	gs js  80364e <__rodata_start+0x12e>
+  8035e5:	74 69                	je     803650 <__rodata_start+0x130>
+  8035e7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035e8:	67 0a 00             	or     (%eax),%al
+  8035eb:	3c 75                	cmp    $0x75,%al
+  8035ed:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035ee:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8035f2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035f3:	3e 00 0f             	ds add %cl,(%rdi)
+  8035f6:	1f                   	(bad)
+  8035f7:	00 5b 25             	add    %bl,0x25(%rbx)
+  8035fa:	30 38                	xor    %bh,(%rax)
+  8035fc:	78 5d                	js     80365b <__rodata_start+0x13b>
+  8035fe:	20 75 73             	and    %dh,0x73(%rbp)
+  803601:	65 72 20             	gs jb  803624 <__rodata_start+0x104>
+  803604:	70 61                	jo     803667 <__rodata_start+0x147>
+  803606:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803607:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80360e:	73 20                	jae    803630 <__rodata_start+0x110>
+  803610:	61                   	(bad)
+  803611:	74 20                	je     803633 <__rodata_start+0x113>
+  803613:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803618:	3a 20                	cmp    (%rax),%ah
+  80361a:	00 30                	add    %dh,(%rax)
+  80361c:	31 32                	xor    %esi,(%rdx)
+  80361e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803625:	41                   	rex.B
+  803626:	42                   	rex.X
+  803627:	43                   	rex.XB
+  803628:	44                   	rex.R
+  803629:	45                   	rex.RB
+  80362a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80362d:	31 32                	xor    %esi,(%rdx)
+  80362f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803636:	61                   	(bad)
+  803637:	62 63 64 65 66       	(bad)
+  80363c:	00 28                	add    %ch,(%rax)
+  80363e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80363f:	75 6c                	jne    8036ad <__rodata_start+0x18d>
+  803641:	6c                   	insb   (%dx),%es:(%rdi)
+  803642:	29 00                	sub    %eax,(%rax)
+  803644:	65 72 72             	gs jb  8036b9 <__rodata_start+0x199>
+  803647:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803648:	72 20                	jb     80366a <__rodata_start+0x14a>
+  80364a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80364f:	73 70                	jae    8036c1 <__rodata_start+0x1a1>
+  803651:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803655:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80365c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80365d:	72 00                	jb     80365f <__rodata_start+0x13f>
+  80365f:	62 61 64 20 65       	(bad)
+  803664:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803665:	76 69                	jbe    8036d0 <__rodata_start+0x1b0>
+  803667:	72 6f                	jb     8036d8 <__rodata_start+0x1b8>
+  803669:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80366a:	6d                   	insl   (%dx),%es:(%rdi)
+  80366b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80366d:	74 00                	je     80366f <__rodata_start+0x14f>
+  80366f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803676:	20 70 61             	and    %dh,0x61(%rax)
+  803679:	72 61                	jb     8036dc <__rodata_start+0x1bc>
+  80367b:	6d                   	insl   (%dx),%es:(%rdi)
+  80367c:	65 74 65             	gs je  8036e4 <__rodata_start+0x1c4>
+  80367f:	72 00                	jb     803681 <__rodata_start+0x161>
+  803681:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803682:	75 74                	jne    8036f8 <__rodata_start+0x1d8>
+  803684:	20 6f 66             	and    %ch,0x66(%rdi)
+  803687:	20 6d 65             	and    %ch,0x65(%rbp)
+  80368a:	6d                   	insl   (%dx),%es:(%rdi)
+  80368b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80368c:	72 79                	jb     803707 <__rodata_start+0x1e7>
+  80368e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803691:	74 20                	je     8036b3 <__rodata_start+0x193>
+  803693:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803694:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803698:	76 69                	jbe    803703 <__rodata_start+0x1e3>
+  80369a:	72 6f                	jb     80370b <__rodata_start+0x1eb>
+  80369c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80369d:	6d                   	insl   (%dx),%es:(%rdi)
+  80369e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8036a0:	74 73                	je     803715 <__rodata_start+0x1f5>
+  8036a2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8036a5:	72 72                	jb     803719 <__rodata_start+0x1f9>
+  8036a7:	75 70                	jne    803719 <__rodata_start+0x1f9>
+  8036a9:	74 65                	je     803710 <__rodata_start+0x1f0>
+  8036ab:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8036b0:	75 67                	jne    803719 <__rodata_start+0x1f9>
+  8036b2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8036b5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8036b7:	00 73 65             	add    %dh,0x65(%rbx)
+  8036ba:	67 6d                	insl   (%dx),%es:(%edi)
+  8036bc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8036be:	74 61                	je     803721 <__rodata_start+0x201>
+  8036c0:	74 69                	je     80372b <__rodata_start+0x20b>
+  8036c2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036c3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036c4:	20 66 61             	and    %ah,0x61(%rsi)
+  8036c7:	75 6c                	jne    803735 <__rodata_start+0x215>
+  8036c9:	74 00                	je     8036cb <__rodata_start+0x1ab>
+  8036cb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8036d2:	20 45 4c             	and    %al,0x4c(%rbp)
+  8036d5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8036d9:	61                   	(bad)
+  8036da:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8036df:	20 73 75             	and    %dh,0x75(%rbx)
+  8036e2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8036e5:	73 79                	jae    803760 <__rodata_start+0x240>
+  8036e7:	73 74                	jae    80375d <__rodata_start+0x23d>
+  8036e9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8036eb:	20 63 61             	and    %ah,0x61(%rbx)
+  8036ee:	6c                   	insb   (%dx),%es:(%rdi)
+  8036ef:	6c                   	insb   (%dx),%es:(%rdi)
+  8036f0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8036f3:	74 72                	je     803767 <__rodata_start+0x247>
+  8036f5:	79 20                	jns    803717 <__rodata_start+0x1f7>
+  8036f7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036f8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036f9:	74 20                	je     80371b <__rodata_start+0x1fb>
+  8036fb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8036fd:	75 6e                	jne    80376d <__rodata_start+0x24d>
+  8036ff:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803703:	76 20                	jbe    803725 <__rodata_start+0x205>
+  803705:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80370c:	72 65                	jb     803773 <__rodata_start+0x253>
+  80370e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803711:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803712:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803716:	65 78 70             	gs js  803789 <__rodata_start+0x269>
+  803719:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80371e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803721:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803725:	20 66 69             	and    %ah,0x69(%rsi)
+  803728:	6c                   	insb   (%dx),%es:(%rdi)
+  803729:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80372d:	20 66 72             	and    %ah,0x72(%rsi)
+  803730:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803735:	61                   	(bad)
+  803736:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803739:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80373a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80373b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80373f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803742:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803743:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803744:	20 6d 61             	and    %ch,0x61(%rbp)
+  803747:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803748:	79 20                	jns    80376a <__rodata_start+0x24a>
+  80374a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803751:	72 65                	jb     8037b8 <__rodata_start+0x298>
+  803753:	20 6f 70             	and    %ch,0x70(%rdi)
+  803756:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803758:	00 66 69             	add    %ah,0x69(%rsi)
+  80375b:	6c                   	insb   (%dx),%es:(%rdi)
+  80375c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803760:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803763:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803764:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803767:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803768:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803769:	74 20                	je     80378b <__rodata_start+0x26b>
+  80376b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80376d:	75 6e                	jne    8037dd <__rodata_start+0x2bd>
+  80376f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803773:	76 61                	jbe    8037d6 <__rodata_start+0x2b6>
+  803775:	6c                   	insb   (%dx),%es:(%rdi)
+  803776:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80377d:	00 
+  80377e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803785:	72 65                	jb     8037ec <__rodata_start+0x2cc>
+  803787:	61                   	(bad)
+  803788:	64 79 20             	fs jns 8037ab <__rodata_start+0x28b>
+  80378b:	65 78 69             	gs js  8037f7 <__rodata_start+0x2d7>
+  80378e:	73 74                	jae    803804 <__rodata_start+0x2e4>
+  803790:	73 00                	jae    803792 <__rodata_start+0x272>
+  803792:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803793:	70 65                	jo     8037fa <__rodata_start+0x2da>
+  803795:	72 61                	jb     8037f8 <__rodata_start+0x2d8>
+  803797:	74 69                	je     803802 <__rodata_start+0x2e2>
+  803799:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80379a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80379b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80379e:	74 20                	je     8037c0 <__rodata_start+0x2a0>
+  8037a0:	73 75                	jae    803817 <__rodata_start+0x2f7>
+  8037a2:	70 70                	jo     803814 <__rodata_start+0x2f4>
+  8037a4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037a5:	72 74                	jb     80381b <__rodata_start+0x2fb>
+  8037a7:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8037ac:	65 72 61             	gs jb  803810 <__rodata_start+0x2f0>
+  8037af:	74 69                	je     80381a <__rodata_start+0x2fa>
+  8037b1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037b2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037b3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8037b6:	74 20                	je     8037d8 <__rodata_start+0x2b8>
+  8037b8:	70 65                	jo     80381f <__rodata_start+0x2ff>
+  8037ba:	72 6d                	jb     803829 <__rodata_start+0x309>
+  8037bc:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  8037c3:	2e 
+  8037c4:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8037cb:	00 
+  8037cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8037d3:	00 00 00 
+  8037d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8037dd:	00 00 00 
+  8037e0:	f3 05 80 00 00 00    	repz add $0x80,%eax
+  8037e6:	00 00                	add    %al,(%rax)
+  8037e8:	34 0c                	xor    $0xc,%al
+  8037ea:	80 00 00             	addb   $0x0,(%rax)
+  8037ed:	00 00                	add    %al,(%rax)
+  8037ef:	00 24 0c             	add    %ah,(%rsp,%rcx,1)
+  8037f2:	80 00 00             	addb   $0x0,(%rax)
+  8037f5:	00 00                	add    %al,(%rax)
+  8037f7:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8037fa:	80 00 00             	addb   $0x0,(%rax)
+  8037fd:	00 00                	add    %al,(%rax)
+  8037ff:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803802:	80 00 00             	addb   $0x0,(%rax)
+  803805:	00 00                	add    %al,(%rax)
+  803807:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  80380a:	80 00 00             	addb   $0x0,(%rax)
+  80380d:	00 00                	add    %al,(%rax)
+  80380f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803812:	80 00 00             	addb   $0x0,(%rax)
+  803815:	00 00                	add    %al,(%rax)
+  803817:	00 12                	add    %dl,(%rdx)
+  803819:	06                   	(bad)
+  80381a:	80 00 00             	addb   $0x0,(%rax)
+  80381d:	00 00                	add    %al,(%rax)
+  80381f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803822:	80 00 00             	addb   $0x0,(%rax)
+  803825:	00 00                	add    %al,(%rax)
+  803827:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  80382a:	80 00 00             	addb   $0x0,(%rax)
+  80382d:	00 00                	add    %al,(%rax)
+  80382f:	00 06                	add    %al,(%rsi)
+  803831:	06                   	(bad)
+  803832:	80 00 00             	addb   $0x0,(%rax)
+  803835:	00 00                	add    %al,(%rax)
+  803837:	00 80 06 80 00 00    	add    %al,0x8006(%rax)
+  80383d:	00 00                	add    %al,(%rax)
+  80383f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803842:	80 00 00             	addb   $0x0,(%rax)
+  803845:	00 00                	add    %al,(%rax)
+  803847:	00 06                	add    %al,(%rsi)
+  803849:	06                   	(bad)
+  80384a:	80 00 00             	addb   $0x0,(%rax)
+  80384d:	00 00                	add    %al,(%rax)
+  80384f:	00 4c 06 80          	add    %cl,-0x80(%rsi,%rax,1)
+  803853:	00 00                	add    %al,(%rax)
+  803855:	00 00                	add    %al,(%rax)
+  803857:	00 4c 06 80          	add    %cl,-0x80(%rsi,%rax,1)
+  80385b:	00 00                	add    %al,(%rax)
+  80385d:	00 00                	add    %al,(%rax)
+  80385f:	00 4c 06 80          	add    %cl,-0x80(%rsi,%rax,1)
+  803863:	00 00                	add    %al,(%rax)
+  803865:	00 00                	add    %al,(%rax)
+  803867:	00 4c 06 80          	add    %cl,-0x80(%rsi,%rax,1)
+  80386b:	00 00                	add    %al,(%rax)
+  80386d:	00 00                	add    %al,(%rax)
+  80386f:	00 4c 06 80          	add    %cl,-0x80(%rsi,%rax,1)
+  803873:	00 00                	add    %al,(%rax)
+  803875:	00 00                	add    %al,(%rax)
+  803877:	00 4c 06 80          	add    %cl,-0x80(%rsi,%rax,1)
+  80387b:	00 00                	add    %al,(%rax)
+  80387d:	00 00                	add    %al,(%rax)
+  80387f:	00 4c 06 80          	add    %cl,-0x80(%rsi,%rax,1)
+  803883:	00 00                	add    %al,(%rax)
+  803885:	00 00                	add    %al,(%rax)
+  803887:	00 4c 06 80          	add    %cl,-0x80(%rsi,%rax,1)
+  80388b:	00 00                	add    %al,(%rax)
+  80388d:	00 00                	add    %al,(%rax)
+  80388f:	00 4c 06 80          	add    %cl,-0x80(%rsi,%rax,1)
+  803893:	00 00                	add    %al,(%rax)
+  803895:	00 00                	add    %al,(%rax)
+  803897:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  80389a:	80 00 00             	addb   $0x0,(%rax)
+  80389d:	00 00                	add    %al,(%rax)
+  80389f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8038a2:	80 00 00             	addb   $0x0,(%rax)
+  8038a5:	00 00                	add    %al,(%rax)
+  8038a7:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8038aa:	80 00 00             	addb   $0x0,(%rax)
+  8038ad:	00 00                	add    %al,(%rax)
+  8038af:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8038b2:	80 00 00             	addb   $0x0,(%rax)
+  8038b5:	00 00                	add    %al,(%rax)
+  8038b7:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8038ba:	80 00 00             	addb   $0x0,(%rax)
+  8038bd:	00 00                	add    %al,(%rax)
+  8038bf:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8038c2:	80 00 00             	addb   $0x0,(%rax)
+  8038c5:	00 00                	add    %al,(%rax)
+  8038c7:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8038ca:	80 00 00             	addb   $0x0,(%rax)
+  8038cd:	00 00                	add    %al,(%rax)
+  8038cf:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8038d2:	80 00 00             	addb   $0x0,(%rax)
+  8038d5:	00 00                	add    %al,(%rax)
+  8038d7:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8038da:	80 00 00             	addb   $0x0,(%rax)
+  8038dd:	00 00                	add    %al,(%rax)
+  8038df:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8038e2:	80 00 00             	addb   $0x0,(%rax)
+  8038e5:	00 00                	add    %al,(%rax)
+  8038e7:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8038ea:	80 00 00             	addb   $0x0,(%rax)
+  8038ed:	00 00                	add    %al,(%rax)
+  8038ef:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8038f2:	80 00 00             	addb   $0x0,(%rax)
+  8038f5:	00 00                	add    %al,(%rax)
+  8038f7:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8038fa:	80 00 00             	addb   $0x0,(%rax)
+  8038fd:	00 00                	add    %al,(%rax)
+  8038ff:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803902:	80 00 00             	addb   $0x0,(%rax)
+  803905:	00 00                	add    %al,(%rax)
+  803907:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  80390a:	80 00 00             	addb   $0x0,(%rax)
+  80390d:	00 00                	add    %al,(%rax)
+  80390f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803912:	80 00 00             	addb   $0x0,(%rax)
+  803915:	00 00                	add    %al,(%rax)
+  803917:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  80391a:	80 00 00             	addb   $0x0,(%rax)
+  80391d:	00 00                	add    %al,(%rax)
+  80391f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803922:	80 00 00             	addb   $0x0,(%rax)
+  803925:	00 00                	add    %al,(%rax)
+  803927:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  80392a:	80 00 00             	addb   $0x0,(%rax)
+  80392d:	00 00                	add    %al,(%rax)
+  80392f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803932:	80 00 00             	addb   $0x0,(%rax)
+  803935:	00 00                	add    %al,(%rax)
+  803937:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  80393a:	80 00 00             	addb   $0x0,(%rax)
+  80393d:	00 00                	add    %al,(%rax)
+  80393f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803942:	80 00 00             	addb   $0x0,(%rax)
+  803945:	00 00                	add    %al,(%rax)
+  803947:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  80394a:	80 00 00             	addb   $0x0,(%rax)
+  80394d:	00 00                	add    %al,(%rax)
+  80394f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803952:	80 00 00             	addb   $0x0,(%rax)
+  803955:	00 00                	add    %al,(%rax)
+  803957:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  80395a:	80 00 00             	addb   $0x0,(%rax)
+  80395d:	00 00                	add    %al,(%rax)
+  80395f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803962:	80 00 00             	addb   $0x0,(%rax)
+  803965:	00 00                	add    %al,(%rax)
+  803967:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  80396a:	80 00 00             	addb   $0x0,(%rax)
+  80396d:	00 00                	add    %al,(%rax)
+  80396f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803972:	80 00 00             	addb   $0x0,(%rax)
+  803975:	00 00                	add    %al,(%rax)
+  803977:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  80397a:	80 00 00             	addb   $0x0,(%rax)
+  80397d:	00 00                	add    %al,(%rax)
+  80397f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803982:	80 00 00             	addb   $0x0,(%rax)
+  803985:	00 00                	add    %al,(%rax)
+  803987:	00 57 0b             	add    %dl,0xb(%rdi)
+  80398a:	80 00 00             	addb   $0x0,(%rax)
+  80398d:	00 00                	add    %al,(%rax)
+  80398f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803992:	80 00 00             	addb   $0x0,(%rax)
+  803995:	00 00                	add    %al,(%rax)
+  803997:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  80399a:	80 00 00             	addb   $0x0,(%rax)
+  80399d:	00 00                	add    %al,(%rax)
+  80399f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8039a2:	80 00 00             	addb   $0x0,(%rax)
+  8039a5:	00 00                	add    %al,(%rax)
+  8039a7:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8039aa:	80 00 00             	addb   $0x0,(%rax)
+  8039ad:	00 00                	add    %al,(%rax)
+  8039af:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8039b2:	80 00 00             	addb   $0x0,(%rax)
+  8039b5:	00 00                	add    %al,(%rax)
+  8039b7:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8039ba:	80 00 00             	addb   $0x0,(%rax)
+  8039bd:	00 00                	add    %al,(%rax)
+  8039bf:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8039c2:	80 00 00             	addb   $0x0,(%rax)
+  8039c5:	00 00                	add    %al,(%rax)
+  8039c7:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8039ca:	80 00 00             	addb   $0x0,(%rax)
+  8039cd:	00 00                	add    %al,(%rax)
+  8039cf:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8039d2:	80 00 00             	addb   $0x0,(%rax)
+  8039d5:	00 00                	add    %al,(%rax)
+  8039d7:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8039da:	80 00 00             	addb   $0x0,(%rax)
+  8039dd:	00 00                	add    %al,(%rax)
+  8039df:	00 a3 06 80 00 00    	add    %ah,0x8006(%rbx)
+  8039e5:	00 00                	add    %al,(%rax)
+  8039e7:	00 72 08             	add    %dh,0x8(%rdx)
+  8039ea:	80 00 00             	addb   $0x0,(%rax)
+  8039ed:	00 00                	add    %al,(%rax)
+  8039ef:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8039f2:	80 00 00             	addb   $0x0,(%rax)
+  8039f5:	00 00                	add    %al,(%rax)
+  8039f7:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  8039fa:	80 00 00             	addb   $0x0,(%rax)
+  8039fd:	00 00                	add    %al,(%rax)
+  8039ff:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803a02:	80 00 00             	addb   $0x0,(%rax)
+  803a05:	00 00                	add    %al,(%rax)
+  803a07:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803a0a:	80 00 00             	addb   $0x0,(%rax)
+  803a0d:	00 00                	add    %al,(%rax)
+  803a0f:	00 d2                	add    %dl,%dl
+  803a11:	06                   	(bad)
+  803a12:	80 00 00             	addb   $0x0,(%rax)
+  803a15:	00 00                	add    %al,(%rax)
+  803a17:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803a1a:	80 00 00             	addb   $0x0,(%rax)
+  803a1d:	00 00                	add    %al,(%rax)
+  803a1f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803a22:	80 00 00             	addb   $0x0,(%rax)
+  803a25:	00 00                	add    %al,(%rax)
+  803a27:	00 98 06 80 00 00    	add    %bl,0x8006(%rax)
+  803a2d:	00 00                	add    %al,(%rax)
+  803a2f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803a32:	80 00 00             	addb   $0x0,(%rax)
+  803a35:	00 00                	add    %al,(%rax)
+  803a37:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803a3a:	80 00 00             	addb   $0x0,(%rax)
+  803a3d:	00 00                	add    %al,(%rax)
+  803a3f:	00 1a                	add    %bl,(%rdx)
+  803a41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a47:	00 e4                	add    %ah,%ah
+  803a49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a4f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803a52:	80 00 00             	addb   $0x0,(%rax)
+  803a55:	00 00                	add    %al,(%rax)
+  803a57:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803a5a:	80 00 00             	addb   $0x0,(%rax)
+  803a5d:	00 00                	add    %al,(%rax)
+  803a5f:	00 69 07             	add    %ch,0x7(%rcx)
+  803a62:	80 00 00             	addb   $0x0,(%rax)
+  803a65:	00 00                	add    %al,(%rax)
+  803a67:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803a6a:	80 00 00             	addb   $0x0,(%rax)
+  803a6d:	00 00                	add    %al,(%rax)
+  803a6f:	00 46 09             	add    %al,0x9(%rsi)
+  803a72:	80 00 00             	addb   $0x0,(%rax)
+  803a75:	00 00                	add    %al,(%rax)
+  803a77:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803a7a:	80 00 00             	addb   $0x0,(%rax)
+  803a7d:	00 00                	add    %al,(%rax)
+  803a7f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803a82:	80 00 00             	addb   $0x0,(%rax)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 57 0b             	add    %dl,0xb(%rdi)
+  803a8a:	80 00 00             	addb   $0x0,(%rax)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 34 0c             	add    %dh,(%rsp,%rcx,1)
+  803a92:	80 00 00             	addb   $0x0,(%rax)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 fc                	add    %bh,%ah
+  803a99:	05 80 00 00 00       	add    $0x80,%eax
+	...
+
+0000000000803aa0 <error_string>:
+	...
+  803aa8:	4d 36 80 00 00 00 00 00 5f 36 80 00 00 00 00 00     M6......_6......
+  803ab8:	6f 36 80 00 00 00 00 00 81 36 80 00 00 00 00 00     o6.......6......
+  803ac8:	8f 36 80 00 00 00 00 00 a3 36 80 00 00 00 00 00     .6.......6......
+  803ad8:	b8 36 80 00 00 00 00 00 cb 36 80 00 00 00 00 00     .6.......6......
+  803ae8:	dd 36 80 00 00 00 00 00 f1 36 80 00 00 00 00 00     .6.......6......
+  803af8:	01 37 80 00 00 00 00 00 14 37 80 00 00 00 00 00     .7.......7......
+  803b08:	2b 37 80 00 00 00 00 00 41 37 80 00 00 00 00 00     +7......A7......
+  803b18:	59 37 80 00 00 00 00 00 71 37 80 00 00 00 00 00     Y7......q7......
+  803b28:	7e 37 80 00 00 00 00 00 50 3b 80 00 00 00 00 00     ~7......P;......
+  803b38:	92 37 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .7..............
+  803b48:	aa 37 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .7......file is 
+  803b58:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803b68:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803b78:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803b88:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803b98:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803ba8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803bb8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803bc8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803bd8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803be8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803bf8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803c08:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803c18:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803c20 <devtab>:
+  803c20:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803c30:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803c40:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  803c50:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  803c60:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  803c70:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  803c80:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  803c90:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  803ca0:	45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20 77     Elf magic %08x w
+  803cb0:	61 6e 74 20 25 30 38 78 0a 00 61 73 73 65 72 74     ant %08x..assert
+  803cc0:	69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00 6c     ion failed: %s.l
+  803cd0:	69 62 2f 73 70 61 77 6e 2e 63 00 62 79 74 65 73     ib/spawn.c.bytes
+  803ce0:	5f 72 65 61 64 20 3d 3d 20 66 69 6c 65 73 7a 00     _read == filesz.
+  803cf0:	63 6f 70 79 5f 73 68 61 72 65 64 5f 72 65 67 69     copy_shared_regi
+  803d00:	6f 6e 3a 20 25 69 00 73 79 73 5f 65 6e 76 5f 73     on: %i.sys_env_s
+  803d10:	65 74 5f 74 72 61 70 66 72 61 6d 65 3a 20 25 69     et_trapframe: %i
+  803d20:	00 73 79 73 5f 65 6e 76 5f 73 65 74 5f 73 74 61     .sys_env_set_sta
+  803d30:	74 75 73 3a 20 25 69 00 3c 70 69 70 65 3e 00 6c     tus: %i.<pipe>.l
+  803d40:	69 62 2f 70 69 70 65 2e 63 00 70 69 70 65 00 90     ib/pipe.c.pipe..
+  803d50:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803d60:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803d70:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803d80:	69 70 63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64     ipc_send: failed
+  803d90:	20 74 6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63      to send.lib/ipc
+  803da0:	2e 63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     .c.f.........f..
+  803db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
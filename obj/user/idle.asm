@@ -0,0 +1,5390 @@
+
+obj/user/idle:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2d 00 00 00       	call   800050 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    binaryname = "idle";
+  80002e:	48 b8 40 2b 80 00 00 	movabs $0x802b40,%rax
+  800035:	00 00 00 
+  800038:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80003f:	00 00 00 
+     * Instead of busy-waiting like this,
+     * a better way would be to use the processor's HLT instruction
+     * to cause the processor to stop executing until the next interrupt -
+     * doing so allows the processor to conserve power more effectively. */
+    while (1) {
+        sys_yield();
+  800042:	48 bb 14 02 80 00 00 	movabs $0x800214,%rbx
+  800049:	00 00 00 
+  80004c:	ff d3                	call   *%rbx
+    while (1) {
+  80004e:	eb fc                	jmp    80004c <umain+0x27>
+
+0000000000800050 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800050:	55                   	push   %rbp
+  800051:	48 89 e5             	mov    %rsp,%rbp
+  800054:	41 56                	push   %r14
+  800056:	41 55                	push   %r13
+  800058:	41 54                	push   %r12
+  80005a:	53                   	push   %rbx
+  80005b:	41 89 fd             	mov    %edi,%r13d
+  80005e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800061:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800068:	00 00 00 
+  80006b:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800072:	00 00 00 
+  800075:	48 39 c2             	cmp    %rax,%rdx
+  800078:	73 17                	jae    800091 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80007a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007d:	49 89 c4             	mov    %rax,%r12
+  800080:	48 83 c3 08          	add    $0x8,%rbx
+  800084:	b8 00 00 00 00       	mov    $0x0,%eax
+  800089:	ff 53 f8             	call   *-0x8(%rbx)
+  80008c:	4c 39 e3             	cmp    %r12,%rbx
+  80008f:	72 ef                	jb     800080 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800091:	48 b8 e3 01 80 00 00 	movabs $0x8001e3,%rax
+  800098:	00 00 00 
+  80009b:	ff d0                	call   *%rax
+  80009d:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8000a0:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8000a7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000ae:	00 00 00 
+  8000b1:	48 01 d0             	add    %rdx,%rax
+  8000b4:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000bb:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000be:	45 85 ed             	test   %r13d,%r13d
+  8000c1:	7e 0d                	jle    8000d0 <libmain+0x80>
+  8000c3:	49 8b 06             	mov    (%r14),%rax
+  8000c6:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000cd:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d0:	4c 89 f6             	mov    %r14,%rsi
+  8000d3:	44 89 ef             	mov    %r13d,%edi
+  8000d6:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000dd:	00 00 00 
+  8000e0:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e2:	48 b8 f7 00 80 00 00 	movabs $0x8000f7,%rax
+  8000e9:	00 00 00 
+  8000ec:	ff d0                	call   *%rax
+#endif
+}
+  8000ee:	5b                   	pop    %rbx
+  8000ef:	41 5c                	pop    %r12
+  8000f1:	41 5d                	pop    %r13
+  8000f3:	41 5e                	pop    %r14
+  8000f5:	5d                   	pop    %rbp
+  8000f6:	c3                   	ret
+
+00000000008000f7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f7:	55                   	push   %rbp
+  8000f8:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000fb:	48 b8 6b 0a 80 00 00 	movabs $0x800a6b,%rax
+  800102:	00 00 00 
+  800105:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800107:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010c:	48 b8 78 01 80 00 00 	movabs $0x800178,%rax
+  800113:	00 00 00 
+  800116:	ff d0                	call   *%rax
+}
+  800118:	5d                   	pop    %rbp
+  800119:	c3                   	ret
+
+000000000080011a <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80011a:	55                   	push   %rbp
+  80011b:	48 89 e5             	mov    %rsp,%rbp
+  80011e:	53                   	push   %rbx
+  80011f:	48 89 fa             	mov    %rdi,%rdx
+  800122:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800125:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80012a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80012f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800134:	be 00 00 00 00       	mov    $0x0,%esi
+  800139:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80013f:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800141:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800145:	c9                   	leave
+  800146:	c3                   	ret
+
+0000000000800147 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800147:	55                   	push   %rbp
+  800148:	48 89 e5             	mov    %rsp,%rbp
+  80014b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80014c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800151:	ba 00 00 00 00       	mov    $0x0,%edx
+  800156:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80015b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800160:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800165:	be 00 00 00 00       	mov    $0x0,%esi
+  80016a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800170:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800172:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800176:	c9                   	leave
+  800177:	c3                   	ret
+
+0000000000800178 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800178:	55                   	push   %rbp
+  800179:	48 89 e5             	mov    %rsp,%rbp
+  80017c:	53                   	push   %rbx
+  80017d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800181:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800184:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800189:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80018e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800193:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800198:	be 00 00 00 00       	mov    $0x0,%esi
+  80019d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001a5:	48 85 c0             	test   %rax,%rax
+  8001a8:	7f 06                	jg     8001b0 <sys_env_destroy+0x38>
+}
+  8001aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ae:	c9                   	leave
+  8001af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001b0:	49 89 c0             	mov    %rax,%r8
+  8001b3:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001b8:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  8001bf:	00 00 00 
+  8001c2:	be 26 00 00 00       	mov    $0x26,%esi
+  8001c7:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  8001ce:	00 00 00 
+  8001d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d6:	49 b9 18 1b 80 00 00 	movabs $0x801b18,%r9
+  8001dd:	00 00 00 
+  8001e0:	41 ff d1             	call   *%r9
+
+00000000008001e3 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001e3:	55                   	push   %rbp
+  8001e4:	48 89 e5             	mov    %rsp,%rbp
+  8001e7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001e8:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800201:	be 00 00 00 00       	mov    $0x0,%esi
+  800206:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80020c:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80020e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800212:	c9                   	leave
+  800213:	c3                   	ret
+
+0000000000800214 <sys_yield>:
+
+void
+sys_yield(void) {
+  800214:	55                   	push   %rbp
+  800215:	48 89 e5             	mov    %rsp,%rbp
+  800218:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800219:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80021e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800223:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800228:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80022d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800232:	be 00 00 00 00       	mov    $0x0,%esi
+  800237:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80023d:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80023f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800243:	c9                   	leave
+  800244:	c3                   	ret
+
+0000000000800245 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800245:	55                   	push   %rbp
+  800246:	48 89 e5             	mov    %rsp,%rbp
+  800249:	53                   	push   %rbx
+  80024a:	48 89 fa             	mov    %rdi,%rdx
+  80024d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800250:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800255:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80025c:	00 00 00 
+  80025f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800264:	be 00 00 00 00       	mov    $0x0,%esi
+  800269:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80026f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800271:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800275:	c9                   	leave
+  800276:	c3                   	ret
+
+0000000000800277 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800277:	55                   	push   %rbp
+  800278:	48 89 e5             	mov    %rsp,%rbp
+  80027b:	53                   	push   %rbx
+  80027c:	49 89 f8             	mov    %rdi,%r8
+  80027f:	48 89 d3             	mov    %rdx,%rbx
+  800282:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800285:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80028a:	4c 89 c2             	mov    %r8,%rdx
+  80028d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800290:	be 00 00 00 00       	mov    $0x0,%esi
+  800295:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80029b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80029d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002a1:	c9                   	leave
+  8002a2:	c3                   	ret
+
+00000000008002a3 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002a3:	55                   	push   %rbp
+  8002a4:	48 89 e5             	mov    %rsp,%rbp
+  8002a7:	53                   	push   %rbx
+  8002a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ac:	89 f8                	mov    %edi,%eax
+  8002ae:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002b1:	48 63 f9             	movslq %ecx,%rdi
+  8002b4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002b7:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002bc:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8002c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002ca:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002cc:	48 85 c0             	test   %rax,%rax
+  8002cf:	7f 06                	jg     8002d7 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002d5:	c9                   	leave
+  8002d6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002d7:	49 89 c0             	mov    %rax,%r8
+  8002da:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002df:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  8002e6:	00 00 00 
+  8002e9:	be 26 00 00 00       	mov    $0x26,%esi
+  8002ee:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  8002f5:	00 00 00 
+  8002f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fd:	49 b9 18 1b 80 00 00 	movabs $0x801b18,%r9
+  800304:	00 00 00 
+  800307:	41 ff d1             	call   *%r9
+
+000000000080030a <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80030a:	55                   	push   %rbp
+  80030b:	48 89 e5             	mov    %rsp,%rbp
+  80030e:	53                   	push   %rbx
+  80030f:	48 83 ec 08          	sub    $0x8,%rsp
+  800313:	89 f8                	mov    %edi,%eax
+  800315:	49 89 f2             	mov    %rsi,%r10
+  800318:	48 89 cf             	mov    %rcx,%rdi
+  80031b:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80031e:	48 63 da             	movslq %edx,%rbx
+  800321:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800324:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800329:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80032c:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80032f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800331:	48 85 c0             	test   %rax,%rax
+  800334:	7f 06                	jg     80033c <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800336:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80033a:	c9                   	leave
+  80033b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80033c:	49 89 c0             	mov    %rax,%r8
+  80033f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800344:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  80034b:	00 00 00 
+  80034e:	be 26 00 00 00       	mov    $0x26,%esi
+  800353:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  80035a:	00 00 00 
+  80035d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800362:	49 b9 18 1b 80 00 00 	movabs $0x801b18,%r9
+  800369:	00 00 00 
+  80036c:	41 ff d1             	call   *%r9
+
+000000000080036f <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80036f:	55                   	push   %rbp
+  800370:	48 89 e5             	mov    %rsp,%rbp
+  800373:	53                   	push   %rbx
+  800374:	48 83 ec 08          	sub    $0x8,%rsp
+  800378:	48 89 f1             	mov    %rsi,%rcx
+  80037b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80037e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800381:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800386:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80038b:	be 00 00 00 00       	mov    $0x0,%esi
+  800390:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800396:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800398:	48 85 c0             	test   %rax,%rax
+  80039b:	7f 06                	jg     8003a3 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80039d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003a1:	c9                   	leave
+  8003a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003a3:	49 89 c0             	mov    %rax,%r8
+  8003a6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003ab:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  8003b2:	00 00 00 
+  8003b5:	be 26 00 00 00       	mov    $0x26,%esi
+  8003ba:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  8003c1:	00 00 00 
+  8003c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c9:	49 b9 18 1b 80 00 00 	movabs $0x801b18,%r9
+  8003d0:	00 00 00 
+  8003d3:	41 ff d1             	call   *%r9
+
+00000000008003d6 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8003d6:	55                   	push   %rbp
+  8003d7:	48 89 e5             	mov    %rsp,%rbp
+  8003da:	53                   	push   %rbx
+  8003db:	48 83 ec 08          	sub    $0x8,%rsp
+  8003df:	89 f8                	mov    %edi,%eax
+  8003e1:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8003e4:	48 63 f9             	movslq %ecx,%rdi
+  8003e7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003ea:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003ef:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8003f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003fd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003ff:	48 85 c0             	test   %rax,%rax
+  800402:	7f 06                	jg     80040a <sys_region_advise+0x34>
+}
+  800404:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800408:	c9                   	leave
+  800409:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80040a:	49 89 c0             	mov    %rax,%r8
+  80040d:	b9 14 00 00 00       	mov    $0x14,%ecx
+  800412:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  800419:	00 00 00 
+  80041c:	be 26 00 00 00       	mov    $0x26,%esi
+  800421:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  800428:	00 00 00 
+  80042b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800430:	49 b9 18 1b 80 00 00 	movabs $0x801b18,%r9
+  800437:	00 00 00 
+  80043a:	41 ff d1             	call   *%r9
+
+000000000080043d <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  80043d:	55                   	push   %rbp
+  80043e:	48 89 e5             	mov    %rsp,%rbp
+  800441:	53                   	push   %rbx
+  800442:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  800446:	48 63 ce             	movslq %esi,%rcx
+  800449:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80044c:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800451:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800456:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80045b:	be 00 00 00 00       	mov    $0x0,%esi
+  800460:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800466:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800468:	48 85 c0             	test   %rax,%rax
+  80046b:	7f 06                	jg     800473 <sys_env_set_nice+0x36>
+}
+  80046d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800471:	c9                   	leave
+  800472:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800473:	49 89 c0             	mov    %rax,%r8
+  800476:	b9 15 00 00 00       	mov    $0x15,%ecx
+  80047b:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  800482:	00 00 00 
+  800485:	be 26 00 00 00       	mov    $0x26,%esi
+  80048a:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  800491:	00 00 00 
+  800494:	b8 00 00 00 00       	mov    $0x0,%eax
+  800499:	49 b9 18 1b 80 00 00 	movabs $0x801b18,%r9
+  8004a0:	00 00 00 
+  8004a3:	41 ff d1             	call   *%r9
+
+00000000008004a6 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004a6:	55                   	push   %rbp
+  8004a7:	48 89 e5             	mov    %rsp,%rbp
+  8004aa:	53                   	push   %rbx
+  8004ab:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004af:	48 63 ce             	movslq %esi,%rcx
+  8004b2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004b5:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8004c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004cf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004d1:	48 85 c0             	test   %rax,%rax
+  8004d4:	7f 06                	jg     8004dc <sys_env_set_status+0x36>
+}
+  8004d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004da:	c9                   	leave
+  8004db:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004dc:	49 89 c0             	mov    %rax,%r8
+  8004df:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004e4:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  8004eb:	00 00 00 
+  8004ee:	be 26 00 00 00       	mov    $0x26,%esi
+  8004f3:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  8004fa:	00 00 00 
+  8004fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800502:	49 b9 18 1b 80 00 00 	movabs $0x801b18,%r9
+  800509:	00 00 00 
+  80050c:	41 ff d1             	call   *%r9
+
+000000000080050f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80050f:	55                   	push   %rbp
+  800510:	48 89 e5             	mov    %rsp,%rbp
+  800513:	53                   	push   %rbx
+  800514:	48 83 ec 08          	sub    $0x8,%rsp
+  800518:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80051b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80051e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800523:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800528:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80052d:	be 00 00 00 00       	mov    $0x0,%esi
+  800532:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800538:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80053a:	48 85 c0             	test   %rax,%rax
+  80053d:	7f 06                	jg     800545 <sys_env_set_trapframe+0x36>
+}
+  80053f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800543:	c9                   	leave
+  800544:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800545:	49 89 c0             	mov    %rax,%r8
+  800548:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80054d:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  800554:	00 00 00 
+  800557:	be 26 00 00 00       	mov    $0x26,%esi
+  80055c:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  800563:	00 00 00 
+  800566:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056b:	49 b9 18 1b 80 00 00 	movabs $0x801b18,%r9
+  800572:	00 00 00 
+  800575:	41 ff d1             	call   *%r9
+
+0000000000800578 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800578:	55                   	push   %rbp
+  800579:	48 89 e5             	mov    %rsp,%rbp
+  80057c:	53                   	push   %rbx
+  80057d:	48 83 ec 08          	sub    $0x8,%rsp
+  800581:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800584:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800587:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80058c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800591:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800596:	be 00 00 00 00       	mov    $0x0,%esi
+  80059b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005a1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005a3:	48 85 c0             	test   %rax,%rax
+  8005a6:	7f 06                	jg     8005ae <sys_env_set_pgfault_upcall+0x36>
+}
+  8005a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005ac:	c9                   	leave
+  8005ad:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005ae:	49 89 c0             	mov    %rax,%r8
+  8005b1:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8005b6:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  8005bd:	00 00 00 
+  8005c0:	be 26 00 00 00       	mov    $0x26,%esi
+  8005c5:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  8005cc:	00 00 00 
+  8005cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d4:	49 b9 18 1b 80 00 00 	movabs $0x801b18,%r9
+  8005db:	00 00 00 
+  8005de:	41 ff d1             	call   *%r9
+
+00000000008005e1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8005e1:	55                   	push   %rbp
+  8005e2:	48 89 e5             	mov    %rsp,%rbp
+  8005e5:	53                   	push   %rbx
+  8005e6:	89 f8                	mov    %edi,%eax
+  8005e8:	49 89 f1             	mov    %rsi,%r9
+  8005eb:	48 89 d3             	mov    %rdx,%rbx
+  8005ee:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8005f1:	49 63 f0             	movslq %r8d,%rsi
+  8005f4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005f7:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005fc:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800605:	cd 30                	int    $0x30
+}
+  800607:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80060b:	c9                   	leave
+  80060c:	c3                   	ret
+
+000000000080060d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80060d:	55                   	push   %rbp
+  80060e:	48 89 e5             	mov    %rsp,%rbp
+  800611:	53                   	push   %rbx
+  800612:	48 83 ec 08          	sub    $0x8,%rsp
+  800616:	48 89 fa             	mov    %rdi,%rdx
+  800619:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80061c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800621:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800626:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80062b:	be 00 00 00 00       	mov    $0x0,%esi
+  800630:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800636:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800638:	48 85 c0             	test   %rax,%rax
+  80063b:	7f 06                	jg     800643 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80063d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800641:	c9                   	leave
+  800642:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800643:	49 89 c0             	mov    %rax,%r8
+  800646:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80064b:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  800652:	00 00 00 
+  800655:	be 26 00 00 00       	mov    $0x26,%esi
+  80065a:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  800661:	00 00 00 
+  800664:	b8 00 00 00 00       	mov    $0x0,%eax
+  800669:	49 b9 18 1b 80 00 00 	movabs $0x801b18,%r9
+  800670:	00 00 00 
+  800673:	41 ff d1             	call   *%r9
+
+0000000000800676 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800676:	55                   	push   %rbp
+  800677:	48 89 e5             	mov    %rsp,%rbp
+  80067a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80067b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800680:	ba 00 00 00 00       	mov    $0x0,%edx
+  800685:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80068a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80068f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800694:	be 00 00 00 00       	mov    $0x0,%esi
+  800699:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80069f:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8006a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006a5:	c9                   	leave
+  8006a6:	c3                   	ret
+
+00000000008006a7 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8006a7:	55                   	push   %rbp
+  8006a8:	48 89 e5             	mov    %rsp,%rbp
+  8006ab:	53                   	push   %rbx
+  8006ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8006b0:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8006b3:	48 63 ce             	movslq %esi,%rcx
+  8006b6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8006b9:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8006c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006ce:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8006d0:	48 85 c0             	test   %rax,%rax
+  8006d3:	7f 06                	jg     8006db <sys_sigqueue+0x34>
+}
+  8006d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006d9:	c9                   	leave
+  8006da:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006db:	49 89 c0             	mov    %rax,%r8
+  8006de:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8006e3:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  8006ea:	00 00 00 
+  8006ed:	be 26 00 00 00       	mov    $0x26,%esi
+  8006f2:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  8006f9:	00 00 00 
+  8006fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800701:	49 b9 18 1b 80 00 00 	movabs $0x801b18,%r9
+  800708:	00 00 00 
+  80070b:	41 ff d1             	call   *%r9
+
+000000000080070e <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  80070e:	55                   	push   %rbp
+  80070f:	48 89 e5             	mov    %rsp,%rbp
+  800712:	53                   	push   %rbx
+  800713:	48 83 ec 08          	sub    $0x8,%rsp
+  800717:	48 89 fa             	mov    %rdi,%rdx
+  80071a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80071d:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800722:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800727:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80072c:	be 00 00 00 00       	mov    $0x0,%esi
+  800731:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800737:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800739:	48 85 c0             	test   %rax,%rax
+  80073c:	7f 06                	jg     800744 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  80073e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800742:	c9                   	leave
+  800743:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800744:	49 89 c0             	mov    %rax,%r8
+  800747:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80074c:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  800753:	00 00 00 
+  800756:	be 26 00 00 00       	mov    $0x26,%esi
+  80075b:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  800762:	00 00 00 
+  800765:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076a:	49 b9 18 1b 80 00 00 	movabs $0x801b18,%r9
+  800771:	00 00 00 
+  800774:	41 ff d1             	call   *%r9
+
+0000000000800777 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  800777:	55                   	push   %rbp
+  800778:	48 89 e5             	mov    %rsp,%rbp
+  80077b:	53                   	push   %rbx
+  80077c:	48 83 ec 08          	sub    $0x8,%rsp
+  800780:	48 89 f1             	mov    %rsi,%rcx
+  800783:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  800786:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800789:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80078e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800793:	be 00 00 00 00       	mov    $0x0,%esi
+  800798:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80079e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8007a0:	48 85 c0             	test   %rax,%rax
+  8007a3:	7f 06                	jg     8007ab <sys_sigaction+0x34>
+}
+  8007a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007a9:	c9                   	leave
+  8007aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007ab:	49 89 c0             	mov    %rax,%r8
+  8007ae:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8007b3:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  8007ba:	00 00 00 
+  8007bd:	be 26 00 00 00       	mov    $0x26,%esi
+  8007c2:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  8007c9:	00 00 00 
+  8007cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d1:	49 b9 18 1b 80 00 00 	movabs $0x801b18,%r9
+  8007d8:	00 00 00 
+  8007db:	41 ff d1             	call   *%r9
+
+00000000008007de <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8007de:	55                   	push   %rbp
+  8007df:	48 89 e5             	mov    %rsp,%rbp
+  8007e2:	53                   	push   %rbx
+  8007e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8007e7:	48 89 f1             	mov    %rsi,%rcx
+  8007ea:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8007ed:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8007f0:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8007f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8007ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800805:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800807:	48 85 c0             	test   %rax,%rax
+  80080a:	7f 06                	jg     800812 <sys_sigprocmask+0x34>
+}
+  80080c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800810:	c9                   	leave
+  800811:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800812:	49 89 c0             	mov    %rax,%r8
+  800815:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80081a:	48 ba 50 2b 80 00 00 	movabs $0x802b50,%rdx
+  800821:	00 00 00 
+  800824:	be 26 00 00 00       	mov    $0x26,%esi
+  800829:	48 bf 6f 2b 80 00 00 	movabs $0x802b6f,%rdi
+  800830:	00 00 00 
+  800833:	b8 00 00 00 00       	mov    $0x0,%eax
+  800838:	49 b9 18 1b 80 00 00 	movabs $0x801b18,%r9
+  80083f:	00 00 00 
+  800842:	41 ff d1             	call   *%r9
+
+0000000000800845 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800845:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80084c:	ff ff ff 
+  80084f:	48 01 f8             	add    %rdi,%rax
+  800852:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800856:	c3                   	ret
+
+0000000000800857 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800857:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80085e:	ff ff ff 
+  800861:	48 01 f8             	add    %rdi,%rax
+  800864:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800868:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80086e:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800872:	c3                   	ret
+
+0000000000800873 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800873:	55                   	push   %rbp
+  800874:	48 89 e5             	mov    %rsp,%rbp
+  800877:	41 57                	push   %r15
+  800879:	41 56                	push   %r14
+  80087b:	41 55                	push   %r13
+  80087d:	41 54                	push   %r12
+  80087f:	53                   	push   %rbx
+  800880:	48 83 ec 08          	sub    $0x8,%rsp
+  800884:	49 89 ff             	mov    %rdi,%r15
+  800887:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80088c:	49 bd f1 17 80 00 00 	movabs $0x8017f1,%r13
+  800893:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800896:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80089c:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80089f:	48 89 df             	mov    %rbx,%rdi
+  8008a2:	41 ff d5             	call   *%r13
+  8008a5:	83 e0 04             	and    $0x4,%eax
+  8008a8:	74 17                	je     8008c1 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8008aa:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8008b1:	4c 39 f3             	cmp    %r14,%rbx
+  8008b4:	75 e6                	jne    80089c <fd_alloc+0x29>
+  8008b6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8008bc:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8008c1:	4d 89 27             	mov    %r12,(%r15)
+}
+  8008c4:	48 83 c4 08          	add    $0x8,%rsp
+  8008c8:	5b                   	pop    %rbx
+  8008c9:	41 5c                	pop    %r12
+  8008cb:	41 5d                	pop    %r13
+  8008cd:	41 5e                	pop    %r14
+  8008cf:	41 5f                	pop    %r15
+  8008d1:	5d                   	pop    %rbp
+  8008d2:	c3                   	ret
+
+00000000008008d3 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8008d3:	83 ff 1f             	cmp    $0x1f,%edi
+  8008d6:	77 39                	ja     800911 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8008d8:	55                   	push   %rbp
+  8008d9:	48 89 e5             	mov    %rsp,%rbp
+  8008dc:	41 54                	push   %r12
+  8008de:	53                   	push   %rbx
+  8008df:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8008e2:	48 63 df             	movslq %edi,%rbx
+  8008e5:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8008ec:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8008f0:	48 89 df             	mov    %rbx,%rdi
+  8008f3:	48 b8 f1 17 80 00 00 	movabs $0x8017f1,%rax
+  8008fa:	00 00 00 
+  8008fd:	ff d0                	call   *%rax
+  8008ff:	a8 04                	test   $0x4,%al
+  800901:	74 14                	je     800917 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800903:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800907:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80090c:	5b                   	pop    %rbx
+  80090d:	41 5c                	pop    %r12
+  80090f:	5d                   	pop    %rbp
+  800910:	c3                   	ret
+        return -E_INVAL;
+  800911:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800916:	c3                   	ret
+        return -E_INVAL;
+  800917:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80091c:	eb ee                	jmp    80090c <fd_lookup+0x39>
+
+000000000080091e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80091e:	55                   	push   %rbp
+  80091f:	48 89 e5             	mov    %rsp,%rbp
+  800922:	41 54                	push   %r12
+  800924:	53                   	push   %rbx
+  800925:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800928:	48 b8 00 2c 80 00 00 	movabs $0x802c00,%rax
+  80092f:	00 00 00 
+  800932:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  800939:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80093c:	39 3b                	cmp    %edi,(%rbx)
+  80093e:	74 47                	je     800987 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800940:	48 83 c0 08          	add    $0x8,%rax
+  800944:	48 8b 18             	mov    (%rax),%rbx
+  800947:	48 85 db             	test   %rbx,%rbx
+  80094a:	75 f0                	jne    80093c <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80094c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800953:	00 00 00 
+  800956:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80095c:	89 fa                	mov    %edi,%edx
+  80095e:	48 bf 80 2b 80 00 00 	movabs $0x802b80,%rdi
+  800965:	00 00 00 
+  800968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096d:	48 b9 68 1c 80 00 00 	movabs $0x801c68,%rcx
+  800974:	00 00 00 
+  800977:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800979:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80097e:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800982:	5b                   	pop    %rbx
+  800983:	41 5c                	pop    %r12
+  800985:	5d                   	pop    %rbp
+  800986:	c3                   	ret
+            return 0;
+  800987:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098c:	eb f0                	jmp    80097e <dev_lookup+0x60>
+
+000000000080098e <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80098e:	55                   	push   %rbp
+  80098f:	48 89 e5             	mov    %rsp,%rbp
+  800992:	41 55                	push   %r13
+  800994:	41 54                	push   %r12
+  800996:	53                   	push   %rbx
+  800997:	48 83 ec 18          	sub    $0x18,%rsp
+  80099b:	48 89 fb             	mov    %rdi,%rbx
+  80099e:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8009a1:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8009a8:	ff ff ff 
+  8009ab:	48 01 df             	add    %rbx,%rdi
+  8009ae:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8009b2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009b6:	48 b8 d3 08 80 00 00 	movabs $0x8008d3,%rax
+  8009bd:	00 00 00 
+  8009c0:	ff d0                	call   *%rax
+  8009c2:	41 89 c5             	mov    %eax,%r13d
+  8009c5:	85 c0                	test   %eax,%eax
+  8009c7:	78 06                	js     8009cf <fd_close+0x41>
+  8009c9:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8009cd:	74 1a                	je     8009e9 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8009cf:	45 84 e4             	test   %r12b,%r12b
+  8009d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d7:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8009db:	44 89 e8             	mov    %r13d,%eax
+  8009de:	48 83 c4 18          	add    $0x18,%rsp
+  8009e2:	5b                   	pop    %rbx
+  8009e3:	41 5c                	pop    %r12
+  8009e5:	41 5d                	pop    %r13
+  8009e7:	5d                   	pop    %rbp
+  8009e8:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8009e9:	8b 3b                	mov    (%rbx),%edi
+  8009eb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8009ef:	48 b8 1e 09 80 00 00 	movabs $0x80091e,%rax
+  8009f6:	00 00 00 
+  8009f9:	ff d0                	call   *%rax
+  8009fb:	41 89 c5             	mov    %eax,%r13d
+  8009fe:	85 c0                	test   %eax,%eax
+  800a00:	78 1b                	js     800a1d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800a02:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a06:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800a0a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800a10:	48 85 c0             	test   %rax,%rax
+  800a13:	74 08                	je     800a1d <fd_close+0x8f>
+  800a15:	48 89 df             	mov    %rbx,%rdi
+  800a18:	ff d0                	call   *%rax
+  800a1a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800a1d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a22:	48 89 de             	mov    %rbx,%rsi
+  800a25:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a2a:	48 b8 6f 03 80 00 00 	movabs $0x80036f,%rax
+  800a31:	00 00 00 
+  800a34:	ff d0                	call   *%rax
+    return res;
+  800a36:	eb a3                	jmp    8009db <fd_close+0x4d>
+
+0000000000800a38 <close>:
+
+int
+close(int fdnum) {
+  800a38:	55                   	push   %rbp
+  800a39:	48 89 e5             	mov    %rsp,%rbp
+  800a3c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800a40:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800a44:	48 b8 d3 08 80 00 00 	movabs $0x8008d3,%rax
+  800a4b:	00 00 00 
+  800a4e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800a50:	85 c0                	test   %eax,%eax
+  800a52:	78 15                	js     800a69 <close+0x31>
+
+    return fd_close(fd, 1);
+  800a54:	be 01 00 00 00       	mov    $0x1,%esi
+  800a59:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800a5d:	48 b8 8e 09 80 00 00 	movabs $0x80098e,%rax
+  800a64:	00 00 00 
+  800a67:	ff d0                	call   *%rax
+}
+  800a69:	c9                   	leave
+  800a6a:	c3                   	ret
+
+0000000000800a6b <close_all>:
+
+void
+close_all(void) {
+  800a6b:	55                   	push   %rbp
+  800a6c:	48 89 e5             	mov    %rsp,%rbp
+  800a6f:	41 54                	push   %r12
+  800a71:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800a72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a77:	49 bc 38 0a 80 00 00 	movabs $0x800a38,%r12
+  800a7e:	00 00 00 
+  800a81:	89 df                	mov    %ebx,%edi
+  800a83:	41 ff d4             	call   *%r12
+  800a86:	83 c3 01             	add    $0x1,%ebx
+  800a89:	83 fb 20             	cmp    $0x20,%ebx
+  800a8c:	75 f3                	jne    800a81 <close_all+0x16>
+}
+  800a8e:	5b                   	pop    %rbx
+  800a8f:	41 5c                	pop    %r12
+  800a91:	5d                   	pop    %rbp
+  800a92:	c3                   	ret
+
+0000000000800a93 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800a93:	55                   	push   %rbp
+  800a94:	48 89 e5             	mov    %rsp,%rbp
+  800a97:	41 57                	push   %r15
+  800a99:	41 56                	push   %r14
+  800a9b:	41 55                	push   %r13
+  800a9d:	41 54                	push   %r12
+  800a9f:	53                   	push   %rbx
+  800aa0:	48 83 ec 18          	sub    $0x18,%rsp
+  800aa4:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800aa7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800aab:	48 b8 d3 08 80 00 00 	movabs $0x8008d3,%rax
+  800ab2:	00 00 00 
+  800ab5:	ff d0                	call   *%rax
+  800ab7:	89 c3                	mov    %eax,%ebx
+  800ab9:	85 c0                	test   %eax,%eax
+  800abb:	0f 88 b8 00 00 00    	js     800b79 <dup+0xe6>
+    close(newfdnum);
+  800ac1:	44 89 e7             	mov    %r12d,%edi
+  800ac4:	48 b8 38 0a 80 00 00 	movabs $0x800a38,%rax
+  800acb:	00 00 00 
+  800ace:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800ad0:	4d 63 ec             	movslq %r12d,%r13
+  800ad3:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800ada:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800ade:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800ae2:	4c 89 ff             	mov    %r15,%rdi
+  800ae5:	49 be 57 08 80 00 00 	movabs $0x800857,%r14
+  800aec:	00 00 00 
+  800aef:	41 ff d6             	call   *%r14
+  800af2:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800af5:	4c 89 ef             	mov    %r13,%rdi
+  800af8:	41 ff d6             	call   *%r14
+  800afb:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800afe:	48 89 df             	mov    %rbx,%rdi
+  800b01:	48 b8 f1 17 80 00 00 	movabs $0x8017f1,%rax
+  800b08:	00 00 00 
+  800b0b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800b0d:	a8 04                	test   $0x4,%al
+  800b0f:	74 2b                	je     800b3c <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800b11:	41 89 c1             	mov    %eax,%r9d
+  800b14:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800b1a:	4c 89 f1             	mov    %r14,%rcx
+  800b1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b22:	48 89 de             	mov    %rbx,%rsi
+  800b25:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b2a:	48 b8 0a 03 80 00 00 	movabs $0x80030a,%rax
+  800b31:	00 00 00 
+  800b34:	ff d0                	call   *%rax
+  800b36:	89 c3                	mov    %eax,%ebx
+  800b38:	85 c0                	test   %eax,%eax
+  800b3a:	78 4e                	js     800b8a <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800b3c:	4c 89 ff             	mov    %r15,%rdi
+  800b3f:	48 b8 f1 17 80 00 00 	movabs $0x8017f1,%rax
+  800b46:	00 00 00 
+  800b49:	ff d0                	call   *%rax
+  800b4b:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800b4e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800b54:	4c 89 e9             	mov    %r13,%rcx
+  800b57:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b5c:	4c 89 fe             	mov    %r15,%rsi
+  800b5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b64:	48 b8 0a 03 80 00 00 	movabs $0x80030a,%rax
+  800b6b:	00 00 00 
+  800b6e:	ff d0                	call   *%rax
+  800b70:	89 c3                	mov    %eax,%ebx
+  800b72:	85 c0                	test   %eax,%eax
+  800b74:	78 14                	js     800b8a <dup+0xf7>
+
+    return newfdnum;
+  800b76:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800b79:	89 d8                	mov    %ebx,%eax
+  800b7b:	48 83 c4 18          	add    $0x18,%rsp
+  800b7f:	5b                   	pop    %rbx
+  800b80:	41 5c                	pop    %r12
+  800b82:	41 5d                	pop    %r13
+  800b84:	41 5e                	pop    %r14
+  800b86:	41 5f                	pop    %r15
+  800b88:	5d                   	pop    %rbp
+  800b89:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800b8a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b8f:	4c 89 ee             	mov    %r13,%rsi
+  800b92:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b97:	49 bc 6f 03 80 00 00 	movabs $0x80036f,%r12
+  800b9e:	00 00 00 
+  800ba1:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800ba4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ba9:	4c 89 f6             	mov    %r14,%rsi
+  800bac:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bb1:	41 ff d4             	call   *%r12
+    return res;
+  800bb4:	eb c3                	jmp    800b79 <dup+0xe6>
+
+0000000000800bb6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800bb6:	55                   	push   %rbp
+  800bb7:	48 89 e5             	mov    %rsp,%rbp
+  800bba:	41 56                	push   %r14
+  800bbc:	41 55                	push   %r13
+  800bbe:	41 54                	push   %r12
+  800bc0:	53                   	push   %rbx
+  800bc1:	48 83 ec 10          	sub    $0x10,%rsp
+  800bc5:	89 fb                	mov    %edi,%ebx
+  800bc7:	49 89 f4             	mov    %rsi,%r12
+  800bca:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bcd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bd1:	48 b8 d3 08 80 00 00 	movabs $0x8008d3,%rax
+  800bd8:	00 00 00 
+  800bdb:	ff d0                	call   *%rax
+  800bdd:	85 c0                	test   %eax,%eax
+  800bdf:	78 4c                	js     800c2d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800be1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800be5:	41 8b 3e             	mov    (%r14),%edi
+  800be8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bec:	48 b8 1e 09 80 00 00 	movabs $0x80091e,%rax
+  800bf3:	00 00 00 
+  800bf6:	ff d0                	call   *%rax
+  800bf8:	85 c0                	test   %eax,%eax
+  800bfa:	78 35                	js     800c31 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800bfc:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800c00:	83 e0 03             	and    $0x3,%eax
+  800c03:	83 f8 01             	cmp    $0x1,%eax
+  800c06:	74 2d                	je     800c35 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800c08:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c0c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800c10:	48 85 c0             	test   %rax,%rax
+  800c13:	74 56                	je     800c6b <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800c15:	4c 89 ea             	mov    %r13,%rdx
+  800c18:	4c 89 e6             	mov    %r12,%rsi
+  800c1b:	4c 89 f7             	mov    %r14,%rdi
+  800c1e:	ff d0                	call   *%rax
+}
+  800c20:	48 83 c4 10          	add    $0x10,%rsp
+  800c24:	5b                   	pop    %rbx
+  800c25:	41 5c                	pop    %r12
+  800c27:	41 5d                	pop    %r13
+  800c29:	41 5e                	pop    %r14
+  800c2b:	5d                   	pop    %rbp
+  800c2c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c2d:	48 98                	cltq
+  800c2f:	eb ef                	jmp    800c20 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c31:	48 98                	cltq
+  800c33:	eb eb                	jmp    800c20 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c35:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c3c:	00 00 00 
+  800c3f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c45:	89 da                	mov    %ebx,%edx
+  800c47:	48 bf c1 2b 80 00 00 	movabs $0x802bc1,%rdi
+  800c4e:	00 00 00 
+  800c51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c56:	48 b9 68 1c 80 00 00 	movabs $0x801c68,%rcx
+  800c5d:	00 00 00 
+  800c60:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c62:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c69:	eb b5                	jmp    800c20 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800c6b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c72:	eb ac                	jmp    800c20 <read+0x6a>
+
+0000000000800c74 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800c74:	55                   	push   %rbp
+  800c75:	48 89 e5             	mov    %rsp,%rbp
+  800c78:	41 57                	push   %r15
+  800c7a:	41 56                	push   %r14
+  800c7c:	41 55                	push   %r13
+  800c7e:	41 54                	push   %r12
+  800c80:	53                   	push   %rbx
+  800c81:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800c85:	48 85 d2             	test   %rdx,%rdx
+  800c88:	74 54                	je     800cde <readn+0x6a>
+  800c8a:	41 89 fd             	mov    %edi,%r13d
+  800c8d:	49 89 f6             	mov    %rsi,%r14
+  800c90:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800c93:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800c98:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800c9d:	49 bf b6 0b 80 00 00 	movabs $0x800bb6,%r15
+  800ca4:	00 00 00 
+  800ca7:	4c 89 e2             	mov    %r12,%rdx
+  800caa:	48 29 f2             	sub    %rsi,%rdx
+  800cad:	4c 01 f6             	add    %r14,%rsi
+  800cb0:	44 89 ef             	mov    %r13d,%edi
+  800cb3:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800cb6:	85 c0                	test   %eax,%eax
+  800cb8:	78 20                	js     800cda <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800cba:	01 c3                	add    %eax,%ebx
+  800cbc:	85 c0                	test   %eax,%eax
+  800cbe:	74 08                	je     800cc8 <readn+0x54>
+  800cc0:	48 63 f3             	movslq %ebx,%rsi
+  800cc3:	4c 39 e6             	cmp    %r12,%rsi
+  800cc6:	72 df                	jb     800ca7 <readn+0x33>
+    }
+    return res;
+  800cc8:	48 63 c3             	movslq %ebx,%rax
+}
+  800ccb:	48 83 c4 08          	add    $0x8,%rsp
+  800ccf:	5b                   	pop    %rbx
+  800cd0:	41 5c                	pop    %r12
+  800cd2:	41 5d                	pop    %r13
+  800cd4:	41 5e                	pop    %r14
+  800cd6:	41 5f                	pop    %r15
+  800cd8:	5d                   	pop    %rbp
+  800cd9:	c3                   	ret
+        if (inc < 0) return inc;
+  800cda:	48 98                	cltq
+  800cdc:	eb ed                	jmp    800ccb <readn+0x57>
+    int inc = 1, res = 0;
+  800cde:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce3:	eb e3                	jmp    800cc8 <readn+0x54>
+
+0000000000800ce5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800ce5:	55                   	push   %rbp
+  800ce6:	48 89 e5             	mov    %rsp,%rbp
+  800ce9:	41 56                	push   %r14
+  800ceb:	41 55                	push   %r13
+  800ced:	41 54                	push   %r12
+  800cef:	53                   	push   %rbx
+  800cf0:	48 83 ec 10          	sub    $0x10,%rsp
+  800cf4:	89 fb                	mov    %edi,%ebx
+  800cf6:	49 89 f4             	mov    %rsi,%r12
+  800cf9:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cfc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800d00:	48 b8 d3 08 80 00 00 	movabs $0x8008d3,%rax
+  800d07:	00 00 00 
+  800d0a:	ff d0                	call   *%rax
+  800d0c:	85 c0                	test   %eax,%eax
+  800d0e:	78 47                	js     800d57 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d10:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800d14:	41 8b 3e             	mov    (%r14),%edi
+  800d17:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800d1b:	48 b8 1e 09 80 00 00 	movabs $0x80091e,%rax
+  800d22:	00 00 00 
+  800d25:	ff d0                	call   *%rax
+  800d27:	85 c0                	test   %eax,%eax
+  800d29:	78 30                	js     800d5b <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d2b:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800d30:	74 2d                	je     800d5f <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d32:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d36:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800d3a:	48 85 c0             	test   %rax,%rax
+  800d3d:	74 56                	je     800d95 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800d3f:	4c 89 ea             	mov    %r13,%rdx
+  800d42:	4c 89 e6             	mov    %r12,%rsi
+  800d45:	4c 89 f7             	mov    %r14,%rdi
+  800d48:	ff d0                	call   *%rax
+}
+  800d4a:	48 83 c4 10          	add    $0x10,%rsp
+  800d4e:	5b                   	pop    %rbx
+  800d4f:	41 5c                	pop    %r12
+  800d51:	41 5d                	pop    %r13
+  800d53:	41 5e                	pop    %r14
+  800d55:	5d                   	pop    %rbp
+  800d56:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d57:	48 98                	cltq
+  800d59:	eb ef                	jmp    800d4a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d5b:	48 98                	cltq
+  800d5d:	eb eb                	jmp    800d4a <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800d5f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d66:	00 00 00 
+  800d69:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800d6f:	89 da                	mov    %ebx,%edx
+  800d71:	48 bf dd 2b 80 00 00 	movabs $0x802bdd,%rdi
+  800d78:	00 00 00 
+  800d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d80:	48 b9 68 1c 80 00 00 	movabs $0x801c68,%rcx
+  800d87:	00 00 00 
+  800d8a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d8c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800d93:	eb b5                	jmp    800d4a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d95:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800d9c:	eb ac                	jmp    800d4a <write+0x65>
+
+0000000000800d9e <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800d9e:	55                   	push   %rbp
+  800d9f:	48 89 e5             	mov    %rsp,%rbp
+  800da2:	53                   	push   %rbx
+  800da3:	48 83 ec 18          	sub    $0x18,%rsp
+  800da7:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800da9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800dad:	48 b8 d3 08 80 00 00 	movabs $0x8008d3,%rax
+  800db4:	00 00 00 
+  800db7:	ff d0                	call   *%rax
+  800db9:	85 c0                	test   %eax,%eax
+  800dbb:	78 0c                	js     800dc9 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800dbd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dc1:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dc9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800dcd:	c9                   	leave
+  800dce:	c3                   	ret
+
+0000000000800dcf <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800dcf:	55                   	push   %rbp
+  800dd0:	48 89 e5             	mov    %rsp,%rbp
+  800dd3:	41 55                	push   %r13
+  800dd5:	41 54                	push   %r12
+  800dd7:	53                   	push   %rbx
+  800dd8:	48 83 ec 18          	sub    $0x18,%rsp
+  800ddc:	89 fb                	mov    %edi,%ebx
+  800dde:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800de1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800de5:	48 b8 d3 08 80 00 00 	movabs $0x8008d3,%rax
+  800dec:	00 00 00 
+  800def:	ff d0                	call   *%rax
+  800df1:	85 c0                	test   %eax,%eax
+  800df3:	78 38                	js     800e2d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800df5:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800df9:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800dfd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e01:	48 b8 1e 09 80 00 00 	movabs $0x80091e,%rax
+  800e08:	00 00 00 
+  800e0b:	ff d0                	call   *%rax
+  800e0d:	85 c0                	test   %eax,%eax
+  800e0f:	78 1c                	js     800e2d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800e11:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800e16:	74 20                	je     800e38 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800e18:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e1c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800e20:	48 85 c0             	test   %rax,%rax
+  800e23:	74 47                	je     800e6c <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800e25:	44 89 e6             	mov    %r12d,%esi
+  800e28:	4c 89 ef             	mov    %r13,%rdi
+  800e2b:	ff d0                	call   *%rax
+}
+  800e2d:	48 83 c4 18          	add    $0x18,%rsp
+  800e31:	5b                   	pop    %rbx
+  800e32:	41 5c                	pop    %r12
+  800e34:	41 5d                	pop    %r13
+  800e36:	5d                   	pop    %rbp
+  800e37:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800e38:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800e3f:	00 00 00 
+  800e42:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800e48:	89 da                	mov    %ebx,%edx
+  800e4a:	48 bf a0 2b 80 00 00 	movabs $0x802ba0,%rdi
+  800e51:	00 00 00 
+  800e54:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e59:	48 b9 68 1c 80 00 00 	movabs $0x801c68,%rcx
+  800e60:	00 00 00 
+  800e63:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e6a:	eb c1                	jmp    800e2d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800e6c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e71:	eb ba                	jmp    800e2d <ftruncate+0x5e>
+
+0000000000800e73 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800e73:	55                   	push   %rbp
+  800e74:	48 89 e5             	mov    %rsp,%rbp
+  800e77:	41 54                	push   %r12
+  800e79:	53                   	push   %rbx
+  800e7a:	48 83 ec 10          	sub    $0x10,%rsp
+  800e7e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e81:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e85:	48 b8 d3 08 80 00 00 	movabs $0x8008d3,%rax
+  800e8c:	00 00 00 
+  800e8f:	ff d0                	call   *%rax
+  800e91:	85 c0                	test   %eax,%eax
+  800e93:	78 4e                	js     800ee3 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e95:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800e99:	41 8b 3c 24          	mov    (%r12),%edi
+  800e9d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800ea1:	48 b8 1e 09 80 00 00 	movabs $0x80091e,%rax
+  800ea8:	00 00 00 
+  800eab:	ff d0                	call   *%rax
+  800ead:	85 c0                	test   %eax,%eax
+  800eaf:	78 32                	js     800ee3 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800eb1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800eb5:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800eba:	74 30                	je     800eec <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800ebc:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800ebf:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800ec6:	00 00 00 
+    stat->st_isdir = 0;
+  800ec9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800ed0:	00 00 00 
+    stat->st_dev = dev;
+  800ed3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800eda:	48 89 de             	mov    %rbx,%rsi
+  800edd:	4c 89 e7             	mov    %r12,%rdi
+  800ee0:	ff 50 28             	call   *0x28(%rax)
+}
+  800ee3:	48 83 c4 10          	add    $0x10,%rsp
+  800ee7:	5b                   	pop    %rbx
+  800ee8:	41 5c                	pop    %r12
+  800eea:	5d                   	pop    %rbp
+  800eeb:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800eec:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ef1:	eb f0                	jmp    800ee3 <fstat+0x70>
+
+0000000000800ef3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800ef3:	55                   	push   %rbp
+  800ef4:	48 89 e5             	mov    %rsp,%rbp
+  800ef7:	41 54                	push   %r12
+  800ef9:	53                   	push   %rbx
+  800efa:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800efd:	be 00 00 00 00       	mov    $0x0,%esi
+  800f02:	48 b8 74 11 80 00 00 	movabs $0x801174,%rax
+  800f09:	00 00 00 
+  800f0c:	ff d0                	call   *%rax
+  800f0e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800f10:	85 c0                	test   %eax,%eax
+  800f12:	78 25                	js     800f39 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800f14:	4c 89 e6             	mov    %r12,%rsi
+  800f17:	89 c7                	mov    %eax,%edi
+  800f19:	48 b8 73 0e 80 00 00 	movabs $0x800e73,%rax
+  800f20:	00 00 00 
+  800f23:	ff d0                	call   *%rax
+  800f25:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800f28:	89 df                	mov    %ebx,%edi
+  800f2a:	48 b8 38 0a 80 00 00 	movabs $0x800a38,%rax
+  800f31:	00 00 00 
+  800f34:	ff d0                	call   *%rax
+
+    return res;
+  800f36:	44 89 e3             	mov    %r12d,%ebx
+}
+  800f39:	89 d8                	mov    %ebx,%eax
+  800f3b:	5b                   	pop    %rbx
+  800f3c:	41 5c                	pop    %r12
+  800f3e:	5d                   	pop    %rbp
+  800f3f:	c3                   	ret
+
+0000000000800f40 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800f40:	55                   	push   %rbp
+  800f41:	48 89 e5             	mov    %rsp,%rbp
+  800f44:	41 54                	push   %r12
+  800f46:	53                   	push   %rbx
+  800f47:	48 83 ec 10          	sub    $0x10,%rsp
+  800f4b:	41 89 fc             	mov    %edi,%r12d
+  800f4e:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f51:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f58:	00 00 00 
+  800f5b:	83 38 00             	cmpl   $0x0,(%rax)
+  800f5e:	74 5e                	je     800fbe <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800f60:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800f66:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800f6b:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800f72:	00 00 00 
+  800f75:	44 89 e6             	mov    %r12d,%esi
+  800f78:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f7f:	00 00 00 
+  800f82:	8b 38                	mov    (%rax),%edi
+  800f84:	48 b8 49 2a 80 00 00 	movabs $0x802a49,%rax
+  800f8b:	00 00 00 
+  800f8e:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800f90:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800f97:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800f98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f9d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800fa1:	48 89 de             	mov    %rbx,%rsi
+  800fa4:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fa9:	48 b8 b4 29 80 00 00 	movabs $0x8029b4,%rax
+  800fb0:	00 00 00 
+  800fb3:	ff d0                	call   *%rax
+}
+  800fb5:	48 83 c4 10          	add    $0x10,%rsp
+  800fb9:	5b                   	pop    %rbx
+  800fba:	41 5c                	pop    %r12
+  800fbc:	5d                   	pop    %rbp
+  800fbd:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800fbe:	bf 03 00 00 00       	mov    $0x3,%edi
+  800fc3:	48 b8 e9 2a 80 00 00 	movabs $0x802ae9,%rax
+  800fca:	00 00 00 
+  800fcd:	ff d0                	call   *%rax
+  800fcf:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800fd6:	00 00 
+  800fd8:	eb 86                	jmp    800f60 <fsipc+0x20>
+
+0000000000800fda <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800fda:	55                   	push   %rbp
+  800fdb:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800fde:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800fe5:	00 00 00 
+  800fe8:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800feb:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800fed:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800ff0:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff5:	bf 02 00 00 00       	mov    $0x2,%edi
+  800ffa:	48 b8 40 0f 80 00 00 	movabs $0x800f40,%rax
+  801001:	00 00 00 
+  801004:	ff d0                	call   *%rax
+}
+  801006:	5d                   	pop    %rbp
+  801007:	c3                   	ret
+
+0000000000801008 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801008:	55                   	push   %rbp
+  801009:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80100c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80100f:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801016:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801018:	be 00 00 00 00       	mov    $0x0,%esi
+  80101d:	bf 06 00 00 00       	mov    $0x6,%edi
+  801022:	48 b8 40 0f 80 00 00 	movabs $0x800f40,%rax
+  801029:	00 00 00 
+  80102c:	ff d0                	call   *%rax
+}
+  80102e:	5d                   	pop    %rbp
+  80102f:	c3                   	ret
+
+0000000000801030 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801030:	55                   	push   %rbp
+  801031:	48 89 e5             	mov    %rsp,%rbp
+  801034:	41 54                	push   %r12
+  801036:	53                   	push   %rbx
+  801037:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80103a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80103d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801044:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801046:	be 00 00 00 00       	mov    $0x0,%esi
+  80104b:	bf 05 00 00 00       	mov    $0x5,%edi
+  801050:	48 b8 40 0f 80 00 00 	movabs $0x800f40,%rax
+  801057:	00 00 00 
+  80105a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80105c:	85 c0                	test   %eax,%eax
+  80105e:	78 3d                	js     80109d <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801060:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801067:	00 00 00 
+  80106a:	4c 89 e6             	mov    %r12,%rsi
+  80106d:	48 89 df             	mov    %rbx,%rdi
+  801070:	48 b8 8d 25 80 00 00 	movabs $0x80258d,%rax
+  801077:	00 00 00 
+  80107a:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80107c:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801083:	00 
+  801084:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80108a:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801091:	00 
+  801092:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801098:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80109d:	5b                   	pop    %rbx
+  80109e:	41 5c                	pop    %r12
+  8010a0:	5d                   	pop    %rbp
+  8010a1:	c3                   	ret
+
+00000000008010a2 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8010a2:	55                   	push   %rbp
+  8010a3:	48 89 e5             	mov    %rsp,%rbp
+  8010a6:	41 54                	push   %r12
+  8010a8:	53                   	push   %rbx
+  8010a9:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8010ac:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8010b1:	48 39 c2             	cmp    %rax,%rdx
+  8010b4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8010b8:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8010bb:	48 89 c2             	mov    %rax,%rdx
+  8010be:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8010c5:	00 00 00 
+  8010c8:	48 b8 ee 27 80 00 00 	movabs $0x8027ee,%rax
+  8010cf:	00 00 00 
+  8010d2:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8010d4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8010db:	00 00 00 
+  8010de:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8010e3:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8010e5:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8010e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ee:	bf 04 00 00 00       	mov    $0x4,%edi
+  8010f3:	48 b8 40 0f 80 00 00 	movabs $0x800f40,%rax
+  8010fa:	00 00 00 
+  8010fd:	ff d0                	call   *%rax
+  8010ff:	48 98                	cltq
+}
+  801101:	5b                   	pop    %rbx
+  801102:	41 5c                	pop    %r12
+  801104:	5d                   	pop    %rbp
+  801105:	c3                   	ret
+
+0000000000801106 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801106:	55                   	push   %rbp
+  801107:	48 89 e5             	mov    %rsp,%rbp
+  80110a:	41 54                	push   %r12
+  80110c:	53                   	push   %rbx
+  80110d:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801110:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801117:	00 00 00 
+  80111a:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80111d:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  80111f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801124:	48 39 ca             	cmp    %rcx,%rdx
+  801127:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  80112b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  80112f:	be 00 00 00 00       	mov    $0x0,%esi
+  801134:	bf 03 00 00 00       	mov    $0x3,%edi
+  801139:	48 b8 40 0f 80 00 00 	movabs $0x800f40,%rax
+  801140:	00 00 00 
+  801143:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  801145:	85 c0                	test   %eax,%eax
+  801147:	78 27                	js     801170 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  801149:	48 63 d8             	movslq %eax,%rbx
+  80114c:	48 89 da             	mov    %rbx,%rdx
+  80114f:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801156:	00 00 00 
+  801159:	4c 89 e7             	mov    %r12,%rdi
+  80115c:	48 b8 ee 27 80 00 00 	movabs $0x8027ee,%rax
+  801163:	00 00 00 
+  801166:	ff d0                	call   *%rax
+    return bytes_read;
+  801168:	48 89 d8             	mov    %rbx,%rax
+}
+  80116b:	5b                   	pop    %rbx
+  80116c:	41 5c                	pop    %r12
+  80116e:	5d                   	pop    %rbp
+  80116f:	c3                   	ret
+        return bytes_read;
+  801170:	48 98                	cltq
+  801172:	eb f7                	jmp    80116b <devfile_read+0x65>
+
+0000000000801174 <open>:
+open(const char *path, int mode) {
+  801174:	55                   	push   %rbp
+  801175:	48 89 e5             	mov    %rsp,%rbp
+  801178:	41 55                	push   %r13
+  80117a:	41 54                	push   %r12
+  80117c:	53                   	push   %rbx
+  80117d:	48 83 ec 18          	sub    $0x18,%rsp
+  801181:	49 89 fc             	mov    %rdi,%r12
+  801184:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801187:	48 b8 4f 25 80 00 00 	movabs $0x80254f,%rax
+  80118e:	00 00 00 
+  801191:	ff d0                	call   *%rax
+  801193:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801199:	0f 87 8a 00 00 00    	ja     801229 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80119f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8011a3:	48 b8 73 08 80 00 00 	movabs $0x800873,%rax
+  8011aa:	00 00 00 
+  8011ad:	ff d0                	call   *%rax
+  8011af:	89 c3                	mov    %eax,%ebx
+  8011b1:	85 c0                	test   %eax,%eax
+  8011b3:	78 50                	js     801205 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8011b5:	4c 89 e6             	mov    %r12,%rsi
+  8011b8:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8011bf:	00 00 00 
+  8011c2:	48 89 df             	mov    %rbx,%rdi
+  8011c5:	48 b8 8d 25 80 00 00 	movabs $0x80258d,%rax
+  8011cc:	00 00 00 
+  8011cf:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011d1:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011d8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8011dc:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011e1:	48 b8 40 0f 80 00 00 	movabs $0x800f40,%rax
+  8011e8:	00 00 00 
+  8011eb:	ff d0                	call   *%rax
+  8011ed:	89 c3                	mov    %eax,%ebx
+  8011ef:	85 c0                	test   %eax,%eax
+  8011f1:	78 1f                	js     801212 <open+0x9e>
+    return fd2num(fd);
+  8011f3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8011f7:	48 b8 45 08 80 00 00 	movabs $0x800845,%rax
+  8011fe:	00 00 00 
+  801201:	ff d0                	call   *%rax
+  801203:	89 c3                	mov    %eax,%ebx
+}
+  801205:	89 d8                	mov    %ebx,%eax
+  801207:	48 83 c4 18          	add    $0x18,%rsp
+  80120b:	5b                   	pop    %rbx
+  80120c:	41 5c                	pop    %r12
+  80120e:	41 5d                	pop    %r13
+  801210:	5d                   	pop    %rbp
+  801211:	c3                   	ret
+        fd_close(fd, 0);
+  801212:	be 00 00 00 00       	mov    $0x0,%esi
+  801217:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80121b:	48 b8 8e 09 80 00 00 	movabs $0x80098e,%rax
+  801222:	00 00 00 
+  801225:	ff d0                	call   *%rax
+        return res;
+  801227:	eb dc                	jmp    801205 <open+0x91>
+        return -E_BAD_PATH;
+  801229:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80122e:	eb d5                	jmp    801205 <open+0x91>
+
+0000000000801230 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801230:	55                   	push   %rbp
+  801231:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801234:	be 00 00 00 00       	mov    $0x0,%esi
+  801239:	bf 08 00 00 00       	mov    $0x8,%edi
+  80123e:	48 b8 40 0f 80 00 00 	movabs $0x800f40,%rax
+  801245:	00 00 00 
+  801248:	ff d0                	call   *%rax
+}
+  80124a:	5d                   	pop    %rbp
+  80124b:	c3                   	ret
+
+000000000080124c <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80124c:	55                   	push   %rbp
+  80124d:	48 89 e5             	mov    %rsp,%rbp
+  801250:	41 54                	push   %r12
+  801252:	53                   	push   %rbx
+  801253:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801256:	48 b8 57 08 80 00 00 	movabs $0x800857,%rax
+  80125d:	00 00 00 
+  801260:	ff d0                	call   *%rax
+  801262:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801265:	48 be 20 2c 80 00 00 	movabs $0x802c20,%rsi
+  80126c:	00 00 00 
+  80126f:	48 89 df             	mov    %rbx,%rdi
+  801272:	48 b8 8d 25 80 00 00 	movabs $0x80258d,%rax
+  801279:	00 00 00 
+  80127c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80127e:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801283:	41 2b 04 24          	sub    (%r12),%eax
+  801287:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80128d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801294:	00 00 00 
+    stat->st_dev = &devpipe;
+  801297:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80129e:	00 00 00 
+  8012a1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8012a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ad:	5b                   	pop    %rbx
+  8012ae:	41 5c                	pop    %r12
+  8012b0:	5d                   	pop    %rbp
+  8012b1:	c3                   	ret
+
+00000000008012b2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8012b2:	55                   	push   %rbp
+  8012b3:	48 89 e5             	mov    %rsp,%rbp
+  8012b6:	41 54                	push   %r12
+  8012b8:	53                   	push   %rbx
+  8012b9:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8012bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012c1:	48 89 fe             	mov    %rdi,%rsi
+  8012c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012c9:	49 bc 6f 03 80 00 00 	movabs $0x80036f,%r12
+  8012d0:	00 00 00 
+  8012d3:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012d6:	48 89 df             	mov    %rbx,%rdi
+  8012d9:	48 b8 57 08 80 00 00 	movabs $0x800857,%rax
+  8012e0:	00 00 00 
+  8012e3:	ff d0                	call   *%rax
+  8012e5:	48 89 c6             	mov    %rax,%rsi
+  8012e8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012f2:	41 ff d4             	call   *%r12
+}
+  8012f5:	5b                   	pop    %rbx
+  8012f6:	41 5c                	pop    %r12
+  8012f8:	5d                   	pop    %rbp
+  8012f9:	c3                   	ret
+
+00000000008012fa <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8012fa:	55                   	push   %rbp
+  8012fb:	48 89 e5             	mov    %rsp,%rbp
+  8012fe:	41 57                	push   %r15
+  801300:	41 56                	push   %r14
+  801302:	41 55                	push   %r13
+  801304:	41 54                	push   %r12
+  801306:	53                   	push   %rbx
+  801307:	48 83 ec 18          	sub    $0x18,%rsp
+  80130b:	49 89 fc             	mov    %rdi,%r12
+  80130e:	49 89 f5             	mov    %rsi,%r13
+  801311:	49 89 d7             	mov    %rdx,%r15
+  801314:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801318:	48 b8 57 08 80 00 00 	movabs $0x800857,%rax
+  80131f:	00 00 00 
+  801322:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801324:	4d 85 ff             	test   %r15,%r15
+  801327:	0f 84 af 00 00 00    	je     8013dc <devpipe_write+0xe2>
+  80132d:	48 89 c3             	mov    %rax,%rbx
+  801330:	4c 89 f8             	mov    %r15,%rax
+  801333:	4d 89 ef             	mov    %r13,%r15
+  801336:	4c 01 e8             	add    %r13,%rax
+  801339:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80133d:	49 bd 77 02 80 00 00 	movabs $0x800277,%r13
+  801344:	00 00 00 
+            sys_yield();
+  801347:	49 be 14 02 80 00 00 	movabs $0x800214,%r14
+  80134e:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801351:	8b 73 04             	mov    0x4(%rbx),%esi
+  801354:	48 63 ce             	movslq %esi,%rcx
+  801357:	48 63 03             	movslq (%rbx),%rax
+  80135a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801360:	48 39 c1             	cmp    %rax,%rcx
+  801363:	72 2e                	jb     801393 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801365:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80136a:	48 89 da             	mov    %rbx,%rdx
+  80136d:	be 00 10 00 00       	mov    $0x1000,%esi
+  801372:	4c 89 e7             	mov    %r12,%rdi
+  801375:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801378:	85 c0                	test   %eax,%eax
+  80137a:	74 66                	je     8013e2 <devpipe_write+0xe8>
+            sys_yield();
+  80137c:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80137f:	8b 73 04             	mov    0x4(%rbx),%esi
+  801382:	48 63 ce             	movslq %esi,%rcx
+  801385:	48 63 03             	movslq (%rbx),%rax
+  801388:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80138e:	48 39 c1             	cmp    %rax,%rcx
+  801391:	73 d2                	jae    801365 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801393:	41 0f b6 3f          	movzbl (%r15),%edi
+  801397:	48 89 ca             	mov    %rcx,%rdx
+  80139a:	48 c1 ea 03          	shr    $0x3,%rdx
+  80139e:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8013a5:	08 10 20 
+  8013a8:	48 f7 e2             	mul    %rdx
+  8013ab:	48 c1 ea 06          	shr    $0x6,%rdx
+  8013af:	48 89 d0             	mov    %rdx,%rax
+  8013b2:	48 c1 e0 09          	shl    $0x9,%rax
+  8013b6:	48 29 d0             	sub    %rdx,%rax
+  8013b9:	48 c1 e0 03          	shl    $0x3,%rax
+  8013bd:	48 29 c1             	sub    %rax,%rcx
+  8013c0:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013c5:	83 c6 01             	add    $0x1,%esi
+  8013c8:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013cb:	49 83 c7 01          	add    $0x1,%r15
+  8013cf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013d3:	49 39 c7             	cmp    %rax,%r15
+  8013d6:	0f 85 75 ff ff ff    	jne    801351 <devpipe_write+0x57>
+    return n;
+  8013dc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8013e0:	eb 05                	jmp    8013e7 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8013e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013e7:	48 83 c4 18          	add    $0x18,%rsp
+  8013eb:	5b                   	pop    %rbx
+  8013ec:	41 5c                	pop    %r12
+  8013ee:	41 5d                	pop    %r13
+  8013f0:	41 5e                	pop    %r14
+  8013f2:	41 5f                	pop    %r15
+  8013f4:	5d                   	pop    %rbp
+  8013f5:	c3                   	ret
+
+00000000008013f6 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8013f6:	55                   	push   %rbp
+  8013f7:	48 89 e5             	mov    %rsp,%rbp
+  8013fa:	41 57                	push   %r15
+  8013fc:	41 56                	push   %r14
+  8013fe:	41 55                	push   %r13
+  801400:	41 54                	push   %r12
+  801402:	53                   	push   %rbx
+  801403:	48 83 ec 18          	sub    $0x18,%rsp
+  801407:	49 89 fc             	mov    %rdi,%r12
+  80140a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80140e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801412:	48 b8 57 08 80 00 00 	movabs $0x800857,%rax
+  801419:	00 00 00 
+  80141c:	ff d0                	call   *%rax
+  80141e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801421:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801427:	49 bd 77 02 80 00 00 	movabs $0x800277,%r13
+  80142e:	00 00 00 
+            sys_yield();
+  801431:	49 be 14 02 80 00 00 	movabs $0x800214,%r14
+  801438:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80143b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801440:	74 7d                	je     8014bf <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801442:	8b 03                	mov    (%rbx),%eax
+  801444:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801447:	75 26                	jne    80146f <devpipe_read+0x79>
+            if (i > 0) return i;
+  801449:	4d 85 ff             	test   %r15,%r15
+  80144c:	75 77                	jne    8014c5 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80144e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801453:	48 89 da             	mov    %rbx,%rdx
+  801456:	be 00 10 00 00       	mov    $0x1000,%esi
+  80145b:	4c 89 e7             	mov    %r12,%rdi
+  80145e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801461:	85 c0                	test   %eax,%eax
+  801463:	74 72                	je     8014d7 <devpipe_read+0xe1>
+            sys_yield();
+  801465:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801468:	8b 03                	mov    (%rbx),%eax
+  80146a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80146d:	74 df                	je     80144e <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80146f:	48 63 c8             	movslq %eax,%rcx
+  801472:	48 89 ca             	mov    %rcx,%rdx
+  801475:	48 c1 ea 03          	shr    $0x3,%rdx
+  801479:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801480:	08 10 20 
+  801483:	48 89 d0             	mov    %rdx,%rax
+  801486:	48 f7 e6             	mul    %rsi
+  801489:	48 c1 ea 06          	shr    $0x6,%rdx
+  80148d:	48 89 d0             	mov    %rdx,%rax
+  801490:	48 c1 e0 09          	shl    $0x9,%rax
+  801494:	48 29 d0             	sub    %rdx,%rax
+  801497:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80149e:	00 
+  80149f:	48 89 c8             	mov    %rcx,%rax
+  8014a2:	48 29 d0             	sub    %rdx,%rax
+  8014a5:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8014aa:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8014ae:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8014b2:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8014b5:	49 83 c7 01          	add    $0x1,%r15
+  8014b9:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8014bd:	75 83                	jne    801442 <devpipe_read+0x4c>
+    return n;
+  8014bf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014c3:	eb 03                	jmp    8014c8 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014c5:	4c 89 f8             	mov    %r15,%rax
+}
+  8014c8:	48 83 c4 18          	add    $0x18,%rsp
+  8014cc:	5b                   	pop    %rbx
+  8014cd:	41 5c                	pop    %r12
+  8014cf:	41 5d                	pop    %r13
+  8014d1:	41 5e                	pop    %r14
+  8014d3:	41 5f                	pop    %r15
+  8014d5:	5d                   	pop    %rbp
+  8014d6:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014dc:	eb ea                	jmp    8014c8 <devpipe_read+0xd2>
+
+00000000008014de <pipe>:
+pipe(int pfd[2]) {
+  8014de:	55                   	push   %rbp
+  8014df:	48 89 e5             	mov    %rsp,%rbp
+  8014e2:	41 55                	push   %r13
+  8014e4:	41 54                	push   %r12
+  8014e6:	53                   	push   %rbx
+  8014e7:	48 83 ec 18          	sub    $0x18,%rsp
+  8014eb:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8014ee:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8014f2:	48 b8 73 08 80 00 00 	movabs $0x800873,%rax
+  8014f9:	00 00 00 
+  8014fc:	ff d0                	call   *%rax
+  8014fe:	89 c3                	mov    %eax,%ebx
+  801500:	85 c0                	test   %eax,%eax
+  801502:	0f 88 a0 01 00 00    	js     8016a8 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  801508:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80150d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801512:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801516:	bf 00 00 00 00       	mov    $0x0,%edi
+  80151b:	48 b8 a3 02 80 00 00 	movabs $0x8002a3,%rax
+  801522:	00 00 00 
+  801525:	ff d0                	call   *%rax
+  801527:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801529:	85 c0                	test   %eax,%eax
+  80152b:	0f 88 77 01 00 00    	js     8016a8 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801531:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801535:	48 b8 73 08 80 00 00 	movabs $0x800873,%rax
+  80153c:	00 00 00 
+  80153f:	ff d0                	call   *%rax
+  801541:	89 c3                	mov    %eax,%ebx
+  801543:	85 c0                	test   %eax,%eax
+  801545:	0f 88 43 01 00 00    	js     80168e <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80154b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801550:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801555:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801559:	bf 00 00 00 00       	mov    $0x0,%edi
+  80155e:	48 b8 a3 02 80 00 00 	movabs $0x8002a3,%rax
+  801565:	00 00 00 
+  801568:	ff d0                	call   *%rax
+  80156a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80156c:	85 c0                	test   %eax,%eax
+  80156e:	0f 88 1a 01 00 00    	js     80168e <pipe+0x1b0>
+    va = fd2data(fd0);
+  801574:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801578:	48 b8 57 08 80 00 00 	movabs $0x800857,%rax
+  80157f:	00 00 00 
+  801582:	ff d0                	call   *%rax
+  801584:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801587:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80158c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801591:	48 89 c6             	mov    %rax,%rsi
+  801594:	bf 00 00 00 00       	mov    $0x0,%edi
+  801599:	48 b8 a3 02 80 00 00 	movabs $0x8002a3,%rax
+  8015a0:	00 00 00 
+  8015a3:	ff d0                	call   *%rax
+  8015a5:	89 c3                	mov    %eax,%ebx
+  8015a7:	85 c0                	test   %eax,%eax
+  8015a9:	0f 88 c5 00 00 00    	js     801674 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8015af:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8015b3:	48 b8 57 08 80 00 00 	movabs $0x800857,%rax
+  8015ba:	00 00 00 
+  8015bd:	ff d0                	call   *%rax
+  8015bf:	48 89 c1             	mov    %rax,%rcx
+  8015c2:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8015c8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8015ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015d3:	4c 89 ee             	mov    %r13,%rsi
+  8015d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015db:	48 b8 0a 03 80 00 00 	movabs $0x80030a,%rax
+  8015e2:	00 00 00 
+  8015e5:	ff d0                	call   *%rax
+  8015e7:	89 c3                	mov    %eax,%ebx
+  8015e9:	85 c0                	test   %eax,%eax
+  8015eb:	78 6e                	js     80165b <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8015ed:	be 00 10 00 00       	mov    $0x1000,%esi
+  8015f2:	4c 89 ef             	mov    %r13,%rdi
+  8015f5:	48 b8 45 02 80 00 00 	movabs $0x800245,%rax
+  8015fc:	00 00 00 
+  8015ff:	ff d0                	call   *%rax
+  801601:	83 f8 02             	cmp    $0x2,%eax
+  801604:	0f 85 ab 00 00 00    	jne    8016b5 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80160a:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  801611:	00 00 
+  801613:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801617:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801619:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80161d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801624:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801628:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80162a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80162e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801635:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801639:	48 bb 45 08 80 00 00 	movabs $0x800845,%rbx
+  801640:	00 00 00 
+  801643:	ff d3                	call   *%rbx
+  801645:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801649:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80164d:	ff d3                	call   *%rbx
+  80164f:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  801654:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801659:	eb 4d                	jmp    8016a8 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80165b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801660:	4c 89 ee             	mov    %r13,%rsi
+  801663:	bf 00 00 00 00       	mov    $0x0,%edi
+  801668:	48 b8 6f 03 80 00 00 	movabs $0x80036f,%rax
+  80166f:	00 00 00 
+  801672:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  801674:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801679:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80167d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801682:	48 b8 6f 03 80 00 00 	movabs $0x80036f,%rax
+  801689:	00 00 00 
+  80168c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80168e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801693:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801697:	bf 00 00 00 00       	mov    $0x0,%edi
+  80169c:	48 b8 6f 03 80 00 00 	movabs $0x80036f,%rax
+  8016a3:	00 00 00 
+  8016a6:	ff d0                	call   *%rax
+}
+  8016a8:	89 d8                	mov    %ebx,%eax
+  8016aa:	48 83 c4 18          	add    $0x18,%rsp
+  8016ae:	5b                   	pop    %rbx
+  8016af:	41 5c                	pop    %r12
+  8016b1:	41 5d                	pop    %r13
+  8016b3:	5d                   	pop    %rbp
+  8016b4:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8016b5:	48 b9 50 2c 80 00 00 	movabs $0x802c50,%rcx
+  8016bc:	00 00 00 
+  8016bf:	48 ba 27 2c 80 00 00 	movabs $0x802c27,%rdx
+  8016c6:	00 00 00 
+  8016c9:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8016ce:	48 bf 3c 2c 80 00 00 	movabs $0x802c3c,%rdi
+  8016d5:	00 00 00 
+  8016d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016dd:	49 b8 18 1b 80 00 00 	movabs $0x801b18,%r8
+  8016e4:	00 00 00 
+  8016e7:	41 ff d0             	call   *%r8
+
+00000000008016ea <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8016ea:	55                   	push   %rbp
+  8016eb:	48 89 e5             	mov    %rsp,%rbp
+  8016ee:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8016f2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8016f6:	48 b8 d3 08 80 00 00 	movabs $0x8008d3,%rax
+  8016fd:	00 00 00 
+  801700:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801702:	85 c0                	test   %eax,%eax
+  801704:	78 35                	js     80173b <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  801706:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80170a:	48 b8 57 08 80 00 00 	movabs $0x800857,%rax
+  801711:	00 00 00 
+  801714:	ff d0                	call   *%rax
+  801716:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801719:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80171e:	be 00 10 00 00       	mov    $0x1000,%esi
+  801723:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801727:	48 b8 77 02 80 00 00 	movabs $0x800277,%rax
+  80172e:	00 00 00 
+  801731:	ff d0                	call   *%rax
+  801733:	85 c0                	test   %eax,%eax
+  801735:	0f 94 c0             	sete   %al
+  801738:	0f b6 c0             	movzbl %al,%eax
+}
+  80173b:	c9                   	leave
+  80173c:	c3                   	ret
+
+000000000080173d <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80173d:	48 89 f8             	mov    %rdi,%rax
+  801740:	48 c1 e8 27          	shr    $0x27,%rax
+  801744:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80174b:	01 00 00 
+  80174e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801752:	f6 c2 01             	test   $0x1,%dl
+  801755:	74 6d                	je     8017c4 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801757:	48 89 f8             	mov    %rdi,%rax
+  80175a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80175e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801765:	01 00 00 
+  801768:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80176c:	f6 c2 01             	test   $0x1,%dl
+  80176f:	74 62                	je     8017d3 <get_uvpt_entry+0x96>
+  801771:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801778:	01 00 00 
+  80177b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80177f:	f6 c2 80             	test   $0x80,%dl
+  801782:	75 4f                	jne    8017d3 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801784:	48 89 f8             	mov    %rdi,%rax
+  801787:	48 c1 e8 15          	shr    $0x15,%rax
+  80178b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801792:	01 00 00 
+  801795:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801799:	f6 c2 01             	test   $0x1,%dl
+  80179c:	74 44                	je     8017e2 <get_uvpt_entry+0xa5>
+  80179e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017a5:	01 00 00 
+  8017a8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017ac:	f6 c2 80             	test   $0x80,%dl
+  8017af:	75 31                	jne    8017e2 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8017b1:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8017b5:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8017bc:	01 00 00 
+  8017bf:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8017c3:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017c4:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017cb:	01 00 00 
+  8017ce:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017d2:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017d3:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017da:	01 00 00 
+  8017dd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017e1:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017e2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017e9:	01 00 00 
+  8017ec:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017f0:	c3                   	ret
+
+00000000008017f1 <get_prot>:
+
+int
+get_prot(void *va) {
+  8017f1:	55                   	push   %rbp
+  8017f2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8017f5:	48 b8 3d 17 80 00 00 	movabs $0x80173d,%rax
+  8017fc:	00 00 00 
+  8017ff:	ff d0                	call   *%rax
+  801801:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  801804:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  801809:	89 c1                	mov    %eax,%ecx
+  80180b:	83 c9 04             	or     $0x4,%ecx
+  80180e:	f6 c2 01             	test   $0x1,%dl
+  801811:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  801814:	89 c1                	mov    %eax,%ecx
+  801816:	83 c9 02             	or     $0x2,%ecx
+  801819:	f6 c2 02             	test   $0x2,%dl
+  80181c:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80181f:	89 c1                	mov    %eax,%ecx
+  801821:	83 c9 01             	or     $0x1,%ecx
+  801824:	48 85 d2             	test   %rdx,%rdx
+  801827:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80182a:	89 c1                	mov    %eax,%ecx
+  80182c:	83 c9 40             	or     $0x40,%ecx
+  80182f:	f6 c6 04             	test   $0x4,%dh
+  801832:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  801835:	5d                   	pop    %rbp
+  801836:	c3                   	ret
+
+0000000000801837 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  801837:	55                   	push   %rbp
+  801838:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80183b:	48 b8 3d 17 80 00 00 	movabs $0x80173d,%rax
+  801842:	00 00 00 
+  801845:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  801847:	48 c1 e8 06          	shr    $0x6,%rax
+  80184b:	83 e0 01             	and    $0x1,%eax
+}
+  80184e:	5d                   	pop    %rbp
+  80184f:	c3                   	ret
+
+0000000000801850 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  801850:	55                   	push   %rbp
+  801851:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  801854:	48 b8 3d 17 80 00 00 	movabs $0x80173d,%rax
+  80185b:	00 00 00 
+  80185e:	ff d0                	call   *%rax
+  801860:	83 e0 01             	and    $0x1,%eax
+}
+  801863:	5d                   	pop    %rbp
+  801864:	c3                   	ret
+
+0000000000801865 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  801865:	55                   	push   %rbp
+  801866:	48 89 e5             	mov    %rsp,%rbp
+  801869:	41 57                	push   %r15
+  80186b:	41 56                	push   %r14
+  80186d:	41 55                	push   %r13
+  80186f:	41 54                	push   %r12
+  801871:	53                   	push   %rbx
+  801872:	48 83 ec 18          	sub    $0x18,%rsp
+  801876:	49 89 ff             	mov    %rdi,%r15
+  801879:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80187d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  801882:	49 bc 50 18 80 00 00 	movabs $0x801850,%r12
+  801889:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  80188c:	49 be f1 17 80 00 00 	movabs $0x8017f1,%r14
+  801893:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  801896:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  80189d:	00 00 00 
+  8018a0:	eb 0c                	jmp    8018ae <foreach_shared_region+0x49>
+  8018a2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018a9:	4c 39 eb             	cmp    %r13,%rbx
+  8018ac:	74 38                	je     8018e6 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  8018ae:	48 89 df             	mov    %rbx,%rdi
+  8018b1:	41 ff d4             	call   *%r12
+  8018b4:	84 c0                	test   %al,%al
+  8018b6:	74 ea                	je     8018a2 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  8018b8:	48 89 df             	mov    %rbx,%rdi
+  8018bb:	41 ff d6             	call   *%r14
+  8018be:	a8 40                	test   $0x40,%al
+  8018c0:	74 e0                	je     8018a2 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8018c2:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8018c9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8018cd:	48 89 df             	mov    %rbx,%rdi
+  8018d0:	41 ff d7             	call   *%r15
+        if (err)
+  8018d3:	85 c0                	test   %eax,%eax
+  8018d5:	74 cb                	je     8018a2 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8018d7:	48 83 c4 18          	add    $0x18,%rsp
+  8018db:	5b                   	pop    %rbx
+  8018dc:	41 5c                	pop    %r12
+  8018de:	41 5d                	pop    %r13
+  8018e0:	41 5e                	pop    %r14
+  8018e2:	41 5f                	pop    %r15
+  8018e4:	5d                   	pop    %rbp
+  8018e5:	c3                   	ret
+    return 0;
+  8018e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018eb:	eb ea                	jmp    8018d7 <foreach_shared_region+0x72>
+
+00000000008018ed <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8018ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f2:	c3                   	ret
+
+00000000008018f3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8018f3:	55                   	push   %rbp
+  8018f4:	48 89 e5             	mov    %rsp,%rbp
+  8018f7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8018fa:	48 be 74 2c 80 00 00 	movabs $0x802c74,%rsi
+  801901:	00 00 00 
+  801904:	48 b8 8d 25 80 00 00 	movabs $0x80258d,%rax
+  80190b:	00 00 00 
+  80190e:	ff d0                	call   *%rax
+    return 0;
+}
+  801910:	b8 00 00 00 00       	mov    $0x0,%eax
+  801915:	5d                   	pop    %rbp
+  801916:	c3                   	ret
+
+0000000000801917 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801917:	55                   	push   %rbp
+  801918:	48 89 e5             	mov    %rsp,%rbp
+  80191b:	41 57                	push   %r15
+  80191d:	41 56                	push   %r14
+  80191f:	41 55                	push   %r13
+  801921:	41 54                	push   %r12
+  801923:	53                   	push   %rbx
+  801924:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80192b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801932:	48 85 d2             	test   %rdx,%rdx
+  801935:	74 7a                	je     8019b1 <devcons_write+0x9a>
+  801937:	49 89 d6             	mov    %rdx,%r14
+  80193a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801940:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801945:	49 bf 87 27 80 00 00 	movabs $0x802787,%r15
+  80194c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80194f:	4c 89 f3             	mov    %r14,%rbx
+  801952:	48 29 f3             	sub    %rsi,%rbx
+  801955:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80195a:	48 39 c3             	cmp    %rax,%rbx
+  80195d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801961:	4c 63 eb             	movslq %ebx,%r13
+  801964:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80196b:	48 01 c6             	add    %rax,%rsi
+  80196e:	4c 89 ea             	mov    %r13,%rdx
+  801971:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801978:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80197b:	4c 89 ee             	mov    %r13,%rsi
+  80197e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801985:	48 b8 1a 01 80 00 00 	movabs $0x80011a,%rax
+  80198c:	00 00 00 
+  80198f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801991:	41 01 dc             	add    %ebx,%r12d
+  801994:	49 63 f4             	movslq %r12d,%rsi
+  801997:	4c 39 f6             	cmp    %r14,%rsi
+  80199a:	72 b3                	jb     80194f <devcons_write+0x38>
+    return res;
+  80199c:	49 63 c4             	movslq %r12d,%rax
+}
+  80199f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8019a6:	5b                   	pop    %rbx
+  8019a7:	41 5c                	pop    %r12
+  8019a9:	41 5d                	pop    %r13
+  8019ab:	41 5e                	pop    %r14
+  8019ad:	41 5f                	pop    %r15
+  8019af:	5d                   	pop    %rbp
+  8019b0:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8019b1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8019b7:	eb e3                	jmp    80199c <devcons_write+0x85>
+
+00000000008019b9 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8019b9:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8019bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019c1:	48 85 c0             	test   %rax,%rax
+  8019c4:	74 55                	je     801a1b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8019c6:	55                   	push   %rbp
+  8019c7:	48 89 e5             	mov    %rsp,%rbp
+  8019ca:	41 55                	push   %r13
+  8019cc:	41 54                	push   %r12
+  8019ce:	53                   	push   %rbx
+  8019cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8019d3:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8019d6:	48 bb 47 01 80 00 00 	movabs $0x800147,%rbx
+  8019dd:	00 00 00 
+  8019e0:	49 bc 14 02 80 00 00 	movabs $0x800214,%r12
+  8019e7:	00 00 00 
+  8019ea:	eb 03                	jmp    8019ef <devcons_read+0x36>
+  8019ec:	41 ff d4             	call   *%r12
+  8019ef:	ff d3                	call   *%rbx
+  8019f1:	85 c0                	test   %eax,%eax
+  8019f3:	74 f7                	je     8019ec <devcons_read+0x33>
+    if (c < 0) return c;
+  8019f5:	48 63 d0             	movslq %eax,%rdx
+  8019f8:	78 13                	js     801a0d <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8019fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ff:	83 f8 04             	cmp    $0x4,%eax
+  801a02:	74 09                	je     801a0d <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801a04:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801a08:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801a0d:	48 89 d0             	mov    %rdx,%rax
+  801a10:	48 83 c4 08          	add    $0x8,%rsp
+  801a14:	5b                   	pop    %rbx
+  801a15:	41 5c                	pop    %r12
+  801a17:	41 5d                	pop    %r13
+  801a19:	5d                   	pop    %rbp
+  801a1a:	c3                   	ret
+  801a1b:	48 89 d0             	mov    %rdx,%rax
+  801a1e:	c3                   	ret
+
+0000000000801a1f <cputchar>:
+cputchar(int ch) {
+  801a1f:	55                   	push   %rbp
+  801a20:	48 89 e5             	mov    %rsp,%rbp
+  801a23:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801a27:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801a2b:	be 01 00 00 00       	mov    $0x1,%esi
+  801a30:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801a34:	48 b8 1a 01 80 00 00 	movabs $0x80011a,%rax
+  801a3b:	00 00 00 
+  801a3e:	ff d0                	call   *%rax
+}
+  801a40:	c9                   	leave
+  801a41:	c3                   	ret
+
+0000000000801a42 <getchar>:
+getchar(void) {
+  801a42:	55                   	push   %rbp
+  801a43:	48 89 e5             	mov    %rsp,%rbp
+  801a46:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801a4a:	ba 01 00 00 00       	mov    $0x1,%edx
+  801a4f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801a53:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a58:	48 b8 b6 0b 80 00 00 	movabs $0x800bb6,%rax
+  801a5f:	00 00 00 
+  801a62:	ff d0                	call   *%rax
+  801a64:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801a66:	85 c0                	test   %eax,%eax
+  801a68:	78 06                	js     801a70 <getchar+0x2e>
+  801a6a:	74 08                	je     801a74 <getchar+0x32>
+  801a6c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801a70:	89 d0                	mov    %edx,%eax
+  801a72:	c9                   	leave
+  801a73:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801a74:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801a79:	eb f5                	jmp    801a70 <getchar+0x2e>
+
+0000000000801a7b <iscons>:
+iscons(int fdnum) {
+  801a7b:	55                   	push   %rbp
+  801a7c:	48 89 e5             	mov    %rsp,%rbp
+  801a7f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801a83:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a87:	48 b8 d3 08 80 00 00 	movabs $0x8008d3,%rax
+  801a8e:	00 00 00 
+  801a91:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a93:	85 c0                	test   %eax,%eax
+  801a95:	78 18                	js     801aaf <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801a97:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a9b:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801aa2:	00 00 00 
+  801aa5:	8b 00                	mov    (%rax),%eax
+  801aa7:	39 02                	cmp    %eax,(%rdx)
+  801aa9:	0f 94 c0             	sete   %al
+  801aac:	0f b6 c0             	movzbl %al,%eax
+}
+  801aaf:	c9                   	leave
+  801ab0:	c3                   	ret
+
+0000000000801ab1 <opencons>:
+opencons(void) {
+  801ab1:	55                   	push   %rbp
+  801ab2:	48 89 e5             	mov    %rsp,%rbp
+  801ab5:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801ab9:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801abd:	48 b8 73 08 80 00 00 	movabs $0x800873,%rax
+  801ac4:	00 00 00 
+  801ac7:	ff d0                	call   *%rax
+  801ac9:	85 c0                	test   %eax,%eax
+  801acb:	78 49                	js     801b16 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801acd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ad2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ad7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801adb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ae0:	48 b8 a3 02 80 00 00 	movabs $0x8002a3,%rax
+  801ae7:	00 00 00 
+  801aea:	ff d0                	call   *%rax
+  801aec:	85 c0                	test   %eax,%eax
+  801aee:	78 26                	js     801b16 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801af0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801af4:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801afb:	00 00 
+  801afd:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801aff:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b03:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801b0a:	48 b8 45 08 80 00 00 	movabs $0x800845,%rax
+  801b11:	00 00 00 
+  801b14:	ff d0                	call   *%rax
+}
+  801b16:	c9                   	leave
+  801b17:	c3                   	ret
+
+0000000000801b18 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801b18:	55                   	push   %rbp
+  801b19:	48 89 e5             	mov    %rsp,%rbp
+  801b1c:	41 56                	push   %r14
+  801b1e:	41 55                	push   %r13
+  801b20:	41 54                	push   %r12
+  801b22:	53                   	push   %rbx
+  801b23:	48 83 ec 50          	sub    $0x50,%rsp
+  801b27:	49 89 fc             	mov    %rdi,%r12
+  801b2a:	41 89 f5             	mov    %esi,%r13d
+  801b2d:	48 89 d3             	mov    %rdx,%rbx
+  801b30:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b34:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801b38:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801b3c:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801b43:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b47:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801b4b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801b4f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801b53:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801b5a:	00 00 00 
+  801b5d:	4c 8b 30             	mov    (%rax),%r14
+  801b60:	48 b8 e3 01 80 00 00 	movabs $0x8001e3,%rax
+  801b67:	00 00 00 
+  801b6a:	ff d0                	call   *%rax
+  801b6c:	89 c6                	mov    %eax,%esi
+  801b6e:	45 89 e8             	mov    %r13d,%r8d
+  801b71:	4c 89 e1             	mov    %r12,%rcx
+  801b74:	4c 89 f2             	mov    %r14,%rdx
+  801b77:	48 bf 80 2c 80 00 00 	movabs $0x802c80,%rdi
+  801b7e:	00 00 00 
+  801b81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b86:	49 bc 68 1c 80 00 00 	movabs $0x801c68,%r12
+  801b8d:	00 00 00 
+  801b90:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801b93:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801b97:	48 89 df             	mov    %rbx,%rdi
+  801b9a:	48 b8 04 1c 80 00 00 	movabs $0x801c04,%rax
+  801ba1:	00 00 00 
+  801ba4:	ff d0                	call   *%rax
+    cprintf("\n");
+  801ba6:	48 bf db 2b 80 00 00 	movabs $0x802bdb,%rdi
+  801bad:	00 00 00 
+  801bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb5:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801bb8:	cc                   	int3
+  801bb9:	eb fd                	jmp    801bb8 <_panic+0xa0>
+
+0000000000801bbb <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801bbb:	55                   	push   %rbp
+  801bbc:	48 89 e5             	mov    %rsp,%rbp
+  801bbf:	53                   	push   %rbx
+  801bc0:	48 83 ec 08          	sub    $0x8,%rsp
+  801bc4:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801bc7:	8b 06                	mov    (%rsi),%eax
+  801bc9:	8d 50 01             	lea    0x1(%rax),%edx
+  801bcc:	89 16                	mov    %edx,(%rsi)
+  801bce:	48 98                	cltq
+  801bd0:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801bd5:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801bdb:	74 0a                	je     801be7 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801bdd:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801be1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801be5:	c9                   	leave
+  801be6:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801be7:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801beb:	be ff 00 00 00       	mov    $0xff,%esi
+  801bf0:	48 b8 1a 01 80 00 00 	movabs $0x80011a,%rax
+  801bf7:	00 00 00 
+  801bfa:	ff d0                	call   *%rax
+        state->offset = 0;
+  801bfc:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801c02:	eb d9                	jmp    801bdd <putch+0x22>
+
+0000000000801c04 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801c04:	55                   	push   %rbp
+  801c05:	48 89 e5             	mov    %rsp,%rbp
+  801c08:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801c0f:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801c12:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801c19:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c23:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801c26:	48 89 f1             	mov    %rsi,%rcx
+  801c29:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801c30:	48 bf bb 1b 80 00 00 	movabs $0x801bbb,%rdi
+  801c37:	00 00 00 
+  801c3a:	48 b8 b8 1d 80 00 00 	movabs $0x801db8,%rax
+  801c41:	00 00 00 
+  801c44:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801c46:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801c4d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801c54:	48 b8 1a 01 80 00 00 	movabs $0x80011a,%rax
+  801c5b:	00 00 00 
+  801c5e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801c60:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801c66:	c9                   	leave
+  801c67:	c3                   	ret
+
+0000000000801c68 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801c68:	55                   	push   %rbp
+  801c69:	48 89 e5             	mov    %rsp,%rbp
+  801c6c:	48 83 ec 50          	sub    $0x50,%rsp
+  801c70:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801c74:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801c78:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c7c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801c80:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801c84:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801c8b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c93:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801c97:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801c9b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801c9f:	48 b8 04 1c 80 00 00 	movabs $0x801c04,%rax
+  801ca6:	00 00 00 
+  801ca9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801cab:	c9                   	leave
+  801cac:	c3                   	ret
+
+0000000000801cad <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801cad:	55                   	push   %rbp
+  801cae:	48 89 e5             	mov    %rsp,%rbp
+  801cb1:	41 57                	push   %r15
+  801cb3:	41 56                	push   %r14
+  801cb5:	41 55                	push   %r13
+  801cb7:	41 54                	push   %r12
+  801cb9:	53                   	push   %rbx
+  801cba:	48 83 ec 18          	sub    $0x18,%rsp
+  801cbe:	49 89 fc             	mov    %rdi,%r12
+  801cc1:	49 89 f5             	mov    %rsi,%r13
+  801cc4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cc8:	8b 45 10             	mov    0x10(%rbp),%eax
+  801ccb:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801cce:	41 89 cf             	mov    %ecx,%r15d
+  801cd1:	4c 39 fa             	cmp    %r15,%rdx
+  801cd4:	73 5b                	jae    801d31 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801cd6:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801cda:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801cde:	85 db                	test   %ebx,%ebx
+  801ce0:	7e 0e                	jle    801cf0 <print_num+0x43>
+            putch(padc, put_arg);
+  801ce2:	4c 89 ee             	mov    %r13,%rsi
+  801ce5:	44 89 f7             	mov    %r14d,%edi
+  801ce8:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801ceb:	83 eb 01             	sub    $0x1,%ebx
+  801cee:	75 f2                	jne    801ce2 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801cf0:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801cf4:	48 b9 b4 2c 80 00 00 	movabs $0x802cb4,%rcx
+  801cfb:	00 00 00 
+  801cfe:	48 b8 a3 2c 80 00 00 	movabs $0x802ca3,%rax
+  801d05:	00 00 00 
+  801d08:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801d0c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d10:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d15:	49 f7 f7             	div    %r15
+  801d18:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801d1c:	4c 89 ee             	mov    %r13,%rsi
+  801d1f:	41 ff d4             	call   *%r12
+}
+  801d22:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801d26:	5b                   	pop    %rbx
+  801d27:	41 5c                	pop    %r12
+  801d29:	41 5d                	pop    %r13
+  801d2b:	41 5e                	pop    %r14
+  801d2d:	41 5f                	pop    %r15
+  801d2f:	5d                   	pop    %rbp
+  801d30:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801d31:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d35:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d3a:	49 f7 f7             	div    %r15
+  801d3d:	48 83 ec 08          	sub    $0x8,%rsp
+  801d41:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801d45:	52                   	push   %rdx
+  801d46:	45 0f be c9          	movsbl %r9b,%r9d
+  801d4a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801d4e:	48 89 c2             	mov    %rax,%rdx
+  801d51:	48 b8 ad 1c 80 00 00 	movabs $0x801cad,%rax
+  801d58:	00 00 00 
+  801d5b:	ff d0                	call   *%rax
+  801d5d:	48 83 c4 10          	add    $0x10,%rsp
+  801d61:	eb 8d                	jmp    801cf0 <print_num+0x43>
+
+0000000000801d63 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801d63:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801d67:	48 8b 06             	mov    (%rsi),%rax
+  801d6a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801d6e:	73 0a                	jae    801d7a <sprintputch+0x17>
+        *state->start++ = ch;
+  801d70:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d74:	48 89 16             	mov    %rdx,(%rsi)
+  801d77:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801d7a:	c3                   	ret
+
+0000000000801d7b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801d7b:	55                   	push   %rbp
+  801d7c:	48 89 e5             	mov    %rsp,%rbp
+  801d7f:	48 83 ec 50          	sub    $0x50,%rsp
+  801d83:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d87:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d8b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801d8f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801d96:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d9e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801da2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801da6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801daa:	48 b8 b8 1d 80 00 00 	movabs $0x801db8,%rax
+  801db1:	00 00 00 
+  801db4:	ff d0                	call   *%rax
+}
+  801db6:	c9                   	leave
+  801db7:	c3                   	ret
+
+0000000000801db8 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801db8:	55                   	push   %rbp
+  801db9:	48 89 e5             	mov    %rsp,%rbp
+  801dbc:	41 57                	push   %r15
+  801dbe:	41 56                	push   %r14
+  801dc0:	41 55                	push   %r13
+  801dc2:	41 54                	push   %r12
+  801dc4:	53                   	push   %rbx
+  801dc5:	48 83 ec 38          	sub    $0x38,%rsp
+  801dc9:	49 89 fe             	mov    %rdi,%r14
+  801dcc:	49 89 f5             	mov    %rsi,%r13
+  801dcf:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801dd2:	48 8b 01             	mov    (%rcx),%rax
+  801dd5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801dd9:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801ddd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801de1:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801de5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801de9:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801ded:	0f b6 3b             	movzbl (%rbx),%edi
+  801df0:	40 80 ff 25          	cmp    $0x25,%dil
+  801df4:	74 18                	je     801e0e <vprintfmt+0x56>
+            if (!ch) return;
+  801df6:	40 84 ff             	test   %dil,%dil
+  801df9:	0f 84 b1 06 00 00    	je     8024b0 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801dff:	40 0f b6 ff          	movzbl %dil,%edi
+  801e03:	4c 89 ee             	mov    %r13,%rsi
+  801e06:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801e09:	4c 89 e3             	mov    %r12,%rbx
+  801e0c:	eb db                	jmp    801de9 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801e0e:	be 00 00 00 00       	mov    $0x0,%esi
+  801e13:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801e17:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801e1c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e22:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801e29:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e2d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801e32:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801e37:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801e3a:	83 e8 23             	sub    $0x23,%eax
+  801e3d:	3c 57                	cmp    $0x57,%al
+  801e3f:	0f 87 51 06 00 00    	ja     802496 <vprintfmt+0x6de>
+  801e45:	0f b6 c0             	movzbl %al,%eax
+  801e48:	48 b9 60 2e 80 00 00 	movabs $0x802e60,%rcx
+  801e4f:	00 00 00 
+  801e52:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801e55:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801e58:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801e5c:	eb cf                	jmp    801e2d <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801e5e:	49 89 dc             	mov    %rbx,%r12
+  801e61:	be 01 00 00 00       	mov    $0x1,%esi
+  801e66:	eb c5                	jmp    801e2d <vprintfmt+0x75>
+            padc = ch;
+  801e68:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801e6c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e6f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801e72:	eb b9                	jmp    801e2d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e77:	83 f8 2f             	cmp    $0x2f,%eax
+  801e7a:	77 24                	ja     801ea0 <vprintfmt+0xe8>
+  801e7c:	89 c1                	mov    %eax,%ecx
+  801e7e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801e82:	83 c0 08             	add    $0x8,%eax
+  801e85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e88:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801e8b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801e8e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801e92:	79 99                	jns    801e2d <vprintfmt+0x75>
+                width = precision;
+  801e94:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801e98:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e9e:	eb 8d                	jmp    801e2d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801ea0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801ea4:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801ea8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eac:	eb da                	jmp    801e88 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801eae:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801eb3:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801eb7:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801ebd:	3c 39                	cmp    $0x39,%al
+  801ebf:	77 1c                	ja     801edd <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801ec1:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801ec5:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801ec9:	0f b6 c0             	movzbl %al,%eax
+  801ecc:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801ed1:	0f b6 03             	movzbl (%rbx),%eax
+  801ed4:	3c 39                	cmp    $0x39,%al
+  801ed6:	76 e9                	jbe    801ec1 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801ed8:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801edb:	eb b1                	jmp    801e8e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801edd:	49 89 dc             	mov    %rbx,%r12
+  801ee0:	eb ac                	jmp    801e8e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801ee2:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801ee5:	85 c9                	test   %ecx,%ecx
+  801ee7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eec:	0f 49 c1             	cmovns %ecx,%eax
+  801eef:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801ef2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ef5:	e9 33 ff ff ff       	jmp    801e2d <vprintfmt+0x75>
+            lflag++;
+  801efa:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801efd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f00:	e9 28 ff ff ff       	jmp    801e2d <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801f05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f08:	83 f8 2f             	cmp    $0x2f,%eax
+  801f0b:	77 19                	ja     801f26 <vprintfmt+0x16e>
+  801f0d:	89 c2                	mov    %eax,%edx
+  801f0f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f13:	83 c0 08             	add    $0x8,%eax
+  801f16:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f19:	8b 3a                	mov    (%rdx),%edi
+  801f1b:	4c 89 ee             	mov    %r13,%rsi
+  801f1e:	41 ff d6             	call   *%r14
+            break;
+  801f21:	e9 c3 fe ff ff       	jmp    801de9 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  801f26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f32:	eb e5                	jmp    801f19 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  801f34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f37:	83 f8 2f             	cmp    $0x2f,%eax
+  801f3a:	77 5a                	ja     801f96 <vprintfmt+0x1de>
+  801f3c:	89 c2                	mov    %eax,%edx
+  801f3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f42:	83 c0 08             	add    $0x8,%eax
+  801f45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801f48:	8b 02                	mov    (%rdx),%eax
+  801f4a:	89 c1                	mov    %eax,%ecx
+  801f4c:	f7 d9                	neg    %ecx
+  801f4e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801f51:	83 f9 15             	cmp    $0x15,%ecx
+  801f54:	7f 4e                	jg     801fa4 <vprintfmt+0x1ec>
+  801f56:	48 63 c1             	movslq %ecx,%rax
+  801f59:	48 ba 20 31 80 00 00 	movabs $0x803120,%rdx
+  801f60:	00 00 00 
+  801f63:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801f67:	48 85 c0             	test   %rax,%rax
+  801f6a:	74 38                	je     801fa4 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801f6c:	48 89 c1             	mov    %rax,%rcx
+  801f6f:	48 ba 39 2c 80 00 00 	movabs $0x802c39,%rdx
+  801f76:	00 00 00 
+  801f79:	4c 89 ee             	mov    %r13,%rsi
+  801f7c:	4c 89 f7             	mov    %r14,%rdi
+  801f7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f84:	49 b8 7b 1d 80 00 00 	movabs $0x801d7b,%r8
+  801f8b:	00 00 00 
+  801f8e:	41 ff d0             	call   *%r8
+  801f91:	e9 53 fe ff ff       	jmp    801de9 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801f96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fa2:	eb a4                	jmp    801f48 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801fa4:	48 ba cc 2c 80 00 00 	movabs $0x802ccc,%rdx
+  801fab:	00 00 00 
+  801fae:	4c 89 ee             	mov    %r13,%rsi
+  801fb1:	4c 89 f7             	mov    %r14,%rdi
+  801fb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb9:	49 b8 7b 1d 80 00 00 	movabs $0x801d7b,%r8
+  801fc0:	00 00 00 
+  801fc3:	41 ff d0             	call   *%r8
+  801fc6:	e9 1e fe ff ff       	jmp    801de9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801fcb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fce:	83 f8 2f             	cmp    $0x2f,%eax
+  801fd1:	77 6c                	ja     80203f <vprintfmt+0x287>
+  801fd3:	89 c2                	mov    %eax,%edx
+  801fd5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fd9:	83 c0 08             	add    $0x8,%eax
+  801fdc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fdf:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801fe2:	48 85 d2             	test   %rdx,%rdx
+  801fe5:	48 b8 c5 2c 80 00 00 	movabs $0x802cc5,%rax
+  801fec:	00 00 00 
+  801fef:	48 0f 45 c2          	cmovne %rdx,%rax
+  801ff3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801ff7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801ffb:	7e 06                	jle    802003 <vprintfmt+0x24b>
+  801ffd:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802001:	75 4a                	jne    80204d <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802003:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802007:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80200b:	0f b6 00             	movzbl (%rax),%eax
+  80200e:	84 c0                	test   %al,%al
+  802010:	0f 85 9a 00 00 00    	jne    8020b0 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  802016:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802019:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80201d:	85 c0                	test   %eax,%eax
+  80201f:	0f 8e c4 fd ff ff    	jle    801de9 <vprintfmt+0x31>
+  802025:	4c 89 ee             	mov    %r13,%rsi
+  802028:	bf 20 00 00 00       	mov    $0x20,%edi
+  80202d:	41 ff d6             	call   *%r14
+  802030:	41 83 ec 01          	sub    $0x1,%r12d
+  802034:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802038:	75 eb                	jne    802025 <vprintfmt+0x26d>
+  80203a:	e9 aa fd ff ff       	jmp    801de9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80203f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802043:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802047:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80204b:	eb 92                	jmp    801fdf <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80204d:	49 63 f7             	movslq %r15d,%rsi
+  802050:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802054:	48 b8 6a 25 80 00 00 	movabs $0x80256a,%rax
+  80205b:	00 00 00 
+  80205e:	ff d0                	call   *%rax
+  802060:	48 89 c2             	mov    %rax,%rdx
+  802063:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802066:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802068:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80206b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80206e:	85 c0                	test   %eax,%eax
+  802070:	7e 91                	jle    802003 <vprintfmt+0x24b>
+  802072:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802077:	4c 89 ee             	mov    %r13,%rsi
+  80207a:	44 89 e7             	mov    %r12d,%edi
+  80207d:	41 ff d6             	call   *%r14
+  802080:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802084:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802087:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80208a:	75 eb                	jne    802077 <vprintfmt+0x2bf>
+  80208c:	e9 72 ff ff ff       	jmp    802003 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802091:	0f b6 f8             	movzbl %al,%edi
+  802094:	4c 89 ee             	mov    %r13,%rsi
+  802097:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80209a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80209e:	49 83 c4 01          	add    $0x1,%r12
+  8020a2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8020a8:	84 c0                	test   %al,%al
+  8020aa:	0f 84 66 ff ff ff    	je     802016 <vprintfmt+0x25e>
+  8020b0:	45 85 ff             	test   %r15d,%r15d
+  8020b3:	78 0a                	js     8020bf <vprintfmt+0x307>
+  8020b5:	41 83 ef 01          	sub    $0x1,%r15d
+  8020b9:	0f 88 57 ff ff ff    	js     802016 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8020bf:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8020c3:	74 cc                	je     802091 <vprintfmt+0x2d9>
+  8020c5:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8020c8:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8020cd:	80 fa 5e             	cmp    $0x5e,%dl
+  8020d0:	77 c2                	ja     802094 <vprintfmt+0x2dc>
+  8020d2:	eb bd                	jmp    802091 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8020d4:	40 84 f6             	test   %sil,%sil
+  8020d7:	75 26                	jne    8020ff <vprintfmt+0x347>
+    switch (lflag) {
+  8020d9:	85 d2                	test   %edx,%edx
+  8020db:	74 59                	je     802136 <vprintfmt+0x37e>
+  8020dd:	83 fa 01             	cmp    $0x1,%edx
+  8020e0:	74 7b                	je     80215d <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8020e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8020e8:	0f 87 96 00 00 00    	ja     802184 <vprintfmt+0x3cc>
+  8020ee:	89 c2                	mov    %eax,%edx
+  8020f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020f4:	83 c0 08             	add    $0x8,%eax
+  8020f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020fa:	4c 8b 22             	mov    (%rdx),%r12
+  8020fd:	eb 17                	jmp    802116 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8020ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802102:	83 f8 2f             	cmp    $0x2f,%eax
+  802105:	77 21                	ja     802128 <vprintfmt+0x370>
+  802107:	89 c2                	mov    %eax,%edx
+  802109:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80210d:	83 c0 08             	add    $0x8,%eax
+  802110:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802113:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802116:	4d 85 e4             	test   %r12,%r12
+  802119:	78 7a                	js     802195 <vprintfmt+0x3dd>
+            num = i;
+  80211b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80211e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802123:	e9 50 02 00 00       	jmp    802378 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802128:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80212c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802130:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802134:	eb dd                	jmp    802113 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802136:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802139:	83 f8 2f             	cmp    $0x2f,%eax
+  80213c:	77 11                	ja     80214f <vprintfmt+0x397>
+  80213e:	89 c2                	mov    %eax,%edx
+  802140:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802144:	83 c0 08             	add    $0x8,%eax
+  802147:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80214a:	4c 63 22             	movslq (%rdx),%r12
+  80214d:	eb c7                	jmp    802116 <vprintfmt+0x35e>
+  80214f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802153:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802157:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80215b:	eb ed                	jmp    80214a <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80215d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802160:	83 f8 2f             	cmp    $0x2f,%eax
+  802163:	77 11                	ja     802176 <vprintfmt+0x3be>
+  802165:	89 c2                	mov    %eax,%edx
+  802167:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80216b:	83 c0 08             	add    $0x8,%eax
+  80216e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802171:	4c 8b 22             	mov    (%rdx),%r12
+  802174:	eb a0                	jmp    802116 <vprintfmt+0x35e>
+  802176:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80217a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80217e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802182:	eb ed                	jmp    802171 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802184:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802188:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80218c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802190:	e9 65 ff ff ff       	jmp    8020fa <vprintfmt+0x342>
+                putch('-', put_arg);
+  802195:	4c 89 ee             	mov    %r13,%rsi
+  802198:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80219d:	41 ff d6             	call   *%r14
+                i = -i;
+  8021a0:	49 f7 dc             	neg    %r12
+  8021a3:	e9 73 ff ff ff       	jmp    80211b <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8021a8:	40 84 f6             	test   %sil,%sil
+  8021ab:	75 32                	jne    8021df <vprintfmt+0x427>
+    switch (lflag) {
+  8021ad:	85 d2                	test   %edx,%edx
+  8021af:	74 5d                	je     80220e <vprintfmt+0x456>
+  8021b1:	83 fa 01             	cmp    $0x1,%edx
+  8021b4:	0f 84 82 00 00 00    	je     80223c <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8021ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8021c0:	0f 87 a5 00 00 00    	ja     80226b <vprintfmt+0x4b3>
+  8021c6:	89 c2                	mov    %eax,%edx
+  8021c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021cc:	83 c0 08             	add    $0x8,%eax
+  8021cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021d2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021d5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8021da:	e9 99 01 00 00       	jmp    802378 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8021df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8021e5:	77 19                	ja     802200 <vprintfmt+0x448>
+  8021e7:	89 c2                	mov    %eax,%edx
+  8021e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021ed:	83 c0 08             	add    $0x8,%eax
+  8021f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021f3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8021fb:	e9 78 01 00 00       	jmp    802378 <vprintfmt+0x5c0>
+  802200:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802204:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802208:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80220c:	eb e5                	jmp    8021f3 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80220e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802211:	83 f8 2f             	cmp    $0x2f,%eax
+  802214:	77 18                	ja     80222e <vprintfmt+0x476>
+  802216:	89 c2                	mov    %eax,%edx
+  802218:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80221c:	83 c0 08             	add    $0x8,%eax
+  80221f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802222:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802224:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802229:	e9 4a 01 00 00       	jmp    802378 <vprintfmt+0x5c0>
+  80222e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802232:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802236:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80223a:	eb e6                	jmp    802222 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80223c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80223f:	83 f8 2f             	cmp    $0x2f,%eax
+  802242:	77 19                	ja     80225d <vprintfmt+0x4a5>
+  802244:	89 c2                	mov    %eax,%edx
+  802246:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80224a:	83 c0 08             	add    $0x8,%eax
+  80224d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802250:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802253:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802258:	e9 1b 01 00 00       	jmp    802378 <vprintfmt+0x5c0>
+  80225d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802261:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802265:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802269:	eb e5                	jmp    802250 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80226b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80226f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802273:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802277:	e9 56 ff ff ff       	jmp    8021d2 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80227c:	40 84 f6             	test   %sil,%sil
+  80227f:	75 2e                	jne    8022af <vprintfmt+0x4f7>
+    switch (lflag) {
+  802281:	85 d2                	test   %edx,%edx
+  802283:	74 59                	je     8022de <vprintfmt+0x526>
+  802285:	83 fa 01             	cmp    $0x1,%edx
+  802288:	74 7f                	je     802309 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80228a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80228d:	83 f8 2f             	cmp    $0x2f,%eax
+  802290:	0f 87 9f 00 00 00    	ja     802335 <vprintfmt+0x57d>
+  802296:	89 c2                	mov    %eax,%edx
+  802298:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80229c:	83 c0 08             	add    $0x8,%eax
+  80229f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022a2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8022a5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8022aa:	e9 c9 00 00 00       	jmp    802378 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8022af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8022b5:	77 19                	ja     8022d0 <vprintfmt+0x518>
+  8022b7:	89 c2                	mov    %eax,%edx
+  8022b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022bd:	83 c0 08             	add    $0x8,%eax
+  8022c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022c3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8022c6:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022cb:	e9 a8 00 00 00       	jmp    802378 <vprintfmt+0x5c0>
+  8022d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022dc:	eb e5                	jmp    8022c3 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8022de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8022e4:	77 15                	ja     8022fb <vprintfmt+0x543>
+  8022e6:	89 c2                	mov    %eax,%edx
+  8022e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022ec:	83 c0 08             	add    $0x8,%eax
+  8022ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022f2:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8022f4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8022f9:	eb 7d                	jmp    802378 <vprintfmt+0x5c0>
+  8022fb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022ff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802303:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802307:	eb e9                	jmp    8022f2 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802309:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80230c:	83 f8 2f             	cmp    $0x2f,%eax
+  80230f:	77 16                	ja     802327 <vprintfmt+0x56f>
+  802311:	89 c2                	mov    %eax,%edx
+  802313:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802317:	83 c0 08             	add    $0x8,%eax
+  80231a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80231d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802320:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802325:	eb 51                	jmp    802378 <vprintfmt+0x5c0>
+  802327:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80232b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80232f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802333:	eb e8                	jmp    80231d <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802335:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802339:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80233d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802341:	e9 5c ff ff ff       	jmp    8022a2 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802346:	4c 89 ee             	mov    %r13,%rsi
+  802349:	bf 30 00 00 00       	mov    $0x30,%edi
+  80234e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802351:	4c 89 ee             	mov    %r13,%rsi
+  802354:	bf 78 00 00 00       	mov    $0x78,%edi
+  802359:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80235c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80235f:	83 f8 2f             	cmp    $0x2f,%eax
+  802362:	77 47                	ja     8023ab <vprintfmt+0x5f3>
+  802364:	89 c2                	mov    %eax,%edx
+  802366:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80236a:	83 c0 08             	add    $0x8,%eax
+  80236d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802370:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802373:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802378:	48 83 ec 08          	sub    $0x8,%rsp
+  80237c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802380:	0f 94 c0             	sete   %al
+  802383:	0f b6 c0             	movzbl %al,%eax
+  802386:	50                   	push   %rax
+  802387:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80238c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802390:	4c 89 ee             	mov    %r13,%rsi
+  802393:	4c 89 f7             	mov    %r14,%rdi
+  802396:	48 b8 ad 1c 80 00 00 	movabs $0x801cad,%rax
+  80239d:	00 00 00 
+  8023a0:	ff d0                	call   *%rax
+            break;
+  8023a2:	48 83 c4 10          	add    $0x10,%rsp
+  8023a6:	e9 3e fa ff ff       	jmp    801de9 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8023ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023b7:	eb b7                	jmp    802370 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8023b9:	40 84 f6             	test   %sil,%sil
+  8023bc:	75 2b                	jne    8023e9 <vprintfmt+0x631>
+    switch (lflag) {
+  8023be:	85 d2                	test   %edx,%edx
+  8023c0:	74 56                	je     802418 <vprintfmt+0x660>
+  8023c2:	83 fa 01             	cmp    $0x1,%edx
+  8023c5:	74 7f                	je     802446 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8023c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8023cd:	0f 87 a2 00 00 00    	ja     802475 <vprintfmt+0x6bd>
+  8023d3:	89 c2                	mov    %eax,%edx
+  8023d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023d9:	83 c0 08             	add    $0x8,%eax
+  8023dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023df:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023e2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023e7:	eb 8f                	jmp    802378 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8023ef:	77 19                	ja     80240a <vprintfmt+0x652>
+  8023f1:	89 c2                	mov    %eax,%edx
+  8023f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023f7:	83 c0 08             	add    $0x8,%eax
+  8023fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023fd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802400:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802405:	e9 6e ff ff ff       	jmp    802378 <vprintfmt+0x5c0>
+  80240a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80240e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802412:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802416:	eb e5                	jmp    8023fd <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802418:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80241b:	83 f8 2f             	cmp    $0x2f,%eax
+  80241e:	77 18                	ja     802438 <vprintfmt+0x680>
+  802420:	89 c2                	mov    %eax,%edx
+  802422:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802426:	83 c0 08             	add    $0x8,%eax
+  802429:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80242c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80242e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802433:	e9 40 ff ff ff       	jmp    802378 <vprintfmt+0x5c0>
+  802438:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80243c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802440:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802444:	eb e6                	jmp    80242c <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802446:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802449:	83 f8 2f             	cmp    $0x2f,%eax
+  80244c:	77 19                	ja     802467 <vprintfmt+0x6af>
+  80244e:	89 c2                	mov    %eax,%edx
+  802450:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802454:	83 c0 08             	add    $0x8,%eax
+  802457:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80245a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80245d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802462:	e9 11 ff ff ff       	jmp    802378 <vprintfmt+0x5c0>
+  802467:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80246b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80246f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802473:	eb e5                	jmp    80245a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802475:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802479:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80247d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802481:	e9 59 ff ff ff       	jmp    8023df <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802486:	4c 89 ee             	mov    %r13,%rsi
+  802489:	bf 25 00 00 00       	mov    $0x25,%edi
+  80248e:	41 ff d6             	call   *%r14
+            break;
+  802491:	e9 53 f9 ff ff       	jmp    801de9 <vprintfmt+0x31>
+            putch('%', put_arg);
+  802496:	4c 89 ee             	mov    %r13,%rsi
+  802499:	bf 25 00 00 00       	mov    $0x25,%edi
+  80249e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8024a1:	48 83 eb 01          	sub    $0x1,%rbx
+  8024a5:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8024a9:	75 f6                	jne    8024a1 <vprintfmt+0x6e9>
+  8024ab:	e9 39 f9 ff ff       	jmp    801de9 <vprintfmt+0x31>
+}
+  8024b0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8024b4:	5b                   	pop    %rbx
+  8024b5:	41 5c                	pop    %r12
+  8024b7:	41 5d                	pop    %r13
+  8024b9:	41 5e                	pop    %r14
+  8024bb:	41 5f                	pop    %r15
+  8024bd:	5d                   	pop    %rbp
+  8024be:	c3                   	ret
+
+00000000008024bf <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8024bf:	55                   	push   %rbp
+  8024c0:	48 89 e5             	mov    %rsp,%rbp
+  8024c3:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8024c7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8024cb:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8024d0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8024d4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8024db:	48 85 ff             	test   %rdi,%rdi
+  8024de:	74 2b                	je     80250b <vsnprintf+0x4c>
+  8024e0:	48 85 f6             	test   %rsi,%rsi
+  8024e3:	74 26                	je     80250b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8024e5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024e9:	48 bf 63 1d 80 00 00 	movabs $0x801d63,%rdi
+  8024f0:	00 00 00 
+  8024f3:	48 b8 b8 1d 80 00 00 	movabs $0x801db8,%rax
+  8024fa:	00 00 00 
+  8024fd:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8024ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802503:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802506:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802509:	c9                   	leave
+  80250a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80250b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802510:	eb f7                	jmp    802509 <vsnprintf+0x4a>
+
+0000000000802512 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802512:	55                   	push   %rbp
+  802513:	48 89 e5             	mov    %rsp,%rbp
+  802516:	48 83 ec 50          	sub    $0x50,%rsp
+  80251a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80251e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802522:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802526:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80252d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802531:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802535:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802539:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80253d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802541:	48 b8 bf 24 80 00 00 	movabs $0x8024bf,%rax
+  802548:	00 00 00 
+  80254b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80254d:	c9                   	leave
+  80254e:	c3                   	ret
+
+000000000080254f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80254f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802552:	74 10                	je     802564 <strlen+0x15>
+    size_t n = 0;
+  802554:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802559:	48 83 c0 01          	add    $0x1,%rax
+  80255d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802561:	75 f6                	jne    802559 <strlen+0xa>
+  802563:	c3                   	ret
+    size_t n = 0;
+  802564:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802569:	c3                   	ret
+
+000000000080256a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80256a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80256d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802572:	48 85 f6             	test   %rsi,%rsi
+  802575:	74 11                	je     802588 <strnlen+0x1e>
+  802577:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80257b:	74 0c                	je     802589 <strnlen+0x1f>
+  80257d:	48 83 c2 01          	add    $0x1,%rdx
+  802581:	48 39 d0             	cmp    %rdx,%rax
+  802584:	75 f1                	jne    802577 <strnlen+0xd>
+  802586:	eb 04                	jmp    80258c <strnlen+0x22>
+  802588:	c3                   	ret
+  802589:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80258c:	c3                   	ret
+
+000000000080258d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80258d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802590:	ba 00 00 00 00       	mov    $0x0,%edx
+  802595:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802599:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80259c:	48 83 c2 01          	add    $0x1,%rdx
+  8025a0:	84 c9                	test   %cl,%cl
+  8025a2:	75 f1                	jne    802595 <strcpy+0x8>
+        ;
+    return res;
+}
+  8025a4:	c3                   	ret
+
+00000000008025a5 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8025a5:	55                   	push   %rbp
+  8025a6:	48 89 e5             	mov    %rsp,%rbp
+  8025a9:	41 54                	push   %r12
+  8025ab:	53                   	push   %rbx
+  8025ac:	48 89 fb             	mov    %rdi,%rbx
+  8025af:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8025b2:	48 b8 4f 25 80 00 00 	movabs $0x80254f,%rax
+  8025b9:	00 00 00 
+  8025bc:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8025be:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8025c2:	4c 89 e6             	mov    %r12,%rsi
+  8025c5:	48 b8 8d 25 80 00 00 	movabs $0x80258d,%rax
+  8025cc:	00 00 00 
+  8025cf:	ff d0                	call   *%rax
+    return dst;
+}
+  8025d1:	48 89 d8             	mov    %rbx,%rax
+  8025d4:	5b                   	pop    %rbx
+  8025d5:	41 5c                	pop    %r12
+  8025d7:	5d                   	pop    %rbp
+  8025d8:	c3                   	ret
+
+00000000008025d9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8025d9:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8025dc:	48 85 d2             	test   %rdx,%rdx
+  8025df:	74 1f                	je     802600 <strncpy+0x27>
+  8025e1:	48 01 fa             	add    %rdi,%rdx
+  8025e4:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8025e7:	48 83 c1 01          	add    $0x1,%rcx
+  8025eb:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8025ef:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8025f3:	41 80 f8 01          	cmp    $0x1,%r8b
+  8025f7:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8025fb:	48 39 ca             	cmp    %rcx,%rdx
+  8025fe:	75 e7                	jne    8025e7 <strncpy+0xe>
+    }
+    return ret;
+}
+  802600:	c3                   	ret
+
+0000000000802601 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802601:	48 89 f8             	mov    %rdi,%rax
+  802604:	48 85 d2             	test   %rdx,%rdx
+  802607:	74 24                	je     80262d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802609:	48 83 ea 01          	sub    $0x1,%rdx
+  80260d:	74 1b                	je     80262a <strlcpy+0x29>
+  80260f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802613:	0f b6 16             	movzbl (%rsi),%edx
+  802616:	84 d2                	test   %dl,%dl
+  802618:	74 10                	je     80262a <strlcpy+0x29>
+            *dst++ = *src++;
+  80261a:	48 83 c6 01          	add    $0x1,%rsi
+  80261e:	48 83 c0 01          	add    $0x1,%rax
+  802622:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802625:	48 39 c8             	cmp    %rcx,%rax
+  802628:	75 e9                	jne    802613 <strlcpy+0x12>
+        *dst = '\0';
+  80262a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80262d:	48 29 f8             	sub    %rdi,%rax
+}
+  802630:	c3                   	ret
+
+0000000000802631 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802631:	0f b6 07             	movzbl (%rdi),%eax
+  802634:	84 c0                	test   %al,%al
+  802636:	74 13                	je     80264b <strcmp+0x1a>
+  802638:	38 06                	cmp    %al,(%rsi)
+  80263a:	75 0f                	jne    80264b <strcmp+0x1a>
+  80263c:	48 83 c7 01          	add    $0x1,%rdi
+  802640:	48 83 c6 01          	add    $0x1,%rsi
+  802644:	0f b6 07             	movzbl (%rdi),%eax
+  802647:	84 c0                	test   %al,%al
+  802649:	75 ed                	jne    802638 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80264b:	0f b6 c0             	movzbl %al,%eax
+  80264e:	0f b6 16             	movzbl (%rsi),%edx
+  802651:	29 d0                	sub    %edx,%eax
+}
+  802653:	c3                   	ret
+
+0000000000802654 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802654:	48 85 d2             	test   %rdx,%rdx
+  802657:	74 1f                	je     802678 <strncmp+0x24>
+  802659:	0f b6 07             	movzbl (%rdi),%eax
+  80265c:	84 c0                	test   %al,%al
+  80265e:	74 1e                	je     80267e <strncmp+0x2a>
+  802660:	3a 06                	cmp    (%rsi),%al
+  802662:	75 1a                	jne    80267e <strncmp+0x2a>
+  802664:	48 83 c7 01          	add    $0x1,%rdi
+  802668:	48 83 c6 01          	add    $0x1,%rsi
+  80266c:	48 83 ea 01          	sub    $0x1,%rdx
+  802670:	75 e7                	jne    802659 <strncmp+0x5>
+
+    if (!n) return 0;
+  802672:	b8 00 00 00 00       	mov    $0x0,%eax
+  802677:	c3                   	ret
+  802678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80267d:	c3                   	ret
+  80267e:	48 85 d2             	test   %rdx,%rdx
+  802681:	74 09                	je     80268c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802683:	0f b6 07             	movzbl (%rdi),%eax
+  802686:	0f b6 16             	movzbl (%rsi),%edx
+  802689:	29 d0                	sub    %edx,%eax
+  80268b:	c3                   	ret
+    if (!n) return 0;
+  80268c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802691:	c3                   	ret
+
+0000000000802692 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802692:	0f b6 17             	movzbl (%rdi),%edx
+  802695:	84 d2                	test   %dl,%dl
+  802697:	74 18                	je     8026b1 <strchr+0x1f>
+        if (*str == c) {
+  802699:	0f be d2             	movsbl %dl,%edx
+  80269c:	39 f2                	cmp    %esi,%edx
+  80269e:	74 17                	je     8026b7 <strchr+0x25>
+    for (; *str; str++) {
+  8026a0:	48 83 c7 01          	add    $0x1,%rdi
+  8026a4:	0f b6 17             	movzbl (%rdi),%edx
+  8026a7:	84 d2                	test   %dl,%dl
+  8026a9:	75 ee                	jne    802699 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8026ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b0:	c3                   	ret
+  8026b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b6:	c3                   	ret
+  8026b7:	48 89 f8             	mov    %rdi,%rax
+}
+  8026ba:	c3                   	ret
+
+00000000008026bb <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8026bb:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8026be:	0f b6 17             	movzbl (%rdi),%edx
+  8026c1:	84 d2                	test   %dl,%dl
+  8026c3:	74 13                	je     8026d8 <strfind+0x1d>
+  8026c5:	0f be d2             	movsbl %dl,%edx
+  8026c8:	39 f2                	cmp    %esi,%edx
+  8026ca:	74 0b                	je     8026d7 <strfind+0x1c>
+  8026cc:	48 83 c0 01          	add    $0x1,%rax
+  8026d0:	0f b6 10             	movzbl (%rax),%edx
+  8026d3:	84 d2                	test   %dl,%dl
+  8026d5:	75 ee                	jne    8026c5 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8026d7:	c3                   	ret
+  8026d8:	c3                   	ret
+
+00000000008026d9 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8026d9:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8026dc:	48 89 f8             	mov    %rdi,%rax
+  8026df:	48 f7 d8             	neg    %rax
+  8026e2:	83 e0 07             	and    $0x7,%eax
+  8026e5:	49 89 d1             	mov    %rdx,%r9
+  8026e8:	49 29 c1             	sub    %rax,%r9
+  8026eb:	78 36                	js     802723 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8026ed:	40 0f b6 c6          	movzbl %sil,%eax
+  8026f1:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8026f8:	01 01 01 
+  8026fb:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8026ff:	40 f6 c7 07          	test   $0x7,%dil
+  802703:	75 38                	jne    80273d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802705:	4c 89 c9             	mov    %r9,%rcx
+  802708:	48 c1 f9 03          	sar    $0x3,%rcx
+  80270c:	74 0c                	je     80271a <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80270e:	fc                   	cld
+  80270f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802712:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802716:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80271a:	4d 85 c9             	test   %r9,%r9
+  80271d:	75 45                	jne    802764 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80271f:	4c 89 c0             	mov    %r8,%rax
+  802722:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802723:	48 85 d2             	test   %rdx,%rdx
+  802726:	74 f7                	je     80271f <memset+0x46>
+  802728:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80272b:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80272e:	48 83 c0 01          	add    $0x1,%rax
+  802732:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802736:	48 39 c2             	cmp    %rax,%rdx
+  802739:	75 f3                	jne    80272e <memset+0x55>
+  80273b:	eb e2                	jmp    80271f <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80273d:	40 f6 c7 01          	test   $0x1,%dil
+  802741:	74 06                	je     802749 <memset+0x70>
+  802743:	88 07                	mov    %al,(%rdi)
+  802745:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802749:	40 f6 c7 02          	test   $0x2,%dil
+  80274d:	74 07                	je     802756 <memset+0x7d>
+  80274f:	66 89 07             	mov    %ax,(%rdi)
+  802752:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802756:	40 f6 c7 04          	test   $0x4,%dil
+  80275a:	74 a9                	je     802705 <memset+0x2c>
+  80275c:	89 07                	mov    %eax,(%rdi)
+  80275e:	48 83 c7 04          	add    $0x4,%rdi
+  802762:	eb a1                	jmp    802705 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802764:	41 f6 c1 04          	test   $0x4,%r9b
+  802768:	74 06                	je     802770 <memset+0x97>
+  80276a:	89 07                	mov    %eax,(%rdi)
+  80276c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802770:	41 f6 c1 02          	test   $0x2,%r9b
+  802774:	74 07                	je     80277d <memset+0xa4>
+  802776:	66 89 07             	mov    %ax,(%rdi)
+  802779:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80277d:	41 f6 c1 01          	test   $0x1,%r9b
+  802781:	74 9c                	je     80271f <memset+0x46>
+  802783:	88 07                	mov    %al,(%rdi)
+  802785:	eb 98                	jmp    80271f <memset+0x46>
+
+0000000000802787 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802787:	48 89 f8             	mov    %rdi,%rax
+  80278a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80278d:	48 39 fe             	cmp    %rdi,%rsi
+  802790:	73 3b                	jae    8027cd <memmove+0x46>
+  802792:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802796:	48 39 d7             	cmp    %rdx,%rdi
+  802799:	73 32                	jae    8027cd <memmove+0x46>
+        s += n;
+        d += n;
+  80279b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80279f:	48 89 d6             	mov    %rdx,%rsi
+  8027a2:	48 09 fe             	or     %rdi,%rsi
+  8027a5:	48 09 ce             	or     %rcx,%rsi
+  8027a8:	40 f6 c6 07          	test   $0x7,%sil
+  8027ac:	75 12                	jne    8027c0 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8027ae:	48 83 ef 08          	sub    $0x8,%rdi
+  8027b2:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8027b6:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027ba:	fd                   	std
+  8027bb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8027be:	fc                   	cld
+  8027bf:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8027c0:	48 83 ef 01          	sub    $0x1,%rdi
+  8027c4:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8027c8:	fd                   	std
+  8027c9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8027cb:	eb f1                	jmp    8027be <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8027cd:	48 89 f2             	mov    %rsi,%rdx
+  8027d0:	48 09 c2             	or     %rax,%rdx
+  8027d3:	48 09 ca             	or     %rcx,%rdx
+  8027d6:	f6 c2 07             	test   $0x7,%dl
+  8027d9:	75 0c                	jne    8027e7 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8027db:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027df:	48 89 c7             	mov    %rax,%rdi
+  8027e2:	fc                   	cld
+  8027e3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8027e6:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8027e7:	48 89 c7             	mov    %rax,%rdi
+  8027ea:	fc                   	cld
+  8027eb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8027ed:	c3                   	ret
+
+00000000008027ee <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8027ee:	55                   	push   %rbp
+  8027ef:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8027f2:	48 b8 87 27 80 00 00 	movabs $0x802787,%rax
+  8027f9:	00 00 00 
+  8027fc:	ff d0                	call   *%rax
+}
+  8027fe:	5d                   	pop    %rbp
+  8027ff:	c3                   	ret
+
+0000000000802800 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802800:	55                   	push   %rbp
+  802801:	48 89 e5             	mov    %rsp,%rbp
+  802804:	41 57                	push   %r15
+  802806:	41 56                	push   %r14
+  802808:	41 55                	push   %r13
+  80280a:	41 54                	push   %r12
+  80280c:	53                   	push   %rbx
+  80280d:	48 83 ec 08          	sub    $0x8,%rsp
+  802811:	49 89 fe             	mov    %rdi,%r14
+  802814:	49 89 f7             	mov    %rsi,%r15
+  802817:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80281a:	48 89 f7             	mov    %rsi,%rdi
+  80281d:	48 b8 4f 25 80 00 00 	movabs $0x80254f,%rax
+  802824:	00 00 00 
+  802827:	ff d0                	call   *%rax
+  802829:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80282c:	48 89 de             	mov    %rbx,%rsi
+  80282f:	4c 89 f7             	mov    %r14,%rdi
+  802832:	48 b8 6a 25 80 00 00 	movabs $0x80256a,%rax
+  802839:	00 00 00 
+  80283c:	ff d0                	call   *%rax
+  80283e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802841:	48 39 c3             	cmp    %rax,%rbx
+  802844:	74 36                	je     80287c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802846:	48 89 d8             	mov    %rbx,%rax
+  802849:	4c 29 e8             	sub    %r13,%rax
+  80284c:	49 39 c4             	cmp    %rax,%r12
+  80284f:	73 31                	jae    802882 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802851:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802856:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80285a:	4c 89 fe             	mov    %r15,%rsi
+  80285d:	48 b8 ee 27 80 00 00 	movabs $0x8027ee,%rax
+  802864:	00 00 00 
+  802867:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802869:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80286d:	48 83 c4 08          	add    $0x8,%rsp
+  802871:	5b                   	pop    %rbx
+  802872:	41 5c                	pop    %r12
+  802874:	41 5d                	pop    %r13
+  802876:	41 5e                	pop    %r14
+  802878:	41 5f                	pop    %r15
+  80287a:	5d                   	pop    %rbp
+  80287b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80287c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802880:	eb eb                	jmp    80286d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802882:	48 83 eb 01          	sub    $0x1,%rbx
+  802886:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80288a:	48 89 da             	mov    %rbx,%rdx
+  80288d:	4c 89 fe             	mov    %r15,%rsi
+  802890:	48 b8 ee 27 80 00 00 	movabs $0x8027ee,%rax
+  802897:	00 00 00 
+  80289a:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80289c:	49 01 de             	add    %rbx,%r14
+  80289f:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8028a4:	eb c3                	jmp    802869 <strlcat+0x69>
+
+00000000008028a6 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8028a6:	48 85 d2             	test   %rdx,%rdx
+  8028a9:	74 2d                	je     8028d8 <memcmp+0x32>
+  8028ab:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8028b0:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8028b4:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8028b9:	44 38 c1             	cmp    %r8b,%cl
+  8028bc:	75 0f                	jne    8028cd <memcmp+0x27>
+    while (n-- > 0) {
+  8028be:	48 83 c0 01          	add    $0x1,%rax
+  8028c2:	48 39 c2             	cmp    %rax,%rdx
+  8028c5:	75 e9                	jne    8028b0 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8028c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028cc:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8028cd:	0f b6 c1             	movzbl %cl,%eax
+  8028d0:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8028d4:	44 29 c0             	sub    %r8d,%eax
+  8028d7:	c3                   	ret
+    return 0;
+  8028d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028dd:	c3                   	ret
+
+00000000008028de <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8028de:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8028e2:	48 39 c7             	cmp    %rax,%rdi
+  8028e5:	73 0f                	jae    8028f6 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8028e7:	40 38 37             	cmp    %sil,(%rdi)
+  8028ea:	74 0e                	je     8028fa <memfind+0x1c>
+    for (; src < end; src++) {
+  8028ec:	48 83 c7 01          	add    $0x1,%rdi
+  8028f0:	48 39 f8             	cmp    %rdi,%rax
+  8028f3:	75 f2                	jne    8028e7 <memfind+0x9>
+  8028f5:	c3                   	ret
+  8028f6:	48 89 f8             	mov    %rdi,%rax
+  8028f9:	c3                   	ret
+  8028fa:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8028fd:	c3                   	ret
+
+00000000008028fe <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8028fe:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802901:	0f b6 37             	movzbl (%rdi),%esi
+  802904:	40 80 fe 20          	cmp    $0x20,%sil
+  802908:	74 06                	je     802910 <strtol+0x12>
+  80290a:	40 80 fe 09          	cmp    $0x9,%sil
+  80290e:	75 13                	jne    802923 <strtol+0x25>
+  802910:	48 83 c7 01          	add    $0x1,%rdi
+  802914:	0f b6 37             	movzbl (%rdi),%esi
+  802917:	40 80 fe 20          	cmp    $0x20,%sil
+  80291b:	74 f3                	je     802910 <strtol+0x12>
+  80291d:	40 80 fe 09          	cmp    $0x9,%sil
+  802921:	74 ed                	je     802910 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802923:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802926:	83 e0 fd             	and    $0xfffffffd,%eax
+  802929:	3c 01                	cmp    $0x1,%al
+  80292b:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80292f:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802935:	75 0f                	jne    802946 <strtol+0x48>
+  802937:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80293a:	74 14                	je     802950 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80293c:	85 d2                	test   %edx,%edx
+  80293e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802943:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802946:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80294b:	4c 63 ca             	movslq %edx,%r9
+  80294e:	eb 36                	jmp    802986 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802950:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802954:	74 0f                	je     802965 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802956:	85 d2                	test   %edx,%edx
+  802958:	75 ec                	jne    802946 <strtol+0x48>
+        s++;
+  80295a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80295e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802963:	eb e1                	jmp    802946 <strtol+0x48>
+        s += 2;
+  802965:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802969:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80296e:	eb d6                	jmp    802946 <strtol+0x48>
+            dig -= '0';
+  802970:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802973:	44 0f b6 c1          	movzbl %cl,%r8d
+  802977:	41 39 d0             	cmp    %edx,%r8d
+  80297a:	7d 21                	jge    80299d <strtol+0x9f>
+        val = val * base + dig;
+  80297c:	49 0f af c1          	imul   %r9,%rax
+  802980:	0f b6 c9             	movzbl %cl,%ecx
+  802983:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802986:	48 83 c7 01          	add    $0x1,%rdi
+  80298a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80298e:	80 f9 39             	cmp    $0x39,%cl
+  802991:	76 dd                	jbe    802970 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802993:	80 f9 7b             	cmp    $0x7b,%cl
+  802996:	77 05                	ja     80299d <strtol+0x9f>
+            dig -= 'a' - 10;
+  802998:	83 e9 57             	sub    $0x57,%ecx
+  80299b:	eb d6                	jmp    802973 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80299d:	4d 85 d2             	test   %r10,%r10
+  8029a0:	74 03                	je     8029a5 <strtol+0xa7>
+  8029a2:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8029a5:	48 89 c2             	mov    %rax,%rdx
+  8029a8:	48 f7 da             	neg    %rdx
+  8029ab:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8029af:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8029b3:	c3                   	ret
+
+00000000008029b4 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8029b4:	55                   	push   %rbp
+  8029b5:	48 89 e5             	mov    %rsp,%rbp
+  8029b8:	41 54                	push   %r12
+  8029ba:	53                   	push   %rbx
+  8029bb:	48 89 fb             	mov    %rdi,%rbx
+  8029be:	48 89 f7             	mov    %rsi,%rdi
+  8029c1:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8029c4:	48 85 f6             	test   %rsi,%rsi
+  8029c7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029ce:	00 00 00 
+  8029d1:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8029d5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029da:	48 b8 0d 06 80 00 00 	movabs $0x80060d,%rax
+  8029e1:	00 00 00 
+  8029e4:	ff d0                	call   *%rax
+    if (res < 0) {
+  8029e6:	85 c0                	test   %eax,%eax
+  8029e8:	78 45                	js     802a2f <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8029ea:	48 85 db             	test   %rbx,%rbx
+  8029ed:	74 12                	je     802a01 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8029ef:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029f6:	00 00 00 
+  8029f9:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8029ff:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802a01:	4d 85 e4             	test   %r12,%r12
+  802a04:	74 14                	je     802a1a <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802a06:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a0d:	00 00 00 
+  802a10:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802a16:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802a1a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a21:	00 00 00 
+  802a24:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802a2a:	5b                   	pop    %rbx
+  802a2b:	41 5c                	pop    %r12
+  802a2d:	5d                   	pop    %rbp
+  802a2e:	c3                   	ret
+        if (from_env_store)
+  802a2f:	48 85 db             	test   %rbx,%rbx
+  802a32:	74 06                	je     802a3a <ipc_recv+0x86>
+            *from_env_store = 0;
+  802a34:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802a3a:	4d 85 e4             	test   %r12,%r12
+  802a3d:	74 eb                	je     802a2a <ipc_recv+0x76>
+            *perm_store = 0;
+  802a3f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802a46:	00 
+  802a47:	eb e1                	jmp    802a2a <ipc_recv+0x76>
+
+0000000000802a49 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802a49:	55                   	push   %rbp
+  802a4a:	48 89 e5             	mov    %rsp,%rbp
+  802a4d:	41 57                	push   %r15
+  802a4f:	41 56                	push   %r14
+  802a51:	41 55                	push   %r13
+  802a53:	41 54                	push   %r12
+  802a55:	53                   	push   %rbx
+  802a56:	48 83 ec 18          	sub    $0x18,%rsp
+  802a5a:	41 89 fd             	mov    %edi,%r13d
+  802a5d:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802a60:	48 89 d3             	mov    %rdx,%rbx
+  802a63:	49 89 cc             	mov    %rcx,%r12
+  802a66:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a6a:	48 85 d2             	test   %rdx,%rdx
+  802a6d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a74:	00 00 00 
+  802a77:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a7b:	49 be e1 05 80 00 00 	movabs $0x8005e1,%r14
+  802a82:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802a85:	49 bf 14 02 80 00 00 	movabs $0x800214,%r15
+  802a8c:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a8f:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802a92:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802a96:	4c 89 e1             	mov    %r12,%rcx
+  802a99:	48 89 da             	mov    %rbx,%rdx
+  802a9c:	44 89 ef             	mov    %r13d,%edi
+  802a9f:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802aa2:	85 c0                	test   %eax,%eax
+  802aa4:	74 34                	je     802ada <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802aa6:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802aa9:	75 05                	jne    802ab0 <ipc_send+0x67>
+        sys_yield();
+  802aab:	41 ff d7             	call   *%r15
+    while (true) {
+  802aae:	eb df                	jmp    802a8f <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802ab0:	48 ba ef 31 80 00 00 	movabs $0x8031ef,%rdx
+  802ab7:	00 00 00 
+  802aba:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802abf:	48 bf 08 32 80 00 00 	movabs $0x803208,%rdi
+  802ac6:	00 00 00 
+  802ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ace:	48 b9 18 1b 80 00 00 	movabs $0x801b18,%rcx
+  802ad5:	00 00 00 
+  802ad8:	ff d1                	call   *%rcx
+    }
+}
+  802ada:	48 83 c4 18          	add    $0x18,%rsp
+  802ade:	5b                   	pop    %rbx
+  802adf:	41 5c                	pop    %r12
+  802ae1:	41 5d                	pop    %r13
+  802ae3:	41 5e                	pop    %r14
+  802ae5:	41 5f                	pop    %r15
+  802ae7:	5d                   	pop    %rbp
+  802ae8:	c3                   	ret
+
+0000000000802ae9 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802ae9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802aee:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802af5:	00 00 00 
+  802af8:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802aff:	48 01 ca             	add    %rcx,%rdx
+  802b02:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802b08:	39 fa                	cmp    %edi,%edx
+  802b0a:	74 12                	je     802b1e <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802b0c:	48 83 c0 01          	add    $0x1,%rax
+  802b10:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b16:	75 e0                	jne    802af8 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802b18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b1d:	c3                   	ret
+            return envs[i].env_id;
+  802b1e:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802b25:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b2c:	00 00 00 
+  802b2f:	48 01 d0             	add    %rdx,%rax
+  802b32:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b38:	c3                   	ret
+  802b39:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000802b40 <__rodata_start>:
+  802b40:	69 64 6c 65 00 3c 75 	imul   $0x6e753c00,0x65(%rsp,%rbp,2),%esp
+  802b47:	6e 
+  802b48:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b4c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b4d:	3e 00 90 73 79 73 63 	ds add %dl,0x63737973(%rax)
+  802b54:	61                   	(bad)
+  802b55:	6c                   	insb   (%dx),%es:(%rdi)
+  802b56:	6c                   	insb   (%dx),%es:(%rdi)
+  802b57:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a08fd7 <__bss_end+0x72200fd7>
+  802b5d:	65 74 75             	gs je  802bd5 <__rodata_start+0x95>
+  802b60:	72 6e                	jb     802bd0 <__rodata_start+0x90>
+  802b62:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a08fe4 <__bss_end+0x28200fe4>
+  802b69:	28 
+  802b6a:	3e 20 30             	ds and %dh,(%rax)
+  802b6d:	29 00                	sub    %eax,(%rax)
+  802b6f:	6c                   	insb   (%dx),%es:(%rdi)
+  802b70:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802b77:	61                   	(bad)
+  802b78:	6c                   	insb   (%dx),%es:(%rdi)
+  802b79:	6c                   	insb   (%dx),%es:(%rdi)
+  802b7a:	2e 63 00             	cs movsxd (%rax),%eax
+  802b7d:	0f 1f 00             	nopl   (%rax)
+  802b80:	5b                   	pop    %rbx
+  802b81:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b86:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802b89:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b8d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b8e:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802b92:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802b99:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 803604 <error_string+0x4e4>
+  802ba0:	5b                   	pop    %rbx
+  802ba1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802ba6:	20 66 74             	and    %ah,0x74(%rsi)
+  802ba9:	72 75                	jb     802c20 <devtab+0x20>
+  802bab:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bac:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802baf:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4c1a <__bss_end+0x2d2ccc1a>
+  802bb6:	20 62 61             	and    %ah,0x61(%rdx)
+  802bb9:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802bbd:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bc1:	5b                   	pop    %rbx
+  802bc2:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802bc7:	20 72 65             	and    %dh,0x65(%rdx)
+  802bca:	61                   	(bad)
+  802bcb:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4c36 <__bss_end+0x2d2ccc36>
+  802bd2:	20 62 61             	and    %ah,0x61(%rdx)
+  802bd5:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802bd9:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bdd:	5b                   	pop    %rbx
+  802bde:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802be3:	20 77 72             	and    %dh,0x72(%rdi)
+  802be6:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802bed:	2d 
+  802bee:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802bf3:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802bf6:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bfa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802c00 <devtab>:
+  802c00:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802c10:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802c20:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802c30:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802c40:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802c50:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802c60:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802c70:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802c80:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802c90:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802ca0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802cb0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802cc0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802cd0:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802ce0:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802cf0:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802d00:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802d10:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802d20:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802d30:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802d40:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802d50:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802d60:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802d70:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802d80:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802d90:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802da0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802db0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802dc0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802dd0:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802de0:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802df0:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802e00:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802e10:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802e20:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802e30:	64 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     d.operation not 
+  802e40:	70 65 72 6d 69 74 74 65 64 00 66 2e 0f 1f 84 00     permitted.f.....
+  802e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
+  802e60:	55 1e 80 00 00 00 00 00 96 24 80 00 00 00 00 00     U........$......
+  802e70:	86 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  802e80:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  802e90:	96 24 80 00 00 00 00 00 74 1e 80 00 00 00 00 00     .$......t.......
+  802ea0:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  802eb0:	68 1e 80 00 00 00 00 00 e2 1e 80 00 00 00 00 00     h...............
+  802ec0:	96 24 80 00 00 00 00 00 68 1e 80 00 00 00 00 00     .$......h.......
+  802ed0:	ae 1e 80 00 00 00 00 00 ae 1e 80 00 00 00 00 00     ................
+  802ee0:	ae 1e 80 00 00 00 00 00 ae 1e 80 00 00 00 00 00     ................
+  802ef0:	ae 1e 80 00 00 00 00 00 ae 1e 80 00 00 00 00 00     ................
+  802f00:	ae 1e 80 00 00 00 00 00 ae 1e 80 00 00 00 00 00     ................
+  802f10:	ae 1e 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .........$......
+  802f20:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  802f30:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  802f40:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  802f50:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  802f60:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  802f70:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  802f80:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  802f90:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  802fa0:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  802fb0:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  802fc0:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  802fd0:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  802fe0:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  802ff0:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  803000:	96 24 80 00 00 00 00 00 b9 23 80 00 00 00 00 00     .$.......#......
+  803010:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  803020:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  803030:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  803040:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  803050:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  803060:	05 1f 80 00 00 00 00 00 d4 20 80 00 00 00 00 00     ......... ......
+  803070:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  803080:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  803090:	34 1f 80 00 00 00 00 00 96 24 80 00 00 00 00 00     4........$......
+  8030a0:	96 24 80 00 00 00 00 00 fa 1e 80 00 00 00 00 00     .$..............
+  8030b0:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  8030c0:	7c 22 80 00 00 00 00 00 46 23 80 00 00 00 00 00     |"......F#......
+  8030d0:	96 24 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .$.......$......
+  8030e0:	cb 1f 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .........$......
+  8030f0:	a8 21 80 00 00 00 00 00 96 24 80 00 00 00 00 00     .!.......$......
+  803100:	96 24 80 00 00 00 00 00 b9 23 80 00 00 00 00 00     .$.......#......
+  803110:	96 24 80 00 00 00 00 00 5e 1e 80 00 00 00 00 00     .$......^.......
+
+0000000000803120 <error_string>:
+	...
+  803128:	d5 2c 80 00 00 00 00 00 e7 2c 80 00 00 00 00 00     .,.......,......
+  803138:	f7 2c 80 00 00 00 00 00 09 2d 80 00 00 00 00 00     .,.......-......
+  803148:	17 2d 80 00 00 00 00 00 2b 2d 80 00 00 00 00 00     .-......+-......
+  803158:	40 2d 80 00 00 00 00 00 53 2d 80 00 00 00 00 00     @-......S-......
+  803168:	65 2d 80 00 00 00 00 00 79 2d 80 00 00 00 00 00     e-......y-......
+  803178:	89 2d 80 00 00 00 00 00 9c 2d 80 00 00 00 00 00     .-.......-......
+  803188:	b3 2d 80 00 00 00 00 00 c9 2d 80 00 00 00 00 00     .-.......-......
+  803198:	e1 2d 80 00 00 00 00 00 f9 2d 80 00 00 00 00 00     .-.......-......
+  8031a8:	06 2e 80 00 00 00 00 00 d0 31 80 00 00 00 00 00     .........1......
+  8031b8:	1a 2e 80 00 00 00 00 00 00 00 00 00 00 00 00 00     ................
+  8031c8:	32 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     2.......file is 
+  8031d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8031e8:	75 74 61 62 6c 65 00 69 70 63 5f 73 65 6e 64 3a     utable.ipc_send:
+  8031f8:	20 66 61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00      failed to send.
+  803208:	6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00     lib/ipc.c.f.....
+  803218:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803228:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803238:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803248:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803258:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803268:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803278:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803288:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803298:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8032b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803308:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803318:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803328:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803338:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803348:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803358:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803368:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803378:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803388:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803398:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803408:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803418:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803428:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803438:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803448:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803458:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803468:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803478:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803488:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803498:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803508:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803518:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803528:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803538:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803548:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803558:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803568:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803578:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803588:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803598:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803608:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803618:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803628:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803638:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803648:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803658:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803668:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803678:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803688:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803698:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803708:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803718:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803728:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803738:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803748:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803758:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803768:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803778:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803788:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803798:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803808:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803818:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803828:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803838:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803848:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803858:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803868:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803878:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803888:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803898:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803908:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803918:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803928:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803938:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803948:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803958:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803968:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803978:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803988:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803998:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803aa8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ab8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ac8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ad8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ae8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803af8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ba8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bc8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bd8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803be8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bf8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ca8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ce8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cf8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803da8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803db8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803dc8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dd8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803de8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803df8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ea8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803eb8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ec8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ed8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ee8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ef8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fa8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fb8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fc8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fd8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fe8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ff8:	00 00 66 0f 1f 44 00 00                             ..f..D..
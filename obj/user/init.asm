@@ -0,0 +1,6765 @@
+
+obj/user/init:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 42 05 00 00       	call   800565 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <sum>:
+char bss[6000];
+
+int
+sum(const char *s, int n) {
+    int i, tot = 0;
+    for (i = 0; i < n; i++)
+  800025:	85 f6                	test   %esi,%esi
+  800027:	7e 22                	jle    80004b <sum+0x26>
+  800029:	48 63 f6             	movslq %esi,%rsi
+  80002c:	b8 00 00 00 00       	mov    $0x0,%eax
+    int i, tot = 0;
+  800031:	b9 00 00 00 00       	mov    $0x0,%ecx
+        tot ^= i * s[i];
+  800036:	0f be 14 07          	movsbl (%rdi,%rax,1),%edx
+  80003a:	0f af d0             	imul   %eax,%edx
+  80003d:	31 d1                	xor    %edx,%ecx
+    for (i = 0; i < n; i++)
+  80003f:	48 83 c0 01          	add    $0x1,%rax
+  800043:	48 39 f0             	cmp    %rsi,%rax
+  800046:	75 ee                	jne    800036 <sum+0x11>
+    return tot;
+}
+  800048:	89 c8                	mov    %ecx,%eax
+  80004a:	c3                   	ret
+    int i, tot = 0;
+  80004b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    return tot;
+  800050:	eb f6                	jmp    800048 <sum+0x23>
+
+0000000000800052 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 57                	push   %r15
+  800058:	41 56                	push   %r14
+  80005a:	41 55                	push   %r13
+  80005c:	41 54                	push   %r12
+  80005e:	53                   	push   %rbx
+  80005f:	48 81 ec 08 01 00 00 	sub    $0x108,%rsp
+  800066:	41 89 fc             	mov    %edi,%r12d
+  800069:	49 89 f5             	mov    %rsi,%r13
+    int i, r, x, want;
+    char args[256];
+
+    cprintf("init: running\n");
+  80006c:	48 bf 20 37 80 00 00 	movabs $0x803720,%rdi
+  800073:	00 00 00 
+  800076:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007b:	48 ba 7f 07 80 00 00 	movabs $0x80077f,%rdx
+  800082:	00 00 00 
+  800085:	ff d2                	call   *%rdx
+
+    want = 0xf989e;
+    if ((x = sum((char *)&data, sizeof data)) != want)
+  800087:	be 70 17 00 00       	mov    $0x1770,%esi
+  80008c:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800093:	00 00 00 
+  800096:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80009d:	00 00 00 
+  8000a0:	ff d0                	call   *%rax
+  8000a2:	3d 9e 98 0f 00       	cmp    $0xf989e,%eax
+  8000a7:	0f 84 64 01 00 00    	je     800211 <umain+0x1bf>
+        cprintf("init: data is not initialized: got sum %08x wanted %08x\n",
+  8000ad:	ba 9e 98 0f 00       	mov    $0xf989e,%edx
+  8000b2:	89 c6                	mov    %eax,%esi
+  8000b4:	48 bf e8 37 80 00 00 	movabs $0x8037e8,%rdi
+  8000bb:	00 00 00 
+  8000be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c3:	48 b9 7f 07 80 00 00 	movabs $0x80077f,%rcx
+  8000ca:	00 00 00 
+  8000cd:	ff d1                	call   *%rcx
+                x, want);
+    else
+        cprintf("init: data seems okay\n");
+    if ((x = sum(bss, sizeof bss)) != 0)
+  8000cf:	be 70 17 00 00       	mov    $0x1770,%esi
+  8000d4:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8000db:	00 00 00 
+  8000de:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e5:	00 00 00 
+  8000e8:	ff d0                	call   *%rax
+  8000ea:	85 c0                	test   %eax,%eax
+  8000ec:	0f 84 3f 01 00 00    	je     800231 <umain+0x1df>
+        cprintf("bss is not initialized: wanted sum 0 got %08x\n", x);
+  8000f2:	89 c6                	mov    %eax,%esi
+  8000f4:	48 bf 28 38 80 00 00 	movabs $0x803828,%rdi
+  8000fb:	00 00 00 
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800103:	48 ba 7f 07 80 00 00 	movabs $0x80077f,%rdx
+  80010a:	00 00 00 
+  80010d:	ff d2                	call   *%rdx
+    else
+        cprintf("init: bss seems okay\n");
+
+    /* Output in one syscall per line to avoid output interleaving */
+    strcat(args, "init: args:");
+  80010f:	48 be 5c 37 80 00 00 	movabs $0x80375c,%rsi
+  800116:	00 00 00 
+  800119:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800120:	48 b8 bc 10 80 00 00 	movabs $0x8010bc,%rax
+  800127:	00 00 00 
+  80012a:	ff d0                	call   *%rax
+    for (i = 0; i < argc; i++) {
+  80012c:	45 85 e4             	test   %r12d,%r12d
+  80012f:	7e 59                	jle    80018a <umain+0x138>
+  800131:	4c 89 eb             	mov    %r13,%rbx
+  800134:	4d 63 e4             	movslq %r12d,%r12
+  800137:	4f 8d 7c e5 00       	lea    0x0(%r13,%r12,8),%r15
+        strcat(args, " '");
+  80013c:	49 be 68 37 80 00 00 	movabs $0x803768,%r14
+  800143:	00 00 00 
+  800146:	49 bc bc 10 80 00 00 	movabs $0x8010bc,%r12
+  80014d:	00 00 00 
+        strcat(args, argv[i]);
+        strcat(args, "'");
+  800150:	49 bd 69 37 80 00 00 	movabs $0x803769,%r13
+  800157:	00 00 00 
+        strcat(args, " '");
+  80015a:	4c 89 f6             	mov    %r14,%rsi
+  80015d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800164:	41 ff d4             	call   *%r12
+        strcat(args, argv[i]);
+  800167:	48 8b 33             	mov    (%rbx),%rsi
+  80016a:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800171:	41 ff d4             	call   *%r12
+        strcat(args, "'");
+  800174:	4c 89 ee             	mov    %r13,%rsi
+  800177:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  80017e:	41 ff d4             	call   *%r12
+    for (i = 0; i < argc; i++) {
+  800181:	48 83 c3 08          	add    $0x8,%rbx
+  800185:	4c 39 fb             	cmp    %r15,%rbx
+  800188:	75 d0                	jne    80015a <umain+0x108>
+    }
+    cprintf("%s\n", args);
+  80018a:	48 8d b5 d0 fe ff ff 	lea    -0x130(%rbp),%rsi
+  800191:	48 bf 6b 37 80 00 00 	movabs $0x80376b,%rdi
+  800198:	00 00 00 
+  80019b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a0:	48 bb 7f 07 80 00 00 	movabs $0x80077f,%rbx
+  8001a7:	00 00 00 
+  8001aa:	ff d3                	call   *%rbx
+
+    cprintf("init: running sh\n");
+  8001ac:	48 bf 6f 37 80 00 00 	movabs $0x80376f,%rdi
+  8001b3:	00 00 00 
+  8001b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bb:	ff d3                	call   *%rbx
+
+    /* Being run directly from kernel, so no file descriptors open yet */
+    close(0);
+  8001bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c2:	48 b8 e9 1d 80 00 00 	movabs $0x801de9,%rax
+  8001c9:	00 00 00 
+  8001cc:	ff d0                	call   *%rax
+    if ((r = opencons()) < 0)
+  8001ce:	48 b8 fe 04 80 00 00 	movabs $0x8004fe,%rax
+  8001d5:	00 00 00 
+  8001d8:	ff d0                	call   *%rax
+  8001da:	85 c0                	test   %eax,%eax
+  8001dc:	78 73                	js     800251 <umain+0x1ff>
+        panic("opencons: %i", r);
+    if (r != 0)
+  8001de:	0f 84 9a 00 00 00    	je     80027e <umain+0x22c>
+        panic("first opencons used fd %d", r);
+  8001e4:	89 c1                	mov    %eax,%ecx
+  8001e6:	48 ba 9a 37 80 00 00 	movabs $0x80379a,%rdx
+  8001ed:	00 00 00 
+  8001f0:	be 36 00 00 00       	mov    $0x36,%esi
+  8001f5:	48 bf 8e 37 80 00 00 	movabs $0x80378e,%rdi
+  8001fc:	00 00 00 
+  8001ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800204:	49 b8 2f 06 80 00 00 	movabs $0x80062f,%r8
+  80020b:	00 00 00 
+  80020e:	41 ff d0             	call   *%r8
+        cprintf("init: data seems okay\n");
+  800211:	48 bf 2f 37 80 00 00 	movabs $0x80372f,%rdi
+  800218:	00 00 00 
+  80021b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800220:	48 ba 7f 07 80 00 00 	movabs $0x80077f,%rdx
+  800227:	00 00 00 
+  80022a:	ff d2                	call   *%rdx
+  80022c:	e9 9e fe ff ff       	jmp    8000cf <umain+0x7d>
+        cprintf("init: bss seems okay\n");
+  800231:	48 bf 46 37 80 00 00 	movabs $0x803746,%rdi
+  800238:	00 00 00 
+  80023b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800240:	48 ba 7f 07 80 00 00 	movabs $0x80077f,%rdx
+  800247:	00 00 00 
+  80024a:	ff d2                	call   *%rdx
+  80024c:	e9 be fe ff ff       	jmp    80010f <umain+0xbd>
+        panic("opencons: %i", r);
+  800251:	89 c1                	mov    %eax,%ecx
+  800253:	48 ba 81 37 80 00 00 	movabs $0x803781,%rdx
+  80025a:	00 00 00 
+  80025d:	be 34 00 00 00       	mov    $0x34,%esi
+  800262:	48 bf 8e 37 80 00 00 	movabs $0x80378e,%rdi
+  800269:	00 00 00 
+  80026c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800271:	49 b8 2f 06 80 00 00 	movabs $0x80062f,%r8
+  800278:	00 00 00 
+  80027b:	41 ff d0             	call   *%r8
+    if ((r = dup(0, 1)) < 0)
+  80027e:	be 01 00 00 00       	mov    $0x1,%esi
+  800283:	bf 00 00 00 00       	mov    $0x0,%edi
+  800288:	48 b8 44 1e 80 00 00 	movabs $0x801e44,%rax
+  80028f:	00 00 00 
+  800292:	ff d0                	call   *%rax
+        panic("dup: %i", r);
+    while (1) {
+        cprintf("init: starting sh\n");
+  800294:	49 be bc 37 80 00 00 	movabs $0x8037bc,%r14
+  80029b:	00 00 00 
+  80029e:	48 bb 7f 07 80 00 00 	movabs $0x80077f,%rbx
+  8002a5:	00 00 00 
+        r = spawnl("/sh", "sh", (char *)0);
+  8002a8:	49 bd d0 37 80 00 00 	movabs $0x8037d0,%r13
+  8002af:	00 00 00 
+  8002b2:	49 bc cf 37 80 00 00 	movabs $0x8037cf,%r12
+  8002b9:	00 00 00 
+    if ((r = dup(0, 1)) < 0)
+  8002bc:	85 c0                	test   %eax,%eax
+  8002be:	79 40                	jns    800300 <umain+0x2ae>
+        panic("dup: %i", r);
+  8002c0:	89 c1                	mov    %eax,%ecx
+  8002c2:	48 ba b4 37 80 00 00 	movabs $0x8037b4,%rdx
+  8002c9:	00 00 00 
+  8002cc:	be 38 00 00 00       	mov    $0x38,%esi
+  8002d1:	48 bf 8e 37 80 00 00 	movabs $0x80378e,%rdi
+  8002d8:	00 00 00 
+  8002db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e0:	49 b8 2f 06 80 00 00 	movabs $0x80062f,%r8
+  8002e7:	00 00 00 
+  8002ea:	41 ff d0             	call   *%r8
+        if (r < 0) {
+            cprintf("init: spawn sh: %i\n", r);
+  8002ed:	89 c6                	mov    %eax,%esi
+  8002ef:	48 bf d3 37 80 00 00 	movabs $0x8037d3,%rdi
+  8002f6:	00 00 00 
+  8002f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fe:	ff d3                	call   *%rbx
+        cprintf("init: starting sh\n");
+  800300:	4c 89 f7             	mov    %r14,%rdi
+  800303:	b8 00 00 00 00       	mov    $0x0,%eax
+  800308:	ff d3                	call   *%rbx
+        r = spawnl("/sh", "sh", (char *)0);
+  80030a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030f:	4c 89 ee             	mov    %r13,%rsi
+  800312:	4c 89 e7             	mov    %r12,%rdi
+  800315:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031a:	48 b9 3b 2d 80 00 00 	movabs $0x802d3b,%rcx
+  800321:	00 00 00 
+  800324:	ff d1                	call   *%rcx
+        if (r < 0) {
+  800326:	85 c0                	test   %eax,%eax
+  800328:	78 c3                	js     8002ed <umain+0x29b>
+            continue;
+        }
+        wait(r);
+  80032a:	89 c7                	mov    %eax,%edi
+  80032c:	48 b8 36 33 80 00 00 	movabs $0x803336,%rax
+  800333:	00 00 00 
+  800336:	ff d0                	call   *%rax
+  800338:	eb c6                	jmp    800300 <umain+0x2ae>
+
+000000000080033a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80033a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033f:	c3                   	ret
+
+0000000000800340 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  800340:	55                   	push   %rbp
+  800341:	48 89 e5             	mov    %rsp,%rbp
+  800344:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  800347:	48 be 57 38 80 00 00 	movabs $0x803857,%rsi
+  80034e:	00 00 00 
+  800351:	48 b8 a4 10 80 00 00 	movabs $0x8010a4,%rax
+  800358:	00 00 00 
+  80035b:	ff d0                	call   *%rax
+    return 0;
+}
+  80035d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800362:	5d                   	pop    %rbp
+  800363:	c3                   	ret
+
+0000000000800364 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800364:	55                   	push   %rbp
+  800365:	48 89 e5             	mov    %rsp,%rbp
+  800368:	41 57                	push   %r15
+  80036a:	41 56                	push   %r14
+  80036c:	41 55                	push   %r13
+  80036e:	41 54                	push   %r12
+  800370:	53                   	push   %rbx
+  800371:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  800378:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80037f:	48 85 d2             	test   %rdx,%rdx
+  800382:	74 7a                	je     8003fe <devcons_write+0x9a>
+  800384:	49 89 d6             	mov    %rdx,%r14
+  800387:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80038d:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  800392:	49 bf 9e 12 80 00 00 	movabs $0x80129e,%r15
+  800399:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80039c:	4c 89 f3             	mov    %r14,%rbx
+  80039f:	48 29 f3             	sub    %rsi,%rbx
+  8003a2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8003a7:	48 39 c3             	cmp    %rax,%rbx
+  8003aa:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8003ae:	4c 63 eb             	movslq %ebx,%r13
+  8003b1:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8003b8:	48 01 c6             	add    %rax,%rsi
+  8003bb:	4c 89 ea             	mov    %r13,%rdx
+  8003be:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8003c5:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8003c8:	4c 89 ee             	mov    %r13,%rsi
+  8003cb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8003d2:	48 b8 cb 14 80 00 00 	movabs $0x8014cb,%rax
+  8003d9:	00 00 00 
+  8003dc:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8003de:	41 01 dc             	add    %ebx,%r12d
+  8003e1:	49 63 f4             	movslq %r12d,%rsi
+  8003e4:	4c 39 f6             	cmp    %r14,%rsi
+  8003e7:	72 b3                	jb     80039c <devcons_write+0x38>
+    return res;
+  8003e9:	49 63 c4             	movslq %r12d,%rax
+}
+  8003ec:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8003f3:	5b                   	pop    %rbx
+  8003f4:	41 5c                	pop    %r12
+  8003f6:	41 5d                	pop    %r13
+  8003f8:	41 5e                	pop    %r14
+  8003fa:	41 5f                	pop    %r15
+  8003fc:	5d                   	pop    %rbp
+  8003fd:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8003fe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800404:	eb e3                	jmp    8003e9 <devcons_write+0x85>
+
+0000000000800406 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800406:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  800409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80040e:	48 85 c0             	test   %rax,%rax
+  800411:	74 55                	je     800468 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800413:	55                   	push   %rbp
+  800414:	48 89 e5             	mov    %rsp,%rbp
+  800417:	41 55                	push   %r13
+  800419:	41 54                	push   %r12
+  80041b:	53                   	push   %rbx
+  80041c:	48 83 ec 08          	sub    $0x8,%rsp
+  800420:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  800423:	48 bb f8 14 80 00 00 	movabs $0x8014f8,%rbx
+  80042a:	00 00 00 
+  80042d:	49 bc c5 15 80 00 00 	movabs $0x8015c5,%r12
+  800434:	00 00 00 
+  800437:	eb 03                	jmp    80043c <devcons_read+0x36>
+  800439:	41 ff d4             	call   *%r12
+  80043c:	ff d3                	call   *%rbx
+  80043e:	85 c0                	test   %eax,%eax
+  800440:	74 f7                	je     800439 <devcons_read+0x33>
+    if (c < 0) return c;
+  800442:	48 63 d0             	movslq %eax,%rdx
+  800445:	78 13                	js     80045a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  800447:	ba 00 00 00 00       	mov    $0x0,%edx
+  80044c:	83 f8 04             	cmp    $0x4,%eax
+  80044f:	74 09                	je     80045a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  800451:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  800455:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80045a:	48 89 d0             	mov    %rdx,%rax
+  80045d:	48 83 c4 08          	add    $0x8,%rsp
+  800461:	5b                   	pop    %rbx
+  800462:	41 5c                	pop    %r12
+  800464:	41 5d                	pop    %r13
+  800466:	5d                   	pop    %rbp
+  800467:	c3                   	ret
+  800468:	48 89 d0             	mov    %rdx,%rax
+  80046b:	c3                   	ret
+
+000000000080046c <cputchar>:
+cputchar(int ch) {
+  80046c:	55                   	push   %rbp
+  80046d:	48 89 e5             	mov    %rsp,%rbp
+  800470:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  800474:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  800478:	be 01 00 00 00       	mov    $0x1,%esi
+  80047d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  800481:	48 b8 cb 14 80 00 00 	movabs $0x8014cb,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+}
+  80048d:	c9                   	leave
+  80048e:	c3                   	ret
+
+000000000080048f <getchar>:
+getchar(void) {
+  80048f:	55                   	push   %rbp
+  800490:	48 89 e5             	mov    %rsp,%rbp
+  800493:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  800497:	ba 01 00 00 00       	mov    $0x1,%edx
+  80049c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8004a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004a5:	48 b8 67 1f 80 00 00 	movabs $0x801f67,%rax
+  8004ac:	00 00 00 
+  8004af:	ff d0                	call   *%rax
+  8004b1:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8004b3:	85 c0                	test   %eax,%eax
+  8004b5:	78 06                	js     8004bd <getchar+0x2e>
+  8004b7:	74 08                	je     8004c1 <getchar+0x32>
+  8004b9:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8004bd:	89 d0                	mov    %edx,%eax
+  8004bf:	c9                   	leave
+  8004c0:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8004c1:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8004c6:	eb f5                	jmp    8004bd <getchar+0x2e>
+
+00000000008004c8 <iscons>:
+iscons(int fdnum) {
+  8004c8:	55                   	push   %rbp
+  8004c9:	48 89 e5             	mov    %rsp,%rbp
+  8004cc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8004d0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8004d4:	48 b8 84 1c 80 00 00 	movabs $0x801c84,%rax
+  8004db:	00 00 00 
+  8004de:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8004e0:	85 c0                	test   %eax,%eax
+  8004e2:	78 18                	js     8004fc <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8004e4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004e8:	48 b8 80 67 80 00 00 	movabs $0x806780,%rax
+  8004ef:	00 00 00 
+  8004f2:	8b 00                	mov    (%rax),%eax
+  8004f4:	39 02                	cmp    %eax,(%rdx)
+  8004f6:	0f 94 c0             	sete   %al
+  8004f9:	0f b6 c0             	movzbl %al,%eax
+}
+  8004fc:	c9                   	leave
+  8004fd:	c3                   	ret
+
+00000000008004fe <opencons>:
+opencons(void) {
+  8004fe:	55                   	push   %rbp
+  8004ff:	48 89 e5             	mov    %rsp,%rbp
+  800502:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  800506:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80050a:	48 b8 24 1c 80 00 00 	movabs $0x801c24,%rax
+  800511:	00 00 00 
+  800514:	ff d0                	call   *%rax
+  800516:	85 c0                	test   %eax,%eax
+  800518:	78 49                	js     800563 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80051a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80051f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800524:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800528:	bf 00 00 00 00       	mov    $0x0,%edi
+  80052d:	48 b8 54 16 80 00 00 	movabs $0x801654,%rax
+  800534:	00 00 00 
+  800537:	ff d0                	call   *%rax
+  800539:	85 c0                	test   %eax,%eax
+  80053b:	78 26                	js     800563 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80053d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800541:	a1 80 67 80 00 00 00 	movabs 0x806780,%eax
+  800548:	00 00 
+  80054a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80054c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800550:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800557:	48 b8 f6 1b 80 00 00 	movabs $0x801bf6,%rax
+  80055e:	00 00 00 
+  800561:	ff d0                	call   *%rax
+}
+  800563:	c9                   	leave
+  800564:	c3                   	ret
+
+0000000000800565 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800565:	55                   	push   %rbp
+  800566:	48 89 e5             	mov    %rsp,%rbp
+  800569:	41 56                	push   %r14
+  80056b:	41 55                	push   %r13
+  80056d:	41 54                	push   %r12
+  80056f:	53                   	push   %rbx
+  800570:	41 89 fd             	mov    %edi,%r13d
+  800573:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800576:	48 ba 38 68 80 00 00 	movabs $0x806838,%rdx
+  80057d:	00 00 00 
+  800580:	48 b8 38 68 80 00 00 	movabs $0x806838,%rax
+  800587:	00 00 00 
+  80058a:	48 39 c2             	cmp    %rax,%rdx
+  80058d:	73 17                	jae    8005a6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80058f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800592:	49 89 c4             	mov    %rax,%r12
+  800595:	48 83 c3 08          	add    $0x8,%rbx
+  800599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80059e:	ff 53 f8             	call   *-0x8(%rbx)
+  8005a1:	4c 39 e3             	cmp    %r12,%rbx
+  8005a4:	72 ef                	jb     800595 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8005a6:	48 b8 94 15 80 00 00 	movabs $0x801594,%rax
+  8005ad:	00 00 00 
+  8005b0:	ff d0                	call   *%rax
+  8005b2:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8005b5:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8005bc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8005c3:	00 00 00 
+  8005c6:	48 01 d0             	add    %rdx,%rax
+  8005c9:	48 a3 70 87 80 00 00 	movabs %rax,0x808770
+  8005d0:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8005d3:	45 85 ed             	test   %r13d,%r13d
+  8005d6:	7e 0d                	jle    8005e5 <libmain+0x80>
+  8005d8:	49 8b 06             	mov    (%r14),%rax
+  8005db:	48 a3 b8 67 80 00 00 	movabs %rax,0x8067b8
+  8005e2:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8005e5:	4c 89 f6             	mov    %r14,%rsi
+  8005e8:	44 89 ef             	mov    %r13d,%edi
+  8005eb:	48 b8 52 00 80 00 00 	movabs $0x800052,%rax
+  8005f2:	00 00 00 
+  8005f5:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8005f7:	48 b8 0c 06 80 00 00 	movabs $0x80060c,%rax
+  8005fe:	00 00 00 
+  800601:	ff d0                	call   *%rax
+#endif
+}
+  800603:	5b                   	pop    %rbx
+  800604:	41 5c                	pop    %r12
+  800606:	41 5d                	pop    %r13
+  800608:	41 5e                	pop    %r14
+  80060a:	5d                   	pop    %rbp
+  80060b:	c3                   	ret
+
+000000000080060c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80060c:	55                   	push   %rbp
+  80060d:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800610:	48 b8 1c 1e 80 00 00 	movabs $0x801e1c,%rax
+  800617:	00 00 00 
+  80061a:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80061c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800621:	48 b8 29 15 80 00 00 	movabs $0x801529,%rax
+  800628:	00 00 00 
+  80062b:	ff d0                	call   *%rax
+}
+  80062d:	5d                   	pop    %rbp
+  80062e:	c3                   	ret
+
+000000000080062f <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80062f:	55                   	push   %rbp
+  800630:	48 89 e5             	mov    %rsp,%rbp
+  800633:	41 56                	push   %r14
+  800635:	41 55                	push   %r13
+  800637:	41 54                	push   %r12
+  800639:	53                   	push   %rbx
+  80063a:	48 83 ec 50          	sub    $0x50,%rsp
+  80063e:	49 89 fc             	mov    %rdi,%r12
+  800641:	41 89 f5             	mov    %esi,%r13d
+  800644:	48 89 d3             	mov    %rdx,%rbx
+  800647:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80064b:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80064f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800653:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80065a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80065e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800662:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800666:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80066a:	48 b8 b8 67 80 00 00 	movabs $0x8067b8,%rax
+  800671:	00 00 00 
+  800674:	4c 8b 30             	mov    (%rax),%r14
+  800677:	48 b8 94 15 80 00 00 	movabs $0x801594,%rax
+  80067e:	00 00 00 
+  800681:	ff d0                	call   *%rax
+  800683:	89 c6                	mov    %eax,%esi
+  800685:	45 89 e8             	mov    %r13d,%r8d
+  800688:	4c 89 e1             	mov    %r12,%rcx
+  80068b:	4c 89 f2             	mov    %r14,%rdx
+  80068e:	48 bf 70 38 80 00 00 	movabs $0x803870,%rdi
+  800695:	00 00 00 
+  800698:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069d:	49 bc 7f 07 80 00 00 	movabs $0x80077f,%r12
+  8006a4:	00 00 00 
+  8006a7:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8006aa:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8006ae:	48 89 df             	mov    %rbx,%rdi
+  8006b1:	48 b8 1b 07 80 00 00 	movabs $0x80071b,%rax
+  8006b8:	00 00 00 
+  8006bb:	ff d0                	call   *%rax
+    cprintf("\n");
+  8006bd:	48 bf 5b 3e 80 00 00 	movabs $0x803e5b,%rdi
+  8006c4:	00 00 00 
+  8006c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006cc:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8006cf:	cc                   	int3
+  8006d0:	eb fd                	jmp    8006cf <_panic+0xa0>
+
+00000000008006d2 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8006d2:	55                   	push   %rbp
+  8006d3:	48 89 e5             	mov    %rsp,%rbp
+  8006d6:	53                   	push   %rbx
+  8006d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8006db:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8006de:	8b 06                	mov    (%rsi),%eax
+  8006e0:	8d 50 01             	lea    0x1(%rax),%edx
+  8006e3:	89 16                	mov    %edx,(%rsi)
+  8006e5:	48 98                	cltq
+  8006e7:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8006ec:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8006f2:	74 0a                	je     8006fe <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8006f4:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8006f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006fc:	c9                   	leave
+  8006fd:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8006fe:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800702:	be ff 00 00 00       	mov    $0xff,%esi
+  800707:	48 b8 cb 14 80 00 00 	movabs $0x8014cb,%rax
+  80070e:	00 00 00 
+  800711:	ff d0                	call   *%rax
+        state->offset = 0;
+  800713:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800719:	eb d9                	jmp    8006f4 <putch+0x22>
+
+000000000080071b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80071b:	55                   	push   %rbp
+  80071c:	48 89 e5             	mov    %rsp,%rbp
+  80071f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800726:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800729:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800730:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800735:	b8 00 00 00 00       	mov    $0x0,%eax
+  80073a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80073d:	48 89 f1             	mov    %rsi,%rcx
+  800740:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800747:	48 bf d2 06 80 00 00 	movabs $0x8006d2,%rdi
+  80074e:	00 00 00 
+  800751:	48 b8 cf 08 80 00 00 	movabs $0x8008cf,%rax
+  800758:	00 00 00 
+  80075b:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80075d:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800764:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80076b:	48 b8 cb 14 80 00 00 	movabs $0x8014cb,%rax
+  800772:	00 00 00 
+  800775:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800777:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80077d:	c9                   	leave
+  80077e:	c3                   	ret
+
+000000000080077f <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80077f:	55                   	push   %rbp
+  800780:	48 89 e5             	mov    %rsp,%rbp
+  800783:	48 83 ec 50          	sub    $0x50,%rsp
+  800787:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80078b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80078f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800793:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800797:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80079b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8007a2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007aa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8007ae:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8007b2:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8007b6:	48 b8 1b 07 80 00 00 	movabs $0x80071b,%rax
+  8007bd:	00 00 00 
+  8007c0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8007c2:	c9                   	leave
+  8007c3:	c3                   	ret
+
+00000000008007c4 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8007c4:	55                   	push   %rbp
+  8007c5:	48 89 e5             	mov    %rsp,%rbp
+  8007c8:	41 57                	push   %r15
+  8007ca:	41 56                	push   %r14
+  8007cc:	41 55                	push   %r13
+  8007ce:	41 54                	push   %r12
+  8007d0:	53                   	push   %rbx
+  8007d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8007d5:	49 89 fc             	mov    %rdi,%r12
+  8007d8:	49 89 f5             	mov    %rsi,%r13
+  8007db:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8007df:	8b 45 10             	mov    0x10(%rbp),%eax
+  8007e2:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8007e5:	41 89 cf             	mov    %ecx,%r15d
+  8007e8:	4c 39 fa             	cmp    %r15,%rdx
+  8007eb:	73 5b                	jae    800848 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8007ed:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8007f1:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8007f5:	85 db                	test   %ebx,%ebx
+  8007f7:	7e 0e                	jle    800807 <print_num+0x43>
+            putch(padc, put_arg);
+  8007f9:	4c 89 ee             	mov    %r13,%rsi
+  8007fc:	44 89 f7             	mov    %r14d,%edi
+  8007ff:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800802:	83 eb 01             	sub    $0x1,%ebx
+  800805:	75 f2                	jne    8007f9 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800807:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80080b:	48 b9 a4 38 80 00 00 	movabs $0x8038a4,%rcx
+  800812:	00 00 00 
+  800815:	48 b8 93 38 80 00 00 	movabs $0x803893,%rax
+  80081c:	00 00 00 
+  80081f:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800823:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800827:	ba 00 00 00 00       	mov    $0x0,%edx
+  80082c:	49 f7 f7             	div    %r15
+  80082f:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800833:	4c 89 ee             	mov    %r13,%rsi
+  800836:	41 ff d4             	call   *%r12
+}
+  800839:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80083d:	5b                   	pop    %rbx
+  80083e:	41 5c                	pop    %r12
+  800840:	41 5d                	pop    %r13
+  800842:	41 5e                	pop    %r14
+  800844:	41 5f                	pop    %r15
+  800846:	5d                   	pop    %rbp
+  800847:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800848:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80084c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800851:	49 f7 f7             	div    %r15
+  800854:	48 83 ec 08          	sub    $0x8,%rsp
+  800858:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80085c:	52                   	push   %rdx
+  80085d:	45 0f be c9          	movsbl %r9b,%r9d
+  800861:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800865:	48 89 c2             	mov    %rax,%rdx
+  800868:	48 b8 c4 07 80 00 00 	movabs $0x8007c4,%rax
+  80086f:	00 00 00 
+  800872:	ff d0                	call   *%rax
+  800874:	48 83 c4 10          	add    $0x10,%rsp
+  800878:	eb 8d                	jmp    800807 <print_num+0x43>
+
+000000000080087a <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80087a:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80087e:	48 8b 06             	mov    (%rsi),%rax
+  800881:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800885:	73 0a                	jae    800891 <sprintputch+0x17>
+        *state->start++ = ch;
+  800887:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80088b:	48 89 16             	mov    %rdx,(%rsi)
+  80088e:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800891:	c3                   	ret
+
+0000000000800892 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800892:	55                   	push   %rbp
+  800893:	48 89 e5             	mov    %rsp,%rbp
+  800896:	48 83 ec 50          	sub    $0x50,%rsp
+  80089a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80089e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8008a2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8008a6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8008ad:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8008b9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8008bd:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8008c1:	48 b8 cf 08 80 00 00 	movabs $0x8008cf,%rax
+  8008c8:	00 00 00 
+  8008cb:	ff d0                	call   *%rax
+}
+  8008cd:	c9                   	leave
+  8008ce:	c3                   	ret
+
+00000000008008cf <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8008cf:	55                   	push   %rbp
+  8008d0:	48 89 e5             	mov    %rsp,%rbp
+  8008d3:	41 57                	push   %r15
+  8008d5:	41 56                	push   %r14
+  8008d7:	41 55                	push   %r13
+  8008d9:	41 54                	push   %r12
+  8008db:	53                   	push   %rbx
+  8008dc:	48 83 ec 38          	sub    $0x38,%rsp
+  8008e0:	49 89 fe             	mov    %rdi,%r14
+  8008e3:	49 89 f5             	mov    %rsi,%r13
+  8008e6:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8008e9:	48 8b 01             	mov    (%rcx),%rax
+  8008ec:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8008f0:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8008f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f8:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8008fc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800900:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800904:	0f b6 3b             	movzbl (%rbx),%edi
+  800907:	40 80 ff 25          	cmp    $0x25,%dil
+  80090b:	74 18                	je     800925 <vprintfmt+0x56>
+            if (!ch) return;
+  80090d:	40 84 ff             	test   %dil,%dil
+  800910:	0f 84 b1 06 00 00    	je     800fc7 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800916:	40 0f b6 ff          	movzbl %dil,%edi
+  80091a:	4c 89 ee             	mov    %r13,%rsi
+  80091d:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800920:	4c 89 e3             	mov    %r12,%rbx
+  800923:	eb db                	jmp    800900 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800925:	be 00 00 00 00       	mov    $0x0,%esi
+  80092a:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80092e:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800933:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800939:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800940:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800944:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800949:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80094e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800951:	83 e8 23             	sub    $0x23,%eax
+  800954:	3c 57                	cmp    $0x57,%al
+  800956:	0f 87 51 06 00 00    	ja     800fad <vprintfmt+0x6de>
+  80095c:	0f b6 c0             	movzbl %al,%eax
+  80095f:	48 b9 40 3a 80 00 00 	movabs $0x803a40,%rcx
+  800966:	00 00 00 
+  800969:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80096c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80096f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800973:	eb cf                	jmp    800944 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800975:	49 89 dc             	mov    %rbx,%r12
+  800978:	be 01 00 00 00       	mov    $0x1,%esi
+  80097d:	eb c5                	jmp    800944 <vprintfmt+0x75>
+            padc = ch;
+  80097f:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800983:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800986:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800989:	eb b9                	jmp    800944 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80098b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098e:	83 f8 2f             	cmp    $0x2f,%eax
+  800991:	77 24                	ja     8009b7 <vprintfmt+0xe8>
+  800993:	89 c1                	mov    %eax,%ecx
+  800995:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800999:	83 c0 08             	add    $0x8,%eax
+  80099c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8009a2:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8009a5:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009a9:	79 99                	jns    800944 <vprintfmt+0x75>
+                width = precision;
+  8009ab:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8009af:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8009b5:	eb 8d                	jmp    800944 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8009b7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8009bb:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8009bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c3:	eb da                	jmp    80099f <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8009c5:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8009ca:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8009ce:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8009d4:	3c 39                	cmp    $0x39,%al
+  8009d6:	77 1c                	ja     8009f4 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8009d8:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8009dc:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8009e0:	0f b6 c0             	movzbl %al,%eax
+  8009e3:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8009e8:	0f b6 03             	movzbl (%rbx),%eax
+  8009eb:	3c 39                	cmp    $0x39,%al
+  8009ed:	76 e9                	jbe    8009d8 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8009ef:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8009f2:	eb b1                	jmp    8009a5 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8009f4:	49 89 dc             	mov    %rbx,%r12
+  8009f7:	eb ac                	jmp    8009a5 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8009f9:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8009fc:	85 c9                	test   %ecx,%ecx
+  8009fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a03:	0f 49 c1             	cmovns %ecx,%eax
+  800a06:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800a09:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a0c:	e9 33 ff ff ff       	jmp    800944 <vprintfmt+0x75>
+            lflag++;
+  800a11:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800a14:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a17:	e9 28 ff ff ff       	jmp    800944 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800a1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a22:	77 19                	ja     800a3d <vprintfmt+0x16e>
+  800a24:	89 c2                	mov    %eax,%edx
+  800a26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2a:	83 c0 08             	add    $0x8,%eax
+  800a2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a30:	8b 3a                	mov    (%rdx),%edi
+  800a32:	4c 89 ee             	mov    %r13,%rsi
+  800a35:	41 ff d6             	call   *%r14
+            break;
+  800a38:	e9 c3 fe ff ff       	jmp    800900 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800a3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a49:	eb e5                	jmp    800a30 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800a4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a51:	77 5a                	ja     800aad <vprintfmt+0x1de>
+  800a53:	89 c2                	mov    %eax,%edx
+  800a55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a59:	83 c0 08             	add    $0x8,%eax
+  800a5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800a5f:	8b 02                	mov    (%rdx),%eax
+  800a61:	89 c1                	mov    %eax,%ecx
+  800a63:	f7 d9                	neg    %ecx
+  800a65:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800a68:	83 f9 15             	cmp    $0x15,%ecx
+  800a6b:	7f 4e                	jg     800abb <vprintfmt+0x1ec>
+  800a6d:	48 63 c1             	movslq %ecx,%rax
+  800a70:	48 ba 00 3d 80 00 00 	movabs $0x803d00,%rdx
+  800a77:	00 00 00 
+  800a7a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800a7e:	48 85 c0             	test   %rax,%rax
+  800a81:	74 38                	je     800abb <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800a83:	48 89 c1             	mov    %rax,%rcx
+  800a86:	48 ba 2c 3f 80 00 00 	movabs $0x803f2c,%rdx
+  800a8d:	00 00 00 
+  800a90:	4c 89 ee             	mov    %r13,%rsi
+  800a93:	4c 89 f7             	mov    %r14,%rdi
+  800a96:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a9b:	49 b8 92 08 80 00 00 	movabs $0x800892,%r8
+  800aa2:	00 00 00 
+  800aa5:	41 ff d0             	call   *%r8
+  800aa8:	e9 53 fe ff ff       	jmp    800900 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800aad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab9:	eb a4                	jmp    800a5f <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800abb:	48 ba bc 38 80 00 00 	movabs $0x8038bc,%rdx
+  800ac2:	00 00 00 
+  800ac5:	4c 89 ee             	mov    %r13,%rsi
+  800ac8:	4c 89 f7             	mov    %r14,%rdi
+  800acb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad0:	49 b8 92 08 80 00 00 	movabs $0x800892,%r8
+  800ad7:	00 00 00 
+  800ada:	41 ff d0             	call   *%r8
+  800add:	e9 1e fe ff ff       	jmp    800900 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800ae2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae8:	77 6c                	ja     800b56 <vprintfmt+0x287>
+  800aea:	89 c2                	mov    %eax,%edx
+  800aec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af0:	83 c0 08             	add    $0x8,%eax
+  800af3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af6:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800af9:	48 85 d2             	test   %rdx,%rdx
+  800afc:	48 b8 b5 38 80 00 00 	movabs $0x8038b5,%rax
+  800b03:	00 00 00 
+  800b06:	48 0f 45 c2          	cmovne %rdx,%rax
+  800b0a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800b0e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b12:	7e 06                	jle    800b1a <vprintfmt+0x24b>
+  800b14:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800b18:	75 4a                	jne    800b64 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800b1a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b1e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800b22:	0f b6 00             	movzbl (%rax),%eax
+  800b25:	84 c0                	test   %al,%al
+  800b27:	0f 85 9a 00 00 00    	jne    800bc7 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800b2d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b30:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800b34:	85 c0                	test   %eax,%eax
+  800b36:	0f 8e c4 fd ff ff    	jle    800900 <vprintfmt+0x31>
+  800b3c:	4c 89 ee             	mov    %r13,%rsi
+  800b3f:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b44:	41 ff d6             	call   *%r14
+  800b47:	41 83 ec 01          	sub    $0x1,%r12d
+  800b4b:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800b4f:	75 eb                	jne    800b3c <vprintfmt+0x26d>
+  800b51:	e9 aa fd ff ff       	jmp    800900 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800b56:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b62:	eb 92                	jmp    800af6 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800b64:	49 63 f7             	movslq %r15d,%rsi
+  800b67:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800b6b:	48 b8 81 10 80 00 00 	movabs $0x801081,%rax
+  800b72:	00 00 00 
+  800b75:	ff d0                	call   *%rax
+  800b77:	48 89 c2             	mov    %rax,%rdx
+  800b7a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b7d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800b7f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800b82:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800b85:	85 c0                	test   %eax,%eax
+  800b87:	7e 91                	jle    800b1a <vprintfmt+0x24b>
+  800b89:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800b8e:	4c 89 ee             	mov    %r13,%rsi
+  800b91:	44 89 e7             	mov    %r12d,%edi
+  800b94:	41 ff d6             	call   *%r14
+  800b97:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800b9b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b9e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800ba1:	75 eb                	jne    800b8e <vprintfmt+0x2bf>
+  800ba3:	e9 72 ff ff ff       	jmp    800b1a <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800ba8:	0f b6 f8             	movzbl %al,%edi
+  800bab:	4c 89 ee             	mov    %r13,%rsi
+  800bae:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800bb1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800bb5:	49 83 c4 01          	add    $0x1,%r12
+  800bb9:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800bbf:	84 c0                	test   %al,%al
+  800bc1:	0f 84 66 ff ff ff    	je     800b2d <vprintfmt+0x25e>
+  800bc7:	45 85 ff             	test   %r15d,%r15d
+  800bca:	78 0a                	js     800bd6 <vprintfmt+0x307>
+  800bcc:	41 83 ef 01          	sub    $0x1,%r15d
+  800bd0:	0f 88 57 ff ff ff    	js     800b2d <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800bd6:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800bda:	74 cc                	je     800ba8 <vprintfmt+0x2d9>
+  800bdc:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800bdf:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800be4:	80 fa 5e             	cmp    $0x5e,%dl
+  800be7:	77 c2                	ja     800bab <vprintfmt+0x2dc>
+  800be9:	eb bd                	jmp    800ba8 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800beb:	40 84 f6             	test   %sil,%sil
+  800bee:	75 26                	jne    800c16 <vprintfmt+0x347>
+    switch (lflag) {
+  800bf0:	85 d2                	test   %edx,%edx
+  800bf2:	74 59                	je     800c4d <vprintfmt+0x37e>
+  800bf4:	83 fa 01             	cmp    $0x1,%edx
+  800bf7:	74 7b                	je     800c74 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800bf9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bfc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bff:	0f 87 96 00 00 00    	ja     800c9b <vprintfmt+0x3cc>
+  800c05:	89 c2                	mov    %eax,%edx
+  800c07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0b:	83 c0 08             	add    $0x8,%eax
+  800c0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c11:	4c 8b 22             	mov    (%rdx),%r12
+  800c14:	eb 17                	jmp    800c2d <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800c16:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c19:	83 f8 2f             	cmp    $0x2f,%eax
+  800c1c:	77 21                	ja     800c3f <vprintfmt+0x370>
+  800c1e:	89 c2                	mov    %eax,%edx
+  800c20:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c24:	83 c0 08             	add    $0x8,%eax
+  800c27:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c2a:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800c2d:	4d 85 e4             	test   %r12,%r12
+  800c30:	78 7a                	js     800cac <vprintfmt+0x3dd>
+            num = i;
+  800c32:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800c35:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800c3a:	e9 50 02 00 00       	jmp    800e8f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c43:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c4b:	eb dd                	jmp    800c2a <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800c4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c50:	83 f8 2f             	cmp    $0x2f,%eax
+  800c53:	77 11                	ja     800c66 <vprintfmt+0x397>
+  800c55:	89 c2                	mov    %eax,%edx
+  800c57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c5b:	83 c0 08             	add    $0x8,%eax
+  800c5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c61:	4c 63 22             	movslq (%rdx),%r12
+  800c64:	eb c7                	jmp    800c2d <vprintfmt+0x35e>
+  800c66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c72:	eb ed                	jmp    800c61 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800c74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c77:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7a:	77 11                	ja     800c8d <vprintfmt+0x3be>
+  800c7c:	89 c2                	mov    %eax,%edx
+  800c7e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c82:	83 c0 08             	add    $0x8,%eax
+  800c85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c88:	4c 8b 22             	mov    (%rdx),%r12
+  800c8b:	eb a0                	jmp    800c2d <vprintfmt+0x35e>
+  800c8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c99:	eb ed                	jmp    800c88 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800c9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca7:	e9 65 ff ff ff       	jmp    800c11 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800cac:	4c 89 ee             	mov    %r13,%rsi
+  800caf:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800cb4:	41 ff d6             	call   *%r14
+                i = -i;
+  800cb7:	49 f7 dc             	neg    %r12
+  800cba:	e9 73 ff ff ff       	jmp    800c32 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800cbf:	40 84 f6             	test   %sil,%sil
+  800cc2:	75 32                	jne    800cf6 <vprintfmt+0x427>
+    switch (lflag) {
+  800cc4:	85 d2                	test   %edx,%edx
+  800cc6:	74 5d                	je     800d25 <vprintfmt+0x456>
+  800cc8:	83 fa 01             	cmp    $0x1,%edx
+  800ccb:	0f 84 82 00 00 00    	je     800d53 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800cd1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd4:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd7:	0f 87 a5 00 00 00    	ja     800d82 <vprintfmt+0x4b3>
+  800cdd:	89 c2                	mov    %eax,%edx
+  800cdf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ce3:	83 c0 08             	add    $0x8,%eax
+  800ce6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ce9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800cec:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cf1:	e9 99 01 00 00       	jmp    800e8f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800cf6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf9:	83 f8 2f             	cmp    $0x2f,%eax
+  800cfc:	77 19                	ja     800d17 <vprintfmt+0x448>
+  800cfe:	89 c2                	mov    %eax,%edx
+  800d00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d04:	83 c0 08             	add    $0x8,%eax
+  800d07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d0d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d12:	e9 78 01 00 00       	jmp    800e8f <vprintfmt+0x5c0>
+  800d17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d23:	eb e5                	jmp    800d0a <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800d25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d28:	83 f8 2f             	cmp    $0x2f,%eax
+  800d2b:	77 18                	ja     800d45 <vprintfmt+0x476>
+  800d2d:	89 c2                	mov    %eax,%edx
+  800d2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d33:	83 c0 08             	add    $0x8,%eax
+  800d36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d39:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800d3b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800d40:	e9 4a 01 00 00       	jmp    800e8f <vprintfmt+0x5c0>
+  800d45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d51:	eb e6                	jmp    800d39 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800d53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d56:	83 f8 2f             	cmp    $0x2f,%eax
+  800d59:	77 19                	ja     800d74 <vprintfmt+0x4a5>
+  800d5b:	89 c2                	mov    %eax,%edx
+  800d5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d61:	83 c0 08             	add    $0x8,%eax
+  800d64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d67:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d6a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800d6f:	e9 1b 01 00 00       	jmp    800e8f <vprintfmt+0x5c0>
+  800d74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d80:	eb e5                	jmp    800d67 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800d82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d8e:	e9 56 ff ff ff       	jmp    800ce9 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800d93:	40 84 f6             	test   %sil,%sil
+  800d96:	75 2e                	jne    800dc6 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800d98:	85 d2                	test   %edx,%edx
+  800d9a:	74 59                	je     800df5 <vprintfmt+0x526>
+  800d9c:	83 fa 01             	cmp    $0x1,%edx
+  800d9f:	74 7f                	je     800e20 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800da1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800da4:	83 f8 2f             	cmp    $0x2f,%eax
+  800da7:	0f 87 9f 00 00 00    	ja     800e4c <vprintfmt+0x57d>
+  800dad:	89 c2                	mov    %eax,%edx
+  800daf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800db3:	83 c0 08             	add    $0x8,%eax
+  800db6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800db9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800dbc:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800dc1:	e9 c9 00 00 00       	jmp    800e8f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800dc6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dc9:	83 f8 2f             	cmp    $0x2f,%eax
+  800dcc:	77 19                	ja     800de7 <vprintfmt+0x518>
+  800dce:	89 c2                	mov    %eax,%edx
+  800dd0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dd4:	83 c0 08             	add    $0x8,%eax
+  800dd7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dda:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ddd:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800de2:	e9 a8 00 00 00       	jmp    800e8f <vprintfmt+0x5c0>
+  800de7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800deb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800def:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800df3:	eb e5                	jmp    800dda <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800df5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800df8:	83 f8 2f             	cmp    $0x2f,%eax
+  800dfb:	77 15                	ja     800e12 <vprintfmt+0x543>
+  800dfd:	89 c2                	mov    %eax,%edx
+  800dff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e03:	83 c0 08             	add    $0x8,%eax
+  800e06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e09:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800e0b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800e10:	eb 7d                	jmp    800e8f <vprintfmt+0x5c0>
+  800e12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e1e:	eb e9                	jmp    800e09 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800e20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e23:	83 f8 2f             	cmp    $0x2f,%eax
+  800e26:	77 16                	ja     800e3e <vprintfmt+0x56f>
+  800e28:	89 c2                	mov    %eax,%edx
+  800e2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e2e:	83 c0 08             	add    $0x8,%eax
+  800e31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e34:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e37:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800e3c:	eb 51                	jmp    800e8f <vprintfmt+0x5c0>
+  800e3e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e42:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e46:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e4a:	eb e8                	jmp    800e34 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800e4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e58:	e9 5c ff ff ff       	jmp    800db9 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800e5d:	4c 89 ee             	mov    %r13,%rsi
+  800e60:	bf 30 00 00 00       	mov    $0x30,%edi
+  800e65:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800e68:	4c 89 ee             	mov    %r13,%rsi
+  800e6b:	bf 78 00 00 00       	mov    $0x78,%edi
+  800e70:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800e73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e76:	83 f8 2f             	cmp    $0x2f,%eax
+  800e79:	77 47                	ja     800ec2 <vprintfmt+0x5f3>
+  800e7b:	89 c2                	mov    %eax,%edx
+  800e7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e81:	83 c0 08             	add    $0x8,%eax
+  800e84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e87:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e8a:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800e8f:	48 83 ec 08          	sub    $0x8,%rsp
+  800e93:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800e97:	0f 94 c0             	sete   %al
+  800e9a:	0f b6 c0             	movzbl %al,%eax
+  800e9d:	50                   	push   %rax
+  800e9e:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ea3:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ea7:	4c 89 ee             	mov    %r13,%rsi
+  800eaa:	4c 89 f7             	mov    %r14,%rdi
+  800ead:	48 b8 c4 07 80 00 00 	movabs $0x8007c4,%rax
+  800eb4:	00 00 00 
+  800eb7:	ff d0                	call   *%rax
+            break;
+  800eb9:	48 83 c4 10          	add    $0x10,%rsp
+  800ebd:	e9 3e fa ff ff       	jmp    800900 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ec2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ec6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800eca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ece:	eb b7                	jmp    800e87 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ed0:	40 84 f6             	test   %sil,%sil
+  800ed3:	75 2b                	jne    800f00 <vprintfmt+0x631>
+    switch (lflag) {
+  800ed5:	85 d2                	test   %edx,%edx
+  800ed7:	74 56                	je     800f2f <vprintfmt+0x660>
+  800ed9:	83 fa 01             	cmp    $0x1,%edx
+  800edc:	74 7f                	je     800f5d <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800ede:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ee1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ee4:	0f 87 a2 00 00 00    	ja     800f8c <vprintfmt+0x6bd>
+  800eea:	89 c2                	mov    %eax,%edx
+  800eec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ef0:	83 c0 08             	add    $0x8,%eax
+  800ef3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ef6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ef9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800efe:	eb 8f                	jmp    800e8f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800f00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f03:	83 f8 2f             	cmp    $0x2f,%eax
+  800f06:	77 19                	ja     800f21 <vprintfmt+0x652>
+  800f08:	89 c2                	mov    %eax,%edx
+  800f0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f0e:	83 c0 08             	add    $0x8,%eax
+  800f11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f14:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f17:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f1c:	e9 6e ff ff ff       	jmp    800e8f <vprintfmt+0x5c0>
+  800f21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f2d:	eb e5                	jmp    800f14 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800f2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f32:	83 f8 2f             	cmp    $0x2f,%eax
+  800f35:	77 18                	ja     800f4f <vprintfmt+0x680>
+  800f37:	89 c2                	mov    %eax,%edx
+  800f39:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f3d:	83 c0 08             	add    $0x8,%eax
+  800f40:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f43:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800f45:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800f4a:	e9 40 ff ff ff       	jmp    800e8f <vprintfmt+0x5c0>
+  800f4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f5b:	eb e6                	jmp    800f43 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800f5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f60:	83 f8 2f             	cmp    $0x2f,%eax
+  800f63:	77 19                	ja     800f7e <vprintfmt+0x6af>
+  800f65:	89 c2                	mov    %eax,%edx
+  800f67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f6b:	83 c0 08             	add    $0x8,%eax
+  800f6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f71:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f74:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800f79:	e9 11 ff ff ff       	jmp    800e8f <vprintfmt+0x5c0>
+  800f7e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f82:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f8a:	eb e5                	jmp    800f71 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800f8c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f90:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f98:	e9 59 ff ff ff       	jmp    800ef6 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800f9d:	4c 89 ee             	mov    %r13,%rsi
+  800fa0:	bf 25 00 00 00       	mov    $0x25,%edi
+  800fa5:	41 ff d6             	call   *%r14
+            break;
+  800fa8:	e9 53 f9 ff ff       	jmp    800900 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800fad:	4c 89 ee             	mov    %r13,%rsi
+  800fb0:	bf 25 00 00 00       	mov    $0x25,%edi
+  800fb5:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800fb8:	48 83 eb 01          	sub    $0x1,%rbx
+  800fbc:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800fc0:	75 f6                	jne    800fb8 <vprintfmt+0x6e9>
+  800fc2:	e9 39 f9 ff ff       	jmp    800900 <vprintfmt+0x31>
+}
+  800fc7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800fcb:	5b                   	pop    %rbx
+  800fcc:	41 5c                	pop    %r12
+  800fce:	41 5d                	pop    %r13
+  800fd0:	41 5e                	pop    %r14
+  800fd2:	41 5f                	pop    %r15
+  800fd4:	5d                   	pop    %rbp
+  800fd5:	c3                   	ret
+
+0000000000800fd6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800fd6:	55                   	push   %rbp
+  800fd7:	48 89 e5             	mov    %rsp,%rbp
+  800fda:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800fde:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800fe2:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800fe7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800feb:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ff2:	48 85 ff             	test   %rdi,%rdi
+  800ff5:	74 2b                	je     801022 <vsnprintf+0x4c>
+  800ff7:	48 85 f6             	test   %rsi,%rsi
+  800ffa:	74 26                	je     801022 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ffc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801000:	48 bf 7a 08 80 00 00 	movabs $0x80087a,%rdi
+  801007:	00 00 00 
+  80100a:	48 b8 cf 08 80 00 00 	movabs $0x8008cf,%rax
+  801011:	00 00 00 
+  801014:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801016:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80101a:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80101d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801020:	c9                   	leave
+  801021:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801022:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801027:	eb f7                	jmp    801020 <vsnprintf+0x4a>
+
+0000000000801029 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801029:	55                   	push   %rbp
+  80102a:	48 89 e5             	mov    %rsp,%rbp
+  80102d:	48 83 ec 50          	sub    $0x50,%rsp
+  801031:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801035:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801039:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80103d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801044:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801048:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80104c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801050:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801054:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801058:	48 b8 d6 0f 80 00 00 	movabs $0x800fd6,%rax
+  80105f:	00 00 00 
+  801062:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801064:	c9                   	leave
+  801065:	c3                   	ret
+
+0000000000801066 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801066:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801069:	74 10                	je     80107b <strlen+0x15>
+    size_t n = 0;
+  80106b:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801070:	48 83 c0 01          	add    $0x1,%rax
+  801074:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801078:	75 f6                	jne    801070 <strlen+0xa>
+  80107a:	c3                   	ret
+    size_t n = 0;
+  80107b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801080:	c3                   	ret
+
+0000000000801081 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801081:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801084:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801089:	48 85 f6             	test   %rsi,%rsi
+  80108c:	74 11                	je     80109f <strnlen+0x1e>
+  80108e:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801092:	74 0c                	je     8010a0 <strnlen+0x1f>
+  801094:	48 83 c2 01          	add    $0x1,%rdx
+  801098:	48 39 d0             	cmp    %rdx,%rax
+  80109b:	75 f1                	jne    80108e <strnlen+0xd>
+  80109d:	eb 04                	jmp    8010a3 <strnlen+0x22>
+  80109f:	c3                   	ret
+  8010a0:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8010a3:	c3                   	ret
+
+00000000008010a4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8010a4:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8010a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ac:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8010b0:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8010b3:	48 83 c2 01          	add    $0x1,%rdx
+  8010b7:	84 c9                	test   %cl,%cl
+  8010b9:	75 f1                	jne    8010ac <strcpy+0x8>
+        ;
+    return res;
+}
+  8010bb:	c3                   	ret
+
+00000000008010bc <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8010bc:	55                   	push   %rbp
+  8010bd:	48 89 e5             	mov    %rsp,%rbp
+  8010c0:	41 54                	push   %r12
+  8010c2:	53                   	push   %rbx
+  8010c3:	48 89 fb             	mov    %rdi,%rbx
+  8010c6:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8010c9:	48 b8 66 10 80 00 00 	movabs $0x801066,%rax
+  8010d0:	00 00 00 
+  8010d3:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8010d5:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8010d9:	4c 89 e6             	mov    %r12,%rsi
+  8010dc:	48 b8 a4 10 80 00 00 	movabs $0x8010a4,%rax
+  8010e3:	00 00 00 
+  8010e6:	ff d0                	call   *%rax
+    return dst;
+}
+  8010e8:	48 89 d8             	mov    %rbx,%rax
+  8010eb:	5b                   	pop    %rbx
+  8010ec:	41 5c                	pop    %r12
+  8010ee:	5d                   	pop    %rbp
+  8010ef:	c3                   	ret
+
+00000000008010f0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8010f0:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8010f3:	48 85 d2             	test   %rdx,%rdx
+  8010f6:	74 1f                	je     801117 <strncpy+0x27>
+  8010f8:	48 01 fa             	add    %rdi,%rdx
+  8010fb:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8010fe:	48 83 c1 01          	add    $0x1,%rcx
+  801102:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801106:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80110a:	41 80 f8 01          	cmp    $0x1,%r8b
+  80110e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801112:	48 39 ca             	cmp    %rcx,%rdx
+  801115:	75 e7                	jne    8010fe <strncpy+0xe>
+    }
+    return ret;
+}
+  801117:	c3                   	ret
+
+0000000000801118 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801118:	48 89 f8             	mov    %rdi,%rax
+  80111b:	48 85 d2             	test   %rdx,%rdx
+  80111e:	74 24                	je     801144 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801120:	48 83 ea 01          	sub    $0x1,%rdx
+  801124:	74 1b                	je     801141 <strlcpy+0x29>
+  801126:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80112a:	0f b6 16             	movzbl (%rsi),%edx
+  80112d:	84 d2                	test   %dl,%dl
+  80112f:	74 10                	je     801141 <strlcpy+0x29>
+            *dst++ = *src++;
+  801131:	48 83 c6 01          	add    $0x1,%rsi
+  801135:	48 83 c0 01          	add    $0x1,%rax
+  801139:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80113c:	48 39 c8             	cmp    %rcx,%rax
+  80113f:	75 e9                	jne    80112a <strlcpy+0x12>
+        *dst = '\0';
+  801141:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801144:	48 29 f8             	sub    %rdi,%rax
+}
+  801147:	c3                   	ret
+
+0000000000801148 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801148:	0f b6 07             	movzbl (%rdi),%eax
+  80114b:	84 c0                	test   %al,%al
+  80114d:	74 13                	je     801162 <strcmp+0x1a>
+  80114f:	38 06                	cmp    %al,(%rsi)
+  801151:	75 0f                	jne    801162 <strcmp+0x1a>
+  801153:	48 83 c7 01          	add    $0x1,%rdi
+  801157:	48 83 c6 01          	add    $0x1,%rsi
+  80115b:	0f b6 07             	movzbl (%rdi),%eax
+  80115e:	84 c0                	test   %al,%al
+  801160:	75 ed                	jne    80114f <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801162:	0f b6 c0             	movzbl %al,%eax
+  801165:	0f b6 16             	movzbl (%rsi),%edx
+  801168:	29 d0                	sub    %edx,%eax
+}
+  80116a:	c3                   	ret
+
+000000000080116b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80116b:	48 85 d2             	test   %rdx,%rdx
+  80116e:	74 1f                	je     80118f <strncmp+0x24>
+  801170:	0f b6 07             	movzbl (%rdi),%eax
+  801173:	84 c0                	test   %al,%al
+  801175:	74 1e                	je     801195 <strncmp+0x2a>
+  801177:	3a 06                	cmp    (%rsi),%al
+  801179:	75 1a                	jne    801195 <strncmp+0x2a>
+  80117b:	48 83 c7 01          	add    $0x1,%rdi
+  80117f:	48 83 c6 01          	add    $0x1,%rsi
+  801183:	48 83 ea 01          	sub    $0x1,%rdx
+  801187:	75 e7                	jne    801170 <strncmp+0x5>
+
+    if (!n) return 0;
+  801189:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118e:	c3                   	ret
+  80118f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801194:	c3                   	ret
+  801195:	48 85 d2             	test   %rdx,%rdx
+  801198:	74 09                	je     8011a3 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80119a:	0f b6 07             	movzbl (%rdi),%eax
+  80119d:	0f b6 16             	movzbl (%rsi),%edx
+  8011a0:	29 d0                	sub    %edx,%eax
+  8011a2:	c3                   	ret
+    if (!n) return 0;
+  8011a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011a8:	c3                   	ret
+
+00000000008011a9 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8011a9:	0f b6 17             	movzbl (%rdi),%edx
+  8011ac:	84 d2                	test   %dl,%dl
+  8011ae:	74 18                	je     8011c8 <strchr+0x1f>
+        if (*str == c) {
+  8011b0:	0f be d2             	movsbl %dl,%edx
+  8011b3:	39 f2                	cmp    %esi,%edx
+  8011b5:	74 17                	je     8011ce <strchr+0x25>
+    for (; *str; str++) {
+  8011b7:	48 83 c7 01          	add    $0x1,%rdi
+  8011bb:	0f b6 17             	movzbl (%rdi),%edx
+  8011be:	84 d2                	test   %dl,%dl
+  8011c0:	75 ee                	jne    8011b0 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8011c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c7:	c3                   	ret
+  8011c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011cd:	c3                   	ret
+  8011ce:	48 89 f8             	mov    %rdi,%rax
+}
+  8011d1:	c3                   	ret
+
+00000000008011d2 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8011d2:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8011d5:	0f b6 17             	movzbl (%rdi),%edx
+  8011d8:	84 d2                	test   %dl,%dl
+  8011da:	74 13                	je     8011ef <strfind+0x1d>
+  8011dc:	0f be d2             	movsbl %dl,%edx
+  8011df:	39 f2                	cmp    %esi,%edx
+  8011e1:	74 0b                	je     8011ee <strfind+0x1c>
+  8011e3:	48 83 c0 01          	add    $0x1,%rax
+  8011e7:	0f b6 10             	movzbl (%rax),%edx
+  8011ea:	84 d2                	test   %dl,%dl
+  8011ec:	75 ee                	jne    8011dc <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8011ee:	c3                   	ret
+  8011ef:	c3                   	ret
+
+00000000008011f0 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8011f0:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8011f3:	48 89 f8             	mov    %rdi,%rax
+  8011f6:	48 f7 d8             	neg    %rax
+  8011f9:	83 e0 07             	and    $0x7,%eax
+  8011fc:	49 89 d1             	mov    %rdx,%r9
+  8011ff:	49 29 c1             	sub    %rax,%r9
+  801202:	78 36                	js     80123a <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801204:	40 0f b6 c6          	movzbl %sil,%eax
+  801208:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80120f:	01 01 01 
+  801212:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801216:	40 f6 c7 07          	test   $0x7,%dil
+  80121a:	75 38                	jne    801254 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80121c:	4c 89 c9             	mov    %r9,%rcx
+  80121f:	48 c1 f9 03          	sar    $0x3,%rcx
+  801223:	74 0c                	je     801231 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801225:	fc                   	cld
+  801226:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801229:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80122d:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801231:	4d 85 c9             	test   %r9,%r9
+  801234:	75 45                	jne    80127b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801236:	4c 89 c0             	mov    %r8,%rax
+  801239:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80123a:	48 85 d2             	test   %rdx,%rdx
+  80123d:	74 f7                	je     801236 <memset+0x46>
+  80123f:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801242:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801245:	48 83 c0 01          	add    $0x1,%rax
+  801249:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80124d:	48 39 c2             	cmp    %rax,%rdx
+  801250:	75 f3                	jne    801245 <memset+0x55>
+  801252:	eb e2                	jmp    801236 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801254:	40 f6 c7 01          	test   $0x1,%dil
+  801258:	74 06                	je     801260 <memset+0x70>
+  80125a:	88 07                	mov    %al,(%rdi)
+  80125c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801260:	40 f6 c7 02          	test   $0x2,%dil
+  801264:	74 07                	je     80126d <memset+0x7d>
+  801266:	66 89 07             	mov    %ax,(%rdi)
+  801269:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80126d:	40 f6 c7 04          	test   $0x4,%dil
+  801271:	74 a9                	je     80121c <memset+0x2c>
+  801273:	89 07                	mov    %eax,(%rdi)
+  801275:	48 83 c7 04          	add    $0x4,%rdi
+  801279:	eb a1                	jmp    80121c <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80127b:	41 f6 c1 04          	test   $0x4,%r9b
+  80127f:	74 06                	je     801287 <memset+0x97>
+  801281:	89 07                	mov    %eax,(%rdi)
+  801283:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801287:	41 f6 c1 02          	test   $0x2,%r9b
+  80128b:	74 07                	je     801294 <memset+0xa4>
+  80128d:	66 89 07             	mov    %ax,(%rdi)
+  801290:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801294:	41 f6 c1 01          	test   $0x1,%r9b
+  801298:	74 9c                	je     801236 <memset+0x46>
+  80129a:	88 07                	mov    %al,(%rdi)
+  80129c:	eb 98                	jmp    801236 <memset+0x46>
+
+000000000080129e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80129e:	48 89 f8             	mov    %rdi,%rax
+  8012a1:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8012a4:	48 39 fe             	cmp    %rdi,%rsi
+  8012a7:	73 3b                	jae    8012e4 <memmove+0x46>
+  8012a9:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8012ad:	48 39 d7             	cmp    %rdx,%rdi
+  8012b0:	73 32                	jae    8012e4 <memmove+0x46>
+        s += n;
+        d += n;
+  8012b2:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012b6:	48 89 d6             	mov    %rdx,%rsi
+  8012b9:	48 09 fe             	or     %rdi,%rsi
+  8012bc:	48 09 ce             	or     %rcx,%rsi
+  8012bf:	40 f6 c6 07          	test   $0x7,%sil
+  8012c3:	75 12                	jne    8012d7 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8012c5:	48 83 ef 08          	sub    $0x8,%rdi
+  8012c9:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8012cd:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012d1:	fd                   	std
+  8012d2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8012d5:	fc                   	cld
+  8012d6:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8012d7:	48 83 ef 01          	sub    $0x1,%rdi
+  8012db:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8012df:	fd                   	std
+  8012e0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8012e2:	eb f1                	jmp    8012d5 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012e4:	48 89 f2             	mov    %rsi,%rdx
+  8012e7:	48 09 c2             	or     %rax,%rdx
+  8012ea:	48 09 ca             	or     %rcx,%rdx
+  8012ed:	f6 c2 07             	test   $0x7,%dl
+  8012f0:	75 0c                	jne    8012fe <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8012f2:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012f6:	48 89 c7             	mov    %rax,%rdi
+  8012f9:	fc                   	cld
+  8012fa:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8012fd:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8012fe:	48 89 c7             	mov    %rax,%rdi
+  801301:	fc                   	cld
+  801302:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801304:	c3                   	ret
+
+0000000000801305 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801305:	55                   	push   %rbp
+  801306:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801309:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  801310:	00 00 00 
+  801313:	ff d0                	call   *%rax
+}
+  801315:	5d                   	pop    %rbp
+  801316:	c3                   	ret
+
+0000000000801317 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801317:	55                   	push   %rbp
+  801318:	48 89 e5             	mov    %rsp,%rbp
+  80131b:	41 57                	push   %r15
+  80131d:	41 56                	push   %r14
+  80131f:	41 55                	push   %r13
+  801321:	41 54                	push   %r12
+  801323:	53                   	push   %rbx
+  801324:	48 83 ec 08          	sub    $0x8,%rsp
+  801328:	49 89 fe             	mov    %rdi,%r14
+  80132b:	49 89 f7             	mov    %rsi,%r15
+  80132e:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801331:	48 89 f7             	mov    %rsi,%rdi
+  801334:	48 b8 66 10 80 00 00 	movabs $0x801066,%rax
+  80133b:	00 00 00 
+  80133e:	ff d0                	call   *%rax
+  801340:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801343:	48 89 de             	mov    %rbx,%rsi
+  801346:	4c 89 f7             	mov    %r14,%rdi
+  801349:	48 b8 81 10 80 00 00 	movabs $0x801081,%rax
+  801350:	00 00 00 
+  801353:	ff d0                	call   *%rax
+  801355:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801358:	48 39 c3             	cmp    %rax,%rbx
+  80135b:	74 36                	je     801393 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80135d:	48 89 d8             	mov    %rbx,%rax
+  801360:	4c 29 e8             	sub    %r13,%rax
+  801363:	49 39 c4             	cmp    %rax,%r12
+  801366:	73 31                	jae    801399 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801368:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80136d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801371:	4c 89 fe             	mov    %r15,%rsi
+  801374:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  80137b:	00 00 00 
+  80137e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801380:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801384:	48 83 c4 08          	add    $0x8,%rsp
+  801388:	5b                   	pop    %rbx
+  801389:	41 5c                	pop    %r12
+  80138b:	41 5d                	pop    %r13
+  80138d:	41 5e                	pop    %r14
+  80138f:	41 5f                	pop    %r15
+  801391:	5d                   	pop    %rbp
+  801392:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801393:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801397:	eb eb                	jmp    801384 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801399:	48 83 eb 01          	sub    $0x1,%rbx
+  80139d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8013a1:	48 89 da             	mov    %rbx,%rdx
+  8013a4:	4c 89 fe             	mov    %r15,%rsi
+  8013a7:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  8013ae:	00 00 00 
+  8013b1:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8013b3:	49 01 de             	add    %rbx,%r14
+  8013b6:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8013bb:	eb c3                	jmp    801380 <strlcat+0x69>
+
+00000000008013bd <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8013bd:	48 85 d2             	test   %rdx,%rdx
+  8013c0:	74 2d                	je     8013ef <memcmp+0x32>
+  8013c2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8013c7:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8013cb:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8013d0:	44 38 c1             	cmp    %r8b,%cl
+  8013d3:	75 0f                	jne    8013e4 <memcmp+0x27>
+    while (n-- > 0) {
+  8013d5:	48 83 c0 01          	add    $0x1,%rax
+  8013d9:	48 39 c2             	cmp    %rax,%rdx
+  8013dc:	75 e9                	jne    8013c7 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8013de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e3:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8013e4:	0f b6 c1             	movzbl %cl,%eax
+  8013e7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8013eb:	44 29 c0             	sub    %r8d,%eax
+  8013ee:	c3                   	ret
+    return 0;
+  8013ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013f4:	c3                   	ret
+
+00000000008013f5 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8013f5:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8013f9:	48 39 c7             	cmp    %rax,%rdi
+  8013fc:	73 0f                	jae    80140d <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8013fe:	40 38 37             	cmp    %sil,(%rdi)
+  801401:	74 0e                	je     801411 <memfind+0x1c>
+    for (; src < end; src++) {
+  801403:	48 83 c7 01          	add    $0x1,%rdi
+  801407:	48 39 f8             	cmp    %rdi,%rax
+  80140a:	75 f2                	jne    8013fe <memfind+0x9>
+  80140c:	c3                   	ret
+  80140d:	48 89 f8             	mov    %rdi,%rax
+  801410:	c3                   	ret
+  801411:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801414:	c3                   	ret
+
+0000000000801415 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801415:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801418:	0f b6 37             	movzbl (%rdi),%esi
+  80141b:	40 80 fe 20          	cmp    $0x20,%sil
+  80141f:	74 06                	je     801427 <strtol+0x12>
+  801421:	40 80 fe 09          	cmp    $0x9,%sil
+  801425:	75 13                	jne    80143a <strtol+0x25>
+  801427:	48 83 c7 01          	add    $0x1,%rdi
+  80142b:	0f b6 37             	movzbl (%rdi),%esi
+  80142e:	40 80 fe 20          	cmp    $0x20,%sil
+  801432:	74 f3                	je     801427 <strtol+0x12>
+  801434:	40 80 fe 09          	cmp    $0x9,%sil
+  801438:	74 ed                	je     801427 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80143a:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80143d:	83 e0 fd             	and    $0xfffffffd,%eax
+  801440:	3c 01                	cmp    $0x1,%al
+  801442:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801446:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80144c:	75 0f                	jne    80145d <strtol+0x48>
+  80144e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801451:	74 14                	je     801467 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801453:	85 d2                	test   %edx,%edx
+  801455:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80145a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80145d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801462:	4c 63 ca             	movslq %edx,%r9
+  801465:	eb 36                	jmp    80149d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801467:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80146b:	74 0f                	je     80147c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80146d:	85 d2                	test   %edx,%edx
+  80146f:	75 ec                	jne    80145d <strtol+0x48>
+        s++;
+  801471:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801475:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80147a:	eb e1                	jmp    80145d <strtol+0x48>
+        s += 2;
+  80147c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801480:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801485:	eb d6                	jmp    80145d <strtol+0x48>
+            dig -= '0';
+  801487:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80148a:	44 0f b6 c1          	movzbl %cl,%r8d
+  80148e:	41 39 d0             	cmp    %edx,%r8d
+  801491:	7d 21                	jge    8014b4 <strtol+0x9f>
+        val = val * base + dig;
+  801493:	49 0f af c1          	imul   %r9,%rax
+  801497:	0f b6 c9             	movzbl %cl,%ecx
+  80149a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80149d:	48 83 c7 01          	add    $0x1,%rdi
+  8014a1:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8014a5:	80 f9 39             	cmp    $0x39,%cl
+  8014a8:	76 dd                	jbe    801487 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8014aa:	80 f9 7b             	cmp    $0x7b,%cl
+  8014ad:	77 05                	ja     8014b4 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8014af:	83 e9 57             	sub    $0x57,%ecx
+  8014b2:	eb d6                	jmp    80148a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8014b4:	4d 85 d2             	test   %r10,%r10
+  8014b7:	74 03                	je     8014bc <strtol+0xa7>
+  8014b9:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8014bc:	48 89 c2             	mov    %rax,%rdx
+  8014bf:	48 f7 da             	neg    %rdx
+  8014c2:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8014c6:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8014ca:	c3                   	ret
+
+00000000008014cb <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8014cb:	55                   	push   %rbp
+  8014cc:	48 89 e5             	mov    %rsp,%rbp
+  8014cf:	53                   	push   %rbx
+  8014d0:	48 89 fa             	mov    %rdi,%rdx
+  8014d3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d6:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f0:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8014f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f6:	c9                   	leave
+  8014f7:	c3                   	ret
+
+00000000008014f8 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8014f8:	55                   	push   %rbp
+  8014f9:	48 89 e5             	mov    %rsp,%rbp
+  8014fc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014fd:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801502:	ba 00 00 00 00       	mov    $0x0,%edx
+  801507:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80150c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801511:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801516:	be 00 00 00 00       	mov    $0x0,%esi
+  80151b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801521:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801523:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801527:	c9                   	leave
+  801528:	c3                   	ret
+
+0000000000801529 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801529:	55                   	push   %rbp
+  80152a:	48 89 e5             	mov    %rsp,%rbp
+  80152d:	53                   	push   %rbx
+  80152e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801532:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801535:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80153a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80153f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801544:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801549:	be 00 00 00 00       	mov    $0x0,%esi
+  80154e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801554:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801556:	48 85 c0             	test   %rax,%rax
+  801559:	7f 06                	jg     801561 <sys_env_destroy+0x38>
+}
+  80155b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80155f:	c9                   	leave
+  801560:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801561:	49 89 c0             	mov    %rax,%r8
+  801564:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801569:	48 ba d0 3d 80 00 00 	movabs $0x803dd0,%rdx
+  801570:	00 00 00 
+  801573:	be 26 00 00 00       	mov    $0x26,%esi
+  801578:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  80157f:	00 00 00 
+  801582:	b8 00 00 00 00       	mov    $0x0,%eax
+  801587:	49 b9 2f 06 80 00 00 	movabs $0x80062f,%r9
+  80158e:	00 00 00 
+  801591:	41 ff d1             	call   *%r9
+
+0000000000801594 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801594:	55                   	push   %rbp
+  801595:	48 89 e5             	mov    %rsp,%rbp
+  801598:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801599:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80159e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015bd:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c3:	c9                   	leave
+  8015c4:	c3                   	ret
+
+00000000008015c5 <sys_yield>:
+
+void
+sys_yield(void) {
+  8015c5:	55                   	push   %rbp
+  8015c6:	48 89 e5             	mov    %rsp,%rbp
+  8015c9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ca:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015de:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ee:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f4:	c9                   	leave
+  8015f5:	c3                   	ret
+
+00000000008015f6 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8015f6:	55                   	push   %rbp
+  8015f7:	48 89 e5             	mov    %rsp,%rbp
+  8015fa:	53                   	push   %rbx
+  8015fb:	48 89 fa             	mov    %rdi,%rdx
+  8015fe:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801601:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801606:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80160d:	00 00 00 
+  801610:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801615:	be 00 00 00 00       	mov    $0x0,%esi
+  80161a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801620:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801622:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801626:	c9                   	leave
+  801627:	c3                   	ret
+
+0000000000801628 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801628:	55                   	push   %rbp
+  801629:	48 89 e5             	mov    %rsp,%rbp
+  80162c:	53                   	push   %rbx
+  80162d:	49 89 f8             	mov    %rdi,%r8
+  801630:	48 89 d3             	mov    %rdx,%rbx
+  801633:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801636:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80163b:	4c 89 c2             	mov    %r8,%rdx
+  80163e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801641:	be 00 00 00 00       	mov    $0x0,%esi
+  801646:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80164c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80164e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801652:	c9                   	leave
+  801653:	c3                   	ret
+
+0000000000801654 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801654:	55                   	push   %rbp
+  801655:	48 89 e5             	mov    %rsp,%rbp
+  801658:	53                   	push   %rbx
+  801659:	48 83 ec 08          	sub    $0x8,%rsp
+  80165d:	89 f8                	mov    %edi,%eax
+  80165f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801662:	48 63 f9             	movslq %ecx,%rdi
+  801665:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801668:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80166d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801670:	be 00 00 00 00       	mov    $0x0,%esi
+  801675:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80167b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80167d:	48 85 c0             	test   %rax,%rax
+  801680:	7f 06                	jg     801688 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801682:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801686:	c9                   	leave
+  801687:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801688:	49 89 c0             	mov    %rax,%r8
+  80168b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801690:	48 ba d0 3d 80 00 00 	movabs $0x803dd0,%rdx
+  801697:	00 00 00 
+  80169a:	be 26 00 00 00       	mov    $0x26,%esi
+  80169f:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  8016a6:	00 00 00 
+  8016a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ae:	49 b9 2f 06 80 00 00 	movabs $0x80062f,%r9
+  8016b5:	00 00 00 
+  8016b8:	41 ff d1             	call   *%r9
+
+00000000008016bb <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8016bb:	55                   	push   %rbp
+  8016bc:	48 89 e5             	mov    %rsp,%rbp
+  8016bf:	53                   	push   %rbx
+  8016c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8016c4:	89 f8                	mov    %edi,%eax
+  8016c6:	49 89 f2             	mov    %rsi,%r10
+  8016c9:	48 89 cf             	mov    %rcx,%rdi
+  8016cc:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8016cf:	48 63 da             	movslq %edx,%rbx
+  8016d2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d5:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016da:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016dd:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8016e0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016e2:	48 85 c0             	test   %rax,%rax
+  8016e5:	7f 06                	jg     8016ed <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8016e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016eb:	c9                   	leave
+  8016ec:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ed:	49 89 c0             	mov    %rax,%r8
+  8016f0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8016f5:	48 ba d0 3d 80 00 00 	movabs $0x803dd0,%rdx
+  8016fc:	00 00 00 
+  8016ff:	be 26 00 00 00       	mov    $0x26,%esi
+  801704:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  80170b:	00 00 00 
+  80170e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801713:	49 b9 2f 06 80 00 00 	movabs $0x80062f,%r9
+  80171a:	00 00 00 
+  80171d:	41 ff d1             	call   *%r9
+
+0000000000801720 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801720:	55                   	push   %rbp
+  801721:	48 89 e5             	mov    %rsp,%rbp
+  801724:	53                   	push   %rbx
+  801725:	48 83 ec 08          	sub    $0x8,%rsp
+  801729:	48 89 f1             	mov    %rsi,%rcx
+  80172c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80172f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801732:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801737:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80173c:	be 00 00 00 00       	mov    $0x0,%esi
+  801741:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801747:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801749:	48 85 c0             	test   %rax,%rax
+  80174c:	7f 06                	jg     801754 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80174e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801752:	c9                   	leave
+  801753:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801754:	49 89 c0             	mov    %rax,%r8
+  801757:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80175c:	48 ba d0 3d 80 00 00 	movabs $0x803dd0,%rdx
+  801763:	00 00 00 
+  801766:	be 26 00 00 00       	mov    $0x26,%esi
+  80176b:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  801772:	00 00 00 
+  801775:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177a:	49 b9 2f 06 80 00 00 	movabs $0x80062f,%r9
+  801781:	00 00 00 
+  801784:	41 ff d1             	call   *%r9
+
+0000000000801787 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801787:	55                   	push   %rbp
+  801788:	48 89 e5             	mov    %rsp,%rbp
+  80178b:	53                   	push   %rbx
+  80178c:	48 83 ec 08          	sub    $0x8,%rsp
+  801790:	89 f8                	mov    %edi,%eax
+  801792:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801795:	48 63 f9             	movslq %ecx,%rdi
+  801798:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80179b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017a0:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ae:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017b0:	48 85 c0             	test   %rax,%rax
+  8017b3:	7f 06                	jg     8017bb <sys_region_advise+0x34>
+}
+  8017b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b9:	c9                   	leave
+  8017ba:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017bb:	49 89 c0             	mov    %rax,%r8
+  8017be:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8017c3:	48 ba d0 3d 80 00 00 	movabs $0x803dd0,%rdx
+  8017ca:	00 00 00 
+  8017cd:	be 26 00 00 00       	mov    $0x26,%esi
+  8017d2:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  8017d9:	00 00 00 
+  8017dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e1:	49 b9 2f 06 80 00 00 	movabs $0x80062f,%r9
+  8017e8:	00 00 00 
+  8017eb:	41 ff d1             	call   *%r9
+
+00000000008017ee <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  8017ee:	55                   	push   %rbp
+  8017ef:	48 89 e5             	mov    %rsp,%rbp
+  8017f2:	53                   	push   %rbx
+  8017f3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  8017f7:	48 63 ce             	movslq %esi,%rcx
+  8017fa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017fd:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801802:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801807:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80180c:	be 00 00 00 00       	mov    $0x0,%esi
+  801811:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801817:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801819:	48 85 c0             	test   %rax,%rax
+  80181c:	7f 06                	jg     801824 <sys_env_set_nice+0x36>
+}
+  80181e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801822:	c9                   	leave
+  801823:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801824:	49 89 c0             	mov    %rax,%r8
+  801827:	b9 15 00 00 00       	mov    $0x15,%ecx
+  80182c:	48 ba d0 3d 80 00 00 	movabs $0x803dd0,%rdx
+  801833:	00 00 00 
+  801836:	be 26 00 00 00       	mov    $0x26,%esi
+  80183b:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  801842:	00 00 00 
+  801845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80184a:	49 b9 2f 06 80 00 00 	movabs $0x80062f,%r9
+  801851:	00 00 00 
+  801854:	41 ff d1             	call   *%r9
+
+0000000000801857 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801857:	55                   	push   %rbp
+  801858:	48 89 e5             	mov    %rsp,%rbp
+  80185b:	53                   	push   %rbx
+  80185c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801860:	48 63 ce             	movslq %esi,%rcx
+  801863:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801866:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80186b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801870:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801875:	be 00 00 00 00       	mov    $0x0,%esi
+  80187a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801880:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801882:	48 85 c0             	test   %rax,%rax
+  801885:	7f 06                	jg     80188d <sys_env_set_status+0x36>
+}
+  801887:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80188b:	c9                   	leave
+  80188c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80188d:	49 89 c0             	mov    %rax,%r8
+  801890:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801895:	48 ba d0 3d 80 00 00 	movabs $0x803dd0,%rdx
+  80189c:	00 00 00 
+  80189f:	be 26 00 00 00       	mov    $0x26,%esi
+  8018a4:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  8018ab:	00 00 00 
+  8018ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b3:	49 b9 2f 06 80 00 00 	movabs $0x80062f,%r9
+  8018ba:	00 00 00 
+  8018bd:	41 ff d1             	call   *%r9
+
+00000000008018c0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8018c0:	55                   	push   %rbp
+  8018c1:	48 89 e5             	mov    %rsp,%rbp
+  8018c4:	53                   	push   %rbx
+  8018c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8018c9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8018cc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018cf:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018de:	be 00 00 00 00       	mov    $0x0,%esi
+  8018e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018e9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018eb:	48 85 c0             	test   %rax,%rax
+  8018ee:	7f 06                	jg     8018f6 <sys_env_set_trapframe+0x36>
+}
+  8018f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018f4:	c9                   	leave
+  8018f5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018f6:	49 89 c0             	mov    %rax,%r8
+  8018f9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8018fe:	48 ba d0 3d 80 00 00 	movabs $0x803dd0,%rdx
+  801905:	00 00 00 
+  801908:	be 26 00 00 00       	mov    $0x26,%esi
+  80190d:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  801914:	00 00 00 
+  801917:	b8 00 00 00 00       	mov    $0x0,%eax
+  80191c:	49 b9 2f 06 80 00 00 	movabs $0x80062f,%r9
+  801923:	00 00 00 
+  801926:	41 ff d1             	call   *%r9
+
+0000000000801929 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801929:	55                   	push   %rbp
+  80192a:	48 89 e5             	mov    %rsp,%rbp
+  80192d:	53                   	push   %rbx
+  80192e:	48 83 ec 08          	sub    $0x8,%rsp
+  801932:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801935:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801938:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80193d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801942:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801947:	be 00 00 00 00       	mov    $0x0,%esi
+  80194c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801952:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801954:	48 85 c0             	test   %rax,%rax
+  801957:	7f 06                	jg     80195f <sys_env_set_pgfault_upcall+0x36>
+}
+  801959:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80195d:	c9                   	leave
+  80195e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80195f:	49 89 c0             	mov    %rax,%r8
+  801962:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801967:	48 ba d0 3d 80 00 00 	movabs $0x803dd0,%rdx
+  80196e:	00 00 00 
+  801971:	be 26 00 00 00       	mov    $0x26,%esi
+  801976:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  80197d:	00 00 00 
+  801980:	b8 00 00 00 00       	mov    $0x0,%eax
+  801985:	49 b9 2f 06 80 00 00 	movabs $0x80062f,%r9
+  80198c:	00 00 00 
+  80198f:	41 ff d1             	call   *%r9
+
+0000000000801992 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801992:	55                   	push   %rbp
+  801993:	48 89 e5             	mov    %rsp,%rbp
+  801996:	53                   	push   %rbx
+  801997:	89 f8                	mov    %edi,%eax
+  801999:	49 89 f1             	mov    %rsi,%r9
+  80199c:	48 89 d3             	mov    %rdx,%rbx
+  80199f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8019a2:	49 63 f0             	movslq %r8d,%rsi
+  8019a5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019a8:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019ad:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019b6:	cd 30                	int    $0x30
+}
+  8019b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019bc:	c9                   	leave
+  8019bd:	c3                   	ret
+
+00000000008019be <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8019be:	55                   	push   %rbp
+  8019bf:	48 89 e5             	mov    %rsp,%rbp
+  8019c2:	53                   	push   %rbx
+  8019c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8019c7:	48 89 fa             	mov    %rdi,%rdx
+  8019ca:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8019cd:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8019e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019e7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019e9:	48 85 c0             	test   %rax,%rax
+  8019ec:	7f 06                	jg     8019f4 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019f2:	c9                   	leave
+  8019f3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019f4:	49 89 c0             	mov    %rax,%r8
+  8019f7:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8019fc:	48 ba d0 3d 80 00 00 	movabs $0x803dd0,%rdx
+  801a03:	00 00 00 
+  801a06:	be 26 00 00 00       	mov    $0x26,%esi
+  801a0b:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  801a12:	00 00 00 
+  801a15:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1a:	49 b9 2f 06 80 00 00 	movabs $0x80062f,%r9
+  801a21:	00 00 00 
+  801a24:	41 ff d1             	call   *%r9
+
+0000000000801a27 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801a27:	55                   	push   %rbp
+  801a28:	48 89 e5             	mov    %rsp,%rbp
+  801a2b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a2c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a31:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a36:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a40:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a45:	be 00 00 00 00       	mov    $0x0,%esi
+  801a4a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a50:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a56:	c9                   	leave
+  801a57:	c3                   	ret
+
+0000000000801a58 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  801a58:	55                   	push   %rbp
+  801a59:	48 89 e5             	mov    %rsp,%rbp
+  801a5c:	53                   	push   %rbx
+  801a5d:	48 83 ec 08          	sub    $0x8,%rsp
+  801a61:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801a64:	48 63 ce             	movslq %esi,%rcx
+  801a67:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a6a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a6f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a74:	be 00 00 00 00       	mov    $0x0,%esi
+  801a79:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a7f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a81:	48 85 c0             	test   %rax,%rax
+  801a84:	7f 06                	jg     801a8c <sys_sigqueue+0x34>
+}
+  801a86:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a8a:	c9                   	leave
+  801a8b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a8c:	49 89 c0             	mov    %rax,%r8
+  801a8f:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801a94:	48 ba d0 3d 80 00 00 	movabs $0x803dd0,%rdx
+  801a9b:	00 00 00 
+  801a9e:	be 26 00 00 00       	mov    $0x26,%esi
+  801aa3:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  801aaa:	00 00 00 
+  801aad:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab2:	49 b9 2f 06 80 00 00 	movabs $0x80062f,%r9
+  801ab9:	00 00 00 
+  801abc:	41 ff d1             	call   *%r9
+
+0000000000801abf <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801abf:	55                   	push   %rbp
+  801ac0:	48 89 e5             	mov    %rsp,%rbp
+  801ac3:	53                   	push   %rbx
+  801ac4:	48 83 ec 08          	sub    $0x8,%rsp
+  801ac8:	48 89 fa             	mov    %rdi,%rdx
+  801acb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801ace:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ad3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801add:	be 00 00 00 00       	mov    $0x0,%esi
+  801ae2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ae8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801aea:	48 85 c0             	test   %rax,%rax
+  801aed:	7f 06                	jg     801af5 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801aef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801af3:	c9                   	leave
+  801af4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801af5:	49 89 c0             	mov    %rax,%r8
+  801af8:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801afd:	48 ba d0 3d 80 00 00 	movabs $0x803dd0,%rdx
+  801b04:	00 00 00 
+  801b07:	be 26 00 00 00       	mov    $0x26,%esi
+  801b0c:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  801b13:	00 00 00 
+  801b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1b:	49 b9 2f 06 80 00 00 	movabs $0x80062f,%r9
+  801b22:	00 00 00 
+  801b25:	41 ff d1             	call   *%r9
+
+0000000000801b28 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801b28:	55                   	push   %rbp
+  801b29:	48 89 e5             	mov    %rsp,%rbp
+  801b2c:	53                   	push   %rbx
+  801b2d:	48 83 ec 08          	sub    $0x8,%rsp
+  801b31:	48 89 f1             	mov    %rsi,%rcx
+  801b34:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801b37:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b3a:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b3f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b44:	be 00 00 00 00       	mov    $0x0,%esi
+  801b49:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b4f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b51:	48 85 c0             	test   %rax,%rax
+  801b54:	7f 06                	jg     801b5c <sys_sigaction+0x34>
+}
+  801b56:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b5a:	c9                   	leave
+  801b5b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b5c:	49 89 c0             	mov    %rax,%r8
+  801b5f:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801b64:	48 ba d0 3d 80 00 00 	movabs $0x803dd0,%rdx
+  801b6b:	00 00 00 
+  801b6e:	be 26 00 00 00       	mov    $0x26,%esi
+  801b73:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  801b7a:	00 00 00 
+  801b7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b82:	49 b9 2f 06 80 00 00 	movabs $0x80062f,%r9
+  801b89:	00 00 00 
+  801b8c:	41 ff d1             	call   *%r9
+
+0000000000801b8f <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801b8f:	55                   	push   %rbp
+  801b90:	48 89 e5             	mov    %rsp,%rbp
+  801b93:	53                   	push   %rbx
+  801b94:	48 83 ec 08          	sub    $0x8,%rsp
+  801b98:	48 89 f1             	mov    %rsi,%rcx
+  801b9b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801b9e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ba1:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ba6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bab:	be 00 00 00 00       	mov    $0x0,%esi
+  801bb0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bb6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801bb8:	48 85 c0             	test   %rax,%rax
+  801bbb:	7f 06                	jg     801bc3 <sys_sigprocmask+0x34>
+}
+  801bbd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bc1:	c9                   	leave
+  801bc2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801bc3:	49 89 c0             	mov    %rax,%r8
+  801bc6:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801bcb:	48 ba d0 3d 80 00 00 	movabs $0x803dd0,%rdx
+  801bd2:	00 00 00 
+  801bd5:	be 26 00 00 00       	mov    $0x26,%esi
+  801bda:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  801be1:	00 00 00 
+  801be4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be9:	49 b9 2f 06 80 00 00 	movabs $0x80062f,%r9
+  801bf0:	00 00 00 
+  801bf3:	41 ff d1             	call   *%r9
+
+0000000000801bf6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801bf6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801bfd:	ff ff ff 
+  801c00:	48 01 f8             	add    %rdi,%rax
+  801c03:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801c07:	c3                   	ret
+
+0000000000801c08 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c08:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c0f:	ff ff ff 
+  801c12:	48 01 f8             	add    %rdi,%rax
+  801c15:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801c19:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801c1f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801c23:	c3                   	ret
+
+0000000000801c24 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801c24:	55                   	push   %rbp
+  801c25:	48 89 e5             	mov    %rsp,%rbp
+  801c28:	41 57                	push   %r15
+  801c2a:	41 56                	push   %r14
+  801c2c:	41 55                	push   %r13
+  801c2e:	41 54                	push   %r12
+  801c30:	53                   	push   %rbx
+  801c31:	48 83 ec 08          	sub    $0x8,%rsp
+  801c35:	49 89 ff             	mov    %rdi,%r15
+  801c38:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801c3d:	49 bd 9c 34 80 00 00 	movabs $0x80349c,%r13
+  801c44:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801c47:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801c4d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801c50:	48 89 df             	mov    %rbx,%rdi
+  801c53:	41 ff d5             	call   *%r13
+  801c56:	83 e0 04             	and    $0x4,%eax
+  801c59:	74 17                	je     801c72 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801c5b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801c62:	4c 39 f3             	cmp    %r14,%rbx
+  801c65:	75 e6                	jne    801c4d <fd_alloc+0x29>
+  801c67:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801c6d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801c72:	4d 89 27             	mov    %r12,(%r15)
+}
+  801c75:	48 83 c4 08          	add    $0x8,%rsp
+  801c79:	5b                   	pop    %rbx
+  801c7a:	41 5c                	pop    %r12
+  801c7c:	41 5d                	pop    %r13
+  801c7e:	41 5e                	pop    %r14
+  801c80:	41 5f                	pop    %r15
+  801c82:	5d                   	pop    %rbp
+  801c83:	c3                   	ret
+
+0000000000801c84 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801c84:	83 ff 1f             	cmp    $0x1f,%edi
+  801c87:	77 39                	ja     801cc2 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801c89:	55                   	push   %rbp
+  801c8a:	48 89 e5             	mov    %rsp,%rbp
+  801c8d:	41 54                	push   %r12
+  801c8f:	53                   	push   %rbx
+  801c90:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801c93:	48 63 df             	movslq %edi,%rbx
+  801c96:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801c9d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ca1:	48 89 df             	mov    %rbx,%rdi
+  801ca4:	48 b8 9c 34 80 00 00 	movabs $0x80349c,%rax
+  801cab:	00 00 00 
+  801cae:	ff d0                	call   *%rax
+  801cb0:	a8 04                	test   $0x4,%al
+  801cb2:	74 14                	je     801cc8 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801cb4:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801cb8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cbd:	5b                   	pop    %rbx
+  801cbe:	41 5c                	pop    %r12
+  801cc0:	5d                   	pop    %rbp
+  801cc1:	c3                   	ret
+        return -E_INVAL;
+  801cc2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801cc7:	c3                   	ret
+        return -E_INVAL;
+  801cc8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ccd:	eb ee                	jmp    801cbd <fd_lookup+0x39>
+
+0000000000801ccf <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801ccf:	55                   	push   %rbp
+  801cd0:	48 89 e5             	mov    %rsp,%rbp
+  801cd3:	41 54                	push   %r12
+  801cd5:	53                   	push   %rbx
+  801cd6:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801cd9:	48 b8 80 3e 80 00 00 	movabs $0x803e80,%rax
+  801ce0:	00 00 00 
+  801ce3:	48 bb c0 67 80 00 00 	movabs $0x8067c0,%rbx
+  801cea:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801ced:	39 3b                	cmp    %edi,(%rbx)
+  801cef:	74 47                	je     801d38 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801cf1:	48 83 c0 08          	add    $0x8,%rax
+  801cf5:	48 8b 18             	mov    (%rax),%rbx
+  801cf8:	48 85 db             	test   %rbx,%rbx
+  801cfb:	75 f0                	jne    801ced <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801cfd:	48 a1 70 87 80 00 00 	movabs 0x808770,%rax
+  801d04:	00 00 00 
+  801d07:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d0d:	89 fa                	mov    %edi,%edx
+  801d0f:	48 bf 00 3e 80 00 00 	movabs $0x803e00,%rdi
+  801d16:	00 00 00 
+  801d19:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d1e:	48 b9 7f 07 80 00 00 	movabs $0x80077f,%rcx
+  801d25:	00 00 00 
+  801d28:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801d2a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801d2f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801d33:	5b                   	pop    %rbx
+  801d34:	41 5c                	pop    %r12
+  801d36:	5d                   	pop    %rbp
+  801d37:	c3                   	ret
+            return 0;
+  801d38:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d3d:	eb f0                	jmp    801d2f <dev_lookup+0x60>
+
+0000000000801d3f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801d3f:	55                   	push   %rbp
+  801d40:	48 89 e5             	mov    %rsp,%rbp
+  801d43:	41 55                	push   %r13
+  801d45:	41 54                	push   %r12
+  801d47:	53                   	push   %rbx
+  801d48:	48 83 ec 18          	sub    $0x18,%rsp
+  801d4c:	48 89 fb             	mov    %rdi,%rbx
+  801d4f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801d52:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801d59:	ff ff ff 
+  801d5c:	48 01 df             	add    %rbx,%rdi
+  801d5f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801d63:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d67:	48 b8 84 1c 80 00 00 	movabs $0x801c84,%rax
+  801d6e:	00 00 00 
+  801d71:	ff d0                	call   *%rax
+  801d73:	41 89 c5             	mov    %eax,%r13d
+  801d76:	85 c0                	test   %eax,%eax
+  801d78:	78 06                	js     801d80 <fd_close+0x41>
+  801d7a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801d7e:	74 1a                	je     801d9a <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801d80:	45 84 e4             	test   %r12b,%r12b
+  801d83:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d88:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801d8c:	44 89 e8             	mov    %r13d,%eax
+  801d8f:	48 83 c4 18          	add    $0x18,%rsp
+  801d93:	5b                   	pop    %rbx
+  801d94:	41 5c                	pop    %r12
+  801d96:	41 5d                	pop    %r13
+  801d98:	5d                   	pop    %rbp
+  801d99:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d9a:	8b 3b                	mov    (%rbx),%edi
+  801d9c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801da0:	48 b8 cf 1c 80 00 00 	movabs $0x801ccf,%rax
+  801da7:	00 00 00 
+  801daa:	ff d0                	call   *%rax
+  801dac:	41 89 c5             	mov    %eax,%r13d
+  801daf:	85 c0                	test   %eax,%eax
+  801db1:	78 1b                	js     801dce <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801db3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801db7:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801dbb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801dc1:	48 85 c0             	test   %rax,%rax
+  801dc4:	74 08                	je     801dce <fd_close+0x8f>
+  801dc6:	48 89 df             	mov    %rbx,%rdi
+  801dc9:	ff d0                	call   *%rax
+  801dcb:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801dce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801dd3:	48 89 de             	mov    %rbx,%rsi
+  801dd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ddb:	48 b8 20 17 80 00 00 	movabs $0x801720,%rax
+  801de2:	00 00 00 
+  801de5:	ff d0                	call   *%rax
+    return res;
+  801de7:	eb a3                	jmp    801d8c <fd_close+0x4d>
+
+0000000000801de9 <close>:
+
+int
+close(int fdnum) {
+  801de9:	55                   	push   %rbp
+  801dea:	48 89 e5             	mov    %rsp,%rbp
+  801ded:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801df1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801df5:	48 b8 84 1c 80 00 00 	movabs $0x801c84,%rax
+  801dfc:	00 00 00 
+  801dff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e01:	85 c0                	test   %eax,%eax
+  801e03:	78 15                	js     801e1a <close+0x31>
+
+    return fd_close(fd, 1);
+  801e05:	be 01 00 00 00       	mov    $0x1,%esi
+  801e0a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801e0e:	48 b8 3f 1d 80 00 00 	movabs $0x801d3f,%rax
+  801e15:	00 00 00 
+  801e18:	ff d0                	call   *%rax
+}
+  801e1a:	c9                   	leave
+  801e1b:	c3                   	ret
+
+0000000000801e1c <close_all>:
+
+void
+close_all(void) {
+  801e1c:	55                   	push   %rbp
+  801e1d:	48 89 e5             	mov    %rsp,%rbp
+  801e20:	41 54                	push   %r12
+  801e22:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801e23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e28:	49 bc e9 1d 80 00 00 	movabs $0x801de9,%r12
+  801e2f:	00 00 00 
+  801e32:	89 df                	mov    %ebx,%edi
+  801e34:	41 ff d4             	call   *%r12
+  801e37:	83 c3 01             	add    $0x1,%ebx
+  801e3a:	83 fb 20             	cmp    $0x20,%ebx
+  801e3d:	75 f3                	jne    801e32 <close_all+0x16>
+}
+  801e3f:	5b                   	pop    %rbx
+  801e40:	41 5c                	pop    %r12
+  801e42:	5d                   	pop    %rbp
+  801e43:	c3                   	ret
+
+0000000000801e44 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801e44:	55                   	push   %rbp
+  801e45:	48 89 e5             	mov    %rsp,%rbp
+  801e48:	41 57                	push   %r15
+  801e4a:	41 56                	push   %r14
+  801e4c:	41 55                	push   %r13
+  801e4e:	41 54                	push   %r12
+  801e50:	53                   	push   %rbx
+  801e51:	48 83 ec 18          	sub    $0x18,%rsp
+  801e55:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801e58:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801e5c:	48 b8 84 1c 80 00 00 	movabs $0x801c84,%rax
+  801e63:	00 00 00 
+  801e66:	ff d0                	call   *%rax
+  801e68:	89 c3                	mov    %eax,%ebx
+  801e6a:	85 c0                	test   %eax,%eax
+  801e6c:	0f 88 b8 00 00 00    	js     801f2a <dup+0xe6>
+    close(newfdnum);
+  801e72:	44 89 e7             	mov    %r12d,%edi
+  801e75:	48 b8 e9 1d 80 00 00 	movabs $0x801de9,%rax
+  801e7c:	00 00 00 
+  801e7f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801e81:	4d 63 ec             	movslq %r12d,%r13
+  801e84:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801e8b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801e8f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801e93:	4c 89 ff             	mov    %r15,%rdi
+  801e96:	49 be 08 1c 80 00 00 	movabs $0x801c08,%r14
+  801e9d:	00 00 00 
+  801ea0:	41 ff d6             	call   *%r14
+  801ea3:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801ea6:	4c 89 ef             	mov    %r13,%rdi
+  801ea9:	41 ff d6             	call   *%r14
+  801eac:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801eaf:	48 89 df             	mov    %rbx,%rdi
+  801eb2:	48 b8 9c 34 80 00 00 	movabs $0x80349c,%rax
+  801eb9:	00 00 00 
+  801ebc:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801ebe:	a8 04                	test   $0x4,%al
+  801ec0:	74 2b                	je     801eed <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ec2:	41 89 c1             	mov    %eax,%r9d
+  801ec5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ecb:	4c 89 f1             	mov    %r14,%rcx
+  801ece:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ed3:	48 89 de             	mov    %rbx,%rsi
+  801ed6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801edb:	48 b8 bb 16 80 00 00 	movabs $0x8016bb,%rax
+  801ee2:	00 00 00 
+  801ee5:	ff d0                	call   *%rax
+  801ee7:	89 c3                	mov    %eax,%ebx
+  801ee9:	85 c0                	test   %eax,%eax
+  801eeb:	78 4e                	js     801f3b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801eed:	4c 89 ff             	mov    %r15,%rdi
+  801ef0:	48 b8 9c 34 80 00 00 	movabs $0x80349c,%rax
+  801ef7:	00 00 00 
+  801efa:	ff d0                	call   *%rax
+  801efc:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801eff:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f05:	4c 89 e9             	mov    %r13,%rcx
+  801f08:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f0d:	4c 89 fe             	mov    %r15,%rsi
+  801f10:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f15:	48 b8 bb 16 80 00 00 	movabs $0x8016bb,%rax
+  801f1c:	00 00 00 
+  801f1f:	ff d0                	call   *%rax
+  801f21:	89 c3                	mov    %eax,%ebx
+  801f23:	85 c0                	test   %eax,%eax
+  801f25:	78 14                	js     801f3b <dup+0xf7>
+
+    return newfdnum;
+  801f27:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801f2a:	89 d8                	mov    %ebx,%eax
+  801f2c:	48 83 c4 18          	add    $0x18,%rsp
+  801f30:	5b                   	pop    %rbx
+  801f31:	41 5c                	pop    %r12
+  801f33:	41 5d                	pop    %r13
+  801f35:	41 5e                	pop    %r14
+  801f37:	41 5f                	pop    %r15
+  801f39:	5d                   	pop    %rbp
+  801f3a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801f3b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f40:	4c 89 ee             	mov    %r13,%rsi
+  801f43:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f48:	49 bc 20 17 80 00 00 	movabs $0x801720,%r12
+  801f4f:	00 00 00 
+  801f52:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801f55:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f5a:	4c 89 f6             	mov    %r14,%rsi
+  801f5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f62:	41 ff d4             	call   *%r12
+    return res;
+  801f65:	eb c3                	jmp    801f2a <dup+0xe6>
+
+0000000000801f67 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801f67:	55                   	push   %rbp
+  801f68:	48 89 e5             	mov    %rsp,%rbp
+  801f6b:	41 56                	push   %r14
+  801f6d:	41 55                	push   %r13
+  801f6f:	41 54                	push   %r12
+  801f71:	53                   	push   %rbx
+  801f72:	48 83 ec 10          	sub    $0x10,%rsp
+  801f76:	89 fb                	mov    %edi,%ebx
+  801f78:	49 89 f4             	mov    %rsi,%r12
+  801f7b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f7e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f82:	48 b8 84 1c 80 00 00 	movabs $0x801c84,%rax
+  801f89:	00 00 00 
+  801f8c:	ff d0                	call   *%rax
+  801f8e:	85 c0                	test   %eax,%eax
+  801f90:	78 4c                	js     801fde <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f92:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f96:	41 8b 3e             	mov    (%r14),%edi
+  801f99:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f9d:	48 b8 cf 1c 80 00 00 	movabs $0x801ccf,%rax
+  801fa4:	00 00 00 
+  801fa7:	ff d0                	call   *%rax
+  801fa9:	85 c0                	test   %eax,%eax
+  801fab:	78 35                	js     801fe2 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801fad:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801fb1:	83 e0 03             	and    $0x3,%eax
+  801fb4:	83 f8 01             	cmp    $0x1,%eax
+  801fb7:	74 2d                	je     801fe6 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801fb9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fbd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801fc1:	48 85 c0             	test   %rax,%rax
+  801fc4:	74 56                	je     80201c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801fc6:	4c 89 ea             	mov    %r13,%rdx
+  801fc9:	4c 89 e6             	mov    %r12,%rsi
+  801fcc:	4c 89 f7             	mov    %r14,%rdi
+  801fcf:	ff d0                	call   *%rax
+}
+  801fd1:	48 83 c4 10          	add    $0x10,%rsp
+  801fd5:	5b                   	pop    %rbx
+  801fd6:	41 5c                	pop    %r12
+  801fd8:	41 5d                	pop    %r13
+  801fda:	41 5e                	pop    %r14
+  801fdc:	5d                   	pop    %rbp
+  801fdd:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fde:	48 98                	cltq
+  801fe0:	eb ef                	jmp    801fd1 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fe2:	48 98                	cltq
+  801fe4:	eb eb                	jmp    801fd1 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fe6:	48 a1 70 87 80 00 00 	movabs 0x808770,%rax
+  801fed:	00 00 00 
+  801ff0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ff6:	89 da                	mov    %ebx,%edx
+  801ff8:	48 bf 41 3e 80 00 00 	movabs $0x803e41,%rdi
+  801fff:	00 00 00 
+  802002:	b8 00 00 00 00       	mov    $0x0,%eax
+  802007:	48 b9 7f 07 80 00 00 	movabs $0x80077f,%rcx
+  80200e:	00 00 00 
+  802011:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802013:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80201a:	eb b5                	jmp    801fd1 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80201c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802023:	eb ac                	jmp    801fd1 <read+0x6a>
+
+0000000000802025 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802025:	55                   	push   %rbp
+  802026:	48 89 e5             	mov    %rsp,%rbp
+  802029:	41 57                	push   %r15
+  80202b:	41 56                	push   %r14
+  80202d:	41 55                	push   %r13
+  80202f:	41 54                	push   %r12
+  802031:	53                   	push   %rbx
+  802032:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802036:	48 85 d2             	test   %rdx,%rdx
+  802039:	74 54                	je     80208f <readn+0x6a>
+  80203b:	41 89 fd             	mov    %edi,%r13d
+  80203e:	49 89 f6             	mov    %rsi,%r14
+  802041:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802044:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802049:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80204e:	49 bf 67 1f 80 00 00 	movabs $0x801f67,%r15
+  802055:	00 00 00 
+  802058:	4c 89 e2             	mov    %r12,%rdx
+  80205b:	48 29 f2             	sub    %rsi,%rdx
+  80205e:	4c 01 f6             	add    %r14,%rsi
+  802061:	44 89 ef             	mov    %r13d,%edi
+  802064:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802067:	85 c0                	test   %eax,%eax
+  802069:	78 20                	js     80208b <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80206b:	01 c3                	add    %eax,%ebx
+  80206d:	85 c0                	test   %eax,%eax
+  80206f:	74 08                	je     802079 <readn+0x54>
+  802071:	48 63 f3             	movslq %ebx,%rsi
+  802074:	4c 39 e6             	cmp    %r12,%rsi
+  802077:	72 df                	jb     802058 <readn+0x33>
+    }
+    return res;
+  802079:	48 63 c3             	movslq %ebx,%rax
+}
+  80207c:	48 83 c4 08          	add    $0x8,%rsp
+  802080:	5b                   	pop    %rbx
+  802081:	41 5c                	pop    %r12
+  802083:	41 5d                	pop    %r13
+  802085:	41 5e                	pop    %r14
+  802087:	41 5f                	pop    %r15
+  802089:	5d                   	pop    %rbp
+  80208a:	c3                   	ret
+        if (inc < 0) return inc;
+  80208b:	48 98                	cltq
+  80208d:	eb ed                	jmp    80207c <readn+0x57>
+    int inc = 1, res = 0;
+  80208f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802094:	eb e3                	jmp    802079 <readn+0x54>
+
+0000000000802096 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802096:	55                   	push   %rbp
+  802097:	48 89 e5             	mov    %rsp,%rbp
+  80209a:	41 56                	push   %r14
+  80209c:	41 55                	push   %r13
+  80209e:	41 54                	push   %r12
+  8020a0:	53                   	push   %rbx
+  8020a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8020a5:	89 fb                	mov    %edi,%ebx
+  8020a7:	49 89 f4             	mov    %rsi,%r12
+  8020aa:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020ad:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020b1:	48 b8 84 1c 80 00 00 	movabs $0x801c84,%rax
+  8020b8:	00 00 00 
+  8020bb:	ff d0                	call   *%rax
+  8020bd:	85 c0                	test   %eax,%eax
+  8020bf:	78 47                	js     802108 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020c1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8020c5:	41 8b 3e             	mov    (%r14),%edi
+  8020c8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020cc:	48 b8 cf 1c 80 00 00 	movabs $0x801ccf,%rax
+  8020d3:	00 00 00 
+  8020d6:	ff d0                	call   *%rax
+  8020d8:	85 c0                	test   %eax,%eax
+  8020da:	78 30                	js     80210c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020dc:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8020e1:	74 2d                	je     802110 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020e7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8020eb:	48 85 c0             	test   %rax,%rax
+  8020ee:	74 56                	je     802146 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8020f0:	4c 89 ea             	mov    %r13,%rdx
+  8020f3:	4c 89 e6             	mov    %r12,%rsi
+  8020f6:	4c 89 f7             	mov    %r14,%rdi
+  8020f9:	ff d0                	call   *%rax
+}
+  8020fb:	48 83 c4 10          	add    $0x10,%rsp
+  8020ff:	5b                   	pop    %rbx
+  802100:	41 5c                	pop    %r12
+  802102:	41 5d                	pop    %r13
+  802104:	41 5e                	pop    %r14
+  802106:	5d                   	pop    %rbp
+  802107:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802108:	48 98                	cltq
+  80210a:	eb ef                	jmp    8020fb <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80210c:	48 98                	cltq
+  80210e:	eb eb                	jmp    8020fb <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802110:	48 a1 70 87 80 00 00 	movabs 0x808770,%rax
+  802117:	00 00 00 
+  80211a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802120:	89 da                	mov    %ebx,%edx
+  802122:	48 bf 5d 3e 80 00 00 	movabs $0x803e5d,%rdi
+  802129:	00 00 00 
+  80212c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802131:	48 b9 7f 07 80 00 00 	movabs $0x80077f,%rcx
+  802138:	00 00 00 
+  80213b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80213d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802144:	eb b5                	jmp    8020fb <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802146:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80214d:	eb ac                	jmp    8020fb <write+0x65>
+
+000000000080214f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80214f:	55                   	push   %rbp
+  802150:	48 89 e5             	mov    %rsp,%rbp
+  802153:	53                   	push   %rbx
+  802154:	48 83 ec 18          	sub    $0x18,%rsp
+  802158:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80215a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80215e:	48 b8 84 1c 80 00 00 	movabs $0x801c84,%rax
+  802165:	00 00 00 
+  802168:	ff d0                	call   *%rax
+  80216a:	85 c0                	test   %eax,%eax
+  80216c:	78 0c                	js     80217a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80216e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802172:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802175:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80217a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80217e:	c9                   	leave
+  80217f:	c3                   	ret
+
+0000000000802180 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802180:	55                   	push   %rbp
+  802181:	48 89 e5             	mov    %rsp,%rbp
+  802184:	41 55                	push   %r13
+  802186:	41 54                	push   %r12
+  802188:	53                   	push   %rbx
+  802189:	48 83 ec 18          	sub    $0x18,%rsp
+  80218d:	89 fb                	mov    %edi,%ebx
+  80218f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802192:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802196:	48 b8 84 1c 80 00 00 	movabs $0x801c84,%rax
+  80219d:	00 00 00 
+  8021a0:	ff d0                	call   *%rax
+  8021a2:	85 c0                	test   %eax,%eax
+  8021a4:	78 38                	js     8021de <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021a6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8021aa:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8021ae:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021b2:	48 b8 cf 1c 80 00 00 	movabs $0x801ccf,%rax
+  8021b9:	00 00 00 
+  8021bc:	ff d0                	call   *%rax
+  8021be:	85 c0                	test   %eax,%eax
+  8021c0:	78 1c                	js     8021de <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021c2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8021c7:	74 20                	je     8021e9 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021cd:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8021d1:	48 85 c0             	test   %rax,%rax
+  8021d4:	74 47                	je     80221d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8021d6:	44 89 e6             	mov    %r12d,%esi
+  8021d9:	4c 89 ef             	mov    %r13,%rdi
+  8021dc:	ff d0                	call   *%rax
+}
+  8021de:	48 83 c4 18          	add    $0x18,%rsp
+  8021e2:	5b                   	pop    %rbx
+  8021e3:	41 5c                	pop    %r12
+  8021e5:	41 5d                	pop    %r13
+  8021e7:	5d                   	pop    %rbp
+  8021e8:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8021e9:	48 a1 70 87 80 00 00 	movabs 0x808770,%rax
+  8021f0:	00 00 00 
+  8021f3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8021f9:	89 da                	mov    %ebx,%edx
+  8021fb:	48 bf 20 3e 80 00 00 	movabs $0x803e20,%rdi
+  802202:	00 00 00 
+  802205:	b8 00 00 00 00       	mov    $0x0,%eax
+  80220a:	48 b9 7f 07 80 00 00 	movabs $0x80077f,%rcx
+  802211:	00 00 00 
+  802214:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802216:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80221b:	eb c1                	jmp    8021de <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80221d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802222:	eb ba                	jmp    8021de <ftruncate+0x5e>
+
+0000000000802224 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802224:	55                   	push   %rbp
+  802225:	48 89 e5             	mov    %rsp,%rbp
+  802228:	41 54                	push   %r12
+  80222a:	53                   	push   %rbx
+  80222b:	48 83 ec 10          	sub    $0x10,%rsp
+  80222f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802232:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802236:	48 b8 84 1c 80 00 00 	movabs $0x801c84,%rax
+  80223d:	00 00 00 
+  802240:	ff d0                	call   *%rax
+  802242:	85 c0                	test   %eax,%eax
+  802244:	78 4e                	js     802294 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802246:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80224a:	41 8b 3c 24          	mov    (%r12),%edi
+  80224e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802252:	48 b8 cf 1c 80 00 00 	movabs $0x801ccf,%rax
+  802259:	00 00 00 
+  80225c:	ff d0                	call   *%rax
+  80225e:	85 c0                	test   %eax,%eax
+  802260:	78 32                	js     802294 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802262:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802266:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80226b:	74 30                	je     80229d <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80226d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802270:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802277:	00 00 00 
+    stat->st_isdir = 0;
+  80227a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802281:	00 00 00 
+    stat->st_dev = dev;
+  802284:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80228b:	48 89 de             	mov    %rbx,%rsi
+  80228e:	4c 89 e7             	mov    %r12,%rdi
+  802291:	ff 50 28             	call   *0x28(%rax)
+}
+  802294:	48 83 c4 10          	add    $0x10,%rsp
+  802298:	5b                   	pop    %rbx
+  802299:	41 5c                	pop    %r12
+  80229b:	5d                   	pop    %rbp
+  80229c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80229d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022a2:	eb f0                	jmp    802294 <fstat+0x70>
+
+00000000008022a4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8022a4:	55                   	push   %rbp
+  8022a5:	48 89 e5             	mov    %rsp,%rbp
+  8022a8:	41 54                	push   %r12
+  8022aa:	53                   	push   %rbx
+  8022ab:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8022ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b3:	48 b8 25 25 80 00 00 	movabs $0x802525,%rax
+  8022ba:	00 00 00 
+  8022bd:	ff d0                	call   *%rax
+  8022bf:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8022c1:	85 c0                	test   %eax,%eax
+  8022c3:	78 25                	js     8022ea <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8022c5:	4c 89 e6             	mov    %r12,%rsi
+  8022c8:	89 c7                	mov    %eax,%edi
+  8022ca:	48 b8 24 22 80 00 00 	movabs $0x802224,%rax
+  8022d1:	00 00 00 
+  8022d4:	ff d0                	call   *%rax
+  8022d6:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8022d9:	89 df                	mov    %ebx,%edi
+  8022db:	48 b8 e9 1d 80 00 00 	movabs $0x801de9,%rax
+  8022e2:	00 00 00 
+  8022e5:	ff d0                	call   *%rax
+
+    return res;
+  8022e7:	44 89 e3             	mov    %r12d,%ebx
+}
+  8022ea:	89 d8                	mov    %ebx,%eax
+  8022ec:	5b                   	pop    %rbx
+  8022ed:	41 5c                	pop    %r12
+  8022ef:	5d                   	pop    %rbp
+  8022f0:	c3                   	ret
+
+00000000008022f1 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  8022f1:	55                   	push   %rbp
+  8022f2:	48 89 e5             	mov    %rsp,%rbp
+  8022f5:	41 54                	push   %r12
+  8022f7:	53                   	push   %rbx
+  8022f8:	48 83 ec 10          	sub    $0x10,%rsp
+  8022fc:	41 89 fc             	mov    %edi,%r12d
+  8022ff:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802302:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  802309:	00 00 00 
+  80230c:	83 38 00             	cmpl   $0x0,(%rax)
+  80230f:	74 5e                	je     80236f <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802311:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802317:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80231c:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  802323:	00 00 00 
+  802326:	44 89 e6             	mov    %r12d,%esi
+  802329:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  802330:	00 00 00 
+  802333:	8b 38                	mov    (%rax),%edi
+  802335:	48 b8 2d 36 80 00 00 	movabs $0x80362d,%rax
+  80233c:	00 00 00 
+  80233f:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802341:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802348:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802349:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80234e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802352:	48 89 de             	mov    %rbx,%rsi
+  802355:	bf 00 00 00 00       	mov    $0x0,%edi
+  80235a:	48 b8 98 35 80 00 00 	movabs $0x803598,%rax
+  802361:	00 00 00 
+  802364:	ff d0                	call   *%rax
+}
+  802366:	48 83 c4 10          	add    $0x10,%rsp
+  80236a:	5b                   	pop    %rbx
+  80236b:	41 5c                	pop    %r12
+  80236d:	5d                   	pop    %rbp
+  80236e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80236f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802374:	48 b8 cd 36 80 00 00 	movabs $0x8036cd,%rax
+  80237b:	00 00 00 
+  80237e:	ff d0                	call   *%rax
+  802380:	a3 00 a0 80 00 00 00 	movabs %eax,0x80a000
+  802387:	00 00 
+  802389:	eb 86                	jmp    802311 <fsipc+0x20>
+
+000000000080238b <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80238b:	55                   	push   %rbp
+  80238c:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80238f:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  802396:	00 00 00 
+  802399:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80239c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80239e:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8023a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8023a6:	bf 02 00 00 00       	mov    $0x2,%edi
+  8023ab:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  8023b2:	00 00 00 
+  8023b5:	ff d0                	call   *%rax
+}
+  8023b7:	5d                   	pop    %rbp
+  8023b8:	c3                   	ret
+
+00000000008023b9 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8023b9:	55                   	push   %rbp
+  8023ba:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8023bd:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8023c0:	a3 00 90 80 00 00 00 	movabs %eax,0x809000
+  8023c7:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8023c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8023ce:	bf 06 00 00 00       	mov    $0x6,%edi
+  8023d3:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  8023da:	00 00 00 
+  8023dd:	ff d0                	call   *%rax
+}
+  8023df:	5d                   	pop    %rbp
+  8023e0:	c3                   	ret
+
+00000000008023e1 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8023e1:	55                   	push   %rbp
+  8023e2:	48 89 e5             	mov    %rsp,%rbp
+  8023e5:	41 54                	push   %r12
+  8023e7:	53                   	push   %rbx
+  8023e8:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8023eb:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8023ee:	a3 00 90 80 00 00 00 	movabs %eax,0x809000
+  8023f5:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8023f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8023fc:	bf 05 00 00 00       	mov    $0x5,%edi
+  802401:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  802408:	00 00 00 
+  80240b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80240d:	85 c0                	test   %eax,%eax
+  80240f:	78 3d                	js     80244e <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802411:	49 bc 00 90 80 00 00 	movabs $0x809000,%r12
+  802418:	00 00 00 
+  80241b:	4c 89 e6             	mov    %r12,%rsi
+  80241e:	48 89 df             	mov    %rbx,%rdi
+  802421:	48 b8 a4 10 80 00 00 	movabs $0x8010a4,%rax
+  802428:	00 00 00 
+  80242b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80242d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802434:	00 
+  802435:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80243b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802442:	00 
+  802443:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802449:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80244e:	5b                   	pop    %rbx
+  80244f:	41 5c                	pop    %r12
+  802451:	5d                   	pop    %rbp
+  802452:	c3                   	ret
+
+0000000000802453 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802453:	55                   	push   %rbp
+  802454:	48 89 e5             	mov    %rsp,%rbp
+  802457:	41 54                	push   %r12
+  802459:	53                   	push   %rbx
+  80245a:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  80245d:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802462:	48 39 c2             	cmp    %rax,%rdx
+  802465:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802469:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80246c:	48 89 c2             	mov    %rax,%rdx
+  80246f:	48 bf 10 90 80 00 00 	movabs $0x809010,%rdi
+  802476:	00 00 00 
+  802479:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  802480:	00 00 00 
+  802483:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802485:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80248c:	00 00 00 
+  80248f:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802494:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802496:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  80249a:	be 00 00 00 00       	mov    $0x0,%esi
+  80249f:	bf 04 00 00 00       	mov    $0x4,%edi
+  8024a4:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  8024ab:	00 00 00 
+  8024ae:	ff d0                	call   *%rax
+  8024b0:	48 98                	cltq
+}
+  8024b2:	5b                   	pop    %rbx
+  8024b3:	41 5c                	pop    %r12
+  8024b5:	5d                   	pop    %rbp
+  8024b6:	c3                   	ret
+
+00000000008024b7 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8024b7:	55                   	push   %rbp
+  8024b8:	48 89 e5             	mov    %rsp,%rbp
+  8024bb:	41 54                	push   %r12
+  8024bd:	53                   	push   %rbx
+  8024be:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8024c1:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8024c8:	00 00 00 
+  8024cb:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8024ce:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8024d0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024d5:	48 39 ca             	cmp    %rcx,%rdx
+  8024d8:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8024dc:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8024e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8024ea:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  8024f1:	00 00 00 
+  8024f4:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  8024f6:	85 c0                	test   %eax,%eax
+  8024f8:	78 27                	js     802521 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  8024fa:	48 63 d8             	movslq %eax,%rbx
+  8024fd:	48 89 da             	mov    %rbx,%rdx
+  802500:	48 be 00 90 80 00 00 	movabs $0x809000,%rsi
+  802507:	00 00 00 
+  80250a:	4c 89 e7             	mov    %r12,%rdi
+  80250d:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  802514:	00 00 00 
+  802517:	ff d0                	call   *%rax
+    return bytes_read;
+  802519:	48 89 d8             	mov    %rbx,%rax
+}
+  80251c:	5b                   	pop    %rbx
+  80251d:	41 5c                	pop    %r12
+  80251f:	5d                   	pop    %rbp
+  802520:	c3                   	ret
+        return bytes_read;
+  802521:	48 98                	cltq
+  802523:	eb f7                	jmp    80251c <devfile_read+0x65>
+
+0000000000802525 <open>:
+open(const char *path, int mode) {
+  802525:	55                   	push   %rbp
+  802526:	48 89 e5             	mov    %rsp,%rbp
+  802529:	41 55                	push   %r13
+  80252b:	41 54                	push   %r12
+  80252d:	53                   	push   %rbx
+  80252e:	48 83 ec 18          	sub    $0x18,%rsp
+  802532:	49 89 fc             	mov    %rdi,%r12
+  802535:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802538:	48 b8 66 10 80 00 00 	movabs $0x801066,%rax
+  80253f:	00 00 00 
+  802542:	ff d0                	call   *%rax
+  802544:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80254a:	0f 87 8a 00 00 00    	ja     8025da <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802550:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802554:	48 b8 24 1c 80 00 00 	movabs $0x801c24,%rax
+  80255b:	00 00 00 
+  80255e:	ff d0                	call   *%rax
+  802560:	89 c3                	mov    %eax,%ebx
+  802562:	85 c0                	test   %eax,%eax
+  802564:	78 50                	js     8025b6 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802566:	4c 89 e6             	mov    %r12,%rsi
+  802569:	48 bb 00 90 80 00 00 	movabs $0x809000,%rbx
+  802570:	00 00 00 
+  802573:	48 89 df             	mov    %rbx,%rdi
+  802576:	48 b8 a4 10 80 00 00 	movabs $0x8010a4,%rax
+  80257d:	00 00 00 
+  802580:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802582:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802589:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80258d:	bf 01 00 00 00       	mov    $0x1,%edi
+  802592:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  802599:	00 00 00 
+  80259c:	ff d0                	call   *%rax
+  80259e:	89 c3                	mov    %eax,%ebx
+  8025a0:	85 c0                	test   %eax,%eax
+  8025a2:	78 1f                	js     8025c3 <open+0x9e>
+    return fd2num(fd);
+  8025a4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025a8:	48 b8 f6 1b 80 00 00 	movabs $0x801bf6,%rax
+  8025af:	00 00 00 
+  8025b2:	ff d0                	call   *%rax
+  8025b4:	89 c3                	mov    %eax,%ebx
+}
+  8025b6:	89 d8                	mov    %ebx,%eax
+  8025b8:	48 83 c4 18          	add    $0x18,%rsp
+  8025bc:	5b                   	pop    %rbx
+  8025bd:	41 5c                	pop    %r12
+  8025bf:	41 5d                	pop    %r13
+  8025c1:	5d                   	pop    %rbp
+  8025c2:	c3                   	ret
+        fd_close(fd, 0);
+  8025c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8025c8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025cc:	48 b8 3f 1d 80 00 00 	movabs $0x801d3f,%rax
+  8025d3:	00 00 00 
+  8025d6:	ff d0                	call   *%rax
+        return res;
+  8025d8:	eb dc                	jmp    8025b6 <open+0x91>
+        return -E_BAD_PATH;
+  8025da:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8025df:	eb d5                	jmp    8025b6 <open+0x91>
+
+00000000008025e1 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8025e1:	55                   	push   %rbp
+  8025e2:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8025e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ea:	bf 08 00 00 00       	mov    $0x8,%edi
+  8025ef:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  8025f6:	00 00 00 
+  8025f9:	ff d0                	call   *%rax
+}
+  8025fb:	5d                   	pop    %rbp
+  8025fc:	c3                   	ret
+
+00000000008025fd <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  8025fd:	55                   	push   %rbp
+  8025fe:	48 89 e5             	mov    %rsp,%rbp
+  802601:	41 55                	push   %r13
+  802603:	41 54                	push   %r12
+  802605:	53                   	push   %rbx
+  802606:	48 83 ec 08          	sub    $0x8,%rsp
+  80260a:	48 89 fb             	mov    %rdi,%rbx
+  80260d:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  802610:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  802613:	48 b8 9c 34 80 00 00 	movabs $0x80349c,%rax
+  80261a:	00 00 00 
+  80261d:	ff d0                	call   *%rax
+  80261f:	41 89 c1             	mov    %eax,%r9d
+  802622:	4d 89 e0             	mov    %r12,%r8
+  802625:	49 29 d8             	sub    %rbx,%r8
+  802628:	48 89 d9             	mov    %rbx,%rcx
+  80262b:	44 89 ea             	mov    %r13d,%edx
+  80262e:	48 89 de             	mov    %rbx,%rsi
+  802631:	bf 00 00 00 00       	mov    $0x0,%edi
+  802636:	48 b8 bb 16 80 00 00 	movabs $0x8016bb,%rax
+  80263d:	00 00 00 
+  802640:	ff d0                	call   *%rax
+}
+  802642:	48 83 c4 08          	add    $0x8,%rsp
+  802646:	5b                   	pop    %rbx
+  802647:	41 5c                	pop    %r12
+  802649:	41 5d                	pop    %r13
+  80264b:	5d                   	pop    %rbp
+  80264c:	c3                   	ret
+
+000000000080264d <spawn>:
+spawn(const char *prog, const char **argv) {
+  80264d:	55                   	push   %rbp
+  80264e:	48 89 e5             	mov    %rsp,%rbp
+  802651:	41 57                	push   %r15
+  802653:	41 56                	push   %r14
+  802655:	41 55                	push   %r13
+  802657:	41 54                	push   %r12
+  802659:	53                   	push   %rbx
+  80265a:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  802661:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  802664:	be 00 00 00 00       	mov    $0x0,%esi
+  802669:	48 b8 25 25 80 00 00 	movabs $0x802525,%rax
+  802670:	00 00 00 
+  802673:	ff d0                	call   *%rax
+  802675:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+    if (fd < 0) return fd;
+  80267b:	85 c0                	test   %eax,%eax
+  80267d:	0f 88 51 06 00 00    	js     802cd4 <spawn+0x687>
+  802683:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  802685:	ba 00 02 00 00       	mov    $0x200,%edx
+  80268a:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  802691:	48 b8 25 20 80 00 00 	movabs $0x802025,%rax
+  802698:	00 00 00 
+  80269b:	ff d0                	call   *%rax
+  80269d:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  80269f:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8026a4:	0f 85 76 02 00 00    	jne    802920 <spawn+0x2d3>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  8026aa:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  8026b1:	ff ff 00 
+  8026b4:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  8026bb:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  8026c2:	01 01 00 
+  8026c5:	48 39 d0             	cmp    %rdx,%rax
+  8026c8:	0f 85 8e 02 00 00    	jne    80295c <spawn+0x30f>
+        elf->e_type != ET_EXEC /* executable */ ||
+  8026ce:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  8026d5:	00 3e 00 
+  8026d8:	0f 85 7e 02 00 00    	jne    80295c <spawn+0x30f>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8026de:	b8 08 00 00 00       	mov    $0x8,%eax
+  8026e3:	cd 30                	int    $0x30
+  8026e5:	41 89 c6             	mov    %eax,%r14d
+  8026e8:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  8026ea:	85 c0                	test   %eax,%eax
+  8026ec:	0f 88 ca 05 00 00    	js     802cbc <spawn+0x66f>
+    envid_t child = res;
+  8026f2:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  8026f8:	0f b6 c0             	movzbl %al,%eax
+  8026fb:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802702:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  802709:	00 00 00 
+  80270c:	48 01 c6             	add    %rax,%rsi
+  80270f:	48 8b 06             	mov    (%rsi),%rax
+  802712:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  802719:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  802720:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  802727:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  80272e:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  802735:	48 29 ce             	sub    %rcx,%rsi
+  802738:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  80273e:	c1 e9 03             	shr    $0x3,%ecx
+  802741:	89 c9                	mov    %ecx,%ecx
+  802743:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  802746:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  80274d:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  802754:	49 8b 3c 24          	mov    (%r12),%rdi
+  802758:	48 85 ff             	test   %rdi,%rdi
+  80275b:	0f 84 8b 05 00 00    	je     802cec <spawn+0x69f>
+  802761:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  802767:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  80276d:	48 bb 66 10 80 00 00 	movabs $0x801066,%rbx
+  802774:	00 00 00 
+  802777:	ff d3                	call   *%rbx
+  802779:	4c 01 f8             	add    %r15,%rax
+  80277c:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  802780:	4c 89 ea             	mov    %r13,%rdx
+  802783:	49 83 c5 01          	add    $0x1,%r13
+  802787:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  80278c:	48 85 ff             	test   %rdi,%rdi
+  80278f:	75 e6                	jne    802777 <spawn+0x12a>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  802791:	49 89 d5             	mov    %rdx,%r13
+  802794:	48 89 95 e0 fc ff ff 	mov    %rdx,-0x320(%rbp)
+  80279b:	48 f7 d0             	not    %rax
+  80279e:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8027a5:	49 89 df             	mov    %rbx,%r15
+  8027a8:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  8027ac:	4c 89 bd f0 fc ff ff 	mov    %r15,-0x310(%rbp)
+  8027b3:	89 d0                	mov    %edx,%eax
+  8027b5:	83 c0 01             	add    $0x1,%eax
+  8027b8:	48 98                	cltq
+  8027ba:	48 c1 e0 03          	shl    $0x3,%rax
+  8027be:	49 29 c7             	sub    %rax,%r15
+  8027c1:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8027c8:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  8027cc:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  8027d2:	0f 86 cb 04 00 00    	jbe    802ca3 <spawn+0x656>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  8027d8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8027dd:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8027e2:	be 00 00 40 00       	mov    $0x400000,%esi
+  8027e7:	48 b8 54 16 80 00 00 	movabs $0x801654,%rax
+  8027ee:	00 00 00 
+  8027f1:	ff d0                	call   *%rax
+  8027f3:	85 c0                	test   %eax,%eax
+  8027f5:	0f 88 ad 04 00 00    	js     802ca8 <spawn+0x65b>
+    for (i = 0; i < argc; i++) {
+  8027fb:	4c 89 e8             	mov    %r13,%rax
+  8027fe:	45 85 ed             	test   %r13d,%r13d
+  802801:	7e 54                	jle    802857 <spawn+0x20a>
+  802803:	4d 89 fd             	mov    %r15,%r13
+  802806:	48 98                	cltq
+  802808:	4d 8d 3c c7          	lea    (%r15,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  80280c:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  802813:	00 00 00 
+  802816:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  80281d:	ff 
+  80281e:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  802822:	49 8b 34 24          	mov    (%r12),%rsi
+  802826:	48 89 df             	mov    %rbx,%rdi
+  802829:	48 b8 a4 10 80 00 00 	movabs $0x8010a4,%rax
+  802830:	00 00 00 
+  802833:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  802835:	49 8b 3c 24          	mov    (%r12),%rdi
+  802839:	48 b8 66 10 80 00 00 	movabs $0x801066,%rax
+  802840:	00 00 00 
+  802843:	ff d0                	call   *%rax
+  802845:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  80284a:	49 83 c5 08          	add    $0x8,%r13
+  80284e:	49 83 c4 08          	add    $0x8,%r12
+  802852:	4d 39 fd             	cmp    %r15,%r13
+  802855:	75 b5                	jne    80280c <spawn+0x1bf>
+    argv_store[argc] = 0;
+  802857:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  80285e:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  802865:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  802866:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  80286d:	0f 85 30 01 00 00    	jne    8029a3 <spawn+0x356>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  802873:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  80287a:	00 00 00 
+  80287d:	48 8b 9d e8 fc ff ff 	mov    -0x318(%rbp),%rbx
+  802884:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  80288b:	ff 
+  80288c:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  802890:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  802897:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  80289b:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  8028a2:	00 00 00 
+  8028a5:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  8028ac:	ff 
+  8028ad:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  8028b4:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8028ba:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  8028c0:	44 89 f2             	mov    %r14d,%edx
+  8028c3:	be 00 00 40 00       	mov    $0x400000,%esi
+  8028c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028cd:	48 b8 bb 16 80 00 00 	movabs $0x8016bb,%rax
+  8028d4:	00 00 00 
+  8028d7:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  8028d9:	48 bb 20 17 80 00 00 	movabs $0x801720,%rbx
+  8028e0:	00 00 00 
+  8028e3:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8028e8:	be 00 00 40 00       	mov    $0x400000,%esi
+  8028ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028f2:	ff d3                	call   *%rbx
+  8028f4:	85 c0                	test   %eax,%eax
+  8028f6:	78 eb                	js     8028e3 <spawn+0x296>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  8028f8:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  8028ff:	4c 8d a4 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r12
+  802906:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802907:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  80290e:	00 
+  80290f:	0f 84 87 02 00 00    	je     802b9c <spawn+0x54f>
+  802915:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  80291b:	e9 fe 00 00 00       	jmp    802a1e <spawn+0x3d1>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  802920:	48 bf a0 3e 80 00 00 	movabs $0x803ea0,%rdi
+  802927:	00 00 00 
+  80292a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80292f:	48 ba 7f 07 80 00 00 	movabs $0x80077f,%rdx
+  802936:	00 00 00 
+  802939:	ff d2                	call   *%rdx
+        close(fd);
+  80293b:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802941:	48 b8 e9 1d 80 00 00 	movabs $0x801de9,%rax
+  802948:	00 00 00 
+  80294b:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  80294d:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  802954:	ff ff ff 
+  802957:	e9 78 03 00 00       	jmp    802cd4 <spawn+0x687>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80295c:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  802961:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  802967:	48 bf 00 3f 80 00 00 	movabs $0x803f00,%rdi
+  80296e:	00 00 00 
+  802971:	b8 00 00 00 00       	mov    $0x0,%eax
+  802976:	48 b9 7f 07 80 00 00 	movabs $0x80077f,%rcx
+  80297d:	00 00 00 
+  802980:	ff d1                	call   *%rcx
+        close(fd);
+  802982:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802988:	48 b8 e9 1d 80 00 00 	movabs $0x801de9,%rax
+  80298f:	00 00 00 
+  802992:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  802994:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  80299b:	ff ff ff 
+  80299e:	e9 31 03 00 00       	jmp    802cd4 <spawn+0x687>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8029a3:	48 b9 d0 3e 80 00 00 	movabs $0x803ed0,%rcx
+  8029aa:	00 00 00 
+  8029ad:	48 ba 1a 3f 80 00 00 	movabs $0x803f1a,%rdx
+  8029b4:	00 00 00 
+  8029b7:	be f0 00 00 00       	mov    $0xf0,%esi
+  8029bc:	48 bf 2f 3f 80 00 00 	movabs $0x803f2f,%rdi
+  8029c3:	00 00 00 
+  8029c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029cb:	49 b8 2f 06 80 00 00 	movabs $0x80062f,%r8
+  8029d2:	00 00 00 
+  8029d5:	41 ff d0             	call   *%r8
+        if (err)
+            return err;
+    }
+
+    /* Allocate filesz in parent to UTEMP */
+    int err = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+  8029d8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8029dd:	4c 89 ea             	mov    %r13,%rdx
+  8029e0:	be 00 00 40 00       	mov    $0x400000,%esi
+  8029e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029ea:	48 b8 54 16 80 00 00 	movabs $0x801654,%rax
+  8029f1:	00 00 00 
+  8029f4:	ff d0                	call   *%rax
+    if (err)
+  8029f6:	85 c0                	test   %eax,%eax
+  8029f8:	0f 84 d2 00 00 00    	je     802ad0 <spawn+0x483>
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  8029fe:	85 c0                	test   %eax,%eax
+  802a00:	0f 88 99 02 00 00    	js     802c9f <spawn+0x652>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802a06:	49 83 c7 01          	add    $0x1,%r15
+  802a0a:	49 83 c4 38          	add    $0x38,%r12
+  802a0e:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  802a15:	49 39 c7             	cmp    %rax,%r15
+  802a18:	0f 83 7e 01 00 00    	jae    802b9c <spawn+0x54f>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  802a1e:	41 83 3c 24 01       	cmpl   $0x1,(%r12)
+  802a23:	75 e1                	jne    802a06 <spawn+0x3b9>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  802a25:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802a2a:	41 89 c6             	mov    %eax,%r14d
+  802a2d:	41 83 e6 02          	and    $0x2,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  802a31:	44 89 f2             	mov    %r14d,%edx
+  802a34:	83 ca 04             	or     $0x4,%edx
+  802a37:	a8 04                	test   $0x4,%al
+  802a39:	44 0f 45 f2          	cmovne %edx,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  802a3d:	44 89 f2             	mov    %r14d,%edx
+  802a40:	83 ca 01             	or     $0x1,%edx
+  802a43:	a8 01                	test   $0x1,%al
+  802a45:	44 0f 45 f2          	cmovne %edx,%r14d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  802a49:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802a4e:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  802a54:	4d 8b 6c 24 20       	mov    0x20(%r12),%r13
+  802a59:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  802a5e:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  802a63:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  802a69:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  802a6f:	89 d9                	mov    %ebx,%ecx
+  802a71:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802a77:	74 14                	je     802a8d <spawn+0x440>
+        va -= res;
+  802a79:	48 63 f1             	movslq %ecx,%rsi
+  802a7c:	48 29 f3             	sub    %rsi,%rbx
+        memsz += res;
+  802a7f:	48 01 f2             	add    %rsi,%rdx
+        filesz += res;
+  802a82:	49 01 f5             	add    %rsi,%r13
+        fileoffset -= res;
+  802a85:	29 c8                	sub    %ecx,%eax
+  802a87:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    filesz = ROUNDUP(filesz, PAGE_SIZE);
+  802a8d:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802a94:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    if (filesz < memsz) {
+  802a9b:	49 39 d5             	cmp    %rdx,%r13
+  802a9e:	0f 83 34 ff ff ff    	jae    8029d8 <spawn+0x38b>
+        int err = sys_alloc_region(child, (void *)va + filesz, memsz - filesz, PROT_RW);
+  802aa4:	4c 29 ea             	sub    %r13,%rdx
+  802aa7:	49 8d 74 1d 00       	lea    0x0(%r13,%rbx,1),%rsi
+  802aac:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802ab1:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  802ab7:	48 b8 54 16 80 00 00 	movabs $0x801654,%rax
+  802abe:	00 00 00 
+  802ac1:	ff d0                	call   *%rax
+        if (err)
+  802ac3:	85 c0                	test   %eax,%eax
+  802ac5:	0f 84 0d ff ff ff    	je     8029d8 <spawn+0x38b>
+  802acb:	e9 2e ff ff ff       	jmp    8029fe <spawn+0x3b1>
+        return err;
+
+    /* seek() fd to fileoffset  */
+    err = seek(fd, fileoffset);
+  802ad0:	8b b5 f0 fc ff ff    	mov    -0x310(%rbp),%esi
+  802ad6:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802adc:	48 b8 4f 21 80 00 00 	movabs $0x80214f,%rax
+  802ae3:	00 00 00 
+  802ae6:	ff d0                	call   *%rax
+    if (err)
+  802ae8:	85 c0                	test   %eax,%eax
+  802aea:	0f 85 0e ff ff ff    	jne    8029fe <spawn+0x3b1>
+        return err;
+
+    /* read filesz to UTEMP */
+    ssize_t bytes_read = readn(fd, UTEMP, filesz);
+  802af0:	4c 89 ea             	mov    %r13,%rdx
+  802af3:	be 00 00 40 00       	mov    $0x400000,%esi
+  802af8:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802afe:	48 b8 25 20 80 00 00 	movabs $0x802025,%rax
+  802b05:	00 00 00 
+  802b08:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802b0a:	48 85 c0             	test   %rax,%rax
+  802b0d:	0f 88 eb fe ff ff    	js     8029fe <spawn+0x3b1>
+        return bytes_read;
+    assert(bytes_read == filesz);
+  802b13:	4c 39 e8             	cmp    %r13,%rax
+  802b16:	75 4f                	jne    802b67 <spawn+0x51a>
+
+    /* Map read section conents to child */
+    err = sys_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+  802b18:	45 89 f1             	mov    %r14d,%r9d
+  802b1b:	41 80 c9 80          	or     $0x80,%r9b
+  802b1f:	4d 89 e8             	mov    %r13,%r8
+  802b22:	48 89 d9             	mov    %rbx,%rcx
+  802b25:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  802b2b:	be 00 00 40 00       	mov    $0x400000,%esi
+  802b30:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b35:	48 b8 bb 16 80 00 00 	movabs $0x8016bb,%rax
+  802b3c:	00 00 00 
+  802b3f:	ff d0                	call   *%rax
+    if (err)
+  802b41:	85 c0                	test   %eax,%eax
+  802b43:	0f 85 b5 fe ff ff    	jne    8029fe <spawn+0x3b1>
+        return err;
+
+    /* Unmap it from parent */
+    err = sys_unmap_region(CURENVID, UTEMP, filesz);
+  802b49:	4c 89 ea             	mov    %r13,%rdx
+  802b4c:	be 00 00 40 00       	mov    $0x400000,%esi
+  802b51:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b56:	48 b8 20 17 80 00 00 	movabs $0x801720,%rax
+  802b5d:	00 00 00 
+  802b60:	ff d0                	call   *%rax
+    if (err)
+  802b62:	e9 97 fe ff ff       	jmp    8029fe <spawn+0x3b1>
+    assert(bytes_read == filesz);
+  802b67:	48 b9 3b 3f 80 00 00 	movabs $0x803f3b,%rcx
+  802b6e:	00 00 00 
+  802b71:	48 ba 1a 3f 80 00 00 	movabs $0x803f1a,%rdx
+  802b78:	00 00 00 
+  802b7b:	be 2f 01 00 00       	mov    $0x12f,%esi
+  802b80:	48 bf 2f 3f 80 00 00 	movabs $0x803f2f,%rdi
+  802b87:	00 00 00 
+  802b8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b8f:	49 b8 2f 06 80 00 00 	movabs $0x80062f,%r8
+  802b96:	00 00 00 
+  802b99:	41 ff d0             	call   *%r8
+    close(fd);
+  802b9c:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802ba2:	48 b8 e9 1d 80 00 00 	movabs $0x801de9,%rax
+  802ba9:	00 00 00 
+  802bac:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  802bae:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  802bb5:	48 bf fd 25 80 00 00 	movabs $0x8025fd,%rdi
+  802bbc:	00 00 00 
+  802bbf:	48 b8 10 35 80 00 00 	movabs $0x803510,%rax
+  802bc6:	00 00 00 
+  802bc9:	ff d0                	call   *%rax
+  802bcb:	85 c0                	test   %eax,%eax
+  802bcd:	78 49                	js     802c18 <spawn+0x5cb>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802bcf:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  802bd6:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802bdc:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  802be3:	00 00 00 
+  802be6:	ff d0                	call   *%rax
+  802be8:	85 c0                	test   %eax,%eax
+  802bea:	78 59                	js     802c45 <spawn+0x5f8>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802bec:	be 02 00 00 00       	mov    $0x2,%esi
+  802bf1:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802bf7:	48 b8 57 18 80 00 00 	movabs $0x801857,%rax
+  802bfe:	00 00 00 
+  802c01:	ff d0                	call   *%rax
+  802c03:	85 c0                	test   %eax,%eax
+  802c05:	78 6b                	js     802c72 <spawn+0x625>
+    return child;
+  802c07:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  802c0d:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+  802c13:	e9 bc 00 00 00       	jmp    802cd4 <spawn+0x687>
+        panic("copy_shared_region: %i", res);
+  802c18:	89 c1                	mov    %eax,%ecx
+  802c1a:	48 ba 50 3f 80 00 00 	movabs $0x803f50,%rdx
+  802c21:	00 00 00 
+  802c24:	be 84 00 00 00       	mov    $0x84,%esi
+  802c29:	48 bf 2f 3f 80 00 00 	movabs $0x803f2f,%rdi
+  802c30:	00 00 00 
+  802c33:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c38:	49 b8 2f 06 80 00 00 	movabs $0x80062f,%r8
+  802c3f:	00 00 00 
+  802c42:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  802c45:	89 c1                	mov    %eax,%ecx
+  802c47:	48 ba 67 3f 80 00 00 	movabs $0x803f67,%rdx
+  802c4e:	00 00 00 
+  802c51:	be 87 00 00 00       	mov    $0x87,%esi
+  802c56:	48 bf 2f 3f 80 00 00 	movabs $0x803f2f,%rdi
+  802c5d:	00 00 00 
+  802c60:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c65:	49 b8 2f 06 80 00 00 	movabs $0x80062f,%r8
+  802c6c:	00 00 00 
+  802c6f:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  802c72:	89 c1                	mov    %eax,%ecx
+  802c74:	48 ba 81 3f 80 00 00 	movabs $0x803f81,%rdx
+  802c7b:	00 00 00 
+  802c7e:	be 8a 00 00 00       	mov    $0x8a,%esi
+  802c83:	48 bf 2f 3f 80 00 00 	movabs $0x803f2f,%rdi
+  802c8a:	00 00 00 
+  802c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c92:	49 b8 2f 06 80 00 00 	movabs $0x80062f,%r8
+  802c99:	00 00 00 
+  802c9c:	41 ff d0             	call   *%r8
+  802c9f:	89 c3                	mov    %eax,%ebx
+  802ca1:	eb 07                	jmp    802caa <spawn+0x65d>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  802ca3:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802ca8:	89 c3                	mov    %eax,%ebx
+    sys_env_destroy(child);
+  802caa:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802cb0:	48 b8 29 15 80 00 00 	movabs $0x801529,%rax
+  802cb7:	00 00 00 
+  802cba:	ff d0                	call   *%rax
+    close(fd);
+  802cbc:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802cc2:	48 b8 e9 1d 80 00 00 	movabs $0x801de9,%rax
+  802cc9:	00 00 00 
+  802ccc:	ff d0                	call   *%rax
+    return res;
+  802cce:	89 9d fc fc ff ff    	mov    %ebx,-0x304(%rbp)
+}
+  802cd4:	8b 85 fc fc ff ff    	mov    -0x304(%rbp),%eax
+  802cda:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  802ce1:	5b                   	pop    %rbx
+  802ce2:	41 5c                	pop    %r12
+  802ce4:	41 5d                	pop    %r13
+  802ce6:	41 5e                	pop    %r14
+  802ce8:	41 5f                	pop    %r15
+  802cea:	5d                   	pop    %rbp
+  802ceb:	c3                   	ret
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  802cec:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802cf1:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802cf6:	be 00 00 40 00       	mov    $0x400000,%esi
+  802cfb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d00:	48 b8 54 16 80 00 00 	movabs $0x801654,%rax
+  802d07:	00 00 00 
+  802d0a:	ff d0                	call   *%rax
+  802d0c:	85 c0                	test   %eax,%eax
+  802d0e:	78 98                	js     802ca8 <spawn+0x65b>
+    for (argc = 0; argv[argc] != 0; argc++)
+  802d10:	48 c7 85 e0 fc ff ff 	movq   $0x0,-0x320(%rbp)
+  802d17:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  802d1b:	48 c7 85 e8 fc ff ff 	movq   $0x40fff8,-0x318(%rbp)
+  802d22:	f8 ff 40 00 
+  802d26:	48 c7 85 f0 fc ff ff 	movq   $0x410000,-0x310(%rbp)
+  802d2d:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  802d31:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  802d36:	e9 1c fb ff ff       	jmp    802857 <spawn+0x20a>
+
+0000000000802d3b <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  802d3b:	55                   	push   %rbp
+  802d3c:	48 89 e5             	mov    %rsp,%rbp
+  802d3f:	48 83 ec 50          	sub    $0x50,%rsp
+  802d43:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802d47:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802d4b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802d4f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  802d53:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802d5a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d62:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802d66:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  802d6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  802d6f:	eb 15                	jmp    802d86 <spawnl+0x4b>
+  802d71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d75:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d7d:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802d81:	74 1c                	je     802d9f <spawnl+0x64>
+  802d83:	83 c1 01             	add    $0x1,%ecx
+  802d86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d89:	83 f8 2f             	cmp    $0x2f,%eax
+  802d8c:	77 e3                	ja     802d71 <spawnl+0x36>
+  802d8e:	89 c2                	mov    %eax,%edx
+  802d90:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  802d94:	4c 01 d2             	add    %r10,%rdx
+  802d97:	83 c0 08             	add    $0x8,%eax
+  802d9a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d9d:	eb de                	jmp    802d7d <spawnl+0x42>
+    const char *argv[argc + 2];
+  802d9f:	8d 41 02             	lea    0x2(%rcx),%eax
+  802da2:	48 98                	cltq
+  802da4:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  802dab:	00 
+  802dac:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  802db0:	48 29 c4             	sub    %rax,%rsp
+  802db3:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  802db8:	4c 89 c0             	mov    %r8,%rax
+  802dbb:	48 c1 e8 03          	shr    $0x3,%rax
+  802dbf:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  802dc3:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  802dca:	00 
+    argv[argc + 1] = NULL;
+  802dcb:	8d 41 01             	lea    0x1(%rcx),%eax
+  802dce:	48 98                	cltq
+  802dd0:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  802dd7:	00 
+    va_start(vl, arg0);
+  802dd8:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802ddf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802de3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802de7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802deb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  802def:	85 c9                	test   %ecx,%ecx
+  802df1:	74 41                	je     802e34 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802df3:	49 89 c1             	mov    %rax,%r9
+  802df6:	49 8d 40 08          	lea    0x8(%r8),%rax
+  802dfa:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  802dfd:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  802e02:	eb 1b                	jmp    802e1f <spawnl+0xe4>
+  802e04:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802e08:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  802e0c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  802e10:	48 8b 11             	mov    (%rcx),%rdx
+  802e13:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  802e16:	48 83 c0 08          	add    $0x8,%rax
+  802e1a:	48 39 f0             	cmp    %rsi,%rax
+  802e1d:	74 15                	je     802e34 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802e1f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802e22:	83 fa 2f             	cmp    $0x2f,%edx
+  802e25:	77 dd                	ja     802e04 <spawnl+0xc9>
+  802e27:	89 d1                	mov    %edx,%ecx
+  802e29:	4c 01 c9             	add    %r9,%rcx
+  802e2c:	83 c2 08             	add    $0x8,%edx
+  802e2f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  802e32:	eb dc                	jmp    802e10 <spawnl+0xd5>
+    return spawn(prog, argv);
+  802e34:	4c 89 c6             	mov    %r8,%rsi
+  802e37:	48 b8 4d 26 80 00 00 	movabs $0x80264d,%rax
+  802e3e:	00 00 00 
+  802e41:	ff d0                	call   *%rax
+}
+  802e43:	c9                   	leave
+  802e44:	c3                   	ret
+
+0000000000802e45 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802e45:	55                   	push   %rbp
+  802e46:	48 89 e5             	mov    %rsp,%rbp
+  802e49:	41 54                	push   %r12
+  802e4b:	53                   	push   %rbx
+  802e4c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e4f:	48 b8 08 1c 80 00 00 	movabs $0x801c08,%rax
+  802e56:	00 00 00 
+  802e59:	ff d0                	call   *%rax
+  802e5b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802e5e:	48 be 98 3f 80 00 00 	movabs $0x803f98,%rsi
+  802e65:	00 00 00 
+  802e68:	48 89 df             	mov    %rbx,%rdi
+  802e6b:	48 b8 a4 10 80 00 00 	movabs $0x8010a4,%rax
+  802e72:	00 00 00 
+  802e75:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802e77:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802e7c:	41 2b 04 24          	sub    (%r12),%eax
+  802e80:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802e86:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802e8d:	00 00 00 
+    stat->st_dev = &devpipe;
+  802e90:	48 b8 00 68 80 00 00 	movabs $0x806800,%rax
+  802e97:	00 00 00 
+  802e9a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802ea1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ea6:	5b                   	pop    %rbx
+  802ea7:	41 5c                	pop    %r12
+  802ea9:	5d                   	pop    %rbp
+  802eaa:	c3                   	ret
+
+0000000000802eab <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802eab:	55                   	push   %rbp
+  802eac:	48 89 e5             	mov    %rsp,%rbp
+  802eaf:	41 54                	push   %r12
+  802eb1:	53                   	push   %rbx
+  802eb2:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802eb5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802eba:	48 89 fe             	mov    %rdi,%rsi
+  802ebd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ec2:	49 bc 20 17 80 00 00 	movabs $0x801720,%r12
+  802ec9:	00 00 00 
+  802ecc:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802ecf:	48 89 df             	mov    %rbx,%rdi
+  802ed2:	48 b8 08 1c 80 00 00 	movabs $0x801c08,%rax
+  802ed9:	00 00 00 
+  802edc:	ff d0                	call   *%rax
+  802ede:	48 89 c6             	mov    %rax,%rsi
+  802ee1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ee6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eeb:	41 ff d4             	call   *%r12
+}
+  802eee:	5b                   	pop    %rbx
+  802eef:	41 5c                	pop    %r12
+  802ef1:	5d                   	pop    %rbp
+  802ef2:	c3                   	ret
+
+0000000000802ef3 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802ef3:	55                   	push   %rbp
+  802ef4:	48 89 e5             	mov    %rsp,%rbp
+  802ef7:	41 57                	push   %r15
+  802ef9:	41 56                	push   %r14
+  802efb:	41 55                	push   %r13
+  802efd:	41 54                	push   %r12
+  802eff:	53                   	push   %rbx
+  802f00:	48 83 ec 18          	sub    $0x18,%rsp
+  802f04:	49 89 fc             	mov    %rdi,%r12
+  802f07:	49 89 f5             	mov    %rsi,%r13
+  802f0a:	49 89 d7             	mov    %rdx,%r15
+  802f0d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f11:	48 b8 08 1c 80 00 00 	movabs $0x801c08,%rax
+  802f18:	00 00 00 
+  802f1b:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802f1d:	4d 85 ff             	test   %r15,%r15
+  802f20:	0f 84 af 00 00 00    	je     802fd5 <devpipe_write+0xe2>
+  802f26:	48 89 c3             	mov    %rax,%rbx
+  802f29:	4c 89 f8             	mov    %r15,%rax
+  802f2c:	4d 89 ef             	mov    %r13,%r15
+  802f2f:	4c 01 e8             	add    %r13,%rax
+  802f32:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802f36:	49 bd 28 16 80 00 00 	movabs $0x801628,%r13
+  802f3d:	00 00 00 
+            sys_yield();
+  802f40:	49 be c5 15 80 00 00 	movabs $0x8015c5,%r14
+  802f47:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802f4a:	8b 73 04             	mov    0x4(%rbx),%esi
+  802f4d:	48 63 ce             	movslq %esi,%rcx
+  802f50:	48 63 03             	movslq (%rbx),%rax
+  802f53:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802f59:	48 39 c1             	cmp    %rax,%rcx
+  802f5c:	72 2e                	jb     802f8c <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802f5e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802f63:	48 89 da             	mov    %rbx,%rdx
+  802f66:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f6b:	4c 89 e7             	mov    %r12,%rdi
+  802f6e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802f71:	85 c0                	test   %eax,%eax
+  802f73:	74 66                	je     802fdb <devpipe_write+0xe8>
+            sys_yield();
+  802f75:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802f78:	8b 73 04             	mov    0x4(%rbx),%esi
+  802f7b:	48 63 ce             	movslq %esi,%rcx
+  802f7e:	48 63 03             	movslq (%rbx),%rax
+  802f81:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802f87:	48 39 c1             	cmp    %rax,%rcx
+  802f8a:	73 d2                	jae    802f5e <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802f8c:	41 0f b6 3f          	movzbl (%r15),%edi
+  802f90:	48 89 ca             	mov    %rcx,%rdx
+  802f93:	48 c1 ea 03          	shr    $0x3,%rdx
+  802f97:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802f9e:	08 10 20 
+  802fa1:	48 f7 e2             	mul    %rdx
+  802fa4:	48 c1 ea 06          	shr    $0x6,%rdx
+  802fa8:	48 89 d0             	mov    %rdx,%rax
+  802fab:	48 c1 e0 09          	shl    $0x9,%rax
+  802faf:	48 29 d0             	sub    %rdx,%rax
+  802fb2:	48 c1 e0 03          	shl    $0x3,%rax
+  802fb6:	48 29 c1             	sub    %rax,%rcx
+  802fb9:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802fbe:	83 c6 01             	add    $0x1,%esi
+  802fc1:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802fc4:	49 83 c7 01          	add    $0x1,%r15
+  802fc8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fcc:	49 39 c7             	cmp    %rax,%r15
+  802fcf:	0f 85 75 ff ff ff    	jne    802f4a <devpipe_write+0x57>
+    return n;
+  802fd5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802fd9:	eb 05                	jmp    802fe0 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fe0:	48 83 c4 18          	add    $0x18,%rsp
+  802fe4:	5b                   	pop    %rbx
+  802fe5:	41 5c                	pop    %r12
+  802fe7:	41 5d                	pop    %r13
+  802fe9:	41 5e                	pop    %r14
+  802feb:	41 5f                	pop    %r15
+  802fed:	5d                   	pop    %rbp
+  802fee:	c3                   	ret
+
+0000000000802fef <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802fef:	55                   	push   %rbp
+  802ff0:	48 89 e5             	mov    %rsp,%rbp
+  802ff3:	41 57                	push   %r15
+  802ff5:	41 56                	push   %r14
+  802ff7:	41 55                	push   %r13
+  802ff9:	41 54                	push   %r12
+  802ffb:	53                   	push   %rbx
+  802ffc:	48 83 ec 18          	sub    $0x18,%rsp
+  803000:	49 89 fc             	mov    %rdi,%r12
+  803003:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803007:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80300b:	48 b8 08 1c 80 00 00 	movabs $0x801c08,%rax
+  803012:	00 00 00 
+  803015:	ff d0                	call   *%rax
+  803017:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80301a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803020:	49 bd 28 16 80 00 00 	movabs $0x801628,%r13
+  803027:	00 00 00 
+            sys_yield();
+  80302a:	49 be c5 15 80 00 00 	movabs $0x8015c5,%r14
+  803031:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803034:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803039:	74 7d                	je     8030b8 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80303b:	8b 03                	mov    (%rbx),%eax
+  80303d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803040:	75 26                	jne    803068 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803042:	4d 85 ff             	test   %r15,%r15
+  803045:	75 77                	jne    8030be <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803047:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80304c:	48 89 da             	mov    %rbx,%rdx
+  80304f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803054:	4c 89 e7             	mov    %r12,%rdi
+  803057:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80305a:	85 c0                	test   %eax,%eax
+  80305c:	74 72                	je     8030d0 <devpipe_read+0xe1>
+            sys_yield();
+  80305e:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803061:	8b 03                	mov    (%rbx),%eax
+  803063:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803066:	74 df                	je     803047 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803068:	48 63 c8             	movslq %eax,%rcx
+  80306b:	48 89 ca             	mov    %rcx,%rdx
+  80306e:	48 c1 ea 03          	shr    $0x3,%rdx
+  803072:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803079:	08 10 20 
+  80307c:	48 89 d0             	mov    %rdx,%rax
+  80307f:	48 f7 e6             	mul    %rsi
+  803082:	48 c1 ea 06          	shr    $0x6,%rdx
+  803086:	48 89 d0             	mov    %rdx,%rax
+  803089:	48 c1 e0 09          	shl    $0x9,%rax
+  80308d:	48 29 d0             	sub    %rdx,%rax
+  803090:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803097:	00 
+  803098:	48 89 c8             	mov    %rcx,%rax
+  80309b:	48 29 d0             	sub    %rdx,%rax
+  80309e:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8030a3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8030a7:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8030ab:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8030ae:	49 83 c7 01          	add    $0x1,%r15
+  8030b2:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8030b6:	75 83                	jne    80303b <devpipe_read+0x4c>
+    return n;
+  8030b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030bc:	eb 03                	jmp    8030c1 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8030be:	4c 89 f8             	mov    %r15,%rax
+}
+  8030c1:	48 83 c4 18          	add    $0x18,%rsp
+  8030c5:	5b                   	pop    %rbx
+  8030c6:	41 5c                	pop    %r12
+  8030c8:	41 5d                	pop    %r13
+  8030ca:	41 5e                	pop    %r14
+  8030cc:	41 5f                	pop    %r15
+  8030ce:	5d                   	pop    %rbp
+  8030cf:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8030d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d5:	eb ea                	jmp    8030c1 <devpipe_read+0xd2>
+
+00000000008030d7 <pipe>:
+pipe(int pfd[2]) {
+  8030d7:	55                   	push   %rbp
+  8030d8:	48 89 e5             	mov    %rsp,%rbp
+  8030db:	41 55                	push   %r13
+  8030dd:	41 54                	push   %r12
+  8030df:	53                   	push   %rbx
+  8030e0:	48 83 ec 18          	sub    $0x18,%rsp
+  8030e4:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8030e7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8030eb:	48 b8 24 1c 80 00 00 	movabs $0x801c24,%rax
+  8030f2:	00 00 00 
+  8030f5:	ff d0                	call   *%rax
+  8030f7:	89 c3                	mov    %eax,%ebx
+  8030f9:	85 c0                	test   %eax,%eax
+  8030fb:	0f 88 a0 01 00 00    	js     8032a1 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803101:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803106:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80310b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80310f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803114:	48 b8 54 16 80 00 00 	movabs $0x801654,%rax
+  80311b:	00 00 00 
+  80311e:	ff d0                	call   *%rax
+  803120:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803122:	85 c0                	test   %eax,%eax
+  803124:	0f 88 77 01 00 00    	js     8032a1 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80312a:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80312e:	48 b8 24 1c 80 00 00 	movabs $0x801c24,%rax
+  803135:	00 00 00 
+  803138:	ff d0                	call   *%rax
+  80313a:	89 c3                	mov    %eax,%ebx
+  80313c:	85 c0                	test   %eax,%eax
+  80313e:	0f 88 43 01 00 00    	js     803287 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803144:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803149:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80314e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803152:	bf 00 00 00 00       	mov    $0x0,%edi
+  803157:	48 b8 54 16 80 00 00 	movabs $0x801654,%rax
+  80315e:	00 00 00 
+  803161:	ff d0                	call   *%rax
+  803163:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803165:	85 c0                	test   %eax,%eax
+  803167:	0f 88 1a 01 00 00    	js     803287 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80316d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803171:	48 b8 08 1c 80 00 00 	movabs $0x801c08,%rax
+  803178:	00 00 00 
+  80317b:	ff d0                	call   *%rax
+  80317d:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803180:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803185:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80318a:	48 89 c6             	mov    %rax,%rsi
+  80318d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803192:	48 b8 54 16 80 00 00 	movabs $0x801654,%rax
+  803199:	00 00 00 
+  80319c:	ff d0                	call   *%rax
+  80319e:	89 c3                	mov    %eax,%ebx
+  8031a0:	85 c0                	test   %eax,%eax
+  8031a2:	0f 88 c5 00 00 00    	js     80326d <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8031a8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8031ac:	48 b8 08 1c 80 00 00 	movabs $0x801c08,%rax
+  8031b3:	00 00 00 
+  8031b6:	ff d0                	call   *%rax
+  8031b8:	48 89 c1             	mov    %rax,%rcx
+  8031bb:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8031c1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8031c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031cc:	4c 89 ee             	mov    %r13,%rsi
+  8031cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031d4:	48 b8 bb 16 80 00 00 	movabs $0x8016bb,%rax
+  8031db:	00 00 00 
+  8031de:	ff d0                	call   *%rax
+  8031e0:	89 c3                	mov    %eax,%ebx
+  8031e2:	85 c0                	test   %eax,%eax
+  8031e4:	78 6e                	js     803254 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8031e6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031eb:	4c 89 ef             	mov    %r13,%rdi
+  8031ee:	48 b8 f6 15 80 00 00 	movabs $0x8015f6,%rax
+  8031f5:	00 00 00 
+  8031f8:	ff d0                	call   *%rax
+  8031fa:	83 f8 02             	cmp    $0x2,%eax
+  8031fd:	0f 85 ab 00 00 00    	jne    8032ae <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803203:	a1 00 68 80 00 00 00 	movabs 0x806800,%eax
+  80320a:	00 00 
+  80320c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803210:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803212:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803216:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80321d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803221:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803223:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803227:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80322e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803232:	48 bb f6 1b 80 00 00 	movabs $0x801bf6,%rbx
+  803239:	00 00 00 
+  80323c:	ff d3                	call   *%rbx
+  80323e:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803242:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803246:	ff d3                	call   *%rbx
+  803248:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80324d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803252:	eb 4d                	jmp    8032a1 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803254:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803259:	4c 89 ee             	mov    %r13,%rsi
+  80325c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803261:	48 b8 20 17 80 00 00 	movabs $0x801720,%rax
+  803268:	00 00 00 
+  80326b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80326d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803272:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803276:	bf 00 00 00 00       	mov    $0x0,%edi
+  80327b:	48 b8 20 17 80 00 00 	movabs $0x801720,%rax
+  803282:	00 00 00 
+  803285:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803287:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80328c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803290:	bf 00 00 00 00       	mov    $0x0,%edi
+  803295:	48 b8 20 17 80 00 00 	movabs $0x801720,%rax
+  80329c:	00 00 00 
+  80329f:	ff d0                	call   *%rax
+}
+  8032a1:	89 d8                	mov    %ebx,%eax
+  8032a3:	48 83 c4 18          	add    $0x18,%rsp
+  8032a7:	5b                   	pop    %rbx
+  8032a8:	41 5c                	pop    %r12
+  8032aa:	41 5d                	pop    %r13
+  8032ac:	5d                   	pop    %rbp
+  8032ad:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8032ae:	48 b9 b0 3f 80 00 00 	movabs $0x803fb0,%rcx
+  8032b5:	00 00 00 
+  8032b8:	48 ba 1a 3f 80 00 00 	movabs $0x803f1a,%rdx
+  8032bf:	00 00 00 
+  8032c2:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8032c7:	48 bf 9f 3f 80 00 00 	movabs $0x803f9f,%rdi
+  8032ce:	00 00 00 
+  8032d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d6:	49 b8 2f 06 80 00 00 	movabs $0x80062f,%r8
+  8032dd:	00 00 00 
+  8032e0:	41 ff d0             	call   *%r8
+
+00000000008032e3 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8032e3:	55                   	push   %rbp
+  8032e4:	48 89 e5             	mov    %rsp,%rbp
+  8032e7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032eb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032ef:	48 b8 84 1c 80 00 00 	movabs $0x801c84,%rax
+  8032f6:	00 00 00 
+  8032f9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032fb:	85 c0                	test   %eax,%eax
+  8032fd:	78 35                	js     803334 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8032ff:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803303:	48 b8 08 1c 80 00 00 	movabs $0x801c08,%rax
+  80330a:	00 00 00 
+  80330d:	ff d0                	call   *%rax
+  80330f:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803312:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803317:	be 00 10 00 00       	mov    $0x1000,%esi
+  80331c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803320:	48 b8 28 16 80 00 00 	movabs $0x801628,%rax
+  803327:	00 00 00 
+  80332a:	ff d0                	call   *%rax
+  80332c:	85 c0                	test   %eax,%eax
+  80332e:	0f 94 c0             	sete   %al
+  803331:	0f b6 c0             	movzbl %al,%eax
+}
+  803334:	c9                   	leave
+  803335:	c3                   	ret
+
+0000000000803336 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803336:	55                   	push   %rbp
+  803337:	48 89 e5             	mov    %rsp,%rbp
+  80333a:	41 55                	push   %r13
+  80333c:	41 54                	push   %r12
+  80333e:	53                   	push   %rbx
+  80333f:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  803343:	85 ff                	test   %edi,%edi
+  803345:	74 6c                	je     8033b3 <wait+0x7d>
+  803347:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  80334a:	40 0f b6 c7          	movzbl %dil,%eax
+
+    while (env->env_id == envid &&
+  80334e:	40 0f b6 cf          	movzbl %dil,%ecx
+  803352:	48 69 c9 b0 06 00 00 	imul   $0x6b0,%rcx,%rcx
+  803359:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803360:	00 00 00 
+  803363:	48 01 ca             	add    %rcx,%rdx
+  803366:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80336c:	39 d7                	cmp    %edx,%edi
+  80336e:	75 38                	jne    8033a8 <wait+0x72>
+           env->env_status != ENV_FREE) {
+  803370:	48 98                	cltq
+  803372:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  803379:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803380:	00 00 00 
+  803383:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  803386:	49 bd c5 15 80 00 00 	movabs $0x8015c5,%r13
+  80338d:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803390:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803396:	85 c0                	test   %eax,%eax
+  803398:	74 0e                	je     8033a8 <wait+0x72>
+        sys_yield();
+  80339a:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  80339d:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8033a3:	44 39 e0             	cmp    %r12d,%eax
+  8033a6:	74 e8                	je     803390 <wait+0x5a>
+    }
+}
+  8033a8:	48 83 c4 08          	add    $0x8,%rsp
+  8033ac:	5b                   	pop    %rbx
+  8033ad:	41 5c                	pop    %r12
+  8033af:	41 5d                	pop    %r13
+  8033b1:	5d                   	pop    %rbp
+  8033b2:	c3                   	ret
+    assert(envid != 0);
+  8033b3:	48 b9 d4 3f 80 00 00 	movabs $0x803fd4,%rcx
+  8033ba:	00 00 00 
+  8033bd:	48 ba 1a 3f 80 00 00 	movabs $0x803f1a,%rdx
+  8033c4:	00 00 00 
+  8033c7:	be 06 00 00 00       	mov    $0x6,%esi
+  8033cc:	48 bf df 3f 80 00 00 	movabs $0x803fdf,%rdi
+  8033d3:	00 00 00 
+  8033d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033db:	49 b8 2f 06 80 00 00 	movabs $0x80062f,%r8
+  8033e2:	00 00 00 
+  8033e5:	41 ff d0             	call   *%r8
+
+00000000008033e8 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8033e8:	48 89 f8             	mov    %rdi,%rax
+  8033eb:	48 c1 e8 27          	shr    $0x27,%rax
+  8033ef:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8033f6:	01 00 00 
+  8033f9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8033fd:	f6 c2 01             	test   $0x1,%dl
+  803400:	74 6d                	je     80346f <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803402:	48 89 f8             	mov    %rdi,%rax
+  803405:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803409:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803410:	01 00 00 
+  803413:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803417:	f6 c2 01             	test   $0x1,%dl
+  80341a:	74 62                	je     80347e <get_uvpt_entry+0x96>
+  80341c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803423:	01 00 00 
+  803426:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80342a:	f6 c2 80             	test   $0x80,%dl
+  80342d:	75 4f                	jne    80347e <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80342f:	48 89 f8             	mov    %rdi,%rax
+  803432:	48 c1 e8 15          	shr    $0x15,%rax
+  803436:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80343d:	01 00 00 
+  803440:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803444:	f6 c2 01             	test   $0x1,%dl
+  803447:	74 44                	je     80348d <get_uvpt_entry+0xa5>
+  803449:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803450:	01 00 00 
+  803453:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803457:	f6 c2 80             	test   $0x80,%dl
+  80345a:	75 31                	jne    80348d <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80345c:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803460:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803467:	01 00 00 
+  80346a:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80346e:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80346f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803476:	01 00 00 
+  803479:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80347d:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80347e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803485:	01 00 00 
+  803488:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80348c:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80348d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803494:	01 00 00 
+  803497:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80349b:	c3                   	ret
+
+000000000080349c <get_prot>:
+
+int
+get_prot(void *va) {
+  80349c:	55                   	push   %rbp
+  80349d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034a0:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  8034a7:	00 00 00 
+  8034aa:	ff d0                	call   *%rax
+  8034ac:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8034af:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8034b4:	89 c1                	mov    %eax,%ecx
+  8034b6:	83 c9 04             	or     $0x4,%ecx
+  8034b9:	f6 c2 01             	test   $0x1,%dl
+  8034bc:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8034bf:	89 c1                	mov    %eax,%ecx
+  8034c1:	83 c9 02             	or     $0x2,%ecx
+  8034c4:	f6 c2 02             	test   $0x2,%dl
+  8034c7:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8034ca:	89 c1                	mov    %eax,%ecx
+  8034cc:	83 c9 01             	or     $0x1,%ecx
+  8034cf:	48 85 d2             	test   %rdx,%rdx
+  8034d2:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8034d5:	89 c1                	mov    %eax,%ecx
+  8034d7:	83 c9 40             	or     $0x40,%ecx
+  8034da:	f6 c6 04             	test   $0x4,%dh
+  8034dd:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8034e0:	5d                   	pop    %rbp
+  8034e1:	c3                   	ret
+
+00000000008034e2 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8034e2:	55                   	push   %rbp
+  8034e3:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8034e6:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  8034ed:	00 00 00 
+  8034f0:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8034f2:	48 c1 e8 06          	shr    $0x6,%rax
+  8034f6:	83 e0 01             	and    $0x1,%eax
+}
+  8034f9:	5d                   	pop    %rbp
+  8034fa:	c3                   	ret
+
+00000000008034fb <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8034fb:	55                   	push   %rbp
+  8034fc:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8034ff:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  803506:	00 00 00 
+  803509:	ff d0                	call   *%rax
+  80350b:	83 e0 01             	and    $0x1,%eax
+}
+  80350e:	5d                   	pop    %rbp
+  80350f:	c3                   	ret
+
+0000000000803510 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803510:	55                   	push   %rbp
+  803511:	48 89 e5             	mov    %rsp,%rbp
+  803514:	41 57                	push   %r15
+  803516:	41 56                	push   %r14
+  803518:	41 55                	push   %r13
+  80351a:	41 54                	push   %r12
+  80351c:	53                   	push   %rbx
+  80351d:	48 83 ec 18          	sub    $0x18,%rsp
+  803521:	49 89 ff             	mov    %rdi,%r15
+  803524:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  803528:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  80352d:	49 bc fb 34 80 00 00 	movabs $0x8034fb,%r12
+  803534:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  803537:	49 be 9c 34 80 00 00 	movabs $0x80349c,%r14
+  80353e:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  803541:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  803548:	00 00 00 
+  80354b:	eb 0c                	jmp    803559 <foreach_shared_region+0x49>
+  80354d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803554:	4c 39 eb             	cmp    %r13,%rbx
+  803557:	74 38                	je     803591 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  803559:	48 89 df             	mov    %rbx,%rdi
+  80355c:	41 ff d4             	call   *%r12
+  80355f:	84 c0                	test   %al,%al
+  803561:	74 ea                	je     80354d <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  803563:	48 89 df             	mov    %rbx,%rdi
+  803566:	41 ff d6             	call   *%r14
+  803569:	a8 40                	test   $0x40,%al
+  80356b:	74 e0                	je     80354d <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  80356d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803574:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803578:	48 89 df             	mov    %rbx,%rdi
+  80357b:	41 ff d7             	call   *%r15
+        if (err)
+  80357e:	85 c0                	test   %eax,%eax
+  803580:	74 cb                	je     80354d <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  803582:	48 83 c4 18          	add    $0x18,%rsp
+  803586:	5b                   	pop    %rbx
+  803587:	41 5c                	pop    %r12
+  803589:	41 5d                	pop    %r13
+  80358b:	41 5e                	pop    %r14
+  80358d:	41 5f                	pop    %r15
+  80358f:	5d                   	pop    %rbp
+  803590:	c3                   	ret
+    return 0;
+  803591:	b8 00 00 00 00       	mov    $0x0,%eax
+  803596:	eb ea                	jmp    803582 <foreach_shared_region+0x72>
+
+0000000000803598 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803598:	55                   	push   %rbp
+  803599:	48 89 e5             	mov    %rsp,%rbp
+  80359c:	41 54                	push   %r12
+  80359e:	53                   	push   %rbx
+  80359f:	48 89 fb             	mov    %rdi,%rbx
+  8035a2:	48 89 f7             	mov    %rsi,%rdi
+  8035a5:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8035a8:	48 85 f6             	test   %rsi,%rsi
+  8035ab:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8035b2:	00 00 00 
+  8035b5:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8035b9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8035be:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  8035c5:	00 00 00 
+  8035c8:	ff d0                	call   *%rax
+    if (res < 0) {
+  8035ca:	85 c0                	test   %eax,%eax
+  8035cc:	78 45                	js     803613 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8035ce:	48 85 db             	test   %rbx,%rbx
+  8035d1:	74 12                	je     8035e5 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8035d3:	48 a1 70 87 80 00 00 	movabs 0x808770,%rax
+  8035da:	00 00 00 
+  8035dd:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8035e3:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  8035e5:	4d 85 e4             	test   %r12,%r12
+  8035e8:	74 14                	je     8035fe <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  8035ea:	48 a1 70 87 80 00 00 	movabs 0x808770,%rax
+  8035f1:	00 00 00 
+  8035f4:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8035fa:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  8035fe:	48 a1 70 87 80 00 00 	movabs 0x808770,%rax
+  803605:	00 00 00 
+  803608:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  80360e:	5b                   	pop    %rbx
+  80360f:	41 5c                	pop    %r12
+  803611:	5d                   	pop    %rbp
+  803612:	c3                   	ret
+        if (from_env_store)
+  803613:	48 85 db             	test   %rbx,%rbx
+  803616:	74 06                	je     80361e <ipc_recv+0x86>
+            *from_env_store = 0;
+  803618:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  80361e:	4d 85 e4             	test   %r12,%r12
+  803621:	74 eb                	je     80360e <ipc_recv+0x76>
+            *perm_store = 0;
+  803623:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80362a:	00 
+  80362b:	eb e1                	jmp    80360e <ipc_recv+0x76>
+
+000000000080362d <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80362d:	55                   	push   %rbp
+  80362e:	48 89 e5             	mov    %rsp,%rbp
+  803631:	41 57                	push   %r15
+  803633:	41 56                	push   %r14
+  803635:	41 55                	push   %r13
+  803637:	41 54                	push   %r12
+  803639:	53                   	push   %rbx
+  80363a:	48 83 ec 18          	sub    $0x18,%rsp
+  80363e:	41 89 fd             	mov    %edi,%r13d
+  803641:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803644:	48 89 d3             	mov    %rdx,%rbx
+  803647:	49 89 cc             	mov    %rcx,%r12
+  80364a:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  80364e:	48 85 d2             	test   %rdx,%rdx
+  803651:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803658:	00 00 00 
+  80365b:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80365f:	49 be 92 19 80 00 00 	movabs $0x801992,%r14
+  803666:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  803669:	49 bf c5 15 80 00 00 	movabs $0x8015c5,%r15
+  803670:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803673:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803676:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  80367a:	4c 89 e1             	mov    %r12,%rcx
+  80367d:	48 89 da             	mov    %rbx,%rdx
+  803680:	44 89 ef             	mov    %r13d,%edi
+  803683:	41 ff d6             	call   *%r14
+        if (res == 0)
+  803686:	85 c0                	test   %eax,%eax
+  803688:	74 34                	je     8036be <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  80368a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80368d:	75 05                	jne    803694 <ipc_send+0x67>
+        sys_yield();
+  80368f:	41 ff d7             	call   *%r15
+    while (true) {
+  803692:	eb df                	jmp    803673 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  803694:	48 ba ea 3f 80 00 00 	movabs $0x803fea,%rdx
+  80369b:	00 00 00 
+  80369e:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8036a3:	48 bf 03 40 80 00 00 	movabs $0x804003,%rdi
+  8036aa:	00 00 00 
+  8036ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036b2:	48 b9 2f 06 80 00 00 	movabs $0x80062f,%rcx
+  8036b9:	00 00 00 
+  8036bc:	ff d1                	call   *%rcx
+    }
+}
+  8036be:	48 83 c4 18          	add    $0x18,%rsp
+  8036c2:	5b                   	pop    %rbx
+  8036c3:	41 5c                	pop    %r12
+  8036c5:	41 5d                	pop    %r13
+  8036c7:	41 5e                	pop    %r14
+  8036c9:	41 5f                	pop    %r15
+  8036cb:	5d                   	pop    %rbp
+  8036cc:	c3                   	ret
+
+00000000008036cd <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8036cd:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8036d2:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8036d9:	00 00 00 
+  8036dc:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  8036e3:	48 01 ca             	add    %rcx,%rdx
+  8036e6:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8036ec:	39 fa                	cmp    %edi,%edx
+  8036ee:	74 12                	je     803702 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8036f0:	48 83 c0 01          	add    $0x1,%rax
+  8036f4:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8036fa:	75 e0                	jne    8036dc <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8036fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803701:	c3                   	ret
+            return envs[i].env_id;
+  803702:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  803709:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803710:	00 00 00 
+  803713:	48 01 d0             	add    %rdx,%rax
+  803716:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80371c:	c3                   	ret
+  80371d:	0f 1f 00             	nopl   (%rax)
+
+0000000000803720 <__rodata_start>:
+  803720:	69 6e 69 74 3a 20 72 	imul   $0x72203a74,0x69(%rsi),%ebp
+  803727:	75 6e                	jne    803797 <__rodata_start+0x77>
+  803729:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80372a:	69 6e 67 0a 00 69 6e 	imul   $0x6e69000a,0x67(%rsi),%ebp
+  803731:	69 74 3a 20 64 61 74 	imul   $0x61746164,0x20(%rdx,%rdi,1),%esi
+  803738:	61 
+  803739:	20 73 65             	and    %dh,0x65(%rbx)
+  80373c:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80373e:	73 20                	jae    803760 <__rodata_start+0x40>
+  803740:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803741:	6b 61 79 0a          	imul   $0xa,0x79(%rcx),%esp
+  803745:	00 69 6e             	add    %ch,0x6e(%rcx)
+  803748:	69 74 3a 20 62 73 73 	imul   $0x20737362,0x20(%rdx,%rdi,1),%esi
+  80374f:	20 
+  803750:	73 65                	jae    8037b7 <__rodata_start+0x97>
+  803752:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803754:	73 20                	jae    803776 <__rodata_start+0x56>
+  803756:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803757:	6b 61 79 0a          	imul   $0xa,0x79(%rcx),%esp
+  80375b:	00 69 6e             	add    %ch,0x6e(%rcx)
+  80375e:	69 74 3a 20 61 72 67 	imul   $0x73677261,0x20(%rdx,%rdi,1),%esi
+  803765:	73 
+  803766:	3a 00                	cmp    (%rax),%al
+  803768:	20 27                	and    %ah,(%rdi)
+  80376a:	00 25 73 0a 00 69    	add    %ah,0x69000a73(%rip)        # 698041e3 <__bss_end+0x68ff91e3>
+  803770:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803771:	69 74 3a 20 72 75 6e 	imul   $0x6e6e7572,0x20(%rdx,%rdi,1),%esi
+  803778:	6e 
+  803779:	69 6e 67 20 73 68 0a 	imul   $0xa687320,0x67(%rsi),%ebp
+  803780:	00 6f 70             	add    %ch,0x70(%rdi)
+  803783:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803785:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  803788:	73 3a                	jae    8037c4 <__rodata_start+0xa4>
+  80378a:	20 25 69 00 75 73    	and    %ah,0x73750069(%rip)        # 73f537f9 <__bss_end+0x737487f9>
+  803790:	65 72 2f             	gs jb  8037c2 <__rodata_start+0xa2>
+  803793:	69 6e 69 74 2e 63 00 	imul   $0x632e74,0x69(%rsi),%ebp
+  80379a:	66 69 72 73 74 20    	imul   $0x2074,0x73(%rdx),%si
+  8037a0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037a1:	70 65                	jo     803808 <__rodata_start+0xe8>
+  8037a3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037a4:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  8037a7:	73 20                	jae    8037c9 <__rodata_start+0xa9>
+  8037a9:	75 73                	jne    80381e <__rodata_start+0xfe>
+  8037ab:	65 64 20 66 64       	gs and %ah,%fs:0x64(%rsi)
+  8037b0:	20 25 64 00 64 75    	and    %ah,0x75640064(%rip)        # 75e4381a <__bss_end+0x7563881a>
+  8037b6:	70 3a                	jo     8037f2 <__rodata_start+0xd2>
+  8037b8:	20 25 69 00 69 6e    	and    %ah,0x6e690069(%rip)        # 6ee93827 <__bss_end+0x6e688827>
+  8037be:	69 74 3a 20 73 74 61 	imul   $0x72617473,0x20(%rdx,%rdi,1),%esi
+  8037c5:	72 
+  8037c6:	74 69                	je     803831 <__rodata_start+0x111>
+  8037c8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037c9:	67 20 73 68          	and    %dh,0x68(%ebx)
+  8037cd:	0a 00                	or     (%rax),%al
+  8037cf:	2f                   	(bad)
+  8037d0:	73 68                	jae    80383a <__rodata_start+0x11a>
+  8037d2:	00 69 6e             	add    %ch,0x6e(%rcx)
+  8037d5:	69 74 3a 20 73 70 61 	imul   $0x77617073,0x20(%rdx,%rdi,1),%esi
+  8037dc:	77 
+  8037dd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037de:	20 73 68             	and    %dh,0x68(%rbx)
+  8037e1:	3a 20                	cmp    (%rax),%ah
+  8037e3:	25 69 0a 00 90       	and    $0x90000a69,%eax
+  8037e8:	69 6e 69 74 3a 20 64 	imul   $0x64203a74,0x69(%rsi),%ebp
+  8037ef:	61                   	(bad)
+  8037f0:	74 61                	je     803853 <__rodata_start+0x133>
+  8037f2:	20 69 73             	and    %ch,0x73(%rcx)
+  8037f5:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8037f8:	74 20                	je     80381a <__rodata_start+0xfa>
+  8037fa:	69 6e 69 74 69 61 6c 	imul   $0x6c616974,0x69(%rsi),%ebp
+  803801:	69 7a 65 64 3a 20 67 	imul   $0x67203a64,0x65(%rdx),%edi
+  803808:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803809:	74 20                	je     80382b <__rodata_start+0x10b>
+  80380b:	73 75                	jae    803882 <__rodata_start+0x162>
+  80380d:	6d                   	insl   (%dx),%es:(%rdi)
+  80380e:	20 25 30 38 78 20    	and    %ah,0x20783830(%rip)        # 20f87044 <__bss_end+0x2077c044>
+  803814:	77 61                	ja     803877 <__rodata_start+0x157>
+  803816:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803817:	74 65                	je     80387e <__rodata_start+0x15e>
+  803819:	64 20 25 30 38 78 0a 	and    %ah,%fs:0xa783830(%rip)        # af87050 <__bss_end+0xa77c050>
+	...
+  803828:	62 73                	(bad)
+  80382a:	73 20                	jae    80384c <__rodata_start+0x12c>
+  80382c:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803833:	69 6e 69 74 69 61 6c 	imul   $0x6c616974,0x69(%rsi),%ebp
+  80383a:	69 7a 65 64 3a 20 77 	imul   $0x77203a64,0x65(%rdx),%edi
+  803841:	61                   	(bad)
+  803842:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803843:	74 65                	je     8038aa <__rodata_start+0x18a>
+  803845:	64 20 73 75          	and    %dh,%fs:0x75(%rbx)
+  803849:	6d                   	insl   (%dx),%es:(%rdi)
+  80384a:	20 30                	and    %dh,(%rax)
+  80384c:	20 67 6f             	and    %ah,0x6f(%rdi)
+  80384f:	74 20                	je     803871 <__rodata_start+0x151>
+  803851:	25 30 38 78 0a       	and    $0xa783830,%eax
+  803856:	00 3c 63             	add    %bh,(%rbx,%riz,2)
+  803859:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80385a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80385b:	73 3e                	jae    80389b <__rodata_start+0x17b>
+  80385d:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803860:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803861:	73 00                	jae    803863 <__rodata_start+0x143>
+  803863:	3c 75                	cmp    $0x75,%al
+  803865:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803866:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80386a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80386b:	3e 00 0f             	ds add %cl,(%rdi)
+  80386e:	1f                   	(bad)
+  80386f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803872:	30 38                	xor    %bh,(%rax)
+  803874:	78 5d                	js     8038d3 <__rodata_start+0x1b3>
+  803876:	20 75 73             	and    %dh,0x73(%rbp)
+  803879:	65 72 20             	gs jb  80389c <__rodata_start+0x17c>
+  80387c:	70 61                	jo     8038df <__rodata_start+0x1bf>
+  80387e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80387f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803886:	73 20                	jae    8038a8 <__rodata_start+0x188>
+  803888:	61                   	(bad)
+  803889:	74 20                	je     8038ab <__rodata_start+0x18b>
+  80388b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803890:	3a 20                	cmp    (%rax),%ah
+  803892:	00 30                	add    %dh,(%rax)
+  803894:	31 32                	xor    %esi,(%rdx)
+  803896:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80389d:	41                   	rex.B
+  80389e:	42                   	rex.X
+  80389f:	43                   	rex.XB
+  8038a0:	44                   	rex.R
+  8038a1:	45                   	rex.RB
+  8038a2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8038a5:	31 32                	xor    %esi,(%rdx)
+  8038a7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8038ae:	61                   	(bad)
+  8038af:	62 63 64 65 66       	(bad)
+  8038b4:	00 28                	add    %ch,(%rax)
+  8038b6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038b7:	75 6c                	jne    803925 <__rodata_start+0x205>
+  8038b9:	6c                   	insb   (%dx),%es:(%rdi)
+  8038ba:	29 00                	sub    %eax,(%rax)
+  8038bc:	65 72 72             	gs jb  803931 <__rodata_start+0x211>
+  8038bf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038c0:	72 20                	jb     8038e2 <__rodata_start+0x1c2>
+  8038c2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8038c7:	73 70                	jae    803939 <__rodata_start+0x219>
+  8038c9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8038cd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8038d4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038d5:	72 00                	jb     8038d7 <__rodata_start+0x1b7>
+  8038d7:	62 61 64 20 65       	(bad)
+  8038dc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038dd:	76 69                	jbe    803948 <__rodata_start+0x228>
+  8038df:	72 6f                	jb     803950 <__rodata_start+0x230>
+  8038e1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038e2:	6d                   	insl   (%dx),%es:(%rdi)
+  8038e3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8038e5:	74 00                	je     8038e7 <__rodata_start+0x1c7>
+  8038e7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8038ee:	20 70 61             	and    %dh,0x61(%rax)
+  8038f1:	72 61                	jb     803954 <__rodata_start+0x234>
+  8038f3:	6d                   	insl   (%dx),%es:(%rdi)
+  8038f4:	65 74 65             	gs je  80395c <__rodata_start+0x23c>
+  8038f7:	72 00                	jb     8038f9 <__rodata_start+0x1d9>
+  8038f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038fa:	75 74                	jne    803970 <__rodata_start+0x250>
+  8038fc:	20 6f 66             	and    %ch,0x66(%rdi)
+  8038ff:	20 6d 65             	and    %ch,0x65(%rbp)
+  803902:	6d                   	insl   (%dx),%es:(%rdi)
+  803903:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803904:	72 79                	jb     80397f <__rodata_start+0x25f>
+  803906:	00 6f 75             	add    %ch,0x75(%rdi)
+  803909:	74 20                	je     80392b <__rodata_start+0x20b>
+  80390b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80390c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803910:	76 69                	jbe    80397b <__rodata_start+0x25b>
+  803912:	72 6f                	jb     803983 <__rodata_start+0x263>
+  803914:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803915:	6d                   	insl   (%dx),%es:(%rdi)
+  803916:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803918:	74 73                	je     80398d <__rodata_start+0x26d>
+  80391a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80391d:	72 72                	jb     803991 <__rodata_start+0x271>
+  80391f:	75 70                	jne    803991 <__rodata_start+0x271>
+  803921:	74 65                	je     803988 <__rodata_start+0x268>
+  803923:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803928:	75 67                	jne    803991 <__rodata_start+0x271>
+  80392a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80392d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80392f:	00 73 65             	add    %dh,0x65(%rbx)
+  803932:	67 6d                	insl   (%dx),%es:(%edi)
+  803934:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803936:	74 61                	je     803999 <__rodata_start+0x279>
+  803938:	74 69                	je     8039a3 <__rodata_start+0x283>
+  80393a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80393b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80393c:	20 66 61             	and    %ah,0x61(%rsi)
+  80393f:	75 6c                	jne    8039ad <__rodata_start+0x28d>
+  803941:	74 00                	je     803943 <__rodata_start+0x223>
+  803943:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80394a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80394d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803951:	61                   	(bad)
+  803952:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803957:	20 73 75             	and    %dh,0x75(%rbx)
+  80395a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80395d:	73 79                	jae    8039d8 <__rodata_start+0x2b8>
+  80395f:	73 74                	jae    8039d5 <__rodata_start+0x2b5>
+  803961:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803963:	20 63 61             	and    %ah,0x61(%rbx)
+  803966:	6c                   	insb   (%dx),%es:(%rdi)
+  803967:	6c                   	insb   (%dx),%es:(%rdi)
+  803968:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80396b:	74 72                	je     8039df <__rodata_start+0x2bf>
+  80396d:	79 20                	jns    80398f <__rodata_start+0x26f>
+  80396f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803970:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803971:	74 20                	je     803993 <__rodata_start+0x273>
+  803973:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803975:	75 6e                	jne    8039e5 <__rodata_start+0x2c5>
+  803977:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80397b:	76 20                	jbe    80399d <__rodata_start+0x27d>
+  80397d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803984:	72 65                	jb     8039eb <__rodata_start+0x2cb>
+  803986:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803989:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80398a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80398e:	65 78 70             	gs js  803a01 <__rodata_start+0x2e1>
+  803991:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803996:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803999:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80399d:	20 66 69             	and    %ah,0x69(%rsi)
+  8039a0:	6c                   	insb   (%dx),%es:(%rdi)
+  8039a1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8039a5:	20 66 72             	and    %ah,0x72(%rsi)
+  8039a8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8039ad:	61                   	(bad)
+  8039ae:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8039b1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039b2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039b3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8039b7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8039ba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039bc:	20 6d 61             	and    %ch,0x61(%rbp)
+  8039bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039c0:	79 20                	jns    8039e2 <__rodata_start+0x2c2>
+  8039c2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8039c9:	72 65                	jb     803a30 <__rodata_start+0x310>
+  8039cb:	20 6f 70             	and    %ch,0x70(%rdi)
+  8039ce:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039d0:	00 66 69             	add    %ah,0x69(%rsi)
+  8039d3:	6c                   	insb   (%dx),%es:(%rdi)
+  8039d4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8039d8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8039db:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039dc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8039df:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039e0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039e1:	74 20                	je     803a03 <__rodata_start+0x2e3>
+  8039e3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8039e5:	75 6e                	jne    803a55 <__rodata_start+0x335>
+  8039e7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8039eb:	76 61                	jbe    803a4e <__rodata_start+0x32e>
+  8039ed:	6c                   	insb   (%dx),%es:(%rdi)
+  8039ee:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8039f5:	00 
+  8039f6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8039fd:	72 65                	jb     803a64 <__rodata_start+0x344>
+  8039ff:	61                   	(bad)
+  803a00:	64 79 20             	fs jns 803a23 <__rodata_start+0x303>
+  803a03:	65 78 69             	gs js  803a6f <__rodata_start+0x34f>
+  803a06:	73 74                	jae    803a7c <__rodata_start+0x35c>
+  803a08:	73 00                	jae    803a0a <__rodata_start+0x2ea>
+  803a0a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a0b:	70 65                	jo     803a72 <__rodata_start+0x352>
+  803a0d:	72 61                	jb     803a70 <__rodata_start+0x350>
+  803a0f:	74 69                	je     803a7a <__rodata_start+0x35a>
+  803a11:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a12:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a13:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803a16:	74 20                	je     803a38 <__rodata_start+0x318>
+  803a18:	73 75                	jae    803a8f <__rodata_start+0x36f>
+  803a1a:	70 70                	jo     803a8c <__rodata_start+0x36c>
+  803a1c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a1d:	72 74                	jb     803a93 <__rodata_start+0x373>
+  803a1f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803a24:	65 72 61             	gs jb  803a88 <__rodata_start+0x368>
+  803a27:	74 69                	je     803a92 <__rodata_start+0x372>
+  803a29:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a2a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a2b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803a2e:	74 20                	je     803a50 <__rodata_start+0x330>
+  803a30:	70 65                	jo     803a97 <__rodata_start+0x377>
+  803a32:	72 6d                	jb     803aa1 <__rodata_start+0x381>
+  803a34:	69 74 74 65 64 00 66 	imul   $0xf660064,0x65(%rsp,%rsi,2),%esi
+  803a3b:	0f 
+  803a3c:	1f                   	(bad)
+  803a3d:	44 00 00             	add    %r8b,(%rax)
+  803a40:	6c                   	insb   (%dx),%es:(%rdi)
+  803a41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a47:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803a4d:	00 00                	add    %al,(%rax)
+  803a4f:	00 9d 0f 80 00 00    	add    %bl,0x800f(%rbp)
+  803a55:	00 00                	add    %al,(%rax)
+  803a57:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803a5d:	00 00                	add    %al,(%rax)
+  803a5f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803a65:	00 00                	add    %al,(%rax)
+  803a67:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803a6d:	00 00                	add    %al,(%rax)
+  803a6f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803a75:	00 00                	add    %al,(%rax)
+  803a77:	00 8b 09 80 00 00    	add    %cl,0x8009(%rbx)
+  803a7d:	00 00                	add    %al,(%rax)
+  803a7f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 7f 09             	add    %bh,0x9(%rdi)
+  803a92:	80 00 00             	addb   $0x0,(%rax)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 f9                	add    %bh,%cl
+  803a99:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803a9f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803aa5:	00 00                	add    %al,(%rax)
+  803aa7:	00 7f 09             	add    %bh,0x9(%rdi)
+  803aaa:	80 00 00             	addb   $0x0,(%rax)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 c5                	add    %al,%ch
+  803ab1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803ab7:	00 c5                	add    %al,%ch
+  803ab9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803abf:	00 c5                	add    %al,%ch
+  803ac1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803ac7:	00 c5                	add    %al,%ch
+  803ac9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803acf:	00 c5                	add    %al,%ch
+  803ad1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803ad7:	00 c5                	add    %al,%ch
+  803ad9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803adf:	00 c5                	add    %al,%ch
+  803ae1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803ae7:	00 c5                	add    %al,%ch
+  803ae9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803aef:	00 c5                	add    %al,%ch
+  803af1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803af7:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803afd:	00 00                	add    %al,(%rax)
+  803aff:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b05:	00 00                	add    %al,(%rax)
+  803b07:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b1d:	00 00                	add    %al,(%rax)
+  803b1f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b25:	00 00                	add    %al,(%rax)
+  803b27:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b2d:	00 00                	add    %al,(%rax)
+  803b2f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b35:	00 00                	add    %al,(%rax)
+  803b37:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b3d:	00 00                	add    %al,(%rax)
+  803b3f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b45:	00 00                	add    %al,(%rax)
+  803b47:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b4d:	00 00                	add    %al,(%rax)
+  803b4f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b55:	00 00                	add    %al,(%rax)
+  803b57:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b5d:	00 00                	add    %al,(%rax)
+  803b5f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b65:	00 00                	add    %al,(%rax)
+  803b67:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b6d:	00 00                	add    %al,(%rax)
+  803b6f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b75:	00 00                	add    %al,(%rax)
+  803b77:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b7d:	00 00                	add    %al,(%rax)
+  803b7f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b85:	00 00                	add    %al,(%rax)
+  803b87:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b8d:	00 00                	add    %al,(%rax)
+  803b8f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b95:	00 00                	add    %al,(%rax)
+  803b97:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803b9d:	00 00                	add    %al,(%rax)
+  803b9f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803ba5:	00 00                	add    %al,(%rax)
+  803ba7:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803bad:	00 00                	add    %al,(%rax)
+  803baf:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803bb5:	00 00                	add    %al,(%rax)
+  803bb7:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803bbd:	00 00                	add    %al,(%rax)
+  803bbf:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803bcd:	00 00                	add    %al,(%rax)
+  803bcf:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803bd5:	00 00                	add    %al,(%rax)
+  803bd7:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803bdd:	00 00                	add    %al,(%rax)
+  803bdf:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803be5:	00 00                	add    %al,(%rax)
+  803be7:	00 d0                	add    %dl,%al
+  803be9:	0e                   	(bad)
+  803bea:	80 00 00             	addb   $0x0,(%rax)
+  803bed:	00 00                	add    %al,(%rax)
+  803bef:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803bf5:	00 00                	add    %al,(%rax)
+  803bf7:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803bfd:	00 00                	add    %al,(%rax)
+  803bff:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803c05:	00 00                	add    %al,(%rax)
+  803c07:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803c0d:	00 00                	add    %al,(%rax)
+  803c0f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803c15:	00 00                	add    %al,(%rax)
+  803c17:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803c1d:	00 00                	add    %al,(%rax)
+  803c1f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803c25:	00 00                	add    %al,(%rax)
+  803c27:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803c2d:	00 00                	add    %al,(%rax)
+  803c2f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803c35:	00 00                	add    %al,(%rax)
+  803c37:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803c3d:	00 00                	add    %al,(%rax)
+  803c3f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803c42:	80 00 00             	addb   $0x0,(%rax)
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 eb                	add    %ch,%bl
+  803c49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803c4f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803c5d:	00 00                	add    %al,(%rax)
+  803c5f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803c65:	00 00                	add    %al,(%rax)
+  803c67:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803c6d:	00 00                	add    %al,(%rax)
+  803c6f:	00 4b 0a             	add    %cl,0xa(%rbx)
+  803c72:	80 00 00             	addb   $0x0,(%rax)
+  803c75:	00 00                	add    %al,(%rax)
+  803c77:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803c7d:	00 00                	add    %al,(%rax)
+  803c7f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803c85:	00 00                	add    %al,(%rax)
+  803c87:	00 11                	add    %dl,(%rcx)
+  803c89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803c8f:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803c95:	00 00                	add    %al,(%rax)
+  803c97:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803c9d:	00 00                	add    %al,(%rax)
+  803c9f:	00 93 0d 80 00 00    	add    %dl,0x800d(%rbx)
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 5d 0e             	add    %bl,0xe(%rbp)
+  803caa:	80 00 00             	addb   $0x0,(%rax)
+  803cad:	00 00                	add    %al,(%rax)
+  803caf:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803cb5:	00 00                	add    %al,(%rax)
+  803cb7:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803cbd:	00 00                	add    %al,(%rax)
+  803cbf:	00 e2                	add    %ah,%dl
+  803cc1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803cc7:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803ccd:	00 00                	add    %al,(%rax)
+  803ccf:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 d0                	add    %dl,%al
+  803ce9:	0e                   	(bad)
+  803cea:	80 00 00             	addb   $0x0,(%rax)
+  803ced:	00 00                	add    %al,(%rax)
+  803cef:	00 ad 0f 80 00 00    	add    %ch,0x800f(%rbp)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 75 09             	add    %dh,0x9(%rbp)
+  803cfa:	80 00 00             	addb   $0x0,(%rax)
+  803cfd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803d00 <error_string>:
+	...
+  803d08:	c5 38 80 00 00 00 00 00 d7 38 80 00 00 00 00 00     .8.......8......
+  803d18:	e7 38 80 00 00 00 00 00 f9 38 80 00 00 00 00 00     .8.......8......
+  803d28:	07 39 80 00 00 00 00 00 1b 39 80 00 00 00 00 00     .9.......9......
+  803d38:	30 39 80 00 00 00 00 00 43 39 80 00 00 00 00 00     09......C9......
+  803d48:	55 39 80 00 00 00 00 00 69 39 80 00 00 00 00 00     U9......i9......
+  803d58:	79 39 80 00 00 00 00 00 8c 39 80 00 00 00 00 00     y9.......9......
+  803d68:	a3 39 80 00 00 00 00 00 b9 39 80 00 00 00 00 00     .9.......9......
+  803d78:	d1 39 80 00 00 00 00 00 e9 39 80 00 00 00 00 00     .9.......9......
+  803d88:	f6 39 80 00 00 00 00 00 b0 3d 80 00 00 00 00 00     .9.......=......
+  803d98:	0a 3a 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .:..............
+  803da8:	22 3a 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ":......file is 
+  803db8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803dc8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803dd8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803de8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803df8:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803e08:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803e18:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803e28:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803e38:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803e48:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803e58:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803e68:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803e78:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803e80 <devtab>:
+  803e80:	c0 67 80 00 00 00 00 00 00 68 80 00 00 00 00 00     .g.......h......
+  803e90:	80 67 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .g..............
+  803ea0:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  803eb0:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  803ec0:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  803ed0:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  803ee0:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  803ef0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  803f00:	45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20 77     Elf magic %08x w
+  803f10:	61 6e 74 20 25 30 38 78 0a 00 61 73 73 65 72 74     ant %08x..assert
+  803f20:	69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00 6c     ion failed: %s.l
+  803f30:	69 62 2f 73 70 61 77 6e 2e 63 00 62 79 74 65 73     ib/spawn.c.bytes
+  803f40:	5f 72 65 61 64 20 3d 3d 20 66 69 6c 65 73 7a 00     _read == filesz.
+  803f50:	63 6f 70 79 5f 73 68 61 72 65 64 5f 72 65 67 69     copy_shared_regi
+  803f60:	6f 6e 3a 20 25 69 00 73 79 73 5f 65 6e 76 5f 73     on: %i.sys_env_s
+  803f70:	65 74 5f 74 72 61 70 66 72 61 6d 65 3a 20 25 69     et_trapframe: %i
+  803f80:	00 73 79 73 5f 65 6e 76 5f 73 65 74 5f 73 74 61     .sys_env_set_sta
+  803f90:	74 75 73 3a 20 25 69 00 3c 70 69 70 65 3e 00 6c     tus: %i.<pipe>.l
+  803fa0:	69 62 2f 70 69 70 65 2e 63 00 70 69 70 65 00 90     ib/pipe.c.pipe..
+  803fb0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803fc0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803fd0:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  803fe0:	69 62 2f 77 61 69 74 2e 63 00 69 70 63 5f 73 65     ib/wait.c.ipc_se
+  803ff0:	6e 64 3a 20 66 61 69 6c 65 64 20 74 6f 20 73 65     nd: failed to se
+  804000:	6e 64 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     nd.lib/ipc.c.f..
+  804010:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804020:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804030:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804040:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804050:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804060:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804070:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804080:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804090:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8040a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8040b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8040c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8040d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8040e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8040f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804100:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804110:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804120:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804130:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804140:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804150:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804160:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804170:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804180:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804190:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8041a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8041b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8041c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8041d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8041e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8041f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804200:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804210:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804220:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804230:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804240:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804250:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804260:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804270:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804280:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804290:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8042a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8042b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8042c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8042d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8042e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8042f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804300:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804310:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804320:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804330:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804340:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804350:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804360:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804370:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804380:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804390:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8043a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8043b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8043c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8043d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8043e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8043f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804400:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804410:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804420:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804430:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804440:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804450:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804460:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804470:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804480:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804490:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8044a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8044b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8044c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8044d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8044e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8044f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804500:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804510:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804520:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804530:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804540:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804550:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804560:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804570:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804580:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804590:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8045a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8045b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8045c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8045d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8045e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8045f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804600:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804610:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804620:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804630:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804640:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804650:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804660:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804670:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804680:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804690:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8046a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8046b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8046c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8046d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8046e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8046f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804700:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804710:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804720:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804730:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804740:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804750:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804760:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804770:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804780:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804790:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8047a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8047b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8047c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8047d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8047e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8047f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804800:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804810:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804820:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804830:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804840:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804850:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804860:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804870:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804880:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804890:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8048a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8048b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8048c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8048d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8048e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8048f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804900:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804910:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804920:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804930:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804940:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804950:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804960:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804970:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804980:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804990:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8049a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8049b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8049d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8049e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8049f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804aa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ab0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ac0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ad0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ae0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804af0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ba0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804bb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804bc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804bd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804be0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804bf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ca0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804cb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804cc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804cd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ce0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804cf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804da0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
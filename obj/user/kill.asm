@@ -0,0 +1,6175 @@
+
+obj/user/kill:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 59 01 00 00       	call   80017c <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <usage>:
+#include <inc/lib.h>
+#include <inc/string.h>
+
+void
+usage(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    printf("usage: kill pid signum [sigarg]\n");
+  800029:	48 bf 68 33 80 00 00 	movabs $0x803368,%rdi
+  800030:	00 00 00 
+  800033:	b8 00 00 00 00       	mov    $0x0,%eax
+  800038:	48 ba 34 19 80 00 00 	movabs $0x801934,%rdx
+  80003f:	00 00 00 
+  800042:	ff d2                	call   *%rdx
+    exit();
+  800044:	48 b8 23 02 80 00 00 	movabs $0x800223,%rax
+  80004b:	00 00 00 
+  80004e:	ff d0                	call   *%rax
+}
+  800050:	5d                   	pop    %rbp
+  800051:	c3                   	ret
+
+0000000000800052 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 57                	push   %r15
+  800058:	41 56                	push   %r14
+  80005a:	41 55                	push   %r13
+  80005c:	41 54                	push   %r12
+  80005e:	53                   	push   %rbx
+  80005f:	48 83 ec 08          	sub    $0x8,%rsp
+  800063:	49 89 f5             	mov    %rsi,%r13
+    if (argc < 3 || 4 < argc)
+  800066:	8d 47 fd             	lea    -0x3(%rdi),%eax
+  800069:	83 f8 01             	cmp    $0x1,%eax
+  80006c:	77 60                	ja     8000ce <umain+0x7c>
+  80006e:	41 89 ff             	mov    %edi,%r15d
+        usage();
+
+    long pid = -1;
+    long signum = -1;
+    pid = strtol(argv[1], NULL, 0);
+  800071:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  800075:	ba 00 00 00 00       	mov    $0x0,%edx
+  80007a:	be 00 00 00 00       	mov    $0x0,%esi
+  80007f:	49 bc f5 05 80 00 00 	movabs $0x8005f5,%r12
+  800086:	00 00 00 
+  800089:	41 ff d4             	call   *%r12
+  80008c:	48 89 c3             	mov    %rax,%rbx
+    signum = strtol(argv[2], NULL, 10);
+  80008f:	49 8b 7d 10          	mov    0x10(%r13),%rdi
+  800093:	ba 0a 00 00 00       	mov    $0xa,%edx
+  800098:	be 00 00 00 00       	mov    $0x0,%esi
+  80009d:	41 ff d4             	call   *%r12
+  8000a0:	49 89 c4             	mov    %rax,%r12
+    long sigarg = 0;
+  8000a3:	41 be 00 00 00 00    	mov    $0x0,%r14d
+    if (argc == 4)
+  8000a9:	41 83 ff 04          	cmp    $0x4,%r15d
+  8000ad:	75 63                	jne    800112 <umain+0xc0>
+        sigarg = strtol(argv[3], NULL, 10);
+  8000af:	49 8b 7d 18          	mov    0x18(%r13),%rdi
+  8000b3:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8000b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8000bd:	48 b8 f5 05 80 00 00 	movabs $0x8005f5,%rax
+  8000c4:	00 00 00 
+  8000c7:	ff d0                	call   *%rax
+  8000c9:	49 89 c6             	mov    %rax,%r14
+  8000cc:	eb 44                	jmp    800112 <umain+0xc0>
+        usage();
+  8000ce:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+    pid = strtol(argv[1], NULL, 0);
+  8000da:	49 8b 7d 08          	mov    0x8(%r13),%rdi
+  8000de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e8:	49 bc f5 05 80 00 00 	movabs $0x8005f5,%r12
+  8000ef:	00 00 00 
+  8000f2:	41 ff d4             	call   *%r12
+  8000f5:	48 89 c3             	mov    %rax,%rbx
+    signum = strtol(argv[2], NULL, 10);
+  8000f8:	49 8b 7d 10          	mov    0x10(%r13),%rdi
+  8000fc:	ba 0a 00 00 00       	mov    $0xa,%edx
+  800101:	be 00 00 00 00       	mov    $0x0,%esi
+  800106:	41 ff d4             	call   *%r12
+  800109:	49 89 c4             	mov    %rax,%r12
+    long sigarg = 0;
+  80010c:	41 be 00 00 00 00    	mov    $0x0,%r14d
+
+    if (pid < 0 || signum <= 0)
+  800112:	48 85 db             	test   %rbx,%rbx
+  800115:	78 38                	js     80014f <umain+0xfd>
+  800117:	4d 85 e4             	test   %r12,%r12
+  80011a:	7e 33                	jle    80014f <umain+0xfd>
+        usage();
+    
+    union sigval sv;
+    sv.sival_int = sigarg;
+  80011c:	44 89 f2             	mov    %r14d,%edx
+    int err = sigqueue(pid, signum, sv);
+  80011f:	44 89 e6             	mov    %r12d,%esi
+  800122:	89 df                	mov    %ebx,%edi
+  800124:	48 b8 74 21 80 00 00 	movabs $0x802174,%rax
+  80012b:	00 00 00 
+  80012e:	ff d0                	call   *%rax
+    if (err)
+  800130:	85 c0                	test   %eax,%eax
+  800132:	75 29                	jne    80015d <umain+0x10b>
+        printf("kill: failed to send signal: %d\n", err);
+
+    sys_yield();
+  800134:	48 b8 a5 07 80 00 00 	movabs $0x8007a5,%rax
+  80013b:	00 00 00 
+  80013e:	ff d0                	call   *%rax
+}
+  800140:	48 83 c4 08          	add    $0x8,%rsp
+  800144:	5b                   	pop    %rbx
+  800145:	41 5c                	pop    %r12
+  800147:	41 5d                	pop    %r13
+  800149:	41 5e                	pop    %r14
+  80014b:	41 5f                	pop    %r15
+  80014d:	5d                   	pop    %rbp
+  80014e:	c3                   	ret
+        usage();
+  80014f:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800156:	00 00 00 
+  800159:	ff d0                	call   *%rax
+  80015b:	eb bf                	jmp    80011c <umain+0xca>
+        printf("kill: failed to send signal: %d\n", err);
+  80015d:	89 c6                	mov    %eax,%esi
+  80015f:	48 bf 90 33 80 00 00 	movabs $0x803390,%rdi
+  800166:	00 00 00 
+  800169:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016e:	48 ba 34 19 80 00 00 	movabs $0x801934,%rdx
+  800175:	00 00 00 
+  800178:	ff d2                	call   *%rdx
+  80017a:	eb b8                	jmp    800134 <umain+0xe2>
+
+000000000080017c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80017c:	55                   	push   %rbp
+  80017d:	48 89 e5             	mov    %rsp,%rbp
+  800180:	41 56                	push   %r14
+  800182:	41 55                	push   %r13
+  800184:	41 54                	push   %r12
+  800186:	53                   	push   %rbx
+  800187:	41 89 fd             	mov    %edi,%r13d
+  80018a:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80018d:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800194:	00 00 00 
+  800197:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80019e:	00 00 00 
+  8001a1:	48 39 c2             	cmp    %rax,%rdx
+  8001a4:	73 17                	jae    8001bd <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001a6:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001a9:	49 89 c4             	mov    %rax,%r12
+  8001ac:	48 83 c3 08          	add    $0x8,%rbx
+  8001b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b5:	ff 53 f8             	call   *-0x8(%rbx)
+  8001b8:	4c 39 e3             	cmp    %r12,%rbx
+  8001bb:	72 ef                	jb     8001ac <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8001bd:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  8001c4:	00 00 00 
+  8001c7:	ff d0                	call   *%rax
+  8001c9:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8001cc:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8001d3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001da:	00 00 00 
+  8001dd:	48 01 d0             	add    %rdx,%rax
+  8001e0:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8001e7:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001ea:	45 85 ed             	test   %r13d,%r13d
+  8001ed:	7e 0d                	jle    8001fc <libmain+0x80>
+  8001ef:	49 8b 06             	mov    (%r14),%rax
+  8001f2:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001f9:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001fc:	4c 89 f6             	mov    %r14,%rsi
+  8001ff:	44 89 ef             	mov    %r13d,%edi
+  800202:	48 b8 52 00 80 00 00 	movabs $0x800052,%rax
+  800209:	00 00 00 
+  80020c:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80020e:	48 b8 23 02 80 00 00 	movabs $0x800223,%rax
+  800215:	00 00 00 
+  800218:	ff d0                	call   *%rax
+#endif
+}
+  80021a:	5b                   	pop    %rbx
+  80021b:	41 5c                	pop    %r12
+  80021d:	41 5d                	pop    %r13
+  80021f:	41 5e                	pop    %r14
+  800221:	5d                   	pop    %rbp
+  800222:	c3                   	ret
+
+0000000000800223 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800223:	55                   	push   %rbp
+  800224:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800227:	48 b8 fc 0f 80 00 00 	movabs $0x800ffc,%rax
+  80022e:	00 00 00 
+  800231:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800233:	bf 00 00 00 00       	mov    $0x0,%edi
+  800238:	48 b8 09 07 80 00 00 	movabs $0x800709,%rax
+  80023f:	00 00 00 
+  800242:	ff d0                	call   *%rax
+}
+  800244:	5d                   	pop    %rbp
+  800245:	c3                   	ret
+
+0000000000800246 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800246:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800249:	74 10                	je     80025b <strlen+0x15>
+    size_t n = 0;
+  80024b:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800250:	48 83 c0 01          	add    $0x1,%rax
+  800254:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800258:	75 f6                	jne    800250 <strlen+0xa>
+  80025a:	c3                   	ret
+    size_t n = 0;
+  80025b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800260:	c3                   	ret
+
+0000000000800261 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800261:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800264:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800269:	48 85 f6             	test   %rsi,%rsi
+  80026c:	74 11                	je     80027f <strnlen+0x1e>
+  80026e:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800272:	74 0c                	je     800280 <strnlen+0x1f>
+  800274:	48 83 c2 01          	add    $0x1,%rdx
+  800278:	48 39 d0             	cmp    %rdx,%rax
+  80027b:	75 f1                	jne    80026e <strnlen+0xd>
+  80027d:	eb 04                	jmp    800283 <strnlen+0x22>
+  80027f:	c3                   	ret
+  800280:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800283:	c3                   	ret
+
+0000000000800284 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800284:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800287:	ba 00 00 00 00       	mov    $0x0,%edx
+  80028c:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800290:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800293:	48 83 c2 01          	add    $0x1,%rdx
+  800297:	84 c9                	test   %cl,%cl
+  800299:	75 f1                	jne    80028c <strcpy+0x8>
+        ;
+    return res;
+}
+  80029b:	c3                   	ret
+
+000000000080029c <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80029c:	55                   	push   %rbp
+  80029d:	48 89 e5             	mov    %rsp,%rbp
+  8002a0:	41 54                	push   %r12
+  8002a2:	53                   	push   %rbx
+  8002a3:	48 89 fb             	mov    %rdi,%rbx
+  8002a6:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8002a9:	48 b8 46 02 80 00 00 	movabs $0x800246,%rax
+  8002b0:	00 00 00 
+  8002b3:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8002b5:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8002b9:	4c 89 e6             	mov    %r12,%rsi
+  8002bc:	48 b8 84 02 80 00 00 	movabs $0x800284,%rax
+  8002c3:	00 00 00 
+  8002c6:	ff d0                	call   *%rax
+    return dst;
+}
+  8002c8:	48 89 d8             	mov    %rbx,%rax
+  8002cb:	5b                   	pop    %rbx
+  8002cc:	41 5c                	pop    %r12
+  8002ce:	5d                   	pop    %rbp
+  8002cf:	c3                   	ret
+
+00000000008002d0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8002d0:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8002d3:	48 85 d2             	test   %rdx,%rdx
+  8002d6:	74 1f                	je     8002f7 <strncpy+0x27>
+  8002d8:	48 01 fa             	add    %rdi,%rdx
+  8002db:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8002de:	48 83 c1 01          	add    $0x1,%rcx
+  8002e2:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8002e6:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8002ea:	41 80 f8 01          	cmp    $0x1,%r8b
+  8002ee:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8002f2:	48 39 ca             	cmp    %rcx,%rdx
+  8002f5:	75 e7                	jne    8002de <strncpy+0xe>
+    }
+    return ret;
+}
+  8002f7:	c3                   	ret
+
+00000000008002f8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8002f8:	48 89 f8             	mov    %rdi,%rax
+  8002fb:	48 85 d2             	test   %rdx,%rdx
+  8002fe:	74 24                	je     800324 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800300:	48 83 ea 01          	sub    $0x1,%rdx
+  800304:	74 1b                	je     800321 <strlcpy+0x29>
+  800306:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80030a:	0f b6 16             	movzbl (%rsi),%edx
+  80030d:	84 d2                	test   %dl,%dl
+  80030f:	74 10                	je     800321 <strlcpy+0x29>
+            *dst++ = *src++;
+  800311:	48 83 c6 01          	add    $0x1,%rsi
+  800315:	48 83 c0 01          	add    $0x1,%rax
+  800319:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80031c:	48 39 c8             	cmp    %rcx,%rax
+  80031f:	75 e9                	jne    80030a <strlcpy+0x12>
+        *dst = '\0';
+  800321:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800324:	48 29 f8             	sub    %rdi,%rax
+}
+  800327:	c3                   	ret
+
+0000000000800328 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800328:	0f b6 07             	movzbl (%rdi),%eax
+  80032b:	84 c0                	test   %al,%al
+  80032d:	74 13                	je     800342 <strcmp+0x1a>
+  80032f:	38 06                	cmp    %al,(%rsi)
+  800331:	75 0f                	jne    800342 <strcmp+0x1a>
+  800333:	48 83 c7 01          	add    $0x1,%rdi
+  800337:	48 83 c6 01          	add    $0x1,%rsi
+  80033b:	0f b6 07             	movzbl (%rdi),%eax
+  80033e:	84 c0                	test   %al,%al
+  800340:	75 ed                	jne    80032f <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800342:	0f b6 c0             	movzbl %al,%eax
+  800345:	0f b6 16             	movzbl (%rsi),%edx
+  800348:	29 d0                	sub    %edx,%eax
+}
+  80034a:	c3                   	ret
+
+000000000080034b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80034b:	48 85 d2             	test   %rdx,%rdx
+  80034e:	74 1f                	je     80036f <strncmp+0x24>
+  800350:	0f b6 07             	movzbl (%rdi),%eax
+  800353:	84 c0                	test   %al,%al
+  800355:	74 1e                	je     800375 <strncmp+0x2a>
+  800357:	3a 06                	cmp    (%rsi),%al
+  800359:	75 1a                	jne    800375 <strncmp+0x2a>
+  80035b:	48 83 c7 01          	add    $0x1,%rdi
+  80035f:	48 83 c6 01          	add    $0x1,%rsi
+  800363:	48 83 ea 01          	sub    $0x1,%rdx
+  800367:	75 e7                	jne    800350 <strncmp+0x5>
+
+    if (!n) return 0;
+  800369:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036e:	c3                   	ret
+  80036f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800374:	c3                   	ret
+  800375:	48 85 d2             	test   %rdx,%rdx
+  800378:	74 09                	je     800383 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80037a:	0f b6 07             	movzbl (%rdi),%eax
+  80037d:	0f b6 16             	movzbl (%rsi),%edx
+  800380:	29 d0                	sub    %edx,%eax
+  800382:	c3                   	ret
+    if (!n) return 0;
+  800383:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800388:	c3                   	ret
+
+0000000000800389 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800389:	0f b6 17             	movzbl (%rdi),%edx
+  80038c:	84 d2                	test   %dl,%dl
+  80038e:	74 18                	je     8003a8 <strchr+0x1f>
+        if (*str == c) {
+  800390:	0f be d2             	movsbl %dl,%edx
+  800393:	39 f2                	cmp    %esi,%edx
+  800395:	74 17                	je     8003ae <strchr+0x25>
+    for (; *str; str++) {
+  800397:	48 83 c7 01          	add    $0x1,%rdi
+  80039b:	0f b6 17             	movzbl (%rdi),%edx
+  80039e:	84 d2                	test   %dl,%dl
+  8003a0:	75 ee                	jne    800390 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8003a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a7:	c3                   	ret
+  8003a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ad:	c3                   	ret
+  8003ae:	48 89 f8             	mov    %rdi,%rax
+}
+  8003b1:	c3                   	ret
+
+00000000008003b2 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8003b2:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8003b5:	0f b6 17             	movzbl (%rdi),%edx
+  8003b8:	84 d2                	test   %dl,%dl
+  8003ba:	74 13                	je     8003cf <strfind+0x1d>
+  8003bc:	0f be d2             	movsbl %dl,%edx
+  8003bf:	39 f2                	cmp    %esi,%edx
+  8003c1:	74 0b                	je     8003ce <strfind+0x1c>
+  8003c3:	48 83 c0 01          	add    $0x1,%rax
+  8003c7:	0f b6 10             	movzbl (%rax),%edx
+  8003ca:	84 d2                	test   %dl,%dl
+  8003cc:	75 ee                	jne    8003bc <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8003ce:	c3                   	ret
+  8003cf:	c3                   	ret
+
+00000000008003d0 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8003d0:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8003d3:	48 89 f8             	mov    %rdi,%rax
+  8003d6:	48 f7 d8             	neg    %rax
+  8003d9:	83 e0 07             	and    $0x7,%eax
+  8003dc:	49 89 d1             	mov    %rdx,%r9
+  8003df:	49 29 c1             	sub    %rax,%r9
+  8003e2:	78 36                	js     80041a <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8003e4:	40 0f b6 c6          	movzbl %sil,%eax
+  8003e8:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8003ef:	01 01 01 
+  8003f2:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8003f6:	40 f6 c7 07          	test   $0x7,%dil
+  8003fa:	75 38                	jne    800434 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8003fc:	4c 89 c9             	mov    %r9,%rcx
+  8003ff:	48 c1 f9 03          	sar    $0x3,%rcx
+  800403:	74 0c                	je     800411 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800405:	fc                   	cld
+  800406:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800409:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80040d:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800411:	4d 85 c9             	test   %r9,%r9
+  800414:	75 45                	jne    80045b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800416:	4c 89 c0             	mov    %r8,%rax
+  800419:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80041a:	48 85 d2             	test   %rdx,%rdx
+  80041d:	74 f7                	je     800416 <memset+0x46>
+  80041f:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800422:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800425:	48 83 c0 01          	add    $0x1,%rax
+  800429:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80042d:	48 39 c2             	cmp    %rax,%rdx
+  800430:	75 f3                	jne    800425 <memset+0x55>
+  800432:	eb e2                	jmp    800416 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800434:	40 f6 c7 01          	test   $0x1,%dil
+  800438:	74 06                	je     800440 <memset+0x70>
+  80043a:	88 07                	mov    %al,(%rdi)
+  80043c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800440:	40 f6 c7 02          	test   $0x2,%dil
+  800444:	74 07                	je     80044d <memset+0x7d>
+  800446:	66 89 07             	mov    %ax,(%rdi)
+  800449:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80044d:	40 f6 c7 04          	test   $0x4,%dil
+  800451:	74 a9                	je     8003fc <memset+0x2c>
+  800453:	89 07                	mov    %eax,(%rdi)
+  800455:	48 83 c7 04          	add    $0x4,%rdi
+  800459:	eb a1                	jmp    8003fc <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80045b:	41 f6 c1 04          	test   $0x4,%r9b
+  80045f:	74 06                	je     800467 <memset+0x97>
+  800461:	89 07                	mov    %eax,(%rdi)
+  800463:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800467:	41 f6 c1 02          	test   $0x2,%r9b
+  80046b:	74 07                	je     800474 <memset+0xa4>
+  80046d:	66 89 07             	mov    %ax,(%rdi)
+  800470:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800474:	41 f6 c1 01          	test   $0x1,%r9b
+  800478:	74 9c                	je     800416 <memset+0x46>
+  80047a:	88 07                	mov    %al,(%rdi)
+  80047c:	eb 98                	jmp    800416 <memset+0x46>
+
+000000000080047e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80047e:	48 89 f8             	mov    %rdi,%rax
+  800481:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800484:	48 39 fe             	cmp    %rdi,%rsi
+  800487:	73 3b                	jae    8004c4 <memmove+0x46>
+  800489:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80048d:	48 39 d7             	cmp    %rdx,%rdi
+  800490:	73 32                	jae    8004c4 <memmove+0x46>
+        s += n;
+        d += n;
+  800492:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800496:	48 89 d6             	mov    %rdx,%rsi
+  800499:	48 09 fe             	or     %rdi,%rsi
+  80049c:	48 09 ce             	or     %rcx,%rsi
+  80049f:	40 f6 c6 07          	test   $0x7,%sil
+  8004a3:	75 12                	jne    8004b7 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8004a5:	48 83 ef 08          	sub    $0x8,%rdi
+  8004a9:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8004ad:	48 c1 e9 03          	shr    $0x3,%rcx
+  8004b1:	fd                   	std
+  8004b2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8004b5:	fc                   	cld
+  8004b6:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8004b7:	48 83 ef 01          	sub    $0x1,%rdi
+  8004bb:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8004bf:	fd                   	std
+  8004c0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8004c2:	eb f1                	jmp    8004b5 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8004c4:	48 89 f2             	mov    %rsi,%rdx
+  8004c7:	48 09 c2             	or     %rax,%rdx
+  8004ca:	48 09 ca             	or     %rcx,%rdx
+  8004cd:	f6 c2 07             	test   $0x7,%dl
+  8004d0:	75 0c                	jne    8004de <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8004d2:	48 c1 e9 03          	shr    $0x3,%rcx
+  8004d6:	48 89 c7             	mov    %rax,%rdi
+  8004d9:	fc                   	cld
+  8004da:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8004dd:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8004de:	48 89 c7             	mov    %rax,%rdi
+  8004e1:	fc                   	cld
+  8004e2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8004e4:	c3                   	ret
+
+00000000008004e5 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8004e9:	48 b8 7e 04 80 00 00 	movabs $0x80047e,%rax
+  8004f0:	00 00 00 
+  8004f3:	ff d0                	call   *%rax
+}
+  8004f5:	5d                   	pop    %rbp
+  8004f6:	c3                   	ret
+
+00000000008004f7 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8004f7:	55                   	push   %rbp
+  8004f8:	48 89 e5             	mov    %rsp,%rbp
+  8004fb:	41 57                	push   %r15
+  8004fd:	41 56                	push   %r14
+  8004ff:	41 55                	push   %r13
+  800501:	41 54                	push   %r12
+  800503:	53                   	push   %rbx
+  800504:	48 83 ec 08          	sub    $0x8,%rsp
+  800508:	49 89 fe             	mov    %rdi,%r14
+  80050b:	49 89 f7             	mov    %rsi,%r15
+  80050e:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800511:	48 89 f7             	mov    %rsi,%rdi
+  800514:	48 b8 46 02 80 00 00 	movabs $0x800246,%rax
+  80051b:	00 00 00 
+  80051e:	ff d0                	call   *%rax
+  800520:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800523:	48 89 de             	mov    %rbx,%rsi
+  800526:	4c 89 f7             	mov    %r14,%rdi
+  800529:	48 b8 61 02 80 00 00 	movabs $0x800261,%rax
+  800530:	00 00 00 
+  800533:	ff d0                	call   *%rax
+  800535:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800538:	48 39 c3             	cmp    %rax,%rbx
+  80053b:	74 36                	je     800573 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80053d:	48 89 d8             	mov    %rbx,%rax
+  800540:	4c 29 e8             	sub    %r13,%rax
+  800543:	49 39 c4             	cmp    %rax,%r12
+  800546:	73 31                	jae    800579 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800548:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80054d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800551:	4c 89 fe             	mov    %r15,%rsi
+  800554:	48 b8 e5 04 80 00 00 	movabs $0x8004e5,%rax
+  80055b:	00 00 00 
+  80055e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800560:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800564:	48 83 c4 08          	add    $0x8,%rsp
+  800568:	5b                   	pop    %rbx
+  800569:	41 5c                	pop    %r12
+  80056b:	41 5d                	pop    %r13
+  80056d:	41 5e                	pop    %r14
+  80056f:	41 5f                	pop    %r15
+  800571:	5d                   	pop    %rbp
+  800572:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800573:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800577:	eb eb                	jmp    800564 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800579:	48 83 eb 01          	sub    $0x1,%rbx
+  80057d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800581:	48 89 da             	mov    %rbx,%rdx
+  800584:	4c 89 fe             	mov    %r15,%rsi
+  800587:	48 b8 e5 04 80 00 00 	movabs $0x8004e5,%rax
+  80058e:	00 00 00 
+  800591:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800593:	49 01 de             	add    %rbx,%r14
+  800596:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80059b:	eb c3                	jmp    800560 <strlcat+0x69>
+
+000000000080059d <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80059d:	48 85 d2             	test   %rdx,%rdx
+  8005a0:	74 2d                	je     8005cf <memcmp+0x32>
+  8005a2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8005a7:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8005ab:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8005b0:	44 38 c1             	cmp    %r8b,%cl
+  8005b3:	75 0f                	jne    8005c4 <memcmp+0x27>
+    while (n-- > 0) {
+  8005b5:	48 83 c0 01          	add    $0x1,%rax
+  8005b9:	48 39 c2             	cmp    %rax,%rdx
+  8005bc:	75 e9                	jne    8005a7 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8005be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c3:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8005c4:	0f b6 c1             	movzbl %cl,%eax
+  8005c7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8005cb:	44 29 c0             	sub    %r8d,%eax
+  8005ce:	c3                   	ret
+    return 0;
+  8005cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8005d4:	c3                   	ret
+
+00000000008005d5 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8005d5:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8005d9:	48 39 c7             	cmp    %rax,%rdi
+  8005dc:	73 0f                	jae    8005ed <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8005de:	40 38 37             	cmp    %sil,(%rdi)
+  8005e1:	74 0e                	je     8005f1 <memfind+0x1c>
+    for (; src < end; src++) {
+  8005e3:	48 83 c7 01          	add    $0x1,%rdi
+  8005e7:	48 39 f8             	cmp    %rdi,%rax
+  8005ea:	75 f2                	jne    8005de <memfind+0x9>
+  8005ec:	c3                   	ret
+  8005ed:	48 89 f8             	mov    %rdi,%rax
+  8005f0:	c3                   	ret
+  8005f1:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8005f4:	c3                   	ret
+
+00000000008005f5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8005f5:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8005f8:	0f b6 37             	movzbl (%rdi),%esi
+  8005fb:	40 80 fe 20          	cmp    $0x20,%sil
+  8005ff:	74 06                	je     800607 <strtol+0x12>
+  800601:	40 80 fe 09          	cmp    $0x9,%sil
+  800605:	75 13                	jne    80061a <strtol+0x25>
+  800607:	48 83 c7 01          	add    $0x1,%rdi
+  80060b:	0f b6 37             	movzbl (%rdi),%esi
+  80060e:	40 80 fe 20          	cmp    $0x20,%sil
+  800612:	74 f3                	je     800607 <strtol+0x12>
+  800614:	40 80 fe 09          	cmp    $0x9,%sil
+  800618:	74 ed                	je     800607 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80061a:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80061d:	83 e0 fd             	and    $0xfffffffd,%eax
+  800620:	3c 01                	cmp    $0x1,%al
+  800622:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800626:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80062c:	75 0f                	jne    80063d <strtol+0x48>
+  80062e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800631:	74 14                	je     800647 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800633:	85 d2                	test   %edx,%edx
+  800635:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80063a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80063d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800642:	4c 63 ca             	movslq %edx,%r9
+  800645:	eb 36                	jmp    80067d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800647:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80064b:	74 0f                	je     80065c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80064d:	85 d2                	test   %edx,%edx
+  80064f:	75 ec                	jne    80063d <strtol+0x48>
+        s++;
+  800651:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800655:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80065a:	eb e1                	jmp    80063d <strtol+0x48>
+        s += 2;
+  80065c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800660:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800665:	eb d6                	jmp    80063d <strtol+0x48>
+            dig -= '0';
+  800667:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80066a:	44 0f b6 c1          	movzbl %cl,%r8d
+  80066e:	41 39 d0             	cmp    %edx,%r8d
+  800671:	7d 21                	jge    800694 <strtol+0x9f>
+        val = val * base + dig;
+  800673:	49 0f af c1          	imul   %r9,%rax
+  800677:	0f b6 c9             	movzbl %cl,%ecx
+  80067a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80067d:	48 83 c7 01          	add    $0x1,%rdi
+  800681:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800685:	80 f9 39             	cmp    $0x39,%cl
+  800688:	76 dd                	jbe    800667 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80068a:	80 f9 7b             	cmp    $0x7b,%cl
+  80068d:	77 05                	ja     800694 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80068f:	83 e9 57             	sub    $0x57,%ecx
+  800692:	eb d6                	jmp    80066a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800694:	4d 85 d2             	test   %r10,%r10
+  800697:	74 03                	je     80069c <strtol+0xa7>
+  800699:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80069c:	48 89 c2             	mov    %rax,%rdx
+  80069f:	48 f7 da             	neg    %rdx
+  8006a2:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8006a6:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8006aa:	c3                   	ret
+
+00000000008006ab <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8006ab:	55                   	push   %rbp
+  8006ac:	48 89 e5             	mov    %rsp,%rbp
+  8006af:	53                   	push   %rbx
+  8006b0:	48 89 fa             	mov    %rdi,%rdx
+  8006b3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8006b6:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8006ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006d0:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8006d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006d6:	c9                   	leave
+  8006d7:	c3                   	ret
+
+00000000008006d8 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8006d8:	55                   	push   %rbp
+  8006d9:	48 89 e5             	mov    %rsp,%rbp
+  8006dc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8006dd:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8006fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800701:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800703:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800707:	c9                   	leave
+  800708:	c3                   	ret
+
+0000000000800709 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800709:	55                   	push   %rbp
+  80070a:	48 89 e5             	mov    %rsp,%rbp
+  80070d:	53                   	push   %rbx
+  80070e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800712:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800715:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80071a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80071f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800724:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800729:	be 00 00 00 00       	mov    $0x0,%esi
+  80072e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800734:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800736:	48 85 c0             	test   %rax,%rax
+  800739:	7f 06                	jg     800741 <sys_env_destroy+0x38>
+}
+  80073b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80073f:	c9                   	leave
+  800740:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800741:	49 89 c0             	mov    %rax,%r8
+  800744:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800749:	48 ba c0 33 80 00 00 	movabs $0x8033c0,%rdx
+  800750:	00 00 00 
+  800753:	be 26 00 00 00       	mov    $0x26,%esi
+  800758:	48 bf df 33 80 00 00 	movabs $0x8033df,%rdi
+  80075f:	00 00 00 
+  800762:	b8 00 00 00 00       	mov    $0x0,%eax
+  800767:	49 b9 2a 24 80 00 00 	movabs $0x80242a,%r9
+  80076e:	00 00 00 
+  800771:	41 ff d1             	call   *%r9
+
+0000000000800774 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800774:	55                   	push   %rbp
+  800775:	48 89 e5             	mov    %rsp,%rbp
+  800778:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800779:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80077e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800783:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800788:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80078d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800792:	be 00 00 00 00       	mov    $0x0,%esi
+  800797:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80079d:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80079f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007a3:	c9                   	leave
+  8007a4:	c3                   	ret
+
+00000000008007a5 <sys_yield>:
+
+void
+sys_yield(void) {
+  8007a5:	55                   	push   %rbp
+  8007a6:	48 89 e5             	mov    %rsp,%rbp
+  8007a9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8007aa:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8007af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8007b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8007c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8007ce:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8007d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007d4:	c9                   	leave
+  8007d5:	c3                   	ret
+
+00000000008007d6 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8007d6:	55                   	push   %rbp
+  8007d7:	48 89 e5             	mov    %rsp,%rbp
+  8007da:	53                   	push   %rbx
+  8007db:	48 89 fa             	mov    %rdi,%rdx
+  8007de:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8007e1:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8007e6:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8007ed:	00 00 00 
+  8007f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8007fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800800:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800802:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800806:	c9                   	leave
+  800807:	c3                   	ret
+
+0000000000800808 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800808:	55                   	push   %rbp
+  800809:	48 89 e5             	mov    %rsp,%rbp
+  80080c:	53                   	push   %rbx
+  80080d:	49 89 f8             	mov    %rdi,%r8
+  800810:	48 89 d3             	mov    %rdx,%rbx
+  800813:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800816:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80081b:	4c 89 c2             	mov    %r8,%rdx
+  80081e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800821:	be 00 00 00 00       	mov    $0x0,%esi
+  800826:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80082c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80082e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800832:	c9                   	leave
+  800833:	c3                   	ret
+
+0000000000800834 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800834:	55                   	push   %rbp
+  800835:	48 89 e5             	mov    %rsp,%rbp
+  800838:	53                   	push   %rbx
+  800839:	48 83 ec 08          	sub    $0x8,%rsp
+  80083d:	89 f8                	mov    %edi,%eax
+  80083f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800842:	48 63 f9             	movslq %ecx,%rdi
+  800845:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800848:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80084d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800850:	be 00 00 00 00       	mov    $0x0,%esi
+  800855:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80085b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80085d:	48 85 c0             	test   %rax,%rax
+  800860:	7f 06                	jg     800868 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  800862:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800866:	c9                   	leave
+  800867:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800868:	49 89 c0             	mov    %rax,%r8
+  80086b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800870:	48 ba c0 33 80 00 00 	movabs $0x8033c0,%rdx
+  800877:	00 00 00 
+  80087a:	be 26 00 00 00       	mov    $0x26,%esi
+  80087f:	48 bf df 33 80 00 00 	movabs $0x8033df,%rdi
+  800886:	00 00 00 
+  800889:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088e:	49 b9 2a 24 80 00 00 	movabs $0x80242a,%r9
+  800895:	00 00 00 
+  800898:	41 ff d1             	call   *%r9
+
+000000000080089b <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80089b:	55                   	push   %rbp
+  80089c:	48 89 e5             	mov    %rsp,%rbp
+  80089f:	53                   	push   %rbx
+  8008a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8008a4:	89 f8                	mov    %edi,%eax
+  8008a6:	49 89 f2             	mov    %rsi,%r10
+  8008a9:	48 89 cf             	mov    %rcx,%rdi
+  8008ac:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8008af:	48 63 da             	movslq %edx,%rbx
+  8008b2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8008b5:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008ba:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8008bd:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8008c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8008c2:	48 85 c0             	test   %rax,%rax
+  8008c5:	7f 06                	jg     8008cd <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8008c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008cb:	c9                   	leave
+  8008cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8008cd:	49 89 c0             	mov    %rax,%r8
+  8008d0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8008d5:	48 ba c0 33 80 00 00 	movabs $0x8033c0,%rdx
+  8008dc:	00 00 00 
+  8008df:	be 26 00 00 00       	mov    $0x26,%esi
+  8008e4:	48 bf df 33 80 00 00 	movabs $0x8033df,%rdi
+  8008eb:	00 00 00 
+  8008ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f3:	49 b9 2a 24 80 00 00 	movabs $0x80242a,%r9
+  8008fa:	00 00 00 
+  8008fd:	41 ff d1             	call   *%r9
+
+0000000000800900 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800900:	55                   	push   %rbp
+  800901:	48 89 e5             	mov    %rsp,%rbp
+  800904:	53                   	push   %rbx
+  800905:	48 83 ec 08          	sub    $0x8,%rsp
+  800909:	48 89 f1             	mov    %rsi,%rcx
+  80090c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80090f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800912:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800917:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80091c:	be 00 00 00 00       	mov    $0x0,%esi
+  800921:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800927:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800929:	48 85 c0             	test   %rax,%rax
+  80092c:	7f 06                	jg     800934 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80092e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800932:	c9                   	leave
+  800933:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800934:	49 89 c0             	mov    %rax,%r8
+  800937:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80093c:	48 ba c0 33 80 00 00 	movabs $0x8033c0,%rdx
+  800943:	00 00 00 
+  800946:	be 26 00 00 00       	mov    $0x26,%esi
+  80094b:	48 bf df 33 80 00 00 	movabs $0x8033df,%rdi
+  800952:	00 00 00 
+  800955:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095a:	49 b9 2a 24 80 00 00 	movabs $0x80242a,%r9
+  800961:	00 00 00 
+  800964:	41 ff d1             	call   *%r9
+
+0000000000800967 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  800967:	55                   	push   %rbp
+  800968:	48 89 e5             	mov    %rsp,%rbp
+  80096b:	53                   	push   %rbx
+  80096c:	48 83 ec 08          	sub    $0x8,%rsp
+  800970:	89 f8                	mov    %edi,%eax
+  800972:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  800975:	48 63 f9             	movslq %ecx,%rdi
+  800978:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80097b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800980:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800983:	be 00 00 00 00       	mov    $0x0,%esi
+  800988:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80098e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800990:	48 85 c0             	test   %rax,%rax
+  800993:	7f 06                	jg     80099b <sys_region_advise+0x34>
+}
+  800995:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800999:	c9                   	leave
+  80099a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80099b:	49 89 c0             	mov    %rax,%r8
+  80099e:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8009a3:	48 ba c0 33 80 00 00 	movabs $0x8033c0,%rdx
+  8009aa:	00 00 00 
+  8009ad:	be 26 00 00 00       	mov    $0x26,%esi
+  8009b2:	48 bf df 33 80 00 00 	movabs $0x8033df,%rdi
+  8009b9:	00 00 00 
+  8009bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c1:	49 b9 2a 24 80 00 00 	movabs $0x80242a,%r9
+  8009c8:	00 00 00 
+  8009cb:	41 ff d1             	call   *%r9
+
+00000000008009ce <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  8009ce:	55                   	push   %rbp
+  8009cf:	48 89 e5             	mov    %rsp,%rbp
+  8009d2:	53                   	push   %rbx
+  8009d3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  8009d7:	48 63 ce             	movslq %esi,%rcx
+  8009da:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8009dd:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8009e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8009ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8009f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8009f9:	48 85 c0             	test   %rax,%rax
+  8009fc:	7f 06                	jg     800a04 <sys_env_set_nice+0x36>
+}
+  8009fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a02:	c9                   	leave
+  800a03:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800a04:	49 89 c0             	mov    %rax,%r8
+  800a07:	b9 15 00 00 00       	mov    $0x15,%ecx
+  800a0c:	48 ba c0 33 80 00 00 	movabs $0x8033c0,%rdx
+  800a13:	00 00 00 
+  800a16:	be 26 00 00 00       	mov    $0x26,%esi
+  800a1b:	48 bf df 33 80 00 00 	movabs $0x8033df,%rdi
+  800a22:	00 00 00 
+  800a25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2a:	49 b9 2a 24 80 00 00 	movabs $0x80242a,%r9
+  800a31:	00 00 00 
+  800a34:	41 ff d1             	call   *%r9
+
+0000000000800a37 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800a37:	55                   	push   %rbp
+  800a38:	48 89 e5             	mov    %rsp,%rbp
+  800a3b:	53                   	push   %rbx
+  800a3c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800a40:	48 63 ce             	movslq %esi,%rcx
+  800a43:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800a46:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800a4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a50:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800a55:	be 00 00 00 00       	mov    $0x0,%esi
+  800a5a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800a60:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800a62:	48 85 c0             	test   %rax,%rax
+  800a65:	7f 06                	jg     800a6d <sys_env_set_status+0x36>
+}
+  800a67:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a6b:	c9                   	leave
+  800a6c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800a6d:	49 89 c0             	mov    %rax,%r8
+  800a70:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800a75:	48 ba c0 33 80 00 00 	movabs $0x8033c0,%rdx
+  800a7c:	00 00 00 
+  800a7f:	be 26 00 00 00       	mov    $0x26,%esi
+  800a84:	48 bf df 33 80 00 00 	movabs $0x8033df,%rdi
+  800a8b:	00 00 00 
+  800a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a93:	49 b9 2a 24 80 00 00 	movabs $0x80242a,%r9
+  800a9a:	00 00 00 
+  800a9d:	41 ff d1             	call   *%r9
+
+0000000000800aa0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800aa0:	55                   	push   %rbp
+  800aa1:	48 89 e5             	mov    %rsp,%rbp
+  800aa4:	53                   	push   %rbx
+  800aa5:	48 83 ec 08          	sub    $0x8,%rsp
+  800aa9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800aac:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800aaf:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800ab4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ab9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800abe:	be 00 00 00 00       	mov    $0x0,%esi
+  800ac3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800ac9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800acb:	48 85 c0             	test   %rax,%rax
+  800ace:	7f 06                	jg     800ad6 <sys_env_set_trapframe+0x36>
+}
+  800ad0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ad4:	c9                   	leave
+  800ad5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800ad6:	49 89 c0             	mov    %rax,%r8
+  800ad9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800ade:	48 ba c0 33 80 00 00 	movabs $0x8033c0,%rdx
+  800ae5:	00 00 00 
+  800ae8:	be 26 00 00 00       	mov    $0x26,%esi
+  800aed:	48 bf df 33 80 00 00 	movabs $0x8033df,%rdi
+  800af4:	00 00 00 
+  800af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800afc:	49 b9 2a 24 80 00 00 	movabs $0x80242a,%r9
+  800b03:	00 00 00 
+  800b06:	41 ff d1             	call   *%r9
+
+0000000000800b09 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800b09:	55                   	push   %rbp
+  800b0a:	48 89 e5             	mov    %rsp,%rbp
+  800b0d:	53                   	push   %rbx
+  800b0e:	48 83 ec 08          	sub    $0x8,%rsp
+  800b12:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800b15:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800b18:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b22:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b27:	be 00 00 00 00       	mov    $0x0,%esi
+  800b2c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b32:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800b34:	48 85 c0             	test   %rax,%rax
+  800b37:	7f 06                	jg     800b3f <sys_env_set_pgfault_upcall+0x36>
+}
+  800b39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b3d:	c9                   	leave
+  800b3e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800b3f:	49 89 c0             	mov    %rax,%r8
+  800b42:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800b47:	48 ba c0 33 80 00 00 	movabs $0x8033c0,%rdx
+  800b4e:	00 00 00 
+  800b51:	be 26 00 00 00       	mov    $0x26,%esi
+  800b56:	48 bf df 33 80 00 00 	movabs $0x8033df,%rdi
+  800b5d:	00 00 00 
+  800b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b65:	49 b9 2a 24 80 00 00 	movabs $0x80242a,%r9
+  800b6c:	00 00 00 
+  800b6f:	41 ff d1             	call   *%r9
+
+0000000000800b72 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800b72:	55                   	push   %rbp
+  800b73:	48 89 e5             	mov    %rsp,%rbp
+  800b76:	53                   	push   %rbx
+  800b77:	89 f8                	mov    %edi,%eax
+  800b79:	49 89 f1             	mov    %rsi,%r9
+  800b7c:	48 89 d3             	mov    %rdx,%rbx
+  800b7f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800b82:	49 63 f0             	movslq %r8d,%rsi
+  800b85:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800b88:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800b8d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b90:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b96:	cd 30                	int    $0x30
+}
+  800b98:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b9c:	c9                   	leave
+  800b9d:	c3                   	ret
+
+0000000000800b9e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800b9e:	55                   	push   %rbp
+  800b9f:	48 89 e5             	mov    %rsp,%rbp
+  800ba2:	53                   	push   %rbx
+  800ba3:	48 83 ec 08          	sub    $0x8,%rsp
+  800ba7:	48 89 fa             	mov    %rdi,%rdx
+  800baa:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800bad:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800bb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bb7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800bbc:	be 00 00 00 00       	mov    $0x0,%esi
+  800bc1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800bc7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800bc9:	48 85 c0             	test   %rax,%rax
+  800bcc:	7f 06                	jg     800bd4 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800bce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800bd2:	c9                   	leave
+  800bd3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800bd4:	49 89 c0             	mov    %rax,%r8
+  800bd7:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800bdc:	48 ba c0 33 80 00 00 	movabs $0x8033c0,%rdx
+  800be3:	00 00 00 
+  800be6:	be 26 00 00 00       	mov    $0x26,%esi
+  800beb:	48 bf df 33 80 00 00 	movabs $0x8033df,%rdi
+  800bf2:	00 00 00 
+  800bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfa:	49 b9 2a 24 80 00 00 	movabs $0x80242a,%r9
+  800c01:	00 00 00 
+  800c04:	41 ff d1             	call   *%r9
+
+0000000000800c07 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800c07:	55                   	push   %rbp
+  800c08:	48 89 e5             	mov    %rsp,%rbp
+  800c0b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800c0c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c11:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c16:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c20:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c25:	be 00 00 00 00       	mov    $0x0,%esi
+  800c2a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c30:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800c32:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c36:	c9                   	leave
+  800c37:	c3                   	ret
+
+0000000000800c38 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  800c38:	55                   	push   %rbp
+  800c39:	48 89 e5             	mov    %rsp,%rbp
+  800c3c:	53                   	push   %rbx
+  800c3d:	48 83 ec 08          	sub    $0x8,%rsp
+  800c41:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  800c44:	48 63 ce             	movslq %esi,%rcx
+  800c47:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800c4a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c4f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c54:	be 00 00 00 00       	mov    $0x0,%esi
+  800c59:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c5f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800c61:	48 85 c0             	test   %rax,%rax
+  800c64:	7f 06                	jg     800c6c <sys_sigqueue+0x34>
+}
+  800c66:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c6a:	c9                   	leave
+  800c6b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800c6c:	49 89 c0             	mov    %rax,%r8
+  800c6f:	b9 10 00 00 00       	mov    $0x10,%ecx
+  800c74:	48 ba c0 33 80 00 00 	movabs $0x8033c0,%rdx
+  800c7b:	00 00 00 
+  800c7e:	be 26 00 00 00       	mov    $0x26,%esi
+  800c83:	48 bf df 33 80 00 00 	movabs $0x8033df,%rdi
+  800c8a:	00 00 00 
+  800c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c92:	49 b9 2a 24 80 00 00 	movabs $0x80242a,%r9
+  800c99:	00 00 00 
+  800c9c:	41 ff d1             	call   *%r9
+
+0000000000800c9f <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  800c9f:	55                   	push   %rbp
+  800ca0:	48 89 e5             	mov    %rsp,%rbp
+  800ca3:	53                   	push   %rbx
+  800ca4:	48 83 ec 08          	sub    $0x8,%rsp
+  800ca8:	48 89 fa             	mov    %rdi,%rdx
+  800cab:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800cae:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800cb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cb8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800cbd:	be 00 00 00 00       	mov    $0x0,%esi
+  800cc2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800cc8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800cca:	48 85 c0             	test   %rax,%rax
+  800ccd:	7f 06                	jg     800cd5 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  800ccf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cd3:	c9                   	leave
+  800cd4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800cd5:	49 89 c0             	mov    %rax,%r8
+  800cd8:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800cdd:	48 ba c0 33 80 00 00 	movabs $0x8033c0,%rdx
+  800ce4:	00 00 00 
+  800ce7:	be 26 00 00 00       	mov    $0x26,%esi
+  800cec:	48 bf df 33 80 00 00 	movabs $0x8033df,%rdi
+  800cf3:	00 00 00 
+  800cf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfb:	49 b9 2a 24 80 00 00 	movabs $0x80242a,%r9
+  800d02:	00 00 00 
+  800d05:	41 ff d1             	call   *%r9
+
+0000000000800d08 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  800d08:	55                   	push   %rbp
+  800d09:	48 89 e5             	mov    %rsp,%rbp
+  800d0c:	53                   	push   %rbx
+  800d0d:	48 83 ec 08          	sub    $0x8,%rsp
+  800d11:	48 89 f1             	mov    %rsi,%rcx
+  800d14:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  800d17:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800d1a:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800d1f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800d24:	be 00 00 00 00       	mov    $0x0,%esi
+  800d29:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800d2f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800d31:	48 85 c0             	test   %rax,%rax
+  800d34:	7f 06                	jg     800d3c <sys_sigaction+0x34>
+}
+  800d36:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d3a:	c9                   	leave
+  800d3b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800d3c:	49 89 c0             	mov    %rax,%r8
+  800d3f:	b9 12 00 00 00       	mov    $0x12,%ecx
+  800d44:	48 ba c0 33 80 00 00 	movabs $0x8033c0,%rdx
+  800d4b:	00 00 00 
+  800d4e:	be 26 00 00 00       	mov    $0x26,%esi
+  800d53:	48 bf df 33 80 00 00 	movabs $0x8033df,%rdi
+  800d5a:	00 00 00 
+  800d5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d62:	49 b9 2a 24 80 00 00 	movabs $0x80242a,%r9
+  800d69:	00 00 00 
+  800d6c:	41 ff d1             	call   *%r9
+
+0000000000800d6f <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  800d6f:	55                   	push   %rbp
+  800d70:	48 89 e5             	mov    %rsp,%rbp
+  800d73:	53                   	push   %rbx
+  800d74:	48 83 ec 08          	sub    $0x8,%rsp
+  800d78:	48 89 f1             	mov    %rsi,%rcx
+  800d7b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  800d7e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800d81:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800d86:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800d8b:	be 00 00 00 00       	mov    $0x0,%esi
+  800d90:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800d96:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800d98:	48 85 c0             	test   %rax,%rax
+  800d9b:	7f 06                	jg     800da3 <sys_sigprocmask+0x34>
+}
+  800d9d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800da1:	c9                   	leave
+  800da2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800da3:	49 89 c0             	mov    %rax,%r8
+  800da6:	b9 13 00 00 00       	mov    $0x13,%ecx
+  800dab:	48 ba c0 33 80 00 00 	movabs $0x8033c0,%rdx
+  800db2:	00 00 00 
+  800db5:	be 26 00 00 00       	mov    $0x26,%esi
+  800dba:	48 bf df 33 80 00 00 	movabs $0x8033df,%rdi
+  800dc1:	00 00 00 
+  800dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc9:	49 b9 2a 24 80 00 00 	movabs $0x80242a,%r9
+  800dd0:	00 00 00 
+  800dd3:	41 ff d1             	call   *%r9
+
+0000000000800dd6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800dd6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800ddd:	ff ff ff 
+  800de0:	48 01 f8             	add    %rdi,%rax
+  800de3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800de7:	c3                   	ret
+
+0000000000800de8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800de8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800def:	ff ff ff 
+  800df2:	48 01 f8             	add    %rdi,%rax
+  800df5:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800df9:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800dff:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800e03:	c3                   	ret
+
+0000000000800e04 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800e04:	55                   	push   %rbp
+  800e05:	48 89 e5             	mov    %rsp,%rbp
+  800e08:	41 57                	push   %r15
+  800e0a:	41 56                	push   %r14
+  800e0c:	41 55                	push   %r13
+  800e0e:	41 54                	push   %r12
+  800e10:	53                   	push   %rbx
+  800e11:	48 83 ec 08          	sub    $0x8,%rsp
+  800e15:	49 89 ff             	mov    %rdi,%r15
+  800e18:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800e1d:	49 bd 26 1f 80 00 00 	movabs $0x801f26,%r13
+  800e24:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800e27:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800e2d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800e30:	48 89 df             	mov    %rbx,%rdi
+  800e33:	41 ff d5             	call   *%r13
+  800e36:	83 e0 04             	and    $0x4,%eax
+  800e39:	74 17                	je     800e52 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800e3b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800e42:	4c 39 f3             	cmp    %r14,%rbx
+  800e45:	75 e6                	jne    800e2d <fd_alloc+0x29>
+  800e47:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800e4d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800e52:	4d 89 27             	mov    %r12,(%r15)
+}
+  800e55:	48 83 c4 08          	add    $0x8,%rsp
+  800e59:	5b                   	pop    %rbx
+  800e5a:	41 5c                	pop    %r12
+  800e5c:	41 5d                	pop    %r13
+  800e5e:	41 5e                	pop    %r14
+  800e60:	41 5f                	pop    %r15
+  800e62:	5d                   	pop    %rbp
+  800e63:	c3                   	ret
+
+0000000000800e64 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800e64:	83 ff 1f             	cmp    $0x1f,%edi
+  800e67:	77 39                	ja     800ea2 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800e69:	55                   	push   %rbp
+  800e6a:	48 89 e5             	mov    %rsp,%rbp
+  800e6d:	41 54                	push   %r12
+  800e6f:	53                   	push   %rbx
+  800e70:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800e73:	48 63 df             	movslq %edi,%rbx
+  800e76:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800e7d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800e81:	48 89 df             	mov    %rbx,%rdi
+  800e84:	48 b8 26 1f 80 00 00 	movabs $0x801f26,%rax
+  800e8b:	00 00 00 
+  800e8e:	ff d0                	call   *%rax
+  800e90:	a8 04                	test   $0x4,%al
+  800e92:	74 14                	je     800ea8 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800e94:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800e98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e9d:	5b                   	pop    %rbx
+  800e9e:	41 5c                	pop    %r12
+  800ea0:	5d                   	pop    %rbp
+  800ea1:	c3                   	ret
+        return -E_INVAL;
+  800ea2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800ea7:	c3                   	ret
+        return -E_INVAL;
+  800ea8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ead:	eb ee                	jmp    800e9d <fd_lookup+0x39>
+
+0000000000800eaf <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800eaf:	55                   	push   %rbp
+  800eb0:	48 89 e5             	mov    %rsp,%rbp
+  800eb3:	41 54                	push   %r12
+  800eb5:	53                   	push   %rbx
+  800eb6:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800eb9:	48 b8 80 34 80 00 00 	movabs $0x803480,%rax
+  800ec0:	00 00 00 
+  800ec3:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  800eca:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800ecd:	39 3b                	cmp    %edi,(%rbx)
+  800ecf:	74 47                	je     800f18 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800ed1:	48 83 c0 08          	add    $0x8,%rax
+  800ed5:	48 8b 18             	mov    (%rax),%rbx
+  800ed8:	48 85 db             	test   %rbx,%rbx
+  800edb:	75 f0                	jne    800ecd <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800edd:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800ee4:	00 00 00 
+  800ee7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800eed:	89 fa                	mov    %edi,%edx
+  800eef:	48 bf f0 33 80 00 00 	movabs $0x8033f0,%rdi
+  800ef6:	00 00 00 
+  800ef9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800efe:	48 b9 7a 25 80 00 00 	movabs $0x80257a,%rcx
+  800f05:	00 00 00 
+  800f08:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800f0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800f0f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800f13:	5b                   	pop    %rbx
+  800f14:	41 5c                	pop    %r12
+  800f16:	5d                   	pop    %rbp
+  800f17:	c3                   	ret
+            return 0;
+  800f18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f1d:	eb f0                	jmp    800f0f <dev_lookup+0x60>
+
+0000000000800f1f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800f1f:	55                   	push   %rbp
+  800f20:	48 89 e5             	mov    %rsp,%rbp
+  800f23:	41 55                	push   %r13
+  800f25:	41 54                	push   %r12
+  800f27:	53                   	push   %rbx
+  800f28:	48 83 ec 18          	sub    $0x18,%rsp
+  800f2c:	48 89 fb             	mov    %rdi,%rbx
+  800f2f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800f32:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800f39:	ff ff ff 
+  800f3c:	48 01 df             	add    %rbx,%rdi
+  800f3f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800f43:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800f47:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  800f4e:	00 00 00 
+  800f51:	ff d0                	call   *%rax
+  800f53:	41 89 c5             	mov    %eax,%r13d
+  800f56:	85 c0                	test   %eax,%eax
+  800f58:	78 06                	js     800f60 <fd_close+0x41>
+  800f5a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800f5e:	74 1a                	je     800f7a <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800f60:	45 84 e4             	test   %r12b,%r12b
+  800f63:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f68:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800f6c:	44 89 e8             	mov    %r13d,%eax
+  800f6f:	48 83 c4 18          	add    $0x18,%rsp
+  800f73:	5b                   	pop    %rbx
+  800f74:	41 5c                	pop    %r12
+  800f76:	41 5d                	pop    %r13
+  800f78:	5d                   	pop    %rbp
+  800f79:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800f7a:	8b 3b                	mov    (%rbx),%edi
+  800f7c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800f80:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  800f87:	00 00 00 
+  800f8a:	ff d0                	call   *%rax
+  800f8c:	41 89 c5             	mov    %eax,%r13d
+  800f8f:	85 c0                	test   %eax,%eax
+  800f91:	78 1b                	js     800fae <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800f93:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f97:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800f9b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800fa1:	48 85 c0             	test   %rax,%rax
+  800fa4:	74 08                	je     800fae <fd_close+0x8f>
+  800fa6:	48 89 df             	mov    %rbx,%rdi
+  800fa9:	ff d0                	call   *%rax
+  800fab:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800fae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800fb3:	48 89 de             	mov    %rbx,%rsi
+  800fb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fbb:	48 b8 00 09 80 00 00 	movabs $0x800900,%rax
+  800fc2:	00 00 00 
+  800fc5:	ff d0                	call   *%rax
+    return res;
+  800fc7:	eb a3                	jmp    800f6c <fd_close+0x4d>
+
+0000000000800fc9 <close>:
+
+int
+close(int fdnum) {
+  800fc9:	55                   	push   %rbp
+  800fca:	48 89 e5             	mov    %rsp,%rbp
+  800fcd:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800fd1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800fd5:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  800fdc:	00 00 00 
+  800fdf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800fe1:	85 c0                	test   %eax,%eax
+  800fe3:	78 15                	js     800ffa <close+0x31>
+
+    return fd_close(fd, 1);
+  800fe5:	be 01 00 00 00       	mov    $0x1,%esi
+  800fea:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800fee:	48 b8 1f 0f 80 00 00 	movabs $0x800f1f,%rax
+  800ff5:	00 00 00 
+  800ff8:	ff d0                	call   *%rax
+}
+  800ffa:	c9                   	leave
+  800ffb:	c3                   	ret
+
+0000000000800ffc <close_all>:
+
+void
+close_all(void) {
+  800ffc:	55                   	push   %rbp
+  800ffd:	48 89 e5             	mov    %rsp,%rbp
+  801000:	41 54                	push   %r12
+  801002:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801003:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801008:	49 bc c9 0f 80 00 00 	movabs $0x800fc9,%r12
+  80100f:	00 00 00 
+  801012:	89 df                	mov    %ebx,%edi
+  801014:	41 ff d4             	call   *%r12
+  801017:	83 c3 01             	add    $0x1,%ebx
+  80101a:	83 fb 20             	cmp    $0x20,%ebx
+  80101d:	75 f3                	jne    801012 <close_all+0x16>
+}
+  80101f:	5b                   	pop    %rbx
+  801020:	41 5c                	pop    %r12
+  801022:	5d                   	pop    %rbp
+  801023:	c3                   	ret
+
+0000000000801024 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801024:	55                   	push   %rbp
+  801025:	48 89 e5             	mov    %rsp,%rbp
+  801028:	41 57                	push   %r15
+  80102a:	41 56                	push   %r14
+  80102c:	41 55                	push   %r13
+  80102e:	41 54                	push   %r12
+  801030:	53                   	push   %rbx
+  801031:	48 83 ec 18          	sub    $0x18,%rsp
+  801035:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801038:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80103c:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  801043:	00 00 00 
+  801046:	ff d0                	call   *%rax
+  801048:	89 c3                	mov    %eax,%ebx
+  80104a:	85 c0                	test   %eax,%eax
+  80104c:	0f 88 b8 00 00 00    	js     80110a <dup+0xe6>
+    close(newfdnum);
+  801052:	44 89 e7             	mov    %r12d,%edi
+  801055:	48 b8 c9 0f 80 00 00 	movabs $0x800fc9,%rax
+  80105c:	00 00 00 
+  80105f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801061:	4d 63 ec             	movslq %r12d,%r13
+  801064:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80106b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80106f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801073:	4c 89 ff             	mov    %r15,%rdi
+  801076:	49 be e8 0d 80 00 00 	movabs $0x800de8,%r14
+  80107d:	00 00 00 
+  801080:	41 ff d6             	call   *%r14
+  801083:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801086:	4c 89 ef             	mov    %r13,%rdi
+  801089:	41 ff d6             	call   *%r14
+  80108c:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80108f:	48 89 df             	mov    %rbx,%rdi
+  801092:	48 b8 26 1f 80 00 00 	movabs $0x801f26,%rax
+  801099:	00 00 00 
+  80109c:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80109e:	a8 04                	test   $0x4,%al
+  8010a0:	74 2b                	je     8010cd <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8010a2:	41 89 c1             	mov    %eax,%r9d
+  8010a5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8010ab:	4c 89 f1             	mov    %r14,%rcx
+  8010ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b3:	48 89 de             	mov    %rbx,%rsi
+  8010b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010bb:	48 b8 9b 08 80 00 00 	movabs $0x80089b,%rax
+  8010c2:	00 00 00 
+  8010c5:	ff d0                	call   *%rax
+  8010c7:	89 c3                	mov    %eax,%ebx
+  8010c9:	85 c0                	test   %eax,%eax
+  8010cb:	78 4e                	js     80111b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8010cd:	4c 89 ff             	mov    %r15,%rdi
+  8010d0:	48 b8 26 1f 80 00 00 	movabs $0x801f26,%rax
+  8010d7:	00 00 00 
+  8010da:	ff d0                	call   *%rax
+  8010dc:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8010df:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8010e5:	4c 89 e9             	mov    %r13,%rcx
+  8010e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ed:	4c 89 fe             	mov    %r15,%rsi
+  8010f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010f5:	48 b8 9b 08 80 00 00 	movabs $0x80089b,%rax
+  8010fc:	00 00 00 
+  8010ff:	ff d0                	call   *%rax
+  801101:	89 c3                	mov    %eax,%ebx
+  801103:	85 c0                	test   %eax,%eax
+  801105:	78 14                	js     80111b <dup+0xf7>
+
+    return newfdnum;
+  801107:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80110a:	89 d8                	mov    %ebx,%eax
+  80110c:	48 83 c4 18          	add    $0x18,%rsp
+  801110:	5b                   	pop    %rbx
+  801111:	41 5c                	pop    %r12
+  801113:	41 5d                	pop    %r13
+  801115:	41 5e                	pop    %r14
+  801117:	41 5f                	pop    %r15
+  801119:	5d                   	pop    %rbp
+  80111a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80111b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801120:	4c 89 ee             	mov    %r13,%rsi
+  801123:	bf 00 00 00 00       	mov    $0x0,%edi
+  801128:	49 bc 00 09 80 00 00 	movabs $0x800900,%r12
+  80112f:	00 00 00 
+  801132:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801135:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80113a:	4c 89 f6             	mov    %r14,%rsi
+  80113d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801142:	41 ff d4             	call   *%r12
+    return res;
+  801145:	eb c3                	jmp    80110a <dup+0xe6>
+
+0000000000801147 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801147:	55                   	push   %rbp
+  801148:	48 89 e5             	mov    %rsp,%rbp
+  80114b:	41 56                	push   %r14
+  80114d:	41 55                	push   %r13
+  80114f:	41 54                	push   %r12
+  801151:	53                   	push   %rbx
+  801152:	48 83 ec 10          	sub    $0x10,%rsp
+  801156:	89 fb                	mov    %edi,%ebx
+  801158:	49 89 f4             	mov    %rsi,%r12
+  80115b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80115e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801162:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  801169:	00 00 00 
+  80116c:	ff d0                	call   *%rax
+  80116e:	85 c0                	test   %eax,%eax
+  801170:	78 4c                	js     8011be <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801172:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801176:	41 8b 3e             	mov    (%r14),%edi
+  801179:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80117d:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  801184:	00 00 00 
+  801187:	ff d0                	call   *%rax
+  801189:	85 c0                	test   %eax,%eax
+  80118b:	78 35                	js     8011c2 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80118d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801191:	83 e0 03             	and    $0x3,%eax
+  801194:	83 f8 01             	cmp    $0x1,%eax
+  801197:	74 2d                	je     8011c6 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801199:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80119d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8011a1:	48 85 c0             	test   %rax,%rax
+  8011a4:	74 56                	je     8011fc <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8011a6:	4c 89 ea             	mov    %r13,%rdx
+  8011a9:	4c 89 e6             	mov    %r12,%rsi
+  8011ac:	4c 89 f7             	mov    %r14,%rdi
+  8011af:	ff d0                	call   *%rax
+}
+  8011b1:	48 83 c4 10          	add    $0x10,%rsp
+  8011b5:	5b                   	pop    %rbx
+  8011b6:	41 5c                	pop    %r12
+  8011b8:	41 5d                	pop    %r13
+  8011ba:	41 5e                	pop    %r14
+  8011bc:	5d                   	pop    %rbp
+  8011bd:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8011be:	48 98                	cltq
+  8011c0:	eb ef                	jmp    8011b1 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8011c2:	48 98                	cltq
+  8011c4:	eb eb                	jmp    8011b1 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011c6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8011cd:	00 00 00 
+  8011d0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8011d6:	89 da                	mov    %ebx,%edx
+  8011d8:	48 bf 31 34 80 00 00 	movabs $0x803431,%rdi
+  8011df:	00 00 00 
+  8011e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e7:	48 b9 7a 25 80 00 00 	movabs $0x80257a,%rcx
+  8011ee:	00 00 00 
+  8011f1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8011f3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011fa:	eb b5                	jmp    8011b1 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8011fc:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801203:	eb ac                	jmp    8011b1 <read+0x6a>
+
+0000000000801205 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801205:	55                   	push   %rbp
+  801206:	48 89 e5             	mov    %rsp,%rbp
+  801209:	41 57                	push   %r15
+  80120b:	41 56                	push   %r14
+  80120d:	41 55                	push   %r13
+  80120f:	41 54                	push   %r12
+  801211:	53                   	push   %rbx
+  801212:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801216:	48 85 d2             	test   %rdx,%rdx
+  801219:	74 54                	je     80126f <readn+0x6a>
+  80121b:	41 89 fd             	mov    %edi,%r13d
+  80121e:	49 89 f6             	mov    %rsi,%r14
+  801221:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801224:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801229:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80122e:	49 bf 47 11 80 00 00 	movabs $0x801147,%r15
+  801235:	00 00 00 
+  801238:	4c 89 e2             	mov    %r12,%rdx
+  80123b:	48 29 f2             	sub    %rsi,%rdx
+  80123e:	4c 01 f6             	add    %r14,%rsi
+  801241:	44 89 ef             	mov    %r13d,%edi
+  801244:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801247:	85 c0                	test   %eax,%eax
+  801249:	78 20                	js     80126b <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80124b:	01 c3                	add    %eax,%ebx
+  80124d:	85 c0                	test   %eax,%eax
+  80124f:	74 08                	je     801259 <readn+0x54>
+  801251:	48 63 f3             	movslq %ebx,%rsi
+  801254:	4c 39 e6             	cmp    %r12,%rsi
+  801257:	72 df                	jb     801238 <readn+0x33>
+    }
+    return res;
+  801259:	48 63 c3             	movslq %ebx,%rax
+}
+  80125c:	48 83 c4 08          	add    $0x8,%rsp
+  801260:	5b                   	pop    %rbx
+  801261:	41 5c                	pop    %r12
+  801263:	41 5d                	pop    %r13
+  801265:	41 5e                	pop    %r14
+  801267:	41 5f                	pop    %r15
+  801269:	5d                   	pop    %rbp
+  80126a:	c3                   	ret
+        if (inc < 0) return inc;
+  80126b:	48 98                	cltq
+  80126d:	eb ed                	jmp    80125c <readn+0x57>
+    int inc = 1, res = 0;
+  80126f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801274:	eb e3                	jmp    801259 <readn+0x54>
+
+0000000000801276 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801276:	55                   	push   %rbp
+  801277:	48 89 e5             	mov    %rsp,%rbp
+  80127a:	41 56                	push   %r14
+  80127c:	41 55                	push   %r13
+  80127e:	41 54                	push   %r12
+  801280:	53                   	push   %rbx
+  801281:	48 83 ec 10          	sub    $0x10,%rsp
+  801285:	89 fb                	mov    %edi,%ebx
+  801287:	49 89 f4             	mov    %rsi,%r12
+  80128a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80128d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801291:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  801298:	00 00 00 
+  80129b:	ff d0                	call   *%rax
+  80129d:	85 c0                	test   %eax,%eax
+  80129f:	78 47                	js     8012e8 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8012a1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8012a5:	41 8b 3e             	mov    (%r14),%edi
+  8012a8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8012ac:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  8012b3:	00 00 00 
+  8012b6:	ff d0                	call   *%rax
+  8012b8:	85 c0                	test   %eax,%eax
+  8012ba:	78 30                	js     8012ec <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012bc:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8012c1:	74 2d                	je     8012f0 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8012c3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8012c7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8012cb:	48 85 c0             	test   %rax,%rax
+  8012ce:	74 56                	je     801326 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8012d0:	4c 89 ea             	mov    %r13,%rdx
+  8012d3:	4c 89 e6             	mov    %r12,%rsi
+  8012d6:	4c 89 f7             	mov    %r14,%rdi
+  8012d9:	ff d0                	call   *%rax
+}
+  8012db:	48 83 c4 10          	add    $0x10,%rsp
+  8012df:	5b                   	pop    %rbx
+  8012e0:	41 5c                	pop    %r12
+  8012e2:	41 5d                	pop    %r13
+  8012e4:	41 5e                	pop    %r14
+  8012e6:	5d                   	pop    %rbp
+  8012e7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8012e8:	48 98                	cltq
+  8012ea:	eb ef                	jmp    8012db <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8012ec:	48 98                	cltq
+  8012ee:	eb eb                	jmp    8012db <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8012f0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8012f7:	00 00 00 
+  8012fa:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801300:	89 da                	mov    %ebx,%edx
+  801302:	48 bf 4d 34 80 00 00 	movabs $0x80344d,%rdi
+  801309:	00 00 00 
+  80130c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801311:	48 b9 7a 25 80 00 00 	movabs $0x80257a,%rcx
+  801318:	00 00 00 
+  80131b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80131d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801324:	eb b5                	jmp    8012db <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801326:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80132d:	eb ac                	jmp    8012db <write+0x65>
+
+000000000080132f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80132f:	55                   	push   %rbp
+  801330:	48 89 e5             	mov    %rsp,%rbp
+  801333:	53                   	push   %rbx
+  801334:	48 83 ec 18          	sub    $0x18,%rsp
+  801338:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80133a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80133e:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  801345:	00 00 00 
+  801348:	ff d0                	call   *%rax
+  80134a:	85 c0                	test   %eax,%eax
+  80134c:	78 0c                	js     80135a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80134e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801352:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801355:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80135a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135e:	c9                   	leave
+  80135f:	c3                   	ret
+
+0000000000801360 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801360:	55                   	push   %rbp
+  801361:	48 89 e5             	mov    %rsp,%rbp
+  801364:	41 55                	push   %r13
+  801366:	41 54                	push   %r12
+  801368:	53                   	push   %rbx
+  801369:	48 83 ec 18          	sub    $0x18,%rsp
+  80136d:	89 fb                	mov    %edi,%ebx
+  80136f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801372:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801376:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  80137d:	00 00 00 
+  801380:	ff d0                	call   *%rax
+  801382:	85 c0                	test   %eax,%eax
+  801384:	78 38                	js     8013be <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801386:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80138a:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80138e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801392:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  801399:	00 00 00 
+  80139c:	ff d0                	call   *%rax
+  80139e:	85 c0                	test   %eax,%eax
+  8013a0:	78 1c                	js     8013be <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8013a2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8013a7:	74 20                	je     8013c9 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8013a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8013ad:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8013b1:	48 85 c0             	test   %rax,%rax
+  8013b4:	74 47                	je     8013fd <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8013b6:	44 89 e6             	mov    %r12d,%esi
+  8013b9:	4c 89 ef             	mov    %r13,%rdi
+  8013bc:	ff d0                	call   *%rax
+}
+  8013be:	48 83 c4 18          	add    $0x18,%rsp
+  8013c2:	5b                   	pop    %rbx
+  8013c3:	41 5c                	pop    %r12
+  8013c5:	41 5d                	pop    %r13
+  8013c7:	5d                   	pop    %rbp
+  8013c8:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8013c9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8013d0:	00 00 00 
+  8013d3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8013d9:	89 da                	mov    %ebx,%edx
+  8013db:	48 bf 10 34 80 00 00 	movabs $0x803410,%rdi
+  8013e2:	00 00 00 
+  8013e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ea:	48 b9 7a 25 80 00 00 	movabs $0x80257a,%rcx
+  8013f1:	00 00 00 
+  8013f4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8013f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013fb:	eb c1                	jmp    8013be <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8013fd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801402:	eb ba                	jmp    8013be <ftruncate+0x5e>
+
+0000000000801404 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801404:	55                   	push   %rbp
+  801405:	48 89 e5             	mov    %rsp,%rbp
+  801408:	41 54                	push   %r12
+  80140a:	53                   	push   %rbx
+  80140b:	48 83 ec 10          	sub    $0x10,%rsp
+  80140f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801412:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801416:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  80141d:	00 00 00 
+  801420:	ff d0                	call   *%rax
+  801422:	85 c0                	test   %eax,%eax
+  801424:	78 4e                	js     801474 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801426:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80142a:	41 8b 3c 24          	mov    (%r12),%edi
+  80142e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801432:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  801439:	00 00 00 
+  80143c:	ff d0                	call   *%rax
+  80143e:	85 c0                	test   %eax,%eax
+  801440:	78 32                	js     801474 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801442:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801446:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80144b:	74 30                	je     80147d <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80144d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801450:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801457:	00 00 00 
+    stat->st_isdir = 0;
+  80145a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801461:	00 00 00 
+    stat->st_dev = dev;
+  801464:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80146b:	48 89 de             	mov    %rbx,%rsi
+  80146e:	4c 89 e7             	mov    %r12,%rdi
+  801471:	ff 50 28             	call   *0x28(%rax)
+}
+  801474:	48 83 c4 10          	add    $0x10,%rsp
+  801478:	5b                   	pop    %rbx
+  801479:	41 5c                	pop    %r12
+  80147b:	5d                   	pop    %rbp
+  80147c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80147d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801482:	eb f0                	jmp    801474 <fstat+0x70>
+
+0000000000801484 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801484:	55                   	push   %rbp
+  801485:	48 89 e5             	mov    %rsp,%rbp
+  801488:	41 54                	push   %r12
+  80148a:	53                   	push   %rbx
+  80148b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80148e:	be 00 00 00 00       	mov    $0x0,%esi
+  801493:	48 b8 05 17 80 00 00 	movabs $0x801705,%rax
+  80149a:	00 00 00 
+  80149d:	ff d0                	call   *%rax
+  80149f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8014a1:	85 c0                	test   %eax,%eax
+  8014a3:	78 25                	js     8014ca <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8014a5:	4c 89 e6             	mov    %r12,%rsi
+  8014a8:	89 c7                	mov    %eax,%edi
+  8014aa:	48 b8 04 14 80 00 00 	movabs $0x801404,%rax
+  8014b1:	00 00 00 
+  8014b4:	ff d0                	call   *%rax
+  8014b6:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8014b9:	89 df                	mov    %ebx,%edi
+  8014bb:	48 b8 c9 0f 80 00 00 	movabs $0x800fc9,%rax
+  8014c2:	00 00 00 
+  8014c5:	ff d0                	call   *%rax
+
+    return res;
+  8014c7:	44 89 e3             	mov    %r12d,%ebx
+}
+  8014ca:	89 d8                	mov    %ebx,%eax
+  8014cc:	5b                   	pop    %rbx
+  8014cd:	41 5c                	pop    %r12
+  8014cf:	5d                   	pop    %rbp
+  8014d0:	c3                   	ret
+
+00000000008014d1 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  8014d1:	55                   	push   %rbp
+  8014d2:	48 89 e5             	mov    %rsp,%rbp
+  8014d5:	41 54                	push   %r12
+  8014d7:	53                   	push   %rbx
+  8014d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8014dc:	41 89 fc             	mov    %edi,%r12d
+  8014df:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8014e2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8014e9:	00 00 00 
+  8014ec:	83 38 00             	cmpl   $0x0,(%rax)
+  8014ef:	74 5e                	je     80154f <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8014f1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8014f7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8014fc:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801503:	00 00 00 
+  801506:	44 89 e6             	mov    %r12d,%esi
+  801509:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801510:	00 00 00 
+  801513:	8b 38                	mov    (%rax),%edi
+  801515:	48 b8 b1 2f 80 00 00 	movabs $0x802fb1,%rax
+  80151c:	00 00 00 
+  80151f:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801521:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801528:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801529:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80152e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801532:	48 89 de             	mov    %rbx,%rsi
+  801535:	bf 00 00 00 00       	mov    $0x0,%edi
+  80153a:	48 b8 1c 2f 80 00 00 	movabs $0x802f1c,%rax
+  801541:	00 00 00 
+  801544:	ff d0                	call   *%rax
+}
+  801546:	48 83 c4 10          	add    $0x10,%rsp
+  80154a:	5b                   	pop    %rbx
+  80154b:	41 5c                	pop    %r12
+  80154d:	5d                   	pop    %rbp
+  80154e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80154f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801554:	48 b8 51 30 80 00 00 	movabs $0x803051,%rax
+  80155b:	00 00 00 
+  80155e:	ff d0                	call   *%rax
+  801560:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801567:	00 00 
+  801569:	eb 86                	jmp    8014f1 <fsipc+0x20>
+
+000000000080156b <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80156b:	55                   	push   %rbp
+  80156c:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80156f:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801576:	00 00 00 
+  801579:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80157c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80157e:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801581:	be 00 00 00 00       	mov    $0x0,%esi
+  801586:	bf 02 00 00 00       	mov    $0x2,%edi
+  80158b:	48 b8 d1 14 80 00 00 	movabs $0x8014d1,%rax
+  801592:	00 00 00 
+  801595:	ff d0                	call   *%rax
+}
+  801597:	5d                   	pop    %rbp
+  801598:	c3                   	ret
+
+0000000000801599 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801599:	55                   	push   %rbp
+  80159a:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80159d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8015a0:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8015a7:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8015a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ae:	bf 06 00 00 00       	mov    $0x6,%edi
+  8015b3:	48 b8 d1 14 80 00 00 	movabs $0x8014d1,%rax
+  8015ba:	00 00 00 
+  8015bd:	ff d0                	call   *%rax
+}
+  8015bf:	5d                   	pop    %rbp
+  8015c0:	c3                   	ret
+
+00000000008015c1 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8015c1:	55                   	push   %rbp
+  8015c2:	48 89 e5             	mov    %rsp,%rbp
+  8015c5:	41 54                	push   %r12
+  8015c7:	53                   	push   %rbx
+  8015c8:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8015cb:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8015ce:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8015d5:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8015d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015dc:	bf 05 00 00 00       	mov    $0x5,%edi
+  8015e1:	48 b8 d1 14 80 00 00 	movabs $0x8014d1,%rax
+  8015e8:	00 00 00 
+  8015eb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8015ed:	85 c0                	test   %eax,%eax
+  8015ef:	78 3d                	js     80162e <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8015f1:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8015f8:	00 00 00 
+  8015fb:	4c 89 e6             	mov    %r12,%rsi
+  8015fe:	48 89 df             	mov    %rbx,%rdi
+  801601:	48 b8 84 02 80 00 00 	movabs $0x800284,%rax
+  801608:	00 00 00 
+  80160b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80160d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801614:	00 
+  801615:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80161b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801622:	00 
+  801623:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801629:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80162e:	5b                   	pop    %rbx
+  80162f:	41 5c                	pop    %r12
+  801631:	5d                   	pop    %rbp
+  801632:	c3                   	ret
+
+0000000000801633 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801633:	55                   	push   %rbp
+  801634:	48 89 e5             	mov    %rsp,%rbp
+  801637:	41 54                	push   %r12
+  801639:	53                   	push   %rbx
+  80163a:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  80163d:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  801642:	48 39 c2             	cmp    %rax,%rdx
+  801645:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801649:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80164c:	48 89 c2             	mov    %rax,%rdx
+  80164f:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801656:	00 00 00 
+  801659:	48 b8 e5 04 80 00 00 	movabs $0x8004e5,%rax
+  801660:	00 00 00 
+  801663:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801665:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80166c:	00 00 00 
+  80166f:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  801674:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  801676:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  80167a:	be 00 00 00 00       	mov    $0x0,%esi
+  80167f:	bf 04 00 00 00       	mov    $0x4,%edi
+  801684:	48 b8 d1 14 80 00 00 	movabs $0x8014d1,%rax
+  80168b:	00 00 00 
+  80168e:	ff d0                	call   *%rax
+  801690:	48 98                	cltq
+}
+  801692:	5b                   	pop    %rbx
+  801693:	41 5c                	pop    %r12
+  801695:	5d                   	pop    %rbp
+  801696:	c3                   	ret
+
+0000000000801697 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801697:	55                   	push   %rbp
+  801698:	48 89 e5             	mov    %rsp,%rbp
+  80169b:	41 54                	push   %r12
+  80169d:	53                   	push   %rbx
+  80169e:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8016a1:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8016a8:	00 00 00 
+  8016ab:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8016ae:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8016b0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8016b5:	48 39 ca             	cmp    %rcx,%rdx
+  8016b8:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8016bc:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8016c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8016ca:	48 b8 d1 14 80 00 00 	movabs $0x8014d1,%rax
+  8016d1:	00 00 00 
+  8016d4:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  8016d6:	85 c0                	test   %eax,%eax
+  8016d8:	78 27                	js     801701 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  8016da:	48 63 d8             	movslq %eax,%rbx
+  8016dd:	48 89 da             	mov    %rbx,%rdx
+  8016e0:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8016e7:	00 00 00 
+  8016ea:	4c 89 e7             	mov    %r12,%rdi
+  8016ed:	48 b8 e5 04 80 00 00 	movabs $0x8004e5,%rax
+  8016f4:	00 00 00 
+  8016f7:	ff d0                	call   *%rax
+    return bytes_read;
+  8016f9:	48 89 d8             	mov    %rbx,%rax
+}
+  8016fc:	5b                   	pop    %rbx
+  8016fd:	41 5c                	pop    %r12
+  8016ff:	5d                   	pop    %rbp
+  801700:	c3                   	ret
+        return bytes_read;
+  801701:	48 98                	cltq
+  801703:	eb f7                	jmp    8016fc <devfile_read+0x65>
+
+0000000000801705 <open>:
+open(const char *path, int mode) {
+  801705:	55                   	push   %rbp
+  801706:	48 89 e5             	mov    %rsp,%rbp
+  801709:	41 55                	push   %r13
+  80170b:	41 54                	push   %r12
+  80170d:	53                   	push   %rbx
+  80170e:	48 83 ec 18          	sub    $0x18,%rsp
+  801712:	49 89 fc             	mov    %rdi,%r12
+  801715:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801718:	48 b8 46 02 80 00 00 	movabs $0x800246,%rax
+  80171f:	00 00 00 
+  801722:	ff d0                	call   *%rax
+  801724:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80172a:	0f 87 8a 00 00 00    	ja     8017ba <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801730:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801734:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  80173b:	00 00 00 
+  80173e:	ff d0                	call   *%rax
+  801740:	89 c3                	mov    %eax,%ebx
+  801742:	85 c0                	test   %eax,%eax
+  801744:	78 50                	js     801796 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801746:	4c 89 e6             	mov    %r12,%rsi
+  801749:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801750:	00 00 00 
+  801753:	48 89 df             	mov    %rbx,%rdi
+  801756:	48 b8 84 02 80 00 00 	movabs $0x800284,%rax
+  80175d:	00 00 00 
+  801760:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801762:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801769:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80176d:	bf 01 00 00 00       	mov    $0x1,%edi
+  801772:	48 b8 d1 14 80 00 00 	movabs $0x8014d1,%rax
+  801779:	00 00 00 
+  80177c:	ff d0                	call   *%rax
+  80177e:	89 c3                	mov    %eax,%ebx
+  801780:	85 c0                	test   %eax,%eax
+  801782:	78 1f                	js     8017a3 <open+0x9e>
+    return fd2num(fd);
+  801784:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801788:	48 b8 d6 0d 80 00 00 	movabs $0x800dd6,%rax
+  80178f:	00 00 00 
+  801792:	ff d0                	call   *%rax
+  801794:	89 c3                	mov    %eax,%ebx
+}
+  801796:	89 d8                	mov    %ebx,%eax
+  801798:	48 83 c4 18          	add    $0x18,%rsp
+  80179c:	5b                   	pop    %rbx
+  80179d:	41 5c                	pop    %r12
+  80179f:	41 5d                	pop    %r13
+  8017a1:	5d                   	pop    %rbp
+  8017a2:	c3                   	ret
+        fd_close(fd, 0);
+  8017a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8017ac:	48 b8 1f 0f 80 00 00 	movabs $0x800f1f,%rax
+  8017b3:	00 00 00 
+  8017b6:	ff d0                	call   *%rax
+        return res;
+  8017b8:	eb dc                	jmp    801796 <open+0x91>
+        return -E_BAD_PATH;
+  8017ba:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8017bf:	eb d5                	jmp    801796 <open+0x91>
+
+00000000008017c1 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8017c1:	55                   	push   %rbp
+  8017c2:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8017c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ca:	bf 08 00 00 00       	mov    $0x8,%edi
+  8017cf:	48 b8 d1 14 80 00 00 	movabs $0x8014d1,%rax
+  8017d6:	00 00 00 
+  8017d9:	ff d0                	call   *%rax
+}
+  8017db:	5d                   	pop    %rbp
+  8017dc:	c3                   	ret
+
+00000000008017dd <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8017dd:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8017e1:	7f 01                	jg     8017e4 <writebuf+0x7>
+  8017e3:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8017e4:	55                   	push   %rbp
+  8017e5:	48 89 e5             	mov    %rsp,%rbp
+  8017e8:	53                   	push   %rbx
+  8017e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ed:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8017f0:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8017f4:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8017f8:	8b 3f                	mov    (%rdi),%edi
+  8017fa:	48 b8 76 12 80 00 00 	movabs $0x801276,%rax
+  801801:	00 00 00 
+  801804:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  801806:	48 85 c0             	test   %rax,%rax
+  801809:	7e 04                	jle    80180f <writebuf+0x32>
+  80180b:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  80180f:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  801813:	48 39 c2             	cmp    %rax,%rdx
+  801816:	74 0f                	je     801827 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  801818:	48 85 c0             	test   %rax,%rax
+  80181b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801820:	48 0f 4f c2          	cmovg  %rdx,%rax
+  801824:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  801827:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80182b:	c9                   	leave
+  80182c:	c3                   	ret
+
+000000000080182d <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  80182d:	8b 46 04             	mov    0x4(%rsi),%eax
+  801830:	8d 50 01             	lea    0x1(%rax),%edx
+  801833:	89 56 04             	mov    %edx,0x4(%rsi)
+  801836:	48 98                	cltq
+  801838:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  80183d:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  801843:	74 01                	je     801846 <putch+0x19>
+  801845:	c3                   	ret
+putch(int ch, void *arg) {
+  801846:	55                   	push   %rbp
+  801847:	48 89 e5             	mov    %rsp,%rbp
+  80184a:	53                   	push   %rbx
+  80184b:	48 83 ec 08          	sub    $0x8,%rsp
+  80184f:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  801852:	48 89 f7             	mov    %rsi,%rdi
+  801855:	48 b8 dd 17 80 00 00 	movabs $0x8017dd,%rax
+  80185c:	00 00 00 
+  80185f:	ff d0                	call   *%rax
+        state->offset = 0;
+  801861:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  801868:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80186c:	c9                   	leave
+  80186d:	c3                   	ret
+
+000000000080186e <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  80186e:	55                   	push   %rbp
+  80186f:	48 89 e5             	mov    %rsp,%rbp
+  801872:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  801879:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  80187c:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  801882:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  801889:	00 00 00 
+    state.result = 0;
+  80188c:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  801893:	00 00 00 00 
+    state.error = 1;
+  801897:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  80189e:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8018a1:	48 89 f2             	mov    %rsi,%rdx
+  8018a4:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8018ab:	48 bf 2d 18 80 00 00 	movabs $0x80182d,%rdi
+  8018b2:	00 00 00 
+  8018b5:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  8018bc:	00 00 00 
+  8018bf:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8018c1:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8018c8:	7f 14                	jg     8018de <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8018ca:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8018d1:	48 85 c0             	test   %rax,%rax
+  8018d4:	75 06                	jne    8018dc <vfprintf+0x6e>
+  8018d6:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8018dc:	c9                   	leave
+  8018dd:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8018de:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8018e5:	48 b8 dd 17 80 00 00 	movabs $0x8017dd,%rax
+  8018ec:	00 00 00 
+  8018ef:	ff d0                	call   *%rax
+  8018f1:	eb d7                	jmp    8018ca <vfprintf+0x5c>
+
+00000000008018f3 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8018f3:	55                   	push   %rbp
+  8018f4:	48 89 e5             	mov    %rsp,%rbp
+  8018f7:	48 83 ec 50          	sub    $0x50,%rsp
+  8018fb:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8018ff:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801903:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801907:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80190b:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  801912:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801916:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80191a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80191e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  801922:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  801926:	48 b8 6e 18 80 00 00 	movabs $0x80186e,%rax
+  80192d:	00 00 00 
+  801930:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  801932:	c9                   	leave
+  801933:	c3                   	ret
+
+0000000000801934 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  801934:	55                   	push   %rbp
+  801935:	48 89 e5             	mov    %rsp,%rbp
+  801938:	48 83 ec 50          	sub    $0x50,%rsp
+  80193c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801940:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801944:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801948:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80194c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  801950:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801957:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80195b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80195f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801963:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  801967:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80196b:	48 89 fe             	mov    %rdi,%rsi
+  80196e:	bf 01 00 00 00       	mov    $0x1,%edi
+  801973:	48 b8 6e 18 80 00 00 	movabs $0x80186e,%rax
+  80197a:	00 00 00 
+  80197d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80197f:	c9                   	leave
+  801980:	c3                   	ret
+
+0000000000801981 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801981:	55                   	push   %rbp
+  801982:	48 89 e5             	mov    %rsp,%rbp
+  801985:	41 54                	push   %r12
+  801987:	53                   	push   %rbx
+  801988:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80198b:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  801992:	00 00 00 
+  801995:	ff d0                	call   *%rax
+  801997:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80199a:	48 be a0 34 80 00 00 	movabs $0x8034a0,%rsi
+  8019a1:	00 00 00 
+  8019a4:	48 89 df             	mov    %rbx,%rdi
+  8019a7:	48 b8 84 02 80 00 00 	movabs $0x800284,%rax
+  8019ae:	00 00 00 
+  8019b1:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8019b3:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8019b8:	41 2b 04 24          	sub    (%r12),%eax
+  8019bc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8019c2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8019c9:	00 00 00 
+    stat->st_dev = &devpipe;
+  8019cc:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8019d3:	00 00 00 
+  8019d6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8019dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e2:	5b                   	pop    %rbx
+  8019e3:	41 5c                	pop    %r12
+  8019e5:	5d                   	pop    %rbp
+  8019e6:	c3                   	ret
+
+00000000008019e7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8019e7:	55                   	push   %rbp
+  8019e8:	48 89 e5             	mov    %rsp,%rbp
+  8019eb:	41 54                	push   %r12
+  8019ed:	53                   	push   %rbx
+  8019ee:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8019f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019f6:	48 89 fe             	mov    %rdi,%rsi
+  8019f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019fe:	49 bc 00 09 80 00 00 	movabs $0x800900,%r12
+  801a05:	00 00 00 
+  801a08:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  801a0b:	48 89 df             	mov    %rbx,%rdi
+  801a0e:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  801a15:	00 00 00 
+  801a18:	ff d0                	call   *%rax
+  801a1a:	48 89 c6             	mov    %rax,%rsi
+  801a1d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a22:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a27:	41 ff d4             	call   *%r12
+}
+  801a2a:	5b                   	pop    %rbx
+  801a2b:	41 5c                	pop    %r12
+  801a2d:	5d                   	pop    %rbp
+  801a2e:	c3                   	ret
+
+0000000000801a2f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801a2f:	55                   	push   %rbp
+  801a30:	48 89 e5             	mov    %rsp,%rbp
+  801a33:	41 57                	push   %r15
+  801a35:	41 56                	push   %r14
+  801a37:	41 55                	push   %r13
+  801a39:	41 54                	push   %r12
+  801a3b:	53                   	push   %rbx
+  801a3c:	48 83 ec 18          	sub    $0x18,%rsp
+  801a40:	49 89 fc             	mov    %rdi,%r12
+  801a43:	49 89 f5             	mov    %rsi,%r13
+  801a46:	49 89 d7             	mov    %rdx,%r15
+  801a49:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801a4d:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  801a54:	00 00 00 
+  801a57:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801a59:	4d 85 ff             	test   %r15,%r15
+  801a5c:	0f 84 af 00 00 00    	je     801b11 <devpipe_write+0xe2>
+  801a62:	48 89 c3             	mov    %rax,%rbx
+  801a65:	4c 89 f8             	mov    %r15,%rax
+  801a68:	4d 89 ef             	mov    %r13,%r15
+  801a6b:	4c 01 e8             	add    %r13,%rax
+  801a6e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801a72:	49 bd 08 08 80 00 00 	movabs $0x800808,%r13
+  801a79:	00 00 00 
+            sys_yield();
+  801a7c:	49 be a5 07 80 00 00 	movabs $0x8007a5,%r14
+  801a83:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801a86:	8b 73 04             	mov    0x4(%rbx),%esi
+  801a89:	48 63 ce             	movslq %esi,%rcx
+  801a8c:	48 63 03             	movslq (%rbx),%rax
+  801a8f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801a95:	48 39 c1             	cmp    %rax,%rcx
+  801a98:	72 2e                	jb     801ac8 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801a9a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801a9f:	48 89 da             	mov    %rbx,%rdx
+  801aa2:	be 00 10 00 00       	mov    $0x1000,%esi
+  801aa7:	4c 89 e7             	mov    %r12,%rdi
+  801aaa:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801aad:	85 c0                	test   %eax,%eax
+  801aaf:	74 66                	je     801b17 <devpipe_write+0xe8>
+            sys_yield();
+  801ab1:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801ab4:	8b 73 04             	mov    0x4(%rbx),%esi
+  801ab7:	48 63 ce             	movslq %esi,%rcx
+  801aba:	48 63 03             	movslq (%rbx),%rax
+  801abd:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801ac3:	48 39 c1             	cmp    %rax,%rcx
+  801ac6:	73 d2                	jae    801a9a <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801ac8:	41 0f b6 3f          	movzbl (%r15),%edi
+  801acc:	48 89 ca             	mov    %rcx,%rdx
+  801acf:	48 c1 ea 03          	shr    $0x3,%rdx
+  801ad3:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  801ada:	08 10 20 
+  801add:	48 f7 e2             	mul    %rdx
+  801ae0:	48 c1 ea 06          	shr    $0x6,%rdx
+  801ae4:	48 89 d0             	mov    %rdx,%rax
+  801ae7:	48 c1 e0 09          	shl    $0x9,%rax
+  801aeb:	48 29 d0             	sub    %rdx,%rax
+  801aee:	48 c1 e0 03          	shl    $0x3,%rax
+  801af2:	48 29 c1             	sub    %rax,%rcx
+  801af5:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  801afa:	83 c6 01             	add    $0x1,%esi
+  801afd:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801b00:	49 83 c7 01          	add    $0x1,%r15
+  801b04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b08:	49 39 c7             	cmp    %rax,%r15
+  801b0b:	0f 85 75 ff ff ff    	jne    801a86 <devpipe_write+0x57>
+    return n;
+  801b11:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801b15:	eb 05                	jmp    801b1c <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801b17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b1c:	48 83 c4 18          	add    $0x18,%rsp
+  801b20:	5b                   	pop    %rbx
+  801b21:	41 5c                	pop    %r12
+  801b23:	41 5d                	pop    %r13
+  801b25:	41 5e                	pop    %r14
+  801b27:	41 5f                	pop    %r15
+  801b29:	5d                   	pop    %rbp
+  801b2a:	c3                   	ret
+
+0000000000801b2b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801b2b:	55                   	push   %rbp
+  801b2c:	48 89 e5             	mov    %rsp,%rbp
+  801b2f:	41 57                	push   %r15
+  801b31:	41 56                	push   %r14
+  801b33:	41 55                	push   %r13
+  801b35:	41 54                	push   %r12
+  801b37:	53                   	push   %rbx
+  801b38:	48 83 ec 18          	sub    $0x18,%rsp
+  801b3c:	49 89 fc             	mov    %rdi,%r12
+  801b3f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801b43:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801b47:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  801b4e:	00 00 00 
+  801b51:	ff d0                	call   *%rax
+  801b53:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801b56:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801b5c:	49 bd 08 08 80 00 00 	movabs $0x800808,%r13
+  801b63:	00 00 00 
+            sys_yield();
+  801b66:	49 be a5 07 80 00 00 	movabs $0x8007a5,%r14
+  801b6d:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801b70:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801b75:	74 7d                	je     801bf4 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801b77:	8b 03                	mov    (%rbx),%eax
+  801b79:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801b7c:	75 26                	jne    801ba4 <devpipe_read+0x79>
+            if (i > 0) return i;
+  801b7e:	4d 85 ff             	test   %r15,%r15
+  801b81:	75 77                	jne    801bfa <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801b83:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801b88:	48 89 da             	mov    %rbx,%rdx
+  801b8b:	be 00 10 00 00       	mov    $0x1000,%esi
+  801b90:	4c 89 e7             	mov    %r12,%rdi
+  801b93:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801b96:	85 c0                	test   %eax,%eax
+  801b98:	74 72                	je     801c0c <devpipe_read+0xe1>
+            sys_yield();
+  801b9a:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801b9d:	8b 03                	mov    (%rbx),%eax
+  801b9f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801ba2:	74 df                	je     801b83 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801ba4:	48 63 c8             	movslq %eax,%rcx
+  801ba7:	48 89 ca             	mov    %rcx,%rdx
+  801baa:	48 c1 ea 03          	shr    $0x3,%rdx
+  801bae:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801bb5:	08 10 20 
+  801bb8:	48 89 d0             	mov    %rdx,%rax
+  801bbb:	48 f7 e6             	mul    %rsi
+  801bbe:	48 c1 ea 06          	shr    $0x6,%rdx
+  801bc2:	48 89 d0             	mov    %rdx,%rax
+  801bc5:	48 c1 e0 09          	shl    $0x9,%rax
+  801bc9:	48 29 d0             	sub    %rdx,%rax
+  801bcc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801bd3:	00 
+  801bd4:	48 89 c8             	mov    %rcx,%rax
+  801bd7:	48 29 d0             	sub    %rdx,%rax
+  801bda:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801bdf:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801be3:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801be7:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801bea:	49 83 c7 01          	add    $0x1,%r15
+  801bee:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801bf2:	75 83                	jne    801b77 <devpipe_read+0x4c>
+    return n;
+  801bf4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bf8:	eb 03                	jmp    801bfd <devpipe_read+0xd2>
+            if (i > 0) return i;
+  801bfa:	4c 89 f8             	mov    %r15,%rax
+}
+  801bfd:	48 83 c4 18          	add    $0x18,%rsp
+  801c01:	5b                   	pop    %rbx
+  801c02:	41 5c                	pop    %r12
+  801c04:	41 5d                	pop    %r13
+  801c06:	41 5e                	pop    %r14
+  801c08:	41 5f                	pop    %r15
+  801c0a:	5d                   	pop    %rbp
+  801c0b:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  801c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c11:	eb ea                	jmp    801bfd <devpipe_read+0xd2>
+
+0000000000801c13 <pipe>:
+pipe(int pfd[2]) {
+  801c13:	55                   	push   %rbp
+  801c14:	48 89 e5             	mov    %rsp,%rbp
+  801c17:	41 55                	push   %r13
+  801c19:	41 54                	push   %r12
+  801c1b:	53                   	push   %rbx
+  801c1c:	48 83 ec 18          	sub    $0x18,%rsp
+  801c20:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801c23:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801c27:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  801c2e:	00 00 00 
+  801c31:	ff d0                	call   *%rax
+  801c33:	89 c3                	mov    %eax,%ebx
+  801c35:	85 c0                	test   %eax,%eax
+  801c37:	0f 88 a0 01 00 00    	js     801ddd <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  801c3d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801c42:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c47:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801c4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c50:	48 b8 34 08 80 00 00 	movabs $0x800834,%rax
+  801c57:	00 00 00 
+  801c5a:	ff d0                	call   *%rax
+  801c5c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801c5e:	85 c0                	test   %eax,%eax
+  801c60:	0f 88 77 01 00 00    	js     801ddd <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801c66:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  801c6a:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  801c71:	00 00 00 
+  801c74:	ff d0                	call   *%rax
+  801c76:	89 c3                	mov    %eax,%ebx
+  801c78:	85 c0                	test   %eax,%eax
+  801c7a:	0f 88 43 01 00 00    	js     801dc3 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801c80:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801c85:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c8a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801c8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c93:	48 b8 34 08 80 00 00 	movabs $0x800834,%rax
+  801c9a:	00 00 00 
+  801c9d:	ff d0                	call   *%rax
+  801c9f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801ca1:	85 c0                	test   %eax,%eax
+  801ca3:	0f 88 1a 01 00 00    	js     801dc3 <pipe+0x1b0>
+    va = fd2data(fd0);
+  801ca9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801cad:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  801cb4:	00 00 00 
+  801cb7:	ff d0                	call   *%rax
+  801cb9:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  801cbc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801cc1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cc6:	48 89 c6             	mov    %rax,%rsi
+  801cc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cce:	48 b8 34 08 80 00 00 	movabs $0x800834,%rax
+  801cd5:	00 00 00 
+  801cd8:	ff d0                	call   *%rax
+  801cda:	89 c3                	mov    %eax,%ebx
+  801cdc:	85 c0                	test   %eax,%eax
+  801cde:	0f 88 c5 00 00 00    	js     801da9 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801ce4:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801ce8:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  801cef:	00 00 00 
+  801cf2:	ff d0                	call   *%rax
+  801cf4:	48 89 c1             	mov    %rax,%rcx
+  801cf7:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  801cfd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d03:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d08:	4c 89 ee             	mov    %r13,%rsi
+  801d0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d10:	48 b8 9b 08 80 00 00 	movabs $0x80089b,%rax
+  801d17:	00 00 00 
+  801d1a:	ff d0                	call   *%rax
+  801d1c:	89 c3                	mov    %eax,%ebx
+  801d1e:	85 c0                	test   %eax,%eax
+  801d20:	78 6e                	js     801d90 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801d22:	be 00 10 00 00       	mov    $0x1000,%esi
+  801d27:	4c 89 ef             	mov    %r13,%rdi
+  801d2a:	48 b8 d6 07 80 00 00 	movabs $0x8007d6,%rax
+  801d31:	00 00 00 
+  801d34:	ff d0                	call   *%rax
+  801d36:	83 f8 02             	cmp    $0x2,%eax
+  801d39:	0f 85 ab 00 00 00    	jne    801dea <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801d3f:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  801d46:	00 00 
+  801d48:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801d4c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801d4e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801d52:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801d59:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801d5d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801d5f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d63:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801d6a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801d6e:	48 bb d6 0d 80 00 00 	movabs $0x800dd6,%rbx
+  801d75:	00 00 00 
+  801d78:	ff d3                	call   *%rbx
+  801d7a:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801d7e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801d82:	ff d3                	call   *%rbx
+  801d84:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  801d89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d8e:	eb 4d                	jmp    801ddd <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  801d90:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d95:	4c 89 ee             	mov    %r13,%rsi
+  801d98:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d9d:	48 b8 00 09 80 00 00 	movabs $0x800900,%rax
+  801da4:	00 00 00 
+  801da7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  801da9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801dae:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801db2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801db7:	48 b8 00 09 80 00 00 	movabs $0x800900,%rax
+  801dbe:	00 00 00 
+  801dc1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  801dc3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801dc8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801dcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dd1:	48 b8 00 09 80 00 00 	movabs $0x800900,%rax
+  801dd8:	00 00 00 
+  801ddb:	ff d0                	call   *%rax
+}
+  801ddd:	89 d8                	mov    %ebx,%eax
+  801ddf:	48 83 c4 18          	add    $0x18,%rsp
+  801de3:	5b                   	pop    %rbx
+  801de4:	41 5c                	pop    %r12
+  801de6:	41 5d                	pop    %r13
+  801de8:	5d                   	pop    %rbp
+  801de9:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801dea:	48 b9 d0 34 80 00 00 	movabs $0x8034d0,%rcx
+  801df1:	00 00 00 
+  801df4:	48 ba a7 34 80 00 00 	movabs $0x8034a7,%rdx
+  801dfb:	00 00 00 
+  801dfe:	be 2e 00 00 00       	mov    $0x2e,%esi
+  801e03:	48 bf bc 34 80 00 00 	movabs $0x8034bc,%rdi
+  801e0a:	00 00 00 
+  801e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e12:	49 b8 2a 24 80 00 00 	movabs $0x80242a,%r8
+  801e19:	00 00 00 
+  801e1c:	41 ff d0             	call   *%r8
+
+0000000000801e1f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  801e1f:	55                   	push   %rbp
+  801e20:	48 89 e5             	mov    %rsp,%rbp
+  801e23:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801e27:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e2b:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  801e32:	00 00 00 
+  801e35:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e37:	85 c0                	test   %eax,%eax
+  801e39:	78 35                	js     801e70 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  801e3b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801e3f:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  801e46:	00 00 00 
+  801e49:	ff d0                	call   *%rax
+  801e4b:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801e4e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e53:	be 00 10 00 00       	mov    $0x1000,%esi
+  801e58:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801e5c:	48 b8 08 08 80 00 00 	movabs $0x800808,%rax
+  801e63:	00 00 00 
+  801e66:	ff d0                	call   *%rax
+  801e68:	85 c0                	test   %eax,%eax
+  801e6a:	0f 94 c0             	sete   %al
+  801e6d:	0f b6 c0             	movzbl %al,%eax
+}
+  801e70:	c9                   	leave
+  801e71:	c3                   	ret
+
+0000000000801e72 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801e72:	48 89 f8             	mov    %rdi,%rax
+  801e75:	48 c1 e8 27          	shr    $0x27,%rax
+  801e79:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801e80:	01 00 00 
+  801e83:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801e87:	f6 c2 01             	test   $0x1,%dl
+  801e8a:	74 6d                	je     801ef9 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801e8c:	48 89 f8             	mov    %rdi,%rax
+  801e8f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801e93:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801e9a:	01 00 00 
+  801e9d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801ea1:	f6 c2 01             	test   $0x1,%dl
+  801ea4:	74 62                	je     801f08 <get_uvpt_entry+0x96>
+  801ea6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801ead:	01 00 00 
+  801eb0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801eb4:	f6 c2 80             	test   $0x80,%dl
+  801eb7:	75 4f                	jne    801f08 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801eb9:	48 89 f8             	mov    %rdi,%rax
+  801ebc:	48 c1 e8 15          	shr    $0x15,%rax
+  801ec0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801ec7:	01 00 00 
+  801eca:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801ece:	f6 c2 01             	test   $0x1,%dl
+  801ed1:	74 44                	je     801f17 <get_uvpt_entry+0xa5>
+  801ed3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801eda:	01 00 00 
+  801edd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801ee1:	f6 c2 80             	test   $0x80,%dl
+  801ee4:	75 31                	jne    801f17 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  801ee6:	48 c1 ef 0c          	shr    $0xc,%rdi
+  801eea:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801ef1:	01 00 00 
+  801ef4:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  801ef8:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801ef9:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801f00:	01 00 00 
+  801f03:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801f07:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801f08:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801f0f:	01 00 00 
+  801f12:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801f16:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801f17:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801f1e:	01 00 00 
+  801f21:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801f25:	c3                   	ret
+
+0000000000801f26 <get_prot>:
+
+int
+get_prot(void *va) {
+  801f26:	55                   	push   %rbp
+  801f27:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801f2a:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  801f31:	00 00 00 
+  801f34:	ff d0                	call   *%rax
+  801f36:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  801f39:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  801f3e:	89 c1                	mov    %eax,%ecx
+  801f40:	83 c9 04             	or     $0x4,%ecx
+  801f43:	f6 c2 01             	test   $0x1,%dl
+  801f46:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  801f49:	89 c1                	mov    %eax,%ecx
+  801f4b:	83 c9 02             	or     $0x2,%ecx
+  801f4e:	f6 c2 02             	test   $0x2,%dl
+  801f51:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  801f54:	89 c1                	mov    %eax,%ecx
+  801f56:	83 c9 01             	or     $0x1,%ecx
+  801f59:	48 85 d2             	test   %rdx,%rdx
+  801f5c:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801f5f:	89 c1                	mov    %eax,%ecx
+  801f61:	83 c9 40             	or     $0x40,%ecx
+  801f64:	f6 c6 04             	test   $0x4,%dh
+  801f67:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  801f6a:	5d                   	pop    %rbp
+  801f6b:	c3                   	ret
+
+0000000000801f6c <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  801f6c:	55                   	push   %rbp
+  801f6d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801f70:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  801f77:	00 00 00 
+  801f7a:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  801f7c:	48 c1 e8 06          	shr    $0x6,%rax
+  801f80:	83 e0 01             	and    $0x1,%eax
+}
+  801f83:	5d                   	pop    %rbp
+  801f84:	c3                   	ret
+
+0000000000801f85 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  801f85:	55                   	push   %rbp
+  801f86:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  801f89:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  801f90:	00 00 00 
+  801f93:	ff d0                	call   *%rax
+  801f95:	83 e0 01             	and    $0x1,%eax
+}
+  801f98:	5d                   	pop    %rbp
+  801f99:	c3                   	ret
+
+0000000000801f9a <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  801f9a:	55                   	push   %rbp
+  801f9b:	48 89 e5             	mov    %rsp,%rbp
+  801f9e:	41 57                	push   %r15
+  801fa0:	41 56                	push   %r14
+  801fa2:	41 55                	push   %r13
+  801fa4:	41 54                	push   %r12
+  801fa6:	53                   	push   %rbx
+  801fa7:	48 83 ec 18          	sub    $0x18,%rsp
+  801fab:	49 89 ff             	mov    %rdi,%r15
+  801fae:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  801fb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  801fb7:	49 bc 85 1f 80 00 00 	movabs $0x801f85,%r12
+  801fbe:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  801fc1:	49 be 26 1f 80 00 00 	movabs $0x801f26,%r14
+  801fc8:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  801fcb:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  801fd2:	00 00 00 
+  801fd5:	eb 0c                	jmp    801fe3 <foreach_shared_region+0x49>
+  801fd7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801fde:	4c 39 eb             	cmp    %r13,%rbx
+  801fe1:	74 38                	je     80201b <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  801fe3:	48 89 df             	mov    %rbx,%rdi
+  801fe6:	41 ff d4             	call   *%r12
+  801fe9:	84 c0                	test   %al,%al
+  801feb:	74 ea                	je     801fd7 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  801fed:	48 89 df             	mov    %rbx,%rdi
+  801ff0:	41 ff d6             	call   *%r14
+  801ff3:	a8 40                	test   $0x40,%al
+  801ff5:	74 e0                	je     801fd7 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  801ff7:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  801ffe:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802002:	48 89 df             	mov    %rbx,%rdi
+  802005:	41 ff d7             	call   *%r15
+        if (err)
+  802008:	85 c0                	test   %eax,%eax
+  80200a:	74 cb                	je     801fd7 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  80200c:	48 83 c4 18          	add    $0x18,%rsp
+  802010:	5b                   	pop    %rbx
+  802011:	41 5c                	pop    %r12
+  802013:	41 5d                	pop    %r13
+  802015:	41 5e                	pop    %r14
+  802017:	41 5f                	pop    %r15
+  802019:	5d                   	pop    %rbp
+  80201a:	c3                   	ret
+    return 0;
+  80201b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802020:	eb ea                	jmp    80200c <foreach_shared_region+0x72>
+
+0000000000802022 <_generic_signal_handler>:
+        (es->sa.sa_handler)(es->signo);
+    }
+}
+
+void
+_generic_signal_handler(struct UTrapframe *utf, struct EnqueuedSignal * es) {
+  802022:	55                   	push   %rbp
+  802023:	48 89 e5             	mov    %rsp,%rbp
+  802026:	41 55                	push   %r13
+  802028:	41 54                	push   %r12
+  80202a:	53                   	push   %rbx
+  80202b:	48 83 ec 08          	sub    $0x8,%rsp
+  80202f:	49 89 fc             	mov    %rdi,%r12
+  802032:	48 89 f3             	mov    %rsi,%rbx
+    if (trace_signals)
+        cprintf("signals: env %x: begin generic handler for %d\n", sys_getenvid(), es->signo);
+  802035:	44 8b 2e             	mov    (%rsi),%r13d
+  802038:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  80203f:	00 00 00 
+  802042:	ff d0                	call   *%rax
+  802044:	89 c6                	mov    %eax,%esi
+  802046:	44 89 ea             	mov    %r13d,%edx
+  802049:	48 bf f8 34 80 00 00 	movabs $0x8034f8,%rdi
+  802050:	00 00 00 
+  802053:	b8 00 00 00 00       	mov    $0x0,%eax
+  802058:	48 b9 7a 25 80 00 00 	movabs $0x80257a,%rcx
+  80205f:	00 00 00 
+  802062:	ff d1                	call   *%rcx
+    if (es->sa.sa_handler == SIG_DFL) {
+  802064:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802068:	48 85 c0             	test   %rax,%rax
+  80206b:	74 57                	je     8020c4 <_generic_signal_handler+0xa2>
+    if (es->sa.sa_handler == SIG_IGN) {
+  80206d:	48 83 f8 01          	cmp    $0x1,%rax
+  802071:	0f 84 c0 00 00 00    	je     802137 <_generic_signal_handler+0x115>
+    if (es->sa.sa_flags & SA_SIGINFO) {
+  802077:	f6 43 14 04          	testb  $0x4,0x14(%rbx)
+  80207b:	0f 84 ea 00 00 00    	je     80216b <_generic_signal_handler+0x149>
+        (es->sa.sa_sigaction)(es->signo, &(es->info), utf);
+  802081:	48 8d 73 18          	lea    0x18(%rbx),%rsi
+  802085:	8b 3b                	mov    (%rbx),%edi
+  802087:	4c 89 e2             	mov    %r12,%rdx
+  80208a:	ff d0                	call   *%rax
+
+    _generic_signal_handler_impl(utf, es);
+
+    if (trace_signals)
+        cprintf("signals: env %x: end generic handler for %d\n", sys_getenvid(), es->signo);
+  80208c:	8b 1b                	mov    (%rbx),%ebx
+  80208e:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  802095:	00 00 00 
+  802098:	ff d0                	call   *%rax
+  80209a:	89 c6                	mov    %eax,%esi
+  80209c:	89 da                	mov    %ebx,%edx
+  80209e:	48 bf 80 35 80 00 00 	movabs $0x803580,%rdi
+  8020a5:	00 00 00 
+  8020a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ad:	48 b9 7a 25 80 00 00 	movabs $0x80257a,%rcx
+  8020b4:	00 00 00 
+  8020b7:	ff d1                	call   *%rcx
+}
+  8020b9:	48 83 c4 08          	add    $0x8,%rsp
+  8020bd:	5b                   	pop    %rbx
+  8020be:	41 5c                	pop    %r12
+  8020c0:	41 5d                	pop    %r13
+  8020c2:	5d                   	pop    %rbp
+  8020c3:	c3                   	ret
+            cprintf("signals: env %x: exiting due to signal %d\n", sys_getenvid(), es->signo);
+  8020c4:	8b 1b                	mov    (%rbx),%ebx
+  8020c6:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  8020cd:	00 00 00 
+  8020d0:	ff d0                	call   *%rax
+  8020d2:	89 c6                	mov    %eax,%esi
+  8020d4:	89 da                	mov    %ebx,%edx
+  8020d6:	48 bf 28 35 80 00 00 	movabs $0x803528,%rdi
+  8020dd:	00 00 00 
+  8020e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e5:	48 b9 7a 25 80 00 00 	movabs $0x80257a,%rcx
+  8020ec:	00 00 00 
+  8020ef:	ff d1                	call   *%rcx
+        sys_env_destroy(CURENVID);
+  8020f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020f6:	48 b8 09 07 80 00 00 	movabs $0x800709,%rax
+  8020fd:	00 00 00 
+  802100:	ff d0                	call   *%rax
+        assert(false);
+  802102:	48 b9 ad 35 80 00 00 	movabs $0x8035ad,%rcx
+  802109:	00 00 00 
+  80210c:	48 ba a7 34 80 00 00 	movabs $0x8034a7,%rdx
+  802113:	00 00 00 
+  802116:	be 0c 00 00 00       	mov    $0xc,%esi
+  80211b:	48 bf b3 35 80 00 00 	movabs $0x8035b3,%rdi
+  802122:	00 00 00 
+  802125:	b8 00 00 00 00       	mov    $0x0,%eax
+  80212a:	49 b8 2a 24 80 00 00 	movabs $0x80242a,%r8
+  802131:	00 00 00 
+  802134:	41 ff d0             	call   *%r8
+            cprintf("signals: env %x: ignoring signal %d\n", sys_getenvid(), es->signo);
+  802137:	44 8b 23             	mov    (%rbx),%r12d
+  80213a:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  802141:	00 00 00 
+  802144:	ff d0                	call   *%rax
+  802146:	89 c6                	mov    %eax,%esi
+  802148:	44 89 e2             	mov    %r12d,%edx
+  80214b:	48 bf 58 35 80 00 00 	movabs $0x803558,%rdi
+  802152:	00 00 00 
+  802155:	b8 00 00 00 00       	mov    $0x0,%eax
+  80215a:	48 b9 7a 25 80 00 00 	movabs $0x80257a,%rcx
+  802161:	00 00 00 
+  802164:	ff d1                	call   *%rcx
+        return;
+  802166:	e9 21 ff ff ff       	jmp    80208c <_generic_signal_handler+0x6a>
+        (es->sa.sa_handler)(es->signo);
+  80216b:	8b 3b                	mov    (%rbx),%edi
+  80216d:	ff d0                	call   *%rax
+  80216f:	e9 18 ff ff ff       	jmp    80208c <_generic_signal_handler+0x6a>
+
+0000000000802174 <sigqueue>:
+
+int sigqueue(pid_t pid, int signo, const union sigval value) {
+  802174:	55                   	push   %rbp
+  802175:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigqueue(pid, signo, value);
+  802178:	48 b8 38 0c 80 00 00 	movabs $0x800c38,%rax
+  80217f:	00 00 00 
+  802182:	ff d0                	call   *%rax
+}
+  802184:	5d                   	pop    %rbp
+  802185:	c3                   	ret
+
+0000000000802186 <sigwait>:
+
+int sigwait(const sigset_t * set, int * sig) {
+  802186:	55                   	push   %rbp
+  802187:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigwait(set, sig);
+  80218a:	48 b8 9f 0c 80 00 00 	movabs $0x800c9f,%rax
+  802191:	00 00 00 
+  802194:	ff d0                	call   *%rax
+}
+  802196:	5d                   	pop    %rbp
+  802197:	c3                   	ret
+
+0000000000802198 <sigaction>:
+
+extern void _signal_handler_trampoline(void);
+
+int sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  802198:	55                   	push   %rbp
+  802199:	48 89 e5             	mov    %rsp,%rbp
+  80219c:	41 55                	push   %r13
+  80219e:	41 54                	push   %r12
+  8021a0:	53                   	push   %rbx
+  8021a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8021a5:	89 fb                	mov    %edi,%ebx
+  8021a7:	49 89 f4             	mov    %rsi,%r12
+  8021aa:	49 89 d5             	mov    %rdx,%r13
+    int err = sys_env_set_pgfault_upcall(CURENVID, _signal_handler_trampoline);
+  8021ad:	48 be 61 2e 80 00 00 	movabs $0x802e61,%rsi
+  8021b4:	00 00 00 
+  8021b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021bc:	48 b8 09 0b 80 00 00 	movabs $0x800b09,%rax
+  8021c3:	00 00 00 
+  8021c6:	ff d0                	call   *%rax
+    if (err)
+  8021c8:	85 c0                	test   %eax,%eax
+  8021ca:	74 0b                	je     8021d7 <sigaction+0x3f>
+        return err;
+    return sys_sigaction(sig, act, oact);
+}
+  8021cc:	48 83 c4 08          	add    $0x8,%rsp
+  8021d0:	5b                   	pop    %rbx
+  8021d1:	41 5c                	pop    %r12
+  8021d3:	41 5d                	pop    %r13
+  8021d5:	5d                   	pop    %rbp
+  8021d6:	c3                   	ret
+    return sys_sigaction(sig, act, oact);
+  8021d7:	4c 89 ea             	mov    %r13,%rdx
+  8021da:	4c 89 e6             	mov    %r12,%rsi
+  8021dd:	89 df                	mov    %ebx,%edi
+  8021df:	48 b8 08 0d 80 00 00 	movabs $0x800d08,%rax
+  8021e6:	00 00 00 
+  8021e9:	ff d0                	call   *%rax
+  8021eb:	eb df                	jmp    8021cc <sigaction+0x34>
+
+00000000008021ed <sigprocmask>:
+
+int sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8021ed:	55                   	push   %rbp
+  8021ee:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigprocmask(how, set, oldset);
+  8021f1:	48 b8 6f 0d 80 00 00 	movabs $0x800d6f,%rax
+  8021f8:	00 00 00 
+  8021fb:	ff d0                	call   *%rax
+}
+  8021fd:	5d                   	pop    %rbp
+  8021fe:	c3                   	ret
+
+00000000008021ff <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8021ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802204:	c3                   	ret
+
+0000000000802205 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802205:	55                   	push   %rbp
+  802206:	48 89 e5             	mov    %rsp,%rbp
+  802209:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80220c:	48 be c0 35 80 00 00 	movabs $0x8035c0,%rsi
+  802213:	00 00 00 
+  802216:	48 b8 84 02 80 00 00 	movabs $0x800284,%rax
+  80221d:	00 00 00 
+  802220:	ff d0                	call   *%rax
+    return 0;
+}
+  802222:	b8 00 00 00 00       	mov    $0x0,%eax
+  802227:	5d                   	pop    %rbp
+  802228:	c3                   	ret
+
+0000000000802229 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802229:	55                   	push   %rbp
+  80222a:	48 89 e5             	mov    %rsp,%rbp
+  80222d:	41 57                	push   %r15
+  80222f:	41 56                	push   %r14
+  802231:	41 55                	push   %r13
+  802233:	41 54                	push   %r12
+  802235:	53                   	push   %rbx
+  802236:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80223d:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802244:	48 85 d2             	test   %rdx,%rdx
+  802247:	74 7a                	je     8022c3 <devcons_write+0x9a>
+  802249:	49 89 d6             	mov    %rdx,%r14
+  80224c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802252:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802257:	49 bf 7e 04 80 00 00 	movabs $0x80047e,%r15
+  80225e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802261:	4c 89 f3             	mov    %r14,%rbx
+  802264:	48 29 f3             	sub    %rsi,%rbx
+  802267:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80226c:	48 39 c3             	cmp    %rax,%rbx
+  80226f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802273:	4c 63 eb             	movslq %ebx,%r13
+  802276:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80227d:	48 01 c6             	add    %rax,%rsi
+  802280:	4c 89 ea             	mov    %r13,%rdx
+  802283:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80228a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80228d:	4c 89 ee             	mov    %r13,%rsi
+  802290:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802297:	48 b8 ab 06 80 00 00 	movabs $0x8006ab,%rax
+  80229e:	00 00 00 
+  8022a1:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8022a3:	41 01 dc             	add    %ebx,%r12d
+  8022a6:	49 63 f4             	movslq %r12d,%rsi
+  8022a9:	4c 39 f6             	cmp    %r14,%rsi
+  8022ac:	72 b3                	jb     802261 <devcons_write+0x38>
+    return res;
+  8022ae:	49 63 c4             	movslq %r12d,%rax
+}
+  8022b1:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8022b8:	5b                   	pop    %rbx
+  8022b9:	41 5c                	pop    %r12
+  8022bb:	41 5d                	pop    %r13
+  8022bd:	41 5e                	pop    %r14
+  8022bf:	41 5f                	pop    %r15
+  8022c1:	5d                   	pop    %rbp
+  8022c2:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8022c3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8022c9:	eb e3                	jmp    8022ae <devcons_write+0x85>
+
+00000000008022cb <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8022cb:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8022ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d3:	48 85 c0             	test   %rax,%rax
+  8022d6:	74 55                	je     80232d <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8022d8:	55                   	push   %rbp
+  8022d9:	48 89 e5             	mov    %rsp,%rbp
+  8022dc:	41 55                	push   %r13
+  8022de:	41 54                	push   %r12
+  8022e0:	53                   	push   %rbx
+  8022e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8022e5:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8022e8:	48 bb d8 06 80 00 00 	movabs $0x8006d8,%rbx
+  8022ef:	00 00 00 
+  8022f2:	49 bc a5 07 80 00 00 	movabs $0x8007a5,%r12
+  8022f9:	00 00 00 
+  8022fc:	eb 03                	jmp    802301 <devcons_read+0x36>
+  8022fe:	41 ff d4             	call   *%r12
+  802301:	ff d3                	call   *%rbx
+  802303:	85 c0                	test   %eax,%eax
+  802305:	74 f7                	je     8022fe <devcons_read+0x33>
+    if (c < 0) return c;
+  802307:	48 63 d0             	movslq %eax,%rdx
+  80230a:	78 13                	js     80231f <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80230c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802311:	83 f8 04             	cmp    $0x4,%eax
+  802314:	74 09                	je     80231f <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802316:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80231a:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80231f:	48 89 d0             	mov    %rdx,%rax
+  802322:	48 83 c4 08          	add    $0x8,%rsp
+  802326:	5b                   	pop    %rbx
+  802327:	41 5c                	pop    %r12
+  802329:	41 5d                	pop    %r13
+  80232b:	5d                   	pop    %rbp
+  80232c:	c3                   	ret
+  80232d:	48 89 d0             	mov    %rdx,%rax
+  802330:	c3                   	ret
+
+0000000000802331 <cputchar>:
+cputchar(int ch) {
+  802331:	55                   	push   %rbp
+  802332:	48 89 e5             	mov    %rsp,%rbp
+  802335:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802339:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80233d:	be 01 00 00 00       	mov    $0x1,%esi
+  802342:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802346:	48 b8 ab 06 80 00 00 	movabs $0x8006ab,%rax
+  80234d:	00 00 00 
+  802350:	ff d0                	call   *%rax
+}
+  802352:	c9                   	leave
+  802353:	c3                   	ret
+
+0000000000802354 <getchar>:
+getchar(void) {
+  802354:	55                   	push   %rbp
+  802355:	48 89 e5             	mov    %rsp,%rbp
+  802358:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80235c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802361:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802365:	bf 00 00 00 00       	mov    $0x0,%edi
+  80236a:	48 b8 47 11 80 00 00 	movabs $0x801147,%rax
+  802371:	00 00 00 
+  802374:	ff d0                	call   *%rax
+  802376:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802378:	85 c0                	test   %eax,%eax
+  80237a:	78 06                	js     802382 <getchar+0x2e>
+  80237c:	74 08                	je     802386 <getchar+0x32>
+  80237e:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802382:	89 d0                	mov    %edx,%eax
+  802384:	c9                   	leave
+  802385:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802386:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80238b:	eb f5                	jmp    802382 <getchar+0x2e>
+
+000000000080238d <iscons>:
+iscons(int fdnum) {
+  80238d:	55                   	push   %rbp
+  80238e:	48 89 e5             	mov    %rsp,%rbp
+  802391:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802395:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802399:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  8023a0:	00 00 00 
+  8023a3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023a5:	85 c0                	test   %eax,%eax
+  8023a7:	78 18                	js     8023c1 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8023a9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8023ad:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  8023b4:	00 00 00 
+  8023b7:	8b 00                	mov    (%rax),%eax
+  8023b9:	39 02                	cmp    %eax,(%rdx)
+  8023bb:	0f 94 c0             	sete   %al
+  8023be:	0f b6 c0             	movzbl %al,%eax
+}
+  8023c1:	c9                   	leave
+  8023c2:	c3                   	ret
+
+00000000008023c3 <opencons>:
+opencons(void) {
+  8023c3:	55                   	push   %rbp
+  8023c4:	48 89 e5             	mov    %rsp,%rbp
+  8023c7:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8023cb:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8023cf:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  8023d6:	00 00 00 
+  8023d9:	ff d0                	call   *%rax
+  8023db:	85 c0                	test   %eax,%eax
+  8023dd:	78 49                	js     802428 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8023df:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8023e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023e9:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8023ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023f2:	48 b8 34 08 80 00 00 	movabs $0x800834,%rax
+  8023f9:	00 00 00 
+  8023fc:	ff d0                	call   *%rax
+  8023fe:	85 c0                	test   %eax,%eax
+  802400:	78 26                	js     802428 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802402:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802406:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  80240d:	00 00 
+  80240f:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802411:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802415:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80241c:	48 b8 d6 0d 80 00 00 	movabs $0x800dd6,%rax
+  802423:	00 00 00 
+  802426:	ff d0                	call   *%rax
+}
+  802428:	c9                   	leave
+  802429:	c3                   	ret
+
+000000000080242a <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80242a:	55                   	push   %rbp
+  80242b:	48 89 e5             	mov    %rsp,%rbp
+  80242e:	41 56                	push   %r14
+  802430:	41 55                	push   %r13
+  802432:	41 54                	push   %r12
+  802434:	53                   	push   %rbx
+  802435:	48 83 ec 50          	sub    $0x50,%rsp
+  802439:	49 89 fc             	mov    %rdi,%r12
+  80243c:	41 89 f5             	mov    %esi,%r13d
+  80243f:	48 89 d3             	mov    %rdx,%rbx
+  802442:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802446:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80244a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80244e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802455:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802459:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80245d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802461:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802465:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80246c:	00 00 00 
+  80246f:	4c 8b 30             	mov    (%rax),%r14
+  802472:	48 b8 74 07 80 00 00 	movabs $0x800774,%rax
+  802479:	00 00 00 
+  80247c:	ff d0                	call   *%rax
+  80247e:	89 c6                	mov    %eax,%esi
+  802480:	45 89 e8             	mov    %r13d,%r8d
+  802483:	4c 89 e1             	mov    %r12,%rcx
+  802486:	4c 89 f2             	mov    %r14,%rdx
+  802489:	48 bf d0 35 80 00 00 	movabs $0x8035d0,%rdi
+  802490:	00 00 00 
+  802493:	b8 00 00 00 00       	mov    $0x0,%eax
+  802498:	49 bc 7a 25 80 00 00 	movabs $0x80257a,%r12
+  80249f:	00 00 00 
+  8024a2:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8024a5:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8024a9:	48 89 df             	mov    %rbx,%rdi
+  8024ac:	48 b8 16 25 80 00 00 	movabs $0x802516,%rax
+  8024b3:	00 00 00 
+  8024b6:	ff d0                	call   *%rax
+    cprintf("\n");
+  8024b8:	48 bf 4b 34 80 00 00 	movabs $0x80344b,%rdi
+  8024bf:	00 00 00 
+  8024c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c7:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8024ca:	cc                   	int3
+  8024cb:	eb fd                	jmp    8024ca <_panic+0xa0>
+
+00000000008024cd <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8024cd:	55                   	push   %rbp
+  8024ce:	48 89 e5             	mov    %rsp,%rbp
+  8024d1:	53                   	push   %rbx
+  8024d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8024d6:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8024d9:	8b 06                	mov    (%rsi),%eax
+  8024db:	8d 50 01             	lea    0x1(%rax),%edx
+  8024de:	89 16                	mov    %edx,(%rsi)
+  8024e0:	48 98                	cltq
+  8024e2:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8024e7:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8024ed:	74 0a                	je     8024f9 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8024ef:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8024f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024f7:	c9                   	leave
+  8024f8:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8024f9:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8024fd:	be ff 00 00 00       	mov    $0xff,%esi
+  802502:	48 b8 ab 06 80 00 00 	movabs $0x8006ab,%rax
+  802509:	00 00 00 
+  80250c:	ff d0                	call   *%rax
+        state->offset = 0;
+  80250e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802514:	eb d9                	jmp    8024ef <putch+0x22>
+
+0000000000802516 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802516:	55                   	push   %rbp
+  802517:	48 89 e5             	mov    %rsp,%rbp
+  80251a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802521:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802524:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80252b:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802530:	b8 00 00 00 00       	mov    $0x0,%eax
+  802535:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802538:	48 89 f1             	mov    %rsi,%rcx
+  80253b:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802542:	48 bf cd 24 80 00 00 	movabs $0x8024cd,%rdi
+  802549:	00 00 00 
+  80254c:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  802553:	00 00 00 
+  802556:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802558:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80255f:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802566:	48 b8 ab 06 80 00 00 	movabs $0x8006ab,%rax
+  80256d:	00 00 00 
+  802570:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802572:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802578:	c9                   	leave
+  802579:	c3                   	ret
+
+000000000080257a <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80257a:	55                   	push   %rbp
+  80257b:	48 89 e5             	mov    %rsp,%rbp
+  80257e:	48 83 ec 50          	sub    $0x50,%rsp
+  802582:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802586:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80258a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80258e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802592:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802596:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80259d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8025a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025a5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8025a9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8025ad:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8025b1:	48 b8 16 25 80 00 00 	movabs $0x802516,%rax
+  8025b8:	00 00 00 
+  8025bb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8025bd:	c9                   	leave
+  8025be:	c3                   	ret
+
+00000000008025bf <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8025bf:	55                   	push   %rbp
+  8025c0:	48 89 e5             	mov    %rsp,%rbp
+  8025c3:	41 57                	push   %r15
+  8025c5:	41 56                	push   %r14
+  8025c7:	41 55                	push   %r13
+  8025c9:	41 54                	push   %r12
+  8025cb:	53                   	push   %rbx
+  8025cc:	48 83 ec 18          	sub    $0x18,%rsp
+  8025d0:	49 89 fc             	mov    %rdi,%r12
+  8025d3:	49 89 f5             	mov    %rsi,%r13
+  8025d6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8025da:	8b 45 10             	mov    0x10(%rbp),%eax
+  8025dd:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8025e0:	41 89 cf             	mov    %ecx,%r15d
+  8025e3:	4c 39 fa             	cmp    %r15,%rdx
+  8025e6:	73 5b                	jae    802643 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8025e8:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8025ec:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8025f0:	85 db                	test   %ebx,%ebx
+  8025f2:	7e 0e                	jle    802602 <print_num+0x43>
+            putch(padc, put_arg);
+  8025f4:	4c 89 ee             	mov    %r13,%rsi
+  8025f7:	44 89 f7             	mov    %r14d,%edi
+  8025fa:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8025fd:	83 eb 01             	sub    $0x1,%ebx
+  802600:	75 f2                	jne    8025f4 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802602:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802606:	48 b9 04 36 80 00 00 	movabs $0x803604,%rcx
+  80260d:	00 00 00 
+  802610:	48 b8 f3 35 80 00 00 	movabs $0x8035f3,%rax
+  802617:	00 00 00 
+  80261a:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80261e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802622:	ba 00 00 00 00       	mov    $0x0,%edx
+  802627:	49 f7 f7             	div    %r15
+  80262a:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80262e:	4c 89 ee             	mov    %r13,%rsi
+  802631:	41 ff d4             	call   *%r12
+}
+  802634:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802638:	5b                   	pop    %rbx
+  802639:	41 5c                	pop    %r12
+  80263b:	41 5d                	pop    %r13
+  80263d:	41 5e                	pop    %r14
+  80263f:	41 5f                	pop    %r15
+  802641:	5d                   	pop    %rbp
+  802642:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802643:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802647:	ba 00 00 00 00       	mov    $0x0,%edx
+  80264c:	49 f7 f7             	div    %r15
+  80264f:	48 83 ec 08          	sub    $0x8,%rsp
+  802653:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802657:	52                   	push   %rdx
+  802658:	45 0f be c9          	movsbl %r9b,%r9d
+  80265c:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802660:	48 89 c2             	mov    %rax,%rdx
+  802663:	48 b8 bf 25 80 00 00 	movabs $0x8025bf,%rax
+  80266a:	00 00 00 
+  80266d:	ff d0                	call   *%rax
+  80266f:	48 83 c4 10          	add    $0x10,%rsp
+  802673:	eb 8d                	jmp    802602 <print_num+0x43>
+
+0000000000802675 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802675:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  802679:	48 8b 06             	mov    (%rsi),%rax
+  80267c:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802680:	73 0a                	jae    80268c <sprintputch+0x17>
+        *state->start++ = ch;
+  802682:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802686:	48 89 16             	mov    %rdx,(%rsi)
+  802689:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80268c:	c3                   	ret
+
+000000000080268d <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80268d:	55                   	push   %rbp
+  80268e:	48 89 e5             	mov    %rsp,%rbp
+  802691:	48 83 ec 50          	sub    $0x50,%rsp
+  802695:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802699:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80269d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8026a1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8026a8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8026ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026b0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8026b4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8026b8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8026bc:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  8026c3:	00 00 00 
+  8026c6:	ff d0                	call   *%rax
+}
+  8026c8:	c9                   	leave
+  8026c9:	c3                   	ret
+
+00000000008026ca <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8026ca:	55                   	push   %rbp
+  8026cb:	48 89 e5             	mov    %rsp,%rbp
+  8026ce:	41 57                	push   %r15
+  8026d0:	41 56                	push   %r14
+  8026d2:	41 55                	push   %r13
+  8026d4:	41 54                	push   %r12
+  8026d6:	53                   	push   %rbx
+  8026d7:	48 83 ec 38          	sub    $0x38,%rsp
+  8026db:	49 89 fe             	mov    %rdi,%r14
+  8026de:	49 89 f5             	mov    %rsi,%r13
+  8026e1:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8026e4:	48 8b 01             	mov    (%rcx),%rax
+  8026e7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8026eb:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8026ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026f3:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8026f7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8026fb:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8026ff:	0f b6 3b             	movzbl (%rbx),%edi
+  802702:	40 80 ff 25          	cmp    $0x25,%dil
+  802706:	74 18                	je     802720 <vprintfmt+0x56>
+            if (!ch) return;
+  802708:	40 84 ff             	test   %dil,%dil
+  80270b:	0f 84 b1 06 00 00    	je     802dc2 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802711:	40 0f b6 ff          	movzbl %dil,%edi
+  802715:	4c 89 ee             	mov    %r13,%rsi
+  802718:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80271b:	4c 89 e3             	mov    %r12,%rbx
+  80271e:	eb db                	jmp    8026fb <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802720:	be 00 00 00 00       	mov    $0x0,%esi
+  802725:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802729:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80272e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802734:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80273b:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80273f:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802744:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802749:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80274c:	83 e8 23             	sub    $0x23,%eax
+  80274f:	3c 57                	cmp    $0x57,%al
+  802751:	0f 87 51 06 00 00    	ja     802da8 <vprintfmt+0x6de>
+  802757:	0f b6 c0             	movzbl %al,%eax
+  80275a:	48 b9 a0 37 80 00 00 	movabs $0x8037a0,%rcx
+  802761:	00 00 00 
+  802764:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802767:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80276a:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80276e:	eb cf                	jmp    80273f <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  802770:	49 89 dc             	mov    %rbx,%r12
+  802773:	be 01 00 00 00       	mov    $0x1,%esi
+  802778:	eb c5                	jmp    80273f <vprintfmt+0x75>
+            padc = ch;
+  80277a:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80277e:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802781:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802784:	eb b9                	jmp    80273f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802786:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802789:	83 f8 2f             	cmp    $0x2f,%eax
+  80278c:	77 24                	ja     8027b2 <vprintfmt+0xe8>
+  80278e:	89 c1                	mov    %eax,%ecx
+  802790:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802794:	83 c0 08             	add    $0x8,%eax
+  802797:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80279a:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80279d:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8027a0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8027a4:	79 99                	jns    80273f <vprintfmt+0x75>
+                width = precision;
+  8027a6:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8027aa:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8027b0:	eb 8d                	jmp    80273f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8027b2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8027b6:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8027ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027be:	eb da                	jmp    80279a <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8027c0:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8027c5:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8027c9:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8027cf:	3c 39                	cmp    $0x39,%al
+  8027d1:	77 1c                	ja     8027ef <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8027d3:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8027d7:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8027db:	0f b6 c0             	movzbl %al,%eax
+  8027de:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8027e3:	0f b6 03             	movzbl (%rbx),%eax
+  8027e6:	3c 39                	cmp    $0x39,%al
+  8027e8:	76 e9                	jbe    8027d3 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8027ea:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8027ed:	eb b1                	jmp    8027a0 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8027ef:	49 89 dc             	mov    %rbx,%r12
+  8027f2:	eb ac                	jmp    8027a0 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8027f4:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8027f7:	85 c9                	test   %ecx,%ecx
+  8027f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027fe:	0f 49 c1             	cmovns %ecx,%eax
+  802801:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802804:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802807:	e9 33 ff ff ff       	jmp    80273f <vprintfmt+0x75>
+            lflag++;
+  80280c:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80280f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802812:	e9 28 ff ff ff       	jmp    80273f <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802817:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80281a:	83 f8 2f             	cmp    $0x2f,%eax
+  80281d:	77 19                	ja     802838 <vprintfmt+0x16e>
+  80281f:	89 c2                	mov    %eax,%edx
+  802821:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802825:	83 c0 08             	add    $0x8,%eax
+  802828:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80282b:	8b 3a                	mov    (%rdx),%edi
+  80282d:	4c 89 ee             	mov    %r13,%rsi
+  802830:	41 ff d6             	call   *%r14
+            break;
+  802833:	e9 c3 fe ff ff       	jmp    8026fb <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802838:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80283c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802840:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802844:	eb e5                	jmp    80282b <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802846:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802849:	83 f8 2f             	cmp    $0x2f,%eax
+  80284c:	77 5a                	ja     8028a8 <vprintfmt+0x1de>
+  80284e:	89 c2                	mov    %eax,%edx
+  802850:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802854:	83 c0 08             	add    $0x8,%eax
+  802857:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80285a:	8b 02                	mov    (%rdx),%eax
+  80285c:	89 c1                	mov    %eax,%ecx
+  80285e:	f7 d9                	neg    %ecx
+  802860:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802863:	83 f9 15             	cmp    $0x15,%ecx
+  802866:	7f 4e                	jg     8028b6 <vprintfmt+0x1ec>
+  802868:	48 63 c1             	movslq %ecx,%rax
+  80286b:	48 ba 60 3a 80 00 00 	movabs $0x803a60,%rdx
+  802872:	00 00 00 
+  802875:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802879:	48 85 c0             	test   %rax,%rax
+  80287c:	74 38                	je     8028b6 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80287e:	48 89 c1             	mov    %rax,%rcx
+  802881:	48 ba b9 34 80 00 00 	movabs $0x8034b9,%rdx
+  802888:	00 00 00 
+  80288b:	4c 89 ee             	mov    %r13,%rsi
+  80288e:	4c 89 f7             	mov    %r14,%rdi
+  802891:	b8 00 00 00 00       	mov    $0x0,%eax
+  802896:	49 b8 8d 26 80 00 00 	movabs $0x80268d,%r8
+  80289d:	00 00 00 
+  8028a0:	41 ff d0             	call   *%r8
+  8028a3:	e9 53 fe ff ff       	jmp    8026fb <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8028a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8028ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8028b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028b4:	eb a4                	jmp    80285a <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8028b6:	48 ba 1c 36 80 00 00 	movabs $0x80361c,%rdx
+  8028bd:	00 00 00 
+  8028c0:	4c 89 ee             	mov    %r13,%rsi
+  8028c3:	4c 89 f7             	mov    %r14,%rdi
+  8028c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028cb:	49 b8 8d 26 80 00 00 	movabs $0x80268d,%r8
+  8028d2:	00 00 00 
+  8028d5:	41 ff d0             	call   *%r8
+  8028d8:	e9 1e fe ff ff       	jmp    8026fb <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8028dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8028e3:	77 6c                	ja     802951 <vprintfmt+0x287>
+  8028e5:	89 c2                	mov    %eax,%edx
+  8028e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8028eb:	83 c0 08             	add    $0x8,%eax
+  8028ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8028f1:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8028f4:	48 85 d2             	test   %rdx,%rdx
+  8028f7:	48 b8 15 36 80 00 00 	movabs $0x803615,%rax
+  8028fe:	00 00 00 
+  802901:	48 0f 45 c2          	cmovne %rdx,%rax
+  802905:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  802909:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80290d:	7e 06                	jle    802915 <vprintfmt+0x24b>
+  80290f:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802913:	75 4a                	jne    80295f <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802915:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802919:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80291d:	0f b6 00             	movzbl (%rax),%eax
+  802920:	84 c0                	test   %al,%al
+  802922:	0f 85 9a 00 00 00    	jne    8029c2 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  802928:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80292b:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80292f:	85 c0                	test   %eax,%eax
+  802931:	0f 8e c4 fd ff ff    	jle    8026fb <vprintfmt+0x31>
+  802937:	4c 89 ee             	mov    %r13,%rsi
+  80293a:	bf 20 00 00 00       	mov    $0x20,%edi
+  80293f:	41 ff d6             	call   *%r14
+  802942:	41 83 ec 01          	sub    $0x1,%r12d
+  802946:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80294a:	75 eb                	jne    802937 <vprintfmt+0x26d>
+  80294c:	e9 aa fd ff ff       	jmp    8026fb <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802951:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802955:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802959:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80295d:	eb 92                	jmp    8028f1 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80295f:	49 63 f7             	movslq %r15d,%rsi
+  802962:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802966:	48 b8 61 02 80 00 00 	movabs $0x800261,%rax
+  80296d:	00 00 00 
+  802970:	ff d0                	call   *%rax
+  802972:	48 89 c2             	mov    %rax,%rdx
+  802975:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802978:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80297a:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80297d:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802980:	85 c0                	test   %eax,%eax
+  802982:	7e 91                	jle    802915 <vprintfmt+0x24b>
+  802984:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802989:	4c 89 ee             	mov    %r13,%rsi
+  80298c:	44 89 e7             	mov    %r12d,%edi
+  80298f:	41 ff d6             	call   *%r14
+  802992:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802996:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802999:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80299c:	75 eb                	jne    802989 <vprintfmt+0x2bf>
+  80299e:	e9 72 ff ff ff       	jmp    802915 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8029a3:	0f b6 f8             	movzbl %al,%edi
+  8029a6:	4c 89 ee             	mov    %r13,%rsi
+  8029a9:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8029ac:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8029b0:	49 83 c4 01          	add    $0x1,%r12
+  8029b4:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8029ba:	84 c0                	test   %al,%al
+  8029bc:	0f 84 66 ff ff ff    	je     802928 <vprintfmt+0x25e>
+  8029c2:	45 85 ff             	test   %r15d,%r15d
+  8029c5:	78 0a                	js     8029d1 <vprintfmt+0x307>
+  8029c7:	41 83 ef 01          	sub    $0x1,%r15d
+  8029cb:	0f 88 57 ff ff ff    	js     802928 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8029d1:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8029d5:	74 cc                	je     8029a3 <vprintfmt+0x2d9>
+  8029d7:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8029da:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8029df:	80 fa 5e             	cmp    $0x5e,%dl
+  8029e2:	77 c2                	ja     8029a6 <vprintfmt+0x2dc>
+  8029e4:	eb bd                	jmp    8029a3 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8029e6:	40 84 f6             	test   %sil,%sil
+  8029e9:	75 26                	jne    802a11 <vprintfmt+0x347>
+    switch (lflag) {
+  8029eb:	85 d2                	test   %edx,%edx
+  8029ed:	74 59                	je     802a48 <vprintfmt+0x37e>
+  8029ef:	83 fa 01             	cmp    $0x1,%edx
+  8029f2:	74 7b                	je     802a6f <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8029f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8029f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8029fa:	0f 87 96 00 00 00    	ja     802a96 <vprintfmt+0x3cc>
+  802a00:	89 c2                	mov    %eax,%edx
+  802a02:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802a06:	83 c0 08             	add    $0x8,%eax
+  802a09:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802a0c:	4c 8b 22             	mov    (%rdx),%r12
+  802a0f:	eb 17                	jmp    802a28 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802a11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a14:	83 f8 2f             	cmp    $0x2f,%eax
+  802a17:	77 21                	ja     802a3a <vprintfmt+0x370>
+  802a19:	89 c2                	mov    %eax,%edx
+  802a1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802a1f:	83 c0 08             	add    $0x8,%eax
+  802a22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802a25:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802a28:	4d 85 e4             	test   %r12,%r12
+  802a2b:	78 7a                	js     802aa7 <vprintfmt+0x3dd>
+            num = i;
+  802a2d:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802a30:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802a35:	e9 50 02 00 00       	jmp    802c8a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802a3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a46:	eb dd                	jmp    802a25 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802a48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a4b:	83 f8 2f             	cmp    $0x2f,%eax
+  802a4e:	77 11                	ja     802a61 <vprintfmt+0x397>
+  802a50:	89 c2                	mov    %eax,%edx
+  802a52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802a56:	83 c0 08             	add    $0x8,%eax
+  802a59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802a5c:	4c 63 22             	movslq (%rdx),%r12
+  802a5f:	eb c7                	jmp    802a28 <vprintfmt+0x35e>
+  802a61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a6d:	eb ed                	jmp    802a5c <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802a6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a72:	83 f8 2f             	cmp    $0x2f,%eax
+  802a75:	77 11                	ja     802a88 <vprintfmt+0x3be>
+  802a77:	89 c2                	mov    %eax,%edx
+  802a79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802a7d:	83 c0 08             	add    $0x8,%eax
+  802a80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802a83:	4c 8b 22             	mov    (%rdx),%r12
+  802a86:	eb a0                	jmp    802a28 <vprintfmt+0x35e>
+  802a88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a94:	eb ed                	jmp    802a83 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802a96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802aa2:	e9 65 ff ff ff       	jmp    802a0c <vprintfmt+0x342>
+                putch('-', put_arg);
+  802aa7:	4c 89 ee             	mov    %r13,%rsi
+  802aaa:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802aaf:	41 ff d6             	call   *%r14
+                i = -i;
+  802ab2:	49 f7 dc             	neg    %r12
+  802ab5:	e9 73 ff ff ff       	jmp    802a2d <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802aba:	40 84 f6             	test   %sil,%sil
+  802abd:	75 32                	jne    802af1 <vprintfmt+0x427>
+    switch (lflag) {
+  802abf:	85 d2                	test   %edx,%edx
+  802ac1:	74 5d                	je     802b20 <vprintfmt+0x456>
+  802ac3:	83 fa 01             	cmp    $0x1,%edx
+  802ac6:	0f 84 82 00 00 00    	je     802b4e <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802acc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802acf:	83 f8 2f             	cmp    $0x2f,%eax
+  802ad2:	0f 87 a5 00 00 00    	ja     802b7d <vprintfmt+0x4b3>
+  802ad8:	89 c2                	mov    %eax,%edx
+  802ada:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ade:	83 c0 08             	add    $0x8,%eax
+  802ae1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ae4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802ae7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802aec:	e9 99 01 00 00       	jmp    802c8a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802af1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802af4:	83 f8 2f             	cmp    $0x2f,%eax
+  802af7:	77 19                	ja     802b12 <vprintfmt+0x448>
+  802af9:	89 c2                	mov    %eax,%edx
+  802afb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802aff:	83 c0 08             	add    $0x8,%eax
+  802b02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b05:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802b08:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802b0d:	e9 78 01 00 00       	jmp    802c8a <vprintfmt+0x5c0>
+  802b12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b1e:	eb e5                	jmp    802b05 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802b20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b23:	83 f8 2f             	cmp    $0x2f,%eax
+  802b26:	77 18                	ja     802b40 <vprintfmt+0x476>
+  802b28:	89 c2                	mov    %eax,%edx
+  802b2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b2e:	83 c0 08             	add    $0x8,%eax
+  802b31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b34:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802b36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802b3b:	e9 4a 01 00 00       	jmp    802c8a <vprintfmt+0x5c0>
+  802b40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b4c:	eb e6                	jmp    802b34 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802b4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b51:	83 f8 2f             	cmp    $0x2f,%eax
+  802b54:	77 19                	ja     802b6f <vprintfmt+0x4a5>
+  802b56:	89 c2                	mov    %eax,%edx
+  802b58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b5c:	83 c0 08             	add    $0x8,%eax
+  802b5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b62:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802b65:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802b6a:	e9 1b 01 00 00       	jmp    802c8a <vprintfmt+0x5c0>
+  802b6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b7b:	eb e5                	jmp    802b62 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802b7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b89:	e9 56 ff ff ff       	jmp    802ae4 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802b8e:	40 84 f6             	test   %sil,%sil
+  802b91:	75 2e                	jne    802bc1 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802b93:	85 d2                	test   %edx,%edx
+  802b95:	74 59                	je     802bf0 <vprintfmt+0x526>
+  802b97:	83 fa 01             	cmp    $0x1,%edx
+  802b9a:	74 7f                	je     802c1b <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802b9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b9f:	83 f8 2f             	cmp    $0x2f,%eax
+  802ba2:	0f 87 9f 00 00 00    	ja     802c47 <vprintfmt+0x57d>
+  802ba8:	89 c2                	mov    %eax,%edx
+  802baa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bae:	83 c0 08             	add    $0x8,%eax
+  802bb1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bb4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802bb7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802bbc:	e9 c9 00 00 00       	jmp    802c8a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802bc1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bc4:	83 f8 2f             	cmp    $0x2f,%eax
+  802bc7:	77 19                	ja     802be2 <vprintfmt+0x518>
+  802bc9:	89 c2                	mov    %eax,%edx
+  802bcb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bcf:	83 c0 08             	add    $0x8,%eax
+  802bd2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bd5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802bd8:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802bdd:	e9 a8 00 00 00       	jmp    802c8a <vprintfmt+0x5c0>
+  802be2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802be6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802bea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802bee:	eb e5                	jmp    802bd5 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802bf0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bf3:	83 f8 2f             	cmp    $0x2f,%eax
+  802bf6:	77 15                	ja     802c0d <vprintfmt+0x543>
+  802bf8:	89 c2                	mov    %eax,%edx
+  802bfa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bfe:	83 c0 08             	add    $0x8,%eax
+  802c01:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c04:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802c06:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802c0b:	eb 7d                	jmp    802c8a <vprintfmt+0x5c0>
+  802c0d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c11:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c19:	eb e9                	jmp    802c04 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802c1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c1e:	83 f8 2f             	cmp    $0x2f,%eax
+  802c21:	77 16                	ja     802c39 <vprintfmt+0x56f>
+  802c23:	89 c2                	mov    %eax,%edx
+  802c25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c29:	83 c0 08             	add    $0x8,%eax
+  802c2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c2f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802c32:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802c37:	eb 51                	jmp    802c8a <vprintfmt+0x5c0>
+  802c39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c45:	eb e8                	jmp    802c2f <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802c47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c53:	e9 5c ff ff ff       	jmp    802bb4 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802c58:	4c 89 ee             	mov    %r13,%rsi
+  802c5b:	bf 30 00 00 00       	mov    $0x30,%edi
+  802c60:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802c63:	4c 89 ee             	mov    %r13,%rsi
+  802c66:	bf 78 00 00 00       	mov    $0x78,%edi
+  802c6b:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802c6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c71:	83 f8 2f             	cmp    $0x2f,%eax
+  802c74:	77 47                	ja     802cbd <vprintfmt+0x5f3>
+  802c76:	89 c2                	mov    %eax,%edx
+  802c78:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c7c:	83 c0 08             	add    $0x8,%eax
+  802c7f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c82:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802c85:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802c8a:	48 83 ec 08          	sub    $0x8,%rsp
+  802c8e:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802c92:	0f 94 c0             	sete   %al
+  802c95:	0f b6 c0             	movzbl %al,%eax
+  802c98:	50                   	push   %rax
+  802c99:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802c9e:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802ca2:	4c 89 ee             	mov    %r13,%rsi
+  802ca5:	4c 89 f7             	mov    %r14,%rdi
+  802ca8:	48 b8 bf 25 80 00 00 	movabs $0x8025bf,%rax
+  802caf:	00 00 00 
+  802cb2:	ff d0                	call   *%rax
+            break;
+  802cb4:	48 83 c4 10          	add    $0x10,%rsp
+  802cb8:	e9 3e fa ff ff       	jmp    8026fb <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802cbd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cc1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cc5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cc9:	eb b7                	jmp    802c82 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802ccb:	40 84 f6             	test   %sil,%sil
+  802cce:	75 2b                	jne    802cfb <vprintfmt+0x631>
+    switch (lflag) {
+  802cd0:	85 d2                	test   %edx,%edx
+  802cd2:	74 56                	je     802d2a <vprintfmt+0x660>
+  802cd4:	83 fa 01             	cmp    $0x1,%edx
+  802cd7:	74 7f                	je     802d58 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  802cd9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cdc:	83 f8 2f             	cmp    $0x2f,%eax
+  802cdf:	0f 87 a2 00 00 00    	ja     802d87 <vprintfmt+0x6bd>
+  802ce5:	89 c2                	mov    %eax,%edx
+  802ce7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ceb:	83 c0 08             	add    $0x8,%eax
+  802cee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cf1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802cf4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802cf9:	eb 8f                	jmp    802c8a <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802cfb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cfe:	83 f8 2f             	cmp    $0x2f,%eax
+  802d01:	77 19                	ja     802d1c <vprintfmt+0x652>
+  802d03:	89 c2                	mov    %eax,%edx
+  802d05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d09:	83 c0 08             	add    $0x8,%eax
+  802d0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d0f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802d12:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802d17:	e9 6e ff ff ff       	jmp    802c8a <vprintfmt+0x5c0>
+  802d1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d28:	eb e5                	jmp    802d0f <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802d2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d2d:	83 f8 2f             	cmp    $0x2f,%eax
+  802d30:	77 18                	ja     802d4a <vprintfmt+0x680>
+  802d32:	89 c2                	mov    %eax,%edx
+  802d34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d38:	83 c0 08             	add    $0x8,%eax
+  802d3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d3e:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802d40:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802d45:	e9 40 ff ff ff       	jmp    802c8a <vprintfmt+0x5c0>
+  802d4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d56:	eb e6                	jmp    802d3e <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802d58:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d5b:	83 f8 2f             	cmp    $0x2f,%eax
+  802d5e:	77 19                	ja     802d79 <vprintfmt+0x6af>
+  802d60:	89 c2                	mov    %eax,%edx
+  802d62:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d66:	83 c0 08             	add    $0x8,%eax
+  802d69:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d6c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802d6f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802d74:	e9 11 ff ff ff       	jmp    802c8a <vprintfmt+0x5c0>
+  802d79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d85:	eb e5                	jmp    802d6c <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802d87:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d8b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d93:	e9 59 ff ff ff       	jmp    802cf1 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802d98:	4c 89 ee             	mov    %r13,%rsi
+  802d9b:	bf 25 00 00 00       	mov    $0x25,%edi
+  802da0:	41 ff d6             	call   *%r14
+            break;
+  802da3:	e9 53 f9 ff ff       	jmp    8026fb <vprintfmt+0x31>
+            putch('%', put_arg);
+  802da8:	4c 89 ee             	mov    %r13,%rsi
+  802dab:	bf 25 00 00 00       	mov    $0x25,%edi
+  802db0:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802db3:	48 83 eb 01          	sub    $0x1,%rbx
+  802db7:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802dbb:	75 f6                	jne    802db3 <vprintfmt+0x6e9>
+  802dbd:	e9 39 f9 ff ff       	jmp    8026fb <vprintfmt+0x31>
+}
+  802dc2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802dc6:	5b                   	pop    %rbx
+  802dc7:	41 5c                	pop    %r12
+  802dc9:	41 5d                	pop    %r13
+  802dcb:	41 5e                	pop    %r14
+  802dcd:	41 5f                	pop    %r15
+  802dcf:	5d                   	pop    %rbp
+  802dd0:	c3                   	ret
+
+0000000000802dd1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802dd1:	55                   	push   %rbp
+  802dd2:	48 89 e5             	mov    %rsp,%rbp
+  802dd5:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802dd9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802ddd:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802de2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802de6:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802ded:	48 85 ff             	test   %rdi,%rdi
+  802df0:	74 2b                	je     802e1d <vsnprintf+0x4c>
+  802df2:	48 85 f6             	test   %rsi,%rsi
+  802df5:	74 26                	je     802e1d <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802df7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802dfb:	48 bf 75 26 80 00 00 	movabs $0x802675,%rdi
+  802e02:	00 00 00 
+  802e05:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  802e0c:	00 00 00 
+  802e0f:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802e11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e15:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802e18:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802e1b:	c9                   	leave
+  802e1c:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802e1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e22:	eb f7                	jmp    802e1b <vsnprintf+0x4a>
+
+0000000000802e24 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802e24:	55                   	push   %rbp
+  802e25:	48 89 e5             	mov    %rsp,%rbp
+  802e28:	48 83 ec 50          	sub    $0x50,%rsp
+  802e2c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802e30:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802e34:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802e38:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802e3f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802e43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e47:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802e4b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802e4f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802e53:	48 b8 d1 2d 80 00 00 	movabs $0x802dd1,%rax
+  802e5a:	00 00 00 
+  802e5d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802e5f:	c9                   	leave
+  802e60:	c3                   	ret
+
+0000000000802e61 <_pgfault_upcall>:
+.text
+.globl _pgfault_upcall
+.globl _signal_handler_trampoline
+_pgfault_upcall:
+_signal_handler_trampoline:
+    movq  %rsp,%rdi # passing the function argument (UTrapframe *) in rdi
+  802e61:	48 89 e7             	mov    %rsp,%rdi
+    # sizeof(struct EnqueuedSignal) == 56
+    # sizeof(curenv->env_sig_mask) == 4
+    # + 4 bytes of alignment
+    add $64, %rdi
+  802e64:	48 83 c7 40          	add    $0x40,%rdi
+
+    # load signo
+    mov (%rsp), %eax
+  802e68:	8b 04 24             	mov    (%rsp),%eax
+    test %eax, %eax
+  802e6b:	85 c0                	test   %eax,%eax
+    jnz _call_generic_signal_handler
+  802e6d:	75 0e                	jne    802e7d <_call_generic_signal_handler>
+
+    # Call the C page fault handler.
+    movabs $_handle_vectored_pagefault, %rax
+  802e6f:	48 b8 a1 30 80 00 00 	movabs $0x8030a1,%rax
+  802e76:	00 00 00 
+    call *%rax
+  802e79:	ff d0                	call   *%rax
+    jmp _return_from_handler
+  802e7b:	eb 0f                	jmp    802e8c <_return_from_handler>
+
+0000000000802e7d <_call_generic_signal_handler>:
+
+_call_generic_signal_handler:
+    movq %rsp, %rsi # passing the function argument (EnqueuedSignal *) in rsi
+  802e7d:	48 89 e6             	mov    %rsp,%rsi
+    movabs $_generic_signal_handler, %rax
+  802e80:	48 b8 22 20 80 00 00 	movabs $0x802022,%rax
+  802e87:	00 00 00 
+    call *%rax
+  802e8a:	ff d0                	call   *%rax
+
+0000000000802e8c <_return_from_handler>:
+
+_return_from_handler:
+    # ignore EnqueuedSignal and env_sig_mask
+    add $64, %rsp
+  802e8c:	48 83 c4 40          	add    $0x40,%rsp
+    # put SIG_SETMASK as the first func arg
+    movq $3, %rdi
+  802e90:	48 c7 c7 03 00 00 00 	mov    $0x3,%rdi
+    # load &env_sig_mask (as the second func arg)
+    lea -4(%rsp), %rsi
+  802e97:	48 8d 74 24 fc       	lea    -0x4(%rsp),%rsi
+    # NULL as the third arg
+    xor %rdx, %rdx
+  802e9c:	48 31 d2             	xor    %rdx,%rdx
+    # restore blocked signals mask
+    movabs $sys_sigprocmask, %rax
+  802e9f:	48 b8 6f 0d 80 00 00 	movabs $0x800d6f,%rax
+  802ea6:	00 00 00 
+    call *%rax
+  802ea9:	ff d0                	call   *%rax
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    # ignore utf_fault_va, utf_err
+    addq $16, %rsp
+  802eab:	48 83 c4 10          	add    $0x10,%rsp
+    # restore utf_regs, save rax again
+    POPA
+  802eaf:	4c 8b 3c 24          	mov    (%rsp),%r15
+  802eb3:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  802eb8:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  802ebd:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  802ec2:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  802ec7:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  802ecc:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  802ed1:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  802ed6:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  802edb:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  802ee0:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  802ee5:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  802eea:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  802eef:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  802ef4:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  802ef9:	48 83 c4 78          	add    $0x78,%rsp
+    pushq %rax
+  802efd:	50                   	push   %rax
+    # 16 utf_rflags
+    #  8 utf_rip
+    #  0 rax
+
+    # load utf_rip
+    movq 8(%rsp), %rax
+  802efe:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    # save rbx to utf_rip
+    movq %rbx, 8(%rsp)
+  802f03:	48 89 5c 24 08       	mov    %rbx,0x8(%rsp)
+    # load utf_rsp
+    movq 24(%rsp), %rbx
+  802f08:	48 8b 5c 24 18       	mov    0x18(%rsp),%rbx
+    # store return address to *utf_stack
+    subq $8, 24(%rsp)
+  802f0d:	48 83 6c 24 18 08    	subq   $0x8,0x18(%rsp)
+    movq %rax, -8(%rbx)
+  802f13:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    # restore rax and rbx
+    popq %rax
+  802f17:	58                   	pop    %rax
+    popq %rbx
+  802f18:	5b                   	pop    %rbx
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+    popfq
+  802f19:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    popq %rsp
+  802f1a:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  802f1b:	c3                   	ret
+
+0000000000802f1c <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802f1c:	55                   	push   %rbp
+  802f1d:	48 89 e5             	mov    %rsp,%rbp
+  802f20:	41 54                	push   %r12
+  802f22:	53                   	push   %rbx
+  802f23:	48 89 fb             	mov    %rdi,%rbx
+  802f26:	48 89 f7             	mov    %rsi,%rdi
+  802f29:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802f2c:	48 85 f6             	test   %rsi,%rsi
+  802f2f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f36:	00 00 00 
+  802f39:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802f3d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f42:	48 b8 9e 0b 80 00 00 	movabs $0x800b9e,%rax
+  802f49:	00 00 00 
+  802f4c:	ff d0                	call   *%rax
+    if (res < 0) {
+  802f4e:	85 c0                	test   %eax,%eax
+  802f50:	78 45                	js     802f97 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802f52:	48 85 db             	test   %rbx,%rbx
+  802f55:	74 12                	je     802f69 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802f57:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f5e:	00 00 00 
+  802f61:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802f67:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802f69:	4d 85 e4             	test   %r12,%r12
+  802f6c:	74 14                	je     802f82 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802f6e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f75:	00 00 00 
+  802f78:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802f7e:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802f82:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f89:	00 00 00 
+  802f8c:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802f92:	5b                   	pop    %rbx
+  802f93:	41 5c                	pop    %r12
+  802f95:	5d                   	pop    %rbp
+  802f96:	c3                   	ret
+        if (from_env_store)
+  802f97:	48 85 db             	test   %rbx,%rbx
+  802f9a:	74 06                	je     802fa2 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802f9c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802fa2:	4d 85 e4             	test   %r12,%r12
+  802fa5:	74 eb                	je     802f92 <ipc_recv+0x76>
+            *perm_store = 0;
+  802fa7:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802fae:	00 
+  802faf:	eb e1                	jmp    802f92 <ipc_recv+0x76>
+
+0000000000802fb1 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802fb1:	55                   	push   %rbp
+  802fb2:	48 89 e5             	mov    %rsp,%rbp
+  802fb5:	41 57                	push   %r15
+  802fb7:	41 56                	push   %r14
+  802fb9:	41 55                	push   %r13
+  802fbb:	41 54                	push   %r12
+  802fbd:	53                   	push   %rbx
+  802fbe:	48 83 ec 18          	sub    $0x18,%rsp
+  802fc2:	41 89 fd             	mov    %edi,%r13d
+  802fc5:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802fc8:	48 89 d3             	mov    %rdx,%rbx
+  802fcb:	49 89 cc             	mov    %rcx,%r12
+  802fce:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802fd2:	48 85 d2             	test   %rdx,%rdx
+  802fd5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802fdc:	00 00 00 
+  802fdf:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802fe3:	49 be 72 0b 80 00 00 	movabs $0x800b72,%r14
+  802fea:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802fed:	49 bf a5 07 80 00 00 	movabs $0x8007a5,%r15
+  802ff4:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802ff7:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802ffa:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802ffe:	4c 89 e1             	mov    %r12,%rcx
+  803001:	48 89 da             	mov    %rbx,%rdx
+  803004:	44 89 ef             	mov    %r13d,%edi
+  803007:	41 ff d6             	call   *%r14
+        if (res == 0)
+  80300a:	85 c0                	test   %eax,%eax
+  80300c:	74 34                	je     803042 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  80300e:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803011:	75 05                	jne    803018 <ipc_send+0x67>
+        sys_yield();
+  803013:	41 ff d7             	call   *%r15
+    while (true) {
+  803016:	eb df                	jmp    802ff7 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  803018:	48 ba 2f 3b 80 00 00 	movabs $0x803b2f,%rdx
+  80301f:	00 00 00 
+  803022:	be 3e 00 00 00       	mov    $0x3e,%esi
+  803027:	48 bf 48 3b 80 00 00 	movabs $0x803b48,%rdi
+  80302e:	00 00 00 
+  803031:	b8 00 00 00 00       	mov    $0x0,%eax
+  803036:	48 b9 2a 24 80 00 00 	movabs $0x80242a,%rcx
+  80303d:	00 00 00 
+  803040:	ff d1                	call   *%rcx
+    }
+}
+  803042:	48 83 c4 18          	add    $0x18,%rsp
+  803046:	5b                   	pop    %rbx
+  803047:	41 5c                	pop    %r12
+  803049:	41 5d                	pop    %r13
+  80304b:	41 5e                	pop    %r14
+  80304d:	41 5f                	pop    %r15
+  80304f:	5d                   	pop    %rbp
+  803050:	c3                   	ret
+
+0000000000803051 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803051:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803056:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80305d:	00 00 00 
+  803060:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  803067:	48 01 ca             	add    %rcx,%rdx
+  80306a:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803070:	39 fa                	cmp    %edi,%edx
+  803072:	74 12                	je     803086 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803074:	48 83 c0 01          	add    $0x1,%rax
+  803078:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80307e:	75 e0                	jne    803060 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803080:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803085:	c3                   	ret
+            return envs[i].env_id;
+  803086:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80308d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803094:	00 00 00 
+  803097:	48 01 d0             	add    %rdx,%rax
+  80309a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8030a0:	c3                   	ret
+
+00000000008030a1 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8030a1:	55                   	push   %rbp
+  8030a2:	48 89 e5             	mov    %rsp,%rbp
+  8030a5:	41 56                	push   %r14
+  8030a7:	41 55                	push   %r13
+  8030a9:	41 54                	push   %r12
+  8030ab:	53                   	push   %rbx
+  8030ac:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8030af:	48 b8 68 70 80 00 00 	movabs $0x807068,%rax
+  8030b6:	00 00 00 
+  8030b9:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8030bd:	74 27                	je     8030e6 <_handle_vectored_pagefault+0x45>
+  8030bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8030c4:	49 bd 20 70 80 00 00 	movabs $0x807020,%r13
+  8030cb:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8030ce:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8030d1:	4c 89 e7             	mov    %r12,%rdi
+  8030d4:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8030d9:	84 c0                	test   %al,%al
+  8030db:	75 45                	jne    803122 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8030dd:	48 83 c3 01          	add    $0x1,%rbx
+  8030e1:	49 3b 1e             	cmp    (%r14),%rbx
+  8030e4:	72 eb                	jb     8030d1 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8030e6:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8030ed:	00 
+  8030ee:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8030f3:	4d 8b 04 24          	mov    (%r12),%r8
+  8030f7:	48 ba 58 3b 80 00 00 	movabs $0x803b58,%rdx
+  8030fe:	00 00 00 
+  803101:	be 1d 00 00 00       	mov    $0x1d,%esi
+  803106:	48 bf ef 3b 80 00 00 	movabs $0x803bef,%rdi
+  80310d:	00 00 00 
+  803110:	b8 00 00 00 00       	mov    $0x0,%eax
+  803115:	49 ba 2a 24 80 00 00 	movabs $0x80242a,%r10
+  80311c:	00 00 00 
+  80311f:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  803122:	5b                   	pop    %rbx
+  803123:	41 5c                	pop    %r12
+  803125:	41 5d                	pop    %r13
+  803127:	41 5e                	pop    %r14
+  803129:	5d                   	pop    %rbp
+  80312a:	c3                   	ret
+
+000000000080312b <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80312b:	55                   	push   %rbp
+  80312c:	48 89 e5             	mov    %rsp,%rbp
+  80312f:	53                   	push   %rbx
+  803130:	48 83 ec 08          	sub    $0x8,%rsp
+  803134:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  803137:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  80313e:	00 00 00 
+  803141:	80 38 00             	cmpb   $0x0,(%rax)
+  803144:	74 61                	je     8031a7 <add_pgfault_handler+0x7c>
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803146:	48 b8 68 70 80 00 00 	movabs $0x807068,%rax
+  80314d:	00 00 00 
+  803150:	48 8b 10             	mov    (%rax),%rdx
+  803153:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  803158:	48 b9 20 70 80 00 00 	movabs $0x807020,%rcx
+  80315f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803162:	48 85 d2             	test   %rdx,%rdx
+  803165:	74 19                	je     803180 <add_pgfault_handler+0x55>
+        if (handler == _pfhandler_vec[i]) return 0;
+  803167:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80316b:	74 2f                	je     80319c <add_pgfault_handler+0x71>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80316d:	48 83 c0 01          	add    $0x1,%rax
+  803171:	48 39 d0             	cmp    %rdx,%rax
+  803174:	75 f1                	jne    803167 <add_pgfault_handler+0x3c>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  803176:	48 83 fa 08          	cmp    $0x8,%rdx
+  80317a:	0f 84 f7 00 00 00    	je     803277 <add_pgfault_handler+0x14c>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  803180:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  803184:	48 a3 68 70 80 00 00 	movabs %rax,0x807068
+  80318b:	00 00 00 
+  80318e:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  803195:	00 00 00 
+  803198:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  80319c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031a5:	c9                   	leave
+  8031a6:	c3                   	ret
+        if (sys_alloc_region(CURENVID, ues_beg, PAGE_SIZE, PROT_RW))
+  8031a7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8031ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031b1:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8031b8:	00 00 00 
+  8031bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031c0:	48 b8 34 08 80 00 00 	movabs $0x800834,%rax
+  8031c7:	00 00 00 
+  8031ca:	ff d0                	call   *%rax
+  8031cc:	85 c0                	test   %eax,%eax
+  8031ce:	75 53                	jne    803223 <add_pgfault_handler+0xf8>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8031d0:	48 ba 68 70 80 00 00 	movabs $0x807068,%rdx
+  8031d7:	00 00 00 
+  8031da:	48 8b 02             	mov    (%rdx),%rax
+  8031dd:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8031e1:	48 89 0a             	mov    %rcx,(%rdx)
+  8031e4:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8031eb:	00 00 00 
+  8031ee:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        if (sys_env_set_pgfault_upcall(CURENVID, _pgfault_upcall))
+  8031f2:	48 be 61 2e 80 00 00 	movabs $0x802e61,%rsi
+  8031f9:	00 00 00 
+  8031fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803201:	48 b8 09 0b 80 00 00 	movabs $0x800b09,%rax
+  803208:	00 00 00 
+  80320b:	ff d0                	call   *%rax
+  80320d:	85 c0                	test   %eax,%eax
+  80320f:	75 3c                	jne    80324d <add_pgfault_handler+0x122>
+        _pfhandler_inititiallized = 1;
+  803211:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  803218:	00 00 00 
+  80321b:	c6 00 01             	movb   $0x1,(%rax)
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80321e:	e9 79 ff ff ff       	jmp    80319c <add_pgfault_handler+0x71>
+            panic("add_pgfault_handler: sys_alloc_region failed");
+  803223:	48 ba 88 3b 80 00 00 	movabs $0x803b88,%rdx
+  80322a:	00 00 00 
+  80322d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803232:	48 bf ef 3b 80 00 00 	movabs $0x803bef,%rdi
+  803239:	00 00 00 
+  80323c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803241:	48 b9 2a 24 80 00 00 	movabs $0x80242a,%rcx
+  803248:	00 00 00 
+  80324b:	ff d1                	call   *%rcx
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+  80324d:	48 ba b8 3b 80 00 00 	movabs $0x803bb8,%rdx
+  803254:	00 00 00 
+  803257:	be 32 00 00 00       	mov    $0x32,%esi
+  80325c:	48 bf ef 3b 80 00 00 	movabs $0x803bef,%rdi
+  803263:	00 00 00 
+  803266:	b8 00 00 00 00       	mov    $0x0,%eax
+  80326b:	48 b9 2a 24 80 00 00 	movabs $0x80242a,%rcx
+  803272:	00 00 00 
+  803275:	ff d1                	call   *%rcx
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803277:	b9 fd ff ff ff       	mov    $0xfffffffd,%ecx
+  80327c:	48 ba fd 3b 80 00 00 	movabs $0x803bfd,%rdx
+  803283:	00 00 00 
+  803286:	be 40 00 00 00       	mov    $0x40,%esi
+  80328b:	48 bf ef 3b 80 00 00 	movabs $0x803bef,%rdi
+  803292:	00 00 00 
+  803295:	b8 00 00 00 00       	mov    $0x0,%eax
+  80329a:	49 b8 2a 24 80 00 00 	movabs $0x80242a,%r8
+  8032a1:	00 00 00 
+  8032a4:	41 ff d0             	call   *%r8
+
+00000000008032a7 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8032a7:	55                   	push   %rbp
+  8032a8:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8032ab:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  8032b2:	00 00 00 
+  8032b5:	80 38 00             	cmpb   $0x0,(%rax)
+  8032b8:	74 33                	je     8032ed <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8032ba:	48 a1 68 70 80 00 00 	movabs 0x807068,%rax
+  8032c1:	00 00 00 
+  8032c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8032c9:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8032d0:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8032d3:	48 85 c0             	test   %rax,%rax
+  8032d6:	0f 84 85 00 00 00    	je     803361 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8032dc:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8032e0:	74 40                	je     803322 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8032e2:	48 83 c1 01          	add    $0x1,%rcx
+  8032e6:	48 39 c1             	cmp    %rax,%rcx
+  8032e9:	75 f1                	jne    8032dc <remove_pgfault_handler+0x35>
+  8032eb:	eb 74                	jmp    803361 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8032ed:	48 b9 15 3c 80 00 00 	movabs $0x803c15,%rcx
+  8032f4:	00 00 00 
+  8032f7:	48 ba a7 34 80 00 00 	movabs $0x8034a7,%rdx
+  8032fe:	00 00 00 
+  803301:	be 46 00 00 00       	mov    $0x46,%esi
+  803306:	48 bf ef 3b 80 00 00 	movabs $0x803bef,%rdi
+  80330d:	00 00 00 
+  803310:	b8 00 00 00 00       	mov    $0x0,%eax
+  803315:	49 b8 2a 24 80 00 00 	movabs $0x80242a,%r8
+  80331c:	00 00 00 
+  80331f:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  803322:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  803329:	00 
+  80332a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80332e:	48 29 ca             	sub    %rcx,%rdx
+  803331:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  803338:	00 00 00 
+  80333b:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80333f:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  803344:	48 89 ce             	mov    %rcx,%rsi
+  803347:	48 b8 7e 04 80 00 00 	movabs $0x80047e,%rax
+  80334e:	00 00 00 
+  803351:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  803353:	48 b8 68 70 80 00 00 	movabs $0x807068,%rax
+  80335a:	00 00 00 
+  80335d:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  803361:	5d                   	pop    %rbp
+  803362:	c3                   	ret
+  803363:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000803368 <__rodata_start>:
+  803368:	75 73                	jne    8033dd <__rodata_start+0x75>
+  80336a:	61                   	(bad)
+  80336b:	67 65 3a 20          	cmp    %gs:(%eax),%ah
+  80336f:	6b 69 6c 6c          	imul   $0x6c,0x6c(%rcx),%ebp
+  803373:	20 70 69             	and    %dh,0x69(%rax)
+  803376:	64 20 73 69          	and    %dh,%fs:0x69(%rbx)
+  80337a:	67 6e                	outsb  %ds:(%esi),(%dx)
+  80337c:	75 6d                	jne    8033eb <__rodata_start+0x83>
+  80337e:	20 5b 73             	and    %bl,0x73(%rbx)
+  803381:	69 67 61 72 67 5d 0a 	imul   $0xa5d6772,0x61(%rdi),%esp
+	...
+  803390:	6b 69 6c 6c          	imul   $0x6c,0x6c(%rcx),%ebp
+  803394:	3a 20                	cmp    (%rax),%ah
+  803396:	66 61                	data16 (bad)
+  803398:	69 6c 65 64 20 74 6f 	imul   $0x206f7420,0x64(%rbp,%riz,2),%ebp
+  80339f:	20 
+  8033a0:	73 65                	jae    803407 <__rodata_start+0x9f>
+  8033a2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033a3:	64 20 73 69          	and    %dh,%fs:0x69(%rbx)
+  8033a7:	67 6e                	outsb  %ds:(%esi),(%dx)
+  8033a9:	61                   	(bad)
+  8033aa:	6c                   	insb   (%dx),%es:(%rdi)
+  8033ab:	3a 20                	cmp    (%rax),%ah
+  8033ad:	25 64 0a 00 3c       	and    $0x3c000a64,%eax
+  8033b2:	75 6e                	jne    803422 <__rodata_start+0xba>
+  8033b4:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8033b8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033b9:	3e 00 0f             	ds add %cl,(%rdi)
+  8033bc:	1f                   	(bad)
+  8033bd:	44 00 00             	add    %r8b,(%rax)
+  8033c0:	73 79                	jae    80343b <__rodata_start+0xd3>
+  8033c2:	73 63                	jae    803427 <__rodata_start+0xbf>
+  8033c4:	61                   	(bad)
+  8033c5:	6c                   	insb   (%dx),%es:(%rdi)
+  8033c6:	6c                   	insb   (%dx),%es:(%rdi)
+  8033c7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09847 <__bss_end+0x72201847>
+  8033cd:	65 74 75             	gs je  803445 <__rodata_start+0xdd>
+  8033d0:	72 6e                	jb     803440 <__rodata_start+0xd8>
+  8033d2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09854 <__bss_end+0x28201854>
+  8033d9:	28 
+  8033da:	3e 20 30             	ds and %dh,(%rax)
+  8033dd:	29 00                	sub    %eax,(%rax)
+  8033df:	6c                   	insb   (%dx),%es:(%rdi)
+  8033e0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8033e7:	61                   	(bad)
+  8033e8:	6c                   	insb   (%dx),%es:(%rdi)
+  8033e9:	6c                   	insb   (%dx),%es:(%rdi)
+  8033ea:	2e 63 00             	cs movsxd (%rax),%eax
+  8033ed:	0f 1f 00             	nopl   (%rax)
+  8033f0:	5b                   	pop    %rbx
+  8033f1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8033f6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8033f9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8033fd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033fe:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  803402:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  803409:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 803e74 <error_string+0x414>
+  803410:	5b                   	pop    %rbx
+  803411:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803416:	20 66 74             	and    %ah,0x74(%rsi)
+  803419:	72 75                	jb     803490 <devtab+0x10>
+  80341b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80341c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80341f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad548a <__bss_end+0x2d2cd48a>
+  803426:	20 62 61             	and    %ah,0x61(%rdx)
+  803429:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80342d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803431:	5b                   	pop    %rbx
+  803432:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803437:	20 72 65             	and    %dh,0x65(%rdx)
+  80343a:	61                   	(bad)
+  80343b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad54a6 <__bss_end+0x2d2cd4a6>
+  803442:	20 62 61             	and    %ah,0x61(%rdx)
+  803445:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803449:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80344d:	5b                   	pop    %rbx
+  80344e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803453:	20 77 72             	and    %dh,0x72(%rdi)
+  803456:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80345d:	2d 
+  80345e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  803463:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  803466:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80346a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803471:	00 00 00 
+  803474:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80347b:	00 00 00 
+  80347e:	66 90                	xchg   %ax,%ax
+
+0000000000803480 <devtab>:
+  803480:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803490:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8034a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8034b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8034c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8034d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8034e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8034f0:	3d 20 32 00 0f 1f 40 00 73 69 67 6e 61 6c 73 3a     = 2...@.signals:
+  803500:	20 65 6e 76 20 25 78 3a 20 62 65 67 69 6e 20 67      env %x: begin g
+  803510:	65 6e 65 72 69 63 20 68 61 6e 64 6c 65 72 20 66     eneric handler f
+  803520:	6f 72 20 25 64 0a 00 00 73 69 67 6e 61 6c 73 3a     or %d...signals:
+  803530:	20 65 6e 76 20 25 78 3a 20 65 78 69 74 69 6e 67      env %x: exiting
+  803540:	20 64 75 65 20 74 6f 20 73 69 67 6e 61 6c 20 25      due to signal %
+  803550:	64 0a 00 00 00 00 00 00 73 69 67 6e 61 6c 73 3a     d.......signals:
+  803560:	20 65 6e 76 20 25 78 3a 20 69 67 6e 6f 72 69 6e      env %x: ignorin
+  803570:	67 20 73 69 67 6e 61 6c 20 25 64 0a 00 00 00 00     g signal %d.....
+  803580:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  803590:	20 65 6e 64 20 67 65 6e 65 72 69 63 20 68 61 6e      end generic han
+  8035a0:	64 6c 65 72 20 66 6f 72 20 25 64 0a 00 66 61 6c     dler for %d..fal
+  8035b0:	73 65 00 6c 69 62 2f 73 69 67 6e 61 6c 2e 63 00     se.lib/signal.c.
+  8035c0:	3c 63 6f 6e 73 3e 00 63 6f 6e 73 00 0f 1f 40 00     <cons>.cons...@.
+  8035d0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8035e0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8035f0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  803600:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  803610:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  803620:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  803630:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  803640:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  803650:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  803660:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  803670:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  803680:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  803690:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8036a0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8036b0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8036c0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8036d0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8036e0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  8036f0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  803700:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  803710:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  803720:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  803730:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  803740:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  803750:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  803760:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  803770:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  803780:	64 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     d.operation not 
+  803790:	70 65 72 6d 69 74 74 65 64 00 66 0f 1f 44 00 00     permitted.f..D..
+  8037a0:	67 27 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     g'.......-......
+  8037b0:	98 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  8037c0:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  8037d0:	a8 2d 80 00 00 00 00 00 86 27 80 00 00 00 00 00     .-.......'......
+  8037e0:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  8037f0:	7a 27 80 00 00 00 00 00 f4 27 80 00 00 00 00 00     z'.......'......
+  803800:	a8 2d 80 00 00 00 00 00 7a 27 80 00 00 00 00 00     .-......z'......
+  803810:	c0 27 80 00 00 00 00 00 c0 27 80 00 00 00 00 00     .'.......'......
+  803820:	c0 27 80 00 00 00 00 00 c0 27 80 00 00 00 00 00     .'.......'......
+  803830:	c0 27 80 00 00 00 00 00 c0 27 80 00 00 00 00 00     .'.......'......
+  803840:	c0 27 80 00 00 00 00 00 c0 27 80 00 00 00 00 00     .'.......'......
+  803850:	c0 27 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .'.......-......
+  803860:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  803870:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  803880:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  803890:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  8038a0:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  8038b0:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  8038c0:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  8038d0:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  8038e0:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  8038f0:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  803900:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  803910:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  803920:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  803930:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  803940:	a8 2d 80 00 00 00 00 00 cb 2c 80 00 00 00 00 00     .-.......,......
+  803950:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  803960:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  803970:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  803980:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  803990:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  8039a0:	17 28 80 00 00 00 00 00 e6 29 80 00 00 00 00 00     .(.......)......
+  8039b0:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  8039c0:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  8039d0:	46 28 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     F(.......-......
+  8039e0:	a8 2d 80 00 00 00 00 00 0c 28 80 00 00 00 00 00     .-.......(......
+  8039f0:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  803a00:	8e 2b 80 00 00 00 00 00 58 2c 80 00 00 00 00 00     .+......X,......
+  803a10:	a8 2d 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .-.......-......
+  803a20:	dd 28 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .(.......-......
+  803a30:	ba 2a 80 00 00 00 00 00 a8 2d 80 00 00 00 00 00     .*.......-......
+  803a40:	a8 2d 80 00 00 00 00 00 cb 2c 80 00 00 00 00 00     .-.......,......
+  803a50:	a8 2d 80 00 00 00 00 00 70 27 80 00 00 00 00 00     .-......p'......
+
+0000000000803a60 <error_string>:
+	...
+  803a68:	25 36 80 00 00 00 00 00 37 36 80 00 00 00 00 00     %6......76......
+  803a78:	47 36 80 00 00 00 00 00 59 36 80 00 00 00 00 00     G6......Y6......
+  803a88:	67 36 80 00 00 00 00 00 7b 36 80 00 00 00 00 00     g6......{6......
+  803a98:	90 36 80 00 00 00 00 00 a3 36 80 00 00 00 00 00     .6.......6......
+  803aa8:	b5 36 80 00 00 00 00 00 c9 36 80 00 00 00 00 00     .6.......6......
+  803ab8:	d9 36 80 00 00 00 00 00 ec 36 80 00 00 00 00 00     .6.......6......
+  803ac8:	03 37 80 00 00 00 00 00 19 37 80 00 00 00 00 00     .7.......7......
+  803ad8:	31 37 80 00 00 00 00 00 49 37 80 00 00 00 00 00     17......I7......
+  803ae8:	56 37 80 00 00 00 00 00 10 3b 80 00 00 00 00 00     V7.......;......
+  803af8:	6a 37 80 00 00 00 00 00 00 00 00 00 00 00 00 00     j7..............
+  803b08:	82 37 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .7......file is 
+  803b18:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803b28:	75 74 61 62 6c 65 00 69 70 63 5f 73 65 6e 64 3a     utable.ipc_send:
+  803b38:	20 66 61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00      failed to send.
+  803b48:	6c 69 62 2f 69 70 63 2e 63 00 66 0f 1f 44 00 00     lib/ipc.c.f..D..
+  803b58:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  803b68:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  803b78:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  803b88:	61 64 64 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64     add_pgfault_hand
+  803b98:	6c 65 72 3a 20 73 79 73 5f 61 6c 6c 6f 63 5f 72     ler: sys_alloc_r
+  803ba8:	65 67 69 6f 6e 20 66 61 69 6c 65 64 00 00 00 00     egion failed....
+  803bb8:	61 64 64 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64     add_pgfault_hand
+  803bc8:	6c 65 72 3a 20 73 79 73 5f 65 6e 76 5f 73 65 74     ler: sys_env_set
+  803bd8:	5f 70 67 66 61 75 6c 74 5f 75 70 63 61 6c 6c 20     _pgfault_upcall 
+  803be8:	66 61 69 6c 65 64 00 6c 69 62 2f 70 67 66 61 75     failed.lib/pgfau
+  803bf8:	6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c 74     lt.c.set_pgfault
+  803c08:	5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70 66     _handler: %i._pf
+  803c18:	68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69 61     handler_inititia
+  803c28:	6c 6c 69 7a 65 64 00 66 2e 0f 1f 84 00 00 00 00     llized.f........
+  803c38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ca8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cb8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cc8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cd8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ce8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cf8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d08:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d18:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d28:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d38:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d48:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d58:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803da8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803db8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dc8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f08:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f18:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f28:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f38:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff8:	00 0f 1f 80 00 00 00 00                             ........
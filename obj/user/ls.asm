@@ -0,0 +1,6338 @@
+
+obj/user/ls:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 17 04 00 00       	call   80043a <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <ls1>:
+    if (n < 0)
+        panic("error reading directory %s: %i", path, n);
+}
+
+void
+ls1(const char *prefix, bool isdir, off_t size, const char *name) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+  800032:	48 89 fb             	mov    %rdi,%rbx
+  800035:	41 89 f4             	mov    %esi,%r12d
+  800038:	49 89 cd             	mov    %rcx,%r13
+    const char *sep;
+
+    if (flag['l'])
+  80003b:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800042:	00 00 00 
+  800045:	83 b8 b0 01 00 00 00 	cmpl   $0x0,0x1b0(%rax)
+  80004c:	74 29                	je     800077 <ls1+0x52>
+  80004e:	89 d6                	mov    %edx,%esi
+        printf("%11d %c ", size, isdir ? 'd' : '-');
+  800050:	41 80 fc 01          	cmp    $0x1,%r12b
+  800054:	19 d2                	sbb    %edx,%edx
+  800056:	83 e2 c9             	and    $0xffffffc9,%edx
+  800059:	83 c2 64             	add    $0x64,%edx
+  80005c:	48 bf 4a 32 80 00 00 	movabs $0x80324a,%rdi
+  800063:	00 00 00 
+  800066:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006b:	48 b9 a3 27 80 00 00 	movabs $0x8027a3,%rcx
+  800072:	00 00 00 
+  800075:	ff d1                	call   *%rcx
+    if (prefix) {
+  800077:	48 85 db             	test   %rbx,%rbx
+  80007a:	74 2d                	je     8000a9 <ls1+0x84>
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+            sep = "/";
+        else
+            sep = "";
+  80007c:	48 ba b0 32 80 00 00 	movabs $0x8032b0,%rdx
+  800083:	00 00 00 
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+  800086:	80 3b 00             	cmpb   $0x0,(%rbx)
+  800089:	75 7a                	jne    800105 <ls1+0xe0>
+        printf("%s%s", prefix, sep);
+  80008b:	48 89 de             	mov    %rbx,%rsi
+  80008e:	48 bf 53 32 80 00 00 	movabs $0x803253,%rdi
+  800095:	00 00 00 
+  800098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009d:	48 b9 a3 27 80 00 00 	movabs $0x8027a3,%rcx
+  8000a4:	00 00 00 
+  8000a7:	ff d1                	call   *%rcx
+    }
+    printf("%s", name);
+  8000a9:	4c 89 ee             	mov    %r13,%rsi
+  8000ac:	48 bf 39 39 80 00 00 	movabs $0x803939,%rdi
+  8000b3:	00 00 00 
+  8000b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bb:	48 ba a3 27 80 00 00 	movabs $0x8027a3,%rdx
+  8000c2:	00 00 00 
+  8000c5:	ff d2                	call   *%rdx
+    if (flag['F'] && isdir)
+  8000c7:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8000ce:	00 00 00 
+  8000d1:	83 b8 18 01 00 00 00 	cmpl   $0x0,0x118(%rax)
+  8000d8:	74 05                	je     8000df <ls1+0xba>
+  8000da:	45 84 e4             	test   %r12b,%r12b
+  8000dd:	75 57                	jne    800136 <ls1+0x111>
+        printf("/");
+    printf("\n");
+  8000df:	48 bf af 32 80 00 00 	movabs $0x8032af,%rdi
+  8000e6:	00 00 00 
+  8000e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ee:	48 ba a3 27 80 00 00 	movabs $0x8027a3,%rdx
+  8000f5:	00 00 00 
+  8000f8:	ff d2                	call   *%rdx
+}
+  8000fa:	48 83 c4 08          	add    $0x8,%rsp
+  8000fe:	5b                   	pop    %rbx
+  8000ff:	41 5c                	pop    %r12
+  800101:	41 5d                	pop    %r13
+  800103:	5d                   	pop    %rbp
+  800104:	c3                   	ret
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+  800105:	48 89 df             	mov    %rbx,%rdi
+  800108:	48 b8 3b 0f 80 00 00 	movabs $0x800f3b,%rax
+  80010f:	00 00 00 
+  800112:	ff d0                	call   *%rax
+            sep = "/";
+  800114:	80 7c 03 ff 2f       	cmpb   $0x2f,-0x1(%rbx,%rax,1)
+  800119:	48 ba b0 32 80 00 00 	movabs $0x8032b0,%rdx
+  800120:	00 00 00 
+  800123:	48 b8 48 32 80 00 00 	movabs $0x803248,%rax
+  80012a:	00 00 00 
+  80012d:	48 0f 45 d0          	cmovne %rax,%rdx
+  800131:	e9 55 ff ff ff       	jmp    80008b <ls1+0x66>
+        printf("/");
+  800136:	48 bf 48 32 80 00 00 	movabs $0x803248,%rdi
+  80013d:	00 00 00 
+  800140:	b8 00 00 00 00       	mov    $0x0,%eax
+  800145:	48 ba a3 27 80 00 00 	movabs $0x8027a3,%rdx
+  80014c:	00 00 00 
+  80014f:	ff d2                	call   *%rdx
+  800151:	eb 8c                	jmp    8000df <ls1+0xba>
+
+0000000000800153 <lsdir>:
+lsdir(const char *path, const char *prefix) {
+  800153:	55                   	push   %rbp
+  800154:	48 89 e5             	mov    %rsp,%rbp
+  800157:	41 56                	push   %r14
+  800159:	41 55                	push   %r13
+  80015b:	41 54                	push   %r12
+  80015d:	53                   	push   %rbx
+  80015e:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800165:	49 89 fd             	mov    %rdi,%r13
+  800168:	49 89 f6             	mov    %rsi,%r14
+    if ((fd = open(path, O_RDONLY)) < 0)
+  80016b:	be 00 00 00 00       	mov    $0x0,%esi
+  800170:	48 b8 74 25 80 00 00 	movabs $0x802574,%rax
+  800177:	00 00 00 
+  80017a:	ff d0                	call   *%rax
+  80017c:	89 c3                	mov    %eax,%ebx
+  80017e:	85 c0                	test   %eax,%eax
+  800180:	78 58                	js     8001da <lsdir+0x87>
+    while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+  800182:	49 bc 74 20 80 00 00 	movabs $0x802074,%r12
+  800189:	00 00 00 
+  80018c:	ba 00 01 00 00       	mov    $0x100,%edx
+  800191:	48 8d b5 e0 fe ff ff 	lea    -0x120(%rbp),%rsi
+  800198:	89 df                	mov    %ebx,%edi
+  80019a:	41 ff d4             	call   *%r12
+  80019d:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8001a2:	75 67                	jne    80020b <lsdir+0xb8>
+        if (f.f_name[0])
+  8001a4:	80 bd e0 fe ff ff 00 	cmpb   $0x0,-0x120(%rbp)
+  8001ab:	74 df                	je     80018c <lsdir+0x39>
+            ls1(prefix, f.f_type == FTYPE_DIR, f.f_size, f.f_name);
+  8001ad:	83 bd 64 ff ff ff 01 	cmpl   $0x1,-0x9c(%rbp)
+  8001b4:	40 0f 94 c6          	sete   %sil
+  8001b8:	40 0f b6 f6          	movzbl %sil,%esi
+  8001bc:	48 8d 8d e0 fe ff ff 	lea    -0x120(%rbp),%rcx
+  8001c3:	8b 95 60 ff ff ff    	mov    -0xa0(%rbp),%edx
+  8001c9:	4c 89 f7             	mov    %r14,%rdi
+  8001cc:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001d3:	00 00 00 
+  8001d6:	ff d0                	call   *%rax
+  8001d8:	eb b2                	jmp    80018c <lsdir+0x39>
+        panic("open %s: %i", path, fd);
+  8001da:	41 89 c0             	mov    %eax,%r8d
+  8001dd:	4c 89 e9             	mov    %r13,%rcx
+  8001e0:	48 ba 58 32 80 00 00 	movabs $0x803258,%rdx
+  8001e7:	00 00 00 
+  8001ea:	be 1b 00 00 00       	mov    $0x1b,%esi
+  8001ef:	48 bf 64 32 80 00 00 	movabs $0x803264,%rdi
+  8001f6:	00 00 00 
+  8001f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fe:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  800205:	00 00 00 
+  800208:	41 ff d1             	call   *%r9
+    if (n > 0)
+  80020b:	85 c0                	test   %eax,%eax
+  80020d:	7f 12                	jg     800221 <lsdir+0xce>
+    if (n < 0)
+  80020f:	78 3e                	js     80024f <lsdir+0xfc>
+}
+  800211:	48 81 c4 00 01 00 00 	add    $0x100,%rsp
+  800218:	5b                   	pop    %rbx
+  800219:	41 5c                	pop    %r12
+  80021b:	41 5d                	pop    %r13
+  80021d:	41 5e                	pop    %r14
+  80021f:	5d                   	pop    %rbp
+  800220:	c3                   	ret
+        panic("short read in directory %s", path);
+  800221:	4c 89 e9             	mov    %r13,%rcx
+  800224:	48 ba 6e 32 80 00 00 	movabs $0x80326e,%rdx
+  80022b:	00 00 00 
+  80022e:	be 20 00 00 00       	mov    $0x20,%esi
+  800233:	48 bf 64 32 80 00 00 	movabs $0x803264,%rdi
+  80023a:	00 00 00 
+  80023d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800242:	49 b8 04 05 80 00 00 	movabs $0x800504,%r8
+  800249:	00 00 00 
+  80024c:	41 ff d0             	call   *%r8
+        panic("error reading directory %s: %i", path, n);
+  80024f:	41 89 c0             	mov    %eax,%r8d
+  800252:	4c 89 e9             	mov    %r13,%rcx
+  800255:	48 ba b8 32 80 00 00 	movabs $0x8032b8,%rdx
+  80025c:	00 00 00 
+  80025f:	be 22 00 00 00       	mov    $0x22,%esi
+  800264:	48 bf 64 32 80 00 00 	movabs $0x803264,%rdi
+  80026b:	00 00 00 
+  80026e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800273:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  80027a:	00 00 00 
+  80027d:	41 ff d1             	call   *%r9
+
+0000000000800280 <ls>:
+ls(const char *path, const char *prefix) {
+  800280:	55                   	push   %rbp
+  800281:	48 89 e5             	mov    %rsp,%rbp
+  800284:	41 54                	push   %r12
+  800286:	53                   	push   %rbx
+  800287:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  80028e:	48 89 fb             	mov    %rdi,%rbx
+  800291:	49 89 f4             	mov    %rsi,%r12
+    if ((r = stat(path, &st)) < 0)
+  800294:	48 8d b5 60 ff ff ff 	lea    -0xa0(%rbp),%rsi
+  80029b:	48 b8 f3 22 80 00 00 	movabs $0x8022f3,%rax
+  8002a2:	00 00 00 
+  8002a5:	ff d0                	call   *%rax
+  8002a7:	85 c0                	test   %eax,%eax
+  8002a9:	78 47                	js     8002f2 <ls+0x72>
+    if (st.st_isdir && !flag['d'])
+  8002ab:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8002ae:	85 c0                	test   %eax,%eax
+  8002b0:	74 13                	je     8002c5 <ls+0x45>
+  8002b2:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  8002b9:	00 00 00 
+  8002bc:	83 ba 90 01 00 00 00 	cmpl   $0x0,0x190(%rdx)
+  8002c3:	74 5e                	je     800323 <ls+0xa3>
+        ls1(0, st.st_isdir, st.st_size, path);
+  8002c5:	85 c0                	test   %eax,%eax
+  8002c7:	40 0f 95 c6          	setne  %sil
+  8002cb:	40 0f b6 f6          	movzbl %sil,%esi
+  8002cf:	48 89 d9             	mov    %rbx,%rcx
+  8002d2:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8002d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002da:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002e1:	00 00 00 
+  8002e4:	ff d0                	call   *%rax
+}
+  8002e6:	48 81 c4 90 00 00 00 	add    $0x90,%rsp
+  8002ed:	5b                   	pop    %rbx
+  8002ee:	41 5c                	pop    %r12
+  8002f0:	5d                   	pop    %rbp
+  8002f1:	c3                   	ret
+        panic("stat %s: %i", path, r);
+  8002f2:	41 89 c0             	mov    %eax,%r8d
+  8002f5:	48 89 d9             	mov    %rbx,%rcx
+  8002f8:	48 ba 89 32 80 00 00 	movabs $0x803289,%rdx
+  8002ff:	00 00 00 
+  800302:	be 0e 00 00 00       	mov    $0xe,%esi
+  800307:	48 bf 64 32 80 00 00 	movabs $0x803264,%rdi
+  80030e:	00 00 00 
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  80031d:	00 00 00 
+  800320:	41 ff d1             	call   *%r9
+        lsdir(path, prefix);
+  800323:	4c 89 e6             	mov    %r12,%rsi
+  800326:	48 89 df             	mov    %rbx,%rdi
+  800329:	48 b8 53 01 80 00 00 	movabs $0x800153,%rax
+  800330:	00 00 00 
+  800333:	ff d0                	call   *%rax
+  800335:	eb af                	jmp    8002e6 <ls+0x66>
+
+0000000000800337 <usage>:
+
+void
+usage(void) {
+  800337:	55                   	push   %rbp
+  800338:	48 89 e5             	mov    %rsp,%rbp
+    printf("usage: ls [-dFl] [file...]\n");
+  80033b:	48 bf 95 32 80 00 00 	movabs $0x803295,%rdi
+  800342:	00 00 00 
+  800345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034a:	48 ba a3 27 80 00 00 	movabs $0x8027a3,%rdx
+  800351:	00 00 00 
+  800354:	ff d2                	call   *%rdx
+    exit();
+  800356:	48 b8 e1 04 80 00 00 	movabs $0x8004e1,%rax
+  80035d:	00 00 00 
+  800360:	ff d0                	call   *%rax
+}
+  800362:	5d                   	pop    %rbp
+  800363:	c3                   	ret
+
+0000000000800364 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800364:	55                   	push   %rbp
+  800365:	48 89 e5             	mov    %rsp,%rbp
+  800368:	41 57                	push   %r15
+  80036a:	41 56                	push   %r14
+  80036c:	41 55                	push   %r13
+  80036e:	41 54                	push   %r12
+  800370:	53                   	push   %rbx
+  800371:	48 83 ec 38          	sub    $0x38,%rsp
+  800375:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  800378:	49 89 f4             	mov    %rsi,%r12
+    int i;
+    struct Argstate args;
+
+    argstart(&argc, argv, &args);
+  80037b:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  80037f:	48 8d 7d ac          	lea    -0x54(%rbp),%rdi
+  800383:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  80038a:	00 00 00 
+  80038d:	ff d0                	call   *%rax
+    while ((i = argnext(&args)) >= 0)
+  80038f:	49 bd f8 1a 80 00 00 	movabs $0x801af8,%r13
+  800396:	00 00 00 
+        case 'F':
+        case 'l':
+            flag[i]++;
+            break;
+        default:
+            usage();
+  800399:	49 bf 37 03 80 00 00 	movabs $0x800337,%r15
+  8003a0:	00 00 00 
+        switch (i) {
+  8003a3:	49 be 01 00 00 40 40 	movabs $0x4040000001,%r14
+  8003aa:	00 00 00 
+            flag[i]++;
+  8003ad:	48 bb 00 50 80 00 00 	movabs $0x805000,%rbx
+  8003b4:	00 00 00 
+    while ((i = argnext(&args)) >= 0)
+  8003b7:	eb 06                	jmp    8003bf <umain+0x5b>
+            flag[i]++;
+  8003b9:	48 98                	cltq
+  8003bb:	83 04 83 01          	addl   $0x1,(%rbx,%rax,4)
+    while ((i = argnext(&args)) >= 0)
+  8003bf:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  8003c3:	41 ff d5             	call   *%r13
+  8003c6:	85 c0                	test   %eax,%eax
+  8003c8:	78 13                	js     8003dd <umain+0x79>
+        switch (i) {
+  8003ca:	8d 50 ba             	lea    -0x46(%rax),%edx
+  8003cd:	83 fa 26             	cmp    $0x26,%edx
+  8003d0:	77 06                	ja     8003d8 <umain+0x74>
+  8003d2:	49 0f a3 d6          	bt     %rdx,%r14
+  8003d6:	72 e1                	jb     8003b9 <umain+0x55>
+            usage();
+  8003d8:	41 ff d7             	call   *%r15
+  8003db:	eb e2                	jmp    8003bf <umain+0x5b>
+        }
+
+    if (argc == 1)
+  8003dd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8003e0:	83 f8 01             	cmp    $0x1,%eax
+  8003e3:	74 33                	je     800418 <umain+0xb4>
+        ls("/", "");
+    else {
+        for (i = 1; i < argc; i++)
+  8003e5:	bb 01 00 00 00       	mov    $0x1,%ebx
+            ls(argv[i], argv[i]);
+  8003ea:	49 bd 80 02 80 00 00 	movabs $0x800280,%r13
+  8003f1:	00 00 00 
+        for (i = 1; i < argc; i++)
+  8003f4:	7e 13                	jle    800409 <umain+0xa5>
+            ls(argv[i], argv[i]);
+  8003f6:	49 8b 3c dc          	mov    (%r12,%rbx,8),%rdi
+  8003fa:	48 89 fe             	mov    %rdi,%rsi
+  8003fd:	41 ff d5             	call   *%r13
+        for (i = 1; i < argc; i++)
+  800400:	48 83 c3 01          	add    $0x1,%rbx
+  800404:	39 5d ac             	cmp    %ebx,-0x54(%rbp)
+  800407:	7f ed                	jg     8003f6 <umain+0x92>
+    }
+}
+  800409:	48 83 c4 38          	add    $0x38,%rsp
+  80040d:	5b                   	pop    %rbx
+  80040e:	41 5c                	pop    %r12
+  800410:	41 5d                	pop    %r13
+  800412:	41 5e                	pop    %r14
+  800414:	41 5f                	pop    %r15
+  800416:	5d                   	pop    %rbp
+  800417:	c3                   	ret
+        ls("/", "");
+  800418:	48 be b0 32 80 00 00 	movabs $0x8032b0,%rsi
+  80041f:	00 00 00 
+  800422:	48 bf 48 32 80 00 00 	movabs $0x803248,%rdi
+  800429:	00 00 00 
+  80042c:	48 b8 80 02 80 00 00 	movabs $0x800280,%rax
+  800433:	00 00 00 
+  800436:	ff d0                	call   *%rax
+  800438:	eb cf                	jmp    800409 <umain+0xa5>
+
+000000000080043a <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80043a:	55                   	push   %rbp
+  80043b:	48 89 e5             	mov    %rsp,%rbp
+  80043e:	41 56                	push   %r14
+  800440:	41 55                	push   %r13
+  800442:	41 54                	push   %r12
+  800444:	53                   	push   %rbx
+  800445:	41 89 fd             	mov    %edi,%r13d
+  800448:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80044b:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800452:	00 00 00 
+  800455:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80045c:	00 00 00 
+  80045f:	48 39 c2             	cmp    %rax,%rdx
+  800462:	73 17                	jae    80047b <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800464:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800467:	49 89 c4             	mov    %rax,%r12
+  80046a:	48 83 c3 08          	add    $0x8,%rbx
+  80046e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800473:	ff 53 f8             	call   *-0x8(%rbx)
+  800476:	4c 39 e3             	cmp    %r12,%rbx
+  800479:	72 ef                	jb     80046a <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  80047b:	48 b8 69 14 80 00 00 	movabs $0x801469,%rax
+  800482:	00 00 00 
+  800485:	ff d0                	call   *%rax
+  800487:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  80048a:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800491:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800498:	00 00 00 
+  80049b:	48 01 d0             	add    %rdx,%rax
+  80049e:	48 a3 00 54 80 00 00 	movabs %rax,0x805400
+  8004a5:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8004a8:	45 85 ed             	test   %r13d,%r13d
+  8004ab:	7e 0d                	jle    8004ba <libmain+0x80>
+  8004ad:	49 8b 06             	mov    (%r14),%rax
+  8004b0:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8004b7:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8004ba:	4c 89 f6             	mov    %r14,%rsi
+  8004bd:	44 89 ef             	mov    %r13d,%edi
+  8004c0:	48 b8 64 03 80 00 00 	movabs $0x800364,%rax
+  8004c7:	00 00 00 
+  8004ca:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8004cc:	48 b8 e1 04 80 00 00 	movabs $0x8004e1,%rax
+  8004d3:	00 00 00 
+  8004d6:	ff d0                	call   *%rax
+#endif
+}
+  8004d8:	5b                   	pop    %rbx
+  8004d9:	41 5c                	pop    %r12
+  8004db:	41 5d                	pop    %r13
+  8004dd:	41 5e                	pop    %r14
+  8004df:	5d                   	pop    %rbp
+  8004e0:	c3                   	ret
+
+00000000008004e1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8004e1:	55                   	push   %rbp
+  8004e2:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8004e5:	48 b8 6b 1e 80 00 00 	movabs $0x801e6b,%rax
+  8004ec:	00 00 00 
+  8004ef:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8004f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004f6:	48 b8 fe 13 80 00 00 	movabs $0x8013fe,%rax
+  8004fd:	00 00 00 
+  800500:	ff d0                	call   *%rax
+}
+  800502:	5d                   	pop    %rbp
+  800503:	c3                   	ret
+
+0000000000800504 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800504:	55                   	push   %rbp
+  800505:	48 89 e5             	mov    %rsp,%rbp
+  800508:	41 56                	push   %r14
+  80050a:	41 55                	push   %r13
+  80050c:	41 54                	push   %r12
+  80050e:	53                   	push   %rbx
+  80050f:	48 83 ec 50          	sub    $0x50,%rsp
+  800513:	49 89 fc             	mov    %rdi,%r12
+  800516:	41 89 f5             	mov    %esi,%r13d
+  800519:	48 89 d3             	mov    %rdx,%rbx
+  80051c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800520:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800524:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800528:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80052f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800533:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800537:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80053b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80053f:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800546:	00 00 00 
+  800549:	4c 8b 30             	mov    (%rax),%r14
+  80054c:	48 b8 69 14 80 00 00 	movabs $0x801469,%rax
+  800553:	00 00 00 
+  800556:	ff d0                	call   *%rax
+  800558:	89 c6                	mov    %eax,%esi
+  80055a:	45 89 e8             	mov    %r13d,%r8d
+  80055d:	4c 89 e1             	mov    %r12,%rcx
+  800560:	4c 89 f2             	mov    %r14,%rdx
+  800563:	48 bf e8 32 80 00 00 	movabs $0x8032e8,%rdi
+  80056a:	00 00 00 
+  80056d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800572:	49 bc 54 06 80 00 00 	movabs $0x800654,%r12
+  800579:	00 00 00 
+  80057c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80057f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800583:	48 89 df             	mov    %rbx,%rdi
+  800586:	48 b8 f0 05 80 00 00 	movabs $0x8005f0,%rax
+  80058d:	00 00 00 
+  800590:	ff d0                	call   *%rax
+    cprintf("\n");
+  800592:	48 bf af 32 80 00 00 	movabs $0x8032af,%rdi
+  800599:	00 00 00 
+  80059c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a1:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8005a4:	cc                   	int3
+  8005a5:	eb fd                	jmp    8005a4 <_panic+0xa0>
+
+00000000008005a7 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8005a7:	55                   	push   %rbp
+  8005a8:	48 89 e5             	mov    %rsp,%rbp
+  8005ab:	53                   	push   %rbx
+  8005ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8005b0:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8005b3:	8b 06                	mov    (%rsi),%eax
+  8005b5:	8d 50 01             	lea    0x1(%rax),%edx
+  8005b8:	89 16                	mov    %edx,(%rsi)
+  8005ba:	48 98                	cltq
+  8005bc:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8005c1:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8005c7:	74 0a                	je     8005d3 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8005c9:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8005cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005d1:	c9                   	leave
+  8005d2:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8005d3:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8005d7:	be ff 00 00 00       	mov    $0xff,%esi
+  8005dc:	48 b8 a0 13 80 00 00 	movabs $0x8013a0,%rax
+  8005e3:	00 00 00 
+  8005e6:	ff d0                	call   *%rax
+        state->offset = 0;
+  8005e8:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8005ee:	eb d9                	jmp    8005c9 <putch+0x22>
+
+00000000008005f0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8005f0:	55                   	push   %rbp
+  8005f1:	48 89 e5             	mov    %rsp,%rbp
+  8005f4:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8005fb:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8005fe:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800605:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80060a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800612:	48 89 f1             	mov    %rsi,%rcx
+  800615:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80061c:	48 bf a7 05 80 00 00 	movabs $0x8005a7,%rdi
+  800623:	00 00 00 
+  800626:	48 b8 a4 07 80 00 00 	movabs $0x8007a4,%rax
+  80062d:	00 00 00 
+  800630:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800632:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800639:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800640:	48 b8 a0 13 80 00 00 	movabs $0x8013a0,%rax
+  800647:	00 00 00 
+  80064a:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80064c:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800652:	c9                   	leave
+  800653:	c3                   	ret
+
+0000000000800654 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800654:	55                   	push   %rbp
+  800655:	48 89 e5             	mov    %rsp,%rbp
+  800658:	48 83 ec 50          	sub    $0x50,%rsp
+  80065c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800660:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800664:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800668:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80066c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800670:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800677:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80067b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80067f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800683:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800687:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80068b:	48 b8 f0 05 80 00 00 	movabs $0x8005f0,%rax
+  800692:	00 00 00 
+  800695:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800697:	c9                   	leave
+  800698:	c3                   	ret
+
+0000000000800699 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800699:	55                   	push   %rbp
+  80069a:	48 89 e5             	mov    %rsp,%rbp
+  80069d:	41 57                	push   %r15
+  80069f:	41 56                	push   %r14
+  8006a1:	41 55                	push   %r13
+  8006a3:	41 54                	push   %r12
+  8006a5:	53                   	push   %rbx
+  8006a6:	48 83 ec 18          	sub    $0x18,%rsp
+  8006aa:	49 89 fc             	mov    %rdi,%r12
+  8006ad:	49 89 f5             	mov    %rsi,%r13
+  8006b0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8006b4:	8b 45 10             	mov    0x10(%rbp),%eax
+  8006b7:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8006ba:	41 89 cf             	mov    %ecx,%r15d
+  8006bd:	4c 39 fa             	cmp    %r15,%rdx
+  8006c0:	73 5b                	jae    80071d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8006c2:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8006c6:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8006ca:	85 db                	test   %ebx,%ebx
+  8006cc:	7e 0e                	jle    8006dc <print_num+0x43>
+            putch(padc, put_arg);
+  8006ce:	4c 89 ee             	mov    %r13,%rsi
+  8006d1:	44 89 f7             	mov    %r14d,%edi
+  8006d4:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8006d7:	83 eb 01             	sub    $0x1,%ebx
+  8006da:	75 f2                	jne    8006ce <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8006dc:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8006e0:	48 b9 1c 33 80 00 00 	movabs $0x80331c,%rcx
+  8006e7:	00 00 00 
+  8006ea:	48 b8 0b 33 80 00 00 	movabs $0x80330b,%rax
+  8006f1:	00 00 00 
+  8006f4:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8006f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800701:	49 f7 f7             	div    %r15
+  800704:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800708:	4c 89 ee             	mov    %r13,%rsi
+  80070b:	41 ff d4             	call   *%r12
+}
+  80070e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800712:	5b                   	pop    %rbx
+  800713:	41 5c                	pop    %r12
+  800715:	41 5d                	pop    %r13
+  800717:	41 5e                	pop    %r14
+  800719:	41 5f                	pop    %r15
+  80071b:	5d                   	pop    %rbp
+  80071c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80071d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800721:	ba 00 00 00 00       	mov    $0x0,%edx
+  800726:	49 f7 f7             	div    %r15
+  800729:	48 83 ec 08          	sub    $0x8,%rsp
+  80072d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800731:	52                   	push   %rdx
+  800732:	45 0f be c9          	movsbl %r9b,%r9d
+  800736:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80073a:	48 89 c2             	mov    %rax,%rdx
+  80073d:	48 b8 99 06 80 00 00 	movabs $0x800699,%rax
+  800744:	00 00 00 
+  800747:	ff d0                	call   *%rax
+  800749:	48 83 c4 10          	add    $0x10,%rsp
+  80074d:	eb 8d                	jmp    8006dc <print_num+0x43>
+
+000000000080074f <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80074f:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800753:	48 8b 06             	mov    (%rsi),%rax
+  800756:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80075a:	73 0a                	jae    800766 <sprintputch+0x17>
+        *state->start++ = ch;
+  80075c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800760:	48 89 16             	mov    %rdx,(%rsi)
+  800763:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800766:	c3                   	ret
+
+0000000000800767 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800767:	55                   	push   %rbp
+  800768:	48 89 e5             	mov    %rsp,%rbp
+  80076b:	48 83 ec 50          	sub    $0x50,%rsp
+  80076f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800773:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800777:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80077b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800782:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800786:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80078a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80078e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800792:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800796:	48 b8 a4 07 80 00 00 	movabs $0x8007a4,%rax
+  80079d:	00 00 00 
+  8007a0:	ff d0                	call   *%rax
+}
+  8007a2:	c9                   	leave
+  8007a3:	c3                   	ret
+
+00000000008007a4 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8007a4:	55                   	push   %rbp
+  8007a5:	48 89 e5             	mov    %rsp,%rbp
+  8007a8:	41 57                	push   %r15
+  8007aa:	41 56                	push   %r14
+  8007ac:	41 55                	push   %r13
+  8007ae:	41 54                	push   %r12
+  8007b0:	53                   	push   %rbx
+  8007b1:	48 83 ec 38          	sub    $0x38,%rsp
+  8007b5:	49 89 fe             	mov    %rdi,%r14
+  8007b8:	49 89 f5             	mov    %rsi,%r13
+  8007bb:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8007be:	48 8b 01             	mov    (%rcx),%rax
+  8007c1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8007c5:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8007c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007cd:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8007d1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8007d5:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8007d9:	0f b6 3b             	movzbl (%rbx),%edi
+  8007dc:	40 80 ff 25          	cmp    $0x25,%dil
+  8007e0:	74 18                	je     8007fa <vprintfmt+0x56>
+            if (!ch) return;
+  8007e2:	40 84 ff             	test   %dil,%dil
+  8007e5:	0f 84 b1 06 00 00    	je     800e9c <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8007eb:	40 0f b6 ff          	movzbl %dil,%edi
+  8007ef:	4c 89 ee             	mov    %r13,%rsi
+  8007f2:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8007f5:	4c 89 e3             	mov    %r12,%rbx
+  8007f8:	eb db                	jmp    8007d5 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8007fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8007ff:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800803:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800808:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80080e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800815:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800819:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80081e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800823:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800826:	83 e8 23             	sub    $0x23,%eax
+  800829:	3c 57                	cmp    $0x57,%al
+  80082b:	0f 87 51 06 00 00    	ja     800e82 <vprintfmt+0x6de>
+  800831:	0f b6 c0             	movzbl %al,%eax
+  800834:	48 b9 c0 34 80 00 00 	movabs $0x8034c0,%rcx
+  80083b:	00 00 00 
+  80083e:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800841:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800844:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800848:	eb cf                	jmp    800819 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80084a:	49 89 dc             	mov    %rbx,%r12
+  80084d:	be 01 00 00 00       	mov    $0x1,%esi
+  800852:	eb c5                	jmp    800819 <vprintfmt+0x75>
+            padc = ch;
+  800854:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800858:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80085b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80085e:	eb b9                	jmp    800819 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800860:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800863:	83 f8 2f             	cmp    $0x2f,%eax
+  800866:	77 24                	ja     80088c <vprintfmt+0xe8>
+  800868:	89 c1                	mov    %eax,%ecx
+  80086a:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80086e:	83 c0 08             	add    $0x8,%eax
+  800871:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800874:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800877:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80087a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80087e:	79 99                	jns    800819 <vprintfmt+0x75>
+                width = precision;
+  800880:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800884:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80088a:	eb 8d                	jmp    800819 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80088c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800890:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800894:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800898:	eb da                	jmp    800874 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80089a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80089f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8008a3:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8008a9:	3c 39                	cmp    $0x39,%al
+  8008ab:	77 1c                	ja     8008c9 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8008ad:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8008b1:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8008b5:	0f b6 c0             	movzbl %al,%eax
+  8008b8:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8008bd:	0f b6 03             	movzbl (%rbx),%eax
+  8008c0:	3c 39                	cmp    $0x39,%al
+  8008c2:	76 e9                	jbe    8008ad <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8008c4:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8008c7:	eb b1                	jmp    80087a <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8008c9:	49 89 dc             	mov    %rbx,%r12
+  8008cc:	eb ac                	jmp    80087a <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8008ce:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8008d1:	85 c9                	test   %ecx,%ecx
+  8008d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d8:	0f 49 c1             	cmovns %ecx,%eax
+  8008db:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8008de:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008e1:	e9 33 ff ff ff       	jmp    800819 <vprintfmt+0x75>
+            lflag++;
+  8008e6:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8008e9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008ec:	e9 28 ff ff ff       	jmp    800819 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8008f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f7:	77 19                	ja     800912 <vprintfmt+0x16e>
+  8008f9:	89 c2                	mov    %eax,%edx
+  8008fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ff:	83 c0 08             	add    $0x8,%eax
+  800902:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800905:	8b 3a                	mov    (%rdx),%edi
+  800907:	4c 89 ee             	mov    %r13,%rsi
+  80090a:	41 ff d6             	call   *%r14
+            break;
+  80090d:	e9 c3 fe ff ff       	jmp    8007d5 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800912:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800916:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091e:	eb e5                	jmp    800905 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800920:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800923:	83 f8 2f             	cmp    $0x2f,%eax
+  800926:	77 5a                	ja     800982 <vprintfmt+0x1de>
+  800928:	89 c2                	mov    %eax,%edx
+  80092a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092e:	83 c0 08             	add    $0x8,%eax
+  800931:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800934:	8b 02                	mov    (%rdx),%eax
+  800936:	89 c1                	mov    %eax,%ecx
+  800938:	f7 d9                	neg    %ecx
+  80093a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80093d:	83 f9 15             	cmp    $0x15,%ecx
+  800940:	7f 4e                	jg     800990 <vprintfmt+0x1ec>
+  800942:	48 63 c1             	movslq %ecx,%rax
+  800945:	48 ba 80 37 80 00 00 	movabs $0x803780,%rdx
+  80094c:	00 00 00 
+  80094f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800953:	48 85 c0             	test   %rax,%rax
+  800956:	74 38                	je     800990 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800958:	48 89 c1             	mov    %rax,%rcx
+  80095b:	48 ba 39 39 80 00 00 	movabs $0x803939,%rdx
+  800962:	00 00 00 
+  800965:	4c 89 ee             	mov    %r13,%rsi
+  800968:	4c 89 f7             	mov    %r14,%rdi
+  80096b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800970:	49 b8 67 07 80 00 00 	movabs $0x800767,%r8
+  800977:	00 00 00 
+  80097a:	41 ff d0             	call   *%r8
+  80097d:	e9 53 fe ff ff       	jmp    8007d5 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800982:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800986:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098e:	eb a4                	jmp    800934 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800990:	48 ba 34 33 80 00 00 	movabs $0x803334,%rdx
+  800997:	00 00 00 
+  80099a:	4c 89 ee             	mov    %r13,%rsi
+  80099d:	4c 89 f7             	mov    %r14,%rdi
+  8009a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a5:	49 b8 67 07 80 00 00 	movabs $0x800767,%r8
+  8009ac:	00 00 00 
+  8009af:	41 ff d0             	call   *%r8
+  8009b2:	e9 1e fe ff ff       	jmp    8007d5 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8009b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8009bd:	77 6c                	ja     800a2b <vprintfmt+0x287>
+  8009bf:	89 c2                	mov    %eax,%edx
+  8009c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c5:	83 c0 08             	add    $0x8,%eax
+  8009c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009cb:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8009ce:	48 85 d2             	test   %rdx,%rdx
+  8009d1:	48 b8 2d 33 80 00 00 	movabs $0x80332d,%rax
+  8009d8:	00 00 00 
+  8009db:	48 0f 45 c2          	cmovne %rdx,%rax
+  8009df:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8009e3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009e7:	7e 06                	jle    8009ef <vprintfmt+0x24b>
+  8009e9:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8009ed:	75 4a                	jne    800a39 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009ef:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009f3:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009f7:	0f b6 00             	movzbl (%rax),%eax
+  8009fa:	84 c0                	test   %al,%al
+  8009fc:	0f 85 9a 00 00 00    	jne    800a9c <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800a02:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a05:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800a09:	85 c0                	test   %eax,%eax
+  800a0b:	0f 8e c4 fd ff ff    	jle    8007d5 <vprintfmt+0x31>
+  800a11:	4c 89 ee             	mov    %r13,%rsi
+  800a14:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a19:	41 ff d6             	call   *%r14
+  800a1c:	41 83 ec 01          	sub    $0x1,%r12d
+  800a20:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800a24:	75 eb                	jne    800a11 <vprintfmt+0x26d>
+  800a26:	e9 aa fd ff ff       	jmp    8007d5 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a37:	eb 92                	jmp    8009cb <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800a39:	49 63 f7             	movslq %r15d,%rsi
+  800a3c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800a40:	48 b8 56 0f 80 00 00 	movabs $0x800f56,%rax
+  800a47:	00 00 00 
+  800a4a:	ff d0                	call   *%rax
+  800a4c:	48 89 c2             	mov    %rax,%rdx
+  800a4f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a52:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800a54:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800a57:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800a5a:	85 c0                	test   %eax,%eax
+  800a5c:	7e 91                	jle    8009ef <vprintfmt+0x24b>
+  800a5e:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800a63:	4c 89 ee             	mov    %r13,%rsi
+  800a66:	44 89 e7             	mov    %r12d,%edi
+  800a69:	41 ff d6             	call   *%r14
+  800a6c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a70:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a73:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800a76:	75 eb                	jne    800a63 <vprintfmt+0x2bf>
+  800a78:	e9 72 ff ff ff       	jmp    8009ef <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a7d:	0f b6 f8             	movzbl %al,%edi
+  800a80:	4c 89 ee             	mov    %r13,%rsi
+  800a83:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a86:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a8a:	49 83 c4 01          	add    $0x1,%r12
+  800a8e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800a94:	84 c0                	test   %al,%al
+  800a96:	0f 84 66 ff ff ff    	je     800a02 <vprintfmt+0x25e>
+  800a9c:	45 85 ff             	test   %r15d,%r15d
+  800a9f:	78 0a                	js     800aab <vprintfmt+0x307>
+  800aa1:	41 83 ef 01          	sub    $0x1,%r15d
+  800aa5:	0f 88 57 ff ff ff    	js     800a02 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800aab:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800aaf:	74 cc                	je     800a7d <vprintfmt+0x2d9>
+  800ab1:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800ab4:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800ab9:	80 fa 5e             	cmp    $0x5e,%dl
+  800abc:	77 c2                	ja     800a80 <vprintfmt+0x2dc>
+  800abe:	eb bd                	jmp    800a7d <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800ac0:	40 84 f6             	test   %sil,%sil
+  800ac3:	75 26                	jne    800aeb <vprintfmt+0x347>
+    switch (lflag) {
+  800ac5:	85 d2                	test   %edx,%edx
+  800ac7:	74 59                	je     800b22 <vprintfmt+0x37e>
+  800ac9:	83 fa 01             	cmp    $0x1,%edx
+  800acc:	74 7b                	je     800b49 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800ace:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad4:	0f 87 96 00 00 00    	ja     800b70 <vprintfmt+0x3cc>
+  800ada:	89 c2                	mov    %eax,%edx
+  800adc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae0:	83 c0 08             	add    $0x8,%eax
+  800ae3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae6:	4c 8b 22             	mov    (%rdx),%r12
+  800ae9:	eb 17                	jmp    800b02 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800aeb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aee:	83 f8 2f             	cmp    $0x2f,%eax
+  800af1:	77 21                	ja     800b14 <vprintfmt+0x370>
+  800af3:	89 c2                	mov    %eax,%edx
+  800af5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af9:	83 c0 08             	add    $0x8,%eax
+  800afc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aff:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800b02:	4d 85 e4             	test   %r12,%r12
+  800b05:	78 7a                	js     800b81 <vprintfmt+0x3dd>
+            num = i;
+  800b07:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800b0a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800b0f:	e9 50 02 00 00       	jmp    800d64 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b20:	eb dd                	jmp    800aff <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800b22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b25:	83 f8 2f             	cmp    $0x2f,%eax
+  800b28:	77 11                	ja     800b3b <vprintfmt+0x397>
+  800b2a:	89 c2                	mov    %eax,%edx
+  800b2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b30:	83 c0 08             	add    $0x8,%eax
+  800b33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b36:	4c 63 22             	movslq (%rdx),%r12
+  800b39:	eb c7                	jmp    800b02 <vprintfmt+0x35e>
+  800b3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b47:	eb ed                	jmp    800b36 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800b49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b4f:	77 11                	ja     800b62 <vprintfmt+0x3be>
+  800b51:	89 c2                	mov    %eax,%edx
+  800b53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b57:	83 c0 08             	add    $0x8,%eax
+  800b5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b5d:	4c 8b 22             	mov    (%rdx),%r12
+  800b60:	eb a0                	jmp    800b02 <vprintfmt+0x35e>
+  800b62:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b66:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6e:	eb ed                	jmp    800b5d <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800b70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7c:	e9 65 ff ff ff       	jmp    800ae6 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800b81:	4c 89 ee             	mov    %r13,%rsi
+  800b84:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b89:	41 ff d6             	call   *%r14
+                i = -i;
+  800b8c:	49 f7 dc             	neg    %r12
+  800b8f:	e9 73 ff ff ff       	jmp    800b07 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800b94:	40 84 f6             	test   %sil,%sil
+  800b97:	75 32                	jne    800bcb <vprintfmt+0x427>
+    switch (lflag) {
+  800b99:	85 d2                	test   %edx,%edx
+  800b9b:	74 5d                	je     800bfa <vprintfmt+0x456>
+  800b9d:	83 fa 01             	cmp    $0x1,%edx
+  800ba0:	0f 84 82 00 00 00    	je     800c28 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800ba6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba9:	83 f8 2f             	cmp    $0x2f,%eax
+  800bac:	0f 87 a5 00 00 00    	ja     800c57 <vprintfmt+0x4b3>
+  800bb2:	89 c2                	mov    %eax,%edx
+  800bb4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb8:	83 c0 08             	add    $0x8,%eax
+  800bbb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bbe:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800bc1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bc6:	e9 99 01 00 00       	jmp    800d64 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bcb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bce:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd1:	77 19                	ja     800bec <vprintfmt+0x448>
+  800bd3:	89 c2                	mov    %eax,%edx
+  800bd5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd9:	83 c0 08             	add    $0x8,%eax
+  800bdc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bdf:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800be2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800be7:	e9 78 01 00 00       	jmp    800d64 <vprintfmt+0x5c0>
+  800bec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf8:	eb e5                	jmp    800bdf <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800bfa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bfd:	83 f8 2f             	cmp    $0x2f,%eax
+  800c00:	77 18                	ja     800c1a <vprintfmt+0x476>
+  800c02:	89 c2                	mov    %eax,%edx
+  800c04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c08:	83 c0 08             	add    $0x8,%eax
+  800c0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c0e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800c10:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800c15:	e9 4a 01 00 00       	jmp    800d64 <vprintfmt+0x5c0>
+  800c1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c26:	eb e6                	jmp    800c0e <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800c28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c2b:	83 f8 2f             	cmp    $0x2f,%eax
+  800c2e:	77 19                	ja     800c49 <vprintfmt+0x4a5>
+  800c30:	89 c2                	mov    %eax,%edx
+  800c32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c36:	83 c0 08             	add    $0x8,%eax
+  800c39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c3c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c3f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800c44:	e9 1b 01 00 00       	jmp    800d64 <vprintfmt+0x5c0>
+  800c49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c55:	eb e5                	jmp    800c3c <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800c57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c63:	e9 56 ff ff ff       	jmp    800bbe <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800c68:	40 84 f6             	test   %sil,%sil
+  800c6b:	75 2e                	jne    800c9b <vprintfmt+0x4f7>
+    switch (lflag) {
+  800c6d:	85 d2                	test   %edx,%edx
+  800c6f:	74 59                	je     800cca <vprintfmt+0x526>
+  800c71:	83 fa 01             	cmp    $0x1,%edx
+  800c74:	74 7f                	je     800cf5 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800c76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	0f 87 9f 00 00 00    	ja     800d21 <vprintfmt+0x57d>
+  800c82:	89 c2                	mov    %eax,%edx
+  800c84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c88:	83 c0 08             	add    $0x8,%eax
+  800c8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c8e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c91:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c96:	e9 c9 00 00 00       	jmp    800d64 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c9b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c9e:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca1:	77 19                	ja     800cbc <vprintfmt+0x518>
+  800ca3:	89 c2                	mov    %eax,%edx
+  800ca5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ca9:	83 c0 08             	add    $0x8,%eax
+  800cac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800caf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800cb2:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cb7:	e9 a8 00 00 00       	jmp    800d64 <vprintfmt+0x5c0>
+  800cbc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc8:	eb e5                	jmp    800caf <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800cca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ccd:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd0:	77 15                	ja     800ce7 <vprintfmt+0x543>
+  800cd2:	89 c2                	mov    %eax,%edx
+  800cd4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cd8:	83 c0 08             	add    $0x8,%eax
+  800cdb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cde:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800ce0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800ce5:	eb 7d                	jmp    800d64 <vprintfmt+0x5c0>
+  800ce7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ceb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf3:	eb e9                	jmp    800cde <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800cf5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf8:	83 f8 2f             	cmp    $0x2f,%eax
+  800cfb:	77 16                	ja     800d13 <vprintfmt+0x56f>
+  800cfd:	89 c2                	mov    %eax,%edx
+  800cff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d03:	83 c0 08             	add    $0x8,%eax
+  800d06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d09:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d0c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800d11:	eb 51                	jmp    800d64 <vprintfmt+0x5c0>
+  800d13:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d17:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d1f:	eb e8                	jmp    800d09 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800d21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2d:	e9 5c ff ff ff       	jmp    800c8e <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800d32:	4c 89 ee             	mov    %r13,%rsi
+  800d35:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d3a:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800d3d:	4c 89 ee             	mov    %r13,%rsi
+  800d40:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d45:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800d48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800d4e:	77 47                	ja     800d97 <vprintfmt+0x5f3>
+  800d50:	89 c2                	mov    %eax,%edx
+  800d52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d56:	83 c0 08             	add    $0x8,%eax
+  800d59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d5c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d5f:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800d64:	48 83 ec 08          	sub    $0x8,%rsp
+  800d68:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800d6c:	0f 94 c0             	sete   %al
+  800d6f:	0f b6 c0             	movzbl %al,%eax
+  800d72:	50                   	push   %rax
+  800d73:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800d78:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800d7c:	4c 89 ee             	mov    %r13,%rsi
+  800d7f:	4c 89 f7             	mov    %r14,%rdi
+  800d82:	48 b8 99 06 80 00 00 	movabs $0x800699,%rax
+  800d89:	00 00 00 
+  800d8c:	ff d0                	call   *%rax
+            break;
+  800d8e:	48 83 c4 10          	add    $0x10,%rsp
+  800d92:	e9 3e fa ff ff       	jmp    8007d5 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800d97:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d9b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800da3:	eb b7                	jmp    800d5c <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800da5:	40 84 f6             	test   %sil,%sil
+  800da8:	75 2b                	jne    800dd5 <vprintfmt+0x631>
+    switch (lflag) {
+  800daa:	85 d2                	test   %edx,%edx
+  800dac:	74 56                	je     800e04 <vprintfmt+0x660>
+  800dae:	83 fa 01             	cmp    $0x1,%edx
+  800db1:	74 7f                	je     800e32 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800db3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800db6:	83 f8 2f             	cmp    $0x2f,%eax
+  800db9:	0f 87 a2 00 00 00    	ja     800e61 <vprintfmt+0x6bd>
+  800dbf:	89 c2                	mov    %eax,%edx
+  800dc1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dc5:	83 c0 08             	add    $0x8,%eax
+  800dc8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dcb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dce:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800dd3:	eb 8f                	jmp    800d64 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800dd5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dd8:	83 f8 2f             	cmp    $0x2f,%eax
+  800ddb:	77 19                	ja     800df6 <vprintfmt+0x652>
+  800ddd:	89 c2                	mov    %eax,%edx
+  800ddf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800de3:	83 c0 08             	add    $0x8,%eax
+  800de6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800de9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dec:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800df1:	e9 6e ff ff ff       	jmp    800d64 <vprintfmt+0x5c0>
+  800df6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dfa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dfe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e02:	eb e5                	jmp    800de9 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800e04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e07:	83 f8 2f             	cmp    $0x2f,%eax
+  800e0a:	77 18                	ja     800e24 <vprintfmt+0x680>
+  800e0c:	89 c2                	mov    %eax,%edx
+  800e0e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e12:	83 c0 08             	add    $0x8,%eax
+  800e15:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e18:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800e1a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800e1f:	e9 40 ff ff ff       	jmp    800d64 <vprintfmt+0x5c0>
+  800e24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e30:	eb e6                	jmp    800e18 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800e32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e35:	83 f8 2f             	cmp    $0x2f,%eax
+  800e38:	77 19                	ja     800e53 <vprintfmt+0x6af>
+  800e3a:	89 c2                	mov    %eax,%edx
+  800e3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e40:	83 c0 08             	add    $0x8,%eax
+  800e43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e46:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e49:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800e4e:	e9 11 ff ff ff       	jmp    800d64 <vprintfmt+0x5c0>
+  800e53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e5f:	eb e5                	jmp    800e46 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800e61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e6d:	e9 59 ff ff ff       	jmp    800dcb <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800e72:	4c 89 ee             	mov    %r13,%rsi
+  800e75:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e7a:	41 ff d6             	call   *%r14
+            break;
+  800e7d:	e9 53 f9 ff ff       	jmp    8007d5 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800e82:	4c 89 ee             	mov    %r13,%rsi
+  800e85:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e8a:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800e8d:	48 83 eb 01          	sub    $0x1,%rbx
+  800e91:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e95:	75 f6                	jne    800e8d <vprintfmt+0x6e9>
+  800e97:	e9 39 f9 ff ff       	jmp    8007d5 <vprintfmt+0x31>
+}
+  800e9c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ea0:	5b                   	pop    %rbx
+  800ea1:	41 5c                	pop    %r12
+  800ea3:	41 5d                	pop    %r13
+  800ea5:	41 5e                	pop    %r14
+  800ea7:	41 5f                	pop    %r15
+  800ea9:	5d                   	pop    %rbp
+  800eaa:	c3                   	ret
+
+0000000000800eab <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800eab:	55                   	push   %rbp
+  800eac:	48 89 e5             	mov    %rsp,%rbp
+  800eaf:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800eb3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800eb7:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ebc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ec0:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ec7:	48 85 ff             	test   %rdi,%rdi
+  800eca:	74 2b                	je     800ef7 <vsnprintf+0x4c>
+  800ecc:	48 85 f6             	test   %rsi,%rsi
+  800ecf:	74 26                	je     800ef7 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ed1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ed5:	48 bf 4f 07 80 00 00 	movabs $0x80074f,%rdi
+  800edc:	00 00 00 
+  800edf:	48 b8 a4 07 80 00 00 	movabs $0x8007a4,%rax
+  800ee6:	00 00 00 
+  800ee9:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800eeb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800eef:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ef2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ef5:	c9                   	leave
+  800ef6:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ef7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800efc:	eb f7                	jmp    800ef5 <vsnprintf+0x4a>
+
+0000000000800efe <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800efe:	55                   	push   %rbp
+  800eff:	48 89 e5             	mov    %rsp,%rbp
+  800f02:	48 83 ec 50          	sub    $0x50,%rsp
+  800f06:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f0a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f0e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800f12:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800f19:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f21:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f25:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800f29:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800f2d:	48 b8 ab 0e 80 00 00 	movabs $0x800eab,%rax
+  800f34:	00 00 00 
+  800f37:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800f39:	c9                   	leave
+  800f3a:	c3                   	ret
+
+0000000000800f3b <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800f3b:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800f3e:	74 10                	je     800f50 <strlen+0x15>
+    size_t n = 0;
+  800f40:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800f45:	48 83 c0 01          	add    $0x1,%rax
+  800f49:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800f4d:	75 f6                	jne    800f45 <strlen+0xa>
+  800f4f:	c3                   	ret
+    size_t n = 0;
+  800f50:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800f55:	c3                   	ret
+
+0000000000800f56 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800f56:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800f59:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800f5e:	48 85 f6             	test   %rsi,%rsi
+  800f61:	74 11                	je     800f74 <strnlen+0x1e>
+  800f63:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800f67:	74 0c                	je     800f75 <strnlen+0x1f>
+  800f69:	48 83 c2 01          	add    $0x1,%rdx
+  800f6d:	48 39 d0             	cmp    %rdx,%rax
+  800f70:	75 f1                	jne    800f63 <strnlen+0xd>
+  800f72:	eb 04                	jmp    800f78 <strnlen+0x22>
+  800f74:	c3                   	ret
+  800f75:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800f78:	c3                   	ret
+
+0000000000800f79 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800f79:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800f7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f81:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f85:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800f88:	48 83 c2 01          	add    $0x1,%rdx
+  800f8c:	84 c9                	test   %cl,%cl
+  800f8e:	75 f1                	jne    800f81 <strcpy+0x8>
+        ;
+    return res;
+}
+  800f90:	c3                   	ret
+
+0000000000800f91 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800f91:	55                   	push   %rbp
+  800f92:	48 89 e5             	mov    %rsp,%rbp
+  800f95:	41 54                	push   %r12
+  800f97:	53                   	push   %rbx
+  800f98:	48 89 fb             	mov    %rdi,%rbx
+  800f9b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f9e:	48 b8 3b 0f 80 00 00 	movabs $0x800f3b,%rax
+  800fa5:	00 00 00 
+  800fa8:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800faa:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800fae:	4c 89 e6             	mov    %r12,%rsi
+  800fb1:	48 b8 79 0f 80 00 00 	movabs $0x800f79,%rax
+  800fb8:	00 00 00 
+  800fbb:	ff d0                	call   *%rax
+    return dst;
+}
+  800fbd:	48 89 d8             	mov    %rbx,%rax
+  800fc0:	5b                   	pop    %rbx
+  800fc1:	41 5c                	pop    %r12
+  800fc3:	5d                   	pop    %rbp
+  800fc4:	c3                   	ret
+
+0000000000800fc5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800fc5:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800fc8:	48 85 d2             	test   %rdx,%rdx
+  800fcb:	74 1f                	je     800fec <strncpy+0x27>
+  800fcd:	48 01 fa             	add    %rdi,%rdx
+  800fd0:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800fd3:	48 83 c1 01          	add    $0x1,%rcx
+  800fd7:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800fdb:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800fdf:	41 80 f8 01          	cmp    $0x1,%r8b
+  800fe3:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800fe7:	48 39 ca             	cmp    %rcx,%rdx
+  800fea:	75 e7                	jne    800fd3 <strncpy+0xe>
+    }
+    return ret;
+}
+  800fec:	c3                   	ret
+
+0000000000800fed <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800fed:	48 89 f8             	mov    %rdi,%rax
+  800ff0:	48 85 d2             	test   %rdx,%rdx
+  800ff3:	74 24                	je     801019 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ff5:	48 83 ea 01          	sub    $0x1,%rdx
+  800ff9:	74 1b                	je     801016 <strlcpy+0x29>
+  800ffb:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800fff:	0f b6 16             	movzbl (%rsi),%edx
+  801002:	84 d2                	test   %dl,%dl
+  801004:	74 10                	je     801016 <strlcpy+0x29>
+            *dst++ = *src++;
+  801006:	48 83 c6 01          	add    $0x1,%rsi
+  80100a:	48 83 c0 01          	add    $0x1,%rax
+  80100e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801011:	48 39 c8             	cmp    %rcx,%rax
+  801014:	75 e9                	jne    800fff <strlcpy+0x12>
+        *dst = '\0';
+  801016:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801019:	48 29 f8             	sub    %rdi,%rax
+}
+  80101c:	c3                   	ret
+
+000000000080101d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80101d:	0f b6 07             	movzbl (%rdi),%eax
+  801020:	84 c0                	test   %al,%al
+  801022:	74 13                	je     801037 <strcmp+0x1a>
+  801024:	38 06                	cmp    %al,(%rsi)
+  801026:	75 0f                	jne    801037 <strcmp+0x1a>
+  801028:	48 83 c7 01          	add    $0x1,%rdi
+  80102c:	48 83 c6 01          	add    $0x1,%rsi
+  801030:	0f b6 07             	movzbl (%rdi),%eax
+  801033:	84 c0                	test   %al,%al
+  801035:	75 ed                	jne    801024 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801037:	0f b6 c0             	movzbl %al,%eax
+  80103a:	0f b6 16             	movzbl (%rsi),%edx
+  80103d:	29 d0                	sub    %edx,%eax
+}
+  80103f:	c3                   	ret
+
+0000000000801040 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801040:	48 85 d2             	test   %rdx,%rdx
+  801043:	74 1f                	je     801064 <strncmp+0x24>
+  801045:	0f b6 07             	movzbl (%rdi),%eax
+  801048:	84 c0                	test   %al,%al
+  80104a:	74 1e                	je     80106a <strncmp+0x2a>
+  80104c:	3a 06                	cmp    (%rsi),%al
+  80104e:	75 1a                	jne    80106a <strncmp+0x2a>
+  801050:	48 83 c7 01          	add    $0x1,%rdi
+  801054:	48 83 c6 01          	add    $0x1,%rsi
+  801058:	48 83 ea 01          	sub    $0x1,%rdx
+  80105c:	75 e7                	jne    801045 <strncmp+0x5>
+
+    if (!n) return 0;
+  80105e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801063:	c3                   	ret
+  801064:	b8 00 00 00 00       	mov    $0x0,%eax
+  801069:	c3                   	ret
+  80106a:	48 85 d2             	test   %rdx,%rdx
+  80106d:	74 09                	je     801078 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80106f:	0f b6 07             	movzbl (%rdi),%eax
+  801072:	0f b6 16             	movzbl (%rsi),%edx
+  801075:	29 d0                	sub    %edx,%eax
+  801077:	c3                   	ret
+    if (!n) return 0;
+  801078:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80107d:	c3                   	ret
+
+000000000080107e <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80107e:	0f b6 17             	movzbl (%rdi),%edx
+  801081:	84 d2                	test   %dl,%dl
+  801083:	74 18                	je     80109d <strchr+0x1f>
+        if (*str == c) {
+  801085:	0f be d2             	movsbl %dl,%edx
+  801088:	39 f2                	cmp    %esi,%edx
+  80108a:	74 17                	je     8010a3 <strchr+0x25>
+    for (; *str; str++) {
+  80108c:	48 83 c7 01          	add    $0x1,%rdi
+  801090:	0f b6 17             	movzbl (%rdi),%edx
+  801093:	84 d2                	test   %dl,%dl
+  801095:	75 ee                	jne    801085 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801097:	b8 00 00 00 00       	mov    $0x0,%eax
+  80109c:	c3                   	ret
+  80109d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a2:	c3                   	ret
+  8010a3:	48 89 f8             	mov    %rdi,%rax
+}
+  8010a6:	c3                   	ret
+
+00000000008010a7 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8010a7:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8010aa:	0f b6 17             	movzbl (%rdi),%edx
+  8010ad:	84 d2                	test   %dl,%dl
+  8010af:	74 13                	je     8010c4 <strfind+0x1d>
+  8010b1:	0f be d2             	movsbl %dl,%edx
+  8010b4:	39 f2                	cmp    %esi,%edx
+  8010b6:	74 0b                	je     8010c3 <strfind+0x1c>
+  8010b8:	48 83 c0 01          	add    $0x1,%rax
+  8010bc:	0f b6 10             	movzbl (%rax),%edx
+  8010bf:	84 d2                	test   %dl,%dl
+  8010c1:	75 ee                	jne    8010b1 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8010c3:	c3                   	ret
+  8010c4:	c3                   	ret
+
+00000000008010c5 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8010c5:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8010c8:	48 89 f8             	mov    %rdi,%rax
+  8010cb:	48 f7 d8             	neg    %rax
+  8010ce:	83 e0 07             	and    $0x7,%eax
+  8010d1:	49 89 d1             	mov    %rdx,%r9
+  8010d4:	49 29 c1             	sub    %rax,%r9
+  8010d7:	78 36                	js     80110f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8010d9:	40 0f b6 c6          	movzbl %sil,%eax
+  8010dd:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8010e4:	01 01 01 
+  8010e7:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8010eb:	40 f6 c7 07          	test   $0x7,%dil
+  8010ef:	75 38                	jne    801129 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8010f1:	4c 89 c9             	mov    %r9,%rcx
+  8010f4:	48 c1 f9 03          	sar    $0x3,%rcx
+  8010f8:	74 0c                	je     801106 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8010fa:	fc                   	cld
+  8010fb:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8010fe:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801102:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801106:	4d 85 c9             	test   %r9,%r9
+  801109:	75 45                	jne    801150 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80110b:	4c 89 c0             	mov    %r8,%rax
+  80110e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80110f:	48 85 d2             	test   %rdx,%rdx
+  801112:	74 f7                	je     80110b <memset+0x46>
+  801114:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801117:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80111a:	48 83 c0 01          	add    $0x1,%rax
+  80111e:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801122:	48 39 c2             	cmp    %rax,%rdx
+  801125:	75 f3                	jne    80111a <memset+0x55>
+  801127:	eb e2                	jmp    80110b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801129:	40 f6 c7 01          	test   $0x1,%dil
+  80112d:	74 06                	je     801135 <memset+0x70>
+  80112f:	88 07                	mov    %al,(%rdi)
+  801131:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801135:	40 f6 c7 02          	test   $0x2,%dil
+  801139:	74 07                	je     801142 <memset+0x7d>
+  80113b:	66 89 07             	mov    %ax,(%rdi)
+  80113e:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801142:	40 f6 c7 04          	test   $0x4,%dil
+  801146:	74 a9                	je     8010f1 <memset+0x2c>
+  801148:	89 07                	mov    %eax,(%rdi)
+  80114a:	48 83 c7 04          	add    $0x4,%rdi
+  80114e:	eb a1                	jmp    8010f1 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801150:	41 f6 c1 04          	test   $0x4,%r9b
+  801154:	74 06                	je     80115c <memset+0x97>
+  801156:	89 07                	mov    %eax,(%rdi)
+  801158:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80115c:	41 f6 c1 02          	test   $0x2,%r9b
+  801160:	74 07                	je     801169 <memset+0xa4>
+  801162:	66 89 07             	mov    %ax,(%rdi)
+  801165:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801169:	41 f6 c1 01          	test   $0x1,%r9b
+  80116d:	74 9c                	je     80110b <memset+0x46>
+  80116f:	88 07                	mov    %al,(%rdi)
+  801171:	eb 98                	jmp    80110b <memset+0x46>
+
+0000000000801173 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801173:	48 89 f8             	mov    %rdi,%rax
+  801176:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801179:	48 39 fe             	cmp    %rdi,%rsi
+  80117c:	73 3b                	jae    8011b9 <memmove+0x46>
+  80117e:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801182:	48 39 d7             	cmp    %rdx,%rdi
+  801185:	73 32                	jae    8011b9 <memmove+0x46>
+        s += n;
+        d += n;
+  801187:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80118b:	48 89 d6             	mov    %rdx,%rsi
+  80118e:	48 09 fe             	or     %rdi,%rsi
+  801191:	48 09 ce             	or     %rcx,%rsi
+  801194:	40 f6 c6 07          	test   $0x7,%sil
+  801198:	75 12                	jne    8011ac <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80119a:	48 83 ef 08          	sub    $0x8,%rdi
+  80119e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8011a2:	48 c1 e9 03          	shr    $0x3,%rcx
+  8011a6:	fd                   	std
+  8011a7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8011aa:	fc                   	cld
+  8011ab:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8011ac:	48 83 ef 01          	sub    $0x1,%rdi
+  8011b0:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8011b4:	fd                   	std
+  8011b5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8011b7:	eb f1                	jmp    8011aa <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8011b9:	48 89 f2             	mov    %rsi,%rdx
+  8011bc:	48 09 c2             	or     %rax,%rdx
+  8011bf:	48 09 ca             	or     %rcx,%rdx
+  8011c2:	f6 c2 07             	test   $0x7,%dl
+  8011c5:	75 0c                	jne    8011d3 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8011c7:	48 c1 e9 03          	shr    $0x3,%rcx
+  8011cb:	48 89 c7             	mov    %rax,%rdi
+  8011ce:	fc                   	cld
+  8011cf:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8011d2:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8011d3:	48 89 c7             	mov    %rax,%rdi
+  8011d6:	fc                   	cld
+  8011d7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8011d9:	c3                   	ret
+
+00000000008011da <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8011da:	55                   	push   %rbp
+  8011db:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8011de:	48 b8 73 11 80 00 00 	movabs $0x801173,%rax
+  8011e5:	00 00 00 
+  8011e8:	ff d0                	call   *%rax
+}
+  8011ea:	5d                   	pop    %rbp
+  8011eb:	c3                   	ret
+
+00000000008011ec <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8011ec:	55                   	push   %rbp
+  8011ed:	48 89 e5             	mov    %rsp,%rbp
+  8011f0:	41 57                	push   %r15
+  8011f2:	41 56                	push   %r14
+  8011f4:	41 55                	push   %r13
+  8011f6:	41 54                	push   %r12
+  8011f8:	53                   	push   %rbx
+  8011f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8011fd:	49 89 fe             	mov    %rdi,%r14
+  801200:	49 89 f7             	mov    %rsi,%r15
+  801203:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801206:	48 89 f7             	mov    %rsi,%rdi
+  801209:	48 b8 3b 0f 80 00 00 	movabs $0x800f3b,%rax
+  801210:	00 00 00 
+  801213:	ff d0                	call   *%rax
+  801215:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801218:	48 89 de             	mov    %rbx,%rsi
+  80121b:	4c 89 f7             	mov    %r14,%rdi
+  80121e:	48 b8 56 0f 80 00 00 	movabs $0x800f56,%rax
+  801225:	00 00 00 
+  801228:	ff d0                	call   *%rax
+  80122a:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80122d:	48 39 c3             	cmp    %rax,%rbx
+  801230:	74 36                	je     801268 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801232:	48 89 d8             	mov    %rbx,%rax
+  801235:	4c 29 e8             	sub    %r13,%rax
+  801238:	49 39 c4             	cmp    %rax,%r12
+  80123b:	73 31                	jae    80126e <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80123d:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801242:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801246:	4c 89 fe             	mov    %r15,%rsi
+  801249:	48 b8 da 11 80 00 00 	movabs $0x8011da,%rax
+  801250:	00 00 00 
+  801253:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801255:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801259:	48 83 c4 08          	add    $0x8,%rsp
+  80125d:	5b                   	pop    %rbx
+  80125e:	41 5c                	pop    %r12
+  801260:	41 5d                	pop    %r13
+  801262:	41 5e                	pop    %r14
+  801264:	41 5f                	pop    %r15
+  801266:	5d                   	pop    %rbp
+  801267:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801268:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80126c:	eb eb                	jmp    801259 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80126e:	48 83 eb 01          	sub    $0x1,%rbx
+  801272:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801276:	48 89 da             	mov    %rbx,%rdx
+  801279:	4c 89 fe             	mov    %r15,%rsi
+  80127c:	48 b8 da 11 80 00 00 	movabs $0x8011da,%rax
+  801283:	00 00 00 
+  801286:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801288:	49 01 de             	add    %rbx,%r14
+  80128b:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801290:	eb c3                	jmp    801255 <strlcat+0x69>
+
+0000000000801292 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801292:	48 85 d2             	test   %rdx,%rdx
+  801295:	74 2d                	je     8012c4 <memcmp+0x32>
+  801297:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80129c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8012a0:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8012a5:	44 38 c1             	cmp    %r8b,%cl
+  8012a8:	75 0f                	jne    8012b9 <memcmp+0x27>
+    while (n-- > 0) {
+  8012aa:	48 83 c0 01          	add    $0x1,%rax
+  8012ae:	48 39 c2             	cmp    %rax,%rdx
+  8012b1:	75 e9                	jne    80129c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8012b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b8:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8012b9:	0f b6 c1             	movzbl %cl,%eax
+  8012bc:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8012c0:	44 29 c0             	sub    %r8d,%eax
+  8012c3:	c3                   	ret
+    return 0;
+  8012c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012c9:	c3                   	ret
+
+00000000008012ca <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8012ca:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8012ce:	48 39 c7             	cmp    %rax,%rdi
+  8012d1:	73 0f                	jae    8012e2 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8012d3:	40 38 37             	cmp    %sil,(%rdi)
+  8012d6:	74 0e                	je     8012e6 <memfind+0x1c>
+    for (; src < end; src++) {
+  8012d8:	48 83 c7 01          	add    $0x1,%rdi
+  8012dc:	48 39 f8             	cmp    %rdi,%rax
+  8012df:	75 f2                	jne    8012d3 <memfind+0x9>
+  8012e1:	c3                   	ret
+  8012e2:	48 89 f8             	mov    %rdi,%rax
+  8012e5:	c3                   	ret
+  8012e6:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8012e9:	c3                   	ret
+
+00000000008012ea <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8012ea:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8012ed:	0f b6 37             	movzbl (%rdi),%esi
+  8012f0:	40 80 fe 20          	cmp    $0x20,%sil
+  8012f4:	74 06                	je     8012fc <strtol+0x12>
+  8012f6:	40 80 fe 09          	cmp    $0x9,%sil
+  8012fa:	75 13                	jne    80130f <strtol+0x25>
+  8012fc:	48 83 c7 01          	add    $0x1,%rdi
+  801300:	0f b6 37             	movzbl (%rdi),%esi
+  801303:	40 80 fe 20          	cmp    $0x20,%sil
+  801307:	74 f3                	je     8012fc <strtol+0x12>
+  801309:	40 80 fe 09          	cmp    $0x9,%sil
+  80130d:	74 ed                	je     8012fc <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80130f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801312:	83 e0 fd             	and    $0xfffffffd,%eax
+  801315:	3c 01                	cmp    $0x1,%al
+  801317:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80131b:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801321:	75 0f                	jne    801332 <strtol+0x48>
+  801323:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801326:	74 14                	je     80133c <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801328:	85 d2                	test   %edx,%edx
+  80132a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80132f:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801332:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801337:	4c 63 ca             	movslq %edx,%r9
+  80133a:	eb 36                	jmp    801372 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80133c:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801340:	74 0f                	je     801351 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801342:	85 d2                	test   %edx,%edx
+  801344:	75 ec                	jne    801332 <strtol+0x48>
+        s++;
+  801346:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80134a:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80134f:	eb e1                	jmp    801332 <strtol+0x48>
+        s += 2;
+  801351:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801355:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80135a:	eb d6                	jmp    801332 <strtol+0x48>
+            dig -= '0';
+  80135c:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80135f:	44 0f b6 c1          	movzbl %cl,%r8d
+  801363:	41 39 d0             	cmp    %edx,%r8d
+  801366:	7d 21                	jge    801389 <strtol+0x9f>
+        val = val * base + dig;
+  801368:	49 0f af c1          	imul   %r9,%rax
+  80136c:	0f b6 c9             	movzbl %cl,%ecx
+  80136f:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801372:	48 83 c7 01          	add    $0x1,%rdi
+  801376:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80137a:	80 f9 39             	cmp    $0x39,%cl
+  80137d:	76 dd                	jbe    80135c <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80137f:	80 f9 7b             	cmp    $0x7b,%cl
+  801382:	77 05                	ja     801389 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801384:	83 e9 57             	sub    $0x57,%ecx
+  801387:	eb d6                	jmp    80135f <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801389:	4d 85 d2             	test   %r10,%r10
+  80138c:	74 03                	je     801391 <strtol+0xa7>
+  80138e:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801391:	48 89 c2             	mov    %rax,%rdx
+  801394:	48 f7 da             	neg    %rdx
+  801397:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80139b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80139f:	c3                   	ret
+
+00000000008013a0 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8013a0:	55                   	push   %rbp
+  8013a1:	48 89 e5             	mov    %rsp,%rbp
+  8013a4:	53                   	push   %rbx
+  8013a5:	48 89 fa             	mov    %rdi,%rdx
+  8013a8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ab:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8013bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c5:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8013c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013cb:	c9                   	leave
+  8013cc:	c3                   	ret
+
+00000000008013cd <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8013cd:	55                   	push   %rbp
+  8013ce:	48 89 e5             	mov    %rsp,%rbp
+  8013d1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d2:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f6:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013fc:	c9                   	leave
+  8013fd:	c3                   	ret
+
+00000000008013fe <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8013fe:	55                   	push   %rbp
+  8013ff:	48 89 e5             	mov    %rsp,%rbp
+  801402:	53                   	push   %rbx
+  801403:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801407:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80140a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80140f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801414:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801419:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80141e:	be 00 00 00 00       	mov    $0x0,%esi
+  801423:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801429:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80142b:	48 85 c0             	test   %rax,%rax
+  80142e:	7f 06                	jg     801436 <sys_env_destroy+0x38>
+}
+  801430:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801434:	c9                   	leave
+  801435:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801436:	49 89 c0             	mov    %rax,%r8
+  801439:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80143e:	48 ba 50 38 80 00 00 	movabs $0x803850,%rdx
+  801445:	00 00 00 
+  801448:	be 26 00 00 00       	mov    $0x26,%esi
+  80144d:	48 bf 6f 38 80 00 00 	movabs $0x80386f,%rdi
+  801454:	00 00 00 
+  801457:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145c:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  801463:	00 00 00 
+  801466:	41 ff d1             	call   *%r9
+
+0000000000801469 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801469:	55                   	push   %rbp
+  80146a:	48 89 e5             	mov    %rsp,%rbp
+  80146d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80146e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801473:	ba 00 00 00 00       	mov    $0x0,%edx
+  801478:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80147d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801482:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801487:	be 00 00 00 00       	mov    $0x0,%esi
+  80148c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801492:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801494:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801498:	c9                   	leave
+  801499:	c3                   	ret
+
+000000000080149a <sys_yield>:
+
+void
+sys_yield(void) {
+  80149a:	55                   	push   %rbp
+  80149b:	48 89 e5             	mov    %rsp,%rbp
+  80149e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80149f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c3:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c9:	c9                   	leave
+  8014ca:	c3                   	ret
+
+00000000008014cb <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8014cb:	55                   	push   %rbp
+  8014cc:	48 89 e5             	mov    %rsp,%rbp
+  8014cf:	53                   	push   %rbx
+  8014d0:	48 89 fa             	mov    %rdi,%rdx
+  8014d3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014db:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8014e2:	00 00 00 
+  8014e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f5:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8014f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014fb:	c9                   	leave
+  8014fc:	c3                   	ret
+
+00000000008014fd <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8014fd:	55                   	push   %rbp
+  8014fe:	48 89 e5             	mov    %rsp,%rbp
+  801501:	53                   	push   %rbx
+  801502:	49 89 f8             	mov    %rdi,%r8
+  801505:	48 89 d3             	mov    %rdx,%rbx
+  801508:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80150b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801510:	4c 89 c2             	mov    %r8,%rdx
+  801513:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801516:	be 00 00 00 00       	mov    $0x0,%esi
+  80151b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801521:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801523:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801527:	c9                   	leave
+  801528:	c3                   	ret
+
+0000000000801529 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801529:	55                   	push   %rbp
+  80152a:	48 89 e5             	mov    %rsp,%rbp
+  80152d:	53                   	push   %rbx
+  80152e:	48 83 ec 08          	sub    $0x8,%rsp
+  801532:	89 f8                	mov    %edi,%eax
+  801534:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801537:	48 63 f9             	movslq %ecx,%rdi
+  80153a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80153d:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801542:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801545:	be 00 00 00 00       	mov    $0x0,%esi
+  80154a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801550:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801552:	48 85 c0             	test   %rax,%rax
+  801555:	7f 06                	jg     80155d <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801557:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80155b:	c9                   	leave
+  80155c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80155d:	49 89 c0             	mov    %rax,%r8
+  801560:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801565:	48 ba 50 38 80 00 00 	movabs $0x803850,%rdx
+  80156c:	00 00 00 
+  80156f:	be 26 00 00 00       	mov    $0x26,%esi
+  801574:	48 bf 6f 38 80 00 00 	movabs $0x80386f,%rdi
+  80157b:	00 00 00 
+  80157e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801583:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  80158a:	00 00 00 
+  80158d:	41 ff d1             	call   *%r9
+
+0000000000801590 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801590:	55                   	push   %rbp
+  801591:	48 89 e5             	mov    %rsp,%rbp
+  801594:	53                   	push   %rbx
+  801595:	48 83 ec 08          	sub    $0x8,%rsp
+  801599:	89 f8                	mov    %edi,%eax
+  80159b:	49 89 f2             	mov    %rsi,%r10
+  80159e:	48 89 cf             	mov    %rcx,%rdi
+  8015a1:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8015a4:	48 63 da             	movslq %edx,%rbx
+  8015a7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015aa:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015af:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b2:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8015b5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015b7:	48 85 c0             	test   %rax,%rax
+  8015ba:	7f 06                	jg     8015c2 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8015bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c0:	c9                   	leave
+  8015c1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015c2:	49 89 c0             	mov    %rax,%r8
+  8015c5:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8015ca:	48 ba 50 38 80 00 00 	movabs $0x803850,%rdx
+  8015d1:	00 00 00 
+  8015d4:	be 26 00 00 00       	mov    $0x26,%esi
+  8015d9:	48 bf 6f 38 80 00 00 	movabs $0x80386f,%rdi
+  8015e0:	00 00 00 
+  8015e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e8:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  8015ef:	00 00 00 
+  8015f2:	41 ff d1             	call   *%r9
+
+00000000008015f5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8015f5:	55                   	push   %rbp
+  8015f6:	48 89 e5             	mov    %rsp,%rbp
+  8015f9:	53                   	push   %rbx
+  8015fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8015fe:	48 89 f1             	mov    %rsi,%rcx
+  801601:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801604:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801607:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80160c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801611:	be 00 00 00 00       	mov    $0x0,%esi
+  801616:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80161c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80161e:	48 85 c0             	test   %rax,%rax
+  801621:	7f 06                	jg     801629 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801623:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801627:	c9                   	leave
+  801628:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801629:	49 89 c0             	mov    %rax,%r8
+  80162c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801631:	48 ba 50 38 80 00 00 	movabs $0x803850,%rdx
+  801638:	00 00 00 
+  80163b:	be 26 00 00 00       	mov    $0x26,%esi
+  801640:	48 bf 6f 38 80 00 00 	movabs $0x80386f,%rdi
+  801647:	00 00 00 
+  80164a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164f:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  801656:	00 00 00 
+  801659:	41 ff d1             	call   *%r9
+
+000000000080165c <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  80165c:	55                   	push   %rbp
+  80165d:	48 89 e5             	mov    %rsp,%rbp
+  801660:	53                   	push   %rbx
+  801661:	48 83 ec 08          	sub    $0x8,%rsp
+  801665:	89 f8                	mov    %edi,%eax
+  801667:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  80166a:	48 63 f9             	movslq %ecx,%rdi
+  80166d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801670:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801675:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801678:	be 00 00 00 00       	mov    $0x0,%esi
+  80167d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801683:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801685:	48 85 c0             	test   %rax,%rax
+  801688:	7f 06                	jg     801690 <sys_region_advise+0x34>
+}
+  80168a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80168e:	c9                   	leave
+  80168f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801690:	49 89 c0             	mov    %rax,%r8
+  801693:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801698:	48 ba 50 38 80 00 00 	movabs $0x803850,%rdx
+  80169f:	00 00 00 
+  8016a2:	be 26 00 00 00       	mov    $0x26,%esi
+  8016a7:	48 bf 6f 38 80 00 00 	movabs $0x80386f,%rdi
+  8016ae:	00 00 00 
+  8016b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b6:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  8016bd:	00 00 00 
+  8016c0:	41 ff d1             	call   *%r9
+
+00000000008016c3 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  8016c3:	55                   	push   %rbp
+  8016c4:	48 89 e5             	mov    %rsp,%rbp
+  8016c7:	53                   	push   %rbx
+  8016c8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  8016cc:	48 63 ce             	movslq %esi,%rcx
+  8016cf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d2:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016ee:	48 85 c0             	test   %rax,%rax
+  8016f1:	7f 06                	jg     8016f9 <sys_env_set_nice+0x36>
+}
+  8016f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f7:	c9                   	leave
+  8016f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016f9:	49 89 c0             	mov    %rax,%r8
+  8016fc:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801701:	48 ba 50 38 80 00 00 	movabs $0x803850,%rdx
+  801708:	00 00 00 
+  80170b:	be 26 00 00 00       	mov    $0x26,%esi
+  801710:	48 bf 6f 38 80 00 00 	movabs $0x80386f,%rdi
+  801717:	00 00 00 
+  80171a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80171f:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  801726:	00 00 00 
+  801729:	41 ff d1             	call   *%r9
+
+000000000080172c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80172c:	55                   	push   %rbp
+  80172d:	48 89 e5             	mov    %rsp,%rbp
+  801730:	53                   	push   %rbx
+  801731:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801735:	48 63 ce             	movslq %esi,%rcx
+  801738:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80173b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801740:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801745:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80174a:	be 00 00 00 00       	mov    $0x0,%esi
+  80174f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801755:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801757:	48 85 c0             	test   %rax,%rax
+  80175a:	7f 06                	jg     801762 <sys_env_set_status+0x36>
+}
+  80175c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801760:	c9                   	leave
+  801761:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801762:	49 89 c0             	mov    %rax,%r8
+  801765:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80176a:	48 ba 50 38 80 00 00 	movabs $0x803850,%rdx
+  801771:	00 00 00 
+  801774:	be 26 00 00 00       	mov    $0x26,%esi
+  801779:	48 bf 6f 38 80 00 00 	movabs $0x80386f,%rdi
+  801780:	00 00 00 
+  801783:	b8 00 00 00 00       	mov    $0x0,%eax
+  801788:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  80178f:	00 00 00 
+  801792:	41 ff d1             	call   *%r9
+
+0000000000801795 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801795:	55                   	push   %rbp
+  801796:	48 89 e5             	mov    %rsp,%rbp
+  801799:	53                   	push   %rbx
+  80179a:	48 83 ec 08          	sub    $0x8,%rsp
+  80179e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8017a1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a4:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017c0:	48 85 c0             	test   %rax,%rax
+  8017c3:	7f 06                	jg     8017cb <sys_env_set_trapframe+0x36>
+}
+  8017c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c9:	c9                   	leave
+  8017ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017cb:	49 89 c0             	mov    %rax,%r8
+  8017ce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8017d3:	48 ba 50 38 80 00 00 	movabs $0x803850,%rdx
+  8017da:	00 00 00 
+  8017dd:	be 26 00 00 00       	mov    $0x26,%esi
+  8017e2:	48 bf 6f 38 80 00 00 	movabs $0x80386f,%rdi
+  8017e9:	00 00 00 
+  8017ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f1:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  8017f8:	00 00 00 
+  8017fb:	41 ff d1             	call   *%r9
+
+00000000008017fe <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8017fe:	55                   	push   %rbp
+  8017ff:	48 89 e5             	mov    %rsp,%rbp
+  801802:	53                   	push   %rbx
+  801803:	48 83 ec 08          	sub    $0x8,%rsp
+  801807:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80180a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80180d:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801812:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801817:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80181c:	be 00 00 00 00       	mov    $0x0,%esi
+  801821:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801827:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801829:	48 85 c0             	test   %rax,%rax
+  80182c:	7f 06                	jg     801834 <sys_env_set_pgfault_upcall+0x36>
+}
+  80182e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801832:	c9                   	leave
+  801833:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801834:	49 89 c0             	mov    %rax,%r8
+  801837:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80183c:	48 ba 50 38 80 00 00 	movabs $0x803850,%rdx
+  801843:	00 00 00 
+  801846:	be 26 00 00 00       	mov    $0x26,%esi
+  80184b:	48 bf 6f 38 80 00 00 	movabs $0x80386f,%rdi
+  801852:	00 00 00 
+  801855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185a:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  801861:	00 00 00 
+  801864:	41 ff d1             	call   *%r9
+
+0000000000801867 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801867:	55                   	push   %rbp
+  801868:	48 89 e5             	mov    %rsp,%rbp
+  80186b:	53                   	push   %rbx
+  80186c:	89 f8                	mov    %edi,%eax
+  80186e:	49 89 f1             	mov    %rsi,%r9
+  801871:	48 89 d3             	mov    %rdx,%rbx
+  801874:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801877:	49 63 f0             	movslq %r8d,%rsi
+  80187a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80187d:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801882:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801885:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80188b:	cd 30                	int    $0x30
+}
+  80188d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801891:	c9                   	leave
+  801892:	c3                   	ret
+
+0000000000801893 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801893:	55                   	push   %rbp
+  801894:	48 89 e5             	mov    %rsp,%rbp
+  801897:	53                   	push   %rbx
+  801898:	48 83 ec 08          	sub    $0x8,%rsp
+  80189c:	48 89 fa             	mov    %rdi,%rdx
+  80189f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018a2:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018bc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018be:	48 85 c0             	test   %rax,%rax
+  8018c1:	7f 06                	jg     8018c9 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018c7:	c9                   	leave
+  8018c8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018c9:	49 89 c0             	mov    %rax,%r8
+  8018cc:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8018d1:	48 ba 50 38 80 00 00 	movabs $0x803850,%rdx
+  8018d8:	00 00 00 
+  8018db:	be 26 00 00 00       	mov    $0x26,%esi
+  8018e0:	48 bf 6f 38 80 00 00 	movabs $0x80386f,%rdi
+  8018e7:	00 00 00 
+  8018ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ef:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  8018f6:	00 00 00 
+  8018f9:	41 ff d1             	call   *%r9
+
+00000000008018fc <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8018fc:	55                   	push   %rbp
+  8018fd:	48 89 e5             	mov    %rsp,%rbp
+  801900:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801901:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801906:	ba 00 00 00 00       	mov    $0x0,%edx
+  80190b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801910:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801915:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80191a:	be 00 00 00 00       	mov    $0x0,%esi
+  80191f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801925:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801927:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80192b:	c9                   	leave
+  80192c:	c3                   	ret
+
+000000000080192d <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80192d:	55                   	push   %rbp
+  80192e:	48 89 e5             	mov    %rsp,%rbp
+  801931:	53                   	push   %rbx
+  801932:	48 83 ec 08          	sub    $0x8,%rsp
+  801936:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801939:	48 63 ce             	movslq %esi,%rcx
+  80193c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80193f:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801944:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801949:	be 00 00 00 00       	mov    $0x0,%esi
+  80194e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801954:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801956:	48 85 c0             	test   %rax,%rax
+  801959:	7f 06                	jg     801961 <sys_sigqueue+0x34>
+}
+  80195b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80195f:	c9                   	leave
+  801960:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801961:	49 89 c0             	mov    %rax,%r8
+  801964:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801969:	48 ba 50 38 80 00 00 	movabs $0x803850,%rdx
+  801970:	00 00 00 
+  801973:	be 26 00 00 00       	mov    $0x26,%esi
+  801978:	48 bf 6f 38 80 00 00 	movabs $0x80386f,%rdi
+  80197f:	00 00 00 
+  801982:	b8 00 00 00 00       	mov    $0x0,%eax
+  801987:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  80198e:	00 00 00 
+  801991:	41 ff d1             	call   *%r9
+
+0000000000801994 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801994:	55                   	push   %rbp
+  801995:	48 89 e5             	mov    %rsp,%rbp
+  801998:	53                   	push   %rbx
+  801999:	48 83 ec 08          	sub    $0x8,%rsp
+  80199d:	48 89 fa             	mov    %rdi,%rdx
+  8019a0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8019a3:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019bd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019bf:	48 85 c0             	test   %rax,%rax
+  8019c2:	7f 06                	jg     8019ca <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  8019c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019c8:	c9                   	leave
+  8019c9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019ca:	49 89 c0             	mov    %rax,%r8
+  8019cd:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8019d2:	48 ba 50 38 80 00 00 	movabs $0x803850,%rdx
+  8019d9:	00 00 00 
+  8019dc:	be 26 00 00 00       	mov    $0x26,%esi
+  8019e1:	48 bf 6f 38 80 00 00 	movabs $0x80386f,%rdi
+  8019e8:	00 00 00 
+  8019eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f0:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  8019f7:	00 00 00 
+  8019fa:	41 ff d1             	call   *%r9
+
+00000000008019fd <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  8019fd:	55                   	push   %rbp
+  8019fe:	48 89 e5             	mov    %rsp,%rbp
+  801a01:	53                   	push   %rbx
+  801a02:	48 83 ec 08          	sub    $0x8,%rsp
+  801a06:	48 89 f1             	mov    %rsi,%rcx
+  801a09:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801a0c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a0f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a14:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a19:	be 00 00 00 00       	mov    $0x0,%esi
+  801a1e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a24:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a26:	48 85 c0             	test   %rax,%rax
+  801a29:	7f 06                	jg     801a31 <sys_sigaction+0x34>
+}
+  801a2b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a2f:	c9                   	leave
+  801a30:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a31:	49 89 c0             	mov    %rax,%r8
+  801a34:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801a39:	48 ba 50 38 80 00 00 	movabs $0x803850,%rdx
+  801a40:	00 00 00 
+  801a43:	be 26 00 00 00       	mov    $0x26,%esi
+  801a48:	48 bf 6f 38 80 00 00 	movabs $0x80386f,%rdi
+  801a4f:	00 00 00 
+  801a52:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a57:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  801a5e:	00 00 00 
+  801a61:	41 ff d1             	call   *%r9
+
+0000000000801a64 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801a64:	55                   	push   %rbp
+  801a65:	48 89 e5             	mov    %rsp,%rbp
+  801a68:	53                   	push   %rbx
+  801a69:	48 83 ec 08          	sub    $0x8,%rsp
+  801a6d:	48 89 f1             	mov    %rsi,%rcx
+  801a70:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801a73:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a76:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a7b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a80:	be 00 00 00 00       	mov    $0x0,%esi
+  801a85:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a8b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a8d:	48 85 c0             	test   %rax,%rax
+  801a90:	7f 06                	jg     801a98 <sys_sigprocmask+0x34>
+}
+  801a92:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a96:	c9                   	leave
+  801a97:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a98:	49 89 c0             	mov    %rax,%r8
+  801a9b:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801aa0:	48 ba 50 38 80 00 00 	movabs $0x803850,%rdx
+  801aa7:	00 00 00 
+  801aaa:	be 26 00 00 00       	mov    $0x26,%esi
+  801aaf:	48 bf 6f 38 80 00 00 	movabs $0x80386f,%rdi
+  801ab6:	00 00 00 
+  801ab9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abe:	49 b9 04 05 80 00 00 	movabs $0x800504,%r9
+  801ac5:	00 00 00 
+  801ac8:	41 ff d1             	call   *%r9
+
+0000000000801acb <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  801acb:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  801ace:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  801ad2:	83 3f 01             	cmpl   $0x1,(%rdi)
+  801ad5:	7e 0f                	jle    801ae6 <argstart+0x1b>
+  801ad7:	48 b8 b0 32 80 00 00 	movabs $0x8032b0,%rax
+  801ade:	00 00 00 
+  801ae1:	48 85 f6             	test   %rsi,%rsi
+  801ae4:	75 05                	jne    801aeb <argstart+0x20>
+  801ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aeb:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  801aef:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  801af6:	00 
+}
+  801af7:	c3                   	ret
+
+0000000000801af8 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  801af8:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  801aff:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  801b00:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801b04:	48 85 c0             	test   %rax,%rax
+  801b07:	0f 84 8f 00 00 00    	je     801b9c <argnext+0xa4>
+argnext(struct Argstate *args) {
+  801b0d:	55                   	push   %rbp
+  801b0e:	48 89 e5             	mov    %rsp,%rbp
+  801b11:	53                   	push   %rbx
+  801b12:	48 83 ec 08          	sub    $0x8,%rsp
+  801b16:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  801b19:	80 38 00             	cmpb   $0x0,(%rax)
+  801b1c:	75 52                	jne    801b70 <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  801b1e:	48 8b 17             	mov    (%rdi),%rdx
+  801b21:	83 3a 01             	cmpl   $0x1,(%rdx)
+  801b24:	74 67                	je     801b8d <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  801b26:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  801b2a:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  801b2e:	80 38 2d             	cmpb   $0x2d,(%rax)
+  801b31:	75 5a                	jne    801b8d <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  801b33:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  801b37:	74 54                	je     801b8d <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  801b39:	48 83 c0 01          	add    $0x1,%rax
+  801b3d:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  801b41:	8b 12                	mov    (%rdx),%edx
+  801b43:	83 ea 01             	sub    $0x1,%edx
+  801b46:	48 63 d2             	movslq %edx,%rdx
+  801b49:	48 c1 e2 03          	shl    $0x3,%rdx
+  801b4d:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  801b51:	48 83 c7 08          	add    $0x8,%rdi
+  801b55:	48 b8 73 11 80 00 00 	movabs $0x801173,%rax
+  801b5c:	00 00 00 
+  801b5f:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  801b61:	48 8b 03             	mov    (%rbx),%rax
+  801b64:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  801b67:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801b6b:	80 38 2d             	cmpb   $0x2d,(%rax)
+  801b6e:	74 17                	je     801b87 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  801b70:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801b74:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  801b77:	48 83 c0 01          	add    $0x1,%rax
+  801b7b:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  801b7f:	89 d0                	mov    %edx,%eax
+  801b81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b85:	c9                   	leave
+  801b86:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  801b87:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  801b8b:	75 e3                	jne    801b70 <argnext+0x78>
+    args->curarg = 0;
+  801b8d:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801b94:	00 
+    return -1;
+  801b95:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801b9a:	eb e3                	jmp    801b7f <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  801b9c:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  801ba1:	89 d0                	mov    %edx,%eax
+  801ba3:	c3                   	ret
+
+0000000000801ba4 <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  801ba4:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801ba8:	48 85 c0             	test   %rax,%rax
+  801bab:	74 7b                	je     801c28 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  801bad:	55                   	push   %rbp
+  801bae:	48 89 e5             	mov    %rsp,%rbp
+  801bb1:	53                   	push   %rbx
+  801bb2:	48 83 ec 08          	sub    $0x8,%rsp
+  801bb6:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  801bb9:	80 38 00             	cmpb   $0x0,(%rax)
+  801bbc:	74 1c                	je     801bda <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  801bbe:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  801bc2:	48 b8 b0 32 80 00 00 	movabs $0x8032b0,%rax
+  801bc9:	00 00 00 
+  801bcc:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  801bd0:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  801bd4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bd8:	c9                   	leave
+  801bd9:	c3                   	ret
+    } else if (*args->argc > 1) {
+  801bda:	48 8b 07             	mov    (%rdi),%rax
+  801bdd:	83 38 01             	cmpl   $0x1,(%rax)
+  801be0:	7f 12                	jg     801bf4 <argnextvalue+0x50>
+        args->argvalue = 0;
+  801be2:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  801be9:	00 
+        args->curarg = 0;
+  801bea:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  801bf1:	00 
+  801bf2:	eb dc                	jmp    801bd0 <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  801bf4:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  801bf8:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  801bfc:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  801c00:	8b 10                	mov    (%rax),%edx
+  801c02:	83 ea 01             	sub    $0x1,%edx
+  801c05:	48 63 d2             	movslq %edx,%rdx
+  801c08:	48 c1 e2 03          	shl    $0x3,%rdx
+  801c0c:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  801c10:	48 83 c7 08          	add    $0x8,%rdi
+  801c14:	48 b8 73 11 80 00 00 	movabs $0x801173,%rax
+  801c1b:	00 00 00 
+  801c1e:	ff d0                	call   *%rax
+        (*args->argc)--;
+  801c20:	48 8b 03             	mov    (%rbx),%rax
+  801c23:	83 28 01             	subl   $0x1,(%rax)
+  801c26:	eb a8                	jmp    801bd0 <argnextvalue+0x2c>
+}
+  801c28:	c3                   	ret
+
+0000000000801c29 <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801c29:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  801c2d:	48 85 c0             	test   %rax,%rax
+  801c30:	74 01                	je     801c33 <argvalue+0xa>
+}
+  801c32:	c3                   	ret
+argvalue(struct Argstate *args) {
+  801c33:	55                   	push   %rbp
+  801c34:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801c37:	48 b8 a4 1b 80 00 00 	movabs $0x801ba4,%rax
+  801c3e:	00 00 00 
+  801c41:	ff d0                	call   *%rax
+}
+  801c43:	5d                   	pop    %rbp
+  801c44:	c3                   	ret
+
+0000000000801c45 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c45:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c4c:	ff ff ff 
+  801c4f:	48 01 f8             	add    %rdi,%rax
+  801c52:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801c56:	c3                   	ret
+
+0000000000801c57 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c57:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c5e:	ff ff ff 
+  801c61:	48 01 f8             	add    %rdi,%rax
+  801c64:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801c68:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801c6e:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801c72:	c3                   	ret
+
+0000000000801c73 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801c73:	55                   	push   %rbp
+  801c74:	48 89 e5             	mov    %rsp,%rbp
+  801c77:	41 57                	push   %r15
+  801c79:	41 56                	push   %r14
+  801c7b:	41 55                	push   %r13
+  801c7d:	41 54                	push   %r12
+  801c7f:	53                   	push   %rbx
+  801c80:	48 83 ec 08          	sub    $0x8,%rsp
+  801c84:	49 89 ff             	mov    %rdi,%r15
+  801c87:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801c8c:	49 bd 95 2d 80 00 00 	movabs $0x802d95,%r13
+  801c93:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801c96:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801c9c:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801c9f:	48 89 df             	mov    %rbx,%rdi
+  801ca2:	41 ff d5             	call   *%r13
+  801ca5:	83 e0 04             	and    $0x4,%eax
+  801ca8:	74 17                	je     801cc1 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801caa:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801cb1:	4c 39 f3             	cmp    %r14,%rbx
+  801cb4:	75 e6                	jne    801c9c <fd_alloc+0x29>
+  801cb6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801cbc:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801cc1:	4d 89 27             	mov    %r12,(%r15)
+}
+  801cc4:	48 83 c4 08          	add    $0x8,%rsp
+  801cc8:	5b                   	pop    %rbx
+  801cc9:	41 5c                	pop    %r12
+  801ccb:	41 5d                	pop    %r13
+  801ccd:	41 5e                	pop    %r14
+  801ccf:	41 5f                	pop    %r15
+  801cd1:	5d                   	pop    %rbp
+  801cd2:	c3                   	ret
+
+0000000000801cd3 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801cd3:	83 ff 1f             	cmp    $0x1f,%edi
+  801cd6:	77 39                	ja     801d11 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801cd8:	55                   	push   %rbp
+  801cd9:	48 89 e5             	mov    %rsp,%rbp
+  801cdc:	41 54                	push   %r12
+  801cde:	53                   	push   %rbx
+  801cdf:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ce2:	48 63 df             	movslq %edi,%rbx
+  801ce5:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801cec:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801cf0:	48 89 df             	mov    %rbx,%rdi
+  801cf3:	48 b8 95 2d 80 00 00 	movabs $0x802d95,%rax
+  801cfa:	00 00 00 
+  801cfd:	ff d0                	call   *%rax
+  801cff:	a8 04                	test   $0x4,%al
+  801d01:	74 14                	je     801d17 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801d03:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801d07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d0c:	5b                   	pop    %rbx
+  801d0d:	41 5c                	pop    %r12
+  801d0f:	5d                   	pop    %rbp
+  801d10:	c3                   	ret
+        return -E_INVAL;
+  801d11:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801d16:	c3                   	ret
+        return -E_INVAL;
+  801d17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d1c:	eb ee                	jmp    801d0c <fd_lookup+0x39>
+
+0000000000801d1e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801d1e:	55                   	push   %rbp
+  801d1f:	48 89 e5             	mov    %rsp,%rbp
+  801d22:	41 54                	push   %r12
+  801d24:	53                   	push   %rbx
+  801d25:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801d28:	48 b8 00 39 80 00 00 	movabs $0x803900,%rax
+  801d2f:	00 00 00 
+  801d32:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801d39:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801d3c:	39 3b                	cmp    %edi,(%rbx)
+  801d3e:	74 47                	je     801d87 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801d40:	48 83 c0 08          	add    $0x8,%rax
+  801d44:	48 8b 18             	mov    (%rax),%rbx
+  801d47:	48 85 db             	test   %rbx,%rbx
+  801d4a:	75 f0                	jne    801d3c <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801d4c:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  801d53:	00 00 00 
+  801d56:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d5c:	89 fa                	mov    %edi,%edx
+  801d5e:	48 bf 80 38 80 00 00 	movabs $0x803880,%rdi
+  801d65:	00 00 00 
+  801d68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6d:	48 b9 54 06 80 00 00 	movabs $0x800654,%rcx
+  801d74:	00 00 00 
+  801d77:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801d79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801d7e:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801d82:	5b                   	pop    %rbx
+  801d83:	41 5c                	pop    %r12
+  801d85:	5d                   	pop    %rbp
+  801d86:	c3                   	ret
+            return 0;
+  801d87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d8c:	eb f0                	jmp    801d7e <dev_lookup+0x60>
+
+0000000000801d8e <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801d8e:	55                   	push   %rbp
+  801d8f:	48 89 e5             	mov    %rsp,%rbp
+  801d92:	41 55                	push   %r13
+  801d94:	41 54                	push   %r12
+  801d96:	53                   	push   %rbx
+  801d97:	48 83 ec 18          	sub    $0x18,%rsp
+  801d9b:	48 89 fb             	mov    %rdi,%rbx
+  801d9e:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801da1:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801da8:	ff ff ff 
+  801dab:	48 01 df             	add    %rbx,%rdi
+  801dae:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801db2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801db6:	48 b8 d3 1c 80 00 00 	movabs $0x801cd3,%rax
+  801dbd:	00 00 00 
+  801dc0:	ff d0                	call   *%rax
+  801dc2:	41 89 c5             	mov    %eax,%r13d
+  801dc5:	85 c0                	test   %eax,%eax
+  801dc7:	78 06                	js     801dcf <fd_close+0x41>
+  801dc9:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801dcd:	74 1a                	je     801de9 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801dcf:	45 84 e4             	test   %r12b,%r12b
+  801dd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd7:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801ddb:	44 89 e8             	mov    %r13d,%eax
+  801dde:	48 83 c4 18          	add    $0x18,%rsp
+  801de2:	5b                   	pop    %rbx
+  801de3:	41 5c                	pop    %r12
+  801de5:	41 5d                	pop    %r13
+  801de7:	5d                   	pop    %rbp
+  801de8:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801de9:	8b 3b                	mov    (%rbx),%edi
+  801deb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801def:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  801df6:	00 00 00 
+  801df9:	ff d0                	call   *%rax
+  801dfb:	41 89 c5             	mov    %eax,%r13d
+  801dfe:	85 c0                	test   %eax,%eax
+  801e00:	78 1b                	js     801e1d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801e02:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e06:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e0a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e10:	48 85 c0             	test   %rax,%rax
+  801e13:	74 08                	je     801e1d <fd_close+0x8f>
+  801e15:	48 89 df             	mov    %rbx,%rdi
+  801e18:	ff d0                	call   *%rax
+  801e1a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801e1d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e22:	48 89 de             	mov    %rbx,%rsi
+  801e25:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e2a:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  801e31:	00 00 00 
+  801e34:	ff d0                	call   *%rax
+    return res;
+  801e36:	eb a3                	jmp    801ddb <fd_close+0x4d>
+
+0000000000801e38 <close>:
+
+int
+close(int fdnum) {
+  801e38:	55                   	push   %rbp
+  801e39:	48 89 e5             	mov    %rsp,%rbp
+  801e3c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801e40:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e44:	48 b8 d3 1c 80 00 00 	movabs $0x801cd3,%rax
+  801e4b:	00 00 00 
+  801e4e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e50:	85 c0                	test   %eax,%eax
+  801e52:	78 15                	js     801e69 <close+0x31>
+
+    return fd_close(fd, 1);
+  801e54:	be 01 00 00 00       	mov    $0x1,%esi
+  801e59:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801e5d:	48 b8 8e 1d 80 00 00 	movabs $0x801d8e,%rax
+  801e64:	00 00 00 
+  801e67:	ff d0                	call   *%rax
+}
+  801e69:	c9                   	leave
+  801e6a:	c3                   	ret
+
+0000000000801e6b <close_all>:
+
+void
+close_all(void) {
+  801e6b:	55                   	push   %rbp
+  801e6c:	48 89 e5             	mov    %rsp,%rbp
+  801e6f:	41 54                	push   %r12
+  801e71:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801e72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e77:	49 bc 38 1e 80 00 00 	movabs $0x801e38,%r12
+  801e7e:	00 00 00 
+  801e81:	89 df                	mov    %ebx,%edi
+  801e83:	41 ff d4             	call   *%r12
+  801e86:	83 c3 01             	add    $0x1,%ebx
+  801e89:	83 fb 20             	cmp    $0x20,%ebx
+  801e8c:	75 f3                	jne    801e81 <close_all+0x16>
+}
+  801e8e:	5b                   	pop    %rbx
+  801e8f:	41 5c                	pop    %r12
+  801e91:	5d                   	pop    %rbp
+  801e92:	c3                   	ret
+
+0000000000801e93 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801e93:	55                   	push   %rbp
+  801e94:	48 89 e5             	mov    %rsp,%rbp
+  801e97:	41 57                	push   %r15
+  801e99:	41 56                	push   %r14
+  801e9b:	41 55                	push   %r13
+  801e9d:	41 54                	push   %r12
+  801e9f:	53                   	push   %rbx
+  801ea0:	48 83 ec 18          	sub    $0x18,%rsp
+  801ea4:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801ea7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801eab:	48 b8 d3 1c 80 00 00 	movabs $0x801cd3,%rax
+  801eb2:	00 00 00 
+  801eb5:	ff d0                	call   *%rax
+  801eb7:	89 c3                	mov    %eax,%ebx
+  801eb9:	85 c0                	test   %eax,%eax
+  801ebb:	0f 88 b8 00 00 00    	js     801f79 <dup+0xe6>
+    close(newfdnum);
+  801ec1:	44 89 e7             	mov    %r12d,%edi
+  801ec4:	48 b8 38 1e 80 00 00 	movabs $0x801e38,%rax
+  801ecb:	00 00 00 
+  801ece:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801ed0:	4d 63 ec             	movslq %r12d,%r13
+  801ed3:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801eda:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801ede:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ee2:	4c 89 ff             	mov    %r15,%rdi
+  801ee5:	49 be 57 1c 80 00 00 	movabs $0x801c57,%r14
+  801eec:	00 00 00 
+  801eef:	41 ff d6             	call   *%r14
+  801ef2:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801ef5:	4c 89 ef             	mov    %r13,%rdi
+  801ef8:	41 ff d6             	call   *%r14
+  801efb:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801efe:	48 89 df             	mov    %rbx,%rdi
+  801f01:	48 b8 95 2d 80 00 00 	movabs $0x802d95,%rax
+  801f08:	00 00 00 
+  801f0b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801f0d:	a8 04                	test   $0x4,%al
+  801f0f:	74 2b                	je     801f3c <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801f11:	41 89 c1             	mov    %eax,%r9d
+  801f14:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f1a:	4c 89 f1             	mov    %r14,%rcx
+  801f1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f22:	48 89 de             	mov    %rbx,%rsi
+  801f25:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f2a:	48 b8 90 15 80 00 00 	movabs $0x801590,%rax
+  801f31:	00 00 00 
+  801f34:	ff d0                	call   *%rax
+  801f36:	89 c3                	mov    %eax,%ebx
+  801f38:	85 c0                	test   %eax,%eax
+  801f3a:	78 4e                	js     801f8a <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801f3c:	4c 89 ff             	mov    %r15,%rdi
+  801f3f:	48 b8 95 2d 80 00 00 	movabs $0x802d95,%rax
+  801f46:	00 00 00 
+  801f49:	ff d0                	call   *%rax
+  801f4b:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801f4e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f54:	4c 89 e9             	mov    %r13,%rcx
+  801f57:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f5c:	4c 89 fe             	mov    %r15,%rsi
+  801f5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f64:	48 b8 90 15 80 00 00 	movabs $0x801590,%rax
+  801f6b:	00 00 00 
+  801f6e:	ff d0                	call   *%rax
+  801f70:	89 c3                	mov    %eax,%ebx
+  801f72:	85 c0                	test   %eax,%eax
+  801f74:	78 14                	js     801f8a <dup+0xf7>
+
+    return newfdnum;
+  801f76:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801f79:	89 d8                	mov    %ebx,%eax
+  801f7b:	48 83 c4 18          	add    $0x18,%rsp
+  801f7f:	5b                   	pop    %rbx
+  801f80:	41 5c                	pop    %r12
+  801f82:	41 5d                	pop    %r13
+  801f84:	41 5e                	pop    %r14
+  801f86:	41 5f                	pop    %r15
+  801f88:	5d                   	pop    %rbp
+  801f89:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801f8a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f8f:	4c 89 ee             	mov    %r13,%rsi
+  801f92:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f97:	49 bc f5 15 80 00 00 	movabs $0x8015f5,%r12
+  801f9e:	00 00 00 
+  801fa1:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801fa4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801fa9:	4c 89 f6             	mov    %r14,%rsi
+  801fac:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fb1:	41 ff d4             	call   *%r12
+    return res;
+  801fb4:	eb c3                	jmp    801f79 <dup+0xe6>
+
+0000000000801fb6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801fb6:	55                   	push   %rbp
+  801fb7:	48 89 e5             	mov    %rsp,%rbp
+  801fba:	41 56                	push   %r14
+  801fbc:	41 55                	push   %r13
+  801fbe:	41 54                	push   %r12
+  801fc0:	53                   	push   %rbx
+  801fc1:	48 83 ec 10          	sub    $0x10,%rsp
+  801fc5:	89 fb                	mov    %edi,%ebx
+  801fc7:	49 89 f4             	mov    %rsi,%r12
+  801fca:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fcd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fd1:	48 b8 d3 1c 80 00 00 	movabs $0x801cd3,%rax
+  801fd8:	00 00 00 
+  801fdb:	ff d0                	call   *%rax
+  801fdd:	85 c0                	test   %eax,%eax
+  801fdf:	78 4c                	js     80202d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fe1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801fe5:	41 8b 3e             	mov    (%r14),%edi
+  801fe8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fec:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  801ff3:	00 00 00 
+  801ff6:	ff d0                	call   *%rax
+  801ff8:	85 c0                	test   %eax,%eax
+  801ffa:	78 35                	js     802031 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ffc:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802000:	83 e0 03             	and    $0x3,%eax
+  802003:	83 f8 01             	cmp    $0x1,%eax
+  802006:	74 2d                	je     802035 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802008:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80200c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802010:	48 85 c0             	test   %rax,%rax
+  802013:	74 56                	je     80206b <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802015:	4c 89 ea             	mov    %r13,%rdx
+  802018:	4c 89 e6             	mov    %r12,%rsi
+  80201b:	4c 89 f7             	mov    %r14,%rdi
+  80201e:	ff d0                	call   *%rax
+}
+  802020:	48 83 c4 10          	add    $0x10,%rsp
+  802024:	5b                   	pop    %rbx
+  802025:	41 5c                	pop    %r12
+  802027:	41 5d                	pop    %r13
+  802029:	41 5e                	pop    %r14
+  80202b:	5d                   	pop    %rbp
+  80202c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80202d:	48 98                	cltq
+  80202f:	eb ef                	jmp    802020 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802031:	48 98                	cltq
+  802033:	eb eb                	jmp    802020 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802035:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  80203c:	00 00 00 
+  80203f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802045:	89 da                	mov    %ebx,%edx
+  802047:	48 bf c1 38 80 00 00 	movabs $0x8038c1,%rdi
+  80204e:	00 00 00 
+  802051:	b8 00 00 00 00       	mov    $0x0,%eax
+  802056:	48 b9 54 06 80 00 00 	movabs $0x800654,%rcx
+  80205d:	00 00 00 
+  802060:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802062:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802069:	eb b5                	jmp    802020 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80206b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802072:	eb ac                	jmp    802020 <read+0x6a>
+
+0000000000802074 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802074:	55                   	push   %rbp
+  802075:	48 89 e5             	mov    %rsp,%rbp
+  802078:	41 57                	push   %r15
+  80207a:	41 56                	push   %r14
+  80207c:	41 55                	push   %r13
+  80207e:	41 54                	push   %r12
+  802080:	53                   	push   %rbx
+  802081:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802085:	48 85 d2             	test   %rdx,%rdx
+  802088:	74 54                	je     8020de <readn+0x6a>
+  80208a:	41 89 fd             	mov    %edi,%r13d
+  80208d:	49 89 f6             	mov    %rsi,%r14
+  802090:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802093:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802098:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80209d:	49 bf b6 1f 80 00 00 	movabs $0x801fb6,%r15
+  8020a4:	00 00 00 
+  8020a7:	4c 89 e2             	mov    %r12,%rdx
+  8020aa:	48 29 f2             	sub    %rsi,%rdx
+  8020ad:	4c 01 f6             	add    %r14,%rsi
+  8020b0:	44 89 ef             	mov    %r13d,%edi
+  8020b3:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8020b6:	85 c0                	test   %eax,%eax
+  8020b8:	78 20                	js     8020da <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8020ba:	01 c3                	add    %eax,%ebx
+  8020bc:	85 c0                	test   %eax,%eax
+  8020be:	74 08                	je     8020c8 <readn+0x54>
+  8020c0:	48 63 f3             	movslq %ebx,%rsi
+  8020c3:	4c 39 e6             	cmp    %r12,%rsi
+  8020c6:	72 df                	jb     8020a7 <readn+0x33>
+    }
+    return res;
+  8020c8:	48 63 c3             	movslq %ebx,%rax
+}
+  8020cb:	48 83 c4 08          	add    $0x8,%rsp
+  8020cf:	5b                   	pop    %rbx
+  8020d0:	41 5c                	pop    %r12
+  8020d2:	41 5d                	pop    %r13
+  8020d4:	41 5e                	pop    %r14
+  8020d6:	41 5f                	pop    %r15
+  8020d8:	5d                   	pop    %rbp
+  8020d9:	c3                   	ret
+        if (inc < 0) return inc;
+  8020da:	48 98                	cltq
+  8020dc:	eb ed                	jmp    8020cb <readn+0x57>
+    int inc = 1, res = 0;
+  8020de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020e3:	eb e3                	jmp    8020c8 <readn+0x54>
+
+00000000008020e5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8020e5:	55                   	push   %rbp
+  8020e6:	48 89 e5             	mov    %rsp,%rbp
+  8020e9:	41 56                	push   %r14
+  8020eb:	41 55                	push   %r13
+  8020ed:	41 54                	push   %r12
+  8020ef:	53                   	push   %rbx
+  8020f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8020f4:	89 fb                	mov    %edi,%ebx
+  8020f6:	49 89 f4             	mov    %rsi,%r12
+  8020f9:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020fc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802100:	48 b8 d3 1c 80 00 00 	movabs $0x801cd3,%rax
+  802107:	00 00 00 
+  80210a:	ff d0                	call   *%rax
+  80210c:	85 c0                	test   %eax,%eax
+  80210e:	78 47                	js     802157 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802110:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802114:	41 8b 3e             	mov    (%r14),%edi
+  802117:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80211b:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  802122:	00 00 00 
+  802125:	ff d0                	call   *%rax
+  802127:	85 c0                	test   %eax,%eax
+  802129:	78 30                	js     80215b <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80212b:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802130:	74 2d                	je     80215f <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802132:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802136:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80213a:	48 85 c0             	test   %rax,%rax
+  80213d:	74 56                	je     802195 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80213f:	4c 89 ea             	mov    %r13,%rdx
+  802142:	4c 89 e6             	mov    %r12,%rsi
+  802145:	4c 89 f7             	mov    %r14,%rdi
+  802148:	ff d0                	call   *%rax
+}
+  80214a:	48 83 c4 10          	add    $0x10,%rsp
+  80214e:	5b                   	pop    %rbx
+  80214f:	41 5c                	pop    %r12
+  802151:	41 5d                	pop    %r13
+  802153:	41 5e                	pop    %r14
+  802155:	5d                   	pop    %rbp
+  802156:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802157:	48 98                	cltq
+  802159:	eb ef                	jmp    80214a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80215b:	48 98                	cltq
+  80215d:	eb eb                	jmp    80214a <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80215f:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  802166:	00 00 00 
+  802169:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80216f:	89 da                	mov    %ebx,%edx
+  802171:	48 bf dd 38 80 00 00 	movabs $0x8038dd,%rdi
+  802178:	00 00 00 
+  80217b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802180:	48 b9 54 06 80 00 00 	movabs $0x800654,%rcx
+  802187:	00 00 00 
+  80218a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80218c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802193:	eb b5                	jmp    80214a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802195:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80219c:	eb ac                	jmp    80214a <write+0x65>
+
+000000000080219e <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80219e:	55                   	push   %rbp
+  80219f:	48 89 e5             	mov    %rsp,%rbp
+  8021a2:	53                   	push   %rbx
+  8021a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8021a7:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021a9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021ad:	48 b8 d3 1c 80 00 00 	movabs $0x801cd3,%rax
+  8021b4:	00 00 00 
+  8021b7:	ff d0                	call   *%rax
+  8021b9:	85 c0                	test   %eax,%eax
+  8021bb:	78 0c                	js     8021c9 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8021bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021c1:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8021c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021cd:	c9                   	leave
+  8021ce:	c3                   	ret
+
+00000000008021cf <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8021cf:	55                   	push   %rbp
+  8021d0:	48 89 e5             	mov    %rsp,%rbp
+  8021d3:	41 55                	push   %r13
+  8021d5:	41 54                	push   %r12
+  8021d7:	53                   	push   %rbx
+  8021d8:	48 83 ec 18          	sub    $0x18,%rsp
+  8021dc:	89 fb                	mov    %edi,%ebx
+  8021de:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021e1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021e5:	48 b8 d3 1c 80 00 00 	movabs $0x801cd3,%rax
+  8021ec:	00 00 00 
+  8021ef:	ff d0                	call   *%rax
+  8021f1:	85 c0                	test   %eax,%eax
+  8021f3:	78 38                	js     80222d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021f5:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8021f9:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8021fd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802201:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  802208:	00 00 00 
+  80220b:	ff d0                	call   *%rax
+  80220d:	85 c0                	test   %eax,%eax
+  80220f:	78 1c                	js     80222d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802211:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802216:	74 20                	je     802238 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802218:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80221c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802220:	48 85 c0             	test   %rax,%rax
+  802223:	74 47                	je     80226c <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802225:	44 89 e6             	mov    %r12d,%esi
+  802228:	4c 89 ef             	mov    %r13,%rdi
+  80222b:	ff d0                	call   *%rax
+}
+  80222d:	48 83 c4 18          	add    $0x18,%rsp
+  802231:	5b                   	pop    %rbx
+  802232:	41 5c                	pop    %r12
+  802234:	41 5d                	pop    %r13
+  802236:	5d                   	pop    %rbp
+  802237:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802238:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  80223f:	00 00 00 
+  802242:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802248:	89 da                	mov    %ebx,%edx
+  80224a:	48 bf a0 38 80 00 00 	movabs $0x8038a0,%rdi
+  802251:	00 00 00 
+  802254:	b8 00 00 00 00       	mov    $0x0,%eax
+  802259:	48 b9 54 06 80 00 00 	movabs $0x800654,%rcx
+  802260:	00 00 00 
+  802263:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802265:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80226a:	eb c1                	jmp    80222d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80226c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802271:	eb ba                	jmp    80222d <ftruncate+0x5e>
+
+0000000000802273 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802273:	55                   	push   %rbp
+  802274:	48 89 e5             	mov    %rsp,%rbp
+  802277:	41 54                	push   %r12
+  802279:	53                   	push   %rbx
+  80227a:	48 83 ec 10          	sub    $0x10,%rsp
+  80227e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802281:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802285:	48 b8 d3 1c 80 00 00 	movabs $0x801cd3,%rax
+  80228c:	00 00 00 
+  80228f:	ff d0                	call   *%rax
+  802291:	85 c0                	test   %eax,%eax
+  802293:	78 4e                	js     8022e3 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802295:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802299:	41 8b 3c 24          	mov    (%r12),%edi
+  80229d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8022a1:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  8022a8:	00 00 00 
+  8022ab:	ff d0                	call   *%rax
+  8022ad:	85 c0                	test   %eax,%eax
+  8022af:	78 32                	js     8022e3 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8022b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8022b5:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8022ba:	74 30                	je     8022ec <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8022bc:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8022bf:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8022c6:	00 00 00 
+    stat->st_isdir = 0;
+  8022c9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8022d0:	00 00 00 
+    stat->st_dev = dev;
+  8022d3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8022da:	48 89 de             	mov    %rbx,%rsi
+  8022dd:	4c 89 e7             	mov    %r12,%rdi
+  8022e0:	ff 50 28             	call   *0x28(%rax)
+}
+  8022e3:	48 83 c4 10          	add    $0x10,%rsp
+  8022e7:	5b                   	pop    %rbx
+  8022e8:	41 5c                	pop    %r12
+  8022ea:	5d                   	pop    %rbp
+  8022eb:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8022ec:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022f1:	eb f0                	jmp    8022e3 <fstat+0x70>
+
+00000000008022f3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8022f3:	55                   	push   %rbp
+  8022f4:	48 89 e5             	mov    %rsp,%rbp
+  8022f7:	41 54                	push   %r12
+  8022f9:	53                   	push   %rbx
+  8022fa:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8022fd:	be 00 00 00 00       	mov    $0x0,%esi
+  802302:	48 b8 74 25 80 00 00 	movabs $0x802574,%rax
+  802309:	00 00 00 
+  80230c:	ff d0                	call   *%rax
+  80230e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802310:	85 c0                	test   %eax,%eax
+  802312:	78 25                	js     802339 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802314:	4c 89 e6             	mov    %r12,%rsi
+  802317:	89 c7                	mov    %eax,%edi
+  802319:	48 b8 73 22 80 00 00 	movabs $0x802273,%rax
+  802320:	00 00 00 
+  802323:	ff d0                	call   *%rax
+  802325:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802328:	89 df                	mov    %ebx,%edi
+  80232a:	48 b8 38 1e 80 00 00 	movabs $0x801e38,%rax
+  802331:	00 00 00 
+  802334:	ff d0                	call   *%rax
+
+    return res;
+  802336:	44 89 e3             	mov    %r12d,%ebx
+}
+  802339:	89 d8                	mov    %ebx,%eax
+  80233b:	5b                   	pop    %rbx
+  80233c:	41 5c                	pop    %r12
+  80233e:	5d                   	pop    %rbp
+  80233f:	c3                   	ret
+
+0000000000802340 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802340:	55                   	push   %rbp
+  802341:	48 89 e5             	mov    %rsp,%rbp
+  802344:	41 54                	push   %r12
+  802346:	53                   	push   %rbx
+  802347:	48 83 ec 10          	sub    $0x10,%rsp
+  80234b:	41 89 fc             	mov    %edi,%r12d
+  80234e:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802351:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802358:	00 00 00 
+  80235b:	83 38 00             	cmpl   $0x0,(%rax)
+  80235e:	74 5e                	je     8023be <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802360:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802366:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80236b:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802372:	00 00 00 
+  802375:	44 89 e6             	mov    %r12d,%esi
+  802378:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80237f:	00 00 00 
+  802382:	8b 38                	mov    (%rax),%edi
+  802384:	48 b8 51 31 80 00 00 	movabs $0x803151,%rax
+  80238b:	00 00 00 
+  80238e:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802390:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802397:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802398:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80239d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8023a1:	48 89 de             	mov    %rbx,%rsi
+  8023a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023a9:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  8023b0:	00 00 00 
+  8023b3:	ff d0                	call   *%rax
+}
+  8023b5:	48 83 c4 10          	add    $0x10,%rsp
+  8023b9:	5b                   	pop    %rbx
+  8023ba:	41 5c                	pop    %r12
+  8023bc:	5d                   	pop    %rbp
+  8023bd:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023be:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023c3:	48 b8 f1 31 80 00 00 	movabs $0x8031f1,%rax
+  8023ca:	00 00 00 
+  8023cd:	ff d0                	call   *%rax
+  8023cf:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8023d6:	00 00 
+  8023d8:	eb 86                	jmp    802360 <fsipc+0x20>
+
+00000000008023da <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8023da:	55                   	push   %rbp
+  8023db:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8023de:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023e5:	00 00 00 
+  8023e8:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8023eb:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8023ed:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8023f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f5:	bf 02 00 00 00       	mov    $0x2,%edi
+  8023fa:	48 b8 40 23 80 00 00 	movabs $0x802340,%rax
+  802401:	00 00 00 
+  802404:	ff d0                	call   *%rax
+}
+  802406:	5d                   	pop    %rbp
+  802407:	c3                   	ret
+
+0000000000802408 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802408:	55                   	push   %rbp
+  802409:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80240c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80240f:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802416:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802418:	be 00 00 00 00       	mov    $0x0,%esi
+  80241d:	bf 06 00 00 00       	mov    $0x6,%edi
+  802422:	48 b8 40 23 80 00 00 	movabs $0x802340,%rax
+  802429:	00 00 00 
+  80242c:	ff d0                	call   *%rax
+}
+  80242e:	5d                   	pop    %rbp
+  80242f:	c3                   	ret
+
+0000000000802430 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802430:	55                   	push   %rbp
+  802431:	48 89 e5             	mov    %rsp,%rbp
+  802434:	41 54                	push   %r12
+  802436:	53                   	push   %rbx
+  802437:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80243a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80243d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802444:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802446:	be 00 00 00 00       	mov    $0x0,%esi
+  80244b:	bf 05 00 00 00       	mov    $0x5,%edi
+  802450:	48 b8 40 23 80 00 00 	movabs $0x802340,%rax
+  802457:	00 00 00 
+  80245a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80245c:	85 c0                	test   %eax,%eax
+  80245e:	78 3d                	js     80249d <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802460:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802467:	00 00 00 
+  80246a:	4c 89 e6             	mov    %r12,%rsi
+  80246d:	48 89 df             	mov    %rbx,%rdi
+  802470:	48 b8 79 0f 80 00 00 	movabs $0x800f79,%rax
+  802477:	00 00 00 
+  80247a:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80247c:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802483:	00 
+  802484:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80248a:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802491:	00 
+  802492:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802498:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80249d:	5b                   	pop    %rbx
+  80249e:	41 5c                	pop    %r12
+  8024a0:	5d                   	pop    %rbp
+  8024a1:	c3                   	ret
+
+00000000008024a2 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8024a2:	55                   	push   %rbp
+  8024a3:	48 89 e5             	mov    %rsp,%rbp
+  8024a6:	41 54                	push   %r12
+  8024a8:	53                   	push   %rbx
+  8024a9:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8024ac:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8024b1:	48 39 c2             	cmp    %rax,%rdx
+  8024b4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8024b8:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8024bb:	48 89 c2             	mov    %rax,%rdx
+  8024be:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8024c5:	00 00 00 
+  8024c8:	48 b8 da 11 80 00 00 	movabs $0x8011da,%rax
+  8024cf:	00 00 00 
+  8024d2:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024d4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8024db:	00 00 00 
+  8024de:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8024e3:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8024e5:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8024e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ee:	bf 04 00 00 00       	mov    $0x4,%edi
+  8024f3:	48 b8 40 23 80 00 00 	movabs $0x802340,%rax
+  8024fa:	00 00 00 
+  8024fd:	ff d0                	call   *%rax
+  8024ff:	48 98                	cltq
+}
+  802501:	5b                   	pop    %rbx
+  802502:	41 5c                	pop    %r12
+  802504:	5d                   	pop    %rbp
+  802505:	c3                   	ret
+
+0000000000802506 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802506:	55                   	push   %rbp
+  802507:	48 89 e5             	mov    %rsp,%rbp
+  80250a:	41 54                	push   %r12
+  80250c:	53                   	push   %rbx
+  80250d:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802510:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802517:	00 00 00 
+  80251a:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80251d:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  80251f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802524:	48 39 ca             	cmp    %rcx,%rdx
+  802527:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  80252b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  80252f:	be 00 00 00 00       	mov    $0x0,%esi
+  802534:	bf 03 00 00 00       	mov    $0x3,%edi
+  802539:	48 b8 40 23 80 00 00 	movabs $0x802340,%rax
+  802540:	00 00 00 
+  802543:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802545:	85 c0                	test   %eax,%eax
+  802547:	78 27                	js     802570 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802549:	48 63 d8             	movslq %eax,%rbx
+  80254c:	48 89 da             	mov    %rbx,%rdx
+  80254f:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802556:	00 00 00 
+  802559:	4c 89 e7             	mov    %r12,%rdi
+  80255c:	48 b8 da 11 80 00 00 	movabs $0x8011da,%rax
+  802563:	00 00 00 
+  802566:	ff d0                	call   *%rax
+    return bytes_read;
+  802568:	48 89 d8             	mov    %rbx,%rax
+}
+  80256b:	5b                   	pop    %rbx
+  80256c:	41 5c                	pop    %r12
+  80256e:	5d                   	pop    %rbp
+  80256f:	c3                   	ret
+        return bytes_read;
+  802570:	48 98                	cltq
+  802572:	eb f7                	jmp    80256b <devfile_read+0x65>
+
+0000000000802574 <open>:
+open(const char *path, int mode) {
+  802574:	55                   	push   %rbp
+  802575:	48 89 e5             	mov    %rsp,%rbp
+  802578:	41 55                	push   %r13
+  80257a:	41 54                	push   %r12
+  80257c:	53                   	push   %rbx
+  80257d:	48 83 ec 18          	sub    $0x18,%rsp
+  802581:	49 89 fc             	mov    %rdi,%r12
+  802584:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802587:	48 b8 3b 0f 80 00 00 	movabs $0x800f3b,%rax
+  80258e:	00 00 00 
+  802591:	ff d0                	call   *%rax
+  802593:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802599:	0f 87 8a 00 00 00    	ja     802629 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80259f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8025a3:	48 b8 73 1c 80 00 00 	movabs $0x801c73,%rax
+  8025aa:	00 00 00 
+  8025ad:	ff d0                	call   *%rax
+  8025af:	89 c3                	mov    %eax,%ebx
+  8025b1:	85 c0                	test   %eax,%eax
+  8025b3:	78 50                	js     802605 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8025b5:	4c 89 e6             	mov    %r12,%rsi
+  8025b8:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8025bf:	00 00 00 
+  8025c2:	48 89 df             	mov    %rbx,%rdi
+  8025c5:	48 b8 79 0f 80 00 00 	movabs $0x800f79,%rax
+  8025cc:	00 00 00 
+  8025cf:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8025d1:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8025d8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8025dc:	bf 01 00 00 00       	mov    $0x1,%edi
+  8025e1:	48 b8 40 23 80 00 00 	movabs $0x802340,%rax
+  8025e8:	00 00 00 
+  8025eb:	ff d0                	call   *%rax
+  8025ed:	89 c3                	mov    %eax,%ebx
+  8025ef:	85 c0                	test   %eax,%eax
+  8025f1:	78 1f                	js     802612 <open+0x9e>
+    return fd2num(fd);
+  8025f3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025f7:	48 b8 45 1c 80 00 00 	movabs $0x801c45,%rax
+  8025fe:	00 00 00 
+  802601:	ff d0                	call   *%rax
+  802603:	89 c3                	mov    %eax,%ebx
+}
+  802605:	89 d8                	mov    %ebx,%eax
+  802607:	48 83 c4 18          	add    $0x18,%rsp
+  80260b:	5b                   	pop    %rbx
+  80260c:	41 5c                	pop    %r12
+  80260e:	41 5d                	pop    %r13
+  802610:	5d                   	pop    %rbp
+  802611:	c3                   	ret
+        fd_close(fd, 0);
+  802612:	be 00 00 00 00       	mov    $0x0,%esi
+  802617:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80261b:	48 b8 8e 1d 80 00 00 	movabs $0x801d8e,%rax
+  802622:	00 00 00 
+  802625:	ff d0                	call   *%rax
+        return res;
+  802627:	eb dc                	jmp    802605 <open+0x91>
+        return -E_BAD_PATH;
+  802629:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80262e:	eb d5                	jmp    802605 <open+0x91>
+
+0000000000802630 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802630:	55                   	push   %rbp
+  802631:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802634:	be 00 00 00 00       	mov    $0x0,%esi
+  802639:	bf 08 00 00 00       	mov    $0x8,%edi
+  80263e:	48 b8 40 23 80 00 00 	movabs $0x802340,%rax
+  802645:	00 00 00 
+  802648:	ff d0                	call   *%rax
+}
+  80264a:	5d                   	pop    %rbp
+  80264b:	c3                   	ret
+
+000000000080264c <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  80264c:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  802650:	7f 01                	jg     802653 <writebuf+0x7>
+  802652:	c3                   	ret
+writebuf(struct printbuf *state) {
+  802653:	55                   	push   %rbp
+  802654:	48 89 e5             	mov    %rsp,%rbp
+  802657:	53                   	push   %rbx
+  802658:	48 83 ec 08          	sub    $0x8,%rsp
+  80265c:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  80265f:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  802663:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  802667:	8b 3f                	mov    (%rdi),%edi
+  802669:	48 b8 e5 20 80 00 00 	movabs $0x8020e5,%rax
+  802670:	00 00 00 
+  802673:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  802675:	48 85 c0             	test   %rax,%rax
+  802678:	7e 04                	jle    80267e <writebuf+0x32>
+  80267a:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  80267e:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  802682:	48 39 c2             	cmp    %rax,%rdx
+  802685:	74 0f                	je     802696 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  802687:	48 85 c0             	test   %rax,%rax
+  80268a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80268f:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802693:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  802696:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80269a:	c9                   	leave
+  80269b:	c3                   	ret
+
+000000000080269c <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  80269c:	8b 46 04             	mov    0x4(%rsi),%eax
+  80269f:	8d 50 01             	lea    0x1(%rax),%edx
+  8026a2:	89 56 04             	mov    %edx,0x4(%rsi)
+  8026a5:	48 98                	cltq
+  8026a7:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  8026ac:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8026b2:	74 01                	je     8026b5 <putch+0x19>
+  8026b4:	c3                   	ret
+putch(int ch, void *arg) {
+  8026b5:	55                   	push   %rbp
+  8026b6:	48 89 e5             	mov    %rsp,%rbp
+  8026b9:	53                   	push   %rbx
+  8026ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8026be:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  8026c1:	48 89 f7             	mov    %rsi,%rdi
+  8026c4:	48 b8 4c 26 80 00 00 	movabs $0x80264c,%rax
+  8026cb:	00 00 00 
+  8026ce:	ff d0                	call   *%rax
+        state->offset = 0;
+  8026d0:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  8026d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026db:	c9                   	leave
+  8026dc:	c3                   	ret
+
+00000000008026dd <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8026dd:	55                   	push   %rbp
+  8026de:	48 89 e5             	mov    %rsp,%rbp
+  8026e1:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8026e8:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  8026eb:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  8026f1:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  8026f8:	00 00 00 
+    state.result = 0;
+  8026fb:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  802702:	00 00 00 00 
+    state.error = 1;
+  802706:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  80270d:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  802710:	48 89 f2             	mov    %rsi,%rdx
+  802713:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  80271a:	48 bf 9c 26 80 00 00 	movabs $0x80269c,%rdi
+  802721:	00 00 00 
+  802724:	48 b8 a4 07 80 00 00 	movabs $0x8007a4,%rax
+  80272b:	00 00 00 
+  80272e:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  802730:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  802737:	7f 14                	jg     80274d <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  802739:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  802740:	48 85 c0             	test   %rax,%rax
+  802743:	75 06                	jne    80274b <vfprintf+0x6e>
+  802745:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  80274b:	c9                   	leave
+  80274c:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  80274d:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  802754:	48 b8 4c 26 80 00 00 	movabs $0x80264c,%rax
+  80275b:	00 00 00 
+  80275e:	ff d0                	call   *%rax
+  802760:	eb d7                	jmp    802739 <vfprintf+0x5c>
+
+0000000000802762 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  802762:	55                   	push   %rbp
+  802763:	48 89 e5             	mov    %rsp,%rbp
+  802766:	48 83 ec 50          	sub    $0x50,%rsp
+  80276a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80276e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802772:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802776:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80277a:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802781:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802785:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802789:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80278d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  802791:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  802795:	48 b8 dd 26 80 00 00 	movabs $0x8026dd,%rax
+  80279c:	00 00 00 
+  80279f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8027a1:	c9                   	leave
+  8027a2:	c3                   	ret
+
+00000000008027a3 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8027a3:	55                   	push   %rbp
+  8027a4:	48 89 e5             	mov    %rsp,%rbp
+  8027a7:	48 83 ec 50          	sub    $0x50,%rsp
+  8027ab:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8027af:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8027b3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8027b7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8027bb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8027bf:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8027c6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8027ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027ce:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8027d2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8027d6:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8027da:	48 89 fe             	mov    %rdi,%rsi
+  8027dd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8027e2:	48 b8 dd 26 80 00 00 	movabs $0x8026dd,%rax
+  8027e9:	00 00 00 
+  8027ec:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8027ee:	c9                   	leave
+  8027ef:	c3                   	ret
+
+00000000008027f0 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8027f0:	55                   	push   %rbp
+  8027f1:	48 89 e5             	mov    %rsp,%rbp
+  8027f4:	41 54                	push   %r12
+  8027f6:	53                   	push   %rbx
+  8027f7:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8027fa:	48 b8 57 1c 80 00 00 	movabs $0x801c57,%rax
+  802801:	00 00 00 
+  802804:	ff d0                	call   *%rax
+  802806:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802809:	48 be 20 39 80 00 00 	movabs $0x803920,%rsi
+  802810:	00 00 00 
+  802813:	48 89 df             	mov    %rbx,%rdi
+  802816:	48 b8 79 0f 80 00 00 	movabs $0x800f79,%rax
+  80281d:	00 00 00 
+  802820:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802822:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802827:	41 2b 04 24          	sub    (%r12),%eax
+  80282b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802831:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802838:	00 00 00 
+    stat->st_dev = &devpipe;
+  80283b:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802842:	00 00 00 
+  802845:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80284c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802851:	5b                   	pop    %rbx
+  802852:	41 5c                	pop    %r12
+  802854:	5d                   	pop    %rbp
+  802855:	c3                   	ret
+
+0000000000802856 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802856:	55                   	push   %rbp
+  802857:	48 89 e5             	mov    %rsp,%rbp
+  80285a:	41 54                	push   %r12
+  80285c:	53                   	push   %rbx
+  80285d:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802860:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802865:	48 89 fe             	mov    %rdi,%rsi
+  802868:	bf 00 00 00 00       	mov    $0x0,%edi
+  80286d:	49 bc f5 15 80 00 00 	movabs $0x8015f5,%r12
+  802874:	00 00 00 
+  802877:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80287a:	48 89 df             	mov    %rbx,%rdi
+  80287d:	48 b8 57 1c 80 00 00 	movabs $0x801c57,%rax
+  802884:	00 00 00 
+  802887:	ff d0                	call   *%rax
+  802889:	48 89 c6             	mov    %rax,%rsi
+  80288c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802891:	bf 00 00 00 00       	mov    $0x0,%edi
+  802896:	41 ff d4             	call   *%r12
+}
+  802899:	5b                   	pop    %rbx
+  80289a:	41 5c                	pop    %r12
+  80289c:	5d                   	pop    %rbp
+  80289d:	c3                   	ret
+
+000000000080289e <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80289e:	55                   	push   %rbp
+  80289f:	48 89 e5             	mov    %rsp,%rbp
+  8028a2:	41 57                	push   %r15
+  8028a4:	41 56                	push   %r14
+  8028a6:	41 55                	push   %r13
+  8028a8:	41 54                	push   %r12
+  8028aa:	53                   	push   %rbx
+  8028ab:	48 83 ec 18          	sub    $0x18,%rsp
+  8028af:	49 89 fc             	mov    %rdi,%r12
+  8028b2:	49 89 f5             	mov    %rsi,%r13
+  8028b5:	49 89 d7             	mov    %rdx,%r15
+  8028b8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028bc:	48 b8 57 1c 80 00 00 	movabs $0x801c57,%rax
+  8028c3:	00 00 00 
+  8028c6:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8028c8:	4d 85 ff             	test   %r15,%r15
+  8028cb:	0f 84 af 00 00 00    	je     802980 <devpipe_write+0xe2>
+  8028d1:	48 89 c3             	mov    %rax,%rbx
+  8028d4:	4c 89 f8             	mov    %r15,%rax
+  8028d7:	4d 89 ef             	mov    %r13,%r15
+  8028da:	4c 01 e8             	add    %r13,%rax
+  8028dd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8028e1:	49 bd fd 14 80 00 00 	movabs $0x8014fd,%r13
+  8028e8:	00 00 00 
+            sys_yield();
+  8028eb:	49 be 9a 14 80 00 00 	movabs $0x80149a,%r14
+  8028f2:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8028f5:	8b 73 04             	mov    0x4(%rbx),%esi
+  8028f8:	48 63 ce             	movslq %esi,%rcx
+  8028fb:	48 63 03             	movslq (%rbx),%rax
+  8028fe:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802904:	48 39 c1             	cmp    %rax,%rcx
+  802907:	72 2e                	jb     802937 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802909:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80290e:	48 89 da             	mov    %rbx,%rdx
+  802911:	be 00 10 00 00       	mov    $0x1000,%esi
+  802916:	4c 89 e7             	mov    %r12,%rdi
+  802919:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80291c:	85 c0                	test   %eax,%eax
+  80291e:	74 66                	je     802986 <devpipe_write+0xe8>
+            sys_yield();
+  802920:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802923:	8b 73 04             	mov    0x4(%rbx),%esi
+  802926:	48 63 ce             	movslq %esi,%rcx
+  802929:	48 63 03             	movslq (%rbx),%rax
+  80292c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802932:	48 39 c1             	cmp    %rax,%rcx
+  802935:	73 d2                	jae    802909 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802937:	41 0f b6 3f          	movzbl (%r15),%edi
+  80293b:	48 89 ca             	mov    %rcx,%rdx
+  80293e:	48 c1 ea 03          	shr    $0x3,%rdx
+  802942:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802949:	08 10 20 
+  80294c:	48 f7 e2             	mul    %rdx
+  80294f:	48 c1 ea 06          	shr    $0x6,%rdx
+  802953:	48 89 d0             	mov    %rdx,%rax
+  802956:	48 c1 e0 09          	shl    $0x9,%rax
+  80295a:	48 29 d0             	sub    %rdx,%rax
+  80295d:	48 c1 e0 03          	shl    $0x3,%rax
+  802961:	48 29 c1             	sub    %rax,%rcx
+  802964:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802969:	83 c6 01             	add    $0x1,%esi
+  80296c:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80296f:	49 83 c7 01          	add    $0x1,%r15
+  802973:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802977:	49 39 c7             	cmp    %rax,%r15
+  80297a:	0f 85 75 ff ff ff    	jne    8028f5 <devpipe_write+0x57>
+    return n;
+  802980:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802984:	eb 05                	jmp    80298b <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802986:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80298b:	48 83 c4 18          	add    $0x18,%rsp
+  80298f:	5b                   	pop    %rbx
+  802990:	41 5c                	pop    %r12
+  802992:	41 5d                	pop    %r13
+  802994:	41 5e                	pop    %r14
+  802996:	41 5f                	pop    %r15
+  802998:	5d                   	pop    %rbp
+  802999:	c3                   	ret
+
+000000000080299a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80299a:	55                   	push   %rbp
+  80299b:	48 89 e5             	mov    %rsp,%rbp
+  80299e:	41 57                	push   %r15
+  8029a0:	41 56                	push   %r14
+  8029a2:	41 55                	push   %r13
+  8029a4:	41 54                	push   %r12
+  8029a6:	53                   	push   %rbx
+  8029a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8029ab:	49 89 fc             	mov    %rdi,%r12
+  8029ae:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8029b2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8029b6:	48 b8 57 1c 80 00 00 	movabs $0x801c57,%rax
+  8029bd:	00 00 00 
+  8029c0:	ff d0                	call   *%rax
+  8029c2:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8029c5:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8029cb:	49 bd fd 14 80 00 00 	movabs $0x8014fd,%r13
+  8029d2:	00 00 00 
+            sys_yield();
+  8029d5:	49 be 9a 14 80 00 00 	movabs $0x80149a,%r14
+  8029dc:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8029df:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8029e4:	74 7d                	je     802a63 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8029e6:	8b 03                	mov    (%rbx),%eax
+  8029e8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8029eb:	75 26                	jne    802a13 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8029ed:	4d 85 ff             	test   %r15,%r15
+  8029f0:	75 77                	jne    802a69 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8029f2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029f7:	48 89 da             	mov    %rbx,%rdx
+  8029fa:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029ff:	4c 89 e7             	mov    %r12,%rdi
+  802a02:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802a05:	85 c0                	test   %eax,%eax
+  802a07:	74 72                	je     802a7b <devpipe_read+0xe1>
+            sys_yield();
+  802a09:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802a0c:	8b 03                	mov    (%rbx),%eax
+  802a0e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802a11:	74 df                	je     8029f2 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802a13:	48 63 c8             	movslq %eax,%rcx
+  802a16:	48 89 ca             	mov    %rcx,%rdx
+  802a19:	48 c1 ea 03          	shr    $0x3,%rdx
+  802a1d:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802a24:	08 10 20 
+  802a27:	48 89 d0             	mov    %rdx,%rax
+  802a2a:	48 f7 e6             	mul    %rsi
+  802a2d:	48 c1 ea 06          	shr    $0x6,%rdx
+  802a31:	48 89 d0             	mov    %rdx,%rax
+  802a34:	48 c1 e0 09          	shl    $0x9,%rax
+  802a38:	48 29 d0             	sub    %rdx,%rax
+  802a3b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802a42:	00 
+  802a43:	48 89 c8             	mov    %rcx,%rax
+  802a46:	48 29 d0             	sub    %rdx,%rax
+  802a49:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802a4e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802a52:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802a56:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802a59:	49 83 c7 01          	add    $0x1,%r15
+  802a5d:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802a61:	75 83                	jne    8029e6 <devpipe_read+0x4c>
+    return n;
+  802a63:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a67:	eb 03                	jmp    802a6c <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802a69:	4c 89 f8             	mov    %r15,%rax
+}
+  802a6c:	48 83 c4 18          	add    $0x18,%rsp
+  802a70:	5b                   	pop    %rbx
+  802a71:	41 5c                	pop    %r12
+  802a73:	41 5d                	pop    %r13
+  802a75:	41 5e                	pop    %r14
+  802a77:	41 5f                	pop    %r15
+  802a79:	5d                   	pop    %rbp
+  802a7a:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a80:	eb ea                	jmp    802a6c <devpipe_read+0xd2>
+
+0000000000802a82 <pipe>:
+pipe(int pfd[2]) {
+  802a82:	55                   	push   %rbp
+  802a83:	48 89 e5             	mov    %rsp,%rbp
+  802a86:	41 55                	push   %r13
+  802a88:	41 54                	push   %r12
+  802a8a:	53                   	push   %rbx
+  802a8b:	48 83 ec 18          	sub    $0x18,%rsp
+  802a8f:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802a92:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802a96:	48 b8 73 1c 80 00 00 	movabs $0x801c73,%rax
+  802a9d:	00 00 00 
+  802aa0:	ff d0                	call   *%rax
+  802aa2:	89 c3                	mov    %eax,%ebx
+  802aa4:	85 c0                	test   %eax,%eax
+  802aa6:	0f 88 a0 01 00 00    	js     802c4c <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802aac:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ab1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ab6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802aba:	bf 00 00 00 00       	mov    $0x0,%edi
+  802abf:	48 b8 29 15 80 00 00 	movabs $0x801529,%rax
+  802ac6:	00 00 00 
+  802ac9:	ff d0                	call   *%rax
+  802acb:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802acd:	85 c0                	test   %eax,%eax
+  802acf:	0f 88 77 01 00 00    	js     802c4c <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802ad5:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802ad9:	48 b8 73 1c 80 00 00 	movabs $0x801c73,%rax
+  802ae0:	00 00 00 
+  802ae3:	ff d0                	call   *%rax
+  802ae5:	89 c3                	mov    %eax,%ebx
+  802ae7:	85 c0                	test   %eax,%eax
+  802ae9:	0f 88 43 01 00 00    	js     802c32 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802aef:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802af4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802af9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802afd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b02:	48 b8 29 15 80 00 00 	movabs $0x801529,%rax
+  802b09:	00 00 00 
+  802b0c:	ff d0                	call   *%rax
+  802b0e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802b10:	85 c0                	test   %eax,%eax
+  802b12:	0f 88 1a 01 00 00    	js     802c32 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802b18:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b1c:	48 b8 57 1c 80 00 00 	movabs $0x801c57,%rax
+  802b23:	00 00 00 
+  802b26:	ff d0                	call   *%rax
+  802b28:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802b2b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b30:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b35:	48 89 c6             	mov    %rax,%rsi
+  802b38:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b3d:	48 b8 29 15 80 00 00 	movabs $0x801529,%rax
+  802b44:	00 00 00 
+  802b47:	ff d0                	call   *%rax
+  802b49:	89 c3                	mov    %eax,%ebx
+  802b4b:	85 c0                	test   %eax,%eax
+  802b4d:	0f 88 c5 00 00 00    	js     802c18 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802b53:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802b57:	48 b8 57 1c 80 00 00 	movabs $0x801c57,%rax
+  802b5e:	00 00 00 
+  802b61:	ff d0                	call   *%rax
+  802b63:	48 89 c1             	mov    %rax,%rcx
+  802b66:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802b6c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802b72:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b77:	4c 89 ee             	mov    %r13,%rsi
+  802b7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b7f:	48 b8 90 15 80 00 00 	movabs $0x801590,%rax
+  802b86:	00 00 00 
+  802b89:	ff d0                	call   *%rax
+  802b8b:	89 c3                	mov    %eax,%ebx
+  802b8d:	85 c0                	test   %eax,%eax
+  802b8f:	78 6e                	js     802bff <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802b91:	be 00 10 00 00       	mov    $0x1000,%esi
+  802b96:	4c 89 ef             	mov    %r13,%rdi
+  802b99:	48 b8 cb 14 80 00 00 	movabs $0x8014cb,%rax
+  802ba0:	00 00 00 
+  802ba3:	ff d0                	call   *%rax
+  802ba5:	83 f8 02             	cmp    $0x2,%eax
+  802ba8:	0f 85 ab 00 00 00    	jne    802c59 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802bae:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802bb5:	00 00 
+  802bb7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802bbb:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802bbd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802bc1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802bc8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802bcc:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802bce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802bd2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802bd9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802bdd:	48 bb 45 1c 80 00 00 	movabs $0x801c45,%rbx
+  802be4:	00 00 00 
+  802be7:	ff d3                	call   *%rbx
+  802be9:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802bed:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802bf1:	ff d3                	call   *%rbx
+  802bf3:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802bf8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bfd:	eb 4d                	jmp    802c4c <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802bff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c04:	4c 89 ee             	mov    %r13,%rsi
+  802c07:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c0c:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  802c13:	00 00 00 
+  802c16:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802c18:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c1d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802c21:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c26:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  802c2d:	00 00 00 
+  802c30:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802c32:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c37:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802c3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c40:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  802c47:	00 00 00 
+  802c4a:	ff d0                	call   *%rax
+}
+  802c4c:	89 d8                	mov    %ebx,%eax
+  802c4e:	48 83 c4 18          	add    $0x18,%rsp
+  802c52:	5b                   	pop    %rbx
+  802c53:	41 5c                	pop    %r12
+  802c55:	41 5d                	pop    %r13
+  802c57:	5d                   	pop    %rbp
+  802c58:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802c59:	48 b9 50 39 80 00 00 	movabs $0x803950,%rcx
+  802c60:	00 00 00 
+  802c63:	48 ba 27 39 80 00 00 	movabs $0x803927,%rdx
+  802c6a:	00 00 00 
+  802c6d:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802c72:	48 bf 3c 39 80 00 00 	movabs $0x80393c,%rdi
+  802c79:	00 00 00 
+  802c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c81:	49 b8 04 05 80 00 00 	movabs $0x800504,%r8
+  802c88:	00 00 00 
+  802c8b:	41 ff d0             	call   *%r8
+
+0000000000802c8e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802c8e:	55                   	push   %rbp
+  802c8f:	48 89 e5             	mov    %rsp,%rbp
+  802c92:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802c96:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802c9a:	48 b8 d3 1c 80 00 00 	movabs $0x801cd3,%rax
+  802ca1:	00 00 00 
+  802ca4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ca6:	85 c0                	test   %eax,%eax
+  802ca8:	78 35                	js     802cdf <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802caa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802cae:	48 b8 57 1c 80 00 00 	movabs $0x801c57,%rax
+  802cb5:	00 00 00 
+  802cb8:	ff d0                	call   *%rax
+  802cba:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802cbd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802cc2:	be 00 10 00 00       	mov    $0x1000,%esi
+  802cc7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802ccb:	48 b8 fd 14 80 00 00 	movabs $0x8014fd,%rax
+  802cd2:	00 00 00 
+  802cd5:	ff d0                	call   *%rax
+  802cd7:	85 c0                	test   %eax,%eax
+  802cd9:	0f 94 c0             	sete   %al
+  802cdc:	0f b6 c0             	movzbl %al,%eax
+}
+  802cdf:	c9                   	leave
+  802ce0:	c3                   	ret
+
+0000000000802ce1 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802ce1:	48 89 f8             	mov    %rdi,%rax
+  802ce4:	48 c1 e8 27          	shr    $0x27,%rax
+  802ce8:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802cef:	01 00 00 
+  802cf2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802cf6:	f6 c2 01             	test   $0x1,%dl
+  802cf9:	74 6d                	je     802d68 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802cfb:	48 89 f8             	mov    %rdi,%rax
+  802cfe:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802d02:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802d09:	01 00 00 
+  802d0c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802d10:	f6 c2 01             	test   $0x1,%dl
+  802d13:	74 62                	je     802d77 <get_uvpt_entry+0x96>
+  802d15:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802d1c:	01 00 00 
+  802d1f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802d23:	f6 c2 80             	test   $0x80,%dl
+  802d26:	75 4f                	jne    802d77 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802d28:	48 89 f8             	mov    %rdi,%rax
+  802d2b:	48 c1 e8 15          	shr    $0x15,%rax
+  802d2f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802d36:	01 00 00 
+  802d39:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802d3d:	f6 c2 01             	test   $0x1,%dl
+  802d40:	74 44                	je     802d86 <get_uvpt_entry+0xa5>
+  802d42:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802d49:	01 00 00 
+  802d4c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802d50:	f6 c2 80             	test   $0x80,%dl
+  802d53:	75 31                	jne    802d86 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802d55:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802d59:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802d60:	01 00 00 
+  802d63:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802d67:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802d68:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802d6f:	01 00 00 
+  802d72:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d76:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802d77:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802d7e:	01 00 00 
+  802d81:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d85:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802d86:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802d8d:	01 00 00 
+  802d90:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d94:	c3                   	ret
+
+0000000000802d95 <get_prot>:
+
+int
+get_prot(void *va) {
+  802d95:	55                   	push   %rbp
+  802d96:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802d99:	48 b8 e1 2c 80 00 00 	movabs $0x802ce1,%rax
+  802da0:	00 00 00 
+  802da3:	ff d0                	call   *%rax
+  802da5:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802da8:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802dad:	89 c1                	mov    %eax,%ecx
+  802daf:	83 c9 04             	or     $0x4,%ecx
+  802db2:	f6 c2 01             	test   $0x1,%dl
+  802db5:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802db8:	89 c1                	mov    %eax,%ecx
+  802dba:	83 c9 02             	or     $0x2,%ecx
+  802dbd:	f6 c2 02             	test   $0x2,%dl
+  802dc0:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802dc3:	89 c1                	mov    %eax,%ecx
+  802dc5:	83 c9 01             	or     $0x1,%ecx
+  802dc8:	48 85 d2             	test   %rdx,%rdx
+  802dcb:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802dce:	89 c1                	mov    %eax,%ecx
+  802dd0:	83 c9 40             	or     $0x40,%ecx
+  802dd3:	f6 c6 04             	test   $0x4,%dh
+  802dd6:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802dd9:	5d                   	pop    %rbp
+  802dda:	c3                   	ret
+
+0000000000802ddb <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802ddb:	55                   	push   %rbp
+  802ddc:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802ddf:	48 b8 e1 2c 80 00 00 	movabs $0x802ce1,%rax
+  802de6:	00 00 00 
+  802de9:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802deb:	48 c1 e8 06          	shr    $0x6,%rax
+  802def:	83 e0 01             	and    $0x1,%eax
+}
+  802df2:	5d                   	pop    %rbp
+  802df3:	c3                   	ret
+
+0000000000802df4 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802df4:	55                   	push   %rbp
+  802df5:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802df8:	48 b8 e1 2c 80 00 00 	movabs $0x802ce1,%rax
+  802dff:	00 00 00 
+  802e02:	ff d0                	call   *%rax
+  802e04:	83 e0 01             	and    $0x1,%eax
+}
+  802e07:	5d                   	pop    %rbp
+  802e08:	c3                   	ret
+
+0000000000802e09 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802e09:	55                   	push   %rbp
+  802e0a:	48 89 e5             	mov    %rsp,%rbp
+  802e0d:	41 57                	push   %r15
+  802e0f:	41 56                	push   %r14
+  802e11:	41 55                	push   %r13
+  802e13:	41 54                	push   %r12
+  802e15:	53                   	push   %rbx
+  802e16:	48 83 ec 18          	sub    $0x18,%rsp
+  802e1a:	49 89 ff             	mov    %rdi,%r15
+  802e1d:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802e21:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802e26:	49 bc f4 2d 80 00 00 	movabs $0x802df4,%r12
+  802e2d:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802e30:	49 be 95 2d 80 00 00 	movabs $0x802d95,%r14
+  802e37:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802e3a:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802e41:	00 00 00 
+  802e44:	eb 0c                	jmp    802e52 <foreach_shared_region+0x49>
+  802e46:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e4d:	4c 39 eb             	cmp    %r13,%rbx
+  802e50:	74 38                	je     802e8a <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802e52:	48 89 df             	mov    %rbx,%rdi
+  802e55:	41 ff d4             	call   *%r12
+  802e58:	84 c0                	test   %al,%al
+  802e5a:	74 ea                	je     802e46 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802e5c:	48 89 df             	mov    %rbx,%rdi
+  802e5f:	41 ff d6             	call   *%r14
+  802e62:	a8 40                	test   $0x40,%al
+  802e64:	74 e0                	je     802e46 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802e66:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802e6d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802e71:	48 89 df             	mov    %rbx,%rdi
+  802e74:	41 ff d7             	call   *%r15
+        if (err)
+  802e77:	85 c0                	test   %eax,%eax
+  802e79:	74 cb                	je     802e46 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802e7b:	48 83 c4 18          	add    $0x18,%rsp
+  802e7f:	5b                   	pop    %rbx
+  802e80:	41 5c                	pop    %r12
+  802e82:	41 5d                	pop    %r13
+  802e84:	41 5e                	pop    %r14
+  802e86:	41 5f                	pop    %r15
+  802e88:	5d                   	pop    %rbp
+  802e89:	c3                   	ret
+    return 0;
+  802e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e8f:	eb ea                	jmp    802e7b <foreach_shared_region+0x72>
+
+0000000000802e91 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802e91:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e96:	c3                   	ret
+
+0000000000802e97 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802e97:	55                   	push   %rbp
+  802e98:	48 89 e5             	mov    %rsp,%rbp
+  802e9b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802e9e:	48 be 74 39 80 00 00 	movabs $0x803974,%rsi
+  802ea5:	00 00 00 
+  802ea8:	48 b8 79 0f 80 00 00 	movabs $0x800f79,%rax
+  802eaf:	00 00 00 
+  802eb2:	ff d0                	call   *%rax
+    return 0;
+}
+  802eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb9:	5d                   	pop    %rbp
+  802eba:	c3                   	ret
+
+0000000000802ebb <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802ebb:	55                   	push   %rbp
+  802ebc:	48 89 e5             	mov    %rsp,%rbp
+  802ebf:	41 57                	push   %r15
+  802ec1:	41 56                	push   %r14
+  802ec3:	41 55                	push   %r13
+  802ec5:	41 54                	push   %r12
+  802ec7:	53                   	push   %rbx
+  802ec8:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802ecf:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802ed6:	48 85 d2             	test   %rdx,%rdx
+  802ed9:	74 7a                	je     802f55 <devcons_write+0x9a>
+  802edb:	49 89 d6             	mov    %rdx,%r14
+  802ede:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802ee4:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802ee9:	49 bf 73 11 80 00 00 	movabs $0x801173,%r15
+  802ef0:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802ef3:	4c 89 f3             	mov    %r14,%rbx
+  802ef6:	48 29 f3             	sub    %rsi,%rbx
+  802ef9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802efe:	48 39 c3             	cmp    %rax,%rbx
+  802f01:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802f05:	4c 63 eb             	movslq %ebx,%r13
+  802f08:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802f0f:	48 01 c6             	add    %rax,%rsi
+  802f12:	4c 89 ea             	mov    %r13,%rdx
+  802f15:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802f1c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802f1f:	4c 89 ee             	mov    %r13,%rsi
+  802f22:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802f29:	48 b8 a0 13 80 00 00 	movabs $0x8013a0,%rax
+  802f30:	00 00 00 
+  802f33:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802f35:	41 01 dc             	add    %ebx,%r12d
+  802f38:	49 63 f4             	movslq %r12d,%rsi
+  802f3b:	4c 39 f6             	cmp    %r14,%rsi
+  802f3e:	72 b3                	jb     802ef3 <devcons_write+0x38>
+    return res;
+  802f40:	49 63 c4             	movslq %r12d,%rax
+}
+  802f43:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802f4a:	5b                   	pop    %rbx
+  802f4b:	41 5c                	pop    %r12
+  802f4d:	41 5d                	pop    %r13
+  802f4f:	41 5e                	pop    %r14
+  802f51:	41 5f                	pop    %r15
+  802f53:	5d                   	pop    %rbp
+  802f54:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802f55:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802f5b:	eb e3                	jmp    802f40 <devcons_write+0x85>
+
+0000000000802f5d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802f5d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802f60:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f65:	48 85 c0             	test   %rax,%rax
+  802f68:	74 55                	je     802fbf <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802f6a:	55                   	push   %rbp
+  802f6b:	48 89 e5             	mov    %rsp,%rbp
+  802f6e:	41 55                	push   %r13
+  802f70:	41 54                	push   %r12
+  802f72:	53                   	push   %rbx
+  802f73:	48 83 ec 08          	sub    $0x8,%rsp
+  802f77:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802f7a:	48 bb cd 13 80 00 00 	movabs $0x8013cd,%rbx
+  802f81:	00 00 00 
+  802f84:	49 bc 9a 14 80 00 00 	movabs $0x80149a,%r12
+  802f8b:	00 00 00 
+  802f8e:	eb 03                	jmp    802f93 <devcons_read+0x36>
+  802f90:	41 ff d4             	call   *%r12
+  802f93:	ff d3                	call   *%rbx
+  802f95:	85 c0                	test   %eax,%eax
+  802f97:	74 f7                	je     802f90 <devcons_read+0x33>
+    if (c < 0) return c;
+  802f99:	48 63 d0             	movslq %eax,%rdx
+  802f9c:	78 13                	js     802fb1 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802f9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fa3:	83 f8 04             	cmp    $0x4,%eax
+  802fa6:	74 09                	je     802fb1 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802fa8:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802fac:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802fb1:	48 89 d0             	mov    %rdx,%rax
+  802fb4:	48 83 c4 08          	add    $0x8,%rsp
+  802fb8:	5b                   	pop    %rbx
+  802fb9:	41 5c                	pop    %r12
+  802fbb:	41 5d                	pop    %r13
+  802fbd:	5d                   	pop    %rbp
+  802fbe:	c3                   	ret
+  802fbf:	48 89 d0             	mov    %rdx,%rax
+  802fc2:	c3                   	ret
+
+0000000000802fc3 <cputchar>:
+cputchar(int ch) {
+  802fc3:	55                   	push   %rbp
+  802fc4:	48 89 e5             	mov    %rsp,%rbp
+  802fc7:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802fcb:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802fcf:	be 01 00 00 00       	mov    $0x1,%esi
+  802fd4:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802fd8:	48 b8 a0 13 80 00 00 	movabs $0x8013a0,%rax
+  802fdf:	00 00 00 
+  802fe2:	ff d0                	call   *%rax
+}
+  802fe4:	c9                   	leave
+  802fe5:	c3                   	ret
+
+0000000000802fe6 <getchar>:
+getchar(void) {
+  802fe6:	55                   	push   %rbp
+  802fe7:	48 89 e5             	mov    %rsp,%rbp
+  802fea:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802fee:	ba 01 00 00 00       	mov    $0x1,%edx
+  802ff3:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802ff7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ffc:	48 b8 b6 1f 80 00 00 	movabs $0x801fb6,%rax
+  803003:	00 00 00 
+  803006:	ff d0                	call   *%rax
+  803008:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80300a:	85 c0                	test   %eax,%eax
+  80300c:	78 06                	js     803014 <getchar+0x2e>
+  80300e:	74 08                	je     803018 <getchar+0x32>
+  803010:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803014:	89 d0                	mov    %edx,%eax
+  803016:	c9                   	leave
+  803017:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803018:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80301d:	eb f5                	jmp    803014 <getchar+0x2e>
+
+000000000080301f <iscons>:
+iscons(int fdnum) {
+  80301f:	55                   	push   %rbp
+  803020:	48 89 e5             	mov    %rsp,%rbp
+  803023:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803027:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80302b:	48 b8 d3 1c 80 00 00 	movabs $0x801cd3,%rax
+  803032:	00 00 00 
+  803035:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803037:	85 c0                	test   %eax,%eax
+  803039:	78 18                	js     803053 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80303b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80303f:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  803046:	00 00 00 
+  803049:	8b 00                	mov    (%rax),%eax
+  80304b:	39 02                	cmp    %eax,(%rdx)
+  80304d:	0f 94 c0             	sete   %al
+  803050:	0f b6 c0             	movzbl %al,%eax
+}
+  803053:	c9                   	leave
+  803054:	c3                   	ret
+
+0000000000803055 <opencons>:
+opencons(void) {
+  803055:	55                   	push   %rbp
+  803056:	48 89 e5             	mov    %rsp,%rbp
+  803059:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80305d:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803061:	48 b8 73 1c 80 00 00 	movabs $0x801c73,%rax
+  803068:	00 00 00 
+  80306b:	ff d0                	call   *%rax
+  80306d:	85 c0                	test   %eax,%eax
+  80306f:	78 49                	js     8030ba <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803071:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803076:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80307b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80307f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803084:	48 b8 29 15 80 00 00 	movabs $0x801529,%rax
+  80308b:	00 00 00 
+  80308e:	ff d0                	call   *%rax
+  803090:	85 c0                	test   %eax,%eax
+  803092:	78 26                	js     8030ba <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803094:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803098:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  80309f:	00 00 
+  8030a1:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8030a3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8030a7:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8030ae:	48 b8 45 1c 80 00 00 	movabs $0x801c45,%rax
+  8030b5:	00 00 00 
+  8030b8:	ff d0                	call   *%rax
+}
+  8030ba:	c9                   	leave
+  8030bb:	c3                   	ret
+
+00000000008030bc <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8030bc:	55                   	push   %rbp
+  8030bd:	48 89 e5             	mov    %rsp,%rbp
+  8030c0:	41 54                	push   %r12
+  8030c2:	53                   	push   %rbx
+  8030c3:	48 89 fb             	mov    %rdi,%rbx
+  8030c6:	48 89 f7             	mov    %rsi,%rdi
+  8030c9:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8030cc:	48 85 f6             	test   %rsi,%rsi
+  8030cf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8030d6:	00 00 00 
+  8030d9:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8030dd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8030e2:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  8030e9:	00 00 00 
+  8030ec:	ff d0                	call   *%rax
+    if (res < 0) {
+  8030ee:	85 c0                	test   %eax,%eax
+  8030f0:	78 45                	js     803137 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8030f2:	48 85 db             	test   %rbx,%rbx
+  8030f5:	74 12                	je     803109 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8030f7:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  8030fe:	00 00 00 
+  803101:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  803107:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  803109:	4d 85 e4             	test   %r12,%r12
+  80310c:	74 14                	je     803122 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  80310e:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  803115:	00 00 00 
+  803118:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  80311e:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  803122:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  803129:	00 00 00 
+  80312c:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  803132:	5b                   	pop    %rbx
+  803133:	41 5c                	pop    %r12
+  803135:	5d                   	pop    %rbp
+  803136:	c3                   	ret
+        if (from_env_store)
+  803137:	48 85 db             	test   %rbx,%rbx
+  80313a:	74 06                	je     803142 <ipc_recv+0x86>
+            *from_env_store = 0;
+  80313c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  803142:	4d 85 e4             	test   %r12,%r12
+  803145:	74 eb                	je     803132 <ipc_recv+0x76>
+            *perm_store = 0;
+  803147:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80314e:	00 
+  80314f:	eb e1                	jmp    803132 <ipc_recv+0x76>
+
+0000000000803151 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803151:	55                   	push   %rbp
+  803152:	48 89 e5             	mov    %rsp,%rbp
+  803155:	41 57                	push   %r15
+  803157:	41 56                	push   %r14
+  803159:	41 55                	push   %r13
+  80315b:	41 54                	push   %r12
+  80315d:	53                   	push   %rbx
+  80315e:	48 83 ec 18          	sub    $0x18,%rsp
+  803162:	41 89 fd             	mov    %edi,%r13d
+  803165:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803168:	48 89 d3             	mov    %rdx,%rbx
+  80316b:	49 89 cc             	mov    %rcx,%r12
+  80316e:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  803172:	48 85 d2             	test   %rdx,%rdx
+  803175:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80317c:	00 00 00 
+  80317f:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803183:	49 be 67 18 80 00 00 	movabs $0x801867,%r14
+  80318a:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  80318d:	49 bf 9a 14 80 00 00 	movabs $0x80149a,%r15
+  803194:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803197:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80319a:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  80319e:	4c 89 e1             	mov    %r12,%rcx
+  8031a1:	48 89 da             	mov    %rbx,%rdx
+  8031a4:	44 89 ef             	mov    %r13d,%edi
+  8031a7:	41 ff d6             	call   *%r14
+        if (res == 0)
+  8031aa:	85 c0                	test   %eax,%eax
+  8031ac:	74 34                	je     8031e2 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  8031ae:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8031b1:	75 05                	jne    8031b8 <ipc_send+0x67>
+        sys_yield();
+  8031b3:	41 ff d7             	call   *%r15
+    while (true) {
+  8031b6:	eb df                	jmp    803197 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  8031b8:	48 ba 80 39 80 00 00 	movabs $0x803980,%rdx
+  8031bf:	00 00 00 
+  8031c2:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8031c7:	48 bf 99 39 80 00 00 	movabs $0x803999,%rdi
+  8031ce:	00 00 00 
+  8031d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d6:	48 b9 04 05 80 00 00 	movabs $0x800504,%rcx
+  8031dd:	00 00 00 
+  8031e0:	ff d1                	call   *%rcx
+    }
+}
+  8031e2:	48 83 c4 18          	add    $0x18,%rsp
+  8031e6:	5b                   	pop    %rbx
+  8031e7:	41 5c                	pop    %r12
+  8031e9:	41 5d                	pop    %r13
+  8031eb:	41 5e                	pop    %r14
+  8031ed:	41 5f                	pop    %r15
+  8031ef:	5d                   	pop    %rbp
+  8031f0:	c3                   	ret
+
+00000000008031f1 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8031f1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8031f6:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8031fd:	00 00 00 
+  803200:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  803207:	48 01 ca             	add    %rcx,%rdx
+  80320a:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803210:	39 fa                	cmp    %edi,%edx
+  803212:	74 12                	je     803226 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803214:	48 83 c0 01          	add    $0x1,%rax
+  803218:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80321e:	75 e0                	jne    803200 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803220:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803225:	c3                   	ret
+            return envs[i].env_id;
+  803226:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80322d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803234:	00 00 00 
+  803237:	48 01 d0             	add    %rdx,%rax
+  80323a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803240:	c3                   	ret
+  803241:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000803248 <__rodata_start>:
+  803248:	2f                   	(bad)
+  803249:	00 25 31 31 64 20    	add    %ah,0x20643131(%rip)        # 20e46380 <__bss_end+0x2063e380>
+  80324f:	25 63 20 00 25       	and    $0x25002063,%eax
+  803254:	73 25                	jae    80327b <__rodata_start+0x33>
+  803256:	73 00                	jae    803258 <__rodata_start+0x10>
+  803258:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803259:	70 65                	jo     8032c0 <__rodata_start+0x78>
+  80325b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80325c:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a06cd5 <__bss_end+0x251fecd5>
+  803262:	69 00 75 73 65 72    	imul   $0x72657375,(%rax),%eax
+  803268:	2f                   	(bad)
+  803269:	6c                   	insb   (%dx),%es:(%rdi)
+  80326a:	73 2e                	jae    80329a <__rodata_start+0x52>
+  80326c:	63 00                	movsxd (%rax),%eax
+  80326e:	73 68                	jae    8032d8 <__rodata_start+0x90>
+  803270:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803271:	72 74                	jb     8032e7 <__rodata_start+0x9f>
+  803273:	20 72 65             	and    %dh,0x65(%rdx)
+  803276:	61                   	(bad)
+  803277:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  80327b:	20 64 69 72          	and    %ah,0x72(%rcx,%rbp,2)
+  80327f:	65 63 74 6f 72       	movsxd %gs:0x72(%rdi,%rbp,2),%esi
+  803284:	79 20                	jns    8032a6 <__rodata_start+0x5e>
+  803286:	25 73 00 73 74       	and    $0x74730073,%eax
+  80328b:	61                   	(bad)
+  80328c:	74 20                	je     8032ae <__rodata_start+0x66>
+  80328e:	25 73 3a 20 25       	and    $0x25203a73,%eax
+  803293:	69 00 75 73 61 67    	imul   $0x67617375,(%rax),%eax
+  803299:	65 3a 20             	cmp    %gs:(%rax),%ah
+  80329c:	6c                   	insb   (%dx),%es:(%rdi)
+  80329d:	73 20                	jae    8032bf <__rodata_start+0x77>
+  80329f:	5b                   	pop    %rbx
+  8032a0:	2d 64 46 6c 5d       	sub    $0x5d6c4664,%eax
+  8032a5:	20 5b 66             	and    %bl,0x66(%rbx)
+  8032a8:	69 6c 65 2e 2e 2e 5d 	imul   $0xa5d2e2e,0x2e(%rbp,%riz,2),%ebp
+  8032af:	0a 
+  8032b0:	00 0f                	add    %cl,(%rdi)
+  8032b2:	1f                   	(bad)
+  8032b3:	80 00 00             	addb   $0x0,(%rax)
+  8032b6:	00 00                	add    %al,(%rax)
+  8032b8:	65 72 72             	gs jb  80332d <__rodata_start+0xe5>
+  8032bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032bc:	72 20                	jb     8032de <__rodata_start+0x96>
+  8032be:	72 65                	jb     803325 <__rodata_start+0xdd>
+  8032c0:	61                   	(bad)
+  8032c1:	64 69 6e 67 20 64 69 	imul   $0x72696420,%fs:0x67(%rsi),%ebp
+  8032c8:	72 
+  8032c9:	65 63 74 6f 72       	movsxd %gs:0x72(%rdi,%rbp,2),%esi
+  8032ce:	79 20                	jns    8032f0 <__rodata_start+0xa8>
+  8032d0:	25 73 3a 20 25       	and    $0x25203a73,%eax
+  8032d5:	69 00 3c 75 6e 6b    	imul   $0x6b6e753c,(%rax),%eax
+  8032db:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032dc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032dd:	77 6e                	ja     80334d <__rodata_start+0x105>
+  8032df:	3e 00 0f             	ds add %cl,(%rdi)
+  8032e2:	1f                   	(bad)
+  8032e3:	80 00 00             	addb   $0x0,(%rax)
+  8032e6:	00 00                	add    %al,(%rax)
+  8032e8:	5b                   	pop    %rbx
+  8032e9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8032ee:	20 75 73             	and    %dh,0x73(%rbp)
+  8032f1:	65 72 20             	gs jb  803314 <__rodata_start+0xcc>
+  8032f4:	70 61                	jo     803357 <__rodata_start+0x10f>
+  8032f6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032f7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  8032fe:	73 20                	jae    803320 <__rodata_start+0xd8>
+  803300:	61                   	(bad)
+  803301:	74 20                	je     803323 <__rodata_start+0xdb>
+  803303:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803308:	3a 20                	cmp    (%rax),%ah
+  80330a:	00 30                	add    %dh,(%rax)
+  80330c:	31 32                	xor    %esi,(%rdx)
+  80330e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803315:	41                   	rex.B
+  803316:	42                   	rex.X
+  803317:	43                   	rex.XB
+  803318:	44                   	rex.R
+  803319:	45                   	rex.RB
+  80331a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80331d:	31 32                	xor    %esi,(%rdx)
+  80331f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803326:	61                   	(bad)
+  803327:	62 63 64 65 66       	(bad)
+  80332c:	00 28                	add    %ch,(%rax)
+  80332e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80332f:	75 6c                	jne    80339d <__rodata_start+0x155>
+  803331:	6c                   	insb   (%dx),%es:(%rdi)
+  803332:	29 00                	sub    %eax,(%rax)
+  803334:	65 72 72             	gs jb  8033a9 <__rodata_start+0x161>
+  803337:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803338:	72 20                	jb     80335a <__rodata_start+0x112>
+  80333a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80333f:	73 70                	jae    8033b1 <__rodata_start+0x169>
+  803341:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803345:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80334c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80334d:	72 00                	jb     80334f <__rodata_start+0x107>
+  80334f:	62 61 64 20 65       	(bad)
+  803354:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803355:	76 69                	jbe    8033c0 <__rodata_start+0x178>
+  803357:	72 6f                	jb     8033c8 <__rodata_start+0x180>
+  803359:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80335a:	6d                   	insl   (%dx),%es:(%rdi)
+  80335b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80335d:	74 00                	je     80335f <__rodata_start+0x117>
+  80335f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803366:	20 70 61             	and    %dh,0x61(%rax)
+  803369:	72 61                	jb     8033cc <__rodata_start+0x184>
+  80336b:	6d                   	insl   (%dx),%es:(%rdi)
+  80336c:	65 74 65             	gs je  8033d4 <__rodata_start+0x18c>
+  80336f:	72 00                	jb     803371 <__rodata_start+0x129>
+  803371:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803372:	75 74                	jne    8033e8 <__rodata_start+0x1a0>
+  803374:	20 6f 66             	and    %ch,0x66(%rdi)
+  803377:	20 6d 65             	and    %ch,0x65(%rbp)
+  80337a:	6d                   	insl   (%dx),%es:(%rdi)
+  80337b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80337c:	72 79                	jb     8033f7 <__rodata_start+0x1af>
+  80337e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803381:	74 20                	je     8033a3 <__rodata_start+0x15b>
+  803383:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803384:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803388:	76 69                	jbe    8033f3 <__rodata_start+0x1ab>
+  80338a:	72 6f                	jb     8033fb <__rodata_start+0x1b3>
+  80338c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80338d:	6d                   	insl   (%dx),%es:(%rdi)
+  80338e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803390:	74 73                	je     803405 <__rodata_start+0x1bd>
+  803392:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803395:	72 72                	jb     803409 <__rodata_start+0x1c1>
+  803397:	75 70                	jne    803409 <__rodata_start+0x1c1>
+  803399:	74 65                	je     803400 <__rodata_start+0x1b8>
+  80339b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8033a0:	75 67                	jne    803409 <__rodata_start+0x1c1>
+  8033a2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8033a5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8033a7:	00 73 65             	add    %dh,0x65(%rbx)
+  8033aa:	67 6d                	insl   (%dx),%es:(%edi)
+  8033ac:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8033ae:	74 61                	je     803411 <__rodata_start+0x1c9>
+  8033b0:	74 69                	je     80341b <__rodata_start+0x1d3>
+  8033b2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033b3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033b4:	20 66 61             	and    %ah,0x61(%rsi)
+  8033b7:	75 6c                	jne    803425 <__rodata_start+0x1dd>
+  8033b9:	74 00                	je     8033bb <__rodata_start+0x173>
+  8033bb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8033c2:	20 45 4c             	and    %al,0x4c(%rbp)
+  8033c5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8033c9:	61                   	(bad)
+  8033ca:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8033cf:	20 73 75             	and    %dh,0x75(%rbx)
+  8033d2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8033d5:	73 79                	jae    803450 <__rodata_start+0x208>
+  8033d7:	73 74                	jae    80344d <__rodata_start+0x205>
+  8033d9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8033db:	20 63 61             	and    %ah,0x61(%rbx)
+  8033de:	6c                   	insb   (%dx),%es:(%rdi)
+  8033df:	6c                   	insb   (%dx),%es:(%rdi)
+  8033e0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8033e3:	74 72                	je     803457 <__rodata_start+0x20f>
+  8033e5:	79 20                	jns    803407 <__rodata_start+0x1bf>
+  8033e7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033e8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033e9:	74 20                	je     80340b <__rodata_start+0x1c3>
+  8033eb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8033ed:	75 6e                	jne    80345d <__rodata_start+0x215>
+  8033ef:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8033f3:	76 20                	jbe    803415 <__rodata_start+0x1cd>
+  8033f5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8033fc:	72 65                	jb     803463 <__rodata_start+0x21b>
+  8033fe:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803401:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803402:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803406:	65 78 70             	gs js  803479 <__rodata_start+0x231>
+  803409:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80340e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803411:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803415:	20 66 69             	and    %ah,0x69(%rsi)
+  803418:	6c                   	insb   (%dx),%es:(%rdi)
+  803419:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80341d:	20 66 72             	and    %ah,0x72(%rsi)
+  803420:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803425:	61                   	(bad)
+  803426:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803429:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80342a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80342b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80342f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803432:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803433:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803434:	20 6d 61             	and    %ch,0x61(%rbp)
+  803437:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803438:	79 20                	jns    80345a <__rodata_start+0x212>
+  80343a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803441:	72 65                	jb     8034a8 <__rodata_start+0x260>
+  803443:	20 6f 70             	and    %ch,0x70(%rdi)
+  803446:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803448:	00 66 69             	add    %ah,0x69(%rsi)
+  80344b:	6c                   	insb   (%dx),%es:(%rdi)
+  80344c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803450:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803453:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803454:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803457:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803458:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803459:	74 20                	je     80347b <__rodata_start+0x233>
+  80345b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80345d:	75 6e                	jne    8034cd <__rodata_start+0x285>
+  80345f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803463:	76 61                	jbe    8034c6 <__rodata_start+0x27e>
+  803465:	6c                   	insb   (%dx),%es:(%rdi)
+  803466:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80346d:	00 
+  80346e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803475:	72 65                	jb     8034dc <__rodata_start+0x294>
+  803477:	61                   	(bad)
+  803478:	64 79 20             	fs jns 80349b <__rodata_start+0x253>
+  80347b:	65 78 69             	gs js  8034e7 <__rodata_start+0x29f>
+  80347e:	73 74                	jae    8034f4 <__rodata_start+0x2ac>
+  803480:	73 00                	jae    803482 <__rodata_start+0x23a>
+  803482:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803483:	70 65                	jo     8034ea <__rodata_start+0x2a2>
+  803485:	72 61                	jb     8034e8 <__rodata_start+0x2a0>
+  803487:	74 69                	je     8034f2 <__rodata_start+0x2aa>
+  803489:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80348a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80348b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80348e:	74 20                	je     8034b0 <__rodata_start+0x268>
+  803490:	73 75                	jae    803507 <__rodata_start+0x2bf>
+  803492:	70 70                	jo     803504 <__rodata_start+0x2bc>
+  803494:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803495:	72 74                	jb     80350b <__rodata_start+0x2c3>
+  803497:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  80349c:	65 72 61             	gs jb  803500 <__rodata_start+0x2b8>
+  80349f:	74 69                	je     80350a <__rodata_start+0x2c2>
+  8034a1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8034a2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8034a3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8034a6:	74 20                	je     8034c8 <__rodata_start+0x280>
+  8034a8:	70 65                	jo     80350f <__rodata_start+0x2c7>
+  8034aa:	72 6d                	jb     803519 <__rodata_start+0x2d1>
+  8034ac:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  8034b3:	2e 
+  8034b4:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8034bb:	00 
+  8034bc:	0f 1f 40 00          	nopl   0x0(%rax)
+  8034c0:	41 08 80 00 00 00 00 	or     %al,0x0(%r8)
+  8034c7:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 72 0e             	add    %dh,0xe(%rdx)
+  8034d2:	80 00 00             	addb   $0x0,(%rax)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8034dd:	00 00                	add    %al,(%rax)
+  8034df:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8034e5:	00 00                	add    %al,(%rax)
+  8034e7:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 60 08             	add    %ah,0x8(%rax)
+  8034fa:	80 00 00             	addb   $0x0,(%rax)
+  8034fd:	00 00                	add    %al,(%rax)
+  8034ff:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803505:	00 00                	add    %al,(%rax)
+  803507:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  80350d:	00 00                	add    %al,(%rax)
+  80350f:	00 54 08 80          	add    %dl,-0x80(%rax,%rcx,1)
+  803513:	00 00                	add    %al,(%rax)
+  803515:	00 00                	add    %al,(%rax)
+  803517:	00 ce                	add    %cl,%dh
+  803519:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80351f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803525:	00 00                	add    %al,(%rax)
+  803527:	00 54 08 80          	add    %dl,-0x80(%rax,%rcx,1)
+  80352b:	00 00                	add    %al,(%rax)
+  80352d:	00 00                	add    %al,(%rax)
+  80352f:	00 9a 08 80 00 00    	add    %bl,0x8008(%rdx)
+  803535:	00 00                	add    %al,(%rax)
+  803537:	00 9a 08 80 00 00    	add    %bl,0x8008(%rdx)
+  80353d:	00 00                	add    %al,(%rax)
+  80353f:	00 9a 08 80 00 00    	add    %bl,0x8008(%rdx)
+  803545:	00 00                	add    %al,(%rax)
+  803547:	00 9a 08 80 00 00    	add    %bl,0x8008(%rdx)
+  80354d:	00 00                	add    %al,(%rax)
+  80354f:	00 9a 08 80 00 00    	add    %bl,0x8008(%rdx)
+  803555:	00 00                	add    %al,(%rax)
+  803557:	00 9a 08 80 00 00    	add    %bl,0x8008(%rdx)
+  80355d:	00 00                	add    %al,(%rax)
+  80355f:	00 9a 08 80 00 00    	add    %bl,0x8008(%rdx)
+  803565:	00 00                	add    %al,(%rax)
+  803567:	00 9a 08 80 00 00    	add    %bl,0x8008(%rdx)
+  80356d:	00 00                	add    %al,(%rax)
+  80356f:	00 9a 08 80 00 00    	add    %bl,0x8008(%rdx)
+  803575:	00 00                	add    %al,(%rax)
+  803577:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  80357d:	00 00                	add    %al,(%rax)
+  80357f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803585:	00 00                	add    %al,(%rax)
+  803587:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  80358d:	00 00                	add    %al,(%rax)
+  80358f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803595:	00 00                	add    %al,(%rax)
+  803597:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  80359d:	00 00                	add    %al,(%rax)
+  80359f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8035a5:	00 00                	add    %al,(%rax)
+  8035a7:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8035ad:	00 00                	add    %al,(%rax)
+  8035af:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8035b5:	00 00                	add    %al,(%rax)
+  8035b7:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8035bd:	00 00                	add    %al,(%rax)
+  8035bf:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8035c5:	00 00                	add    %al,(%rax)
+  8035c7:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8035cd:	00 00                	add    %al,(%rax)
+  8035cf:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8035d5:	00 00                	add    %al,(%rax)
+  8035d7:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8035dd:	00 00                	add    %al,(%rax)
+  8035df:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8035e5:	00 00                	add    %al,(%rax)
+  8035e7:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8035ed:	00 00                	add    %al,(%rax)
+  8035ef:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8035f5:	00 00                	add    %al,(%rax)
+  8035f7:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8035fd:	00 00                	add    %al,(%rax)
+  8035ff:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803605:	00 00                	add    %al,(%rax)
+  803607:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  80360d:	00 00                	add    %al,(%rax)
+  80360f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803615:	00 00                	add    %al,(%rax)
+  803617:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  80361d:	00 00                	add    %al,(%rax)
+  80361f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803625:	00 00                	add    %al,(%rax)
+  803627:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  80362d:	00 00                	add    %al,(%rax)
+  80362f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803635:	00 00                	add    %al,(%rax)
+  803637:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  80363d:	00 00                	add    %al,(%rax)
+  80363f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803645:	00 00                	add    %al,(%rax)
+  803647:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  80364d:	00 00                	add    %al,(%rax)
+  80364f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803655:	00 00                	add    %al,(%rax)
+  803657:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  80365d:	00 00                	add    %al,(%rax)
+  80365f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803665:	00 00                	add    %al,(%rax)
+  803667:	00 a5 0d 80 00 00    	add    %ah,0x800d(%rbp)
+  80366d:	00 00                	add    %al,(%rax)
+  80366f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803675:	00 00                	add    %al,(%rax)
+  803677:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  80367d:	00 00                	add    %al,(%rax)
+  80367f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803685:	00 00                	add    %al,(%rax)
+  803687:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  80368d:	00 00                	add    %al,(%rax)
+  80368f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803695:	00 00                	add    %al,(%rax)
+  803697:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  80369d:	00 00                	add    %al,(%rax)
+  80369f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8036a5:	00 00                	add    %al,(%rax)
+  8036a7:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8036ad:	00 00                	add    %al,(%rax)
+  8036af:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8036b5:	00 00                	add    %al,(%rax)
+  8036b7:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8036bd:	00 00                	add    %al,(%rax)
+  8036bf:	00 f1                	add    %dh,%cl
+  8036c1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8036c7:	00 c0                	add    %al,%al
+  8036c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8036cf:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8036d5:	00 00                	add    %al,(%rax)
+  8036d7:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8036dd:	00 00                	add    %al,(%rax)
+  8036df:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8036e5:	00 00                	add    %al,(%rax)
+  8036e7:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8036ed:	00 00                	add    %al,(%rax)
+  8036ef:	00 20                	add    %ah,(%rax)
+  8036f1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8036f7:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  8036fd:	00 00                	add    %al,(%rax)
+  8036ff:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803705:	00 00                	add    %al,(%rax)
+  803707:	00 e6                	add    %ah,%dh
+  803709:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80370f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803715:	00 00                	add    %al,(%rax)
+  803717:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  80371d:	00 00                	add    %al,(%rax)
+  80371f:	00 68 0c             	add    %ch,0xc(%rax)
+  803722:	80 00 00             	addb   $0x0,(%rax)
+  803725:	00 00                	add    %al,(%rax)
+  803727:	00 32                	add    %dh,(%rdx)
+  803729:	0d 80 00 00 00       	or     $0x80,%eax
+  80372e:	00 00                	add    %al,(%rax)
+  803730:	82                   	(bad)
+  803731:	0e                   	(bad)
+  803732:	80 00 00             	addb   $0x0,(%rax)
+  803735:	00 00                	add    %al,(%rax)
+  803737:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  80373d:	00 00                	add    %al,(%rax)
+  80373f:	00 b7 09 80 00 00    	add    %dh,0x8009(%rdi)
+  803745:	00 00                	add    %al,(%rax)
+  803747:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  80374d:	00 00                	add    %al,(%rax)
+  80374f:	00 94 0b 80 00 00 00 	add    %dl,0x80(%rbx,%rcx,1)
+  803756:	00 00                	add    %al,(%rax)
+  803758:	82                   	(bad)
+  803759:	0e                   	(bad)
+  80375a:	80 00 00             	addb   $0x0,(%rax)
+  80375d:	00 00                	add    %al,(%rax)
+  80375f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803765:	00 00                	add    %al,(%rax)
+  803767:	00 a5 0d 80 00 00    	add    %ah,0x800d(%rbp)
+  80376d:	00 00                	add    %al,(%rax)
+  80376f:	00 82 0e 80 00 00    	add    %al,0x800e(%rdx)
+  803775:	00 00                	add    %al,(%rax)
+  803777:	00 4a 08             	add    %cl,0x8(%rdx)
+  80377a:	80 00 00             	addb   $0x0,(%rax)
+  80377d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803780 <error_string>:
+	...
+  803788:	3d 33 80 00 00 00 00 00 4f 33 80 00 00 00 00 00     =3......O3......
+  803798:	5f 33 80 00 00 00 00 00 71 33 80 00 00 00 00 00     _3......q3......
+  8037a8:	7f 33 80 00 00 00 00 00 93 33 80 00 00 00 00 00     .3.......3......
+  8037b8:	a8 33 80 00 00 00 00 00 bb 33 80 00 00 00 00 00     .3.......3......
+  8037c8:	cd 33 80 00 00 00 00 00 e1 33 80 00 00 00 00 00     .3.......3......
+  8037d8:	f1 33 80 00 00 00 00 00 04 34 80 00 00 00 00 00     .3.......4......
+  8037e8:	1b 34 80 00 00 00 00 00 31 34 80 00 00 00 00 00     .4......14......
+  8037f8:	49 34 80 00 00 00 00 00 61 34 80 00 00 00 00 00     I4......a4......
+  803808:	6e 34 80 00 00 00 00 00 30 38 80 00 00 00 00 00     n4......08......
+  803818:	82 34 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .4..............
+  803828:	9a 34 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .4......file is 
+  803838:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803848:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803858:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803868:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803878:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803888:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803898:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8038a8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8038b8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8038c8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8038d8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8038e8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8038f8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803900 <devtab>:
+  803900:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803910:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803920:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803930:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803940:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803950:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803960:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803970:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803980:	69 70 63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64     ipc_send: failed
+  803990:	20 74 6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63      to send.lib/ipc
+  8039a0:	2e 63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     .c.f.........f..
+  8039b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803aa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ab0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ac0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ad0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ae0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803af0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ba0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803be0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ca0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ce0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
@@ -0,0 +1,6105 @@
+
+obj/user/lsfd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4b 01 00 00       	call   80016e <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <usage>:
+#include <inc/lib.h>
+
+void
+usage(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("usage: lsfd [-1]\n");
+  800029:	48 bf 78 2f 80 00 00 	movabs $0x802f78,%rdi
+  800030:	00 00 00 
+  800033:	b8 00 00 00 00       	mov    $0x0,%eax
+  800038:	48 ba e5 02 80 00 00 	movabs $0x8002e5,%rdx
+  80003f:	00 00 00 
+  800042:	ff d2                	call   *%rdx
+    exit();
+  800044:	48 b8 15 02 80 00 00 	movabs $0x800215,%rax
+  80004b:	00 00 00 
+  80004e:	ff d0                	call   *%rax
+}
+  800050:	5d                   	pop    %rbp
+  800051:	c3                   	ret
+
+0000000000800052 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 57                	push   %r15
+  800058:	41 56                	push   %r14
+  80005a:	41 55                	push   %r13
+  80005c:	41 54                	push   %r12
+  80005e:	53                   	push   %rbx
+  80005f:	48 81 ec c8 00 00 00 	sub    $0xc8,%rsp
+  800066:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+    int i, usefprint = 0;
+    struct Stat st;
+    struct Argstate args;
+
+    argstart(&argc, argv, &args);
+  80006c:	48 8d 95 20 ff ff ff 	lea    -0xe0(%rbp),%rdx
+  800073:	48 8d bd 1c ff ff ff 	lea    -0xe4(%rbp),%rdi
+  80007a:	48 b8 5c 17 80 00 00 	movabs $0x80175c,%rax
+  800081:	00 00 00 
+  800084:	ff d0                	call   *%rax
+    int i, usefprint = 0;
+  800086:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((i = argnext(&args)) >= 0) {
+  80008c:	48 bb 89 17 80 00 00 	movabs $0x801789,%rbx
+  800093:	00 00 00 
+  800096:	48 8d bd 20 ff ff ff 	lea    -0xe0(%rbp),%rdi
+  80009d:	ff d3                	call   *%rbx
+  80009f:	85 c0                	test   %eax,%eax
+  8000a1:	78 1b                	js     8000be <umain+0x6c>
+        if (i == '1')
+  8000a3:	83 f8 31             	cmp    $0x31,%eax
+  8000a6:	75 08                	jne    8000b0 <umain+0x5e>
+            usefprint = 1;
+  8000a8:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8000ae:	eb e6                	jmp    800096 <umain+0x44>
+        else
+            usage();
+  8000b0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000b7:	00 00 00 
+  8000ba:	ff d0                	call   *%rax
+  8000bc:	eb d8                	jmp    800096 <umain+0x44>
+    }
+
+    for (i = 0; i < 32; i++) {
+  8000be:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fstat(i, &st) >= 0) {
+  8000c3:	49 bd 04 1f 80 00 00 	movabs $0x801f04,%r13
+  8000ca:	00 00 00 
+            if (usefprint) {
+                fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+                        i, st.st_name, st.st_isdir,
+                        st.st_size, st.st_dev->dev_name);
+            } else {
+                cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+  8000cd:	49 be 90 2f 80 00 00 	movabs $0x802f90,%r14
+  8000d4:	00 00 00 
+  8000d7:	49 bf e5 02 80 00 00 	movabs $0x8002e5,%r15
+  8000de:	00 00 00 
+  8000e1:	eb 2b                	jmp    80010e <umain+0xbc>
+  8000e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8000e7:	4c 8b 48 08          	mov    0x8(%rax),%r9
+  8000eb:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8000ef:	8b 4d c4             	mov    -0x3c(%rbp),%ecx
+  8000f2:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  8000f9:	89 de                	mov    %ebx,%esi
+  8000fb:	4c 89 f7             	mov    %r14,%rdi
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800103:	41 ff d7             	call   *%r15
+    for (i = 0; i < 32; i++) {
+  800106:	83 c3 01             	add    $0x1,%ebx
+  800109:	83 fb 20             	cmp    $0x20,%ebx
+  80010c:	74 51                	je     80015f <umain+0x10d>
+        if (fstat(i, &st) >= 0) {
+  80010e:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800115:	89 df                	mov    %ebx,%edi
+  800117:	41 ff d5             	call   *%r13
+  80011a:	85 c0                	test   %eax,%eax
+  80011c:	78 e8                	js     800106 <umain+0xb4>
+            if (usefprint) {
+  80011e:	45 85 e4             	test   %r12d,%r12d
+  800121:	74 c0                	je     8000e3 <umain+0x91>
+                fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+  800123:	48 83 ec 08          	sub    $0x8,%rsp
+  800127:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80012b:	ff 70 08             	push   0x8(%rax)
+  80012e:	44 8b 4d c0          	mov    -0x40(%rbp),%r9d
+  800132:	44 8b 45 c4          	mov    -0x3c(%rbp),%r8d
+  800136:	48 8d 8d 40 ff ff ff 	lea    -0xc0(%rbp),%rcx
+  80013d:	89 da                	mov    %ebx,%edx
+  80013f:	4c 89 f6             	mov    %r14,%rsi
+  800142:	bf 01 00 00 00       	mov    $0x1,%edi
+  800147:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014c:	49 ba f3 23 80 00 00 	movabs $0x8023f3,%r10
+  800153:	00 00 00 
+  800156:	41 ff d2             	call   *%r10
+  800159:	48 83 c4 10          	add    $0x10,%rsp
+  80015d:	eb a7                	jmp    800106 <umain+0xb4>
+                        i, st.st_name, st.st_isdir,
+                        st.st_size, st.st_dev->dev_name);
+            }
+        }
+    }
+}
+  80015f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800163:	5b                   	pop    %rbx
+  800164:	41 5c                	pop    %r12
+  800166:	41 5d                	pop    %r13
+  800168:	41 5e                	pop    %r14
+  80016a:	41 5f                	pop    %r15
+  80016c:	5d                   	pop    %rbp
+  80016d:	c3                   	ret
+
+000000000080016e <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80016e:	55                   	push   %rbp
+  80016f:	48 89 e5             	mov    %rsp,%rbp
+  800172:	41 56                	push   %r14
+  800174:	41 55                	push   %r13
+  800176:	41 54                	push   %r12
+  800178:	53                   	push   %rbx
+  800179:	41 89 fd             	mov    %edi,%r13d
+  80017c:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80017f:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800186:	00 00 00 
+  800189:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800190:	00 00 00 
+  800193:	48 39 c2             	cmp    %rax,%rdx
+  800196:	73 17                	jae    8001af <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800198:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80019b:	49 89 c4             	mov    %rax,%r12
+  80019e:	48 83 c3 08          	add    $0x8,%rbx
+  8001a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a7:	ff 53 f8             	call   *-0x8(%rbx)
+  8001aa:	4c 39 e3             	cmp    %r12,%rbx
+  8001ad:	72 ef                	jb     80019e <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8001af:	48 b8 fa 10 80 00 00 	movabs $0x8010fa,%rax
+  8001b6:	00 00 00 
+  8001b9:	ff d0                	call   *%rax
+  8001bb:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8001be:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8001c5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001cc:	00 00 00 
+  8001cf:	48 01 d0             	add    %rdx,%rax
+  8001d2:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8001d9:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001dc:	45 85 ed             	test   %r13d,%r13d
+  8001df:	7e 0d                	jle    8001ee <libmain+0x80>
+  8001e1:	49 8b 06             	mov    (%r14),%rax
+  8001e4:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001eb:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001ee:	4c 89 f6             	mov    %r14,%rsi
+  8001f1:	44 89 ef             	mov    %r13d,%edi
+  8001f4:	48 b8 52 00 80 00 00 	movabs $0x800052,%rax
+  8001fb:	00 00 00 
+  8001fe:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800200:	48 b8 15 02 80 00 00 	movabs $0x800215,%rax
+  800207:	00 00 00 
+  80020a:	ff d0                	call   *%rax
+#endif
+}
+  80020c:	5b                   	pop    %rbx
+  80020d:	41 5c                	pop    %r12
+  80020f:	41 5d                	pop    %r13
+  800211:	41 5e                	pop    %r14
+  800213:	5d                   	pop    %rbp
+  800214:	c3                   	ret
+
+0000000000800215 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800215:	55                   	push   %rbp
+  800216:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800219:	48 b8 fc 1a 80 00 00 	movabs $0x801afc,%rax
+  800220:	00 00 00 
+  800223:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800225:	bf 00 00 00 00       	mov    $0x0,%edi
+  80022a:	48 b8 8f 10 80 00 00 	movabs $0x80108f,%rax
+  800231:	00 00 00 
+  800234:	ff d0                	call   *%rax
+}
+  800236:	5d                   	pop    %rbp
+  800237:	c3                   	ret
+
+0000000000800238 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800238:	55                   	push   %rbp
+  800239:	48 89 e5             	mov    %rsp,%rbp
+  80023c:	53                   	push   %rbx
+  80023d:	48 83 ec 08          	sub    $0x8,%rsp
+  800241:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800244:	8b 06                	mov    (%rsi),%eax
+  800246:	8d 50 01             	lea    0x1(%rax),%edx
+  800249:	89 16                	mov    %edx,(%rsi)
+  80024b:	48 98                	cltq
+  80024d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800252:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800258:	74 0a                	je     800264 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80025a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80025e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800262:	c9                   	leave
+  800263:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800264:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800268:	be ff 00 00 00       	mov    $0xff,%esi
+  80026d:	48 b8 31 10 80 00 00 	movabs $0x801031,%rax
+  800274:	00 00 00 
+  800277:	ff d0                	call   *%rax
+        state->offset = 0;
+  800279:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80027f:	eb d9                	jmp    80025a <putch+0x22>
+
+0000000000800281 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800281:	55                   	push   %rbp
+  800282:	48 89 e5             	mov    %rsp,%rbp
+  800285:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80028c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80028f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800296:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80029b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002a3:	48 89 f1             	mov    %rsi,%rcx
+  8002a6:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002ad:	48 bf 38 02 80 00 00 	movabs $0x800238,%rdi
+  8002b4:	00 00 00 
+  8002b7:	48 b8 35 04 80 00 00 	movabs $0x800435,%rax
+  8002be:	00 00 00 
+  8002c1:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002c3:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002ca:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002d1:	48 b8 31 10 80 00 00 	movabs $0x801031,%rax
+  8002d8:	00 00 00 
+  8002db:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002dd:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002e3:	c9                   	leave
+  8002e4:	c3                   	ret
+
+00000000008002e5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002e5:	55                   	push   %rbp
+  8002e6:	48 89 e5             	mov    %rsp,%rbp
+  8002e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8002ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800301:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800308:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80030c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800310:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800314:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800318:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80031c:	48 b8 81 02 80 00 00 	movabs $0x800281,%rax
+  800323:	00 00 00 
+  800326:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800328:	c9                   	leave
+  800329:	c3                   	ret
+
+000000000080032a <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80032a:	55                   	push   %rbp
+  80032b:	48 89 e5             	mov    %rsp,%rbp
+  80032e:	41 57                	push   %r15
+  800330:	41 56                	push   %r14
+  800332:	41 55                	push   %r13
+  800334:	41 54                	push   %r12
+  800336:	53                   	push   %rbx
+  800337:	48 83 ec 18          	sub    $0x18,%rsp
+  80033b:	49 89 fc             	mov    %rdi,%r12
+  80033e:	49 89 f5             	mov    %rsi,%r13
+  800341:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800345:	8b 45 10             	mov    0x10(%rbp),%eax
+  800348:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80034b:	41 89 cf             	mov    %ecx,%r15d
+  80034e:	4c 39 fa             	cmp    %r15,%rdx
+  800351:	73 5b                	jae    8003ae <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800353:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800357:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80035b:	85 db                	test   %ebx,%ebx
+  80035d:	7e 0e                	jle    80036d <print_num+0x43>
+            putch(padc, put_arg);
+  80035f:	4c 89 ee             	mov    %r13,%rsi
+  800362:	44 89 f7             	mov    %r14d,%edi
+  800365:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800368:	83 eb 01             	sub    $0x1,%ebx
+  80036b:	75 f2                	jne    80035f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80036d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800371:	48 b9 d3 2f 80 00 00 	movabs $0x802fd3,%rcx
+  800378:	00 00 00 
+  80037b:	48 b8 c2 2f 80 00 00 	movabs $0x802fc2,%rax
+  800382:	00 00 00 
+  800385:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800389:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80038d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800392:	49 f7 f7             	div    %r15
+  800395:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800399:	4c 89 ee             	mov    %r13,%rsi
+  80039c:	41 ff d4             	call   *%r12
+}
+  80039f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003a3:	5b                   	pop    %rbx
+  8003a4:	41 5c                	pop    %r12
+  8003a6:	41 5d                	pop    %r13
+  8003a8:	41 5e                	pop    %r14
+  8003aa:	41 5f                	pop    %r15
+  8003ac:	5d                   	pop    %rbp
+  8003ad:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b7:	49 f7 f7             	div    %r15
+  8003ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8003be:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003c2:	52                   	push   %rdx
+  8003c3:	45 0f be c9          	movsbl %r9b,%r9d
+  8003c7:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003cb:	48 89 c2             	mov    %rax,%rdx
+  8003ce:	48 b8 2a 03 80 00 00 	movabs $0x80032a,%rax
+  8003d5:	00 00 00 
+  8003d8:	ff d0                	call   *%rax
+  8003da:	48 83 c4 10          	add    $0x10,%rsp
+  8003de:	eb 8d                	jmp    80036d <print_num+0x43>
+
+00000000008003e0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003e0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003e4:	48 8b 06             	mov    (%rsi),%rax
+  8003e7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003eb:	73 0a                	jae    8003f7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8003ed:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003f1:	48 89 16             	mov    %rdx,(%rsi)
+  8003f4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003f7:	c3                   	ret
+
+00000000008003f8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003f8:	55                   	push   %rbp
+  8003f9:	48 89 e5             	mov    %rsp,%rbp
+  8003fc:	48 83 ec 50          	sub    $0x50,%rsp
+  800400:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800404:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800408:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80040c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800413:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800417:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80041b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80041f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800423:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800427:	48 b8 35 04 80 00 00 	movabs $0x800435,%rax
+  80042e:	00 00 00 
+  800431:	ff d0                	call   *%rax
+}
+  800433:	c9                   	leave
+  800434:	c3                   	ret
+
+0000000000800435 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800435:	55                   	push   %rbp
+  800436:	48 89 e5             	mov    %rsp,%rbp
+  800439:	41 57                	push   %r15
+  80043b:	41 56                	push   %r14
+  80043d:	41 55                	push   %r13
+  80043f:	41 54                	push   %r12
+  800441:	53                   	push   %rbx
+  800442:	48 83 ec 38          	sub    $0x38,%rsp
+  800446:	49 89 fe             	mov    %rdi,%r14
+  800449:	49 89 f5             	mov    %rsi,%r13
+  80044c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80044f:	48 8b 01             	mov    (%rcx),%rax
+  800452:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800456:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80045a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80045e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800462:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800466:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80046a:	0f b6 3b             	movzbl (%rbx),%edi
+  80046d:	40 80 ff 25          	cmp    $0x25,%dil
+  800471:	74 18                	je     80048b <vprintfmt+0x56>
+            if (!ch) return;
+  800473:	40 84 ff             	test   %dil,%dil
+  800476:	0f 84 b1 06 00 00    	je     800b2d <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80047c:	40 0f b6 ff          	movzbl %dil,%edi
+  800480:	4c 89 ee             	mov    %r13,%rsi
+  800483:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800486:	4c 89 e3             	mov    %r12,%rbx
+  800489:	eb db                	jmp    800466 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80048b:	be 00 00 00 00       	mov    $0x0,%esi
+  800490:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800494:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800499:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80049f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004a6:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004aa:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004af:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004b4:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004b7:	83 e8 23             	sub    $0x23,%eax
+  8004ba:	3c 57                	cmp    $0x57,%al
+  8004bc:	0f 87 51 06 00 00    	ja     800b13 <vprintfmt+0x6de>
+  8004c2:	0f b6 c0             	movzbl %al,%eax
+  8004c5:	48 b9 80 31 80 00 00 	movabs $0x803180,%rcx
+  8004cc:	00 00 00 
+  8004cf:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004d2:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004d5:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004d9:	eb cf                	jmp    8004aa <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004db:	49 89 dc             	mov    %rbx,%r12
+  8004de:	be 01 00 00 00       	mov    $0x1,%esi
+  8004e3:	eb c5                	jmp    8004aa <vprintfmt+0x75>
+            padc = ch;
+  8004e5:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004e9:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004ec:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004ef:	eb b9                	jmp    8004aa <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8004f7:	77 24                	ja     80051d <vprintfmt+0xe8>
+  8004f9:	89 c1                	mov    %eax,%ecx
+  8004fb:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004ff:	83 c0 08             	add    $0x8,%eax
+  800502:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800505:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800508:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80050b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80050f:	79 99                	jns    8004aa <vprintfmt+0x75>
+                width = precision;
+  800511:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800515:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80051b:	eb 8d                	jmp    8004aa <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80051d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800521:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800525:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800529:	eb da                	jmp    800505 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80052b:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800530:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800534:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80053a:	3c 39                	cmp    $0x39,%al
+  80053c:	77 1c                	ja     80055a <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80053e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800542:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800546:	0f b6 c0             	movzbl %al,%eax
+  800549:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80054e:	0f b6 03             	movzbl (%rbx),%eax
+  800551:	3c 39                	cmp    $0x39,%al
+  800553:	76 e9                	jbe    80053e <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800555:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800558:	eb b1                	jmp    80050b <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80055a:	49 89 dc             	mov    %rbx,%r12
+  80055d:	eb ac                	jmp    80050b <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80055f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800562:	85 c9                	test   %ecx,%ecx
+  800564:	b8 00 00 00 00       	mov    $0x0,%eax
+  800569:	0f 49 c1             	cmovns %ecx,%eax
+  80056c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80056f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800572:	e9 33 ff ff ff       	jmp    8004aa <vprintfmt+0x75>
+            lflag++;
+  800577:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80057a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80057d:	e9 28 ff ff ff       	jmp    8004aa <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800582:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800585:	83 f8 2f             	cmp    $0x2f,%eax
+  800588:	77 19                	ja     8005a3 <vprintfmt+0x16e>
+  80058a:	89 c2                	mov    %eax,%edx
+  80058c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800590:	83 c0 08             	add    $0x8,%eax
+  800593:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800596:	8b 3a                	mov    (%rdx),%edi
+  800598:	4c 89 ee             	mov    %r13,%rsi
+  80059b:	41 ff d6             	call   *%r14
+            break;
+  80059e:	e9 c3 fe ff ff       	jmp    800466 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005af:	eb e5                	jmp    800596 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8005b7:	77 5a                	ja     800613 <vprintfmt+0x1de>
+  8005b9:	89 c2                	mov    %eax,%edx
+  8005bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005bf:	83 c0 08             	add    $0x8,%eax
+  8005c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005c5:	8b 02                	mov    (%rdx),%eax
+  8005c7:	89 c1                	mov    %eax,%ecx
+  8005c9:	f7 d9                	neg    %ecx
+  8005cb:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005ce:	83 f9 15             	cmp    $0x15,%ecx
+  8005d1:	7f 4e                	jg     800621 <vprintfmt+0x1ec>
+  8005d3:	48 63 c1             	movslq %ecx,%rax
+  8005d6:	48 ba 40 34 80 00 00 	movabs $0x803440,%rdx
+  8005dd:	00 00 00 
+  8005e0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005e4:	48 85 c0             	test   %rax,%rax
+  8005e7:	74 38                	je     800621 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005e9:	48 89 c1             	mov    %rax,%rcx
+  8005ec:	48 ba f9 35 80 00 00 	movabs $0x8035f9,%rdx
+  8005f3:	00 00 00 
+  8005f6:	4c 89 ee             	mov    %r13,%rsi
+  8005f9:	4c 89 f7             	mov    %r14,%rdi
+  8005fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800601:	49 b8 f8 03 80 00 00 	movabs $0x8003f8,%r8
+  800608:	00 00 00 
+  80060b:	41 ff d0             	call   *%r8
+  80060e:	e9 53 fe ff ff       	jmp    800466 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800613:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800617:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80061b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80061f:	eb a4                	jmp    8005c5 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800621:	48 ba eb 2f 80 00 00 	movabs $0x802feb,%rdx
+  800628:	00 00 00 
+  80062b:	4c 89 ee             	mov    %r13,%rsi
+  80062e:	4c 89 f7             	mov    %r14,%rdi
+  800631:	b8 00 00 00 00       	mov    $0x0,%eax
+  800636:	49 b8 f8 03 80 00 00 	movabs $0x8003f8,%r8
+  80063d:	00 00 00 
+  800640:	41 ff d0             	call   *%r8
+  800643:	e9 1e fe ff ff       	jmp    800466 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800648:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80064b:	83 f8 2f             	cmp    $0x2f,%eax
+  80064e:	77 6c                	ja     8006bc <vprintfmt+0x287>
+  800650:	89 c2                	mov    %eax,%edx
+  800652:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800656:	83 c0 08             	add    $0x8,%eax
+  800659:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80065c:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80065f:	48 85 d2             	test   %rdx,%rdx
+  800662:	48 b8 e4 2f 80 00 00 	movabs $0x802fe4,%rax
+  800669:	00 00 00 
+  80066c:	48 0f 45 c2          	cmovne %rdx,%rax
+  800670:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800674:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800678:	7e 06                	jle    800680 <vprintfmt+0x24b>
+  80067a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80067e:	75 4a                	jne    8006ca <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800680:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800684:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800688:	0f b6 00             	movzbl (%rax),%eax
+  80068b:	84 c0                	test   %al,%al
+  80068d:	0f 85 9a 00 00 00    	jne    80072d <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800693:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800696:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80069a:	85 c0                	test   %eax,%eax
+  80069c:	0f 8e c4 fd ff ff    	jle    800466 <vprintfmt+0x31>
+  8006a2:	4c 89 ee             	mov    %r13,%rsi
+  8006a5:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006aa:	41 ff d6             	call   *%r14
+  8006ad:	41 83 ec 01          	sub    $0x1,%r12d
+  8006b1:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006b5:	75 eb                	jne    8006a2 <vprintfmt+0x26d>
+  8006b7:	e9 aa fd ff ff       	jmp    800466 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c8:	eb 92                	jmp    80065c <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006ca:	49 63 f7             	movslq %r15d,%rsi
+  8006cd:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006d1:	48 b8 e7 0b 80 00 00 	movabs $0x800be7,%rax
+  8006d8:	00 00 00 
+  8006db:	ff d0                	call   *%rax
+  8006dd:	48 89 c2             	mov    %rax,%rdx
+  8006e0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006e3:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006e5:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006e8:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006eb:	85 c0                	test   %eax,%eax
+  8006ed:	7e 91                	jle    800680 <vprintfmt+0x24b>
+  8006ef:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006f4:	4c 89 ee             	mov    %r13,%rsi
+  8006f7:	44 89 e7             	mov    %r12d,%edi
+  8006fa:	41 ff d6             	call   *%r14
+  8006fd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800701:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800704:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800707:	75 eb                	jne    8006f4 <vprintfmt+0x2bf>
+  800709:	e9 72 ff ff ff       	jmp    800680 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80070e:	0f b6 f8             	movzbl %al,%edi
+  800711:	4c 89 ee             	mov    %r13,%rsi
+  800714:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800717:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80071b:	49 83 c4 01          	add    $0x1,%r12
+  80071f:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800725:	84 c0                	test   %al,%al
+  800727:	0f 84 66 ff ff ff    	je     800693 <vprintfmt+0x25e>
+  80072d:	45 85 ff             	test   %r15d,%r15d
+  800730:	78 0a                	js     80073c <vprintfmt+0x307>
+  800732:	41 83 ef 01          	sub    $0x1,%r15d
+  800736:	0f 88 57 ff ff ff    	js     800693 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80073c:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800740:	74 cc                	je     80070e <vprintfmt+0x2d9>
+  800742:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800745:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80074a:	80 fa 5e             	cmp    $0x5e,%dl
+  80074d:	77 c2                	ja     800711 <vprintfmt+0x2dc>
+  80074f:	eb bd                	jmp    80070e <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800751:	40 84 f6             	test   %sil,%sil
+  800754:	75 26                	jne    80077c <vprintfmt+0x347>
+    switch (lflag) {
+  800756:	85 d2                	test   %edx,%edx
+  800758:	74 59                	je     8007b3 <vprintfmt+0x37e>
+  80075a:	83 fa 01             	cmp    $0x1,%edx
+  80075d:	74 7b                	je     8007da <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80075f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800762:	83 f8 2f             	cmp    $0x2f,%eax
+  800765:	0f 87 96 00 00 00    	ja     800801 <vprintfmt+0x3cc>
+  80076b:	89 c2                	mov    %eax,%edx
+  80076d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800771:	83 c0 08             	add    $0x8,%eax
+  800774:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800777:	4c 8b 22             	mov    (%rdx),%r12
+  80077a:	eb 17                	jmp    800793 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80077c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80077f:	83 f8 2f             	cmp    $0x2f,%eax
+  800782:	77 21                	ja     8007a5 <vprintfmt+0x370>
+  800784:	89 c2                	mov    %eax,%edx
+  800786:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80078a:	83 c0 08             	add    $0x8,%eax
+  80078d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800790:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800793:	4d 85 e4             	test   %r12,%r12
+  800796:	78 7a                	js     800812 <vprintfmt+0x3dd>
+            num = i;
+  800798:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80079b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007a0:	e9 50 02 00 00       	jmp    8009f5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b1:	eb dd                	jmp    800790 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8007b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b9:	77 11                	ja     8007cc <vprintfmt+0x397>
+  8007bb:	89 c2                	mov    %eax,%edx
+  8007bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c1:	83 c0 08             	add    $0x8,%eax
+  8007c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c7:	4c 63 22             	movslq (%rdx),%r12
+  8007ca:	eb c7                	jmp    800793 <vprintfmt+0x35e>
+  8007cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d8:	eb ed                	jmp    8007c7 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8007da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e0:	77 11                	ja     8007f3 <vprintfmt+0x3be>
+  8007e2:	89 c2                	mov    %eax,%edx
+  8007e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e8:	83 c0 08             	add    $0x8,%eax
+  8007eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ee:	4c 8b 22             	mov    (%rdx),%r12
+  8007f1:	eb a0                	jmp    800793 <vprintfmt+0x35e>
+  8007f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ff:	eb ed                	jmp    8007ee <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800801:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800805:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800809:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80080d:	e9 65 ff ff ff       	jmp    800777 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800812:	4c 89 ee             	mov    %r13,%rsi
+  800815:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80081a:	41 ff d6             	call   *%r14
+                i = -i;
+  80081d:	49 f7 dc             	neg    %r12
+  800820:	e9 73 ff ff ff       	jmp    800798 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800825:	40 84 f6             	test   %sil,%sil
+  800828:	75 32                	jne    80085c <vprintfmt+0x427>
+    switch (lflag) {
+  80082a:	85 d2                	test   %edx,%edx
+  80082c:	74 5d                	je     80088b <vprintfmt+0x456>
+  80082e:	83 fa 01             	cmp    $0x1,%edx
+  800831:	0f 84 82 00 00 00    	je     8008b9 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800837:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083a:	83 f8 2f             	cmp    $0x2f,%eax
+  80083d:	0f 87 a5 00 00 00    	ja     8008e8 <vprintfmt+0x4b3>
+  800843:	89 c2                	mov    %eax,%edx
+  800845:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800849:	83 c0 08             	add    $0x8,%eax
+  80084c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800852:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800857:	e9 99 01 00 00       	jmp    8009f5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80085c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80085f:	83 f8 2f             	cmp    $0x2f,%eax
+  800862:	77 19                	ja     80087d <vprintfmt+0x448>
+  800864:	89 c2                	mov    %eax,%edx
+  800866:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086a:	83 c0 08             	add    $0x8,%eax
+  80086d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800870:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800873:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800878:	e9 78 01 00 00       	jmp    8009f5 <vprintfmt+0x5c0>
+  80087d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800881:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800885:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800889:	eb e5                	jmp    800870 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80088b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088e:	83 f8 2f             	cmp    $0x2f,%eax
+  800891:	77 18                	ja     8008ab <vprintfmt+0x476>
+  800893:	89 c2                	mov    %eax,%edx
+  800895:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800899:	83 c0 08             	add    $0x8,%eax
+  80089c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008a1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008a6:	e9 4a 01 00 00       	jmp    8009f5 <vprintfmt+0x5c0>
+  8008ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b7:	eb e6                	jmp    80089f <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8008b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008bf:	77 19                	ja     8008da <vprintfmt+0x4a5>
+  8008c1:	89 c2                	mov    %eax,%edx
+  8008c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c7:	83 c0 08             	add    $0x8,%eax
+  8008ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008cd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008d0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008d5:	e9 1b 01 00 00       	jmp    8009f5 <vprintfmt+0x5c0>
+  8008da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e6:	eb e5                	jmp    8008cd <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f4:	e9 56 ff ff ff       	jmp    80084f <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f9:	40 84 f6             	test   %sil,%sil
+  8008fc:	75 2e                	jne    80092c <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008fe:	85 d2                	test   %edx,%edx
+  800900:	74 59                	je     80095b <vprintfmt+0x526>
+  800902:	83 fa 01             	cmp    $0x1,%edx
+  800905:	74 7f                	je     800986 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800907:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090a:	83 f8 2f             	cmp    $0x2f,%eax
+  80090d:	0f 87 9f 00 00 00    	ja     8009b2 <vprintfmt+0x57d>
+  800913:	89 c2                	mov    %eax,%edx
+  800915:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800919:	83 c0 08             	add    $0x8,%eax
+  80091c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800922:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800927:	e9 c9 00 00 00       	jmp    8009f5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80092c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092f:	83 f8 2f             	cmp    $0x2f,%eax
+  800932:	77 19                	ja     80094d <vprintfmt+0x518>
+  800934:	89 c2                	mov    %eax,%edx
+  800936:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093a:	83 c0 08             	add    $0x8,%eax
+  80093d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800940:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800943:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800948:	e9 a8 00 00 00       	jmp    8009f5 <vprintfmt+0x5c0>
+  80094d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800951:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800955:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800959:	eb e5                	jmp    800940 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80095b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095e:	83 f8 2f             	cmp    $0x2f,%eax
+  800961:	77 15                	ja     800978 <vprintfmt+0x543>
+  800963:	89 c2                	mov    %eax,%edx
+  800965:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800969:	83 c0 08             	add    $0x8,%eax
+  80096c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096f:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800971:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800976:	eb 7d                	jmp    8009f5 <vprintfmt+0x5c0>
+  800978:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800980:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800984:	eb e9                	jmp    80096f <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800986:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800989:	83 f8 2f             	cmp    $0x2f,%eax
+  80098c:	77 16                	ja     8009a4 <vprintfmt+0x56f>
+  80098e:	89 c2                	mov    %eax,%edx
+  800990:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800994:	83 c0 08             	add    $0x8,%eax
+  800997:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80099d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8009a2:	eb 51                	jmp    8009f5 <vprintfmt+0x5c0>
+  8009a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b0:	eb e8                	jmp    80099a <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8009b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009be:	e9 5c ff ff ff       	jmp    80091f <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8009c3:	4c 89 ee             	mov    %r13,%rsi
+  8009c6:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009cb:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009ce:	4c 89 ee             	mov    %r13,%rsi
+  8009d1:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009d6:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009df:	77 47                	ja     800a28 <vprintfmt+0x5f3>
+  8009e1:	89 c2                	mov    %eax,%edx
+  8009e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e7:	83 c0 08             	add    $0x8,%eax
+  8009ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ed:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009f0:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8009f9:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009fd:	0f 94 c0             	sete   %al
+  800a00:	0f b6 c0             	movzbl %al,%eax
+  800a03:	50                   	push   %rax
+  800a04:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a09:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a0d:	4c 89 ee             	mov    %r13,%rsi
+  800a10:	4c 89 f7             	mov    %r14,%rdi
+  800a13:	48 b8 2a 03 80 00 00 	movabs $0x80032a,%rax
+  800a1a:	00 00 00 
+  800a1d:	ff d0                	call   *%rax
+            break;
+  800a1f:	48 83 c4 10          	add    $0x10,%rsp
+  800a23:	e9 3e fa ff ff       	jmp    800466 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a34:	eb b7                	jmp    8009ed <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a36:	40 84 f6             	test   %sil,%sil
+  800a39:	75 2b                	jne    800a66 <vprintfmt+0x631>
+    switch (lflag) {
+  800a3b:	85 d2                	test   %edx,%edx
+  800a3d:	74 56                	je     800a95 <vprintfmt+0x660>
+  800a3f:	83 fa 01             	cmp    $0x1,%edx
+  800a42:	74 7f                	je     800ac3 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a44:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a47:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4a:	0f 87 a2 00 00 00    	ja     800af2 <vprintfmt+0x6bd>
+  800a50:	89 c2                	mov    %eax,%edx
+  800a52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a56:	83 c0 08             	add    $0x8,%eax
+  800a59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a5f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a64:	eb 8f                	jmp    8009f5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a66:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a69:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6c:	77 19                	ja     800a87 <vprintfmt+0x652>
+  800a6e:	89 c2                	mov    %eax,%edx
+  800a70:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a74:	83 c0 08             	add    $0x8,%eax
+  800a77:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a7d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a82:	e9 6e ff ff ff       	jmp    8009f5 <vprintfmt+0x5c0>
+  800a87:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a93:	eb e5                	jmp    800a7a <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a95:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a98:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9b:	77 18                	ja     800ab5 <vprintfmt+0x680>
+  800a9d:	89 c2                	mov    %eax,%edx
+  800a9f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa3:	83 c0 08             	add    $0x8,%eax
+  800aa6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa9:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800aab:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ab0:	e9 40 ff ff ff       	jmp    8009f5 <vprintfmt+0x5c0>
+  800ab5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800abd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac1:	eb e6                	jmp    800aa9 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800ac3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac9:	77 19                	ja     800ae4 <vprintfmt+0x6af>
+  800acb:	89 c2                	mov    %eax,%edx
+  800acd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad1:	83 c0 08             	add    $0x8,%eax
+  800ad4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ada:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800adf:	e9 11 ff ff ff       	jmp    8009f5 <vprintfmt+0x5c0>
+  800ae4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af0:	eb e5                	jmp    800ad7 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800af2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800afa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800afe:	e9 59 ff ff ff       	jmp    800a5c <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b03:	4c 89 ee             	mov    %r13,%rsi
+  800b06:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b0b:	41 ff d6             	call   *%r14
+            break;
+  800b0e:	e9 53 f9 ff ff       	jmp    800466 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b13:	4c 89 ee             	mov    %r13,%rsi
+  800b16:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b1b:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b1e:	48 83 eb 01          	sub    $0x1,%rbx
+  800b22:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b26:	75 f6                	jne    800b1e <vprintfmt+0x6e9>
+  800b28:	e9 39 f9 ff ff       	jmp    800466 <vprintfmt+0x31>
+}
+  800b2d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b31:	5b                   	pop    %rbx
+  800b32:	41 5c                	pop    %r12
+  800b34:	41 5d                	pop    %r13
+  800b36:	41 5e                	pop    %r14
+  800b38:	41 5f                	pop    %r15
+  800b3a:	5d                   	pop    %rbp
+  800b3b:	c3                   	ret
+
+0000000000800b3c <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b3c:	55                   	push   %rbp
+  800b3d:	48 89 e5             	mov    %rsp,%rbp
+  800b40:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b44:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b48:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b4d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b51:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b58:	48 85 ff             	test   %rdi,%rdi
+  800b5b:	74 2b                	je     800b88 <vsnprintf+0x4c>
+  800b5d:	48 85 f6             	test   %rsi,%rsi
+  800b60:	74 26                	je     800b88 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b62:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b66:	48 bf e0 03 80 00 00 	movabs $0x8003e0,%rdi
+  800b6d:	00 00 00 
+  800b70:	48 b8 35 04 80 00 00 	movabs $0x800435,%rax
+  800b77:	00 00 00 
+  800b7a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b80:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b83:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b86:	c9                   	leave
+  800b87:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b88:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b8d:	eb f7                	jmp    800b86 <vsnprintf+0x4a>
+
+0000000000800b8f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b8f:	55                   	push   %rbp
+  800b90:	48 89 e5             	mov    %rsp,%rbp
+  800b93:	48 83 ec 50          	sub    $0x50,%rsp
+  800b97:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b9b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b9f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ba3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800baa:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bb6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800bba:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800bbe:	48 b8 3c 0b 80 00 00 	movabs $0x800b3c,%rax
+  800bc5:	00 00 00 
+  800bc8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800bca:	c9                   	leave
+  800bcb:	c3                   	ret
+
+0000000000800bcc <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bcc:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bcf:	74 10                	je     800be1 <strlen+0x15>
+    size_t n = 0;
+  800bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800bd6:	48 83 c0 01          	add    $0x1,%rax
+  800bda:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800bde:	75 f6                	jne    800bd6 <strlen+0xa>
+  800be0:	c3                   	ret
+    size_t n = 0;
+  800be1:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800be6:	c3                   	ret
+
+0000000000800be7 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800be7:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bea:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bef:	48 85 f6             	test   %rsi,%rsi
+  800bf2:	74 11                	je     800c05 <strnlen+0x1e>
+  800bf4:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bf8:	74 0c                	je     800c06 <strnlen+0x1f>
+  800bfa:	48 83 c2 01          	add    $0x1,%rdx
+  800bfe:	48 39 d0             	cmp    %rdx,%rax
+  800c01:	75 f1                	jne    800bf4 <strnlen+0xd>
+  800c03:	eb 04                	jmp    800c09 <strnlen+0x22>
+  800c05:	c3                   	ret
+  800c06:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c09:	c3                   	ret
+
+0000000000800c0a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c0a:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c12:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c16:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c19:	48 83 c2 01          	add    $0x1,%rdx
+  800c1d:	84 c9                	test   %cl,%cl
+  800c1f:	75 f1                	jne    800c12 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c21:	c3                   	ret
+
+0000000000800c22 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c22:	55                   	push   %rbp
+  800c23:	48 89 e5             	mov    %rsp,%rbp
+  800c26:	41 54                	push   %r12
+  800c28:	53                   	push   %rbx
+  800c29:	48 89 fb             	mov    %rdi,%rbx
+  800c2c:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c2f:	48 b8 cc 0b 80 00 00 	movabs $0x800bcc,%rax
+  800c36:	00 00 00 
+  800c39:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c3b:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c3f:	4c 89 e6             	mov    %r12,%rsi
+  800c42:	48 b8 0a 0c 80 00 00 	movabs $0x800c0a,%rax
+  800c49:	00 00 00 
+  800c4c:	ff d0                	call   *%rax
+    return dst;
+}
+  800c4e:	48 89 d8             	mov    %rbx,%rax
+  800c51:	5b                   	pop    %rbx
+  800c52:	41 5c                	pop    %r12
+  800c54:	5d                   	pop    %rbp
+  800c55:	c3                   	ret
+
+0000000000800c56 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c56:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c59:	48 85 d2             	test   %rdx,%rdx
+  800c5c:	74 1f                	je     800c7d <strncpy+0x27>
+  800c5e:	48 01 fa             	add    %rdi,%rdx
+  800c61:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c64:	48 83 c1 01          	add    $0x1,%rcx
+  800c68:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c6c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c70:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c74:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c78:	48 39 ca             	cmp    %rcx,%rdx
+  800c7b:	75 e7                	jne    800c64 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c7d:	c3                   	ret
+
+0000000000800c7e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c7e:	48 89 f8             	mov    %rdi,%rax
+  800c81:	48 85 d2             	test   %rdx,%rdx
+  800c84:	74 24                	je     800caa <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c86:	48 83 ea 01          	sub    $0x1,%rdx
+  800c8a:	74 1b                	je     800ca7 <strlcpy+0x29>
+  800c8c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c90:	0f b6 16             	movzbl (%rsi),%edx
+  800c93:	84 d2                	test   %dl,%dl
+  800c95:	74 10                	je     800ca7 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c97:	48 83 c6 01          	add    $0x1,%rsi
+  800c9b:	48 83 c0 01          	add    $0x1,%rax
+  800c9f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ca2:	48 39 c8             	cmp    %rcx,%rax
+  800ca5:	75 e9                	jne    800c90 <strlcpy+0x12>
+        *dst = '\0';
+  800ca7:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800caa:	48 29 f8             	sub    %rdi,%rax
+}
+  800cad:	c3                   	ret
+
+0000000000800cae <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800cae:	0f b6 07             	movzbl (%rdi),%eax
+  800cb1:	84 c0                	test   %al,%al
+  800cb3:	74 13                	je     800cc8 <strcmp+0x1a>
+  800cb5:	38 06                	cmp    %al,(%rsi)
+  800cb7:	75 0f                	jne    800cc8 <strcmp+0x1a>
+  800cb9:	48 83 c7 01          	add    $0x1,%rdi
+  800cbd:	48 83 c6 01          	add    $0x1,%rsi
+  800cc1:	0f b6 07             	movzbl (%rdi),%eax
+  800cc4:	84 c0                	test   %al,%al
+  800cc6:	75 ed                	jne    800cb5 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cc8:	0f b6 c0             	movzbl %al,%eax
+  800ccb:	0f b6 16             	movzbl (%rsi),%edx
+  800cce:	29 d0                	sub    %edx,%eax
+}
+  800cd0:	c3                   	ret
+
+0000000000800cd1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cd1:	48 85 d2             	test   %rdx,%rdx
+  800cd4:	74 1f                	je     800cf5 <strncmp+0x24>
+  800cd6:	0f b6 07             	movzbl (%rdi),%eax
+  800cd9:	84 c0                	test   %al,%al
+  800cdb:	74 1e                	je     800cfb <strncmp+0x2a>
+  800cdd:	3a 06                	cmp    (%rsi),%al
+  800cdf:	75 1a                	jne    800cfb <strncmp+0x2a>
+  800ce1:	48 83 c7 01          	add    $0x1,%rdi
+  800ce5:	48 83 c6 01          	add    $0x1,%rsi
+  800ce9:	48 83 ea 01          	sub    $0x1,%rdx
+  800ced:	75 e7                	jne    800cd6 <strncmp+0x5>
+
+    if (!n) return 0;
+  800cef:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf4:	c3                   	ret
+  800cf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfa:	c3                   	ret
+  800cfb:	48 85 d2             	test   %rdx,%rdx
+  800cfe:	74 09                	je     800d09 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d00:	0f b6 07             	movzbl (%rdi),%eax
+  800d03:	0f b6 16             	movzbl (%rsi),%edx
+  800d06:	29 d0                	sub    %edx,%eax
+  800d08:	c3                   	ret
+    if (!n) return 0;
+  800d09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d0e:	c3                   	ret
+
+0000000000800d0f <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d0f:	0f b6 17             	movzbl (%rdi),%edx
+  800d12:	84 d2                	test   %dl,%dl
+  800d14:	74 18                	je     800d2e <strchr+0x1f>
+        if (*str == c) {
+  800d16:	0f be d2             	movsbl %dl,%edx
+  800d19:	39 f2                	cmp    %esi,%edx
+  800d1b:	74 17                	je     800d34 <strchr+0x25>
+    for (; *str; str++) {
+  800d1d:	48 83 c7 01          	add    $0x1,%rdi
+  800d21:	0f b6 17             	movzbl (%rdi),%edx
+  800d24:	84 d2                	test   %dl,%dl
+  800d26:	75 ee                	jne    800d16 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d2d:	c3                   	ret
+  800d2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d33:	c3                   	ret
+  800d34:	48 89 f8             	mov    %rdi,%rax
+}
+  800d37:	c3                   	ret
+
+0000000000800d38 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d38:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d3b:	0f b6 17             	movzbl (%rdi),%edx
+  800d3e:	84 d2                	test   %dl,%dl
+  800d40:	74 13                	je     800d55 <strfind+0x1d>
+  800d42:	0f be d2             	movsbl %dl,%edx
+  800d45:	39 f2                	cmp    %esi,%edx
+  800d47:	74 0b                	je     800d54 <strfind+0x1c>
+  800d49:	48 83 c0 01          	add    $0x1,%rax
+  800d4d:	0f b6 10             	movzbl (%rax),%edx
+  800d50:	84 d2                	test   %dl,%dl
+  800d52:	75 ee                	jne    800d42 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d54:	c3                   	ret
+  800d55:	c3                   	ret
+
+0000000000800d56 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d56:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d59:	48 89 f8             	mov    %rdi,%rax
+  800d5c:	48 f7 d8             	neg    %rax
+  800d5f:	83 e0 07             	and    $0x7,%eax
+  800d62:	49 89 d1             	mov    %rdx,%r9
+  800d65:	49 29 c1             	sub    %rax,%r9
+  800d68:	78 36                	js     800da0 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d6a:	40 0f b6 c6          	movzbl %sil,%eax
+  800d6e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d75:	01 01 01 
+  800d78:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d7c:	40 f6 c7 07          	test   $0x7,%dil
+  800d80:	75 38                	jne    800dba <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d82:	4c 89 c9             	mov    %r9,%rcx
+  800d85:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d89:	74 0c                	je     800d97 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d8b:	fc                   	cld
+  800d8c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d8f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d93:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d97:	4d 85 c9             	test   %r9,%r9
+  800d9a:	75 45                	jne    800de1 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d9c:	4c 89 c0             	mov    %r8,%rax
+  800d9f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800da0:	48 85 d2             	test   %rdx,%rdx
+  800da3:	74 f7                	je     800d9c <memset+0x46>
+  800da5:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800da8:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800dab:	48 83 c0 01          	add    $0x1,%rax
+  800daf:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800db3:	48 39 c2             	cmp    %rax,%rdx
+  800db6:	75 f3                	jne    800dab <memset+0x55>
+  800db8:	eb e2                	jmp    800d9c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800dba:	40 f6 c7 01          	test   $0x1,%dil
+  800dbe:	74 06                	je     800dc6 <memset+0x70>
+  800dc0:	88 07                	mov    %al,(%rdi)
+  800dc2:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800dc6:	40 f6 c7 02          	test   $0x2,%dil
+  800dca:	74 07                	je     800dd3 <memset+0x7d>
+  800dcc:	66 89 07             	mov    %ax,(%rdi)
+  800dcf:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800dd3:	40 f6 c7 04          	test   $0x4,%dil
+  800dd7:	74 a9                	je     800d82 <memset+0x2c>
+  800dd9:	89 07                	mov    %eax,(%rdi)
+  800ddb:	48 83 c7 04          	add    $0x4,%rdi
+  800ddf:	eb a1                	jmp    800d82 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800de1:	41 f6 c1 04          	test   $0x4,%r9b
+  800de5:	74 06                	je     800ded <memset+0x97>
+  800de7:	89 07                	mov    %eax,(%rdi)
+  800de9:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ded:	41 f6 c1 02          	test   $0x2,%r9b
+  800df1:	74 07                	je     800dfa <memset+0xa4>
+  800df3:	66 89 07             	mov    %ax,(%rdi)
+  800df6:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800dfa:	41 f6 c1 01          	test   $0x1,%r9b
+  800dfe:	74 9c                	je     800d9c <memset+0x46>
+  800e00:	88 07                	mov    %al,(%rdi)
+  800e02:	eb 98                	jmp    800d9c <memset+0x46>
+
+0000000000800e04 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e04:	48 89 f8             	mov    %rdi,%rax
+  800e07:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e0a:	48 39 fe             	cmp    %rdi,%rsi
+  800e0d:	73 3b                	jae    800e4a <memmove+0x46>
+  800e0f:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e13:	48 39 d7             	cmp    %rdx,%rdi
+  800e16:	73 32                	jae    800e4a <memmove+0x46>
+        s += n;
+        d += n;
+  800e18:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e1c:	48 89 d6             	mov    %rdx,%rsi
+  800e1f:	48 09 fe             	or     %rdi,%rsi
+  800e22:	48 09 ce             	or     %rcx,%rsi
+  800e25:	40 f6 c6 07          	test   $0x7,%sil
+  800e29:	75 12                	jne    800e3d <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e2b:	48 83 ef 08          	sub    $0x8,%rdi
+  800e2f:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e33:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e37:	fd                   	std
+  800e38:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e3b:	fc                   	cld
+  800e3c:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e3d:	48 83 ef 01          	sub    $0x1,%rdi
+  800e41:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e45:	fd                   	std
+  800e46:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e48:	eb f1                	jmp    800e3b <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e4a:	48 89 f2             	mov    %rsi,%rdx
+  800e4d:	48 09 c2             	or     %rax,%rdx
+  800e50:	48 09 ca             	or     %rcx,%rdx
+  800e53:	f6 c2 07             	test   $0x7,%dl
+  800e56:	75 0c                	jne    800e64 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e58:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e5c:	48 89 c7             	mov    %rax,%rdi
+  800e5f:	fc                   	cld
+  800e60:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e63:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e64:	48 89 c7             	mov    %rax,%rdi
+  800e67:	fc                   	cld
+  800e68:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e6a:	c3                   	ret
+
+0000000000800e6b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e6b:	55                   	push   %rbp
+  800e6c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e6f:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  800e76:	00 00 00 
+  800e79:	ff d0                	call   *%rax
+}
+  800e7b:	5d                   	pop    %rbp
+  800e7c:	c3                   	ret
+
+0000000000800e7d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e7d:	55                   	push   %rbp
+  800e7e:	48 89 e5             	mov    %rsp,%rbp
+  800e81:	41 57                	push   %r15
+  800e83:	41 56                	push   %r14
+  800e85:	41 55                	push   %r13
+  800e87:	41 54                	push   %r12
+  800e89:	53                   	push   %rbx
+  800e8a:	48 83 ec 08          	sub    $0x8,%rsp
+  800e8e:	49 89 fe             	mov    %rdi,%r14
+  800e91:	49 89 f7             	mov    %rsi,%r15
+  800e94:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e97:	48 89 f7             	mov    %rsi,%rdi
+  800e9a:	48 b8 cc 0b 80 00 00 	movabs $0x800bcc,%rax
+  800ea1:	00 00 00 
+  800ea4:	ff d0                	call   *%rax
+  800ea6:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800ea9:	48 89 de             	mov    %rbx,%rsi
+  800eac:	4c 89 f7             	mov    %r14,%rdi
+  800eaf:	48 b8 e7 0b 80 00 00 	movabs $0x800be7,%rax
+  800eb6:	00 00 00 
+  800eb9:	ff d0                	call   *%rax
+  800ebb:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ebe:	48 39 c3             	cmp    %rax,%rbx
+  800ec1:	74 36                	je     800ef9 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800ec3:	48 89 d8             	mov    %rbx,%rax
+  800ec6:	4c 29 e8             	sub    %r13,%rax
+  800ec9:	49 39 c4             	cmp    %rax,%r12
+  800ecc:	73 31                	jae    800eff <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800ece:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800ed3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ed7:	4c 89 fe             	mov    %r15,%rsi
+  800eda:	48 b8 6b 0e 80 00 00 	movabs $0x800e6b,%rax
+  800ee1:	00 00 00 
+  800ee4:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800ee6:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800eea:	48 83 c4 08          	add    $0x8,%rsp
+  800eee:	5b                   	pop    %rbx
+  800eef:	41 5c                	pop    %r12
+  800ef1:	41 5d                	pop    %r13
+  800ef3:	41 5e                	pop    %r14
+  800ef5:	41 5f                	pop    %r15
+  800ef7:	5d                   	pop    %rbp
+  800ef8:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ef9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800efd:	eb eb                	jmp    800eea <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800eff:	48 83 eb 01          	sub    $0x1,%rbx
+  800f03:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f07:	48 89 da             	mov    %rbx,%rdx
+  800f0a:	4c 89 fe             	mov    %r15,%rsi
+  800f0d:	48 b8 6b 0e 80 00 00 	movabs $0x800e6b,%rax
+  800f14:	00 00 00 
+  800f17:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f19:	49 01 de             	add    %rbx,%r14
+  800f1c:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f21:	eb c3                	jmp    800ee6 <strlcat+0x69>
+
+0000000000800f23 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f23:	48 85 d2             	test   %rdx,%rdx
+  800f26:	74 2d                	je     800f55 <memcmp+0x32>
+  800f28:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f2d:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f31:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f36:	44 38 c1             	cmp    %r8b,%cl
+  800f39:	75 0f                	jne    800f4a <memcmp+0x27>
+    while (n-- > 0) {
+  800f3b:	48 83 c0 01          	add    $0x1,%rax
+  800f3f:	48 39 c2             	cmp    %rax,%rdx
+  800f42:	75 e9                	jne    800f2d <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f44:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f49:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f4a:	0f b6 c1             	movzbl %cl,%eax
+  800f4d:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f51:	44 29 c0             	sub    %r8d,%eax
+  800f54:	c3                   	ret
+    return 0;
+  800f55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f5a:	c3                   	ret
+
+0000000000800f5b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f5b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f5f:	48 39 c7             	cmp    %rax,%rdi
+  800f62:	73 0f                	jae    800f73 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f64:	40 38 37             	cmp    %sil,(%rdi)
+  800f67:	74 0e                	je     800f77 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f69:	48 83 c7 01          	add    $0x1,%rdi
+  800f6d:	48 39 f8             	cmp    %rdi,%rax
+  800f70:	75 f2                	jne    800f64 <memfind+0x9>
+  800f72:	c3                   	ret
+  800f73:	48 89 f8             	mov    %rdi,%rax
+  800f76:	c3                   	ret
+  800f77:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f7a:	c3                   	ret
+
+0000000000800f7b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f7b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f7e:	0f b6 37             	movzbl (%rdi),%esi
+  800f81:	40 80 fe 20          	cmp    $0x20,%sil
+  800f85:	74 06                	je     800f8d <strtol+0x12>
+  800f87:	40 80 fe 09          	cmp    $0x9,%sil
+  800f8b:	75 13                	jne    800fa0 <strtol+0x25>
+  800f8d:	48 83 c7 01          	add    $0x1,%rdi
+  800f91:	0f b6 37             	movzbl (%rdi),%esi
+  800f94:	40 80 fe 20          	cmp    $0x20,%sil
+  800f98:	74 f3                	je     800f8d <strtol+0x12>
+  800f9a:	40 80 fe 09          	cmp    $0x9,%sil
+  800f9e:	74 ed                	je     800f8d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800fa0:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800fa3:	83 e0 fd             	and    $0xfffffffd,%eax
+  800fa6:	3c 01                	cmp    $0x1,%al
+  800fa8:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fac:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800fb2:	75 0f                	jne    800fc3 <strtol+0x48>
+  800fb4:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800fb7:	74 14                	je     800fcd <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800fb9:	85 d2                	test   %edx,%edx
+  800fbb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fc0:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800fc3:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800fc8:	4c 63 ca             	movslq %edx,%r9
+  800fcb:	eb 36                	jmp    801003 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fcd:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800fd1:	74 0f                	je     800fe2 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800fd3:	85 d2                	test   %edx,%edx
+  800fd5:	75 ec                	jne    800fc3 <strtol+0x48>
+        s++;
+  800fd7:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800fdb:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800fe0:	eb e1                	jmp    800fc3 <strtol+0x48>
+        s += 2;
+  800fe2:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800fe6:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800feb:	eb d6                	jmp    800fc3 <strtol+0x48>
+            dig -= '0';
+  800fed:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ff0:	44 0f b6 c1          	movzbl %cl,%r8d
+  800ff4:	41 39 d0             	cmp    %edx,%r8d
+  800ff7:	7d 21                	jge    80101a <strtol+0x9f>
+        val = val * base + dig;
+  800ff9:	49 0f af c1          	imul   %r9,%rax
+  800ffd:	0f b6 c9             	movzbl %cl,%ecx
+  801000:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801003:	48 83 c7 01          	add    $0x1,%rdi
+  801007:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80100b:	80 f9 39             	cmp    $0x39,%cl
+  80100e:	76 dd                	jbe    800fed <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801010:	80 f9 7b             	cmp    $0x7b,%cl
+  801013:	77 05                	ja     80101a <strtol+0x9f>
+            dig -= 'a' - 10;
+  801015:	83 e9 57             	sub    $0x57,%ecx
+  801018:	eb d6                	jmp    800ff0 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80101a:	4d 85 d2             	test   %r10,%r10
+  80101d:	74 03                	je     801022 <strtol+0xa7>
+  80101f:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801022:	48 89 c2             	mov    %rax,%rdx
+  801025:	48 f7 da             	neg    %rdx
+  801028:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80102c:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801030:	c3                   	ret
+
+0000000000801031 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801031:	55                   	push   %rbp
+  801032:	48 89 e5             	mov    %rsp,%rbp
+  801035:	53                   	push   %rbx
+  801036:	48 89 fa             	mov    %rdi,%rdx
+  801039:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80103c:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801041:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801046:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80104b:	be 00 00 00 00       	mov    $0x0,%esi
+  801050:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801056:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801058:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80105c:	c9                   	leave
+  80105d:	c3                   	ret
+
+000000000080105e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80105e:	55                   	push   %rbp
+  80105f:	48 89 e5             	mov    %rsp,%rbp
+  801062:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801063:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801068:	ba 00 00 00 00       	mov    $0x0,%edx
+  80106d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801072:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801077:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80107c:	be 00 00 00 00       	mov    $0x0,%esi
+  801081:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801087:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801089:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80108d:	c9                   	leave
+  80108e:	c3                   	ret
+
+000000000080108f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80108f:	55                   	push   %rbp
+  801090:	48 89 e5             	mov    %rsp,%rbp
+  801093:	53                   	push   %rbx
+  801094:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801098:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80109b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010aa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010af:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010ba:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010bc:	48 85 c0             	test   %rax,%rax
+  8010bf:	7f 06                	jg     8010c7 <sys_env_destroy+0x38>
+}
+  8010c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010c5:	c9                   	leave
+  8010c6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010c7:	49 89 c0             	mov    %rax,%r8
+  8010ca:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8010cf:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  8010d6:	00 00 00 
+  8010d9:	be 26 00 00 00       	mov    $0x26,%esi
+  8010de:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  8010e5:	00 00 00 
+  8010e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ed:	49 b9 4d 2d 80 00 00 	movabs $0x802d4d,%r9
+  8010f4:	00 00 00 
+  8010f7:	41 ff d1             	call   *%r9
+
+00000000008010fa <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8010fa:	55                   	push   %rbp
+  8010fb:	48 89 e5             	mov    %rsp,%rbp
+  8010fe:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010ff:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801104:	ba 00 00 00 00       	mov    $0x0,%edx
+  801109:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80110e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801113:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801118:	be 00 00 00 00       	mov    $0x0,%esi
+  80111d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801123:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801125:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801129:	c9                   	leave
+  80112a:	c3                   	ret
+
+000000000080112b <sys_yield>:
+
+void
+sys_yield(void) {
+  80112b:	55                   	push   %rbp
+  80112c:	48 89 e5             	mov    %rsp,%rbp
+  80112f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801130:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80113a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80113f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801144:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801149:	be 00 00 00 00       	mov    $0x0,%esi
+  80114e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801154:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801156:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80115a:	c9                   	leave
+  80115b:	c3                   	ret
+
+000000000080115c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80115c:	55                   	push   %rbp
+  80115d:	48 89 e5             	mov    %rsp,%rbp
+  801160:	53                   	push   %rbx
+  801161:	48 89 fa             	mov    %rdi,%rdx
+  801164:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801167:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80116c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801173:	00 00 00 
+  801176:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80117b:	be 00 00 00 00       	mov    $0x0,%esi
+  801180:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801186:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801188:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80118c:	c9                   	leave
+  80118d:	c3                   	ret
+
+000000000080118e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80118e:	55                   	push   %rbp
+  80118f:	48 89 e5             	mov    %rsp,%rbp
+  801192:	53                   	push   %rbx
+  801193:	49 89 f8             	mov    %rdi,%r8
+  801196:	48 89 d3             	mov    %rdx,%rbx
+  801199:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80119c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011a1:	4c 89 c2             	mov    %r8,%rdx
+  8011a4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011b2:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8011b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b8:	c9                   	leave
+  8011b9:	c3                   	ret
+
+00000000008011ba <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8011ba:	55                   	push   %rbp
+  8011bb:	48 89 e5             	mov    %rsp,%rbp
+  8011be:	53                   	push   %rbx
+  8011bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8011c3:	89 f8                	mov    %edi,%eax
+  8011c5:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8011c8:	48 63 f9             	movslq %ecx,%rdi
+  8011cb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ce:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011d3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011e1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011e3:	48 85 c0             	test   %rax,%rax
+  8011e6:	7f 06                	jg     8011ee <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ec:	c9                   	leave
+  8011ed:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011ee:	49 89 c0             	mov    %rax,%r8
+  8011f1:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011f6:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  8011fd:	00 00 00 
+  801200:	be 26 00 00 00       	mov    $0x26,%esi
+  801205:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  80120c:	00 00 00 
+  80120f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801214:	49 b9 4d 2d 80 00 00 	movabs $0x802d4d,%r9
+  80121b:	00 00 00 
+  80121e:	41 ff d1             	call   *%r9
+
+0000000000801221 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801221:	55                   	push   %rbp
+  801222:	48 89 e5             	mov    %rsp,%rbp
+  801225:	53                   	push   %rbx
+  801226:	48 83 ec 08          	sub    $0x8,%rsp
+  80122a:	89 f8                	mov    %edi,%eax
+  80122c:	49 89 f2             	mov    %rsi,%r10
+  80122f:	48 89 cf             	mov    %rcx,%rdi
+  801232:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801235:	48 63 da             	movslq %edx,%rbx
+  801238:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80123b:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801240:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801243:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801246:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801248:	48 85 c0             	test   %rax,%rax
+  80124b:	7f 06                	jg     801253 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80124d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801251:	c9                   	leave
+  801252:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801253:	49 89 c0             	mov    %rax,%r8
+  801256:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80125b:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  801262:	00 00 00 
+  801265:	be 26 00 00 00       	mov    $0x26,%esi
+  80126a:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801271:	00 00 00 
+  801274:	b8 00 00 00 00       	mov    $0x0,%eax
+  801279:	49 b9 4d 2d 80 00 00 	movabs $0x802d4d,%r9
+  801280:	00 00 00 
+  801283:	41 ff d1             	call   *%r9
+
+0000000000801286 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801286:	55                   	push   %rbp
+  801287:	48 89 e5             	mov    %rsp,%rbp
+  80128a:	53                   	push   %rbx
+  80128b:	48 83 ec 08          	sub    $0x8,%rsp
+  80128f:	48 89 f1             	mov    %rsi,%rcx
+  801292:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801295:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801298:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80129d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ad:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012af:	48 85 c0             	test   %rax,%rax
+  8012b2:	7f 06                	jg     8012ba <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8012b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b8:	c9                   	leave
+  8012b9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ba:	49 89 c0             	mov    %rax,%r8
+  8012bd:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8012c2:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  8012c9:	00 00 00 
+  8012cc:	be 26 00 00 00       	mov    $0x26,%esi
+  8012d1:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  8012d8:	00 00 00 
+  8012db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e0:	49 b9 4d 2d 80 00 00 	movabs $0x802d4d,%r9
+  8012e7:	00 00 00 
+  8012ea:	41 ff d1             	call   *%r9
+
+00000000008012ed <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8012ed:	55                   	push   %rbp
+  8012ee:	48 89 e5             	mov    %rsp,%rbp
+  8012f1:	53                   	push   %rbx
+  8012f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8012f6:	89 f8                	mov    %edi,%eax
+  8012f8:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8012fb:	48 63 f9             	movslq %ecx,%rdi
+  8012fe:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801301:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801306:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801309:	be 00 00 00 00       	mov    $0x0,%esi
+  80130e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801314:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801316:	48 85 c0             	test   %rax,%rax
+  801319:	7f 06                	jg     801321 <sys_region_advise+0x34>
+}
+  80131b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131f:	c9                   	leave
+  801320:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801321:	49 89 c0             	mov    %rax,%r8
+  801324:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801329:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  801330:	00 00 00 
+  801333:	be 26 00 00 00       	mov    $0x26,%esi
+  801338:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  80133f:	00 00 00 
+  801342:	b8 00 00 00 00       	mov    $0x0,%eax
+  801347:	49 b9 4d 2d 80 00 00 	movabs $0x802d4d,%r9
+  80134e:	00 00 00 
+  801351:	41 ff d1             	call   *%r9
+
+0000000000801354 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801354:	55                   	push   %rbp
+  801355:	48 89 e5             	mov    %rsp,%rbp
+  801358:	53                   	push   %rbx
+  801359:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80135d:	48 63 ce             	movslq %esi,%rcx
+  801360:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801363:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801368:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801372:	be 00 00 00 00       	mov    $0x0,%esi
+  801377:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80137d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80137f:	48 85 c0             	test   %rax,%rax
+  801382:	7f 06                	jg     80138a <sys_env_set_nice+0x36>
+}
+  801384:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801388:	c9                   	leave
+  801389:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80138a:	49 89 c0             	mov    %rax,%r8
+  80138d:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801392:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  801399:	00 00 00 
+  80139c:	be 26 00 00 00       	mov    $0x26,%esi
+  8013a1:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  8013a8:	00 00 00 
+  8013ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b0:	49 b9 4d 2d 80 00 00 	movabs $0x802d4d,%r9
+  8013b7:	00 00 00 
+  8013ba:	41 ff d1             	call   *%r9
+
+00000000008013bd <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8013bd:	55                   	push   %rbp
+  8013be:	48 89 e5             	mov    %rsp,%rbp
+  8013c1:	53                   	push   %rbx
+  8013c2:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8013c6:	48 63 ce             	movslq %esi,%rcx
+  8013c9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013cc:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013db:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013e8:	48 85 c0             	test   %rax,%rax
+  8013eb:	7f 06                	jg     8013f3 <sys_env_set_status+0x36>
+}
+  8013ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f1:	c9                   	leave
+  8013f2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013f3:	49 89 c0             	mov    %rax,%r8
+  8013f6:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013fb:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  801402:	00 00 00 
+  801405:	be 26 00 00 00       	mov    $0x26,%esi
+  80140a:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801411:	00 00 00 
+  801414:	b8 00 00 00 00       	mov    $0x0,%eax
+  801419:	49 b9 4d 2d 80 00 00 	movabs $0x802d4d,%r9
+  801420:	00 00 00 
+  801423:	41 ff d1             	call   *%r9
+
+0000000000801426 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801426:	55                   	push   %rbp
+  801427:	48 89 e5             	mov    %rsp,%rbp
+  80142a:	53                   	push   %rbx
+  80142b:	48 83 ec 08          	sub    $0x8,%rsp
+  80142f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801432:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801435:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80143a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801444:	be 00 00 00 00       	mov    $0x0,%esi
+  801449:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80144f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801451:	48 85 c0             	test   %rax,%rax
+  801454:	7f 06                	jg     80145c <sys_env_set_trapframe+0x36>
+}
+  801456:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80145a:	c9                   	leave
+  80145b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80145c:	49 89 c0             	mov    %rax,%r8
+  80145f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801464:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  80146b:	00 00 00 
+  80146e:	be 26 00 00 00       	mov    $0x26,%esi
+  801473:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  80147a:	00 00 00 
+  80147d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801482:	49 b9 4d 2d 80 00 00 	movabs $0x802d4d,%r9
+  801489:	00 00 00 
+  80148c:	41 ff d1             	call   *%r9
+
+000000000080148f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80148f:	55                   	push   %rbp
+  801490:	48 89 e5             	mov    %rsp,%rbp
+  801493:	53                   	push   %rbx
+  801494:	48 83 ec 08          	sub    $0x8,%rsp
+  801498:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80149b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80149e:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014ba:	48 85 c0             	test   %rax,%rax
+  8014bd:	7f 06                	jg     8014c5 <sys_env_set_pgfault_upcall+0x36>
+}
+  8014bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c3:	c9                   	leave
+  8014c4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c5:	49 89 c0             	mov    %rax,%r8
+  8014c8:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8014cd:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  8014d4:	00 00 00 
+  8014d7:	be 26 00 00 00       	mov    $0x26,%esi
+  8014dc:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  8014e3:	00 00 00 
+  8014e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014eb:	49 b9 4d 2d 80 00 00 	movabs $0x802d4d,%r9
+  8014f2:	00 00 00 
+  8014f5:	41 ff d1             	call   *%r9
+
+00000000008014f8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014f8:	55                   	push   %rbp
+  8014f9:	48 89 e5             	mov    %rsp,%rbp
+  8014fc:	53                   	push   %rbx
+  8014fd:	89 f8                	mov    %edi,%eax
+  8014ff:	49 89 f1             	mov    %rsi,%r9
+  801502:	48 89 d3             	mov    %rdx,%rbx
+  801505:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801508:	49 63 f0             	movslq %r8d,%rsi
+  80150b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80150e:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801513:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801516:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80151c:	cd 30                	int    $0x30
+}
+  80151e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801522:	c9                   	leave
+  801523:	c3                   	ret
+
+0000000000801524 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801524:	55                   	push   %rbp
+  801525:	48 89 e5             	mov    %rsp,%rbp
+  801528:	53                   	push   %rbx
+  801529:	48 83 ec 08          	sub    $0x8,%rsp
+  80152d:	48 89 fa             	mov    %rdi,%rdx
+  801530:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801533:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801538:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80153d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801542:	be 00 00 00 00       	mov    $0x0,%esi
+  801547:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80154d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80154f:	48 85 c0             	test   %rax,%rax
+  801552:	7f 06                	jg     80155a <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801554:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801558:	c9                   	leave
+  801559:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80155a:	49 89 c0             	mov    %rax,%r8
+  80155d:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801562:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  801569:	00 00 00 
+  80156c:	be 26 00 00 00       	mov    $0x26,%esi
+  801571:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801578:	00 00 00 
+  80157b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801580:	49 b9 4d 2d 80 00 00 	movabs $0x802d4d,%r9
+  801587:	00 00 00 
+  80158a:	41 ff d1             	call   *%r9
+
+000000000080158d <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80158d:	55                   	push   %rbp
+  80158e:	48 89 e5             	mov    %rsp,%rbp
+  801591:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801592:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801597:	ba 00 00 00 00       	mov    $0x0,%edx
+  80159c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b6:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015bc:	c9                   	leave
+  8015bd:	c3                   	ret
+
+00000000008015be <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8015be:	55                   	push   %rbp
+  8015bf:	48 89 e5             	mov    %rsp,%rbp
+  8015c2:	53                   	push   %rbx
+  8015c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8015c7:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8015ca:	48 63 ce             	movslq %esi,%rcx
+  8015cd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d0:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015da:	be 00 00 00 00       	mov    $0x0,%esi
+  8015df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015e5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015e7:	48 85 c0             	test   %rax,%rax
+  8015ea:	7f 06                	jg     8015f2 <sys_sigqueue+0x34>
+}
+  8015ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f0:	c9                   	leave
+  8015f1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f2:	49 89 c0             	mov    %rax,%r8
+  8015f5:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8015fa:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  801601:	00 00 00 
+  801604:	be 26 00 00 00       	mov    $0x26,%esi
+  801609:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801610:	00 00 00 
+  801613:	b8 00 00 00 00       	mov    $0x0,%eax
+  801618:	49 b9 4d 2d 80 00 00 	movabs $0x802d4d,%r9
+  80161f:	00 00 00 
+  801622:	41 ff d1             	call   *%r9
+
+0000000000801625 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801625:	55                   	push   %rbp
+  801626:	48 89 e5             	mov    %rsp,%rbp
+  801629:	53                   	push   %rbx
+  80162a:	48 83 ec 08          	sub    $0x8,%rsp
+  80162e:	48 89 fa             	mov    %rdi,%rdx
+  801631:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801634:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801639:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801643:	be 00 00 00 00       	mov    $0x0,%esi
+  801648:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80164e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801650:	48 85 c0             	test   %rax,%rax
+  801653:	7f 06                	jg     80165b <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801655:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801659:	c9                   	leave
+  80165a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80165b:	49 89 c0             	mov    %rax,%r8
+  80165e:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801663:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  80166a:	00 00 00 
+  80166d:	be 26 00 00 00       	mov    $0x26,%esi
+  801672:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801679:	00 00 00 
+  80167c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801681:	49 b9 4d 2d 80 00 00 	movabs $0x802d4d,%r9
+  801688:	00 00 00 
+  80168b:	41 ff d1             	call   *%r9
+
+000000000080168e <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80168e:	55                   	push   %rbp
+  80168f:	48 89 e5             	mov    %rsp,%rbp
+  801692:	53                   	push   %rbx
+  801693:	48 83 ec 08          	sub    $0x8,%rsp
+  801697:	48 89 f1             	mov    %rsi,%rcx
+  80169a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80169d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016a0:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016a5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8016af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016b5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016b7:	48 85 c0             	test   %rax,%rax
+  8016ba:	7f 06                	jg     8016c2 <sys_sigaction+0x34>
+}
+  8016bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016c0:	c9                   	leave
+  8016c1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016c2:	49 89 c0             	mov    %rax,%r8
+  8016c5:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8016ca:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  8016d1:	00 00 00 
+  8016d4:	be 26 00 00 00       	mov    $0x26,%esi
+  8016d9:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  8016e0:	00 00 00 
+  8016e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e8:	49 b9 4d 2d 80 00 00 	movabs $0x802d4d,%r9
+  8016ef:	00 00 00 
+  8016f2:	41 ff d1             	call   *%r9
+
+00000000008016f5 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8016f5:	55                   	push   %rbp
+  8016f6:	48 89 e5             	mov    %rsp,%rbp
+  8016f9:	53                   	push   %rbx
+  8016fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8016fe:	48 89 f1             	mov    %rsi,%rcx
+  801701:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801704:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801707:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80170c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801711:	be 00 00 00 00       	mov    $0x0,%esi
+  801716:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80171c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80171e:	48 85 c0             	test   %rax,%rax
+  801721:	7f 06                	jg     801729 <sys_sigprocmask+0x34>
+}
+  801723:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801727:	c9                   	leave
+  801728:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801729:	49 89 c0             	mov    %rax,%r8
+  80172c:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801731:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  801738:	00 00 00 
+  80173b:	be 26 00 00 00       	mov    $0x26,%esi
+  801740:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801747:	00 00 00 
+  80174a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80174f:	49 b9 4d 2d 80 00 00 	movabs $0x802d4d,%r9
+  801756:	00 00 00 
+  801759:	41 ff d1             	call   *%r9
+
+000000000080175c <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  80175c:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  80175f:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  801763:	83 3f 01             	cmpl   $0x1,(%rdi)
+  801766:	7e 0f                	jle    801777 <argstart+0x1b>
+  801768:	48 b8 89 2f 80 00 00 	movabs $0x802f89,%rax
+  80176f:	00 00 00 
+  801772:	48 85 f6             	test   %rsi,%rsi
+  801775:	75 05                	jne    80177c <argstart+0x20>
+  801777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177c:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  801780:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  801787:	00 
+}
+  801788:	c3                   	ret
+
+0000000000801789 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  801789:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  801790:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  801791:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801795:	48 85 c0             	test   %rax,%rax
+  801798:	0f 84 8f 00 00 00    	je     80182d <argnext+0xa4>
+argnext(struct Argstate *args) {
+  80179e:	55                   	push   %rbp
+  80179f:	48 89 e5             	mov    %rsp,%rbp
+  8017a2:	53                   	push   %rbx
+  8017a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8017a7:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  8017aa:	80 38 00             	cmpb   $0x0,(%rax)
+  8017ad:	75 52                	jne    801801 <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  8017af:	48 8b 17             	mov    (%rdi),%rdx
+  8017b2:	83 3a 01             	cmpl   $0x1,(%rdx)
+  8017b5:	74 67                	je     80181e <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  8017b7:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  8017bb:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  8017bf:	80 38 2d             	cmpb   $0x2d,(%rax)
+  8017c2:	75 5a                	jne    80181e <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  8017c4:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  8017c8:	74 54                	je     80181e <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  8017ca:	48 83 c0 01          	add    $0x1,%rax
+  8017ce:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  8017d2:	8b 12                	mov    (%rdx),%edx
+  8017d4:	83 ea 01             	sub    $0x1,%edx
+  8017d7:	48 63 d2             	movslq %edx,%rdx
+  8017da:	48 c1 e2 03          	shl    $0x3,%rdx
+  8017de:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  8017e2:	48 83 c7 08          	add    $0x8,%rdi
+  8017e6:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  8017ed:	00 00 00 
+  8017f0:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  8017f2:	48 8b 03             	mov    (%rbx),%rax
+  8017f5:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  8017f8:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8017fc:	80 38 2d             	cmpb   $0x2d,(%rax)
+  8017ff:	74 17                	je     801818 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  801801:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801805:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  801808:	48 83 c0 01          	add    $0x1,%rax
+  80180c:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  801810:	89 d0                	mov    %edx,%eax
+  801812:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801816:	c9                   	leave
+  801817:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  801818:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  80181c:	75 e3                	jne    801801 <argnext+0x78>
+    args->curarg = 0;
+  80181e:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801825:	00 
+    return -1;
+  801826:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80182b:	eb e3                	jmp    801810 <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  80182d:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  801832:	89 d0                	mov    %edx,%eax
+  801834:	c3                   	ret
+
+0000000000801835 <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  801835:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801839:	48 85 c0             	test   %rax,%rax
+  80183c:	74 7b                	je     8018b9 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  80183e:	55                   	push   %rbp
+  80183f:	48 89 e5             	mov    %rsp,%rbp
+  801842:	53                   	push   %rbx
+  801843:	48 83 ec 08          	sub    $0x8,%rsp
+  801847:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  80184a:	80 38 00             	cmpb   $0x0,(%rax)
+  80184d:	74 1c                	je     80186b <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  80184f:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  801853:	48 b8 89 2f 80 00 00 	movabs $0x802f89,%rax
+  80185a:	00 00 00 
+  80185d:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  801861:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  801865:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801869:	c9                   	leave
+  80186a:	c3                   	ret
+    } else if (*args->argc > 1) {
+  80186b:	48 8b 07             	mov    (%rdi),%rax
+  80186e:	83 38 01             	cmpl   $0x1,(%rax)
+  801871:	7f 12                	jg     801885 <argnextvalue+0x50>
+        args->argvalue = 0;
+  801873:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  80187a:	00 
+        args->curarg = 0;
+  80187b:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  801882:	00 
+  801883:	eb dc                	jmp    801861 <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  801885:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  801889:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80188d:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  801891:	8b 10                	mov    (%rax),%edx
+  801893:	83 ea 01             	sub    $0x1,%edx
+  801896:	48 63 d2             	movslq %edx,%rdx
+  801899:	48 c1 e2 03          	shl    $0x3,%rdx
+  80189d:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  8018a1:	48 83 c7 08          	add    $0x8,%rdi
+  8018a5:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  8018ac:	00 00 00 
+  8018af:	ff d0                	call   *%rax
+        (*args->argc)--;
+  8018b1:	48 8b 03             	mov    (%rbx),%rax
+  8018b4:	83 28 01             	subl   $0x1,(%rax)
+  8018b7:	eb a8                	jmp    801861 <argnextvalue+0x2c>
+}
+  8018b9:	c3                   	ret
+
+00000000008018ba <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  8018ba:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  8018be:	48 85 c0             	test   %rax,%rax
+  8018c1:	74 01                	je     8018c4 <argvalue+0xa>
+}
+  8018c3:	c3                   	ret
+argvalue(struct Argstate *args) {
+  8018c4:	55                   	push   %rbp
+  8018c5:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  8018c8:	48 b8 35 18 80 00 00 	movabs $0x801835,%rax
+  8018cf:	00 00 00 
+  8018d2:	ff d0                	call   *%rax
+}
+  8018d4:	5d                   	pop    %rbp
+  8018d5:	c3                   	ret
+
+00000000008018d6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018d6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018dd:	ff ff ff 
+  8018e0:	48 01 f8             	add    %rdi,%rax
+  8018e3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8018e7:	c3                   	ret
+
+00000000008018e8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018e8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018ef:	ff ff ff 
+  8018f2:	48 01 f8             	add    %rdi,%rax
+  8018f5:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8018f9:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8018ff:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801903:	c3                   	ret
+
+0000000000801904 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801904:	55                   	push   %rbp
+  801905:	48 89 e5             	mov    %rsp,%rbp
+  801908:	41 57                	push   %r15
+  80190a:	41 56                	push   %r14
+  80190c:	41 55                	push   %r13
+  80190e:	41 54                	push   %r12
+  801910:	53                   	push   %rbx
+  801911:	48 83 ec 08          	sub    $0x8,%rsp
+  801915:	49 89 ff             	mov    %rdi,%r15
+  801918:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80191d:	49 bd 26 2a 80 00 00 	movabs $0x802a26,%r13
+  801924:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801927:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80192d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801930:	48 89 df             	mov    %rbx,%rdi
+  801933:	41 ff d5             	call   *%r13
+  801936:	83 e0 04             	and    $0x4,%eax
+  801939:	74 17                	je     801952 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80193b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801942:	4c 39 f3             	cmp    %r14,%rbx
+  801945:	75 e6                	jne    80192d <fd_alloc+0x29>
+  801947:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80194d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801952:	4d 89 27             	mov    %r12,(%r15)
+}
+  801955:	48 83 c4 08          	add    $0x8,%rsp
+  801959:	5b                   	pop    %rbx
+  80195a:	41 5c                	pop    %r12
+  80195c:	41 5d                	pop    %r13
+  80195e:	41 5e                	pop    %r14
+  801960:	41 5f                	pop    %r15
+  801962:	5d                   	pop    %rbp
+  801963:	c3                   	ret
+
+0000000000801964 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801964:	83 ff 1f             	cmp    $0x1f,%edi
+  801967:	77 39                	ja     8019a2 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801969:	55                   	push   %rbp
+  80196a:	48 89 e5             	mov    %rsp,%rbp
+  80196d:	41 54                	push   %r12
+  80196f:	53                   	push   %rbx
+  801970:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801973:	48 63 df             	movslq %edi,%rbx
+  801976:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80197d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801981:	48 89 df             	mov    %rbx,%rdi
+  801984:	48 b8 26 2a 80 00 00 	movabs $0x802a26,%rax
+  80198b:	00 00 00 
+  80198e:	ff d0                	call   *%rax
+  801990:	a8 04                	test   $0x4,%al
+  801992:	74 14                	je     8019a8 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801994:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801998:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80199d:	5b                   	pop    %rbx
+  80199e:	41 5c                	pop    %r12
+  8019a0:	5d                   	pop    %rbp
+  8019a1:	c3                   	ret
+        return -E_INVAL;
+  8019a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8019a7:	c3                   	ret
+        return -E_INVAL;
+  8019a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019ad:	eb ee                	jmp    80199d <fd_lookup+0x39>
+
+00000000008019af <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8019af:	55                   	push   %rbp
+  8019b0:	48 89 e5             	mov    %rsp,%rbp
+  8019b3:	41 54                	push   %r12
+  8019b5:	53                   	push   %rbx
+  8019b6:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8019b9:	48 b8 c0 35 80 00 00 	movabs $0x8035c0,%rax
+  8019c0:	00 00 00 
+  8019c3:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8019ca:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8019cd:	39 3b                	cmp    %edi,(%rbx)
+  8019cf:	74 47                	je     801a18 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8019d1:	48 83 c0 08          	add    $0x8,%rax
+  8019d5:	48 8b 18             	mov    (%rax),%rbx
+  8019d8:	48 85 db             	test   %rbx,%rbx
+  8019db:	75 f0                	jne    8019cd <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019dd:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8019e4:	00 00 00 
+  8019e7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019ed:	89 fa                	mov    %edi,%edx
+  8019ef:	48 bf 40 35 80 00 00 	movabs $0x803540,%rdi
+  8019f6:	00 00 00 
+  8019f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fe:	48 b9 e5 02 80 00 00 	movabs $0x8002e5,%rcx
+  801a05:	00 00 00 
+  801a08:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a0f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a13:	5b                   	pop    %rbx
+  801a14:	41 5c                	pop    %r12
+  801a16:	5d                   	pop    %rbp
+  801a17:	c3                   	ret
+            return 0;
+  801a18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1d:	eb f0                	jmp    801a0f <dev_lookup+0x60>
+
+0000000000801a1f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a1f:	55                   	push   %rbp
+  801a20:	48 89 e5             	mov    %rsp,%rbp
+  801a23:	41 55                	push   %r13
+  801a25:	41 54                	push   %r12
+  801a27:	53                   	push   %rbx
+  801a28:	48 83 ec 18          	sub    $0x18,%rsp
+  801a2c:	48 89 fb             	mov    %rdi,%rbx
+  801a2f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a32:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a39:	ff ff ff 
+  801a3c:	48 01 df             	add    %rbx,%rdi
+  801a3f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a43:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a47:	48 b8 64 19 80 00 00 	movabs $0x801964,%rax
+  801a4e:	00 00 00 
+  801a51:	ff d0                	call   *%rax
+  801a53:	41 89 c5             	mov    %eax,%r13d
+  801a56:	85 c0                	test   %eax,%eax
+  801a58:	78 06                	js     801a60 <fd_close+0x41>
+  801a5a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a5e:	74 1a                	je     801a7a <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a60:	45 84 e4             	test   %r12b,%r12b
+  801a63:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a68:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a6c:	44 89 e8             	mov    %r13d,%eax
+  801a6f:	48 83 c4 18          	add    $0x18,%rsp
+  801a73:	5b                   	pop    %rbx
+  801a74:	41 5c                	pop    %r12
+  801a76:	41 5d                	pop    %r13
+  801a78:	5d                   	pop    %rbp
+  801a79:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a7a:	8b 3b                	mov    (%rbx),%edi
+  801a7c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a80:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  801a87:	00 00 00 
+  801a8a:	ff d0                	call   *%rax
+  801a8c:	41 89 c5             	mov    %eax,%r13d
+  801a8f:	85 c0                	test   %eax,%eax
+  801a91:	78 1b                	js     801aae <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a93:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a97:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801a9b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801aa1:	48 85 c0             	test   %rax,%rax
+  801aa4:	74 08                	je     801aae <fd_close+0x8f>
+  801aa6:	48 89 df             	mov    %rbx,%rdi
+  801aa9:	ff d0                	call   *%rax
+  801aab:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801aae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ab3:	48 89 de             	mov    %rbx,%rsi
+  801ab6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801abb:	48 b8 86 12 80 00 00 	movabs $0x801286,%rax
+  801ac2:	00 00 00 
+  801ac5:	ff d0                	call   *%rax
+    return res;
+  801ac7:	eb a3                	jmp    801a6c <fd_close+0x4d>
+
+0000000000801ac9 <close>:
+
+int
+close(int fdnum) {
+  801ac9:	55                   	push   %rbp
+  801aca:	48 89 e5             	mov    %rsp,%rbp
+  801acd:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801ad1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ad5:	48 b8 64 19 80 00 00 	movabs $0x801964,%rax
+  801adc:	00 00 00 
+  801adf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ae1:	85 c0                	test   %eax,%eax
+  801ae3:	78 15                	js     801afa <close+0x31>
+
+    return fd_close(fd, 1);
+  801ae5:	be 01 00 00 00       	mov    $0x1,%esi
+  801aea:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801aee:	48 b8 1f 1a 80 00 00 	movabs $0x801a1f,%rax
+  801af5:	00 00 00 
+  801af8:	ff d0                	call   *%rax
+}
+  801afa:	c9                   	leave
+  801afb:	c3                   	ret
+
+0000000000801afc <close_all>:
+
+void
+close_all(void) {
+  801afc:	55                   	push   %rbp
+  801afd:	48 89 e5             	mov    %rsp,%rbp
+  801b00:	41 54                	push   %r12
+  801b02:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b08:	49 bc c9 1a 80 00 00 	movabs $0x801ac9,%r12
+  801b0f:	00 00 00 
+  801b12:	89 df                	mov    %ebx,%edi
+  801b14:	41 ff d4             	call   *%r12
+  801b17:	83 c3 01             	add    $0x1,%ebx
+  801b1a:	83 fb 20             	cmp    $0x20,%ebx
+  801b1d:	75 f3                	jne    801b12 <close_all+0x16>
+}
+  801b1f:	5b                   	pop    %rbx
+  801b20:	41 5c                	pop    %r12
+  801b22:	5d                   	pop    %rbp
+  801b23:	c3                   	ret
+
+0000000000801b24 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b24:	55                   	push   %rbp
+  801b25:	48 89 e5             	mov    %rsp,%rbp
+  801b28:	41 57                	push   %r15
+  801b2a:	41 56                	push   %r14
+  801b2c:	41 55                	push   %r13
+  801b2e:	41 54                	push   %r12
+  801b30:	53                   	push   %rbx
+  801b31:	48 83 ec 18          	sub    $0x18,%rsp
+  801b35:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b38:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b3c:	48 b8 64 19 80 00 00 	movabs $0x801964,%rax
+  801b43:	00 00 00 
+  801b46:	ff d0                	call   *%rax
+  801b48:	89 c3                	mov    %eax,%ebx
+  801b4a:	85 c0                	test   %eax,%eax
+  801b4c:	0f 88 b8 00 00 00    	js     801c0a <dup+0xe6>
+    close(newfdnum);
+  801b52:	44 89 e7             	mov    %r12d,%edi
+  801b55:	48 b8 c9 1a 80 00 00 	movabs $0x801ac9,%rax
+  801b5c:	00 00 00 
+  801b5f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b61:	4d 63 ec             	movslq %r12d,%r13
+  801b64:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801b6b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801b6f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b73:	4c 89 ff             	mov    %r15,%rdi
+  801b76:	49 be e8 18 80 00 00 	movabs $0x8018e8,%r14
+  801b7d:	00 00 00 
+  801b80:	41 ff d6             	call   *%r14
+  801b83:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b86:	4c 89 ef             	mov    %r13,%rdi
+  801b89:	41 ff d6             	call   *%r14
+  801b8c:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b8f:	48 89 df             	mov    %rbx,%rdi
+  801b92:	48 b8 26 2a 80 00 00 	movabs $0x802a26,%rax
+  801b99:	00 00 00 
+  801b9c:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801b9e:	a8 04                	test   $0x4,%al
+  801ba0:	74 2b                	je     801bcd <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ba2:	41 89 c1             	mov    %eax,%r9d
+  801ba5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bab:	4c 89 f1             	mov    %r14,%rcx
+  801bae:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb3:	48 89 de             	mov    %rbx,%rsi
+  801bb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bbb:	48 b8 21 12 80 00 00 	movabs $0x801221,%rax
+  801bc2:	00 00 00 
+  801bc5:	ff d0                	call   *%rax
+  801bc7:	89 c3                	mov    %eax,%ebx
+  801bc9:	85 c0                	test   %eax,%eax
+  801bcb:	78 4e                	js     801c1b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801bcd:	4c 89 ff             	mov    %r15,%rdi
+  801bd0:	48 b8 26 2a 80 00 00 	movabs $0x802a26,%rax
+  801bd7:	00 00 00 
+  801bda:	ff d0                	call   *%rax
+  801bdc:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801bdf:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801be5:	4c 89 e9             	mov    %r13,%rcx
+  801be8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bed:	4c 89 fe             	mov    %r15,%rsi
+  801bf0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bf5:	48 b8 21 12 80 00 00 	movabs $0x801221,%rax
+  801bfc:	00 00 00 
+  801bff:	ff d0                	call   *%rax
+  801c01:	89 c3                	mov    %eax,%ebx
+  801c03:	85 c0                	test   %eax,%eax
+  801c05:	78 14                	js     801c1b <dup+0xf7>
+
+    return newfdnum;
+  801c07:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c0a:	89 d8                	mov    %ebx,%eax
+  801c0c:	48 83 c4 18          	add    $0x18,%rsp
+  801c10:	5b                   	pop    %rbx
+  801c11:	41 5c                	pop    %r12
+  801c13:	41 5d                	pop    %r13
+  801c15:	41 5e                	pop    %r14
+  801c17:	41 5f                	pop    %r15
+  801c19:	5d                   	pop    %rbp
+  801c1a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c1b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c20:	4c 89 ee             	mov    %r13,%rsi
+  801c23:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c28:	49 bc 86 12 80 00 00 	movabs $0x801286,%r12
+  801c2f:	00 00 00 
+  801c32:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c35:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c3a:	4c 89 f6             	mov    %r14,%rsi
+  801c3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c42:	41 ff d4             	call   *%r12
+    return res;
+  801c45:	eb c3                	jmp    801c0a <dup+0xe6>
+
+0000000000801c47 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c47:	55                   	push   %rbp
+  801c48:	48 89 e5             	mov    %rsp,%rbp
+  801c4b:	41 56                	push   %r14
+  801c4d:	41 55                	push   %r13
+  801c4f:	41 54                	push   %r12
+  801c51:	53                   	push   %rbx
+  801c52:	48 83 ec 10          	sub    $0x10,%rsp
+  801c56:	89 fb                	mov    %edi,%ebx
+  801c58:	49 89 f4             	mov    %rsi,%r12
+  801c5b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c5e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c62:	48 b8 64 19 80 00 00 	movabs $0x801964,%rax
+  801c69:	00 00 00 
+  801c6c:	ff d0                	call   *%rax
+  801c6e:	85 c0                	test   %eax,%eax
+  801c70:	78 4c                	js     801cbe <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c72:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c76:	41 8b 3e             	mov    (%r14),%edi
+  801c79:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c7d:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  801c84:	00 00 00 
+  801c87:	ff d0                	call   *%rax
+  801c89:	85 c0                	test   %eax,%eax
+  801c8b:	78 35                	js     801cc2 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c8d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c91:	83 e0 03             	and    $0x3,%eax
+  801c94:	83 f8 01             	cmp    $0x1,%eax
+  801c97:	74 2d                	je     801cc6 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c99:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c9d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ca1:	48 85 c0             	test   %rax,%rax
+  801ca4:	74 56                	je     801cfc <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ca6:	4c 89 ea             	mov    %r13,%rdx
+  801ca9:	4c 89 e6             	mov    %r12,%rsi
+  801cac:	4c 89 f7             	mov    %r14,%rdi
+  801caf:	ff d0                	call   *%rax
+}
+  801cb1:	48 83 c4 10          	add    $0x10,%rsp
+  801cb5:	5b                   	pop    %rbx
+  801cb6:	41 5c                	pop    %r12
+  801cb8:	41 5d                	pop    %r13
+  801cba:	41 5e                	pop    %r14
+  801cbc:	5d                   	pop    %rbp
+  801cbd:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cbe:	48 98                	cltq
+  801cc0:	eb ef                	jmp    801cb1 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cc2:	48 98                	cltq
+  801cc4:	eb eb                	jmp    801cb1 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cc6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ccd:	00 00 00 
+  801cd0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cd6:	89 da                	mov    %ebx,%edx
+  801cd8:	48 bf 81 35 80 00 00 	movabs $0x803581,%rdi
+  801cdf:	00 00 00 
+  801ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce7:	48 b9 e5 02 80 00 00 	movabs $0x8002e5,%rcx
+  801cee:	00 00 00 
+  801cf1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cf3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801cfa:	eb b5                	jmp    801cb1 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801cfc:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d03:	eb ac                	jmp    801cb1 <read+0x6a>
+
+0000000000801d05 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d05:	55                   	push   %rbp
+  801d06:	48 89 e5             	mov    %rsp,%rbp
+  801d09:	41 57                	push   %r15
+  801d0b:	41 56                	push   %r14
+  801d0d:	41 55                	push   %r13
+  801d0f:	41 54                	push   %r12
+  801d11:	53                   	push   %rbx
+  801d12:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d16:	48 85 d2             	test   %rdx,%rdx
+  801d19:	74 54                	je     801d6f <readn+0x6a>
+  801d1b:	41 89 fd             	mov    %edi,%r13d
+  801d1e:	49 89 f6             	mov    %rsi,%r14
+  801d21:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d24:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d29:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d2e:	49 bf 47 1c 80 00 00 	movabs $0x801c47,%r15
+  801d35:	00 00 00 
+  801d38:	4c 89 e2             	mov    %r12,%rdx
+  801d3b:	48 29 f2             	sub    %rsi,%rdx
+  801d3e:	4c 01 f6             	add    %r14,%rsi
+  801d41:	44 89 ef             	mov    %r13d,%edi
+  801d44:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	78 20                	js     801d6b <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d4b:	01 c3                	add    %eax,%ebx
+  801d4d:	85 c0                	test   %eax,%eax
+  801d4f:	74 08                	je     801d59 <readn+0x54>
+  801d51:	48 63 f3             	movslq %ebx,%rsi
+  801d54:	4c 39 e6             	cmp    %r12,%rsi
+  801d57:	72 df                	jb     801d38 <readn+0x33>
+    }
+    return res;
+  801d59:	48 63 c3             	movslq %ebx,%rax
+}
+  801d5c:	48 83 c4 08          	add    $0x8,%rsp
+  801d60:	5b                   	pop    %rbx
+  801d61:	41 5c                	pop    %r12
+  801d63:	41 5d                	pop    %r13
+  801d65:	41 5e                	pop    %r14
+  801d67:	41 5f                	pop    %r15
+  801d69:	5d                   	pop    %rbp
+  801d6a:	c3                   	ret
+        if (inc < 0) return inc;
+  801d6b:	48 98                	cltq
+  801d6d:	eb ed                	jmp    801d5c <readn+0x57>
+    int inc = 1, res = 0;
+  801d6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d74:	eb e3                	jmp    801d59 <readn+0x54>
+
+0000000000801d76 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d76:	55                   	push   %rbp
+  801d77:	48 89 e5             	mov    %rsp,%rbp
+  801d7a:	41 56                	push   %r14
+  801d7c:	41 55                	push   %r13
+  801d7e:	41 54                	push   %r12
+  801d80:	53                   	push   %rbx
+  801d81:	48 83 ec 10          	sub    $0x10,%rsp
+  801d85:	89 fb                	mov    %edi,%ebx
+  801d87:	49 89 f4             	mov    %rsi,%r12
+  801d8a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d8d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d91:	48 b8 64 19 80 00 00 	movabs $0x801964,%rax
+  801d98:	00 00 00 
+  801d9b:	ff d0                	call   *%rax
+  801d9d:	85 c0                	test   %eax,%eax
+  801d9f:	78 47                	js     801de8 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801da1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801da5:	41 8b 3e             	mov    (%r14),%edi
+  801da8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dac:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  801db3:	00 00 00 
+  801db6:	ff d0                	call   *%rax
+  801db8:	85 c0                	test   %eax,%eax
+  801dba:	78 30                	js     801dec <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dbc:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801dc1:	74 2d                	je     801df0 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dc3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dc7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801dcb:	48 85 c0             	test   %rax,%rax
+  801dce:	74 56                	je     801e26 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801dd0:	4c 89 ea             	mov    %r13,%rdx
+  801dd3:	4c 89 e6             	mov    %r12,%rsi
+  801dd6:	4c 89 f7             	mov    %r14,%rdi
+  801dd9:	ff d0                	call   *%rax
+}
+  801ddb:	48 83 c4 10          	add    $0x10,%rsp
+  801ddf:	5b                   	pop    %rbx
+  801de0:	41 5c                	pop    %r12
+  801de2:	41 5d                	pop    %r13
+  801de4:	41 5e                	pop    %r14
+  801de6:	5d                   	pop    %rbp
+  801de7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801de8:	48 98                	cltq
+  801dea:	eb ef                	jmp    801ddb <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dec:	48 98                	cltq
+  801dee:	eb eb                	jmp    801ddb <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801df0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801df7:	00 00 00 
+  801dfa:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e00:	89 da                	mov    %ebx,%edx
+  801e02:	48 bf 9d 35 80 00 00 	movabs $0x80359d,%rdi
+  801e09:	00 00 00 
+  801e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e11:	48 b9 e5 02 80 00 00 	movabs $0x8002e5,%rcx
+  801e18:	00 00 00 
+  801e1b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e1d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e24:	eb b5                	jmp    801ddb <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e26:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e2d:	eb ac                	jmp    801ddb <write+0x65>
+
+0000000000801e2f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e2f:	55                   	push   %rbp
+  801e30:	48 89 e5             	mov    %rsp,%rbp
+  801e33:	53                   	push   %rbx
+  801e34:	48 83 ec 18          	sub    $0x18,%rsp
+  801e38:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e3a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e3e:	48 b8 64 19 80 00 00 	movabs $0x801964,%rax
+  801e45:	00 00 00 
+  801e48:	ff d0                	call   *%rax
+  801e4a:	85 c0                	test   %eax,%eax
+  801e4c:	78 0c                	js     801e5a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801e4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e52:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801e55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e5a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e5e:	c9                   	leave
+  801e5f:	c3                   	ret
+
+0000000000801e60 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e60:	55                   	push   %rbp
+  801e61:	48 89 e5             	mov    %rsp,%rbp
+  801e64:	41 55                	push   %r13
+  801e66:	41 54                	push   %r12
+  801e68:	53                   	push   %rbx
+  801e69:	48 83 ec 18          	sub    $0x18,%rsp
+  801e6d:	89 fb                	mov    %edi,%ebx
+  801e6f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e72:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e76:	48 b8 64 19 80 00 00 	movabs $0x801964,%rax
+  801e7d:	00 00 00 
+  801e80:	ff d0                	call   *%rax
+  801e82:	85 c0                	test   %eax,%eax
+  801e84:	78 38                	js     801ebe <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e86:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e8a:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e8e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e92:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  801e99:	00 00 00 
+  801e9c:	ff d0                	call   *%rax
+  801e9e:	85 c0                	test   %eax,%eax
+  801ea0:	78 1c                	js     801ebe <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ea2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801ea7:	74 20                	je     801ec9 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ea9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ead:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801eb1:	48 85 c0             	test   %rax,%rax
+  801eb4:	74 47                	je     801efd <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801eb6:	44 89 e6             	mov    %r12d,%esi
+  801eb9:	4c 89 ef             	mov    %r13,%rdi
+  801ebc:	ff d0                	call   *%rax
+}
+  801ebe:	48 83 c4 18          	add    $0x18,%rsp
+  801ec2:	5b                   	pop    %rbx
+  801ec3:	41 5c                	pop    %r12
+  801ec5:	41 5d                	pop    %r13
+  801ec7:	5d                   	pop    %rbp
+  801ec8:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ec9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ed0:	00 00 00 
+  801ed3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ed9:	89 da                	mov    %ebx,%edx
+  801edb:	48 bf 60 35 80 00 00 	movabs $0x803560,%rdi
+  801ee2:	00 00 00 
+  801ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eea:	48 b9 e5 02 80 00 00 	movabs $0x8002e5,%rcx
+  801ef1:	00 00 00 
+  801ef4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ef6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801efb:	eb c1                	jmp    801ebe <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801efd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f02:	eb ba                	jmp    801ebe <ftruncate+0x5e>
+
+0000000000801f04 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f04:	55                   	push   %rbp
+  801f05:	48 89 e5             	mov    %rsp,%rbp
+  801f08:	41 54                	push   %r12
+  801f0a:	53                   	push   %rbx
+  801f0b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f0f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f12:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f16:	48 b8 64 19 80 00 00 	movabs $0x801964,%rax
+  801f1d:	00 00 00 
+  801f20:	ff d0                	call   *%rax
+  801f22:	85 c0                	test   %eax,%eax
+  801f24:	78 4e                	js     801f74 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f26:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f2a:	41 8b 3c 24          	mov    (%r12),%edi
+  801f2e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f32:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  801f39:	00 00 00 
+  801f3c:	ff d0                	call   *%rax
+  801f3e:	85 c0                	test   %eax,%eax
+  801f40:	78 32                	js     801f74 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f42:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f46:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f4b:	74 30                	je     801f7d <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f4d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f50:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f57:	00 00 00 
+    stat->st_isdir = 0;
+  801f5a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f61:	00 00 00 
+    stat->st_dev = dev;
+  801f64:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f6b:	48 89 de             	mov    %rbx,%rsi
+  801f6e:	4c 89 e7             	mov    %r12,%rdi
+  801f71:	ff 50 28             	call   *0x28(%rax)
+}
+  801f74:	48 83 c4 10          	add    $0x10,%rsp
+  801f78:	5b                   	pop    %rbx
+  801f79:	41 5c                	pop    %r12
+  801f7b:	5d                   	pop    %rbp
+  801f7c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f7d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f82:	eb f0                	jmp    801f74 <fstat+0x70>
+
+0000000000801f84 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f84:	55                   	push   %rbp
+  801f85:	48 89 e5             	mov    %rsp,%rbp
+  801f88:	41 54                	push   %r12
+  801f8a:	53                   	push   %rbx
+  801f8b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f8e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f93:	48 b8 05 22 80 00 00 	movabs $0x802205,%rax
+  801f9a:	00 00 00 
+  801f9d:	ff d0                	call   *%rax
+  801f9f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801fa1:	85 c0                	test   %eax,%eax
+  801fa3:	78 25                	js     801fca <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801fa5:	4c 89 e6             	mov    %r12,%rsi
+  801fa8:	89 c7                	mov    %eax,%edi
+  801faa:	48 b8 04 1f 80 00 00 	movabs $0x801f04,%rax
+  801fb1:	00 00 00 
+  801fb4:	ff d0                	call   *%rax
+  801fb6:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801fb9:	89 df                	mov    %ebx,%edi
+  801fbb:	48 b8 c9 1a 80 00 00 	movabs $0x801ac9,%rax
+  801fc2:	00 00 00 
+  801fc5:	ff d0                	call   *%rax
+
+    return res;
+  801fc7:	44 89 e3             	mov    %r12d,%ebx
+}
+  801fca:	89 d8                	mov    %ebx,%eax
+  801fcc:	5b                   	pop    %rbx
+  801fcd:	41 5c                	pop    %r12
+  801fcf:	5d                   	pop    %rbp
+  801fd0:	c3                   	ret
+
+0000000000801fd1 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801fd1:	55                   	push   %rbp
+  801fd2:	48 89 e5             	mov    %rsp,%rbp
+  801fd5:	41 54                	push   %r12
+  801fd7:	53                   	push   %rbx
+  801fd8:	48 83 ec 10          	sub    $0x10,%rsp
+  801fdc:	41 89 fc             	mov    %edi,%r12d
+  801fdf:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fe2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801fe9:	00 00 00 
+  801fec:	83 38 00             	cmpl   $0x0,(%rax)
+  801fef:	74 5e                	je     80204f <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801ff1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801ff7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801ffc:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802003:	00 00 00 
+  802006:	44 89 e6             	mov    %r12d,%esi
+  802009:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802010:	00 00 00 
+  802013:	8b 38                	mov    (%rax),%edi
+  802015:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  80201c:	00 00 00 
+  80201f:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802021:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802028:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802029:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80202e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802032:	48 89 de             	mov    %rbx,%rsi
+  802035:	bf 00 00 00 00       	mov    $0x0,%edi
+  80203a:	48 b8 f0 2d 80 00 00 	movabs $0x802df0,%rax
+  802041:	00 00 00 
+  802044:	ff d0                	call   *%rax
+}
+  802046:	48 83 c4 10          	add    $0x10,%rsp
+  80204a:	5b                   	pop    %rbx
+  80204b:	41 5c                	pop    %r12
+  80204d:	5d                   	pop    %rbp
+  80204e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80204f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802054:	48 b8 25 2f 80 00 00 	movabs $0x802f25,%rax
+  80205b:	00 00 00 
+  80205e:	ff d0                	call   *%rax
+  802060:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802067:	00 00 
+  802069:	eb 86                	jmp    801ff1 <fsipc+0x20>
+
+000000000080206b <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80206b:	55                   	push   %rbp
+  80206c:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80206f:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802076:	00 00 00 
+  802079:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80207c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80207e:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802081:	be 00 00 00 00       	mov    $0x0,%esi
+  802086:	bf 02 00 00 00       	mov    $0x2,%edi
+  80208b:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  802092:	00 00 00 
+  802095:	ff d0                	call   *%rax
+}
+  802097:	5d                   	pop    %rbp
+  802098:	c3                   	ret
+
+0000000000802099 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802099:	55                   	push   %rbp
+  80209a:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80209d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8020a0:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8020a7:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8020a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ae:	bf 06 00 00 00       	mov    $0x6,%edi
+  8020b3:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  8020ba:	00 00 00 
+  8020bd:	ff d0                	call   *%rax
+}
+  8020bf:	5d                   	pop    %rbp
+  8020c0:	c3                   	ret
+
+00000000008020c1 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8020c1:	55                   	push   %rbp
+  8020c2:	48 89 e5             	mov    %rsp,%rbp
+  8020c5:	41 54                	push   %r12
+  8020c7:	53                   	push   %rbx
+  8020c8:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8020cb:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8020ce:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8020d5:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8020d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8020dc:	bf 05 00 00 00       	mov    $0x5,%edi
+  8020e1:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  8020e8:	00 00 00 
+  8020eb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020ed:	85 c0                	test   %eax,%eax
+  8020ef:	78 3d                	js     80212e <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8020f1:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8020f8:	00 00 00 
+  8020fb:	4c 89 e6             	mov    %r12,%rsi
+  8020fe:	48 89 df             	mov    %rbx,%rdi
+  802101:	48 b8 0a 0c 80 00 00 	movabs $0x800c0a,%rax
+  802108:	00 00 00 
+  80210b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80210d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802114:	00 
+  802115:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80211b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802122:	00 
+  802123:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802129:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80212e:	5b                   	pop    %rbx
+  80212f:	41 5c                	pop    %r12
+  802131:	5d                   	pop    %rbp
+  802132:	c3                   	ret
+
+0000000000802133 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802133:	55                   	push   %rbp
+  802134:	48 89 e5             	mov    %rsp,%rbp
+  802137:	41 54                	push   %r12
+  802139:	53                   	push   %rbx
+  80213a:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  80213d:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802142:	48 39 c2             	cmp    %rax,%rdx
+  802145:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802149:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80214c:	48 89 c2             	mov    %rax,%rdx
+  80214f:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802156:	00 00 00 
+  802159:	48 b8 6b 0e 80 00 00 	movabs $0x800e6b,%rax
+  802160:	00 00 00 
+  802163:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802165:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80216c:	00 00 00 
+  80216f:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802174:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802176:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  80217a:	be 00 00 00 00       	mov    $0x0,%esi
+  80217f:	bf 04 00 00 00       	mov    $0x4,%edi
+  802184:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  80218b:	00 00 00 
+  80218e:	ff d0                	call   *%rax
+  802190:	48 98                	cltq
+}
+  802192:	5b                   	pop    %rbx
+  802193:	41 5c                	pop    %r12
+  802195:	5d                   	pop    %rbp
+  802196:	c3                   	ret
+
+0000000000802197 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802197:	55                   	push   %rbp
+  802198:	48 89 e5             	mov    %rsp,%rbp
+  80219b:	41 54                	push   %r12
+  80219d:	53                   	push   %rbx
+  80219e:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8021a1:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8021a8:	00 00 00 
+  8021ab:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8021ae:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8021b0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021b5:	48 39 ca             	cmp    %rcx,%rdx
+  8021b8:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8021bc:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8021c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021ca:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  8021d1:	00 00 00 
+  8021d4:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  8021d6:	85 c0                	test   %eax,%eax
+  8021d8:	78 27                	js     802201 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  8021da:	48 63 d8             	movslq %eax,%rbx
+  8021dd:	48 89 da             	mov    %rbx,%rdx
+  8021e0:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8021e7:	00 00 00 
+  8021ea:	4c 89 e7             	mov    %r12,%rdi
+  8021ed:	48 b8 6b 0e 80 00 00 	movabs $0x800e6b,%rax
+  8021f4:	00 00 00 
+  8021f7:	ff d0                	call   *%rax
+    return bytes_read;
+  8021f9:	48 89 d8             	mov    %rbx,%rax
+}
+  8021fc:	5b                   	pop    %rbx
+  8021fd:	41 5c                	pop    %r12
+  8021ff:	5d                   	pop    %rbp
+  802200:	c3                   	ret
+        return bytes_read;
+  802201:	48 98                	cltq
+  802203:	eb f7                	jmp    8021fc <devfile_read+0x65>
+
+0000000000802205 <open>:
+open(const char *path, int mode) {
+  802205:	55                   	push   %rbp
+  802206:	48 89 e5             	mov    %rsp,%rbp
+  802209:	41 55                	push   %r13
+  80220b:	41 54                	push   %r12
+  80220d:	53                   	push   %rbx
+  80220e:	48 83 ec 18          	sub    $0x18,%rsp
+  802212:	49 89 fc             	mov    %rdi,%r12
+  802215:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802218:	48 b8 cc 0b 80 00 00 	movabs $0x800bcc,%rax
+  80221f:	00 00 00 
+  802222:	ff d0                	call   *%rax
+  802224:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80222a:	0f 87 8a 00 00 00    	ja     8022ba <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802230:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802234:	48 b8 04 19 80 00 00 	movabs $0x801904,%rax
+  80223b:	00 00 00 
+  80223e:	ff d0                	call   *%rax
+  802240:	89 c3                	mov    %eax,%ebx
+  802242:	85 c0                	test   %eax,%eax
+  802244:	78 50                	js     802296 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802246:	4c 89 e6             	mov    %r12,%rsi
+  802249:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802250:	00 00 00 
+  802253:	48 89 df             	mov    %rbx,%rdi
+  802256:	48 b8 0a 0c 80 00 00 	movabs $0x800c0a,%rax
+  80225d:	00 00 00 
+  802260:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802262:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802269:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80226d:	bf 01 00 00 00       	mov    $0x1,%edi
+  802272:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  802279:	00 00 00 
+  80227c:	ff d0                	call   *%rax
+  80227e:	89 c3                	mov    %eax,%ebx
+  802280:	85 c0                	test   %eax,%eax
+  802282:	78 1f                	js     8022a3 <open+0x9e>
+    return fd2num(fd);
+  802284:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802288:	48 b8 d6 18 80 00 00 	movabs $0x8018d6,%rax
+  80228f:	00 00 00 
+  802292:	ff d0                	call   *%rax
+  802294:	89 c3                	mov    %eax,%ebx
+}
+  802296:	89 d8                	mov    %ebx,%eax
+  802298:	48 83 c4 18          	add    $0x18,%rsp
+  80229c:	5b                   	pop    %rbx
+  80229d:	41 5c                	pop    %r12
+  80229f:	41 5d                	pop    %r13
+  8022a1:	5d                   	pop    %rbp
+  8022a2:	c3                   	ret
+        fd_close(fd, 0);
+  8022a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022ac:	48 b8 1f 1a 80 00 00 	movabs $0x801a1f,%rax
+  8022b3:	00 00 00 
+  8022b6:	ff d0                	call   *%rax
+        return res;
+  8022b8:	eb dc                	jmp    802296 <open+0x91>
+        return -E_BAD_PATH;
+  8022ba:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8022bf:	eb d5                	jmp    802296 <open+0x91>
+
+00000000008022c1 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8022c1:	55                   	push   %rbp
+  8022c2:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8022c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ca:	bf 08 00 00 00       	mov    $0x8,%edi
+  8022cf:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  8022d6:	00 00 00 
+  8022d9:	ff d0                	call   *%rax
+}
+  8022db:	5d                   	pop    %rbp
+  8022dc:	c3                   	ret
+
+00000000008022dd <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8022dd:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8022e1:	7f 01                	jg     8022e4 <writebuf+0x7>
+  8022e3:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8022e4:	55                   	push   %rbp
+  8022e5:	48 89 e5             	mov    %rsp,%rbp
+  8022e8:	53                   	push   %rbx
+  8022e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8022ed:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8022f0:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8022f4:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8022f8:	8b 3f                	mov    (%rdi),%edi
+  8022fa:	48 b8 76 1d 80 00 00 	movabs $0x801d76,%rax
+  802301:	00 00 00 
+  802304:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  802306:	48 85 c0             	test   %rax,%rax
+  802309:	7e 04                	jle    80230f <writebuf+0x32>
+  80230b:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  80230f:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  802313:	48 39 c2             	cmp    %rax,%rdx
+  802316:	74 0f                	je     802327 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  802318:	48 85 c0             	test   %rax,%rax
+  80231b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802320:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802324:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  802327:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80232b:	c9                   	leave
+  80232c:	c3                   	ret
+
+000000000080232d <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  80232d:	8b 46 04             	mov    0x4(%rsi),%eax
+  802330:	8d 50 01             	lea    0x1(%rax),%edx
+  802333:	89 56 04             	mov    %edx,0x4(%rsi)
+  802336:	48 98                	cltq
+  802338:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  80233d:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  802343:	74 01                	je     802346 <putch+0x19>
+  802345:	c3                   	ret
+putch(int ch, void *arg) {
+  802346:	55                   	push   %rbp
+  802347:	48 89 e5             	mov    %rsp,%rbp
+  80234a:	53                   	push   %rbx
+  80234b:	48 83 ec 08          	sub    $0x8,%rsp
+  80234f:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  802352:	48 89 f7             	mov    %rsi,%rdi
+  802355:	48 b8 dd 22 80 00 00 	movabs $0x8022dd,%rax
+  80235c:	00 00 00 
+  80235f:	ff d0                	call   *%rax
+        state->offset = 0;
+  802361:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  802368:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80236c:	c9                   	leave
+  80236d:	c3                   	ret
+
+000000000080236e <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  80236e:	55                   	push   %rbp
+  80236f:	48 89 e5             	mov    %rsp,%rbp
+  802372:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  802379:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  80237c:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  802382:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  802389:	00 00 00 
+    state.result = 0;
+  80238c:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  802393:	00 00 00 00 
+    state.error = 1;
+  802397:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  80239e:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8023a1:	48 89 f2             	mov    %rsi,%rdx
+  8023a4:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8023ab:	48 bf 2d 23 80 00 00 	movabs $0x80232d,%rdi
+  8023b2:	00 00 00 
+  8023b5:	48 b8 35 04 80 00 00 	movabs $0x800435,%rax
+  8023bc:	00 00 00 
+  8023bf:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8023c1:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8023c8:	7f 14                	jg     8023de <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8023ca:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8023d1:	48 85 c0             	test   %rax,%rax
+  8023d4:	75 06                	jne    8023dc <vfprintf+0x6e>
+  8023d6:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8023dc:	c9                   	leave
+  8023dd:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8023de:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8023e5:	48 b8 dd 22 80 00 00 	movabs $0x8022dd,%rax
+  8023ec:	00 00 00 
+  8023ef:	ff d0                	call   *%rax
+  8023f1:	eb d7                	jmp    8023ca <vfprintf+0x5c>
+
+00000000008023f3 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8023f3:	55                   	push   %rbp
+  8023f4:	48 89 e5             	mov    %rsp,%rbp
+  8023f7:	48 83 ec 50          	sub    $0x50,%rsp
+  8023fb:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8023ff:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802403:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802407:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80240b:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802412:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802416:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80241a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80241e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  802422:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  802426:	48 b8 6e 23 80 00 00 	movabs $0x80236e,%rax
+  80242d:	00 00 00 
+  802430:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  802432:	c9                   	leave
+  802433:	c3                   	ret
+
+0000000000802434 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  802434:	55                   	push   %rbp
+  802435:	48 89 e5             	mov    %rsp,%rbp
+  802438:	48 83 ec 50          	sub    $0x50,%rsp
+  80243c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802440:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802444:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802448:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80244c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  802450:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802457:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80245b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80245f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802463:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  802467:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80246b:	48 89 fe             	mov    %rdi,%rsi
+  80246e:	bf 01 00 00 00       	mov    $0x1,%edi
+  802473:	48 b8 6e 23 80 00 00 	movabs $0x80236e,%rax
+  80247a:	00 00 00 
+  80247d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80247f:	c9                   	leave
+  802480:	c3                   	ret
+
+0000000000802481 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802481:	55                   	push   %rbp
+  802482:	48 89 e5             	mov    %rsp,%rbp
+  802485:	41 54                	push   %r12
+  802487:	53                   	push   %rbx
+  802488:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80248b:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  802492:	00 00 00 
+  802495:	ff d0                	call   *%rax
+  802497:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80249a:	48 be e0 35 80 00 00 	movabs $0x8035e0,%rsi
+  8024a1:	00 00 00 
+  8024a4:	48 89 df             	mov    %rbx,%rdi
+  8024a7:	48 b8 0a 0c 80 00 00 	movabs $0x800c0a,%rax
+  8024ae:	00 00 00 
+  8024b1:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8024b3:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8024b8:	41 2b 04 24          	sub    (%r12),%eax
+  8024bc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8024c2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8024c9:	00 00 00 
+    stat->st_dev = &devpipe;
+  8024cc:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8024d3:	00 00 00 
+  8024d6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8024dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e2:	5b                   	pop    %rbx
+  8024e3:	41 5c                	pop    %r12
+  8024e5:	5d                   	pop    %rbp
+  8024e6:	c3                   	ret
+
+00000000008024e7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8024e7:	55                   	push   %rbp
+  8024e8:	48 89 e5             	mov    %rsp,%rbp
+  8024eb:	41 54                	push   %r12
+  8024ed:	53                   	push   %rbx
+  8024ee:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8024f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024f6:	48 89 fe             	mov    %rdi,%rsi
+  8024f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024fe:	49 bc 86 12 80 00 00 	movabs $0x801286,%r12
+  802505:	00 00 00 
+  802508:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80250b:	48 89 df             	mov    %rbx,%rdi
+  80250e:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  802515:	00 00 00 
+  802518:	ff d0                	call   *%rax
+  80251a:	48 89 c6             	mov    %rax,%rsi
+  80251d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802522:	bf 00 00 00 00       	mov    $0x0,%edi
+  802527:	41 ff d4             	call   *%r12
+}
+  80252a:	5b                   	pop    %rbx
+  80252b:	41 5c                	pop    %r12
+  80252d:	5d                   	pop    %rbp
+  80252e:	c3                   	ret
+
+000000000080252f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80252f:	55                   	push   %rbp
+  802530:	48 89 e5             	mov    %rsp,%rbp
+  802533:	41 57                	push   %r15
+  802535:	41 56                	push   %r14
+  802537:	41 55                	push   %r13
+  802539:	41 54                	push   %r12
+  80253b:	53                   	push   %rbx
+  80253c:	48 83 ec 18          	sub    $0x18,%rsp
+  802540:	49 89 fc             	mov    %rdi,%r12
+  802543:	49 89 f5             	mov    %rsi,%r13
+  802546:	49 89 d7             	mov    %rdx,%r15
+  802549:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80254d:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  802554:	00 00 00 
+  802557:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802559:	4d 85 ff             	test   %r15,%r15
+  80255c:	0f 84 af 00 00 00    	je     802611 <devpipe_write+0xe2>
+  802562:	48 89 c3             	mov    %rax,%rbx
+  802565:	4c 89 f8             	mov    %r15,%rax
+  802568:	4d 89 ef             	mov    %r13,%r15
+  80256b:	4c 01 e8             	add    %r13,%rax
+  80256e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802572:	49 bd 8e 11 80 00 00 	movabs $0x80118e,%r13
+  802579:	00 00 00 
+            sys_yield();
+  80257c:	49 be 2b 11 80 00 00 	movabs $0x80112b,%r14
+  802583:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802586:	8b 73 04             	mov    0x4(%rbx),%esi
+  802589:	48 63 ce             	movslq %esi,%rcx
+  80258c:	48 63 03             	movslq (%rbx),%rax
+  80258f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802595:	48 39 c1             	cmp    %rax,%rcx
+  802598:	72 2e                	jb     8025c8 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80259a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80259f:	48 89 da             	mov    %rbx,%rdx
+  8025a2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025a7:	4c 89 e7             	mov    %r12,%rdi
+  8025aa:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025ad:	85 c0                	test   %eax,%eax
+  8025af:	74 66                	je     802617 <devpipe_write+0xe8>
+            sys_yield();
+  8025b1:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025b4:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025b7:	48 63 ce             	movslq %esi,%rcx
+  8025ba:	48 63 03             	movslq (%rbx),%rax
+  8025bd:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025c3:	48 39 c1             	cmp    %rax,%rcx
+  8025c6:	73 d2                	jae    80259a <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025c8:	41 0f b6 3f          	movzbl (%r15),%edi
+  8025cc:	48 89 ca             	mov    %rcx,%rdx
+  8025cf:	48 c1 ea 03          	shr    $0x3,%rdx
+  8025d3:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8025da:	08 10 20 
+  8025dd:	48 f7 e2             	mul    %rdx
+  8025e0:	48 c1 ea 06          	shr    $0x6,%rdx
+  8025e4:	48 89 d0             	mov    %rdx,%rax
+  8025e7:	48 c1 e0 09          	shl    $0x9,%rax
+  8025eb:	48 29 d0             	sub    %rdx,%rax
+  8025ee:	48 c1 e0 03          	shl    $0x3,%rax
+  8025f2:	48 29 c1             	sub    %rax,%rcx
+  8025f5:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8025fa:	83 c6 01             	add    $0x1,%esi
+  8025fd:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802600:	49 83 c7 01          	add    $0x1,%r15
+  802604:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802608:	49 39 c7             	cmp    %rax,%r15
+  80260b:	0f 85 75 ff ff ff    	jne    802586 <devpipe_write+0x57>
+    return n;
+  802611:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802615:	eb 05                	jmp    80261c <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802617:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80261c:	48 83 c4 18          	add    $0x18,%rsp
+  802620:	5b                   	pop    %rbx
+  802621:	41 5c                	pop    %r12
+  802623:	41 5d                	pop    %r13
+  802625:	41 5e                	pop    %r14
+  802627:	41 5f                	pop    %r15
+  802629:	5d                   	pop    %rbp
+  80262a:	c3                   	ret
+
+000000000080262b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80262b:	55                   	push   %rbp
+  80262c:	48 89 e5             	mov    %rsp,%rbp
+  80262f:	41 57                	push   %r15
+  802631:	41 56                	push   %r14
+  802633:	41 55                	push   %r13
+  802635:	41 54                	push   %r12
+  802637:	53                   	push   %rbx
+  802638:	48 83 ec 18          	sub    $0x18,%rsp
+  80263c:	49 89 fc             	mov    %rdi,%r12
+  80263f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802643:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802647:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  80264e:	00 00 00 
+  802651:	ff d0                	call   *%rax
+  802653:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802656:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80265c:	49 bd 8e 11 80 00 00 	movabs $0x80118e,%r13
+  802663:	00 00 00 
+            sys_yield();
+  802666:	49 be 2b 11 80 00 00 	movabs $0x80112b,%r14
+  80266d:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802670:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802675:	74 7d                	je     8026f4 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802677:	8b 03                	mov    (%rbx),%eax
+  802679:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80267c:	75 26                	jne    8026a4 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80267e:	4d 85 ff             	test   %r15,%r15
+  802681:	75 77                	jne    8026fa <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802683:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802688:	48 89 da             	mov    %rbx,%rdx
+  80268b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802690:	4c 89 e7             	mov    %r12,%rdi
+  802693:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802696:	85 c0                	test   %eax,%eax
+  802698:	74 72                	je     80270c <devpipe_read+0xe1>
+            sys_yield();
+  80269a:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80269d:	8b 03                	mov    (%rbx),%eax
+  80269f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026a2:	74 df                	je     802683 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026a4:	48 63 c8             	movslq %eax,%rcx
+  8026a7:	48 89 ca             	mov    %rcx,%rdx
+  8026aa:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026ae:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8026b5:	08 10 20 
+  8026b8:	48 89 d0             	mov    %rdx,%rax
+  8026bb:	48 f7 e6             	mul    %rsi
+  8026be:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026c2:	48 89 d0             	mov    %rdx,%rax
+  8026c5:	48 c1 e0 09          	shl    $0x9,%rax
+  8026c9:	48 29 d0             	sub    %rdx,%rax
+  8026cc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8026d3:	00 
+  8026d4:	48 89 c8             	mov    %rcx,%rax
+  8026d7:	48 29 d0             	sub    %rdx,%rax
+  8026da:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8026df:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8026e3:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8026e7:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8026ea:	49 83 c7 01          	add    $0x1,%r15
+  8026ee:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8026f2:	75 83                	jne    802677 <devpipe_read+0x4c>
+    return n;
+  8026f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026f8:	eb 03                	jmp    8026fd <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8026fa:	4c 89 f8             	mov    %r15,%rax
+}
+  8026fd:	48 83 c4 18          	add    $0x18,%rsp
+  802701:	5b                   	pop    %rbx
+  802702:	41 5c                	pop    %r12
+  802704:	41 5d                	pop    %r13
+  802706:	41 5e                	pop    %r14
+  802708:	41 5f                	pop    %r15
+  80270a:	5d                   	pop    %rbp
+  80270b:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80270c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802711:	eb ea                	jmp    8026fd <devpipe_read+0xd2>
+
+0000000000802713 <pipe>:
+pipe(int pfd[2]) {
+  802713:	55                   	push   %rbp
+  802714:	48 89 e5             	mov    %rsp,%rbp
+  802717:	41 55                	push   %r13
+  802719:	41 54                	push   %r12
+  80271b:	53                   	push   %rbx
+  80271c:	48 83 ec 18          	sub    $0x18,%rsp
+  802720:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802723:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802727:	48 b8 04 19 80 00 00 	movabs $0x801904,%rax
+  80272e:	00 00 00 
+  802731:	ff d0                	call   *%rax
+  802733:	89 c3                	mov    %eax,%ebx
+  802735:	85 c0                	test   %eax,%eax
+  802737:	0f 88 a0 01 00 00    	js     8028dd <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80273d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802742:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802747:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80274b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802750:	48 b8 ba 11 80 00 00 	movabs $0x8011ba,%rax
+  802757:	00 00 00 
+  80275a:	ff d0                	call   *%rax
+  80275c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80275e:	85 c0                	test   %eax,%eax
+  802760:	0f 88 77 01 00 00    	js     8028dd <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802766:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80276a:	48 b8 04 19 80 00 00 	movabs $0x801904,%rax
+  802771:	00 00 00 
+  802774:	ff d0                	call   *%rax
+  802776:	89 c3                	mov    %eax,%ebx
+  802778:	85 c0                	test   %eax,%eax
+  80277a:	0f 88 43 01 00 00    	js     8028c3 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802780:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802785:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80278a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80278e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802793:	48 b8 ba 11 80 00 00 	movabs $0x8011ba,%rax
+  80279a:	00 00 00 
+  80279d:	ff d0                	call   *%rax
+  80279f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027a1:	85 c0                	test   %eax,%eax
+  8027a3:	0f 88 1a 01 00 00    	js     8028c3 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8027a9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027ad:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  8027b4:	00 00 00 
+  8027b7:	ff d0                	call   *%rax
+  8027b9:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8027bc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027c6:	48 89 c6             	mov    %rax,%rsi
+  8027c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027ce:	48 b8 ba 11 80 00 00 	movabs $0x8011ba,%rax
+  8027d5:	00 00 00 
+  8027d8:	ff d0                	call   *%rax
+  8027da:	89 c3                	mov    %eax,%ebx
+  8027dc:	85 c0                	test   %eax,%eax
+  8027de:	0f 88 c5 00 00 00    	js     8028a9 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8027e4:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8027e8:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  8027ef:	00 00 00 
+  8027f2:	ff d0                	call   *%rax
+  8027f4:	48 89 c1             	mov    %rax,%rcx
+  8027f7:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8027fd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802803:	ba 00 00 00 00       	mov    $0x0,%edx
+  802808:	4c 89 ee             	mov    %r13,%rsi
+  80280b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802810:	48 b8 21 12 80 00 00 	movabs $0x801221,%rax
+  802817:	00 00 00 
+  80281a:	ff d0                	call   *%rax
+  80281c:	89 c3                	mov    %eax,%ebx
+  80281e:	85 c0                	test   %eax,%eax
+  802820:	78 6e                	js     802890 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802822:	be 00 10 00 00       	mov    $0x1000,%esi
+  802827:	4c 89 ef             	mov    %r13,%rdi
+  80282a:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  802831:	00 00 00 
+  802834:	ff d0                	call   *%rax
+  802836:	83 f8 02             	cmp    $0x2,%eax
+  802839:	0f 85 ab 00 00 00    	jne    8028ea <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80283f:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802846:	00 00 
+  802848:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80284c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80284e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802852:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802859:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80285d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80285f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802863:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80286a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80286e:	48 bb d6 18 80 00 00 	movabs $0x8018d6,%rbx
+  802875:	00 00 00 
+  802878:	ff d3                	call   *%rbx
+  80287a:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80287e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802882:	ff d3                	call   *%rbx
+  802884:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802889:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80288e:	eb 4d                	jmp    8028dd <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802890:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802895:	4c 89 ee             	mov    %r13,%rsi
+  802898:	bf 00 00 00 00       	mov    $0x0,%edi
+  80289d:	48 b8 86 12 80 00 00 	movabs $0x801286,%rax
+  8028a4:	00 00 00 
+  8028a7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8028a9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028ae:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8028b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028b7:	48 b8 86 12 80 00 00 	movabs $0x801286,%rax
+  8028be:	00 00 00 
+  8028c1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8028c3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028c8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8028cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028d1:	48 b8 86 12 80 00 00 	movabs $0x801286,%rax
+  8028d8:	00 00 00 
+  8028db:	ff d0                	call   *%rax
+}
+  8028dd:	89 d8                	mov    %ebx,%eax
+  8028df:	48 83 c4 18          	add    $0x18,%rsp
+  8028e3:	5b                   	pop    %rbx
+  8028e4:	41 5c                	pop    %r12
+  8028e6:	41 5d                	pop    %r13
+  8028e8:	5d                   	pop    %rbp
+  8028e9:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028ea:	48 b9 10 36 80 00 00 	movabs $0x803610,%rcx
+  8028f1:	00 00 00 
+  8028f4:	48 ba e7 35 80 00 00 	movabs $0x8035e7,%rdx
+  8028fb:	00 00 00 
+  8028fe:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802903:	48 bf fc 35 80 00 00 	movabs $0x8035fc,%rdi
+  80290a:	00 00 00 
+  80290d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802912:	49 b8 4d 2d 80 00 00 	movabs $0x802d4d,%r8
+  802919:	00 00 00 
+  80291c:	41 ff d0             	call   *%r8
+
+000000000080291f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80291f:	55                   	push   %rbp
+  802920:	48 89 e5             	mov    %rsp,%rbp
+  802923:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802927:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80292b:	48 b8 64 19 80 00 00 	movabs $0x801964,%rax
+  802932:	00 00 00 
+  802935:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802937:	85 c0                	test   %eax,%eax
+  802939:	78 35                	js     802970 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80293b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80293f:	48 b8 e8 18 80 00 00 	movabs $0x8018e8,%rax
+  802946:	00 00 00 
+  802949:	ff d0                	call   *%rax
+  80294b:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80294e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802953:	be 00 10 00 00       	mov    $0x1000,%esi
+  802958:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80295c:	48 b8 8e 11 80 00 00 	movabs $0x80118e,%rax
+  802963:	00 00 00 
+  802966:	ff d0                	call   *%rax
+  802968:	85 c0                	test   %eax,%eax
+  80296a:	0f 94 c0             	sete   %al
+  80296d:	0f b6 c0             	movzbl %al,%eax
+}
+  802970:	c9                   	leave
+  802971:	c3                   	ret
+
+0000000000802972 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802972:	48 89 f8             	mov    %rdi,%rax
+  802975:	48 c1 e8 27          	shr    $0x27,%rax
+  802979:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802980:	01 00 00 
+  802983:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802987:	f6 c2 01             	test   $0x1,%dl
+  80298a:	74 6d                	je     8029f9 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80298c:	48 89 f8             	mov    %rdi,%rax
+  80298f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802993:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80299a:	01 00 00 
+  80299d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029a1:	f6 c2 01             	test   $0x1,%dl
+  8029a4:	74 62                	je     802a08 <get_uvpt_entry+0x96>
+  8029a6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8029ad:	01 00 00 
+  8029b0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029b4:	f6 c2 80             	test   $0x80,%dl
+  8029b7:	75 4f                	jne    802a08 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8029b9:	48 89 f8             	mov    %rdi,%rax
+  8029bc:	48 c1 e8 15          	shr    $0x15,%rax
+  8029c0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8029c7:	01 00 00 
+  8029ca:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029ce:	f6 c2 01             	test   $0x1,%dl
+  8029d1:	74 44                	je     802a17 <get_uvpt_entry+0xa5>
+  8029d3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8029da:	01 00 00 
+  8029dd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029e1:	f6 c2 80             	test   $0x80,%dl
+  8029e4:	75 31                	jne    802a17 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8029e6:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8029ea:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8029f1:	01 00 00 
+  8029f4:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8029f8:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029f9:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a00:	01 00 00 
+  802a03:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a07:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a08:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a0f:	01 00 00 
+  802a12:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a16:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a17:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a1e:	01 00 00 
+  802a21:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a25:	c3                   	ret
+
+0000000000802a26 <get_prot>:
+
+int
+get_prot(void *va) {
+  802a26:	55                   	push   %rbp
+  802a27:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a2a:	48 b8 72 29 80 00 00 	movabs $0x802972,%rax
+  802a31:	00 00 00 
+  802a34:	ff d0                	call   *%rax
+  802a36:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802a39:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802a3e:	89 c1                	mov    %eax,%ecx
+  802a40:	83 c9 04             	or     $0x4,%ecx
+  802a43:	f6 c2 01             	test   $0x1,%dl
+  802a46:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802a49:	89 c1                	mov    %eax,%ecx
+  802a4b:	83 c9 02             	or     $0x2,%ecx
+  802a4e:	f6 c2 02             	test   $0x2,%dl
+  802a51:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802a54:	89 c1                	mov    %eax,%ecx
+  802a56:	83 c9 01             	or     $0x1,%ecx
+  802a59:	48 85 d2             	test   %rdx,%rdx
+  802a5c:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802a5f:	89 c1                	mov    %eax,%ecx
+  802a61:	83 c9 40             	or     $0x40,%ecx
+  802a64:	f6 c6 04             	test   $0x4,%dh
+  802a67:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802a6a:	5d                   	pop    %rbp
+  802a6b:	c3                   	ret
+
+0000000000802a6c <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802a6c:	55                   	push   %rbp
+  802a6d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a70:	48 b8 72 29 80 00 00 	movabs $0x802972,%rax
+  802a77:	00 00 00 
+  802a7a:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802a7c:	48 c1 e8 06          	shr    $0x6,%rax
+  802a80:	83 e0 01             	and    $0x1,%eax
+}
+  802a83:	5d                   	pop    %rbp
+  802a84:	c3                   	ret
+
+0000000000802a85 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802a85:	55                   	push   %rbp
+  802a86:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802a89:	48 b8 72 29 80 00 00 	movabs $0x802972,%rax
+  802a90:	00 00 00 
+  802a93:	ff d0                	call   *%rax
+  802a95:	83 e0 01             	and    $0x1,%eax
+}
+  802a98:	5d                   	pop    %rbp
+  802a99:	c3                   	ret
+
+0000000000802a9a <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802a9a:	55                   	push   %rbp
+  802a9b:	48 89 e5             	mov    %rsp,%rbp
+  802a9e:	41 57                	push   %r15
+  802aa0:	41 56                	push   %r14
+  802aa2:	41 55                	push   %r13
+  802aa4:	41 54                	push   %r12
+  802aa6:	53                   	push   %rbx
+  802aa7:	48 83 ec 18          	sub    $0x18,%rsp
+  802aab:	49 89 ff             	mov    %rdi,%r15
+  802aae:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802ab2:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802ab7:	49 bc 85 2a 80 00 00 	movabs $0x802a85,%r12
+  802abe:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802ac1:	49 be 26 2a 80 00 00 	movabs $0x802a26,%r14
+  802ac8:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802acb:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802ad2:	00 00 00 
+  802ad5:	eb 0c                	jmp    802ae3 <foreach_shared_region+0x49>
+  802ad7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ade:	4c 39 eb             	cmp    %r13,%rbx
+  802ae1:	74 38                	je     802b1b <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802ae3:	48 89 df             	mov    %rbx,%rdi
+  802ae6:	41 ff d4             	call   *%r12
+  802ae9:	84 c0                	test   %al,%al
+  802aeb:	74 ea                	je     802ad7 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802aed:	48 89 df             	mov    %rbx,%rdi
+  802af0:	41 ff d6             	call   *%r14
+  802af3:	a8 40                	test   $0x40,%al
+  802af5:	74 e0                	je     802ad7 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802af7:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802afe:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802b02:	48 89 df             	mov    %rbx,%rdi
+  802b05:	41 ff d7             	call   *%r15
+        if (err)
+  802b08:	85 c0                	test   %eax,%eax
+  802b0a:	74 cb                	je     802ad7 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802b0c:	48 83 c4 18          	add    $0x18,%rsp
+  802b10:	5b                   	pop    %rbx
+  802b11:	41 5c                	pop    %r12
+  802b13:	41 5d                	pop    %r13
+  802b15:	41 5e                	pop    %r14
+  802b17:	41 5f                	pop    %r15
+  802b19:	5d                   	pop    %rbp
+  802b1a:	c3                   	ret
+    return 0;
+  802b1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b20:	eb ea                	jmp    802b0c <foreach_shared_region+0x72>
+
+0000000000802b22 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802b22:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b27:	c3                   	ret
+
+0000000000802b28 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802b28:	55                   	push   %rbp
+  802b29:	48 89 e5             	mov    %rsp,%rbp
+  802b2c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802b2f:	48 be 34 36 80 00 00 	movabs $0x803634,%rsi
+  802b36:	00 00 00 
+  802b39:	48 b8 0a 0c 80 00 00 	movabs $0x800c0a,%rax
+  802b40:	00 00 00 
+  802b43:	ff d0                	call   *%rax
+    return 0;
+}
+  802b45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b4a:	5d                   	pop    %rbp
+  802b4b:	c3                   	ret
+
+0000000000802b4c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802b4c:	55                   	push   %rbp
+  802b4d:	48 89 e5             	mov    %rsp,%rbp
+  802b50:	41 57                	push   %r15
+  802b52:	41 56                	push   %r14
+  802b54:	41 55                	push   %r13
+  802b56:	41 54                	push   %r12
+  802b58:	53                   	push   %rbx
+  802b59:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802b60:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802b67:	48 85 d2             	test   %rdx,%rdx
+  802b6a:	74 7a                	je     802be6 <devcons_write+0x9a>
+  802b6c:	49 89 d6             	mov    %rdx,%r14
+  802b6f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802b75:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802b7a:	49 bf 04 0e 80 00 00 	movabs $0x800e04,%r15
+  802b81:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802b84:	4c 89 f3             	mov    %r14,%rbx
+  802b87:	48 29 f3             	sub    %rsi,%rbx
+  802b8a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802b8f:	48 39 c3             	cmp    %rax,%rbx
+  802b92:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802b96:	4c 63 eb             	movslq %ebx,%r13
+  802b99:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802ba0:	48 01 c6             	add    %rax,%rsi
+  802ba3:	4c 89 ea             	mov    %r13,%rdx
+  802ba6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802bad:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802bb0:	4c 89 ee             	mov    %r13,%rsi
+  802bb3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802bba:	48 b8 31 10 80 00 00 	movabs $0x801031,%rax
+  802bc1:	00 00 00 
+  802bc4:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802bc6:	41 01 dc             	add    %ebx,%r12d
+  802bc9:	49 63 f4             	movslq %r12d,%rsi
+  802bcc:	4c 39 f6             	cmp    %r14,%rsi
+  802bcf:	72 b3                	jb     802b84 <devcons_write+0x38>
+    return res;
+  802bd1:	49 63 c4             	movslq %r12d,%rax
+}
+  802bd4:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802bdb:	5b                   	pop    %rbx
+  802bdc:	41 5c                	pop    %r12
+  802bde:	41 5d                	pop    %r13
+  802be0:	41 5e                	pop    %r14
+  802be2:	41 5f                	pop    %r15
+  802be4:	5d                   	pop    %rbp
+  802be5:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802be6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802bec:	eb e3                	jmp    802bd1 <devcons_write+0x85>
+
+0000000000802bee <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802bee:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802bf1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bf6:	48 85 c0             	test   %rax,%rax
+  802bf9:	74 55                	je     802c50 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802bfb:	55                   	push   %rbp
+  802bfc:	48 89 e5             	mov    %rsp,%rbp
+  802bff:	41 55                	push   %r13
+  802c01:	41 54                	push   %r12
+  802c03:	53                   	push   %rbx
+  802c04:	48 83 ec 08          	sub    $0x8,%rsp
+  802c08:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802c0b:	48 bb 5e 10 80 00 00 	movabs $0x80105e,%rbx
+  802c12:	00 00 00 
+  802c15:	49 bc 2b 11 80 00 00 	movabs $0x80112b,%r12
+  802c1c:	00 00 00 
+  802c1f:	eb 03                	jmp    802c24 <devcons_read+0x36>
+  802c21:	41 ff d4             	call   *%r12
+  802c24:	ff d3                	call   *%rbx
+  802c26:	85 c0                	test   %eax,%eax
+  802c28:	74 f7                	je     802c21 <devcons_read+0x33>
+    if (c < 0) return c;
+  802c2a:	48 63 d0             	movslq %eax,%rdx
+  802c2d:	78 13                	js     802c42 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802c2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c34:	83 f8 04             	cmp    $0x4,%eax
+  802c37:	74 09                	je     802c42 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802c39:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802c3d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802c42:	48 89 d0             	mov    %rdx,%rax
+  802c45:	48 83 c4 08          	add    $0x8,%rsp
+  802c49:	5b                   	pop    %rbx
+  802c4a:	41 5c                	pop    %r12
+  802c4c:	41 5d                	pop    %r13
+  802c4e:	5d                   	pop    %rbp
+  802c4f:	c3                   	ret
+  802c50:	48 89 d0             	mov    %rdx,%rax
+  802c53:	c3                   	ret
+
+0000000000802c54 <cputchar>:
+cputchar(int ch) {
+  802c54:	55                   	push   %rbp
+  802c55:	48 89 e5             	mov    %rsp,%rbp
+  802c58:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802c5c:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802c60:	be 01 00 00 00       	mov    $0x1,%esi
+  802c65:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802c69:	48 b8 31 10 80 00 00 	movabs $0x801031,%rax
+  802c70:	00 00 00 
+  802c73:	ff d0                	call   *%rax
+}
+  802c75:	c9                   	leave
+  802c76:	c3                   	ret
+
+0000000000802c77 <getchar>:
+getchar(void) {
+  802c77:	55                   	push   %rbp
+  802c78:	48 89 e5             	mov    %rsp,%rbp
+  802c7b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802c7f:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c84:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802c88:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c8d:	48 b8 47 1c 80 00 00 	movabs $0x801c47,%rax
+  802c94:	00 00 00 
+  802c97:	ff d0                	call   *%rax
+  802c99:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802c9b:	85 c0                	test   %eax,%eax
+  802c9d:	78 06                	js     802ca5 <getchar+0x2e>
+  802c9f:	74 08                	je     802ca9 <getchar+0x32>
+  802ca1:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802ca5:	89 d0                	mov    %edx,%eax
+  802ca7:	c9                   	leave
+  802ca8:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802ca9:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802cae:	eb f5                	jmp    802ca5 <getchar+0x2e>
+
+0000000000802cb0 <iscons>:
+iscons(int fdnum) {
+  802cb0:	55                   	push   %rbp
+  802cb1:	48 89 e5             	mov    %rsp,%rbp
+  802cb4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802cb8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802cbc:	48 b8 64 19 80 00 00 	movabs $0x801964,%rax
+  802cc3:	00 00 00 
+  802cc6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cc8:	85 c0                	test   %eax,%eax
+  802cca:	78 18                	js     802ce4 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802ccc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802cd0:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802cd7:	00 00 00 
+  802cda:	8b 00                	mov    (%rax),%eax
+  802cdc:	39 02                	cmp    %eax,(%rdx)
+  802cde:	0f 94 c0             	sete   %al
+  802ce1:	0f b6 c0             	movzbl %al,%eax
+}
+  802ce4:	c9                   	leave
+  802ce5:	c3                   	ret
+
+0000000000802ce6 <opencons>:
+opencons(void) {
+  802ce6:	55                   	push   %rbp
+  802ce7:	48 89 e5             	mov    %rsp,%rbp
+  802cea:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802cee:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802cf2:	48 b8 04 19 80 00 00 	movabs $0x801904,%rax
+  802cf9:	00 00 00 
+  802cfc:	ff d0                	call   *%rax
+  802cfe:	85 c0                	test   %eax,%eax
+  802d00:	78 49                	js     802d4b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802d02:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802d07:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d0c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802d10:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d15:	48 b8 ba 11 80 00 00 	movabs $0x8011ba,%rax
+  802d1c:	00 00 00 
+  802d1f:	ff d0                	call   *%rax
+  802d21:	85 c0                	test   %eax,%eax
+  802d23:	78 26                	js     802d4b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802d25:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d29:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802d30:	00 00 
+  802d32:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802d34:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d38:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802d3f:	48 b8 d6 18 80 00 00 	movabs $0x8018d6,%rax
+  802d46:	00 00 00 
+  802d49:	ff d0                	call   *%rax
+}
+  802d4b:	c9                   	leave
+  802d4c:	c3                   	ret
+
+0000000000802d4d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802d4d:	55                   	push   %rbp
+  802d4e:	48 89 e5             	mov    %rsp,%rbp
+  802d51:	41 56                	push   %r14
+  802d53:	41 55                	push   %r13
+  802d55:	41 54                	push   %r12
+  802d57:	53                   	push   %rbx
+  802d58:	48 83 ec 50          	sub    $0x50,%rsp
+  802d5c:	49 89 fc             	mov    %rdi,%r12
+  802d5f:	41 89 f5             	mov    %esi,%r13d
+  802d62:	48 89 d3             	mov    %rdx,%rbx
+  802d65:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802d69:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802d6d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802d71:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802d78:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d7c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802d80:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802d84:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802d88:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802d8f:	00 00 00 
+  802d92:	4c 8b 30             	mov    (%rax),%r14
+  802d95:	48 b8 fa 10 80 00 00 	movabs $0x8010fa,%rax
+  802d9c:	00 00 00 
+  802d9f:	ff d0                	call   *%rax
+  802da1:	89 c6                	mov    %eax,%esi
+  802da3:	45 89 e8             	mov    %r13d,%r8d
+  802da6:	4c 89 e1             	mov    %r12,%rcx
+  802da9:	4c 89 f2             	mov    %r14,%rdx
+  802dac:	48 bf 40 36 80 00 00 	movabs $0x803640,%rdi
+  802db3:	00 00 00 
+  802db6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dbb:	49 bc e5 02 80 00 00 	movabs $0x8002e5,%r12
+  802dc2:	00 00 00 
+  802dc5:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802dc8:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802dcc:	48 89 df             	mov    %rbx,%rdi
+  802dcf:	48 b8 81 02 80 00 00 	movabs $0x800281,%rax
+  802dd6:	00 00 00 
+  802dd9:	ff d0                	call   *%rax
+    cprintf("\n");
+  802ddb:	48 bf 88 2f 80 00 00 	movabs $0x802f88,%rdi
+  802de2:	00 00 00 
+  802de5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dea:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802ded:	cc                   	int3
+  802dee:	eb fd                	jmp    802ded <_panic+0xa0>
+
+0000000000802df0 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802df0:	55                   	push   %rbp
+  802df1:	48 89 e5             	mov    %rsp,%rbp
+  802df4:	41 54                	push   %r12
+  802df6:	53                   	push   %rbx
+  802df7:	48 89 fb             	mov    %rdi,%rbx
+  802dfa:	48 89 f7             	mov    %rsi,%rdi
+  802dfd:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802e00:	48 85 f6             	test   %rsi,%rsi
+  802e03:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802e0a:	00 00 00 
+  802e0d:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802e11:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e16:	48 b8 24 15 80 00 00 	movabs $0x801524,%rax
+  802e1d:	00 00 00 
+  802e20:	ff d0                	call   *%rax
+    if (res < 0) {
+  802e22:	85 c0                	test   %eax,%eax
+  802e24:	78 45                	js     802e6b <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802e26:	48 85 db             	test   %rbx,%rbx
+  802e29:	74 12                	je     802e3d <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802e2b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e32:	00 00 00 
+  802e35:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802e3b:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802e3d:	4d 85 e4             	test   %r12,%r12
+  802e40:	74 14                	je     802e56 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802e42:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e49:	00 00 00 
+  802e4c:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802e52:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802e56:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e5d:	00 00 00 
+  802e60:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802e66:	5b                   	pop    %rbx
+  802e67:	41 5c                	pop    %r12
+  802e69:	5d                   	pop    %rbp
+  802e6a:	c3                   	ret
+        if (from_env_store)
+  802e6b:	48 85 db             	test   %rbx,%rbx
+  802e6e:	74 06                	je     802e76 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802e70:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802e76:	4d 85 e4             	test   %r12,%r12
+  802e79:	74 eb                	je     802e66 <ipc_recv+0x76>
+            *perm_store = 0;
+  802e7b:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802e82:	00 
+  802e83:	eb e1                	jmp    802e66 <ipc_recv+0x76>
+
+0000000000802e85 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802e85:	55                   	push   %rbp
+  802e86:	48 89 e5             	mov    %rsp,%rbp
+  802e89:	41 57                	push   %r15
+  802e8b:	41 56                	push   %r14
+  802e8d:	41 55                	push   %r13
+  802e8f:	41 54                	push   %r12
+  802e91:	53                   	push   %rbx
+  802e92:	48 83 ec 18          	sub    $0x18,%rsp
+  802e96:	41 89 fd             	mov    %edi,%r13d
+  802e99:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802e9c:	48 89 d3             	mov    %rdx,%rbx
+  802e9f:	49 89 cc             	mov    %rcx,%r12
+  802ea2:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802ea6:	48 85 d2             	test   %rdx,%rdx
+  802ea9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802eb0:	00 00 00 
+  802eb3:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802eb7:	49 be f8 14 80 00 00 	movabs $0x8014f8,%r14
+  802ebe:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802ec1:	49 bf 2b 11 80 00 00 	movabs $0x80112b,%r15
+  802ec8:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802ecb:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802ece:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802ed2:	4c 89 e1             	mov    %r12,%rcx
+  802ed5:	48 89 da             	mov    %rbx,%rdx
+  802ed8:	44 89 ef             	mov    %r13d,%edi
+  802edb:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802ede:	85 c0                	test   %eax,%eax
+  802ee0:	74 34                	je     802f16 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802ee2:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802ee5:	75 05                	jne    802eec <ipc_send+0x67>
+        sys_yield();
+  802ee7:	41 ff d7             	call   *%r15
+    while (true) {
+  802eea:	eb df                	jmp    802ecb <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802eec:	48 ba 63 36 80 00 00 	movabs $0x803663,%rdx
+  802ef3:	00 00 00 
+  802ef6:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802efb:	48 bf 7c 36 80 00 00 	movabs $0x80367c,%rdi
+  802f02:	00 00 00 
+  802f05:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0a:	48 b9 4d 2d 80 00 00 	movabs $0x802d4d,%rcx
+  802f11:	00 00 00 
+  802f14:	ff d1                	call   *%rcx
+    }
+}
+  802f16:	48 83 c4 18          	add    $0x18,%rsp
+  802f1a:	5b                   	pop    %rbx
+  802f1b:	41 5c                	pop    %r12
+  802f1d:	41 5d                	pop    %r13
+  802f1f:	41 5e                	pop    %r14
+  802f21:	41 5f                	pop    %r15
+  802f23:	5d                   	pop    %rbp
+  802f24:	c3                   	ret
+
+0000000000802f25 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802f25:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802f2a:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802f31:	00 00 00 
+  802f34:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802f3b:	48 01 ca             	add    %rcx,%rdx
+  802f3e:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802f44:	39 fa                	cmp    %edi,%edx
+  802f46:	74 12                	je     802f5a <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802f48:	48 83 c0 01          	add    $0x1,%rax
+  802f4c:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802f52:	75 e0                	jne    802f34 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802f54:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f59:	c3                   	ret
+            return envs[i].env_id;
+  802f5a:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802f61:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802f68:	00 00 00 
+  802f6b:	48 01 d0             	add    %rdx,%rax
+  802f6e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802f74:	c3                   	ret
+  802f75:	0f 1f 00             	nopl   (%rax)
+
+0000000000802f78 <__rodata_start>:
+  802f78:	75 73                	jne    802fed <__rodata_start+0x75>
+  802f7a:	61                   	(bad)
+  802f7b:	67 65 3a 20          	cmp    %gs:(%eax),%ah
+  802f7f:	6c                   	insb   (%dx),%es:(%rdi)
+  802f80:	73 66                	jae    802fe8 <__rodata_start+0x70>
+  802f82:	64 20 5b 2d          	and    %bl,%fs:0x2d(%rbx)
+  802f86:	31 5d 0a             	xor    %ebx,0xa(%rbp)
+  802f89:	00 66 0f             	add    %ah,0xf(%rsi)
+  802f8c:	1f                   	(bad)
+  802f8d:	44 00 00             	add    %r8b,(%rax)
+  802f90:	66 64 20 25 64 3a 20 	data16 and %ah,%fs:0x6e203a64(%rip)        # 6ea069fc <__bss_end+0x6e1fe9fc>
+  802f97:	6e 
+  802f98:	61                   	(bad)
+  802f99:	6d                   	insl   (%dx),%es:(%rdi)
+  802f9a:	65 20 25 73 20 69 73 	and    %ah,%gs:0x73692073(%rip)        # 73e95014 <__bss_end+0x7368d014>
+  802fa1:	64 69 72 20 25 64 20 	imul   $0x73206425,%fs:0x20(%rdx),%esi
+  802fa8:	73 
+  802fa9:	69 7a 65 20 25 64 20 	imul   $0x20642520,0x65(%rdx),%edi
+  802fb0:	64 65 76 20          	fs gs jbe 802fd4 <__rodata_start+0x5c>
+  802fb4:	25 73 0a 00 3c       	and    $0x3c000a73,%eax
+  802fb9:	75 6e                	jne    803029 <__rodata_start+0xb1>
+  802fbb:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802fbf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fc0:	3e 00 30             	ds add %dh,(%rax)
+  802fc3:	31 32                	xor    %esi,(%rdx)
+  802fc5:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802fcc:	41                   	rex.B
+  802fcd:	42                   	rex.X
+  802fce:	43                   	rex.XB
+  802fcf:	44                   	rex.R
+  802fd0:	45                   	rex.RB
+  802fd1:	46 00 30             	rex.RX add %r14b,(%rax)
+  802fd4:	31 32                	xor    %esi,(%rdx)
+  802fd6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802fdd:	61                   	(bad)
+  802fde:	62 63 64 65 66       	(bad)
+  802fe3:	00 28                	add    %ch,(%rax)
+  802fe5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fe6:	75 6c                	jne    803054 <__rodata_start+0xdc>
+  802fe8:	6c                   	insb   (%dx),%es:(%rdi)
+  802fe9:	29 00                	sub    %eax,(%rax)
+  802feb:	65 72 72             	gs jb  803060 <__rodata_start+0xe8>
+  802fee:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fef:	72 20                	jb     803011 <__rodata_start+0x99>
+  802ff1:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802ff6:	73 70                	jae    803068 <__rodata_start+0xf0>
+  802ff8:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802ffc:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803003:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803004:	72 00                	jb     803006 <__rodata_start+0x8e>
+  803006:	62 61 64 20 65       	(bad)
+  80300b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80300c:	76 69                	jbe    803077 <__rodata_start+0xff>
+  80300e:	72 6f                	jb     80307f <__rodata_start+0x107>
+  803010:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803011:	6d                   	insl   (%dx),%es:(%rdi)
+  803012:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803014:	74 00                	je     803016 <__rodata_start+0x9e>
+  803016:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80301d:	20 70 61             	and    %dh,0x61(%rax)
+  803020:	72 61                	jb     803083 <__rodata_start+0x10b>
+  803022:	6d                   	insl   (%dx),%es:(%rdi)
+  803023:	65 74 65             	gs je  80308b <__rodata_start+0x113>
+  803026:	72 00                	jb     803028 <__rodata_start+0xb0>
+  803028:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803029:	75 74                	jne    80309f <__rodata_start+0x127>
+  80302b:	20 6f 66             	and    %ch,0x66(%rdi)
+  80302e:	20 6d 65             	and    %ch,0x65(%rbp)
+  803031:	6d                   	insl   (%dx),%es:(%rdi)
+  803032:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803033:	72 79                	jb     8030ae <__rodata_start+0x136>
+  803035:	00 6f 75             	add    %ch,0x75(%rdi)
+  803038:	74 20                	je     80305a <__rodata_start+0xe2>
+  80303a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80303b:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80303f:	76 69                	jbe    8030aa <__rodata_start+0x132>
+  803041:	72 6f                	jb     8030b2 <__rodata_start+0x13a>
+  803043:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803044:	6d                   	insl   (%dx),%es:(%rdi)
+  803045:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803047:	74 73                	je     8030bc <__rodata_start+0x144>
+  803049:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80304c:	72 72                	jb     8030c0 <__rodata_start+0x148>
+  80304e:	75 70                	jne    8030c0 <__rodata_start+0x148>
+  803050:	74 65                	je     8030b7 <__rodata_start+0x13f>
+  803052:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803057:	75 67                	jne    8030c0 <__rodata_start+0x148>
+  803059:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80305c:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80305e:	00 73 65             	add    %dh,0x65(%rbx)
+  803061:	67 6d                	insl   (%dx),%es:(%edi)
+  803063:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803065:	74 61                	je     8030c8 <__rodata_start+0x150>
+  803067:	74 69                	je     8030d2 <__rodata_start+0x15a>
+  803069:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80306a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80306b:	20 66 61             	and    %ah,0x61(%rsi)
+  80306e:	75 6c                	jne    8030dc <__rodata_start+0x164>
+  803070:	74 00                	je     803072 <__rodata_start+0xfa>
+  803072:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803079:	20 45 4c             	and    %al,0x4c(%rbp)
+  80307c:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803080:	61                   	(bad)
+  803081:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803086:	20 73 75             	and    %dh,0x75(%rbx)
+  803089:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80308c:	73 79                	jae    803107 <__rodata_start+0x18f>
+  80308e:	73 74                	jae    803104 <__rodata_start+0x18c>
+  803090:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803092:	20 63 61             	and    %ah,0x61(%rbx)
+  803095:	6c                   	insb   (%dx),%es:(%rdi)
+  803096:	6c                   	insb   (%dx),%es:(%rdi)
+  803097:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80309a:	74 72                	je     80310e <__rodata_start+0x196>
+  80309c:	79 20                	jns    8030be <__rodata_start+0x146>
+  80309e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80309f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030a0:	74 20                	je     8030c2 <__rodata_start+0x14a>
+  8030a2:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8030a4:	75 6e                	jne    803114 <__rodata_start+0x19c>
+  8030a6:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8030aa:	76 20                	jbe    8030cc <__rodata_start+0x154>
+  8030ac:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8030b3:	72 65                	jb     80311a <__rodata_start+0x1a2>
+  8030b5:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8030b8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030b9:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8030bd:	65 78 70             	gs js  803130 <__rodata_start+0x1b8>
+  8030c0:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8030c5:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8030c8:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8030cc:	20 66 69             	and    %ah,0x69(%rsi)
+  8030cf:	6c                   	insb   (%dx),%es:(%rdi)
+  8030d0:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8030d4:	20 66 72             	and    %ah,0x72(%rsi)
+  8030d7:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8030dc:	61                   	(bad)
+  8030dd:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8030e0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030e1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030e2:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8030e6:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8030e9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030ea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030eb:	20 6d 61             	and    %ch,0x61(%rbp)
+  8030ee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030ef:	79 20                	jns    803111 <__rodata_start+0x199>
+  8030f1:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8030f8:	72 65                	jb     80315f <__rodata_start+0x1e7>
+  8030fa:	20 6f 70             	and    %ch,0x70(%rdi)
+  8030fd:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030ff:	00 66 69             	add    %ah,0x69(%rsi)
+  803102:	6c                   	insb   (%dx),%es:(%rdi)
+  803103:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803107:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80310a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80310b:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80310e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80310f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803110:	74 20                	je     803132 <__rodata_start+0x1ba>
+  803112:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803114:	75 6e                	jne    803184 <__rodata_start+0x20c>
+  803116:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80311a:	76 61                	jbe    80317d <__rodata_start+0x205>
+  80311c:	6c                   	insb   (%dx),%es:(%rdi)
+  80311d:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803124:	00 
+  803125:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80312c:	72 65                	jb     803193 <__rodata_start+0x21b>
+  80312e:	61                   	(bad)
+  80312f:	64 79 20             	fs jns 803152 <__rodata_start+0x1da>
+  803132:	65 78 69             	gs js  80319e <__rodata_start+0x226>
+  803135:	73 74                	jae    8031ab <__rodata_start+0x233>
+  803137:	73 00                	jae    803139 <__rodata_start+0x1c1>
+  803139:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80313a:	70 65                	jo     8031a1 <__rodata_start+0x229>
+  80313c:	72 61                	jb     80319f <__rodata_start+0x227>
+  80313e:	74 69                	je     8031a9 <__rodata_start+0x231>
+  803140:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803141:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803142:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803145:	74 20                	je     803167 <__rodata_start+0x1ef>
+  803147:	73 75                	jae    8031be <__rodata_start+0x246>
+  803149:	70 70                	jo     8031bb <__rodata_start+0x243>
+  80314b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80314c:	72 74                	jb     8031c2 <__rodata_start+0x24a>
+  80314e:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803153:	65 72 61             	gs jb  8031b7 <__rodata_start+0x23f>
+  803156:	74 69                	je     8031c1 <__rodata_start+0x249>
+  803158:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803159:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80315a:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80315d:	74 20                	je     80317f <__rodata_start+0x207>
+  80315f:	70 65                	jo     8031c6 <__rodata_start+0x24e>
+  803161:	72 6d                	jb     8031d0 <__rodata_start+0x258>
+  803163:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  80316a:	2e 
+  80316b:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803172:	00 
+  803173:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80317a:	00 00 00 
+  80317d:	0f 1f 00             	nopl   (%rax)
+  803180:	d2 04 80             	rolb   %cl,(%rax,%rax,4)
+  803183:	00 00                	add    %al,(%rax)
+  803185:	00 00                	add    %al,(%rax)
+  803187:	00 13                	add    %dl,(%rbx)
+  803189:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80318f:	00 03                	add    %al,(%rbx)
+  803191:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803197:	00 13                	add    %dl,(%rbx)
+  803199:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80319f:	00 13                	add    %dl,(%rbx)
+  8031a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031a7:	00 13                	add    %dl,(%rbx)
+  8031a9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031af:	00 13                	add    %dl,(%rbx)
+  8031b1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031b7:	00 f1                	add    %dh,%cl
+  8031b9:	04 80                	add    $0x80,%al
+  8031bb:	00 00                	add    %al,(%rax)
+  8031bd:	00 00                	add    %al,(%rax)
+  8031bf:	00 13                	add    %dl,(%rbx)
+  8031c1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031c7:	00 13                	add    %dl,(%rbx)
+  8031c9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031cf:	00 e5                	add    %ah,%ch
+  8031d1:	04 80                	add    $0x80,%al
+  8031d3:	00 00                	add    %al,(%rax)
+  8031d5:	00 00                	add    %al,(%rax)
+  8031d7:	00 5f 05             	add    %bl,0x5(%rdi)
+  8031da:	80 00 00             	addb   $0x0,(%rax)
+  8031dd:	00 00                	add    %al,(%rax)
+  8031df:	00 13                	add    %dl,(%rbx)
+  8031e1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031e7:	00 e5                	add    %ah,%ch
+  8031e9:	04 80                	add    $0x80,%al
+  8031eb:	00 00                	add    %al,(%rax)
+  8031ed:	00 00                	add    %al,(%rax)
+  8031ef:	00 2b                	add    %ch,(%rbx)
+  8031f1:	05 80 00 00 00       	add    $0x80,%eax
+  8031f6:	00 00                	add    %al,(%rax)
+  8031f8:	2b 05 80 00 00 00    	sub    0x80(%rip),%eax        # 80327e <__rodata_start+0x306>
+  8031fe:	00 00                	add    %al,(%rax)
+  803200:	2b 05 80 00 00 00    	sub    0x80(%rip),%eax        # 803286 <__rodata_start+0x30e>
+  803206:	00 00                	add    %al,(%rax)
+  803208:	2b 05 80 00 00 00    	sub    0x80(%rip),%eax        # 80328e <__rodata_start+0x316>
+  80320e:	00 00                	add    %al,(%rax)
+  803210:	2b 05 80 00 00 00    	sub    0x80(%rip),%eax        # 803296 <__rodata_start+0x31e>
+  803216:	00 00                	add    %al,(%rax)
+  803218:	2b 05 80 00 00 00    	sub    0x80(%rip),%eax        # 80329e <__rodata_start+0x326>
+  80321e:	00 00                	add    %al,(%rax)
+  803220:	2b 05 80 00 00 00    	sub    0x80(%rip),%eax        # 8032a6 <__rodata_start+0x32e>
+  803226:	00 00                	add    %al,(%rax)
+  803228:	2b 05 80 00 00 00    	sub    0x80(%rip),%eax        # 8032ae <__rodata_start+0x336>
+  80322e:	00 00                	add    %al,(%rax)
+  803230:	2b 05 80 00 00 00    	sub    0x80(%rip),%eax        # 8032b6 <__rodata_start+0x33e>
+  803236:	00 00                	add    %al,(%rax)
+  803238:	13 0b                	adc    (%rbx),%ecx
+  80323a:	80 00 00             	addb   $0x0,(%rax)
+  80323d:	00 00                	add    %al,(%rax)
+  80323f:	00 13                	add    %dl,(%rbx)
+  803241:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803247:	00 13                	add    %dl,(%rbx)
+  803249:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80324f:	00 13                	add    %dl,(%rbx)
+  803251:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803257:	00 13                	add    %dl,(%rbx)
+  803259:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80325f:	00 13                	add    %dl,(%rbx)
+  803261:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803267:	00 13                	add    %dl,(%rbx)
+  803269:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80326f:	00 13                	add    %dl,(%rbx)
+  803271:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803277:	00 13                	add    %dl,(%rbx)
+  803279:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80327f:	00 13                	add    %dl,(%rbx)
+  803281:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803287:	00 13                	add    %dl,(%rbx)
+  803289:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80328f:	00 13                	add    %dl,(%rbx)
+  803291:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803297:	00 13                	add    %dl,(%rbx)
+  803299:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80329f:	00 13                	add    %dl,(%rbx)
+  8032a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032a7:	00 13                	add    %dl,(%rbx)
+  8032a9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032af:	00 13                	add    %dl,(%rbx)
+  8032b1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032b7:	00 13                	add    %dl,(%rbx)
+  8032b9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032bf:	00 13                	add    %dl,(%rbx)
+  8032c1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032c7:	00 13                	add    %dl,(%rbx)
+  8032c9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032cf:	00 13                	add    %dl,(%rbx)
+  8032d1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032d7:	00 13                	add    %dl,(%rbx)
+  8032d9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032df:	00 13                	add    %dl,(%rbx)
+  8032e1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032e7:	00 13                	add    %dl,(%rbx)
+  8032e9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032ef:	00 13                	add    %dl,(%rbx)
+  8032f1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032f7:	00 13                	add    %dl,(%rbx)
+  8032f9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032ff:	00 13                	add    %dl,(%rbx)
+  803301:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803307:	00 13                	add    %dl,(%rbx)
+  803309:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80330f:	00 13                	add    %dl,(%rbx)
+  803311:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803317:	00 13                	add    %dl,(%rbx)
+  803319:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80331f:	00 13                	add    %dl,(%rbx)
+  803321:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803327:	00 36                	add    %dh,(%rsi)
+  803329:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80332f:	00 13                	add    %dl,(%rbx)
+  803331:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803337:	00 13                	add    %dl,(%rbx)
+  803339:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80333f:	00 13                	add    %dl,(%rbx)
+  803341:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803347:	00 13                	add    %dl,(%rbx)
+  803349:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80334f:	00 13                	add    %dl,(%rbx)
+  803351:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803357:	00 13                	add    %dl,(%rbx)
+  803359:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80335f:	00 13                	add    %dl,(%rbx)
+  803361:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803367:	00 13                	add    %dl,(%rbx)
+  803369:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80336f:	00 13                	add    %dl,(%rbx)
+  803371:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803377:	00 13                	add    %dl,(%rbx)
+  803379:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80337f:	00 82 05 80 00 00    	add    %al,0x8005(%rdx)
+  803385:	00 00                	add    %al,(%rax)
+  803387:	00 51 07             	add    %dl,0x7(%rcx)
+  80338a:	80 00 00             	addb   $0x0,(%rax)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 13                	add    %dl,(%rbx)
+  803391:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803397:	00 13                	add    %dl,(%rbx)
+  803399:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80339f:	00 13                	add    %dl,(%rbx)
+  8033a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033a7:	00 13                	add    %dl,(%rbx)
+  8033a9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033af:	00 b1 05 80 00 00    	add    %dh,0x8005(%rcx)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 13                	add    %dl,(%rbx)
+  8033b9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033bf:	00 13                	add    %dl,(%rbx)
+  8033c1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033c7:	00 77 05             	add    %dh,0x5(%rdi)
+  8033ca:	80 00 00             	addb   $0x0,(%rax)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 13                	add    %dl,(%rbx)
+  8033d1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033d7:	00 13                	add    %dl,(%rbx)
+  8033d9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033df:	00 f9                	add    %bh,%cl
+  8033e1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8033e7:	00 c3                	add    %al,%bl
+  8033e9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8033ef:	00 13                	add    %dl,(%rbx)
+  8033f1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033f7:	00 13                	add    %dl,(%rbx)
+  8033f9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033ff:	00 48 06             	add    %cl,0x6(%rax)
+  803402:	80 00 00             	addb   $0x0,(%rax)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 13                	add    %dl,(%rbx)
+  803409:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80340f:	00 25 08 80 00 00    	add    %ah,0x8008(%rip)        # 80b41d <__bss_end+0x341d>
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 13                	add    %dl,(%rbx)
+  803419:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80341f:	00 13                	add    %dl,(%rbx)
+  803421:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803427:	00 36                	add    %dh,(%rsi)
+  803429:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80342f:	00 13                	add    %dl,(%rbx)
+  803431:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803437:	00 db                	add    %bl,%bl
+  803439:	04 80                	add    $0x80,%al
+  80343b:	00 00                	add    %al,(%rax)
+  80343d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803440 <error_string>:
+	...
+  803448:	f4 2f 80 00 00 00 00 00 06 30 80 00 00 00 00 00     ./.......0......
+  803458:	16 30 80 00 00 00 00 00 28 30 80 00 00 00 00 00     .0......(0......
+  803468:	36 30 80 00 00 00 00 00 4a 30 80 00 00 00 00 00     60......J0......
+  803478:	5f 30 80 00 00 00 00 00 72 30 80 00 00 00 00 00     _0......r0......
+  803488:	84 30 80 00 00 00 00 00 98 30 80 00 00 00 00 00     .0.......0......
+  803498:	a8 30 80 00 00 00 00 00 bb 30 80 00 00 00 00 00     .0.......0......
+  8034a8:	d2 30 80 00 00 00 00 00 e8 30 80 00 00 00 00 00     .0.......0......
+  8034b8:	00 31 80 00 00 00 00 00 18 31 80 00 00 00 00 00     .1.......1......
+  8034c8:	25 31 80 00 00 00 00 00 f0 34 80 00 00 00 00 00     %1.......4......
+  8034d8:	39 31 80 00 00 00 00 00 00 00 00 00 00 00 00 00     91..............
+  8034e8:	51 31 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     Q1......file is 
+  8034f8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803508:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803518:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803528:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803538:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803548:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803558:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803568:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803578:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803588:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803598:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8035a8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8035b8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008035c0 <devtab>:
+  8035c0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8035d0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8035e0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8035f0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803600:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803610:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803620:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803630:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803640:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803650:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803660:	3a 20 00 69 70 63 5f 73 65 6e 64 3a 20 66 61 69     : .ipc_send: fai
+  803670:	6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62 2f     led to send.lib/
+  803680:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803690:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803700:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803710:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803720:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803730:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803740:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803750:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803760:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803770:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803780:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803790:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803800:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803810:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
@@ -0,0 +1,6075 @@
+
+obj/user/memlayout:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 52 03 00 00       	call   800375 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <memlayout>:
+#ifndef PROT_SHARE
+#define PROT_SHARE 0x400
+#endif
+
+void
+memlayout(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 48          	sub    $0x48,%rsp
+    size_t total_p = 0;
+    size_t total_u = 0;
+    size_t total_w = 0;
+    size_t total_cow = 0;
+
+    cprintf("EID: %d, PEID: %d\n", thisenv->env_id, thisenv->env_parent_id);
+  800036:	49 bc 00 50 80 00 00 	movabs $0x805000,%r12
+  80003d:	00 00 00 
+  800040:	49 8b 04 24          	mov    (%r12),%rax
+  800044:	8b 90 cc 00 00 00    	mov    0xcc(%rax),%edx
+  80004a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800050:	48 bf 6c 2f 80 00 00 	movabs $0x802f6c,%rdi
+  800057:	00 00 00 
+  80005a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005f:	48 bb 8f 05 80 00 00 	movabs $0x80058f,%rbx
+  800066:	00 00 00 
+  800069:	ff d3                	call   *%rbx
+    cprintf("pml4=%p uvpml4=%p uvpdp=%p uvpd=%p uvpt=%p\n", thisenv->address_space.pml4,
+  80006b:	49 8b 04 24          	mov    (%r12),%rax
+  80006f:	48 8b b0 e8 00 00 00 	mov    0xe8(%rax),%rsi
+  800076:	49 b9 00 00 00 80 00 	movabs $0x10080000000,%r9
+  80007d:	01 00 00 
+  800080:	49 b8 00 00 00 00 00 	movabs $0x10000000000,%r8
+  800087:	01 00 00 
+  80008a:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  800091:	01 00 00 
+  800094:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80009b:	01 00 00 
+  80009e:	48 bf 18 30 80 00 00 	movabs $0x803018,%rdi
+  8000a5:	00 00 00 
+  8000a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ad:	ff d3                	call   *%rbx
+    size_t total_cow = 0;
+  8000af:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8000b6:	00 
+    size_t total_w = 0;
+  8000b7:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8000be:	00 
+    size_t total_u = 0;
+  8000bf:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8000c6:	00 
+    size_t total_p = 0;
+  8000c7:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8000ce:	00 
+            (void *)UVPML4, (void *)UVPDP, (void *)UVPT, (void *)UVPD);
+
+    for (addr = 0; addr < KERN_BASE_ADDR; addr += PAGE_SIZE) {
+  8000cf:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        pte_t ent = get_uvpt_entry((void *)addr);
+  8000d5:	49 bd fe 29 80 00 00 	movabs $0x8029fe,%r13
+  8000dc:	00 00 00 
+        if (ent) {
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8000df:	49 bc 95 2f 80 00 00 	movabs $0x802f95,%r12
+  8000e6:	00 00 00 
+  8000e9:	eb 5f                	jmp    80014a <memlayout+0x125>
+                    (void *)get_uvpt_entry((void *)addr), (unsigned long)addr, (unsigned long)ent,
+  8000eb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8000ef:	41 ff d5             	call   *%r13
+  8000f2:	48 89 c6             	mov    %rax,%rsi
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8000f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8000f9:	41 57                	push   %r15
+  8000fb:	ff 75 c0             	push   -0x40(%rbp)
+  8000fe:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800101:	50                   	push   %rax
+  800102:	44 8b 4d b8          	mov    -0x48(%rbp),%r9d
+  800106:	44 8b 45 b4          	mov    -0x4c(%rbp),%r8d
+  80010a:	48 89 d9             	mov    %rbx,%rcx
+  80010d:	4c 89 f2             	mov    %r14,%rdx
+  800110:	48 bf 48 30 80 00 00 	movabs $0x803048,%rdi
+  800117:	00 00 00 
+  80011a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011f:	49 ba 8f 05 80 00 00 	movabs $0x80058f,%r10
+  800126:	00 00 00 
+  800129:	41 ff d2             	call   *%r10
+  80012c:	48 83 c4 20          	add    $0x20,%rsp
+    for (addr = 0; addr < KERN_BASE_ADDR; addr += PAGE_SIZE) {
+  800130:	49 81 c6 00 10 00 00 	add    $0x1000,%r14
+  800137:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  80013e:	00 00 00 
+  800141:	49 39 c6             	cmp    %rax,%r14
+  800144:	0f 84 8f 00 00 00    	je     8001d9 <memlayout+0x1b4>
+        pte_t ent = get_uvpt_entry((void *)addr);
+  80014a:	4c 89 75 c8          	mov    %r14,-0x38(%rbp)
+  80014e:	4c 89 f7             	mov    %r14,%rdi
+  800151:	41 ff d5             	call   *%r13
+  800154:	48 89 c3             	mov    %rax,%rbx
+        if (ent) {
+  800157:	48 85 c0             	test   %rax,%rax
+  80015a:	74 d4                	je     800130 <memlayout+0x10b>
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80015c:	a8 40                	test   $0x40,%al
+  80015e:	49 bf 60 2f 80 00 00 	movabs $0x802f60,%r15
+  800165:	00 00 00 
+  800168:	4d 0f 44 fc          	cmove  %r12,%r15
+  80016c:	4c 89 65 c0          	mov    %r12,-0x40(%rbp)
+  800170:	f6 c4 08             	test   $0x8,%ah
+  800173:	74 13                	je     800188 <memlayout+0x163>
+                    (ent & PTE_P)    ? total_p++, 'P' : '-',
+                    (ent & PTE_U)    ? total_u++, 'U' : '-',
+                    (ent & PTE_W)    ? total_w++, 'W' : '-',
+                    (ent & PROT_COW) ? total_cow++, " COW" : "",
+  800175:	48 83 45 90 01       	addq   $0x1,-0x70(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80017a:	48 b8 67 2f 80 00 00 	movabs $0x802f67,%rax
+  800181:	00 00 00 
+  800184:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800188:	c7 45 bc 2d 00 00 00 	movl   $0x2d,-0x44(%rbp)
+  80018f:	f6 c3 02             	test   $0x2,%bl
+  800192:	74 0c                	je     8001a0 <memlayout+0x17b>
+                    (ent & PTE_W)    ? total_w++, 'W' : '-',
+  800194:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  800199:	c7 45 bc 57 00 00 00 	movl   $0x57,-0x44(%rbp)
+  8001a0:	c7 45 b8 2d 00 00 00 	movl   $0x2d,-0x48(%rbp)
+  8001a7:	f6 c3 04             	test   $0x4,%bl
+  8001aa:	74 0c                	je     8001b8 <memlayout+0x193>
+                    (ent & PTE_U)    ? total_u++, 'U' : '-',
+  8001ac:	48 83 45 a0 01       	addq   $0x1,-0x60(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8001b1:	c7 45 b8 55 00 00 00 	movl   $0x55,-0x48(%rbp)
+  8001b8:	c7 45 b4 2d 00 00 00 	movl   $0x2d,-0x4c(%rbp)
+  8001bf:	f6 c3 01             	test   $0x1,%bl
+  8001c2:	0f 84 23 ff ff ff    	je     8000eb <memlayout+0xc6>
+                    (ent & PTE_P)    ? total_p++, 'P' : '-',
+  8001c8:	48 83 45 a8 01       	addq   $0x1,-0x58(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8001cd:	c7 45 b4 50 00 00 00 	movl   $0x50,-0x4c(%rbp)
+  8001d4:	e9 12 ff ff ff       	jmp    8000eb <memlayout+0xc6>
+                    (ent & PROT_SHARE) ? " SHARE" : "");
+        }
+    }
+
+    cprintf("Memory usage summary:\n");
+  8001d9:	48 bf 7f 2f 80 00 00 	movabs $0x802f7f,%rdi
+  8001e0:	00 00 00 
+  8001e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e8:	48 bb 8f 05 80 00 00 	movabs $0x80058f,%rbx
+  8001ef:	00 00 00 
+  8001f2:	ff d3                	call   *%rbx
+    cprintf("  PTE_P: %lu\n", (unsigned long)total_p);
+  8001f4:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8001f8:	48 bf 96 2f 80 00 00 	movabs $0x802f96,%rdi
+  8001ff:	00 00 00 
+  800202:	b8 00 00 00 00       	mov    $0x0,%eax
+  800207:	ff d3                	call   *%rbx
+    cprintf("  PTE_U: %lu\n", (unsigned long)total_u);
+  800209:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80020d:	48 bf a4 2f 80 00 00 	movabs $0x802fa4,%rdi
+  800214:	00 00 00 
+  800217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021c:	ff d3                	call   *%rbx
+    cprintf("  PTE_W: %lu\n", (unsigned long)total_w);
+  80021e:	48 8b 75 98          	mov    -0x68(%rbp),%rsi
+  800222:	48 bf b2 2f 80 00 00 	movabs $0x802fb2,%rdi
+  800229:	00 00 00 
+  80022c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800231:	ff d3                	call   *%rbx
+    cprintf("  PTE_COW: %lu\n", (unsigned long)total_cow);
+  800233:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800237:	48 bf c0 2f 80 00 00 	movabs $0x802fc0,%rdi
+  80023e:	00 00 00 
+  800241:	b8 00 00 00 00       	mov    $0x0,%eax
+  800246:	ff d3                	call   *%rbx
+}
+  800248:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80024c:	5b                   	pop    %rbx
+  80024d:	41 5c                	pop    %r12
+  80024f:	41 5d                	pop    %r13
+  800251:	41 5e                	pop    %r14
+  800253:	41 5f                	pop    %r15
+  800255:	5d                   	pop    %rbp
+  800256:	c3                   	ret
+
+0000000000800257 <umain>:
+
+void
+umain(int argc, char *argv[]) {
+  800257:	55                   	push   %rbp
+  800258:	48 89 e5             	mov    %rsp,%rbp
+  80025b:	41 54                	push   %r12
+  80025d:	53                   	push   %rbx
+  80025e:	48 83 ec 10          	sub    $0x10,%rsp
+    envid_t ceid;
+    int pipefd[2];
+    int res;
+
+    memlayout();
+  800262:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800269:	00 00 00 
+  80026c:	ff d0                	call   *%rax
+
+    res = pipe(pipefd);
+  80026e:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+  800272:	48 b8 9f 27 80 00 00 	movabs $0x80279f,%rax
+  800279:	00 00 00 
+  80027c:	ff d0                	call   *%rax
+    if (res < 0) panic("pipe() failed\n");
+  80027e:	85 c0                	test   %eax,%eax
+  800280:	78 46                	js     8002c8 <umain+0x71>
+    ceid = fork();
+  800282:	48 b8 06 1a 80 00 00 	movabs $0x801a06,%rax
+  800289:	00 00 00 
+  80028c:	ff d0                	call   *%rax
+    if (ceid < 0) panic("fork() failed\n");
+  80028e:	85 c0                	test   %eax,%eax
+  800290:	78 60                	js     8002f2 <umain+0x9b>
+
+    if (!ceid) {
+  800292:	0f 84 84 00 00 00    	je     80031c <umain+0xc5>
+        cprintf("==== Child\n");
+        memlayout();
+        return;
+    }
+
+    cprintf("==== Parent\n");
+  800298:	48 bf 0b 30 80 00 00 	movabs $0x80300b,%rdi
+  80029f:	00 00 00 
+  8002a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a7:	48 ba 8f 05 80 00 00 	movabs $0x80058f,%rdx
+  8002ae:	00 00 00 
+  8002b1:	ff d2                	call   *%rdx
+    memlayout();
+  8002b3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002ba:	00 00 00 
+  8002bd:	ff d0                	call   *%rax
+}
+  8002bf:	48 83 c4 10          	add    $0x10,%rsp
+  8002c3:	5b                   	pop    %rbx
+  8002c4:	41 5c                	pop    %r12
+  8002c6:	5d                   	pop    %rbp
+  8002c7:	c3                   	ret
+    if (res < 0) panic("pipe() failed\n");
+  8002c8:	48 ba d0 2f 80 00 00 	movabs $0x802fd0,%rdx
+  8002cf:	00 00 00 
+  8002d2:	be 33 00 00 00       	mov    $0x33,%esi
+  8002d7:	48 bf df 2f 80 00 00 	movabs $0x802fdf,%rdi
+  8002de:	00 00 00 
+  8002e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e6:	48 b9 3f 04 80 00 00 	movabs $0x80043f,%rcx
+  8002ed:	00 00 00 
+  8002f0:	ff d1                	call   *%rcx
+    if (ceid < 0) panic("fork() failed\n");
+  8002f2:	48 ba f0 2f 80 00 00 	movabs $0x802ff0,%rdx
+  8002f9:	00 00 00 
+  8002fc:	be 35 00 00 00       	mov    $0x35,%esi
+  800301:	48 bf df 2f 80 00 00 	movabs $0x802fdf,%rdi
+  800308:	00 00 00 
+  80030b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800310:	48 b9 3f 04 80 00 00 	movabs $0x80043f,%rcx
+  800317:	00 00 00 
+  80031a:	ff d1                	call   *%rcx
+        cprintf("\n");
+  80031c:	48 bf 94 2f 80 00 00 	movabs $0x802f94,%rdi
+  800323:	00 00 00 
+  800326:	48 ba 8f 05 80 00 00 	movabs $0x80058f,%rdx
+  80032d:	00 00 00 
+  800330:	ff d2                	call   *%rdx
+  800332:	bb 00 90 01 00       	mov    $0x19000,%ebx
+            sys_yield();
+  800337:	49 bc d5 13 80 00 00 	movabs $0x8013d5,%r12
+  80033e:	00 00 00 
+  800341:	41 ff d4             	call   *%r12
+        for (i = 0; i < 102400; i++)
+  800344:	83 eb 01             	sub    $0x1,%ebx
+  800347:	75 f8                	jne    800341 <umain+0xea>
+        cprintf("==== Child\n");
+  800349:	48 bf ff 2f 80 00 00 	movabs $0x802fff,%rdi
+  800350:	00 00 00 
+  800353:	b8 00 00 00 00       	mov    $0x0,%eax
+  800358:	48 ba 8f 05 80 00 00 	movabs $0x80058f,%rdx
+  80035f:	00 00 00 
+  800362:	ff d2                	call   *%rdx
+        memlayout();
+  800364:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80036b:	00 00 00 
+  80036e:	ff d0                	call   *%rax
+        return;
+  800370:	e9 4a ff ff ff       	jmp    8002bf <umain+0x68>
+
+0000000000800375 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800375:	55                   	push   %rbp
+  800376:	48 89 e5             	mov    %rsp,%rbp
+  800379:	41 56                	push   %r14
+  80037b:	41 55                	push   %r13
+  80037d:	41 54                	push   %r12
+  80037f:	53                   	push   %rbx
+  800380:	41 89 fd             	mov    %edi,%r13d
+  800383:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800386:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80038d:	00 00 00 
+  800390:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800397:	00 00 00 
+  80039a:	48 39 c2             	cmp    %rax,%rdx
+  80039d:	73 17                	jae    8003b6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80039f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003a2:	49 89 c4             	mov    %rax,%r12
+  8003a5:	48 83 c3 08          	add    $0x8,%rbx
+  8003a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ae:	ff 53 f8             	call   *-0x8(%rbx)
+  8003b1:	4c 39 e3             	cmp    %r12,%rbx
+  8003b4:	72 ef                	jb     8003a5 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8003b6:	48 b8 a4 13 80 00 00 	movabs $0x8013a4,%rax
+  8003bd:	00 00 00 
+  8003c0:	ff d0                	call   *%rax
+  8003c2:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8003c5:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8003cc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003d3:	00 00 00 
+  8003d6:	48 01 d0             	add    %rdx,%rax
+  8003d9:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8003e0:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003e3:	45 85 ed             	test   %r13d,%r13d
+  8003e6:	7e 0d                	jle    8003f5 <libmain+0x80>
+  8003e8:	49 8b 06             	mov    (%r14),%rax
+  8003eb:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8003f2:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003f5:	4c 89 f6             	mov    %r14,%rsi
+  8003f8:	44 89 ef             	mov    %r13d,%edi
+  8003fb:	48 b8 57 02 80 00 00 	movabs $0x800257,%rax
+  800402:	00 00 00 
+  800405:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800407:	48 b8 1c 04 80 00 00 	movabs $0x80041c,%rax
+  80040e:	00 00 00 
+  800411:	ff d0                	call   *%rax
+#endif
+}
+  800413:	5b                   	pop    %rbx
+  800414:	41 5c                	pop    %r12
+  800416:	41 5d                	pop    %r13
+  800418:	41 5e                	pop    %r14
+  80041a:	5d                   	pop    %rbp
+  80041b:	c3                   	ret
+
+000000000080041c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80041c:	55                   	push   %rbp
+  80041d:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800420:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  800427:	00 00 00 
+  80042a:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80042c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800431:	48 b8 39 13 80 00 00 	movabs $0x801339,%rax
+  800438:	00 00 00 
+  80043b:	ff d0                	call   *%rax
+}
+  80043d:	5d                   	pop    %rbp
+  80043e:	c3                   	ret
+
+000000000080043f <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80043f:	55                   	push   %rbp
+  800440:	48 89 e5             	mov    %rsp,%rbp
+  800443:	41 56                	push   %r14
+  800445:	41 55                	push   %r13
+  800447:	41 54                	push   %r12
+  800449:	53                   	push   %rbx
+  80044a:	48 83 ec 50          	sub    $0x50,%rsp
+  80044e:	49 89 fc             	mov    %rdi,%r12
+  800451:	41 89 f5             	mov    %esi,%r13d
+  800454:	48 89 d3             	mov    %rdx,%rbx
+  800457:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80045b:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80045f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800463:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80046a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80046e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800472:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800476:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80047a:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800481:	00 00 00 
+  800484:	4c 8b 30             	mov    (%rax),%r14
+  800487:	48 b8 a4 13 80 00 00 	movabs $0x8013a4,%rax
+  80048e:	00 00 00 
+  800491:	ff d0                	call   *%rax
+  800493:	89 c6                	mov    %eax,%esi
+  800495:	45 89 e8             	mov    %r13d,%r8d
+  800498:	4c 89 e1             	mov    %r12,%rcx
+  80049b:	4c 89 f2             	mov    %r14,%rdx
+  80049e:	48 bf 78 30 80 00 00 	movabs $0x803078,%rdi
+  8004a5:	00 00 00 
+  8004a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ad:	49 bc 8f 05 80 00 00 	movabs $0x80058f,%r12
+  8004b4:	00 00 00 
+  8004b7:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004ba:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004be:	48 89 df             	mov    %rbx,%rdi
+  8004c1:	48 b8 2b 05 80 00 00 	movabs $0x80052b,%rax
+  8004c8:	00 00 00 
+  8004cb:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004cd:	48 bf 94 2f 80 00 00 	movabs $0x802f94,%rdi
+  8004d4:	00 00 00 
+  8004d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004dc:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004df:	cc                   	int3
+  8004e0:	eb fd                	jmp    8004df <_panic+0xa0>
+
+00000000008004e2 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004e2:	55                   	push   %rbp
+  8004e3:	48 89 e5             	mov    %rsp,%rbp
+  8004e6:	53                   	push   %rbx
+  8004e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8004eb:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004ee:	8b 06                	mov    (%rsi),%eax
+  8004f0:	8d 50 01             	lea    0x1(%rax),%edx
+  8004f3:	89 16                	mov    %edx,(%rsi)
+  8004f5:	48 98                	cltq
+  8004f7:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004fc:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800502:	74 0a                	je     80050e <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800504:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800508:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80050c:	c9                   	leave
+  80050d:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80050e:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800512:	be ff 00 00 00       	mov    $0xff,%esi
+  800517:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  80051e:	00 00 00 
+  800521:	ff d0                	call   *%rax
+        state->offset = 0;
+  800523:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800529:	eb d9                	jmp    800504 <putch+0x22>
+
+000000000080052b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80052b:	55                   	push   %rbp
+  80052c:	48 89 e5             	mov    %rsp,%rbp
+  80052f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800536:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800539:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800540:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800545:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80054d:	48 89 f1             	mov    %rsi,%rcx
+  800550:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800557:	48 bf e2 04 80 00 00 	movabs $0x8004e2,%rdi
+  80055e:	00 00 00 
+  800561:	48 b8 df 06 80 00 00 	movabs $0x8006df,%rax
+  800568:	00 00 00 
+  80056b:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80056d:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800574:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80057b:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  800582:	00 00 00 
+  800585:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800587:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80058d:	c9                   	leave
+  80058e:	c3                   	ret
+
+000000000080058f <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80058f:	55                   	push   %rbp
+  800590:	48 89 e5             	mov    %rsp,%rbp
+  800593:	48 83 ec 50          	sub    $0x50,%rsp
+  800597:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80059b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80059f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005a3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005a7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005ab:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005b2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005ba:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005be:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005c2:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005c6:	48 b8 2b 05 80 00 00 	movabs $0x80052b,%rax
+  8005cd:	00 00 00 
+  8005d0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005d2:	c9                   	leave
+  8005d3:	c3                   	ret
+
+00000000008005d4 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005d4:	55                   	push   %rbp
+  8005d5:	48 89 e5             	mov    %rsp,%rbp
+  8005d8:	41 57                	push   %r15
+  8005da:	41 56                	push   %r14
+  8005dc:	41 55                	push   %r13
+  8005de:	41 54                	push   %r12
+  8005e0:	53                   	push   %rbx
+  8005e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8005e5:	49 89 fc             	mov    %rdi,%r12
+  8005e8:	49 89 f5             	mov    %rsi,%r13
+  8005eb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005ef:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005f2:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005f5:	41 89 cf             	mov    %ecx,%r15d
+  8005f8:	4c 39 fa             	cmp    %r15,%rdx
+  8005fb:	73 5b                	jae    800658 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005fd:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800601:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800605:	85 db                	test   %ebx,%ebx
+  800607:	7e 0e                	jle    800617 <print_num+0x43>
+            putch(padc, put_arg);
+  800609:	4c 89 ee             	mov    %r13,%rsi
+  80060c:	44 89 f7             	mov    %r14d,%edi
+  80060f:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800612:	83 eb 01             	sub    $0x1,%ebx
+  800615:	75 f2                	jne    800609 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800617:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80061b:	48 b9 ac 30 80 00 00 	movabs $0x8030ac,%rcx
+  800622:	00 00 00 
+  800625:	48 b8 9b 30 80 00 00 	movabs $0x80309b,%rax
+  80062c:	00 00 00 
+  80062f:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800633:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800637:	ba 00 00 00 00       	mov    $0x0,%edx
+  80063c:	49 f7 f7             	div    %r15
+  80063f:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800643:	4c 89 ee             	mov    %r13,%rsi
+  800646:	41 ff d4             	call   *%r12
+}
+  800649:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80064d:	5b                   	pop    %rbx
+  80064e:	41 5c                	pop    %r12
+  800650:	41 5d                	pop    %r13
+  800652:	41 5e                	pop    %r14
+  800654:	41 5f                	pop    %r15
+  800656:	5d                   	pop    %rbp
+  800657:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800658:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80065c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800661:	49 f7 f7             	div    %r15
+  800664:	48 83 ec 08          	sub    $0x8,%rsp
+  800668:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80066c:	52                   	push   %rdx
+  80066d:	45 0f be c9          	movsbl %r9b,%r9d
+  800671:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800675:	48 89 c2             	mov    %rax,%rdx
+  800678:	48 b8 d4 05 80 00 00 	movabs $0x8005d4,%rax
+  80067f:	00 00 00 
+  800682:	ff d0                	call   *%rax
+  800684:	48 83 c4 10          	add    $0x10,%rsp
+  800688:	eb 8d                	jmp    800617 <print_num+0x43>
+
+000000000080068a <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80068a:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80068e:	48 8b 06             	mov    (%rsi),%rax
+  800691:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800695:	73 0a                	jae    8006a1 <sprintputch+0x17>
+        *state->start++ = ch;
+  800697:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80069b:	48 89 16             	mov    %rdx,(%rsi)
+  80069e:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006a1:	c3                   	ret
+
+00000000008006a2 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006a2:	55                   	push   %rbp
+  8006a3:	48 89 e5             	mov    %rsp,%rbp
+  8006a6:	48 83 ec 50          	sub    $0x50,%rsp
+  8006aa:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006ae:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006b2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006b6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006bd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006c9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006cd:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006d1:	48 b8 df 06 80 00 00 	movabs $0x8006df,%rax
+  8006d8:	00 00 00 
+  8006db:	ff d0                	call   *%rax
+}
+  8006dd:	c9                   	leave
+  8006de:	c3                   	ret
+
+00000000008006df <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006df:	55                   	push   %rbp
+  8006e0:	48 89 e5             	mov    %rsp,%rbp
+  8006e3:	41 57                	push   %r15
+  8006e5:	41 56                	push   %r14
+  8006e7:	41 55                	push   %r13
+  8006e9:	41 54                	push   %r12
+  8006eb:	53                   	push   %rbx
+  8006ec:	48 83 ec 38          	sub    $0x38,%rsp
+  8006f0:	49 89 fe             	mov    %rdi,%r14
+  8006f3:	49 89 f5             	mov    %rsi,%r13
+  8006f6:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006f9:	48 8b 01             	mov    (%rcx),%rax
+  8006fc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800700:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800704:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800708:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80070c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800710:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800714:	0f b6 3b             	movzbl (%rbx),%edi
+  800717:	40 80 ff 25          	cmp    $0x25,%dil
+  80071b:	74 18                	je     800735 <vprintfmt+0x56>
+            if (!ch) return;
+  80071d:	40 84 ff             	test   %dil,%dil
+  800720:	0f 84 b1 06 00 00    	je     800dd7 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800726:	40 0f b6 ff          	movzbl %dil,%edi
+  80072a:	4c 89 ee             	mov    %r13,%rsi
+  80072d:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800730:	4c 89 e3             	mov    %r12,%rbx
+  800733:	eb db                	jmp    800710 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800735:	be 00 00 00 00       	mov    $0x0,%esi
+  80073a:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80073e:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800743:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800749:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800750:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800754:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800759:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80075e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800761:	83 e8 23             	sub    $0x23,%eax
+  800764:	3c 57                	cmp    $0x57,%al
+  800766:	0f 87 51 06 00 00    	ja     800dbd <vprintfmt+0x6de>
+  80076c:	0f b6 c0             	movzbl %al,%eax
+  80076f:	48 b9 60 32 80 00 00 	movabs $0x803260,%rcx
+  800776:	00 00 00 
+  800779:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80077c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80077f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800783:	eb cf                	jmp    800754 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800785:	49 89 dc             	mov    %rbx,%r12
+  800788:	be 01 00 00 00       	mov    $0x1,%esi
+  80078d:	eb c5                	jmp    800754 <vprintfmt+0x75>
+            padc = ch;
+  80078f:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800793:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800796:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800799:	eb b9                	jmp    800754 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80079b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079e:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a1:	77 24                	ja     8007c7 <vprintfmt+0xe8>
+  8007a3:	89 c1                	mov    %eax,%ecx
+  8007a5:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007a9:	83 c0 08             	add    $0x8,%eax
+  8007ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007af:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007b2:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007b5:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007b9:	79 99                	jns    800754 <vprintfmt+0x75>
+                width = precision;
+  8007bb:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007bf:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007c5:	eb 8d                	jmp    800754 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007c7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007cb:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d3:	eb da                	jmp    8007af <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007d5:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007da:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007de:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007e4:	3c 39                	cmp    $0x39,%al
+  8007e6:	77 1c                	ja     800804 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007e8:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007ec:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007f0:	0f b6 c0             	movzbl %al,%eax
+  8007f3:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007f8:	0f b6 03             	movzbl (%rbx),%eax
+  8007fb:	3c 39                	cmp    $0x39,%al
+  8007fd:	76 e9                	jbe    8007e8 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007ff:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800802:	eb b1                	jmp    8007b5 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800804:	49 89 dc             	mov    %rbx,%r12
+  800807:	eb ac                	jmp    8007b5 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800809:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80080c:	85 c9                	test   %ecx,%ecx
+  80080e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800813:	0f 49 c1             	cmovns %ecx,%eax
+  800816:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800819:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80081c:	e9 33 ff ff ff       	jmp    800754 <vprintfmt+0x75>
+            lflag++;
+  800821:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800824:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800827:	e9 28 ff ff ff       	jmp    800754 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80082c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082f:	83 f8 2f             	cmp    $0x2f,%eax
+  800832:	77 19                	ja     80084d <vprintfmt+0x16e>
+  800834:	89 c2                	mov    %eax,%edx
+  800836:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083a:	83 c0 08             	add    $0x8,%eax
+  80083d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800840:	8b 3a                	mov    (%rdx),%edi
+  800842:	4c 89 ee             	mov    %r13,%rsi
+  800845:	41 ff d6             	call   *%r14
+            break;
+  800848:	e9 c3 fe ff ff       	jmp    800710 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80084d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800851:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800855:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800859:	eb e5                	jmp    800840 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80085b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80085e:	83 f8 2f             	cmp    $0x2f,%eax
+  800861:	77 5a                	ja     8008bd <vprintfmt+0x1de>
+  800863:	89 c2                	mov    %eax,%edx
+  800865:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800869:	83 c0 08             	add    $0x8,%eax
+  80086c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80086f:	8b 02                	mov    (%rdx),%eax
+  800871:	89 c1                	mov    %eax,%ecx
+  800873:	f7 d9                	neg    %ecx
+  800875:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800878:	83 f9 15             	cmp    $0x15,%ecx
+  80087b:	7f 4e                	jg     8008cb <vprintfmt+0x1ec>
+  80087d:	48 63 c1             	movslq %ecx,%rax
+  800880:	48 ba 20 35 80 00 00 	movabs $0x803520,%rdx
+  800887:	00 00 00 
+  80088a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80088e:	48 85 c0             	test   %rax,%rax
+  800891:	74 38                	je     8008cb <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800893:	48 89 c1             	mov    %rax,%rcx
+  800896:	48 ba 19 37 80 00 00 	movabs $0x803719,%rdx
+  80089d:	00 00 00 
+  8008a0:	4c 89 ee             	mov    %r13,%rsi
+  8008a3:	4c 89 f7             	mov    %r14,%rdi
+  8008a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ab:	49 b8 a2 06 80 00 00 	movabs $0x8006a2,%r8
+  8008b2:	00 00 00 
+  8008b5:	41 ff d0             	call   *%r8
+  8008b8:	e9 53 fe ff ff       	jmp    800710 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008bd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c9:	eb a4                	jmp    80086f <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008cb:	48 ba c4 30 80 00 00 	movabs $0x8030c4,%rdx
+  8008d2:	00 00 00 
+  8008d5:	4c 89 ee             	mov    %r13,%rsi
+  8008d8:	4c 89 f7             	mov    %r14,%rdi
+  8008db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e0:	49 b8 a2 06 80 00 00 	movabs $0x8006a2,%r8
+  8008e7:	00 00 00 
+  8008ea:	41 ff d0             	call   *%r8
+  8008ed:	e9 1e fe ff ff       	jmp    800710 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f8:	77 6c                	ja     800966 <vprintfmt+0x287>
+  8008fa:	89 c2                	mov    %eax,%edx
+  8008fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800900:	83 c0 08             	add    $0x8,%eax
+  800903:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800906:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800909:	48 85 d2             	test   %rdx,%rdx
+  80090c:	48 b8 bd 30 80 00 00 	movabs $0x8030bd,%rax
+  800913:	00 00 00 
+  800916:	48 0f 45 c2          	cmovne %rdx,%rax
+  80091a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80091e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800922:	7e 06                	jle    80092a <vprintfmt+0x24b>
+  800924:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800928:	75 4a                	jne    800974 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80092a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80092e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800932:	0f b6 00             	movzbl (%rax),%eax
+  800935:	84 c0                	test   %al,%al
+  800937:	0f 85 9a 00 00 00    	jne    8009d7 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80093d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800940:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800944:	85 c0                	test   %eax,%eax
+  800946:	0f 8e c4 fd ff ff    	jle    800710 <vprintfmt+0x31>
+  80094c:	4c 89 ee             	mov    %r13,%rsi
+  80094f:	bf 20 00 00 00       	mov    $0x20,%edi
+  800954:	41 ff d6             	call   *%r14
+  800957:	41 83 ec 01          	sub    $0x1,%r12d
+  80095b:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80095f:	75 eb                	jne    80094c <vprintfmt+0x26d>
+  800961:	e9 aa fd ff ff       	jmp    800710 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800966:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800972:	eb 92                	jmp    800906 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800974:	49 63 f7             	movslq %r15d,%rsi
+  800977:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80097b:	48 b8 91 0e 80 00 00 	movabs $0x800e91,%rax
+  800982:	00 00 00 
+  800985:	ff d0                	call   *%rax
+  800987:	48 89 c2             	mov    %rax,%rdx
+  80098a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80098d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80098f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800992:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800995:	85 c0                	test   %eax,%eax
+  800997:	7e 91                	jle    80092a <vprintfmt+0x24b>
+  800999:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80099e:	4c 89 ee             	mov    %r13,%rsi
+  8009a1:	44 89 e7             	mov    %r12d,%edi
+  8009a4:	41 ff d6             	call   *%r14
+  8009a7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009ab:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009ae:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009b1:	75 eb                	jne    80099e <vprintfmt+0x2bf>
+  8009b3:	e9 72 ff ff ff       	jmp    80092a <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009b8:	0f b6 f8             	movzbl %al,%edi
+  8009bb:	4c 89 ee             	mov    %r13,%rsi
+  8009be:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009c1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009c5:	49 83 c4 01          	add    $0x1,%r12
+  8009c9:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009cf:	84 c0                	test   %al,%al
+  8009d1:	0f 84 66 ff ff ff    	je     80093d <vprintfmt+0x25e>
+  8009d7:	45 85 ff             	test   %r15d,%r15d
+  8009da:	78 0a                	js     8009e6 <vprintfmt+0x307>
+  8009dc:	41 83 ef 01          	sub    $0x1,%r15d
+  8009e0:	0f 88 57 ff ff ff    	js     80093d <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009e6:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009ea:	74 cc                	je     8009b8 <vprintfmt+0x2d9>
+  8009ec:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009ef:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009f4:	80 fa 5e             	cmp    $0x5e,%dl
+  8009f7:	77 c2                	ja     8009bb <vprintfmt+0x2dc>
+  8009f9:	eb bd                	jmp    8009b8 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8009fb:	40 84 f6             	test   %sil,%sil
+  8009fe:	75 26                	jne    800a26 <vprintfmt+0x347>
+    switch (lflag) {
+  800a00:	85 d2                	test   %edx,%edx
+  800a02:	74 59                	je     800a5d <vprintfmt+0x37e>
+  800a04:	83 fa 01             	cmp    $0x1,%edx
+  800a07:	74 7b                	je     800a84 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0f:	0f 87 96 00 00 00    	ja     800aab <vprintfmt+0x3cc>
+  800a15:	89 c2                	mov    %eax,%edx
+  800a17:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1b:	83 c0 08             	add    $0x8,%eax
+  800a1e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a21:	4c 8b 22             	mov    (%rdx),%r12
+  800a24:	eb 17                	jmp    800a3d <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a29:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2c:	77 21                	ja     800a4f <vprintfmt+0x370>
+  800a2e:	89 c2                	mov    %eax,%edx
+  800a30:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a34:	83 c0 08             	add    $0x8,%eax
+  800a37:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3a:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a3d:	4d 85 e4             	test   %r12,%r12
+  800a40:	78 7a                	js     800abc <vprintfmt+0x3dd>
+            num = i;
+  800a42:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a45:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a4a:	e9 50 02 00 00       	jmp    800c9f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5b:	eb dd                	jmp    800a3a <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a60:	83 f8 2f             	cmp    $0x2f,%eax
+  800a63:	77 11                	ja     800a76 <vprintfmt+0x397>
+  800a65:	89 c2                	mov    %eax,%edx
+  800a67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6b:	83 c0 08             	add    $0x8,%eax
+  800a6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a71:	4c 63 22             	movslq (%rdx),%r12
+  800a74:	eb c7                	jmp    800a3d <vprintfmt+0x35e>
+  800a76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a82:	eb ed                	jmp    800a71 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a87:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8a:	77 11                	ja     800a9d <vprintfmt+0x3be>
+  800a8c:	89 c2                	mov    %eax,%edx
+  800a8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a92:	83 c0 08             	add    $0x8,%eax
+  800a95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a98:	4c 8b 22             	mov    (%rdx),%r12
+  800a9b:	eb a0                	jmp    800a3d <vprintfmt+0x35e>
+  800a9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa9:	eb ed                	jmp    800a98 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800aab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aaf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab7:	e9 65 ff ff ff       	jmp    800a21 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800abc:	4c 89 ee             	mov    %r13,%rsi
+  800abf:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ac4:	41 ff d6             	call   *%r14
+                i = -i;
+  800ac7:	49 f7 dc             	neg    %r12
+  800aca:	e9 73 ff ff ff       	jmp    800a42 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800acf:	40 84 f6             	test   %sil,%sil
+  800ad2:	75 32                	jne    800b06 <vprintfmt+0x427>
+    switch (lflag) {
+  800ad4:	85 d2                	test   %edx,%edx
+  800ad6:	74 5d                	je     800b35 <vprintfmt+0x456>
+  800ad8:	83 fa 01             	cmp    $0x1,%edx
+  800adb:	0f 84 82 00 00 00    	je     800b63 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800ae1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae7:	0f 87 a5 00 00 00    	ja     800b92 <vprintfmt+0x4b3>
+  800aed:	89 c2                	mov    %eax,%edx
+  800aef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af3:	83 c0 08             	add    $0x8,%eax
+  800af6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800afc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b01:	e9 99 01 00 00       	jmp    800c9f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b09:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0c:	77 19                	ja     800b27 <vprintfmt+0x448>
+  800b0e:	89 c2                	mov    %eax,%edx
+  800b10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b14:	83 c0 08             	add    $0x8,%eax
+  800b17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b1d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b22:	e9 78 01 00 00       	jmp    800c9f <vprintfmt+0x5c0>
+  800b27:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b2f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b33:	eb e5                	jmp    800b1a <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b35:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b38:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3b:	77 18                	ja     800b55 <vprintfmt+0x476>
+  800b3d:	89 c2                	mov    %eax,%edx
+  800b3f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b43:	83 c0 08             	add    $0x8,%eax
+  800b46:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b49:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b4b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b50:	e9 4a 01 00 00       	jmp    800c9f <vprintfmt+0x5c0>
+  800b55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b61:	eb e6                	jmp    800b49 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b66:	83 f8 2f             	cmp    $0x2f,%eax
+  800b69:	77 19                	ja     800b84 <vprintfmt+0x4a5>
+  800b6b:	89 c2                	mov    %eax,%edx
+  800b6d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b71:	83 c0 08             	add    $0x8,%eax
+  800b74:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b77:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b7a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b7f:	e9 1b 01 00 00       	jmp    800c9f <vprintfmt+0x5c0>
+  800b84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b90:	eb e5                	jmp    800b77 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b9e:	e9 56 ff ff ff       	jmp    800af9 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800ba3:	40 84 f6             	test   %sil,%sil
+  800ba6:	75 2e                	jne    800bd6 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800ba8:	85 d2                	test   %edx,%edx
+  800baa:	74 59                	je     800c05 <vprintfmt+0x526>
+  800bac:	83 fa 01             	cmp    $0x1,%edx
+  800baf:	74 7f                	je     800c30 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800bb1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb4:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb7:	0f 87 9f 00 00 00    	ja     800c5c <vprintfmt+0x57d>
+  800bbd:	89 c2                	mov    %eax,%edx
+  800bbf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc3:	83 c0 08             	add    $0x8,%eax
+  800bc6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bcc:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bd1:	e9 c9 00 00 00       	jmp    800c9f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bd6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bd9:	83 f8 2f             	cmp    $0x2f,%eax
+  800bdc:	77 19                	ja     800bf7 <vprintfmt+0x518>
+  800bde:	89 c2                	mov    %eax,%edx
+  800be0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be4:	83 c0 08             	add    $0x8,%eax
+  800be7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bea:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bed:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bf2:	e9 a8 00 00 00       	jmp    800c9f <vprintfmt+0x5c0>
+  800bf7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bfb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c03:	eb e5                	jmp    800bea <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c08:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0b:	77 15                	ja     800c22 <vprintfmt+0x543>
+  800c0d:	89 c2                	mov    %eax,%edx
+  800c0f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c13:	83 c0 08             	add    $0x8,%eax
+  800c16:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c19:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c1b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c20:	eb 7d                	jmp    800c9f <vprintfmt+0x5c0>
+  800c22:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c26:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2e:	eb e9                	jmp    800c19 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c33:	83 f8 2f             	cmp    $0x2f,%eax
+  800c36:	77 16                	ja     800c4e <vprintfmt+0x56f>
+  800c38:	89 c2                	mov    %eax,%edx
+  800c3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c3e:	83 c0 08             	add    $0x8,%eax
+  800c41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c44:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c47:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c4c:	eb 51                	jmp    800c9f <vprintfmt+0x5c0>
+  800c4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c5a:	eb e8                	jmp    800c44 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c68:	e9 5c ff ff ff       	jmp    800bc9 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c6d:	4c 89 ee             	mov    %r13,%rsi
+  800c70:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c75:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c78:	4c 89 ee             	mov    %r13,%rsi
+  800c7b:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c80:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c86:	83 f8 2f             	cmp    $0x2f,%eax
+  800c89:	77 47                	ja     800cd2 <vprintfmt+0x5f3>
+  800c8b:	89 c2                	mov    %eax,%edx
+  800c8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c91:	83 c0 08             	add    $0x8,%eax
+  800c94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c97:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c9a:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c9f:	48 83 ec 08          	sub    $0x8,%rsp
+  800ca3:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ca7:	0f 94 c0             	sete   %al
+  800caa:	0f b6 c0             	movzbl %al,%eax
+  800cad:	50                   	push   %rax
+  800cae:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800cb3:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800cb7:	4c 89 ee             	mov    %r13,%rsi
+  800cba:	4c 89 f7             	mov    %r14,%rdi
+  800cbd:	48 b8 d4 05 80 00 00 	movabs $0x8005d4,%rax
+  800cc4:	00 00 00 
+  800cc7:	ff d0                	call   *%rax
+            break;
+  800cc9:	48 83 c4 10          	add    $0x10,%rsp
+  800ccd:	e9 3e fa ff ff       	jmp    800710 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cd2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cd6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cde:	eb b7                	jmp    800c97 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ce0:	40 84 f6             	test   %sil,%sil
+  800ce3:	75 2b                	jne    800d10 <vprintfmt+0x631>
+    switch (lflag) {
+  800ce5:	85 d2                	test   %edx,%edx
+  800ce7:	74 56                	je     800d3f <vprintfmt+0x660>
+  800ce9:	83 fa 01             	cmp    $0x1,%edx
+  800cec:	74 7f                	je     800d6d <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800cee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf1:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf4:	0f 87 a2 00 00 00    	ja     800d9c <vprintfmt+0x6bd>
+  800cfa:	89 c2                	mov    %eax,%edx
+  800cfc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d00:	83 c0 08             	add    $0x8,%eax
+  800d03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d06:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d09:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d0e:	eb 8f                	jmp    800c9f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d13:	83 f8 2f             	cmp    $0x2f,%eax
+  800d16:	77 19                	ja     800d31 <vprintfmt+0x652>
+  800d18:	89 c2                	mov    %eax,%edx
+  800d1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d1e:	83 c0 08             	add    $0x8,%eax
+  800d21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d24:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d27:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d2c:	e9 6e ff ff ff       	jmp    800c9f <vprintfmt+0x5c0>
+  800d31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d3d:	eb e5                	jmp    800d24 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d42:	83 f8 2f             	cmp    $0x2f,%eax
+  800d45:	77 18                	ja     800d5f <vprintfmt+0x680>
+  800d47:	89 c2                	mov    %eax,%edx
+  800d49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d4d:	83 c0 08             	add    $0x8,%eax
+  800d50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d53:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d55:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d5a:	e9 40 ff ff ff       	jmp    800c9f <vprintfmt+0x5c0>
+  800d5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d63:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d6b:	eb e6                	jmp    800d53 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d70:	83 f8 2f             	cmp    $0x2f,%eax
+  800d73:	77 19                	ja     800d8e <vprintfmt+0x6af>
+  800d75:	89 c2                	mov    %eax,%edx
+  800d77:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d7b:	83 c0 08             	add    $0x8,%eax
+  800d7e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d81:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d84:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d89:	e9 11 ff ff ff       	jmp    800c9f <vprintfmt+0x5c0>
+  800d8e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d92:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d9a:	eb e5                	jmp    800d81 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800da0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800da4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800da8:	e9 59 ff ff ff       	jmp    800d06 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800dad:	4c 89 ee             	mov    %r13,%rsi
+  800db0:	bf 25 00 00 00       	mov    $0x25,%edi
+  800db5:	41 ff d6             	call   *%r14
+            break;
+  800db8:	e9 53 f9 ff ff       	jmp    800710 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800dbd:	4c 89 ee             	mov    %r13,%rsi
+  800dc0:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dc5:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800dc8:	48 83 eb 01          	sub    $0x1,%rbx
+  800dcc:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800dd0:	75 f6                	jne    800dc8 <vprintfmt+0x6e9>
+  800dd2:	e9 39 f9 ff ff       	jmp    800710 <vprintfmt+0x31>
+}
+  800dd7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ddb:	5b                   	pop    %rbx
+  800ddc:	41 5c                	pop    %r12
+  800dde:	41 5d                	pop    %r13
+  800de0:	41 5e                	pop    %r14
+  800de2:	41 5f                	pop    %r15
+  800de4:	5d                   	pop    %rbp
+  800de5:	c3                   	ret
+
+0000000000800de6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800de6:	55                   	push   %rbp
+  800de7:	48 89 e5             	mov    %rsp,%rbp
+  800dea:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800dee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800df2:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800df7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800dfb:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e02:	48 85 ff             	test   %rdi,%rdi
+  800e05:	74 2b                	je     800e32 <vsnprintf+0x4c>
+  800e07:	48 85 f6             	test   %rsi,%rsi
+  800e0a:	74 26                	je     800e32 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e0c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e10:	48 bf 8a 06 80 00 00 	movabs $0x80068a,%rdi
+  800e17:	00 00 00 
+  800e1a:	48 b8 df 06 80 00 00 	movabs $0x8006df,%rax
+  800e21:	00 00 00 
+  800e24:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e2a:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e2d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e30:	c9                   	leave
+  800e31:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e37:	eb f7                	jmp    800e30 <vsnprintf+0x4a>
+
+0000000000800e39 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e39:	55                   	push   %rbp
+  800e3a:	48 89 e5             	mov    %rsp,%rbp
+  800e3d:	48 83 ec 50          	sub    $0x50,%rsp
+  800e41:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e45:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e49:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e4d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e54:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e5c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e60:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e64:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e68:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  800e6f:	00 00 00 
+  800e72:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e74:	c9                   	leave
+  800e75:	c3                   	ret
+
+0000000000800e76 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e76:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e79:	74 10                	je     800e8b <strlen+0x15>
+    size_t n = 0;
+  800e7b:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e80:	48 83 c0 01          	add    $0x1,%rax
+  800e84:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e88:	75 f6                	jne    800e80 <strlen+0xa>
+  800e8a:	c3                   	ret
+    size_t n = 0;
+  800e8b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e90:	c3                   	ret
+
+0000000000800e91 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e91:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e94:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e99:	48 85 f6             	test   %rsi,%rsi
+  800e9c:	74 11                	je     800eaf <strnlen+0x1e>
+  800e9e:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ea2:	74 0c                	je     800eb0 <strnlen+0x1f>
+  800ea4:	48 83 c2 01          	add    $0x1,%rdx
+  800ea8:	48 39 d0             	cmp    %rdx,%rax
+  800eab:	75 f1                	jne    800e9e <strnlen+0xd>
+  800ead:	eb 04                	jmp    800eb3 <strnlen+0x22>
+  800eaf:	c3                   	ret
+  800eb0:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800eb3:	c3                   	ret
+
+0000000000800eb4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800eb4:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800eb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ebc:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ec0:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ec3:	48 83 c2 01          	add    $0x1,%rdx
+  800ec7:	84 c9                	test   %cl,%cl
+  800ec9:	75 f1                	jne    800ebc <strcpy+0x8>
+        ;
+    return res;
+}
+  800ecb:	c3                   	ret
+
+0000000000800ecc <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ecc:	55                   	push   %rbp
+  800ecd:	48 89 e5             	mov    %rsp,%rbp
+  800ed0:	41 54                	push   %r12
+  800ed2:	53                   	push   %rbx
+  800ed3:	48 89 fb             	mov    %rdi,%rbx
+  800ed6:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ed9:	48 b8 76 0e 80 00 00 	movabs $0x800e76,%rax
+  800ee0:	00 00 00 
+  800ee3:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ee5:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ee9:	4c 89 e6             	mov    %r12,%rsi
+  800eec:	48 b8 b4 0e 80 00 00 	movabs $0x800eb4,%rax
+  800ef3:	00 00 00 
+  800ef6:	ff d0                	call   *%rax
+    return dst;
+}
+  800ef8:	48 89 d8             	mov    %rbx,%rax
+  800efb:	5b                   	pop    %rbx
+  800efc:	41 5c                	pop    %r12
+  800efe:	5d                   	pop    %rbp
+  800eff:	c3                   	ret
+
+0000000000800f00 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f00:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f03:	48 85 d2             	test   %rdx,%rdx
+  800f06:	74 1f                	je     800f27 <strncpy+0x27>
+  800f08:	48 01 fa             	add    %rdi,%rdx
+  800f0b:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f0e:	48 83 c1 01          	add    $0x1,%rcx
+  800f12:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f16:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f1a:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f1e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f22:	48 39 ca             	cmp    %rcx,%rdx
+  800f25:	75 e7                	jne    800f0e <strncpy+0xe>
+    }
+    return ret;
+}
+  800f27:	c3                   	ret
+
+0000000000800f28 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f28:	48 89 f8             	mov    %rdi,%rax
+  800f2b:	48 85 d2             	test   %rdx,%rdx
+  800f2e:	74 24                	je     800f54 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f30:	48 83 ea 01          	sub    $0x1,%rdx
+  800f34:	74 1b                	je     800f51 <strlcpy+0x29>
+  800f36:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f3a:	0f b6 16             	movzbl (%rsi),%edx
+  800f3d:	84 d2                	test   %dl,%dl
+  800f3f:	74 10                	je     800f51 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f41:	48 83 c6 01          	add    $0x1,%rsi
+  800f45:	48 83 c0 01          	add    $0x1,%rax
+  800f49:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f4c:	48 39 c8             	cmp    %rcx,%rax
+  800f4f:	75 e9                	jne    800f3a <strlcpy+0x12>
+        *dst = '\0';
+  800f51:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f54:	48 29 f8             	sub    %rdi,%rax
+}
+  800f57:	c3                   	ret
+
+0000000000800f58 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f58:	0f b6 07             	movzbl (%rdi),%eax
+  800f5b:	84 c0                	test   %al,%al
+  800f5d:	74 13                	je     800f72 <strcmp+0x1a>
+  800f5f:	38 06                	cmp    %al,(%rsi)
+  800f61:	75 0f                	jne    800f72 <strcmp+0x1a>
+  800f63:	48 83 c7 01          	add    $0x1,%rdi
+  800f67:	48 83 c6 01          	add    $0x1,%rsi
+  800f6b:	0f b6 07             	movzbl (%rdi),%eax
+  800f6e:	84 c0                	test   %al,%al
+  800f70:	75 ed                	jne    800f5f <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f72:	0f b6 c0             	movzbl %al,%eax
+  800f75:	0f b6 16             	movzbl (%rsi),%edx
+  800f78:	29 d0                	sub    %edx,%eax
+}
+  800f7a:	c3                   	ret
+
+0000000000800f7b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f7b:	48 85 d2             	test   %rdx,%rdx
+  800f7e:	74 1f                	je     800f9f <strncmp+0x24>
+  800f80:	0f b6 07             	movzbl (%rdi),%eax
+  800f83:	84 c0                	test   %al,%al
+  800f85:	74 1e                	je     800fa5 <strncmp+0x2a>
+  800f87:	3a 06                	cmp    (%rsi),%al
+  800f89:	75 1a                	jne    800fa5 <strncmp+0x2a>
+  800f8b:	48 83 c7 01          	add    $0x1,%rdi
+  800f8f:	48 83 c6 01          	add    $0x1,%rsi
+  800f93:	48 83 ea 01          	sub    $0x1,%rdx
+  800f97:	75 e7                	jne    800f80 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f9e:	c3                   	ret
+  800f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa4:	c3                   	ret
+  800fa5:	48 85 d2             	test   %rdx,%rdx
+  800fa8:	74 09                	je     800fb3 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800faa:	0f b6 07             	movzbl (%rdi),%eax
+  800fad:	0f b6 16             	movzbl (%rsi),%edx
+  800fb0:	29 d0                	sub    %edx,%eax
+  800fb2:	c3                   	ret
+    if (!n) return 0;
+  800fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fb8:	c3                   	ret
+
+0000000000800fb9 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fb9:	0f b6 17             	movzbl (%rdi),%edx
+  800fbc:	84 d2                	test   %dl,%dl
+  800fbe:	74 18                	je     800fd8 <strchr+0x1f>
+        if (*str == c) {
+  800fc0:	0f be d2             	movsbl %dl,%edx
+  800fc3:	39 f2                	cmp    %esi,%edx
+  800fc5:	74 17                	je     800fde <strchr+0x25>
+    for (; *str; str++) {
+  800fc7:	48 83 c7 01          	add    $0x1,%rdi
+  800fcb:	0f b6 17             	movzbl (%rdi),%edx
+  800fce:	84 d2                	test   %dl,%dl
+  800fd0:	75 ee                	jne    800fc0 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800fd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd7:	c3                   	ret
+  800fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdd:	c3                   	ret
+  800fde:	48 89 f8             	mov    %rdi,%rax
+}
+  800fe1:	c3                   	ret
+
+0000000000800fe2 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fe2:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800fe5:	0f b6 17             	movzbl (%rdi),%edx
+  800fe8:	84 d2                	test   %dl,%dl
+  800fea:	74 13                	je     800fff <strfind+0x1d>
+  800fec:	0f be d2             	movsbl %dl,%edx
+  800fef:	39 f2                	cmp    %esi,%edx
+  800ff1:	74 0b                	je     800ffe <strfind+0x1c>
+  800ff3:	48 83 c0 01          	add    $0x1,%rax
+  800ff7:	0f b6 10             	movzbl (%rax),%edx
+  800ffa:	84 d2                	test   %dl,%dl
+  800ffc:	75 ee                	jne    800fec <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ffe:	c3                   	ret
+  800fff:	c3                   	ret
+
+0000000000801000 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801000:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801003:	48 89 f8             	mov    %rdi,%rax
+  801006:	48 f7 d8             	neg    %rax
+  801009:	83 e0 07             	and    $0x7,%eax
+  80100c:	49 89 d1             	mov    %rdx,%r9
+  80100f:	49 29 c1             	sub    %rax,%r9
+  801012:	78 36                	js     80104a <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801014:	40 0f b6 c6          	movzbl %sil,%eax
+  801018:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80101f:	01 01 01 
+  801022:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801026:	40 f6 c7 07          	test   $0x7,%dil
+  80102a:	75 38                	jne    801064 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80102c:	4c 89 c9             	mov    %r9,%rcx
+  80102f:	48 c1 f9 03          	sar    $0x3,%rcx
+  801033:	74 0c                	je     801041 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801035:	fc                   	cld
+  801036:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801039:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80103d:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801041:	4d 85 c9             	test   %r9,%r9
+  801044:	75 45                	jne    80108b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801046:	4c 89 c0             	mov    %r8,%rax
+  801049:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80104a:	48 85 d2             	test   %rdx,%rdx
+  80104d:	74 f7                	je     801046 <memset+0x46>
+  80104f:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801052:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801055:	48 83 c0 01          	add    $0x1,%rax
+  801059:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80105d:	48 39 c2             	cmp    %rax,%rdx
+  801060:	75 f3                	jne    801055 <memset+0x55>
+  801062:	eb e2                	jmp    801046 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801064:	40 f6 c7 01          	test   $0x1,%dil
+  801068:	74 06                	je     801070 <memset+0x70>
+  80106a:	88 07                	mov    %al,(%rdi)
+  80106c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801070:	40 f6 c7 02          	test   $0x2,%dil
+  801074:	74 07                	je     80107d <memset+0x7d>
+  801076:	66 89 07             	mov    %ax,(%rdi)
+  801079:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80107d:	40 f6 c7 04          	test   $0x4,%dil
+  801081:	74 a9                	je     80102c <memset+0x2c>
+  801083:	89 07                	mov    %eax,(%rdi)
+  801085:	48 83 c7 04          	add    $0x4,%rdi
+  801089:	eb a1                	jmp    80102c <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80108b:	41 f6 c1 04          	test   $0x4,%r9b
+  80108f:	74 06                	je     801097 <memset+0x97>
+  801091:	89 07                	mov    %eax,(%rdi)
+  801093:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801097:	41 f6 c1 02          	test   $0x2,%r9b
+  80109b:	74 07                	je     8010a4 <memset+0xa4>
+  80109d:	66 89 07             	mov    %ax,(%rdi)
+  8010a0:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010a4:	41 f6 c1 01          	test   $0x1,%r9b
+  8010a8:	74 9c                	je     801046 <memset+0x46>
+  8010aa:	88 07                	mov    %al,(%rdi)
+  8010ac:	eb 98                	jmp    801046 <memset+0x46>
+
+00000000008010ae <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010ae:	48 89 f8             	mov    %rdi,%rax
+  8010b1:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010b4:	48 39 fe             	cmp    %rdi,%rsi
+  8010b7:	73 3b                	jae    8010f4 <memmove+0x46>
+  8010b9:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010bd:	48 39 d7             	cmp    %rdx,%rdi
+  8010c0:	73 32                	jae    8010f4 <memmove+0x46>
+        s += n;
+        d += n;
+  8010c2:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010c6:	48 89 d6             	mov    %rdx,%rsi
+  8010c9:	48 09 fe             	or     %rdi,%rsi
+  8010cc:	48 09 ce             	or     %rcx,%rsi
+  8010cf:	40 f6 c6 07          	test   $0x7,%sil
+  8010d3:	75 12                	jne    8010e7 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010d5:	48 83 ef 08          	sub    $0x8,%rdi
+  8010d9:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010dd:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010e1:	fd                   	std
+  8010e2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010e5:	fc                   	cld
+  8010e6:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010e7:	48 83 ef 01          	sub    $0x1,%rdi
+  8010eb:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010ef:	fd                   	std
+  8010f0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010f2:	eb f1                	jmp    8010e5 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010f4:	48 89 f2             	mov    %rsi,%rdx
+  8010f7:	48 09 c2             	or     %rax,%rdx
+  8010fa:	48 09 ca             	or     %rcx,%rdx
+  8010fd:	f6 c2 07             	test   $0x7,%dl
+  801100:	75 0c                	jne    80110e <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801102:	48 c1 e9 03          	shr    $0x3,%rcx
+  801106:	48 89 c7             	mov    %rax,%rdi
+  801109:	fc                   	cld
+  80110a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80110d:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80110e:	48 89 c7             	mov    %rax,%rdi
+  801111:	fc                   	cld
+  801112:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801114:	c3                   	ret
+
+0000000000801115 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801115:	55                   	push   %rbp
+  801116:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801119:	48 b8 ae 10 80 00 00 	movabs $0x8010ae,%rax
+  801120:	00 00 00 
+  801123:	ff d0                	call   *%rax
+}
+  801125:	5d                   	pop    %rbp
+  801126:	c3                   	ret
+
+0000000000801127 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801127:	55                   	push   %rbp
+  801128:	48 89 e5             	mov    %rsp,%rbp
+  80112b:	41 57                	push   %r15
+  80112d:	41 56                	push   %r14
+  80112f:	41 55                	push   %r13
+  801131:	41 54                	push   %r12
+  801133:	53                   	push   %rbx
+  801134:	48 83 ec 08          	sub    $0x8,%rsp
+  801138:	49 89 fe             	mov    %rdi,%r14
+  80113b:	49 89 f7             	mov    %rsi,%r15
+  80113e:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801141:	48 89 f7             	mov    %rsi,%rdi
+  801144:	48 b8 76 0e 80 00 00 	movabs $0x800e76,%rax
+  80114b:	00 00 00 
+  80114e:	ff d0                	call   *%rax
+  801150:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801153:	48 89 de             	mov    %rbx,%rsi
+  801156:	4c 89 f7             	mov    %r14,%rdi
+  801159:	48 b8 91 0e 80 00 00 	movabs $0x800e91,%rax
+  801160:	00 00 00 
+  801163:	ff d0                	call   *%rax
+  801165:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801168:	48 39 c3             	cmp    %rax,%rbx
+  80116b:	74 36                	je     8011a3 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80116d:	48 89 d8             	mov    %rbx,%rax
+  801170:	4c 29 e8             	sub    %r13,%rax
+  801173:	49 39 c4             	cmp    %rax,%r12
+  801176:	73 31                	jae    8011a9 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801178:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80117d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801181:	4c 89 fe             	mov    %r15,%rsi
+  801184:	48 b8 15 11 80 00 00 	movabs $0x801115,%rax
+  80118b:	00 00 00 
+  80118e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801190:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801194:	48 83 c4 08          	add    $0x8,%rsp
+  801198:	5b                   	pop    %rbx
+  801199:	41 5c                	pop    %r12
+  80119b:	41 5d                	pop    %r13
+  80119d:	41 5e                	pop    %r14
+  80119f:	41 5f                	pop    %r15
+  8011a1:	5d                   	pop    %rbp
+  8011a2:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011a3:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011a7:	eb eb                	jmp    801194 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011a9:	48 83 eb 01          	sub    $0x1,%rbx
+  8011ad:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011b1:	48 89 da             	mov    %rbx,%rdx
+  8011b4:	4c 89 fe             	mov    %r15,%rsi
+  8011b7:	48 b8 15 11 80 00 00 	movabs $0x801115,%rax
+  8011be:	00 00 00 
+  8011c1:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011c3:	49 01 de             	add    %rbx,%r14
+  8011c6:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011cb:	eb c3                	jmp    801190 <strlcat+0x69>
+
+00000000008011cd <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011cd:	48 85 d2             	test   %rdx,%rdx
+  8011d0:	74 2d                	je     8011ff <memcmp+0x32>
+  8011d2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011d7:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011db:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011e0:	44 38 c1             	cmp    %r8b,%cl
+  8011e3:	75 0f                	jne    8011f4 <memcmp+0x27>
+    while (n-- > 0) {
+  8011e5:	48 83 c0 01          	add    $0x1,%rax
+  8011e9:	48 39 c2             	cmp    %rax,%rdx
+  8011ec:	75 e9                	jne    8011d7 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f3:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011f4:	0f b6 c1             	movzbl %cl,%eax
+  8011f7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011fb:	44 29 c0             	sub    %r8d,%eax
+  8011fe:	c3                   	ret
+    return 0;
+  8011ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801204:	c3                   	ret
+
+0000000000801205 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801205:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801209:	48 39 c7             	cmp    %rax,%rdi
+  80120c:	73 0f                	jae    80121d <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80120e:	40 38 37             	cmp    %sil,(%rdi)
+  801211:	74 0e                	je     801221 <memfind+0x1c>
+    for (; src < end; src++) {
+  801213:	48 83 c7 01          	add    $0x1,%rdi
+  801217:	48 39 f8             	cmp    %rdi,%rax
+  80121a:	75 f2                	jne    80120e <memfind+0x9>
+  80121c:	c3                   	ret
+  80121d:	48 89 f8             	mov    %rdi,%rax
+  801220:	c3                   	ret
+  801221:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801224:	c3                   	ret
+
+0000000000801225 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801225:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801228:	0f b6 37             	movzbl (%rdi),%esi
+  80122b:	40 80 fe 20          	cmp    $0x20,%sil
+  80122f:	74 06                	je     801237 <strtol+0x12>
+  801231:	40 80 fe 09          	cmp    $0x9,%sil
+  801235:	75 13                	jne    80124a <strtol+0x25>
+  801237:	48 83 c7 01          	add    $0x1,%rdi
+  80123b:	0f b6 37             	movzbl (%rdi),%esi
+  80123e:	40 80 fe 20          	cmp    $0x20,%sil
+  801242:	74 f3                	je     801237 <strtol+0x12>
+  801244:	40 80 fe 09          	cmp    $0x9,%sil
+  801248:	74 ed                	je     801237 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80124a:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80124d:	83 e0 fd             	and    $0xfffffffd,%eax
+  801250:	3c 01                	cmp    $0x1,%al
+  801252:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801256:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80125c:	75 0f                	jne    80126d <strtol+0x48>
+  80125e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801261:	74 14                	je     801277 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801263:	85 d2                	test   %edx,%edx
+  801265:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80126a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80126d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801272:	4c 63 ca             	movslq %edx,%r9
+  801275:	eb 36                	jmp    8012ad <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801277:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80127b:	74 0f                	je     80128c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80127d:	85 d2                	test   %edx,%edx
+  80127f:	75 ec                	jne    80126d <strtol+0x48>
+        s++;
+  801281:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801285:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80128a:	eb e1                	jmp    80126d <strtol+0x48>
+        s += 2;
+  80128c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801290:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801295:	eb d6                	jmp    80126d <strtol+0x48>
+            dig -= '0';
+  801297:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80129a:	44 0f b6 c1          	movzbl %cl,%r8d
+  80129e:	41 39 d0             	cmp    %edx,%r8d
+  8012a1:	7d 21                	jge    8012c4 <strtol+0x9f>
+        val = val * base + dig;
+  8012a3:	49 0f af c1          	imul   %r9,%rax
+  8012a7:	0f b6 c9             	movzbl %cl,%ecx
+  8012aa:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012ad:	48 83 c7 01          	add    $0x1,%rdi
+  8012b1:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012b5:	80 f9 39             	cmp    $0x39,%cl
+  8012b8:	76 dd                	jbe    801297 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012ba:	80 f9 7b             	cmp    $0x7b,%cl
+  8012bd:	77 05                	ja     8012c4 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012bf:	83 e9 57             	sub    $0x57,%ecx
+  8012c2:	eb d6                	jmp    80129a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012c4:	4d 85 d2             	test   %r10,%r10
+  8012c7:	74 03                	je     8012cc <strtol+0xa7>
+  8012c9:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012cc:	48 89 c2             	mov    %rax,%rdx
+  8012cf:	48 f7 da             	neg    %rdx
+  8012d2:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012d6:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012da:	c3                   	ret
+
+00000000008012db <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8012db:	55                   	push   %rbp
+  8012dc:	48 89 e5             	mov    %rsp,%rbp
+  8012df:	53                   	push   %rbx
+  8012e0:	48 89 fa             	mov    %rdi,%rdx
+  8012e3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e6:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801300:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801302:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801306:	c9                   	leave
+  801307:	c3                   	ret
+
+0000000000801308 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801308:	55                   	push   %rbp
+  801309:	48 89 e5             	mov    %rsp,%rbp
+  80130c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80130d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801312:	ba 00 00 00 00       	mov    $0x0,%edx
+  801317:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80131c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801321:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801326:	be 00 00 00 00       	mov    $0x0,%esi
+  80132b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801331:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801333:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801337:	c9                   	leave
+  801338:	c3                   	ret
+
+0000000000801339 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801339:	55                   	push   %rbp
+  80133a:	48 89 e5             	mov    %rsp,%rbp
+  80133d:	53                   	push   %rbx
+  80133e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801342:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801345:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80134a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80134f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801354:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801359:	be 00 00 00 00       	mov    $0x0,%esi
+  80135e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801364:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801366:	48 85 c0             	test   %rax,%rax
+  801369:	7f 06                	jg     801371 <sys_env_destroy+0x38>
+}
+  80136b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80136f:	c9                   	leave
+  801370:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801371:	49 89 c0             	mov    %rax,%r8
+  801374:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801379:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  801380:	00 00 00 
+  801383:	be 26 00 00 00       	mov    $0x26,%esi
+  801388:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  80138f:	00 00 00 
+  801392:	b8 00 00 00 00       	mov    $0x0,%eax
+  801397:	49 b9 3f 04 80 00 00 	movabs $0x80043f,%r9
+  80139e:	00 00 00 
+  8013a1:	41 ff d1             	call   *%r9
+
+00000000008013a4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8013a4:	55                   	push   %rbp
+  8013a5:	48 89 e5             	mov    %rsp,%rbp
+  8013a8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a9:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013cd:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d3:	c9                   	leave
+  8013d4:	c3                   	ret
+
+00000000008013d5 <sys_yield>:
+
+void
+sys_yield(void) {
+  8013d5:	55                   	push   %rbp
+  8013d6:	48 89 e5             	mov    %rsp,%rbp
+  8013d9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013da:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013fe:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801400:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801404:	c9                   	leave
+  801405:	c3                   	ret
+
+0000000000801406 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801406:	55                   	push   %rbp
+  801407:	48 89 e5             	mov    %rsp,%rbp
+  80140a:	53                   	push   %rbx
+  80140b:	48 89 fa             	mov    %rdi,%rdx
+  80140e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801411:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801416:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80141d:	00 00 00 
+  801420:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801425:	be 00 00 00 00       	mov    $0x0,%esi
+  80142a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801430:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801432:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801436:	c9                   	leave
+  801437:	c3                   	ret
+
+0000000000801438 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801438:	55                   	push   %rbp
+  801439:	48 89 e5             	mov    %rsp,%rbp
+  80143c:	53                   	push   %rbx
+  80143d:	49 89 f8             	mov    %rdi,%r8
+  801440:	48 89 d3             	mov    %rdx,%rbx
+  801443:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801446:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80144b:	4c 89 c2             	mov    %r8,%rdx
+  80144e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801451:	be 00 00 00 00       	mov    $0x0,%esi
+  801456:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80145c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80145e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801462:	c9                   	leave
+  801463:	c3                   	ret
+
+0000000000801464 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801464:	55                   	push   %rbp
+  801465:	48 89 e5             	mov    %rsp,%rbp
+  801468:	53                   	push   %rbx
+  801469:	48 83 ec 08          	sub    $0x8,%rsp
+  80146d:	89 f8                	mov    %edi,%eax
+  80146f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801472:	48 63 f9             	movslq %ecx,%rdi
+  801475:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801478:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80147d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801480:	be 00 00 00 00       	mov    $0x0,%esi
+  801485:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80148b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80148d:	48 85 c0             	test   %rax,%rax
+  801490:	7f 06                	jg     801498 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801492:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801496:	c9                   	leave
+  801497:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801498:	49 89 c0             	mov    %rax,%r8
+  80149b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8014a0:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  8014a7:	00 00 00 
+  8014aa:	be 26 00 00 00       	mov    $0x26,%esi
+  8014af:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  8014b6:	00 00 00 
+  8014b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014be:	49 b9 3f 04 80 00 00 	movabs $0x80043f,%r9
+  8014c5:	00 00 00 
+  8014c8:	41 ff d1             	call   *%r9
+
+00000000008014cb <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014cb:	55                   	push   %rbp
+  8014cc:	48 89 e5             	mov    %rsp,%rbp
+  8014cf:	53                   	push   %rbx
+  8014d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8014d4:	89 f8                	mov    %edi,%eax
+  8014d6:	49 89 f2             	mov    %rsi,%r10
+  8014d9:	48 89 cf             	mov    %rcx,%rdi
+  8014dc:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8014df:	48 63 da             	movslq %edx,%rbx
+  8014e2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e5:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ea:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ed:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8014f0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014f2:	48 85 c0             	test   %rax,%rax
+  8014f5:	7f 06                	jg     8014fd <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014fb:	c9                   	leave
+  8014fc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014fd:	49 89 c0             	mov    %rax,%r8
+  801500:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801505:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  80150c:	00 00 00 
+  80150f:	be 26 00 00 00       	mov    $0x26,%esi
+  801514:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  80151b:	00 00 00 
+  80151e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801523:	49 b9 3f 04 80 00 00 	movabs $0x80043f,%r9
+  80152a:	00 00 00 
+  80152d:	41 ff d1             	call   *%r9
+
+0000000000801530 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801530:	55                   	push   %rbp
+  801531:	48 89 e5             	mov    %rsp,%rbp
+  801534:	53                   	push   %rbx
+  801535:	48 83 ec 08          	sub    $0x8,%rsp
+  801539:	48 89 f1             	mov    %rsi,%rcx
+  80153c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80153f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801542:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801547:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80154c:	be 00 00 00 00       	mov    $0x0,%esi
+  801551:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801557:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801559:	48 85 c0             	test   %rax,%rax
+  80155c:	7f 06                	jg     801564 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80155e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801562:	c9                   	leave
+  801563:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801564:	49 89 c0             	mov    %rax,%r8
+  801567:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80156c:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  801573:	00 00 00 
+  801576:	be 26 00 00 00       	mov    $0x26,%esi
+  80157b:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  801582:	00 00 00 
+  801585:	b8 00 00 00 00       	mov    $0x0,%eax
+  80158a:	49 b9 3f 04 80 00 00 	movabs $0x80043f,%r9
+  801591:	00 00 00 
+  801594:	41 ff d1             	call   *%r9
+
+0000000000801597 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801597:	55                   	push   %rbp
+  801598:	48 89 e5             	mov    %rsp,%rbp
+  80159b:	53                   	push   %rbx
+  80159c:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a0:	89 f8                	mov    %edi,%eax
+  8015a2:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8015a5:	48 63 f9             	movslq %ecx,%rdi
+  8015a8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ab:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b0:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015c0:	48 85 c0             	test   %rax,%rax
+  8015c3:	7f 06                	jg     8015cb <sys_region_advise+0x34>
+}
+  8015c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c9:	c9                   	leave
+  8015ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015cb:	49 89 c0             	mov    %rax,%r8
+  8015ce:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8015d3:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  8015da:	00 00 00 
+  8015dd:	be 26 00 00 00       	mov    $0x26,%esi
+  8015e2:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  8015e9:	00 00 00 
+  8015ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f1:	49 b9 3f 04 80 00 00 	movabs $0x80043f,%r9
+  8015f8:	00 00 00 
+  8015fb:	41 ff d1             	call   *%r9
+
+00000000008015fe <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  8015fe:	55                   	push   %rbp
+  8015ff:	48 89 e5             	mov    %rsp,%rbp
+  801602:	53                   	push   %rbx
+  801603:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801607:	48 63 ce             	movslq %esi,%rcx
+  80160a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80160d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801612:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801617:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80161c:	be 00 00 00 00       	mov    $0x0,%esi
+  801621:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801627:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801629:	48 85 c0             	test   %rax,%rax
+  80162c:	7f 06                	jg     801634 <sys_env_set_nice+0x36>
+}
+  80162e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801632:	c9                   	leave
+  801633:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801634:	49 89 c0             	mov    %rax,%r8
+  801637:	b9 15 00 00 00       	mov    $0x15,%ecx
+  80163c:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  801643:	00 00 00 
+  801646:	be 26 00 00 00       	mov    $0x26,%esi
+  80164b:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  801652:	00 00 00 
+  801655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165a:	49 b9 3f 04 80 00 00 	movabs $0x80043f,%r9
+  801661:	00 00 00 
+  801664:	41 ff d1             	call   *%r9
+
+0000000000801667 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801667:	55                   	push   %rbp
+  801668:	48 89 e5             	mov    %rsp,%rbp
+  80166b:	53                   	push   %rbx
+  80166c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801670:	48 63 ce             	movslq %esi,%rcx
+  801673:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801676:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80167b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801680:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801685:	be 00 00 00 00       	mov    $0x0,%esi
+  80168a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801690:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801692:	48 85 c0             	test   %rax,%rax
+  801695:	7f 06                	jg     80169d <sys_env_set_status+0x36>
+}
+  801697:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80169b:	c9                   	leave
+  80169c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80169d:	49 89 c0             	mov    %rax,%r8
+  8016a0:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8016a5:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  8016ac:	00 00 00 
+  8016af:	be 26 00 00 00       	mov    $0x26,%esi
+  8016b4:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  8016bb:	00 00 00 
+  8016be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c3:	49 b9 3f 04 80 00 00 	movabs $0x80043f,%r9
+  8016ca:	00 00 00 
+  8016cd:	41 ff d1             	call   *%r9
+
+00000000008016d0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016d0:	55                   	push   %rbp
+  8016d1:	48 89 e5             	mov    %rsp,%rbp
+  8016d4:	53                   	push   %rbx
+  8016d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8016d9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016dc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016df:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016fb:	48 85 c0             	test   %rax,%rax
+  8016fe:	7f 06                	jg     801706 <sys_env_set_trapframe+0x36>
+}
+  801700:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801704:	c9                   	leave
+  801705:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801706:	49 89 c0             	mov    %rax,%r8
+  801709:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80170e:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  801715:	00 00 00 
+  801718:	be 26 00 00 00       	mov    $0x26,%esi
+  80171d:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  801724:	00 00 00 
+  801727:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172c:	49 b9 3f 04 80 00 00 	movabs $0x80043f,%r9
+  801733:	00 00 00 
+  801736:	41 ff d1             	call   *%r9
+
+0000000000801739 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801739:	55                   	push   %rbp
+  80173a:	48 89 e5             	mov    %rsp,%rbp
+  80173d:	53                   	push   %rbx
+  80173e:	48 83 ec 08          	sub    $0x8,%rsp
+  801742:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801745:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801748:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80174d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801752:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801757:	be 00 00 00 00       	mov    $0x0,%esi
+  80175c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801762:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801764:	48 85 c0             	test   %rax,%rax
+  801767:	7f 06                	jg     80176f <sys_env_set_pgfault_upcall+0x36>
+}
+  801769:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80176d:	c9                   	leave
+  80176e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80176f:	49 89 c0             	mov    %rax,%r8
+  801772:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801777:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  80177e:	00 00 00 
+  801781:	be 26 00 00 00       	mov    $0x26,%esi
+  801786:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  80178d:	00 00 00 
+  801790:	b8 00 00 00 00       	mov    $0x0,%eax
+  801795:	49 b9 3f 04 80 00 00 	movabs $0x80043f,%r9
+  80179c:	00 00 00 
+  80179f:	41 ff d1             	call   *%r9
+
+00000000008017a2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8017a2:	55                   	push   %rbp
+  8017a3:	48 89 e5             	mov    %rsp,%rbp
+  8017a6:	53                   	push   %rbx
+  8017a7:	89 f8                	mov    %edi,%eax
+  8017a9:	49 89 f1             	mov    %rsi,%r9
+  8017ac:	48 89 d3             	mov    %rdx,%rbx
+  8017af:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8017b2:	49 63 f0             	movslq %r8d,%rsi
+  8017b5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017b8:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017bd:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c6:	cd 30                	int    $0x30
+}
+  8017c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017cc:	c9                   	leave
+  8017cd:	c3                   	ret
+
+00000000008017ce <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8017ce:	55                   	push   %rbp
+  8017cf:	48 89 e5             	mov    %rsp,%rbp
+  8017d2:	53                   	push   %rbx
+  8017d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8017d7:	48 89 fa             	mov    %rdi,%rdx
+  8017da:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017dd:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017f9:	48 85 c0             	test   %rax,%rax
+  8017fc:	7f 06                	jg     801804 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801802:	c9                   	leave
+  801803:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801804:	49 89 c0             	mov    %rax,%r8
+  801807:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80180c:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  801813:	00 00 00 
+  801816:	be 26 00 00 00       	mov    $0x26,%esi
+  80181b:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  801822:	00 00 00 
+  801825:	b8 00 00 00 00       	mov    $0x0,%eax
+  80182a:	49 b9 3f 04 80 00 00 	movabs $0x80043f,%r9
+  801831:	00 00 00 
+  801834:	41 ff d1             	call   *%r9
+
+0000000000801837 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801837:	55                   	push   %rbp
+  801838:	48 89 e5             	mov    %rsp,%rbp
+  80183b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80183c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801841:	ba 00 00 00 00       	mov    $0x0,%edx
+  801846:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80184b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801850:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801855:	be 00 00 00 00       	mov    $0x0,%esi
+  80185a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801860:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801862:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801866:	c9                   	leave
+  801867:	c3                   	ret
+
+0000000000801868 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  801868:	55                   	push   %rbp
+  801869:	48 89 e5             	mov    %rsp,%rbp
+  80186c:	53                   	push   %rbx
+  80186d:	48 83 ec 08          	sub    $0x8,%rsp
+  801871:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801874:	48 63 ce             	movslq %esi,%rcx
+  801877:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80187a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80187f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801884:	be 00 00 00 00       	mov    $0x0,%esi
+  801889:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80188f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801891:	48 85 c0             	test   %rax,%rax
+  801894:	7f 06                	jg     80189c <sys_sigqueue+0x34>
+}
+  801896:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80189a:	c9                   	leave
+  80189b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80189c:	49 89 c0             	mov    %rax,%r8
+  80189f:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8018a4:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  8018ab:	00 00 00 
+  8018ae:	be 26 00 00 00       	mov    $0x26,%esi
+  8018b3:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  8018ba:	00 00 00 
+  8018bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c2:	49 b9 3f 04 80 00 00 	movabs $0x80043f,%r9
+  8018c9:	00 00 00 
+  8018cc:	41 ff d1             	call   *%r9
+
+00000000008018cf <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8018cf:	55                   	push   %rbp
+  8018d0:	48 89 e5             	mov    %rsp,%rbp
+  8018d3:	53                   	push   %rbx
+  8018d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8018d8:	48 89 fa             	mov    %rdi,%rdx
+  8018db:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018de:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018f8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018fa:	48 85 c0             	test   %rax,%rax
+  8018fd:	7f 06                	jg     801905 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  8018ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801903:	c9                   	leave
+  801904:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801905:	49 89 c0             	mov    %rax,%r8
+  801908:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80190d:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  801914:	00 00 00 
+  801917:	be 26 00 00 00       	mov    $0x26,%esi
+  80191c:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  801923:	00 00 00 
+  801926:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192b:	49 b9 3f 04 80 00 00 	movabs $0x80043f,%r9
+  801932:	00 00 00 
+  801935:	41 ff d1             	call   *%r9
+
+0000000000801938 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801938:	55                   	push   %rbp
+  801939:	48 89 e5             	mov    %rsp,%rbp
+  80193c:	53                   	push   %rbx
+  80193d:	48 83 ec 08          	sub    $0x8,%rsp
+  801941:	48 89 f1             	mov    %rsi,%rcx
+  801944:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801947:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80194a:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80194f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801954:	be 00 00 00 00       	mov    $0x0,%esi
+  801959:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80195f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801961:	48 85 c0             	test   %rax,%rax
+  801964:	7f 06                	jg     80196c <sys_sigaction+0x34>
+}
+  801966:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80196a:	c9                   	leave
+  80196b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80196c:	49 89 c0             	mov    %rax,%r8
+  80196f:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801974:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  80197b:	00 00 00 
+  80197e:	be 26 00 00 00       	mov    $0x26,%esi
+  801983:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  80198a:	00 00 00 
+  80198d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801992:	49 b9 3f 04 80 00 00 	movabs $0x80043f,%r9
+  801999:	00 00 00 
+  80199c:	41 ff d1             	call   *%r9
+
+000000000080199f <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  80199f:	55                   	push   %rbp
+  8019a0:	48 89 e5             	mov    %rsp,%rbp
+  8019a3:	53                   	push   %rbx
+  8019a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8019a8:	48 89 f1             	mov    %rsi,%rcx
+  8019ab:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8019ae:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019b1:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8019c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019c6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019c8:	48 85 c0             	test   %rax,%rax
+  8019cb:	7f 06                	jg     8019d3 <sys_sigprocmask+0x34>
+}
+  8019cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019d1:	c9                   	leave
+  8019d2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019d3:	49 89 c0             	mov    %rax,%r8
+  8019d6:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8019db:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  8019e2:	00 00 00 
+  8019e5:	be 26 00 00 00       	mov    $0x26,%esi
+  8019ea:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  8019f1:	00 00 00 
+  8019f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f9:	49 b9 3f 04 80 00 00 	movabs $0x80043f,%r9
+  801a00:	00 00 00 
+  801a03:	41 ff d1             	call   *%r9
+
+0000000000801a06 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801a06:	55                   	push   %rbp
+  801a07:	48 89 e5             	mov    %rsp,%rbp
+  801a0a:	41 54                	push   %r12
+  801a0c:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801a0d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a12:	cd 30                	int    $0x30
+  801a14:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  801a17:	85 c0                	test   %eax,%eax
+  801a19:	78 76                	js     801a91 <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  801a1b:	74 7c                	je     801a99 <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  801a1d:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801a23:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801a2a:	00 00 00 
+  801a2d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a32:	89 c2                	mov    %eax,%edx
+  801a34:	be 00 00 00 00       	mov    $0x0,%esi
+  801a39:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a3e:	48 b8 cb 14 80 00 00 	movabs $0x8014cb,%rax
+  801a45:	00 00 00 
+  801a48:	ff d0                	call   *%rax
+  801a4a:	85 c0                	test   %eax,%eax
+  801a4c:	75 7a                	jne    801ac8 <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  801a4e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a55:	00 00 00 
+  801a58:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801a5f:	44 89 e7             	mov    %r12d,%edi
+  801a62:	48 b8 39 17 80 00 00 	movabs $0x801739,%rax
+  801a69:	00 00 00 
+  801a6c:	ff d0                	call   *%rax
+  801a6e:	85 c0                	test   %eax,%eax
+  801a70:	75 5e                	jne    801ad0 <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  801a72:	be 02 00 00 00       	mov    $0x2,%esi
+  801a77:	44 89 e7             	mov    %r12d,%edi
+  801a7a:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  801a81:	00 00 00 
+  801a84:	ff d0                	call   *%rax
+        return -1;
+  801a86:	85 c0                	test   %eax,%eax
+  801a88:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801a8d:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  801a91:	44 89 e0             	mov    %r12d,%eax
+  801a94:	5b                   	pop    %rbx
+  801a95:	41 5c                	pop    %r12
+  801a97:	5d                   	pop    %rbp
+  801a98:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  801a99:	48 b8 a4 13 80 00 00 	movabs $0x8013a4,%rax
+  801aa0:	00 00 00 
+  801aa3:	ff d0                	call   *%rax
+  801aa5:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  801aa8:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  801aaf:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801ab6:	00 00 00 
+  801ab9:	48 01 d0             	add    %rdx,%rax
+  801abc:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  801ac3:	00 00 00 
+        return 0;
+  801ac6:	eb c9                	jmp    801a91 <fork+0x8b>
+        return -1;
+  801ac8:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801ace:	eb c1                	jmp    801a91 <fork+0x8b>
+        return -1;
+  801ad0:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801ad6:	eb b9                	jmp    801a91 <fork+0x8b>
+
+0000000000801ad8 <sfork>:
+
+envid_t
+sfork() {
+  801ad8:	55                   	push   %rbp
+  801ad9:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801adc:	48 ba 1d 36 80 00 00 	movabs $0x80361d,%rdx
+  801ae3:	00 00 00 
+  801ae6:	be 2e 00 00 00       	mov    $0x2e,%esi
+  801aeb:	48 bf 38 36 80 00 00 	movabs $0x803638,%rdi
+  801af2:	00 00 00 
+  801af5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afa:	48 b9 3f 04 80 00 00 	movabs $0x80043f,%rcx
+  801b01:	00 00 00 
+  801b04:	ff d1                	call   *%rcx
+
+0000000000801b06 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b06:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b0d:	ff ff ff 
+  801b10:	48 01 f8             	add    %rdi,%rax
+  801b13:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801b17:	c3                   	ret
+
+0000000000801b18 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b18:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b1f:	ff ff ff 
+  801b22:	48 01 f8             	add    %rdi,%rax
+  801b25:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801b29:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801b2f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801b33:	c3                   	ret
+
+0000000000801b34 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801b34:	55                   	push   %rbp
+  801b35:	48 89 e5             	mov    %rsp,%rbp
+  801b38:	41 57                	push   %r15
+  801b3a:	41 56                	push   %r14
+  801b3c:	41 55                	push   %r13
+  801b3e:	41 54                	push   %r12
+  801b40:	53                   	push   %rbx
+  801b41:	48 83 ec 08          	sub    $0x8,%rsp
+  801b45:	49 89 ff             	mov    %rdi,%r15
+  801b48:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801b4d:	49 bd b2 2a 80 00 00 	movabs $0x802ab2,%r13
+  801b54:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801b57:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801b5d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801b60:	48 89 df             	mov    %rbx,%rdi
+  801b63:	41 ff d5             	call   *%r13
+  801b66:	83 e0 04             	and    $0x4,%eax
+  801b69:	74 17                	je     801b82 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801b6b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b72:	4c 39 f3             	cmp    %r14,%rbx
+  801b75:	75 e6                	jne    801b5d <fd_alloc+0x29>
+  801b77:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801b7d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801b82:	4d 89 27             	mov    %r12,(%r15)
+}
+  801b85:	48 83 c4 08          	add    $0x8,%rsp
+  801b89:	5b                   	pop    %rbx
+  801b8a:	41 5c                	pop    %r12
+  801b8c:	41 5d                	pop    %r13
+  801b8e:	41 5e                	pop    %r14
+  801b90:	41 5f                	pop    %r15
+  801b92:	5d                   	pop    %rbp
+  801b93:	c3                   	ret
+
+0000000000801b94 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801b94:	83 ff 1f             	cmp    $0x1f,%edi
+  801b97:	77 39                	ja     801bd2 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801b99:	55                   	push   %rbp
+  801b9a:	48 89 e5             	mov    %rsp,%rbp
+  801b9d:	41 54                	push   %r12
+  801b9f:	53                   	push   %rbx
+  801ba0:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ba3:	48 63 df             	movslq %edi,%rbx
+  801ba6:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801bad:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801bb1:	48 89 df             	mov    %rbx,%rdi
+  801bb4:	48 b8 b2 2a 80 00 00 	movabs $0x802ab2,%rax
+  801bbb:	00 00 00 
+  801bbe:	ff d0                	call   *%rax
+  801bc0:	a8 04                	test   $0x4,%al
+  801bc2:	74 14                	je     801bd8 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801bc4:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801bc8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bcd:	5b                   	pop    %rbx
+  801bce:	41 5c                	pop    %r12
+  801bd0:	5d                   	pop    %rbp
+  801bd1:	c3                   	ret
+        return -E_INVAL;
+  801bd2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801bd7:	c3                   	ret
+        return -E_INVAL;
+  801bd8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bdd:	eb ee                	jmp    801bcd <fd_lookup+0x39>
+
+0000000000801bdf <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801bdf:	55                   	push   %rbp
+  801be0:	48 89 e5             	mov    %rsp,%rbp
+  801be3:	41 54                	push   %r12
+  801be5:	53                   	push   %rbx
+  801be6:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801be9:	48 b8 e0 36 80 00 00 	movabs $0x8036e0,%rax
+  801bf0:	00 00 00 
+  801bf3:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801bfa:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801bfd:	39 3b                	cmp    %edi,(%rbx)
+  801bff:	74 47                	je     801c48 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c01:	48 83 c0 08          	add    $0x8,%rax
+  801c05:	48 8b 18             	mov    (%rax),%rbx
+  801c08:	48 85 db             	test   %rbx,%rbx
+  801c0b:	75 f0                	jne    801bfd <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c0d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c14:	00 00 00 
+  801c17:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c1d:	89 fa                	mov    %edi,%edx
+  801c1f:	48 bf 48 36 80 00 00 	movabs $0x803648,%rdi
+  801c26:	00 00 00 
+  801c29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2e:	48 b9 8f 05 80 00 00 	movabs $0x80058f,%rcx
+  801c35:	00 00 00 
+  801c38:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801c3a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801c3f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801c43:	5b                   	pop    %rbx
+  801c44:	41 5c                	pop    %r12
+  801c46:	5d                   	pop    %rbp
+  801c47:	c3                   	ret
+            return 0;
+  801c48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c4d:	eb f0                	jmp    801c3f <dev_lookup+0x60>
+
+0000000000801c4f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801c4f:	55                   	push   %rbp
+  801c50:	48 89 e5             	mov    %rsp,%rbp
+  801c53:	41 55                	push   %r13
+  801c55:	41 54                	push   %r12
+  801c57:	53                   	push   %rbx
+  801c58:	48 83 ec 18          	sub    $0x18,%rsp
+  801c5c:	48 89 fb             	mov    %rdi,%rbx
+  801c5f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c62:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801c69:	ff ff ff 
+  801c6c:	48 01 df             	add    %rbx,%rdi
+  801c6f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801c73:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c77:	48 b8 94 1b 80 00 00 	movabs $0x801b94,%rax
+  801c7e:	00 00 00 
+  801c81:	ff d0                	call   *%rax
+  801c83:	41 89 c5             	mov    %eax,%r13d
+  801c86:	85 c0                	test   %eax,%eax
+  801c88:	78 06                	js     801c90 <fd_close+0x41>
+  801c8a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801c8e:	74 1a                	je     801caa <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801c90:	45 84 e4             	test   %r12b,%r12b
+  801c93:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c98:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801c9c:	44 89 e8             	mov    %r13d,%eax
+  801c9f:	48 83 c4 18          	add    $0x18,%rsp
+  801ca3:	5b                   	pop    %rbx
+  801ca4:	41 5c                	pop    %r12
+  801ca6:	41 5d                	pop    %r13
+  801ca8:	5d                   	pop    %rbp
+  801ca9:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801caa:	8b 3b                	mov    (%rbx),%edi
+  801cac:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cb0:	48 b8 df 1b 80 00 00 	movabs $0x801bdf,%rax
+  801cb7:	00 00 00 
+  801cba:	ff d0                	call   *%rax
+  801cbc:	41 89 c5             	mov    %eax,%r13d
+  801cbf:	85 c0                	test   %eax,%eax
+  801cc1:	78 1b                	js     801cde <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801cc3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cc7:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801ccb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801cd1:	48 85 c0             	test   %rax,%rax
+  801cd4:	74 08                	je     801cde <fd_close+0x8f>
+  801cd6:	48 89 df             	mov    %rbx,%rdi
+  801cd9:	ff d0                	call   *%rax
+  801cdb:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801cde:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ce3:	48 89 de             	mov    %rbx,%rsi
+  801ce6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ceb:	48 b8 30 15 80 00 00 	movabs $0x801530,%rax
+  801cf2:	00 00 00 
+  801cf5:	ff d0                	call   *%rax
+    return res;
+  801cf7:	eb a3                	jmp    801c9c <fd_close+0x4d>
+
+0000000000801cf9 <close>:
+
+int
+close(int fdnum) {
+  801cf9:	55                   	push   %rbp
+  801cfa:	48 89 e5             	mov    %rsp,%rbp
+  801cfd:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d01:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d05:	48 b8 94 1b 80 00 00 	movabs $0x801b94,%rax
+  801d0c:	00 00 00 
+  801d0f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d11:	85 c0                	test   %eax,%eax
+  801d13:	78 15                	js     801d2a <close+0x31>
+
+    return fd_close(fd, 1);
+  801d15:	be 01 00 00 00       	mov    $0x1,%esi
+  801d1a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801d1e:	48 b8 4f 1c 80 00 00 	movabs $0x801c4f,%rax
+  801d25:	00 00 00 
+  801d28:	ff d0                	call   *%rax
+}
+  801d2a:	c9                   	leave
+  801d2b:	c3                   	ret
+
+0000000000801d2c <close_all>:
+
+void
+close_all(void) {
+  801d2c:	55                   	push   %rbp
+  801d2d:	48 89 e5             	mov    %rsp,%rbp
+  801d30:	41 54                	push   %r12
+  801d32:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801d33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d38:	49 bc f9 1c 80 00 00 	movabs $0x801cf9,%r12
+  801d3f:	00 00 00 
+  801d42:	89 df                	mov    %ebx,%edi
+  801d44:	41 ff d4             	call   *%r12
+  801d47:	83 c3 01             	add    $0x1,%ebx
+  801d4a:	83 fb 20             	cmp    $0x20,%ebx
+  801d4d:	75 f3                	jne    801d42 <close_all+0x16>
+}
+  801d4f:	5b                   	pop    %rbx
+  801d50:	41 5c                	pop    %r12
+  801d52:	5d                   	pop    %rbp
+  801d53:	c3                   	ret
+
+0000000000801d54 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801d54:	55                   	push   %rbp
+  801d55:	48 89 e5             	mov    %rsp,%rbp
+  801d58:	41 57                	push   %r15
+  801d5a:	41 56                	push   %r14
+  801d5c:	41 55                	push   %r13
+  801d5e:	41 54                	push   %r12
+  801d60:	53                   	push   %rbx
+  801d61:	48 83 ec 18          	sub    $0x18,%rsp
+  801d65:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801d68:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801d6c:	48 b8 94 1b 80 00 00 	movabs $0x801b94,%rax
+  801d73:	00 00 00 
+  801d76:	ff d0                	call   *%rax
+  801d78:	89 c3                	mov    %eax,%ebx
+  801d7a:	85 c0                	test   %eax,%eax
+  801d7c:	0f 88 b8 00 00 00    	js     801e3a <dup+0xe6>
+    close(newfdnum);
+  801d82:	44 89 e7             	mov    %r12d,%edi
+  801d85:	48 b8 f9 1c 80 00 00 	movabs $0x801cf9,%rax
+  801d8c:	00 00 00 
+  801d8f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801d91:	4d 63 ec             	movslq %r12d,%r13
+  801d94:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801d9b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801d9f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801da3:	4c 89 ff             	mov    %r15,%rdi
+  801da6:	49 be 18 1b 80 00 00 	movabs $0x801b18,%r14
+  801dad:	00 00 00 
+  801db0:	41 ff d6             	call   *%r14
+  801db3:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801db6:	4c 89 ef             	mov    %r13,%rdi
+  801db9:	41 ff d6             	call   *%r14
+  801dbc:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801dbf:	48 89 df             	mov    %rbx,%rdi
+  801dc2:	48 b8 b2 2a 80 00 00 	movabs $0x802ab2,%rax
+  801dc9:	00 00 00 
+  801dcc:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801dce:	a8 04                	test   $0x4,%al
+  801dd0:	74 2b                	je     801dfd <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801dd2:	41 89 c1             	mov    %eax,%r9d
+  801dd5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ddb:	4c 89 f1             	mov    %r14,%rcx
+  801dde:	ba 00 00 00 00       	mov    $0x0,%edx
+  801de3:	48 89 de             	mov    %rbx,%rsi
+  801de6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801deb:	48 b8 cb 14 80 00 00 	movabs $0x8014cb,%rax
+  801df2:	00 00 00 
+  801df5:	ff d0                	call   *%rax
+  801df7:	89 c3                	mov    %eax,%ebx
+  801df9:	85 c0                	test   %eax,%eax
+  801dfb:	78 4e                	js     801e4b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801dfd:	4c 89 ff             	mov    %r15,%rdi
+  801e00:	48 b8 b2 2a 80 00 00 	movabs $0x802ab2,%rax
+  801e07:	00 00 00 
+  801e0a:	ff d0                	call   *%rax
+  801e0c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801e0f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e15:	4c 89 e9             	mov    %r13,%rcx
+  801e18:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e1d:	4c 89 fe             	mov    %r15,%rsi
+  801e20:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e25:	48 b8 cb 14 80 00 00 	movabs $0x8014cb,%rax
+  801e2c:	00 00 00 
+  801e2f:	ff d0                	call   *%rax
+  801e31:	89 c3                	mov    %eax,%ebx
+  801e33:	85 c0                	test   %eax,%eax
+  801e35:	78 14                	js     801e4b <dup+0xf7>
+
+    return newfdnum;
+  801e37:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801e3a:	89 d8                	mov    %ebx,%eax
+  801e3c:	48 83 c4 18          	add    $0x18,%rsp
+  801e40:	5b                   	pop    %rbx
+  801e41:	41 5c                	pop    %r12
+  801e43:	41 5d                	pop    %r13
+  801e45:	41 5e                	pop    %r14
+  801e47:	41 5f                	pop    %r15
+  801e49:	5d                   	pop    %rbp
+  801e4a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801e4b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e50:	4c 89 ee             	mov    %r13,%rsi
+  801e53:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e58:	49 bc 30 15 80 00 00 	movabs $0x801530,%r12
+  801e5f:	00 00 00 
+  801e62:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801e65:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e6a:	4c 89 f6             	mov    %r14,%rsi
+  801e6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e72:	41 ff d4             	call   *%r12
+    return res;
+  801e75:	eb c3                	jmp    801e3a <dup+0xe6>
+
+0000000000801e77 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801e77:	55                   	push   %rbp
+  801e78:	48 89 e5             	mov    %rsp,%rbp
+  801e7b:	41 56                	push   %r14
+  801e7d:	41 55                	push   %r13
+  801e7f:	41 54                	push   %r12
+  801e81:	53                   	push   %rbx
+  801e82:	48 83 ec 10          	sub    $0x10,%rsp
+  801e86:	89 fb                	mov    %edi,%ebx
+  801e88:	49 89 f4             	mov    %rsi,%r12
+  801e8b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e8e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e92:	48 b8 94 1b 80 00 00 	movabs $0x801b94,%rax
+  801e99:	00 00 00 
+  801e9c:	ff d0                	call   *%rax
+  801e9e:	85 c0                	test   %eax,%eax
+  801ea0:	78 4c                	js     801eee <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ea2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ea6:	41 8b 3e             	mov    (%r14),%edi
+  801ea9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ead:	48 b8 df 1b 80 00 00 	movabs $0x801bdf,%rax
+  801eb4:	00 00 00 
+  801eb7:	ff d0                	call   *%rax
+  801eb9:	85 c0                	test   %eax,%eax
+  801ebb:	78 35                	js     801ef2 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ebd:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ec1:	83 e0 03             	and    $0x3,%eax
+  801ec4:	83 f8 01             	cmp    $0x1,%eax
+  801ec7:	74 2d                	je     801ef6 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ec9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ecd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ed1:	48 85 c0             	test   %rax,%rax
+  801ed4:	74 56                	je     801f2c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ed6:	4c 89 ea             	mov    %r13,%rdx
+  801ed9:	4c 89 e6             	mov    %r12,%rsi
+  801edc:	4c 89 f7             	mov    %r14,%rdi
+  801edf:	ff d0                	call   *%rax
+}
+  801ee1:	48 83 c4 10          	add    $0x10,%rsp
+  801ee5:	5b                   	pop    %rbx
+  801ee6:	41 5c                	pop    %r12
+  801ee8:	41 5d                	pop    %r13
+  801eea:	41 5e                	pop    %r14
+  801eec:	5d                   	pop    %rbp
+  801eed:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eee:	48 98                	cltq
+  801ef0:	eb ef                	jmp    801ee1 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ef2:	48 98                	cltq
+  801ef4:	eb eb                	jmp    801ee1 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ef6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801efd:	00 00 00 
+  801f00:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f06:	89 da                	mov    %ebx,%edx
+  801f08:	48 bf 89 36 80 00 00 	movabs $0x803689,%rdi
+  801f0f:	00 00 00 
+  801f12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f17:	48 b9 8f 05 80 00 00 	movabs $0x80058f,%rcx
+  801f1e:	00 00 00 
+  801f21:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f23:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f2a:	eb b5                	jmp    801ee1 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f2c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f33:	eb ac                	jmp    801ee1 <read+0x6a>
+
+0000000000801f35 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801f35:	55                   	push   %rbp
+  801f36:	48 89 e5             	mov    %rsp,%rbp
+  801f39:	41 57                	push   %r15
+  801f3b:	41 56                	push   %r14
+  801f3d:	41 55                	push   %r13
+  801f3f:	41 54                	push   %r12
+  801f41:	53                   	push   %rbx
+  801f42:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801f46:	48 85 d2             	test   %rdx,%rdx
+  801f49:	74 54                	je     801f9f <readn+0x6a>
+  801f4b:	41 89 fd             	mov    %edi,%r13d
+  801f4e:	49 89 f6             	mov    %rsi,%r14
+  801f51:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801f54:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801f59:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801f5e:	49 bf 77 1e 80 00 00 	movabs $0x801e77,%r15
+  801f65:	00 00 00 
+  801f68:	4c 89 e2             	mov    %r12,%rdx
+  801f6b:	48 29 f2             	sub    %rsi,%rdx
+  801f6e:	4c 01 f6             	add    %r14,%rsi
+  801f71:	44 89 ef             	mov    %r13d,%edi
+  801f74:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801f77:	85 c0                	test   %eax,%eax
+  801f79:	78 20                	js     801f9b <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801f7b:	01 c3                	add    %eax,%ebx
+  801f7d:	85 c0                	test   %eax,%eax
+  801f7f:	74 08                	je     801f89 <readn+0x54>
+  801f81:	48 63 f3             	movslq %ebx,%rsi
+  801f84:	4c 39 e6             	cmp    %r12,%rsi
+  801f87:	72 df                	jb     801f68 <readn+0x33>
+    }
+    return res;
+  801f89:	48 63 c3             	movslq %ebx,%rax
+}
+  801f8c:	48 83 c4 08          	add    $0x8,%rsp
+  801f90:	5b                   	pop    %rbx
+  801f91:	41 5c                	pop    %r12
+  801f93:	41 5d                	pop    %r13
+  801f95:	41 5e                	pop    %r14
+  801f97:	41 5f                	pop    %r15
+  801f99:	5d                   	pop    %rbp
+  801f9a:	c3                   	ret
+        if (inc < 0) return inc;
+  801f9b:	48 98                	cltq
+  801f9d:	eb ed                	jmp    801f8c <readn+0x57>
+    int inc = 1, res = 0;
+  801f9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fa4:	eb e3                	jmp    801f89 <readn+0x54>
+
+0000000000801fa6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801fa6:	55                   	push   %rbp
+  801fa7:	48 89 e5             	mov    %rsp,%rbp
+  801faa:	41 56                	push   %r14
+  801fac:	41 55                	push   %r13
+  801fae:	41 54                	push   %r12
+  801fb0:	53                   	push   %rbx
+  801fb1:	48 83 ec 10          	sub    $0x10,%rsp
+  801fb5:	89 fb                	mov    %edi,%ebx
+  801fb7:	49 89 f4             	mov    %rsi,%r12
+  801fba:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fbd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fc1:	48 b8 94 1b 80 00 00 	movabs $0x801b94,%rax
+  801fc8:	00 00 00 
+  801fcb:	ff d0                	call   *%rax
+  801fcd:	85 c0                	test   %eax,%eax
+  801fcf:	78 47                	js     802018 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fd1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801fd5:	41 8b 3e             	mov    (%r14),%edi
+  801fd8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fdc:	48 b8 df 1b 80 00 00 	movabs $0x801bdf,%rax
+  801fe3:	00 00 00 
+  801fe6:	ff d0                	call   *%rax
+  801fe8:	85 c0                	test   %eax,%eax
+  801fea:	78 30                	js     80201c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fec:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801ff1:	74 2d                	je     802020 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ff3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ff7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ffb:	48 85 c0             	test   %rax,%rax
+  801ffe:	74 56                	je     802056 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802000:	4c 89 ea             	mov    %r13,%rdx
+  802003:	4c 89 e6             	mov    %r12,%rsi
+  802006:	4c 89 f7             	mov    %r14,%rdi
+  802009:	ff d0                	call   *%rax
+}
+  80200b:	48 83 c4 10          	add    $0x10,%rsp
+  80200f:	5b                   	pop    %rbx
+  802010:	41 5c                	pop    %r12
+  802012:	41 5d                	pop    %r13
+  802014:	41 5e                	pop    %r14
+  802016:	5d                   	pop    %rbp
+  802017:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802018:	48 98                	cltq
+  80201a:	eb ef                	jmp    80200b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80201c:	48 98                	cltq
+  80201e:	eb eb                	jmp    80200b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802020:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802027:	00 00 00 
+  80202a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802030:	89 da                	mov    %ebx,%edx
+  802032:	48 bf a5 36 80 00 00 	movabs $0x8036a5,%rdi
+  802039:	00 00 00 
+  80203c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802041:	48 b9 8f 05 80 00 00 	movabs $0x80058f,%rcx
+  802048:	00 00 00 
+  80204b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80204d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802054:	eb b5                	jmp    80200b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802056:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80205d:	eb ac                	jmp    80200b <write+0x65>
+
+000000000080205f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80205f:	55                   	push   %rbp
+  802060:	48 89 e5             	mov    %rsp,%rbp
+  802063:	53                   	push   %rbx
+  802064:	48 83 ec 18          	sub    $0x18,%rsp
+  802068:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80206a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80206e:	48 b8 94 1b 80 00 00 	movabs $0x801b94,%rax
+  802075:	00 00 00 
+  802078:	ff d0                	call   *%rax
+  80207a:	85 c0                	test   %eax,%eax
+  80207c:	78 0c                	js     80208a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80207e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802082:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802085:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80208a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80208e:	c9                   	leave
+  80208f:	c3                   	ret
+
+0000000000802090 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802090:	55                   	push   %rbp
+  802091:	48 89 e5             	mov    %rsp,%rbp
+  802094:	41 55                	push   %r13
+  802096:	41 54                	push   %r12
+  802098:	53                   	push   %rbx
+  802099:	48 83 ec 18          	sub    $0x18,%rsp
+  80209d:	89 fb                	mov    %edi,%ebx
+  80209f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020a2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020a6:	48 b8 94 1b 80 00 00 	movabs $0x801b94,%rax
+  8020ad:	00 00 00 
+  8020b0:	ff d0                	call   *%rax
+  8020b2:	85 c0                	test   %eax,%eax
+  8020b4:	78 38                	js     8020ee <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020b6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8020ba:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8020be:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020c2:	48 b8 df 1b 80 00 00 	movabs $0x801bdf,%rax
+  8020c9:	00 00 00 
+  8020cc:	ff d0                	call   *%rax
+  8020ce:	85 c0                	test   %eax,%eax
+  8020d0:	78 1c                	js     8020ee <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020d2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8020d7:	74 20                	je     8020f9 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020d9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020dd:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8020e1:	48 85 c0             	test   %rax,%rax
+  8020e4:	74 47                	je     80212d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8020e6:	44 89 e6             	mov    %r12d,%esi
+  8020e9:	4c 89 ef             	mov    %r13,%rdi
+  8020ec:	ff d0                	call   *%rax
+}
+  8020ee:	48 83 c4 18          	add    $0x18,%rsp
+  8020f2:	5b                   	pop    %rbx
+  8020f3:	41 5c                	pop    %r12
+  8020f5:	41 5d                	pop    %r13
+  8020f7:	5d                   	pop    %rbp
+  8020f8:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8020f9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802100:	00 00 00 
+  802103:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802109:	89 da                	mov    %ebx,%edx
+  80210b:	48 bf 68 36 80 00 00 	movabs $0x803668,%rdi
+  802112:	00 00 00 
+  802115:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211a:	48 b9 8f 05 80 00 00 	movabs $0x80058f,%rcx
+  802121:	00 00 00 
+  802124:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802126:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80212b:	eb c1                	jmp    8020ee <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80212d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802132:	eb ba                	jmp    8020ee <ftruncate+0x5e>
+
+0000000000802134 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802134:	55                   	push   %rbp
+  802135:	48 89 e5             	mov    %rsp,%rbp
+  802138:	41 54                	push   %r12
+  80213a:	53                   	push   %rbx
+  80213b:	48 83 ec 10          	sub    $0x10,%rsp
+  80213f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802142:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802146:	48 b8 94 1b 80 00 00 	movabs $0x801b94,%rax
+  80214d:	00 00 00 
+  802150:	ff d0                	call   *%rax
+  802152:	85 c0                	test   %eax,%eax
+  802154:	78 4e                	js     8021a4 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802156:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80215a:	41 8b 3c 24          	mov    (%r12),%edi
+  80215e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802162:	48 b8 df 1b 80 00 00 	movabs $0x801bdf,%rax
+  802169:	00 00 00 
+  80216c:	ff d0                	call   *%rax
+  80216e:	85 c0                	test   %eax,%eax
+  802170:	78 32                	js     8021a4 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802172:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802176:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80217b:	74 30                	je     8021ad <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80217d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802180:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802187:	00 00 00 
+    stat->st_isdir = 0;
+  80218a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802191:	00 00 00 
+    stat->st_dev = dev;
+  802194:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80219b:	48 89 de             	mov    %rbx,%rsi
+  80219e:	4c 89 e7             	mov    %r12,%rdi
+  8021a1:	ff 50 28             	call   *0x28(%rax)
+}
+  8021a4:	48 83 c4 10          	add    $0x10,%rsp
+  8021a8:	5b                   	pop    %rbx
+  8021a9:	41 5c                	pop    %r12
+  8021ab:	5d                   	pop    %rbp
+  8021ac:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8021ad:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021b2:	eb f0                	jmp    8021a4 <fstat+0x70>
+
+00000000008021b4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8021b4:	55                   	push   %rbp
+  8021b5:	48 89 e5             	mov    %rsp,%rbp
+  8021b8:	41 54                	push   %r12
+  8021ba:	53                   	push   %rbx
+  8021bb:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8021be:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c3:	48 b8 35 24 80 00 00 	movabs $0x802435,%rax
+  8021ca:	00 00 00 
+  8021cd:	ff d0                	call   *%rax
+  8021cf:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8021d1:	85 c0                	test   %eax,%eax
+  8021d3:	78 25                	js     8021fa <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8021d5:	4c 89 e6             	mov    %r12,%rsi
+  8021d8:	89 c7                	mov    %eax,%edi
+  8021da:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  8021e1:	00 00 00 
+  8021e4:	ff d0                	call   *%rax
+  8021e6:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8021e9:	89 df                	mov    %ebx,%edi
+  8021eb:	48 b8 f9 1c 80 00 00 	movabs $0x801cf9,%rax
+  8021f2:	00 00 00 
+  8021f5:	ff d0                	call   *%rax
+
+    return res;
+  8021f7:	44 89 e3             	mov    %r12d,%ebx
+}
+  8021fa:	89 d8                	mov    %ebx,%eax
+  8021fc:	5b                   	pop    %rbx
+  8021fd:	41 5c                	pop    %r12
+  8021ff:	5d                   	pop    %rbp
+  802200:	c3                   	ret
+
+0000000000802201 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802201:	55                   	push   %rbp
+  802202:	48 89 e5             	mov    %rsp,%rbp
+  802205:	41 54                	push   %r12
+  802207:	53                   	push   %rbx
+  802208:	48 83 ec 10          	sub    $0x10,%rsp
+  80220c:	41 89 fc             	mov    %edi,%r12d
+  80220f:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802212:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802219:	00 00 00 
+  80221c:	83 38 00             	cmpl   $0x0,(%rax)
+  80221f:	74 5e                	je     80227f <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802221:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802227:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80222c:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802233:	00 00 00 
+  802236:	44 89 e6             	mov    %r12d,%esi
+  802239:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802240:	00 00 00 
+  802243:	8b 38                	mov    (%rax),%edi
+  802245:	48 b8 6e 2e 80 00 00 	movabs $0x802e6e,%rax
+  80224c:	00 00 00 
+  80224f:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802251:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802258:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802259:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80225e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802262:	48 89 de             	mov    %rbx,%rsi
+  802265:	bf 00 00 00 00       	mov    $0x0,%edi
+  80226a:	48 b8 d9 2d 80 00 00 	movabs $0x802dd9,%rax
+  802271:	00 00 00 
+  802274:	ff d0                	call   *%rax
+}
+  802276:	48 83 c4 10          	add    $0x10,%rsp
+  80227a:	5b                   	pop    %rbx
+  80227b:	41 5c                	pop    %r12
+  80227d:	5d                   	pop    %rbp
+  80227e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80227f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802284:	48 b8 0e 2f 80 00 00 	movabs $0x802f0e,%rax
+  80228b:	00 00 00 
+  80228e:	ff d0                	call   *%rax
+  802290:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802297:	00 00 
+  802299:	eb 86                	jmp    802221 <fsipc+0x20>
+
+000000000080229b <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80229b:	55                   	push   %rbp
+  80229c:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80229f:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022a6:	00 00 00 
+  8022a9:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8022ac:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8022ae:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8022b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b6:	bf 02 00 00 00       	mov    $0x2,%edi
+  8022bb:	48 b8 01 22 80 00 00 	movabs $0x802201,%rax
+  8022c2:	00 00 00 
+  8022c5:	ff d0                	call   *%rax
+}
+  8022c7:	5d                   	pop    %rbp
+  8022c8:	c3                   	ret
+
+00000000008022c9 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8022c9:	55                   	push   %rbp
+  8022ca:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8022cd:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8022d0:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8022d7:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8022d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8022de:	bf 06 00 00 00       	mov    $0x6,%edi
+  8022e3:	48 b8 01 22 80 00 00 	movabs $0x802201,%rax
+  8022ea:	00 00 00 
+  8022ed:	ff d0                	call   *%rax
+}
+  8022ef:	5d                   	pop    %rbp
+  8022f0:	c3                   	ret
+
+00000000008022f1 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8022f1:	55                   	push   %rbp
+  8022f2:	48 89 e5             	mov    %rsp,%rbp
+  8022f5:	41 54                	push   %r12
+  8022f7:	53                   	push   %rbx
+  8022f8:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8022fb:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8022fe:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802305:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802307:	be 00 00 00 00       	mov    $0x0,%esi
+  80230c:	bf 05 00 00 00       	mov    $0x5,%edi
+  802311:	48 b8 01 22 80 00 00 	movabs $0x802201,%rax
+  802318:	00 00 00 
+  80231b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80231d:	85 c0                	test   %eax,%eax
+  80231f:	78 3d                	js     80235e <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802321:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802328:	00 00 00 
+  80232b:	4c 89 e6             	mov    %r12,%rsi
+  80232e:	48 89 df             	mov    %rbx,%rdi
+  802331:	48 b8 b4 0e 80 00 00 	movabs $0x800eb4,%rax
+  802338:	00 00 00 
+  80233b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80233d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802344:	00 
+  802345:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80234b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802352:	00 
+  802353:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802359:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80235e:	5b                   	pop    %rbx
+  80235f:	41 5c                	pop    %r12
+  802361:	5d                   	pop    %rbp
+  802362:	c3                   	ret
+
+0000000000802363 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802363:	55                   	push   %rbp
+  802364:	48 89 e5             	mov    %rsp,%rbp
+  802367:	41 54                	push   %r12
+  802369:	53                   	push   %rbx
+  80236a:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  80236d:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802372:	48 39 c2             	cmp    %rax,%rdx
+  802375:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802379:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80237c:	48 89 c2             	mov    %rax,%rdx
+  80237f:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802386:	00 00 00 
+  802389:	48 b8 15 11 80 00 00 	movabs $0x801115,%rax
+  802390:	00 00 00 
+  802393:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802395:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80239c:	00 00 00 
+  80239f:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8023a4:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8023a6:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8023aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8023af:	bf 04 00 00 00       	mov    $0x4,%edi
+  8023b4:	48 b8 01 22 80 00 00 	movabs $0x802201,%rax
+  8023bb:	00 00 00 
+  8023be:	ff d0                	call   *%rax
+  8023c0:	48 98                	cltq
+}
+  8023c2:	5b                   	pop    %rbx
+  8023c3:	41 5c                	pop    %r12
+  8023c5:	5d                   	pop    %rbp
+  8023c6:	c3                   	ret
+
+00000000008023c7 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023c7:	55                   	push   %rbp
+  8023c8:	48 89 e5             	mov    %rsp,%rbp
+  8023cb:	41 54                	push   %r12
+  8023cd:	53                   	push   %rbx
+  8023ce:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023d1:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023d8:	00 00 00 
+  8023db:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8023de:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8023e0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8023e5:	48 39 ca             	cmp    %rcx,%rdx
+  8023e8:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8023ec:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8023f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023fa:	48 b8 01 22 80 00 00 	movabs $0x802201,%rax
+  802401:	00 00 00 
+  802404:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802406:	85 c0                	test   %eax,%eax
+  802408:	78 27                	js     802431 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  80240a:	48 63 d8             	movslq %eax,%rbx
+  80240d:	48 89 da             	mov    %rbx,%rdx
+  802410:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802417:	00 00 00 
+  80241a:	4c 89 e7             	mov    %r12,%rdi
+  80241d:	48 b8 15 11 80 00 00 	movabs $0x801115,%rax
+  802424:	00 00 00 
+  802427:	ff d0                	call   *%rax
+    return bytes_read;
+  802429:	48 89 d8             	mov    %rbx,%rax
+}
+  80242c:	5b                   	pop    %rbx
+  80242d:	41 5c                	pop    %r12
+  80242f:	5d                   	pop    %rbp
+  802430:	c3                   	ret
+        return bytes_read;
+  802431:	48 98                	cltq
+  802433:	eb f7                	jmp    80242c <devfile_read+0x65>
+
+0000000000802435 <open>:
+open(const char *path, int mode) {
+  802435:	55                   	push   %rbp
+  802436:	48 89 e5             	mov    %rsp,%rbp
+  802439:	41 55                	push   %r13
+  80243b:	41 54                	push   %r12
+  80243d:	53                   	push   %rbx
+  80243e:	48 83 ec 18          	sub    $0x18,%rsp
+  802442:	49 89 fc             	mov    %rdi,%r12
+  802445:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802448:	48 b8 76 0e 80 00 00 	movabs $0x800e76,%rax
+  80244f:	00 00 00 
+  802452:	ff d0                	call   *%rax
+  802454:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80245a:	0f 87 8a 00 00 00    	ja     8024ea <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802460:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802464:	48 b8 34 1b 80 00 00 	movabs $0x801b34,%rax
+  80246b:	00 00 00 
+  80246e:	ff d0                	call   *%rax
+  802470:	89 c3                	mov    %eax,%ebx
+  802472:	85 c0                	test   %eax,%eax
+  802474:	78 50                	js     8024c6 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802476:	4c 89 e6             	mov    %r12,%rsi
+  802479:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802480:	00 00 00 
+  802483:	48 89 df             	mov    %rbx,%rdi
+  802486:	48 b8 b4 0e 80 00 00 	movabs $0x800eb4,%rax
+  80248d:	00 00 00 
+  802490:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802492:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802499:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80249d:	bf 01 00 00 00       	mov    $0x1,%edi
+  8024a2:	48 b8 01 22 80 00 00 	movabs $0x802201,%rax
+  8024a9:	00 00 00 
+  8024ac:	ff d0                	call   *%rax
+  8024ae:	89 c3                	mov    %eax,%ebx
+  8024b0:	85 c0                	test   %eax,%eax
+  8024b2:	78 1f                	js     8024d3 <open+0x9e>
+    return fd2num(fd);
+  8024b4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024b8:	48 b8 06 1b 80 00 00 	movabs $0x801b06,%rax
+  8024bf:	00 00 00 
+  8024c2:	ff d0                	call   *%rax
+  8024c4:	89 c3                	mov    %eax,%ebx
+}
+  8024c6:	89 d8                	mov    %ebx,%eax
+  8024c8:	48 83 c4 18          	add    $0x18,%rsp
+  8024cc:	5b                   	pop    %rbx
+  8024cd:	41 5c                	pop    %r12
+  8024cf:	41 5d                	pop    %r13
+  8024d1:	5d                   	pop    %rbp
+  8024d2:	c3                   	ret
+        fd_close(fd, 0);
+  8024d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8024d8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024dc:	48 b8 4f 1c 80 00 00 	movabs $0x801c4f,%rax
+  8024e3:	00 00 00 
+  8024e6:	ff d0                	call   *%rax
+        return res;
+  8024e8:	eb dc                	jmp    8024c6 <open+0x91>
+        return -E_BAD_PATH;
+  8024ea:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8024ef:	eb d5                	jmp    8024c6 <open+0x91>
+
+00000000008024f1 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8024f1:	55                   	push   %rbp
+  8024f2:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8024f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8024fa:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024ff:	48 b8 01 22 80 00 00 	movabs $0x802201,%rax
+  802506:	00 00 00 
+  802509:	ff d0                	call   *%rax
+}
+  80250b:	5d                   	pop    %rbp
+  80250c:	c3                   	ret
+
+000000000080250d <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80250d:	55                   	push   %rbp
+  80250e:	48 89 e5             	mov    %rsp,%rbp
+  802511:	41 54                	push   %r12
+  802513:	53                   	push   %rbx
+  802514:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802517:	48 b8 18 1b 80 00 00 	movabs $0x801b18,%rax
+  80251e:	00 00 00 
+  802521:	ff d0                	call   *%rax
+  802523:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802526:	48 be 00 37 80 00 00 	movabs $0x803700,%rsi
+  80252d:	00 00 00 
+  802530:	48 89 df             	mov    %rbx,%rdi
+  802533:	48 b8 b4 0e 80 00 00 	movabs $0x800eb4,%rax
+  80253a:	00 00 00 
+  80253d:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80253f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802544:	41 2b 04 24          	sub    (%r12),%eax
+  802548:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80254e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802555:	00 00 00 
+    stat->st_dev = &devpipe;
+  802558:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80255f:	00 00 00 
+  802562:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256e:	5b                   	pop    %rbx
+  80256f:	41 5c                	pop    %r12
+  802571:	5d                   	pop    %rbp
+  802572:	c3                   	ret
+
+0000000000802573 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802573:	55                   	push   %rbp
+  802574:	48 89 e5             	mov    %rsp,%rbp
+  802577:	41 54                	push   %r12
+  802579:	53                   	push   %rbx
+  80257a:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80257d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802582:	48 89 fe             	mov    %rdi,%rsi
+  802585:	bf 00 00 00 00       	mov    $0x0,%edi
+  80258a:	49 bc 30 15 80 00 00 	movabs $0x801530,%r12
+  802591:	00 00 00 
+  802594:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802597:	48 89 df             	mov    %rbx,%rdi
+  80259a:	48 b8 18 1b 80 00 00 	movabs $0x801b18,%rax
+  8025a1:	00 00 00 
+  8025a4:	ff d0                	call   *%rax
+  8025a6:	48 89 c6             	mov    %rax,%rsi
+  8025a9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025b3:	41 ff d4             	call   *%r12
+}
+  8025b6:	5b                   	pop    %rbx
+  8025b7:	41 5c                	pop    %r12
+  8025b9:	5d                   	pop    %rbp
+  8025ba:	c3                   	ret
+
+00000000008025bb <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8025bb:	55                   	push   %rbp
+  8025bc:	48 89 e5             	mov    %rsp,%rbp
+  8025bf:	41 57                	push   %r15
+  8025c1:	41 56                	push   %r14
+  8025c3:	41 55                	push   %r13
+  8025c5:	41 54                	push   %r12
+  8025c7:	53                   	push   %rbx
+  8025c8:	48 83 ec 18          	sub    $0x18,%rsp
+  8025cc:	49 89 fc             	mov    %rdi,%r12
+  8025cf:	49 89 f5             	mov    %rsi,%r13
+  8025d2:	49 89 d7             	mov    %rdx,%r15
+  8025d5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025d9:	48 b8 18 1b 80 00 00 	movabs $0x801b18,%rax
+  8025e0:	00 00 00 
+  8025e3:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8025e5:	4d 85 ff             	test   %r15,%r15
+  8025e8:	0f 84 af 00 00 00    	je     80269d <devpipe_write+0xe2>
+  8025ee:	48 89 c3             	mov    %rax,%rbx
+  8025f1:	4c 89 f8             	mov    %r15,%rax
+  8025f4:	4d 89 ef             	mov    %r13,%r15
+  8025f7:	4c 01 e8             	add    %r13,%rax
+  8025fa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025fe:	49 bd 38 14 80 00 00 	movabs $0x801438,%r13
+  802605:	00 00 00 
+            sys_yield();
+  802608:	49 be d5 13 80 00 00 	movabs $0x8013d5,%r14
+  80260f:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802612:	8b 73 04             	mov    0x4(%rbx),%esi
+  802615:	48 63 ce             	movslq %esi,%rcx
+  802618:	48 63 03             	movslq (%rbx),%rax
+  80261b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802621:	48 39 c1             	cmp    %rax,%rcx
+  802624:	72 2e                	jb     802654 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802626:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80262b:	48 89 da             	mov    %rbx,%rdx
+  80262e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802633:	4c 89 e7             	mov    %r12,%rdi
+  802636:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802639:	85 c0                	test   %eax,%eax
+  80263b:	74 66                	je     8026a3 <devpipe_write+0xe8>
+            sys_yield();
+  80263d:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802640:	8b 73 04             	mov    0x4(%rbx),%esi
+  802643:	48 63 ce             	movslq %esi,%rcx
+  802646:	48 63 03             	movslq (%rbx),%rax
+  802649:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80264f:	48 39 c1             	cmp    %rax,%rcx
+  802652:	73 d2                	jae    802626 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802654:	41 0f b6 3f          	movzbl (%r15),%edi
+  802658:	48 89 ca             	mov    %rcx,%rdx
+  80265b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80265f:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802666:	08 10 20 
+  802669:	48 f7 e2             	mul    %rdx
+  80266c:	48 c1 ea 06          	shr    $0x6,%rdx
+  802670:	48 89 d0             	mov    %rdx,%rax
+  802673:	48 c1 e0 09          	shl    $0x9,%rax
+  802677:	48 29 d0             	sub    %rdx,%rax
+  80267a:	48 c1 e0 03          	shl    $0x3,%rax
+  80267e:	48 29 c1             	sub    %rax,%rcx
+  802681:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802686:	83 c6 01             	add    $0x1,%esi
+  802689:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80268c:	49 83 c7 01          	add    $0x1,%r15
+  802690:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802694:	49 39 c7             	cmp    %rax,%r15
+  802697:	0f 85 75 ff ff ff    	jne    802612 <devpipe_write+0x57>
+    return n;
+  80269d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8026a1:	eb 05                	jmp    8026a8 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8026a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026a8:	48 83 c4 18          	add    $0x18,%rsp
+  8026ac:	5b                   	pop    %rbx
+  8026ad:	41 5c                	pop    %r12
+  8026af:	41 5d                	pop    %r13
+  8026b1:	41 5e                	pop    %r14
+  8026b3:	41 5f                	pop    %r15
+  8026b5:	5d                   	pop    %rbp
+  8026b6:	c3                   	ret
+
+00000000008026b7 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8026b7:	55                   	push   %rbp
+  8026b8:	48 89 e5             	mov    %rsp,%rbp
+  8026bb:	41 57                	push   %r15
+  8026bd:	41 56                	push   %r14
+  8026bf:	41 55                	push   %r13
+  8026c1:	41 54                	push   %r12
+  8026c3:	53                   	push   %rbx
+  8026c4:	48 83 ec 18          	sub    $0x18,%rsp
+  8026c8:	49 89 fc             	mov    %rdi,%r12
+  8026cb:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8026cf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8026d3:	48 b8 18 1b 80 00 00 	movabs $0x801b18,%rax
+  8026da:	00 00 00 
+  8026dd:	ff d0                	call   *%rax
+  8026df:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8026e2:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026e8:	49 bd 38 14 80 00 00 	movabs $0x801438,%r13
+  8026ef:	00 00 00 
+            sys_yield();
+  8026f2:	49 be d5 13 80 00 00 	movabs $0x8013d5,%r14
+  8026f9:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8026fc:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802701:	74 7d                	je     802780 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802703:	8b 03                	mov    (%rbx),%eax
+  802705:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802708:	75 26                	jne    802730 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80270a:	4d 85 ff             	test   %r15,%r15
+  80270d:	75 77                	jne    802786 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80270f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802714:	48 89 da             	mov    %rbx,%rdx
+  802717:	be 00 10 00 00       	mov    $0x1000,%esi
+  80271c:	4c 89 e7             	mov    %r12,%rdi
+  80271f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802722:	85 c0                	test   %eax,%eax
+  802724:	74 72                	je     802798 <devpipe_read+0xe1>
+            sys_yield();
+  802726:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802729:	8b 03                	mov    (%rbx),%eax
+  80272b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80272e:	74 df                	je     80270f <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802730:	48 63 c8             	movslq %eax,%rcx
+  802733:	48 89 ca             	mov    %rcx,%rdx
+  802736:	48 c1 ea 03          	shr    $0x3,%rdx
+  80273a:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802741:	08 10 20 
+  802744:	48 89 d0             	mov    %rdx,%rax
+  802747:	48 f7 e6             	mul    %rsi
+  80274a:	48 c1 ea 06          	shr    $0x6,%rdx
+  80274e:	48 89 d0             	mov    %rdx,%rax
+  802751:	48 c1 e0 09          	shl    $0x9,%rax
+  802755:	48 29 d0             	sub    %rdx,%rax
+  802758:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80275f:	00 
+  802760:	48 89 c8             	mov    %rcx,%rax
+  802763:	48 29 d0             	sub    %rdx,%rax
+  802766:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80276b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80276f:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802773:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802776:	49 83 c7 01          	add    $0x1,%r15
+  80277a:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80277e:	75 83                	jne    802703 <devpipe_read+0x4c>
+    return n;
+  802780:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802784:	eb 03                	jmp    802789 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802786:	4c 89 f8             	mov    %r15,%rax
+}
+  802789:	48 83 c4 18          	add    $0x18,%rsp
+  80278d:	5b                   	pop    %rbx
+  80278e:	41 5c                	pop    %r12
+  802790:	41 5d                	pop    %r13
+  802792:	41 5e                	pop    %r14
+  802794:	41 5f                	pop    %r15
+  802796:	5d                   	pop    %rbp
+  802797:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802798:	b8 00 00 00 00       	mov    $0x0,%eax
+  80279d:	eb ea                	jmp    802789 <devpipe_read+0xd2>
+
+000000000080279f <pipe>:
+pipe(int pfd[2]) {
+  80279f:	55                   	push   %rbp
+  8027a0:	48 89 e5             	mov    %rsp,%rbp
+  8027a3:	41 55                	push   %r13
+  8027a5:	41 54                	push   %r12
+  8027a7:	53                   	push   %rbx
+  8027a8:	48 83 ec 18          	sub    $0x18,%rsp
+  8027ac:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027af:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8027b3:	48 b8 34 1b 80 00 00 	movabs $0x801b34,%rax
+  8027ba:	00 00 00 
+  8027bd:	ff d0                	call   *%rax
+  8027bf:	89 c3                	mov    %eax,%ebx
+  8027c1:	85 c0                	test   %eax,%eax
+  8027c3:	0f 88 a0 01 00 00    	js     802969 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8027c9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027d3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8027d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027dc:	48 b8 64 14 80 00 00 	movabs $0x801464,%rax
+  8027e3:	00 00 00 
+  8027e6:	ff d0                	call   *%rax
+  8027e8:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027ea:	85 c0                	test   %eax,%eax
+  8027ec:	0f 88 77 01 00 00    	js     802969 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027f2:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8027f6:	48 b8 34 1b 80 00 00 	movabs $0x801b34,%rax
+  8027fd:	00 00 00 
+  802800:	ff d0                	call   *%rax
+  802802:	89 c3                	mov    %eax,%ebx
+  802804:	85 c0                	test   %eax,%eax
+  802806:	0f 88 43 01 00 00    	js     80294f <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80280c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802811:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802816:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80281a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80281f:	48 b8 64 14 80 00 00 	movabs $0x801464,%rax
+  802826:	00 00 00 
+  802829:	ff d0                	call   *%rax
+  80282b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80282d:	85 c0                	test   %eax,%eax
+  80282f:	0f 88 1a 01 00 00    	js     80294f <pipe+0x1b0>
+    va = fd2data(fd0);
+  802835:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802839:	48 b8 18 1b 80 00 00 	movabs $0x801b18,%rax
+  802840:	00 00 00 
+  802843:	ff d0                	call   *%rax
+  802845:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802848:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80284d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802852:	48 89 c6             	mov    %rax,%rsi
+  802855:	bf 00 00 00 00       	mov    $0x0,%edi
+  80285a:	48 b8 64 14 80 00 00 	movabs $0x801464,%rax
+  802861:	00 00 00 
+  802864:	ff d0                	call   *%rax
+  802866:	89 c3                	mov    %eax,%ebx
+  802868:	85 c0                	test   %eax,%eax
+  80286a:	0f 88 c5 00 00 00    	js     802935 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802870:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802874:	48 b8 18 1b 80 00 00 	movabs $0x801b18,%rax
+  80287b:	00 00 00 
+  80287e:	ff d0                	call   *%rax
+  802880:	48 89 c1             	mov    %rax,%rcx
+  802883:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802889:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80288f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802894:	4c 89 ee             	mov    %r13,%rsi
+  802897:	bf 00 00 00 00       	mov    $0x0,%edi
+  80289c:	48 b8 cb 14 80 00 00 	movabs $0x8014cb,%rax
+  8028a3:	00 00 00 
+  8028a6:	ff d0                	call   *%rax
+  8028a8:	89 c3                	mov    %eax,%ebx
+  8028aa:	85 c0                	test   %eax,%eax
+  8028ac:	78 6e                	js     80291c <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028ae:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028b3:	4c 89 ef             	mov    %r13,%rdi
+  8028b6:	48 b8 06 14 80 00 00 	movabs $0x801406,%rax
+  8028bd:	00 00 00 
+  8028c0:	ff d0                	call   *%rax
+  8028c2:	83 f8 02             	cmp    $0x2,%eax
+  8028c5:	0f 85 ab 00 00 00    	jne    802976 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8028cb:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8028d2:	00 00 
+  8028d4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028d8:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8028da:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028de:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8028e5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8028e9:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8028eb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028ef:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8028f6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028fa:	48 bb 06 1b 80 00 00 	movabs $0x801b06,%rbx
+  802901:	00 00 00 
+  802904:	ff d3                	call   *%rbx
+  802906:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80290a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80290e:	ff d3                	call   *%rbx
+  802910:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802915:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80291a:	eb 4d                	jmp    802969 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80291c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802921:	4c 89 ee             	mov    %r13,%rsi
+  802924:	bf 00 00 00 00       	mov    $0x0,%edi
+  802929:	48 b8 30 15 80 00 00 	movabs $0x801530,%rax
+  802930:	00 00 00 
+  802933:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802935:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80293a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80293e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802943:	48 b8 30 15 80 00 00 	movabs $0x801530,%rax
+  80294a:	00 00 00 
+  80294d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80294f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802954:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802958:	bf 00 00 00 00       	mov    $0x0,%edi
+  80295d:	48 b8 30 15 80 00 00 	movabs $0x801530,%rax
+  802964:	00 00 00 
+  802967:	ff d0                	call   *%rax
+}
+  802969:	89 d8                	mov    %ebx,%eax
+  80296b:	48 83 c4 18          	add    $0x18,%rsp
+  80296f:	5b                   	pop    %rbx
+  802970:	41 5c                	pop    %r12
+  802972:	41 5d                	pop    %r13
+  802974:	5d                   	pop    %rbp
+  802975:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802976:	48 b9 30 37 80 00 00 	movabs $0x803730,%rcx
+  80297d:	00 00 00 
+  802980:	48 ba 07 37 80 00 00 	movabs $0x803707,%rdx
+  802987:	00 00 00 
+  80298a:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80298f:	48 bf 1c 37 80 00 00 	movabs $0x80371c,%rdi
+  802996:	00 00 00 
+  802999:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299e:	49 b8 3f 04 80 00 00 	movabs $0x80043f,%r8
+  8029a5:	00 00 00 
+  8029a8:	41 ff d0             	call   *%r8
+
+00000000008029ab <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8029ab:	55                   	push   %rbp
+  8029ac:	48 89 e5             	mov    %rsp,%rbp
+  8029af:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8029b3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8029b7:	48 b8 94 1b 80 00 00 	movabs $0x801b94,%rax
+  8029be:	00 00 00 
+  8029c1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029c3:	85 c0                	test   %eax,%eax
+  8029c5:	78 35                	js     8029fc <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8029c7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029cb:	48 b8 18 1b 80 00 00 	movabs $0x801b18,%rax
+  8029d2:	00 00 00 
+  8029d5:	ff d0                	call   *%rax
+  8029d7:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8029da:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029df:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029e4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029e8:	48 b8 38 14 80 00 00 	movabs $0x801438,%rax
+  8029ef:	00 00 00 
+  8029f2:	ff d0                	call   *%rax
+  8029f4:	85 c0                	test   %eax,%eax
+  8029f6:	0f 94 c0             	sete   %al
+  8029f9:	0f b6 c0             	movzbl %al,%eax
+}
+  8029fc:	c9                   	leave
+  8029fd:	c3                   	ret
+
+00000000008029fe <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029fe:	48 89 f8             	mov    %rdi,%rax
+  802a01:	48 c1 e8 27          	shr    $0x27,%rax
+  802a05:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a0c:	01 00 00 
+  802a0f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a13:	f6 c2 01             	test   $0x1,%dl
+  802a16:	74 6d                	je     802a85 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a18:	48 89 f8             	mov    %rdi,%rax
+  802a1b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a1f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a26:	01 00 00 
+  802a29:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a2d:	f6 c2 01             	test   $0x1,%dl
+  802a30:	74 62                	je     802a94 <get_uvpt_entry+0x96>
+  802a32:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a39:	01 00 00 
+  802a3c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a40:	f6 c2 80             	test   $0x80,%dl
+  802a43:	75 4f                	jne    802a94 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a45:	48 89 f8             	mov    %rdi,%rax
+  802a48:	48 c1 e8 15          	shr    $0x15,%rax
+  802a4c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a53:	01 00 00 
+  802a56:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a5a:	f6 c2 01             	test   $0x1,%dl
+  802a5d:	74 44                	je     802aa3 <get_uvpt_entry+0xa5>
+  802a5f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a66:	01 00 00 
+  802a69:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a6d:	f6 c2 80             	test   $0x80,%dl
+  802a70:	75 31                	jne    802aa3 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a72:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a76:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a7d:	01 00 00 
+  802a80:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a84:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a85:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a8c:	01 00 00 
+  802a8f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a93:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a94:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a9b:	01 00 00 
+  802a9e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802aa2:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802aa3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802aaa:	01 00 00 
+  802aad:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ab1:	c3                   	ret
+
+0000000000802ab2 <get_prot>:
+
+int
+get_prot(void *va) {
+  802ab2:	55                   	push   %rbp
+  802ab3:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802ab6:	48 b8 fe 29 80 00 00 	movabs $0x8029fe,%rax
+  802abd:	00 00 00 
+  802ac0:	ff d0                	call   *%rax
+  802ac2:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802ac5:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802aca:	89 c1                	mov    %eax,%ecx
+  802acc:	83 c9 04             	or     $0x4,%ecx
+  802acf:	f6 c2 01             	test   $0x1,%dl
+  802ad2:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802ad5:	89 c1                	mov    %eax,%ecx
+  802ad7:	83 c9 02             	or     $0x2,%ecx
+  802ada:	f6 c2 02             	test   $0x2,%dl
+  802add:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802ae0:	89 c1                	mov    %eax,%ecx
+  802ae2:	83 c9 01             	or     $0x1,%ecx
+  802ae5:	48 85 d2             	test   %rdx,%rdx
+  802ae8:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802aeb:	89 c1                	mov    %eax,%ecx
+  802aed:	83 c9 40             	or     $0x40,%ecx
+  802af0:	f6 c6 04             	test   $0x4,%dh
+  802af3:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802af6:	5d                   	pop    %rbp
+  802af7:	c3                   	ret
+
+0000000000802af8 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802af8:	55                   	push   %rbp
+  802af9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802afc:	48 b8 fe 29 80 00 00 	movabs $0x8029fe,%rax
+  802b03:	00 00 00 
+  802b06:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802b08:	48 c1 e8 06          	shr    $0x6,%rax
+  802b0c:	83 e0 01             	and    $0x1,%eax
+}
+  802b0f:	5d                   	pop    %rbp
+  802b10:	c3                   	ret
+
+0000000000802b11 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802b11:	55                   	push   %rbp
+  802b12:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802b15:	48 b8 fe 29 80 00 00 	movabs $0x8029fe,%rax
+  802b1c:	00 00 00 
+  802b1f:	ff d0                	call   *%rax
+  802b21:	83 e0 01             	and    $0x1,%eax
+}
+  802b24:	5d                   	pop    %rbp
+  802b25:	c3                   	ret
+
+0000000000802b26 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802b26:	55                   	push   %rbp
+  802b27:	48 89 e5             	mov    %rsp,%rbp
+  802b2a:	41 57                	push   %r15
+  802b2c:	41 56                	push   %r14
+  802b2e:	41 55                	push   %r13
+  802b30:	41 54                	push   %r12
+  802b32:	53                   	push   %rbx
+  802b33:	48 83 ec 18          	sub    $0x18,%rsp
+  802b37:	49 89 ff             	mov    %rdi,%r15
+  802b3a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802b3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802b43:	49 bc 11 2b 80 00 00 	movabs $0x802b11,%r12
+  802b4a:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802b4d:	49 be b2 2a 80 00 00 	movabs $0x802ab2,%r14
+  802b54:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802b57:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802b5e:	00 00 00 
+  802b61:	eb 0c                	jmp    802b6f <foreach_shared_region+0x49>
+  802b63:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b6a:	4c 39 eb             	cmp    %r13,%rbx
+  802b6d:	74 38                	je     802ba7 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802b6f:	48 89 df             	mov    %rbx,%rdi
+  802b72:	41 ff d4             	call   *%r12
+  802b75:	84 c0                	test   %al,%al
+  802b77:	74 ea                	je     802b63 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802b79:	48 89 df             	mov    %rbx,%rdi
+  802b7c:	41 ff d6             	call   *%r14
+  802b7f:	a8 40                	test   $0x40,%al
+  802b81:	74 e0                	je     802b63 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802b83:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802b8a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802b8e:	48 89 df             	mov    %rbx,%rdi
+  802b91:	41 ff d7             	call   *%r15
+        if (err)
+  802b94:	85 c0                	test   %eax,%eax
+  802b96:	74 cb                	je     802b63 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802b98:	48 83 c4 18          	add    $0x18,%rsp
+  802b9c:	5b                   	pop    %rbx
+  802b9d:	41 5c                	pop    %r12
+  802b9f:	41 5d                	pop    %r13
+  802ba1:	41 5e                	pop    %r14
+  802ba3:	41 5f                	pop    %r15
+  802ba5:	5d                   	pop    %rbp
+  802ba6:	c3                   	ret
+    return 0;
+  802ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bac:	eb ea                	jmp    802b98 <foreach_shared_region+0x72>
+
+0000000000802bae <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802bae:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb3:	c3                   	ret
+
+0000000000802bb4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802bb4:	55                   	push   %rbp
+  802bb5:	48 89 e5             	mov    %rsp,%rbp
+  802bb8:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802bbb:	48 be 54 37 80 00 00 	movabs $0x803754,%rsi
+  802bc2:	00 00 00 
+  802bc5:	48 b8 b4 0e 80 00 00 	movabs $0x800eb4,%rax
+  802bcc:	00 00 00 
+  802bcf:	ff d0                	call   *%rax
+    return 0;
+}
+  802bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd6:	5d                   	pop    %rbp
+  802bd7:	c3                   	ret
+
+0000000000802bd8 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802bd8:	55                   	push   %rbp
+  802bd9:	48 89 e5             	mov    %rsp,%rbp
+  802bdc:	41 57                	push   %r15
+  802bde:	41 56                	push   %r14
+  802be0:	41 55                	push   %r13
+  802be2:	41 54                	push   %r12
+  802be4:	53                   	push   %rbx
+  802be5:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802bec:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802bf3:	48 85 d2             	test   %rdx,%rdx
+  802bf6:	74 7a                	je     802c72 <devcons_write+0x9a>
+  802bf8:	49 89 d6             	mov    %rdx,%r14
+  802bfb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802c01:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802c06:	49 bf ae 10 80 00 00 	movabs $0x8010ae,%r15
+  802c0d:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802c10:	4c 89 f3             	mov    %r14,%rbx
+  802c13:	48 29 f3             	sub    %rsi,%rbx
+  802c16:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802c1b:	48 39 c3             	cmp    %rax,%rbx
+  802c1e:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802c22:	4c 63 eb             	movslq %ebx,%r13
+  802c25:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802c2c:	48 01 c6             	add    %rax,%rsi
+  802c2f:	4c 89 ea             	mov    %r13,%rdx
+  802c32:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802c39:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802c3c:	4c 89 ee             	mov    %r13,%rsi
+  802c3f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802c46:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  802c4d:	00 00 00 
+  802c50:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802c52:	41 01 dc             	add    %ebx,%r12d
+  802c55:	49 63 f4             	movslq %r12d,%rsi
+  802c58:	4c 39 f6             	cmp    %r14,%rsi
+  802c5b:	72 b3                	jb     802c10 <devcons_write+0x38>
+    return res;
+  802c5d:	49 63 c4             	movslq %r12d,%rax
+}
+  802c60:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802c67:	5b                   	pop    %rbx
+  802c68:	41 5c                	pop    %r12
+  802c6a:	41 5d                	pop    %r13
+  802c6c:	41 5e                	pop    %r14
+  802c6e:	41 5f                	pop    %r15
+  802c70:	5d                   	pop    %rbp
+  802c71:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802c72:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802c78:	eb e3                	jmp    802c5d <devcons_write+0x85>
+
+0000000000802c7a <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802c7a:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802c7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c82:	48 85 c0             	test   %rax,%rax
+  802c85:	74 55                	je     802cdc <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802c87:	55                   	push   %rbp
+  802c88:	48 89 e5             	mov    %rsp,%rbp
+  802c8b:	41 55                	push   %r13
+  802c8d:	41 54                	push   %r12
+  802c8f:	53                   	push   %rbx
+  802c90:	48 83 ec 08          	sub    $0x8,%rsp
+  802c94:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802c97:	48 bb 08 13 80 00 00 	movabs $0x801308,%rbx
+  802c9e:	00 00 00 
+  802ca1:	49 bc d5 13 80 00 00 	movabs $0x8013d5,%r12
+  802ca8:	00 00 00 
+  802cab:	eb 03                	jmp    802cb0 <devcons_read+0x36>
+  802cad:	41 ff d4             	call   *%r12
+  802cb0:	ff d3                	call   *%rbx
+  802cb2:	85 c0                	test   %eax,%eax
+  802cb4:	74 f7                	je     802cad <devcons_read+0x33>
+    if (c < 0) return c;
+  802cb6:	48 63 d0             	movslq %eax,%rdx
+  802cb9:	78 13                	js     802cce <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802cbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cc0:	83 f8 04             	cmp    $0x4,%eax
+  802cc3:	74 09                	je     802cce <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802cc5:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802cc9:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802cce:	48 89 d0             	mov    %rdx,%rax
+  802cd1:	48 83 c4 08          	add    $0x8,%rsp
+  802cd5:	5b                   	pop    %rbx
+  802cd6:	41 5c                	pop    %r12
+  802cd8:	41 5d                	pop    %r13
+  802cda:	5d                   	pop    %rbp
+  802cdb:	c3                   	ret
+  802cdc:	48 89 d0             	mov    %rdx,%rax
+  802cdf:	c3                   	ret
+
+0000000000802ce0 <cputchar>:
+cputchar(int ch) {
+  802ce0:	55                   	push   %rbp
+  802ce1:	48 89 e5             	mov    %rsp,%rbp
+  802ce4:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802ce8:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802cec:	be 01 00 00 00       	mov    $0x1,%esi
+  802cf1:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802cf5:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  802cfc:	00 00 00 
+  802cff:	ff d0                	call   *%rax
+}
+  802d01:	c9                   	leave
+  802d02:	c3                   	ret
+
+0000000000802d03 <getchar>:
+getchar(void) {
+  802d03:	55                   	push   %rbp
+  802d04:	48 89 e5             	mov    %rsp,%rbp
+  802d07:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802d0b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802d10:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802d14:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d19:	48 b8 77 1e 80 00 00 	movabs $0x801e77,%rax
+  802d20:	00 00 00 
+  802d23:	ff d0                	call   *%rax
+  802d25:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802d27:	85 c0                	test   %eax,%eax
+  802d29:	78 06                	js     802d31 <getchar+0x2e>
+  802d2b:	74 08                	je     802d35 <getchar+0x32>
+  802d2d:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802d31:	89 d0                	mov    %edx,%eax
+  802d33:	c9                   	leave
+  802d34:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802d35:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802d3a:	eb f5                	jmp    802d31 <getchar+0x2e>
+
+0000000000802d3c <iscons>:
+iscons(int fdnum) {
+  802d3c:	55                   	push   %rbp
+  802d3d:	48 89 e5             	mov    %rsp,%rbp
+  802d40:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802d44:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d48:	48 b8 94 1b 80 00 00 	movabs $0x801b94,%rax
+  802d4f:	00 00 00 
+  802d52:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d54:	85 c0                	test   %eax,%eax
+  802d56:	78 18                	js     802d70 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802d58:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d5c:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802d63:	00 00 00 
+  802d66:	8b 00                	mov    (%rax),%eax
+  802d68:	39 02                	cmp    %eax,(%rdx)
+  802d6a:	0f 94 c0             	sete   %al
+  802d6d:	0f b6 c0             	movzbl %al,%eax
+}
+  802d70:	c9                   	leave
+  802d71:	c3                   	ret
+
+0000000000802d72 <opencons>:
+opencons(void) {
+  802d72:	55                   	push   %rbp
+  802d73:	48 89 e5             	mov    %rsp,%rbp
+  802d76:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802d7a:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802d7e:	48 b8 34 1b 80 00 00 	movabs $0x801b34,%rax
+  802d85:	00 00 00 
+  802d88:	ff d0                	call   *%rax
+  802d8a:	85 c0                	test   %eax,%eax
+  802d8c:	78 49                	js     802dd7 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802d8e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802d93:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d98:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802d9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802da1:	48 b8 64 14 80 00 00 	movabs $0x801464,%rax
+  802da8:	00 00 00 
+  802dab:	ff d0                	call   *%rax
+  802dad:	85 c0                	test   %eax,%eax
+  802daf:	78 26                	js     802dd7 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802db1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802db5:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802dbc:	00 00 
+  802dbe:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802dc0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802dc4:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802dcb:	48 b8 06 1b 80 00 00 	movabs $0x801b06,%rax
+  802dd2:	00 00 00 
+  802dd5:	ff d0                	call   *%rax
+}
+  802dd7:	c9                   	leave
+  802dd8:	c3                   	ret
+
+0000000000802dd9 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802dd9:	55                   	push   %rbp
+  802dda:	48 89 e5             	mov    %rsp,%rbp
+  802ddd:	41 54                	push   %r12
+  802ddf:	53                   	push   %rbx
+  802de0:	48 89 fb             	mov    %rdi,%rbx
+  802de3:	48 89 f7             	mov    %rsi,%rdi
+  802de6:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802de9:	48 85 f6             	test   %rsi,%rsi
+  802dec:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802df3:	00 00 00 
+  802df6:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802dfa:	be 00 10 00 00       	mov    $0x1000,%esi
+  802dff:	48 b8 ce 17 80 00 00 	movabs $0x8017ce,%rax
+  802e06:	00 00 00 
+  802e09:	ff d0                	call   *%rax
+    if (res < 0) {
+  802e0b:	85 c0                	test   %eax,%eax
+  802e0d:	78 45                	js     802e54 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802e0f:	48 85 db             	test   %rbx,%rbx
+  802e12:	74 12                	je     802e26 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802e14:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e1b:	00 00 00 
+  802e1e:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802e24:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802e26:	4d 85 e4             	test   %r12,%r12
+  802e29:	74 14                	je     802e3f <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802e2b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e32:	00 00 00 
+  802e35:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802e3b:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802e3f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e46:	00 00 00 
+  802e49:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802e4f:	5b                   	pop    %rbx
+  802e50:	41 5c                	pop    %r12
+  802e52:	5d                   	pop    %rbp
+  802e53:	c3                   	ret
+        if (from_env_store)
+  802e54:	48 85 db             	test   %rbx,%rbx
+  802e57:	74 06                	je     802e5f <ipc_recv+0x86>
+            *from_env_store = 0;
+  802e59:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802e5f:	4d 85 e4             	test   %r12,%r12
+  802e62:	74 eb                	je     802e4f <ipc_recv+0x76>
+            *perm_store = 0;
+  802e64:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802e6b:	00 
+  802e6c:	eb e1                	jmp    802e4f <ipc_recv+0x76>
+
+0000000000802e6e <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802e6e:	55                   	push   %rbp
+  802e6f:	48 89 e5             	mov    %rsp,%rbp
+  802e72:	41 57                	push   %r15
+  802e74:	41 56                	push   %r14
+  802e76:	41 55                	push   %r13
+  802e78:	41 54                	push   %r12
+  802e7a:	53                   	push   %rbx
+  802e7b:	48 83 ec 18          	sub    $0x18,%rsp
+  802e7f:	41 89 fd             	mov    %edi,%r13d
+  802e82:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802e85:	48 89 d3             	mov    %rdx,%rbx
+  802e88:	49 89 cc             	mov    %rcx,%r12
+  802e8b:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802e8f:	48 85 d2             	test   %rdx,%rdx
+  802e92:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802e99:	00 00 00 
+  802e9c:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802ea0:	49 be a2 17 80 00 00 	movabs $0x8017a2,%r14
+  802ea7:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802eaa:	49 bf d5 13 80 00 00 	movabs $0x8013d5,%r15
+  802eb1:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802eb4:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802eb7:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802ebb:	4c 89 e1             	mov    %r12,%rcx
+  802ebe:	48 89 da             	mov    %rbx,%rdx
+  802ec1:	44 89 ef             	mov    %r13d,%edi
+  802ec4:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802ec7:	85 c0                	test   %eax,%eax
+  802ec9:	74 34                	je     802eff <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802ecb:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802ece:	75 05                	jne    802ed5 <ipc_send+0x67>
+        sys_yield();
+  802ed0:	41 ff d7             	call   *%r15
+    while (true) {
+  802ed3:	eb df                	jmp    802eb4 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802ed5:	48 ba 60 37 80 00 00 	movabs $0x803760,%rdx
+  802edc:	00 00 00 
+  802edf:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802ee4:	48 bf 79 37 80 00 00 	movabs $0x803779,%rdi
+  802eeb:	00 00 00 
+  802eee:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef3:	48 b9 3f 04 80 00 00 	movabs $0x80043f,%rcx
+  802efa:	00 00 00 
+  802efd:	ff d1                	call   *%rcx
+    }
+}
+  802eff:	48 83 c4 18          	add    $0x18,%rsp
+  802f03:	5b                   	pop    %rbx
+  802f04:	41 5c                	pop    %r12
+  802f06:	41 5d                	pop    %r13
+  802f08:	41 5e                	pop    %r14
+  802f0a:	41 5f                	pop    %r15
+  802f0c:	5d                   	pop    %rbp
+  802f0d:	c3                   	ret
+
+0000000000802f0e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802f0e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802f13:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802f1a:	00 00 00 
+  802f1d:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802f24:	48 01 ca             	add    %rcx,%rdx
+  802f27:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802f2d:	39 fa                	cmp    %edi,%edx
+  802f2f:	74 12                	je     802f43 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802f31:	48 83 c0 01          	add    $0x1,%rax
+  802f35:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802f3b:	75 e0                	jne    802f1d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f42:	c3                   	ret
+            return envs[i].env_id;
+  802f43:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802f4a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802f51:	00 00 00 
+  802f54:	48 01 d0             	add    %rdx,%rax
+  802f57:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802f5d:	c3                   	ret
+  802f5e:	66 90                	xchg   %ax,%ax
+
+0000000000802f60 <__rodata_start>:
+  802f60:	20 53 48             	and    %dl,0x48(%rbx)
+  802f63:	41 52                	push   %r10
+  802f65:	45 00 20             	add    %r12b,(%r8)
+  802f68:	43                   	rex.XB
+  802f69:	4f 57                	rex.WRXB push %r15
+  802f6b:	00 45 49             	add    %al,0x49(%rbp)
+  802f6e:	44 3a 20             	cmp    (%rax),%r12b
+  802f71:	25 64 2c 20 50       	and    $0x50202c64,%eax
+  802f76:	45                   	rex.RB
+  802f77:	49                   	rex.WB
+  802f78:	44 3a 20             	cmp    (%rax),%r12b
+  802f7b:	25 64 0a 00 4d       	and    $0x4d000a64,%eax
+  802f80:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802f82:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f83:	72 79                	jb     802ffe <__rodata_start+0x9e>
+  802f85:	20 75 73             	and    %dh,0x73(%rbp)
+  802f88:	61                   	(bad)
+  802f89:	67 65 20 73 75       	and    %dh,%gs:0x75(%ebx)
+  802f8e:	6d                   	insl   (%dx),%es:(%rdi)
+  802f8f:	6d                   	insl   (%dx),%es:(%rdi)
+  802f90:	61                   	(bad)
+  802f91:	72 79                	jb     80300c <__rodata_start+0xac>
+  802f93:	3a 0a                	cmp    (%rdx),%cl
+  802f95:	00 20                	add    %ah,(%rax)
+  802f97:	20 50 54             	and    %dl,0x54(%rax)
+  802f9a:	45 5f                	rex.RB pop %r15
+  802f9c:	50                   	push   %rax
+  802f9d:	3a 20                	cmp    (%rax),%ah
+  802f9f:	25 6c 75 0a 00       	and    $0xa756c,%eax
+  802fa4:	20 20                	and    %ah,(%rax)
+  802fa6:	50                   	push   %rax
+  802fa7:	54                   	push   %rsp
+  802fa8:	45 5f                	rex.RB pop %r15
+  802faa:	55                   	push   %rbp
+  802fab:	3a 20                	cmp    (%rax),%ah
+  802fad:	25 6c 75 0a 00       	and    $0xa756c,%eax
+  802fb2:	20 20                	and    %ah,(%rax)
+  802fb4:	50                   	push   %rax
+  802fb5:	54                   	push   %rsp
+  802fb6:	45 5f                	rex.RB pop %r15
+  802fb8:	57                   	push   %rdi
+  802fb9:	3a 20                	cmp    (%rax),%ah
+  802fbb:	25 6c 75 0a 00       	and    $0xa756c,%eax
+  802fc0:	20 20                	and    %ah,(%rax)
+  802fc2:	50                   	push   %rax
+  802fc3:	54                   	push   %rsp
+  802fc4:	45 5f                	rex.RB pop %r15
+  802fc6:	43                   	rex.XB
+  802fc7:	4f 57                	rex.WRXB push %r15
+  802fc9:	3a 20                	cmp    (%rax),%ah
+  802fcb:	25 6c 75 0a 00       	and    $0xa756c,%eax
+  802fd0:	70 69                	jo     80303b <__rodata_start+0xdb>
+  802fd2:	70 65                	jo     803039 <__rodata_start+0xd9>
+  802fd4:	28 29                	sub    %ch,(%rcx)
+  802fd6:	20 66 61             	and    %ah,0x61(%rsi)
+  802fd9:	69 6c 65 64 0a 00 75 	imul   $0x7375000a,0x64(%rbp,%riz,2),%ebp
+  802fe0:	73 
+  802fe1:	65 72 2f             	gs jb  803013 <__rodata_start+0xb3>
+  802fe4:	6d                   	insl   (%dx),%es:(%rdi)
+  802fe5:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802fe7:	6c                   	insb   (%dx),%es:(%rdi)
+  802fe8:	61                   	(bad)
+  802fe9:	79 6f                	jns    80305a <__rodata_start+0xfa>
+  802feb:	75 74                	jne    803061 <__rodata_start+0x101>
+  802fed:	2e 63 00             	cs movsxd (%rax),%eax
+  802ff0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802ff2:	72 6b                	jb     80305f <__rodata_start+0xff>
+  802ff4:	28 29                	sub    %ch,(%rcx)
+  802ff6:	20 66 61             	and    %ah,0x61(%rsi)
+  802ff9:	69 6c 65 64 0a 00 3d 	imul   $0x3d3d000a,0x64(%rbp,%riz,2),%ebp
+  803000:	3d 
+  803001:	3d 3d 20 43 68       	cmp    $0x6843203d,%eax
+  803006:	69 6c 64 0a 00 3d 3d 	imul   $0x3d3d3d00,0xa(%rsp,%riz,2),%ebp
+  80300d:	3d 
+  80300e:	3d 20 50 61 72       	cmp    $0x72615020,%eax
+  803013:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803015:	74 0a                	je     803021 <__rodata_start+0xc1>
+  803017:	00 70 6d             	add    %dh,0x6d(%rax)
+  80301a:	6c                   	insb   (%dx),%es:(%rdi)
+  80301b:	34 3d                	xor    $0x3d,%al
+  80301d:	25 70 20 75 76       	and    $0x76752070,%eax
+  803022:	70 6d                	jo     803091 <__rodata_start+0x131>
+  803024:	6c                   	insb   (%dx),%es:(%rdi)
+  803025:	34 3d                	xor    $0x3d,%al
+  803027:	25 70 20 75 76       	and    $0x76752070,%eax
+  80302c:	70 64                	jo     803092 <__rodata_start+0x132>
+  80302e:	70 3d                	jo     80306d <__rodata_start+0x10d>
+  803030:	25 70 20 75 76       	and    $0x76752070,%eax
+  803035:	70 64                	jo     80309b <__rodata_start+0x13b>
+  803037:	3d 25 70 20 75       	cmp    $0x75207025,%eax
+  80303c:	76 70                	jbe    8030ae <__rodata_start+0x14e>
+  80303e:	74 3d                	je     80307d <__rodata_start+0x11d>
+  803040:	25 70 0a 00 00       	and    $0xa70,%eax
+  803045:	00 00                	add    %al,(%rax)
+  803047:	00 5b 25             	add    %bl,0x25(%rbx)
+  80304a:	70 5d                	jo     8030a9 <__rodata_start+0x149>
+  80304c:	20 25 6c 78 20 2d    	and    %ah,0x2d20786c(%rip)        # 2da0a8be <__bss_end+0x2d2028be>
+  803052:	3e 20 25 30 38 6c 78 	ds and %ah,0x786c3830(%rip)        # 78ec6889 <__bss_end+0x786be889>
+  803059:	3a 20                	cmp    (%rax),%ah
+  80305b:	25 63 20 25 63       	and    $0x63252063,%eax
+  803060:	20 25 63 20 7c 25    	and    %ah,0x257c2063(%rip)        # 25fc50c9 <__bss_end+0x257bd0c9>
+  803066:	73 25                	jae    80308d <__rodata_start+0x12d>
+  803068:	73 0a                	jae    803074 <__rodata_start+0x114>
+  80306a:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  803071:	77 6e                	ja     8030e1 <__rodata_start+0x181>
+  803073:	3e 00 0f             	ds add %cl,(%rdi)
+  803076:	1f                   	(bad)
+  803077:	00 5b 25             	add    %bl,0x25(%rbx)
+  80307a:	30 38                	xor    %bh,(%rax)
+  80307c:	78 5d                	js     8030db <__rodata_start+0x17b>
+  80307e:	20 75 73             	and    %dh,0x73(%rbp)
+  803081:	65 72 20             	gs jb  8030a4 <__rodata_start+0x144>
+  803084:	70 61                	jo     8030e7 <__rodata_start+0x187>
+  803086:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803087:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80308e:	73 20                	jae    8030b0 <__rodata_start+0x150>
+  803090:	61                   	(bad)
+  803091:	74 20                	je     8030b3 <__rodata_start+0x153>
+  803093:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803098:	3a 20                	cmp    (%rax),%ah
+  80309a:	00 30                	add    %dh,(%rax)
+  80309c:	31 32                	xor    %esi,(%rdx)
+  80309e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8030a5:	41                   	rex.B
+  8030a6:	42                   	rex.X
+  8030a7:	43                   	rex.XB
+  8030a8:	44                   	rex.R
+  8030a9:	45                   	rex.RB
+  8030aa:	46 00 30             	rex.RX add %r14b,(%rax)
+  8030ad:	31 32                	xor    %esi,(%rdx)
+  8030af:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8030b6:	61                   	(bad)
+  8030b7:	62 63 64 65 66       	(bad)
+  8030bc:	00 28                	add    %ch,(%rax)
+  8030be:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030bf:	75 6c                	jne    80312d <__rodata_start+0x1cd>
+  8030c1:	6c                   	insb   (%dx),%es:(%rdi)
+  8030c2:	29 00                	sub    %eax,(%rax)
+  8030c4:	65 72 72             	gs jb  803139 <__rodata_start+0x1d9>
+  8030c7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030c8:	72 20                	jb     8030ea <__rodata_start+0x18a>
+  8030ca:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8030cf:	73 70                	jae    803141 <__rodata_start+0x1e1>
+  8030d1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8030d5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8030dc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030dd:	72 00                	jb     8030df <__rodata_start+0x17f>
+  8030df:	62 61 64 20 65       	(bad)
+  8030e4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030e5:	76 69                	jbe    803150 <__rodata_start+0x1f0>
+  8030e7:	72 6f                	jb     803158 <__rodata_start+0x1f8>
+  8030e9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030ea:	6d                   	insl   (%dx),%es:(%rdi)
+  8030eb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030ed:	74 00                	je     8030ef <__rodata_start+0x18f>
+  8030ef:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8030f6:	20 70 61             	and    %dh,0x61(%rax)
+  8030f9:	72 61                	jb     80315c <__rodata_start+0x1fc>
+  8030fb:	6d                   	insl   (%dx),%es:(%rdi)
+  8030fc:	65 74 65             	gs je  803164 <__rodata_start+0x204>
+  8030ff:	72 00                	jb     803101 <__rodata_start+0x1a1>
+  803101:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803102:	75 74                	jne    803178 <__rodata_start+0x218>
+  803104:	20 6f 66             	and    %ch,0x66(%rdi)
+  803107:	20 6d 65             	and    %ch,0x65(%rbp)
+  80310a:	6d                   	insl   (%dx),%es:(%rdi)
+  80310b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80310c:	72 79                	jb     803187 <__rodata_start+0x227>
+  80310e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803111:	74 20                	je     803133 <__rodata_start+0x1d3>
+  803113:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803114:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803118:	76 69                	jbe    803183 <__rodata_start+0x223>
+  80311a:	72 6f                	jb     80318b <__rodata_start+0x22b>
+  80311c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80311d:	6d                   	insl   (%dx),%es:(%rdi)
+  80311e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803120:	74 73                	je     803195 <__rodata_start+0x235>
+  803122:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803125:	72 72                	jb     803199 <__rodata_start+0x239>
+  803127:	75 70                	jne    803199 <__rodata_start+0x239>
+  803129:	74 65                	je     803190 <__rodata_start+0x230>
+  80312b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803130:	75 67                	jne    803199 <__rodata_start+0x239>
+  803132:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803135:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803137:	00 73 65             	add    %dh,0x65(%rbx)
+  80313a:	67 6d                	insl   (%dx),%es:(%edi)
+  80313c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80313e:	74 61                	je     8031a1 <__rodata_start+0x241>
+  803140:	74 69                	je     8031ab <__rodata_start+0x24b>
+  803142:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803143:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803144:	20 66 61             	and    %ah,0x61(%rsi)
+  803147:	75 6c                	jne    8031b5 <__rodata_start+0x255>
+  803149:	74 00                	je     80314b <__rodata_start+0x1eb>
+  80314b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803152:	20 45 4c             	and    %al,0x4c(%rbp)
+  803155:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803159:	61                   	(bad)
+  80315a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80315f:	20 73 75             	and    %dh,0x75(%rbx)
+  803162:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803165:	73 79                	jae    8031e0 <__rodata_start+0x280>
+  803167:	73 74                	jae    8031dd <__rodata_start+0x27d>
+  803169:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80316b:	20 63 61             	and    %ah,0x61(%rbx)
+  80316e:	6c                   	insb   (%dx),%es:(%rdi)
+  80316f:	6c                   	insb   (%dx),%es:(%rdi)
+  803170:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803173:	74 72                	je     8031e7 <__rodata_start+0x287>
+  803175:	79 20                	jns    803197 <__rodata_start+0x237>
+  803177:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803178:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803179:	74 20                	je     80319b <__rodata_start+0x23b>
+  80317b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80317d:	75 6e                	jne    8031ed <__rodata_start+0x28d>
+  80317f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803183:	76 20                	jbe    8031a5 <__rodata_start+0x245>
+  803185:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80318c:	72 65                	jb     8031f3 <__rodata_start+0x293>
+  80318e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803191:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803192:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803196:	65 78 70             	gs js  803209 <__rodata_start+0x2a9>
+  803199:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80319e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8031a1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8031a5:	20 66 69             	and    %ah,0x69(%rsi)
+  8031a8:	6c                   	insb   (%dx),%es:(%rdi)
+  8031a9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8031ad:	20 66 72             	and    %ah,0x72(%rsi)
+  8031b0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8031b5:	61                   	(bad)
+  8031b6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8031b9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031ba:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031bb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8031bf:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8031c2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031c3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031c4:	20 6d 61             	and    %ch,0x61(%rbp)
+  8031c7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031c8:	79 20                	jns    8031ea <__rodata_start+0x28a>
+  8031ca:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8031d1:	72 65                	jb     803238 <__rodata_start+0x2d8>
+  8031d3:	20 6f 70             	and    %ch,0x70(%rdi)
+  8031d6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8031d8:	00 66 69             	add    %ah,0x69(%rsi)
+  8031db:	6c                   	insb   (%dx),%es:(%rdi)
+  8031dc:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8031e0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8031e3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031e4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8031e7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031e8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031e9:	74 20                	je     80320b <__rodata_start+0x2ab>
+  8031eb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8031ed:	75 6e                	jne    80325d <__rodata_start+0x2fd>
+  8031ef:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8031f3:	76 61                	jbe    803256 <__rodata_start+0x2f6>
+  8031f5:	6c                   	insb   (%dx),%es:(%rdi)
+  8031f6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8031fd:	00 
+  8031fe:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803205:	72 65                	jb     80326c <__rodata_start+0x30c>
+  803207:	61                   	(bad)
+  803208:	64 79 20             	fs jns 80322b <__rodata_start+0x2cb>
+  80320b:	65 78 69             	gs js  803277 <__rodata_start+0x317>
+  80320e:	73 74                	jae    803284 <__rodata_start+0x324>
+  803210:	73 00                	jae    803212 <__rodata_start+0x2b2>
+  803212:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803213:	70 65                	jo     80327a <__rodata_start+0x31a>
+  803215:	72 61                	jb     803278 <__rodata_start+0x318>
+  803217:	74 69                	je     803282 <__rodata_start+0x322>
+  803219:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80321a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80321b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80321e:	74 20                	je     803240 <__rodata_start+0x2e0>
+  803220:	73 75                	jae    803297 <__rodata_start+0x337>
+  803222:	70 70                	jo     803294 <__rodata_start+0x334>
+  803224:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803225:	72 74                	jb     80329b <__rodata_start+0x33b>
+  803227:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  80322c:	65 72 61             	gs jb  803290 <__rodata_start+0x330>
+  80322f:	74 69                	je     80329a <__rodata_start+0x33a>
+  803231:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803232:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803233:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803236:	74 20                	je     803258 <__rodata_start+0x2f8>
+  803238:	70 65                	jo     80329f <__rodata_start+0x33f>
+  80323a:	72 6d                	jb     8032a9 <__rodata_start+0x349>
+  80323c:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  803243:	2e 
+  803244:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80324b:	00 
+  80324c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803253:	00 00 00 
+  803256:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80325d:	00 00 00 
+  803260:	7c 07                	jl     803269 <__rodata_start+0x309>
+  803262:	80 00 00             	addb   $0x0,(%rax)
+  803265:	00 00                	add    %al,(%rax)
+  803267:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80326d:	00 00                	add    %al,(%rax)
+  80326f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  803275:	00 00                	add    %al,(%rax)
+  803277:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80327d:	00 00                	add    %al,(%rax)
+  80327f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803285:	00 00                	add    %al,(%rax)
+  803287:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80328d:	00 00                	add    %al,(%rax)
+  80328f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803295:	00 00                	add    %al,(%rax)
+  803297:	00 9b 07 80 00 00    	add    %bl,0x8007(%rbx)
+  80329d:	00 00                	add    %al,(%rax)
+  80329f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8032a5:	00 00                	add    %al,(%rax)
+  8032a7:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8032ad:	00 00                	add    %al,(%rax)
+  8032af:	00 8f 07 80 00 00    	add    %cl,0x8007(%rdi)
+  8032b5:	00 00                	add    %al,(%rax)
+  8032b7:	00 09                	add    %cl,(%rcx)
+  8032b9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8032bf:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8032c5:	00 00                	add    %al,(%rax)
+  8032c7:	00 8f 07 80 00 00    	add    %cl,0x8007(%rdi)
+  8032cd:	00 00                	add    %al,(%rax)
+  8032cf:	00 d5                	add    %dl,%ch
+  8032d1:	07                   	(bad)
+  8032d2:	80 00 00             	addb   $0x0,(%rax)
+  8032d5:	00 00                	add    %al,(%rax)
+  8032d7:	00 d5                	add    %dl,%ch
+  8032d9:	07                   	(bad)
+  8032da:	80 00 00             	addb   $0x0,(%rax)
+  8032dd:	00 00                	add    %al,(%rax)
+  8032df:	00 d5                	add    %dl,%ch
+  8032e1:	07                   	(bad)
+  8032e2:	80 00 00             	addb   $0x0,(%rax)
+  8032e5:	00 00                	add    %al,(%rax)
+  8032e7:	00 d5                	add    %dl,%ch
+  8032e9:	07                   	(bad)
+  8032ea:	80 00 00             	addb   $0x0,(%rax)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 d5                	add    %dl,%ch
+  8032f1:	07                   	(bad)
+  8032f2:	80 00 00             	addb   $0x0,(%rax)
+  8032f5:	00 00                	add    %al,(%rax)
+  8032f7:	00 d5                	add    %dl,%ch
+  8032f9:	07                   	(bad)
+  8032fa:	80 00 00             	addb   $0x0,(%rax)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 d5                	add    %dl,%ch
+  803301:	07                   	(bad)
+  803302:	80 00 00             	addb   $0x0,(%rax)
+  803305:	00 00                	add    %al,(%rax)
+  803307:	00 d5                	add    %dl,%ch
+  803309:	07                   	(bad)
+  80330a:	80 00 00             	addb   $0x0,(%rax)
+  80330d:	00 00                	add    %al,(%rax)
+  80330f:	00 d5                	add    %dl,%ch
+  803311:	07                   	(bad)
+  803312:	80 00 00             	addb   $0x0,(%rax)
+  803315:	00 00                	add    %al,(%rax)
+  803317:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80331d:	00 00                	add    %al,(%rax)
+  80331f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803325:	00 00                	add    %al,(%rax)
+  803327:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803335:	00 00                	add    %al,(%rax)
+  803337:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80333d:	00 00                	add    %al,(%rax)
+  80333f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803345:	00 00                	add    %al,(%rax)
+  803347:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803355:	00 00                	add    %al,(%rax)
+  803357:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80335d:	00 00                	add    %al,(%rax)
+  80335f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803375:	00 00                	add    %al,(%rax)
+  803377:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80337d:	00 00                	add    %al,(%rax)
+  80337f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803385:	00 00                	add    %al,(%rax)
+  803387:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803395:	00 00                	add    %al,(%rax)
+  803397:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80339d:	00 00                	add    %al,(%rax)
+  80339f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8033a5:	00 00                	add    %al,(%rax)
+  8033a7:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8033bd:	00 00                	add    %al,(%rax)
+  8033bf:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8033dd:	00 00                	add    %al,(%rax)
+  8033df:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8033e5:	00 00                	add    %al,(%rax)
+  8033e7:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8033ed:	00 00                	add    %al,(%rax)
+  8033ef:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8033f5:	00 00                	add    %al,(%rax)
+  8033f7:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8033fd:	00 00                	add    %al,(%rax)
+  8033ff:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 e0                	add    %ah,%al
+  803409:	0c 80                	or     $0x80,%al
+  80340b:	00 00                	add    %al,(%rax)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80341d:	00 00                	add    %al,(%rax)
+  80341f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80342d:	00 00                	add    %al,(%rax)
+  80342f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803435:	00 00                	add    %al,(%rax)
+  803437:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80343d:	00 00                	add    %al,(%rax)
+  80343f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803445:	00 00                	add    %al,(%rax)
+  803447:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803455:	00 00                	add    %al,(%rax)
+  803457:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80345d:	00 00                	add    %al,(%rax)
+  80345f:	00 2c 08             	add    %ch,(%rax,%rcx,1)
+  803462:	80 00 00             	addb   $0x0,(%rax)
+  803465:	00 00                	add    %al,(%rax)
+  803467:	00 fb                	add    %bh,%bl
+  803469:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80346f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803475:	00 00                	add    %al,(%rax)
+  803477:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80347d:	00 00                	add    %al,(%rax)
+  80347f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803485:	00 00                	add    %al,(%rax)
+  803487:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 5b 08             	add    %bl,0x8(%rbx)
+  803492:	80 00 00             	addb   $0x0,(%rax)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  80349d:	00 00                	add    %al,(%rax)
+  80349f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8034a5:	00 00                	add    %al,(%rax)
+  8034a7:	00 21                	add    %ah,(%rcx)
+  8034a9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8034af:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8034bd:	00 00                	add    %al,(%rax)
+  8034bf:	00 a3 0b 80 00 00    	add    %ah,0x800b(%rbx)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 6d 0c             	add    %ch,0xc(%rbp)
+  8034ca:	80 00 00             	addb   $0x0,(%rax)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8034dd:	00 00                	add    %al,(%rax)
+  8034df:	00 f2                	add    %dh,%dl
+  8034e1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8034e7:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 cf                	add    %cl,%bh
+  8034f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8034f7:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  8034fd:	00 00                	add    %al,(%rax)
+  8034ff:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803505:	00 00                	add    %al,(%rax)
+  803507:	00 e0                	add    %ah,%al
+  803509:	0c 80                	or     $0x80,%al
+  80350b:	00 00                	add    %al,(%rax)
+  80350d:	00 00                	add    %al,(%rax)
+  80350f:	00 bd 0d 80 00 00    	add    %bh,0x800d(%rbp)
+  803515:	00 00                	add    %al,(%rax)
+  803517:	00 85 07 80 00 00    	add    %al,0x8007(%rbp)
+  80351d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803520 <error_string>:
+	...
+  803528:	cd 30 80 00 00 00 00 00 df 30 80 00 00 00 00 00     .0.......0......
+  803538:	ef 30 80 00 00 00 00 00 01 31 80 00 00 00 00 00     .0.......1......
+  803548:	0f 31 80 00 00 00 00 00 23 31 80 00 00 00 00 00     .1......#1......
+  803558:	38 31 80 00 00 00 00 00 4b 31 80 00 00 00 00 00     81......K1......
+  803568:	5d 31 80 00 00 00 00 00 71 31 80 00 00 00 00 00     ]1......q1......
+  803578:	81 31 80 00 00 00 00 00 94 31 80 00 00 00 00 00     .1.......1......
+  803588:	ab 31 80 00 00 00 00 00 c1 31 80 00 00 00 00 00     .1.......1......
+  803598:	d9 31 80 00 00 00 00 00 f1 31 80 00 00 00 00 00     .1.......1......
+  8035a8:	fe 31 80 00 00 00 00 00 d0 35 80 00 00 00 00 00     .1.......5......
+  8035b8:	12 32 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .2..............
+  8035c8:	2a 32 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     *2......file is 
+  8035d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8035e8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8035f8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803608:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803618:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  803628:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  803638:	6c 69 62 2f 66 6f 72 6b 2e 63 00 0f 1f 44 00 00     lib/fork.c...D..
+  803648:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803658:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803668:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803678:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803688:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803698:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8036a8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8036b8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8036c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036d8:	0f 1f 84 00 00 00 00 00                             ........
+
+00000000008036e0 <devtab>:
+  8036e0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8036f0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803700:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803710:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803720:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803730:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803740:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803750:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803760:	69 70 63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64     ipc_send: failed
+  803770:	20 74 6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63      to send.lib/ipc
+  803780:	2e 63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     .c.f.........f..
+  803790:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803800:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803810:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803820:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803830:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803840:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803850:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803860:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803870:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803880:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803890:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803900:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803910:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803920:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803930:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803940:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803950:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803960:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803970:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803980:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803990:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803aa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ab0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ac0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ad0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ae0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803af0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ba0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803be0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ca0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ce0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803da0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
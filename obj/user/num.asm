@@ -0,0 +1,6034 @@
+
+obj/user/num:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 19 02 00 00       	call   80023c <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <num>:
+
+int bol = 1;
+int line = 0;
+
+void
+num(int f, const char *s) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+  800036:	41 89 fc             	mov    %edi,%r12d
+  800039:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    long n;
+    int r;
+    char c;
+
+    while ((n = read(f, &c, 1)) > 0) {
+  80003d:	49 bd 3e 1c 80 00 00 	movabs $0x801c3e,%r13
+  800044:	00 00 00 
+        if (bol) {
+  800047:	48 bb 00 40 80 00 00 	movabs $0x804000,%rbx
+  80004e:	00 00 00 
+            printf("%5d ", ++line);
+  800051:	49 be 00 50 80 00 00 	movabs $0x805000,%r14
+  800058:	00 00 00 
+  80005b:	49 bf d0 2e 80 00 00 	movabs $0x802ed0,%r15
+  800062:	00 00 00 
+  800065:	eb 25                	jmp    80008c <num+0x67>
+            bol = 0;
+        }
+        if ((r = write(1, &c, 1)) != 1)
+  800067:	ba 01 00 00 00       	mov    $0x1,%edx
+  80006c:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  800070:	bf 01 00 00 00       	mov    $0x1,%edi
+  800075:	48 b8 6d 1d 80 00 00 	movabs $0x801d6d,%rax
+  80007c:	00 00 00 
+  80007f:	ff d0                	call   *%rax
+  800081:	83 f8 01             	cmp    $0x1,%eax
+  800084:	75 44                	jne    8000ca <num+0xa5>
+            panic("write error copying %s: %i", s, r);
+        if (c == '\n')
+  800086:	80 7d cf 0a          	cmpb   $0xa,-0x31(%rbp)
+  80008a:	74 70                	je     8000fc <num+0xd7>
+    while ((n = read(f, &c, 1)) > 0) {
+  80008c:	ba 01 00 00 00       	mov    $0x1,%edx
+  800091:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  800095:	44 89 e7             	mov    %r12d,%edi
+  800098:	41 ff d5             	call   *%r13
+  80009b:	48 85 c0             	test   %rax,%rax
+  80009e:	7e 71                	jle    800111 <num+0xec>
+        if (bol) {
+  8000a0:	83 3b 00             	cmpl   $0x0,(%rbx)
+  8000a3:	74 c2                	je     800067 <num+0x42>
+            printf("%5d ", ++line);
+  8000a5:	41 8b 06             	mov    (%r14),%eax
+  8000a8:	8d 70 01             	lea    0x1(%rax),%esi
+  8000ab:	41 89 36             	mov    %esi,(%r14)
+  8000ae:	4c 89 ff             	mov    %r15,%rdi
+  8000b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b6:	48 ba 2b 24 80 00 00 	movabs $0x80242b,%rdx
+  8000bd:	00 00 00 
+  8000c0:	ff d2                	call   *%rdx
+            bol = 0;
+  8000c2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8000c8:	eb 9d                	jmp    800067 <num+0x42>
+            panic("write error copying %s: %i", s, r);
+  8000ca:	41 89 c0             	mov    %eax,%r8d
+  8000cd:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8000d1:	48 ba d5 2e 80 00 00 	movabs $0x802ed5,%rdx
+  8000d8:	00 00 00 
+  8000db:	be 12 00 00 00       	mov    $0x12,%esi
+  8000e0:	48 bf f0 2e 80 00 00 	movabs $0x802ef0,%rdi
+  8000e7:	00 00 00 
+  8000ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ef:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  8000f6:	00 00 00 
+  8000f9:	41 ff d1             	call   *%r9
+            bol = 1;
+  8000fc:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800103:	00 00 00 
+  800106:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+  80010c:	e9 4a ff ff ff       	jmp    80005b <num+0x36>
+    }
+    if (n < 0) panic("error reading %s: %i", s, (int)n);
+  800111:	78 0f                	js     800122 <num+0xfd>
+}
+  800113:	48 83 c4 28          	add    $0x28,%rsp
+  800117:	5b                   	pop    %rbx
+  800118:	41 5c                	pop    %r12
+  80011a:	41 5d                	pop    %r13
+  80011c:	41 5e                	pop    %r14
+  80011e:	41 5f                	pop    %r15
+  800120:	5d                   	pop    %rbp
+  800121:	c3                   	ret
+    if (n < 0) panic("error reading %s: %i", s, (int)n);
+  800122:	41 89 c0             	mov    %eax,%r8d
+  800125:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  800129:	48 ba fb 2e 80 00 00 	movabs $0x802efb,%rdx
+  800130:	00 00 00 
+  800133:	be 16 00 00 00       	mov    $0x16,%esi
+  800138:	48 bf f0 2e 80 00 00 	movabs $0x802ef0,%rdi
+  80013f:	00 00 00 
+  800142:	b8 00 00 00 00       	mov    $0x0,%eax
+  800147:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  80014e:	00 00 00 
+  800151:	41 ff d1             	call   *%r9
+
+0000000000800154 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800154:	55                   	push   %rbp
+  800155:	48 89 e5             	mov    %rsp,%rbp
+  800158:	41 57                	push   %r15
+  80015a:	41 56                	push   %r14
+  80015c:	41 55                	push   %r13
+  80015e:	41 54                	push   %r12
+  800160:	53                   	push   %rbx
+  800161:	48 83 ec 08          	sub    $0x8,%rsp
+    binaryname = "num";
+  800165:	48 b8 10 2f 80 00 00 	movabs $0x802f10,%rax
+  80016c:	00 00 00 
+  80016f:	48 a3 08 40 80 00 00 	movabs %rax,0x804008
+  800176:	00 00 00 
+    if (argc == 1)
+  800179:	83 ff 01             	cmp    $0x1,%edi
+  80017c:	74 6f                	je     8001ed <umain+0x99>
+        num(0, "<stdin>");
+    else {
+        for (int i = 1; i < argc; i++) {
+  80017e:	7e 52                	jle    8001d2 <umain+0x7e>
+  800180:	4c 8d 66 08          	lea    0x8(%rsi),%r12
+  800184:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  800187:	4c 8d 7c c6 10       	lea    0x10(%rsi,%rax,8),%r15
+            int f = open(argv[i], O_RDONLY);
+  80018c:	49 bd fc 21 80 00 00 	movabs $0x8021fc,%r13
+  800193:	00 00 00 
+            if (f < 0)
+                panic("can't open %s: %i", argv[i], f);
+            else {
+                num(f, argv[i]);
+  800196:	49 be 25 00 80 00 00 	movabs $0x800025,%r14
+  80019d:	00 00 00 
+            int f = open(argv[i], O_RDONLY);
+  8001a0:	49 8b 3c 24          	mov    (%r12),%rdi
+  8001a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a9:	41 ff d5             	call   *%r13
+  8001ac:	89 c3                	mov    %eax,%ebx
+            if (f < 0)
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	78 58                	js     80020a <umain+0xb6>
+                num(f, argv[i]);
+  8001b2:	49 8b 34 24          	mov    (%r12),%rsi
+  8001b6:	89 c7                	mov    %eax,%edi
+  8001b8:	41 ff d6             	call   *%r14
+                close(f);
+  8001bb:	89 df                	mov    %ebx,%edi
+  8001bd:	48 b8 c0 1a 80 00 00 	movabs $0x801ac0,%rax
+  8001c4:	00 00 00 
+  8001c7:	ff d0                	call   *%rax
+        for (int i = 1; i < argc; i++) {
+  8001c9:	49 83 c4 08          	add    $0x8,%r12
+  8001cd:	4d 39 fc             	cmp    %r15,%r12
+  8001d0:	75 ce                	jne    8001a0 <umain+0x4c>
+            }
+        }
+    }
+    exit();
+  8001d2:	48 b8 e3 02 80 00 00 	movabs $0x8002e3,%rax
+  8001d9:	00 00 00 
+  8001dc:	ff d0                	call   *%rax
+}
+  8001de:	48 83 c4 08          	add    $0x8,%rsp
+  8001e2:	5b                   	pop    %rbx
+  8001e3:	41 5c                	pop    %r12
+  8001e5:	41 5d                	pop    %r13
+  8001e7:	41 5e                	pop    %r14
+  8001e9:	41 5f                	pop    %r15
+  8001eb:	5d                   	pop    %rbp
+  8001ec:	c3                   	ret
+        num(0, "<stdin>");
+  8001ed:	48 be 14 2f 80 00 00 	movabs $0x802f14,%rsi
+  8001f4:	00 00 00 
+  8001f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001fc:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800203:	00 00 00 
+  800206:	ff d0                	call   *%rax
+  800208:	eb c8                	jmp    8001d2 <umain+0x7e>
+                panic("can't open %s: %i", argv[i], f);
+  80020a:	49 8b 0c 24          	mov    (%r12),%rcx
+  80020e:	41 89 c0             	mov    %eax,%r8d
+  800211:	48 ba 1c 2f 80 00 00 	movabs $0x802f1c,%rdx
+  800218:	00 00 00 
+  80021b:	be 22 00 00 00       	mov    $0x22,%esi
+  800220:	48 bf f0 2e 80 00 00 	movabs $0x802ef0,%rdi
+  800227:	00 00 00 
+  80022a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022f:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  800236:	00 00 00 
+  800239:	41 ff d1             	call   *%r9
+
+000000000080023c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80023c:	55                   	push   %rbp
+  80023d:	48 89 e5             	mov    %rsp,%rbp
+  800240:	41 56                	push   %r14
+  800242:	41 55                	push   %r13
+  800244:	41 54                	push   %r12
+  800246:	53                   	push   %rbx
+  800247:	41 89 fd             	mov    %edi,%r13d
+  80024a:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80024d:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800254:	00 00 00 
+  800257:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80025e:	00 00 00 
+  800261:	48 39 c2             	cmp    %rax,%rdx
+  800264:	73 17                	jae    80027d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800266:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800269:	49 89 c4             	mov    %rax,%r12
+  80026c:	48 83 c3 08          	add    $0x8,%rbx
+  800270:	b8 00 00 00 00       	mov    $0x0,%eax
+  800275:	ff 53 f8             	call   *-0x8(%rbx)
+  800278:	4c 39 e3             	cmp    %r12,%rbx
+  80027b:	72 ef                	jb     80026c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  80027d:	48 b8 6b 12 80 00 00 	movabs $0x80126b,%rax
+  800284:	00 00 00 
+  800287:	ff d0                	call   *%rax
+  800289:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  80028c:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800293:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80029a:	00 00 00 
+  80029d:	48 01 d0             	add    %rdx,%rax
+  8002a0:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  8002a7:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002aa:	45 85 ed             	test   %r13d,%r13d
+  8002ad:	7e 0d                	jle    8002bc <libmain+0x80>
+  8002af:	49 8b 06             	mov    (%r14),%rax
+  8002b2:	48 a3 08 40 80 00 00 	movabs %rax,0x804008
+  8002b9:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002bc:	4c 89 f6             	mov    %r14,%rsi
+  8002bf:	44 89 ef             	mov    %r13d,%edi
+  8002c2:	48 b8 54 01 80 00 00 	movabs $0x800154,%rax
+  8002c9:	00 00 00 
+  8002cc:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8002ce:	48 b8 e3 02 80 00 00 	movabs $0x8002e3,%rax
+  8002d5:	00 00 00 
+  8002d8:	ff d0                	call   *%rax
+#endif
+}
+  8002da:	5b                   	pop    %rbx
+  8002db:	41 5c                	pop    %r12
+  8002dd:	41 5d                	pop    %r13
+  8002df:	41 5e                	pop    %r14
+  8002e1:	5d                   	pop    %rbp
+  8002e2:	c3                   	ret
+
+00000000008002e3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8002e3:	55                   	push   %rbp
+  8002e4:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8002e7:	48 b8 f3 1a 80 00 00 	movabs $0x801af3,%rax
+  8002ee:	00 00 00 
+  8002f1:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002f8:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  8002ff:	00 00 00 
+  800302:	ff d0                	call   *%rax
+}
+  800304:	5d                   	pop    %rbp
+  800305:	c3                   	ret
+
+0000000000800306 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800306:	55                   	push   %rbp
+  800307:	48 89 e5             	mov    %rsp,%rbp
+  80030a:	41 56                	push   %r14
+  80030c:	41 55                	push   %r13
+  80030e:	41 54                	push   %r12
+  800310:	53                   	push   %rbx
+  800311:	48 83 ec 50          	sub    $0x50,%rsp
+  800315:	49 89 fc             	mov    %rdi,%r12
+  800318:	41 89 f5             	mov    %esi,%r13d
+  80031b:	48 89 d3             	mov    %rdx,%rbx
+  80031e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800322:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800326:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80032a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800331:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800335:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800339:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80033d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800341:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  800348:	00 00 00 
+  80034b:	4c 8b 30             	mov    (%rax),%r14
+  80034e:	48 b8 6b 12 80 00 00 	movabs $0x80126b,%rax
+  800355:	00 00 00 
+  800358:	ff d0                	call   *%rax
+  80035a:	89 c6                	mov    %eax,%esi
+  80035c:	45 89 e8             	mov    %r13d,%r8d
+  80035f:	4c 89 e1             	mov    %r12,%rcx
+  800362:	4c 89 f2             	mov    %r14,%rdx
+  800365:	48 bf 38 2f 80 00 00 	movabs $0x802f38,%rdi
+  80036c:	00 00 00 
+  80036f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800374:	49 bc 56 04 80 00 00 	movabs $0x800456,%r12
+  80037b:	00 00 00 
+  80037e:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800381:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800385:	48 89 df             	mov    %rbx,%rdi
+  800388:	48 b8 f2 03 80 00 00 	movabs $0x8003f2,%rax
+  80038f:	00 00 00 
+  800392:	ff d0                	call   *%rax
+    cprintf("\n");
+  800394:	48 bf 3b 35 80 00 00 	movabs $0x80353b,%rdi
+  80039b:	00 00 00 
+  80039e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a3:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003a6:	cc                   	int3
+  8003a7:	eb fd                	jmp    8003a6 <_panic+0xa0>
+
+00000000008003a9 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003a9:	55                   	push   %rbp
+  8003aa:	48 89 e5             	mov    %rsp,%rbp
+  8003ad:	53                   	push   %rbx
+  8003ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8003b2:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003b5:	8b 06                	mov    (%rsi),%eax
+  8003b7:	8d 50 01             	lea    0x1(%rax),%edx
+  8003ba:	89 16                	mov    %edx,(%rsi)
+  8003bc:	48 98                	cltq
+  8003be:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8003c3:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8003c9:	74 0a                	je     8003d5 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8003cb:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8003cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003d3:	c9                   	leave
+  8003d4:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8003d5:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8003d9:	be ff 00 00 00       	mov    $0xff,%esi
+  8003de:	48 b8 a2 11 80 00 00 	movabs $0x8011a2,%rax
+  8003e5:	00 00 00 
+  8003e8:	ff d0                	call   *%rax
+        state->offset = 0;
+  8003ea:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003f0:	eb d9                	jmp    8003cb <putch+0x22>
+
+00000000008003f2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003f2:	55                   	push   %rbp
+  8003f3:	48 89 e5             	mov    %rsp,%rbp
+  8003f6:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003fd:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800400:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800407:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80040c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800411:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800414:	48 89 f1             	mov    %rsi,%rcx
+  800417:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80041e:	48 bf a9 03 80 00 00 	movabs $0x8003a9,%rdi
+  800425:	00 00 00 
+  800428:	48 b8 a6 05 80 00 00 	movabs $0x8005a6,%rax
+  80042f:	00 00 00 
+  800432:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800434:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80043b:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800442:	48 b8 a2 11 80 00 00 	movabs $0x8011a2,%rax
+  800449:	00 00 00 
+  80044c:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80044e:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800454:	c9                   	leave
+  800455:	c3                   	ret
+
+0000000000800456 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800456:	55                   	push   %rbp
+  800457:	48 89 e5             	mov    %rsp,%rbp
+  80045a:	48 83 ec 50          	sub    $0x50,%rsp
+  80045e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800462:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800466:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80046a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80046e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800472:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800479:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80047d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800481:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800485:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800489:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80048d:	48 b8 f2 03 80 00 00 	movabs $0x8003f2,%rax
+  800494:	00 00 00 
+  800497:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800499:	c9                   	leave
+  80049a:	c3                   	ret
+
+000000000080049b <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80049b:	55                   	push   %rbp
+  80049c:	48 89 e5             	mov    %rsp,%rbp
+  80049f:	41 57                	push   %r15
+  8004a1:	41 56                	push   %r14
+  8004a3:	41 55                	push   %r13
+  8004a5:	41 54                	push   %r12
+  8004a7:	53                   	push   %rbx
+  8004a8:	48 83 ec 18          	sub    $0x18,%rsp
+  8004ac:	49 89 fc             	mov    %rdi,%r12
+  8004af:	49 89 f5             	mov    %rsi,%r13
+  8004b2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004b6:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004b9:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8004bc:	41 89 cf             	mov    %ecx,%r15d
+  8004bf:	4c 39 fa             	cmp    %r15,%rdx
+  8004c2:	73 5b                	jae    80051f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8004c4:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8004c8:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8004cc:	85 db                	test   %ebx,%ebx
+  8004ce:	7e 0e                	jle    8004de <print_num+0x43>
+            putch(padc, put_arg);
+  8004d0:	4c 89 ee             	mov    %r13,%rsi
+  8004d3:	44 89 f7             	mov    %r14d,%edi
+  8004d6:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8004d9:	83 eb 01             	sub    $0x1,%ebx
+  8004dc:	75 f2                	jne    8004d0 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8004de:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8004e2:	48 b9 6c 2f 80 00 00 	movabs $0x802f6c,%rcx
+  8004e9:	00 00 00 
+  8004ec:	48 b8 5b 2f 80 00 00 	movabs $0x802f5b,%rax
+  8004f3:	00 00 00 
+  8004f6:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8004fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800503:	49 f7 f7             	div    %r15
+  800506:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80050a:	4c 89 ee             	mov    %r13,%rsi
+  80050d:	41 ff d4             	call   *%r12
+}
+  800510:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800514:	5b                   	pop    %rbx
+  800515:	41 5c                	pop    %r12
+  800517:	41 5d                	pop    %r13
+  800519:	41 5e                	pop    %r14
+  80051b:	41 5f                	pop    %r15
+  80051d:	5d                   	pop    %rbp
+  80051e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80051f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800523:	ba 00 00 00 00       	mov    $0x0,%edx
+  800528:	49 f7 f7             	div    %r15
+  80052b:	48 83 ec 08          	sub    $0x8,%rsp
+  80052f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800533:	52                   	push   %rdx
+  800534:	45 0f be c9          	movsbl %r9b,%r9d
+  800538:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80053c:	48 89 c2             	mov    %rax,%rdx
+  80053f:	48 b8 9b 04 80 00 00 	movabs $0x80049b,%rax
+  800546:	00 00 00 
+  800549:	ff d0                	call   *%rax
+  80054b:	48 83 c4 10          	add    $0x10,%rsp
+  80054f:	eb 8d                	jmp    8004de <print_num+0x43>
+
+0000000000800551 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800551:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800555:	48 8b 06             	mov    (%rsi),%rax
+  800558:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80055c:	73 0a                	jae    800568 <sprintputch+0x17>
+        *state->start++ = ch;
+  80055e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800562:	48 89 16             	mov    %rdx,(%rsi)
+  800565:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800568:	c3                   	ret
+
+0000000000800569 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800569:	55                   	push   %rbp
+  80056a:	48 89 e5             	mov    %rsp,%rbp
+  80056d:	48 83 ec 50          	sub    $0x50,%rsp
+  800571:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800575:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800579:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80057d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800584:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800588:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80058c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800590:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800594:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800598:	48 b8 a6 05 80 00 00 	movabs $0x8005a6,%rax
+  80059f:	00 00 00 
+  8005a2:	ff d0                	call   *%rax
+}
+  8005a4:	c9                   	leave
+  8005a5:	c3                   	ret
+
+00000000008005a6 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005a6:	55                   	push   %rbp
+  8005a7:	48 89 e5             	mov    %rsp,%rbp
+  8005aa:	41 57                	push   %r15
+  8005ac:	41 56                	push   %r14
+  8005ae:	41 55                	push   %r13
+  8005b0:	41 54                	push   %r12
+  8005b2:	53                   	push   %rbx
+  8005b3:	48 83 ec 38          	sub    $0x38,%rsp
+  8005b7:	49 89 fe             	mov    %rdi,%r14
+  8005ba:	49 89 f5             	mov    %rsi,%r13
+  8005bd:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8005c0:	48 8b 01             	mov    (%rcx),%rax
+  8005c3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8005c7:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8005cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005cf:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8005d3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8005d7:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8005db:	0f b6 3b             	movzbl (%rbx),%edi
+  8005de:	40 80 ff 25          	cmp    $0x25,%dil
+  8005e2:	74 18                	je     8005fc <vprintfmt+0x56>
+            if (!ch) return;
+  8005e4:	40 84 ff             	test   %dil,%dil
+  8005e7:	0f 84 b1 06 00 00    	je     800c9e <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8005ed:	40 0f b6 ff          	movzbl %dil,%edi
+  8005f1:	4c 89 ee             	mov    %r13,%rsi
+  8005f4:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005f7:	4c 89 e3             	mov    %r12,%rbx
+  8005fa:	eb db                	jmp    8005d7 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8005fc:	be 00 00 00 00       	mov    $0x0,%esi
+  800601:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800605:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80060a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800610:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800617:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80061b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800620:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800625:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800628:	83 e8 23             	sub    $0x23,%eax
+  80062b:	3c 57                	cmp    $0x57,%al
+  80062d:	0f 87 51 06 00 00    	ja     800c84 <vprintfmt+0x6de>
+  800633:	0f b6 c0             	movzbl %al,%eax
+  800636:	48 b9 20 31 80 00 00 	movabs $0x803120,%rcx
+  80063d:	00 00 00 
+  800640:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800643:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800646:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80064a:	eb cf                	jmp    80061b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80064c:	49 89 dc             	mov    %rbx,%r12
+  80064f:	be 01 00 00 00       	mov    $0x1,%esi
+  800654:	eb c5                	jmp    80061b <vprintfmt+0x75>
+            padc = ch;
+  800656:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80065a:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80065d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800660:	eb b9                	jmp    80061b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800662:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800665:	83 f8 2f             	cmp    $0x2f,%eax
+  800668:	77 24                	ja     80068e <vprintfmt+0xe8>
+  80066a:	89 c1                	mov    %eax,%ecx
+  80066c:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800670:	83 c0 08             	add    $0x8,%eax
+  800673:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800676:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800679:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80067c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800680:	79 99                	jns    80061b <vprintfmt+0x75>
+                width = precision;
+  800682:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800686:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80068c:	eb 8d                	jmp    80061b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80068e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800692:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800696:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80069a:	eb da                	jmp    800676 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80069c:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006a1:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006a5:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006ab:	3c 39                	cmp    $0x39,%al
+  8006ad:	77 1c                	ja     8006cb <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006af:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006b3:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006b7:	0f b6 c0             	movzbl %al,%eax
+  8006ba:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006bf:	0f b6 03             	movzbl (%rbx),%eax
+  8006c2:	3c 39                	cmp    $0x39,%al
+  8006c4:	76 e9                	jbe    8006af <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8006c6:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8006c9:	eb b1                	jmp    80067c <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8006cb:	49 89 dc             	mov    %rbx,%r12
+  8006ce:	eb ac                	jmp    80067c <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8006d0:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8006d3:	85 c9                	test   %ecx,%ecx
+  8006d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006da:	0f 49 c1             	cmovns %ecx,%eax
+  8006dd:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8006e0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006e3:	e9 33 ff ff ff       	jmp    80061b <vprintfmt+0x75>
+            lflag++;
+  8006e8:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8006eb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006ee:	e9 28 ff ff ff       	jmp    80061b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f9:	77 19                	ja     800714 <vprintfmt+0x16e>
+  8006fb:	89 c2                	mov    %eax,%edx
+  8006fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800701:	83 c0 08             	add    $0x8,%eax
+  800704:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800707:	8b 3a                	mov    (%rdx),%edi
+  800709:	4c 89 ee             	mov    %r13,%rsi
+  80070c:	41 ff d6             	call   *%r14
+            break;
+  80070f:	e9 c3 fe ff ff       	jmp    8005d7 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800714:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800718:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80071c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800720:	eb e5                	jmp    800707 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800722:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800725:	83 f8 2f             	cmp    $0x2f,%eax
+  800728:	77 5a                	ja     800784 <vprintfmt+0x1de>
+  80072a:	89 c2                	mov    %eax,%edx
+  80072c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800730:	83 c0 08             	add    $0x8,%eax
+  800733:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800736:	8b 02                	mov    (%rdx),%eax
+  800738:	89 c1                	mov    %eax,%ecx
+  80073a:	f7 d9                	neg    %ecx
+  80073c:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80073f:	83 f9 15             	cmp    $0x15,%ecx
+  800742:	7f 4e                	jg     800792 <vprintfmt+0x1ec>
+  800744:	48 63 c1             	movslq %ecx,%rax
+  800747:	48 ba e0 33 80 00 00 	movabs $0x8033e0,%rdx
+  80074e:	00 00 00 
+  800751:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800755:	48 85 c0             	test   %rax,%rax
+  800758:	74 38                	je     800792 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80075a:	48 89 c1             	mov    %rax,%rcx
+  80075d:	48 ba 99 35 80 00 00 	movabs $0x803599,%rdx
+  800764:	00 00 00 
+  800767:	4c 89 ee             	mov    %r13,%rsi
+  80076a:	4c 89 f7             	mov    %r14,%rdi
+  80076d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800772:	49 b8 69 05 80 00 00 	movabs $0x800569,%r8
+  800779:	00 00 00 
+  80077c:	41 ff d0             	call   *%r8
+  80077f:	e9 53 fe ff ff       	jmp    8005d7 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800784:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800788:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800790:	eb a4                	jmp    800736 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800792:	48 ba 84 2f 80 00 00 	movabs $0x802f84,%rdx
+  800799:	00 00 00 
+  80079c:	4c 89 ee             	mov    %r13,%rsi
+  80079f:	4c 89 f7             	mov    %r14,%rdi
+  8007a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a7:	49 b8 69 05 80 00 00 	movabs $0x800569,%r8
+  8007ae:	00 00 00 
+  8007b1:	41 ff d0             	call   *%r8
+  8007b4:	e9 1e fe ff ff       	jmp    8005d7 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007bf:	77 6c                	ja     80082d <vprintfmt+0x287>
+  8007c1:	89 c2                	mov    %eax,%edx
+  8007c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c7:	83 c0 08             	add    $0x8,%eax
+  8007ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007cd:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8007d0:	48 85 d2             	test   %rdx,%rdx
+  8007d3:	48 b8 7d 2f 80 00 00 	movabs $0x802f7d,%rax
+  8007da:	00 00 00 
+  8007dd:	48 0f 45 c2          	cmovne %rdx,%rax
+  8007e1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8007e5:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007e9:	7e 06                	jle    8007f1 <vprintfmt+0x24b>
+  8007eb:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007ef:	75 4a                	jne    80083b <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007f1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007f5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8007f9:	0f b6 00             	movzbl (%rax),%eax
+  8007fc:	84 c0                	test   %al,%al
+  8007fe:	0f 85 9a 00 00 00    	jne    80089e <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800804:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800807:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80080b:	85 c0                	test   %eax,%eax
+  80080d:	0f 8e c4 fd ff ff    	jle    8005d7 <vprintfmt+0x31>
+  800813:	4c 89 ee             	mov    %r13,%rsi
+  800816:	bf 20 00 00 00       	mov    $0x20,%edi
+  80081b:	41 ff d6             	call   *%r14
+  80081e:	41 83 ec 01          	sub    $0x1,%r12d
+  800822:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800826:	75 eb                	jne    800813 <vprintfmt+0x26d>
+  800828:	e9 aa fd ff ff       	jmp    8005d7 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80082d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800831:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800835:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800839:	eb 92                	jmp    8007cd <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80083b:	49 63 f7             	movslq %r15d,%rsi
+  80083e:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800842:	48 b8 58 0d 80 00 00 	movabs $0x800d58,%rax
+  800849:	00 00 00 
+  80084c:	ff d0                	call   *%rax
+  80084e:	48 89 c2             	mov    %rax,%rdx
+  800851:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800854:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800856:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800859:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80085c:	85 c0                	test   %eax,%eax
+  80085e:	7e 91                	jle    8007f1 <vprintfmt+0x24b>
+  800860:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800865:	4c 89 ee             	mov    %r13,%rsi
+  800868:	44 89 e7             	mov    %r12d,%edi
+  80086b:	41 ff d6             	call   *%r14
+  80086e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800872:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800875:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800878:	75 eb                	jne    800865 <vprintfmt+0x2bf>
+  80087a:	e9 72 ff ff ff       	jmp    8007f1 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80087f:	0f b6 f8             	movzbl %al,%edi
+  800882:	4c 89 ee             	mov    %r13,%rsi
+  800885:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800888:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80088c:	49 83 c4 01          	add    $0x1,%r12
+  800890:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800896:	84 c0                	test   %al,%al
+  800898:	0f 84 66 ff ff ff    	je     800804 <vprintfmt+0x25e>
+  80089e:	45 85 ff             	test   %r15d,%r15d
+  8008a1:	78 0a                	js     8008ad <vprintfmt+0x307>
+  8008a3:	41 83 ef 01          	sub    $0x1,%r15d
+  8008a7:	0f 88 57 ff ff ff    	js     800804 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008ad:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008b1:	74 cc                	je     80087f <vprintfmt+0x2d9>
+  8008b3:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008b6:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008bb:	80 fa 5e             	cmp    $0x5e,%dl
+  8008be:	77 c2                	ja     800882 <vprintfmt+0x2dc>
+  8008c0:	eb bd                	jmp    80087f <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c2:	40 84 f6             	test   %sil,%sil
+  8008c5:	75 26                	jne    8008ed <vprintfmt+0x347>
+    switch (lflag) {
+  8008c7:	85 d2                	test   %edx,%edx
+  8008c9:	74 59                	je     800924 <vprintfmt+0x37e>
+  8008cb:	83 fa 01             	cmp    $0x1,%edx
+  8008ce:	74 7b                	je     80094b <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8008d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d6:	0f 87 96 00 00 00    	ja     800972 <vprintfmt+0x3cc>
+  8008dc:	89 c2                	mov    %eax,%edx
+  8008de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e2:	83 c0 08             	add    $0x8,%eax
+  8008e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e8:	4c 8b 22             	mov    (%rdx),%r12
+  8008eb:	eb 17                	jmp    800904 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f3:	77 21                	ja     800916 <vprintfmt+0x370>
+  8008f5:	89 c2                	mov    %eax,%edx
+  8008f7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008fb:	83 c0 08             	add    $0x8,%eax
+  8008fe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800901:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800904:	4d 85 e4             	test   %r12,%r12
+  800907:	78 7a                	js     800983 <vprintfmt+0x3dd>
+            num = i;
+  800909:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80090c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800911:	e9 50 02 00 00       	jmp    800b66 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800916:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800922:	eb dd                	jmp    800901 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800924:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800927:	83 f8 2f             	cmp    $0x2f,%eax
+  80092a:	77 11                	ja     80093d <vprintfmt+0x397>
+  80092c:	89 c2                	mov    %eax,%edx
+  80092e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800932:	83 c0 08             	add    $0x8,%eax
+  800935:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800938:	4c 63 22             	movslq (%rdx),%r12
+  80093b:	eb c7                	jmp    800904 <vprintfmt+0x35e>
+  80093d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800941:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800945:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800949:	eb ed                	jmp    800938 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80094b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094e:	83 f8 2f             	cmp    $0x2f,%eax
+  800951:	77 11                	ja     800964 <vprintfmt+0x3be>
+  800953:	89 c2                	mov    %eax,%edx
+  800955:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800959:	83 c0 08             	add    $0x8,%eax
+  80095c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095f:	4c 8b 22             	mov    (%rdx),%r12
+  800962:	eb a0                	jmp    800904 <vprintfmt+0x35e>
+  800964:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800968:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800970:	eb ed                	jmp    80095f <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800972:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800976:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097e:	e9 65 ff ff ff       	jmp    8008e8 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800983:	4c 89 ee             	mov    %r13,%rsi
+  800986:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80098b:	41 ff d6             	call   *%r14
+                i = -i;
+  80098e:	49 f7 dc             	neg    %r12
+  800991:	e9 73 ff ff ff       	jmp    800909 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800996:	40 84 f6             	test   %sil,%sil
+  800999:	75 32                	jne    8009cd <vprintfmt+0x427>
+    switch (lflag) {
+  80099b:	85 d2                	test   %edx,%edx
+  80099d:	74 5d                	je     8009fc <vprintfmt+0x456>
+  80099f:	83 fa 01             	cmp    $0x1,%edx
+  8009a2:	0f 84 82 00 00 00    	je     800a2a <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8009a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ae:	0f 87 a5 00 00 00    	ja     800a59 <vprintfmt+0x4b3>
+  8009b4:	89 c2                	mov    %eax,%edx
+  8009b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ba:	83 c0 08             	add    $0x8,%eax
+  8009bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009c3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009c8:	e9 99 01 00 00       	jmp    800b66 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d3:	77 19                	ja     8009ee <vprintfmt+0x448>
+  8009d5:	89 c2                	mov    %eax,%edx
+  8009d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009db:	83 c0 08             	add    $0x8,%eax
+  8009de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009e4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009e9:	e9 78 01 00 00       	jmp    800b66 <vprintfmt+0x5c0>
+  8009ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fa:	eb e5                	jmp    8009e1 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8009fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ff:	83 f8 2f             	cmp    $0x2f,%eax
+  800a02:	77 18                	ja     800a1c <vprintfmt+0x476>
+  800a04:	89 c2                	mov    %eax,%edx
+  800a06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0a:	83 c0 08             	add    $0x8,%eax
+  800a0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a10:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a12:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a17:	e9 4a 01 00 00       	jmp    800b66 <vprintfmt+0x5c0>
+  800a1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a28:	eb e6                	jmp    800a10 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a30:	77 19                	ja     800a4b <vprintfmt+0x4a5>
+  800a32:	89 c2                	mov    %eax,%edx
+  800a34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a38:	83 c0 08             	add    $0x8,%eax
+  800a3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a41:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a46:	e9 1b 01 00 00       	jmp    800b66 <vprintfmt+0x5c0>
+  800a4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a57:	eb e5                	jmp    800a3e <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a59:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a61:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a65:	e9 56 ff ff ff       	jmp    8009c0 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a6a:	40 84 f6             	test   %sil,%sil
+  800a6d:	75 2e                	jne    800a9d <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a6f:	85 d2                	test   %edx,%edx
+  800a71:	74 59                	je     800acc <vprintfmt+0x526>
+  800a73:	83 fa 01             	cmp    $0x1,%edx
+  800a76:	74 7f                	je     800af7 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a78:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7e:	0f 87 9f 00 00 00    	ja     800b23 <vprintfmt+0x57d>
+  800a84:	89 c2                	mov    %eax,%edx
+  800a86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8a:	83 c0 08             	add    $0x8,%eax
+  800a8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a90:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a93:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a98:	e9 c9 00 00 00       	jmp    800b66 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a9d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa0:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa3:	77 19                	ja     800abe <vprintfmt+0x518>
+  800aa5:	89 c2                	mov    %eax,%edx
+  800aa7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aab:	83 c0 08             	add    $0x8,%eax
+  800aae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ab4:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ab9:	e9 a8 00 00 00       	jmp    800b66 <vprintfmt+0x5c0>
+  800abe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aca:	eb e5                	jmp    800ab1 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800acc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acf:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad2:	77 15                	ja     800ae9 <vprintfmt+0x543>
+  800ad4:	89 c2                	mov    %eax,%edx
+  800ad6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ada:	83 c0 08             	add    $0x8,%eax
+  800add:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae0:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800ae2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800ae7:	eb 7d                	jmp    800b66 <vprintfmt+0x5c0>
+  800ae9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af5:	eb e9                	jmp    800ae0 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800af7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afa:	83 f8 2f             	cmp    $0x2f,%eax
+  800afd:	77 16                	ja     800b15 <vprintfmt+0x56f>
+  800aff:	89 c2                	mov    %eax,%edx
+  800b01:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b05:	83 c0 08             	add    $0x8,%eax
+  800b08:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b0e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b13:	eb 51                	jmp    800b66 <vprintfmt+0x5c0>
+  800b15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b19:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b21:	eb e8                	jmp    800b0b <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2f:	e9 5c ff ff ff       	jmp    800a90 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b34:	4c 89 ee             	mov    %r13,%rsi
+  800b37:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b3c:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b3f:	4c 89 ee             	mov    %r13,%rsi
+  800b42:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b47:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b4a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b50:	77 47                	ja     800b99 <vprintfmt+0x5f3>
+  800b52:	89 c2                	mov    %eax,%edx
+  800b54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b58:	83 c0 08             	add    $0x8,%eax
+  800b5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b5e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b61:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b66:	48 83 ec 08          	sub    $0x8,%rsp
+  800b6a:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b6e:	0f 94 c0             	sete   %al
+  800b71:	0f b6 c0             	movzbl %al,%eax
+  800b74:	50                   	push   %rax
+  800b75:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b7a:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b7e:	4c 89 ee             	mov    %r13,%rsi
+  800b81:	4c 89 f7             	mov    %r14,%rdi
+  800b84:	48 b8 9b 04 80 00 00 	movabs $0x80049b,%rax
+  800b8b:	00 00 00 
+  800b8e:	ff d0                	call   *%rax
+            break;
+  800b90:	48 83 c4 10          	add    $0x10,%rsp
+  800b94:	e9 3e fa ff ff       	jmp    8005d7 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba5:	eb b7                	jmp    800b5e <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ba7:	40 84 f6             	test   %sil,%sil
+  800baa:	75 2b                	jne    800bd7 <vprintfmt+0x631>
+    switch (lflag) {
+  800bac:	85 d2                	test   %edx,%edx
+  800bae:	74 56                	je     800c06 <vprintfmt+0x660>
+  800bb0:	83 fa 01             	cmp    $0x1,%edx
+  800bb3:	74 7f                	je     800c34 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800bb5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb8:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbb:	0f 87 a2 00 00 00    	ja     800c63 <vprintfmt+0x6bd>
+  800bc1:	89 c2                	mov    %eax,%edx
+  800bc3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc7:	83 c0 08             	add    $0x8,%eax
+  800bca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bcd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bd0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bd5:	eb 8f                	jmp    800b66 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bd7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bda:	83 f8 2f             	cmp    $0x2f,%eax
+  800bdd:	77 19                	ja     800bf8 <vprintfmt+0x652>
+  800bdf:	89 c2                	mov    %eax,%edx
+  800be1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be5:	83 c0 08             	add    $0x8,%eax
+  800be8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800beb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bee:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bf3:	e9 6e ff ff ff       	jmp    800b66 <vprintfmt+0x5c0>
+  800bf8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bfc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c04:	eb e5                	jmp    800beb <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c09:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0c:	77 18                	ja     800c26 <vprintfmt+0x680>
+  800c0e:	89 c2                	mov    %eax,%edx
+  800c10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c14:	83 c0 08             	add    $0x8,%eax
+  800c17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c1c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c21:	e9 40 ff ff ff       	jmp    800b66 <vprintfmt+0x5c0>
+  800c26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c32:	eb e6                	jmp    800c1a <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c37:	83 f8 2f             	cmp    $0x2f,%eax
+  800c3a:	77 19                	ja     800c55 <vprintfmt+0x6af>
+  800c3c:	89 c2                	mov    %eax,%edx
+  800c3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c42:	83 c0 08             	add    $0x8,%eax
+  800c45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c48:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c4b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c50:	e9 11 ff ff ff       	jmp    800b66 <vprintfmt+0x5c0>
+  800c55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c61:	eb e5                	jmp    800c48 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c63:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c67:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c6f:	e9 59 ff ff ff       	jmp    800bcd <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c74:	4c 89 ee             	mov    %r13,%rsi
+  800c77:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c7c:	41 ff d6             	call   *%r14
+            break;
+  800c7f:	e9 53 f9 ff ff       	jmp    8005d7 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c84:	4c 89 ee             	mov    %r13,%rsi
+  800c87:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c8c:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c8f:	48 83 eb 01          	sub    $0x1,%rbx
+  800c93:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c97:	75 f6                	jne    800c8f <vprintfmt+0x6e9>
+  800c99:	e9 39 f9 ff ff       	jmp    8005d7 <vprintfmt+0x31>
+}
+  800c9e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ca2:	5b                   	pop    %rbx
+  800ca3:	41 5c                	pop    %r12
+  800ca5:	41 5d                	pop    %r13
+  800ca7:	41 5e                	pop    %r14
+  800ca9:	41 5f                	pop    %r15
+  800cab:	5d                   	pop    %rbp
+  800cac:	c3                   	ret
+
+0000000000800cad <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800cad:	55                   	push   %rbp
+  800cae:	48 89 e5             	mov    %rsp,%rbp
+  800cb1:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800cb5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800cb9:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800cbe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800cc2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800cc9:	48 85 ff             	test   %rdi,%rdi
+  800ccc:	74 2b                	je     800cf9 <vsnprintf+0x4c>
+  800cce:	48 85 f6             	test   %rsi,%rsi
+  800cd1:	74 26                	je     800cf9 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800cd3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800cd7:	48 bf 51 05 80 00 00 	movabs $0x800551,%rdi
+  800cde:	00 00 00 
+  800ce1:	48 b8 a6 05 80 00 00 	movabs $0x8005a6,%rax
+  800ce8:	00 00 00 
+  800ceb:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ced:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cf1:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800cf4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800cf7:	c9                   	leave
+  800cf8:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800cf9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cfe:	eb f7                	jmp    800cf7 <vsnprintf+0x4a>
+
+0000000000800d00 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d00:	55                   	push   %rbp
+  800d01:	48 89 e5             	mov    %rsp,%rbp
+  800d04:	48 83 ec 50          	sub    $0x50,%rsp
+  800d08:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d0c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d10:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d14:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d1b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d23:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d27:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d2b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d2f:	48 b8 ad 0c 80 00 00 	movabs $0x800cad,%rax
+  800d36:	00 00 00 
+  800d39:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d3b:	c9                   	leave
+  800d3c:	c3                   	ret
+
+0000000000800d3d <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d3d:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d40:	74 10                	je     800d52 <strlen+0x15>
+    size_t n = 0;
+  800d42:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d47:	48 83 c0 01          	add    $0x1,%rax
+  800d4b:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d4f:	75 f6                	jne    800d47 <strlen+0xa>
+  800d51:	c3                   	ret
+    size_t n = 0;
+  800d52:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d57:	c3                   	ret
+
+0000000000800d58 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d58:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d5b:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d60:	48 85 f6             	test   %rsi,%rsi
+  800d63:	74 11                	je     800d76 <strnlen+0x1e>
+  800d65:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d69:	74 0c                	je     800d77 <strnlen+0x1f>
+  800d6b:	48 83 c2 01          	add    $0x1,%rdx
+  800d6f:	48 39 d0             	cmp    %rdx,%rax
+  800d72:	75 f1                	jne    800d65 <strnlen+0xd>
+  800d74:	eb 04                	jmp    800d7a <strnlen+0x22>
+  800d76:	c3                   	ret
+  800d77:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d7a:	c3                   	ret
+
+0000000000800d7b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d7b:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d83:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d87:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d8a:	48 83 c2 01          	add    $0x1,%rdx
+  800d8e:	84 c9                	test   %cl,%cl
+  800d90:	75 f1                	jne    800d83 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d92:	c3                   	ret
+
+0000000000800d93 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d93:	55                   	push   %rbp
+  800d94:	48 89 e5             	mov    %rsp,%rbp
+  800d97:	41 54                	push   %r12
+  800d99:	53                   	push   %rbx
+  800d9a:	48 89 fb             	mov    %rdi,%rbx
+  800d9d:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800da0:	48 b8 3d 0d 80 00 00 	movabs $0x800d3d,%rax
+  800da7:	00 00 00 
+  800daa:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800dac:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800db0:	4c 89 e6             	mov    %r12,%rsi
+  800db3:	48 b8 7b 0d 80 00 00 	movabs $0x800d7b,%rax
+  800dba:	00 00 00 
+  800dbd:	ff d0                	call   *%rax
+    return dst;
+}
+  800dbf:	48 89 d8             	mov    %rbx,%rax
+  800dc2:	5b                   	pop    %rbx
+  800dc3:	41 5c                	pop    %r12
+  800dc5:	5d                   	pop    %rbp
+  800dc6:	c3                   	ret
+
+0000000000800dc7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800dc7:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800dca:	48 85 d2             	test   %rdx,%rdx
+  800dcd:	74 1f                	je     800dee <strncpy+0x27>
+  800dcf:	48 01 fa             	add    %rdi,%rdx
+  800dd2:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800dd5:	48 83 c1 01          	add    $0x1,%rcx
+  800dd9:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ddd:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800de1:	41 80 f8 01          	cmp    $0x1,%r8b
+  800de5:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800de9:	48 39 ca             	cmp    %rcx,%rdx
+  800dec:	75 e7                	jne    800dd5 <strncpy+0xe>
+    }
+    return ret;
+}
+  800dee:	c3                   	ret
+
+0000000000800def <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800def:	48 89 f8             	mov    %rdi,%rax
+  800df2:	48 85 d2             	test   %rdx,%rdx
+  800df5:	74 24                	je     800e1b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800df7:	48 83 ea 01          	sub    $0x1,%rdx
+  800dfb:	74 1b                	je     800e18 <strlcpy+0x29>
+  800dfd:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e01:	0f b6 16             	movzbl (%rsi),%edx
+  800e04:	84 d2                	test   %dl,%dl
+  800e06:	74 10                	je     800e18 <strlcpy+0x29>
+            *dst++ = *src++;
+  800e08:	48 83 c6 01          	add    $0x1,%rsi
+  800e0c:	48 83 c0 01          	add    $0x1,%rax
+  800e10:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e13:	48 39 c8             	cmp    %rcx,%rax
+  800e16:	75 e9                	jne    800e01 <strlcpy+0x12>
+        *dst = '\0';
+  800e18:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e1b:	48 29 f8             	sub    %rdi,%rax
+}
+  800e1e:	c3                   	ret
+
+0000000000800e1f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e1f:	0f b6 07             	movzbl (%rdi),%eax
+  800e22:	84 c0                	test   %al,%al
+  800e24:	74 13                	je     800e39 <strcmp+0x1a>
+  800e26:	38 06                	cmp    %al,(%rsi)
+  800e28:	75 0f                	jne    800e39 <strcmp+0x1a>
+  800e2a:	48 83 c7 01          	add    $0x1,%rdi
+  800e2e:	48 83 c6 01          	add    $0x1,%rsi
+  800e32:	0f b6 07             	movzbl (%rdi),%eax
+  800e35:	84 c0                	test   %al,%al
+  800e37:	75 ed                	jne    800e26 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e39:	0f b6 c0             	movzbl %al,%eax
+  800e3c:	0f b6 16             	movzbl (%rsi),%edx
+  800e3f:	29 d0                	sub    %edx,%eax
+}
+  800e41:	c3                   	ret
+
+0000000000800e42 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e42:	48 85 d2             	test   %rdx,%rdx
+  800e45:	74 1f                	je     800e66 <strncmp+0x24>
+  800e47:	0f b6 07             	movzbl (%rdi),%eax
+  800e4a:	84 c0                	test   %al,%al
+  800e4c:	74 1e                	je     800e6c <strncmp+0x2a>
+  800e4e:	3a 06                	cmp    (%rsi),%al
+  800e50:	75 1a                	jne    800e6c <strncmp+0x2a>
+  800e52:	48 83 c7 01          	add    $0x1,%rdi
+  800e56:	48 83 c6 01          	add    $0x1,%rsi
+  800e5a:	48 83 ea 01          	sub    $0x1,%rdx
+  800e5e:	75 e7                	jne    800e47 <strncmp+0x5>
+
+    if (!n) return 0;
+  800e60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e65:	c3                   	ret
+  800e66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e6b:	c3                   	ret
+  800e6c:	48 85 d2             	test   %rdx,%rdx
+  800e6f:	74 09                	je     800e7a <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e71:	0f b6 07             	movzbl (%rdi),%eax
+  800e74:	0f b6 16             	movzbl (%rsi),%edx
+  800e77:	29 d0                	sub    %edx,%eax
+  800e79:	c3                   	ret
+    if (!n) return 0;
+  800e7a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e7f:	c3                   	ret
+
+0000000000800e80 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e80:	0f b6 17             	movzbl (%rdi),%edx
+  800e83:	84 d2                	test   %dl,%dl
+  800e85:	74 18                	je     800e9f <strchr+0x1f>
+        if (*str == c) {
+  800e87:	0f be d2             	movsbl %dl,%edx
+  800e8a:	39 f2                	cmp    %esi,%edx
+  800e8c:	74 17                	je     800ea5 <strchr+0x25>
+    for (; *str; str++) {
+  800e8e:	48 83 c7 01          	add    $0x1,%rdi
+  800e92:	0f b6 17             	movzbl (%rdi),%edx
+  800e95:	84 d2                	test   %dl,%dl
+  800e97:	75 ee                	jne    800e87 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e9e:	c3                   	ret
+  800e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea4:	c3                   	ret
+  800ea5:	48 89 f8             	mov    %rdi,%rax
+}
+  800ea8:	c3                   	ret
+
+0000000000800ea9 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800ea9:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800eac:	0f b6 17             	movzbl (%rdi),%edx
+  800eaf:	84 d2                	test   %dl,%dl
+  800eb1:	74 13                	je     800ec6 <strfind+0x1d>
+  800eb3:	0f be d2             	movsbl %dl,%edx
+  800eb6:	39 f2                	cmp    %esi,%edx
+  800eb8:	74 0b                	je     800ec5 <strfind+0x1c>
+  800eba:	48 83 c0 01          	add    $0x1,%rax
+  800ebe:	0f b6 10             	movzbl (%rax),%edx
+  800ec1:	84 d2                	test   %dl,%dl
+  800ec3:	75 ee                	jne    800eb3 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ec5:	c3                   	ret
+  800ec6:	c3                   	ret
+
+0000000000800ec7 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ec7:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800eca:	48 89 f8             	mov    %rdi,%rax
+  800ecd:	48 f7 d8             	neg    %rax
+  800ed0:	83 e0 07             	and    $0x7,%eax
+  800ed3:	49 89 d1             	mov    %rdx,%r9
+  800ed6:	49 29 c1             	sub    %rax,%r9
+  800ed9:	78 36                	js     800f11 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800edb:	40 0f b6 c6          	movzbl %sil,%eax
+  800edf:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800ee6:	01 01 01 
+  800ee9:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800eed:	40 f6 c7 07          	test   $0x7,%dil
+  800ef1:	75 38                	jne    800f2b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ef3:	4c 89 c9             	mov    %r9,%rcx
+  800ef6:	48 c1 f9 03          	sar    $0x3,%rcx
+  800efa:	74 0c                	je     800f08 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800efc:	fc                   	cld
+  800efd:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f00:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f04:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f08:	4d 85 c9             	test   %r9,%r9
+  800f0b:	75 45                	jne    800f52 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f0d:	4c 89 c0             	mov    %r8,%rax
+  800f10:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f11:	48 85 d2             	test   %rdx,%rdx
+  800f14:	74 f7                	je     800f0d <memset+0x46>
+  800f16:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f19:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f1c:	48 83 c0 01          	add    $0x1,%rax
+  800f20:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f24:	48 39 c2             	cmp    %rax,%rdx
+  800f27:	75 f3                	jne    800f1c <memset+0x55>
+  800f29:	eb e2                	jmp    800f0d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f2b:	40 f6 c7 01          	test   $0x1,%dil
+  800f2f:	74 06                	je     800f37 <memset+0x70>
+  800f31:	88 07                	mov    %al,(%rdi)
+  800f33:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f37:	40 f6 c7 02          	test   $0x2,%dil
+  800f3b:	74 07                	je     800f44 <memset+0x7d>
+  800f3d:	66 89 07             	mov    %ax,(%rdi)
+  800f40:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f44:	40 f6 c7 04          	test   $0x4,%dil
+  800f48:	74 a9                	je     800ef3 <memset+0x2c>
+  800f4a:	89 07                	mov    %eax,(%rdi)
+  800f4c:	48 83 c7 04          	add    $0x4,%rdi
+  800f50:	eb a1                	jmp    800ef3 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f52:	41 f6 c1 04          	test   $0x4,%r9b
+  800f56:	74 06                	je     800f5e <memset+0x97>
+  800f58:	89 07                	mov    %eax,(%rdi)
+  800f5a:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f5e:	41 f6 c1 02          	test   $0x2,%r9b
+  800f62:	74 07                	je     800f6b <memset+0xa4>
+  800f64:	66 89 07             	mov    %ax,(%rdi)
+  800f67:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f6b:	41 f6 c1 01          	test   $0x1,%r9b
+  800f6f:	74 9c                	je     800f0d <memset+0x46>
+  800f71:	88 07                	mov    %al,(%rdi)
+  800f73:	eb 98                	jmp    800f0d <memset+0x46>
+
+0000000000800f75 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f75:	48 89 f8             	mov    %rdi,%rax
+  800f78:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f7b:	48 39 fe             	cmp    %rdi,%rsi
+  800f7e:	73 3b                	jae    800fbb <memmove+0x46>
+  800f80:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f84:	48 39 d7             	cmp    %rdx,%rdi
+  800f87:	73 32                	jae    800fbb <memmove+0x46>
+        s += n;
+        d += n;
+  800f89:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f8d:	48 89 d6             	mov    %rdx,%rsi
+  800f90:	48 09 fe             	or     %rdi,%rsi
+  800f93:	48 09 ce             	or     %rcx,%rsi
+  800f96:	40 f6 c6 07          	test   $0x7,%sil
+  800f9a:	75 12                	jne    800fae <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f9c:	48 83 ef 08          	sub    $0x8,%rdi
+  800fa0:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fa4:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fa8:	fd                   	std
+  800fa9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800fac:	fc                   	cld
+  800fad:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800fae:	48 83 ef 01          	sub    $0x1,%rdi
+  800fb2:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800fb6:	fd                   	std
+  800fb7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800fb9:	eb f1                	jmp    800fac <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fbb:	48 89 f2             	mov    %rsi,%rdx
+  800fbe:	48 09 c2             	or     %rax,%rdx
+  800fc1:	48 09 ca             	or     %rcx,%rdx
+  800fc4:	f6 c2 07             	test   $0x7,%dl
+  800fc7:	75 0c                	jne    800fd5 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800fc9:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fcd:	48 89 c7             	mov    %rax,%rdi
+  800fd0:	fc                   	cld
+  800fd1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800fd4:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800fd5:	48 89 c7             	mov    %rax,%rdi
+  800fd8:	fc                   	cld
+  800fd9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800fdb:	c3                   	ret
+
+0000000000800fdc <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800fdc:	55                   	push   %rbp
+  800fdd:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800fe0:	48 b8 75 0f 80 00 00 	movabs $0x800f75,%rax
+  800fe7:	00 00 00 
+  800fea:	ff d0                	call   *%rax
+}
+  800fec:	5d                   	pop    %rbp
+  800fed:	c3                   	ret
+
+0000000000800fee <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800fee:	55                   	push   %rbp
+  800fef:	48 89 e5             	mov    %rsp,%rbp
+  800ff2:	41 57                	push   %r15
+  800ff4:	41 56                	push   %r14
+  800ff6:	41 55                	push   %r13
+  800ff8:	41 54                	push   %r12
+  800ffa:	53                   	push   %rbx
+  800ffb:	48 83 ec 08          	sub    $0x8,%rsp
+  800fff:	49 89 fe             	mov    %rdi,%r14
+  801002:	49 89 f7             	mov    %rsi,%r15
+  801005:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801008:	48 89 f7             	mov    %rsi,%rdi
+  80100b:	48 b8 3d 0d 80 00 00 	movabs $0x800d3d,%rax
+  801012:	00 00 00 
+  801015:	ff d0                	call   *%rax
+  801017:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80101a:	48 89 de             	mov    %rbx,%rsi
+  80101d:	4c 89 f7             	mov    %r14,%rdi
+  801020:	48 b8 58 0d 80 00 00 	movabs $0x800d58,%rax
+  801027:	00 00 00 
+  80102a:	ff d0                	call   *%rax
+  80102c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80102f:	48 39 c3             	cmp    %rax,%rbx
+  801032:	74 36                	je     80106a <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801034:	48 89 d8             	mov    %rbx,%rax
+  801037:	4c 29 e8             	sub    %r13,%rax
+  80103a:	49 39 c4             	cmp    %rax,%r12
+  80103d:	73 31                	jae    801070 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80103f:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801044:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801048:	4c 89 fe             	mov    %r15,%rsi
+  80104b:	48 b8 dc 0f 80 00 00 	movabs $0x800fdc,%rax
+  801052:	00 00 00 
+  801055:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801057:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80105b:	48 83 c4 08          	add    $0x8,%rsp
+  80105f:	5b                   	pop    %rbx
+  801060:	41 5c                	pop    %r12
+  801062:	41 5d                	pop    %r13
+  801064:	41 5e                	pop    %r14
+  801066:	41 5f                	pop    %r15
+  801068:	5d                   	pop    %rbp
+  801069:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80106a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80106e:	eb eb                	jmp    80105b <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801070:	48 83 eb 01          	sub    $0x1,%rbx
+  801074:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801078:	48 89 da             	mov    %rbx,%rdx
+  80107b:	4c 89 fe             	mov    %r15,%rsi
+  80107e:	48 b8 dc 0f 80 00 00 	movabs $0x800fdc,%rax
+  801085:	00 00 00 
+  801088:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80108a:	49 01 de             	add    %rbx,%r14
+  80108d:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801092:	eb c3                	jmp    801057 <strlcat+0x69>
+
+0000000000801094 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801094:	48 85 d2             	test   %rdx,%rdx
+  801097:	74 2d                	je     8010c6 <memcmp+0x32>
+  801099:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80109e:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010a2:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010a7:	44 38 c1             	cmp    %r8b,%cl
+  8010aa:	75 0f                	jne    8010bb <memcmp+0x27>
+    while (n-- > 0) {
+  8010ac:	48 83 c0 01          	add    $0x1,%rax
+  8010b0:	48 39 c2             	cmp    %rax,%rdx
+  8010b3:	75 e9                	jne    80109e <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ba:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010bb:	0f b6 c1             	movzbl %cl,%eax
+  8010be:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010c2:	44 29 c0             	sub    %r8d,%eax
+  8010c5:	c3                   	ret
+    return 0;
+  8010c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010cb:	c3                   	ret
+
+00000000008010cc <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8010cc:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8010d0:	48 39 c7             	cmp    %rax,%rdi
+  8010d3:	73 0f                	jae    8010e4 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8010d5:	40 38 37             	cmp    %sil,(%rdi)
+  8010d8:	74 0e                	je     8010e8 <memfind+0x1c>
+    for (; src < end; src++) {
+  8010da:	48 83 c7 01          	add    $0x1,%rdi
+  8010de:	48 39 f8             	cmp    %rdi,%rax
+  8010e1:	75 f2                	jne    8010d5 <memfind+0x9>
+  8010e3:	c3                   	ret
+  8010e4:	48 89 f8             	mov    %rdi,%rax
+  8010e7:	c3                   	ret
+  8010e8:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8010eb:	c3                   	ret
+
+00000000008010ec <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8010ec:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010ef:	0f b6 37             	movzbl (%rdi),%esi
+  8010f2:	40 80 fe 20          	cmp    $0x20,%sil
+  8010f6:	74 06                	je     8010fe <strtol+0x12>
+  8010f8:	40 80 fe 09          	cmp    $0x9,%sil
+  8010fc:	75 13                	jne    801111 <strtol+0x25>
+  8010fe:	48 83 c7 01          	add    $0x1,%rdi
+  801102:	0f b6 37             	movzbl (%rdi),%esi
+  801105:	40 80 fe 20          	cmp    $0x20,%sil
+  801109:	74 f3                	je     8010fe <strtol+0x12>
+  80110b:	40 80 fe 09          	cmp    $0x9,%sil
+  80110f:	74 ed                	je     8010fe <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801111:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801114:	83 e0 fd             	and    $0xfffffffd,%eax
+  801117:	3c 01                	cmp    $0x1,%al
+  801119:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80111d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801123:	75 0f                	jne    801134 <strtol+0x48>
+  801125:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801128:	74 14                	je     80113e <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80112a:	85 d2                	test   %edx,%edx
+  80112c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801131:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801134:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801139:	4c 63 ca             	movslq %edx,%r9
+  80113c:	eb 36                	jmp    801174 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80113e:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801142:	74 0f                	je     801153 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801144:	85 d2                	test   %edx,%edx
+  801146:	75 ec                	jne    801134 <strtol+0x48>
+        s++;
+  801148:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80114c:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801151:	eb e1                	jmp    801134 <strtol+0x48>
+        s += 2;
+  801153:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801157:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80115c:	eb d6                	jmp    801134 <strtol+0x48>
+            dig -= '0';
+  80115e:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801161:	44 0f b6 c1          	movzbl %cl,%r8d
+  801165:	41 39 d0             	cmp    %edx,%r8d
+  801168:	7d 21                	jge    80118b <strtol+0x9f>
+        val = val * base + dig;
+  80116a:	49 0f af c1          	imul   %r9,%rax
+  80116e:	0f b6 c9             	movzbl %cl,%ecx
+  801171:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801174:	48 83 c7 01          	add    $0x1,%rdi
+  801178:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80117c:	80 f9 39             	cmp    $0x39,%cl
+  80117f:	76 dd                	jbe    80115e <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801181:	80 f9 7b             	cmp    $0x7b,%cl
+  801184:	77 05                	ja     80118b <strtol+0x9f>
+            dig -= 'a' - 10;
+  801186:	83 e9 57             	sub    $0x57,%ecx
+  801189:	eb d6                	jmp    801161 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80118b:	4d 85 d2             	test   %r10,%r10
+  80118e:	74 03                	je     801193 <strtol+0xa7>
+  801190:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801193:	48 89 c2             	mov    %rax,%rdx
+  801196:	48 f7 da             	neg    %rdx
+  801199:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80119d:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011a1:	c3                   	ret
+
+00000000008011a2 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011a2:	55                   	push   %rbp
+  8011a3:	48 89 e5             	mov    %rsp,%rbp
+  8011a6:	53                   	push   %rbx
+  8011a7:	48 89 fa             	mov    %rdi,%rdx
+  8011aa:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ad:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011c7:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8011c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011cd:	c9                   	leave
+  8011ce:	c3                   	ret
+
+00000000008011cf <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8011cf:	55                   	push   %rbp
+  8011d0:	48 89 e5             	mov    %rsp,%rbp
+  8011d3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011d4:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011de:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f8:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011fe:	c9                   	leave
+  8011ff:	c3                   	ret
+
+0000000000801200 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801200:	55                   	push   %rbp
+  801201:	48 89 e5             	mov    %rsp,%rbp
+  801204:	53                   	push   %rbx
+  801205:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801209:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80120c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801211:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801216:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801220:	be 00 00 00 00       	mov    $0x0,%esi
+  801225:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80122b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80122d:	48 85 c0             	test   %rax,%rax
+  801230:	7f 06                	jg     801238 <sys_env_destroy+0x38>
+}
+  801232:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801236:	c9                   	leave
+  801237:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801238:	49 89 c0             	mov    %rax,%r8
+  80123b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801240:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  801247:	00 00 00 
+  80124a:	be 26 00 00 00       	mov    $0x26,%esi
+  80124f:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  801256:	00 00 00 
+  801259:	b8 00 00 00 00       	mov    $0x0,%eax
+  80125e:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  801265:	00 00 00 
+  801268:	41 ff d1             	call   *%r9
+
+000000000080126b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80126b:	55                   	push   %rbp
+  80126c:	48 89 e5             	mov    %rsp,%rbp
+  80126f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801270:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801275:	ba 00 00 00 00       	mov    $0x0,%edx
+  80127a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80127f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801284:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801289:	be 00 00 00 00       	mov    $0x0,%esi
+  80128e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801294:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801296:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80129a:	c9                   	leave
+  80129b:	c3                   	ret
+
+000000000080129c <sys_yield>:
+
+void
+sys_yield(void) {
+  80129c:	55                   	push   %rbp
+  80129d:	48 89 e5             	mov    %rsp,%rbp
+  8012a0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a1:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8012bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c5:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012cb:	c9                   	leave
+  8012cc:	c3                   	ret
+
+00000000008012cd <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012cd:	55                   	push   %rbp
+  8012ce:	48 89 e5             	mov    %rsp,%rbp
+  8012d1:	53                   	push   %rbx
+  8012d2:	48 89 fa             	mov    %rdi,%rdx
+  8012d5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012d8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012dd:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8012e4:	00 00 00 
+  8012e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012fd:	c9                   	leave
+  8012fe:	c3                   	ret
+
+00000000008012ff <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012ff:	55                   	push   %rbp
+  801300:	48 89 e5             	mov    %rsp,%rbp
+  801303:	53                   	push   %rbx
+  801304:	49 89 f8             	mov    %rdi,%r8
+  801307:	48 89 d3             	mov    %rdx,%rbx
+  80130a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80130d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801312:	4c 89 c2             	mov    %r8,%rdx
+  801315:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801318:	be 00 00 00 00       	mov    $0x0,%esi
+  80131d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801323:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801325:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801329:	c9                   	leave
+  80132a:	c3                   	ret
+
+000000000080132b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80132b:	55                   	push   %rbp
+  80132c:	48 89 e5             	mov    %rsp,%rbp
+  80132f:	53                   	push   %rbx
+  801330:	48 83 ec 08          	sub    $0x8,%rsp
+  801334:	89 f8                	mov    %edi,%eax
+  801336:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801339:	48 63 f9             	movslq %ecx,%rdi
+  80133c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80133f:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801344:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801347:	be 00 00 00 00       	mov    $0x0,%esi
+  80134c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801352:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801354:	48 85 c0             	test   %rax,%rax
+  801357:	7f 06                	jg     80135f <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801359:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135d:	c9                   	leave
+  80135e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80135f:	49 89 c0             	mov    %rax,%r8
+  801362:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801367:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  80136e:	00 00 00 
+  801371:	be 26 00 00 00       	mov    $0x26,%esi
+  801376:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  80137d:	00 00 00 
+  801380:	b8 00 00 00 00       	mov    $0x0,%eax
+  801385:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  80138c:	00 00 00 
+  80138f:	41 ff d1             	call   *%r9
+
+0000000000801392 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801392:	55                   	push   %rbp
+  801393:	48 89 e5             	mov    %rsp,%rbp
+  801396:	53                   	push   %rbx
+  801397:	48 83 ec 08          	sub    $0x8,%rsp
+  80139b:	89 f8                	mov    %edi,%eax
+  80139d:	49 89 f2             	mov    %rsi,%r10
+  8013a0:	48 89 cf             	mov    %rcx,%rdi
+  8013a3:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013a6:	48 63 da             	movslq %edx,%rbx
+  8013a9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ac:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013b1:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b4:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013b7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013b9:	48 85 c0             	test   %rax,%rax
+  8013bc:	7f 06                	jg     8013c4 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c2:	c9                   	leave
+  8013c3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c4:	49 89 c0             	mov    %rax,%r8
+  8013c7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013cc:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  8013d3:	00 00 00 
+  8013d6:	be 26 00 00 00       	mov    $0x26,%esi
+  8013db:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  8013e2:	00 00 00 
+  8013e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ea:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  8013f1:	00 00 00 
+  8013f4:	41 ff d1             	call   *%r9
+
+00000000008013f7 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013f7:	55                   	push   %rbp
+  8013f8:	48 89 e5             	mov    %rsp,%rbp
+  8013fb:	53                   	push   %rbx
+  8013fc:	48 83 ec 08          	sub    $0x8,%rsp
+  801400:	48 89 f1             	mov    %rsi,%rcx
+  801403:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801406:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801409:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80140e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801413:	be 00 00 00 00       	mov    $0x0,%esi
+  801418:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80141e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801420:	48 85 c0             	test   %rax,%rax
+  801423:	7f 06                	jg     80142b <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801425:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801429:	c9                   	leave
+  80142a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80142b:	49 89 c0             	mov    %rax,%r8
+  80142e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801433:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  80143a:	00 00 00 
+  80143d:	be 26 00 00 00       	mov    $0x26,%esi
+  801442:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  801449:	00 00 00 
+  80144c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801451:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  801458:	00 00 00 
+  80145b:	41 ff d1             	call   *%r9
+
+000000000080145e <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  80145e:	55                   	push   %rbp
+  80145f:	48 89 e5             	mov    %rsp,%rbp
+  801462:	53                   	push   %rbx
+  801463:	48 83 ec 08          	sub    $0x8,%rsp
+  801467:	89 f8                	mov    %edi,%eax
+  801469:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  80146c:	48 63 f9             	movslq %ecx,%rdi
+  80146f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801472:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801477:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80147a:	be 00 00 00 00       	mov    $0x0,%esi
+  80147f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801485:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801487:	48 85 c0             	test   %rax,%rax
+  80148a:	7f 06                	jg     801492 <sys_region_advise+0x34>
+}
+  80148c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801490:	c9                   	leave
+  801491:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801492:	49 89 c0             	mov    %rax,%r8
+  801495:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80149a:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  8014a1:	00 00 00 
+  8014a4:	be 26 00 00 00       	mov    $0x26,%esi
+  8014a9:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  8014b0:	00 00 00 
+  8014b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b8:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  8014bf:	00 00 00 
+  8014c2:	41 ff d1             	call   *%r9
+
+00000000008014c5 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  8014c5:	55                   	push   %rbp
+  8014c6:	48 89 e5             	mov    %rsp,%rbp
+  8014c9:	53                   	push   %rbx
+  8014ca:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  8014ce:	48 63 ce             	movslq %esi,%rcx
+  8014d1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d4:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014de:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ee:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014f0:	48 85 c0             	test   %rax,%rax
+  8014f3:	7f 06                	jg     8014fb <sys_env_set_nice+0x36>
+}
+  8014f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f9:	c9                   	leave
+  8014fa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014fb:	49 89 c0             	mov    %rax,%r8
+  8014fe:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801503:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  80150a:	00 00 00 
+  80150d:	be 26 00 00 00       	mov    $0x26,%esi
+  801512:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  801519:	00 00 00 
+  80151c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801521:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  801528:	00 00 00 
+  80152b:	41 ff d1             	call   *%r9
+
+000000000080152e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80152e:	55                   	push   %rbp
+  80152f:	48 89 e5             	mov    %rsp,%rbp
+  801532:	53                   	push   %rbx
+  801533:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801537:	48 63 ce             	movslq %esi,%rcx
+  80153a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80153d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801542:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801547:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80154c:	be 00 00 00 00       	mov    $0x0,%esi
+  801551:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801557:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801559:	48 85 c0             	test   %rax,%rax
+  80155c:	7f 06                	jg     801564 <sys_env_set_status+0x36>
+}
+  80155e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801562:	c9                   	leave
+  801563:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801564:	49 89 c0             	mov    %rax,%r8
+  801567:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80156c:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  801573:	00 00 00 
+  801576:	be 26 00 00 00       	mov    $0x26,%esi
+  80157b:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  801582:	00 00 00 
+  801585:	b8 00 00 00 00       	mov    $0x0,%eax
+  80158a:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  801591:	00 00 00 
+  801594:	41 ff d1             	call   *%r9
+
+0000000000801597 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801597:	55                   	push   %rbp
+  801598:	48 89 e5             	mov    %rsp,%rbp
+  80159b:	53                   	push   %rbx
+  80159c:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8015a3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015c2:	48 85 c0             	test   %rax,%rax
+  8015c5:	7f 06                	jg     8015cd <sys_env_set_trapframe+0x36>
+}
+  8015c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015cb:	c9                   	leave
+  8015cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015cd:	49 89 c0             	mov    %rax,%r8
+  8015d0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8015d5:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  8015dc:	00 00 00 
+  8015df:	be 26 00 00 00       	mov    $0x26,%esi
+  8015e4:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  8015eb:	00 00 00 
+  8015ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f3:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  8015fa:	00 00 00 
+  8015fd:	41 ff d1             	call   *%r9
+
+0000000000801600 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801600:	55                   	push   %rbp
+  801601:	48 89 e5             	mov    %rsp,%rbp
+  801604:	53                   	push   %rbx
+  801605:	48 83 ec 08          	sub    $0x8,%rsp
+  801609:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80160c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80160f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801614:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801619:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80161e:	be 00 00 00 00       	mov    $0x0,%esi
+  801623:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801629:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80162b:	48 85 c0             	test   %rax,%rax
+  80162e:	7f 06                	jg     801636 <sys_env_set_pgfault_upcall+0x36>
+}
+  801630:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801634:	c9                   	leave
+  801635:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801636:	49 89 c0             	mov    %rax,%r8
+  801639:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80163e:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  801645:	00 00 00 
+  801648:	be 26 00 00 00       	mov    $0x26,%esi
+  80164d:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  801654:	00 00 00 
+  801657:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165c:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  801663:	00 00 00 
+  801666:	41 ff d1             	call   *%r9
+
+0000000000801669 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801669:	55                   	push   %rbp
+  80166a:	48 89 e5             	mov    %rsp,%rbp
+  80166d:	53                   	push   %rbx
+  80166e:	89 f8                	mov    %edi,%eax
+  801670:	49 89 f1             	mov    %rsi,%r9
+  801673:	48 89 d3             	mov    %rdx,%rbx
+  801676:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801679:	49 63 f0             	movslq %r8d,%rsi
+  80167c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80167f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801684:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801687:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80168d:	cd 30                	int    $0x30
+}
+  80168f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801693:	c9                   	leave
+  801694:	c3                   	ret
+
+0000000000801695 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801695:	55                   	push   %rbp
+  801696:	48 89 e5             	mov    %rsp,%rbp
+  801699:	53                   	push   %rbx
+  80169a:	48 83 ec 08          	sub    $0x8,%rsp
+  80169e:	48 89 fa             	mov    %rdi,%rdx
+  8016a1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016a4:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016c0:	48 85 c0             	test   %rax,%rax
+  8016c3:	7f 06                	jg     8016cb <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016c9:	c9                   	leave
+  8016ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016cb:	49 89 c0             	mov    %rax,%r8
+  8016ce:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8016d3:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  8016da:	00 00 00 
+  8016dd:	be 26 00 00 00       	mov    $0x26,%esi
+  8016e2:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  8016e9:	00 00 00 
+  8016ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f1:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  8016f8:	00 00 00 
+  8016fb:	41 ff d1             	call   *%r9
+
+00000000008016fe <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8016fe:	55                   	push   %rbp
+  8016ff:	48 89 e5             	mov    %rsp,%rbp
+  801702:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801703:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801708:	ba 00 00 00 00       	mov    $0x0,%edx
+  80170d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801712:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801717:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80171c:	be 00 00 00 00       	mov    $0x0,%esi
+  801721:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801727:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801729:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80172d:	c9                   	leave
+  80172e:	c3                   	ret
+
+000000000080172f <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80172f:	55                   	push   %rbp
+  801730:	48 89 e5             	mov    %rsp,%rbp
+  801733:	53                   	push   %rbx
+  801734:	48 83 ec 08          	sub    $0x8,%rsp
+  801738:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  80173b:	48 63 ce             	movslq %esi,%rcx
+  80173e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801741:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801746:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80174b:	be 00 00 00 00       	mov    $0x0,%esi
+  801750:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801756:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801758:	48 85 c0             	test   %rax,%rax
+  80175b:	7f 06                	jg     801763 <sys_sigqueue+0x34>
+}
+  80175d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801761:	c9                   	leave
+  801762:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801763:	49 89 c0             	mov    %rax,%r8
+  801766:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80176b:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  801772:	00 00 00 
+  801775:	be 26 00 00 00       	mov    $0x26,%esi
+  80177a:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  801781:	00 00 00 
+  801784:	b8 00 00 00 00       	mov    $0x0,%eax
+  801789:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  801790:	00 00 00 
+  801793:	41 ff d1             	call   *%r9
+
+0000000000801796 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801796:	55                   	push   %rbp
+  801797:	48 89 e5             	mov    %rsp,%rbp
+  80179a:	53                   	push   %rbx
+  80179b:	48 83 ec 08          	sub    $0x8,%rsp
+  80179f:	48 89 fa             	mov    %rdi,%rdx
+  8017a2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a5:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017bf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017c1:	48 85 c0             	test   %rax,%rax
+  8017c4:	7f 06                	jg     8017cc <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  8017c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ca:	c9                   	leave
+  8017cb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017cc:	49 89 c0             	mov    %rax,%r8
+  8017cf:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8017d4:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  8017db:	00 00 00 
+  8017de:	be 26 00 00 00       	mov    $0x26,%esi
+  8017e3:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  8017ea:	00 00 00 
+  8017ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f2:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  8017f9:	00 00 00 
+  8017fc:	41 ff d1             	call   *%r9
+
+00000000008017ff <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  8017ff:	55                   	push   %rbp
+  801800:	48 89 e5             	mov    %rsp,%rbp
+  801803:	53                   	push   %rbx
+  801804:	48 83 ec 08          	sub    $0x8,%rsp
+  801808:	48 89 f1             	mov    %rsi,%rcx
+  80180b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80180e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801811:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801816:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80181b:	be 00 00 00 00       	mov    $0x0,%esi
+  801820:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801826:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801828:	48 85 c0             	test   %rax,%rax
+  80182b:	7f 06                	jg     801833 <sys_sigaction+0x34>
+}
+  80182d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801831:	c9                   	leave
+  801832:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801833:	49 89 c0             	mov    %rax,%r8
+  801836:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80183b:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  801842:	00 00 00 
+  801845:	be 26 00 00 00       	mov    $0x26,%esi
+  80184a:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  801851:	00 00 00 
+  801854:	b8 00 00 00 00       	mov    $0x0,%eax
+  801859:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  801860:	00 00 00 
+  801863:	41 ff d1             	call   *%r9
+
+0000000000801866 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801866:	55                   	push   %rbp
+  801867:	48 89 e5             	mov    %rsp,%rbp
+  80186a:	53                   	push   %rbx
+  80186b:	48 83 ec 08          	sub    $0x8,%rsp
+  80186f:	48 89 f1             	mov    %rsi,%rcx
+  801872:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801875:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801878:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80187d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801882:	be 00 00 00 00       	mov    $0x0,%esi
+  801887:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80188d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80188f:	48 85 c0             	test   %rax,%rax
+  801892:	7f 06                	jg     80189a <sys_sigprocmask+0x34>
+}
+  801894:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801898:	c9                   	leave
+  801899:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80189a:	49 89 c0             	mov    %rax,%r8
+  80189d:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8018a2:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  8018a9:	00 00 00 
+  8018ac:	be 26 00 00 00       	mov    $0x26,%esi
+  8018b1:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  8018b8:	00 00 00 
+  8018bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c0:	49 b9 06 03 80 00 00 	movabs $0x800306,%r9
+  8018c7:	00 00 00 
+  8018ca:	41 ff d1             	call   *%r9
+
+00000000008018cd <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018cd:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018d4:	ff ff ff 
+  8018d7:	48 01 f8             	add    %rdi,%rax
+  8018da:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8018de:	c3                   	ret
+
+00000000008018df <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018df:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018e6:	ff ff ff 
+  8018e9:	48 01 f8             	add    %rdi,%rax
+  8018ec:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8018f0:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8018f6:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8018fa:	c3                   	ret
+
+00000000008018fb <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8018fb:	55                   	push   %rbp
+  8018fc:	48 89 e5             	mov    %rsp,%rbp
+  8018ff:	41 57                	push   %r15
+  801901:	41 56                	push   %r14
+  801903:	41 55                	push   %r13
+  801905:	41 54                	push   %r12
+  801907:	53                   	push   %rbx
+  801908:	48 83 ec 08          	sub    $0x8,%rsp
+  80190c:	49 89 ff             	mov    %rdi,%r15
+  80190f:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801914:	49 bd 1d 2a 80 00 00 	movabs $0x802a1d,%r13
+  80191b:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80191e:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801924:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801927:	48 89 df             	mov    %rbx,%rdi
+  80192a:	41 ff d5             	call   *%r13
+  80192d:	83 e0 04             	and    $0x4,%eax
+  801930:	74 17                	je     801949 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801932:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801939:	4c 39 f3             	cmp    %r14,%rbx
+  80193c:	75 e6                	jne    801924 <fd_alloc+0x29>
+  80193e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801944:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801949:	4d 89 27             	mov    %r12,(%r15)
+}
+  80194c:	48 83 c4 08          	add    $0x8,%rsp
+  801950:	5b                   	pop    %rbx
+  801951:	41 5c                	pop    %r12
+  801953:	41 5d                	pop    %r13
+  801955:	41 5e                	pop    %r14
+  801957:	41 5f                	pop    %r15
+  801959:	5d                   	pop    %rbp
+  80195a:	c3                   	ret
+
+000000000080195b <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80195b:	83 ff 1f             	cmp    $0x1f,%edi
+  80195e:	77 39                	ja     801999 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801960:	55                   	push   %rbp
+  801961:	48 89 e5             	mov    %rsp,%rbp
+  801964:	41 54                	push   %r12
+  801966:	53                   	push   %rbx
+  801967:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80196a:	48 63 df             	movslq %edi,%rbx
+  80196d:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801974:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801978:	48 89 df             	mov    %rbx,%rdi
+  80197b:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  801982:	00 00 00 
+  801985:	ff d0                	call   *%rax
+  801987:	a8 04                	test   $0x4,%al
+  801989:	74 14                	je     80199f <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80198b:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80198f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801994:	5b                   	pop    %rbx
+  801995:	41 5c                	pop    %r12
+  801997:	5d                   	pop    %rbp
+  801998:	c3                   	ret
+        return -E_INVAL;
+  801999:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80199e:	c3                   	ret
+        return -E_INVAL;
+  80199f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019a4:	eb ee                	jmp    801994 <fd_lookup+0x39>
+
+00000000008019a6 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8019a6:	55                   	push   %rbp
+  8019a7:	48 89 e5             	mov    %rsp,%rbp
+  8019aa:	41 54                	push   %r12
+  8019ac:	53                   	push   %rbx
+  8019ad:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8019b0:	48 b8 60 35 80 00 00 	movabs $0x803560,%rax
+  8019b7:	00 00 00 
+  8019ba:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8019c1:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8019c4:	39 3b                	cmp    %edi,(%rbx)
+  8019c6:	74 47                	je     801a0f <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8019c8:	48 83 c0 08          	add    $0x8,%rax
+  8019cc:	48 8b 18             	mov    (%rax),%rbx
+  8019cf:	48 85 db             	test   %rbx,%rbx
+  8019d2:	75 f0                	jne    8019c4 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019d4:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  8019db:	00 00 00 
+  8019de:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019e4:	89 fa                	mov    %edi,%edx
+  8019e6:	48 bf e0 34 80 00 00 	movabs $0x8034e0,%rdi
+  8019ed:	00 00 00 
+  8019f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f5:	48 b9 56 04 80 00 00 	movabs $0x800456,%rcx
+  8019fc:	00 00 00 
+  8019ff:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a01:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a06:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a0a:	5b                   	pop    %rbx
+  801a0b:	41 5c                	pop    %r12
+  801a0d:	5d                   	pop    %rbp
+  801a0e:	c3                   	ret
+            return 0;
+  801a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a14:	eb f0                	jmp    801a06 <dev_lookup+0x60>
+
+0000000000801a16 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a16:	55                   	push   %rbp
+  801a17:	48 89 e5             	mov    %rsp,%rbp
+  801a1a:	41 55                	push   %r13
+  801a1c:	41 54                	push   %r12
+  801a1e:	53                   	push   %rbx
+  801a1f:	48 83 ec 18          	sub    $0x18,%rsp
+  801a23:	48 89 fb             	mov    %rdi,%rbx
+  801a26:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a29:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a30:	ff ff ff 
+  801a33:	48 01 df             	add    %rbx,%rdi
+  801a36:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a3a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a3e:	48 b8 5b 19 80 00 00 	movabs $0x80195b,%rax
+  801a45:	00 00 00 
+  801a48:	ff d0                	call   *%rax
+  801a4a:	41 89 c5             	mov    %eax,%r13d
+  801a4d:	85 c0                	test   %eax,%eax
+  801a4f:	78 06                	js     801a57 <fd_close+0x41>
+  801a51:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a55:	74 1a                	je     801a71 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a57:	45 84 e4             	test   %r12b,%r12b
+  801a5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5f:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a63:	44 89 e8             	mov    %r13d,%eax
+  801a66:	48 83 c4 18          	add    $0x18,%rsp
+  801a6a:	5b                   	pop    %rbx
+  801a6b:	41 5c                	pop    %r12
+  801a6d:	41 5d                	pop    %r13
+  801a6f:	5d                   	pop    %rbp
+  801a70:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a71:	8b 3b                	mov    (%rbx),%edi
+  801a73:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a77:	48 b8 a6 19 80 00 00 	movabs $0x8019a6,%rax
+  801a7e:	00 00 00 
+  801a81:	ff d0                	call   *%rax
+  801a83:	41 89 c5             	mov    %eax,%r13d
+  801a86:	85 c0                	test   %eax,%eax
+  801a88:	78 1b                	js     801aa5 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a8a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a8e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801a92:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a98:	48 85 c0             	test   %rax,%rax
+  801a9b:	74 08                	je     801aa5 <fd_close+0x8f>
+  801a9d:	48 89 df             	mov    %rbx,%rdi
+  801aa0:	ff d0                	call   *%rax
+  801aa2:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801aa5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801aaa:	48 89 de             	mov    %rbx,%rsi
+  801aad:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ab2:	48 b8 f7 13 80 00 00 	movabs $0x8013f7,%rax
+  801ab9:	00 00 00 
+  801abc:	ff d0                	call   *%rax
+    return res;
+  801abe:	eb a3                	jmp    801a63 <fd_close+0x4d>
+
+0000000000801ac0 <close>:
+
+int
+close(int fdnum) {
+  801ac0:	55                   	push   %rbp
+  801ac1:	48 89 e5             	mov    %rsp,%rbp
+  801ac4:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801ac8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801acc:	48 b8 5b 19 80 00 00 	movabs $0x80195b,%rax
+  801ad3:	00 00 00 
+  801ad6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ad8:	85 c0                	test   %eax,%eax
+  801ada:	78 15                	js     801af1 <close+0x31>
+
+    return fd_close(fd, 1);
+  801adc:	be 01 00 00 00       	mov    $0x1,%esi
+  801ae1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801ae5:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  801aec:	00 00 00 
+  801aef:	ff d0                	call   *%rax
+}
+  801af1:	c9                   	leave
+  801af2:	c3                   	ret
+
+0000000000801af3 <close_all>:
+
+void
+close_all(void) {
+  801af3:	55                   	push   %rbp
+  801af4:	48 89 e5             	mov    %rsp,%rbp
+  801af7:	41 54                	push   %r12
+  801af9:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801afa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aff:	49 bc c0 1a 80 00 00 	movabs $0x801ac0,%r12
+  801b06:	00 00 00 
+  801b09:	89 df                	mov    %ebx,%edi
+  801b0b:	41 ff d4             	call   *%r12
+  801b0e:	83 c3 01             	add    $0x1,%ebx
+  801b11:	83 fb 20             	cmp    $0x20,%ebx
+  801b14:	75 f3                	jne    801b09 <close_all+0x16>
+}
+  801b16:	5b                   	pop    %rbx
+  801b17:	41 5c                	pop    %r12
+  801b19:	5d                   	pop    %rbp
+  801b1a:	c3                   	ret
+
+0000000000801b1b <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b1b:	55                   	push   %rbp
+  801b1c:	48 89 e5             	mov    %rsp,%rbp
+  801b1f:	41 57                	push   %r15
+  801b21:	41 56                	push   %r14
+  801b23:	41 55                	push   %r13
+  801b25:	41 54                	push   %r12
+  801b27:	53                   	push   %rbx
+  801b28:	48 83 ec 18          	sub    $0x18,%rsp
+  801b2c:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b2f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b33:	48 b8 5b 19 80 00 00 	movabs $0x80195b,%rax
+  801b3a:	00 00 00 
+  801b3d:	ff d0                	call   *%rax
+  801b3f:	89 c3                	mov    %eax,%ebx
+  801b41:	85 c0                	test   %eax,%eax
+  801b43:	0f 88 b8 00 00 00    	js     801c01 <dup+0xe6>
+    close(newfdnum);
+  801b49:	44 89 e7             	mov    %r12d,%edi
+  801b4c:	48 b8 c0 1a 80 00 00 	movabs $0x801ac0,%rax
+  801b53:	00 00 00 
+  801b56:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b58:	4d 63 ec             	movslq %r12d,%r13
+  801b5b:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801b62:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801b66:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b6a:	4c 89 ff             	mov    %r15,%rdi
+  801b6d:	49 be df 18 80 00 00 	movabs $0x8018df,%r14
+  801b74:	00 00 00 
+  801b77:	41 ff d6             	call   *%r14
+  801b7a:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b7d:	4c 89 ef             	mov    %r13,%rdi
+  801b80:	41 ff d6             	call   *%r14
+  801b83:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b86:	48 89 df             	mov    %rbx,%rdi
+  801b89:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  801b90:	00 00 00 
+  801b93:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801b95:	a8 04                	test   $0x4,%al
+  801b97:	74 2b                	je     801bc4 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801b99:	41 89 c1             	mov    %eax,%r9d
+  801b9c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ba2:	4c 89 f1             	mov    %r14,%rcx
+  801ba5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801baa:	48 89 de             	mov    %rbx,%rsi
+  801bad:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bb2:	48 b8 92 13 80 00 00 	movabs $0x801392,%rax
+  801bb9:	00 00 00 
+  801bbc:	ff d0                	call   *%rax
+  801bbe:	89 c3                	mov    %eax,%ebx
+  801bc0:	85 c0                	test   %eax,%eax
+  801bc2:	78 4e                	js     801c12 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801bc4:	4c 89 ff             	mov    %r15,%rdi
+  801bc7:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  801bce:	00 00 00 
+  801bd1:	ff d0                	call   *%rax
+  801bd3:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801bd6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bdc:	4c 89 e9             	mov    %r13,%rcx
+  801bdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801be4:	4c 89 fe             	mov    %r15,%rsi
+  801be7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bec:	48 b8 92 13 80 00 00 	movabs $0x801392,%rax
+  801bf3:	00 00 00 
+  801bf6:	ff d0                	call   *%rax
+  801bf8:	89 c3                	mov    %eax,%ebx
+  801bfa:	85 c0                	test   %eax,%eax
+  801bfc:	78 14                	js     801c12 <dup+0xf7>
+
+    return newfdnum;
+  801bfe:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c01:	89 d8                	mov    %ebx,%eax
+  801c03:	48 83 c4 18          	add    $0x18,%rsp
+  801c07:	5b                   	pop    %rbx
+  801c08:	41 5c                	pop    %r12
+  801c0a:	41 5d                	pop    %r13
+  801c0c:	41 5e                	pop    %r14
+  801c0e:	41 5f                	pop    %r15
+  801c10:	5d                   	pop    %rbp
+  801c11:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c12:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c17:	4c 89 ee             	mov    %r13,%rsi
+  801c1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c1f:	49 bc f7 13 80 00 00 	movabs $0x8013f7,%r12
+  801c26:	00 00 00 
+  801c29:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c2c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c31:	4c 89 f6             	mov    %r14,%rsi
+  801c34:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c39:	41 ff d4             	call   *%r12
+    return res;
+  801c3c:	eb c3                	jmp    801c01 <dup+0xe6>
+
+0000000000801c3e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c3e:	55                   	push   %rbp
+  801c3f:	48 89 e5             	mov    %rsp,%rbp
+  801c42:	41 56                	push   %r14
+  801c44:	41 55                	push   %r13
+  801c46:	41 54                	push   %r12
+  801c48:	53                   	push   %rbx
+  801c49:	48 83 ec 10          	sub    $0x10,%rsp
+  801c4d:	89 fb                	mov    %edi,%ebx
+  801c4f:	49 89 f4             	mov    %rsi,%r12
+  801c52:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c55:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c59:	48 b8 5b 19 80 00 00 	movabs $0x80195b,%rax
+  801c60:	00 00 00 
+  801c63:	ff d0                	call   *%rax
+  801c65:	85 c0                	test   %eax,%eax
+  801c67:	78 4c                	js     801cb5 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c69:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c6d:	41 8b 3e             	mov    (%r14),%edi
+  801c70:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c74:	48 b8 a6 19 80 00 00 	movabs $0x8019a6,%rax
+  801c7b:	00 00 00 
+  801c7e:	ff d0                	call   *%rax
+  801c80:	85 c0                	test   %eax,%eax
+  801c82:	78 35                	js     801cb9 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c84:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c88:	83 e0 03             	and    $0x3,%eax
+  801c8b:	83 f8 01             	cmp    $0x1,%eax
+  801c8e:	74 2d                	je     801cbd <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c90:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c94:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c98:	48 85 c0             	test   %rax,%rax
+  801c9b:	74 56                	je     801cf3 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c9d:	4c 89 ea             	mov    %r13,%rdx
+  801ca0:	4c 89 e6             	mov    %r12,%rsi
+  801ca3:	4c 89 f7             	mov    %r14,%rdi
+  801ca6:	ff d0                	call   *%rax
+}
+  801ca8:	48 83 c4 10          	add    $0x10,%rsp
+  801cac:	5b                   	pop    %rbx
+  801cad:	41 5c                	pop    %r12
+  801caf:	41 5d                	pop    %r13
+  801cb1:	41 5e                	pop    %r14
+  801cb3:	5d                   	pop    %rbp
+  801cb4:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cb5:	48 98                	cltq
+  801cb7:	eb ef                	jmp    801ca8 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cb9:	48 98                	cltq
+  801cbb:	eb eb                	jmp    801ca8 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cbd:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801cc4:	00 00 00 
+  801cc7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ccd:	89 da                	mov    %ebx,%edx
+  801ccf:	48 bf 21 35 80 00 00 	movabs $0x803521,%rdi
+  801cd6:	00 00 00 
+  801cd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cde:	48 b9 56 04 80 00 00 	movabs $0x800456,%rcx
+  801ce5:	00 00 00 
+  801ce8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cea:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801cf1:	eb b5                	jmp    801ca8 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801cf3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801cfa:	eb ac                	jmp    801ca8 <read+0x6a>
+
+0000000000801cfc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801cfc:	55                   	push   %rbp
+  801cfd:	48 89 e5             	mov    %rsp,%rbp
+  801d00:	41 57                	push   %r15
+  801d02:	41 56                	push   %r14
+  801d04:	41 55                	push   %r13
+  801d06:	41 54                	push   %r12
+  801d08:	53                   	push   %rbx
+  801d09:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d0d:	48 85 d2             	test   %rdx,%rdx
+  801d10:	74 54                	je     801d66 <readn+0x6a>
+  801d12:	41 89 fd             	mov    %edi,%r13d
+  801d15:	49 89 f6             	mov    %rsi,%r14
+  801d18:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d20:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d25:	49 bf 3e 1c 80 00 00 	movabs $0x801c3e,%r15
+  801d2c:	00 00 00 
+  801d2f:	4c 89 e2             	mov    %r12,%rdx
+  801d32:	48 29 f2             	sub    %rsi,%rdx
+  801d35:	4c 01 f6             	add    %r14,%rsi
+  801d38:	44 89 ef             	mov    %r13d,%edi
+  801d3b:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d3e:	85 c0                	test   %eax,%eax
+  801d40:	78 20                	js     801d62 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d42:	01 c3                	add    %eax,%ebx
+  801d44:	85 c0                	test   %eax,%eax
+  801d46:	74 08                	je     801d50 <readn+0x54>
+  801d48:	48 63 f3             	movslq %ebx,%rsi
+  801d4b:	4c 39 e6             	cmp    %r12,%rsi
+  801d4e:	72 df                	jb     801d2f <readn+0x33>
+    }
+    return res;
+  801d50:	48 63 c3             	movslq %ebx,%rax
+}
+  801d53:	48 83 c4 08          	add    $0x8,%rsp
+  801d57:	5b                   	pop    %rbx
+  801d58:	41 5c                	pop    %r12
+  801d5a:	41 5d                	pop    %r13
+  801d5c:	41 5e                	pop    %r14
+  801d5e:	41 5f                	pop    %r15
+  801d60:	5d                   	pop    %rbp
+  801d61:	c3                   	ret
+        if (inc < 0) return inc;
+  801d62:	48 98                	cltq
+  801d64:	eb ed                	jmp    801d53 <readn+0x57>
+    int inc = 1, res = 0;
+  801d66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d6b:	eb e3                	jmp    801d50 <readn+0x54>
+
+0000000000801d6d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d6d:	55                   	push   %rbp
+  801d6e:	48 89 e5             	mov    %rsp,%rbp
+  801d71:	41 56                	push   %r14
+  801d73:	41 55                	push   %r13
+  801d75:	41 54                	push   %r12
+  801d77:	53                   	push   %rbx
+  801d78:	48 83 ec 10          	sub    $0x10,%rsp
+  801d7c:	89 fb                	mov    %edi,%ebx
+  801d7e:	49 89 f4             	mov    %rsi,%r12
+  801d81:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d84:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d88:	48 b8 5b 19 80 00 00 	movabs $0x80195b,%rax
+  801d8f:	00 00 00 
+  801d92:	ff d0                	call   *%rax
+  801d94:	85 c0                	test   %eax,%eax
+  801d96:	78 47                	js     801ddf <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d98:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d9c:	41 8b 3e             	mov    (%r14),%edi
+  801d9f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801da3:	48 b8 a6 19 80 00 00 	movabs $0x8019a6,%rax
+  801daa:	00 00 00 
+  801dad:	ff d0                	call   *%rax
+  801daf:	85 c0                	test   %eax,%eax
+  801db1:	78 30                	js     801de3 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801db3:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801db8:	74 2d                	je     801de7 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dbe:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801dc2:	48 85 c0             	test   %rax,%rax
+  801dc5:	74 56                	je     801e1d <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801dc7:	4c 89 ea             	mov    %r13,%rdx
+  801dca:	4c 89 e6             	mov    %r12,%rsi
+  801dcd:	4c 89 f7             	mov    %r14,%rdi
+  801dd0:	ff d0                	call   *%rax
+}
+  801dd2:	48 83 c4 10          	add    $0x10,%rsp
+  801dd6:	5b                   	pop    %rbx
+  801dd7:	41 5c                	pop    %r12
+  801dd9:	41 5d                	pop    %r13
+  801ddb:	41 5e                	pop    %r14
+  801ddd:	5d                   	pop    %rbp
+  801dde:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ddf:	48 98                	cltq
+  801de1:	eb ef                	jmp    801dd2 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801de3:	48 98                	cltq
+  801de5:	eb eb                	jmp    801dd2 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801de7:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801dee:	00 00 00 
+  801df1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801df7:	89 da                	mov    %ebx,%edx
+  801df9:	48 bf 3d 35 80 00 00 	movabs $0x80353d,%rdi
+  801e00:	00 00 00 
+  801e03:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e08:	48 b9 56 04 80 00 00 	movabs $0x800456,%rcx
+  801e0f:	00 00 00 
+  801e12:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e14:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e1b:	eb b5                	jmp    801dd2 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e1d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e24:	eb ac                	jmp    801dd2 <write+0x65>
+
+0000000000801e26 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e26:	55                   	push   %rbp
+  801e27:	48 89 e5             	mov    %rsp,%rbp
+  801e2a:	53                   	push   %rbx
+  801e2b:	48 83 ec 18          	sub    $0x18,%rsp
+  801e2f:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e31:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e35:	48 b8 5b 19 80 00 00 	movabs $0x80195b,%rax
+  801e3c:	00 00 00 
+  801e3f:	ff d0                	call   *%rax
+  801e41:	85 c0                	test   %eax,%eax
+  801e43:	78 0c                	js     801e51 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801e45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e49:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801e4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e51:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e55:	c9                   	leave
+  801e56:	c3                   	ret
+
+0000000000801e57 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e57:	55                   	push   %rbp
+  801e58:	48 89 e5             	mov    %rsp,%rbp
+  801e5b:	41 55                	push   %r13
+  801e5d:	41 54                	push   %r12
+  801e5f:	53                   	push   %rbx
+  801e60:	48 83 ec 18          	sub    $0x18,%rsp
+  801e64:	89 fb                	mov    %edi,%ebx
+  801e66:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e69:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e6d:	48 b8 5b 19 80 00 00 	movabs $0x80195b,%rax
+  801e74:	00 00 00 
+  801e77:	ff d0                	call   *%rax
+  801e79:	85 c0                	test   %eax,%eax
+  801e7b:	78 38                	js     801eb5 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e7d:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e81:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e85:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e89:	48 b8 a6 19 80 00 00 	movabs $0x8019a6,%rax
+  801e90:	00 00 00 
+  801e93:	ff d0                	call   *%rax
+  801e95:	85 c0                	test   %eax,%eax
+  801e97:	78 1c                	js     801eb5 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e99:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e9e:	74 20                	je     801ec0 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ea0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ea4:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801ea8:	48 85 c0             	test   %rax,%rax
+  801eab:	74 47                	je     801ef4 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ead:	44 89 e6             	mov    %r12d,%esi
+  801eb0:	4c 89 ef             	mov    %r13,%rdi
+  801eb3:	ff d0                	call   *%rax
+}
+  801eb5:	48 83 c4 18          	add    $0x18,%rsp
+  801eb9:	5b                   	pop    %rbx
+  801eba:	41 5c                	pop    %r12
+  801ebc:	41 5d                	pop    %r13
+  801ebe:	5d                   	pop    %rbp
+  801ebf:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ec0:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801ec7:	00 00 00 
+  801eca:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ed0:	89 da                	mov    %ebx,%edx
+  801ed2:	48 bf 00 35 80 00 00 	movabs $0x803500,%rdi
+  801ed9:	00 00 00 
+  801edc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee1:	48 b9 56 04 80 00 00 	movabs $0x800456,%rcx
+  801ee8:	00 00 00 
+  801eeb:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801eed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ef2:	eb c1                	jmp    801eb5 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ef4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ef9:	eb ba                	jmp    801eb5 <ftruncate+0x5e>
+
+0000000000801efb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801efb:	55                   	push   %rbp
+  801efc:	48 89 e5             	mov    %rsp,%rbp
+  801eff:	41 54                	push   %r12
+  801f01:	53                   	push   %rbx
+  801f02:	48 83 ec 10          	sub    $0x10,%rsp
+  801f06:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f09:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f0d:	48 b8 5b 19 80 00 00 	movabs $0x80195b,%rax
+  801f14:	00 00 00 
+  801f17:	ff d0                	call   *%rax
+  801f19:	85 c0                	test   %eax,%eax
+  801f1b:	78 4e                	js     801f6b <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f1d:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f21:	41 8b 3c 24          	mov    (%r12),%edi
+  801f25:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f29:	48 b8 a6 19 80 00 00 	movabs $0x8019a6,%rax
+  801f30:	00 00 00 
+  801f33:	ff d0                	call   *%rax
+  801f35:	85 c0                	test   %eax,%eax
+  801f37:	78 32                	js     801f6b <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f39:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f3d:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f42:	74 30                	je     801f74 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f44:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f47:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f4e:	00 00 00 
+    stat->st_isdir = 0;
+  801f51:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f58:	00 00 00 
+    stat->st_dev = dev;
+  801f5b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f62:	48 89 de             	mov    %rbx,%rsi
+  801f65:	4c 89 e7             	mov    %r12,%rdi
+  801f68:	ff 50 28             	call   *0x28(%rax)
+}
+  801f6b:	48 83 c4 10          	add    $0x10,%rsp
+  801f6f:	5b                   	pop    %rbx
+  801f70:	41 5c                	pop    %r12
+  801f72:	5d                   	pop    %rbp
+  801f73:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f74:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f79:	eb f0                	jmp    801f6b <fstat+0x70>
+
+0000000000801f7b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f7b:	55                   	push   %rbp
+  801f7c:	48 89 e5             	mov    %rsp,%rbp
+  801f7f:	41 54                	push   %r12
+  801f81:	53                   	push   %rbx
+  801f82:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f85:	be 00 00 00 00       	mov    $0x0,%esi
+  801f8a:	48 b8 fc 21 80 00 00 	movabs $0x8021fc,%rax
+  801f91:	00 00 00 
+  801f94:	ff d0                	call   *%rax
+  801f96:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f98:	85 c0                	test   %eax,%eax
+  801f9a:	78 25                	js     801fc1 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f9c:	4c 89 e6             	mov    %r12,%rsi
+  801f9f:	89 c7                	mov    %eax,%edi
+  801fa1:	48 b8 fb 1e 80 00 00 	movabs $0x801efb,%rax
+  801fa8:	00 00 00 
+  801fab:	ff d0                	call   *%rax
+  801fad:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801fb0:	89 df                	mov    %ebx,%edi
+  801fb2:	48 b8 c0 1a 80 00 00 	movabs $0x801ac0,%rax
+  801fb9:	00 00 00 
+  801fbc:	ff d0                	call   *%rax
+
+    return res;
+  801fbe:	44 89 e3             	mov    %r12d,%ebx
+}
+  801fc1:	89 d8                	mov    %ebx,%eax
+  801fc3:	5b                   	pop    %rbx
+  801fc4:	41 5c                	pop    %r12
+  801fc6:	5d                   	pop    %rbp
+  801fc7:	c3                   	ret
+
+0000000000801fc8 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801fc8:	55                   	push   %rbp
+  801fc9:	48 89 e5             	mov    %rsp,%rbp
+  801fcc:	41 54                	push   %r12
+  801fce:	53                   	push   %rbx
+  801fcf:	48 83 ec 10          	sub    $0x10,%rsp
+  801fd3:	41 89 fc             	mov    %edi,%r12d
+  801fd6:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fd9:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801fe0:	00 00 00 
+  801fe3:	83 38 00             	cmpl   $0x0,(%rax)
+  801fe6:	74 5e                	je     802046 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801fe8:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801fee:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801ff3:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801ffa:	00 00 00 
+  801ffd:	44 89 e6             	mov    %r12d,%esi
+  802000:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802007:	00 00 00 
+  80200a:	8b 38                	mov    (%rax),%edi
+  80200c:	48 b8 d9 2d 80 00 00 	movabs $0x802dd9,%rax
+  802013:	00 00 00 
+  802016:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802018:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80201f:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802020:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802025:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802029:	48 89 de             	mov    %rbx,%rsi
+  80202c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802031:	48 b8 44 2d 80 00 00 	movabs $0x802d44,%rax
+  802038:	00 00 00 
+  80203b:	ff d0                	call   *%rax
+}
+  80203d:	48 83 c4 10          	add    $0x10,%rsp
+  802041:	5b                   	pop    %rbx
+  802042:	41 5c                	pop    %r12
+  802044:	5d                   	pop    %rbp
+  802045:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802046:	bf 03 00 00 00       	mov    $0x3,%edi
+  80204b:	48 b8 79 2e 80 00 00 	movabs $0x802e79,%rax
+  802052:	00 00 00 
+  802055:	ff d0                	call   *%rax
+  802057:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80205e:	00 00 
+  802060:	eb 86                	jmp    801fe8 <fsipc+0x20>
+
+0000000000802062 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802062:	55                   	push   %rbp
+  802063:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802066:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80206d:	00 00 00 
+  802070:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802073:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802075:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802078:	be 00 00 00 00       	mov    $0x0,%esi
+  80207d:	bf 02 00 00 00       	mov    $0x2,%edi
+  802082:	48 b8 c8 1f 80 00 00 	movabs $0x801fc8,%rax
+  802089:	00 00 00 
+  80208c:	ff d0                	call   *%rax
+}
+  80208e:	5d                   	pop    %rbp
+  80208f:	c3                   	ret
+
+0000000000802090 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802090:	55                   	push   %rbp
+  802091:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802094:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802097:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80209e:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8020a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8020a5:	bf 06 00 00 00       	mov    $0x6,%edi
+  8020aa:	48 b8 c8 1f 80 00 00 	movabs $0x801fc8,%rax
+  8020b1:	00 00 00 
+  8020b4:	ff d0                	call   *%rax
+}
+  8020b6:	5d                   	pop    %rbp
+  8020b7:	c3                   	ret
+
+00000000008020b8 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8020b8:	55                   	push   %rbp
+  8020b9:	48 89 e5             	mov    %rsp,%rbp
+  8020bc:	41 54                	push   %r12
+  8020be:	53                   	push   %rbx
+  8020bf:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8020c2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8020c5:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8020cc:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8020ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d3:	bf 05 00 00 00       	mov    $0x5,%edi
+  8020d8:	48 b8 c8 1f 80 00 00 	movabs $0x801fc8,%rax
+  8020df:	00 00 00 
+  8020e2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020e4:	85 c0                	test   %eax,%eax
+  8020e6:	78 3d                	js     802125 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8020e8:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8020ef:	00 00 00 
+  8020f2:	4c 89 e6             	mov    %r12,%rsi
+  8020f5:	48 89 df             	mov    %rbx,%rdi
+  8020f8:	48 b8 7b 0d 80 00 00 	movabs $0x800d7b,%rax
+  8020ff:	00 00 00 
+  802102:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802104:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80210b:	00 
+  80210c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802112:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802119:	00 
+  80211a:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802120:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802125:	5b                   	pop    %rbx
+  802126:	41 5c                	pop    %r12
+  802128:	5d                   	pop    %rbp
+  802129:	c3                   	ret
+
+000000000080212a <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80212a:	55                   	push   %rbp
+  80212b:	48 89 e5             	mov    %rsp,%rbp
+  80212e:	41 54                	push   %r12
+  802130:	53                   	push   %rbx
+  802131:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  802134:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802139:	48 39 c2             	cmp    %rax,%rdx
+  80213c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802140:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802143:	48 89 c2             	mov    %rax,%rdx
+  802146:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80214d:	00 00 00 
+  802150:	48 b8 dc 0f 80 00 00 	movabs $0x800fdc,%rax
+  802157:	00 00 00 
+  80215a:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80215c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802163:	00 00 00 
+  802166:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80216b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  80216d:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  802171:	be 00 00 00 00       	mov    $0x0,%esi
+  802176:	bf 04 00 00 00       	mov    $0x4,%edi
+  80217b:	48 b8 c8 1f 80 00 00 	movabs $0x801fc8,%rax
+  802182:	00 00 00 
+  802185:	ff d0                	call   *%rax
+  802187:	48 98                	cltq
+}
+  802189:	5b                   	pop    %rbx
+  80218a:	41 5c                	pop    %r12
+  80218c:	5d                   	pop    %rbp
+  80218d:	c3                   	ret
+
+000000000080218e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80218e:	55                   	push   %rbp
+  80218f:	48 89 e5             	mov    %rsp,%rbp
+  802192:	41 54                	push   %r12
+  802194:	53                   	push   %rbx
+  802195:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802198:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80219f:	00 00 00 
+  8021a2:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8021a5:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8021a7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021ac:	48 39 ca             	cmp    %rcx,%rdx
+  8021af:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8021b3:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8021b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8021bc:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021c1:	48 b8 c8 1f 80 00 00 	movabs $0x801fc8,%rax
+  8021c8:	00 00 00 
+  8021cb:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  8021cd:	85 c0                	test   %eax,%eax
+  8021cf:	78 27                	js     8021f8 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  8021d1:	48 63 d8             	movslq %eax,%rbx
+  8021d4:	48 89 da             	mov    %rbx,%rdx
+  8021d7:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8021de:	00 00 00 
+  8021e1:	4c 89 e7             	mov    %r12,%rdi
+  8021e4:	48 b8 dc 0f 80 00 00 	movabs $0x800fdc,%rax
+  8021eb:	00 00 00 
+  8021ee:	ff d0                	call   *%rax
+    return bytes_read;
+  8021f0:	48 89 d8             	mov    %rbx,%rax
+}
+  8021f3:	5b                   	pop    %rbx
+  8021f4:	41 5c                	pop    %r12
+  8021f6:	5d                   	pop    %rbp
+  8021f7:	c3                   	ret
+        return bytes_read;
+  8021f8:	48 98                	cltq
+  8021fa:	eb f7                	jmp    8021f3 <devfile_read+0x65>
+
+00000000008021fc <open>:
+open(const char *path, int mode) {
+  8021fc:	55                   	push   %rbp
+  8021fd:	48 89 e5             	mov    %rsp,%rbp
+  802200:	41 55                	push   %r13
+  802202:	41 54                	push   %r12
+  802204:	53                   	push   %rbx
+  802205:	48 83 ec 18          	sub    $0x18,%rsp
+  802209:	49 89 fc             	mov    %rdi,%r12
+  80220c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80220f:	48 b8 3d 0d 80 00 00 	movabs $0x800d3d,%rax
+  802216:	00 00 00 
+  802219:	ff d0                	call   *%rax
+  80221b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802221:	0f 87 8a 00 00 00    	ja     8022b1 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802227:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80222b:	48 b8 fb 18 80 00 00 	movabs $0x8018fb,%rax
+  802232:	00 00 00 
+  802235:	ff d0                	call   *%rax
+  802237:	89 c3                	mov    %eax,%ebx
+  802239:	85 c0                	test   %eax,%eax
+  80223b:	78 50                	js     80228d <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80223d:	4c 89 e6             	mov    %r12,%rsi
+  802240:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802247:	00 00 00 
+  80224a:	48 89 df             	mov    %rbx,%rdi
+  80224d:	48 b8 7b 0d 80 00 00 	movabs $0x800d7b,%rax
+  802254:	00 00 00 
+  802257:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802259:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802260:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802264:	bf 01 00 00 00       	mov    $0x1,%edi
+  802269:	48 b8 c8 1f 80 00 00 	movabs $0x801fc8,%rax
+  802270:	00 00 00 
+  802273:	ff d0                	call   *%rax
+  802275:	89 c3                	mov    %eax,%ebx
+  802277:	85 c0                	test   %eax,%eax
+  802279:	78 1f                	js     80229a <open+0x9e>
+    return fd2num(fd);
+  80227b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80227f:	48 b8 cd 18 80 00 00 	movabs $0x8018cd,%rax
+  802286:	00 00 00 
+  802289:	ff d0                	call   *%rax
+  80228b:	89 c3                	mov    %eax,%ebx
+}
+  80228d:	89 d8                	mov    %ebx,%eax
+  80228f:	48 83 c4 18          	add    $0x18,%rsp
+  802293:	5b                   	pop    %rbx
+  802294:	41 5c                	pop    %r12
+  802296:	41 5d                	pop    %r13
+  802298:	5d                   	pop    %rbp
+  802299:	c3                   	ret
+        fd_close(fd, 0);
+  80229a:	be 00 00 00 00       	mov    $0x0,%esi
+  80229f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022a3:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  8022aa:	00 00 00 
+  8022ad:	ff d0                	call   *%rax
+        return res;
+  8022af:	eb dc                	jmp    80228d <open+0x91>
+        return -E_BAD_PATH;
+  8022b1:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8022b6:	eb d5                	jmp    80228d <open+0x91>
+
+00000000008022b8 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8022b8:	55                   	push   %rbp
+  8022b9:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8022bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8022c1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8022c6:	48 b8 c8 1f 80 00 00 	movabs $0x801fc8,%rax
+  8022cd:	00 00 00 
+  8022d0:	ff d0                	call   *%rax
+}
+  8022d2:	5d                   	pop    %rbp
+  8022d3:	c3                   	ret
+
+00000000008022d4 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8022d4:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8022d8:	7f 01                	jg     8022db <writebuf+0x7>
+  8022da:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8022db:	55                   	push   %rbp
+  8022dc:	48 89 e5             	mov    %rsp,%rbp
+  8022df:	53                   	push   %rbx
+  8022e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8022e4:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8022e7:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8022eb:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8022ef:	8b 3f                	mov    (%rdi),%edi
+  8022f1:	48 b8 6d 1d 80 00 00 	movabs $0x801d6d,%rax
+  8022f8:	00 00 00 
+  8022fb:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  8022fd:	48 85 c0             	test   %rax,%rax
+  802300:	7e 04                	jle    802306 <writebuf+0x32>
+  802302:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  802306:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  80230a:	48 39 c2             	cmp    %rax,%rdx
+  80230d:	74 0f                	je     80231e <writebuf+0x4a>
+            state->error = MIN(0, result);
+  80230f:	48 85 c0             	test   %rax,%rax
+  802312:	ba 00 00 00 00       	mov    $0x0,%edx
+  802317:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80231b:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  80231e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802322:	c9                   	leave
+  802323:	c3                   	ret
+
+0000000000802324 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  802324:	8b 46 04             	mov    0x4(%rsi),%eax
+  802327:	8d 50 01             	lea    0x1(%rax),%edx
+  80232a:	89 56 04             	mov    %edx,0x4(%rsi)
+  80232d:	48 98                	cltq
+  80232f:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  802334:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  80233a:	74 01                	je     80233d <putch+0x19>
+  80233c:	c3                   	ret
+putch(int ch, void *arg) {
+  80233d:	55                   	push   %rbp
+  80233e:	48 89 e5             	mov    %rsp,%rbp
+  802341:	53                   	push   %rbx
+  802342:	48 83 ec 08          	sub    $0x8,%rsp
+  802346:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  802349:	48 89 f7             	mov    %rsi,%rdi
+  80234c:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  802353:	00 00 00 
+  802356:	ff d0                	call   *%rax
+        state->offset = 0;
+  802358:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  80235f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802363:	c9                   	leave
+  802364:	c3                   	ret
+
+0000000000802365 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  802365:	55                   	push   %rbp
+  802366:	48 89 e5             	mov    %rsp,%rbp
+  802369:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  802370:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  802373:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  802379:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  802380:	00 00 00 
+    state.result = 0;
+  802383:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  80238a:	00 00 00 00 
+    state.error = 1;
+  80238e:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  802395:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  802398:	48 89 f2             	mov    %rsi,%rdx
+  80239b:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8023a2:	48 bf 24 23 80 00 00 	movabs $0x802324,%rdi
+  8023a9:	00 00 00 
+  8023ac:	48 b8 a6 05 80 00 00 	movabs $0x8005a6,%rax
+  8023b3:	00 00 00 
+  8023b6:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8023b8:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8023bf:	7f 14                	jg     8023d5 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8023c1:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8023c8:	48 85 c0             	test   %rax,%rax
+  8023cb:	75 06                	jne    8023d3 <vfprintf+0x6e>
+  8023cd:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8023d3:	c9                   	leave
+  8023d4:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8023d5:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8023dc:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  8023e3:	00 00 00 
+  8023e6:	ff d0                	call   *%rax
+  8023e8:	eb d7                	jmp    8023c1 <vfprintf+0x5c>
+
+00000000008023ea <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8023ea:	55                   	push   %rbp
+  8023eb:	48 89 e5             	mov    %rsp,%rbp
+  8023ee:	48 83 ec 50          	sub    $0x50,%rsp
+  8023f2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8023f6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8023fa:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8023fe:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  802402:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802409:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80240d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802411:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802415:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  802419:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80241d:	48 b8 65 23 80 00 00 	movabs $0x802365,%rax
+  802424:	00 00 00 
+  802427:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  802429:	c9                   	leave
+  80242a:	c3                   	ret
+
+000000000080242b <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80242b:	55                   	push   %rbp
+  80242c:	48 89 e5             	mov    %rsp,%rbp
+  80242f:	48 83 ec 50          	sub    $0x50,%rsp
+  802433:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802437:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80243b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80243f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802443:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  802447:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80244e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802452:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802456:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80245a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  80245e:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  802462:	48 89 fe             	mov    %rdi,%rsi
+  802465:	bf 01 00 00 00       	mov    $0x1,%edi
+  80246a:	48 b8 65 23 80 00 00 	movabs $0x802365,%rax
+  802471:	00 00 00 
+  802474:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  802476:	c9                   	leave
+  802477:	c3                   	ret
+
+0000000000802478 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802478:	55                   	push   %rbp
+  802479:	48 89 e5             	mov    %rsp,%rbp
+  80247c:	41 54                	push   %r12
+  80247e:	53                   	push   %rbx
+  80247f:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802482:	48 b8 df 18 80 00 00 	movabs $0x8018df,%rax
+  802489:	00 00 00 
+  80248c:	ff d0                	call   *%rax
+  80248e:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802491:	48 be 80 35 80 00 00 	movabs $0x803580,%rsi
+  802498:	00 00 00 
+  80249b:	48 89 df             	mov    %rbx,%rdi
+  80249e:	48 b8 7b 0d 80 00 00 	movabs $0x800d7b,%rax
+  8024a5:	00 00 00 
+  8024a8:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8024aa:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8024af:	41 2b 04 24          	sub    (%r12),%eax
+  8024b3:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8024b9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8024c0:	00 00 00 
+    stat->st_dev = &devpipe;
+  8024c3:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8024ca:	00 00 00 
+  8024cd:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8024d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d9:	5b                   	pop    %rbx
+  8024da:	41 5c                	pop    %r12
+  8024dc:	5d                   	pop    %rbp
+  8024dd:	c3                   	ret
+
+00000000008024de <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8024de:	55                   	push   %rbp
+  8024df:	48 89 e5             	mov    %rsp,%rbp
+  8024e2:	41 54                	push   %r12
+  8024e4:	53                   	push   %rbx
+  8024e5:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8024e8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024ed:	48 89 fe             	mov    %rdi,%rsi
+  8024f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024f5:	49 bc f7 13 80 00 00 	movabs $0x8013f7,%r12
+  8024fc:	00 00 00 
+  8024ff:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802502:	48 89 df             	mov    %rbx,%rdi
+  802505:	48 b8 df 18 80 00 00 	movabs $0x8018df,%rax
+  80250c:	00 00 00 
+  80250f:	ff d0                	call   *%rax
+  802511:	48 89 c6             	mov    %rax,%rsi
+  802514:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802519:	bf 00 00 00 00       	mov    $0x0,%edi
+  80251e:	41 ff d4             	call   *%r12
+}
+  802521:	5b                   	pop    %rbx
+  802522:	41 5c                	pop    %r12
+  802524:	5d                   	pop    %rbp
+  802525:	c3                   	ret
+
+0000000000802526 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802526:	55                   	push   %rbp
+  802527:	48 89 e5             	mov    %rsp,%rbp
+  80252a:	41 57                	push   %r15
+  80252c:	41 56                	push   %r14
+  80252e:	41 55                	push   %r13
+  802530:	41 54                	push   %r12
+  802532:	53                   	push   %rbx
+  802533:	48 83 ec 18          	sub    $0x18,%rsp
+  802537:	49 89 fc             	mov    %rdi,%r12
+  80253a:	49 89 f5             	mov    %rsi,%r13
+  80253d:	49 89 d7             	mov    %rdx,%r15
+  802540:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802544:	48 b8 df 18 80 00 00 	movabs $0x8018df,%rax
+  80254b:	00 00 00 
+  80254e:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802550:	4d 85 ff             	test   %r15,%r15
+  802553:	0f 84 af 00 00 00    	je     802608 <devpipe_write+0xe2>
+  802559:	48 89 c3             	mov    %rax,%rbx
+  80255c:	4c 89 f8             	mov    %r15,%rax
+  80255f:	4d 89 ef             	mov    %r13,%r15
+  802562:	4c 01 e8             	add    %r13,%rax
+  802565:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802569:	49 bd ff 12 80 00 00 	movabs $0x8012ff,%r13
+  802570:	00 00 00 
+            sys_yield();
+  802573:	49 be 9c 12 80 00 00 	movabs $0x80129c,%r14
+  80257a:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80257d:	8b 73 04             	mov    0x4(%rbx),%esi
+  802580:	48 63 ce             	movslq %esi,%rcx
+  802583:	48 63 03             	movslq (%rbx),%rax
+  802586:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80258c:	48 39 c1             	cmp    %rax,%rcx
+  80258f:	72 2e                	jb     8025bf <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802591:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802596:	48 89 da             	mov    %rbx,%rdx
+  802599:	be 00 10 00 00       	mov    $0x1000,%esi
+  80259e:	4c 89 e7             	mov    %r12,%rdi
+  8025a1:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025a4:	85 c0                	test   %eax,%eax
+  8025a6:	74 66                	je     80260e <devpipe_write+0xe8>
+            sys_yield();
+  8025a8:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025ab:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025ae:	48 63 ce             	movslq %esi,%rcx
+  8025b1:	48 63 03             	movslq (%rbx),%rax
+  8025b4:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025ba:	48 39 c1             	cmp    %rax,%rcx
+  8025bd:	73 d2                	jae    802591 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025bf:	41 0f b6 3f          	movzbl (%r15),%edi
+  8025c3:	48 89 ca             	mov    %rcx,%rdx
+  8025c6:	48 c1 ea 03          	shr    $0x3,%rdx
+  8025ca:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8025d1:	08 10 20 
+  8025d4:	48 f7 e2             	mul    %rdx
+  8025d7:	48 c1 ea 06          	shr    $0x6,%rdx
+  8025db:	48 89 d0             	mov    %rdx,%rax
+  8025de:	48 c1 e0 09          	shl    $0x9,%rax
+  8025e2:	48 29 d0             	sub    %rdx,%rax
+  8025e5:	48 c1 e0 03          	shl    $0x3,%rax
+  8025e9:	48 29 c1             	sub    %rax,%rcx
+  8025ec:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8025f1:	83 c6 01             	add    $0x1,%esi
+  8025f4:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8025f7:	49 83 c7 01          	add    $0x1,%r15
+  8025fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025ff:	49 39 c7             	cmp    %rax,%r15
+  802602:	0f 85 75 ff ff ff    	jne    80257d <devpipe_write+0x57>
+    return n;
+  802608:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80260c:	eb 05                	jmp    802613 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80260e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802613:	48 83 c4 18          	add    $0x18,%rsp
+  802617:	5b                   	pop    %rbx
+  802618:	41 5c                	pop    %r12
+  80261a:	41 5d                	pop    %r13
+  80261c:	41 5e                	pop    %r14
+  80261e:	41 5f                	pop    %r15
+  802620:	5d                   	pop    %rbp
+  802621:	c3                   	ret
+
+0000000000802622 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802622:	55                   	push   %rbp
+  802623:	48 89 e5             	mov    %rsp,%rbp
+  802626:	41 57                	push   %r15
+  802628:	41 56                	push   %r14
+  80262a:	41 55                	push   %r13
+  80262c:	41 54                	push   %r12
+  80262e:	53                   	push   %rbx
+  80262f:	48 83 ec 18          	sub    $0x18,%rsp
+  802633:	49 89 fc             	mov    %rdi,%r12
+  802636:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80263a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80263e:	48 b8 df 18 80 00 00 	movabs $0x8018df,%rax
+  802645:	00 00 00 
+  802648:	ff d0                	call   *%rax
+  80264a:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80264d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802653:	49 bd ff 12 80 00 00 	movabs $0x8012ff,%r13
+  80265a:	00 00 00 
+            sys_yield();
+  80265d:	49 be 9c 12 80 00 00 	movabs $0x80129c,%r14
+  802664:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802667:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80266c:	74 7d                	je     8026eb <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80266e:	8b 03                	mov    (%rbx),%eax
+  802670:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802673:	75 26                	jne    80269b <devpipe_read+0x79>
+            if (i > 0) return i;
+  802675:	4d 85 ff             	test   %r15,%r15
+  802678:	75 77                	jne    8026f1 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80267a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80267f:	48 89 da             	mov    %rbx,%rdx
+  802682:	be 00 10 00 00       	mov    $0x1000,%esi
+  802687:	4c 89 e7             	mov    %r12,%rdi
+  80268a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80268d:	85 c0                	test   %eax,%eax
+  80268f:	74 72                	je     802703 <devpipe_read+0xe1>
+            sys_yield();
+  802691:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802694:	8b 03                	mov    (%rbx),%eax
+  802696:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802699:	74 df                	je     80267a <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80269b:	48 63 c8             	movslq %eax,%rcx
+  80269e:	48 89 ca             	mov    %rcx,%rdx
+  8026a1:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026a5:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8026ac:	08 10 20 
+  8026af:	48 89 d0             	mov    %rdx,%rax
+  8026b2:	48 f7 e6             	mul    %rsi
+  8026b5:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026b9:	48 89 d0             	mov    %rdx,%rax
+  8026bc:	48 c1 e0 09          	shl    $0x9,%rax
+  8026c0:	48 29 d0             	sub    %rdx,%rax
+  8026c3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8026ca:	00 
+  8026cb:	48 89 c8             	mov    %rcx,%rax
+  8026ce:	48 29 d0             	sub    %rdx,%rax
+  8026d1:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8026d6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8026da:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8026de:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8026e1:	49 83 c7 01          	add    $0x1,%r15
+  8026e5:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8026e9:	75 83                	jne    80266e <devpipe_read+0x4c>
+    return n;
+  8026eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026ef:	eb 03                	jmp    8026f4 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8026f1:	4c 89 f8             	mov    %r15,%rax
+}
+  8026f4:	48 83 c4 18          	add    $0x18,%rsp
+  8026f8:	5b                   	pop    %rbx
+  8026f9:	41 5c                	pop    %r12
+  8026fb:	41 5d                	pop    %r13
+  8026fd:	41 5e                	pop    %r14
+  8026ff:	41 5f                	pop    %r15
+  802701:	5d                   	pop    %rbp
+  802702:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802703:	b8 00 00 00 00       	mov    $0x0,%eax
+  802708:	eb ea                	jmp    8026f4 <devpipe_read+0xd2>
+
+000000000080270a <pipe>:
+pipe(int pfd[2]) {
+  80270a:	55                   	push   %rbp
+  80270b:	48 89 e5             	mov    %rsp,%rbp
+  80270e:	41 55                	push   %r13
+  802710:	41 54                	push   %r12
+  802712:	53                   	push   %rbx
+  802713:	48 83 ec 18          	sub    $0x18,%rsp
+  802717:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80271a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80271e:	48 b8 fb 18 80 00 00 	movabs $0x8018fb,%rax
+  802725:	00 00 00 
+  802728:	ff d0                	call   *%rax
+  80272a:	89 c3                	mov    %eax,%ebx
+  80272c:	85 c0                	test   %eax,%eax
+  80272e:	0f 88 a0 01 00 00    	js     8028d4 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802734:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802739:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80273e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802742:	bf 00 00 00 00       	mov    $0x0,%edi
+  802747:	48 b8 2b 13 80 00 00 	movabs $0x80132b,%rax
+  80274e:	00 00 00 
+  802751:	ff d0                	call   *%rax
+  802753:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802755:	85 c0                	test   %eax,%eax
+  802757:	0f 88 77 01 00 00    	js     8028d4 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80275d:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802761:	48 b8 fb 18 80 00 00 	movabs $0x8018fb,%rax
+  802768:	00 00 00 
+  80276b:	ff d0                	call   *%rax
+  80276d:	89 c3                	mov    %eax,%ebx
+  80276f:	85 c0                	test   %eax,%eax
+  802771:	0f 88 43 01 00 00    	js     8028ba <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802777:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80277c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802781:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802785:	bf 00 00 00 00       	mov    $0x0,%edi
+  80278a:	48 b8 2b 13 80 00 00 	movabs $0x80132b,%rax
+  802791:	00 00 00 
+  802794:	ff d0                	call   *%rax
+  802796:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802798:	85 c0                	test   %eax,%eax
+  80279a:	0f 88 1a 01 00 00    	js     8028ba <pipe+0x1b0>
+    va = fd2data(fd0);
+  8027a0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027a4:	48 b8 df 18 80 00 00 	movabs $0x8018df,%rax
+  8027ab:	00 00 00 
+  8027ae:	ff d0                	call   *%rax
+  8027b0:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8027b3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027b8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027bd:	48 89 c6             	mov    %rax,%rsi
+  8027c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027c5:	48 b8 2b 13 80 00 00 	movabs $0x80132b,%rax
+  8027cc:	00 00 00 
+  8027cf:	ff d0                	call   *%rax
+  8027d1:	89 c3                	mov    %eax,%ebx
+  8027d3:	85 c0                	test   %eax,%eax
+  8027d5:	0f 88 c5 00 00 00    	js     8028a0 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8027db:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8027df:	48 b8 df 18 80 00 00 	movabs $0x8018df,%rax
+  8027e6:	00 00 00 
+  8027e9:	ff d0                	call   *%rax
+  8027eb:	48 89 c1             	mov    %rax,%rcx
+  8027ee:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8027f4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8027fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ff:	4c 89 ee             	mov    %r13,%rsi
+  802802:	bf 00 00 00 00       	mov    $0x0,%edi
+  802807:	48 b8 92 13 80 00 00 	movabs $0x801392,%rax
+  80280e:	00 00 00 
+  802811:	ff d0                	call   *%rax
+  802813:	89 c3                	mov    %eax,%ebx
+  802815:	85 c0                	test   %eax,%eax
+  802817:	78 6e                	js     802887 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802819:	be 00 10 00 00       	mov    $0x1000,%esi
+  80281e:	4c 89 ef             	mov    %r13,%rdi
+  802821:	48 b8 cd 12 80 00 00 	movabs $0x8012cd,%rax
+  802828:	00 00 00 
+  80282b:	ff d0                	call   *%rax
+  80282d:	83 f8 02             	cmp    $0x2,%eax
+  802830:	0f 85 ab 00 00 00    	jne    8028e1 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802836:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80283d:	00 00 
+  80283f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802843:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802845:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802849:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802850:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802854:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802856:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80285a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802861:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802865:	48 bb cd 18 80 00 00 	movabs $0x8018cd,%rbx
+  80286c:	00 00 00 
+  80286f:	ff d3                	call   *%rbx
+  802871:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802875:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802879:	ff d3                	call   *%rbx
+  80287b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802880:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802885:	eb 4d                	jmp    8028d4 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802887:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80288c:	4c 89 ee             	mov    %r13,%rsi
+  80288f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802894:	48 b8 f7 13 80 00 00 	movabs $0x8013f7,%rax
+  80289b:	00 00 00 
+  80289e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8028a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028a5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8028a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028ae:	48 b8 f7 13 80 00 00 	movabs $0x8013f7,%rax
+  8028b5:	00 00 00 
+  8028b8:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8028ba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028bf:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8028c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028c8:	48 b8 f7 13 80 00 00 	movabs $0x8013f7,%rax
+  8028cf:	00 00 00 
+  8028d2:	ff d0                	call   *%rax
+}
+  8028d4:	89 d8                	mov    %ebx,%eax
+  8028d6:	48 83 c4 18          	add    $0x18,%rsp
+  8028da:	5b                   	pop    %rbx
+  8028db:	41 5c                	pop    %r12
+  8028dd:	41 5d                	pop    %r13
+  8028df:	5d                   	pop    %rbp
+  8028e0:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028e1:	48 b9 b0 35 80 00 00 	movabs $0x8035b0,%rcx
+  8028e8:	00 00 00 
+  8028eb:	48 ba 87 35 80 00 00 	movabs $0x803587,%rdx
+  8028f2:	00 00 00 
+  8028f5:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8028fa:	48 bf 9c 35 80 00 00 	movabs $0x80359c,%rdi
+  802901:	00 00 00 
+  802904:	b8 00 00 00 00       	mov    $0x0,%eax
+  802909:	49 b8 06 03 80 00 00 	movabs $0x800306,%r8
+  802910:	00 00 00 
+  802913:	41 ff d0             	call   *%r8
+
+0000000000802916 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802916:	55                   	push   %rbp
+  802917:	48 89 e5             	mov    %rsp,%rbp
+  80291a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80291e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802922:	48 b8 5b 19 80 00 00 	movabs $0x80195b,%rax
+  802929:	00 00 00 
+  80292c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80292e:	85 c0                	test   %eax,%eax
+  802930:	78 35                	js     802967 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802932:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802936:	48 b8 df 18 80 00 00 	movabs $0x8018df,%rax
+  80293d:	00 00 00 
+  802940:	ff d0                	call   *%rax
+  802942:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802945:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80294a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80294f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802953:	48 b8 ff 12 80 00 00 	movabs $0x8012ff,%rax
+  80295a:	00 00 00 
+  80295d:	ff d0                	call   *%rax
+  80295f:	85 c0                	test   %eax,%eax
+  802961:	0f 94 c0             	sete   %al
+  802964:	0f b6 c0             	movzbl %al,%eax
+}
+  802967:	c9                   	leave
+  802968:	c3                   	ret
+
+0000000000802969 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802969:	48 89 f8             	mov    %rdi,%rax
+  80296c:	48 c1 e8 27          	shr    $0x27,%rax
+  802970:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802977:	01 00 00 
+  80297a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80297e:	f6 c2 01             	test   $0x1,%dl
+  802981:	74 6d                	je     8029f0 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802983:	48 89 f8             	mov    %rdi,%rax
+  802986:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80298a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802991:	01 00 00 
+  802994:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802998:	f6 c2 01             	test   $0x1,%dl
+  80299b:	74 62                	je     8029ff <get_uvpt_entry+0x96>
+  80299d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8029a4:	01 00 00 
+  8029a7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029ab:	f6 c2 80             	test   $0x80,%dl
+  8029ae:	75 4f                	jne    8029ff <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8029b0:	48 89 f8             	mov    %rdi,%rax
+  8029b3:	48 c1 e8 15          	shr    $0x15,%rax
+  8029b7:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8029be:	01 00 00 
+  8029c1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029c5:	f6 c2 01             	test   $0x1,%dl
+  8029c8:	74 44                	je     802a0e <get_uvpt_entry+0xa5>
+  8029ca:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8029d1:	01 00 00 
+  8029d4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029d8:	f6 c2 80             	test   $0x80,%dl
+  8029db:	75 31                	jne    802a0e <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8029dd:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8029e1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8029e8:	01 00 00 
+  8029eb:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8029ef:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029f0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8029f7:	01 00 00 
+  8029fa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029fe:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029ff:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a06:	01 00 00 
+  802a09:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a0d:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a0e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a15:	01 00 00 
+  802a18:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a1c:	c3                   	ret
+
+0000000000802a1d <get_prot>:
+
+int
+get_prot(void *va) {
+  802a1d:	55                   	push   %rbp
+  802a1e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a21:	48 b8 69 29 80 00 00 	movabs $0x802969,%rax
+  802a28:	00 00 00 
+  802a2b:	ff d0                	call   *%rax
+  802a2d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802a30:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802a35:	89 c1                	mov    %eax,%ecx
+  802a37:	83 c9 04             	or     $0x4,%ecx
+  802a3a:	f6 c2 01             	test   $0x1,%dl
+  802a3d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802a40:	89 c1                	mov    %eax,%ecx
+  802a42:	83 c9 02             	or     $0x2,%ecx
+  802a45:	f6 c2 02             	test   $0x2,%dl
+  802a48:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802a4b:	89 c1                	mov    %eax,%ecx
+  802a4d:	83 c9 01             	or     $0x1,%ecx
+  802a50:	48 85 d2             	test   %rdx,%rdx
+  802a53:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802a56:	89 c1                	mov    %eax,%ecx
+  802a58:	83 c9 40             	or     $0x40,%ecx
+  802a5b:	f6 c6 04             	test   $0x4,%dh
+  802a5e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802a61:	5d                   	pop    %rbp
+  802a62:	c3                   	ret
+
+0000000000802a63 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802a63:	55                   	push   %rbp
+  802a64:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a67:	48 b8 69 29 80 00 00 	movabs $0x802969,%rax
+  802a6e:	00 00 00 
+  802a71:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802a73:	48 c1 e8 06          	shr    $0x6,%rax
+  802a77:	83 e0 01             	and    $0x1,%eax
+}
+  802a7a:	5d                   	pop    %rbp
+  802a7b:	c3                   	ret
+
+0000000000802a7c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802a7c:	55                   	push   %rbp
+  802a7d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802a80:	48 b8 69 29 80 00 00 	movabs $0x802969,%rax
+  802a87:	00 00 00 
+  802a8a:	ff d0                	call   *%rax
+  802a8c:	83 e0 01             	and    $0x1,%eax
+}
+  802a8f:	5d                   	pop    %rbp
+  802a90:	c3                   	ret
+
+0000000000802a91 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802a91:	55                   	push   %rbp
+  802a92:	48 89 e5             	mov    %rsp,%rbp
+  802a95:	41 57                	push   %r15
+  802a97:	41 56                	push   %r14
+  802a99:	41 55                	push   %r13
+  802a9b:	41 54                	push   %r12
+  802a9d:	53                   	push   %rbx
+  802a9e:	48 83 ec 18          	sub    $0x18,%rsp
+  802aa2:	49 89 ff             	mov    %rdi,%r15
+  802aa5:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802aa9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802aae:	49 bc 7c 2a 80 00 00 	movabs $0x802a7c,%r12
+  802ab5:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802ab8:	49 be 1d 2a 80 00 00 	movabs $0x802a1d,%r14
+  802abf:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802ac2:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802ac9:	00 00 00 
+  802acc:	eb 0c                	jmp    802ada <foreach_shared_region+0x49>
+  802ace:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ad5:	4c 39 eb             	cmp    %r13,%rbx
+  802ad8:	74 38                	je     802b12 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802ada:	48 89 df             	mov    %rbx,%rdi
+  802add:	41 ff d4             	call   *%r12
+  802ae0:	84 c0                	test   %al,%al
+  802ae2:	74 ea                	je     802ace <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802ae4:	48 89 df             	mov    %rbx,%rdi
+  802ae7:	41 ff d6             	call   *%r14
+  802aea:	a8 40                	test   $0x40,%al
+  802aec:	74 e0                	je     802ace <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802aee:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802af5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802af9:	48 89 df             	mov    %rbx,%rdi
+  802afc:	41 ff d7             	call   *%r15
+        if (err)
+  802aff:	85 c0                	test   %eax,%eax
+  802b01:	74 cb                	je     802ace <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802b03:	48 83 c4 18          	add    $0x18,%rsp
+  802b07:	5b                   	pop    %rbx
+  802b08:	41 5c                	pop    %r12
+  802b0a:	41 5d                	pop    %r13
+  802b0c:	41 5e                	pop    %r14
+  802b0e:	41 5f                	pop    %r15
+  802b10:	5d                   	pop    %rbp
+  802b11:	c3                   	ret
+    return 0;
+  802b12:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b17:	eb ea                	jmp    802b03 <foreach_shared_region+0x72>
+
+0000000000802b19 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802b19:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b1e:	c3                   	ret
+
+0000000000802b1f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802b1f:	55                   	push   %rbp
+  802b20:	48 89 e5             	mov    %rsp,%rbp
+  802b23:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802b26:	48 be d4 35 80 00 00 	movabs $0x8035d4,%rsi
+  802b2d:	00 00 00 
+  802b30:	48 b8 7b 0d 80 00 00 	movabs $0x800d7b,%rax
+  802b37:	00 00 00 
+  802b3a:	ff d0                	call   *%rax
+    return 0;
+}
+  802b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b41:	5d                   	pop    %rbp
+  802b42:	c3                   	ret
+
+0000000000802b43 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802b43:	55                   	push   %rbp
+  802b44:	48 89 e5             	mov    %rsp,%rbp
+  802b47:	41 57                	push   %r15
+  802b49:	41 56                	push   %r14
+  802b4b:	41 55                	push   %r13
+  802b4d:	41 54                	push   %r12
+  802b4f:	53                   	push   %rbx
+  802b50:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802b57:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802b5e:	48 85 d2             	test   %rdx,%rdx
+  802b61:	74 7a                	je     802bdd <devcons_write+0x9a>
+  802b63:	49 89 d6             	mov    %rdx,%r14
+  802b66:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802b6c:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802b71:	49 bf 75 0f 80 00 00 	movabs $0x800f75,%r15
+  802b78:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802b7b:	4c 89 f3             	mov    %r14,%rbx
+  802b7e:	48 29 f3             	sub    %rsi,%rbx
+  802b81:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802b86:	48 39 c3             	cmp    %rax,%rbx
+  802b89:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802b8d:	4c 63 eb             	movslq %ebx,%r13
+  802b90:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802b97:	48 01 c6             	add    %rax,%rsi
+  802b9a:	4c 89 ea             	mov    %r13,%rdx
+  802b9d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802ba4:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802ba7:	4c 89 ee             	mov    %r13,%rsi
+  802baa:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802bb1:	48 b8 a2 11 80 00 00 	movabs $0x8011a2,%rax
+  802bb8:	00 00 00 
+  802bbb:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802bbd:	41 01 dc             	add    %ebx,%r12d
+  802bc0:	49 63 f4             	movslq %r12d,%rsi
+  802bc3:	4c 39 f6             	cmp    %r14,%rsi
+  802bc6:	72 b3                	jb     802b7b <devcons_write+0x38>
+    return res;
+  802bc8:	49 63 c4             	movslq %r12d,%rax
+}
+  802bcb:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802bd2:	5b                   	pop    %rbx
+  802bd3:	41 5c                	pop    %r12
+  802bd5:	41 5d                	pop    %r13
+  802bd7:	41 5e                	pop    %r14
+  802bd9:	41 5f                	pop    %r15
+  802bdb:	5d                   	pop    %rbp
+  802bdc:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802bdd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802be3:	eb e3                	jmp    802bc8 <devcons_write+0x85>
+
+0000000000802be5 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802be5:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802be8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bed:	48 85 c0             	test   %rax,%rax
+  802bf0:	74 55                	je     802c47 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802bf2:	55                   	push   %rbp
+  802bf3:	48 89 e5             	mov    %rsp,%rbp
+  802bf6:	41 55                	push   %r13
+  802bf8:	41 54                	push   %r12
+  802bfa:	53                   	push   %rbx
+  802bfb:	48 83 ec 08          	sub    $0x8,%rsp
+  802bff:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802c02:	48 bb cf 11 80 00 00 	movabs $0x8011cf,%rbx
+  802c09:	00 00 00 
+  802c0c:	49 bc 9c 12 80 00 00 	movabs $0x80129c,%r12
+  802c13:	00 00 00 
+  802c16:	eb 03                	jmp    802c1b <devcons_read+0x36>
+  802c18:	41 ff d4             	call   *%r12
+  802c1b:	ff d3                	call   *%rbx
+  802c1d:	85 c0                	test   %eax,%eax
+  802c1f:	74 f7                	je     802c18 <devcons_read+0x33>
+    if (c < 0) return c;
+  802c21:	48 63 d0             	movslq %eax,%rdx
+  802c24:	78 13                	js     802c39 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802c26:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c2b:	83 f8 04             	cmp    $0x4,%eax
+  802c2e:	74 09                	je     802c39 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802c30:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802c34:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802c39:	48 89 d0             	mov    %rdx,%rax
+  802c3c:	48 83 c4 08          	add    $0x8,%rsp
+  802c40:	5b                   	pop    %rbx
+  802c41:	41 5c                	pop    %r12
+  802c43:	41 5d                	pop    %r13
+  802c45:	5d                   	pop    %rbp
+  802c46:	c3                   	ret
+  802c47:	48 89 d0             	mov    %rdx,%rax
+  802c4a:	c3                   	ret
+
+0000000000802c4b <cputchar>:
+cputchar(int ch) {
+  802c4b:	55                   	push   %rbp
+  802c4c:	48 89 e5             	mov    %rsp,%rbp
+  802c4f:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802c53:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802c57:	be 01 00 00 00       	mov    $0x1,%esi
+  802c5c:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802c60:	48 b8 a2 11 80 00 00 	movabs $0x8011a2,%rax
+  802c67:	00 00 00 
+  802c6a:	ff d0                	call   *%rax
+}
+  802c6c:	c9                   	leave
+  802c6d:	c3                   	ret
+
+0000000000802c6e <getchar>:
+getchar(void) {
+  802c6e:	55                   	push   %rbp
+  802c6f:	48 89 e5             	mov    %rsp,%rbp
+  802c72:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802c76:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c7b:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802c7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c84:	48 b8 3e 1c 80 00 00 	movabs $0x801c3e,%rax
+  802c8b:	00 00 00 
+  802c8e:	ff d0                	call   *%rax
+  802c90:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802c92:	85 c0                	test   %eax,%eax
+  802c94:	78 06                	js     802c9c <getchar+0x2e>
+  802c96:	74 08                	je     802ca0 <getchar+0x32>
+  802c98:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802c9c:	89 d0                	mov    %edx,%eax
+  802c9e:	c9                   	leave
+  802c9f:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802ca0:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802ca5:	eb f5                	jmp    802c9c <getchar+0x2e>
+
+0000000000802ca7 <iscons>:
+iscons(int fdnum) {
+  802ca7:	55                   	push   %rbp
+  802ca8:	48 89 e5             	mov    %rsp,%rbp
+  802cab:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802caf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802cb3:	48 b8 5b 19 80 00 00 	movabs $0x80195b,%rax
+  802cba:	00 00 00 
+  802cbd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cbf:	85 c0                	test   %eax,%eax
+  802cc1:	78 18                	js     802cdb <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802cc3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802cc7:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802cce:	00 00 00 
+  802cd1:	8b 00                	mov    (%rax),%eax
+  802cd3:	39 02                	cmp    %eax,(%rdx)
+  802cd5:	0f 94 c0             	sete   %al
+  802cd8:	0f b6 c0             	movzbl %al,%eax
+}
+  802cdb:	c9                   	leave
+  802cdc:	c3                   	ret
+
+0000000000802cdd <opencons>:
+opencons(void) {
+  802cdd:	55                   	push   %rbp
+  802cde:	48 89 e5             	mov    %rsp,%rbp
+  802ce1:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ce5:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802ce9:	48 b8 fb 18 80 00 00 	movabs $0x8018fb,%rax
+  802cf0:	00 00 00 
+  802cf3:	ff d0                	call   *%rax
+  802cf5:	85 c0                	test   %eax,%eax
+  802cf7:	78 49                	js     802d42 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802cf9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802cfe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d03:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802d07:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d0c:	48 b8 2b 13 80 00 00 	movabs $0x80132b,%rax
+  802d13:	00 00 00 
+  802d16:	ff d0                	call   *%rax
+  802d18:	85 c0                	test   %eax,%eax
+  802d1a:	78 26                	js     802d42 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802d1c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d20:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802d27:	00 00 
+  802d29:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802d2b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d2f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802d36:	48 b8 cd 18 80 00 00 	movabs $0x8018cd,%rax
+  802d3d:	00 00 00 
+  802d40:	ff d0                	call   *%rax
+}
+  802d42:	c9                   	leave
+  802d43:	c3                   	ret
+
+0000000000802d44 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802d44:	55                   	push   %rbp
+  802d45:	48 89 e5             	mov    %rsp,%rbp
+  802d48:	41 54                	push   %r12
+  802d4a:	53                   	push   %rbx
+  802d4b:	48 89 fb             	mov    %rdi,%rbx
+  802d4e:	48 89 f7             	mov    %rsi,%rdi
+  802d51:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802d54:	48 85 f6             	test   %rsi,%rsi
+  802d57:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802d5e:	00 00 00 
+  802d61:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802d65:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d6a:	48 b8 95 16 80 00 00 	movabs $0x801695,%rax
+  802d71:	00 00 00 
+  802d74:	ff d0                	call   *%rax
+    if (res < 0) {
+  802d76:	85 c0                	test   %eax,%eax
+  802d78:	78 45                	js     802dbf <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802d7a:	48 85 db             	test   %rbx,%rbx
+  802d7d:	74 12                	je     802d91 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802d7f:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802d86:	00 00 00 
+  802d89:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802d8f:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802d91:	4d 85 e4             	test   %r12,%r12
+  802d94:	74 14                	je     802daa <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802d96:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802d9d:	00 00 00 
+  802da0:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802da6:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802daa:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802db1:	00 00 00 
+  802db4:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802dba:	5b                   	pop    %rbx
+  802dbb:	41 5c                	pop    %r12
+  802dbd:	5d                   	pop    %rbp
+  802dbe:	c3                   	ret
+        if (from_env_store)
+  802dbf:	48 85 db             	test   %rbx,%rbx
+  802dc2:	74 06                	je     802dca <ipc_recv+0x86>
+            *from_env_store = 0;
+  802dc4:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802dca:	4d 85 e4             	test   %r12,%r12
+  802dcd:	74 eb                	je     802dba <ipc_recv+0x76>
+            *perm_store = 0;
+  802dcf:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802dd6:	00 
+  802dd7:	eb e1                	jmp    802dba <ipc_recv+0x76>
+
+0000000000802dd9 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802dd9:	55                   	push   %rbp
+  802dda:	48 89 e5             	mov    %rsp,%rbp
+  802ddd:	41 57                	push   %r15
+  802ddf:	41 56                	push   %r14
+  802de1:	41 55                	push   %r13
+  802de3:	41 54                	push   %r12
+  802de5:	53                   	push   %rbx
+  802de6:	48 83 ec 18          	sub    $0x18,%rsp
+  802dea:	41 89 fd             	mov    %edi,%r13d
+  802ded:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802df0:	48 89 d3             	mov    %rdx,%rbx
+  802df3:	49 89 cc             	mov    %rcx,%r12
+  802df6:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802dfa:	48 85 d2             	test   %rdx,%rdx
+  802dfd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802e04:	00 00 00 
+  802e07:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802e0b:	49 be 69 16 80 00 00 	movabs $0x801669,%r14
+  802e12:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802e15:	49 bf 9c 12 80 00 00 	movabs $0x80129c,%r15
+  802e1c:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802e1f:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802e22:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802e26:	4c 89 e1             	mov    %r12,%rcx
+  802e29:	48 89 da             	mov    %rbx,%rdx
+  802e2c:	44 89 ef             	mov    %r13d,%edi
+  802e2f:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802e32:	85 c0                	test   %eax,%eax
+  802e34:	74 34                	je     802e6a <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802e36:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802e39:	75 05                	jne    802e40 <ipc_send+0x67>
+        sys_yield();
+  802e3b:	41 ff d7             	call   *%r15
+    while (true) {
+  802e3e:	eb df                	jmp    802e1f <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802e40:	48 ba e0 35 80 00 00 	movabs $0x8035e0,%rdx
+  802e47:	00 00 00 
+  802e4a:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802e4f:	48 bf f9 35 80 00 00 	movabs $0x8035f9,%rdi
+  802e56:	00 00 00 
+  802e59:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e5e:	48 b9 06 03 80 00 00 	movabs $0x800306,%rcx
+  802e65:	00 00 00 
+  802e68:	ff d1                	call   *%rcx
+    }
+}
+  802e6a:	48 83 c4 18          	add    $0x18,%rsp
+  802e6e:	5b                   	pop    %rbx
+  802e6f:	41 5c                	pop    %r12
+  802e71:	41 5d                	pop    %r13
+  802e73:	41 5e                	pop    %r14
+  802e75:	41 5f                	pop    %r15
+  802e77:	5d                   	pop    %rbp
+  802e78:	c3                   	ret
+
+0000000000802e79 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802e79:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802e7e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802e85:	00 00 00 
+  802e88:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802e8f:	48 01 ca             	add    %rcx,%rdx
+  802e92:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802e98:	39 fa                	cmp    %edi,%edx
+  802e9a:	74 12                	je     802eae <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802e9c:	48 83 c0 01          	add    $0x1,%rax
+  802ea0:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802ea6:	75 e0                	jne    802e88 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ead:	c3                   	ret
+            return envs[i].env_id;
+  802eae:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802eb5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802ebc:	00 00 00 
+  802ebf:	48 01 d0             	add    %rdx,%rax
+  802ec2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802ec8:	c3                   	ret
+  802ec9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000802ed0 <__rodata_start>:
+  802ed0:	25 35 64 20 00       	and    $0x206435,%eax
+  802ed5:	77 72                	ja     802f49 <__rodata_start+0x79>
+  802ed7:	69 74 65 20 65 72 72 	imul   $0x6f727265,0x20(%rbp,%riz,2),%esi
+  802ede:	6f 
+  802edf:	72 20                	jb     802f01 <__rodata_start+0x31>
+  802ee1:	63 6f 70             	movsxd 0x70(%rdi),%ebp
+  802ee4:	79 69                	jns    802f4f <__rodata_start+0x7f>
+  802ee6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ee7:	67 20 25 73 3a 20 25 	and    %ah,0x25203a73(%eip)        # 25a06961 <__bss_end+0x251fe961>
+  802eee:	69 00 75 73 65 72    	imul   $0x72657375,(%rax),%eax
+  802ef4:	2f                   	(bad)
+  802ef5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ef6:	75 6d                	jne    802f65 <__rodata_start+0x95>
+  802ef8:	2e 63 00             	cs movsxd (%rax),%eax
+  802efb:	65 72 72             	gs jb  802f70 <__rodata_start+0xa0>
+  802efe:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eff:	72 20                	jb     802f21 <__rodata_start+0x51>
+  802f01:	72 65                	jb     802f68 <__rodata_start+0x98>
+  802f03:	61                   	(bad)
+  802f04:	64 69 6e 67 20 25 73 	imul   $0x3a732520,%fs:0x67(%rsi),%ebp
+  802f0b:	3a 
+  802f0c:	20 25 69 00 6e 75    	and    %ah,0x756e0069(%rip)        # 75ee2f7b <__bss_end+0x756daf7b>
+  802f12:	6d                   	insl   (%dx),%es:(%rdi)
+  802f13:	00 3c 73             	add    %bh,(%rbx,%rsi,2)
+  802f16:	74 64                	je     802f7c <__rodata_start+0xac>
+  802f18:	69 6e 3e 00 63 61 6e 	imul   $0x6e616300,0x3e(%rsi),%ebp
+  802f1f:	27                   	(bad)
+  802f20:	74 20                	je     802f42 <__rodata_start+0x72>
+  802f22:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f23:	70 65                	jo     802f8a <__rodata_start+0xba>
+  802f25:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f26:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a0699f <__bss_end+0x251fe99f>
+  802f2c:	69 00 3c 75 6e 6b    	imul   $0x6b6e753c,(%rax),%eax
+  802f32:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f33:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f34:	77 6e                	ja     802fa4 <__rodata_start+0xd4>
+  802f36:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  802f3a:	30 38                	xor    %bh,(%rax)
+  802f3c:	78 5d                	js     802f9b <__rodata_start+0xcb>
+  802f3e:	20 75 73             	and    %dh,0x73(%rbp)
+  802f41:	65 72 20             	gs jb  802f64 <__rodata_start+0x94>
+  802f44:	70 61                	jo     802fa7 <__rodata_start+0xd7>
+  802f46:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f47:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  802f4e:	73 20                	jae    802f70 <__rodata_start+0xa0>
+  802f50:	61                   	(bad)
+  802f51:	74 20                	je     802f73 <__rodata_start+0xa3>
+  802f53:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  802f58:	3a 20                	cmp    (%rax),%ah
+  802f5a:	00 30                	add    %dh,(%rax)
+  802f5c:	31 32                	xor    %esi,(%rdx)
+  802f5e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802f65:	41                   	rex.B
+  802f66:	42                   	rex.X
+  802f67:	43                   	rex.XB
+  802f68:	44                   	rex.R
+  802f69:	45                   	rex.RB
+  802f6a:	46 00 30             	rex.RX add %r14b,(%rax)
+  802f6d:	31 32                	xor    %esi,(%rdx)
+  802f6f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802f76:	61                   	(bad)
+  802f77:	62 63 64 65 66       	(bad)
+  802f7c:	00 28                	add    %ch,(%rax)
+  802f7e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f7f:	75 6c                	jne    802fed <__rodata_start+0x11d>
+  802f81:	6c                   	insb   (%dx),%es:(%rdi)
+  802f82:	29 00                	sub    %eax,(%rax)
+  802f84:	65 72 72             	gs jb  802ff9 <__rodata_start+0x129>
+  802f87:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f88:	72 20                	jb     802faa <__rodata_start+0xda>
+  802f8a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802f8f:	73 70                	jae    803001 <__rodata_start+0x131>
+  802f91:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802f95:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802f9c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f9d:	72 00                	jb     802f9f <__rodata_start+0xcf>
+  802f9f:	62 61 64 20 65       	(bad)
+  802fa4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fa5:	76 69                	jbe    803010 <__rodata_start+0x140>
+  802fa7:	72 6f                	jb     803018 <__rodata_start+0x148>
+  802fa9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802faa:	6d                   	insl   (%dx),%es:(%rdi)
+  802fab:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802fad:	74 00                	je     802faf <__rodata_start+0xdf>
+  802faf:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802fb6:	20 70 61             	and    %dh,0x61(%rax)
+  802fb9:	72 61                	jb     80301c <__rodata_start+0x14c>
+  802fbb:	6d                   	insl   (%dx),%es:(%rdi)
+  802fbc:	65 74 65             	gs je  803024 <__rodata_start+0x154>
+  802fbf:	72 00                	jb     802fc1 <__rodata_start+0xf1>
+  802fc1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fc2:	75 74                	jne    803038 <__rodata_start+0x168>
+  802fc4:	20 6f 66             	and    %ch,0x66(%rdi)
+  802fc7:	20 6d 65             	and    %ch,0x65(%rbp)
+  802fca:	6d                   	insl   (%dx),%es:(%rdi)
+  802fcb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fcc:	72 79                	jb     803047 <__rodata_start+0x177>
+  802fce:	00 6f 75             	add    %ch,0x75(%rdi)
+  802fd1:	74 20                	je     802ff3 <__rodata_start+0x123>
+  802fd3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fd4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802fd8:	76 69                	jbe    803043 <__rodata_start+0x173>
+  802fda:	72 6f                	jb     80304b <__rodata_start+0x17b>
+  802fdc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fdd:	6d                   	insl   (%dx),%es:(%rdi)
+  802fde:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802fe0:	74 73                	je     803055 <__rodata_start+0x185>
+  802fe2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802fe5:	72 72                	jb     803059 <__rodata_start+0x189>
+  802fe7:	75 70                	jne    803059 <__rodata_start+0x189>
+  802fe9:	74 65                	je     803050 <__rodata_start+0x180>
+  802feb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802ff0:	75 67                	jne    803059 <__rodata_start+0x189>
+  802ff2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802ff5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802ff7:	00 73 65             	add    %dh,0x65(%rbx)
+  802ffa:	67 6d                	insl   (%dx),%es:(%edi)
+  802ffc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802ffe:	74 61                	je     803061 <__rodata_start+0x191>
+  803000:	74 69                	je     80306b <__rodata_start+0x19b>
+  803002:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803003:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803004:	20 66 61             	and    %ah,0x61(%rsi)
+  803007:	75 6c                	jne    803075 <__rodata_start+0x1a5>
+  803009:	74 00                	je     80300b <__rodata_start+0x13b>
+  80300b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803012:	20 45 4c             	and    %al,0x4c(%rbp)
+  803015:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803019:	61                   	(bad)
+  80301a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80301f:	20 73 75             	and    %dh,0x75(%rbx)
+  803022:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803025:	73 79                	jae    8030a0 <__rodata_start+0x1d0>
+  803027:	73 74                	jae    80309d <__rodata_start+0x1cd>
+  803029:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80302b:	20 63 61             	and    %ah,0x61(%rbx)
+  80302e:	6c                   	insb   (%dx),%es:(%rdi)
+  80302f:	6c                   	insb   (%dx),%es:(%rdi)
+  803030:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803033:	74 72                	je     8030a7 <__rodata_start+0x1d7>
+  803035:	79 20                	jns    803057 <__rodata_start+0x187>
+  803037:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803038:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803039:	74 20                	je     80305b <__rodata_start+0x18b>
+  80303b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80303d:	75 6e                	jne    8030ad <__rodata_start+0x1dd>
+  80303f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803043:	76 20                	jbe    803065 <__rodata_start+0x195>
+  803045:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80304c:	72 65                	jb     8030b3 <__rodata_start+0x1e3>
+  80304e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803051:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803052:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803056:	65 78 70             	gs js  8030c9 <__rodata_start+0x1f9>
+  803059:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80305e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803061:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803065:	20 66 69             	and    %ah,0x69(%rsi)
+  803068:	6c                   	insb   (%dx),%es:(%rdi)
+  803069:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80306d:	20 66 72             	and    %ah,0x72(%rsi)
+  803070:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803075:	61                   	(bad)
+  803076:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803079:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80307a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80307b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80307f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803082:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803083:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803084:	20 6d 61             	and    %ch,0x61(%rbp)
+  803087:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803088:	79 20                	jns    8030aa <__rodata_start+0x1da>
+  80308a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803091:	72 65                	jb     8030f8 <__rodata_start+0x228>
+  803093:	20 6f 70             	and    %ch,0x70(%rdi)
+  803096:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803098:	00 66 69             	add    %ah,0x69(%rsi)
+  80309b:	6c                   	insb   (%dx),%es:(%rdi)
+  80309c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8030a0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8030a3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030a4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8030a7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030a8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030a9:	74 20                	je     8030cb <__rodata_start+0x1fb>
+  8030ab:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8030ad:	75 6e                	jne    80311d <__rodata_start+0x24d>
+  8030af:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8030b3:	76 61                	jbe    803116 <__rodata_start+0x246>
+  8030b5:	6c                   	insb   (%dx),%es:(%rdi)
+  8030b6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8030bd:	00 
+  8030be:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8030c5:	72 65                	jb     80312c <__rodata_start+0x25c>
+  8030c7:	61                   	(bad)
+  8030c8:	64 79 20             	fs jns 8030eb <__rodata_start+0x21b>
+  8030cb:	65 78 69             	gs js  803137 <__rodata_start+0x267>
+  8030ce:	73 74                	jae    803144 <__rodata_start+0x274>
+  8030d0:	73 00                	jae    8030d2 <__rodata_start+0x202>
+  8030d2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030d3:	70 65                	jo     80313a <__rodata_start+0x26a>
+  8030d5:	72 61                	jb     803138 <__rodata_start+0x268>
+  8030d7:	74 69                	je     803142 <__rodata_start+0x272>
+  8030d9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030da:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030db:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8030de:	74 20                	je     803100 <__rodata_start+0x230>
+  8030e0:	73 75                	jae    803157 <__rodata_start+0x287>
+  8030e2:	70 70                	jo     803154 <__rodata_start+0x284>
+  8030e4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030e5:	72 74                	jb     80315b <__rodata_start+0x28b>
+  8030e7:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8030ec:	65 72 61             	gs jb  803150 <__rodata_start+0x280>
+  8030ef:	74 69                	je     80315a <__rodata_start+0x28a>
+  8030f1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030f2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030f3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8030f6:	74 20                	je     803118 <__rodata_start+0x248>
+  8030f8:	70 65                	jo     80315f <__rodata_start+0x28f>
+  8030fa:	72 6d                	jb     803169 <__rodata_start+0x299>
+  8030fc:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  803103:	2e 
+  803104:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80310b:	00 
+  80310c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803113:	00 00 00 
+  803116:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80311d:	00 00 00 
+  803120:	43 06                	rex.XB (bad)
+  803122:	80 00 00             	addb   $0x0,(%rax)
+  803125:	00 00                	add    %al,(%rax)
+  803127:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  80312e:	00 00                	add    %al,(%rax)
+  803130:	74 0c                	je     80313e <__rodata_start+0x26e>
+  803132:	80 00 00             	addb   $0x0,(%rax)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  80313e:	00 00                	add    %al,(%rax)
+  803140:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  803143:	00 00                	add    %al,(%rax)
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  80314e:	00 00                	add    %al,(%rax)
+  803150:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  803153:	00 00                	add    %al,(%rax)
+  803155:	00 00                	add    %al,(%rax)
+  803157:	00 62 06             	add    %ah,0x6(%rdx)
+  80315a:	80 00 00             	addb   $0x0,(%rax)
+  80315d:	00 00                	add    %al,(%rax)
+  80315f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803166:	00 00                	add    %al,(%rax)
+  803168:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80316b:	00 00                	add    %al,(%rax)
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 56 06             	add    %dl,0x6(%rsi)
+  803172:	80 00 00             	addb   $0x0,(%rax)
+  803175:	00 00                	add    %al,(%rax)
+  803177:	00 d0                	add    %dl,%al
+  803179:	06                   	(bad)
+  80317a:	80 00 00             	addb   $0x0,(%rax)
+  80317d:	00 00                	add    %al,(%rax)
+  80317f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803186:	00 00                	add    %al,(%rax)
+  803188:	56                   	push   %rsi
+  803189:	06                   	(bad)
+  80318a:	80 00 00             	addb   $0x0,(%rax)
+  80318d:	00 00                	add    %al,(%rax)
+  80318f:	00 9c 06 80 00 00 00 	add    %bl,0x80(%rsi,%rax,1)
+  803196:	00 00                	add    %al,(%rax)
+  803198:	9c                   	pushf
+  803199:	06                   	(bad)
+  80319a:	80 00 00             	addb   $0x0,(%rax)
+  80319d:	00 00                	add    %al,(%rax)
+  80319f:	00 9c 06 80 00 00 00 	add    %bl,0x80(%rsi,%rax,1)
+  8031a6:	00 00                	add    %al,(%rax)
+  8031a8:	9c                   	pushf
+  8031a9:	06                   	(bad)
+  8031aa:	80 00 00             	addb   $0x0,(%rax)
+  8031ad:	00 00                	add    %al,(%rax)
+  8031af:	00 9c 06 80 00 00 00 	add    %bl,0x80(%rsi,%rax,1)
+  8031b6:	00 00                	add    %al,(%rax)
+  8031b8:	9c                   	pushf
+  8031b9:	06                   	(bad)
+  8031ba:	80 00 00             	addb   $0x0,(%rax)
+  8031bd:	00 00                	add    %al,(%rax)
+  8031bf:	00 9c 06 80 00 00 00 	add    %bl,0x80(%rsi,%rax,1)
+  8031c6:	00 00                	add    %al,(%rax)
+  8031c8:	9c                   	pushf
+  8031c9:	06                   	(bad)
+  8031ca:	80 00 00             	addb   $0x0,(%rax)
+  8031cd:	00 00                	add    %al,(%rax)
+  8031cf:	00 9c 06 80 00 00 00 	add    %bl,0x80(%rsi,%rax,1)
+  8031d6:	00 00                	add    %al,(%rax)
+  8031d8:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  8031db:	00 00                	add    %al,(%rax)
+  8031dd:	00 00                	add    %al,(%rax)
+  8031df:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  8031e6:	00 00                	add    %al,(%rax)
+  8031e8:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  8031eb:	00 00                	add    %al,(%rax)
+  8031ed:	00 00                	add    %al,(%rax)
+  8031ef:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  8031f6:	00 00                	add    %al,(%rax)
+  8031f8:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  8031fb:	00 00                	add    %al,(%rax)
+  8031fd:	00 00                	add    %al,(%rax)
+  8031ff:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803206:	00 00                	add    %al,(%rax)
+  803208:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80320b:	00 00                	add    %al,(%rax)
+  80320d:	00 00                	add    %al,(%rax)
+  80320f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803216:	00 00                	add    %al,(%rax)
+  803218:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80321b:	00 00                	add    %al,(%rax)
+  80321d:	00 00                	add    %al,(%rax)
+  80321f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803226:	00 00                	add    %al,(%rax)
+  803228:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80322b:	00 00                	add    %al,(%rax)
+  80322d:	00 00                	add    %al,(%rax)
+  80322f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803236:	00 00                	add    %al,(%rax)
+  803238:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80323b:	00 00                	add    %al,(%rax)
+  80323d:	00 00                	add    %al,(%rax)
+  80323f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803246:	00 00                	add    %al,(%rax)
+  803248:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80324b:	00 00                	add    %al,(%rax)
+  80324d:	00 00                	add    %al,(%rax)
+  80324f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803256:	00 00                	add    %al,(%rax)
+  803258:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80325b:	00 00                	add    %al,(%rax)
+  80325d:	00 00                	add    %al,(%rax)
+  80325f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803266:	00 00                	add    %al,(%rax)
+  803268:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80326b:	00 00                	add    %al,(%rax)
+  80326d:	00 00                	add    %al,(%rax)
+  80326f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803276:	00 00                	add    %al,(%rax)
+  803278:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80327b:	00 00                	add    %al,(%rax)
+  80327d:	00 00                	add    %al,(%rax)
+  80327f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803286:	00 00                	add    %al,(%rax)
+  803288:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80328b:	00 00                	add    %al,(%rax)
+  80328d:	00 00                	add    %al,(%rax)
+  80328f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803296:	00 00                	add    %al,(%rax)
+  803298:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80329b:	00 00                	add    %al,(%rax)
+  80329d:	00 00                	add    %al,(%rax)
+  80329f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  8032a6:	00 00                	add    %al,(%rax)
+  8032a8:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  8032ab:	00 00                	add    %al,(%rax)
+  8032ad:	00 00                	add    %al,(%rax)
+  8032af:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  8032b6:	00 00                	add    %al,(%rax)
+  8032b8:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  8032bb:	00 00                	add    %al,(%rax)
+  8032bd:	00 00                	add    %al,(%rax)
+  8032bf:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  8032c6:	00 00                	add    %al,(%rax)
+  8032c8:	a7                   	cmpsl  %es:(%rdi),%ds:(%rsi)
+  8032c9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032cf:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  8032d6:	00 00                	add    %al,(%rax)
+  8032d8:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  8032db:	00 00                	add    %al,(%rax)
+  8032dd:	00 00                	add    %al,(%rax)
+  8032df:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  8032e6:	00 00                	add    %al,(%rax)
+  8032e8:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  8032eb:	00 00                	add    %al,(%rax)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  8032f6:	00 00                	add    %al,(%rax)
+  8032f8:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  8032fb:	00 00                	add    %al,(%rax)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803306:	00 00                	add    %al,(%rax)
+  803308:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80330b:	00 00                	add    %al,(%rax)
+  80330d:	00 00                	add    %al,(%rax)
+  80330f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803316:	00 00                	add    %al,(%rax)
+  803318:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80331b:	00 00                	add    %al,(%rax)
+  80331d:	00 00                	add    %al,(%rax)
+  80331f:	00 f3                	add    %dh,%bl
+  803321:	06                   	(bad)
+  803322:	80 00 00             	addb   $0x0,(%rax)
+  803325:	00 00                	add    %al,(%rax)
+  803327:	00 c2                	add    %al,%dl
+  803329:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80332f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803336:	00 00                	add    %al,(%rax)
+  803338:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80333b:	00 00                	add    %al,(%rax)
+  80333d:	00 00                	add    %al,(%rax)
+  80333f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803346:	00 00                	add    %al,(%rax)
+  803348:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80334b:	00 00                	add    %al,(%rax)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 22                	add    %ah,(%rdx)
+  803351:	07                   	(bad)
+  803352:	80 00 00             	addb   $0x0,(%rax)
+  803355:	00 00                	add    %al,(%rax)
+  803357:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  80335e:	00 00                	add    %al,(%rax)
+  803360:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  803363:	00 00                	add    %al,(%rax)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 e8                	add    %ch,%al
+  803369:	06                   	(bad)
+  80336a:	80 00 00             	addb   $0x0,(%rax)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803376:	00 00                	add    %al,(%rax)
+  803378:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80337b:	00 00                	add    %al,(%rax)
+  80337d:	00 00                	add    %al,(%rax)
+  80337f:	00 6a 0a             	add    %ch,0xa(%rdx)
+  803382:	80 00 00             	addb   $0x0,(%rax)
+  803385:	00 00                	add    %al,(%rax)
+  803387:	00 34 0b             	add    %dh,(%rbx,%rcx,1)
+  80338a:	80 00 00             	addb   $0x0,(%rax)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  803396:	00 00                	add    %al,(%rax)
+  803398:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  80339b:	00 00                	add    %al,(%rax)
+  80339d:	00 00                	add    %al,(%rax)
+  80339f:	00 b9 07 80 00 00    	add    %bh,0x8007(%rcx)
+  8033a5:	00 00                	add    %al,(%rax)
+  8033a7:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  8033ae:	00 00                	add    %al,(%rax)
+  8033b0:	96                   	xchg   %eax,%esi
+  8033b1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8033b7:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  8033be:	00 00                	add    %al,(%rax)
+  8033c0:	84 0c 80             	test   %cl,(%rax,%rax,4)
+  8033c3:	00 00                	add    %al,(%rax)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 84 0c 80 00 00 00 	add    %al,0x80(%rsp,%rcx,1)
+  8033d6:	00 00                	add    %al,(%rax)
+  8033d8:	4c 06                	rex.WR (bad)
+  8033da:	80 00 00             	addb   $0x0,(%rax)
+  8033dd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008033e0 <error_string>:
+	...
+  8033e8:	8d 2f 80 00 00 00 00 00 9f 2f 80 00 00 00 00 00     ./......./......
+  8033f8:	af 2f 80 00 00 00 00 00 c1 2f 80 00 00 00 00 00     ./......./......
+  803408:	cf 2f 80 00 00 00 00 00 e3 2f 80 00 00 00 00 00     ./......./......
+  803418:	f8 2f 80 00 00 00 00 00 0b 30 80 00 00 00 00 00     ./.......0......
+  803428:	1d 30 80 00 00 00 00 00 31 30 80 00 00 00 00 00     .0......10......
+  803438:	41 30 80 00 00 00 00 00 54 30 80 00 00 00 00 00     A0......T0......
+  803448:	6b 30 80 00 00 00 00 00 81 30 80 00 00 00 00 00     k0.......0......
+  803458:	99 30 80 00 00 00 00 00 b1 30 80 00 00 00 00 00     .0.......0......
+  803468:	be 30 80 00 00 00 00 00 90 34 80 00 00 00 00 00     .0.......4......
+  803478:	d2 30 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .0..............
+  803488:	ea 30 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .0......file is 
+  803498:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8034a8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8034b8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8034c8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8034d8:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  8034e8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8034f8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803508:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803518:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803528:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803538:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803548:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803558:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803560 <devtab>:
+  803560:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803570:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803580:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803590:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8035a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8035b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8035c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8035d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8035e0:	69 70 63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64     ipc_send: failed
+  8035f0:	20 74 6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63      to send.lib/ipc
+  803600:	2e 63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     .c.f.........f..
+  803610:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803620:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803630:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803640:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803650:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803660:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803670:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803680:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803690:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803700:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
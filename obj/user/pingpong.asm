@@ -0,0 +1,5838 @@
+
+obj/user/pingpong:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 13 01 00 00       	call   800136 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * Only need to start one of these -- splits into two with fork. */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    envid_t who;
+
+    if ((who = fork()) != 0) {
+  800036:	48 b8 24 17 80 00 00 	movabs $0x801724,%rax
+  80003d:	00 00 00 
+  800040:	ff d0                	call   *%rax
+  800042:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800045:	85 c0                	test   %eax,%eax
+  800047:	0f 85 93 00 00 00    	jne    8000e0 <umain+0xbb>
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+        ipc_send(who, 0, 0, 0, 0);
+    }
+
+    while (1) {
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+  80004d:	49 bf 24 18 80 00 00 	movabs $0x801824,%r15
+  800054:	00 00 00 
+        cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  800057:	49 be c2 10 80 00 00 	movabs $0x8010c2,%r14
+  80005e:	00 00 00 
+  800061:	49 bd ad 02 80 00 00 	movabs $0x8002ad,%r13
+  800068:	00 00 00 
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+  80006b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800070:	ba 00 00 00 00       	mov    $0x0,%edx
+  800075:	be 00 00 00 00       	mov    $0x0,%esi
+  80007a:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  80007e:	41 ff d7             	call   *%r15
+  800081:	89 c3                	mov    %eax,%ebx
+        cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  800083:	44 8b 65 cc          	mov    -0x34(%rbp),%r12d
+  800087:	41 ff d6             	call   *%r14
+  80008a:	89 c6                	mov    %eax,%esi
+  80008c:	44 89 e1             	mov    %r12d,%ecx
+  80008f:	89 da                	mov    %ebx,%edx
+  800091:	48 bf 36 2d 80 00 00 	movabs $0x802d36,%rdi
+  800098:	00 00 00 
+  80009b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a0:	41 ff d5             	call   *%r13
+        if (i == 10) return;
+  8000a3:	83 fb 0a             	cmp    $0xa,%ebx
+  8000a6:	74 29                	je     8000d1 <umain+0xac>
+        i++;
+  8000a8:	83 c3 01             	add    $0x1,%ebx
+        ipc_send(who, i, 0, 0, 0);
+  8000ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000bb:	89 de                	mov    %ebx,%esi
+  8000bd:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8000c0:	48 b8 b9 18 80 00 00 	movabs $0x8018b9,%rax
+  8000c7:	00 00 00 
+  8000ca:	ff d0                	call   *%rax
+        if (i == 10) return;
+  8000cc:	83 fb 0a             	cmp    $0xa,%ebx
+  8000cf:	75 9a                	jne    80006b <umain+0x46>
+    }
+}
+  8000d1:	48 83 c4 18          	add    $0x18,%rsp
+  8000d5:	5b                   	pop    %rbx
+  8000d6:	41 5c                	pop    %r12
+  8000d8:	41 5d                	pop    %r13
+  8000da:	41 5e                	pop    %r14
+  8000dc:	41 5f                	pop    %r15
+  8000de:	5d                   	pop    %rbp
+  8000df:	c3                   	ret
+  8000e0:	89 c3                	mov    %eax,%ebx
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  8000e2:	48 b8 c2 10 80 00 00 	movabs $0x8010c2,%rax
+  8000e9:	00 00 00 
+  8000ec:	ff d0                	call   *%rax
+  8000ee:	89 c6                	mov    %eax,%esi
+  8000f0:	89 da                	mov    %ebx,%edx
+  8000f2:	48 bf 20 2d 80 00 00 	movabs $0x802d20,%rdi
+  8000f9:	00 00 00 
+  8000fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800101:	48 b9 ad 02 80 00 00 	movabs $0x8002ad,%rcx
+  800108:	00 00 00 
+  80010b:	ff d1                	call   *%rcx
+        ipc_send(who, 0, 0, 0, 0);
+  80010d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800113:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800118:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011d:	be 00 00 00 00       	mov    $0x0,%esi
+  800122:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800125:	48 b8 b9 18 80 00 00 	movabs $0x8018b9,%rax
+  80012c:	00 00 00 
+  80012f:	ff d0                	call   *%rax
+  800131:	e9 17 ff ff ff       	jmp    80004d <umain+0x28>
+
+0000000000800136 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800136:	55                   	push   %rbp
+  800137:	48 89 e5             	mov    %rsp,%rbp
+  80013a:	41 56                	push   %r14
+  80013c:	41 55                	push   %r13
+  80013e:	41 54                	push   %r12
+  800140:	53                   	push   %rbx
+  800141:	41 89 fd             	mov    %edi,%r13d
+  800144:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800147:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80014e:	00 00 00 
+  800151:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800158:	00 00 00 
+  80015b:	48 39 c2             	cmp    %rax,%rdx
+  80015e:	73 17                	jae    800177 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800160:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800163:	49 89 c4             	mov    %rax,%r12
+  800166:	48 83 c3 08          	add    $0x8,%rbx
+  80016a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016f:	ff 53 f8             	call   *-0x8(%rbx)
+  800172:	4c 39 e3             	cmp    %r12,%rbx
+  800175:	72 ef                	jb     800166 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800177:	48 b8 c2 10 80 00 00 	movabs $0x8010c2,%rax
+  80017e:	00 00 00 
+  800181:	ff d0                	call   *%rax
+  800183:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800186:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80018d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800194:	00 00 00 
+  800197:	48 01 d0             	add    %rdx,%rax
+  80019a:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8001a1:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001a4:	45 85 ed             	test   %r13d,%r13d
+  8001a7:	7e 0d                	jle    8001b6 <libmain+0x80>
+  8001a9:	49 8b 06             	mov    (%r14),%rax
+  8001ac:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001b3:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001b6:	4c 89 f6             	mov    %r14,%rsi
+  8001b9:	44 89 ef             	mov    %r13d,%edi
+  8001bc:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001c3:	00 00 00 
+  8001c6:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001c8:	48 b8 dd 01 80 00 00 	movabs $0x8001dd,%rax
+  8001cf:	00 00 00 
+  8001d2:	ff d0                	call   *%rax
+#endif
+}
+  8001d4:	5b                   	pop    %rbx
+  8001d5:	41 5c                	pop    %r12
+  8001d7:	41 5d                	pop    %r13
+  8001d9:	41 5e                	pop    %r14
+  8001db:	5d                   	pop    %rbp
+  8001dc:	c3                   	ret
+
+00000000008001dd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001dd:	55                   	push   %rbp
+  8001de:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001e1:	48 b8 cf 1b 80 00 00 	movabs $0x801bcf,%rax
+  8001e8:	00 00 00 
+  8001eb:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001f2:	48 b8 57 10 80 00 00 	movabs $0x801057,%rax
+  8001f9:	00 00 00 
+  8001fc:	ff d0                	call   *%rax
+}
+  8001fe:	5d                   	pop    %rbp
+  8001ff:	c3                   	ret
+
+0000000000800200 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800200:	55                   	push   %rbp
+  800201:	48 89 e5             	mov    %rsp,%rbp
+  800204:	53                   	push   %rbx
+  800205:	48 83 ec 08          	sub    $0x8,%rsp
+  800209:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80020c:	8b 06                	mov    (%rsi),%eax
+  80020e:	8d 50 01             	lea    0x1(%rax),%edx
+  800211:	89 16                	mov    %edx,(%rsi)
+  800213:	48 98                	cltq
+  800215:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80021a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800220:	74 0a                	je     80022c <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800222:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800226:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80022a:	c9                   	leave
+  80022b:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80022c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800230:	be ff 00 00 00       	mov    $0xff,%esi
+  800235:	48 b8 f9 0f 80 00 00 	movabs $0x800ff9,%rax
+  80023c:	00 00 00 
+  80023f:	ff d0                	call   *%rax
+        state->offset = 0;
+  800241:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800247:	eb d9                	jmp    800222 <putch+0x22>
+
+0000000000800249 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800249:	55                   	push   %rbp
+  80024a:	48 89 e5             	mov    %rsp,%rbp
+  80024d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800254:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800257:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80025e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800263:	b8 00 00 00 00       	mov    $0x0,%eax
+  800268:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80026b:	48 89 f1             	mov    %rsi,%rcx
+  80026e:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800275:	48 bf 00 02 80 00 00 	movabs $0x800200,%rdi
+  80027c:	00 00 00 
+  80027f:	48 b8 fd 03 80 00 00 	movabs $0x8003fd,%rax
+  800286:	00 00 00 
+  800289:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80028b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800292:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800299:	48 b8 f9 0f 80 00 00 	movabs $0x800ff9,%rax
+  8002a0:	00 00 00 
+  8002a3:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002a5:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002ab:	c9                   	leave
+  8002ac:	c3                   	ret
+
+00000000008002ad <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002ad:	55                   	push   %rbp
+  8002ae:	48 89 e5             	mov    %rsp,%rbp
+  8002b1:	48 83 ec 50          	sub    $0x50,%rsp
+  8002b5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002b9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002bd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002c1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002c5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002c9:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002d0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002d8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002dc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002e0:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002e4:	48 b8 49 02 80 00 00 	movabs $0x800249,%rax
+  8002eb:	00 00 00 
+  8002ee:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002f0:	c9                   	leave
+  8002f1:	c3                   	ret
+
+00000000008002f2 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002f2:	55                   	push   %rbp
+  8002f3:	48 89 e5             	mov    %rsp,%rbp
+  8002f6:	41 57                	push   %r15
+  8002f8:	41 56                	push   %r14
+  8002fa:	41 55                	push   %r13
+  8002fc:	41 54                	push   %r12
+  8002fe:	53                   	push   %rbx
+  8002ff:	48 83 ec 18          	sub    $0x18,%rsp
+  800303:	49 89 fc             	mov    %rdi,%r12
+  800306:	49 89 f5             	mov    %rsi,%r13
+  800309:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80030d:	8b 45 10             	mov    0x10(%rbp),%eax
+  800310:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800313:	41 89 cf             	mov    %ecx,%r15d
+  800316:	4c 39 fa             	cmp    %r15,%rdx
+  800319:	73 5b                	jae    800376 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80031b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80031f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800323:	85 db                	test   %ebx,%ebx
+  800325:	7e 0e                	jle    800335 <print_num+0x43>
+            putch(padc, put_arg);
+  800327:	4c 89 ee             	mov    %r13,%rsi
+  80032a:	44 89 f7             	mov    %r14d,%edi
+  80032d:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800330:	83 eb 01             	sub    $0x1,%ebx
+  800333:	75 f2                	jne    800327 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800335:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800339:	48 b9 64 2d 80 00 00 	movabs $0x802d64,%rcx
+  800340:	00 00 00 
+  800343:	48 b8 53 2d 80 00 00 	movabs $0x802d53,%rax
+  80034a:	00 00 00 
+  80034d:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800351:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800355:	ba 00 00 00 00       	mov    $0x0,%edx
+  80035a:	49 f7 f7             	div    %r15
+  80035d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800361:	4c 89 ee             	mov    %r13,%rsi
+  800364:	41 ff d4             	call   *%r12
+}
+  800367:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80036b:	5b                   	pop    %rbx
+  80036c:	41 5c                	pop    %r12
+  80036e:	41 5d                	pop    %r13
+  800370:	41 5e                	pop    %r14
+  800372:	41 5f                	pop    %r15
+  800374:	5d                   	pop    %rbp
+  800375:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800376:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80037a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80037f:	49 f7 f7             	div    %r15
+  800382:	48 83 ec 08          	sub    $0x8,%rsp
+  800386:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80038a:	52                   	push   %rdx
+  80038b:	45 0f be c9          	movsbl %r9b,%r9d
+  80038f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800393:	48 89 c2             	mov    %rax,%rdx
+  800396:	48 b8 f2 02 80 00 00 	movabs $0x8002f2,%rax
+  80039d:	00 00 00 
+  8003a0:	ff d0                	call   *%rax
+  8003a2:	48 83 c4 10          	add    $0x10,%rsp
+  8003a6:	eb 8d                	jmp    800335 <print_num+0x43>
+
+00000000008003a8 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003a8:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003ac:	48 8b 06             	mov    (%rsi),%rax
+  8003af:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003b3:	73 0a                	jae    8003bf <sprintputch+0x17>
+        *state->start++ = ch;
+  8003b5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003b9:	48 89 16             	mov    %rdx,(%rsi)
+  8003bc:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003bf:	c3                   	ret
+
+00000000008003c0 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003c0:	55                   	push   %rbp
+  8003c1:	48 89 e5             	mov    %rsp,%rbp
+  8003c4:	48 83 ec 50          	sub    $0x50,%rsp
+  8003c8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003cc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003d0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003d4:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003db:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003e3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003e7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003eb:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003ef:	48 b8 fd 03 80 00 00 	movabs $0x8003fd,%rax
+  8003f6:	00 00 00 
+  8003f9:	ff d0                	call   *%rax
+}
+  8003fb:	c9                   	leave
+  8003fc:	c3                   	ret
+
+00000000008003fd <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003fd:	55                   	push   %rbp
+  8003fe:	48 89 e5             	mov    %rsp,%rbp
+  800401:	41 57                	push   %r15
+  800403:	41 56                	push   %r14
+  800405:	41 55                	push   %r13
+  800407:	41 54                	push   %r12
+  800409:	53                   	push   %rbx
+  80040a:	48 83 ec 38          	sub    $0x38,%rsp
+  80040e:	49 89 fe             	mov    %rdi,%r14
+  800411:	49 89 f5             	mov    %rsi,%r13
+  800414:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800417:	48 8b 01             	mov    (%rcx),%rax
+  80041a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80041e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800422:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800426:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80042a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80042e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800432:	0f b6 3b             	movzbl (%rbx),%edi
+  800435:	40 80 ff 25          	cmp    $0x25,%dil
+  800439:	74 18                	je     800453 <vprintfmt+0x56>
+            if (!ch) return;
+  80043b:	40 84 ff             	test   %dil,%dil
+  80043e:	0f 84 b1 06 00 00    	je     800af5 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800444:	40 0f b6 ff          	movzbl %dil,%edi
+  800448:	4c 89 ee             	mov    %r13,%rsi
+  80044b:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80044e:	4c 89 e3             	mov    %r12,%rbx
+  800451:	eb db                	jmp    80042e <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800453:	be 00 00 00 00       	mov    $0x0,%esi
+  800458:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80045c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800461:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800467:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80046e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800472:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800477:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80047c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80047f:	83 e8 23             	sub    $0x23,%eax
+  800482:	3c 57                	cmp    $0x57,%al
+  800484:	0f 87 51 06 00 00    	ja     800adb <vprintfmt+0x6de>
+  80048a:	0f b6 c0             	movzbl %al,%eax
+  80048d:	48 b9 00 2f 80 00 00 	movabs $0x802f00,%rcx
+  800494:	00 00 00 
+  800497:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80049a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80049d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004a1:	eb cf                	jmp    800472 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004a3:	49 89 dc             	mov    %rbx,%r12
+  8004a6:	be 01 00 00 00       	mov    $0x1,%esi
+  8004ab:	eb c5                	jmp    800472 <vprintfmt+0x75>
+            padc = ch;
+  8004ad:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004b1:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004b4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004b7:	eb b9                	jmp    800472 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8004bf:	77 24                	ja     8004e5 <vprintfmt+0xe8>
+  8004c1:	89 c1                	mov    %eax,%ecx
+  8004c3:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004c7:	83 c0 08             	add    $0x8,%eax
+  8004ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004cd:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004d0:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004d3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004d7:	79 99                	jns    800472 <vprintfmt+0x75>
+                width = precision;
+  8004d9:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004dd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004e3:	eb 8d                	jmp    800472 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004e5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004e9:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004f1:	eb da                	jmp    8004cd <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004f3:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004f8:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004fc:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800502:	3c 39                	cmp    $0x39,%al
+  800504:	77 1c                	ja     800522 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800506:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80050a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80050e:	0f b6 c0             	movzbl %al,%eax
+  800511:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800516:	0f b6 03             	movzbl (%rbx),%eax
+  800519:	3c 39                	cmp    $0x39,%al
+  80051b:	76 e9                	jbe    800506 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80051d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800520:	eb b1                	jmp    8004d3 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800522:	49 89 dc             	mov    %rbx,%r12
+  800525:	eb ac                	jmp    8004d3 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800527:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80052a:	85 c9                	test   %ecx,%ecx
+  80052c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800531:	0f 49 c1             	cmovns %ecx,%eax
+  800534:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800537:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80053a:	e9 33 ff ff ff       	jmp    800472 <vprintfmt+0x75>
+            lflag++;
+  80053f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800542:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800545:	e9 28 ff ff ff       	jmp    800472 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80054a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80054d:	83 f8 2f             	cmp    $0x2f,%eax
+  800550:	77 19                	ja     80056b <vprintfmt+0x16e>
+  800552:	89 c2                	mov    %eax,%edx
+  800554:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800558:	83 c0 08             	add    $0x8,%eax
+  80055b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80055e:	8b 3a                	mov    (%rdx),%edi
+  800560:	4c 89 ee             	mov    %r13,%rsi
+  800563:	41 ff d6             	call   *%r14
+            break;
+  800566:	e9 c3 fe ff ff       	jmp    80042e <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80056b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80056f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800573:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800577:	eb e5                	jmp    80055e <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800579:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80057c:	83 f8 2f             	cmp    $0x2f,%eax
+  80057f:	77 5a                	ja     8005db <vprintfmt+0x1de>
+  800581:	89 c2                	mov    %eax,%edx
+  800583:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800587:	83 c0 08             	add    $0x8,%eax
+  80058a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80058d:	8b 02                	mov    (%rdx),%eax
+  80058f:	89 c1                	mov    %eax,%ecx
+  800591:	f7 d9                	neg    %ecx
+  800593:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800596:	83 f9 15             	cmp    $0x15,%ecx
+  800599:	7f 4e                	jg     8005e9 <vprintfmt+0x1ec>
+  80059b:	48 63 c1             	movslq %ecx,%rax
+  80059e:	48 ba c0 31 80 00 00 	movabs $0x8031c0,%rdx
+  8005a5:	00 00 00 
+  8005a8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005ac:	48 85 c0             	test   %rax,%rax
+  8005af:	74 38                	je     8005e9 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005b1:	48 89 c1             	mov    %rax,%rcx
+  8005b4:	48 ba d9 33 80 00 00 	movabs $0x8033d9,%rdx
+  8005bb:	00 00 00 
+  8005be:	4c 89 ee             	mov    %r13,%rsi
+  8005c1:	4c 89 f7             	mov    %r14,%rdi
+  8005c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c9:	49 b8 c0 03 80 00 00 	movabs $0x8003c0,%r8
+  8005d0:	00 00 00 
+  8005d3:	41 ff d0             	call   *%r8
+  8005d6:	e9 53 fe ff ff       	jmp    80042e <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005db:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005df:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005e7:	eb a4                	jmp    80058d <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005e9:	48 ba 7c 2d 80 00 00 	movabs $0x802d7c,%rdx
+  8005f0:	00 00 00 
+  8005f3:	4c 89 ee             	mov    %r13,%rsi
+  8005f6:	4c 89 f7             	mov    %r14,%rdi
+  8005f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005fe:	49 b8 c0 03 80 00 00 	movabs $0x8003c0,%r8
+  800605:	00 00 00 
+  800608:	41 ff d0             	call   *%r8
+  80060b:	e9 1e fe ff ff       	jmp    80042e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800610:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800613:	83 f8 2f             	cmp    $0x2f,%eax
+  800616:	77 6c                	ja     800684 <vprintfmt+0x287>
+  800618:	89 c2                	mov    %eax,%edx
+  80061a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80061e:	83 c0 08             	add    $0x8,%eax
+  800621:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800624:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800627:	48 85 d2             	test   %rdx,%rdx
+  80062a:	48 b8 75 2d 80 00 00 	movabs $0x802d75,%rax
+  800631:	00 00 00 
+  800634:	48 0f 45 c2          	cmovne %rdx,%rax
+  800638:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80063c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800640:	7e 06                	jle    800648 <vprintfmt+0x24b>
+  800642:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800646:	75 4a                	jne    800692 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800648:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80064c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800650:	0f b6 00             	movzbl (%rax),%eax
+  800653:	84 c0                	test   %al,%al
+  800655:	0f 85 9a 00 00 00    	jne    8006f5 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80065b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80065e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800662:	85 c0                	test   %eax,%eax
+  800664:	0f 8e c4 fd ff ff    	jle    80042e <vprintfmt+0x31>
+  80066a:	4c 89 ee             	mov    %r13,%rsi
+  80066d:	bf 20 00 00 00       	mov    $0x20,%edi
+  800672:	41 ff d6             	call   *%r14
+  800675:	41 83 ec 01          	sub    $0x1,%r12d
+  800679:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80067d:	75 eb                	jne    80066a <vprintfmt+0x26d>
+  80067f:	e9 aa fd ff ff       	jmp    80042e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800684:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800688:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80068c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800690:	eb 92                	jmp    800624 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800692:	49 63 f7             	movslq %r15d,%rsi
+  800695:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800699:	48 b8 af 0b 80 00 00 	movabs $0x800baf,%rax
+  8006a0:	00 00 00 
+  8006a3:	ff d0                	call   *%rax
+  8006a5:	48 89 c2             	mov    %rax,%rdx
+  8006a8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006ab:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006ad:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006b0:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006b3:	85 c0                	test   %eax,%eax
+  8006b5:	7e 91                	jle    800648 <vprintfmt+0x24b>
+  8006b7:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006bc:	4c 89 ee             	mov    %r13,%rsi
+  8006bf:	44 89 e7             	mov    %r12d,%edi
+  8006c2:	41 ff d6             	call   *%r14
+  8006c5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006c9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006cc:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006cf:	75 eb                	jne    8006bc <vprintfmt+0x2bf>
+  8006d1:	e9 72 ff ff ff       	jmp    800648 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006d6:	0f b6 f8             	movzbl %al,%edi
+  8006d9:	4c 89 ee             	mov    %r13,%rsi
+  8006dc:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006df:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006e3:	49 83 c4 01          	add    $0x1,%r12
+  8006e7:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006ed:	84 c0                	test   %al,%al
+  8006ef:	0f 84 66 ff ff ff    	je     80065b <vprintfmt+0x25e>
+  8006f5:	45 85 ff             	test   %r15d,%r15d
+  8006f8:	78 0a                	js     800704 <vprintfmt+0x307>
+  8006fa:	41 83 ef 01          	sub    $0x1,%r15d
+  8006fe:	0f 88 57 ff ff ff    	js     80065b <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800704:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800708:	74 cc                	je     8006d6 <vprintfmt+0x2d9>
+  80070a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80070d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800712:	80 fa 5e             	cmp    $0x5e,%dl
+  800715:	77 c2                	ja     8006d9 <vprintfmt+0x2dc>
+  800717:	eb bd                	jmp    8006d6 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800719:	40 84 f6             	test   %sil,%sil
+  80071c:	75 26                	jne    800744 <vprintfmt+0x347>
+    switch (lflag) {
+  80071e:	85 d2                	test   %edx,%edx
+  800720:	74 59                	je     80077b <vprintfmt+0x37e>
+  800722:	83 fa 01             	cmp    $0x1,%edx
+  800725:	74 7b                	je     8007a2 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800727:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072a:	83 f8 2f             	cmp    $0x2f,%eax
+  80072d:	0f 87 96 00 00 00    	ja     8007c9 <vprintfmt+0x3cc>
+  800733:	89 c2                	mov    %eax,%edx
+  800735:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800739:	83 c0 08             	add    $0x8,%eax
+  80073c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80073f:	4c 8b 22             	mov    (%rdx),%r12
+  800742:	eb 17                	jmp    80075b <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800744:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800747:	83 f8 2f             	cmp    $0x2f,%eax
+  80074a:	77 21                	ja     80076d <vprintfmt+0x370>
+  80074c:	89 c2                	mov    %eax,%edx
+  80074e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800752:	83 c0 08             	add    $0x8,%eax
+  800755:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800758:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80075b:	4d 85 e4             	test   %r12,%r12
+  80075e:	78 7a                	js     8007da <vprintfmt+0x3dd>
+            num = i;
+  800760:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800763:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800768:	e9 50 02 00 00       	jmp    8009bd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80076d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800771:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800775:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800779:	eb dd                	jmp    800758 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80077b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80077e:	83 f8 2f             	cmp    $0x2f,%eax
+  800781:	77 11                	ja     800794 <vprintfmt+0x397>
+  800783:	89 c2                	mov    %eax,%edx
+  800785:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800789:	83 c0 08             	add    $0x8,%eax
+  80078c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80078f:	4c 63 22             	movslq (%rdx),%r12
+  800792:	eb c7                	jmp    80075b <vprintfmt+0x35e>
+  800794:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800798:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80079c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a0:	eb ed                	jmp    80078f <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8007a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a8:	77 11                	ja     8007bb <vprintfmt+0x3be>
+  8007aa:	89 c2                	mov    %eax,%edx
+  8007ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b0:	83 c0 08             	add    $0x8,%eax
+  8007b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b6:	4c 8b 22             	mov    (%rdx),%r12
+  8007b9:	eb a0                	jmp    80075b <vprintfmt+0x35e>
+  8007bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c7:	eb ed                	jmp    8007b6 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d5:	e9 65 ff ff ff       	jmp    80073f <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007da:	4c 89 ee             	mov    %r13,%rsi
+  8007dd:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007e2:	41 ff d6             	call   *%r14
+                i = -i;
+  8007e5:	49 f7 dc             	neg    %r12
+  8007e8:	e9 73 ff ff ff       	jmp    800760 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ed:	40 84 f6             	test   %sil,%sil
+  8007f0:	75 32                	jne    800824 <vprintfmt+0x427>
+    switch (lflag) {
+  8007f2:	85 d2                	test   %edx,%edx
+  8007f4:	74 5d                	je     800853 <vprintfmt+0x456>
+  8007f6:	83 fa 01             	cmp    $0x1,%edx
+  8007f9:	0f 84 82 00 00 00    	je     800881 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800802:	83 f8 2f             	cmp    $0x2f,%eax
+  800805:	0f 87 a5 00 00 00    	ja     8008b0 <vprintfmt+0x4b3>
+  80080b:	89 c2                	mov    %eax,%edx
+  80080d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800811:	83 c0 08             	add    $0x8,%eax
+  800814:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800817:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80081a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80081f:	e9 99 01 00 00       	jmp    8009bd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800824:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800827:	83 f8 2f             	cmp    $0x2f,%eax
+  80082a:	77 19                	ja     800845 <vprintfmt+0x448>
+  80082c:	89 c2                	mov    %eax,%edx
+  80082e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800832:	83 c0 08             	add    $0x8,%eax
+  800835:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800838:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80083b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800840:	e9 78 01 00 00       	jmp    8009bd <vprintfmt+0x5c0>
+  800845:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800849:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800851:	eb e5                	jmp    800838 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800853:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800856:	83 f8 2f             	cmp    $0x2f,%eax
+  800859:	77 18                	ja     800873 <vprintfmt+0x476>
+  80085b:	89 c2                	mov    %eax,%edx
+  80085d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800861:	83 c0 08             	add    $0x8,%eax
+  800864:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800867:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800869:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80086e:	e9 4a 01 00 00       	jmp    8009bd <vprintfmt+0x5c0>
+  800873:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800877:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087f:	eb e6                	jmp    800867 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800881:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800884:	83 f8 2f             	cmp    $0x2f,%eax
+  800887:	77 19                	ja     8008a2 <vprintfmt+0x4a5>
+  800889:	89 c2                	mov    %eax,%edx
+  80088b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088f:	83 c0 08             	add    $0x8,%eax
+  800892:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800895:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800898:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80089d:	e9 1b 01 00 00       	jmp    8009bd <vprintfmt+0x5c0>
+  8008a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ae:	eb e5                	jmp    800895 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008bc:	e9 56 ff ff ff       	jmp    800817 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c1:	40 84 f6             	test   %sil,%sil
+  8008c4:	75 2e                	jne    8008f4 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008c6:	85 d2                	test   %edx,%edx
+  8008c8:	74 59                	je     800923 <vprintfmt+0x526>
+  8008ca:	83 fa 01             	cmp    $0x1,%edx
+  8008cd:	74 7f                	je     80094e <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d5:	0f 87 9f 00 00 00    	ja     80097a <vprintfmt+0x57d>
+  8008db:	89 c2                	mov    %eax,%edx
+  8008dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e1:	83 c0 08             	add    $0x8,%eax
+  8008e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008ea:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008ef:	e9 c9 00 00 00       	jmp    8009bd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fa:	77 19                	ja     800915 <vprintfmt+0x518>
+  8008fc:	89 c2                	mov    %eax,%edx
+  8008fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800902:	83 c0 08             	add    $0x8,%eax
+  800905:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800908:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80090b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800910:	e9 a8 00 00 00       	jmp    8009bd <vprintfmt+0x5c0>
+  800915:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800919:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800921:	eb e5                	jmp    800908 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800923:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800926:	83 f8 2f             	cmp    $0x2f,%eax
+  800929:	77 15                	ja     800940 <vprintfmt+0x543>
+  80092b:	89 c2                	mov    %eax,%edx
+  80092d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800931:	83 c0 08             	add    $0x8,%eax
+  800934:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800937:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800939:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80093e:	eb 7d                	jmp    8009bd <vprintfmt+0x5c0>
+  800940:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800944:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800948:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094c:	eb e9                	jmp    800937 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80094e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800951:	83 f8 2f             	cmp    $0x2f,%eax
+  800954:	77 16                	ja     80096c <vprintfmt+0x56f>
+  800956:	89 c2                	mov    %eax,%edx
+  800958:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095c:	83 c0 08             	add    $0x8,%eax
+  80095f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800962:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800965:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80096a:	eb 51                	jmp    8009bd <vprintfmt+0x5c0>
+  80096c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800970:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800974:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800978:	eb e8                	jmp    800962 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80097a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800982:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800986:	e9 5c ff ff ff       	jmp    8008e7 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80098b:	4c 89 ee             	mov    %r13,%rsi
+  80098e:	bf 30 00 00 00       	mov    $0x30,%edi
+  800993:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800996:	4c 89 ee             	mov    %r13,%rsi
+  800999:	bf 78 00 00 00       	mov    $0x78,%edi
+  80099e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a7:	77 47                	ja     8009f0 <vprintfmt+0x5f3>
+  8009a9:	89 c2                	mov    %eax,%edx
+  8009ab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009af:	83 c0 08             	add    $0x8,%eax
+  8009b2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009b8:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8009c1:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009c5:	0f 94 c0             	sete   %al
+  8009c8:	0f b6 c0             	movzbl %al,%eax
+  8009cb:	50                   	push   %rax
+  8009cc:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009d1:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009d5:	4c 89 ee             	mov    %r13,%rsi
+  8009d8:	4c 89 f7             	mov    %r14,%rdi
+  8009db:	48 b8 f2 02 80 00 00 	movabs $0x8002f2,%rax
+  8009e2:	00 00 00 
+  8009e5:	ff d0                	call   *%rax
+            break;
+  8009e7:	48 83 c4 10          	add    $0x10,%rsp
+  8009eb:	e9 3e fa ff ff       	jmp    80042e <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fc:	eb b7                	jmp    8009b5 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009fe:	40 84 f6             	test   %sil,%sil
+  800a01:	75 2b                	jne    800a2e <vprintfmt+0x631>
+    switch (lflag) {
+  800a03:	85 d2                	test   %edx,%edx
+  800a05:	74 56                	je     800a5d <vprintfmt+0x660>
+  800a07:	83 fa 01             	cmp    $0x1,%edx
+  800a0a:	74 7f                	je     800a8b <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a12:	0f 87 a2 00 00 00    	ja     800aba <vprintfmt+0x6bd>
+  800a18:	89 c2                	mov    %eax,%edx
+  800a1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1e:	83 c0 08             	add    $0x8,%eax
+  800a21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a24:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a27:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a2c:	eb 8f                	jmp    8009bd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a31:	83 f8 2f             	cmp    $0x2f,%eax
+  800a34:	77 19                	ja     800a4f <vprintfmt+0x652>
+  800a36:	89 c2                	mov    %eax,%edx
+  800a38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3c:	83 c0 08             	add    $0x8,%eax
+  800a3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a42:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a45:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a4a:	e9 6e ff ff ff       	jmp    8009bd <vprintfmt+0x5c0>
+  800a4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5b:	eb e5                	jmp    800a42 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a60:	83 f8 2f             	cmp    $0x2f,%eax
+  800a63:	77 18                	ja     800a7d <vprintfmt+0x680>
+  800a65:	89 c2                	mov    %eax,%edx
+  800a67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6b:	83 c0 08             	add    $0x8,%eax
+  800a6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a71:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a73:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a78:	e9 40 ff ff ff       	jmp    8009bd <vprintfmt+0x5c0>
+  800a7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a89:	eb e6                	jmp    800a71 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a8b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a91:	77 19                	ja     800aac <vprintfmt+0x6af>
+  800a93:	89 c2                	mov    %eax,%edx
+  800a95:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a99:	83 c0 08             	add    $0x8,%eax
+  800a9c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aa2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800aa7:	e9 11 ff ff ff       	jmp    8009bd <vprintfmt+0x5c0>
+  800aac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab8:	eb e5                	jmp    800a9f <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800aba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800abe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac6:	e9 59 ff ff ff       	jmp    800a24 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800acb:	4c 89 ee             	mov    %r13,%rsi
+  800ace:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ad3:	41 ff d6             	call   *%r14
+            break;
+  800ad6:	e9 53 f9 ff ff       	jmp    80042e <vprintfmt+0x31>
+            putch('%', put_arg);
+  800adb:	4c 89 ee             	mov    %r13,%rsi
+  800ade:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ae3:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800ae6:	48 83 eb 01          	sub    $0x1,%rbx
+  800aea:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800aee:	75 f6                	jne    800ae6 <vprintfmt+0x6e9>
+  800af0:	e9 39 f9 ff ff       	jmp    80042e <vprintfmt+0x31>
+}
+  800af5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800af9:	5b                   	pop    %rbx
+  800afa:	41 5c                	pop    %r12
+  800afc:	41 5d                	pop    %r13
+  800afe:	41 5e                	pop    %r14
+  800b00:	41 5f                	pop    %r15
+  800b02:	5d                   	pop    %rbp
+  800b03:	c3                   	ret
+
+0000000000800b04 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b04:	55                   	push   %rbp
+  800b05:	48 89 e5             	mov    %rsp,%rbp
+  800b08:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b0c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b10:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b15:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b19:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b20:	48 85 ff             	test   %rdi,%rdi
+  800b23:	74 2b                	je     800b50 <vsnprintf+0x4c>
+  800b25:	48 85 f6             	test   %rsi,%rsi
+  800b28:	74 26                	je     800b50 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b2a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b2e:	48 bf a8 03 80 00 00 	movabs $0x8003a8,%rdi
+  800b35:	00 00 00 
+  800b38:	48 b8 fd 03 80 00 00 	movabs $0x8003fd,%rax
+  800b3f:	00 00 00 
+  800b42:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b48:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b4b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b4e:	c9                   	leave
+  800b4f:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b55:	eb f7                	jmp    800b4e <vsnprintf+0x4a>
+
+0000000000800b57 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b57:	55                   	push   %rbp
+  800b58:	48 89 e5             	mov    %rsp,%rbp
+  800b5b:	48 83 ec 50          	sub    $0x50,%rsp
+  800b5f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b63:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b67:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b6b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b72:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b7e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b82:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b86:	48 b8 04 0b 80 00 00 	movabs $0x800b04,%rax
+  800b8d:	00 00 00 
+  800b90:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b92:	c9                   	leave
+  800b93:	c3                   	ret
+
+0000000000800b94 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b94:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b97:	74 10                	je     800ba9 <strlen+0x15>
+    size_t n = 0;
+  800b99:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b9e:	48 83 c0 01          	add    $0x1,%rax
+  800ba2:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ba6:	75 f6                	jne    800b9e <strlen+0xa>
+  800ba8:	c3                   	ret
+    size_t n = 0;
+  800ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800bae:	c3                   	ret
+
+0000000000800baf <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800baf:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bb2:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bb7:	48 85 f6             	test   %rsi,%rsi
+  800bba:	74 11                	je     800bcd <strnlen+0x1e>
+  800bbc:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bc0:	74 0c                	je     800bce <strnlen+0x1f>
+  800bc2:	48 83 c2 01          	add    $0x1,%rdx
+  800bc6:	48 39 d0             	cmp    %rdx,%rax
+  800bc9:	75 f1                	jne    800bbc <strnlen+0xd>
+  800bcb:	eb 04                	jmp    800bd1 <strnlen+0x22>
+  800bcd:	c3                   	ret
+  800bce:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bd1:	c3                   	ret
+
+0000000000800bd2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bd2:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bda:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bde:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800be1:	48 83 c2 01          	add    $0x1,%rdx
+  800be5:	84 c9                	test   %cl,%cl
+  800be7:	75 f1                	jne    800bda <strcpy+0x8>
+        ;
+    return res;
+}
+  800be9:	c3                   	ret
+
+0000000000800bea <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800bea:	55                   	push   %rbp
+  800beb:	48 89 e5             	mov    %rsp,%rbp
+  800bee:	41 54                	push   %r12
+  800bf0:	53                   	push   %rbx
+  800bf1:	48 89 fb             	mov    %rdi,%rbx
+  800bf4:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bf7:	48 b8 94 0b 80 00 00 	movabs $0x800b94,%rax
+  800bfe:	00 00 00 
+  800c01:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c03:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c07:	4c 89 e6             	mov    %r12,%rsi
+  800c0a:	48 b8 d2 0b 80 00 00 	movabs $0x800bd2,%rax
+  800c11:	00 00 00 
+  800c14:	ff d0                	call   *%rax
+    return dst;
+}
+  800c16:	48 89 d8             	mov    %rbx,%rax
+  800c19:	5b                   	pop    %rbx
+  800c1a:	41 5c                	pop    %r12
+  800c1c:	5d                   	pop    %rbp
+  800c1d:	c3                   	ret
+
+0000000000800c1e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c1e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c21:	48 85 d2             	test   %rdx,%rdx
+  800c24:	74 1f                	je     800c45 <strncpy+0x27>
+  800c26:	48 01 fa             	add    %rdi,%rdx
+  800c29:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c2c:	48 83 c1 01          	add    $0x1,%rcx
+  800c30:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c34:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c38:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c3c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c40:	48 39 ca             	cmp    %rcx,%rdx
+  800c43:	75 e7                	jne    800c2c <strncpy+0xe>
+    }
+    return ret;
+}
+  800c45:	c3                   	ret
+
+0000000000800c46 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c46:	48 89 f8             	mov    %rdi,%rax
+  800c49:	48 85 d2             	test   %rdx,%rdx
+  800c4c:	74 24                	je     800c72 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c4e:	48 83 ea 01          	sub    $0x1,%rdx
+  800c52:	74 1b                	je     800c6f <strlcpy+0x29>
+  800c54:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c58:	0f b6 16             	movzbl (%rsi),%edx
+  800c5b:	84 d2                	test   %dl,%dl
+  800c5d:	74 10                	je     800c6f <strlcpy+0x29>
+            *dst++ = *src++;
+  800c5f:	48 83 c6 01          	add    $0x1,%rsi
+  800c63:	48 83 c0 01          	add    $0x1,%rax
+  800c67:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c6a:	48 39 c8             	cmp    %rcx,%rax
+  800c6d:	75 e9                	jne    800c58 <strlcpy+0x12>
+        *dst = '\0';
+  800c6f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c72:	48 29 f8             	sub    %rdi,%rax
+}
+  800c75:	c3                   	ret
+
+0000000000800c76 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c76:	0f b6 07             	movzbl (%rdi),%eax
+  800c79:	84 c0                	test   %al,%al
+  800c7b:	74 13                	je     800c90 <strcmp+0x1a>
+  800c7d:	38 06                	cmp    %al,(%rsi)
+  800c7f:	75 0f                	jne    800c90 <strcmp+0x1a>
+  800c81:	48 83 c7 01          	add    $0x1,%rdi
+  800c85:	48 83 c6 01          	add    $0x1,%rsi
+  800c89:	0f b6 07             	movzbl (%rdi),%eax
+  800c8c:	84 c0                	test   %al,%al
+  800c8e:	75 ed                	jne    800c7d <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c90:	0f b6 c0             	movzbl %al,%eax
+  800c93:	0f b6 16             	movzbl (%rsi),%edx
+  800c96:	29 d0                	sub    %edx,%eax
+}
+  800c98:	c3                   	ret
+
+0000000000800c99 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c99:	48 85 d2             	test   %rdx,%rdx
+  800c9c:	74 1f                	je     800cbd <strncmp+0x24>
+  800c9e:	0f b6 07             	movzbl (%rdi),%eax
+  800ca1:	84 c0                	test   %al,%al
+  800ca3:	74 1e                	je     800cc3 <strncmp+0x2a>
+  800ca5:	3a 06                	cmp    (%rsi),%al
+  800ca7:	75 1a                	jne    800cc3 <strncmp+0x2a>
+  800ca9:	48 83 c7 01          	add    $0x1,%rdi
+  800cad:	48 83 c6 01          	add    $0x1,%rsi
+  800cb1:	48 83 ea 01          	sub    $0x1,%rdx
+  800cb5:	75 e7                	jne    800c9e <strncmp+0x5>
+
+    if (!n) return 0;
+  800cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbc:	c3                   	ret
+  800cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc2:	c3                   	ret
+  800cc3:	48 85 d2             	test   %rdx,%rdx
+  800cc6:	74 09                	je     800cd1 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cc8:	0f b6 07             	movzbl (%rdi),%eax
+  800ccb:	0f b6 16             	movzbl (%rsi),%edx
+  800cce:	29 d0                	sub    %edx,%eax
+  800cd0:	c3                   	ret
+    if (!n) return 0;
+  800cd1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cd6:	c3                   	ret
+
+0000000000800cd7 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cd7:	0f b6 17             	movzbl (%rdi),%edx
+  800cda:	84 d2                	test   %dl,%dl
+  800cdc:	74 18                	je     800cf6 <strchr+0x1f>
+        if (*str == c) {
+  800cde:	0f be d2             	movsbl %dl,%edx
+  800ce1:	39 f2                	cmp    %esi,%edx
+  800ce3:	74 17                	je     800cfc <strchr+0x25>
+    for (; *str; str++) {
+  800ce5:	48 83 c7 01          	add    $0x1,%rdi
+  800ce9:	0f b6 17             	movzbl (%rdi),%edx
+  800cec:	84 d2                	test   %dl,%dl
+  800cee:	75 ee                	jne    800cde <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf5:	c3                   	ret
+  800cf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfb:	c3                   	ret
+  800cfc:	48 89 f8             	mov    %rdi,%rax
+}
+  800cff:	c3                   	ret
+
+0000000000800d00 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d00:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d03:	0f b6 17             	movzbl (%rdi),%edx
+  800d06:	84 d2                	test   %dl,%dl
+  800d08:	74 13                	je     800d1d <strfind+0x1d>
+  800d0a:	0f be d2             	movsbl %dl,%edx
+  800d0d:	39 f2                	cmp    %esi,%edx
+  800d0f:	74 0b                	je     800d1c <strfind+0x1c>
+  800d11:	48 83 c0 01          	add    $0x1,%rax
+  800d15:	0f b6 10             	movzbl (%rax),%edx
+  800d18:	84 d2                	test   %dl,%dl
+  800d1a:	75 ee                	jne    800d0a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d1c:	c3                   	ret
+  800d1d:	c3                   	ret
+
+0000000000800d1e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d1e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d21:	48 89 f8             	mov    %rdi,%rax
+  800d24:	48 f7 d8             	neg    %rax
+  800d27:	83 e0 07             	and    $0x7,%eax
+  800d2a:	49 89 d1             	mov    %rdx,%r9
+  800d2d:	49 29 c1             	sub    %rax,%r9
+  800d30:	78 36                	js     800d68 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d32:	40 0f b6 c6          	movzbl %sil,%eax
+  800d36:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d3d:	01 01 01 
+  800d40:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d44:	40 f6 c7 07          	test   $0x7,%dil
+  800d48:	75 38                	jne    800d82 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d4a:	4c 89 c9             	mov    %r9,%rcx
+  800d4d:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d51:	74 0c                	je     800d5f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d53:	fc                   	cld
+  800d54:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d57:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d5b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d5f:	4d 85 c9             	test   %r9,%r9
+  800d62:	75 45                	jne    800da9 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d64:	4c 89 c0             	mov    %r8,%rax
+  800d67:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d68:	48 85 d2             	test   %rdx,%rdx
+  800d6b:	74 f7                	je     800d64 <memset+0x46>
+  800d6d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d70:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d73:	48 83 c0 01          	add    $0x1,%rax
+  800d77:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d7b:	48 39 c2             	cmp    %rax,%rdx
+  800d7e:	75 f3                	jne    800d73 <memset+0x55>
+  800d80:	eb e2                	jmp    800d64 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d82:	40 f6 c7 01          	test   $0x1,%dil
+  800d86:	74 06                	je     800d8e <memset+0x70>
+  800d88:	88 07                	mov    %al,(%rdi)
+  800d8a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d8e:	40 f6 c7 02          	test   $0x2,%dil
+  800d92:	74 07                	je     800d9b <memset+0x7d>
+  800d94:	66 89 07             	mov    %ax,(%rdi)
+  800d97:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d9b:	40 f6 c7 04          	test   $0x4,%dil
+  800d9f:	74 a9                	je     800d4a <memset+0x2c>
+  800da1:	89 07                	mov    %eax,(%rdi)
+  800da3:	48 83 c7 04          	add    $0x4,%rdi
+  800da7:	eb a1                	jmp    800d4a <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800da9:	41 f6 c1 04          	test   $0x4,%r9b
+  800dad:	74 06                	je     800db5 <memset+0x97>
+  800daf:	89 07                	mov    %eax,(%rdi)
+  800db1:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800db5:	41 f6 c1 02          	test   $0x2,%r9b
+  800db9:	74 07                	je     800dc2 <memset+0xa4>
+  800dbb:	66 89 07             	mov    %ax,(%rdi)
+  800dbe:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800dc2:	41 f6 c1 01          	test   $0x1,%r9b
+  800dc6:	74 9c                	je     800d64 <memset+0x46>
+  800dc8:	88 07                	mov    %al,(%rdi)
+  800dca:	eb 98                	jmp    800d64 <memset+0x46>
+
+0000000000800dcc <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800dcc:	48 89 f8             	mov    %rdi,%rax
+  800dcf:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800dd2:	48 39 fe             	cmp    %rdi,%rsi
+  800dd5:	73 3b                	jae    800e12 <memmove+0x46>
+  800dd7:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ddb:	48 39 d7             	cmp    %rdx,%rdi
+  800dde:	73 32                	jae    800e12 <memmove+0x46>
+        s += n;
+        d += n;
+  800de0:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800de4:	48 89 d6             	mov    %rdx,%rsi
+  800de7:	48 09 fe             	or     %rdi,%rsi
+  800dea:	48 09 ce             	or     %rcx,%rsi
+  800ded:	40 f6 c6 07          	test   $0x7,%sil
+  800df1:	75 12                	jne    800e05 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800df3:	48 83 ef 08          	sub    $0x8,%rdi
+  800df7:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800dfb:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dff:	fd                   	std
+  800e00:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e03:	fc                   	cld
+  800e04:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e05:	48 83 ef 01          	sub    $0x1,%rdi
+  800e09:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e0d:	fd                   	std
+  800e0e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e10:	eb f1                	jmp    800e03 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e12:	48 89 f2             	mov    %rsi,%rdx
+  800e15:	48 09 c2             	or     %rax,%rdx
+  800e18:	48 09 ca             	or     %rcx,%rdx
+  800e1b:	f6 c2 07             	test   $0x7,%dl
+  800e1e:	75 0c                	jne    800e2c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e20:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e24:	48 89 c7             	mov    %rax,%rdi
+  800e27:	fc                   	cld
+  800e28:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e2b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e2c:	48 89 c7             	mov    %rax,%rdi
+  800e2f:	fc                   	cld
+  800e30:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e32:	c3                   	ret
+
+0000000000800e33 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e33:	55                   	push   %rbp
+  800e34:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e37:	48 b8 cc 0d 80 00 00 	movabs $0x800dcc,%rax
+  800e3e:	00 00 00 
+  800e41:	ff d0                	call   *%rax
+}
+  800e43:	5d                   	pop    %rbp
+  800e44:	c3                   	ret
+
+0000000000800e45 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e45:	55                   	push   %rbp
+  800e46:	48 89 e5             	mov    %rsp,%rbp
+  800e49:	41 57                	push   %r15
+  800e4b:	41 56                	push   %r14
+  800e4d:	41 55                	push   %r13
+  800e4f:	41 54                	push   %r12
+  800e51:	53                   	push   %rbx
+  800e52:	48 83 ec 08          	sub    $0x8,%rsp
+  800e56:	49 89 fe             	mov    %rdi,%r14
+  800e59:	49 89 f7             	mov    %rsi,%r15
+  800e5c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e5f:	48 89 f7             	mov    %rsi,%rdi
+  800e62:	48 b8 94 0b 80 00 00 	movabs $0x800b94,%rax
+  800e69:	00 00 00 
+  800e6c:	ff d0                	call   *%rax
+  800e6e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e71:	48 89 de             	mov    %rbx,%rsi
+  800e74:	4c 89 f7             	mov    %r14,%rdi
+  800e77:	48 b8 af 0b 80 00 00 	movabs $0x800baf,%rax
+  800e7e:	00 00 00 
+  800e81:	ff d0                	call   *%rax
+  800e83:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e86:	48 39 c3             	cmp    %rax,%rbx
+  800e89:	74 36                	je     800ec1 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e8b:	48 89 d8             	mov    %rbx,%rax
+  800e8e:	4c 29 e8             	sub    %r13,%rax
+  800e91:	49 39 c4             	cmp    %rax,%r12
+  800e94:	73 31                	jae    800ec7 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e96:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e9b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e9f:	4c 89 fe             	mov    %r15,%rsi
+  800ea2:	48 b8 33 0e 80 00 00 	movabs $0x800e33,%rax
+  800ea9:	00 00 00 
+  800eac:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800eae:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800eb2:	48 83 c4 08          	add    $0x8,%rsp
+  800eb6:	5b                   	pop    %rbx
+  800eb7:	41 5c                	pop    %r12
+  800eb9:	41 5d                	pop    %r13
+  800ebb:	41 5e                	pop    %r14
+  800ebd:	41 5f                	pop    %r15
+  800ebf:	5d                   	pop    %rbp
+  800ec0:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ec1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ec5:	eb eb                	jmp    800eb2 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800ec7:	48 83 eb 01          	sub    $0x1,%rbx
+  800ecb:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ecf:	48 89 da             	mov    %rbx,%rdx
+  800ed2:	4c 89 fe             	mov    %r15,%rsi
+  800ed5:	48 b8 33 0e 80 00 00 	movabs $0x800e33,%rax
+  800edc:	00 00 00 
+  800edf:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ee1:	49 01 de             	add    %rbx,%r14
+  800ee4:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ee9:	eb c3                	jmp    800eae <strlcat+0x69>
+
+0000000000800eeb <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800eeb:	48 85 d2             	test   %rdx,%rdx
+  800eee:	74 2d                	je     800f1d <memcmp+0x32>
+  800ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ef5:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ef9:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800efe:	44 38 c1             	cmp    %r8b,%cl
+  800f01:	75 0f                	jne    800f12 <memcmp+0x27>
+    while (n-- > 0) {
+  800f03:	48 83 c0 01          	add    $0x1,%rax
+  800f07:	48 39 c2             	cmp    %rax,%rdx
+  800f0a:	75 e9                	jne    800ef5 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f11:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f12:	0f b6 c1             	movzbl %cl,%eax
+  800f15:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f19:	44 29 c0             	sub    %r8d,%eax
+  800f1c:	c3                   	ret
+    return 0;
+  800f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f22:	c3                   	ret
+
+0000000000800f23 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f23:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f27:	48 39 c7             	cmp    %rax,%rdi
+  800f2a:	73 0f                	jae    800f3b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f2c:	40 38 37             	cmp    %sil,(%rdi)
+  800f2f:	74 0e                	je     800f3f <memfind+0x1c>
+    for (; src < end; src++) {
+  800f31:	48 83 c7 01          	add    $0x1,%rdi
+  800f35:	48 39 f8             	cmp    %rdi,%rax
+  800f38:	75 f2                	jne    800f2c <memfind+0x9>
+  800f3a:	c3                   	ret
+  800f3b:	48 89 f8             	mov    %rdi,%rax
+  800f3e:	c3                   	ret
+  800f3f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f42:	c3                   	ret
+
+0000000000800f43 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f43:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f46:	0f b6 37             	movzbl (%rdi),%esi
+  800f49:	40 80 fe 20          	cmp    $0x20,%sil
+  800f4d:	74 06                	je     800f55 <strtol+0x12>
+  800f4f:	40 80 fe 09          	cmp    $0x9,%sil
+  800f53:	75 13                	jne    800f68 <strtol+0x25>
+  800f55:	48 83 c7 01          	add    $0x1,%rdi
+  800f59:	0f b6 37             	movzbl (%rdi),%esi
+  800f5c:	40 80 fe 20          	cmp    $0x20,%sil
+  800f60:	74 f3                	je     800f55 <strtol+0x12>
+  800f62:	40 80 fe 09          	cmp    $0x9,%sil
+  800f66:	74 ed                	je     800f55 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f68:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f6b:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f6e:	3c 01                	cmp    $0x1,%al
+  800f70:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f74:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f7a:	75 0f                	jne    800f8b <strtol+0x48>
+  800f7c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f7f:	74 14                	je     800f95 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f81:	85 d2                	test   %edx,%edx
+  800f83:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f88:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f8b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f90:	4c 63 ca             	movslq %edx,%r9
+  800f93:	eb 36                	jmp    800fcb <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f95:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f99:	74 0f                	je     800faa <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f9b:	85 d2                	test   %edx,%edx
+  800f9d:	75 ec                	jne    800f8b <strtol+0x48>
+        s++;
+  800f9f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800fa3:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800fa8:	eb e1                	jmp    800f8b <strtol+0x48>
+        s += 2;
+  800faa:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800fae:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800fb3:	eb d6                	jmp    800f8b <strtol+0x48>
+            dig -= '0';
+  800fb5:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fb8:	44 0f b6 c1          	movzbl %cl,%r8d
+  800fbc:	41 39 d0             	cmp    %edx,%r8d
+  800fbf:	7d 21                	jge    800fe2 <strtol+0x9f>
+        val = val * base + dig;
+  800fc1:	49 0f af c1          	imul   %r9,%rax
+  800fc5:	0f b6 c9             	movzbl %cl,%ecx
+  800fc8:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fcb:	48 83 c7 01          	add    $0x1,%rdi
+  800fcf:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800fd3:	80 f9 39             	cmp    $0x39,%cl
+  800fd6:	76 dd                	jbe    800fb5 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fd8:	80 f9 7b             	cmp    $0x7b,%cl
+  800fdb:	77 05                	ja     800fe2 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fdd:	83 e9 57             	sub    $0x57,%ecx
+  800fe0:	eb d6                	jmp    800fb8 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fe2:	4d 85 d2             	test   %r10,%r10
+  800fe5:	74 03                	je     800fea <strtol+0xa7>
+  800fe7:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fea:	48 89 c2             	mov    %rax,%rdx
+  800fed:	48 f7 da             	neg    %rdx
+  800ff0:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800ff4:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800ff8:	c3                   	ret
+
+0000000000800ff9 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800ff9:	55                   	push   %rbp
+  800ffa:	48 89 e5             	mov    %rsp,%rbp
+  800ffd:	53                   	push   %rbx
+  800ffe:	48 89 fa             	mov    %rdi,%rdx
+  801001:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801004:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801009:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801013:	be 00 00 00 00       	mov    $0x0,%esi
+  801018:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80101e:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801020:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801024:	c9                   	leave
+  801025:	c3                   	ret
+
+0000000000801026 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801026:	55                   	push   %rbp
+  801027:	48 89 e5             	mov    %rsp,%rbp
+  80102a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80102b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801030:	ba 00 00 00 00       	mov    $0x0,%edx
+  801035:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80103a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801044:	be 00 00 00 00       	mov    $0x0,%esi
+  801049:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80104f:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801051:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801055:	c9                   	leave
+  801056:	c3                   	ret
+
+0000000000801057 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801057:	55                   	push   %rbp
+  801058:	48 89 e5             	mov    %rsp,%rbp
+  80105b:	53                   	push   %rbx
+  80105c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801060:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801063:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801068:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80106d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801072:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801077:	be 00 00 00 00       	mov    $0x0,%esi
+  80107c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801082:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801084:	48 85 c0             	test   %rax,%rax
+  801087:	7f 06                	jg     80108f <sys_env_destroy+0x38>
+}
+  801089:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80108d:	c9                   	leave
+  80108e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80108f:	49 89 c0             	mov    %rax,%r8
+  801092:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801097:	48 ba 90 32 80 00 00 	movabs $0x803290,%rdx
+  80109e:	00 00 00 
+  8010a1:	be 26 00 00 00       	mov    $0x26,%esi
+  8010a6:	48 bf af 32 80 00 00 	movabs $0x8032af,%rdi
+  8010ad:	00 00 00 
+  8010b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b5:	49 b9 7c 2c 80 00 00 	movabs $0x802c7c,%r9
+  8010bc:	00 00 00 
+  8010bf:	41 ff d1             	call   *%r9
+
+00000000008010c2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8010c2:	55                   	push   %rbp
+  8010c3:	48 89 e5             	mov    %rsp,%rbp
+  8010c6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010c7:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010eb:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010f1:	c9                   	leave
+  8010f2:	c3                   	ret
+
+00000000008010f3 <sys_yield>:
+
+void
+sys_yield(void) {
+  8010f3:	55                   	push   %rbp
+  8010f4:	48 89 e5             	mov    %rsp,%rbp
+  8010f7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f8:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801102:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801107:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801111:	be 00 00 00 00       	mov    $0x0,%esi
+  801116:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80111c:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80111e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801122:	c9                   	leave
+  801123:	c3                   	ret
+
+0000000000801124 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801124:	55                   	push   %rbp
+  801125:	48 89 e5             	mov    %rsp,%rbp
+  801128:	53                   	push   %rbx
+  801129:	48 89 fa             	mov    %rdi,%rdx
+  80112c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80112f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801134:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80113b:	00 00 00 
+  80113e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801143:	be 00 00 00 00       	mov    $0x0,%esi
+  801148:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80114e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801150:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801154:	c9                   	leave
+  801155:	c3                   	ret
+
+0000000000801156 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801156:	55                   	push   %rbp
+  801157:	48 89 e5             	mov    %rsp,%rbp
+  80115a:	53                   	push   %rbx
+  80115b:	49 89 f8             	mov    %rdi,%r8
+  80115e:	48 89 d3             	mov    %rdx,%rbx
+  801161:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801164:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801169:	4c 89 c2             	mov    %r8,%rdx
+  80116c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80116f:	be 00 00 00 00       	mov    $0x0,%esi
+  801174:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80117a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80117c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801180:	c9                   	leave
+  801181:	c3                   	ret
+
+0000000000801182 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801182:	55                   	push   %rbp
+  801183:	48 89 e5             	mov    %rsp,%rbp
+  801186:	53                   	push   %rbx
+  801187:	48 83 ec 08          	sub    $0x8,%rsp
+  80118b:	89 f8                	mov    %edi,%eax
+  80118d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801190:	48 63 f9             	movslq %ecx,%rdi
+  801193:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801196:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80119b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80119e:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011ab:	48 85 c0             	test   %rax,%rax
+  8011ae:	7f 06                	jg     8011b6 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b4:	c9                   	leave
+  8011b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011b6:	49 89 c0             	mov    %rax,%r8
+  8011b9:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011be:	48 ba 90 32 80 00 00 	movabs $0x803290,%rdx
+  8011c5:	00 00 00 
+  8011c8:	be 26 00 00 00       	mov    $0x26,%esi
+  8011cd:	48 bf af 32 80 00 00 	movabs $0x8032af,%rdi
+  8011d4:	00 00 00 
+  8011d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011dc:	49 b9 7c 2c 80 00 00 	movabs $0x802c7c,%r9
+  8011e3:	00 00 00 
+  8011e6:	41 ff d1             	call   *%r9
+
+00000000008011e9 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011e9:	55                   	push   %rbp
+  8011ea:	48 89 e5             	mov    %rsp,%rbp
+  8011ed:	53                   	push   %rbx
+  8011ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8011f2:	89 f8                	mov    %edi,%eax
+  8011f4:	49 89 f2             	mov    %rsi,%r10
+  8011f7:	48 89 cf             	mov    %rcx,%rdi
+  8011fa:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011fd:	48 63 da             	movslq %edx,%rbx
+  801200:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801203:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801208:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80120b:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80120e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801210:	48 85 c0             	test   %rax,%rax
+  801213:	7f 06                	jg     80121b <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801215:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801219:	c9                   	leave
+  80121a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80121b:	49 89 c0             	mov    %rax,%r8
+  80121e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801223:	48 ba 90 32 80 00 00 	movabs $0x803290,%rdx
+  80122a:	00 00 00 
+  80122d:	be 26 00 00 00       	mov    $0x26,%esi
+  801232:	48 bf af 32 80 00 00 	movabs $0x8032af,%rdi
+  801239:	00 00 00 
+  80123c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801241:	49 b9 7c 2c 80 00 00 	movabs $0x802c7c,%r9
+  801248:	00 00 00 
+  80124b:	41 ff d1             	call   *%r9
+
+000000000080124e <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80124e:	55                   	push   %rbp
+  80124f:	48 89 e5             	mov    %rsp,%rbp
+  801252:	53                   	push   %rbx
+  801253:	48 83 ec 08          	sub    $0x8,%rsp
+  801257:	48 89 f1             	mov    %rsi,%rcx
+  80125a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80125d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801260:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801265:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80126a:	be 00 00 00 00       	mov    $0x0,%esi
+  80126f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801275:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801277:	48 85 c0             	test   %rax,%rax
+  80127a:	7f 06                	jg     801282 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80127c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801280:	c9                   	leave
+  801281:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801282:	49 89 c0             	mov    %rax,%r8
+  801285:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80128a:	48 ba 90 32 80 00 00 	movabs $0x803290,%rdx
+  801291:	00 00 00 
+  801294:	be 26 00 00 00       	mov    $0x26,%esi
+  801299:	48 bf af 32 80 00 00 	movabs $0x8032af,%rdi
+  8012a0:	00 00 00 
+  8012a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a8:	49 b9 7c 2c 80 00 00 	movabs $0x802c7c,%r9
+  8012af:	00 00 00 
+  8012b2:	41 ff d1             	call   *%r9
+
+00000000008012b5 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8012b5:	55                   	push   %rbp
+  8012b6:	48 89 e5             	mov    %rsp,%rbp
+  8012b9:	53                   	push   %rbx
+  8012ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8012be:	89 f8                	mov    %edi,%eax
+  8012c0:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8012c3:	48 63 f9             	movslq %ecx,%rdi
+  8012c6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c9:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012ce:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012de:	48 85 c0             	test   %rax,%rax
+  8012e1:	7f 06                	jg     8012e9 <sys_region_advise+0x34>
+}
+  8012e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e7:	c9                   	leave
+  8012e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012e9:	49 89 c0             	mov    %rax,%r8
+  8012ec:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8012f1:	48 ba 90 32 80 00 00 	movabs $0x803290,%rdx
+  8012f8:	00 00 00 
+  8012fb:	be 26 00 00 00       	mov    $0x26,%esi
+  801300:	48 bf af 32 80 00 00 	movabs $0x8032af,%rdi
+  801307:	00 00 00 
+  80130a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80130f:	49 b9 7c 2c 80 00 00 	movabs $0x802c7c,%r9
+  801316:	00 00 00 
+  801319:	41 ff d1             	call   *%r9
+
+000000000080131c <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  80131c:	55                   	push   %rbp
+  80131d:	48 89 e5             	mov    %rsp,%rbp
+  801320:	53                   	push   %rbx
+  801321:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801325:	48 63 ce             	movslq %esi,%rcx
+  801328:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80132b:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801330:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801335:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133a:	be 00 00 00 00       	mov    $0x0,%esi
+  80133f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801345:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801347:	48 85 c0             	test   %rax,%rax
+  80134a:	7f 06                	jg     801352 <sys_env_set_nice+0x36>
+}
+  80134c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801350:	c9                   	leave
+  801351:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801352:	49 89 c0             	mov    %rax,%r8
+  801355:	b9 15 00 00 00       	mov    $0x15,%ecx
+  80135a:	48 ba 90 32 80 00 00 	movabs $0x803290,%rdx
+  801361:	00 00 00 
+  801364:	be 26 00 00 00       	mov    $0x26,%esi
+  801369:	48 bf af 32 80 00 00 	movabs $0x8032af,%rdi
+  801370:	00 00 00 
+  801373:	b8 00 00 00 00       	mov    $0x0,%eax
+  801378:	49 b9 7c 2c 80 00 00 	movabs $0x802c7c,%r9
+  80137f:	00 00 00 
+  801382:	41 ff d1             	call   *%r9
+
+0000000000801385 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801385:	55                   	push   %rbp
+  801386:	48 89 e5             	mov    %rsp,%rbp
+  801389:	53                   	push   %rbx
+  80138a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80138e:	48 63 ce             	movslq %esi,%rcx
+  801391:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801394:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801399:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ae:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013b0:	48 85 c0             	test   %rax,%rax
+  8013b3:	7f 06                	jg     8013bb <sys_env_set_status+0x36>
+}
+  8013b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b9:	c9                   	leave
+  8013ba:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013bb:	49 89 c0             	mov    %rax,%r8
+  8013be:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013c3:	48 ba 90 32 80 00 00 	movabs $0x803290,%rdx
+  8013ca:	00 00 00 
+  8013cd:	be 26 00 00 00       	mov    $0x26,%esi
+  8013d2:	48 bf af 32 80 00 00 	movabs $0x8032af,%rdi
+  8013d9:	00 00 00 
+  8013dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e1:	49 b9 7c 2c 80 00 00 	movabs $0x802c7c,%r9
+  8013e8:	00 00 00 
+  8013eb:	41 ff d1             	call   *%r9
+
+00000000008013ee <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013ee:	55                   	push   %rbp
+  8013ef:	48 89 e5             	mov    %rsp,%rbp
+  8013f2:	53                   	push   %rbx
+  8013f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8013f7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013fa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013fd:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801402:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801407:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80140c:	be 00 00 00 00       	mov    $0x0,%esi
+  801411:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801417:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801419:	48 85 c0             	test   %rax,%rax
+  80141c:	7f 06                	jg     801424 <sys_env_set_trapframe+0x36>
+}
+  80141e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801422:	c9                   	leave
+  801423:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801424:	49 89 c0             	mov    %rax,%r8
+  801427:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80142c:	48 ba 90 32 80 00 00 	movabs $0x803290,%rdx
+  801433:	00 00 00 
+  801436:	be 26 00 00 00       	mov    $0x26,%esi
+  80143b:	48 bf af 32 80 00 00 	movabs $0x8032af,%rdi
+  801442:	00 00 00 
+  801445:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144a:	49 b9 7c 2c 80 00 00 	movabs $0x802c7c,%r9
+  801451:	00 00 00 
+  801454:	41 ff d1             	call   *%r9
+
+0000000000801457 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801457:	55                   	push   %rbp
+  801458:	48 89 e5             	mov    %rsp,%rbp
+  80145b:	53                   	push   %rbx
+  80145c:	48 83 ec 08          	sub    $0x8,%rsp
+  801460:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801463:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801466:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80146b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801470:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801475:	be 00 00 00 00       	mov    $0x0,%esi
+  80147a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801480:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801482:	48 85 c0             	test   %rax,%rax
+  801485:	7f 06                	jg     80148d <sys_env_set_pgfault_upcall+0x36>
+}
+  801487:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80148b:	c9                   	leave
+  80148c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80148d:	49 89 c0             	mov    %rax,%r8
+  801490:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801495:	48 ba 90 32 80 00 00 	movabs $0x803290,%rdx
+  80149c:	00 00 00 
+  80149f:	be 26 00 00 00       	mov    $0x26,%esi
+  8014a4:	48 bf af 32 80 00 00 	movabs $0x8032af,%rdi
+  8014ab:	00 00 00 
+  8014ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b3:	49 b9 7c 2c 80 00 00 	movabs $0x802c7c,%r9
+  8014ba:	00 00 00 
+  8014bd:	41 ff d1             	call   *%r9
+
+00000000008014c0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014c0:	55                   	push   %rbp
+  8014c1:	48 89 e5             	mov    %rsp,%rbp
+  8014c4:	53                   	push   %rbx
+  8014c5:	89 f8                	mov    %edi,%eax
+  8014c7:	49 89 f1             	mov    %rsi,%r9
+  8014ca:	48 89 d3             	mov    %rdx,%rbx
+  8014cd:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014d0:	49 63 f0             	movslq %r8d,%rsi
+  8014d3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d6:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014db:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e4:	cd 30                	int    $0x30
+}
+  8014e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ea:	c9                   	leave
+  8014eb:	c3                   	ret
+
+00000000008014ec <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8014ec:	55                   	push   %rbp
+  8014ed:	48 89 e5             	mov    %rsp,%rbp
+  8014f0:	53                   	push   %rbx
+  8014f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8014f5:	48 89 fa             	mov    %rdi,%rdx
+  8014f8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801500:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801505:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80150a:	be 00 00 00 00       	mov    $0x0,%esi
+  80150f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801515:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801517:	48 85 c0             	test   %rax,%rax
+  80151a:	7f 06                	jg     801522 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80151c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801520:	c9                   	leave
+  801521:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801522:	49 89 c0             	mov    %rax,%r8
+  801525:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80152a:	48 ba 90 32 80 00 00 	movabs $0x803290,%rdx
+  801531:	00 00 00 
+  801534:	be 26 00 00 00       	mov    $0x26,%esi
+  801539:	48 bf af 32 80 00 00 	movabs $0x8032af,%rdi
+  801540:	00 00 00 
+  801543:	b8 00 00 00 00       	mov    $0x0,%eax
+  801548:	49 b9 7c 2c 80 00 00 	movabs $0x802c7c,%r9
+  80154f:	00 00 00 
+  801552:	41 ff d1             	call   *%r9
+
+0000000000801555 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801555:	55                   	push   %rbp
+  801556:	48 89 e5             	mov    %rsp,%rbp
+  801559:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80155a:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80155f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801564:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801569:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801573:	be 00 00 00 00       	mov    $0x0,%esi
+  801578:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80157e:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801580:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801584:	c9                   	leave
+  801585:	c3                   	ret
+
+0000000000801586 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  801586:	55                   	push   %rbp
+  801587:	48 89 e5             	mov    %rsp,%rbp
+  80158a:	53                   	push   %rbx
+  80158b:	48 83 ec 08          	sub    $0x8,%rsp
+  80158f:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801592:	48 63 ce             	movslq %esi,%rcx
+  801595:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801598:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80159d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ad:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015af:	48 85 c0             	test   %rax,%rax
+  8015b2:	7f 06                	jg     8015ba <sys_sigqueue+0x34>
+}
+  8015b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b8:	c9                   	leave
+  8015b9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ba:	49 89 c0             	mov    %rax,%r8
+  8015bd:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8015c2:	48 ba 90 32 80 00 00 	movabs $0x803290,%rdx
+  8015c9:	00 00 00 
+  8015cc:	be 26 00 00 00       	mov    $0x26,%esi
+  8015d1:	48 bf af 32 80 00 00 	movabs $0x8032af,%rdi
+  8015d8:	00 00 00 
+  8015db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e0:	49 b9 7c 2c 80 00 00 	movabs $0x802c7c,%r9
+  8015e7:	00 00 00 
+  8015ea:	41 ff d1             	call   *%r9
+
+00000000008015ed <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8015ed:	55                   	push   %rbp
+  8015ee:	48 89 e5             	mov    %rsp,%rbp
+  8015f1:	53                   	push   %rbx
+  8015f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8015f6:	48 89 fa             	mov    %rdi,%rdx
+  8015f9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015fc:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801601:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801606:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80160b:	be 00 00 00 00       	mov    $0x0,%esi
+  801610:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801616:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801618:	48 85 c0             	test   %rax,%rax
+  80161b:	7f 06                	jg     801623 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  80161d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801621:	c9                   	leave
+  801622:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801623:	49 89 c0             	mov    %rax,%r8
+  801626:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80162b:	48 ba 90 32 80 00 00 	movabs $0x803290,%rdx
+  801632:	00 00 00 
+  801635:	be 26 00 00 00       	mov    $0x26,%esi
+  80163a:	48 bf af 32 80 00 00 	movabs $0x8032af,%rdi
+  801641:	00 00 00 
+  801644:	b8 00 00 00 00       	mov    $0x0,%eax
+  801649:	49 b9 7c 2c 80 00 00 	movabs $0x802c7c,%r9
+  801650:	00 00 00 
+  801653:	41 ff d1             	call   *%r9
+
+0000000000801656 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801656:	55                   	push   %rbp
+  801657:	48 89 e5             	mov    %rsp,%rbp
+  80165a:	53                   	push   %rbx
+  80165b:	48 83 ec 08          	sub    $0x8,%rsp
+  80165f:	48 89 f1             	mov    %rsi,%rcx
+  801662:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801665:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801668:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80166d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801672:	be 00 00 00 00       	mov    $0x0,%esi
+  801677:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80167d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80167f:	48 85 c0             	test   %rax,%rax
+  801682:	7f 06                	jg     80168a <sys_sigaction+0x34>
+}
+  801684:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801688:	c9                   	leave
+  801689:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80168a:	49 89 c0             	mov    %rax,%r8
+  80168d:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801692:	48 ba 90 32 80 00 00 	movabs $0x803290,%rdx
+  801699:	00 00 00 
+  80169c:	be 26 00 00 00       	mov    $0x26,%esi
+  8016a1:	48 bf af 32 80 00 00 	movabs $0x8032af,%rdi
+  8016a8:	00 00 00 
+  8016ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b0:	49 b9 7c 2c 80 00 00 	movabs $0x802c7c,%r9
+  8016b7:	00 00 00 
+  8016ba:	41 ff d1             	call   *%r9
+
+00000000008016bd <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8016bd:	55                   	push   %rbp
+  8016be:	48 89 e5             	mov    %rsp,%rbp
+  8016c1:	53                   	push   %rbx
+  8016c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8016c6:	48 89 f1             	mov    %rsi,%rcx
+  8016c9:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8016cc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016cf:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8016de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016e4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016e6:	48 85 c0             	test   %rax,%rax
+  8016e9:	7f 06                	jg     8016f1 <sys_sigprocmask+0x34>
+}
+  8016eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ef:	c9                   	leave
+  8016f0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016f1:	49 89 c0             	mov    %rax,%r8
+  8016f4:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8016f9:	48 ba 90 32 80 00 00 	movabs $0x803290,%rdx
+  801700:	00 00 00 
+  801703:	be 26 00 00 00       	mov    $0x26,%esi
+  801708:	48 bf af 32 80 00 00 	movabs $0x8032af,%rdi
+  80170f:	00 00 00 
+  801712:	b8 00 00 00 00       	mov    $0x0,%eax
+  801717:	49 b9 7c 2c 80 00 00 	movabs $0x802c7c,%r9
+  80171e:	00 00 00 
+  801721:	41 ff d1             	call   *%r9
+
+0000000000801724 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801724:	55                   	push   %rbp
+  801725:	48 89 e5             	mov    %rsp,%rbp
+  801728:	41 54                	push   %r12
+  80172a:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80172b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801730:	cd 30                	int    $0x30
+  801732:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  801735:	85 c0                	test   %eax,%eax
+  801737:	78 76                	js     8017af <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  801739:	74 7c                	je     8017b7 <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  80173b:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801741:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801748:	00 00 00 
+  80174b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801750:	89 c2                	mov    %eax,%edx
+  801752:	be 00 00 00 00       	mov    $0x0,%esi
+  801757:	bf 00 00 00 00       	mov    $0x0,%edi
+  80175c:	48 b8 e9 11 80 00 00 	movabs $0x8011e9,%rax
+  801763:	00 00 00 
+  801766:	ff d0                	call   *%rax
+  801768:	85 c0                	test   %eax,%eax
+  80176a:	75 7a                	jne    8017e6 <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  80176c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801773:	00 00 00 
+  801776:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  80177d:	44 89 e7             	mov    %r12d,%edi
+  801780:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  801787:	00 00 00 
+  80178a:	ff d0                	call   *%rax
+  80178c:	85 c0                	test   %eax,%eax
+  80178e:	75 5e                	jne    8017ee <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  801790:	be 02 00 00 00       	mov    $0x2,%esi
+  801795:	44 89 e7             	mov    %r12d,%edi
+  801798:	48 b8 85 13 80 00 00 	movabs $0x801385,%rax
+  80179f:	00 00 00 
+  8017a2:	ff d0                	call   *%rax
+        return -1;
+  8017a4:	85 c0                	test   %eax,%eax
+  8017a6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017ab:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  8017af:	44 89 e0             	mov    %r12d,%eax
+  8017b2:	5b                   	pop    %rbx
+  8017b3:	41 5c                	pop    %r12
+  8017b5:	5d                   	pop    %rbp
+  8017b6:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  8017b7:	48 b8 c2 10 80 00 00 	movabs $0x8010c2,%rax
+  8017be:	00 00 00 
+  8017c1:	ff d0                	call   *%rax
+  8017c3:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  8017c6:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8017cd:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8017d4:	00 00 00 
+  8017d7:	48 01 d0             	add    %rdx,%rax
+  8017da:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8017e1:	00 00 00 
+        return 0;
+  8017e4:	eb c9                	jmp    8017af <fork+0x8b>
+        return -1;
+  8017e6:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8017ec:	eb c1                	jmp    8017af <fork+0x8b>
+        return -1;
+  8017ee:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8017f4:	eb b9                	jmp    8017af <fork+0x8b>
+
+00000000008017f6 <sfork>:
+
+envid_t
+sfork() {
+  8017f6:	55                   	push   %rbp
+  8017f7:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8017fa:	48 ba bd 32 80 00 00 	movabs $0x8032bd,%rdx
+  801801:	00 00 00 
+  801804:	be 2e 00 00 00       	mov    $0x2e,%esi
+  801809:	48 bf d8 32 80 00 00 	movabs $0x8032d8,%rdi
+  801810:	00 00 00 
+  801813:	b8 00 00 00 00       	mov    $0x0,%eax
+  801818:	48 b9 7c 2c 80 00 00 	movabs $0x802c7c,%rcx
+  80181f:	00 00 00 
+  801822:	ff d1                	call   *%rcx
+
+0000000000801824 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801824:	55                   	push   %rbp
+  801825:	48 89 e5             	mov    %rsp,%rbp
+  801828:	41 54                	push   %r12
+  80182a:	53                   	push   %rbx
+  80182b:	48 89 fb             	mov    %rdi,%rbx
+  80182e:	48 89 f7             	mov    %rsi,%rdi
+  801831:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  801834:	48 85 f6             	test   %rsi,%rsi
+  801837:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80183e:	00 00 00 
+  801841:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  801845:	be 00 10 00 00       	mov    $0x1000,%esi
+  80184a:	48 b8 ec 14 80 00 00 	movabs $0x8014ec,%rax
+  801851:	00 00 00 
+  801854:	ff d0                	call   *%rax
+    if (res < 0) {
+  801856:	85 c0                	test   %eax,%eax
+  801858:	78 45                	js     80189f <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  80185a:	48 85 db             	test   %rbx,%rbx
+  80185d:	74 12                	je     801871 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  80185f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801866:	00 00 00 
+  801869:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  80186f:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  801871:	4d 85 e4             	test   %r12,%r12
+  801874:	74 14                	je     80188a <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  801876:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80187d:	00 00 00 
+  801880:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  801886:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  80188a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801891:	00 00 00 
+  801894:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  80189a:	5b                   	pop    %rbx
+  80189b:	41 5c                	pop    %r12
+  80189d:	5d                   	pop    %rbp
+  80189e:	c3                   	ret
+        if (from_env_store)
+  80189f:	48 85 db             	test   %rbx,%rbx
+  8018a2:	74 06                	je     8018aa <ipc_recv+0x86>
+            *from_env_store = 0;
+  8018a4:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  8018aa:	4d 85 e4             	test   %r12,%r12
+  8018ad:	74 eb                	je     80189a <ipc_recv+0x76>
+            *perm_store = 0;
+  8018af:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8018b6:	00 
+  8018b7:	eb e1                	jmp    80189a <ipc_recv+0x76>
+
+00000000008018b9 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8018b9:	55                   	push   %rbp
+  8018ba:	48 89 e5             	mov    %rsp,%rbp
+  8018bd:	41 57                	push   %r15
+  8018bf:	41 56                	push   %r14
+  8018c1:	41 55                	push   %r13
+  8018c3:	41 54                	push   %r12
+  8018c5:	53                   	push   %rbx
+  8018c6:	48 83 ec 18          	sub    $0x18,%rsp
+  8018ca:	41 89 fd             	mov    %edi,%r13d
+  8018cd:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8018d0:	48 89 d3             	mov    %rdx,%rbx
+  8018d3:	49 89 cc             	mov    %rcx,%r12
+  8018d6:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8018da:	48 85 d2             	test   %rdx,%rdx
+  8018dd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8018e4:	00 00 00 
+  8018e7:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8018eb:	49 be c0 14 80 00 00 	movabs $0x8014c0,%r14
+  8018f2:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  8018f5:	49 bf f3 10 80 00 00 	movabs $0x8010f3,%r15
+  8018fc:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8018ff:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  801902:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  801906:	4c 89 e1             	mov    %r12,%rcx
+  801909:	48 89 da             	mov    %rbx,%rdx
+  80190c:	44 89 ef             	mov    %r13d,%edi
+  80190f:	41 ff d6             	call   *%r14
+        if (res == 0)
+  801912:	85 c0                	test   %eax,%eax
+  801914:	74 34                	je     80194a <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  801916:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801919:	75 05                	jne    801920 <ipc_send+0x67>
+        sys_yield();
+  80191b:	41 ff d7             	call   *%r15
+    while (true) {
+  80191e:	eb df                	jmp    8018ff <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  801920:	48 ba e3 32 80 00 00 	movabs $0x8032e3,%rdx
+  801927:	00 00 00 
+  80192a:	be 3e 00 00 00       	mov    $0x3e,%esi
+  80192f:	48 bf fc 32 80 00 00 	movabs $0x8032fc,%rdi
+  801936:	00 00 00 
+  801939:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193e:	48 b9 7c 2c 80 00 00 	movabs $0x802c7c,%rcx
+  801945:	00 00 00 
+  801948:	ff d1                	call   *%rcx
+    }
+}
+  80194a:	48 83 c4 18          	add    $0x18,%rsp
+  80194e:	5b                   	pop    %rbx
+  80194f:	41 5c                	pop    %r12
+  801951:	41 5d                	pop    %r13
+  801953:	41 5e                	pop    %r14
+  801955:	41 5f                	pop    %r15
+  801957:	5d                   	pop    %rbp
+  801958:	c3                   	ret
+
+0000000000801959 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801959:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80195e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801965:	00 00 00 
+  801968:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  80196f:	48 01 ca             	add    %rcx,%rdx
+  801972:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  801978:	39 fa                	cmp    %edi,%edx
+  80197a:	74 12                	je     80198e <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80197c:	48 83 c0 01          	add    $0x1,%rax
+  801980:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801986:	75 e0                	jne    801968 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801988:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80198d:	c3                   	ret
+            return envs[i].env_id;
+  80198e:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  801995:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80199c:	00 00 00 
+  80199f:	48 01 d0             	add    %rdx,%rax
+  8019a2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8019a8:	c3                   	ret
+
+00000000008019a9 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019a9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019b0:	ff ff ff 
+  8019b3:	48 01 f8             	add    %rdi,%rax
+  8019b6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8019ba:	c3                   	ret
+
+00000000008019bb <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019bb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019c2:	ff ff ff 
+  8019c5:	48 01 f8             	add    %rdi,%rax
+  8019c8:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8019cc:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8019d2:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8019d6:	c3                   	ret
+
+00000000008019d7 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8019d7:	55                   	push   %rbp
+  8019d8:	48 89 e5             	mov    %rsp,%rbp
+  8019db:	41 57                	push   %r15
+  8019dd:	41 56                	push   %r14
+  8019df:	41 55                	push   %r13
+  8019e1:	41 54                	push   %r12
+  8019e3:	53                   	push   %rbx
+  8019e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8019e8:	49 89 ff             	mov    %rdi,%r15
+  8019eb:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019f0:	49 bd 55 29 80 00 00 	movabs $0x802955,%r13
+  8019f7:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8019fa:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801a00:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801a03:	48 89 df             	mov    %rbx,%rdi
+  801a06:	41 ff d5             	call   *%r13
+  801a09:	83 e0 04             	and    $0x4,%eax
+  801a0c:	74 17                	je     801a25 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801a0e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a15:	4c 39 f3             	cmp    %r14,%rbx
+  801a18:	75 e6                	jne    801a00 <fd_alloc+0x29>
+  801a1a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a20:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a25:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a28:	48 83 c4 08          	add    $0x8,%rsp
+  801a2c:	5b                   	pop    %rbx
+  801a2d:	41 5c                	pop    %r12
+  801a2f:	41 5d                	pop    %r13
+  801a31:	41 5e                	pop    %r14
+  801a33:	41 5f                	pop    %r15
+  801a35:	5d                   	pop    %rbp
+  801a36:	c3                   	ret
+
+0000000000801a37 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a37:	83 ff 1f             	cmp    $0x1f,%edi
+  801a3a:	77 39                	ja     801a75 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a3c:	55                   	push   %rbp
+  801a3d:	48 89 e5             	mov    %rsp,%rbp
+  801a40:	41 54                	push   %r12
+  801a42:	53                   	push   %rbx
+  801a43:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a46:	48 63 df             	movslq %edi,%rbx
+  801a49:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a50:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a54:	48 89 df             	mov    %rbx,%rdi
+  801a57:	48 b8 55 29 80 00 00 	movabs $0x802955,%rax
+  801a5e:	00 00 00 
+  801a61:	ff d0                	call   *%rax
+  801a63:	a8 04                	test   $0x4,%al
+  801a65:	74 14                	je     801a7b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a67:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a6b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a70:	5b                   	pop    %rbx
+  801a71:	41 5c                	pop    %r12
+  801a73:	5d                   	pop    %rbp
+  801a74:	c3                   	ret
+        return -E_INVAL;
+  801a75:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a7a:	c3                   	ret
+        return -E_INVAL;
+  801a7b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a80:	eb ee                	jmp    801a70 <fd_lookup+0x39>
+
+0000000000801a82 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a82:	55                   	push   %rbp
+  801a83:	48 89 e5             	mov    %rsp,%rbp
+  801a86:	41 54                	push   %r12
+  801a88:	53                   	push   %rbx
+  801a89:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a8c:	48 b8 a0 33 80 00 00 	movabs $0x8033a0,%rax
+  801a93:	00 00 00 
+  801a96:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801a9d:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801aa0:	39 3b                	cmp    %edi,(%rbx)
+  801aa2:	74 47                	je     801aeb <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801aa4:	48 83 c0 08          	add    $0x8,%rax
+  801aa8:	48 8b 18             	mov    (%rax),%rbx
+  801aab:	48 85 db             	test   %rbx,%rbx
+  801aae:	75 f0                	jne    801aa0 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ab0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ab7:	00 00 00 
+  801aba:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ac0:	89 fa                	mov    %edi,%edx
+  801ac2:	48 bf 08 33 80 00 00 	movabs $0x803308,%rdi
+  801ac9:	00 00 00 
+  801acc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad1:	48 b9 ad 02 80 00 00 	movabs $0x8002ad,%rcx
+  801ad8:	00 00 00 
+  801adb:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801add:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801ae2:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801ae6:	5b                   	pop    %rbx
+  801ae7:	41 5c                	pop    %r12
+  801ae9:	5d                   	pop    %rbp
+  801aea:	c3                   	ret
+            return 0;
+  801aeb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af0:	eb f0                	jmp    801ae2 <dev_lookup+0x60>
+
+0000000000801af2 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801af2:	55                   	push   %rbp
+  801af3:	48 89 e5             	mov    %rsp,%rbp
+  801af6:	41 55                	push   %r13
+  801af8:	41 54                	push   %r12
+  801afa:	53                   	push   %rbx
+  801afb:	48 83 ec 18          	sub    $0x18,%rsp
+  801aff:	48 89 fb             	mov    %rdi,%rbx
+  801b02:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b05:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b0c:	ff ff ff 
+  801b0f:	48 01 df             	add    %rbx,%rdi
+  801b12:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b16:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b1a:	48 b8 37 1a 80 00 00 	movabs $0x801a37,%rax
+  801b21:	00 00 00 
+  801b24:	ff d0                	call   *%rax
+  801b26:	41 89 c5             	mov    %eax,%r13d
+  801b29:	85 c0                	test   %eax,%eax
+  801b2b:	78 06                	js     801b33 <fd_close+0x41>
+  801b2d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b31:	74 1a                	je     801b4d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b33:	45 84 e4             	test   %r12b,%r12b
+  801b36:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b3b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b3f:	44 89 e8             	mov    %r13d,%eax
+  801b42:	48 83 c4 18          	add    $0x18,%rsp
+  801b46:	5b                   	pop    %rbx
+  801b47:	41 5c                	pop    %r12
+  801b49:	41 5d                	pop    %r13
+  801b4b:	5d                   	pop    %rbp
+  801b4c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b4d:	8b 3b                	mov    (%rbx),%edi
+  801b4f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b53:	48 b8 82 1a 80 00 00 	movabs $0x801a82,%rax
+  801b5a:	00 00 00 
+  801b5d:	ff d0                	call   *%rax
+  801b5f:	41 89 c5             	mov    %eax,%r13d
+  801b62:	85 c0                	test   %eax,%eax
+  801b64:	78 1b                	js     801b81 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b66:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b6a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b6e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b74:	48 85 c0             	test   %rax,%rax
+  801b77:	74 08                	je     801b81 <fd_close+0x8f>
+  801b79:	48 89 df             	mov    %rbx,%rdi
+  801b7c:	ff d0                	call   *%rax
+  801b7e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b81:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b86:	48 89 de             	mov    %rbx,%rsi
+  801b89:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b8e:	48 b8 4e 12 80 00 00 	movabs $0x80124e,%rax
+  801b95:	00 00 00 
+  801b98:	ff d0                	call   *%rax
+    return res;
+  801b9a:	eb a3                	jmp    801b3f <fd_close+0x4d>
+
+0000000000801b9c <close>:
+
+int
+close(int fdnum) {
+  801b9c:	55                   	push   %rbp
+  801b9d:	48 89 e5             	mov    %rsp,%rbp
+  801ba0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801ba4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ba8:	48 b8 37 1a 80 00 00 	movabs $0x801a37,%rax
+  801baf:	00 00 00 
+  801bb2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801bb4:	85 c0                	test   %eax,%eax
+  801bb6:	78 15                	js     801bcd <close+0x31>
+
+    return fd_close(fd, 1);
+  801bb8:	be 01 00 00 00       	mov    $0x1,%esi
+  801bbd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801bc1:	48 b8 f2 1a 80 00 00 	movabs $0x801af2,%rax
+  801bc8:	00 00 00 
+  801bcb:	ff d0                	call   *%rax
+}
+  801bcd:	c9                   	leave
+  801bce:	c3                   	ret
+
+0000000000801bcf <close_all>:
+
+void
+close_all(void) {
+  801bcf:	55                   	push   %rbp
+  801bd0:	48 89 e5             	mov    %rsp,%rbp
+  801bd3:	41 54                	push   %r12
+  801bd5:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801bd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bdb:	49 bc 9c 1b 80 00 00 	movabs $0x801b9c,%r12
+  801be2:	00 00 00 
+  801be5:	89 df                	mov    %ebx,%edi
+  801be7:	41 ff d4             	call   *%r12
+  801bea:	83 c3 01             	add    $0x1,%ebx
+  801bed:	83 fb 20             	cmp    $0x20,%ebx
+  801bf0:	75 f3                	jne    801be5 <close_all+0x16>
+}
+  801bf2:	5b                   	pop    %rbx
+  801bf3:	41 5c                	pop    %r12
+  801bf5:	5d                   	pop    %rbp
+  801bf6:	c3                   	ret
+
+0000000000801bf7 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801bf7:	55                   	push   %rbp
+  801bf8:	48 89 e5             	mov    %rsp,%rbp
+  801bfb:	41 57                	push   %r15
+  801bfd:	41 56                	push   %r14
+  801bff:	41 55                	push   %r13
+  801c01:	41 54                	push   %r12
+  801c03:	53                   	push   %rbx
+  801c04:	48 83 ec 18          	sub    $0x18,%rsp
+  801c08:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c0b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c0f:	48 b8 37 1a 80 00 00 	movabs $0x801a37,%rax
+  801c16:	00 00 00 
+  801c19:	ff d0                	call   *%rax
+  801c1b:	89 c3                	mov    %eax,%ebx
+  801c1d:	85 c0                	test   %eax,%eax
+  801c1f:	0f 88 b8 00 00 00    	js     801cdd <dup+0xe6>
+    close(newfdnum);
+  801c25:	44 89 e7             	mov    %r12d,%edi
+  801c28:	48 b8 9c 1b 80 00 00 	movabs $0x801b9c,%rax
+  801c2f:	00 00 00 
+  801c32:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c34:	4d 63 ec             	movslq %r12d,%r13
+  801c37:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c3e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c42:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c46:	4c 89 ff             	mov    %r15,%rdi
+  801c49:	49 be bb 19 80 00 00 	movabs $0x8019bb,%r14
+  801c50:	00 00 00 
+  801c53:	41 ff d6             	call   *%r14
+  801c56:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c59:	4c 89 ef             	mov    %r13,%rdi
+  801c5c:	41 ff d6             	call   *%r14
+  801c5f:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c62:	48 89 df             	mov    %rbx,%rdi
+  801c65:	48 b8 55 29 80 00 00 	movabs $0x802955,%rax
+  801c6c:	00 00 00 
+  801c6f:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c71:	a8 04                	test   $0x4,%al
+  801c73:	74 2b                	je     801ca0 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c75:	41 89 c1             	mov    %eax,%r9d
+  801c78:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c7e:	4c 89 f1             	mov    %r14,%rcx
+  801c81:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c86:	48 89 de             	mov    %rbx,%rsi
+  801c89:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c8e:	48 b8 e9 11 80 00 00 	movabs $0x8011e9,%rax
+  801c95:	00 00 00 
+  801c98:	ff d0                	call   *%rax
+  801c9a:	89 c3                	mov    %eax,%ebx
+  801c9c:	85 c0                	test   %eax,%eax
+  801c9e:	78 4e                	js     801cee <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801ca0:	4c 89 ff             	mov    %r15,%rdi
+  801ca3:	48 b8 55 29 80 00 00 	movabs $0x802955,%rax
+  801caa:	00 00 00 
+  801cad:	ff d0                	call   *%rax
+  801caf:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801cb2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cb8:	4c 89 e9             	mov    %r13,%rcx
+  801cbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc0:	4c 89 fe             	mov    %r15,%rsi
+  801cc3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc8:	48 b8 e9 11 80 00 00 	movabs $0x8011e9,%rax
+  801ccf:	00 00 00 
+  801cd2:	ff d0                	call   *%rax
+  801cd4:	89 c3                	mov    %eax,%ebx
+  801cd6:	85 c0                	test   %eax,%eax
+  801cd8:	78 14                	js     801cee <dup+0xf7>
+
+    return newfdnum;
+  801cda:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801cdd:	89 d8                	mov    %ebx,%eax
+  801cdf:	48 83 c4 18          	add    $0x18,%rsp
+  801ce3:	5b                   	pop    %rbx
+  801ce4:	41 5c                	pop    %r12
+  801ce6:	41 5d                	pop    %r13
+  801ce8:	41 5e                	pop    %r14
+  801cea:	41 5f                	pop    %r15
+  801cec:	5d                   	pop    %rbp
+  801ced:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801cee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cf3:	4c 89 ee             	mov    %r13,%rsi
+  801cf6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cfb:	49 bc 4e 12 80 00 00 	movabs $0x80124e,%r12
+  801d02:	00 00 00 
+  801d05:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d08:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d0d:	4c 89 f6             	mov    %r14,%rsi
+  801d10:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d15:	41 ff d4             	call   *%r12
+    return res;
+  801d18:	eb c3                	jmp    801cdd <dup+0xe6>
+
+0000000000801d1a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d1a:	55                   	push   %rbp
+  801d1b:	48 89 e5             	mov    %rsp,%rbp
+  801d1e:	41 56                	push   %r14
+  801d20:	41 55                	push   %r13
+  801d22:	41 54                	push   %r12
+  801d24:	53                   	push   %rbx
+  801d25:	48 83 ec 10          	sub    $0x10,%rsp
+  801d29:	89 fb                	mov    %edi,%ebx
+  801d2b:	49 89 f4             	mov    %rsi,%r12
+  801d2e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d31:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d35:	48 b8 37 1a 80 00 00 	movabs $0x801a37,%rax
+  801d3c:	00 00 00 
+  801d3f:	ff d0                	call   *%rax
+  801d41:	85 c0                	test   %eax,%eax
+  801d43:	78 4c                	js     801d91 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d45:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d49:	41 8b 3e             	mov    (%r14),%edi
+  801d4c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d50:	48 b8 82 1a 80 00 00 	movabs $0x801a82,%rax
+  801d57:	00 00 00 
+  801d5a:	ff d0                	call   *%rax
+  801d5c:	85 c0                	test   %eax,%eax
+  801d5e:	78 35                	js     801d95 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d60:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d64:	83 e0 03             	and    $0x3,%eax
+  801d67:	83 f8 01             	cmp    $0x1,%eax
+  801d6a:	74 2d                	je     801d99 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d6c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d70:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d74:	48 85 c0             	test   %rax,%rax
+  801d77:	74 56                	je     801dcf <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d79:	4c 89 ea             	mov    %r13,%rdx
+  801d7c:	4c 89 e6             	mov    %r12,%rsi
+  801d7f:	4c 89 f7             	mov    %r14,%rdi
+  801d82:	ff d0                	call   *%rax
+}
+  801d84:	48 83 c4 10          	add    $0x10,%rsp
+  801d88:	5b                   	pop    %rbx
+  801d89:	41 5c                	pop    %r12
+  801d8b:	41 5d                	pop    %r13
+  801d8d:	41 5e                	pop    %r14
+  801d8f:	5d                   	pop    %rbp
+  801d90:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d91:	48 98                	cltq
+  801d93:	eb ef                	jmp    801d84 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d95:	48 98                	cltq
+  801d97:	eb eb                	jmp    801d84 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d99:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801da0:	00 00 00 
+  801da3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801da9:	89 da                	mov    %ebx,%edx
+  801dab:	48 bf 49 33 80 00 00 	movabs $0x803349,%rdi
+  801db2:	00 00 00 
+  801db5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dba:	48 b9 ad 02 80 00 00 	movabs $0x8002ad,%rcx
+  801dc1:	00 00 00 
+  801dc4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801dc6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dcd:	eb b5                	jmp    801d84 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dcf:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dd6:	eb ac                	jmp    801d84 <read+0x6a>
+
+0000000000801dd8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801dd8:	55                   	push   %rbp
+  801dd9:	48 89 e5             	mov    %rsp,%rbp
+  801ddc:	41 57                	push   %r15
+  801dde:	41 56                	push   %r14
+  801de0:	41 55                	push   %r13
+  801de2:	41 54                	push   %r12
+  801de4:	53                   	push   %rbx
+  801de5:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801de9:	48 85 d2             	test   %rdx,%rdx
+  801dec:	74 54                	je     801e42 <readn+0x6a>
+  801dee:	41 89 fd             	mov    %edi,%r13d
+  801df1:	49 89 f6             	mov    %rsi,%r14
+  801df4:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801df7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801dfc:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e01:	49 bf 1a 1d 80 00 00 	movabs $0x801d1a,%r15
+  801e08:	00 00 00 
+  801e0b:	4c 89 e2             	mov    %r12,%rdx
+  801e0e:	48 29 f2             	sub    %rsi,%rdx
+  801e11:	4c 01 f6             	add    %r14,%rsi
+  801e14:	44 89 ef             	mov    %r13d,%edi
+  801e17:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e1a:	85 c0                	test   %eax,%eax
+  801e1c:	78 20                	js     801e3e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e1e:	01 c3                	add    %eax,%ebx
+  801e20:	85 c0                	test   %eax,%eax
+  801e22:	74 08                	je     801e2c <readn+0x54>
+  801e24:	48 63 f3             	movslq %ebx,%rsi
+  801e27:	4c 39 e6             	cmp    %r12,%rsi
+  801e2a:	72 df                	jb     801e0b <readn+0x33>
+    }
+    return res;
+  801e2c:	48 63 c3             	movslq %ebx,%rax
+}
+  801e2f:	48 83 c4 08          	add    $0x8,%rsp
+  801e33:	5b                   	pop    %rbx
+  801e34:	41 5c                	pop    %r12
+  801e36:	41 5d                	pop    %r13
+  801e38:	41 5e                	pop    %r14
+  801e3a:	41 5f                	pop    %r15
+  801e3c:	5d                   	pop    %rbp
+  801e3d:	c3                   	ret
+        if (inc < 0) return inc;
+  801e3e:	48 98                	cltq
+  801e40:	eb ed                	jmp    801e2f <readn+0x57>
+    int inc = 1, res = 0;
+  801e42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e47:	eb e3                	jmp    801e2c <readn+0x54>
+
+0000000000801e49 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e49:	55                   	push   %rbp
+  801e4a:	48 89 e5             	mov    %rsp,%rbp
+  801e4d:	41 56                	push   %r14
+  801e4f:	41 55                	push   %r13
+  801e51:	41 54                	push   %r12
+  801e53:	53                   	push   %rbx
+  801e54:	48 83 ec 10          	sub    $0x10,%rsp
+  801e58:	89 fb                	mov    %edi,%ebx
+  801e5a:	49 89 f4             	mov    %rsi,%r12
+  801e5d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e60:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e64:	48 b8 37 1a 80 00 00 	movabs $0x801a37,%rax
+  801e6b:	00 00 00 
+  801e6e:	ff d0                	call   *%rax
+  801e70:	85 c0                	test   %eax,%eax
+  801e72:	78 47                	js     801ebb <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e74:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e78:	41 8b 3e             	mov    (%r14),%edi
+  801e7b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e7f:	48 b8 82 1a 80 00 00 	movabs $0x801a82,%rax
+  801e86:	00 00 00 
+  801e89:	ff d0                	call   *%rax
+  801e8b:	85 c0                	test   %eax,%eax
+  801e8d:	78 30                	js     801ebf <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e8f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e94:	74 2d                	je     801ec3 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e96:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e9a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e9e:	48 85 c0             	test   %rax,%rax
+  801ea1:	74 56                	je     801ef9 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801ea3:	4c 89 ea             	mov    %r13,%rdx
+  801ea6:	4c 89 e6             	mov    %r12,%rsi
+  801ea9:	4c 89 f7             	mov    %r14,%rdi
+  801eac:	ff d0                	call   *%rax
+}
+  801eae:	48 83 c4 10          	add    $0x10,%rsp
+  801eb2:	5b                   	pop    %rbx
+  801eb3:	41 5c                	pop    %r12
+  801eb5:	41 5d                	pop    %r13
+  801eb7:	41 5e                	pop    %r14
+  801eb9:	5d                   	pop    %rbp
+  801eba:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ebb:	48 98                	cltq
+  801ebd:	eb ef                	jmp    801eae <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ebf:	48 98                	cltq
+  801ec1:	eb eb                	jmp    801eae <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ec3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801eca:	00 00 00 
+  801ecd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ed3:	89 da                	mov    %ebx,%edx
+  801ed5:	48 bf 65 33 80 00 00 	movabs $0x803365,%rdi
+  801edc:	00 00 00 
+  801edf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee4:	48 b9 ad 02 80 00 00 	movabs $0x8002ad,%rcx
+  801eeb:	00 00 00 
+  801eee:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ef0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ef7:	eb b5                	jmp    801eae <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ef9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f00:	eb ac                	jmp    801eae <write+0x65>
+
+0000000000801f02 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f02:	55                   	push   %rbp
+  801f03:	48 89 e5             	mov    %rsp,%rbp
+  801f06:	53                   	push   %rbx
+  801f07:	48 83 ec 18          	sub    $0x18,%rsp
+  801f0b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f0d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f11:	48 b8 37 1a 80 00 00 	movabs $0x801a37,%rax
+  801f18:	00 00 00 
+  801f1b:	ff d0                	call   *%rax
+  801f1d:	85 c0                	test   %eax,%eax
+  801f1f:	78 0c                	js     801f2d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f25:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f2d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f31:	c9                   	leave
+  801f32:	c3                   	ret
+
+0000000000801f33 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f33:	55                   	push   %rbp
+  801f34:	48 89 e5             	mov    %rsp,%rbp
+  801f37:	41 55                	push   %r13
+  801f39:	41 54                	push   %r12
+  801f3b:	53                   	push   %rbx
+  801f3c:	48 83 ec 18          	sub    $0x18,%rsp
+  801f40:	89 fb                	mov    %edi,%ebx
+  801f42:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f45:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f49:	48 b8 37 1a 80 00 00 	movabs $0x801a37,%rax
+  801f50:	00 00 00 
+  801f53:	ff d0                	call   *%rax
+  801f55:	85 c0                	test   %eax,%eax
+  801f57:	78 38                	js     801f91 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f59:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f5d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f61:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f65:	48 b8 82 1a 80 00 00 	movabs $0x801a82,%rax
+  801f6c:	00 00 00 
+  801f6f:	ff d0                	call   *%rax
+  801f71:	85 c0                	test   %eax,%eax
+  801f73:	78 1c                	js     801f91 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f75:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f7a:	74 20                	je     801f9c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f7c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f80:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f84:	48 85 c0             	test   %rax,%rax
+  801f87:	74 47                	je     801fd0 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f89:	44 89 e6             	mov    %r12d,%esi
+  801f8c:	4c 89 ef             	mov    %r13,%rdi
+  801f8f:	ff d0                	call   *%rax
+}
+  801f91:	48 83 c4 18          	add    $0x18,%rsp
+  801f95:	5b                   	pop    %rbx
+  801f96:	41 5c                	pop    %r12
+  801f98:	41 5d                	pop    %r13
+  801f9a:	5d                   	pop    %rbp
+  801f9b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f9c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801fa3:	00 00 00 
+  801fa6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801fac:	89 da                	mov    %ebx,%edx
+  801fae:	48 bf 28 33 80 00 00 	movabs $0x803328,%rdi
+  801fb5:	00 00 00 
+  801fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fbd:	48 b9 ad 02 80 00 00 	movabs $0x8002ad,%rcx
+  801fc4:	00 00 00 
+  801fc7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fc9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fce:	eb c1                	jmp    801f91 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fd0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fd5:	eb ba                	jmp    801f91 <ftruncate+0x5e>
+
+0000000000801fd7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801fd7:	55                   	push   %rbp
+  801fd8:	48 89 e5             	mov    %rsp,%rbp
+  801fdb:	41 54                	push   %r12
+  801fdd:	53                   	push   %rbx
+  801fde:	48 83 ec 10          	sub    $0x10,%rsp
+  801fe2:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fe5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fe9:	48 b8 37 1a 80 00 00 	movabs $0x801a37,%rax
+  801ff0:	00 00 00 
+  801ff3:	ff d0                	call   *%rax
+  801ff5:	85 c0                	test   %eax,%eax
+  801ff7:	78 4e                	js     802047 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ff9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ffd:	41 8b 3c 24          	mov    (%r12),%edi
+  802001:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802005:	48 b8 82 1a 80 00 00 	movabs $0x801a82,%rax
+  80200c:	00 00 00 
+  80200f:	ff d0                	call   *%rax
+  802011:	85 c0                	test   %eax,%eax
+  802013:	78 32                	js     802047 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802015:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802019:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80201e:	74 30                	je     802050 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802020:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802023:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80202a:	00 00 00 
+    stat->st_isdir = 0;
+  80202d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802034:	00 00 00 
+    stat->st_dev = dev;
+  802037:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80203e:	48 89 de             	mov    %rbx,%rsi
+  802041:	4c 89 e7             	mov    %r12,%rdi
+  802044:	ff 50 28             	call   *0x28(%rax)
+}
+  802047:	48 83 c4 10          	add    $0x10,%rsp
+  80204b:	5b                   	pop    %rbx
+  80204c:	41 5c                	pop    %r12
+  80204e:	5d                   	pop    %rbp
+  80204f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802050:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802055:	eb f0                	jmp    802047 <fstat+0x70>
+
+0000000000802057 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802057:	55                   	push   %rbp
+  802058:	48 89 e5             	mov    %rsp,%rbp
+  80205b:	41 54                	push   %r12
+  80205d:	53                   	push   %rbx
+  80205e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802061:	be 00 00 00 00       	mov    $0x0,%esi
+  802066:	48 b8 d8 22 80 00 00 	movabs $0x8022d8,%rax
+  80206d:	00 00 00 
+  802070:	ff d0                	call   *%rax
+  802072:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802074:	85 c0                	test   %eax,%eax
+  802076:	78 25                	js     80209d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802078:	4c 89 e6             	mov    %r12,%rsi
+  80207b:	89 c7                	mov    %eax,%edi
+  80207d:	48 b8 d7 1f 80 00 00 	movabs $0x801fd7,%rax
+  802084:	00 00 00 
+  802087:	ff d0                	call   *%rax
+  802089:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80208c:	89 df                	mov    %ebx,%edi
+  80208e:	48 b8 9c 1b 80 00 00 	movabs $0x801b9c,%rax
+  802095:	00 00 00 
+  802098:	ff d0                	call   *%rax
+
+    return res;
+  80209a:	44 89 e3             	mov    %r12d,%ebx
+}
+  80209d:	89 d8                	mov    %ebx,%eax
+  80209f:	5b                   	pop    %rbx
+  8020a0:	41 5c                	pop    %r12
+  8020a2:	5d                   	pop    %rbp
+  8020a3:	c3                   	ret
+
+00000000008020a4 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  8020a4:	55                   	push   %rbp
+  8020a5:	48 89 e5             	mov    %rsp,%rbp
+  8020a8:	41 54                	push   %r12
+  8020aa:	53                   	push   %rbx
+  8020ab:	48 83 ec 10          	sub    $0x10,%rsp
+  8020af:	41 89 fc             	mov    %edi,%r12d
+  8020b2:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020b5:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020bc:	00 00 00 
+  8020bf:	83 38 00             	cmpl   $0x0,(%rax)
+  8020c2:	74 5e                	je     802122 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8020c4:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020ca:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020cf:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8020d6:	00 00 00 
+  8020d9:	44 89 e6             	mov    %r12d,%esi
+  8020dc:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020e3:	00 00 00 
+  8020e6:	8b 38                	mov    (%rax),%edi
+  8020e8:	48 b8 b9 18 80 00 00 	movabs $0x8018b9,%rax
+  8020ef:	00 00 00 
+  8020f2:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8020f4:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8020fb:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8020fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802101:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802105:	48 89 de             	mov    %rbx,%rsi
+  802108:	bf 00 00 00 00       	mov    $0x0,%edi
+  80210d:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  802114:	00 00 00 
+  802117:	ff d0                	call   *%rax
+}
+  802119:	48 83 c4 10          	add    $0x10,%rsp
+  80211d:	5b                   	pop    %rbx
+  80211e:	41 5c                	pop    %r12
+  802120:	5d                   	pop    %rbp
+  802121:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802122:	bf 03 00 00 00       	mov    $0x3,%edi
+  802127:	48 b8 59 19 80 00 00 	movabs $0x801959,%rax
+  80212e:	00 00 00 
+  802131:	ff d0                	call   *%rax
+  802133:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80213a:	00 00 
+  80213c:	eb 86                	jmp    8020c4 <fsipc+0x20>
+
+000000000080213e <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80213e:	55                   	push   %rbp
+  80213f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802142:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802149:	00 00 00 
+  80214c:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80214f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802151:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802154:	be 00 00 00 00       	mov    $0x0,%esi
+  802159:	bf 02 00 00 00       	mov    $0x2,%edi
+  80215e:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  802165:	00 00 00 
+  802168:	ff d0                	call   *%rax
+}
+  80216a:	5d                   	pop    %rbp
+  80216b:	c3                   	ret
+
+000000000080216c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80216c:	55                   	push   %rbp
+  80216d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802170:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802173:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80217a:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80217c:	be 00 00 00 00       	mov    $0x0,%esi
+  802181:	bf 06 00 00 00       	mov    $0x6,%edi
+  802186:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  80218d:	00 00 00 
+  802190:	ff d0                	call   *%rax
+}
+  802192:	5d                   	pop    %rbp
+  802193:	c3                   	ret
+
+0000000000802194 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802194:	55                   	push   %rbp
+  802195:	48 89 e5             	mov    %rsp,%rbp
+  802198:	41 54                	push   %r12
+  80219a:	53                   	push   %rbx
+  80219b:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80219e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8021a1:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021a8:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8021aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8021af:	bf 05 00 00 00       	mov    $0x5,%edi
+  8021b4:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  8021bb:	00 00 00 
+  8021be:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021c0:	85 c0                	test   %eax,%eax
+  8021c2:	78 3d                	js     802201 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021c4:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8021cb:	00 00 00 
+  8021ce:	4c 89 e6             	mov    %r12,%rsi
+  8021d1:	48 89 df             	mov    %rbx,%rdi
+  8021d4:	48 b8 d2 0b 80 00 00 	movabs $0x800bd2,%rax
+  8021db:	00 00 00 
+  8021de:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8021e0:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8021e7:	00 
+  8021e8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021ee:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8021f5:	00 
+  8021f6:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8021fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802201:	5b                   	pop    %rbx
+  802202:	41 5c                	pop    %r12
+  802204:	5d                   	pop    %rbp
+  802205:	c3                   	ret
+
+0000000000802206 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802206:	55                   	push   %rbp
+  802207:	48 89 e5             	mov    %rsp,%rbp
+  80220a:	41 54                	push   %r12
+  80220c:	53                   	push   %rbx
+  80220d:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  802210:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802215:	48 39 c2             	cmp    %rax,%rdx
+  802218:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80221c:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80221f:	48 89 c2             	mov    %rax,%rdx
+  802222:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802229:	00 00 00 
+  80222c:	48 b8 33 0e 80 00 00 	movabs $0x800e33,%rax
+  802233:	00 00 00 
+  802236:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802238:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80223f:	00 00 00 
+  802242:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802247:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802249:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  80224d:	be 00 00 00 00       	mov    $0x0,%esi
+  802252:	bf 04 00 00 00       	mov    $0x4,%edi
+  802257:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  80225e:	00 00 00 
+  802261:	ff d0                	call   *%rax
+  802263:	48 98                	cltq
+}
+  802265:	5b                   	pop    %rbx
+  802266:	41 5c                	pop    %r12
+  802268:	5d                   	pop    %rbp
+  802269:	c3                   	ret
+
+000000000080226a <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80226a:	55                   	push   %rbp
+  80226b:	48 89 e5             	mov    %rsp,%rbp
+  80226e:	41 54                	push   %r12
+  802270:	53                   	push   %rbx
+  802271:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802274:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80227b:	00 00 00 
+  80227e:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802281:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  802283:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802288:	48 39 ca             	cmp    %rcx,%rdx
+  80228b:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  80228f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  802293:	be 00 00 00 00       	mov    $0x0,%esi
+  802298:	bf 03 00 00 00       	mov    $0x3,%edi
+  80229d:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  8022a4:	00 00 00 
+  8022a7:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  8022a9:	85 c0                	test   %eax,%eax
+  8022ab:	78 27                	js     8022d4 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  8022ad:	48 63 d8             	movslq %eax,%rbx
+  8022b0:	48 89 da             	mov    %rbx,%rdx
+  8022b3:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8022ba:	00 00 00 
+  8022bd:	4c 89 e7             	mov    %r12,%rdi
+  8022c0:	48 b8 33 0e 80 00 00 	movabs $0x800e33,%rax
+  8022c7:	00 00 00 
+  8022ca:	ff d0                	call   *%rax
+    return bytes_read;
+  8022cc:	48 89 d8             	mov    %rbx,%rax
+}
+  8022cf:	5b                   	pop    %rbx
+  8022d0:	41 5c                	pop    %r12
+  8022d2:	5d                   	pop    %rbp
+  8022d3:	c3                   	ret
+        return bytes_read;
+  8022d4:	48 98                	cltq
+  8022d6:	eb f7                	jmp    8022cf <devfile_read+0x65>
+
+00000000008022d8 <open>:
+open(const char *path, int mode) {
+  8022d8:	55                   	push   %rbp
+  8022d9:	48 89 e5             	mov    %rsp,%rbp
+  8022dc:	41 55                	push   %r13
+  8022de:	41 54                	push   %r12
+  8022e0:	53                   	push   %rbx
+  8022e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8022e5:	49 89 fc             	mov    %rdi,%r12
+  8022e8:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8022eb:	48 b8 94 0b 80 00 00 	movabs $0x800b94,%rax
+  8022f2:	00 00 00 
+  8022f5:	ff d0                	call   *%rax
+  8022f7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8022fd:	0f 87 8a 00 00 00    	ja     80238d <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802303:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802307:	48 b8 d7 19 80 00 00 	movabs $0x8019d7,%rax
+  80230e:	00 00 00 
+  802311:	ff d0                	call   *%rax
+  802313:	89 c3                	mov    %eax,%ebx
+  802315:	85 c0                	test   %eax,%eax
+  802317:	78 50                	js     802369 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802319:	4c 89 e6             	mov    %r12,%rsi
+  80231c:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802323:	00 00 00 
+  802326:	48 89 df             	mov    %rbx,%rdi
+  802329:	48 b8 d2 0b 80 00 00 	movabs $0x800bd2,%rax
+  802330:	00 00 00 
+  802333:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802335:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80233c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802340:	bf 01 00 00 00       	mov    $0x1,%edi
+  802345:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  80234c:	00 00 00 
+  80234f:	ff d0                	call   *%rax
+  802351:	89 c3                	mov    %eax,%ebx
+  802353:	85 c0                	test   %eax,%eax
+  802355:	78 1f                	js     802376 <open+0x9e>
+    return fd2num(fd);
+  802357:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80235b:	48 b8 a9 19 80 00 00 	movabs $0x8019a9,%rax
+  802362:	00 00 00 
+  802365:	ff d0                	call   *%rax
+  802367:	89 c3                	mov    %eax,%ebx
+}
+  802369:	89 d8                	mov    %ebx,%eax
+  80236b:	48 83 c4 18          	add    $0x18,%rsp
+  80236f:	5b                   	pop    %rbx
+  802370:	41 5c                	pop    %r12
+  802372:	41 5d                	pop    %r13
+  802374:	5d                   	pop    %rbp
+  802375:	c3                   	ret
+        fd_close(fd, 0);
+  802376:	be 00 00 00 00       	mov    $0x0,%esi
+  80237b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80237f:	48 b8 f2 1a 80 00 00 	movabs $0x801af2,%rax
+  802386:	00 00 00 
+  802389:	ff d0                	call   *%rax
+        return res;
+  80238b:	eb dc                	jmp    802369 <open+0x91>
+        return -E_BAD_PATH;
+  80238d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802392:	eb d5                	jmp    802369 <open+0x91>
+
+0000000000802394 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802394:	55                   	push   %rbp
+  802395:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802398:	be 00 00 00 00       	mov    $0x0,%esi
+  80239d:	bf 08 00 00 00       	mov    $0x8,%edi
+  8023a2:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  8023a9:	00 00 00 
+  8023ac:	ff d0                	call   *%rax
+}
+  8023ae:	5d                   	pop    %rbp
+  8023af:	c3                   	ret
+
+00000000008023b0 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8023b0:	55                   	push   %rbp
+  8023b1:	48 89 e5             	mov    %rsp,%rbp
+  8023b4:	41 54                	push   %r12
+  8023b6:	53                   	push   %rbx
+  8023b7:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8023ba:	48 b8 bb 19 80 00 00 	movabs $0x8019bb,%rax
+  8023c1:	00 00 00 
+  8023c4:	ff d0                	call   *%rax
+  8023c6:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8023c9:	48 be c0 33 80 00 00 	movabs $0x8033c0,%rsi
+  8023d0:	00 00 00 
+  8023d3:	48 89 df             	mov    %rbx,%rdi
+  8023d6:	48 b8 d2 0b 80 00 00 	movabs $0x800bd2,%rax
+  8023dd:	00 00 00 
+  8023e0:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8023e2:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8023e7:	41 2b 04 24          	sub    (%r12),%eax
+  8023eb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8023f1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8023f8:	00 00 00 
+    stat->st_dev = &devpipe;
+  8023fb:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802402:	00 00 00 
+  802405:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80240c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802411:	5b                   	pop    %rbx
+  802412:	41 5c                	pop    %r12
+  802414:	5d                   	pop    %rbp
+  802415:	c3                   	ret
+
+0000000000802416 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802416:	55                   	push   %rbp
+  802417:	48 89 e5             	mov    %rsp,%rbp
+  80241a:	41 54                	push   %r12
+  80241c:	53                   	push   %rbx
+  80241d:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802420:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802425:	48 89 fe             	mov    %rdi,%rsi
+  802428:	bf 00 00 00 00       	mov    $0x0,%edi
+  80242d:	49 bc 4e 12 80 00 00 	movabs $0x80124e,%r12
+  802434:	00 00 00 
+  802437:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80243a:	48 89 df             	mov    %rbx,%rdi
+  80243d:	48 b8 bb 19 80 00 00 	movabs $0x8019bb,%rax
+  802444:	00 00 00 
+  802447:	ff d0                	call   *%rax
+  802449:	48 89 c6             	mov    %rax,%rsi
+  80244c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802451:	bf 00 00 00 00       	mov    $0x0,%edi
+  802456:	41 ff d4             	call   *%r12
+}
+  802459:	5b                   	pop    %rbx
+  80245a:	41 5c                	pop    %r12
+  80245c:	5d                   	pop    %rbp
+  80245d:	c3                   	ret
+
+000000000080245e <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80245e:	55                   	push   %rbp
+  80245f:	48 89 e5             	mov    %rsp,%rbp
+  802462:	41 57                	push   %r15
+  802464:	41 56                	push   %r14
+  802466:	41 55                	push   %r13
+  802468:	41 54                	push   %r12
+  80246a:	53                   	push   %rbx
+  80246b:	48 83 ec 18          	sub    $0x18,%rsp
+  80246f:	49 89 fc             	mov    %rdi,%r12
+  802472:	49 89 f5             	mov    %rsi,%r13
+  802475:	49 89 d7             	mov    %rdx,%r15
+  802478:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80247c:	48 b8 bb 19 80 00 00 	movabs $0x8019bb,%rax
+  802483:	00 00 00 
+  802486:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802488:	4d 85 ff             	test   %r15,%r15
+  80248b:	0f 84 af 00 00 00    	je     802540 <devpipe_write+0xe2>
+  802491:	48 89 c3             	mov    %rax,%rbx
+  802494:	4c 89 f8             	mov    %r15,%rax
+  802497:	4d 89 ef             	mov    %r13,%r15
+  80249a:	4c 01 e8             	add    %r13,%rax
+  80249d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8024a1:	49 bd 56 11 80 00 00 	movabs $0x801156,%r13
+  8024a8:	00 00 00 
+            sys_yield();
+  8024ab:	49 be f3 10 80 00 00 	movabs $0x8010f3,%r14
+  8024b2:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8024b5:	8b 73 04             	mov    0x4(%rbx),%esi
+  8024b8:	48 63 ce             	movslq %esi,%rcx
+  8024bb:	48 63 03             	movslq (%rbx),%rax
+  8024be:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8024c4:	48 39 c1             	cmp    %rax,%rcx
+  8024c7:	72 2e                	jb     8024f7 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8024c9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024ce:	48 89 da             	mov    %rbx,%rdx
+  8024d1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8024d6:	4c 89 e7             	mov    %r12,%rdi
+  8024d9:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8024dc:	85 c0                	test   %eax,%eax
+  8024de:	74 66                	je     802546 <devpipe_write+0xe8>
+            sys_yield();
+  8024e0:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8024e3:	8b 73 04             	mov    0x4(%rbx),%esi
+  8024e6:	48 63 ce             	movslq %esi,%rcx
+  8024e9:	48 63 03             	movslq (%rbx),%rax
+  8024ec:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8024f2:	48 39 c1             	cmp    %rax,%rcx
+  8024f5:	73 d2                	jae    8024c9 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8024f7:	41 0f b6 3f          	movzbl (%r15),%edi
+  8024fb:	48 89 ca             	mov    %rcx,%rdx
+  8024fe:	48 c1 ea 03          	shr    $0x3,%rdx
+  802502:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802509:	08 10 20 
+  80250c:	48 f7 e2             	mul    %rdx
+  80250f:	48 c1 ea 06          	shr    $0x6,%rdx
+  802513:	48 89 d0             	mov    %rdx,%rax
+  802516:	48 c1 e0 09          	shl    $0x9,%rax
+  80251a:	48 29 d0             	sub    %rdx,%rax
+  80251d:	48 c1 e0 03          	shl    $0x3,%rax
+  802521:	48 29 c1             	sub    %rax,%rcx
+  802524:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802529:	83 c6 01             	add    $0x1,%esi
+  80252c:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80252f:	49 83 c7 01          	add    $0x1,%r15
+  802533:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802537:	49 39 c7             	cmp    %rax,%r15
+  80253a:	0f 85 75 ff ff ff    	jne    8024b5 <devpipe_write+0x57>
+    return n;
+  802540:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802544:	eb 05                	jmp    80254b <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802546:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80254b:	48 83 c4 18          	add    $0x18,%rsp
+  80254f:	5b                   	pop    %rbx
+  802550:	41 5c                	pop    %r12
+  802552:	41 5d                	pop    %r13
+  802554:	41 5e                	pop    %r14
+  802556:	41 5f                	pop    %r15
+  802558:	5d                   	pop    %rbp
+  802559:	c3                   	ret
+
+000000000080255a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80255a:	55                   	push   %rbp
+  80255b:	48 89 e5             	mov    %rsp,%rbp
+  80255e:	41 57                	push   %r15
+  802560:	41 56                	push   %r14
+  802562:	41 55                	push   %r13
+  802564:	41 54                	push   %r12
+  802566:	53                   	push   %rbx
+  802567:	48 83 ec 18          	sub    $0x18,%rsp
+  80256b:	49 89 fc             	mov    %rdi,%r12
+  80256e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802572:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802576:	48 b8 bb 19 80 00 00 	movabs $0x8019bb,%rax
+  80257d:	00 00 00 
+  802580:	ff d0                	call   *%rax
+  802582:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802585:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80258b:	49 bd 56 11 80 00 00 	movabs $0x801156,%r13
+  802592:	00 00 00 
+            sys_yield();
+  802595:	49 be f3 10 80 00 00 	movabs $0x8010f3,%r14
+  80259c:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80259f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8025a4:	74 7d                	je     802623 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8025a6:	8b 03                	mov    (%rbx),%eax
+  8025a8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8025ab:	75 26                	jne    8025d3 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8025ad:	4d 85 ff             	test   %r15,%r15
+  8025b0:	75 77                	jne    802629 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025b2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025b7:	48 89 da             	mov    %rbx,%rdx
+  8025ba:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025bf:	4c 89 e7             	mov    %r12,%rdi
+  8025c2:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025c5:	85 c0                	test   %eax,%eax
+  8025c7:	74 72                	je     80263b <devpipe_read+0xe1>
+            sys_yield();
+  8025c9:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8025cc:	8b 03                	mov    (%rbx),%eax
+  8025ce:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8025d1:	74 df                	je     8025b2 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8025d3:	48 63 c8             	movslq %eax,%rcx
+  8025d6:	48 89 ca             	mov    %rcx,%rdx
+  8025d9:	48 c1 ea 03          	shr    $0x3,%rdx
+  8025dd:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8025e4:	08 10 20 
+  8025e7:	48 89 d0             	mov    %rdx,%rax
+  8025ea:	48 f7 e6             	mul    %rsi
+  8025ed:	48 c1 ea 06          	shr    $0x6,%rdx
+  8025f1:	48 89 d0             	mov    %rdx,%rax
+  8025f4:	48 c1 e0 09          	shl    $0x9,%rax
+  8025f8:	48 29 d0             	sub    %rdx,%rax
+  8025fb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802602:	00 
+  802603:	48 89 c8             	mov    %rcx,%rax
+  802606:	48 29 d0             	sub    %rdx,%rax
+  802609:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80260e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802612:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802616:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802619:	49 83 c7 01          	add    $0x1,%r15
+  80261d:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802621:	75 83                	jne    8025a6 <devpipe_read+0x4c>
+    return n;
+  802623:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802627:	eb 03                	jmp    80262c <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802629:	4c 89 f8             	mov    %r15,%rax
+}
+  80262c:	48 83 c4 18          	add    $0x18,%rsp
+  802630:	5b                   	pop    %rbx
+  802631:	41 5c                	pop    %r12
+  802633:	41 5d                	pop    %r13
+  802635:	41 5e                	pop    %r14
+  802637:	41 5f                	pop    %r15
+  802639:	5d                   	pop    %rbp
+  80263a:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80263b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802640:	eb ea                	jmp    80262c <devpipe_read+0xd2>
+
+0000000000802642 <pipe>:
+pipe(int pfd[2]) {
+  802642:	55                   	push   %rbp
+  802643:	48 89 e5             	mov    %rsp,%rbp
+  802646:	41 55                	push   %r13
+  802648:	41 54                	push   %r12
+  80264a:	53                   	push   %rbx
+  80264b:	48 83 ec 18          	sub    $0x18,%rsp
+  80264f:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802652:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802656:	48 b8 d7 19 80 00 00 	movabs $0x8019d7,%rax
+  80265d:	00 00 00 
+  802660:	ff d0                	call   *%rax
+  802662:	89 c3                	mov    %eax,%ebx
+  802664:	85 c0                	test   %eax,%eax
+  802666:	0f 88 a0 01 00 00    	js     80280c <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80266c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802671:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802676:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80267a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80267f:	48 b8 82 11 80 00 00 	movabs $0x801182,%rax
+  802686:	00 00 00 
+  802689:	ff d0                	call   *%rax
+  80268b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80268d:	85 c0                	test   %eax,%eax
+  80268f:	0f 88 77 01 00 00    	js     80280c <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802695:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802699:	48 b8 d7 19 80 00 00 	movabs $0x8019d7,%rax
+  8026a0:	00 00 00 
+  8026a3:	ff d0                	call   *%rax
+  8026a5:	89 c3                	mov    %eax,%ebx
+  8026a7:	85 c0                	test   %eax,%eax
+  8026a9:	0f 88 43 01 00 00    	js     8027f2 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8026af:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8026b4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026b9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8026bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026c2:	48 b8 82 11 80 00 00 	movabs $0x801182,%rax
+  8026c9:	00 00 00 
+  8026cc:	ff d0                	call   *%rax
+  8026ce:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8026d0:	85 c0                	test   %eax,%eax
+  8026d2:	0f 88 1a 01 00 00    	js     8027f2 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8026d8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8026dc:	48 b8 bb 19 80 00 00 	movabs $0x8019bb,%rax
+  8026e3:	00 00 00 
+  8026e6:	ff d0                	call   *%rax
+  8026e8:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8026eb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8026f0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026f5:	48 89 c6             	mov    %rax,%rsi
+  8026f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026fd:	48 b8 82 11 80 00 00 	movabs $0x801182,%rax
+  802704:	00 00 00 
+  802707:	ff d0                	call   *%rax
+  802709:	89 c3                	mov    %eax,%ebx
+  80270b:	85 c0                	test   %eax,%eax
+  80270d:	0f 88 c5 00 00 00    	js     8027d8 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802713:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802717:	48 b8 bb 19 80 00 00 	movabs $0x8019bb,%rax
+  80271e:	00 00 00 
+  802721:	ff d0                	call   *%rax
+  802723:	48 89 c1             	mov    %rax,%rcx
+  802726:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80272c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802732:	ba 00 00 00 00       	mov    $0x0,%edx
+  802737:	4c 89 ee             	mov    %r13,%rsi
+  80273a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80273f:	48 b8 e9 11 80 00 00 	movabs $0x8011e9,%rax
+  802746:	00 00 00 
+  802749:	ff d0                	call   *%rax
+  80274b:	89 c3                	mov    %eax,%ebx
+  80274d:	85 c0                	test   %eax,%eax
+  80274f:	78 6e                	js     8027bf <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802751:	be 00 10 00 00       	mov    $0x1000,%esi
+  802756:	4c 89 ef             	mov    %r13,%rdi
+  802759:	48 b8 24 11 80 00 00 	movabs $0x801124,%rax
+  802760:	00 00 00 
+  802763:	ff d0                	call   *%rax
+  802765:	83 f8 02             	cmp    $0x2,%eax
+  802768:	0f 85 ab 00 00 00    	jne    802819 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80276e:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802775:	00 00 
+  802777:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80277b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80277d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802781:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802788:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80278c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80278e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802792:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802799:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80279d:	48 bb a9 19 80 00 00 	movabs $0x8019a9,%rbx
+  8027a4:	00 00 00 
+  8027a7:	ff d3                	call   *%rbx
+  8027a9:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8027ad:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8027b1:	ff d3                	call   *%rbx
+  8027b3:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8027b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027bd:	eb 4d                	jmp    80280c <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8027bf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027c4:	4c 89 ee             	mov    %r13,%rsi
+  8027c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027cc:	48 b8 4e 12 80 00 00 	movabs $0x80124e,%rax
+  8027d3:	00 00 00 
+  8027d6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8027d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027dd:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027e6:	48 b8 4e 12 80 00 00 	movabs $0x80124e,%rax
+  8027ed:	00 00 00 
+  8027f0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8027f2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027f7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8027fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802800:	48 b8 4e 12 80 00 00 	movabs $0x80124e,%rax
+  802807:	00 00 00 
+  80280a:	ff d0                	call   *%rax
+}
+  80280c:	89 d8                	mov    %ebx,%eax
+  80280e:	48 83 c4 18          	add    $0x18,%rsp
+  802812:	5b                   	pop    %rbx
+  802813:	41 5c                	pop    %r12
+  802815:	41 5d                	pop    %r13
+  802817:	5d                   	pop    %rbp
+  802818:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802819:	48 b9 f0 33 80 00 00 	movabs $0x8033f0,%rcx
+  802820:	00 00 00 
+  802823:	48 ba c7 33 80 00 00 	movabs $0x8033c7,%rdx
+  80282a:	00 00 00 
+  80282d:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802832:	48 bf dc 33 80 00 00 	movabs $0x8033dc,%rdi
+  802839:	00 00 00 
+  80283c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802841:	49 b8 7c 2c 80 00 00 	movabs $0x802c7c,%r8
+  802848:	00 00 00 
+  80284b:	41 ff d0             	call   *%r8
+
+000000000080284e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80284e:	55                   	push   %rbp
+  80284f:	48 89 e5             	mov    %rsp,%rbp
+  802852:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802856:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80285a:	48 b8 37 1a 80 00 00 	movabs $0x801a37,%rax
+  802861:	00 00 00 
+  802864:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802866:	85 c0                	test   %eax,%eax
+  802868:	78 35                	js     80289f <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80286a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80286e:	48 b8 bb 19 80 00 00 	movabs $0x8019bb,%rax
+  802875:	00 00 00 
+  802878:	ff d0                	call   *%rax
+  80287a:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80287d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802882:	be 00 10 00 00       	mov    $0x1000,%esi
+  802887:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80288b:	48 b8 56 11 80 00 00 	movabs $0x801156,%rax
+  802892:	00 00 00 
+  802895:	ff d0                	call   *%rax
+  802897:	85 c0                	test   %eax,%eax
+  802899:	0f 94 c0             	sete   %al
+  80289c:	0f b6 c0             	movzbl %al,%eax
+}
+  80289f:	c9                   	leave
+  8028a0:	c3                   	ret
+
+00000000008028a1 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8028a1:	48 89 f8             	mov    %rdi,%rax
+  8028a4:	48 c1 e8 27          	shr    $0x27,%rax
+  8028a8:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8028af:	01 00 00 
+  8028b2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028b6:	f6 c2 01             	test   $0x1,%dl
+  8028b9:	74 6d                	je     802928 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8028bb:	48 89 f8             	mov    %rdi,%rax
+  8028be:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8028c2:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8028c9:	01 00 00 
+  8028cc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028d0:	f6 c2 01             	test   $0x1,%dl
+  8028d3:	74 62                	je     802937 <get_uvpt_entry+0x96>
+  8028d5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8028dc:	01 00 00 
+  8028df:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028e3:	f6 c2 80             	test   $0x80,%dl
+  8028e6:	75 4f                	jne    802937 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8028e8:	48 89 f8             	mov    %rdi,%rax
+  8028eb:	48 c1 e8 15          	shr    $0x15,%rax
+  8028ef:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8028f6:	01 00 00 
+  8028f9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028fd:	f6 c2 01             	test   $0x1,%dl
+  802900:	74 44                	je     802946 <get_uvpt_entry+0xa5>
+  802902:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802909:	01 00 00 
+  80290c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802910:	f6 c2 80             	test   $0x80,%dl
+  802913:	75 31                	jne    802946 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802915:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802919:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802920:	01 00 00 
+  802923:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802927:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802928:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80292f:	01 00 00 
+  802932:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802936:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802937:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80293e:	01 00 00 
+  802941:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802945:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802946:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80294d:	01 00 00 
+  802950:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802954:	c3                   	ret
+
+0000000000802955 <get_prot>:
+
+int
+get_prot(void *va) {
+  802955:	55                   	push   %rbp
+  802956:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802959:	48 b8 a1 28 80 00 00 	movabs $0x8028a1,%rax
+  802960:	00 00 00 
+  802963:	ff d0                	call   *%rax
+  802965:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802968:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80296d:	89 c1                	mov    %eax,%ecx
+  80296f:	83 c9 04             	or     $0x4,%ecx
+  802972:	f6 c2 01             	test   $0x1,%dl
+  802975:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802978:	89 c1                	mov    %eax,%ecx
+  80297a:	83 c9 02             	or     $0x2,%ecx
+  80297d:	f6 c2 02             	test   $0x2,%dl
+  802980:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802983:	89 c1                	mov    %eax,%ecx
+  802985:	83 c9 01             	or     $0x1,%ecx
+  802988:	48 85 d2             	test   %rdx,%rdx
+  80298b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80298e:	89 c1                	mov    %eax,%ecx
+  802990:	83 c9 40             	or     $0x40,%ecx
+  802993:	f6 c6 04             	test   $0x4,%dh
+  802996:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802999:	5d                   	pop    %rbp
+  80299a:	c3                   	ret
+
+000000000080299b <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80299b:	55                   	push   %rbp
+  80299c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80299f:	48 b8 a1 28 80 00 00 	movabs $0x8028a1,%rax
+  8029a6:	00 00 00 
+  8029a9:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8029ab:	48 c1 e8 06          	shr    $0x6,%rax
+  8029af:	83 e0 01             	and    $0x1,%eax
+}
+  8029b2:	5d                   	pop    %rbp
+  8029b3:	c3                   	ret
+
+00000000008029b4 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8029b4:	55                   	push   %rbp
+  8029b5:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8029b8:	48 b8 a1 28 80 00 00 	movabs $0x8028a1,%rax
+  8029bf:	00 00 00 
+  8029c2:	ff d0                	call   *%rax
+  8029c4:	83 e0 01             	and    $0x1,%eax
+}
+  8029c7:	5d                   	pop    %rbp
+  8029c8:	c3                   	ret
+
+00000000008029c9 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8029c9:	55                   	push   %rbp
+  8029ca:	48 89 e5             	mov    %rsp,%rbp
+  8029cd:	41 57                	push   %r15
+  8029cf:	41 56                	push   %r14
+  8029d1:	41 55                	push   %r13
+  8029d3:	41 54                	push   %r12
+  8029d5:	53                   	push   %rbx
+  8029d6:	48 83 ec 18          	sub    $0x18,%rsp
+  8029da:	49 89 ff             	mov    %rdi,%r15
+  8029dd:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8029e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  8029e6:	49 bc b4 29 80 00 00 	movabs $0x8029b4,%r12
+  8029ed:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  8029f0:	49 be 55 29 80 00 00 	movabs $0x802955,%r14
+  8029f7:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8029fa:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802a01:	00 00 00 
+  802a04:	eb 0c                	jmp    802a12 <foreach_shared_region+0x49>
+  802a06:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802a0d:	4c 39 eb             	cmp    %r13,%rbx
+  802a10:	74 38                	je     802a4a <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802a12:	48 89 df             	mov    %rbx,%rdi
+  802a15:	41 ff d4             	call   *%r12
+  802a18:	84 c0                	test   %al,%al
+  802a1a:	74 ea                	je     802a06 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802a1c:	48 89 df             	mov    %rbx,%rdi
+  802a1f:	41 ff d6             	call   *%r14
+  802a22:	a8 40                	test   $0x40,%al
+  802a24:	74 e0                	je     802a06 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802a26:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802a2d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802a31:	48 89 df             	mov    %rbx,%rdi
+  802a34:	41 ff d7             	call   *%r15
+        if (err)
+  802a37:	85 c0                	test   %eax,%eax
+  802a39:	74 cb                	je     802a06 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802a3b:	48 83 c4 18          	add    $0x18,%rsp
+  802a3f:	5b                   	pop    %rbx
+  802a40:	41 5c                	pop    %r12
+  802a42:	41 5d                	pop    %r13
+  802a44:	41 5e                	pop    %r14
+  802a46:	41 5f                	pop    %r15
+  802a48:	5d                   	pop    %rbp
+  802a49:	c3                   	ret
+    return 0;
+  802a4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4f:	eb ea                	jmp    802a3b <foreach_shared_region+0x72>
+
+0000000000802a51 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802a51:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a56:	c3                   	ret
+
+0000000000802a57 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802a57:	55                   	push   %rbp
+  802a58:	48 89 e5             	mov    %rsp,%rbp
+  802a5b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802a5e:	48 be 14 34 80 00 00 	movabs $0x803414,%rsi
+  802a65:	00 00 00 
+  802a68:	48 b8 d2 0b 80 00 00 	movabs $0x800bd2,%rax
+  802a6f:	00 00 00 
+  802a72:	ff d0                	call   *%rax
+    return 0;
+}
+  802a74:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a79:	5d                   	pop    %rbp
+  802a7a:	c3                   	ret
+
+0000000000802a7b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802a7b:	55                   	push   %rbp
+  802a7c:	48 89 e5             	mov    %rsp,%rbp
+  802a7f:	41 57                	push   %r15
+  802a81:	41 56                	push   %r14
+  802a83:	41 55                	push   %r13
+  802a85:	41 54                	push   %r12
+  802a87:	53                   	push   %rbx
+  802a88:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802a8f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802a96:	48 85 d2             	test   %rdx,%rdx
+  802a99:	74 7a                	je     802b15 <devcons_write+0x9a>
+  802a9b:	49 89 d6             	mov    %rdx,%r14
+  802a9e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802aa4:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802aa9:	49 bf cc 0d 80 00 00 	movabs $0x800dcc,%r15
+  802ab0:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802ab3:	4c 89 f3             	mov    %r14,%rbx
+  802ab6:	48 29 f3             	sub    %rsi,%rbx
+  802ab9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802abe:	48 39 c3             	cmp    %rax,%rbx
+  802ac1:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802ac5:	4c 63 eb             	movslq %ebx,%r13
+  802ac8:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802acf:	48 01 c6             	add    %rax,%rsi
+  802ad2:	4c 89 ea             	mov    %r13,%rdx
+  802ad5:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802adc:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802adf:	4c 89 ee             	mov    %r13,%rsi
+  802ae2:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802ae9:	48 b8 f9 0f 80 00 00 	movabs $0x800ff9,%rax
+  802af0:	00 00 00 
+  802af3:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802af5:	41 01 dc             	add    %ebx,%r12d
+  802af8:	49 63 f4             	movslq %r12d,%rsi
+  802afb:	4c 39 f6             	cmp    %r14,%rsi
+  802afe:	72 b3                	jb     802ab3 <devcons_write+0x38>
+    return res;
+  802b00:	49 63 c4             	movslq %r12d,%rax
+}
+  802b03:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802b0a:	5b                   	pop    %rbx
+  802b0b:	41 5c                	pop    %r12
+  802b0d:	41 5d                	pop    %r13
+  802b0f:	41 5e                	pop    %r14
+  802b11:	41 5f                	pop    %r15
+  802b13:	5d                   	pop    %rbp
+  802b14:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802b15:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802b1b:	eb e3                	jmp    802b00 <devcons_write+0x85>
+
+0000000000802b1d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802b1d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802b20:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b25:	48 85 c0             	test   %rax,%rax
+  802b28:	74 55                	je     802b7f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802b2a:	55                   	push   %rbp
+  802b2b:	48 89 e5             	mov    %rsp,%rbp
+  802b2e:	41 55                	push   %r13
+  802b30:	41 54                	push   %r12
+  802b32:	53                   	push   %rbx
+  802b33:	48 83 ec 08          	sub    $0x8,%rsp
+  802b37:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802b3a:	48 bb 26 10 80 00 00 	movabs $0x801026,%rbx
+  802b41:	00 00 00 
+  802b44:	49 bc f3 10 80 00 00 	movabs $0x8010f3,%r12
+  802b4b:	00 00 00 
+  802b4e:	eb 03                	jmp    802b53 <devcons_read+0x36>
+  802b50:	41 ff d4             	call   *%r12
+  802b53:	ff d3                	call   *%rbx
+  802b55:	85 c0                	test   %eax,%eax
+  802b57:	74 f7                	je     802b50 <devcons_read+0x33>
+    if (c < 0) return c;
+  802b59:	48 63 d0             	movslq %eax,%rdx
+  802b5c:	78 13                	js     802b71 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802b5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b63:	83 f8 04             	cmp    $0x4,%eax
+  802b66:	74 09                	je     802b71 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802b68:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802b6c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802b71:	48 89 d0             	mov    %rdx,%rax
+  802b74:	48 83 c4 08          	add    $0x8,%rsp
+  802b78:	5b                   	pop    %rbx
+  802b79:	41 5c                	pop    %r12
+  802b7b:	41 5d                	pop    %r13
+  802b7d:	5d                   	pop    %rbp
+  802b7e:	c3                   	ret
+  802b7f:	48 89 d0             	mov    %rdx,%rax
+  802b82:	c3                   	ret
+
+0000000000802b83 <cputchar>:
+cputchar(int ch) {
+  802b83:	55                   	push   %rbp
+  802b84:	48 89 e5             	mov    %rsp,%rbp
+  802b87:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802b8b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802b8f:	be 01 00 00 00       	mov    $0x1,%esi
+  802b94:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802b98:	48 b8 f9 0f 80 00 00 	movabs $0x800ff9,%rax
+  802b9f:	00 00 00 
+  802ba2:	ff d0                	call   *%rax
+}
+  802ba4:	c9                   	leave
+  802ba5:	c3                   	ret
+
+0000000000802ba6 <getchar>:
+getchar(void) {
+  802ba6:	55                   	push   %rbp
+  802ba7:	48 89 e5             	mov    %rsp,%rbp
+  802baa:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802bae:	ba 01 00 00 00       	mov    $0x1,%edx
+  802bb3:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802bb7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bbc:	48 b8 1a 1d 80 00 00 	movabs $0x801d1a,%rax
+  802bc3:	00 00 00 
+  802bc6:	ff d0                	call   *%rax
+  802bc8:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802bca:	85 c0                	test   %eax,%eax
+  802bcc:	78 06                	js     802bd4 <getchar+0x2e>
+  802bce:	74 08                	je     802bd8 <getchar+0x32>
+  802bd0:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802bd4:	89 d0                	mov    %edx,%eax
+  802bd6:	c9                   	leave
+  802bd7:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802bd8:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802bdd:	eb f5                	jmp    802bd4 <getchar+0x2e>
+
+0000000000802bdf <iscons>:
+iscons(int fdnum) {
+  802bdf:	55                   	push   %rbp
+  802be0:	48 89 e5             	mov    %rsp,%rbp
+  802be3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802be7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802beb:	48 b8 37 1a 80 00 00 	movabs $0x801a37,%rax
+  802bf2:	00 00 00 
+  802bf5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bf7:	85 c0                	test   %eax,%eax
+  802bf9:	78 18                	js     802c13 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802bfb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bff:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802c06:	00 00 00 
+  802c09:	8b 00                	mov    (%rax),%eax
+  802c0b:	39 02                	cmp    %eax,(%rdx)
+  802c0d:	0f 94 c0             	sete   %al
+  802c10:	0f b6 c0             	movzbl %al,%eax
+}
+  802c13:	c9                   	leave
+  802c14:	c3                   	ret
+
+0000000000802c15 <opencons>:
+opencons(void) {
+  802c15:	55                   	push   %rbp
+  802c16:	48 89 e5             	mov    %rsp,%rbp
+  802c19:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802c1d:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802c21:	48 b8 d7 19 80 00 00 	movabs $0x8019d7,%rax
+  802c28:	00 00 00 
+  802c2b:	ff d0                	call   *%rax
+  802c2d:	85 c0                	test   %eax,%eax
+  802c2f:	78 49                	js     802c7a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802c31:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802c36:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c3b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802c3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c44:	48 b8 82 11 80 00 00 	movabs $0x801182,%rax
+  802c4b:	00 00 00 
+  802c4e:	ff d0                	call   *%rax
+  802c50:	85 c0                	test   %eax,%eax
+  802c52:	78 26                	js     802c7a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802c54:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c58:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802c5f:	00 00 
+  802c61:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802c63:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802c67:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802c6e:	48 b8 a9 19 80 00 00 	movabs $0x8019a9,%rax
+  802c75:	00 00 00 
+  802c78:	ff d0                	call   *%rax
+}
+  802c7a:	c9                   	leave
+  802c7b:	c3                   	ret
+
+0000000000802c7c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802c7c:	55                   	push   %rbp
+  802c7d:	48 89 e5             	mov    %rsp,%rbp
+  802c80:	41 56                	push   %r14
+  802c82:	41 55                	push   %r13
+  802c84:	41 54                	push   %r12
+  802c86:	53                   	push   %rbx
+  802c87:	48 83 ec 50          	sub    $0x50,%rsp
+  802c8b:	49 89 fc             	mov    %rdi,%r12
+  802c8e:	41 89 f5             	mov    %esi,%r13d
+  802c91:	48 89 d3             	mov    %rdx,%rbx
+  802c94:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c98:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802c9c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802ca0:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802ca7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802cab:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802caf:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802cb3:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802cb7:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802cbe:	00 00 00 
+  802cc1:	4c 8b 30             	mov    (%rax),%r14
+  802cc4:	48 b8 c2 10 80 00 00 	movabs $0x8010c2,%rax
+  802ccb:	00 00 00 
+  802cce:	ff d0                	call   *%rax
+  802cd0:	89 c6                	mov    %eax,%esi
+  802cd2:	45 89 e8             	mov    %r13d,%r8d
+  802cd5:	4c 89 e1             	mov    %r12,%rcx
+  802cd8:	4c 89 f2             	mov    %r14,%rdx
+  802cdb:	48 bf 20 34 80 00 00 	movabs $0x803420,%rdi
+  802ce2:	00 00 00 
+  802ce5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cea:	49 bc ad 02 80 00 00 	movabs $0x8002ad,%r12
+  802cf1:	00 00 00 
+  802cf4:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802cf7:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802cfb:	48 89 df             	mov    %rbx,%rdi
+  802cfe:	48 b8 49 02 80 00 00 	movabs $0x800249,%rax
+  802d05:	00 00 00 
+  802d08:	ff d0                	call   *%rax
+    cprintf("\n");
+  802d0a:	48 bf 63 33 80 00 00 	movabs $0x803363,%rdi
+  802d11:	00 00 00 
+  802d14:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d19:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802d1c:	cc                   	int3
+  802d1d:	eb fd                	jmp    802d1c <_panic+0xa0>
+  802d1f:	90                   	nop
+
+0000000000802d20 <__rodata_start>:
+  802d20:	73 65                	jae    802d87 <__rodata_start+0x67>
+  802d22:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d23:	64 20 30             	and    %dh,%fs:(%rax)
+  802d26:	20 66 72             	and    %ah,0x72(%rsi)
+  802d29:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d2a:	6d                   	insl   (%dx),%es:(%rdi)
+  802d2b:	20 25 78 20 74 6f    	and    %ah,0x6f742078(%rip)        # 6ff44da9 <__bss_end+0x6f73cda9>
+  802d31:	20 25 78 0a 00 25    	and    %ah,0x25000a78(%rip)        # 258037af <__bss_end+0x24ffb7af>
+  802d37:	78 20                	js     802d59 <__rodata_start+0x39>
+  802d39:	67 6f                	outsl  %ds:(%esi),(%dx)
+  802d3b:	74 20                	je     802d5d <__rodata_start+0x3d>
+  802d3d:	25 64 20 66 72       	and    $0x72662064,%eax
+  802d42:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d43:	6d                   	insl   (%dx),%es:(%rdi)
+  802d44:	20 25 78 0a 00 3c    	and    %ah,0x3c000a78(%rip)        # 3c8037c2 <__bss_end+0x3bffb7c2>
+  802d4a:	75 6e                	jne    802dba <__rodata_start+0x9a>
+  802d4c:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802d50:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d51:	3e 00 30             	ds add %dh,(%rax)
+  802d54:	31 32                	xor    %esi,(%rdx)
+  802d56:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802d5d:	41                   	rex.B
+  802d5e:	42                   	rex.X
+  802d5f:	43                   	rex.XB
+  802d60:	44                   	rex.R
+  802d61:	45                   	rex.RB
+  802d62:	46 00 30             	rex.RX add %r14b,(%rax)
+  802d65:	31 32                	xor    %esi,(%rdx)
+  802d67:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802d6e:	61                   	(bad)
+  802d6f:	62 63 64 65 66       	(bad)
+  802d74:	00 28                	add    %ch,(%rax)
+  802d76:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d77:	75 6c                	jne    802de5 <__rodata_start+0xc5>
+  802d79:	6c                   	insb   (%dx),%es:(%rdi)
+  802d7a:	29 00                	sub    %eax,(%rax)
+  802d7c:	65 72 72             	gs jb  802df1 <__rodata_start+0xd1>
+  802d7f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d80:	72 20                	jb     802da2 <__rodata_start+0x82>
+  802d82:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802d87:	73 70                	jae    802df9 <__rodata_start+0xd9>
+  802d89:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802d8d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802d94:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d95:	72 00                	jb     802d97 <__rodata_start+0x77>
+  802d97:	62 61 64 20 65       	(bad)
+  802d9c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d9d:	76 69                	jbe    802e08 <__rodata_start+0xe8>
+  802d9f:	72 6f                	jb     802e10 <__rodata_start+0xf0>
+  802da1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802da2:	6d                   	insl   (%dx),%es:(%rdi)
+  802da3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802da5:	74 00                	je     802da7 <__rodata_start+0x87>
+  802da7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802dae:	20 70 61             	and    %dh,0x61(%rax)
+  802db1:	72 61                	jb     802e14 <__rodata_start+0xf4>
+  802db3:	6d                   	insl   (%dx),%es:(%rdi)
+  802db4:	65 74 65             	gs je  802e1c <__rodata_start+0xfc>
+  802db7:	72 00                	jb     802db9 <__rodata_start+0x99>
+  802db9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dba:	75 74                	jne    802e30 <__rodata_start+0x110>
+  802dbc:	20 6f 66             	and    %ch,0x66(%rdi)
+  802dbf:	20 6d 65             	and    %ch,0x65(%rbp)
+  802dc2:	6d                   	insl   (%dx),%es:(%rdi)
+  802dc3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dc4:	72 79                	jb     802e3f <__rodata_start+0x11f>
+  802dc6:	00 6f 75             	add    %ch,0x75(%rdi)
+  802dc9:	74 20                	je     802deb <__rodata_start+0xcb>
+  802dcb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dcc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802dd0:	76 69                	jbe    802e3b <__rodata_start+0x11b>
+  802dd2:	72 6f                	jb     802e43 <__rodata_start+0x123>
+  802dd4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dd5:	6d                   	insl   (%dx),%es:(%rdi)
+  802dd6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802dd8:	74 73                	je     802e4d <__rodata_start+0x12d>
+  802dda:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802ddd:	72 72                	jb     802e51 <__rodata_start+0x131>
+  802ddf:	75 70                	jne    802e51 <__rodata_start+0x131>
+  802de1:	74 65                	je     802e48 <__rodata_start+0x128>
+  802de3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802de8:	75 67                	jne    802e51 <__rodata_start+0x131>
+  802dea:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802ded:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802def:	00 73 65             	add    %dh,0x65(%rbx)
+  802df2:	67 6d                	insl   (%dx),%es:(%edi)
+  802df4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802df6:	74 61                	je     802e59 <__rodata_start+0x139>
+  802df8:	74 69                	je     802e63 <__rodata_start+0x143>
+  802dfa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dfb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dfc:	20 66 61             	and    %ah,0x61(%rsi)
+  802dff:	75 6c                	jne    802e6d <__rodata_start+0x14d>
+  802e01:	74 00                	je     802e03 <__rodata_start+0xe3>
+  802e03:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802e0a:	20 45 4c             	and    %al,0x4c(%rbp)
+  802e0d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802e11:	61                   	(bad)
+  802e12:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802e17:	20 73 75             	and    %dh,0x75(%rbx)
+  802e1a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802e1d:	73 79                	jae    802e98 <__rodata_start+0x178>
+  802e1f:	73 74                	jae    802e95 <__rodata_start+0x175>
+  802e21:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802e23:	20 63 61             	and    %ah,0x61(%rbx)
+  802e26:	6c                   	insb   (%dx),%es:(%rdi)
+  802e27:	6c                   	insb   (%dx),%es:(%rdi)
+  802e28:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802e2b:	74 72                	je     802e9f <__rodata_start+0x17f>
+  802e2d:	79 20                	jns    802e4f <__rodata_start+0x12f>
+  802e2f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e30:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e31:	74 20                	je     802e53 <__rodata_start+0x133>
+  802e33:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e35:	75 6e                	jne    802ea5 <__rodata_start+0x185>
+  802e37:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802e3b:	76 20                	jbe    802e5d <__rodata_start+0x13d>
+  802e3d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802e44:	72 65                	jb     802eab <__rodata_start+0x18b>
+  802e46:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802e49:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e4a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802e4e:	65 78 70             	gs js  802ec1 <__rodata_start+0x1a1>
+  802e51:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802e56:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802e59:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802e5d:	20 66 69             	and    %ah,0x69(%rsi)
+  802e60:	6c                   	insb   (%dx),%es:(%rdi)
+  802e61:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802e65:	20 66 72             	and    %ah,0x72(%rsi)
+  802e68:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802e6d:	61                   	(bad)
+  802e6e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802e71:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e72:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e73:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802e77:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802e7a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e7b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e7c:	20 6d 61             	and    %ch,0x61(%rbp)
+  802e7f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e80:	79 20                	jns    802ea2 <__rodata_start+0x182>
+  802e82:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802e89:	72 65                	jb     802ef0 <__rodata_start+0x1d0>
+  802e8b:	20 6f 70             	and    %ch,0x70(%rdi)
+  802e8e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e90:	00 66 69             	add    %ah,0x69(%rsi)
+  802e93:	6c                   	insb   (%dx),%es:(%rdi)
+  802e94:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802e98:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802e9b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e9c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802e9f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ea0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ea1:	74 20                	je     802ec3 <__rodata_start+0x1a3>
+  802ea3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802ea5:	75 6e                	jne    802f15 <__rodata_start+0x1f5>
+  802ea7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802eab:	76 61                	jbe    802f0e <__rodata_start+0x1ee>
+  802ead:	6c                   	insb   (%dx),%es:(%rdi)
+  802eae:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802eb5:	00 
+  802eb6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802ebd:	72 65                	jb     802f24 <__rodata_start+0x204>
+  802ebf:	61                   	(bad)
+  802ec0:	64 79 20             	fs jns 802ee3 <__rodata_start+0x1c3>
+  802ec3:	65 78 69             	gs js  802f2f <__rodata_start+0x20f>
+  802ec6:	73 74                	jae    802f3c <__rodata_start+0x21c>
+  802ec8:	73 00                	jae    802eca <__rodata_start+0x1aa>
+  802eca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ecb:	70 65                	jo     802f32 <__rodata_start+0x212>
+  802ecd:	72 61                	jb     802f30 <__rodata_start+0x210>
+  802ecf:	74 69                	je     802f3a <__rodata_start+0x21a>
+  802ed1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ed2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ed3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802ed6:	74 20                	je     802ef8 <__rodata_start+0x1d8>
+  802ed8:	73 75                	jae    802f4f <__rodata_start+0x22f>
+  802eda:	70 70                	jo     802f4c <__rodata_start+0x22c>
+  802edc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802edd:	72 74                	jb     802f53 <__rodata_start+0x233>
+  802edf:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802ee4:	65 72 61             	gs jb  802f48 <__rodata_start+0x228>
+  802ee7:	74 69                	je     802f52 <__rodata_start+0x232>
+  802ee9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802eeb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802eee:	74 20                	je     802f10 <__rodata_start+0x1f0>
+  802ef0:	70 65                	jo     802f57 <__rodata_start+0x237>
+  802ef2:	72 6d                	jb     802f61 <__rodata_start+0x241>
+  802ef4:	69 74 74 65 64 00 66 	imul   $0xf660064,0x65(%rsp,%rsi,2),%esi
+  802efb:	0f 
+  802efc:	1f                   	(bad)
+  802efd:	44 00 00             	add    %r8b,(%rax)
+  802f00:	9a                   	(bad)
+  802f01:	04 80                	add    $0x80,%al
+  802f03:	00 00                	add    %al,(%rax)
+  802f05:	00 00                	add    %al,(%rax)
+  802f07:	00 db                	add    %bl,%bl
+  802f09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f0f:	00 cb                	add    %cl,%bl
+  802f11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f17:	00 db                	add    %bl,%bl
+  802f19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f1f:	00 db                	add    %bl,%bl
+  802f21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f27:	00 db                	add    %bl,%bl
+  802f29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f2f:	00 db                	add    %bl,%bl
+  802f31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f37:	00 b9 04 80 00 00    	add    %bh,0x8004(%rcx)
+  802f3d:	00 00                	add    %al,(%rax)
+  802f3f:	00 db                	add    %bl,%bl
+  802f41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f47:	00 db                	add    %bl,%bl
+  802f49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f4f:	00 ad 04 80 00 00    	add    %ch,0x8004(%rbp)
+  802f55:	00 00                	add    %al,(%rax)
+  802f57:	00 27                	add    %ah,(%rdi)
+  802f59:	05 80 00 00 00       	add    $0x80,%eax
+  802f5e:	00 00                	add    %al,(%rax)
+  802f60:	db 0a                	fisttpl (%rdx)
+  802f62:	80 00 00             	addb   $0x0,(%rax)
+  802f65:	00 00                	add    %al,(%rax)
+  802f67:	00 ad 04 80 00 00    	add    %ch,0x8004(%rbp)
+  802f6d:	00 00                	add    %al,(%rax)
+  802f6f:	00 f3                	add    %dh,%bl
+  802f71:	04 80                	add    $0x80,%al
+  802f73:	00 00                	add    %al,(%rax)
+  802f75:	00 00                	add    %al,(%rax)
+  802f77:	00 f3                	add    %dh,%bl
+  802f79:	04 80                	add    $0x80,%al
+  802f7b:	00 00                	add    %al,(%rax)
+  802f7d:	00 00                	add    %al,(%rax)
+  802f7f:	00 f3                	add    %dh,%bl
+  802f81:	04 80                	add    $0x80,%al
+  802f83:	00 00                	add    %al,(%rax)
+  802f85:	00 00                	add    %al,(%rax)
+  802f87:	00 f3                	add    %dh,%bl
+  802f89:	04 80                	add    $0x80,%al
+  802f8b:	00 00                	add    %al,(%rax)
+  802f8d:	00 00                	add    %al,(%rax)
+  802f8f:	00 f3                	add    %dh,%bl
+  802f91:	04 80                	add    $0x80,%al
+  802f93:	00 00                	add    %al,(%rax)
+  802f95:	00 00                	add    %al,(%rax)
+  802f97:	00 f3                	add    %dh,%bl
+  802f99:	04 80                	add    $0x80,%al
+  802f9b:	00 00                	add    %al,(%rax)
+  802f9d:	00 00                	add    %al,(%rax)
+  802f9f:	00 f3                	add    %dh,%bl
+  802fa1:	04 80                	add    $0x80,%al
+  802fa3:	00 00                	add    %al,(%rax)
+  802fa5:	00 00                	add    %al,(%rax)
+  802fa7:	00 f3                	add    %dh,%bl
+  802fa9:	04 80                	add    $0x80,%al
+  802fab:	00 00                	add    %al,(%rax)
+  802fad:	00 00                	add    %al,(%rax)
+  802faf:	00 f3                	add    %dh,%bl
+  802fb1:	04 80                	add    $0x80,%al
+  802fb3:	00 00                	add    %al,(%rax)
+  802fb5:	00 00                	add    %al,(%rax)
+  802fb7:	00 db                	add    %bl,%bl
+  802fb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fbf:	00 db                	add    %bl,%bl
+  802fc1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fc7:	00 db                	add    %bl,%bl
+  802fc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fcf:	00 db                	add    %bl,%bl
+  802fd1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fd7:	00 db                	add    %bl,%bl
+  802fd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fdf:	00 db                	add    %bl,%bl
+  802fe1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fe7:	00 db                	add    %bl,%bl
+  802fe9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fef:	00 db                	add    %bl,%bl
+  802ff1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ff7:	00 db                	add    %bl,%bl
+  802ff9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fff:	00 db                	add    %bl,%bl
+  803001:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803007:	00 db                	add    %bl,%bl
+  803009:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80300f:	00 db                	add    %bl,%bl
+  803011:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803017:	00 db                	add    %bl,%bl
+  803019:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80301f:	00 db                	add    %bl,%bl
+  803021:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803027:	00 db                	add    %bl,%bl
+  803029:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80302f:	00 db                	add    %bl,%bl
+  803031:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803037:	00 db                	add    %bl,%bl
+  803039:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80303f:	00 db                	add    %bl,%bl
+  803041:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803047:	00 db                	add    %bl,%bl
+  803049:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80304f:	00 db                	add    %bl,%bl
+  803051:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803057:	00 db                	add    %bl,%bl
+  803059:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80305f:	00 db                	add    %bl,%bl
+  803061:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803067:	00 db                	add    %bl,%bl
+  803069:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80306f:	00 db                	add    %bl,%bl
+  803071:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803077:	00 db                	add    %bl,%bl
+  803079:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80307f:	00 db                	add    %bl,%bl
+  803081:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803087:	00 db                	add    %bl,%bl
+  803089:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80308f:	00 db                	add    %bl,%bl
+  803091:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803097:	00 db                	add    %bl,%bl
+  803099:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80309f:	00 db                	add    %bl,%bl
+  8030a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030a7:	00 fe                	add    %bh,%dh
+  8030a9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030af:	00 db                	add    %bl,%bl
+  8030b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030b7:	00 db                	add    %bl,%bl
+  8030b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030bf:	00 db                	add    %bl,%bl
+  8030c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030c7:	00 db                	add    %bl,%bl
+  8030c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030cf:	00 db                	add    %bl,%bl
+  8030d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030d7:	00 db                	add    %bl,%bl
+  8030d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030df:	00 db                	add    %bl,%bl
+  8030e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030e7:	00 db                	add    %bl,%bl
+  8030e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030ef:	00 db                	add    %bl,%bl
+  8030f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030f7:	00 db                	add    %bl,%bl
+  8030f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030ff:	00 4a 05             	add    %cl,0x5(%rdx)
+  803102:	80 00 00             	addb   $0x0,(%rax)
+  803105:	00 00                	add    %al,(%rax)
+  803107:	00 19                	add    %bl,(%rcx)
+  803109:	07                   	(bad)
+  80310a:	80 00 00             	addb   $0x0,(%rax)
+  80310d:	00 00                	add    %al,(%rax)
+  80310f:	00 db                	add    %bl,%bl
+  803111:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803117:	00 db                	add    %bl,%bl
+  803119:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80311f:	00 db                	add    %bl,%bl
+  803121:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803127:	00 db                	add    %bl,%bl
+  803129:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80312f:	00 79 05             	add    %bh,0x5(%rcx)
+  803132:	80 00 00             	addb   $0x0,(%rax)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 db                	add    %bl,%bl
+  803139:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80313f:	00 db                	add    %bl,%bl
+  803141:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803147:	00 3f                	add    %bh,(%rdi)
+  803149:	05 80 00 00 00       	add    $0x80,%eax
+  80314e:	00 00                	add    %al,(%rax)
+  803150:	db 0a                	fisttpl (%rdx)
+  803152:	80 00 00             	addb   $0x0,(%rax)
+  803155:	00 00                	add    %al,(%rax)
+  803157:	00 db                	add    %bl,%bl
+  803159:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80315f:	00 c1                	add    %al,%cl
+  803161:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803167:	00 8b 09 80 00 00    	add    %cl,0x8009(%rbx)
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 db                	add    %bl,%bl
+  803171:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803177:	00 db                	add    %bl,%bl
+  803179:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80317f:	00 10                	add    %dl,(%rax)
+  803181:	06                   	(bad)
+  803182:	80 00 00             	addb   $0x0,(%rax)
+  803185:	00 00                	add    %al,(%rax)
+  803187:	00 db                	add    %bl,%bl
+  803189:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80318f:	00 ed                	add    %ch,%ch
+  803191:	07                   	(bad)
+  803192:	80 00 00             	addb   $0x0,(%rax)
+  803195:	00 00                	add    %al,(%rax)
+  803197:	00 db                	add    %bl,%bl
+  803199:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80319f:	00 db                	add    %bl,%bl
+  8031a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031a7:	00 fe                	add    %bh,%dh
+  8031a9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8031af:	00 db                	add    %bl,%bl
+  8031b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031b7:	00 a3 04 80 00 00    	add    %ah,0x8004(%rbx)
+  8031bd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008031c0 <error_string>:
+	...
+  8031c8:	85 2d 80 00 00 00 00 00 97 2d 80 00 00 00 00 00     .-.......-......
+  8031d8:	a7 2d 80 00 00 00 00 00 b9 2d 80 00 00 00 00 00     .-.......-......
+  8031e8:	c7 2d 80 00 00 00 00 00 db 2d 80 00 00 00 00 00     .-.......-......
+  8031f8:	f0 2d 80 00 00 00 00 00 03 2e 80 00 00 00 00 00     .-..............
+  803208:	15 2e 80 00 00 00 00 00 29 2e 80 00 00 00 00 00     ........).......
+  803218:	39 2e 80 00 00 00 00 00 4c 2e 80 00 00 00 00 00     9.......L.......
+  803228:	63 2e 80 00 00 00 00 00 79 2e 80 00 00 00 00 00     c.......y.......
+  803238:	91 2e 80 00 00 00 00 00 a9 2e 80 00 00 00 00 00     ................
+  803248:	b6 2e 80 00 00 00 00 00 70 32 80 00 00 00 00 00     ........p2......
+  803258:	ca 2e 80 00 00 00 00 00 00 00 00 00 00 00 00 00     ................
+  803268:	e2 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ........file is 
+  803278:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803288:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803298:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8032a8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8032b8:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  8032c8:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  8032d8:	6c 69 62 2f 66 6f 72 6b 2e 63 00 69 70 63 5f 73     lib/fork.c.ipc_s
+  8032e8:	65 6e 64 3a 20 66 61 69 6c 65 64 20 74 6f 20 73     end: failed to s
+  8032f8:	65 6e 64 00 6c 69 62 2f 69 70 63 2e 63 00 66 90     end.lib/ipc.c.f.
+  803308:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803318:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803328:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803338:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803348:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803358:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803368:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803378:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803388:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803398:	0f 1f 84 00 00 00 00 00                             ........
+
+00000000008033a0 <devtab>:
+  8033a0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8033b0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8033c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8033d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8033e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8033f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803400:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803410:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803420:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803430:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803440:	3a 20 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     : .f.........f..
+  803450:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803460:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803470:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803480:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803490:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803500:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803510:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803520:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803530:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803540:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803550:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803560:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803570:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803580:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803590:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803600:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803610:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803620:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803630:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803640:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803650:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803660:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803670:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803680:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803690:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803700:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803710:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803720:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803730:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803740:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803750:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803760:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803770:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803780:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803790:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
@@ -0,0 +1,5847 @@
+
+obj/user/pingpongs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 6d 01 00 00       	call   800190 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+uint32_t val;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    envid_t who;
+
+    if ((who = sfork()) != 0) {
+  800036:	48 b8 50 18 80 00 00 	movabs $0x801850,%rax
+  80003d:	00 00 00 
+  800040:	ff d0                	call   *%rax
+  800042:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800045:	85 c0                	test   %eax,%eax
+  800047:	0f 85 c3 00 00 00    	jne    800110 <umain+0xeb>
+        ipc_send(who, 0, 0, 0, 0);
+    }
+
+    while (1) {
+        ipc_recv(&who, 0, 0, 0);
+        cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  80004d:	48 bb 00 50 80 00 00 	movabs $0x805000,%rbx
+  800054:	00 00 00 
+        ipc_recv(&who, 0, 0, 0);
+  800057:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80005c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800061:	be 00 00 00 00       	mov    $0x0,%esi
+  800066:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  80006a:	48 b8 7e 18 80 00 00 	movabs $0x80187e,%rax
+  800071:	00 00 00 
+  800074:	ff d0                	call   *%rax
+        cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  800076:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  80007d:	00 00 00 
+  800080:	4c 8b 20             	mov    (%rax),%r12
+  800083:	45 8b bc 24 c8 00 00 	mov    0xc8(%r12),%r15d
+  80008a:	00 
+  80008b:	44 8b 75 cc          	mov    -0x34(%rbp),%r14d
+  80008f:	44 8b 2b             	mov    (%rbx),%r13d
+  800092:	48 b8 1c 11 80 00 00 	movabs $0x80111c,%rax
+  800099:	00 00 00 
+  80009c:	ff d0                	call   *%rax
+  80009e:	89 c6                	mov    %eax,%esi
+  8000a0:	45 89 f9             	mov    %r15d,%r9d
+  8000a3:	4d 89 e0             	mov    %r12,%r8
+  8000a6:	44 89 f1             	mov    %r14d,%ecx
+  8000a9:	44 89 ea             	mov    %r13d,%edx
+  8000ac:	48 bf b0 2d 80 00 00 	movabs $0x802db0,%rdi
+  8000b3:	00 00 00 
+  8000b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bb:	49 ba 07 03 80 00 00 	movabs $0x800307,%r10
+  8000c2:	00 00 00 
+  8000c5:	41 ff d2             	call   *%r10
+        if (val == 10) return;
+  8000c8:	8b 03                	mov    (%rbx),%eax
+  8000ca:	83 f8 0a             	cmp    $0xa,%eax
+  8000cd:	74 32                	je     800101 <umain+0xdc>
+        ++val;
+  8000cf:	83 c0 01             	add    $0x1,%eax
+  8000d2:	89 03                	mov    %eax,(%rbx)
+        ipc_send(who, 0, 0, 0, 0);
+  8000d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e9:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8000ec:	48 b8 13 19 80 00 00 	movabs $0x801913,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+        if (val == 10) return;
+  8000f8:	83 3b 0a             	cmpl   $0xa,(%rbx)
+  8000fb:	0f 85 56 ff ff ff    	jne    800057 <umain+0x32>
+    }
+}
+  800101:	48 83 c4 18          	add    $0x18,%rsp
+  800105:	5b                   	pop    %rbx
+  800106:	41 5c                	pop    %r12
+  800108:	41 5d                	pop    %r13
+  80010a:	41 5e                	pop    %r14
+  80010c:	41 5f                	pop    %r15
+  80010e:	5d                   	pop    %rbp
+  80010f:	c3                   	ret
+        cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  800110:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  800117:	00 00 00 
+  80011a:	48 8b 18             	mov    (%rax),%rbx
+  80011d:	49 bc 1c 11 80 00 00 	movabs $0x80111c,%r12
+  800124:	00 00 00 
+  800127:	41 ff d4             	call   *%r12
+  80012a:	89 c6                	mov    %eax,%esi
+  80012c:	48 89 da             	mov    %rbx,%rdx
+  80012f:	48 bf 80 2d 80 00 00 	movabs $0x802d80,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	48 bb 07 03 80 00 00 	movabs $0x800307,%rbx
+  800145:	00 00 00 
+  800148:	ff d3                	call   *%rbx
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  80014a:	44 8b 6d cc          	mov    -0x34(%rbp),%r13d
+  80014e:	41 ff d4             	call   *%r12
+  800151:	89 c6                	mov    %eax,%esi
+  800153:	44 89 ea             	mov    %r13d,%edx
+  800156:	48 bf 9a 2d 80 00 00 	movabs $0x802d9a,%rdi
+  80015d:	00 00 00 
+  800160:	b8 00 00 00 00       	mov    $0x0,%eax
+  800165:	ff d3                	call   *%rbx
+        ipc_send(who, 0, 0, 0, 0);
+  800167:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80016d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800172:	ba 00 00 00 00       	mov    $0x0,%edx
+  800177:	be 00 00 00 00       	mov    $0x0,%esi
+  80017c:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80017f:	48 b8 13 19 80 00 00 	movabs $0x801913,%rax
+  800186:	00 00 00 
+  800189:	ff d0                	call   *%rax
+  80018b:	e9 bd fe ff ff       	jmp    80004d <umain+0x28>
+
+0000000000800190 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800190:	55                   	push   %rbp
+  800191:	48 89 e5             	mov    %rsp,%rbp
+  800194:	41 56                	push   %r14
+  800196:	41 55                	push   %r13
+  800198:	41 54                	push   %r12
+  80019a:	53                   	push   %rbx
+  80019b:	41 89 fd             	mov    %edi,%r13d
+  80019e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001a1:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8001a8:	00 00 00 
+  8001ab:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8001b2:	00 00 00 
+  8001b5:	48 39 c2             	cmp    %rax,%rdx
+  8001b8:	73 17                	jae    8001d1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001ba:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001bd:	49 89 c4             	mov    %rax,%r12
+  8001c0:	48 83 c3 08          	add    $0x8,%rbx
+  8001c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c9:	ff 53 f8             	call   *-0x8(%rbx)
+  8001cc:	4c 39 e3             	cmp    %r12,%rbx
+  8001cf:	72 ef                	jb     8001c0 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8001d1:	48 b8 1c 11 80 00 00 	movabs $0x80111c,%rax
+  8001d8:	00 00 00 
+  8001db:	ff d0                	call   *%rax
+  8001dd:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8001e0:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8001e7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001ee:	00 00 00 
+  8001f1:	48 01 d0             	add    %rdx,%rax
+  8001f4:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  8001fb:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001fe:	45 85 ed             	test   %r13d,%r13d
+  800201:	7e 0d                	jle    800210 <libmain+0x80>
+  800203:	49 8b 06             	mov    (%r14),%rax
+  800206:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80020d:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800210:	4c 89 f6             	mov    %r14,%rsi
+  800213:	44 89 ef             	mov    %r13d,%edi
+  800216:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80021d:	00 00 00 
+  800220:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800222:	48 b8 37 02 80 00 00 	movabs $0x800237,%rax
+  800229:	00 00 00 
+  80022c:	ff d0                	call   *%rax
+#endif
+}
+  80022e:	5b                   	pop    %rbx
+  80022f:	41 5c                	pop    %r12
+  800231:	41 5d                	pop    %r13
+  800233:	41 5e                	pop    %r14
+  800235:	5d                   	pop    %rbp
+  800236:	c3                   	ret
+
+0000000000800237 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800237:	55                   	push   %rbp
+  800238:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80023b:	48 b8 29 1c 80 00 00 	movabs $0x801c29,%rax
+  800242:	00 00 00 
+  800245:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800247:	bf 00 00 00 00       	mov    $0x0,%edi
+  80024c:	48 b8 b1 10 80 00 00 	movabs $0x8010b1,%rax
+  800253:	00 00 00 
+  800256:	ff d0                	call   *%rax
+}
+  800258:	5d                   	pop    %rbp
+  800259:	c3                   	ret
+
+000000000080025a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80025a:	55                   	push   %rbp
+  80025b:	48 89 e5             	mov    %rsp,%rbp
+  80025e:	53                   	push   %rbx
+  80025f:	48 83 ec 08          	sub    $0x8,%rsp
+  800263:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800266:	8b 06                	mov    (%rsi),%eax
+  800268:	8d 50 01             	lea    0x1(%rax),%edx
+  80026b:	89 16                	mov    %edx,(%rsi)
+  80026d:	48 98                	cltq
+  80026f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800274:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80027a:	74 0a                	je     800286 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80027c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800280:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800284:	c9                   	leave
+  800285:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800286:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80028a:	be ff 00 00 00       	mov    $0xff,%esi
+  80028f:	48 b8 53 10 80 00 00 	movabs $0x801053,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+        state->offset = 0;
+  80029b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002a1:	eb d9                	jmp    80027c <putch+0x22>
+
+00000000008002a3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002a3:	55                   	push   %rbp
+  8002a4:	48 89 e5             	mov    %rsp,%rbp
+  8002a7:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002ae:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002b1:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002b8:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002c5:	48 89 f1             	mov    %rsi,%rcx
+  8002c8:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002cf:	48 bf 5a 02 80 00 00 	movabs $0x80025a,%rdi
+  8002d6:	00 00 00 
+  8002d9:	48 b8 57 04 80 00 00 	movabs $0x800457,%rax
+  8002e0:	00 00 00 
+  8002e3:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002e5:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002ec:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002f3:	48 b8 53 10 80 00 00 	movabs $0x801053,%rax
+  8002fa:	00 00 00 
+  8002fd:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002ff:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800305:	c9                   	leave
+  800306:	c3                   	ret
+
+0000000000800307 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800307:	55                   	push   %rbp
+  800308:	48 89 e5             	mov    %rsp,%rbp
+  80030b:	48 83 ec 50          	sub    $0x50,%rsp
+  80030f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800313:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800317:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80031b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80031f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800323:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80032a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80032e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800332:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800336:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80033a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80033e:	48 b8 a3 02 80 00 00 	movabs $0x8002a3,%rax
+  800345:	00 00 00 
+  800348:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80034a:	c9                   	leave
+  80034b:	c3                   	ret
+
+000000000080034c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80034c:	55                   	push   %rbp
+  80034d:	48 89 e5             	mov    %rsp,%rbp
+  800350:	41 57                	push   %r15
+  800352:	41 56                	push   %r14
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 18          	sub    $0x18,%rsp
+  80035d:	49 89 fc             	mov    %rdi,%r12
+  800360:	49 89 f5             	mov    %rsi,%r13
+  800363:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800367:	8b 45 10             	mov    0x10(%rbp),%eax
+  80036a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80036d:	41 89 cf             	mov    %ecx,%r15d
+  800370:	4c 39 fa             	cmp    %r15,%rdx
+  800373:	73 5b                	jae    8003d0 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800375:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800379:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80037d:	85 db                	test   %ebx,%ebx
+  80037f:	7e 0e                	jle    80038f <print_num+0x43>
+            putch(padc, put_arg);
+  800381:	4c 89 ee             	mov    %r13,%rsi
+  800384:	44 89 f7             	mov    %r14d,%edi
+  800387:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80038a:	83 eb 01             	sub    $0x1,%ebx
+  80038d:	75 f2                	jne    800381 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80038f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800393:	48 b9 f1 2d 80 00 00 	movabs $0x802df1,%rcx
+  80039a:	00 00 00 
+  80039d:	48 b8 e0 2d 80 00 00 	movabs $0x802de0,%rax
+  8003a4:	00 00 00 
+  8003a7:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b4:	49 f7 f7             	div    %r15
+  8003b7:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003bb:	4c 89 ee             	mov    %r13,%rsi
+  8003be:	41 ff d4             	call   *%r12
+}
+  8003c1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003c5:	5b                   	pop    %rbx
+  8003c6:	41 5c                	pop    %r12
+  8003c8:	41 5d                	pop    %r13
+  8003ca:	41 5e                	pop    %r14
+  8003cc:	41 5f                	pop    %r15
+  8003ce:	5d                   	pop    %rbp
+  8003cf:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003d9:	49 f7 f7             	div    %r15
+  8003dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8003e0:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003e4:	52                   	push   %rdx
+  8003e5:	45 0f be c9          	movsbl %r9b,%r9d
+  8003e9:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003ed:	48 89 c2             	mov    %rax,%rdx
+  8003f0:	48 b8 4c 03 80 00 00 	movabs $0x80034c,%rax
+  8003f7:	00 00 00 
+  8003fa:	ff d0                	call   *%rax
+  8003fc:	48 83 c4 10          	add    $0x10,%rsp
+  800400:	eb 8d                	jmp    80038f <print_num+0x43>
+
+0000000000800402 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800402:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800406:	48 8b 06             	mov    (%rsi),%rax
+  800409:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80040d:	73 0a                	jae    800419 <sprintputch+0x17>
+        *state->start++ = ch;
+  80040f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800413:	48 89 16             	mov    %rdx,(%rsi)
+  800416:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800419:	c3                   	ret
+
+000000000080041a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80041a:	55                   	push   %rbp
+  80041b:	48 89 e5             	mov    %rsp,%rbp
+  80041e:	48 83 ec 50          	sub    $0x50,%rsp
+  800422:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800426:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80042a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80042e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800435:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800439:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80043d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800441:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800445:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800449:	48 b8 57 04 80 00 00 	movabs $0x800457,%rax
+  800450:	00 00 00 
+  800453:	ff d0                	call   *%rax
+}
+  800455:	c9                   	leave
+  800456:	c3                   	ret
+
+0000000000800457 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800457:	55                   	push   %rbp
+  800458:	48 89 e5             	mov    %rsp,%rbp
+  80045b:	41 57                	push   %r15
+  80045d:	41 56                	push   %r14
+  80045f:	41 55                	push   %r13
+  800461:	41 54                	push   %r12
+  800463:	53                   	push   %rbx
+  800464:	48 83 ec 38          	sub    $0x38,%rsp
+  800468:	49 89 fe             	mov    %rdi,%r14
+  80046b:	49 89 f5             	mov    %rsi,%r13
+  80046e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800471:	48 8b 01             	mov    (%rcx),%rax
+  800474:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800478:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80047c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800480:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800484:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800488:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80048c:	0f b6 3b             	movzbl (%rbx),%edi
+  80048f:	40 80 ff 25          	cmp    $0x25,%dil
+  800493:	74 18                	je     8004ad <vprintfmt+0x56>
+            if (!ch) return;
+  800495:	40 84 ff             	test   %dil,%dil
+  800498:	0f 84 b1 06 00 00    	je     800b4f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80049e:	40 0f b6 ff          	movzbl %dil,%edi
+  8004a2:	4c 89 ee             	mov    %r13,%rsi
+  8004a5:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004a8:	4c 89 e3             	mov    %r12,%rbx
+  8004ab:	eb db                	jmp    800488 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8004b2:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004b6:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004bb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004c1:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004c8:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004cc:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004d1:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004d6:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004d9:	83 e8 23             	sub    $0x23,%eax
+  8004dc:	3c 57                	cmp    $0x57,%al
+  8004de:	0f 87 51 06 00 00    	ja     800b35 <vprintfmt+0x6de>
+  8004e4:	0f b6 c0             	movzbl %al,%eax
+  8004e7:	48 b9 a0 2f 80 00 00 	movabs $0x802fa0,%rcx
+  8004ee:	00 00 00 
+  8004f1:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004f4:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004f7:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004fb:	eb cf                	jmp    8004cc <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004fd:	49 89 dc             	mov    %rbx,%r12
+  800500:	be 01 00 00 00       	mov    $0x1,%esi
+  800505:	eb c5                	jmp    8004cc <vprintfmt+0x75>
+            padc = ch;
+  800507:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80050b:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80050e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800511:	eb b9                	jmp    8004cc <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800513:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800516:	83 f8 2f             	cmp    $0x2f,%eax
+  800519:	77 24                	ja     80053f <vprintfmt+0xe8>
+  80051b:	89 c1                	mov    %eax,%ecx
+  80051d:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800521:	83 c0 08             	add    $0x8,%eax
+  800524:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800527:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80052a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80052d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800531:	79 99                	jns    8004cc <vprintfmt+0x75>
+                width = precision;
+  800533:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800537:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80053d:	eb 8d                	jmp    8004cc <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80053f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800543:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800547:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80054b:	eb da                	jmp    800527 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80054d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800552:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800556:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80055c:	3c 39                	cmp    $0x39,%al
+  80055e:	77 1c                	ja     80057c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800560:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800564:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800568:	0f b6 c0             	movzbl %al,%eax
+  80056b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800570:	0f b6 03             	movzbl (%rbx),%eax
+  800573:	3c 39                	cmp    $0x39,%al
+  800575:	76 e9                	jbe    800560 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800577:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80057a:	eb b1                	jmp    80052d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80057c:	49 89 dc             	mov    %rbx,%r12
+  80057f:	eb ac                	jmp    80052d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800581:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800584:	85 c9                	test   %ecx,%ecx
+  800586:	b8 00 00 00 00       	mov    $0x0,%eax
+  80058b:	0f 49 c1             	cmovns %ecx,%eax
+  80058e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800591:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800594:	e9 33 ff ff ff       	jmp    8004cc <vprintfmt+0x75>
+            lflag++;
+  800599:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80059c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80059f:	e9 28 ff ff ff       	jmp    8004cc <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8005aa:	77 19                	ja     8005c5 <vprintfmt+0x16e>
+  8005ac:	89 c2                	mov    %eax,%edx
+  8005ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005b2:	83 c0 08             	add    $0x8,%eax
+  8005b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005b8:	8b 3a                	mov    (%rdx),%edi
+  8005ba:	4c 89 ee             	mov    %r13,%rsi
+  8005bd:	41 ff d6             	call   *%r14
+            break;
+  8005c0:	e9 c3 fe ff ff       	jmp    800488 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d1:	eb e5                	jmp    8005b8 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8005d9:	77 5a                	ja     800635 <vprintfmt+0x1de>
+  8005db:	89 c2                	mov    %eax,%edx
+  8005dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005e1:	83 c0 08             	add    $0x8,%eax
+  8005e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005e7:	8b 02                	mov    (%rdx),%eax
+  8005e9:	89 c1                	mov    %eax,%ecx
+  8005eb:	f7 d9                	neg    %ecx
+  8005ed:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005f0:	83 f9 15             	cmp    $0x15,%ecx
+  8005f3:	7f 4e                	jg     800643 <vprintfmt+0x1ec>
+  8005f5:	48 63 c1             	movslq %ecx,%rax
+  8005f8:	48 ba 60 32 80 00 00 	movabs $0x803260,%rdx
+  8005ff:	00 00 00 
+  800602:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800606:	48 85 c0             	test   %rax,%rax
+  800609:	74 38                	je     800643 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80060b:	48 89 c1             	mov    %rax,%rcx
+  80060e:	48 ba 79 34 80 00 00 	movabs $0x803479,%rdx
+  800615:	00 00 00 
+  800618:	4c 89 ee             	mov    %r13,%rsi
+  80061b:	4c 89 f7             	mov    %r14,%rdi
+  80061e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800623:	49 b8 1a 04 80 00 00 	movabs $0x80041a,%r8
+  80062a:	00 00 00 
+  80062d:	41 ff d0             	call   *%r8
+  800630:	e9 53 fe ff ff       	jmp    800488 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800635:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800639:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80063d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800641:	eb a4                	jmp    8005e7 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800643:	48 ba 09 2e 80 00 00 	movabs $0x802e09,%rdx
+  80064a:	00 00 00 
+  80064d:	4c 89 ee             	mov    %r13,%rsi
+  800650:	4c 89 f7             	mov    %r14,%rdi
+  800653:	b8 00 00 00 00       	mov    $0x0,%eax
+  800658:	49 b8 1a 04 80 00 00 	movabs $0x80041a,%r8
+  80065f:	00 00 00 
+  800662:	41 ff d0             	call   *%r8
+  800665:	e9 1e fe ff ff       	jmp    800488 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80066a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80066d:	83 f8 2f             	cmp    $0x2f,%eax
+  800670:	77 6c                	ja     8006de <vprintfmt+0x287>
+  800672:	89 c2                	mov    %eax,%edx
+  800674:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800678:	83 c0 08             	add    $0x8,%eax
+  80067b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80067e:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800681:	48 85 d2             	test   %rdx,%rdx
+  800684:	48 b8 02 2e 80 00 00 	movabs $0x802e02,%rax
+  80068b:	00 00 00 
+  80068e:	48 0f 45 c2          	cmovne %rdx,%rax
+  800692:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800696:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80069a:	7e 06                	jle    8006a2 <vprintfmt+0x24b>
+  80069c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006a0:	75 4a                	jne    8006ec <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006a2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006a6:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006aa:	0f b6 00             	movzbl (%rax),%eax
+  8006ad:	84 c0                	test   %al,%al
+  8006af:	0f 85 9a 00 00 00    	jne    80074f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8006b5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006b8:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006bc:	85 c0                	test   %eax,%eax
+  8006be:	0f 8e c4 fd ff ff    	jle    800488 <vprintfmt+0x31>
+  8006c4:	4c 89 ee             	mov    %r13,%rsi
+  8006c7:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006cc:	41 ff d6             	call   *%r14
+  8006cf:	41 83 ec 01          	sub    $0x1,%r12d
+  8006d3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006d7:	75 eb                	jne    8006c4 <vprintfmt+0x26d>
+  8006d9:	e9 aa fd ff ff       	jmp    800488 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ea:	eb 92                	jmp    80067e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006ec:	49 63 f7             	movslq %r15d,%rsi
+  8006ef:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006f3:	48 b8 09 0c 80 00 00 	movabs $0x800c09,%rax
+  8006fa:	00 00 00 
+  8006fd:	ff d0                	call   *%rax
+  8006ff:	48 89 c2             	mov    %rax,%rdx
+  800702:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800705:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800707:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80070a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80070d:	85 c0                	test   %eax,%eax
+  80070f:	7e 91                	jle    8006a2 <vprintfmt+0x24b>
+  800711:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800716:	4c 89 ee             	mov    %r13,%rsi
+  800719:	44 89 e7             	mov    %r12d,%edi
+  80071c:	41 ff d6             	call   *%r14
+  80071f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800723:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800726:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800729:	75 eb                	jne    800716 <vprintfmt+0x2bf>
+  80072b:	e9 72 ff ff ff       	jmp    8006a2 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800730:	0f b6 f8             	movzbl %al,%edi
+  800733:	4c 89 ee             	mov    %r13,%rsi
+  800736:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800739:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80073d:	49 83 c4 01          	add    $0x1,%r12
+  800741:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800747:	84 c0                	test   %al,%al
+  800749:	0f 84 66 ff ff ff    	je     8006b5 <vprintfmt+0x25e>
+  80074f:	45 85 ff             	test   %r15d,%r15d
+  800752:	78 0a                	js     80075e <vprintfmt+0x307>
+  800754:	41 83 ef 01          	sub    $0x1,%r15d
+  800758:	0f 88 57 ff ff ff    	js     8006b5 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80075e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800762:	74 cc                	je     800730 <vprintfmt+0x2d9>
+  800764:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800767:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80076c:	80 fa 5e             	cmp    $0x5e,%dl
+  80076f:	77 c2                	ja     800733 <vprintfmt+0x2dc>
+  800771:	eb bd                	jmp    800730 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800773:	40 84 f6             	test   %sil,%sil
+  800776:	75 26                	jne    80079e <vprintfmt+0x347>
+    switch (lflag) {
+  800778:	85 d2                	test   %edx,%edx
+  80077a:	74 59                	je     8007d5 <vprintfmt+0x37e>
+  80077c:	83 fa 01             	cmp    $0x1,%edx
+  80077f:	74 7b                	je     8007fc <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800781:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800784:	83 f8 2f             	cmp    $0x2f,%eax
+  800787:	0f 87 96 00 00 00    	ja     800823 <vprintfmt+0x3cc>
+  80078d:	89 c2                	mov    %eax,%edx
+  80078f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800793:	83 c0 08             	add    $0x8,%eax
+  800796:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800799:	4c 8b 22             	mov    (%rdx),%r12
+  80079c:	eb 17                	jmp    8007b5 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80079e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a4:	77 21                	ja     8007c7 <vprintfmt+0x370>
+  8007a6:	89 c2                	mov    %eax,%edx
+  8007a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ac:	83 c0 08             	add    $0x8,%eax
+  8007af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b2:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007b5:	4d 85 e4             	test   %r12,%r12
+  8007b8:	78 7a                	js     800834 <vprintfmt+0x3dd>
+            num = i;
+  8007ba:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007bd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007c2:	e9 50 02 00 00       	jmp    800a17 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d3:	eb dd                	jmp    8007b2 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8007d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007db:	77 11                	ja     8007ee <vprintfmt+0x397>
+  8007dd:	89 c2                	mov    %eax,%edx
+  8007df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e3:	83 c0 08             	add    $0x8,%eax
+  8007e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007e9:	4c 63 22             	movslq (%rdx),%r12
+  8007ec:	eb c7                	jmp    8007b5 <vprintfmt+0x35e>
+  8007ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007fa:	eb ed                	jmp    8007e9 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8007fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ff:	83 f8 2f             	cmp    $0x2f,%eax
+  800802:	77 11                	ja     800815 <vprintfmt+0x3be>
+  800804:	89 c2                	mov    %eax,%edx
+  800806:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080a:	83 c0 08             	add    $0x8,%eax
+  80080d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800810:	4c 8b 22             	mov    (%rdx),%r12
+  800813:	eb a0                	jmp    8007b5 <vprintfmt+0x35e>
+  800815:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800819:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80081d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800821:	eb ed                	jmp    800810 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800823:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800827:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80082f:	e9 65 ff ff ff       	jmp    800799 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800834:	4c 89 ee             	mov    %r13,%rsi
+  800837:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80083c:	41 ff d6             	call   *%r14
+                i = -i;
+  80083f:	49 f7 dc             	neg    %r12
+  800842:	e9 73 ff ff ff       	jmp    8007ba <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800847:	40 84 f6             	test   %sil,%sil
+  80084a:	75 32                	jne    80087e <vprintfmt+0x427>
+    switch (lflag) {
+  80084c:	85 d2                	test   %edx,%edx
+  80084e:	74 5d                	je     8008ad <vprintfmt+0x456>
+  800850:	83 fa 01             	cmp    $0x1,%edx
+  800853:	0f 84 82 00 00 00    	je     8008db <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800859:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80085c:	83 f8 2f             	cmp    $0x2f,%eax
+  80085f:	0f 87 a5 00 00 00    	ja     80090a <vprintfmt+0x4b3>
+  800865:	89 c2                	mov    %eax,%edx
+  800867:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086b:	83 c0 08             	add    $0x8,%eax
+  80086e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800871:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800874:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800879:	e9 99 01 00 00       	jmp    800a17 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80087e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800881:	83 f8 2f             	cmp    $0x2f,%eax
+  800884:	77 19                	ja     80089f <vprintfmt+0x448>
+  800886:	89 c2                	mov    %eax,%edx
+  800888:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088c:	83 c0 08             	add    $0x8,%eax
+  80088f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800892:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800895:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80089a:	e9 78 01 00 00       	jmp    800a17 <vprintfmt+0x5c0>
+  80089f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ab:	eb e5                	jmp    800892 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b3:	77 18                	ja     8008cd <vprintfmt+0x476>
+  8008b5:	89 c2                	mov    %eax,%edx
+  8008b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bb:	83 c0 08             	add    $0x8,%eax
+  8008be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c1:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008c3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008c8:	e9 4a 01 00 00       	jmp    800a17 <vprintfmt+0x5c0>
+  8008cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d9:	eb e6                	jmp    8008c1 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8008db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008de:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e1:	77 19                	ja     8008fc <vprintfmt+0x4a5>
+  8008e3:	89 c2                	mov    %eax,%edx
+  8008e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e9:	83 c0 08             	add    $0x8,%eax
+  8008ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ef:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008f2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008f7:	e9 1b 01 00 00       	jmp    800a17 <vprintfmt+0x5c0>
+  8008fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800900:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800904:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800908:	eb e5                	jmp    8008ef <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80090a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800912:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800916:	e9 56 ff ff ff       	jmp    800871 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80091b:	40 84 f6             	test   %sil,%sil
+  80091e:	75 2e                	jne    80094e <vprintfmt+0x4f7>
+    switch (lflag) {
+  800920:	85 d2                	test   %edx,%edx
+  800922:	74 59                	je     80097d <vprintfmt+0x526>
+  800924:	83 fa 01             	cmp    $0x1,%edx
+  800927:	74 7f                	je     8009a8 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800929:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092c:	83 f8 2f             	cmp    $0x2f,%eax
+  80092f:	0f 87 9f 00 00 00    	ja     8009d4 <vprintfmt+0x57d>
+  800935:	89 c2                	mov    %eax,%edx
+  800937:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093b:	83 c0 08             	add    $0x8,%eax
+  80093e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800941:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800944:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800949:	e9 c9 00 00 00       	jmp    800a17 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80094e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800951:	83 f8 2f             	cmp    $0x2f,%eax
+  800954:	77 19                	ja     80096f <vprintfmt+0x518>
+  800956:	89 c2                	mov    %eax,%edx
+  800958:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095c:	83 c0 08             	add    $0x8,%eax
+  80095f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800962:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800965:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80096a:	e9 a8 00 00 00       	jmp    800a17 <vprintfmt+0x5c0>
+  80096f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800973:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800977:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097b:	eb e5                	jmp    800962 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80097d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800980:	83 f8 2f             	cmp    $0x2f,%eax
+  800983:	77 15                	ja     80099a <vprintfmt+0x543>
+  800985:	89 c2                	mov    %eax,%edx
+  800987:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098b:	83 c0 08             	add    $0x8,%eax
+  80098e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800991:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800993:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800998:	eb 7d                	jmp    800a17 <vprintfmt+0x5c0>
+  80099a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a6:	eb e9                	jmp    800991 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ae:	77 16                	ja     8009c6 <vprintfmt+0x56f>
+  8009b0:	89 c2                	mov    %eax,%edx
+  8009b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b6:	83 c0 08             	add    $0x8,%eax
+  8009b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009bf:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8009c4:	eb 51                	jmp    800a17 <vprintfmt+0x5c0>
+  8009c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d2:	eb e8                	jmp    8009bc <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8009d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e0:	e9 5c ff ff ff       	jmp    800941 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8009e5:	4c 89 ee             	mov    %r13,%rsi
+  8009e8:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009ed:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009f0:	4c 89 ee             	mov    %r13,%rsi
+  8009f3:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009f8:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800a01:	77 47                	ja     800a4a <vprintfmt+0x5f3>
+  800a03:	89 c2                	mov    %eax,%edx
+  800a05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a09:	83 c0 08             	add    $0x8,%eax
+  800a0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a12:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a17:	48 83 ec 08          	sub    $0x8,%rsp
+  800a1b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a1f:	0f 94 c0             	sete   %al
+  800a22:	0f b6 c0             	movzbl %al,%eax
+  800a25:	50                   	push   %rax
+  800a26:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a2b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a2f:	4c 89 ee             	mov    %r13,%rsi
+  800a32:	4c 89 f7             	mov    %r14,%rdi
+  800a35:	48 b8 4c 03 80 00 00 	movabs $0x80034c,%rax
+  800a3c:	00 00 00 
+  800a3f:	ff d0                	call   *%rax
+            break;
+  800a41:	48 83 c4 10          	add    $0x10,%rsp
+  800a45:	e9 3e fa ff ff       	jmp    800488 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a56:	eb b7                	jmp    800a0f <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a58:	40 84 f6             	test   %sil,%sil
+  800a5b:	75 2b                	jne    800a88 <vprintfmt+0x631>
+    switch (lflag) {
+  800a5d:	85 d2                	test   %edx,%edx
+  800a5f:	74 56                	je     800ab7 <vprintfmt+0x660>
+  800a61:	83 fa 01             	cmp    $0x1,%edx
+  800a64:	74 7f                	je     800ae5 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a66:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a69:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6c:	0f 87 a2 00 00 00    	ja     800b14 <vprintfmt+0x6bd>
+  800a72:	89 c2                	mov    %eax,%edx
+  800a74:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a78:	83 c0 08             	add    $0x8,%eax
+  800a7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a81:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a86:	eb 8f                	jmp    800a17 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a88:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8e:	77 19                	ja     800aa9 <vprintfmt+0x652>
+  800a90:	89 c2                	mov    %eax,%edx
+  800a92:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a96:	83 c0 08             	add    $0x8,%eax
+  800a99:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a9f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800aa4:	e9 6e ff ff ff       	jmp    800a17 <vprintfmt+0x5c0>
+  800aa9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab5:	eb e5                	jmp    800a9c <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800ab7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aba:	83 f8 2f             	cmp    $0x2f,%eax
+  800abd:	77 18                	ja     800ad7 <vprintfmt+0x680>
+  800abf:	89 c2                	mov    %eax,%edx
+  800ac1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac5:	83 c0 08             	add    $0x8,%eax
+  800ac8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800acb:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800acd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ad2:	e9 40 ff ff ff       	jmp    800a17 <vprintfmt+0x5c0>
+  800ad7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800adb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800adf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae3:	eb e6                	jmp    800acb <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800ae5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae8:	83 f8 2f             	cmp    $0x2f,%eax
+  800aeb:	77 19                	ja     800b06 <vprintfmt+0x6af>
+  800aed:	89 c2                	mov    %eax,%edx
+  800aef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af3:	83 c0 08             	add    $0x8,%eax
+  800af6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800afc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b01:	e9 11 ff ff ff       	jmp    800a17 <vprintfmt+0x5c0>
+  800b06:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b0a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b12:	eb e5                	jmp    800af9 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b20:	e9 59 ff ff ff       	jmp    800a7e <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b25:	4c 89 ee             	mov    %r13,%rsi
+  800b28:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b2d:	41 ff d6             	call   *%r14
+            break;
+  800b30:	e9 53 f9 ff ff       	jmp    800488 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b35:	4c 89 ee             	mov    %r13,%rsi
+  800b38:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b3d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b40:	48 83 eb 01          	sub    $0x1,%rbx
+  800b44:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b48:	75 f6                	jne    800b40 <vprintfmt+0x6e9>
+  800b4a:	e9 39 f9 ff ff       	jmp    800488 <vprintfmt+0x31>
+}
+  800b4f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b53:	5b                   	pop    %rbx
+  800b54:	41 5c                	pop    %r12
+  800b56:	41 5d                	pop    %r13
+  800b58:	41 5e                	pop    %r14
+  800b5a:	41 5f                	pop    %r15
+  800b5c:	5d                   	pop    %rbp
+  800b5d:	c3                   	ret
+
+0000000000800b5e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b5e:	55                   	push   %rbp
+  800b5f:	48 89 e5             	mov    %rsp,%rbp
+  800b62:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b66:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b6a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b6f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b73:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b7a:	48 85 ff             	test   %rdi,%rdi
+  800b7d:	74 2b                	je     800baa <vsnprintf+0x4c>
+  800b7f:	48 85 f6             	test   %rsi,%rsi
+  800b82:	74 26                	je     800baa <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b84:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b88:	48 bf 02 04 80 00 00 	movabs $0x800402,%rdi
+  800b8f:	00 00 00 
+  800b92:	48 b8 57 04 80 00 00 	movabs $0x800457,%rax
+  800b99:	00 00 00 
+  800b9c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba2:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ba5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ba8:	c9                   	leave
+  800ba9:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800baa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800baf:	eb f7                	jmp    800ba8 <vsnprintf+0x4a>
+
+0000000000800bb1 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bb1:	55                   	push   %rbp
+  800bb2:	48 89 e5             	mov    %rsp,%rbp
+  800bb5:	48 83 ec 50          	sub    $0x50,%rsp
+  800bb9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800bbd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800bc1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800bc5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bcc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bd0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bd8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800bdc:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800be0:	48 b8 5e 0b 80 00 00 	movabs $0x800b5e,%rax
+  800be7:	00 00 00 
+  800bea:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800bec:	c9                   	leave
+  800bed:	c3                   	ret
+
+0000000000800bee <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bee:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bf1:	74 10                	je     800c03 <strlen+0x15>
+    size_t n = 0;
+  800bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800bf8:	48 83 c0 01          	add    $0x1,%rax
+  800bfc:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c00:	75 f6                	jne    800bf8 <strlen+0xa>
+  800c02:	c3                   	ret
+    size_t n = 0;
+  800c03:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c08:	c3                   	ret
+
+0000000000800c09 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c09:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c0c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c11:	48 85 f6             	test   %rsi,%rsi
+  800c14:	74 11                	je     800c27 <strnlen+0x1e>
+  800c16:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c1a:	74 0c                	je     800c28 <strnlen+0x1f>
+  800c1c:	48 83 c2 01          	add    $0x1,%rdx
+  800c20:	48 39 d0             	cmp    %rdx,%rax
+  800c23:	75 f1                	jne    800c16 <strnlen+0xd>
+  800c25:	eb 04                	jmp    800c2b <strnlen+0x22>
+  800c27:	c3                   	ret
+  800c28:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c2b:	c3                   	ret
+
+0000000000800c2c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c2c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c34:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c38:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c3b:	48 83 c2 01          	add    $0x1,%rdx
+  800c3f:	84 c9                	test   %cl,%cl
+  800c41:	75 f1                	jne    800c34 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c43:	c3                   	ret
+
+0000000000800c44 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c44:	55                   	push   %rbp
+  800c45:	48 89 e5             	mov    %rsp,%rbp
+  800c48:	41 54                	push   %r12
+  800c4a:	53                   	push   %rbx
+  800c4b:	48 89 fb             	mov    %rdi,%rbx
+  800c4e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c51:	48 b8 ee 0b 80 00 00 	movabs $0x800bee,%rax
+  800c58:	00 00 00 
+  800c5b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c5d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c61:	4c 89 e6             	mov    %r12,%rsi
+  800c64:	48 b8 2c 0c 80 00 00 	movabs $0x800c2c,%rax
+  800c6b:	00 00 00 
+  800c6e:	ff d0                	call   *%rax
+    return dst;
+}
+  800c70:	48 89 d8             	mov    %rbx,%rax
+  800c73:	5b                   	pop    %rbx
+  800c74:	41 5c                	pop    %r12
+  800c76:	5d                   	pop    %rbp
+  800c77:	c3                   	ret
+
+0000000000800c78 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c78:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c7b:	48 85 d2             	test   %rdx,%rdx
+  800c7e:	74 1f                	je     800c9f <strncpy+0x27>
+  800c80:	48 01 fa             	add    %rdi,%rdx
+  800c83:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c86:	48 83 c1 01          	add    $0x1,%rcx
+  800c8a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c8e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c92:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c96:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c9a:	48 39 ca             	cmp    %rcx,%rdx
+  800c9d:	75 e7                	jne    800c86 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c9f:	c3                   	ret
+
+0000000000800ca0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ca0:	48 89 f8             	mov    %rdi,%rax
+  800ca3:	48 85 d2             	test   %rdx,%rdx
+  800ca6:	74 24                	je     800ccc <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ca8:	48 83 ea 01          	sub    $0x1,%rdx
+  800cac:	74 1b                	je     800cc9 <strlcpy+0x29>
+  800cae:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cb2:	0f b6 16             	movzbl (%rsi),%edx
+  800cb5:	84 d2                	test   %dl,%dl
+  800cb7:	74 10                	je     800cc9 <strlcpy+0x29>
+            *dst++ = *src++;
+  800cb9:	48 83 c6 01          	add    $0x1,%rsi
+  800cbd:	48 83 c0 01          	add    $0x1,%rax
+  800cc1:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800cc4:	48 39 c8             	cmp    %rcx,%rax
+  800cc7:	75 e9                	jne    800cb2 <strlcpy+0x12>
+        *dst = '\0';
+  800cc9:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ccc:	48 29 f8             	sub    %rdi,%rax
+}
+  800ccf:	c3                   	ret
+
+0000000000800cd0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800cd0:	0f b6 07             	movzbl (%rdi),%eax
+  800cd3:	84 c0                	test   %al,%al
+  800cd5:	74 13                	je     800cea <strcmp+0x1a>
+  800cd7:	38 06                	cmp    %al,(%rsi)
+  800cd9:	75 0f                	jne    800cea <strcmp+0x1a>
+  800cdb:	48 83 c7 01          	add    $0x1,%rdi
+  800cdf:	48 83 c6 01          	add    $0x1,%rsi
+  800ce3:	0f b6 07             	movzbl (%rdi),%eax
+  800ce6:	84 c0                	test   %al,%al
+  800ce8:	75 ed                	jne    800cd7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cea:	0f b6 c0             	movzbl %al,%eax
+  800ced:	0f b6 16             	movzbl (%rsi),%edx
+  800cf0:	29 d0                	sub    %edx,%eax
+}
+  800cf2:	c3                   	ret
+
+0000000000800cf3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cf3:	48 85 d2             	test   %rdx,%rdx
+  800cf6:	74 1f                	je     800d17 <strncmp+0x24>
+  800cf8:	0f b6 07             	movzbl (%rdi),%eax
+  800cfb:	84 c0                	test   %al,%al
+  800cfd:	74 1e                	je     800d1d <strncmp+0x2a>
+  800cff:	3a 06                	cmp    (%rsi),%al
+  800d01:	75 1a                	jne    800d1d <strncmp+0x2a>
+  800d03:	48 83 c7 01          	add    $0x1,%rdi
+  800d07:	48 83 c6 01          	add    $0x1,%rsi
+  800d0b:	48 83 ea 01          	sub    $0x1,%rdx
+  800d0f:	75 e7                	jne    800cf8 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d11:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d16:	c3                   	ret
+  800d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d1c:	c3                   	ret
+  800d1d:	48 85 d2             	test   %rdx,%rdx
+  800d20:	74 09                	je     800d2b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d22:	0f b6 07             	movzbl (%rdi),%eax
+  800d25:	0f b6 16             	movzbl (%rsi),%edx
+  800d28:	29 d0                	sub    %edx,%eax
+  800d2a:	c3                   	ret
+    if (!n) return 0;
+  800d2b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d30:	c3                   	ret
+
+0000000000800d31 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d31:	0f b6 17             	movzbl (%rdi),%edx
+  800d34:	84 d2                	test   %dl,%dl
+  800d36:	74 18                	je     800d50 <strchr+0x1f>
+        if (*str == c) {
+  800d38:	0f be d2             	movsbl %dl,%edx
+  800d3b:	39 f2                	cmp    %esi,%edx
+  800d3d:	74 17                	je     800d56 <strchr+0x25>
+    for (; *str; str++) {
+  800d3f:	48 83 c7 01          	add    $0x1,%rdi
+  800d43:	0f b6 17             	movzbl (%rdi),%edx
+  800d46:	84 d2                	test   %dl,%dl
+  800d48:	75 ee                	jne    800d38 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4f:	c3                   	ret
+  800d50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d55:	c3                   	ret
+  800d56:	48 89 f8             	mov    %rdi,%rax
+}
+  800d59:	c3                   	ret
+
+0000000000800d5a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d5a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d5d:	0f b6 17             	movzbl (%rdi),%edx
+  800d60:	84 d2                	test   %dl,%dl
+  800d62:	74 13                	je     800d77 <strfind+0x1d>
+  800d64:	0f be d2             	movsbl %dl,%edx
+  800d67:	39 f2                	cmp    %esi,%edx
+  800d69:	74 0b                	je     800d76 <strfind+0x1c>
+  800d6b:	48 83 c0 01          	add    $0x1,%rax
+  800d6f:	0f b6 10             	movzbl (%rax),%edx
+  800d72:	84 d2                	test   %dl,%dl
+  800d74:	75 ee                	jne    800d64 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d76:	c3                   	ret
+  800d77:	c3                   	ret
+
+0000000000800d78 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d78:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d7b:	48 89 f8             	mov    %rdi,%rax
+  800d7e:	48 f7 d8             	neg    %rax
+  800d81:	83 e0 07             	and    $0x7,%eax
+  800d84:	49 89 d1             	mov    %rdx,%r9
+  800d87:	49 29 c1             	sub    %rax,%r9
+  800d8a:	78 36                	js     800dc2 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d8c:	40 0f b6 c6          	movzbl %sil,%eax
+  800d90:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d97:	01 01 01 
+  800d9a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d9e:	40 f6 c7 07          	test   $0x7,%dil
+  800da2:	75 38                	jne    800ddc <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800da4:	4c 89 c9             	mov    %r9,%rcx
+  800da7:	48 c1 f9 03          	sar    $0x3,%rcx
+  800dab:	74 0c                	je     800db9 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800dad:	fc                   	cld
+  800dae:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800db1:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800db5:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800db9:	4d 85 c9             	test   %r9,%r9
+  800dbc:	75 45                	jne    800e03 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800dbe:	4c 89 c0             	mov    %r8,%rax
+  800dc1:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800dc2:	48 85 d2             	test   %rdx,%rdx
+  800dc5:	74 f7                	je     800dbe <memset+0x46>
+  800dc7:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800dca:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800dcd:	48 83 c0 01          	add    $0x1,%rax
+  800dd1:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800dd5:	48 39 c2             	cmp    %rax,%rdx
+  800dd8:	75 f3                	jne    800dcd <memset+0x55>
+  800dda:	eb e2                	jmp    800dbe <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ddc:	40 f6 c7 01          	test   $0x1,%dil
+  800de0:	74 06                	je     800de8 <memset+0x70>
+  800de2:	88 07                	mov    %al,(%rdi)
+  800de4:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800de8:	40 f6 c7 02          	test   $0x2,%dil
+  800dec:	74 07                	je     800df5 <memset+0x7d>
+  800dee:	66 89 07             	mov    %ax,(%rdi)
+  800df1:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800df5:	40 f6 c7 04          	test   $0x4,%dil
+  800df9:	74 a9                	je     800da4 <memset+0x2c>
+  800dfb:	89 07                	mov    %eax,(%rdi)
+  800dfd:	48 83 c7 04          	add    $0x4,%rdi
+  800e01:	eb a1                	jmp    800da4 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e03:	41 f6 c1 04          	test   $0x4,%r9b
+  800e07:	74 06                	je     800e0f <memset+0x97>
+  800e09:	89 07                	mov    %eax,(%rdi)
+  800e0b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e0f:	41 f6 c1 02          	test   $0x2,%r9b
+  800e13:	74 07                	je     800e1c <memset+0xa4>
+  800e15:	66 89 07             	mov    %ax,(%rdi)
+  800e18:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e1c:	41 f6 c1 01          	test   $0x1,%r9b
+  800e20:	74 9c                	je     800dbe <memset+0x46>
+  800e22:	88 07                	mov    %al,(%rdi)
+  800e24:	eb 98                	jmp    800dbe <memset+0x46>
+
+0000000000800e26 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e26:	48 89 f8             	mov    %rdi,%rax
+  800e29:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e2c:	48 39 fe             	cmp    %rdi,%rsi
+  800e2f:	73 3b                	jae    800e6c <memmove+0x46>
+  800e31:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e35:	48 39 d7             	cmp    %rdx,%rdi
+  800e38:	73 32                	jae    800e6c <memmove+0x46>
+        s += n;
+        d += n;
+  800e3a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e3e:	48 89 d6             	mov    %rdx,%rsi
+  800e41:	48 09 fe             	or     %rdi,%rsi
+  800e44:	48 09 ce             	or     %rcx,%rsi
+  800e47:	40 f6 c6 07          	test   $0x7,%sil
+  800e4b:	75 12                	jne    800e5f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e4d:	48 83 ef 08          	sub    $0x8,%rdi
+  800e51:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e55:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e59:	fd                   	std
+  800e5a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e5d:	fc                   	cld
+  800e5e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e5f:	48 83 ef 01          	sub    $0x1,%rdi
+  800e63:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e67:	fd                   	std
+  800e68:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e6a:	eb f1                	jmp    800e5d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e6c:	48 89 f2             	mov    %rsi,%rdx
+  800e6f:	48 09 c2             	or     %rax,%rdx
+  800e72:	48 09 ca             	or     %rcx,%rdx
+  800e75:	f6 c2 07             	test   $0x7,%dl
+  800e78:	75 0c                	jne    800e86 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e7a:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e7e:	48 89 c7             	mov    %rax,%rdi
+  800e81:	fc                   	cld
+  800e82:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e85:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e86:	48 89 c7             	mov    %rax,%rdi
+  800e89:	fc                   	cld
+  800e8a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e8c:	c3                   	ret
+
+0000000000800e8d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e8d:	55                   	push   %rbp
+  800e8e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e91:	48 b8 26 0e 80 00 00 	movabs $0x800e26,%rax
+  800e98:	00 00 00 
+  800e9b:	ff d0                	call   *%rax
+}
+  800e9d:	5d                   	pop    %rbp
+  800e9e:	c3                   	ret
+
+0000000000800e9f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e9f:	55                   	push   %rbp
+  800ea0:	48 89 e5             	mov    %rsp,%rbp
+  800ea3:	41 57                	push   %r15
+  800ea5:	41 56                	push   %r14
+  800ea7:	41 55                	push   %r13
+  800ea9:	41 54                	push   %r12
+  800eab:	53                   	push   %rbx
+  800eac:	48 83 ec 08          	sub    $0x8,%rsp
+  800eb0:	49 89 fe             	mov    %rdi,%r14
+  800eb3:	49 89 f7             	mov    %rsi,%r15
+  800eb6:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800eb9:	48 89 f7             	mov    %rsi,%rdi
+  800ebc:	48 b8 ee 0b 80 00 00 	movabs $0x800bee,%rax
+  800ec3:	00 00 00 
+  800ec6:	ff d0                	call   *%rax
+  800ec8:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800ecb:	48 89 de             	mov    %rbx,%rsi
+  800ece:	4c 89 f7             	mov    %r14,%rdi
+  800ed1:	48 b8 09 0c 80 00 00 	movabs $0x800c09,%rax
+  800ed8:	00 00 00 
+  800edb:	ff d0                	call   *%rax
+  800edd:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ee0:	48 39 c3             	cmp    %rax,%rbx
+  800ee3:	74 36                	je     800f1b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800ee5:	48 89 d8             	mov    %rbx,%rax
+  800ee8:	4c 29 e8             	sub    %r13,%rax
+  800eeb:	49 39 c4             	cmp    %rax,%r12
+  800eee:	73 31                	jae    800f21 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800ef0:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800ef5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ef9:	4c 89 fe             	mov    %r15,%rsi
+  800efc:	48 b8 8d 0e 80 00 00 	movabs $0x800e8d,%rax
+  800f03:	00 00 00 
+  800f06:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f08:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f0c:	48 83 c4 08          	add    $0x8,%rsp
+  800f10:	5b                   	pop    %rbx
+  800f11:	41 5c                	pop    %r12
+  800f13:	41 5d                	pop    %r13
+  800f15:	41 5e                	pop    %r14
+  800f17:	41 5f                	pop    %r15
+  800f19:	5d                   	pop    %rbp
+  800f1a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f1b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f1f:	eb eb                	jmp    800f0c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f21:	48 83 eb 01          	sub    $0x1,%rbx
+  800f25:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f29:	48 89 da             	mov    %rbx,%rdx
+  800f2c:	4c 89 fe             	mov    %r15,%rsi
+  800f2f:	48 b8 8d 0e 80 00 00 	movabs $0x800e8d,%rax
+  800f36:	00 00 00 
+  800f39:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f3b:	49 01 de             	add    %rbx,%r14
+  800f3e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f43:	eb c3                	jmp    800f08 <strlcat+0x69>
+
+0000000000800f45 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f45:	48 85 d2             	test   %rdx,%rdx
+  800f48:	74 2d                	je     800f77 <memcmp+0x32>
+  800f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f4f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f53:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f58:	44 38 c1             	cmp    %r8b,%cl
+  800f5b:	75 0f                	jne    800f6c <memcmp+0x27>
+    while (n-- > 0) {
+  800f5d:	48 83 c0 01          	add    $0x1,%rax
+  800f61:	48 39 c2             	cmp    %rax,%rdx
+  800f64:	75 e9                	jne    800f4f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f6c:	0f b6 c1             	movzbl %cl,%eax
+  800f6f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f73:	44 29 c0             	sub    %r8d,%eax
+  800f76:	c3                   	ret
+    return 0;
+  800f77:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f7c:	c3                   	ret
+
+0000000000800f7d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f7d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f81:	48 39 c7             	cmp    %rax,%rdi
+  800f84:	73 0f                	jae    800f95 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f86:	40 38 37             	cmp    %sil,(%rdi)
+  800f89:	74 0e                	je     800f99 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f8b:	48 83 c7 01          	add    $0x1,%rdi
+  800f8f:	48 39 f8             	cmp    %rdi,%rax
+  800f92:	75 f2                	jne    800f86 <memfind+0x9>
+  800f94:	c3                   	ret
+  800f95:	48 89 f8             	mov    %rdi,%rax
+  800f98:	c3                   	ret
+  800f99:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f9c:	c3                   	ret
+
+0000000000800f9d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f9d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fa0:	0f b6 37             	movzbl (%rdi),%esi
+  800fa3:	40 80 fe 20          	cmp    $0x20,%sil
+  800fa7:	74 06                	je     800faf <strtol+0x12>
+  800fa9:	40 80 fe 09          	cmp    $0x9,%sil
+  800fad:	75 13                	jne    800fc2 <strtol+0x25>
+  800faf:	48 83 c7 01          	add    $0x1,%rdi
+  800fb3:	0f b6 37             	movzbl (%rdi),%esi
+  800fb6:	40 80 fe 20          	cmp    $0x20,%sil
+  800fba:	74 f3                	je     800faf <strtol+0x12>
+  800fbc:	40 80 fe 09          	cmp    $0x9,%sil
+  800fc0:	74 ed                	je     800faf <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800fc2:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800fc5:	83 e0 fd             	and    $0xfffffffd,%eax
+  800fc8:	3c 01                	cmp    $0x1,%al
+  800fca:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fce:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800fd4:	75 0f                	jne    800fe5 <strtol+0x48>
+  800fd6:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800fd9:	74 14                	je     800fef <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800fdb:	85 d2                	test   %edx,%edx
+  800fdd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fe2:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800fe5:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800fea:	4c 63 ca             	movslq %edx,%r9
+  800fed:	eb 36                	jmp    801025 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fef:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ff3:	74 0f                	je     801004 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ff5:	85 d2                	test   %edx,%edx
+  800ff7:	75 ec                	jne    800fe5 <strtol+0x48>
+        s++;
+  800ff9:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ffd:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801002:	eb e1                	jmp    800fe5 <strtol+0x48>
+        s += 2;
+  801004:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801008:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80100d:	eb d6                	jmp    800fe5 <strtol+0x48>
+            dig -= '0';
+  80100f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801012:	44 0f b6 c1          	movzbl %cl,%r8d
+  801016:	41 39 d0             	cmp    %edx,%r8d
+  801019:	7d 21                	jge    80103c <strtol+0x9f>
+        val = val * base + dig;
+  80101b:	49 0f af c1          	imul   %r9,%rax
+  80101f:	0f b6 c9             	movzbl %cl,%ecx
+  801022:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801025:	48 83 c7 01          	add    $0x1,%rdi
+  801029:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80102d:	80 f9 39             	cmp    $0x39,%cl
+  801030:	76 dd                	jbe    80100f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801032:	80 f9 7b             	cmp    $0x7b,%cl
+  801035:	77 05                	ja     80103c <strtol+0x9f>
+            dig -= 'a' - 10;
+  801037:	83 e9 57             	sub    $0x57,%ecx
+  80103a:	eb d6                	jmp    801012 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80103c:	4d 85 d2             	test   %r10,%r10
+  80103f:	74 03                	je     801044 <strtol+0xa7>
+  801041:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801044:	48 89 c2             	mov    %rax,%rdx
+  801047:	48 f7 da             	neg    %rdx
+  80104a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80104e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801052:	c3                   	ret
+
+0000000000801053 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801053:	55                   	push   %rbp
+  801054:	48 89 e5             	mov    %rsp,%rbp
+  801057:	53                   	push   %rbx
+  801058:	48 89 fa             	mov    %rdi,%rdx
+  80105b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80105e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801063:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801068:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80106d:	be 00 00 00 00       	mov    $0x0,%esi
+  801072:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801078:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80107a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80107e:	c9                   	leave
+  80107f:	c3                   	ret
+
+0000000000801080 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801080:	55                   	push   %rbp
+  801081:	48 89 e5             	mov    %rsp,%rbp
+  801084:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801085:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80108a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80108f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801094:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801099:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80109e:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010a9:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010af:	c9                   	leave
+  8010b0:	c3                   	ret
+
+00000000008010b1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8010b1:	55                   	push   %rbp
+  8010b2:	48 89 e5             	mov    %rsp,%rbp
+  8010b5:	53                   	push   %rbx
+  8010b6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010ba:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010bd:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010de:	48 85 c0             	test   %rax,%rax
+  8010e1:	7f 06                	jg     8010e9 <sys_env_destroy+0x38>
+}
+  8010e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010e7:	c9                   	leave
+  8010e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010e9:	49 89 c0             	mov    %rax,%r8
+  8010ec:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8010f1:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  8010f8:	00 00 00 
+  8010fb:	be 26 00 00 00       	mov    $0x26,%esi
+  801100:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  801107:	00 00 00 
+  80110a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80110f:	49 b9 d6 2c 80 00 00 	movabs $0x802cd6,%r9
+  801116:	00 00 00 
+  801119:	41 ff d1             	call   *%r9
+
+000000000080111c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80111c:	55                   	push   %rbp
+  80111d:	48 89 e5             	mov    %rsp,%rbp
+  801120:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801121:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801126:	ba 00 00 00 00       	mov    $0x0,%edx
+  80112b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801130:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801135:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80113a:	be 00 00 00 00       	mov    $0x0,%esi
+  80113f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801145:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801147:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80114b:	c9                   	leave
+  80114c:	c3                   	ret
+
+000000000080114d <sys_yield>:
+
+void
+sys_yield(void) {
+  80114d:	55                   	push   %rbp
+  80114e:	48 89 e5             	mov    %rsp,%rbp
+  801151:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801152:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801157:	ba 00 00 00 00       	mov    $0x0,%edx
+  80115c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801161:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801166:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80116b:	be 00 00 00 00       	mov    $0x0,%esi
+  801170:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801176:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801178:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80117c:	c9                   	leave
+  80117d:	c3                   	ret
+
+000000000080117e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80117e:	55                   	push   %rbp
+  80117f:	48 89 e5             	mov    %rsp,%rbp
+  801182:	53                   	push   %rbx
+  801183:	48 89 fa             	mov    %rdi,%rdx
+  801186:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801189:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80118e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801195:	00 00 00 
+  801198:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80119d:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011a8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ae:	c9                   	leave
+  8011af:	c3                   	ret
+
+00000000008011b0 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011b0:	55                   	push   %rbp
+  8011b1:	48 89 e5             	mov    %rsp,%rbp
+  8011b4:	53                   	push   %rbx
+  8011b5:	49 89 f8             	mov    %rdi,%r8
+  8011b8:	48 89 d3             	mov    %rdx,%rbx
+  8011bb:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011be:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011c3:	4c 89 c2             	mov    %r8,%rdx
+  8011c6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011d4:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8011d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011da:	c9                   	leave
+  8011db:	c3                   	ret
+
+00000000008011dc <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8011dc:	55                   	push   %rbp
+  8011dd:	48 89 e5             	mov    %rsp,%rbp
+  8011e0:	53                   	push   %rbx
+  8011e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8011e5:	89 f8                	mov    %edi,%eax
+  8011e7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8011ea:	48 63 f9             	movslq %ecx,%rdi
+  8011ed:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f0:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011f5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801203:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801205:	48 85 c0             	test   %rax,%rax
+  801208:	7f 06                	jg     801210 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80120a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80120e:	c9                   	leave
+  80120f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801210:	49 89 c0             	mov    %rax,%r8
+  801213:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801218:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  80121f:	00 00 00 
+  801222:	be 26 00 00 00       	mov    $0x26,%esi
+  801227:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  80122e:	00 00 00 
+  801231:	b8 00 00 00 00       	mov    $0x0,%eax
+  801236:	49 b9 d6 2c 80 00 00 	movabs $0x802cd6,%r9
+  80123d:	00 00 00 
+  801240:	41 ff d1             	call   *%r9
+
+0000000000801243 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801243:	55                   	push   %rbp
+  801244:	48 89 e5             	mov    %rsp,%rbp
+  801247:	53                   	push   %rbx
+  801248:	48 83 ec 08          	sub    $0x8,%rsp
+  80124c:	89 f8                	mov    %edi,%eax
+  80124e:	49 89 f2             	mov    %rsi,%r10
+  801251:	48 89 cf             	mov    %rcx,%rdi
+  801254:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801257:	48 63 da             	movslq %edx,%rbx
+  80125a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80125d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801262:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801265:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801268:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80126a:	48 85 c0             	test   %rax,%rax
+  80126d:	7f 06                	jg     801275 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80126f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801273:	c9                   	leave
+  801274:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801275:	49 89 c0             	mov    %rax,%r8
+  801278:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80127d:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  801284:	00 00 00 
+  801287:	be 26 00 00 00       	mov    $0x26,%esi
+  80128c:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  801293:	00 00 00 
+  801296:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129b:	49 b9 d6 2c 80 00 00 	movabs $0x802cd6,%r9
+  8012a2:	00 00 00 
+  8012a5:	41 ff d1             	call   *%r9
+
+00000000008012a8 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012a8:	55                   	push   %rbp
+  8012a9:	48 89 e5             	mov    %rsp,%rbp
+  8012ac:	53                   	push   %rbx
+  8012ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8012b1:	48 89 f1             	mov    %rsi,%rcx
+  8012b4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012b7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ba:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012cf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012d1:	48 85 c0             	test   %rax,%rax
+  8012d4:	7f 06                	jg     8012dc <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8012d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012da:	c9                   	leave
+  8012db:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012dc:	49 89 c0             	mov    %rax,%r8
+  8012df:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8012e4:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  8012eb:	00 00 00 
+  8012ee:	be 26 00 00 00       	mov    $0x26,%esi
+  8012f3:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  8012fa:	00 00 00 
+  8012fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801302:	49 b9 d6 2c 80 00 00 	movabs $0x802cd6,%r9
+  801309:	00 00 00 
+  80130c:	41 ff d1             	call   *%r9
+
+000000000080130f <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  80130f:	55                   	push   %rbp
+  801310:	48 89 e5             	mov    %rsp,%rbp
+  801313:	53                   	push   %rbx
+  801314:	48 83 ec 08          	sub    $0x8,%rsp
+  801318:	89 f8                	mov    %edi,%eax
+  80131a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  80131d:	48 63 f9             	movslq %ecx,%rdi
+  801320:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801323:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801328:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80132b:	be 00 00 00 00       	mov    $0x0,%esi
+  801330:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801336:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801338:	48 85 c0             	test   %rax,%rax
+  80133b:	7f 06                	jg     801343 <sys_region_advise+0x34>
+}
+  80133d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801341:	c9                   	leave
+  801342:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801343:	49 89 c0             	mov    %rax,%r8
+  801346:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80134b:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  801352:	00 00 00 
+  801355:	be 26 00 00 00       	mov    $0x26,%esi
+  80135a:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  801361:	00 00 00 
+  801364:	b8 00 00 00 00       	mov    $0x0,%eax
+  801369:	49 b9 d6 2c 80 00 00 	movabs $0x802cd6,%r9
+  801370:	00 00 00 
+  801373:	41 ff d1             	call   *%r9
+
+0000000000801376 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801376:	55                   	push   %rbp
+  801377:	48 89 e5             	mov    %rsp,%rbp
+  80137a:	53                   	push   %rbx
+  80137b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80137f:	48 63 ce             	movslq %esi,%rcx
+  801382:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801385:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80138a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801394:	be 00 00 00 00       	mov    $0x0,%esi
+  801399:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80139f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013a1:	48 85 c0             	test   %rax,%rax
+  8013a4:	7f 06                	jg     8013ac <sys_env_set_nice+0x36>
+}
+  8013a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013aa:	c9                   	leave
+  8013ab:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ac:	49 89 c0             	mov    %rax,%r8
+  8013af:	b9 15 00 00 00       	mov    $0x15,%ecx
+  8013b4:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  8013bb:	00 00 00 
+  8013be:	be 26 00 00 00       	mov    $0x26,%esi
+  8013c3:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  8013ca:	00 00 00 
+  8013cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d2:	49 b9 d6 2c 80 00 00 	movabs $0x802cd6,%r9
+  8013d9:	00 00 00 
+  8013dc:	41 ff d1             	call   *%r9
+
+00000000008013df <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8013df:	55                   	push   %rbp
+  8013e0:	48 89 e5             	mov    %rsp,%rbp
+  8013e3:	53                   	push   %rbx
+  8013e4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8013e8:	48 63 ce             	movslq %esi,%rcx
+  8013eb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ee:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801402:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801408:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80140a:	48 85 c0             	test   %rax,%rax
+  80140d:	7f 06                	jg     801415 <sys_env_set_status+0x36>
+}
+  80140f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801413:	c9                   	leave
+  801414:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801415:	49 89 c0             	mov    %rax,%r8
+  801418:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80141d:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  801424:	00 00 00 
+  801427:	be 26 00 00 00       	mov    $0x26,%esi
+  80142c:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  801433:	00 00 00 
+  801436:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143b:	49 b9 d6 2c 80 00 00 	movabs $0x802cd6,%r9
+  801442:	00 00 00 
+  801445:	41 ff d1             	call   *%r9
+
+0000000000801448 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801448:	55                   	push   %rbp
+  801449:	48 89 e5             	mov    %rsp,%rbp
+  80144c:	53                   	push   %rbx
+  80144d:	48 83 ec 08          	sub    $0x8,%rsp
+  801451:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801454:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801457:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80145c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801461:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801466:	be 00 00 00 00       	mov    $0x0,%esi
+  80146b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801471:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801473:	48 85 c0             	test   %rax,%rax
+  801476:	7f 06                	jg     80147e <sys_env_set_trapframe+0x36>
+}
+  801478:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147c:	c9                   	leave
+  80147d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80147e:	49 89 c0             	mov    %rax,%r8
+  801481:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801486:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  80148d:	00 00 00 
+  801490:	be 26 00 00 00       	mov    $0x26,%esi
+  801495:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  80149c:	00 00 00 
+  80149f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a4:	49 b9 d6 2c 80 00 00 	movabs $0x802cd6,%r9
+  8014ab:	00 00 00 
+  8014ae:	41 ff d1             	call   *%r9
+
+00000000008014b1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8014b1:	55                   	push   %rbp
+  8014b2:	48 89 e5             	mov    %rsp,%rbp
+  8014b5:	53                   	push   %rbx
+  8014b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ba:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8014bd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c0:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014da:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014dc:	48 85 c0             	test   %rax,%rax
+  8014df:	7f 06                	jg     8014e7 <sys_env_set_pgfault_upcall+0x36>
+}
+  8014e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e5:	c9                   	leave
+  8014e6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e7:	49 89 c0             	mov    %rax,%r8
+  8014ea:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8014ef:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  8014f6:	00 00 00 
+  8014f9:	be 26 00 00 00       	mov    $0x26,%esi
+  8014fe:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  801505:	00 00 00 
+  801508:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150d:	49 b9 d6 2c 80 00 00 	movabs $0x802cd6,%r9
+  801514:	00 00 00 
+  801517:	41 ff d1             	call   *%r9
+
+000000000080151a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80151a:	55                   	push   %rbp
+  80151b:	48 89 e5             	mov    %rsp,%rbp
+  80151e:	53                   	push   %rbx
+  80151f:	89 f8                	mov    %edi,%eax
+  801521:	49 89 f1             	mov    %rsi,%r9
+  801524:	48 89 d3             	mov    %rdx,%rbx
+  801527:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80152a:	49 63 f0             	movslq %r8d,%rsi
+  80152d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801530:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801535:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801538:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153e:	cd 30                	int    $0x30
+}
+  801540:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801544:	c9                   	leave
+  801545:	c3                   	ret
+
+0000000000801546 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801546:	55                   	push   %rbp
+  801547:	48 89 e5             	mov    %rsp,%rbp
+  80154a:	53                   	push   %rbx
+  80154b:	48 83 ec 08          	sub    $0x8,%rsp
+  80154f:	48 89 fa             	mov    %rdi,%rdx
+  801552:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801555:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80155a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801564:	be 00 00 00 00       	mov    $0x0,%esi
+  801569:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80156f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801571:	48 85 c0             	test   %rax,%rax
+  801574:	7f 06                	jg     80157c <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801576:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80157a:	c9                   	leave
+  80157b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80157c:	49 89 c0             	mov    %rax,%r8
+  80157f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801584:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  80158b:	00 00 00 
+  80158e:	be 26 00 00 00       	mov    $0x26,%esi
+  801593:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  80159a:	00 00 00 
+  80159d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a2:	49 b9 d6 2c 80 00 00 	movabs $0x802cd6,%r9
+  8015a9:	00 00 00 
+  8015ac:	41 ff d1             	call   *%r9
+
+00000000008015af <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8015af:	55                   	push   %rbp
+  8015b0:	48 89 e5             	mov    %rsp,%rbp
+  8015b3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b4:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015be:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d8:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015de:	c9                   	leave
+  8015df:	c3                   	ret
+
+00000000008015e0 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8015e0:	55                   	push   %rbp
+  8015e1:	48 89 e5             	mov    %rsp,%rbp
+  8015e4:	53                   	push   %rbx
+  8015e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8015e9:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8015ec:	48 63 ce             	movslq %esi,%rcx
+  8015ef:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801601:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801607:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801609:	48 85 c0             	test   %rax,%rax
+  80160c:	7f 06                	jg     801614 <sys_sigqueue+0x34>
+}
+  80160e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801612:	c9                   	leave
+  801613:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801614:	49 89 c0             	mov    %rax,%r8
+  801617:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80161c:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  801623:	00 00 00 
+  801626:	be 26 00 00 00       	mov    $0x26,%esi
+  80162b:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  801632:	00 00 00 
+  801635:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163a:	49 b9 d6 2c 80 00 00 	movabs $0x802cd6,%r9
+  801641:	00 00 00 
+  801644:	41 ff d1             	call   *%r9
+
+0000000000801647 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801647:	55                   	push   %rbp
+  801648:	48 89 e5             	mov    %rsp,%rbp
+  80164b:	53                   	push   %rbx
+  80164c:	48 83 ec 08          	sub    $0x8,%rsp
+  801650:	48 89 fa             	mov    %rdi,%rdx
+  801653:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801656:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80165b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801660:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801665:	be 00 00 00 00       	mov    $0x0,%esi
+  80166a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801670:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801672:	48 85 c0             	test   %rax,%rax
+  801675:	7f 06                	jg     80167d <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801677:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167b:	c9                   	leave
+  80167c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80167d:	49 89 c0             	mov    %rax,%r8
+  801680:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801685:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  80168c:	00 00 00 
+  80168f:	be 26 00 00 00       	mov    $0x26,%esi
+  801694:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  80169b:	00 00 00 
+  80169e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a3:	49 b9 d6 2c 80 00 00 	movabs $0x802cd6,%r9
+  8016aa:	00 00 00 
+  8016ad:	41 ff d1             	call   *%r9
+
+00000000008016b0 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  8016b0:	55                   	push   %rbp
+  8016b1:	48 89 e5             	mov    %rsp,%rbp
+  8016b4:	53                   	push   %rbx
+  8016b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8016b9:	48 89 f1             	mov    %rsi,%rcx
+  8016bc:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  8016bf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c2:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016d9:	48 85 c0             	test   %rax,%rax
+  8016dc:	7f 06                	jg     8016e4 <sys_sigaction+0x34>
+}
+  8016de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e2:	c9                   	leave
+  8016e3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016e4:	49 89 c0             	mov    %rax,%r8
+  8016e7:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8016ec:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  8016f3:	00 00 00 
+  8016f6:	be 26 00 00 00       	mov    $0x26,%esi
+  8016fb:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  801702:	00 00 00 
+  801705:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170a:	49 b9 d6 2c 80 00 00 	movabs $0x802cd6,%r9
+  801711:	00 00 00 
+  801714:	41 ff d1             	call   *%r9
+
+0000000000801717 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801717:	55                   	push   %rbp
+  801718:	48 89 e5             	mov    %rsp,%rbp
+  80171b:	53                   	push   %rbx
+  80171c:	48 83 ec 08          	sub    $0x8,%rsp
+  801720:	48 89 f1             	mov    %rsi,%rcx
+  801723:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801726:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801729:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80172e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801733:	be 00 00 00 00       	mov    $0x0,%esi
+  801738:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80173e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801740:	48 85 c0             	test   %rax,%rax
+  801743:	7f 06                	jg     80174b <sys_sigprocmask+0x34>
+}
+  801745:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801749:	c9                   	leave
+  80174a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80174b:	49 89 c0             	mov    %rax,%r8
+  80174e:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801753:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  80175a:	00 00 00 
+  80175d:	be 26 00 00 00       	mov    $0x26,%esi
+  801762:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  801769:	00 00 00 
+  80176c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801771:	49 b9 d6 2c 80 00 00 	movabs $0x802cd6,%r9
+  801778:	00 00 00 
+  80177b:	41 ff d1             	call   *%r9
+
+000000000080177e <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80177e:	55                   	push   %rbp
+  80177f:	48 89 e5             	mov    %rsp,%rbp
+  801782:	41 54                	push   %r12
+  801784:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801785:	b8 08 00 00 00       	mov    $0x8,%eax
+  80178a:	cd 30                	int    $0x30
+  80178c:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  80178f:	85 c0                	test   %eax,%eax
+  801791:	78 76                	js     801809 <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  801793:	74 7c                	je     801811 <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  801795:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80179b:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8017a2:	00 00 00 
+  8017a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017aa:	89 c2                	mov    %eax,%edx
+  8017ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017b6:	48 b8 43 12 80 00 00 	movabs $0x801243,%rax
+  8017bd:	00 00 00 
+  8017c0:	ff d0                	call   *%rax
+  8017c2:	85 c0                	test   %eax,%eax
+  8017c4:	75 7a                	jne    801840 <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  8017c6:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  8017cd:	00 00 00 
+  8017d0:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8017d7:	44 89 e7             	mov    %r12d,%edi
+  8017da:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  8017e1:	00 00 00 
+  8017e4:	ff d0                	call   *%rax
+  8017e6:	85 c0                	test   %eax,%eax
+  8017e8:	75 5e                	jne    801848 <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  8017ea:	be 02 00 00 00       	mov    $0x2,%esi
+  8017ef:	44 89 e7             	mov    %r12d,%edi
+  8017f2:	48 b8 df 13 80 00 00 	movabs $0x8013df,%rax
+  8017f9:	00 00 00 
+  8017fc:	ff d0                	call   *%rax
+        return -1;
+  8017fe:	85 c0                	test   %eax,%eax
+  801800:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801805:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  801809:	44 89 e0             	mov    %r12d,%eax
+  80180c:	5b                   	pop    %rbx
+  80180d:	41 5c                	pop    %r12
+  80180f:	5d                   	pop    %rbp
+  801810:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  801811:	48 b8 1c 11 80 00 00 	movabs $0x80111c,%rax
+  801818:	00 00 00 
+  80181b:	ff d0                	call   *%rax
+  80181d:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  801820:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  801827:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80182e:	00 00 00 
+  801831:	48 01 d0             	add    %rdx,%rax
+  801834:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  80183b:	00 00 00 
+        return 0;
+  80183e:	eb c9                	jmp    801809 <fork+0x8b>
+        return -1;
+  801840:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801846:	eb c1                	jmp    801809 <fork+0x8b>
+        return -1;
+  801848:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80184e:	eb b9                	jmp    801809 <fork+0x8b>
+
+0000000000801850 <sfork>:
+
+envid_t
+sfork() {
+  801850:	55                   	push   %rbp
+  801851:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801854:	48 ba 5d 33 80 00 00 	movabs $0x80335d,%rdx
+  80185b:	00 00 00 
+  80185e:	be 2e 00 00 00       	mov    $0x2e,%esi
+  801863:	48 bf 78 33 80 00 00 	movabs $0x803378,%rdi
+  80186a:	00 00 00 
+  80186d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801872:	48 b9 d6 2c 80 00 00 	movabs $0x802cd6,%rcx
+  801879:	00 00 00 
+  80187c:	ff d1                	call   *%rcx
+
+000000000080187e <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80187e:	55                   	push   %rbp
+  80187f:	48 89 e5             	mov    %rsp,%rbp
+  801882:	41 54                	push   %r12
+  801884:	53                   	push   %rbx
+  801885:	48 89 fb             	mov    %rdi,%rbx
+  801888:	48 89 f7             	mov    %rsi,%rdi
+  80188b:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  80188e:	48 85 f6             	test   %rsi,%rsi
+  801891:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801898:	00 00 00 
+  80189b:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  80189f:	be 00 10 00 00       	mov    $0x1000,%esi
+  8018a4:	48 b8 46 15 80 00 00 	movabs $0x801546,%rax
+  8018ab:	00 00 00 
+  8018ae:	ff d0                	call   *%rax
+    if (res < 0) {
+  8018b0:	85 c0                	test   %eax,%eax
+  8018b2:	78 45                	js     8018f9 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8018b4:	48 85 db             	test   %rbx,%rbx
+  8018b7:	74 12                	je     8018cb <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8018b9:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  8018c0:	00 00 00 
+  8018c3:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8018c9:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  8018cb:	4d 85 e4             	test   %r12,%r12
+  8018ce:	74 14                	je     8018e4 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  8018d0:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  8018d7:	00 00 00 
+  8018da:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8018e0:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  8018e4:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  8018eb:	00 00 00 
+  8018ee:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  8018f4:	5b                   	pop    %rbx
+  8018f5:	41 5c                	pop    %r12
+  8018f7:	5d                   	pop    %rbp
+  8018f8:	c3                   	ret
+        if (from_env_store)
+  8018f9:	48 85 db             	test   %rbx,%rbx
+  8018fc:	74 06                	je     801904 <ipc_recv+0x86>
+            *from_env_store = 0;
+  8018fe:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  801904:	4d 85 e4             	test   %r12,%r12
+  801907:	74 eb                	je     8018f4 <ipc_recv+0x76>
+            *perm_store = 0;
+  801909:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801910:	00 
+  801911:	eb e1                	jmp    8018f4 <ipc_recv+0x76>
+
+0000000000801913 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801913:	55                   	push   %rbp
+  801914:	48 89 e5             	mov    %rsp,%rbp
+  801917:	41 57                	push   %r15
+  801919:	41 56                	push   %r14
+  80191b:	41 55                	push   %r13
+  80191d:	41 54                	push   %r12
+  80191f:	53                   	push   %rbx
+  801920:	48 83 ec 18          	sub    $0x18,%rsp
+  801924:	41 89 fd             	mov    %edi,%r13d
+  801927:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80192a:	48 89 d3             	mov    %rdx,%rbx
+  80192d:	49 89 cc             	mov    %rcx,%r12
+  801930:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  801934:	48 85 d2             	test   %rdx,%rdx
+  801937:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80193e:	00 00 00 
+  801941:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  801945:	49 be 1a 15 80 00 00 	movabs $0x80151a,%r14
+  80194c:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  80194f:	49 bf 4d 11 80 00 00 	movabs $0x80114d,%r15
+  801956:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  801959:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80195c:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  801960:	4c 89 e1             	mov    %r12,%rcx
+  801963:	48 89 da             	mov    %rbx,%rdx
+  801966:	44 89 ef             	mov    %r13d,%edi
+  801969:	41 ff d6             	call   *%r14
+        if (res == 0)
+  80196c:	85 c0                	test   %eax,%eax
+  80196e:	74 34                	je     8019a4 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  801970:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801973:	75 05                	jne    80197a <ipc_send+0x67>
+        sys_yield();
+  801975:	41 ff d7             	call   *%r15
+    while (true) {
+  801978:	eb df                	jmp    801959 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  80197a:	48 ba 83 33 80 00 00 	movabs $0x803383,%rdx
+  801981:	00 00 00 
+  801984:	be 3e 00 00 00       	mov    $0x3e,%esi
+  801989:	48 bf 9c 33 80 00 00 	movabs $0x80339c,%rdi
+  801990:	00 00 00 
+  801993:	b8 00 00 00 00       	mov    $0x0,%eax
+  801998:	48 b9 d6 2c 80 00 00 	movabs $0x802cd6,%rcx
+  80199f:	00 00 00 
+  8019a2:	ff d1                	call   *%rcx
+    }
+}
+  8019a4:	48 83 c4 18          	add    $0x18,%rsp
+  8019a8:	5b                   	pop    %rbx
+  8019a9:	41 5c                	pop    %r12
+  8019ab:	41 5d                	pop    %r13
+  8019ad:	41 5e                	pop    %r14
+  8019af:	41 5f                	pop    %r15
+  8019b1:	5d                   	pop    %rbp
+  8019b2:	c3                   	ret
+
+00000000008019b3 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8019b3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8019b8:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8019bf:	00 00 00 
+  8019c2:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  8019c9:	48 01 ca             	add    %rcx,%rdx
+  8019cc:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8019d2:	39 fa                	cmp    %edi,%edx
+  8019d4:	74 12                	je     8019e8 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8019d6:	48 83 c0 01          	add    $0x1,%rax
+  8019da:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8019e0:	75 e0                	jne    8019c2 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8019e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019e7:	c3                   	ret
+            return envs[i].env_id;
+  8019e8:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8019ef:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8019f6:	00 00 00 
+  8019f9:	48 01 d0             	add    %rdx,%rax
+  8019fc:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801a02:	c3                   	ret
+
+0000000000801a03 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a03:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a0a:	ff ff ff 
+  801a0d:	48 01 f8             	add    %rdi,%rax
+  801a10:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a14:	c3                   	ret
+
+0000000000801a15 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a15:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a1c:	ff ff ff 
+  801a1f:	48 01 f8             	add    %rdi,%rax
+  801a22:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a26:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801a2c:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801a30:	c3                   	ret
+
+0000000000801a31 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801a31:	55                   	push   %rbp
+  801a32:	48 89 e5             	mov    %rsp,%rbp
+  801a35:	41 57                	push   %r15
+  801a37:	41 56                	push   %r14
+  801a39:	41 55                	push   %r13
+  801a3b:	41 54                	push   %r12
+  801a3d:	53                   	push   %rbx
+  801a3e:	48 83 ec 08          	sub    $0x8,%rsp
+  801a42:	49 89 ff             	mov    %rdi,%r15
+  801a45:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a4a:	49 bd af 29 80 00 00 	movabs $0x8029af,%r13
+  801a51:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801a54:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801a5a:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801a5d:	48 89 df             	mov    %rbx,%rdi
+  801a60:	41 ff d5             	call   *%r13
+  801a63:	83 e0 04             	and    $0x4,%eax
+  801a66:	74 17                	je     801a7f <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801a68:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a6f:	4c 39 f3             	cmp    %r14,%rbx
+  801a72:	75 e6                	jne    801a5a <fd_alloc+0x29>
+  801a74:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a7a:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a7f:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a82:	48 83 c4 08          	add    $0x8,%rsp
+  801a86:	5b                   	pop    %rbx
+  801a87:	41 5c                	pop    %r12
+  801a89:	41 5d                	pop    %r13
+  801a8b:	41 5e                	pop    %r14
+  801a8d:	41 5f                	pop    %r15
+  801a8f:	5d                   	pop    %rbp
+  801a90:	c3                   	ret
+
+0000000000801a91 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a91:	83 ff 1f             	cmp    $0x1f,%edi
+  801a94:	77 39                	ja     801acf <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a96:	55                   	push   %rbp
+  801a97:	48 89 e5             	mov    %rsp,%rbp
+  801a9a:	41 54                	push   %r12
+  801a9c:	53                   	push   %rbx
+  801a9d:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801aa0:	48 63 df             	movslq %edi,%rbx
+  801aa3:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801aaa:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801aae:	48 89 df             	mov    %rbx,%rdi
+  801ab1:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  801ab8:	00 00 00 
+  801abb:	ff d0                	call   *%rax
+  801abd:	a8 04                	test   $0x4,%al
+  801abf:	74 14                	je     801ad5 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801ac1:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801aca:	5b                   	pop    %rbx
+  801acb:	41 5c                	pop    %r12
+  801acd:	5d                   	pop    %rbp
+  801ace:	c3                   	ret
+        return -E_INVAL;
+  801acf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801ad4:	c3                   	ret
+        return -E_INVAL;
+  801ad5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ada:	eb ee                	jmp    801aca <fd_lookup+0x39>
+
+0000000000801adc <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801adc:	55                   	push   %rbp
+  801add:	48 89 e5             	mov    %rsp,%rbp
+  801ae0:	41 54                	push   %r12
+  801ae2:	53                   	push   %rbx
+  801ae3:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801ae6:	48 b8 40 34 80 00 00 	movabs $0x803440,%rax
+  801aed:	00 00 00 
+  801af0:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801af7:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801afa:	39 3b                	cmp    %edi,(%rbx)
+  801afc:	74 47                	je     801b45 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801afe:	48 83 c0 08          	add    $0x8,%rax
+  801b02:	48 8b 18             	mov    (%rax),%rbx
+  801b05:	48 85 db             	test   %rbx,%rbx
+  801b08:	75 f0                	jne    801afa <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b0a:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801b11:	00 00 00 
+  801b14:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b1a:	89 fa                	mov    %edi,%edx
+  801b1c:	48 bf a8 33 80 00 00 	movabs $0x8033a8,%rdi
+  801b23:	00 00 00 
+  801b26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2b:	48 b9 07 03 80 00 00 	movabs $0x800307,%rcx
+  801b32:	00 00 00 
+  801b35:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b3c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b40:	5b                   	pop    %rbx
+  801b41:	41 5c                	pop    %r12
+  801b43:	5d                   	pop    %rbp
+  801b44:	c3                   	ret
+            return 0;
+  801b45:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4a:	eb f0                	jmp    801b3c <dev_lookup+0x60>
+
+0000000000801b4c <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b4c:	55                   	push   %rbp
+  801b4d:	48 89 e5             	mov    %rsp,%rbp
+  801b50:	41 55                	push   %r13
+  801b52:	41 54                	push   %r12
+  801b54:	53                   	push   %rbx
+  801b55:	48 83 ec 18          	sub    $0x18,%rsp
+  801b59:	48 89 fb             	mov    %rdi,%rbx
+  801b5c:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b5f:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b66:	ff ff ff 
+  801b69:	48 01 df             	add    %rbx,%rdi
+  801b6c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b70:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b74:	48 b8 91 1a 80 00 00 	movabs $0x801a91,%rax
+  801b7b:	00 00 00 
+  801b7e:	ff d0                	call   *%rax
+  801b80:	41 89 c5             	mov    %eax,%r13d
+  801b83:	85 c0                	test   %eax,%eax
+  801b85:	78 06                	js     801b8d <fd_close+0x41>
+  801b87:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b8b:	74 1a                	je     801ba7 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b8d:	45 84 e4             	test   %r12b,%r12b
+  801b90:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b95:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b99:	44 89 e8             	mov    %r13d,%eax
+  801b9c:	48 83 c4 18          	add    $0x18,%rsp
+  801ba0:	5b                   	pop    %rbx
+  801ba1:	41 5c                	pop    %r12
+  801ba3:	41 5d                	pop    %r13
+  801ba5:	5d                   	pop    %rbp
+  801ba6:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ba7:	8b 3b                	mov    (%rbx),%edi
+  801ba9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bad:	48 b8 dc 1a 80 00 00 	movabs $0x801adc,%rax
+  801bb4:	00 00 00 
+  801bb7:	ff d0                	call   *%rax
+  801bb9:	41 89 c5             	mov    %eax,%r13d
+  801bbc:	85 c0                	test   %eax,%eax
+  801bbe:	78 1b                	js     801bdb <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801bc0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bc4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801bc8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801bce:	48 85 c0             	test   %rax,%rax
+  801bd1:	74 08                	je     801bdb <fd_close+0x8f>
+  801bd3:	48 89 df             	mov    %rbx,%rdi
+  801bd6:	ff d0                	call   *%rax
+  801bd8:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801bdb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801be0:	48 89 de             	mov    %rbx,%rsi
+  801be3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801be8:	48 b8 a8 12 80 00 00 	movabs $0x8012a8,%rax
+  801bef:	00 00 00 
+  801bf2:	ff d0                	call   *%rax
+    return res;
+  801bf4:	eb a3                	jmp    801b99 <fd_close+0x4d>
+
+0000000000801bf6 <close>:
+
+int
+close(int fdnum) {
+  801bf6:	55                   	push   %rbp
+  801bf7:	48 89 e5             	mov    %rsp,%rbp
+  801bfa:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801bfe:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c02:	48 b8 91 1a 80 00 00 	movabs $0x801a91,%rax
+  801c09:	00 00 00 
+  801c0c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c0e:	85 c0                	test   %eax,%eax
+  801c10:	78 15                	js     801c27 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c12:	be 01 00 00 00       	mov    $0x1,%esi
+  801c17:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c1b:	48 b8 4c 1b 80 00 00 	movabs $0x801b4c,%rax
+  801c22:	00 00 00 
+  801c25:	ff d0                	call   *%rax
+}
+  801c27:	c9                   	leave
+  801c28:	c3                   	ret
+
+0000000000801c29 <close_all>:
+
+void
+close_all(void) {
+  801c29:	55                   	push   %rbp
+  801c2a:	48 89 e5             	mov    %rsp,%rbp
+  801c2d:	41 54                	push   %r12
+  801c2f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c35:	49 bc f6 1b 80 00 00 	movabs $0x801bf6,%r12
+  801c3c:	00 00 00 
+  801c3f:	89 df                	mov    %ebx,%edi
+  801c41:	41 ff d4             	call   *%r12
+  801c44:	83 c3 01             	add    $0x1,%ebx
+  801c47:	83 fb 20             	cmp    $0x20,%ebx
+  801c4a:	75 f3                	jne    801c3f <close_all+0x16>
+}
+  801c4c:	5b                   	pop    %rbx
+  801c4d:	41 5c                	pop    %r12
+  801c4f:	5d                   	pop    %rbp
+  801c50:	c3                   	ret
+
+0000000000801c51 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c51:	55                   	push   %rbp
+  801c52:	48 89 e5             	mov    %rsp,%rbp
+  801c55:	41 57                	push   %r15
+  801c57:	41 56                	push   %r14
+  801c59:	41 55                	push   %r13
+  801c5b:	41 54                	push   %r12
+  801c5d:	53                   	push   %rbx
+  801c5e:	48 83 ec 18          	sub    $0x18,%rsp
+  801c62:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c65:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c69:	48 b8 91 1a 80 00 00 	movabs $0x801a91,%rax
+  801c70:	00 00 00 
+  801c73:	ff d0                	call   *%rax
+  801c75:	89 c3                	mov    %eax,%ebx
+  801c77:	85 c0                	test   %eax,%eax
+  801c79:	0f 88 b8 00 00 00    	js     801d37 <dup+0xe6>
+    close(newfdnum);
+  801c7f:	44 89 e7             	mov    %r12d,%edi
+  801c82:	48 b8 f6 1b 80 00 00 	movabs $0x801bf6,%rax
+  801c89:	00 00 00 
+  801c8c:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c8e:	4d 63 ec             	movslq %r12d,%r13
+  801c91:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c98:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c9c:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ca0:	4c 89 ff             	mov    %r15,%rdi
+  801ca3:	49 be 15 1a 80 00 00 	movabs $0x801a15,%r14
+  801caa:	00 00 00 
+  801cad:	41 ff d6             	call   *%r14
+  801cb0:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801cb3:	4c 89 ef             	mov    %r13,%rdi
+  801cb6:	41 ff d6             	call   *%r14
+  801cb9:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801cbc:	48 89 df             	mov    %rbx,%rdi
+  801cbf:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  801cc6:	00 00 00 
+  801cc9:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801ccb:	a8 04                	test   $0x4,%al
+  801ccd:	74 2b                	je     801cfa <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ccf:	41 89 c1             	mov    %eax,%r9d
+  801cd2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cd8:	4c 89 f1             	mov    %r14,%rcx
+  801cdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce0:	48 89 de             	mov    %rbx,%rsi
+  801ce3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ce8:	48 b8 43 12 80 00 00 	movabs $0x801243,%rax
+  801cef:	00 00 00 
+  801cf2:	ff d0                	call   *%rax
+  801cf4:	89 c3                	mov    %eax,%ebx
+  801cf6:	85 c0                	test   %eax,%eax
+  801cf8:	78 4e                	js     801d48 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801cfa:	4c 89 ff             	mov    %r15,%rdi
+  801cfd:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  801d04:	00 00 00 
+  801d07:	ff d0                	call   *%rax
+  801d09:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d0c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d12:	4c 89 e9             	mov    %r13,%rcx
+  801d15:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d1a:	4c 89 fe             	mov    %r15,%rsi
+  801d1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d22:	48 b8 43 12 80 00 00 	movabs $0x801243,%rax
+  801d29:	00 00 00 
+  801d2c:	ff d0                	call   *%rax
+  801d2e:	89 c3                	mov    %eax,%ebx
+  801d30:	85 c0                	test   %eax,%eax
+  801d32:	78 14                	js     801d48 <dup+0xf7>
+
+    return newfdnum;
+  801d34:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d37:	89 d8                	mov    %ebx,%eax
+  801d39:	48 83 c4 18          	add    $0x18,%rsp
+  801d3d:	5b                   	pop    %rbx
+  801d3e:	41 5c                	pop    %r12
+  801d40:	41 5d                	pop    %r13
+  801d42:	41 5e                	pop    %r14
+  801d44:	41 5f                	pop    %r15
+  801d46:	5d                   	pop    %rbp
+  801d47:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d48:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d4d:	4c 89 ee             	mov    %r13,%rsi
+  801d50:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d55:	49 bc a8 12 80 00 00 	movabs $0x8012a8,%r12
+  801d5c:	00 00 00 
+  801d5f:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d62:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d67:	4c 89 f6             	mov    %r14,%rsi
+  801d6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d6f:	41 ff d4             	call   *%r12
+    return res;
+  801d72:	eb c3                	jmp    801d37 <dup+0xe6>
+
+0000000000801d74 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d74:	55                   	push   %rbp
+  801d75:	48 89 e5             	mov    %rsp,%rbp
+  801d78:	41 56                	push   %r14
+  801d7a:	41 55                	push   %r13
+  801d7c:	41 54                	push   %r12
+  801d7e:	53                   	push   %rbx
+  801d7f:	48 83 ec 10          	sub    $0x10,%rsp
+  801d83:	89 fb                	mov    %edi,%ebx
+  801d85:	49 89 f4             	mov    %rsi,%r12
+  801d88:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d8b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d8f:	48 b8 91 1a 80 00 00 	movabs $0x801a91,%rax
+  801d96:	00 00 00 
+  801d99:	ff d0                	call   *%rax
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	78 4c                	js     801deb <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d9f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801da3:	41 8b 3e             	mov    (%r14),%edi
+  801da6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801daa:	48 b8 dc 1a 80 00 00 	movabs $0x801adc,%rax
+  801db1:	00 00 00 
+  801db4:	ff d0                	call   *%rax
+  801db6:	85 c0                	test   %eax,%eax
+  801db8:	78 35                	js     801def <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801dba:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801dbe:	83 e0 03             	and    $0x3,%eax
+  801dc1:	83 f8 01             	cmp    $0x1,%eax
+  801dc4:	74 2d                	je     801df3 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dc6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dca:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801dce:	48 85 c0             	test   %rax,%rax
+  801dd1:	74 56                	je     801e29 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801dd3:	4c 89 ea             	mov    %r13,%rdx
+  801dd6:	4c 89 e6             	mov    %r12,%rsi
+  801dd9:	4c 89 f7             	mov    %r14,%rdi
+  801ddc:	ff d0                	call   *%rax
+}
+  801dde:	48 83 c4 10          	add    $0x10,%rsp
+  801de2:	5b                   	pop    %rbx
+  801de3:	41 5c                	pop    %r12
+  801de5:	41 5d                	pop    %r13
+  801de7:	41 5e                	pop    %r14
+  801de9:	5d                   	pop    %rbp
+  801dea:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801deb:	48 98                	cltq
+  801ded:	eb ef                	jmp    801dde <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801def:	48 98                	cltq
+  801df1:	eb eb                	jmp    801dde <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801df3:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801dfa:	00 00 00 
+  801dfd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e03:	89 da                	mov    %ebx,%edx
+  801e05:	48 bf e9 33 80 00 00 	movabs $0x8033e9,%rdi
+  801e0c:	00 00 00 
+  801e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e14:	48 b9 07 03 80 00 00 	movabs $0x800307,%rcx
+  801e1b:	00 00 00 
+  801e1e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e20:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e27:	eb b5                	jmp    801dde <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e29:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e30:	eb ac                	jmp    801dde <read+0x6a>
+
+0000000000801e32 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e32:	55                   	push   %rbp
+  801e33:	48 89 e5             	mov    %rsp,%rbp
+  801e36:	41 57                	push   %r15
+  801e38:	41 56                	push   %r14
+  801e3a:	41 55                	push   %r13
+  801e3c:	41 54                	push   %r12
+  801e3e:	53                   	push   %rbx
+  801e3f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e43:	48 85 d2             	test   %rdx,%rdx
+  801e46:	74 54                	je     801e9c <readn+0x6a>
+  801e48:	41 89 fd             	mov    %edi,%r13d
+  801e4b:	49 89 f6             	mov    %rsi,%r14
+  801e4e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e51:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e56:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e5b:	49 bf 74 1d 80 00 00 	movabs $0x801d74,%r15
+  801e62:	00 00 00 
+  801e65:	4c 89 e2             	mov    %r12,%rdx
+  801e68:	48 29 f2             	sub    %rsi,%rdx
+  801e6b:	4c 01 f6             	add    %r14,%rsi
+  801e6e:	44 89 ef             	mov    %r13d,%edi
+  801e71:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e74:	85 c0                	test   %eax,%eax
+  801e76:	78 20                	js     801e98 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e78:	01 c3                	add    %eax,%ebx
+  801e7a:	85 c0                	test   %eax,%eax
+  801e7c:	74 08                	je     801e86 <readn+0x54>
+  801e7e:	48 63 f3             	movslq %ebx,%rsi
+  801e81:	4c 39 e6             	cmp    %r12,%rsi
+  801e84:	72 df                	jb     801e65 <readn+0x33>
+    }
+    return res;
+  801e86:	48 63 c3             	movslq %ebx,%rax
+}
+  801e89:	48 83 c4 08          	add    $0x8,%rsp
+  801e8d:	5b                   	pop    %rbx
+  801e8e:	41 5c                	pop    %r12
+  801e90:	41 5d                	pop    %r13
+  801e92:	41 5e                	pop    %r14
+  801e94:	41 5f                	pop    %r15
+  801e96:	5d                   	pop    %rbp
+  801e97:	c3                   	ret
+        if (inc < 0) return inc;
+  801e98:	48 98                	cltq
+  801e9a:	eb ed                	jmp    801e89 <readn+0x57>
+    int inc = 1, res = 0;
+  801e9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ea1:	eb e3                	jmp    801e86 <readn+0x54>
+
+0000000000801ea3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ea3:	55                   	push   %rbp
+  801ea4:	48 89 e5             	mov    %rsp,%rbp
+  801ea7:	41 56                	push   %r14
+  801ea9:	41 55                	push   %r13
+  801eab:	41 54                	push   %r12
+  801ead:	53                   	push   %rbx
+  801eae:	48 83 ec 10          	sub    $0x10,%rsp
+  801eb2:	89 fb                	mov    %edi,%ebx
+  801eb4:	49 89 f4             	mov    %rsi,%r12
+  801eb7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eba:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ebe:	48 b8 91 1a 80 00 00 	movabs $0x801a91,%rax
+  801ec5:	00 00 00 
+  801ec8:	ff d0                	call   *%rax
+  801eca:	85 c0                	test   %eax,%eax
+  801ecc:	78 47                	js     801f15 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ece:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ed2:	41 8b 3e             	mov    (%r14),%edi
+  801ed5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ed9:	48 b8 dc 1a 80 00 00 	movabs $0x801adc,%rax
+  801ee0:	00 00 00 
+  801ee3:	ff d0                	call   *%rax
+  801ee5:	85 c0                	test   %eax,%eax
+  801ee7:	78 30                	js     801f19 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ee9:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801eee:	74 2d                	je     801f1d <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ef0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ef4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ef8:	48 85 c0             	test   %rax,%rax
+  801efb:	74 56                	je     801f53 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801efd:	4c 89 ea             	mov    %r13,%rdx
+  801f00:	4c 89 e6             	mov    %r12,%rsi
+  801f03:	4c 89 f7             	mov    %r14,%rdi
+  801f06:	ff d0                	call   *%rax
+}
+  801f08:	48 83 c4 10          	add    $0x10,%rsp
+  801f0c:	5b                   	pop    %rbx
+  801f0d:	41 5c                	pop    %r12
+  801f0f:	41 5d                	pop    %r13
+  801f11:	41 5e                	pop    %r14
+  801f13:	5d                   	pop    %rbp
+  801f14:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f15:	48 98                	cltq
+  801f17:	eb ef                	jmp    801f08 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f19:	48 98                	cltq
+  801f1b:	eb eb                	jmp    801f08 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f1d:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801f24:	00 00 00 
+  801f27:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f2d:	89 da                	mov    %ebx,%edx
+  801f2f:	48 bf 05 34 80 00 00 	movabs $0x803405,%rdi
+  801f36:	00 00 00 
+  801f39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f3e:	48 b9 07 03 80 00 00 	movabs $0x800307,%rcx
+  801f45:	00 00 00 
+  801f48:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f4a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f51:	eb b5                	jmp    801f08 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f53:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f5a:	eb ac                	jmp    801f08 <write+0x65>
+
+0000000000801f5c <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f5c:	55                   	push   %rbp
+  801f5d:	48 89 e5             	mov    %rsp,%rbp
+  801f60:	53                   	push   %rbx
+  801f61:	48 83 ec 18          	sub    $0x18,%rsp
+  801f65:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f67:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f6b:	48 b8 91 1a 80 00 00 	movabs $0x801a91,%rax
+  801f72:	00 00 00 
+  801f75:	ff d0                	call   *%rax
+  801f77:	85 c0                	test   %eax,%eax
+  801f79:	78 0c                	js     801f87 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f7f:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f87:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f8b:	c9                   	leave
+  801f8c:	c3                   	ret
+
+0000000000801f8d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f8d:	55                   	push   %rbp
+  801f8e:	48 89 e5             	mov    %rsp,%rbp
+  801f91:	41 55                	push   %r13
+  801f93:	41 54                	push   %r12
+  801f95:	53                   	push   %rbx
+  801f96:	48 83 ec 18          	sub    $0x18,%rsp
+  801f9a:	89 fb                	mov    %edi,%ebx
+  801f9c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f9f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fa3:	48 b8 91 1a 80 00 00 	movabs $0x801a91,%rax
+  801faa:	00 00 00 
+  801fad:	ff d0                	call   *%rax
+  801faf:	85 c0                	test   %eax,%eax
+  801fb1:	78 38                	js     801feb <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fb3:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801fb7:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801fbb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fbf:	48 b8 dc 1a 80 00 00 	movabs $0x801adc,%rax
+  801fc6:	00 00 00 
+  801fc9:	ff d0                	call   *%rax
+  801fcb:	85 c0                	test   %eax,%eax
+  801fcd:	78 1c                	js     801feb <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fcf:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801fd4:	74 20                	je     801ff6 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fd6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fda:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801fde:	48 85 c0             	test   %rax,%rax
+  801fe1:	74 47                	je     80202a <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801fe3:	44 89 e6             	mov    %r12d,%esi
+  801fe6:	4c 89 ef             	mov    %r13,%rdi
+  801fe9:	ff d0                	call   *%rax
+}
+  801feb:	48 83 c4 18          	add    $0x18,%rsp
+  801fef:	5b                   	pop    %rbx
+  801ff0:	41 5c                	pop    %r12
+  801ff2:	41 5d                	pop    %r13
+  801ff4:	5d                   	pop    %rbp
+  801ff5:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ff6:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801ffd:	00 00 00 
+  802000:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802006:	89 da                	mov    %ebx,%edx
+  802008:	48 bf c8 33 80 00 00 	movabs $0x8033c8,%rdi
+  80200f:	00 00 00 
+  802012:	b8 00 00 00 00       	mov    $0x0,%eax
+  802017:	48 b9 07 03 80 00 00 	movabs $0x800307,%rcx
+  80201e:	00 00 00 
+  802021:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802023:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802028:	eb c1                	jmp    801feb <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80202a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80202f:	eb ba                	jmp    801feb <ftruncate+0x5e>
+
+0000000000802031 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802031:	55                   	push   %rbp
+  802032:	48 89 e5             	mov    %rsp,%rbp
+  802035:	41 54                	push   %r12
+  802037:	53                   	push   %rbx
+  802038:	48 83 ec 10          	sub    $0x10,%rsp
+  80203c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80203f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802043:	48 b8 91 1a 80 00 00 	movabs $0x801a91,%rax
+  80204a:	00 00 00 
+  80204d:	ff d0                	call   *%rax
+  80204f:	85 c0                	test   %eax,%eax
+  802051:	78 4e                	js     8020a1 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802053:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802057:	41 8b 3c 24          	mov    (%r12),%edi
+  80205b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80205f:	48 b8 dc 1a 80 00 00 	movabs $0x801adc,%rax
+  802066:	00 00 00 
+  802069:	ff d0                	call   *%rax
+  80206b:	85 c0                	test   %eax,%eax
+  80206d:	78 32                	js     8020a1 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80206f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802073:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802078:	74 30                	je     8020aa <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80207a:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80207d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802084:	00 00 00 
+    stat->st_isdir = 0;
+  802087:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80208e:	00 00 00 
+    stat->st_dev = dev;
+  802091:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802098:	48 89 de             	mov    %rbx,%rsi
+  80209b:	4c 89 e7             	mov    %r12,%rdi
+  80209e:	ff 50 28             	call   *0x28(%rax)
+}
+  8020a1:	48 83 c4 10          	add    $0x10,%rsp
+  8020a5:	5b                   	pop    %rbx
+  8020a6:	41 5c                	pop    %r12
+  8020a8:	5d                   	pop    %rbp
+  8020a9:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020aa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020af:	eb f0                	jmp    8020a1 <fstat+0x70>
+
+00000000008020b1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8020b1:	55                   	push   %rbp
+  8020b2:	48 89 e5             	mov    %rsp,%rbp
+  8020b5:	41 54                	push   %r12
+  8020b7:	53                   	push   %rbx
+  8020b8:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8020bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8020c0:	48 b8 32 23 80 00 00 	movabs $0x802332,%rax
+  8020c7:	00 00 00 
+  8020ca:	ff d0                	call   *%rax
+  8020cc:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8020ce:	85 c0                	test   %eax,%eax
+  8020d0:	78 25                	js     8020f7 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8020d2:	4c 89 e6             	mov    %r12,%rsi
+  8020d5:	89 c7                	mov    %eax,%edi
+  8020d7:	48 b8 31 20 80 00 00 	movabs $0x802031,%rax
+  8020de:	00 00 00 
+  8020e1:	ff d0                	call   *%rax
+  8020e3:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8020e6:	89 df                	mov    %ebx,%edi
+  8020e8:	48 b8 f6 1b 80 00 00 	movabs $0x801bf6,%rax
+  8020ef:	00 00 00 
+  8020f2:	ff d0                	call   *%rax
+
+    return res;
+  8020f4:	44 89 e3             	mov    %r12d,%ebx
+}
+  8020f7:	89 d8                	mov    %ebx,%eax
+  8020f9:	5b                   	pop    %rbx
+  8020fa:	41 5c                	pop    %r12
+  8020fc:	5d                   	pop    %rbp
+  8020fd:	c3                   	ret
+
+00000000008020fe <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  8020fe:	55                   	push   %rbp
+  8020ff:	48 89 e5             	mov    %rsp,%rbp
+  802102:	41 54                	push   %r12
+  802104:	53                   	push   %rbx
+  802105:	48 83 ec 10          	sub    $0x10,%rsp
+  802109:	41 89 fc             	mov    %edi,%r12d
+  80210c:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80210f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802116:	00 00 00 
+  802119:	83 38 00             	cmpl   $0x0,(%rax)
+  80211c:	74 5e                	je     80217c <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80211e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802124:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802129:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802130:	00 00 00 
+  802133:	44 89 e6             	mov    %r12d,%esi
+  802136:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80213d:	00 00 00 
+  802140:	8b 38                	mov    (%rax),%edi
+  802142:	48 b8 13 19 80 00 00 	movabs $0x801913,%rax
+  802149:	00 00 00 
+  80214c:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  80214e:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802155:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802156:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80215b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80215f:	48 89 de             	mov    %rbx,%rsi
+  802162:	bf 00 00 00 00       	mov    $0x0,%edi
+  802167:	48 b8 7e 18 80 00 00 	movabs $0x80187e,%rax
+  80216e:	00 00 00 
+  802171:	ff d0                	call   *%rax
+}
+  802173:	48 83 c4 10          	add    $0x10,%rsp
+  802177:	5b                   	pop    %rbx
+  802178:	41 5c                	pop    %r12
+  80217a:	5d                   	pop    %rbp
+  80217b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80217c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802181:	48 b8 b3 19 80 00 00 	movabs $0x8019b3,%rax
+  802188:	00 00 00 
+  80218b:	ff d0                	call   *%rax
+  80218d:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802194:	00 00 
+  802196:	eb 86                	jmp    80211e <fsipc+0x20>
+
+0000000000802198 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802198:	55                   	push   %rbp
+  802199:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80219c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8021a3:	00 00 00 
+  8021a6:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8021a9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8021ab:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8021ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b3:	bf 02 00 00 00       	mov    $0x2,%edi
+  8021b8:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  8021bf:	00 00 00 
+  8021c2:	ff d0                	call   *%rax
+}
+  8021c4:	5d                   	pop    %rbp
+  8021c5:	c3                   	ret
+
+00000000008021c6 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8021c6:	55                   	push   %rbp
+  8021c7:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8021ca:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8021cd:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021d4:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8021d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021db:	bf 06 00 00 00       	mov    $0x6,%edi
+  8021e0:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  8021e7:	00 00 00 
+  8021ea:	ff d0                	call   *%rax
+}
+  8021ec:	5d                   	pop    %rbp
+  8021ed:	c3                   	ret
+
+00000000008021ee <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8021ee:	55                   	push   %rbp
+  8021ef:	48 89 e5             	mov    %rsp,%rbp
+  8021f2:	41 54                	push   %r12
+  8021f4:	53                   	push   %rbx
+  8021f5:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8021f8:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8021fb:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802202:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802204:	be 00 00 00 00       	mov    $0x0,%esi
+  802209:	bf 05 00 00 00       	mov    $0x5,%edi
+  80220e:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  802215:	00 00 00 
+  802218:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80221a:	85 c0                	test   %eax,%eax
+  80221c:	78 3d                	js     80225b <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80221e:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802225:	00 00 00 
+  802228:	4c 89 e6             	mov    %r12,%rsi
+  80222b:	48 89 df             	mov    %rbx,%rdi
+  80222e:	48 b8 2c 0c 80 00 00 	movabs $0x800c2c,%rax
+  802235:	00 00 00 
+  802238:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80223a:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802241:	00 
+  802242:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802248:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80224f:	00 
+  802250:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802256:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80225b:	5b                   	pop    %rbx
+  80225c:	41 5c                	pop    %r12
+  80225e:	5d                   	pop    %rbp
+  80225f:	c3                   	ret
+
+0000000000802260 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802260:	55                   	push   %rbp
+  802261:	48 89 e5             	mov    %rsp,%rbp
+  802264:	41 54                	push   %r12
+  802266:	53                   	push   %rbx
+  802267:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  80226a:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80226f:	48 39 c2             	cmp    %rax,%rdx
+  802272:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802276:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802279:	48 89 c2             	mov    %rax,%rdx
+  80227c:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802283:	00 00 00 
+  802286:	48 b8 8d 0e 80 00 00 	movabs $0x800e8d,%rax
+  80228d:	00 00 00 
+  802290:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802292:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802299:	00 00 00 
+  80229c:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8022a1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8022a3:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8022a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ac:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022b1:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  8022b8:	00 00 00 
+  8022bb:	ff d0                	call   *%rax
+  8022bd:	48 98                	cltq
+}
+  8022bf:	5b                   	pop    %rbx
+  8022c0:	41 5c                	pop    %r12
+  8022c2:	5d                   	pop    %rbp
+  8022c3:	c3                   	ret
+
+00000000008022c4 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8022c4:	55                   	push   %rbp
+  8022c5:	48 89 e5             	mov    %rsp,%rbp
+  8022c8:	41 54                	push   %r12
+  8022ca:	53                   	push   %rbx
+  8022cb:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022ce:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022d5:	00 00 00 
+  8022d8:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8022db:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8022dd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022e2:	48 39 ca             	cmp    %rcx,%rdx
+  8022e5:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8022e9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8022ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022f7:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  8022fe:	00 00 00 
+  802301:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802303:	85 c0                	test   %eax,%eax
+  802305:	78 27                	js     80232e <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802307:	48 63 d8             	movslq %eax,%rbx
+  80230a:	48 89 da             	mov    %rbx,%rdx
+  80230d:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802314:	00 00 00 
+  802317:	4c 89 e7             	mov    %r12,%rdi
+  80231a:	48 b8 8d 0e 80 00 00 	movabs $0x800e8d,%rax
+  802321:	00 00 00 
+  802324:	ff d0                	call   *%rax
+    return bytes_read;
+  802326:	48 89 d8             	mov    %rbx,%rax
+}
+  802329:	5b                   	pop    %rbx
+  80232a:	41 5c                	pop    %r12
+  80232c:	5d                   	pop    %rbp
+  80232d:	c3                   	ret
+        return bytes_read;
+  80232e:	48 98                	cltq
+  802330:	eb f7                	jmp    802329 <devfile_read+0x65>
+
+0000000000802332 <open>:
+open(const char *path, int mode) {
+  802332:	55                   	push   %rbp
+  802333:	48 89 e5             	mov    %rsp,%rbp
+  802336:	41 55                	push   %r13
+  802338:	41 54                	push   %r12
+  80233a:	53                   	push   %rbx
+  80233b:	48 83 ec 18          	sub    $0x18,%rsp
+  80233f:	49 89 fc             	mov    %rdi,%r12
+  802342:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802345:	48 b8 ee 0b 80 00 00 	movabs $0x800bee,%rax
+  80234c:	00 00 00 
+  80234f:	ff d0                	call   *%rax
+  802351:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802357:	0f 87 8a 00 00 00    	ja     8023e7 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80235d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802361:	48 b8 31 1a 80 00 00 	movabs $0x801a31,%rax
+  802368:	00 00 00 
+  80236b:	ff d0                	call   *%rax
+  80236d:	89 c3                	mov    %eax,%ebx
+  80236f:	85 c0                	test   %eax,%eax
+  802371:	78 50                	js     8023c3 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802373:	4c 89 e6             	mov    %r12,%rsi
+  802376:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80237d:	00 00 00 
+  802380:	48 89 df             	mov    %rbx,%rdi
+  802383:	48 b8 2c 0c 80 00 00 	movabs $0x800c2c,%rax
+  80238a:	00 00 00 
+  80238d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80238f:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802396:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80239a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80239f:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  8023a6:	00 00 00 
+  8023a9:	ff d0                	call   *%rax
+  8023ab:	89 c3                	mov    %eax,%ebx
+  8023ad:	85 c0                	test   %eax,%eax
+  8023af:	78 1f                	js     8023d0 <open+0x9e>
+    return fd2num(fd);
+  8023b1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8023b5:	48 b8 03 1a 80 00 00 	movabs $0x801a03,%rax
+  8023bc:	00 00 00 
+  8023bf:	ff d0                	call   *%rax
+  8023c1:	89 c3                	mov    %eax,%ebx
+}
+  8023c3:	89 d8                	mov    %ebx,%eax
+  8023c5:	48 83 c4 18          	add    $0x18,%rsp
+  8023c9:	5b                   	pop    %rbx
+  8023ca:	41 5c                	pop    %r12
+  8023cc:	41 5d                	pop    %r13
+  8023ce:	5d                   	pop    %rbp
+  8023cf:	c3                   	ret
+        fd_close(fd, 0);
+  8023d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8023d9:	48 b8 4c 1b 80 00 00 	movabs $0x801b4c,%rax
+  8023e0:	00 00 00 
+  8023e3:	ff d0                	call   *%rax
+        return res;
+  8023e5:	eb dc                	jmp    8023c3 <open+0x91>
+        return -E_BAD_PATH;
+  8023e7:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8023ec:	eb d5                	jmp    8023c3 <open+0x91>
+
+00000000008023ee <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8023ee:	55                   	push   %rbp
+  8023ef:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8023f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f7:	bf 08 00 00 00       	mov    $0x8,%edi
+  8023fc:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  802403:	00 00 00 
+  802406:	ff d0                	call   *%rax
+}
+  802408:	5d                   	pop    %rbp
+  802409:	c3                   	ret
+
+000000000080240a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80240a:	55                   	push   %rbp
+  80240b:	48 89 e5             	mov    %rsp,%rbp
+  80240e:	41 54                	push   %r12
+  802410:	53                   	push   %rbx
+  802411:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802414:	48 b8 15 1a 80 00 00 	movabs $0x801a15,%rax
+  80241b:	00 00 00 
+  80241e:	ff d0                	call   *%rax
+  802420:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802423:	48 be 60 34 80 00 00 	movabs $0x803460,%rsi
+  80242a:	00 00 00 
+  80242d:	48 89 df             	mov    %rbx,%rdi
+  802430:	48 b8 2c 0c 80 00 00 	movabs $0x800c2c,%rax
+  802437:	00 00 00 
+  80243a:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80243c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802441:	41 2b 04 24          	sub    (%r12),%eax
+  802445:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80244b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802452:	00 00 00 
+    stat->st_dev = &devpipe;
+  802455:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80245c:	00 00 00 
+  80245f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802466:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246b:	5b                   	pop    %rbx
+  80246c:	41 5c                	pop    %r12
+  80246e:	5d                   	pop    %rbp
+  80246f:	c3                   	ret
+
+0000000000802470 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802470:	55                   	push   %rbp
+  802471:	48 89 e5             	mov    %rsp,%rbp
+  802474:	41 54                	push   %r12
+  802476:	53                   	push   %rbx
+  802477:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80247a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80247f:	48 89 fe             	mov    %rdi,%rsi
+  802482:	bf 00 00 00 00       	mov    $0x0,%edi
+  802487:	49 bc a8 12 80 00 00 	movabs $0x8012a8,%r12
+  80248e:	00 00 00 
+  802491:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802494:	48 89 df             	mov    %rbx,%rdi
+  802497:	48 b8 15 1a 80 00 00 	movabs $0x801a15,%rax
+  80249e:	00 00 00 
+  8024a1:	ff d0                	call   *%rax
+  8024a3:	48 89 c6             	mov    %rax,%rsi
+  8024a6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024b0:	41 ff d4             	call   *%r12
+}
+  8024b3:	5b                   	pop    %rbx
+  8024b4:	41 5c                	pop    %r12
+  8024b6:	5d                   	pop    %rbp
+  8024b7:	c3                   	ret
+
+00000000008024b8 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8024b8:	55                   	push   %rbp
+  8024b9:	48 89 e5             	mov    %rsp,%rbp
+  8024bc:	41 57                	push   %r15
+  8024be:	41 56                	push   %r14
+  8024c0:	41 55                	push   %r13
+  8024c2:	41 54                	push   %r12
+  8024c4:	53                   	push   %rbx
+  8024c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8024c9:	49 89 fc             	mov    %rdi,%r12
+  8024cc:	49 89 f5             	mov    %rsi,%r13
+  8024cf:	49 89 d7             	mov    %rdx,%r15
+  8024d2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024d6:	48 b8 15 1a 80 00 00 	movabs $0x801a15,%rax
+  8024dd:	00 00 00 
+  8024e0:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8024e2:	4d 85 ff             	test   %r15,%r15
+  8024e5:	0f 84 af 00 00 00    	je     80259a <devpipe_write+0xe2>
+  8024eb:	48 89 c3             	mov    %rax,%rbx
+  8024ee:	4c 89 f8             	mov    %r15,%rax
+  8024f1:	4d 89 ef             	mov    %r13,%r15
+  8024f4:	4c 01 e8             	add    %r13,%rax
+  8024f7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8024fb:	49 bd b0 11 80 00 00 	movabs $0x8011b0,%r13
+  802502:	00 00 00 
+            sys_yield();
+  802505:	49 be 4d 11 80 00 00 	movabs $0x80114d,%r14
+  80250c:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80250f:	8b 73 04             	mov    0x4(%rbx),%esi
+  802512:	48 63 ce             	movslq %esi,%rcx
+  802515:	48 63 03             	movslq (%rbx),%rax
+  802518:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80251e:	48 39 c1             	cmp    %rax,%rcx
+  802521:	72 2e                	jb     802551 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802523:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802528:	48 89 da             	mov    %rbx,%rdx
+  80252b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802530:	4c 89 e7             	mov    %r12,%rdi
+  802533:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802536:	85 c0                	test   %eax,%eax
+  802538:	74 66                	je     8025a0 <devpipe_write+0xe8>
+            sys_yield();
+  80253a:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80253d:	8b 73 04             	mov    0x4(%rbx),%esi
+  802540:	48 63 ce             	movslq %esi,%rcx
+  802543:	48 63 03             	movslq (%rbx),%rax
+  802546:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80254c:	48 39 c1             	cmp    %rax,%rcx
+  80254f:	73 d2                	jae    802523 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802551:	41 0f b6 3f          	movzbl (%r15),%edi
+  802555:	48 89 ca             	mov    %rcx,%rdx
+  802558:	48 c1 ea 03          	shr    $0x3,%rdx
+  80255c:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802563:	08 10 20 
+  802566:	48 f7 e2             	mul    %rdx
+  802569:	48 c1 ea 06          	shr    $0x6,%rdx
+  80256d:	48 89 d0             	mov    %rdx,%rax
+  802570:	48 c1 e0 09          	shl    $0x9,%rax
+  802574:	48 29 d0             	sub    %rdx,%rax
+  802577:	48 c1 e0 03          	shl    $0x3,%rax
+  80257b:	48 29 c1             	sub    %rax,%rcx
+  80257e:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802583:	83 c6 01             	add    $0x1,%esi
+  802586:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802589:	49 83 c7 01          	add    $0x1,%r15
+  80258d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802591:	49 39 c7             	cmp    %rax,%r15
+  802594:	0f 85 75 ff ff ff    	jne    80250f <devpipe_write+0x57>
+    return n;
+  80259a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80259e:	eb 05                	jmp    8025a5 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8025a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025a5:	48 83 c4 18          	add    $0x18,%rsp
+  8025a9:	5b                   	pop    %rbx
+  8025aa:	41 5c                	pop    %r12
+  8025ac:	41 5d                	pop    %r13
+  8025ae:	41 5e                	pop    %r14
+  8025b0:	41 5f                	pop    %r15
+  8025b2:	5d                   	pop    %rbp
+  8025b3:	c3                   	ret
+
+00000000008025b4 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8025b4:	55                   	push   %rbp
+  8025b5:	48 89 e5             	mov    %rsp,%rbp
+  8025b8:	41 57                	push   %r15
+  8025ba:	41 56                	push   %r14
+  8025bc:	41 55                	push   %r13
+  8025be:	41 54                	push   %r12
+  8025c0:	53                   	push   %rbx
+  8025c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8025c5:	49 89 fc             	mov    %rdi,%r12
+  8025c8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8025cc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025d0:	48 b8 15 1a 80 00 00 	movabs $0x801a15,%rax
+  8025d7:	00 00 00 
+  8025da:	ff d0                	call   *%rax
+  8025dc:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8025df:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025e5:	49 bd b0 11 80 00 00 	movabs $0x8011b0,%r13
+  8025ec:	00 00 00 
+            sys_yield();
+  8025ef:	49 be 4d 11 80 00 00 	movabs $0x80114d,%r14
+  8025f6:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8025f9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8025fe:	74 7d                	je     80267d <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802600:	8b 03                	mov    (%rbx),%eax
+  802602:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802605:	75 26                	jne    80262d <devpipe_read+0x79>
+            if (i > 0) return i;
+  802607:	4d 85 ff             	test   %r15,%r15
+  80260a:	75 77                	jne    802683 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80260c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802611:	48 89 da             	mov    %rbx,%rdx
+  802614:	be 00 10 00 00       	mov    $0x1000,%esi
+  802619:	4c 89 e7             	mov    %r12,%rdi
+  80261c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80261f:	85 c0                	test   %eax,%eax
+  802621:	74 72                	je     802695 <devpipe_read+0xe1>
+            sys_yield();
+  802623:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802626:	8b 03                	mov    (%rbx),%eax
+  802628:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80262b:	74 df                	je     80260c <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80262d:	48 63 c8             	movslq %eax,%rcx
+  802630:	48 89 ca             	mov    %rcx,%rdx
+  802633:	48 c1 ea 03          	shr    $0x3,%rdx
+  802637:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80263e:	08 10 20 
+  802641:	48 89 d0             	mov    %rdx,%rax
+  802644:	48 f7 e6             	mul    %rsi
+  802647:	48 c1 ea 06          	shr    $0x6,%rdx
+  80264b:	48 89 d0             	mov    %rdx,%rax
+  80264e:	48 c1 e0 09          	shl    $0x9,%rax
+  802652:	48 29 d0             	sub    %rdx,%rax
+  802655:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80265c:	00 
+  80265d:	48 89 c8             	mov    %rcx,%rax
+  802660:	48 29 d0             	sub    %rdx,%rax
+  802663:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802668:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80266c:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802670:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802673:	49 83 c7 01          	add    $0x1,%r15
+  802677:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80267b:	75 83                	jne    802600 <devpipe_read+0x4c>
+    return n;
+  80267d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802681:	eb 03                	jmp    802686 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802683:	4c 89 f8             	mov    %r15,%rax
+}
+  802686:	48 83 c4 18          	add    $0x18,%rsp
+  80268a:	5b                   	pop    %rbx
+  80268b:	41 5c                	pop    %r12
+  80268d:	41 5d                	pop    %r13
+  80268f:	41 5e                	pop    %r14
+  802691:	41 5f                	pop    %r15
+  802693:	5d                   	pop    %rbp
+  802694:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802695:	b8 00 00 00 00       	mov    $0x0,%eax
+  80269a:	eb ea                	jmp    802686 <devpipe_read+0xd2>
+
+000000000080269c <pipe>:
+pipe(int pfd[2]) {
+  80269c:	55                   	push   %rbp
+  80269d:	48 89 e5             	mov    %rsp,%rbp
+  8026a0:	41 55                	push   %r13
+  8026a2:	41 54                	push   %r12
+  8026a4:	53                   	push   %rbx
+  8026a5:	48 83 ec 18          	sub    $0x18,%rsp
+  8026a9:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8026ac:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8026b0:	48 b8 31 1a 80 00 00 	movabs $0x801a31,%rax
+  8026b7:	00 00 00 
+  8026ba:	ff d0                	call   *%rax
+  8026bc:	89 c3                	mov    %eax,%ebx
+  8026be:	85 c0                	test   %eax,%eax
+  8026c0:	0f 88 a0 01 00 00    	js     802866 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8026c6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8026cb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026d0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8026d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026d9:	48 b8 dc 11 80 00 00 	movabs $0x8011dc,%rax
+  8026e0:	00 00 00 
+  8026e3:	ff d0                	call   *%rax
+  8026e5:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8026e7:	85 c0                	test   %eax,%eax
+  8026e9:	0f 88 77 01 00 00    	js     802866 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8026ef:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8026f3:	48 b8 31 1a 80 00 00 	movabs $0x801a31,%rax
+  8026fa:	00 00 00 
+  8026fd:	ff d0                	call   *%rax
+  8026ff:	89 c3                	mov    %eax,%ebx
+  802701:	85 c0                	test   %eax,%eax
+  802703:	0f 88 43 01 00 00    	js     80284c <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802709:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80270e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802713:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802717:	bf 00 00 00 00       	mov    $0x0,%edi
+  80271c:	48 b8 dc 11 80 00 00 	movabs $0x8011dc,%rax
+  802723:	00 00 00 
+  802726:	ff d0                	call   *%rax
+  802728:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80272a:	85 c0                	test   %eax,%eax
+  80272c:	0f 88 1a 01 00 00    	js     80284c <pipe+0x1b0>
+    va = fd2data(fd0);
+  802732:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802736:	48 b8 15 1a 80 00 00 	movabs $0x801a15,%rax
+  80273d:	00 00 00 
+  802740:	ff d0                	call   *%rax
+  802742:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802745:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80274a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80274f:	48 89 c6             	mov    %rax,%rsi
+  802752:	bf 00 00 00 00       	mov    $0x0,%edi
+  802757:	48 b8 dc 11 80 00 00 	movabs $0x8011dc,%rax
+  80275e:	00 00 00 
+  802761:	ff d0                	call   *%rax
+  802763:	89 c3                	mov    %eax,%ebx
+  802765:	85 c0                	test   %eax,%eax
+  802767:	0f 88 c5 00 00 00    	js     802832 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80276d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802771:	48 b8 15 1a 80 00 00 	movabs $0x801a15,%rax
+  802778:	00 00 00 
+  80277b:	ff d0                	call   *%rax
+  80277d:	48 89 c1             	mov    %rax,%rcx
+  802780:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802786:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80278c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802791:	4c 89 ee             	mov    %r13,%rsi
+  802794:	bf 00 00 00 00       	mov    $0x0,%edi
+  802799:	48 b8 43 12 80 00 00 	movabs $0x801243,%rax
+  8027a0:	00 00 00 
+  8027a3:	ff d0                	call   *%rax
+  8027a5:	89 c3                	mov    %eax,%ebx
+  8027a7:	85 c0                	test   %eax,%eax
+  8027a9:	78 6e                	js     802819 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8027ab:	be 00 10 00 00       	mov    $0x1000,%esi
+  8027b0:	4c 89 ef             	mov    %r13,%rdi
+  8027b3:	48 b8 7e 11 80 00 00 	movabs $0x80117e,%rax
+  8027ba:	00 00 00 
+  8027bd:	ff d0                	call   *%rax
+  8027bf:	83 f8 02             	cmp    $0x2,%eax
+  8027c2:	0f 85 ab 00 00 00    	jne    802873 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8027c8:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8027cf:	00 00 
+  8027d1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8027d5:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8027d7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8027db:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8027e2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8027e6:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8027e8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027ec:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8027f3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027f7:	48 bb 03 1a 80 00 00 	movabs $0x801a03,%rbx
+  8027fe:	00 00 00 
+  802801:	ff d3                	call   *%rbx
+  802803:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802807:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80280b:	ff d3                	call   *%rbx
+  80280d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802812:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802817:	eb 4d                	jmp    802866 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802819:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80281e:	4c 89 ee             	mov    %r13,%rsi
+  802821:	bf 00 00 00 00       	mov    $0x0,%edi
+  802826:	48 b8 a8 12 80 00 00 	movabs $0x8012a8,%rax
+  80282d:	00 00 00 
+  802830:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802832:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802837:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80283b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802840:	48 b8 a8 12 80 00 00 	movabs $0x8012a8,%rax
+  802847:	00 00 00 
+  80284a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80284c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802851:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802855:	bf 00 00 00 00       	mov    $0x0,%edi
+  80285a:	48 b8 a8 12 80 00 00 	movabs $0x8012a8,%rax
+  802861:	00 00 00 
+  802864:	ff d0                	call   *%rax
+}
+  802866:	89 d8                	mov    %ebx,%eax
+  802868:	48 83 c4 18          	add    $0x18,%rsp
+  80286c:	5b                   	pop    %rbx
+  80286d:	41 5c                	pop    %r12
+  80286f:	41 5d                	pop    %r13
+  802871:	5d                   	pop    %rbp
+  802872:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802873:	48 b9 90 34 80 00 00 	movabs $0x803490,%rcx
+  80287a:	00 00 00 
+  80287d:	48 ba 67 34 80 00 00 	movabs $0x803467,%rdx
+  802884:	00 00 00 
+  802887:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80288c:	48 bf 7c 34 80 00 00 	movabs $0x80347c,%rdi
+  802893:	00 00 00 
+  802896:	b8 00 00 00 00       	mov    $0x0,%eax
+  80289b:	49 b8 d6 2c 80 00 00 	movabs $0x802cd6,%r8
+  8028a2:	00 00 00 
+  8028a5:	41 ff d0             	call   *%r8
+
+00000000008028a8 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8028a8:	55                   	push   %rbp
+  8028a9:	48 89 e5             	mov    %rsp,%rbp
+  8028ac:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8028b0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8028b4:	48 b8 91 1a 80 00 00 	movabs $0x801a91,%rax
+  8028bb:	00 00 00 
+  8028be:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028c0:	85 c0                	test   %eax,%eax
+  8028c2:	78 35                	js     8028f9 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8028c4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8028c8:	48 b8 15 1a 80 00 00 	movabs $0x801a15,%rax
+  8028cf:	00 00 00 
+  8028d2:	ff d0                	call   *%rax
+  8028d4:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8028d7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8028dc:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028e1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8028e5:	48 b8 b0 11 80 00 00 	movabs $0x8011b0,%rax
+  8028ec:	00 00 00 
+  8028ef:	ff d0                	call   *%rax
+  8028f1:	85 c0                	test   %eax,%eax
+  8028f3:	0f 94 c0             	sete   %al
+  8028f6:	0f b6 c0             	movzbl %al,%eax
+}
+  8028f9:	c9                   	leave
+  8028fa:	c3                   	ret
+
+00000000008028fb <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8028fb:	48 89 f8             	mov    %rdi,%rax
+  8028fe:	48 c1 e8 27          	shr    $0x27,%rax
+  802902:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802909:	01 00 00 
+  80290c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802910:	f6 c2 01             	test   $0x1,%dl
+  802913:	74 6d                	je     802982 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802915:	48 89 f8             	mov    %rdi,%rax
+  802918:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80291c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802923:	01 00 00 
+  802926:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80292a:	f6 c2 01             	test   $0x1,%dl
+  80292d:	74 62                	je     802991 <get_uvpt_entry+0x96>
+  80292f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802936:	01 00 00 
+  802939:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80293d:	f6 c2 80             	test   $0x80,%dl
+  802940:	75 4f                	jne    802991 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802942:	48 89 f8             	mov    %rdi,%rax
+  802945:	48 c1 e8 15          	shr    $0x15,%rax
+  802949:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802950:	01 00 00 
+  802953:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802957:	f6 c2 01             	test   $0x1,%dl
+  80295a:	74 44                	je     8029a0 <get_uvpt_entry+0xa5>
+  80295c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802963:	01 00 00 
+  802966:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80296a:	f6 c2 80             	test   $0x80,%dl
+  80296d:	75 31                	jne    8029a0 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80296f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802973:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80297a:	01 00 00 
+  80297d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802981:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802982:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802989:	01 00 00 
+  80298c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802990:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802991:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802998:	01 00 00 
+  80299b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80299f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8029a0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8029a7:	01 00 00 
+  8029aa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029ae:	c3                   	ret
+
+00000000008029af <get_prot>:
+
+int
+get_prot(void *va) {
+  8029af:	55                   	push   %rbp
+  8029b0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8029b3:	48 b8 fb 28 80 00 00 	movabs $0x8028fb,%rax
+  8029ba:	00 00 00 
+  8029bd:	ff d0                	call   *%rax
+  8029bf:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8029c2:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8029c7:	89 c1                	mov    %eax,%ecx
+  8029c9:	83 c9 04             	or     $0x4,%ecx
+  8029cc:	f6 c2 01             	test   $0x1,%dl
+  8029cf:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8029d2:	89 c1                	mov    %eax,%ecx
+  8029d4:	83 c9 02             	or     $0x2,%ecx
+  8029d7:	f6 c2 02             	test   $0x2,%dl
+  8029da:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8029dd:	89 c1                	mov    %eax,%ecx
+  8029df:	83 c9 01             	or     $0x1,%ecx
+  8029e2:	48 85 d2             	test   %rdx,%rdx
+  8029e5:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8029e8:	89 c1                	mov    %eax,%ecx
+  8029ea:	83 c9 40             	or     $0x40,%ecx
+  8029ed:	f6 c6 04             	test   $0x4,%dh
+  8029f0:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8029f3:	5d                   	pop    %rbp
+  8029f4:	c3                   	ret
+
+00000000008029f5 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8029f5:	55                   	push   %rbp
+  8029f6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8029f9:	48 b8 fb 28 80 00 00 	movabs $0x8028fb,%rax
+  802a00:	00 00 00 
+  802a03:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802a05:	48 c1 e8 06          	shr    $0x6,%rax
+  802a09:	83 e0 01             	and    $0x1,%eax
+}
+  802a0c:	5d                   	pop    %rbp
+  802a0d:	c3                   	ret
+
+0000000000802a0e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802a0e:	55                   	push   %rbp
+  802a0f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802a12:	48 b8 fb 28 80 00 00 	movabs $0x8028fb,%rax
+  802a19:	00 00 00 
+  802a1c:	ff d0                	call   *%rax
+  802a1e:	83 e0 01             	and    $0x1,%eax
+}
+  802a21:	5d                   	pop    %rbp
+  802a22:	c3                   	ret
+
+0000000000802a23 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802a23:	55                   	push   %rbp
+  802a24:	48 89 e5             	mov    %rsp,%rbp
+  802a27:	41 57                	push   %r15
+  802a29:	41 56                	push   %r14
+  802a2b:	41 55                	push   %r13
+  802a2d:	41 54                	push   %r12
+  802a2f:	53                   	push   %rbx
+  802a30:	48 83 ec 18          	sub    $0x18,%rsp
+  802a34:	49 89 ff             	mov    %rdi,%r15
+  802a37:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802a3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802a40:	49 bc 0e 2a 80 00 00 	movabs $0x802a0e,%r12
+  802a47:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802a4a:	49 be af 29 80 00 00 	movabs $0x8029af,%r14
+  802a51:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802a54:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802a5b:	00 00 00 
+  802a5e:	eb 0c                	jmp    802a6c <foreach_shared_region+0x49>
+  802a60:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802a67:	4c 39 eb             	cmp    %r13,%rbx
+  802a6a:	74 38                	je     802aa4 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802a6c:	48 89 df             	mov    %rbx,%rdi
+  802a6f:	41 ff d4             	call   *%r12
+  802a72:	84 c0                	test   %al,%al
+  802a74:	74 ea                	je     802a60 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802a76:	48 89 df             	mov    %rbx,%rdi
+  802a79:	41 ff d6             	call   *%r14
+  802a7c:	a8 40                	test   $0x40,%al
+  802a7e:	74 e0                	je     802a60 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802a80:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802a87:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802a8b:	48 89 df             	mov    %rbx,%rdi
+  802a8e:	41 ff d7             	call   *%r15
+        if (err)
+  802a91:	85 c0                	test   %eax,%eax
+  802a93:	74 cb                	je     802a60 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802a95:	48 83 c4 18          	add    $0x18,%rsp
+  802a99:	5b                   	pop    %rbx
+  802a9a:	41 5c                	pop    %r12
+  802a9c:	41 5d                	pop    %r13
+  802a9e:	41 5e                	pop    %r14
+  802aa0:	41 5f                	pop    %r15
+  802aa2:	5d                   	pop    %rbp
+  802aa3:	c3                   	ret
+    return 0;
+  802aa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa9:	eb ea                	jmp    802a95 <foreach_shared_region+0x72>
+
+0000000000802aab <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802aab:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab0:	c3                   	ret
+
+0000000000802ab1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802ab1:	55                   	push   %rbp
+  802ab2:	48 89 e5             	mov    %rsp,%rbp
+  802ab5:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802ab8:	48 be b4 34 80 00 00 	movabs $0x8034b4,%rsi
+  802abf:	00 00 00 
+  802ac2:	48 b8 2c 0c 80 00 00 	movabs $0x800c2c,%rax
+  802ac9:	00 00 00 
+  802acc:	ff d0                	call   *%rax
+    return 0;
+}
+  802ace:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad3:	5d                   	pop    %rbp
+  802ad4:	c3                   	ret
+
+0000000000802ad5 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802ad5:	55                   	push   %rbp
+  802ad6:	48 89 e5             	mov    %rsp,%rbp
+  802ad9:	41 57                	push   %r15
+  802adb:	41 56                	push   %r14
+  802add:	41 55                	push   %r13
+  802adf:	41 54                	push   %r12
+  802ae1:	53                   	push   %rbx
+  802ae2:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802ae9:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802af0:	48 85 d2             	test   %rdx,%rdx
+  802af3:	74 7a                	je     802b6f <devcons_write+0x9a>
+  802af5:	49 89 d6             	mov    %rdx,%r14
+  802af8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802afe:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802b03:	49 bf 26 0e 80 00 00 	movabs $0x800e26,%r15
+  802b0a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802b0d:	4c 89 f3             	mov    %r14,%rbx
+  802b10:	48 29 f3             	sub    %rsi,%rbx
+  802b13:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802b18:	48 39 c3             	cmp    %rax,%rbx
+  802b1b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802b1f:	4c 63 eb             	movslq %ebx,%r13
+  802b22:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802b29:	48 01 c6             	add    %rax,%rsi
+  802b2c:	4c 89 ea             	mov    %r13,%rdx
+  802b2f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802b36:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802b39:	4c 89 ee             	mov    %r13,%rsi
+  802b3c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802b43:	48 b8 53 10 80 00 00 	movabs $0x801053,%rax
+  802b4a:	00 00 00 
+  802b4d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802b4f:	41 01 dc             	add    %ebx,%r12d
+  802b52:	49 63 f4             	movslq %r12d,%rsi
+  802b55:	4c 39 f6             	cmp    %r14,%rsi
+  802b58:	72 b3                	jb     802b0d <devcons_write+0x38>
+    return res;
+  802b5a:	49 63 c4             	movslq %r12d,%rax
+}
+  802b5d:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802b64:	5b                   	pop    %rbx
+  802b65:	41 5c                	pop    %r12
+  802b67:	41 5d                	pop    %r13
+  802b69:	41 5e                	pop    %r14
+  802b6b:	41 5f                	pop    %r15
+  802b6d:	5d                   	pop    %rbp
+  802b6e:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802b6f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802b75:	eb e3                	jmp    802b5a <devcons_write+0x85>
+
+0000000000802b77 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802b77:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802b7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b7f:	48 85 c0             	test   %rax,%rax
+  802b82:	74 55                	je     802bd9 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802b84:	55                   	push   %rbp
+  802b85:	48 89 e5             	mov    %rsp,%rbp
+  802b88:	41 55                	push   %r13
+  802b8a:	41 54                	push   %r12
+  802b8c:	53                   	push   %rbx
+  802b8d:	48 83 ec 08          	sub    $0x8,%rsp
+  802b91:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802b94:	48 bb 80 10 80 00 00 	movabs $0x801080,%rbx
+  802b9b:	00 00 00 
+  802b9e:	49 bc 4d 11 80 00 00 	movabs $0x80114d,%r12
+  802ba5:	00 00 00 
+  802ba8:	eb 03                	jmp    802bad <devcons_read+0x36>
+  802baa:	41 ff d4             	call   *%r12
+  802bad:	ff d3                	call   *%rbx
+  802baf:	85 c0                	test   %eax,%eax
+  802bb1:	74 f7                	je     802baa <devcons_read+0x33>
+    if (c < 0) return c;
+  802bb3:	48 63 d0             	movslq %eax,%rdx
+  802bb6:	78 13                	js     802bcb <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802bb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bbd:	83 f8 04             	cmp    $0x4,%eax
+  802bc0:	74 09                	je     802bcb <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802bc2:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802bc6:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802bcb:	48 89 d0             	mov    %rdx,%rax
+  802bce:	48 83 c4 08          	add    $0x8,%rsp
+  802bd2:	5b                   	pop    %rbx
+  802bd3:	41 5c                	pop    %r12
+  802bd5:	41 5d                	pop    %r13
+  802bd7:	5d                   	pop    %rbp
+  802bd8:	c3                   	ret
+  802bd9:	48 89 d0             	mov    %rdx,%rax
+  802bdc:	c3                   	ret
+
+0000000000802bdd <cputchar>:
+cputchar(int ch) {
+  802bdd:	55                   	push   %rbp
+  802bde:	48 89 e5             	mov    %rsp,%rbp
+  802be1:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802be5:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802be9:	be 01 00 00 00       	mov    $0x1,%esi
+  802bee:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802bf2:	48 b8 53 10 80 00 00 	movabs $0x801053,%rax
+  802bf9:	00 00 00 
+  802bfc:	ff d0                	call   *%rax
+}
+  802bfe:	c9                   	leave
+  802bff:	c3                   	ret
+
+0000000000802c00 <getchar>:
+getchar(void) {
+  802c00:	55                   	push   %rbp
+  802c01:	48 89 e5             	mov    %rsp,%rbp
+  802c04:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802c08:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c0d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802c11:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c16:	48 b8 74 1d 80 00 00 	movabs $0x801d74,%rax
+  802c1d:	00 00 00 
+  802c20:	ff d0                	call   *%rax
+  802c22:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802c24:	85 c0                	test   %eax,%eax
+  802c26:	78 06                	js     802c2e <getchar+0x2e>
+  802c28:	74 08                	je     802c32 <getchar+0x32>
+  802c2a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802c2e:	89 d0                	mov    %edx,%eax
+  802c30:	c9                   	leave
+  802c31:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802c32:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802c37:	eb f5                	jmp    802c2e <getchar+0x2e>
+
+0000000000802c39 <iscons>:
+iscons(int fdnum) {
+  802c39:	55                   	push   %rbp
+  802c3a:	48 89 e5             	mov    %rsp,%rbp
+  802c3d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802c41:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802c45:	48 b8 91 1a 80 00 00 	movabs $0x801a91,%rax
+  802c4c:	00 00 00 
+  802c4f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c51:	85 c0                	test   %eax,%eax
+  802c53:	78 18                	js     802c6d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802c55:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c59:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802c60:	00 00 00 
+  802c63:	8b 00                	mov    (%rax),%eax
+  802c65:	39 02                	cmp    %eax,(%rdx)
+  802c67:	0f 94 c0             	sete   %al
+  802c6a:	0f b6 c0             	movzbl %al,%eax
+}
+  802c6d:	c9                   	leave
+  802c6e:	c3                   	ret
+
+0000000000802c6f <opencons>:
+opencons(void) {
+  802c6f:	55                   	push   %rbp
+  802c70:	48 89 e5             	mov    %rsp,%rbp
+  802c73:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802c77:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802c7b:	48 b8 31 1a 80 00 00 	movabs $0x801a31,%rax
+  802c82:	00 00 00 
+  802c85:	ff d0                	call   *%rax
+  802c87:	85 c0                	test   %eax,%eax
+  802c89:	78 49                	js     802cd4 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802c8b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802c90:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c95:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802c99:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c9e:	48 b8 dc 11 80 00 00 	movabs $0x8011dc,%rax
+  802ca5:	00 00 00 
+  802ca8:	ff d0                	call   *%rax
+  802caa:	85 c0                	test   %eax,%eax
+  802cac:	78 26                	js     802cd4 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802cae:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802cb2:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802cb9:	00 00 
+  802cbb:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802cbd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802cc1:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802cc8:	48 b8 03 1a 80 00 00 	movabs $0x801a03,%rax
+  802ccf:	00 00 00 
+  802cd2:	ff d0                	call   *%rax
+}
+  802cd4:	c9                   	leave
+  802cd5:	c3                   	ret
+
+0000000000802cd6 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802cd6:	55                   	push   %rbp
+  802cd7:	48 89 e5             	mov    %rsp,%rbp
+  802cda:	41 56                	push   %r14
+  802cdc:	41 55                	push   %r13
+  802cde:	41 54                	push   %r12
+  802ce0:	53                   	push   %rbx
+  802ce1:	48 83 ec 50          	sub    $0x50,%rsp
+  802ce5:	49 89 fc             	mov    %rdi,%r12
+  802ce8:	41 89 f5             	mov    %esi,%r13d
+  802ceb:	48 89 d3             	mov    %rdx,%rbx
+  802cee:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802cf2:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802cf6:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802cfa:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802d01:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d05:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802d09:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802d0d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802d11:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802d18:	00 00 00 
+  802d1b:	4c 8b 30             	mov    (%rax),%r14
+  802d1e:	48 b8 1c 11 80 00 00 	movabs $0x80111c,%rax
+  802d25:	00 00 00 
+  802d28:	ff d0                	call   *%rax
+  802d2a:	89 c6                	mov    %eax,%esi
+  802d2c:	45 89 e8             	mov    %r13d,%r8d
+  802d2f:	4c 89 e1             	mov    %r12,%rcx
+  802d32:	4c 89 f2             	mov    %r14,%rdx
+  802d35:	48 bf c0 34 80 00 00 	movabs $0x8034c0,%rdi
+  802d3c:	00 00 00 
+  802d3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d44:	49 bc 07 03 80 00 00 	movabs $0x800307,%r12
+  802d4b:	00 00 00 
+  802d4e:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802d51:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802d55:	48 89 df             	mov    %rbx,%rdi
+  802d58:	48 b8 a3 02 80 00 00 	movabs $0x8002a3,%rax
+  802d5f:	00 00 00 
+  802d62:	ff d0                	call   *%rax
+    cprintf("\n");
+  802d64:	48 bf 03 34 80 00 00 	movabs $0x803403,%rdi
+  802d6b:	00 00 00 
+  802d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d73:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802d76:	cc                   	int3
+  802d77:	eb fd                	jmp    802d76 <_panic+0xa0>
+  802d79:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000802d80 <__rodata_start>:
+  802d80:	69 20 61 6d 20 25    	imul   $0x25206d61,(%rax),%esp
+  802d86:	30 38                	xor    %bh,(%rax)
+  802d88:	78 3b                	js     802dc5 <__rodata_start+0x45>
+  802d8a:	20 74 68 69          	and    %dh,0x69(%rax,%rbp,2)
+  802d8e:	73 65                	jae    802df5 <__rodata_start+0x75>
+  802d90:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d91:	76 20                	jbe    802db3 <__rodata_start+0x33>
+  802d93:	69 73 20 25 70 0a 00 	imul   $0xa7025,0x20(%rbx),%esi
+  802d9a:	73 65                	jae    802e01 <__rodata_start+0x81>
+  802d9c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d9d:	64 20 30             	and    %dh,%fs:(%rax)
+  802da0:	20 66 72             	and    %ah,0x72(%rsi)
+  802da3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802da4:	6d                   	insl   (%dx),%es:(%rdi)
+  802da5:	20 25 78 20 74 6f    	and    %ah,0x6f742078(%rip)        # 6ff44e23 <__bss_end+0x6f73ce23>
+  802dab:	20 25 78 0a 00 25    	and    %ah,0x25000a78(%rip)        # 25803829 <__bss_end+0x24ffb829>
+  802db1:	78 20                	js     802dd3 <__rodata_start+0x53>
+  802db3:	67 6f                	outsl  %ds:(%esi),(%dx)
+  802db5:	74 20                	je     802dd7 <__rodata_start+0x57>
+  802db7:	25 64 20 66 72       	and    $0x72662064,%eax
+  802dbc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dbd:	6d                   	insl   (%dx),%es:(%rdi)
+  802dbe:	20 25 78 20 28 74    	and    %ah,0x74282078(%rip)        # 74a84e3c <__bss_end+0x7427ce3c>
+  802dc4:	68 69 73 65 6e       	push   $0x6e657369
+  802dc9:	76 20                	jbe    802deb <__rodata_start+0x6b>
+  802dcb:	69 73 20 25 70 20 25 	imul   $0x25207025,0x20(%rbx),%esi
+  802dd2:	78 29                	js     802dfd <__rodata_start+0x7d>
+  802dd4:	0a 00                	or     (%rax),%al
+  802dd6:	3c 75                	cmp    $0x75,%al
+  802dd8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dd9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802ddd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dde:	3e 00 30             	ds add %dh,(%rax)
+  802de1:	31 32                	xor    %esi,(%rdx)
+  802de3:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802dea:	41                   	rex.B
+  802deb:	42                   	rex.X
+  802dec:	43                   	rex.XB
+  802ded:	44                   	rex.R
+  802dee:	45                   	rex.RB
+  802def:	46 00 30             	rex.RX add %r14b,(%rax)
+  802df2:	31 32                	xor    %esi,(%rdx)
+  802df4:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802dfb:	61                   	(bad)
+  802dfc:	62 63 64 65 66       	(bad)
+  802e01:	00 28                	add    %ch,(%rax)
+  802e03:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e04:	75 6c                	jne    802e72 <__rodata_start+0xf2>
+  802e06:	6c                   	insb   (%dx),%es:(%rdi)
+  802e07:	29 00                	sub    %eax,(%rax)
+  802e09:	65 72 72             	gs jb  802e7e <__rodata_start+0xfe>
+  802e0c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e0d:	72 20                	jb     802e2f <__rodata_start+0xaf>
+  802e0f:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802e14:	73 70                	jae    802e86 <__rodata_start+0x106>
+  802e16:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802e1a:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802e21:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e22:	72 00                	jb     802e24 <__rodata_start+0xa4>
+  802e24:	62 61 64 20 65       	(bad)
+  802e29:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e2a:	76 69                	jbe    802e95 <__rodata_start+0x115>
+  802e2c:	72 6f                	jb     802e9d <__rodata_start+0x11d>
+  802e2e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e2f:	6d                   	insl   (%dx),%es:(%rdi)
+  802e30:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e32:	74 00                	je     802e34 <__rodata_start+0xb4>
+  802e34:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802e3b:	20 70 61             	and    %dh,0x61(%rax)
+  802e3e:	72 61                	jb     802ea1 <__rodata_start+0x121>
+  802e40:	6d                   	insl   (%dx),%es:(%rdi)
+  802e41:	65 74 65             	gs je  802ea9 <__rodata_start+0x129>
+  802e44:	72 00                	jb     802e46 <__rodata_start+0xc6>
+  802e46:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e47:	75 74                	jne    802ebd <__rodata_start+0x13d>
+  802e49:	20 6f 66             	and    %ch,0x66(%rdi)
+  802e4c:	20 6d 65             	and    %ch,0x65(%rbp)
+  802e4f:	6d                   	insl   (%dx),%es:(%rdi)
+  802e50:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e51:	72 79                	jb     802ecc <__rodata_start+0x14c>
+  802e53:	00 6f 75             	add    %ch,0x75(%rdi)
+  802e56:	74 20                	je     802e78 <__rodata_start+0xf8>
+  802e58:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e59:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802e5d:	76 69                	jbe    802ec8 <__rodata_start+0x148>
+  802e5f:	72 6f                	jb     802ed0 <__rodata_start+0x150>
+  802e61:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e62:	6d                   	insl   (%dx),%es:(%rdi)
+  802e63:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e65:	74 73                	je     802eda <__rodata_start+0x15a>
+  802e67:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802e6a:	72 72                	jb     802ede <__rodata_start+0x15e>
+  802e6c:	75 70                	jne    802ede <__rodata_start+0x15e>
+  802e6e:	74 65                	je     802ed5 <__rodata_start+0x155>
+  802e70:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802e75:	75 67                	jne    802ede <__rodata_start+0x15e>
+  802e77:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802e7a:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e7c:	00 73 65             	add    %dh,0x65(%rbx)
+  802e7f:	67 6d                	insl   (%dx),%es:(%edi)
+  802e81:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e83:	74 61                	je     802ee6 <__rodata_start+0x166>
+  802e85:	74 69                	je     802ef0 <__rodata_start+0x170>
+  802e87:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e88:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e89:	20 66 61             	and    %ah,0x61(%rsi)
+  802e8c:	75 6c                	jne    802efa <__rodata_start+0x17a>
+  802e8e:	74 00                	je     802e90 <__rodata_start+0x110>
+  802e90:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802e97:	20 45 4c             	and    %al,0x4c(%rbp)
+  802e9a:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802e9e:	61                   	(bad)
+  802e9f:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802ea4:	20 73 75             	and    %dh,0x75(%rbx)
+  802ea7:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802eaa:	73 79                	jae    802f25 <__rodata_start+0x1a5>
+  802eac:	73 74                	jae    802f22 <__rodata_start+0x1a2>
+  802eae:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802eb0:	20 63 61             	and    %ah,0x61(%rbx)
+  802eb3:	6c                   	insb   (%dx),%es:(%rdi)
+  802eb4:	6c                   	insb   (%dx),%es:(%rdi)
+  802eb5:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802eb8:	74 72                	je     802f2c <__rodata_start+0x1ac>
+  802eba:	79 20                	jns    802edc <__rodata_start+0x15c>
+  802ebc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ebd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ebe:	74 20                	je     802ee0 <__rodata_start+0x160>
+  802ec0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802ec2:	75 6e                	jne    802f32 <__rodata_start+0x1b2>
+  802ec4:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802ec8:	76 20                	jbe    802eea <__rodata_start+0x16a>
+  802eca:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802ed1:	72 65                	jb     802f38 <__rodata_start+0x1b8>
+  802ed3:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802ed6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ed7:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802edb:	65 78 70             	gs js  802f4e <__rodata_start+0x1ce>
+  802ede:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802ee3:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802ee6:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802eea:	20 66 69             	and    %ah,0x69(%rsi)
+  802eed:	6c                   	insb   (%dx),%es:(%rdi)
+  802eee:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802ef2:	20 66 72             	and    %ah,0x72(%rsi)
+  802ef5:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802efa:	61                   	(bad)
+  802efb:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802efe:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eff:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f00:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802f04:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802f07:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f08:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f09:	20 6d 61             	and    %ch,0x61(%rbp)
+  802f0c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f0d:	79 20                	jns    802f2f <__rodata_start+0x1af>
+  802f0f:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802f16:	72 65                	jb     802f7d <__rodata_start+0x1fd>
+  802f18:	20 6f 70             	and    %ch,0x70(%rdi)
+  802f1b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f1d:	00 66 69             	add    %ah,0x69(%rsi)
+  802f20:	6c                   	insb   (%dx),%es:(%rdi)
+  802f21:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802f25:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802f28:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f29:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802f2c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f2d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f2e:	74 20                	je     802f50 <__rodata_start+0x1d0>
+  802f30:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802f32:	75 6e                	jne    802fa2 <__rodata_start+0x222>
+  802f34:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802f38:	76 61                	jbe    802f9b <__rodata_start+0x21b>
+  802f3a:	6c                   	insb   (%dx),%es:(%rdi)
+  802f3b:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802f42:	00 
+  802f43:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802f4a:	72 65                	jb     802fb1 <__rodata_start+0x231>
+  802f4c:	61                   	(bad)
+  802f4d:	64 79 20             	fs jns 802f70 <__rodata_start+0x1f0>
+  802f50:	65 78 69             	gs js  802fbc <__rodata_start+0x23c>
+  802f53:	73 74                	jae    802fc9 <__rodata_start+0x249>
+  802f55:	73 00                	jae    802f57 <__rodata_start+0x1d7>
+  802f57:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f58:	70 65                	jo     802fbf <__rodata_start+0x23f>
+  802f5a:	72 61                	jb     802fbd <__rodata_start+0x23d>
+  802f5c:	74 69                	je     802fc7 <__rodata_start+0x247>
+  802f5e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f5f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f60:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802f63:	74 20                	je     802f85 <__rodata_start+0x205>
+  802f65:	73 75                	jae    802fdc <__rodata_start+0x25c>
+  802f67:	70 70                	jo     802fd9 <__rodata_start+0x259>
+  802f69:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f6a:	72 74                	jb     802fe0 <__rodata_start+0x260>
+  802f6c:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802f71:	65 72 61             	gs jb  802fd5 <__rodata_start+0x255>
+  802f74:	74 69                	je     802fdf <__rodata_start+0x25f>
+  802f76:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f77:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f78:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802f7b:	74 20                	je     802f9d <__rodata_start+0x21d>
+  802f7d:	70 65                	jo     802fe4 <__rodata_start+0x264>
+  802f7f:	72 6d                	jb     802fee <__rodata_start+0x26e>
+  802f81:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  802f88:	2e 
+  802f89:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  802f90:	00 
+  802f91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802f98:	00 00 00 
+  802f9b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+  802fa0:	f4                   	hlt
+  802fa1:	04 80                	add    $0x80,%al
+  802fa3:	00 00                	add    %al,(%rax)
+  802fa5:	00 00                	add    %al,(%rax)
+  802fa7:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80afb8 <__bss_end+0x2fb8>
+  802fad:	00 00                	add    %al,(%rax)
+  802faf:	00 25 0b 80 00 00    	add    %ah,0x800b(%rip)        # 80afc0 <__bss_end+0x2fc0>
+  802fb5:	00 00                	add    %al,(%rax)
+  802fb7:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80afc8 <__bss_end+0x2fc8>
+  802fbd:	00 00                	add    %al,(%rax)
+  802fbf:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80afd0 <__bss_end+0x2fd0>
+  802fc5:	00 00                	add    %al,(%rax)
+  802fc7:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80afd8 <__bss_end+0x2fd8>
+  802fcd:	00 00                	add    %al,(%rax)
+  802fcf:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80afe0 <__bss_end+0x2fe0>
+  802fd5:	00 00                	add    %al,(%rax)
+  802fd7:	00 13                	add    %dl,(%rbx)
+  802fd9:	05 80 00 00 00       	add    $0x80,%eax
+  802fde:	00 00                	add    %al,(%rax)
+  802fe0:	35 0b 80 00 00       	xor    $0x800b,%eax
+  802fe5:	00 00                	add    %al,(%rax)
+  802fe7:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80aff8 <__bss_end+0x2ff8>
+  802fed:	00 00                	add    %al,(%rax)
+  802fef:	00 07                	add    %al,(%rdi)
+  802ff1:	05 80 00 00 00       	add    $0x80,%eax
+  802ff6:	00 00                	add    %al,(%rax)
+  802ff8:	81 05 80 00 00 00 00 	addl   $0xb350000,0x80(%rip)        # 803082 <__rodata_start+0x302>
+  802fff:	00 35 0b 
+  803002:	80 00 00             	addb   $0x0,(%rax)
+  803005:	00 00                	add    %al,(%rax)
+  803007:	00 07                	add    %al,(%rdi)
+  803009:	05 80 00 00 00       	add    $0x80,%eax
+  80300e:	00 00                	add    %al,(%rax)
+  803010:	4d 05 80 00 00 00    	rex.WRB add $0x80,%rax
+  803016:	00 00                	add    %al,(%rax)
+  803018:	4d 05 80 00 00 00    	rex.WRB add $0x80,%rax
+  80301e:	00 00                	add    %al,(%rax)
+  803020:	4d 05 80 00 00 00    	rex.WRB add $0x80,%rax
+  803026:	00 00                	add    %al,(%rax)
+  803028:	4d 05 80 00 00 00    	rex.WRB add $0x80,%rax
+  80302e:	00 00                	add    %al,(%rax)
+  803030:	4d 05 80 00 00 00    	rex.WRB add $0x80,%rax
+  803036:	00 00                	add    %al,(%rax)
+  803038:	4d 05 80 00 00 00    	rex.WRB add $0x80,%rax
+  80303e:	00 00                	add    %al,(%rax)
+  803040:	4d 05 80 00 00 00    	rex.WRB add $0x80,%rax
+  803046:	00 00                	add    %al,(%rax)
+  803048:	4d 05 80 00 00 00    	rex.WRB add $0x80,%rax
+  80304e:	00 00                	add    %al,(%rax)
+  803050:	4d 05 80 00 00 00    	rex.WRB add $0x80,%rax
+  803056:	00 00                	add    %al,(%rax)
+  803058:	35 0b 80 00 00       	xor    $0x800b,%eax
+  80305d:	00 00                	add    %al,(%rax)
+  80305f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b070 <__bss_end+0x3070>
+  803065:	00 00                	add    %al,(%rax)
+  803067:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b078 <__bss_end+0x3078>
+  80306d:	00 00                	add    %al,(%rax)
+  80306f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b080 <__bss_end+0x3080>
+  803075:	00 00                	add    %al,(%rax)
+  803077:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b088 <__bss_end+0x3088>
+  80307d:	00 00                	add    %al,(%rax)
+  80307f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b090 <__bss_end+0x3090>
+  803085:	00 00                	add    %al,(%rax)
+  803087:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b098 <__bss_end+0x3098>
+  80308d:	00 00                	add    %al,(%rax)
+  80308f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b0a0 <__bss_end+0x30a0>
+  803095:	00 00                	add    %al,(%rax)
+  803097:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b0a8 <__bss_end+0x30a8>
+  80309d:	00 00                	add    %al,(%rax)
+  80309f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b0b0 <__bss_end+0x30b0>
+  8030a5:	00 00                	add    %al,(%rax)
+  8030a7:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b0b8 <__bss_end+0x30b8>
+  8030ad:	00 00                	add    %al,(%rax)
+  8030af:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b0c0 <__bss_end+0x30c0>
+  8030b5:	00 00                	add    %al,(%rax)
+  8030b7:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b0c8 <__bss_end+0x30c8>
+  8030bd:	00 00                	add    %al,(%rax)
+  8030bf:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b0d0 <__bss_end+0x30d0>
+  8030c5:	00 00                	add    %al,(%rax)
+  8030c7:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b0d8 <__bss_end+0x30d8>
+  8030cd:	00 00                	add    %al,(%rax)
+  8030cf:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b0e0 <__bss_end+0x30e0>
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b0e8 <__bss_end+0x30e8>
+  8030dd:	00 00                	add    %al,(%rax)
+  8030df:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b0f0 <__bss_end+0x30f0>
+  8030e5:	00 00                	add    %al,(%rax)
+  8030e7:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b0f8 <__bss_end+0x30f8>
+  8030ed:	00 00                	add    %al,(%rax)
+  8030ef:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b100 <__bss_end+0x3100>
+  8030f5:	00 00                	add    %al,(%rax)
+  8030f7:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b108 <__bss_end+0x3108>
+  8030fd:	00 00                	add    %al,(%rax)
+  8030ff:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b110 <__bss_end+0x3110>
+  803105:	00 00                	add    %al,(%rax)
+  803107:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b118 <__bss_end+0x3118>
+  80310d:	00 00                	add    %al,(%rax)
+  80310f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b120 <__bss_end+0x3120>
+  803115:	00 00                	add    %al,(%rax)
+  803117:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b128 <__bss_end+0x3128>
+  80311d:	00 00                	add    %al,(%rax)
+  80311f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b130 <__bss_end+0x3130>
+  803125:	00 00                	add    %al,(%rax)
+  803127:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b138 <__bss_end+0x3138>
+  80312d:	00 00                	add    %al,(%rax)
+  80312f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b140 <__bss_end+0x3140>
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b148 <__bss_end+0x3148>
+  80313d:	00 00                	add    %al,(%rax)
+  80313f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b150 <__bss_end+0x3150>
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 58 0a             	add    %bl,0xa(%rax)
+  80314a:	80 00 00             	addb   $0x0,(%rax)
+  80314d:	00 00                	add    %al,(%rax)
+  80314f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b160 <__bss_end+0x3160>
+  803155:	00 00                	add    %al,(%rax)
+  803157:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b168 <__bss_end+0x3168>
+  80315d:	00 00                	add    %al,(%rax)
+  80315f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b170 <__bss_end+0x3170>
+  803165:	00 00                	add    %al,(%rax)
+  803167:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b178 <__bss_end+0x3178>
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b180 <__bss_end+0x3180>
+  803175:	00 00                	add    %al,(%rax)
+  803177:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b188 <__bss_end+0x3188>
+  80317d:	00 00                	add    %al,(%rax)
+  80317f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b190 <__bss_end+0x3190>
+  803185:	00 00                	add    %al,(%rax)
+  803187:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b198 <__bss_end+0x3198>
+  80318d:	00 00                	add    %al,(%rax)
+  80318f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b1a0 <__bss_end+0x31a0>
+  803195:	00 00                	add    %al,(%rax)
+  803197:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b1a8 <__bss_end+0x31a8>
+  80319d:	00 00                	add    %al,(%rax)
+  80319f:	00 a4 05 80 00 00 00 	add    %ah,0x80(%rbp,%rax,1)
+  8031a6:	00 00                	add    %al,(%rax)
+  8031a8:	73 07                	jae    8031b1 <__rodata_start+0x431>
+  8031aa:	80 00 00             	addb   $0x0,(%rax)
+  8031ad:	00 00                	add    %al,(%rax)
+  8031af:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b1c0 <__bss_end+0x31c0>
+  8031b5:	00 00                	add    %al,(%rax)
+  8031b7:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b1c8 <__bss_end+0x31c8>
+  8031bd:	00 00                	add    %al,(%rax)
+  8031bf:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b1d0 <__bss_end+0x31d0>
+  8031c5:	00 00                	add    %al,(%rax)
+  8031c7:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b1d8 <__bss_end+0x31d8>
+  8031cd:	00 00                	add    %al,(%rax)
+  8031cf:	00 d3                	add    %dl,%bl
+  8031d1:	05 80 00 00 00       	add    $0x80,%eax
+  8031d6:	00 00                	add    %al,(%rax)
+  8031d8:	35 0b 80 00 00       	xor    $0x800b,%eax
+  8031dd:	00 00                	add    %al,(%rax)
+  8031df:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b1f0 <__bss_end+0x31f0>
+  8031e5:	00 00                	add    %al,(%rax)
+  8031e7:	00 99 05 80 00 00    	add    %bl,0x8005(%rcx)
+  8031ed:	00 00                	add    %al,(%rax)
+  8031ef:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b200 <__bss_end+0x3200>
+  8031f5:	00 00                	add    %al,(%rax)
+  8031f7:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b208 <__bss_end+0x3208>
+  8031fd:	00 00                	add    %al,(%rax)
+  8031ff:	00 1b                	add    %bl,(%rbx)
+  803201:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803207:	00 e5                	add    %ah,%ch
+  803209:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80320f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b220 <__bss_end+0x3220>
+  803215:	00 00                	add    %al,(%rax)
+  803217:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b228 <__bss_end+0x3228>
+  80321d:	00 00                	add    %al,(%rax)
+  80321f:	00 6a 06             	add    %ch,0x6(%rdx)
+  803222:	80 00 00             	addb   $0x0,(%rax)
+  803225:	00 00                	add    %al,(%rax)
+  803227:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b238 <__bss_end+0x3238>
+  80322d:	00 00                	add    %al,(%rax)
+  80322f:	00 47 08             	add    %al,0x8(%rdi)
+  803232:	80 00 00             	addb   $0x0,(%rax)
+  803235:	00 00                	add    %al,(%rax)
+  803237:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b248 <__bss_end+0x3248>
+  80323d:	00 00                	add    %al,(%rax)
+  80323f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b250 <__bss_end+0x3250>
+  803245:	00 00                	add    %al,(%rax)
+  803247:	00 58 0a             	add    %bl,0xa(%rax)
+  80324a:	80 00 00             	addb   $0x0,(%rax)
+  80324d:	00 00                	add    %al,(%rax)
+  80324f:	00 35 0b 80 00 00    	add    %dh,0x800b(%rip)        # 80b260 <__bss_end+0x3260>
+  803255:	00 00                	add    %al,(%rax)
+  803257:	00 fd                	add    %bh,%ch
+  803259:	04 80                	add    $0x80,%al
+  80325b:	00 00                	add    %al,(%rax)
+  80325d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803260 <error_string>:
+	...
+  803268:	12 2e 80 00 00 00 00 00 24 2e 80 00 00 00 00 00     ........$.......
+  803278:	34 2e 80 00 00 00 00 00 46 2e 80 00 00 00 00 00     4.......F.......
+  803288:	54 2e 80 00 00 00 00 00 68 2e 80 00 00 00 00 00     T.......h.......
+  803298:	7d 2e 80 00 00 00 00 00 90 2e 80 00 00 00 00 00     }...............
+  8032a8:	a2 2e 80 00 00 00 00 00 b6 2e 80 00 00 00 00 00     ................
+  8032b8:	c6 2e 80 00 00 00 00 00 d9 2e 80 00 00 00 00 00     ................
+  8032c8:	f0 2e 80 00 00 00 00 00 06 2f 80 00 00 00 00 00     ........./......
+  8032d8:	1e 2f 80 00 00 00 00 00 36 2f 80 00 00 00 00 00     ./......6/......
+  8032e8:	43 2f 80 00 00 00 00 00 10 33 80 00 00 00 00 00     C/.......3......
+  8032f8:	57 2f 80 00 00 00 00 00 00 00 00 00 00 00 00 00     W/..............
+  803308:	6f 2f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     o/......file is 
+  803318:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803328:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803338:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803348:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803358:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  803368:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  803378:	6c 69 62 2f 66 6f 72 6b 2e 63 00 69 70 63 5f 73     lib/fork.c.ipc_s
+  803388:	65 6e 64 3a 20 66 61 69 6c 65 64 20 74 6f 20 73     end: failed to s
+  803398:	65 6e 64 00 6c 69 62 2f 69 70 63 2e 63 00 66 90     end.lib/ipc.c.f.
+  8033a8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8033b8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8033c8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8033d8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8033e8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8033f8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803408:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803418:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803428:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803438:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000803440 <devtab>:
+  803440:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803450:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803460:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803470:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803480:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803490:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8034a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8034b0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8034c0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8034d0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8034e0:	3a 20 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     : .f.........f..
+  8034f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803500:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803510:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803520:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803530:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803540:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803550:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803560:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803570:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803580:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803590:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803600:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803610:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803620:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803630:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803640:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803650:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803660:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803670:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803680:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803690:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803700:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803710:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803720:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803730:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803740:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803750:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803760:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803770:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803780:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803790:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
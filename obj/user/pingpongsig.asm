@@ -0,0 +1,6486 @@
+
+obj/user/pingpongsig:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 e1 01 00 00       	call   800204 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+volatile sig_atomic_t sender = 0;
+volatile sig_atomic_t updated = 0;
+
+static void
+handler(int signo, siginfo_t * info, void * ctx) {
+    assert(signo == SIGUSR1);
+  800025:	83 ff 0a             	cmp    $0xa,%edi
+  800028:	75 29                	jne    800053 <handler+0x2e>
+    value = info->si_value.sival_int;
+  80002a:	8b 46 18             	mov    0x18(%rsi),%eax
+  80002d:	a3 08 50 80 00 00 00 	movabs %eax,0x805008
+  800034:	00 00 
+    sender = info->si_pid;
+  800036:	8b 46 08             	mov    0x8(%rsi),%eax
+  800039:	a3 04 50 80 00 00 00 	movabs %eax,0x805004
+  800040:	00 00 
+    updated = 1;
+  800042:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800049:	00 00 00 
+  80004c:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+  800052:	c3                   	ret
+handler(int signo, siginfo_t * info, void * ctx) {
+  800053:	55                   	push   %rbp
+  800054:	48 89 e5             	mov    %rsp,%rbp
+    assert(signo == SIGUSR1);
+  800057:	48 b9 48 33 80 00 00 	movabs $0x803348,%rcx
+  80005e:	00 00 00 
+  800061:	48 ba 59 33 80 00 00 	movabs $0x803359,%rdx
+  800068:	00 00 00 
+  80006b:	be 0d 00 00 00       	mov    $0xd,%esi
+  800070:	48 bf 6e 33 80 00 00 	movabs $0x80336e,%rdi
+  800077:	00 00 00 
+  80007a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007f:	49 b8 ce 02 80 00 00 	movabs $0x8002ce,%r8
+  800086:	00 00 00 
+  800089:	41 ff d0             	call   *%r8
+
+000000000080008c <umain>:
+}
+
+void
+umain(int argc, char **argv) {
+  80008c:	55                   	push   %rbp
+  80008d:	48 89 e5             	mov    %rsp,%rbp
+  800090:	41 57                	push   %r15
+  800092:	41 56                	push   %r14
+  800094:	41 55                	push   %r13
+  800096:	41 54                	push   %r12
+  800098:	53                   	push   %rbx
+  800099:	48 83 ec 28          	sub    $0x28,%rsp
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+  80009d:	ba 10 00 00 00       	mov    $0x10,%edx
+  8000a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8000a7:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8000ab:	48 b8 8f 0e 80 00 00 	movabs $0x800e8f,%rax
+  8000b2:	00 00 00 
+  8000b5:	ff d0                	call   *%rax
+    sa.sa_sigaction = handler;
+  8000b7:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000be:	00 00 00 
+  8000c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    sa.sa_flags = SA_SIGINFO;
+  8000c5:	c7 45 cc 04 00 00 00 	movl   $0x4,-0x34(%rbp)
+    sigaction(SIGUSR1, &sa, NULL);
+  8000cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d1:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  8000d5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8000da:	48 b8 b3 2b 80 00 00 	movabs $0x802bb3,%rax
+  8000e1:	00 00 00 
+  8000e4:	ff d0                	call   *%rax
+
+    envid_t who;
+
+    if ((who = fork()) != 0) {
+  8000e6:	48 b8 95 18 80 00 00 	movabs $0x801895,%rax
+  8000ed:	00 00 00 
+  8000f0:	ff d0                	call   *%rax
+  8000f2:	85 c0                	test   %eax,%eax
+  8000f4:	75 20                	jne    800116 <umain+0x8a>
+        sv.sival_int = 0;
+        sigqueue(who, SIGUSR1, sv);
+    }
+
+    while (1) {
+        while (!updated) {
+  8000f6:	49 bc 00 50 80 00 00 	movabs $0x805000,%r12
+  8000fd:	00 00 00 
+            sys_yield();
+        }
+        updated = 0;
+        cprintf("%x got %d from %x\n", sys_getenvid(), value, sender);
+  800100:	49 bd 04 50 80 00 00 	movabs $0x805004,%r13
+  800107:	00 00 00 
+  80010a:	48 bb 08 50 80 00 00 	movabs $0x805008,%rbx
+  800111:	00 00 00 
+  800114:	eb 53                	jmp    800169 <umain+0xdd>
+  800116:	89 c3                	mov    %eax,%ebx
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  800118:	48 b8 33 12 80 00 00 	movabs $0x801233,%rax
+  80011f:	00 00 00 
+  800122:	ff d0                	call   *%rax
+  800124:	89 c6                	mov    %eax,%esi
+  800126:	89 da                	mov    %ebx,%edx
+  800128:	48 bf 81 33 80 00 00 	movabs $0x803381,%rdi
+  80012f:	00 00 00 
+  800132:	b8 00 00 00 00       	mov    $0x0,%eax
+  800137:	48 b9 1e 04 80 00 00 	movabs $0x80041e,%rcx
+  80013e:	00 00 00 
+  800141:	ff d1                	call   *%rcx
+        sigqueue(who, SIGUSR1, sv);
+  800143:	ba 00 00 00 00       	mov    $0x0,%edx
+  800148:	be 0a 00 00 00       	mov    $0xa,%esi
+  80014d:	89 df                	mov    %ebx,%edi
+  80014f:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  800156:	00 00 00 
+  800159:	ff d0                	call   *%rax
+  80015b:	eb 99                	jmp    8000f6 <umain+0x6a>
+            sys_yield();
+  80015d:	48 b8 64 12 80 00 00 	movabs $0x801264,%rax
+  800164:	00 00 00 
+  800167:	ff d0                	call   *%rax
+        while (!updated) {
+  800169:	41 8b 04 24          	mov    (%r12),%eax
+  80016d:	85 c0                	test   %eax,%eax
+  80016f:	74 ec                	je     80015d <umain+0xd1>
+        updated = 0;
+  800171:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  800178:	00 
+        cprintf("%x got %d from %x\n", sys_getenvid(), value, sender);
+  800179:	45 8b 7d 00          	mov    0x0(%r13),%r15d
+  80017d:	44 8b 33             	mov    (%rbx),%r14d
+  800180:	48 b8 33 12 80 00 00 	movabs $0x801233,%rax
+  800187:	00 00 00 
+  80018a:	ff d0                	call   *%rax
+  80018c:	89 c6                	mov    %eax,%esi
+  80018e:	44 89 f9             	mov    %r15d,%ecx
+  800191:	44 89 f2             	mov    %r14d,%edx
+  800194:	48 bf 97 33 80 00 00 	movabs $0x803397,%rdi
+  80019b:	00 00 00 
+  80019e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a3:	49 b8 1e 04 80 00 00 	movabs $0x80041e,%r8
+  8001aa:	00 00 00 
+  8001ad:	41 ff d0             	call   *%r8
+        if (value == 10) return;
+  8001b0:	8b 03                	mov    (%rbx),%eax
+  8001b2:	83 f8 0a             	cmp    $0xa,%eax
+  8001b5:	74 3e                	je     8001f5 <umain+0x169>
+        union sigval sv;
+        sv.sival_int = value + 1;
+  8001b7:	44 8b 33             	mov    (%rbx),%r14d
+  8001ba:	41 83 c6 01          	add    $0x1,%r14d
+        sigqueue(sender, SIGUSR1, sv);
+  8001be:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8001c2:	44 89 f0             	mov    %r14d,%eax
+  8001c5:	48 ba 00 00 00 00 ff 	movabs $0xffffffff00000000,%rdx
+  8001cc:	ff ff ff 
+  8001cf:	48 23 55 b8          	and    -0x48(%rbp),%rdx
+  8001d3:	48 09 c2             	or     %rax,%rdx
+  8001d6:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8001da:	be 0a 00 00 00       	mov    $0xa,%esi
+  8001df:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  8001e6:	00 00 00 
+  8001e9:	ff d0                	call   *%rax
+        if (sv.sival_int == 10) return;
+  8001eb:	41 83 fe 0a          	cmp    $0xa,%r14d
+  8001ef:	0f 85 74 ff ff ff    	jne    800169 <umain+0xdd>
+    }
+}
+  8001f5:	48 83 c4 28          	add    $0x28,%rsp
+  8001f9:	5b                   	pop    %rbx
+  8001fa:	41 5c                	pop    %r12
+  8001fc:	41 5d                	pop    %r13
+  8001fe:	41 5e                	pop    %r14
+  800200:	41 5f                	pop    %r15
+  800202:	5d                   	pop    %rbp
+  800203:	c3                   	ret
+
+0000000000800204 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800204:	55                   	push   %rbp
+  800205:	48 89 e5             	mov    %rsp,%rbp
+  800208:	41 56                	push   %r14
+  80020a:	41 55                	push   %r13
+  80020c:	41 54                	push   %r12
+  80020e:	53                   	push   %rbx
+  80020f:	41 89 fd             	mov    %edi,%r13d
+  800212:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800215:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80021c:	00 00 00 
+  80021f:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800226:	00 00 00 
+  800229:	48 39 c2             	cmp    %rax,%rdx
+  80022c:	73 17                	jae    800245 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80022e:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800231:	49 89 c4             	mov    %rax,%r12
+  800234:	48 83 c3 08          	add    $0x8,%rbx
+  800238:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023d:	ff 53 f8             	call   *-0x8(%rbx)
+  800240:	4c 39 e3             	cmp    %r12,%rbx
+  800243:	72 ef                	jb     800234 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800245:	48 b8 33 12 80 00 00 	movabs $0x801233,%rax
+  80024c:	00 00 00 
+  80024f:	ff d0                	call   *%rax
+  800251:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800254:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80025b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800262:	00 00 00 
+  800265:	48 01 d0             	add    %rdx,%rax
+  800268:	48 a3 10 50 80 00 00 	movabs %rax,0x805010
+  80026f:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800272:	45 85 ed             	test   %r13d,%r13d
+  800275:	7e 0d                	jle    800284 <libmain+0x80>
+  800277:	49 8b 06             	mov    (%r14),%rax
+  80027a:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800281:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800284:	4c 89 f6             	mov    %r14,%rsi
+  800287:	44 89 ef             	mov    %r13d,%edi
+  80028a:	48 b8 8c 00 80 00 00 	movabs $0x80008c,%rax
+  800291:	00 00 00 
+  800294:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800296:	48 b8 ab 02 80 00 00 	movabs $0x8002ab,%rax
+  80029d:	00 00 00 
+  8002a0:	ff d0                	call   *%rax
+#endif
+}
+  8002a2:	5b                   	pop    %rbx
+  8002a3:	41 5c                	pop    %r12
+  8002a5:	41 5d                	pop    %r13
+  8002a7:	41 5e                	pop    %r14
+  8002a9:	5d                   	pop    %rbp
+  8002aa:	c3                   	ret
+
+00000000008002ab <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8002ab:	55                   	push   %rbp
+  8002ac:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8002af:	48 b8 bb 1b 80 00 00 	movabs $0x801bbb,%rax
+  8002b6:	00 00 00 
+  8002b9:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002c0:	48 b8 c8 11 80 00 00 	movabs $0x8011c8,%rax
+  8002c7:	00 00 00 
+  8002ca:	ff d0                	call   *%rax
+}
+  8002cc:	5d                   	pop    %rbp
+  8002cd:	c3                   	ret
+
+00000000008002ce <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8002ce:	55                   	push   %rbp
+  8002cf:	48 89 e5             	mov    %rsp,%rbp
+  8002d2:	41 56                	push   %r14
+  8002d4:	41 55                	push   %r13
+  8002d6:	41 54                	push   %r12
+  8002d8:	53                   	push   %rbx
+  8002d9:	48 83 ec 50          	sub    $0x50,%rsp
+  8002dd:	49 89 fc             	mov    %rdi,%r12
+  8002e0:	41 89 f5             	mov    %esi,%r13d
+  8002e3:	48 89 d3             	mov    %rdx,%rbx
+  8002e6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002ea:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002ee:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002f2:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8002f9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002fd:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800301:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800305:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800309:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800310:	00 00 00 
+  800313:	4c 8b 30             	mov    (%rax),%r14
+  800316:	48 b8 33 12 80 00 00 	movabs $0x801233,%rax
+  80031d:	00 00 00 
+  800320:	ff d0                	call   *%rax
+  800322:	89 c6                	mov    %eax,%esi
+  800324:	45 89 e8             	mov    %r13d,%r8d
+  800327:	4c 89 e1             	mov    %r12,%rcx
+  80032a:	4c 89 f2             	mov    %r14,%rdx
+  80032d:	48 bf b8 33 80 00 00 	movabs $0x8033b8,%rdi
+  800334:	00 00 00 
+  800337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033c:	49 bc 1e 04 80 00 00 	movabs $0x80041e,%r12
+  800343:	00 00 00 
+  800346:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800349:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80034d:	48 89 df             	mov    %rbx,%rdi
+  800350:	48 b8 ba 03 80 00 00 	movabs $0x8003ba,%rax
+  800357:	00 00 00 
+  80035a:	ff d0                	call   *%rax
+    cprintf("\n");
+  80035c:	48 bf e3 39 80 00 00 	movabs $0x8039e3,%rdi
+  800363:	00 00 00 
+  800366:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80036e:	cc                   	int3
+  80036f:	eb fd                	jmp    80036e <_panic+0xa0>
+
+0000000000800371 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800371:	55                   	push   %rbp
+  800372:	48 89 e5             	mov    %rsp,%rbp
+  800375:	53                   	push   %rbx
+  800376:	48 83 ec 08          	sub    $0x8,%rsp
+  80037a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80037d:	8b 06                	mov    (%rsi),%eax
+  80037f:	8d 50 01             	lea    0x1(%rax),%edx
+  800382:	89 16                	mov    %edx,(%rsi)
+  800384:	48 98                	cltq
+  800386:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80038b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800391:	74 0a                	je     80039d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800393:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800397:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80039b:	c9                   	leave
+  80039c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80039d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8003a1:	be ff 00 00 00       	mov    $0xff,%esi
+  8003a6:	48 b8 6a 11 80 00 00 	movabs $0x80116a,%rax
+  8003ad:	00 00 00 
+  8003b0:	ff d0                	call   *%rax
+        state->offset = 0;
+  8003b2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003b8:	eb d9                	jmp    800393 <putch+0x22>
+
+00000000008003ba <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003ba:	55                   	push   %rbp
+  8003bb:	48 89 e5             	mov    %rsp,%rbp
+  8003be:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003c5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8003c8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8003cf:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8003d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003dc:	48 89 f1             	mov    %rsi,%rcx
+  8003df:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8003e6:	48 bf 71 03 80 00 00 	movabs $0x800371,%rdi
+  8003ed:	00 00 00 
+  8003f0:	48 b8 6e 05 80 00 00 	movabs $0x80056e,%rax
+  8003f7:	00 00 00 
+  8003fa:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003fc:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800403:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80040a:	48 b8 6a 11 80 00 00 	movabs $0x80116a,%rax
+  800411:	00 00 00 
+  800414:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800416:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80041c:	c9                   	leave
+  80041d:	c3                   	ret
+
+000000000080041e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80041e:	55                   	push   %rbp
+  80041f:	48 89 e5             	mov    %rsp,%rbp
+  800422:	48 83 ec 50          	sub    $0x50,%rsp
+  800426:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80042a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80042e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800432:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800436:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80043a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800441:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800445:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800449:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80044d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800451:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800455:	48 b8 ba 03 80 00 00 	movabs $0x8003ba,%rax
+  80045c:	00 00 00 
+  80045f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800461:	c9                   	leave
+  800462:	c3                   	ret
+
+0000000000800463 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800463:	55                   	push   %rbp
+  800464:	48 89 e5             	mov    %rsp,%rbp
+  800467:	41 57                	push   %r15
+  800469:	41 56                	push   %r14
+  80046b:	41 55                	push   %r13
+  80046d:	41 54                	push   %r12
+  80046f:	53                   	push   %rbx
+  800470:	48 83 ec 18          	sub    $0x18,%rsp
+  800474:	49 89 fc             	mov    %rdi,%r12
+  800477:	49 89 f5             	mov    %rsi,%r13
+  80047a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80047e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800481:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800484:	41 89 cf             	mov    %ecx,%r15d
+  800487:	4c 39 fa             	cmp    %r15,%rdx
+  80048a:	73 5b                	jae    8004e7 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80048c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800490:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800494:	85 db                	test   %ebx,%ebx
+  800496:	7e 0e                	jle    8004a6 <print_num+0x43>
+            putch(padc, put_arg);
+  800498:	4c 89 ee             	mov    %r13,%rsi
+  80049b:	44 89 f7             	mov    %r14d,%edi
+  80049e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8004a1:	83 eb 01             	sub    $0x1,%ebx
+  8004a4:	75 f2                	jne    800498 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8004a6:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8004aa:	48 b9 ec 33 80 00 00 	movabs $0x8033ec,%rcx
+  8004b1:	00 00 00 
+  8004b4:	48 b8 db 33 80 00 00 	movabs $0x8033db,%rax
+  8004bb:	00 00 00 
+  8004be:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8004c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004cb:	49 f7 f7             	div    %r15
+  8004ce:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8004d2:	4c 89 ee             	mov    %r13,%rsi
+  8004d5:	41 ff d4             	call   *%r12
+}
+  8004d8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004dc:	5b                   	pop    %rbx
+  8004dd:	41 5c                	pop    %r12
+  8004df:	41 5d                	pop    %r13
+  8004e1:	41 5e                	pop    %r14
+  8004e3:	41 5f                	pop    %r15
+  8004e5:	5d                   	pop    %rbp
+  8004e6:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8004e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004f0:	49 f7 f7             	div    %r15
+  8004f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8004f7:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004fb:	52                   	push   %rdx
+  8004fc:	45 0f be c9          	movsbl %r9b,%r9d
+  800500:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800504:	48 89 c2             	mov    %rax,%rdx
+  800507:	48 b8 63 04 80 00 00 	movabs $0x800463,%rax
+  80050e:	00 00 00 
+  800511:	ff d0                	call   *%rax
+  800513:	48 83 c4 10          	add    $0x10,%rsp
+  800517:	eb 8d                	jmp    8004a6 <print_num+0x43>
+
+0000000000800519 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800519:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80051d:	48 8b 06             	mov    (%rsi),%rax
+  800520:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800524:	73 0a                	jae    800530 <sprintputch+0x17>
+        *state->start++ = ch;
+  800526:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80052a:	48 89 16             	mov    %rdx,(%rsi)
+  80052d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800530:	c3                   	ret
+
+0000000000800531 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800531:	55                   	push   %rbp
+  800532:	48 89 e5             	mov    %rsp,%rbp
+  800535:	48 83 ec 50          	sub    $0x50,%rsp
+  800539:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800541:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800545:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80054c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800550:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800554:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800558:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80055c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800560:	48 b8 6e 05 80 00 00 	movabs $0x80056e,%rax
+  800567:	00 00 00 
+  80056a:	ff d0                	call   *%rax
+}
+  80056c:	c9                   	leave
+  80056d:	c3                   	ret
+
+000000000080056e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80056e:	55                   	push   %rbp
+  80056f:	48 89 e5             	mov    %rsp,%rbp
+  800572:	41 57                	push   %r15
+  800574:	41 56                	push   %r14
+  800576:	41 55                	push   %r13
+  800578:	41 54                	push   %r12
+  80057a:	53                   	push   %rbx
+  80057b:	48 83 ec 38          	sub    $0x38,%rsp
+  80057f:	49 89 fe             	mov    %rdi,%r14
+  800582:	49 89 f5             	mov    %rsi,%r13
+  800585:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800588:	48 8b 01             	mov    (%rcx),%rax
+  80058b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80058f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800593:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800597:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80059b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80059f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8005a3:	0f b6 3b             	movzbl (%rbx),%edi
+  8005a6:	40 80 ff 25          	cmp    $0x25,%dil
+  8005aa:	74 18                	je     8005c4 <vprintfmt+0x56>
+            if (!ch) return;
+  8005ac:	40 84 ff             	test   %dil,%dil
+  8005af:	0f 84 b1 06 00 00    	je     800c66 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8005b5:	40 0f b6 ff          	movzbl %dil,%edi
+  8005b9:	4c 89 ee             	mov    %r13,%rsi
+  8005bc:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005bf:	4c 89 e3             	mov    %r12,%rbx
+  8005c2:	eb db                	jmp    80059f <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8005c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8005c9:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8005cd:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8005d2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005d8:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005df:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005e3:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005e8:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005ed:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005f0:	83 e8 23             	sub    $0x23,%eax
+  8005f3:	3c 57                	cmp    $0x57,%al
+  8005f5:	0f 87 51 06 00 00    	ja     800c4c <vprintfmt+0x6de>
+  8005fb:	0f b6 c0             	movzbl %al,%eax
+  8005fe:	48 b9 a0 35 80 00 00 	movabs $0x8035a0,%rcx
+  800605:	00 00 00 
+  800608:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80060b:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80060e:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800612:	eb cf                	jmp    8005e3 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800614:	49 89 dc             	mov    %rbx,%r12
+  800617:	be 01 00 00 00       	mov    $0x1,%esi
+  80061c:	eb c5                	jmp    8005e3 <vprintfmt+0x75>
+            padc = ch;
+  80061e:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800622:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800625:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800628:	eb b9                	jmp    8005e3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80062a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80062d:	83 f8 2f             	cmp    $0x2f,%eax
+  800630:	77 24                	ja     800656 <vprintfmt+0xe8>
+  800632:	89 c1                	mov    %eax,%ecx
+  800634:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800638:	83 c0 08             	add    $0x8,%eax
+  80063b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80063e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800641:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800644:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800648:	79 99                	jns    8005e3 <vprintfmt+0x75>
+                width = precision;
+  80064a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80064e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800654:	eb 8d                	jmp    8005e3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800656:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80065a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80065e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800662:	eb da                	jmp    80063e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800664:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800669:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80066d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800673:	3c 39                	cmp    $0x39,%al
+  800675:	77 1c                	ja     800693 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800677:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80067b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80067f:	0f b6 c0             	movzbl %al,%eax
+  800682:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800687:	0f b6 03             	movzbl (%rbx),%eax
+  80068a:	3c 39                	cmp    $0x39,%al
+  80068c:	76 e9                	jbe    800677 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80068e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800691:	eb b1                	jmp    800644 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800693:	49 89 dc             	mov    %rbx,%r12
+  800696:	eb ac                	jmp    800644 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800698:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80069b:	85 c9                	test   %ecx,%ecx
+  80069d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a2:	0f 49 c1             	cmovns %ecx,%eax
+  8006a5:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8006a8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006ab:	e9 33 ff ff ff       	jmp    8005e3 <vprintfmt+0x75>
+            lflag++;
+  8006b0:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8006b3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006b6:	e9 28 ff ff ff       	jmp    8005e3 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006be:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c1:	77 19                	ja     8006dc <vprintfmt+0x16e>
+  8006c3:	89 c2                	mov    %eax,%edx
+  8006c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c9:	83 c0 08             	add    $0x8,%eax
+  8006cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006cf:	8b 3a                	mov    (%rdx),%edi
+  8006d1:	4c 89 ee             	mov    %r13,%rsi
+  8006d4:	41 ff d6             	call   *%r14
+            break;
+  8006d7:	e9 c3 fe ff ff       	jmp    80059f <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e8:	eb e5                	jmp    8006cf <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f0:	77 5a                	ja     80074c <vprintfmt+0x1de>
+  8006f2:	89 c2                	mov    %eax,%edx
+  8006f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f8:	83 c0 08             	add    $0x8,%eax
+  8006fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006fe:	8b 02                	mov    (%rdx),%eax
+  800700:	89 c1                	mov    %eax,%ecx
+  800702:	f7 d9                	neg    %ecx
+  800704:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800707:	83 f9 15             	cmp    $0x15,%ecx
+  80070a:	7f 4e                	jg     80075a <vprintfmt+0x1ec>
+  80070c:	48 63 c1             	movslq %ecx,%rax
+  80070f:	48 ba 60 38 80 00 00 	movabs $0x803860,%rdx
+  800716:	00 00 00 
+  800719:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80071d:	48 85 c0             	test   %rax,%rax
+  800720:	74 38                	je     80075a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800722:	48 89 c1             	mov    %rax,%rcx
+  800725:	48 ba 6b 33 80 00 00 	movabs $0x80336b,%rdx
+  80072c:	00 00 00 
+  80072f:	4c 89 ee             	mov    %r13,%rsi
+  800732:	4c 89 f7             	mov    %r14,%rdi
+  800735:	b8 00 00 00 00       	mov    $0x0,%eax
+  80073a:	49 b8 31 05 80 00 00 	movabs $0x800531,%r8
+  800741:	00 00 00 
+  800744:	41 ff d0             	call   *%r8
+  800747:	e9 53 fe ff ff       	jmp    80059f <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80074c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800750:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800754:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800758:	eb a4                	jmp    8006fe <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80075a:	48 ba 04 34 80 00 00 	movabs $0x803404,%rdx
+  800761:	00 00 00 
+  800764:	4c 89 ee             	mov    %r13,%rsi
+  800767:	4c 89 f7             	mov    %r14,%rdi
+  80076a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076f:	49 b8 31 05 80 00 00 	movabs $0x800531,%r8
+  800776:	00 00 00 
+  800779:	41 ff d0             	call   *%r8
+  80077c:	e9 1e fe ff ff       	jmp    80059f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800781:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800784:	83 f8 2f             	cmp    $0x2f,%eax
+  800787:	77 6c                	ja     8007f5 <vprintfmt+0x287>
+  800789:	89 c2                	mov    %eax,%edx
+  80078b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80078f:	83 c0 08             	add    $0x8,%eax
+  800792:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800795:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800798:	48 85 d2             	test   %rdx,%rdx
+  80079b:	48 b8 fd 33 80 00 00 	movabs $0x8033fd,%rax
+  8007a2:	00 00 00 
+  8007a5:	48 0f 45 c2          	cmovne %rdx,%rax
+  8007a9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8007ad:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007b1:	7e 06                	jle    8007b9 <vprintfmt+0x24b>
+  8007b3:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007b7:	75 4a                	jne    800803 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007b9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007bd:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8007c1:	0f b6 00             	movzbl (%rax),%eax
+  8007c4:	84 c0                	test   %al,%al
+  8007c6:	0f 85 9a 00 00 00    	jne    800866 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8007cc:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007cf:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007d3:	85 c0                	test   %eax,%eax
+  8007d5:	0f 8e c4 fd ff ff    	jle    80059f <vprintfmt+0x31>
+  8007db:	4c 89 ee             	mov    %r13,%rsi
+  8007de:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007e3:	41 ff d6             	call   *%r14
+  8007e6:	41 83 ec 01          	sub    $0x1,%r12d
+  8007ea:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007ee:	75 eb                	jne    8007db <vprintfmt+0x26d>
+  8007f0:	e9 aa fd ff ff       	jmp    80059f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800801:	eb 92                	jmp    800795 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800803:	49 63 f7             	movslq %r15d,%rsi
+  800806:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80080a:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  800811:	00 00 00 
+  800814:	ff d0                	call   *%rax
+  800816:	48 89 c2             	mov    %rax,%rdx
+  800819:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80081c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80081e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800821:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800824:	85 c0                	test   %eax,%eax
+  800826:	7e 91                	jle    8007b9 <vprintfmt+0x24b>
+  800828:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80082d:	4c 89 ee             	mov    %r13,%rsi
+  800830:	44 89 e7             	mov    %r12d,%edi
+  800833:	41 ff d6             	call   *%r14
+  800836:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80083a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80083d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800840:	75 eb                	jne    80082d <vprintfmt+0x2bf>
+  800842:	e9 72 ff ff ff       	jmp    8007b9 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800847:	0f b6 f8             	movzbl %al,%edi
+  80084a:	4c 89 ee             	mov    %r13,%rsi
+  80084d:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800850:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800854:	49 83 c4 01          	add    $0x1,%r12
+  800858:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80085e:	84 c0                	test   %al,%al
+  800860:	0f 84 66 ff ff ff    	je     8007cc <vprintfmt+0x25e>
+  800866:	45 85 ff             	test   %r15d,%r15d
+  800869:	78 0a                	js     800875 <vprintfmt+0x307>
+  80086b:	41 83 ef 01          	sub    $0x1,%r15d
+  80086f:	0f 88 57 ff ff ff    	js     8007cc <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800875:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800879:	74 cc                	je     800847 <vprintfmt+0x2d9>
+  80087b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80087e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800883:	80 fa 5e             	cmp    $0x5e,%dl
+  800886:	77 c2                	ja     80084a <vprintfmt+0x2dc>
+  800888:	eb bd                	jmp    800847 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80088a:	40 84 f6             	test   %sil,%sil
+  80088d:	75 26                	jne    8008b5 <vprintfmt+0x347>
+    switch (lflag) {
+  80088f:	85 d2                	test   %edx,%edx
+  800891:	74 59                	je     8008ec <vprintfmt+0x37e>
+  800893:	83 fa 01             	cmp    $0x1,%edx
+  800896:	74 7b                	je     800913 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800898:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089b:	83 f8 2f             	cmp    $0x2f,%eax
+  80089e:	0f 87 96 00 00 00    	ja     80093a <vprintfmt+0x3cc>
+  8008a4:	89 c2                	mov    %eax,%edx
+  8008a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008aa:	83 c0 08             	add    $0x8,%eax
+  8008ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b0:	4c 8b 22             	mov    (%rdx),%r12
+  8008b3:	eb 17                	jmp    8008cc <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8008b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8008bb:	77 21                	ja     8008de <vprintfmt+0x370>
+  8008bd:	89 c2                	mov    %eax,%edx
+  8008bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c3:	83 c0 08             	add    $0x8,%eax
+  8008c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c9:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8008cc:	4d 85 e4             	test   %r12,%r12
+  8008cf:	78 7a                	js     80094b <vprintfmt+0x3dd>
+            num = i;
+  8008d1:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8008d4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8008d9:	e9 50 02 00 00       	jmp    800b2e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ea:	eb dd                	jmp    8008c9 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8008ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f2:	77 11                	ja     800905 <vprintfmt+0x397>
+  8008f4:	89 c2                	mov    %eax,%edx
+  8008f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008fa:	83 c0 08             	add    $0x8,%eax
+  8008fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800900:	4c 63 22             	movslq (%rdx),%r12
+  800903:	eb c7                	jmp    8008cc <vprintfmt+0x35e>
+  800905:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800909:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80090d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800911:	eb ed                	jmp    800900 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800913:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800916:	83 f8 2f             	cmp    $0x2f,%eax
+  800919:	77 11                	ja     80092c <vprintfmt+0x3be>
+  80091b:	89 c2                	mov    %eax,%edx
+  80091d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800921:	83 c0 08             	add    $0x8,%eax
+  800924:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800927:	4c 8b 22             	mov    (%rdx),%r12
+  80092a:	eb a0                	jmp    8008cc <vprintfmt+0x35e>
+  80092c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800930:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800934:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800938:	eb ed                	jmp    800927 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80093a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80093e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800942:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800946:	e9 65 ff ff ff       	jmp    8008b0 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80094b:	4c 89 ee             	mov    %r13,%rsi
+  80094e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800953:	41 ff d6             	call   *%r14
+                i = -i;
+  800956:	49 f7 dc             	neg    %r12
+  800959:	e9 73 ff ff ff       	jmp    8008d1 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80095e:	40 84 f6             	test   %sil,%sil
+  800961:	75 32                	jne    800995 <vprintfmt+0x427>
+    switch (lflag) {
+  800963:	85 d2                	test   %edx,%edx
+  800965:	74 5d                	je     8009c4 <vprintfmt+0x456>
+  800967:	83 fa 01             	cmp    $0x1,%edx
+  80096a:	0f 84 82 00 00 00    	je     8009f2 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800970:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800973:	83 f8 2f             	cmp    $0x2f,%eax
+  800976:	0f 87 a5 00 00 00    	ja     800a21 <vprintfmt+0x4b3>
+  80097c:	89 c2                	mov    %eax,%edx
+  80097e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800982:	83 c0 08             	add    $0x8,%eax
+  800985:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800988:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80098b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800990:	e9 99 01 00 00       	jmp    800b2e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800995:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800998:	83 f8 2f             	cmp    $0x2f,%eax
+  80099b:	77 19                	ja     8009b6 <vprintfmt+0x448>
+  80099d:	89 c2                	mov    %eax,%edx
+  80099f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a3:	83 c0 08             	add    $0x8,%eax
+  8009a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009ac:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009b1:	e9 78 01 00 00       	jmp    800b2e <vprintfmt+0x5c0>
+  8009b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c2:	eb e5                	jmp    8009a9 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8009c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ca:	77 18                	ja     8009e4 <vprintfmt+0x476>
+  8009cc:	89 c2                	mov    %eax,%edx
+  8009ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d2:	83 c0 08             	add    $0x8,%eax
+  8009d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d8:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8009da:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8009df:	e9 4a 01 00 00       	jmp    800b2e <vprintfmt+0x5c0>
+  8009e4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f0:	eb e6                	jmp    8009d8 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8009f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f8:	77 19                	ja     800a13 <vprintfmt+0x4a5>
+  8009fa:	89 c2                	mov    %eax,%edx
+  8009fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a00:	83 c0 08             	add    $0x8,%eax
+  800a03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a06:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a09:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a0e:	e9 1b 01 00 00       	jmp    800b2e <vprintfmt+0x5c0>
+  800a13:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a17:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1f:	eb e5                	jmp    800a06 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2d:	e9 56 ff ff ff       	jmp    800988 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a32:	40 84 f6             	test   %sil,%sil
+  800a35:	75 2e                	jne    800a65 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a37:	85 d2                	test   %edx,%edx
+  800a39:	74 59                	je     800a94 <vprintfmt+0x526>
+  800a3b:	83 fa 01             	cmp    $0x1,%edx
+  800a3e:	74 7f                	je     800abf <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a43:	83 f8 2f             	cmp    $0x2f,%eax
+  800a46:	0f 87 9f 00 00 00    	ja     800aeb <vprintfmt+0x57d>
+  800a4c:	89 c2                	mov    %eax,%edx
+  800a4e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a52:	83 c0 08             	add    $0x8,%eax
+  800a55:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a58:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a5b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a60:	e9 c9 00 00 00       	jmp    800b2e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a68:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6b:	77 19                	ja     800a86 <vprintfmt+0x518>
+  800a6d:	89 c2                	mov    %eax,%edx
+  800a6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a73:	83 c0 08             	add    $0x8,%eax
+  800a76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a79:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a7c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a81:	e9 a8 00 00 00       	jmp    800b2e <vprintfmt+0x5c0>
+  800a86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a92:	eb e5                	jmp    800a79 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a97:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9a:	77 15                	ja     800ab1 <vprintfmt+0x543>
+  800a9c:	89 c2                	mov    %eax,%edx
+  800a9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa2:	83 c0 08             	add    $0x8,%eax
+  800aa5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa8:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800aaa:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800aaf:	eb 7d                	jmp    800b2e <vprintfmt+0x5c0>
+  800ab1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abd:	eb e9                	jmp    800aa8 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800abf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac5:	77 16                	ja     800add <vprintfmt+0x56f>
+  800ac7:	89 c2                	mov    %eax,%edx
+  800ac9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800acd:	83 c0 08             	add    $0x8,%eax
+  800ad0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ad6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800adb:	eb 51                	jmp    800b2e <vprintfmt+0x5c0>
+  800add:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae9:	eb e8                	jmp    800ad3 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800aeb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af7:	e9 5c ff ff ff       	jmp    800a58 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800afc:	4c 89 ee             	mov    %r13,%rsi
+  800aff:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b04:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b07:	4c 89 ee             	mov    %r13,%rsi
+  800b0a:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b0f:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b15:	83 f8 2f             	cmp    $0x2f,%eax
+  800b18:	77 47                	ja     800b61 <vprintfmt+0x5f3>
+  800b1a:	89 c2                	mov    %eax,%edx
+  800b1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b20:	83 c0 08             	add    $0x8,%eax
+  800b23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b26:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b29:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b2e:	48 83 ec 08          	sub    $0x8,%rsp
+  800b32:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b36:	0f 94 c0             	sete   %al
+  800b39:	0f b6 c0             	movzbl %al,%eax
+  800b3c:	50                   	push   %rax
+  800b3d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b42:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b46:	4c 89 ee             	mov    %r13,%rsi
+  800b49:	4c 89 f7             	mov    %r14,%rdi
+  800b4c:	48 b8 63 04 80 00 00 	movabs $0x800463,%rax
+  800b53:	00 00 00 
+  800b56:	ff d0                	call   *%rax
+            break;
+  800b58:	48 83 c4 10          	add    $0x10,%rsp
+  800b5c:	e9 3e fa ff ff       	jmp    80059f <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6d:	eb b7                	jmp    800b26 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b6f:	40 84 f6             	test   %sil,%sil
+  800b72:	75 2b                	jne    800b9f <vprintfmt+0x631>
+    switch (lflag) {
+  800b74:	85 d2                	test   %edx,%edx
+  800b76:	74 56                	je     800bce <vprintfmt+0x660>
+  800b78:	83 fa 01             	cmp    $0x1,%edx
+  800b7b:	74 7f                	je     800bfc <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b7d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b80:	83 f8 2f             	cmp    $0x2f,%eax
+  800b83:	0f 87 a2 00 00 00    	ja     800c2b <vprintfmt+0x6bd>
+  800b89:	89 c2                	mov    %eax,%edx
+  800b8b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b8f:	83 c0 08             	add    $0x8,%eax
+  800b92:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b95:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b98:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b9d:	eb 8f                	jmp    800b2e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b9f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba5:	77 19                	ja     800bc0 <vprintfmt+0x652>
+  800ba7:	89 c2                	mov    %eax,%edx
+  800ba9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bad:	83 c0 08             	add    $0x8,%eax
+  800bb0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bb6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bbb:	e9 6e ff ff ff       	jmp    800b2e <vprintfmt+0x5c0>
+  800bc0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bcc:	eb e5                	jmp    800bb3 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800bce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bd1:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd4:	77 18                	ja     800bee <vprintfmt+0x680>
+  800bd6:	89 c2                	mov    %eax,%edx
+  800bd8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bdc:	83 c0 08             	add    $0x8,%eax
+  800bdf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800be2:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800be4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800be9:	e9 40 ff ff ff       	jmp    800b2e <vprintfmt+0x5c0>
+  800bee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bfa:	eb e6                	jmp    800be2 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800bfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bff:	83 f8 2f             	cmp    $0x2f,%eax
+  800c02:	77 19                	ja     800c1d <vprintfmt+0x6af>
+  800c04:	89 c2                	mov    %eax,%edx
+  800c06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0a:	83 c0 08             	add    $0x8,%eax
+  800c0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c10:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c13:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c18:	e9 11 ff ff ff       	jmp    800b2e <vprintfmt+0x5c0>
+  800c1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c21:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c29:	eb e5                	jmp    800c10 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c37:	e9 59 ff ff ff       	jmp    800b95 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c3c:	4c 89 ee             	mov    %r13,%rsi
+  800c3f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c44:	41 ff d6             	call   *%r14
+            break;
+  800c47:	e9 53 f9 ff ff       	jmp    80059f <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c4c:	4c 89 ee             	mov    %r13,%rsi
+  800c4f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c54:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c57:	48 83 eb 01          	sub    $0x1,%rbx
+  800c5b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c5f:	75 f6                	jne    800c57 <vprintfmt+0x6e9>
+  800c61:	e9 39 f9 ff ff       	jmp    80059f <vprintfmt+0x31>
+}
+  800c66:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c6a:	5b                   	pop    %rbx
+  800c6b:	41 5c                	pop    %r12
+  800c6d:	41 5d                	pop    %r13
+  800c6f:	41 5e                	pop    %r14
+  800c71:	41 5f                	pop    %r15
+  800c73:	5d                   	pop    %rbp
+  800c74:	c3                   	ret
+
+0000000000800c75 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c75:	55                   	push   %rbp
+  800c76:	48 89 e5             	mov    %rsp,%rbp
+  800c79:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c7d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c81:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c86:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c8a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c91:	48 85 ff             	test   %rdi,%rdi
+  800c94:	74 2b                	je     800cc1 <vsnprintf+0x4c>
+  800c96:	48 85 f6             	test   %rsi,%rsi
+  800c99:	74 26                	je     800cc1 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c9b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c9f:	48 bf 19 05 80 00 00 	movabs $0x800519,%rdi
+  800ca6:	00 00 00 
+  800ca9:	48 b8 6e 05 80 00 00 	movabs $0x80056e,%rax
+  800cb0:	00 00 00 
+  800cb3:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800cb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cb9:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800cbc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800cbf:	c9                   	leave
+  800cc0:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800cc1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cc6:	eb f7                	jmp    800cbf <vsnprintf+0x4a>
+
+0000000000800cc8 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800cc8:	55                   	push   %rbp
+  800cc9:	48 89 e5             	mov    %rsp,%rbp
+  800ccc:	48 83 ec 50          	sub    $0x50,%rsp
+  800cd0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800cd4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800cd8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800cdc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ce3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ce7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ceb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cef:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800cf3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800cf7:	48 b8 75 0c 80 00 00 	movabs $0x800c75,%rax
+  800cfe:	00 00 00 
+  800d01:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d03:	c9                   	leave
+  800d04:	c3                   	ret
+
+0000000000800d05 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d05:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d08:	74 10                	je     800d1a <strlen+0x15>
+    size_t n = 0;
+  800d0a:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d0f:	48 83 c0 01          	add    $0x1,%rax
+  800d13:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d17:	75 f6                	jne    800d0f <strlen+0xa>
+  800d19:	c3                   	ret
+    size_t n = 0;
+  800d1a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d1f:	c3                   	ret
+
+0000000000800d20 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d20:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d23:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d28:	48 85 f6             	test   %rsi,%rsi
+  800d2b:	74 11                	je     800d3e <strnlen+0x1e>
+  800d2d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d31:	74 0c                	je     800d3f <strnlen+0x1f>
+  800d33:	48 83 c2 01          	add    $0x1,%rdx
+  800d37:	48 39 d0             	cmp    %rdx,%rax
+  800d3a:	75 f1                	jne    800d2d <strnlen+0xd>
+  800d3c:	eb 04                	jmp    800d42 <strnlen+0x22>
+  800d3e:	c3                   	ret
+  800d3f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d42:	c3                   	ret
+
+0000000000800d43 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d43:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d46:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d4f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d52:	48 83 c2 01          	add    $0x1,%rdx
+  800d56:	84 c9                	test   %cl,%cl
+  800d58:	75 f1                	jne    800d4b <strcpy+0x8>
+        ;
+    return res;
+}
+  800d5a:	c3                   	ret
+
+0000000000800d5b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d5b:	55                   	push   %rbp
+  800d5c:	48 89 e5             	mov    %rsp,%rbp
+  800d5f:	41 54                	push   %r12
+  800d61:	53                   	push   %rbx
+  800d62:	48 89 fb             	mov    %rdi,%rbx
+  800d65:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d68:	48 b8 05 0d 80 00 00 	movabs $0x800d05,%rax
+  800d6f:	00 00 00 
+  800d72:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d74:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d78:	4c 89 e6             	mov    %r12,%rsi
+  800d7b:	48 b8 43 0d 80 00 00 	movabs $0x800d43,%rax
+  800d82:	00 00 00 
+  800d85:	ff d0                	call   *%rax
+    return dst;
+}
+  800d87:	48 89 d8             	mov    %rbx,%rax
+  800d8a:	5b                   	pop    %rbx
+  800d8b:	41 5c                	pop    %r12
+  800d8d:	5d                   	pop    %rbp
+  800d8e:	c3                   	ret
+
+0000000000800d8f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d8f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d92:	48 85 d2             	test   %rdx,%rdx
+  800d95:	74 1f                	je     800db6 <strncpy+0x27>
+  800d97:	48 01 fa             	add    %rdi,%rdx
+  800d9a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d9d:	48 83 c1 01          	add    $0x1,%rcx
+  800da1:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800da5:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800da9:	41 80 f8 01          	cmp    $0x1,%r8b
+  800dad:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800db1:	48 39 ca             	cmp    %rcx,%rdx
+  800db4:	75 e7                	jne    800d9d <strncpy+0xe>
+    }
+    return ret;
+}
+  800db6:	c3                   	ret
+
+0000000000800db7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800db7:	48 89 f8             	mov    %rdi,%rax
+  800dba:	48 85 d2             	test   %rdx,%rdx
+  800dbd:	74 24                	je     800de3 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800dbf:	48 83 ea 01          	sub    $0x1,%rdx
+  800dc3:	74 1b                	je     800de0 <strlcpy+0x29>
+  800dc5:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800dc9:	0f b6 16             	movzbl (%rsi),%edx
+  800dcc:	84 d2                	test   %dl,%dl
+  800dce:	74 10                	je     800de0 <strlcpy+0x29>
+            *dst++ = *src++;
+  800dd0:	48 83 c6 01          	add    $0x1,%rsi
+  800dd4:	48 83 c0 01          	add    $0x1,%rax
+  800dd8:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ddb:	48 39 c8             	cmp    %rcx,%rax
+  800dde:	75 e9                	jne    800dc9 <strlcpy+0x12>
+        *dst = '\0';
+  800de0:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800de3:	48 29 f8             	sub    %rdi,%rax
+}
+  800de6:	c3                   	ret
+
+0000000000800de7 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800de7:	0f b6 07             	movzbl (%rdi),%eax
+  800dea:	84 c0                	test   %al,%al
+  800dec:	74 13                	je     800e01 <strcmp+0x1a>
+  800dee:	38 06                	cmp    %al,(%rsi)
+  800df0:	75 0f                	jne    800e01 <strcmp+0x1a>
+  800df2:	48 83 c7 01          	add    $0x1,%rdi
+  800df6:	48 83 c6 01          	add    $0x1,%rsi
+  800dfa:	0f b6 07             	movzbl (%rdi),%eax
+  800dfd:	84 c0                	test   %al,%al
+  800dff:	75 ed                	jne    800dee <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e01:	0f b6 c0             	movzbl %al,%eax
+  800e04:	0f b6 16             	movzbl (%rsi),%edx
+  800e07:	29 d0                	sub    %edx,%eax
+}
+  800e09:	c3                   	ret
+
+0000000000800e0a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e0a:	48 85 d2             	test   %rdx,%rdx
+  800e0d:	74 1f                	je     800e2e <strncmp+0x24>
+  800e0f:	0f b6 07             	movzbl (%rdi),%eax
+  800e12:	84 c0                	test   %al,%al
+  800e14:	74 1e                	je     800e34 <strncmp+0x2a>
+  800e16:	3a 06                	cmp    (%rsi),%al
+  800e18:	75 1a                	jne    800e34 <strncmp+0x2a>
+  800e1a:	48 83 c7 01          	add    $0x1,%rdi
+  800e1e:	48 83 c6 01          	add    $0x1,%rsi
+  800e22:	48 83 ea 01          	sub    $0x1,%rdx
+  800e26:	75 e7                	jne    800e0f <strncmp+0x5>
+
+    if (!n) return 0;
+  800e28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2d:	c3                   	ret
+  800e2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e33:	c3                   	ret
+  800e34:	48 85 d2             	test   %rdx,%rdx
+  800e37:	74 09                	je     800e42 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e39:	0f b6 07             	movzbl (%rdi),%eax
+  800e3c:	0f b6 16             	movzbl (%rsi),%edx
+  800e3f:	29 d0                	sub    %edx,%eax
+  800e41:	c3                   	ret
+    if (!n) return 0;
+  800e42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e47:	c3                   	ret
+
+0000000000800e48 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e48:	0f b6 17             	movzbl (%rdi),%edx
+  800e4b:	84 d2                	test   %dl,%dl
+  800e4d:	74 18                	je     800e67 <strchr+0x1f>
+        if (*str == c) {
+  800e4f:	0f be d2             	movsbl %dl,%edx
+  800e52:	39 f2                	cmp    %esi,%edx
+  800e54:	74 17                	je     800e6d <strchr+0x25>
+    for (; *str; str++) {
+  800e56:	48 83 c7 01          	add    $0x1,%rdi
+  800e5a:	0f b6 17             	movzbl (%rdi),%edx
+  800e5d:	84 d2                	test   %dl,%dl
+  800e5f:	75 ee                	jne    800e4f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e66:	c3                   	ret
+  800e67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e6c:	c3                   	ret
+  800e6d:	48 89 f8             	mov    %rdi,%rax
+}
+  800e70:	c3                   	ret
+
+0000000000800e71 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e71:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e74:	0f b6 17             	movzbl (%rdi),%edx
+  800e77:	84 d2                	test   %dl,%dl
+  800e79:	74 13                	je     800e8e <strfind+0x1d>
+  800e7b:	0f be d2             	movsbl %dl,%edx
+  800e7e:	39 f2                	cmp    %esi,%edx
+  800e80:	74 0b                	je     800e8d <strfind+0x1c>
+  800e82:	48 83 c0 01          	add    $0x1,%rax
+  800e86:	0f b6 10             	movzbl (%rax),%edx
+  800e89:	84 d2                	test   %dl,%dl
+  800e8b:	75 ee                	jne    800e7b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e8d:	c3                   	ret
+  800e8e:	c3                   	ret
+
+0000000000800e8f <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e8f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e92:	48 89 f8             	mov    %rdi,%rax
+  800e95:	48 f7 d8             	neg    %rax
+  800e98:	83 e0 07             	and    $0x7,%eax
+  800e9b:	49 89 d1             	mov    %rdx,%r9
+  800e9e:	49 29 c1             	sub    %rax,%r9
+  800ea1:	78 36                	js     800ed9 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ea3:	40 0f b6 c6          	movzbl %sil,%eax
+  800ea7:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800eae:	01 01 01 
+  800eb1:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800eb5:	40 f6 c7 07          	test   $0x7,%dil
+  800eb9:	75 38                	jne    800ef3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ebb:	4c 89 c9             	mov    %r9,%rcx
+  800ebe:	48 c1 f9 03          	sar    $0x3,%rcx
+  800ec2:	74 0c                	je     800ed0 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800ec4:	fc                   	cld
+  800ec5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800ec8:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800ecc:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ed0:	4d 85 c9             	test   %r9,%r9
+  800ed3:	75 45                	jne    800f1a <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ed5:	4c 89 c0             	mov    %r8,%rax
+  800ed8:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ed9:	48 85 d2             	test   %rdx,%rdx
+  800edc:	74 f7                	je     800ed5 <memset+0x46>
+  800ede:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ee1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ee4:	48 83 c0 01          	add    $0x1,%rax
+  800ee8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800eec:	48 39 c2             	cmp    %rax,%rdx
+  800eef:	75 f3                	jne    800ee4 <memset+0x55>
+  800ef1:	eb e2                	jmp    800ed5 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ef3:	40 f6 c7 01          	test   $0x1,%dil
+  800ef7:	74 06                	je     800eff <memset+0x70>
+  800ef9:	88 07                	mov    %al,(%rdi)
+  800efb:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800eff:	40 f6 c7 02          	test   $0x2,%dil
+  800f03:	74 07                	je     800f0c <memset+0x7d>
+  800f05:	66 89 07             	mov    %ax,(%rdi)
+  800f08:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f0c:	40 f6 c7 04          	test   $0x4,%dil
+  800f10:	74 a9                	je     800ebb <memset+0x2c>
+  800f12:	89 07                	mov    %eax,(%rdi)
+  800f14:	48 83 c7 04          	add    $0x4,%rdi
+  800f18:	eb a1                	jmp    800ebb <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f1a:	41 f6 c1 04          	test   $0x4,%r9b
+  800f1e:	74 06                	je     800f26 <memset+0x97>
+  800f20:	89 07                	mov    %eax,(%rdi)
+  800f22:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f26:	41 f6 c1 02          	test   $0x2,%r9b
+  800f2a:	74 07                	je     800f33 <memset+0xa4>
+  800f2c:	66 89 07             	mov    %ax,(%rdi)
+  800f2f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f33:	41 f6 c1 01          	test   $0x1,%r9b
+  800f37:	74 9c                	je     800ed5 <memset+0x46>
+  800f39:	88 07                	mov    %al,(%rdi)
+  800f3b:	eb 98                	jmp    800ed5 <memset+0x46>
+
+0000000000800f3d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f3d:	48 89 f8             	mov    %rdi,%rax
+  800f40:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f43:	48 39 fe             	cmp    %rdi,%rsi
+  800f46:	73 3b                	jae    800f83 <memmove+0x46>
+  800f48:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f4c:	48 39 d7             	cmp    %rdx,%rdi
+  800f4f:	73 32                	jae    800f83 <memmove+0x46>
+        s += n;
+        d += n;
+  800f51:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f55:	48 89 d6             	mov    %rdx,%rsi
+  800f58:	48 09 fe             	or     %rdi,%rsi
+  800f5b:	48 09 ce             	or     %rcx,%rsi
+  800f5e:	40 f6 c6 07          	test   $0x7,%sil
+  800f62:	75 12                	jne    800f76 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f64:	48 83 ef 08          	sub    $0x8,%rdi
+  800f68:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f6c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f70:	fd                   	std
+  800f71:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f74:	fc                   	cld
+  800f75:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f76:	48 83 ef 01          	sub    $0x1,%rdi
+  800f7a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f7e:	fd                   	std
+  800f7f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f81:	eb f1                	jmp    800f74 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f83:	48 89 f2             	mov    %rsi,%rdx
+  800f86:	48 09 c2             	or     %rax,%rdx
+  800f89:	48 09 ca             	or     %rcx,%rdx
+  800f8c:	f6 c2 07             	test   $0x7,%dl
+  800f8f:	75 0c                	jne    800f9d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f91:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f95:	48 89 c7             	mov    %rax,%rdi
+  800f98:	fc                   	cld
+  800f99:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f9c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f9d:	48 89 c7             	mov    %rax,%rdi
+  800fa0:	fc                   	cld
+  800fa1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800fa3:	c3                   	ret
+
+0000000000800fa4 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800fa4:	55                   	push   %rbp
+  800fa5:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800fa8:	48 b8 3d 0f 80 00 00 	movabs $0x800f3d,%rax
+  800faf:	00 00 00 
+  800fb2:	ff d0                	call   *%rax
+}
+  800fb4:	5d                   	pop    %rbp
+  800fb5:	c3                   	ret
+
+0000000000800fb6 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800fb6:	55                   	push   %rbp
+  800fb7:	48 89 e5             	mov    %rsp,%rbp
+  800fba:	41 57                	push   %r15
+  800fbc:	41 56                	push   %r14
+  800fbe:	41 55                	push   %r13
+  800fc0:	41 54                	push   %r12
+  800fc2:	53                   	push   %rbx
+  800fc3:	48 83 ec 08          	sub    $0x8,%rsp
+  800fc7:	49 89 fe             	mov    %rdi,%r14
+  800fca:	49 89 f7             	mov    %rsi,%r15
+  800fcd:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800fd0:	48 89 f7             	mov    %rsi,%rdi
+  800fd3:	48 b8 05 0d 80 00 00 	movabs $0x800d05,%rax
+  800fda:	00 00 00 
+  800fdd:	ff d0                	call   *%rax
+  800fdf:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800fe2:	48 89 de             	mov    %rbx,%rsi
+  800fe5:	4c 89 f7             	mov    %r14,%rdi
+  800fe8:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  800fef:	00 00 00 
+  800ff2:	ff d0                	call   *%rax
+  800ff4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ff7:	48 39 c3             	cmp    %rax,%rbx
+  800ffa:	74 36                	je     801032 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800ffc:	48 89 d8             	mov    %rbx,%rax
+  800fff:	4c 29 e8             	sub    %r13,%rax
+  801002:	49 39 c4             	cmp    %rax,%r12
+  801005:	73 31                	jae    801038 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801007:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80100c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801010:	4c 89 fe             	mov    %r15,%rsi
+  801013:	48 b8 a4 0f 80 00 00 	movabs $0x800fa4,%rax
+  80101a:	00 00 00 
+  80101d:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80101f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801023:	48 83 c4 08          	add    $0x8,%rsp
+  801027:	5b                   	pop    %rbx
+  801028:	41 5c                	pop    %r12
+  80102a:	41 5d                	pop    %r13
+  80102c:	41 5e                	pop    %r14
+  80102e:	41 5f                	pop    %r15
+  801030:	5d                   	pop    %rbp
+  801031:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801032:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801036:	eb eb                	jmp    801023 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801038:	48 83 eb 01          	sub    $0x1,%rbx
+  80103c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801040:	48 89 da             	mov    %rbx,%rdx
+  801043:	4c 89 fe             	mov    %r15,%rsi
+  801046:	48 b8 a4 0f 80 00 00 	movabs $0x800fa4,%rax
+  80104d:	00 00 00 
+  801050:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801052:	49 01 de             	add    %rbx,%r14
+  801055:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80105a:	eb c3                	jmp    80101f <strlcat+0x69>
+
+000000000080105c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80105c:	48 85 d2             	test   %rdx,%rdx
+  80105f:	74 2d                	je     80108e <memcmp+0x32>
+  801061:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801066:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80106a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80106f:	44 38 c1             	cmp    %r8b,%cl
+  801072:	75 0f                	jne    801083 <memcmp+0x27>
+    while (n-- > 0) {
+  801074:	48 83 c0 01          	add    $0x1,%rax
+  801078:	48 39 c2             	cmp    %rax,%rdx
+  80107b:	75 e9                	jne    801066 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80107d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801082:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801083:	0f b6 c1             	movzbl %cl,%eax
+  801086:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80108a:	44 29 c0             	sub    %r8d,%eax
+  80108d:	c3                   	ret
+    return 0;
+  80108e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801093:	c3                   	ret
+
+0000000000801094 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801094:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801098:	48 39 c7             	cmp    %rax,%rdi
+  80109b:	73 0f                	jae    8010ac <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80109d:	40 38 37             	cmp    %sil,(%rdi)
+  8010a0:	74 0e                	je     8010b0 <memfind+0x1c>
+    for (; src < end; src++) {
+  8010a2:	48 83 c7 01          	add    $0x1,%rdi
+  8010a6:	48 39 f8             	cmp    %rdi,%rax
+  8010a9:	75 f2                	jne    80109d <memfind+0x9>
+  8010ab:	c3                   	ret
+  8010ac:	48 89 f8             	mov    %rdi,%rax
+  8010af:	c3                   	ret
+  8010b0:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8010b3:	c3                   	ret
+
+00000000008010b4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8010b4:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010b7:	0f b6 37             	movzbl (%rdi),%esi
+  8010ba:	40 80 fe 20          	cmp    $0x20,%sil
+  8010be:	74 06                	je     8010c6 <strtol+0x12>
+  8010c0:	40 80 fe 09          	cmp    $0x9,%sil
+  8010c4:	75 13                	jne    8010d9 <strtol+0x25>
+  8010c6:	48 83 c7 01          	add    $0x1,%rdi
+  8010ca:	0f b6 37             	movzbl (%rdi),%esi
+  8010cd:	40 80 fe 20          	cmp    $0x20,%sil
+  8010d1:	74 f3                	je     8010c6 <strtol+0x12>
+  8010d3:	40 80 fe 09          	cmp    $0x9,%sil
+  8010d7:	74 ed                	je     8010c6 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8010d9:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8010dc:	83 e0 fd             	and    $0xfffffffd,%eax
+  8010df:	3c 01                	cmp    $0x1,%al
+  8010e1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010e5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010eb:	75 0f                	jne    8010fc <strtol+0x48>
+  8010ed:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010f0:	74 14                	je     801106 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010f2:	85 d2                	test   %edx,%edx
+  8010f4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010f9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010fc:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801101:	4c 63 ca             	movslq %edx,%r9
+  801104:	eb 36                	jmp    80113c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801106:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80110a:	74 0f                	je     80111b <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80110c:	85 d2                	test   %edx,%edx
+  80110e:	75 ec                	jne    8010fc <strtol+0x48>
+        s++;
+  801110:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801114:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801119:	eb e1                	jmp    8010fc <strtol+0x48>
+        s += 2;
+  80111b:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80111f:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801124:	eb d6                	jmp    8010fc <strtol+0x48>
+            dig -= '0';
+  801126:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801129:	44 0f b6 c1          	movzbl %cl,%r8d
+  80112d:	41 39 d0             	cmp    %edx,%r8d
+  801130:	7d 21                	jge    801153 <strtol+0x9f>
+        val = val * base + dig;
+  801132:	49 0f af c1          	imul   %r9,%rax
+  801136:	0f b6 c9             	movzbl %cl,%ecx
+  801139:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80113c:	48 83 c7 01          	add    $0x1,%rdi
+  801140:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801144:	80 f9 39             	cmp    $0x39,%cl
+  801147:	76 dd                	jbe    801126 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801149:	80 f9 7b             	cmp    $0x7b,%cl
+  80114c:	77 05                	ja     801153 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80114e:	83 e9 57             	sub    $0x57,%ecx
+  801151:	eb d6                	jmp    801129 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801153:	4d 85 d2             	test   %r10,%r10
+  801156:	74 03                	je     80115b <strtol+0xa7>
+  801158:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80115b:	48 89 c2             	mov    %rax,%rdx
+  80115e:	48 f7 da             	neg    %rdx
+  801161:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801165:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801169:	c3                   	ret
+
+000000000080116a <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80116a:	55                   	push   %rbp
+  80116b:	48 89 e5             	mov    %rsp,%rbp
+  80116e:	53                   	push   %rbx
+  80116f:	48 89 fa             	mov    %rdi,%rdx
+  801172:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801175:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80117a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801184:	be 00 00 00 00       	mov    $0x0,%esi
+  801189:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80118f:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801191:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801195:	c9                   	leave
+  801196:	c3                   	ret
+
+0000000000801197 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801197:	55                   	push   %rbp
+  801198:	48 89 e5             	mov    %rsp,%rbp
+  80119b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80119c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011c0:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011c6:	c9                   	leave
+  8011c7:	c3                   	ret
+
+00000000008011c8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8011c8:	55                   	push   %rbp
+  8011c9:	48 89 e5             	mov    %rsp,%rbp
+  8011cc:	53                   	push   %rbx
+  8011cd:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8011d1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011d4:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011f5:	48 85 c0             	test   %rax,%rax
+  8011f8:	7f 06                	jg     801200 <sys_env_destroy+0x38>
+}
+  8011fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011fe:	c9                   	leave
+  8011ff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801200:	49 89 c0             	mov    %rax,%r8
+  801203:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801208:	48 ba 30 39 80 00 00 	movabs $0x803930,%rdx
+  80120f:	00 00 00 
+  801212:	be 26 00 00 00       	mov    $0x26,%esi
+  801217:	48 bf 4f 39 80 00 00 	movabs $0x80394f,%rdi
+  80121e:	00 00 00 
+  801221:	b8 00 00 00 00       	mov    $0x0,%eax
+  801226:	49 b9 ce 02 80 00 00 	movabs $0x8002ce,%r9
+  80122d:	00 00 00 
+  801230:	41 ff d1             	call   *%r9
+
+0000000000801233 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801233:	55                   	push   %rbp
+  801234:	48 89 e5             	mov    %rsp,%rbp
+  801237:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801238:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80123d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801242:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801247:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801251:	be 00 00 00 00       	mov    $0x0,%esi
+  801256:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80125c:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80125e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801262:	c9                   	leave
+  801263:	c3                   	ret
+
+0000000000801264 <sys_yield>:
+
+void
+sys_yield(void) {
+  801264:	55                   	push   %rbp
+  801265:	48 89 e5             	mov    %rsp,%rbp
+  801268:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801269:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80126e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801273:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801278:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801282:	be 00 00 00 00       	mov    $0x0,%esi
+  801287:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80128d:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80128f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801293:	c9                   	leave
+  801294:	c3                   	ret
+
+0000000000801295 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801295:	55                   	push   %rbp
+  801296:	48 89 e5             	mov    %rsp,%rbp
+  801299:	53                   	push   %rbx
+  80129a:	48 89 fa             	mov    %rdi,%rdx
+  80129d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012a5:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8012ac:	00 00 00 
+  8012af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012bf:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012c5:	c9                   	leave
+  8012c6:	c3                   	ret
+
+00000000008012c7 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012c7:	55                   	push   %rbp
+  8012c8:	48 89 e5             	mov    %rsp,%rbp
+  8012cb:	53                   	push   %rbx
+  8012cc:	49 89 f8             	mov    %rdi,%r8
+  8012cf:	48 89 d3             	mov    %rdx,%rbx
+  8012d2:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012d5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012da:	4c 89 c2             	mov    %r8,%rdx
+  8012dd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012eb:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f1:	c9                   	leave
+  8012f2:	c3                   	ret
+
+00000000008012f3 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012f3:	55                   	push   %rbp
+  8012f4:	48 89 e5             	mov    %rsp,%rbp
+  8012f7:	53                   	push   %rbx
+  8012f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8012fc:	89 f8                	mov    %edi,%eax
+  8012fe:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801301:	48 63 f9             	movslq %ecx,%rdi
+  801304:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801307:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80130c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80130f:	be 00 00 00 00       	mov    $0x0,%esi
+  801314:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80131a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80131c:	48 85 c0             	test   %rax,%rax
+  80131f:	7f 06                	jg     801327 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801321:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801325:	c9                   	leave
+  801326:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801327:	49 89 c0             	mov    %rax,%r8
+  80132a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80132f:	48 ba 30 39 80 00 00 	movabs $0x803930,%rdx
+  801336:	00 00 00 
+  801339:	be 26 00 00 00       	mov    $0x26,%esi
+  80133e:	48 bf 4f 39 80 00 00 	movabs $0x80394f,%rdi
+  801345:	00 00 00 
+  801348:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134d:	49 b9 ce 02 80 00 00 	movabs $0x8002ce,%r9
+  801354:	00 00 00 
+  801357:	41 ff d1             	call   *%r9
+
+000000000080135a <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80135a:	55                   	push   %rbp
+  80135b:	48 89 e5             	mov    %rsp,%rbp
+  80135e:	53                   	push   %rbx
+  80135f:	48 83 ec 08          	sub    $0x8,%rsp
+  801363:	89 f8                	mov    %edi,%eax
+  801365:	49 89 f2             	mov    %rsi,%r10
+  801368:	48 89 cf             	mov    %rcx,%rdi
+  80136b:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80136e:	48 63 da             	movslq %edx,%rbx
+  801371:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801374:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801379:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80137c:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80137f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801381:	48 85 c0             	test   %rax,%rax
+  801384:	7f 06                	jg     80138c <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801386:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80138a:	c9                   	leave
+  80138b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80138c:	49 89 c0             	mov    %rax,%r8
+  80138f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801394:	48 ba 30 39 80 00 00 	movabs $0x803930,%rdx
+  80139b:	00 00 00 
+  80139e:	be 26 00 00 00       	mov    $0x26,%esi
+  8013a3:	48 bf 4f 39 80 00 00 	movabs $0x80394f,%rdi
+  8013aa:	00 00 00 
+  8013ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b2:	49 b9 ce 02 80 00 00 	movabs $0x8002ce,%r9
+  8013b9:	00 00 00 
+  8013bc:	41 ff d1             	call   *%r9
+
+00000000008013bf <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013bf:	55                   	push   %rbp
+  8013c0:	48 89 e5             	mov    %rsp,%rbp
+  8013c3:	53                   	push   %rbx
+  8013c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8013c8:	48 89 f1             	mov    %rsi,%rcx
+  8013cb:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8013ce:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d1:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013db:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013e8:	48 85 c0             	test   %rax,%rax
+  8013eb:	7f 06                	jg     8013f3 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f1:	c9                   	leave
+  8013f2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013f3:	49 89 c0             	mov    %rax,%r8
+  8013f6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013fb:	48 ba 30 39 80 00 00 	movabs $0x803930,%rdx
+  801402:	00 00 00 
+  801405:	be 26 00 00 00       	mov    $0x26,%esi
+  80140a:	48 bf 4f 39 80 00 00 	movabs $0x80394f,%rdi
+  801411:	00 00 00 
+  801414:	b8 00 00 00 00       	mov    $0x0,%eax
+  801419:	49 b9 ce 02 80 00 00 	movabs $0x8002ce,%r9
+  801420:	00 00 00 
+  801423:	41 ff d1             	call   *%r9
+
+0000000000801426 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801426:	55                   	push   %rbp
+  801427:	48 89 e5             	mov    %rsp,%rbp
+  80142a:	53                   	push   %rbx
+  80142b:	48 83 ec 08          	sub    $0x8,%rsp
+  80142f:	89 f8                	mov    %edi,%eax
+  801431:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801434:	48 63 f9             	movslq %ecx,%rdi
+  801437:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80143a:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80143f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801442:	be 00 00 00 00       	mov    $0x0,%esi
+  801447:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80144d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80144f:	48 85 c0             	test   %rax,%rax
+  801452:	7f 06                	jg     80145a <sys_region_advise+0x34>
+}
+  801454:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801458:	c9                   	leave
+  801459:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80145a:	49 89 c0             	mov    %rax,%r8
+  80145d:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801462:	48 ba 30 39 80 00 00 	movabs $0x803930,%rdx
+  801469:	00 00 00 
+  80146c:	be 26 00 00 00       	mov    $0x26,%esi
+  801471:	48 bf 4f 39 80 00 00 	movabs $0x80394f,%rdi
+  801478:	00 00 00 
+  80147b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801480:	49 b9 ce 02 80 00 00 	movabs $0x8002ce,%r9
+  801487:	00 00 00 
+  80148a:	41 ff d1             	call   *%r9
+
+000000000080148d <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  80148d:	55                   	push   %rbp
+  80148e:	48 89 e5             	mov    %rsp,%rbp
+  801491:	53                   	push   %rbx
+  801492:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801496:	48 63 ce             	movslq %esi,%rcx
+  801499:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80149c:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014b8:	48 85 c0             	test   %rax,%rax
+  8014bb:	7f 06                	jg     8014c3 <sys_env_set_nice+0x36>
+}
+  8014bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c1:	c9                   	leave
+  8014c2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c3:	49 89 c0             	mov    %rax,%r8
+  8014c6:	b9 15 00 00 00       	mov    $0x15,%ecx
+  8014cb:	48 ba 30 39 80 00 00 	movabs $0x803930,%rdx
+  8014d2:	00 00 00 
+  8014d5:	be 26 00 00 00       	mov    $0x26,%esi
+  8014da:	48 bf 4f 39 80 00 00 	movabs $0x80394f,%rdi
+  8014e1:	00 00 00 
+  8014e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e9:	49 b9 ce 02 80 00 00 	movabs $0x8002ce,%r9
+  8014f0:	00 00 00 
+  8014f3:	41 ff d1             	call   *%r9
+
+00000000008014f6 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014f6:	55                   	push   %rbp
+  8014f7:	48 89 e5             	mov    %rsp,%rbp
+  8014fa:	53                   	push   %rbx
+  8014fb:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014ff:	48 63 ce             	movslq %esi,%rcx
+  801502:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801505:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80150a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801514:	be 00 00 00 00       	mov    $0x0,%esi
+  801519:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80151f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801521:	48 85 c0             	test   %rax,%rax
+  801524:	7f 06                	jg     80152c <sys_env_set_status+0x36>
+}
+  801526:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80152a:	c9                   	leave
+  80152b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80152c:	49 89 c0             	mov    %rax,%r8
+  80152f:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801534:	48 ba 30 39 80 00 00 	movabs $0x803930,%rdx
+  80153b:	00 00 00 
+  80153e:	be 26 00 00 00       	mov    $0x26,%esi
+  801543:	48 bf 4f 39 80 00 00 	movabs $0x80394f,%rdi
+  80154a:	00 00 00 
+  80154d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801552:	49 b9 ce 02 80 00 00 	movabs $0x8002ce,%r9
+  801559:	00 00 00 
+  80155c:	41 ff d1             	call   *%r9
+
+000000000080155f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80155f:	55                   	push   %rbp
+  801560:	48 89 e5             	mov    %rsp,%rbp
+  801563:	53                   	push   %rbx
+  801564:	48 83 ec 08          	sub    $0x8,%rsp
+  801568:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80156b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80156e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801573:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801578:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80157d:	be 00 00 00 00       	mov    $0x0,%esi
+  801582:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801588:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80158a:	48 85 c0             	test   %rax,%rax
+  80158d:	7f 06                	jg     801595 <sys_env_set_trapframe+0x36>
+}
+  80158f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801593:	c9                   	leave
+  801594:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801595:	49 89 c0             	mov    %rax,%r8
+  801598:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80159d:	48 ba 30 39 80 00 00 	movabs $0x803930,%rdx
+  8015a4:	00 00 00 
+  8015a7:	be 26 00 00 00       	mov    $0x26,%esi
+  8015ac:	48 bf 4f 39 80 00 00 	movabs $0x80394f,%rdi
+  8015b3:	00 00 00 
+  8015b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015bb:	49 b9 ce 02 80 00 00 	movabs $0x8002ce,%r9
+  8015c2:	00 00 00 
+  8015c5:	41 ff d1             	call   *%r9
+
+00000000008015c8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015c8:	55                   	push   %rbp
+  8015c9:	48 89 e5             	mov    %rsp,%rbp
+  8015cc:	53                   	push   %rbx
+  8015cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8015d1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015d4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d7:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8015eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015f3:	48 85 c0             	test   %rax,%rax
+  8015f6:	7f 06                	jg     8015fe <sys_env_set_pgfault_upcall+0x36>
+}
+  8015f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015fc:	c9                   	leave
+  8015fd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015fe:	49 89 c0             	mov    %rax,%r8
+  801601:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801606:	48 ba 30 39 80 00 00 	movabs $0x803930,%rdx
+  80160d:	00 00 00 
+  801610:	be 26 00 00 00       	mov    $0x26,%esi
+  801615:	48 bf 4f 39 80 00 00 	movabs $0x80394f,%rdi
+  80161c:	00 00 00 
+  80161f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801624:	49 b9 ce 02 80 00 00 	movabs $0x8002ce,%r9
+  80162b:	00 00 00 
+  80162e:	41 ff d1             	call   *%r9
+
+0000000000801631 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801631:	55                   	push   %rbp
+  801632:	48 89 e5             	mov    %rsp,%rbp
+  801635:	53                   	push   %rbx
+  801636:	89 f8                	mov    %edi,%eax
+  801638:	49 89 f1             	mov    %rsi,%r9
+  80163b:	48 89 d3             	mov    %rdx,%rbx
+  80163e:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801641:	49 63 f0             	movslq %r8d,%rsi
+  801644:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801647:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80164c:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80164f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801655:	cd 30                	int    $0x30
+}
+  801657:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80165b:	c9                   	leave
+  80165c:	c3                   	ret
+
+000000000080165d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80165d:	55                   	push   %rbp
+  80165e:	48 89 e5             	mov    %rsp,%rbp
+  801661:	53                   	push   %rbx
+  801662:	48 83 ec 08          	sub    $0x8,%rsp
+  801666:	48 89 fa             	mov    %rdi,%rdx
+  801669:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80166c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801671:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801676:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80167b:	be 00 00 00 00       	mov    $0x0,%esi
+  801680:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801686:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801688:	48 85 c0             	test   %rax,%rax
+  80168b:	7f 06                	jg     801693 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80168d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801691:	c9                   	leave
+  801692:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801693:	49 89 c0             	mov    %rax,%r8
+  801696:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80169b:	48 ba 30 39 80 00 00 	movabs $0x803930,%rdx
+  8016a2:	00 00 00 
+  8016a5:	be 26 00 00 00       	mov    $0x26,%esi
+  8016aa:	48 bf 4f 39 80 00 00 	movabs $0x80394f,%rdi
+  8016b1:	00 00 00 
+  8016b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b9:	49 b9 ce 02 80 00 00 	movabs $0x8002ce,%r9
+  8016c0:	00 00 00 
+  8016c3:	41 ff d1             	call   *%r9
+
+00000000008016c6 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8016c6:	55                   	push   %rbp
+  8016c7:	48 89 e5             	mov    %rsp,%rbp
+  8016ca:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016cb:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ef:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f5:	c9                   	leave
+  8016f6:	c3                   	ret
+
+00000000008016f7 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8016f7:	55                   	push   %rbp
+  8016f8:	48 89 e5             	mov    %rsp,%rbp
+  8016fb:	53                   	push   %rbx
+  8016fc:	48 83 ec 08          	sub    $0x8,%rsp
+  801700:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801703:	48 63 ce             	movslq %esi,%rcx
+  801706:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801709:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80170e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801713:	be 00 00 00 00       	mov    $0x0,%esi
+  801718:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80171e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801720:	48 85 c0             	test   %rax,%rax
+  801723:	7f 06                	jg     80172b <sys_sigqueue+0x34>
+}
+  801725:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801729:	c9                   	leave
+  80172a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80172b:	49 89 c0             	mov    %rax,%r8
+  80172e:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801733:	48 ba 30 39 80 00 00 	movabs $0x803930,%rdx
+  80173a:	00 00 00 
+  80173d:	be 26 00 00 00       	mov    $0x26,%esi
+  801742:	48 bf 4f 39 80 00 00 	movabs $0x80394f,%rdi
+  801749:	00 00 00 
+  80174c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801751:	49 b9 ce 02 80 00 00 	movabs $0x8002ce,%r9
+  801758:	00 00 00 
+  80175b:	41 ff d1             	call   *%r9
+
+000000000080175e <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  80175e:	55                   	push   %rbp
+  80175f:	48 89 e5             	mov    %rsp,%rbp
+  801762:	53                   	push   %rbx
+  801763:	48 83 ec 08          	sub    $0x8,%rsp
+  801767:	48 89 fa             	mov    %rdi,%rdx
+  80176a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80176d:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801772:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801777:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80177c:	be 00 00 00 00       	mov    $0x0,%esi
+  801781:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801787:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801789:	48 85 c0             	test   %rax,%rax
+  80178c:	7f 06                	jg     801794 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  80178e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801792:	c9                   	leave
+  801793:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801794:	49 89 c0             	mov    %rax,%r8
+  801797:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80179c:	48 ba 30 39 80 00 00 	movabs $0x803930,%rdx
+  8017a3:	00 00 00 
+  8017a6:	be 26 00 00 00       	mov    $0x26,%esi
+  8017ab:	48 bf 4f 39 80 00 00 	movabs $0x80394f,%rdi
+  8017b2:	00 00 00 
+  8017b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ba:	49 b9 ce 02 80 00 00 	movabs $0x8002ce,%r9
+  8017c1:	00 00 00 
+  8017c4:	41 ff d1             	call   *%r9
+
+00000000008017c7 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  8017c7:	55                   	push   %rbp
+  8017c8:	48 89 e5             	mov    %rsp,%rbp
+  8017cb:	53                   	push   %rbx
+  8017cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8017d0:	48 89 f1             	mov    %rsi,%rcx
+  8017d3:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  8017d6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017d9:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017de:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ee:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017f0:	48 85 c0             	test   %rax,%rax
+  8017f3:	7f 06                	jg     8017fb <sys_sigaction+0x34>
+}
+  8017f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f9:	c9                   	leave
+  8017fa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017fb:	49 89 c0             	mov    %rax,%r8
+  8017fe:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801803:	48 ba 30 39 80 00 00 	movabs $0x803930,%rdx
+  80180a:	00 00 00 
+  80180d:	be 26 00 00 00       	mov    $0x26,%esi
+  801812:	48 bf 4f 39 80 00 00 	movabs $0x80394f,%rdi
+  801819:	00 00 00 
+  80181c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801821:	49 b9 ce 02 80 00 00 	movabs $0x8002ce,%r9
+  801828:	00 00 00 
+  80182b:	41 ff d1             	call   *%r9
+
+000000000080182e <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  80182e:	55                   	push   %rbp
+  80182f:	48 89 e5             	mov    %rsp,%rbp
+  801832:	53                   	push   %rbx
+  801833:	48 83 ec 08          	sub    $0x8,%rsp
+  801837:	48 89 f1             	mov    %rsi,%rcx
+  80183a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  80183d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801840:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801845:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80184a:	be 00 00 00 00       	mov    $0x0,%esi
+  80184f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801855:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801857:	48 85 c0             	test   %rax,%rax
+  80185a:	7f 06                	jg     801862 <sys_sigprocmask+0x34>
+}
+  80185c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801860:	c9                   	leave
+  801861:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801862:	49 89 c0             	mov    %rax,%r8
+  801865:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80186a:	48 ba 30 39 80 00 00 	movabs $0x803930,%rdx
+  801871:	00 00 00 
+  801874:	be 26 00 00 00       	mov    $0x26,%esi
+  801879:	48 bf 4f 39 80 00 00 	movabs $0x80394f,%rdi
+  801880:	00 00 00 
+  801883:	b8 00 00 00 00       	mov    $0x0,%eax
+  801888:	49 b9 ce 02 80 00 00 	movabs $0x8002ce,%r9
+  80188f:	00 00 00 
+  801892:	41 ff d1             	call   *%r9
+
+0000000000801895 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801895:	55                   	push   %rbp
+  801896:	48 89 e5             	mov    %rsp,%rbp
+  801899:	41 54                	push   %r12
+  80189b:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80189c:	b8 08 00 00 00       	mov    $0x8,%eax
+  8018a1:	cd 30                	int    $0x30
+  8018a3:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  8018a6:	85 c0                	test   %eax,%eax
+  8018a8:	78 76                	js     801920 <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  8018aa:	74 7c                	je     801928 <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  8018ac:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8018b2:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8018b9:	00 00 00 
+  8018bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018c1:	89 c2                	mov    %eax,%edx
+  8018c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018cd:	48 b8 5a 13 80 00 00 	movabs $0x80135a,%rax
+  8018d4:	00 00 00 
+  8018d7:	ff d0                	call   *%rax
+  8018d9:	85 c0                	test   %eax,%eax
+  8018db:	75 7a                	jne    801957 <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  8018dd:	48 a1 10 50 80 00 00 	movabs 0x805010,%rax
+  8018e4:	00 00 00 
+  8018e7:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8018ee:	44 89 e7             	mov    %r12d,%edi
+  8018f1:	48 b8 c8 15 80 00 00 	movabs $0x8015c8,%rax
+  8018f8:	00 00 00 
+  8018fb:	ff d0                	call   *%rax
+  8018fd:	85 c0                	test   %eax,%eax
+  8018ff:	75 5e                	jne    80195f <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  801901:	be 02 00 00 00       	mov    $0x2,%esi
+  801906:	44 89 e7             	mov    %r12d,%edi
+  801909:	48 b8 f6 14 80 00 00 	movabs $0x8014f6,%rax
+  801910:	00 00 00 
+  801913:	ff d0                	call   *%rax
+        return -1;
+  801915:	85 c0                	test   %eax,%eax
+  801917:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80191c:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  801920:	44 89 e0             	mov    %r12d,%eax
+  801923:	5b                   	pop    %rbx
+  801924:	41 5c                	pop    %r12
+  801926:	5d                   	pop    %rbp
+  801927:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  801928:	48 b8 33 12 80 00 00 	movabs $0x801233,%rax
+  80192f:	00 00 00 
+  801932:	ff d0                	call   *%rax
+  801934:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  801937:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80193e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801945:	00 00 00 
+  801948:	48 01 d0             	add    %rdx,%rax
+  80194b:	48 a3 10 50 80 00 00 	movabs %rax,0x805010
+  801952:	00 00 00 
+        return 0;
+  801955:	eb c9                	jmp    801920 <fork+0x8b>
+        return -1;
+  801957:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80195d:	eb c1                	jmp    801920 <fork+0x8b>
+        return -1;
+  80195f:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801965:	eb b9                	jmp    801920 <fork+0x8b>
+
+0000000000801967 <sfork>:
+
+envid_t
+sfork() {
+  801967:	55                   	push   %rbp
+  801968:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  80196b:	48 ba 5d 39 80 00 00 	movabs $0x80395d,%rdx
+  801972:	00 00 00 
+  801975:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80197a:	48 bf 78 39 80 00 00 	movabs $0x803978,%rdi
+  801981:	00 00 00 
+  801984:	b8 00 00 00 00       	mov    $0x0,%eax
+  801989:	48 b9 ce 02 80 00 00 	movabs $0x8002ce,%rcx
+  801990:	00 00 00 
+  801993:	ff d1                	call   *%rcx
+
+0000000000801995 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801995:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80199c:	ff ff ff 
+  80199f:	48 01 f8             	add    %rdi,%rax
+  8019a2:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8019a6:	c3                   	ret
+
+00000000008019a7 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019a7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019ae:	ff ff ff 
+  8019b1:	48 01 f8             	add    %rdi,%rax
+  8019b4:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8019b8:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8019be:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8019c2:	c3                   	ret
+
+00000000008019c3 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8019c3:	55                   	push   %rbp
+  8019c4:	48 89 e5             	mov    %rsp,%rbp
+  8019c7:	41 57                	push   %r15
+  8019c9:	41 56                	push   %r14
+  8019cb:	41 55                	push   %r13
+  8019cd:	41 54                	push   %r12
+  8019cf:	53                   	push   %rbx
+  8019d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8019d4:	49 89 ff             	mov    %rdi,%r15
+  8019d7:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019dc:	49 bd 41 29 80 00 00 	movabs $0x802941,%r13
+  8019e3:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8019e6:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8019ec:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8019ef:	48 89 df             	mov    %rbx,%rdi
+  8019f2:	41 ff d5             	call   *%r13
+  8019f5:	83 e0 04             	and    $0x4,%eax
+  8019f8:	74 17                	je     801a11 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8019fa:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a01:	4c 39 f3             	cmp    %r14,%rbx
+  801a04:	75 e6                	jne    8019ec <fd_alloc+0x29>
+  801a06:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a0c:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a11:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a14:	48 83 c4 08          	add    $0x8,%rsp
+  801a18:	5b                   	pop    %rbx
+  801a19:	41 5c                	pop    %r12
+  801a1b:	41 5d                	pop    %r13
+  801a1d:	41 5e                	pop    %r14
+  801a1f:	41 5f                	pop    %r15
+  801a21:	5d                   	pop    %rbp
+  801a22:	c3                   	ret
+
+0000000000801a23 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a23:	83 ff 1f             	cmp    $0x1f,%edi
+  801a26:	77 39                	ja     801a61 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a28:	55                   	push   %rbp
+  801a29:	48 89 e5             	mov    %rsp,%rbp
+  801a2c:	41 54                	push   %r12
+  801a2e:	53                   	push   %rbx
+  801a2f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a32:	48 63 df             	movslq %edi,%rbx
+  801a35:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a3c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a40:	48 89 df             	mov    %rbx,%rdi
+  801a43:	48 b8 41 29 80 00 00 	movabs $0x802941,%rax
+  801a4a:	00 00 00 
+  801a4d:	ff d0                	call   *%rax
+  801a4f:	a8 04                	test   $0x4,%al
+  801a51:	74 14                	je     801a67 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a53:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a5c:	5b                   	pop    %rbx
+  801a5d:	41 5c                	pop    %r12
+  801a5f:	5d                   	pop    %rbp
+  801a60:	c3                   	ret
+        return -E_INVAL;
+  801a61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a66:	c3                   	ret
+        return -E_INVAL;
+  801a67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a6c:	eb ee                	jmp    801a5c <fd_lookup+0x39>
+
+0000000000801a6e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a6e:	55                   	push   %rbp
+  801a6f:	48 89 e5             	mov    %rsp,%rbp
+  801a72:	41 54                	push   %r12
+  801a74:	53                   	push   %rbx
+  801a75:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a78:	48 b8 20 3a 80 00 00 	movabs $0x803a20,%rax
+  801a7f:	00 00 00 
+  801a82:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801a89:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a8c:	39 3b                	cmp    %edi,(%rbx)
+  801a8e:	74 47                	je     801ad7 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a90:	48 83 c0 08          	add    $0x8,%rax
+  801a94:	48 8b 18             	mov    (%rax),%rbx
+  801a97:	48 85 db             	test   %rbx,%rbx
+  801a9a:	75 f0                	jne    801a8c <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a9c:	48 a1 10 50 80 00 00 	movabs 0x805010,%rax
+  801aa3:	00 00 00 
+  801aa6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801aac:	89 fa                	mov    %edi,%edx
+  801aae:	48 bf 88 39 80 00 00 	movabs $0x803988,%rdi
+  801ab5:	00 00 00 
+  801ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abd:	48 b9 1e 04 80 00 00 	movabs $0x80041e,%rcx
+  801ac4:	00 00 00 
+  801ac7:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801ac9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801ace:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801ad2:	5b                   	pop    %rbx
+  801ad3:	41 5c                	pop    %r12
+  801ad5:	5d                   	pop    %rbp
+  801ad6:	c3                   	ret
+            return 0;
+  801ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801adc:	eb f0                	jmp    801ace <dev_lookup+0x60>
+
+0000000000801ade <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ade:	55                   	push   %rbp
+  801adf:	48 89 e5             	mov    %rsp,%rbp
+  801ae2:	41 55                	push   %r13
+  801ae4:	41 54                	push   %r12
+  801ae6:	53                   	push   %rbx
+  801ae7:	48 83 ec 18          	sub    $0x18,%rsp
+  801aeb:	48 89 fb             	mov    %rdi,%rbx
+  801aee:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801af1:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801af8:	ff ff ff 
+  801afb:	48 01 df             	add    %rbx,%rdi
+  801afe:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b02:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b06:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  801b0d:	00 00 00 
+  801b10:	ff d0                	call   *%rax
+  801b12:	41 89 c5             	mov    %eax,%r13d
+  801b15:	85 c0                	test   %eax,%eax
+  801b17:	78 06                	js     801b1f <fd_close+0x41>
+  801b19:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b1d:	74 1a                	je     801b39 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b1f:	45 84 e4             	test   %r12b,%r12b
+  801b22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b27:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b2b:	44 89 e8             	mov    %r13d,%eax
+  801b2e:	48 83 c4 18          	add    $0x18,%rsp
+  801b32:	5b                   	pop    %rbx
+  801b33:	41 5c                	pop    %r12
+  801b35:	41 5d                	pop    %r13
+  801b37:	5d                   	pop    %rbp
+  801b38:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b39:	8b 3b                	mov    (%rbx),%edi
+  801b3b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b3f:	48 b8 6e 1a 80 00 00 	movabs $0x801a6e,%rax
+  801b46:	00 00 00 
+  801b49:	ff d0                	call   *%rax
+  801b4b:	41 89 c5             	mov    %eax,%r13d
+  801b4e:	85 c0                	test   %eax,%eax
+  801b50:	78 1b                	js     801b6d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b56:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b5a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b60:	48 85 c0             	test   %rax,%rax
+  801b63:	74 08                	je     801b6d <fd_close+0x8f>
+  801b65:	48 89 df             	mov    %rbx,%rdi
+  801b68:	ff d0                	call   *%rax
+  801b6a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b6d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b72:	48 89 de             	mov    %rbx,%rsi
+  801b75:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b7a:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  801b81:	00 00 00 
+  801b84:	ff d0                	call   *%rax
+    return res;
+  801b86:	eb a3                	jmp    801b2b <fd_close+0x4d>
+
+0000000000801b88 <close>:
+
+int
+close(int fdnum) {
+  801b88:	55                   	push   %rbp
+  801b89:	48 89 e5             	mov    %rsp,%rbp
+  801b8c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b90:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b94:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  801b9b:	00 00 00 
+  801b9e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ba0:	85 c0                	test   %eax,%eax
+  801ba2:	78 15                	js     801bb9 <close+0x31>
+
+    return fd_close(fd, 1);
+  801ba4:	be 01 00 00 00       	mov    $0x1,%esi
+  801ba9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801bad:	48 b8 de 1a 80 00 00 	movabs $0x801ade,%rax
+  801bb4:	00 00 00 
+  801bb7:	ff d0                	call   *%rax
+}
+  801bb9:	c9                   	leave
+  801bba:	c3                   	ret
+
+0000000000801bbb <close_all>:
+
+void
+close_all(void) {
+  801bbb:	55                   	push   %rbp
+  801bbc:	48 89 e5             	mov    %rsp,%rbp
+  801bbf:	41 54                	push   %r12
+  801bc1:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801bc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bc7:	49 bc 88 1b 80 00 00 	movabs $0x801b88,%r12
+  801bce:	00 00 00 
+  801bd1:	89 df                	mov    %ebx,%edi
+  801bd3:	41 ff d4             	call   *%r12
+  801bd6:	83 c3 01             	add    $0x1,%ebx
+  801bd9:	83 fb 20             	cmp    $0x20,%ebx
+  801bdc:	75 f3                	jne    801bd1 <close_all+0x16>
+}
+  801bde:	5b                   	pop    %rbx
+  801bdf:	41 5c                	pop    %r12
+  801be1:	5d                   	pop    %rbp
+  801be2:	c3                   	ret
+
+0000000000801be3 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801be3:	55                   	push   %rbp
+  801be4:	48 89 e5             	mov    %rsp,%rbp
+  801be7:	41 57                	push   %r15
+  801be9:	41 56                	push   %r14
+  801beb:	41 55                	push   %r13
+  801bed:	41 54                	push   %r12
+  801bef:	53                   	push   %rbx
+  801bf0:	48 83 ec 18          	sub    $0x18,%rsp
+  801bf4:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801bf7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801bfb:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  801c02:	00 00 00 
+  801c05:	ff d0                	call   *%rax
+  801c07:	89 c3                	mov    %eax,%ebx
+  801c09:	85 c0                	test   %eax,%eax
+  801c0b:	0f 88 b8 00 00 00    	js     801cc9 <dup+0xe6>
+    close(newfdnum);
+  801c11:	44 89 e7             	mov    %r12d,%edi
+  801c14:	48 b8 88 1b 80 00 00 	movabs $0x801b88,%rax
+  801c1b:	00 00 00 
+  801c1e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c20:	4d 63 ec             	movslq %r12d,%r13
+  801c23:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c2a:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c2e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c32:	4c 89 ff             	mov    %r15,%rdi
+  801c35:	49 be a7 19 80 00 00 	movabs $0x8019a7,%r14
+  801c3c:	00 00 00 
+  801c3f:	41 ff d6             	call   *%r14
+  801c42:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c45:	4c 89 ef             	mov    %r13,%rdi
+  801c48:	41 ff d6             	call   *%r14
+  801c4b:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c4e:	48 89 df             	mov    %rbx,%rdi
+  801c51:	48 b8 41 29 80 00 00 	movabs $0x802941,%rax
+  801c58:	00 00 00 
+  801c5b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c5d:	a8 04                	test   $0x4,%al
+  801c5f:	74 2b                	je     801c8c <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c61:	41 89 c1             	mov    %eax,%r9d
+  801c64:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c6a:	4c 89 f1             	mov    %r14,%rcx
+  801c6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c72:	48 89 de             	mov    %rbx,%rsi
+  801c75:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c7a:	48 b8 5a 13 80 00 00 	movabs $0x80135a,%rax
+  801c81:	00 00 00 
+  801c84:	ff d0                	call   *%rax
+  801c86:	89 c3                	mov    %eax,%ebx
+  801c88:	85 c0                	test   %eax,%eax
+  801c8a:	78 4e                	js     801cda <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c8c:	4c 89 ff             	mov    %r15,%rdi
+  801c8f:	48 b8 41 29 80 00 00 	movabs $0x802941,%rax
+  801c96:	00 00 00 
+  801c99:	ff d0                	call   *%rax
+  801c9b:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c9e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ca4:	4c 89 e9             	mov    %r13,%rcx
+  801ca7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cac:	4c 89 fe             	mov    %r15,%rsi
+  801caf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cb4:	48 b8 5a 13 80 00 00 	movabs $0x80135a,%rax
+  801cbb:	00 00 00 
+  801cbe:	ff d0                	call   *%rax
+  801cc0:	89 c3                	mov    %eax,%ebx
+  801cc2:	85 c0                	test   %eax,%eax
+  801cc4:	78 14                	js     801cda <dup+0xf7>
+
+    return newfdnum;
+  801cc6:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801cc9:	89 d8                	mov    %ebx,%eax
+  801ccb:	48 83 c4 18          	add    $0x18,%rsp
+  801ccf:	5b                   	pop    %rbx
+  801cd0:	41 5c                	pop    %r12
+  801cd2:	41 5d                	pop    %r13
+  801cd4:	41 5e                	pop    %r14
+  801cd6:	41 5f                	pop    %r15
+  801cd8:	5d                   	pop    %rbp
+  801cd9:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801cda:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cdf:	4c 89 ee             	mov    %r13,%rsi
+  801ce2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ce7:	49 bc bf 13 80 00 00 	movabs $0x8013bf,%r12
+  801cee:	00 00 00 
+  801cf1:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801cf4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cf9:	4c 89 f6             	mov    %r14,%rsi
+  801cfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d01:	41 ff d4             	call   *%r12
+    return res;
+  801d04:	eb c3                	jmp    801cc9 <dup+0xe6>
+
+0000000000801d06 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d06:	55                   	push   %rbp
+  801d07:	48 89 e5             	mov    %rsp,%rbp
+  801d0a:	41 56                	push   %r14
+  801d0c:	41 55                	push   %r13
+  801d0e:	41 54                	push   %r12
+  801d10:	53                   	push   %rbx
+  801d11:	48 83 ec 10          	sub    $0x10,%rsp
+  801d15:	89 fb                	mov    %edi,%ebx
+  801d17:	49 89 f4             	mov    %rsi,%r12
+  801d1a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d1d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d21:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  801d28:	00 00 00 
+  801d2b:	ff d0                	call   *%rax
+  801d2d:	85 c0                	test   %eax,%eax
+  801d2f:	78 4c                	js     801d7d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d31:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d35:	41 8b 3e             	mov    (%r14),%edi
+  801d38:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d3c:	48 b8 6e 1a 80 00 00 	movabs $0x801a6e,%rax
+  801d43:	00 00 00 
+  801d46:	ff d0                	call   *%rax
+  801d48:	85 c0                	test   %eax,%eax
+  801d4a:	78 35                	js     801d81 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d4c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d50:	83 e0 03             	and    $0x3,%eax
+  801d53:	83 f8 01             	cmp    $0x1,%eax
+  801d56:	74 2d                	je     801d85 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d58:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d5c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d60:	48 85 c0             	test   %rax,%rax
+  801d63:	74 56                	je     801dbb <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d65:	4c 89 ea             	mov    %r13,%rdx
+  801d68:	4c 89 e6             	mov    %r12,%rsi
+  801d6b:	4c 89 f7             	mov    %r14,%rdi
+  801d6e:	ff d0                	call   *%rax
+}
+  801d70:	48 83 c4 10          	add    $0x10,%rsp
+  801d74:	5b                   	pop    %rbx
+  801d75:	41 5c                	pop    %r12
+  801d77:	41 5d                	pop    %r13
+  801d79:	41 5e                	pop    %r14
+  801d7b:	5d                   	pop    %rbp
+  801d7c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d7d:	48 98                	cltq
+  801d7f:	eb ef                	jmp    801d70 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d81:	48 98                	cltq
+  801d83:	eb eb                	jmp    801d70 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d85:	48 a1 10 50 80 00 00 	movabs 0x805010,%rax
+  801d8c:	00 00 00 
+  801d8f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d95:	89 da                	mov    %ebx,%edx
+  801d97:	48 bf c9 39 80 00 00 	movabs $0x8039c9,%rdi
+  801d9e:	00 00 00 
+  801da1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da6:	48 b9 1e 04 80 00 00 	movabs $0x80041e,%rcx
+  801dad:	00 00 00 
+  801db0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801db2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801db9:	eb b5                	jmp    801d70 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dbb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dc2:	eb ac                	jmp    801d70 <read+0x6a>
+
+0000000000801dc4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801dc4:	55                   	push   %rbp
+  801dc5:	48 89 e5             	mov    %rsp,%rbp
+  801dc8:	41 57                	push   %r15
+  801dca:	41 56                	push   %r14
+  801dcc:	41 55                	push   %r13
+  801dce:	41 54                	push   %r12
+  801dd0:	53                   	push   %rbx
+  801dd1:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801dd5:	48 85 d2             	test   %rdx,%rdx
+  801dd8:	74 54                	je     801e2e <readn+0x6a>
+  801dda:	41 89 fd             	mov    %edi,%r13d
+  801ddd:	49 89 f6             	mov    %rsi,%r14
+  801de0:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801de3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801de8:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ded:	49 bf 06 1d 80 00 00 	movabs $0x801d06,%r15
+  801df4:	00 00 00 
+  801df7:	4c 89 e2             	mov    %r12,%rdx
+  801dfa:	48 29 f2             	sub    %rsi,%rdx
+  801dfd:	4c 01 f6             	add    %r14,%rsi
+  801e00:	44 89 ef             	mov    %r13d,%edi
+  801e03:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e06:	85 c0                	test   %eax,%eax
+  801e08:	78 20                	js     801e2a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e0a:	01 c3                	add    %eax,%ebx
+  801e0c:	85 c0                	test   %eax,%eax
+  801e0e:	74 08                	je     801e18 <readn+0x54>
+  801e10:	48 63 f3             	movslq %ebx,%rsi
+  801e13:	4c 39 e6             	cmp    %r12,%rsi
+  801e16:	72 df                	jb     801df7 <readn+0x33>
+    }
+    return res;
+  801e18:	48 63 c3             	movslq %ebx,%rax
+}
+  801e1b:	48 83 c4 08          	add    $0x8,%rsp
+  801e1f:	5b                   	pop    %rbx
+  801e20:	41 5c                	pop    %r12
+  801e22:	41 5d                	pop    %r13
+  801e24:	41 5e                	pop    %r14
+  801e26:	41 5f                	pop    %r15
+  801e28:	5d                   	pop    %rbp
+  801e29:	c3                   	ret
+        if (inc < 0) return inc;
+  801e2a:	48 98                	cltq
+  801e2c:	eb ed                	jmp    801e1b <readn+0x57>
+    int inc = 1, res = 0;
+  801e2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e33:	eb e3                	jmp    801e18 <readn+0x54>
+
+0000000000801e35 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e35:	55                   	push   %rbp
+  801e36:	48 89 e5             	mov    %rsp,%rbp
+  801e39:	41 56                	push   %r14
+  801e3b:	41 55                	push   %r13
+  801e3d:	41 54                	push   %r12
+  801e3f:	53                   	push   %rbx
+  801e40:	48 83 ec 10          	sub    $0x10,%rsp
+  801e44:	89 fb                	mov    %edi,%ebx
+  801e46:	49 89 f4             	mov    %rsi,%r12
+  801e49:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e4c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e50:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  801e57:	00 00 00 
+  801e5a:	ff d0                	call   *%rax
+  801e5c:	85 c0                	test   %eax,%eax
+  801e5e:	78 47                	js     801ea7 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e60:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e64:	41 8b 3e             	mov    (%r14),%edi
+  801e67:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e6b:	48 b8 6e 1a 80 00 00 	movabs $0x801a6e,%rax
+  801e72:	00 00 00 
+  801e75:	ff d0                	call   *%rax
+  801e77:	85 c0                	test   %eax,%eax
+  801e79:	78 30                	js     801eab <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e7b:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e80:	74 2d                	je     801eaf <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e82:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e86:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e8a:	48 85 c0             	test   %rax,%rax
+  801e8d:	74 56                	je     801ee5 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e8f:	4c 89 ea             	mov    %r13,%rdx
+  801e92:	4c 89 e6             	mov    %r12,%rsi
+  801e95:	4c 89 f7             	mov    %r14,%rdi
+  801e98:	ff d0                	call   *%rax
+}
+  801e9a:	48 83 c4 10          	add    $0x10,%rsp
+  801e9e:	5b                   	pop    %rbx
+  801e9f:	41 5c                	pop    %r12
+  801ea1:	41 5d                	pop    %r13
+  801ea3:	41 5e                	pop    %r14
+  801ea5:	5d                   	pop    %rbp
+  801ea6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ea7:	48 98                	cltq
+  801ea9:	eb ef                	jmp    801e9a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eab:	48 98                	cltq
+  801ead:	eb eb                	jmp    801e9a <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801eaf:	48 a1 10 50 80 00 00 	movabs 0x805010,%rax
+  801eb6:	00 00 00 
+  801eb9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ebf:	89 da                	mov    %ebx,%edx
+  801ec1:	48 bf e5 39 80 00 00 	movabs $0x8039e5,%rdi
+  801ec8:	00 00 00 
+  801ecb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed0:	48 b9 1e 04 80 00 00 	movabs $0x80041e,%rcx
+  801ed7:	00 00 00 
+  801eda:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801edc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ee3:	eb b5                	jmp    801e9a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ee5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801eec:	eb ac                	jmp    801e9a <write+0x65>
+
+0000000000801eee <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801eee:	55                   	push   %rbp
+  801eef:	48 89 e5             	mov    %rsp,%rbp
+  801ef2:	53                   	push   %rbx
+  801ef3:	48 83 ec 18          	sub    $0x18,%rsp
+  801ef7:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ef9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801efd:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  801f04:	00 00 00 
+  801f07:	ff d0                	call   *%rax
+  801f09:	85 c0                	test   %eax,%eax
+  801f0b:	78 0c                	js     801f19 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f11:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f14:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f19:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f1d:	c9                   	leave
+  801f1e:	c3                   	ret
+
+0000000000801f1f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f1f:	55                   	push   %rbp
+  801f20:	48 89 e5             	mov    %rsp,%rbp
+  801f23:	41 55                	push   %r13
+  801f25:	41 54                	push   %r12
+  801f27:	53                   	push   %rbx
+  801f28:	48 83 ec 18          	sub    $0x18,%rsp
+  801f2c:	89 fb                	mov    %edi,%ebx
+  801f2e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f31:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f35:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  801f3c:	00 00 00 
+  801f3f:	ff d0                	call   *%rax
+  801f41:	85 c0                	test   %eax,%eax
+  801f43:	78 38                	js     801f7d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f45:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f49:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f4d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f51:	48 b8 6e 1a 80 00 00 	movabs $0x801a6e,%rax
+  801f58:	00 00 00 
+  801f5b:	ff d0                	call   *%rax
+  801f5d:	85 c0                	test   %eax,%eax
+  801f5f:	78 1c                	js     801f7d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f61:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f66:	74 20                	je     801f88 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f68:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f6c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f70:	48 85 c0             	test   %rax,%rax
+  801f73:	74 47                	je     801fbc <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f75:	44 89 e6             	mov    %r12d,%esi
+  801f78:	4c 89 ef             	mov    %r13,%rdi
+  801f7b:	ff d0                	call   *%rax
+}
+  801f7d:	48 83 c4 18          	add    $0x18,%rsp
+  801f81:	5b                   	pop    %rbx
+  801f82:	41 5c                	pop    %r12
+  801f84:	41 5d                	pop    %r13
+  801f86:	5d                   	pop    %rbp
+  801f87:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f88:	48 a1 10 50 80 00 00 	movabs 0x805010,%rax
+  801f8f:	00 00 00 
+  801f92:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f98:	89 da                	mov    %ebx,%edx
+  801f9a:	48 bf a8 39 80 00 00 	movabs $0x8039a8,%rdi
+  801fa1:	00 00 00 
+  801fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa9:	48 b9 1e 04 80 00 00 	movabs $0x80041e,%rcx
+  801fb0:	00 00 00 
+  801fb3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fb5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fba:	eb c1                	jmp    801f7d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fbc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fc1:	eb ba                	jmp    801f7d <ftruncate+0x5e>
+
+0000000000801fc3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801fc3:	55                   	push   %rbp
+  801fc4:	48 89 e5             	mov    %rsp,%rbp
+  801fc7:	41 54                	push   %r12
+  801fc9:	53                   	push   %rbx
+  801fca:	48 83 ec 10          	sub    $0x10,%rsp
+  801fce:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fd1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fd5:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  801fdc:	00 00 00 
+  801fdf:	ff d0                	call   *%rax
+  801fe1:	85 c0                	test   %eax,%eax
+  801fe3:	78 4e                	js     802033 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fe5:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801fe9:	41 8b 3c 24          	mov    (%r12),%edi
+  801fed:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ff1:	48 b8 6e 1a 80 00 00 	movabs $0x801a6e,%rax
+  801ff8:	00 00 00 
+  801ffb:	ff d0                	call   *%rax
+  801ffd:	85 c0                	test   %eax,%eax
+  801fff:	78 32                	js     802033 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802001:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802005:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80200a:	74 30                	je     80203c <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80200c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80200f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802016:	00 00 00 
+    stat->st_isdir = 0;
+  802019:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802020:	00 00 00 
+    stat->st_dev = dev;
+  802023:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80202a:	48 89 de             	mov    %rbx,%rsi
+  80202d:	4c 89 e7             	mov    %r12,%rdi
+  802030:	ff 50 28             	call   *0x28(%rax)
+}
+  802033:	48 83 c4 10          	add    $0x10,%rsp
+  802037:	5b                   	pop    %rbx
+  802038:	41 5c                	pop    %r12
+  80203a:	5d                   	pop    %rbp
+  80203b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80203c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802041:	eb f0                	jmp    802033 <fstat+0x70>
+
+0000000000802043 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802043:	55                   	push   %rbp
+  802044:	48 89 e5             	mov    %rsp,%rbp
+  802047:	41 54                	push   %r12
+  802049:	53                   	push   %rbx
+  80204a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80204d:	be 00 00 00 00       	mov    $0x0,%esi
+  802052:	48 b8 c4 22 80 00 00 	movabs $0x8022c4,%rax
+  802059:	00 00 00 
+  80205c:	ff d0                	call   *%rax
+  80205e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802060:	85 c0                	test   %eax,%eax
+  802062:	78 25                	js     802089 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802064:	4c 89 e6             	mov    %r12,%rsi
+  802067:	89 c7                	mov    %eax,%edi
+  802069:	48 b8 c3 1f 80 00 00 	movabs $0x801fc3,%rax
+  802070:	00 00 00 
+  802073:	ff d0                	call   *%rax
+  802075:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802078:	89 df                	mov    %ebx,%edi
+  80207a:	48 b8 88 1b 80 00 00 	movabs $0x801b88,%rax
+  802081:	00 00 00 
+  802084:	ff d0                	call   *%rax
+
+    return res;
+  802086:	44 89 e3             	mov    %r12d,%ebx
+}
+  802089:	89 d8                	mov    %ebx,%eax
+  80208b:	5b                   	pop    %rbx
+  80208c:	41 5c                	pop    %r12
+  80208e:	5d                   	pop    %rbp
+  80208f:	c3                   	ret
+
+0000000000802090 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802090:	55                   	push   %rbp
+  802091:	48 89 e5             	mov    %rsp,%rbp
+  802094:	41 54                	push   %r12
+  802096:	53                   	push   %rbx
+  802097:	48 83 ec 10          	sub    $0x10,%rsp
+  80209b:	41 89 fc             	mov    %edi,%r12d
+  80209e:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020a1:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020a8:	00 00 00 
+  8020ab:	83 38 00             	cmpl   $0x0,(%rax)
+  8020ae:	74 5e                	je     80210e <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8020b0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020b6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020bb:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8020c2:	00 00 00 
+  8020c5:	44 89 e6             	mov    %r12d,%esi
+  8020c8:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020cf:	00 00 00 
+  8020d2:	8b 38                	mov    (%rax),%edi
+  8020d4:	48 b8 95 2f 80 00 00 	movabs $0x802f95,%rax
+  8020db:	00 00 00 
+  8020de:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8020e0:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8020e7:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8020e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020ed:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8020f1:	48 89 de             	mov    %rbx,%rsi
+  8020f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020f9:	48 b8 00 2f 80 00 00 	movabs $0x802f00,%rax
+  802100:	00 00 00 
+  802103:	ff d0                	call   *%rax
+}
+  802105:	48 83 c4 10          	add    $0x10,%rsp
+  802109:	5b                   	pop    %rbx
+  80210a:	41 5c                	pop    %r12
+  80210c:	5d                   	pop    %rbp
+  80210d:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80210e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802113:	48 b8 35 30 80 00 00 	movabs $0x803035,%rax
+  80211a:	00 00 00 
+  80211d:	ff d0                	call   *%rax
+  80211f:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802126:	00 00 
+  802128:	eb 86                	jmp    8020b0 <fsipc+0x20>
+
+000000000080212a <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80212a:	55                   	push   %rbp
+  80212b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80212e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802135:	00 00 00 
+  802138:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80213b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80213d:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802140:	be 00 00 00 00       	mov    $0x0,%esi
+  802145:	bf 02 00 00 00       	mov    $0x2,%edi
+  80214a:	48 b8 90 20 80 00 00 	movabs $0x802090,%rax
+  802151:	00 00 00 
+  802154:	ff d0                	call   *%rax
+}
+  802156:	5d                   	pop    %rbp
+  802157:	c3                   	ret
+
+0000000000802158 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802158:	55                   	push   %rbp
+  802159:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80215c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80215f:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802166:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802168:	be 00 00 00 00       	mov    $0x0,%esi
+  80216d:	bf 06 00 00 00       	mov    $0x6,%edi
+  802172:	48 b8 90 20 80 00 00 	movabs $0x802090,%rax
+  802179:	00 00 00 
+  80217c:	ff d0                	call   *%rax
+}
+  80217e:	5d                   	pop    %rbp
+  80217f:	c3                   	ret
+
+0000000000802180 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802180:	55                   	push   %rbp
+  802181:	48 89 e5             	mov    %rsp,%rbp
+  802184:	41 54                	push   %r12
+  802186:	53                   	push   %rbx
+  802187:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80218a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80218d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802194:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802196:	be 00 00 00 00       	mov    $0x0,%esi
+  80219b:	bf 05 00 00 00       	mov    $0x5,%edi
+  8021a0:	48 b8 90 20 80 00 00 	movabs $0x802090,%rax
+  8021a7:	00 00 00 
+  8021aa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021ac:	85 c0                	test   %eax,%eax
+  8021ae:	78 3d                	js     8021ed <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021b0:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8021b7:	00 00 00 
+  8021ba:	4c 89 e6             	mov    %r12,%rsi
+  8021bd:	48 89 df             	mov    %rbx,%rdi
+  8021c0:	48 b8 43 0d 80 00 00 	movabs $0x800d43,%rax
+  8021c7:	00 00 00 
+  8021ca:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8021cc:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8021d3:	00 
+  8021d4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021da:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8021e1:	00 
+  8021e2:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8021e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021ed:	5b                   	pop    %rbx
+  8021ee:	41 5c                	pop    %r12
+  8021f0:	5d                   	pop    %rbp
+  8021f1:	c3                   	ret
+
+00000000008021f2 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8021f2:	55                   	push   %rbp
+  8021f3:	48 89 e5             	mov    %rsp,%rbp
+  8021f6:	41 54                	push   %r12
+  8021f8:	53                   	push   %rbx
+  8021f9:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8021fc:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802201:	48 39 c2             	cmp    %rax,%rdx
+  802204:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802208:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80220b:	48 89 c2             	mov    %rax,%rdx
+  80220e:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802215:	00 00 00 
+  802218:	48 b8 a4 0f 80 00 00 	movabs $0x800fa4,%rax
+  80221f:	00 00 00 
+  802222:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802224:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80222b:	00 00 00 
+  80222e:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802233:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802235:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  802239:	be 00 00 00 00       	mov    $0x0,%esi
+  80223e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802243:	48 b8 90 20 80 00 00 	movabs $0x802090,%rax
+  80224a:	00 00 00 
+  80224d:	ff d0                	call   *%rax
+  80224f:	48 98                	cltq
+}
+  802251:	5b                   	pop    %rbx
+  802252:	41 5c                	pop    %r12
+  802254:	5d                   	pop    %rbp
+  802255:	c3                   	ret
+
+0000000000802256 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802256:	55                   	push   %rbp
+  802257:	48 89 e5             	mov    %rsp,%rbp
+  80225a:	41 54                	push   %r12
+  80225c:	53                   	push   %rbx
+  80225d:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802260:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802267:	00 00 00 
+  80226a:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80226d:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  80226f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802274:	48 39 ca             	cmp    %rcx,%rdx
+  802277:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  80227b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  80227f:	be 00 00 00 00       	mov    $0x0,%esi
+  802284:	bf 03 00 00 00       	mov    $0x3,%edi
+  802289:	48 b8 90 20 80 00 00 	movabs $0x802090,%rax
+  802290:	00 00 00 
+  802293:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802295:	85 c0                	test   %eax,%eax
+  802297:	78 27                	js     8022c0 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802299:	48 63 d8             	movslq %eax,%rbx
+  80229c:	48 89 da             	mov    %rbx,%rdx
+  80229f:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8022a6:	00 00 00 
+  8022a9:	4c 89 e7             	mov    %r12,%rdi
+  8022ac:	48 b8 a4 0f 80 00 00 	movabs $0x800fa4,%rax
+  8022b3:	00 00 00 
+  8022b6:	ff d0                	call   *%rax
+    return bytes_read;
+  8022b8:	48 89 d8             	mov    %rbx,%rax
+}
+  8022bb:	5b                   	pop    %rbx
+  8022bc:	41 5c                	pop    %r12
+  8022be:	5d                   	pop    %rbp
+  8022bf:	c3                   	ret
+        return bytes_read;
+  8022c0:	48 98                	cltq
+  8022c2:	eb f7                	jmp    8022bb <devfile_read+0x65>
+
+00000000008022c4 <open>:
+open(const char *path, int mode) {
+  8022c4:	55                   	push   %rbp
+  8022c5:	48 89 e5             	mov    %rsp,%rbp
+  8022c8:	41 55                	push   %r13
+  8022ca:	41 54                	push   %r12
+  8022cc:	53                   	push   %rbx
+  8022cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8022d1:	49 89 fc             	mov    %rdi,%r12
+  8022d4:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8022d7:	48 b8 05 0d 80 00 00 	movabs $0x800d05,%rax
+  8022de:	00 00 00 
+  8022e1:	ff d0                	call   *%rax
+  8022e3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8022e9:	0f 87 8a 00 00 00    	ja     802379 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8022ef:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8022f3:	48 b8 c3 19 80 00 00 	movabs $0x8019c3,%rax
+  8022fa:	00 00 00 
+  8022fd:	ff d0                	call   *%rax
+  8022ff:	89 c3                	mov    %eax,%ebx
+  802301:	85 c0                	test   %eax,%eax
+  802303:	78 50                	js     802355 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802305:	4c 89 e6             	mov    %r12,%rsi
+  802308:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80230f:	00 00 00 
+  802312:	48 89 df             	mov    %rbx,%rdi
+  802315:	48 b8 43 0d 80 00 00 	movabs $0x800d43,%rax
+  80231c:	00 00 00 
+  80231f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802321:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802328:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80232c:	bf 01 00 00 00       	mov    $0x1,%edi
+  802331:	48 b8 90 20 80 00 00 	movabs $0x802090,%rax
+  802338:	00 00 00 
+  80233b:	ff d0                	call   *%rax
+  80233d:	89 c3                	mov    %eax,%ebx
+  80233f:	85 c0                	test   %eax,%eax
+  802341:	78 1f                	js     802362 <open+0x9e>
+    return fd2num(fd);
+  802343:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802347:	48 b8 95 19 80 00 00 	movabs $0x801995,%rax
+  80234e:	00 00 00 
+  802351:	ff d0                	call   *%rax
+  802353:	89 c3                	mov    %eax,%ebx
+}
+  802355:	89 d8                	mov    %ebx,%eax
+  802357:	48 83 c4 18          	add    $0x18,%rsp
+  80235b:	5b                   	pop    %rbx
+  80235c:	41 5c                	pop    %r12
+  80235e:	41 5d                	pop    %r13
+  802360:	5d                   	pop    %rbp
+  802361:	c3                   	ret
+        fd_close(fd, 0);
+  802362:	be 00 00 00 00       	mov    $0x0,%esi
+  802367:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80236b:	48 b8 de 1a 80 00 00 	movabs $0x801ade,%rax
+  802372:	00 00 00 
+  802375:	ff d0                	call   *%rax
+        return res;
+  802377:	eb dc                	jmp    802355 <open+0x91>
+        return -E_BAD_PATH;
+  802379:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80237e:	eb d5                	jmp    802355 <open+0x91>
+
+0000000000802380 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802380:	55                   	push   %rbp
+  802381:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802384:	be 00 00 00 00       	mov    $0x0,%esi
+  802389:	bf 08 00 00 00       	mov    $0x8,%edi
+  80238e:	48 b8 90 20 80 00 00 	movabs $0x802090,%rax
+  802395:	00 00 00 
+  802398:	ff d0                	call   *%rax
+}
+  80239a:	5d                   	pop    %rbp
+  80239b:	c3                   	ret
+
+000000000080239c <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80239c:	55                   	push   %rbp
+  80239d:	48 89 e5             	mov    %rsp,%rbp
+  8023a0:	41 54                	push   %r12
+  8023a2:	53                   	push   %rbx
+  8023a3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8023a6:	48 b8 a7 19 80 00 00 	movabs $0x8019a7,%rax
+  8023ad:	00 00 00 
+  8023b0:	ff d0                	call   *%rax
+  8023b2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8023b5:	48 be 40 3a 80 00 00 	movabs $0x803a40,%rsi
+  8023bc:	00 00 00 
+  8023bf:	48 89 df             	mov    %rbx,%rdi
+  8023c2:	48 b8 43 0d 80 00 00 	movabs $0x800d43,%rax
+  8023c9:	00 00 00 
+  8023cc:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8023ce:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8023d3:	41 2b 04 24          	sub    (%r12),%eax
+  8023d7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8023dd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8023e4:	00 00 00 
+    stat->st_dev = &devpipe;
+  8023e7:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8023ee:	00 00 00 
+  8023f1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8023f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023fd:	5b                   	pop    %rbx
+  8023fe:	41 5c                	pop    %r12
+  802400:	5d                   	pop    %rbp
+  802401:	c3                   	ret
+
+0000000000802402 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802402:	55                   	push   %rbp
+  802403:	48 89 e5             	mov    %rsp,%rbp
+  802406:	41 54                	push   %r12
+  802408:	53                   	push   %rbx
+  802409:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80240c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802411:	48 89 fe             	mov    %rdi,%rsi
+  802414:	bf 00 00 00 00       	mov    $0x0,%edi
+  802419:	49 bc bf 13 80 00 00 	movabs $0x8013bf,%r12
+  802420:	00 00 00 
+  802423:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802426:	48 89 df             	mov    %rbx,%rdi
+  802429:	48 b8 a7 19 80 00 00 	movabs $0x8019a7,%rax
+  802430:	00 00 00 
+  802433:	ff d0                	call   *%rax
+  802435:	48 89 c6             	mov    %rax,%rsi
+  802438:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80243d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802442:	41 ff d4             	call   *%r12
+}
+  802445:	5b                   	pop    %rbx
+  802446:	41 5c                	pop    %r12
+  802448:	5d                   	pop    %rbp
+  802449:	c3                   	ret
+
+000000000080244a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80244a:	55                   	push   %rbp
+  80244b:	48 89 e5             	mov    %rsp,%rbp
+  80244e:	41 57                	push   %r15
+  802450:	41 56                	push   %r14
+  802452:	41 55                	push   %r13
+  802454:	41 54                	push   %r12
+  802456:	53                   	push   %rbx
+  802457:	48 83 ec 18          	sub    $0x18,%rsp
+  80245b:	49 89 fc             	mov    %rdi,%r12
+  80245e:	49 89 f5             	mov    %rsi,%r13
+  802461:	49 89 d7             	mov    %rdx,%r15
+  802464:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802468:	48 b8 a7 19 80 00 00 	movabs $0x8019a7,%rax
+  80246f:	00 00 00 
+  802472:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802474:	4d 85 ff             	test   %r15,%r15
+  802477:	0f 84 af 00 00 00    	je     80252c <devpipe_write+0xe2>
+  80247d:	48 89 c3             	mov    %rax,%rbx
+  802480:	4c 89 f8             	mov    %r15,%rax
+  802483:	4d 89 ef             	mov    %r13,%r15
+  802486:	4c 01 e8             	add    %r13,%rax
+  802489:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80248d:	49 bd c7 12 80 00 00 	movabs $0x8012c7,%r13
+  802494:	00 00 00 
+            sys_yield();
+  802497:	49 be 64 12 80 00 00 	movabs $0x801264,%r14
+  80249e:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8024a1:	8b 73 04             	mov    0x4(%rbx),%esi
+  8024a4:	48 63 ce             	movslq %esi,%rcx
+  8024a7:	48 63 03             	movslq (%rbx),%rax
+  8024aa:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8024b0:	48 39 c1             	cmp    %rax,%rcx
+  8024b3:	72 2e                	jb     8024e3 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8024b5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024ba:	48 89 da             	mov    %rbx,%rdx
+  8024bd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8024c2:	4c 89 e7             	mov    %r12,%rdi
+  8024c5:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8024c8:	85 c0                	test   %eax,%eax
+  8024ca:	74 66                	je     802532 <devpipe_write+0xe8>
+            sys_yield();
+  8024cc:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8024cf:	8b 73 04             	mov    0x4(%rbx),%esi
+  8024d2:	48 63 ce             	movslq %esi,%rcx
+  8024d5:	48 63 03             	movslq (%rbx),%rax
+  8024d8:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8024de:	48 39 c1             	cmp    %rax,%rcx
+  8024e1:	73 d2                	jae    8024b5 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8024e3:	41 0f b6 3f          	movzbl (%r15),%edi
+  8024e7:	48 89 ca             	mov    %rcx,%rdx
+  8024ea:	48 c1 ea 03          	shr    $0x3,%rdx
+  8024ee:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8024f5:	08 10 20 
+  8024f8:	48 f7 e2             	mul    %rdx
+  8024fb:	48 c1 ea 06          	shr    $0x6,%rdx
+  8024ff:	48 89 d0             	mov    %rdx,%rax
+  802502:	48 c1 e0 09          	shl    $0x9,%rax
+  802506:	48 29 d0             	sub    %rdx,%rax
+  802509:	48 c1 e0 03          	shl    $0x3,%rax
+  80250d:	48 29 c1             	sub    %rax,%rcx
+  802510:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802515:	83 c6 01             	add    $0x1,%esi
+  802518:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80251b:	49 83 c7 01          	add    $0x1,%r15
+  80251f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802523:	49 39 c7             	cmp    %rax,%r15
+  802526:	0f 85 75 ff ff ff    	jne    8024a1 <devpipe_write+0x57>
+    return n;
+  80252c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802530:	eb 05                	jmp    802537 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802532:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802537:	48 83 c4 18          	add    $0x18,%rsp
+  80253b:	5b                   	pop    %rbx
+  80253c:	41 5c                	pop    %r12
+  80253e:	41 5d                	pop    %r13
+  802540:	41 5e                	pop    %r14
+  802542:	41 5f                	pop    %r15
+  802544:	5d                   	pop    %rbp
+  802545:	c3                   	ret
+
+0000000000802546 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802546:	55                   	push   %rbp
+  802547:	48 89 e5             	mov    %rsp,%rbp
+  80254a:	41 57                	push   %r15
+  80254c:	41 56                	push   %r14
+  80254e:	41 55                	push   %r13
+  802550:	41 54                	push   %r12
+  802552:	53                   	push   %rbx
+  802553:	48 83 ec 18          	sub    $0x18,%rsp
+  802557:	49 89 fc             	mov    %rdi,%r12
+  80255a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80255e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802562:	48 b8 a7 19 80 00 00 	movabs $0x8019a7,%rax
+  802569:	00 00 00 
+  80256c:	ff d0                	call   *%rax
+  80256e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802571:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802577:	49 bd c7 12 80 00 00 	movabs $0x8012c7,%r13
+  80257e:	00 00 00 
+            sys_yield();
+  802581:	49 be 64 12 80 00 00 	movabs $0x801264,%r14
+  802588:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80258b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802590:	74 7d                	je     80260f <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802592:	8b 03                	mov    (%rbx),%eax
+  802594:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802597:	75 26                	jne    8025bf <devpipe_read+0x79>
+            if (i > 0) return i;
+  802599:	4d 85 ff             	test   %r15,%r15
+  80259c:	75 77                	jne    802615 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80259e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025a3:	48 89 da             	mov    %rbx,%rdx
+  8025a6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025ab:	4c 89 e7             	mov    %r12,%rdi
+  8025ae:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025b1:	85 c0                	test   %eax,%eax
+  8025b3:	74 72                	je     802627 <devpipe_read+0xe1>
+            sys_yield();
+  8025b5:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8025b8:	8b 03                	mov    (%rbx),%eax
+  8025ba:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8025bd:	74 df                	je     80259e <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8025bf:	48 63 c8             	movslq %eax,%rcx
+  8025c2:	48 89 ca             	mov    %rcx,%rdx
+  8025c5:	48 c1 ea 03          	shr    $0x3,%rdx
+  8025c9:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8025d0:	08 10 20 
+  8025d3:	48 89 d0             	mov    %rdx,%rax
+  8025d6:	48 f7 e6             	mul    %rsi
+  8025d9:	48 c1 ea 06          	shr    $0x6,%rdx
+  8025dd:	48 89 d0             	mov    %rdx,%rax
+  8025e0:	48 c1 e0 09          	shl    $0x9,%rax
+  8025e4:	48 29 d0             	sub    %rdx,%rax
+  8025e7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8025ee:	00 
+  8025ef:	48 89 c8             	mov    %rcx,%rax
+  8025f2:	48 29 d0             	sub    %rdx,%rax
+  8025f5:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8025fa:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8025fe:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802602:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802605:	49 83 c7 01          	add    $0x1,%r15
+  802609:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80260d:	75 83                	jne    802592 <devpipe_read+0x4c>
+    return n;
+  80260f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802613:	eb 03                	jmp    802618 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802615:	4c 89 f8             	mov    %r15,%rax
+}
+  802618:	48 83 c4 18          	add    $0x18,%rsp
+  80261c:	5b                   	pop    %rbx
+  80261d:	41 5c                	pop    %r12
+  80261f:	41 5d                	pop    %r13
+  802621:	41 5e                	pop    %r14
+  802623:	41 5f                	pop    %r15
+  802625:	5d                   	pop    %rbp
+  802626:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802627:	b8 00 00 00 00       	mov    $0x0,%eax
+  80262c:	eb ea                	jmp    802618 <devpipe_read+0xd2>
+
+000000000080262e <pipe>:
+pipe(int pfd[2]) {
+  80262e:	55                   	push   %rbp
+  80262f:	48 89 e5             	mov    %rsp,%rbp
+  802632:	41 55                	push   %r13
+  802634:	41 54                	push   %r12
+  802636:	53                   	push   %rbx
+  802637:	48 83 ec 18          	sub    $0x18,%rsp
+  80263b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80263e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802642:	48 b8 c3 19 80 00 00 	movabs $0x8019c3,%rax
+  802649:	00 00 00 
+  80264c:	ff d0                	call   *%rax
+  80264e:	89 c3                	mov    %eax,%ebx
+  802650:	85 c0                	test   %eax,%eax
+  802652:	0f 88 a0 01 00 00    	js     8027f8 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802658:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80265d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802662:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802666:	bf 00 00 00 00       	mov    $0x0,%edi
+  80266b:	48 b8 f3 12 80 00 00 	movabs $0x8012f3,%rax
+  802672:	00 00 00 
+  802675:	ff d0                	call   *%rax
+  802677:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802679:	85 c0                	test   %eax,%eax
+  80267b:	0f 88 77 01 00 00    	js     8027f8 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802681:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802685:	48 b8 c3 19 80 00 00 	movabs $0x8019c3,%rax
+  80268c:	00 00 00 
+  80268f:	ff d0                	call   *%rax
+  802691:	89 c3                	mov    %eax,%ebx
+  802693:	85 c0                	test   %eax,%eax
+  802695:	0f 88 43 01 00 00    	js     8027de <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80269b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8026a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026a5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8026a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026ae:	48 b8 f3 12 80 00 00 	movabs $0x8012f3,%rax
+  8026b5:	00 00 00 
+  8026b8:	ff d0                	call   *%rax
+  8026ba:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8026bc:	85 c0                	test   %eax,%eax
+  8026be:	0f 88 1a 01 00 00    	js     8027de <pipe+0x1b0>
+    va = fd2data(fd0);
+  8026c4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8026c8:	48 b8 a7 19 80 00 00 	movabs $0x8019a7,%rax
+  8026cf:	00 00 00 
+  8026d2:	ff d0                	call   *%rax
+  8026d4:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8026d7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8026dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026e1:	48 89 c6             	mov    %rax,%rsi
+  8026e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026e9:	48 b8 f3 12 80 00 00 	movabs $0x8012f3,%rax
+  8026f0:	00 00 00 
+  8026f3:	ff d0                	call   *%rax
+  8026f5:	89 c3                	mov    %eax,%ebx
+  8026f7:	85 c0                	test   %eax,%eax
+  8026f9:	0f 88 c5 00 00 00    	js     8027c4 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8026ff:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802703:	48 b8 a7 19 80 00 00 	movabs $0x8019a7,%rax
+  80270a:	00 00 00 
+  80270d:	ff d0                	call   *%rax
+  80270f:	48 89 c1             	mov    %rax,%rcx
+  802712:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802718:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80271e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802723:	4c 89 ee             	mov    %r13,%rsi
+  802726:	bf 00 00 00 00       	mov    $0x0,%edi
+  80272b:	48 b8 5a 13 80 00 00 	movabs $0x80135a,%rax
+  802732:	00 00 00 
+  802735:	ff d0                	call   *%rax
+  802737:	89 c3                	mov    %eax,%ebx
+  802739:	85 c0                	test   %eax,%eax
+  80273b:	78 6e                	js     8027ab <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80273d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802742:	4c 89 ef             	mov    %r13,%rdi
+  802745:	48 b8 95 12 80 00 00 	movabs $0x801295,%rax
+  80274c:	00 00 00 
+  80274f:	ff d0                	call   *%rax
+  802751:	83 f8 02             	cmp    $0x2,%eax
+  802754:	0f 85 ab 00 00 00    	jne    802805 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80275a:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802761:	00 00 
+  802763:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802767:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802769:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80276d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802774:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802778:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80277a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80277e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802785:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802789:	48 bb 95 19 80 00 00 	movabs $0x801995,%rbx
+  802790:	00 00 00 
+  802793:	ff d3                	call   *%rbx
+  802795:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802799:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80279d:	ff d3                	call   *%rbx
+  80279f:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8027a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027a9:	eb 4d                	jmp    8027f8 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8027ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027b0:	4c 89 ee             	mov    %r13,%rsi
+  8027b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027b8:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  8027bf:	00 00 00 
+  8027c2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8027c4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027c9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027d2:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  8027d9:	00 00 00 
+  8027dc:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8027de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027e3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8027e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027ec:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  8027f3:	00 00 00 
+  8027f6:	ff d0                	call   *%rax
+}
+  8027f8:	89 d8                	mov    %ebx,%eax
+  8027fa:	48 83 c4 18          	add    $0x18,%rsp
+  8027fe:	5b                   	pop    %rbx
+  8027ff:	41 5c                	pop    %r12
+  802801:	41 5d                	pop    %r13
+  802803:	5d                   	pop    %rbp
+  802804:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802805:	48 b9 58 3a 80 00 00 	movabs $0x803a58,%rcx
+  80280c:	00 00 00 
+  80280f:	48 ba 59 33 80 00 00 	movabs $0x803359,%rdx
+  802816:	00 00 00 
+  802819:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80281e:	48 bf 47 3a 80 00 00 	movabs $0x803a47,%rdi
+  802825:	00 00 00 
+  802828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282d:	49 b8 ce 02 80 00 00 	movabs $0x8002ce,%r8
+  802834:	00 00 00 
+  802837:	41 ff d0             	call   *%r8
+
+000000000080283a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80283a:	55                   	push   %rbp
+  80283b:	48 89 e5             	mov    %rsp,%rbp
+  80283e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802842:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802846:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  80284d:	00 00 00 
+  802850:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802852:	85 c0                	test   %eax,%eax
+  802854:	78 35                	js     80288b <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802856:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80285a:	48 b8 a7 19 80 00 00 	movabs $0x8019a7,%rax
+  802861:	00 00 00 
+  802864:	ff d0                	call   *%rax
+  802866:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802869:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80286e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802873:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802877:	48 b8 c7 12 80 00 00 	movabs $0x8012c7,%rax
+  80287e:	00 00 00 
+  802881:	ff d0                	call   *%rax
+  802883:	85 c0                	test   %eax,%eax
+  802885:	0f 94 c0             	sete   %al
+  802888:	0f b6 c0             	movzbl %al,%eax
+}
+  80288b:	c9                   	leave
+  80288c:	c3                   	ret
+
+000000000080288d <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80288d:	48 89 f8             	mov    %rdi,%rax
+  802890:	48 c1 e8 27          	shr    $0x27,%rax
+  802894:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80289b:	01 00 00 
+  80289e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028a2:	f6 c2 01             	test   $0x1,%dl
+  8028a5:	74 6d                	je     802914 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8028a7:	48 89 f8             	mov    %rdi,%rax
+  8028aa:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8028ae:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8028b5:	01 00 00 
+  8028b8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028bc:	f6 c2 01             	test   $0x1,%dl
+  8028bf:	74 62                	je     802923 <get_uvpt_entry+0x96>
+  8028c1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8028c8:	01 00 00 
+  8028cb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028cf:	f6 c2 80             	test   $0x80,%dl
+  8028d2:	75 4f                	jne    802923 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8028d4:	48 89 f8             	mov    %rdi,%rax
+  8028d7:	48 c1 e8 15          	shr    $0x15,%rax
+  8028db:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8028e2:	01 00 00 
+  8028e5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028e9:	f6 c2 01             	test   $0x1,%dl
+  8028ec:	74 44                	je     802932 <get_uvpt_entry+0xa5>
+  8028ee:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8028f5:	01 00 00 
+  8028f8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028fc:	f6 c2 80             	test   $0x80,%dl
+  8028ff:	75 31                	jne    802932 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802901:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802905:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80290c:	01 00 00 
+  80290f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802913:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802914:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80291b:	01 00 00 
+  80291e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802922:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802923:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80292a:	01 00 00 
+  80292d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802931:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802932:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802939:	01 00 00 
+  80293c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802940:	c3                   	ret
+
+0000000000802941 <get_prot>:
+
+int
+get_prot(void *va) {
+  802941:	55                   	push   %rbp
+  802942:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802945:	48 b8 8d 28 80 00 00 	movabs $0x80288d,%rax
+  80294c:	00 00 00 
+  80294f:	ff d0                	call   *%rax
+  802951:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802954:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802959:	89 c1                	mov    %eax,%ecx
+  80295b:	83 c9 04             	or     $0x4,%ecx
+  80295e:	f6 c2 01             	test   $0x1,%dl
+  802961:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802964:	89 c1                	mov    %eax,%ecx
+  802966:	83 c9 02             	or     $0x2,%ecx
+  802969:	f6 c2 02             	test   $0x2,%dl
+  80296c:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80296f:	89 c1                	mov    %eax,%ecx
+  802971:	83 c9 01             	or     $0x1,%ecx
+  802974:	48 85 d2             	test   %rdx,%rdx
+  802977:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80297a:	89 c1                	mov    %eax,%ecx
+  80297c:	83 c9 40             	or     $0x40,%ecx
+  80297f:	f6 c6 04             	test   $0x4,%dh
+  802982:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802985:	5d                   	pop    %rbp
+  802986:	c3                   	ret
+
+0000000000802987 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802987:	55                   	push   %rbp
+  802988:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80298b:	48 b8 8d 28 80 00 00 	movabs $0x80288d,%rax
+  802992:	00 00 00 
+  802995:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802997:	48 c1 e8 06          	shr    $0x6,%rax
+  80299b:	83 e0 01             	and    $0x1,%eax
+}
+  80299e:	5d                   	pop    %rbp
+  80299f:	c3                   	ret
+
+00000000008029a0 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8029a0:	55                   	push   %rbp
+  8029a1:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8029a4:	48 b8 8d 28 80 00 00 	movabs $0x80288d,%rax
+  8029ab:	00 00 00 
+  8029ae:	ff d0                	call   *%rax
+  8029b0:	83 e0 01             	and    $0x1,%eax
+}
+  8029b3:	5d                   	pop    %rbp
+  8029b4:	c3                   	ret
+
+00000000008029b5 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8029b5:	55                   	push   %rbp
+  8029b6:	48 89 e5             	mov    %rsp,%rbp
+  8029b9:	41 57                	push   %r15
+  8029bb:	41 56                	push   %r14
+  8029bd:	41 55                	push   %r13
+  8029bf:	41 54                	push   %r12
+  8029c1:	53                   	push   %rbx
+  8029c2:	48 83 ec 18          	sub    $0x18,%rsp
+  8029c6:	49 89 ff             	mov    %rdi,%r15
+  8029c9:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8029cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  8029d2:	49 bc a0 29 80 00 00 	movabs $0x8029a0,%r12
+  8029d9:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  8029dc:	49 be 41 29 80 00 00 	movabs $0x802941,%r14
+  8029e3:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8029e6:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  8029ed:	00 00 00 
+  8029f0:	eb 0c                	jmp    8029fe <foreach_shared_region+0x49>
+  8029f2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8029f9:	4c 39 eb             	cmp    %r13,%rbx
+  8029fc:	74 38                	je     802a36 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  8029fe:	48 89 df             	mov    %rbx,%rdi
+  802a01:	41 ff d4             	call   *%r12
+  802a04:	84 c0                	test   %al,%al
+  802a06:	74 ea                	je     8029f2 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802a08:	48 89 df             	mov    %rbx,%rdi
+  802a0b:	41 ff d6             	call   *%r14
+  802a0e:	a8 40                	test   $0x40,%al
+  802a10:	74 e0                	je     8029f2 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802a12:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802a19:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802a1d:	48 89 df             	mov    %rbx,%rdi
+  802a20:	41 ff d7             	call   *%r15
+        if (err)
+  802a23:	85 c0                	test   %eax,%eax
+  802a25:	74 cb                	je     8029f2 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802a27:	48 83 c4 18          	add    $0x18,%rsp
+  802a2b:	5b                   	pop    %rbx
+  802a2c:	41 5c                	pop    %r12
+  802a2e:	41 5d                	pop    %r13
+  802a30:	41 5e                	pop    %r14
+  802a32:	41 5f                	pop    %r15
+  802a34:	5d                   	pop    %rbp
+  802a35:	c3                   	ret
+    return 0;
+  802a36:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a3b:	eb ea                	jmp    802a27 <foreach_shared_region+0x72>
+
+0000000000802a3d <_generic_signal_handler>:
+        (es->sa.sa_handler)(es->signo);
+    }
+}
+
+void
+_generic_signal_handler(struct UTrapframe *utf, struct EnqueuedSignal * es) {
+  802a3d:	55                   	push   %rbp
+  802a3e:	48 89 e5             	mov    %rsp,%rbp
+  802a41:	41 55                	push   %r13
+  802a43:	41 54                	push   %r12
+  802a45:	53                   	push   %rbx
+  802a46:	48 83 ec 08          	sub    $0x8,%rsp
+  802a4a:	49 89 fc             	mov    %rdi,%r12
+  802a4d:	48 89 f3             	mov    %rsi,%rbx
+    if (trace_signals)
+        cprintf("signals: env %x: begin generic handler for %d\n", sys_getenvid(), es->signo);
+  802a50:	44 8b 2e             	mov    (%rsi),%r13d
+  802a53:	48 b8 33 12 80 00 00 	movabs $0x801233,%rax
+  802a5a:	00 00 00 
+  802a5d:	ff d0                	call   *%rax
+  802a5f:	89 c6                	mov    %eax,%esi
+  802a61:	44 89 ea             	mov    %r13d,%edx
+  802a64:	48 bf 80 3a 80 00 00 	movabs $0x803a80,%rdi
+  802a6b:	00 00 00 
+  802a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a73:	48 b9 1e 04 80 00 00 	movabs $0x80041e,%rcx
+  802a7a:	00 00 00 
+  802a7d:	ff d1                	call   *%rcx
+    if (es->sa.sa_handler == SIG_DFL) {
+  802a7f:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802a83:	48 85 c0             	test   %rax,%rax
+  802a86:	74 57                	je     802adf <_generic_signal_handler+0xa2>
+    if (es->sa.sa_handler == SIG_IGN) {
+  802a88:	48 83 f8 01          	cmp    $0x1,%rax
+  802a8c:	0f 84 c0 00 00 00    	je     802b52 <_generic_signal_handler+0x115>
+    if (es->sa.sa_flags & SA_SIGINFO) {
+  802a92:	f6 43 14 04          	testb  $0x4,0x14(%rbx)
+  802a96:	0f 84 ea 00 00 00    	je     802b86 <_generic_signal_handler+0x149>
+        (es->sa.sa_sigaction)(es->signo, &(es->info), utf);
+  802a9c:	48 8d 73 18          	lea    0x18(%rbx),%rsi
+  802aa0:	8b 3b                	mov    (%rbx),%edi
+  802aa2:	4c 89 e2             	mov    %r12,%rdx
+  802aa5:	ff d0                	call   *%rax
+
+    _generic_signal_handler_impl(utf, es);
+
+    if (trace_signals)
+        cprintf("signals: env %x: end generic handler for %d\n", sys_getenvid(), es->signo);
+  802aa7:	8b 1b                	mov    (%rbx),%ebx
+  802aa9:	48 b8 33 12 80 00 00 	movabs $0x801233,%rax
+  802ab0:	00 00 00 
+  802ab3:	ff d0                	call   *%rax
+  802ab5:	89 c6                	mov    %eax,%esi
+  802ab7:	89 da                	mov    %ebx,%edx
+  802ab9:	48 bf 08 3b 80 00 00 	movabs $0x803b08,%rdi
+  802ac0:	00 00 00 
+  802ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac8:	48 b9 1e 04 80 00 00 	movabs $0x80041e,%rcx
+  802acf:	00 00 00 
+  802ad2:	ff d1                	call   *%rcx
+}
+  802ad4:	48 83 c4 08          	add    $0x8,%rsp
+  802ad8:	5b                   	pop    %rbx
+  802ad9:	41 5c                	pop    %r12
+  802adb:	41 5d                	pop    %r13
+  802add:	5d                   	pop    %rbp
+  802ade:	c3                   	ret
+            cprintf("signals: env %x: exiting due to signal %d\n", sys_getenvid(), es->signo);
+  802adf:	8b 1b                	mov    (%rbx),%ebx
+  802ae1:	48 b8 33 12 80 00 00 	movabs $0x801233,%rax
+  802ae8:	00 00 00 
+  802aeb:	ff d0                	call   *%rax
+  802aed:	89 c6                	mov    %eax,%esi
+  802aef:	89 da                	mov    %ebx,%edx
+  802af1:	48 bf b0 3a 80 00 00 	movabs $0x803ab0,%rdi
+  802af8:	00 00 00 
+  802afb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b00:	48 b9 1e 04 80 00 00 	movabs $0x80041e,%rcx
+  802b07:	00 00 00 
+  802b0a:	ff d1                	call   *%rcx
+        sys_env_destroy(CURENVID);
+  802b0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b11:	48 b8 c8 11 80 00 00 	movabs $0x8011c8,%rax
+  802b18:	00 00 00 
+  802b1b:	ff d0                	call   *%rax
+        assert(false);
+  802b1d:	48 b9 35 3b 80 00 00 	movabs $0x803b35,%rcx
+  802b24:	00 00 00 
+  802b27:	48 ba 59 33 80 00 00 	movabs $0x803359,%rdx
+  802b2e:	00 00 00 
+  802b31:	be 0c 00 00 00       	mov    $0xc,%esi
+  802b36:	48 bf 3b 3b 80 00 00 	movabs $0x803b3b,%rdi
+  802b3d:	00 00 00 
+  802b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b45:	49 b8 ce 02 80 00 00 	movabs $0x8002ce,%r8
+  802b4c:	00 00 00 
+  802b4f:	41 ff d0             	call   *%r8
+            cprintf("signals: env %x: ignoring signal %d\n", sys_getenvid(), es->signo);
+  802b52:	44 8b 23             	mov    (%rbx),%r12d
+  802b55:	48 b8 33 12 80 00 00 	movabs $0x801233,%rax
+  802b5c:	00 00 00 
+  802b5f:	ff d0                	call   *%rax
+  802b61:	89 c6                	mov    %eax,%esi
+  802b63:	44 89 e2             	mov    %r12d,%edx
+  802b66:	48 bf e0 3a 80 00 00 	movabs $0x803ae0,%rdi
+  802b6d:	00 00 00 
+  802b70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b75:	48 b9 1e 04 80 00 00 	movabs $0x80041e,%rcx
+  802b7c:	00 00 00 
+  802b7f:	ff d1                	call   *%rcx
+        return;
+  802b81:	e9 21 ff ff ff       	jmp    802aa7 <_generic_signal_handler+0x6a>
+        (es->sa.sa_handler)(es->signo);
+  802b86:	8b 3b                	mov    (%rbx),%edi
+  802b88:	ff d0                	call   *%rax
+  802b8a:	e9 18 ff ff ff       	jmp    802aa7 <_generic_signal_handler+0x6a>
+
+0000000000802b8f <sigqueue>:
+
+int sigqueue(pid_t pid, int signo, const union sigval value) {
+  802b8f:	55                   	push   %rbp
+  802b90:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigqueue(pid, signo, value);
+  802b93:	48 b8 f7 16 80 00 00 	movabs $0x8016f7,%rax
+  802b9a:	00 00 00 
+  802b9d:	ff d0                	call   *%rax
+}
+  802b9f:	5d                   	pop    %rbp
+  802ba0:	c3                   	ret
+
+0000000000802ba1 <sigwait>:
+
+int sigwait(const sigset_t * set, int * sig) {
+  802ba1:	55                   	push   %rbp
+  802ba2:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigwait(set, sig);
+  802ba5:	48 b8 5e 17 80 00 00 	movabs $0x80175e,%rax
+  802bac:	00 00 00 
+  802baf:	ff d0                	call   *%rax
+}
+  802bb1:	5d                   	pop    %rbp
+  802bb2:	c3                   	ret
+
+0000000000802bb3 <sigaction>:
+
+extern void _signal_handler_trampoline(void);
+
+int sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  802bb3:	55                   	push   %rbp
+  802bb4:	48 89 e5             	mov    %rsp,%rbp
+  802bb7:	41 55                	push   %r13
+  802bb9:	41 54                	push   %r12
+  802bbb:	53                   	push   %rbx
+  802bbc:	48 83 ec 08          	sub    $0x8,%rsp
+  802bc0:	89 fb                	mov    %edi,%ebx
+  802bc2:	49 89 f4             	mov    %rsi,%r12
+  802bc5:	49 89 d5             	mov    %rdx,%r13
+    int err = sys_env_set_pgfault_upcall(CURENVID, _signal_handler_trampoline);
+  802bc8:	48 be 45 2e 80 00 00 	movabs $0x802e45,%rsi
+  802bcf:	00 00 00 
+  802bd2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bd7:	48 b8 c8 15 80 00 00 	movabs $0x8015c8,%rax
+  802bde:	00 00 00 
+  802be1:	ff d0                	call   *%rax
+    if (err)
+  802be3:	85 c0                	test   %eax,%eax
+  802be5:	74 0b                	je     802bf2 <sigaction+0x3f>
+        return err;
+    return sys_sigaction(sig, act, oact);
+}
+  802be7:	48 83 c4 08          	add    $0x8,%rsp
+  802beb:	5b                   	pop    %rbx
+  802bec:	41 5c                	pop    %r12
+  802bee:	41 5d                	pop    %r13
+  802bf0:	5d                   	pop    %rbp
+  802bf1:	c3                   	ret
+    return sys_sigaction(sig, act, oact);
+  802bf2:	4c 89 ea             	mov    %r13,%rdx
+  802bf5:	4c 89 e6             	mov    %r12,%rsi
+  802bf8:	89 df                	mov    %ebx,%edi
+  802bfa:	48 b8 c7 17 80 00 00 	movabs $0x8017c7,%rax
+  802c01:	00 00 00 
+  802c04:	ff d0                	call   *%rax
+  802c06:	eb df                	jmp    802be7 <sigaction+0x34>
+
+0000000000802c08 <sigprocmask>:
+
+int sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  802c08:	55                   	push   %rbp
+  802c09:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigprocmask(how, set, oldset);
+  802c0c:	48 b8 2e 18 80 00 00 	movabs $0x80182e,%rax
+  802c13:	00 00 00 
+  802c16:	ff d0                	call   *%rax
+}
+  802c18:	5d                   	pop    %rbp
+  802c19:	c3                   	ret
+
+0000000000802c1a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1f:	c3                   	ret
+
+0000000000802c20 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802c20:	55                   	push   %rbp
+  802c21:	48 89 e5             	mov    %rsp,%rbp
+  802c24:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802c27:	48 be 48 3b 80 00 00 	movabs $0x803b48,%rsi
+  802c2e:	00 00 00 
+  802c31:	48 b8 43 0d 80 00 00 	movabs $0x800d43,%rax
+  802c38:	00 00 00 
+  802c3b:	ff d0                	call   *%rax
+    return 0;
+}
+  802c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c42:	5d                   	pop    %rbp
+  802c43:	c3                   	ret
+
+0000000000802c44 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c44:	55                   	push   %rbp
+  802c45:	48 89 e5             	mov    %rsp,%rbp
+  802c48:	41 57                	push   %r15
+  802c4a:	41 56                	push   %r14
+  802c4c:	41 55                	push   %r13
+  802c4e:	41 54                	push   %r12
+  802c50:	53                   	push   %rbx
+  802c51:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802c58:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802c5f:	48 85 d2             	test   %rdx,%rdx
+  802c62:	74 7a                	je     802cde <devcons_write+0x9a>
+  802c64:	49 89 d6             	mov    %rdx,%r14
+  802c67:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802c6d:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802c72:	49 bf 3d 0f 80 00 00 	movabs $0x800f3d,%r15
+  802c79:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802c7c:	4c 89 f3             	mov    %r14,%rbx
+  802c7f:	48 29 f3             	sub    %rsi,%rbx
+  802c82:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802c87:	48 39 c3             	cmp    %rax,%rbx
+  802c8a:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802c8e:	4c 63 eb             	movslq %ebx,%r13
+  802c91:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802c98:	48 01 c6             	add    %rax,%rsi
+  802c9b:	4c 89 ea             	mov    %r13,%rdx
+  802c9e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802ca5:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802ca8:	4c 89 ee             	mov    %r13,%rsi
+  802cab:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802cb2:	48 b8 6a 11 80 00 00 	movabs $0x80116a,%rax
+  802cb9:	00 00 00 
+  802cbc:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802cbe:	41 01 dc             	add    %ebx,%r12d
+  802cc1:	49 63 f4             	movslq %r12d,%rsi
+  802cc4:	4c 39 f6             	cmp    %r14,%rsi
+  802cc7:	72 b3                	jb     802c7c <devcons_write+0x38>
+    return res;
+  802cc9:	49 63 c4             	movslq %r12d,%rax
+}
+  802ccc:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802cd3:	5b                   	pop    %rbx
+  802cd4:	41 5c                	pop    %r12
+  802cd6:	41 5d                	pop    %r13
+  802cd8:	41 5e                	pop    %r14
+  802cda:	41 5f                	pop    %r15
+  802cdc:	5d                   	pop    %rbp
+  802cdd:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802cde:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802ce4:	eb e3                	jmp    802cc9 <devcons_write+0x85>
+
+0000000000802ce6 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ce6:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802ce9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cee:	48 85 c0             	test   %rax,%rax
+  802cf1:	74 55                	je     802d48 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802cf3:	55                   	push   %rbp
+  802cf4:	48 89 e5             	mov    %rsp,%rbp
+  802cf7:	41 55                	push   %r13
+  802cf9:	41 54                	push   %r12
+  802cfb:	53                   	push   %rbx
+  802cfc:	48 83 ec 08          	sub    $0x8,%rsp
+  802d00:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802d03:	48 bb 97 11 80 00 00 	movabs $0x801197,%rbx
+  802d0a:	00 00 00 
+  802d0d:	49 bc 64 12 80 00 00 	movabs $0x801264,%r12
+  802d14:	00 00 00 
+  802d17:	eb 03                	jmp    802d1c <devcons_read+0x36>
+  802d19:	41 ff d4             	call   *%r12
+  802d1c:	ff d3                	call   *%rbx
+  802d1e:	85 c0                	test   %eax,%eax
+  802d20:	74 f7                	je     802d19 <devcons_read+0x33>
+    if (c < 0) return c;
+  802d22:	48 63 d0             	movslq %eax,%rdx
+  802d25:	78 13                	js     802d3a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802d27:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d2c:	83 f8 04             	cmp    $0x4,%eax
+  802d2f:	74 09                	je     802d3a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802d31:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802d35:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802d3a:	48 89 d0             	mov    %rdx,%rax
+  802d3d:	48 83 c4 08          	add    $0x8,%rsp
+  802d41:	5b                   	pop    %rbx
+  802d42:	41 5c                	pop    %r12
+  802d44:	41 5d                	pop    %r13
+  802d46:	5d                   	pop    %rbp
+  802d47:	c3                   	ret
+  802d48:	48 89 d0             	mov    %rdx,%rax
+  802d4b:	c3                   	ret
+
+0000000000802d4c <cputchar>:
+cputchar(int ch) {
+  802d4c:	55                   	push   %rbp
+  802d4d:	48 89 e5             	mov    %rsp,%rbp
+  802d50:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802d54:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802d58:	be 01 00 00 00       	mov    $0x1,%esi
+  802d5d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802d61:	48 b8 6a 11 80 00 00 	movabs $0x80116a,%rax
+  802d68:	00 00 00 
+  802d6b:	ff d0                	call   *%rax
+}
+  802d6d:	c9                   	leave
+  802d6e:	c3                   	ret
+
+0000000000802d6f <getchar>:
+getchar(void) {
+  802d6f:	55                   	push   %rbp
+  802d70:	48 89 e5             	mov    %rsp,%rbp
+  802d73:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802d77:	ba 01 00 00 00       	mov    $0x1,%edx
+  802d7c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802d80:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d85:	48 b8 06 1d 80 00 00 	movabs $0x801d06,%rax
+  802d8c:	00 00 00 
+  802d8f:	ff d0                	call   *%rax
+  802d91:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802d93:	85 c0                	test   %eax,%eax
+  802d95:	78 06                	js     802d9d <getchar+0x2e>
+  802d97:	74 08                	je     802da1 <getchar+0x32>
+  802d99:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802d9d:	89 d0                	mov    %edx,%eax
+  802d9f:	c9                   	leave
+  802da0:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802da1:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802da6:	eb f5                	jmp    802d9d <getchar+0x2e>
+
+0000000000802da8 <iscons>:
+iscons(int fdnum) {
+  802da8:	55                   	push   %rbp
+  802da9:	48 89 e5             	mov    %rsp,%rbp
+  802dac:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802db0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802db4:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  802dbb:	00 00 00 
+  802dbe:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802dc0:	85 c0                	test   %eax,%eax
+  802dc2:	78 18                	js     802ddc <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802dc4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802dc8:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802dcf:	00 00 00 
+  802dd2:	8b 00                	mov    (%rax),%eax
+  802dd4:	39 02                	cmp    %eax,(%rdx)
+  802dd6:	0f 94 c0             	sete   %al
+  802dd9:	0f b6 c0             	movzbl %al,%eax
+}
+  802ddc:	c9                   	leave
+  802ddd:	c3                   	ret
+
+0000000000802dde <opencons>:
+opencons(void) {
+  802dde:	55                   	push   %rbp
+  802ddf:	48 89 e5             	mov    %rsp,%rbp
+  802de2:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802de6:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802dea:	48 b8 c3 19 80 00 00 	movabs $0x8019c3,%rax
+  802df1:	00 00 00 
+  802df4:	ff d0                	call   *%rax
+  802df6:	85 c0                	test   %eax,%eax
+  802df8:	78 49                	js     802e43 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802dfa:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802dff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e04:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802e08:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e0d:	48 b8 f3 12 80 00 00 	movabs $0x8012f3,%rax
+  802e14:	00 00 00 
+  802e17:	ff d0                	call   *%rax
+  802e19:	85 c0                	test   %eax,%eax
+  802e1b:	78 26                	js     802e43 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802e1d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e21:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802e28:	00 00 
+  802e2a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802e2c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802e30:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802e37:	48 b8 95 19 80 00 00 	movabs $0x801995,%rax
+  802e3e:	00 00 00 
+  802e41:	ff d0                	call   *%rax
+}
+  802e43:	c9                   	leave
+  802e44:	c3                   	ret
+
+0000000000802e45 <_pgfault_upcall>:
+.text
+.globl _pgfault_upcall
+.globl _signal_handler_trampoline
+_pgfault_upcall:
+_signal_handler_trampoline:
+    movq  %rsp,%rdi # passing the function argument (UTrapframe *) in rdi
+  802e45:	48 89 e7             	mov    %rsp,%rdi
+    # sizeof(struct EnqueuedSignal) == 56
+    # sizeof(curenv->env_sig_mask) == 4
+    # + 4 bytes of alignment
+    add $64, %rdi
+  802e48:	48 83 c7 40          	add    $0x40,%rdi
+
+    # load signo
+    mov (%rsp), %eax
+  802e4c:	8b 04 24             	mov    (%rsp),%eax
+    test %eax, %eax
+  802e4f:	85 c0                	test   %eax,%eax
+    jnz _call_generic_signal_handler
+  802e51:	75 0e                	jne    802e61 <_call_generic_signal_handler>
+
+    # Call the C page fault handler.
+    movabs $_handle_vectored_pagefault, %rax
+  802e53:	48 b8 85 30 80 00 00 	movabs $0x803085,%rax
+  802e5a:	00 00 00 
+    call *%rax
+  802e5d:	ff d0                	call   *%rax
+    jmp _return_from_handler
+  802e5f:	eb 0f                	jmp    802e70 <_return_from_handler>
+
+0000000000802e61 <_call_generic_signal_handler>:
+
+_call_generic_signal_handler:
+    movq %rsp, %rsi # passing the function argument (EnqueuedSignal *) in rsi
+  802e61:	48 89 e6             	mov    %rsp,%rsi
+    movabs $_generic_signal_handler, %rax
+  802e64:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  802e6b:	00 00 00 
+    call *%rax
+  802e6e:	ff d0                	call   *%rax
+
+0000000000802e70 <_return_from_handler>:
+
+_return_from_handler:
+    # ignore EnqueuedSignal and env_sig_mask
+    add $64, %rsp
+  802e70:	48 83 c4 40          	add    $0x40,%rsp
+    # put SIG_SETMASK as the first func arg
+    movq $3, %rdi
+  802e74:	48 c7 c7 03 00 00 00 	mov    $0x3,%rdi
+    # load &env_sig_mask (as the second func arg)
+    lea -4(%rsp), %rsi
+  802e7b:	48 8d 74 24 fc       	lea    -0x4(%rsp),%rsi
+    # NULL as the third arg
+    xor %rdx, %rdx
+  802e80:	48 31 d2             	xor    %rdx,%rdx
+    # restore blocked signals mask
+    movabs $sys_sigprocmask, %rax
+  802e83:	48 b8 2e 18 80 00 00 	movabs $0x80182e,%rax
+  802e8a:	00 00 00 
+    call *%rax
+  802e8d:	ff d0                	call   *%rax
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    # ignore utf_fault_va, utf_err
+    addq $16, %rsp
+  802e8f:	48 83 c4 10          	add    $0x10,%rsp
+    # restore utf_regs, save rax again
+    POPA
+  802e93:	4c 8b 3c 24          	mov    (%rsp),%r15
+  802e97:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  802e9c:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  802ea1:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  802ea6:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  802eab:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  802eb0:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  802eb5:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  802eba:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  802ebf:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  802ec4:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  802ec9:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  802ece:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  802ed3:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  802ed8:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  802edd:	48 83 c4 78          	add    $0x78,%rsp
+    pushq %rax
+  802ee1:	50                   	push   %rax
+    # 16 utf_rflags
+    #  8 utf_rip
+    #  0 rax
+
+    # load utf_rip
+    movq 8(%rsp), %rax
+  802ee2:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    # save rbx to utf_rip
+    movq %rbx, 8(%rsp)
+  802ee7:	48 89 5c 24 08       	mov    %rbx,0x8(%rsp)
+    # load utf_rsp
+    movq 24(%rsp), %rbx
+  802eec:	48 8b 5c 24 18       	mov    0x18(%rsp),%rbx
+    # store return address to *utf_stack
+    subq $8, 24(%rsp)
+  802ef1:	48 83 6c 24 18 08    	subq   $0x8,0x18(%rsp)
+    movq %rax, -8(%rbx)
+  802ef7:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    # restore rax and rbx
+    popq %rax
+  802efb:	58                   	pop    %rax
+    popq %rbx
+  802efc:	5b                   	pop    %rbx
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+    popfq
+  802efd:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    popq %rsp
+  802efe:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  802eff:	c3                   	ret
+
+0000000000802f00 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802f00:	55                   	push   %rbp
+  802f01:	48 89 e5             	mov    %rsp,%rbp
+  802f04:	41 54                	push   %r12
+  802f06:	53                   	push   %rbx
+  802f07:	48 89 fb             	mov    %rdi,%rbx
+  802f0a:	48 89 f7             	mov    %rsi,%rdi
+  802f0d:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802f10:	48 85 f6             	test   %rsi,%rsi
+  802f13:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f1a:	00 00 00 
+  802f1d:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802f21:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f26:	48 b8 5d 16 80 00 00 	movabs $0x80165d,%rax
+  802f2d:	00 00 00 
+  802f30:	ff d0                	call   *%rax
+    if (res < 0) {
+  802f32:	85 c0                	test   %eax,%eax
+  802f34:	78 45                	js     802f7b <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802f36:	48 85 db             	test   %rbx,%rbx
+  802f39:	74 12                	je     802f4d <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802f3b:	48 a1 10 50 80 00 00 	movabs 0x805010,%rax
+  802f42:	00 00 00 
+  802f45:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802f4b:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802f4d:	4d 85 e4             	test   %r12,%r12
+  802f50:	74 14                	je     802f66 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802f52:	48 a1 10 50 80 00 00 	movabs 0x805010,%rax
+  802f59:	00 00 00 
+  802f5c:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802f62:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802f66:	48 a1 10 50 80 00 00 	movabs 0x805010,%rax
+  802f6d:	00 00 00 
+  802f70:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802f76:	5b                   	pop    %rbx
+  802f77:	41 5c                	pop    %r12
+  802f79:	5d                   	pop    %rbp
+  802f7a:	c3                   	ret
+        if (from_env_store)
+  802f7b:	48 85 db             	test   %rbx,%rbx
+  802f7e:	74 06                	je     802f86 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802f80:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802f86:	4d 85 e4             	test   %r12,%r12
+  802f89:	74 eb                	je     802f76 <ipc_recv+0x76>
+            *perm_store = 0;
+  802f8b:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802f92:	00 
+  802f93:	eb e1                	jmp    802f76 <ipc_recv+0x76>
+
+0000000000802f95 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802f95:	55                   	push   %rbp
+  802f96:	48 89 e5             	mov    %rsp,%rbp
+  802f99:	41 57                	push   %r15
+  802f9b:	41 56                	push   %r14
+  802f9d:	41 55                	push   %r13
+  802f9f:	41 54                	push   %r12
+  802fa1:	53                   	push   %rbx
+  802fa2:	48 83 ec 18          	sub    $0x18,%rsp
+  802fa6:	41 89 fd             	mov    %edi,%r13d
+  802fa9:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802fac:	48 89 d3             	mov    %rdx,%rbx
+  802faf:	49 89 cc             	mov    %rcx,%r12
+  802fb2:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802fb6:	48 85 d2             	test   %rdx,%rdx
+  802fb9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802fc0:	00 00 00 
+  802fc3:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802fc7:	49 be 31 16 80 00 00 	movabs $0x801631,%r14
+  802fce:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802fd1:	49 bf 64 12 80 00 00 	movabs $0x801264,%r15
+  802fd8:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802fdb:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802fde:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802fe2:	4c 89 e1             	mov    %r12,%rcx
+  802fe5:	48 89 da             	mov    %rbx,%rdx
+  802fe8:	44 89 ef             	mov    %r13d,%edi
+  802feb:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802fee:	85 c0                	test   %eax,%eax
+  802ff0:	74 34                	je     803026 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802ff2:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802ff5:	75 05                	jne    802ffc <ipc_send+0x67>
+        sys_yield();
+  802ff7:	41 ff d7             	call   *%r15
+    while (true) {
+  802ffa:	eb df                	jmp    802fdb <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802ffc:	48 ba 54 3b 80 00 00 	movabs $0x803b54,%rdx
+  803003:	00 00 00 
+  803006:	be 3e 00 00 00       	mov    $0x3e,%esi
+  80300b:	48 bf 6d 3b 80 00 00 	movabs $0x803b6d,%rdi
+  803012:	00 00 00 
+  803015:	b8 00 00 00 00       	mov    $0x0,%eax
+  80301a:	48 b9 ce 02 80 00 00 	movabs $0x8002ce,%rcx
+  803021:	00 00 00 
+  803024:	ff d1                	call   *%rcx
+    }
+}
+  803026:	48 83 c4 18          	add    $0x18,%rsp
+  80302a:	5b                   	pop    %rbx
+  80302b:	41 5c                	pop    %r12
+  80302d:	41 5d                	pop    %r13
+  80302f:	41 5e                	pop    %r14
+  803031:	41 5f                	pop    %r15
+  803033:	5d                   	pop    %rbp
+  803034:	c3                   	ret
+
+0000000000803035 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803035:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80303a:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803041:	00 00 00 
+  803044:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  80304b:	48 01 ca             	add    %rcx,%rdx
+  80304e:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803054:	39 fa                	cmp    %edi,%edx
+  803056:	74 12                	je     80306a <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803058:	48 83 c0 01          	add    $0x1,%rax
+  80305c:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  803062:	75 e0                	jne    803044 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803064:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803069:	c3                   	ret
+            return envs[i].env_id;
+  80306a:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  803071:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803078:	00 00 00 
+  80307b:	48 01 d0             	add    %rdx,%rax
+  80307e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803084:	c3                   	ret
+
+0000000000803085 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  803085:	55                   	push   %rbp
+  803086:	48 89 e5             	mov    %rsp,%rbp
+  803089:	41 56                	push   %r14
+  80308b:	41 55                	push   %r13
+  80308d:	41 54                	push   %r12
+  80308f:	53                   	push   %rbx
+  803090:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803093:	48 b8 68 70 80 00 00 	movabs $0x807068,%rax
+  80309a:	00 00 00 
+  80309d:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8030a1:	74 27                	je     8030ca <_handle_vectored_pagefault+0x45>
+  8030a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8030a8:	49 bd 20 70 80 00 00 	movabs $0x807020,%r13
+  8030af:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8030b2:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8030b5:	4c 89 e7             	mov    %r12,%rdi
+  8030b8:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8030bd:	84 c0                	test   %al,%al
+  8030bf:	75 45                	jne    803106 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8030c1:	48 83 c3 01          	add    $0x1,%rbx
+  8030c5:	49 3b 1e             	cmp    (%r14),%rbx
+  8030c8:	72 eb                	jb     8030b5 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8030ca:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8030d1:	00 
+  8030d2:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8030d7:	4d 8b 04 24          	mov    (%r12),%r8
+  8030db:	48 ba 78 3b 80 00 00 	movabs $0x803b78,%rdx
+  8030e2:	00 00 00 
+  8030e5:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8030ea:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  8030f1:	00 00 00 
+  8030f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f9:	49 ba ce 02 80 00 00 	movabs $0x8002ce,%r10
+  803100:	00 00 00 
+  803103:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  803106:	5b                   	pop    %rbx
+  803107:	41 5c                	pop    %r12
+  803109:	41 5d                	pop    %r13
+  80310b:	41 5e                	pop    %r14
+  80310d:	5d                   	pop    %rbp
+  80310e:	c3                   	ret
+
+000000000080310f <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80310f:	55                   	push   %rbp
+  803110:	48 89 e5             	mov    %rsp,%rbp
+  803113:	53                   	push   %rbx
+  803114:	48 83 ec 08          	sub    $0x8,%rsp
+  803118:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80311b:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  803122:	00 00 00 
+  803125:	80 38 00             	cmpb   $0x0,(%rax)
+  803128:	74 61                	je     80318b <add_pgfault_handler+0x7c>
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80312a:	48 b8 68 70 80 00 00 	movabs $0x807068,%rax
+  803131:	00 00 00 
+  803134:	48 8b 10             	mov    (%rax),%rdx
+  803137:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80313c:	48 b9 20 70 80 00 00 	movabs $0x807020,%rcx
+  803143:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803146:	48 85 d2             	test   %rdx,%rdx
+  803149:	74 19                	je     803164 <add_pgfault_handler+0x55>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80314b:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80314f:	74 2f                	je     803180 <add_pgfault_handler+0x71>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803151:	48 83 c0 01          	add    $0x1,%rax
+  803155:	48 39 d0             	cmp    %rdx,%rax
+  803158:	75 f1                	jne    80314b <add_pgfault_handler+0x3c>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80315a:	48 83 fa 08          	cmp    $0x8,%rdx
+  80315e:	0f 84 f7 00 00 00    	je     80325b <add_pgfault_handler+0x14c>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  803164:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  803168:	48 a3 68 70 80 00 00 	movabs %rax,0x807068
+  80316f:	00 00 00 
+  803172:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  803179:	00 00 00 
+  80317c:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  803180:	b8 00 00 00 00       	mov    $0x0,%eax
+  803185:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803189:	c9                   	leave
+  80318a:	c3                   	ret
+        if (sys_alloc_region(CURENVID, ues_beg, PAGE_SIZE, PROT_RW))
+  80318b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803190:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803195:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80319c:	00 00 00 
+  80319f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031a4:	48 b8 f3 12 80 00 00 	movabs $0x8012f3,%rax
+  8031ab:	00 00 00 
+  8031ae:	ff d0                	call   *%rax
+  8031b0:	85 c0                	test   %eax,%eax
+  8031b2:	75 53                	jne    803207 <add_pgfault_handler+0xf8>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8031b4:	48 ba 68 70 80 00 00 	movabs $0x807068,%rdx
+  8031bb:	00 00 00 
+  8031be:	48 8b 02             	mov    (%rdx),%rax
+  8031c1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8031c5:	48 89 0a             	mov    %rcx,(%rdx)
+  8031c8:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8031cf:	00 00 00 
+  8031d2:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        if (sys_env_set_pgfault_upcall(CURENVID, _pgfault_upcall))
+  8031d6:	48 be 45 2e 80 00 00 	movabs $0x802e45,%rsi
+  8031dd:	00 00 00 
+  8031e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031e5:	48 b8 c8 15 80 00 00 	movabs $0x8015c8,%rax
+  8031ec:	00 00 00 
+  8031ef:	ff d0                	call   *%rax
+  8031f1:	85 c0                	test   %eax,%eax
+  8031f3:	75 3c                	jne    803231 <add_pgfault_handler+0x122>
+        _pfhandler_inititiallized = 1;
+  8031f5:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  8031fc:	00 00 00 
+  8031ff:	c6 00 01             	movb   $0x1,(%rax)
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803202:	e9 79 ff ff ff       	jmp    803180 <add_pgfault_handler+0x71>
+            panic("add_pgfault_handler: sys_alloc_region failed");
+  803207:	48 ba a8 3b 80 00 00 	movabs $0x803ba8,%rdx
+  80320e:	00 00 00 
+  803211:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803216:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  80321d:	00 00 00 
+  803220:	b8 00 00 00 00       	mov    $0x0,%eax
+  803225:	48 b9 ce 02 80 00 00 	movabs $0x8002ce,%rcx
+  80322c:	00 00 00 
+  80322f:	ff d1                	call   *%rcx
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+  803231:	48 ba d8 3b 80 00 00 	movabs $0x803bd8,%rdx
+  803238:	00 00 00 
+  80323b:	be 32 00 00 00       	mov    $0x32,%esi
+  803240:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  803247:	00 00 00 
+  80324a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80324f:	48 b9 ce 02 80 00 00 	movabs $0x8002ce,%rcx
+  803256:	00 00 00 
+  803259:	ff d1                	call   *%rcx
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80325b:	b9 fd ff ff ff       	mov    $0xfffffffd,%ecx
+  803260:	48 ba 1d 3c 80 00 00 	movabs $0x803c1d,%rdx
+  803267:	00 00 00 
+  80326a:	be 40 00 00 00       	mov    $0x40,%esi
+  80326f:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  803276:	00 00 00 
+  803279:	b8 00 00 00 00       	mov    $0x0,%eax
+  80327e:	49 b8 ce 02 80 00 00 	movabs $0x8002ce,%r8
+  803285:	00 00 00 
+  803288:	41 ff d0             	call   *%r8
+
+000000000080328b <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80328b:	55                   	push   %rbp
+  80328c:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80328f:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  803296:	00 00 00 
+  803299:	80 38 00             	cmpb   $0x0,(%rax)
+  80329c:	74 33                	je     8032d1 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80329e:	48 a1 68 70 80 00 00 	movabs 0x807068,%rax
+  8032a5:	00 00 00 
+  8032a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8032ad:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8032b4:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8032b7:	48 85 c0             	test   %rax,%rax
+  8032ba:	0f 84 85 00 00 00    	je     803345 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8032c0:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8032c4:	74 40                	je     803306 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8032c6:	48 83 c1 01          	add    $0x1,%rcx
+  8032ca:	48 39 c1             	cmp    %rax,%rcx
+  8032cd:	75 f1                	jne    8032c0 <remove_pgfault_handler+0x35>
+  8032cf:	eb 74                	jmp    803345 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8032d1:	48 b9 35 3c 80 00 00 	movabs $0x803c35,%rcx
+  8032d8:	00 00 00 
+  8032db:	48 ba 59 33 80 00 00 	movabs $0x803359,%rdx
+  8032e2:	00 00 00 
+  8032e5:	be 46 00 00 00       	mov    $0x46,%esi
+  8032ea:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  8032f1:	00 00 00 
+  8032f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f9:	49 b8 ce 02 80 00 00 	movabs $0x8002ce,%r8
+  803300:	00 00 00 
+  803303:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  803306:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80330d:	00 
+  80330e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803312:	48 29 ca             	sub    %rcx,%rdx
+  803315:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  80331c:	00 00 00 
+  80331f:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  803323:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  803328:	48 89 ce             	mov    %rcx,%rsi
+  80332b:	48 b8 3d 0f 80 00 00 	movabs $0x800f3d,%rax
+  803332:	00 00 00 
+  803335:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  803337:	48 b8 68 70 80 00 00 	movabs $0x807068,%rax
+  80333e:	00 00 00 
+  803341:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  803345:	5d                   	pop    %rbp
+  803346:	c3                   	ret
+  803347:	90                   	nop
+
+0000000000803348 <__rodata_start>:
+  803348:	73 69                	jae    8033b3 <__rodata_start+0x6b>
+  80334a:	67 6e                	outsb  %ds:(%esi),(%dx)
+  80334c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80334d:	20 3d 3d 20 53 49    	and    %bh,0x4953203d(%rip)        # 49d35390 <__bss_end+0x4952d390>
+  803353:	47 55                	rex.RXB push %r13
+  803355:	53                   	push   %rbx
+  803356:	52                   	push   %rdx
+  803357:	31 00                	xor    %eax,(%rax)
+  803359:	61                   	(bad)
+  80335a:	73 73                	jae    8033cf <__rodata_start+0x87>
+  80335c:	65 72 74             	gs jb  8033d3 <__rodata_start+0x8b>
+  80335f:	69 6f 6e 20 66 61 69 	imul   $0x69616620,0x6e(%rdi),%ebp
+  803366:	6c                   	insb   (%dx),%es:(%rdi)
+  803367:	65 64 3a 20          	gs cmp %fs:(%rax),%ah
+  80336b:	25 73 00 75 73       	and    $0x73750073,%eax
+  803370:	65 72 2f             	gs jb  8033a2 <__rodata_start+0x5a>
+  803373:	70 69                	jo     8033de <__rodata_start+0x96>
+  803375:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803376:	67 70 6f             	addr32 jo 8033e8 <__rodata_start+0xa0>
+  803379:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80337a:	67 73 69             	addr32 jae 8033e6 <__rodata_start+0x9e>
+  80337d:	67 2e 63 00          	cs movsxd (%eax),%eax
+  803381:	73 65                	jae    8033e8 <__rodata_start+0xa0>
+  803383:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803384:	64 20 30             	and    %dh,%fs:(%rax)
+  803387:	20 66 72             	and    %ah,0x72(%rsi)
+  80338a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80338b:	6d                   	insl   (%dx),%es:(%rdi)
+  80338c:	20 25 78 20 74 6f    	and    %ah,0x6f742078(%rip)        # 6ff4540a <__bss_end+0x6f73d40a>
+  803392:	20 25 78 0a 00 25    	and    %ah,0x25000a78(%rip)        # 25803e10 <__bss_end+0x24ffbe10>
+  803398:	78 20                	js     8033ba <__rodata_start+0x72>
+  80339a:	67 6f                	outsl  %ds:(%esi),(%dx)
+  80339c:	74 20                	je     8033be <__rodata_start+0x76>
+  80339e:	25 64 20 66 72       	and    $0x72662064,%eax
+  8033a3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033a4:	6d                   	insl   (%dx),%es:(%rdi)
+  8033a5:	20 25 78 0a 00 3c    	and    %ah,0x3c000a78(%rip)        # 3c803e23 <__bss_end+0x3bffbe23>
+  8033ab:	75 6e                	jne    80341b <__rodata_start+0xd3>
+  8033ad:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8033b1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033b2:	3e 00 0f             	ds add %cl,(%rdi)
+  8033b5:	1f                   	(bad)
+  8033b6:	40 00 5b 25          	rex add %bl,0x25(%rbx)
+  8033ba:	30 38                	xor    %bh,(%rax)
+  8033bc:	78 5d                	js     80341b <__rodata_start+0xd3>
+  8033be:	20 75 73             	and    %dh,0x73(%rbp)
+  8033c1:	65 72 20             	gs jb  8033e4 <__rodata_start+0x9c>
+  8033c4:	70 61                	jo     803427 <__rodata_start+0xdf>
+  8033c6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033c7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  8033ce:	73 20                	jae    8033f0 <__rodata_start+0xa8>
+  8033d0:	61                   	(bad)
+  8033d1:	74 20                	je     8033f3 <__rodata_start+0xab>
+  8033d3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  8033d8:	3a 20                	cmp    (%rax),%ah
+  8033da:	00 30                	add    %dh,(%rax)
+  8033dc:	31 32                	xor    %esi,(%rdx)
+  8033de:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8033e5:	41                   	rex.B
+  8033e6:	42                   	rex.X
+  8033e7:	43                   	rex.XB
+  8033e8:	44                   	rex.R
+  8033e9:	45                   	rex.RB
+  8033ea:	46 00 30             	rex.RX add %r14b,(%rax)
+  8033ed:	31 32                	xor    %esi,(%rdx)
+  8033ef:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8033f6:	61                   	(bad)
+  8033f7:	62 63 64 65 66       	(bad)
+  8033fc:	00 28                	add    %ch,(%rax)
+  8033fe:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033ff:	75 6c                	jne    80346d <__rodata_start+0x125>
+  803401:	6c                   	insb   (%dx),%es:(%rdi)
+  803402:	29 00                	sub    %eax,(%rax)
+  803404:	65 72 72             	gs jb  803479 <__rodata_start+0x131>
+  803407:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803408:	72 20                	jb     80342a <__rodata_start+0xe2>
+  80340a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80340f:	73 70                	jae    803481 <__rodata_start+0x139>
+  803411:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803415:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80341c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80341d:	72 00                	jb     80341f <__rodata_start+0xd7>
+  80341f:	62 61 64 20 65       	(bad)
+  803424:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803425:	76 69                	jbe    803490 <__rodata_start+0x148>
+  803427:	72 6f                	jb     803498 <__rodata_start+0x150>
+  803429:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80342a:	6d                   	insl   (%dx),%es:(%rdi)
+  80342b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80342d:	74 00                	je     80342f <__rodata_start+0xe7>
+  80342f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803436:	20 70 61             	and    %dh,0x61(%rax)
+  803439:	72 61                	jb     80349c <__rodata_start+0x154>
+  80343b:	6d                   	insl   (%dx),%es:(%rdi)
+  80343c:	65 74 65             	gs je  8034a4 <__rodata_start+0x15c>
+  80343f:	72 00                	jb     803441 <__rodata_start+0xf9>
+  803441:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803442:	75 74                	jne    8034b8 <__rodata_start+0x170>
+  803444:	20 6f 66             	and    %ch,0x66(%rdi)
+  803447:	20 6d 65             	and    %ch,0x65(%rbp)
+  80344a:	6d                   	insl   (%dx),%es:(%rdi)
+  80344b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80344c:	72 79                	jb     8034c7 <__rodata_start+0x17f>
+  80344e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803451:	74 20                	je     803473 <__rodata_start+0x12b>
+  803453:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803454:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803458:	76 69                	jbe    8034c3 <__rodata_start+0x17b>
+  80345a:	72 6f                	jb     8034cb <__rodata_start+0x183>
+  80345c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80345d:	6d                   	insl   (%dx),%es:(%rdi)
+  80345e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803460:	74 73                	je     8034d5 <__rodata_start+0x18d>
+  803462:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803465:	72 72                	jb     8034d9 <__rodata_start+0x191>
+  803467:	75 70                	jne    8034d9 <__rodata_start+0x191>
+  803469:	74 65                	je     8034d0 <__rodata_start+0x188>
+  80346b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803470:	75 67                	jne    8034d9 <__rodata_start+0x191>
+  803472:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803475:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803477:	00 73 65             	add    %dh,0x65(%rbx)
+  80347a:	67 6d                	insl   (%dx),%es:(%edi)
+  80347c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80347e:	74 61                	je     8034e1 <__rodata_start+0x199>
+  803480:	74 69                	je     8034eb <__rodata_start+0x1a3>
+  803482:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803483:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803484:	20 66 61             	and    %ah,0x61(%rsi)
+  803487:	75 6c                	jne    8034f5 <__rodata_start+0x1ad>
+  803489:	74 00                	je     80348b <__rodata_start+0x143>
+  80348b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803492:	20 45 4c             	and    %al,0x4c(%rbp)
+  803495:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803499:	61                   	(bad)
+  80349a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80349f:	20 73 75             	and    %dh,0x75(%rbx)
+  8034a2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8034a5:	73 79                	jae    803520 <__rodata_start+0x1d8>
+  8034a7:	73 74                	jae    80351d <__rodata_start+0x1d5>
+  8034a9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8034ab:	20 63 61             	and    %ah,0x61(%rbx)
+  8034ae:	6c                   	insb   (%dx),%es:(%rdi)
+  8034af:	6c                   	insb   (%dx),%es:(%rdi)
+  8034b0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8034b3:	74 72                	je     803527 <__rodata_start+0x1df>
+  8034b5:	79 20                	jns    8034d7 <__rodata_start+0x18f>
+  8034b7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8034b8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8034b9:	74 20                	je     8034db <__rodata_start+0x193>
+  8034bb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8034bd:	75 6e                	jne    80352d <__rodata_start+0x1e5>
+  8034bf:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8034c3:	76 20                	jbe    8034e5 <__rodata_start+0x19d>
+  8034c5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8034cc:	72 65                	jb     803533 <__rodata_start+0x1eb>
+  8034ce:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8034d1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8034d2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8034d6:	65 78 70             	gs js  803549 <__rodata_start+0x201>
+  8034d9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8034de:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8034e1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8034e5:	20 66 69             	and    %ah,0x69(%rsi)
+  8034e8:	6c                   	insb   (%dx),%es:(%rdi)
+  8034e9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8034ed:	20 66 72             	and    %ah,0x72(%rsi)
+  8034f0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8034f5:	61                   	(bad)
+  8034f6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8034f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8034fa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8034fb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8034ff:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803502:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803503:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803504:	20 6d 61             	and    %ch,0x61(%rbp)
+  803507:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803508:	79 20                	jns    80352a <__rodata_start+0x1e2>
+  80350a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803511:	72 65                	jb     803578 <__rodata_start+0x230>
+  803513:	20 6f 70             	and    %ch,0x70(%rdi)
+  803516:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803518:	00 66 69             	add    %ah,0x69(%rsi)
+  80351b:	6c                   	insb   (%dx),%es:(%rdi)
+  80351c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803520:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803523:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803524:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803527:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803528:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803529:	74 20                	je     80354b <__rodata_start+0x203>
+  80352b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80352d:	75 6e                	jne    80359d <__rodata_start+0x255>
+  80352f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803533:	76 61                	jbe    803596 <__rodata_start+0x24e>
+  803535:	6c                   	insb   (%dx),%es:(%rdi)
+  803536:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80353d:	00 
+  80353e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803545:	72 65                	jb     8035ac <__rodata_start+0x264>
+  803547:	61                   	(bad)
+  803548:	64 79 20             	fs jns 80356b <__rodata_start+0x223>
+  80354b:	65 78 69             	gs js  8035b7 <__rodata_start+0x26f>
+  80354e:	73 74                	jae    8035c4 <__rodata_start+0x27c>
+  803550:	73 00                	jae    803552 <__rodata_start+0x20a>
+  803552:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803553:	70 65                	jo     8035ba <__rodata_start+0x272>
+  803555:	72 61                	jb     8035b8 <__rodata_start+0x270>
+  803557:	74 69                	je     8035c2 <__rodata_start+0x27a>
+  803559:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80355a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80355b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80355e:	74 20                	je     803580 <__rodata_start+0x238>
+  803560:	73 75                	jae    8035d7 <__rodata_start+0x28f>
+  803562:	70 70                	jo     8035d4 <__rodata_start+0x28c>
+  803564:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803565:	72 74                	jb     8035db <__rodata_start+0x293>
+  803567:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  80356c:	65 72 61             	gs jb  8035d0 <__rodata_start+0x288>
+  80356f:	74 69                	je     8035da <__rodata_start+0x292>
+  803571:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803572:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803573:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803576:	74 20                	je     803598 <__rodata_start+0x250>
+  803578:	70 65                	jo     8035df <__rodata_start+0x297>
+  80357a:	72 6d                	jb     8035e9 <__rodata_start+0x2a1>
+  80357c:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  803583:	2e 
+  803584:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80358b:	00 
+  80358c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803593:	00 00 00 
+  803596:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80359d:	00 00 00 
+  8035a0:	0b 06                	or     (%rsi),%eax
+  8035a2:	80 00 00             	addb   $0x0,(%rax)
+  8035a5:	00 00                	add    %al,(%rax)
+  8035a7:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8035ab:	00 00                	add    %al,(%rax)
+  8035ad:	00 00                	add    %al,(%rax)
+  8035af:	00 3c 0c             	add    %bh,(%rsp,%rcx,1)
+  8035b2:	80 00 00             	addb   $0x0,(%rax)
+  8035b5:	00 00                	add    %al,(%rax)
+  8035b7:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8035bb:	00 00                	add    %al,(%rax)
+  8035bd:	00 00                	add    %al,(%rax)
+  8035bf:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8035c3:	00 00                	add    %al,(%rax)
+  8035c5:	00 00                	add    %al,(%rax)
+  8035c7:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8035cb:	00 00                	add    %al,(%rax)
+  8035cd:	00 00                	add    %al,(%rax)
+  8035cf:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8035d3:	00 00                	add    %al,(%rax)
+  8035d5:	00 00                	add    %al,(%rax)
+  8035d7:	00 2a                	add    %ch,(%rdx)
+  8035d9:	06                   	(bad)
+  8035da:	80 00 00             	addb   $0x0,(%rax)
+  8035dd:	00 00                	add    %al,(%rax)
+  8035df:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8035e3:	00 00                	add    %al,(%rax)
+  8035e5:	00 00                	add    %al,(%rax)
+  8035e7:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8035eb:	00 00                	add    %al,(%rax)
+  8035ed:	00 00                	add    %al,(%rax)
+  8035ef:	00 1e                	add    %bl,(%rsi)
+  8035f1:	06                   	(bad)
+  8035f2:	80 00 00             	addb   $0x0,(%rax)
+  8035f5:	00 00                	add    %al,(%rax)
+  8035f7:	00 98 06 80 00 00    	add    %bl,0x8006(%rax)
+  8035fd:	00 00                	add    %al,(%rax)
+  8035ff:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803603:	00 00                	add    %al,(%rax)
+  803605:	00 00                	add    %al,(%rax)
+  803607:	00 1e                	add    %bl,(%rsi)
+  803609:	06                   	(bad)
+  80360a:	80 00 00             	addb   $0x0,(%rax)
+  80360d:	00 00                	add    %al,(%rax)
+  80360f:	00 64 06 80          	add    %ah,-0x80(%rsi,%rax,1)
+  803613:	00 00                	add    %al,(%rax)
+  803615:	00 00                	add    %al,(%rax)
+  803617:	00 64 06 80          	add    %ah,-0x80(%rsi,%rax,1)
+  80361b:	00 00                	add    %al,(%rax)
+  80361d:	00 00                	add    %al,(%rax)
+  80361f:	00 64 06 80          	add    %ah,-0x80(%rsi,%rax,1)
+  803623:	00 00                	add    %al,(%rax)
+  803625:	00 00                	add    %al,(%rax)
+  803627:	00 64 06 80          	add    %ah,-0x80(%rsi,%rax,1)
+  80362b:	00 00                	add    %al,(%rax)
+  80362d:	00 00                	add    %al,(%rax)
+  80362f:	00 64 06 80          	add    %ah,-0x80(%rsi,%rax,1)
+  803633:	00 00                	add    %al,(%rax)
+  803635:	00 00                	add    %al,(%rax)
+  803637:	00 64 06 80          	add    %ah,-0x80(%rsi,%rax,1)
+  80363b:	00 00                	add    %al,(%rax)
+  80363d:	00 00                	add    %al,(%rax)
+  80363f:	00 64 06 80          	add    %ah,-0x80(%rsi,%rax,1)
+  803643:	00 00                	add    %al,(%rax)
+  803645:	00 00                	add    %al,(%rax)
+  803647:	00 64 06 80          	add    %ah,-0x80(%rsi,%rax,1)
+  80364b:	00 00                	add    %al,(%rax)
+  80364d:	00 00                	add    %al,(%rax)
+  80364f:	00 64 06 80          	add    %ah,-0x80(%rsi,%rax,1)
+  803653:	00 00                	add    %al,(%rax)
+  803655:	00 00                	add    %al,(%rax)
+  803657:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80365b:	00 00                	add    %al,(%rax)
+  80365d:	00 00                	add    %al,(%rax)
+  80365f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803663:	00 00                	add    %al,(%rax)
+  803665:	00 00                	add    %al,(%rax)
+  803667:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80366b:	00 00                	add    %al,(%rax)
+  80366d:	00 00                	add    %al,(%rax)
+  80366f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803673:	00 00                	add    %al,(%rax)
+  803675:	00 00                	add    %al,(%rax)
+  803677:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80367b:	00 00                	add    %al,(%rax)
+  80367d:	00 00                	add    %al,(%rax)
+  80367f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803683:	00 00                	add    %al,(%rax)
+  803685:	00 00                	add    %al,(%rax)
+  803687:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80368b:	00 00                	add    %al,(%rax)
+  80368d:	00 00                	add    %al,(%rax)
+  80368f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803693:	00 00                	add    %al,(%rax)
+  803695:	00 00                	add    %al,(%rax)
+  803697:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80369b:	00 00                	add    %al,(%rax)
+  80369d:	00 00                	add    %al,(%rax)
+  80369f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8036a3:	00 00                	add    %al,(%rax)
+  8036a5:	00 00                	add    %al,(%rax)
+  8036a7:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8036ab:	00 00                	add    %al,(%rax)
+  8036ad:	00 00                	add    %al,(%rax)
+  8036af:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8036b3:	00 00                	add    %al,(%rax)
+  8036b5:	00 00                	add    %al,(%rax)
+  8036b7:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8036bb:	00 00                	add    %al,(%rax)
+  8036bd:	00 00                	add    %al,(%rax)
+  8036bf:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8036c3:	00 00                	add    %al,(%rax)
+  8036c5:	00 00                	add    %al,(%rax)
+  8036c7:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8036cb:	00 00                	add    %al,(%rax)
+  8036cd:	00 00                	add    %al,(%rax)
+  8036cf:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8036d3:	00 00                	add    %al,(%rax)
+  8036d5:	00 00                	add    %al,(%rax)
+  8036d7:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8036db:	00 00                	add    %al,(%rax)
+  8036dd:	00 00                	add    %al,(%rax)
+  8036df:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8036e3:	00 00                	add    %al,(%rax)
+  8036e5:	00 00                	add    %al,(%rax)
+  8036e7:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8036eb:	00 00                	add    %al,(%rax)
+  8036ed:	00 00                	add    %al,(%rax)
+  8036ef:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8036f3:	00 00                	add    %al,(%rax)
+  8036f5:	00 00                	add    %al,(%rax)
+  8036f7:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8036fb:	00 00                	add    %al,(%rax)
+  8036fd:	00 00                	add    %al,(%rax)
+  8036ff:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803703:	00 00                	add    %al,(%rax)
+  803705:	00 00                	add    %al,(%rax)
+  803707:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80370b:	00 00                	add    %al,(%rax)
+  80370d:	00 00                	add    %al,(%rax)
+  80370f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803713:	00 00                	add    %al,(%rax)
+  803715:	00 00                	add    %al,(%rax)
+  803717:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80371b:	00 00                	add    %al,(%rax)
+  80371d:	00 00                	add    %al,(%rax)
+  80371f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803723:	00 00                	add    %al,(%rax)
+  803725:	00 00                	add    %al,(%rax)
+  803727:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80372b:	00 00                	add    %al,(%rax)
+  80372d:	00 00                	add    %al,(%rax)
+  80372f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803733:	00 00                	add    %al,(%rax)
+  803735:	00 00                	add    %al,(%rax)
+  803737:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80373b:	00 00                	add    %al,(%rax)
+  80373d:	00 00                	add    %al,(%rax)
+  80373f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803743:	00 00                	add    %al,(%rax)
+  803745:	00 00                	add    %al,(%rax)
+  803747:	00 6f 0b             	add    %ch,0xb(%rdi)
+  80374a:	80 00 00             	addb   $0x0,(%rax)
+  80374d:	00 00                	add    %al,(%rax)
+  80374f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803753:	00 00                	add    %al,(%rax)
+  803755:	00 00                	add    %al,(%rax)
+  803757:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80375b:	00 00                	add    %al,(%rax)
+  80375d:	00 00                	add    %al,(%rax)
+  80375f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803763:	00 00                	add    %al,(%rax)
+  803765:	00 00                	add    %al,(%rax)
+  803767:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80376b:	00 00                	add    %al,(%rax)
+  80376d:	00 00                	add    %al,(%rax)
+  80376f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803773:	00 00                	add    %al,(%rax)
+  803775:	00 00                	add    %al,(%rax)
+  803777:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80377b:	00 00                	add    %al,(%rax)
+  80377d:	00 00                	add    %al,(%rax)
+  80377f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803783:	00 00                	add    %al,(%rax)
+  803785:	00 00                	add    %al,(%rax)
+  803787:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80378b:	00 00                	add    %al,(%rax)
+  80378d:	00 00                	add    %al,(%rax)
+  80378f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803793:	00 00                	add    %al,(%rax)
+  803795:	00 00                	add    %al,(%rax)
+  803797:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80379b:	00 00                	add    %al,(%rax)
+  80379d:	00 00                	add    %al,(%rax)
+  80379f:	00 bb 06 80 00 00    	add    %bh,0x8006(%rbx)
+  8037a5:	00 00                	add    %al,(%rax)
+  8037a7:	00 8a 08 80 00 00    	add    %cl,0x8008(%rdx)
+  8037ad:	00 00                	add    %al,(%rax)
+  8037af:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8037b3:	00 00                	add    %al,(%rax)
+  8037b5:	00 00                	add    %al,(%rax)
+  8037b7:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8037bb:	00 00                	add    %al,(%rax)
+  8037bd:	00 00                	add    %al,(%rax)
+  8037bf:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8037c3:	00 00                	add    %al,(%rax)
+  8037c5:	00 00                	add    %al,(%rax)
+  8037c7:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8037cb:	00 00                	add    %al,(%rax)
+  8037cd:	00 00                	add    %al,(%rax)
+  8037cf:	00 ea                	add    %ch,%dl
+  8037d1:	06                   	(bad)
+  8037d2:	80 00 00             	addb   $0x0,(%rax)
+  8037d5:	00 00                	add    %al,(%rax)
+  8037d7:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8037db:	00 00                	add    %al,(%rax)
+  8037dd:	00 00                	add    %al,(%rax)
+  8037df:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8037e3:	00 00                	add    %al,(%rax)
+  8037e5:	00 00                	add    %al,(%rax)
+  8037e7:	00 b0 06 80 00 00    	add    %dh,0x8006(%rax)
+  8037ed:	00 00                	add    %al,(%rax)
+  8037ef:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8037f3:	00 00                	add    %al,(%rax)
+  8037f5:	00 00                	add    %al,(%rax)
+  8037f7:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  8037fb:	00 00                	add    %al,(%rax)
+  8037fd:	00 00                	add    %al,(%rax)
+  8037ff:	00 32                	add    %dh,(%rdx)
+  803801:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803807:	00 fc                	add    %bh,%ah
+  803809:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80380f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803813:	00 00                	add    %al,(%rax)
+  803815:	00 00                	add    %al,(%rax)
+  803817:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80381b:	00 00                	add    %al,(%rax)
+  80381d:	00 00                	add    %al,(%rax)
+  80381f:	00 81 07 80 00 00    	add    %al,0x8007(%rcx)
+  803825:	00 00                	add    %al,(%rax)
+  803827:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80382b:	00 00                	add    %al,(%rax)
+  80382d:	00 00                	add    %al,(%rax)
+  80382f:	00 5e 09             	add    %bl,0x9(%rsi)
+  803832:	80 00 00             	addb   $0x0,(%rax)
+  803835:	00 00                	add    %al,(%rax)
+  803837:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  80383b:	00 00                	add    %al,(%rax)
+  80383d:	00 00                	add    %al,(%rax)
+  80383f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803843:	00 00                	add    %al,(%rax)
+  803845:	00 00                	add    %al,(%rax)
+  803847:	00 6f 0b             	add    %ch,0xb(%rdi)
+  80384a:	80 00 00             	addb   $0x0,(%rax)
+  80384d:	00 00                	add    %al,(%rax)
+  80384f:	00 4c 0c 80          	add    %cl,-0x80(%rsp,%rcx,1)
+  803853:	00 00                	add    %al,(%rax)
+  803855:	00 00                	add    %al,(%rax)
+  803857:	00 14 06             	add    %dl,(%rsi,%rax,1)
+  80385a:	80 00 00             	addb   $0x0,(%rax)
+  80385d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803860 <error_string>:
+	...
+  803868:	0d 34 80 00 00 00 00 00 1f 34 80 00 00 00 00 00     .4.......4......
+  803878:	2f 34 80 00 00 00 00 00 41 34 80 00 00 00 00 00     /4......A4......
+  803888:	4f 34 80 00 00 00 00 00 63 34 80 00 00 00 00 00     O4......c4......
+  803898:	78 34 80 00 00 00 00 00 8b 34 80 00 00 00 00 00     x4.......4......
+  8038a8:	9d 34 80 00 00 00 00 00 b1 34 80 00 00 00 00 00     .4.......4......
+  8038b8:	c1 34 80 00 00 00 00 00 d4 34 80 00 00 00 00 00     .4.......4......
+  8038c8:	eb 34 80 00 00 00 00 00 01 35 80 00 00 00 00 00     .4.......5......
+  8038d8:	19 35 80 00 00 00 00 00 31 35 80 00 00 00 00 00     .5......15......
+  8038e8:	3e 35 80 00 00 00 00 00 10 39 80 00 00 00 00 00     >5.......9......
+  8038f8:	52 35 80 00 00 00 00 00 00 00 00 00 00 00 00 00     R5..............
+  803908:	6a 35 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     j5......file is 
+  803918:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803928:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803938:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803948:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803958:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  803968:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  803978:	6c 69 62 2f 66 6f 72 6b 2e 63 00 0f 1f 44 00 00     lib/fork.c...D..
+  803988:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803998:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8039a8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8039b8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8039c8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8039d8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8039e8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8039f8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803a08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a18:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000803a20 <devtab>:
+  803a20:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803a30:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803a40:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  803a50:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  803a60:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  803a70:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 0f 1f 40 00     _SIZE) == 2...@.
+  803a80:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  803a90:	20 62 65 67 69 6e 20 67 65 6e 65 72 69 63 20 68      begin generic h
+  803aa0:	61 6e 64 6c 65 72 20 66 6f 72 20 25 64 0a 00 00     andler for %d...
+  803ab0:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  803ac0:	20 65 78 69 74 69 6e 67 20 64 75 65 20 74 6f 20      exiting due to 
+  803ad0:	73 69 67 6e 61 6c 20 25 64 0a 00 00 00 00 00 00     signal %d.......
+  803ae0:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  803af0:	20 69 67 6e 6f 72 69 6e 67 20 73 69 67 6e 61 6c      ignoring signal
+  803b00:	20 25 64 0a 00 00 00 00 73 69 67 6e 61 6c 73 3a      %d.....signals:
+  803b10:	20 65 6e 76 20 25 78 3a 20 65 6e 64 20 67 65 6e      env %x: end gen
+  803b20:	65 72 69 63 20 68 61 6e 64 6c 65 72 20 66 6f 72     eric handler for
+  803b30:	20 25 64 0a 00 66 61 6c 73 65 00 6c 69 62 2f 73      %d..false.lib/s
+  803b40:	69 67 6e 61 6c 2e 63 00 3c 63 6f 6e 73 3e 00 63     ignal.c.<cons>.c
+  803b50:	6f 6e 73 00 69 70 63 5f 73 65 6e 64 3a 20 66 61     ons.ipc_send: fa
+  803b60:	69 6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62     iled to send.lib
+  803b70:	2f 69 70 63 2e 63 00 90 55 73 65 72 73 70 61 63     /ipc.c..Userspac
+  803b80:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  803b90:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  803ba0:	65 72 72 3d 25 78 0a 00 61 64 64 5f 70 67 66 61     err=%x..add_pgfa
+  803bb0:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  803bc0:	5f 61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61     _alloc_region fa
+  803bd0:	69 6c 65 64 00 00 00 00 61 64 64 5f 70 67 66 61     iled....add_pgfa
+  803be0:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  803bf0:	5f 65 6e 76 5f 73 65 74 5f 70 67 66 61 75 6c 74     _env_set_pgfault
+  803c00:	5f 75 70 63 61 6c 6c 20 66 61 69 6c 65 64 00 6c     _upcall failed.l
+  803c10:	69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65 74     ib/pgfault.c.set
+  803c20:	5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65 72     _pgfault_handler
+  803c30:	3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72 5f     : %i._pfhandler_
+  803c40:	69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00 66     inititiallized.f
+  803c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
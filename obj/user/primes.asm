@@ -0,0 +1,5879 @@
+
+obj/user/primes:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 68 01 00 00       	call   80018b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <primeproc>:
+ * of main and user/idle. */
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    int i, id, p;
+    envid_t envid;
+
+    /* Fetch a prime from our left neighbor */
+top:
+    p = ipc_recv(&envid, 0, 0, 0);
+  800036:	49 bf 1c 19 80 00 00 	movabs $0x80191c,%r15
+  80003d:	00 00 00 
+    cprintf("%d ", p);
+  800040:	49 be a5 03 80 00 00 	movabs $0x8003a5,%r14
+  800047:	00 00 00 
+
+    /* Fork a right neighbor to continue the chain */
+    if ((id = fork()) < 0)
+  80004a:	49 bd 1c 18 80 00 00 	movabs $0x80181c,%r13
+  800051:	00 00 00 
+    p = ipc_recv(&envid, 0, 0, 0);
+  800054:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800059:	ba 00 00 00 00       	mov    $0x0,%edx
+  80005e:	be 00 00 00 00       	mov    $0x0,%esi
+  800063:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  800067:	41 ff d7             	call   *%r15
+  80006a:	89 c3                	mov    %eax,%ebx
+    cprintf("%d ", p);
+  80006c:	89 c6                	mov    %eax,%esi
+  80006e:	48 bf 78 2d 80 00 00 	movabs $0x802d78,%rdi
+  800075:	00 00 00 
+  800078:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007d:	41 ff d6             	call   *%r14
+    if ((id = fork()) < 0)
+  800080:	41 ff d5             	call   *%r13
+  800083:	41 89 c4             	mov    %eax,%r12d
+  800086:	85 c0                	test   %eax,%eax
+  800088:	78 4d                	js     8000d7 <primeproc+0xb2>
+        panic("fork: %i", id);
+    if (id == 0)
+  80008a:	74 c8                	je     800054 <primeproc+0x2f>
+        goto top;
+
+    /* Filter out multiples of our prime */
+    while (1) {
+        i = ipc_recv(&envid, 0, 0, 0);
+  80008c:	49 bd 1c 19 80 00 00 	movabs $0x80191c,%r13
+  800093:	00 00 00 
+        if (i % p)
+            ipc_send(id, i, 0, 0, 0);
+  800096:	49 be b1 19 80 00 00 	movabs $0x8019b1,%r14
+  80009d:	00 00 00 
+        i = ipc_recv(&envid, 0, 0, 0);
+  8000a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8000af:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  8000b3:	41 ff d5             	call   *%r13
+  8000b6:	89 c6                	mov    %eax,%esi
+        if (i % p)
+  8000b8:	99                   	cltd
+  8000b9:	f7 fb                	idiv   %ebx
+  8000bb:	85 d2                	test   %edx,%edx
+  8000bd:	74 e1                	je     8000a0 <primeproc+0x7b>
+            ipc_send(id, i, 0, 0, 0);
+  8000bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000cf:	44 89 e7             	mov    %r12d,%edi
+  8000d2:	41 ff d6             	call   *%r14
+  8000d5:	eb c9                	jmp    8000a0 <primeproc+0x7b>
+        panic("fork: %i", id);
+  8000d7:	89 c1                	mov    %eax,%ecx
+  8000d9:	48 ba 7c 2d 80 00 00 	movabs $0x802d7c,%rdx
+  8000e0:	00 00 00 
+  8000e3:	be 19 00 00 00       	mov    $0x19,%esi
+  8000e8:	48 bf 85 2d 80 00 00 	movabs $0x802d85,%rdi
+  8000ef:	00 00 00 
+  8000f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f7:	49 b8 55 02 80 00 00 	movabs $0x800255,%r8
+  8000fe:	00 00 00 
+  800101:	41 ff d0             	call   *%r8
+
+0000000000800104 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800104:	55                   	push   %rbp
+  800105:	48 89 e5             	mov    %rsp,%rbp
+  800108:	41 55                	push   %r13
+  80010a:	41 54                	push   %r12
+  80010c:	53                   	push   %rbx
+  80010d:	48 83 ec 08          	sub    $0x8,%rsp
+    int id;
+
+    /* Fork the first prime process in the chain */
+    if ((id = fork()) < 0)
+  800111:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  800118:	00 00 00 
+  80011b:	ff d0                	call   *%rax
+  80011d:	41 89 c4             	mov    %eax,%r12d
+  800120:	85 c0                	test   %eax,%eax
+  800122:	78 2e                	js     800152 <umain+0x4e>
+        panic("fork: %i", id);
+    if (id == 0)
+        primeproc();
+
+    /* Feed all the integers through */
+    for (int i = 2;; i++)
+  800124:	bb 02 00 00 00       	mov    $0x2,%ebx
+        ipc_send(id, i, 0, 0, 0);
+  800129:	49 bd b1 19 80 00 00 	movabs $0x8019b1,%r13
+  800130:	00 00 00 
+    if (id == 0)
+  800133:	74 4a                	je     80017f <umain+0x7b>
+        ipc_send(id, i, 0, 0, 0);
+  800135:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80013b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800140:	ba 00 00 00 00       	mov    $0x0,%edx
+  800145:	89 de                	mov    %ebx,%esi
+  800147:	44 89 e7             	mov    %r12d,%edi
+  80014a:	41 ff d5             	call   *%r13
+    for (int i = 2;; i++)
+  80014d:	83 c3 01             	add    $0x1,%ebx
+  800150:	eb e3                	jmp    800135 <umain+0x31>
+        panic("fork: %i", id);
+  800152:	89 c1                	mov    %eax,%ecx
+  800154:	48 ba 7c 2d 80 00 00 	movabs $0x802d7c,%rdx
+  80015b:	00 00 00 
+  80015e:	be 2b 00 00 00       	mov    $0x2b,%esi
+  800163:	48 bf 85 2d 80 00 00 	movabs $0x802d85,%rdi
+  80016a:	00 00 00 
+  80016d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800172:	49 b8 55 02 80 00 00 	movabs $0x800255,%r8
+  800179:	00 00 00 
+  80017c:	41 ff d0             	call   *%r8
+        primeproc();
+  80017f:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800186:	00 00 00 
+  800189:	ff d0                	call   *%rax
+
+000000000080018b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80018b:	55                   	push   %rbp
+  80018c:	48 89 e5             	mov    %rsp,%rbp
+  80018f:	41 56                	push   %r14
+  800191:	41 55                	push   %r13
+  800193:	41 54                	push   %r12
+  800195:	53                   	push   %rbx
+  800196:	41 89 fd             	mov    %edi,%r13d
+  800199:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80019c:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8001a3:	00 00 00 
+  8001a6:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8001ad:	00 00 00 
+  8001b0:	48 39 c2             	cmp    %rax,%rdx
+  8001b3:	73 17                	jae    8001cc <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001b5:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001b8:	49 89 c4             	mov    %rax,%r12
+  8001bb:	48 83 c3 08          	add    $0x8,%rbx
+  8001bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c4:	ff 53 f8             	call   *-0x8(%rbx)
+  8001c7:	4c 39 e3             	cmp    %r12,%rbx
+  8001ca:	72 ef                	jb     8001bb <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8001cc:	48 b8 ba 11 80 00 00 	movabs $0x8011ba,%rax
+  8001d3:	00 00 00 
+  8001d6:	ff d0                	call   *%rax
+  8001d8:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8001db:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8001e2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001e9:	00 00 00 
+  8001ec:	48 01 d0             	add    %rdx,%rax
+  8001ef:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8001f6:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001f9:	45 85 ed             	test   %r13d,%r13d
+  8001fc:	7e 0d                	jle    80020b <libmain+0x80>
+  8001fe:	49 8b 06             	mov    (%r14),%rax
+  800201:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800208:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80020b:	4c 89 f6             	mov    %r14,%rsi
+  80020e:	44 89 ef             	mov    %r13d,%edi
+  800211:	48 b8 04 01 80 00 00 	movabs $0x800104,%rax
+  800218:	00 00 00 
+  80021b:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80021d:	48 b8 32 02 80 00 00 	movabs $0x800232,%rax
+  800224:	00 00 00 
+  800227:	ff d0                	call   *%rax
+#endif
+}
+  800229:	5b                   	pop    %rbx
+  80022a:	41 5c                	pop    %r12
+  80022c:	41 5d                	pop    %r13
+  80022e:	41 5e                	pop    %r14
+  800230:	5d                   	pop    %rbp
+  800231:	c3                   	ret
+
+0000000000800232 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800232:	55                   	push   %rbp
+  800233:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800236:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  80023d:	00 00 00 
+  800240:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800242:	bf 00 00 00 00       	mov    $0x0,%edi
+  800247:	48 b8 4f 11 80 00 00 	movabs $0x80114f,%rax
+  80024e:	00 00 00 
+  800251:	ff d0                	call   *%rax
+}
+  800253:	5d                   	pop    %rbp
+  800254:	c3                   	ret
+
+0000000000800255 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800255:	55                   	push   %rbp
+  800256:	48 89 e5             	mov    %rsp,%rbp
+  800259:	41 56                	push   %r14
+  80025b:	41 55                	push   %r13
+  80025d:	41 54                	push   %r12
+  80025f:	53                   	push   %rbx
+  800260:	48 83 ec 50          	sub    $0x50,%rsp
+  800264:	49 89 fc             	mov    %rdi,%r12
+  800267:	41 89 f5             	mov    %esi,%r13d
+  80026a:	48 89 d3             	mov    %rdx,%rbx
+  80026d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800271:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800275:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800279:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800280:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800284:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800288:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80028c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800290:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800297:	00 00 00 
+  80029a:	4c 8b 30             	mov    (%rax),%r14
+  80029d:	48 b8 ba 11 80 00 00 	movabs $0x8011ba,%rax
+  8002a4:	00 00 00 
+  8002a7:	ff d0                	call   *%rax
+  8002a9:	89 c6                	mov    %eax,%esi
+  8002ab:	45 89 e8             	mov    %r13d,%r8d
+  8002ae:	4c 89 e1             	mov    %r12,%rcx
+  8002b1:	4c 89 f2             	mov    %r14,%rdx
+  8002b4:	48 bf a0 2d 80 00 00 	movabs $0x802da0,%rdi
+  8002bb:	00 00 00 
+  8002be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c3:	49 bc a5 03 80 00 00 	movabs $0x8003a5,%r12
+  8002ca:	00 00 00 
+  8002cd:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002d0:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002d4:	48 89 df             	mov    %rbx,%rdi
+  8002d7:	48 b8 41 03 80 00 00 	movabs $0x800341,%rax
+  8002de:	00 00 00 
+  8002e1:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002e3:	48 bf e3 33 80 00 00 	movabs $0x8033e3,%rdi
+  8002ea:	00 00 00 
+  8002ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f2:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002f5:	cc                   	int3
+  8002f6:	eb fd                	jmp    8002f5 <_panic+0xa0>
+
+00000000008002f8 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002f8:	55                   	push   %rbp
+  8002f9:	48 89 e5             	mov    %rsp,%rbp
+  8002fc:	53                   	push   %rbx
+  8002fd:	48 83 ec 08          	sub    $0x8,%rsp
+  800301:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800304:	8b 06                	mov    (%rsi),%eax
+  800306:	8d 50 01             	lea    0x1(%rax),%edx
+  800309:	89 16                	mov    %edx,(%rsi)
+  80030b:	48 98                	cltq
+  80030d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800312:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800318:	74 0a                	je     800324 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80031a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80031e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800322:	c9                   	leave
+  800323:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800324:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800328:	be ff 00 00 00       	mov    $0xff,%esi
+  80032d:	48 b8 f1 10 80 00 00 	movabs $0x8010f1,%rax
+  800334:	00 00 00 
+  800337:	ff d0                	call   *%rax
+        state->offset = 0;
+  800339:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80033f:	eb d9                	jmp    80031a <putch+0x22>
+
+0000000000800341 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800341:	55                   	push   %rbp
+  800342:	48 89 e5             	mov    %rsp,%rbp
+  800345:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80034c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80034f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800356:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80035b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800360:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800363:	48 89 f1             	mov    %rsi,%rcx
+  800366:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80036d:	48 bf f8 02 80 00 00 	movabs $0x8002f8,%rdi
+  800374:	00 00 00 
+  800377:	48 b8 f5 04 80 00 00 	movabs $0x8004f5,%rax
+  80037e:	00 00 00 
+  800381:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800383:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80038a:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800391:	48 b8 f1 10 80 00 00 	movabs $0x8010f1,%rax
+  800398:	00 00 00 
+  80039b:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80039d:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003a3:	c9                   	leave
+  8003a4:	c3                   	ret
+
+00000000008003a5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003a5:	55                   	push   %rbp
+  8003a6:	48 89 e5             	mov    %rsp,%rbp
+  8003a9:	48 83 ec 50          	sub    $0x50,%rsp
+  8003ad:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003b1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003b5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003b9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003bd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003c1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003c8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003d0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003d4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003d8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003dc:	48 b8 41 03 80 00 00 	movabs $0x800341,%rax
+  8003e3:	00 00 00 
+  8003e6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003e8:	c9                   	leave
+  8003e9:	c3                   	ret
+
+00000000008003ea <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003ea:	55                   	push   %rbp
+  8003eb:	48 89 e5             	mov    %rsp,%rbp
+  8003ee:	41 57                	push   %r15
+  8003f0:	41 56                	push   %r14
+  8003f2:	41 55                	push   %r13
+  8003f4:	41 54                	push   %r12
+  8003f6:	53                   	push   %rbx
+  8003f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8003fb:	49 89 fc             	mov    %rdi,%r12
+  8003fe:	49 89 f5             	mov    %rsi,%r13
+  800401:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800405:	8b 45 10             	mov    0x10(%rbp),%eax
+  800408:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80040b:	41 89 cf             	mov    %ecx,%r15d
+  80040e:	4c 39 fa             	cmp    %r15,%rdx
+  800411:	73 5b                	jae    80046e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800413:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800417:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80041b:	85 db                	test   %ebx,%ebx
+  80041d:	7e 0e                	jle    80042d <print_num+0x43>
+            putch(padc, put_arg);
+  80041f:	4c 89 ee             	mov    %r13,%rsi
+  800422:	44 89 f7             	mov    %r14d,%edi
+  800425:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800428:	83 eb 01             	sub    $0x1,%ebx
+  80042b:	75 f2                	jne    80041f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80042d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800431:	48 b9 d4 2d 80 00 00 	movabs $0x802dd4,%rcx
+  800438:	00 00 00 
+  80043b:	48 b8 c3 2d 80 00 00 	movabs $0x802dc3,%rax
+  800442:	00 00 00 
+  800445:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800449:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80044d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800452:	49 f7 f7             	div    %r15
+  800455:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800459:	4c 89 ee             	mov    %r13,%rsi
+  80045c:	41 ff d4             	call   *%r12
+}
+  80045f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800463:	5b                   	pop    %rbx
+  800464:	41 5c                	pop    %r12
+  800466:	41 5d                	pop    %r13
+  800468:	41 5e                	pop    %r14
+  80046a:	41 5f                	pop    %r15
+  80046c:	5d                   	pop    %rbp
+  80046d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80046e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800472:	ba 00 00 00 00       	mov    $0x0,%edx
+  800477:	49 f7 f7             	div    %r15
+  80047a:	48 83 ec 08          	sub    $0x8,%rsp
+  80047e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800482:	52                   	push   %rdx
+  800483:	45 0f be c9          	movsbl %r9b,%r9d
+  800487:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80048b:	48 89 c2             	mov    %rax,%rdx
+  80048e:	48 b8 ea 03 80 00 00 	movabs $0x8003ea,%rax
+  800495:	00 00 00 
+  800498:	ff d0                	call   *%rax
+  80049a:	48 83 c4 10          	add    $0x10,%rsp
+  80049e:	eb 8d                	jmp    80042d <print_num+0x43>
+
+00000000008004a0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004a0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004a4:	48 8b 06             	mov    (%rsi),%rax
+  8004a7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004ab:	73 0a                	jae    8004b7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8004ad:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004b1:	48 89 16             	mov    %rdx,(%rsi)
+  8004b4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004b7:	c3                   	ret
+
+00000000008004b8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004b8:	55                   	push   %rbp
+  8004b9:	48 89 e5             	mov    %rsp,%rbp
+  8004bc:	48 83 ec 50          	sub    $0x50,%rsp
+  8004c0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004c4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004c8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004cc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004d3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004db:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004df:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004e3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004e7:	48 b8 f5 04 80 00 00 	movabs $0x8004f5,%rax
+  8004ee:	00 00 00 
+  8004f1:	ff d0                	call   *%rax
+}
+  8004f3:	c9                   	leave
+  8004f4:	c3                   	ret
+
+00000000008004f5 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004f5:	55                   	push   %rbp
+  8004f6:	48 89 e5             	mov    %rsp,%rbp
+  8004f9:	41 57                	push   %r15
+  8004fb:	41 56                	push   %r14
+  8004fd:	41 55                	push   %r13
+  8004ff:	41 54                	push   %r12
+  800501:	53                   	push   %rbx
+  800502:	48 83 ec 38          	sub    $0x38,%rsp
+  800506:	49 89 fe             	mov    %rdi,%r14
+  800509:	49 89 f5             	mov    %rsi,%r13
+  80050c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80050f:	48 8b 01             	mov    (%rcx),%rax
+  800512:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800516:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80051a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80051e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800522:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800526:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80052a:	0f b6 3b             	movzbl (%rbx),%edi
+  80052d:	40 80 ff 25          	cmp    $0x25,%dil
+  800531:	74 18                	je     80054b <vprintfmt+0x56>
+            if (!ch) return;
+  800533:	40 84 ff             	test   %dil,%dil
+  800536:	0f 84 b1 06 00 00    	je     800bed <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80053c:	40 0f b6 ff          	movzbl %dil,%edi
+  800540:	4c 89 ee             	mov    %r13,%rsi
+  800543:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800546:	4c 89 e3             	mov    %r12,%rbx
+  800549:	eb db                	jmp    800526 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80054b:	be 00 00 00 00       	mov    $0x0,%esi
+  800550:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800554:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800559:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80055f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800566:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80056a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80056f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800574:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800577:	83 e8 23             	sub    $0x23,%eax
+  80057a:	3c 57                	cmp    $0x57,%al
+  80057c:	0f 87 51 06 00 00    	ja     800bd3 <vprintfmt+0x6de>
+  800582:	0f b6 c0             	movzbl %al,%eax
+  800585:	48 b9 80 2f 80 00 00 	movabs $0x802f80,%rcx
+  80058c:	00 00 00 
+  80058f:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800592:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800595:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800599:	eb cf                	jmp    80056a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80059b:	49 89 dc             	mov    %rbx,%r12
+  80059e:	be 01 00 00 00       	mov    $0x1,%esi
+  8005a3:	eb c5                	jmp    80056a <vprintfmt+0x75>
+            padc = ch;
+  8005a5:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005a9:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005ac:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005af:	eb b9                	jmp    80056a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8005b7:	77 24                	ja     8005dd <vprintfmt+0xe8>
+  8005b9:	89 c1                	mov    %eax,%ecx
+  8005bb:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005bf:	83 c0 08             	add    $0x8,%eax
+  8005c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005c5:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005c8:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005cb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005cf:	79 99                	jns    80056a <vprintfmt+0x75>
+                width = precision;
+  8005d1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005d5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005db:	eb 8d                	jmp    80056a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005dd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005e1:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005e9:	eb da                	jmp    8005c5 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005eb:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005f0:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005f4:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005fa:	3c 39                	cmp    $0x39,%al
+  8005fc:	77 1c                	ja     80061a <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005fe:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800602:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800606:	0f b6 c0             	movzbl %al,%eax
+  800609:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80060e:	0f b6 03             	movzbl (%rbx),%eax
+  800611:	3c 39                	cmp    $0x39,%al
+  800613:	76 e9                	jbe    8005fe <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800615:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800618:	eb b1                	jmp    8005cb <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80061a:	49 89 dc             	mov    %rbx,%r12
+  80061d:	eb ac                	jmp    8005cb <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80061f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800622:	85 c9                	test   %ecx,%ecx
+  800624:	b8 00 00 00 00       	mov    $0x0,%eax
+  800629:	0f 49 c1             	cmovns %ecx,%eax
+  80062c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80062f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800632:	e9 33 ff ff ff       	jmp    80056a <vprintfmt+0x75>
+            lflag++;
+  800637:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80063a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80063d:	e9 28 ff ff ff       	jmp    80056a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800642:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800645:	83 f8 2f             	cmp    $0x2f,%eax
+  800648:	77 19                	ja     800663 <vprintfmt+0x16e>
+  80064a:	89 c2                	mov    %eax,%edx
+  80064c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800650:	83 c0 08             	add    $0x8,%eax
+  800653:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800656:	8b 3a                	mov    (%rdx),%edi
+  800658:	4c 89 ee             	mov    %r13,%rsi
+  80065b:	41 ff d6             	call   *%r14
+            break;
+  80065e:	e9 c3 fe ff ff       	jmp    800526 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800663:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800667:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80066b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80066f:	eb e5                	jmp    800656 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800671:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800674:	83 f8 2f             	cmp    $0x2f,%eax
+  800677:	77 5a                	ja     8006d3 <vprintfmt+0x1de>
+  800679:	89 c2                	mov    %eax,%edx
+  80067b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80067f:	83 c0 08             	add    $0x8,%eax
+  800682:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800685:	8b 02                	mov    (%rdx),%eax
+  800687:	89 c1                	mov    %eax,%ecx
+  800689:	f7 d9                	neg    %ecx
+  80068b:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80068e:	83 f9 15             	cmp    $0x15,%ecx
+  800691:	7f 4e                	jg     8006e1 <vprintfmt+0x1ec>
+  800693:	48 63 c1             	movslq %ecx,%rax
+  800696:	48 ba 40 32 80 00 00 	movabs $0x803240,%rdx
+  80069d:	00 00 00 
+  8006a0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006a4:	48 85 c0             	test   %rax,%rax
+  8006a7:	74 38                	je     8006e1 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006a9:	48 89 c1             	mov    %rax,%rcx
+  8006ac:	48 ba 59 34 80 00 00 	movabs $0x803459,%rdx
+  8006b3:	00 00 00 
+  8006b6:	4c 89 ee             	mov    %r13,%rsi
+  8006b9:	4c 89 f7             	mov    %r14,%rdi
+  8006bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c1:	49 b8 b8 04 80 00 00 	movabs $0x8004b8,%r8
+  8006c8:	00 00 00 
+  8006cb:	41 ff d0             	call   *%r8
+  8006ce:	e9 53 fe ff ff       	jmp    800526 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006df:	eb a4                	jmp    800685 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006e1:	48 ba ec 2d 80 00 00 	movabs $0x802dec,%rdx
+  8006e8:	00 00 00 
+  8006eb:	4c 89 ee             	mov    %r13,%rsi
+  8006ee:	4c 89 f7             	mov    %r14,%rdi
+  8006f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f6:	49 b8 b8 04 80 00 00 	movabs $0x8004b8,%r8
+  8006fd:	00 00 00 
+  800700:	41 ff d0             	call   *%r8
+  800703:	e9 1e fe ff ff       	jmp    800526 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800708:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80070b:	83 f8 2f             	cmp    $0x2f,%eax
+  80070e:	77 6c                	ja     80077c <vprintfmt+0x287>
+  800710:	89 c2                	mov    %eax,%edx
+  800712:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800716:	83 c0 08             	add    $0x8,%eax
+  800719:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80071c:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80071f:	48 85 d2             	test   %rdx,%rdx
+  800722:	48 b8 e5 2d 80 00 00 	movabs $0x802de5,%rax
+  800729:	00 00 00 
+  80072c:	48 0f 45 c2          	cmovne %rdx,%rax
+  800730:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800734:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800738:	7e 06                	jle    800740 <vprintfmt+0x24b>
+  80073a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80073e:	75 4a                	jne    80078a <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800740:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800744:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800748:	0f b6 00             	movzbl (%rax),%eax
+  80074b:	84 c0                	test   %al,%al
+  80074d:	0f 85 9a 00 00 00    	jne    8007ed <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800753:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800756:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80075a:	85 c0                	test   %eax,%eax
+  80075c:	0f 8e c4 fd ff ff    	jle    800526 <vprintfmt+0x31>
+  800762:	4c 89 ee             	mov    %r13,%rsi
+  800765:	bf 20 00 00 00       	mov    $0x20,%edi
+  80076a:	41 ff d6             	call   *%r14
+  80076d:	41 83 ec 01          	sub    $0x1,%r12d
+  800771:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800775:	75 eb                	jne    800762 <vprintfmt+0x26d>
+  800777:	e9 aa fd ff ff       	jmp    800526 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80077c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800780:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800784:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800788:	eb 92                	jmp    80071c <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80078a:	49 63 f7             	movslq %r15d,%rsi
+  80078d:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800791:	48 b8 a7 0c 80 00 00 	movabs $0x800ca7,%rax
+  800798:	00 00 00 
+  80079b:	ff d0                	call   *%rax
+  80079d:	48 89 c2             	mov    %rax,%rdx
+  8007a0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007a3:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007a5:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007a8:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007ab:	85 c0                	test   %eax,%eax
+  8007ad:	7e 91                	jle    800740 <vprintfmt+0x24b>
+  8007af:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007b4:	4c 89 ee             	mov    %r13,%rsi
+  8007b7:	44 89 e7             	mov    %r12d,%edi
+  8007ba:	41 ff d6             	call   *%r14
+  8007bd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007c1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007c4:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007c7:	75 eb                	jne    8007b4 <vprintfmt+0x2bf>
+  8007c9:	e9 72 ff ff ff       	jmp    800740 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007ce:	0f b6 f8             	movzbl %al,%edi
+  8007d1:	4c 89 ee             	mov    %r13,%rsi
+  8007d4:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007d7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007db:	49 83 c4 01          	add    $0x1,%r12
+  8007df:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007e5:	84 c0                	test   %al,%al
+  8007e7:	0f 84 66 ff ff ff    	je     800753 <vprintfmt+0x25e>
+  8007ed:	45 85 ff             	test   %r15d,%r15d
+  8007f0:	78 0a                	js     8007fc <vprintfmt+0x307>
+  8007f2:	41 83 ef 01          	sub    $0x1,%r15d
+  8007f6:	0f 88 57 ff ff ff    	js     800753 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007fc:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800800:	74 cc                	je     8007ce <vprintfmt+0x2d9>
+  800802:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800805:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80080a:	80 fa 5e             	cmp    $0x5e,%dl
+  80080d:	77 c2                	ja     8007d1 <vprintfmt+0x2dc>
+  80080f:	eb bd                	jmp    8007ce <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800811:	40 84 f6             	test   %sil,%sil
+  800814:	75 26                	jne    80083c <vprintfmt+0x347>
+    switch (lflag) {
+  800816:	85 d2                	test   %edx,%edx
+  800818:	74 59                	je     800873 <vprintfmt+0x37e>
+  80081a:	83 fa 01             	cmp    $0x1,%edx
+  80081d:	74 7b                	je     80089a <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80081f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800822:	83 f8 2f             	cmp    $0x2f,%eax
+  800825:	0f 87 96 00 00 00    	ja     8008c1 <vprintfmt+0x3cc>
+  80082b:	89 c2                	mov    %eax,%edx
+  80082d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800831:	83 c0 08             	add    $0x8,%eax
+  800834:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800837:	4c 8b 22             	mov    (%rdx),%r12
+  80083a:	eb 17                	jmp    800853 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80083c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083f:	83 f8 2f             	cmp    $0x2f,%eax
+  800842:	77 21                	ja     800865 <vprintfmt+0x370>
+  800844:	89 c2                	mov    %eax,%edx
+  800846:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084a:	83 c0 08             	add    $0x8,%eax
+  80084d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800850:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800853:	4d 85 e4             	test   %r12,%r12
+  800856:	78 7a                	js     8008d2 <vprintfmt+0x3dd>
+            num = i;
+  800858:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80085b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800860:	e9 50 02 00 00       	jmp    800ab5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800865:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800869:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800871:	eb dd                	jmp    800850 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800873:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800876:	83 f8 2f             	cmp    $0x2f,%eax
+  800879:	77 11                	ja     80088c <vprintfmt+0x397>
+  80087b:	89 c2                	mov    %eax,%edx
+  80087d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800881:	83 c0 08             	add    $0x8,%eax
+  800884:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800887:	4c 63 22             	movslq (%rdx),%r12
+  80088a:	eb c7                	jmp    800853 <vprintfmt+0x35e>
+  80088c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800890:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800894:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800898:	eb ed                	jmp    800887 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80089a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089d:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a0:	77 11                	ja     8008b3 <vprintfmt+0x3be>
+  8008a2:	89 c2                	mov    %eax,%edx
+  8008a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a8:	83 c0 08             	add    $0x8,%eax
+  8008ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ae:	4c 8b 22             	mov    (%rdx),%r12
+  8008b1:	eb a0                	jmp    800853 <vprintfmt+0x35e>
+  8008b3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008bf:	eb ed                	jmp    8008ae <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8008c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cd:	e9 65 ff ff ff       	jmp    800837 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008d2:	4c 89 ee             	mov    %r13,%rsi
+  8008d5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008da:	41 ff d6             	call   *%r14
+                i = -i;
+  8008dd:	49 f7 dc             	neg    %r12
+  8008e0:	e9 73 ff ff ff       	jmp    800858 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008e5:	40 84 f6             	test   %sil,%sil
+  8008e8:	75 32                	jne    80091c <vprintfmt+0x427>
+    switch (lflag) {
+  8008ea:	85 d2                	test   %edx,%edx
+  8008ec:	74 5d                	je     80094b <vprintfmt+0x456>
+  8008ee:	83 fa 01             	cmp    $0x1,%edx
+  8008f1:	0f 84 82 00 00 00    	je     800979 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fd:	0f 87 a5 00 00 00    	ja     8009a8 <vprintfmt+0x4b3>
+  800903:	89 c2                	mov    %eax,%edx
+  800905:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800909:	83 c0 08             	add    $0x8,%eax
+  80090c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800912:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800917:	e9 99 01 00 00       	jmp    800ab5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80091c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091f:	83 f8 2f             	cmp    $0x2f,%eax
+  800922:	77 19                	ja     80093d <vprintfmt+0x448>
+  800924:	89 c2                	mov    %eax,%edx
+  800926:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092a:	83 c0 08             	add    $0x8,%eax
+  80092d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800930:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800933:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800938:	e9 78 01 00 00       	jmp    800ab5 <vprintfmt+0x5c0>
+  80093d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800941:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800945:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800949:	eb e5                	jmp    800930 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80094b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094e:	83 f8 2f             	cmp    $0x2f,%eax
+  800951:	77 18                	ja     80096b <vprintfmt+0x476>
+  800953:	89 c2                	mov    %eax,%edx
+  800955:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800959:	83 c0 08             	add    $0x8,%eax
+  80095c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800961:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800966:	e9 4a 01 00 00       	jmp    800ab5 <vprintfmt+0x5c0>
+  80096b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800973:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800977:	eb e6                	jmp    80095f <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800979:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097c:	83 f8 2f             	cmp    $0x2f,%eax
+  80097f:	77 19                	ja     80099a <vprintfmt+0x4a5>
+  800981:	89 c2                	mov    %eax,%edx
+  800983:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800987:	83 c0 08             	add    $0x8,%eax
+  80098a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800990:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800995:	e9 1b 01 00 00       	jmp    800ab5 <vprintfmt+0x5c0>
+  80099a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a6:	eb e5                	jmp    80098d <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8009a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b4:	e9 56 ff ff ff       	jmp    80090f <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8009b9:	40 84 f6             	test   %sil,%sil
+  8009bc:	75 2e                	jne    8009ec <vprintfmt+0x4f7>
+    switch (lflag) {
+  8009be:	85 d2                	test   %edx,%edx
+  8009c0:	74 59                	je     800a1b <vprintfmt+0x526>
+  8009c2:	83 fa 01             	cmp    $0x1,%edx
+  8009c5:	74 7f                	je     800a46 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8009c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8009cd:	0f 87 9f 00 00 00    	ja     800a72 <vprintfmt+0x57d>
+  8009d3:	89 c2                	mov    %eax,%edx
+  8009d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d9:	83 c0 08             	add    $0x8,%eax
+  8009dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009df:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009e2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009e7:	e9 c9 00 00 00       	jmp    800ab5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f2:	77 19                	ja     800a0d <vprintfmt+0x518>
+  8009f4:	89 c2                	mov    %eax,%edx
+  8009f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fa:	83 c0 08             	add    $0x8,%eax
+  8009fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a00:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a03:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a08:	e9 a8 00 00 00       	jmp    800ab5 <vprintfmt+0x5c0>
+  800a0d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a11:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a19:	eb e5                	jmp    800a00 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a21:	77 15                	ja     800a38 <vprintfmt+0x543>
+  800a23:	89 c2                	mov    %eax,%edx
+  800a25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a29:	83 c0 08             	add    $0x8,%eax
+  800a2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2f:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a31:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a36:	eb 7d                	jmp    800ab5 <vprintfmt+0x5c0>
+  800a38:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a44:	eb e9                	jmp    800a2f <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a49:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4c:	77 16                	ja     800a64 <vprintfmt+0x56f>
+  800a4e:	89 c2                	mov    %eax,%edx
+  800a50:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a54:	83 c0 08             	add    $0x8,%eax
+  800a57:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a5d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a62:	eb 51                	jmp    800ab5 <vprintfmt+0x5c0>
+  800a64:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a68:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a70:	eb e8                	jmp    800a5a <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a72:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a76:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7e:	e9 5c ff ff ff       	jmp    8009df <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a83:	4c 89 ee             	mov    %r13,%rsi
+  800a86:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a8b:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a8e:	4c 89 ee             	mov    %r13,%rsi
+  800a91:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a96:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a9c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9f:	77 47                	ja     800ae8 <vprintfmt+0x5f3>
+  800aa1:	89 c2                	mov    %eax,%edx
+  800aa3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa7:	83 c0 08             	add    $0x8,%eax
+  800aaa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aad:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ab0:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ab5:	48 83 ec 08          	sub    $0x8,%rsp
+  800ab9:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800abd:	0f 94 c0             	sete   %al
+  800ac0:	0f b6 c0             	movzbl %al,%eax
+  800ac3:	50                   	push   %rax
+  800ac4:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ac9:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800acd:	4c 89 ee             	mov    %r13,%rsi
+  800ad0:	4c 89 f7             	mov    %r14,%rdi
+  800ad3:	48 b8 ea 03 80 00 00 	movabs $0x8003ea,%rax
+  800ada:	00 00 00 
+  800add:	ff d0                	call   *%rax
+            break;
+  800adf:	48 83 c4 10          	add    $0x10,%rsp
+  800ae3:	e9 3e fa ff ff       	jmp    800526 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ae8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af4:	eb b7                	jmp    800aad <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800af6:	40 84 f6             	test   %sil,%sil
+  800af9:	75 2b                	jne    800b26 <vprintfmt+0x631>
+    switch (lflag) {
+  800afb:	85 d2                	test   %edx,%edx
+  800afd:	74 56                	je     800b55 <vprintfmt+0x660>
+  800aff:	83 fa 01             	cmp    $0x1,%edx
+  800b02:	74 7f                	je     800b83 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b07:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0a:	0f 87 a2 00 00 00    	ja     800bb2 <vprintfmt+0x6bd>
+  800b10:	89 c2                	mov    %eax,%edx
+  800b12:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b16:	83 c0 08             	add    $0x8,%eax
+  800b19:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b1f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b24:	eb 8f                	jmp    800ab5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b29:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2c:	77 19                	ja     800b47 <vprintfmt+0x652>
+  800b2e:	89 c2                	mov    %eax,%edx
+  800b30:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b34:	83 c0 08             	add    $0x8,%eax
+  800b37:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b3d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b42:	e9 6e ff ff ff       	jmp    800ab5 <vprintfmt+0x5c0>
+  800b47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b53:	eb e5                	jmp    800b3a <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b58:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5b:	77 18                	ja     800b75 <vprintfmt+0x680>
+  800b5d:	89 c2                	mov    %eax,%edx
+  800b5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b63:	83 c0 08             	add    $0x8,%eax
+  800b66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b69:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b6b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b70:	e9 40 ff ff ff       	jmp    800ab5 <vprintfmt+0x5c0>
+  800b75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b79:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b81:	eb e6                	jmp    800b69 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b86:	83 f8 2f             	cmp    $0x2f,%eax
+  800b89:	77 19                	ja     800ba4 <vprintfmt+0x6af>
+  800b8b:	89 c2                	mov    %eax,%edx
+  800b8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b91:	83 c0 08             	add    $0x8,%eax
+  800b94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b97:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b9a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b9f:	e9 11 ff ff ff       	jmp    800ab5 <vprintfmt+0x5c0>
+  800ba4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb0:	eb e5                	jmp    800b97 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800bb2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbe:	e9 59 ff ff ff       	jmp    800b1c <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800bc3:	4c 89 ee             	mov    %r13,%rsi
+  800bc6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bcb:	41 ff d6             	call   *%r14
+            break;
+  800bce:	e9 53 f9 ff ff       	jmp    800526 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800bd3:	4c 89 ee             	mov    %r13,%rsi
+  800bd6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bdb:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bde:	48 83 eb 01          	sub    $0x1,%rbx
+  800be2:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800be6:	75 f6                	jne    800bde <vprintfmt+0x6e9>
+  800be8:	e9 39 f9 ff ff       	jmp    800526 <vprintfmt+0x31>
+}
+  800bed:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bf1:	5b                   	pop    %rbx
+  800bf2:	41 5c                	pop    %r12
+  800bf4:	41 5d                	pop    %r13
+  800bf6:	41 5e                	pop    %r14
+  800bf8:	41 5f                	pop    %r15
+  800bfa:	5d                   	pop    %rbp
+  800bfb:	c3                   	ret
+
+0000000000800bfc <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bfc:	55                   	push   %rbp
+  800bfd:	48 89 e5             	mov    %rsp,%rbp
+  800c00:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c04:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c08:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c0d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c11:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c18:	48 85 ff             	test   %rdi,%rdi
+  800c1b:	74 2b                	je     800c48 <vsnprintf+0x4c>
+  800c1d:	48 85 f6             	test   %rsi,%rsi
+  800c20:	74 26                	je     800c48 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c22:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c26:	48 bf a0 04 80 00 00 	movabs $0x8004a0,%rdi
+  800c2d:	00 00 00 
+  800c30:	48 b8 f5 04 80 00 00 	movabs $0x8004f5,%rax
+  800c37:	00 00 00 
+  800c3a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c40:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c43:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c46:	c9                   	leave
+  800c47:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c48:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c4d:	eb f7                	jmp    800c46 <vsnprintf+0x4a>
+
+0000000000800c4f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c4f:	55                   	push   %rbp
+  800c50:	48 89 e5             	mov    %rsp,%rbp
+  800c53:	48 83 ec 50          	sub    $0x50,%rsp
+  800c57:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c5b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c5f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c63:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c6a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c72:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c76:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c7a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c7e:	48 b8 fc 0b 80 00 00 	movabs $0x800bfc,%rax
+  800c85:	00 00 00 
+  800c88:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c8a:	c9                   	leave
+  800c8b:	c3                   	ret
+
+0000000000800c8c <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c8c:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c8f:	74 10                	je     800ca1 <strlen+0x15>
+    size_t n = 0;
+  800c91:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c96:	48 83 c0 01          	add    $0x1,%rax
+  800c9a:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c9e:	75 f6                	jne    800c96 <strlen+0xa>
+  800ca0:	c3                   	ret
+    size_t n = 0;
+  800ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ca6:	c3                   	ret
+
+0000000000800ca7 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ca7:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800caa:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800caf:	48 85 f6             	test   %rsi,%rsi
+  800cb2:	74 11                	je     800cc5 <strnlen+0x1e>
+  800cb4:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800cb8:	74 0c                	je     800cc6 <strnlen+0x1f>
+  800cba:	48 83 c2 01          	add    $0x1,%rdx
+  800cbe:	48 39 d0             	cmp    %rdx,%rax
+  800cc1:	75 f1                	jne    800cb4 <strnlen+0xd>
+  800cc3:	eb 04                	jmp    800cc9 <strnlen+0x22>
+  800cc5:	c3                   	ret
+  800cc6:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800cc9:	c3                   	ret
+
+0000000000800cca <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800cca:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ccd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd2:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800cd6:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cd9:	48 83 c2 01          	add    $0x1,%rdx
+  800cdd:	84 c9                	test   %cl,%cl
+  800cdf:	75 f1                	jne    800cd2 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ce1:	c3                   	ret
+
+0000000000800ce2 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ce2:	55                   	push   %rbp
+  800ce3:	48 89 e5             	mov    %rsp,%rbp
+  800ce6:	41 54                	push   %r12
+  800ce8:	53                   	push   %rbx
+  800ce9:	48 89 fb             	mov    %rdi,%rbx
+  800cec:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cef:	48 b8 8c 0c 80 00 00 	movabs $0x800c8c,%rax
+  800cf6:	00 00 00 
+  800cf9:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cfb:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800cff:	4c 89 e6             	mov    %r12,%rsi
+  800d02:	48 b8 ca 0c 80 00 00 	movabs $0x800cca,%rax
+  800d09:	00 00 00 
+  800d0c:	ff d0                	call   *%rax
+    return dst;
+}
+  800d0e:	48 89 d8             	mov    %rbx,%rax
+  800d11:	5b                   	pop    %rbx
+  800d12:	41 5c                	pop    %r12
+  800d14:	5d                   	pop    %rbp
+  800d15:	c3                   	ret
+
+0000000000800d16 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d16:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d19:	48 85 d2             	test   %rdx,%rdx
+  800d1c:	74 1f                	je     800d3d <strncpy+0x27>
+  800d1e:	48 01 fa             	add    %rdi,%rdx
+  800d21:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d24:	48 83 c1 01          	add    $0x1,%rcx
+  800d28:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d2c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d30:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d34:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d38:	48 39 ca             	cmp    %rcx,%rdx
+  800d3b:	75 e7                	jne    800d24 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d3d:	c3                   	ret
+
+0000000000800d3e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d3e:	48 89 f8             	mov    %rdi,%rax
+  800d41:	48 85 d2             	test   %rdx,%rdx
+  800d44:	74 24                	je     800d6a <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d46:	48 83 ea 01          	sub    $0x1,%rdx
+  800d4a:	74 1b                	je     800d67 <strlcpy+0x29>
+  800d4c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d50:	0f b6 16             	movzbl (%rsi),%edx
+  800d53:	84 d2                	test   %dl,%dl
+  800d55:	74 10                	je     800d67 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d57:	48 83 c6 01          	add    $0x1,%rsi
+  800d5b:	48 83 c0 01          	add    $0x1,%rax
+  800d5f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d62:	48 39 c8             	cmp    %rcx,%rax
+  800d65:	75 e9                	jne    800d50 <strlcpy+0x12>
+        *dst = '\0';
+  800d67:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d6a:	48 29 f8             	sub    %rdi,%rax
+}
+  800d6d:	c3                   	ret
+
+0000000000800d6e <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d6e:	0f b6 07             	movzbl (%rdi),%eax
+  800d71:	84 c0                	test   %al,%al
+  800d73:	74 13                	je     800d88 <strcmp+0x1a>
+  800d75:	38 06                	cmp    %al,(%rsi)
+  800d77:	75 0f                	jne    800d88 <strcmp+0x1a>
+  800d79:	48 83 c7 01          	add    $0x1,%rdi
+  800d7d:	48 83 c6 01          	add    $0x1,%rsi
+  800d81:	0f b6 07             	movzbl (%rdi),%eax
+  800d84:	84 c0                	test   %al,%al
+  800d86:	75 ed                	jne    800d75 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d88:	0f b6 c0             	movzbl %al,%eax
+  800d8b:	0f b6 16             	movzbl (%rsi),%edx
+  800d8e:	29 d0                	sub    %edx,%eax
+}
+  800d90:	c3                   	ret
+
+0000000000800d91 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d91:	48 85 d2             	test   %rdx,%rdx
+  800d94:	74 1f                	je     800db5 <strncmp+0x24>
+  800d96:	0f b6 07             	movzbl (%rdi),%eax
+  800d99:	84 c0                	test   %al,%al
+  800d9b:	74 1e                	je     800dbb <strncmp+0x2a>
+  800d9d:	3a 06                	cmp    (%rsi),%al
+  800d9f:	75 1a                	jne    800dbb <strncmp+0x2a>
+  800da1:	48 83 c7 01          	add    $0x1,%rdi
+  800da5:	48 83 c6 01          	add    $0x1,%rsi
+  800da9:	48 83 ea 01          	sub    $0x1,%rdx
+  800dad:	75 e7                	jne    800d96 <strncmp+0x5>
+
+    if (!n) return 0;
+  800daf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db4:	c3                   	ret
+  800db5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dba:	c3                   	ret
+  800dbb:	48 85 d2             	test   %rdx,%rdx
+  800dbe:	74 09                	je     800dc9 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dc0:	0f b6 07             	movzbl (%rdi),%eax
+  800dc3:	0f b6 16             	movzbl (%rsi),%edx
+  800dc6:	29 d0                	sub    %edx,%eax
+  800dc8:	c3                   	ret
+    if (!n) return 0;
+  800dc9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dce:	c3                   	ret
+
+0000000000800dcf <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800dcf:	0f b6 17             	movzbl (%rdi),%edx
+  800dd2:	84 d2                	test   %dl,%dl
+  800dd4:	74 18                	je     800dee <strchr+0x1f>
+        if (*str == c) {
+  800dd6:	0f be d2             	movsbl %dl,%edx
+  800dd9:	39 f2                	cmp    %esi,%edx
+  800ddb:	74 17                	je     800df4 <strchr+0x25>
+    for (; *str; str++) {
+  800ddd:	48 83 c7 01          	add    $0x1,%rdi
+  800de1:	0f b6 17             	movzbl (%rdi),%edx
+  800de4:	84 d2                	test   %dl,%dl
+  800de6:	75 ee                	jne    800dd6 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800de8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ded:	c3                   	ret
+  800dee:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df3:	c3                   	ret
+  800df4:	48 89 f8             	mov    %rdi,%rax
+}
+  800df7:	c3                   	ret
+
+0000000000800df8 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800df8:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800dfb:	0f b6 17             	movzbl (%rdi),%edx
+  800dfe:	84 d2                	test   %dl,%dl
+  800e00:	74 13                	je     800e15 <strfind+0x1d>
+  800e02:	0f be d2             	movsbl %dl,%edx
+  800e05:	39 f2                	cmp    %esi,%edx
+  800e07:	74 0b                	je     800e14 <strfind+0x1c>
+  800e09:	48 83 c0 01          	add    $0x1,%rax
+  800e0d:	0f b6 10             	movzbl (%rax),%edx
+  800e10:	84 d2                	test   %dl,%dl
+  800e12:	75 ee                	jne    800e02 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e14:	c3                   	ret
+  800e15:	c3                   	ret
+
+0000000000800e16 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e16:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e19:	48 89 f8             	mov    %rdi,%rax
+  800e1c:	48 f7 d8             	neg    %rax
+  800e1f:	83 e0 07             	and    $0x7,%eax
+  800e22:	49 89 d1             	mov    %rdx,%r9
+  800e25:	49 29 c1             	sub    %rax,%r9
+  800e28:	78 36                	js     800e60 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e2a:	40 0f b6 c6          	movzbl %sil,%eax
+  800e2e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e35:	01 01 01 
+  800e38:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e3c:	40 f6 c7 07          	test   $0x7,%dil
+  800e40:	75 38                	jne    800e7a <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e42:	4c 89 c9             	mov    %r9,%rcx
+  800e45:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e49:	74 0c                	je     800e57 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e4b:	fc                   	cld
+  800e4c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e4f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e53:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e57:	4d 85 c9             	test   %r9,%r9
+  800e5a:	75 45                	jne    800ea1 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e5c:	4c 89 c0             	mov    %r8,%rax
+  800e5f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e60:	48 85 d2             	test   %rdx,%rdx
+  800e63:	74 f7                	je     800e5c <memset+0x46>
+  800e65:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e68:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e6b:	48 83 c0 01          	add    $0x1,%rax
+  800e6f:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e73:	48 39 c2             	cmp    %rax,%rdx
+  800e76:	75 f3                	jne    800e6b <memset+0x55>
+  800e78:	eb e2                	jmp    800e5c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e7a:	40 f6 c7 01          	test   $0x1,%dil
+  800e7e:	74 06                	je     800e86 <memset+0x70>
+  800e80:	88 07                	mov    %al,(%rdi)
+  800e82:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e86:	40 f6 c7 02          	test   $0x2,%dil
+  800e8a:	74 07                	je     800e93 <memset+0x7d>
+  800e8c:	66 89 07             	mov    %ax,(%rdi)
+  800e8f:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e93:	40 f6 c7 04          	test   $0x4,%dil
+  800e97:	74 a9                	je     800e42 <memset+0x2c>
+  800e99:	89 07                	mov    %eax,(%rdi)
+  800e9b:	48 83 c7 04          	add    $0x4,%rdi
+  800e9f:	eb a1                	jmp    800e42 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ea1:	41 f6 c1 04          	test   $0x4,%r9b
+  800ea5:	74 06                	je     800ead <memset+0x97>
+  800ea7:	89 07                	mov    %eax,(%rdi)
+  800ea9:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ead:	41 f6 c1 02          	test   $0x2,%r9b
+  800eb1:	74 07                	je     800eba <memset+0xa4>
+  800eb3:	66 89 07             	mov    %ax,(%rdi)
+  800eb6:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800eba:	41 f6 c1 01          	test   $0x1,%r9b
+  800ebe:	74 9c                	je     800e5c <memset+0x46>
+  800ec0:	88 07                	mov    %al,(%rdi)
+  800ec2:	eb 98                	jmp    800e5c <memset+0x46>
+
+0000000000800ec4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ec4:	48 89 f8             	mov    %rdi,%rax
+  800ec7:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800eca:	48 39 fe             	cmp    %rdi,%rsi
+  800ecd:	73 3b                	jae    800f0a <memmove+0x46>
+  800ecf:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ed3:	48 39 d7             	cmp    %rdx,%rdi
+  800ed6:	73 32                	jae    800f0a <memmove+0x46>
+        s += n;
+        d += n;
+  800ed8:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800edc:	48 89 d6             	mov    %rdx,%rsi
+  800edf:	48 09 fe             	or     %rdi,%rsi
+  800ee2:	48 09 ce             	or     %rcx,%rsi
+  800ee5:	40 f6 c6 07          	test   $0x7,%sil
+  800ee9:	75 12                	jne    800efd <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800eeb:	48 83 ef 08          	sub    $0x8,%rdi
+  800eef:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800ef3:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ef7:	fd                   	std
+  800ef8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800efb:	fc                   	cld
+  800efc:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800efd:	48 83 ef 01          	sub    $0x1,%rdi
+  800f01:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f05:	fd                   	std
+  800f06:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f08:	eb f1                	jmp    800efb <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f0a:	48 89 f2             	mov    %rsi,%rdx
+  800f0d:	48 09 c2             	or     %rax,%rdx
+  800f10:	48 09 ca             	or     %rcx,%rdx
+  800f13:	f6 c2 07             	test   $0x7,%dl
+  800f16:	75 0c                	jne    800f24 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f18:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f1c:	48 89 c7             	mov    %rax,%rdi
+  800f1f:	fc                   	cld
+  800f20:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f23:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f24:	48 89 c7             	mov    %rax,%rdi
+  800f27:	fc                   	cld
+  800f28:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f2a:	c3                   	ret
+
+0000000000800f2b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f2b:	55                   	push   %rbp
+  800f2c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f2f:	48 b8 c4 0e 80 00 00 	movabs $0x800ec4,%rax
+  800f36:	00 00 00 
+  800f39:	ff d0                	call   *%rax
+}
+  800f3b:	5d                   	pop    %rbp
+  800f3c:	c3                   	ret
+
+0000000000800f3d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f3d:	55                   	push   %rbp
+  800f3e:	48 89 e5             	mov    %rsp,%rbp
+  800f41:	41 57                	push   %r15
+  800f43:	41 56                	push   %r14
+  800f45:	41 55                	push   %r13
+  800f47:	41 54                	push   %r12
+  800f49:	53                   	push   %rbx
+  800f4a:	48 83 ec 08          	sub    $0x8,%rsp
+  800f4e:	49 89 fe             	mov    %rdi,%r14
+  800f51:	49 89 f7             	mov    %rsi,%r15
+  800f54:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f57:	48 89 f7             	mov    %rsi,%rdi
+  800f5a:	48 b8 8c 0c 80 00 00 	movabs $0x800c8c,%rax
+  800f61:	00 00 00 
+  800f64:	ff d0                	call   *%rax
+  800f66:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f69:	48 89 de             	mov    %rbx,%rsi
+  800f6c:	4c 89 f7             	mov    %r14,%rdi
+  800f6f:	48 b8 a7 0c 80 00 00 	movabs $0x800ca7,%rax
+  800f76:	00 00 00 
+  800f79:	ff d0                	call   *%rax
+  800f7b:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f7e:	48 39 c3             	cmp    %rax,%rbx
+  800f81:	74 36                	je     800fb9 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f83:	48 89 d8             	mov    %rbx,%rax
+  800f86:	4c 29 e8             	sub    %r13,%rax
+  800f89:	49 39 c4             	cmp    %rax,%r12
+  800f8c:	73 31                	jae    800fbf <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f8e:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f93:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f97:	4c 89 fe             	mov    %r15,%rsi
+  800f9a:	48 b8 2b 0f 80 00 00 	movabs $0x800f2b,%rax
+  800fa1:	00 00 00 
+  800fa4:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fa6:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800faa:	48 83 c4 08          	add    $0x8,%rsp
+  800fae:	5b                   	pop    %rbx
+  800faf:	41 5c                	pop    %r12
+  800fb1:	41 5d                	pop    %r13
+  800fb3:	41 5e                	pop    %r14
+  800fb5:	41 5f                	pop    %r15
+  800fb7:	5d                   	pop    %rbp
+  800fb8:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fb9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fbd:	eb eb                	jmp    800faa <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fbf:	48 83 eb 01          	sub    $0x1,%rbx
+  800fc3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fc7:	48 89 da             	mov    %rbx,%rdx
+  800fca:	4c 89 fe             	mov    %r15,%rsi
+  800fcd:	48 b8 2b 0f 80 00 00 	movabs $0x800f2b,%rax
+  800fd4:	00 00 00 
+  800fd7:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fd9:	49 01 de             	add    %rbx,%r14
+  800fdc:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fe1:	eb c3                	jmp    800fa6 <strlcat+0x69>
+
+0000000000800fe3 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fe3:	48 85 d2             	test   %rdx,%rdx
+  800fe6:	74 2d                	je     801015 <memcmp+0x32>
+  800fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800fed:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ff1:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ff6:	44 38 c1             	cmp    %r8b,%cl
+  800ff9:	75 0f                	jne    80100a <memcmp+0x27>
+    while (n-- > 0) {
+  800ffb:	48 83 c0 01          	add    $0x1,%rax
+  800fff:	48 39 c2             	cmp    %rax,%rdx
+  801002:	75 e9                	jne    800fed <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801004:	b8 00 00 00 00       	mov    $0x0,%eax
+  801009:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80100a:	0f b6 c1             	movzbl %cl,%eax
+  80100d:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801011:	44 29 c0             	sub    %r8d,%eax
+  801014:	c3                   	ret
+    return 0;
+  801015:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80101a:	c3                   	ret
+
+000000000080101b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80101b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80101f:	48 39 c7             	cmp    %rax,%rdi
+  801022:	73 0f                	jae    801033 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801024:	40 38 37             	cmp    %sil,(%rdi)
+  801027:	74 0e                	je     801037 <memfind+0x1c>
+    for (; src < end; src++) {
+  801029:	48 83 c7 01          	add    $0x1,%rdi
+  80102d:	48 39 f8             	cmp    %rdi,%rax
+  801030:	75 f2                	jne    801024 <memfind+0x9>
+  801032:	c3                   	ret
+  801033:	48 89 f8             	mov    %rdi,%rax
+  801036:	c3                   	ret
+  801037:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80103a:	c3                   	ret
+
+000000000080103b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80103b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80103e:	0f b6 37             	movzbl (%rdi),%esi
+  801041:	40 80 fe 20          	cmp    $0x20,%sil
+  801045:	74 06                	je     80104d <strtol+0x12>
+  801047:	40 80 fe 09          	cmp    $0x9,%sil
+  80104b:	75 13                	jne    801060 <strtol+0x25>
+  80104d:	48 83 c7 01          	add    $0x1,%rdi
+  801051:	0f b6 37             	movzbl (%rdi),%esi
+  801054:	40 80 fe 20          	cmp    $0x20,%sil
+  801058:	74 f3                	je     80104d <strtol+0x12>
+  80105a:	40 80 fe 09          	cmp    $0x9,%sil
+  80105e:	74 ed                	je     80104d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801060:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801063:	83 e0 fd             	and    $0xfffffffd,%eax
+  801066:	3c 01                	cmp    $0x1,%al
+  801068:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80106c:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801072:	75 0f                	jne    801083 <strtol+0x48>
+  801074:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801077:	74 14                	je     80108d <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801079:	85 d2                	test   %edx,%edx
+  80107b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801080:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801083:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801088:	4c 63 ca             	movslq %edx,%r9
+  80108b:	eb 36                	jmp    8010c3 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80108d:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801091:	74 0f                	je     8010a2 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801093:	85 d2                	test   %edx,%edx
+  801095:	75 ec                	jne    801083 <strtol+0x48>
+        s++;
+  801097:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80109b:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010a0:	eb e1                	jmp    801083 <strtol+0x48>
+        s += 2;
+  8010a2:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010a6:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010ab:	eb d6                	jmp    801083 <strtol+0x48>
+            dig -= '0';
+  8010ad:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010b0:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010b4:	41 39 d0             	cmp    %edx,%r8d
+  8010b7:	7d 21                	jge    8010da <strtol+0x9f>
+        val = val * base + dig;
+  8010b9:	49 0f af c1          	imul   %r9,%rax
+  8010bd:	0f b6 c9             	movzbl %cl,%ecx
+  8010c0:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010c3:	48 83 c7 01          	add    $0x1,%rdi
+  8010c7:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010cb:	80 f9 39             	cmp    $0x39,%cl
+  8010ce:	76 dd                	jbe    8010ad <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010d0:	80 f9 7b             	cmp    $0x7b,%cl
+  8010d3:	77 05                	ja     8010da <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010d5:	83 e9 57             	sub    $0x57,%ecx
+  8010d8:	eb d6                	jmp    8010b0 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010da:	4d 85 d2             	test   %r10,%r10
+  8010dd:	74 03                	je     8010e2 <strtol+0xa7>
+  8010df:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010e2:	48 89 c2             	mov    %rax,%rdx
+  8010e5:	48 f7 da             	neg    %rdx
+  8010e8:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010ec:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010f0:	c3                   	ret
+
+00000000008010f1 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010f1:	55                   	push   %rbp
+  8010f2:	48 89 e5             	mov    %rsp,%rbp
+  8010f5:	53                   	push   %rbx
+  8010f6:	48 89 fa             	mov    %rdi,%rdx
+  8010f9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010fc:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801101:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801106:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80110b:	be 00 00 00 00       	mov    $0x0,%esi
+  801110:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801116:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801118:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80111c:	c9                   	leave
+  80111d:	c3                   	ret
+
+000000000080111e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80111e:	55                   	push   %rbp
+  80111f:	48 89 e5             	mov    %rsp,%rbp
+  801122:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801123:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801128:	ba 00 00 00 00       	mov    $0x0,%edx
+  80112d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801132:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801137:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80113c:	be 00 00 00 00       	mov    $0x0,%esi
+  801141:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801147:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801149:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80114d:	c9                   	leave
+  80114e:	c3                   	ret
+
+000000000080114f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80114f:	55                   	push   %rbp
+  801150:	48 89 e5             	mov    %rsp,%rbp
+  801153:	53                   	push   %rbx
+  801154:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801158:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80115b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801160:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801165:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80116f:	be 00 00 00 00       	mov    $0x0,%esi
+  801174:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80117a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80117c:	48 85 c0             	test   %rax,%rax
+  80117f:	7f 06                	jg     801187 <sys_env_destroy+0x38>
+}
+  801181:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801185:	c9                   	leave
+  801186:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801187:	49 89 c0             	mov    %rax,%r8
+  80118a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80118f:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  801196:	00 00 00 
+  801199:	be 26 00 00 00       	mov    $0x26,%esi
+  80119e:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  8011a5:	00 00 00 
+  8011a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ad:	49 b9 55 02 80 00 00 	movabs $0x800255,%r9
+  8011b4:	00 00 00 
+  8011b7:	41 ff d1             	call   *%r9
+
+00000000008011ba <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011ba:	55                   	push   %rbp
+  8011bb:	48 89 e5             	mov    %rsp,%rbp
+  8011be:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011bf:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011e3:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e9:	c9                   	leave
+  8011ea:	c3                   	ret
+
+00000000008011eb <sys_yield>:
+
+void
+sys_yield(void) {
+  8011eb:	55                   	push   %rbp
+  8011ec:	48 89 e5             	mov    %rsp,%rbp
+  8011ef:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801204:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801209:	be 00 00 00 00       	mov    $0x0,%esi
+  80120e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801214:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801216:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80121a:	c9                   	leave
+  80121b:	c3                   	ret
+
+000000000080121c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80121c:	55                   	push   %rbp
+  80121d:	48 89 e5             	mov    %rsp,%rbp
+  801220:	53                   	push   %rbx
+  801221:	48 89 fa             	mov    %rdi,%rdx
+  801224:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801227:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80122c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801233:	00 00 00 
+  801236:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80123b:	be 00 00 00 00       	mov    $0x0,%esi
+  801240:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801246:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801248:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124c:	c9                   	leave
+  80124d:	c3                   	ret
+
+000000000080124e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80124e:	55                   	push   %rbp
+  80124f:	48 89 e5             	mov    %rsp,%rbp
+  801252:	53                   	push   %rbx
+  801253:	49 89 f8             	mov    %rdi,%r8
+  801256:	48 89 d3             	mov    %rdx,%rbx
+  801259:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80125c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801261:	4c 89 c2             	mov    %r8,%rdx
+  801264:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801267:	be 00 00 00 00       	mov    $0x0,%esi
+  80126c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801272:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801274:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801278:	c9                   	leave
+  801279:	c3                   	ret
+
+000000000080127a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80127a:	55                   	push   %rbp
+  80127b:	48 89 e5             	mov    %rsp,%rbp
+  80127e:	53                   	push   %rbx
+  80127f:	48 83 ec 08          	sub    $0x8,%rsp
+  801283:	89 f8                	mov    %edi,%eax
+  801285:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801288:	48 63 f9             	movslq %ecx,%rdi
+  80128b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80128e:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801293:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801296:	be 00 00 00 00       	mov    $0x0,%esi
+  80129b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012a3:	48 85 c0             	test   %rax,%rax
+  8012a6:	7f 06                	jg     8012ae <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ac:	c9                   	leave
+  8012ad:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ae:	49 89 c0             	mov    %rax,%r8
+  8012b1:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012b6:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  8012bd:	00 00 00 
+  8012c0:	be 26 00 00 00       	mov    $0x26,%esi
+  8012c5:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  8012cc:	00 00 00 
+  8012cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d4:	49 b9 55 02 80 00 00 	movabs $0x800255,%r9
+  8012db:	00 00 00 
+  8012de:	41 ff d1             	call   *%r9
+
+00000000008012e1 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012e1:	55                   	push   %rbp
+  8012e2:	48 89 e5             	mov    %rsp,%rbp
+  8012e5:	53                   	push   %rbx
+  8012e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8012ea:	89 f8                	mov    %edi,%eax
+  8012ec:	49 89 f2             	mov    %rsi,%r10
+  8012ef:	48 89 cf             	mov    %rcx,%rdi
+  8012f2:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012f5:	48 63 da             	movslq %edx,%rbx
+  8012f8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012fb:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801300:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801303:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801306:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801308:	48 85 c0             	test   %rax,%rax
+  80130b:	7f 06                	jg     801313 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80130d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801311:	c9                   	leave
+  801312:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801313:	49 89 c0             	mov    %rax,%r8
+  801316:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80131b:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  801322:	00 00 00 
+  801325:	be 26 00 00 00       	mov    $0x26,%esi
+  80132a:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  801331:	00 00 00 
+  801334:	b8 00 00 00 00       	mov    $0x0,%eax
+  801339:	49 b9 55 02 80 00 00 	movabs $0x800255,%r9
+  801340:	00 00 00 
+  801343:	41 ff d1             	call   *%r9
+
+0000000000801346 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801346:	55                   	push   %rbp
+  801347:	48 89 e5             	mov    %rsp,%rbp
+  80134a:	53                   	push   %rbx
+  80134b:	48 83 ec 08          	sub    $0x8,%rsp
+  80134f:	48 89 f1             	mov    %rsi,%rcx
+  801352:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801355:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801358:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80135d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801362:	be 00 00 00 00       	mov    $0x0,%esi
+  801367:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80136d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80136f:	48 85 c0             	test   %rax,%rax
+  801372:	7f 06                	jg     80137a <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801374:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801378:	c9                   	leave
+  801379:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80137a:	49 89 c0             	mov    %rax,%r8
+  80137d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801382:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  801389:	00 00 00 
+  80138c:	be 26 00 00 00       	mov    $0x26,%esi
+  801391:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  801398:	00 00 00 
+  80139b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a0:	49 b9 55 02 80 00 00 	movabs $0x800255,%r9
+  8013a7:	00 00 00 
+  8013aa:	41 ff d1             	call   *%r9
+
+00000000008013ad <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8013ad:	55                   	push   %rbp
+  8013ae:	48 89 e5             	mov    %rsp,%rbp
+  8013b1:	53                   	push   %rbx
+  8013b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8013b6:	89 f8                	mov    %edi,%eax
+  8013b8:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8013bb:	48 63 f9             	movslq %ecx,%rdi
+  8013be:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c1:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013c6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013d6:	48 85 c0             	test   %rax,%rax
+  8013d9:	7f 06                	jg     8013e1 <sys_region_advise+0x34>
+}
+  8013db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013df:	c9                   	leave
+  8013e0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e1:	49 89 c0             	mov    %rax,%r8
+  8013e4:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8013e9:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  8013f0:	00 00 00 
+  8013f3:	be 26 00 00 00       	mov    $0x26,%esi
+  8013f8:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  8013ff:	00 00 00 
+  801402:	b8 00 00 00 00       	mov    $0x0,%eax
+  801407:	49 b9 55 02 80 00 00 	movabs $0x800255,%r9
+  80140e:	00 00 00 
+  801411:	41 ff d1             	call   *%r9
+
+0000000000801414 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801414:	55                   	push   %rbp
+  801415:	48 89 e5             	mov    %rsp,%rbp
+  801418:	53                   	push   %rbx
+  801419:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80141d:	48 63 ce             	movslq %esi,%rcx
+  801420:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801423:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801428:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801432:	be 00 00 00 00       	mov    $0x0,%esi
+  801437:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80143d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80143f:	48 85 c0             	test   %rax,%rax
+  801442:	7f 06                	jg     80144a <sys_env_set_nice+0x36>
+}
+  801444:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801448:	c9                   	leave
+  801449:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80144a:	49 89 c0             	mov    %rax,%r8
+  80144d:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801452:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  801459:	00 00 00 
+  80145c:	be 26 00 00 00       	mov    $0x26,%esi
+  801461:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  801468:	00 00 00 
+  80146b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801470:	49 b9 55 02 80 00 00 	movabs $0x800255,%r9
+  801477:	00 00 00 
+  80147a:	41 ff d1             	call   *%r9
+
+000000000080147d <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80147d:	55                   	push   %rbp
+  80147e:	48 89 e5             	mov    %rsp,%rbp
+  801481:	53                   	push   %rbx
+  801482:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801486:	48 63 ce             	movslq %esi,%rcx
+  801489:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80148c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801491:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801496:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149b:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a8:	48 85 c0             	test   %rax,%rax
+  8014ab:	7f 06                	jg     8014b3 <sys_env_set_status+0x36>
+}
+  8014ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b1:	c9                   	leave
+  8014b2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b3:	49 89 c0             	mov    %rax,%r8
+  8014b6:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014bb:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  8014c2:	00 00 00 
+  8014c5:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ca:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  8014d1:	00 00 00 
+  8014d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d9:	49 b9 55 02 80 00 00 	movabs $0x800255,%r9
+  8014e0:	00 00 00 
+  8014e3:	41 ff d1             	call   *%r9
+
+00000000008014e6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8014e6:	55                   	push   %rbp
+  8014e7:	48 89 e5             	mov    %rsp,%rbp
+  8014ea:	53                   	push   %rbx
+  8014eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ef:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8014f2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f5:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801504:	be 00 00 00 00       	mov    $0x0,%esi
+  801509:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80150f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801511:	48 85 c0             	test   %rax,%rax
+  801514:	7f 06                	jg     80151c <sys_env_set_trapframe+0x36>
+}
+  801516:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80151a:	c9                   	leave
+  80151b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80151c:	49 89 c0             	mov    %rax,%r8
+  80151f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801524:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  80152b:	00 00 00 
+  80152e:	be 26 00 00 00       	mov    $0x26,%esi
+  801533:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  80153a:	00 00 00 
+  80153d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801542:	49 b9 55 02 80 00 00 	movabs $0x800255,%r9
+  801549:	00 00 00 
+  80154c:	41 ff d1             	call   *%r9
+
+000000000080154f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80154f:	55                   	push   %rbp
+  801550:	48 89 e5             	mov    %rsp,%rbp
+  801553:	53                   	push   %rbx
+  801554:	48 83 ec 08          	sub    $0x8,%rsp
+  801558:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80155b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80155e:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801563:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801568:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80156d:	be 00 00 00 00       	mov    $0x0,%esi
+  801572:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801578:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80157a:	48 85 c0             	test   %rax,%rax
+  80157d:	7f 06                	jg     801585 <sys_env_set_pgfault_upcall+0x36>
+}
+  80157f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801583:	c9                   	leave
+  801584:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801585:	49 89 c0             	mov    %rax,%r8
+  801588:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80158d:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  801594:	00 00 00 
+  801597:	be 26 00 00 00       	mov    $0x26,%esi
+  80159c:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  8015a3:	00 00 00 
+  8015a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ab:	49 b9 55 02 80 00 00 	movabs $0x800255,%r9
+  8015b2:	00 00 00 
+  8015b5:	41 ff d1             	call   *%r9
+
+00000000008015b8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015b8:	55                   	push   %rbp
+  8015b9:	48 89 e5             	mov    %rsp,%rbp
+  8015bc:	53                   	push   %rbx
+  8015bd:	89 f8                	mov    %edi,%eax
+  8015bf:	49 89 f1             	mov    %rsi,%r9
+  8015c2:	48 89 d3             	mov    %rdx,%rbx
+  8015c5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015c8:	49 63 f0             	movslq %r8d,%rsi
+  8015cb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ce:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015d3:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015dc:	cd 30                	int    $0x30
+}
+  8015de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e2:	c9                   	leave
+  8015e3:	c3                   	ret
+
+00000000008015e4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8015e4:	55                   	push   %rbp
+  8015e5:	48 89 e5             	mov    %rsp,%rbp
+  8015e8:	53                   	push   %rbx
+  8015e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ed:	48 89 fa             	mov    %rdi,%rdx
+  8015f0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f3:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801602:	be 00 00 00 00       	mov    $0x0,%esi
+  801607:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80160f:	48 85 c0             	test   %rax,%rax
+  801612:	7f 06                	jg     80161a <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801614:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801618:	c9                   	leave
+  801619:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80161a:	49 89 c0             	mov    %rax,%r8
+  80161d:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801622:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  801629:	00 00 00 
+  80162c:	be 26 00 00 00       	mov    $0x26,%esi
+  801631:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  801638:	00 00 00 
+  80163b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801640:	49 b9 55 02 80 00 00 	movabs $0x800255,%r9
+  801647:	00 00 00 
+  80164a:	41 ff d1             	call   *%r9
+
+000000000080164d <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80164d:	55                   	push   %rbp
+  80164e:	48 89 e5             	mov    %rsp,%rbp
+  801651:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801652:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801657:	ba 00 00 00 00       	mov    $0x0,%edx
+  80165c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801661:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801666:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80166b:	be 00 00 00 00       	mov    $0x0,%esi
+  801670:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801676:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801678:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167c:	c9                   	leave
+  80167d:	c3                   	ret
+
+000000000080167e <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80167e:	55                   	push   %rbp
+  80167f:	48 89 e5             	mov    %rsp,%rbp
+  801682:	53                   	push   %rbx
+  801683:	48 83 ec 08          	sub    $0x8,%rsp
+  801687:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  80168a:	48 63 ce             	movslq %esi,%rcx
+  80168d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801690:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801695:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80169a:	be 00 00 00 00       	mov    $0x0,%esi
+  80169f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016a5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016a7:	48 85 c0             	test   %rax,%rax
+  8016aa:	7f 06                	jg     8016b2 <sys_sigqueue+0x34>
+}
+  8016ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016b0:	c9                   	leave
+  8016b1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016b2:	49 89 c0             	mov    %rax,%r8
+  8016b5:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8016ba:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  8016c1:	00 00 00 
+  8016c4:	be 26 00 00 00       	mov    $0x26,%esi
+  8016c9:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  8016d0:	00 00 00 
+  8016d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d8:	49 b9 55 02 80 00 00 	movabs $0x800255,%r9
+  8016df:	00 00 00 
+  8016e2:	41 ff d1             	call   *%r9
+
+00000000008016e5 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8016e5:	55                   	push   %rbp
+  8016e6:	48 89 e5             	mov    %rsp,%rbp
+  8016e9:	53                   	push   %rbx
+  8016ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ee:	48 89 fa             	mov    %rdi,%rdx
+  8016f1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f4:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801703:	be 00 00 00 00       	mov    $0x0,%esi
+  801708:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80170e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801710:	48 85 c0             	test   %rax,%rax
+  801713:	7f 06                	jg     80171b <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801715:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801719:	c9                   	leave
+  80171a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80171b:	49 89 c0             	mov    %rax,%r8
+  80171e:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801723:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  80172a:	00 00 00 
+  80172d:	be 26 00 00 00       	mov    $0x26,%esi
+  801732:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  801739:	00 00 00 
+  80173c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801741:	49 b9 55 02 80 00 00 	movabs $0x800255,%r9
+  801748:	00 00 00 
+  80174b:	41 ff d1             	call   *%r9
+
+000000000080174e <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80174e:	55                   	push   %rbp
+  80174f:	48 89 e5             	mov    %rsp,%rbp
+  801752:	53                   	push   %rbx
+  801753:	48 83 ec 08          	sub    $0x8,%rsp
+  801757:	48 89 f1             	mov    %rsi,%rcx
+  80175a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80175d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801760:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801765:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80176a:	be 00 00 00 00       	mov    $0x0,%esi
+  80176f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801775:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801777:	48 85 c0             	test   %rax,%rax
+  80177a:	7f 06                	jg     801782 <sys_sigaction+0x34>
+}
+  80177c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801780:	c9                   	leave
+  801781:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801782:	49 89 c0             	mov    %rax,%r8
+  801785:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80178a:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  801791:	00 00 00 
+  801794:	be 26 00 00 00       	mov    $0x26,%esi
+  801799:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  8017a0:	00 00 00 
+  8017a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a8:	49 b9 55 02 80 00 00 	movabs $0x800255,%r9
+  8017af:	00 00 00 
+  8017b2:	41 ff d1             	call   *%r9
+
+00000000008017b5 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8017b5:	55                   	push   %rbp
+  8017b6:	48 89 e5             	mov    %rsp,%rbp
+  8017b9:	53                   	push   %rbx
+  8017ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8017be:	48 89 f1             	mov    %rsi,%rcx
+  8017c1:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8017c4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017c7:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017de:	48 85 c0             	test   %rax,%rax
+  8017e1:	7f 06                	jg     8017e9 <sys_sigprocmask+0x34>
+}
+  8017e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e7:	c9                   	leave
+  8017e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017e9:	49 89 c0             	mov    %rax,%r8
+  8017ec:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8017f1:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  8017f8:	00 00 00 
+  8017fb:	be 26 00 00 00       	mov    $0x26,%esi
+  801800:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  801807:	00 00 00 
+  80180a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180f:	49 b9 55 02 80 00 00 	movabs $0x800255,%r9
+  801816:	00 00 00 
+  801819:	41 ff d1             	call   *%r9
+
+000000000080181c <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80181c:	55                   	push   %rbp
+  80181d:	48 89 e5             	mov    %rsp,%rbp
+  801820:	41 54                	push   %r12
+  801822:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801823:	b8 08 00 00 00       	mov    $0x8,%eax
+  801828:	cd 30                	int    $0x30
+  80182a:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  80182d:	85 c0                	test   %eax,%eax
+  80182f:	78 76                	js     8018a7 <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  801831:	74 7c                	je     8018af <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  801833:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801839:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801840:	00 00 00 
+  801843:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801848:	89 c2                	mov    %eax,%edx
+  80184a:	be 00 00 00 00       	mov    $0x0,%esi
+  80184f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801854:	48 b8 e1 12 80 00 00 	movabs $0x8012e1,%rax
+  80185b:	00 00 00 
+  80185e:	ff d0                	call   *%rax
+  801860:	85 c0                	test   %eax,%eax
+  801862:	75 7a                	jne    8018de <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  801864:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80186b:	00 00 00 
+  80186e:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801875:	44 89 e7             	mov    %r12d,%edi
+  801878:	48 b8 4f 15 80 00 00 	movabs $0x80154f,%rax
+  80187f:	00 00 00 
+  801882:	ff d0                	call   *%rax
+  801884:	85 c0                	test   %eax,%eax
+  801886:	75 5e                	jne    8018e6 <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  801888:	be 02 00 00 00       	mov    $0x2,%esi
+  80188d:	44 89 e7             	mov    %r12d,%edi
+  801890:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  801897:	00 00 00 
+  80189a:	ff d0                	call   *%rax
+        return -1;
+  80189c:	85 c0                	test   %eax,%eax
+  80189e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8018a3:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  8018a7:	44 89 e0             	mov    %r12d,%eax
+  8018aa:	5b                   	pop    %rbx
+  8018ab:	41 5c                	pop    %r12
+  8018ad:	5d                   	pop    %rbp
+  8018ae:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  8018af:	48 b8 ba 11 80 00 00 	movabs $0x8011ba,%rax
+  8018b6:	00 00 00 
+  8018b9:	ff d0                	call   *%rax
+  8018bb:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  8018be:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8018c5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018cc:	00 00 00 
+  8018cf:	48 01 d0             	add    %rdx,%rax
+  8018d2:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8018d9:	00 00 00 
+        return 0;
+  8018dc:	eb c9                	jmp    8018a7 <fork+0x8b>
+        return -1;
+  8018de:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8018e4:	eb c1                	jmp    8018a7 <fork+0x8b>
+        return -1;
+  8018e6:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8018ec:	eb b9                	jmp    8018a7 <fork+0x8b>
+
+00000000008018ee <sfork>:
+
+envid_t
+sfork() {
+  8018ee:	55                   	push   %rbp
+  8018ef:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8018f2:	48 ba 3d 33 80 00 00 	movabs $0x80333d,%rdx
+  8018f9:	00 00 00 
+  8018fc:	be 2e 00 00 00       	mov    $0x2e,%esi
+  801901:	48 bf 58 33 80 00 00 	movabs $0x803358,%rdi
+  801908:	00 00 00 
+  80190b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801910:	48 b9 55 02 80 00 00 	movabs $0x800255,%rcx
+  801917:	00 00 00 
+  80191a:	ff d1                	call   *%rcx
+
+000000000080191c <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80191c:	55                   	push   %rbp
+  80191d:	48 89 e5             	mov    %rsp,%rbp
+  801920:	41 54                	push   %r12
+  801922:	53                   	push   %rbx
+  801923:	48 89 fb             	mov    %rdi,%rbx
+  801926:	48 89 f7             	mov    %rsi,%rdi
+  801929:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  80192c:	48 85 f6             	test   %rsi,%rsi
+  80192f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801936:	00 00 00 
+  801939:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  80193d:	be 00 10 00 00       	mov    $0x1000,%esi
+  801942:	48 b8 e4 15 80 00 00 	movabs $0x8015e4,%rax
+  801949:	00 00 00 
+  80194c:	ff d0                	call   *%rax
+    if (res < 0) {
+  80194e:	85 c0                	test   %eax,%eax
+  801950:	78 45                	js     801997 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  801952:	48 85 db             	test   %rbx,%rbx
+  801955:	74 12                	je     801969 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  801957:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80195e:	00 00 00 
+  801961:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  801967:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  801969:	4d 85 e4             	test   %r12,%r12
+  80196c:	74 14                	je     801982 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  80196e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801975:	00 00 00 
+  801978:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  80197e:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  801982:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801989:	00 00 00 
+  80198c:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  801992:	5b                   	pop    %rbx
+  801993:	41 5c                	pop    %r12
+  801995:	5d                   	pop    %rbp
+  801996:	c3                   	ret
+        if (from_env_store)
+  801997:	48 85 db             	test   %rbx,%rbx
+  80199a:	74 06                	je     8019a2 <ipc_recv+0x86>
+            *from_env_store = 0;
+  80199c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  8019a2:	4d 85 e4             	test   %r12,%r12
+  8019a5:	74 eb                	je     801992 <ipc_recv+0x76>
+            *perm_store = 0;
+  8019a7:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8019ae:	00 
+  8019af:	eb e1                	jmp    801992 <ipc_recv+0x76>
+
+00000000008019b1 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8019b1:	55                   	push   %rbp
+  8019b2:	48 89 e5             	mov    %rsp,%rbp
+  8019b5:	41 57                	push   %r15
+  8019b7:	41 56                	push   %r14
+  8019b9:	41 55                	push   %r13
+  8019bb:	41 54                	push   %r12
+  8019bd:	53                   	push   %rbx
+  8019be:	48 83 ec 18          	sub    $0x18,%rsp
+  8019c2:	41 89 fd             	mov    %edi,%r13d
+  8019c5:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8019c8:	48 89 d3             	mov    %rdx,%rbx
+  8019cb:	49 89 cc             	mov    %rcx,%r12
+  8019ce:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8019d2:	48 85 d2             	test   %rdx,%rdx
+  8019d5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8019dc:	00 00 00 
+  8019df:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8019e3:	49 be b8 15 80 00 00 	movabs $0x8015b8,%r14
+  8019ea:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  8019ed:	49 bf eb 11 80 00 00 	movabs $0x8011eb,%r15
+  8019f4:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8019f7:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8019fa:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8019fe:	4c 89 e1             	mov    %r12,%rcx
+  801a01:	48 89 da             	mov    %rbx,%rdx
+  801a04:	44 89 ef             	mov    %r13d,%edi
+  801a07:	41 ff d6             	call   *%r14
+        if (res == 0)
+  801a0a:	85 c0                	test   %eax,%eax
+  801a0c:	74 34                	je     801a42 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  801a0e:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801a11:	75 05                	jne    801a18 <ipc_send+0x67>
+        sys_yield();
+  801a13:	41 ff d7             	call   *%r15
+    while (true) {
+  801a16:	eb df                	jmp    8019f7 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  801a18:	48 ba 63 33 80 00 00 	movabs $0x803363,%rdx
+  801a1f:	00 00 00 
+  801a22:	be 3e 00 00 00       	mov    $0x3e,%esi
+  801a27:	48 bf 7c 33 80 00 00 	movabs $0x80337c,%rdi
+  801a2e:	00 00 00 
+  801a31:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a36:	48 b9 55 02 80 00 00 	movabs $0x800255,%rcx
+  801a3d:	00 00 00 
+  801a40:	ff d1                	call   *%rcx
+    }
+}
+  801a42:	48 83 c4 18          	add    $0x18,%rsp
+  801a46:	5b                   	pop    %rbx
+  801a47:	41 5c                	pop    %r12
+  801a49:	41 5d                	pop    %r13
+  801a4b:	41 5e                	pop    %r14
+  801a4d:	41 5f                	pop    %r15
+  801a4f:	5d                   	pop    %rbp
+  801a50:	c3                   	ret
+
+0000000000801a51 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801a51:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  801a56:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801a5d:	00 00 00 
+  801a60:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  801a67:	48 01 ca             	add    %rcx,%rdx
+  801a6a:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  801a70:	39 fa                	cmp    %edi,%edx
+  801a72:	74 12                	je     801a86 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  801a74:	48 83 c0 01          	add    $0x1,%rax
+  801a78:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801a7e:	75 e0                	jne    801a60 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801a80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a85:	c3                   	ret
+            return envs[i].env_id;
+  801a86:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  801a8d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801a94:	00 00 00 
+  801a97:	48 01 d0             	add    %rdx,%rax
+  801a9a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801aa0:	c3                   	ret
+
+0000000000801aa1 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801aa1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801aa8:	ff ff ff 
+  801aab:	48 01 f8             	add    %rdi,%rax
+  801aae:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801ab2:	c3                   	ret
+
+0000000000801ab3 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ab3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801aba:	ff ff ff 
+  801abd:	48 01 f8             	add    %rdi,%rax
+  801ac0:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801ac4:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801aca:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801ace:	c3                   	ret
+
+0000000000801acf <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801acf:	55                   	push   %rbp
+  801ad0:	48 89 e5             	mov    %rsp,%rbp
+  801ad3:	41 57                	push   %r15
+  801ad5:	41 56                	push   %r14
+  801ad7:	41 55                	push   %r13
+  801ad9:	41 54                	push   %r12
+  801adb:	53                   	push   %rbx
+  801adc:	48 83 ec 08          	sub    $0x8,%rsp
+  801ae0:	49 89 ff             	mov    %rdi,%r15
+  801ae3:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801ae8:	49 bd 4d 2a 80 00 00 	movabs $0x802a4d,%r13
+  801aef:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801af2:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801af8:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801afb:	48 89 df             	mov    %rbx,%rdi
+  801afe:	41 ff d5             	call   *%r13
+  801b01:	83 e0 04             	and    $0x4,%eax
+  801b04:	74 17                	je     801b1d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801b06:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b0d:	4c 39 f3             	cmp    %r14,%rbx
+  801b10:	75 e6                	jne    801af8 <fd_alloc+0x29>
+  801b12:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801b18:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801b1d:	4d 89 27             	mov    %r12,(%r15)
+}
+  801b20:	48 83 c4 08          	add    $0x8,%rsp
+  801b24:	5b                   	pop    %rbx
+  801b25:	41 5c                	pop    %r12
+  801b27:	41 5d                	pop    %r13
+  801b29:	41 5e                	pop    %r14
+  801b2b:	41 5f                	pop    %r15
+  801b2d:	5d                   	pop    %rbp
+  801b2e:	c3                   	ret
+
+0000000000801b2f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801b2f:	83 ff 1f             	cmp    $0x1f,%edi
+  801b32:	77 39                	ja     801b6d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801b34:	55                   	push   %rbp
+  801b35:	48 89 e5             	mov    %rsp,%rbp
+  801b38:	41 54                	push   %r12
+  801b3a:	53                   	push   %rbx
+  801b3b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801b3e:	48 63 df             	movslq %edi,%rbx
+  801b41:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801b48:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801b4c:	48 89 df             	mov    %rbx,%rdi
+  801b4f:	48 b8 4d 2a 80 00 00 	movabs $0x802a4d,%rax
+  801b56:	00 00 00 
+  801b59:	ff d0                	call   *%rax
+  801b5b:	a8 04                	test   $0x4,%al
+  801b5d:	74 14                	je     801b73 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801b5f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801b63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b68:	5b                   	pop    %rbx
+  801b69:	41 5c                	pop    %r12
+  801b6b:	5d                   	pop    %rbp
+  801b6c:	c3                   	ret
+        return -E_INVAL;
+  801b6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b72:	c3                   	ret
+        return -E_INVAL;
+  801b73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b78:	eb ee                	jmp    801b68 <fd_lookup+0x39>
+
+0000000000801b7a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b7a:	55                   	push   %rbp
+  801b7b:	48 89 e5             	mov    %rsp,%rbp
+  801b7e:	41 54                	push   %r12
+  801b80:	53                   	push   %rbx
+  801b81:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b84:	48 b8 20 34 80 00 00 	movabs $0x803420,%rax
+  801b8b:	00 00 00 
+  801b8e:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801b95:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b98:	39 3b                	cmp    %edi,(%rbx)
+  801b9a:	74 47                	je     801be3 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b9c:	48 83 c0 08          	add    $0x8,%rax
+  801ba0:	48 8b 18             	mov    (%rax),%rbx
+  801ba3:	48 85 db             	test   %rbx,%rbx
+  801ba6:	75 f0                	jne    801b98 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ba8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801baf:	00 00 00 
+  801bb2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bb8:	89 fa                	mov    %edi,%edx
+  801bba:	48 bf 88 33 80 00 00 	movabs $0x803388,%rdi
+  801bc1:	00 00 00 
+  801bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc9:	48 b9 a5 03 80 00 00 	movabs $0x8003a5,%rcx
+  801bd0:	00 00 00 
+  801bd3:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801bd5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801bda:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801bde:	5b                   	pop    %rbx
+  801bdf:	41 5c                	pop    %r12
+  801be1:	5d                   	pop    %rbp
+  801be2:	c3                   	ret
+            return 0;
+  801be3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be8:	eb f0                	jmp    801bda <dev_lookup+0x60>
+
+0000000000801bea <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801bea:	55                   	push   %rbp
+  801beb:	48 89 e5             	mov    %rsp,%rbp
+  801bee:	41 55                	push   %r13
+  801bf0:	41 54                	push   %r12
+  801bf2:	53                   	push   %rbx
+  801bf3:	48 83 ec 18          	sub    $0x18,%rsp
+  801bf7:	48 89 fb             	mov    %rdi,%rbx
+  801bfa:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801bfd:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801c04:	ff ff ff 
+  801c07:	48 01 df             	add    %rbx,%rdi
+  801c0a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801c0e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c12:	48 b8 2f 1b 80 00 00 	movabs $0x801b2f,%rax
+  801c19:	00 00 00 
+  801c1c:	ff d0                	call   *%rax
+  801c1e:	41 89 c5             	mov    %eax,%r13d
+  801c21:	85 c0                	test   %eax,%eax
+  801c23:	78 06                	js     801c2b <fd_close+0x41>
+  801c25:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801c29:	74 1a                	je     801c45 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801c2b:	45 84 e4             	test   %r12b,%r12b
+  801c2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c33:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801c37:	44 89 e8             	mov    %r13d,%eax
+  801c3a:	48 83 c4 18          	add    $0x18,%rsp
+  801c3e:	5b                   	pop    %rbx
+  801c3f:	41 5c                	pop    %r12
+  801c41:	41 5d                	pop    %r13
+  801c43:	5d                   	pop    %rbp
+  801c44:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c45:	8b 3b                	mov    (%rbx),%edi
+  801c47:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c4b:	48 b8 7a 1b 80 00 00 	movabs $0x801b7a,%rax
+  801c52:	00 00 00 
+  801c55:	ff d0                	call   *%rax
+  801c57:	41 89 c5             	mov    %eax,%r13d
+  801c5a:	85 c0                	test   %eax,%eax
+  801c5c:	78 1b                	js     801c79 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801c5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c62:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c66:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c6c:	48 85 c0             	test   %rax,%rax
+  801c6f:	74 08                	je     801c79 <fd_close+0x8f>
+  801c71:	48 89 df             	mov    %rbx,%rdi
+  801c74:	ff d0                	call   *%rax
+  801c76:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c79:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c7e:	48 89 de             	mov    %rbx,%rsi
+  801c81:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c86:	48 b8 46 13 80 00 00 	movabs $0x801346,%rax
+  801c8d:	00 00 00 
+  801c90:	ff d0                	call   *%rax
+    return res;
+  801c92:	eb a3                	jmp    801c37 <fd_close+0x4d>
+
+0000000000801c94 <close>:
+
+int
+close(int fdnum) {
+  801c94:	55                   	push   %rbp
+  801c95:	48 89 e5             	mov    %rsp,%rbp
+  801c98:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c9c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ca0:	48 b8 2f 1b 80 00 00 	movabs $0x801b2f,%rax
+  801ca7:	00 00 00 
+  801caa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801cac:	85 c0                	test   %eax,%eax
+  801cae:	78 15                	js     801cc5 <close+0x31>
+
+    return fd_close(fd, 1);
+  801cb0:	be 01 00 00 00       	mov    $0x1,%esi
+  801cb5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801cb9:	48 b8 ea 1b 80 00 00 	movabs $0x801bea,%rax
+  801cc0:	00 00 00 
+  801cc3:	ff d0                	call   *%rax
+}
+  801cc5:	c9                   	leave
+  801cc6:	c3                   	ret
+
+0000000000801cc7 <close_all>:
+
+void
+close_all(void) {
+  801cc7:	55                   	push   %rbp
+  801cc8:	48 89 e5             	mov    %rsp,%rbp
+  801ccb:	41 54                	push   %r12
+  801ccd:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801cce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cd3:	49 bc 94 1c 80 00 00 	movabs $0x801c94,%r12
+  801cda:	00 00 00 
+  801cdd:	89 df                	mov    %ebx,%edi
+  801cdf:	41 ff d4             	call   *%r12
+  801ce2:	83 c3 01             	add    $0x1,%ebx
+  801ce5:	83 fb 20             	cmp    $0x20,%ebx
+  801ce8:	75 f3                	jne    801cdd <close_all+0x16>
+}
+  801cea:	5b                   	pop    %rbx
+  801ceb:	41 5c                	pop    %r12
+  801ced:	5d                   	pop    %rbp
+  801cee:	c3                   	ret
+
+0000000000801cef <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801cef:	55                   	push   %rbp
+  801cf0:	48 89 e5             	mov    %rsp,%rbp
+  801cf3:	41 57                	push   %r15
+  801cf5:	41 56                	push   %r14
+  801cf7:	41 55                	push   %r13
+  801cf9:	41 54                	push   %r12
+  801cfb:	53                   	push   %rbx
+  801cfc:	48 83 ec 18          	sub    $0x18,%rsp
+  801d00:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801d03:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801d07:	48 b8 2f 1b 80 00 00 	movabs $0x801b2f,%rax
+  801d0e:	00 00 00 
+  801d11:	ff d0                	call   *%rax
+  801d13:	89 c3                	mov    %eax,%ebx
+  801d15:	85 c0                	test   %eax,%eax
+  801d17:	0f 88 b8 00 00 00    	js     801dd5 <dup+0xe6>
+    close(newfdnum);
+  801d1d:	44 89 e7             	mov    %r12d,%edi
+  801d20:	48 b8 94 1c 80 00 00 	movabs $0x801c94,%rax
+  801d27:	00 00 00 
+  801d2a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801d2c:	4d 63 ec             	movslq %r12d,%r13
+  801d2f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801d36:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801d3a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801d3e:	4c 89 ff             	mov    %r15,%rdi
+  801d41:	49 be b3 1a 80 00 00 	movabs $0x801ab3,%r14
+  801d48:	00 00 00 
+  801d4b:	41 ff d6             	call   *%r14
+  801d4e:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801d51:	4c 89 ef             	mov    %r13,%rdi
+  801d54:	41 ff d6             	call   *%r14
+  801d57:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801d5a:	48 89 df             	mov    %rbx,%rdi
+  801d5d:	48 b8 4d 2a 80 00 00 	movabs $0x802a4d,%rax
+  801d64:	00 00 00 
+  801d67:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801d69:	a8 04                	test   $0x4,%al
+  801d6b:	74 2b                	je     801d98 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801d6d:	41 89 c1             	mov    %eax,%r9d
+  801d70:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d76:	4c 89 f1             	mov    %r14,%rcx
+  801d79:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d7e:	48 89 de             	mov    %rbx,%rsi
+  801d81:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d86:	48 b8 e1 12 80 00 00 	movabs $0x8012e1,%rax
+  801d8d:	00 00 00 
+  801d90:	ff d0                	call   *%rax
+  801d92:	89 c3                	mov    %eax,%ebx
+  801d94:	85 c0                	test   %eax,%eax
+  801d96:	78 4e                	js     801de6 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d98:	4c 89 ff             	mov    %r15,%rdi
+  801d9b:	48 b8 4d 2a 80 00 00 	movabs $0x802a4d,%rax
+  801da2:	00 00 00 
+  801da5:	ff d0                	call   *%rax
+  801da7:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801daa:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801db0:	4c 89 e9             	mov    %r13,%rcx
+  801db3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801db8:	4c 89 fe             	mov    %r15,%rsi
+  801dbb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dc0:	48 b8 e1 12 80 00 00 	movabs $0x8012e1,%rax
+  801dc7:	00 00 00 
+  801dca:	ff d0                	call   *%rax
+  801dcc:	89 c3                	mov    %eax,%ebx
+  801dce:	85 c0                	test   %eax,%eax
+  801dd0:	78 14                	js     801de6 <dup+0xf7>
+
+    return newfdnum;
+  801dd2:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801dd5:	89 d8                	mov    %ebx,%eax
+  801dd7:	48 83 c4 18          	add    $0x18,%rsp
+  801ddb:	5b                   	pop    %rbx
+  801ddc:	41 5c                	pop    %r12
+  801dde:	41 5d                	pop    %r13
+  801de0:	41 5e                	pop    %r14
+  801de2:	41 5f                	pop    %r15
+  801de4:	5d                   	pop    %rbp
+  801de5:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801de6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801deb:	4c 89 ee             	mov    %r13,%rsi
+  801dee:	bf 00 00 00 00       	mov    $0x0,%edi
+  801df3:	49 bc 46 13 80 00 00 	movabs $0x801346,%r12
+  801dfa:	00 00 00 
+  801dfd:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801e00:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e05:	4c 89 f6             	mov    %r14,%rsi
+  801e08:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e0d:	41 ff d4             	call   *%r12
+    return res;
+  801e10:	eb c3                	jmp    801dd5 <dup+0xe6>
+
+0000000000801e12 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801e12:	55                   	push   %rbp
+  801e13:	48 89 e5             	mov    %rsp,%rbp
+  801e16:	41 56                	push   %r14
+  801e18:	41 55                	push   %r13
+  801e1a:	41 54                	push   %r12
+  801e1c:	53                   	push   %rbx
+  801e1d:	48 83 ec 10          	sub    $0x10,%rsp
+  801e21:	89 fb                	mov    %edi,%ebx
+  801e23:	49 89 f4             	mov    %rsi,%r12
+  801e26:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e29:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e2d:	48 b8 2f 1b 80 00 00 	movabs $0x801b2f,%rax
+  801e34:	00 00 00 
+  801e37:	ff d0                	call   *%rax
+  801e39:	85 c0                	test   %eax,%eax
+  801e3b:	78 4c                	js     801e89 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e3d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e41:	41 8b 3e             	mov    (%r14),%edi
+  801e44:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e48:	48 b8 7a 1b 80 00 00 	movabs $0x801b7a,%rax
+  801e4f:	00 00 00 
+  801e52:	ff d0                	call   *%rax
+  801e54:	85 c0                	test   %eax,%eax
+  801e56:	78 35                	js     801e8d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e58:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e5c:	83 e0 03             	and    $0x3,%eax
+  801e5f:	83 f8 01             	cmp    $0x1,%eax
+  801e62:	74 2d                	je     801e91 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e64:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e68:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e6c:	48 85 c0             	test   %rax,%rax
+  801e6f:	74 56                	je     801ec7 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801e71:	4c 89 ea             	mov    %r13,%rdx
+  801e74:	4c 89 e6             	mov    %r12,%rsi
+  801e77:	4c 89 f7             	mov    %r14,%rdi
+  801e7a:	ff d0                	call   *%rax
+}
+  801e7c:	48 83 c4 10          	add    $0x10,%rsp
+  801e80:	5b                   	pop    %rbx
+  801e81:	41 5c                	pop    %r12
+  801e83:	41 5d                	pop    %r13
+  801e85:	41 5e                	pop    %r14
+  801e87:	5d                   	pop    %rbp
+  801e88:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e89:	48 98                	cltq
+  801e8b:	eb ef                	jmp    801e7c <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e8d:	48 98                	cltq
+  801e8f:	eb eb                	jmp    801e7c <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e91:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e98:	00 00 00 
+  801e9b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ea1:	89 da                	mov    %ebx,%edx
+  801ea3:	48 bf c9 33 80 00 00 	movabs $0x8033c9,%rdi
+  801eaa:	00 00 00 
+  801ead:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb2:	48 b9 a5 03 80 00 00 	movabs $0x8003a5,%rcx
+  801eb9:	00 00 00 
+  801ebc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ebe:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ec5:	eb b5                	jmp    801e7c <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ec7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ece:	eb ac                	jmp    801e7c <read+0x6a>
+
+0000000000801ed0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801ed0:	55                   	push   %rbp
+  801ed1:	48 89 e5             	mov    %rsp,%rbp
+  801ed4:	41 57                	push   %r15
+  801ed6:	41 56                	push   %r14
+  801ed8:	41 55                	push   %r13
+  801eda:	41 54                	push   %r12
+  801edc:	53                   	push   %rbx
+  801edd:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801ee1:	48 85 d2             	test   %rdx,%rdx
+  801ee4:	74 54                	je     801f3a <readn+0x6a>
+  801ee6:	41 89 fd             	mov    %edi,%r13d
+  801ee9:	49 89 f6             	mov    %rsi,%r14
+  801eec:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801eef:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801ef4:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ef9:	49 bf 12 1e 80 00 00 	movabs $0x801e12,%r15
+  801f00:	00 00 00 
+  801f03:	4c 89 e2             	mov    %r12,%rdx
+  801f06:	48 29 f2             	sub    %rsi,%rdx
+  801f09:	4c 01 f6             	add    %r14,%rsi
+  801f0c:	44 89 ef             	mov    %r13d,%edi
+  801f0f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801f12:	85 c0                	test   %eax,%eax
+  801f14:	78 20                	js     801f36 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801f16:	01 c3                	add    %eax,%ebx
+  801f18:	85 c0                	test   %eax,%eax
+  801f1a:	74 08                	je     801f24 <readn+0x54>
+  801f1c:	48 63 f3             	movslq %ebx,%rsi
+  801f1f:	4c 39 e6             	cmp    %r12,%rsi
+  801f22:	72 df                	jb     801f03 <readn+0x33>
+    }
+    return res;
+  801f24:	48 63 c3             	movslq %ebx,%rax
+}
+  801f27:	48 83 c4 08          	add    $0x8,%rsp
+  801f2b:	5b                   	pop    %rbx
+  801f2c:	41 5c                	pop    %r12
+  801f2e:	41 5d                	pop    %r13
+  801f30:	41 5e                	pop    %r14
+  801f32:	41 5f                	pop    %r15
+  801f34:	5d                   	pop    %rbp
+  801f35:	c3                   	ret
+        if (inc < 0) return inc;
+  801f36:	48 98                	cltq
+  801f38:	eb ed                	jmp    801f27 <readn+0x57>
+    int inc = 1, res = 0;
+  801f3a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f3f:	eb e3                	jmp    801f24 <readn+0x54>
+
+0000000000801f41 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f41:	55                   	push   %rbp
+  801f42:	48 89 e5             	mov    %rsp,%rbp
+  801f45:	41 56                	push   %r14
+  801f47:	41 55                	push   %r13
+  801f49:	41 54                	push   %r12
+  801f4b:	53                   	push   %rbx
+  801f4c:	48 83 ec 10          	sub    $0x10,%rsp
+  801f50:	89 fb                	mov    %edi,%ebx
+  801f52:	49 89 f4             	mov    %rsi,%r12
+  801f55:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f58:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f5c:	48 b8 2f 1b 80 00 00 	movabs $0x801b2f,%rax
+  801f63:	00 00 00 
+  801f66:	ff d0                	call   *%rax
+  801f68:	85 c0                	test   %eax,%eax
+  801f6a:	78 47                	js     801fb3 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f6c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f70:	41 8b 3e             	mov    (%r14),%edi
+  801f73:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f77:	48 b8 7a 1b 80 00 00 	movabs $0x801b7a,%rax
+  801f7e:	00 00 00 
+  801f81:	ff d0                	call   *%rax
+  801f83:	85 c0                	test   %eax,%eax
+  801f85:	78 30                	js     801fb7 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f87:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f8c:	74 2d                	je     801fbb <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f8e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f92:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f96:	48 85 c0             	test   %rax,%rax
+  801f99:	74 56                	je     801ff1 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f9b:	4c 89 ea             	mov    %r13,%rdx
+  801f9e:	4c 89 e6             	mov    %r12,%rsi
+  801fa1:	4c 89 f7             	mov    %r14,%rdi
+  801fa4:	ff d0                	call   *%rax
+}
+  801fa6:	48 83 c4 10          	add    $0x10,%rsp
+  801faa:	5b                   	pop    %rbx
+  801fab:	41 5c                	pop    %r12
+  801fad:	41 5d                	pop    %r13
+  801faf:	41 5e                	pop    %r14
+  801fb1:	5d                   	pop    %rbp
+  801fb2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fb3:	48 98                	cltq
+  801fb5:	eb ef                	jmp    801fa6 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fb7:	48 98                	cltq
+  801fb9:	eb eb                	jmp    801fa6 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fbb:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801fc2:	00 00 00 
+  801fc5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fcb:	89 da                	mov    %ebx,%edx
+  801fcd:	48 bf e5 33 80 00 00 	movabs $0x8033e5,%rdi
+  801fd4:	00 00 00 
+  801fd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fdc:	48 b9 a5 03 80 00 00 	movabs $0x8003a5,%rcx
+  801fe3:	00 00 00 
+  801fe6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fe8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fef:	eb b5                	jmp    801fa6 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ff1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ff8:	eb ac                	jmp    801fa6 <write+0x65>
+
+0000000000801ffa <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ffa:	55                   	push   %rbp
+  801ffb:	48 89 e5             	mov    %rsp,%rbp
+  801ffe:	53                   	push   %rbx
+  801fff:	48 83 ec 18          	sub    $0x18,%rsp
+  802003:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802005:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802009:	48 b8 2f 1b 80 00 00 	movabs $0x801b2f,%rax
+  802010:	00 00 00 
+  802013:	ff d0                	call   *%rax
+  802015:	85 c0                	test   %eax,%eax
+  802017:	78 0c                	js     802025 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802019:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80201d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802020:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802025:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802029:	c9                   	leave
+  80202a:	c3                   	ret
+
+000000000080202b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80202b:	55                   	push   %rbp
+  80202c:	48 89 e5             	mov    %rsp,%rbp
+  80202f:	41 55                	push   %r13
+  802031:	41 54                	push   %r12
+  802033:	53                   	push   %rbx
+  802034:	48 83 ec 18          	sub    $0x18,%rsp
+  802038:	89 fb                	mov    %edi,%ebx
+  80203a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80203d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802041:	48 b8 2f 1b 80 00 00 	movabs $0x801b2f,%rax
+  802048:	00 00 00 
+  80204b:	ff d0                	call   *%rax
+  80204d:	85 c0                	test   %eax,%eax
+  80204f:	78 38                	js     802089 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802051:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802055:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802059:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80205d:	48 b8 7a 1b 80 00 00 	movabs $0x801b7a,%rax
+  802064:	00 00 00 
+  802067:	ff d0                	call   *%rax
+  802069:	85 c0                	test   %eax,%eax
+  80206b:	78 1c                	js     802089 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80206d:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802072:	74 20                	je     802094 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802074:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802078:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80207c:	48 85 c0             	test   %rax,%rax
+  80207f:	74 47                	je     8020c8 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802081:	44 89 e6             	mov    %r12d,%esi
+  802084:	4c 89 ef             	mov    %r13,%rdi
+  802087:	ff d0                	call   *%rax
+}
+  802089:	48 83 c4 18          	add    $0x18,%rsp
+  80208d:	5b                   	pop    %rbx
+  80208e:	41 5c                	pop    %r12
+  802090:	41 5d                	pop    %r13
+  802092:	5d                   	pop    %rbp
+  802093:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802094:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80209b:	00 00 00 
+  80209e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8020a4:	89 da                	mov    %ebx,%edx
+  8020a6:	48 bf a8 33 80 00 00 	movabs $0x8033a8,%rdi
+  8020ad:	00 00 00 
+  8020b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b5:	48 b9 a5 03 80 00 00 	movabs $0x8003a5,%rcx
+  8020bc:	00 00 00 
+  8020bf:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020c6:	eb c1                	jmp    802089 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020c8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020cd:	eb ba                	jmp    802089 <ftruncate+0x5e>
+
+00000000008020cf <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8020cf:	55                   	push   %rbp
+  8020d0:	48 89 e5             	mov    %rsp,%rbp
+  8020d3:	41 54                	push   %r12
+  8020d5:	53                   	push   %rbx
+  8020d6:	48 83 ec 10          	sub    $0x10,%rsp
+  8020da:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020dd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020e1:	48 b8 2f 1b 80 00 00 	movabs $0x801b2f,%rax
+  8020e8:	00 00 00 
+  8020eb:	ff d0                	call   *%rax
+  8020ed:	85 c0                	test   %eax,%eax
+  8020ef:	78 4e                	js     80213f <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020f1:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8020f5:	41 8b 3c 24          	mov    (%r12),%edi
+  8020f9:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020fd:	48 b8 7a 1b 80 00 00 	movabs $0x801b7a,%rax
+  802104:	00 00 00 
+  802107:	ff d0                	call   *%rax
+  802109:	85 c0                	test   %eax,%eax
+  80210b:	78 32                	js     80213f <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80210d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802111:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802116:	74 30                	je     802148 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802118:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80211b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802122:	00 00 00 
+    stat->st_isdir = 0;
+  802125:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80212c:	00 00 00 
+    stat->st_dev = dev;
+  80212f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802136:	48 89 de             	mov    %rbx,%rsi
+  802139:	4c 89 e7             	mov    %r12,%rdi
+  80213c:	ff 50 28             	call   *0x28(%rax)
+}
+  80213f:	48 83 c4 10          	add    $0x10,%rsp
+  802143:	5b                   	pop    %rbx
+  802144:	41 5c                	pop    %r12
+  802146:	5d                   	pop    %rbp
+  802147:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802148:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80214d:	eb f0                	jmp    80213f <fstat+0x70>
+
+000000000080214f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80214f:	55                   	push   %rbp
+  802150:	48 89 e5             	mov    %rsp,%rbp
+  802153:	41 54                	push   %r12
+  802155:	53                   	push   %rbx
+  802156:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802159:	be 00 00 00 00       	mov    $0x0,%esi
+  80215e:	48 b8 d0 23 80 00 00 	movabs $0x8023d0,%rax
+  802165:	00 00 00 
+  802168:	ff d0                	call   *%rax
+  80216a:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80216c:	85 c0                	test   %eax,%eax
+  80216e:	78 25                	js     802195 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802170:	4c 89 e6             	mov    %r12,%rsi
+  802173:	89 c7                	mov    %eax,%edi
+  802175:	48 b8 cf 20 80 00 00 	movabs $0x8020cf,%rax
+  80217c:	00 00 00 
+  80217f:	ff d0                	call   *%rax
+  802181:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802184:	89 df                	mov    %ebx,%edi
+  802186:	48 b8 94 1c 80 00 00 	movabs $0x801c94,%rax
+  80218d:	00 00 00 
+  802190:	ff d0                	call   *%rax
+
+    return res;
+  802192:	44 89 e3             	mov    %r12d,%ebx
+}
+  802195:	89 d8                	mov    %ebx,%eax
+  802197:	5b                   	pop    %rbx
+  802198:	41 5c                	pop    %r12
+  80219a:	5d                   	pop    %rbp
+  80219b:	c3                   	ret
+
+000000000080219c <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  80219c:	55                   	push   %rbp
+  80219d:	48 89 e5             	mov    %rsp,%rbp
+  8021a0:	41 54                	push   %r12
+  8021a2:	53                   	push   %rbx
+  8021a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8021a7:	41 89 fc             	mov    %edi,%r12d
+  8021aa:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021ad:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8021b4:	00 00 00 
+  8021b7:	83 38 00             	cmpl   $0x0,(%rax)
+  8021ba:	74 5e                	je     80221a <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8021bc:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8021c2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021c7:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8021ce:	00 00 00 
+  8021d1:	44 89 e6             	mov    %r12d,%esi
+  8021d4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8021db:	00 00 00 
+  8021de:	8b 38                	mov    (%rax),%edi
+  8021e0:	48 b8 b1 19 80 00 00 	movabs $0x8019b1,%rax
+  8021e7:	00 00 00 
+  8021ea:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8021ec:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8021f3:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8021f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021f9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8021fd:	48 89 de             	mov    %rbx,%rsi
+  802200:	bf 00 00 00 00       	mov    $0x0,%edi
+  802205:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  80220c:	00 00 00 
+  80220f:	ff d0                	call   *%rax
+}
+  802211:	48 83 c4 10          	add    $0x10,%rsp
+  802215:	5b                   	pop    %rbx
+  802216:	41 5c                	pop    %r12
+  802218:	5d                   	pop    %rbp
+  802219:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80221a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80221f:	48 b8 51 1a 80 00 00 	movabs $0x801a51,%rax
+  802226:	00 00 00 
+  802229:	ff d0                	call   *%rax
+  80222b:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802232:	00 00 
+  802234:	eb 86                	jmp    8021bc <fsipc+0x20>
+
+0000000000802236 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802236:	55                   	push   %rbp
+  802237:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80223a:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802241:	00 00 00 
+  802244:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802247:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802249:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80224c:	be 00 00 00 00       	mov    $0x0,%esi
+  802251:	bf 02 00 00 00       	mov    $0x2,%edi
+  802256:	48 b8 9c 21 80 00 00 	movabs $0x80219c,%rax
+  80225d:	00 00 00 
+  802260:	ff d0                	call   *%rax
+}
+  802262:	5d                   	pop    %rbp
+  802263:	c3                   	ret
+
+0000000000802264 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802264:	55                   	push   %rbp
+  802265:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802268:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80226b:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802272:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802274:	be 00 00 00 00       	mov    $0x0,%esi
+  802279:	bf 06 00 00 00       	mov    $0x6,%edi
+  80227e:	48 b8 9c 21 80 00 00 	movabs $0x80219c,%rax
+  802285:	00 00 00 
+  802288:	ff d0                	call   *%rax
+}
+  80228a:	5d                   	pop    %rbp
+  80228b:	c3                   	ret
+
+000000000080228c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80228c:	55                   	push   %rbp
+  80228d:	48 89 e5             	mov    %rsp,%rbp
+  802290:	41 54                	push   %r12
+  802292:	53                   	push   %rbx
+  802293:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802296:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802299:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8022a0:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8022a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a7:	bf 05 00 00 00       	mov    $0x5,%edi
+  8022ac:	48 b8 9c 21 80 00 00 	movabs $0x80219c,%rax
+  8022b3:	00 00 00 
+  8022b6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022b8:	85 c0                	test   %eax,%eax
+  8022ba:	78 3d                	js     8022f9 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8022bc:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8022c3:	00 00 00 
+  8022c6:	4c 89 e6             	mov    %r12,%rsi
+  8022c9:	48 89 df             	mov    %rbx,%rdi
+  8022cc:	48 b8 ca 0c 80 00 00 	movabs $0x800cca,%rax
+  8022d3:	00 00 00 
+  8022d6:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8022d8:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8022df:	00 
+  8022e0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8022e6:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8022ed:	00 
+  8022ee:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8022f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022f9:	5b                   	pop    %rbx
+  8022fa:	41 5c                	pop    %r12
+  8022fc:	5d                   	pop    %rbp
+  8022fd:	c3                   	ret
+
+00000000008022fe <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8022fe:	55                   	push   %rbp
+  8022ff:	48 89 e5             	mov    %rsp,%rbp
+  802302:	41 54                	push   %r12
+  802304:	53                   	push   %rbx
+  802305:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  802308:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80230d:	48 39 c2             	cmp    %rax,%rdx
+  802310:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802314:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802317:	48 89 c2             	mov    %rax,%rdx
+  80231a:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802321:	00 00 00 
+  802324:	48 b8 2b 0f 80 00 00 	movabs $0x800f2b,%rax
+  80232b:	00 00 00 
+  80232e:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802330:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802337:	00 00 00 
+  80233a:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80233f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802341:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  802345:	be 00 00 00 00       	mov    $0x0,%esi
+  80234a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80234f:	48 b8 9c 21 80 00 00 	movabs $0x80219c,%rax
+  802356:	00 00 00 
+  802359:	ff d0                	call   *%rax
+  80235b:	48 98                	cltq
+}
+  80235d:	5b                   	pop    %rbx
+  80235e:	41 5c                	pop    %r12
+  802360:	5d                   	pop    %rbp
+  802361:	c3                   	ret
+
+0000000000802362 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802362:	55                   	push   %rbp
+  802363:	48 89 e5             	mov    %rsp,%rbp
+  802366:	41 54                	push   %r12
+  802368:	53                   	push   %rbx
+  802369:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80236c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802373:	00 00 00 
+  802376:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802379:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  80237b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802380:	48 39 ca             	cmp    %rcx,%rdx
+  802383:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  802387:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  80238b:	be 00 00 00 00       	mov    $0x0,%esi
+  802390:	bf 03 00 00 00       	mov    $0x3,%edi
+  802395:	48 b8 9c 21 80 00 00 	movabs $0x80219c,%rax
+  80239c:	00 00 00 
+  80239f:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  8023a1:	85 c0                	test   %eax,%eax
+  8023a3:	78 27                	js     8023cc <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  8023a5:	48 63 d8             	movslq %eax,%rbx
+  8023a8:	48 89 da             	mov    %rbx,%rdx
+  8023ab:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8023b2:	00 00 00 
+  8023b5:	4c 89 e7             	mov    %r12,%rdi
+  8023b8:	48 b8 2b 0f 80 00 00 	movabs $0x800f2b,%rax
+  8023bf:	00 00 00 
+  8023c2:	ff d0                	call   *%rax
+    return bytes_read;
+  8023c4:	48 89 d8             	mov    %rbx,%rax
+}
+  8023c7:	5b                   	pop    %rbx
+  8023c8:	41 5c                	pop    %r12
+  8023ca:	5d                   	pop    %rbp
+  8023cb:	c3                   	ret
+        return bytes_read;
+  8023cc:	48 98                	cltq
+  8023ce:	eb f7                	jmp    8023c7 <devfile_read+0x65>
+
+00000000008023d0 <open>:
+open(const char *path, int mode) {
+  8023d0:	55                   	push   %rbp
+  8023d1:	48 89 e5             	mov    %rsp,%rbp
+  8023d4:	41 55                	push   %r13
+  8023d6:	41 54                	push   %r12
+  8023d8:	53                   	push   %rbx
+  8023d9:	48 83 ec 18          	sub    $0x18,%rsp
+  8023dd:	49 89 fc             	mov    %rdi,%r12
+  8023e0:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8023e3:	48 b8 8c 0c 80 00 00 	movabs $0x800c8c,%rax
+  8023ea:	00 00 00 
+  8023ed:	ff d0                	call   *%rax
+  8023ef:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8023f5:	0f 87 8a 00 00 00    	ja     802485 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8023fb:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8023ff:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  802406:	00 00 00 
+  802409:	ff d0                	call   *%rax
+  80240b:	89 c3                	mov    %eax,%ebx
+  80240d:	85 c0                	test   %eax,%eax
+  80240f:	78 50                	js     802461 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802411:	4c 89 e6             	mov    %r12,%rsi
+  802414:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80241b:	00 00 00 
+  80241e:	48 89 df             	mov    %rbx,%rdi
+  802421:	48 b8 ca 0c 80 00 00 	movabs $0x800cca,%rax
+  802428:	00 00 00 
+  80242b:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80242d:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802434:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802438:	bf 01 00 00 00       	mov    $0x1,%edi
+  80243d:	48 b8 9c 21 80 00 00 	movabs $0x80219c,%rax
+  802444:	00 00 00 
+  802447:	ff d0                	call   *%rax
+  802449:	89 c3                	mov    %eax,%ebx
+  80244b:	85 c0                	test   %eax,%eax
+  80244d:	78 1f                	js     80246e <open+0x9e>
+    return fd2num(fd);
+  80244f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802453:	48 b8 a1 1a 80 00 00 	movabs $0x801aa1,%rax
+  80245a:	00 00 00 
+  80245d:	ff d0                	call   *%rax
+  80245f:	89 c3                	mov    %eax,%ebx
+}
+  802461:	89 d8                	mov    %ebx,%eax
+  802463:	48 83 c4 18          	add    $0x18,%rsp
+  802467:	5b                   	pop    %rbx
+  802468:	41 5c                	pop    %r12
+  80246a:	41 5d                	pop    %r13
+  80246c:	5d                   	pop    %rbp
+  80246d:	c3                   	ret
+        fd_close(fd, 0);
+  80246e:	be 00 00 00 00       	mov    $0x0,%esi
+  802473:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802477:	48 b8 ea 1b 80 00 00 	movabs $0x801bea,%rax
+  80247e:	00 00 00 
+  802481:	ff d0                	call   *%rax
+        return res;
+  802483:	eb dc                	jmp    802461 <open+0x91>
+        return -E_BAD_PATH;
+  802485:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80248a:	eb d5                	jmp    802461 <open+0x91>
+
+000000000080248c <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80248c:	55                   	push   %rbp
+  80248d:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802490:	be 00 00 00 00       	mov    $0x0,%esi
+  802495:	bf 08 00 00 00       	mov    $0x8,%edi
+  80249a:	48 b8 9c 21 80 00 00 	movabs $0x80219c,%rax
+  8024a1:	00 00 00 
+  8024a4:	ff d0                	call   *%rax
+}
+  8024a6:	5d                   	pop    %rbp
+  8024a7:	c3                   	ret
+
+00000000008024a8 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024a8:	55                   	push   %rbp
+  8024a9:	48 89 e5             	mov    %rsp,%rbp
+  8024ac:	41 54                	push   %r12
+  8024ae:	53                   	push   %rbx
+  8024af:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024b2:	48 b8 b3 1a 80 00 00 	movabs $0x801ab3,%rax
+  8024b9:	00 00 00 
+  8024bc:	ff d0                	call   *%rax
+  8024be:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8024c1:	48 be 40 34 80 00 00 	movabs $0x803440,%rsi
+  8024c8:	00 00 00 
+  8024cb:	48 89 df             	mov    %rbx,%rdi
+  8024ce:	48 b8 ca 0c 80 00 00 	movabs $0x800cca,%rax
+  8024d5:	00 00 00 
+  8024d8:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8024da:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8024df:	41 2b 04 24          	sub    (%r12),%eax
+  8024e3:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8024e9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8024f0:	00 00 00 
+    stat->st_dev = &devpipe;
+  8024f3:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8024fa:	00 00 00 
+  8024fd:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802504:	b8 00 00 00 00       	mov    $0x0,%eax
+  802509:	5b                   	pop    %rbx
+  80250a:	41 5c                	pop    %r12
+  80250c:	5d                   	pop    %rbp
+  80250d:	c3                   	ret
+
+000000000080250e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80250e:	55                   	push   %rbp
+  80250f:	48 89 e5             	mov    %rsp,%rbp
+  802512:	41 54                	push   %r12
+  802514:	53                   	push   %rbx
+  802515:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802518:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80251d:	48 89 fe             	mov    %rdi,%rsi
+  802520:	bf 00 00 00 00       	mov    $0x0,%edi
+  802525:	49 bc 46 13 80 00 00 	movabs $0x801346,%r12
+  80252c:	00 00 00 
+  80252f:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802532:	48 89 df             	mov    %rbx,%rdi
+  802535:	48 b8 b3 1a 80 00 00 	movabs $0x801ab3,%rax
+  80253c:	00 00 00 
+  80253f:	ff d0                	call   *%rax
+  802541:	48 89 c6             	mov    %rax,%rsi
+  802544:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802549:	bf 00 00 00 00       	mov    $0x0,%edi
+  80254e:	41 ff d4             	call   *%r12
+}
+  802551:	5b                   	pop    %rbx
+  802552:	41 5c                	pop    %r12
+  802554:	5d                   	pop    %rbp
+  802555:	c3                   	ret
+
+0000000000802556 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802556:	55                   	push   %rbp
+  802557:	48 89 e5             	mov    %rsp,%rbp
+  80255a:	41 57                	push   %r15
+  80255c:	41 56                	push   %r14
+  80255e:	41 55                	push   %r13
+  802560:	41 54                	push   %r12
+  802562:	53                   	push   %rbx
+  802563:	48 83 ec 18          	sub    $0x18,%rsp
+  802567:	49 89 fc             	mov    %rdi,%r12
+  80256a:	49 89 f5             	mov    %rsi,%r13
+  80256d:	49 89 d7             	mov    %rdx,%r15
+  802570:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802574:	48 b8 b3 1a 80 00 00 	movabs $0x801ab3,%rax
+  80257b:	00 00 00 
+  80257e:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802580:	4d 85 ff             	test   %r15,%r15
+  802583:	0f 84 af 00 00 00    	je     802638 <devpipe_write+0xe2>
+  802589:	48 89 c3             	mov    %rax,%rbx
+  80258c:	4c 89 f8             	mov    %r15,%rax
+  80258f:	4d 89 ef             	mov    %r13,%r15
+  802592:	4c 01 e8             	add    %r13,%rax
+  802595:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802599:	49 bd 4e 12 80 00 00 	movabs $0x80124e,%r13
+  8025a0:	00 00 00 
+            sys_yield();
+  8025a3:	49 be eb 11 80 00 00 	movabs $0x8011eb,%r14
+  8025aa:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025ad:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025b0:	48 63 ce             	movslq %esi,%rcx
+  8025b3:	48 63 03             	movslq (%rbx),%rax
+  8025b6:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025bc:	48 39 c1             	cmp    %rax,%rcx
+  8025bf:	72 2e                	jb     8025ef <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025c1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025c6:	48 89 da             	mov    %rbx,%rdx
+  8025c9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025ce:	4c 89 e7             	mov    %r12,%rdi
+  8025d1:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025d4:	85 c0                	test   %eax,%eax
+  8025d6:	74 66                	je     80263e <devpipe_write+0xe8>
+            sys_yield();
+  8025d8:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025db:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025de:	48 63 ce             	movslq %esi,%rcx
+  8025e1:	48 63 03             	movslq (%rbx),%rax
+  8025e4:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025ea:	48 39 c1             	cmp    %rax,%rcx
+  8025ed:	73 d2                	jae    8025c1 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025ef:	41 0f b6 3f          	movzbl (%r15),%edi
+  8025f3:	48 89 ca             	mov    %rcx,%rdx
+  8025f6:	48 c1 ea 03          	shr    $0x3,%rdx
+  8025fa:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802601:	08 10 20 
+  802604:	48 f7 e2             	mul    %rdx
+  802607:	48 c1 ea 06          	shr    $0x6,%rdx
+  80260b:	48 89 d0             	mov    %rdx,%rax
+  80260e:	48 c1 e0 09          	shl    $0x9,%rax
+  802612:	48 29 d0             	sub    %rdx,%rax
+  802615:	48 c1 e0 03          	shl    $0x3,%rax
+  802619:	48 29 c1             	sub    %rax,%rcx
+  80261c:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802621:	83 c6 01             	add    $0x1,%esi
+  802624:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802627:	49 83 c7 01          	add    $0x1,%r15
+  80262b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80262f:	49 39 c7             	cmp    %rax,%r15
+  802632:	0f 85 75 ff ff ff    	jne    8025ad <devpipe_write+0x57>
+    return n;
+  802638:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80263c:	eb 05                	jmp    802643 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80263e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802643:	48 83 c4 18          	add    $0x18,%rsp
+  802647:	5b                   	pop    %rbx
+  802648:	41 5c                	pop    %r12
+  80264a:	41 5d                	pop    %r13
+  80264c:	41 5e                	pop    %r14
+  80264e:	41 5f                	pop    %r15
+  802650:	5d                   	pop    %rbp
+  802651:	c3                   	ret
+
+0000000000802652 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802652:	55                   	push   %rbp
+  802653:	48 89 e5             	mov    %rsp,%rbp
+  802656:	41 57                	push   %r15
+  802658:	41 56                	push   %r14
+  80265a:	41 55                	push   %r13
+  80265c:	41 54                	push   %r12
+  80265e:	53                   	push   %rbx
+  80265f:	48 83 ec 18          	sub    $0x18,%rsp
+  802663:	49 89 fc             	mov    %rdi,%r12
+  802666:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80266a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80266e:	48 b8 b3 1a 80 00 00 	movabs $0x801ab3,%rax
+  802675:	00 00 00 
+  802678:	ff d0                	call   *%rax
+  80267a:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80267d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802683:	49 bd 4e 12 80 00 00 	movabs $0x80124e,%r13
+  80268a:	00 00 00 
+            sys_yield();
+  80268d:	49 be eb 11 80 00 00 	movabs $0x8011eb,%r14
+  802694:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802697:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80269c:	74 7d                	je     80271b <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80269e:	8b 03                	mov    (%rbx),%eax
+  8026a0:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026a3:	75 26                	jne    8026cb <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026a5:	4d 85 ff             	test   %r15,%r15
+  8026a8:	75 77                	jne    802721 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026aa:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026af:	48 89 da             	mov    %rbx,%rdx
+  8026b2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026b7:	4c 89 e7             	mov    %r12,%rdi
+  8026ba:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026bd:	85 c0                	test   %eax,%eax
+  8026bf:	74 72                	je     802733 <devpipe_read+0xe1>
+            sys_yield();
+  8026c1:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026c4:	8b 03                	mov    (%rbx),%eax
+  8026c6:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026c9:	74 df                	je     8026aa <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026cb:	48 63 c8             	movslq %eax,%rcx
+  8026ce:	48 89 ca             	mov    %rcx,%rdx
+  8026d1:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026d5:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8026dc:	08 10 20 
+  8026df:	48 89 d0             	mov    %rdx,%rax
+  8026e2:	48 f7 e6             	mul    %rsi
+  8026e5:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026e9:	48 89 d0             	mov    %rdx,%rax
+  8026ec:	48 c1 e0 09          	shl    $0x9,%rax
+  8026f0:	48 29 d0             	sub    %rdx,%rax
+  8026f3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8026fa:	00 
+  8026fb:	48 89 c8             	mov    %rcx,%rax
+  8026fe:	48 29 d0             	sub    %rdx,%rax
+  802701:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802706:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80270a:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80270e:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802711:	49 83 c7 01          	add    $0x1,%r15
+  802715:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802719:	75 83                	jne    80269e <devpipe_read+0x4c>
+    return n;
+  80271b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80271f:	eb 03                	jmp    802724 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802721:	4c 89 f8             	mov    %r15,%rax
+}
+  802724:	48 83 c4 18          	add    $0x18,%rsp
+  802728:	5b                   	pop    %rbx
+  802729:	41 5c                	pop    %r12
+  80272b:	41 5d                	pop    %r13
+  80272d:	41 5e                	pop    %r14
+  80272f:	41 5f                	pop    %r15
+  802731:	5d                   	pop    %rbp
+  802732:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802733:	b8 00 00 00 00       	mov    $0x0,%eax
+  802738:	eb ea                	jmp    802724 <devpipe_read+0xd2>
+
+000000000080273a <pipe>:
+pipe(int pfd[2]) {
+  80273a:	55                   	push   %rbp
+  80273b:	48 89 e5             	mov    %rsp,%rbp
+  80273e:	41 55                	push   %r13
+  802740:	41 54                	push   %r12
+  802742:	53                   	push   %rbx
+  802743:	48 83 ec 18          	sub    $0x18,%rsp
+  802747:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80274a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80274e:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  802755:	00 00 00 
+  802758:	ff d0                	call   *%rax
+  80275a:	89 c3                	mov    %eax,%ebx
+  80275c:	85 c0                	test   %eax,%eax
+  80275e:	0f 88 a0 01 00 00    	js     802904 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802764:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802769:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80276e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802772:	bf 00 00 00 00       	mov    $0x0,%edi
+  802777:	48 b8 7a 12 80 00 00 	movabs $0x80127a,%rax
+  80277e:	00 00 00 
+  802781:	ff d0                	call   *%rax
+  802783:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802785:	85 c0                	test   %eax,%eax
+  802787:	0f 88 77 01 00 00    	js     802904 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80278d:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802791:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  802798:	00 00 00 
+  80279b:	ff d0                	call   *%rax
+  80279d:	89 c3                	mov    %eax,%ebx
+  80279f:	85 c0                	test   %eax,%eax
+  8027a1:	0f 88 43 01 00 00    	js     8028ea <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8027a7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027b1:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027ba:	48 b8 7a 12 80 00 00 	movabs $0x80127a,%rax
+  8027c1:	00 00 00 
+  8027c4:	ff d0                	call   *%rax
+  8027c6:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027c8:	85 c0                	test   %eax,%eax
+  8027ca:	0f 88 1a 01 00 00    	js     8028ea <pipe+0x1b0>
+    va = fd2data(fd0);
+  8027d0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027d4:	48 b8 b3 1a 80 00 00 	movabs $0x801ab3,%rax
+  8027db:	00 00 00 
+  8027de:	ff d0                	call   *%rax
+  8027e0:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8027e3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027e8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027ed:	48 89 c6             	mov    %rax,%rsi
+  8027f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027f5:	48 b8 7a 12 80 00 00 	movabs $0x80127a,%rax
+  8027fc:	00 00 00 
+  8027ff:	ff d0                	call   *%rax
+  802801:	89 c3                	mov    %eax,%ebx
+  802803:	85 c0                	test   %eax,%eax
+  802805:	0f 88 c5 00 00 00    	js     8028d0 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80280b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80280f:	48 b8 b3 1a 80 00 00 	movabs $0x801ab3,%rax
+  802816:	00 00 00 
+  802819:	ff d0                	call   *%rax
+  80281b:	48 89 c1             	mov    %rax,%rcx
+  80281e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802824:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80282a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80282f:	4c 89 ee             	mov    %r13,%rsi
+  802832:	bf 00 00 00 00       	mov    $0x0,%edi
+  802837:	48 b8 e1 12 80 00 00 	movabs $0x8012e1,%rax
+  80283e:	00 00 00 
+  802841:	ff d0                	call   *%rax
+  802843:	89 c3                	mov    %eax,%ebx
+  802845:	85 c0                	test   %eax,%eax
+  802847:	78 6e                	js     8028b7 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802849:	be 00 10 00 00       	mov    $0x1000,%esi
+  80284e:	4c 89 ef             	mov    %r13,%rdi
+  802851:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  802858:	00 00 00 
+  80285b:	ff d0                	call   *%rax
+  80285d:	83 f8 02             	cmp    $0x2,%eax
+  802860:	0f 85 ab 00 00 00    	jne    802911 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802866:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80286d:	00 00 
+  80286f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802873:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802875:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802879:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802880:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802884:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802886:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80288a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802891:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802895:	48 bb a1 1a 80 00 00 	movabs $0x801aa1,%rbx
+  80289c:	00 00 00 
+  80289f:	ff d3                	call   *%rbx
+  8028a1:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028a5:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028a9:	ff d3                	call   *%rbx
+  8028ab:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8028b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028b5:	eb 4d                	jmp    802904 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8028b7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028bc:	4c 89 ee             	mov    %r13,%rsi
+  8028bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028c4:	48 b8 46 13 80 00 00 	movabs $0x801346,%rax
+  8028cb:	00 00 00 
+  8028ce:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8028d0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028d5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8028d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028de:	48 b8 46 13 80 00 00 	movabs $0x801346,%rax
+  8028e5:	00 00 00 
+  8028e8:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8028ea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028ef:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8028f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028f8:	48 b8 46 13 80 00 00 	movabs $0x801346,%rax
+  8028ff:	00 00 00 
+  802902:	ff d0                	call   *%rax
+}
+  802904:	89 d8                	mov    %ebx,%eax
+  802906:	48 83 c4 18          	add    $0x18,%rsp
+  80290a:	5b                   	pop    %rbx
+  80290b:	41 5c                	pop    %r12
+  80290d:	41 5d                	pop    %r13
+  80290f:	5d                   	pop    %rbp
+  802910:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802911:	48 b9 70 34 80 00 00 	movabs $0x803470,%rcx
+  802918:	00 00 00 
+  80291b:	48 ba 47 34 80 00 00 	movabs $0x803447,%rdx
+  802922:	00 00 00 
+  802925:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80292a:	48 bf 5c 34 80 00 00 	movabs $0x80345c,%rdi
+  802931:	00 00 00 
+  802934:	b8 00 00 00 00       	mov    $0x0,%eax
+  802939:	49 b8 55 02 80 00 00 	movabs $0x800255,%r8
+  802940:	00 00 00 
+  802943:	41 ff d0             	call   *%r8
+
+0000000000802946 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802946:	55                   	push   %rbp
+  802947:	48 89 e5             	mov    %rsp,%rbp
+  80294a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80294e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802952:	48 b8 2f 1b 80 00 00 	movabs $0x801b2f,%rax
+  802959:	00 00 00 
+  80295c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80295e:	85 c0                	test   %eax,%eax
+  802960:	78 35                	js     802997 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802962:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802966:	48 b8 b3 1a 80 00 00 	movabs $0x801ab3,%rax
+  80296d:	00 00 00 
+  802970:	ff d0                	call   *%rax
+  802972:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802975:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80297a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80297f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802983:	48 b8 4e 12 80 00 00 	movabs $0x80124e,%rax
+  80298a:	00 00 00 
+  80298d:	ff d0                	call   *%rax
+  80298f:	85 c0                	test   %eax,%eax
+  802991:	0f 94 c0             	sete   %al
+  802994:	0f b6 c0             	movzbl %al,%eax
+}
+  802997:	c9                   	leave
+  802998:	c3                   	ret
+
+0000000000802999 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802999:	48 89 f8             	mov    %rdi,%rax
+  80299c:	48 c1 e8 27          	shr    $0x27,%rax
+  8029a0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8029a7:	01 00 00 
+  8029aa:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029ae:	f6 c2 01             	test   $0x1,%dl
+  8029b1:	74 6d                	je     802a20 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029b3:	48 89 f8             	mov    %rdi,%rax
+  8029b6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029ba:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8029c1:	01 00 00 
+  8029c4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029c8:	f6 c2 01             	test   $0x1,%dl
+  8029cb:	74 62                	je     802a2f <get_uvpt_entry+0x96>
+  8029cd:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8029d4:	01 00 00 
+  8029d7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029db:	f6 c2 80             	test   $0x80,%dl
+  8029de:	75 4f                	jne    802a2f <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8029e0:	48 89 f8             	mov    %rdi,%rax
+  8029e3:	48 c1 e8 15          	shr    $0x15,%rax
+  8029e7:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8029ee:	01 00 00 
+  8029f1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029f5:	f6 c2 01             	test   $0x1,%dl
+  8029f8:	74 44                	je     802a3e <get_uvpt_entry+0xa5>
+  8029fa:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a01:	01 00 00 
+  802a04:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a08:	f6 c2 80             	test   $0x80,%dl
+  802a0b:	75 31                	jne    802a3e <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a0d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a11:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a18:	01 00 00 
+  802a1b:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a1f:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a20:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a27:	01 00 00 
+  802a2a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a2e:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a2f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a36:	01 00 00 
+  802a39:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a3d:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a3e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a45:	01 00 00 
+  802a48:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a4c:	c3                   	ret
+
+0000000000802a4d <get_prot>:
+
+int
+get_prot(void *va) {
+  802a4d:	55                   	push   %rbp
+  802a4e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a51:	48 b8 99 29 80 00 00 	movabs $0x802999,%rax
+  802a58:	00 00 00 
+  802a5b:	ff d0                	call   *%rax
+  802a5d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802a60:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802a65:	89 c1                	mov    %eax,%ecx
+  802a67:	83 c9 04             	or     $0x4,%ecx
+  802a6a:	f6 c2 01             	test   $0x1,%dl
+  802a6d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802a70:	89 c1                	mov    %eax,%ecx
+  802a72:	83 c9 02             	or     $0x2,%ecx
+  802a75:	f6 c2 02             	test   $0x2,%dl
+  802a78:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802a7b:	89 c1                	mov    %eax,%ecx
+  802a7d:	83 c9 01             	or     $0x1,%ecx
+  802a80:	48 85 d2             	test   %rdx,%rdx
+  802a83:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802a86:	89 c1                	mov    %eax,%ecx
+  802a88:	83 c9 40             	or     $0x40,%ecx
+  802a8b:	f6 c6 04             	test   $0x4,%dh
+  802a8e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802a91:	5d                   	pop    %rbp
+  802a92:	c3                   	ret
+
+0000000000802a93 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802a93:	55                   	push   %rbp
+  802a94:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a97:	48 b8 99 29 80 00 00 	movabs $0x802999,%rax
+  802a9e:	00 00 00 
+  802aa1:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802aa3:	48 c1 e8 06          	shr    $0x6,%rax
+  802aa7:	83 e0 01             	and    $0x1,%eax
+}
+  802aaa:	5d                   	pop    %rbp
+  802aab:	c3                   	ret
+
+0000000000802aac <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802aac:	55                   	push   %rbp
+  802aad:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802ab0:	48 b8 99 29 80 00 00 	movabs $0x802999,%rax
+  802ab7:	00 00 00 
+  802aba:	ff d0                	call   *%rax
+  802abc:	83 e0 01             	and    $0x1,%eax
+}
+  802abf:	5d                   	pop    %rbp
+  802ac0:	c3                   	ret
+
+0000000000802ac1 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802ac1:	55                   	push   %rbp
+  802ac2:	48 89 e5             	mov    %rsp,%rbp
+  802ac5:	41 57                	push   %r15
+  802ac7:	41 56                	push   %r14
+  802ac9:	41 55                	push   %r13
+  802acb:	41 54                	push   %r12
+  802acd:	53                   	push   %rbx
+  802ace:	48 83 ec 18          	sub    $0x18,%rsp
+  802ad2:	49 89 ff             	mov    %rdi,%r15
+  802ad5:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802ad9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802ade:	49 bc ac 2a 80 00 00 	movabs $0x802aac,%r12
+  802ae5:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802ae8:	49 be 4d 2a 80 00 00 	movabs $0x802a4d,%r14
+  802aef:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802af2:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802af9:	00 00 00 
+  802afc:	eb 0c                	jmp    802b0a <foreach_shared_region+0x49>
+  802afe:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b05:	4c 39 eb             	cmp    %r13,%rbx
+  802b08:	74 38                	je     802b42 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802b0a:	48 89 df             	mov    %rbx,%rdi
+  802b0d:	41 ff d4             	call   *%r12
+  802b10:	84 c0                	test   %al,%al
+  802b12:	74 ea                	je     802afe <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802b14:	48 89 df             	mov    %rbx,%rdi
+  802b17:	41 ff d6             	call   *%r14
+  802b1a:	a8 40                	test   $0x40,%al
+  802b1c:	74 e0                	je     802afe <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802b1e:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802b25:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802b29:	48 89 df             	mov    %rbx,%rdi
+  802b2c:	41 ff d7             	call   *%r15
+        if (err)
+  802b2f:	85 c0                	test   %eax,%eax
+  802b31:	74 cb                	je     802afe <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802b33:	48 83 c4 18          	add    $0x18,%rsp
+  802b37:	5b                   	pop    %rbx
+  802b38:	41 5c                	pop    %r12
+  802b3a:	41 5d                	pop    %r13
+  802b3c:	41 5e                	pop    %r14
+  802b3e:	41 5f                	pop    %r15
+  802b40:	5d                   	pop    %rbp
+  802b41:	c3                   	ret
+    return 0;
+  802b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b47:	eb ea                	jmp    802b33 <foreach_shared_region+0x72>
+
+0000000000802b49 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802b49:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b4e:	c3                   	ret
+
+0000000000802b4f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802b4f:	55                   	push   %rbp
+  802b50:	48 89 e5             	mov    %rsp,%rbp
+  802b53:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802b56:	48 be 94 34 80 00 00 	movabs $0x803494,%rsi
+  802b5d:	00 00 00 
+  802b60:	48 b8 ca 0c 80 00 00 	movabs $0x800cca,%rax
+  802b67:	00 00 00 
+  802b6a:	ff d0                	call   *%rax
+    return 0;
+}
+  802b6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b71:	5d                   	pop    %rbp
+  802b72:	c3                   	ret
+
+0000000000802b73 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802b73:	55                   	push   %rbp
+  802b74:	48 89 e5             	mov    %rsp,%rbp
+  802b77:	41 57                	push   %r15
+  802b79:	41 56                	push   %r14
+  802b7b:	41 55                	push   %r13
+  802b7d:	41 54                	push   %r12
+  802b7f:	53                   	push   %rbx
+  802b80:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802b87:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802b8e:	48 85 d2             	test   %rdx,%rdx
+  802b91:	74 7a                	je     802c0d <devcons_write+0x9a>
+  802b93:	49 89 d6             	mov    %rdx,%r14
+  802b96:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802b9c:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802ba1:	49 bf c4 0e 80 00 00 	movabs $0x800ec4,%r15
+  802ba8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802bab:	4c 89 f3             	mov    %r14,%rbx
+  802bae:	48 29 f3             	sub    %rsi,%rbx
+  802bb1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802bb6:	48 39 c3             	cmp    %rax,%rbx
+  802bb9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802bbd:	4c 63 eb             	movslq %ebx,%r13
+  802bc0:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802bc7:	48 01 c6             	add    %rax,%rsi
+  802bca:	4c 89 ea             	mov    %r13,%rdx
+  802bcd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802bd4:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802bd7:	4c 89 ee             	mov    %r13,%rsi
+  802bda:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802be1:	48 b8 f1 10 80 00 00 	movabs $0x8010f1,%rax
+  802be8:	00 00 00 
+  802beb:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802bed:	41 01 dc             	add    %ebx,%r12d
+  802bf0:	49 63 f4             	movslq %r12d,%rsi
+  802bf3:	4c 39 f6             	cmp    %r14,%rsi
+  802bf6:	72 b3                	jb     802bab <devcons_write+0x38>
+    return res;
+  802bf8:	49 63 c4             	movslq %r12d,%rax
+}
+  802bfb:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802c02:	5b                   	pop    %rbx
+  802c03:	41 5c                	pop    %r12
+  802c05:	41 5d                	pop    %r13
+  802c07:	41 5e                	pop    %r14
+  802c09:	41 5f                	pop    %r15
+  802c0b:	5d                   	pop    %rbp
+  802c0c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802c0d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802c13:	eb e3                	jmp    802bf8 <devcons_write+0x85>
+
+0000000000802c15 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802c15:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802c18:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c1d:	48 85 c0             	test   %rax,%rax
+  802c20:	74 55                	je     802c77 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802c22:	55                   	push   %rbp
+  802c23:	48 89 e5             	mov    %rsp,%rbp
+  802c26:	41 55                	push   %r13
+  802c28:	41 54                	push   %r12
+  802c2a:	53                   	push   %rbx
+  802c2b:	48 83 ec 08          	sub    $0x8,%rsp
+  802c2f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802c32:	48 bb 1e 11 80 00 00 	movabs $0x80111e,%rbx
+  802c39:	00 00 00 
+  802c3c:	49 bc eb 11 80 00 00 	movabs $0x8011eb,%r12
+  802c43:	00 00 00 
+  802c46:	eb 03                	jmp    802c4b <devcons_read+0x36>
+  802c48:	41 ff d4             	call   *%r12
+  802c4b:	ff d3                	call   *%rbx
+  802c4d:	85 c0                	test   %eax,%eax
+  802c4f:	74 f7                	je     802c48 <devcons_read+0x33>
+    if (c < 0) return c;
+  802c51:	48 63 d0             	movslq %eax,%rdx
+  802c54:	78 13                	js     802c69 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802c56:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c5b:	83 f8 04             	cmp    $0x4,%eax
+  802c5e:	74 09                	je     802c69 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802c60:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802c64:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802c69:	48 89 d0             	mov    %rdx,%rax
+  802c6c:	48 83 c4 08          	add    $0x8,%rsp
+  802c70:	5b                   	pop    %rbx
+  802c71:	41 5c                	pop    %r12
+  802c73:	41 5d                	pop    %r13
+  802c75:	5d                   	pop    %rbp
+  802c76:	c3                   	ret
+  802c77:	48 89 d0             	mov    %rdx,%rax
+  802c7a:	c3                   	ret
+
+0000000000802c7b <cputchar>:
+cputchar(int ch) {
+  802c7b:	55                   	push   %rbp
+  802c7c:	48 89 e5             	mov    %rsp,%rbp
+  802c7f:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802c83:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802c87:	be 01 00 00 00       	mov    $0x1,%esi
+  802c8c:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802c90:	48 b8 f1 10 80 00 00 	movabs $0x8010f1,%rax
+  802c97:	00 00 00 
+  802c9a:	ff d0                	call   *%rax
+}
+  802c9c:	c9                   	leave
+  802c9d:	c3                   	ret
+
+0000000000802c9e <getchar>:
+getchar(void) {
+  802c9e:	55                   	push   %rbp
+  802c9f:	48 89 e5             	mov    %rsp,%rbp
+  802ca2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802ca6:	ba 01 00 00 00       	mov    $0x1,%edx
+  802cab:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802caf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cb4:	48 b8 12 1e 80 00 00 	movabs $0x801e12,%rax
+  802cbb:	00 00 00 
+  802cbe:	ff d0                	call   *%rax
+  802cc0:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802cc2:	85 c0                	test   %eax,%eax
+  802cc4:	78 06                	js     802ccc <getchar+0x2e>
+  802cc6:	74 08                	je     802cd0 <getchar+0x32>
+  802cc8:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802ccc:	89 d0                	mov    %edx,%eax
+  802cce:	c9                   	leave
+  802ccf:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802cd0:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802cd5:	eb f5                	jmp    802ccc <getchar+0x2e>
+
+0000000000802cd7 <iscons>:
+iscons(int fdnum) {
+  802cd7:	55                   	push   %rbp
+  802cd8:	48 89 e5             	mov    %rsp,%rbp
+  802cdb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802cdf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802ce3:	48 b8 2f 1b 80 00 00 	movabs $0x801b2f,%rax
+  802cea:	00 00 00 
+  802ced:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cef:	85 c0                	test   %eax,%eax
+  802cf1:	78 18                	js     802d0b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802cf3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802cf7:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802cfe:	00 00 00 
+  802d01:	8b 00                	mov    (%rax),%eax
+  802d03:	39 02                	cmp    %eax,(%rdx)
+  802d05:	0f 94 c0             	sete   %al
+  802d08:	0f b6 c0             	movzbl %al,%eax
+}
+  802d0b:	c9                   	leave
+  802d0c:	c3                   	ret
+
+0000000000802d0d <opencons>:
+opencons(void) {
+  802d0d:	55                   	push   %rbp
+  802d0e:	48 89 e5             	mov    %rsp,%rbp
+  802d11:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802d15:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802d19:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  802d20:	00 00 00 
+  802d23:	ff d0                	call   *%rax
+  802d25:	85 c0                	test   %eax,%eax
+  802d27:	78 49                	js     802d72 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802d29:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802d2e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d33:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802d37:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d3c:	48 b8 7a 12 80 00 00 	movabs $0x80127a,%rax
+  802d43:	00 00 00 
+  802d46:	ff d0                	call   *%rax
+  802d48:	85 c0                	test   %eax,%eax
+  802d4a:	78 26                	js     802d72 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802d4c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d50:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802d57:	00 00 
+  802d59:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802d5b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d5f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802d66:	48 b8 a1 1a 80 00 00 	movabs $0x801aa1,%rax
+  802d6d:	00 00 00 
+  802d70:	ff d0                	call   *%rax
+}
+  802d72:	c9                   	leave
+  802d73:	c3                   	ret
+  802d74:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000802d78 <__rodata_start>:
+  802d78:	25 64 20 00 66       	and    $0x66002064,%eax
+  802d7d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d7e:	72 6b                	jb     802deb <__rodata_start+0x73>
+  802d80:	3a 20                	cmp    (%rax),%ah
+  802d82:	25 69 00 75 73       	and    $0x73750069,%eax
+  802d87:	65 72 2f             	gs jb  802db9 <__rodata_start+0x41>
+  802d8a:	70 72                	jo     802dfe <__rodata_start+0x86>
+  802d8c:	69 6d 65 73 2e 63 00 	imul   $0x632e73,0x65(%rbp),%ebp
+  802d93:	3c 75                	cmp    $0x75,%al
+  802d95:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d96:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802d9a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d9b:	3e 00 0f             	ds add %cl,(%rdi)
+  802d9e:	1f                   	(bad)
+  802d9f:	00 5b 25             	add    %bl,0x25(%rbx)
+  802da2:	30 38                	xor    %bh,(%rax)
+  802da4:	78 5d                	js     802e03 <__rodata_start+0x8b>
+  802da6:	20 75 73             	and    %dh,0x73(%rbp)
+  802da9:	65 72 20             	gs jb  802dcc <__rodata_start+0x54>
+  802dac:	70 61                	jo     802e0f <__rodata_start+0x97>
+  802dae:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802daf:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  802db6:	73 20                	jae    802dd8 <__rodata_start+0x60>
+  802db8:	61                   	(bad)
+  802db9:	74 20                	je     802ddb <__rodata_start+0x63>
+  802dbb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  802dc0:	3a 20                	cmp    (%rax),%ah
+  802dc2:	00 30                	add    %dh,(%rax)
+  802dc4:	31 32                	xor    %esi,(%rdx)
+  802dc6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802dcd:	41                   	rex.B
+  802dce:	42                   	rex.X
+  802dcf:	43                   	rex.XB
+  802dd0:	44                   	rex.R
+  802dd1:	45                   	rex.RB
+  802dd2:	46 00 30             	rex.RX add %r14b,(%rax)
+  802dd5:	31 32                	xor    %esi,(%rdx)
+  802dd7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802dde:	61                   	(bad)
+  802ddf:	62 63 64 65 66       	(bad)
+  802de4:	00 28                	add    %ch,(%rax)
+  802de6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802de7:	75 6c                	jne    802e55 <__rodata_start+0xdd>
+  802de9:	6c                   	insb   (%dx),%es:(%rdi)
+  802dea:	29 00                	sub    %eax,(%rax)
+  802dec:	65 72 72             	gs jb  802e61 <__rodata_start+0xe9>
+  802def:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802df0:	72 20                	jb     802e12 <__rodata_start+0x9a>
+  802df2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802df7:	73 70                	jae    802e69 <__rodata_start+0xf1>
+  802df9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802dfd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802e04:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e05:	72 00                	jb     802e07 <__rodata_start+0x8f>
+  802e07:	62 61 64 20 65       	(bad)
+  802e0c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e0d:	76 69                	jbe    802e78 <__rodata_start+0x100>
+  802e0f:	72 6f                	jb     802e80 <__rodata_start+0x108>
+  802e11:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e12:	6d                   	insl   (%dx),%es:(%rdi)
+  802e13:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e15:	74 00                	je     802e17 <__rodata_start+0x9f>
+  802e17:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802e1e:	20 70 61             	and    %dh,0x61(%rax)
+  802e21:	72 61                	jb     802e84 <__rodata_start+0x10c>
+  802e23:	6d                   	insl   (%dx),%es:(%rdi)
+  802e24:	65 74 65             	gs je  802e8c <__rodata_start+0x114>
+  802e27:	72 00                	jb     802e29 <__rodata_start+0xb1>
+  802e29:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e2a:	75 74                	jne    802ea0 <__rodata_start+0x128>
+  802e2c:	20 6f 66             	and    %ch,0x66(%rdi)
+  802e2f:	20 6d 65             	and    %ch,0x65(%rbp)
+  802e32:	6d                   	insl   (%dx),%es:(%rdi)
+  802e33:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e34:	72 79                	jb     802eaf <__rodata_start+0x137>
+  802e36:	00 6f 75             	add    %ch,0x75(%rdi)
+  802e39:	74 20                	je     802e5b <__rodata_start+0xe3>
+  802e3b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e3c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802e40:	76 69                	jbe    802eab <__rodata_start+0x133>
+  802e42:	72 6f                	jb     802eb3 <__rodata_start+0x13b>
+  802e44:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e45:	6d                   	insl   (%dx),%es:(%rdi)
+  802e46:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e48:	74 73                	je     802ebd <__rodata_start+0x145>
+  802e4a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802e4d:	72 72                	jb     802ec1 <__rodata_start+0x149>
+  802e4f:	75 70                	jne    802ec1 <__rodata_start+0x149>
+  802e51:	74 65                	je     802eb8 <__rodata_start+0x140>
+  802e53:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802e58:	75 67                	jne    802ec1 <__rodata_start+0x149>
+  802e5a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802e5d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e5f:	00 73 65             	add    %dh,0x65(%rbx)
+  802e62:	67 6d                	insl   (%dx),%es:(%edi)
+  802e64:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e66:	74 61                	je     802ec9 <__rodata_start+0x151>
+  802e68:	74 69                	je     802ed3 <__rodata_start+0x15b>
+  802e6a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e6b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e6c:	20 66 61             	and    %ah,0x61(%rsi)
+  802e6f:	75 6c                	jne    802edd <__rodata_start+0x165>
+  802e71:	74 00                	je     802e73 <__rodata_start+0xfb>
+  802e73:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802e7a:	20 45 4c             	and    %al,0x4c(%rbp)
+  802e7d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802e81:	61                   	(bad)
+  802e82:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802e87:	20 73 75             	and    %dh,0x75(%rbx)
+  802e8a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802e8d:	73 79                	jae    802f08 <__rodata_start+0x190>
+  802e8f:	73 74                	jae    802f05 <__rodata_start+0x18d>
+  802e91:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802e93:	20 63 61             	and    %ah,0x61(%rbx)
+  802e96:	6c                   	insb   (%dx),%es:(%rdi)
+  802e97:	6c                   	insb   (%dx),%es:(%rdi)
+  802e98:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802e9b:	74 72                	je     802f0f <__rodata_start+0x197>
+  802e9d:	79 20                	jns    802ebf <__rodata_start+0x147>
+  802e9f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ea0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ea1:	74 20                	je     802ec3 <__rodata_start+0x14b>
+  802ea3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802ea5:	75 6e                	jne    802f15 <__rodata_start+0x19d>
+  802ea7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802eab:	76 20                	jbe    802ecd <__rodata_start+0x155>
+  802ead:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802eb4:	72 65                	jb     802f1b <__rodata_start+0x1a3>
+  802eb6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802eb9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802eba:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802ebe:	65 78 70             	gs js  802f31 <__rodata_start+0x1b9>
+  802ec1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802ec6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802ec9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802ecd:	20 66 69             	and    %ah,0x69(%rsi)
+  802ed0:	6c                   	insb   (%dx),%es:(%rdi)
+  802ed1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802ed5:	20 66 72             	and    %ah,0x72(%rsi)
+  802ed8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802edd:	61                   	(bad)
+  802ede:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802ee1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ee2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ee3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802ee7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802eea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eeb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eec:	20 6d 61             	and    %ch,0x61(%rbp)
+  802eef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ef0:	79 20                	jns    802f12 <__rodata_start+0x19a>
+  802ef2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802ef9:	72 65                	jb     802f60 <__rodata_start+0x1e8>
+  802efb:	20 6f 70             	and    %ch,0x70(%rdi)
+  802efe:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f00:	00 66 69             	add    %ah,0x69(%rsi)
+  802f03:	6c                   	insb   (%dx),%es:(%rdi)
+  802f04:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802f08:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802f0b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f0c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802f0f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f10:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f11:	74 20                	je     802f33 <__rodata_start+0x1bb>
+  802f13:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802f15:	75 6e                	jne    802f85 <__rodata_start+0x20d>
+  802f17:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802f1b:	76 61                	jbe    802f7e <__rodata_start+0x206>
+  802f1d:	6c                   	insb   (%dx),%es:(%rdi)
+  802f1e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802f25:	00 
+  802f26:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802f2d:	72 65                	jb     802f94 <__rodata_start+0x21c>
+  802f2f:	61                   	(bad)
+  802f30:	64 79 20             	fs jns 802f53 <__rodata_start+0x1db>
+  802f33:	65 78 69             	gs js  802f9f <__rodata_start+0x227>
+  802f36:	73 74                	jae    802fac <__rodata_start+0x234>
+  802f38:	73 00                	jae    802f3a <__rodata_start+0x1c2>
+  802f3a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f3b:	70 65                	jo     802fa2 <__rodata_start+0x22a>
+  802f3d:	72 61                	jb     802fa0 <__rodata_start+0x228>
+  802f3f:	74 69                	je     802faa <__rodata_start+0x232>
+  802f41:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f42:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f43:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802f46:	74 20                	je     802f68 <__rodata_start+0x1f0>
+  802f48:	73 75                	jae    802fbf <__rodata_start+0x247>
+  802f4a:	70 70                	jo     802fbc <__rodata_start+0x244>
+  802f4c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f4d:	72 74                	jb     802fc3 <__rodata_start+0x24b>
+  802f4f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802f54:	65 72 61             	gs jb  802fb8 <__rodata_start+0x240>
+  802f57:	74 69                	je     802fc2 <__rodata_start+0x24a>
+  802f59:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f5a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f5b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802f5e:	74 20                	je     802f80 <__rodata_start+0x208>
+  802f60:	70 65                	jo     802fc7 <__rodata_start+0x24f>
+  802f62:	72 6d                	jb     802fd1 <__rodata_start+0x259>
+  802f64:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  802f6b:	2e 
+  802f6c:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  802f73:	00 
+  802f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802f7b:	00 00 00 
+  802f7e:	66 90                	xchg   %ax,%ax
+  802f80:	92                   	xchg   %eax,%edx
+  802f81:	05 80 00 00 00       	add    $0x80,%eax
+  802f86:	00 00                	add    %al,(%rax)
+  802f88:	d3 0b                	rorl   %cl,(%rbx)
+  802f8a:	80 00 00             	addb   $0x0,(%rax)
+  802f8d:	00 00                	add    %al,(%rax)
+  802f8f:	00 c3                	add    %al,%bl
+  802f91:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802f97:	00 d3                	add    %dl,%bl
+  802f99:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802f9f:	00 d3                	add    %dl,%bl
+  802fa1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802fa7:	00 d3                	add    %dl,%bl
+  802fa9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802faf:	00 d3                	add    %dl,%bl
+  802fb1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802fb7:	00 b1 05 80 00 00    	add    %dh,0x8005(%rcx)
+  802fbd:	00 00                	add    %al,(%rax)
+  802fbf:	00 d3                	add    %dl,%bl
+  802fc1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802fc7:	00 d3                	add    %dl,%bl
+  802fc9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802fcf:	00 a5 05 80 00 00    	add    %ah,0x8005(%rbp)
+  802fd5:	00 00                	add    %al,(%rax)
+  802fd7:	00 1f                	add    %bl,(%rdi)
+  802fd9:	06                   	(bad)
+  802fda:	80 00 00             	addb   $0x0,(%rax)
+  802fdd:	00 00                	add    %al,(%rax)
+  802fdf:	00 d3                	add    %dl,%bl
+  802fe1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802fe7:	00 a5 05 80 00 00    	add    %ah,0x8005(%rbp)
+  802fed:	00 00                	add    %al,(%rax)
+  802fef:	00 eb                	add    %ch,%bl
+  802ff1:	05 80 00 00 00       	add    $0x80,%eax
+  802ff6:	00 00                	add    %al,(%rax)
+  802ff8:	eb 05                	jmp    802fff <__rodata_start+0x287>
+  802ffa:	80 00 00             	addb   $0x0,(%rax)
+  802ffd:	00 00                	add    %al,(%rax)
+  802fff:	00 eb                	add    %ch,%bl
+  803001:	05 80 00 00 00       	add    $0x80,%eax
+  803006:	00 00                	add    %al,(%rax)
+  803008:	eb 05                	jmp    80300f <__rodata_start+0x297>
+  80300a:	80 00 00             	addb   $0x0,(%rax)
+  80300d:	00 00                	add    %al,(%rax)
+  80300f:	00 eb                	add    %ch,%bl
+  803011:	05 80 00 00 00       	add    $0x80,%eax
+  803016:	00 00                	add    %al,(%rax)
+  803018:	eb 05                	jmp    80301f <__rodata_start+0x2a7>
+  80301a:	80 00 00             	addb   $0x0,(%rax)
+  80301d:	00 00                	add    %al,(%rax)
+  80301f:	00 eb                	add    %ch,%bl
+  803021:	05 80 00 00 00       	add    $0x80,%eax
+  803026:	00 00                	add    %al,(%rax)
+  803028:	eb 05                	jmp    80302f <__rodata_start+0x2b7>
+  80302a:	80 00 00             	addb   $0x0,(%rax)
+  80302d:	00 00                	add    %al,(%rax)
+  80302f:	00 eb                	add    %ch,%bl
+  803031:	05 80 00 00 00       	add    $0x80,%eax
+  803036:	00 00                	add    %al,(%rax)
+  803038:	d3 0b                	rorl   %cl,(%rbx)
+  80303a:	80 00 00             	addb   $0x0,(%rax)
+  80303d:	00 00                	add    %al,(%rax)
+  80303f:	00 d3                	add    %dl,%bl
+  803041:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803047:	00 d3                	add    %dl,%bl
+  803049:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80304f:	00 d3                	add    %dl,%bl
+  803051:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803057:	00 d3                	add    %dl,%bl
+  803059:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80305f:	00 d3                	add    %dl,%bl
+  803061:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803067:	00 d3                	add    %dl,%bl
+  803069:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80306f:	00 d3                	add    %dl,%bl
+  803071:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803077:	00 d3                	add    %dl,%bl
+  803079:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80307f:	00 d3                	add    %dl,%bl
+  803081:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803087:	00 d3                	add    %dl,%bl
+  803089:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80308f:	00 d3                	add    %dl,%bl
+  803091:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803097:	00 d3                	add    %dl,%bl
+  803099:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80309f:	00 d3                	add    %dl,%bl
+  8030a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030a7:	00 d3                	add    %dl,%bl
+  8030a9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030af:	00 d3                	add    %dl,%bl
+  8030b1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030b7:	00 d3                	add    %dl,%bl
+  8030b9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030bf:	00 d3                	add    %dl,%bl
+  8030c1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030c7:	00 d3                	add    %dl,%bl
+  8030c9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030cf:	00 d3                	add    %dl,%bl
+  8030d1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030d7:	00 d3                	add    %dl,%bl
+  8030d9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030df:	00 d3                	add    %dl,%bl
+  8030e1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030e7:	00 d3                	add    %dl,%bl
+  8030e9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030ef:	00 d3                	add    %dl,%bl
+  8030f1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030f7:	00 d3                	add    %dl,%bl
+  8030f9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030ff:	00 d3                	add    %dl,%bl
+  803101:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803107:	00 d3                	add    %dl,%bl
+  803109:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80310f:	00 d3                	add    %dl,%bl
+  803111:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803117:	00 d3                	add    %dl,%bl
+  803119:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80311f:	00 d3                	add    %dl,%bl
+  803121:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803127:	00 f6                	add    %dh,%dh
+  803129:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80312f:	00 d3                	add    %dl,%bl
+  803131:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803137:	00 d3                	add    %dl,%bl
+  803139:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80313f:	00 d3                	add    %dl,%bl
+  803141:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803147:	00 d3                	add    %dl,%bl
+  803149:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80314f:	00 d3                	add    %dl,%bl
+  803151:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803157:	00 d3                	add    %dl,%bl
+  803159:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80315f:	00 d3                	add    %dl,%bl
+  803161:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803167:	00 d3                	add    %dl,%bl
+  803169:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80316f:	00 d3                	add    %dl,%bl
+  803171:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803177:	00 d3                	add    %dl,%bl
+  803179:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80317f:	00 42 06             	add    %al,0x6(%rdx)
+  803182:	80 00 00             	addb   $0x0,(%rax)
+  803185:	00 00                	add    %al,(%rax)
+  803187:	00 11                	add    %dl,(%rcx)
+  803189:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80318f:	00 d3                	add    %dl,%bl
+  803191:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803197:	00 d3                	add    %dl,%bl
+  803199:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80319f:	00 d3                	add    %dl,%bl
+  8031a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031a7:	00 d3                	add    %dl,%bl
+  8031a9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031af:	00 71 06             	add    %dh,0x6(%rcx)
+  8031b2:	80 00 00             	addb   $0x0,(%rax)
+  8031b5:	00 00                	add    %al,(%rax)
+  8031b7:	00 d3                	add    %dl,%bl
+  8031b9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031bf:	00 d3                	add    %dl,%bl
+  8031c1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031c7:	00 37                	add    %dh,(%rdi)
+  8031c9:	06                   	(bad)
+  8031ca:	80 00 00             	addb   $0x0,(%rax)
+  8031cd:	00 00                	add    %al,(%rax)
+  8031cf:	00 d3                	add    %dl,%bl
+  8031d1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031d7:	00 d3                	add    %dl,%bl
+  8031d9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031df:	00 b9 09 80 00 00    	add    %bh,0x8009(%rcx)
+  8031e5:	00 00                	add    %al,(%rax)
+  8031e7:	00 83 0a 80 00 00    	add    %al,0x800a(%rbx)
+  8031ed:	00 00                	add    %al,(%rax)
+  8031ef:	00 d3                	add    %dl,%bl
+  8031f1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031f7:	00 d3                	add    %dl,%bl
+  8031f9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031ff:	00 08                	add    %cl,(%rax)
+  803201:	07                   	(bad)
+  803202:	80 00 00             	addb   $0x0,(%rax)
+  803205:	00 00                	add    %al,(%rax)
+  803207:	00 d3                	add    %dl,%bl
+  803209:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80320f:	00 e5                	add    %ah,%ch
+  803211:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803217:	00 d3                	add    %dl,%bl
+  803219:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80321f:	00 d3                	add    %dl,%bl
+  803221:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803227:	00 f6                	add    %dh,%dh
+  803229:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80322f:	00 d3                	add    %dl,%bl
+  803231:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803237:	00 9b 05 80 00 00    	add    %bl,0x8005(%rbx)
+  80323d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803240 <error_string>:
+	...
+  803248:	f5 2d 80 00 00 00 00 00 07 2e 80 00 00 00 00 00     .-..............
+  803258:	17 2e 80 00 00 00 00 00 29 2e 80 00 00 00 00 00     ........).......
+  803268:	37 2e 80 00 00 00 00 00 4b 2e 80 00 00 00 00 00     7.......K.......
+  803278:	60 2e 80 00 00 00 00 00 73 2e 80 00 00 00 00 00     `.......s.......
+  803288:	85 2e 80 00 00 00 00 00 99 2e 80 00 00 00 00 00     ................
+  803298:	a9 2e 80 00 00 00 00 00 bc 2e 80 00 00 00 00 00     ................
+  8032a8:	d3 2e 80 00 00 00 00 00 e9 2e 80 00 00 00 00 00     ................
+  8032b8:	01 2f 80 00 00 00 00 00 19 2f 80 00 00 00 00 00     ./......./......
+  8032c8:	26 2f 80 00 00 00 00 00 f0 32 80 00 00 00 00 00     &/.......2......
+  8032d8:	3a 2f 80 00 00 00 00 00 00 00 00 00 00 00 00 00     :/..............
+  8032e8:	52 2f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     R/......file is 
+  8032f8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803308:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803318:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803328:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803338:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  803348:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  803358:	6c 69 62 2f 66 6f 72 6b 2e 63 00 69 70 63 5f 73     lib/fork.c.ipc_s
+  803368:	65 6e 64 3a 20 66 61 69 6c 65 64 20 74 6f 20 73     end: failed to s
+  803378:	65 6e 64 00 6c 69 62 2f 69 70 63 2e 63 00 66 90     end.lib/ipc.c.f.
+  803388:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803398:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8033a8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8033b8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8033c8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8033d8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8033e8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8033f8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803408:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803418:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000803420 <devtab>:
+  803420:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803430:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803440:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803450:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803460:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803470:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803480:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803490:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8034a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
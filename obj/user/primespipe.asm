@@ -0,0 +1,6006 @@
+
+obj/user/primespipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 36 03 00 00       	call   800359 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <primeproc>:
+ * of main and user/idle. */
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(int fd) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+  800036:	89 fb                	mov    %edi,%ebx
+    int id, p, pfd[2], wfd, r;
+
+    /* Fetch a prime from our left neighbor */
+top:
+    if ((r = readn(fd, &p, 4)) != 4)
+  800038:	49 bc 19 1f 80 00 00 	movabs $0x801f19,%r12
+  80003f:	00 00 00 
+        panic("primeproc could not read initial prime: %d, %i", r, r >= 0 ? 0 : r);
+
+    cprintf("%d\n", p);
+  800042:	49 bf 89 2f 80 00 00 	movabs $0x802f89,%r15
+  800049:	00 00 00 
+  80004c:	49 be 73 05 80 00 00 	movabs $0x800573,%r14
+  800053:	00 00 00 
+
+    /* Fork a right neighbor to continue the chain */
+    if ((r = pipe(pfd)) < 0)
+  800056:	49 bd 83 27 80 00 00 	movabs $0x802783,%r13
+  80005d:	00 00 00 
+    if ((r = readn(fd, &p, 4)) != 4)
+  800060:	ba 04 00 00 00       	mov    $0x4,%edx
+  800065:	48 8d 75 cc          	lea    -0x34(%rbp),%rsi
+  800069:	89 df                	mov    %ebx,%edi
+  80006b:	41 ff d4             	call   *%r12
+  80006e:	89 c1                	mov    %eax,%ecx
+  800070:	83 f8 04             	cmp    $0x4,%eax
+  800073:	75 4b                	jne    8000c0 <primeproc+0x9b>
+    cprintf("%d\n", p);
+  800075:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  800078:	4c 89 ff             	mov    %r15,%rdi
+  80007b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800080:	41 ff d6             	call   *%r14
+    if ((r = pipe(pfd)) < 0)
+  800083:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  800087:	41 ff d5             	call   *%r13
+  80008a:	85 c0                	test   %eax,%eax
+  80008c:	78 69                	js     8000f7 <primeproc+0xd2>
+        panic("pipe: %i", r);
+    if ((id = fork()) < 0)
+  80008e:	48 b8 ea 19 80 00 00 	movabs $0x8019ea,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+  80009a:	85 c0                	test   %eax,%eax
+  80009c:	0f 88 82 00 00 00    	js     800124 <primeproc+0xff>
+        panic("fork: %i", id);
+    if (id == 0) {
+  8000a2:	0f 85 a9 00 00 00    	jne    800151 <primeproc+0x12c>
+        close(fd);
+  8000a8:	89 df                	mov    %ebx,%edi
+  8000aa:	48 bb dd 1c 80 00 00 	movabs $0x801cdd,%rbx
+  8000b1:	00 00 00 
+  8000b4:	ff d3                	call   *%rbx
+        close(pfd[1]);
+  8000b6:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000b9:	ff d3                	call   *%rbx
+        fd = pfd[0];
+  8000bb:	8b 5d c4             	mov    -0x3c(%rbp),%ebx
+        goto top;
+  8000be:	eb a0                	jmp    800060 <primeproc+0x3b>
+        panic("primeproc could not read initial prime: %d, %i", r, r >= 0 ? 0 : r);
+  8000c0:	85 c0                	test   %eax,%eax
+  8000c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000c8:	44 0f 4e c0          	cmovle %eax,%r8d
+  8000cc:	48 ba 48 2f 80 00 00 	movabs $0x802f48,%rdx
+  8000d3:	00 00 00 
+  8000d6:	be 14 00 00 00       	mov    $0x14,%esi
+  8000db:	48 bf 77 2f 80 00 00 	movabs $0x802f77,%rdi
+  8000e2:	00 00 00 
+  8000e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ea:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  8000f1:	00 00 00 
+  8000f4:	41 ff d1             	call   *%r9
+        panic("pipe: %i", r);
+  8000f7:	89 c1                	mov    %eax,%ecx
+  8000f9:	48 ba 8d 2f 80 00 00 	movabs $0x802f8d,%rdx
+  800100:	00 00 00 
+  800103:	be 1a 00 00 00       	mov    $0x1a,%esi
+  800108:	48 bf 77 2f 80 00 00 	movabs $0x802f77,%rdi
+  80010f:	00 00 00 
+  800112:	b8 00 00 00 00       	mov    $0x0,%eax
+  800117:	49 b8 23 04 80 00 00 	movabs $0x800423,%r8
+  80011e:	00 00 00 
+  800121:	41 ff d0             	call   *%r8
+        panic("fork: %i", id);
+  800124:	89 c1                	mov    %eax,%ecx
+  800126:	48 ba 96 2f 80 00 00 	movabs $0x802f96,%rdx
+  80012d:	00 00 00 
+  800130:	be 1c 00 00 00       	mov    $0x1c,%esi
+  800135:	48 bf 77 2f 80 00 00 	movabs $0x802f77,%rdi
+  80013c:	00 00 00 
+  80013f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800144:	49 b8 23 04 80 00 00 	movabs $0x800423,%r8
+  80014b:	00 00 00 
+  80014e:	41 ff d0             	call   *%r8
+    }
+
+    close(pfd[0]);
+  800151:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  800154:	48 b8 dd 1c 80 00 00 	movabs $0x801cdd,%rax
+  80015b:	00 00 00 
+  80015e:	ff d0                	call   *%rax
+    wfd = pfd[1];
+  800160:	44 8b 6d c8          	mov    -0x38(%rbp),%r13d
+
+    /* Filter out multiples of our prime */
+    for (int i;;) {
+        if ((r = readn(fd, &i, 4)) != 4)
+  800164:	49 bc 19 1f 80 00 00 	movabs $0x801f19,%r12
+  80016b:	00 00 00 
+  80016e:	ba 04 00 00 00       	mov    $0x4,%edx
+  800173:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800177:	89 df                	mov    %ebx,%edi
+  800179:	41 ff d4             	call   *%r12
+  80017c:	83 f8 04             	cmp    $0x4,%eax
+  80017f:	75 65                	jne    8001e6 <primeproc+0x1c1>
+            panic("primeproc %d readn %d %d %i", p, fd, r, r >= 0 ? 0 : r);
+        if (i % p)
+  800181:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  800184:	99                   	cltd
+  800185:	f7 7d cc             	idivl  -0x34(%rbp)
+  800188:	85 d2                	test   %edx,%edx
+  80018a:	74 e2                	je     80016e <primeproc+0x149>
+            if ((r = write(wfd, &i, 4)) != 4)
+  80018c:	ba 04 00 00 00       	mov    $0x4,%edx
+  800191:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800195:	44 89 ef             	mov    %r13d,%edi
+  800198:	48 b8 8a 1f 80 00 00 	movabs $0x801f8a,%rax
+  80019f:	00 00 00 
+  8001a2:	ff d0                	call   *%rax
+  8001a4:	83 f8 04             	cmp    $0x4,%eax
+  8001a7:	74 c5                	je     80016e <primeproc+0x149>
+                panic("primeproc %d write: %d %i", p, r, r >= 0 ? 0 : r);
+  8001a9:	85 c0                	test   %eax,%eax
+  8001ab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001b1:	44 0f 4e c8          	cmovle %eax,%r9d
+  8001b5:	41 89 c0             	mov    %eax,%r8d
+  8001b8:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8001bb:	48 ba bb 2f 80 00 00 	movabs $0x802fbb,%rdx
+  8001c2:	00 00 00 
+  8001c5:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8001ca:	48 bf 77 2f 80 00 00 	movabs $0x802f77,%rdi
+  8001d1:	00 00 00 
+  8001d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d9:	49 ba 23 04 80 00 00 	movabs $0x800423,%r10
+  8001e0:	00 00 00 
+  8001e3:	41 ff d2             	call   *%r10
+            panic("primeproc %d readn %d %d %i", p, fd, r, r >= 0 ? 0 : r);
+  8001e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8001ea:	85 c0                	test   %eax,%eax
+  8001ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f1:	0f 4e d0             	cmovle %eax,%edx
+  8001f4:	52                   	push   %rdx
+  8001f5:	41 89 c1             	mov    %eax,%r9d
+  8001f8:	41 89 d8             	mov    %ebx,%r8d
+  8001fb:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8001fe:	48 ba 9f 2f 80 00 00 	movabs $0x802f9f,%rdx
+  800205:	00 00 00 
+  800208:	be 2a 00 00 00       	mov    $0x2a,%esi
+  80020d:	48 bf 77 2f 80 00 00 	movabs $0x802f77,%rdi
+  800214:	00 00 00 
+  800217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021c:	49 ba 23 04 80 00 00 	movabs $0x800423,%r10
+  800223:	00 00 00 
+  800226:	41 ff d2             	call   *%r10
+
+0000000000800229 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800229:	55                   	push   %rbp
+  80022a:	48 89 e5             	mov    %rsp,%rbp
+  80022d:	53                   	push   %rbx
+  80022e:	48 83 ec 18          	sub    $0x18,%rsp
+    int id, p[2], r;
+
+    binaryname = "primespipe";
+  800232:	48 b8 d5 2f 80 00 00 	movabs $0x802fd5,%rax
+  800239:	00 00 00 
+  80023c:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800243:	00 00 00 
+
+    if ((r = pipe(p)) < 0)
+  800246:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+  80024a:	48 b8 83 27 80 00 00 	movabs $0x802783,%rax
+  800251:	00 00 00 
+  800254:	ff d0                	call   *%rax
+  800256:	85 c0                	test   %eax,%eax
+  800258:	78 30                	js     80028a <umain+0x61>
+        panic("pipe: %i", r);
+
+    /* Fork the first prime process in the chain */
+    if ((id = fork()) < 0)
+  80025a:	48 b8 ea 19 80 00 00 	movabs $0x8019ea,%rax
+  800261:	00 00 00 
+  800264:	ff d0                	call   *%rax
+  800266:	85 c0                	test   %eax,%eax
+  800268:	78 4d                	js     8002b7 <umain+0x8e>
+        panic("fork: %i", id);
+
+    if (id == 0) {
+  80026a:	75 78                	jne    8002e4 <umain+0xbb>
+        close(p[1]);
+  80026c:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  80026f:	48 b8 dd 1c 80 00 00 	movabs $0x801cdd,%rax
+  800276:	00 00 00 
+  800279:	ff d0                	call   *%rax
+        primeproc(p[0]);
+  80027b:	8b 7d e8             	mov    -0x18(%rbp),%edi
+  80027e:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800285:	00 00 00 
+  800288:	ff d0                	call   *%rax
+        panic("pipe: %i", r);
+  80028a:	89 c1                	mov    %eax,%ecx
+  80028c:	48 ba 8d 2f 80 00 00 	movabs $0x802f8d,%rdx
+  800293:	00 00 00 
+  800296:	be 38 00 00 00       	mov    $0x38,%esi
+  80029b:	48 bf 77 2f 80 00 00 	movabs $0x802f77,%rdi
+  8002a2:	00 00 00 
+  8002a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002aa:	49 b8 23 04 80 00 00 	movabs $0x800423,%r8
+  8002b1:	00 00 00 
+  8002b4:	41 ff d0             	call   *%r8
+        panic("fork: %i", id);
+  8002b7:	89 c1                	mov    %eax,%ecx
+  8002b9:	48 ba 96 2f 80 00 00 	movabs $0x802f96,%rdx
+  8002c0:	00 00 00 
+  8002c3:	be 3c 00 00 00       	mov    $0x3c,%esi
+  8002c8:	48 bf 77 2f 80 00 00 	movabs $0x802f77,%rdi
+  8002cf:	00 00 00 
+  8002d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d7:	49 b8 23 04 80 00 00 	movabs $0x800423,%r8
+  8002de:	00 00 00 
+  8002e1:	41 ff d0             	call   *%r8
+    }
+
+    close(p[0]);
+  8002e4:	8b 7d e8             	mov    -0x18(%rbp),%edi
+  8002e7:	48 b8 dd 1c 80 00 00 	movabs $0x801cdd,%rax
+  8002ee:	00 00 00 
+  8002f1:	ff d0                	call   *%rax
+  8002f3:	b8 02 00 00 00       	mov    $0x2,%eax
+
+    /* Feed all the integers through */
+    for (int i = 2;; i++)
+        if ((r = write(p[1], &i, 4)) != 4)
+  8002f8:	48 bb 8a 1f 80 00 00 	movabs $0x801f8a,%rbx
+  8002ff:	00 00 00 
+  800302:	eb 06                	jmp    80030a <umain+0xe1>
+    for (int i = 2;; i++)
+  800304:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800307:	83 c0 01             	add    $0x1,%eax
+  80030a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+        if ((r = write(p[1], &i, 4)) != 4)
+  80030d:	ba 04 00 00 00       	mov    $0x4,%edx
+  800312:	48 8d 75 e4          	lea    -0x1c(%rbp),%rsi
+  800316:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  800319:	ff d3                	call   *%rbx
+  80031b:	89 c1                	mov    %eax,%ecx
+  80031d:	83 f8 04             	cmp    $0x4,%eax
+  800320:	74 e2                	je     800304 <umain+0xdb>
+            panic("generator write: %d, %i", r, r >= 0 ? 0 : r);
+  800322:	85 c0                	test   %eax,%eax
+  800324:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80032a:	44 0f 4e c0          	cmovle %eax,%r8d
+  80032e:	48 ba e0 2f 80 00 00 	movabs $0x802fe0,%rdx
+  800335:	00 00 00 
+  800338:	be 48 00 00 00       	mov    $0x48,%esi
+  80033d:	48 bf 77 2f 80 00 00 	movabs $0x802f77,%rdi
+  800344:	00 00 00 
+  800347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034c:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  800353:	00 00 00 
+  800356:	41 ff d1             	call   *%r9
+
+0000000000800359 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800359:	55                   	push   %rbp
+  80035a:	48 89 e5             	mov    %rsp,%rbp
+  80035d:	41 56                	push   %r14
+  80035f:	41 55                	push   %r13
+  800361:	41 54                	push   %r12
+  800363:	53                   	push   %rbx
+  800364:	41 89 fd             	mov    %edi,%r13d
+  800367:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80036a:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800371:	00 00 00 
+  800374:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80037b:	00 00 00 
+  80037e:	48 39 c2             	cmp    %rax,%rdx
+  800381:	73 17                	jae    80039a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800383:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800386:	49 89 c4             	mov    %rax,%r12
+  800389:	48 83 c3 08          	add    $0x8,%rbx
+  80038d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800392:	ff 53 f8             	call   *-0x8(%rbx)
+  800395:	4c 39 e3             	cmp    %r12,%rbx
+  800398:	72 ef                	jb     800389 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  80039a:	48 b8 88 13 80 00 00 	movabs $0x801388,%rax
+  8003a1:	00 00 00 
+  8003a4:	ff d0                	call   *%rax
+  8003a6:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8003a9:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8003b0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003b7:	00 00 00 
+  8003ba:	48 01 d0             	add    %rdx,%rax
+  8003bd:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8003c4:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003c7:	45 85 ed             	test   %r13d,%r13d
+  8003ca:	7e 0d                	jle    8003d9 <libmain+0x80>
+  8003cc:	49 8b 06             	mov    (%r14),%rax
+  8003cf:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8003d6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003d9:	4c 89 f6             	mov    %r14,%rsi
+  8003dc:	44 89 ef             	mov    %r13d,%edi
+  8003df:	48 b8 29 02 80 00 00 	movabs $0x800229,%rax
+  8003e6:	00 00 00 
+  8003e9:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8003eb:	48 b8 00 04 80 00 00 	movabs $0x800400,%rax
+  8003f2:	00 00 00 
+  8003f5:	ff d0                	call   *%rax
+#endif
+}
+  8003f7:	5b                   	pop    %rbx
+  8003f8:	41 5c                	pop    %r12
+  8003fa:	41 5d                	pop    %r13
+  8003fc:	41 5e                	pop    %r14
+  8003fe:	5d                   	pop    %rbp
+  8003ff:	c3                   	ret
+
+0000000000800400 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800400:	55                   	push   %rbp
+  800401:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800404:	48 b8 10 1d 80 00 00 	movabs $0x801d10,%rax
+  80040b:	00 00 00 
+  80040e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800410:	bf 00 00 00 00       	mov    $0x0,%edi
+  800415:	48 b8 1d 13 80 00 00 	movabs $0x80131d,%rax
+  80041c:	00 00 00 
+  80041f:	ff d0                	call   *%rax
+}
+  800421:	5d                   	pop    %rbp
+  800422:	c3                   	ret
+
+0000000000800423 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800423:	55                   	push   %rbp
+  800424:	48 89 e5             	mov    %rsp,%rbp
+  800427:	41 56                	push   %r14
+  800429:	41 55                	push   %r13
+  80042b:	41 54                	push   %r12
+  80042d:	53                   	push   %rbx
+  80042e:	48 83 ec 50          	sub    $0x50,%rsp
+  800432:	49 89 fc             	mov    %rdi,%r12
+  800435:	41 89 f5             	mov    %esi,%r13d
+  800438:	48 89 d3             	mov    %rdx,%rbx
+  80043b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80043f:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800443:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800447:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80044e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800452:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800456:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80045a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80045e:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800465:	00 00 00 
+  800468:	4c 8b 30             	mov    (%rax),%r14
+  80046b:	48 b8 88 13 80 00 00 	movabs $0x801388,%rax
+  800472:	00 00 00 
+  800475:	ff d0                	call   *%rax
+  800477:	89 c6                	mov    %eax,%esi
+  800479:	45 89 e8             	mov    %r13d,%r8d
+  80047c:	4c 89 e1             	mov    %r12,%rcx
+  80047f:	4c 89 f2             	mov    %r14,%rdx
+  800482:	48 bf 08 30 80 00 00 	movabs $0x803008,%rdi
+  800489:	00 00 00 
+  80048c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800491:	49 bc 73 05 80 00 00 	movabs $0x800573,%r12
+  800498:	00 00 00 
+  80049b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80049e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004a2:	48 89 df             	mov    %rbx,%rdi
+  8004a5:	48 b8 0f 05 80 00 00 	movabs $0x80050f,%rax
+  8004ac:	00 00 00 
+  8004af:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004b1:	48 bf 8b 2f 80 00 00 	movabs $0x802f8b,%rdi
+  8004b8:	00 00 00 
+  8004bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c0:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004c3:	cc                   	int3
+  8004c4:	eb fd                	jmp    8004c3 <_panic+0xa0>
+
+00000000008004c6 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004c6:	55                   	push   %rbp
+  8004c7:	48 89 e5             	mov    %rsp,%rbp
+  8004ca:	53                   	push   %rbx
+  8004cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8004cf:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004d2:	8b 06                	mov    (%rsi),%eax
+  8004d4:	8d 50 01             	lea    0x1(%rax),%edx
+  8004d7:	89 16                	mov    %edx,(%rsi)
+  8004d9:	48 98                	cltq
+  8004db:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004e0:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004e6:	74 0a                	je     8004f2 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004e8:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8004ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004f0:	c9                   	leave
+  8004f1:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8004f2:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8004f6:	be ff 00 00 00       	mov    $0xff,%esi
+  8004fb:	48 b8 bf 12 80 00 00 	movabs $0x8012bf,%rax
+  800502:	00 00 00 
+  800505:	ff d0                	call   *%rax
+        state->offset = 0;
+  800507:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80050d:	eb d9                	jmp    8004e8 <putch+0x22>
+
+000000000080050f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80050f:	55                   	push   %rbp
+  800510:	48 89 e5             	mov    %rsp,%rbp
+  800513:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80051a:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80051d:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800524:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800529:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800531:	48 89 f1             	mov    %rsi,%rcx
+  800534:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80053b:	48 bf c6 04 80 00 00 	movabs $0x8004c6,%rdi
+  800542:	00 00 00 
+  800545:	48 b8 c3 06 80 00 00 	movabs $0x8006c3,%rax
+  80054c:	00 00 00 
+  80054f:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800551:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800558:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80055f:	48 b8 bf 12 80 00 00 	movabs $0x8012bf,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80056b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800571:	c9                   	leave
+  800572:	c3                   	ret
+
+0000000000800573 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800573:	55                   	push   %rbp
+  800574:	48 89 e5             	mov    %rsp,%rbp
+  800577:	48 83 ec 50          	sub    $0x50,%rsp
+  80057b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80057f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800583:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800587:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80058b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80058f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800596:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80059a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80059e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005a2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005a6:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005aa:	48 b8 0f 05 80 00 00 	movabs $0x80050f,%rax
+  8005b1:	00 00 00 
+  8005b4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005b6:	c9                   	leave
+  8005b7:	c3                   	ret
+
+00000000008005b8 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005b8:	55                   	push   %rbp
+  8005b9:	48 89 e5             	mov    %rsp,%rbp
+  8005bc:	41 57                	push   %r15
+  8005be:	41 56                	push   %r14
+  8005c0:	41 55                	push   %r13
+  8005c2:	41 54                	push   %r12
+  8005c4:	53                   	push   %rbx
+  8005c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8005c9:	49 89 fc             	mov    %rdi,%r12
+  8005cc:	49 89 f5             	mov    %rsi,%r13
+  8005cf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005d3:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005d6:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005d9:	41 89 cf             	mov    %ecx,%r15d
+  8005dc:	4c 39 fa             	cmp    %r15,%rdx
+  8005df:	73 5b                	jae    80063c <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005e1:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8005e5:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005e9:	85 db                	test   %ebx,%ebx
+  8005eb:	7e 0e                	jle    8005fb <print_num+0x43>
+            putch(padc, put_arg);
+  8005ed:	4c 89 ee             	mov    %r13,%rsi
+  8005f0:	44 89 f7             	mov    %r14d,%edi
+  8005f3:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8005f6:	83 eb 01             	sub    $0x1,%ebx
+  8005f9:	75 f2                	jne    8005ed <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8005fb:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8005ff:	48 b9 3c 30 80 00 00 	movabs $0x80303c,%rcx
+  800606:	00 00 00 
+  800609:	48 b8 2b 30 80 00 00 	movabs $0x80302b,%rax
+  800610:	00 00 00 
+  800613:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800617:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80061b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800620:	49 f7 f7             	div    %r15
+  800623:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800627:	4c 89 ee             	mov    %r13,%rsi
+  80062a:	41 ff d4             	call   *%r12
+}
+  80062d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800631:	5b                   	pop    %rbx
+  800632:	41 5c                	pop    %r12
+  800634:	41 5d                	pop    %r13
+  800636:	41 5e                	pop    %r14
+  800638:	41 5f                	pop    %r15
+  80063a:	5d                   	pop    %rbp
+  80063b:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80063c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800640:	ba 00 00 00 00       	mov    $0x0,%edx
+  800645:	49 f7 f7             	div    %r15
+  800648:	48 83 ec 08          	sub    $0x8,%rsp
+  80064c:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800650:	52                   	push   %rdx
+  800651:	45 0f be c9          	movsbl %r9b,%r9d
+  800655:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800659:	48 89 c2             	mov    %rax,%rdx
+  80065c:	48 b8 b8 05 80 00 00 	movabs $0x8005b8,%rax
+  800663:	00 00 00 
+  800666:	ff d0                	call   *%rax
+  800668:	48 83 c4 10          	add    $0x10,%rsp
+  80066c:	eb 8d                	jmp    8005fb <print_num+0x43>
+
+000000000080066e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80066e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800672:	48 8b 06             	mov    (%rsi),%rax
+  800675:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800679:	73 0a                	jae    800685 <sprintputch+0x17>
+        *state->start++ = ch;
+  80067b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80067f:	48 89 16             	mov    %rdx,(%rsi)
+  800682:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800685:	c3                   	ret
+
+0000000000800686 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800686:	55                   	push   %rbp
+  800687:	48 89 e5             	mov    %rsp,%rbp
+  80068a:	48 83 ec 50          	sub    $0x50,%rsp
+  80068e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800692:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800696:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80069a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006a1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006ad:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006b1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006b5:	48 b8 c3 06 80 00 00 	movabs $0x8006c3,%rax
+  8006bc:	00 00 00 
+  8006bf:	ff d0                	call   *%rax
+}
+  8006c1:	c9                   	leave
+  8006c2:	c3                   	ret
+
+00000000008006c3 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006c3:	55                   	push   %rbp
+  8006c4:	48 89 e5             	mov    %rsp,%rbp
+  8006c7:	41 57                	push   %r15
+  8006c9:	41 56                	push   %r14
+  8006cb:	41 55                	push   %r13
+  8006cd:	41 54                	push   %r12
+  8006cf:	53                   	push   %rbx
+  8006d0:	48 83 ec 38          	sub    $0x38,%rsp
+  8006d4:	49 89 fe             	mov    %rdi,%r14
+  8006d7:	49 89 f5             	mov    %rsi,%r13
+  8006da:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006dd:	48 8b 01             	mov    (%rcx),%rax
+  8006e0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8006e4:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ec:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8006f0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8006f4:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8006f8:	0f b6 3b             	movzbl (%rbx),%edi
+  8006fb:	40 80 ff 25          	cmp    $0x25,%dil
+  8006ff:	74 18                	je     800719 <vprintfmt+0x56>
+            if (!ch) return;
+  800701:	40 84 ff             	test   %dil,%dil
+  800704:	0f 84 b1 06 00 00    	je     800dbb <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80070a:	40 0f b6 ff          	movzbl %dil,%edi
+  80070e:	4c 89 ee             	mov    %r13,%rsi
+  800711:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800714:	4c 89 e3             	mov    %r12,%rbx
+  800717:	eb db                	jmp    8006f4 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800719:	be 00 00 00 00       	mov    $0x0,%esi
+  80071e:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800722:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800727:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80072d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800734:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800738:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80073d:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800742:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800745:	83 e8 23             	sub    $0x23,%eax
+  800748:	3c 57                	cmp    $0x57,%al
+  80074a:	0f 87 51 06 00 00    	ja     800da1 <vprintfmt+0x6de>
+  800750:	0f b6 c0             	movzbl %al,%eax
+  800753:	48 b9 e0 31 80 00 00 	movabs $0x8031e0,%rcx
+  80075a:	00 00 00 
+  80075d:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800760:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800763:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800767:	eb cf                	jmp    800738 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800769:	49 89 dc             	mov    %rbx,%r12
+  80076c:	be 01 00 00 00       	mov    $0x1,%esi
+  800771:	eb c5                	jmp    800738 <vprintfmt+0x75>
+            padc = ch;
+  800773:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800777:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80077a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80077d:	eb b9                	jmp    800738 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80077f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800782:	83 f8 2f             	cmp    $0x2f,%eax
+  800785:	77 24                	ja     8007ab <vprintfmt+0xe8>
+  800787:	89 c1                	mov    %eax,%ecx
+  800789:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80078d:	83 c0 08             	add    $0x8,%eax
+  800790:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800793:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800796:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800799:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80079d:	79 99                	jns    800738 <vprintfmt+0x75>
+                width = precision;
+  80079f:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007a3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007a9:	eb 8d                	jmp    800738 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007ab:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007af:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b7:	eb da                	jmp    800793 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007b9:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007be:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007c2:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007c8:	3c 39                	cmp    $0x39,%al
+  8007ca:	77 1c                	ja     8007e8 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007cc:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007d0:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007d4:	0f b6 c0             	movzbl %al,%eax
+  8007d7:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007dc:	0f b6 03             	movzbl (%rbx),%eax
+  8007df:	3c 39                	cmp    $0x39,%al
+  8007e1:	76 e9                	jbe    8007cc <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007e3:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007e6:	eb b1                	jmp    800799 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007e8:	49 89 dc             	mov    %rbx,%r12
+  8007eb:	eb ac                	jmp    800799 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8007ed:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007f0:	85 c9                	test   %ecx,%ecx
+  8007f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f7:	0f 49 c1             	cmovns %ecx,%eax
+  8007fa:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8007fd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800800:	e9 33 ff ff ff       	jmp    800738 <vprintfmt+0x75>
+            lflag++;
+  800805:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800808:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80080b:	e9 28 ff ff ff       	jmp    800738 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800810:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800813:	83 f8 2f             	cmp    $0x2f,%eax
+  800816:	77 19                	ja     800831 <vprintfmt+0x16e>
+  800818:	89 c2                	mov    %eax,%edx
+  80081a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081e:	83 c0 08             	add    $0x8,%eax
+  800821:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800824:	8b 3a                	mov    (%rdx),%edi
+  800826:	4c 89 ee             	mov    %r13,%rsi
+  800829:	41 ff d6             	call   *%r14
+            break;
+  80082c:	e9 c3 fe ff ff       	jmp    8006f4 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800831:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800835:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800839:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083d:	eb e5                	jmp    800824 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80083f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800842:	83 f8 2f             	cmp    $0x2f,%eax
+  800845:	77 5a                	ja     8008a1 <vprintfmt+0x1de>
+  800847:	89 c2                	mov    %eax,%edx
+  800849:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084d:	83 c0 08             	add    $0x8,%eax
+  800850:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800853:	8b 02                	mov    (%rdx),%eax
+  800855:	89 c1                	mov    %eax,%ecx
+  800857:	f7 d9                	neg    %ecx
+  800859:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80085c:	83 f9 15             	cmp    $0x15,%ecx
+  80085f:	7f 4e                	jg     8008af <vprintfmt+0x1ec>
+  800861:	48 63 c1             	movslq %ecx,%rax
+  800864:	48 ba a0 34 80 00 00 	movabs $0x8034a0,%rdx
+  80086b:	00 00 00 
+  80086e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800872:	48 85 c0             	test   %rax,%rax
+  800875:	74 38                	je     8008af <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800877:	48 89 c1             	mov    %rax,%rcx
+  80087a:	48 ba 99 36 80 00 00 	movabs $0x803699,%rdx
+  800881:	00 00 00 
+  800884:	4c 89 ee             	mov    %r13,%rsi
+  800887:	4c 89 f7             	mov    %r14,%rdi
+  80088a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088f:	49 b8 86 06 80 00 00 	movabs $0x800686,%r8
+  800896:	00 00 00 
+  800899:	41 ff d0             	call   *%r8
+  80089c:	e9 53 fe ff ff       	jmp    8006f4 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ad:	eb a4                	jmp    800853 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008af:	48 ba 54 30 80 00 00 	movabs $0x803054,%rdx
+  8008b6:	00 00 00 
+  8008b9:	4c 89 ee             	mov    %r13,%rsi
+  8008bc:	4c 89 f7             	mov    %r14,%rdi
+  8008bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c4:	49 b8 86 06 80 00 00 	movabs $0x800686,%r8
+  8008cb:	00 00 00 
+  8008ce:	41 ff d0             	call   *%r8
+  8008d1:	e9 1e fe ff ff       	jmp    8006f4 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008dc:	77 6c                	ja     80094a <vprintfmt+0x287>
+  8008de:	89 c2                	mov    %eax,%edx
+  8008e0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e4:	83 c0 08             	add    $0x8,%eax
+  8008e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ea:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8008ed:	48 85 d2             	test   %rdx,%rdx
+  8008f0:	48 b8 4d 30 80 00 00 	movabs $0x80304d,%rax
+  8008f7:	00 00 00 
+  8008fa:	48 0f 45 c2          	cmovne %rdx,%rax
+  8008fe:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800902:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800906:	7e 06                	jle    80090e <vprintfmt+0x24b>
+  800908:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80090c:	75 4a                	jne    800958 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80090e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800912:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800916:	0f b6 00             	movzbl (%rax),%eax
+  800919:	84 c0                	test   %al,%al
+  80091b:	0f 85 9a 00 00 00    	jne    8009bb <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800921:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800924:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800928:	85 c0                	test   %eax,%eax
+  80092a:	0f 8e c4 fd ff ff    	jle    8006f4 <vprintfmt+0x31>
+  800930:	4c 89 ee             	mov    %r13,%rsi
+  800933:	bf 20 00 00 00       	mov    $0x20,%edi
+  800938:	41 ff d6             	call   *%r14
+  80093b:	41 83 ec 01          	sub    $0x1,%r12d
+  80093f:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800943:	75 eb                	jne    800930 <vprintfmt+0x26d>
+  800945:	e9 aa fd ff ff       	jmp    8006f4 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80094a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80094e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800952:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800956:	eb 92                	jmp    8008ea <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800958:	49 63 f7             	movslq %r15d,%rsi
+  80095b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80095f:	48 b8 75 0e 80 00 00 	movabs $0x800e75,%rax
+  800966:	00 00 00 
+  800969:	ff d0                	call   *%rax
+  80096b:	48 89 c2             	mov    %rax,%rdx
+  80096e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800971:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800973:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800976:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800979:	85 c0                	test   %eax,%eax
+  80097b:	7e 91                	jle    80090e <vprintfmt+0x24b>
+  80097d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800982:	4c 89 ee             	mov    %r13,%rsi
+  800985:	44 89 e7             	mov    %r12d,%edi
+  800988:	41 ff d6             	call   *%r14
+  80098b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80098f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800992:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800995:	75 eb                	jne    800982 <vprintfmt+0x2bf>
+  800997:	e9 72 ff ff ff       	jmp    80090e <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80099c:	0f b6 f8             	movzbl %al,%edi
+  80099f:	4c 89 ee             	mov    %r13,%rsi
+  8009a2:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009a5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009a9:	49 83 c4 01          	add    $0x1,%r12
+  8009ad:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009b3:	84 c0                	test   %al,%al
+  8009b5:	0f 84 66 ff ff ff    	je     800921 <vprintfmt+0x25e>
+  8009bb:	45 85 ff             	test   %r15d,%r15d
+  8009be:	78 0a                	js     8009ca <vprintfmt+0x307>
+  8009c0:	41 83 ef 01          	sub    $0x1,%r15d
+  8009c4:	0f 88 57 ff ff ff    	js     800921 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009ca:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009ce:	74 cc                	je     80099c <vprintfmt+0x2d9>
+  8009d0:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009d3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009d8:	80 fa 5e             	cmp    $0x5e,%dl
+  8009db:	77 c2                	ja     80099f <vprintfmt+0x2dc>
+  8009dd:	eb bd                	jmp    80099c <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8009df:	40 84 f6             	test   %sil,%sil
+  8009e2:	75 26                	jne    800a0a <vprintfmt+0x347>
+    switch (lflag) {
+  8009e4:	85 d2                	test   %edx,%edx
+  8009e6:	74 59                	je     800a41 <vprintfmt+0x37e>
+  8009e8:	83 fa 01             	cmp    $0x1,%edx
+  8009eb:	74 7b                	je     800a68 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8009ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f3:	0f 87 96 00 00 00    	ja     800a8f <vprintfmt+0x3cc>
+  8009f9:	89 c2                	mov    %eax,%edx
+  8009fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ff:	83 c0 08             	add    $0x8,%eax
+  800a02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a05:	4c 8b 22             	mov    (%rdx),%r12
+  800a08:	eb 17                	jmp    800a21 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a0a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a10:	77 21                	ja     800a33 <vprintfmt+0x370>
+  800a12:	89 c2                	mov    %eax,%edx
+  800a14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a18:	83 c0 08             	add    $0x8,%eax
+  800a1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a1e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a21:	4d 85 e4             	test   %r12,%r12
+  800a24:	78 7a                	js     800aa0 <vprintfmt+0x3dd>
+            num = i;
+  800a26:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a29:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a2e:	e9 50 02 00 00       	jmp    800c83 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3f:	eb dd                	jmp    800a1e <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a41:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a44:	83 f8 2f             	cmp    $0x2f,%eax
+  800a47:	77 11                	ja     800a5a <vprintfmt+0x397>
+  800a49:	89 c2                	mov    %eax,%edx
+  800a4b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4f:	83 c0 08             	add    $0x8,%eax
+  800a52:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a55:	4c 63 22             	movslq (%rdx),%r12
+  800a58:	eb c7                	jmp    800a21 <vprintfmt+0x35e>
+  800a5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a66:	eb ed                	jmp    800a55 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a68:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6e:	77 11                	ja     800a81 <vprintfmt+0x3be>
+  800a70:	89 c2                	mov    %eax,%edx
+  800a72:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a76:	83 c0 08             	add    $0x8,%eax
+  800a79:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7c:	4c 8b 22             	mov    (%rdx),%r12
+  800a7f:	eb a0                	jmp    800a21 <vprintfmt+0x35e>
+  800a81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8d:	eb ed                	jmp    800a7c <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9b:	e9 65 ff ff ff       	jmp    800a05 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800aa0:	4c 89 ee             	mov    %r13,%rsi
+  800aa3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800aa8:	41 ff d6             	call   *%r14
+                i = -i;
+  800aab:	49 f7 dc             	neg    %r12
+  800aae:	e9 73 ff ff ff       	jmp    800a26 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800ab3:	40 84 f6             	test   %sil,%sil
+  800ab6:	75 32                	jne    800aea <vprintfmt+0x427>
+    switch (lflag) {
+  800ab8:	85 d2                	test   %edx,%edx
+  800aba:	74 5d                	je     800b19 <vprintfmt+0x456>
+  800abc:	83 fa 01             	cmp    $0x1,%edx
+  800abf:	0f 84 82 00 00 00    	je     800b47 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800ac5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac8:	83 f8 2f             	cmp    $0x2f,%eax
+  800acb:	0f 87 a5 00 00 00    	ja     800b76 <vprintfmt+0x4b3>
+  800ad1:	89 c2                	mov    %eax,%edx
+  800ad3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad7:	83 c0 08             	add    $0x8,%eax
+  800ada:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800add:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ae0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ae5:	e9 99 01 00 00       	jmp    800c83 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aed:	83 f8 2f             	cmp    $0x2f,%eax
+  800af0:	77 19                	ja     800b0b <vprintfmt+0x448>
+  800af2:	89 c2                	mov    %eax,%edx
+  800af4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af8:	83 c0 08             	add    $0x8,%eax
+  800afb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800afe:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b01:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b06:	e9 78 01 00 00       	jmp    800c83 <vprintfmt+0x5c0>
+  800b0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b17:	eb e5                	jmp    800afe <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b19:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b1c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b1f:	77 18                	ja     800b39 <vprintfmt+0x476>
+  800b21:	89 c2                	mov    %eax,%edx
+  800b23:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b27:	83 c0 08             	add    $0x8,%eax
+  800b2a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b2d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b2f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b34:	e9 4a 01 00 00       	jmp    800c83 <vprintfmt+0x5c0>
+  800b39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b45:	eb e6                	jmp    800b2d <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b47:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b4d:	77 19                	ja     800b68 <vprintfmt+0x4a5>
+  800b4f:	89 c2                	mov    %eax,%edx
+  800b51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b55:	83 c0 08             	add    $0x8,%eax
+  800b58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b5b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b5e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b63:	e9 1b 01 00 00       	jmp    800c83 <vprintfmt+0x5c0>
+  800b68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b74:	eb e5                	jmp    800b5b <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b82:	e9 56 ff ff ff       	jmp    800add <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b87:	40 84 f6             	test   %sil,%sil
+  800b8a:	75 2e                	jne    800bba <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b8c:	85 d2                	test   %edx,%edx
+  800b8e:	74 59                	je     800be9 <vprintfmt+0x526>
+  800b90:	83 fa 01             	cmp    $0x1,%edx
+  800b93:	74 7f                	je     800c14 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b95:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b98:	83 f8 2f             	cmp    $0x2f,%eax
+  800b9b:	0f 87 9f 00 00 00    	ja     800c40 <vprintfmt+0x57d>
+  800ba1:	89 c2                	mov    %eax,%edx
+  800ba3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba7:	83 c0 08             	add    $0x8,%eax
+  800baa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bad:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bb0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bb5:	e9 c9 00 00 00       	jmp    800c83 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbd:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc0:	77 19                	ja     800bdb <vprintfmt+0x518>
+  800bc2:	89 c2                	mov    %eax,%edx
+  800bc4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc8:	83 c0 08             	add    $0x8,%eax
+  800bcb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bce:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bd1:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bd6:	e9 a8 00 00 00       	jmp    800c83 <vprintfmt+0x5c0>
+  800bdb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bdf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be7:	eb e5                	jmp    800bce <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800be9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bec:	83 f8 2f             	cmp    $0x2f,%eax
+  800bef:	77 15                	ja     800c06 <vprintfmt+0x543>
+  800bf1:	89 c2                	mov    %eax,%edx
+  800bf3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf7:	83 c0 08             	add    $0x8,%eax
+  800bfa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bfd:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800bff:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c04:	eb 7d                	jmp    800c83 <vprintfmt+0x5c0>
+  800c06:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c0a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c0e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c12:	eb e9                	jmp    800bfd <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c17:	83 f8 2f             	cmp    $0x2f,%eax
+  800c1a:	77 16                	ja     800c32 <vprintfmt+0x56f>
+  800c1c:	89 c2                	mov    %eax,%edx
+  800c1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c22:	83 c0 08             	add    $0x8,%eax
+  800c25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c28:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c2b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c30:	eb 51                	jmp    800c83 <vprintfmt+0x5c0>
+  800c32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3e:	eb e8                	jmp    800c28 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c4c:	e9 5c ff ff ff       	jmp    800bad <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c51:	4c 89 ee             	mov    %r13,%rsi
+  800c54:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c59:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c5c:	4c 89 ee             	mov    %r13,%rsi
+  800c5f:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c64:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c6d:	77 47                	ja     800cb6 <vprintfmt+0x5f3>
+  800c6f:	89 c2                	mov    %eax,%edx
+  800c71:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c75:	83 c0 08             	add    $0x8,%eax
+  800c78:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c7b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c7e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c83:	48 83 ec 08          	sub    $0x8,%rsp
+  800c87:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c8b:	0f 94 c0             	sete   %al
+  800c8e:	0f b6 c0             	movzbl %al,%eax
+  800c91:	50                   	push   %rax
+  800c92:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c97:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c9b:	4c 89 ee             	mov    %r13,%rsi
+  800c9e:	4c 89 f7             	mov    %r14,%rdi
+  800ca1:	48 b8 b8 05 80 00 00 	movabs $0x8005b8,%rax
+  800ca8:	00 00 00 
+  800cab:	ff d0                	call   *%rax
+            break;
+  800cad:	48 83 c4 10          	add    $0x10,%rsp
+  800cb1:	e9 3e fa ff ff       	jmp    8006f4 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cb6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cbe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc2:	eb b7                	jmp    800c7b <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800cc4:	40 84 f6             	test   %sil,%sil
+  800cc7:	75 2b                	jne    800cf4 <vprintfmt+0x631>
+    switch (lflag) {
+  800cc9:	85 d2                	test   %edx,%edx
+  800ccb:	74 56                	je     800d23 <vprintfmt+0x660>
+  800ccd:	83 fa 01             	cmp    $0x1,%edx
+  800cd0:	74 7f                	je     800d51 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800cd2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd5:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd8:	0f 87 a2 00 00 00    	ja     800d80 <vprintfmt+0x6bd>
+  800cde:	89 c2                	mov    %eax,%edx
+  800ce0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ce4:	83 c0 08             	add    $0x8,%eax
+  800ce7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cea:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ced:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cf2:	eb 8f                	jmp    800c83 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800cf4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf7:	83 f8 2f             	cmp    $0x2f,%eax
+  800cfa:	77 19                	ja     800d15 <vprintfmt+0x652>
+  800cfc:	89 c2                	mov    %eax,%edx
+  800cfe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d02:	83 c0 08             	add    $0x8,%eax
+  800d05:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d08:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d0b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d10:	e9 6e ff ff ff       	jmp    800c83 <vprintfmt+0x5c0>
+  800d15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d19:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d21:	eb e5                	jmp    800d08 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d23:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d26:	83 f8 2f             	cmp    $0x2f,%eax
+  800d29:	77 18                	ja     800d43 <vprintfmt+0x680>
+  800d2b:	89 c2                	mov    %eax,%edx
+  800d2d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d31:	83 c0 08             	add    $0x8,%eax
+  800d34:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d37:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d39:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d3e:	e9 40 ff ff ff       	jmp    800c83 <vprintfmt+0x5c0>
+  800d43:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d47:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d4b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d4f:	eb e6                	jmp    800d37 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d51:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d54:	83 f8 2f             	cmp    $0x2f,%eax
+  800d57:	77 19                	ja     800d72 <vprintfmt+0x6af>
+  800d59:	89 c2                	mov    %eax,%edx
+  800d5b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d5f:	83 c0 08             	add    $0x8,%eax
+  800d62:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d65:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d68:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d6d:	e9 11 ff ff ff       	jmp    800c83 <vprintfmt+0x5c0>
+  800d72:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d76:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d7e:	eb e5                	jmp    800d65 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d80:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d84:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d8c:	e9 59 ff ff ff       	jmp    800cea <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d91:	4c 89 ee             	mov    %r13,%rsi
+  800d94:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d99:	41 ff d6             	call   *%r14
+            break;
+  800d9c:	e9 53 f9 ff ff       	jmp    8006f4 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800da1:	4c 89 ee             	mov    %r13,%rsi
+  800da4:	bf 25 00 00 00       	mov    $0x25,%edi
+  800da9:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800dac:	48 83 eb 01          	sub    $0x1,%rbx
+  800db0:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800db4:	75 f6                	jne    800dac <vprintfmt+0x6e9>
+  800db6:	e9 39 f9 ff ff       	jmp    8006f4 <vprintfmt+0x31>
+}
+  800dbb:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800dbf:	5b                   	pop    %rbx
+  800dc0:	41 5c                	pop    %r12
+  800dc2:	41 5d                	pop    %r13
+  800dc4:	41 5e                	pop    %r14
+  800dc6:	41 5f                	pop    %r15
+  800dc8:	5d                   	pop    %rbp
+  800dc9:	c3                   	ret
+
+0000000000800dca <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800dca:	55                   	push   %rbp
+  800dcb:	48 89 e5             	mov    %rsp,%rbp
+  800dce:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800dd2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800dd6:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ddb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ddf:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800de6:	48 85 ff             	test   %rdi,%rdi
+  800de9:	74 2b                	je     800e16 <vsnprintf+0x4c>
+  800deb:	48 85 f6             	test   %rsi,%rsi
+  800dee:	74 26                	je     800e16 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800df0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800df4:	48 bf 6e 06 80 00 00 	movabs $0x80066e,%rdi
+  800dfb:	00 00 00 
+  800dfe:	48 b8 c3 06 80 00 00 	movabs $0x8006c3,%rax
+  800e05:	00 00 00 
+  800e08:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e0e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e11:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e14:	c9                   	leave
+  800e15:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e16:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e1b:	eb f7                	jmp    800e14 <vsnprintf+0x4a>
+
+0000000000800e1d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e1d:	55                   	push   %rbp
+  800e1e:	48 89 e5             	mov    %rsp,%rbp
+  800e21:	48 83 ec 50          	sub    $0x50,%rsp
+  800e25:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e29:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e2d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e31:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e38:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e3c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e40:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e44:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e48:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e4c:	48 b8 ca 0d 80 00 00 	movabs $0x800dca,%rax
+  800e53:	00 00 00 
+  800e56:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e58:	c9                   	leave
+  800e59:	c3                   	ret
+
+0000000000800e5a <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e5a:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e5d:	74 10                	je     800e6f <strlen+0x15>
+    size_t n = 0;
+  800e5f:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e64:	48 83 c0 01          	add    $0x1,%rax
+  800e68:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e6c:	75 f6                	jne    800e64 <strlen+0xa>
+  800e6e:	c3                   	ret
+    size_t n = 0;
+  800e6f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e74:	c3                   	ret
+
+0000000000800e75 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e75:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e78:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e7d:	48 85 f6             	test   %rsi,%rsi
+  800e80:	74 11                	je     800e93 <strnlen+0x1e>
+  800e82:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e86:	74 0c                	je     800e94 <strnlen+0x1f>
+  800e88:	48 83 c2 01          	add    $0x1,%rdx
+  800e8c:	48 39 d0             	cmp    %rdx,%rax
+  800e8f:	75 f1                	jne    800e82 <strnlen+0xd>
+  800e91:	eb 04                	jmp    800e97 <strnlen+0x22>
+  800e93:	c3                   	ret
+  800e94:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e97:	c3                   	ret
+
+0000000000800e98 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e98:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea0:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ea4:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ea7:	48 83 c2 01          	add    $0x1,%rdx
+  800eab:	84 c9                	test   %cl,%cl
+  800ead:	75 f1                	jne    800ea0 <strcpy+0x8>
+        ;
+    return res;
+}
+  800eaf:	c3                   	ret
+
+0000000000800eb0 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800eb0:	55                   	push   %rbp
+  800eb1:	48 89 e5             	mov    %rsp,%rbp
+  800eb4:	41 54                	push   %r12
+  800eb6:	53                   	push   %rbx
+  800eb7:	48 89 fb             	mov    %rdi,%rbx
+  800eba:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ebd:	48 b8 5a 0e 80 00 00 	movabs $0x800e5a,%rax
+  800ec4:	00 00 00 
+  800ec7:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ec9:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ecd:	4c 89 e6             	mov    %r12,%rsi
+  800ed0:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  800ed7:	00 00 00 
+  800eda:	ff d0                	call   *%rax
+    return dst;
+}
+  800edc:	48 89 d8             	mov    %rbx,%rax
+  800edf:	5b                   	pop    %rbx
+  800ee0:	41 5c                	pop    %r12
+  800ee2:	5d                   	pop    %rbp
+  800ee3:	c3                   	ret
+
+0000000000800ee4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ee4:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ee7:	48 85 d2             	test   %rdx,%rdx
+  800eea:	74 1f                	je     800f0b <strncpy+0x27>
+  800eec:	48 01 fa             	add    %rdi,%rdx
+  800eef:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ef2:	48 83 c1 01          	add    $0x1,%rcx
+  800ef6:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800efa:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800efe:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f02:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f06:	48 39 ca             	cmp    %rcx,%rdx
+  800f09:	75 e7                	jne    800ef2 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f0b:	c3                   	ret
+
+0000000000800f0c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f0c:	48 89 f8             	mov    %rdi,%rax
+  800f0f:	48 85 d2             	test   %rdx,%rdx
+  800f12:	74 24                	je     800f38 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f14:	48 83 ea 01          	sub    $0x1,%rdx
+  800f18:	74 1b                	je     800f35 <strlcpy+0x29>
+  800f1a:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f1e:	0f b6 16             	movzbl (%rsi),%edx
+  800f21:	84 d2                	test   %dl,%dl
+  800f23:	74 10                	je     800f35 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f25:	48 83 c6 01          	add    $0x1,%rsi
+  800f29:	48 83 c0 01          	add    $0x1,%rax
+  800f2d:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f30:	48 39 c8             	cmp    %rcx,%rax
+  800f33:	75 e9                	jne    800f1e <strlcpy+0x12>
+        *dst = '\0';
+  800f35:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f38:	48 29 f8             	sub    %rdi,%rax
+}
+  800f3b:	c3                   	ret
+
+0000000000800f3c <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f3c:	0f b6 07             	movzbl (%rdi),%eax
+  800f3f:	84 c0                	test   %al,%al
+  800f41:	74 13                	je     800f56 <strcmp+0x1a>
+  800f43:	38 06                	cmp    %al,(%rsi)
+  800f45:	75 0f                	jne    800f56 <strcmp+0x1a>
+  800f47:	48 83 c7 01          	add    $0x1,%rdi
+  800f4b:	48 83 c6 01          	add    $0x1,%rsi
+  800f4f:	0f b6 07             	movzbl (%rdi),%eax
+  800f52:	84 c0                	test   %al,%al
+  800f54:	75 ed                	jne    800f43 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f56:	0f b6 c0             	movzbl %al,%eax
+  800f59:	0f b6 16             	movzbl (%rsi),%edx
+  800f5c:	29 d0                	sub    %edx,%eax
+}
+  800f5e:	c3                   	ret
+
+0000000000800f5f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f5f:	48 85 d2             	test   %rdx,%rdx
+  800f62:	74 1f                	je     800f83 <strncmp+0x24>
+  800f64:	0f b6 07             	movzbl (%rdi),%eax
+  800f67:	84 c0                	test   %al,%al
+  800f69:	74 1e                	je     800f89 <strncmp+0x2a>
+  800f6b:	3a 06                	cmp    (%rsi),%al
+  800f6d:	75 1a                	jne    800f89 <strncmp+0x2a>
+  800f6f:	48 83 c7 01          	add    $0x1,%rdi
+  800f73:	48 83 c6 01          	add    $0x1,%rsi
+  800f77:	48 83 ea 01          	sub    $0x1,%rdx
+  800f7b:	75 e7                	jne    800f64 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f82:	c3                   	ret
+  800f83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f88:	c3                   	ret
+  800f89:	48 85 d2             	test   %rdx,%rdx
+  800f8c:	74 09                	je     800f97 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f8e:	0f b6 07             	movzbl (%rdi),%eax
+  800f91:	0f b6 16             	movzbl (%rsi),%edx
+  800f94:	29 d0                	sub    %edx,%eax
+  800f96:	c3                   	ret
+    if (!n) return 0;
+  800f97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f9c:	c3                   	ret
+
+0000000000800f9d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f9d:	0f b6 17             	movzbl (%rdi),%edx
+  800fa0:	84 d2                	test   %dl,%dl
+  800fa2:	74 18                	je     800fbc <strchr+0x1f>
+        if (*str == c) {
+  800fa4:	0f be d2             	movsbl %dl,%edx
+  800fa7:	39 f2                	cmp    %esi,%edx
+  800fa9:	74 17                	je     800fc2 <strchr+0x25>
+    for (; *str; str++) {
+  800fab:	48 83 c7 01          	add    $0x1,%rdi
+  800faf:	0f b6 17             	movzbl (%rdi),%edx
+  800fb2:	84 d2                	test   %dl,%dl
+  800fb4:	75 ee                	jne    800fa4 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fbb:	c3                   	ret
+  800fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc1:	c3                   	ret
+  800fc2:	48 89 f8             	mov    %rdi,%rax
+}
+  800fc5:	c3                   	ret
+
+0000000000800fc6 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fc6:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800fc9:	0f b6 17             	movzbl (%rdi),%edx
+  800fcc:	84 d2                	test   %dl,%dl
+  800fce:	74 13                	je     800fe3 <strfind+0x1d>
+  800fd0:	0f be d2             	movsbl %dl,%edx
+  800fd3:	39 f2                	cmp    %esi,%edx
+  800fd5:	74 0b                	je     800fe2 <strfind+0x1c>
+  800fd7:	48 83 c0 01          	add    $0x1,%rax
+  800fdb:	0f b6 10             	movzbl (%rax),%edx
+  800fde:	84 d2                	test   %dl,%dl
+  800fe0:	75 ee                	jne    800fd0 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800fe2:	c3                   	ret
+  800fe3:	c3                   	ret
+
+0000000000800fe4 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800fe4:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800fe7:	48 89 f8             	mov    %rdi,%rax
+  800fea:	48 f7 d8             	neg    %rax
+  800fed:	83 e0 07             	and    $0x7,%eax
+  800ff0:	49 89 d1             	mov    %rdx,%r9
+  800ff3:	49 29 c1             	sub    %rax,%r9
+  800ff6:	78 36                	js     80102e <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ff8:	40 0f b6 c6          	movzbl %sil,%eax
+  800ffc:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801003:	01 01 01 
+  801006:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80100a:	40 f6 c7 07          	test   $0x7,%dil
+  80100e:	75 38                	jne    801048 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801010:	4c 89 c9             	mov    %r9,%rcx
+  801013:	48 c1 f9 03          	sar    $0x3,%rcx
+  801017:	74 0c                	je     801025 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801019:	fc                   	cld
+  80101a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80101d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801021:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801025:	4d 85 c9             	test   %r9,%r9
+  801028:	75 45                	jne    80106f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80102a:	4c 89 c0             	mov    %r8,%rax
+  80102d:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80102e:	48 85 d2             	test   %rdx,%rdx
+  801031:	74 f7                	je     80102a <memset+0x46>
+  801033:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801036:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801039:	48 83 c0 01          	add    $0x1,%rax
+  80103d:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801041:	48 39 c2             	cmp    %rax,%rdx
+  801044:	75 f3                	jne    801039 <memset+0x55>
+  801046:	eb e2                	jmp    80102a <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801048:	40 f6 c7 01          	test   $0x1,%dil
+  80104c:	74 06                	je     801054 <memset+0x70>
+  80104e:	88 07                	mov    %al,(%rdi)
+  801050:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801054:	40 f6 c7 02          	test   $0x2,%dil
+  801058:	74 07                	je     801061 <memset+0x7d>
+  80105a:	66 89 07             	mov    %ax,(%rdi)
+  80105d:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801061:	40 f6 c7 04          	test   $0x4,%dil
+  801065:	74 a9                	je     801010 <memset+0x2c>
+  801067:	89 07                	mov    %eax,(%rdi)
+  801069:	48 83 c7 04          	add    $0x4,%rdi
+  80106d:	eb a1                	jmp    801010 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80106f:	41 f6 c1 04          	test   $0x4,%r9b
+  801073:	74 06                	je     80107b <memset+0x97>
+  801075:	89 07                	mov    %eax,(%rdi)
+  801077:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80107b:	41 f6 c1 02          	test   $0x2,%r9b
+  80107f:	74 07                	je     801088 <memset+0xa4>
+  801081:	66 89 07             	mov    %ax,(%rdi)
+  801084:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801088:	41 f6 c1 01          	test   $0x1,%r9b
+  80108c:	74 9c                	je     80102a <memset+0x46>
+  80108e:	88 07                	mov    %al,(%rdi)
+  801090:	eb 98                	jmp    80102a <memset+0x46>
+
+0000000000801092 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801092:	48 89 f8             	mov    %rdi,%rax
+  801095:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801098:	48 39 fe             	cmp    %rdi,%rsi
+  80109b:	73 3b                	jae    8010d8 <memmove+0x46>
+  80109d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010a1:	48 39 d7             	cmp    %rdx,%rdi
+  8010a4:	73 32                	jae    8010d8 <memmove+0x46>
+        s += n;
+        d += n;
+  8010a6:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010aa:	48 89 d6             	mov    %rdx,%rsi
+  8010ad:	48 09 fe             	or     %rdi,%rsi
+  8010b0:	48 09 ce             	or     %rcx,%rsi
+  8010b3:	40 f6 c6 07          	test   $0x7,%sil
+  8010b7:	75 12                	jne    8010cb <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010b9:	48 83 ef 08          	sub    $0x8,%rdi
+  8010bd:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010c1:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010c5:	fd                   	std
+  8010c6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010c9:	fc                   	cld
+  8010ca:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010cb:	48 83 ef 01          	sub    $0x1,%rdi
+  8010cf:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010d3:	fd                   	std
+  8010d4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010d6:	eb f1                	jmp    8010c9 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010d8:	48 89 f2             	mov    %rsi,%rdx
+  8010db:	48 09 c2             	or     %rax,%rdx
+  8010de:	48 09 ca             	or     %rcx,%rdx
+  8010e1:	f6 c2 07             	test   $0x7,%dl
+  8010e4:	75 0c                	jne    8010f2 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010e6:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010ea:	48 89 c7             	mov    %rax,%rdi
+  8010ed:	fc                   	cld
+  8010ee:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8010f1:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8010f2:	48 89 c7             	mov    %rax,%rdi
+  8010f5:	fc                   	cld
+  8010f6:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8010f8:	c3                   	ret
+
+00000000008010f9 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8010f9:	55                   	push   %rbp
+  8010fa:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8010fd:	48 b8 92 10 80 00 00 	movabs $0x801092,%rax
+  801104:	00 00 00 
+  801107:	ff d0                	call   *%rax
+}
+  801109:	5d                   	pop    %rbp
+  80110a:	c3                   	ret
+
+000000000080110b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80110b:	55                   	push   %rbp
+  80110c:	48 89 e5             	mov    %rsp,%rbp
+  80110f:	41 57                	push   %r15
+  801111:	41 56                	push   %r14
+  801113:	41 55                	push   %r13
+  801115:	41 54                	push   %r12
+  801117:	53                   	push   %rbx
+  801118:	48 83 ec 08          	sub    $0x8,%rsp
+  80111c:	49 89 fe             	mov    %rdi,%r14
+  80111f:	49 89 f7             	mov    %rsi,%r15
+  801122:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801125:	48 89 f7             	mov    %rsi,%rdi
+  801128:	48 b8 5a 0e 80 00 00 	movabs $0x800e5a,%rax
+  80112f:	00 00 00 
+  801132:	ff d0                	call   *%rax
+  801134:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801137:	48 89 de             	mov    %rbx,%rsi
+  80113a:	4c 89 f7             	mov    %r14,%rdi
+  80113d:	48 b8 75 0e 80 00 00 	movabs $0x800e75,%rax
+  801144:	00 00 00 
+  801147:	ff d0                	call   *%rax
+  801149:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80114c:	48 39 c3             	cmp    %rax,%rbx
+  80114f:	74 36                	je     801187 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801151:	48 89 d8             	mov    %rbx,%rax
+  801154:	4c 29 e8             	sub    %r13,%rax
+  801157:	49 39 c4             	cmp    %rax,%r12
+  80115a:	73 31                	jae    80118d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80115c:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801161:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801165:	4c 89 fe             	mov    %r15,%rsi
+  801168:	48 b8 f9 10 80 00 00 	movabs $0x8010f9,%rax
+  80116f:	00 00 00 
+  801172:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801174:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801178:	48 83 c4 08          	add    $0x8,%rsp
+  80117c:	5b                   	pop    %rbx
+  80117d:	41 5c                	pop    %r12
+  80117f:	41 5d                	pop    %r13
+  801181:	41 5e                	pop    %r14
+  801183:	41 5f                	pop    %r15
+  801185:	5d                   	pop    %rbp
+  801186:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801187:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80118b:	eb eb                	jmp    801178 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80118d:	48 83 eb 01          	sub    $0x1,%rbx
+  801191:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801195:	48 89 da             	mov    %rbx,%rdx
+  801198:	4c 89 fe             	mov    %r15,%rsi
+  80119b:	48 b8 f9 10 80 00 00 	movabs $0x8010f9,%rax
+  8011a2:	00 00 00 
+  8011a5:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011a7:	49 01 de             	add    %rbx,%r14
+  8011aa:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011af:	eb c3                	jmp    801174 <strlcat+0x69>
+
+00000000008011b1 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011b1:	48 85 d2             	test   %rdx,%rdx
+  8011b4:	74 2d                	je     8011e3 <memcmp+0x32>
+  8011b6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011bb:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011bf:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011c4:	44 38 c1             	cmp    %r8b,%cl
+  8011c7:	75 0f                	jne    8011d8 <memcmp+0x27>
+    while (n-- > 0) {
+  8011c9:	48 83 c0 01          	add    $0x1,%rax
+  8011cd:	48 39 c2             	cmp    %rax,%rdx
+  8011d0:	75 e9                	jne    8011bb <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d7:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011d8:	0f b6 c1             	movzbl %cl,%eax
+  8011db:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011df:	44 29 c0             	sub    %r8d,%eax
+  8011e2:	c3                   	ret
+    return 0;
+  8011e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011e8:	c3                   	ret
+
+00000000008011e9 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011e9:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011ed:	48 39 c7             	cmp    %rax,%rdi
+  8011f0:	73 0f                	jae    801201 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8011f2:	40 38 37             	cmp    %sil,(%rdi)
+  8011f5:	74 0e                	je     801205 <memfind+0x1c>
+    for (; src < end; src++) {
+  8011f7:	48 83 c7 01          	add    $0x1,%rdi
+  8011fb:	48 39 f8             	cmp    %rdi,%rax
+  8011fe:	75 f2                	jne    8011f2 <memfind+0x9>
+  801200:	c3                   	ret
+  801201:	48 89 f8             	mov    %rdi,%rax
+  801204:	c3                   	ret
+  801205:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801208:	c3                   	ret
+
+0000000000801209 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801209:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80120c:	0f b6 37             	movzbl (%rdi),%esi
+  80120f:	40 80 fe 20          	cmp    $0x20,%sil
+  801213:	74 06                	je     80121b <strtol+0x12>
+  801215:	40 80 fe 09          	cmp    $0x9,%sil
+  801219:	75 13                	jne    80122e <strtol+0x25>
+  80121b:	48 83 c7 01          	add    $0x1,%rdi
+  80121f:	0f b6 37             	movzbl (%rdi),%esi
+  801222:	40 80 fe 20          	cmp    $0x20,%sil
+  801226:	74 f3                	je     80121b <strtol+0x12>
+  801228:	40 80 fe 09          	cmp    $0x9,%sil
+  80122c:	74 ed                	je     80121b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80122e:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801231:	83 e0 fd             	and    $0xfffffffd,%eax
+  801234:	3c 01                	cmp    $0x1,%al
+  801236:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80123a:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801240:	75 0f                	jne    801251 <strtol+0x48>
+  801242:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801245:	74 14                	je     80125b <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801247:	85 d2                	test   %edx,%edx
+  801249:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80124e:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801251:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801256:	4c 63 ca             	movslq %edx,%r9
+  801259:	eb 36                	jmp    801291 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80125b:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80125f:	74 0f                	je     801270 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801261:	85 d2                	test   %edx,%edx
+  801263:	75 ec                	jne    801251 <strtol+0x48>
+        s++;
+  801265:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801269:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80126e:	eb e1                	jmp    801251 <strtol+0x48>
+        s += 2;
+  801270:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801274:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801279:	eb d6                	jmp    801251 <strtol+0x48>
+            dig -= '0';
+  80127b:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80127e:	44 0f b6 c1          	movzbl %cl,%r8d
+  801282:	41 39 d0             	cmp    %edx,%r8d
+  801285:	7d 21                	jge    8012a8 <strtol+0x9f>
+        val = val * base + dig;
+  801287:	49 0f af c1          	imul   %r9,%rax
+  80128b:	0f b6 c9             	movzbl %cl,%ecx
+  80128e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801291:	48 83 c7 01          	add    $0x1,%rdi
+  801295:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801299:	80 f9 39             	cmp    $0x39,%cl
+  80129c:	76 dd                	jbe    80127b <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80129e:	80 f9 7b             	cmp    $0x7b,%cl
+  8012a1:	77 05                	ja     8012a8 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012a3:	83 e9 57             	sub    $0x57,%ecx
+  8012a6:	eb d6                	jmp    80127e <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012a8:	4d 85 d2             	test   %r10,%r10
+  8012ab:	74 03                	je     8012b0 <strtol+0xa7>
+  8012ad:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012b0:	48 89 c2             	mov    %rax,%rdx
+  8012b3:	48 f7 da             	neg    %rdx
+  8012b6:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012ba:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012be:	c3                   	ret
+
+00000000008012bf <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8012bf:	55                   	push   %rbp
+  8012c0:	48 89 e5             	mov    %rsp,%rbp
+  8012c3:	53                   	push   %rbx
+  8012c4:	48 89 fa             	mov    %rdi,%rdx
+  8012c7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ca:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e4:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ea:	c9                   	leave
+  8012eb:	c3                   	ret
+
+00000000008012ec <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8012ec:	55                   	push   %rbp
+  8012ed:	48 89 e5             	mov    %rsp,%rbp
+  8012f0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f1:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801300:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801305:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80130a:	be 00 00 00 00       	mov    $0x0,%esi
+  80130f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801315:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801317:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131b:	c9                   	leave
+  80131c:	c3                   	ret
+
+000000000080131d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80131d:	55                   	push   %rbp
+  80131e:	48 89 e5             	mov    %rsp,%rbp
+  801321:	53                   	push   %rbx
+  801322:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801326:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801329:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80132e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801333:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801338:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133d:	be 00 00 00 00       	mov    $0x0,%esi
+  801342:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801348:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80134a:	48 85 c0             	test   %rax,%rax
+  80134d:	7f 06                	jg     801355 <sys_env_destroy+0x38>
+}
+  80134f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801353:	c9                   	leave
+  801354:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801355:	49 89 c0             	mov    %rax,%r8
+  801358:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80135d:	48 ba 70 35 80 00 00 	movabs $0x803570,%rdx
+  801364:	00 00 00 
+  801367:	be 26 00 00 00       	mov    $0x26,%esi
+  80136c:	48 bf 8f 35 80 00 00 	movabs $0x80358f,%rdi
+  801373:	00 00 00 
+  801376:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137b:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  801382:	00 00 00 
+  801385:	41 ff d1             	call   *%r9
+
+0000000000801388 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801388:	55                   	push   %rbp
+  801389:	48 89 e5             	mov    %rsp,%rbp
+  80138c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80138d:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801392:	ba 00 00 00 00       	mov    $0x0,%edx
+  801397:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80139c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b1:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b7:	c9                   	leave
+  8013b8:	c3                   	ret
+
+00000000008013b9 <sys_yield>:
+
+void
+sys_yield(void) {
+  8013b9:	55                   	push   %rbp
+  8013ba:	48 89 e5             	mov    %rsp,%rbp
+  8013bd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013be:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8013dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e2:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e8:	c9                   	leave
+  8013e9:	c3                   	ret
+
+00000000008013ea <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8013ea:	55                   	push   %rbp
+  8013eb:	48 89 e5             	mov    %rsp,%rbp
+  8013ee:	53                   	push   %rbx
+  8013ef:	48 89 fa             	mov    %rdi,%rdx
+  8013f2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013fa:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801401:	00 00 00 
+  801404:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801409:	be 00 00 00 00       	mov    $0x0,%esi
+  80140e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801414:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801416:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141a:	c9                   	leave
+  80141b:	c3                   	ret
+
+000000000080141c <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80141c:	55                   	push   %rbp
+  80141d:	48 89 e5             	mov    %rsp,%rbp
+  801420:	53                   	push   %rbx
+  801421:	49 89 f8             	mov    %rdi,%r8
+  801424:	48 89 d3             	mov    %rdx,%rbx
+  801427:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80142a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80142f:	4c 89 c2             	mov    %r8,%rdx
+  801432:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801435:	be 00 00 00 00       	mov    $0x0,%esi
+  80143a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801440:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801442:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801446:	c9                   	leave
+  801447:	c3                   	ret
+
+0000000000801448 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801448:	55                   	push   %rbp
+  801449:	48 89 e5             	mov    %rsp,%rbp
+  80144c:	53                   	push   %rbx
+  80144d:	48 83 ec 08          	sub    $0x8,%rsp
+  801451:	89 f8                	mov    %edi,%eax
+  801453:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801456:	48 63 f9             	movslq %ecx,%rdi
+  801459:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80145c:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801461:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801464:	be 00 00 00 00       	mov    $0x0,%esi
+  801469:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80146f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801471:	48 85 c0             	test   %rax,%rax
+  801474:	7f 06                	jg     80147c <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801476:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147a:	c9                   	leave
+  80147b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80147c:	49 89 c0             	mov    %rax,%r8
+  80147f:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801484:	48 ba 70 35 80 00 00 	movabs $0x803570,%rdx
+  80148b:	00 00 00 
+  80148e:	be 26 00 00 00       	mov    $0x26,%esi
+  801493:	48 bf 8f 35 80 00 00 	movabs $0x80358f,%rdi
+  80149a:	00 00 00 
+  80149d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a2:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  8014a9:	00 00 00 
+  8014ac:	41 ff d1             	call   *%r9
+
+00000000008014af <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014af:	55                   	push   %rbp
+  8014b0:	48 89 e5             	mov    %rsp,%rbp
+  8014b3:	53                   	push   %rbx
+  8014b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8014b8:	89 f8                	mov    %edi,%eax
+  8014ba:	49 89 f2             	mov    %rsi,%r10
+  8014bd:	48 89 cf             	mov    %rcx,%rdi
+  8014c0:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8014c3:	48 63 da             	movslq %edx,%rbx
+  8014c6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c9:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ce:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d1:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8014d4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d6:	48 85 c0             	test   %rax,%rax
+  8014d9:	7f 06                	jg     8014e1 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014df:	c9                   	leave
+  8014e0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e1:	49 89 c0             	mov    %rax,%r8
+  8014e4:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014e9:	48 ba 70 35 80 00 00 	movabs $0x803570,%rdx
+  8014f0:	00 00 00 
+  8014f3:	be 26 00 00 00       	mov    $0x26,%esi
+  8014f8:	48 bf 8f 35 80 00 00 	movabs $0x80358f,%rdi
+  8014ff:	00 00 00 
+  801502:	b8 00 00 00 00       	mov    $0x0,%eax
+  801507:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  80150e:	00 00 00 
+  801511:	41 ff d1             	call   *%r9
+
+0000000000801514 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801514:	55                   	push   %rbp
+  801515:	48 89 e5             	mov    %rsp,%rbp
+  801518:	53                   	push   %rbx
+  801519:	48 83 ec 08          	sub    $0x8,%rsp
+  80151d:	48 89 f1             	mov    %rsi,%rcx
+  801520:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801523:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801526:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80152b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801530:	be 00 00 00 00       	mov    $0x0,%esi
+  801535:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80153d:	48 85 c0             	test   %rax,%rax
+  801540:	7f 06                	jg     801548 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801542:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801546:	c9                   	leave
+  801547:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801548:	49 89 c0             	mov    %rax,%r8
+  80154b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801550:	48 ba 70 35 80 00 00 	movabs $0x803570,%rdx
+  801557:	00 00 00 
+  80155a:	be 26 00 00 00       	mov    $0x26,%esi
+  80155f:	48 bf 8f 35 80 00 00 	movabs $0x80358f,%rdi
+  801566:	00 00 00 
+  801569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156e:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  801575:	00 00 00 
+  801578:	41 ff d1             	call   *%r9
+
+000000000080157b <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  80157b:	55                   	push   %rbp
+  80157c:	48 89 e5             	mov    %rsp,%rbp
+  80157f:	53                   	push   %rbx
+  801580:	48 83 ec 08          	sub    $0x8,%rsp
+  801584:	89 f8                	mov    %edi,%eax
+  801586:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801589:	48 63 f9             	movslq %ecx,%rdi
+  80158c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80158f:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801594:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801597:	be 00 00 00 00       	mov    $0x0,%esi
+  80159c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a4:	48 85 c0             	test   %rax,%rax
+  8015a7:	7f 06                	jg     8015af <sys_region_advise+0x34>
+}
+  8015a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ad:	c9                   	leave
+  8015ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015af:	49 89 c0             	mov    %rax,%r8
+  8015b2:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8015b7:	48 ba 70 35 80 00 00 	movabs $0x803570,%rdx
+  8015be:	00 00 00 
+  8015c1:	be 26 00 00 00       	mov    $0x26,%esi
+  8015c6:	48 bf 8f 35 80 00 00 	movabs $0x80358f,%rdi
+  8015cd:	00 00 00 
+  8015d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d5:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  8015dc:	00 00 00 
+  8015df:	41 ff d1             	call   *%r9
+
+00000000008015e2 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  8015e2:	55                   	push   %rbp
+  8015e3:	48 89 e5             	mov    %rsp,%rbp
+  8015e6:	53                   	push   %rbx
+  8015e7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  8015eb:	48 63 ce             	movslq %esi,%rcx
+  8015ee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f1:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801600:	be 00 00 00 00       	mov    $0x0,%esi
+  801605:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80160d:	48 85 c0             	test   %rax,%rax
+  801610:	7f 06                	jg     801618 <sys_env_set_nice+0x36>
+}
+  801612:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801616:	c9                   	leave
+  801617:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801618:	49 89 c0             	mov    %rax,%r8
+  80161b:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801620:	48 ba 70 35 80 00 00 	movabs $0x803570,%rdx
+  801627:	00 00 00 
+  80162a:	be 26 00 00 00       	mov    $0x26,%esi
+  80162f:	48 bf 8f 35 80 00 00 	movabs $0x80358f,%rdi
+  801636:	00 00 00 
+  801639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163e:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  801645:	00 00 00 
+  801648:	41 ff d1             	call   *%r9
+
+000000000080164b <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80164b:	55                   	push   %rbp
+  80164c:	48 89 e5             	mov    %rsp,%rbp
+  80164f:	53                   	push   %rbx
+  801650:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801654:	48 63 ce             	movslq %esi,%rcx
+  801657:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80165a:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80165f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801664:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801669:	be 00 00 00 00       	mov    $0x0,%esi
+  80166e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801674:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801676:	48 85 c0             	test   %rax,%rax
+  801679:	7f 06                	jg     801681 <sys_env_set_status+0x36>
+}
+  80167b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167f:	c9                   	leave
+  801680:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801681:	49 89 c0             	mov    %rax,%r8
+  801684:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801689:	48 ba 70 35 80 00 00 	movabs $0x803570,%rdx
+  801690:	00 00 00 
+  801693:	be 26 00 00 00       	mov    $0x26,%esi
+  801698:	48 bf 8f 35 80 00 00 	movabs $0x80358f,%rdi
+  80169f:	00 00 00 
+  8016a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a7:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  8016ae:	00 00 00 
+  8016b1:	41 ff d1             	call   *%r9
+
+00000000008016b4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016b4:	55                   	push   %rbp
+  8016b5:	48 89 e5             	mov    %rsp,%rbp
+  8016b8:	53                   	push   %rbx
+  8016b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8016bd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016c0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c3:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016df:	48 85 c0             	test   %rax,%rax
+  8016e2:	7f 06                	jg     8016ea <sys_env_set_trapframe+0x36>
+}
+  8016e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e8:	c9                   	leave
+  8016e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ea:	49 89 c0             	mov    %rax,%r8
+  8016ed:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8016f2:	48 ba 70 35 80 00 00 	movabs $0x803570,%rdx
+  8016f9:	00 00 00 
+  8016fc:	be 26 00 00 00       	mov    $0x26,%esi
+  801701:	48 bf 8f 35 80 00 00 	movabs $0x80358f,%rdi
+  801708:	00 00 00 
+  80170b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801710:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  801717:	00 00 00 
+  80171a:	41 ff d1             	call   *%r9
+
+000000000080171d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80171d:	55                   	push   %rbp
+  80171e:	48 89 e5             	mov    %rsp,%rbp
+  801721:	53                   	push   %rbx
+  801722:	48 83 ec 08          	sub    $0x8,%rsp
+  801726:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801729:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80172c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801731:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801736:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80173b:	be 00 00 00 00       	mov    $0x0,%esi
+  801740:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801746:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801748:	48 85 c0             	test   %rax,%rax
+  80174b:	7f 06                	jg     801753 <sys_env_set_pgfault_upcall+0x36>
+}
+  80174d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801751:	c9                   	leave
+  801752:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801753:	49 89 c0             	mov    %rax,%r8
+  801756:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80175b:	48 ba 70 35 80 00 00 	movabs $0x803570,%rdx
+  801762:	00 00 00 
+  801765:	be 26 00 00 00       	mov    $0x26,%esi
+  80176a:	48 bf 8f 35 80 00 00 	movabs $0x80358f,%rdi
+  801771:	00 00 00 
+  801774:	b8 00 00 00 00       	mov    $0x0,%eax
+  801779:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  801780:	00 00 00 
+  801783:	41 ff d1             	call   *%r9
+
+0000000000801786 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801786:	55                   	push   %rbp
+  801787:	48 89 e5             	mov    %rsp,%rbp
+  80178a:	53                   	push   %rbx
+  80178b:	89 f8                	mov    %edi,%eax
+  80178d:	49 89 f1             	mov    %rsi,%r9
+  801790:	48 89 d3             	mov    %rdx,%rbx
+  801793:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801796:	49 63 f0             	movslq %r8d,%rsi
+  801799:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80179c:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017a1:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017aa:	cd 30                	int    $0x30
+}
+  8017ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b0:	c9                   	leave
+  8017b1:	c3                   	ret
+
+00000000008017b2 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8017b2:	55                   	push   %rbp
+  8017b3:	48 89 e5             	mov    %rsp,%rbp
+  8017b6:	53                   	push   %rbx
+  8017b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8017bb:	48 89 fa             	mov    %rdi,%rdx
+  8017be:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017c1:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017cb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017db:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017dd:	48 85 c0             	test   %rax,%rax
+  8017e0:	7f 06                	jg     8017e8 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e6:	c9                   	leave
+  8017e7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017e8:	49 89 c0             	mov    %rax,%r8
+  8017eb:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8017f0:	48 ba 70 35 80 00 00 	movabs $0x803570,%rdx
+  8017f7:	00 00 00 
+  8017fa:	be 26 00 00 00       	mov    $0x26,%esi
+  8017ff:	48 bf 8f 35 80 00 00 	movabs $0x80358f,%rdi
+  801806:	00 00 00 
+  801809:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180e:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  801815:	00 00 00 
+  801818:	41 ff d1             	call   *%r9
+
+000000000080181b <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80181b:	55                   	push   %rbp
+  80181c:	48 89 e5             	mov    %rsp,%rbp
+  80181f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801820:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801825:	ba 00 00 00 00       	mov    $0x0,%edx
+  80182a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80182f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801834:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801839:	be 00 00 00 00       	mov    $0x0,%esi
+  80183e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801844:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801846:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80184a:	c9                   	leave
+  80184b:	c3                   	ret
+
+000000000080184c <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80184c:	55                   	push   %rbp
+  80184d:	48 89 e5             	mov    %rsp,%rbp
+  801850:	53                   	push   %rbx
+  801851:	48 83 ec 08          	sub    $0x8,%rsp
+  801855:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801858:	48 63 ce             	movslq %esi,%rcx
+  80185b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80185e:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801863:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801868:	be 00 00 00 00       	mov    $0x0,%esi
+  80186d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801873:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801875:	48 85 c0             	test   %rax,%rax
+  801878:	7f 06                	jg     801880 <sys_sigqueue+0x34>
+}
+  80187a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80187e:	c9                   	leave
+  80187f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801880:	49 89 c0             	mov    %rax,%r8
+  801883:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801888:	48 ba 70 35 80 00 00 	movabs $0x803570,%rdx
+  80188f:	00 00 00 
+  801892:	be 26 00 00 00       	mov    $0x26,%esi
+  801897:	48 bf 8f 35 80 00 00 	movabs $0x80358f,%rdi
+  80189e:	00 00 00 
+  8018a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a6:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  8018ad:	00 00 00 
+  8018b0:	41 ff d1             	call   *%r9
+
+00000000008018b3 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8018b3:	55                   	push   %rbp
+  8018b4:	48 89 e5             	mov    %rsp,%rbp
+  8018b7:	53                   	push   %rbx
+  8018b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8018bc:	48 89 fa             	mov    %rdi,%rdx
+  8018bf:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018c2:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8018d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018de:	48 85 c0             	test   %rax,%rax
+  8018e1:	7f 06                	jg     8018e9 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  8018e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018e7:	c9                   	leave
+  8018e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018e9:	49 89 c0             	mov    %rax,%r8
+  8018ec:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8018f1:	48 ba 70 35 80 00 00 	movabs $0x803570,%rdx
+  8018f8:	00 00 00 
+  8018fb:	be 26 00 00 00       	mov    $0x26,%esi
+  801900:	48 bf 8f 35 80 00 00 	movabs $0x80358f,%rdi
+  801907:	00 00 00 
+  80190a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190f:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  801916:	00 00 00 
+  801919:	41 ff d1             	call   *%r9
+
+000000000080191c <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80191c:	55                   	push   %rbp
+  80191d:	48 89 e5             	mov    %rsp,%rbp
+  801920:	53                   	push   %rbx
+  801921:	48 83 ec 08          	sub    $0x8,%rsp
+  801925:	48 89 f1             	mov    %rsi,%rcx
+  801928:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80192b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80192e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801933:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801938:	be 00 00 00 00       	mov    $0x0,%esi
+  80193d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801943:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801945:	48 85 c0             	test   %rax,%rax
+  801948:	7f 06                	jg     801950 <sys_sigaction+0x34>
+}
+  80194a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80194e:	c9                   	leave
+  80194f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801950:	49 89 c0             	mov    %rax,%r8
+  801953:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801958:	48 ba 70 35 80 00 00 	movabs $0x803570,%rdx
+  80195f:	00 00 00 
+  801962:	be 26 00 00 00       	mov    $0x26,%esi
+  801967:	48 bf 8f 35 80 00 00 	movabs $0x80358f,%rdi
+  80196e:	00 00 00 
+  801971:	b8 00 00 00 00       	mov    $0x0,%eax
+  801976:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  80197d:	00 00 00 
+  801980:	41 ff d1             	call   *%r9
+
+0000000000801983 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801983:	55                   	push   %rbp
+  801984:	48 89 e5             	mov    %rsp,%rbp
+  801987:	53                   	push   %rbx
+  801988:	48 83 ec 08          	sub    $0x8,%rsp
+  80198c:	48 89 f1             	mov    %rsi,%rcx
+  80198f:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801992:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801995:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80199a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80199f:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019aa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019ac:	48 85 c0             	test   %rax,%rax
+  8019af:	7f 06                	jg     8019b7 <sys_sigprocmask+0x34>
+}
+  8019b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019b5:	c9                   	leave
+  8019b6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019b7:	49 89 c0             	mov    %rax,%r8
+  8019ba:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8019bf:	48 ba 70 35 80 00 00 	movabs $0x803570,%rdx
+  8019c6:	00 00 00 
+  8019c9:	be 26 00 00 00       	mov    $0x26,%esi
+  8019ce:	48 bf 8f 35 80 00 00 	movabs $0x80358f,%rdi
+  8019d5:	00 00 00 
+  8019d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019dd:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  8019e4:	00 00 00 
+  8019e7:	41 ff d1             	call   *%r9
+
+00000000008019ea <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8019ea:	55                   	push   %rbp
+  8019eb:	48 89 e5             	mov    %rsp,%rbp
+  8019ee:	41 54                	push   %r12
+  8019f0:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8019f1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8019f6:	cd 30                	int    $0x30
+  8019f8:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  8019fb:	85 c0                	test   %eax,%eax
+  8019fd:	78 76                	js     801a75 <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  8019ff:	74 7c                	je     801a7d <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  801a01:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801a07:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801a0e:	00 00 00 
+  801a11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a16:	89 c2                	mov    %eax,%edx
+  801a18:	be 00 00 00 00       	mov    $0x0,%esi
+  801a1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a22:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  801a29:	00 00 00 
+  801a2c:	ff d0                	call   *%rax
+  801a2e:	85 c0                	test   %eax,%eax
+  801a30:	75 7a                	jne    801aac <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  801a32:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a39:	00 00 00 
+  801a3c:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801a43:	44 89 e7             	mov    %r12d,%edi
+  801a46:	48 b8 1d 17 80 00 00 	movabs $0x80171d,%rax
+  801a4d:	00 00 00 
+  801a50:	ff d0                	call   *%rax
+  801a52:	85 c0                	test   %eax,%eax
+  801a54:	75 5e                	jne    801ab4 <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  801a56:	be 02 00 00 00       	mov    $0x2,%esi
+  801a5b:	44 89 e7             	mov    %r12d,%edi
+  801a5e:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  801a65:	00 00 00 
+  801a68:	ff d0                	call   *%rax
+        return -1;
+  801a6a:	85 c0                	test   %eax,%eax
+  801a6c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801a71:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  801a75:	44 89 e0             	mov    %r12d,%eax
+  801a78:	5b                   	pop    %rbx
+  801a79:	41 5c                	pop    %r12
+  801a7b:	5d                   	pop    %rbp
+  801a7c:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  801a7d:	48 b8 88 13 80 00 00 	movabs $0x801388,%rax
+  801a84:	00 00 00 
+  801a87:	ff d0                	call   *%rax
+  801a89:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  801a8c:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  801a93:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801a9a:	00 00 00 
+  801a9d:	48 01 d0             	add    %rdx,%rax
+  801aa0:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  801aa7:	00 00 00 
+        return 0;
+  801aaa:	eb c9                	jmp    801a75 <fork+0x8b>
+        return -1;
+  801aac:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801ab2:	eb c1                	jmp    801a75 <fork+0x8b>
+        return -1;
+  801ab4:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801aba:	eb b9                	jmp    801a75 <fork+0x8b>
+
+0000000000801abc <sfork>:
+
+envid_t
+sfork() {
+  801abc:	55                   	push   %rbp
+  801abd:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801ac0:	48 ba 9d 35 80 00 00 	movabs $0x80359d,%rdx
+  801ac7:	00 00 00 
+  801aca:	be 2e 00 00 00       	mov    $0x2e,%esi
+  801acf:	48 bf b8 35 80 00 00 	movabs $0x8035b8,%rdi
+  801ad6:	00 00 00 
+  801ad9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ade:	48 b9 23 04 80 00 00 	movabs $0x800423,%rcx
+  801ae5:	00 00 00 
+  801ae8:	ff d1                	call   *%rcx
+
+0000000000801aea <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801aea:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801af1:	ff ff ff 
+  801af4:	48 01 f8             	add    %rdi,%rax
+  801af7:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801afb:	c3                   	ret
+
+0000000000801afc <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801afc:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b03:	ff ff ff 
+  801b06:	48 01 f8             	add    %rdi,%rax
+  801b09:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801b0d:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801b13:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801b17:	c3                   	ret
+
+0000000000801b18 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801b18:	55                   	push   %rbp
+  801b19:	48 89 e5             	mov    %rsp,%rbp
+  801b1c:	41 57                	push   %r15
+  801b1e:	41 56                	push   %r14
+  801b20:	41 55                	push   %r13
+  801b22:	41 54                	push   %r12
+  801b24:	53                   	push   %rbx
+  801b25:	48 83 ec 08          	sub    $0x8,%rsp
+  801b29:	49 89 ff             	mov    %rdi,%r15
+  801b2c:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801b31:	49 bd 96 2a 80 00 00 	movabs $0x802a96,%r13
+  801b38:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801b3b:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801b41:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801b44:	48 89 df             	mov    %rbx,%rdi
+  801b47:	41 ff d5             	call   *%r13
+  801b4a:	83 e0 04             	and    $0x4,%eax
+  801b4d:	74 17                	je     801b66 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801b4f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b56:	4c 39 f3             	cmp    %r14,%rbx
+  801b59:	75 e6                	jne    801b41 <fd_alloc+0x29>
+  801b5b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801b61:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801b66:	4d 89 27             	mov    %r12,(%r15)
+}
+  801b69:	48 83 c4 08          	add    $0x8,%rsp
+  801b6d:	5b                   	pop    %rbx
+  801b6e:	41 5c                	pop    %r12
+  801b70:	41 5d                	pop    %r13
+  801b72:	41 5e                	pop    %r14
+  801b74:	41 5f                	pop    %r15
+  801b76:	5d                   	pop    %rbp
+  801b77:	c3                   	ret
+
+0000000000801b78 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801b78:	83 ff 1f             	cmp    $0x1f,%edi
+  801b7b:	77 39                	ja     801bb6 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801b7d:	55                   	push   %rbp
+  801b7e:	48 89 e5             	mov    %rsp,%rbp
+  801b81:	41 54                	push   %r12
+  801b83:	53                   	push   %rbx
+  801b84:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801b87:	48 63 df             	movslq %edi,%rbx
+  801b8a:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801b91:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801b95:	48 89 df             	mov    %rbx,%rdi
+  801b98:	48 b8 96 2a 80 00 00 	movabs $0x802a96,%rax
+  801b9f:	00 00 00 
+  801ba2:	ff d0                	call   *%rax
+  801ba4:	a8 04                	test   $0x4,%al
+  801ba6:	74 14                	je     801bbc <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801ba8:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801bac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bb1:	5b                   	pop    %rbx
+  801bb2:	41 5c                	pop    %r12
+  801bb4:	5d                   	pop    %rbp
+  801bb5:	c3                   	ret
+        return -E_INVAL;
+  801bb6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801bbb:	c3                   	ret
+        return -E_INVAL;
+  801bbc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bc1:	eb ee                	jmp    801bb1 <fd_lookup+0x39>
+
+0000000000801bc3 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801bc3:	55                   	push   %rbp
+  801bc4:	48 89 e5             	mov    %rsp,%rbp
+  801bc7:	41 54                	push   %r12
+  801bc9:	53                   	push   %rbx
+  801bca:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801bcd:	48 b8 60 36 80 00 00 	movabs $0x803660,%rax
+  801bd4:	00 00 00 
+  801bd7:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801bde:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801be1:	39 3b                	cmp    %edi,(%rbx)
+  801be3:	74 47                	je     801c2c <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801be5:	48 83 c0 08          	add    $0x8,%rax
+  801be9:	48 8b 18             	mov    (%rax),%rbx
+  801bec:	48 85 db             	test   %rbx,%rbx
+  801bef:	75 f0                	jne    801be1 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801bf1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801bf8:	00 00 00 
+  801bfb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c01:	89 fa                	mov    %edi,%edx
+  801c03:	48 bf c8 35 80 00 00 	movabs $0x8035c8,%rdi
+  801c0a:	00 00 00 
+  801c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c12:	48 b9 73 05 80 00 00 	movabs $0x800573,%rcx
+  801c19:	00 00 00 
+  801c1c:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801c1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801c23:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801c27:	5b                   	pop    %rbx
+  801c28:	41 5c                	pop    %r12
+  801c2a:	5d                   	pop    %rbp
+  801c2b:	c3                   	ret
+            return 0;
+  801c2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c31:	eb f0                	jmp    801c23 <dev_lookup+0x60>
+
+0000000000801c33 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801c33:	55                   	push   %rbp
+  801c34:	48 89 e5             	mov    %rsp,%rbp
+  801c37:	41 55                	push   %r13
+  801c39:	41 54                	push   %r12
+  801c3b:	53                   	push   %rbx
+  801c3c:	48 83 ec 18          	sub    $0x18,%rsp
+  801c40:	48 89 fb             	mov    %rdi,%rbx
+  801c43:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c46:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801c4d:	ff ff ff 
+  801c50:	48 01 df             	add    %rbx,%rdi
+  801c53:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801c57:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c5b:	48 b8 78 1b 80 00 00 	movabs $0x801b78,%rax
+  801c62:	00 00 00 
+  801c65:	ff d0                	call   *%rax
+  801c67:	41 89 c5             	mov    %eax,%r13d
+  801c6a:	85 c0                	test   %eax,%eax
+  801c6c:	78 06                	js     801c74 <fd_close+0x41>
+  801c6e:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801c72:	74 1a                	je     801c8e <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801c74:	45 84 e4             	test   %r12b,%r12b
+  801c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801c80:	44 89 e8             	mov    %r13d,%eax
+  801c83:	48 83 c4 18          	add    $0x18,%rsp
+  801c87:	5b                   	pop    %rbx
+  801c88:	41 5c                	pop    %r12
+  801c8a:	41 5d                	pop    %r13
+  801c8c:	5d                   	pop    %rbp
+  801c8d:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c8e:	8b 3b                	mov    (%rbx),%edi
+  801c90:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c94:	48 b8 c3 1b 80 00 00 	movabs $0x801bc3,%rax
+  801c9b:	00 00 00 
+  801c9e:	ff d0                	call   *%rax
+  801ca0:	41 89 c5             	mov    %eax,%r13d
+  801ca3:	85 c0                	test   %eax,%eax
+  801ca5:	78 1b                	js     801cc2 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801ca7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cab:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801caf:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801cb5:	48 85 c0             	test   %rax,%rax
+  801cb8:	74 08                	je     801cc2 <fd_close+0x8f>
+  801cba:	48 89 df             	mov    %rbx,%rdi
+  801cbd:	ff d0                	call   *%rax
+  801cbf:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801cc2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cc7:	48 89 de             	mov    %rbx,%rsi
+  801cca:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ccf:	48 b8 14 15 80 00 00 	movabs $0x801514,%rax
+  801cd6:	00 00 00 
+  801cd9:	ff d0                	call   *%rax
+    return res;
+  801cdb:	eb a3                	jmp    801c80 <fd_close+0x4d>
+
+0000000000801cdd <close>:
+
+int
+close(int fdnum) {
+  801cdd:	55                   	push   %rbp
+  801cde:	48 89 e5             	mov    %rsp,%rbp
+  801ce1:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801ce5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ce9:	48 b8 78 1b 80 00 00 	movabs $0x801b78,%rax
+  801cf0:	00 00 00 
+  801cf3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801cf5:	85 c0                	test   %eax,%eax
+  801cf7:	78 15                	js     801d0e <close+0x31>
+
+    return fd_close(fd, 1);
+  801cf9:	be 01 00 00 00       	mov    $0x1,%esi
+  801cfe:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801d02:	48 b8 33 1c 80 00 00 	movabs $0x801c33,%rax
+  801d09:	00 00 00 
+  801d0c:	ff d0                	call   *%rax
+}
+  801d0e:	c9                   	leave
+  801d0f:	c3                   	ret
+
+0000000000801d10 <close_all>:
+
+void
+close_all(void) {
+  801d10:	55                   	push   %rbp
+  801d11:	48 89 e5             	mov    %rsp,%rbp
+  801d14:	41 54                	push   %r12
+  801d16:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801d17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d1c:	49 bc dd 1c 80 00 00 	movabs $0x801cdd,%r12
+  801d23:	00 00 00 
+  801d26:	89 df                	mov    %ebx,%edi
+  801d28:	41 ff d4             	call   *%r12
+  801d2b:	83 c3 01             	add    $0x1,%ebx
+  801d2e:	83 fb 20             	cmp    $0x20,%ebx
+  801d31:	75 f3                	jne    801d26 <close_all+0x16>
+}
+  801d33:	5b                   	pop    %rbx
+  801d34:	41 5c                	pop    %r12
+  801d36:	5d                   	pop    %rbp
+  801d37:	c3                   	ret
+
+0000000000801d38 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801d38:	55                   	push   %rbp
+  801d39:	48 89 e5             	mov    %rsp,%rbp
+  801d3c:	41 57                	push   %r15
+  801d3e:	41 56                	push   %r14
+  801d40:	41 55                	push   %r13
+  801d42:	41 54                	push   %r12
+  801d44:	53                   	push   %rbx
+  801d45:	48 83 ec 18          	sub    $0x18,%rsp
+  801d49:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801d4c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801d50:	48 b8 78 1b 80 00 00 	movabs $0x801b78,%rax
+  801d57:	00 00 00 
+  801d5a:	ff d0                	call   *%rax
+  801d5c:	89 c3                	mov    %eax,%ebx
+  801d5e:	85 c0                	test   %eax,%eax
+  801d60:	0f 88 b8 00 00 00    	js     801e1e <dup+0xe6>
+    close(newfdnum);
+  801d66:	44 89 e7             	mov    %r12d,%edi
+  801d69:	48 b8 dd 1c 80 00 00 	movabs $0x801cdd,%rax
+  801d70:	00 00 00 
+  801d73:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801d75:	4d 63 ec             	movslq %r12d,%r13
+  801d78:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801d7f:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801d83:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801d87:	4c 89 ff             	mov    %r15,%rdi
+  801d8a:	49 be fc 1a 80 00 00 	movabs $0x801afc,%r14
+  801d91:	00 00 00 
+  801d94:	41 ff d6             	call   *%r14
+  801d97:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801d9a:	4c 89 ef             	mov    %r13,%rdi
+  801d9d:	41 ff d6             	call   *%r14
+  801da0:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801da3:	48 89 df             	mov    %rbx,%rdi
+  801da6:	48 b8 96 2a 80 00 00 	movabs $0x802a96,%rax
+  801dad:	00 00 00 
+  801db0:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801db2:	a8 04                	test   $0x4,%al
+  801db4:	74 2b                	je     801de1 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801db6:	41 89 c1             	mov    %eax,%r9d
+  801db9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801dbf:	4c 89 f1             	mov    %r14,%rcx
+  801dc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dc7:	48 89 de             	mov    %rbx,%rsi
+  801dca:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dcf:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  801dd6:	00 00 00 
+  801dd9:	ff d0                	call   *%rax
+  801ddb:	89 c3                	mov    %eax,%ebx
+  801ddd:	85 c0                	test   %eax,%eax
+  801ddf:	78 4e                	js     801e2f <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801de1:	4c 89 ff             	mov    %r15,%rdi
+  801de4:	48 b8 96 2a 80 00 00 	movabs $0x802a96,%rax
+  801deb:	00 00 00 
+  801dee:	ff d0                	call   *%rax
+  801df0:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801df3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801df9:	4c 89 e9             	mov    %r13,%rcx
+  801dfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e01:	4c 89 fe             	mov    %r15,%rsi
+  801e04:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e09:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  801e10:	00 00 00 
+  801e13:	ff d0                	call   *%rax
+  801e15:	89 c3                	mov    %eax,%ebx
+  801e17:	85 c0                	test   %eax,%eax
+  801e19:	78 14                	js     801e2f <dup+0xf7>
+
+    return newfdnum;
+  801e1b:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801e1e:	89 d8                	mov    %ebx,%eax
+  801e20:	48 83 c4 18          	add    $0x18,%rsp
+  801e24:	5b                   	pop    %rbx
+  801e25:	41 5c                	pop    %r12
+  801e27:	41 5d                	pop    %r13
+  801e29:	41 5e                	pop    %r14
+  801e2b:	41 5f                	pop    %r15
+  801e2d:	5d                   	pop    %rbp
+  801e2e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801e2f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e34:	4c 89 ee             	mov    %r13,%rsi
+  801e37:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e3c:	49 bc 14 15 80 00 00 	movabs $0x801514,%r12
+  801e43:	00 00 00 
+  801e46:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801e49:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e4e:	4c 89 f6             	mov    %r14,%rsi
+  801e51:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e56:	41 ff d4             	call   *%r12
+    return res;
+  801e59:	eb c3                	jmp    801e1e <dup+0xe6>
+
+0000000000801e5b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801e5b:	55                   	push   %rbp
+  801e5c:	48 89 e5             	mov    %rsp,%rbp
+  801e5f:	41 56                	push   %r14
+  801e61:	41 55                	push   %r13
+  801e63:	41 54                	push   %r12
+  801e65:	53                   	push   %rbx
+  801e66:	48 83 ec 10          	sub    $0x10,%rsp
+  801e6a:	89 fb                	mov    %edi,%ebx
+  801e6c:	49 89 f4             	mov    %rsi,%r12
+  801e6f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e72:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e76:	48 b8 78 1b 80 00 00 	movabs $0x801b78,%rax
+  801e7d:	00 00 00 
+  801e80:	ff d0                	call   *%rax
+  801e82:	85 c0                	test   %eax,%eax
+  801e84:	78 4c                	js     801ed2 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e86:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e8a:	41 8b 3e             	mov    (%r14),%edi
+  801e8d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e91:	48 b8 c3 1b 80 00 00 	movabs $0x801bc3,%rax
+  801e98:	00 00 00 
+  801e9b:	ff d0                	call   *%rax
+  801e9d:	85 c0                	test   %eax,%eax
+  801e9f:	78 35                	js     801ed6 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ea1:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ea5:	83 e0 03             	and    $0x3,%eax
+  801ea8:	83 f8 01             	cmp    $0x1,%eax
+  801eab:	74 2d                	je     801eda <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ead:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801eb1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801eb5:	48 85 c0             	test   %rax,%rax
+  801eb8:	74 56                	je     801f10 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801eba:	4c 89 ea             	mov    %r13,%rdx
+  801ebd:	4c 89 e6             	mov    %r12,%rsi
+  801ec0:	4c 89 f7             	mov    %r14,%rdi
+  801ec3:	ff d0                	call   *%rax
+}
+  801ec5:	48 83 c4 10          	add    $0x10,%rsp
+  801ec9:	5b                   	pop    %rbx
+  801eca:	41 5c                	pop    %r12
+  801ecc:	41 5d                	pop    %r13
+  801ece:	41 5e                	pop    %r14
+  801ed0:	5d                   	pop    %rbp
+  801ed1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ed2:	48 98                	cltq
+  801ed4:	eb ef                	jmp    801ec5 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ed6:	48 98                	cltq
+  801ed8:	eb eb                	jmp    801ec5 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801eda:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ee1:	00 00 00 
+  801ee4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801eea:	89 da                	mov    %ebx,%edx
+  801eec:	48 bf 09 36 80 00 00 	movabs $0x803609,%rdi
+  801ef3:	00 00 00 
+  801ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801efb:	48 b9 73 05 80 00 00 	movabs $0x800573,%rcx
+  801f02:	00 00 00 
+  801f05:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f07:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f0e:	eb b5                	jmp    801ec5 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f10:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f17:	eb ac                	jmp    801ec5 <read+0x6a>
+
+0000000000801f19 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801f19:	55                   	push   %rbp
+  801f1a:	48 89 e5             	mov    %rsp,%rbp
+  801f1d:	41 57                	push   %r15
+  801f1f:	41 56                	push   %r14
+  801f21:	41 55                	push   %r13
+  801f23:	41 54                	push   %r12
+  801f25:	53                   	push   %rbx
+  801f26:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801f2a:	48 85 d2             	test   %rdx,%rdx
+  801f2d:	74 54                	je     801f83 <readn+0x6a>
+  801f2f:	41 89 fd             	mov    %edi,%r13d
+  801f32:	49 89 f6             	mov    %rsi,%r14
+  801f35:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801f38:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801f3d:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801f42:	49 bf 5b 1e 80 00 00 	movabs $0x801e5b,%r15
+  801f49:	00 00 00 
+  801f4c:	4c 89 e2             	mov    %r12,%rdx
+  801f4f:	48 29 f2             	sub    %rsi,%rdx
+  801f52:	4c 01 f6             	add    %r14,%rsi
+  801f55:	44 89 ef             	mov    %r13d,%edi
+  801f58:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801f5b:	85 c0                	test   %eax,%eax
+  801f5d:	78 20                	js     801f7f <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801f5f:	01 c3                	add    %eax,%ebx
+  801f61:	85 c0                	test   %eax,%eax
+  801f63:	74 08                	je     801f6d <readn+0x54>
+  801f65:	48 63 f3             	movslq %ebx,%rsi
+  801f68:	4c 39 e6             	cmp    %r12,%rsi
+  801f6b:	72 df                	jb     801f4c <readn+0x33>
+    }
+    return res;
+  801f6d:	48 63 c3             	movslq %ebx,%rax
+}
+  801f70:	48 83 c4 08          	add    $0x8,%rsp
+  801f74:	5b                   	pop    %rbx
+  801f75:	41 5c                	pop    %r12
+  801f77:	41 5d                	pop    %r13
+  801f79:	41 5e                	pop    %r14
+  801f7b:	41 5f                	pop    %r15
+  801f7d:	5d                   	pop    %rbp
+  801f7e:	c3                   	ret
+        if (inc < 0) return inc;
+  801f7f:	48 98                	cltq
+  801f81:	eb ed                	jmp    801f70 <readn+0x57>
+    int inc = 1, res = 0;
+  801f83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f88:	eb e3                	jmp    801f6d <readn+0x54>
+
+0000000000801f8a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f8a:	55                   	push   %rbp
+  801f8b:	48 89 e5             	mov    %rsp,%rbp
+  801f8e:	41 56                	push   %r14
+  801f90:	41 55                	push   %r13
+  801f92:	41 54                	push   %r12
+  801f94:	53                   	push   %rbx
+  801f95:	48 83 ec 10          	sub    $0x10,%rsp
+  801f99:	89 fb                	mov    %edi,%ebx
+  801f9b:	49 89 f4             	mov    %rsi,%r12
+  801f9e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fa1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fa5:	48 b8 78 1b 80 00 00 	movabs $0x801b78,%rax
+  801fac:	00 00 00 
+  801faf:	ff d0                	call   *%rax
+  801fb1:	85 c0                	test   %eax,%eax
+  801fb3:	78 47                	js     801ffc <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fb5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801fb9:	41 8b 3e             	mov    (%r14),%edi
+  801fbc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fc0:	48 b8 c3 1b 80 00 00 	movabs $0x801bc3,%rax
+  801fc7:	00 00 00 
+  801fca:	ff d0                	call   *%rax
+  801fcc:	85 c0                	test   %eax,%eax
+  801fce:	78 30                	js     802000 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fd0:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801fd5:	74 2d                	je     802004 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fd7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fdb:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801fdf:	48 85 c0             	test   %rax,%rax
+  801fe2:	74 56                	je     80203a <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801fe4:	4c 89 ea             	mov    %r13,%rdx
+  801fe7:	4c 89 e6             	mov    %r12,%rsi
+  801fea:	4c 89 f7             	mov    %r14,%rdi
+  801fed:	ff d0                	call   *%rax
+}
+  801fef:	48 83 c4 10          	add    $0x10,%rsp
+  801ff3:	5b                   	pop    %rbx
+  801ff4:	41 5c                	pop    %r12
+  801ff6:	41 5d                	pop    %r13
+  801ff8:	41 5e                	pop    %r14
+  801ffa:	5d                   	pop    %rbp
+  801ffb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ffc:	48 98                	cltq
+  801ffe:	eb ef                	jmp    801fef <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802000:	48 98                	cltq
+  802002:	eb eb                	jmp    801fef <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802004:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80200b:	00 00 00 
+  80200e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802014:	89 da                	mov    %ebx,%edx
+  802016:	48 bf 25 36 80 00 00 	movabs $0x803625,%rdi
+  80201d:	00 00 00 
+  802020:	b8 00 00 00 00       	mov    $0x0,%eax
+  802025:	48 b9 73 05 80 00 00 	movabs $0x800573,%rcx
+  80202c:	00 00 00 
+  80202f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802031:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802038:	eb b5                	jmp    801fef <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80203a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802041:	eb ac                	jmp    801fef <write+0x65>
+
+0000000000802043 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802043:	55                   	push   %rbp
+  802044:	48 89 e5             	mov    %rsp,%rbp
+  802047:	53                   	push   %rbx
+  802048:	48 83 ec 18          	sub    $0x18,%rsp
+  80204c:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80204e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802052:	48 b8 78 1b 80 00 00 	movabs $0x801b78,%rax
+  802059:	00 00 00 
+  80205c:	ff d0                	call   *%rax
+  80205e:	85 c0                	test   %eax,%eax
+  802060:	78 0c                	js     80206e <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802062:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802066:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802069:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80206e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802072:	c9                   	leave
+  802073:	c3                   	ret
+
+0000000000802074 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802074:	55                   	push   %rbp
+  802075:	48 89 e5             	mov    %rsp,%rbp
+  802078:	41 55                	push   %r13
+  80207a:	41 54                	push   %r12
+  80207c:	53                   	push   %rbx
+  80207d:	48 83 ec 18          	sub    $0x18,%rsp
+  802081:	89 fb                	mov    %edi,%ebx
+  802083:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802086:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80208a:	48 b8 78 1b 80 00 00 	movabs $0x801b78,%rax
+  802091:	00 00 00 
+  802094:	ff d0                	call   *%rax
+  802096:	85 c0                	test   %eax,%eax
+  802098:	78 38                	js     8020d2 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80209a:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80209e:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8020a2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020a6:	48 b8 c3 1b 80 00 00 	movabs $0x801bc3,%rax
+  8020ad:	00 00 00 
+  8020b0:	ff d0                	call   *%rax
+  8020b2:	85 c0                	test   %eax,%eax
+  8020b4:	78 1c                	js     8020d2 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020b6:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8020bb:	74 20                	je     8020dd <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020bd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020c1:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8020c5:	48 85 c0             	test   %rax,%rax
+  8020c8:	74 47                	je     802111 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8020ca:	44 89 e6             	mov    %r12d,%esi
+  8020cd:	4c 89 ef             	mov    %r13,%rdi
+  8020d0:	ff d0                	call   *%rax
+}
+  8020d2:	48 83 c4 18          	add    $0x18,%rsp
+  8020d6:	5b                   	pop    %rbx
+  8020d7:	41 5c                	pop    %r12
+  8020d9:	41 5d                	pop    %r13
+  8020db:	5d                   	pop    %rbp
+  8020dc:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8020dd:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8020e4:	00 00 00 
+  8020e7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8020ed:	89 da                	mov    %ebx,%edx
+  8020ef:	48 bf e8 35 80 00 00 	movabs $0x8035e8,%rdi
+  8020f6:	00 00 00 
+  8020f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020fe:	48 b9 73 05 80 00 00 	movabs $0x800573,%rcx
+  802105:	00 00 00 
+  802108:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80210a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80210f:	eb c1                	jmp    8020d2 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802111:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802116:	eb ba                	jmp    8020d2 <ftruncate+0x5e>
+
+0000000000802118 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802118:	55                   	push   %rbp
+  802119:	48 89 e5             	mov    %rsp,%rbp
+  80211c:	41 54                	push   %r12
+  80211e:	53                   	push   %rbx
+  80211f:	48 83 ec 10          	sub    $0x10,%rsp
+  802123:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802126:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80212a:	48 b8 78 1b 80 00 00 	movabs $0x801b78,%rax
+  802131:	00 00 00 
+  802134:	ff d0                	call   *%rax
+  802136:	85 c0                	test   %eax,%eax
+  802138:	78 4e                	js     802188 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80213a:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80213e:	41 8b 3c 24          	mov    (%r12),%edi
+  802142:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802146:	48 b8 c3 1b 80 00 00 	movabs $0x801bc3,%rax
+  80214d:	00 00 00 
+  802150:	ff d0                	call   *%rax
+  802152:	85 c0                	test   %eax,%eax
+  802154:	78 32                	js     802188 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802156:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80215a:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80215f:	74 30                	je     802191 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802161:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802164:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80216b:	00 00 00 
+    stat->st_isdir = 0;
+  80216e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802175:	00 00 00 
+    stat->st_dev = dev;
+  802178:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80217f:	48 89 de             	mov    %rbx,%rsi
+  802182:	4c 89 e7             	mov    %r12,%rdi
+  802185:	ff 50 28             	call   *0x28(%rax)
+}
+  802188:	48 83 c4 10          	add    $0x10,%rsp
+  80218c:	5b                   	pop    %rbx
+  80218d:	41 5c                	pop    %r12
+  80218f:	5d                   	pop    %rbp
+  802190:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802191:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802196:	eb f0                	jmp    802188 <fstat+0x70>
+
+0000000000802198 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802198:	55                   	push   %rbp
+  802199:	48 89 e5             	mov    %rsp,%rbp
+  80219c:	41 54                	push   %r12
+  80219e:	53                   	push   %rbx
+  80219f:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8021a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a7:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  8021ae:	00 00 00 
+  8021b1:	ff d0                	call   *%rax
+  8021b3:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8021b5:	85 c0                	test   %eax,%eax
+  8021b7:	78 25                	js     8021de <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8021b9:	4c 89 e6             	mov    %r12,%rsi
+  8021bc:	89 c7                	mov    %eax,%edi
+  8021be:	48 b8 18 21 80 00 00 	movabs $0x802118,%rax
+  8021c5:	00 00 00 
+  8021c8:	ff d0                	call   *%rax
+  8021ca:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8021cd:	89 df                	mov    %ebx,%edi
+  8021cf:	48 b8 dd 1c 80 00 00 	movabs $0x801cdd,%rax
+  8021d6:	00 00 00 
+  8021d9:	ff d0                	call   *%rax
+
+    return res;
+  8021db:	44 89 e3             	mov    %r12d,%ebx
+}
+  8021de:	89 d8                	mov    %ebx,%eax
+  8021e0:	5b                   	pop    %rbx
+  8021e1:	41 5c                	pop    %r12
+  8021e3:	5d                   	pop    %rbp
+  8021e4:	c3                   	ret
+
+00000000008021e5 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  8021e5:	55                   	push   %rbp
+  8021e6:	48 89 e5             	mov    %rsp,%rbp
+  8021e9:	41 54                	push   %r12
+  8021eb:	53                   	push   %rbx
+  8021ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8021f0:	41 89 fc             	mov    %edi,%r12d
+  8021f3:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021f6:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8021fd:	00 00 00 
+  802200:	83 38 00             	cmpl   $0x0,(%rax)
+  802203:	74 5e                	je     802263 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802205:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80220b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802210:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802217:	00 00 00 
+  80221a:	44 89 e6             	mov    %r12d,%esi
+  80221d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802224:	00 00 00 
+  802227:	8b 38                	mov    (%rax),%edi
+  802229:	48 b8 52 2e 80 00 00 	movabs $0x802e52,%rax
+  802230:	00 00 00 
+  802233:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802235:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80223c:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80223d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802242:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802246:	48 89 de             	mov    %rbx,%rsi
+  802249:	bf 00 00 00 00       	mov    $0x0,%edi
+  80224e:	48 b8 bd 2d 80 00 00 	movabs $0x802dbd,%rax
+  802255:	00 00 00 
+  802258:	ff d0                	call   *%rax
+}
+  80225a:	48 83 c4 10          	add    $0x10,%rsp
+  80225e:	5b                   	pop    %rbx
+  80225f:	41 5c                	pop    %r12
+  802261:	5d                   	pop    %rbp
+  802262:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802263:	bf 03 00 00 00       	mov    $0x3,%edi
+  802268:	48 b8 f2 2e 80 00 00 	movabs $0x802ef2,%rax
+  80226f:	00 00 00 
+  802272:	ff d0                	call   *%rax
+  802274:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80227b:	00 00 
+  80227d:	eb 86                	jmp    802205 <fsipc+0x20>
+
+000000000080227f <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80227f:	55                   	push   %rbp
+  802280:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802283:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80228a:	00 00 00 
+  80228d:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802290:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802292:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802295:	be 00 00 00 00       	mov    $0x0,%esi
+  80229a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80229f:	48 b8 e5 21 80 00 00 	movabs $0x8021e5,%rax
+  8022a6:	00 00 00 
+  8022a9:	ff d0                	call   *%rax
+}
+  8022ab:	5d                   	pop    %rbp
+  8022ac:	c3                   	ret
+
+00000000008022ad <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8022ad:	55                   	push   %rbp
+  8022ae:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8022b1:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8022b4:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8022bb:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8022bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8022c2:	bf 06 00 00 00       	mov    $0x6,%edi
+  8022c7:	48 b8 e5 21 80 00 00 	movabs $0x8021e5,%rax
+  8022ce:	00 00 00 
+  8022d1:	ff d0                	call   *%rax
+}
+  8022d3:	5d                   	pop    %rbp
+  8022d4:	c3                   	ret
+
+00000000008022d5 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8022d5:	55                   	push   %rbp
+  8022d6:	48 89 e5             	mov    %rsp,%rbp
+  8022d9:	41 54                	push   %r12
+  8022db:	53                   	push   %rbx
+  8022dc:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8022df:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8022e2:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8022e9:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8022eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f0:	bf 05 00 00 00       	mov    $0x5,%edi
+  8022f5:	48 b8 e5 21 80 00 00 	movabs $0x8021e5,%rax
+  8022fc:	00 00 00 
+  8022ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802301:	85 c0                	test   %eax,%eax
+  802303:	78 3d                	js     802342 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802305:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80230c:	00 00 00 
+  80230f:	4c 89 e6             	mov    %r12,%rsi
+  802312:	48 89 df             	mov    %rbx,%rdi
+  802315:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  80231c:	00 00 00 
+  80231f:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802321:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802328:	00 
+  802329:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80232f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802336:	00 
+  802337:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80233d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802342:	5b                   	pop    %rbx
+  802343:	41 5c                	pop    %r12
+  802345:	5d                   	pop    %rbp
+  802346:	c3                   	ret
+
+0000000000802347 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802347:	55                   	push   %rbp
+  802348:	48 89 e5             	mov    %rsp,%rbp
+  80234b:	41 54                	push   %r12
+  80234d:	53                   	push   %rbx
+  80234e:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  802351:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802356:	48 39 c2             	cmp    %rax,%rdx
+  802359:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80235d:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802360:	48 89 c2             	mov    %rax,%rdx
+  802363:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80236a:	00 00 00 
+  80236d:	48 b8 f9 10 80 00 00 	movabs $0x8010f9,%rax
+  802374:	00 00 00 
+  802377:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802379:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802380:	00 00 00 
+  802383:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802388:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  80238a:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  80238e:	be 00 00 00 00       	mov    $0x0,%esi
+  802393:	bf 04 00 00 00       	mov    $0x4,%edi
+  802398:	48 b8 e5 21 80 00 00 	movabs $0x8021e5,%rax
+  80239f:	00 00 00 
+  8023a2:	ff d0                	call   *%rax
+  8023a4:	48 98                	cltq
+}
+  8023a6:	5b                   	pop    %rbx
+  8023a7:	41 5c                	pop    %r12
+  8023a9:	5d                   	pop    %rbp
+  8023aa:	c3                   	ret
+
+00000000008023ab <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023ab:	55                   	push   %rbp
+  8023ac:	48 89 e5             	mov    %rsp,%rbp
+  8023af:	41 54                	push   %r12
+  8023b1:	53                   	push   %rbx
+  8023b2:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023b5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023bc:	00 00 00 
+  8023bf:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8023c2:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8023c4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8023c9:	48 39 ca             	cmp    %rcx,%rdx
+  8023cc:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8023d0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8023d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023de:	48 b8 e5 21 80 00 00 	movabs $0x8021e5,%rax
+  8023e5:	00 00 00 
+  8023e8:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  8023ea:	85 c0                	test   %eax,%eax
+  8023ec:	78 27                	js     802415 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  8023ee:	48 63 d8             	movslq %eax,%rbx
+  8023f1:	48 89 da             	mov    %rbx,%rdx
+  8023f4:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8023fb:	00 00 00 
+  8023fe:	4c 89 e7             	mov    %r12,%rdi
+  802401:	48 b8 f9 10 80 00 00 	movabs $0x8010f9,%rax
+  802408:	00 00 00 
+  80240b:	ff d0                	call   *%rax
+    return bytes_read;
+  80240d:	48 89 d8             	mov    %rbx,%rax
+}
+  802410:	5b                   	pop    %rbx
+  802411:	41 5c                	pop    %r12
+  802413:	5d                   	pop    %rbp
+  802414:	c3                   	ret
+        return bytes_read;
+  802415:	48 98                	cltq
+  802417:	eb f7                	jmp    802410 <devfile_read+0x65>
+
+0000000000802419 <open>:
+open(const char *path, int mode) {
+  802419:	55                   	push   %rbp
+  80241a:	48 89 e5             	mov    %rsp,%rbp
+  80241d:	41 55                	push   %r13
+  80241f:	41 54                	push   %r12
+  802421:	53                   	push   %rbx
+  802422:	48 83 ec 18          	sub    $0x18,%rsp
+  802426:	49 89 fc             	mov    %rdi,%r12
+  802429:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80242c:	48 b8 5a 0e 80 00 00 	movabs $0x800e5a,%rax
+  802433:	00 00 00 
+  802436:	ff d0                	call   *%rax
+  802438:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80243e:	0f 87 8a 00 00 00    	ja     8024ce <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802444:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802448:	48 b8 18 1b 80 00 00 	movabs $0x801b18,%rax
+  80244f:	00 00 00 
+  802452:	ff d0                	call   *%rax
+  802454:	89 c3                	mov    %eax,%ebx
+  802456:	85 c0                	test   %eax,%eax
+  802458:	78 50                	js     8024aa <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80245a:	4c 89 e6             	mov    %r12,%rsi
+  80245d:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802464:	00 00 00 
+  802467:	48 89 df             	mov    %rbx,%rdi
+  80246a:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  802471:	00 00 00 
+  802474:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802476:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80247d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802481:	bf 01 00 00 00       	mov    $0x1,%edi
+  802486:	48 b8 e5 21 80 00 00 	movabs $0x8021e5,%rax
+  80248d:	00 00 00 
+  802490:	ff d0                	call   *%rax
+  802492:	89 c3                	mov    %eax,%ebx
+  802494:	85 c0                	test   %eax,%eax
+  802496:	78 1f                	js     8024b7 <open+0x9e>
+    return fd2num(fd);
+  802498:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80249c:	48 b8 ea 1a 80 00 00 	movabs $0x801aea,%rax
+  8024a3:	00 00 00 
+  8024a6:	ff d0                	call   *%rax
+  8024a8:	89 c3                	mov    %eax,%ebx
+}
+  8024aa:	89 d8                	mov    %ebx,%eax
+  8024ac:	48 83 c4 18          	add    $0x18,%rsp
+  8024b0:	5b                   	pop    %rbx
+  8024b1:	41 5c                	pop    %r12
+  8024b3:	41 5d                	pop    %r13
+  8024b5:	5d                   	pop    %rbp
+  8024b6:	c3                   	ret
+        fd_close(fd, 0);
+  8024b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8024bc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024c0:	48 b8 33 1c 80 00 00 	movabs $0x801c33,%rax
+  8024c7:	00 00 00 
+  8024ca:	ff d0                	call   *%rax
+        return res;
+  8024cc:	eb dc                	jmp    8024aa <open+0x91>
+        return -E_BAD_PATH;
+  8024ce:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8024d3:	eb d5                	jmp    8024aa <open+0x91>
+
+00000000008024d5 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8024d5:	55                   	push   %rbp
+  8024d6:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8024d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024de:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024e3:	48 b8 e5 21 80 00 00 	movabs $0x8021e5,%rax
+  8024ea:	00 00 00 
+  8024ed:	ff d0                	call   *%rax
+}
+  8024ef:	5d                   	pop    %rbp
+  8024f0:	c3                   	ret
+
+00000000008024f1 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024f1:	55                   	push   %rbp
+  8024f2:	48 89 e5             	mov    %rsp,%rbp
+  8024f5:	41 54                	push   %r12
+  8024f7:	53                   	push   %rbx
+  8024f8:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024fb:	48 b8 fc 1a 80 00 00 	movabs $0x801afc,%rax
+  802502:	00 00 00 
+  802505:	ff d0                	call   *%rax
+  802507:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80250a:	48 be 80 36 80 00 00 	movabs $0x803680,%rsi
+  802511:	00 00 00 
+  802514:	48 89 df             	mov    %rbx,%rdi
+  802517:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  80251e:	00 00 00 
+  802521:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802523:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802528:	41 2b 04 24          	sub    (%r12),%eax
+  80252c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802532:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802539:	00 00 00 
+    stat->st_dev = &devpipe;
+  80253c:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802543:	00 00 00 
+  802546:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80254d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802552:	5b                   	pop    %rbx
+  802553:	41 5c                	pop    %r12
+  802555:	5d                   	pop    %rbp
+  802556:	c3                   	ret
+
+0000000000802557 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802557:	55                   	push   %rbp
+  802558:	48 89 e5             	mov    %rsp,%rbp
+  80255b:	41 54                	push   %r12
+  80255d:	53                   	push   %rbx
+  80255e:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802561:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802566:	48 89 fe             	mov    %rdi,%rsi
+  802569:	bf 00 00 00 00       	mov    $0x0,%edi
+  80256e:	49 bc 14 15 80 00 00 	movabs $0x801514,%r12
+  802575:	00 00 00 
+  802578:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80257b:	48 89 df             	mov    %rbx,%rdi
+  80257e:	48 b8 fc 1a 80 00 00 	movabs $0x801afc,%rax
+  802585:	00 00 00 
+  802588:	ff d0                	call   *%rax
+  80258a:	48 89 c6             	mov    %rax,%rsi
+  80258d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802592:	bf 00 00 00 00       	mov    $0x0,%edi
+  802597:	41 ff d4             	call   *%r12
+}
+  80259a:	5b                   	pop    %rbx
+  80259b:	41 5c                	pop    %r12
+  80259d:	5d                   	pop    %rbp
+  80259e:	c3                   	ret
+
+000000000080259f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80259f:	55                   	push   %rbp
+  8025a0:	48 89 e5             	mov    %rsp,%rbp
+  8025a3:	41 57                	push   %r15
+  8025a5:	41 56                	push   %r14
+  8025a7:	41 55                	push   %r13
+  8025a9:	41 54                	push   %r12
+  8025ab:	53                   	push   %rbx
+  8025ac:	48 83 ec 18          	sub    $0x18,%rsp
+  8025b0:	49 89 fc             	mov    %rdi,%r12
+  8025b3:	49 89 f5             	mov    %rsi,%r13
+  8025b6:	49 89 d7             	mov    %rdx,%r15
+  8025b9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025bd:	48 b8 fc 1a 80 00 00 	movabs $0x801afc,%rax
+  8025c4:	00 00 00 
+  8025c7:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8025c9:	4d 85 ff             	test   %r15,%r15
+  8025cc:	0f 84 af 00 00 00    	je     802681 <devpipe_write+0xe2>
+  8025d2:	48 89 c3             	mov    %rax,%rbx
+  8025d5:	4c 89 f8             	mov    %r15,%rax
+  8025d8:	4d 89 ef             	mov    %r13,%r15
+  8025db:	4c 01 e8             	add    %r13,%rax
+  8025de:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025e2:	49 bd 1c 14 80 00 00 	movabs $0x80141c,%r13
+  8025e9:	00 00 00 
+            sys_yield();
+  8025ec:	49 be b9 13 80 00 00 	movabs $0x8013b9,%r14
+  8025f3:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025f6:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025f9:	48 63 ce             	movslq %esi,%rcx
+  8025fc:	48 63 03             	movslq (%rbx),%rax
+  8025ff:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802605:	48 39 c1             	cmp    %rax,%rcx
+  802608:	72 2e                	jb     802638 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80260a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80260f:	48 89 da             	mov    %rbx,%rdx
+  802612:	be 00 10 00 00       	mov    $0x1000,%esi
+  802617:	4c 89 e7             	mov    %r12,%rdi
+  80261a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80261d:	85 c0                	test   %eax,%eax
+  80261f:	74 66                	je     802687 <devpipe_write+0xe8>
+            sys_yield();
+  802621:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802624:	8b 73 04             	mov    0x4(%rbx),%esi
+  802627:	48 63 ce             	movslq %esi,%rcx
+  80262a:	48 63 03             	movslq (%rbx),%rax
+  80262d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802633:	48 39 c1             	cmp    %rax,%rcx
+  802636:	73 d2                	jae    80260a <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802638:	41 0f b6 3f          	movzbl (%r15),%edi
+  80263c:	48 89 ca             	mov    %rcx,%rdx
+  80263f:	48 c1 ea 03          	shr    $0x3,%rdx
+  802643:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80264a:	08 10 20 
+  80264d:	48 f7 e2             	mul    %rdx
+  802650:	48 c1 ea 06          	shr    $0x6,%rdx
+  802654:	48 89 d0             	mov    %rdx,%rax
+  802657:	48 c1 e0 09          	shl    $0x9,%rax
+  80265b:	48 29 d0             	sub    %rdx,%rax
+  80265e:	48 c1 e0 03          	shl    $0x3,%rax
+  802662:	48 29 c1             	sub    %rax,%rcx
+  802665:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80266a:	83 c6 01             	add    $0x1,%esi
+  80266d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802670:	49 83 c7 01          	add    $0x1,%r15
+  802674:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802678:	49 39 c7             	cmp    %rax,%r15
+  80267b:	0f 85 75 ff ff ff    	jne    8025f6 <devpipe_write+0x57>
+    return n;
+  802681:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802685:	eb 05                	jmp    80268c <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802687:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80268c:	48 83 c4 18          	add    $0x18,%rsp
+  802690:	5b                   	pop    %rbx
+  802691:	41 5c                	pop    %r12
+  802693:	41 5d                	pop    %r13
+  802695:	41 5e                	pop    %r14
+  802697:	41 5f                	pop    %r15
+  802699:	5d                   	pop    %rbp
+  80269a:	c3                   	ret
+
+000000000080269b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80269b:	55                   	push   %rbp
+  80269c:	48 89 e5             	mov    %rsp,%rbp
+  80269f:	41 57                	push   %r15
+  8026a1:	41 56                	push   %r14
+  8026a3:	41 55                	push   %r13
+  8026a5:	41 54                	push   %r12
+  8026a7:	53                   	push   %rbx
+  8026a8:	48 83 ec 18          	sub    $0x18,%rsp
+  8026ac:	49 89 fc             	mov    %rdi,%r12
+  8026af:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8026b3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8026b7:	48 b8 fc 1a 80 00 00 	movabs $0x801afc,%rax
+  8026be:	00 00 00 
+  8026c1:	ff d0                	call   *%rax
+  8026c3:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8026c6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026cc:	49 bd 1c 14 80 00 00 	movabs $0x80141c,%r13
+  8026d3:	00 00 00 
+            sys_yield();
+  8026d6:	49 be b9 13 80 00 00 	movabs $0x8013b9,%r14
+  8026dd:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8026e0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8026e5:	74 7d                	je     802764 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026e7:	8b 03                	mov    (%rbx),%eax
+  8026e9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026ec:	75 26                	jne    802714 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026ee:	4d 85 ff             	test   %r15,%r15
+  8026f1:	75 77                	jne    80276a <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026f3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026f8:	48 89 da             	mov    %rbx,%rdx
+  8026fb:	be 00 10 00 00       	mov    $0x1000,%esi
+  802700:	4c 89 e7             	mov    %r12,%rdi
+  802703:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802706:	85 c0                	test   %eax,%eax
+  802708:	74 72                	je     80277c <devpipe_read+0xe1>
+            sys_yield();
+  80270a:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80270d:	8b 03                	mov    (%rbx),%eax
+  80270f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802712:	74 df                	je     8026f3 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802714:	48 63 c8             	movslq %eax,%rcx
+  802717:	48 89 ca             	mov    %rcx,%rdx
+  80271a:	48 c1 ea 03          	shr    $0x3,%rdx
+  80271e:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802725:	08 10 20 
+  802728:	48 89 d0             	mov    %rdx,%rax
+  80272b:	48 f7 e6             	mul    %rsi
+  80272e:	48 c1 ea 06          	shr    $0x6,%rdx
+  802732:	48 89 d0             	mov    %rdx,%rax
+  802735:	48 c1 e0 09          	shl    $0x9,%rax
+  802739:	48 29 d0             	sub    %rdx,%rax
+  80273c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802743:	00 
+  802744:	48 89 c8             	mov    %rcx,%rax
+  802747:	48 29 d0             	sub    %rdx,%rax
+  80274a:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80274f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802753:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802757:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80275a:	49 83 c7 01          	add    $0x1,%r15
+  80275e:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802762:	75 83                	jne    8026e7 <devpipe_read+0x4c>
+    return n;
+  802764:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802768:	eb 03                	jmp    80276d <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80276a:	4c 89 f8             	mov    %r15,%rax
+}
+  80276d:	48 83 c4 18          	add    $0x18,%rsp
+  802771:	5b                   	pop    %rbx
+  802772:	41 5c                	pop    %r12
+  802774:	41 5d                	pop    %r13
+  802776:	41 5e                	pop    %r14
+  802778:	41 5f                	pop    %r15
+  80277a:	5d                   	pop    %rbp
+  80277b:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80277c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802781:	eb ea                	jmp    80276d <devpipe_read+0xd2>
+
+0000000000802783 <pipe>:
+pipe(int pfd[2]) {
+  802783:	55                   	push   %rbp
+  802784:	48 89 e5             	mov    %rsp,%rbp
+  802787:	41 55                	push   %r13
+  802789:	41 54                	push   %r12
+  80278b:	53                   	push   %rbx
+  80278c:	48 83 ec 18          	sub    $0x18,%rsp
+  802790:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802793:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802797:	48 b8 18 1b 80 00 00 	movabs $0x801b18,%rax
+  80279e:	00 00 00 
+  8027a1:	ff d0                	call   *%rax
+  8027a3:	89 c3                	mov    %eax,%ebx
+  8027a5:	85 c0                	test   %eax,%eax
+  8027a7:	0f 88 a0 01 00 00    	js     80294d <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8027ad:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027b2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027b7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8027bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027c0:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  8027c7:	00 00 00 
+  8027ca:	ff d0                	call   *%rax
+  8027cc:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027ce:	85 c0                	test   %eax,%eax
+  8027d0:	0f 88 77 01 00 00    	js     80294d <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027d6:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8027da:	48 b8 18 1b 80 00 00 	movabs $0x801b18,%rax
+  8027e1:	00 00 00 
+  8027e4:	ff d0                	call   *%rax
+  8027e6:	89 c3                	mov    %eax,%ebx
+  8027e8:	85 c0                	test   %eax,%eax
+  8027ea:	0f 88 43 01 00 00    	js     802933 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8027f0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027f5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027fa:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802803:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  80280a:	00 00 00 
+  80280d:	ff d0                	call   *%rax
+  80280f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802811:	85 c0                	test   %eax,%eax
+  802813:	0f 88 1a 01 00 00    	js     802933 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802819:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80281d:	48 b8 fc 1a 80 00 00 	movabs $0x801afc,%rax
+  802824:	00 00 00 
+  802827:	ff d0                	call   *%rax
+  802829:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80282c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802831:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802836:	48 89 c6             	mov    %rax,%rsi
+  802839:	bf 00 00 00 00       	mov    $0x0,%edi
+  80283e:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  802845:	00 00 00 
+  802848:	ff d0                	call   *%rax
+  80284a:	89 c3                	mov    %eax,%ebx
+  80284c:	85 c0                	test   %eax,%eax
+  80284e:	0f 88 c5 00 00 00    	js     802919 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802854:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802858:	48 b8 fc 1a 80 00 00 	movabs $0x801afc,%rax
+  80285f:	00 00 00 
+  802862:	ff d0                	call   *%rax
+  802864:	48 89 c1             	mov    %rax,%rcx
+  802867:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80286d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802873:	ba 00 00 00 00       	mov    $0x0,%edx
+  802878:	4c 89 ee             	mov    %r13,%rsi
+  80287b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802880:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  802887:	00 00 00 
+  80288a:	ff d0                	call   *%rax
+  80288c:	89 c3                	mov    %eax,%ebx
+  80288e:	85 c0                	test   %eax,%eax
+  802890:	78 6e                	js     802900 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802892:	be 00 10 00 00       	mov    $0x1000,%esi
+  802897:	4c 89 ef             	mov    %r13,%rdi
+  80289a:	48 b8 ea 13 80 00 00 	movabs $0x8013ea,%rax
+  8028a1:	00 00 00 
+  8028a4:	ff d0                	call   *%rax
+  8028a6:	83 f8 02             	cmp    $0x2,%eax
+  8028a9:	0f 85 ab 00 00 00    	jne    80295a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8028af:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8028b6:	00 00 
+  8028b8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028bc:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8028be:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028c2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8028c9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8028cd:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8028cf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028d3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8028da:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028de:	48 bb ea 1a 80 00 00 	movabs $0x801aea,%rbx
+  8028e5:	00 00 00 
+  8028e8:	ff d3                	call   *%rbx
+  8028ea:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028ee:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028f2:	ff d3                	call   *%rbx
+  8028f4:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8028f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028fe:	eb 4d                	jmp    80294d <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802900:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802905:	4c 89 ee             	mov    %r13,%rsi
+  802908:	bf 00 00 00 00       	mov    $0x0,%edi
+  80290d:	48 b8 14 15 80 00 00 	movabs $0x801514,%rax
+  802914:	00 00 00 
+  802917:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802919:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80291e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802922:	bf 00 00 00 00       	mov    $0x0,%edi
+  802927:	48 b8 14 15 80 00 00 	movabs $0x801514,%rax
+  80292e:	00 00 00 
+  802931:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802933:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802938:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80293c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802941:	48 b8 14 15 80 00 00 	movabs $0x801514,%rax
+  802948:	00 00 00 
+  80294b:	ff d0                	call   *%rax
+}
+  80294d:	89 d8                	mov    %ebx,%eax
+  80294f:	48 83 c4 18          	add    $0x18,%rsp
+  802953:	5b                   	pop    %rbx
+  802954:	41 5c                	pop    %r12
+  802956:	41 5d                	pop    %r13
+  802958:	5d                   	pop    %rbp
+  802959:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80295a:	48 b9 a8 36 80 00 00 	movabs $0x8036a8,%rcx
+  802961:	00 00 00 
+  802964:	48 ba 87 36 80 00 00 	movabs $0x803687,%rdx
+  80296b:	00 00 00 
+  80296e:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802973:	48 bf 9c 36 80 00 00 	movabs $0x80369c,%rdi
+  80297a:	00 00 00 
+  80297d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802982:	49 b8 23 04 80 00 00 	movabs $0x800423,%r8
+  802989:	00 00 00 
+  80298c:	41 ff d0             	call   *%r8
+
+000000000080298f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80298f:	55                   	push   %rbp
+  802990:	48 89 e5             	mov    %rsp,%rbp
+  802993:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802997:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80299b:	48 b8 78 1b 80 00 00 	movabs $0x801b78,%rax
+  8029a2:	00 00 00 
+  8029a5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029a7:	85 c0                	test   %eax,%eax
+  8029a9:	78 35                	js     8029e0 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8029ab:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029af:	48 b8 fc 1a 80 00 00 	movabs $0x801afc,%rax
+  8029b6:	00 00 00 
+  8029b9:	ff d0                	call   *%rax
+  8029bb:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8029be:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029c3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029c8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029cc:	48 b8 1c 14 80 00 00 	movabs $0x80141c,%rax
+  8029d3:	00 00 00 
+  8029d6:	ff d0                	call   *%rax
+  8029d8:	85 c0                	test   %eax,%eax
+  8029da:	0f 94 c0             	sete   %al
+  8029dd:	0f b6 c0             	movzbl %al,%eax
+}
+  8029e0:	c9                   	leave
+  8029e1:	c3                   	ret
+
+00000000008029e2 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029e2:	48 89 f8             	mov    %rdi,%rax
+  8029e5:	48 c1 e8 27          	shr    $0x27,%rax
+  8029e9:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8029f0:	01 00 00 
+  8029f3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029f7:	f6 c2 01             	test   $0x1,%dl
+  8029fa:	74 6d                	je     802a69 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029fc:	48 89 f8             	mov    %rdi,%rax
+  8029ff:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a03:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a0a:	01 00 00 
+  802a0d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a11:	f6 c2 01             	test   $0x1,%dl
+  802a14:	74 62                	je     802a78 <get_uvpt_entry+0x96>
+  802a16:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a1d:	01 00 00 
+  802a20:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a24:	f6 c2 80             	test   $0x80,%dl
+  802a27:	75 4f                	jne    802a78 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a29:	48 89 f8             	mov    %rdi,%rax
+  802a2c:	48 c1 e8 15          	shr    $0x15,%rax
+  802a30:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a37:	01 00 00 
+  802a3a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a3e:	f6 c2 01             	test   $0x1,%dl
+  802a41:	74 44                	je     802a87 <get_uvpt_entry+0xa5>
+  802a43:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a4a:	01 00 00 
+  802a4d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a51:	f6 c2 80             	test   $0x80,%dl
+  802a54:	75 31                	jne    802a87 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a56:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a5a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a61:	01 00 00 
+  802a64:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a68:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a69:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a70:	01 00 00 
+  802a73:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a77:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a78:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a7f:	01 00 00 
+  802a82:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a86:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a87:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a8e:	01 00 00 
+  802a91:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a95:	c3                   	ret
+
+0000000000802a96 <get_prot>:
+
+int
+get_prot(void *va) {
+  802a96:	55                   	push   %rbp
+  802a97:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a9a:	48 b8 e2 29 80 00 00 	movabs $0x8029e2,%rax
+  802aa1:	00 00 00 
+  802aa4:	ff d0                	call   *%rax
+  802aa6:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802aa9:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802aae:	89 c1                	mov    %eax,%ecx
+  802ab0:	83 c9 04             	or     $0x4,%ecx
+  802ab3:	f6 c2 01             	test   $0x1,%dl
+  802ab6:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802ab9:	89 c1                	mov    %eax,%ecx
+  802abb:	83 c9 02             	or     $0x2,%ecx
+  802abe:	f6 c2 02             	test   $0x2,%dl
+  802ac1:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802ac4:	89 c1                	mov    %eax,%ecx
+  802ac6:	83 c9 01             	or     $0x1,%ecx
+  802ac9:	48 85 d2             	test   %rdx,%rdx
+  802acc:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802acf:	89 c1                	mov    %eax,%ecx
+  802ad1:	83 c9 40             	or     $0x40,%ecx
+  802ad4:	f6 c6 04             	test   $0x4,%dh
+  802ad7:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802ada:	5d                   	pop    %rbp
+  802adb:	c3                   	ret
+
+0000000000802adc <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802adc:	55                   	push   %rbp
+  802add:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802ae0:	48 b8 e2 29 80 00 00 	movabs $0x8029e2,%rax
+  802ae7:	00 00 00 
+  802aea:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802aec:	48 c1 e8 06          	shr    $0x6,%rax
+  802af0:	83 e0 01             	and    $0x1,%eax
+}
+  802af3:	5d                   	pop    %rbp
+  802af4:	c3                   	ret
+
+0000000000802af5 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802af5:	55                   	push   %rbp
+  802af6:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802af9:	48 b8 e2 29 80 00 00 	movabs $0x8029e2,%rax
+  802b00:	00 00 00 
+  802b03:	ff d0                	call   *%rax
+  802b05:	83 e0 01             	and    $0x1,%eax
+}
+  802b08:	5d                   	pop    %rbp
+  802b09:	c3                   	ret
+
+0000000000802b0a <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802b0a:	55                   	push   %rbp
+  802b0b:	48 89 e5             	mov    %rsp,%rbp
+  802b0e:	41 57                	push   %r15
+  802b10:	41 56                	push   %r14
+  802b12:	41 55                	push   %r13
+  802b14:	41 54                	push   %r12
+  802b16:	53                   	push   %rbx
+  802b17:	48 83 ec 18          	sub    $0x18,%rsp
+  802b1b:	49 89 ff             	mov    %rdi,%r15
+  802b1e:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802b22:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802b27:	49 bc f5 2a 80 00 00 	movabs $0x802af5,%r12
+  802b2e:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802b31:	49 be 96 2a 80 00 00 	movabs $0x802a96,%r14
+  802b38:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802b3b:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802b42:	00 00 00 
+  802b45:	eb 0c                	jmp    802b53 <foreach_shared_region+0x49>
+  802b47:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b4e:	4c 39 eb             	cmp    %r13,%rbx
+  802b51:	74 38                	je     802b8b <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802b53:	48 89 df             	mov    %rbx,%rdi
+  802b56:	41 ff d4             	call   *%r12
+  802b59:	84 c0                	test   %al,%al
+  802b5b:	74 ea                	je     802b47 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802b5d:	48 89 df             	mov    %rbx,%rdi
+  802b60:	41 ff d6             	call   *%r14
+  802b63:	a8 40                	test   $0x40,%al
+  802b65:	74 e0                	je     802b47 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802b67:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802b6e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802b72:	48 89 df             	mov    %rbx,%rdi
+  802b75:	41 ff d7             	call   *%r15
+        if (err)
+  802b78:	85 c0                	test   %eax,%eax
+  802b7a:	74 cb                	je     802b47 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802b7c:	48 83 c4 18          	add    $0x18,%rsp
+  802b80:	5b                   	pop    %rbx
+  802b81:	41 5c                	pop    %r12
+  802b83:	41 5d                	pop    %r13
+  802b85:	41 5e                	pop    %r14
+  802b87:	41 5f                	pop    %r15
+  802b89:	5d                   	pop    %rbp
+  802b8a:	c3                   	ret
+    return 0;
+  802b8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b90:	eb ea                	jmp    802b7c <foreach_shared_region+0x72>
+
+0000000000802b92 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802b92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b97:	c3                   	ret
+
+0000000000802b98 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802b98:	55                   	push   %rbp
+  802b99:	48 89 e5             	mov    %rsp,%rbp
+  802b9c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802b9f:	48 be cc 36 80 00 00 	movabs $0x8036cc,%rsi
+  802ba6:	00 00 00 
+  802ba9:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  802bb0:	00 00 00 
+  802bb3:	ff d0                	call   *%rax
+    return 0;
+}
+  802bb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bba:	5d                   	pop    %rbp
+  802bbb:	c3                   	ret
+
+0000000000802bbc <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802bbc:	55                   	push   %rbp
+  802bbd:	48 89 e5             	mov    %rsp,%rbp
+  802bc0:	41 57                	push   %r15
+  802bc2:	41 56                	push   %r14
+  802bc4:	41 55                	push   %r13
+  802bc6:	41 54                	push   %r12
+  802bc8:	53                   	push   %rbx
+  802bc9:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802bd0:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802bd7:	48 85 d2             	test   %rdx,%rdx
+  802bda:	74 7a                	je     802c56 <devcons_write+0x9a>
+  802bdc:	49 89 d6             	mov    %rdx,%r14
+  802bdf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802be5:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802bea:	49 bf 92 10 80 00 00 	movabs $0x801092,%r15
+  802bf1:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802bf4:	4c 89 f3             	mov    %r14,%rbx
+  802bf7:	48 29 f3             	sub    %rsi,%rbx
+  802bfa:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802bff:	48 39 c3             	cmp    %rax,%rbx
+  802c02:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802c06:	4c 63 eb             	movslq %ebx,%r13
+  802c09:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802c10:	48 01 c6             	add    %rax,%rsi
+  802c13:	4c 89 ea             	mov    %r13,%rdx
+  802c16:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802c1d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802c20:	4c 89 ee             	mov    %r13,%rsi
+  802c23:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802c2a:	48 b8 bf 12 80 00 00 	movabs $0x8012bf,%rax
+  802c31:	00 00 00 
+  802c34:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802c36:	41 01 dc             	add    %ebx,%r12d
+  802c39:	49 63 f4             	movslq %r12d,%rsi
+  802c3c:	4c 39 f6             	cmp    %r14,%rsi
+  802c3f:	72 b3                	jb     802bf4 <devcons_write+0x38>
+    return res;
+  802c41:	49 63 c4             	movslq %r12d,%rax
+}
+  802c44:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802c4b:	5b                   	pop    %rbx
+  802c4c:	41 5c                	pop    %r12
+  802c4e:	41 5d                	pop    %r13
+  802c50:	41 5e                	pop    %r14
+  802c52:	41 5f                	pop    %r15
+  802c54:	5d                   	pop    %rbp
+  802c55:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802c56:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802c5c:	eb e3                	jmp    802c41 <devcons_write+0x85>
+
+0000000000802c5e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802c5e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802c61:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c66:	48 85 c0             	test   %rax,%rax
+  802c69:	74 55                	je     802cc0 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802c6b:	55                   	push   %rbp
+  802c6c:	48 89 e5             	mov    %rsp,%rbp
+  802c6f:	41 55                	push   %r13
+  802c71:	41 54                	push   %r12
+  802c73:	53                   	push   %rbx
+  802c74:	48 83 ec 08          	sub    $0x8,%rsp
+  802c78:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802c7b:	48 bb ec 12 80 00 00 	movabs $0x8012ec,%rbx
+  802c82:	00 00 00 
+  802c85:	49 bc b9 13 80 00 00 	movabs $0x8013b9,%r12
+  802c8c:	00 00 00 
+  802c8f:	eb 03                	jmp    802c94 <devcons_read+0x36>
+  802c91:	41 ff d4             	call   *%r12
+  802c94:	ff d3                	call   *%rbx
+  802c96:	85 c0                	test   %eax,%eax
+  802c98:	74 f7                	je     802c91 <devcons_read+0x33>
+    if (c < 0) return c;
+  802c9a:	48 63 d0             	movslq %eax,%rdx
+  802c9d:	78 13                	js     802cb2 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802c9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ca4:	83 f8 04             	cmp    $0x4,%eax
+  802ca7:	74 09                	je     802cb2 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802ca9:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802cad:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802cb2:	48 89 d0             	mov    %rdx,%rax
+  802cb5:	48 83 c4 08          	add    $0x8,%rsp
+  802cb9:	5b                   	pop    %rbx
+  802cba:	41 5c                	pop    %r12
+  802cbc:	41 5d                	pop    %r13
+  802cbe:	5d                   	pop    %rbp
+  802cbf:	c3                   	ret
+  802cc0:	48 89 d0             	mov    %rdx,%rax
+  802cc3:	c3                   	ret
+
+0000000000802cc4 <cputchar>:
+cputchar(int ch) {
+  802cc4:	55                   	push   %rbp
+  802cc5:	48 89 e5             	mov    %rsp,%rbp
+  802cc8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802ccc:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802cd0:	be 01 00 00 00       	mov    $0x1,%esi
+  802cd5:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802cd9:	48 b8 bf 12 80 00 00 	movabs $0x8012bf,%rax
+  802ce0:	00 00 00 
+  802ce3:	ff d0                	call   *%rax
+}
+  802ce5:	c9                   	leave
+  802ce6:	c3                   	ret
+
+0000000000802ce7 <getchar>:
+getchar(void) {
+  802ce7:	55                   	push   %rbp
+  802ce8:	48 89 e5             	mov    %rsp,%rbp
+  802ceb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802cef:	ba 01 00 00 00       	mov    $0x1,%edx
+  802cf4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802cf8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cfd:	48 b8 5b 1e 80 00 00 	movabs $0x801e5b,%rax
+  802d04:	00 00 00 
+  802d07:	ff d0                	call   *%rax
+  802d09:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802d0b:	85 c0                	test   %eax,%eax
+  802d0d:	78 06                	js     802d15 <getchar+0x2e>
+  802d0f:	74 08                	je     802d19 <getchar+0x32>
+  802d11:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802d15:	89 d0                	mov    %edx,%eax
+  802d17:	c9                   	leave
+  802d18:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802d19:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802d1e:	eb f5                	jmp    802d15 <getchar+0x2e>
+
+0000000000802d20 <iscons>:
+iscons(int fdnum) {
+  802d20:	55                   	push   %rbp
+  802d21:	48 89 e5             	mov    %rsp,%rbp
+  802d24:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802d28:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d2c:	48 b8 78 1b 80 00 00 	movabs $0x801b78,%rax
+  802d33:	00 00 00 
+  802d36:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d38:	85 c0                	test   %eax,%eax
+  802d3a:	78 18                	js     802d54 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802d3c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d40:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802d47:	00 00 00 
+  802d4a:	8b 00                	mov    (%rax),%eax
+  802d4c:	39 02                	cmp    %eax,(%rdx)
+  802d4e:	0f 94 c0             	sete   %al
+  802d51:	0f b6 c0             	movzbl %al,%eax
+}
+  802d54:	c9                   	leave
+  802d55:	c3                   	ret
+
+0000000000802d56 <opencons>:
+opencons(void) {
+  802d56:	55                   	push   %rbp
+  802d57:	48 89 e5             	mov    %rsp,%rbp
+  802d5a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802d5e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802d62:	48 b8 18 1b 80 00 00 	movabs $0x801b18,%rax
+  802d69:	00 00 00 
+  802d6c:	ff d0                	call   *%rax
+  802d6e:	85 c0                	test   %eax,%eax
+  802d70:	78 49                	js     802dbb <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802d72:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802d77:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d7c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802d80:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d85:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  802d8c:	00 00 00 
+  802d8f:	ff d0                	call   *%rax
+  802d91:	85 c0                	test   %eax,%eax
+  802d93:	78 26                	js     802dbb <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802d95:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d99:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802da0:	00 00 
+  802da2:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802da4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802da8:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802daf:	48 b8 ea 1a 80 00 00 	movabs $0x801aea,%rax
+  802db6:	00 00 00 
+  802db9:	ff d0                	call   *%rax
+}
+  802dbb:	c9                   	leave
+  802dbc:	c3                   	ret
+
+0000000000802dbd <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802dbd:	55                   	push   %rbp
+  802dbe:	48 89 e5             	mov    %rsp,%rbp
+  802dc1:	41 54                	push   %r12
+  802dc3:	53                   	push   %rbx
+  802dc4:	48 89 fb             	mov    %rdi,%rbx
+  802dc7:	48 89 f7             	mov    %rsi,%rdi
+  802dca:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802dcd:	48 85 f6             	test   %rsi,%rsi
+  802dd0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802dd7:	00 00 00 
+  802dda:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802dde:	be 00 10 00 00       	mov    $0x1000,%esi
+  802de3:	48 b8 b2 17 80 00 00 	movabs $0x8017b2,%rax
+  802dea:	00 00 00 
+  802ded:	ff d0                	call   *%rax
+    if (res < 0) {
+  802def:	85 c0                	test   %eax,%eax
+  802df1:	78 45                	js     802e38 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802df3:	48 85 db             	test   %rbx,%rbx
+  802df6:	74 12                	je     802e0a <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802df8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802dff:	00 00 00 
+  802e02:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802e08:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802e0a:	4d 85 e4             	test   %r12,%r12
+  802e0d:	74 14                	je     802e23 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802e0f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e16:	00 00 00 
+  802e19:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802e1f:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802e23:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e2a:	00 00 00 
+  802e2d:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802e33:	5b                   	pop    %rbx
+  802e34:	41 5c                	pop    %r12
+  802e36:	5d                   	pop    %rbp
+  802e37:	c3                   	ret
+        if (from_env_store)
+  802e38:	48 85 db             	test   %rbx,%rbx
+  802e3b:	74 06                	je     802e43 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802e3d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802e43:	4d 85 e4             	test   %r12,%r12
+  802e46:	74 eb                	je     802e33 <ipc_recv+0x76>
+            *perm_store = 0;
+  802e48:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802e4f:	00 
+  802e50:	eb e1                	jmp    802e33 <ipc_recv+0x76>
+
+0000000000802e52 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802e52:	55                   	push   %rbp
+  802e53:	48 89 e5             	mov    %rsp,%rbp
+  802e56:	41 57                	push   %r15
+  802e58:	41 56                	push   %r14
+  802e5a:	41 55                	push   %r13
+  802e5c:	41 54                	push   %r12
+  802e5e:	53                   	push   %rbx
+  802e5f:	48 83 ec 18          	sub    $0x18,%rsp
+  802e63:	41 89 fd             	mov    %edi,%r13d
+  802e66:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802e69:	48 89 d3             	mov    %rdx,%rbx
+  802e6c:	49 89 cc             	mov    %rcx,%r12
+  802e6f:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802e73:	48 85 d2             	test   %rdx,%rdx
+  802e76:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802e7d:	00 00 00 
+  802e80:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802e84:	49 be 86 17 80 00 00 	movabs $0x801786,%r14
+  802e8b:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802e8e:	49 bf b9 13 80 00 00 	movabs $0x8013b9,%r15
+  802e95:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802e98:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802e9b:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802e9f:	4c 89 e1             	mov    %r12,%rcx
+  802ea2:	48 89 da             	mov    %rbx,%rdx
+  802ea5:	44 89 ef             	mov    %r13d,%edi
+  802ea8:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802eab:	85 c0                	test   %eax,%eax
+  802ead:	74 34                	je     802ee3 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802eaf:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802eb2:	75 05                	jne    802eb9 <ipc_send+0x67>
+        sys_yield();
+  802eb4:	41 ff d7             	call   *%r15
+    while (true) {
+  802eb7:	eb df                	jmp    802e98 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802eb9:	48 ba d8 36 80 00 00 	movabs $0x8036d8,%rdx
+  802ec0:	00 00 00 
+  802ec3:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802ec8:	48 bf f1 36 80 00 00 	movabs $0x8036f1,%rdi
+  802ecf:	00 00 00 
+  802ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ed7:	48 b9 23 04 80 00 00 	movabs $0x800423,%rcx
+  802ede:	00 00 00 
+  802ee1:	ff d1                	call   *%rcx
+    }
+}
+  802ee3:	48 83 c4 18          	add    $0x18,%rsp
+  802ee7:	5b                   	pop    %rbx
+  802ee8:	41 5c                	pop    %r12
+  802eea:	41 5d                	pop    %r13
+  802eec:	41 5e                	pop    %r14
+  802eee:	41 5f                	pop    %r15
+  802ef0:	5d                   	pop    %rbp
+  802ef1:	c3                   	ret
+
+0000000000802ef2 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802ef7:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802efe:	00 00 00 
+  802f01:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802f08:	48 01 ca             	add    %rcx,%rdx
+  802f0b:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802f11:	39 fa                	cmp    %edi,%edx
+  802f13:	74 12                	je     802f27 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802f15:	48 83 c0 01          	add    $0x1,%rax
+  802f19:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802f1f:	75 e0                	jne    802f01 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802f21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f26:	c3                   	ret
+            return envs[i].env_id;
+  802f27:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802f2e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802f35:	00 00 00 
+  802f38:	48 01 d0             	add    %rdx,%rax
+  802f3b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802f41:	c3                   	ret
+  802f42:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802f48 <__rodata_start>:
+  802f48:	70 72                	jo     802fbc <__rodata_start+0x74>
+  802f4a:	69 6d 65 70 72 6f 63 	imul   $0x636f7270,0x65(%rbp),%ebp
+  802f51:	20 63 6f             	and    %ah,0x6f(%rbx)
+  802f54:	75 6c                	jne    802fc2 <__rodata_start+0x7a>
+  802f56:	64 20 6e 6f          	and    %ch,%fs:0x6f(%rsi)
+  802f5a:	74 20                	je     802f7c <__rodata_start+0x34>
+  802f5c:	72 65                	jb     802fc3 <__rodata_start+0x7b>
+  802f5e:	61                   	(bad)
+  802f5f:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  802f63:	69 74 69 61 6c 20 70 	imul   $0x7270206c,0x61(%rcx,%rbp,2),%esi
+  802f6a:	72 
+  802f6b:	69 6d 65 3a 20 25 64 	imul   $0x6425203a,0x65(%rbp),%ebp
+  802f72:	2c 20                	sub    $0x20,%al
+  802f74:	25 69 00 75 73       	and    $0x73750069,%eax
+  802f79:	65 72 2f             	gs jb  802fab <__rodata_start+0x63>
+  802f7c:	70 72                	jo     802ff0 <__rodata_start+0xa8>
+  802f7e:	69 6d 65 73 70 69 70 	imul   $0x70697073,0x65(%rbp),%ebp
+  802f85:	65 2e 63 00          	gs movsxd %gs:(%rax),%eax
+  802f89:	25 64 0a 00 70       	and    $0x70000a64,%eax
+  802f8e:	69 70 65 3a 20 25 69 	imul   $0x6925203a,0x65(%rax),%esi
+  802f95:	00 66 6f             	add    %ah,0x6f(%rsi)
+  802f98:	72 6b                	jb     803005 <__rodata_start+0xbd>
+  802f9a:	3a 20                	cmp    (%rax),%ah
+  802f9c:	25 69 00 70 72       	and    $0x72700069,%eax
+  802fa1:	69 6d 65 70 72 6f 63 	imul   $0x636f7270,0x65(%rbp),%ebp
+  802fa8:	20 25 64 20 72 65    	and    %ah,0x65722064(%rip)        # 65f25012 <__bss_end+0x6571d012>
+  802fae:	61                   	(bad)
+  802faf:	64 6e                	outsb  %fs:(%rsi),(%dx)
+  802fb1:	20 25 64 20 25 64    	and    %ah,0x64252064(%rip)        # 64a5501b <__bss_end+0x6424d01b>
+  802fb7:	20 25 69 00 70 72    	and    %ah,0x72700069(%rip)        # 72f03026 <__bss_end+0x726fb026>
+  802fbd:	69 6d 65 70 72 6f 63 	imul   $0x636f7270,0x65(%rbp),%ebp
+  802fc4:	20 25 64 20 77 72    	and    %ah,0x72772064(%rip)        # 72f7502e <__bss_end+0x7276d02e>
+  802fca:	69 74 65 3a 20 25 64 	imul   $0x20642520,0x3a(%rbp,%riz,2),%esi
+  802fd1:	20 
+  802fd2:	25 69 00 70 72       	and    $0x72700069,%eax
+  802fd7:	69 6d 65 73 70 69 70 	imul   $0x70697073,0x65(%rbp),%ebp
+  802fde:	65 00 67 65          	add    %ah,%gs:0x65(%rdi)
+  802fe2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fe3:	65 72 61             	gs jb  803047 <__rodata_start+0xff>
+  802fe6:	74 6f                	je     803057 <__rodata_start+0x10f>
+  802fe8:	72 20                	jb     80300a <__rodata_start+0xc2>
+  802fea:	77 72                	ja     80305e <__rodata_start+0x116>
+  802fec:	69 74 65 3a 20 25 64 	imul   $0x2c642520,0x3a(%rbp,%riz,2),%esi
+  802ff3:	2c 
+  802ff4:	20 25 69 00 3c 75    	and    %ah,0x753c0069(%rip)        # 75bc3063 <__bss_end+0x753bb063>
+  802ffa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ffb:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802fff:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803000:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  803004:	1f                   	(bad)
+  803005:	44 00 00             	add    %r8b,(%rax)
+  803008:	5b                   	pop    %rbx
+  803009:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80300e:	20 75 73             	and    %dh,0x73(%rbp)
+  803011:	65 72 20             	gs jb  803034 <__rodata_start+0xec>
+  803014:	70 61                	jo     803077 <__rodata_start+0x12f>
+  803016:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803017:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80301e:	73 20                	jae    803040 <__rodata_start+0xf8>
+  803020:	61                   	(bad)
+  803021:	74 20                	je     803043 <__rodata_start+0xfb>
+  803023:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803028:	3a 20                	cmp    (%rax),%ah
+  80302a:	00 30                	add    %dh,(%rax)
+  80302c:	31 32                	xor    %esi,(%rdx)
+  80302e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803035:	41                   	rex.B
+  803036:	42                   	rex.X
+  803037:	43                   	rex.XB
+  803038:	44                   	rex.R
+  803039:	45                   	rex.RB
+  80303a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80303d:	31 32                	xor    %esi,(%rdx)
+  80303f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803046:	61                   	(bad)
+  803047:	62 63 64 65 66       	(bad)
+  80304c:	00 28                	add    %ch,(%rax)
+  80304e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80304f:	75 6c                	jne    8030bd <__rodata_start+0x175>
+  803051:	6c                   	insb   (%dx),%es:(%rdi)
+  803052:	29 00                	sub    %eax,(%rax)
+  803054:	65 72 72             	gs jb  8030c9 <__rodata_start+0x181>
+  803057:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803058:	72 20                	jb     80307a <__rodata_start+0x132>
+  80305a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80305f:	73 70                	jae    8030d1 <__rodata_start+0x189>
+  803061:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803065:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80306c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80306d:	72 00                	jb     80306f <__rodata_start+0x127>
+  80306f:	62 61 64 20 65       	(bad)
+  803074:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803075:	76 69                	jbe    8030e0 <__rodata_start+0x198>
+  803077:	72 6f                	jb     8030e8 <__rodata_start+0x1a0>
+  803079:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80307a:	6d                   	insl   (%dx),%es:(%rdi)
+  80307b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80307d:	74 00                	je     80307f <__rodata_start+0x137>
+  80307f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803086:	20 70 61             	and    %dh,0x61(%rax)
+  803089:	72 61                	jb     8030ec <__rodata_start+0x1a4>
+  80308b:	6d                   	insl   (%dx),%es:(%rdi)
+  80308c:	65 74 65             	gs je  8030f4 <__rodata_start+0x1ac>
+  80308f:	72 00                	jb     803091 <__rodata_start+0x149>
+  803091:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803092:	75 74                	jne    803108 <__rodata_start+0x1c0>
+  803094:	20 6f 66             	and    %ch,0x66(%rdi)
+  803097:	20 6d 65             	and    %ch,0x65(%rbp)
+  80309a:	6d                   	insl   (%dx),%es:(%rdi)
+  80309b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80309c:	72 79                	jb     803117 <__rodata_start+0x1cf>
+  80309e:	00 6f 75             	add    %ch,0x75(%rdi)
+  8030a1:	74 20                	je     8030c3 <__rodata_start+0x17b>
+  8030a3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030a4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8030a8:	76 69                	jbe    803113 <__rodata_start+0x1cb>
+  8030aa:	72 6f                	jb     80311b <__rodata_start+0x1d3>
+  8030ac:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030ad:	6d                   	insl   (%dx),%es:(%rdi)
+  8030ae:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030b0:	74 73                	je     803125 <__rodata_start+0x1dd>
+  8030b2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8030b5:	72 72                	jb     803129 <__rodata_start+0x1e1>
+  8030b7:	75 70                	jne    803129 <__rodata_start+0x1e1>
+  8030b9:	74 65                	je     803120 <__rodata_start+0x1d8>
+  8030bb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8030c0:	75 67                	jne    803129 <__rodata_start+0x1e1>
+  8030c2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8030c5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8030c7:	00 73 65             	add    %dh,0x65(%rbx)
+  8030ca:	67 6d                	insl   (%dx),%es:(%edi)
+  8030cc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030ce:	74 61                	je     803131 <__rodata_start+0x1e9>
+  8030d0:	74 69                	je     80313b <__rodata_start+0x1f3>
+  8030d2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030d3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030d4:	20 66 61             	and    %ah,0x61(%rsi)
+  8030d7:	75 6c                	jne    803145 <__rodata_start+0x1fd>
+  8030d9:	74 00                	je     8030db <__rodata_start+0x193>
+  8030db:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8030e2:	20 45 4c             	and    %al,0x4c(%rbp)
+  8030e5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8030e9:	61                   	(bad)
+  8030ea:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8030ef:	20 73 75             	and    %dh,0x75(%rbx)
+  8030f2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8030f5:	73 79                	jae    803170 <__rodata_start+0x228>
+  8030f7:	73 74                	jae    80316d <__rodata_start+0x225>
+  8030f9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8030fb:	20 63 61             	and    %ah,0x61(%rbx)
+  8030fe:	6c                   	insb   (%dx),%es:(%rdi)
+  8030ff:	6c                   	insb   (%dx),%es:(%rdi)
+  803100:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803103:	74 72                	je     803177 <__rodata_start+0x22f>
+  803105:	79 20                	jns    803127 <__rodata_start+0x1df>
+  803107:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803108:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803109:	74 20                	je     80312b <__rodata_start+0x1e3>
+  80310b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80310d:	75 6e                	jne    80317d <__rodata_start+0x235>
+  80310f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803113:	76 20                	jbe    803135 <__rodata_start+0x1ed>
+  803115:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80311c:	72 65                	jb     803183 <__rodata_start+0x23b>
+  80311e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803121:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803122:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803126:	65 78 70             	gs js  803199 <__rodata_start+0x251>
+  803129:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80312e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803131:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803135:	20 66 69             	and    %ah,0x69(%rsi)
+  803138:	6c                   	insb   (%dx),%es:(%rdi)
+  803139:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80313d:	20 66 72             	and    %ah,0x72(%rsi)
+  803140:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803145:	61                   	(bad)
+  803146:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803149:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80314a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80314b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80314f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803152:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803153:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803154:	20 6d 61             	and    %ch,0x61(%rbp)
+  803157:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803158:	79 20                	jns    80317a <__rodata_start+0x232>
+  80315a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803161:	72 65                	jb     8031c8 <__rodata_start+0x280>
+  803163:	20 6f 70             	and    %ch,0x70(%rdi)
+  803166:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803168:	00 66 69             	add    %ah,0x69(%rsi)
+  80316b:	6c                   	insb   (%dx),%es:(%rdi)
+  80316c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803170:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803173:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803174:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803177:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803178:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803179:	74 20                	je     80319b <__rodata_start+0x253>
+  80317b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80317d:	75 6e                	jne    8031ed <__rodata_start+0x2a5>
+  80317f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803183:	76 61                	jbe    8031e6 <__rodata_start+0x29e>
+  803185:	6c                   	insb   (%dx),%es:(%rdi)
+  803186:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80318d:	00 
+  80318e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803195:	72 65                	jb     8031fc <__rodata_start+0x2b4>
+  803197:	61                   	(bad)
+  803198:	64 79 20             	fs jns 8031bb <__rodata_start+0x273>
+  80319b:	65 78 69             	gs js  803207 <__rodata_start+0x2bf>
+  80319e:	73 74                	jae    803214 <__rodata_start+0x2cc>
+  8031a0:	73 00                	jae    8031a2 <__rodata_start+0x25a>
+  8031a2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031a3:	70 65                	jo     80320a <__rodata_start+0x2c2>
+  8031a5:	72 61                	jb     803208 <__rodata_start+0x2c0>
+  8031a7:	74 69                	je     803212 <__rodata_start+0x2ca>
+  8031a9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031aa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031ab:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8031ae:	74 20                	je     8031d0 <__rodata_start+0x288>
+  8031b0:	73 75                	jae    803227 <__rodata_start+0x2df>
+  8031b2:	70 70                	jo     803224 <__rodata_start+0x2dc>
+  8031b4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031b5:	72 74                	jb     80322b <__rodata_start+0x2e3>
+  8031b7:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8031bc:	65 72 61             	gs jb  803220 <__rodata_start+0x2d8>
+  8031bf:	74 69                	je     80322a <__rodata_start+0x2e2>
+  8031c1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031c2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031c3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8031c6:	74 20                	je     8031e8 <__rodata_start+0x2a0>
+  8031c8:	70 65                	jo     80322f <__rodata_start+0x2e7>
+  8031ca:	72 6d                	jb     803239 <__rodata_start+0x2f1>
+  8031cc:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  8031d3:	2e 
+  8031d4:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8031db:	00 
+  8031dc:	0f 1f 40 00          	nopl   0x0(%rax)
+  8031e0:	60                   	(bad)
+  8031e1:	07                   	(bad)
+  8031e2:	80 00 00             	addb   $0x0,(%rax)
+  8031e5:	00 00                	add    %al,(%rax)
+  8031e7:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8031ed:	00 00                	add    %al,(%rax)
+  8031ef:	00 91 0d 80 00 00    	add    %dl,0x800d(%rcx)
+  8031f5:	00 00                	add    %al,(%rax)
+  8031f7:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8031fd:	00 00                	add    %al,(%rax)
+  8031ff:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803205:	00 00                	add    %al,(%rax)
+  803207:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80320d:	00 00                	add    %al,(%rax)
+  80320f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803215:	00 00                	add    %al,(%rax)
+  803217:	00 7f 07             	add    %bh,0x7(%rdi)
+  80321a:	80 00 00             	addb   $0x0,(%rax)
+  80321d:	00 00                	add    %al,(%rax)
+  80321f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803225:	00 00                	add    %al,(%rax)
+  803227:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80322d:	00 00                	add    %al,(%rax)
+  80322f:	00 73 07             	add    %dh,0x7(%rbx)
+  803232:	80 00 00             	addb   $0x0,(%rax)
+  803235:	00 00                	add    %al,(%rax)
+  803237:	00 ed                	add    %ch,%ch
+  803239:	07                   	(bad)
+  80323a:	80 00 00             	addb   $0x0,(%rax)
+  80323d:	00 00                	add    %al,(%rax)
+  80323f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803245:	00 00                	add    %al,(%rax)
+  803247:	00 73 07             	add    %dh,0x7(%rbx)
+  80324a:	80 00 00             	addb   $0x0,(%rax)
+  80324d:	00 00                	add    %al,(%rax)
+  80324f:	00 b9 07 80 00 00    	add    %bh,0x8007(%rcx)
+  803255:	00 00                	add    %al,(%rax)
+  803257:	00 b9 07 80 00 00    	add    %bh,0x8007(%rcx)
+  80325d:	00 00                	add    %al,(%rax)
+  80325f:	00 b9 07 80 00 00    	add    %bh,0x8007(%rcx)
+  803265:	00 00                	add    %al,(%rax)
+  803267:	00 b9 07 80 00 00    	add    %bh,0x8007(%rcx)
+  80326d:	00 00                	add    %al,(%rax)
+  80326f:	00 b9 07 80 00 00    	add    %bh,0x8007(%rcx)
+  803275:	00 00                	add    %al,(%rax)
+  803277:	00 b9 07 80 00 00    	add    %bh,0x8007(%rcx)
+  80327d:	00 00                	add    %al,(%rax)
+  80327f:	00 b9 07 80 00 00    	add    %bh,0x8007(%rcx)
+  803285:	00 00                	add    %al,(%rax)
+  803287:	00 b9 07 80 00 00    	add    %bh,0x8007(%rcx)
+  80328d:	00 00                	add    %al,(%rax)
+  80328f:	00 b9 07 80 00 00    	add    %bh,0x8007(%rcx)
+  803295:	00 00                	add    %al,(%rax)
+  803297:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80329d:	00 00                	add    %al,(%rax)
+  80329f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8032a5:	00 00                	add    %al,(%rax)
+  8032a7:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8032ad:	00 00                	add    %al,(%rax)
+  8032af:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8032b5:	00 00                	add    %al,(%rax)
+  8032b7:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8032bd:	00 00                	add    %al,(%rax)
+  8032bf:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8032c5:	00 00                	add    %al,(%rax)
+  8032c7:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8032cd:	00 00                	add    %al,(%rax)
+  8032cf:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8032d5:	00 00                	add    %al,(%rax)
+  8032d7:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8032dd:	00 00                	add    %al,(%rax)
+  8032df:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8032e5:	00 00                	add    %al,(%rax)
+  8032e7:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8032f5:	00 00                	add    %al,(%rax)
+  8032f7:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803305:	00 00                	add    %al,(%rax)
+  803307:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80330d:	00 00                	add    %al,(%rax)
+  80330f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803315:	00 00                	add    %al,(%rax)
+  803317:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80331d:	00 00                	add    %al,(%rax)
+  80331f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803325:	00 00                	add    %al,(%rax)
+  803327:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803335:	00 00                	add    %al,(%rax)
+  803337:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80333d:	00 00                	add    %al,(%rax)
+  80333f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803345:	00 00                	add    %al,(%rax)
+  803347:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803355:	00 00                	add    %al,(%rax)
+  803357:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80335d:	00 00                	add    %al,(%rax)
+  80335f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803375:	00 00                	add    %al,(%rax)
+  803377:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80337d:	00 00                	add    %al,(%rax)
+  80337f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803385:	00 00                	add    %al,(%rax)
+  803387:	00 c4                	add    %al,%ah
+  803389:	0c 80                	or     $0x80,%al
+  80338b:	00 00                	add    %al,(%rax)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803395:	00 00                	add    %al,(%rax)
+  803397:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80339d:	00 00                	add    %al,(%rax)
+  80339f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8033a5:	00 00                	add    %al,(%rax)
+  8033a7:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8033bd:	00 00                	add    %al,(%rax)
+  8033bf:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8033dd:	00 00                	add    %al,(%rax)
+  8033df:	00 10                	add    %dl,(%rax)
+  8033e1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8033e7:	00 df                	add    %bl,%bh
+  8033e9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8033ef:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8033f5:	00 00                	add    %al,(%rax)
+  8033f7:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  8033fd:	00 00                	add    %al,(%rax)
+  8033ff:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 3f                	add    %bh,(%rdi)
+  803411:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803417:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80341d:	00 00                	add    %al,(%rax)
+  80341f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 05 08 80 00 00    	add    %al,0x8008(%rip)        # 80b435 <__bss_end+0x3435>
+  80342d:	00 00                	add    %al,(%rax)
+  80342f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803435:	00 00                	add    %al,(%rax)
+  803437:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80343d:	00 00                	add    %al,(%rax)
+  80343f:	00 87 0b 80 00 00    	add    %al,0x800b(%rdi)
+  803445:	00 00                	add    %al,(%rax)
+  803447:	00 51 0c             	add    %dl,0xc(%rcx)
+  80344a:	80 00 00             	addb   $0x0,(%rax)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803455:	00 00                	add    %al,(%rax)
+  803457:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80345d:	00 00                	add    %al,(%rax)
+  80345f:	00 d6                	add    %dl,%dh
+  803461:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803467:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80346d:	00 00                	add    %al,(%rax)
+  80346f:	00 b3 0a 80 00 00    	add    %dh,0x800a(%rbx)
+  803475:	00 00                	add    %al,(%rax)
+  803477:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  80347d:	00 00                	add    %al,(%rax)
+  80347f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803485:	00 00                	add    %al,(%rax)
+  803487:	00 c4                	add    %al,%ah
+  803489:	0c 80                	or     $0x80,%al
+  80348b:	00 00                	add    %al,(%rax)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 69 07             	add    %ch,0x7(%rcx)
+  80349a:	80 00 00             	addb   $0x0,(%rax)
+  80349d:	00 00                	add    %al,(%rax)
+	...
+
+00000000008034a0 <error_string>:
+	...
+  8034a8:	5d 30 80 00 00 00 00 00 6f 30 80 00 00 00 00 00     ]0......o0......
+  8034b8:	7f 30 80 00 00 00 00 00 91 30 80 00 00 00 00 00     .0.......0......
+  8034c8:	9f 30 80 00 00 00 00 00 b3 30 80 00 00 00 00 00     .0.......0......
+  8034d8:	c8 30 80 00 00 00 00 00 db 30 80 00 00 00 00 00     .0.......0......
+  8034e8:	ed 30 80 00 00 00 00 00 01 31 80 00 00 00 00 00     .0.......1......
+  8034f8:	11 31 80 00 00 00 00 00 24 31 80 00 00 00 00 00     .1......$1......
+  803508:	3b 31 80 00 00 00 00 00 51 31 80 00 00 00 00 00     ;1......Q1......
+  803518:	69 31 80 00 00 00 00 00 81 31 80 00 00 00 00 00     i1.......1......
+  803528:	8e 31 80 00 00 00 00 00 50 35 80 00 00 00 00 00     .1......P5......
+  803538:	a2 31 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .1..............
+  803548:	ba 31 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .1......file is 
+  803558:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803568:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803578:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803588:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803598:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  8035a8:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  8035b8:	6c 69 62 2f 66 6f 72 6b 2e 63 00 0f 1f 44 00 00     lib/fork.c...D..
+  8035c8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8035d8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8035e8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8035f8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803608:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803618:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803628:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803638:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803648:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803658:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000803660 <devtab>:
+  803660:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803670:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803680:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803690:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8036a0:	70 69 70 65 2e 63 00 90 73 79 73 5f 72 65 67 69     pipe.c..sys_regi
+  8036b0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8036c0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  8036d0:	73 3e 00 63 6f 6e 73 00 69 70 63 5f 73 65 6e 64     s>.cons.ipc_send
+  8036e0:	3a 20 66 61 69 6c 65 64 20 74 6f 20 73 65 6e 64     : failed to send
+  8036f0:	00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84     .lib/ipc.c.f....
+  803700:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803710:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803720:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803730:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803740:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803750:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803760:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803770:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803780:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803790:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803800:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803810:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803820:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803830:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803840:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803850:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803860:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803870:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803880:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803890:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803900:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803910:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803920:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803930:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803940:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803950:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803960:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803970:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803980:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803990:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803aa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ab0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ac0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ad0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ae0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803af0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ba0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803be0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ca0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ce0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
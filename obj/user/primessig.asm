@@ -0,0 +1,6746 @@
+
+obj/user/primessig:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 74 04 00 00       	call   800497 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+volatile sig_atomic_t sender = 0;
+volatile sig_atomic_t updated = 0;
+
+static void
+handler(int signo, siginfo_t * info, void * ctx) {
+    assert(signo == SIGUSR1);
+  800025:	83 ff 0a             	cmp    $0xa,%edi
+  800028:	75 29                	jne    800053 <handler+0x2e>
+    value = info->si_value.sival_int;
+  80002a:	8b 46 18             	mov    0x18(%rsi),%eax
+  80002d:	a3 08 50 80 00 00 00 	movabs %eax,0x805008
+  800034:	00 00 
+    sender = info->si_pid;
+  800036:	8b 46 08             	mov    0x8(%rsi),%eax
+  800039:	a3 04 50 80 00 00 00 	movabs %eax,0x805004
+  800040:	00 00 
+    updated = 1;
+  800042:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800049:	00 00 00 
+  80004c:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+  800052:	c3                   	ret
+handler(int signo, siginfo_t * info, void * ctx) {
+  800053:	55                   	push   %rbp
+  800054:	48 89 e5             	mov    %rsp,%rbp
+    assert(signo == SIGUSR1);
+  800057:	48 b9 e0 35 80 00 00 	movabs $0x8035e0,%rcx
+  80005e:	00 00 00 
+  800061:	48 ba f1 35 80 00 00 	movabs $0x8035f1,%rdx
+  800068:	00 00 00 
+  80006b:	be 14 00 00 00       	mov    $0x14,%esi
+  800070:	48 bf 06 36 80 00 00 	movabs $0x803606,%rdi
+  800077:	00 00 00 
+  80007a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007f:	49 b8 61 05 80 00 00 	movabs $0x800561,%r8
+  800086:	00 00 00 
+  800089:	41 ff d0             	call   *%r8
+
+000000000080008c <sig_recv>:
+}
+
+static int
+sig_recv(envid_t * out) {
+  80008c:	55                   	push   %rbp
+  80008d:	48 89 e5             	mov    %rsp,%rbp
+  800090:	41 55                	push   %r13
+  800092:	41 54                	push   %r12
+  800094:	53                   	push   %rbx
+  800095:	48 83 ec 08          	sub    $0x8,%rsp
+  800099:	49 89 fd             	mov    %rdi,%r13
+    while (!updated) {
+  80009c:	a1 00 50 80 00 00 00 	movabs 0x805000,%eax
+  8000a3:	00 00 
+  8000a5:	85 c0                	test   %eax,%eax
+  8000a7:	75 1d                	jne    8000c6 <sig_recv+0x3a>
+        sys_yield();
+  8000a9:	49 bc f7 14 80 00 00 	movabs $0x8014f7,%r12
+  8000b0:	00 00 00 
+    while (!updated) {
+  8000b3:	48 bb 00 50 80 00 00 	movabs $0x805000,%rbx
+  8000ba:	00 00 00 
+        sys_yield();
+  8000bd:	41 ff d4             	call   *%r12
+    while (!updated) {
+  8000c0:	8b 03                	mov    (%rbx),%eax
+  8000c2:	85 c0                	test   %eax,%eax
+  8000c4:	74 f7                	je     8000bd <sig_recv+0x31>
+    }
+    updated = 0;
+  8000c6:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  8000cd:	00 00 00 
+  8000d0:	c7 02 00 00 00 00    	movl   $0x0,(%rdx)
+    *out = sender;
+  8000d6:	48 b8 04 50 80 00 00 	movabs $0x805004,%rax
+  8000dd:	00 00 00 
+  8000e0:	8b 38                	mov    (%rax),%edi
+  8000e2:	41 89 7d 00          	mov    %edi,0x0(%r13)
+    int res = value;
+  8000e6:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  8000ed:	00 00 00 
+  8000f0:	8b 18                	mov    (%rax),%ebx
+    assert(!updated);
+  8000f2:	8b 02                	mov    (%rdx),%eax
+  8000f4:	85 c0                	test   %eax,%eax
+  8000f6:	75 27                	jne    80011f <sig_recv+0x93>
+    union sigval sv;
+    sv.sival_ptr = 0;
+    // notify sender that we received value
+    if (sigqueue(*out, SIGUSR2, sv))
+  8000f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000fd:	be 0c 00 00 00       	mov    $0xc,%esi
+  800102:	48 b8 22 2e 80 00 00 	movabs $0x802e22,%rax
+  800109:	00 00 00 
+  80010c:	ff d0                	call   *%rax
+  80010e:	85 c0                	test   %eax,%eax
+  800110:	75 42                	jne    800154 <sig_recv+0xc8>
+        panic("sigqueue failed\n");
+    return res;
+}
+  800112:	89 d8                	mov    %ebx,%eax
+  800114:	48 83 c4 08          	add    $0x8,%rsp
+  800118:	5b                   	pop    %rbx
+  800119:	41 5c                	pop    %r12
+  80011b:	41 5d                	pop    %r13
+  80011d:	5d                   	pop    %rbp
+  80011e:	c3                   	ret
+    assert(!updated);
+  80011f:	48 b9 17 36 80 00 00 	movabs $0x803617,%rcx
+  800126:	00 00 00 
+  800129:	48 ba f1 35 80 00 00 	movabs $0x8035f1,%rdx
+  800130:	00 00 00 
+  800133:	be 22 00 00 00       	mov    $0x22,%esi
+  800138:	48 bf 06 36 80 00 00 	movabs $0x803606,%rdi
+  80013f:	00 00 00 
+  800142:	b8 00 00 00 00       	mov    $0x0,%eax
+  800147:	49 b8 61 05 80 00 00 	movabs $0x800561,%r8
+  80014e:	00 00 00 
+  800151:	41 ff d0             	call   *%r8
+        panic("sigqueue failed\n");
+  800154:	48 ba 20 36 80 00 00 	movabs $0x803620,%rdx
+  80015b:	00 00 00 
+  80015e:	be 27 00 00 00       	mov    $0x27,%esi
+  800163:	48 bf 06 36 80 00 00 	movabs $0x803606,%rdi
+  80016a:	00 00 00 
+  80016d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800172:	48 b9 61 05 80 00 00 	movabs $0x800561,%rcx
+  800179:	00 00 00 
+  80017c:	ff d1                	call   *%rcx
+
+000000000080017e <sig_send>:
+
+static void
+sig_send(envid_t id, int value) {
+  80017e:	55                   	push   %rbp
+  80017f:	48 89 e5             	mov    %rsp,%rbp
+  800182:	41 54                	push   %r12
+  800184:	53                   	push   %rbx
+  800185:	48 83 ec 10          	sub    $0x10,%rsp
+  800189:	89 fb                	mov    %edi,%ebx
+    union sigval sv;
+    sv.sival_int = value;
+  80018b:	41 89 f4             	mov    %esi,%r12d
+    sigset_t set = SIGNAL_FLAG(SIGUSR2);
+  80018e:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+    if (sigprocmask(SIG_BLOCK, &set, NULL))
+  800195:	ba 00 00 00 00       	mov    $0x0,%edx
+  80019a:	48 8d 75 ec          	lea    -0x14(%rbp),%rsi
+  80019e:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001a3:	48 b8 9b 2e 80 00 00 	movabs $0x802e9b,%rax
+  8001aa:	00 00 00 
+  8001ad:	ff d0                	call   *%rax
+  8001af:	85 c0                	test   %eax,%eax
+  8001b1:	75 76                	jne    800229 <sig_send+0xab>
+        panic("sigprocmask failed\n");
+    if (sigqueue(id, SIGUSR1, sv))
+  8001b3:	4c 89 e2             	mov    %r12,%rdx
+  8001b6:	be 0a 00 00 00       	mov    $0xa,%esi
+  8001bb:	89 df                	mov    %ebx,%edi
+  8001bd:	48 b8 22 2e 80 00 00 	movabs $0x802e22,%rax
+  8001c4:	00 00 00 
+  8001c7:	ff d0                	call   *%rax
+  8001c9:	85 c0                	test   %eax,%eax
+  8001cb:	0f 85 82 00 00 00    	jne    800253 <sig_send+0xd5>
+        panic("sigqueue failed\n");
+    // ensure signal is processed before sending the next one
+    int sig = 0;
+  8001d1:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+    if (sigwait(&set, &sig))
+  8001d8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8001dc:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8001e0:	48 b8 34 2e 80 00 00 	movabs $0x802e34,%rax
+  8001e7:	00 00 00 
+  8001ea:	ff d0                	call   *%rax
+  8001ec:	85 c0                	test   %eax,%eax
+  8001ee:	0f 85 89 00 00 00    	jne    80027d <sig_send+0xff>
+        panic("sigwait failed\n");
+    if (sigprocmask(SIG_UNBLOCK, &set, NULL))
+  8001f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f9:	48 8d 75 ec          	lea    -0x14(%rbp),%rsi
+  8001fd:	bf 02 00 00 00       	mov    $0x2,%edi
+  800202:	48 b8 9b 2e 80 00 00 	movabs $0x802e9b,%rax
+  800209:	00 00 00 
+  80020c:	ff d0                	call   *%rax
+  80020e:	85 c0                	test   %eax,%eax
+  800210:	0f 85 91 00 00 00    	jne    8002a7 <sig_send+0x129>
+        panic("sigprocmask failed\n");
+    assert(sig == SIGUSR2);
+  800216:	83 7d e8 0c          	cmpl   $0xc,-0x18(%rbp)
+  80021a:	0f 85 b1 00 00 00    	jne    8002d1 <sig_send+0x153>
+}
+  800220:	48 83 c4 10          	add    $0x10,%rsp
+  800224:	5b                   	pop    %rbx
+  800225:	41 5c                	pop    %r12
+  800227:	5d                   	pop    %rbp
+  800228:	c3                   	ret
+        panic("sigprocmask failed\n");
+  800229:	48 ba 31 36 80 00 00 	movabs $0x803631,%rdx
+  800230:	00 00 00 
+  800233:	be 31 00 00 00       	mov    $0x31,%esi
+  800238:	48 bf 06 36 80 00 00 	movabs $0x803606,%rdi
+  80023f:	00 00 00 
+  800242:	b8 00 00 00 00       	mov    $0x0,%eax
+  800247:	48 b9 61 05 80 00 00 	movabs $0x800561,%rcx
+  80024e:	00 00 00 
+  800251:	ff d1                	call   *%rcx
+        panic("sigqueue failed\n");
+  800253:	48 ba 20 36 80 00 00 	movabs $0x803620,%rdx
+  80025a:	00 00 00 
+  80025d:	be 33 00 00 00       	mov    $0x33,%esi
+  800262:	48 bf 06 36 80 00 00 	movabs $0x803606,%rdi
+  800269:	00 00 00 
+  80026c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800271:	48 b9 61 05 80 00 00 	movabs $0x800561,%rcx
+  800278:	00 00 00 
+  80027b:	ff d1                	call   *%rcx
+        panic("sigwait failed\n");
+  80027d:	48 ba 45 36 80 00 00 	movabs $0x803645,%rdx
+  800284:	00 00 00 
+  800287:	be 37 00 00 00       	mov    $0x37,%esi
+  80028c:	48 bf 06 36 80 00 00 	movabs $0x803606,%rdi
+  800293:	00 00 00 
+  800296:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029b:	48 b9 61 05 80 00 00 	movabs $0x800561,%rcx
+  8002a2:	00 00 00 
+  8002a5:	ff d1                	call   *%rcx
+        panic("sigprocmask failed\n");
+  8002a7:	48 ba 31 36 80 00 00 	movabs $0x803631,%rdx
+  8002ae:	00 00 00 
+  8002b1:	be 39 00 00 00       	mov    $0x39,%esi
+  8002b6:	48 bf 06 36 80 00 00 	movabs $0x803606,%rdi
+  8002bd:	00 00 00 
+  8002c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c5:	48 b9 61 05 80 00 00 	movabs $0x800561,%rcx
+  8002cc:	00 00 00 
+  8002cf:	ff d1                	call   *%rcx
+    assert(sig == SIGUSR2);
+  8002d1:	48 b9 55 36 80 00 00 	movabs $0x803655,%rcx
+  8002d8:	00 00 00 
+  8002db:	48 ba f1 35 80 00 00 	movabs $0x8035f1,%rdx
+  8002e2:	00 00 00 
+  8002e5:	be 3a 00 00 00       	mov    $0x3a,%esi
+  8002ea:	48 bf 06 36 80 00 00 	movabs $0x803606,%rdi
+  8002f1:	00 00 00 
+  8002f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f9:	49 b8 61 05 80 00 00 	movabs $0x800561,%r8
+  800300:	00 00 00 
+  800303:	41 ff d0             	call   *%r8
+
+0000000000800306 <primeproc>:
+
+unsigned
+primeproc(void) {
+  800306:	55                   	push   %rbp
+  800307:	48 89 e5             	mov    %rsp,%rbp
+  80030a:	41 57                	push   %r15
+  80030c:	41 56                	push   %r14
+  80030e:	41 55                	push   %r13
+  800310:	41 54                	push   %r12
+  800312:	53                   	push   %rbx
+  800313:	48 83 ec 18          	sub    $0x18,%rsp
+    int i, id, p;
+    envid_t envid;
+
+    /* Fetch a prime from our left neighbor */
+top:
+    p = sig_recv(&envid);
+  800317:	49 bf 8c 00 80 00 00 	movabs $0x80008c,%r15
+  80031e:	00 00 00 
+    cprintf("%d ", p);
+  800321:	49 be b1 06 80 00 00 	movabs $0x8006b1,%r14
+  800328:	00 00 00 
+
+    /* Fork a right neighbor to continue the chain */
+    if ((id = fork()) < 0)
+  80032b:	49 bd 28 1b 80 00 00 	movabs $0x801b28,%r13
+  800332:	00 00 00 
+    p = sig_recv(&envid);
+  800335:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  800339:	41 ff d7             	call   *%r15
+  80033c:	89 c3                	mov    %eax,%ebx
+    cprintf("%d ", p);
+  80033e:	89 c6                	mov    %eax,%esi
+  800340:	48 bf 64 36 80 00 00 	movabs $0x803664,%rdi
+  800347:	00 00 00 
+  80034a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034f:	41 ff d6             	call   *%r14
+    if ((id = fork()) < 0)
+  800352:	41 ff d5             	call   *%r13
+  800355:	41 89 c4             	mov    %eax,%r12d
+  800358:	85 c0                	test   %eax,%eax
+  80035a:	78 2e                	js     80038a <primeproc+0x84>
+        panic("fork: %i", id);
+    if (id == 0)
+  80035c:	74 d7                	je     800335 <primeproc+0x2f>
+        goto top;
+
+    /* Filter out multiples of our prime */
+    while (1) {
+        i = sig_recv(&envid);
+  80035e:	49 bd 8c 00 80 00 00 	movabs $0x80008c,%r13
+  800365:	00 00 00 
+        if (i % p)
+            sig_send(id, i);
+  800368:	49 be 7e 01 80 00 00 	movabs $0x80017e,%r14
+  80036f:	00 00 00 
+        i = sig_recv(&envid);
+  800372:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  800376:	41 ff d5             	call   *%r13
+  800379:	89 c6                	mov    %eax,%esi
+        if (i % p)
+  80037b:	99                   	cltd
+  80037c:	f7 fb                	idiv   %ebx
+  80037e:	85 d2                	test   %edx,%edx
+  800380:	74 f0                	je     800372 <primeproc+0x6c>
+            sig_send(id, i);
+  800382:	44 89 e7             	mov    %r12d,%edi
+  800385:	41 ff d6             	call   *%r14
+  800388:	eb e8                	jmp    800372 <primeproc+0x6c>
+        panic("fork: %i", id);
+  80038a:	89 c1                	mov    %eax,%ecx
+  80038c:	48 ba 68 36 80 00 00 	movabs $0x803668,%rdx
+  800393:	00 00 00 
+  800396:	be 49 00 00 00       	mov    $0x49,%esi
+  80039b:	48 bf 06 36 80 00 00 	movabs $0x803606,%rdi
+  8003a2:	00 00 00 
+  8003a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003aa:	49 b8 61 05 80 00 00 	movabs $0x800561,%r8
+  8003b1:	00 00 00 
+  8003b4:	41 ff d0             	call   *%r8
+
+00000000008003b7 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  8003b7:	55                   	push   %rbp
+  8003b8:	48 89 e5             	mov    %rsp,%rbp
+  8003bb:	41 55                	push   %r13
+  8003bd:	41 54                	push   %r12
+  8003bf:	53                   	push   %rbx
+  8003c0:	48 83 ec 18          	sub    $0x18,%rsp
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+  8003c4:	ba 10 00 00 00       	mov    $0x10,%edx
+  8003c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8003ce:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8003d2:	48 bb 22 11 80 00 00 	movabs $0x801122,%rbx
+  8003d9:	00 00 00 
+  8003dc:	ff d3                	call   *%rbx
+    memset(&sa, 0, sizeof(sa));
+  8003de:	ba 10 00 00 00       	mov    $0x10,%edx
+  8003e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e8:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8003ec:	ff d3                	call   *%rbx
+    sa.sa_sigaction = handler;
+  8003ee:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8003f5:	00 00 00 
+  8003f8:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    sa.sa_flags = SA_SIGINFO;
+  8003fc:	c7 45 dc 04 00 00 00 	movl   $0x4,-0x24(%rbp)
+    sigaction(SIGUSR1, &sa, NULL);
+  800403:	ba 00 00 00 00       	mov    $0x0,%edx
+  800408:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80040c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800411:	48 bb 46 2e 80 00 00 	movabs $0x802e46,%rbx
+  800418:	00 00 00 
+  80041b:	ff d3                	call   *%rbx
+    sigaction(SIGUSR2, &sa, NULL);
+  80041d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800422:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800426:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80042b:	ff d3                	call   *%rbx
+
+    int id;
+
+    /* Fork the first prime process in the chain */
+    if ((id = fork()) < 0)
+  80042d:	48 b8 28 1b 80 00 00 	movabs $0x801b28,%rax
+  800434:	00 00 00 
+  800437:	ff d0                	call   *%rax
+  800439:	41 89 c4             	mov    %eax,%r12d
+  80043c:	85 c0                	test   %eax,%eax
+  80043e:	78 1e                	js     80045e <umain+0xa7>
+        panic("fork: %i", id);
+    if (id == 0)
+        primeproc();
+
+    /* Feed all the integers through */
+    for (int i = 2;; i++)
+  800440:	bb 02 00 00 00       	mov    $0x2,%ebx
+        sig_send(id, i);
+  800445:	49 bd 7e 01 80 00 00 	movabs $0x80017e,%r13
+  80044c:	00 00 00 
+    if (id == 0)
+  80044f:	74 3a                	je     80048b <umain+0xd4>
+        sig_send(id, i);
+  800451:	89 de                	mov    %ebx,%esi
+  800453:	44 89 e7             	mov    %r12d,%edi
+  800456:	41 ff d5             	call   *%r13
+    for (int i = 2;; i++)
+  800459:	83 c3 01             	add    $0x1,%ebx
+  80045c:	eb f3                	jmp    800451 <umain+0x9a>
+        panic("fork: %i", id);
+  80045e:	89 c1                	mov    %eax,%ecx
+  800460:	48 ba 68 36 80 00 00 	movabs $0x803668,%rdx
+  800467:	00 00 00 
+  80046a:	be 64 00 00 00       	mov    $0x64,%esi
+  80046f:	48 bf 06 36 80 00 00 	movabs $0x803606,%rdi
+  800476:	00 00 00 
+  800479:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047e:	49 b8 61 05 80 00 00 	movabs $0x800561,%r8
+  800485:	00 00 00 
+  800488:	41 ff d0             	call   *%r8
+        primeproc();
+  80048b:	48 b8 06 03 80 00 00 	movabs $0x800306,%rax
+  800492:	00 00 00 
+  800495:	ff d0                	call   *%rax
+
+0000000000800497 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800497:	55                   	push   %rbp
+  800498:	48 89 e5             	mov    %rsp,%rbp
+  80049b:	41 56                	push   %r14
+  80049d:	41 55                	push   %r13
+  80049f:	41 54                	push   %r12
+  8004a1:	53                   	push   %rbx
+  8004a2:	41 89 fd             	mov    %edi,%r13d
+  8004a5:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8004a8:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8004af:	00 00 00 
+  8004b2:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8004b9:	00 00 00 
+  8004bc:	48 39 c2             	cmp    %rax,%rdx
+  8004bf:	73 17                	jae    8004d8 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8004c1:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8004c4:	49 89 c4             	mov    %rax,%r12
+  8004c7:	48 83 c3 08          	add    $0x8,%rbx
+  8004cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d0:	ff 53 f8             	call   *-0x8(%rbx)
+  8004d3:	4c 39 e3             	cmp    %r12,%rbx
+  8004d6:	72 ef                	jb     8004c7 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8004d8:	48 b8 c6 14 80 00 00 	movabs $0x8014c6,%rax
+  8004df:	00 00 00 
+  8004e2:	ff d0                	call   *%rax
+  8004e4:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8004e7:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8004ee:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8004f5:	00 00 00 
+  8004f8:	48 01 d0             	add    %rdx,%rax
+  8004fb:	48 a3 10 50 80 00 00 	movabs %rax,0x805010
+  800502:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800505:	45 85 ed             	test   %r13d,%r13d
+  800508:	7e 0d                	jle    800517 <libmain+0x80>
+  80050a:	49 8b 06             	mov    (%r14),%rax
+  80050d:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800514:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800517:	4c 89 f6             	mov    %r14,%rsi
+  80051a:	44 89 ef             	mov    %r13d,%edi
+  80051d:	48 b8 b7 03 80 00 00 	movabs $0x8003b7,%rax
+  800524:	00 00 00 
+  800527:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800529:	48 b8 3e 05 80 00 00 	movabs $0x80053e,%rax
+  800530:	00 00 00 
+  800533:	ff d0                	call   *%rax
+#endif
+}
+  800535:	5b                   	pop    %rbx
+  800536:	41 5c                	pop    %r12
+  800538:	41 5d                	pop    %r13
+  80053a:	41 5e                	pop    %r14
+  80053c:	5d                   	pop    %rbp
+  80053d:	c3                   	ret
+
+000000000080053e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80053e:	55                   	push   %rbp
+  80053f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800542:	48 b8 4e 1e 80 00 00 	movabs $0x801e4e,%rax
+  800549:	00 00 00 
+  80054c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80054e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800553:	48 b8 5b 14 80 00 00 	movabs $0x80145b,%rax
+  80055a:	00 00 00 
+  80055d:	ff d0                	call   *%rax
+}
+  80055f:	5d                   	pop    %rbp
+  800560:	c3                   	ret
+
+0000000000800561 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800561:	55                   	push   %rbp
+  800562:	48 89 e5             	mov    %rsp,%rbp
+  800565:	41 56                	push   %r14
+  800567:	41 55                	push   %r13
+  800569:	41 54                	push   %r12
+  80056b:	53                   	push   %rbx
+  80056c:	48 83 ec 50          	sub    $0x50,%rsp
+  800570:	49 89 fc             	mov    %rdi,%r12
+  800573:	41 89 f5             	mov    %esi,%r13d
+  800576:	48 89 d3             	mov    %rdx,%rbx
+  800579:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80057d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800581:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800585:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80058c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800590:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800594:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800598:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80059c:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8005a3:	00 00 00 
+  8005a6:	4c 8b 30             	mov    (%rax),%r14
+  8005a9:	48 b8 c6 14 80 00 00 	movabs $0x8014c6,%rax
+  8005b0:	00 00 00 
+  8005b3:	ff d0                	call   *%rax
+  8005b5:	89 c6                	mov    %eax,%esi
+  8005b7:	45 89 e8             	mov    %r13d,%r8d
+  8005ba:	4c 89 e1             	mov    %r12,%rcx
+  8005bd:	4c 89 f2             	mov    %r14,%rdx
+  8005c0:	48 bf 80 36 80 00 00 	movabs $0x803680,%rdi
+  8005c7:	00 00 00 
+  8005ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005cf:	49 bc b1 06 80 00 00 	movabs $0x8006b1,%r12
+  8005d6:	00 00 00 
+  8005d9:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8005dc:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8005e0:	48 89 df             	mov    %rbx,%rdi
+  8005e3:	48 b8 4d 06 80 00 00 	movabs $0x80064d,%rax
+  8005ea:	00 00 00 
+  8005ed:	ff d0                	call   *%rax
+    cprintf("\n");
+  8005ef:	48 bf 2f 36 80 00 00 	movabs $0x80362f,%rdi
+  8005f6:	00 00 00 
+  8005f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005fe:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800601:	cc                   	int3
+  800602:	eb fd                	jmp    800601 <_panic+0xa0>
+
+0000000000800604 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800604:	55                   	push   %rbp
+  800605:	48 89 e5             	mov    %rsp,%rbp
+  800608:	53                   	push   %rbx
+  800609:	48 83 ec 08          	sub    $0x8,%rsp
+  80060d:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800610:	8b 06                	mov    (%rsi),%eax
+  800612:	8d 50 01             	lea    0x1(%rax),%edx
+  800615:	89 16                	mov    %edx,(%rsi)
+  800617:	48 98                	cltq
+  800619:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80061e:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800624:	74 0a                	je     800630 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800626:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80062a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80062e:	c9                   	leave
+  80062f:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800630:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800634:	be ff 00 00 00       	mov    $0xff,%esi
+  800639:	48 b8 fd 13 80 00 00 	movabs $0x8013fd,%rax
+  800640:	00 00 00 
+  800643:	ff d0                	call   *%rax
+        state->offset = 0;
+  800645:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80064b:	eb d9                	jmp    800626 <putch+0x22>
+
+000000000080064d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80064d:	55                   	push   %rbp
+  80064e:	48 89 e5             	mov    %rsp,%rbp
+  800651:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800658:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80065b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800662:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800667:	b8 00 00 00 00       	mov    $0x0,%eax
+  80066c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80066f:	48 89 f1             	mov    %rsi,%rcx
+  800672:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800679:	48 bf 04 06 80 00 00 	movabs $0x800604,%rdi
+  800680:	00 00 00 
+  800683:	48 b8 01 08 80 00 00 	movabs $0x800801,%rax
+  80068a:	00 00 00 
+  80068d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80068f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800696:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80069d:	48 b8 fd 13 80 00 00 	movabs $0x8013fd,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8006a9:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8006af:	c9                   	leave
+  8006b0:	c3                   	ret
+
+00000000008006b1 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8006b1:	55                   	push   %rbp
+  8006b2:	48 89 e5             	mov    %rsp,%rbp
+  8006b5:	48 83 ec 50          	sub    $0x50,%rsp
+  8006b9:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8006bd:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8006c1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006c5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006c9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8006cd:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8006d4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006dc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006e0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8006e4:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8006e8:	48 b8 4d 06 80 00 00 	movabs $0x80064d,%rax
+  8006ef:	00 00 00 
+  8006f2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8006f4:	c9                   	leave
+  8006f5:	c3                   	ret
+
+00000000008006f6 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8006f6:	55                   	push   %rbp
+  8006f7:	48 89 e5             	mov    %rsp,%rbp
+  8006fa:	41 57                	push   %r15
+  8006fc:	41 56                	push   %r14
+  8006fe:	41 55                	push   %r13
+  800700:	41 54                	push   %r12
+  800702:	53                   	push   %rbx
+  800703:	48 83 ec 18          	sub    $0x18,%rsp
+  800707:	49 89 fc             	mov    %rdi,%r12
+  80070a:	49 89 f5             	mov    %rsi,%r13
+  80070d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800711:	8b 45 10             	mov    0x10(%rbp),%eax
+  800714:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800717:	41 89 cf             	mov    %ecx,%r15d
+  80071a:	4c 39 fa             	cmp    %r15,%rdx
+  80071d:	73 5b                	jae    80077a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80071f:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800723:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800727:	85 db                	test   %ebx,%ebx
+  800729:	7e 0e                	jle    800739 <print_num+0x43>
+            putch(padc, put_arg);
+  80072b:	4c 89 ee             	mov    %r13,%rsi
+  80072e:	44 89 f7             	mov    %r14d,%edi
+  800731:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800734:	83 eb 01             	sub    $0x1,%ebx
+  800737:	75 f2                	jne    80072b <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800739:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80073d:	48 b9 b4 36 80 00 00 	movabs $0x8036b4,%rcx
+  800744:	00 00 00 
+  800747:	48 b8 a3 36 80 00 00 	movabs $0x8036a3,%rax
+  80074e:	00 00 00 
+  800751:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800755:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800759:	ba 00 00 00 00       	mov    $0x0,%edx
+  80075e:	49 f7 f7             	div    %r15
+  800761:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800765:	4c 89 ee             	mov    %r13,%rsi
+  800768:	41 ff d4             	call   *%r12
+}
+  80076b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80076f:	5b                   	pop    %rbx
+  800770:	41 5c                	pop    %r12
+  800772:	41 5d                	pop    %r13
+  800774:	41 5e                	pop    %r14
+  800776:	41 5f                	pop    %r15
+  800778:	5d                   	pop    %rbp
+  800779:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80077a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80077e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800783:	49 f7 f7             	div    %r15
+  800786:	48 83 ec 08          	sub    $0x8,%rsp
+  80078a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80078e:	52                   	push   %rdx
+  80078f:	45 0f be c9          	movsbl %r9b,%r9d
+  800793:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800797:	48 89 c2             	mov    %rax,%rdx
+  80079a:	48 b8 f6 06 80 00 00 	movabs $0x8006f6,%rax
+  8007a1:	00 00 00 
+  8007a4:	ff d0                	call   *%rax
+  8007a6:	48 83 c4 10          	add    $0x10,%rsp
+  8007aa:	eb 8d                	jmp    800739 <print_num+0x43>
+
+00000000008007ac <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8007ac:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8007b0:	48 8b 06             	mov    (%rsi),%rax
+  8007b3:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8007b7:	73 0a                	jae    8007c3 <sprintputch+0x17>
+        *state->start++ = ch;
+  8007b9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8007bd:	48 89 16             	mov    %rdx,(%rsi)
+  8007c0:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8007c3:	c3                   	ret
+
+00000000008007c4 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8007c4:	55                   	push   %rbp
+  8007c5:	48 89 e5             	mov    %rsp,%rbp
+  8007c8:	48 83 ec 50          	sub    $0x50,%rsp
+  8007cc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8007d0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8007d4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8007d8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8007df:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8007eb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8007ef:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8007f3:	48 b8 01 08 80 00 00 	movabs $0x800801,%rax
+  8007fa:	00 00 00 
+  8007fd:	ff d0                	call   *%rax
+}
+  8007ff:	c9                   	leave
+  800800:	c3                   	ret
+
+0000000000800801 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800801:	55                   	push   %rbp
+  800802:	48 89 e5             	mov    %rsp,%rbp
+  800805:	41 57                	push   %r15
+  800807:	41 56                	push   %r14
+  800809:	41 55                	push   %r13
+  80080b:	41 54                	push   %r12
+  80080d:	53                   	push   %rbx
+  80080e:	48 83 ec 38          	sub    $0x38,%rsp
+  800812:	49 89 fe             	mov    %rdi,%r14
+  800815:	49 89 f5             	mov    %rsi,%r13
+  800818:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80081b:	48 8b 01             	mov    (%rcx),%rax
+  80081e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800822:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800826:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80082a:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80082e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800832:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800836:	0f b6 3b             	movzbl (%rbx),%edi
+  800839:	40 80 ff 25          	cmp    $0x25,%dil
+  80083d:	74 18                	je     800857 <vprintfmt+0x56>
+            if (!ch) return;
+  80083f:	40 84 ff             	test   %dil,%dil
+  800842:	0f 84 b1 06 00 00    	je     800ef9 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800848:	40 0f b6 ff          	movzbl %dil,%edi
+  80084c:	4c 89 ee             	mov    %r13,%rsi
+  80084f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800852:	4c 89 e3             	mov    %r12,%rbx
+  800855:	eb db                	jmp    800832 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800857:	be 00 00 00 00       	mov    $0x0,%esi
+  80085c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800860:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800865:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80086b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800872:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800876:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80087b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800880:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800883:	83 e8 23             	sub    $0x23,%eax
+  800886:	3c 57                	cmp    $0x57,%al
+  800888:	0f 87 51 06 00 00    	ja     800edf <vprintfmt+0x6de>
+  80088e:	0f b6 c0             	movzbl %al,%eax
+  800891:	48 b9 60 38 80 00 00 	movabs $0x803860,%rcx
+  800898:	00 00 00 
+  80089b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80089e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8008a1:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8008a5:	eb cf                	jmp    800876 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8008a7:	49 89 dc             	mov    %rbx,%r12
+  8008aa:	be 01 00 00 00       	mov    $0x1,%esi
+  8008af:	eb c5                	jmp    800876 <vprintfmt+0x75>
+            padc = ch;
+  8008b1:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8008b5:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8008b8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008bb:	eb b9                	jmp    800876 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8008bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c3:	77 24                	ja     8008e9 <vprintfmt+0xe8>
+  8008c5:	89 c1                	mov    %eax,%ecx
+  8008c7:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8008cb:	83 c0 08             	add    $0x8,%eax
+  8008ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d1:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8008d4:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8008d7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008db:	79 99                	jns    800876 <vprintfmt+0x75>
+                width = precision;
+  8008dd:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8008e1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8008e7:	eb 8d                	jmp    800876 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8008e9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8008ed:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8008f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f5:	eb da                	jmp    8008d1 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8008f7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8008fc:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800900:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800906:	3c 39                	cmp    $0x39,%al
+  800908:	77 1c                	ja     800926 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80090a:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80090e:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800912:	0f b6 c0             	movzbl %al,%eax
+  800915:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80091a:	0f b6 03             	movzbl (%rbx),%eax
+  80091d:	3c 39                	cmp    $0x39,%al
+  80091f:	76 e9                	jbe    80090a <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800921:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800924:	eb b1                	jmp    8008d7 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800926:	49 89 dc             	mov    %rbx,%r12
+  800929:	eb ac                	jmp    8008d7 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80092b:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80092e:	85 c9                	test   %ecx,%ecx
+  800930:	b8 00 00 00 00       	mov    $0x0,%eax
+  800935:	0f 49 c1             	cmovns %ecx,%eax
+  800938:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80093b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80093e:	e9 33 ff ff ff       	jmp    800876 <vprintfmt+0x75>
+            lflag++;
+  800943:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800946:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800949:	e9 28 ff ff ff       	jmp    800876 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80094e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800951:	83 f8 2f             	cmp    $0x2f,%eax
+  800954:	77 19                	ja     80096f <vprintfmt+0x16e>
+  800956:	89 c2                	mov    %eax,%edx
+  800958:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095c:	83 c0 08             	add    $0x8,%eax
+  80095f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800962:	8b 3a                	mov    (%rdx),%edi
+  800964:	4c 89 ee             	mov    %r13,%rsi
+  800967:	41 ff d6             	call   *%r14
+            break;
+  80096a:	e9 c3 fe ff ff       	jmp    800832 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80096f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800973:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800977:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097b:	eb e5                	jmp    800962 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80097d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800980:	83 f8 2f             	cmp    $0x2f,%eax
+  800983:	77 5a                	ja     8009df <vprintfmt+0x1de>
+  800985:	89 c2                	mov    %eax,%edx
+  800987:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098b:	83 c0 08             	add    $0x8,%eax
+  80098e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800991:	8b 02                	mov    (%rdx),%eax
+  800993:	89 c1                	mov    %eax,%ecx
+  800995:	f7 d9                	neg    %ecx
+  800997:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80099a:	83 f9 15             	cmp    $0x15,%ecx
+  80099d:	7f 4e                	jg     8009ed <vprintfmt+0x1ec>
+  80099f:	48 63 c1             	movslq %ecx,%rax
+  8009a2:	48 ba 20 3b 80 00 00 	movabs $0x803b20,%rdx
+  8009a9:	00 00 00 
+  8009ac:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8009b0:	48 85 c0             	test   %rax,%rax
+  8009b3:	74 38                	je     8009ed <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8009b5:	48 89 c1             	mov    %rax,%rcx
+  8009b8:	48 ba 03 36 80 00 00 	movabs $0x803603,%rdx
+  8009bf:	00 00 00 
+  8009c2:	4c 89 ee             	mov    %r13,%rsi
+  8009c5:	4c 89 f7             	mov    %r14,%rdi
+  8009c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009cd:	49 b8 c4 07 80 00 00 	movabs $0x8007c4,%r8
+  8009d4:	00 00 00 
+  8009d7:	41 ff d0             	call   *%r8
+  8009da:	e9 53 fe ff ff       	jmp    800832 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8009df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009eb:	eb a4                	jmp    800991 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8009ed:	48 ba cc 36 80 00 00 	movabs $0x8036cc,%rdx
+  8009f4:	00 00 00 
+  8009f7:	4c 89 ee             	mov    %r13,%rsi
+  8009fa:	4c 89 f7             	mov    %r14,%rdi
+  8009fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a02:	49 b8 c4 07 80 00 00 	movabs $0x8007c4,%r8
+  800a09:	00 00 00 
+  800a0c:	41 ff d0             	call   *%r8
+  800a0f:	e9 1e fe ff ff       	jmp    800832 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a17:	83 f8 2f             	cmp    $0x2f,%eax
+  800a1a:	77 6c                	ja     800a88 <vprintfmt+0x287>
+  800a1c:	89 c2                	mov    %eax,%edx
+  800a1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a22:	83 c0 08             	add    $0x8,%eax
+  800a25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a28:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800a2b:	48 85 d2             	test   %rdx,%rdx
+  800a2e:	48 b8 c5 36 80 00 00 	movabs $0x8036c5,%rax
+  800a35:	00 00 00 
+  800a38:	48 0f 45 c2          	cmovne %rdx,%rax
+  800a3c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800a40:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800a44:	7e 06                	jle    800a4c <vprintfmt+0x24b>
+  800a46:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800a4a:	75 4a                	jne    800a96 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a4c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a50:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800a54:	0f b6 00             	movzbl (%rax),%eax
+  800a57:	84 c0                	test   %al,%al
+  800a59:	0f 85 9a 00 00 00    	jne    800af9 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800a5f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a62:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800a66:	85 c0                	test   %eax,%eax
+  800a68:	0f 8e c4 fd ff ff    	jle    800832 <vprintfmt+0x31>
+  800a6e:	4c 89 ee             	mov    %r13,%rsi
+  800a71:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a76:	41 ff d6             	call   *%r14
+  800a79:	41 83 ec 01          	sub    $0x1,%r12d
+  800a7d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800a81:	75 eb                	jne    800a6e <vprintfmt+0x26d>
+  800a83:	e9 aa fd ff ff       	jmp    800832 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a94:	eb 92                	jmp    800a28 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800a96:	49 63 f7             	movslq %r15d,%rsi
+  800a99:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800a9d:	48 b8 b3 0f 80 00 00 	movabs $0x800fb3,%rax
+  800aa4:	00 00 00 
+  800aa7:	ff d0                	call   *%rax
+  800aa9:	48 89 c2             	mov    %rax,%rdx
+  800aac:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800aaf:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800ab1:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800ab4:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800ab7:	85 c0                	test   %eax,%eax
+  800ab9:	7e 91                	jle    800a4c <vprintfmt+0x24b>
+  800abb:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800ac0:	4c 89 ee             	mov    %r13,%rsi
+  800ac3:	44 89 e7             	mov    %r12d,%edi
+  800ac6:	41 ff d6             	call   *%r14
+  800ac9:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800acd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800ad0:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800ad3:	75 eb                	jne    800ac0 <vprintfmt+0x2bf>
+  800ad5:	e9 72 ff ff ff       	jmp    800a4c <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800ada:	0f b6 f8             	movzbl %al,%edi
+  800add:	4c 89 ee             	mov    %r13,%rsi
+  800ae0:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800ae3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800ae7:	49 83 c4 01          	add    $0x1,%r12
+  800aeb:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800af1:	84 c0                	test   %al,%al
+  800af3:	0f 84 66 ff ff ff    	je     800a5f <vprintfmt+0x25e>
+  800af9:	45 85 ff             	test   %r15d,%r15d
+  800afc:	78 0a                	js     800b08 <vprintfmt+0x307>
+  800afe:	41 83 ef 01          	sub    $0x1,%r15d
+  800b02:	0f 88 57 ff ff ff    	js     800a5f <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800b08:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800b0c:	74 cc                	je     800ada <vprintfmt+0x2d9>
+  800b0e:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800b11:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b16:	80 fa 5e             	cmp    $0x5e,%dl
+  800b19:	77 c2                	ja     800add <vprintfmt+0x2dc>
+  800b1b:	eb bd                	jmp    800ada <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800b1d:	40 84 f6             	test   %sil,%sil
+  800b20:	75 26                	jne    800b48 <vprintfmt+0x347>
+    switch (lflag) {
+  800b22:	85 d2                	test   %edx,%edx
+  800b24:	74 59                	je     800b7f <vprintfmt+0x37e>
+  800b26:	83 fa 01             	cmp    $0x1,%edx
+  800b29:	74 7b                	je     800ba6 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800b2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b31:	0f 87 96 00 00 00    	ja     800bcd <vprintfmt+0x3cc>
+  800b37:	89 c2                	mov    %eax,%edx
+  800b39:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3d:	83 c0 08             	add    $0x8,%eax
+  800b40:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b43:	4c 8b 22             	mov    (%rdx),%r12
+  800b46:	eb 17                	jmp    800b5f <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800b48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b4e:	77 21                	ja     800b71 <vprintfmt+0x370>
+  800b50:	89 c2                	mov    %eax,%edx
+  800b52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b56:	83 c0 08             	add    $0x8,%eax
+  800b59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b5c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800b5f:	4d 85 e4             	test   %r12,%r12
+  800b62:	78 7a                	js     800bde <vprintfmt+0x3dd>
+            num = i;
+  800b64:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800b67:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800b6c:	e9 50 02 00 00       	jmp    800dc1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b75:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7d:	eb dd                	jmp    800b5c <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800b7f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b82:	83 f8 2f             	cmp    $0x2f,%eax
+  800b85:	77 11                	ja     800b98 <vprintfmt+0x397>
+  800b87:	89 c2                	mov    %eax,%edx
+  800b89:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b8d:	83 c0 08             	add    $0x8,%eax
+  800b90:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b93:	4c 63 22             	movslq (%rdx),%r12
+  800b96:	eb c7                	jmp    800b5f <vprintfmt+0x35e>
+  800b98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba4:	eb ed                	jmp    800b93 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800ba6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba9:	83 f8 2f             	cmp    $0x2f,%eax
+  800bac:	77 11                	ja     800bbf <vprintfmt+0x3be>
+  800bae:	89 c2                	mov    %eax,%edx
+  800bb0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb4:	83 c0 08             	add    $0x8,%eax
+  800bb7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bba:	4c 8b 22             	mov    (%rdx),%r12
+  800bbd:	eb a0                	jmp    800b5f <vprintfmt+0x35e>
+  800bbf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bcb:	eb ed                	jmp    800bba <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800bcd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd9:	e9 65 ff ff ff       	jmp    800b43 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800bde:	4c 89 ee             	mov    %r13,%rsi
+  800be1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800be6:	41 ff d6             	call   *%r14
+                i = -i;
+  800be9:	49 f7 dc             	neg    %r12
+  800bec:	e9 73 ff ff ff       	jmp    800b64 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800bf1:	40 84 f6             	test   %sil,%sil
+  800bf4:	75 32                	jne    800c28 <vprintfmt+0x427>
+    switch (lflag) {
+  800bf6:	85 d2                	test   %edx,%edx
+  800bf8:	74 5d                	je     800c57 <vprintfmt+0x456>
+  800bfa:	83 fa 01             	cmp    $0x1,%edx
+  800bfd:	0f 84 82 00 00 00    	je     800c85 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800c03:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c06:	83 f8 2f             	cmp    $0x2f,%eax
+  800c09:	0f 87 a5 00 00 00    	ja     800cb4 <vprintfmt+0x4b3>
+  800c0f:	89 c2                	mov    %eax,%edx
+  800c11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c15:	83 c0 08             	add    $0x8,%eax
+  800c18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c1e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c23:	e9 99 01 00 00       	jmp    800dc1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c2b:	83 f8 2f             	cmp    $0x2f,%eax
+  800c2e:	77 19                	ja     800c49 <vprintfmt+0x448>
+  800c30:	89 c2                	mov    %eax,%edx
+  800c32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c36:	83 c0 08             	add    $0x8,%eax
+  800c39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c3c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c3f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c44:	e9 78 01 00 00       	jmp    800dc1 <vprintfmt+0x5c0>
+  800c49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c55:	eb e5                	jmp    800c3c <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800c57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c5a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5d:	77 18                	ja     800c77 <vprintfmt+0x476>
+  800c5f:	89 c2                	mov    %eax,%edx
+  800c61:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c65:	83 c0 08             	add    $0x8,%eax
+  800c68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c6b:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800c6d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800c72:	e9 4a 01 00 00       	jmp    800dc1 <vprintfmt+0x5c0>
+  800c77:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c7b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c83:	eb e6                	jmp    800c6b <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800c85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c88:	83 f8 2f             	cmp    $0x2f,%eax
+  800c8b:	77 19                	ja     800ca6 <vprintfmt+0x4a5>
+  800c8d:	89 c2                	mov    %eax,%edx
+  800c8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c93:	83 c0 08             	add    $0x8,%eax
+  800c96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c99:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c9c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800ca1:	e9 1b 01 00 00       	jmp    800dc1 <vprintfmt+0x5c0>
+  800ca6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800caa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb2:	eb e5                	jmp    800c99 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800cb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cb8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cbc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc0:	e9 56 ff ff ff       	jmp    800c1b <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800cc5:	40 84 f6             	test   %sil,%sil
+  800cc8:	75 2e                	jne    800cf8 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800cca:	85 d2                	test   %edx,%edx
+  800ccc:	74 59                	je     800d27 <vprintfmt+0x526>
+  800cce:	83 fa 01             	cmp    $0x1,%edx
+  800cd1:	74 7f                	je     800d52 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800cd3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd6:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd9:	0f 87 9f 00 00 00    	ja     800d7e <vprintfmt+0x57d>
+  800cdf:	89 c2                	mov    %eax,%edx
+  800ce1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ce5:	83 c0 08             	add    $0x8,%eax
+  800ce8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ceb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800cee:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cf3:	e9 c9 00 00 00       	jmp    800dc1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800cf8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cfb:	83 f8 2f             	cmp    $0x2f,%eax
+  800cfe:	77 19                	ja     800d19 <vprintfmt+0x518>
+  800d00:	89 c2                	mov    %eax,%edx
+  800d02:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d06:	83 c0 08             	add    $0x8,%eax
+  800d09:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d0f:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d14:	e9 a8 00 00 00       	jmp    800dc1 <vprintfmt+0x5c0>
+  800d19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d25:	eb e5                	jmp    800d0c <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800d27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800d2d:	77 15                	ja     800d44 <vprintfmt+0x543>
+  800d2f:	89 c2                	mov    %eax,%edx
+  800d31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d35:	83 c0 08             	add    $0x8,%eax
+  800d38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d3b:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800d3d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800d42:	eb 7d                	jmp    800dc1 <vprintfmt+0x5c0>
+  800d44:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d48:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d50:	eb e9                	jmp    800d3b <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800d52:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d55:	83 f8 2f             	cmp    $0x2f,%eax
+  800d58:	77 16                	ja     800d70 <vprintfmt+0x56f>
+  800d5a:	89 c2                	mov    %eax,%edx
+  800d5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d60:	83 c0 08             	add    $0x8,%eax
+  800d63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d66:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d69:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800d6e:	eb 51                	jmp    800dc1 <vprintfmt+0x5c0>
+  800d70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d7c:	eb e8                	jmp    800d66 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800d7e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d82:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d8a:	e9 5c ff ff ff       	jmp    800ceb <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800d8f:	4c 89 ee             	mov    %r13,%rsi
+  800d92:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d97:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800d9a:	4c 89 ee             	mov    %r13,%rsi
+  800d9d:	bf 78 00 00 00       	mov    $0x78,%edi
+  800da2:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800da5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800da8:	83 f8 2f             	cmp    $0x2f,%eax
+  800dab:	77 47                	ja     800df4 <vprintfmt+0x5f3>
+  800dad:	89 c2                	mov    %eax,%edx
+  800daf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800db3:	83 c0 08             	add    $0x8,%eax
+  800db6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800db9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dbc:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800dc1:	48 83 ec 08          	sub    $0x8,%rsp
+  800dc5:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800dc9:	0f 94 c0             	sete   %al
+  800dcc:	0f b6 c0             	movzbl %al,%eax
+  800dcf:	50                   	push   %rax
+  800dd0:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800dd5:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800dd9:	4c 89 ee             	mov    %r13,%rsi
+  800ddc:	4c 89 f7             	mov    %r14,%rdi
+  800ddf:	48 b8 f6 06 80 00 00 	movabs $0x8006f6,%rax
+  800de6:	00 00 00 
+  800de9:	ff d0                	call   *%rax
+            break;
+  800deb:	48 83 c4 10          	add    $0x10,%rsp
+  800def:	e9 3e fa ff ff       	jmp    800832 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800df4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800df8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dfc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e00:	eb b7                	jmp    800db9 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800e02:	40 84 f6             	test   %sil,%sil
+  800e05:	75 2b                	jne    800e32 <vprintfmt+0x631>
+    switch (lflag) {
+  800e07:	85 d2                	test   %edx,%edx
+  800e09:	74 56                	je     800e61 <vprintfmt+0x660>
+  800e0b:	83 fa 01             	cmp    $0x1,%edx
+  800e0e:	74 7f                	je     800e8f <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800e10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e13:	83 f8 2f             	cmp    $0x2f,%eax
+  800e16:	0f 87 a2 00 00 00    	ja     800ebe <vprintfmt+0x6bd>
+  800e1c:	89 c2                	mov    %eax,%edx
+  800e1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e22:	83 c0 08             	add    $0x8,%eax
+  800e25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e28:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e2b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e30:	eb 8f                	jmp    800dc1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e35:	83 f8 2f             	cmp    $0x2f,%eax
+  800e38:	77 19                	ja     800e53 <vprintfmt+0x652>
+  800e3a:	89 c2                	mov    %eax,%edx
+  800e3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e40:	83 c0 08             	add    $0x8,%eax
+  800e43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e46:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e49:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e4e:	e9 6e ff ff ff       	jmp    800dc1 <vprintfmt+0x5c0>
+  800e53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e5f:	eb e5                	jmp    800e46 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800e61:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e64:	83 f8 2f             	cmp    $0x2f,%eax
+  800e67:	77 18                	ja     800e81 <vprintfmt+0x680>
+  800e69:	89 c2                	mov    %eax,%edx
+  800e6b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e6f:	83 c0 08             	add    $0x8,%eax
+  800e72:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e75:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800e77:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800e7c:	e9 40 ff ff ff       	jmp    800dc1 <vprintfmt+0x5c0>
+  800e81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e8d:	eb e6                	jmp    800e75 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800e8f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e92:	83 f8 2f             	cmp    $0x2f,%eax
+  800e95:	77 19                	ja     800eb0 <vprintfmt+0x6af>
+  800e97:	89 c2                	mov    %eax,%edx
+  800e99:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e9d:	83 c0 08             	add    $0x8,%eax
+  800ea0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ea3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ea6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800eab:	e9 11 ff ff ff       	jmp    800dc1 <vprintfmt+0x5c0>
+  800eb0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eb4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800eb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ebc:	eb e5                	jmp    800ea3 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ebe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ec2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ec6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800eca:	e9 59 ff ff ff       	jmp    800e28 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ecf:	4c 89 ee             	mov    %r13,%rsi
+  800ed2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ed7:	41 ff d6             	call   *%r14
+            break;
+  800eda:	e9 53 f9 ff ff       	jmp    800832 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800edf:	4c 89 ee             	mov    %r13,%rsi
+  800ee2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ee7:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800eea:	48 83 eb 01          	sub    $0x1,%rbx
+  800eee:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ef2:	75 f6                	jne    800eea <vprintfmt+0x6e9>
+  800ef4:	e9 39 f9 ff ff       	jmp    800832 <vprintfmt+0x31>
+}
+  800ef9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800efd:	5b                   	pop    %rbx
+  800efe:	41 5c                	pop    %r12
+  800f00:	41 5d                	pop    %r13
+  800f02:	41 5e                	pop    %r14
+  800f04:	41 5f                	pop    %r15
+  800f06:	5d                   	pop    %rbp
+  800f07:	c3                   	ret
+
+0000000000800f08 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800f08:	55                   	push   %rbp
+  800f09:	48 89 e5             	mov    %rsp,%rbp
+  800f0c:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800f10:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f14:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800f19:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800f1d:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800f24:	48 85 ff             	test   %rdi,%rdi
+  800f27:	74 2b                	je     800f54 <vsnprintf+0x4c>
+  800f29:	48 85 f6             	test   %rsi,%rsi
+  800f2c:	74 26                	je     800f54 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800f2e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f32:	48 bf ac 07 80 00 00 	movabs $0x8007ac,%rdi
+  800f39:	00 00 00 
+  800f3c:	48 b8 01 08 80 00 00 	movabs $0x800801,%rax
+  800f43:	00 00 00 
+  800f46:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800f48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f4c:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800f4f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800f52:	c9                   	leave
+  800f53:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800f54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f59:	eb f7                	jmp    800f52 <vsnprintf+0x4a>
+
+0000000000800f5b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800f5b:	55                   	push   %rbp
+  800f5c:	48 89 e5             	mov    %rsp,%rbp
+  800f5f:	48 83 ec 50          	sub    $0x50,%rsp
+  800f63:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f67:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f6b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800f6f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800f76:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f7e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f82:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800f86:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800f8a:	48 b8 08 0f 80 00 00 	movabs $0x800f08,%rax
+  800f91:	00 00 00 
+  800f94:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800f96:	c9                   	leave
+  800f97:	c3                   	ret
+
+0000000000800f98 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800f98:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800f9b:	74 10                	je     800fad <strlen+0x15>
+    size_t n = 0;
+  800f9d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800fa2:	48 83 c0 01          	add    $0x1,%rax
+  800fa6:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800faa:	75 f6                	jne    800fa2 <strlen+0xa>
+  800fac:	c3                   	ret
+    size_t n = 0;
+  800fad:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800fb2:	c3                   	ret
+
+0000000000800fb3 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800fb3:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800fb6:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800fbb:	48 85 f6             	test   %rsi,%rsi
+  800fbe:	74 11                	je     800fd1 <strnlen+0x1e>
+  800fc0:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800fc4:	74 0c                	je     800fd2 <strnlen+0x1f>
+  800fc6:	48 83 c2 01          	add    $0x1,%rdx
+  800fca:	48 39 d0             	cmp    %rdx,%rax
+  800fcd:	75 f1                	jne    800fc0 <strnlen+0xd>
+  800fcf:	eb 04                	jmp    800fd5 <strnlen+0x22>
+  800fd1:	c3                   	ret
+  800fd2:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800fd5:	c3                   	ret
+
+0000000000800fd6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800fd6:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800fd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fde:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800fe2:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800fe5:	48 83 c2 01          	add    $0x1,%rdx
+  800fe9:	84 c9                	test   %cl,%cl
+  800feb:	75 f1                	jne    800fde <strcpy+0x8>
+        ;
+    return res;
+}
+  800fed:	c3                   	ret
+
+0000000000800fee <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800fee:	55                   	push   %rbp
+  800fef:	48 89 e5             	mov    %rsp,%rbp
+  800ff2:	41 54                	push   %r12
+  800ff4:	53                   	push   %rbx
+  800ff5:	48 89 fb             	mov    %rdi,%rbx
+  800ff8:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ffb:	48 b8 98 0f 80 00 00 	movabs $0x800f98,%rax
+  801002:	00 00 00 
+  801005:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801007:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80100b:	4c 89 e6             	mov    %r12,%rsi
+  80100e:	48 b8 d6 0f 80 00 00 	movabs $0x800fd6,%rax
+  801015:	00 00 00 
+  801018:	ff d0                	call   *%rax
+    return dst;
+}
+  80101a:	48 89 d8             	mov    %rbx,%rax
+  80101d:	5b                   	pop    %rbx
+  80101e:	41 5c                	pop    %r12
+  801020:	5d                   	pop    %rbp
+  801021:	c3                   	ret
+
+0000000000801022 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801022:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801025:	48 85 d2             	test   %rdx,%rdx
+  801028:	74 1f                	je     801049 <strncpy+0x27>
+  80102a:	48 01 fa             	add    %rdi,%rdx
+  80102d:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801030:	48 83 c1 01          	add    $0x1,%rcx
+  801034:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801038:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80103c:	41 80 f8 01          	cmp    $0x1,%r8b
+  801040:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801044:	48 39 ca             	cmp    %rcx,%rdx
+  801047:	75 e7                	jne    801030 <strncpy+0xe>
+    }
+    return ret;
+}
+  801049:	c3                   	ret
+
+000000000080104a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80104a:	48 89 f8             	mov    %rdi,%rax
+  80104d:	48 85 d2             	test   %rdx,%rdx
+  801050:	74 24                	je     801076 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801052:	48 83 ea 01          	sub    $0x1,%rdx
+  801056:	74 1b                	je     801073 <strlcpy+0x29>
+  801058:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80105c:	0f b6 16             	movzbl (%rsi),%edx
+  80105f:	84 d2                	test   %dl,%dl
+  801061:	74 10                	je     801073 <strlcpy+0x29>
+            *dst++ = *src++;
+  801063:	48 83 c6 01          	add    $0x1,%rsi
+  801067:	48 83 c0 01          	add    $0x1,%rax
+  80106b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80106e:	48 39 c8             	cmp    %rcx,%rax
+  801071:	75 e9                	jne    80105c <strlcpy+0x12>
+        *dst = '\0';
+  801073:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801076:	48 29 f8             	sub    %rdi,%rax
+}
+  801079:	c3                   	ret
+
+000000000080107a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80107a:	0f b6 07             	movzbl (%rdi),%eax
+  80107d:	84 c0                	test   %al,%al
+  80107f:	74 13                	je     801094 <strcmp+0x1a>
+  801081:	38 06                	cmp    %al,(%rsi)
+  801083:	75 0f                	jne    801094 <strcmp+0x1a>
+  801085:	48 83 c7 01          	add    $0x1,%rdi
+  801089:	48 83 c6 01          	add    $0x1,%rsi
+  80108d:	0f b6 07             	movzbl (%rdi),%eax
+  801090:	84 c0                	test   %al,%al
+  801092:	75 ed                	jne    801081 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801094:	0f b6 c0             	movzbl %al,%eax
+  801097:	0f b6 16             	movzbl (%rsi),%edx
+  80109a:	29 d0                	sub    %edx,%eax
+}
+  80109c:	c3                   	ret
+
+000000000080109d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80109d:	48 85 d2             	test   %rdx,%rdx
+  8010a0:	74 1f                	je     8010c1 <strncmp+0x24>
+  8010a2:	0f b6 07             	movzbl (%rdi),%eax
+  8010a5:	84 c0                	test   %al,%al
+  8010a7:	74 1e                	je     8010c7 <strncmp+0x2a>
+  8010a9:	3a 06                	cmp    (%rsi),%al
+  8010ab:	75 1a                	jne    8010c7 <strncmp+0x2a>
+  8010ad:	48 83 c7 01          	add    $0x1,%rdi
+  8010b1:	48 83 c6 01          	add    $0x1,%rsi
+  8010b5:	48 83 ea 01          	sub    $0x1,%rdx
+  8010b9:	75 e7                	jne    8010a2 <strncmp+0x5>
+
+    if (!n) return 0;
+  8010bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c0:	c3                   	ret
+  8010c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c6:	c3                   	ret
+  8010c7:	48 85 d2             	test   %rdx,%rdx
+  8010ca:	74 09                	je     8010d5 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8010cc:	0f b6 07             	movzbl (%rdi),%eax
+  8010cf:	0f b6 16             	movzbl (%rsi),%edx
+  8010d2:	29 d0                	sub    %edx,%eax
+  8010d4:	c3                   	ret
+    if (!n) return 0;
+  8010d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010da:	c3                   	ret
+
+00000000008010db <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8010db:	0f b6 17             	movzbl (%rdi),%edx
+  8010de:	84 d2                	test   %dl,%dl
+  8010e0:	74 18                	je     8010fa <strchr+0x1f>
+        if (*str == c) {
+  8010e2:	0f be d2             	movsbl %dl,%edx
+  8010e5:	39 f2                	cmp    %esi,%edx
+  8010e7:	74 17                	je     801100 <strchr+0x25>
+    for (; *str; str++) {
+  8010e9:	48 83 c7 01          	add    $0x1,%rdi
+  8010ed:	0f b6 17             	movzbl (%rdi),%edx
+  8010f0:	84 d2                	test   %dl,%dl
+  8010f2:	75 ee                	jne    8010e2 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8010f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f9:	c3                   	ret
+  8010fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ff:	c3                   	ret
+  801100:	48 89 f8             	mov    %rdi,%rax
+}
+  801103:	c3                   	ret
+
+0000000000801104 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801104:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801107:	0f b6 17             	movzbl (%rdi),%edx
+  80110a:	84 d2                	test   %dl,%dl
+  80110c:	74 13                	je     801121 <strfind+0x1d>
+  80110e:	0f be d2             	movsbl %dl,%edx
+  801111:	39 f2                	cmp    %esi,%edx
+  801113:	74 0b                	je     801120 <strfind+0x1c>
+  801115:	48 83 c0 01          	add    $0x1,%rax
+  801119:	0f b6 10             	movzbl (%rax),%edx
+  80111c:	84 d2                	test   %dl,%dl
+  80111e:	75 ee                	jne    80110e <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801120:	c3                   	ret
+  801121:	c3                   	ret
+
+0000000000801122 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801122:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801125:	48 89 f8             	mov    %rdi,%rax
+  801128:	48 f7 d8             	neg    %rax
+  80112b:	83 e0 07             	and    $0x7,%eax
+  80112e:	49 89 d1             	mov    %rdx,%r9
+  801131:	49 29 c1             	sub    %rax,%r9
+  801134:	78 36                	js     80116c <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801136:	40 0f b6 c6          	movzbl %sil,%eax
+  80113a:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801141:	01 01 01 
+  801144:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801148:	40 f6 c7 07          	test   $0x7,%dil
+  80114c:	75 38                	jne    801186 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80114e:	4c 89 c9             	mov    %r9,%rcx
+  801151:	48 c1 f9 03          	sar    $0x3,%rcx
+  801155:	74 0c                	je     801163 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801157:	fc                   	cld
+  801158:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80115b:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80115f:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801163:	4d 85 c9             	test   %r9,%r9
+  801166:	75 45                	jne    8011ad <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801168:	4c 89 c0             	mov    %r8,%rax
+  80116b:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80116c:	48 85 d2             	test   %rdx,%rdx
+  80116f:	74 f7                	je     801168 <memset+0x46>
+  801171:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801174:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801177:	48 83 c0 01          	add    $0x1,%rax
+  80117b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80117f:	48 39 c2             	cmp    %rax,%rdx
+  801182:	75 f3                	jne    801177 <memset+0x55>
+  801184:	eb e2                	jmp    801168 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801186:	40 f6 c7 01          	test   $0x1,%dil
+  80118a:	74 06                	je     801192 <memset+0x70>
+  80118c:	88 07                	mov    %al,(%rdi)
+  80118e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801192:	40 f6 c7 02          	test   $0x2,%dil
+  801196:	74 07                	je     80119f <memset+0x7d>
+  801198:	66 89 07             	mov    %ax,(%rdi)
+  80119b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80119f:	40 f6 c7 04          	test   $0x4,%dil
+  8011a3:	74 a9                	je     80114e <memset+0x2c>
+  8011a5:	89 07                	mov    %eax,(%rdi)
+  8011a7:	48 83 c7 04          	add    $0x4,%rdi
+  8011ab:	eb a1                	jmp    80114e <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011ad:	41 f6 c1 04          	test   $0x4,%r9b
+  8011b1:	74 06                	je     8011b9 <memset+0x97>
+  8011b3:	89 07                	mov    %eax,(%rdi)
+  8011b5:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011b9:	41 f6 c1 02          	test   $0x2,%r9b
+  8011bd:	74 07                	je     8011c6 <memset+0xa4>
+  8011bf:	66 89 07             	mov    %ax,(%rdi)
+  8011c2:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8011c6:	41 f6 c1 01          	test   $0x1,%r9b
+  8011ca:	74 9c                	je     801168 <memset+0x46>
+  8011cc:	88 07                	mov    %al,(%rdi)
+  8011ce:	eb 98                	jmp    801168 <memset+0x46>
+
+00000000008011d0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8011d0:	48 89 f8             	mov    %rdi,%rax
+  8011d3:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8011d6:	48 39 fe             	cmp    %rdi,%rsi
+  8011d9:	73 3b                	jae    801216 <memmove+0x46>
+  8011db:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8011df:	48 39 d7             	cmp    %rdx,%rdi
+  8011e2:	73 32                	jae    801216 <memmove+0x46>
+        s += n;
+        d += n;
+  8011e4:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8011e8:	48 89 d6             	mov    %rdx,%rsi
+  8011eb:	48 09 fe             	or     %rdi,%rsi
+  8011ee:	48 09 ce             	or     %rcx,%rsi
+  8011f1:	40 f6 c6 07          	test   $0x7,%sil
+  8011f5:	75 12                	jne    801209 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8011f7:	48 83 ef 08          	sub    $0x8,%rdi
+  8011fb:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8011ff:	48 c1 e9 03          	shr    $0x3,%rcx
+  801203:	fd                   	std
+  801204:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801207:	fc                   	cld
+  801208:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801209:	48 83 ef 01          	sub    $0x1,%rdi
+  80120d:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801211:	fd                   	std
+  801212:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801214:	eb f1                	jmp    801207 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801216:	48 89 f2             	mov    %rsi,%rdx
+  801219:	48 09 c2             	or     %rax,%rdx
+  80121c:	48 09 ca             	or     %rcx,%rdx
+  80121f:	f6 c2 07             	test   $0x7,%dl
+  801222:	75 0c                	jne    801230 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801224:	48 c1 e9 03          	shr    $0x3,%rcx
+  801228:	48 89 c7             	mov    %rax,%rdi
+  80122b:	fc                   	cld
+  80122c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80122f:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801230:	48 89 c7             	mov    %rax,%rdi
+  801233:	fc                   	cld
+  801234:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801236:	c3                   	ret
+
+0000000000801237 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801237:	55                   	push   %rbp
+  801238:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80123b:	48 b8 d0 11 80 00 00 	movabs $0x8011d0,%rax
+  801242:	00 00 00 
+  801245:	ff d0                	call   *%rax
+}
+  801247:	5d                   	pop    %rbp
+  801248:	c3                   	ret
+
+0000000000801249 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801249:	55                   	push   %rbp
+  80124a:	48 89 e5             	mov    %rsp,%rbp
+  80124d:	41 57                	push   %r15
+  80124f:	41 56                	push   %r14
+  801251:	41 55                	push   %r13
+  801253:	41 54                	push   %r12
+  801255:	53                   	push   %rbx
+  801256:	48 83 ec 08          	sub    $0x8,%rsp
+  80125a:	49 89 fe             	mov    %rdi,%r14
+  80125d:	49 89 f7             	mov    %rsi,%r15
+  801260:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801263:	48 89 f7             	mov    %rsi,%rdi
+  801266:	48 b8 98 0f 80 00 00 	movabs $0x800f98,%rax
+  80126d:	00 00 00 
+  801270:	ff d0                	call   *%rax
+  801272:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801275:	48 89 de             	mov    %rbx,%rsi
+  801278:	4c 89 f7             	mov    %r14,%rdi
+  80127b:	48 b8 b3 0f 80 00 00 	movabs $0x800fb3,%rax
+  801282:	00 00 00 
+  801285:	ff d0                	call   *%rax
+  801287:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80128a:	48 39 c3             	cmp    %rax,%rbx
+  80128d:	74 36                	je     8012c5 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80128f:	48 89 d8             	mov    %rbx,%rax
+  801292:	4c 29 e8             	sub    %r13,%rax
+  801295:	49 39 c4             	cmp    %rax,%r12
+  801298:	73 31                	jae    8012cb <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80129a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80129f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012a3:	4c 89 fe             	mov    %r15,%rsi
+  8012a6:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  8012ad:	00 00 00 
+  8012b0:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8012b2:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8012b6:	48 83 c4 08          	add    $0x8,%rsp
+  8012ba:	5b                   	pop    %rbx
+  8012bb:	41 5c                	pop    %r12
+  8012bd:	41 5d                	pop    %r13
+  8012bf:	41 5e                	pop    %r14
+  8012c1:	41 5f                	pop    %r15
+  8012c3:	5d                   	pop    %rbp
+  8012c4:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8012c5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012c9:	eb eb                	jmp    8012b6 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8012cb:	48 83 eb 01          	sub    $0x1,%rbx
+  8012cf:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012d3:	48 89 da             	mov    %rbx,%rdx
+  8012d6:	4c 89 fe             	mov    %r15,%rsi
+  8012d9:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  8012e0:	00 00 00 
+  8012e3:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8012e5:	49 01 de             	add    %rbx,%r14
+  8012e8:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8012ed:	eb c3                	jmp    8012b2 <strlcat+0x69>
+
+00000000008012ef <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8012ef:	48 85 d2             	test   %rdx,%rdx
+  8012f2:	74 2d                	je     801321 <memcmp+0x32>
+  8012f4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8012f9:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8012fd:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801302:	44 38 c1             	cmp    %r8b,%cl
+  801305:	75 0f                	jne    801316 <memcmp+0x27>
+    while (n-- > 0) {
+  801307:	48 83 c0 01          	add    $0x1,%rax
+  80130b:	48 39 c2             	cmp    %rax,%rdx
+  80130e:	75 e9                	jne    8012f9 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801310:	b8 00 00 00 00       	mov    $0x0,%eax
+  801315:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801316:	0f b6 c1             	movzbl %cl,%eax
+  801319:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80131d:	44 29 c0             	sub    %r8d,%eax
+  801320:	c3                   	ret
+    return 0;
+  801321:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801326:	c3                   	ret
+
+0000000000801327 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801327:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80132b:	48 39 c7             	cmp    %rax,%rdi
+  80132e:	73 0f                	jae    80133f <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801330:	40 38 37             	cmp    %sil,(%rdi)
+  801333:	74 0e                	je     801343 <memfind+0x1c>
+    for (; src < end; src++) {
+  801335:	48 83 c7 01          	add    $0x1,%rdi
+  801339:	48 39 f8             	cmp    %rdi,%rax
+  80133c:	75 f2                	jne    801330 <memfind+0x9>
+  80133e:	c3                   	ret
+  80133f:	48 89 f8             	mov    %rdi,%rax
+  801342:	c3                   	ret
+  801343:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801346:	c3                   	ret
+
+0000000000801347 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801347:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80134a:	0f b6 37             	movzbl (%rdi),%esi
+  80134d:	40 80 fe 20          	cmp    $0x20,%sil
+  801351:	74 06                	je     801359 <strtol+0x12>
+  801353:	40 80 fe 09          	cmp    $0x9,%sil
+  801357:	75 13                	jne    80136c <strtol+0x25>
+  801359:	48 83 c7 01          	add    $0x1,%rdi
+  80135d:	0f b6 37             	movzbl (%rdi),%esi
+  801360:	40 80 fe 20          	cmp    $0x20,%sil
+  801364:	74 f3                	je     801359 <strtol+0x12>
+  801366:	40 80 fe 09          	cmp    $0x9,%sil
+  80136a:	74 ed                	je     801359 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80136c:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80136f:	83 e0 fd             	and    $0xfffffffd,%eax
+  801372:	3c 01                	cmp    $0x1,%al
+  801374:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801378:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80137e:	75 0f                	jne    80138f <strtol+0x48>
+  801380:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801383:	74 14                	je     801399 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801385:	85 d2                	test   %edx,%edx
+  801387:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80138c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80138f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801394:	4c 63 ca             	movslq %edx,%r9
+  801397:	eb 36                	jmp    8013cf <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801399:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80139d:	74 0f                	je     8013ae <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80139f:	85 d2                	test   %edx,%edx
+  8013a1:	75 ec                	jne    80138f <strtol+0x48>
+        s++;
+  8013a3:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8013a7:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8013ac:	eb e1                	jmp    80138f <strtol+0x48>
+        s += 2;
+  8013ae:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8013b2:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8013b7:	eb d6                	jmp    80138f <strtol+0x48>
+            dig -= '0';
+  8013b9:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8013bc:	44 0f b6 c1          	movzbl %cl,%r8d
+  8013c0:	41 39 d0             	cmp    %edx,%r8d
+  8013c3:	7d 21                	jge    8013e6 <strtol+0x9f>
+        val = val * base + dig;
+  8013c5:	49 0f af c1          	imul   %r9,%rax
+  8013c9:	0f b6 c9             	movzbl %cl,%ecx
+  8013cc:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8013cf:	48 83 c7 01          	add    $0x1,%rdi
+  8013d3:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8013d7:	80 f9 39             	cmp    $0x39,%cl
+  8013da:	76 dd                	jbe    8013b9 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8013dc:	80 f9 7b             	cmp    $0x7b,%cl
+  8013df:	77 05                	ja     8013e6 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8013e1:	83 e9 57             	sub    $0x57,%ecx
+  8013e4:	eb d6                	jmp    8013bc <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8013e6:	4d 85 d2             	test   %r10,%r10
+  8013e9:	74 03                	je     8013ee <strtol+0xa7>
+  8013eb:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8013ee:	48 89 c2             	mov    %rax,%rdx
+  8013f1:	48 f7 da             	neg    %rdx
+  8013f4:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8013f8:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8013fc:	c3                   	ret
+
+00000000008013fd <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8013fd:	55                   	push   %rbp
+  8013fe:	48 89 e5             	mov    %rsp,%rbp
+  801401:	53                   	push   %rbx
+  801402:	48 89 fa             	mov    %rdi,%rdx
+  801405:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801408:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80140d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801412:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801417:	be 00 00 00 00       	mov    $0x0,%esi
+  80141c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801422:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801424:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801428:	c9                   	leave
+  801429:	c3                   	ret
+
+000000000080142a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80142a:	55                   	push   %rbp
+  80142b:	48 89 e5             	mov    %rsp,%rbp
+  80142e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80142f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801434:	ba 00 00 00 00       	mov    $0x0,%edx
+  801439:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80143e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801443:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801448:	be 00 00 00 00       	mov    $0x0,%esi
+  80144d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801453:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801455:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801459:	c9                   	leave
+  80145a:	c3                   	ret
+
+000000000080145b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80145b:	55                   	push   %rbp
+  80145c:	48 89 e5             	mov    %rsp,%rbp
+  80145f:	53                   	push   %rbx
+  801460:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801464:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801467:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80146c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801471:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801476:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80147b:	be 00 00 00 00       	mov    $0x0,%esi
+  801480:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801486:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801488:	48 85 c0             	test   %rax,%rax
+  80148b:	7f 06                	jg     801493 <sys_env_destroy+0x38>
+}
+  80148d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801491:	c9                   	leave
+  801492:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801493:	49 89 c0             	mov    %rax,%r8
+  801496:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80149b:	48 ba f0 3b 80 00 00 	movabs $0x803bf0,%rdx
+  8014a2:	00 00 00 
+  8014a5:	be 26 00 00 00       	mov    $0x26,%esi
+  8014aa:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  8014b1:	00 00 00 
+  8014b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b9:	49 b9 61 05 80 00 00 	movabs $0x800561,%r9
+  8014c0:	00 00 00 
+  8014c3:	41 ff d1             	call   *%r9
+
+00000000008014c6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8014c6:	55                   	push   %rbp
+  8014c7:	48 89 e5             	mov    %rsp,%rbp
+  8014ca:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014cb:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ef:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f5:	c9                   	leave
+  8014f6:	c3                   	ret
+
+00000000008014f7 <sys_yield>:
+
+void
+sys_yield(void) {
+  8014f7:	55                   	push   %rbp
+  8014f8:	48 89 e5             	mov    %rsp,%rbp
+  8014fb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014fc:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801501:	ba 00 00 00 00       	mov    $0x0,%edx
+  801506:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80150b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801510:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801515:	be 00 00 00 00       	mov    $0x0,%esi
+  80151a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801520:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801522:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801526:	c9                   	leave
+  801527:	c3                   	ret
+
+0000000000801528 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801528:	55                   	push   %rbp
+  801529:	48 89 e5             	mov    %rsp,%rbp
+  80152c:	53                   	push   %rbx
+  80152d:	48 89 fa             	mov    %rdi,%rdx
+  801530:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801533:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801538:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80153f:	00 00 00 
+  801542:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801547:	be 00 00 00 00       	mov    $0x0,%esi
+  80154c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801552:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801554:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801558:	c9                   	leave
+  801559:	c3                   	ret
+
+000000000080155a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80155a:	55                   	push   %rbp
+  80155b:	48 89 e5             	mov    %rsp,%rbp
+  80155e:	53                   	push   %rbx
+  80155f:	49 89 f8             	mov    %rdi,%r8
+  801562:	48 89 d3             	mov    %rdx,%rbx
+  801565:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801568:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80156d:	4c 89 c2             	mov    %r8,%rdx
+  801570:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801573:	be 00 00 00 00       	mov    $0x0,%esi
+  801578:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80157e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801580:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801584:	c9                   	leave
+  801585:	c3                   	ret
+
+0000000000801586 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801586:	55                   	push   %rbp
+  801587:	48 89 e5             	mov    %rsp,%rbp
+  80158a:	53                   	push   %rbx
+  80158b:	48 83 ec 08          	sub    $0x8,%rsp
+  80158f:	89 f8                	mov    %edi,%eax
+  801591:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801594:	48 63 f9             	movslq %ecx,%rdi
+  801597:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80159a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80159f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ad:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015af:	48 85 c0             	test   %rax,%rax
+  8015b2:	7f 06                	jg     8015ba <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8015b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b8:	c9                   	leave
+  8015b9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ba:	49 89 c0             	mov    %rax,%r8
+  8015bd:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8015c2:	48 ba f0 3b 80 00 00 	movabs $0x803bf0,%rdx
+  8015c9:	00 00 00 
+  8015cc:	be 26 00 00 00       	mov    $0x26,%esi
+  8015d1:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  8015d8:	00 00 00 
+  8015db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e0:	49 b9 61 05 80 00 00 	movabs $0x800561,%r9
+  8015e7:	00 00 00 
+  8015ea:	41 ff d1             	call   *%r9
+
+00000000008015ed <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8015ed:	55                   	push   %rbp
+  8015ee:	48 89 e5             	mov    %rsp,%rbp
+  8015f1:	53                   	push   %rbx
+  8015f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8015f6:	89 f8                	mov    %edi,%eax
+  8015f8:	49 89 f2             	mov    %rsi,%r10
+  8015fb:	48 89 cf             	mov    %rcx,%rdi
+  8015fe:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801601:	48 63 da             	movslq %edx,%rbx
+  801604:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801607:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80160c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80160f:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801612:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801614:	48 85 c0             	test   %rax,%rax
+  801617:	7f 06                	jg     80161f <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801619:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161d:	c9                   	leave
+  80161e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80161f:	49 89 c0             	mov    %rax,%r8
+  801622:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801627:	48 ba f0 3b 80 00 00 	movabs $0x803bf0,%rdx
+  80162e:	00 00 00 
+  801631:	be 26 00 00 00       	mov    $0x26,%esi
+  801636:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  80163d:	00 00 00 
+  801640:	b8 00 00 00 00       	mov    $0x0,%eax
+  801645:	49 b9 61 05 80 00 00 	movabs $0x800561,%r9
+  80164c:	00 00 00 
+  80164f:	41 ff d1             	call   *%r9
+
+0000000000801652 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801652:	55                   	push   %rbp
+  801653:	48 89 e5             	mov    %rsp,%rbp
+  801656:	53                   	push   %rbx
+  801657:	48 83 ec 08          	sub    $0x8,%rsp
+  80165b:	48 89 f1             	mov    %rsi,%rcx
+  80165e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801661:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801664:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801669:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80166e:	be 00 00 00 00       	mov    $0x0,%esi
+  801673:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801679:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80167b:	48 85 c0             	test   %rax,%rax
+  80167e:	7f 06                	jg     801686 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801680:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801684:	c9                   	leave
+  801685:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801686:	49 89 c0             	mov    %rax,%r8
+  801689:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80168e:	48 ba f0 3b 80 00 00 	movabs $0x803bf0,%rdx
+  801695:	00 00 00 
+  801698:	be 26 00 00 00       	mov    $0x26,%esi
+  80169d:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  8016a4:	00 00 00 
+  8016a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ac:	49 b9 61 05 80 00 00 	movabs $0x800561,%r9
+  8016b3:	00 00 00 
+  8016b6:	41 ff d1             	call   *%r9
+
+00000000008016b9 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8016b9:	55                   	push   %rbp
+  8016ba:	48 89 e5             	mov    %rsp,%rbp
+  8016bd:	53                   	push   %rbx
+  8016be:	48 83 ec 08          	sub    $0x8,%rsp
+  8016c2:	89 f8                	mov    %edi,%eax
+  8016c4:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8016c7:	48 63 f9             	movslq %ecx,%rdi
+  8016ca:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016cd:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016d2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8016da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016e0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016e2:	48 85 c0             	test   %rax,%rax
+  8016e5:	7f 06                	jg     8016ed <sys_region_advise+0x34>
+}
+  8016e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016eb:	c9                   	leave
+  8016ec:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ed:	49 89 c0             	mov    %rax,%r8
+  8016f0:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8016f5:	48 ba f0 3b 80 00 00 	movabs $0x803bf0,%rdx
+  8016fc:	00 00 00 
+  8016ff:	be 26 00 00 00       	mov    $0x26,%esi
+  801704:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  80170b:	00 00 00 
+  80170e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801713:	49 b9 61 05 80 00 00 	movabs $0x800561,%r9
+  80171a:	00 00 00 
+  80171d:	41 ff d1             	call   *%r9
+
+0000000000801720 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801720:	55                   	push   %rbp
+  801721:	48 89 e5             	mov    %rsp,%rbp
+  801724:	53                   	push   %rbx
+  801725:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801729:	48 63 ce             	movslq %esi,%rcx
+  80172c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80172f:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801734:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801739:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80173e:	be 00 00 00 00       	mov    $0x0,%esi
+  801743:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801749:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80174b:	48 85 c0             	test   %rax,%rax
+  80174e:	7f 06                	jg     801756 <sys_env_set_nice+0x36>
+}
+  801750:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801754:	c9                   	leave
+  801755:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801756:	49 89 c0             	mov    %rax,%r8
+  801759:	b9 15 00 00 00       	mov    $0x15,%ecx
+  80175e:	48 ba f0 3b 80 00 00 	movabs $0x803bf0,%rdx
+  801765:	00 00 00 
+  801768:	be 26 00 00 00       	mov    $0x26,%esi
+  80176d:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  801774:	00 00 00 
+  801777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177c:	49 b9 61 05 80 00 00 	movabs $0x800561,%r9
+  801783:	00 00 00 
+  801786:	41 ff d1             	call   *%r9
+
+0000000000801789 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801789:	55                   	push   %rbp
+  80178a:	48 89 e5             	mov    %rsp,%rbp
+  80178d:	53                   	push   %rbx
+  80178e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801792:	48 63 ce             	movslq %esi,%rcx
+  801795:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801798:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80179d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017b2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017b4:	48 85 c0             	test   %rax,%rax
+  8017b7:	7f 06                	jg     8017bf <sys_env_set_status+0x36>
+}
+  8017b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017bd:	c9                   	leave
+  8017be:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017bf:	49 89 c0             	mov    %rax,%r8
+  8017c2:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8017c7:	48 ba f0 3b 80 00 00 	movabs $0x803bf0,%rdx
+  8017ce:	00 00 00 
+  8017d1:	be 26 00 00 00       	mov    $0x26,%esi
+  8017d6:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  8017dd:	00 00 00 
+  8017e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e5:	49 b9 61 05 80 00 00 	movabs $0x800561,%r9
+  8017ec:	00 00 00 
+  8017ef:	41 ff d1             	call   *%r9
+
+00000000008017f2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8017f2:	55                   	push   %rbp
+  8017f3:	48 89 e5             	mov    %rsp,%rbp
+  8017f6:	53                   	push   %rbx
+  8017f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8017fb:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8017fe:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801801:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801806:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80180b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801810:	be 00 00 00 00       	mov    $0x0,%esi
+  801815:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80181b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80181d:	48 85 c0             	test   %rax,%rax
+  801820:	7f 06                	jg     801828 <sys_env_set_trapframe+0x36>
+}
+  801822:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801826:	c9                   	leave
+  801827:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801828:	49 89 c0             	mov    %rax,%r8
+  80182b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801830:	48 ba f0 3b 80 00 00 	movabs $0x803bf0,%rdx
+  801837:	00 00 00 
+  80183a:	be 26 00 00 00       	mov    $0x26,%esi
+  80183f:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  801846:	00 00 00 
+  801849:	b8 00 00 00 00       	mov    $0x0,%eax
+  80184e:	49 b9 61 05 80 00 00 	movabs $0x800561,%r9
+  801855:	00 00 00 
+  801858:	41 ff d1             	call   *%r9
+
+000000000080185b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80185b:	55                   	push   %rbp
+  80185c:	48 89 e5             	mov    %rsp,%rbp
+  80185f:	53                   	push   %rbx
+  801860:	48 83 ec 08          	sub    $0x8,%rsp
+  801864:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801867:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80186a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80186f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801874:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801879:	be 00 00 00 00       	mov    $0x0,%esi
+  80187e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801884:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801886:	48 85 c0             	test   %rax,%rax
+  801889:	7f 06                	jg     801891 <sys_env_set_pgfault_upcall+0x36>
+}
+  80188b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80188f:	c9                   	leave
+  801890:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801891:	49 89 c0             	mov    %rax,%r8
+  801894:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801899:	48 ba f0 3b 80 00 00 	movabs $0x803bf0,%rdx
+  8018a0:	00 00 00 
+  8018a3:	be 26 00 00 00       	mov    $0x26,%esi
+  8018a8:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  8018af:	00 00 00 
+  8018b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b7:	49 b9 61 05 80 00 00 	movabs $0x800561,%r9
+  8018be:	00 00 00 
+  8018c1:	41 ff d1             	call   *%r9
+
+00000000008018c4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8018c4:	55                   	push   %rbp
+  8018c5:	48 89 e5             	mov    %rsp,%rbp
+  8018c8:	53                   	push   %rbx
+  8018c9:	89 f8                	mov    %edi,%eax
+  8018cb:	49 89 f1             	mov    %rsi,%r9
+  8018ce:	48 89 d3             	mov    %rdx,%rbx
+  8018d1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8018d4:	49 63 f0             	movslq %r8d,%rsi
+  8018d7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018da:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018df:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018e8:	cd 30                	int    $0x30
+}
+  8018ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018ee:	c9                   	leave
+  8018ef:	c3                   	ret
+
+00000000008018f0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8018f0:	55                   	push   %rbp
+  8018f1:	48 89 e5             	mov    %rsp,%rbp
+  8018f4:	53                   	push   %rbx
+  8018f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8018f9:	48 89 fa             	mov    %rdi,%rdx
+  8018fc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018ff:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801904:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801909:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80190e:	be 00 00 00 00       	mov    $0x0,%esi
+  801913:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801919:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80191b:	48 85 c0             	test   %rax,%rax
+  80191e:	7f 06                	jg     801926 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801920:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801924:	c9                   	leave
+  801925:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801926:	49 89 c0             	mov    %rax,%r8
+  801929:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80192e:	48 ba f0 3b 80 00 00 	movabs $0x803bf0,%rdx
+  801935:	00 00 00 
+  801938:	be 26 00 00 00       	mov    $0x26,%esi
+  80193d:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  801944:	00 00 00 
+  801947:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194c:	49 b9 61 05 80 00 00 	movabs $0x800561,%r9
+  801953:	00 00 00 
+  801956:	41 ff d1             	call   *%r9
+
+0000000000801959 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801959:	55                   	push   %rbp
+  80195a:	48 89 e5             	mov    %rsp,%rbp
+  80195d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80195e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801963:	ba 00 00 00 00       	mov    $0x0,%edx
+  801968:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80196d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801972:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801977:	be 00 00 00 00       	mov    $0x0,%esi
+  80197c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801982:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801984:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801988:	c9                   	leave
+  801989:	c3                   	ret
+
+000000000080198a <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80198a:	55                   	push   %rbp
+  80198b:	48 89 e5             	mov    %rsp,%rbp
+  80198e:	53                   	push   %rbx
+  80198f:	48 83 ec 08          	sub    $0x8,%rsp
+  801993:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801996:	48 63 ce             	movslq %esi,%rcx
+  801999:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80199c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019b1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019b3:	48 85 c0             	test   %rax,%rax
+  8019b6:	7f 06                	jg     8019be <sys_sigqueue+0x34>
+}
+  8019b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019bc:	c9                   	leave
+  8019bd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019be:	49 89 c0             	mov    %rax,%r8
+  8019c1:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8019c6:	48 ba f0 3b 80 00 00 	movabs $0x803bf0,%rdx
+  8019cd:	00 00 00 
+  8019d0:	be 26 00 00 00       	mov    $0x26,%esi
+  8019d5:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  8019dc:	00 00 00 
+  8019df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e4:	49 b9 61 05 80 00 00 	movabs $0x800561,%r9
+  8019eb:	00 00 00 
+  8019ee:	41 ff d1             	call   *%r9
+
+00000000008019f1 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8019f1:	55                   	push   %rbp
+  8019f2:	48 89 e5             	mov    %rsp,%rbp
+  8019f5:	53                   	push   %rbx
+  8019f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8019fa:	48 89 fa             	mov    %rdi,%rdx
+  8019fd:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a00:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a0a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a0f:	be 00 00 00 00       	mov    $0x0,%esi
+  801a14:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a1a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a1c:	48 85 c0             	test   %rax,%rax
+  801a1f:	7f 06                	jg     801a27 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801a21:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a25:	c9                   	leave
+  801a26:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a27:	49 89 c0             	mov    %rax,%r8
+  801a2a:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801a2f:	48 ba f0 3b 80 00 00 	movabs $0x803bf0,%rdx
+  801a36:	00 00 00 
+  801a39:	be 26 00 00 00       	mov    $0x26,%esi
+  801a3e:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  801a45:	00 00 00 
+  801a48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a4d:	49 b9 61 05 80 00 00 	movabs $0x800561,%r9
+  801a54:	00 00 00 
+  801a57:	41 ff d1             	call   *%r9
+
+0000000000801a5a <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801a5a:	55                   	push   %rbp
+  801a5b:	48 89 e5             	mov    %rsp,%rbp
+  801a5e:	53                   	push   %rbx
+  801a5f:	48 83 ec 08          	sub    $0x8,%rsp
+  801a63:	48 89 f1             	mov    %rsi,%rcx
+  801a66:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801a69:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a6c:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a71:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a76:	be 00 00 00 00       	mov    $0x0,%esi
+  801a7b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a81:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a83:	48 85 c0             	test   %rax,%rax
+  801a86:	7f 06                	jg     801a8e <sys_sigaction+0x34>
+}
+  801a88:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a8c:	c9                   	leave
+  801a8d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a8e:	49 89 c0             	mov    %rax,%r8
+  801a91:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801a96:	48 ba f0 3b 80 00 00 	movabs $0x803bf0,%rdx
+  801a9d:	00 00 00 
+  801aa0:	be 26 00 00 00       	mov    $0x26,%esi
+  801aa5:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  801aac:	00 00 00 
+  801aaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab4:	49 b9 61 05 80 00 00 	movabs $0x800561,%r9
+  801abb:	00 00 00 
+  801abe:	41 ff d1             	call   *%r9
+
+0000000000801ac1 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801ac1:	55                   	push   %rbp
+  801ac2:	48 89 e5             	mov    %rsp,%rbp
+  801ac5:	53                   	push   %rbx
+  801ac6:	48 83 ec 08          	sub    $0x8,%rsp
+  801aca:	48 89 f1             	mov    %rsi,%rcx
+  801acd:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801ad0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ad3:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ad8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801add:	be 00 00 00 00       	mov    $0x0,%esi
+  801ae2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ae8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801aea:	48 85 c0             	test   %rax,%rax
+  801aed:	7f 06                	jg     801af5 <sys_sigprocmask+0x34>
+}
+  801aef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801af3:	c9                   	leave
+  801af4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801af5:	49 89 c0             	mov    %rax,%r8
+  801af8:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801afd:	48 ba f0 3b 80 00 00 	movabs $0x803bf0,%rdx
+  801b04:	00 00 00 
+  801b07:	be 26 00 00 00       	mov    $0x26,%esi
+  801b0c:	48 bf 0f 3c 80 00 00 	movabs $0x803c0f,%rdi
+  801b13:	00 00 00 
+  801b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1b:	49 b9 61 05 80 00 00 	movabs $0x800561,%r9
+  801b22:	00 00 00 
+  801b25:	41 ff d1             	call   *%r9
+
+0000000000801b28 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801b28:	55                   	push   %rbp
+  801b29:	48 89 e5             	mov    %rsp,%rbp
+  801b2c:	41 54                	push   %r12
+  801b2e:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801b2f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b34:	cd 30                	int    $0x30
+  801b36:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  801b39:	85 c0                	test   %eax,%eax
+  801b3b:	78 76                	js     801bb3 <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  801b3d:	74 7c                	je     801bbb <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  801b3f:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801b45:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801b4c:	00 00 00 
+  801b4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b54:	89 c2                	mov    %eax,%edx
+  801b56:	be 00 00 00 00       	mov    $0x0,%esi
+  801b5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b60:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  801b67:	00 00 00 
+  801b6a:	ff d0                	call   *%rax
+  801b6c:	85 c0                	test   %eax,%eax
+  801b6e:	75 7a                	jne    801bea <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  801b70:	48 a1 10 50 80 00 00 	movabs 0x805010,%rax
+  801b77:	00 00 00 
+  801b7a:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801b81:	44 89 e7             	mov    %r12d,%edi
+  801b84:	48 b8 5b 18 80 00 00 	movabs $0x80185b,%rax
+  801b8b:	00 00 00 
+  801b8e:	ff d0                	call   *%rax
+  801b90:	85 c0                	test   %eax,%eax
+  801b92:	75 5e                	jne    801bf2 <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  801b94:	be 02 00 00 00       	mov    $0x2,%esi
+  801b99:	44 89 e7             	mov    %r12d,%edi
+  801b9c:	48 b8 89 17 80 00 00 	movabs $0x801789,%rax
+  801ba3:	00 00 00 
+  801ba6:	ff d0                	call   *%rax
+        return -1;
+  801ba8:	85 c0                	test   %eax,%eax
+  801baa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801baf:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  801bb3:	44 89 e0             	mov    %r12d,%eax
+  801bb6:	5b                   	pop    %rbx
+  801bb7:	41 5c                	pop    %r12
+  801bb9:	5d                   	pop    %rbp
+  801bba:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  801bbb:	48 b8 c6 14 80 00 00 	movabs $0x8014c6,%rax
+  801bc2:	00 00 00 
+  801bc5:	ff d0                	call   *%rax
+  801bc7:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  801bca:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  801bd1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801bd8:	00 00 00 
+  801bdb:	48 01 d0             	add    %rdx,%rax
+  801bde:	48 a3 10 50 80 00 00 	movabs %rax,0x805010
+  801be5:	00 00 00 
+        return 0;
+  801be8:	eb c9                	jmp    801bb3 <fork+0x8b>
+        return -1;
+  801bea:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801bf0:	eb c1                	jmp    801bb3 <fork+0x8b>
+        return -1;
+  801bf2:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801bf8:	eb b9                	jmp    801bb3 <fork+0x8b>
+
+0000000000801bfa <sfork>:
+
+envid_t
+sfork() {
+  801bfa:	55                   	push   %rbp
+  801bfb:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801bfe:	48 ba 1d 3c 80 00 00 	movabs $0x803c1d,%rdx
+  801c05:	00 00 00 
+  801c08:	be 2e 00 00 00       	mov    $0x2e,%esi
+  801c0d:	48 bf 38 3c 80 00 00 	movabs $0x803c38,%rdi
+  801c14:	00 00 00 
+  801c17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1c:	48 b9 61 05 80 00 00 	movabs $0x800561,%rcx
+  801c23:	00 00 00 
+  801c26:	ff d1                	call   *%rcx
+
+0000000000801c28 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c28:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c2f:	ff ff ff 
+  801c32:	48 01 f8             	add    %rdi,%rax
+  801c35:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801c39:	c3                   	ret
+
+0000000000801c3a <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c3a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c41:	ff ff ff 
+  801c44:	48 01 f8             	add    %rdi,%rax
+  801c47:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801c4b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801c51:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801c55:	c3                   	ret
+
+0000000000801c56 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801c56:	55                   	push   %rbp
+  801c57:	48 89 e5             	mov    %rsp,%rbp
+  801c5a:	41 57                	push   %r15
+  801c5c:	41 56                	push   %r14
+  801c5e:	41 55                	push   %r13
+  801c60:	41 54                	push   %r12
+  801c62:	53                   	push   %rbx
+  801c63:	48 83 ec 08          	sub    $0x8,%rsp
+  801c67:	49 89 ff             	mov    %rdi,%r15
+  801c6a:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801c6f:	49 bd d4 2b 80 00 00 	movabs $0x802bd4,%r13
+  801c76:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801c79:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801c7f:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801c82:	48 89 df             	mov    %rbx,%rdi
+  801c85:	41 ff d5             	call   *%r13
+  801c88:	83 e0 04             	and    $0x4,%eax
+  801c8b:	74 17                	je     801ca4 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801c8d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801c94:	4c 39 f3             	cmp    %r14,%rbx
+  801c97:	75 e6                	jne    801c7f <fd_alloc+0x29>
+  801c99:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801c9f:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801ca4:	4d 89 27             	mov    %r12,(%r15)
+}
+  801ca7:	48 83 c4 08          	add    $0x8,%rsp
+  801cab:	5b                   	pop    %rbx
+  801cac:	41 5c                	pop    %r12
+  801cae:	41 5d                	pop    %r13
+  801cb0:	41 5e                	pop    %r14
+  801cb2:	41 5f                	pop    %r15
+  801cb4:	5d                   	pop    %rbp
+  801cb5:	c3                   	ret
+
+0000000000801cb6 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801cb6:	83 ff 1f             	cmp    $0x1f,%edi
+  801cb9:	77 39                	ja     801cf4 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801cbb:	55                   	push   %rbp
+  801cbc:	48 89 e5             	mov    %rsp,%rbp
+  801cbf:	41 54                	push   %r12
+  801cc1:	53                   	push   %rbx
+  801cc2:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801cc5:	48 63 df             	movslq %edi,%rbx
+  801cc8:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801ccf:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801cd3:	48 89 df             	mov    %rbx,%rdi
+  801cd6:	48 b8 d4 2b 80 00 00 	movabs $0x802bd4,%rax
+  801cdd:	00 00 00 
+  801ce0:	ff d0                	call   *%rax
+  801ce2:	a8 04                	test   $0x4,%al
+  801ce4:	74 14                	je     801cfa <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801ce6:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801cea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cef:	5b                   	pop    %rbx
+  801cf0:	41 5c                	pop    %r12
+  801cf2:	5d                   	pop    %rbp
+  801cf3:	c3                   	ret
+        return -E_INVAL;
+  801cf4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801cf9:	c3                   	ret
+        return -E_INVAL;
+  801cfa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cff:	eb ee                	jmp    801cef <fd_lookup+0x39>
+
+0000000000801d01 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801d01:	55                   	push   %rbp
+  801d02:	48 89 e5             	mov    %rsp,%rbp
+  801d05:	41 54                	push   %r12
+  801d07:	53                   	push   %rbx
+  801d08:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801d0b:	48 b8 e0 3c 80 00 00 	movabs $0x803ce0,%rax
+  801d12:	00 00 00 
+  801d15:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801d1c:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801d1f:	39 3b                	cmp    %edi,(%rbx)
+  801d21:	74 47                	je     801d6a <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801d23:	48 83 c0 08          	add    $0x8,%rax
+  801d27:	48 8b 18             	mov    (%rax),%rbx
+  801d2a:	48 85 db             	test   %rbx,%rbx
+  801d2d:	75 f0                	jne    801d1f <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801d2f:	48 a1 10 50 80 00 00 	movabs 0x805010,%rax
+  801d36:	00 00 00 
+  801d39:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d3f:	89 fa                	mov    %edi,%edx
+  801d41:	48 bf 48 3c 80 00 00 	movabs $0x803c48,%rdi
+  801d48:	00 00 00 
+  801d4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d50:	48 b9 b1 06 80 00 00 	movabs $0x8006b1,%rcx
+  801d57:	00 00 00 
+  801d5a:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801d5c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801d61:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801d65:	5b                   	pop    %rbx
+  801d66:	41 5c                	pop    %r12
+  801d68:	5d                   	pop    %rbp
+  801d69:	c3                   	ret
+            return 0;
+  801d6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6f:	eb f0                	jmp    801d61 <dev_lookup+0x60>
+
+0000000000801d71 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801d71:	55                   	push   %rbp
+  801d72:	48 89 e5             	mov    %rsp,%rbp
+  801d75:	41 55                	push   %r13
+  801d77:	41 54                	push   %r12
+  801d79:	53                   	push   %rbx
+  801d7a:	48 83 ec 18          	sub    $0x18,%rsp
+  801d7e:	48 89 fb             	mov    %rdi,%rbx
+  801d81:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801d84:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801d8b:	ff ff ff 
+  801d8e:	48 01 df             	add    %rbx,%rdi
+  801d91:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801d95:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d99:	48 b8 b6 1c 80 00 00 	movabs $0x801cb6,%rax
+  801da0:	00 00 00 
+  801da3:	ff d0                	call   *%rax
+  801da5:	41 89 c5             	mov    %eax,%r13d
+  801da8:	85 c0                	test   %eax,%eax
+  801daa:	78 06                	js     801db2 <fd_close+0x41>
+  801dac:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801db0:	74 1a                	je     801dcc <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801db2:	45 84 e4             	test   %r12b,%r12b
+  801db5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dba:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801dbe:	44 89 e8             	mov    %r13d,%eax
+  801dc1:	48 83 c4 18          	add    $0x18,%rsp
+  801dc5:	5b                   	pop    %rbx
+  801dc6:	41 5c                	pop    %r12
+  801dc8:	41 5d                	pop    %r13
+  801dca:	5d                   	pop    %rbp
+  801dcb:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801dcc:	8b 3b                	mov    (%rbx),%edi
+  801dce:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dd2:	48 b8 01 1d 80 00 00 	movabs $0x801d01,%rax
+  801dd9:	00 00 00 
+  801ddc:	ff d0                	call   *%rax
+  801dde:	41 89 c5             	mov    %eax,%r13d
+  801de1:	85 c0                	test   %eax,%eax
+  801de3:	78 1b                	js     801e00 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801de5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801de9:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801ded:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801df3:	48 85 c0             	test   %rax,%rax
+  801df6:	74 08                	je     801e00 <fd_close+0x8f>
+  801df8:	48 89 df             	mov    %rbx,%rdi
+  801dfb:	ff d0                	call   *%rax
+  801dfd:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801e00:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e05:	48 89 de             	mov    %rbx,%rsi
+  801e08:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e0d:	48 b8 52 16 80 00 00 	movabs $0x801652,%rax
+  801e14:	00 00 00 
+  801e17:	ff d0                	call   *%rax
+    return res;
+  801e19:	eb a3                	jmp    801dbe <fd_close+0x4d>
+
+0000000000801e1b <close>:
+
+int
+close(int fdnum) {
+  801e1b:	55                   	push   %rbp
+  801e1c:	48 89 e5             	mov    %rsp,%rbp
+  801e1f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801e23:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e27:	48 b8 b6 1c 80 00 00 	movabs $0x801cb6,%rax
+  801e2e:	00 00 00 
+  801e31:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e33:	85 c0                	test   %eax,%eax
+  801e35:	78 15                	js     801e4c <close+0x31>
+
+    return fd_close(fd, 1);
+  801e37:	be 01 00 00 00       	mov    $0x1,%esi
+  801e3c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801e40:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  801e47:	00 00 00 
+  801e4a:	ff d0                	call   *%rax
+}
+  801e4c:	c9                   	leave
+  801e4d:	c3                   	ret
+
+0000000000801e4e <close_all>:
+
+void
+close_all(void) {
+  801e4e:	55                   	push   %rbp
+  801e4f:	48 89 e5             	mov    %rsp,%rbp
+  801e52:	41 54                	push   %r12
+  801e54:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801e55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e5a:	49 bc 1b 1e 80 00 00 	movabs $0x801e1b,%r12
+  801e61:	00 00 00 
+  801e64:	89 df                	mov    %ebx,%edi
+  801e66:	41 ff d4             	call   *%r12
+  801e69:	83 c3 01             	add    $0x1,%ebx
+  801e6c:	83 fb 20             	cmp    $0x20,%ebx
+  801e6f:	75 f3                	jne    801e64 <close_all+0x16>
+}
+  801e71:	5b                   	pop    %rbx
+  801e72:	41 5c                	pop    %r12
+  801e74:	5d                   	pop    %rbp
+  801e75:	c3                   	ret
+
+0000000000801e76 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801e76:	55                   	push   %rbp
+  801e77:	48 89 e5             	mov    %rsp,%rbp
+  801e7a:	41 57                	push   %r15
+  801e7c:	41 56                	push   %r14
+  801e7e:	41 55                	push   %r13
+  801e80:	41 54                	push   %r12
+  801e82:	53                   	push   %rbx
+  801e83:	48 83 ec 18          	sub    $0x18,%rsp
+  801e87:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801e8a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801e8e:	48 b8 b6 1c 80 00 00 	movabs $0x801cb6,%rax
+  801e95:	00 00 00 
+  801e98:	ff d0                	call   *%rax
+  801e9a:	89 c3                	mov    %eax,%ebx
+  801e9c:	85 c0                	test   %eax,%eax
+  801e9e:	0f 88 b8 00 00 00    	js     801f5c <dup+0xe6>
+    close(newfdnum);
+  801ea4:	44 89 e7             	mov    %r12d,%edi
+  801ea7:	48 b8 1b 1e 80 00 00 	movabs $0x801e1b,%rax
+  801eae:	00 00 00 
+  801eb1:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801eb3:	4d 63 ec             	movslq %r12d,%r13
+  801eb6:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801ebd:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801ec1:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ec5:	4c 89 ff             	mov    %r15,%rdi
+  801ec8:	49 be 3a 1c 80 00 00 	movabs $0x801c3a,%r14
+  801ecf:	00 00 00 
+  801ed2:	41 ff d6             	call   *%r14
+  801ed5:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801ed8:	4c 89 ef             	mov    %r13,%rdi
+  801edb:	41 ff d6             	call   *%r14
+  801ede:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801ee1:	48 89 df             	mov    %rbx,%rdi
+  801ee4:	48 b8 d4 2b 80 00 00 	movabs $0x802bd4,%rax
+  801eeb:	00 00 00 
+  801eee:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801ef0:	a8 04                	test   $0x4,%al
+  801ef2:	74 2b                	je     801f1f <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ef4:	41 89 c1             	mov    %eax,%r9d
+  801ef7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801efd:	4c 89 f1             	mov    %r14,%rcx
+  801f00:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f05:	48 89 de             	mov    %rbx,%rsi
+  801f08:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f0d:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  801f14:	00 00 00 
+  801f17:	ff d0                	call   *%rax
+  801f19:	89 c3                	mov    %eax,%ebx
+  801f1b:	85 c0                	test   %eax,%eax
+  801f1d:	78 4e                	js     801f6d <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801f1f:	4c 89 ff             	mov    %r15,%rdi
+  801f22:	48 b8 d4 2b 80 00 00 	movabs $0x802bd4,%rax
+  801f29:	00 00 00 
+  801f2c:	ff d0                	call   *%rax
+  801f2e:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801f31:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f37:	4c 89 e9             	mov    %r13,%rcx
+  801f3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3f:	4c 89 fe             	mov    %r15,%rsi
+  801f42:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f47:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  801f4e:	00 00 00 
+  801f51:	ff d0                	call   *%rax
+  801f53:	89 c3                	mov    %eax,%ebx
+  801f55:	85 c0                	test   %eax,%eax
+  801f57:	78 14                	js     801f6d <dup+0xf7>
+
+    return newfdnum;
+  801f59:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801f5c:	89 d8                	mov    %ebx,%eax
+  801f5e:	48 83 c4 18          	add    $0x18,%rsp
+  801f62:	5b                   	pop    %rbx
+  801f63:	41 5c                	pop    %r12
+  801f65:	41 5d                	pop    %r13
+  801f67:	41 5e                	pop    %r14
+  801f69:	41 5f                	pop    %r15
+  801f6b:	5d                   	pop    %rbp
+  801f6c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801f6d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f72:	4c 89 ee             	mov    %r13,%rsi
+  801f75:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f7a:	49 bc 52 16 80 00 00 	movabs $0x801652,%r12
+  801f81:	00 00 00 
+  801f84:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801f87:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f8c:	4c 89 f6             	mov    %r14,%rsi
+  801f8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f94:	41 ff d4             	call   *%r12
+    return res;
+  801f97:	eb c3                	jmp    801f5c <dup+0xe6>
+
+0000000000801f99 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801f99:	55                   	push   %rbp
+  801f9a:	48 89 e5             	mov    %rsp,%rbp
+  801f9d:	41 56                	push   %r14
+  801f9f:	41 55                	push   %r13
+  801fa1:	41 54                	push   %r12
+  801fa3:	53                   	push   %rbx
+  801fa4:	48 83 ec 10          	sub    $0x10,%rsp
+  801fa8:	89 fb                	mov    %edi,%ebx
+  801faa:	49 89 f4             	mov    %rsi,%r12
+  801fad:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fb0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fb4:	48 b8 b6 1c 80 00 00 	movabs $0x801cb6,%rax
+  801fbb:	00 00 00 
+  801fbe:	ff d0                	call   *%rax
+  801fc0:	85 c0                	test   %eax,%eax
+  801fc2:	78 4c                	js     802010 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fc4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801fc8:	41 8b 3e             	mov    (%r14),%edi
+  801fcb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fcf:	48 b8 01 1d 80 00 00 	movabs $0x801d01,%rax
+  801fd6:	00 00 00 
+  801fd9:	ff d0                	call   *%rax
+  801fdb:	85 c0                	test   %eax,%eax
+  801fdd:	78 35                	js     802014 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801fdf:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801fe3:	83 e0 03             	and    $0x3,%eax
+  801fe6:	83 f8 01             	cmp    $0x1,%eax
+  801fe9:	74 2d                	je     802018 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801feb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fef:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ff3:	48 85 c0             	test   %rax,%rax
+  801ff6:	74 56                	je     80204e <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ff8:	4c 89 ea             	mov    %r13,%rdx
+  801ffb:	4c 89 e6             	mov    %r12,%rsi
+  801ffe:	4c 89 f7             	mov    %r14,%rdi
+  802001:	ff d0                	call   *%rax
+}
+  802003:	48 83 c4 10          	add    $0x10,%rsp
+  802007:	5b                   	pop    %rbx
+  802008:	41 5c                	pop    %r12
+  80200a:	41 5d                	pop    %r13
+  80200c:	41 5e                	pop    %r14
+  80200e:	5d                   	pop    %rbp
+  80200f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802010:	48 98                	cltq
+  802012:	eb ef                	jmp    802003 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802014:	48 98                	cltq
+  802016:	eb eb                	jmp    802003 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802018:	48 a1 10 50 80 00 00 	movabs 0x805010,%rax
+  80201f:	00 00 00 
+  802022:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802028:	89 da                	mov    %ebx,%edx
+  80202a:	48 bf 89 3c 80 00 00 	movabs $0x803c89,%rdi
+  802031:	00 00 00 
+  802034:	b8 00 00 00 00       	mov    $0x0,%eax
+  802039:	48 b9 b1 06 80 00 00 	movabs $0x8006b1,%rcx
+  802040:	00 00 00 
+  802043:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802045:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80204c:	eb b5                	jmp    802003 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80204e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802055:	eb ac                	jmp    802003 <read+0x6a>
+
+0000000000802057 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802057:	55                   	push   %rbp
+  802058:	48 89 e5             	mov    %rsp,%rbp
+  80205b:	41 57                	push   %r15
+  80205d:	41 56                	push   %r14
+  80205f:	41 55                	push   %r13
+  802061:	41 54                	push   %r12
+  802063:	53                   	push   %rbx
+  802064:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802068:	48 85 d2             	test   %rdx,%rdx
+  80206b:	74 54                	je     8020c1 <readn+0x6a>
+  80206d:	41 89 fd             	mov    %edi,%r13d
+  802070:	49 89 f6             	mov    %rsi,%r14
+  802073:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802076:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80207b:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802080:	49 bf 99 1f 80 00 00 	movabs $0x801f99,%r15
+  802087:	00 00 00 
+  80208a:	4c 89 e2             	mov    %r12,%rdx
+  80208d:	48 29 f2             	sub    %rsi,%rdx
+  802090:	4c 01 f6             	add    %r14,%rsi
+  802093:	44 89 ef             	mov    %r13d,%edi
+  802096:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802099:	85 c0                	test   %eax,%eax
+  80209b:	78 20                	js     8020bd <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80209d:	01 c3                	add    %eax,%ebx
+  80209f:	85 c0                	test   %eax,%eax
+  8020a1:	74 08                	je     8020ab <readn+0x54>
+  8020a3:	48 63 f3             	movslq %ebx,%rsi
+  8020a6:	4c 39 e6             	cmp    %r12,%rsi
+  8020a9:	72 df                	jb     80208a <readn+0x33>
+    }
+    return res;
+  8020ab:	48 63 c3             	movslq %ebx,%rax
+}
+  8020ae:	48 83 c4 08          	add    $0x8,%rsp
+  8020b2:	5b                   	pop    %rbx
+  8020b3:	41 5c                	pop    %r12
+  8020b5:	41 5d                	pop    %r13
+  8020b7:	41 5e                	pop    %r14
+  8020b9:	41 5f                	pop    %r15
+  8020bb:	5d                   	pop    %rbp
+  8020bc:	c3                   	ret
+        if (inc < 0) return inc;
+  8020bd:	48 98                	cltq
+  8020bf:	eb ed                	jmp    8020ae <readn+0x57>
+    int inc = 1, res = 0;
+  8020c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020c6:	eb e3                	jmp    8020ab <readn+0x54>
+
+00000000008020c8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8020c8:	55                   	push   %rbp
+  8020c9:	48 89 e5             	mov    %rsp,%rbp
+  8020cc:	41 56                	push   %r14
+  8020ce:	41 55                	push   %r13
+  8020d0:	41 54                	push   %r12
+  8020d2:	53                   	push   %rbx
+  8020d3:	48 83 ec 10          	sub    $0x10,%rsp
+  8020d7:	89 fb                	mov    %edi,%ebx
+  8020d9:	49 89 f4             	mov    %rsi,%r12
+  8020dc:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020df:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020e3:	48 b8 b6 1c 80 00 00 	movabs $0x801cb6,%rax
+  8020ea:	00 00 00 
+  8020ed:	ff d0                	call   *%rax
+  8020ef:	85 c0                	test   %eax,%eax
+  8020f1:	78 47                	js     80213a <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020f3:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8020f7:	41 8b 3e             	mov    (%r14),%edi
+  8020fa:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020fe:	48 b8 01 1d 80 00 00 	movabs $0x801d01,%rax
+  802105:	00 00 00 
+  802108:	ff d0                	call   *%rax
+  80210a:	85 c0                	test   %eax,%eax
+  80210c:	78 30                	js     80213e <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80210e:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802113:	74 2d                	je     802142 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802115:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802119:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80211d:	48 85 c0             	test   %rax,%rax
+  802120:	74 56                	je     802178 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802122:	4c 89 ea             	mov    %r13,%rdx
+  802125:	4c 89 e6             	mov    %r12,%rsi
+  802128:	4c 89 f7             	mov    %r14,%rdi
+  80212b:	ff d0                	call   *%rax
+}
+  80212d:	48 83 c4 10          	add    $0x10,%rsp
+  802131:	5b                   	pop    %rbx
+  802132:	41 5c                	pop    %r12
+  802134:	41 5d                	pop    %r13
+  802136:	41 5e                	pop    %r14
+  802138:	5d                   	pop    %rbp
+  802139:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80213a:	48 98                	cltq
+  80213c:	eb ef                	jmp    80212d <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80213e:	48 98                	cltq
+  802140:	eb eb                	jmp    80212d <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802142:	48 a1 10 50 80 00 00 	movabs 0x805010,%rax
+  802149:	00 00 00 
+  80214c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802152:	89 da                	mov    %ebx,%edx
+  802154:	48 bf a5 3c 80 00 00 	movabs $0x803ca5,%rdi
+  80215b:	00 00 00 
+  80215e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802163:	48 b9 b1 06 80 00 00 	movabs $0x8006b1,%rcx
+  80216a:	00 00 00 
+  80216d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80216f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802176:	eb b5                	jmp    80212d <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802178:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80217f:	eb ac                	jmp    80212d <write+0x65>
+
+0000000000802181 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802181:	55                   	push   %rbp
+  802182:	48 89 e5             	mov    %rsp,%rbp
+  802185:	53                   	push   %rbx
+  802186:	48 83 ec 18          	sub    $0x18,%rsp
+  80218a:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80218c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802190:	48 b8 b6 1c 80 00 00 	movabs $0x801cb6,%rax
+  802197:	00 00 00 
+  80219a:	ff d0                	call   *%rax
+  80219c:	85 c0                	test   %eax,%eax
+  80219e:	78 0c                	js     8021ac <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8021a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021a4:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8021a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021b0:	c9                   	leave
+  8021b1:	c3                   	ret
+
+00000000008021b2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8021b2:	55                   	push   %rbp
+  8021b3:	48 89 e5             	mov    %rsp,%rbp
+  8021b6:	41 55                	push   %r13
+  8021b8:	41 54                	push   %r12
+  8021ba:	53                   	push   %rbx
+  8021bb:	48 83 ec 18          	sub    $0x18,%rsp
+  8021bf:	89 fb                	mov    %edi,%ebx
+  8021c1:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021c4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021c8:	48 b8 b6 1c 80 00 00 	movabs $0x801cb6,%rax
+  8021cf:	00 00 00 
+  8021d2:	ff d0                	call   *%rax
+  8021d4:	85 c0                	test   %eax,%eax
+  8021d6:	78 38                	js     802210 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021d8:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8021dc:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8021e0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021e4:	48 b8 01 1d 80 00 00 	movabs $0x801d01,%rax
+  8021eb:	00 00 00 
+  8021ee:	ff d0                	call   *%rax
+  8021f0:	85 c0                	test   %eax,%eax
+  8021f2:	78 1c                	js     802210 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021f4:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8021f9:	74 20                	je     80221b <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021fb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021ff:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802203:	48 85 c0             	test   %rax,%rax
+  802206:	74 47                	je     80224f <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802208:	44 89 e6             	mov    %r12d,%esi
+  80220b:	4c 89 ef             	mov    %r13,%rdi
+  80220e:	ff d0                	call   *%rax
+}
+  802210:	48 83 c4 18          	add    $0x18,%rsp
+  802214:	5b                   	pop    %rbx
+  802215:	41 5c                	pop    %r12
+  802217:	41 5d                	pop    %r13
+  802219:	5d                   	pop    %rbp
+  80221a:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80221b:	48 a1 10 50 80 00 00 	movabs 0x805010,%rax
+  802222:	00 00 00 
+  802225:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80222b:	89 da                	mov    %ebx,%edx
+  80222d:	48 bf 68 3c 80 00 00 	movabs $0x803c68,%rdi
+  802234:	00 00 00 
+  802237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223c:	48 b9 b1 06 80 00 00 	movabs $0x8006b1,%rcx
+  802243:	00 00 00 
+  802246:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802248:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80224d:	eb c1                	jmp    802210 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80224f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802254:	eb ba                	jmp    802210 <ftruncate+0x5e>
+
+0000000000802256 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802256:	55                   	push   %rbp
+  802257:	48 89 e5             	mov    %rsp,%rbp
+  80225a:	41 54                	push   %r12
+  80225c:	53                   	push   %rbx
+  80225d:	48 83 ec 10          	sub    $0x10,%rsp
+  802261:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802264:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802268:	48 b8 b6 1c 80 00 00 	movabs $0x801cb6,%rax
+  80226f:	00 00 00 
+  802272:	ff d0                	call   *%rax
+  802274:	85 c0                	test   %eax,%eax
+  802276:	78 4e                	js     8022c6 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802278:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80227c:	41 8b 3c 24          	mov    (%r12),%edi
+  802280:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802284:	48 b8 01 1d 80 00 00 	movabs $0x801d01,%rax
+  80228b:	00 00 00 
+  80228e:	ff d0                	call   *%rax
+  802290:	85 c0                	test   %eax,%eax
+  802292:	78 32                	js     8022c6 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802294:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802298:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80229d:	74 30                	je     8022cf <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80229f:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8022a2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8022a9:	00 00 00 
+    stat->st_isdir = 0;
+  8022ac:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8022b3:	00 00 00 
+    stat->st_dev = dev;
+  8022b6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8022bd:	48 89 de             	mov    %rbx,%rsi
+  8022c0:	4c 89 e7             	mov    %r12,%rdi
+  8022c3:	ff 50 28             	call   *0x28(%rax)
+}
+  8022c6:	48 83 c4 10          	add    $0x10,%rsp
+  8022ca:	5b                   	pop    %rbx
+  8022cb:	41 5c                	pop    %r12
+  8022cd:	5d                   	pop    %rbp
+  8022ce:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8022cf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022d4:	eb f0                	jmp    8022c6 <fstat+0x70>
+
+00000000008022d6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8022d6:	55                   	push   %rbp
+  8022d7:	48 89 e5             	mov    %rsp,%rbp
+  8022da:	41 54                	push   %r12
+  8022dc:	53                   	push   %rbx
+  8022dd:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8022e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e5:	48 b8 57 25 80 00 00 	movabs $0x802557,%rax
+  8022ec:	00 00 00 
+  8022ef:	ff d0                	call   *%rax
+  8022f1:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8022f3:	85 c0                	test   %eax,%eax
+  8022f5:	78 25                	js     80231c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8022f7:	4c 89 e6             	mov    %r12,%rsi
+  8022fa:	89 c7                	mov    %eax,%edi
+  8022fc:	48 b8 56 22 80 00 00 	movabs $0x802256,%rax
+  802303:	00 00 00 
+  802306:	ff d0                	call   *%rax
+  802308:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80230b:	89 df                	mov    %ebx,%edi
+  80230d:	48 b8 1b 1e 80 00 00 	movabs $0x801e1b,%rax
+  802314:	00 00 00 
+  802317:	ff d0                	call   *%rax
+
+    return res;
+  802319:	44 89 e3             	mov    %r12d,%ebx
+}
+  80231c:	89 d8                	mov    %ebx,%eax
+  80231e:	5b                   	pop    %rbx
+  80231f:	41 5c                	pop    %r12
+  802321:	5d                   	pop    %rbp
+  802322:	c3                   	ret
+
+0000000000802323 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802323:	55                   	push   %rbp
+  802324:	48 89 e5             	mov    %rsp,%rbp
+  802327:	41 54                	push   %r12
+  802329:	53                   	push   %rbx
+  80232a:	48 83 ec 10          	sub    $0x10,%rsp
+  80232e:	41 89 fc             	mov    %edi,%r12d
+  802331:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802334:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80233b:	00 00 00 
+  80233e:	83 38 00             	cmpl   $0x0,(%rax)
+  802341:	74 5e                	je     8023a1 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802343:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802349:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80234e:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802355:	00 00 00 
+  802358:	44 89 e6             	mov    %r12d,%esi
+  80235b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802362:	00 00 00 
+  802365:	8b 38                	mov    (%rax),%edi
+  802367:	48 b8 28 32 80 00 00 	movabs $0x803228,%rax
+  80236e:	00 00 00 
+  802371:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802373:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80237a:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80237b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802380:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802384:	48 89 de             	mov    %rbx,%rsi
+  802387:	bf 00 00 00 00       	mov    $0x0,%edi
+  80238c:	48 b8 93 31 80 00 00 	movabs $0x803193,%rax
+  802393:	00 00 00 
+  802396:	ff d0                	call   *%rax
+}
+  802398:	48 83 c4 10          	add    $0x10,%rsp
+  80239c:	5b                   	pop    %rbx
+  80239d:	41 5c                	pop    %r12
+  80239f:	5d                   	pop    %rbp
+  8023a0:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023a1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023a6:	48 b8 c8 32 80 00 00 	movabs $0x8032c8,%rax
+  8023ad:	00 00 00 
+  8023b0:	ff d0                	call   *%rax
+  8023b2:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8023b9:	00 00 
+  8023bb:	eb 86                	jmp    802343 <fsipc+0x20>
+
+00000000008023bd <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8023bd:	55                   	push   %rbp
+  8023be:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8023c1:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023c8:	00 00 00 
+  8023cb:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8023ce:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8023d0:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8023d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8023dd:	48 b8 23 23 80 00 00 	movabs $0x802323,%rax
+  8023e4:	00 00 00 
+  8023e7:	ff d0                	call   *%rax
+}
+  8023e9:	5d                   	pop    %rbp
+  8023ea:	c3                   	ret
+
+00000000008023eb <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8023eb:	55                   	push   %rbp
+  8023ec:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8023ef:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8023f2:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8023f9:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8023fb:	be 00 00 00 00       	mov    $0x0,%esi
+  802400:	bf 06 00 00 00       	mov    $0x6,%edi
+  802405:	48 b8 23 23 80 00 00 	movabs $0x802323,%rax
+  80240c:	00 00 00 
+  80240f:	ff d0                	call   *%rax
+}
+  802411:	5d                   	pop    %rbp
+  802412:	c3                   	ret
+
+0000000000802413 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802413:	55                   	push   %rbp
+  802414:	48 89 e5             	mov    %rsp,%rbp
+  802417:	41 54                	push   %r12
+  802419:	53                   	push   %rbx
+  80241a:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80241d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802420:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802427:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802429:	be 00 00 00 00       	mov    $0x0,%esi
+  80242e:	bf 05 00 00 00       	mov    $0x5,%edi
+  802433:	48 b8 23 23 80 00 00 	movabs $0x802323,%rax
+  80243a:	00 00 00 
+  80243d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80243f:	85 c0                	test   %eax,%eax
+  802441:	78 3d                	js     802480 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802443:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80244a:	00 00 00 
+  80244d:	4c 89 e6             	mov    %r12,%rsi
+  802450:	48 89 df             	mov    %rbx,%rdi
+  802453:	48 b8 d6 0f 80 00 00 	movabs $0x800fd6,%rax
+  80245a:	00 00 00 
+  80245d:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80245f:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802466:	00 
+  802467:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80246d:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802474:	00 
+  802475:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80247b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802480:	5b                   	pop    %rbx
+  802481:	41 5c                	pop    %r12
+  802483:	5d                   	pop    %rbp
+  802484:	c3                   	ret
+
+0000000000802485 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802485:	55                   	push   %rbp
+  802486:	48 89 e5             	mov    %rsp,%rbp
+  802489:	41 54                	push   %r12
+  80248b:	53                   	push   %rbx
+  80248c:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  80248f:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802494:	48 39 c2             	cmp    %rax,%rdx
+  802497:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80249b:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80249e:	48 89 c2             	mov    %rax,%rdx
+  8024a1:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8024a8:	00 00 00 
+  8024ab:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  8024b2:	00 00 00 
+  8024b5:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024b7:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8024be:	00 00 00 
+  8024c1:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8024c6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8024c8:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8024cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8024d1:	bf 04 00 00 00       	mov    $0x4,%edi
+  8024d6:	48 b8 23 23 80 00 00 	movabs $0x802323,%rax
+  8024dd:	00 00 00 
+  8024e0:	ff d0                	call   *%rax
+  8024e2:	48 98                	cltq
+}
+  8024e4:	5b                   	pop    %rbx
+  8024e5:	41 5c                	pop    %r12
+  8024e7:	5d                   	pop    %rbp
+  8024e8:	c3                   	ret
+
+00000000008024e9 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8024e9:	55                   	push   %rbp
+  8024ea:	48 89 e5             	mov    %rsp,%rbp
+  8024ed:	41 54                	push   %r12
+  8024ef:	53                   	push   %rbx
+  8024f0:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8024f3:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8024fa:	00 00 00 
+  8024fd:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802500:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  802502:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802507:	48 39 ca             	cmp    %rcx,%rdx
+  80250a:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  80250e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  802512:	be 00 00 00 00       	mov    $0x0,%esi
+  802517:	bf 03 00 00 00       	mov    $0x3,%edi
+  80251c:	48 b8 23 23 80 00 00 	movabs $0x802323,%rax
+  802523:	00 00 00 
+  802526:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802528:	85 c0                	test   %eax,%eax
+  80252a:	78 27                	js     802553 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  80252c:	48 63 d8             	movslq %eax,%rbx
+  80252f:	48 89 da             	mov    %rbx,%rdx
+  802532:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802539:	00 00 00 
+  80253c:	4c 89 e7             	mov    %r12,%rdi
+  80253f:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  802546:	00 00 00 
+  802549:	ff d0                	call   *%rax
+    return bytes_read;
+  80254b:	48 89 d8             	mov    %rbx,%rax
+}
+  80254e:	5b                   	pop    %rbx
+  80254f:	41 5c                	pop    %r12
+  802551:	5d                   	pop    %rbp
+  802552:	c3                   	ret
+        return bytes_read;
+  802553:	48 98                	cltq
+  802555:	eb f7                	jmp    80254e <devfile_read+0x65>
+
+0000000000802557 <open>:
+open(const char *path, int mode) {
+  802557:	55                   	push   %rbp
+  802558:	48 89 e5             	mov    %rsp,%rbp
+  80255b:	41 55                	push   %r13
+  80255d:	41 54                	push   %r12
+  80255f:	53                   	push   %rbx
+  802560:	48 83 ec 18          	sub    $0x18,%rsp
+  802564:	49 89 fc             	mov    %rdi,%r12
+  802567:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80256a:	48 b8 98 0f 80 00 00 	movabs $0x800f98,%rax
+  802571:	00 00 00 
+  802574:	ff d0                	call   *%rax
+  802576:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80257c:	0f 87 8a 00 00 00    	ja     80260c <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802582:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802586:	48 b8 56 1c 80 00 00 	movabs $0x801c56,%rax
+  80258d:	00 00 00 
+  802590:	ff d0                	call   *%rax
+  802592:	89 c3                	mov    %eax,%ebx
+  802594:	85 c0                	test   %eax,%eax
+  802596:	78 50                	js     8025e8 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802598:	4c 89 e6             	mov    %r12,%rsi
+  80259b:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8025a2:	00 00 00 
+  8025a5:	48 89 df             	mov    %rbx,%rdi
+  8025a8:	48 b8 d6 0f 80 00 00 	movabs $0x800fd6,%rax
+  8025af:	00 00 00 
+  8025b2:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8025b4:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8025bb:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8025bf:	bf 01 00 00 00       	mov    $0x1,%edi
+  8025c4:	48 b8 23 23 80 00 00 	movabs $0x802323,%rax
+  8025cb:	00 00 00 
+  8025ce:	ff d0                	call   *%rax
+  8025d0:	89 c3                	mov    %eax,%ebx
+  8025d2:	85 c0                	test   %eax,%eax
+  8025d4:	78 1f                	js     8025f5 <open+0x9e>
+    return fd2num(fd);
+  8025d6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025da:	48 b8 28 1c 80 00 00 	movabs $0x801c28,%rax
+  8025e1:	00 00 00 
+  8025e4:	ff d0                	call   *%rax
+  8025e6:	89 c3                	mov    %eax,%ebx
+}
+  8025e8:	89 d8                	mov    %ebx,%eax
+  8025ea:	48 83 c4 18          	add    $0x18,%rsp
+  8025ee:	5b                   	pop    %rbx
+  8025ef:	41 5c                	pop    %r12
+  8025f1:	41 5d                	pop    %r13
+  8025f3:	5d                   	pop    %rbp
+  8025f4:	c3                   	ret
+        fd_close(fd, 0);
+  8025f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8025fa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025fe:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  802605:	00 00 00 
+  802608:	ff d0                	call   *%rax
+        return res;
+  80260a:	eb dc                	jmp    8025e8 <open+0x91>
+        return -E_BAD_PATH;
+  80260c:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802611:	eb d5                	jmp    8025e8 <open+0x91>
+
+0000000000802613 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802613:	55                   	push   %rbp
+  802614:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802617:	be 00 00 00 00       	mov    $0x0,%esi
+  80261c:	bf 08 00 00 00       	mov    $0x8,%edi
+  802621:	48 b8 23 23 80 00 00 	movabs $0x802323,%rax
+  802628:	00 00 00 
+  80262b:	ff d0                	call   *%rax
+}
+  80262d:	5d                   	pop    %rbp
+  80262e:	c3                   	ret
+
+000000000080262f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80262f:	55                   	push   %rbp
+  802630:	48 89 e5             	mov    %rsp,%rbp
+  802633:	41 54                	push   %r12
+  802635:	53                   	push   %rbx
+  802636:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802639:	48 b8 3a 1c 80 00 00 	movabs $0x801c3a,%rax
+  802640:	00 00 00 
+  802643:	ff d0                	call   *%rax
+  802645:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802648:	48 be 00 3d 80 00 00 	movabs $0x803d00,%rsi
+  80264f:	00 00 00 
+  802652:	48 89 df             	mov    %rbx,%rdi
+  802655:	48 b8 d6 0f 80 00 00 	movabs $0x800fd6,%rax
+  80265c:	00 00 00 
+  80265f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802661:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802666:	41 2b 04 24          	sub    (%r12),%eax
+  80266a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802670:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802677:	00 00 00 
+    stat->st_dev = &devpipe;
+  80267a:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802681:	00 00 00 
+  802684:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80268b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802690:	5b                   	pop    %rbx
+  802691:	41 5c                	pop    %r12
+  802693:	5d                   	pop    %rbp
+  802694:	c3                   	ret
+
+0000000000802695 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802695:	55                   	push   %rbp
+  802696:	48 89 e5             	mov    %rsp,%rbp
+  802699:	41 54                	push   %r12
+  80269b:	53                   	push   %rbx
+  80269c:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80269f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026a4:	48 89 fe             	mov    %rdi,%rsi
+  8026a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026ac:	49 bc 52 16 80 00 00 	movabs $0x801652,%r12
+  8026b3:	00 00 00 
+  8026b6:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8026b9:	48 89 df             	mov    %rbx,%rdi
+  8026bc:	48 b8 3a 1c 80 00 00 	movabs $0x801c3a,%rax
+  8026c3:	00 00 00 
+  8026c6:	ff d0                	call   *%rax
+  8026c8:	48 89 c6             	mov    %rax,%rsi
+  8026cb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026d5:	41 ff d4             	call   *%r12
+}
+  8026d8:	5b                   	pop    %rbx
+  8026d9:	41 5c                	pop    %r12
+  8026db:	5d                   	pop    %rbp
+  8026dc:	c3                   	ret
+
+00000000008026dd <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8026dd:	55                   	push   %rbp
+  8026de:	48 89 e5             	mov    %rsp,%rbp
+  8026e1:	41 57                	push   %r15
+  8026e3:	41 56                	push   %r14
+  8026e5:	41 55                	push   %r13
+  8026e7:	41 54                	push   %r12
+  8026e9:	53                   	push   %rbx
+  8026ea:	48 83 ec 18          	sub    $0x18,%rsp
+  8026ee:	49 89 fc             	mov    %rdi,%r12
+  8026f1:	49 89 f5             	mov    %rsi,%r13
+  8026f4:	49 89 d7             	mov    %rdx,%r15
+  8026f7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8026fb:	48 b8 3a 1c 80 00 00 	movabs $0x801c3a,%rax
+  802702:	00 00 00 
+  802705:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802707:	4d 85 ff             	test   %r15,%r15
+  80270a:	0f 84 af 00 00 00    	je     8027bf <devpipe_write+0xe2>
+  802710:	48 89 c3             	mov    %rax,%rbx
+  802713:	4c 89 f8             	mov    %r15,%rax
+  802716:	4d 89 ef             	mov    %r13,%r15
+  802719:	4c 01 e8             	add    %r13,%rax
+  80271c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802720:	49 bd 5a 15 80 00 00 	movabs $0x80155a,%r13
+  802727:	00 00 00 
+            sys_yield();
+  80272a:	49 be f7 14 80 00 00 	movabs $0x8014f7,%r14
+  802731:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802734:	8b 73 04             	mov    0x4(%rbx),%esi
+  802737:	48 63 ce             	movslq %esi,%rcx
+  80273a:	48 63 03             	movslq (%rbx),%rax
+  80273d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802743:	48 39 c1             	cmp    %rax,%rcx
+  802746:	72 2e                	jb     802776 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802748:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80274d:	48 89 da             	mov    %rbx,%rdx
+  802750:	be 00 10 00 00       	mov    $0x1000,%esi
+  802755:	4c 89 e7             	mov    %r12,%rdi
+  802758:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80275b:	85 c0                	test   %eax,%eax
+  80275d:	74 66                	je     8027c5 <devpipe_write+0xe8>
+            sys_yield();
+  80275f:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802762:	8b 73 04             	mov    0x4(%rbx),%esi
+  802765:	48 63 ce             	movslq %esi,%rcx
+  802768:	48 63 03             	movslq (%rbx),%rax
+  80276b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802771:	48 39 c1             	cmp    %rax,%rcx
+  802774:	73 d2                	jae    802748 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802776:	41 0f b6 3f          	movzbl (%r15),%edi
+  80277a:	48 89 ca             	mov    %rcx,%rdx
+  80277d:	48 c1 ea 03          	shr    $0x3,%rdx
+  802781:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802788:	08 10 20 
+  80278b:	48 f7 e2             	mul    %rdx
+  80278e:	48 c1 ea 06          	shr    $0x6,%rdx
+  802792:	48 89 d0             	mov    %rdx,%rax
+  802795:	48 c1 e0 09          	shl    $0x9,%rax
+  802799:	48 29 d0             	sub    %rdx,%rax
+  80279c:	48 c1 e0 03          	shl    $0x3,%rax
+  8027a0:	48 29 c1             	sub    %rax,%rcx
+  8027a3:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8027a8:	83 c6 01             	add    $0x1,%esi
+  8027ab:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8027ae:	49 83 c7 01          	add    $0x1,%r15
+  8027b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027b6:	49 39 c7             	cmp    %rax,%r15
+  8027b9:	0f 85 75 ff ff ff    	jne    802734 <devpipe_write+0x57>
+    return n;
+  8027bf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8027c3:	eb 05                	jmp    8027ca <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8027c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027ca:	48 83 c4 18          	add    $0x18,%rsp
+  8027ce:	5b                   	pop    %rbx
+  8027cf:	41 5c                	pop    %r12
+  8027d1:	41 5d                	pop    %r13
+  8027d3:	41 5e                	pop    %r14
+  8027d5:	41 5f                	pop    %r15
+  8027d7:	5d                   	pop    %rbp
+  8027d8:	c3                   	ret
+
+00000000008027d9 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8027d9:	55                   	push   %rbp
+  8027da:	48 89 e5             	mov    %rsp,%rbp
+  8027dd:	41 57                	push   %r15
+  8027df:	41 56                	push   %r14
+  8027e1:	41 55                	push   %r13
+  8027e3:	41 54                	push   %r12
+  8027e5:	53                   	push   %rbx
+  8027e6:	48 83 ec 18          	sub    $0x18,%rsp
+  8027ea:	49 89 fc             	mov    %rdi,%r12
+  8027ed:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8027f1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8027f5:	48 b8 3a 1c 80 00 00 	movabs $0x801c3a,%rax
+  8027fc:	00 00 00 
+  8027ff:	ff d0                	call   *%rax
+  802801:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802804:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80280a:	49 bd 5a 15 80 00 00 	movabs $0x80155a,%r13
+  802811:	00 00 00 
+            sys_yield();
+  802814:	49 be f7 14 80 00 00 	movabs $0x8014f7,%r14
+  80281b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80281e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802823:	74 7d                	je     8028a2 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802825:	8b 03                	mov    (%rbx),%eax
+  802827:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80282a:	75 26                	jne    802852 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80282c:	4d 85 ff             	test   %r15,%r15
+  80282f:	75 77                	jne    8028a8 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802831:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802836:	48 89 da             	mov    %rbx,%rdx
+  802839:	be 00 10 00 00       	mov    $0x1000,%esi
+  80283e:	4c 89 e7             	mov    %r12,%rdi
+  802841:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802844:	85 c0                	test   %eax,%eax
+  802846:	74 72                	je     8028ba <devpipe_read+0xe1>
+            sys_yield();
+  802848:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80284b:	8b 03                	mov    (%rbx),%eax
+  80284d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802850:	74 df                	je     802831 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802852:	48 63 c8             	movslq %eax,%rcx
+  802855:	48 89 ca             	mov    %rcx,%rdx
+  802858:	48 c1 ea 03          	shr    $0x3,%rdx
+  80285c:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802863:	08 10 20 
+  802866:	48 89 d0             	mov    %rdx,%rax
+  802869:	48 f7 e6             	mul    %rsi
+  80286c:	48 c1 ea 06          	shr    $0x6,%rdx
+  802870:	48 89 d0             	mov    %rdx,%rax
+  802873:	48 c1 e0 09          	shl    $0x9,%rax
+  802877:	48 29 d0             	sub    %rdx,%rax
+  80287a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802881:	00 
+  802882:	48 89 c8             	mov    %rcx,%rax
+  802885:	48 29 d0             	sub    %rdx,%rax
+  802888:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80288d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802891:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802895:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802898:	49 83 c7 01          	add    $0x1,%r15
+  80289c:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8028a0:	75 83                	jne    802825 <devpipe_read+0x4c>
+    return n;
+  8028a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028a6:	eb 03                	jmp    8028ab <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8028a8:	4c 89 f8             	mov    %r15,%rax
+}
+  8028ab:	48 83 c4 18          	add    $0x18,%rsp
+  8028af:	5b                   	pop    %rbx
+  8028b0:	41 5c                	pop    %r12
+  8028b2:	41 5d                	pop    %r13
+  8028b4:	41 5e                	pop    %r14
+  8028b6:	41 5f                	pop    %r15
+  8028b8:	5d                   	pop    %rbp
+  8028b9:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8028ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bf:	eb ea                	jmp    8028ab <devpipe_read+0xd2>
+
+00000000008028c1 <pipe>:
+pipe(int pfd[2]) {
+  8028c1:	55                   	push   %rbp
+  8028c2:	48 89 e5             	mov    %rsp,%rbp
+  8028c5:	41 55                	push   %r13
+  8028c7:	41 54                	push   %r12
+  8028c9:	53                   	push   %rbx
+  8028ca:	48 83 ec 18          	sub    $0x18,%rsp
+  8028ce:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8028d1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8028d5:	48 b8 56 1c 80 00 00 	movabs $0x801c56,%rax
+  8028dc:	00 00 00 
+  8028df:	ff d0                	call   *%rax
+  8028e1:	89 c3                	mov    %eax,%ebx
+  8028e3:	85 c0                	test   %eax,%eax
+  8028e5:	0f 88 a0 01 00 00    	js     802a8b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8028eb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8028f0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028f5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8028f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028fe:	48 b8 86 15 80 00 00 	movabs $0x801586,%rax
+  802905:	00 00 00 
+  802908:	ff d0                	call   *%rax
+  80290a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80290c:	85 c0                	test   %eax,%eax
+  80290e:	0f 88 77 01 00 00    	js     802a8b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802914:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802918:	48 b8 56 1c 80 00 00 	movabs $0x801c56,%rax
+  80291f:	00 00 00 
+  802922:	ff d0                	call   *%rax
+  802924:	89 c3                	mov    %eax,%ebx
+  802926:	85 c0                	test   %eax,%eax
+  802928:	0f 88 43 01 00 00    	js     802a71 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80292e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802933:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802938:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80293c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802941:	48 b8 86 15 80 00 00 	movabs $0x801586,%rax
+  802948:	00 00 00 
+  80294b:	ff d0                	call   *%rax
+  80294d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80294f:	85 c0                	test   %eax,%eax
+  802951:	0f 88 1a 01 00 00    	js     802a71 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802957:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80295b:	48 b8 3a 1c 80 00 00 	movabs $0x801c3a,%rax
+  802962:	00 00 00 
+  802965:	ff d0                	call   *%rax
+  802967:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80296a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80296f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802974:	48 89 c6             	mov    %rax,%rsi
+  802977:	bf 00 00 00 00       	mov    $0x0,%edi
+  80297c:	48 b8 86 15 80 00 00 	movabs $0x801586,%rax
+  802983:	00 00 00 
+  802986:	ff d0                	call   *%rax
+  802988:	89 c3                	mov    %eax,%ebx
+  80298a:	85 c0                	test   %eax,%eax
+  80298c:	0f 88 c5 00 00 00    	js     802a57 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802992:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802996:	48 b8 3a 1c 80 00 00 	movabs $0x801c3a,%rax
+  80299d:	00 00 00 
+  8029a0:	ff d0                	call   *%rax
+  8029a2:	48 89 c1             	mov    %rax,%rcx
+  8029a5:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8029ab:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8029b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b6:	4c 89 ee             	mov    %r13,%rsi
+  8029b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029be:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  8029c5:	00 00 00 
+  8029c8:	ff d0                	call   *%rax
+  8029ca:	89 c3                	mov    %eax,%ebx
+  8029cc:	85 c0                	test   %eax,%eax
+  8029ce:	78 6e                	js     802a3e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8029d0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029d5:	4c 89 ef             	mov    %r13,%rdi
+  8029d8:	48 b8 28 15 80 00 00 	movabs $0x801528,%rax
+  8029df:	00 00 00 
+  8029e2:	ff d0                	call   *%rax
+  8029e4:	83 f8 02             	cmp    $0x2,%eax
+  8029e7:	0f 85 ab 00 00 00    	jne    802a98 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8029ed:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8029f4:	00 00 
+  8029f6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8029fa:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8029fc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802a00:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802a07:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802a0b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802a0d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a11:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802a18:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802a1c:	48 bb 28 1c 80 00 00 	movabs $0x801c28,%rbx
+  802a23:	00 00 00 
+  802a26:	ff d3                	call   *%rbx
+  802a28:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802a2c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802a30:	ff d3                	call   *%rbx
+  802a32:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802a37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a3c:	eb 4d                	jmp    802a8b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802a3e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a43:	4c 89 ee             	mov    %r13,%rsi
+  802a46:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a4b:	48 b8 52 16 80 00 00 	movabs $0x801652,%rax
+  802a52:	00 00 00 
+  802a55:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802a57:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a5c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802a60:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a65:	48 b8 52 16 80 00 00 	movabs $0x801652,%rax
+  802a6c:	00 00 00 
+  802a6f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802a71:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a76:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802a7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a7f:	48 b8 52 16 80 00 00 	movabs $0x801652,%rax
+  802a86:	00 00 00 
+  802a89:	ff d0                	call   *%rax
+}
+  802a8b:	89 d8                	mov    %ebx,%eax
+  802a8d:	48 83 c4 18          	add    $0x18,%rsp
+  802a91:	5b                   	pop    %rbx
+  802a92:	41 5c                	pop    %r12
+  802a94:	41 5d                	pop    %r13
+  802a96:	5d                   	pop    %rbp
+  802a97:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802a98:	48 b9 18 3d 80 00 00 	movabs $0x803d18,%rcx
+  802a9f:	00 00 00 
+  802aa2:	48 ba f1 35 80 00 00 	movabs $0x8035f1,%rdx
+  802aa9:	00 00 00 
+  802aac:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802ab1:	48 bf 07 3d 80 00 00 	movabs $0x803d07,%rdi
+  802ab8:	00 00 00 
+  802abb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac0:	49 b8 61 05 80 00 00 	movabs $0x800561,%r8
+  802ac7:	00 00 00 
+  802aca:	41 ff d0             	call   *%r8
+
+0000000000802acd <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802acd:	55                   	push   %rbp
+  802ace:	48 89 e5             	mov    %rsp,%rbp
+  802ad1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802ad5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802ad9:	48 b8 b6 1c 80 00 00 	movabs $0x801cb6,%rax
+  802ae0:	00 00 00 
+  802ae3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ae5:	85 c0                	test   %eax,%eax
+  802ae7:	78 35                	js     802b1e <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802ae9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802aed:	48 b8 3a 1c 80 00 00 	movabs $0x801c3a,%rax
+  802af4:	00 00 00 
+  802af7:	ff d0                	call   *%rax
+  802af9:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802afc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b01:	be 00 10 00 00       	mov    $0x1000,%esi
+  802b06:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802b0a:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  802b11:	00 00 00 
+  802b14:	ff d0                	call   *%rax
+  802b16:	85 c0                	test   %eax,%eax
+  802b18:	0f 94 c0             	sete   %al
+  802b1b:	0f b6 c0             	movzbl %al,%eax
+}
+  802b1e:	c9                   	leave
+  802b1f:	c3                   	ret
+
+0000000000802b20 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802b20:	48 89 f8             	mov    %rdi,%rax
+  802b23:	48 c1 e8 27          	shr    $0x27,%rax
+  802b27:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802b2e:	01 00 00 
+  802b31:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b35:	f6 c2 01             	test   $0x1,%dl
+  802b38:	74 6d                	je     802ba7 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802b3a:	48 89 f8             	mov    %rdi,%rax
+  802b3d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b41:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802b48:	01 00 00 
+  802b4b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b4f:	f6 c2 01             	test   $0x1,%dl
+  802b52:	74 62                	je     802bb6 <get_uvpt_entry+0x96>
+  802b54:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802b5b:	01 00 00 
+  802b5e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b62:	f6 c2 80             	test   $0x80,%dl
+  802b65:	75 4f                	jne    802bb6 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802b67:	48 89 f8             	mov    %rdi,%rax
+  802b6a:	48 c1 e8 15          	shr    $0x15,%rax
+  802b6e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802b75:	01 00 00 
+  802b78:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b7c:	f6 c2 01             	test   $0x1,%dl
+  802b7f:	74 44                	je     802bc5 <get_uvpt_entry+0xa5>
+  802b81:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802b88:	01 00 00 
+  802b8b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b8f:	f6 c2 80             	test   $0x80,%dl
+  802b92:	75 31                	jne    802bc5 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802b94:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802b98:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b9f:	01 00 00 
+  802ba2:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802ba6:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802ba7:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802bae:	01 00 00 
+  802bb1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802bb5:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802bb6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802bbd:	01 00 00 
+  802bc0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802bc4:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802bc5:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802bcc:	01 00 00 
+  802bcf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802bd3:	c3                   	ret
+
+0000000000802bd4 <get_prot>:
+
+int
+get_prot(void *va) {
+  802bd4:	55                   	push   %rbp
+  802bd5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802bd8:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  802bdf:	00 00 00 
+  802be2:	ff d0                	call   *%rax
+  802be4:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802be7:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802bec:	89 c1                	mov    %eax,%ecx
+  802bee:	83 c9 04             	or     $0x4,%ecx
+  802bf1:	f6 c2 01             	test   $0x1,%dl
+  802bf4:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802bf7:	89 c1                	mov    %eax,%ecx
+  802bf9:	83 c9 02             	or     $0x2,%ecx
+  802bfc:	f6 c2 02             	test   $0x2,%dl
+  802bff:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802c02:	89 c1                	mov    %eax,%ecx
+  802c04:	83 c9 01             	or     $0x1,%ecx
+  802c07:	48 85 d2             	test   %rdx,%rdx
+  802c0a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802c0d:	89 c1                	mov    %eax,%ecx
+  802c0f:	83 c9 40             	or     $0x40,%ecx
+  802c12:	f6 c6 04             	test   $0x4,%dh
+  802c15:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802c18:	5d                   	pop    %rbp
+  802c19:	c3                   	ret
+
+0000000000802c1a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802c1a:	55                   	push   %rbp
+  802c1b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802c1e:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  802c25:	00 00 00 
+  802c28:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802c2a:	48 c1 e8 06          	shr    $0x6,%rax
+  802c2e:	83 e0 01             	and    $0x1,%eax
+}
+  802c31:	5d                   	pop    %rbp
+  802c32:	c3                   	ret
+
+0000000000802c33 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802c33:	55                   	push   %rbp
+  802c34:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802c37:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  802c3e:	00 00 00 
+  802c41:	ff d0                	call   *%rax
+  802c43:	83 e0 01             	and    $0x1,%eax
+}
+  802c46:	5d                   	pop    %rbp
+  802c47:	c3                   	ret
+
+0000000000802c48 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802c48:	55                   	push   %rbp
+  802c49:	48 89 e5             	mov    %rsp,%rbp
+  802c4c:	41 57                	push   %r15
+  802c4e:	41 56                	push   %r14
+  802c50:	41 55                	push   %r13
+  802c52:	41 54                	push   %r12
+  802c54:	53                   	push   %rbx
+  802c55:	48 83 ec 18          	sub    $0x18,%rsp
+  802c59:	49 89 ff             	mov    %rdi,%r15
+  802c5c:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802c60:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802c65:	49 bc 33 2c 80 00 00 	movabs $0x802c33,%r12
+  802c6c:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802c6f:	49 be d4 2b 80 00 00 	movabs $0x802bd4,%r14
+  802c76:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802c79:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802c80:	00 00 00 
+  802c83:	eb 0c                	jmp    802c91 <foreach_shared_region+0x49>
+  802c85:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c8c:	4c 39 eb             	cmp    %r13,%rbx
+  802c8f:	74 38                	je     802cc9 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802c91:	48 89 df             	mov    %rbx,%rdi
+  802c94:	41 ff d4             	call   *%r12
+  802c97:	84 c0                	test   %al,%al
+  802c99:	74 ea                	je     802c85 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802c9b:	48 89 df             	mov    %rbx,%rdi
+  802c9e:	41 ff d6             	call   *%r14
+  802ca1:	a8 40                	test   $0x40,%al
+  802ca3:	74 e0                	je     802c85 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802ca5:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802cac:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802cb0:	48 89 df             	mov    %rbx,%rdi
+  802cb3:	41 ff d7             	call   *%r15
+        if (err)
+  802cb6:	85 c0                	test   %eax,%eax
+  802cb8:	74 cb                	je     802c85 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802cba:	48 83 c4 18          	add    $0x18,%rsp
+  802cbe:	5b                   	pop    %rbx
+  802cbf:	41 5c                	pop    %r12
+  802cc1:	41 5d                	pop    %r13
+  802cc3:	41 5e                	pop    %r14
+  802cc5:	41 5f                	pop    %r15
+  802cc7:	5d                   	pop    %rbp
+  802cc8:	c3                   	ret
+    return 0;
+  802cc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cce:	eb ea                	jmp    802cba <foreach_shared_region+0x72>
+
+0000000000802cd0 <_generic_signal_handler>:
+        (es->sa.sa_handler)(es->signo);
+    }
+}
+
+void
+_generic_signal_handler(struct UTrapframe *utf, struct EnqueuedSignal * es) {
+  802cd0:	55                   	push   %rbp
+  802cd1:	48 89 e5             	mov    %rsp,%rbp
+  802cd4:	41 55                	push   %r13
+  802cd6:	41 54                	push   %r12
+  802cd8:	53                   	push   %rbx
+  802cd9:	48 83 ec 08          	sub    $0x8,%rsp
+  802cdd:	49 89 fc             	mov    %rdi,%r12
+  802ce0:	48 89 f3             	mov    %rsi,%rbx
+    if (trace_signals)
+        cprintf("signals: env %x: begin generic handler for %d\n", sys_getenvid(), es->signo);
+  802ce3:	44 8b 2e             	mov    (%rsi),%r13d
+  802ce6:	48 b8 c6 14 80 00 00 	movabs $0x8014c6,%rax
+  802ced:	00 00 00 
+  802cf0:	ff d0                	call   *%rax
+  802cf2:	89 c6                	mov    %eax,%esi
+  802cf4:	44 89 ea             	mov    %r13d,%edx
+  802cf7:	48 bf 40 3d 80 00 00 	movabs $0x803d40,%rdi
+  802cfe:	00 00 00 
+  802d01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d06:	48 b9 b1 06 80 00 00 	movabs $0x8006b1,%rcx
+  802d0d:	00 00 00 
+  802d10:	ff d1                	call   *%rcx
+    if (es->sa.sa_handler == SIG_DFL) {
+  802d12:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  802d16:	48 85 c0             	test   %rax,%rax
+  802d19:	74 57                	je     802d72 <_generic_signal_handler+0xa2>
+    if (es->sa.sa_handler == SIG_IGN) {
+  802d1b:	48 83 f8 01          	cmp    $0x1,%rax
+  802d1f:	0f 84 c0 00 00 00    	je     802de5 <_generic_signal_handler+0x115>
+    if (es->sa.sa_flags & SA_SIGINFO) {
+  802d25:	f6 43 14 04          	testb  $0x4,0x14(%rbx)
+  802d29:	0f 84 ea 00 00 00    	je     802e19 <_generic_signal_handler+0x149>
+        (es->sa.sa_sigaction)(es->signo, &(es->info), utf);
+  802d2f:	48 8d 73 18          	lea    0x18(%rbx),%rsi
+  802d33:	8b 3b                	mov    (%rbx),%edi
+  802d35:	4c 89 e2             	mov    %r12,%rdx
+  802d38:	ff d0                	call   *%rax
+
+    _generic_signal_handler_impl(utf, es);
+
+    if (trace_signals)
+        cprintf("signals: env %x: end generic handler for %d\n", sys_getenvid(), es->signo);
+  802d3a:	8b 1b                	mov    (%rbx),%ebx
+  802d3c:	48 b8 c6 14 80 00 00 	movabs $0x8014c6,%rax
+  802d43:	00 00 00 
+  802d46:	ff d0                	call   *%rax
+  802d48:	89 c6                	mov    %eax,%esi
+  802d4a:	89 da                	mov    %ebx,%edx
+  802d4c:	48 bf c8 3d 80 00 00 	movabs $0x803dc8,%rdi
+  802d53:	00 00 00 
+  802d56:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d5b:	48 b9 b1 06 80 00 00 	movabs $0x8006b1,%rcx
+  802d62:	00 00 00 
+  802d65:	ff d1                	call   *%rcx
+}
+  802d67:	48 83 c4 08          	add    $0x8,%rsp
+  802d6b:	5b                   	pop    %rbx
+  802d6c:	41 5c                	pop    %r12
+  802d6e:	41 5d                	pop    %r13
+  802d70:	5d                   	pop    %rbp
+  802d71:	c3                   	ret
+            cprintf("signals: env %x: exiting due to signal %d\n", sys_getenvid(), es->signo);
+  802d72:	8b 1b                	mov    (%rbx),%ebx
+  802d74:	48 b8 c6 14 80 00 00 	movabs $0x8014c6,%rax
+  802d7b:	00 00 00 
+  802d7e:	ff d0                	call   *%rax
+  802d80:	89 c6                	mov    %eax,%esi
+  802d82:	89 da                	mov    %ebx,%edx
+  802d84:	48 bf 70 3d 80 00 00 	movabs $0x803d70,%rdi
+  802d8b:	00 00 00 
+  802d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d93:	48 b9 b1 06 80 00 00 	movabs $0x8006b1,%rcx
+  802d9a:	00 00 00 
+  802d9d:	ff d1                	call   *%rcx
+        sys_env_destroy(CURENVID);
+  802d9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802da4:	48 b8 5b 14 80 00 00 	movabs $0x80145b,%rax
+  802dab:	00 00 00 
+  802dae:	ff d0                	call   *%rax
+        assert(false);
+  802db0:	48 b9 f5 3d 80 00 00 	movabs $0x803df5,%rcx
+  802db7:	00 00 00 
+  802dba:	48 ba f1 35 80 00 00 	movabs $0x8035f1,%rdx
+  802dc1:	00 00 00 
+  802dc4:	be 0c 00 00 00       	mov    $0xc,%esi
+  802dc9:	48 bf fb 3d 80 00 00 	movabs $0x803dfb,%rdi
+  802dd0:	00 00 00 
+  802dd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd8:	49 b8 61 05 80 00 00 	movabs $0x800561,%r8
+  802ddf:	00 00 00 
+  802de2:	41 ff d0             	call   *%r8
+            cprintf("signals: env %x: ignoring signal %d\n", sys_getenvid(), es->signo);
+  802de5:	44 8b 23             	mov    (%rbx),%r12d
+  802de8:	48 b8 c6 14 80 00 00 	movabs $0x8014c6,%rax
+  802def:	00 00 00 
+  802df2:	ff d0                	call   *%rax
+  802df4:	89 c6                	mov    %eax,%esi
+  802df6:	44 89 e2             	mov    %r12d,%edx
+  802df9:	48 bf a0 3d 80 00 00 	movabs $0x803da0,%rdi
+  802e00:	00 00 00 
+  802e03:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e08:	48 b9 b1 06 80 00 00 	movabs $0x8006b1,%rcx
+  802e0f:	00 00 00 
+  802e12:	ff d1                	call   *%rcx
+        return;
+  802e14:	e9 21 ff ff ff       	jmp    802d3a <_generic_signal_handler+0x6a>
+        (es->sa.sa_handler)(es->signo);
+  802e19:	8b 3b                	mov    (%rbx),%edi
+  802e1b:	ff d0                	call   *%rax
+  802e1d:	e9 18 ff ff ff       	jmp    802d3a <_generic_signal_handler+0x6a>
+
+0000000000802e22 <sigqueue>:
+
+int sigqueue(pid_t pid, int signo, const union sigval value) {
+  802e22:	55                   	push   %rbp
+  802e23:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigqueue(pid, signo, value);
+  802e26:	48 b8 8a 19 80 00 00 	movabs $0x80198a,%rax
+  802e2d:	00 00 00 
+  802e30:	ff d0                	call   *%rax
+}
+  802e32:	5d                   	pop    %rbp
+  802e33:	c3                   	ret
+
+0000000000802e34 <sigwait>:
+
+int sigwait(const sigset_t * set, int * sig) {
+  802e34:	55                   	push   %rbp
+  802e35:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigwait(set, sig);
+  802e38:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  802e3f:	00 00 00 
+  802e42:	ff d0                	call   *%rax
+}
+  802e44:	5d                   	pop    %rbp
+  802e45:	c3                   	ret
+
+0000000000802e46 <sigaction>:
+
+extern void _signal_handler_trampoline(void);
+
+int sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  802e46:	55                   	push   %rbp
+  802e47:	48 89 e5             	mov    %rsp,%rbp
+  802e4a:	41 55                	push   %r13
+  802e4c:	41 54                	push   %r12
+  802e4e:	53                   	push   %rbx
+  802e4f:	48 83 ec 08          	sub    $0x8,%rsp
+  802e53:	89 fb                	mov    %edi,%ebx
+  802e55:	49 89 f4             	mov    %rsi,%r12
+  802e58:	49 89 d5             	mov    %rdx,%r13
+    int err = sys_env_set_pgfault_upcall(CURENVID, _signal_handler_trampoline);
+  802e5b:	48 be d8 30 80 00 00 	movabs $0x8030d8,%rsi
+  802e62:	00 00 00 
+  802e65:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e6a:	48 b8 5b 18 80 00 00 	movabs $0x80185b,%rax
+  802e71:	00 00 00 
+  802e74:	ff d0                	call   *%rax
+    if (err)
+  802e76:	85 c0                	test   %eax,%eax
+  802e78:	74 0b                	je     802e85 <sigaction+0x3f>
+        return err;
+    return sys_sigaction(sig, act, oact);
+}
+  802e7a:	48 83 c4 08          	add    $0x8,%rsp
+  802e7e:	5b                   	pop    %rbx
+  802e7f:	41 5c                	pop    %r12
+  802e81:	41 5d                	pop    %r13
+  802e83:	5d                   	pop    %rbp
+  802e84:	c3                   	ret
+    return sys_sigaction(sig, act, oact);
+  802e85:	4c 89 ea             	mov    %r13,%rdx
+  802e88:	4c 89 e6             	mov    %r12,%rsi
+  802e8b:	89 df                	mov    %ebx,%edi
+  802e8d:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  802e94:	00 00 00 
+  802e97:	ff d0                	call   *%rax
+  802e99:	eb df                	jmp    802e7a <sigaction+0x34>
+
+0000000000802e9b <sigprocmask>:
+
+int sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  802e9b:	55                   	push   %rbp
+  802e9c:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigprocmask(how, set, oldset);
+  802e9f:	48 b8 c1 1a 80 00 00 	movabs $0x801ac1,%rax
+  802ea6:	00 00 00 
+  802ea9:	ff d0                	call   *%rax
+}
+  802eab:	5d                   	pop    %rbp
+  802eac:	c3                   	ret
+
+0000000000802ead <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802ead:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb2:	c3                   	ret
+
+0000000000802eb3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802eb3:	55                   	push   %rbp
+  802eb4:	48 89 e5             	mov    %rsp,%rbp
+  802eb7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802eba:	48 be 08 3e 80 00 00 	movabs $0x803e08,%rsi
+  802ec1:	00 00 00 
+  802ec4:	48 b8 d6 0f 80 00 00 	movabs $0x800fd6,%rax
+  802ecb:	00 00 00 
+  802ece:	ff d0                	call   *%rax
+    return 0;
+}
+  802ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ed5:	5d                   	pop    %rbp
+  802ed6:	c3                   	ret
+
+0000000000802ed7 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802ed7:	55                   	push   %rbp
+  802ed8:	48 89 e5             	mov    %rsp,%rbp
+  802edb:	41 57                	push   %r15
+  802edd:	41 56                	push   %r14
+  802edf:	41 55                	push   %r13
+  802ee1:	41 54                	push   %r12
+  802ee3:	53                   	push   %rbx
+  802ee4:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802eeb:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802ef2:	48 85 d2             	test   %rdx,%rdx
+  802ef5:	74 7a                	je     802f71 <devcons_write+0x9a>
+  802ef7:	49 89 d6             	mov    %rdx,%r14
+  802efa:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802f00:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802f05:	49 bf d0 11 80 00 00 	movabs $0x8011d0,%r15
+  802f0c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802f0f:	4c 89 f3             	mov    %r14,%rbx
+  802f12:	48 29 f3             	sub    %rsi,%rbx
+  802f15:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802f1a:	48 39 c3             	cmp    %rax,%rbx
+  802f1d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802f21:	4c 63 eb             	movslq %ebx,%r13
+  802f24:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802f2b:	48 01 c6             	add    %rax,%rsi
+  802f2e:	4c 89 ea             	mov    %r13,%rdx
+  802f31:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802f38:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802f3b:	4c 89 ee             	mov    %r13,%rsi
+  802f3e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802f45:	48 b8 fd 13 80 00 00 	movabs $0x8013fd,%rax
+  802f4c:	00 00 00 
+  802f4f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802f51:	41 01 dc             	add    %ebx,%r12d
+  802f54:	49 63 f4             	movslq %r12d,%rsi
+  802f57:	4c 39 f6             	cmp    %r14,%rsi
+  802f5a:	72 b3                	jb     802f0f <devcons_write+0x38>
+    return res;
+  802f5c:	49 63 c4             	movslq %r12d,%rax
+}
+  802f5f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802f66:	5b                   	pop    %rbx
+  802f67:	41 5c                	pop    %r12
+  802f69:	41 5d                	pop    %r13
+  802f6b:	41 5e                	pop    %r14
+  802f6d:	41 5f                	pop    %r15
+  802f6f:	5d                   	pop    %rbp
+  802f70:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802f71:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802f77:	eb e3                	jmp    802f5c <devcons_write+0x85>
+
+0000000000802f79 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802f79:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802f7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f81:	48 85 c0             	test   %rax,%rax
+  802f84:	74 55                	je     802fdb <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802f86:	55                   	push   %rbp
+  802f87:	48 89 e5             	mov    %rsp,%rbp
+  802f8a:	41 55                	push   %r13
+  802f8c:	41 54                	push   %r12
+  802f8e:	53                   	push   %rbx
+  802f8f:	48 83 ec 08          	sub    $0x8,%rsp
+  802f93:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802f96:	48 bb 2a 14 80 00 00 	movabs $0x80142a,%rbx
+  802f9d:	00 00 00 
+  802fa0:	49 bc f7 14 80 00 00 	movabs $0x8014f7,%r12
+  802fa7:	00 00 00 
+  802faa:	eb 03                	jmp    802faf <devcons_read+0x36>
+  802fac:	41 ff d4             	call   *%r12
+  802faf:	ff d3                	call   *%rbx
+  802fb1:	85 c0                	test   %eax,%eax
+  802fb3:	74 f7                	je     802fac <devcons_read+0x33>
+    if (c < 0) return c;
+  802fb5:	48 63 d0             	movslq %eax,%rdx
+  802fb8:	78 13                	js     802fcd <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802fba:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fbf:	83 f8 04             	cmp    $0x4,%eax
+  802fc2:	74 09                	je     802fcd <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802fc4:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802fc8:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802fcd:	48 89 d0             	mov    %rdx,%rax
+  802fd0:	48 83 c4 08          	add    $0x8,%rsp
+  802fd4:	5b                   	pop    %rbx
+  802fd5:	41 5c                	pop    %r12
+  802fd7:	41 5d                	pop    %r13
+  802fd9:	5d                   	pop    %rbp
+  802fda:	c3                   	ret
+  802fdb:	48 89 d0             	mov    %rdx,%rax
+  802fde:	c3                   	ret
+
+0000000000802fdf <cputchar>:
+cputchar(int ch) {
+  802fdf:	55                   	push   %rbp
+  802fe0:	48 89 e5             	mov    %rsp,%rbp
+  802fe3:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802fe7:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802feb:	be 01 00 00 00       	mov    $0x1,%esi
+  802ff0:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802ff4:	48 b8 fd 13 80 00 00 	movabs $0x8013fd,%rax
+  802ffb:	00 00 00 
+  802ffe:	ff d0                	call   *%rax
+}
+  803000:	c9                   	leave
+  803001:	c3                   	ret
+
+0000000000803002 <getchar>:
+getchar(void) {
+  803002:	55                   	push   %rbp
+  803003:	48 89 e5             	mov    %rsp,%rbp
+  803006:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80300a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80300f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803013:	bf 00 00 00 00       	mov    $0x0,%edi
+  803018:	48 b8 99 1f 80 00 00 	movabs $0x801f99,%rax
+  80301f:	00 00 00 
+  803022:	ff d0                	call   *%rax
+  803024:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803026:	85 c0                	test   %eax,%eax
+  803028:	78 06                	js     803030 <getchar+0x2e>
+  80302a:	74 08                	je     803034 <getchar+0x32>
+  80302c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803030:	89 d0                	mov    %edx,%eax
+  803032:	c9                   	leave
+  803033:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803034:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803039:	eb f5                	jmp    803030 <getchar+0x2e>
+
+000000000080303b <iscons>:
+iscons(int fdnum) {
+  80303b:	55                   	push   %rbp
+  80303c:	48 89 e5             	mov    %rsp,%rbp
+  80303f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803043:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803047:	48 b8 b6 1c 80 00 00 	movabs $0x801cb6,%rax
+  80304e:	00 00 00 
+  803051:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803053:	85 c0                	test   %eax,%eax
+  803055:	78 18                	js     80306f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803057:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80305b:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  803062:	00 00 00 
+  803065:	8b 00                	mov    (%rax),%eax
+  803067:	39 02                	cmp    %eax,(%rdx)
+  803069:	0f 94 c0             	sete   %al
+  80306c:	0f b6 c0             	movzbl %al,%eax
+}
+  80306f:	c9                   	leave
+  803070:	c3                   	ret
+
+0000000000803071 <opencons>:
+opencons(void) {
+  803071:	55                   	push   %rbp
+  803072:	48 89 e5             	mov    %rsp,%rbp
+  803075:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803079:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80307d:	48 b8 56 1c 80 00 00 	movabs $0x801c56,%rax
+  803084:	00 00 00 
+  803087:	ff d0                	call   *%rax
+  803089:	85 c0                	test   %eax,%eax
+  80308b:	78 49                	js     8030d6 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80308d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803092:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803097:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80309b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030a0:	48 b8 86 15 80 00 00 	movabs $0x801586,%rax
+  8030a7:	00 00 00 
+  8030aa:	ff d0                	call   *%rax
+  8030ac:	85 c0                	test   %eax,%eax
+  8030ae:	78 26                	js     8030d6 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8030b0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8030b4:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  8030bb:	00 00 
+  8030bd:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8030bf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8030c3:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8030ca:	48 b8 28 1c 80 00 00 	movabs $0x801c28,%rax
+  8030d1:	00 00 00 
+  8030d4:	ff d0                	call   *%rax
+}
+  8030d6:	c9                   	leave
+  8030d7:	c3                   	ret
+
+00000000008030d8 <_pgfault_upcall>:
+.text
+.globl _pgfault_upcall
+.globl _signal_handler_trampoline
+_pgfault_upcall:
+_signal_handler_trampoline:
+    movq  %rsp,%rdi # passing the function argument (UTrapframe *) in rdi
+  8030d8:	48 89 e7             	mov    %rsp,%rdi
+    # sizeof(struct EnqueuedSignal) == 56
+    # sizeof(curenv->env_sig_mask) == 4
+    # + 4 bytes of alignment
+    add $64, %rdi
+  8030db:	48 83 c7 40          	add    $0x40,%rdi
+
+    # load signo
+    mov (%rsp), %eax
+  8030df:	8b 04 24             	mov    (%rsp),%eax
+    test %eax, %eax
+  8030e2:	85 c0                	test   %eax,%eax
+    jnz _call_generic_signal_handler
+  8030e4:	75 0e                	jne    8030f4 <_call_generic_signal_handler>
+
+    # Call the C page fault handler.
+    movabs $_handle_vectored_pagefault, %rax
+  8030e6:	48 b8 18 33 80 00 00 	movabs $0x803318,%rax
+  8030ed:	00 00 00 
+    call *%rax
+  8030f0:	ff d0                	call   *%rax
+    jmp _return_from_handler
+  8030f2:	eb 0f                	jmp    803103 <_return_from_handler>
+
+00000000008030f4 <_call_generic_signal_handler>:
+
+_call_generic_signal_handler:
+    movq %rsp, %rsi # passing the function argument (EnqueuedSignal *) in rsi
+  8030f4:	48 89 e6             	mov    %rsp,%rsi
+    movabs $_generic_signal_handler, %rax
+  8030f7:	48 b8 d0 2c 80 00 00 	movabs $0x802cd0,%rax
+  8030fe:	00 00 00 
+    call *%rax
+  803101:	ff d0                	call   *%rax
+
+0000000000803103 <_return_from_handler>:
+
+_return_from_handler:
+    # ignore EnqueuedSignal and env_sig_mask
+    add $64, %rsp
+  803103:	48 83 c4 40          	add    $0x40,%rsp
+    # put SIG_SETMASK as the first func arg
+    movq $3, %rdi
+  803107:	48 c7 c7 03 00 00 00 	mov    $0x3,%rdi
+    # load &env_sig_mask (as the second func arg)
+    lea -4(%rsp), %rsi
+  80310e:	48 8d 74 24 fc       	lea    -0x4(%rsp),%rsi
+    # NULL as the third arg
+    xor %rdx, %rdx
+  803113:	48 31 d2             	xor    %rdx,%rdx
+    # restore blocked signals mask
+    movabs $sys_sigprocmask, %rax
+  803116:	48 b8 c1 1a 80 00 00 	movabs $0x801ac1,%rax
+  80311d:	00 00 00 
+    call *%rax
+  803120:	ff d0                	call   *%rax
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    # ignore utf_fault_va, utf_err
+    addq $16, %rsp
+  803122:	48 83 c4 10          	add    $0x10,%rsp
+    # restore utf_regs, save rax again
+    POPA
+  803126:	4c 8b 3c 24          	mov    (%rsp),%r15
+  80312a:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80312f:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  803134:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  803139:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80313e:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  803143:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  803148:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80314d:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  803152:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  803157:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80315c:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  803161:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  803166:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80316b:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  803170:	48 83 c4 78          	add    $0x78,%rsp
+    pushq %rax
+  803174:	50                   	push   %rax
+    # 16 utf_rflags
+    #  8 utf_rip
+    #  0 rax
+
+    # load utf_rip
+    movq 8(%rsp), %rax
+  803175:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    # save rbx to utf_rip
+    movq %rbx, 8(%rsp)
+  80317a:	48 89 5c 24 08       	mov    %rbx,0x8(%rsp)
+    # load utf_rsp
+    movq 24(%rsp), %rbx
+  80317f:	48 8b 5c 24 18       	mov    0x18(%rsp),%rbx
+    # store return address to *utf_stack
+    subq $8, 24(%rsp)
+  803184:	48 83 6c 24 18 08    	subq   $0x8,0x18(%rsp)
+    movq %rax, -8(%rbx)
+  80318a:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    # restore rax and rbx
+    popq %rax
+  80318e:	58                   	pop    %rax
+    popq %rbx
+  80318f:	5b                   	pop    %rbx
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+    popfq
+  803190:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    popq %rsp
+  803191:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  803192:	c3                   	ret
+
+0000000000803193 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803193:	55                   	push   %rbp
+  803194:	48 89 e5             	mov    %rsp,%rbp
+  803197:	41 54                	push   %r12
+  803199:	53                   	push   %rbx
+  80319a:	48 89 fb             	mov    %rdi,%rbx
+  80319d:	48 89 f7             	mov    %rsi,%rdi
+  8031a0:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8031a3:	48 85 f6             	test   %rsi,%rsi
+  8031a6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8031ad:	00 00 00 
+  8031b0:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8031b4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031b9:	48 b8 f0 18 80 00 00 	movabs $0x8018f0,%rax
+  8031c0:	00 00 00 
+  8031c3:	ff d0                	call   *%rax
+    if (res < 0) {
+  8031c5:	85 c0                	test   %eax,%eax
+  8031c7:	78 45                	js     80320e <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8031c9:	48 85 db             	test   %rbx,%rbx
+  8031cc:	74 12                	je     8031e0 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8031ce:	48 a1 10 50 80 00 00 	movabs 0x805010,%rax
+  8031d5:	00 00 00 
+  8031d8:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8031de:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  8031e0:	4d 85 e4             	test   %r12,%r12
+  8031e3:	74 14                	je     8031f9 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  8031e5:	48 a1 10 50 80 00 00 	movabs 0x805010,%rax
+  8031ec:	00 00 00 
+  8031ef:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8031f5:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  8031f9:	48 a1 10 50 80 00 00 	movabs 0x805010,%rax
+  803200:	00 00 00 
+  803203:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  803209:	5b                   	pop    %rbx
+  80320a:	41 5c                	pop    %r12
+  80320c:	5d                   	pop    %rbp
+  80320d:	c3                   	ret
+        if (from_env_store)
+  80320e:	48 85 db             	test   %rbx,%rbx
+  803211:	74 06                	je     803219 <ipc_recv+0x86>
+            *from_env_store = 0;
+  803213:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  803219:	4d 85 e4             	test   %r12,%r12
+  80321c:	74 eb                	je     803209 <ipc_recv+0x76>
+            *perm_store = 0;
+  80321e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803225:	00 
+  803226:	eb e1                	jmp    803209 <ipc_recv+0x76>
+
+0000000000803228 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803228:	55                   	push   %rbp
+  803229:	48 89 e5             	mov    %rsp,%rbp
+  80322c:	41 57                	push   %r15
+  80322e:	41 56                	push   %r14
+  803230:	41 55                	push   %r13
+  803232:	41 54                	push   %r12
+  803234:	53                   	push   %rbx
+  803235:	48 83 ec 18          	sub    $0x18,%rsp
+  803239:	41 89 fd             	mov    %edi,%r13d
+  80323c:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80323f:	48 89 d3             	mov    %rdx,%rbx
+  803242:	49 89 cc             	mov    %rcx,%r12
+  803245:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  803249:	48 85 d2             	test   %rdx,%rdx
+  80324c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803253:	00 00 00 
+  803256:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80325a:	49 be c4 18 80 00 00 	movabs $0x8018c4,%r14
+  803261:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  803264:	49 bf f7 14 80 00 00 	movabs $0x8014f7,%r15
+  80326b:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80326e:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803271:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  803275:	4c 89 e1             	mov    %r12,%rcx
+  803278:	48 89 da             	mov    %rbx,%rdx
+  80327b:	44 89 ef             	mov    %r13d,%edi
+  80327e:	41 ff d6             	call   *%r14
+        if (res == 0)
+  803281:	85 c0                	test   %eax,%eax
+  803283:	74 34                	je     8032b9 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  803285:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803288:	75 05                	jne    80328f <ipc_send+0x67>
+        sys_yield();
+  80328a:	41 ff d7             	call   *%r15
+    while (true) {
+  80328d:	eb df                	jmp    80326e <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  80328f:	48 ba 14 3e 80 00 00 	movabs $0x803e14,%rdx
+  803296:	00 00 00 
+  803299:	be 3e 00 00 00       	mov    $0x3e,%esi
+  80329e:	48 bf 2d 3e 80 00 00 	movabs $0x803e2d,%rdi
+  8032a5:	00 00 00 
+  8032a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ad:	48 b9 61 05 80 00 00 	movabs $0x800561,%rcx
+  8032b4:	00 00 00 
+  8032b7:	ff d1                	call   *%rcx
+    }
+}
+  8032b9:	48 83 c4 18          	add    $0x18,%rsp
+  8032bd:	5b                   	pop    %rbx
+  8032be:	41 5c                	pop    %r12
+  8032c0:	41 5d                	pop    %r13
+  8032c2:	41 5e                	pop    %r14
+  8032c4:	41 5f                	pop    %r15
+  8032c6:	5d                   	pop    %rbp
+  8032c7:	c3                   	ret
+
+00000000008032c8 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8032c8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8032cd:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8032d4:	00 00 00 
+  8032d7:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  8032de:	48 01 ca             	add    %rcx,%rdx
+  8032e1:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8032e7:	39 fa                	cmp    %edi,%edx
+  8032e9:	74 12                	je     8032fd <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8032eb:	48 83 c0 01          	add    $0x1,%rax
+  8032ef:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8032f5:	75 e0                	jne    8032d7 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8032f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032fc:	c3                   	ret
+            return envs[i].env_id;
+  8032fd:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  803304:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80330b:	00 00 00 
+  80330e:	48 01 d0             	add    %rdx,%rax
+  803311:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803317:	c3                   	ret
+
+0000000000803318 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  803318:	55                   	push   %rbp
+  803319:	48 89 e5             	mov    %rsp,%rbp
+  80331c:	41 56                	push   %r14
+  80331e:	41 55                	push   %r13
+  803320:	41 54                	push   %r12
+  803322:	53                   	push   %rbx
+  803323:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803326:	48 b8 68 70 80 00 00 	movabs $0x807068,%rax
+  80332d:	00 00 00 
+  803330:	48 83 38 00          	cmpq   $0x0,(%rax)
+  803334:	74 27                	je     80335d <_handle_vectored_pagefault+0x45>
+  803336:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80333b:	49 bd 20 70 80 00 00 	movabs $0x807020,%r13
+  803342:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803345:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  803348:	4c 89 e7             	mov    %r12,%rdi
+  80334b:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  803350:	84 c0                	test   %al,%al
+  803352:	75 45                	jne    803399 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803354:	48 83 c3 01          	add    $0x1,%rbx
+  803358:	49 3b 1e             	cmp    (%r14),%rbx
+  80335b:	72 eb                	jb     803348 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80335d:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  803364:	00 
+  803365:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80336a:	4d 8b 04 24          	mov    (%r12),%r8
+  80336e:	48 ba 38 3e 80 00 00 	movabs $0x803e38,%rdx
+  803375:	00 00 00 
+  803378:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80337d:	48 bf cf 3e 80 00 00 	movabs $0x803ecf,%rdi
+  803384:	00 00 00 
+  803387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80338c:	49 ba 61 05 80 00 00 	movabs $0x800561,%r10
+  803393:	00 00 00 
+  803396:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  803399:	5b                   	pop    %rbx
+  80339a:	41 5c                	pop    %r12
+  80339c:	41 5d                	pop    %r13
+  80339e:	41 5e                	pop    %r14
+  8033a0:	5d                   	pop    %rbp
+  8033a1:	c3                   	ret
+
+00000000008033a2 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8033a2:	55                   	push   %rbp
+  8033a3:	48 89 e5             	mov    %rsp,%rbp
+  8033a6:	53                   	push   %rbx
+  8033a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8033ab:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8033ae:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  8033b5:	00 00 00 
+  8033b8:	80 38 00             	cmpb   $0x0,(%rax)
+  8033bb:	74 61                	je     80341e <add_pgfault_handler+0x7c>
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8033bd:	48 b8 68 70 80 00 00 	movabs $0x807068,%rax
+  8033c4:	00 00 00 
+  8033c7:	48 8b 10             	mov    (%rax),%rdx
+  8033ca:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8033cf:	48 b9 20 70 80 00 00 	movabs $0x807020,%rcx
+  8033d6:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8033d9:	48 85 d2             	test   %rdx,%rdx
+  8033dc:	74 19                	je     8033f7 <add_pgfault_handler+0x55>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8033de:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8033e2:	74 2f                	je     803413 <add_pgfault_handler+0x71>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8033e4:	48 83 c0 01          	add    $0x1,%rax
+  8033e8:	48 39 d0             	cmp    %rdx,%rax
+  8033eb:	75 f1                	jne    8033de <add_pgfault_handler+0x3c>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8033ed:	48 83 fa 08          	cmp    $0x8,%rdx
+  8033f1:	0f 84 f7 00 00 00    	je     8034ee <add_pgfault_handler+0x14c>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8033f7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8033fb:	48 a3 68 70 80 00 00 	movabs %rax,0x807068
+  803402:	00 00 00 
+  803405:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  80340c:	00 00 00 
+  80340f:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  803413:	b8 00 00 00 00       	mov    $0x0,%eax
+  803418:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80341c:	c9                   	leave
+  80341d:	c3                   	ret
+        if (sys_alloc_region(CURENVID, ues_beg, PAGE_SIZE, PROT_RW))
+  80341e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803423:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803428:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80342f:	00 00 00 
+  803432:	bf 00 00 00 00       	mov    $0x0,%edi
+  803437:	48 b8 86 15 80 00 00 	movabs $0x801586,%rax
+  80343e:	00 00 00 
+  803441:	ff d0                	call   *%rax
+  803443:	85 c0                	test   %eax,%eax
+  803445:	75 53                	jne    80349a <add_pgfault_handler+0xf8>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  803447:	48 ba 68 70 80 00 00 	movabs $0x807068,%rdx
+  80344e:	00 00 00 
+  803451:	48 8b 02             	mov    (%rdx),%rax
+  803454:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803458:	48 89 0a             	mov    %rcx,(%rdx)
+  80345b:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803462:	00 00 00 
+  803465:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        if (sys_env_set_pgfault_upcall(CURENVID, _pgfault_upcall))
+  803469:	48 be d8 30 80 00 00 	movabs $0x8030d8,%rsi
+  803470:	00 00 00 
+  803473:	bf 00 00 00 00       	mov    $0x0,%edi
+  803478:	48 b8 5b 18 80 00 00 	movabs $0x80185b,%rax
+  80347f:	00 00 00 
+  803482:	ff d0                	call   *%rax
+  803484:	85 c0                	test   %eax,%eax
+  803486:	75 3c                	jne    8034c4 <add_pgfault_handler+0x122>
+        _pfhandler_inititiallized = 1;
+  803488:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  80348f:	00 00 00 
+  803492:	c6 00 01             	movb   $0x1,(%rax)
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803495:	e9 79 ff ff ff       	jmp    803413 <add_pgfault_handler+0x71>
+            panic("add_pgfault_handler: sys_alloc_region failed");
+  80349a:	48 ba 68 3e 80 00 00 	movabs $0x803e68,%rdx
+  8034a1:	00 00 00 
+  8034a4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8034a9:	48 bf cf 3e 80 00 00 	movabs $0x803ecf,%rdi
+  8034b0:	00 00 00 
+  8034b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b8:	48 b9 61 05 80 00 00 	movabs $0x800561,%rcx
+  8034bf:	00 00 00 
+  8034c2:	ff d1                	call   *%rcx
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+  8034c4:	48 ba 98 3e 80 00 00 	movabs $0x803e98,%rdx
+  8034cb:	00 00 00 
+  8034ce:	be 32 00 00 00       	mov    $0x32,%esi
+  8034d3:	48 bf cf 3e 80 00 00 	movabs $0x803ecf,%rdi
+  8034da:	00 00 00 
+  8034dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034e2:	48 b9 61 05 80 00 00 	movabs $0x800561,%rcx
+  8034e9:	00 00 00 
+  8034ec:	ff d1                	call   *%rcx
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8034ee:	b9 fd ff ff ff       	mov    $0xfffffffd,%ecx
+  8034f3:	48 ba dd 3e 80 00 00 	movabs $0x803edd,%rdx
+  8034fa:	00 00 00 
+  8034fd:	be 40 00 00 00       	mov    $0x40,%esi
+  803502:	48 bf cf 3e 80 00 00 	movabs $0x803ecf,%rdi
+  803509:	00 00 00 
+  80350c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803511:	49 b8 61 05 80 00 00 	movabs $0x800561,%r8
+  803518:	00 00 00 
+  80351b:	41 ff d0             	call   *%r8
+
+000000000080351e <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80351e:	55                   	push   %rbp
+  80351f:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  803522:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  803529:	00 00 00 
+  80352c:	80 38 00             	cmpb   $0x0,(%rax)
+  80352f:	74 33                	je     803564 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803531:	48 a1 68 70 80 00 00 	movabs 0x807068,%rax
+  803538:	00 00 00 
+  80353b:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  803540:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803547:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80354a:	48 85 c0             	test   %rax,%rax
+  80354d:	0f 84 85 00 00 00    	je     8035d8 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  803553:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  803557:	74 40                	je     803599 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803559:	48 83 c1 01          	add    $0x1,%rcx
+  80355d:	48 39 c1             	cmp    %rax,%rcx
+  803560:	75 f1                	jne    803553 <remove_pgfault_handler+0x35>
+  803562:	eb 74                	jmp    8035d8 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  803564:	48 b9 f5 3e 80 00 00 	movabs $0x803ef5,%rcx
+  80356b:	00 00 00 
+  80356e:	48 ba f1 35 80 00 00 	movabs $0x8035f1,%rdx
+  803575:	00 00 00 
+  803578:	be 46 00 00 00       	mov    $0x46,%esi
+  80357d:	48 bf cf 3e 80 00 00 	movabs $0x803ecf,%rdi
+  803584:	00 00 00 
+  803587:	b8 00 00 00 00       	mov    $0x0,%eax
+  80358c:	49 b8 61 05 80 00 00 	movabs $0x800561,%r8
+  803593:	00 00 00 
+  803596:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  803599:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8035a0:	00 
+  8035a1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8035a5:	48 29 ca             	sub    %rcx,%rdx
+  8035a8:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  8035af:	00 00 00 
+  8035b2:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8035b6:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8035bb:	48 89 ce             	mov    %rcx,%rsi
+  8035be:	48 b8 d0 11 80 00 00 	movabs $0x8011d0,%rax
+  8035c5:	00 00 00 
+  8035c8:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8035ca:	48 b8 68 70 80 00 00 	movabs $0x807068,%rax
+  8035d1:	00 00 00 
+  8035d4:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8035d8:	5d                   	pop    %rbp
+  8035d9:	c3                   	ret
+  8035da:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000008035e0 <__rodata_start>:
+  8035e0:	73 69                	jae    80364b <__rodata_start+0x6b>
+  8035e2:	67 6e                	outsb  %ds:(%esi),(%dx)
+  8035e4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035e5:	20 3d 3d 20 53 49    	and    %bh,0x4953203d(%rip)        # 49d35628 <__bss_end+0x4952d628>
+  8035eb:	47 55                	rex.RXB push %r13
+  8035ed:	53                   	push   %rbx
+  8035ee:	52                   	push   %rdx
+  8035ef:	31 00                	xor    %eax,(%rax)
+  8035f1:	61                   	(bad)
+  8035f2:	73 73                	jae    803667 <__rodata_start+0x87>
+  8035f4:	65 72 74             	gs jb  80366b <__rodata_start+0x8b>
+  8035f7:	69 6f 6e 20 66 61 69 	imul   $0x69616620,0x6e(%rdi),%ebp
+  8035fe:	6c                   	insb   (%dx),%es:(%rdi)
+  8035ff:	65 64 3a 20          	gs cmp %fs:(%rax),%ah
+  803603:	25 73 00 75 73       	and    $0x73750073,%eax
+  803608:	65 72 2f             	gs jb  80363a <__rodata_start+0x5a>
+  80360b:	70 72                	jo     80367f <__rodata_start+0x9f>
+  80360d:	69 6d 65 73 73 69 67 	imul   $0x67697373,0x65(%rbp),%ebp
+  803614:	2e 63 00             	cs movsxd (%rax),%eax
+  803617:	21 75 70             	and    %esi,0x70(%rbp)
+  80361a:	64 61                	fs (bad)
+  80361c:	74 65                	je     803683 <__rodata_start+0xa3>
+  80361e:	64 00 73 69          	add    %dh,%fs:0x69(%rbx)
+  803622:	67 71 75             	addr32 jno 80369a <__rodata_start+0xba>
+  803625:	65 75 65             	gs jne 80368d <__rodata_start+0xad>
+  803628:	20 66 61             	and    %ah,0x61(%rsi)
+  80362b:	69 6c 65 64 0a 00 73 	imul   $0x6973000a,0x64(%rbp,%riz,2),%ebp
+  803632:	69 
+  803633:	67 70 72             	addr32 jo 8036a8 <__rodata_start+0xc8>
+  803636:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803637:	63 6d 61             	movsxd 0x61(%rbp),%ebp
+  80363a:	73 6b                	jae    8036a7 <__rodata_start+0xc7>
+  80363c:	20 66 61             	and    %ah,0x61(%rsi)
+  80363f:	69 6c 65 64 0a 00 73 	imul   $0x6973000a,0x64(%rbp,%riz,2),%ebp
+  803646:	69 
+  803647:	67 77 61             	addr32 ja 8036ab <__rodata_start+0xcb>
+  80364a:	69 74 20 66 61 69 6c 	imul   $0x656c6961,0x66(%rax,%riz,1),%esi
+  803651:	65 
+  803652:	64 0a 00             	or     %fs:(%rax),%al
+  803655:	73 69                	jae    8036c0 <__rodata_start+0xe0>
+  803657:	67 20 3d 3d 20 53 49 	and    %bh,0x4953203d(%eip)        # 49d3569b <__bss_end+0x4952d69b>
+  80365e:	47 55                	rex.RXB push %r13
+  803660:	53                   	push   %rbx
+  803661:	52                   	push   %rdx
+  803662:	32 00                	xor    (%rax),%al
+  803664:	25 64 20 00 66       	and    $0x66002064,%eax
+  803669:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80366a:	72 6b                	jb     8036d7 <__rodata_start+0xf7>
+  80366c:	3a 20                	cmp    (%rax),%ah
+  80366e:	25 69 00 3c 75       	and    $0x753c0069,%eax
+  803673:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803674:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803678:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803679:	3e 00 0f             	ds add %cl,(%rdi)
+  80367c:	1f                   	(bad)
+  80367d:	44 00 00             	add    %r8b,(%rax)
+  803680:	5b                   	pop    %rbx
+  803681:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803686:	20 75 73             	and    %dh,0x73(%rbp)
+  803689:	65 72 20             	gs jb  8036ac <__rodata_start+0xcc>
+  80368c:	70 61                	jo     8036ef <__rodata_start+0x10f>
+  80368e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80368f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803696:	73 20                	jae    8036b8 <__rodata_start+0xd8>
+  803698:	61                   	(bad)
+  803699:	74 20                	je     8036bb <__rodata_start+0xdb>
+  80369b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  8036a0:	3a 20                	cmp    (%rax),%ah
+  8036a2:	00 30                	add    %dh,(%rax)
+  8036a4:	31 32                	xor    %esi,(%rdx)
+  8036a6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8036ad:	41                   	rex.B
+  8036ae:	42                   	rex.X
+  8036af:	43                   	rex.XB
+  8036b0:	44                   	rex.R
+  8036b1:	45                   	rex.RB
+  8036b2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8036b5:	31 32                	xor    %esi,(%rdx)
+  8036b7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8036be:	61                   	(bad)
+  8036bf:	62 63 64 65 66       	(bad)
+  8036c4:	00 28                	add    %ch,(%rax)
+  8036c6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036c7:	75 6c                	jne    803735 <__rodata_start+0x155>
+  8036c9:	6c                   	insb   (%dx),%es:(%rdi)
+  8036ca:	29 00                	sub    %eax,(%rax)
+  8036cc:	65 72 72             	gs jb  803741 <__rodata_start+0x161>
+  8036cf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036d0:	72 20                	jb     8036f2 <__rodata_start+0x112>
+  8036d2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8036d7:	73 70                	jae    803749 <__rodata_start+0x169>
+  8036d9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8036dd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8036e4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036e5:	72 00                	jb     8036e7 <__rodata_start+0x107>
+  8036e7:	62 61 64 20 65       	(bad)
+  8036ec:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036ed:	76 69                	jbe    803758 <__rodata_start+0x178>
+  8036ef:	72 6f                	jb     803760 <__rodata_start+0x180>
+  8036f1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036f2:	6d                   	insl   (%dx),%es:(%rdi)
+  8036f3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8036f5:	74 00                	je     8036f7 <__rodata_start+0x117>
+  8036f7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8036fe:	20 70 61             	and    %dh,0x61(%rax)
+  803701:	72 61                	jb     803764 <__rodata_start+0x184>
+  803703:	6d                   	insl   (%dx),%es:(%rdi)
+  803704:	65 74 65             	gs je  80376c <__rodata_start+0x18c>
+  803707:	72 00                	jb     803709 <__rodata_start+0x129>
+  803709:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80370a:	75 74                	jne    803780 <__rodata_start+0x1a0>
+  80370c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80370f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803712:	6d                   	insl   (%dx),%es:(%rdi)
+  803713:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803714:	72 79                	jb     80378f <__rodata_start+0x1af>
+  803716:	00 6f 75             	add    %ch,0x75(%rdi)
+  803719:	74 20                	je     80373b <__rodata_start+0x15b>
+  80371b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80371c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803720:	76 69                	jbe    80378b <__rodata_start+0x1ab>
+  803722:	72 6f                	jb     803793 <__rodata_start+0x1b3>
+  803724:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803725:	6d                   	insl   (%dx),%es:(%rdi)
+  803726:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803728:	74 73                	je     80379d <__rodata_start+0x1bd>
+  80372a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80372d:	72 72                	jb     8037a1 <__rodata_start+0x1c1>
+  80372f:	75 70                	jne    8037a1 <__rodata_start+0x1c1>
+  803731:	74 65                	je     803798 <__rodata_start+0x1b8>
+  803733:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803738:	75 67                	jne    8037a1 <__rodata_start+0x1c1>
+  80373a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80373d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80373f:	00 73 65             	add    %dh,0x65(%rbx)
+  803742:	67 6d                	insl   (%dx),%es:(%edi)
+  803744:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803746:	74 61                	je     8037a9 <__rodata_start+0x1c9>
+  803748:	74 69                	je     8037b3 <__rodata_start+0x1d3>
+  80374a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80374b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80374c:	20 66 61             	and    %ah,0x61(%rsi)
+  80374f:	75 6c                	jne    8037bd <__rodata_start+0x1dd>
+  803751:	74 00                	je     803753 <__rodata_start+0x173>
+  803753:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80375a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80375d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803761:	61                   	(bad)
+  803762:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803767:	20 73 75             	and    %dh,0x75(%rbx)
+  80376a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80376d:	73 79                	jae    8037e8 <__rodata_start+0x208>
+  80376f:	73 74                	jae    8037e5 <__rodata_start+0x205>
+  803771:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803773:	20 63 61             	and    %ah,0x61(%rbx)
+  803776:	6c                   	insb   (%dx),%es:(%rdi)
+  803777:	6c                   	insb   (%dx),%es:(%rdi)
+  803778:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80377b:	74 72                	je     8037ef <__rodata_start+0x20f>
+  80377d:	79 20                	jns    80379f <__rodata_start+0x1bf>
+  80377f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803780:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803781:	74 20                	je     8037a3 <__rodata_start+0x1c3>
+  803783:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803785:	75 6e                	jne    8037f5 <__rodata_start+0x215>
+  803787:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80378b:	76 20                	jbe    8037ad <__rodata_start+0x1cd>
+  80378d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803794:	72 65                	jb     8037fb <__rodata_start+0x21b>
+  803796:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803799:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80379a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80379e:	65 78 70             	gs js  803811 <__rodata_start+0x231>
+  8037a1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8037a6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8037a9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8037ad:	20 66 69             	and    %ah,0x69(%rsi)
+  8037b0:	6c                   	insb   (%dx),%es:(%rdi)
+  8037b1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8037b5:	20 66 72             	and    %ah,0x72(%rsi)
+  8037b8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8037bd:	61                   	(bad)
+  8037be:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8037c1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037c2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037c3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8037c7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8037ca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037cb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037cc:	20 6d 61             	and    %ch,0x61(%rbp)
+  8037cf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037d0:	79 20                	jns    8037f2 <__rodata_start+0x212>
+  8037d2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8037d9:	72 65                	jb     803840 <__rodata_start+0x260>
+  8037db:	20 6f 70             	and    %ch,0x70(%rdi)
+  8037de:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8037e0:	00 66 69             	add    %ah,0x69(%rsi)
+  8037e3:	6c                   	insb   (%dx),%es:(%rdi)
+  8037e4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8037e8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8037eb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037ec:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8037ef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037f0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037f1:	74 20                	je     803813 <__rodata_start+0x233>
+  8037f3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8037f5:	75 6e                	jne    803865 <__rodata_start+0x285>
+  8037f7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8037fb:	76 61                	jbe    80385e <__rodata_start+0x27e>
+  8037fd:	6c                   	insb   (%dx),%es:(%rdi)
+  8037fe:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803805:	00 
+  803806:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80380d:	72 65                	jb     803874 <__rodata_start+0x294>
+  80380f:	61                   	(bad)
+  803810:	64 79 20             	fs jns 803833 <__rodata_start+0x253>
+  803813:	65 78 69             	gs js  80387f <__rodata_start+0x29f>
+  803816:	73 74                	jae    80388c <__rodata_start+0x2ac>
+  803818:	73 00                	jae    80381a <__rodata_start+0x23a>
+  80381a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80381b:	70 65                	jo     803882 <__rodata_start+0x2a2>
+  80381d:	72 61                	jb     803880 <__rodata_start+0x2a0>
+  80381f:	74 69                	je     80388a <__rodata_start+0x2aa>
+  803821:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803822:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803823:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803826:	74 20                	je     803848 <__rodata_start+0x268>
+  803828:	73 75                	jae    80389f <__rodata_start+0x2bf>
+  80382a:	70 70                	jo     80389c <__rodata_start+0x2bc>
+  80382c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80382d:	72 74                	jb     8038a3 <__rodata_start+0x2c3>
+  80382f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803834:	65 72 61             	gs jb  803898 <__rodata_start+0x2b8>
+  803837:	74 69                	je     8038a2 <__rodata_start+0x2c2>
+  803839:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80383a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80383b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80383e:	74 20                	je     803860 <__rodata_start+0x280>
+  803840:	70 65                	jo     8038a7 <__rodata_start+0x2c7>
+  803842:	72 6d                	jb     8038b1 <__rodata_start+0x2d1>
+  803844:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  80384b:	2e 
+  80384c:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803853:	00 
+  803854:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80385b:	00 00 00 
+  80385e:	66 90                	xchg   %ax,%ax
+  803860:	9e                   	sahf
+  803861:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803867:	00 df                	add    %bl,%bh
+  803869:	0e                   	(bad)
+  80386a:	80 00 00             	addb   $0x0,(%rax)
+  80386d:	00 00                	add    %al,(%rax)
+  80386f:	00 cf                	add    %cl,%bh
+  803871:	0e                   	(bad)
+  803872:	80 00 00             	addb   $0x0,(%rax)
+  803875:	00 00                	add    %al,(%rax)
+  803877:	00 df                	add    %bl,%bh
+  803879:	0e                   	(bad)
+  80387a:	80 00 00             	addb   $0x0,(%rax)
+  80387d:	00 00                	add    %al,(%rax)
+  80387f:	00 df                	add    %bl,%bh
+  803881:	0e                   	(bad)
+  803882:	80 00 00             	addb   $0x0,(%rax)
+  803885:	00 00                	add    %al,(%rax)
+  803887:	00 df                	add    %bl,%bh
+  803889:	0e                   	(bad)
+  80388a:	80 00 00             	addb   $0x0,(%rax)
+  80388d:	00 00                	add    %al,(%rax)
+  80388f:	00 df                	add    %bl,%bh
+  803891:	0e                   	(bad)
+  803892:	80 00 00             	addb   $0x0,(%rax)
+  803895:	00 00                	add    %al,(%rax)
+  803897:	00 bd 08 80 00 00    	add    %bh,0x8008(%rbp)
+  80389d:	00 00                	add    %al,(%rax)
+  80389f:	00 df                	add    %bl,%bh
+  8038a1:	0e                   	(bad)
+  8038a2:	80 00 00             	addb   $0x0,(%rax)
+  8038a5:	00 00                	add    %al,(%rax)
+  8038a7:	00 df                	add    %bl,%bh
+  8038a9:	0e                   	(bad)
+  8038aa:	80 00 00             	addb   $0x0,(%rax)
+  8038ad:	00 00                	add    %al,(%rax)
+  8038af:	00 b1 08 80 00 00    	add    %dh,0x8008(%rcx)
+  8038b5:	00 00                	add    %al,(%rax)
+  8038b7:	00 2b                	add    %ch,(%rbx)
+  8038b9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8038bf:	00 df                	add    %bl,%bh
+  8038c1:	0e                   	(bad)
+  8038c2:	80 00 00             	addb   $0x0,(%rax)
+  8038c5:	00 00                	add    %al,(%rax)
+  8038c7:	00 b1 08 80 00 00    	add    %dh,0x8008(%rcx)
+  8038cd:	00 00                	add    %al,(%rax)
+  8038cf:	00 f7                	add    %dh,%bh
+  8038d1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8038d7:	00 f7                	add    %dh,%bh
+  8038d9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8038df:	00 f7                	add    %dh,%bh
+  8038e1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8038e7:	00 f7                	add    %dh,%bh
+  8038e9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8038ef:	00 f7                	add    %dh,%bh
+  8038f1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8038f7:	00 f7                	add    %dh,%bh
+  8038f9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8038ff:	00 f7                	add    %dh,%bh
+  803901:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803907:	00 f7                	add    %dh,%bh
+  803909:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80390f:	00 f7                	add    %dh,%bh
+  803911:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803917:	00 df                	add    %bl,%bh
+  803919:	0e                   	(bad)
+  80391a:	80 00 00             	addb   $0x0,(%rax)
+  80391d:	00 00                	add    %al,(%rax)
+  80391f:	00 df                	add    %bl,%bh
+  803921:	0e                   	(bad)
+  803922:	80 00 00             	addb   $0x0,(%rax)
+  803925:	00 00                	add    %al,(%rax)
+  803927:	00 df                	add    %bl,%bh
+  803929:	0e                   	(bad)
+  80392a:	80 00 00             	addb   $0x0,(%rax)
+  80392d:	00 00                	add    %al,(%rax)
+  80392f:	00 df                	add    %bl,%bh
+  803931:	0e                   	(bad)
+  803932:	80 00 00             	addb   $0x0,(%rax)
+  803935:	00 00                	add    %al,(%rax)
+  803937:	00 df                	add    %bl,%bh
+  803939:	0e                   	(bad)
+  80393a:	80 00 00             	addb   $0x0,(%rax)
+  80393d:	00 00                	add    %al,(%rax)
+  80393f:	00 df                	add    %bl,%bh
+  803941:	0e                   	(bad)
+  803942:	80 00 00             	addb   $0x0,(%rax)
+  803945:	00 00                	add    %al,(%rax)
+  803947:	00 df                	add    %bl,%bh
+  803949:	0e                   	(bad)
+  80394a:	80 00 00             	addb   $0x0,(%rax)
+  80394d:	00 00                	add    %al,(%rax)
+  80394f:	00 df                	add    %bl,%bh
+  803951:	0e                   	(bad)
+  803952:	80 00 00             	addb   $0x0,(%rax)
+  803955:	00 00                	add    %al,(%rax)
+  803957:	00 df                	add    %bl,%bh
+  803959:	0e                   	(bad)
+  80395a:	80 00 00             	addb   $0x0,(%rax)
+  80395d:	00 00                	add    %al,(%rax)
+  80395f:	00 df                	add    %bl,%bh
+  803961:	0e                   	(bad)
+  803962:	80 00 00             	addb   $0x0,(%rax)
+  803965:	00 00                	add    %al,(%rax)
+  803967:	00 df                	add    %bl,%bh
+  803969:	0e                   	(bad)
+  80396a:	80 00 00             	addb   $0x0,(%rax)
+  80396d:	00 00                	add    %al,(%rax)
+  80396f:	00 df                	add    %bl,%bh
+  803971:	0e                   	(bad)
+  803972:	80 00 00             	addb   $0x0,(%rax)
+  803975:	00 00                	add    %al,(%rax)
+  803977:	00 df                	add    %bl,%bh
+  803979:	0e                   	(bad)
+  80397a:	80 00 00             	addb   $0x0,(%rax)
+  80397d:	00 00                	add    %al,(%rax)
+  80397f:	00 df                	add    %bl,%bh
+  803981:	0e                   	(bad)
+  803982:	80 00 00             	addb   $0x0,(%rax)
+  803985:	00 00                	add    %al,(%rax)
+  803987:	00 df                	add    %bl,%bh
+  803989:	0e                   	(bad)
+  80398a:	80 00 00             	addb   $0x0,(%rax)
+  80398d:	00 00                	add    %al,(%rax)
+  80398f:	00 df                	add    %bl,%bh
+  803991:	0e                   	(bad)
+  803992:	80 00 00             	addb   $0x0,(%rax)
+  803995:	00 00                	add    %al,(%rax)
+  803997:	00 df                	add    %bl,%bh
+  803999:	0e                   	(bad)
+  80399a:	80 00 00             	addb   $0x0,(%rax)
+  80399d:	00 00                	add    %al,(%rax)
+  80399f:	00 df                	add    %bl,%bh
+  8039a1:	0e                   	(bad)
+  8039a2:	80 00 00             	addb   $0x0,(%rax)
+  8039a5:	00 00                	add    %al,(%rax)
+  8039a7:	00 df                	add    %bl,%bh
+  8039a9:	0e                   	(bad)
+  8039aa:	80 00 00             	addb   $0x0,(%rax)
+  8039ad:	00 00                	add    %al,(%rax)
+  8039af:	00 df                	add    %bl,%bh
+  8039b1:	0e                   	(bad)
+  8039b2:	80 00 00             	addb   $0x0,(%rax)
+  8039b5:	00 00                	add    %al,(%rax)
+  8039b7:	00 df                	add    %bl,%bh
+  8039b9:	0e                   	(bad)
+  8039ba:	80 00 00             	addb   $0x0,(%rax)
+  8039bd:	00 00                	add    %al,(%rax)
+  8039bf:	00 df                	add    %bl,%bh
+  8039c1:	0e                   	(bad)
+  8039c2:	80 00 00             	addb   $0x0,(%rax)
+  8039c5:	00 00                	add    %al,(%rax)
+  8039c7:	00 df                	add    %bl,%bh
+  8039c9:	0e                   	(bad)
+  8039ca:	80 00 00             	addb   $0x0,(%rax)
+  8039cd:	00 00                	add    %al,(%rax)
+  8039cf:	00 df                	add    %bl,%bh
+  8039d1:	0e                   	(bad)
+  8039d2:	80 00 00             	addb   $0x0,(%rax)
+  8039d5:	00 00                	add    %al,(%rax)
+  8039d7:	00 df                	add    %bl,%bh
+  8039d9:	0e                   	(bad)
+  8039da:	80 00 00             	addb   $0x0,(%rax)
+  8039dd:	00 00                	add    %al,(%rax)
+  8039df:	00 df                	add    %bl,%bh
+  8039e1:	0e                   	(bad)
+  8039e2:	80 00 00             	addb   $0x0,(%rax)
+  8039e5:	00 00                	add    %al,(%rax)
+  8039e7:	00 df                	add    %bl,%bh
+  8039e9:	0e                   	(bad)
+  8039ea:	80 00 00             	addb   $0x0,(%rax)
+  8039ed:	00 00                	add    %al,(%rax)
+  8039ef:	00 df                	add    %bl,%bh
+  8039f1:	0e                   	(bad)
+  8039f2:	80 00 00             	addb   $0x0,(%rax)
+  8039f5:	00 00                	add    %al,(%rax)
+  8039f7:	00 df                	add    %bl,%bh
+  8039f9:	0e                   	(bad)
+  8039fa:	80 00 00             	addb   $0x0,(%rax)
+  8039fd:	00 00                	add    %al,(%rax)
+  8039ff:	00 df                	add    %bl,%bh
+  803a01:	0e                   	(bad)
+  803a02:	80 00 00             	addb   $0x0,(%rax)
+  803a05:	00 00                	add    %al,(%rax)
+  803a07:	00 02                	add    %al,(%rdx)
+  803a09:	0e                   	(bad)
+  803a0a:	80 00 00             	addb   $0x0,(%rax)
+  803a0d:	00 00                	add    %al,(%rax)
+  803a0f:	00 df                	add    %bl,%bh
+  803a11:	0e                   	(bad)
+  803a12:	80 00 00             	addb   $0x0,(%rax)
+  803a15:	00 00                	add    %al,(%rax)
+  803a17:	00 df                	add    %bl,%bh
+  803a19:	0e                   	(bad)
+  803a1a:	80 00 00             	addb   $0x0,(%rax)
+  803a1d:	00 00                	add    %al,(%rax)
+  803a1f:	00 df                	add    %bl,%bh
+  803a21:	0e                   	(bad)
+  803a22:	80 00 00             	addb   $0x0,(%rax)
+  803a25:	00 00                	add    %al,(%rax)
+  803a27:	00 df                	add    %bl,%bh
+  803a29:	0e                   	(bad)
+  803a2a:	80 00 00             	addb   $0x0,(%rax)
+  803a2d:	00 00                	add    %al,(%rax)
+  803a2f:	00 df                	add    %bl,%bh
+  803a31:	0e                   	(bad)
+  803a32:	80 00 00             	addb   $0x0,(%rax)
+  803a35:	00 00                	add    %al,(%rax)
+  803a37:	00 df                	add    %bl,%bh
+  803a39:	0e                   	(bad)
+  803a3a:	80 00 00             	addb   $0x0,(%rax)
+  803a3d:	00 00                	add    %al,(%rax)
+  803a3f:	00 df                	add    %bl,%bh
+  803a41:	0e                   	(bad)
+  803a42:	80 00 00             	addb   $0x0,(%rax)
+  803a45:	00 00                	add    %al,(%rax)
+  803a47:	00 df                	add    %bl,%bh
+  803a49:	0e                   	(bad)
+  803a4a:	80 00 00             	addb   $0x0,(%rax)
+  803a4d:	00 00                	add    %al,(%rax)
+  803a4f:	00 df                	add    %bl,%bh
+  803a51:	0e                   	(bad)
+  803a52:	80 00 00             	addb   $0x0,(%rax)
+  803a55:	00 00                	add    %al,(%rax)
+  803a57:	00 df                	add    %bl,%bh
+  803a59:	0e                   	(bad)
+  803a5a:	80 00 00             	addb   $0x0,(%rax)
+  803a5d:	00 00                	add    %al,(%rax)
+  803a5f:	00 4e 09             	add    %cl,0x9(%rsi)
+  803a62:	80 00 00             	addb   $0x0,(%rax)
+  803a65:	00 00                	add    %al,(%rax)
+  803a67:	00 1d 0b 80 00 00    	add    %bl,0x800b(%rip)        # 80ba78 <__bss_end+0x3a78>
+  803a6d:	00 00                	add    %al,(%rax)
+  803a6f:	00 df                	add    %bl,%bh
+  803a71:	0e                   	(bad)
+  803a72:	80 00 00             	addb   $0x0,(%rax)
+  803a75:	00 00                	add    %al,(%rax)
+  803a77:	00 df                	add    %bl,%bh
+  803a79:	0e                   	(bad)
+  803a7a:	80 00 00             	addb   $0x0,(%rax)
+  803a7d:	00 00                	add    %al,(%rax)
+  803a7f:	00 df                	add    %bl,%bh
+  803a81:	0e                   	(bad)
+  803a82:	80 00 00             	addb   $0x0,(%rax)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 df                	add    %bl,%bh
+  803a89:	0e                   	(bad)
+  803a8a:	80 00 00             	addb   $0x0,(%rax)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 7d 09             	add    %bh,0x9(%rbp)
+  803a92:	80 00 00             	addb   $0x0,(%rax)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 df                	add    %bl,%bh
+  803a99:	0e                   	(bad)
+  803a9a:	80 00 00             	addb   $0x0,(%rax)
+  803a9d:	00 00                	add    %al,(%rax)
+  803a9f:	00 df                	add    %bl,%bh
+  803aa1:	0e                   	(bad)
+  803aa2:	80 00 00             	addb   $0x0,(%rax)
+  803aa5:	00 00                	add    %al,(%rax)
+  803aa7:	00 43 09             	add    %al,0x9(%rbx)
+  803aaa:	80 00 00             	addb   $0x0,(%rax)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 df                	add    %bl,%bh
+  803ab1:	0e                   	(bad)
+  803ab2:	80 00 00             	addb   $0x0,(%rax)
+  803ab5:	00 00                	add    %al,(%rax)
+  803ab7:	00 df                	add    %bl,%bh
+  803ab9:	0e                   	(bad)
+  803aba:	80 00 00             	addb   $0x0,(%rax)
+  803abd:	00 00                	add    %al,(%rax)
+  803abf:	00 c5                	add    %al,%ch
+  803ac1:	0c 80                	or     $0x80,%al
+  803ac3:	00 00                	add    %al,(%rax)
+  803ac5:	00 00                	add    %al,(%rax)
+  803ac7:	00 8f 0d 80 00 00    	add    %cl,0x800d(%rdi)
+  803acd:	00 00                	add    %al,(%rax)
+  803acf:	00 df                	add    %bl,%bh
+  803ad1:	0e                   	(bad)
+  803ad2:	80 00 00             	addb   $0x0,(%rax)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 df                	add    %bl,%bh
+  803ad9:	0e                   	(bad)
+  803ada:	80 00 00             	addb   $0x0,(%rax)
+  803add:	00 00                	add    %al,(%rax)
+  803adf:	00 14 0a             	add    %dl,(%rdx,%rcx,1)
+  803ae2:	80 00 00             	addb   $0x0,(%rax)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 df                	add    %bl,%bh
+  803ae9:	0e                   	(bad)
+  803aea:	80 00 00             	addb   $0x0,(%rax)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 f1                	add    %dh,%cl
+  803af1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803af7:	00 df                	add    %bl,%bh
+  803af9:	0e                   	(bad)
+  803afa:	80 00 00             	addb   $0x0,(%rax)
+  803afd:	00 00                	add    %al,(%rax)
+  803aff:	00 df                	add    %bl,%bh
+  803b01:	0e                   	(bad)
+  803b02:	80 00 00             	addb   $0x0,(%rax)
+  803b05:	00 00                	add    %al,(%rax)
+  803b07:	00 02                	add    %al,(%rdx)
+  803b09:	0e                   	(bad)
+  803b0a:	80 00 00             	addb   $0x0,(%rax)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 df                	add    %bl,%bh
+  803b11:	0e                   	(bad)
+  803b12:	80 00 00             	addb   $0x0,(%rax)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 a7 08 80 00 00    	add    %ah,0x8008(%rdi)
+  803b1d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803b20 <error_string>:
+	...
+  803b28:	d5 36 80 00 00 00 00 00 e7 36 80 00 00 00 00 00     .6.......6......
+  803b38:	f7 36 80 00 00 00 00 00 09 37 80 00 00 00 00 00     .6.......7......
+  803b48:	17 37 80 00 00 00 00 00 2b 37 80 00 00 00 00 00     .7......+7......
+  803b58:	40 37 80 00 00 00 00 00 53 37 80 00 00 00 00 00     @7......S7......
+  803b68:	65 37 80 00 00 00 00 00 79 37 80 00 00 00 00 00     e7......y7......
+  803b78:	89 37 80 00 00 00 00 00 9c 37 80 00 00 00 00 00     .7.......7......
+  803b88:	b3 37 80 00 00 00 00 00 c9 37 80 00 00 00 00 00     .7.......7......
+  803b98:	e1 37 80 00 00 00 00 00 f9 37 80 00 00 00 00 00     .7.......7......
+  803ba8:	06 38 80 00 00 00 00 00 d0 3b 80 00 00 00 00 00     .8.......;......
+  803bb8:	1a 38 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .8..............
+  803bc8:	32 38 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     28......file is 
+  803bd8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803be8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803bf8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803c08:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803c18:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  803c28:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  803c38:	6c 69 62 2f 66 6f 72 6b 2e 63 00 0f 1f 44 00 00     lib/fork.c...D..
+  803c48:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803c58:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803c68:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803c78:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803c88:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803c98:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803ca8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803cb8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803cc8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cd8:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000803ce0 <devtab>:
+  803ce0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803cf0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803d00:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  803d10:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  803d20:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  803d30:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 0f 1f 40 00     _SIZE) == 2...@.
+  803d40:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  803d50:	20 62 65 67 69 6e 20 67 65 6e 65 72 69 63 20 68      begin generic h
+  803d60:	61 6e 64 6c 65 72 20 66 6f 72 20 25 64 0a 00 00     andler for %d...
+  803d70:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  803d80:	20 65 78 69 74 69 6e 67 20 64 75 65 20 74 6f 20      exiting due to 
+  803d90:	73 69 67 6e 61 6c 20 25 64 0a 00 00 00 00 00 00     signal %d.......
+  803da0:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  803db0:	20 69 67 6e 6f 72 69 6e 67 20 73 69 67 6e 61 6c      ignoring signal
+  803dc0:	20 25 64 0a 00 00 00 00 73 69 67 6e 61 6c 73 3a      %d.....signals:
+  803dd0:	20 65 6e 76 20 25 78 3a 20 65 6e 64 20 67 65 6e      env %x: end gen
+  803de0:	65 72 69 63 20 68 61 6e 64 6c 65 72 20 66 6f 72     eric handler for
+  803df0:	20 25 64 0a 00 66 61 6c 73 65 00 6c 69 62 2f 73      %d..false.lib/s
+  803e00:	69 67 6e 61 6c 2e 63 00 3c 63 6f 6e 73 3e 00 63     ignal.c.<cons>.c
+  803e10:	6f 6e 73 00 69 70 63 5f 73 65 6e 64 3a 20 66 61     ons.ipc_send: fa
+  803e20:	69 6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62     iled to send.lib
+  803e30:	2f 69 70 63 2e 63 00 90 55 73 65 72 73 70 61 63     /ipc.c..Userspac
+  803e40:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  803e50:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  803e60:	65 72 72 3d 25 78 0a 00 61 64 64 5f 70 67 66 61     err=%x..add_pgfa
+  803e70:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  803e80:	5f 61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61     _alloc_region fa
+  803e90:	69 6c 65 64 00 00 00 00 61 64 64 5f 70 67 66 61     iled....add_pgfa
+  803ea0:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  803eb0:	5f 65 6e 76 5f 73 65 74 5f 70 67 66 61 75 6c 74     _env_set_pgfault
+  803ec0:	5f 75 70 63 61 6c 6c 20 66 61 69 6c 65 64 00 6c     _upcall failed.l
+  803ed0:	69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65 74     ib/pgfault.c.set
+  803ee0:	5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65 72     _pgfault_handler
+  803ef0:	3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72 5f     : %i._pfhandler_
+  803f00:	69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00 66     inititiallized.f
+  803f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
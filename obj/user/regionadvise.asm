@@ -0,0 +1,5974 @@
+
+obj/user/regionadvise:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 a7 04 00 00       	call   8004ca <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#define NPAGES 64
+
+static uint8_t *const region = (uint8_t *)0x10000000;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 54                	push   %r12
+  80002b:	53                   	push   %rbx
+    size_t size = NPAGES * PAGE_SIZE;
+    int res = sys_alloc_region(0, region, size, PROT_RW);
+  80002c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800031:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800036:	be 00 00 00 10       	mov    $0x10000000,%esi
+  80003b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800040:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  800047:	00 00 00 
+  80004a:	ff d0                	call   *%rax
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  80004c:	85 c0                	test   %eax,%eax
+  80004e:	78 6d                	js     8000bd <umain+0x98>
+
+    /* Populate whole region at once and fill it */
+    if ((res = sys_region_advise(0, region, size, ADVICE_WILLNEED)) < 0) panic("WILLNEED: %i", res);
+  800050:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800055:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80005a:	be 00 00 00 10       	mov    $0x10000000,%esi
+  80005f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800064:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  80006b:	00 00 00 
+  80006e:	ff d0                	call   *%rax
+  800070:	85 c0                	test   %eax,%eax
+  800072:	78 76                	js     8000ea <umain+0xc5>
+    memset(region, 0xAB, size);
+  800074:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800079:	be ab 00 00 00       	mov    $0xab,%esi
+  80007e:	bf 00 00 00 10       	mov    $0x10000000,%edi
+  800083:	48 b8 55 11 80 00 00 	movabs $0x801155,%rax
+  80008a:	00 00 00 
+  80008d:	ff d0                	call   *%rax
+
+    /* Dropped pages read as zeroes but stay writable */
+    if ((res = sys_region_advise(0, region, size / 2, ADVICE_DONTNEED)) < 0) panic("DONTNEED: %i", res);
+  80008f:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800094:	ba 00 00 02 00       	mov    $0x20000,%edx
+  800099:	be 00 00 00 10       	mov    $0x10000000,%esi
+  80009e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000a3:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  8000aa:	00 00 00 
+  8000ad:	ff d0                	call   *%rax
+  8000af:	85 c0                	test   %eax,%eax
+  8000b1:	78 64                	js     800117 <umain+0xf2>
+    for (size_t i = 0; i < size; i++)
+  8000b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000b8:	e9 b2 02 00 00       	jmp    80036f <umain+0x34a>
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  8000bd:	89 c1                	mov    %eax,%ecx
+  8000bf:	48 ba b8 2f 80 00 00 	movabs $0x802fb8,%rdx
+  8000c6:	00 00 00 
+  8000c9:	be 0d 00 00 00       	mov    $0xd,%esi
+  8000ce:	48 bf cd 2f 80 00 00 	movabs $0x802fcd,%rdi
+  8000d5:	00 00 00 
+  8000d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000dd:	49 b8 94 05 80 00 00 	movabs $0x800594,%r8
+  8000e4:	00 00 00 
+  8000e7:	41 ff d0             	call   *%r8
+    if ((res = sys_region_advise(0, region, size, ADVICE_WILLNEED)) < 0) panic("WILLNEED: %i", res);
+  8000ea:	89 c1                	mov    %eax,%ecx
+  8000ec:	48 ba e1 2f 80 00 00 	movabs $0x802fe1,%rdx
+  8000f3:	00 00 00 
+  8000f6:	be 10 00 00 00       	mov    $0x10,%esi
+  8000fb:	48 bf cd 2f 80 00 00 	movabs $0x802fcd,%rdi
+  800102:	00 00 00 
+  800105:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010a:	49 b8 94 05 80 00 00 	movabs $0x800594,%r8
+  800111:	00 00 00 
+  800114:	41 ff d0             	call   *%r8
+    if ((res = sys_region_advise(0, region, size / 2, ADVICE_DONTNEED)) < 0) panic("DONTNEED: %i", res);
+  800117:	89 c1                	mov    %eax,%ecx
+  800119:	48 ba ee 2f 80 00 00 	movabs $0x802fee,%rdx
+  800120:	00 00 00 
+  800123:	be 14 00 00 00       	mov    $0x14,%esi
+  800128:	48 bf cd 2f 80 00 00 	movabs $0x802fcd,%rdi
+  80012f:	00 00 00 
+  800132:	b8 00 00 00 00       	mov    $0x0,%eax
+  800137:	49 b8 94 05 80 00 00 	movabs $0x800594,%r8
+  80013e:	00 00 00 
+  800141:	41 ff d0             	call   *%r8
+        if (region[i] != (i < size / 2 ? 0x00 : 0xAB)) panic("region[%zu] = %02x after DONTNEED", i, region[i]);
+  800144:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  80014b:	00 00 00 
+  80014e:	be 16 00 00 00       	mov    $0x16,%esi
+  800153:	48 bf cd 2f 80 00 00 	movabs $0x802fcd,%rdi
+  80015a:	00 00 00 
+  80015d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800162:	49 b9 94 05 80 00 00 	movabs $0x800594,%r9
+  800169:	00 00 00 
+  80016c:	41 ff d1             	call   *%r9
+    region[0] = 1;
+
+    /* Persistent hints */
+    if ((res = sys_region_advise(0, region, size, ADVICE_SEQUENTIAL)) < 0) panic("SEQUENTIAL: %i", res);
+  80016f:	89 c1                	mov    %eax,%ecx
+  800171:	48 ba 1b 30 80 00 00 	movabs $0x80301b,%rdx
+  800178:	00 00 00 
+  80017b:	be 1a 00 00 00       	mov    $0x1a,%esi
+  800180:	48 bf cd 2f 80 00 00 	movabs $0x802fcd,%rdi
+  800187:	00 00 00 
+  80018a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018f:	49 b8 94 05 80 00 00 	movabs $0x800594,%r8
+  800196:	00 00 00 
+  800199:	41 ff d0             	call   *%r8
+    if ((res = sys_region_advise(0, region + PAGE_SIZE, PAGE_SIZE, ADVICE_NOHUGEPAGE)) < 0) panic("NOHUGEPAGE: %i", res);
+  80019c:	89 c1                	mov    %eax,%ecx
+  80019e:	48 ba fb 2f 80 00 00 	movabs $0x802ffb,%rdx
+  8001a5:	00 00 00 
+  8001a8:	be 1b 00 00 00       	mov    $0x1b,%esi
+  8001ad:	48 bf cd 2f 80 00 00 	movabs $0x802fcd,%rdi
+  8001b4:	00 00 00 
+  8001b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bc:	49 b8 94 05 80 00 00 	movabs $0x800594,%r8
+  8001c3:	00 00 00 
+  8001c6:	41 ff d0             	call   *%r8
+    if ((res = sys_region_advise(0, region, size, ADVICE_NORMAL)) < 0) panic("NORMAL: %i", res);
+  8001c9:	89 c1                	mov    %eax,%ecx
+  8001cb:	48 ba 0a 30 80 00 00 	movabs $0x80300a,%rdx
+  8001d2:	00 00 00 
+  8001d5:	be 1c 00 00 00       	mov    $0x1c,%esi
+  8001da:	48 bf cd 2f 80 00 00 	movabs $0x802fcd,%rdi
+  8001e1:	00 00 00 
+  8001e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e9:	49 b8 94 05 80 00 00 	movabs $0x800594,%r8
+  8001f0:	00 00 00 
+  8001f3:	41 ff d0             	call   *%r8
+
+    /* Empty regions must not use up hint slots */
+    for (size_t i = 0; i < 2 * NPAGES; i++)
+        if ((res = sys_region_advise(0, region + (i % NPAGES) * PAGE_SIZE, 0, ADVICE_SEQUENTIAL)) < 0) panic("empty SEQUENTIAL: %i", res);
+  8001f6:	89 c1                	mov    %eax,%ecx
+  8001f8:	48 ba 15 30 80 00 00 	movabs $0x803015,%rdx
+  8001ff:	00 00 00 
+  800202:	be 20 00 00 00       	mov    $0x20,%esi
+  800207:	48 bf cd 2f 80 00 00 	movabs $0x802fcd,%rdi
+  80020e:	00 00 00 
+  800211:	b8 00 00 00 00       	mov    $0x0,%eax
+  800216:	49 b8 94 05 80 00 00 	movabs $0x800594,%r8
+  80021d:	00 00 00 
+  800220:	41 ff d0             	call   *%r8
+    for (size_t i = 0; i < NPAGES; i += 2)
+        if ((res = sys_region_advise(0, region + i * PAGE_SIZE, PAGE_SIZE, ADVICE_HUGEPAGE)) < 0) break;
+    if (res != -E_NO_MEM) panic("hint table is not limited: %i", res);
+  800223:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  800226:	0f 85 71 02 00 00    	jne    80049d <umain+0x478>
+    if ((res = sys_region_advise(0, region, size, ADVICE_NORMAL)) < 0) panic("NORMAL: %i", res);
+  80022c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800231:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800236:	be 00 00 00 10       	mov    $0x10000000,%esi
+  80023b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800240:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  800247:	00 00 00 
+  80024a:	ff d0                	call   *%rax
+  80024c:	85 c0                	test   %eax,%eax
+  80024e:	0f 88 8d 00 00 00    	js     8002e1 <umain+0x2bc>
+
+    if (sys_region_advise(0, region + 1, PAGE_SIZE, ADVICE_WILLNEED) != -E_INVAL) panic("misaligned region accepted");
+  800254:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800259:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80025e:	be 01 00 00 10       	mov    $0x10000001,%esi
+  800263:	bf 00 00 00 00       	mov    $0x0,%edi
+  800268:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  80026f:	00 00 00 
+  800272:	ff d0                	call   *%rax
+  800274:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800277:	0f 85 91 00 00 00    	jne    80030e <umain+0x2e9>
+    if (sys_region_advise(0, region, PAGE_SIZE, -1) != -E_INVAL) panic("unknown advice accepted");
+  80027d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  800282:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800287:	be 00 00 00 10       	mov    $0x10000000,%esi
+  80028c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800291:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  800298:	00 00 00 
+  80029b:	ff d0                	call   *%rax
+  80029d:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8002a0:	0f 85 92 00 00 00    	jne    800338 <umain+0x313>
+
+    sys_unmap_region(0, region, size);
+  8002a6:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8002ab:	be 00 00 00 10       	mov    $0x10000000,%esi
+  8002b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b5:	48 b8 85 16 80 00 00 	movabs $0x801685,%rax
+  8002bc:	00 00 00 
+  8002bf:	ff d0                	call   *%rax
+    cprintf("regionadvise: OK\n");
+  8002c1:	48 bf 7b 30 80 00 00 	movabs $0x80307b,%rdi
+  8002c8:	00 00 00 
+  8002cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d0:	48 ba e4 06 80 00 00 	movabs $0x8006e4,%rdx
+  8002d7:	00 00 00 
+  8002da:	ff d2                	call   *%rdx
+}
+  8002dc:	5b                   	pop    %rbx
+  8002dd:	41 5c                	pop    %r12
+  8002df:	5d                   	pop    %rbp
+  8002e0:	c3                   	ret
+    if ((res = sys_region_advise(0, region, size, ADVICE_NORMAL)) < 0) panic("NORMAL: %i", res);
+  8002e1:	89 c1                	mov    %eax,%ecx
+  8002e3:	48 ba 0a 30 80 00 00 	movabs $0x80300a,%rdx
+  8002ea:	00 00 00 
+  8002ed:	be 24 00 00 00       	mov    $0x24,%esi
+  8002f2:	48 bf cd 2f 80 00 00 	movabs $0x802fcd,%rdi
+  8002f9:	00 00 00 
+  8002fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800301:	49 b8 94 05 80 00 00 	movabs $0x800594,%r8
+  800308:	00 00 00 
+  80030b:	41 ff d0             	call   *%r8
+    if (sys_region_advise(0, region + 1, PAGE_SIZE, ADVICE_WILLNEED) != -E_INVAL) panic("misaligned region accepted");
+  80030e:	48 ba 48 30 80 00 00 	movabs $0x803048,%rdx
+  800315:	00 00 00 
+  800318:	be 26 00 00 00       	mov    $0x26,%esi
+  80031d:	48 bf cd 2f 80 00 00 	movabs $0x802fcd,%rdi
+  800324:	00 00 00 
+  800327:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032c:	48 b9 94 05 80 00 00 	movabs $0x800594,%rcx
+  800333:	00 00 00 
+  800336:	ff d1                	call   *%rcx
+    if (sys_region_advise(0, region, PAGE_SIZE, -1) != -E_INVAL) panic("unknown advice accepted");
+  800338:	48 ba 63 30 80 00 00 	movabs $0x803063,%rdx
+  80033f:	00 00 00 
+  800342:	be 27 00 00 00       	mov    $0x27,%esi
+  800347:	48 bf cd 2f 80 00 00 	movabs $0x802fcd,%rdi
+  80034e:	00 00 00 
+  800351:	b8 00 00 00 00       	mov    $0x0,%eax
+  800356:	48 b9 94 05 80 00 00 	movabs $0x800594,%rcx
+  80035d:	00 00 00 
+  800360:	ff d1                	call   *%rcx
+        if (region[i] != (i < size / 2 ? 0x00 : 0xAB)) panic("region[%zu] = %02x after DONTNEED", i, region[i]);
+  800362:	45 85 c0             	test   %r8d,%r8d
+  800365:	0f 85 d9 fd ff ff    	jne    800144 <umain+0x11f>
+    for (size_t i = 0; i < size; i++)
+  80036b:	48 83 c1 01          	add    $0x1,%rcx
+        if (region[i] != (i < size / 2 ? 0x00 : 0xAB)) panic("region[%zu] = %02x after DONTNEED", i, region[i]);
+  80036f:	44 0f b6 81 00 00 00 	movzbl 0x10000000(%rcx),%r8d
+  800376:	10 
+  800377:	48 81 f9 ff ff 01 00 	cmp    $0x1ffff,%rcx
+  80037e:	76 e2                	jbe    800362 <umain+0x33d>
+  800380:	41 81 f8 ab 00 00 00 	cmp    $0xab,%r8d
+  800387:	0f 85 b7 fd ff ff    	jne    800144 <umain+0x11f>
+    for (size_t i = 0; i < size; i++)
+  80038d:	48 83 c1 01          	add    $0x1,%rcx
+  800391:	48 81 f9 00 00 04 00 	cmp    $0x40000,%rcx
+  800398:	75 d5                	jne    80036f <umain+0x34a>
+    region[0] = 1;
+  80039a:	c6 04 25 00 00 00 10 	movb   $0x1,0x10000000
+  8003a1:	01 
+    if ((res = sys_region_advise(0, region, size, ADVICE_SEQUENTIAL)) < 0) panic("SEQUENTIAL: %i", res);
+  8003a2:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8003a7:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8003ac:	be 00 00 00 10       	mov    $0x10000000,%esi
+  8003b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003b6:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  8003bd:	00 00 00 
+  8003c0:	ff d0                	call   *%rax
+  8003c2:	85 c0                	test   %eax,%eax
+  8003c4:	0f 88 a5 fd ff ff    	js     80016f <umain+0x14a>
+    if ((res = sys_region_advise(0, region + PAGE_SIZE, PAGE_SIZE, ADVICE_NOHUGEPAGE)) < 0) panic("NOHUGEPAGE: %i", res);
+  8003ca:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8003cf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8003d4:	be 00 10 00 10       	mov    $0x10001000,%esi
+  8003d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003de:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  8003e5:	00 00 00 
+  8003e8:	ff d0                	call   *%rax
+  8003ea:	85 c0                	test   %eax,%eax
+  8003ec:	0f 88 aa fd ff ff    	js     80019c <umain+0x177>
+    if ((res = sys_region_advise(0, region, size, ADVICE_NORMAL)) < 0) panic("NORMAL: %i", res);
+  8003f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003f7:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8003fc:	be 00 00 00 10       	mov    $0x10000000,%esi
+  800401:	bf 00 00 00 00       	mov    $0x0,%edi
+  800406:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  80040d:	00 00 00 
+  800410:	ff d0                	call   *%rax
+  800412:	85 c0                	test   %eax,%eax
+  800414:	0f 88 af fd ff ff    	js     8001c9 <umain+0x1a4>
+    for (size_t i = 0; i < 2 * NPAGES; i++)
+  80041a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if ((res = sys_region_advise(0, region + (i % NPAGES) * PAGE_SIZE, 0, ADVICE_SEQUENTIAL)) < 0) panic("empty SEQUENTIAL: %i", res);
+  80041f:	49 bc ec 16 80 00 00 	movabs $0x8016ec,%r12
+  800426:	00 00 00 
+  800429:	48 89 de             	mov    %rbx,%rsi
+  80042c:	83 e6 3f             	and    $0x3f,%esi
+  80042f:	48 c1 e6 0c          	shl    $0xc,%rsi
+  800433:	48 81 c6 00 00 00 10 	add    $0x10000000,%rsi
+  80043a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80043f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800444:	bf 00 00 00 00       	mov    $0x0,%edi
+  800449:	41 ff d4             	call   *%r12
+  80044c:	85 c0                	test   %eax,%eax
+  80044e:	0f 88 a2 fd ff ff    	js     8001f6 <umain+0x1d1>
+    for (size_t i = 0; i < 2 * NPAGES; i++)
+  800454:	48 83 c3 01          	add    $0x1,%rbx
+  800458:	48 81 fb 80 00 00 00 	cmp    $0x80,%rbx
+  80045f:	75 c8                	jne    800429 <umain+0x404>
+  800461:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+        if ((res = sys_region_advise(0, region + i * PAGE_SIZE, PAGE_SIZE, ADVICE_HUGEPAGE)) < 0) break;
+  800466:	49 bc ec 16 80 00 00 	movabs $0x8016ec,%r12
+  80046d:	00 00 00 
+  800470:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800475:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80047a:	48 89 de             	mov    %rbx,%rsi
+  80047d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800482:	41 ff d4             	call   *%r12
+  800485:	85 c0                	test   %eax,%eax
+  800487:	0f 88 96 fd ff ff    	js     800223 <umain+0x1fe>
+    for (size_t i = 0; i < NPAGES; i += 2)
+  80048d:	48 81 c3 00 20 00 00 	add    $0x2000,%rbx
+  800494:	48 81 fb 00 00 04 10 	cmp    $0x10040000,%rbx
+  80049b:	75 d3                	jne    800470 <umain+0x44b>
+    if (res != -E_NO_MEM) panic("hint table is not limited: %i", res);
+  80049d:	89 c1                	mov    %eax,%ecx
+  80049f:	48 ba 2a 30 80 00 00 	movabs $0x80302a,%rdx
+  8004a6:	00 00 00 
+  8004a9:	be 23 00 00 00       	mov    $0x23,%esi
+  8004ae:	48 bf cd 2f 80 00 00 	movabs $0x802fcd,%rdi
+  8004b5:	00 00 00 
+  8004b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004bd:	49 b8 94 05 80 00 00 	movabs $0x800594,%r8
+  8004c4:	00 00 00 
+  8004c7:	41 ff d0             	call   *%r8
+
+00000000008004ca <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8004ca:	55                   	push   %rbp
+  8004cb:	48 89 e5             	mov    %rsp,%rbp
+  8004ce:	41 56                	push   %r14
+  8004d0:	41 55                	push   %r13
+  8004d2:	41 54                	push   %r12
+  8004d4:	53                   	push   %rbx
+  8004d5:	41 89 fd             	mov    %edi,%r13d
+  8004d8:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8004db:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8004e2:	00 00 00 
+  8004e5:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8004ec:	00 00 00 
+  8004ef:	48 39 c2             	cmp    %rax,%rdx
+  8004f2:	73 17                	jae    80050b <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8004f4:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8004f7:	49 89 c4             	mov    %rax,%r12
+  8004fa:	48 83 c3 08          	add    $0x8,%rbx
+  8004fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800503:	ff 53 f8             	call   *-0x8(%rbx)
+  800506:	4c 39 e3             	cmp    %r12,%rbx
+  800509:	72 ef                	jb     8004fa <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  80050b:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  800512:	00 00 00 
+  800515:	ff d0                	call   *%rax
+  800517:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  80051a:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800521:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800528:	00 00 00 
+  80052b:	48 01 d0             	add    %rdx,%rax
+  80052e:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800535:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800538:	45 85 ed             	test   %r13d,%r13d
+  80053b:	7e 0d                	jle    80054a <libmain+0x80>
+  80053d:	49 8b 06             	mov    (%r14),%rax
+  800540:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800547:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80054a:	4c 89 f6             	mov    %r14,%rsi
+  80054d:	44 89 ef             	mov    %r13d,%edi
+  800550:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800557:	00 00 00 
+  80055a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80055c:	48 b8 71 05 80 00 00 	movabs $0x800571,%rax
+  800563:	00 00 00 
+  800566:	ff d0                	call   *%rax
+#endif
+}
+  800568:	5b                   	pop    %rbx
+  800569:	41 5c                	pop    %r12
+  80056b:	41 5d                	pop    %r13
+  80056d:	41 5e                	pop    %r14
+  80056f:	5d                   	pop    %rbp
+  800570:	c3                   	ret
+
+0000000000800571 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800571:	55                   	push   %rbp
+  800572:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800575:	48 b8 81 1d 80 00 00 	movabs $0x801d81,%rax
+  80057c:	00 00 00 
+  80057f:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800581:	bf 00 00 00 00       	mov    $0x0,%edi
+  800586:	48 b8 8e 14 80 00 00 	movabs $0x80148e,%rax
+  80058d:	00 00 00 
+  800590:	ff d0                	call   *%rax
+}
+  800592:	5d                   	pop    %rbp
+  800593:	c3                   	ret
+
+0000000000800594 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800594:	55                   	push   %rbp
+  800595:	48 89 e5             	mov    %rsp,%rbp
+  800598:	41 56                	push   %r14
+  80059a:	41 55                	push   %r13
+  80059c:	41 54                	push   %r12
+  80059e:	53                   	push   %rbx
+  80059f:	48 83 ec 50          	sub    $0x50,%rsp
+  8005a3:	49 89 fc             	mov    %rdi,%r12
+  8005a6:	41 89 f5             	mov    %esi,%r13d
+  8005a9:	48 89 d3             	mov    %rdx,%rbx
+  8005ac:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8005b0:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8005b4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8005b8:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8005bf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005c3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8005c7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8005cb:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005cf:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8005d6:	00 00 00 
+  8005d9:	4c 8b 30             	mov    (%rax),%r14
+  8005dc:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  8005e3:	00 00 00 
+  8005e6:	ff d0                	call   *%rax
+  8005e8:	89 c6                	mov    %eax,%esi
+  8005ea:	45 89 e8             	mov    %r13d,%r8d
+  8005ed:	4c 89 e1             	mov    %r12,%rcx
+  8005f0:	4c 89 f2             	mov    %r14,%rdx
+  8005f3:	48 bf c0 30 80 00 00 	movabs $0x8030c0,%rdi
+  8005fa:	00 00 00 
+  8005fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800602:	49 bc e4 06 80 00 00 	movabs $0x8006e4,%r12
+  800609:	00 00 00 
+  80060c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80060f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800613:	48 89 df             	mov    %rbx,%rdi
+  800616:	48 b8 80 06 80 00 00 	movabs $0x800680,%rax
+  80061d:	00 00 00 
+  800620:	ff d0                	call   *%rax
+    cprintf("\n");
+  800622:	48 bf 8b 30 80 00 00 	movabs $0x80308b,%rdi
+  800629:	00 00 00 
+  80062c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800631:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800634:	cc                   	int3
+  800635:	eb fd                	jmp    800634 <_panic+0xa0>
+
+0000000000800637 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800637:	55                   	push   %rbp
+  800638:	48 89 e5             	mov    %rsp,%rbp
+  80063b:	53                   	push   %rbx
+  80063c:	48 83 ec 08          	sub    $0x8,%rsp
+  800640:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800643:	8b 06                	mov    (%rsi),%eax
+  800645:	8d 50 01             	lea    0x1(%rax),%edx
+  800648:	89 16                	mov    %edx,(%rsi)
+  80064a:	48 98                	cltq
+  80064c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800651:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800657:	74 0a                	je     800663 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800659:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80065d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800661:	c9                   	leave
+  800662:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800663:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800667:	be ff 00 00 00       	mov    $0xff,%esi
+  80066c:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  800673:	00 00 00 
+  800676:	ff d0                	call   *%rax
+        state->offset = 0;
+  800678:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80067e:	eb d9                	jmp    800659 <putch+0x22>
+
+0000000000800680 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800680:	55                   	push   %rbp
+  800681:	48 89 e5             	mov    %rsp,%rbp
+  800684:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80068b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80068e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800695:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80069a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8006a2:	48 89 f1             	mov    %rsi,%rcx
+  8006a5:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8006ac:	48 bf 37 06 80 00 00 	movabs $0x800637,%rdi
+  8006b3:	00 00 00 
+  8006b6:	48 b8 34 08 80 00 00 	movabs $0x800834,%rax
+  8006bd:	00 00 00 
+  8006c0:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8006c2:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8006c9:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8006d0:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  8006d7:	00 00 00 
+  8006da:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8006dc:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8006e2:	c9                   	leave
+  8006e3:	c3                   	ret
+
+00000000008006e4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8006e4:	55                   	push   %rbp
+  8006e5:	48 89 e5             	mov    %rsp,%rbp
+  8006e8:	48 83 ec 50          	sub    $0x50,%rsp
+  8006ec:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8006f0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8006f4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006f8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006fc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800700:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800707:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80070b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800713:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800717:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80071b:	48 b8 80 06 80 00 00 	movabs $0x800680,%rax
+  800722:	00 00 00 
+  800725:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800727:	c9                   	leave
+  800728:	c3                   	ret
+
+0000000000800729 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800729:	55                   	push   %rbp
+  80072a:	48 89 e5             	mov    %rsp,%rbp
+  80072d:	41 57                	push   %r15
+  80072f:	41 56                	push   %r14
+  800731:	41 55                	push   %r13
+  800733:	41 54                	push   %r12
+  800735:	53                   	push   %rbx
+  800736:	48 83 ec 18          	sub    $0x18,%rsp
+  80073a:	49 89 fc             	mov    %rdi,%r12
+  80073d:	49 89 f5             	mov    %rsi,%r13
+  800740:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800744:	8b 45 10             	mov    0x10(%rbp),%eax
+  800747:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80074a:	41 89 cf             	mov    %ecx,%r15d
+  80074d:	4c 39 fa             	cmp    %r15,%rdx
+  800750:	73 5b                	jae    8007ad <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800752:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800756:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80075a:	85 db                	test   %ebx,%ebx
+  80075c:	7e 0e                	jle    80076c <print_num+0x43>
+            putch(padc, put_arg);
+  80075e:	4c 89 ee             	mov    %r13,%rsi
+  800761:	44 89 f7             	mov    %r14d,%edi
+  800764:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800767:	83 eb 01             	sub    $0x1,%ebx
+  80076a:	75 f2                	jne    80075e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80076c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800770:	48 b9 f4 30 80 00 00 	movabs $0x8030f4,%rcx
+  800777:	00 00 00 
+  80077a:	48 b8 e3 30 80 00 00 	movabs $0x8030e3,%rax
+  800781:	00 00 00 
+  800784:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800788:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80078c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800791:	49 f7 f7             	div    %r15
+  800794:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800798:	4c 89 ee             	mov    %r13,%rsi
+  80079b:	41 ff d4             	call   *%r12
+}
+  80079e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8007a2:	5b                   	pop    %rbx
+  8007a3:	41 5c                	pop    %r12
+  8007a5:	41 5d                	pop    %r13
+  8007a7:	41 5e                	pop    %r14
+  8007a9:	41 5f                	pop    %r15
+  8007ab:	5d                   	pop    %rbp
+  8007ac:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8007ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007b6:	49 f7 f7             	div    %r15
+  8007b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8007bd:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8007c1:	52                   	push   %rdx
+  8007c2:	45 0f be c9          	movsbl %r9b,%r9d
+  8007c6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8007ca:	48 89 c2             	mov    %rax,%rdx
+  8007cd:	48 b8 29 07 80 00 00 	movabs $0x800729,%rax
+  8007d4:	00 00 00 
+  8007d7:	ff d0                	call   *%rax
+  8007d9:	48 83 c4 10          	add    $0x10,%rsp
+  8007dd:	eb 8d                	jmp    80076c <print_num+0x43>
+
+00000000008007df <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8007df:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8007e3:	48 8b 06             	mov    (%rsi),%rax
+  8007e6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8007ea:	73 0a                	jae    8007f6 <sprintputch+0x17>
+        *state->start++ = ch;
+  8007ec:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8007f0:	48 89 16             	mov    %rdx,(%rsi)
+  8007f3:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8007f6:	c3                   	ret
+
+00000000008007f7 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8007f7:	55                   	push   %rbp
+  8007f8:	48 89 e5             	mov    %rsp,%rbp
+  8007fb:	48 83 ec 50          	sub    $0x50,%rsp
+  8007ff:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800803:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800807:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80080b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800812:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800816:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80081e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800822:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800826:	48 b8 34 08 80 00 00 	movabs $0x800834,%rax
+  80082d:	00 00 00 
+  800830:	ff d0                	call   *%rax
+}
+  800832:	c9                   	leave
+  800833:	c3                   	ret
+
+0000000000800834 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800834:	55                   	push   %rbp
+  800835:	48 89 e5             	mov    %rsp,%rbp
+  800838:	41 57                	push   %r15
+  80083a:	41 56                	push   %r14
+  80083c:	41 55                	push   %r13
+  80083e:	41 54                	push   %r12
+  800840:	53                   	push   %rbx
+  800841:	48 83 ec 38          	sub    $0x38,%rsp
+  800845:	49 89 fe             	mov    %rdi,%r14
+  800848:	49 89 f5             	mov    %rsi,%r13
+  80084b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80084e:	48 8b 01             	mov    (%rcx),%rax
+  800851:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800855:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800859:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800861:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800865:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800869:	0f b6 3b             	movzbl (%rbx),%edi
+  80086c:	40 80 ff 25          	cmp    $0x25,%dil
+  800870:	74 18                	je     80088a <vprintfmt+0x56>
+            if (!ch) return;
+  800872:	40 84 ff             	test   %dil,%dil
+  800875:	0f 84 b1 06 00 00    	je     800f2c <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80087b:	40 0f b6 ff          	movzbl %dil,%edi
+  80087f:	4c 89 ee             	mov    %r13,%rsi
+  800882:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800885:	4c 89 e3             	mov    %r12,%rbx
+  800888:	eb db                	jmp    800865 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80088a:	be 00 00 00 00       	mov    $0x0,%esi
+  80088f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800893:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800898:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80089e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8008a5:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8008a9:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8008ae:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8008b3:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8008b6:	83 e8 23             	sub    $0x23,%eax
+  8008b9:	3c 57                	cmp    $0x57,%al
+  8008bb:	0f 87 51 06 00 00    	ja     800f12 <vprintfmt+0x6de>
+  8008c1:	0f b6 c0             	movzbl %al,%eax
+  8008c4:	48 b9 a0 32 80 00 00 	movabs $0x8032a0,%rcx
+  8008cb:	00 00 00 
+  8008ce:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8008d1:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8008d4:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8008d8:	eb cf                	jmp    8008a9 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8008da:	49 89 dc             	mov    %rbx,%r12
+  8008dd:	be 01 00 00 00       	mov    $0x1,%esi
+  8008e2:	eb c5                	jmp    8008a9 <vprintfmt+0x75>
+            padc = ch;
+  8008e4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8008e8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8008eb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008ee:	eb b9                	jmp    8008a9 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8008f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f6:	77 24                	ja     80091c <vprintfmt+0xe8>
+  8008f8:	89 c1                	mov    %eax,%ecx
+  8008fa:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8008fe:	83 c0 08             	add    $0x8,%eax
+  800901:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800904:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800907:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80090a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80090e:	79 99                	jns    8008a9 <vprintfmt+0x75>
+                width = precision;
+  800910:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800914:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80091a:	eb 8d                	jmp    8008a9 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80091c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800920:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800924:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800928:	eb da                	jmp    800904 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80092a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80092f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800933:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800939:	3c 39                	cmp    $0x39,%al
+  80093b:	77 1c                	ja     800959 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80093d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800941:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800945:	0f b6 c0             	movzbl %al,%eax
+  800948:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80094d:	0f b6 03             	movzbl (%rbx),%eax
+  800950:	3c 39                	cmp    $0x39,%al
+  800952:	76 e9                	jbe    80093d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800954:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800957:	eb b1                	jmp    80090a <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800959:	49 89 dc             	mov    %rbx,%r12
+  80095c:	eb ac                	jmp    80090a <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80095e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800961:	85 c9                	test   %ecx,%ecx
+  800963:	b8 00 00 00 00       	mov    $0x0,%eax
+  800968:	0f 49 c1             	cmovns %ecx,%eax
+  80096b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80096e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800971:	e9 33 ff ff ff       	jmp    8008a9 <vprintfmt+0x75>
+            lflag++;
+  800976:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800979:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80097c:	e9 28 ff ff ff       	jmp    8008a9 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800981:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800984:	83 f8 2f             	cmp    $0x2f,%eax
+  800987:	77 19                	ja     8009a2 <vprintfmt+0x16e>
+  800989:	89 c2                	mov    %eax,%edx
+  80098b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098f:	83 c0 08             	add    $0x8,%eax
+  800992:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800995:	8b 3a                	mov    (%rdx),%edi
+  800997:	4c 89 ee             	mov    %r13,%rsi
+  80099a:	41 ff d6             	call   *%r14
+            break;
+  80099d:	e9 c3 fe ff ff       	jmp    800865 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8009a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ae:	eb e5                	jmp    800995 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8009b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b6:	77 5a                	ja     800a12 <vprintfmt+0x1de>
+  8009b8:	89 c2                	mov    %eax,%edx
+  8009ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009be:	83 c0 08             	add    $0x8,%eax
+  8009c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8009c4:	8b 02                	mov    (%rdx),%eax
+  8009c6:	89 c1                	mov    %eax,%ecx
+  8009c8:	f7 d9                	neg    %ecx
+  8009ca:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8009cd:	83 f9 15             	cmp    $0x15,%ecx
+  8009d0:	7f 4e                	jg     800a20 <vprintfmt+0x1ec>
+  8009d2:	48 63 c1             	movslq %ecx,%rax
+  8009d5:	48 ba 60 35 80 00 00 	movabs $0x803560,%rdx
+  8009dc:	00 00 00 
+  8009df:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8009e3:	48 85 c0             	test   %rax,%rax
+  8009e6:	74 38                	je     800a20 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8009e8:	48 89 c1             	mov    %rax,%rcx
+  8009eb:	48 ba 19 37 80 00 00 	movabs $0x803719,%rdx
+  8009f2:	00 00 00 
+  8009f5:	4c 89 ee             	mov    %r13,%rsi
+  8009f8:	4c 89 f7             	mov    %r14,%rdi
+  8009fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a00:	49 b8 f7 07 80 00 00 	movabs $0x8007f7,%r8
+  800a07:	00 00 00 
+  800a0a:	41 ff d0             	call   *%r8
+  800a0d:	e9 53 fe ff ff       	jmp    800865 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800a12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1e:	eb a4                	jmp    8009c4 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800a20:	48 ba 0c 31 80 00 00 	movabs $0x80310c,%rdx
+  800a27:	00 00 00 
+  800a2a:	4c 89 ee             	mov    %r13,%rsi
+  800a2d:	4c 89 f7             	mov    %r14,%rdi
+  800a30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a35:	49 b8 f7 07 80 00 00 	movabs $0x8007f7,%r8
+  800a3c:	00 00 00 
+  800a3f:	41 ff d0             	call   *%r8
+  800a42:	e9 1e fe ff ff       	jmp    800865 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a47:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4d:	77 6c                	ja     800abb <vprintfmt+0x287>
+  800a4f:	89 c2                	mov    %eax,%edx
+  800a51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a55:	83 c0 08             	add    $0x8,%eax
+  800a58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5b:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800a5e:	48 85 d2             	test   %rdx,%rdx
+  800a61:	48 b8 05 31 80 00 00 	movabs $0x803105,%rax
+  800a68:	00 00 00 
+  800a6b:	48 0f 45 c2          	cmovne %rdx,%rax
+  800a6f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800a73:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800a77:	7e 06                	jle    800a7f <vprintfmt+0x24b>
+  800a79:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800a7d:	75 4a                	jne    800ac9 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a7f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a83:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800a87:	0f b6 00             	movzbl (%rax),%eax
+  800a8a:	84 c0                	test   %al,%al
+  800a8c:	0f 85 9a 00 00 00    	jne    800b2c <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800a92:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a95:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800a99:	85 c0                	test   %eax,%eax
+  800a9b:	0f 8e c4 fd ff ff    	jle    800865 <vprintfmt+0x31>
+  800aa1:	4c 89 ee             	mov    %r13,%rsi
+  800aa4:	bf 20 00 00 00       	mov    $0x20,%edi
+  800aa9:	41 ff d6             	call   *%r14
+  800aac:	41 83 ec 01          	sub    $0x1,%r12d
+  800ab0:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800ab4:	75 eb                	jne    800aa1 <vprintfmt+0x26d>
+  800ab6:	e9 aa fd ff ff       	jmp    800865 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800abb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800abf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac7:	eb 92                	jmp    800a5b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800ac9:	49 63 f7             	movslq %r15d,%rsi
+  800acc:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800ad0:	48 b8 e6 0f 80 00 00 	movabs $0x800fe6,%rax
+  800ad7:	00 00 00 
+  800ada:	ff d0                	call   *%rax
+  800adc:	48 89 c2             	mov    %rax,%rdx
+  800adf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800ae2:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800ae4:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800ae7:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800aea:	85 c0                	test   %eax,%eax
+  800aec:	7e 91                	jle    800a7f <vprintfmt+0x24b>
+  800aee:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800af3:	4c 89 ee             	mov    %r13,%rsi
+  800af6:	44 89 e7             	mov    %r12d,%edi
+  800af9:	41 ff d6             	call   *%r14
+  800afc:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800b00:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b03:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800b06:	75 eb                	jne    800af3 <vprintfmt+0x2bf>
+  800b08:	e9 72 ff ff ff       	jmp    800a7f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800b0d:	0f b6 f8             	movzbl %al,%edi
+  800b10:	4c 89 ee             	mov    %r13,%rsi
+  800b13:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800b16:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800b1a:	49 83 c4 01          	add    $0x1,%r12
+  800b1e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800b24:	84 c0                	test   %al,%al
+  800b26:	0f 84 66 ff ff ff    	je     800a92 <vprintfmt+0x25e>
+  800b2c:	45 85 ff             	test   %r15d,%r15d
+  800b2f:	78 0a                	js     800b3b <vprintfmt+0x307>
+  800b31:	41 83 ef 01          	sub    $0x1,%r15d
+  800b35:	0f 88 57 ff ff ff    	js     800a92 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800b3b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800b3f:	74 cc                	je     800b0d <vprintfmt+0x2d9>
+  800b41:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800b44:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b49:	80 fa 5e             	cmp    $0x5e,%dl
+  800b4c:	77 c2                	ja     800b10 <vprintfmt+0x2dc>
+  800b4e:	eb bd                	jmp    800b0d <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800b50:	40 84 f6             	test   %sil,%sil
+  800b53:	75 26                	jne    800b7b <vprintfmt+0x347>
+    switch (lflag) {
+  800b55:	85 d2                	test   %edx,%edx
+  800b57:	74 59                	je     800bb2 <vprintfmt+0x37e>
+  800b59:	83 fa 01             	cmp    $0x1,%edx
+  800b5c:	74 7b                	je     800bd9 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800b5e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b61:	83 f8 2f             	cmp    $0x2f,%eax
+  800b64:	0f 87 96 00 00 00    	ja     800c00 <vprintfmt+0x3cc>
+  800b6a:	89 c2                	mov    %eax,%edx
+  800b6c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b70:	83 c0 08             	add    $0x8,%eax
+  800b73:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b76:	4c 8b 22             	mov    (%rdx),%r12
+  800b79:	eb 17                	jmp    800b92 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800b7b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b7e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b81:	77 21                	ja     800ba4 <vprintfmt+0x370>
+  800b83:	89 c2                	mov    %eax,%edx
+  800b85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b89:	83 c0 08             	add    $0x8,%eax
+  800b8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b8f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800b92:	4d 85 e4             	test   %r12,%r12
+  800b95:	78 7a                	js     800c11 <vprintfmt+0x3dd>
+            num = i;
+  800b97:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800b9a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800b9f:	e9 50 02 00 00       	jmp    800df4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ba4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb0:	eb dd                	jmp    800b8f <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800bb2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb5:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb8:	77 11                	ja     800bcb <vprintfmt+0x397>
+  800bba:	89 c2                	mov    %eax,%edx
+  800bbc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc0:	83 c0 08             	add    $0x8,%eax
+  800bc3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc6:	4c 63 22             	movslq (%rdx),%r12
+  800bc9:	eb c7                	jmp    800b92 <vprintfmt+0x35e>
+  800bcb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bcf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd7:	eb ed                	jmp    800bc6 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800bd9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bdc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bdf:	77 11                	ja     800bf2 <vprintfmt+0x3be>
+  800be1:	89 c2                	mov    %eax,%edx
+  800be3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be7:	83 c0 08             	add    $0x8,%eax
+  800bea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bed:	4c 8b 22             	mov    (%rdx),%r12
+  800bf0:	eb a0                	jmp    800b92 <vprintfmt+0x35e>
+  800bf2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bfa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bfe:	eb ed                	jmp    800bed <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800c00:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c04:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c0c:	e9 65 ff ff ff       	jmp    800b76 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800c11:	4c 89 ee             	mov    %r13,%rsi
+  800c14:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c19:	41 ff d6             	call   *%r14
+                i = -i;
+  800c1c:	49 f7 dc             	neg    %r12
+  800c1f:	e9 73 ff ff ff       	jmp    800b97 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800c24:	40 84 f6             	test   %sil,%sil
+  800c27:	75 32                	jne    800c5b <vprintfmt+0x427>
+    switch (lflag) {
+  800c29:	85 d2                	test   %edx,%edx
+  800c2b:	74 5d                	je     800c8a <vprintfmt+0x456>
+  800c2d:	83 fa 01             	cmp    $0x1,%edx
+  800c30:	0f 84 82 00 00 00    	je     800cb8 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800c36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c39:	83 f8 2f             	cmp    $0x2f,%eax
+  800c3c:	0f 87 a5 00 00 00    	ja     800ce7 <vprintfmt+0x4b3>
+  800c42:	89 c2                	mov    %eax,%edx
+  800c44:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c48:	83 c0 08             	add    $0x8,%eax
+  800c4b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c4e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c51:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c56:	e9 99 01 00 00       	jmp    800df4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c5e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c61:	77 19                	ja     800c7c <vprintfmt+0x448>
+  800c63:	89 c2                	mov    %eax,%edx
+  800c65:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c69:	83 c0 08             	add    $0x8,%eax
+  800c6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c6f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c72:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c77:	e9 78 01 00 00       	jmp    800df4 <vprintfmt+0x5c0>
+  800c7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c80:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c88:	eb e5                	jmp    800c6f <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800c8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c90:	77 18                	ja     800caa <vprintfmt+0x476>
+  800c92:	89 c2                	mov    %eax,%edx
+  800c94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c98:	83 c0 08             	add    $0x8,%eax
+  800c9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c9e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800ca0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800ca5:	e9 4a 01 00 00       	jmp    800df4 <vprintfmt+0x5c0>
+  800caa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb6:	eb e6                	jmp    800c9e <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800cb8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cbb:	83 f8 2f             	cmp    $0x2f,%eax
+  800cbe:	77 19                	ja     800cd9 <vprintfmt+0x4a5>
+  800cc0:	89 c2                	mov    %eax,%edx
+  800cc2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cc6:	83 c0 08             	add    $0x8,%eax
+  800cc9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ccc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ccf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800cd4:	e9 1b 01 00 00       	jmp    800df4 <vprintfmt+0x5c0>
+  800cd9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cdd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ce1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce5:	eb e5                	jmp    800ccc <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800ce7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ceb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf3:	e9 56 ff ff ff       	jmp    800c4e <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800cf8:	40 84 f6             	test   %sil,%sil
+  800cfb:	75 2e                	jne    800d2b <vprintfmt+0x4f7>
+    switch (lflag) {
+  800cfd:	85 d2                	test   %edx,%edx
+  800cff:	74 59                	je     800d5a <vprintfmt+0x526>
+  800d01:	83 fa 01             	cmp    $0x1,%edx
+  800d04:	74 7f                	je     800d85 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800d06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d09:	83 f8 2f             	cmp    $0x2f,%eax
+  800d0c:	0f 87 9f 00 00 00    	ja     800db1 <vprintfmt+0x57d>
+  800d12:	89 c2                	mov    %eax,%edx
+  800d14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d18:	83 c0 08             	add    $0x8,%eax
+  800d1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d1e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d21:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d26:	e9 c9 00 00 00       	jmp    800df4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d2e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d31:	77 19                	ja     800d4c <vprintfmt+0x518>
+  800d33:	89 c2                	mov    %eax,%edx
+  800d35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d39:	83 c0 08             	add    $0x8,%eax
+  800d3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d3f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d42:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d47:	e9 a8 00 00 00       	jmp    800df4 <vprintfmt+0x5c0>
+  800d4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d58:	eb e5                	jmp    800d3f <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800d5a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d5d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d60:	77 15                	ja     800d77 <vprintfmt+0x543>
+  800d62:	89 c2                	mov    %eax,%edx
+  800d64:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d68:	83 c0 08             	add    $0x8,%eax
+  800d6b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d6e:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800d70:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800d75:	eb 7d                	jmp    800df4 <vprintfmt+0x5c0>
+  800d77:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d7b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d83:	eb e9                	jmp    800d6e <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800d85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d88:	83 f8 2f             	cmp    $0x2f,%eax
+  800d8b:	77 16                	ja     800da3 <vprintfmt+0x56f>
+  800d8d:	89 c2                	mov    %eax,%edx
+  800d8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d93:	83 c0 08             	add    $0x8,%eax
+  800d96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d99:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d9c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800da1:	eb 51                	jmp    800df4 <vprintfmt+0x5c0>
+  800da3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800da7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800daf:	eb e8                	jmp    800d99 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800db1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800db5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800db9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dbd:	e9 5c ff ff ff       	jmp    800d1e <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800dc2:	4c 89 ee             	mov    %r13,%rsi
+  800dc5:	bf 30 00 00 00       	mov    $0x30,%edi
+  800dca:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800dcd:	4c 89 ee             	mov    %r13,%rsi
+  800dd0:	bf 78 00 00 00       	mov    $0x78,%edi
+  800dd5:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800dd8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ddb:	83 f8 2f             	cmp    $0x2f,%eax
+  800dde:	77 47                	ja     800e27 <vprintfmt+0x5f3>
+  800de0:	89 c2                	mov    %eax,%edx
+  800de2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800de6:	83 c0 08             	add    $0x8,%eax
+  800de9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800def:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800df4:	48 83 ec 08          	sub    $0x8,%rsp
+  800df8:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800dfc:	0f 94 c0             	sete   %al
+  800dff:	0f b6 c0             	movzbl %al,%eax
+  800e02:	50                   	push   %rax
+  800e03:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800e08:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800e0c:	4c 89 ee             	mov    %r13,%rsi
+  800e0f:	4c 89 f7             	mov    %r14,%rdi
+  800e12:	48 b8 29 07 80 00 00 	movabs $0x800729,%rax
+  800e19:	00 00 00 
+  800e1c:	ff d0                	call   *%rax
+            break;
+  800e1e:	48 83 c4 10          	add    $0x10,%rsp
+  800e22:	e9 3e fa ff ff       	jmp    800865 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800e27:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e2b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e2f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e33:	eb b7                	jmp    800dec <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800e35:	40 84 f6             	test   %sil,%sil
+  800e38:	75 2b                	jne    800e65 <vprintfmt+0x631>
+    switch (lflag) {
+  800e3a:	85 d2                	test   %edx,%edx
+  800e3c:	74 56                	je     800e94 <vprintfmt+0x660>
+  800e3e:	83 fa 01             	cmp    $0x1,%edx
+  800e41:	74 7f                	je     800ec2 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800e43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e46:	83 f8 2f             	cmp    $0x2f,%eax
+  800e49:	0f 87 a2 00 00 00    	ja     800ef1 <vprintfmt+0x6bd>
+  800e4f:	89 c2                	mov    %eax,%edx
+  800e51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e55:	83 c0 08             	add    $0x8,%eax
+  800e58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e5b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e5e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e63:	eb 8f                	jmp    800df4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e68:	83 f8 2f             	cmp    $0x2f,%eax
+  800e6b:	77 19                	ja     800e86 <vprintfmt+0x652>
+  800e6d:	89 c2                	mov    %eax,%edx
+  800e6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e73:	83 c0 08             	add    $0x8,%eax
+  800e76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e79:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e7c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e81:	e9 6e ff ff ff       	jmp    800df4 <vprintfmt+0x5c0>
+  800e86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e92:	eb e5                	jmp    800e79 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800e94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e97:	83 f8 2f             	cmp    $0x2f,%eax
+  800e9a:	77 18                	ja     800eb4 <vprintfmt+0x680>
+  800e9c:	89 c2                	mov    %eax,%edx
+  800e9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ea2:	83 c0 08             	add    $0x8,%eax
+  800ea5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ea8:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800eaa:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800eaf:	e9 40 ff ff ff       	jmp    800df4 <vprintfmt+0x5c0>
+  800eb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eb8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ebc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ec0:	eb e6                	jmp    800ea8 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800ec2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ec5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ec8:	77 19                	ja     800ee3 <vprintfmt+0x6af>
+  800eca:	89 c2                	mov    %eax,%edx
+  800ecc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ed0:	83 c0 08             	add    $0x8,%eax
+  800ed3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ed6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ed9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ede:	e9 11 ff ff ff       	jmp    800df4 <vprintfmt+0x5c0>
+  800ee3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ee7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800eeb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800eef:	eb e5                	jmp    800ed6 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ef1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ef5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ef9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800efd:	e9 59 ff ff ff       	jmp    800e5b <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800f02:	4c 89 ee             	mov    %r13,%rsi
+  800f05:	bf 25 00 00 00       	mov    $0x25,%edi
+  800f0a:	41 ff d6             	call   *%r14
+            break;
+  800f0d:	e9 53 f9 ff ff       	jmp    800865 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800f12:	4c 89 ee             	mov    %r13,%rsi
+  800f15:	bf 25 00 00 00       	mov    $0x25,%edi
+  800f1a:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800f1d:	48 83 eb 01          	sub    $0x1,%rbx
+  800f21:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800f25:	75 f6                	jne    800f1d <vprintfmt+0x6e9>
+  800f27:	e9 39 f9 ff ff       	jmp    800865 <vprintfmt+0x31>
+}
+  800f2c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800f30:	5b                   	pop    %rbx
+  800f31:	41 5c                	pop    %r12
+  800f33:	41 5d                	pop    %r13
+  800f35:	41 5e                	pop    %r14
+  800f37:	41 5f                	pop    %r15
+  800f39:	5d                   	pop    %rbp
+  800f3a:	c3                   	ret
+
+0000000000800f3b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800f3b:	55                   	push   %rbp
+  800f3c:	48 89 e5             	mov    %rsp,%rbp
+  800f3f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800f43:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f47:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800f4c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800f50:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800f57:	48 85 ff             	test   %rdi,%rdi
+  800f5a:	74 2b                	je     800f87 <vsnprintf+0x4c>
+  800f5c:	48 85 f6             	test   %rsi,%rsi
+  800f5f:	74 26                	je     800f87 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800f61:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f65:	48 bf df 07 80 00 00 	movabs $0x8007df,%rdi
+  800f6c:	00 00 00 
+  800f6f:	48 b8 34 08 80 00 00 	movabs $0x800834,%rax
+  800f76:	00 00 00 
+  800f79:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800f7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f7f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800f82:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800f85:	c9                   	leave
+  800f86:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800f87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f8c:	eb f7                	jmp    800f85 <vsnprintf+0x4a>
+
+0000000000800f8e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800f8e:	55                   	push   %rbp
+  800f8f:	48 89 e5             	mov    %rsp,%rbp
+  800f92:	48 83 ec 50          	sub    $0x50,%rsp
+  800f96:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f9a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f9e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800fa2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800fa9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800fad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fb1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800fb5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800fb9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800fbd:	48 b8 3b 0f 80 00 00 	movabs $0x800f3b,%rax
+  800fc4:	00 00 00 
+  800fc7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800fc9:	c9                   	leave
+  800fca:	c3                   	ret
+
+0000000000800fcb <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800fcb:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800fce:	74 10                	je     800fe0 <strlen+0x15>
+    size_t n = 0;
+  800fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800fd5:	48 83 c0 01          	add    $0x1,%rax
+  800fd9:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800fdd:	75 f6                	jne    800fd5 <strlen+0xa>
+  800fdf:	c3                   	ret
+    size_t n = 0;
+  800fe0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800fe5:	c3                   	ret
+
+0000000000800fe6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800fe6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800fe9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800fee:	48 85 f6             	test   %rsi,%rsi
+  800ff1:	74 11                	je     801004 <strnlen+0x1e>
+  800ff3:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ff7:	74 0c                	je     801005 <strnlen+0x1f>
+  800ff9:	48 83 c2 01          	add    $0x1,%rdx
+  800ffd:	48 39 d0             	cmp    %rdx,%rax
+  801000:	75 f1                	jne    800ff3 <strnlen+0xd>
+  801002:	eb 04                	jmp    801008 <strnlen+0x22>
+  801004:	c3                   	ret
+  801005:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801008:	c3                   	ret
+
+0000000000801009 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801009:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80100c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801011:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801015:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801018:	48 83 c2 01          	add    $0x1,%rdx
+  80101c:	84 c9                	test   %cl,%cl
+  80101e:	75 f1                	jne    801011 <strcpy+0x8>
+        ;
+    return res;
+}
+  801020:	c3                   	ret
+
+0000000000801021 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801021:	55                   	push   %rbp
+  801022:	48 89 e5             	mov    %rsp,%rbp
+  801025:	41 54                	push   %r12
+  801027:	53                   	push   %rbx
+  801028:	48 89 fb             	mov    %rdi,%rbx
+  80102b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80102e:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  801035:	00 00 00 
+  801038:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80103a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80103e:	4c 89 e6             	mov    %r12,%rsi
+  801041:	48 b8 09 10 80 00 00 	movabs $0x801009,%rax
+  801048:	00 00 00 
+  80104b:	ff d0                	call   *%rax
+    return dst;
+}
+  80104d:	48 89 d8             	mov    %rbx,%rax
+  801050:	5b                   	pop    %rbx
+  801051:	41 5c                	pop    %r12
+  801053:	5d                   	pop    %rbp
+  801054:	c3                   	ret
+
+0000000000801055 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801055:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801058:	48 85 d2             	test   %rdx,%rdx
+  80105b:	74 1f                	je     80107c <strncpy+0x27>
+  80105d:	48 01 fa             	add    %rdi,%rdx
+  801060:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801063:	48 83 c1 01          	add    $0x1,%rcx
+  801067:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80106b:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80106f:	41 80 f8 01          	cmp    $0x1,%r8b
+  801073:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801077:	48 39 ca             	cmp    %rcx,%rdx
+  80107a:	75 e7                	jne    801063 <strncpy+0xe>
+    }
+    return ret;
+}
+  80107c:	c3                   	ret
+
+000000000080107d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80107d:	48 89 f8             	mov    %rdi,%rax
+  801080:	48 85 d2             	test   %rdx,%rdx
+  801083:	74 24                	je     8010a9 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801085:	48 83 ea 01          	sub    $0x1,%rdx
+  801089:	74 1b                	je     8010a6 <strlcpy+0x29>
+  80108b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80108f:	0f b6 16             	movzbl (%rsi),%edx
+  801092:	84 d2                	test   %dl,%dl
+  801094:	74 10                	je     8010a6 <strlcpy+0x29>
+            *dst++ = *src++;
+  801096:	48 83 c6 01          	add    $0x1,%rsi
+  80109a:	48 83 c0 01          	add    $0x1,%rax
+  80109e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8010a1:	48 39 c8             	cmp    %rcx,%rax
+  8010a4:	75 e9                	jne    80108f <strlcpy+0x12>
+        *dst = '\0';
+  8010a6:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8010a9:	48 29 f8             	sub    %rdi,%rax
+}
+  8010ac:	c3                   	ret
+
+00000000008010ad <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8010ad:	0f b6 07             	movzbl (%rdi),%eax
+  8010b0:	84 c0                	test   %al,%al
+  8010b2:	74 13                	je     8010c7 <strcmp+0x1a>
+  8010b4:	38 06                	cmp    %al,(%rsi)
+  8010b6:	75 0f                	jne    8010c7 <strcmp+0x1a>
+  8010b8:	48 83 c7 01          	add    $0x1,%rdi
+  8010bc:	48 83 c6 01          	add    $0x1,%rsi
+  8010c0:	0f b6 07             	movzbl (%rdi),%eax
+  8010c3:	84 c0                	test   %al,%al
+  8010c5:	75 ed                	jne    8010b4 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8010c7:	0f b6 c0             	movzbl %al,%eax
+  8010ca:	0f b6 16             	movzbl (%rsi),%edx
+  8010cd:	29 d0                	sub    %edx,%eax
+}
+  8010cf:	c3                   	ret
+
+00000000008010d0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8010d0:	48 85 d2             	test   %rdx,%rdx
+  8010d3:	74 1f                	je     8010f4 <strncmp+0x24>
+  8010d5:	0f b6 07             	movzbl (%rdi),%eax
+  8010d8:	84 c0                	test   %al,%al
+  8010da:	74 1e                	je     8010fa <strncmp+0x2a>
+  8010dc:	3a 06                	cmp    (%rsi),%al
+  8010de:	75 1a                	jne    8010fa <strncmp+0x2a>
+  8010e0:	48 83 c7 01          	add    $0x1,%rdi
+  8010e4:	48 83 c6 01          	add    $0x1,%rsi
+  8010e8:	48 83 ea 01          	sub    $0x1,%rdx
+  8010ec:	75 e7                	jne    8010d5 <strncmp+0x5>
+
+    if (!n) return 0;
+  8010ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f3:	c3                   	ret
+  8010f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f9:	c3                   	ret
+  8010fa:	48 85 d2             	test   %rdx,%rdx
+  8010fd:	74 09                	je     801108 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8010ff:	0f b6 07             	movzbl (%rdi),%eax
+  801102:	0f b6 16             	movzbl (%rsi),%edx
+  801105:	29 d0                	sub    %edx,%eax
+  801107:	c3                   	ret
+    if (!n) return 0;
+  801108:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80110d:	c3                   	ret
+
+000000000080110e <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80110e:	0f b6 17             	movzbl (%rdi),%edx
+  801111:	84 d2                	test   %dl,%dl
+  801113:	74 18                	je     80112d <strchr+0x1f>
+        if (*str == c) {
+  801115:	0f be d2             	movsbl %dl,%edx
+  801118:	39 f2                	cmp    %esi,%edx
+  80111a:	74 17                	je     801133 <strchr+0x25>
+    for (; *str; str++) {
+  80111c:	48 83 c7 01          	add    $0x1,%rdi
+  801120:	0f b6 17             	movzbl (%rdi),%edx
+  801123:	84 d2                	test   %dl,%dl
+  801125:	75 ee                	jne    801115 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801127:	b8 00 00 00 00       	mov    $0x0,%eax
+  80112c:	c3                   	ret
+  80112d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801132:	c3                   	ret
+  801133:	48 89 f8             	mov    %rdi,%rax
+}
+  801136:	c3                   	ret
+
+0000000000801137 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801137:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80113a:	0f b6 17             	movzbl (%rdi),%edx
+  80113d:	84 d2                	test   %dl,%dl
+  80113f:	74 13                	je     801154 <strfind+0x1d>
+  801141:	0f be d2             	movsbl %dl,%edx
+  801144:	39 f2                	cmp    %esi,%edx
+  801146:	74 0b                	je     801153 <strfind+0x1c>
+  801148:	48 83 c0 01          	add    $0x1,%rax
+  80114c:	0f b6 10             	movzbl (%rax),%edx
+  80114f:	84 d2                	test   %dl,%dl
+  801151:	75 ee                	jne    801141 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801153:	c3                   	ret
+  801154:	c3                   	ret
+
+0000000000801155 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801155:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801158:	48 89 f8             	mov    %rdi,%rax
+  80115b:	48 f7 d8             	neg    %rax
+  80115e:	83 e0 07             	and    $0x7,%eax
+  801161:	49 89 d1             	mov    %rdx,%r9
+  801164:	49 29 c1             	sub    %rax,%r9
+  801167:	78 36                	js     80119f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801169:	40 0f b6 c6          	movzbl %sil,%eax
+  80116d:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801174:	01 01 01 
+  801177:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80117b:	40 f6 c7 07          	test   $0x7,%dil
+  80117f:	75 38                	jne    8011b9 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801181:	4c 89 c9             	mov    %r9,%rcx
+  801184:	48 c1 f9 03          	sar    $0x3,%rcx
+  801188:	74 0c                	je     801196 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80118a:	fc                   	cld
+  80118b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80118e:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801192:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801196:	4d 85 c9             	test   %r9,%r9
+  801199:	75 45                	jne    8011e0 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80119b:	4c 89 c0             	mov    %r8,%rax
+  80119e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80119f:	48 85 d2             	test   %rdx,%rdx
+  8011a2:	74 f7                	je     80119b <memset+0x46>
+  8011a4:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8011a7:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8011aa:	48 83 c0 01          	add    $0x1,%rax
+  8011ae:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8011b2:	48 39 c2             	cmp    %rax,%rdx
+  8011b5:	75 f3                	jne    8011aa <memset+0x55>
+  8011b7:	eb e2                	jmp    80119b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8011b9:	40 f6 c7 01          	test   $0x1,%dil
+  8011bd:	74 06                	je     8011c5 <memset+0x70>
+  8011bf:	88 07                	mov    %al,(%rdi)
+  8011c1:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011c5:	40 f6 c7 02          	test   $0x2,%dil
+  8011c9:	74 07                	je     8011d2 <memset+0x7d>
+  8011cb:	66 89 07             	mov    %ax,(%rdi)
+  8011ce:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011d2:	40 f6 c7 04          	test   $0x4,%dil
+  8011d6:	74 a9                	je     801181 <memset+0x2c>
+  8011d8:	89 07                	mov    %eax,(%rdi)
+  8011da:	48 83 c7 04          	add    $0x4,%rdi
+  8011de:	eb a1                	jmp    801181 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011e0:	41 f6 c1 04          	test   $0x4,%r9b
+  8011e4:	74 06                	je     8011ec <memset+0x97>
+  8011e6:	89 07                	mov    %eax,(%rdi)
+  8011e8:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011ec:	41 f6 c1 02          	test   $0x2,%r9b
+  8011f0:	74 07                	je     8011f9 <memset+0xa4>
+  8011f2:	66 89 07             	mov    %ax,(%rdi)
+  8011f5:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8011f9:	41 f6 c1 01          	test   $0x1,%r9b
+  8011fd:	74 9c                	je     80119b <memset+0x46>
+  8011ff:	88 07                	mov    %al,(%rdi)
+  801201:	eb 98                	jmp    80119b <memset+0x46>
+
+0000000000801203 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801203:	48 89 f8             	mov    %rdi,%rax
+  801206:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801209:	48 39 fe             	cmp    %rdi,%rsi
+  80120c:	73 3b                	jae    801249 <memmove+0x46>
+  80120e:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801212:	48 39 d7             	cmp    %rdx,%rdi
+  801215:	73 32                	jae    801249 <memmove+0x46>
+        s += n;
+        d += n;
+  801217:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80121b:	48 89 d6             	mov    %rdx,%rsi
+  80121e:	48 09 fe             	or     %rdi,%rsi
+  801221:	48 09 ce             	or     %rcx,%rsi
+  801224:	40 f6 c6 07          	test   $0x7,%sil
+  801228:	75 12                	jne    80123c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80122a:	48 83 ef 08          	sub    $0x8,%rdi
+  80122e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801232:	48 c1 e9 03          	shr    $0x3,%rcx
+  801236:	fd                   	std
+  801237:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80123a:	fc                   	cld
+  80123b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80123c:	48 83 ef 01          	sub    $0x1,%rdi
+  801240:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801244:	fd                   	std
+  801245:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801247:	eb f1                	jmp    80123a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801249:	48 89 f2             	mov    %rsi,%rdx
+  80124c:	48 09 c2             	or     %rax,%rdx
+  80124f:	48 09 ca             	or     %rcx,%rdx
+  801252:	f6 c2 07             	test   $0x7,%dl
+  801255:	75 0c                	jne    801263 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801257:	48 c1 e9 03          	shr    $0x3,%rcx
+  80125b:	48 89 c7             	mov    %rax,%rdi
+  80125e:	fc                   	cld
+  80125f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801262:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801263:	48 89 c7             	mov    %rax,%rdi
+  801266:	fc                   	cld
+  801267:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801269:	c3                   	ret
+
+000000000080126a <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80126a:	55                   	push   %rbp
+  80126b:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80126e:	48 b8 03 12 80 00 00 	movabs $0x801203,%rax
+  801275:	00 00 00 
+  801278:	ff d0                	call   *%rax
+}
+  80127a:	5d                   	pop    %rbp
+  80127b:	c3                   	ret
+
+000000000080127c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80127c:	55                   	push   %rbp
+  80127d:	48 89 e5             	mov    %rsp,%rbp
+  801280:	41 57                	push   %r15
+  801282:	41 56                	push   %r14
+  801284:	41 55                	push   %r13
+  801286:	41 54                	push   %r12
+  801288:	53                   	push   %rbx
+  801289:	48 83 ec 08          	sub    $0x8,%rsp
+  80128d:	49 89 fe             	mov    %rdi,%r14
+  801290:	49 89 f7             	mov    %rsi,%r15
+  801293:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801296:	48 89 f7             	mov    %rsi,%rdi
+  801299:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  8012a0:	00 00 00 
+  8012a3:	ff d0                	call   *%rax
+  8012a5:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8012a8:	48 89 de             	mov    %rbx,%rsi
+  8012ab:	4c 89 f7             	mov    %r14,%rdi
+  8012ae:	48 b8 e6 0f 80 00 00 	movabs $0x800fe6,%rax
+  8012b5:	00 00 00 
+  8012b8:	ff d0                	call   *%rax
+  8012ba:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8012bd:	48 39 c3             	cmp    %rax,%rbx
+  8012c0:	74 36                	je     8012f8 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8012c2:	48 89 d8             	mov    %rbx,%rax
+  8012c5:	4c 29 e8             	sub    %r13,%rax
+  8012c8:	49 39 c4             	cmp    %rax,%r12
+  8012cb:	73 31                	jae    8012fe <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8012cd:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8012d2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012d6:	4c 89 fe             	mov    %r15,%rsi
+  8012d9:	48 b8 6a 12 80 00 00 	movabs $0x80126a,%rax
+  8012e0:	00 00 00 
+  8012e3:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8012e5:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8012e9:	48 83 c4 08          	add    $0x8,%rsp
+  8012ed:	5b                   	pop    %rbx
+  8012ee:	41 5c                	pop    %r12
+  8012f0:	41 5d                	pop    %r13
+  8012f2:	41 5e                	pop    %r14
+  8012f4:	41 5f                	pop    %r15
+  8012f6:	5d                   	pop    %rbp
+  8012f7:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8012f8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012fc:	eb eb                	jmp    8012e9 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8012fe:	48 83 eb 01          	sub    $0x1,%rbx
+  801302:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801306:	48 89 da             	mov    %rbx,%rdx
+  801309:	4c 89 fe             	mov    %r15,%rsi
+  80130c:	48 b8 6a 12 80 00 00 	movabs $0x80126a,%rax
+  801313:	00 00 00 
+  801316:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801318:	49 01 de             	add    %rbx,%r14
+  80131b:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801320:	eb c3                	jmp    8012e5 <strlcat+0x69>
+
+0000000000801322 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801322:	48 85 d2             	test   %rdx,%rdx
+  801325:	74 2d                	je     801354 <memcmp+0x32>
+  801327:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80132c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801330:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801335:	44 38 c1             	cmp    %r8b,%cl
+  801338:	75 0f                	jne    801349 <memcmp+0x27>
+    while (n-- > 0) {
+  80133a:	48 83 c0 01          	add    $0x1,%rax
+  80133e:	48 39 c2             	cmp    %rax,%rdx
+  801341:	75 e9                	jne    80132c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801343:	b8 00 00 00 00       	mov    $0x0,%eax
+  801348:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801349:	0f b6 c1             	movzbl %cl,%eax
+  80134c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801350:	44 29 c0             	sub    %r8d,%eax
+  801353:	c3                   	ret
+    return 0;
+  801354:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801359:	c3                   	ret
+
+000000000080135a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80135a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80135e:	48 39 c7             	cmp    %rax,%rdi
+  801361:	73 0f                	jae    801372 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801363:	40 38 37             	cmp    %sil,(%rdi)
+  801366:	74 0e                	je     801376 <memfind+0x1c>
+    for (; src < end; src++) {
+  801368:	48 83 c7 01          	add    $0x1,%rdi
+  80136c:	48 39 f8             	cmp    %rdi,%rax
+  80136f:	75 f2                	jne    801363 <memfind+0x9>
+  801371:	c3                   	ret
+  801372:	48 89 f8             	mov    %rdi,%rax
+  801375:	c3                   	ret
+  801376:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801379:	c3                   	ret
+
+000000000080137a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80137a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80137d:	0f b6 37             	movzbl (%rdi),%esi
+  801380:	40 80 fe 20          	cmp    $0x20,%sil
+  801384:	74 06                	je     80138c <strtol+0x12>
+  801386:	40 80 fe 09          	cmp    $0x9,%sil
+  80138a:	75 13                	jne    80139f <strtol+0x25>
+  80138c:	48 83 c7 01          	add    $0x1,%rdi
+  801390:	0f b6 37             	movzbl (%rdi),%esi
+  801393:	40 80 fe 20          	cmp    $0x20,%sil
+  801397:	74 f3                	je     80138c <strtol+0x12>
+  801399:	40 80 fe 09          	cmp    $0x9,%sil
+  80139d:	74 ed                	je     80138c <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80139f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8013a2:	83 e0 fd             	and    $0xfffffffd,%eax
+  8013a5:	3c 01                	cmp    $0x1,%al
+  8013a7:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8013ab:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8013b1:	75 0f                	jne    8013c2 <strtol+0x48>
+  8013b3:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8013b6:	74 14                	je     8013cc <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8013b8:	85 d2                	test   %edx,%edx
+  8013ba:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013bf:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8013c2:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8013c7:	4c 63 ca             	movslq %edx,%r9
+  8013ca:	eb 36                	jmp    801402 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8013cc:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8013d0:	74 0f                	je     8013e1 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8013d2:	85 d2                	test   %edx,%edx
+  8013d4:	75 ec                	jne    8013c2 <strtol+0x48>
+        s++;
+  8013d6:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8013da:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8013df:	eb e1                	jmp    8013c2 <strtol+0x48>
+        s += 2;
+  8013e1:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8013e5:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8013ea:	eb d6                	jmp    8013c2 <strtol+0x48>
+            dig -= '0';
+  8013ec:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8013ef:	44 0f b6 c1          	movzbl %cl,%r8d
+  8013f3:	41 39 d0             	cmp    %edx,%r8d
+  8013f6:	7d 21                	jge    801419 <strtol+0x9f>
+        val = val * base + dig;
+  8013f8:	49 0f af c1          	imul   %r9,%rax
+  8013fc:	0f b6 c9             	movzbl %cl,%ecx
+  8013ff:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801402:	48 83 c7 01          	add    $0x1,%rdi
+  801406:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80140a:	80 f9 39             	cmp    $0x39,%cl
+  80140d:	76 dd                	jbe    8013ec <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80140f:	80 f9 7b             	cmp    $0x7b,%cl
+  801412:	77 05                	ja     801419 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801414:	83 e9 57             	sub    $0x57,%ecx
+  801417:	eb d6                	jmp    8013ef <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801419:	4d 85 d2             	test   %r10,%r10
+  80141c:	74 03                	je     801421 <strtol+0xa7>
+  80141e:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801421:	48 89 c2             	mov    %rax,%rdx
+  801424:	48 f7 da             	neg    %rdx
+  801427:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80142b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80142f:	c3                   	ret
+
+0000000000801430 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801430:	55                   	push   %rbp
+  801431:	48 89 e5             	mov    %rsp,%rbp
+  801434:	53                   	push   %rbx
+  801435:	48 89 fa             	mov    %rdi,%rdx
+  801438:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80143b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801440:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801445:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80144a:	be 00 00 00 00       	mov    $0x0,%esi
+  80144f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801455:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801457:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80145b:	c9                   	leave
+  80145c:	c3                   	ret
+
+000000000080145d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80145d:	55                   	push   %rbp
+  80145e:	48 89 e5             	mov    %rsp,%rbp
+  801461:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801462:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801467:	ba 00 00 00 00       	mov    $0x0,%edx
+  80146c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801471:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801476:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80147b:	be 00 00 00 00       	mov    $0x0,%esi
+  801480:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801486:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801488:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80148c:	c9                   	leave
+  80148d:	c3                   	ret
+
+000000000080148e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80148e:	55                   	push   %rbp
+  80148f:	48 89 e5             	mov    %rsp,%rbp
+  801492:	53                   	push   %rbx
+  801493:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801497:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80149a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80149f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014bb:	48 85 c0             	test   %rax,%rax
+  8014be:	7f 06                	jg     8014c6 <sys_env_destroy+0x38>
+}
+  8014c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c4:	c9                   	leave
+  8014c5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c6:	49 89 c0             	mov    %rax,%r8
+  8014c9:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8014ce:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  8014d5:	00 00 00 
+  8014d8:	be 26 00 00 00       	mov    $0x26,%esi
+  8014dd:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  8014e4:	00 00 00 
+  8014e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ec:	49 b9 94 05 80 00 00 	movabs $0x800594,%r9
+  8014f3:	00 00 00 
+  8014f6:	41 ff d1             	call   *%r9
+
+00000000008014f9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8014f9:	55                   	push   %rbp
+  8014fa:	48 89 e5             	mov    %rsp,%rbp
+  8014fd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014fe:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801503:	ba 00 00 00 00       	mov    $0x0,%edx
+  801508:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80150d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801512:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801517:	be 00 00 00 00       	mov    $0x0,%esi
+  80151c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801522:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801524:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801528:	c9                   	leave
+  801529:	c3                   	ret
+
+000000000080152a <sys_yield>:
+
+void
+sys_yield(void) {
+  80152a:	55                   	push   %rbp
+  80152b:	48 89 e5             	mov    %rsp,%rbp
+  80152e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80152f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801534:	ba 00 00 00 00       	mov    $0x0,%edx
+  801539:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80153e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801543:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801548:	be 00 00 00 00       	mov    $0x0,%esi
+  80154d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801553:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801555:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801559:	c9                   	leave
+  80155a:	c3                   	ret
+
+000000000080155b <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80155b:	55                   	push   %rbp
+  80155c:	48 89 e5             	mov    %rsp,%rbp
+  80155f:	53                   	push   %rbx
+  801560:	48 89 fa             	mov    %rdi,%rdx
+  801563:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801566:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80156b:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801572:	00 00 00 
+  801575:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80157a:	be 00 00 00 00       	mov    $0x0,%esi
+  80157f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801585:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801587:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80158b:	c9                   	leave
+  80158c:	c3                   	ret
+
+000000000080158d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80158d:	55                   	push   %rbp
+  80158e:	48 89 e5             	mov    %rsp,%rbp
+  801591:	53                   	push   %rbx
+  801592:	49 89 f8             	mov    %rdi,%r8
+  801595:	48 89 d3             	mov    %rdx,%rbx
+  801598:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80159b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015a0:	4c 89 c2             	mov    %r8,%rdx
+  8015a3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b1:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8015b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b7:	c9                   	leave
+  8015b8:	c3                   	ret
+
+00000000008015b9 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8015b9:	55                   	push   %rbp
+  8015ba:	48 89 e5             	mov    %rsp,%rbp
+  8015bd:	53                   	push   %rbx
+  8015be:	48 83 ec 08          	sub    $0x8,%rsp
+  8015c2:	89 f8                	mov    %edi,%eax
+  8015c4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8015c7:	48 63 f9             	movslq %ecx,%rdi
+  8015ca:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015cd:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015d2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8015da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015e0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015e2:	48 85 c0             	test   %rax,%rax
+  8015e5:	7f 06                	jg     8015ed <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8015e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015eb:	c9                   	leave
+  8015ec:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ed:	49 89 c0             	mov    %rax,%r8
+  8015f0:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8015f5:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  8015fc:	00 00 00 
+  8015ff:	be 26 00 00 00       	mov    $0x26,%esi
+  801604:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  80160b:	00 00 00 
+  80160e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801613:	49 b9 94 05 80 00 00 	movabs $0x800594,%r9
+  80161a:	00 00 00 
+  80161d:	41 ff d1             	call   *%r9
+
+0000000000801620 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801620:	55                   	push   %rbp
+  801621:	48 89 e5             	mov    %rsp,%rbp
+  801624:	53                   	push   %rbx
+  801625:	48 83 ec 08          	sub    $0x8,%rsp
+  801629:	89 f8                	mov    %edi,%eax
+  80162b:	49 89 f2             	mov    %rsi,%r10
+  80162e:	48 89 cf             	mov    %rcx,%rdi
+  801631:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801634:	48 63 da             	movslq %edx,%rbx
+  801637:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80163a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80163f:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801642:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801645:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801647:	48 85 c0             	test   %rax,%rax
+  80164a:	7f 06                	jg     801652 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80164c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801650:	c9                   	leave
+  801651:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801652:	49 89 c0             	mov    %rax,%r8
+  801655:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80165a:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  801661:	00 00 00 
+  801664:	be 26 00 00 00       	mov    $0x26,%esi
+  801669:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  801670:	00 00 00 
+  801673:	b8 00 00 00 00       	mov    $0x0,%eax
+  801678:	49 b9 94 05 80 00 00 	movabs $0x800594,%r9
+  80167f:	00 00 00 
+  801682:	41 ff d1             	call   *%r9
+
+0000000000801685 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801685:	55                   	push   %rbp
+  801686:	48 89 e5             	mov    %rsp,%rbp
+  801689:	53                   	push   %rbx
+  80168a:	48 83 ec 08          	sub    $0x8,%rsp
+  80168e:	48 89 f1             	mov    %rsi,%rcx
+  801691:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801694:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801697:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80169c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ac:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016ae:	48 85 c0             	test   %rax,%rax
+  8016b1:	7f 06                	jg     8016b9 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8016b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016b7:	c9                   	leave
+  8016b8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016b9:	49 89 c0             	mov    %rax,%r8
+  8016bc:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8016c1:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  8016c8:	00 00 00 
+  8016cb:	be 26 00 00 00       	mov    $0x26,%esi
+  8016d0:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  8016d7:	00 00 00 
+  8016da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016df:	49 b9 94 05 80 00 00 	movabs $0x800594,%r9
+  8016e6:	00 00 00 
+  8016e9:	41 ff d1             	call   *%r9
+
+00000000008016ec <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8016ec:	55                   	push   %rbp
+  8016ed:	48 89 e5             	mov    %rsp,%rbp
+  8016f0:	53                   	push   %rbx
+  8016f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8016f5:	89 f8                	mov    %edi,%eax
+  8016f7:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8016fa:	48 63 f9             	movslq %ecx,%rdi
+  8016fd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801700:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801705:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801708:	be 00 00 00 00       	mov    $0x0,%esi
+  80170d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801713:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801715:	48 85 c0             	test   %rax,%rax
+  801718:	7f 06                	jg     801720 <sys_region_advise+0x34>
+}
+  80171a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80171e:	c9                   	leave
+  80171f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801720:	49 89 c0             	mov    %rax,%r8
+  801723:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801728:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  80172f:	00 00 00 
+  801732:	be 26 00 00 00       	mov    $0x26,%esi
+  801737:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  80173e:	00 00 00 
+  801741:	b8 00 00 00 00       	mov    $0x0,%eax
+  801746:	49 b9 94 05 80 00 00 	movabs $0x800594,%r9
+  80174d:	00 00 00 
+  801750:	41 ff d1             	call   *%r9
+
+0000000000801753 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801753:	55                   	push   %rbp
+  801754:	48 89 e5             	mov    %rsp,%rbp
+  801757:	53                   	push   %rbx
+  801758:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80175c:	48 63 ce             	movslq %esi,%rcx
+  80175f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801762:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801767:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80176c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801771:	be 00 00 00 00       	mov    $0x0,%esi
+  801776:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80177c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80177e:	48 85 c0             	test   %rax,%rax
+  801781:	7f 06                	jg     801789 <sys_env_set_nice+0x36>
+}
+  801783:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801787:	c9                   	leave
+  801788:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801789:	49 89 c0             	mov    %rax,%r8
+  80178c:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801791:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  801798:	00 00 00 
+  80179b:	be 26 00 00 00       	mov    $0x26,%esi
+  8017a0:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  8017a7:	00 00 00 
+  8017aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017af:	49 b9 94 05 80 00 00 	movabs $0x800594,%r9
+  8017b6:	00 00 00 
+  8017b9:	41 ff d1             	call   *%r9
+
+00000000008017bc <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8017bc:	55                   	push   %rbp
+  8017bd:	48 89 e5             	mov    %rsp,%rbp
+  8017c0:	53                   	push   %rbx
+  8017c1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8017c5:	48 63 ce             	movslq %esi,%rcx
+  8017c8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017cb:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017da:	be 00 00 00 00       	mov    $0x0,%esi
+  8017df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017e5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017e7:	48 85 c0             	test   %rax,%rax
+  8017ea:	7f 06                	jg     8017f2 <sys_env_set_status+0x36>
+}
+  8017ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f0:	c9                   	leave
+  8017f1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017f2:	49 89 c0             	mov    %rax,%r8
+  8017f5:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8017fa:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  801801:	00 00 00 
+  801804:	be 26 00 00 00       	mov    $0x26,%esi
+  801809:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  801810:	00 00 00 
+  801813:	b8 00 00 00 00       	mov    $0x0,%eax
+  801818:	49 b9 94 05 80 00 00 	movabs $0x800594,%r9
+  80181f:	00 00 00 
+  801822:	41 ff d1             	call   *%r9
+
+0000000000801825 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801825:	55                   	push   %rbp
+  801826:	48 89 e5             	mov    %rsp,%rbp
+  801829:	53                   	push   %rbx
+  80182a:	48 83 ec 08          	sub    $0x8,%rsp
+  80182e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801831:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801834:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801839:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80183e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801843:	be 00 00 00 00       	mov    $0x0,%esi
+  801848:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80184e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801850:	48 85 c0             	test   %rax,%rax
+  801853:	7f 06                	jg     80185b <sys_env_set_trapframe+0x36>
+}
+  801855:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801859:	c9                   	leave
+  80185a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80185b:	49 89 c0             	mov    %rax,%r8
+  80185e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801863:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  80186a:	00 00 00 
+  80186d:	be 26 00 00 00       	mov    $0x26,%esi
+  801872:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  801879:	00 00 00 
+  80187c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801881:	49 b9 94 05 80 00 00 	movabs $0x800594,%r9
+  801888:	00 00 00 
+  80188b:	41 ff d1             	call   *%r9
+
+000000000080188e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80188e:	55                   	push   %rbp
+  80188f:	48 89 e5             	mov    %rsp,%rbp
+  801892:	53                   	push   %rbx
+  801893:	48 83 ec 08          	sub    $0x8,%rsp
+  801897:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80189a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80189d:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018b7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018b9:	48 85 c0             	test   %rax,%rax
+  8018bc:	7f 06                	jg     8018c4 <sys_env_set_pgfault_upcall+0x36>
+}
+  8018be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018c2:	c9                   	leave
+  8018c3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018c4:	49 89 c0             	mov    %rax,%r8
+  8018c7:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8018cc:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  8018d3:	00 00 00 
+  8018d6:	be 26 00 00 00       	mov    $0x26,%esi
+  8018db:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  8018e2:	00 00 00 
+  8018e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ea:	49 b9 94 05 80 00 00 	movabs $0x800594,%r9
+  8018f1:	00 00 00 
+  8018f4:	41 ff d1             	call   *%r9
+
+00000000008018f7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8018f7:	55                   	push   %rbp
+  8018f8:	48 89 e5             	mov    %rsp,%rbp
+  8018fb:	53                   	push   %rbx
+  8018fc:	89 f8                	mov    %edi,%eax
+  8018fe:	49 89 f1             	mov    %rsi,%r9
+  801901:	48 89 d3             	mov    %rdx,%rbx
+  801904:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801907:	49 63 f0             	movslq %r8d,%rsi
+  80190a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80190d:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801912:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801915:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80191b:	cd 30                	int    $0x30
+}
+  80191d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801921:	c9                   	leave
+  801922:	c3                   	ret
+
+0000000000801923 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801923:	55                   	push   %rbp
+  801924:	48 89 e5             	mov    %rsp,%rbp
+  801927:	53                   	push   %rbx
+  801928:	48 83 ec 08          	sub    $0x8,%rsp
+  80192c:	48 89 fa             	mov    %rdi,%rdx
+  80192f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801932:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801937:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80193c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801941:	be 00 00 00 00       	mov    $0x0,%esi
+  801946:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80194c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80194e:	48 85 c0             	test   %rax,%rax
+  801951:	7f 06                	jg     801959 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801953:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801957:	c9                   	leave
+  801958:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801959:	49 89 c0             	mov    %rax,%r8
+  80195c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801961:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  801968:	00 00 00 
+  80196b:	be 26 00 00 00       	mov    $0x26,%esi
+  801970:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  801977:	00 00 00 
+  80197a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197f:	49 b9 94 05 80 00 00 	movabs $0x800594,%r9
+  801986:	00 00 00 
+  801989:	41 ff d1             	call   *%r9
+
+000000000080198c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80198c:	55                   	push   %rbp
+  80198d:	48 89 e5             	mov    %rsp,%rbp
+  801990:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801991:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801996:	ba 00 00 00 00       	mov    $0x0,%edx
+  80199b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019a5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8019af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019b5:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8019b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019bb:	c9                   	leave
+  8019bc:	c3                   	ret
+
+00000000008019bd <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8019bd:	55                   	push   %rbp
+  8019be:	48 89 e5             	mov    %rsp,%rbp
+  8019c1:	53                   	push   %rbx
+  8019c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8019c6:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8019c9:	48 63 ce             	movslq %esi,%rcx
+  8019cc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019cf:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8019de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019e4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019e6:	48 85 c0             	test   %rax,%rax
+  8019e9:	7f 06                	jg     8019f1 <sys_sigqueue+0x34>
+}
+  8019eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019ef:	c9                   	leave
+  8019f0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019f1:	49 89 c0             	mov    %rax,%r8
+  8019f4:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8019f9:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  801a00:	00 00 00 
+  801a03:	be 26 00 00 00       	mov    $0x26,%esi
+  801a08:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  801a0f:	00 00 00 
+  801a12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a17:	49 b9 94 05 80 00 00 	movabs $0x800594,%r9
+  801a1e:	00 00 00 
+  801a21:	41 ff d1             	call   *%r9
+
+0000000000801a24 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801a24:	55                   	push   %rbp
+  801a25:	48 89 e5             	mov    %rsp,%rbp
+  801a28:	53                   	push   %rbx
+  801a29:	48 83 ec 08          	sub    $0x8,%rsp
+  801a2d:	48 89 fa             	mov    %rdi,%rdx
+  801a30:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a33:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a3d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a42:	be 00 00 00 00       	mov    $0x0,%esi
+  801a47:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a4d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a4f:	48 85 c0             	test   %rax,%rax
+  801a52:	7f 06                	jg     801a5a <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801a54:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a58:	c9                   	leave
+  801a59:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a5a:	49 89 c0             	mov    %rax,%r8
+  801a5d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801a62:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  801a69:	00 00 00 
+  801a6c:	be 26 00 00 00       	mov    $0x26,%esi
+  801a71:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  801a78:	00 00 00 
+  801a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a80:	49 b9 94 05 80 00 00 	movabs $0x800594,%r9
+  801a87:	00 00 00 
+  801a8a:	41 ff d1             	call   *%r9
+
+0000000000801a8d <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801a8d:	55                   	push   %rbp
+  801a8e:	48 89 e5             	mov    %rsp,%rbp
+  801a91:	53                   	push   %rbx
+  801a92:	48 83 ec 08          	sub    $0x8,%rsp
+  801a96:	48 89 f1             	mov    %rsi,%rcx
+  801a99:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801a9c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a9f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801aa4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aa9:	be 00 00 00 00       	mov    $0x0,%esi
+  801aae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ab4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ab6:	48 85 c0             	test   %rax,%rax
+  801ab9:	7f 06                	jg     801ac1 <sys_sigaction+0x34>
+}
+  801abb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801abf:	c9                   	leave
+  801ac0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ac1:	49 89 c0             	mov    %rax,%r8
+  801ac4:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801ac9:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  801ad0:	00 00 00 
+  801ad3:	be 26 00 00 00       	mov    $0x26,%esi
+  801ad8:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  801adf:	00 00 00 
+  801ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae7:	49 b9 94 05 80 00 00 	movabs $0x800594,%r9
+  801aee:	00 00 00 
+  801af1:	41 ff d1             	call   *%r9
+
+0000000000801af4 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801af4:	55                   	push   %rbp
+  801af5:	48 89 e5             	mov    %rsp,%rbp
+  801af8:	53                   	push   %rbx
+  801af9:	48 83 ec 08          	sub    $0x8,%rsp
+  801afd:	48 89 f1             	mov    %rsi,%rcx
+  801b00:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801b03:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b06:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b0b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b10:	be 00 00 00 00       	mov    $0x0,%esi
+  801b15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b1b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b1d:	48 85 c0             	test   %rax,%rax
+  801b20:	7f 06                	jg     801b28 <sys_sigprocmask+0x34>
+}
+  801b22:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b26:	c9                   	leave
+  801b27:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b28:	49 89 c0             	mov    %rax,%r8
+  801b2b:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801b30:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  801b37:	00 00 00 
+  801b3a:	be 26 00 00 00       	mov    $0x26,%esi
+  801b3f:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  801b46:	00 00 00 
+  801b49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4e:	49 b9 94 05 80 00 00 	movabs $0x800594,%r9
+  801b55:	00 00 00 
+  801b58:	41 ff d1             	call   *%r9
+
+0000000000801b5b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b5b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b62:	ff ff ff 
+  801b65:	48 01 f8             	add    %rdi,%rax
+  801b68:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801b6c:	c3                   	ret
+
+0000000000801b6d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b6d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b74:	ff ff ff 
+  801b77:	48 01 f8             	add    %rdi,%rax
+  801b7a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801b7e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801b84:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801b88:	c3                   	ret
+
+0000000000801b89 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801b89:	55                   	push   %rbp
+  801b8a:	48 89 e5             	mov    %rsp,%rbp
+  801b8d:	41 57                	push   %r15
+  801b8f:	41 56                	push   %r14
+  801b91:	41 55                	push   %r13
+  801b93:	41 54                	push   %r12
+  801b95:	53                   	push   %rbx
+  801b96:	48 83 ec 08          	sub    $0x8,%rsp
+  801b9a:	49 89 ff             	mov    %rdi,%r15
+  801b9d:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801ba2:	49 bd 07 2b 80 00 00 	movabs $0x802b07,%r13
+  801ba9:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801bac:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801bb2:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801bb5:	48 89 df             	mov    %rbx,%rdi
+  801bb8:	41 ff d5             	call   *%r13
+  801bbb:	83 e0 04             	and    $0x4,%eax
+  801bbe:	74 17                	je     801bd7 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801bc0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801bc7:	4c 39 f3             	cmp    %r14,%rbx
+  801bca:	75 e6                	jne    801bb2 <fd_alloc+0x29>
+  801bcc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801bd2:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801bd7:	4d 89 27             	mov    %r12,(%r15)
+}
+  801bda:	48 83 c4 08          	add    $0x8,%rsp
+  801bde:	5b                   	pop    %rbx
+  801bdf:	41 5c                	pop    %r12
+  801be1:	41 5d                	pop    %r13
+  801be3:	41 5e                	pop    %r14
+  801be5:	41 5f                	pop    %r15
+  801be7:	5d                   	pop    %rbp
+  801be8:	c3                   	ret
+
+0000000000801be9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801be9:	83 ff 1f             	cmp    $0x1f,%edi
+  801bec:	77 39                	ja     801c27 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801bee:	55                   	push   %rbp
+  801bef:	48 89 e5             	mov    %rsp,%rbp
+  801bf2:	41 54                	push   %r12
+  801bf4:	53                   	push   %rbx
+  801bf5:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801bf8:	48 63 df             	movslq %edi,%rbx
+  801bfb:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801c02:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801c06:	48 89 df             	mov    %rbx,%rdi
+  801c09:	48 b8 07 2b 80 00 00 	movabs $0x802b07,%rax
+  801c10:	00 00 00 
+  801c13:	ff d0                	call   *%rax
+  801c15:	a8 04                	test   $0x4,%al
+  801c17:	74 14                	je     801c2d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801c19:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801c1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c22:	5b                   	pop    %rbx
+  801c23:	41 5c                	pop    %r12
+  801c25:	5d                   	pop    %rbp
+  801c26:	c3                   	ret
+        return -E_INVAL;
+  801c27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801c2c:	c3                   	ret
+        return -E_INVAL;
+  801c2d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c32:	eb ee                	jmp    801c22 <fd_lookup+0x39>
+
+0000000000801c34 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801c34:	55                   	push   %rbp
+  801c35:	48 89 e5             	mov    %rsp,%rbp
+  801c38:	41 54                	push   %r12
+  801c3a:	53                   	push   %rbx
+  801c3b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801c3e:	48 b8 e0 36 80 00 00 	movabs $0x8036e0,%rax
+  801c45:	00 00 00 
+  801c48:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801c4f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801c52:	39 3b                	cmp    %edi,(%rbx)
+  801c54:	74 47                	je     801c9d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c56:	48 83 c0 08          	add    $0x8,%rax
+  801c5a:	48 8b 18             	mov    (%rax),%rbx
+  801c5d:	48 85 db             	test   %rbx,%rbx
+  801c60:	75 f0                	jne    801c52 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c62:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c69:	00 00 00 
+  801c6c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c72:	89 fa                	mov    %edi,%edx
+  801c74:	48 bf 60 36 80 00 00 	movabs $0x803660,%rdi
+  801c7b:	00 00 00 
+  801c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c83:	48 b9 e4 06 80 00 00 	movabs $0x8006e4,%rcx
+  801c8a:	00 00 00 
+  801c8d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801c8f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801c94:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801c98:	5b                   	pop    %rbx
+  801c99:	41 5c                	pop    %r12
+  801c9b:	5d                   	pop    %rbp
+  801c9c:	c3                   	ret
+            return 0;
+  801c9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca2:	eb f0                	jmp    801c94 <dev_lookup+0x60>
+
+0000000000801ca4 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ca4:	55                   	push   %rbp
+  801ca5:	48 89 e5             	mov    %rsp,%rbp
+  801ca8:	41 55                	push   %r13
+  801caa:	41 54                	push   %r12
+  801cac:	53                   	push   %rbx
+  801cad:	48 83 ec 18          	sub    $0x18,%rsp
+  801cb1:	48 89 fb             	mov    %rdi,%rbx
+  801cb4:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cb7:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801cbe:	ff ff ff 
+  801cc1:	48 01 df             	add    %rbx,%rdi
+  801cc4:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801cc8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ccc:	48 b8 e9 1b 80 00 00 	movabs $0x801be9,%rax
+  801cd3:	00 00 00 
+  801cd6:	ff d0                	call   *%rax
+  801cd8:	41 89 c5             	mov    %eax,%r13d
+  801cdb:	85 c0                	test   %eax,%eax
+  801cdd:	78 06                	js     801ce5 <fd_close+0x41>
+  801cdf:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ce3:	74 1a                	je     801cff <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ce5:	45 84 e4             	test   %r12b,%r12b
+  801ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ced:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801cf1:	44 89 e8             	mov    %r13d,%eax
+  801cf4:	48 83 c4 18          	add    $0x18,%rsp
+  801cf8:	5b                   	pop    %rbx
+  801cf9:	41 5c                	pop    %r12
+  801cfb:	41 5d                	pop    %r13
+  801cfd:	5d                   	pop    %rbp
+  801cfe:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801cff:	8b 3b                	mov    (%rbx),%edi
+  801d01:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d05:	48 b8 34 1c 80 00 00 	movabs $0x801c34,%rax
+  801d0c:	00 00 00 
+  801d0f:	ff d0                	call   *%rax
+  801d11:	41 89 c5             	mov    %eax,%r13d
+  801d14:	85 c0                	test   %eax,%eax
+  801d16:	78 1b                	js     801d33 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801d18:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d1c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d20:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801d26:	48 85 c0             	test   %rax,%rax
+  801d29:	74 08                	je     801d33 <fd_close+0x8f>
+  801d2b:	48 89 df             	mov    %rbx,%rdi
+  801d2e:	ff d0                	call   *%rax
+  801d30:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801d33:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d38:	48 89 de             	mov    %rbx,%rsi
+  801d3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d40:	48 b8 85 16 80 00 00 	movabs $0x801685,%rax
+  801d47:	00 00 00 
+  801d4a:	ff d0                	call   *%rax
+    return res;
+  801d4c:	eb a3                	jmp    801cf1 <fd_close+0x4d>
+
+0000000000801d4e <close>:
+
+int
+close(int fdnum) {
+  801d4e:	55                   	push   %rbp
+  801d4f:	48 89 e5             	mov    %rsp,%rbp
+  801d52:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d56:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d5a:	48 b8 e9 1b 80 00 00 	movabs $0x801be9,%rax
+  801d61:	00 00 00 
+  801d64:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d66:	85 c0                	test   %eax,%eax
+  801d68:	78 15                	js     801d7f <close+0x31>
+
+    return fd_close(fd, 1);
+  801d6a:	be 01 00 00 00       	mov    $0x1,%esi
+  801d6f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801d73:	48 b8 a4 1c 80 00 00 	movabs $0x801ca4,%rax
+  801d7a:	00 00 00 
+  801d7d:	ff d0                	call   *%rax
+}
+  801d7f:	c9                   	leave
+  801d80:	c3                   	ret
+
+0000000000801d81 <close_all>:
+
+void
+close_all(void) {
+  801d81:	55                   	push   %rbp
+  801d82:	48 89 e5             	mov    %rsp,%rbp
+  801d85:	41 54                	push   %r12
+  801d87:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801d88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d8d:	49 bc 4e 1d 80 00 00 	movabs $0x801d4e,%r12
+  801d94:	00 00 00 
+  801d97:	89 df                	mov    %ebx,%edi
+  801d99:	41 ff d4             	call   *%r12
+  801d9c:	83 c3 01             	add    $0x1,%ebx
+  801d9f:	83 fb 20             	cmp    $0x20,%ebx
+  801da2:	75 f3                	jne    801d97 <close_all+0x16>
+}
+  801da4:	5b                   	pop    %rbx
+  801da5:	41 5c                	pop    %r12
+  801da7:	5d                   	pop    %rbp
+  801da8:	c3                   	ret
+
+0000000000801da9 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801da9:	55                   	push   %rbp
+  801daa:	48 89 e5             	mov    %rsp,%rbp
+  801dad:	41 57                	push   %r15
+  801daf:	41 56                	push   %r14
+  801db1:	41 55                	push   %r13
+  801db3:	41 54                	push   %r12
+  801db5:	53                   	push   %rbx
+  801db6:	48 83 ec 18          	sub    $0x18,%rsp
+  801dba:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801dbd:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801dc1:	48 b8 e9 1b 80 00 00 	movabs $0x801be9,%rax
+  801dc8:	00 00 00 
+  801dcb:	ff d0                	call   *%rax
+  801dcd:	89 c3                	mov    %eax,%ebx
+  801dcf:	85 c0                	test   %eax,%eax
+  801dd1:	0f 88 b8 00 00 00    	js     801e8f <dup+0xe6>
+    close(newfdnum);
+  801dd7:	44 89 e7             	mov    %r12d,%edi
+  801dda:	48 b8 4e 1d 80 00 00 	movabs $0x801d4e,%rax
+  801de1:	00 00 00 
+  801de4:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801de6:	4d 63 ec             	movslq %r12d,%r13
+  801de9:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801df0:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801df4:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801df8:	4c 89 ff             	mov    %r15,%rdi
+  801dfb:	49 be 6d 1b 80 00 00 	movabs $0x801b6d,%r14
+  801e02:	00 00 00 
+  801e05:	41 ff d6             	call   *%r14
+  801e08:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801e0b:	4c 89 ef             	mov    %r13,%rdi
+  801e0e:	41 ff d6             	call   *%r14
+  801e11:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801e14:	48 89 df             	mov    %rbx,%rdi
+  801e17:	48 b8 07 2b 80 00 00 	movabs $0x802b07,%rax
+  801e1e:	00 00 00 
+  801e21:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801e23:	a8 04                	test   $0x4,%al
+  801e25:	74 2b                	je     801e52 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801e27:	41 89 c1             	mov    %eax,%r9d
+  801e2a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e30:	4c 89 f1             	mov    %r14,%rcx
+  801e33:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e38:	48 89 de             	mov    %rbx,%rsi
+  801e3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e40:	48 b8 20 16 80 00 00 	movabs $0x801620,%rax
+  801e47:	00 00 00 
+  801e4a:	ff d0                	call   *%rax
+  801e4c:	89 c3                	mov    %eax,%ebx
+  801e4e:	85 c0                	test   %eax,%eax
+  801e50:	78 4e                	js     801ea0 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801e52:	4c 89 ff             	mov    %r15,%rdi
+  801e55:	48 b8 07 2b 80 00 00 	movabs $0x802b07,%rax
+  801e5c:	00 00 00 
+  801e5f:	ff d0                	call   *%rax
+  801e61:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801e64:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e6a:	4c 89 e9             	mov    %r13,%rcx
+  801e6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e72:	4c 89 fe             	mov    %r15,%rsi
+  801e75:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e7a:	48 b8 20 16 80 00 00 	movabs $0x801620,%rax
+  801e81:	00 00 00 
+  801e84:	ff d0                	call   *%rax
+  801e86:	89 c3                	mov    %eax,%ebx
+  801e88:	85 c0                	test   %eax,%eax
+  801e8a:	78 14                	js     801ea0 <dup+0xf7>
+
+    return newfdnum;
+  801e8c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801e8f:	89 d8                	mov    %ebx,%eax
+  801e91:	48 83 c4 18          	add    $0x18,%rsp
+  801e95:	5b                   	pop    %rbx
+  801e96:	41 5c                	pop    %r12
+  801e98:	41 5d                	pop    %r13
+  801e9a:	41 5e                	pop    %r14
+  801e9c:	41 5f                	pop    %r15
+  801e9e:	5d                   	pop    %rbp
+  801e9f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ea0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ea5:	4c 89 ee             	mov    %r13,%rsi
+  801ea8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ead:	49 bc 85 16 80 00 00 	movabs $0x801685,%r12
+  801eb4:	00 00 00 
+  801eb7:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801eba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ebf:	4c 89 f6             	mov    %r14,%rsi
+  801ec2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ec7:	41 ff d4             	call   *%r12
+    return res;
+  801eca:	eb c3                	jmp    801e8f <dup+0xe6>
+
+0000000000801ecc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801ecc:	55                   	push   %rbp
+  801ecd:	48 89 e5             	mov    %rsp,%rbp
+  801ed0:	41 56                	push   %r14
+  801ed2:	41 55                	push   %r13
+  801ed4:	41 54                	push   %r12
+  801ed6:	53                   	push   %rbx
+  801ed7:	48 83 ec 10          	sub    $0x10,%rsp
+  801edb:	89 fb                	mov    %edi,%ebx
+  801edd:	49 89 f4             	mov    %rsi,%r12
+  801ee0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ee3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ee7:	48 b8 e9 1b 80 00 00 	movabs $0x801be9,%rax
+  801eee:	00 00 00 
+  801ef1:	ff d0                	call   *%rax
+  801ef3:	85 c0                	test   %eax,%eax
+  801ef5:	78 4c                	js     801f43 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ef7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801efb:	41 8b 3e             	mov    (%r14),%edi
+  801efe:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f02:	48 b8 34 1c 80 00 00 	movabs $0x801c34,%rax
+  801f09:	00 00 00 
+  801f0c:	ff d0                	call   *%rax
+  801f0e:	85 c0                	test   %eax,%eax
+  801f10:	78 35                	js     801f47 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f12:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801f16:	83 e0 03             	and    $0x3,%eax
+  801f19:	83 f8 01             	cmp    $0x1,%eax
+  801f1c:	74 2d                	je     801f4b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f1e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f22:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f26:	48 85 c0             	test   %rax,%rax
+  801f29:	74 56                	je     801f81 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801f2b:	4c 89 ea             	mov    %r13,%rdx
+  801f2e:	4c 89 e6             	mov    %r12,%rsi
+  801f31:	4c 89 f7             	mov    %r14,%rdi
+  801f34:	ff d0                	call   *%rax
+}
+  801f36:	48 83 c4 10          	add    $0x10,%rsp
+  801f3a:	5b                   	pop    %rbx
+  801f3b:	41 5c                	pop    %r12
+  801f3d:	41 5d                	pop    %r13
+  801f3f:	41 5e                	pop    %r14
+  801f41:	5d                   	pop    %rbp
+  801f42:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f43:	48 98                	cltq
+  801f45:	eb ef                	jmp    801f36 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f47:	48 98                	cltq
+  801f49:	eb eb                	jmp    801f36 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f4b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f52:	00 00 00 
+  801f55:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f5b:	89 da                	mov    %ebx,%edx
+  801f5d:	48 bf a1 36 80 00 00 	movabs $0x8036a1,%rdi
+  801f64:	00 00 00 
+  801f67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f6c:	48 b9 e4 06 80 00 00 	movabs $0x8006e4,%rcx
+  801f73:	00 00 00 
+  801f76:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f78:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f7f:	eb b5                	jmp    801f36 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f81:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f88:	eb ac                	jmp    801f36 <read+0x6a>
+
+0000000000801f8a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801f8a:	55                   	push   %rbp
+  801f8b:	48 89 e5             	mov    %rsp,%rbp
+  801f8e:	41 57                	push   %r15
+  801f90:	41 56                	push   %r14
+  801f92:	41 55                	push   %r13
+  801f94:	41 54                	push   %r12
+  801f96:	53                   	push   %rbx
+  801f97:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801f9b:	48 85 d2             	test   %rdx,%rdx
+  801f9e:	74 54                	je     801ff4 <readn+0x6a>
+  801fa0:	41 89 fd             	mov    %edi,%r13d
+  801fa3:	49 89 f6             	mov    %rsi,%r14
+  801fa6:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801fa9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801fae:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801fb3:	49 bf cc 1e 80 00 00 	movabs $0x801ecc,%r15
+  801fba:	00 00 00 
+  801fbd:	4c 89 e2             	mov    %r12,%rdx
+  801fc0:	48 29 f2             	sub    %rsi,%rdx
+  801fc3:	4c 01 f6             	add    %r14,%rsi
+  801fc6:	44 89 ef             	mov    %r13d,%edi
+  801fc9:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801fcc:	85 c0                	test   %eax,%eax
+  801fce:	78 20                	js     801ff0 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801fd0:	01 c3                	add    %eax,%ebx
+  801fd2:	85 c0                	test   %eax,%eax
+  801fd4:	74 08                	je     801fde <readn+0x54>
+  801fd6:	48 63 f3             	movslq %ebx,%rsi
+  801fd9:	4c 39 e6             	cmp    %r12,%rsi
+  801fdc:	72 df                	jb     801fbd <readn+0x33>
+    }
+    return res;
+  801fde:	48 63 c3             	movslq %ebx,%rax
+}
+  801fe1:	48 83 c4 08          	add    $0x8,%rsp
+  801fe5:	5b                   	pop    %rbx
+  801fe6:	41 5c                	pop    %r12
+  801fe8:	41 5d                	pop    %r13
+  801fea:	41 5e                	pop    %r14
+  801fec:	41 5f                	pop    %r15
+  801fee:	5d                   	pop    %rbp
+  801fef:	c3                   	ret
+        if (inc < 0) return inc;
+  801ff0:	48 98                	cltq
+  801ff2:	eb ed                	jmp    801fe1 <readn+0x57>
+    int inc = 1, res = 0;
+  801ff4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ff9:	eb e3                	jmp    801fde <readn+0x54>
+
+0000000000801ffb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ffb:	55                   	push   %rbp
+  801ffc:	48 89 e5             	mov    %rsp,%rbp
+  801fff:	41 56                	push   %r14
+  802001:	41 55                	push   %r13
+  802003:	41 54                	push   %r12
+  802005:	53                   	push   %rbx
+  802006:	48 83 ec 10          	sub    $0x10,%rsp
+  80200a:	89 fb                	mov    %edi,%ebx
+  80200c:	49 89 f4             	mov    %rsi,%r12
+  80200f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802012:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802016:	48 b8 e9 1b 80 00 00 	movabs $0x801be9,%rax
+  80201d:	00 00 00 
+  802020:	ff d0                	call   *%rax
+  802022:	85 c0                	test   %eax,%eax
+  802024:	78 47                	js     80206d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802026:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80202a:	41 8b 3e             	mov    (%r14),%edi
+  80202d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802031:	48 b8 34 1c 80 00 00 	movabs $0x801c34,%rax
+  802038:	00 00 00 
+  80203b:	ff d0                	call   *%rax
+  80203d:	85 c0                	test   %eax,%eax
+  80203f:	78 30                	js     802071 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802041:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802046:	74 2d                	je     802075 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802048:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80204c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802050:	48 85 c0             	test   %rax,%rax
+  802053:	74 56                	je     8020ab <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802055:	4c 89 ea             	mov    %r13,%rdx
+  802058:	4c 89 e6             	mov    %r12,%rsi
+  80205b:	4c 89 f7             	mov    %r14,%rdi
+  80205e:	ff d0                	call   *%rax
+}
+  802060:	48 83 c4 10          	add    $0x10,%rsp
+  802064:	5b                   	pop    %rbx
+  802065:	41 5c                	pop    %r12
+  802067:	41 5d                	pop    %r13
+  802069:	41 5e                	pop    %r14
+  80206b:	5d                   	pop    %rbp
+  80206c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80206d:	48 98                	cltq
+  80206f:	eb ef                	jmp    802060 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802071:	48 98                	cltq
+  802073:	eb eb                	jmp    802060 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802075:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80207c:	00 00 00 
+  80207f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802085:	89 da                	mov    %ebx,%edx
+  802087:	48 bf bd 36 80 00 00 	movabs $0x8036bd,%rdi
+  80208e:	00 00 00 
+  802091:	b8 00 00 00 00       	mov    $0x0,%eax
+  802096:	48 b9 e4 06 80 00 00 	movabs $0x8006e4,%rcx
+  80209d:	00 00 00 
+  8020a0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020a2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020a9:	eb b5                	jmp    802060 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020ab:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020b2:	eb ac                	jmp    802060 <write+0x65>
+
+00000000008020b4 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8020b4:	55                   	push   %rbp
+  8020b5:	48 89 e5             	mov    %rsp,%rbp
+  8020b8:	53                   	push   %rbx
+  8020b9:	48 83 ec 18          	sub    $0x18,%rsp
+  8020bd:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020bf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020c3:	48 b8 e9 1b 80 00 00 	movabs $0x801be9,%rax
+  8020ca:	00 00 00 
+  8020cd:	ff d0                	call   *%rax
+  8020cf:	85 c0                	test   %eax,%eax
+  8020d1:	78 0c                	js     8020df <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8020d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020d7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8020da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020e3:	c9                   	leave
+  8020e4:	c3                   	ret
+
+00000000008020e5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8020e5:	55                   	push   %rbp
+  8020e6:	48 89 e5             	mov    %rsp,%rbp
+  8020e9:	41 55                	push   %r13
+  8020eb:	41 54                	push   %r12
+  8020ed:	53                   	push   %rbx
+  8020ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8020f2:	89 fb                	mov    %edi,%ebx
+  8020f4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020f7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020fb:	48 b8 e9 1b 80 00 00 	movabs $0x801be9,%rax
+  802102:	00 00 00 
+  802105:	ff d0                	call   *%rax
+  802107:	85 c0                	test   %eax,%eax
+  802109:	78 38                	js     802143 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80210b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80210f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802113:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802117:	48 b8 34 1c 80 00 00 	movabs $0x801c34,%rax
+  80211e:	00 00 00 
+  802121:	ff d0                	call   *%rax
+  802123:	85 c0                	test   %eax,%eax
+  802125:	78 1c                	js     802143 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802127:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80212c:	74 20                	je     80214e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80212e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802132:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802136:	48 85 c0             	test   %rax,%rax
+  802139:	74 47                	je     802182 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80213b:	44 89 e6             	mov    %r12d,%esi
+  80213e:	4c 89 ef             	mov    %r13,%rdi
+  802141:	ff d0                	call   *%rax
+}
+  802143:	48 83 c4 18          	add    $0x18,%rsp
+  802147:	5b                   	pop    %rbx
+  802148:	41 5c                	pop    %r12
+  80214a:	41 5d                	pop    %r13
+  80214c:	5d                   	pop    %rbp
+  80214d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80214e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802155:	00 00 00 
+  802158:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80215e:	89 da                	mov    %ebx,%edx
+  802160:	48 bf 80 36 80 00 00 	movabs $0x803680,%rdi
+  802167:	00 00 00 
+  80216a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80216f:	48 b9 e4 06 80 00 00 	movabs $0x8006e4,%rcx
+  802176:	00 00 00 
+  802179:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80217b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802180:	eb c1                	jmp    802143 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802182:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802187:	eb ba                	jmp    802143 <ftruncate+0x5e>
+
+0000000000802189 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802189:	55                   	push   %rbp
+  80218a:	48 89 e5             	mov    %rsp,%rbp
+  80218d:	41 54                	push   %r12
+  80218f:	53                   	push   %rbx
+  802190:	48 83 ec 10          	sub    $0x10,%rsp
+  802194:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802197:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80219b:	48 b8 e9 1b 80 00 00 	movabs $0x801be9,%rax
+  8021a2:	00 00 00 
+  8021a5:	ff d0                	call   *%rax
+  8021a7:	85 c0                	test   %eax,%eax
+  8021a9:	78 4e                	js     8021f9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021ab:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8021af:	41 8b 3c 24          	mov    (%r12),%edi
+  8021b3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8021b7:	48 b8 34 1c 80 00 00 	movabs $0x801c34,%rax
+  8021be:	00 00 00 
+  8021c1:	ff d0                	call   *%rax
+  8021c3:	85 c0                	test   %eax,%eax
+  8021c5:	78 32                	js     8021f9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8021c7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8021cb:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8021d0:	74 30                	je     802202 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8021d2:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8021d5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8021dc:	00 00 00 
+    stat->st_isdir = 0;
+  8021df:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8021e6:	00 00 00 
+    stat->st_dev = dev;
+  8021e9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8021f0:	48 89 de             	mov    %rbx,%rsi
+  8021f3:	4c 89 e7             	mov    %r12,%rdi
+  8021f6:	ff 50 28             	call   *0x28(%rax)
+}
+  8021f9:	48 83 c4 10          	add    $0x10,%rsp
+  8021fd:	5b                   	pop    %rbx
+  8021fe:	41 5c                	pop    %r12
+  802200:	5d                   	pop    %rbp
+  802201:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802202:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802207:	eb f0                	jmp    8021f9 <fstat+0x70>
+
+0000000000802209 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802209:	55                   	push   %rbp
+  80220a:	48 89 e5             	mov    %rsp,%rbp
+  80220d:	41 54                	push   %r12
+  80220f:	53                   	push   %rbx
+  802210:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802213:	be 00 00 00 00       	mov    $0x0,%esi
+  802218:	48 b8 8a 24 80 00 00 	movabs $0x80248a,%rax
+  80221f:	00 00 00 
+  802222:	ff d0                	call   *%rax
+  802224:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802226:	85 c0                	test   %eax,%eax
+  802228:	78 25                	js     80224f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80222a:	4c 89 e6             	mov    %r12,%rsi
+  80222d:	89 c7                	mov    %eax,%edi
+  80222f:	48 b8 89 21 80 00 00 	movabs $0x802189,%rax
+  802236:	00 00 00 
+  802239:	ff d0                	call   *%rax
+  80223b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80223e:	89 df                	mov    %ebx,%edi
+  802240:	48 b8 4e 1d 80 00 00 	movabs $0x801d4e,%rax
+  802247:	00 00 00 
+  80224a:	ff d0                	call   *%rax
+
+    return res;
+  80224c:	44 89 e3             	mov    %r12d,%ebx
+}
+  80224f:	89 d8                	mov    %ebx,%eax
+  802251:	5b                   	pop    %rbx
+  802252:	41 5c                	pop    %r12
+  802254:	5d                   	pop    %rbp
+  802255:	c3                   	ret
+
+0000000000802256 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802256:	55                   	push   %rbp
+  802257:	48 89 e5             	mov    %rsp,%rbp
+  80225a:	41 54                	push   %r12
+  80225c:	53                   	push   %rbx
+  80225d:	48 83 ec 10          	sub    $0x10,%rsp
+  802261:	41 89 fc             	mov    %edi,%r12d
+  802264:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802267:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80226e:	00 00 00 
+  802271:	83 38 00             	cmpl   $0x0,(%rax)
+  802274:	74 5e                	je     8022d4 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802276:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80227c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802281:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802288:	00 00 00 
+  80228b:	44 89 e6             	mov    %r12d,%esi
+  80228e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802295:	00 00 00 
+  802298:	8b 38                	mov    (%rax),%edi
+  80229a:	48 b8 c3 2e 80 00 00 	movabs $0x802ec3,%rax
+  8022a1:	00 00 00 
+  8022a4:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8022a6:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8022ad:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8022ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022b3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8022b7:	48 89 de             	mov    %rbx,%rsi
+  8022ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022bf:	48 b8 2e 2e 80 00 00 	movabs $0x802e2e,%rax
+  8022c6:	00 00 00 
+  8022c9:	ff d0                	call   *%rax
+}
+  8022cb:	48 83 c4 10          	add    $0x10,%rsp
+  8022cf:	5b                   	pop    %rbx
+  8022d0:	41 5c                	pop    %r12
+  8022d2:	5d                   	pop    %rbp
+  8022d3:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022d4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022d9:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  8022e0:	00 00 00 
+  8022e3:	ff d0                	call   *%rax
+  8022e5:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8022ec:	00 00 
+  8022ee:	eb 86                	jmp    802276 <fsipc+0x20>
+
+00000000008022f0 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8022f0:	55                   	push   %rbp
+  8022f1:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8022f4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022fb:	00 00 00 
+  8022fe:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802301:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802303:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802306:	be 00 00 00 00       	mov    $0x0,%esi
+  80230b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802310:	48 b8 56 22 80 00 00 	movabs $0x802256,%rax
+  802317:	00 00 00 
+  80231a:	ff d0                	call   *%rax
+}
+  80231c:	5d                   	pop    %rbp
+  80231d:	c3                   	ret
+
+000000000080231e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80231e:	55                   	push   %rbp
+  80231f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802322:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802325:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80232c:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80232e:	be 00 00 00 00       	mov    $0x0,%esi
+  802333:	bf 06 00 00 00       	mov    $0x6,%edi
+  802338:	48 b8 56 22 80 00 00 	movabs $0x802256,%rax
+  80233f:	00 00 00 
+  802342:	ff d0                	call   *%rax
+}
+  802344:	5d                   	pop    %rbp
+  802345:	c3                   	ret
+
+0000000000802346 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802346:	55                   	push   %rbp
+  802347:	48 89 e5             	mov    %rsp,%rbp
+  80234a:	41 54                	push   %r12
+  80234c:	53                   	push   %rbx
+  80234d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802350:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802353:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80235a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80235c:	be 00 00 00 00       	mov    $0x0,%esi
+  802361:	bf 05 00 00 00       	mov    $0x5,%edi
+  802366:	48 b8 56 22 80 00 00 	movabs $0x802256,%rax
+  80236d:	00 00 00 
+  802370:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802372:	85 c0                	test   %eax,%eax
+  802374:	78 3d                	js     8023b3 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802376:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80237d:	00 00 00 
+  802380:	4c 89 e6             	mov    %r12,%rsi
+  802383:	48 89 df             	mov    %rbx,%rdi
+  802386:	48 b8 09 10 80 00 00 	movabs $0x801009,%rax
+  80238d:	00 00 00 
+  802390:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802392:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802399:	00 
+  80239a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8023a0:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8023a7:	00 
+  8023a8:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8023ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023b3:	5b                   	pop    %rbx
+  8023b4:	41 5c                	pop    %r12
+  8023b6:	5d                   	pop    %rbp
+  8023b7:	c3                   	ret
+
+00000000008023b8 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8023b8:	55                   	push   %rbp
+  8023b9:	48 89 e5             	mov    %rsp,%rbp
+  8023bc:	41 54                	push   %r12
+  8023be:	53                   	push   %rbx
+  8023bf:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8023c2:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8023c7:	48 39 c2             	cmp    %rax,%rdx
+  8023ca:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8023ce:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8023d1:	48 89 c2             	mov    %rax,%rdx
+  8023d4:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8023db:	00 00 00 
+  8023de:	48 b8 6a 12 80 00 00 	movabs $0x80126a,%rax
+  8023e5:	00 00 00 
+  8023e8:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8023ea:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023f1:	00 00 00 
+  8023f4:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8023f9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8023fb:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8023ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802404:	bf 04 00 00 00       	mov    $0x4,%edi
+  802409:	48 b8 56 22 80 00 00 	movabs $0x802256,%rax
+  802410:	00 00 00 
+  802413:	ff d0                	call   *%rax
+  802415:	48 98                	cltq
+}
+  802417:	5b                   	pop    %rbx
+  802418:	41 5c                	pop    %r12
+  80241a:	5d                   	pop    %rbp
+  80241b:	c3                   	ret
+
+000000000080241c <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80241c:	55                   	push   %rbp
+  80241d:	48 89 e5             	mov    %rsp,%rbp
+  802420:	41 54                	push   %r12
+  802422:	53                   	push   %rbx
+  802423:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802426:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80242d:	00 00 00 
+  802430:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802433:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  802435:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80243a:	48 39 ca             	cmp    %rcx,%rdx
+  80243d:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  802441:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  802445:	be 00 00 00 00       	mov    $0x0,%esi
+  80244a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80244f:	48 b8 56 22 80 00 00 	movabs $0x802256,%rax
+  802456:	00 00 00 
+  802459:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  80245b:	85 c0                	test   %eax,%eax
+  80245d:	78 27                	js     802486 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  80245f:	48 63 d8             	movslq %eax,%rbx
+  802462:	48 89 da             	mov    %rbx,%rdx
+  802465:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80246c:	00 00 00 
+  80246f:	4c 89 e7             	mov    %r12,%rdi
+  802472:	48 b8 6a 12 80 00 00 	movabs $0x80126a,%rax
+  802479:	00 00 00 
+  80247c:	ff d0                	call   *%rax
+    return bytes_read;
+  80247e:	48 89 d8             	mov    %rbx,%rax
+}
+  802481:	5b                   	pop    %rbx
+  802482:	41 5c                	pop    %r12
+  802484:	5d                   	pop    %rbp
+  802485:	c3                   	ret
+        return bytes_read;
+  802486:	48 98                	cltq
+  802488:	eb f7                	jmp    802481 <devfile_read+0x65>
+
+000000000080248a <open>:
+open(const char *path, int mode) {
+  80248a:	55                   	push   %rbp
+  80248b:	48 89 e5             	mov    %rsp,%rbp
+  80248e:	41 55                	push   %r13
+  802490:	41 54                	push   %r12
+  802492:	53                   	push   %rbx
+  802493:	48 83 ec 18          	sub    $0x18,%rsp
+  802497:	49 89 fc             	mov    %rdi,%r12
+  80249a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80249d:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  8024a4:	00 00 00 
+  8024a7:	ff d0                	call   *%rax
+  8024a9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024af:	0f 87 8a 00 00 00    	ja     80253f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8024b5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8024b9:	48 b8 89 1b 80 00 00 	movabs $0x801b89,%rax
+  8024c0:	00 00 00 
+  8024c3:	ff d0                	call   *%rax
+  8024c5:	89 c3                	mov    %eax,%ebx
+  8024c7:	85 c0                	test   %eax,%eax
+  8024c9:	78 50                	js     80251b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8024cb:	4c 89 e6             	mov    %r12,%rsi
+  8024ce:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8024d5:	00 00 00 
+  8024d8:	48 89 df             	mov    %rbx,%rdi
+  8024db:	48 b8 09 10 80 00 00 	movabs $0x801009,%rax
+  8024e2:	00 00 00 
+  8024e5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8024e7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8024ee:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8024f2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8024f7:	48 b8 56 22 80 00 00 	movabs $0x802256,%rax
+  8024fe:	00 00 00 
+  802501:	ff d0                	call   *%rax
+  802503:	89 c3                	mov    %eax,%ebx
+  802505:	85 c0                	test   %eax,%eax
+  802507:	78 1f                	js     802528 <open+0x9e>
+    return fd2num(fd);
+  802509:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80250d:	48 b8 5b 1b 80 00 00 	movabs $0x801b5b,%rax
+  802514:	00 00 00 
+  802517:	ff d0                	call   *%rax
+  802519:	89 c3                	mov    %eax,%ebx
+}
+  80251b:	89 d8                	mov    %ebx,%eax
+  80251d:	48 83 c4 18          	add    $0x18,%rsp
+  802521:	5b                   	pop    %rbx
+  802522:	41 5c                	pop    %r12
+  802524:	41 5d                	pop    %r13
+  802526:	5d                   	pop    %rbp
+  802527:	c3                   	ret
+        fd_close(fd, 0);
+  802528:	be 00 00 00 00       	mov    $0x0,%esi
+  80252d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802531:	48 b8 a4 1c 80 00 00 	movabs $0x801ca4,%rax
+  802538:	00 00 00 
+  80253b:	ff d0                	call   *%rax
+        return res;
+  80253d:	eb dc                	jmp    80251b <open+0x91>
+        return -E_BAD_PATH;
+  80253f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802544:	eb d5                	jmp    80251b <open+0x91>
+
+0000000000802546 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802546:	55                   	push   %rbp
+  802547:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80254a:	be 00 00 00 00       	mov    $0x0,%esi
+  80254f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802554:	48 b8 56 22 80 00 00 	movabs $0x802256,%rax
+  80255b:	00 00 00 
+  80255e:	ff d0                	call   *%rax
+}
+  802560:	5d                   	pop    %rbp
+  802561:	c3                   	ret
+
+0000000000802562 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802562:	55                   	push   %rbp
+  802563:	48 89 e5             	mov    %rsp,%rbp
+  802566:	41 54                	push   %r12
+  802568:	53                   	push   %rbx
+  802569:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80256c:	48 b8 6d 1b 80 00 00 	movabs $0x801b6d,%rax
+  802573:	00 00 00 
+  802576:	ff d0                	call   *%rax
+  802578:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80257b:	48 be 00 37 80 00 00 	movabs $0x803700,%rsi
+  802582:	00 00 00 
+  802585:	48 89 df             	mov    %rbx,%rdi
+  802588:	48 b8 09 10 80 00 00 	movabs $0x801009,%rax
+  80258f:	00 00 00 
+  802592:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802594:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802599:	41 2b 04 24          	sub    (%r12),%eax
+  80259d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8025a3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8025aa:	00 00 00 
+    stat->st_dev = &devpipe;
+  8025ad:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8025b4:	00 00 00 
+  8025b7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8025be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c3:	5b                   	pop    %rbx
+  8025c4:	41 5c                	pop    %r12
+  8025c6:	5d                   	pop    %rbp
+  8025c7:	c3                   	ret
+
+00000000008025c8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8025c8:	55                   	push   %rbp
+  8025c9:	48 89 e5             	mov    %rsp,%rbp
+  8025cc:	41 54                	push   %r12
+  8025ce:	53                   	push   %rbx
+  8025cf:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8025d2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025d7:	48 89 fe             	mov    %rdi,%rsi
+  8025da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025df:	49 bc 85 16 80 00 00 	movabs $0x801685,%r12
+  8025e6:	00 00 00 
+  8025e9:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8025ec:	48 89 df             	mov    %rbx,%rdi
+  8025ef:	48 b8 6d 1b 80 00 00 	movabs $0x801b6d,%rax
+  8025f6:	00 00 00 
+  8025f9:	ff d0                	call   *%rax
+  8025fb:	48 89 c6             	mov    %rax,%rsi
+  8025fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802603:	bf 00 00 00 00       	mov    $0x0,%edi
+  802608:	41 ff d4             	call   *%r12
+}
+  80260b:	5b                   	pop    %rbx
+  80260c:	41 5c                	pop    %r12
+  80260e:	5d                   	pop    %rbp
+  80260f:	c3                   	ret
+
+0000000000802610 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802610:	55                   	push   %rbp
+  802611:	48 89 e5             	mov    %rsp,%rbp
+  802614:	41 57                	push   %r15
+  802616:	41 56                	push   %r14
+  802618:	41 55                	push   %r13
+  80261a:	41 54                	push   %r12
+  80261c:	53                   	push   %rbx
+  80261d:	48 83 ec 18          	sub    $0x18,%rsp
+  802621:	49 89 fc             	mov    %rdi,%r12
+  802624:	49 89 f5             	mov    %rsi,%r13
+  802627:	49 89 d7             	mov    %rdx,%r15
+  80262a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80262e:	48 b8 6d 1b 80 00 00 	movabs $0x801b6d,%rax
+  802635:	00 00 00 
+  802638:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80263a:	4d 85 ff             	test   %r15,%r15
+  80263d:	0f 84 af 00 00 00    	je     8026f2 <devpipe_write+0xe2>
+  802643:	48 89 c3             	mov    %rax,%rbx
+  802646:	4c 89 f8             	mov    %r15,%rax
+  802649:	4d 89 ef             	mov    %r13,%r15
+  80264c:	4c 01 e8             	add    %r13,%rax
+  80264f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802653:	49 bd 8d 15 80 00 00 	movabs $0x80158d,%r13
+  80265a:	00 00 00 
+            sys_yield();
+  80265d:	49 be 2a 15 80 00 00 	movabs $0x80152a,%r14
+  802664:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802667:	8b 73 04             	mov    0x4(%rbx),%esi
+  80266a:	48 63 ce             	movslq %esi,%rcx
+  80266d:	48 63 03             	movslq (%rbx),%rax
+  802670:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802676:	48 39 c1             	cmp    %rax,%rcx
+  802679:	72 2e                	jb     8026a9 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80267b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802680:	48 89 da             	mov    %rbx,%rdx
+  802683:	be 00 10 00 00       	mov    $0x1000,%esi
+  802688:	4c 89 e7             	mov    %r12,%rdi
+  80268b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80268e:	85 c0                	test   %eax,%eax
+  802690:	74 66                	je     8026f8 <devpipe_write+0xe8>
+            sys_yield();
+  802692:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802695:	8b 73 04             	mov    0x4(%rbx),%esi
+  802698:	48 63 ce             	movslq %esi,%rcx
+  80269b:	48 63 03             	movslq (%rbx),%rax
+  80269e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8026a4:	48 39 c1             	cmp    %rax,%rcx
+  8026a7:	73 d2                	jae    80267b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8026a9:	41 0f b6 3f          	movzbl (%r15),%edi
+  8026ad:	48 89 ca             	mov    %rcx,%rdx
+  8026b0:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026b4:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8026bb:	08 10 20 
+  8026be:	48 f7 e2             	mul    %rdx
+  8026c1:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026c5:	48 89 d0             	mov    %rdx,%rax
+  8026c8:	48 c1 e0 09          	shl    $0x9,%rax
+  8026cc:	48 29 d0             	sub    %rdx,%rax
+  8026cf:	48 c1 e0 03          	shl    $0x3,%rax
+  8026d3:	48 29 c1             	sub    %rax,%rcx
+  8026d6:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8026db:	83 c6 01             	add    $0x1,%esi
+  8026de:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8026e1:	49 83 c7 01          	add    $0x1,%r15
+  8026e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026e9:	49 39 c7             	cmp    %rax,%r15
+  8026ec:	0f 85 75 ff ff ff    	jne    802667 <devpipe_write+0x57>
+    return n;
+  8026f2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8026f6:	eb 05                	jmp    8026fd <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8026f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026fd:	48 83 c4 18          	add    $0x18,%rsp
+  802701:	5b                   	pop    %rbx
+  802702:	41 5c                	pop    %r12
+  802704:	41 5d                	pop    %r13
+  802706:	41 5e                	pop    %r14
+  802708:	41 5f                	pop    %r15
+  80270a:	5d                   	pop    %rbp
+  80270b:	c3                   	ret
+
+000000000080270c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80270c:	55                   	push   %rbp
+  80270d:	48 89 e5             	mov    %rsp,%rbp
+  802710:	41 57                	push   %r15
+  802712:	41 56                	push   %r14
+  802714:	41 55                	push   %r13
+  802716:	41 54                	push   %r12
+  802718:	53                   	push   %rbx
+  802719:	48 83 ec 18          	sub    $0x18,%rsp
+  80271d:	49 89 fc             	mov    %rdi,%r12
+  802720:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802724:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802728:	48 b8 6d 1b 80 00 00 	movabs $0x801b6d,%rax
+  80272f:	00 00 00 
+  802732:	ff d0                	call   *%rax
+  802734:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802737:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80273d:	49 bd 8d 15 80 00 00 	movabs $0x80158d,%r13
+  802744:	00 00 00 
+            sys_yield();
+  802747:	49 be 2a 15 80 00 00 	movabs $0x80152a,%r14
+  80274e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802751:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802756:	74 7d                	je     8027d5 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802758:	8b 03                	mov    (%rbx),%eax
+  80275a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80275d:	75 26                	jne    802785 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80275f:	4d 85 ff             	test   %r15,%r15
+  802762:	75 77                	jne    8027db <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802764:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802769:	48 89 da             	mov    %rbx,%rdx
+  80276c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802771:	4c 89 e7             	mov    %r12,%rdi
+  802774:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802777:	85 c0                	test   %eax,%eax
+  802779:	74 72                	je     8027ed <devpipe_read+0xe1>
+            sys_yield();
+  80277b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80277e:	8b 03                	mov    (%rbx),%eax
+  802780:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802783:	74 df                	je     802764 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802785:	48 63 c8             	movslq %eax,%rcx
+  802788:	48 89 ca             	mov    %rcx,%rdx
+  80278b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80278f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802796:	08 10 20 
+  802799:	48 89 d0             	mov    %rdx,%rax
+  80279c:	48 f7 e6             	mul    %rsi
+  80279f:	48 c1 ea 06          	shr    $0x6,%rdx
+  8027a3:	48 89 d0             	mov    %rdx,%rax
+  8027a6:	48 c1 e0 09          	shl    $0x9,%rax
+  8027aa:	48 29 d0             	sub    %rdx,%rax
+  8027ad:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8027b4:	00 
+  8027b5:	48 89 c8             	mov    %rcx,%rax
+  8027b8:	48 29 d0             	sub    %rdx,%rax
+  8027bb:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8027c0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8027c4:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8027c8:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8027cb:	49 83 c7 01          	add    $0x1,%r15
+  8027cf:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8027d3:	75 83                	jne    802758 <devpipe_read+0x4c>
+    return n;
+  8027d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027d9:	eb 03                	jmp    8027de <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8027db:	4c 89 f8             	mov    %r15,%rax
+}
+  8027de:	48 83 c4 18          	add    $0x18,%rsp
+  8027e2:	5b                   	pop    %rbx
+  8027e3:	41 5c                	pop    %r12
+  8027e5:	41 5d                	pop    %r13
+  8027e7:	41 5e                	pop    %r14
+  8027e9:	41 5f                	pop    %r15
+  8027eb:	5d                   	pop    %rbp
+  8027ec:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8027ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f2:	eb ea                	jmp    8027de <devpipe_read+0xd2>
+
+00000000008027f4 <pipe>:
+pipe(int pfd[2]) {
+  8027f4:	55                   	push   %rbp
+  8027f5:	48 89 e5             	mov    %rsp,%rbp
+  8027f8:	41 55                	push   %r13
+  8027fa:	41 54                	push   %r12
+  8027fc:	53                   	push   %rbx
+  8027fd:	48 83 ec 18          	sub    $0x18,%rsp
+  802801:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802804:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802808:	48 b8 89 1b 80 00 00 	movabs $0x801b89,%rax
+  80280f:	00 00 00 
+  802812:	ff d0                	call   *%rax
+  802814:	89 c3                	mov    %eax,%ebx
+  802816:	85 c0                	test   %eax,%eax
+  802818:	0f 88 a0 01 00 00    	js     8029be <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80281e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802823:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802828:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80282c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802831:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  802838:	00 00 00 
+  80283b:	ff d0                	call   *%rax
+  80283d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80283f:	85 c0                	test   %eax,%eax
+  802841:	0f 88 77 01 00 00    	js     8029be <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802847:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80284b:	48 b8 89 1b 80 00 00 	movabs $0x801b89,%rax
+  802852:	00 00 00 
+  802855:	ff d0                	call   *%rax
+  802857:	89 c3                	mov    %eax,%ebx
+  802859:	85 c0                	test   %eax,%eax
+  80285b:	0f 88 43 01 00 00    	js     8029a4 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802861:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802866:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80286b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80286f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802874:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  80287b:	00 00 00 
+  80287e:	ff d0                	call   *%rax
+  802880:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802882:	85 c0                	test   %eax,%eax
+  802884:	0f 88 1a 01 00 00    	js     8029a4 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80288a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80288e:	48 b8 6d 1b 80 00 00 	movabs $0x801b6d,%rax
+  802895:	00 00 00 
+  802898:	ff d0                	call   *%rax
+  80289a:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80289d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8028a2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028a7:	48 89 c6             	mov    %rax,%rsi
+  8028aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028af:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  8028b6:	00 00 00 
+  8028b9:	ff d0                	call   *%rax
+  8028bb:	89 c3                	mov    %eax,%ebx
+  8028bd:	85 c0                	test   %eax,%eax
+  8028bf:	0f 88 c5 00 00 00    	js     80298a <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8028c5:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028c9:	48 b8 6d 1b 80 00 00 	movabs $0x801b6d,%rax
+  8028d0:	00 00 00 
+  8028d3:	ff d0                	call   *%rax
+  8028d5:	48 89 c1             	mov    %rax,%rcx
+  8028d8:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8028de:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8028e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028e9:	4c 89 ee             	mov    %r13,%rsi
+  8028ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028f1:	48 b8 20 16 80 00 00 	movabs $0x801620,%rax
+  8028f8:	00 00 00 
+  8028fb:	ff d0                	call   *%rax
+  8028fd:	89 c3                	mov    %eax,%ebx
+  8028ff:	85 c0                	test   %eax,%eax
+  802901:	78 6e                	js     802971 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802903:	be 00 10 00 00       	mov    $0x1000,%esi
+  802908:	4c 89 ef             	mov    %r13,%rdi
+  80290b:	48 b8 5b 15 80 00 00 	movabs $0x80155b,%rax
+  802912:	00 00 00 
+  802915:	ff d0                	call   *%rax
+  802917:	83 f8 02             	cmp    $0x2,%eax
+  80291a:	0f 85 ab 00 00 00    	jne    8029cb <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802920:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802927:	00 00 
+  802929:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80292d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80292f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802933:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80293a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80293e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802940:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802944:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80294b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80294f:	48 bb 5b 1b 80 00 00 	movabs $0x801b5b,%rbx
+  802956:	00 00 00 
+  802959:	ff d3                	call   *%rbx
+  80295b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80295f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802963:	ff d3                	call   *%rbx
+  802965:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80296a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80296f:	eb 4d                	jmp    8029be <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802971:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802976:	4c 89 ee             	mov    %r13,%rsi
+  802979:	bf 00 00 00 00       	mov    $0x0,%edi
+  80297e:	48 b8 85 16 80 00 00 	movabs $0x801685,%rax
+  802985:	00 00 00 
+  802988:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80298a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80298f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802993:	bf 00 00 00 00       	mov    $0x0,%edi
+  802998:	48 b8 85 16 80 00 00 	movabs $0x801685,%rax
+  80299f:	00 00 00 
+  8029a2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8029a4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029a9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8029ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029b2:	48 b8 85 16 80 00 00 	movabs $0x801685,%rax
+  8029b9:	00 00 00 
+  8029bc:	ff d0                	call   *%rax
+}
+  8029be:	89 d8                	mov    %ebx,%eax
+  8029c0:	48 83 c4 18          	add    $0x18,%rsp
+  8029c4:	5b                   	pop    %rbx
+  8029c5:	41 5c                	pop    %r12
+  8029c7:	41 5d                	pop    %r13
+  8029c9:	5d                   	pop    %rbp
+  8029ca:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8029cb:	48 b9 30 37 80 00 00 	movabs $0x803730,%rcx
+  8029d2:	00 00 00 
+  8029d5:	48 ba 07 37 80 00 00 	movabs $0x803707,%rdx
+  8029dc:	00 00 00 
+  8029df:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8029e4:	48 bf 1c 37 80 00 00 	movabs $0x80371c,%rdi
+  8029eb:	00 00 00 
+  8029ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f3:	49 b8 94 05 80 00 00 	movabs $0x800594,%r8
+  8029fa:	00 00 00 
+  8029fd:	41 ff d0             	call   *%r8
+
+0000000000802a00 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802a00:	55                   	push   %rbp
+  802a01:	48 89 e5             	mov    %rsp,%rbp
+  802a04:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802a08:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802a0c:	48 b8 e9 1b 80 00 00 	movabs $0x801be9,%rax
+  802a13:	00 00 00 
+  802a16:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a18:	85 c0                	test   %eax,%eax
+  802a1a:	78 35                	js     802a51 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802a1c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a20:	48 b8 6d 1b 80 00 00 	movabs $0x801b6d,%rax
+  802a27:	00 00 00 
+  802a2a:	ff d0                	call   *%rax
+  802a2c:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802a2f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802a34:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a39:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a3d:	48 b8 8d 15 80 00 00 	movabs $0x80158d,%rax
+  802a44:	00 00 00 
+  802a47:	ff d0                	call   *%rax
+  802a49:	85 c0                	test   %eax,%eax
+  802a4b:	0f 94 c0             	sete   %al
+  802a4e:	0f b6 c0             	movzbl %al,%eax
+}
+  802a51:	c9                   	leave
+  802a52:	c3                   	ret
+
+0000000000802a53 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a53:	48 89 f8             	mov    %rdi,%rax
+  802a56:	48 c1 e8 27          	shr    $0x27,%rax
+  802a5a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a61:	01 00 00 
+  802a64:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a68:	f6 c2 01             	test   $0x1,%dl
+  802a6b:	74 6d                	je     802ada <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a6d:	48 89 f8             	mov    %rdi,%rax
+  802a70:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a74:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a7b:	01 00 00 
+  802a7e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a82:	f6 c2 01             	test   $0x1,%dl
+  802a85:	74 62                	je     802ae9 <get_uvpt_entry+0x96>
+  802a87:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a8e:	01 00 00 
+  802a91:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a95:	f6 c2 80             	test   $0x80,%dl
+  802a98:	75 4f                	jne    802ae9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a9a:	48 89 f8             	mov    %rdi,%rax
+  802a9d:	48 c1 e8 15          	shr    $0x15,%rax
+  802aa1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802aa8:	01 00 00 
+  802aab:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802aaf:	f6 c2 01             	test   $0x1,%dl
+  802ab2:	74 44                	je     802af8 <get_uvpt_entry+0xa5>
+  802ab4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802abb:	01 00 00 
+  802abe:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ac2:	f6 c2 80             	test   $0x80,%dl
+  802ac5:	75 31                	jne    802af8 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802ac7:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802acb:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ad2:	01 00 00 
+  802ad5:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802ad9:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802ada:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802ae1:	01 00 00 
+  802ae4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ae8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802ae9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802af0:	01 00 00 
+  802af3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802af7:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802af8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802aff:	01 00 00 
+  802b02:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b06:	c3                   	ret
+
+0000000000802b07 <get_prot>:
+
+int
+get_prot(void *va) {
+  802b07:	55                   	push   %rbp
+  802b08:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b0b:	48 b8 53 2a 80 00 00 	movabs $0x802a53,%rax
+  802b12:	00 00 00 
+  802b15:	ff d0                	call   *%rax
+  802b17:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802b1a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802b1f:	89 c1                	mov    %eax,%ecx
+  802b21:	83 c9 04             	or     $0x4,%ecx
+  802b24:	f6 c2 01             	test   $0x1,%dl
+  802b27:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802b2a:	89 c1                	mov    %eax,%ecx
+  802b2c:	83 c9 02             	or     $0x2,%ecx
+  802b2f:	f6 c2 02             	test   $0x2,%dl
+  802b32:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802b35:	89 c1                	mov    %eax,%ecx
+  802b37:	83 c9 01             	or     $0x1,%ecx
+  802b3a:	48 85 d2             	test   %rdx,%rdx
+  802b3d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802b40:	89 c1                	mov    %eax,%ecx
+  802b42:	83 c9 40             	or     $0x40,%ecx
+  802b45:	f6 c6 04             	test   $0x4,%dh
+  802b48:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802b4b:	5d                   	pop    %rbp
+  802b4c:	c3                   	ret
+
+0000000000802b4d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802b4d:	55                   	push   %rbp
+  802b4e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b51:	48 b8 53 2a 80 00 00 	movabs $0x802a53,%rax
+  802b58:	00 00 00 
+  802b5b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802b5d:	48 c1 e8 06          	shr    $0x6,%rax
+  802b61:	83 e0 01             	and    $0x1,%eax
+}
+  802b64:	5d                   	pop    %rbp
+  802b65:	c3                   	ret
+
+0000000000802b66 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802b66:	55                   	push   %rbp
+  802b67:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802b6a:	48 b8 53 2a 80 00 00 	movabs $0x802a53,%rax
+  802b71:	00 00 00 
+  802b74:	ff d0                	call   *%rax
+  802b76:	83 e0 01             	and    $0x1,%eax
+}
+  802b79:	5d                   	pop    %rbp
+  802b7a:	c3                   	ret
+
+0000000000802b7b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802b7b:	55                   	push   %rbp
+  802b7c:	48 89 e5             	mov    %rsp,%rbp
+  802b7f:	41 57                	push   %r15
+  802b81:	41 56                	push   %r14
+  802b83:	41 55                	push   %r13
+  802b85:	41 54                	push   %r12
+  802b87:	53                   	push   %rbx
+  802b88:	48 83 ec 18          	sub    $0x18,%rsp
+  802b8c:	49 89 ff             	mov    %rdi,%r15
+  802b8f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802b93:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802b98:	49 bc 66 2b 80 00 00 	movabs $0x802b66,%r12
+  802b9f:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802ba2:	49 be 07 2b 80 00 00 	movabs $0x802b07,%r14
+  802ba9:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802bac:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802bb3:	00 00 00 
+  802bb6:	eb 0c                	jmp    802bc4 <foreach_shared_region+0x49>
+  802bb8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802bbf:	4c 39 eb             	cmp    %r13,%rbx
+  802bc2:	74 38                	je     802bfc <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802bc4:	48 89 df             	mov    %rbx,%rdi
+  802bc7:	41 ff d4             	call   *%r12
+  802bca:	84 c0                	test   %al,%al
+  802bcc:	74 ea                	je     802bb8 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802bce:	48 89 df             	mov    %rbx,%rdi
+  802bd1:	41 ff d6             	call   *%r14
+  802bd4:	a8 40                	test   $0x40,%al
+  802bd6:	74 e0                	je     802bb8 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802bd8:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802bdf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802be3:	48 89 df             	mov    %rbx,%rdi
+  802be6:	41 ff d7             	call   *%r15
+        if (err)
+  802be9:	85 c0                	test   %eax,%eax
+  802beb:	74 cb                	je     802bb8 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802bed:	48 83 c4 18          	add    $0x18,%rsp
+  802bf1:	5b                   	pop    %rbx
+  802bf2:	41 5c                	pop    %r12
+  802bf4:	41 5d                	pop    %r13
+  802bf6:	41 5e                	pop    %r14
+  802bf8:	41 5f                	pop    %r15
+  802bfa:	5d                   	pop    %rbp
+  802bfb:	c3                   	ret
+    return 0;
+  802bfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c01:	eb ea                	jmp    802bed <foreach_shared_region+0x72>
+
+0000000000802c03 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802c03:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c08:	c3                   	ret
+
+0000000000802c09 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802c09:	55                   	push   %rbp
+  802c0a:	48 89 e5             	mov    %rsp,%rbp
+  802c0d:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802c10:	48 be 54 37 80 00 00 	movabs $0x803754,%rsi
+  802c17:	00 00 00 
+  802c1a:	48 b8 09 10 80 00 00 	movabs $0x801009,%rax
+  802c21:	00 00 00 
+  802c24:	ff d0                	call   *%rax
+    return 0;
+}
+  802c26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2b:	5d                   	pop    %rbp
+  802c2c:	c3                   	ret
+
+0000000000802c2d <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c2d:	55                   	push   %rbp
+  802c2e:	48 89 e5             	mov    %rsp,%rbp
+  802c31:	41 57                	push   %r15
+  802c33:	41 56                	push   %r14
+  802c35:	41 55                	push   %r13
+  802c37:	41 54                	push   %r12
+  802c39:	53                   	push   %rbx
+  802c3a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802c41:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802c48:	48 85 d2             	test   %rdx,%rdx
+  802c4b:	74 7a                	je     802cc7 <devcons_write+0x9a>
+  802c4d:	49 89 d6             	mov    %rdx,%r14
+  802c50:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802c56:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802c5b:	49 bf 03 12 80 00 00 	movabs $0x801203,%r15
+  802c62:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802c65:	4c 89 f3             	mov    %r14,%rbx
+  802c68:	48 29 f3             	sub    %rsi,%rbx
+  802c6b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802c70:	48 39 c3             	cmp    %rax,%rbx
+  802c73:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802c77:	4c 63 eb             	movslq %ebx,%r13
+  802c7a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802c81:	48 01 c6             	add    %rax,%rsi
+  802c84:	4c 89 ea             	mov    %r13,%rdx
+  802c87:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802c8e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802c91:	4c 89 ee             	mov    %r13,%rsi
+  802c94:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802c9b:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  802ca2:	00 00 00 
+  802ca5:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802ca7:	41 01 dc             	add    %ebx,%r12d
+  802caa:	49 63 f4             	movslq %r12d,%rsi
+  802cad:	4c 39 f6             	cmp    %r14,%rsi
+  802cb0:	72 b3                	jb     802c65 <devcons_write+0x38>
+    return res;
+  802cb2:	49 63 c4             	movslq %r12d,%rax
+}
+  802cb5:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802cbc:	5b                   	pop    %rbx
+  802cbd:	41 5c                	pop    %r12
+  802cbf:	41 5d                	pop    %r13
+  802cc1:	41 5e                	pop    %r14
+  802cc3:	41 5f                	pop    %r15
+  802cc5:	5d                   	pop    %rbp
+  802cc6:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802cc7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802ccd:	eb e3                	jmp    802cb2 <devcons_write+0x85>
+
+0000000000802ccf <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ccf:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802cd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cd7:	48 85 c0             	test   %rax,%rax
+  802cda:	74 55                	je     802d31 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802cdc:	55                   	push   %rbp
+  802cdd:	48 89 e5             	mov    %rsp,%rbp
+  802ce0:	41 55                	push   %r13
+  802ce2:	41 54                	push   %r12
+  802ce4:	53                   	push   %rbx
+  802ce5:	48 83 ec 08          	sub    $0x8,%rsp
+  802ce9:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802cec:	48 bb 5d 14 80 00 00 	movabs $0x80145d,%rbx
+  802cf3:	00 00 00 
+  802cf6:	49 bc 2a 15 80 00 00 	movabs $0x80152a,%r12
+  802cfd:	00 00 00 
+  802d00:	eb 03                	jmp    802d05 <devcons_read+0x36>
+  802d02:	41 ff d4             	call   *%r12
+  802d05:	ff d3                	call   *%rbx
+  802d07:	85 c0                	test   %eax,%eax
+  802d09:	74 f7                	je     802d02 <devcons_read+0x33>
+    if (c < 0) return c;
+  802d0b:	48 63 d0             	movslq %eax,%rdx
+  802d0e:	78 13                	js     802d23 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802d10:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d15:	83 f8 04             	cmp    $0x4,%eax
+  802d18:	74 09                	je     802d23 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802d1a:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802d1e:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802d23:	48 89 d0             	mov    %rdx,%rax
+  802d26:	48 83 c4 08          	add    $0x8,%rsp
+  802d2a:	5b                   	pop    %rbx
+  802d2b:	41 5c                	pop    %r12
+  802d2d:	41 5d                	pop    %r13
+  802d2f:	5d                   	pop    %rbp
+  802d30:	c3                   	ret
+  802d31:	48 89 d0             	mov    %rdx,%rax
+  802d34:	c3                   	ret
+
+0000000000802d35 <cputchar>:
+cputchar(int ch) {
+  802d35:	55                   	push   %rbp
+  802d36:	48 89 e5             	mov    %rsp,%rbp
+  802d39:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802d3d:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802d41:	be 01 00 00 00       	mov    $0x1,%esi
+  802d46:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802d4a:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  802d51:	00 00 00 
+  802d54:	ff d0                	call   *%rax
+}
+  802d56:	c9                   	leave
+  802d57:	c3                   	ret
+
+0000000000802d58 <getchar>:
+getchar(void) {
+  802d58:	55                   	push   %rbp
+  802d59:	48 89 e5             	mov    %rsp,%rbp
+  802d5c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802d60:	ba 01 00 00 00       	mov    $0x1,%edx
+  802d65:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802d69:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d6e:	48 b8 cc 1e 80 00 00 	movabs $0x801ecc,%rax
+  802d75:	00 00 00 
+  802d78:	ff d0                	call   *%rax
+  802d7a:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802d7c:	85 c0                	test   %eax,%eax
+  802d7e:	78 06                	js     802d86 <getchar+0x2e>
+  802d80:	74 08                	je     802d8a <getchar+0x32>
+  802d82:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802d86:	89 d0                	mov    %edx,%eax
+  802d88:	c9                   	leave
+  802d89:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802d8a:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802d8f:	eb f5                	jmp    802d86 <getchar+0x2e>
+
+0000000000802d91 <iscons>:
+iscons(int fdnum) {
+  802d91:	55                   	push   %rbp
+  802d92:	48 89 e5             	mov    %rsp,%rbp
+  802d95:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802d99:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d9d:	48 b8 e9 1b 80 00 00 	movabs $0x801be9,%rax
+  802da4:	00 00 00 
+  802da7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802da9:	85 c0                	test   %eax,%eax
+  802dab:	78 18                	js     802dc5 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802dad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802db1:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802db8:	00 00 00 
+  802dbb:	8b 00                	mov    (%rax),%eax
+  802dbd:	39 02                	cmp    %eax,(%rdx)
+  802dbf:	0f 94 c0             	sete   %al
+  802dc2:	0f b6 c0             	movzbl %al,%eax
+}
+  802dc5:	c9                   	leave
+  802dc6:	c3                   	ret
+
+0000000000802dc7 <opencons>:
+opencons(void) {
+  802dc7:	55                   	push   %rbp
+  802dc8:	48 89 e5             	mov    %rsp,%rbp
+  802dcb:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802dcf:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802dd3:	48 b8 89 1b 80 00 00 	movabs $0x801b89,%rax
+  802dda:	00 00 00 
+  802ddd:	ff d0                	call   *%rax
+  802ddf:	85 c0                	test   %eax,%eax
+  802de1:	78 49                	js     802e2c <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802de3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802de8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ded:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802df1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802df6:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  802dfd:	00 00 00 
+  802e00:	ff d0                	call   *%rax
+  802e02:	85 c0                	test   %eax,%eax
+  802e04:	78 26                	js     802e2c <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802e06:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e0a:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802e11:	00 00 
+  802e13:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802e15:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802e19:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802e20:	48 b8 5b 1b 80 00 00 	movabs $0x801b5b,%rax
+  802e27:	00 00 00 
+  802e2a:	ff d0                	call   *%rax
+}
+  802e2c:	c9                   	leave
+  802e2d:	c3                   	ret
+
+0000000000802e2e <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802e2e:	55                   	push   %rbp
+  802e2f:	48 89 e5             	mov    %rsp,%rbp
+  802e32:	41 54                	push   %r12
+  802e34:	53                   	push   %rbx
+  802e35:	48 89 fb             	mov    %rdi,%rbx
+  802e38:	48 89 f7             	mov    %rsi,%rdi
+  802e3b:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802e3e:	48 85 f6             	test   %rsi,%rsi
+  802e41:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802e48:	00 00 00 
+  802e4b:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802e4f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e54:	48 b8 23 19 80 00 00 	movabs $0x801923,%rax
+  802e5b:	00 00 00 
+  802e5e:	ff d0                	call   *%rax
+    if (res < 0) {
+  802e60:	85 c0                	test   %eax,%eax
+  802e62:	78 45                	js     802ea9 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802e64:	48 85 db             	test   %rbx,%rbx
+  802e67:	74 12                	je     802e7b <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802e69:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e70:	00 00 00 
+  802e73:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802e79:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802e7b:	4d 85 e4             	test   %r12,%r12
+  802e7e:	74 14                	je     802e94 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802e80:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e87:	00 00 00 
+  802e8a:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802e90:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802e94:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e9b:	00 00 00 
+  802e9e:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802ea4:	5b                   	pop    %rbx
+  802ea5:	41 5c                	pop    %r12
+  802ea7:	5d                   	pop    %rbp
+  802ea8:	c3                   	ret
+        if (from_env_store)
+  802ea9:	48 85 db             	test   %rbx,%rbx
+  802eac:	74 06                	je     802eb4 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802eae:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802eb4:	4d 85 e4             	test   %r12,%r12
+  802eb7:	74 eb                	je     802ea4 <ipc_recv+0x76>
+            *perm_store = 0;
+  802eb9:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802ec0:	00 
+  802ec1:	eb e1                	jmp    802ea4 <ipc_recv+0x76>
+
+0000000000802ec3 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802ec3:	55                   	push   %rbp
+  802ec4:	48 89 e5             	mov    %rsp,%rbp
+  802ec7:	41 57                	push   %r15
+  802ec9:	41 56                	push   %r14
+  802ecb:	41 55                	push   %r13
+  802ecd:	41 54                	push   %r12
+  802ecf:	53                   	push   %rbx
+  802ed0:	48 83 ec 18          	sub    $0x18,%rsp
+  802ed4:	41 89 fd             	mov    %edi,%r13d
+  802ed7:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802eda:	48 89 d3             	mov    %rdx,%rbx
+  802edd:	49 89 cc             	mov    %rcx,%r12
+  802ee0:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802ee4:	48 85 d2             	test   %rdx,%rdx
+  802ee7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802eee:	00 00 00 
+  802ef1:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802ef5:	49 be f7 18 80 00 00 	movabs $0x8018f7,%r14
+  802efc:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802eff:	49 bf 2a 15 80 00 00 	movabs $0x80152a,%r15
+  802f06:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802f09:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802f0c:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802f10:	4c 89 e1             	mov    %r12,%rcx
+  802f13:	48 89 da             	mov    %rbx,%rdx
+  802f16:	44 89 ef             	mov    %r13d,%edi
+  802f19:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802f1c:	85 c0                	test   %eax,%eax
+  802f1e:	74 34                	je     802f54 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802f20:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802f23:	75 05                	jne    802f2a <ipc_send+0x67>
+        sys_yield();
+  802f25:	41 ff d7             	call   *%r15
+    while (true) {
+  802f28:	eb df                	jmp    802f09 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802f2a:	48 ba 60 37 80 00 00 	movabs $0x803760,%rdx
+  802f31:	00 00 00 
+  802f34:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802f39:	48 bf 79 37 80 00 00 	movabs $0x803779,%rdi
+  802f40:	00 00 00 
+  802f43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f48:	48 b9 94 05 80 00 00 	movabs $0x800594,%rcx
+  802f4f:	00 00 00 
+  802f52:	ff d1                	call   *%rcx
+    }
+}
+  802f54:	48 83 c4 18          	add    $0x18,%rsp
+  802f58:	5b                   	pop    %rbx
+  802f59:	41 5c                	pop    %r12
+  802f5b:	41 5d                	pop    %r13
+  802f5d:	41 5e                	pop    %r14
+  802f5f:	41 5f                	pop    %r15
+  802f61:	5d                   	pop    %rbp
+  802f62:	c3                   	ret
+
+0000000000802f63 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802f63:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802f68:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802f6f:	00 00 00 
+  802f72:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802f79:	48 01 ca             	add    %rcx,%rdx
+  802f7c:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802f82:	39 fa                	cmp    %edi,%edx
+  802f84:	74 12                	je     802f98 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802f86:	48 83 c0 01          	add    $0x1,%rax
+  802f8a:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802f90:	75 e0                	jne    802f72 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802f92:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f97:	c3                   	ret
+            return envs[i].env_id;
+  802f98:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802f9f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802fa6:	00 00 00 
+  802fa9:	48 01 d0             	add    %rdx,%rax
+  802fac:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802fb2:	c3                   	ret
+  802fb3:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000802fb8 <__rodata_start>:
+  802fb8:	73 79                	jae    803033 <__rodata_start+0x7b>
+  802fba:	73 5f                	jae    80301b <__rodata_start+0x63>
+  802fbc:	61                   	(bad)
+  802fbd:	6c                   	insb   (%dx),%es:(%rdi)
+  802fbe:	6c                   	insb   (%dx),%es:(%rdi)
+  802fbf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fc0:	63 5f 72             	movsxd 0x72(%rdi),%ebx
+  802fc3:	65 67 69 6f 6e 3a 20 	imul   $0x6925203a,%gs:0x6e(%edi),%ebp
+  802fca:	25 69 
+  802fcc:	00 75 73             	add    %dh,0x73(%rbp)
+  802fcf:	65 72 2f             	gs jb  803001 <__rodata_start+0x49>
+  802fd2:	72 65                	jb     803039 <__rodata_start+0x81>
+  802fd4:	67 69 6f 6e 61 64 76 	imul   $0x69766461,0x6e(%edi),%ebp
+  802fdb:	69 
+  802fdc:	73 65                	jae    803043 <__rodata_start+0x8b>
+  802fde:	2e 63 00             	cs movsxd (%rax),%eax
+  802fe1:	57                   	push   %rdi
+  802fe2:	49                   	rex.WB
+  802fe3:	4c                   	rex.WR
+  802fe4:	4c                   	rex.WR
+  802fe5:	4e                   	rex.WRX
+  802fe6:	45                   	rex.RB
+  802fe7:	45                   	rex.RB
+  802fe8:	44 3a 20             	cmp    (%rax),%r12b
+  802feb:	25 69 00 44 4f       	and    $0x4f440069,%eax
+  802ff0:	4e 54                	rex.WRX push %rsp
+  802ff2:	4e                   	rex.WRX
+  802ff3:	45                   	rex.RB
+  802ff4:	45                   	rex.RB
+  802ff5:	44 3a 20             	cmp    (%rax),%r12b
+  802ff8:	25 69 00 4e 4f       	and    $0x4f4e0069,%eax
+  802ffd:	48 55                	rex.W push %rbp
+  802fff:	47                   	rex.RXB
+  803000:	45 50                	rex.RB push %r8
+  803002:	41                   	rex.B
+  803003:	47                   	rex.RXB
+  803004:	45 3a 20             	cmp    (%r8),%r12b
+  803007:	25 69 00 4e 4f       	and    $0x4f4e0069,%eax
+  80300c:	52                   	push   %rdx
+  80300d:	4d                   	rex.WRB
+  80300e:	41                   	rex.B
+  80300f:	4c 3a 20             	rex.WR cmp (%rax),%r12b
+  803012:	25 69 00 65 6d       	and    $0x6d650069,%eax
+  803017:	70 74                	jo     80308d <__rodata_start+0xd5>
+  803019:	79 20                	jns    80303b <__rodata_start+0x83>
+  80301b:	53                   	push   %rbx
+  80301c:	45 51                	rex.RB push %r9
+  80301e:	55                   	push   %rbp
+  80301f:	45                   	rex.RB
+  803020:	4e 54                	rex.WRX push %rsp
+  803022:	49                   	rex.WB
+  803023:	41                   	rex.B
+  803024:	4c 3a 20             	rex.WR cmp (%rax),%r12b
+  803027:	25 69 00 68 69       	and    $0x69680069,%eax
+  80302c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80302d:	74 20                	je     80304f <__rodata_start+0x97>
+  80302f:	74 61                	je     803092 <__rodata_start+0xda>
+  803031:	62                   	(bad)
+  803032:	6c                   	insb   (%dx),%es:(%rdi)
+  803033:	65 20 69 73          	and    %ch,%gs:0x73(%rcx)
+  803037:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80303a:	74 20                	je     80305c <__rodata_start+0xa4>
+  80303c:	6c                   	insb   (%dx),%es:(%rdi)
+  80303d:	69 6d 69 74 65 64 3a 	imul   $0x3a646574,0x69(%rbp),%ebp
+  803044:	20 25 69 00 6d 69    	and    %ah,0x696d0069(%rip)        # 69ed30b3 <__bss_end+0x696cb0b3>
+  80304a:	73 61                	jae    8030ad <__rodata_start+0xf5>
+  80304c:	6c                   	insb   (%dx),%es:(%rdi)
+  80304d:	69 67 6e 65 64 20 72 	imul   $0x72206465,0x6e(%rdi),%esp
+  803054:	65 67 69 6f 6e 20 61 	imul   $0x63636120,%gs:0x6e(%edi),%ebp
+  80305b:	63 63 
+  80305d:	65 70 74             	gs jo  8030d4 <__rodata_start+0x11c>
+  803060:	65 64 00 75 6e       	gs add %dh,%fs:0x6e(%rbp)
+  803065:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803069:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80306a:	20 61 64             	and    %ah,0x64(%rcx)
+  80306d:	76 69                	jbe    8030d8 <__rodata_start+0x120>
+  80306f:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803072:	61                   	(bad)
+  803073:	63 63 65             	movsxd 0x65(%rbx),%esp
+  803076:	70 74                	jo     8030ec <__rodata_start+0x134>
+  803078:	65 64 00 72 65       	gs add %dh,%fs:0x65(%rdx)
+  80307d:	67 69 6f 6e 61 64 76 	imul   $0x69766461,0x6e(%edi),%ebp
+  803084:	69 
+  803085:	73 65                	jae    8030ec <__rodata_start+0x134>
+  803087:	3a 20                	cmp    (%rax),%ah
+  803089:	4f                   	rex.WRXB
+  80308a:	4b 0a 00             	rex.WXB or (%r8),%al
+  80308d:	0f 1f 00             	nopl   (%rax)
+  803090:	72 65                	jb     8030f7 <__rodata_start+0x13f>
+  803092:	67 69 6f 6e 5b 25 7a 	imul   $0x757a255b,0x6e(%edi),%ebp
+  803099:	75 
+  80309a:	5d                   	pop    %rbp
+  80309b:	20 3d 20 25 30 32    	and    %bh,0x32302520(%rip)        # 32b055c1 <__bss_end+0x322fd5c1>
+  8030a1:	78 20                	js     8030c3 <__rodata_start+0x10b>
+  8030a3:	61                   	(bad)
+  8030a4:	66 74 65             	data16 je 80310c <__rodata_start+0x154>
+  8030a7:	72 20                	jb     8030c9 <__rodata_start+0x111>
+  8030a9:	44                   	rex.R
+  8030aa:	4f                   	rex.WRXB
+  8030ab:	4e 54                	rex.WRX push %rsp
+  8030ad:	4e                   	rex.WRX
+  8030ae:	45                   	rex.RB
+  8030af:	45                   	rex.RB
+  8030b0:	44 00 3c 75 6e 6b 6e 	add    %r15b,0x6f6e6b6e(,%rsi,2)
+  8030b7:	6f 
+  8030b8:	77 6e                	ja     803128 <__rodata_start+0x170>
+  8030ba:	3e 00 0f             	ds add %cl,(%rdi)
+  8030bd:	1f                   	(bad)
+  8030be:	40 00 5b 25          	rex add %bl,0x25(%rbx)
+  8030c2:	30 38                	xor    %bh,(%rax)
+  8030c4:	78 5d                	js     803123 <__rodata_start+0x16b>
+  8030c6:	20 75 73             	and    %dh,0x73(%rbp)
+  8030c9:	65 72 20             	gs jb  8030ec <__rodata_start+0x134>
+  8030cc:	70 61                	jo     80312f <__rodata_start+0x177>
+  8030ce:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030cf:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  8030d6:	73 20                	jae    8030f8 <__rodata_start+0x140>
+  8030d8:	61                   	(bad)
+  8030d9:	74 20                	je     8030fb <__rodata_start+0x143>
+  8030db:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  8030e0:	3a 20                	cmp    (%rax),%ah
+  8030e2:	00 30                	add    %dh,(%rax)
+  8030e4:	31 32                	xor    %esi,(%rdx)
+  8030e6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8030ed:	41                   	rex.B
+  8030ee:	42                   	rex.X
+  8030ef:	43                   	rex.XB
+  8030f0:	44                   	rex.R
+  8030f1:	45                   	rex.RB
+  8030f2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8030f5:	31 32                	xor    %esi,(%rdx)
+  8030f7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8030fe:	61                   	(bad)
+  8030ff:	62 63 64 65 66       	(bad)
+  803104:	00 28                	add    %ch,(%rax)
+  803106:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803107:	75 6c                	jne    803175 <__rodata_start+0x1bd>
+  803109:	6c                   	insb   (%dx),%es:(%rdi)
+  80310a:	29 00                	sub    %eax,(%rax)
+  80310c:	65 72 72             	gs jb  803181 <__rodata_start+0x1c9>
+  80310f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803110:	72 20                	jb     803132 <__rodata_start+0x17a>
+  803112:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803117:	73 70                	jae    803189 <__rodata_start+0x1d1>
+  803119:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80311d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803124:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803125:	72 00                	jb     803127 <__rodata_start+0x16f>
+  803127:	62 61 64 20 65       	(bad)
+  80312c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80312d:	76 69                	jbe    803198 <__rodata_start+0x1e0>
+  80312f:	72 6f                	jb     8031a0 <__rodata_start+0x1e8>
+  803131:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803132:	6d                   	insl   (%dx),%es:(%rdi)
+  803133:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803135:	74 00                	je     803137 <__rodata_start+0x17f>
+  803137:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80313e:	20 70 61             	and    %dh,0x61(%rax)
+  803141:	72 61                	jb     8031a4 <__rodata_start+0x1ec>
+  803143:	6d                   	insl   (%dx),%es:(%rdi)
+  803144:	65 74 65             	gs je  8031ac <__rodata_start+0x1f4>
+  803147:	72 00                	jb     803149 <__rodata_start+0x191>
+  803149:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80314a:	75 74                	jne    8031c0 <__rodata_start+0x208>
+  80314c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80314f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803152:	6d                   	insl   (%dx),%es:(%rdi)
+  803153:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803154:	72 79                	jb     8031cf <__rodata_start+0x217>
+  803156:	00 6f 75             	add    %ch,0x75(%rdi)
+  803159:	74 20                	je     80317b <__rodata_start+0x1c3>
+  80315b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80315c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803160:	76 69                	jbe    8031cb <__rodata_start+0x213>
+  803162:	72 6f                	jb     8031d3 <__rodata_start+0x21b>
+  803164:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803165:	6d                   	insl   (%dx),%es:(%rdi)
+  803166:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803168:	74 73                	je     8031dd <__rodata_start+0x225>
+  80316a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80316d:	72 72                	jb     8031e1 <__rodata_start+0x229>
+  80316f:	75 70                	jne    8031e1 <__rodata_start+0x229>
+  803171:	74 65                	je     8031d8 <__rodata_start+0x220>
+  803173:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803178:	75 67                	jne    8031e1 <__rodata_start+0x229>
+  80317a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80317d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80317f:	00 73 65             	add    %dh,0x65(%rbx)
+  803182:	67 6d                	insl   (%dx),%es:(%edi)
+  803184:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803186:	74 61                	je     8031e9 <__rodata_start+0x231>
+  803188:	74 69                	je     8031f3 <__rodata_start+0x23b>
+  80318a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80318b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80318c:	20 66 61             	and    %ah,0x61(%rsi)
+  80318f:	75 6c                	jne    8031fd <__rodata_start+0x245>
+  803191:	74 00                	je     803193 <__rodata_start+0x1db>
+  803193:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80319a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80319d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8031a1:	61                   	(bad)
+  8031a2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8031a7:	20 73 75             	and    %dh,0x75(%rbx)
+  8031aa:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8031ad:	73 79                	jae    803228 <__rodata_start+0x270>
+  8031af:	73 74                	jae    803225 <__rodata_start+0x26d>
+  8031b1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8031b3:	20 63 61             	and    %ah,0x61(%rbx)
+  8031b6:	6c                   	insb   (%dx),%es:(%rdi)
+  8031b7:	6c                   	insb   (%dx),%es:(%rdi)
+  8031b8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8031bb:	74 72                	je     80322f <__rodata_start+0x277>
+  8031bd:	79 20                	jns    8031df <__rodata_start+0x227>
+  8031bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031c0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031c1:	74 20                	je     8031e3 <__rodata_start+0x22b>
+  8031c3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8031c5:	75 6e                	jne    803235 <__rodata_start+0x27d>
+  8031c7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8031cb:	76 20                	jbe    8031ed <__rodata_start+0x235>
+  8031cd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8031d4:	72 65                	jb     80323b <__rodata_start+0x283>
+  8031d6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8031d9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031da:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8031de:	65 78 70             	gs js  803251 <__rodata_start+0x299>
+  8031e1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8031e6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8031e9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8031ed:	20 66 69             	and    %ah,0x69(%rsi)
+  8031f0:	6c                   	insb   (%dx),%es:(%rdi)
+  8031f1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8031f5:	20 66 72             	and    %ah,0x72(%rsi)
+  8031f8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8031fd:	61                   	(bad)
+  8031fe:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803201:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803202:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803203:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803207:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80320a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80320b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80320c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80320f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803210:	79 20                	jns    803232 <__rodata_start+0x27a>
+  803212:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803219:	72 65                	jb     803280 <__rodata_start+0x2c8>
+  80321b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80321e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803220:	00 66 69             	add    %ah,0x69(%rsi)
+  803223:	6c                   	insb   (%dx),%es:(%rdi)
+  803224:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803228:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80322b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80322c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80322f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803230:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803231:	74 20                	je     803253 <__rodata_start+0x29b>
+  803233:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803235:	75 6e                	jne    8032a5 <__rodata_start+0x2ed>
+  803237:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80323b:	76 61                	jbe    80329e <__rodata_start+0x2e6>
+  80323d:	6c                   	insb   (%dx),%es:(%rdi)
+  80323e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803245:	00 
+  803246:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80324d:	72 65                	jb     8032b4 <__rodata_start+0x2fc>
+  80324f:	61                   	(bad)
+  803250:	64 79 20             	fs jns 803273 <__rodata_start+0x2bb>
+  803253:	65 78 69             	gs js  8032bf <__rodata_start+0x307>
+  803256:	73 74                	jae    8032cc <__rodata_start+0x314>
+  803258:	73 00                	jae    80325a <__rodata_start+0x2a2>
+  80325a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80325b:	70 65                	jo     8032c2 <__rodata_start+0x30a>
+  80325d:	72 61                	jb     8032c0 <__rodata_start+0x308>
+  80325f:	74 69                	je     8032ca <__rodata_start+0x312>
+  803261:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803262:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803263:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803266:	74 20                	je     803288 <__rodata_start+0x2d0>
+  803268:	73 75                	jae    8032df <__rodata_start+0x327>
+  80326a:	70 70                	jo     8032dc <__rodata_start+0x324>
+  80326c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80326d:	72 74                	jb     8032e3 <__rodata_start+0x32b>
+  80326f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803274:	65 72 61             	gs jb  8032d8 <__rodata_start+0x320>
+  803277:	74 69                	je     8032e2 <__rodata_start+0x32a>
+  803279:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80327a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80327b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80327e:	74 20                	je     8032a0 <__rodata_start+0x2e8>
+  803280:	70 65                	jo     8032e7 <__rodata_start+0x32f>
+  803282:	72 6d                	jb     8032f1 <__rodata_start+0x339>
+  803284:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  80328b:	2e 
+  80328c:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803293:	00 
+  803294:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80329b:	00 00 00 
+  80329e:	66 90                	xchg   %ax,%ax
+  8032a0:	d1 08                	rorl   (%rax)
+  8032a2:	80 00 00             	addb   $0x0,(%rax)
+  8032a5:	00 00                	add    %al,(%rax)
+  8032a7:	00 12                	add    %dl,(%rdx)
+  8032a9:	0f 80 00 00 00 00    	jo     8032af <__rodata_start+0x2f7>
+  8032af:	00 02                	add    %al,(%rdx)
+  8032b1:	0f 80 00 00 00 00    	jo     8032b7 <__rodata_start+0x2ff>
+  8032b7:	00 12                	add    %dl,(%rdx)
+  8032b9:	0f 80 00 00 00 00    	jo     8032bf <__rodata_start+0x307>
+  8032bf:	00 12                	add    %dl,(%rdx)
+  8032c1:	0f 80 00 00 00 00    	jo     8032c7 <__rodata_start+0x30f>
+  8032c7:	00 12                	add    %dl,(%rdx)
+  8032c9:	0f 80 00 00 00 00    	jo     8032cf <__rodata_start+0x317>
+  8032cf:	00 12                	add    %dl,(%rdx)
+  8032d1:	0f 80 00 00 00 00    	jo     8032d7 <__rodata_start+0x31f>
+  8032d7:	00 f0                	add    %dh,%al
+  8032d9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8032df:	00 12                	add    %dl,(%rdx)
+  8032e1:	0f 80 00 00 00 00    	jo     8032e7 <__rodata_start+0x32f>
+  8032e7:	00 12                	add    %dl,(%rdx)
+  8032e9:	0f 80 00 00 00 00    	jo     8032ef <__rodata_start+0x337>
+  8032ef:	00 e4                	add    %ah,%ah
+  8032f1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8032f7:	00 5e 09             	add    %bl,0x9(%rsi)
+  8032fa:	80 00 00             	addb   $0x0,(%rax)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 12                	add    %dl,(%rdx)
+  803301:	0f 80 00 00 00 00    	jo     803307 <__rodata_start+0x34f>
+  803307:	00 e4                	add    %ah,%ah
+  803309:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80330f:	00 2a                	add    %ch,(%rdx)
+  803311:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803317:	00 2a                	add    %ch,(%rdx)
+  803319:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80331f:	00 2a                	add    %ch,(%rdx)
+  803321:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803327:	00 2a                	add    %ch,(%rdx)
+  803329:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80332f:	00 2a                	add    %ch,(%rdx)
+  803331:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803337:	00 2a                	add    %ch,(%rdx)
+  803339:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80333f:	00 2a                	add    %ch,(%rdx)
+  803341:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803347:	00 2a                	add    %ch,(%rdx)
+  803349:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80334f:	00 2a                	add    %ch,(%rdx)
+  803351:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803357:	00 12                	add    %dl,(%rdx)
+  803359:	0f 80 00 00 00 00    	jo     80335f <__rodata_start+0x3a7>
+  80335f:	00 12                	add    %dl,(%rdx)
+  803361:	0f 80 00 00 00 00    	jo     803367 <__rodata_start+0x3af>
+  803367:	00 12                	add    %dl,(%rdx)
+  803369:	0f 80 00 00 00 00    	jo     80336f <__rodata_start+0x3b7>
+  80336f:	00 12                	add    %dl,(%rdx)
+  803371:	0f 80 00 00 00 00    	jo     803377 <__rodata_start+0x3bf>
+  803377:	00 12                	add    %dl,(%rdx)
+  803379:	0f 80 00 00 00 00    	jo     80337f <__rodata_start+0x3c7>
+  80337f:	00 12                	add    %dl,(%rdx)
+  803381:	0f 80 00 00 00 00    	jo     803387 <__rodata_start+0x3cf>
+  803387:	00 12                	add    %dl,(%rdx)
+  803389:	0f 80 00 00 00 00    	jo     80338f <__rodata_start+0x3d7>
+  80338f:	00 12                	add    %dl,(%rdx)
+  803391:	0f 80 00 00 00 00    	jo     803397 <__rodata_start+0x3df>
+  803397:	00 12                	add    %dl,(%rdx)
+  803399:	0f 80 00 00 00 00    	jo     80339f <__rodata_start+0x3e7>
+  80339f:	00 12                	add    %dl,(%rdx)
+  8033a1:	0f 80 00 00 00 00    	jo     8033a7 <__rodata_start+0x3ef>
+  8033a7:	00 12                	add    %dl,(%rdx)
+  8033a9:	0f 80 00 00 00 00    	jo     8033af <__rodata_start+0x3f7>
+  8033af:	00 12                	add    %dl,(%rdx)
+  8033b1:	0f 80 00 00 00 00    	jo     8033b7 <__rodata_start+0x3ff>
+  8033b7:	00 12                	add    %dl,(%rdx)
+  8033b9:	0f 80 00 00 00 00    	jo     8033bf <__rodata_start+0x407>
+  8033bf:	00 12                	add    %dl,(%rdx)
+  8033c1:	0f 80 00 00 00 00    	jo     8033c7 <__rodata_start+0x40f>
+  8033c7:	00 12                	add    %dl,(%rdx)
+  8033c9:	0f 80 00 00 00 00    	jo     8033cf <__rodata_start+0x417>
+  8033cf:	00 12                	add    %dl,(%rdx)
+  8033d1:	0f 80 00 00 00 00    	jo     8033d7 <__rodata_start+0x41f>
+  8033d7:	00 12                	add    %dl,(%rdx)
+  8033d9:	0f 80 00 00 00 00    	jo     8033df <__rodata_start+0x427>
+  8033df:	00 12                	add    %dl,(%rdx)
+  8033e1:	0f 80 00 00 00 00    	jo     8033e7 <__rodata_start+0x42f>
+  8033e7:	00 12                	add    %dl,(%rdx)
+  8033e9:	0f 80 00 00 00 00    	jo     8033ef <__rodata_start+0x437>
+  8033ef:	00 12                	add    %dl,(%rdx)
+  8033f1:	0f 80 00 00 00 00    	jo     8033f7 <__rodata_start+0x43f>
+  8033f7:	00 12                	add    %dl,(%rdx)
+  8033f9:	0f 80 00 00 00 00    	jo     8033ff <__rodata_start+0x447>
+  8033ff:	00 12                	add    %dl,(%rdx)
+  803401:	0f 80 00 00 00 00    	jo     803407 <__rodata_start+0x44f>
+  803407:	00 12                	add    %dl,(%rdx)
+  803409:	0f 80 00 00 00 00    	jo     80340f <__rodata_start+0x457>
+  80340f:	00 12                	add    %dl,(%rdx)
+  803411:	0f 80 00 00 00 00    	jo     803417 <__rodata_start+0x45f>
+  803417:	00 12                	add    %dl,(%rdx)
+  803419:	0f 80 00 00 00 00    	jo     80341f <__rodata_start+0x467>
+  80341f:	00 12                	add    %dl,(%rdx)
+  803421:	0f 80 00 00 00 00    	jo     803427 <__rodata_start+0x46f>
+  803427:	00 12                	add    %dl,(%rdx)
+  803429:	0f 80 00 00 00 00    	jo     80342f <__rodata_start+0x477>
+  80342f:	00 12                	add    %dl,(%rdx)
+  803431:	0f 80 00 00 00 00    	jo     803437 <__rodata_start+0x47f>
+  803437:	00 12                	add    %dl,(%rdx)
+  803439:	0f 80 00 00 00 00    	jo     80343f <__rodata_start+0x487>
+  80343f:	00 12                	add    %dl,(%rdx)
+  803441:	0f 80 00 00 00 00    	jo     803447 <__rodata_start+0x48f>
+  803447:	00 35 0e 80 00 00    	add    %dh,0x800e(%rip)        # 80b45b <__bss_end+0x345b>
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 12                	add    %dl,(%rdx)
+  803451:	0f 80 00 00 00 00    	jo     803457 <__rodata_start+0x49f>
+  803457:	00 12                	add    %dl,(%rdx)
+  803459:	0f 80 00 00 00 00    	jo     80345f <__rodata_start+0x4a7>
+  80345f:	00 12                	add    %dl,(%rdx)
+  803461:	0f 80 00 00 00 00    	jo     803467 <__rodata_start+0x4af>
+  803467:	00 12                	add    %dl,(%rdx)
+  803469:	0f 80 00 00 00 00    	jo     80346f <__rodata_start+0x4b7>
+  80346f:	00 12                	add    %dl,(%rdx)
+  803471:	0f 80 00 00 00 00    	jo     803477 <__rodata_start+0x4bf>
+  803477:	00 12                	add    %dl,(%rdx)
+  803479:	0f 80 00 00 00 00    	jo     80347f <__rodata_start+0x4c7>
+  80347f:	00 12                	add    %dl,(%rdx)
+  803481:	0f 80 00 00 00 00    	jo     803487 <__rodata_start+0x4cf>
+  803487:	00 12                	add    %dl,(%rdx)
+  803489:	0f 80 00 00 00 00    	jo     80348f <__rodata_start+0x4d7>
+  80348f:	00 12                	add    %dl,(%rdx)
+  803491:	0f 80 00 00 00 00    	jo     803497 <__rodata_start+0x4df>
+  803497:	00 12                	add    %dl,(%rdx)
+  803499:	0f 80 00 00 00 00    	jo     80349f <__rodata_start+0x4e7>
+  80349f:	00 81 09 80 00 00    	add    %al,0x8009(%rcx)
+  8034a5:	00 00                	add    %al,(%rax)
+  8034a7:	00 50 0b             	add    %dl,0xb(%rax)
+  8034aa:	80 00 00             	addb   $0x0,(%rax)
+  8034ad:	00 00                	add    %al,(%rax)
+  8034af:	00 12                	add    %dl,(%rdx)
+  8034b1:	0f 80 00 00 00 00    	jo     8034b7 <__rodata_start+0x4ff>
+  8034b7:	00 12                	add    %dl,(%rdx)
+  8034b9:	0f 80 00 00 00 00    	jo     8034bf <__rodata_start+0x507>
+  8034bf:	00 12                	add    %dl,(%rdx)
+  8034c1:	0f 80 00 00 00 00    	jo     8034c7 <__rodata_start+0x50f>
+  8034c7:	00 12                	add    %dl,(%rdx)
+  8034c9:	0f 80 00 00 00 00    	jo     8034cf <__rodata_start+0x517>
+  8034cf:	00 b0 09 80 00 00    	add    %dh,0x8009(%rax)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 12                	add    %dl,(%rdx)
+  8034d9:	0f 80 00 00 00 00    	jo     8034df <__rodata_start+0x527>
+  8034df:	00 12                	add    %dl,(%rdx)
+  8034e1:	0f 80 00 00 00 00    	jo     8034e7 <__rodata_start+0x52f>
+  8034e7:	00 76 09             	add    %dh,0x9(%rsi)
+  8034ea:	80 00 00             	addb   $0x0,(%rax)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 12                	add    %dl,(%rdx)
+  8034f1:	0f 80 00 00 00 00    	jo     8034f7 <__rodata_start+0x53f>
+  8034f7:	00 12                	add    %dl,(%rdx)
+  8034f9:	0f 80 00 00 00 00    	jo     8034ff <__rodata_start+0x547>
+  8034ff:	00 f8                	add    %bh,%al
+  803501:	0c 80                	or     $0x80,%al
+  803503:	00 00                	add    %al,(%rax)
+  803505:	00 00                	add    %al,(%rax)
+  803507:	00 c2                	add    %al,%dl
+  803509:	0d 80 00 00 00       	or     $0x80,%eax
+  80350e:	00 00                	add    %al,(%rax)
+  803510:	12 0f                	adc    (%rdi),%cl
+  803512:	80 00 00             	addb   $0x0,(%rax)
+  803515:	00 00                	add    %al,(%rax)
+  803517:	00 12                	add    %dl,(%rdx)
+  803519:	0f 80 00 00 00 00    	jo     80351f <__rodata_start+0x567>
+  80351f:	00 47 0a             	add    %al,0xa(%rdi)
+  803522:	80 00 00             	addb   $0x0,(%rax)
+  803525:	00 00                	add    %al,(%rax)
+  803527:	00 12                	add    %dl,(%rdx)
+  803529:	0f 80 00 00 00 00    	jo     80352f <__rodata_start+0x577>
+  80352f:	00 24 0c             	add    %ah,(%rsp,%rcx,1)
+  803532:	80 00 00             	addb   $0x0,(%rax)
+  803535:	00 00                	add    %al,(%rax)
+  803537:	00 12                	add    %dl,(%rdx)
+  803539:	0f 80 00 00 00 00    	jo     80353f <__rodata_start+0x587>
+  80353f:	00 12                	add    %dl,(%rdx)
+  803541:	0f 80 00 00 00 00    	jo     803547 <__rodata_start+0x58f>
+  803547:	00 35 0e 80 00 00    	add    %dh,0x800e(%rip)        # 80b55b <__bss_end+0x355b>
+  80354d:	00 00                	add    %al,(%rax)
+  80354f:	00 12                	add    %dl,(%rdx)
+  803551:	0f 80 00 00 00 00    	jo     803557 <__rodata_start+0x59f>
+  803557:	00 da                	add    %bl,%dl
+  803559:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+	...
+
+0000000000803560 <error_string>:
+	...
+  803568:	15 31 80 00 00 00 00 00 27 31 80 00 00 00 00 00     .1......'1......
+  803578:	37 31 80 00 00 00 00 00 49 31 80 00 00 00 00 00     71......I1......
+  803588:	57 31 80 00 00 00 00 00 6b 31 80 00 00 00 00 00     W1......k1......
+  803598:	80 31 80 00 00 00 00 00 93 31 80 00 00 00 00 00     .1.......1......
+  8035a8:	a5 31 80 00 00 00 00 00 b9 31 80 00 00 00 00 00     .1.......1......
+  8035b8:	c9 31 80 00 00 00 00 00 dc 31 80 00 00 00 00 00     .1.......1......
+  8035c8:	f3 31 80 00 00 00 00 00 09 32 80 00 00 00 00 00     .1.......2......
+  8035d8:	21 32 80 00 00 00 00 00 39 32 80 00 00 00 00 00     !2......92......
+  8035e8:	46 32 80 00 00 00 00 00 10 36 80 00 00 00 00 00     F2.......6......
+  8035f8:	5a 32 80 00 00 00 00 00 00 00 00 00 00 00 00 00     Z2..............
+  803608:	72 32 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     r2......file is 
+  803618:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803628:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803638:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803648:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803658:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803668:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803678:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803688:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803698:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8036a8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8036b8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8036c8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8036d8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008036e0 <devtab>:
+  8036e0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8036f0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803700:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803710:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803720:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803730:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803740:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803750:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803760:	69 70 63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64     ipc_send: failed
+  803770:	20 74 6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63      to send.lib/ipc
+  803780:	2e 63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     .c.f.........f..
+  803790:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803800:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803810:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803820:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803830:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803840:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803850:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803860:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803870:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803880:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803890:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803900:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803910:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803920:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803930:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803940:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803950:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803960:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803970:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803980:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803990:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803aa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ab0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ac0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ad0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ae0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803af0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ba0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803be0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ca0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ce0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803da0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
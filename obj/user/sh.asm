@@ -0,0 +1,7839 @@
+
+obj/user/sh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 15 0b 00 00       	call   800b38 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <_gettoken>:
+
+int
+_gettoken(char *s, char **p1, char **p2) {
+    int t;
+
+    if (s == 0) {
+  800025:	48 85 ff             	test   %rdi,%rdi
+  800028:	0f 84 e3 00 00 00    	je     800111 <_gettoken+0xec>
+_gettoken(char *s, char **p1, char **p2) {
+  80002e:	55                   	push   %rbp
+  80002f:	48 89 e5             	mov    %rsp,%rbp
+  800032:	41 57                	push   %r15
+  800034:	41 56                	push   %r14
+  800036:	41 55                	push   %r13
+  800038:	41 54                	push   %r12
+  80003a:	53                   	push   %rbx
+  80003b:	48 83 ec 08          	sub    $0x8,%rsp
+  80003f:	48 89 fb             	mov    %rdi,%rbx
+  800042:	49 89 f7             	mov    %rsi,%r15
+  800045:	49 89 d6             	mov    %rdx,%r14
+    }
+
+    if (debug > 1)
+        cprintf("GETTOKEN: %s\n", s);
+
+    *p1 = 0;
+  800048:	48 c7 06 00 00 00 00 	movq   $0x0,(%rsi)
+    *p2 = 0;
+  80004f:	48 c7 02 00 00 00 00 	movq   $0x0,(%rdx)
+
+    while (strchr(WHITESPACE, *s))
+  800056:	49 bd 58 42 80 00 00 	movabs $0x804258,%r13
+  80005d:	00 00 00 
+  800060:	49 bc 7c 17 80 00 00 	movabs $0x80177c,%r12
+  800067:	00 00 00 
+  80006a:	eb 08                	jmp    800074 <_gettoken+0x4f>
+        *s++ = 0;
+  80006c:	48 83 c3 01          	add    $0x1,%rbx
+  800070:	c6 43 ff 00          	movb   $0x0,-0x1(%rbx)
+    while (strchr(WHITESPACE, *s))
+  800074:	0f be 33             	movsbl (%rbx),%esi
+  800077:	4c 89 ef             	mov    %r13,%rdi
+  80007a:	41 ff d4             	call   *%r12
+  80007d:	48 85 c0             	test   %rax,%rax
+  800080:	75 ea                	jne    80006c <_gettoken+0x47>
+    if (*s == 0) {
+  800082:	0f b6 33             	movzbl (%rbx),%esi
+  800085:	40 84 f6             	test   %sil,%sil
+  800088:	75 0f                	jne    800099 <_gettoken+0x74>
+        **p2 = 0;
+        cprintf("WORD: %s\n", *p1);
+        **p2 = t;
+    }
+    return 'w';
+}
+  80008a:	48 83 c4 08          	add    $0x8,%rsp
+  80008e:	5b                   	pop    %rbx
+  80008f:	41 5c                	pop    %r12
+  800091:	41 5d                	pop    %r13
+  800093:	41 5e                	pop    %r14
+  800095:	41 5f                	pop    %r15
+  800097:	5d                   	pop    %rbp
+  800098:	c3                   	ret
+    if (strchr(SYMBOLS, *s)) {
+  800099:	40 0f be f6          	movsbl %sil,%esi
+  80009d:	48 bf 61 42 80 00 00 	movabs $0x804261,%rdi
+  8000a4:	00 00 00 
+  8000a7:	48 b8 7c 17 80 00 00 	movabs $0x80177c,%rax
+  8000ae:	00 00 00 
+  8000b1:	ff d0                	call   *%rax
+  8000b3:	48 85 c0             	test   %rax,%rax
+  8000b6:	74 12                	je     8000ca <_gettoken+0xa5>
+        t = *s;
+  8000b8:	0f be 03             	movsbl (%rbx),%eax
+        *p1 = s;
+  8000bb:	49 89 1f             	mov    %rbx,(%r15)
+        *s++ = 0;
+  8000be:	c6 03 00             	movb   $0x0,(%rbx)
+  8000c1:	48 83 c3 01          	add    $0x1,%rbx
+  8000c5:	49 89 1e             	mov    %rbx,(%r14)
+        return t;
+  8000c8:	eb c0                	jmp    80008a <_gettoken+0x65>
+    *p1 = s;
+  8000ca:	49 89 1f             	mov    %rbx,(%r15)
+    while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  8000cd:	0f b6 33             	movzbl (%rbx),%esi
+  8000d0:	49 bd 5d 42 80 00 00 	movabs $0x80425d,%r13
+  8000d7:	00 00 00 
+  8000da:	49 bc 7c 17 80 00 00 	movabs $0x80177c,%r12
+  8000e1:	00 00 00 
+  8000e4:	40 84 f6             	test   %sil,%sil
+  8000e7:	74 1b                	je     800104 <_gettoken+0xdf>
+  8000e9:	40 0f be f6          	movsbl %sil,%esi
+  8000ed:	4c 89 ef             	mov    %r13,%rdi
+  8000f0:	41 ff d4             	call   *%r12
+  8000f3:	48 85 c0             	test   %rax,%rax
+  8000f6:	75 0c                	jne    800104 <_gettoken+0xdf>
+        s++;
+  8000f8:	48 83 c3 01          	add    $0x1,%rbx
+    while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  8000fc:	0f b6 33             	movzbl (%rbx),%esi
+  8000ff:	40 84 f6             	test   %sil,%sil
+  800102:	75 e5                	jne    8000e9 <_gettoken+0xc4>
+    *p2 = s;
+  800104:	49 89 1e             	mov    %rbx,(%r14)
+    return 'w';
+  800107:	b8 77 00 00 00       	mov    $0x77,%eax
+  80010c:	e9 79 ff ff ff       	jmp    80008a <_gettoken+0x65>
+        return 0;
+  800111:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800116:	c3                   	ret
+
+0000000000800117 <gettoken>:
+
+int
+gettoken(char *s, char **p1) {
+  800117:	55                   	push   %rbp
+  800118:	48 89 e5             	mov    %rsp,%rbp
+  80011b:	41 54                	push   %r12
+  80011d:	53                   	push   %rbx
+    static int c, nc;
+    static char *np1, *np2;
+
+    if (s) {
+  80011e:	48 85 ff             	test   %rdi,%rdi
+  800121:	74 33                	je     800156 <gettoken+0x3f>
+        nc = _gettoken(s, &np1, &np2);
+  800123:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  80012a:	00 00 00 
+  80012d:	48 be 10 60 80 00 00 	movabs $0x806010,%rsi
+  800134:	00 00 00 
+  800137:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80013e:	00 00 00 
+  800141:	ff d0                	call   *%rax
+  800143:	a3 04 60 80 00 00 00 	movabs %eax,0x806004
+  80014a:	00 00 
+        return 0;
+  80014c:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+    c = nc;
+    *p1 = np1;
+    nc = _gettoken(np2, &np1, &np2);
+    return c;
+}
+  800151:	5b                   	pop    %rbx
+  800152:	41 5c                	pop    %r12
+  800154:	5d                   	pop    %rbp
+  800155:	c3                   	ret
+    c = nc;
+  800156:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80015d:	00 00 00 
+  800160:	49 bc 04 60 80 00 00 	movabs $0x806004,%r12
+  800167:	00 00 00 
+  80016a:	41 8b 04 24          	mov    (%r12),%eax
+  80016e:	89 03                	mov    %eax,(%rbx)
+    *p1 = np1;
+  800170:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  800177:	00 00 00 
+  80017a:	48 8b 10             	mov    (%rax),%rdx
+  80017d:	48 89 16             	mov    %rdx,(%rsi)
+    nc = _gettoken(np2, &np1, &np2);
+  800180:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  800187:	00 00 00 
+  80018a:	48 8b 3a             	mov    (%rdx),%rdi
+  80018d:	48 89 c6             	mov    %rax,%rsi
+  800190:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800197:	00 00 00 
+  80019a:	ff d0                	call   *%rax
+  80019c:	41 89 04 24          	mov    %eax,(%r12)
+    return c;
+  8001a0:	8b 03                	mov    (%rbx),%eax
+  8001a2:	eb ad                	jmp    800151 <gettoken+0x3a>
+
+00000000008001a4 <runcmd>:
+runcmd(char *s) {
+  8001a4:	55                   	push   %rbp
+  8001a5:	48 89 e5             	mov    %rsp,%rbp
+  8001a8:	41 57                	push   %r15
+  8001aa:	41 56                	push   %r14
+  8001ac:	41 55                	push   %r13
+  8001ae:	41 54                	push   %r12
+  8001b0:	53                   	push   %rbx
+  8001b1:	48 81 ec a8 04 00 00 	sub    $0x4a8,%rsp
+    gettoken(s, 0);
+  8001b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8001bd:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  8001c4:	00 00 00 
+  8001c7:	ff d0                	call   *%rax
+    bool async = false;
+  8001c9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        c = gettoken(0, &t);
+  8001cf:	49 be 17 01 80 00 00 	movabs $0x800117,%r14
+  8001d6:	00 00 00 
+            cprintf("syntax error: & allowed only at the end of command\n");
+  8001d9:	49 bf 52 0d 80 00 00 	movabs $0x800d52,%r15
+  8001e0:	00 00 00 
+    argc = 0;
+  8001e3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        c = gettoken(0, &t);
+  8001e9:	48 8d b5 48 ff ff ff 	lea    -0xb8(%rbp),%rsi
+  8001f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001f5:	41 ff d6             	call   *%r14
+  8001f8:	89 c3                	mov    %eax,%ebx
+        if (async && c) {
+  8001fa:	85 c0                	test   %eax,%eax
+  8001fc:	74 09                	je     800207 <runcmd+0x63>
+  8001fe:	45 84 ed             	test   %r13b,%r13b
+  800201:	0f 85 80 00 00 00    	jne    800287 <runcmd+0xe3>
+        switch (c) {
+  800207:	83 fb 3e             	cmp    $0x3e,%ebx
+  80020a:	0f 84 53 02 00 00    	je     800463 <runcmd+0x2bf>
+  800210:	0f 8f 18 01 00 00    	jg     80032e <runcmd+0x18a>
+  800216:	83 fb 26             	cmp    $0x26,%ebx
+  800219:	74 61                	je     80027c <runcmd+0xd8>
+  80021b:	83 fb 3c             	cmp    $0x3c,%ebx
+  80021e:	0f 85 86 00 00 00    	jne    8002aa <runcmd+0x106>
+            if (gettoken(0, &t) != 'w') {
+  800224:	48 8d b5 48 ff ff ff 	lea    -0xb8(%rbp),%rsi
+  80022b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800230:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  800237:	00 00 00 
+  80023a:	ff d0                	call   *%rax
+  80023c:	83 f8 77             	cmp    $0x77,%eax
+  80023f:	0f 85 9e 01 00 00    	jne    8003e3 <runcmd+0x23f>
+            fd = open(t, O_RDONLY);
+  800245:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80024c:	48 89 85 38 fb ff ff 	mov    %rax,-0x4c8(%rbp)
+  800253:	be 00 00 00 00       	mov    $0x0,%esi
+  800258:	48 89 c7             	mov    %rax,%rdi
+  80025b:	48 b8 bc 2e 80 00 00 	movabs $0x802ebc,%rax
+  800262:	00 00 00 
+  800265:	ff d0                	call   *%rax
+  800267:	89 c3                	mov    %eax,%ebx
+            if (fd < 0) {
+  800269:	85 c0                	test   %eax,%eax
+  80026b:	0f 88 9e 01 00 00    	js     80040f <runcmd+0x26b>
+            if (fd) {
+  800271:	0f 84 72 ff ff ff    	je     8001e9 <runcmd+0x45>
+  800277:	e9 c1 01 00 00       	jmp    80043d <runcmd+0x299>
+        switch (c) {
+  80027c:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+  800282:	e9 62 ff ff ff       	jmp    8001e9 <runcmd+0x45>
+            cprintf("syntax error: & allowed only at the end of command\n");
+  800287:	48 bf 20 43 80 00 00 	movabs $0x804320,%rdi
+  80028e:	00 00 00 
+  800291:	b8 00 00 00 00       	mov    $0x0,%eax
+  800296:	41 ff d7             	call   *%r15
+            exit();
+  800299:	48 b8 df 0b 80 00 00 	movabs $0x800bdf,%rax
+  8002a0:	00 00 00 
+  8002a3:	ff d0                	call   *%rax
+  8002a5:	e9 5d ff ff ff       	jmp    800207 <runcmd+0x63>
+        switch (c) {
+  8002aa:	85 db                	test   %ebx,%ebx
+  8002ac:	0f 85 46 03 00 00    	jne    8005f8 <runcmd+0x454>
+    if (argc == 0) {
+  8002b2:	45 85 e4             	test   %r12d,%r12d
+  8002b5:	74 65                	je     80031c <runcmd+0x178>
+    if (argv[0][0] != '/') {
+  8002b7:	48 8b b5 50 ff ff ff 	mov    -0xb0(%rbp),%rsi
+  8002be:	80 3e 2f             	cmpb   $0x2f,(%rsi)
+  8002c1:	0f 85 5e 03 00 00    	jne    800625 <runcmd+0x481>
+    argv[argc] = 0;
+  8002c7:	4d 63 e4             	movslq %r12d,%r12
+  8002ca:	4a c7 84 e5 50 ff ff 	movq   $0x0,-0xb0(%rbp,%r12,8)
+  8002d1:	ff 00 00 00 00 
+    if ((r = spawn(argv[0], (const char **)argv)) < 0)
+  8002d6:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  8002dd:	48 8b bd 50 ff ff ff 	mov    -0xb0(%rbp),%rdi
+  8002e4:	48 b8 88 31 80 00 00 	movabs $0x803188,%rax
+  8002eb:	00 00 00 
+  8002ee:	ff d0                	call   *%rax
+  8002f0:	41 89 c4             	mov    %eax,%r12d
+  8002f3:	85 c0                	test   %eax,%eax
+  8002f5:	0f 88 57 03 00 00    	js     800652 <runcmd+0x4ae>
+    close_all();
+  8002fb:	48 b8 b3 27 80 00 00 	movabs $0x8027b3,%rax
+  800302:	00 00 00 
+  800305:	ff d0                	call   *%rax
+    if (r >= 0 && !async) {
+  800307:	45 84 ed             	test   %r13b,%r13b
+  80030a:	0f 84 78 03 00 00    	je     800688 <runcmd+0x4e4>
+    exit();
+  800310:	48 b8 df 0b 80 00 00 	movabs $0x800bdf,%rax
+  800317:	00 00 00 
+  80031a:	ff d0                	call   *%rax
+}
+  80031c:	48 81 c4 a8 04 00 00 	add    $0x4a8,%rsp
+  800323:	5b                   	pop    %rbx
+  800324:	41 5c                	pop    %r12
+  800326:	41 5d                	pop    %r13
+  800328:	41 5e                	pop    %r14
+  80032a:	41 5f                	pop    %r15
+  80032c:	5d                   	pop    %rbp
+  80032d:	c3                   	ret
+        switch (c) {
+  80032e:	83 fb 77             	cmp    $0x77,%ebx
+  800331:	74 65                	je     800398 <runcmd+0x1f4>
+  800333:	83 fb 7c             	cmp    $0x7c,%ebx
+  800336:	0f 85 bc 02 00 00    	jne    8005f8 <runcmd+0x454>
+            if ((r = pipe(p)) < 0) {
+  80033c:	48 8d bd 40 fb ff ff 	lea    -0x4c0(%rbp),%rdi
+  800343:	48 b8 12 3c 80 00 00 	movabs $0x803c12,%rax
+  80034a:	00 00 00 
+  80034d:	ff d0                	call   *%rax
+  80034f:	85 c0                	test   %eax,%eax
+  800351:	0f 88 db 01 00 00    	js     800532 <runcmd+0x38e>
+            if ((r = fork()) < 0) {
+  800357:	48 b8 13 23 80 00 00 	movabs $0x802313,%rax
+  80035e:	00 00 00 
+  800361:	ff d0                	call   *%rax
+  800363:	89 c3                	mov    %eax,%ebx
+  800365:	85 c0                	test   %eax,%eax
+  800367:	0f 88 f3 01 00 00    	js     800560 <runcmd+0x3bc>
+            if (r == 0) {
+  80036d:	0f 85 16 02 00 00    	jne    800589 <runcmd+0x3e5>
+                if (p[0] != 0) {
+  800373:	8b bd 40 fb ff ff    	mov    -0x4c0(%rbp),%edi
+  800379:	85 ff                	test   %edi,%edi
+  80037b:	0f 85 2a 02 00 00    	jne    8005ab <runcmd+0x407>
+                close(p[1]);
+  800381:	8b bd 44 fb ff ff    	mov    -0x4bc(%rbp),%edi
+  800387:	48 b8 80 27 80 00 00 	movabs $0x802780,%rax
+  80038e:	00 00 00 
+  800391:	ff d0                	call   *%rax
+                goto again;
+  800393:	e9 4b fe ff ff       	jmp    8001e3 <runcmd+0x3f>
+            if (argc == MAXARGS) {
+  800398:	41 83 fc 10          	cmp    $0x10,%r12d
+  80039c:	74 1c                	je     8003ba <runcmd+0x216>
+            argv[argc++] = t;
+  80039e:	49 63 c4             	movslq %r12d,%rax
+  8003a1:	48 8b 95 48 ff ff ff 	mov    -0xb8(%rbp),%rdx
+  8003a8:	48 89 94 c5 50 ff ff 	mov    %rdx,-0xb0(%rbp,%rax,8)
+  8003af:	ff 
+  8003b0:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+            break;
+  8003b5:	e9 2f fe ff ff       	jmp    8001e9 <runcmd+0x45>
+                cprintf("too many arguments\n");
+  8003ba:	48 bf 69 42 80 00 00 	movabs $0x804269,%rdi
+  8003c1:	00 00 00 
+  8003c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c9:	48 ba 52 0d 80 00 00 	movabs $0x800d52,%rdx
+  8003d0:	00 00 00 
+  8003d3:	ff d2                	call   *%rdx
+                exit();
+  8003d5:	48 b8 df 0b 80 00 00 	movabs $0x800bdf,%rax
+  8003dc:	00 00 00 
+  8003df:	ff d0                	call   *%rax
+  8003e1:	eb bb                	jmp    80039e <runcmd+0x1fa>
+                cprintf("syntax error: < not followed by word\n");
+  8003e3:	48 bf 58 43 80 00 00 	movabs $0x804358,%rdi
+  8003ea:	00 00 00 
+  8003ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f2:	48 ba 52 0d 80 00 00 	movabs $0x800d52,%rdx
+  8003f9:	00 00 00 
+  8003fc:	ff d2                	call   *%rdx
+                exit();
+  8003fe:	48 b8 df 0b 80 00 00 	movabs $0x800bdf,%rax
+  800405:	00 00 00 
+  800408:	ff d0                	call   *%rax
+  80040a:	e9 36 fe ff ff       	jmp    800245 <runcmd+0xa1>
+                cprintf("failed to open %s", t);
+  80040f:	48 8b b5 38 fb ff ff 	mov    -0x4c8(%rbp),%rsi
+  800416:	48 bf 7d 42 80 00 00 	movabs $0x80427d,%rdi
+  80041d:	00 00 00 
+  800420:	b8 00 00 00 00       	mov    $0x0,%eax
+  800425:	48 ba 52 0d 80 00 00 	movabs $0x800d52,%rdx
+  80042c:	00 00 00 
+  80042f:	ff d2                	call   *%rdx
+                exit();
+  800431:	48 b8 df 0b 80 00 00 	movabs $0x800bdf,%rax
+  800438:	00 00 00 
+  80043b:	ff d0                	call   *%rax
+                dup(fd, 0);
+  80043d:	be 00 00 00 00       	mov    $0x0,%esi
+  800442:	89 df                	mov    %ebx,%edi
+  800444:	48 b8 db 27 80 00 00 	movabs $0x8027db,%rax
+  80044b:	00 00 00 
+  80044e:	ff d0                	call   *%rax
+                close(fd);
+  800450:	89 df                	mov    %ebx,%edi
+  800452:	48 b8 80 27 80 00 00 	movabs $0x802780,%rax
+  800459:	00 00 00 
+  80045c:	ff d0                	call   *%rax
+  80045e:	e9 86 fd ff ff       	jmp    8001e9 <runcmd+0x45>
+            if (gettoken(0, &t) != 'w') {
+  800463:	48 8d b5 48 ff ff ff 	lea    -0xb8(%rbp),%rsi
+  80046a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80046f:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  800476:	00 00 00 
+  800479:	ff d0                	call   *%rax
+  80047b:	83 f8 77             	cmp    $0x77,%eax
+  80047e:	75 33                	jne    8004b3 <runcmd+0x30f>
+            if ((fd = open(t, O_WRONLY | O_CREAT | O_TRUNC)) < 0) {
+  800480:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800487:	48 89 85 38 fb ff ff 	mov    %rax,-0x4c8(%rbp)
+  80048e:	be 01 03 00 00       	mov    $0x301,%esi
+  800493:	48 89 c7             	mov    %rax,%rdi
+  800496:	48 b8 bc 2e 80 00 00 	movabs $0x802ebc,%rax
+  80049d:	00 00 00 
+  8004a0:	ff d0                	call   *%rax
+  8004a2:	89 c3                	mov    %eax,%ebx
+  8004a4:	85 c0                	test   %eax,%eax
+  8004a6:	78 34                	js     8004dc <runcmd+0x338>
+            if (fd != 1) {
+  8004a8:	83 f8 01             	cmp    $0x1,%eax
+  8004ab:	0f 84 38 fd ff ff    	je     8001e9 <runcmd+0x45>
+  8004b1:	eb 59                	jmp    80050c <runcmd+0x368>
+                cprintf("syntax error: > not followed by word\n");
+  8004b3:	48 bf 80 43 80 00 00 	movabs $0x804380,%rdi
+  8004ba:	00 00 00 
+  8004bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c2:	48 ba 52 0d 80 00 00 	movabs $0x800d52,%rdx
+  8004c9:	00 00 00 
+  8004cc:	ff d2                	call   *%rdx
+                exit();
+  8004ce:	48 b8 df 0b 80 00 00 	movabs $0x800bdf,%rax
+  8004d5:	00 00 00 
+  8004d8:	ff d0                	call   *%rax
+  8004da:	eb a4                	jmp    800480 <runcmd+0x2dc>
+                cprintf("open %s for write: %i", t, fd);
+  8004dc:	89 c2                	mov    %eax,%edx
+  8004de:	48 8b b5 38 fb ff ff 	mov    -0x4c8(%rbp),%rsi
+  8004e5:	48 bf 8f 42 80 00 00 	movabs $0x80428f,%rdi
+  8004ec:	00 00 00 
+  8004ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f4:	48 b9 52 0d 80 00 00 	movabs $0x800d52,%rcx
+  8004fb:	00 00 00 
+  8004fe:	ff d1                	call   *%rcx
+                exit();
+  800500:	48 b8 df 0b 80 00 00 	movabs $0x800bdf,%rax
+  800507:	00 00 00 
+  80050a:	ff d0                	call   *%rax
+                dup(fd, 1);
+  80050c:	be 01 00 00 00       	mov    $0x1,%esi
+  800511:	89 df                	mov    %ebx,%edi
+  800513:	48 b8 db 27 80 00 00 	movabs $0x8027db,%rax
+  80051a:	00 00 00 
+  80051d:	ff d0                	call   *%rax
+                close(fd);
+  80051f:	89 df                	mov    %ebx,%edi
+  800521:	48 b8 80 27 80 00 00 	movabs $0x802780,%rax
+  800528:	00 00 00 
+  80052b:	ff d0                	call   *%rax
+  80052d:	e9 b7 fc ff ff       	jmp    8001e9 <runcmd+0x45>
+                cprintf("pipe: %i", r);
+  800532:	89 c6                	mov    %eax,%esi
+  800534:	48 bf a5 42 80 00 00 	movabs $0x8042a5,%rdi
+  80053b:	00 00 00 
+  80053e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800543:	48 ba 52 0d 80 00 00 	movabs $0x800d52,%rdx
+  80054a:	00 00 00 
+  80054d:	ff d2                	call   *%rdx
+                exit();
+  80054f:	48 b8 df 0b 80 00 00 	movabs $0x800bdf,%rax
+  800556:	00 00 00 
+  800559:	ff d0                	call   *%rax
+  80055b:	e9 f7 fd ff ff       	jmp    800357 <runcmd+0x1b3>
+                cprintf("fork: %i", r);
+  800560:	89 c6                	mov    %eax,%esi
+  800562:	48 bf ae 42 80 00 00 	movabs $0x8042ae,%rdi
+  800569:	00 00 00 
+  80056c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800571:	48 ba 52 0d 80 00 00 	movabs $0x800d52,%rdx
+  800578:	00 00 00 
+  80057b:	ff d2                	call   *%rdx
+                exit();
+  80057d:	48 b8 df 0b 80 00 00 	movabs $0x800bdf,%rax
+  800584:	00 00 00 
+  800587:	ff d0                	call   *%rax
+                if (p[1] != 1) {
+  800589:	8b bd 44 fb ff ff    	mov    -0x4bc(%rbp),%edi
+  80058f:	83 ff 01             	cmp    $0x1,%edi
+  800592:	75 3f                	jne    8005d3 <runcmd+0x42f>
+                close(p[0]);
+  800594:	8b bd 40 fb ff ff    	mov    -0x4c0(%rbp),%edi
+  80059a:	48 b8 80 27 80 00 00 	movabs $0x802780,%rax
+  8005a1:	00 00 00 
+  8005a4:	ff d0                	call   *%rax
+                goto runit;
+  8005a6:	e9 07 fd ff ff       	jmp    8002b2 <runcmd+0x10e>
+                    dup(p[0], 0);
+  8005ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8005b0:	48 b8 db 27 80 00 00 	movabs $0x8027db,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+                    close(p[0]);
+  8005bc:	8b bd 40 fb ff ff    	mov    -0x4c0(%rbp),%edi
+  8005c2:	48 b8 80 27 80 00 00 	movabs $0x802780,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+  8005ce:	e9 ae fd ff ff       	jmp    800381 <runcmd+0x1dd>
+                    dup(p[1], 1);
+  8005d3:	be 01 00 00 00       	mov    $0x1,%esi
+  8005d8:	48 b8 db 27 80 00 00 	movabs $0x8027db,%rax
+  8005df:	00 00 00 
+  8005e2:	ff d0                	call   *%rax
+                    close(p[1]);
+  8005e4:	8b bd 44 fb ff ff    	mov    -0x4bc(%rbp),%edi
+  8005ea:	48 b8 80 27 80 00 00 	movabs $0x802780,%rax
+  8005f1:	00 00 00 
+  8005f4:	ff d0                	call   *%rax
+  8005f6:	eb 9c                	jmp    800594 <runcmd+0x3f0>
+            panic("bad return %d from gettoken", c);
+  8005f8:	89 d9                	mov    %ebx,%ecx
+  8005fa:	48 ba b7 42 80 00 00 	movabs $0x8042b7,%rdx
+  800601:	00 00 00 
+  800604:	be 7d 00 00 00       	mov    $0x7d,%esi
+  800609:	48 bf d3 42 80 00 00 	movabs $0x8042d3,%rdi
+  800610:	00 00 00 
+  800613:	b8 00 00 00 00       	mov    $0x0,%eax
+  800618:	49 b8 02 0c 80 00 00 	movabs $0x800c02,%r8
+  80061f:	00 00 00 
+  800622:	41 ff d0             	call   *%r8
+        argv0buf[0] = '/';
+  800625:	c6 85 48 fb ff ff 2f 	movb   $0x2f,-0x4b8(%rbp)
+        strcpy(argv0buf + 1, argv[0]);
+  80062c:	4c 8d b5 48 fb ff ff 	lea    -0x4b8(%rbp),%r14
+  800633:	48 8d bd 49 fb ff ff 	lea    -0x4b7(%rbp),%rdi
+  80063a:	48 b8 77 16 80 00 00 	movabs $0x801677,%rax
+  800641:	00 00 00 
+  800644:	ff d0                	call   *%rax
+        argv[0] = argv0buf;
+  800646:	4c 89 b5 50 ff ff ff 	mov    %r14,-0xb0(%rbp)
+  80064d:	e9 75 fc ff ff       	jmp    8002c7 <runcmd+0x123>
+        cprintf("spawn %s: %i\n", argv[0], r);
+  800652:	89 c2                	mov    %eax,%edx
+  800654:	48 8b b5 50 ff ff ff 	mov    -0xb0(%rbp),%rsi
+  80065b:	48 bf dd 42 80 00 00 	movabs $0x8042dd,%rdi
+  800662:	00 00 00 
+  800665:	b8 00 00 00 00       	mov    $0x0,%eax
+  80066a:	48 b9 52 0d 80 00 00 	movabs $0x800d52,%rcx
+  800671:	00 00 00 
+  800674:	ff d1                	call   *%rcx
+    close_all();
+  800676:	48 b8 b3 27 80 00 00 	movabs $0x8027b3,%rax
+  80067d:	00 00 00 
+  800680:	ff d0                	call   *%rax
+    if (r >= 0 && !async) {
+  800682:	41 83 f5 01          	xor    $0x1,%r13d
+  800686:	eb 15                	jmp    80069d <runcmd+0x4f9>
+        wait(r);
+  800688:	44 89 e7             	mov    %r12d,%edi
+  80068b:	48 b8 71 3e 80 00 00 	movabs $0x803e71,%rax
+  800692:	00 00 00 
+  800695:	ff d0                	call   *%rax
+    if (r >= 0 && !async) {
+  800697:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    if (pipe_child && !async) {
+  80069d:	85 db                	test   %ebx,%ebx
+  80069f:	0f 84 6b fc ff ff    	je     800310 <runcmd+0x16c>
+  8006a5:	45 84 ed             	test   %r13b,%r13b
+  8006a8:	0f 84 62 fc ff ff    	je     800310 <runcmd+0x16c>
+        wait(pipe_child);
+  8006ae:	89 df                	mov    %ebx,%edi
+  8006b0:	48 b8 71 3e 80 00 00 	movabs $0x803e71,%rax
+  8006b7:	00 00 00 
+  8006ba:	ff d0                	call   *%rax
+        if (debug) cprintf("[%08x] wait finished\n", thisenv->env_id);
+  8006bc:	e9 4f fc ff ff       	jmp    800310 <runcmd+0x16c>
+
+00000000008006c1 <usage>:
+
+void
+usage(void) {
+  8006c1:	55                   	push   %rbp
+  8006c2:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("usage: sh [-dix] [command-file]\n");
+  8006c5:	48 bf a8 43 80 00 00 	movabs $0x8043a8,%rdi
+  8006cc:	00 00 00 
+  8006cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d4:	48 ba 52 0d 80 00 00 	movabs $0x800d52,%rdx
+  8006db:	00 00 00 
+  8006de:	ff d2                	call   *%rdx
+    exit();
+  8006e0:	48 b8 df 0b 80 00 00 	movabs $0x800bdf,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+}
+  8006ec:	5d                   	pop    %rbp
+  8006ed:	c3                   	ret
+
+00000000008006ee <umain>:
+
+void
+umain(int argc, char **argv) {
+  8006ee:	55                   	push   %rbp
+  8006ef:	48 89 e5             	mov    %rsp,%rbp
+  8006f2:	41 57                	push   %r15
+  8006f4:	41 56                	push   %r14
+  8006f6:	41 55                	push   %r13
+  8006f8:	41 54                	push   %r12
+  8006fa:	53                   	push   %rbx
+  8006fb:	48 83 ec 38          	sub    $0x38,%rsp
+  8006ff:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  800702:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+    int r, interactive, echocmds;
+    struct Argstate args;
+
+    interactive = '?';
+    echocmds = 0;
+    argstart(&argc, argv, &args);
+  800706:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  80070a:	48 8d 7d ac          	lea    -0x54(%rbp),%rdi
+  80070e:	48 b8 13 24 80 00 00 	movabs $0x802413,%rax
+  800715:	00 00 00 
+  800718:	ff d0                	call   *%rax
+    echocmds = 0;
+  80071a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    interactive = '?';
+  800720:	41 be 3f 00 00 00    	mov    $0x3f,%r14d
+    while ((r = argnext(&args)) >= 0) {
+  800726:	48 bb 40 24 80 00 00 	movabs $0x802440,%rbx
+  80072d:	00 00 00 
+        switch (r) {
+  800730:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            break;
+        case 'x':
+            echocmds = 1;
+            break;
+        default:
+            usage();
+  800736:	49 bf c1 06 80 00 00 	movabs $0x8006c1,%r15
+  80073d:	00 00 00 
+    while ((r = argnext(&args)) >= 0) {
+  800740:	eb 08                	jmp    80074a <umain+0x5c>
+        switch (r) {
+  800742:	45 89 e6             	mov    %r12d,%r14d
+  800745:	eb 03                	jmp    80074a <umain+0x5c>
+            echocmds = 1;
+  800747:	45 89 e5             	mov    %r12d,%r13d
+    while ((r = argnext(&args)) >= 0) {
+  80074a:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  80074e:	ff d3                	call   *%rbx
+  800750:	85 c0                	test   %eax,%eax
+  800752:	78 14                	js     800768 <umain+0x7a>
+        switch (r) {
+  800754:	83 f8 69             	cmp    $0x69,%eax
+  800757:	74 e9                	je     800742 <umain+0x54>
+  800759:	83 f8 78             	cmp    $0x78,%eax
+  80075c:	74 e9                	je     800747 <umain+0x59>
+  80075e:	83 f8 64             	cmp    $0x64,%eax
+  800761:	74 e7                	je     80074a <umain+0x5c>
+            usage();
+  800763:	41 ff d7             	call   *%r15
+  800766:	eb e2                	jmp    80074a <umain+0x5c>
+        }
+    }
+
+    if (argc > 2)
+  800768:	83 7d ac 02          	cmpl   $0x2,-0x54(%rbp)
+  80076c:	7f 3f                	jg     8007ad <umain+0xbf>
+        usage();
+    if (argc == 2) {
+  80076e:	83 7d ac 02          	cmpl   $0x2,-0x54(%rbp)
+  800772:	74 47                	je     8007bb <umain+0xcd>
+        close(0);
+        if ((r = open(argv[1], O_RDONLY)) < 0)
+            panic("open %s: %i", argv[1], r);
+        assert(r == 0);
+    }
+    if (interactive == '?')
+  800774:	41 83 fe 3f          	cmp    $0x3f,%r14d
+  800778:	0f 84 d8 00 00 00    	je     800856 <umain+0x168>
+  80077e:	45 85 f6             	test   %r14d,%r14d
+  800781:	49 bc 13 43 80 00 00 	movabs $0x804313,%r12
+  800788:	00 00 00 
+  80078b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800790:	4c 0f 44 e0          	cmove  %rax,%r12
+        interactive = iscons(0);
+
+    while (1) {
+        char *buf;
+
+        buf = readline(interactive ? "$ " : NULL);
+  800794:	49 be 9e 1a 80 00 00 	movabs $0x801a9e,%r14
+  80079b:	00 00 00 
+        if (buf == NULL) {
+            if (debug) cprintf("EXITING\n");
+            exit(); /* end of file */
+  80079e:	49 bf df 0b 80 00 00 	movabs $0x800bdf,%r15
+  8007a5:	00 00 00 
+  8007a8:	e9 22 01 00 00       	jmp    8008cf <umain+0x1e1>
+        usage();
+  8007ad:	48 b8 c1 06 80 00 00 	movabs $0x8006c1,%rax
+  8007b4:	00 00 00 
+  8007b7:	ff d0                	call   *%rax
+  8007b9:	eb b3                	jmp    80076e <umain+0x80>
+        close(0);
+  8007bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007c0:	48 b8 80 27 80 00 00 	movabs $0x802780,%rax
+  8007c7:	00 00 00 
+  8007ca:	ff d0                	call   *%rax
+        if ((r = open(argv[1], O_RDONLY)) < 0)
+  8007cc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007d0:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  8007d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8007d9:	48 b8 bc 2e 80 00 00 	movabs $0x802ebc,%rax
+  8007e0:	00 00 00 
+  8007e3:	ff d0                	call   *%rax
+  8007e5:	85 c0                	test   %eax,%eax
+  8007e7:	78 37                	js     800820 <umain+0x132>
+        assert(r == 0);
+  8007e9:	74 89                	je     800774 <umain+0x86>
+  8007eb:	48 b9 f7 42 80 00 00 	movabs $0x8042f7,%rcx
+  8007f2:	00 00 00 
+  8007f5:	48 ba fe 42 80 00 00 	movabs $0x8042fe,%rdx
+  8007fc:	00 00 00 
+  8007ff:	be 23 01 00 00       	mov    $0x123,%esi
+  800804:	48 bf d3 42 80 00 00 	movabs $0x8042d3,%rdi
+  80080b:	00 00 00 
+  80080e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800813:	49 b8 02 0c 80 00 00 	movabs $0x800c02,%r8
+  80081a:	00 00 00 
+  80081d:	41 ff d0             	call   *%r8
+            panic("open %s: %i", argv[1], r);
+  800820:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800824:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  800828:	41 89 c0             	mov    %eax,%r8d
+  80082b:	48 ba eb 42 80 00 00 	movabs $0x8042eb,%rdx
+  800832:	00 00 00 
+  800835:	be 22 01 00 00       	mov    $0x122,%esi
+  80083a:	48 bf d3 42 80 00 00 	movabs $0x8042d3,%rdi
+  800841:	00 00 00 
+  800844:	b8 00 00 00 00       	mov    $0x0,%eax
+  800849:	49 b9 02 0c 80 00 00 	movabs $0x800c02,%r9
+  800850:	00 00 00 
+  800853:	41 ff d1             	call   *%r9
+        interactive = iscons(0);
+  800856:	bf 00 00 00 00       	mov    $0x0,%edi
+  80085b:	48 b8 9b 0a 80 00 00 	movabs $0x800a9b,%rax
+  800862:	00 00 00 
+  800865:	ff d0                	call   *%rax
+  800867:	41 89 c6             	mov    %eax,%r14d
+  80086a:	e9 0f ff ff ff       	jmp    80077e <umain+0x90>
+            exit(); /* end of file */
+  80086f:	41 ff d7             	call   *%r15
+  800872:	eb 69                	jmp    8008dd <umain+0x1ef>
+        }
+        if (debug) cprintf("LINE: %s\n", buf);
+        if (buf[0] == '#') continue;
+        if (echocmds) printf("# %s\n", buf);
+  800874:	48 89 de             	mov    %rbx,%rsi
+  800877:	48 bf 16 43 80 00 00 	movabs $0x804316,%rdi
+  80087e:	00 00 00 
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+  800886:	48 b9 eb 30 80 00 00 	movabs $0x8030eb,%rcx
+  80088d:	00 00 00 
+  800890:	ff d1                	call   *%rcx
+  800892:	eb 53                	jmp    8008e7 <umain+0x1f9>
+        if (debug) cprintf("BEFORE FORK\n");
+        if ((r = fork()) < 0) panic("fork: %i", r);
+  800894:	89 c1                	mov    %eax,%ecx
+  800896:	48 ba ae 42 80 00 00 	movabs $0x8042ae,%rdx
+  80089d:	00 00 00 
+  8008a0:	be 34 01 00 00       	mov    $0x134,%esi
+  8008a5:	48 bf d3 42 80 00 00 	movabs $0x8042d3,%rdi
+  8008ac:	00 00 00 
+  8008af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b4:	49 b8 02 0c 80 00 00 	movabs $0x800c02,%r8
+  8008bb:	00 00 00 
+  8008be:	41 ff d0             	call   *%r8
+        if (debug) cprintf("FORK: %d\n", r);
+        if (r == 0) {
+            runcmd(buf);
+            exit();
+        } else
+            wait(r);
+  8008c1:	89 c7                	mov    %eax,%edi
+  8008c3:	48 b8 71 3e 80 00 00 	movabs $0x803e71,%rax
+  8008ca:	00 00 00 
+  8008cd:	ff d0                	call   *%rax
+        buf = readline(interactive ? "$ " : NULL);
+  8008cf:	4c 89 e7             	mov    %r12,%rdi
+  8008d2:	41 ff d6             	call   *%r14
+  8008d5:	48 89 c3             	mov    %rax,%rbx
+        if (buf == NULL) {
+  8008d8:	48 85 c0             	test   %rax,%rax
+  8008db:	74 92                	je     80086f <umain+0x181>
+        if (buf[0] == '#') continue;
+  8008dd:	80 3b 23             	cmpb   $0x23,(%rbx)
+  8008e0:	74 ed                	je     8008cf <umain+0x1e1>
+        if (echocmds) printf("# %s\n", buf);
+  8008e2:	45 85 ed             	test   %r13d,%r13d
+  8008e5:	75 8d                	jne    800874 <umain+0x186>
+        if ((r = fork()) < 0) panic("fork: %i", r);
+  8008e7:	48 b8 13 23 80 00 00 	movabs $0x802313,%rax
+  8008ee:	00 00 00 
+  8008f1:	ff d0                	call   *%rax
+  8008f3:	85 c0                	test   %eax,%eax
+  8008f5:	78 9d                	js     800894 <umain+0x1a6>
+        if (r == 0) {
+  8008f7:	75 c8                	jne    8008c1 <umain+0x1d3>
+            runcmd(buf);
+  8008f9:	48 89 df             	mov    %rbx,%rdi
+  8008fc:	48 b8 a4 01 80 00 00 	movabs $0x8001a4,%rax
+  800903:	00 00 00 
+  800906:	ff d0                	call   *%rax
+            exit();
+  800908:	41 ff d7             	call   *%r15
+  80090b:	eb c2                	jmp    8008cf <umain+0x1e1>
+
+000000000080090d <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80090d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800912:	c3                   	ret
+
+0000000000800913 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  800913:	55                   	push   %rbp
+  800914:	48 89 e5             	mov    %rsp,%rbp
+  800917:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80091a:	48 be c9 43 80 00 00 	movabs $0x8043c9,%rsi
+  800921:	00 00 00 
+  800924:	48 b8 77 16 80 00 00 	movabs $0x801677,%rax
+  80092b:	00 00 00 
+  80092e:	ff d0                	call   *%rax
+    return 0;
+}
+  800930:	b8 00 00 00 00       	mov    $0x0,%eax
+  800935:	5d                   	pop    %rbp
+  800936:	c3                   	ret
+
+0000000000800937 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800937:	55                   	push   %rbp
+  800938:	48 89 e5             	mov    %rsp,%rbp
+  80093b:	41 57                	push   %r15
+  80093d:	41 56                	push   %r14
+  80093f:	41 55                	push   %r13
+  800941:	41 54                	push   %r12
+  800943:	53                   	push   %rbx
+  800944:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80094b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  800952:	48 85 d2             	test   %rdx,%rdx
+  800955:	74 7a                	je     8009d1 <devcons_write+0x9a>
+  800957:	49 89 d6             	mov    %rdx,%r14
+  80095a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800960:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  800965:	49 bf 71 18 80 00 00 	movabs $0x801871,%r15
+  80096c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80096f:	4c 89 f3             	mov    %r14,%rbx
+  800972:	48 29 f3             	sub    %rsi,%rbx
+  800975:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80097a:	48 39 c3             	cmp    %rax,%rbx
+  80097d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  800981:	4c 63 eb             	movslq %ebx,%r13
+  800984:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80098b:	48 01 c6             	add    %rax,%rsi
+  80098e:	4c 89 ea             	mov    %r13,%rdx
+  800991:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800998:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80099b:	4c 89 ee             	mov    %r13,%rsi
+  80099e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8009a5:	48 b8 e8 1b 80 00 00 	movabs $0x801be8,%rax
+  8009ac:	00 00 00 
+  8009af:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8009b1:	41 01 dc             	add    %ebx,%r12d
+  8009b4:	49 63 f4             	movslq %r12d,%rsi
+  8009b7:	4c 39 f6             	cmp    %r14,%rsi
+  8009ba:	72 b3                	jb     80096f <devcons_write+0x38>
+    return res;
+  8009bc:	49 63 c4             	movslq %r12d,%rax
+}
+  8009bf:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8009c6:	5b                   	pop    %rbx
+  8009c7:	41 5c                	pop    %r12
+  8009c9:	41 5d                	pop    %r13
+  8009cb:	41 5e                	pop    %r14
+  8009cd:	41 5f                	pop    %r15
+  8009cf:	5d                   	pop    %rbp
+  8009d0:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8009d1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8009d7:	eb e3                	jmp    8009bc <devcons_write+0x85>
+
+00000000008009d9 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8009d9:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8009dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009e1:	48 85 c0             	test   %rax,%rax
+  8009e4:	74 55                	je     800a3b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8009e6:	55                   	push   %rbp
+  8009e7:	48 89 e5             	mov    %rsp,%rbp
+  8009ea:	41 55                	push   %r13
+  8009ec:	41 54                	push   %r12
+  8009ee:	53                   	push   %rbx
+  8009ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8009f3:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8009f6:	48 bb 15 1c 80 00 00 	movabs $0x801c15,%rbx
+  8009fd:	00 00 00 
+  800a00:	49 bc e2 1c 80 00 00 	movabs $0x801ce2,%r12
+  800a07:	00 00 00 
+  800a0a:	eb 03                	jmp    800a0f <devcons_read+0x36>
+  800a0c:	41 ff d4             	call   *%r12
+  800a0f:	ff d3                	call   *%rbx
+  800a11:	85 c0                	test   %eax,%eax
+  800a13:	74 f7                	je     800a0c <devcons_read+0x33>
+    if (c < 0) return c;
+  800a15:	48 63 d0             	movslq %eax,%rdx
+  800a18:	78 13                	js     800a2d <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  800a1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a1f:	83 f8 04             	cmp    $0x4,%eax
+  800a22:	74 09                	je     800a2d <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  800a24:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  800a28:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  800a2d:	48 89 d0             	mov    %rdx,%rax
+  800a30:	48 83 c4 08          	add    $0x8,%rsp
+  800a34:	5b                   	pop    %rbx
+  800a35:	41 5c                	pop    %r12
+  800a37:	41 5d                	pop    %r13
+  800a39:	5d                   	pop    %rbp
+  800a3a:	c3                   	ret
+  800a3b:	48 89 d0             	mov    %rdx,%rax
+  800a3e:	c3                   	ret
+
+0000000000800a3f <cputchar>:
+cputchar(int ch) {
+  800a3f:	55                   	push   %rbp
+  800a40:	48 89 e5             	mov    %rsp,%rbp
+  800a43:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  800a47:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  800a4b:	be 01 00 00 00       	mov    $0x1,%esi
+  800a50:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  800a54:	48 b8 e8 1b 80 00 00 	movabs $0x801be8,%rax
+  800a5b:	00 00 00 
+  800a5e:	ff d0                	call   *%rax
+}
+  800a60:	c9                   	leave
+  800a61:	c3                   	ret
+
+0000000000800a62 <getchar>:
+getchar(void) {
+  800a62:	55                   	push   %rbp
+  800a63:	48 89 e5             	mov    %rsp,%rbp
+  800a66:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  800a6a:	ba 01 00 00 00       	mov    $0x1,%edx
+  800a6f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  800a73:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a78:	48 b8 fe 28 80 00 00 	movabs $0x8028fe,%rax
+  800a7f:	00 00 00 
+  800a82:	ff d0                	call   *%rax
+  800a84:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  800a86:	85 c0                	test   %eax,%eax
+  800a88:	78 06                	js     800a90 <getchar+0x2e>
+  800a8a:	74 08                	je     800a94 <getchar+0x32>
+  800a8c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  800a90:	89 d0                	mov    %edx,%eax
+  800a92:	c9                   	leave
+  800a93:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  800a94:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  800a99:	eb f5                	jmp    800a90 <getchar+0x2e>
+
+0000000000800a9b <iscons>:
+iscons(int fdnum) {
+  800a9b:	55                   	push   %rbp
+  800a9c:	48 89 e5             	mov    %rsp,%rbp
+  800a9f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  800aa3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800aa7:	48 b8 1b 26 80 00 00 	movabs $0x80261b,%rax
+  800aae:	00 00 00 
+  800ab1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800ab3:	85 c0                	test   %eax,%eax
+  800ab5:	78 18                	js     800acf <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  800ab7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800abb:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800ac2:	00 00 00 
+  800ac5:	8b 00                	mov    (%rax),%eax
+  800ac7:	39 02                	cmp    %eax,(%rdx)
+  800ac9:	0f 94 c0             	sete   %al
+  800acc:	0f b6 c0             	movzbl %al,%eax
+}
+  800acf:	c9                   	leave
+  800ad0:	c3                   	ret
+
+0000000000800ad1 <opencons>:
+opencons(void) {
+  800ad1:	55                   	push   %rbp
+  800ad2:	48 89 e5             	mov    %rsp,%rbp
+  800ad5:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  800ad9:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  800add:	48 b8 bb 25 80 00 00 	movabs $0x8025bb,%rax
+  800ae4:	00 00 00 
+  800ae7:	ff d0                	call   *%rax
+  800ae9:	85 c0                	test   %eax,%eax
+  800aeb:	78 49                	js     800b36 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  800aed:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800af2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800af7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800afb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b00:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  800b07:	00 00 00 
+  800b0a:	ff d0                	call   *%rax
+  800b0c:	85 c0                	test   %eax,%eax
+  800b0e:	78 26                	js     800b36 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  800b10:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b14:	a1 00 50 80 00 00 00 	movabs 0x805000,%eax
+  800b1b:	00 00 
+  800b1d:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  800b1f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800b23:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800b2a:	48 b8 8d 25 80 00 00 	movabs $0x80258d,%rax
+  800b31:	00 00 00 
+  800b34:	ff d0                	call   *%rax
+}
+  800b36:	c9                   	leave
+  800b37:	c3                   	ret
+
+0000000000800b38 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800b38:	55                   	push   %rbp
+  800b39:	48 89 e5             	mov    %rsp,%rbp
+  800b3c:	41 56                	push   %r14
+  800b3e:	41 55                	push   %r13
+  800b40:	41 54                	push   %r12
+  800b42:	53                   	push   %rbx
+  800b43:	41 89 fd             	mov    %edi,%r13d
+  800b46:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800b49:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  800b50:	00 00 00 
+  800b53:	48 b8 b8 50 80 00 00 	movabs $0x8050b8,%rax
+  800b5a:	00 00 00 
+  800b5d:	48 39 c2             	cmp    %rax,%rdx
+  800b60:	73 17                	jae    800b79 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800b62:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800b65:	49 89 c4             	mov    %rax,%r12
+  800b68:	48 83 c3 08          	add    $0x8,%rbx
+  800b6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b71:	ff 53 f8             	call   *-0x8(%rbx)
+  800b74:	4c 39 e3             	cmp    %r12,%rbx
+  800b77:	72 ef                	jb     800b68 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800b79:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  800b80:	00 00 00 
+  800b83:	ff d0                	call   *%rax
+  800b85:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800b88:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800b8f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800b96:	00 00 00 
+  800b99:	48 01 d0             	add    %rdx,%rax
+  800b9c:	48 a3 18 60 80 00 00 	movabs %rax,0x806018
+  800ba3:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800ba6:	45 85 ed             	test   %r13d,%r13d
+  800ba9:	7e 0d                	jle    800bb8 <libmain+0x80>
+  800bab:	49 8b 06             	mov    (%r14),%rax
+  800bae:	48 a3 38 50 80 00 00 	movabs %rax,0x805038
+  800bb5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800bb8:	4c 89 f6             	mov    %r14,%rsi
+  800bbb:	44 89 ef             	mov    %r13d,%edi
+  800bbe:	48 b8 ee 06 80 00 00 	movabs $0x8006ee,%rax
+  800bc5:	00 00 00 
+  800bc8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800bca:	48 b8 df 0b 80 00 00 	movabs $0x800bdf,%rax
+  800bd1:	00 00 00 
+  800bd4:	ff d0                	call   *%rax
+#endif
+}
+  800bd6:	5b                   	pop    %rbx
+  800bd7:	41 5c                	pop    %r12
+  800bd9:	41 5d                	pop    %r13
+  800bdb:	41 5e                	pop    %r14
+  800bdd:	5d                   	pop    %rbp
+  800bde:	c3                   	ret
+
+0000000000800bdf <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800bdf:	55                   	push   %rbp
+  800be0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800be3:	48 b8 b3 27 80 00 00 	movabs $0x8027b3,%rax
+  800bea:	00 00 00 
+  800bed:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800bef:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bf4:	48 b8 46 1c 80 00 00 	movabs $0x801c46,%rax
+  800bfb:	00 00 00 
+  800bfe:	ff d0                	call   *%rax
+}
+  800c00:	5d                   	pop    %rbp
+  800c01:	c3                   	ret
+
+0000000000800c02 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800c02:	55                   	push   %rbp
+  800c03:	48 89 e5             	mov    %rsp,%rbp
+  800c06:	41 56                	push   %r14
+  800c08:	41 55                	push   %r13
+  800c0a:	41 54                	push   %r12
+  800c0c:	53                   	push   %rbx
+  800c0d:	48 83 ec 50          	sub    $0x50,%rsp
+  800c11:	49 89 fc             	mov    %rdi,%r12
+  800c14:	41 89 f5             	mov    %esi,%r13d
+  800c17:	48 89 d3             	mov    %rdx,%rbx
+  800c1a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800c1e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800c22:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c26:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800c2d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c31:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800c35:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800c39:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800c3d:	48 b8 38 50 80 00 00 	movabs $0x805038,%rax
+  800c44:	00 00 00 
+  800c47:	4c 8b 30             	mov    (%rax),%r14
+  800c4a:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  800c51:	00 00 00 
+  800c54:	ff d0                	call   *%rax
+  800c56:	89 c6                	mov    %eax,%esi
+  800c58:	45 89 e8             	mov    %r13d,%r8d
+  800c5b:	4c 89 e1             	mov    %r12,%rcx
+  800c5e:	4c 89 f2             	mov    %r14,%rdx
+  800c61:	48 bf e0 43 80 00 00 	movabs $0x8043e0,%rdi
+  800c68:	00 00 00 
+  800c6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c70:	49 bc 52 0d 80 00 00 	movabs $0x800d52,%r12
+  800c77:	00 00 00 
+  800c7a:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800c7d:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800c81:	48 89 df             	mov    %rbx,%rdi
+  800c84:	48 b8 ee 0c 80 00 00 	movabs $0x800cee,%rax
+  800c8b:	00 00 00 
+  800c8e:	ff d0                	call   *%rax
+    cprintf("\n");
+  800c90:	48 bf 5b 42 80 00 00 	movabs $0x80425b,%rdi
+  800c97:	00 00 00 
+  800c9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c9f:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800ca2:	cc                   	int3
+  800ca3:	eb fd                	jmp    800ca2 <_panic+0xa0>
+
+0000000000800ca5 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800ca5:	55                   	push   %rbp
+  800ca6:	48 89 e5             	mov    %rsp,%rbp
+  800ca9:	53                   	push   %rbx
+  800caa:	48 83 ec 08          	sub    $0x8,%rsp
+  800cae:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800cb1:	8b 06                	mov    (%rsi),%eax
+  800cb3:	8d 50 01             	lea    0x1(%rax),%edx
+  800cb6:	89 16                	mov    %edx,(%rsi)
+  800cb8:	48 98                	cltq
+  800cba:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800cbf:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800cc5:	74 0a                	je     800cd1 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800cc7:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800ccb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ccf:	c9                   	leave
+  800cd0:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800cd1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800cd5:	be ff 00 00 00       	mov    $0xff,%esi
+  800cda:	48 b8 e8 1b 80 00 00 	movabs $0x801be8,%rax
+  800ce1:	00 00 00 
+  800ce4:	ff d0                	call   *%rax
+        state->offset = 0;
+  800ce6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800cec:	eb d9                	jmp    800cc7 <putch+0x22>
+
+0000000000800cee <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800cee:	55                   	push   %rbp
+  800cef:	48 89 e5             	mov    %rsp,%rbp
+  800cf2:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800cf9:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800cfc:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800d03:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800d08:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d0d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800d10:	48 89 f1             	mov    %rsi,%rcx
+  800d13:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800d1a:	48 bf a5 0c 80 00 00 	movabs $0x800ca5,%rdi
+  800d21:	00 00 00 
+  800d24:	48 b8 a2 0e 80 00 00 	movabs $0x800ea2,%rax
+  800d2b:	00 00 00 
+  800d2e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800d30:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800d37:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800d3e:	48 b8 e8 1b 80 00 00 	movabs $0x801be8,%rax
+  800d45:	00 00 00 
+  800d48:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800d4a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800d50:	c9                   	leave
+  800d51:	c3                   	ret
+
+0000000000800d52 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800d52:	55                   	push   %rbp
+  800d53:	48 89 e5             	mov    %rsp,%rbp
+  800d56:	48 83 ec 50          	sub    $0x50,%rsp
+  800d5a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800d5e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800d62:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d66:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d6a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800d6e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800d75:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d7d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d81:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800d85:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800d89:	48 b8 ee 0c 80 00 00 	movabs $0x800cee,%rax
+  800d90:	00 00 00 
+  800d93:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800d95:	c9                   	leave
+  800d96:	c3                   	ret
+
+0000000000800d97 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800d97:	55                   	push   %rbp
+  800d98:	48 89 e5             	mov    %rsp,%rbp
+  800d9b:	41 57                	push   %r15
+  800d9d:	41 56                	push   %r14
+  800d9f:	41 55                	push   %r13
+  800da1:	41 54                	push   %r12
+  800da3:	53                   	push   %rbx
+  800da4:	48 83 ec 18          	sub    $0x18,%rsp
+  800da8:	49 89 fc             	mov    %rdi,%r12
+  800dab:	49 89 f5             	mov    %rsi,%r13
+  800dae:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800db2:	8b 45 10             	mov    0x10(%rbp),%eax
+  800db5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800db8:	41 89 cf             	mov    %ecx,%r15d
+  800dbb:	4c 39 fa             	cmp    %r15,%rdx
+  800dbe:	73 5b                	jae    800e1b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800dc0:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800dc4:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800dc8:	85 db                	test   %ebx,%ebx
+  800dca:	7e 0e                	jle    800dda <print_num+0x43>
+            putch(padc, put_arg);
+  800dcc:	4c 89 ee             	mov    %r13,%rsi
+  800dcf:	44 89 f7             	mov    %r14d,%edi
+  800dd2:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800dd5:	83 eb 01             	sub    $0x1,%ebx
+  800dd8:	75 f2                	jne    800dcc <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800dda:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800dde:	48 b9 14 44 80 00 00 	movabs $0x804414,%rcx
+  800de5:	00 00 00 
+  800de8:	48 b8 03 44 80 00 00 	movabs $0x804403,%rax
+  800def:	00 00 00 
+  800df2:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800df6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800dfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dff:	49 f7 f7             	div    %r15
+  800e02:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800e06:	4c 89 ee             	mov    %r13,%rsi
+  800e09:	41 ff d4             	call   *%r12
+}
+  800e0c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e10:	5b                   	pop    %rbx
+  800e11:	41 5c                	pop    %r12
+  800e13:	41 5d                	pop    %r13
+  800e15:	41 5e                	pop    %r14
+  800e17:	41 5f                	pop    %r15
+  800e19:	5d                   	pop    %rbp
+  800e1a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800e1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e24:	49 f7 f7             	div    %r15
+  800e27:	48 83 ec 08          	sub    $0x8,%rsp
+  800e2b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800e2f:	52                   	push   %rdx
+  800e30:	45 0f be c9          	movsbl %r9b,%r9d
+  800e34:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800e38:	48 89 c2             	mov    %rax,%rdx
+  800e3b:	48 b8 97 0d 80 00 00 	movabs $0x800d97,%rax
+  800e42:	00 00 00 
+  800e45:	ff d0                	call   *%rax
+  800e47:	48 83 c4 10          	add    $0x10,%rsp
+  800e4b:	eb 8d                	jmp    800dda <print_num+0x43>
+
+0000000000800e4d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800e4d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800e51:	48 8b 06             	mov    (%rsi),%rax
+  800e54:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800e58:	73 0a                	jae    800e64 <sprintputch+0x17>
+        *state->start++ = ch;
+  800e5a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800e5e:	48 89 16             	mov    %rdx,(%rsi)
+  800e61:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800e64:	c3                   	ret
+
+0000000000800e65 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800e65:	55                   	push   %rbp
+  800e66:	48 89 e5             	mov    %rsp,%rbp
+  800e69:	48 83 ec 50          	sub    $0x50,%rsp
+  800e6d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e71:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e75:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800e79:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e80:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e88:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e8c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800e90:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e94:	48 b8 a2 0e 80 00 00 	movabs $0x800ea2,%rax
+  800e9b:	00 00 00 
+  800e9e:	ff d0                	call   *%rax
+}
+  800ea0:	c9                   	leave
+  800ea1:	c3                   	ret
+
+0000000000800ea2 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800ea2:	55                   	push   %rbp
+  800ea3:	48 89 e5             	mov    %rsp,%rbp
+  800ea6:	41 57                	push   %r15
+  800ea8:	41 56                	push   %r14
+  800eaa:	41 55                	push   %r13
+  800eac:	41 54                	push   %r12
+  800eae:	53                   	push   %rbx
+  800eaf:	48 83 ec 38          	sub    $0x38,%rsp
+  800eb3:	49 89 fe             	mov    %rdi,%r14
+  800eb6:	49 89 f5             	mov    %rsi,%r13
+  800eb9:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800ebc:	48 8b 01             	mov    (%rcx),%rax
+  800ebf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800ec3:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800ec7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ecb:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800ecf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800ed3:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800ed7:	0f b6 3b             	movzbl (%rbx),%edi
+  800eda:	40 80 ff 25          	cmp    $0x25,%dil
+  800ede:	74 18                	je     800ef8 <vprintfmt+0x56>
+            if (!ch) return;
+  800ee0:	40 84 ff             	test   %dil,%dil
+  800ee3:	0f 84 b1 06 00 00    	je     80159a <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800ee9:	40 0f b6 ff          	movzbl %dil,%edi
+  800eed:	4c 89 ee             	mov    %r13,%rsi
+  800ef0:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800ef3:	4c 89 e3             	mov    %r12,%rbx
+  800ef6:	eb db                	jmp    800ed3 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800ef8:	be 00 00 00 00       	mov    $0x0,%esi
+  800efd:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800f01:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800f06:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800f0c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800f13:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800f17:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800f1c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800f21:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800f24:	83 e8 23             	sub    $0x23,%eax
+  800f27:	3c 57                	cmp    $0x57,%al
+  800f29:	0f 87 51 06 00 00    	ja     801580 <vprintfmt+0x6de>
+  800f2f:	0f b6 c0             	movzbl %al,%eax
+  800f32:	48 b9 c0 45 80 00 00 	movabs $0x8045c0,%rcx
+  800f39:	00 00 00 
+  800f3c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800f3f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800f42:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800f46:	eb cf                	jmp    800f17 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800f48:	49 89 dc             	mov    %rbx,%r12
+  800f4b:	be 01 00 00 00       	mov    $0x1,%esi
+  800f50:	eb c5                	jmp    800f17 <vprintfmt+0x75>
+            padc = ch;
+  800f52:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800f56:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800f59:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800f5c:	eb b9                	jmp    800f17 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800f5e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f61:	83 f8 2f             	cmp    $0x2f,%eax
+  800f64:	77 24                	ja     800f8a <vprintfmt+0xe8>
+  800f66:	89 c1                	mov    %eax,%ecx
+  800f68:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800f6c:	83 c0 08             	add    $0x8,%eax
+  800f6f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f72:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800f75:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800f78:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800f7c:	79 99                	jns    800f17 <vprintfmt+0x75>
+                width = precision;
+  800f7e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800f82:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800f88:	eb 8d                	jmp    800f17 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800f8a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800f8e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800f92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f96:	eb da                	jmp    800f72 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800f98:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800f9d:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800fa1:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800fa7:	3c 39                	cmp    $0x39,%al
+  800fa9:	77 1c                	ja     800fc7 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800fab:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800faf:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800fb3:	0f b6 c0             	movzbl %al,%eax
+  800fb6:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800fbb:	0f b6 03             	movzbl (%rbx),%eax
+  800fbe:	3c 39                	cmp    $0x39,%al
+  800fc0:	76 e9                	jbe    800fab <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800fc2:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800fc5:	eb b1                	jmp    800f78 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800fc7:	49 89 dc             	mov    %rbx,%r12
+  800fca:	eb ac                	jmp    800f78 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800fcc:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800fcf:	85 c9                	test   %ecx,%ecx
+  800fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd6:	0f 49 c1             	cmovns %ecx,%eax
+  800fd9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800fdc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800fdf:	e9 33 ff ff ff       	jmp    800f17 <vprintfmt+0x75>
+            lflag++;
+  800fe4:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800fe7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800fea:	e9 28 ff ff ff       	jmp    800f17 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800fef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ff2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ff5:	77 19                	ja     801010 <vprintfmt+0x16e>
+  800ff7:	89 c2                	mov    %eax,%edx
+  800ff9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ffd:	83 c0 08             	add    $0x8,%eax
+  801000:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801003:	8b 3a                	mov    (%rdx),%edi
+  801005:	4c 89 ee             	mov    %r13,%rsi
+  801008:	41 ff d6             	call   *%r14
+            break;
+  80100b:	e9 c3 fe ff ff       	jmp    800ed3 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  801010:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801014:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801018:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80101c:	eb e5                	jmp    801003 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80101e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801021:	83 f8 2f             	cmp    $0x2f,%eax
+  801024:	77 5a                	ja     801080 <vprintfmt+0x1de>
+  801026:	89 c2                	mov    %eax,%edx
+  801028:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80102c:	83 c0 08             	add    $0x8,%eax
+  80102f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801032:	8b 02                	mov    (%rdx),%eax
+  801034:	89 c1                	mov    %eax,%ecx
+  801036:	f7 d9                	neg    %ecx
+  801038:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80103b:	83 f9 15             	cmp    $0x15,%ecx
+  80103e:	7f 4e                	jg     80108e <vprintfmt+0x1ec>
+  801040:	48 63 c1             	movslq %ecx,%rax
+  801043:	48 ba 80 48 80 00 00 	movabs $0x804880,%rdx
+  80104a:	00 00 00 
+  80104d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801051:	48 85 c0             	test   %rax,%rax
+  801054:	74 38                	je     80108e <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801056:	48 89 c1             	mov    %rax,%rcx
+  801059:	48 ba 10 43 80 00 00 	movabs $0x804310,%rdx
+  801060:	00 00 00 
+  801063:	4c 89 ee             	mov    %r13,%rsi
+  801066:	4c 89 f7             	mov    %r14,%rdi
+  801069:	b8 00 00 00 00       	mov    $0x0,%eax
+  80106e:	49 b8 65 0e 80 00 00 	movabs $0x800e65,%r8
+  801075:	00 00 00 
+  801078:	41 ff d0             	call   *%r8
+  80107b:	e9 53 fe ff ff       	jmp    800ed3 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801080:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801084:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801088:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80108c:	eb a4                	jmp    801032 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80108e:	48 ba 2c 44 80 00 00 	movabs $0x80442c,%rdx
+  801095:	00 00 00 
+  801098:	4c 89 ee             	mov    %r13,%rsi
+  80109b:	4c 89 f7             	mov    %r14,%rdi
+  80109e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a3:	49 b8 65 0e 80 00 00 	movabs $0x800e65,%r8
+  8010aa:	00 00 00 
+  8010ad:	41 ff d0             	call   *%r8
+  8010b0:	e9 1e fe ff ff       	jmp    800ed3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8010b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8010bb:	77 6c                	ja     801129 <vprintfmt+0x287>
+  8010bd:	89 c2                	mov    %eax,%edx
+  8010bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010c3:	83 c0 08             	add    $0x8,%eax
+  8010c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010c9:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8010cc:	48 85 d2             	test   %rdx,%rdx
+  8010cf:	48 b8 25 44 80 00 00 	movabs $0x804425,%rax
+  8010d6:	00 00 00 
+  8010d9:	48 0f 45 c2          	cmovne %rdx,%rax
+  8010dd:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8010e1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8010e5:	7e 06                	jle    8010ed <vprintfmt+0x24b>
+  8010e7:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8010eb:	75 4a                	jne    801137 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8010ed:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8010f1:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8010f5:	0f b6 00             	movzbl (%rax),%eax
+  8010f8:	84 c0                	test   %al,%al
+  8010fa:	0f 85 9a 00 00 00    	jne    80119a <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  801100:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801103:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801107:	85 c0                	test   %eax,%eax
+  801109:	0f 8e c4 fd ff ff    	jle    800ed3 <vprintfmt+0x31>
+  80110f:	4c 89 ee             	mov    %r13,%rsi
+  801112:	bf 20 00 00 00       	mov    $0x20,%edi
+  801117:	41 ff d6             	call   *%r14
+  80111a:	41 83 ec 01          	sub    $0x1,%r12d
+  80111e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801122:	75 eb                	jne    80110f <vprintfmt+0x26d>
+  801124:	e9 aa fd ff ff       	jmp    800ed3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801129:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80112d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801131:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801135:	eb 92                	jmp    8010c9 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  801137:	49 63 f7             	movslq %r15d,%rsi
+  80113a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80113e:	48 b8 54 16 80 00 00 	movabs $0x801654,%rax
+  801145:	00 00 00 
+  801148:	ff d0                	call   *%rax
+  80114a:	48 89 c2             	mov    %rax,%rdx
+  80114d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801150:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801152:	8d 70 ff             	lea    -0x1(%rax),%esi
+  801155:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  801158:	85 c0                	test   %eax,%eax
+  80115a:	7e 91                	jle    8010ed <vprintfmt+0x24b>
+  80115c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801161:	4c 89 ee             	mov    %r13,%rsi
+  801164:	44 89 e7             	mov    %r12d,%edi
+  801167:	41 ff d6             	call   *%r14
+  80116a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80116e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801171:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801174:	75 eb                	jne    801161 <vprintfmt+0x2bf>
+  801176:	e9 72 ff ff ff       	jmp    8010ed <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80117b:	0f b6 f8             	movzbl %al,%edi
+  80117e:	4c 89 ee             	mov    %r13,%rsi
+  801181:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801184:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801188:	49 83 c4 01          	add    $0x1,%r12
+  80118c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801192:	84 c0                	test   %al,%al
+  801194:	0f 84 66 ff ff ff    	je     801100 <vprintfmt+0x25e>
+  80119a:	45 85 ff             	test   %r15d,%r15d
+  80119d:	78 0a                	js     8011a9 <vprintfmt+0x307>
+  80119f:	41 83 ef 01          	sub    $0x1,%r15d
+  8011a3:	0f 88 57 ff ff ff    	js     801100 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8011a9:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8011ad:	74 cc                	je     80117b <vprintfmt+0x2d9>
+  8011af:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8011b2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8011b7:	80 fa 5e             	cmp    $0x5e,%dl
+  8011ba:	77 c2                	ja     80117e <vprintfmt+0x2dc>
+  8011bc:	eb bd                	jmp    80117b <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8011be:	40 84 f6             	test   %sil,%sil
+  8011c1:	75 26                	jne    8011e9 <vprintfmt+0x347>
+    switch (lflag) {
+  8011c3:	85 d2                	test   %edx,%edx
+  8011c5:	74 59                	je     801220 <vprintfmt+0x37e>
+  8011c7:	83 fa 01             	cmp    $0x1,%edx
+  8011ca:	74 7b                	je     801247 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8011cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8011d2:	0f 87 96 00 00 00    	ja     80126e <vprintfmt+0x3cc>
+  8011d8:	89 c2                	mov    %eax,%edx
+  8011da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011de:	83 c0 08             	add    $0x8,%eax
+  8011e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011e4:	4c 8b 22             	mov    (%rdx),%r12
+  8011e7:	eb 17                	jmp    801200 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8011e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8011ef:	77 21                	ja     801212 <vprintfmt+0x370>
+  8011f1:	89 c2                	mov    %eax,%edx
+  8011f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011f7:	83 c0 08             	add    $0x8,%eax
+  8011fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011fd:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801200:	4d 85 e4             	test   %r12,%r12
+  801203:	78 7a                	js     80127f <vprintfmt+0x3dd>
+            num = i;
+  801205:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801208:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80120d:	e9 50 02 00 00       	jmp    801462 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801212:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801216:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80121a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80121e:	eb dd                	jmp    8011fd <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  801220:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801223:	83 f8 2f             	cmp    $0x2f,%eax
+  801226:	77 11                	ja     801239 <vprintfmt+0x397>
+  801228:	89 c2                	mov    %eax,%edx
+  80122a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80122e:	83 c0 08             	add    $0x8,%eax
+  801231:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801234:	4c 63 22             	movslq (%rdx),%r12
+  801237:	eb c7                	jmp    801200 <vprintfmt+0x35e>
+  801239:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80123d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801241:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801245:	eb ed                	jmp    801234 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  801247:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80124a:	83 f8 2f             	cmp    $0x2f,%eax
+  80124d:	77 11                	ja     801260 <vprintfmt+0x3be>
+  80124f:	89 c2                	mov    %eax,%edx
+  801251:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801255:	83 c0 08             	add    $0x8,%eax
+  801258:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80125b:	4c 8b 22             	mov    (%rdx),%r12
+  80125e:	eb a0                	jmp    801200 <vprintfmt+0x35e>
+  801260:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801264:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801268:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80126c:	eb ed                	jmp    80125b <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80126e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801272:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801276:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80127a:	e9 65 ff ff ff       	jmp    8011e4 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80127f:	4c 89 ee             	mov    %r13,%rsi
+  801282:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801287:	41 ff d6             	call   *%r14
+                i = -i;
+  80128a:	49 f7 dc             	neg    %r12
+  80128d:	e9 73 ff ff ff       	jmp    801205 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  801292:	40 84 f6             	test   %sil,%sil
+  801295:	75 32                	jne    8012c9 <vprintfmt+0x427>
+    switch (lflag) {
+  801297:	85 d2                	test   %edx,%edx
+  801299:	74 5d                	je     8012f8 <vprintfmt+0x456>
+  80129b:	83 fa 01             	cmp    $0x1,%edx
+  80129e:	0f 84 82 00 00 00    	je     801326 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8012a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8012aa:	0f 87 a5 00 00 00    	ja     801355 <vprintfmt+0x4b3>
+  8012b0:	89 c2                	mov    %eax,%edx
+  8012b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012b6:	83 c0 08             	add    $0x8,%eax
+  8012b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012bc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8012bf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8012c4:	e9 99 01 00 00       	jmp    801462 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8012c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8012cf:	77 19                	ja     8012ea <vprintfmt+0x448>
+  8012d1:	89 c2                	mov    %eax,%edx
+  8012d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012d7:	83 c0 08             	add    $0x8,%eax
+  8012da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012dd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8012e0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8012e5:	e9 78 01 00 00       	jmp    801462 <vprintfmt+0x5c0>
+  8012ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012f6:	eb e5                	jmp    8012dd <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8012f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8012fe:	77 18                	ja     801318 <vprintfmt+0x476>
+  801300:	89 c2                	mov    %eax,%edx
+  801302:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801306:	83 c0 08             	add    $0x8,%eax
+  801309:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80130c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80130e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801313:	e9 4a 01 00 00       	jmp    801462 <vprintfmt+0x5c0>
+  801318:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80131c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801320:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801324:	eb e6                	jmp    80130c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  801326:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801329:	83 f8 2f             	cmp    $0x2f,%eax
+  80132c:	77 19                	ja     801347 <vprintfmt+0x4a5>
+  80132e:	89 c2                	mov    %eax,%edx
+  801330:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801334:	83 c0 08             	add    $0x8,%eax
+  801337:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80133a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80133d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801342:	e9 1b 01 00 00       	jmp    801462 <vprintfmt+0x5c0>
+  801347:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80134b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80134f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801353:	eb e5                	jmp    80133a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  801355:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801359:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80135d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801361:	e9 56 ff ff ff       	jmp    8012bc <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  801366:	40 84 f6             	test   %sil,%sil
+  801369:	75 2e                	jne    801399 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80136b:	85 d2                	test   %edx,%edx
+  80136d:	74 59                	je     8013c8 <vprintfmt+0x526>
+  80136f:	83 fa 01             	cmp    $0x1,%edx
+  801372:	74 7f                	je     8013f3 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  801374:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801377:	83 f8 2f             	cmp    $0x2f,%eax
+  80137a:	0f 87 9f 00 00 00    	ja     80141f <vprintfmt+0x57d>
+  801380:	89 c2                	mov    %eax,%edx
+  801382:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801386:	83 c0 08             	add    $0x8,%eax
+  801389:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80138c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80138f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801394:	e9 c9 00 00 00       	jmp    801462 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801399:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80139c:	83 f8 2f             	cmp    $0x2f,%eax
+  80139f:	77 19                	ja     8013ba <vprintfmt+0x518>
+  8013a1:	89 c2                	mov    %eax,%edx
+  8013a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013a7:	83 c0 08             	add    $0x8,%eax
+  8013aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013ad:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8013b0:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8013b5:	e9 a8 00 00 00       	jmp    801462 <vprintfmt+0x5c0>
+  8013ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013c6:	eb e5                	jmp    8013ad <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8013c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8013ce:	77 15                	ja     8013e5 <vprintfmt+0x543>
+  8013d0:	89 c2                	mov    %eax,%edx
+  8013d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013d6:	83 c0 08             	add    $0x8,%eax
+  8013d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013dc:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8013de:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8013e3:	eb 7d                	jmp    801462 <vprintfmt+0x5c0>
+  8013e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013f1:	eb e9                	jmp    8013dc <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8013f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8013f9:	77 16                	ja     801411 <vprintfmt+0x56f>
+  8013fb:	89 c2                	mov    %eax,%edx
+  8013fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801401:	83 c0 08             	add    $0x8,%eax
+  801404:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801407:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80140a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80140f:	eb 51                	jmp    801462 <vprintfmt+0x5c0>
+  801411:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801415:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801419:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80141d:	eb e8                	jmp    801407 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80141f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801423:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801427:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80142b:	e9 5c ff ff ff       	jmp    80138c <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  801430:	4c 89 ee             	mov    %r13,%rsi
+  801433:	bf 30 00 00 00       	mov    $0x30,%edi
+  801438:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80143b:	4c 89 ee             	mov    %r13,%rsi
+  80143e:	bf 78 00 00 00       	mov    $0x78,%edi
+  801443:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801446:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801449:	83 f8 2f             	cmp    $0x2f,%eax
+  80144c:	77 47                	ja     801495 <vprintfmt+0x5f3>
+  80144e:	89 c2                	mov    %eax,%edx
+  801450:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801454:	83 c0 08             	add    $0x8,%eax
+  801457:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80145a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80145d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801462:	48 83 ec 08          	sub    $0x8,%rsp
+  801466:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80146a:	0f 94 c0             	sete   %al
+  80146d:	0f b6 c0             	movzbl %al,%eax
+  801470:	50                   	push   %rax
+  801471:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801476:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80147a:	4c 89 ee             	mov    %r13,%rsi
+  80147d:	4c 89 f7             	mov    %r14,%rdi
+  801480:	48 b8 97 0d 80 00 00 	movabs $0x800d97,%rax
+  801487:	00 00 00 
+  80148a:	ff d0                	call   *%rax
+            break;
+  80148c:	48 83 c4 10          	add    $0x10,%rsp
+  801490:	e9 3e fa ff ff       	jmp    800ed3 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  801495:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801499:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80149d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014a1:	eb b7                	jmp    80145a <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8014a3:	40 84 f6             	test   %sil,%sil
+  8014a6:	75 2b                	jne    8014d3 <vprintfmt+0x631>
+    switch (lflag) {
+  8014a8:	85 d2                	test   %edx,%edx
+  8014aa:	74 56                	je     801502 <vprintfmt+0x660>
+  8014ac:	83 fa 01             	cmp    $0x1,%edx
+  8014af:	74 7f                	je     801530 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8014b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8014b7:	0f 87 a2 00 00 00    	ja     80155f <vprintfmt+0x6bd>
+  8014bd:	89 c2                	mov    %eax,%edx
+  8014bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014c3:	83 c0 08             	add    $0x8,%eax
+  8014c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014c9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8014cc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8014d1:	eb 8f                	jmp    801462 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8014d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8014d9:	77 19                	ja     8014f4 <vprintfmt+0x652>
+  8014db:	89 c2                	mov    %eax,%edx
+  8014dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014e1:	83 c0 08             	add    $0x8,%eax
+  8014e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014e7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8014ea:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8014ef:	e9 6e ff ff ff       	jmp    801462 <vprintfmt+0x5c0>
+  8014f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801500:	eb e5                	jmp    8014e7 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  801502:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801505:	83 f8 2f             	cmp    $0x2f,%eax
+  801508:	77 18                	ja     801522 <vprintfmt+0x680>
+  80150a:	89 c2                	mov    %eax,%edx
+  80150c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801510:	83 c0 08             	add    $0x8,%eax
+  801513:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801516:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801518:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80151d:	e9 40 ff ff ff       	jmp    801462 <vprintfmt+0x5c0>
+  801522:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801526:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80152a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80152e:	eb e6                	jmp    801516 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  801530:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801533:	83 f8 2f             	cmp    $0x2f,%eax
+  801536:	77 19                	ja     801551 <vprintfmt+0x6af>
+  801538:	89 c2                	mov    %eax,%edx
+  80153a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80153e:	83 c0 08             	add    $0x8,%eax
+  801541:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801544:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801547:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80154c:	e9 11 ff ff ff       	jmp    801462 <vprintfmt+0x5c0>
+  801551:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801555:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801559:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80155d:	eb e5                	jmp    801544 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80155f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801563:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801567:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80156b:	e9 59 ff ff ff       	jmp    8014c9 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  801570:	4c 89 ee             	mov    %r13,%rsi
+  801573:	bf 25 00 00 00       	mov    $0x25,%edi
+  801578:	41 ff d6             	call   *%r14
+            break;
+  80157b:	e9 53 f9 ff ff       	jmp    800ed3 <vprintfmt+0x31>
+            putch('%', put_arg);
+  801580:	4c 89 ee             	mov    %r13,%rsi
+  801583:	bf 25 00 00 00       	mov    $0x25,%edi
+  801588:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80158b:	48 83 eb 01          	sub    $0x1,%rbx
+  80158f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801593:	75 f6                	jne    80158b <vprintfmt+0x6e9>
+  801595:	e9 39 f9 ff ff       	jmp    800ed3 <vprintfmt+0x31>
+}
+  80159a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80159e:	5b                   	pop    %rbx
+  80159f:	41 5c                	pop    %r12
+  8015a1:	41 5d                	pop    %r13
+  8015a3:	41 5e                	pop    %r14
+  8015a5:	41 5f                	pop    %r15
+  8015a7:	5d                   	pop    %rbp
+  8015a8:	c3                   	ret
+
+00000000008015a9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8015a9:	55                   	push   %rbp
+  8015aa:	48 89 e5             	mov    %rsp,%rbp
+  8015ad:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8015b1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015b5:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8015ba:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8015be:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8015c5:	48 85 ff             	test   %rdi,%rdi
+  8015c8:	74 2b                	je     8015f5 <vsnprintf+0x4c>
+  8015ca:	48 85 f6             	test   %rsi,%rsi
+  8015cd:	74 26                	je     8015f5 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8015cf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8015d3:	48 bf 4d 0e 80 00 00 	movabs $0x800e4d,%rdi
+  8015da:	00 00 00 
+  8015dd:	48 b8 a2 0e 80 00 00 	movabs $0x800ea2,%rax
+  8015e4:	00 00 00 
+  8015e7:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8015e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015ed:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8015f0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8015f3:	c9                   	leave
+  8015f4:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8015f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015fa:	eb f7                	jmp    8015f3 <vsnprintf+0x4a>
+
+00000000008015fc <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8015fc:	55                   	push   %rbp
+  8015fd:	48 89 e5             	mov    %rsp,%rbp
+  801600:	48 83 ec 50          	sub    $0x50,%rsp
+  801604:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801608:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80160c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801610:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801617:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80161b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80161f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801623:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801627:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80162b:	48 b8 a9 15 80 00 00 	movabs $0x8015a9,%rax
+  801632:	00 00 00 
+  801635:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801637:	c9                   	leave
+  801638:	c3                   	ret
+
+0000000000801639 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801639:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80163c:	74 10                	je     80164e <strlen+0x15>
+    size_t n = 0;
+  80163e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801643:	48 83 c0 01          	add    $0x1,%rax
+  801647:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80164b:	75 f6                	jne    801643 <strlen+0xa>
+  80164d:	c3                   	ret
+    size_t n = 0;
+  80164e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801653:	c3                   	ret
+
+0000000000801654 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801654:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801657:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80165c:	48 85 f6             	test   %rsi,%rsi
+  80165f:	74 11                	je     801672 <strnlen+0x1e>
+  801661:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801665:	74 0c                	je     801673 <strnlen+0x1f>
+  801667:	48 83 c2 01          	add    $0x1,%rdx
+  80166b:	48 39 d0             	cmp    %rdx,%rax
+  80166e:	75 f1                	jne    801661 <strnlen+0xd>
+  801670:	eb 04                	jmp    801676 <strnlen+0x22>
+  801672:	c3                   	ret
+  801673:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801676:	c3                   	ret
+
+0000000000801677 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801677:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80167a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80167f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801683:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801686:	48 83 c2 01          	add    $0x1,%rdx
+  80168a:	84 c9                	test   %cl,%cl
+  80168c:	75 f1                	jne    80167f <strcpy+0x8>
+        ;
+    return res;
+}
+  80168e:	c3                   	ret
+
+000000000080168f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80168f:	55                   	push   %rbp
+  801690:	48 89 e5             	mov    %rsp,%rbp
+  801693:	41 54                	push   %r12
+  801695:	53                   	push   %rbx
+  801696:	48 89 fb             	mov    %rdi,%rbx
+  801699:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80169c:	48 b8 39 16 80 00 00 	movabs $0x801639,%rax
+  8016a3:	00 00 00 
+  8016a6:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8016a8:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8016ac:	4c 89 e6             	mov    %r12,%rsi
+  8016af:	48 b8 77 16 80 00 00 	movabs $0x801677,%rax
+  8016b6:	00 00 00 
+  8016b9:	ff d0                	call   *%rax
+    return dst;
+}
+  8016bb:	48 89 d8             	mov    %rbx,%rax
+  8016be:	5b                   	pop    %rbx
+  8016bf:	41 5c                	pop    %r12
+  8016c1:	5d                   	pop    %rbp
+  8016c2:	c3                   	ret
+
+00000000008016c3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8016c3:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8016c6:	48 85 d2             	test   %rdx,%rdx
+  8016c9:	74 1f                	je     8016ea <strncpy+0x27>
+  8016cb:	48 01 fa             	add    %rdi,%rdx
+  8016ce:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8016d1:	48 83 c1 01          	add    $0x1,%rcx
+  8016d5:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8016d9:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8016dd:	41 80 f8 01          	cmp    $0x1,%r8b
+  8016e1:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8016e5:	48 39 ca             	cmp    %rcx,%rdx
+  8016e8:	75 e7                	jne    8016d1 <strncpy+0xe>
+    }
+    return ret;
+}
+  8016ea:	c3                   	ret
+
+00000000008016eb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8016eb:	48 89 f8             	mov    %rdi,%rax
+  8016ee:	48 85 d2             	test   %rdx,%rdx
+  8016f1:	74 24                	je     801717 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8016f3:	48 83 ea 01          	sub    $0x1,%rdx
+  8016f7:	74 1b                	je     801714 <strlcpy+0x29>
+  8016f9:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8016fd:	0f b6 16             	movzbl (%rsi),%edx
+  801700:	84 d2                	test   %dl,%dl
+  801702:	74 10                	je     801714 <strlcpy+0x29>
+            *dst++ = *src++;
+  801704:	48 83 c6 01          	add    $0x1,%rsi
+  801708:	48 83 c0 01          	add    $0x1,%rax
+  80170c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80170f:	48 39 c8             	cmp    %rcx,%rax
+  801712:	75 e9                	jne    8016fd <strlcpy+0x12>
+        *dst = '\0';
+  801714:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801717:	48 29 f8             	sub    %rdi,%rax
+}
+  80171a:	c3                   	ret
+
+000000000080171b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80171b:	0f b6 07             	movzbl (%rdi),%eax
+  80171e:	84 c0                	test   %al,%al
+  801720:	74 13                	je     801735 <strcmp+0x1a>
+  801722:	38 06                	cmp    %al,(%rsi)
+  801724:	75 0f                	jne    801735 <strcmp+0x1a>
+  801726:	48 83 c7 01          	add    $0x1,%rdi
+  80172a:	48 83 c6 01          	add    $0x1,%rsi
+  80172e:	0f b6 07             	movzbl (%rdi),%eax
+  801731:	84 c0                	test   %al,%al
+  801733:	75 ed                	jne    801722 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801735:	0f b6 c0             	movzbl %al,%eax
+  801738:	0f b6 16             	movzbl (%rsi),%edx
+  80173b:	29 d0                	sub    %edx,%eax
+}
+  80173d:	c3                   	ret
+
+000000000080173e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80173e:	48 85 d2             	test   %rdx,%rdx
+  801741:	74 1f                	je     801762 <strncmp+0x24>
+  801743:	0f b6 07             	movzbl (%rdi),%eax
+  801746:	84 c0                	test   %al,%al
+  801748:	74 1e                	je     801768 <strncmp+0x2a>
+  80174a:	3a 06                	cmp    (%rsi),%al
+  80174c:	75 1a                	jne    801768 <strncmp+0x2a>
+  80174e:	48 83 c7 01          	add    $0x1,%rdi
+  801752:	48 83 c6 01          	add    $0x1,%rsi
+  801756:	48 83 ea 01          	sub    $0x1,%rdx
+  80175a:	75 e7                	jne    801743 <strncmp+0x5>
+
+    if (!n) return 0;
+  80175c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801761:	c3                   	ret
+  801762:	b8 00 00 00 00       	mov    $0x0,%eax
+  801767:	c3                   	ret
+  801768:	48 85 d2             	test   %rdx,%rdx
+  80176b:	74 09                	je     801776 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80176d:	0f b6 07             	movzbl (%rdi),%eax
+  801770:	0f b6 16             	movzbl (%rsi),%edx
+  801773:	29 d0                	sub    %edx,%eax
+  801775:	c3                   	ret
+    if (!n) return 0;
+  801776:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80177b:	c3                   	ret
+
+000000000080177c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80177c:	0f b6 17             	movzbl (%rdi),%edx
+  80177f:	84 d2                	test   %dl,%dl
+  801781:	74 18                	je     80179b <strchr+0x1f>
+        if (*str == c) {
+  801783:	0f be d2             	movsbl %dl,%edx
+  801786:	39 f2                	cmp    %esi,%edx
+  801788:	74 17                	je     8017a1 <strchr+0x25>
+    for (; *str; str++) {
+  80178a:	48 83 c7 01          	add    $0x1,%rdi
+  80178e:	0f b6 17             	movzbl (%rdi),%edx
+  801791:	84 d2                	test   %dl,%dl
+  801793:	75 ee                	jne    801783 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801795:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179a:	c3                   	ret
+  80179b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a0:	c3                   	ret
+  8017a1:	48 89 f8             	mov    %rdi,%rax
+}
+  8017a4:	c3                   	ret
+
+00000000008017a5 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8017a5:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8017a8:	0f b6 17             	movzbl (%rdi),%edx
+  8017ab:	84 d2                	test   %dl,%dl
+  8017ad:	74 13                	je     8017c2 <strfind+0x1d>
+  8017af:	0f be d2             	movsbl %dl,%edx
+  8017b2:	39 f2                	cmp    %esi,%edx
+  8017b4:	74 0b                	je     8017c1 <strfind+0x1c>
+  8017b6:	48 83 c0 01          	add    $0x1,%rax
+  8017ba:	0f b6 10             	movzbl (%rax),%edx
+  8017bd:	84 d2                	test   %dl,%dl
+  8017bf:	75 ee                	jne    8017af <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8017c1:	c3                   	ret
+  8017c2:	c3                   	ret
+
+00000000008017c3 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8017c3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8017c6:	48 89 f8             	mov    %rdi,%rax
+  8017c9:	48 f7 d8             	neg    %rax
+  8017cc:	83 e0 07             	and    $0x7,%eax
+  8017cf:	49 89 d1             	mov    %rdx,%r9
+  8017d2:	49 29 c1             	sub    %rax,%r9
+  8017d5:	78 36                	js     80180d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8017d7:	40 0f b6 c6          	movzbl %sil,%eax
+  8017db:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8017e2:	01 01 01 
+  8017e5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8017e9:	40 f6 c7 07          	test   $0x7,%dil
+  8017ed:	75 38                	jne    801827 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8017ef:	4c 89 c9             	mov    %r9,%rcx
+  8017f2:	48 c1 f9 03          	sar    $0x3,%rcx
+  8017f6:	74 0c                	je     801804 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8017f8:	fc                   	cld
+  8017f9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8017fc:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801800:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801804:	4d 85 c9             	test   %r9,%r9
+  801807:	75 45                	jne    80184e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801809:	4c 89 c0             	mov    %r8,%rax
+  80180c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80180d:	48 85 d2             	test   %rdx,%rdx
+  801810:	74 f7                	je     801809 <memset+0x46>
+  801812:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801815:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801818:	48 83 c0 01          	add    $0x1,%rax
+  80181c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801820:	48 39 c2             	cmp    %rax,%rdx
+  801823:	75 f3                	jne    801818 <memset+0x55>
+  801825:	eb e2                	jmp    801809 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801827:	40 f6 c7 01          	test   $0x1,%dil
+  80182b:	74 06                	je     801833 <memset+0x70>
+  80182d:	88 07                	mov    %al,(%rdi)
+  80182f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801833:	40 f6 c7 02          	test   $0x2,%dil
+  801837:	74 07                	je     801840 <memset+0x7d>
+  801839:	66 89 07             	mov    %ax,(%rdi)
+  80183c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801840:	40 f6 c7 04          	test   $0x4,%dil
+  801844:	74 a9                	je     8017ef <memset+0x2c>
+  801846:	89 07                	mov    %eax,(%rdi)
+  801848:	48 83 c7 04          	add    $0x4,%rdi
+  80184c:	eb a1                	jmp    8017ef <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80184e:	41 f6 c1 04          	test   $0x4,%r9b
+  801852:	74 06                	je     80185a <memset+0x97>
+  801854:	89 07                	mov    %eax,(%rdi)
+  801856:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80185a:	41 f6 c1 02          	test   $0x2,%r9b
+  80185e:	74 07                	je     801867 <memset+0xa4>
+  801860:	66 89 07             	mov    %ax,(%rdi)
+  801863:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801867:	41 f6 c1 01          	test   $0x1,%r9b
+  80186b:	74 9c                	je     801809 <memset+0x46>
+  80186d:	88 07                	mov    %al,(%rdi)
+  80186f:	eb 98                	jmp    801809 <memset+0x46>
+
+0000000000801871 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801871:	48 89 f8             	mov    %rdi,%rax
+  801874:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801877:	48 39 fe             	cmp    %rdi,%rsi
+  80187a:	73 3b                	jae    8018b7 <memmove+0x46>
+  80187c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801880:	48 39 d7             	cmp    %rdx,%rdi
+  801883:	73 32                	jae    8018b7 <memmove+0x46>
+        s += n;
+        d += n;
+  801885:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801889:	48 89 d6             	mov    %rdx,%rsi
+  80188c:	48 09 fe             	or     %rdi,%rsi
+  80188f:	48 09 ce             	or     %rcx,%rsi
+  801892:	40 f6 c6 07          	test   $0x7,%sil
+  801896:	75 12                	jne    8018aa <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801898:	48 83 ef 08          	sub    $0x8,%rdi
+  80189c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8018a0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8018a4:	fd                   	std
+  8018a5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8018a8:	fc                   	cld
+  8018a9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8018aa:	48 83 ef 01          	sub    $0x1,%rdi
+  8018ae:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8018b2:	fd                   	std
+  8018b3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8018b5:	eb f1                	jmp    8018a8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8018b7:	48 89 f2             	mov    %rsi,%rdx
+  8018ba:	48 09 c2             	or     %rax,%rdx
+  8018bd:	48 09 ca             	or     %rcx,%rdx
+  8018c0:	f6 c2 07             	test   $0x7,%dl
+  8018c3:	75 0c                	jne    8018d1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8018c5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8018c9:	48 89 c7             	mov    %rax,%rdi
+  8018cc:	fc                   	cld
+  8018cd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8018d0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8018d1:	48 89 c7             	mov    %rax,%rdi
+  8018d4:	fc                   	cld
+  8018d5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8018d7:	c3                   	ret
+
+00000000008018d8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8018d8:	55                   	push   %rbp
+  8018d9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8018dc:	48 b8 71 18 80 00 00 	movabs $0x801871,%rax
+  8018e3:	00 00 00 
+  8018e6:	ff d0                	call   *%rax
+}
+  8018e8:	5d                   	pop    %rbp
+  8018e9:	c3                   	ret
+
+00000000008018ea <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8018ea:	55                   	push   %rbp
+  8018eb:	48 89 e5             	mov    %rsp,%rbp
+  8018ee:	41 57                	push   %r15
+  8018f0:	41 56                	push   %r14
+  8018f2:	41 55                	push   %r13
+  8018f4:	41 54                	push   %r12
+  8018f6:	53                   	push   %rbx
+  8018f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8018fb:	49 89 fe             	mov    %rdi,%r14
+  8018fe:	49 89 f7             	mov    %rsi,%r15
+  801901:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801904:	48 89 f7             	mov    %rsi,%rdi
+  801907:	48 b8 39 16 80 00 00 	movabs $0x801639,%rax
+  80190e:	00 00 00 
+  801911:	ff d0                	call   *%rax
+  801913:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801916:	48 89 de             	mov    %rbx,%rsi
+  801919:	4c 89 f7             	mov    %r14,%rdi
+  80191c:	48 b8 54 16 80 00 00 	movabs $0x801654,%rax
+  801923:	00 00 00 
+  801926:	ff d0                	call   *%rax
+  801928:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80192b:	48 39 c3             	cmp    %rax,%rbx
+  80192e:	74 36                	je     801966 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801930:	48 89 d8             	mov    %rbx,%rax
+  801933:	4c 29 e8             	sub    %r13,%rax
+  801936:	49 39 c4             	cmp    %rax,%r12
+  801939:	73 31                	jae    80196c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80193b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801940:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801944:	4c 89 fe             	mov    %r15,%rsi
+  801947:	48 b8 d8 18 80 00 00 	movabs $0x8018d8,%rax
+  80194e:	00 00 00 
+  801951:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801953:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801957:	48 83 c4 08          	add    $0x8,%rsp
+  80195b:	5b                   	pop    %rbx
+  80195c:	41 5c                	pop    %r12
+  80195e:	41 5d                	pop    %r13
+  801960:	41 5e                	pop    %r14
+  801962:	41 5f                	pop    %r15
+  801964:	5d                   	pop    %rbp
+  801965:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801966:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80196a:	eb eb                	jmp    801957 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80196c:	48 83 eb 01          	sub    $0x1,%rbx
+  801970:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801974:	48 89 da             	mov    %rbx,%rdx
+  801977:	4c 89 fe             	mov    %r15,%rsi
+  80197a:	48 b8 d8 18 80 00 00 	movabs $0x8018d8,%rax
+  801981:	00 00 00 
+  801984:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801986:	49 01 de             	add    %rbx,%r14
+  801989:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80198e:	eb c3                	jmp    801953 <strlcat+0x69>
+
+0000000000801990 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801990:	48 85 d2             	test   %rdx,%rdx
+  801993:	74 2d                	je     8019c2 <memcmp+0x32>
+  801995:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80199a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80199e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8019a3:	44 38 c1             	cmp    %r8b,%cl
+  8019a6:	75 0f                	jne    8019b7 <memcmp+0x27>
+    while (n-- > 0) {
+  8019a8:	48 83 c0 01          	add    $0x1,%rax
+  8019ac:	48 39 c2             	cmp    %rax,%rdx
+  8019af:	75 e9                	jne    80199a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8019b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b6:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8019b7:	0f b6 c1             	movzbl %cl,%eax
+  8019ba:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8019be:	44 29 c0             	sub    %r8d,%eax
+  8019c1:	c3                   	ret
+    return 0;
+  8019c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019c7:	c3                   	ret
+
+00000000008019c8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8019c8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8019cc:	48 39 c7             	cmp    %rax,%rdi
+  8019cf:	73 0f                	jae    8019e0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8019d1:	40 38 37             	cmp    %sil,(%rdi)
+  8019d4:	74 0e                	je     8019e4 <memfind+0x1c>
+    for (; src < end; src++) {
+  8019d6:	48 83 c7 01          	add    $0x1,%rdi
+  8019da:	48 39 f8             	cmp    %rdi,%rax
+  8019dd:	75 f2                	jne    8019d1 <memfind+0x9>
+  8019df:	c3                   	ret
+  8019e0:	48 89 f8             	mov    %rdi,%rax
+  8019e3:	c3                   	ret
+  8019e4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8019e7:	c3                   	ret
+
+00000000008019e8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8019e8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8019eb:	0f b6 37             	movzbl (%rdi),%esi
+  8019ee:	40 80 fe 20          	cmp    $0x20,%sil
+  8019f2:	74 06                	je     8019fa <strtol+0x12>
+  8019f4:	40 80 fe 09          	cmp    $0x9,%sil
+  8019f8:	75 13                	jne    801a0d <strtol+0x25>
+  8019fa:	48 83 c7 01          	add    $0x1,%rdi
+  8019fe:	0f b6 37             	movzbl (%rdi),%esi
+  801a01:	40 80 fe 20          	cmp    $0x20,%sil
+  801a05:	74 f3                	je     8019fa <strtol+0x12>
+  801a07:	40 80 fe 09          	cmp    $0x9,%sil
+  801a0b:	74 ed                	je     8019fa <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801a0d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801a10:	83 e0 fd             	and    $0xfffffffd,%eax
+  801a13:	3c 01                	cmp    $0x1,%al
+  801a15:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801a19:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801a1f:	75 0f                	jne    801a30 <strtol+0x48>
+  801a21:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801a24:	74 14                	je     801a3a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801a26:	85 d2                	test   %edx,%edx
+  801a28:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801a2d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801a30:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801a35:	4c 63 ca             	movslq %edx,%r9
+  801a38:	eb 36                	jmp    801a70 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801a3a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801a3e:	74 0f                	je     801a4f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801a40:	85 d2                	test   %edx,%edx
+  801a42:	75 ec                	jne    801a30 <strtol+0x48>
+        s++;
+  801a44:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801a48:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801a4d:	eb e1                	jmp    801a30 <strtol+0x48>
+        s += 2;
+  801a4f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801a53:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801a58:	eb d6                	jmp    801a30 <strtol+0x48>
+            dig -= '0';
+  801a5a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801a5d:	44 0f b6 c1          	movzbl %cl,%r8d
+  801a61:	41 39 d0             	cmp    %edx,%r8d
+  801a64:	7d 21                	jge    801a87 <strtol+0x9f>
+        val = val * base + dig;
+  801a66:	49 0f af c1          	imul   %r9,%rax
+  801a6a:	0f b6 c9             	movzbl %cl,%ecx
+  801a6d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801a70:	48 83 c7 01          	add    $0x1,%rdi
+  801a74:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801a78:	80 f9 39             	cmp    $0x39,%cl
+  801a7b:	76 dd                	jbe    801a5a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801a7d:	80 f9 7b             	cmp    $0x7b,%cl
+  801a80:	77 05                	ja     801a87 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801a82:	83 e9 57             	sub    $0x57,%ecx
+  801a85:	eb d6                	jmp    801a5d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801a87:	4d 85 d2             	test   %r10,%r10
+  801a8a:	74 03                	je     801a8f <strtol+0xa7>
+  801a8c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801a8f:	48 89 c2             	mov    %rax,%rdx
+  801a92:	48 f7 da             	neg    %rdx
+  801a95:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801a99:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801a9d:	c3                   	ret
+
+0000000000801a9e <readline>:
+#define BUFLEN 1024
+
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt) {
+  801a9e:	55                   	push   %rbp
+  801a9f:	48 89 e5             	mov    %rsp,%rbp
+  801aa2:	41 57                	push   %r15
+  801aa4:	41 56                	push   %r14
+  801aa6:	41 55                	push   %r13
+  801aa8:	41 54                	push   %r12
+  801aaa:	53                   	push   %rbx
+  801aab:	48 83 ec 08          	sub    $0x8,%rsp
+    if (prompt) {
+  801aaf:	48 85 ff             	test   %rdi,%rdi
+  801ab2:	74 23                	je     801ad7 <readline+0x39>
+#if JOS_KERNEL
+        cprintf("%s", prompt);
+#else
+        fprintf(1, "%s", prompt);
+  801ab4:	48 89 fa             	mov    %rdi,%rdx
+  801ab7:	48 be 10 43 80 00 00 	movabs $0x804310,%rsi
+  801abe:	00 00 00 
+  801ac1:	bf 01 00 00 00       	mov    $0x1,%edi
+  801ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801acb:	48 b9 aa 30 80 00 00 	movabs $0x8030aa,%rcx
+  801ad2:	00 00 00 
+  801ad5:	ff d1                	call   *%rcx
+#endif
+    }
+
+    bool echo = iscons(0);
+  801ad7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801adc:	48 b8 9b 0a 80 00 00 	movabs $0x800a9b,%rax
+  801ae3:	00 00 00 
+  801ae6:	ff d0                	call   *%rax
+  801ae8:	41 89 c6             	mov    %eax,%r14d
+
+    for (size_t i = 0;;) {
+  801aeb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        int c = getchar();
+  801af1:	49 bd 62 0a 80 00 00 	movabs $0x800a62,%r13
+  801af8:	00 00 00 
+                cprintf("read error: %i\n", c);
+            return NULL;
+        } else if ((c == '\b' || c == '\x7F')) {
+            if (i) {
+                if (echo) {
+                    cputchar('\b');
+  801afb:	49 bf 3f 0a 80 00 00 	movabs $0x800a3f,%r15
+  801b02:	00 00 00 
+  801b05:	eb 46                	jmp    801b4d <readline+0xaf>
+            return NULL;
+  801b07:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (c != -E_EOF)
+  801b0c:	83 fb f4             	cmp    $0xfffffff4,%ebx
+  801b0f:	75 0f                	jne    801b20 <readline+0x82>
+            }
+            buf[i] = 0;
+            return buf;
+        }
+    }
+}
+  801b11:	48 83 c4 08          	add    $0x8,%rsp
+  801b15:	5b                   	pop    %rbx
+  801b16:	41 5c                	pop    %r12
+  801b18:	41 5d                	pop    %r13
+  801b1a:	41 5e                	pop    %r14
+  801b1c:	41 5f                	pop    %r15
+  801b1e:	5d                   	pop    %rbp
+  801b1f:	c3                   	ret
+                cprintf("read error: %i\n", c);
+  801b20:	89 de                	mov    %ebx,%esi
+  801b22:	48 bf 4f 49 80 00 00 	movabs $0x80494f,%rdi
+  801b29:	00 00 00 
+  801b2c:	48 ba 52 0d 80 00 00 	movabs $0x800d52,%rdx
+  801b33:	00 00 00 
+  801b36:	ff d2                	call   *%rdx
+            return NULL;
+  801b38:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b3d:	eb d2                	jmp    801b11 <readline+0x73>
+            if (i) {
+  801b3f:	4d 85 e4             	test   %r12,%r12
+  801b42:	74 09                	je     801b4d <readline+0xaf>
+                if (echo) {
+  801b44:	45 85 f6             	test   %r14d,%r14d
+  801b47:	75 3f                	jne    801b88 <readline+0xea>
+                i--;
+  801b49:	49 83 ec 01          	sub    $0x1,%r12
+        int c = getchar();
+  801b4d:	41 ff d5             	call   *%r13
+  801b50:	89 c3                	mov    %eax,%ebx
+        if (c < 0) {
+  801b52:	85 c0                	test   %eax,%eax
+  801b54:	78 b1                	js     801b07 <readline+0x69>
+        } else if ((c == '\b' || c == '\x7F')) {
+  801b56:	83 f8 08             	cmp    $0x8,%eax
+  801b59:	74 e4                	je     801b3f <readline+0xa1>
+  801b5b:	83 f8 7f             	cmp    $0x7f,%eax
+  801b5e:	74 df                	je     801b3f <readline+0xa1>
+        } else if (c >= ' ') {
+  801b60:	83 f8 1f             	cmp    $0x1f,%eax
+  801b63:	7e 4d                	jle    801bb2 <readline+0x114>
+            if (i < BUFLEN - 1) {
+  801b65:	49 81 fc fe 03 00 00 	cmp    $0x3fe,%r12
+  801b6c:	77 df                	ja     801b4d <readline+0xaf>
+                if (echo) {
+  801b6e:	45 85 f6             	test   %r14d,%r14d
+  801b71:	75 2f                	jne    801ba2 <readline+0x104>
+                buf[i++] = (char)c;
+  801b73:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  801b7a:	00 00 00 
+  801b7d:	42 88 1c 20          	mov    %bl,(%rax,%r12,1)
+  801b81:	4d 8d 64 24 01       	lea    0x1(%r12),%r12
+  801b86:	eb c5                	jmp    801b4d <readline+0xaf>
+                    cputchar('\b');
+  801b88:	bf 08 00 00 00       	mov    $0x8,%edi
+  801b8d:	41 ff d7             	call   *%r15
+                    cputchar(' ');
+  801b90:	bf 20 00 00 00       	mov    $0x20,%edi
+  801b95:	41 ff d7             	call   *%r15
+                    cputchar('\b');
+  801b98:	bf 08 00 00 00       	mov    $0x8,%edi
+  801b9d:	41 ff d7             	call   *%r15
+  801ba0:	eb a7                	jmp    801b49 <readline+0xab>
+                    cputchar(c);
+  801ba2:	89 c7                	mov    %eax,%edi
+  801ba4:	48 b8 3f 0a 80 00 00 	movabs $0x800a3f,%rax
+  801bab:	00 00 00 
+  801bae:	ff d0                	call   *%rax
+  801bb0:	eb c1                	jmp    801b73 <readline+0xd5>
+        } else if (c == '\n' || c == '\r') {
+  801bb2:	83 f8 0a             	cmp    $0xa,%eax
+  801bb5:	74 05                	je     801bbc <readline+0x11e>
+  801bb7:	83 f8 0d             	cmp    $0xd,%eax
+  801bba:	75 91                	jne    801b4d <readline+0xaf>
+            if (echo) {
+  801bbc:	45 85 f6             	test   %r14d,%r14d
+  801bbf:	75 14                	jne    801bd5 <readline+0x137>
+            buf[i] = 0;
+  801bc1:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  801bc8:	00 00 00 
+  801bcb:	42 c6 04 20 00       	movb   $0x0,(%rax,%r12,1)
+            return buf;
+  801bd0:	e9 3c ff ff ff       	jmp    801b11 <readline+0x73>
+                cputchar('\n');
+  801bd5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801bda:	48 b8 3f 0a 80 00 00 	movabs $0x800a3f,%rax
+  801be1:	00 00 00 
+  801be4:	ff d0                	call   *%rax
+  801be6:	eb d9                	jmp    801bc1 <readline+0x123>
+
+0000000000801be8 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801be8:	55                   	push   %rbp
+  801be9:	48 89 e5             	mov    %rsp,%rbp
+  801bec:	53                   	push   %rbx
+  801bed:	48 89 fa             	mov    %rdi,%rdx
+  801bf0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bf8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bfd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c02:	be 00 00 00 00       	mov    $0x0,%esi
+  801c07:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c0d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801c0f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c13:	c9                   	leave
+  801c14:	c3                   	ret
+
+0000000000801c15 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801c15:	55                   	push   %rbp
+  801c16:	48 89 e5             	mov    %rsp,%rbp
+  801c19:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c1a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c24:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c2e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c33:	be 00 00 00 00       	mov    $0x0,%esi
+  801c38:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c3e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c40:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c44:	c9                   	leave
+  801c45:	c3                   	ret
+
+0000000000801c46 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801c46:	55                   	push   %rbp
+  801c47:	48 89 e5             	mov    %rsp,%rbp
+  801c4a:	53                   	push   %rbx
+  801c4b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801c4f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c52:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c57:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c61:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c66:	be 00 00 00 00       	mov    $0x0,%esi
+  801c6b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c71:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c73:	48 85 c0             	test   %rax,%rax
+  801c76:	7f 06                	jg     801c7e <sys_env_destroy+0x38>
+}
+  801c78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c7c:	c9                   	leave
+  801c7d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c7e:	49 89 c0             	mov    %rax,%r8
+  801c81:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801c86:	48 ba 60 49 80 00 00 	movabs $0x804960,%rdx
+  801c8d:	00 00 00 
+  801c90:	be 26 00 00 00       	mov    $0x26,%esi
+  801c95:	48 bf 7f 49 80 00 00 	movabs $0x80497f,%rdi
+  801c9c:	00 00 00 
+  801c9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca4:	49 b9 02 0c 80 00 00 	movabs $0x800c02,%r9
+  801cab:	00 00 00 
+  801cae:	41 ff d1             	call   *%r9
+
+0000000000801cb1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801cb1:	55                   	push   %rbp
+  801cb2:	48 89 e5             	mov    %rsp,%rbp
+  801cb5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801cb6:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ccf:	be 00 00 00 00       	mov    $0x0,%esi
+  801cd4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cda:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801cdc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ce0:	c9                   	leave
+  801ce1:	c3                   	ret
+
+0000000000801ce2 <sys_yield>:
+
+void
+sys_yield(void) {
+  801ce2:	55                   	push   %rbp
+  801ce3:	48 89 e5             	mov    %rsp,%rbp
+  801ce6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801ce7:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cec:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cf1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cf6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cfb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d00:	be 00 00 00 00       	mov    $0x0,%esi
+  801d05:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d0b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d0d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d11:	c9                   	leave
+  801d12:	c3                   	ret
+
+0000000000801d13 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801d13:	55                   	push   %rbp
+  801d14:	48 89 e5             	mov    %rsp,%rbp
+  801d17:	53                   	push   %rbx
+  801d18:	48 89 fa             	mov    %rdi,%rdx
+  801d1b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801d1e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d23:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801d2a:	00 00 00 
+  801d2d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d32:	be 00 00 00 00       	mov    $0x0,%esi
+  801d37:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d3d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801d3f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d43:	c9                   	leave
+  801d44:	c3                   	ret
+
+0000000000801d45 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801d45:	55                   	push   %rbp
+  801d46:	48 89 e5             	mov    %rsp,%rbp
+  801d49:	53                   	push   %rbx
+  801d4a:	49 89 f8             	mov    %rdi,%r8
+  801d4d:	48 89 d3             	mov    %rdx,%rbx
+  801d50:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801d53:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d58:	4c 89 c2             	mov    %r8,%rdx
+  801d5b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d5e:	be 00 00 00 00       	mov    $0x0,%esi
+  801d63:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d69:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801d6b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d6f:	c9                   	leave
+  801d70:	c3                   	ret
+
+0000000000801d71 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801d71:	55                   	push   %rbp
+  801d72:	48 89 e5             	mov    %rsp,%rbp
+  801d75:	53                   	push   %rbx
+  801d76:	48 83 ec 08          	sub    $0x8,%rsp
+  801d7a:	89 f8                	mov    %edi,%eax
+  801d7c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801d7f:	48 63 f9             	movslq %ecx,%rdi
+  801d82:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801d85:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d8a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d8d:	be 00 00 00 00       	mov    $0x0,%esi
+  801d92:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d98:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801d9a:	48 85 c0             	test   %rax,%rax
+  801d9d:	7f 06                	jg     801da5 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801d9f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801da3:	c9                   	leave
+  801da4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801da5:	49 89 c0             	mov    %rax,%r8
+  801da8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801dad:	48 ba 60 49 80 00 00 	movabs $0x804960,%rdx
+  801db4:	00 00 00 
+  801db7:	be 26 00 00 00       	mov    $0x26,%esi
+  801dbc:	48 bf 7f 49 80 00 00 	movabs $0x80497f,%rdi
+  801dc3:	00 00 00 
+  801dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dcb:	49 b9 02 0c 80 00 00 	movabs $0x800c02,%r9
+  801dd2:	00 00 00 
+  801dd5:	41 ff d1             	call   *%r9
+
+0000000000801dd8 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801dd8:	55                   	push   %rbp
+  801dd9:	48 89 e5             	mov    %rsp,%rbp
+  801ddc:	53                   	push   %rbx
+  801ddd:	48 83 ec 08          	sub    $0x8,%rsp
+  801de1:	89 f8                	mov    %edi,%eax
+  801de3:	49 89 f2             	mov    %rsi,%r10
+  801de6:	48 89 cf             	mov    %rcx,%rdi
+  801de9:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801dec:	48 63 da             	movslq %edx,%rbx
+  801def:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801df2:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801df7:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dfa:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801dfd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801dff:	48 85 c0             	test   %rax,%rax
+  801e02:	7f 06                	jg     801e0a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801e04:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e08:	c9                   	leave
+  801e09:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e0a:	49 89 c0             	mov    %rax,%r8
+  801e0d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801e12:	48 ba 60 49 80 00 00 	movabs $0x804960,%rdx
+  801e19:	00 00 00 
+  801e1c:	be 26 00 00 00       	mov    $0x26,%esi
+  801e21:	48 bf 7f 49 80 00 00 	movabs $0x80497f,%rdi
+  801e28:	00 00 00 
+  801e2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e30:	49 b9 02 0c 80 00 00 	movabs $0x800c02,%r9
+  801e37:	00 00 00 
+  801e3a:	41 ff d1             	call   *%r9
+
+0000000000801e3d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801e3d:	55                   	push   %rbp
+  801e3e:	48 89 e5             	mov    %rsp,%rbp
+  801e41:	53                   	push   %rbx
+  801e42:	48 83 ec 08          	sub    $0x8,%rsp
+  801e46:	48 89 f1             	mov    %rsi,%rcx
+  801e49:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801e4c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e4f:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e54:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e59:	be 00 00 00 00       	mov    $0x0,%esi
+  801e5e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e64:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e66:	48 85 c0             	test   %rax,%rax
+  801e69:	7f 06                	jg     801e71 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801e6b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e6f:	c9                   	leave
+  801e70:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e71:	49 89 c0             	mov    %rax,%r8
+  801e74:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801e79:	48 ba 60 49 80 00 00 	movabs $0x804960,%rdx
+  801e80:	00 00 00 
+  801e83:	be 26 00 00 00       	mov    $0x26,%esi
+  801e88:	48 bf 7f 49 80 00 00 	movabs $0x80497f,%rdi
+  801e8f:	00 00 00 
+  801e92:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e97:	49 b9 02 0c 80 00 00 	movabs $0x800c02,%r9
+  801e9e:	00 00 00 
+  801ea1:	41 ff d1             	call   *%r9
+
+0000000000801ea4 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801ea4:	55                   	push   %rbp
+  801ea5:	48 89 e5             	mov    %rsp,%rbp
+  801ea8:	53                   	push   %rbx
+  801ea9:	48 83 ec 08          	sub    $0x8,%rsp
+  801ead:	89 f8                	mov    %edi,%eax
+  801eaf:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801eb2:	48 63 f9             	movslq %ecx,%rdi
+  801eb5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801eb8:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ebd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ec0:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ecb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ecd:	48 85 c0             	test   %rax,%rax
+  801ed0:	7f 06                	jg     801ed8 <sys_region_advise+0x34>
+}
+  801ed2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ed6:	c9                   	leave
+  801ed7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ed8:	49 89 c0             	mov    %rax,%r8
+  801edb:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801ee0:	48 ba 60 49 80 00 00 	movabs $0x804960,%rdx
+  801ee7:	00 00 00 
+  801eea:	be 26 00 00 00       	mov    $0x26,%esi
+  801eef:	48 bf 7f 49 80 00 00 	movabs $0x80497f,%rdi
+  801ef6:	00 00 00 
+  801ef9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801efe:	49 b9 02 0c 80 00 00 	movabs $0x800c02,%r9
+  801f05:	00 00 00 
+  801f08:	41 ff d1             	call   *%r9
+
+0000000000801f0b <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801f0b:	55                   	push   %rbp
+  801f0c:	48 89 e5             	mov    %rsp,%rbp
+  801f0f:	53                   	push   %rbx
+  801f10:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801f14:	48 63 ce             	movslq %esi,%rcx
+  801f17:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f1a:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f1f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f24:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f29:	be 00 00 00 00       	mov    $0x0,%esi
+  801f2e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f34:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f36:	48 85 c0             	test   %rax,%rax
+  801f39:	7f 06                	jg     801f41 <sys_env_set_nice+0x36>
+}
+  801f3b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f3f:	c9                   	leave
+  801f40:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f41:	49 89 c0             	mov    %rax,%r8
+  801f44:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801f49:	48 ba 60 49 80 00 00 	movabs $0x804960,%rdx
+  801f50:	00 00 00 
+  801f53:	be 26 00 00 00       	mov    $0x26,%esi
+  801f58:	48 bf 7f 49 80 00 00 	movabs $0x80497f,%rdi
+  801f5f:	00 00 00 
+  801f62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f67:	49 b9 02 0c 80 00 00 	movabs $0x800c02,%r9
+  801f6e:	00 00 00 
+  801f71:	41 ff d1             	call   *%r9
+
+0000000000801f74 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801f74:	55                   	push   %rbp
+  801f75:	48 89 e5             	mov    %rsp,%rbp
+  801f78:	53                   	push   %rbx
+  801f79:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801f7d:	48 63 ce             	movslq %esi,%rcx
+  801f80:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f83:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f8d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f92:	be 00 00 00 00       	mov    $0x0,%esi
+  801f97:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f9d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f9f:	48 85 c0             	test   %rax,%rax
+  801fa2:	7f 06                	jg     801faa <sys_env_set_status+0x36>
+}
+  801fa4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fa8:	c9                   	leave
+  801fa9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801faa:	49 89 c0             	mov    %rax,%r8
+  801fad:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801fb2:	48 ba 60 49 80 00 00 	movabs $0x804960,%rdx
+  801fb9:	00 00 00 
+  801fbc:	be 26 00 00 00       	mov    $0x26,%esi
+  801fc1:	48 bf 7f 49 80 00 00 	movabs $0x80497f,%rdi
+  801fc8:	00 00 00 
+  801fcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd0:	49 b9 02 0c 80 00 00 	movabs $0x800c02,%r9
+  801fd7:	00 00 00 
+  801fda:	41 ff d1             	call   *%r9
+
+0000000000801fdd <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801fdd:	55                   	push   %rbp
+  801fde:	48 89 e5             	mov    %rsp,%rbp
+  801fe1:	53                   	push   %rbx
+  801fe2:	48 83 ec 08          	sub    $0x8,%rsp
+  801fe6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801fe9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801fec:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ff1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ff6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ffb:	be 00 00 00 00       	mov    $0x0,%esi
+  802000:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802006:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802008:	48 85 c0             	test   %rax,%rax
+  80200b:	7f 06                	jg     802013 <sys_env_set_trapframe+0x36>
+}
+  80200d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802011:	c9                   	leave
+  802012:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802013:	49 89 c0             	mov    %rax,%r8
+  802016:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80201b:	48 ba 60 49 80 00 00 	movabs $0x804960,%rdx
+  802022:	00 00 00 
+  802025:	be 26 00 00 00       	mov    $0x26,%esi
+  80202a:	48 bf 7f 49 80 00 00 	movabs $0x80497f,%rdi
+  802031:	00 00 00 
+  802034:	b8 00 00 00 00       	mov    $0x0,%eax
+  802039:	49 b9 02 0c 80 00 00 	movabs $0x800c02,%r9
+  802040:	00 00 00 
+  802043:	41 ff d1             	call   *%r9
+
+0000000000802046 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802046:	55                   	push   %rbp
+  802047:	48 89 e5             	mov    %rsp,%rbp
+  80204a:	53                   	push   %rbx
+  80204b:	48 83 ec 08          	sub    $0x8,%rsp
+  80204f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  802052:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802055:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80205a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80205f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802064:	be 00 00 00 00       	mov    $0x0,%esi
+  802069:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80206f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802071:	48 85 c0             	test   %rax,%rax
+  802074:	7f 06                	jg     80207c <sys_env_set_pgfault_upcall+0x36>
+}
+  802076:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80207a:	c9                   	leave
+  80207b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80207c:	49 89 c0             	mov    %rax,%r8
+  80207f:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802084:	48 ba 60 49 80 00 00 	movabs $0x804960,%rdx
+  80208b:	00 00 00 
+  80208e:	be 26 00 00 00       	mov    $0x26,%esi
+  802093:	48 bf 7f 49 80 00 00 	movabs $0x80497f,%rdi
+  80209a:	00 00 00 
+  80209d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a2:	49 b9 02 0c 80 00 00 	movabs $0x800c02,%r9
+  8020a9:	00 00 00 
+  8020ac:	41 ff d1             	call   *%r9
+
+00000000008020af <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8020af:	55                   	push   %rbp
+  8020b0:	48 89 e5             	mov    %rsp,%rbp
+  8020b3:	53                   	push   %rbx
+  8020b4:	89 f8                	mov    %edi,%eax
+  8020b6:	49 89 f1             	mov    %rsi,%r9
+  8020b9:	48 89 d3             	mov    %rdx,%rbx
+  8020bc:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8020bf:	49 63 f0             	movslq %r8d,%rsi
+  8020c2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8020c5:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8020ca:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8020cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8020d3:	cd 30                	int    $0x30
+}
+  8020d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020d9:	c9                   	leave
+  8020da:	c3                   	ret
+
+00000000008020db <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8020db:	55                   	push   %rbp
+  8020dc:	48 89 e5             	mov    %rsp,%rbp
+  8020df:	53                   	push   %rbx
+  8020e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8020e4:	48 89 fa             	mov    %rdi,%rdx
+  8020e7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8020ea:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8020ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8020f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8020fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802104:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802106:	48 85 c0             	test   %rax,%rax
+  802109:	7f 06                	jg     802111 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80210b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80210f:	c9                   	leave
+  802110:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802111:	49 89 c0             	mov    %rax,%r8
+  802114:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  802119:	48 ba 60 49 80 00 00 	movabs $0x804960,%rdx
+  802120:	00 00 00 
+  802123:	be 26 00 00 00       	mov    $0x26,%esi
+  802128:	48 bf 7f 49 80 00 00 	movabs $0x80497f,%rdi
+  80212f:	00 00 00 
+  802132:	b8 00 00 00 00       	mov    $0x0,%eax
+  802137:	49 b9 02 0c 80 00 00 	movabs $0x800c02,%r9
+  80213e:	00 00 00 
+  802141:	41 ff d1             	call   *%r9
+
+0000000000802144 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802144:	55                   	push   %rbp
+  802145:	48 89 e5             	mov    %rsp,%rbp
+  802148:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802149:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80214e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802153:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802158:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80215d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802162:	be 00 00 00 00       	mov    $0x0,%esi
+  802167:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80216d:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80216f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802173:	c9                   	leave
+  802174:	c3                   	ret
+
+0000000000802175 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  802175:	55                   	push   %rbp
+  802176:	48 89 e5             	mov    %rsp,%rbp
+  802179:	53                   	push   %rbx
+  80217a:	48 83 ec 08          	sub    $0x8,%rsp
+  80217e:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  802181:	48 63 ce             	movslq %esi,%rcx
+  802184:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802187:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80218c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802191:	be 00 00 00 00       	mov    $0x0,%esi
+  802196:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80219c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80219e:	48 85 c0             	test   %rax,%rax
+  8021a1:	7f 06                	jg     8021a9 <sys_sigqueue+0x34>
+}
+  8021a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021a7:	c9                   	leave
+  8021a8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8021a9:	49 89 c0             	mov    %rax,%r8
+  8021ac:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8021b1:	48 ba 60 49 80 00 00 	movabs $0x804960,%rdx
+  8021b8:	00 00 00 
+  8021bb:	be 26 00 00 00       	mov    $0x26,%esi
+  8021c0:	48 bf 7f 49 80 00 00 	movabs $0x80497f,%rdi
+  8021c7:	00 00 00 
+  8021ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021cf:	49 b9 02 0c 80 00 00 	movabs $0x800c02,%r9
+  8021d6:	00 00 00 
+  8021d9:	41 ff d1             	call   *%r9
+
+00000000008021dc <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8021dc:	55                   	push   %rbp
+  8021dd:	48 89 e5             	mov    %rsp,%rbp
+  8021e0:	53                   	push   %rbx
+  8021e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8021e5:	48 89 fa             	mov    %rdi,%rdx
+  8021e8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8021eb:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8021f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802205:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802207:	48 85 c0             	test   %rax,%rax
+  80220a:	7f 06                	jg     802212 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  80220c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802210:	c9                   	leave
+  802211:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802212:	49 89 c0             	mov    %rax,%r8
+  802215:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80221a:	48 ba 60 49 80 00 00 	movabs $0x804960,%rdx
+  802221:	00 00 00 
+  802224:	be 26 00 00 00       	mov    $0x26,%esi
+  802229:	48 bf 7f 49 80 00 00 	movabs $0x80497f,%rdi
+  802230:	00 00 00 
+  802233:	b8 00 00 00 00       	mov    $0x0,%eax
+  802238:	49 b9 02 0c 80 00 00 	movabs $0x800c02,%r9
+  80223f:	00 00 00 
+  802242:	41 ff d1             	call   *%r9
+
+0000000000802245 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  802245:	55                   	push   %rbp
+  802246:	48 89 e5             	mov    %rsp,%rbp
+  802249:	53                   	push   %rbx
+  80224a:	48 83 ec 08          	sub    $0x8,%rsp
+  80224e:	48 89 f1             	mov    %rsi,%rcx
+  802251:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  802254:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802257:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80225c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802261:	be 00 00 00 00       	mov    $0x0,%esi
+  802266:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80226c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80226e:	48 85 c0             	test   %rax,%rax
+  802271:	7f 06                	jg     802279 <sys_sigaction+0x34>
+}
+  802273:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802277:	c9                   	leave
+  802278:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802279:	49 89 c0             	mov    %rax,%r8
+  80227c:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802281:	48 ba 60 49 80 00 00 	movabs $0x804960,%rdx
+  802288:	00 00 00 
+  80228b:	be 26 00 00 00       	mov    $0x26,%esi
+  802290:	48 bf 7f 49 80 00 00 	movabs $0x80497f,%rdi
+  802297:	00 00 00 
+  80229a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80229f:	49 b9 02 0c 80 00 00 	movabs $0x800c02,%r9
+  8022a6:	00 00 00 
+  8022a9:	41 ff d1             	call   *%r9
+
+00000000008022ac <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8022ac:	55                   	push   %rbp
+  8022ad:	48 89 e5             	mov    %rsp,%rbp
+  8022b0:	53                   	push   %rbx
+  8022b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8022b5:	48 89 f1             	mov    %rsi,%rcx
+  8022b8:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8022bb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8022be:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8022c3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8022c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8022cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8022d3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8022d5:	48 85 c0             	test   %rax,%rax
+  8022d8:	7f 06                	jg     8022e0 <sys_sigprocmask+0x34>
+}
+  8022da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022de:	c9                   	leave
+  8022df:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8022e0:	49 89 c0             	mov    %rax,%r8
+  8022e3:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8022e8:	48 ba 60 49 80 00 00 	movabs $0x804960,%rdx
+  8022ef:	00 00 00 
+  8022f2:	be 26 00 00 00       	mov    $0x26,%esi
+  8022f7:	48 bf 7f 49 80 00 00 	movabs $0x80497f,%rdi
+  8022fe:	00 00 00 
+  802301:	b8 00 00 00 00       	mov    $0x0,%eax
+  802306:	49 b9 02 0c 80 00 00 	movabs $0x800c02,%r9
+  80230d:	00 00 00 
+  802310:	41 ff d1             	call   *%r9
+
+0000000000802313 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  802313:	55                   	push   %rbp
+  802314:	48 89 e5             	mov    %rsp,%rbp
+  802317:	41 54                	push   %r12
+  802319:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80231a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80231f:	cd 30                	int    $0x30
+  802321:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  802324:	85 c0                	test   %eax,%eax
+  802326:	78 76                	js     80239e <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  802328:	74 7c                	je     8023a6 <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  80232a:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  802330:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  802337:	00 00 00 
+  80233a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80233f:	89 c2                	mov    %eax,%edx
+  802341:	be 00 00 00 00       	mov    $0x0,%esi
+  802346:	bf 00 00 00 00       	mov    $0x0,%edi
+  80234b:	48 b8 d8 1d 80 00 00 	movabs $0x801dd8,%rax
+  802352:	00 00 00 
+  802355:	ff d0                	call   *%rax
+  802357:	85 c0                	test   %eax,%eax
+  802359:	75 7a                	jne    8023d5 <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  80235b:	48 a1 18 60 80 00 00 	movabs 0x806018,%rax
+  802362:	00 00 00 
+  802365:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  80236c:	44 89 e7             	mov    %r12d,%edi
+  80236f:	48 b8 46 20 80 00 00 	movabs $0x802046,%rax
+  802376:	00 00 00 
+  802379:	ff d0                	call   *%rax
+  80237b:	85 c0                	test   %eax,%eax
+  80237d:	75 5e                	jne    8023dd <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  80237f:	be 02 00 00 00       	mov    $0x2,%esi
+  802384:	44 89 e7             	mov    %r12d,%edi
+  802387:	48 b8 74 1f 80 00 00 	movabs $0x801f74,%rax
+  80238e:	00 00 00 
+  802391:	ff d0                	call   *%rax
+        return -1;
+  802393:	85 c0                	test   %eax,%eax
+  802395:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80239a:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  80239e:	44 89 e0             	mov    %r12d,%eax
+  8023a1:	5b                   	pop    %rbx
+  8023a2:	41 5c                	pop    %r12
+  8023a4:	5d                   	pop    %rbp
+  8023a5:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  8023a6:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  8023ad:	00 00 00 
+  8023b0:	ff d0                	call   *%rax
+  8023b2:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  8023b5:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8023bc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8023c3:	00 00 00 
+  8023c6:	48 01 d0             	add    %rdx,%rax
+  8023c9:	48 a3 18 60 80 00 00 	movabs %rax,0x806018
+  8023d0:	00 00 00 
+        return 0;
+  8023d3:	eb c9                	jmp    80239e <fork+0x8b>
+        return -1;
+  8023d5:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8023db:	eb c1                	jmp    80239e <fork+0x8b>
+        return -1;
+  8023dd:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8023e3:	eb b9                	jmp    80239e <fork+0x8b>
+
+00000000008023e5 <sfork>:
+
+envid_t
+sfork() {
+  8023e5:	55                   	push   %rbp
+  8023e6:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8023e9:	48 ba 8d 49 80 00 00 	movabs $0x80498d,%rdx
+  8023f0:	00 00 00 
+  8023f3:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8023f8:	48 bf a8 49 80 00 00 	movabs $0x8049a8,%rdi
+  8023ff:	00 00 00 
+  802402:	b8 00 00 00 00       	mov    $0x0,%eax
+  802407:	48 b9 02 0c 80 00 00 	movabs $0x800c02,%rcx
+  80240e:	00 00 00 
+  802411:	ff d1                	call   *%rcx
+
+0000000000802413 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  802413:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  802416:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  80241a:	83 3f 01             	cmpl   $0x1,(%rdi)
+  80241d:	7e 0f                	jle    80242e <argstart+0x1b>
+  80241f:	48 b8 5c 42 80 00 00 	movabs $0x80425c,%rax
+  802426:	00 00 00 
+  802429:	48 85 f6             	test   %rsi,%rsi
+  80242c:	75 05                	jne    802433 <argstart+0x20>
+  80242e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802433:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  802437:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  80243e:	00 
+}
+  80243f:	c3                   	ret
+
+0000000000802440 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  802440:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  802447:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  802448:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  80244c:	48 85 c0             	test   %rax,%rax
+  80244f:	0f 84 8f 00 00 00    	je     8024e4 <argnext+0xa4>
+argnext(struct Argstate *args) {
+  802455:	55                   	push   %rbp
+  802456:	48 89 e5             	mov    %rsp,%rbp
+  802459:	53                   	push   %rbx
+  80245a:	48 83 ec 08          	sub    $0x8,%rsp
+  80245e:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  802461:	80 38 00             	cmpb   $0x0,(%rax)
+  802464:	75 52                	jne    8024b8 <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  802466:	48 8b 17             	mov    (%rdi),%rdx
+  802469:	83 3a 01             	cmpl   $0x1,(%rdx)
+  80246c:	74 67                	je     8024d5 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  80246e:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  802472:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  802476:	80 38 2d             	cmpb   $0x2d,(%rax)
+  802479:	75 5a                	jne    8024d5 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  80247b:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  80247f:	74 54                	je     8024d5 <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  802481:	48 83 c0 01          	add    $0x1,%rax
+  802485:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  802489:	8b 12                	mov    (%rdx),%edx
+  80248b:	83 ea 01             	sub    $0x1,%edx
+  80248e:	48 63 d2             	movslq %edx,%rdx
+  802491:	48 c1 e2 03          	shl    $0x3,%rdx
+  802495:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  802499:	48 83 c7 08          	add    $0x8,%rdi
+  80249d:	48 b8 71 18 80 00 00 	movabs $0x801871,%rax
+  8024a4:	00 00 00 
+  8024a7:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  8024a9:	48 8b 03             	mov    (%rbx),%rax
+  8024ac:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  8024af:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8024b3:	80 38 2d             	cmpb   $0x2d,(%rax)
+  8024b6:	74 17                	je     8024cf <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  8024b8:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8024bc:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  8024bf:	48 83 c0 01          	add    $0x1,%rax
+  8024c3:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  8024c7:	89 d0                	mov    %edx,%eax
+  8024c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024cd:	c9                   	leave
+  8024ce:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  8024cf:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  8024d3:	75 e3                	jne    8024b8 <argnext+0x78>
+    args->curarg = 0;
+  8024d5:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8024dc:	00 
+    return -1;
+  8024dd:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8024e2:	eb e3                	jmp    8024c7 <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  8024e4:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  8024e9:	89 d0                	mov    %edx,%eax
+  8024eb:	c3                   	ret
+
+00000000008024ec <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  8024ec:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  8024f0:	48 85 c0             	test   %rax,%rax
+  8024f3:	74 7b                	je     802570 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  8024f5:	55                   	push   %rbp
+  8024f6:	48 89 e5             	mov    %rsp,%rbp
+  8024f9:	53                   	push   %rbx
+  8024fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8024fe:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  802501:	80 38 00             	cmpb   $0x0,(%rax)
+  802504:	74 1c                	je     802522 <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  802506:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  80250a:	48 b8 5c 42 80 00 00 	movabs $0x80425c,%rax
+  802511:	00 00 00 
+  802514:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  802518:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  80251c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802520:	c9                   	leave
+  802521:	c3                   	ret
+    } else if (*args->argc > 1) {
+  802522:	48 8b 07             	mov    (%rdi),%rax
+  802525:	83 38 01             	cmpl   $0x1,(%rax)
+  802528:	7f 12                	jg     80253c <argnextvalue+0x50>
+        args->argvalue = 0;
+  80252a:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  802531:	00 
+        args->curarg = 0;
+  802532:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  802539:	00 
+  80253a:	eb dc                	jmp    802518 <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  80253c:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  802540:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802544:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  802548:	8b 10                	mov    (%rax),%edx
+  80254a:	83 ea 01             	sub    $0x1,%edx
+  80254d:	48 63 d2             	movslq %edx,%rdx
+  802550:	48 c1 e2 03          	shl    $0x3,%rdx
+  802554:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  802558:	48 83 c7 08          	add    $0x8,%rdi
+  80255c:	48 b8 71 18 80 00 00 	movabs $0x801871,%rax
+  802563:	00 00 00 
+  802566:	ff d0                	call   *%rax
+        (*args->argc)--;
+  802568:	48 8b 03             	mov    (%rbx),%rax
+  80256b:	83 28 01             	subl   $0x1,(%rax)
+  80256e:	eb a8                	jmp    802518 <argnextvalue+0x2c>
+}
+  802570:	c3                   	ret
+
+0000000000802571 <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  802571:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  802575:	48 85 c0             	test   %rax,%rax
+  802578:	74 01                	je     80257b <argvalue+0xa>
+}
+  80257a:	c3                   	ret
+argvalue(struct Argstate *args) {
+  80257b:	55                   	push   %rbp
+  80257c:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  80257f:	48 b8 ec 24 80 00 00 	movabs $0x8024ec,%rax
+  802586:	00 00 00 
+  802589:	ff d0                	call   *%rax
+}
+  80258b:	5d                   	pop    %rbp
+  80258c:	c3                   	ret
+
+000000000080258d <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80258d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802594:	ff ff ff 
+  802597:	48 01 f8             	add    %rdi,%rax
+  80259a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80259e:	c3                   	ret
+
+000000000080259f <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80259f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8025a6:	ff ff ff 
+  8025a9:	48 01 f8             	add    %rdi,%rax
+  8025ac:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8025b0:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8025b6:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8025ba:	c3                   	ret
+
+00000000008025bb <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8025bb:	55                   	push   %rbp
+  8025bc:	48 89 e5             	mov    %rsp,%rbp
+  8025bf:	41 57                	push   %r15
+  8025c1:	41 56                	push   %r14
+  8025c3:	41 55                	push   %r13
+  8025c5:	41 54                	push   %r12
+  8025c7:	53                   	push   %rbx
+  8025c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8025cc:	49 89 ff             	mov    %rdi,%r15
+  8025cf:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8025d4:	49 bd d7 3f 80 00 00 	movabs $0x803fd7,%r13
+  8025db:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8025de:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8025e4:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8025e7:	48 89 df             	mov    %rbx,%rdi
+  8025ea:	41 ff d5             	call   *%r13
+  8025ed:	83 e0 04             	and    $0x4,%eax
+  8025f0:	74 17                	je     802609 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8025f2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8025f9:	4c 39 f3             	cmp    %r14,%rbx
+  8025fc:	75 e6                	jne    8025e4 <fd_alloc+0x29>
+  8025fe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802604:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802609:	4d 89 27             	mov    %r12,(%r15)
+}
+  80260c:	48 83 c4 08          	add    $0x8,%rsp
+  802610:	5b                   	pop    %rbx
+  802611:	41 5c                	pop    %r12
+  802613:	41 5d                	pop    %r13
+  802615:	41 5e                	pop    %r14
+  802617:	41 5f                	pop    %r15
+  802619:	5d                   	pop    %rbp
+  80261a:	c3                   	ret
+
+000000000080261b <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80261b:	83 ff 1f             	cmp    $0x1f,%edi
+  80261e:	77 39                	ja     802659 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802620:	55                   	push   %rbp
+  802621:	48 89 e5             	mov    %rsp,%rbp
+  802624:	41 54                	push   %r12
+  802626:	53                   	push   %rbx
+  802627:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80262a:	48 63 df             	movslq %edi,%rbx
+  80262d:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802634:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802638:	48 89 df             	mov    %rbx,%rdi
+  80263b:	48 b8 d7 3f 80 00 00 	movabs $0x803fd7,%rax
+  802642:	00 00 00 
+  802645:	ff d0                	call   *%rax
+  802647:	a8 04                	test   $0x4,%al
+  802649:	74 14                	je     80265f <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80264b:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80264f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802654:	5b                   	pop    %rbx
+  802655:	41 5c                	pop    %r12
+  802657:	5d                   	pop    %rbp
+  802658:	c3                   	ret
+        return -E_INVAL;
+  802659:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80265e:	c3                   	ret
+        return -E_INVAL;
+  80265f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802664:	eb ee                	jmp    802654 <fd_lookup+0x39>
+
+0000000000802666 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802666:	55                   	push   %rbp
+  802667:	48 89 e5             	mov    %rsp,%rbp
+  80266a:	41 54                	push   %r12
+  80266c:	53                   	push   %rbx
+  80266d:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802670:	48 b8 40 4a 80 00 00 	movabs $0x804a40,%rax
+  802677:	00 00 00 
+  80267a:	48 bb 40 50 80 00 00 	movabs $0x805040,%rbx
+  802681:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802684:	39 3b                	cmp    %edi,(%rbx)
+  802686:	74 47                	je     8026cf <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802688:	48 83 c0 08          	add    $0x8,%rax
+  80268c:	48 8b 18             	mov    (%rax),%rbx
+  80268f:	48 85 db             	test   %rbx,%rbx
+  802692:	75 f0                	jne    802684 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802694:	48 a1 18 60 80 00 00 	movabs 0x806018,%rax
+  80269b:	00 00 00 
+  80269e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8026a4:	89 fa                	mov    %edi,%edx
+  8026a6:	48 bf b8 49 80 00 00 	movabs $0x8049b8,%rdi
+  8026ad:	00 00 00 
+  8026b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b5:	48 b9 52 0d 80 00 00 	movabs $0x800d52,%rcx
+  8026bc:	00 00 00 
+  8026bf:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8026c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8026c6:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8026ca:	5b                   	pop    %rbx
+  8026cb:	41 5c                	pop    %r12
+  8026cd:	5d                   	pop    %rbp
+  8026ce:	c3                   	ret
+            return 0;
+  8026cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d4:	eb f0                	jmp    8026c6 <dev_lookup+0x60>
+
+00000000008026d6 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8026d6:	55                   	push   %rbp
+  8026d7:	48 89 e5             	mov    %rsp,%rbp
+  8026da:	41 55                	push   %r13
+  8026dc:	41 54                	push   %r12
+  8026de:	53                   	push   %rbx
+  8026df:	48 83 ec 18          	sub    $0x18,%rsp
+  8026e3:	48 89 fb             	mov    %rdi,%rbx
+  8026e6:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8026e9:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8026f0:	ff ff ff 
+  8026f3:	48 01 df             	add    %rbx,%rdi
+  8026f6:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8026fa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8026fe:	48 b8 1b 26 80 00 00 	movabs $0x80261b,%rax
+  802705:	00 00 00 
+  802708:	ff d0                	call   *%rax
+  80270a:	41 89 c5             	mov    %eax,%r13d
+  80270d:	85 c0                	test   %eax,%eax
+  80270f:	78 06                	js     802717 <fd_close+0x41>
+  802711:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802715:	74 1a                	je     802731 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802717:	45 84 e4             	test   %r12b,%r12b
+  80271a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271f:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802723:	44 89 e8             	mov    %r13d,%eax
+  802726:	48 83 c4 18          	add    $0x18,%rsp
+  80272a:	5b                   	pop    %rbx
+  80272b:	41 5c                	pop    %r12
+  80272d:	41 5d                	pop    %r13
+  80272f:	5d                   	pop    %rbp
+  802730:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802731:	8b 3b                	mov    (%rbx),%edi
+  802733:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802737:	48 b8 66 26 80 00 00 	movabs $0x802666,%rax
+  80273e:	00 00 00 
+  802741:	ff d0                	call   *%rax
+  802743:	41 89 c5             	mov    %eax,%r13d
+  802746:	85 c0                	test   %eax,%eax
+  802748:	78 1b                	js     802765 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80274a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80274e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802752:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802758:	48 85 c0             	test   %rax,%rax
+  80275b:	74 08                	je     802765 <fd_close+0x8f>
+  80275d:	48 89 df             	mov    %rbx,%rdi
+  802760:	ff d0                	call   *%rax
+  802762:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802765:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80276a:	48 89 de             	mov    %rbx,%rsi
+  80276d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802772:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  802779:	00 00 00 
+  80277c:	ff d0                	call   *%rax
+    return res;
+  80277e:	eb a3                	jmp    802723 <fd_close+0x4d>
+
+0000000000802780 <close>:
+
+int
+close(int fdnum) {
+  802780:	55                   	push   %rbp
+  802781:	48 89 e5             	mov    %rsp,%rbp
+  802784:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802788:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80278c:	48 b8 1b 26 80 00 00 	movabs $0x80261b,%rax
+  802793:	00 00 00 
+  802796:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802798:	85 c0                	test   %eax,%eax
+  80279a:	78 15                	js     8027b1 <close+0x31>
+
+    return fd_close(fd, 1);
+  80279c:	be 01 00 00 00       	mov    $0x1,%esi
+  8027a1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8027a5:	48 b8 d6 26 80 00 00 	movabs $0x8026d6,%rax
+  8027ac:	00 00 00 
+  8027af:	ff d0                	call   *%rax
+}
+  8027b1:	c9                   	leave
+  8027b2:	c3                   	ret
+
+00000000008027b3 <close_all>:
+
+void
+close_all(void) {
+  8027b3:	55                   	push   %rbp
+  8027b4:	48 89 e5             	mov    %rsp,%rbp
+  8027b7:	41 54                	push   %r12
+  8027b9:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8027ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027bf:	49 bc 80 27 80 00 00 	movabs $0x802780,%r12
+  8027c6:	00 00 00 
+  8027c9:	89 df                	mov    %ebx,%edi
+  8027cb:	41 ff d4             	call   *%r12
+  8027ce:	83 c3 01             	add    $0x1,%ebx
+  8027d1:	83 fb 20             	cmp    $0x20,%ebx
+  8027d4:	75 f3                	jne    8027c9 <close_all+0x16>
+}
+  8027d6:	5b                   	pop    %rbx
+  8027d7:	41 5c                	pop    %r12
+  8027d9:	5d                   	pop    %rbp
+  8027da:	c3                   	ret
+
+00000000008027db <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8027db:	55                   	push   %rbp
+  8027dc:	48 89 e5             	mov    %rsp,%rbp
+  8027df:	41 57                	push   %r15
+  8027e1:	41 56                	push   %r14
+  8027e3:	41 55                	push   %r13
+  8027e5:	41 54                	push   %r12
+  8027e7:	53                   	push   %rbx
+  8027e8:	48 83 ec 18          	sub    $0x18,%rsp
+  8027ec:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8027ef:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8027f3:	48 b8 1b 26 80 00 00 	movabs $0x80261b,%rax
+  8027fa:	00 00 00 
+  8027fd:	ff d0                	call   *%rax
+  8027ff:	89 c3                	mov    %eax,%ebx
+  802801:	85 c0                	test   %eax,%eax
+  802803:	0f 88 b8 00 00 00    	js     8028c1 <dup+0xe6>
+    close(newfdnum);
+  802809:	44 89 e7             	mov    %r12d,%edi
+  80280c:	48 b8 80 27 80 00 00 	movabs $0x802780,%rax
+  802813:	00 00 00 
+  802816:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802818:	4d 63 ec             	movslq %r12d,%r13
+  80281b:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802822:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802826:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80282a:	4c 89 ff             	mov    %r15,%rdi
+  80282d:	49 be 9f 25 80 00 00 	movabs $0x80259f,%r14
+  802834:	00 00 00 
+  802837:	41 ff d6             	call   *%r14
+  80283a:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80283d:	4c 89 ef             	mov    %r13,%rdi
+  802840:	41 ff d6             	call   *%r14
+  802843:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802846:	48 89 df             	mov    %rbx,%rdi
+  802849:	48 b8 d7 3f 80 00 00 	movabs $0x803fd7,%rax
+  802850:	00 00 00 
+  802853:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802855:	a8 04                	test   $0x4,%al
+  802857:	74 2b                	je     802884 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802859:	41 89 c1             	mov    %eax,%r9d
+  80285c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802862:	4c 89 f1             	mov    %r14,%rcx
+  802865:	ba 00 00 00 00       	mov    $0x0,%edx
+  80286a:	48 89 de             	mov    %rbx,%rsi
+  80286d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802872:	48 b8 d8 1d 80 00 00 	movabs $0x801dd8,%rax
+  802879:	00 00 00 
+  80287c:	ff d0                	call   *%rax
+  80287e:	89 c3                	mov    %eax,%ebx
+  802880:	85 c0                	test   %eax,%eax
+  802882:	78 4e                	js     8028d2 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802884:	4c 89 ff             	mov    %r15,%rdi
+  802887:	48 b8 d7 3f 80 00 00 	movabs $0x803fd7,%rax
+  80288e:	00 00 00 
+  802891:	ff d0                	call   *%rax
+  802893:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802896:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80289c:	4c 89 e9             	mov    %r13,%rcx
+  80289f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028a4:	4c 89 fe             	mov    %r15,%rsi
+  8028a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028ac:	48 b8 d8 1d 80 00 00 	movabs $0x801dd8,%rax
+  8028b3:	00 00 00 
+  8028b6:	ff d0                	call   *%rax
+  8028b8:	89 c3                	mov    %eax,%ebx
+  8028ba:	85 c0                	test   %eax,%eax
+  8028bc:	78 14                	js     8028d2 <dup+0xf7>
+
+    return newfdnum;
+  8028be:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8028c1:	89 d8                	mov    %ebx,%eax
+  8028c3:	48 83 c4 18          	add    $0x18,%rsp
+  8028c7:	5b                   	pop    %rbx
+  8028c8:	41 5c                	pop    %r12
+  8028ca:	41 5d                	pop    %r13
+  8028cc:	41 5e                	pop    %r14
+  8028ce:	41 5f                	pop    %r15
+  8028d0:	5d                   	pop    %rbp
+  8028d1:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8028d2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028d7:	4c 89 ee             	mov    %r13,%rsi
+  8028da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028df:	49 bc 3d 1e 80 00 00 	movabs $0x801e3d,%r12
+  8028e6:	00 00 00 
+  8028e9:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8028ec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028f1:	4c 89 f6             	mov    %r14,%rsi
+  8028f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028f9:	41 ff d4             	call   *%r12
+    return res;
+  8028fc:	eb c3                	jmp    8028c1 <dup+0xe6>
+
+00000000008028fe <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8028fe:	55                   	push   %rbp
+  8028ff:	48 89 e5             	mov    %rsp,%rbp
+  802902:	41 56                	push   %r14
+  802904:	41 55                	push   %r13
+  802906:	41 54                	push   %r12
+  802908:	53                   	push   %rbx
+  802909:	48 83 ec 10          	sub    $0x10,%rsp
+  80290d:	89 fb                	mov    %edi,%ebx
+  80290f:	49 89 f4             	mov    %rsi,%r12
+  802912:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802915:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802919:	48 b8 1b 26 80 00 00 	movabs $0x80261b,%rax
+  802920:	00 00 00 
+  802923:	ff d0                	call   *%rax
+  802925:	85 c0                	test   %eax,%eax
+  802927:	78 4c                	js     802975 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802929:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80292d:	41 8b 3e             	mov    (%r14),%edi
+  802930:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802934:	48 b8 66 26 80 00 00 	movabs $0x802666,%rax
+  80293b:	00 00 00 
+  80293e:	ff d0                	call   *%rax
+  802940:	85 c0                	test   %eax,%eax
+  802942:	78 35                	js     802979 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802944:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802948:	83 e0 03             	and    $0x3,%eax
+  80294b:	83 f8 01             	cmp    $0x1,%eax
+  80294e:	74 2d                	je     80297d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802950:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802954:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802958:	48 85 c0             	test   %rax,%rax
+  80295b:	74 56                	je     8029b3 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80295d:	4c 89 ea             	mov    %r13,%rdx
+  802960:	4c 89 e6             	mov    %r12,%rsi
+  802963:	4c 89 f7             	mov    %r14,%rdi
+  802966:	ff d0                	call   *%rax
+}
+  802968:	48 83 c4 10          	add    $0x10,%rsp
+  80296c:	5b                   	pop    %rbx
+  80296d:	41 5c                	pop    %r12
+  80296f:	41 5d                	pop    %r13
+  802971:	41 5e                	pop    %r14
+  802973:	5d                   	pop    %rbp
+  802974:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802975:	48 98                	cltq
+  802977:	eb ef                	jmp    802968 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802979:	48 98                	cltq
+  80297b:	eb eb                	jmp    802968 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80297d:	48 a1 18 60 80 00 00 	movabs 0x806018,%rax
+  802984:	00 00 00 
+  802987:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80298d:	89 da                	mov    %ebx,%edx
+  80298f:	48 bf f9 49 80 00 00 	movabs $0x8049f9,%rdi
+  802996:	00 00 00 
+  802999:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299e:	48 b9 52 0d 80 00 00 	movabs $0x800d52,%rcx
+  8029a5:	00 00 00 
+  8029a8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8029aa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8029b1:	eb b5                	jmp    802968 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8029b3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8029ba:	eb ac                	jmp    802968 <read+0x6a>
+
+00000000008029bc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8029bc:	55                   	push   %rbp
+  8029bd:	48 89 e5             	mov    %rsp,%rbp
+  8029c0:	41 57                	push   %r15
+  8029c2:	41 56                	push   %r14
+  8029c4:	41 55                	push   %r13
+  8029c6:	41 54                	push   %r12
+  8029c8:	53                   	push   %rbx
+  8029c9:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8029cd:	48 85 d2             	test   %rdx,%rdx
+  8029d0:	74 54                	je     802a26 <readn+0x6a>
+  8029d2:	41 89 fd             	mov    %edi,%r13d
+  8029d5:	49 89 f6             	mov    %rsi,%r14
+  8029d8:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8029db:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8029e0:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8029e5:	49 bf fe 28 80 00 00 	movabs $0x8028fe,%r15
+  8029ec:	00 00 00 
+  8029ef:	4c 89 e2             	mov    %r12,%rdx
+  8029f2:	48 29 f2             	sub    %rsi,%rdx
+  8029f5:	4c 01 f6             	add    %r14,%rsi
+  8029f8:	44 89 ef             	mov    %r13d,%edi
+  8029fb:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8029fe:	85 c0                	test   %eax,%eax
+  802a00:	78 20                	js     802a22 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802a02:	01 c3                	add    %eax,%ebx
+  802a04:	85 c0                	test   %eax,%eax
+  802a06:	74 08                	je     802a10 <readn+0x54>
+  802a08:	48 63 f3             	movslq %ebx,%rsi
+  802a0b:	4c 39 e6             	cmp    %r12,%rsi
+  802a0e:	72 df                	jb     8029ef <readn+0x33>
+    }
+    return res;
+  802a10:	48 63 c3             	movslq %ebx,%rax
+}
+  802a13:	48 83 c4 08          	add    $0x8,%rsp
+  802a17:	5b                   	pop    %rbx
+  802a18:	41 5c                	pop    %r12
+  802a1a:	41 5d                	pop    %r13
+  802a1c:	41 5e                	pop    %r14
+  802a1e:	41 5f                	pop    %r15
+  802a20:	5d                   	pop    %rbp
+  802a21:	c3                   	ret
+        if (inc < 0) return inc;
+  802a22:	48 98                	cltq
+  802a24:	eb ed                	jmp    802a13 <readn+0x57>
+    int inc = 1, res = 0;
+  802a26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a2b:	eb e3                	jmp    802a10 <readn+0x54>
+
+0000000000802a2d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802a2d:	55                   	push   %rbp
+  802a2e:	48 89 e5             	mov    %rsp,%rbp
+  802a31:	41 56                	push   %r14
+  802a33:	41 55                	push   %r13
+  802a35:	41 54                	push   %r12
+  802a37:	53                   	push   %rbx
+  802a38:	48 83 ec 10          	sub    $0x10,%rsp
+  802a3c:	89 fb                	mov    %edi,%ebx
+  802a3e:	49 89 f4             	mov    %rsi,%r12
+  802a41:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a44:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802a48:	48 b8 1b 26 80 00 00 	movabs $0x80261b,%rax
+  802a4f:	00 00 00 
+  802a52:	ff d0                	call   *%rax
+  802a54:	85 c0                	test   %eax,%eax
+  802a56:	78 47                	js     802a9f <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a58:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802a5c:	41 8b 3e             	mov    (%r14),%edi
+  802a5f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802a63:	48 b8 66 26 80 00 00 	movabs $0x802666,%rax
+  802a6a:	00 00 00 
+  802a6d:	ff d0                	call   *%rax
+  802a6f:	85 c0                	test   %eax,%eax
+  802a71:	78 30                	js     802aa3 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802a73:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802a78:	74 2d                	je     802aa7 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802a7a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a7e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802a82:	48 85 c0             	test   %rax,%rax
+  802a85:	74 56                	je     802add <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802a87:	4c 89 ea             	mov    %r13,%rdx
+  802a8a:	4c 89 e6             	mov    %r12,%rsi
+  802a8d:	4c 89 f7             	mov    %r14,%rdi
+  802a90:	ff d0                	call   *%rax
+}
+  802a92:	48 83 c4 10          	add    $0x10,%rsp
+  802a96:	5b                   	pop    %rbx
+  802a97:	41 5c                	pop    %r12
+  802a99:	41 5d                	pop    %r13
+  802a9b:	41 5e                	pop    %r14
+  802a9d:	5d                   	pop    %rbp
+  802a9e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a9f:	48 98                	cltq
+  802aa1:	eb ef                	jmp    802a92 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802aa3:	48 98                	cltq
+  802aa5:	eb eb                	jmp    802a92 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802aa7:	48 a1 18 60 80 00 00 	movabs 0x806018,%rax
+  802aae:	00 00 00 
+  802ab1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802ab7:	89 da                	mov    %ebx,%edx
+  802ab9:	48 bf 15 4a 80 00 00 	movabs $0x804a15,%rdi
+  802ac0:	00 00 00 
+  802ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac8:	48 b9 52 0d 80 00 00 	movabs $0x800d52,%rcx
+  802acf:	00 00 00 
+  802ad2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802ad4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802adb:	eb b5                	jmp    802a92 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802add:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802ae4:	eb ac                	jmp    802a92 <write+0x65>
+
+0000000000802ae6 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802ae6:	55                   	push   %rbp
+  802ae7:	48 89 e5             	mov    %rsp,%rbp
+  802aea:	53                   	push   %rbx
+  802aeb:	48 83 ec 18          	sub    $0x18,%rsp
+  802aef:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802af1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802af5:	48 b8 1b 26 80 00 00 	movabs $0x80261b,%rax
+  802afc:	00 00 00 
+  802aff:	ff d0                	call   *%rax
+  802b01:	85 c0                	test   %eax,%eax
+  802b03:	78 0c                	js     802b11 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802b05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b09:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802b0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b11:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b15:	c9                   	leave
+  802b16:	c3                   	ret
+
+0000000000802b17 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802b17:	55                   	push   %rbp
+  802b18:	48 89 e5             	mov    %rsp,%rbp
+  802b1b:	41 55                	push   %r13
+  802b1d:	41 54                	push   %r12
+  802b1f:	53                   	push   %rbx
+  802b20:	48 83 ec 18          	sub    $0x18,%rsp
+  802b24:	89 fb                	mov    %edi,%ebx
+  802b26:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802b29:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802b2d:	48 b8 1b 26 80 00 00 	movabs $0x80261b,%rax
+  802b34:	00 00 00 
+  802b37:	ff d0                	call   *%rax
+  802b39:	85 c0                	test   %eax,%eax
+  802b3b:	78 38                	js     802b75 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802b3d:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802b41:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802b45:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802b49:	48 b8 66 26 80 00 00 	movabs $0x802666,%rax
+  802b50:	00 00 00 
+  802b53:	ff d0                	call   *%rax
+  802b55:	85 c0                	test   %eax,%eax
+  802b57:	78 1c                	js     802b75 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802b59:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802b5e:	74 20                	je     802b80 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802b60:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b64:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802b68:	48 85 c0             	test   %rax,%rax
+  802b6b:	74 47                	je     802bb4 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802b6d:	44 89 e6             	mov    %r12d,%esi
+  802b70:	4c 89 ef             	mov    %r13,%rdi
+  802b73:	ff d0                	call   *%rax
+}
+  802b75:	48 83 c4 18          	add    $0x18,%rsp
+  802b79:	5b                   	pop    %rbx
+  802b7a:	41 5c                	pop    %r12
+  802b7c:	41 5d                	pop    %r13
+  802b7e:	5d                   	pop    %rbp
+  802b7f:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802b80:	48 a1 18 60 80 00 00 	movabs 0x806018,%rax
+  802b87:	00 00 00 
+  802b8a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802b90:	89 da                	mov    %ebx,%edx
+  802b92:	48 bf d8 49 80 00 00 	movabs $0x8049d8,%rdi
+  802b99:	00 00 00 
+  802b9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba1:	48 b9 52 0d 80 00 00 	movabs $0x800d52,%rcx
+  802ba8:	00 00 00 
+  802bab:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802bad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bb2:	eb c1                	jmp    802b75 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802bb4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802bb9:	eb ba                	jmp    802b75 <ftruncate+0x5e>
+
+0000000000802bbb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802bbb:	55                   	push   %rbp
+  802bbc:	48 89 e5             	mov    %rsp,%rbp
+  802bbf:	41 54                	push   %r12
+  802bc1:	53                   	push   %rbx
+  802bc2:	48 83 ec 10          	sub    $0x10,%rsp
+  802bc6:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802bc9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802bcd:	48 b8 1b 26 80 00 00 	movabs $0x80261b,%rax
+  802bd4:	00 00 00 
+  802bd7:	ff d0                	call   *%rax
+  802bd9:	85 c0                	test   %eax,%eax
+  802bdb:	78 4e                	js     802c2b <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802bdd:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802be1:	41 8b 3c 24          	mov    (%r12),%edi
+  802be5:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802be9:	48 b8 66 26 80 00 00 	movabs $0x802666,%rax
+  802bf0:	00 00 00 
+  802bf3:	ff d0                	call   *%rax
+  802bf5:	85 c0                	test   %eax,%eax
+  802bf7:	78 32                	js     802c2b <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802bf9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802bfd:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802c02:	74 30                	je     802c34 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802c04:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802c07:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802c0e:	00 00 00 
+    stat->st_isdir = 0;
+  802c11:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802c18:	00 00 00 
+    stat->st_dev = dev;
+  802c1b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802c22:	48 89 de             	mov    %rbx,%rsi
+  802c25:	4c 89 e7             	mov    %r12,%rdi
+  802c28:	ff 50 28             	call   *0x28(%rax)
+}
+  802c2b:	48 83 c4 10          	add    $0x10,%rsp
+  802c2f:	5b                   	pop    %rbx
+  802c30:	41 5c                	pop    %r12
+  802c32:	5d                   	pop    %rbp
+  802c33:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802c34:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802c39:	eb f0                	jmp    802c2b <fstat+0x70>
+
+0000000000802c3b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802c3b:	55                   	push   %rbp
+  802c3c:	48 89 e5             	mov    %rsp,%rbp
+  802c3f:	41 54                	push   %r12
+  802c41:	53                   	push   %rbx
+  802c42:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802c45:	be 00 00 00 00       	mov    $0x0,%esi
+  802c4a:	48 b8 bc 2e 80 00 00 	movabs $0x802ebc,%rax
+  802c51:	00 00 00 
+  802c54:	ff d0                	call   *%rax
+  802c56:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802c58:	85 c0                	test   %eax,%eax
+  802c5a:	78 25                	js     802c81 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802c5c:	4c 89 e6             	mov    %r12,%rsi
+  802c5f:	89 c7                	mov    %eax,%edi
+  802c61:	48 b8 bb 2b 80 00 00 	movabs $0x802bbb,%rax
+  802c68:	00 00 00 
+  802c6b:	ff d0                	call   *%rax
+  802c6d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802c70:	89 df                	mov    %ebx,%edi
+  802c72:	48 b8 80 27 80 00 00 	movabs $0x802780,%rax
+  802c79:	00 00 00 
+  802c7c:	ff d0                	call   *%rax
+
+    return res;
+  802c7e:	44 89 e3             	mov    %r12d,%ebx
+}
+  802c81:	89 d8                	mov    %ebx,%eax
+  802c83:	5b                   	pop    %rbx
+  802c84:	41 5c                	pop    %r12
+  802c86:	5d                   	pop    %rbp
+  802c87:	c3                   	ret
+
+0000000000802c88 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802c88:	55                   	push   %rbp
+  802c89:	48 89 e5             	mov    %rsp,%rbp
+  802c8c:	41 54                	push   %r12
+  802c8e:	53                   	push   %rbx
+  802c8f:	48 83 ec 10          	sub    $0x10,%rsp
+  802c93:	41 89 fc             	mov    %edi,%r12d
+  802c96:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c99:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802ca0:	00 00 00 
+  802ca3:	83 38 00             	cmpl   $0x0,(%rax)
+  802ca6:	74 5e                	je     802d06 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802ca8:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802cae:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802cb3:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802cba:	00 00 00 
+  802cbd:	44 89 e6             	mov    %r12d,%esi
+  802cc0:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802cc7:	00 00 00 
+  802cca:	8b 38                	mov    (%rax),%edi
+  802ccc:	48 b8 68 41 80 00 00 	movabs $0x804168,%rax
+  802cd3:	00 00 00 
+  802cd6:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802cd8:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802cdf:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802ce0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ce5:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802ce9:	48 89 de             	mov    %rbx,%rsi
+  802cec:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cf1:	48 b8 d3 40 80 00 00 	movabs $0x8040d3,%rax
+  802cf8:	00 00 00 
+  802cfb:	ff d0                	call   *%rax
+}
+  802cfd:	48 83 c4 10          	add    $0x10,%rsp
+  802d01:	5b                   	pop    %rbx
+  802d02:	41 5c                	pop    %r12
+  802d04:	5d                   	pop    %rbp
+  802d05:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802d06:	bf 03 00 00 00       	mov    $0x3,%edi
+  802d0b:	48 b8 08 42 80 00 00 	movabs $0x804208,%rax
+  802d12:	00 00 00 
+  802d15:	ff d0                	call   *%rax
+  802d17:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802d1e:	00 00 
+  802d20:	eb 86                	jmp    802ca8 <fsipc+0x20>
+
+0000000000802d22 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802d22:	55                   	push   %rbp
+  802d23:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802d26:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802d2d:	00 00 00 
+  802d30:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802d33:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802d35:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802d38:	be 00 00 00 00       	mov    $0x0,%esi
+  802d3d:	bf 02 00 00 00       	mov    $0x2,%edi
+  802d42:	48 b8 88 2c 80 00 00 	movabs $0x802c88,%rax
+  802d49:	00 00 00 
+  802d4c:	ff d0                	call   *%rax
+}
+  802d4e:	5d                   	pop    %rbp
+  802d4f:	c3                   	ret
+
+0000000000802d50 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802d50:	55                   	push   %rbp
+  802d51:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802d54:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802d57:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802d5e:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802d60:	be 00 00 00 00       	mov    $0x0,%esi
+  802d65:	bf 06 00 00 00       	mov    $0x6,%edi
+  802d6a:	48 b8 88 2c 80 00 00 	movabs $0x802c88,%rax
+  802d71:	00 00 00 
+  802d74:	ff d0                	call   *%rax
+}
+  802d76:	5d                   	pop    %rbp
+  802d77:	c3                   	ret
+
+0000000000802d78 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802d78:	55                   	push   %rbp
+  802d79:	48 89 e5             	mov    %rsp,%rbp
+  802d7c:	41 54                	push   %r12
+  802d7e:	53                   	push   %rbx
+  802d7f:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802d82:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802d85:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802d8c:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802d8e:	be 00 00 00 00       	mov    $0x0,%esi
+  802d93:	bf 05 00 00 00       	mov    $0x5,%edi
+  802d98:	48 b8 88 2c 80 00 00 	movabs $0x802c88,%rax
+  802d9f:	00 00 00 
+  802da2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802da4:	85 c0                	test   %eax,%eax
+  802da6:	78 3d                	js     802de5 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802da8:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802daf:	00 00 00 
+  802db2:	4c 89 e6             	mov    %r12,%rsi
+  802db5:	48 89 df             	mov    %rbx,%rdi
+  802db8:	48 b8 77 16 80 00 00 	movabs $0x801677,%rax
+  802dbf:	00 00 00 
+  802dc2:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802dc4:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802dcb:	00 
+  802dcc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802dd2:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802dd9:	00 
+  802dda:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802de0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802de5:	5b                   	pop    %rbx
+  802de6:	41 5c                	pop    %r12
+  802de8:	5d                   	pop    %rbp
+  802de9:	c3                   	ret
+
+0000000000802dea <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802dea:	55                   	push   %rbp
+  802deb:	48 89 e5             	mov    %rsp,%rbp
+  802dee:	41 54                	push   %r12
+  802df0:	53                   	push   %rbx
+  802df1:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  802df4:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802df9:	48 39 c2             	cmp    %rax,%rdx
+  802dfc:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802e00:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802e03:	48 89 c2             	mov    %rax,%rdx
+  802e06:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802e0d:	00 00 00 
+  802e10:	48 b8 d8 18 80 00 00 	movabs $0x8018d8,%rax
+  802e17:	00 00 00 
+  802e1a:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802e1c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802e23:	00 00 00 
+  802e26:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802e2b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802e2d:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  802e31:	be 00 00 00 00       	mov    $0x0,%esi
+  802e36:	bf 04 00 00 00       	mov    $0x4,%edi
+  802e3b:	48 b8 88 2c 80 00 00 	movabs $0x802c88,%rax
+  802e42:	00 00 00 
+  802e45:	ff d0                	call   *%rax
+  802e47:	48 98                	cltq
+}
+  802e49:	5b                   	pop    %rbx
+  802e4a:	41 5c                	pop    %r12
+  802e4c:	5d                   	pop    %rbp
+  802e4d:	c3                   	ret
+
+0000000000802e4e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802e4e:	55                   	push   %rbp
+  802e4f:	48 89 e5             	mov    %rsp,%rbp
+  802e52:	41 54                	push   %r12
+  802e54:	53                   	push   %rbx
+  802e55:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e58:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802e5f:	00 00 00 
+  802e62:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802e65:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  802e67:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802e6c:	48 39 ca             	cmp    %rcx,%rdx
+  802e6f:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  802e73:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  802e77:	be 00 00 00 00       	mov    $0x0,%esi
+  802e7c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e81:	48 b8 88 2c 80 00 00 	movabs $0x802c88,%rax
+  802e88:	00 00 00 
+  802e8b:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802e8d:	85 c0                	test   %eax,%eax
+  802e8f:	78 27                	js     802eb8 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802e91:	48 63 d8             	movslq %eax,%rbx
+  802e94:	48 89 da             	mov    %rbx,%rdx
+  802e97:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  802e9e:	00 00 00 
+  802ea1:	4c 89 e7             	mov    %r12,%rdi
+  802ea4:	48 b8 d8 18 80 00 00 	movabs $0x8018d8,%rax
+  802eab:	00 00 00 
+  802eae:	ff d0                	call   *%rax
+    return bytes_read;
+  802eb0:	48 89 d8             	mov    %rbx,%rax
+}
+  802eb3:	5b                   	pop    %rbx
+  802eb4:	41 5c                	pop    %r12
+  802eb6:	5d                   	pop    %rbp
+  802eb7:	c3                   	ret
+        return bytes_read;
+  802eb8:	48 98                	cltq
+  802eba:	eb f7                	jmp    802eb3 <devfile_read+0x65>
+
+0000000000802ebc <open>:
+open(const char *path, int mode) {
+  802ebc:	55                   	push   %rbp
+  802ebd:	48 89 e5             	mov    %rsp,%rbp
+  802ec0:	41 55                	push   %r13
+  802ec2:	41 54                	push   %r12
+  802ec4:	53                   	push   %rbx
+  802ec5:	48 83 ec 18          	sub    $0x18,%rsp
+  802ec9:	49 89 fc             	mov    %rdi,%r12
+  802ecc:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802ecf:	48 b8 39 16 80 00 00 	movabs $0x801639,%rax
+  802ed6:	00 00 00 
+  802ed9:	ff d0                	call   *%rax
+  802edb:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802ee1:	0f 87 8a 00 00 00    	ja     802f71 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ee7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802eeb:	48 b8 bb 25 80 00 00 	movabs $0x8025bb,%rax
+  802ef2:	00 00 00 
+  802ef5:	ff d0                	call   *%rax
+  802ef7:	89 c3                	mov    %eax,%ebx
+  802ef9:	85 c0                	test   %eax,%eax
+  802efb:	78 50                	js     802f4d <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802efd:	4c 89 e6             	mov    %r12,%rsi
+  802f00:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802f07:	00 00 00 
+  802f0a:	48 89 df             	mov    %rbx,%rdi
+  802f0d:	48 b8 77 16 80 00 00 	movabs $0x801677,%rax
+  802f14:	00 00 00 
+  802f17:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802f19:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802f20:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f24:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f29:	48 b8 88 2c 80 00 00 	movabs $0x802c88,%rax
+  802f30:	00 00 00 
+  802f33:	ff d0                	call   *%rax
+  802f35:	89 c3                	mov    %eax,%ebx
+  802f37:	85 c0                	test   %eax,%eax
+  802f39:	78 1f                	js     802f5a <open+0x9e>
+    return fd2num(fd);
+  802f3b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f3f:	48 b8 8d 25 80 00 00 	movabs $0x80258d,%rax
+  802f46:	00 00 00 
+  802f49:	ff d0                	call   *%rax
+  802f4b:	89 c3                	mov    %eax,%ebx
+}
+  802f4d:	89 d8                	mov    %ebx,%eax
+  802f4f:	48 83 c4 18          	add    $0x18,%rsp
+  802f53:	5b                   	pop    %rbx
+  802f54:	41 5c                	pop    %r12
+  802f56:	41 5d                	pop    %r13
+  802f58:	5d                   	pop    %rbp
+  802f59:	c3                   	ret
+        fd_close(fd, 0);
+  802f5a:	be 00 00 00 00       	mov    $0x0,%esi
+  802f5f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f63:	48 b8 d6 26 80 00 00 	movabs $0x8026d6,%rax
+  802f6a:	00 00 00 
+  802f6d:	ff d0                	call   *%rax
+        return res;
+  802f6f:	eb dc                	jmp    802f4d <open+0x91>
+        return -E_BAD_PATH;
+  802f71:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802f76:	eb d5                	jmp    802f4d <open+0x91>
+
+0000000000802f78 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802f78:	55                   	push   %rbp
+  802f79:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802f7c:	be 00 00 00 00       	mov    $0x0,%esi
+  802f81:	bf 08 00 00 00       	mov    $0x8,%edi
+  802f86:	48 b8 88 2c 80 00 00 	movabs $0x802c88,%rax
+  802f8d:	00 00 00 
+  802f90:	ff d0                	call   *%rax
+}
+  802f92:	5d                   	pop    %rbp
+  802f93:	c3                   	ret
+
+0000000000802f94 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  802f94:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  802f98:	7f 01                	jg     802f9b <writebuf+0x7>
+  802f9a:	c3                   	ret
+writebuf(struct printbuf *state) {
+  802f9b:	55                   	push   %rbp
+  802f9c:	48 89 e5             	mov    %rsp,%rbp
+  802f9f:	53                   	push   %rbx
+  802fa0:	48 83 ec 08          	sub    $0x8,%rsp
+  802fa4:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  802fa7:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  802fab:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  802faf:	8b 3f                	mov    (%rdi),%edi
+  802fb1:	48 b8 2d 2a 80 00 00 	movabs $0x802a2d,%rax
+  802fb8:	00 00 00 
+  802fbb:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  802fbd:	48 85 c0             	test   %rax,%rax
+  802fc0:	7e 04                	jle    802fc6 <writebuf+0x32>
+  802fc2:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  802fc6:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  802fca:	48 39 c2             	cmp    %rax,%rdx
+  802fcd:	74 0f                	je     802fde <writebuf+0x4a>
+            state->error = MIN(0, result);
+  802fcf:	48 85 c0             	test   %rax,%rax
+  802fd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fd7:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802fdb:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  802fde:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fe2:	c9                   	leave
+  802fe3:	c3                   	ret
+
+0000000000802fe4 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  802fe4:	8b 46 04             	mov    0x4(%rsi),%eax
+  802fe7:	8d 50 01             	lea    0x1(%rax),%edx
+  802fea:	89 56 04             	mov    %edx,0x4(%rsi)
+  802fed:	48 98                	cltq
+  802fef:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  802ff4:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  802ffa:	74 01                	je     802ffd <putch+0x19>
+  802ffc:	c3                   	ret
+putch(int ch, void *arg) {
+  802ffd:	55                   	push   %rbp
+  802ffe:	48 89 e5             	mov    %rsp,%rbp
+  803001:	53                   	push   %rbx
+  803002:	48 83 ec 08          	sub    $0x8,%rsp
+  803006:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803009:	48 89 f7             	mov    %rsi,%rdi
+  80300c:	48 b8 94 2f 80 00 00 	movabs $0x802f94,%rax
+  803013:	00 00 00 
+  803016:	ff d0                	call   *%rax
+        state->offset = 0;
+  803018:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  80301f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803023:	c9                   	leave
+  803024:	c3                   	ret
+
+0000000000803025 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803025:	55                   	push   %rbp
+  803026:	48 89 e5             	mov    %rsp,%rbp
+  803029:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803030:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803033:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803039:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803040:	00 00 00 
+    state.result = 0;
+  803043:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  80304a:	00 00 00 00 
+    state.error = 1;
+  80304e:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803055:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803058:	48 89 f2             	mov    %rsi,%rdx
+  80305b:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803062:	48 bf e4 2f 80 00 00 	movabs $0x802fe4,%rdi
+  803069:	00 00 00 
+  80306c:	48 b8 a2 0e 80 00 00 	movabs $0x800ea2,%rax
+  803073:	00 00 00 
+  803076:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803078:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  80307f:	7f 14                	jg     803095 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803081:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803088:	48 85 c0             	test   %rax,%rax
+  80308b:	75 06                	jne    803093 <vfprintf+0x6e>
+  80308d:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803093:	c9                   	leave
+  803094:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803095:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  80309c:	48 b8 94 2f 80 00 00 	movabs $0x802f94,%rax
+  8030a3:	00 00 00 
+  8030a6:	ff d0                	call   *%rax
+  8030a8:	eb d7                	jmp    803081 <vfprintf+0x5c>
+
+00000000008030aa <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8030aa:	55                   	push   %rbp
+  8030ab:	48 89 e5             	mov    %rsp,%rbp
+  8030ae:	48 83 ec 50          	sub    $0x50,%rsp
+  8030b2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8030b6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8030ba:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8030be:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8030c2:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8030c9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8030cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030d1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8030d5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  8030d9:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8030dd:	48 b8 25 30 80 00 00 	movabs $0x803025,%rax
+  8030e4:	00 00 00 
+  8030e7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8030e9:	c9                   	leave
+  8030ea:	c3                   	ret
+
+00000000008030eb <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8030eb:	55                   	push   %rbp
+  8030ec:	48 89 e5             	mov    %rsp,%rbp
+  8030ef:	48 83 ec 50          	sub    $0x50,%rsp
+  8030f3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8030f7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8030fb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8030ff:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803103:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803107:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80310e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803112:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803116:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80311a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  80311e:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803122:	48 89 fe             	mov    %rdi,%rsi
+  803125:	bf 01 00 00 00       	mov    $0x1,%edi
+  80312a:	48 b8 25 30 80 00 00 	movabs $0x803025,%rax
+  803131:	00 00 00 
+  803134:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803136:	c9                   	leave
+  803137:	c3                   	ret
+
+0000000000803138 <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  803138:	55                   	push   %rbp
+  803139:	48 89 e5             	mov    %rsp,%rbp
+  80313c:	41 55                	push   %r13
+  80313e:	41 54                	push   %r12
+  803140:	53                   	push   %rbx
+  803141:	48 83 ec 08          	sub    $0x8,%rsp
+  803145:	48 89 fb             	mov    %rdi,%rbx
+  803148:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  80314b:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  80314e:	48 b8 d7 3f 80 00 00 	movabs $0x803fd7,%rax
+  803155:	00 00 00 
+  803158:	ff d0                	call   *%rax
+  80315a:	41 89 c1             	mov    %eax,%r9d
+  80315d:	4d 89 e0             	mov    %r12,%r8
+  803160:	49 29 d8             	sub    %rbx,%r8
+  803163:	48 89 d9             	mov    %rbx,%rcx
+  803166:	44 89 ea             	mov    %r13d,%edx
+  803169:	48 89 de             	mov    %rbx,%rsi
+  80316c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803171:	48 b8 d8 1d 80 00 00 	movabs $0x801dd8,%rax
+  803178:	00 00 00 
+  80317b:	ff d0                	call   *%rax
+}
+  80317d:	48 83 c4 08          	add    $0x8,%rsp
+  803181:	5b                   	pop    %rbx
+  803182:	41 5c                	pop    %r12
+  803184:	41 5d                	pop    %r13
+  803186:	5d                   	pop    %rbp
+  803187:	c3                   	ret
+
+0000000000803188 <spawn>:
+spawn(const char *prog, const char **argv) {
+  803188:	55                   	push   %rbp
+  803189:	48 89 e5             	mov    %rsp,%rbp
+  80318c:	41 57                	push   %r15
+  80318e:	41 56                	push   %r14
+  803190:	41 55                	push   %r13
+  803192:	41 54                	push   %r12
+  803194:	53                   	push   %rbx
+  803195:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  80319c:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  80319f:	be 00 00 00 00       	mov    $0x0,%esi
+  8031a4:	48 b8 bc 2e 80 00 00 	movabs $0x802ebc,%rax
+  8031ab:	00 00 00 
+  8031ae:	ff d0                	call   *%rax
+  8031b0:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+    if (fd < 0) return fd;
+  8031b6:	85 c0                	test   %eax,%eax
+  8031b8:	0f 88 51 06 00 00    	js     80380f <spawn+0x687>
+  8031be:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  8031c0:	ba 00 02 00 00       	mov    $0x200,%edx
+  8031c5:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  8031cc:	48 b8 bc 29 80 00 00 	movabs $0x8029bc,%rax
+  8031d3:	00 00 00 
+  8031d6:	ff d0                	call   *%rax
+  8031d8:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  8031da:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8031df:	0f 85 76 02 00 00    	jne    80345b <spawn+0x2d3>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  8031e5:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  8031ec:	ff ff 00 
+  8031ef:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  8031f6:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  8031fd:	01 01 00 
+  803200:	48 39 d0             	cmp    %rdx,%rax
+  803203:	0f 85 8e 02 00 00    	jne    803497 <spawn+0x30f>
+        elf->e_type != ET_EXEC /* executable */ ||
+  803209:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  803210:	00 3e 00 
+  803213:	0f 85 7e 02 00 00    	jne    803497 <spawn+0x30f>
+  803219:	b8 08 00 00 00       	mov    $0x8,%eax
+  80321e:	cd 30                	int    $0x30
+  803220:	41 89 c6             	mov    %eax,%r14d
+  803223:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  803225:	85 c0                	test   %eax,%eax
+  803227:	0f 88 ca 05 00 00    	js     8037f7 <spawn+0x66f>
+    envid_t child = res;
+  80322d:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  803233:	0f b6 c0             	movzbl %al,%eax
+  803236:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80323d:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  803244:	00 00 00 
+  803247:	48 01 c6             	add    %rax,%rsi
+  80324a:	48 8b 06             	mov    (%rsi),%rax
+  80324d:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  803254:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  80325b:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  803262:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  803269:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  803270:	48 29 ce             	sub    %rcx,%rsi
+  803273:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  803279:	c1 e9 03             	shr    $0x3,%ecx
+  80327c:	89 c9                	mov    %ecx,%ecx
+  80327e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803281:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  803288:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  80328f:	49 8b 3c 24          	mov    (%r12),%rdi
+  803293:	48 85 ff             	test   %rdi,%rdi
+  803296:	0f 84 8b 05 00 00    	je     803827 <spawn+0x69f>
+  80329c:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  8032a2:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  8032a8:	48 bb 39 16 80 00 00 	movabs $0x801639,%rbx
+  8032af:	00 00 00 
+  8032b2:	ff d3                	call   *%rbx
+  8032b4:	4c 01 f8             	add    %r15,%rax
+  8032b7:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  8032bb:	4c 89 ea             	mov    %r13,%rdx
+  8032be:	49 83 c5 01          	add    $0x1,%r13
+  8032c2:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  8032c7:	48 85 ff             	test   %rdi,%rdi
+  8032ca:	75 e6                	jne    8032b2 <spawn+0x12a>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8032cc:	49 89 d5             	mov    %rdx,%r13
+  8032cf:	48 89 95 e0 fc ff ff 	mov    %rdx,-0x320(%rbp)
+  8032d6:	48 f7 d0             	not    %rax
+  8032d9:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8032e0:	49 89 df             	mov    %rbx,%r15
+  8032e3:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  8032e7:	4c 89 bd f0 fc ff ff 	mov    %r15,-0x310(%rbp)
+  8032ee:	89 d0                	mov    %edx,%eax
+  8032f0:	83 c0 01             	add    $0x1,%eax
+  8032f3:	48 98                	cltq
+  8032f5:	48 c1 e0 03          	shl    $0x3,%rax
+  8032f9:	49 29 c7             	sub    %rax,%r15
+  8032fc:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803303:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  803307:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  80330d:	0f 86 cb 04 00 00    	jbe    8037de <spawn+0x656>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803313:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803318:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80331d:	be 00 00 40 00       	mov    $0x400000,%esi
+  803322:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  803329:	00 00 00 
+  80332c:	ff d0                	call   *%rax
+  80332e:	85 c0                	test   %eax,%eax
+  803330:	0f 88 ad 04 00 00    	js     8037e3 <spawn+0x65b>
+    for (i = 0; i < argc; i++) {
+  803336:	4c 89 e8             	mov    %r13,%rax
+  803339:	45 85 ed             	test   %r13d,%r13d
+  80333c:	7e 54                	jle    803392 <spawn+0x20a>
+  80333e:	4d 89 fd             	mov    %r15,%r13
+  803341:	48 98                	cltq
+  803343:	4d 8d 3c c7          	lea    (%r15,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803347:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  80334e:	00 00 00 
+  803351:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803358:	ff 
+  803359:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  80335d:	49 8b 34 24          	mov    (%r12),%rsi
+  803361:	48 89 df             	mov    %rbx,%rdi
+  803364:	48 b8 77 16 80 00 00 	movabs $0x801677,%rax
+  80336b:	00 00 00 
+  80336e:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803370:	49 8b 3c 24          	mov    (%r12),%rdi
+  803374:	48 b8 39 16 80 00 00 	movabs $0x801639,%rax
+  80337b:	00 00 00 
+  80337e:	ff d0                	call   *%rax
+  803380:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  803385:	49 83 c5 08          	add    $0x8,%r13
+  803389:	49 83 c4 08          	add    $0x8,%r12
+  80338d:	4d 39 fd             	cmp    %r15,%r13
+  803390:	75 b5                	jne    803347 <spawn+0x1bf>
+    argv_store[argc] = 0;
+  803392:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  803399:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  8033a0:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8033a1:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  8033a8:	0f 85 30 01 00 00    	jne    8034de <spawn+0x356>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  8033ae:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  8033b5:	00 00 00 
+  8033b8:	48 8b 9d e8 fc ff ff 	mov    -0x318(%rbp),%rbx
+  8033bf:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  8033c6:	ff 
+  8033c7:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  8033cb:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  8033d2:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  8033d6:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  8033dd:	00 00 00 
+  8033e0:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  8033e7:	ff 
+  8033e8:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  8033ef:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8033f5:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  8033fb:	44 89 f2             	mov    %r14d,%edx
+  8033fe:	be 00 00 40 00       	mov    $0x400000,%esi
+  803403:	bf 00 00 00 00       	mov    $0x0,%edi
+  803408:	48 b8 d8 1d 80 00 00 	movabs $0x801dd8,%rax
+  80340f:	00 00 00 
+  803412:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  803414:	48 bb 3d 1e 80 00 00 	movabs $0x801e3d,%rbx
+  80341b:	00 00 00 
+  80341e:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803423:	be 00 00 40 00       	mov    $0x400000,%esi
+  803428:	bf 00 00 00 00       	mov    $0x0,%edi
+  80342d:	ff d3                	call   *%rbx
+  80342f:	85 c0                	test   %eax,%eax
+  803431:	78 eb                	js     80341e <spawn+0x296>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  803433:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  80343a:	4c 8d a4 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r12
+  803441:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803442:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  803449:	00 
+  80344a:	0f 84 87 02 00 00    	je     8036d7 <spawn+0x54f>
+  803450:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803456:	e9 fe 00 00 00       	jmp    803559 <spawn+0x3d1>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  80345b:	48 bf 60 4a 80 00 00 	movabs $0x804a60,%rdi
+  803462:	00 00 00 
+  803465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346a:	48 ba 52 0d 80 00 00 	movabs $0x800d52,%rdx
+  803471:	00 00 00 
+  803474:	ff d2                	call   *%rdx
+        close(fd);
+  803476:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  80347c:	48 b8 80 27 80 00 00 	movabs $0x802780,%rax
+  803483:	00 00 00 
+  803486:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803488:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  80348f:	ff ff ff 
+  803492:	e9 78 03 00 00       	jmp    80380f <spawn+0x687>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803497:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  80349c:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  8034a2:	48 bf c0 4a 80 00 00 	movabs $0x804ac0,%rdi
+  8034a9:	00 00 00 
+  8034ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b1:	48 b9 52 0d 80 00 00 	movabs $0x800d52,%rcx
+  8034b8:	00 00 00 
+  8034bb:	ff d1                	call   *%rcx
+        close(fd);
+  8034bd:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  8034c3:	48 b8 80 27 80 00 00 	movabs $0x802780,%rax
+  8034ca:	00 00 00 
+  8034cd:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8034cf:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  8034d6:	ff ff ff 
+  8034d9:	e9 31 03 00 00       	jmp    80380f <spawn+0x687>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8034de:	48 b9 90 4a 80 00 00 	movabs $0x804a90,%rcx
+  8034e5:	00 00 00 
+  8034e8:	48 ba fe 42 80 00 00 	movabs $0x8042fe,%rdx
+  8034ef:	00 00 00 
+  8034f2:	be f0 00 00 00       	mov    $0xf0,%esi
+  8034f7:	48 bf da 4a 80 00 00 	movabs $0x804ada,%rdi
+  8034fe:	00 00 00 
+  803501:	b8 00 00 00 00       	mov    $0x0,%eax
+  803506:	49 b8 02 0c 80 00 00 	movabs $0x800c02,%r8
+  80350d:	00 00 00 
+  803510:	41 ff d0             	call   *%r8
+        if (err)
+            return err;
+    }
+
+    /* Allocate filesz in parent to UTEMP */
+    int err = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+  803513:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803518:	4c 89 ea             	mov    %r13,%rdx
+  80351b:	be 00 00 40 00       	mov    $0x400000,%esi
+  803520:	bf 00 00 00 00       	mov    $0x0,%edi
+  803525:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  80352c:	00 00 00 
+  80352f:	ff d0                	call   *%rax
+    if (err)
+  803531:	85 c0                	test   %eax,%eax
+  803533:	0f 84 d2 00 00 00    	je     80360b <spawn+0x483>
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803539:	85 c0                	test   %eax,%eax
+  80353b:	0f 88 99 02 00 00    	js     8037da <spawn+0x652>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803541:	49 83 c7 01          	add    $0x1,%r15
+  803545:	49 83 c4 38          	add    $0x38,%r12
+  803549:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  803550:	49 39 c7             	cmp    %rax,%r15
+  803553:	0f 83 7e 01 00 00    	jae    8036d7 <spawn+0x54f>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  803559:	41 83 3c 24 01       	cmpl   $0x1,(%r12)
+  80355e:	75 e1                	jne    803541 <spawn+0x3b9>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  803560:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803565:	41 89 c6             	mov    %eax,%r14d
+  803568:	41 83 e6 02          	and    $0x2,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  80356c:	44 89 f2             	mov    %r14d,%edx
+  80356f:	83 ca 04             	or     $0x4,%edx
+  803572:	a8 04                	test   $0x4,%al
+  803574:	44 0f 45 f2          	cmovne %edx,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  803578:	44 89 f2             	mov    %r14d,%edx
+  80357b:	83 ca 01             	or     $0x1,%edx
+  80357e:	a8 01                	test   $0x1,%al
+  803580:	44 0f 45 f2          	cmovne %edx,%r14d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803584:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  803589:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  80358f:	4d 8b 6c 24 20       	mov    0x20(%r12),%r13
+  803594:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  803599:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  80359e:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  8035a4:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  8035aa:	89 d9                	mov    %ebx,%ecx
+  8035ac:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8035b2:	74 14                	je     8035c8 <spawn+0x440>
+        va -= res;
+  8035b4:	48 63 f1             	movslq %ecx,%rsi
+  8035b7:	48 29 f3             	sub    %rsi,%rbx
+        memsz += res;
+  8035ba:	48 01 f2             	add    %rsi,%rdx
+        filesz += res;
+  8035bd:	49 01 f5             	add    %rsi,%r13
+        fileoffset -= res;
+  8035c0:	29 c8                	sub    %ecx,%eax
+  8035c2:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    filesz = ROUNDUP(filesz, PAGE_SIZE);
+  8035c8:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8035cf:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    if (filesz < memsz) {
+  8035d6:	49 39 d5             	cmp    %rdx,%r13
+  8035d9:	0f 83 34 ff ff ff    	jae    803513 <spawn+0x38b>
+        int err = sys_alloc_region(child, (void *)va + filesz, memsz - filesz, PROT_RW);
+  8035df:	4c 29 ea             	sub    %r13,%rdx
+  8035e2:	49 8d 74 1d 00       	lea    0x0(%r13,%rbx,1),%rsi
+  8035e7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8035ec:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  8035f2:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  8035f9:	00 00 00 
+  8035fc:	ff d0                	call   *%rax
+        if (err)
+  8035fe:	85 c0                	test   %eax,%eax
+  803600:	0f 84 0d ff ff ff    	je     803513 <spawn+0x38b>
+  803606:	e9 2e ff ff ff       	jmp    803539 <spawn+0x3b1>
+        return err;
+
+    /* seek() fd to fileoffset  */
+    err = seek(fd, fileoffset);
+  80360b:	8b b5 f0 fc ff ff    	mov    -0x310(%rbp),%esi
+  803611:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  803617:	48 b8 e6 2a 80 00 00 	movabs $0x802ae6,%rax
+  80361e:	00 00 00 
+  803621:	ff d0                	call   *%rax
+    if (err)
+  803623:	85 c0                	test   %eax,%eax
+  803625:	0f 85 0e ff ff ff    	jne    803539 <spawn+0x3b1>
+        return err;
+
+    /* read filesz to UTEMP */
+    ssize_t bytes_read = readn(fd, UTEMP, filesz);
+  80362b:	4c 89 ea             	mov    %r13,%rdx
+  80362e:	be 00 00 40 00       	mov    $0x400000,%esi
+  803633:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  803639:	48 b8 bc 29 80 00 00 	movabs $0x8029bc,%rax
+  803640:	00 00 00 
+  803643:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  803645:	48 85 c0             	test   %rax,%rax
+  803648:	0f 88 eb fe ff ff    	js     803539 <spawn+0x3b1>
+        return bytes_read;
+    assert(bytes_read == filesz);
+  80364e:	4c 39 e8             	cmp    %r13,%rax
+  803651:	75 4f                	jne    8036a2 <spawn+0x51a>
+
+    /* Map read section conents to child */
+    err = sys_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+  803653:	45 89 f1             	mov    %r14d,%r9d
+  803656:	41 80 c9 80          	or     $0x80,%r9b
+  80365a:	4d 89 e8             	mov    %r13,%r8
+  80365d:	48 89 d9             	mov    %rbx,%rcx
+  803660:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  803666:	be 00 00 40 00       	mov    $0x400000,%esi
+  80366b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803670:	48 b8 d8 1d 80 00 00 	movabs $0x801dd8,%rax
+  803677:	00 00 00 
+  80367a:	ff d0                	call   *%rax
+    if (err)
+  80367c:	85 c0                	test   %eax,%eax
+  80367e:	0f 85 b5 fe ff ff    	jne    803539 <spawn+0x3b1>
+        return err;
+
+    /* Unmap it from parent */
+    err = sys_unmap_region(CURENVID, UTEMP, filesz);
+  803684:	4c 89 ea             	mov    %r13,%rdx
+  803687:	be 00 00 40 00       	mov    $0x400000,%esi
+  80368c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803691:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  803698:	00 00 00 
+  80369b:	ff d0                	call   *%rax
+    if (err)
+  80369d:	e9 97 fe ff ff       	jmp    803539 <spawn+0x3b1>
+    assert(bytes_read == filesz);
+  8036a2:	48 b9 e6 4a 80 00 00 	movabs $0x804ae6,%rcx
+  8036a9:	00 00 00 
+  8036ac:	48 ba fe 42 80 00 00 	movabs $0x8042fe,%rdx
+  8036b3:	00 00 00 
+  8036b6:	be 2f 01 00 00       	mov    $0x12f,%esi
+  8036bb:	48 bf da 4a 80 00 00 	movabs $0x804ada,%rdi
+  8036c2:	00 00 00 
+  8036c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ca:	49 b8 02 0c 80 00 00 	movabs $0x800c02,%r8
+  8036d1:	00 00 00 
+  8036d4:	41 ff d0             	call   *%r8
+    close(fd);
+  8036d7:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  8036dd:	48 b8 80 27 80 00 00 	movabs $0x802780,%rax
+  8036e4:	00 00 00 
+  8036e7:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  8036e9:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  8036f0:	48 bf 38 31 80 00 00 	movabs $0x803138,%rdi
+  8036f7:	00 00 00 
+  8036fa:	48 b8 4b 40 80 00 00 	movabs $0x80404b,%rax
+  803701:	00 00 00 
+  803704:	ff d0                	call   *%rax
+  803706:	85 c0                	test   %eax,%eax
+  803708:	78 49                	js     803753 <spawn+0x5cb>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  80370a:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  803711:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803717:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  80371e:	00 00 00 
+  803721:	ff d0                	call   *%rax
+  803723:	85 c0                	test   %eax,%eax
+  803725:	78 59                	js     803780 <spawn+0x5f8>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  803727:	be 02 00 00 00       	mov    $0x2,%esi
+  80372c:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803732:	48 b8 74 1f 80 00 00 	movabs $0x801f74,%rax
+  803739:	00 00 00 
+  80373c:	ff d0                	call   *%rax
+  80373e:	85 c0                	test   %eax,%eax
+  803740:	78 6b                	js     8037ad <spawn+0x625>
+    return child;
+  803742:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  803748:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+  80374e:	e9 bc 00 00 00       	jmp    80380f <spawn+0x687>
+        panic("copy_shared_region: %i", res);
+  803753:	89 c1                	mov    %eax,%ecx
+  803755:	48 ba fb 4a 80 00 00 	movabs $0x804afb,%rdx
+  80375c:	00 00 00 
+  80375f:	be 84 00 00 00       	mov    $0x84,%esi
+  803764:	48 bf da 4a 80 00 00 	movabs $0x804ada,%rdi
+  80376b:	00 00 00 
+  80376e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803773:	49 b8 02 0c 80 00 00 	movabs $0x800c02,%r8
+  80377a:	00 00 00 
+  80377d:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  803780:	89 c1                	mov    %eax,%ecx
+  803782:	48 ba 12 4b 80 00 00 	movabs $0x804b12,%rdx
+  803789:	00 00 00 
+  80378c:	be 87 00 00 00       	mov    $0x87,%esi
+  803791:	48 bf da 4a 80 00 00 	movabs $0x804ada,%rdi
+  803798:	00 00 00 
+  80379b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037a0:	49 b8 02 0c 80 00 00 	movabs $0x800c02,%r8
+  8037a7:	00 00 00 
+  8037aa:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8037ad:	89 c1                	mov    %eax,%ecx
+  8037af:	48 ba 2c 4b 80 00 00 	movabs $0x804b2c,%rdx
+  8037b6:	00 00 00 
+  8037b9:	be 8a 00 00 00       	mov    $0x8a,%esi
+  8037be:	48 bf da 4a 80 00 00 	movabs $0x804ada,%rdi
+  8037c5:	00 00 00 
+  8037c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037cd:	49 b8 02 0c 80 00 00 	movabs $0x800c02,%r8
+  8037d4:	00 00 00 
+  8037d7:	41 ff d0             	call   *%r8
+  8037da:	89 c3                	mov    %eax,%ebx
+  8037dc:	eb 07                	jmp    8037e5 <spawn+0x65d>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8037de:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8037e3:	89 c3                	mov    %eax,%ebx
+    sys_env_destroy(child);
+  8037e5:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8037eb:	48 b8 46 1c 80 00 00 	movabs $0x801c46,%rax
+  8037f2:	00 00 00 
+  8037f5:	ff d0                	call   *%rax
+    close(fd);
+  8037f7:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  8037fd:	48 b8 80 27 80 00 00 	movabs $0x802780,%rax
+  803804:	00 00 00 
+  803807:	ff d0                	call   *%rax
+    return res;
+  803809:	89 9d fc fc ff ff    	mov    %ebx,-0x304(%rbp)
+}
+  80380f:	8b 85 fc fc ff ff    	mov    -0x304(%rbp),%eax
+  803815:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  80381c:	5b                   	pop    %rbx
+  80381d:	41 5c                	pop    %r12
+  80381f:	41 5d                	pop    %r13
+  803821:	41 5e                	pop    %r14
+  803823:	41 5f                	pop    %r15
+  803825:	5d                   	pop    %rbp
+  803826:	c3                   	ret
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803827:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80382c:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803831:	be 00 00 40 00       	mov    $0x400000,%esi
+  803836:	bf 00 00 00 00       	mov    $0x0,%edi
+  80383b:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  803842:	00 00 00 
+  803845:	ff d0                	call   *%rax
+  803847:	85 c0                	test   %eax,%eax
+  803849:	78 98                	js     8037e3 <spawn+0x65b>
+    for (argc = 0; argv[argc] != 0; argc++)
+  80384b:	48 c7 85 e0 fc ff ff 	movq   $0x0,-0x320(%rbp)
+  803852:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803856:	48 c7 85 e8 fc ff ff 	movq   $0x40fff8,-0x318(%rbp)
+  80385d:	f8 ff 40 00 
+  803861:	48 c7 85 f0 fc ff ff 	movq   $0x410000,-0x310(%rbp)
+  803868:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  80386c:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  803871:	e9 1c fb ff ff       	jmp    803392 <spawn+0x20a>
+
+0000000000803876 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  803876:	55                   	push   %rbp
+  803877:	48 89 e5             	mov    %rsp,%rbp
+  80387a:	48 83 ec 50          	sub    $0x50,%rsp
+  80387e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803882:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803886:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80388a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  80388e:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803895:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803899:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80389d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8038a1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  8038a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  8038aa:	eb 15                	jmp    8038c1 <spawnl+0x4b>
+  8038ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038b8:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8038bc:	74 1c                	je     8038da <spawnl+0x64>
+  8038be:	83 c1 01             	add    $0x1,%ecx
+  8038c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8038c7:	77 e3                	ja     8038ac <spawnl+0x36>
+  8038c9:	89 c2                	mov    %eax,%edx
+  8038cb:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  8038cf:	4c 01 d2             	add    %r10,%rdx
+  8038d2:	83 c0 08             	add    $0x8,%eax
+  8038d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038d8:	eb de                	jmp    8038b8 <spawnl+0x42>
+    const char *argv[argc + 2];
+  8038da:	8d 41 02             	lea    0x2(%rcx),%eax
+  8038dd:	48 98                	cltq
+  8038df:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  8038e6:	00 
+  8038e7:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  8038eb:	48 29 c4             	sub    %rax,%rsp
+  8038ee:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  8038f3:	4c 89 c0             	mov    %r8,%rax
+  8038f6:	48 c1 e8 03          	shr    $0x3,%rax
+  8038fa:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  8038fe:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  803905:	00 
+    argv[argc + 1] = NULL;
+  803906:	8d 41 01             	lea    0x1(%rcx),%eax
+  803909:	48 98                	cltq
+  80390b:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  803912:	00 
+    va_start(vl, arg0);
+  803913:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80391a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80391e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803922:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803926:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  80392a:	85 c9                	test   %ecx,%ecx
+  80392c:	74 41                	je     80396f <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  80392e:	49 89 c1             	mov    %rax,%r9
+  803931:	49 8d 40 08          	lea    0x8(%r8),%rax
+  803935:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  803938:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  80393d:	eb 1b                	jmp    80395a <spawnl+0xe4>
+  80393f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803943:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  803947:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80394b:	48 8b 11             	mov    (%rcx),%rdx
+  80394e:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  803951:	48 83 c0 08          	add    $0x8,%rax
+  803955:	48 39 f0             	cmp    %rsi,%rax
+  803958:	74 15                	je     80396f <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  80395a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80395d:	83 fa 2f             	cmp    $0x2f,%edx
+  803960:	77 dd                	ja     80393f <spawnl+0xc9>
+  803962:	89 d1                	mov    %edx,%ecx
+  803964:	4c 01 c9             	add    %r9,%rcx
+  803967:	83 c2 08             	add    $0x8,%edx
+  80396a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80396d:	eb dc                	jmp    80394b <spawnl+0xd5>
+    return spawn(prog, argv);
+  80396f:	4c 89 c6             	mov    %r8,%rsi
+  803972:	48 b8 88 31 80 00 00 	movabs $0x803188,%rax
+  803979:	00 00 00 
+  80397c:	ff d0                	call   *%rax
+}
+  80397e:	c9                   	leave
+  80397f:	c3                   	ret
+
+0000000000803980 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803980:	55                   	push   %rbp
+  803981:	48 89 e5             	mov    %rsp,%rbp
+  803984:	41 54                	push   %r12
+  803986:	53                   	push   %rbx
+  803987:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80398a:	48 b8 9f 25 80 00 00 	movabs $0x80259f,%rax
+  803991:	00 00 00 
+  803994:	ff d0                	call   *%rax
+  803996:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803999:	48 be 43 4b 80 00 00 	movabs $0x804b43,%rsi
+  8039a0:	00 00 00 
+  8039a3:	48 89 df             	mov    %rbx,%rdi
+  8039a6:	48 b8 77 16 80 00 00 	movabs $0x801677,%rax
+  8039ad:	00 00 00 
+  8039b0:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8039b2:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8039b7:	41 2b 04 24          	sub    (%r12),%eax
+  8039bb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8039c1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8039c8:	00 00 00 
+    stat->st_dev = &devpipe;
+  8039cb:	48 b8 80 50 80 00 00 	movabs $0x805080,%rax
+  8039d2:	00 00 00 
+  8039d5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8039dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039e1:	5b                   	pop    %rbx
+  8039e2:	41 5c                	pop    %r12
+  8039e4:	5d                   	pop    %rbp
+  8039e5:	c3                   	ret
+
+00000000008039e6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8039e6:	55                   	push   %rbp
+  8039e7:	48 89 e5             	mov    %rsp,%rbp
+  8039ea:	41 54                	push   %r12
+  8039ec:	53                   	push   %rbx
+  8039ed:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8039f0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039f5:	48 89 fe             	mov    %rdi,%rsi
+  8039f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039fd:	49 bc 3d 1e 80 00 00 	movabs $0x801e3d,%r12
+  803a04:	00 00 00 
+  803a07:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803a0a:	48 89 df             	mov    %rbx,%rdi
+  803a0d:	48 b8 9f 25 80 00 00 	movabs $0x80259f,%rax
+  803a14:	00 00 00 
+  803a17:	ff d0                	call   *%rax
+  803a19:	48 89 c6             	mov    %rax,%rsi
+  803a1c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a21:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a26:	41 ff d4             	call   *%r12
+}
+  803a29:	5b                   	pop    %rbx
+  803a2a:	41 5c                	pop    %r12
+  803a2c:	5d                   	pop    %rbp
+  803a2d:	c3                   	ret
+
+0000000000803a2e <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803a2e:	55                   	push   %rbp
+  803a2f:	48 89 e5             	mov    %rsp,%rbp
+  803a32:	41 57                	push   %r15
+  803a34:	41 56                	push   %r14
+  803a36:	41 55                	push   %r13
+  803a38:	41 54                	push   %r12
+  803a3a:	53                   	push   %rbx
+  803a3b:	48 83 ec 18          	sub    $0x18,%rsp
+  803a3f:	49 89 fc             	mov    %rdi,%r12
+  803a42:	49 89 f5             	mov    %rsi,%r13
+  803a45:	49 89 d7             	mov    %rdx,%r15
+  803a48:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a4c:	48 b8 9f 25 80 00 00 	movabs $0x80259f,%rax
+  803a53:	00 00 00 
+  803a56:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803a58:	4d 85 ff             	test   %r15,%r15
+  803a5b:	0f 84 af 00 00 00    	je     803b10 <devpipe_write+0xe2>
+  803a61:	48 89 c3             	mov    %rax,%rbx
+  803a64:	4c 89 f8             	mov    %r15,%rax
+  803a67:	4d 89 ef             	mov    %r13,%r15
+  803a6a:	4c 01 e8             	add    %r13,%rax
+  803a6d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a71:	49 bd 45 1d 80 00 00 	movabs $0x801d45,%r13
+  803a78:	00 00 00 
+            sys_yield();
+  803a7b:	49 be e2 1c 80 00 00 	movabs $0x801ce2,%r14
+  803a82:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a85:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a88:	48 63 ce             	movslq %esi,%rcx
+  803a8b:	48 63 03             	movslq (%rbx),%rax
+  803a8e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a94:	48 39 c1             	cmp    %rax,%rcx
+  803a97:	72 2e                	jb     803ac7 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a99:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803a9e:	48 89 da             	mov    %rbx,%rdx
+  803aa1:	be 00 10 00 00       	mov    $0x1000,%esi
+  803aa6:	4c 89 e7             	mov    %r12,%rdi
+  803aa9:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803aac:	85 c0                	test   %eax,%eax
+  803aae:	74 66                	je     803b16 <devpipe_write+0xe8>
+            sys_yield();
+  803ab0:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803ab3:	8b 73 04             	mov    0x4(%rbx),%esi
+  803ab6:	48 63 ce             	movslq %esi,%rcx
+  803ab9:	48 63 03             	movslq (%rbx),%rax
+  803abc:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803ac2:	48 39 c1             	cmp    %rax,%rcx
+  803ac5:	73 d2                	jae    803a99 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803ac7:	41 0f b6 3f          	movzbl (%r15),%edi
+  803acb:	48 89 ca             	mov    %rcx,%rdx
+  803ace:	48 c1 ea 03          	shr    $0x3,%rdx
+  803ad2:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803ad9:	08 10 20 
+  803adc:	48 f7 e2             	mul    %rdx
+  803adf:	48 c1 ea 06          	shr    $0x6,%rdx
+  803ae3:	48 89 d0             	mov    %rdx,%rax
+  803ae6:	48 c1 e0 09          	shl    $0x9,%rax
+  803aea:	48 29 d0             	sub    %rdx,%rax
+  803aed:	48 c1 e0 03          	shl    $0x3,%rax
+  803af1:	48 29 c1             	sub    %rax,%rcx
+  803af4:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803af9:	83 c6 01             	add    $0x1,%esi
+  803afc:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803aff:	49 83 c7 01          	add    $0x1,%r15
+  803b03:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b07:	49 39 c7             	cmp    %rax,%r15
+  803b0a:	0f 85 75 ff ff ff    	jne    803a85 <devpipe_write+0x57>
+    return n;
+  803b10:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b14:	eb 05                	jmp    803b1b <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b16:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b1b:	48 83 c4 18          	add    $0x18,%rsp
+  803b1f:	5b                   	pop    %rbx
+  803b20:	41 5c                	pop    %r12
+  803b22:	41 5d                	pop    %r13
+  803b24:	41 5e                	pop    %r14
+  803b26:	41 5f                	pop    %r15
+  803b28:	5d                   	pop    %rbp
+  803b29:	c3                   	ret
+
+0000000000803b2a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803b2a:	55                   	push   %rbp
+  803b2b:	48 89 e5             	mov    %rsp,%rbp
+  803b2e:	41 57                	push   %r15
+  803b30:	41 56                	push   %r14
+  803b32:	41 55                	push   %r13
+  803b34:	41 54                	push   %r12
+  803b36:	53                   	push   %rbx
+  803b37:	48 83 ec 18          	sub    $0x18,%rsp
+  803b3b:	49 89 fc             	mov    %rdi,%r12
+  803b3e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803b42:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b46:	48 b8 9f 25 80 00 00 	movabs $0x80259f,%rax
+  803b4d:	00 00 00 
+  803b50:	ff d0                	call   *%rax
+  803b52:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b55:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b5b:	49 bd 45 1d 80 00 00 	movabs $0x801d45,%r13
+  803b62:	00 00 00 
+            sys_yield();
+  803b65:	49 be e2 1c 80 00 00 	movabs $0x801ce2,%r14
+  803b6c:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803b6f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803b74:	74 7d                	je     803bf3 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b76:	8b 03                	mov    (%rbx),%eax
+  803b78:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b7b:	75 26                	jne    803ba3 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803b7d:	4d 85 ff             	test   %r15,%r15
+  803b80:	75 77                	jne    803bf9 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b82:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b87:	48 89 da             	mov    %rbx,%rdx
+  803b8a:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b8f:	4c 89 e7             	mov    %r12,%rdi
+  803b92:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803b95:	85 c0                	test   %eax,%eax
+  803b97:	74 72                	je     803c0b <devpipe_read+0xe1>
+            sys_yield();
+  803b99:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b9c:	8b 03                	mov    (%rbx),%eax
+  803b9e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803ba1:	74 df                	je     803b82 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803ba3:	48 63 c8             	movslq %eax,%rcx
+  803ba6:	48 89 ca             	mov    %rcx,%rdx
+  803ba9:	48 c1 ea 03          	shr    $0x3,%rdx
+  803bad:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803bb4:	08 10 20 
+  803bb7:	48 89 d0             	mov    %rdx,%rax
+  803bba:	48 f7 e6             	mul    %rsi
+  803bbd:	48 c1 ea 06          	shr    $0x6,%rdx
+  803bc1:	48 89 d0             	mov    %rdx,%rax
+  803bc4:	48 c1 e0 09          	shl    $0x9,%rax
+  803bc8:	48 29 d0             	sub    %rdx,%rax
+  803bcb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803bd2:	00 
+  803bd3:	48 89 c8             	mov    %rcx,%rax
+  803bd6:	48 29 d0             	sub    %rdx,%rax
+  803bd9:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803bde:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803be2:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803be6:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803be9:	49 83 c7 01          	add    $0x1,%r15
+  803bed:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803bf1:	75 83                	jne    803b76 <devpipe_read+0x4c>
+    return n;
+  803bf3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803bf7:	eb 03                	jmp    803bfc <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803bf9:	4c 89 f8             	mov    %r15,%rax
+}
+  803bfc:	48 83 c4 18          	add    $0x18,%rsp
+  803c00:	5b                   	pop    %rbx
+  803c01:	41 5c                	pop    %r12
+  803c03:	41 5d                	pop    %r13
+  803c05:	41 5e                	pop    %r14
+  803c07:	41 5f                	pop    %r15
+  803c09:	5d                   	pop    %rbp
+  803c0a:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803c0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c10:	eb ea                	jmp    803bfc <devpipe_read+0xd2>
+
+0000000000803c12 <pipe>:
+pipe(int pfd[2]) {
+  803c12:	55                   	push   %rbp
+  803c13:	48 89 e5             	mov    %rsp,%rbp
+  803c16:	41 55                	push   %r13
+  803c18:	41 54                	push   %r12
+  803c1a:	53                   	push   %rbx
+  803c1b:	48 83 ec 18          	sub    $0x18,%rsp
+  803c1f:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c22:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803c26:	48 b8 bb 25 80 00 00 	movabs $0x8025bb,%rax
+  803c2d:	00 00 00 
+  803c30:	ff d0                	call   *%rax
+  803c32:	89 c3                	mov    %eax,%ebx
+  803c34:	85 c0                	test   %eax,%eax
+  803c36:	0f 88 a0 01 00 00    	js     803ddc <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803c3c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c41:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c46:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c4f:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  803c56:	00 00 00 
+  803c59:	ff d0                	call   *%rax
+  803c5b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c5d:	85 c0                	test   %eax,%eax
+  803c5f:	0f 88 77 01 00 00    	js     803ddc <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c65:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803c69:	48 b8 bb 25 80 00 00 	movabs $0x8025bb,%rax
+  803c70:	00 00 00 
+  803c73:	ff d0                	call   *%rax
+  803c75:	89 c3                	mov    %eax,%ebx
+  803c77:	85 c0                	test   %eax,%eax
+  803c79:	0f 88 43 01 00 00    	js     803dc2 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803c7f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c84:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c89:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c92:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  803c99:	00 00 00 
+  803c9c:	ff d0                	call   *%rax
+  803c9e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ca0:	85 c0                	test   %eax,%eax
+  803ca2:	0f 88 1a 01 00 00    	js     803dc2 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803ca8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803cac:	48 b8 9f 25 80 00 00 	movabs $0x80259f,%rax
+  803cb3:	00 00 00 
+  803cb6:	ff d0                	call   *%rax
+  803cb8:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803cbb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803cc0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cc5:	48 89 c6             	mov    %rax,%rsi
+  803cc8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ccd:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  803cd4:	00 00 00 
+  803cd7:	ff d0                	call   *%rax
+  803cd9:	89 c3                	mov    %eax,%ebx
+  803cdb:	85 c0                	test   %eax,%eax
+  803cdd:	0f 88 c5 00 00 00    	js     803da8 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803ce3:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ce7:	48 b8 9f 25 80 00 00 	movabs $0x80259f,%rax
+  803cee:	00 00 00 
+  803cf1:	ff d0                	call   *%rax
+  803cf3:	48 89 c1             	mov    %rax,%rcx
+  803cf6:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803cfc:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803d02:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d07:	4c 89 ee             	mov    %r13,%rsi
+  803d0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d0f:	48 b8 d8 1d 80 00 00 	movabs $0x801dd8,%rax
+  803d16:	00 00 00 
+  803d19:	ff d0                	call   *%rax
+  803d1b:	89 c3                	mov    %eax,%ebx
+  803d1d:	85 c0                	test   %eax,%eax
+  803d1f:	78 6e                	js     803d8f <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d21:	be 00 10 00 00       	mov    $0x1000,%esi
+  803d26:	4c 89 ef             	mov    %r13,%rdi
+  803d29:	48 b8 13 1d 80 00 00 	movabs $0x801d13,%rax
+  803d30:	00 00 00 
+  803d33:	ff d0                	call   *%rax
+  803d35:	83 f8 02             	cmp    $0x2,%eax
+  803d38:	0f 85 ab 00 00 00    	jne    803de9 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803d3e:	a1 80 50 80 00 00 00 	movabs 0x805080,%eax
+  803d45:	00 00 
+  803d47:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d4b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803d4d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d51:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803d58:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803d5c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803d5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d62:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803d69:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d6d:	48 bb 8d 25 80 00 00 	movabs $0x80258d,%rbx
+  803d74:	00 00 00 
+  803d77:	ff d3                	call   *%rbx
+  803d79:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803d7d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d81:	ff d3                	call   *%rbx
+  803d83:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803d88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d8d:	eb 4d                	jmp    803ddc <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803d8f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d94:	4c 89 ee             	mov    %r13,%rsi
+  803d97:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d9c:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  803da3:	00 00 00 
+  803da6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803da8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dad:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803db1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803db6:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  803dbd:	00 00 00 
+  803dc0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803dc2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dc7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803dcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dd0:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  803dd7:	00 00 00 
+  803dda:	ff d0                	call   *%rax
+}
+  803ddc:	89 d8                	mov    %ebx,%eax
+  803dde:	48 83 c4 18          	add    $0x18,%rsp
+  803de2:	5b                   	pop    %rbx
+  803de3:	41 5c                	pop    %r12
+  803de5:	41 5d                	pop    %r13
+  803de7:	5d                   	pop    %rbp
+  803de8:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803de9:	48 b9 60 4b 80 00 00 	movabs $0x804b60,%rcx
+  803df0:	00 00 00 
+  803df3:	48 ba fe 42 80 00 00 	movabs $0x8042fe,%rdx
+  803dfa:	00 00 00 
+  803dfd:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803e02:	48 bf 4a 4b 80 00 00 	movabs $0x804b4a,%rdi
+  803e09:	00 00 00 
+  803e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e11:	49 b8 02 0c 80 00 00 	movabs $0x800c02,%r8
+  803e18:	00 00 00 
+  803e1b:	41 ff d0             	call   *%r8
+
+0000000000803e1e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803e1e:	55                   	push   %rbp
+  803e1f:	48 89 e5             	mov    %rsp,%rbp
+  803e22:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803e26:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803e2a:	48 b8 1b 26 80 00 00 	movabs $0x80261b,%rax
+  803e31:	00 00 00 
+  803e34:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e36:	85 c0                	test   %eax,%eax
+  803e38:	78 35                	js     803e6f <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803e3a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e3e:	48 b8 9f 25 80 00 00 	movabs $0x80259f,%rax
+  803e45:	00 00 00 
+  803e48:	ff d0                	call   *%rax
+  803e4a:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e4d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e52:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e57:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e5b:	48 b8 45 1d 80 00 00 	movabs $0x801d45,%rax
+  803e62:	00 00 00 
+  803e65:	ff d0                	call   *%rax
+  803e67:	85 c0                	test   %eax,%eax
+  803e69:	0f 94 c0             	sete   %al
+  803e6c:	0f b6 c0             	movzbl %al,%eax
+}
+  803e6f:	c9                   	leave
+  803e70:	c3                   	ret
+
+0000000000803e71 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803e71:	55                   	push   %rbp
+  803e72:	48 89 e5             	mov    %rsp,%rbp
+  803e75:	41 55                	push   %r13
+  803e77:	41 54                	push   %r12
+  803e79:	53                   	push   %rbx
+  803e7a:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  803e7e:	85 ff                	test   %edi,%edi
+  803e80:	74 6c                	je     803eee <wait+0x7d>
+  803e82:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803e85:	40 0f b6 c7          	movzbl %dil,%eax
+
+    while (env->env_id == envid &&
+  803e89:	40 0f b6 cf          	movzbl %dil,%ecx
+  803e8d:	48 69 c9 b0 06 00 00 	imul   $0x6b0,%rcx,%rcx
+  803e94:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803e9b:	00 00 00 
+  803e9e:	48 01 ca             	add    %rcx,%rdx
+  803ea1:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803ea7:	39 d7                	cmp    %edx,%edi
+  803ea9:	75 38                	jne    803ee3 <wait+0x72>
+           env->env_status != ENV_FREE) {
+  803eab:	48 98                	cltq
+  803ead:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  803eb4:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803ebb:	00 00 00 
+  803ebe:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  803ec1:	49 bd e2 1c 80 00 00 	movabs $0x801ce2,%r13
+  803ec8:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803ecb:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803ed1:	85 c0                	test   %eax,%eax
+  803ed3:	74 0e                	je     803ee3 <wait+0x72>
+        sys_yield();
+  803ed5:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803ed8:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803ede:	44 39 e0             	cmp    %r12d,%eax
+  803ee1:	74 e8                	je     803ecb <wait+0x5a>
+    }
+}
+  803ee3:	48 83 c4 08          	add    $0x8,%rsp
+  803ee7:	5b                   	pop    %rbx
+  803ee8:	41 5c                	pop    %r12
+  803eea:	41 5d                	pop    %r13
+  803eec:	5d                   	pop    %rbp
+  803eed:	c3                   	ret
+    assert(envid != 0);
+  803eee:	48 b9 84 4b 80 00 00 	movabs $0x804b84,%rcx
+  803ef5:	00 00 00 
+  803ef8:	48 ba fe 42 80 00 00 	movabs $0x8042fe,%rdx
+  803eff:	00 00 00 
+  803f02:	be 06 00 00 00       	mov    $0x6,%esi
+  803f07:	48 bf 8f 4b 80 00 00 	movabs $0x804b8f,%rdi
+  803f0e:	00 00 00 
+  803f11:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f16:	49 b8 02 0c 80 00 00 	movabs $0x800c02,%r8
+  803f1d:	00 00 00 
+  803f20:	41 ff d0             	call   *%r8
+
+0000000000803f23 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803f23:	48 89 f8             	mov    %rdi,%rax
+  803f26:	48 c1 e8 27          	shr    $0x27,%rax
+  803f2a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803f31:	01 00 00 
+  803f34:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f38:	f6 c2 01             	test   $0x1,%dl
+  803f3b:	74 6d                	je     803faa <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f3d:	48 89 f8             	mov    %rdi,%rax
+  803f40:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f44:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803f4b:	01 00 00 
+  803f4e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f52:	f6 c2 01             	test   $0x1,%dl
+  803f55:	74 62                	je     803fb9 <get_uvpt_entry+0x96>
+  803f57:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803f5e:	01 00 00 
+  803f61:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f65:	f6 c2 80             	test   $0x80,%dl
+  803f68:	75 4f                	jne    803fb9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f6a:	48 89 f8             	mov    %rdi,%rax
+  803f6d:	48 c1 e8 15          	shr    $0x15,%rax
+  803f71:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803f78:	01 00 00 
+  803f7b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f7f:	f6 c2 01             	test   $0x1,%dl
+  803f82:	74 44                	je     803fc8 <get_uvpt_entry+0xa5>
+  803f84:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803f8b:	01 00 00 
+  803f8e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f92:	f6 c2 80             	test   $0x80,%dl
+  803f95:	75 31                	jne    803fc8 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803f97:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803f9b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803fa2:	01 00 00 
+  803fa5:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803fa9:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803faa:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803fb1:	01 00 00 
+  803fb4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803fb8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803fb9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803fc0:	01 00 00 
+  803fc3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803fc7:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803fc8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803fcf:	01 00 00 
+  803fd2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803fd6:	c3                   	ret
+
+0000000000803fd7 <get_prot>:
+
+int
+get_prot(void *va) {
+  803fd7:	55                   	push   %rbp
+  803fd8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803fdb:	48 b8 23 3f 80 00 00 	movabs $0x803f23,%rax
+  803fe2:	00 00 00 
+  803fe5:	ff d0                	call   *%rax
+  803fe7:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803fea:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803fef:	89 c1                	mov    %eax,%ecx
+  803ff1:	83 c9 04             	or     $0x4,%ecx
+  803ff4:	f6 c2 01             	test   $0x1,%dl
+  803ff7:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803ffa:	89 c1                	mov    %eax,%ecx
+  803ffc:	83 c9 02             	or     $0x2,%ecx
+  803fff:	f6 c2 02             	test   $0x2,%dl
+  804002:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804005:	89 c1                	mov    %eax,%ecx
+  804007:	83 c9 01             	or     $0x1,%ecx
+  80400a:	48 85 d2             	test   %rdx,%rdx
+  80400d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804010:	89 c1                	mov    %eax,%ecx
+  804012:	83 c9 40             	or     $0x40,%ecx
+  804015:	f6 c6 04             	test   $0x4,%dh
+  804018:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80401b:	5d                   	pop    %rbp
+  80401c:	c3                   	ret
+
+000000000080401d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80401d:	55                   	push   %rbp
+  80401e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804021:	48 b8 23 3f 80 00 00 	movabs $0x803f23,%rax
+  804028:	00 00 00 
+  80402b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80402d:	48 c1 e8 06          	shr    $0x6,%rax
+  804031:	83 e0 01             	and    $0x1,%eax
+}
+  804034:	5d                   	pop    %rbp
+  804035:	c3                   	ret
+
+0000000000804036 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804036:	55                   	push   %rbp
+  804037:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80403a:	48 b8 23 3f 80 00 00 	movabs $0x803f23,%rax
+  804041:	00 00 00 
+  804044:	ff d0                	call   *%rax
+  804046:	83 e0 01             	and    $0x1,%eax
+}
+  804049:	5d                   	pop    %rbp
+  80404a:	c3                   	ret
+
+000000000080404b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80404b:	55                   	push   %rbp
+  80404c:	48 89 e5             	mov    %rsp,%rbp
+  80404f:	41 57                	push   %r15
+  804051:	41 56                	push   %r14
+  804053:	41 55                	push   %r13
+  804055:	41 54                	push   %r12
+  804057:	53                   	push   %rbx
+  804058:	48 83 ec 18          	sub    $0x18,%rsp
+  80405c:	49 89 ff             	mov    %rdi,%r15
+  80405f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  804063:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  804068:	49 bc 36 40 80 00 00 	movabs $0x804036,%r12
+  80406f:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  804072:	49 be d7 3f 80 00 00 	movabs $0x803fd7,%r14
+  804079:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80407c:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  804083:	00 00 00 
+  804086:	eb 0c                	jmp    804094 <foreach_shared_region+0x49>
+  804088:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80408f:	4c 39 eb             	cmp    %r13,%rbx
+  804092:	74 38                	je     8040cc <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  804094:	48 89 df             	mov    %rbx,%rdi
+  804097:	41 ff d4             	call   *%r12
+  80409a:	84 c0                	test   %al,%al
+  80409c:	74 ea                	je     804088 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  80409e:	48 89 df             	mov    %rbx,%rdi
+  8040a1:	41 ff d6             	call   *%r14
+  8040a4:	a8 40                	test   $0x40,%al
+  8040a6:	74 e0                	je     804088 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8040a8:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8040af:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8040b3:	48 89 df             	mov    %rbx,%rdi
+  8040b6:	41 ff d7             	call   *%r15
+        if (err)
+  8040b9:	85 c0                	test   %eax,%eax
+  8040bb:	74 cb                	je     804088 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8040bd:	48 83 c4 18          	add    $0x18,%rsp
+  8040c1:	5b                   	pop    %rbx
+  8040c2:	41 5c                	pop    %r12
+  8040c4:	41 5d                	pop    %r13
+  8040c6:	41 5e                	pop    %r14
+  8040c8:	41 5f                	pop    %r15
+  8040ca:	5d                   	pop    %rbp
+  8040cb:	c3                   	ret
+    return 0;
+  8040cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040d1:	eb ea                	jmp    8040bd <foreach_shared_region+0x72>
+
+00000000008040d3 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8040d3:	55                   	push   %rbp
+  8040d4:	48 89 e5             	mov    %rsp,%rbp
+  8040d7:	41 54                	push   %r12
+  8040d9:	53                   	push   %rbx
+  8040da:	48 89 fb             	mov    %rdi,%rbx
+  8040dd:	48 89 f7             	mov    %rsi,%rdi
+  8040e0:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8040e3:	48 85 f6             	test   %rsi,%rsi
+  8040e6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040ed:	00 00 00 
+  8040f0:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8040f4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040f9:	48 b8 db 20 80 00 00 	movabs $0x8020db,%rax
+  804100:	00 00 00 
+  804103:	ff d0                	call   *%rax
+    if (res < 0) {
+  804105:	85 c0                	test   %eax,%eax
+  804107:	78 45                	js     80414e <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  804109:	48 85 db             	test   %rbx,%rbx
+  80410c:	74 12                	je     804120 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  80410e:	48 a1 18 60 80 00 00 	movabs 0x806018,%rax
+  804115:	00 00 00 
+  804118:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  80411e:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  804120:	4d 85 e4             	test   %r12,%r12
+  804123:	74 14                	je     804139 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  804125:	48 a1 18 60 80 00 00 	movabs 0x806018,%rax
+  80412c:	00 00 00 
+  80412f:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  804135:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  804139:	48 a1 18 60 80 00 00 	movabs 0x806018,%rax
+  804140:	00 00 00 
+  804143:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  804149:	5b                   	pop    %rbx
+  80414a:	41 5c                	pop    %r12
+  80414c:	5d                   	pop    %rbp
+  80414d:	c3                   	ret
+        if (from_env_store)
+  80414e:	48 85 db             	test   %rbx,%rbx
+  804151:	74 06                	je     804159 <ipc_recv+0x86>
+            *from_env_store = 0;
+  804153:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  804159:	4d 85 e4             	test   %r12,%r12
+  80415c:	74 eb                	je     804149 <ipc_recv+0x76>
+            *perm_store = 0;
+  80415e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804165:	00 
+  804166:	eb e1                	jmp    804149 <ipc_recv+0x76>
+
+0000000000804168 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804168:	55                   	push   %rbp
+  804169:	48 89 e5             	mov    %rsp,%rbp
+  80416c:	41 57                	push   %r15
+  80416e:	41 56                	push   %r14
+  804170:	41 55                	push   %r13
+  804172:	41 54                	push   %r12
+  804174:	53                   	push   %rbx
+  804175:	48 83 ec 18          	sub    $0x18,%rsp
+  804179:	41 89 fd             	mov    %edi,%r13d
+  80417c:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80417f:	48 89 d3             	mov    %rdx,%rbx
+  804182:	49 89 cc             	mov    %rcx,%r12
+  804185:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  804189:	48 85 d2             	test   %rdx,%rdx
+  80418c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804193:	00 00 00 
+  804196:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80419a:	49 be af 20 80 00 00 	movabs $0x8020af,%r14
+  8041a1:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  8041a4:	49 bf e2 1c 80 00 00 	movabs $0x801ce2,%r15
+  8041ab:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8041ae:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041b1:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8041b5:	4c 89 e1             	mov    %r12,%rcx
+  8041b8:	48 89 da             	mov    %rbx,%rdx
+  8041bb:	44 89 ef             	mov    %r13d,%edi
+  8041be:	41 ff d6             	call   *%r14
+        if (res == 0)
+  8041c1:	85 c0                	test   %eax,%eax
+  8041c3:	74 34                	je     8041f9 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  8041c5:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8041c8:	75 05                	jne    8041cf <ipc_send+0x67>
+        sys_yield();
+  8041ca:	41 ff d7             	call   *%r15
+    while (true) {
+  8041cd:	eb df                	jmp    8041ae <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  8041cf:	48 ba 9a 4b 80 00 00 	movabs $0x804b9a,%rdx
+  8041d6:	00 00 00 
+  8041d9:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8041de:	48 bf b3 4b 80 00 00 	movabs $0x804bb3,%rdi
+  8041e5:	00 00 00 
+  8041e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ed:	48 b9 02 0c 80 00 00 	movabs $0x800c02,%rcx
+  8041f4:	00 00 00 
+  8041f7:	ff d1                	call   *%rcx
+    }
+}
+  8041f9:	48 83 c4 18          	add    $0x18,%rsp
+  8041fd:	5b                   	pop    %rbx
+  8041fe:	41 5c                	pop    %r12
+  804200:	41 5d                	pop    %r13
+  804202:	41 5e                	pop    %r14
+  804204:	41 5f                	pop    %r15
+  804206:	5d                   	pop    %rbp
+  804207:	c3                   	ret
+
+0000000000804208 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804208:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80420d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804214:	00 00 00 
+  804217:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  80421e:	48 01 ca             	add    %rcx,%rdx
+  804221:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804227:	39 fa                	cmp    %edi,%edx
+  804229:	74 12                	je     80423d <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80422b:	48 83 c0 01          	add    $0x1,%rax
+  80422f:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  804235:	75 e0                	jne    804217 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804237:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80423c:	c3                   	ret
+            return envs[i].env_id;
+  80423d:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  804244:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80424b:	00 00 00 
+  80424e:	48 01 d0             	add    %rdx,%rax
+  804251:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804257:	c3                   	ret
+
+0000000000804258 <__rodata_start>:
+  804258:	20 09                	and    %cl,(%rcx)
+  80425a:	0d 0a 00 20 09       	or     $0x920000a,%eax
+  80425f:	0d 0a 3c 7c 3e       	or     $0x3e7c3c0a,%eax
+  804264:	26 3b 28             	es cmp (%rax),%ebp
+  804267:	29 00                	sub    %eax,(%rax)
+  804269:	74 6f                	je     8042da <__rodata_start+0x82>
+  80426b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80426c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80426f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804270:	79 20                	jns    804292 <__rodata_start+0x3a>
+  804272:	61                   	(bad)
+  804273:	72 67                	jb     8042dc <__rodata_start+0x84>
+  804275:	75 6d                	jne    8042e4 <__rodata_start+0x8c>
+  804277:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804279:	74 73                	je     8042ee <__rodata_start+0x96>
+  80427b:	0a 00                	or     (%rax),%al
+  80427d:	66 61                	data16 (bad)
+  80427f:	69 6c 65 64 20 74 6f 	imul   $0x206f7420,0x64(%rbp,%riz,2),%ebp
+  804286:	20 
+  804287:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804288:	70 65                	jo     8042ef <__rodata_start+0x97>
+  80428a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80428b:	20 25 73 00 6f 70    	and    %ah,0x706f0073(%rip)        # 70ef4304 <__bss_end+0x706eb304>
+  804291:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804293:	20 25 73 20 66 6f    	and    %ah,0x6f662073(%rip)        # 6fe6630c <__bss_end+0x6f65d30c>
+  804299:	72 20                	jb     8042bb <__rodata_start+0x63>
+  80429b:	77 72                	ja     80430f <__rodata_start+0xb7>
+  80429d:	69 74 65 3a 20 25 69 	imul   $0x692520,0x3a(%rbp,%riz,2),%esi
+  8042a4:	00 
+  8042a5:	70 69                	jo     804310 <__rodata_start+0xb8>
+  8042a7:	70 65                	jo     80430e <__rodata_start+0xb6>
+  8042a9:	3a 20                	cmp    (%rax),%ah
+  8042ab:	25 69 00 66 6f       	and    $0x6f660069,%eax
+  8042b0:	72 6b                	jb     80431d <__rodata_start+0xc5>
+  8042b2:	3a 20                	cmp    (%rax),%ah
+  8042b4:	25 69 00 62 61       	and    $0x61620069,%eax
+  8042b9:	64 20 72 65          	and    %dh,%fs:0x65(%rdx)
+  8042bd:	74 75                	je     804334 <__rodata_start+0xdc>
+  8042bf:	72 6e                	jb     80432f <__rodata_start+0xd7>
+  8042c1:	20 25 64 20 66 72    	and    %ah,0x72662064(%rip)        # 72e6632b <__bss_end+0x7265d32b>
+  8042c7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8042c8:	6d                   	insl   (%dx),%es:(%rdi)
+  8042c9:	20 67 65             	and    %ah,0x65(%rdi)
+  8042cc:	74 74                	je     804342 <__rodata_start+0xea>
+  8042ce:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8042cf:	6b 65 6e 00          	imul   $0x0,0x6e(%rbp),%esp
+  8042d3:	75 73                	jne    804348 <__rodata_start+0xf0>
+  8042d5:	65 72 2f             	gs jb  804307 <__rodata_start+0xaf>
+  8042d8:	73 68                	jae    804342 <__rodata_start+0xea>
+  8042da:	2e 63 00             	cs movsxd (%rax),%eax
+  8042dd:	73 70                	jae    80434f <__rodata_start+0xf7>
+  8042df:	61                   	(bad)
+  8042e0:	77 6e                	ja     804350 <__rodata_start+0xf8>
+  8042e2:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a07d5b <__bss_end+0x251fed5b>
+  8042e8:	69 0a 00 6f 70 65    	imul   $0x65706f00,(%rdx),%ecx
+  8042ee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8042ef:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a07d68 <__bss_end+0x251fed68>
+  8042f5:	69 00 72 20 3d 3d    	imul   $0x3d3d2072,(%rax),%eax
+  8042fb:	20 30                	and    %dh,(%rax)
+  8042fd:	00 61 73             	add    %ah,0x73(%rcx)
+  804300:	73 65                	jae    804367 <__rodata_start+0x10f>
+  804302:	72 74                	jb     804378 <__rodata_start+0x120>
+  804304:	69 6f 6e 20 66 61 69 	imul   $0x69616620,0x6e(%rdi),%ebp
+  80430b:	6c                   	insb   (%dx),%es:(%rdi)
+  80430c:	65 64 3a 20          	gs cmp %fs:(%rax),%ah
+  804310:	25 73 00 24 20       	and    $0x20240073,%eax
+  804315:	00 23                	add    %ah,(%rbx)
+  804317:	20 25 73 0a 00 0f    	and    %ah,0xf000a73(%rip)        # f804d90 <__bss_end+0xeffbd90>
+  80431d:	1f                   	(bad)
+  80431e:	40 00 73 79          	add    %sil,0x79(%rbx)
+  804322:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804323:	74 61                	je     804386 <__rodata_start+0x12e>
+  804325:	78 20                	js     804347 <__rodata_start+0xef>
+  804327:	65 72 72             	gs jb  80439c <__rodata_start+0x144>
+  80432a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80432b:	72 3a                	jb     804367 <__rodata_start+0x10f>
+  80432d:	20 26                	and    %ah,(%rsi)
+  80432f:	20 61 6c             	and    %ah,0x6c(%rcx)
+  804332:	6c                   	insb   (%dx),%es:(%rdi)
+  804333:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804334:	77 65                	ja     80439b <__rodata_start+0x143>
+  804336:	64 20 6f 6e          	and    %ch,%fs:0x6e(%rdi)
+  80433a:	6c                   	insb   (%dx),%es:(%rdi)
+  80433b:	79 20                	jns    80435d <__rodata_start+0x105>
+  80433d:	61                   	(bad)
+  80433e:	74 20                	je     804360 <__rodata_start+0x108>
+  804340:	74 68                	je     8043aa <__rodata_start+0x152>
+  804342:	65 20 65 6e          	and    %ah,%gs:0x6e(%rbp)
+  804346:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80434a:	20 63 6f             	and    %ah,0x6f(%rbx)
+  80434d:	6d                   	insl   (%dx),%es:(%rdi)
+  80434e:	6d                   	insl   (%dx),%es:(%rdi)
+  80434f:	61                   	(bad)
+  804350:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804351:	64 0a 00             	or     %fs:(%rax),%al
+  804354:	00 00                	add    %al,(%rax)
+  804356:	00 00                	add    %al,(%rax)
+  804358:	73 79                	jae    8043d3 <__rodata_start+0x17b>
+  80435a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80435b:	74 61                	je     8043be <__rodata_start+0x166>
+  80435d:	78 20                	js     80437f <__rodata_start+0x127>
+  80435f:	65 72 72             	gs jb  8043d4 <__rodata_start+0x17c>
+  804362:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804363:	72 3a                	jb     80439f <__rodata_start+0x147>
+  804365:	20 3c 20             	and    %bh,(%rax,%riz,1)
+  804368:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804369:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80436a:	74 20                	je     80438c <__rodata_start+0x134>
+  80436c:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80436e:	6c                   	insb   (%dx),%es:(%rdi)
+  80436f:	6c                   	insb   (%dx),%es:(%rdi)
+  804370:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804371:	77 65                	ja     8043d8 <__rodata_start+0x180>
+  804373:	64 20 62 79          	and    %ah,%fs:0x79(%rdx)
+  804377:	20 77 6f             	and    %dh,0x6f(%rdi)
+  80437a:	72 64                	jb     8043e0 <__rodata_start+0x188>
+  80437c:	0a 00                	or     (%rax),%al
+  80437e:	00 00                	add    %al,(%rax)
+  804380:	73 79                	jae    8043fb <__rodata_start+0x1a3>
+  804382:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804383:	74 61                	je     8043e6 <__rodata_start+0x18e>
+  804385:	78 20                	js     8043a7 <__rodata_start+0x14f>
+  804387:	65 72 72             	gs jb  8043fc <__rodata_start+0x1a4>
+  80438a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80438b:	72 3a                	jb     8043c7 <__rodata_start+0x16f>
+  80438d:	20 3e                	and    %bh,(%rsi)
+  80438f:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804392:	74 20                	je     8043b4 <__rodata_start+0x15c>
+  804394:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804396:	6c                   	insb   (%dx),%es:(%rdi)
+  804397:	6c                   	insb   (%dx),%es:(%rdi)
+  804398:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804399:	77 65                	ja     804400 <__rodata_start+0x1a8>
+  80439b:	64 20 62 79          	and    %ah,%fs:0x79(%rdx)
+  80439f:	20 77 6f             	and    %dh,0x6f(%rdi)
+  8043a2:	72 64                	jb     804408 <__rodata_start+0x1b0>
+  8043a4:	0a 00                	or     (%rax),%al
+  8043a6:	00 00                	add    %al,(%rax)
+  8043a8:	75 73                	jne    80441d <__rodata_start+0x1c5>
+  8043aa:	61                   	(bad)
+  8043ab:	67 65 3a 20          	cmp    %gs:(%eax),%ah
+  8043af:	73 68                	jae    804419 <__rodata_start+0x1c1>
+  8043b1:	20 5b 2d             	and    %bl,0x2d(%rbx)
+  8043b4:	64 69 78 5d 20 5b 63 	imul   $0x6f635b20,%fs:0x5d(%rax),%edi
+  8043bb:	6f 
+  8043bc:	6d                   	insl   (%dx),%es:(%rdi)
+  8043bd:	6d                   	insl   (%dx),%es:(%rdi)
+  8043be:	61                   	(bad)
+  8043bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8043c0:	64 2d 66 69 6c 65    	fs sub $0x656c6966,%eax
+  8043c6:	5d                   	pop    %rbp
+  8043c7:	0a 00                	or     (%rax),%al
+  8043c9:	3c 63                	cmp    $0x63,%al
+  8043cb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8043cc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8043cd:	73 3e                	jae    80440d <__rodata_start+0x1b5>
+  8043cf:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8043d2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8043d3:	73 00                	jae    8043d5 <__rodata_start+0x17d>
+  8043d5:	3c 75                	cmp    $0x75,%al
+  8043d7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8043d8:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8043dc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8043dd:	3e 00 90 5b 25 30 38 	ds add %dl,0x3830255b(%rax)
+  8043e4:	78 5d                	js     804443 <__rodata_start+0x1eb>
+  8043e6:	20 75 73             	and    %dh,0x73(%rbp)
+  8043e9:	65 72 20             	gs jb  80440c <__rodata_start+0x1b4>
+  8043ec:	70 61                	jo     80444f <__rodata_start+0x1f7>
+  8043ee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8043ef:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  8043f6:	73 20                	jae    804418 <__rodata_start+0x1c0>
+  8043f8:	61                   	(bad)
+  8043f9:	74 20                	je     80441b <__rodata_start+0x1c3>
+  8043fb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804400:	3a 20                	cmp    (%rax),%ah
+  804402:	00 30                	add    %dh,(%rax)
+  804404:	31 32                	xor    %esi,(%rdx)
+  804406:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80440d:	41                   	rex.B
+  80440e:	42                   	rex.X
+  80440f:	43                   	rex.XB
+  804410:	44                   	rex.R
+  804411:	45                   	rex.RB
+  804412:	46 00 30             	rex.RX add %r14b,(%rax)
+  804415:	31 32                	xor    %esi,(%rdx)
+  804417:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80441e:	61                   	(bad)
+  80441f:	62 63 64 65 66       	(bad)
+  804424:	00 28                	add    %ch,(%rax)
+  804426:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804427:	75 6c                	jne    804495 <__rodata_start+0x23d>
+  804429:	6c                   	insb   (%dx),%es:(%rdi)
+  80442a:	29 00                	sub    %eax,(%rax)
+  80442c:	65 72 72             	gs jb  8044a1 <__rodata_start+0x249>
+  80442f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804430:	72 20                	jb     804452 <__rodata_start+0x1fa>
+  804432:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804437:	73 70                	jae    8044a9 <__rodata_start+0x251>
+  804439:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80443d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804444:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804445:	72 00                	jb     804447 <__rodata_start+0x1ef>
+  804447:	62 61 64 20 65       	(bad)
+  80444c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80444d:	76 69                	jbe    8044b8 <__rodata_start+0x260>
+  80444f:	72 6f                	jb     8044c0 <__rodata_start+0x268>
+  804451:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804452:	6d                   	insl   (%dx),%es:(%rdi)
+  804453:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804455:	74 00                	je     804457 <__rodata_start+0x1ff>
+  804457:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80445e:	20 70 61             	and    %dh,0x61(%rax)
+  804461:	72 61                	jb     8044c4 <__rodata_start+0x26c>
+  804463:	6d                   	insl   (%dx),%es:(%rdi)
+  804464:	65 74 65             	gs je  8044cc <__rodata_start+0x274>
+  804467:	72 00                	jb     804469 <__rodata_start+0x211>
+  804469:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80446a:	75 74                	jne    8044e0 <__rodata_start+0x288>
+  80446c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80446f:	20 6d 65             	and    %ch,0x65(%rbp)
+  804472:	6d                   	insl   (%dx),%es:(%rdi)
+  804473:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804474:	72 79                	jb     8044ef <__rodata_start+0x297>
+  804476:	00 6f 75             	add    %ch,0x75(%rdi)
+  804479:	74 20                	je     80449b <__rodata_start+0x243>
+  80447b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80447c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804480:	76 69                	jbe    8044eb <__rodata_start+0x293>
+  804482:	72 6f                	jb     8044f3 <__rodata_start+0x29b>
+  804484:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804485:	6d                   	insl   (%dx),%es:(%rdi)
+  804486:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804488:	74 73                	je     8044fd <__rodata_start+0x2a5>
+  80448a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80448d:	72 72                	jb     804501 <__rodata_start+0x2a9>
+  80448f:	75 70                	jne    804501 <__rodata_start+0x2a9>
+  804491:	74 65                	je     8044f8 <__rodata_start+0x2a0>
+  804493:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804498:	75 67                	jne    804501 <__rodata_start+0x2a9>
+  80449a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80449d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80449f:	00 73 65             	add    %dh,0x65(%rbx)
+  8044a2:	67 6d                	insl   (%dx),%es:(%edi)
+  8044a4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8044a6:	74 61                	je     804509 <__rodata_start+0x2b1>
+  8044a8:	74 69                	je     804513 <__rodata_start+0x2bb>
+  8044aa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8044ab:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8044ac:	20 66 61             	and    %ah,0x61(%rsi)
+  8044af:	75 6c                	jne    80451d <__rodata_start+0x2c5>
+  8044b1:	74 00                	je     8044b3 <__rodata_start+0x25b>
+  8044b3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8044ba:	20 45 4c             	and    %al,0x4c(%rbp)
+  8044bd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8044c1:	61                   	(bad)
+  8044c2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8044c7:	20 73 75             	and    %dh,0x75(%rbx)
+  8044ca:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8044cd:	73 79                	jae    804548 <__rodata_start+0x2f0>
+  8044cf:	73 74                	jae    804545 <__rodata_start+0x2ed>
+  8044d1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8044d3:	20 63 61             	and    %ah,0x61(%rbx)
+  8044d6:	6c                   	insb   (%dx),%es:(%rdi)
+  8044d7:	6c                   	insb   (%dx),%es:(%rdi)
+  8044d8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8044db:	74 72                	je     80454f <__rodata_start+0x2f7>
+  8044dd:	79 20                	jns    8044ff <__rodata_start+0x2a7>
+  8044df:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8044e0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8044e1:	74 20                	je     804503 <__rodata_start+0x2ab>
+  8044e3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8044e5:	75 6e                	jne    804555 <__rodata_start+0x2fd>
+  8044e7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8044eb:	76 20                	jbe    80450d <__rodata_start+0x2b5>
+  8044ed:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8044f4:	72 65                	jb     80455b <__rodata_start+0x303>
+  8044f6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8044f9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8044fa:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8044fe:	65 78 70             	gs js  804571 <__rodata_start+0x319>
+  804501:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804506:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804509:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80450d:	20 66 69             	and    %ah,0x69(%rsi)
+  804510:	6c                   	insb   (%dx),%es:(%rdi)
+  804511:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804515:	20 66 72             	and    %ah,0x72(%rsi)
+  804518:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80451d:	61                   	(bad)
+  80451e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804521:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804522:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804523:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804527:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80452a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80452b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80452c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80452f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804530:	79 20                	jns    804552 <__rodata_start+0x2fa>
+  804532:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804539:	72 65                	jb     8045a0 <__rodata_start+0x348>
+  80453b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80453e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804540:	00 66 69             	add    %ah,0x69(%rsi)
+  804543:	6c                   	insb   (%dx),%es:(%rdi)
+  804544:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804548:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80454b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80454c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80454f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804550:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804551:	74 20                	je     804573 <__rodata_start+0x31b>
+  804553:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804555:	75 6e                	jne    8045c5 <__rodata_start+0x36d>
+  804557:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80455b:	76 61                	jbe    8045be <__rodata_start+0x366>
+  80455d:	6c                   	insb   (%dx),%es:(%rdi)
+  80455e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804565:	00 
+  804566:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80456d:	72 65                	jb     8045d4 <__rodata_start+0x37c>
+  80456f:	61                   	(bad)
+  804570:	64 79 20             	fs jns 804593 <__rodata_start+0x33b>
+  804573:	65 78 69             	gs js  8045df <__rodata_start+0x387>
+  804576:	73 74                	jae    8045ec <__rodata_start+0x394>
+  804578:	73 00                	jae    80457a <__rodata_start+0x322>
+  80457a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80457b:	70 65                	jo     8045e2 <__rodata_start+0x38a>
+  80457d:	72 61                	jb     8045e0 <__rodata_start+0x388>
+  80457f:	74 69                	je     8045ea <__rodata_start+0x392>
+  804581:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804582:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804583:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804586:	74 20                	je     8045a8 <__rodata_start+0x350>
+  804588:	73 75                	jae    8045ff <__rodata_start+0x3a7>
+  80458a:	70 70                	jo     8045fc <__rodata_start+0x3a4>
+  80458c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80458d:	72 74                	jb     804603 <__rodata_start+0x3ab>
+  80458f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  804594:	65 72 61             	gs jb  8045f8 <__rodata_start+0x3a0>
+  804597:	74 69                	je     804602 <__rodata_start+0x3aa>
+  804599:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80459a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80459b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80459e:	74 20                	je     8045c0 <__rodata_start+0x368>
+  8045a0:	70 65                	jo     804607 <__rodata_start+0x3af>
+  8045a2:	72 6d                	jb     804611 <__rodata_start+0x3b9>
+  8045a4:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  8045ab:	2e 
+  8045ac:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8045b3:	00 
+  8045b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bb:	00 00 00 
+  8045be:	66 90                	xchg   %ax,%ax
+  8045c0:	3f                   	(bad)
+  8045c1:	0f 80 00 00 00 00    	jo     8045c7 <__rodata_start+0x36f>
+  8045c7:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8045cd:	00 00                	add    %al,(%rax)
+  8045cf:	00 70 15             	add    %dh,0x15(%rax)
+  8045d2:	80 00 00             	addb   $0x0,(%rax)
+  8045d5:	00 00                	add    %al,(%rax)
+  8045d7:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8045dd:	00 00                	add    %al,(%rax)
+  8045df:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8045e5:	00 00                	add    %al,(%rax)
+  8045e7:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8045ed:	00 00                	add    %al,(%rax)
+  8045ef:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8045f5:	00 00                	add    %al,(%rax)
+  8045f7:	00 5e 0f             	add    %bl,0xf(%rsi)
+  8045fa:	80 00 00             	addb   $0x0,(%rax)
+  8045fd:	00 00                	add    %al,(%rax)
+  8045ff:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804605:	00 00                	add    %al,(%rax)
+  804607:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80460d:	00 00                	add    %al,(%rax)
+  80460f:	00 52 0f             	add    %dl,0xf(%rdx)
+  804612:	80 00 00             	addb   $0x0,(%rax)
+  804615:	00 00                	add    %al,(%rax)
+  804617:	00 cc                	add    %cl,%ah
+  804619:	0f 80 00 00 00 00    	jo     80461f <__rodata_start+0x3c7>
+  80461f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804625:	00 00                	add    %al,(%rax)
+  804627:	00 52 0f             	add    %dl,0xf(%rdx)
+  80462a:	80 00 00             	addb   $0x0,(%rax)
+  80462d:	00 00                	add    %al,(%rax)
+  80462f:	00 98 0f 80 00 00    	add    %bl,0x800f(%rax)
+  804635:	00 00                	add    %al,(%rax)
+  804637:	00 98 0f 80 00 00    	add    %bl,0x800f(%rax)
+  80463d:	00 00                	add    %al,(%rax)
+  80463f:	00 98 0f 80 00 00    	add    %bl,0x800f(%rax)
+  804645:	00 00                	add    %al,(%rax)
+  804647:	00 98 0f 80 00 00    	add    %bl,0x800f(%rax)
+  80464d:	00 00                	add    %al,(%rax)
+  80464f:	00 98 0f 80 00 00    	add    %bl,0x800f(%rax)
+  804655:	00 00                	add    %al,(%rax)
+  804657:	00 98 0f 80 00 00    	add    %bl,0x800f(%rax)
+  80465d:	00 00                	add    %al,(%rax)
+  80465f:	00 98 0f 80 00 00    	add    %bl,0x800f(%rax)
+  804665:	00 00                	add    %al,(%rax)
+  804667:	00 98 0f 80 00 00    	add    %bl,0x800f(%rax)
+  80466d:	00 00                	add    %al,(%rax)
+  80466f:	00 98 0f 80 00 00    	add    %bl,0x800f(%rax)
+  804675:	00 00                	add    %al,(%rax)
+  804677:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80467d:	00 00                	add    %al,(%rax)
+  80467f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804685:	00 00                	add    %al,(%rax)
+  804687:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80468d:	00 00                	add    %al,(%rax)
+  80468f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804695:	00 00                	add    %al,(%rax)
+  804697:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80469d:	00 00                	add    %al,(%rax)
+  80469f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8046a5:	00 00                	add    %al,(%rax)
+  8046a7:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8046ad:	00 00                	add    %al,(%rax)
+  8046af:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8046b5:	00 00                	add    %al,(%rax)
+  8046b7:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8046bd:	00 00                	add    %al,(%rax)
+  8046bf:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8046c5:	00 00                	add    %al,(%rax)
+  8046c7:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8046cd:	00 00                	add    %al,(%rax)
+  8046cf:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8046d5:	00 00                	add    %al,(%rax)
+  8046d7:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8046dd:	00 00                	add    %al,(%rax)
+  8046df:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8046e5:	00 00                	add    %al,(%rax)
+  8046e7:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8046ed:	00 00                	add    %al,(%rax)
+  8046ef:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8046f5:	00 00                	add    %al,(%rax)
+  8046f7:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8046fd:	00 00                	add    %al,(%rax)
+  8046ff:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804705:	00 00                	add    %al,(%rax)
+  804707:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80470d:	00 00                	add    %al,(%rax)
+  80470f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804715:	00 00                	add    %al,(%rax)
+  804717:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80471d:	00 00                	add    %al,(%rax)
+  80471f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804725:	00 00                	add    %al,(%rax)
+  804727:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80472d:	00 00                	add    %al,(%rax)
+  80472f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804735:	00 00                	add    %al,(%rax)
+  804737:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80473d:	00 00                	add    %al,(%rax)
+  80473f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804745:	00 00                	add    %al,(%rax)
+  804747:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80474d:	00 00                	add    %al,(%rax)
+  80474f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804755:	00 00                	add    %al,(%rax)
+  804757:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80475d:	00 00                	add    %al,(%rax)
+  80475f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804765:	00 00                	add    %al,(%rax)
+  804767:	00 a3 14 80 00 00    	add    %ah,0x8014(%rbx)
+  80476d:	00 00                	add    %al,(%rax)
+  80476f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804775:	00 00                	add    %al,(%rax)
+  804777:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80477d:	00 00                	add    %al,(%rax)
+  80477f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804785:	00 00                	add    %al,(%rax)
+  804787:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80478d:	00 00                	add    %al,(%rax)
+  80478f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804795:	00 00                	add    %al,(%rax)
+  804797:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80479d:	00 00                	add    %al,(%rax)
+  80479f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8047a5:	00 00                	add    %al,(%rax)
+  8047a7:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8047ad:	00 00                	add    %al,(%rax)
+  8047af:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8047b5:	00 00                	add    %al,(%rax)
+  8047b7:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8047bd:	00 00                	add    %al,(%rax)
+  8047bf:	00 ef                	add    %ch,%bh
+  8047c1:	0f 80 00 00 00 00    	jo     8047c7 <__rodata_start+0x56f>
+  8047c7:	00 be 11 80 00 00    	add    %bh,0x8011(%rsi)
+  8047cd:	00 00                	add    %al,(%rax)
+  8047cf:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8047d5:	00 00                	add    %al,(%rax)
+  8047d7:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8047dd:	00 00                	add    %al,(%rax)
+  8047df:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8047e5:	00 00                	add    %al,(%rax)
+  8047e7:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8047ed:	00 00                	add    %al,(%rax)
+  8047ef:	00 1e                	add    %bl,(%rsi)
+  8047f1:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+  8047f7:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  8047fd:	00 00                	add    %al,(%rax)
+  8047ff:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804805:	00 00                	add    %al,(%rax)
+  804807:	00 e4                	add    %ah,%ah
+  804809:	0f 80 00 00 00 00    	jo     80480f <__rodata_start+0x5b7>
+  80480f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804815:	00 00                	add    %al,(%rax)
+  804817:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80481d:	00 00                	add    %al,(%rax)
+  80481f:	00 66 13             	add    %ah,0x13(%rsi)
+  804822:	80 00 00             	addb   $0x0,(%rax)
+  804825:	00 00                	add    %al,(%rax)
+  804827:	00 30                	add    %dh,(%rax)
+  804829:	14 80                	adc    $0x80,%al
+  80482b:	00 00                	add    %al,(%rax)
+  80482d:	00 00                	add    %al,(%rax)
+  80482f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804835:	00 00                	add    %al,(%rax)
+  804837:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80483d:	00 00                	add    %al,(%rax)
+  80483f:	00 b5 10 80 00 00    	add    %dh,0x8010(%rbp)
+  804845:	00 00                	add    %al,(%rax)
+  804847:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80484d:	00 00                	add    %al,(%rax)
+  80484f:	00 92 12 80 00 00    	add    %dl,0x8012(%rdx)
+  804855:	00 00                	add    %al,(%rax)
+  804857:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  80485d:	00 00                	add    %al,(%rax)
+  80485f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804865:	00 00                	add    %al,(%rax)
+  804867:	00 a3 14 80 00 00    	add    %ah,0x8014(%rbx)
+  80486d:	00 00                	add    %al,(%rax)
+  80486f:	00 80 15 80 00 00    	add    %al,0x8015(%rax)
+  804875:	00 00                	add    %al,(%rax)
+  804877:	00 48 0f             	add    %cl,0xf(%rax)
+  80487a:	80 00 00             	addb   $0x0,(%rax)
+  80487d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804880 <error_string>:
+	...
+  804888:	35 44 80 00 00 00 00 00 47 44 80 00 00 00 00 00     5D......GD......
+  804898:	57 44 80 00 00 00 00 00 69 44 80 00 00 00 00 00     WD......iD......
+  8048a8:	77 44 80 00 00 00 00 00 8b 44 80 00 00 00 00 00     wD.......D......
+  8048b8:	a0 44 80 00 00 00 00 00 b3 44 80 00 00 00 00 00     .D.......D......
+  8048c8:	c5 44 80 00 00 00 00 00 d9 44 80 00 00 00 00 00     .D.......D......
+  8048d8:	e9 44 80 00 00 00 00 00 fc 44 80 00 00 00 00 00     .D.......D......
+  8048e8:	13 45 80 00 00 00 00 00 29 45 80 00 00 00 00 00     .E......)E......
+  8048f8:	41 45 80 00 00 00 00 00 59 45 80 00 00 00 00 00     AE......YE......
+  804908:	66 45 80 00 00 00 00 00 30 49 80 00 00 00 00 00     fE......0I......
+  804918:	7a 45 80 00 00 00 00 00 00 00 00 00 00 00 00 00     zE..............
+  804928:	92 45 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .E......file is 
+  804938:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  804948:	75 74 61 62 6c 65 00 72 65 61 64 20 65 72 72 6f     utable.read erro
+  804958:	72 3a 20 25 69 0a 00 90 73 79 73 63 61 6c 6c 20     r: %i...syscall 
+  804968:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  804978:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  804988:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  804998:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  8049a8:	6c 69 62 2f 66 6f 72 6b 2e 63 00 0f 1f 44 00 00     lib/fork.c...D..
+  8049b8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8049c8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8049d8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8049e8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8049f8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804a08:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804a18:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804a28:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804a38:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000804a40 <devtab>:
+  804a40:	40 50 80 00 00 00 00 00 80 50 80 00 00 00 00 00     @P.......P......
+  804a50:	00 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804a60:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  804a70:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  804a80:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  804a90:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  804aa0:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  804ab0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  804ac0:	45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20 77     Elf magic %08x w
+  804ad0:	61 6e 74 20 25 30 38 78 0a 00 6c 69 62 2f 73 70     ant %08x..lib/sp
+  804ae0:	61 77 6e 2e 63 00 62 79 74 65 73 5f 72 65 61 64     awn.c.bytes_read
+  804af0:	20 3d 3d 20 66 69 6c 65 73 7a 00 63 6f 70 79 5f      == filesz.copy_
+  804b00:	73 68 61 72 65 64 5f 72 65 67 69 6f 6e 3a 20 25     shared_region: %
+  804b10:	69 00 73 79 73 5f 65 6e 76 5f 73 65 74 5f 74 72     i.sys_env_set_tr
+  804b20:	61 70 66 72 61 6d 65 3a 20 25 69 00 73 79 73 5f     apframe: %i.sys_
+  804b30:	65 6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20     env_set_status: 
+  804b40:	25 69 00 3c 70 69 70 65 3e 00 6c 69 62 2f 70 69     %i.<pipe>.lib/pi
+  804b50:	70 65 2e 63 00 70 69 70 65 00 66 0f 1f 44 00 00     pe.c.pipe.f..D..
+  804b60:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804b70:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804b80:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  804b90:	69 62 2f 77 61 69 74 2e 63 00 69 70 63 5f 73 65     ib/wait.c.ipc_se
+  804ba0:	6e 64 3a 20 66 61 69 6c 65 64 20 74 6f 20 73 65     nd: failed to se
+  804bb0:	6e 64 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     nd.lib/ipc.c.f..
+  804bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
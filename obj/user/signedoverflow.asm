@@ -0,0 +1,5656 @@
+
+obj/user/signedoverflow:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 28 00 00 00       	call   80004b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Test for UBSAN support - signed integer overflow */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    /* Creating a 32-bit integer variable with the maximum integer value it can contain */
+    int a = 2147483647;
+    /* Trying to add 1 to the "a" variable and print its contents (which causes undefined behavior). */
+    /* The "cprintf" function is sanitized by UBSAN because lib/Makefrag accesses the USER_SAN_CFLAGS variable. */
+    cprintf("%d\n", a + 1);
+  800029:	be 00 00 00 80       	mov    $0x80000000,%esi
+  80002e:	48 bf 38 2b 80 00 00 	movabs $0x802b38,%rdi
+  800035:	00 00 00 
+  800038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003d:	48 ba c2 01 80 00 00 	movabs $0x8001c2,%rdx
+  800044:	00 00 00 
+  800047:	ff d2                	call   *%rdx
+}
+  800049:	5d                   	pop    %rbp
+  80004a:	c3                   	ret
+
+000000000080004b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80004b:	55                   	push   %rbp
+  80004c:	48 89 e5             	mov    %rsp,%rbp
+  80004f:	41 56                	push   %r14
+  800051:	41 55                	push   %r13
+  800053:	41 54                	push   %r12
+  800055:	53                   	push   %rbx
+  800056:	41 89 fd             	mov    %edi,%r13d
+  800059:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005c:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800063:	00 00 00 
+  800066:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80006d:	00 00 00 
+  800070:	48 39 c2             	cmp    %rax,%rdx
+  800073:	73 17                	jae    80008c <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800075:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800078:	49 89 c4             	mov    %rax,%r12
+  80007b:	48 83 c3 08          	add    $0x8,%rbx
+  80007f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800084:	ff 53 f8             	call   *-0x8(%rbx)
+  800087:	4c 39 e3             	cmp    %r12,%rbx
+  80008a:	72 ef                	jb     80007b <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  80008c:	48 b8 d7 0f 80 00 00 	movabs $0x800fd7,%rax
+  800093:	00 00 00 
+  800096:	ff d0                	call   *%rax
+  800098:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  80009b:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8000a2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000a9:	00 00 00 
+  8000ac:	48 01 d0             	add    %rdx,%rax
+  8000af:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000b6:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000b9:	45 85 ed             	test   %r13d,%r13d
+  8000bc:	7e 0d                	jle    8000cb <libmain+0x80>
+  8000be:	49 8b 06             	mov    (%r14),%rax
+  8000c1:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000c8:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000cb:	4c 89 f6             	mov    %r14,%rsi
+  8000ce:	44 89 ef             	mov    %r13d,%edi
+  8000d1:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000d8:	00 00 00 
+  8000db:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000dd:	48 b8 f2 00 80 00 00 	movabs $0x8000f2,%rax
+  8000e4:	00 00 00 
+  8000e7:	ff d0                	call   *%rax
+#endif
+}
+  8000e9:	5b                   	pop    %rbx
+  8000ea:	41 5c                	pop    %r12
+  8000ec:	41 5d                	pop    %r13
+  8000ee:	41 5e                	pop    %r14
+  8000f0:	5d                   	pop    %rbp
+  8000f1:	c3                   	ret
+
+00000000008000f2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f2:	55                   	push   %rbp
+  8000f3:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000f6:	48 b8 5f 18 80 00 00 	movabs $0x80185f,%rax
+  8000fd:	00 00 00 
+  800100:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800102:	bf 00 00 00 00       	mov    $0x0,%edi
+  800107:	48 b8 6c 0f 80 00 00 	movabs $0x800f6c,%rax
+  80010e:	00 00 00 
+  800111:	ff d0                	call   *%rax
+}
+  800113:	5d                   	pop    %rbp
+  800114:	c3                   	ret
+
+0000000000800115 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800115:	55                   	push   %rbp
+  800116:	48 89 e5             	mov    %rsp,%rbp
+  800119:	53                   	push   %rbx
+  80011a:	48 83 ec 08          	sub    $0x8,%rsp
+  80011e:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800121:	8b 06                	mov    (%rsi),%eax
+  800123:	8d 50 01             	lea    0x1(%rax),%edx
+  800126:	89 16                	mov    %edx,(%rsi)
+  800128:	48 98                	cltq
+  80012a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80012f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800135:	74 0a                	je     800141 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800137:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80013b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80013f:	c9                   	leave
+  800140:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800141:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800145:	be ff 00 00 00       	mov    $0xff,%esi
+  80014a:	48 b8 0e 0f 80 00 00 	movabs $0x800f0e,%rax
+  800151:	00 00 00 
+  800154:	ff d0                	call   *%rax
+        state->offset = 0;
+  800156:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80015c:	eb d9                	jmp    800137 <putch+0x22>
+
+000000000080015e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80015e:	55                   	push   %rbp
+  80015f:	48 89 e5             	mov    %rsp,%rbp
+  800162:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800169:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80016c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800173:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800178:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800180:	48 89 f1             	mov    %rsi,%rcx
+  800183:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80018a:	48 bf 15 01 80 00 00 	movabs $0x800115,%rdi
+  800191:	00 00 00 
+  800194:	48 b8 12 03 80 00 00 	movabs $0x800312,%rax
+  80019b:	00 00 00 
+  80019e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001a0:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001a7:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001ae:	48 b8 0e 0f 80 00 00 	movabs $0x800f0e,%rax
+  8001b5:	00 00 00 
+  8001b8:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001ba:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001c0:	c9                   	leave
+  8001c1:	c3                   	ret
+
+00000000008001c2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001c2:	55                   	push   %rbp
+  8001c3:	48 89 e5             	mov    %rsp,%rbp
+  8001c6:	48 83 ec 50          	sub    $0x50,%rsp
+  8001ca:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001ce:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001d2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001d6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001da:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001de:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001e5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8001ed:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8001f1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8001f5:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8001f9:	48 b8 5e 01 80 00 00 	movabs $0x80015e,%rax
+  800200:	00 00 00 
+  800203:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800205:	c9                   	leave
+  800206:	c3                   	ret
+
+0000000000800207 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800207:	55                   	push   %rbp
+  800208:	48 89 e5             	mov    %rsp,%rbp
+  80020b:	41 57                	push   %r15
+  80020d:	41 56                	push   %r14
+  80020f:	41 55                	push   %r13
+  800211:	41 54                	push   %r12
+  800213:	53                   	push   %rbx
+  800214:	48 83 ec 18          	sub    $0x18,%rsp
+  800218:	49 89 fc             	mov    %rdi,%r12
+  80021b:	49 89 f5             	mov    %rsi,%r13
+  80021e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800222:	8b 45 10             	mov    0x10(%rbp),%eax
+  800225:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800228:	41 89 cf             	mov    %ecx,%r15d
+  80022b:	4c 39 fa             	cmp    %r15,%rdx
+  80022e:	73 5b                	jae    80028b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800230:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800234:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800238:	85 db                	test   %ebx,%ebx
+  80023a:	7e 0e                	jle    80024a <print_num+0x43>
+            putch(padc, put_arg);
+  80023c:	4c 89 ee             	mov    %r13,%rsi
+  80023f:	44 89 f7             	mov    %r14d,%edi
+  800242:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800245:	83 eb 01             	sub    $0x1,%ebx
+  800248:	75 f2                	jne    80023c <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80024a:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80024e:	48 b9 57 2b 80 00 00 	movabs $0x802b57,%rcx
+  800255:	00 00 00 
+  800258:	48 b8 46 2b 80 00 00 	movabs $0x802b46,%rax
+  80025f:	00 00 00 
+  800262:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800266:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80026a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80026f:	49 f7 f7             	div    %r15
+  800272:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800276:	4c 89 ee             	mov    %r13,%rsi
+  800279:	41 ff d4             	call   *%r12
+}
+  80027c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800280:	5b                   	pop    %rbx
+  800281:	41 5c                	pop    %r12
+  800283:	41 5d                	pop    %r13
+  800285:	41 5e                	pop    %r14
+  800287:	41 5f                	pop    %r15
+  800289:	5d                   	pop    %rbp
+  80028a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80028b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80028f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800294:	49 f7 f7             	div    %r15
+  800297:	48 83 ec 08          	sub    $0x8,%rsp
+  80029b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80029f:	52                   	push   %rdx
+  8002a0:	45 0f be c9          	movsbl %r9b,%r9d
+  8002a4:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002a8:	48 89 c2             	mov    %rax,%rdx
+  8002ab:	48 b8 07 02 80 00 00 	movabs $0x800207,%rax
+  8002b2:	00 00 00 
+  8002b5:	ff d0                	call   *%rax
+  8002b7:	48 83 c4 10          	add    $0x10,%rsp
+  8002bb:	eb 8d                	jmp    80024a <print_num+0x43>
+
+00000000008002bd <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002bd:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002c1:	48 8b 06             	mov    (%rsi),%rax
+  8002c4:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002c8:	73 0a                	jae    8002d4 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002ca:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002ce:	48 89 16             	mov    %rdx,(%rsi)
+  8002d1:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002d4:	c3                   	ret
+
+00000000008002d5 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002d5:	55                   	push   %rbp
+  8002d6:	48 89 e5             	mov    %rsp,%rbp
+  8002d9:	48 83 ec 50          	sub    $0x50,%rsp
+  8002dd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002e1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002e5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002e9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8002f0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002f8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002fc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800300:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800304:	48 b8 12 03 80 00 00 	movabs $0x800312,%rax
+  80030b:	00 00 00 
+  80030e:	ff d0                	call   *%rax
+}
+  800310:	c9                   	leave
+  800311:	c3                   	ret
+
+0000000000800312 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800312:	55                   	push   %rbp
+  800313:	48 89 e5             	mov    %rsp,%rbp
+  800316:	41 57                	push   %r15
+  800318:	41 56                	push   %r14
+  80031a:	41 55                	push   %r13
+  80031c:	41 54                	push   %r12
+  80031e:	53                   	push   %rbx
+  80031f:	48 83 ec 38          	sub    $0x38,%rsp
+  800323:	49 89 fe             	mov    %rdi,%r14
+  800326:	49 89 f5             	mov    %rsi,%r13
+  800329:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80032c:	48 8b 01             	mov    (%rcx),%rax
+  80032f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800333:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800337:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80033b:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80033f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800343:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800347:	0f b6 3b             	movzbl (%rbx),%edi
+  80034a:	40 80 ff 25          	cmp    $0x25,%dil
+  80034e:	74 18                	je     800368 <vprintfmt+0x56>
+            if (!ch) return;
+  800350:	40 84 ff             	test   %dil,%dil
+  800353:	0f 84 b1 06 00 00    	je     800a0a <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800359:	40 0f b6 ff          	movzbl %dil,%edi
+  80035d:	4c 89 ee             	mov    %r13,%rsi
+  800360:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800363:	4c 89 e3             	mov    %r12,%rbx
+  800366:	eb db                	jmp    800343 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800368:	be 00 00 00 00       	mov    $0x0,%esi
+  80036d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800371:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800376:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80037c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800383:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800387:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80038c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800391:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800394:	83 e8 23             	sub    $0x23,%eax
+  800397:	3c 57                	cmp    $0x57,%al
+  800399:	0f 87 51 06 00 00    	ja     8009f0 <vprintfmt+0x6de>
+  80039f:	0f b6 c0             	movzbl %al,%eax
+  8003a2:	48 b9 00 2d 80 00 00 	movabs $0x802d00,%rcx
+  8003a9:	00 00 00 
+  8003ac:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003af:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003b2:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003b6:	eb cf                	jmp    800387 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003b8:	49 89 dc             	mov    %rbx,%r12
+  8003bb:	be 01 00 00 00       	mov    $0x1,%esi
+  8003c0:	eb c5                	jmp    800387 <vprintfmt+0x75>
+            padc = ch;
+  8003c2:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003c6:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003c9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003cc:	eb b9                	jmp    800387 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8003d4:	77 24                	ja     8003fa <vprintfmt+0xe8>
+  8003d6:	89 c1                	mov    %eax,%ecx
+  8003d8:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003dc:	83 c0 08             	add    $0x8,%eax
+  8003df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003e2:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003e5:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003e8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003ec:	79 99                	jns    800387 <vprintfmt+0x75>
+                width = precision;
+  8003ee:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8003f2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003f8:	eb 8d                	jmp    800387 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003fa:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8003fe:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800402:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800406:	eb da                	jmp    8003e2 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800408:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80040d:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800411:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800417:	3c 39                	cmp    $0x39,%al
+  800419:	77 1c                	ja     800437 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80041b:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80041f:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800423:	0f b6 c0             	movzbl %al,%eax
+  800426:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80042b:	0f b6 03             	movzbl (%rbx),%eax
+  80042e:	3c 39                	cmp    $0x39,%al
+  800430:	76 e9                	jbe    80041b <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800432:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800435:	eb b1                	jmp    8003e8 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800437:	49 89 dc             	mov    %rbx,%r12
+  80043a:	eb ac                	jmp    8003e8 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80043c:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80043f:	85 c9                	test   %ecx,%ecx
+  800441:	b8 00 00 00 00       	mov    $0x0,%eax
+  800446:	0f 49 c1             	cmovns %ecx,%eax
+  800449:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80044c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80044f:	e9 33 ff ff ff       	jmp    800387 <vprintfmt+0x75>
+            lflag++;
+  800454:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800457:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80045a:	e9 28 ff ff ff       	jmp    800387 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80045f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800462:	83 f8 2f             	cmp    $0x2f,%eax
+  800465:	77 19                	ja     800480 <vprintfmt+0x16e>
+  800467:	89 c2                	mov    %eax,%edx
+  800469:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80046d:	83 c0 08             	add    $0x8,%eax
+  800470:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800473:	8b 3a                	mov    (%rdx),%edi
+  800475:	4c 89 ee             	mov    %r13,%rsi
+  800478:	41 ff d6             	call   *%r14
+            break;
+  80047b:	e9 c3 fe ff ff       	jmp    800343 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800480:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800484:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800488:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80048c:	eb e5                	jmp    800473 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80048e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800491:	83 f8 2f             	cmp    $0x2f,%eax
+  800494:	77 5a                	ja     8004f0 <vprintfmt+0x1de>
+  800496:	89 c2                	mov    %eax,%edx
+  800498:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80049c:	83 c0 08             	add    $0x8,%eax
+  80049f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004a2:	8b 02                	mov    (%rdx),%eax
+  8004a4:	89 c1                	mov    %eax,%ecx
+  8004a6:	f7 d9                	neg    %ecx
+  8004a8:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004ab:	83 f9 15             	cmp    $0x15,%ecx
+  8004ae:	7f 4e                	jg     8004fe <vprintfmt+0x1ec>
+  8004b0:	48 63 c1             	movslq %ecx,%rax
+  8004b3:	48 ba c0 2f 80 00 00 	movabs $0x802fc0,%rdx
+  8004ba:	00 00 00 
+  8004bd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004c1:	48 85 c0             	test   %rax,%rax
+  8004c4:	74 38                	je     8004fe <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004c6:	48 89 c1             	mov    %rax,%rcx
+  8004c9:	48 ba 79 31 80 00 00 	movabs $0x803179,%rdx
+  8004d0:	00 00 00 
+  8004d3:	4c 89 ee             	mov    %r13,%rsi
+  8004d6:	4c 89 f7             	mov    %r14,%rdi
+  8004d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004de:	49 b8 d5 02 80 00 00 	movabs $0x8002d5,%r8
+  8004e5:	00 00 00 
+  8004e8:	41 ff d0             	call   *%r8
+  8004eb:	e9 53 fe ff ff       	jmp    800343 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8004f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004fc:	eb a4                	jmp    8004a2 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8004fe:	48 ba 6f 2b 80 00 00 	movabs $0x802b6f,%rdx
+  800505:	00 00 00 
+  800508:	4c 89 ee             	mov    %r13,%rsi
+  80050b:	4c 89 f7             	mov    %r14,%rdi
+  80050e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800513:	49 b8 d5 02 80 00 00 	movabs $0x8002d5,%r8
+  80051a:	00 00 00 
+  80051d:	41 ff d0             	call   *%r8
+  800520:	e9 1e fe ff ff       	jmp    800343 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800525:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800528:	83 f8 2f             	cmp    $0x2f,%eax
+  80052b:	77 6c                	ja     800599 <vprintfmt+0x287>
+  80052d:	89 c2                	mov    %eax,%edx
+  80052f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800533:	83 c0 08             	add    $0x8,%eax
+  800536:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800539:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80053c:	48 85 d2             	test   %rdx,%rdx
+  80053f:	48 b8 68 2b 80 00 00 	movabs $0x802b68,%rax
+  800546:	00 00 00 
+  800549:	48 0f 45 c2          	cmovne %rdx,%rax
+  80054d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800551:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800555:	7e 06                	jle    80055d <vprintfmt+0x24b>
+  800557:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80055b:	75 4a                	jne    8005a7 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80055d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800561:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800565:	0f b6 00             	movzbl (%rax),%eax
+  800568:	84 c0                	test   %al,%al
+  80056a:	0f 85 9a 00 00 00    	jne    80060a <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800570:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800573:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800577:	85 c0                	test   %eax,%eax
+  800579:	0f 8e c4 fd ff ff    	jle    800343 <vprintfmt+0x31>
+  80057f:	4c 89 ee             	mov    %r13,%rsi
+  800582:	bf 20 00 00 00       	mov    $0x20,%edi
+  800587:	41 ff d6             	call   *%r14
+  80058a:	41 83 ec 01          	sub    $0x1,%r12d
+  80058e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800592:	75 eb                	jne    80057f <vprintfmt+0x26d>
+  800594:	e9 aa fd ff ff       	jmp    800343 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800599:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80059d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a5:	eb 92                	jmp    800539 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005a7:	49 63 f7             	movslq %r15d,%rsi
+  8005aa:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005ae:	48 b8 c4 0a 80 00 00 	movabs $0x800ac4,%rax
+  8005b5:	00 00 00 
+  8005b8:	ff d0                	call   *%rax
+  8005ba:	48 89 c2             	mov    %rax,%rdx
+  8005bd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005c0:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005c2:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005c5:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005c8:	85 c0                	test   %eax,%eax
+  8005ca:	7e 91                	jle    80055d <vprintfmt+0x24b>
+  8005cc:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005d1:	4c 89 ee             	mov    %r13,%rsi
+  8005d4:	44 89 e7             	mov    %r12d,%edi
+  8005d7:	41 ff d6             	call   *%r14
+  8005da:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005de:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005e1:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005e4:	75 eb                	jne    8005d1 <vprintfmt+0x2bf>
+  8005e6:	e9 72 ff ff ff       	jmp    80055d <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005eb:	0f b6 f8             	movzbl %al,%edi
+  8005ee:	4c 89 ee             	mov    %r13,%rsi
+  8005f1:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005f4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005f8:	49 83 c4 01          	add    $0x1,%r12
+  8005fc:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800602:	84 c0                	test   %al,%al
+  800604:	0f 84 66 ff ff ff    	je     800570 <vprintfmt+0x25e>
+  80060a:	45 85 ff             	test   %r15d,%r15d
+  80060d:	78 0a                	js     800619 <vprintfmt+0x307>
+  80060f:	41 83 ef 01          	sub    $0x1,%r15d
+  800613:	0f 88 57 ff ff ff    	js     800570 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800619:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80061d:	74 cc                	je     8005eb <vprintfmt+0x2d9>
+  80061f:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800622:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800627:	80 fa 5e             	cmp    $0x5e,%dl
+  80062a:	77 c2                	ja     8005ee <vprintfmt+0x2dc>
+  80062c:	eb bd                	jmp    8005eb <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80062e:	40 84 f6             	test   %sil,%sil
+  800631:	75 26                	jne    800659 <vprintfmt+0x347>
+    switch (lflag) {
+  800633:	85 d2                	test   %edx,%edx
+  800635:	74 59                	je     800690 <vprintfmt+0x37e>
+  800637:	83 fa 01             	cmp    $0x1,%edx
+  80063a:	74 7b                	je     8006b7 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80063c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80063f:	83 f8 2f             	cmp    $0x2f,%eax
+  800642:	0f 87 96 00 00 00    	ja     8006de <vprintfmt+0x3cc>
+  800648:	89 c2                	mov    %eax,%edx
+  80064a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80064e:	83 c0 08             	add    $0x8,%eax
+  800651:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800654:	4c 8b 22             	mov    (%rdx),%r12
+  800657:	eb 17                	jmp    800670 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800659:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80065c:	83 f8 2f             	cmp    $0x2f,%eax
+  80065f:	77 21                	ja     800682 <vprintfmt+0x370>
+  800661:	89 c2                	mov    %eax,%edx
+  800663:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800667:	83 c0 08             	add    $0x8,%eax
+  80066a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80066d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800670:	4d 85 e4             	test   %r12,%r12
+  800673:	78 7a                	js     8006ef <vprintfmt+0x3dd>
+            num = i;
+  800675:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800678:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80067d:	e9 50 02 00 00       	jmp    8008d2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800682:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800686:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80068a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80068e:	eb dd                	jmp    80066d <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800690:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800693:	83 f8 2f             	cmp    $0x2f,%eax
+  800696:	77 11                	ja     8006a9 <vprintfmt+0x397>
+  800698:	89 c2                	mov    %eax,%edx
+  80069a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80069e:	83 c0 08             	add    $0x8,%eax
+  8006a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a4:	4c 63 22             	movslq (%rdx),%r12
+  8006a7:	eb c7                	jmp    800670 <vprintfmt+0x35e>
+  8006a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b5:	eb ed                	jmp    8006a4 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8006bd:	77 11                	ja     8006d0 <vprintfmt+0x3be>
+  8006bf:	89 c2                	mov    %eax,%edx
+  8006c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c5:	83 c0 08             	add    $0x8,%eax
+  8006c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006cb:	4c 8b 22             	mov    (%rdx),%r12
+  8006ce:	eb a0                	jmp    800670 <vprintfmt+0x35e>
+  8006d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006dc:	eb ed                	jmp    8006cb <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ea:	e9 65 ff ff ff       	jmp    800654 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8006ef:	4c 89 ee             	mov    %r13,%rsi
+  8006f2:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8006f7:	41 ff d6             	call   *%r14
+                i = -i;
+  8006fa:	49 f7 dc             	neg    %r12
+  8006fd:	e9 73 ff ff ff       	jmp    800675 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800702:	40 84 f6             	test   %sil,%sil
+  800705:	75 32                	jne    800739 <vprintfmt+0x427>
+    switch (lflag) {
+  800707:	85 d2                	test   %edx,%edx
+  800709:	74 5d                	je     800768 <vprintfmt+0x456>
+  80070b:	83 fa 01             	cmp    $0x1,%edx
+  80070e:	0f 84 82 00 00 00    	je     800796 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800714:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800717:	83 f8 2f             	cmp    $0x2f,%eax
+  80071a:	0f 87 a5 00 00 00    	ja     8007c5 <vprintfmt+0x4b3>
+  800720:	89 c2                	mov    %eax,%edx
+  800722:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800726:	83 c0 08             	add    $0x8,%eax
+  800729:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80072c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80072f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800734:	e9 99 01 00 00       	jmp    8008d2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800739:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073c:	83 f8 2f             	cmp    $0x2f,%eax
+  80073f:	77 19                	ja     80075a <vprintfmt+0x448>
+  800741:	89 c2                	mov    %eax,%edx
+  800743:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800747:	83 c0 08             	add    $0x8,%eax
+  80074a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800750:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800755:	e9 78 01 00 00       	jmp    8008d2 <vprintfmt+0x5c0>
+  80075a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80075e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800762:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800766:	eb e5                	jmp    80074d <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800768:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076b:	83 f8 2f             	cmp    $0x2f,%eax
+  80076e:	77 18                	ja     800788 <vprintfmt+0x476>
+  800770:	89 c2                	mov    %eax,%edx
+  800772:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800776:	83 c0 08             	add    $0x8,%eax
+  800779:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80077e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800783:	e9 4a 01 00 00       	jmp    8008d2 <vprintfmt+0x5c0>
+  800788:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800790:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800794:	eb e6                	jmp    80077c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800796:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800799:	83 f8 2f             	cmp    $0x2f,%eax
+  80079c:	77 19                	ja     8007b7 <vprintfmt+0x4a5>
+  80079e:	89 c2                	mov    %eax,%edx
+  8007a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a4:	83 c0 08             	add    $0x8,%eax
+  8007a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007aa:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007ad:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007b2:	e9 1b 01 00 00       	jmp    8008d2 <vprintfmt+0x5c0>
+  8007b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c3:	eb e5                	jmp    8007aa <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d1:	e9 56 ff ff ff       	jmp    80072c <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007d6:	40 84 f6             	test   %sil,%sil
+  8007d9:	75 2e                	jne    800809 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007db:	85 d2                	test   %edx,%edx
+  8007dd:	74 59                	je     800838 <vprintfmt+0x526>
+  8007df:	83 fa 01             	cmp    $0x1,%edx
+  8007e2:	74 7f                	je     800863 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007e4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ea:	0f 87 9f 00 00 00    	ja     80088f <vprintfmt+0x57d>
+  8007f0:	89 c2                	mov    %eax,%edx
+  8007f2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f6:	83 c0 08             	add    $0x8,%eax
+  8007f9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007fc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8007ff:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800804:	e9 c9 00 00 00       	jmp    8008d2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800809:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080c:	83 f8 2f             	cmp    $0x2f,%eax
+  80080f:	77 19                	ja     80082a <vprintfmt+0x518>
+  800811:	89 c2                	mov    %eax,%edx
+  800813:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800817:	83 c0 08             	add    $0x8,%eax
+  80081a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800820:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800825:	e9 a8 00 00 00       	jmp    8008d2 <vprintfmt+0x5c0>
+  80082a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80082e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800832:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800836:	eb e5                	jmp    80081d <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800838:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083b:	83 f8 2f             	cmp    $0x2f,%eax
+  80083e:	77 15                	ja     800855 <vprintfmt+0x543>
+  800840:	89 c2                	mov    %eax,%edx
+  800842:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800846:	83 c0 08             	add    $0x8,%eax
+  800849:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084c:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80084e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800853:	eb 7d                	jmp    8008d2 <vprintfmt+0x5c0>
+  800855:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800859:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800861:	eb e9                	jmp    80084c <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800863:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800866:	83 f8 2f             	cmp    $0x2f,%eax
+  800869:	77 16                	ja     800881 <vprintfmt+0x56f>
+  80086b:	89 c2                	mov    %eax,%edx
+  80086d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800871:	83 c0 08             	add    $0x8,%eax
+  800874:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800877:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80087a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80087f:	eb 51                	jmp    8008d2 <vprintfmt+0x5c0>
+  800881:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800885:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800889:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088d:	eb e8                	jmp    800877 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80088f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800893:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800897:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089b:	e9 5c ff ff ff       	jmp    8007fc <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008a0:	4c 89 ee             	mov    %r13,%rsi
+  8008a3:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008a8:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008ab:	4c 89 ee             	mov    %r13,%rsi
+  8008ae:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008b3:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008b6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008bc:	77 47                	ja     800905 <vprintfmt+0x5f3>
+  8008be:	89 c2                	mov    %eax,%edx
+  8008c0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c4:	83 c0 08             	add    $0x8,%eax
+  8008c7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ca:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008cd:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8008d6:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008da:	0f 94 c0             	sete   %al
+  8008dd:	0f b6 c0             	movzbl %al,%eax
+  8008e0:	50                   	push   %rax
+  8008e1:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008e6:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008ea:	4c 89 ee             	mov    %r13,%rsi
+  8008ed:	4c 89 f7             	mov    %r14,%rdi
+  8008f0:	48 b8 07 02 80 00 00 	movabs $0x800207,%rax
+  8008f7:	00 00 00 
+  8008fa:	ff d0                	call   *%rax
+            break;
+  8008fc:	48 83 c4 10          	add    $0x10,%rsp
+  800900:	e9 3e fa ff ff       	jmp    800343 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800905:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800909:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80090d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800911:	eb b7                	jmp    8008ca <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800913:	40 84 f6             	test   %sil,%sil
+  800916:	75 2b                	jne    800943 <vprintfmt+0x631>
+    switch (lflag) {
+  800918:	85 d2                	test   %edx,%edx
+  80091a:	74 56                	je     800972 <vprintfmt+0x660>
+  80091c:	83 fa 01             	cmp    $0x1,%edx
+  80091f:	74 7f                	je     8009a0 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800921:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800924:	83 f8 2f             	cmp    $0x2f,%eax
+  800927:	0f 87 a2 00 00 00    	ja     8009cf <vprintfmt+0x6bd>
+  80092d:	89 c2                	mov    %eax,%edx
+  80092f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800933:	83 c0 08             	add    $0x8,%eax
+  800936:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800939:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80093c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800941:	eb 8f                	jmp    8008d2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800943:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800946:	83 f8 2f             	cmp    $0x2f,%eax
+  800949:	77 19                	ja     800964 <vprintfmt+0x652>
+  80094b:	89 c2                	mov    %eax,%edx
+  80094d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800951:	83 c0 08             	add    $0x8,%eax
+  800954:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800957:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80095a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80095f:	e9 6e ff ff ff       	jmp    8008d2 <vprintfmt+0x5c0>
+  800964:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800968:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800970:	eb e5                	jmp    800957 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800972:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800975:	83 f8 2f             	cmp    $0x2f,%eax
+  800978:	77 18                	ja     800992 <vprintfmt+0x680>
+  80097a:	89 c2                	mov    %eax,%edx
+  80097c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800980:	83 c0 08             	add    $0x8,%eax
+  800983:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800986:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800988:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80098d:	e9 40 ff ff ff       	jmp    8008d2 <vprintfmt+0x5c0>
+  800992:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800996:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099e:	eb e6                	jmp    800986 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a6:	77 19                	ja     8009c1 <vprintfmt+0x6af>
+  8009a8:	89 c2                	mov    %eax,%edx
+  8009aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ae:	83 c0 08             	add    $0x8,%eax
+  8009b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009b7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009bc:	e9 11 ff ff ff       	jmp    8008d2 <vprintfmt+0x5c0>
+  8009c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cd:	eb e5                	jmp    8009b4 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009cf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009db:	e9 59 ff ff ff       	jmp    800939 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009e0:	4c 89 ee             	mov    %r13,%rsi
+  8009e3:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009e8:	41 ff d6             	call   *%r14
+            break;
+  8009eb:	e9 53 f9 ff ff       	jmp    800343 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8009f0:	4c 89 ee             	mov    %r13,%rsi
+  8009f3:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009f8:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8009fb:	48 83 eb 01          	sub    $0x1,%rbx
+  8009ff:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a03:	75 f6                	jne    8009fb <vprintfmt+0x6e9>
+  800a05:	e9 39 f9 ff ff       	jmp    800343 <vprintfmt+0x31>
+}
+  800a0a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a0e:	5b                   	pop    %rbx
+  800a0f:	41 5c                	pop    %r12
+  800a11:	41 5d                	pop    %r13
+  800a13:	41 5e                	pop    %r14
+  800a15:	41 5f                	pop    %r15
+  800a17:	5d                   	pop    %rbp
+  800a18:	c3                   	ret
+
+0000000000800a19 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a19:	55                   	push   %rbp
+  800a1a:	48 89 e5             	mov    %rsp,%rbp
+  800a1d:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a21:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a25:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a2a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a2e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a35:	48 85 ff             	test   %rdi,%rdi
+  800a38:	74 2b                	je     800a65 <vsnprintf+0x4c>
+  800a3a:	48 85 f6             	test   %rsi,%rsi
+  800a3d:	74 26                	je     800a65 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a3f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a43:	48 bf bd 02 80 00 00 	movabs $0x8002bd,%rdi
+  800a4a:	00 00 00 
+  800a4d:	48 b8 12 03 80 00 00 	movabs $0x800312,%rax
+  800a54:	00 00 00 
+  800a57:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a5d:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a60:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a63:	c9                   	leave
+  800a64:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a6a:	eb f7                	jmp    800a63 <vsnprintf+0x4a>
+
+0000000000800a6c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a6c:	55                   	push   %rbp
+  800a6d:	48 89 e5             	mov    %rsp,%rbp
+  800a70:	48 83 ec 50          	sub    $0x50,%rsp
+  800a74:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a78:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a7c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a80:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a87:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800a93:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800a97:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800a9b:	48 b8 19 0a 80 00 00 	movabs $0x800a19,%rax
+  800aa2:	00 00 00 
+  800aa5:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800aa7:	c9                   	leave
+  800aa8:	c3                   	ret
+
+0000000000800aa9 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800aa9:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800aac:	74 10                	je     800abe <strlen+0x15>
+    size_t n = 0;
+  800aae:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ab3:	48 83 c0 01          	add    $0x1,%rax
+  800ab7:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800abb:	75 f6                	jne    800ab3 <strlen+0xa>
+  800abd:	c3                   	ret
+    size_t n = 0;
+  800abe:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ac3:	c3                   	ret
+
+0000000000800ac4 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ac4:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ac7:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800acc:	48 85 f6             	test   %rsi,%rsi
+  800acf:	74 11                	je     800ae2 <strnlen+0x1e>
+  800ad1:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ad5:	74 0c                	je     800ae3 <strnlen+0x1f>
+  800ad7:	48 83 c2 01          	add    $0x1,%rdx
+  800adb:	48 39 d0             	cmp    %rdx,%rax
+  800ade:	75 f1                	jne    800ad1 <strnlen+0xd>
+  800ae0:	eb 04                	jmp    800ae6 <strnlen+0x22>
+  800ae2:	c3                   	ret
+  800ae3:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ae6:	c3                   	ret
+
+0000000000800ae7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ae7:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800aea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800aef:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800af3:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800af6:	48 83 c2 01          	add    $0x1,%rdx
+  800afa:	84 c9                	test   %cl,%cl
+  800afc:	75 f1                	jne    800aef <strcpy+0x8>
+        ;
+    return res;
+}
+  800afe:	c3                   	ret
+
+0000000000800aff <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800aff:	55                   	push   %rbp
+  800b00:	48 89 e5             	mov    %rsp,%rbp
+  800b03:	41 54                	push   %r12
+  800b05:	53                   	push   %rbx
+  800b06:	48 89 fb             	mov    %rdi,%rbx
+  800b09:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b0c:	48 b8 a9 0a 80 00 00 	movabs $0x800aa9,%rax
+  800b13:	00 00 00 
+  800b16:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b18:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b1c:	4c 89 e6             	mov    %r12,%rsi
+  800b1f:	48 b8 e7 0a 80 00 00 	movabs $0x800ae7,%rax
+  800b26:	00 00 00 
+  800b29:	ff d0                	call   *%rax
+    return dst;
+}
+  800b2b:	48 89 d8             	mov    %rbx,%rax
+  800b2e:	5b                   	pop    %rbx
+  800b2f:	41 5c                	pop    %r12
+  800b31:	5d                   	pop    %rbp
+  800b32:	c3                   	ret
+
+0000000000800b33 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b33:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b36:	48 85 d2             	test   %rdx,%rdx
+  800b39:	74 1f                	je     800b5a <strncpy+0x27>
+  800b3b:	48 01 fa             	add    %rdi,%rdx
+  800b3e:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b41:	48 83 c1 01          	add    $0x1,%rcx
+  800b45:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b49:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b4d:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b51:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b55:	48 39 ca             	cmp    %rcx,%rdx
+  800b58:	75 e7                	jne    800b41 <strncpy+0xe>
+    }
+    return ret;
+}
+  800b5a:	c3                   	ret
+
+0000000000800b5b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b5b:	48 89 f8             	mov    %rdi,%rax
+  800b5e:	48 85 d2             	test   %rdx,%rdx
+  800b61:	74 24                	je     800b87 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b63:	48 83 ea 01          	sub    $0x1,%rdx
+  800b67:	74 1b                	je     800b84 <strlcpy+0x29>
+  800b69:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b6d:	0f b6 16             	movzbl (%rsi),%edx
+  800b70:	84 d2                	test   %dl,%dl
+  800b72:	74 10                	je     800b84 <strlcpy+0x29>
+            *dst++ = *src++;
+  800b74:	48 83 c6 01          	add    $0x1,%rsi
+  800b78:	48 83 c0 01          	add    $0x1,%rax
+  800b7c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b7f:	48 39 c8             	cmp    %rcx,%rax
+  800b82:	75 e9                	jne    800b6d <strlcpy+0x12>
+        *dst = '\0';
+  800b84:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800b87:	48 29 f8             	sub    %rdi,%rax
+}
+  800b8a:	c3                   	ret
+
+0000000000800b8b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800b8b:	0f b6 07             	movzbl (%rdi),%eax
+  800b8e:	84 c0                	test   %al,%al
+  800b90:	74 13                	je     800ba5 <strcmp+0x1a>
+  800b92:	38 06                	cmp    %al,(%rsi)
+  800b94:	75 0f                	jne    800ba5 <strcmp+0x1a>
+  800b96:	48 83 c7 01          	add    $0x1,%rdi
+  800b9a:	48 83 c6 01          	add    $0x1,%rsi
+  800b9e:	0f b6 07             	movzbl (%rdi),%eax
+  800ba1:	84 c0                	test   %al,%al
+  800ba3:	75 ed                	jne    800b92 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ba5:	0f b6 c0             	movzbl %al,%eax
+  800ba8:	0f b6 16             	movzbl (%rsi),%edx
+  800bab:	29 d0                	sub    %edx,%eax
+}
+  800bad:	c3                   	ret
+
+0000000000800bae <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bae:	48 85 d2             	test   %rdx,%rdx
+  800bb1:	74 1f                	je     800bd2 <strncmp+0x24>
+  800bb3:	0f b6 07             	movzbl (%rdi),%eax
+  800bb6:	84 c0                	test   %al,%al
+  800bb8:	74 1e                	je     800bd8 <strncmp+0x2a>
+  800bba:	3a 06                	cmp    (%rsi),%al
+  800bbc:	75 1a                	jne    800bd8 <strncmp+0x2a>
+  800bbe:	48 83 c7 01          	add    $0x1,%rdi
+  800bc2:	48 83 c6 01          	add    $0x1,%rsi
+  800bc6:	48 83 ea 01          	sub    $0x1,%rdx
+  800bca:	75 e7                	jne    800bb3 <strncmp+0x5>
+
+    if (!n) return 0;
+  800bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd1:	c3                   	ret
+  800bd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd7:	c3                   	ret
+  800bd8:	48 85 d2             	test   %rdx,%rdx
+  800bdb:	74 09                	je     800be6 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bdd:	0f b6 07             	movzbl (%rdi),%eax
+  800be0:	0f b6 16             	movzbl (%rsi),%edx
+  800be3:	29 d0                	sub    %edx,%eax
+  800be5:	c3                   	ret
+    if (!n) return 0;
+  800be6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800beb:	c3                   	ret
+
+0000000000800bec <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800bec:	0f b6 17             	movzbl (%rdi),%edx
+  800bef:	84 d2                	test   %dl,%dl
+  800bf1:	74 18                	je     800c0b <strchr+0x1f>
+        if (*str == c) {
+  800bf3:	0f be d2             	movsbl %dl,%edx
+  800bf6:	39 f2                	cmp    %esi,%edx
+  800bf8:	74 17                	je     800c11 <strchr+0x25>
+    for (; *str; str++) {
+  800bfa:	48 83 c7 01          	add    $0x1,%rdi
+  800bfe:	0f b6 17             	movzbl (%rdi),%edx
+  800c01:	84 d2                	test   %dl,%dl
+  800c03:	75 ee                	jne    800bf3 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c05:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c0a:	c3                   	ret
+  800c0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c10:	c3                   	ret
+  800c11:	48 89 f8             	mov    %rdi,%rax
+}
+  800c14:	c3                   	ret
+
+0000000000800c15 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c15:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c18:	0f b6 17             	movzbl (%rdi),%edx
+  800c1b:	84 d2                	test   %dl,%dl
+  800c1d:	74 13                	je     800c32 <strfind+0x1d>
+  800c1f:	0f be d2             	movsbl %dl,%edx
+  800c22:	39 f2                	cmp    %esi,%edx
+  800c24:	74 0b                	je     800c31 <strfind+0x1c>
+  800c26:	48 83 c0 01          	add    $0x1,%rax
+  800c2a:	0f b6 10             	movzbl (%rax),%edx
+  800c2d:	84 d2                	test   %dl,%dl
+  800c2f:	75 ee                	jne    800c1f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c31:	c3                   	ret
+  800c32:	c3                   	ret
+
+0000000000800c33 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c33:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c36:	48 89 f8             	mov    %rdi,%rax
+  800c39:	48 f7 d8             	neg    %rax
+  800c3c:	83 e0 07             	and    $0x7,%eax
+  800c3f:	49 89 d1             	mov    %rdx,%r9
+  800c42:	49 29 c1             	sub    %rax,%r9
+  800c45:	78 36                	js     800c7d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c47:	40 0f b6 c6          	movzbl %sil,%eax
+  800c4b:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c52:	01 01 01 
+  800c55:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c59:	40 f6 c7 07          	test   $0x7,%dil
+  800c5d:	75 38                	jne    800c97 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c5f:	4c 89 c9             	mov    %r9,%rcx
+  800c62:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c66:	74 0c                	je     800c74 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c68:	fc                   	cld
+  800c69:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c6c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c70:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c74:	4d 85 c9             	test   %r9,%r9
+  800c77:	75 45                	jne    800cbe <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c79:	4c 89 c0             	mov    %r8,%rax
+  800c7c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c7d:	48 85 d2             	test   %rdx,%rdx
+  800c80:	74 f7                	je     800c79 <memset+0x46>
+  800c82:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c85:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800c88:	48 83 c0 01          	add    $0x1,%rax
+  800c8c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800c90:	48 39 c2             	cmp    %rax,%rdx
+  800c93:	75 f3                	jne    800c88 <memset+0x55>
+  800c95:	eb e2                	jmp    800c79 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800c97:	40 f6 c7 01          	test   $0x1,%dil
+  800c9b:	74 06                	je     800ca3 <memset+0x70>
+  800c9d:	88 07                	mov    %al,(%rdi)
+  800c9f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ca3:	40 f6 c7 02          	test   $0x2,%dil
+  800ca7:	74 07                	je     800cb0 <memset+0x7d>
+  800ca9:	66 89 07             	mov    %ax,(%rdi)
+  800cac:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cb0:	40 f6 c7 04          	test   $0x4,%dil
+  800cb4:	74 a9                	je     800c5f <memset+0x2c>
+  800cb6:	89 07                	mov    %eax,(%rdi)
+  800cb8:	48 83 c7 04          	add    $0x4,%rdi
+  800cbc:	eb a1                	jmp    800c5f <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cbe:	41 f6 c1 04          	test   $0x4,%r9b
+  800cc2:	74 06                	je     800cca <memset+0x97>
+  800cc4:	89 07                	mov    %eax,(%rdi)
+  800cc6:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cca:	41 f6 c1 02          	test   $0x2,%r9b
+  800cce:	74 07                	je     800cd7 <memset+0xa4>
+  800cd0:	66 89 07             	mov    %ax,(%rdi)
+  800cd3:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800cd7:	41 f6 c1 01          	test   $0x1,%r9b
+  800cdb:	74 9c                	je     800c79 <memset+0x46>
+  800cdd:	88 07                	mov    %al,(%rdi)
+  800cdf:	eb 98                	jmp    800c79 <memset+0x46>
+
+0000000000800ce1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ce1:	48 89 f8             	mov    %rdi,%rax
+  800ce4:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ce7:	48 39 fe             	cmp    %rdi,%rsi
+  800cea:	73 3b                	jae    800d27 <memmove+0x46>
+  800cec:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800cf0:	48 39 d7             	cmp    %rdx,%rdi
+  800cf3:	73 32                	jae    800d27 <memmove+0x46>
+        s += n;
+        d += n;
+  800cf5:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800cf9:	48 89 d6             	mov    %rdx,%rsi
+  800cfc:	48 09 fe             	or     %rdi,%rsi
+  800cff:	48 09 ce             	or     %rcx,%rsi
+  800d02:	40 f6 c6 07          	test   $0x7,%sil
+  800d06:	75 12                	jne    800d1a <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d08:	48 83 ef 08          	sub    $0x8,%rdi
+  800d0c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d10:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d14:	fd                   	std
+  800d15:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d18:	fc                   	cld
+  800d19:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d1a:	48 83 ef 01          	sub    $0x1,%rdi
+  800d1e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d22:	fd                   	std
+  800d23:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d25:	eb f1                	jmp    800d18 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d27:	48 89 f2             	mov    %rsi,%rdx
+  800d2a:	48 09 c2             	or     %rax,%rdx
+  800d2d:	48 09 ca             	or     %rcx,%rdx
+  800d30:	f6 c2 07             	test   $0x7,%dl
+  800d33:	75 0c                	jne    800d41 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d35:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d39:	48 89 c7             	mov    %rax,%rdi
+  800d3c:	fc                   	cld
+  800d3d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d40:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d41:	48 89 c7             	mov    %rax,%rdi
+  800d44:	fc                   	cld
+  800d45:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d47:	c3                   	ret
+
+0000000000800d48 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d48:	55                   	push   %rbp
+  800d49:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d4c:	48 b8 e1 0c 80 00 00 	movabs $0x800ce1,%rax
+  800d53:	00 00 00 
+  800d56:	ff d0                	call   *%rax
+}
+  800d58:	5d                   	pop    %rbp
+  800d59:	c3                   	ret
+
+0000000000800d5a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d5a:	55                   	push   %rbp
+  800d5b:	48 89 e5             	mov    %rsp,%rbp
+  800d5e:	41 57                	push   %r15
+  800d60:	41 56                	push   %r14
+  800d62:	41 55                	push   %r13
+  800d64:	41 54                	push   %r12
+  800d66:	53                   	push   %rbx
+  800d67:	48 83 ec 08          	sub    $0x8,%rsp
+  800d6b:	49 89 fe             	mov    %rdi,%r14
+  800d6e:	49 89 f7             	mov    %rsi,%r15
+  800d71:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d74:	48 89 f7             	mov    %rsi,%rdi
+  800d77:	48 b8 a9 0a 80 00 00 	movabs $0x800aa9,%rax
+  800d7e:	00 00 00 
+  800d81:	ff d0                	call   *%rax
+  800d83:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d86:	48 89 de             	mov    %rbx,%rsi
+  800d89:	4c 89 f7             	mov    %r14,%rdi
+  800d8c:	48 b8 c4 0a 80 00 00 	movabs $0x800ac4,%rax
+  800d93:	00 00 00 
+  800d96:	ff d0                	call   *%rax
+  800d98:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800d9b:	48 39 c3             	cmp    %rax,%rbx
+  800d9e:	74 36                	je     800dd6 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800da0:	48 89 d8             	mov    %rbx,%rax
+  800da3:	4c 29 e8             	sub    %r13,%rax
+  800da6:	49 39 c4             	cmp    %rax,%r12
+  800da9:	73 31                	jae    800ddc <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800dab:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800db0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800db4:	4c 89 fe             	mov    %r15,%rsi
+  800db7:	48 b8 48 0d 80 00 00 	movabs $0x800d48,%rax
+  800dbe:	00 00 00 
+  800dc1:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dc3:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800dc7:	48 83 c4 08          	add    $0x8,%rsp
+  800dcb:	5b                   	pop    %rbx
+  800dcc:	41 5c                	pop    %r12
+  800dce:	41 5d                	pop    %r13
+  800dd0:	41 5e                	pop    %r14
+  800dd2:	41 5f                	pop    %r15
+  800dd4:	5d                   	pop    %rbp
+  800dd5:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800dd6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800dda:	eb eb                	jmp    800dc7 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800ddc:	48 83 eb 01          	sub    $0x1,%rbx
+  800de0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800de4:	48 89 da             	mov    %rbx,%rdx
+  800de7:	4c 89 fe             	mov    %r15,%rsi
+  800dea:	48 b8 48 0d 80 00 00 	movabs $0x800d48,%rax
+  800df1:	00 00 00 
+  800df4:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800df6:	49 01 de             	add    %rbx,%r14
+  800df9:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800dfe:	eb c3                	jmp    800dc3 <strlcat+0x69>
+
+0000000000800e00 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e00:	48 85 d2             	test   %rdx,%rdx
+  800e03:	74 2d                	je     800e32 <memcmp+0x32>
+  800e05:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e0a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e0e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e13:	44 38 c1             	cmp    %r8b,%cl
+  800e16:	75 0f                	jne    800e27 <memcmp+0x27>
+    while (n-- > 0) {
+  800e18:	48 83 c0 01          	add    $0x1,%rax
+  800e1c:	48 39 c2             	cmp    %rax,%rdx
+  800e1f:	75 e9                	jne    800e0a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e26:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e27:	0f b6 c1             	movzbl %cl,%eax
+  800e2a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e2e:	44 29 c0             	sub    %r8d,%eax
+  800e31:	c3                   	ret
+    return 0;
+  800e32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e37:	c3                   	ret
+
+0000000000800e38 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e38:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e3c:	48 39 c7             	cmp    %rax,%rdi
+  800e3f:	73 0f                	jae    800e50 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e41:	40 38 37             	cmp    %sil,(%rdi)
+  800e44:	74 0e                	je     800e54 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e46:	48 83 c7 01          	add    $0x1,%rdi
+  800e4a:	48 39 f8             	cmp    %rdi,%rax
+  800e4d:	75 f2                	jne    800e41 <memfind+0x9>
+  800e4f:	c3                   	ret
+  800e50:	48 89 f8             	mov    %rdi,%rax
+  800e53:	c3                   	ret
+  800e54:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e57:	c3                   	ret
+
+0000000000800e58 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e58:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e5b:	0f b6 37             	movzbl (%rdi),%esi
+  800e5e:	40 80 fe 20          	cmp    $0x20,%sil
+  800e62:	74 06                	je     800e6a <strtol+0x12>
+  800e64:	40 80 fe 09          	cmp    $0x9,%sil
+  800e68:	75 13                	jne    800e7d <strtol+0x25>
+  800e6a:	48 83 c7 01          	add    $0x1,%rdi
+  800e6e:	0f b6 37             	movzbl (%rdi),%esi
+  800e71:	40 80 fe 20          	cmp    $0x20,%sil
+  800e75:	74 f3                	je     800e6a <strtol+0x12>
+  800e77:	40 80 fe 09          	cmp    $0x9,%sil
+  800e7b:	74 ed                	je     800e6a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e7d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e80:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e83:	3c 01                	cmp    $0x1,%al
+  800e85:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800e89:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800e8f:	75 0f                	jne    800ea0 <strtol+0x48>
+  800e91:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800e94:	74 14                	je     800eaa <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800e96:	85 d2                	test   %edx,%edx
+  800e98:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e9d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ea0:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ea5:	4c 63 ca             	movslq %edx,%r9
+  800ea8:	eb 36                	jmp    800ee0 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eaa:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800eae:	74 0f                	je     800ebf <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800eb0:	85 d2                	test   %edx,%edx
+  800eb2:	75 ec                	jne    800ea0 <strtol+0x48>
+        s++;
+  800eb4:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800eb8:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ebd:	eb e1                	jmp    800ea0 <strtol+0x48>
+        s += 2;
+  800ebf:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ec3:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ec8:	eb d6                	jmp    800ea0 <strtol+0x48>
+            dig -= '0';
+  800eca:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ecd:	44 0f b6 c1          	movzbl %cl,%r8d
+  800ed1:	41 39 d0             	cmp    %edx,%r8d
+  800ed4:	7d 21                	jge    800ef7 <strtol+0x9f>
+        val = val * base + dig;
+  800ed6:	49 0f af c1          	imul   %r9,%rax
+  800eda:	0f b6 c9             	movzbl %cl,%ecx
+  800edd:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800ee0:	48 83 c7 01          	add    $0x1,%rdi
+  800ee4:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800ee8:	80 f9 39             	cmp    $0x39,%cl
+  800eeb:	76 dd                	jbe    800eca <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800eed:	80 f9 7b             	cmp    $0x7b,%cl
+  800ef0:	77 05                	ja     800ef7 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800ef2:	83 e9 57             	sub    $0x57,%ecx
+  800ef5:	eb d6                	jmp    800ecd <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800ef7:	4d 85 d2             	test   %r10,%r10
+  800efa:	74 03                	je     800eff <strtol+0xa7>
+  800efc:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800eff:	48 89 c2             	mov    %rax,%rdx
+  800f02:	48 f7 da             	neg    %rdx
+  800f05:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f09:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f0d:	c3                   	ret
+
+0000000000800f0e <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f0e:	55                   	push   %rbp
+  800f0f:	48 89 e5             	mov    %rsp,%rbp
+  800f12:	53                   	push   %rbx
+  800f13:	48 89 fa             	mov    %rdi,%rdx
+  800f16:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f19:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f23:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f28:	be 00 00 00 00       	mov    $0x0,%esi
+  800f2d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f33:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f35:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f39:	c9                   	leave
+  800f3a:	c3                   	ret
+
+0000000000800f3b <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f3b:	55                   	push   %rbp
+  800f3c:	48 89 e5             	mov    %rsp,%rbp
+  800f3f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f40:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f54:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f59:	be 00 00 00 00       	mov    $0x0,%esi
+  800f5e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f64:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f66:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f6a:	c9                   	leave
+  800f6b:	c3                   	ret
+
+0000000000800f6c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800f6c:	55                   	push   %rbp
+  800f6d:	48 89 e5             	mov    %rsp,%rbp
+  800f70:	53                   	push   %rbx
+  800f71:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f75:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800f78:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f87:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f8c:	be 00 00 00 00       	mov    $0x0,%esi
+  800f91:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f97:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800f99:	48 85 c0             	test   %rax,%rax
+  800f9c:	7f 06                	jg     800fa4 <sys_env_destroy+0x38>
+}
+  800f9e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fa2:	c9                   	leave
+  800fa3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fa4:	49 89 c0             	mov    %rax,%r8
+  800fa7:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fac:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  800fb3:	00 00 00 
+  800fb6:	be 26 00 00 00       	mov    $0x26,%esi
+  800fbb:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  800fc2:	00 00 00 
+  800fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fca:	49 b9 0c 29 80 00 00 	movabs $0x80290c,%r9
+  800fd1:	00 00 00 
+  800fd4:	41 ff d1             	call   *%r9
+
+0000000000800fd7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800fd7:	55                   	push   %rbp
+  800fd8:	48 89 e5             	mov    %rsp,%rbp
+  800fdb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800fdc:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fe1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800feb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ff5:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801000:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801002:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801006:	c9                   	leave
+  801007:	c3                   	ret
+
+0000000000801008 <sys_yield>:
+
+void
+sys_yield(void) {
+  801008:	55                   	push   %rbp
+  801009:	48 89 e5             	mov    %rsp,%rbp
+  80100c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80100d:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801012:	ba 00 00 00 00       	mov    $0x0,%edx
+  801017:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80101c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801021:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801026:	be 00 00 00 00       	mov    $0x0,%esi
+  80102b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801031:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801033:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801037:	c9                   	leave
+  801038:	c3                   	ret
+
+0000000000801039 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801039:	55                   	push   %rbp
+  80103a:	48 89 e5             	mov    %rsp,%rbp
+  80103d:	53                   	push   %rbx
+  80103e:	48 89 fa             	mov    %rdi,%rdx
+  801041:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801044:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801049:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801050:	00 00 00 
+  801053:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801058:	be 00 00 00 00       	mov    $0x0,%esi
+  80105d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801063:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801065:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801069:	c9                   	leave
+  80106a:	c3                   	ret
+
+000000000080106b <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80106b:	55                   	push   %rbp
+  80106c:	48 89 e5             	mov    %rsp,%rbp
+  80106f:	53                   	push   %rbx
+  801070:	49 89 f8             	mov    %rdi,%r8
+  801073:	48 89 d3             	mov    %rdx,%rbx
+  801076:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801079:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80107e:	4c 89 c2             	mov    %r8,%rdx
+  801081:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801084:	be 00 00 00 00       	mov    $0x0,%esi
+  801089:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80108f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801091:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801095:	c9                   	leave
+  801096:	c3                   	ret
+
+0000000000801097 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801097:	55                   	push   %rbp
+  801098:	48 89 e5             	mov    %rsp,%rbp
+  80109b:	53                   	push   %rbx
+  80109c:	48 83 ec 08          	sub    $0x8,%rsp
+  8010a0:	89 f8                	mov    %edi,%eax
+  8010a2:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010a5:	48 63 f9             	movslq %ecx,%rdi
+  8010a8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010ab:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010b0:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010c0:	48 85 c0             	test   %rax,%rax
+  8010c3:	7f 06                	jg     8010cb <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8010c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010c9:	c9                   	leave
+  8010ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010cb:	49 89 c0             	mov    %rax,%r8
+  8010ce:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8010d3:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  8010da:	00 00 00 
+  8010dd:	be 26 00 00 00       	mov    $0x26,%esi
+  8010e2:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  8010e9:	00 00 00 
+  8010ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f1:	49 b9 0c 29 80 00 00 	movabs $0x80290c,%r9
+  8010f8:	00 00 00 
+  8010fb:	41 ff d1             	call   *%r9
+
+00000000008010fe <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8010fe:	55                   	push   %rbp
+  8010ff:	48 89 e5             	mov    %rsp,%rbp
+  801102:	53                   	push   %rbx
+  801103:	48 83 ec 08          	sub    $0x8,%rsp
+  801107:	89 f8                	mov    %edi,%eax
+  801109:	49 89 f2             	mov    %rsi,%r10
+  80110c:	48 89 cf             	mov    %rcx,%rdi
+  80110f:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801112:	48 63 da             	movslq %edx,%rbx
+  801115:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801118:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80111d:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801120:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801123:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801125:	48 85 c0             	test   %rax,%rax
+  801128:	7f 06                	jg     801130 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80112a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80112e:	c9                   	leave
+  80112f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801130:	49 89 c0             	mov    %rax,%r8
+  801133:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801138:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  80113f:	00 00 00 
+  801142:	be 26 00 00 00       	mov    $0x26,%esi
+  801147:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  80114e:	00 00 00 
+  801151:	b8 00 00 00 00       	mov    $0x0,%eax
+  801156:	49 b9 0c 29 80 00 00 	movabs $0x80290c,%r9
+  80115d:	00 00 00 
+  801160:	41 ff d1             	call   *%r9
+
+0000000000801163 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801163:	55                   	push   %rbp
+  801164:	48 89 e5             	mov    %rsp,%rbp
+  801167:	53                   	push   %rbx
+  801168:	48 83 ec 08          	sub    $0x8,%rsp
+  80116c:	48 89 f1             	mov    %rsi,%rcx
+  80116f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801172:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801175:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80117a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80117f:	be 00 00 00 00       	mov    $0x0,%esi
+  801184:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80118a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80118c:	48 85 c0             	test   %rax,%rax
+  80118f:	7f 06                	jg     801197 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801191:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801195:	c9                   	leave
+  801196:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801197:	49 89 c0             	mov    %rax,%r8
+  80119a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80119f:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  8011a6:	00 00 00 
+  8011a9:	be 26 00 00 00       	mov    $0x26,%esi
+  8011ae:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  8011b5:	00 00 00 
+  8011b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011bd:	49 b9 0c 29 80 00 00 	movabs $0x80290c,%r9
+  8011c4:	00 00 00 
+  8011c7:	41 ff d1             	call   *%r9
+
+00000000008011ca <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8011ca:	55                   	push   %rbp
+  8011cb:	48 89 e5             	mov    %rsp,%rbp
+  8011ce:	53                   	push   %rbx
+  8011cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8011d3:	89 f8                	mov    %edi,%eax
+  8011d5:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8011d8:	48 63 f9             	movslq %ecx,%rdi
+  8011db:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011de:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011e3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011f3:	48 85 c0             	test   %rax,%rax
+  8011f6:	7f 06                	jg     8011fe <sys_region_advise+0x34>
+}
+  8011f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011fc:	c9                   	leave
+  8011fd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011fe:	49 89 c0             	mov    %rax,%r8
+  801201:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801206:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  80120d:	00 00 00 
+  801210:	be 26 00 00 00       	mov    $0x26,%esi
+  801215:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  80121c:	00 00 00 
+  80121f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801224:	49 b9 0c 29 80 00 00 	movabs $0x80290c,%r9
+  80122b:	00 00 00 
+  80122e:	41 ff d1             	call   *%r9
+
+0000000000801231 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801231:	55                   	push   %rbp
+  801232:	48 89 e5             	mov    %rsp,%rbp
+  801235:	53                   	push   %rbx
+  801236:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80123a:	48 63 ce             	movslq %esi,%rcx
+  80123d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801240:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801245:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80124f:	be 00 00 00 00       	mov    $0x0,%esi
+  801254:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80125a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80125c:	48 85 c0             	test   %rax,%rax
+  80125f:	7f 06                	jg     801267 <sys_env_set_nice+0x36>
+}
+  801261:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801265:	c9                   	leave
+  801266:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801267:	49 89 c0             	mov    %rax,%r8
+  80126a:	b9 15 00 00 00       	mov    $0x15,%ecx
+  80126f:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  801276:	00 00 00 
+  801279:	be 26 00 00 00       	mov    $0x26,%esi
+  80127e:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  801285:	00 00 00 
+  801288:	b8 00 00 00 00       	mov    $0x0,%eax
+  80128d:	49 b9 0c 29 80 00 00 	movabs $0x80290c,%r9
+  801294:	00 00 00 
+  801297:	41 ff d1             	call   *%r9
+
+000000000080129a <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80129a:	55                   	push   %rbp
+  80129b:	48 89 e5             	mov    %rsp,%rbp
+  80129e:	53                   	push   %rbx
+  80129f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012a3:	48 63 ce             	movslq %esi,%rcx
+  8012a6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a9:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012c5:	48 85 c0             	test   %rax,%rax
+  8012c8:	7f 06                	jg     8012d0 <sys_env_set_status+0x36>
+}
+  8012ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ce:	c9                   	leave
+  8012cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d0:	49 89 c0             	mov    %rax,%r8
+  8012d3:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012d8:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  8012df:	00 00 00 
+  8012e2:	be 26 00 00 00       	mov    $0x26,%esi
+  8012e7:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  8012ee:	00 00 00 
+  8012f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f6:	49 b9 0c 29 80 00 00 	movabs $0x80290c,%r9
+  8012fd:	00 00 00 
+  801300:	41 ff d1             	call   *%r9
+
+0000000000801303 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801303:	55                   	push   %rbp
+  801304:	48 89 e5             	mov    %rsp,%rbp
+  801307:	53                   	push   %rbx
+  801308:	48 83 ec 08          	sub    $0x8,%rsp
+  80130c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80130f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801312:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801317:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801321:	be 00 00 00 00       	mov    $0x0,%esi
+  801326:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80132c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80132e:	48 85 c0             	test   %rax,%rax
+  801331:	7f 06                	jg     801339 <sys_env_set_trapframe+0x36>
+}
+  801333:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801337:	c9                   	leave
+  801338:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801339:	49 89 c0             	mov    %rax,%r8
+  80133c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801341:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  801348:	00 00 00 
+  80134b:	be 26 00 00 00       	mov    $0x26,%esi
+  801350:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  801357:	00 00 00 
+  80135a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80135f:	49 b9 0c 29 80 00 00 	movabs $0x80290c,%r9
+  801366:	00 00 00 
+  801369:	41 ff d1             	call   *%r9
+
+000000000080136c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80136c:	55                   	push   %rbp
+  80136d:	48 89 e5             	mov    %rsp,%rbp
+  801370:	53                   	push   %rbx
+  801371:	48 83 ec 08          	sub    $0x8,%rsp
+  801375:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801378:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80137b:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801380:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801385:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80138a:	be 00 00 00 00       	mov    $0x0,%esi
+  80138f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801395:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801397:	48 85 c0             	test   %rax,%rax
+  80139a:	7f 06                	jg     8013a2 <sys_env_set_pgfault_upcall+0x36>
+}
+  80139c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a0:	c9                   	leave
+  8013a1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013a2:	49 89 c0             	mov    %rax,%r8
+  8013a5:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013aa:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  8013b1:	00 00 00 
+  8013b4:	be 26 00 00 00       	mov    $0x26,%esi
+  8013b9:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  8013c0:	00 00 00 
+  8013c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c8:	49 b9 0c 29 80 00 00 	movabs $0x80290c,%r9
+  8013cf:	00 00 00 
+  8013d2:	41 ff d1             	call   *%r9
+
+00000000008013d5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013d5:	55                   	push   %rbp
+  8013d6:	48 89 e5             	mov    %rsp,%rbp
+  8013d9:	53                   	push   %rbx
+  8013da:	89 f8                	mov    %edi,%eax
+  8013dc:	49 89 f1             	mov    %rsi,%r9
+  8013df:	48 89 d3             	mov    %rdx,%rbx
+  8013e2:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8013e5:	49 63 f0             	movslq %r8d,%rsi
+  8013e8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013eb:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013f0:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f9:	cd 30                	int    $0x30
+}
+  8013fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ff:	c9                   	leave
+  801400:	c3                   	ret
+
+0000000000801401 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801401:	55                   	push   %rbp
+  801402:	48 89 e5             	mov    %rsp,%rbp
+  801405:	53                   	push   %rbx
+  801406:	48 83 ec 08          	sub    $0x8,%rsp
+  80140a:	48 89 fa             	mov    %rdi,%rdx
+  80140d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801410:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801415:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80141f:	be 00 00 00 00       	mov    $0x0,%esi
+  801424:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80142a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80142c:	48 85 c0             	test   %rax,%rax
+  80142f:	7f 06                	jg     801437 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801431:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801435:	c9                   	leave
+  801436:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801437:	49 89 c0             	mov    %rax,%r8
+  80143a:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80143f:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  801446:	00 00 00 
+  801449:	be 26 00 00 00       	mov    $0x26,%esi
+  80144e:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  801455:	00 00 00 
+  801458:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145d:	49 b9 0c 29 80 00 00 	movabs $0x80290c,%r9
+  801464:	00 00 00 
+  801467:	41 ff d1             	call   *%r9
+
+000000000080146a <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80146a:	55                   	push   %rbp
+  80146b:	48 89 e5             	mov    %rsp,%rbp
+  80146e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80146f:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801474:	ba 00 00 00 00       	mov    $0x0,%edx
+  801479:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80147e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801483:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801488:	be 00 00 00 00       	mov    $0x0,%esi
+  80148d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801493:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801495:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801499:	c9                   	leave
+  80149a:	c3                   	ret
+
+000000000080149b <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	53                   	push   %rbx
+  8014a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8014a4:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8014a7:	48 63 ce             	movslq %esi,%rcx
+  8014aa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ad:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c4:	48 85 c0             	test   %rax,%rax
+  8014c7:	7f 06                	jg     8014cf <sys_sigqueue+0x34>
+}
+  8014c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014cd:	c9                   	leave
+  8014ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014cf:	49 89 c0             	mov    %rax,%r8
+  8014d2:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8014d7:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  8014de:	00 00 00 
+  8014e1:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e6:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  8014ed:	00 00 00 
+  8014f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f5:	49 b9 0c 29 80 00 00 	movabs $0x80290c,%r9
+  8014fc:	00 00 00 
+  8014ff:	41 ff d1             	call   *%r9
+
+0000000000801502 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801502:	55                   	push   %rbp
+  801503:	48 89 e5             	mov    %rsp,%rbp
+  801506:	53                   	push   %rbx
+  801507:	48 83 ec 08          	sub    $0x8,%rsp
+  80150b:	48 89 fa             	mov    %rdi,%rdx
+  80150e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801511:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801516:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801520:	be 00 00 00 00       	mov    $0x0,%esi
+  801525:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80152b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80152d:	48 85 c0             	test   %rax,%rax
+  801530:	7f 06                	jg     801538 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801532:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801536:	c9                   	leave
+  801537:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801538:	49 89 c0             	mov    %rax,%r8
+  80153b:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801540:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  801547:	00 00 00 
+  80154a:	be 26 00 00 00       	mov    $0x26,%esi
+  80154f:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  801556:	00 00 00 
+  801559:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155e:	49 b9 0c 29 80 00 00 	movabs $0x80290c,%r9
+  801565:	00 00 00 
+  801568:	41 ff d1             	call   *%r9
+
+000000000080156b <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80156b:	55                   	push   %rbp
+  80156c:	48 89 e5             	mov    %rsp,%rbp
+  80156f:	53                   	push   %rbx
+  801570:	48 83 ec 08          	sub    $0x8,%rsp
+  801574:	48 89 f1             	mov    %rsi,%rcx
+  801577:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80157a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80157d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801582:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801587:	be 00 00 00 00       	mov    $0x0,%esi
+  80158c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801592:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801594:	48 85 c0             	test   %rax,%rax
+  801597:	7f 06                	jg     80159f <sys_sigaction+0x34>
+}
+  801599:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159d:	c9                   	leave
+  80159e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80159f:	49 89 c0             	mov    %rax,%r8
+  8015a2:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8015a7:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  8015ae:	00 00 00 
+  8015b1:	be 26 00 00 00       	mov    $0x26,%esi
+  8015b6:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  8015bd:	00 00 00 
+  8015c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c5:	49 b9 0c 29 80 00 00 	movabs $0x80290c,%r9
+  8015cc:	00 00 00 
+  8015cf:	41 ff d1             	call   *%r9
+
+00000000008015d2 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8015d2:	55                   	push   %rbp
+  8015d3:	48 89 e5             	mov    %rsp,%rbp
+  8015d6:	53                   	push   %rbx
+  8015d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8015db:	48 89 f1             	mov    %rsi,%rcx
+  8015de:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8015e1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e4:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015fb:	48 85 c0             	test   %rax,%rax
+  8015fe:	7f 06                	jg     801606 <sys_sigprocmask+0x34>
+}
+  801600:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801604:	c9                   	leave
+  801605:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801606:	49 89 c0             	mov    %rax,%r8
+  801609:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80160e:	48 ba 90 30 80 00 00 	movabs $0x803090,%rdx
+  801615:	00 00 00 
+  801618:	be 26 00 00 00       	mov    $0x26,%esi
+  80161d:	48 bf af 30 80 00 00 	movabs $0x8030af,%rdi
+  801624:	00 00 00 
+  801627:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162c:	49 b9 0c 29 80 00 00 	movabs $0x80290c,%r9
+  801633:	00 00 00 
+  801636:	41 ff d1             	call   *%r9
+
+0000000000801639 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801639:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801640:	ff ff ff 
+  801643:	48 01 f8             	add    %rdi,%rax
+  801646:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80164a:	c3                   	ret
+
+000000000080164b <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80164b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801652:	ff ff ff 
+  801655:	48 01 f8             	add    %rdi,%rax
+  801658:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80165c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801662:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801666:	c3                   	ret
+
+0000000000801667 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801667:	55                   	push   %rbp
+  801668:	48 89 e5             	mov    %rsp,%rbp
+  80166b:	41 57                	push   %r15
+  80166d:	41 56                	push   %r14
+  80166f:	41 55                	push   %r13
+  801671:	41 54                	push   %r12
+  801673:	53                   	push   %rbx
+  801674:	48 83 ec 08          	sub    $0x8,%rsp
+  801678:	49 89 ff             	mov    %rdi,%r15
+  80167b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801680:	49 bd e5 25 80 00 00 	movabs $0x8025e5,%r13
+  801687:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80168a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801690:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801693:	48 89 df             	mov    %rbx,%rdi
+  801696:	41 ff d5             	call   *%r13
+  801699:	83 e0 04             	and    $0x4,%eax
+  80169c:	74 17                	je     8016b5 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80169e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8016a5:	4c 39 f3             	cmp    %r14,%rbx
+  8016a8:	75 e6                	jne    801690 <fd_alloc+0x29>
+  8016aa:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8016b0:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8016b5:	4d 89 27             	mov    %r12,(%r15)
+}
+  8016b8:	48 83 c4 08          	add    $0x8,%rsp
+  8016bc:	5b                   	pop    %rbx
+  8016bd:	41 5c                	pop    %r12
+  8016bf:	41 5d                	pop    %r13
+  8016c1:	41 5e                	pop    %r14
+  8016c3:	41 5f                	pop    %r15
+  8016c5:	5d                   	pop    %rbp
+  8016c6:	c3                   	ret
+
+00000000008016c7 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8016c7:	83 ff 1f             	cmp    $0x1f,%edi
+  8016ca:	77 39                	ja     801705 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8016cc:	55                   	push   %rbp
+  8016cd:	48 89 e5             	mov    %rsp,%rbp
+  8016d0:	41 54                	push   %r12
+  8016d2:	53                   	push   %rbx
+  8016d3:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8016d6:	48 63 df             	movslq %edi,%rbx
+  8016d9:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8016e0:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8016e4:	48 89 df             	mov    %rbx,%rdi
+  8016e7:	48 b8 e5 25 80 00 00 	movabs $0x8025e5,%rax
+  8016ee:	00 00 00 
+  8016f1:	ff d0                	call   *%rax
+  8016f3:	a8 04                	test   $0x4,%al
+  8016f5:	74 14                	je     80170b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8016f7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8016fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801700:	5b                   	pop    %rbx
+  801701:	41 5c                	pop    %r12
+  801703:	5d                   	pop    %rbp
+  801704:	c3                   	ret
+        return -E_INVAL;
+  801705:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80170a:	c3                   	ret
+        return -E_INVAL;
+  80170b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801710:	eb ee                	jmp    801700 <fd_lookup+0x39>
+
+0000000000801712 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801712:	55                   	push   %rbp
+  801713:	48 89 e5             	mov    %rsp,%rbp
+  801716:	41 54                	push   %r12
+  801718:	53                   	push   %rbx
+  801719:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80171c:	48 b8 40 31 80 00 00 	movabs $0x803140,%rax
+  801723:	00 00 00 
+  801726:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80172d:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801730:	39 3b                	cmp    %edi,(%rbx)
+  801732:	74 47                	je     80177b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801734:	48 83 c0 08          	add    $0x8,%rax
+  801738:	48 8b 18             	mov    (%rax),%rbx
+  80173b:	48 85 db             	test   %rbx,%rbx
+  80173e:	75 f0                	jne    801730 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801740:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801747:	00 00 00 
+  80174a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801750:	89 fa                	mov    %edi,%edx
+  801752:	48 bf c0 30 80 00 00 	movabs $0x8030c0,%rdi
+  801759:	00 00 00 
+  80175c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801761:	48 b9 c2 01 80 00 00 	movabs $0x8001c2,%rcx
+  801768:	00 00 00 
+  80176b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80176d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801772:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801776:	5b                   	pop    %rbx
+  801777:	41 5c                	pop    %r12
+  801779:	5d                   	pop    %rbp
+  80177a:	c3                   	ret
+            return 0;
+  80177b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801780:	eb f0                	jmp    801772 <dev_lookup+0x60>
+
+0000000000801782 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801782:	55                   	push   %rbp
+  801783:	48 89 e5             	mov    %rsp,%rbp
+  801786:	41 55                	push   %r13
+  801788:	41 54                	push   %r12
+  80178a:	53                   	push   %rbx
+  80178b:	48 83 ec 18          	sub    $0x18,%rsp
+  80178f:	48 89 fb             	mov    %rdi,%rbx
+  801792:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801795:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80179c:	ff ff ff 
+  80179f:	48 01 df             	add    %rbx,%rdi
+  8017a2:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8017a6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8017aa:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  8017b1:	00 00 00 
+  8017b4:	ff d0                	call   *%rax
+  8017b6:	41 89 c5             	mov    %eax,%r13d
+  8017b9:	85 c0                	test   %eax,%eax
+  8017bb:	78 06                	js     8017c3 <fd_close+0x41>
+  8017bd:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8017c1:	74 1a                	je     8017dd <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8017c3:	45 84 e4             	test   %r12b,%r12b
+  8017c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017cb:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8017cf:	44 89 e8             	mov    %r13d,%eax
+  8017d2:	48 83 c4 18          	add    $0x18,%rsp
+  8017d6:	5b                   	pop    %rbx
+  8017d7:	41 5c                	pop    %r12
+  8017d9:	41 5d                	pop    %r13
+  8017db:	5d                   	pop    %rbp
+  8017dc:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017dd:	8b 3b                	mov    (%rbx),%edi
+  8017df:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8017e3:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  8017ea:	00 00 00 
+  8017ed:	ff d0                	call   *%rax
+  8017ef:	41 89 c5             	mov    %eax,%r13d
+  8017f2:	85 c0                	test   %eax,%eax
+  8017f4:	78 1b                	js     801811 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8017f6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8017fa:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8017fe:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801804:	48 85 c0             	test   %rax,%rax
+  801807:	74 08                	je     801811 <fd_close+0x8f>
+  801809:	48 89 df             	mov    %rbx,%rdi
+  80180c:	ff d0                	call   *%rax
+  80180e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801811:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801816:	48 89 de             	mov    %rbx,%rsi
+  801819:	bf 00 00 00 00       	mov    $0x0,%edi
+  80181e:	48 b8 63 11 80 00 00 	movabs $0x801163,%rax
+  801825:	00 00 00 
+  801828:	ff d0                	call   *%rax
+    return res;
+  80182a:	eb a3                	jmp    8017cf <fd_close+0x4d>
+
+000000000080182c <close>:
+
+int
+close(int fdnum) {
+  80182c:	55                   	push   %rbp
+  80182d:	48 89 e5             	mov    %rsp,%rbp
+  801830:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801834:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801838:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  80183f:	00 00 00 
+  801842:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801844:	85 c0                	test   %eax,%eax
+  801846:	78 15                	js     80185d <close+0x31>
+
+    return fd_close(fd, 1);
+  801848:	be 01 00 00 00       	mov    $0x1,%esi
+  80184d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801851:	48 b8 82 17 80 00 00 	movabs $0x801782,%rax
+  801858:	00 00 00 
+  80185b:	ff d0                	call   *%rax
+}
+  80185d:	c9                   	leave
+  80185e:	c3                   	ret
+
+000000000080185f <close_all>:
+
+void
+close_all(void) {
+  80185f:	55                   	push   %rbp
+  801860:	48 89 e5             	mov    %rsp,%rbp
+  801863:	41 54                	push   %r12
+  801865:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801866:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80186b:	49 bc 2c 18 80 00 00 	movabs $0x80182c,%r12
+  801872:	00 00 00 
+  801875:	89 df                	mov    %ebx,%edi
+  801877:	41 ff d4             	call   *%r12
+  80187a:	83 c3 01             	add    $0x1,%ebx
+  80187d:	83 fb 20             	cmp    $0x20,%ebx
+  801880:	75 f3                	jne    801875 <close_all+0x16>
+}
+  801882:	5b                   	pop    %rbx
+  801883:	41 5c                	pop    %r12
+  801885:	5d                   	pop    %rbp
+  801886:	c3                   	ret
+
+0000000000801887 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801887:	55                   	push   %rbp
+  801888:	48 89 e5             	mov    %rsp,%rbp
+  80188b:	41 57                	push   %r15
+  80188d:	41 56                	push   %r14
+  80188f:	41 55                	push   %r13
+  801891:	41 54                	push   %r12
+  801893:	53                   	push   %rbx
+  801894:	48 83 ec 18          	sub    $0x18,%rsp
+  801898:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80189b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80189f:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  8018a6:	00 00 00 
+  8018a9:	ff d0                	call   *%rax
+  8018ab:	89 c3                	mov    %eax,%ebx
+  8018ad:	85 c0                	test   %eax,%eax
+  8018af:	0f 88 b8 00 00 00    	js     80196d <dup+0xe6>
+    close(newfdnum);
+  8018b5:	44 89 e7             	mov    %r12d,%edi
+  8018b8:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  8018bf:	00 00 00 
+  8018c2:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8018c4:	4d 63 ec             	movslq %r12d,%r13
+  8018c7:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8018ce:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8018d2:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8018d6:	4c 89 ff             	mov    %r15,%rdi
+  8018d9:	49 be 4b 16 80 00 00 	movabs $0x80164b,%r14
+  8018e0:	00 00 00 
+  8018e3:	41 ff d6             	call   *%r14
+  8018e6:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8018e9:	4c 89 ef             	mov    %r13,%rdi
+  8018ec:	41 ff d6             	call   *%r14
+  8018ef:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8018f2:	48 89 df             	mov    %rbx,%rdi
+  8018f5:	48 b8 e5 25 80 00 00 	movabs $0x8025e5,%rax
+  8018fc:	00 00 00 
+  8018ff:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801901:	a8 04                	test   $0x4,%al
+  801903:	74 2b                	je     801930 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801905:	41 89 c1             	mov    %eax,%r9d
+  801908:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80190e:	4c 89 f1             	mov    %r14,%rcx
+  801911:	ba 00 00 00 00       	mov    $0x0,%edx
+  801916:	48 89 de             	mov    %rbx,%rsi
+  801919:	bf 00 00 00 00       	mov    $0x0,%edi
+  80191e:	48 b8 fe 10 80 00 00 	movabs $0x8010fe,%rax
+  801925:	00 00 00 
+  801928:	ff d0                	call   *%rax
+  80192a:	89 c3                	mov    %eax,%ebx
+  80192c:	85 c0                	test   %eax,%eax
+  80192e:	78 4e                	js     80197e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801930:	4c 89 ff             	mov    %r15,%rdi
+  801933:	48 b8 e5 25 80 00 00 	movabs $0x8025e5,%rax
+  80193a:	00 00 00 
+  80193d:	ff d0                	call   *%rax
+  80193f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801942:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801948:	4c 89 e9             	mov    %r13,%rcx
+  80194b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801950:	4c 89 fe             	mov    %r15,%rsi
+  801953:	bf 00 00 00 00       	mov    $0x0,%edi
+  801958:	48 b8 fe 10 80 00 00 	movabs $0x8010fe,%rax
+  80195f:	00 00 00 
+  801962:	ff d0                	call   *%rax
+  801964:	89 c3                	mov    %eax,%ebx
+  801966:	85 c0                	test   %eax,%eax
+  801968:	78 14                	js     80197e <dup+0xf7>
+
+    return newfdnum;
+  80196a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80196d:	89 d8                	mov    %ebx,%eax
+  80196f:	48 83 c4 18          	add    $0x18,%rsp
+  801973:	5b                   	pop    %rbx
+  801974:	41 5c                	pop    %r12
+  801976:	41 5d                	pop    %r13
+  801978:	41 5e                	pop    %r14
+  80197a:	41 5f                	pop    %r15
+  80197c:	5d                   	pop    %rbp
+  80197d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80197e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801983:	4c 89 ee             	mov    %r13,%rsi
+  801986:	bf 00 00 00 00       	mov    $0x0,%edi
+  80198b:	49 bc 63 11 80 00 00 	movabs $0x801163,%r12
+  801992:	00 00 00 
+  801995:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801998:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80199d:	4c 89 f6             	mov    %r14,%rsi
+  8019a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019a5:	41 ff d4             	call   *%r12
+    return res;
+  8019a8:	eb c3                	jmp    80196d <dup+0xe6>
+
+00000000008019aa <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8019aa:	55                   	push   %rbp
+  8019ab:	48 89 e5             	mov    %rsp,%rbp
+  8019ae:	41 56                	push   %r14
+  8019b0:	41 55                	push   %r13
+  8019b2:	41 54                	push   %r12
+  8019b4:	53                   	push   %rbx
+  8019b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8019b9:	89 fb                	mov    %edi,%ebx
+  8019bb:	49 89 f4             	mov    %rsi,%r12
+  8019be:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019c1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019c5:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  8019cc:	00 00 00 
+  8019cf:	ff d0                	call   *%rax
+  8019d1:	85 c0                	test   %eax,%eax
+  8019d3:	78 4c                	js     801a21 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019d5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019d9:	41 8b 3e             	mov    (%r14),%edi
+  8019dc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019e0:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  8019e7:	00 00 00 
+  8019ea:	ff d0                	call   *%rax
+  8019ec:	85 c0                	test   %eax,%eax
+  8019ee:	78 35                	js     801a25 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019f0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019f4:	83 e0 03             	and    $0x3,%eax
+  8019f7:	83 f8 01             	cmp    $0x1,%eax
+  8019fa:	74 2d                	je     801a29 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8019fc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a00:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801a04:	48 85 c0             	test   %rax,%rax
+  801a07:	74 56                	je     801a5f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801a09:	4c 89 ea             	mov    %r13,%rdx
+  801a0c:	4c 89 e6             	mov    %r12,%rsi
+  801a0f:	4c 89 f7             	mov    %r14,%rdi
+  801a12:	ff d0                	call   *%rax
+}
+  801a14:	48 83 c4 10          	add    $0x10,%rsp
+  801a18:	5b                   	pop    %rbx
+  801a19:	41 5c                	pop    %r12
+  801a1b:	41 5d                	pop    %r13
+  801a1d:	41 5e                	pop    %r14
+  801a1f:	5d                   	pop    %rbp
+  801a20:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a21:	48 98                	cltq
+  801a23:	eb ef                	jmp    801a14 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a25:	48 98                	cltq
+  801a27:	eb eb                	jmp    801a14 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a29:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a30:	00 00 00 
+  801a33:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a39:	89 da                	mov    %ebx,%edx
+  801a3b:	48 bf 01 31 80 00 00 	movabs $0x803101,%rdi
+  801a42:	00 00 00 
+  801a45:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a4a:	48 b9 c2 01 80 00 00 	movabs $0x8001c2,%rcx
+  801a51:	00 00 00 
+  801a54:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a56:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a5d:	eb b5                	jmp    801a14 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a5f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a66:	eb ac                	jmp    801a14 <read+0x6a>
+
+0000000000801a68 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a68:	55                   	push   %rbp
+  801a69:	48 89 e5             	mov    %rsp,%rbp
+  801a6c:	41 57                	push   %r15
+  801a6e:	41 56                	push   %r14
+  801a70:	41 55                	push   %r13
+  801a72:	41 54                	push   %r12
+  801a74:	53                   	push   %rbx
+  801a75:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a79:	48 85 d2             	test   %rdx,%rdx
+  801a7c:	74 54                	je     801ad2 <readn+0x6a>
+  801a7e:	41 89 fd             	mov    %edi,%r13d
+  801a81:	49 89 f6             	mov    %rsi,%r14
+  801a84:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801a87:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801a8c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801a91:	49 bf aa 19 80 00 00 	movabs $0x8019aa,%r15
+  801a98:	00 00 00 
+  801a9b:	4c 89 e2             	mov    %r12,%rdx
+  801a9e:	48 29 f2             	sub    %rsi,%rdx
+  801aa1:	4c 01 f6             	add    %r14,%rsi
+  801aa4:	44 89 ef             	mov    %r13d,%edi
+  801aa7:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801aaa:	85 c0                	test   %eax,%eax
+  801aac:	78 20                	js     801ace <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801aae:	01 c3                	add    %eax,%ebx
+  801ab0:	85 c0                	test   %eax,%eax
+  801ab2:	74 08                	je     801abc <readn+0x54>
+  801ab4:	48 63 f3             	movslq %ebx,%rsi
+  801ab7:	4c 39 e6             	cmp    %r12,%rsi
+  801aba:	72 df                	jb     801a9b <readn+0x33>
+    }
+    return res;
+  801abc:	48 63 c3             	movslq %ebx,%rax
+}
+  801abf:	48 83 c4 08          	add    $0x8,%rsp
+  801ac3:	5b                   	pop    %rbx
+  801ac4:	41 5c                	pop    %r12
+  801ac6:	41 5d                	pop    %r13
+  801ac8:	41 5e                	pop    %r14
+  801aca:	41 5f                	pop    %r15
+  801acc:	5d                   	pop    %rbp
+  801acd:	c3                   	ret
+        if (inc < 0) return inc;
+  801ace:	48 98                	cltq
+  801ad0:	eb ed                	jmp    801abf <readn+0x57>
+    int inc = 1, res = 0;
+  801ad2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad7:	eb e3                	jmp    801abc <readn+0x54>
+
+0000000000801ad9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ad9:	55                   	push   %rbp
+  801ada:	48 89 e5             	mov    %rsp,%rbp
+  801add:	41 56                	push   %r14
+  801adf:	41 55                	push   %r13
+  801ae1:	41 54                	push   %r12
+  801ae3:	53                   	push   %rbx
+  801ae4:	48 83 ec 10          	sub    $0x10,%rsp
+  801ae8:	89 fb                	mov    %edi,%ebx
+  801aea:	49 89 f4             	mov    %rsi,%r12
+  801aed:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801af0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801af4:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  801afb:	00 00 00 
+  801afe:	ff d0                	call   *%rax
+  801b00:	85 c0                	test   %eax,%eax
+  801b02:	78 47                	js     801b4b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b04:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b08:	41 8b 3e             	mov    (%r14),%edi
+  801b0b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b0f:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  801b16:	00 00 00 
+  801b19:	ff d0                	call   *%rax
+  801b1b:	85 c0                	test   %eax,%eax
+  801b1d:	78 30                	js     801b4f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b1f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b24:	74 2d                	je     801b53 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b26:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b2a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b2e:	48 85 c0             	test   %rax,%rax
+  801b31:	74 56                	je     801b89 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b33:	4c 89 ea             	mov    %r13,%rdx
+  801b36:	4c 89 e6             	mov    %r12,%rsi
+  801b39:	4c 89 f7             	mov    %r14,%rdi
+  801b3c:	ff d0                	call   *%rax
+}
+  801b3e:	48 83 c4 10          	add    $0x10,%rsp
+  801b42:	5b                   	pop    %rbx
+  801b43:	41 5c                	pop    %r12
+  801b45:	41 5d                	pop    %r13
+  801b47:	41 5e                	pop    %r14
+  801b49:	5d                   	pop    %rbp
+  801b4a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b4b:	48 98                	cltq
+  801b4d:	eb ef                	jmp    801b3e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b4f:	48 98                	cltq
+  801b51:	eb eb                	jmp    801b3e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b53:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b5a:	00 00 00 
+  801b5d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b63:	89 da                	mov    %ebx,%edx
+  801b65:	48 bf 1d 31 80 00 00 	movabs $0x80311d,%rdi
+  801b6c:	00 00 00 
+  801b6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b74:	48 b9 c2 01 80 00 00 	movabs $0x8001c2,%rcx
+  801b7b:	00 00 00 
+  801b7e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b80:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b87:	eb b5                	jmp    801b3e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b89:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b90:	eb ac                	jmp    801b3e <write+0x65>
+
+0000000000801b92 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801b92:	55                   	push   %rbp
+  801b93:	48 89 e5             	mov    %rsp,%rbp
+  801b96:	53                   	push   %rbx
+  801b97:	48 83 ec 18          	sub    $0x18,%rsp
+  801b9b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b9d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ba1:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  801ba8:	00 00 00 
+  801bab:	ff d0                	call   *%rax
+  801bad:	85 c0                	test   %eax,%eax
+  801baf:	78 0c                	js     801bbd <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801bb1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bb5:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bbd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bc1:	c9                   	leave
+  801bc2:	c3                   	ret
+
+0000000000801bc3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801bc3:	55                   	push   %rbp
+  801bc4:	48 89 e5             	mov    %rsp,%rbp
+  801bc7:	41 55                	push   %r13
+  801bc9:	41 54                	push   %r12
+  801bcb:	53                   	push   %rbx
+  801bcc:	48 83 ec 18          	sub    $0x18,%rsp
+  801bd0:	89 fb                	mov    %edi,%ebx
+  801bd2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bd5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bd9:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  801be0:	00 00 00 
+  801be3:	ff d0                	call   *%rax
+  801be5:	85 c0                	test   %eax,%eax
+  801be7:	78 38                	js     801c21 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801be9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801bed:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801bf1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bf5:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  801bfc:	00 00 00 
+  801bff:	ff d0                	call   *%rax
+  801c01:	85 c0                	test   %eax,%eax
+  801c03:	78 1c                	js     801c21 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c05:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c0a:	74 20                	je     801c2c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c0c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c10:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801c14:	48 85 c0             	test   %rax,%rax
+  801c17:	74 47                	je     801c60 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c19:	44 89 e6             	mov    %r12d,%esi
+  801c1c:	4c 89 ef             	mov    %r13,%rdi
+  801c1f:	ff d0                	call   *%rax
+}
+  801c21:	48 83 c4 18          	add    $0x18,%rsp
+  801c25:	5b                   	pop    %rbx
+  801c26:	41 5c                	pop    %r12
+  801c28:	41 5d                	pop    %r13
+  801c2a:	5d                   	pop    %rbp
+  801c2b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c2c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c33:	00 00 00 
+  801c36:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c3c:	89 da                	mov    %ebx,%edx
+  801c3e:	48 bf e0 30 80 00 00 	movabs $0x8030e0,%rdi
+  801c45:	00 00 00 
+  801c48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c4d:	48 b9 c2 01 80 00 00 	movabs $0x8001c2,%rcx
+  801c54:	00 00 00 
+  801c57:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c59:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c5e:	eb c1                	jmp    801c21 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c60:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c65:	eb ba                	jmp    801c21 <ftruncate+0x5e>
+
+0000000000801c67 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801c67:	55                   	push   %rbp
+  801c68:	48 89 e5             	mov    %rsp,%rbp
+  801c6b:	41 54                	push   %r12
+  801c6d:	53                   	push   %rbx
+  801c6e:	48 83 ec 10          	sub    $0x10,%rsp
+  801c72:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c75:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c79:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  801c80:	00 00 00 
+  801c83:	ff d0                	call   *%rax
+  801c85:	85 c0                	test   %eax,%eax
+  801c87:	78 4e                	js     801cd7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c89:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c8d:	41 8b 3c 24          	mov    (%r12),%edi
+  801c91:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c95:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  801c9c:	00 00 00 
+  801c9f:	ff d0                	call   *%rax
+  801ca1:	85 c0                	test   %eax,%eax
+  801ca3:	78 32                	js     801cd7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ca5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ca9:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801cae:	74 30                	je     801ce0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801cb0:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801cb3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801cba:	00 00 00 
+    stat->st_isdir = 0;
+  801cbd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801cc4:	00 00 00 
+    stat->st_dev = dev;
+  801cc7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801cce:	48 89 de             	mov    %rbx,%rsi
+  801cd1:	4c 89 e7             	mov    %r12,%rdi
+  801cd4:	ff 50 28             	call   *0x28(%rax)
+}
+  801cd7:	48 83 c4 10          	add    $0x10,%rsp
+  801cdb:	5b                   	pop    %rbx
+  801cdc:	41 5c                	pop    %r12
+  801cde:	5d                   	pop    %rbp
+  801cdf:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ce0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ce5:	eb f0                	jmp    801cd7 <fstat+0x70>
+
+0000000000801ce7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801ce7:	55                   	push   %rbp
+  801ce8:	48 89 e5             	mov    %rsp,%rbp
+  801ceb:	41 54                	push   %r12
+  801ced:	53                   	push   %rbx
+  801cee:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801cf1:	be 00 00 00 00       	mov    $0x0,%esi
+  801cf6:	48 b8 68 1f 80 00 00 	movabs $0x801f68,%rax
+  801cfd:	00 00 00 
+  801d00:	ff d0                	call   *%rax
+  801d02:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d04:	85 c0                	test   %eax,%eax
+  801d06:	78 25                	js     801d2d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d08:	4c 89 e6             	mov    %r12,%rsi
+  801d0b:	89 c7                	mov    %eax,%edi
+  801d0d:	48 b8 67 1c 80 00 00 	movabs $0x801c67,%rax
+  801d14:	00 00 00 
+  801d17:	ff d0                	call   *%rax
+  801d19:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d1c:	89 df                	mov    %ebx,%edi
+  801d1e:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  801d25:	00 00 00 
+  801d28:	ff d0                	call   *%rax
+
+    return res;
+  801d2a:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d2d:	89 d8                	mov    %ebx,%eax
+  801d2f:	5b                   	pop    %rbx
+  801d30:	41 5c                	pop    %r12
+  801d32:	5d                   	pop    %rbp
+  801d33:	c3                   	ret
+
+0000000000801d34 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801d34:	55                   	push   %rbp
+  801d35:	48 89 e5             	mov    %rsp,%rbp
+  801d38:	41 54                	push   %r12
+  801d3a:	53                   	push   %rbx
+  801d3b:	48 83 ec 10          	sub    $0x10,%rsp
+  801d3f:	41 89 fc             	mov    %edi,%r12d
+  801d42:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d45:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801d4c:	00 00 00 
+  801d4f:	83 38 00             	cmpl   $0x0,(%rax)
+  801d52:	74 5e                	je     801db2 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801d54:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801d5a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d5f:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801d66:	00 00 00 
+  801d69:	44 89 e6             	mov    %r12d,%esi
+  801d6c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801d73:	00 00 00 
+  801d76:	8b 38                	mov    (%rax),%edi
+  801d78:	48 b8 44 2a 80 00 00 	movabs $0x802a44,%rax
+  801d7f:	00 00 00 
+  801d82:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801d84:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801d8b:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801d8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d91:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801d95:	48 89 de             	mov    %rbx,%rsi
+  801d98:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d9d:	48 b8 af 29 80 00 00 	movabs $0x8029af,%rax
+  801da4:	00 00 00 
+  801da7:	ff d0                	call   *%rax
+}
+  801da9:	48 83 c4 10          	add    $0x10,%rsp
+  801dad:	5b                   	pop    %rbx
+  801dae:	41 5c                	pop    %r12
+  801db0:	5d                   	pop    %rbp
+  801db1:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801db2:	bf 03 00 00 00       	mov    $0x3,%edi
+  801db7:	48 b8 e4 2a 80 00 00 	movabs $0x802ae4,%rax
+  801dbe:	00 00 00 
+  801dc1:	ff d0                	call   *%rax
+  801dc3:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801dca:	00 00 
+  801dcc:	eb 86                	jmp    801d54 <fsipc+0x20>
+
+0000000000801dce <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801dce:	55                   	push   %rbp
+  801dcf:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801dd2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801dd9:	00 00 00 
+  801ddc:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801ddf:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801de1:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801de4:	be 00 00 00 00       	mov    $0x0,%esi
+  801de9:	bf 02 00 00 00       	mov    $0x2,%edi
+  801dee:	48 b8 34 1d 80 00 00 	movabs $0x801d34,%rax
+  801df5:	00 00 00 
+  801df8:	ff d0                	call   *%rax
+}
+  801dfa:	5d                   	pop    %rbp
+  801dfb:	c3                   	ret
+
+0000000000801dfc <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801dfc:	55                   	push   %rbp
+  801dfd:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e00:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801e03:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801e0a:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801e0c:	be 00 00 00 00       	mov    $0x0,%esi
+  801e11:	bf 06 00 00 00       	mov    $0x6,%edi
+  801e16:	48 b8 34 1d 80 00 00 	movabs $0x801d34,%rax
+  801e1d:	00 00 00 
+  801e20:	ff d0                	call   *%rax
+}
+  801e22:	5d                   	pop    %rbp
+  801e23:	c3                   	ret
+
+0000000000801e24 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801e24:	55                   	push   %rbp
+  801e25:	48 89 e5             	mov    %rsp,%rbp
+  801e28:	41 54                	push   %r12
+  801e2a:	53                   	push   %rbx
+  801e2b:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e2e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801e31:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801e38:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801e3a:	be 00 00 00 00       	mov    $0x0,%esi
+  801e3f:	bf 05 00 00 00       	mov    $0x5,%edi
+  801e44:	48 b8 34 1d 80 00 00 	movabs $0x801d34,%rax
+  801e4b:	00 00 00 
+  801e4e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e50:	85 c0                	test   %eax,%eax
+  801e52:	78 3d                	js     801e91 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e54:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801e5b:	00 00 00 
+  801e5e:	4c 89 e6             	mov    %r12,%rsi
+  801e61:	48 89 df             	mov    %rbx,%rdi
+  801e64:	48 b8 e7 0a 80 00 00 	movabs $0x800ae7,%rax
+  801e6b:	00 00 00 
+  801e6e:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801e70:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801e77:	00 
+  801e78:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e7e:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801e85:	00 
+  801e86:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e91:	5b                   	pop    %rbx
+  801e92:	41 5c                	pop    %r12
+  801e94:	5d                   	pop    %rbp
+  801e95:	c3                   	ret
+
+0000000000801e96 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801e96:	55                   	push   %rbp
+  801e97:	48 89 e5             	mov    %rsp,%rbp
+  801e9a:	41 54                	push   %r12
+  801e9c:	53                   	push   %rbx
+  801e9d:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  801ea0:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  801ea5:	48 39 c2             	cmp    %rax,%rdx
+  801ea8:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801eac:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801eaf:	48 89 c2             	mov    %rax,%rdx
+  801eb2:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801eb9:	00 00 00 
+  801ebc:	48 b8 48 0d 80 00 00 	movabs $0x800d48,%rax
+  801ec3:	00 00 00 
+  801ec6:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ec8:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801ecf:	00 00 00 
+  801ed2:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  801ed7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  801ed9:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  801edd:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee2:	bf 04 00 00 00       	mov    $0x4,%edi
+  801ee7:	48 b8 34 1d 80 00 00 	movabs $0x801d34,%rax
+  801eee:	00 00 00 
+  801ef1:	ff d0                	call   *%rax
+  801ef3:	48 98                	cltq
+}
+  801ef5:	5b                   	pop    %rbx
+  801ef6:	41 5c                	pop    %r12
+  801ef8:	5d                   	pop    %rbp
+  801ef9:	c3                   	ret
+
+0000000000801efa <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801efa:	55                   	push   %rbp
+  801efb:	48 89 e5             	mov    %rsp,%rbp
+  801efe:	41 54                	push   %r12
+  801f00:	53                   	push   %rbx
+  801f01:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f04:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801f0b:	00 00 00 
+  801f0e:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801f11:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  801f13:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801f18:	48 39 ca             	cmp    %rcx,%rdx
+  801f1b:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  801f1f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  801f23:	be 00 00 00 00       	mov    $0x0,%esi
+  801f28:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f2d:	48 b8 34 1d 80 00 00 	movabs $0x801d34,%rax
+  801f34:	00 00 00 
+  801f37:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  801f39:	85 c0                	test   %eax,%eax
+  801f3b:	78 27                	js     801f64 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  801f3d:	48 63 d8             	movslq %eax,%rbx
+  801f40:	48 89 da             	mov    %rbx,%rdx
+  801f43:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801f4a:	00 00 00 
+  801f4d:	4c 89 e7             	mov    %r12,%rdi
+  801f50:	48 b8 48 0d 80 00 00 	movabs $0x800d48,%rax
+  801f57:	00 00 00 
+  801f5a:	ff d0                	call   *%rax
+    return bytes_read;
+  801f5c:	48 89 d8             	mov    %rbx,%rax
+}
+  801f5f:	5b                   	pop    %rbx
+  801f60:	41 5c                	pop    %r12
+  801f62:	5d                   	pop    %rbp
+  801f63:	c3                   	ret
+        return bytes_read;
+  801f64:	48 98                	cltq
+  801f66:	eb f7                	jmp    801f5f <devfile_read+0x65>
+
+0000000000801f68 <open>:
+open(const char *path, int mode) {
+  801f68:	55                   	push   %rbp
+  801f69:	48 89 e5             	mov    %rsp,%rbp
+  801f6c:	41 55                	push   %r13
+  801f6e:	41 54                	push   %r12
+  801f70:	53                   	push   %rbx
+  801f71:	48 83 ec 18          	sub    $0x18,%rsp
+  801f75:	49 89 fc             	mov    %rdi,%r12
+  801f78:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801f7b:	48 b8 a9 0a 80 00 00 	movabs $0x800aa9,%rax
+  801f82:	00 00 00 
+  801f85:	ff d0                	call   *%rax
+  801f87:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801f8d:	0f 87 8a 00 00 00    	ja     80201d <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801f93:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801f97:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  801f9e:	00 00 00 
+  801fa1:	ff d0                	call   *%rax
+  801fa3:	89 c3                	mov    %eax,%ebx
+  801fa5:	85 c0                	test   %eax,%eax
+  801fa7:	78 50                	js     801ff9 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801fa9:	4c 89 e6             	mov    %r12,%rsi
+  801fac:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801fb3:	00 00 00 
+  801fb6:	48 89 df             	mov    %rbx,%rdi
+  801fb9:	48 b8 e7 0a 80 00 00 	movabs $0x800ae7,%rax
+  801fc0:	00 00 00 
+  801fc3:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801fc5:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801fcc:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801fd0:	bf 01 00 00 00       	mov    $0x1,%edi
+  801fd5:	48 b8 34 1d 80 00 00 	movabs $0x801d34,%rax
+  801fdc:	00 00 00 
+  801fdf:	ff d0                	call   *%rax
+  801fe1:	89 c3                	mov    %eax,%ebx
+  801fe3:	85 c0                	test   %eax,%eax
+  801fe5:	78 1f                	js     802006 <open+0x9e>
+    return fd2num(fd);
+  801fe7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801feb:	48 b8 39 16 80 00 00 	movabs $0x801639,%rax
+  801ff2:	00 00 00 
+  801ff5:	ff d0                	call   *%rax
+  801ff7:	89 c3                	mov    %eax,%ebx
+}
+  801ff9:	89 d8                	mov    %ebx,%eax
+  801ffb:	48 83 c4 18          	add    $0x18,%rsp
+  801fff:	5b                   	pop    %rbx
+  802000:	41 5c                	pop    %r12
+  802002:	41 5d                	pop    %r13
+  802004:	5d                   	pop    %rbp
+  802005:	c3                   	ret
+        fd_close(fd, 0);
+  802006:	be 00 00 00 00       	mov    $0x0,%esi
+  80200b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80200f:	48 b8 82 17 80 00 00 	movabs $0x801782,%rax
+  802016:	00 00 00 
+  802019:	ff d0                	call   *%rax
+        return res;
+  80201b:	eb dc                	jmp    801ff9 <open+0x91>
+        return -E_BAD_PATH;
+  80201d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802022:	eb d5                	jmp    801ff9 <open+0x91>
+
+0000000000802024 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802024:	55                   	push   %rbp
+  802025:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802028:	be 00 00 00 00       	mov    $0x0,%esi
+  80202d:	bf 08 00 00 00       	mov    $0x8,%edi
+  802032:	48 b8 34 1d 80 00 00 	movabs $0x801d34,%rax
+  802039:	00 00 00 
+  80203c:	ff d0                	call   *%rax
+}
+  80203e:	5d                   	pop    %rbp
+  80203f:	c3                   	ret
+
+0000000000802040 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802040:	55                   	push   %rbp
+  802041:	48 89 e5             	mov    %rsp,%rbp
+  802044:	41 54                	push   %r12
+  802046:	53                   	push   %rbx
+  802047:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80204a:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  802051:	00 00 00 
+  802054:	ff d0                	call   *%rax
+  802056:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802059:	48 be 60 31 80 00 00 	movabs $0x803160,%rsi
+  802060:	00 00 00 
+  802063:	48 89 df             	mov    %rbx,%rdi
+  802066:	48 b8 e7 0a 80 00 00 	movabs $0x800ae7,%rax
+  80206d:	00 00 00 
+  802070:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802072:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802077:	41 2b 04 24          	sub    (%r12),%eax
+  80207b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802081:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802088:	00 00 00 
+    stat->st_dev = &devpipe;
+  80208b:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802092:	00 00 00 
+  802095:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80209c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a1:	5b                   	pop    %rbx
+  8020a2:	41 5c                	pop    %r12
+  8020a4:	5d                   	pop    %rbp
+  8020a5:	c3                   	ret
+
+00000000008020a6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8020a6:	55                   	push   %rbp
+  8020a7:	48 89 e5             	mov    %rsp,%rbp
+  8020aa:	41 54                	push   %r12
+  8020ac:	53                   	push   %rbx
+  8020ad:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8020b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020b5:	48 89 fe             	mov    %rdi,%rsi
+  8020b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020bd:	49 bc 63 11 80 00 00 	movabs $0x801163,%r12
+  8020c4:	00 00 00 
+  8020c7:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8020ca:	48 89 df             	mov    %rbx,%rdi
+  8020cd:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  8020d4:	00 00 00 
+  8020d7:	ff d0                	call   *%rax
+  8020d9:	48 89 c6             	mov    %rax,%rsi
+  8020dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020e6:	41 ff d4             	call   *%r12
+}
+  8020e9:	5b                   	pop    %rbx
+  8020ea:	41 5c                	pop    %r12
+  8020ec:	5d                   	pop    %rbp
+  8020ed:	c3                   	ret
+
+00000000008020ee <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8020ee:	55                   	push   %rbp
+  8020ef:	48 89 e5             	mov    %rsp,%rbp
+  8020f2:	41 57                	push   %r15
+  8020f4:	41 56                	push   %r14
+  8020f6:	41 55                	push   %r13
+  8020f8:	41 54                	push   %r12
+  8020fa:	53                   	push   %rbx
+  8020fb:	48 83 ec 18          	sub    $0x18,%rsp
+  8020ff:	49 89 fc             	mov    %rdi,%r12
+  802102:	49 89 f5             	mov    %rsi,%r13
+  802105:	49 89 d7             	mov    %rdx,%r15
+  802108:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80210c:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  802113:	00 00 00 
+  802116:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802118:	4d 85 ff             	test   %r15,%r15
+  80211b:	0f 84 af 00 00 00    	je     8021d0 <devpipe_write+0xe2>
+  802121:	48 89 c3             	mov    %rax,%rbx
+  802124:	4c 89 f8             	mov    %r15,%rax
+  802127:	4d 89 ef             	mov    %r13,%r15
+  80212a:	4c 01 e8             	add    %r13,%rax
+  80212d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802131:	49 bd 6b 10 80 00 00 	movabs $0x80106b,%r13
+  802138:	00 00 00 
+            sys_yield();
+  80213b:	49 be 08 10 80 00 00 	movabs $0x801008,%r14
+  802142:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802145:	8b 73 04             	mov    0x4(%rbx),%esi
+  802148:	48 63 ce             	movslq %esi,%rcx
+  80214b:	48 63 03             	movslq (%rbx),%rax
+  80214e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802154:	48 39 c1             	cmp    %rax,%rcx
+  802157:	72 2e                	jb     802187 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802159:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80215e:	48 89 da             	mov    %rbx,%rdx
+  802161:	be 00 10 00 00       	mov    $0x1000,%esi
+  802166:	4c 89 e7             	mov    %r12,%rdi
+  802169:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80216c:	85 c0                	test   %eax,%eax
+  80216e:	74 66                	je     8021d6 <devpipe_write+0xe8>
+            sys_yield();
+  802170:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802173:	8b 73 04             	mov    0x4(%rbx),%esi
+  802176:	48 63 ce             	movslq %esi,%rcx
+  802179:	48 63 03             	movslq (%rbx),%rax
+  80217c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802182:	48 39 c1             	cmp    %rax,%rcx
+  802185:	73 d2                	jae    802159 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802187:	41 0f b6 3f          	movzbl (%r15),%edi
+  80218b:	48 89 ca             	mov    %rcx,%rdx
+  80218e:	48 c1 ea 03          	shr    $0x3,%rdx
+  802192:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802199:	08 10 20 
+  80219c:	48 f7 e2             	mul    %rdx
+  80219f:	48 c1 ea 06          	shr    $0x6,%rdx
+  8021a3:	48 89 d0             	mov    %rdx,%rax
+  8021a6:	48 c1 e0 09          	shl    $0x9,%rax
+  8021aa:	48 29 d0             	sub    %rdx,%rax
+  8021ad:	48 c1 e0 03          	shl    $0x3,%rax
+  8021b1:	48 29 c1             	sub    %rax,%rcx
+  8021b4:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8021b9:	83 c6 01             	add    $0x1,%esi
+  8021bc:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8021bf:	49 83 c7 01          	add    $0x1,%r15
+  8021c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021c7:	49 39 c7             	cmp    %rax,%r15
+  8021ca:	0f 85 75 ff ff ff    	jne    802145 <devpipe_write+0x57>
+    return n;
+  8021d0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021d4:	eb 05                	jmp    8021db <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8021d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021db:	48 83 c4 18          	add    $0x18,%rsp
+  8021df:	5b                   	pop    %rbx
+  8021e0:	41 5c                	pop    %r12
+  8021e2:	41 5d                	pop    %r13
+  8021e4:	41 5e                	pop    %r14
+  8021e6:	41 5f                	pop    %r15
+  8021e8:	5d                   	pop    %rbp
+  8021e9:	c3                   	ret
+
+00000000008021ea <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8021ea:	55                   	push   %rbp
+  8021eb:	48 89 e5             	mov    %rsp,%rbp
+  8021ee:	41 57                	push   %r15
+  8021f0:	41 56                	push   %r14
+  8021f2:	41 55                	push   %r13
+  8021f4:	41 54                	push   %r12
+  8021f6:	53                   	push   %rbx
+  8021f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8021fb:	49 89 fc             	mov    %rdi,%r12
+  8021fe:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802202:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802206:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  80220d:	00 00 00 
+  802210:	ff d0                	call   *%rax
+  802212:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802215:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80221b:	49 bd 6b 10 80 00 00 	movabs $0x80106b,%r13
+  802222:	00 00 00 
+            sys_yield();
+  802225:	49 be 08 10 80 00 00 	movabs $0x801008,%r14
+  80222c:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80222f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802234:	74 7d                	je     8022b3 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802236:	8b 03                	mov    (%rbx),%eax
+  802238:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80223b:	75 26                	jne    802263 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80223d:	4d 85 ff             	test   %r15,%r15
+  802240:	75 77                	jne    8022b9 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802242:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802247:	48 89 da             	mov    %rbx,%rdx
+  80224a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80224f:	4c 89 e7             	mov    %r12,%rdi
+  802252:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802255:	85 c0                	test   %eax,%eax
+  802257:	74 72                	je     8022cb <devpipe_read+0xe1>
+            sys_yield();
+  802259:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80225c:	8b 03                	mov    (%rbx),%eax
+  80225e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802261:	74 df                	je     802242 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802263:	48 63 c8             	movslq %eax,%rcx
+  802266:	48 89 ca             	mov    %rcx,%rdx
+  802269:	48 c1 ea 03          	shr    $0x3,%rdx
+  80226d:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802274:	08 10 20 
+  802277:	48 89 d0             	mov    %rdx,%rax
+  80227a:	48 f7 e6             	mul    %rsi
+  80227d:	48 c1 ea 06          	shr    $0x6,%rdx
+  802281:	48 89 d0             	mov    %rdx,%rax
+  802284:	48 c1 e0 09          	shl    $0x9,%rax
+  802288:	48 29 d0             	sub    %rdx,%rax
+  80228b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802292:	00 
+  802293:	48 89 c8             	mov    %rcx,%rax
+  802296:	48 29 d0             	sub    %rdx,%rax
+  802299:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80229e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8022a2:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8022a6:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8022a9:	49 83 c7 01          	add    $0x1,%r15
+  8022ad:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8022b1:	75 83                	jne    802236 <devpipe_read+0x4c>
+    return n;
+  8022b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022b7:	eb 03                	jmp    8022bc <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8022b9:	4c 89 f8             	mov    %r15,%rax
+}
+  8022bc:	48 83 c4 18          	add    $0x18,%rsp
+  8022c0:	5b                   	pop    %rbx
+  8022c1:	41 5c                	pop    %r12
+  8022c3:	41 5d                	pop    %r13
+  8022c5:	41 5e                	pop    %r14
+  8022c7:	41 5f                	pop    %r15
+  8022c9:	5d                   	pop    %rbp
+  8022ca:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8022cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d0:	eb ea                	jmp    8022bc <devpipe_read+0xd2>
+
+00000000008022d2 <pipe>:
+pipe(int pfd[2]) {
+  8022d2:	55                   	push   %rbp
+  8022d3:	48 89 e5             	mov    %rsp,%rbp
+  8022d6:	41 55                	push   %r13
+  8022d8:	41 54                	push   %r12
+  8022da:	53                   	push   %rbx
+  8022db:	48 83 ec 18          	sub    $0x18,%rsp
+  8022df:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8022e2:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8022e6:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  8022ed:	00 00 00 
+  8022f0:	ff d0                	call   *%rax
+  8022f2:	89 c3                	mov    %eax,%ebx
+  8022f4:	85 c0                	test   %eax,%eax
+  8022f6:	0f 88 a0 01 00 00    	js     80249c <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8022fc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802301:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802306:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80230a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80230f:	48 b8 97 10 80 00 00 	movabs $0x801097,%rax
+  802316:	00 00 00 
+  802319:	ff d0                	call   *%rax
+  80231b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80231d:	85 c0                	test   %eax,%eax
+  80231f:	0f 88 77 01 00 00    	js     80249c <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802325:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802329:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  802330:	00 00 00 
+  802333:	ff d0                	call   *%rax
+  802335:	89 c3                	mov    %eax,%ebx
+  802337:	85 c0                	test   %eax,%eax
+  802339:	0f 88 43 01 00 00    	js     802482 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80233f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802344:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802349:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80234d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802352:	48 b8 97 10 80 00 00 	movabs $0x801097,%rax
+  802359:	00 00 00 
+  80235c:	ff d0                	call   *%rax
+  80235e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802360:	85 c0                	test   %eax,%eax
+  802362:	0f 88 1a 01 00 00    	js     802482 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802368:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80236c:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  802373:	00 00 00 
+  802376:	ff d0                	call   *%rax
+  802378:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80237b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802380:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802385:	48 89 c6             	mov    %rax,%rsi
+  802388:	bf 00 00 00 00       	mov    $0x0,%edi
+  80238d:	48 b8 97 10 80 00 00 	movabs $0x801097,%rax
+  802394:	00 00 00 
+  802397:	ff d0                	call   *%rax
+  802399:	89 c3                	mov    %eax,%ebx
+  80239b:	85 c0                	test   %eax,%eax
+  80239d:	0f 88 c5 00 00 00    	js     802468 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8023a3:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8023a7:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  8023ae:	00 00 00 
+  8023b1:	ff d0                	call   *%rax
+  8023b3:	48 89 c1             	mov    %rax,%rcx
+  8023b6:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8023bc:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c7:	4c 89 ee             	mov    %r13,%rsi
+  8023ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023cf:	48 b8 fe 10 80 00 00 	movabs $0x8010fe,%rax
+  8023d6:	00 00 00 
+  8023d9:	ff d0                	call   *%rax
+  8023db:	89 c3                	mov    %eax,%ebx
+  8023dd:	85 c0                	test   %eax,%eax
+  8023df:	78 6e                	js     80244f <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8023e1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8023e6:	4c 89 ef             	mov    %r13,%rdi
+  8023e9:	48 b8 39 10 80 00 00 	movabs $0x801039,%rax
+  8023f0:	00 00 00 
+  8023f3:	ff d0                	call   *%rax
+  8023f5:	83 f8 02             	cmp    $0x2,%eax
+  8023f8:	0f 85 ab 00 00 00    	jne    8024a9 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8023fe:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802405:	00 00 
+  802407:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80240b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80240d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802411:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802418:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80241c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80241e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802422:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802429:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80242d:	48 bb 39 16 80 00 00 	movabs $0x801639,%rbx
+  802434:	00 00 00 
+  802437:	ff d3                	call   *%rbx
+  802439:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80243d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802441:	ff d3                	call   *%rbx
+  802443:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802448:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80244d:	eb 4d                	jmp    80249c <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80244f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802454:	4c 89 ee             	mov    %r13,%rsi
+  802457:	bf 00 00 00 00       	mov    $0x0,%edi
+  80245c:	48 b8 63 11 80 00 00 	movabs $0x801163,%rax
+  802463:	00 00 00 
+  802466:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802468:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80246d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802471:	bf 00 00 00 00       	mov    $0x0,%edi
+  802476:	48 b8 63 11 80 00 00 	movabs $0x801163,%rax
+  80247d:	00 00 00 
+  802480:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802482:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802487:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80248b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802490:	48 b8 63 11 80 00 00 	movabs $0x801163,%rax
+  802497:	00 00 00 
+  80249a:	ff d0                	call   *%rax
+}
+  80249c:	89 d8                	mov    %ebx,%eax
+  80249e:	48 83 c4 18          	add    $0x18,%rsp
+  8024a2:	5b                   	pop    %rbx
+  8024a3:	41 5c                	pop    %r12
+  8024a5:	41 5d                	pop    %r13
+  8024a7:	5d                   	pop    %rbp
+  8024a8:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8024a9:	48 b9 90 31 80 00 00 	movabs $0x803190,%rcx
+  8024b0:	00 00 00 
+  8024b3:	48 ba 67 31 80 00 00 	movabs $0x803167,%rdx
+  8024ba:	00 00 00 
+  8024bd:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8024c2:	48 bf 7c 31 80 00 00 	movabs $0x80317c,%rdi
+  8024c9:	00 00 00 
+  8024cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d1:	49 b8 0c 29 80 00 00 	movabs $0x80290c,%r8
+  8024d8:	00 00 00 
+  8024db:	41 ff d0             	call   *%r8
+
+00000000008024de <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8024de:	55                   	push   %rbp
+  8024df:	48 89 e5             	mov    %rsp,%rbp
+  8024e2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8024e6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024ea:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  8024f1:	00 00 00 
+  8024f4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024f6:	85 c0                	test   %eax,%eax
+  8024f8:	78 35                	js     80252f <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8024fa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024fe:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  802505:	00 00 00 
+  802508:	ff d0                	call   *%rax
+  80250a:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80250d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802512:	be 00 10 00 00       	mov    $0x1000,%esi
+  802517:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80251b:	48 b8 6b 10 80 00 00 	movabs $0x80106b,%rax
+  802522:	00 00 00 
+  802525:	ff d0                	call   *%rax
+  802527:	85 c0                	test   %eax,%eax
+  802529:	0f 94 c0             	sete   %al
+  80252c:	0f b6 c0             	movzbl %al,%eax
+}
+  80252f:	c9                   	leave
+  802530:	c3                   	ret
+
+0000000000802531 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802531:	48 89 f8             	mov    %rdi,%rax
+  802534:	48 c1 e8 27          	shr    $0x27,%rax
+  802538:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80253f:	01 00 00 
+  802542:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802546:	f6 c2 01             	test   $0x1,%dl
+  802549:	74 6d                	je     8025b8 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80254b:	48 89 f8             	mov    %rdi,%rax
+  80254e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802552:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802559:	01 00 00 
+  80255c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802560:	f6 c2 01             	test   $0x1,%dl
+  802563:	74 62                	je     8025c7 <get_uvpt_entry+0x96>
+  802565:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80256c:	01 00 00 
+  80256f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802573:	f6 c2 80             	test   $0x80,%dl
+  802576:	75 4f                	jne    8025c7 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802578:	48 89 f8             	mov    %rdi,%rax
+  80257b:	48 c1 e8 15          	shr    $0x15,%rax
+  80257f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802586:	01 00 00 
+  802589:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80258d:	f6 c2 01             	test   $0x1,%dl
+  802590:	74 44                	je     8025d6 <get_uvpt_entry+0xa5>
+  802592:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802599:	01 00 00 
+  80259c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025a0:	f6 c2 80             	test   $0x80,%dl
+  8025a3:	75 31                	jne    8025d6 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8025a5:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8025a9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8025b0:	01 00 00 
+  8025b3:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8025b7:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8025b8:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8025bf:	01 00 00 
+  8025c2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025c6:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025c7:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8025ce:	01 00 00 
+  8025d1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025d5:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025d6:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025dd:	01 00 00 
+  8025e0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025e4:	c3                   	ret
+
+00000000008025e5 <get_prot>:
+
+int
+get_prot(void *va) {
+  8025e5:	55                   	push   %rbp
+  8025e6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8025e9:	48 b8 31 25 80 00 00 	movabs $0x802531,%rax
+  8025f0:	00 00 00 
+  8025f3:	ff d0                	call   *%rax
+  8025f5:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8025f8:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8025fd:	89 c1                	mov    %eax,%ecx
+  8025ff:	83 c9 04             	or     $0x4,%ecx
+  802602:	f6 c2 01             	test   $0x1,%dl
+  802605:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802608:	89 c1                	mov    %eax,%ecx
+  80260a:	83 c9 02             	or     $0x2,%ecx
+  80260d:	f6 c2 02             	test   $0x2,%dl
+  802610:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802613:	89 c1                	mov    %eax,%ecx
+  802615:	83 c9 01             	or     $0x1,%ecx
+  802618:	48 85 d2             	test   %rdx,%rdx
+  80261b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80261e:	89 c1                	mov    %eax,%ecx
+  802620:	83 c9 40             	or     $0x40,%ecx
+  802623:	f6 c6 04             	test   $0x4,%dh
+  802626:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802629:	5d                   	pop    %rbp
+  80262a:	c3                   	ret
+
+000000000080262b <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80262b:	55                   	push   %rbp
+  80262c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80262f:	48 b8 31 25 80 00 00 	movabs $0x802531,%rax
+  802636:	00 00 00 
+  802639:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80263b:	48 c1 e8 06          	shr    $0x6,%rax
+  80263f:	83 e0 01             	and    $0x1,%eax
+}
+  802642:	5d                   	pop    %rbp
+  802643:	c3                   	ret
+
+0000000000802644 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802644:	55                   	push   %rbp
+  802645:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802648:	48 b8 31 25 80 00 00 	movabs $0x802531,%rax
+  80264f:	00 00 00 
+  802652:	ff d0                	call   *%rax
+  802654:	83 e0 01             	and    $0x1,%eax
+}
+  802657:	5d                   	pop    %rbp
+  802658:	c3                   	ret
+
+0000000000802659 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802659:	55                   	push   %rbp
+  80265a:	48 89 e5             	mov    %rsp,%rbp
+  80265d:	41 57                	push   %r15
+  80265f:	41 56                	push   %r14
+  802661:	41 55                	push   %r13
+  802663:	41 54                	push   %r12
+  802665:	53                   	push   %rbx
+  802666:	48 83 ec 18          	sub    $0x18,%rsp
+  80266a:	49 89 ff             	mov    %rdi,%r15
+  80266d:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802671:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802676:	49 bc 44 26 80 00 00 	movabs $0x802644,%r12
+  80267d:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802680:	49 be e5 25 80 00 00 	movabs $0x8025e5,%r14
+  802687:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80268a:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802691:	00 00 00 
+  802694:	eb 0c                	jmp    8026a2 <foreach_shared_region+0x49>
+  802696:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80269d:	4c 39 eb             	cmp    %r13,%rbx
+  8026a0:	74 38                	je     8026da <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  8026a2:	48 89 df             	mov    %rbx,%rdi
+  8026a5:	41 ff d4             	call   *%r12
+  8026a8:	84 c0                	test   %al,%al
+  8026aa:	74 ea                	je     802696 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  8026ac:	48 89 df             	mov    %rbx,%rdi
+  8026af:	41 ff d6             	call   *%r14
+  8026b2:	a8 40                	test   $0x40,%al
+  8026b4:	74 e0                	je     802696 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  8026b6:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8026bd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8026c1:	48 89 df             	mov    %rbx,%rdi
+  8026c4:	41 ff d7             	call   *%r15
+        if (err)
+  8026c7:	85 c0                	test   %eax,%eax
+  8026c9:	74 cb                	je     802696 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8026cb:	48 83 c4 18          	add    $0x18,%rsp
+  8026cf:	5b                   	pop    %rbx
+  8026d0:	41 5c                	pop    %r12
+  8026d2:	41 5d                	pop    %r13
+  8026d4:	41 5e                	pop    %r14
+  8026d6:	41 5f                	pop    %r15
+  8026d8:	5d                   	pop    %rbp
+  8026d9:	c3                   	ret
+    return 0;
+  8026da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026df:	eb ea                	jmp    8026cb <foreach_shared_region+0x72>
+
+00000000008026e1 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8026e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026e6:	c3                   	ret
+
+00000000008026e7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8026e7:	55                   	push   %rbp
+  8026e8:	48 89 e5             	mov    %rsp,%rbp
+  8026eb:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8026ee:	48 be b4 31 80 00 00 	movabs $0x8031b4,%rsi
+  8026f5:	00 00 00 
+  8026f8:	48 b8 e7 0a 80 00 00 	movabs $0x800ae7,%rax
+  8026ff:	00 00 00 
+  802702:	ff d0                	call   *%rax
+    return 0;
+}
+  802704:	b8 00 00 00 00       	mov    $0x0,%eax
+  802709:	5d                   	pop    %rbp
+  80270a:	c3                   	ret
+
+000000000080270b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80270b:	55                   	push   %rbp
+  80270c:	48 89 e5             	mov    %rsp,%rbp
+  80270f:	41 57                	push   %r15
+  802711:	41 56                	push   %r14
+  802713:	41 55                	push   %r13
+  802715:	41 54                	push   %r12
+  802717:	53                   	push   %rbx
+  802718:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80271f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802726:	48 85 d2             	test   %rdx,%rdx
+  802729:	74 7a                	je     8027a5 <devcons_write+0x9a>
+  80272b:	49 89 d6             	mov    %rdx,%r14
+  80272e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802734:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802739:	49 bf e1 0c 80 00 00 	movabs $0x800ce1,%r15
+  802740:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802743:	4c 89 f3             	mov    %r14,%rbx
+  802746:	48 29 f3             	sub    %rsi,%rbx
+  802749:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80274e:	48 39 c3             	cmp    %rax,%rbx
+  802751:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802755:	4c 63 eb             	movslq %ebx,%r13
+  802758:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80275f:	48 01 c6             	add    %rax,%rsi
+  802762:	4c 89 ea             	mov    %r13,%rdx
+  802765:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80276c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80276f:	4c 89 ee             	mov    %r13,%rsi
+  802772:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802779:	48 b8 0e 0f 80 00 00 	movabs $0x800f0e,%rax
+  802780:	00 00 00 
+  802783:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802785:	41 01 dc             	add    %ebx,%r12d
+  802788:	49 63 f4             	movslq %r12d,%rsi
+  80278b:	4c 39 f6             	cmp    %r14,%rsi
+  80278e:	72 b3                	jb     802743 <devcons_write+0x38>
+    return res;
+  802790:	49 63 c4             	movslq %r12d,%rax
+}
+  802793:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80279a:	5b                   	pop    %rbx
+  80279b:	41 5c                	pop    %r12
+  80279d:	41 5d                	pop    %r13
+  80279f:	41 5e                	pop    %r14
+  8027a1:	41 5f                	pop    %r15
+  8027a3:	5d                   	pop    %rbp
+  8027a4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8027a5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8027ab:	eb e3                	jmp    802790 <devcons_write+0x85>
+
+00000000008027ad <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8027ad:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8027b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b5:	48 85 c0             	test   %rax,%rax
+  8027b8:	74 55                	je     80280f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8027ba:	55                   	push   %rbp
+  8027bb:	48 89 e5             	mov    %rsp,%rbp
+  8027be:	41 55                	push   %r13
+  8027c0:	41 54                	push   %r12
+  8027c2:	53                   	push   %rbx
+  8027c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8027c7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8027ca:	48 bb 3b 0f 80 00 00 	movabs $0x800f3b,%rbx
+  8027d1:	00 00 00 
+  8027d4:	49 bc 08 10 80 00 00 	movabs $0x801008,%r12
+  8027db:	00 00 00 
+  8027de:	eb 03                	jmp    8027e3 <devcons_read+0x36>
+  8027e0:	41 ff d4             	call   *%r12
+  8027e3:	ff d3                	call   *%rbx
+  8027e5:	85 c0                	test   %eax,%eax
+  8027e7:	74 f7                	je     8027e0 <devcons_read+0x33>
+    if (c < 0) return c;
+  8027e9:	48 63 d0             	movslq %eax,%rdx
+  8027ec:	78 13                	js     802801 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8027ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f3:	83 f8 04             	cmp    $0x4,%eax
+  8027f6:	74 09                	je     802801 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8027f8:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8027fc:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802801:	48 89 d0             	mov    %rdx,%rax
+  802804:	48 83 c4 08          	add    $0x8,%rsp
+  802808:	5b                   	pop    %rbx
+  802809:	41 5c                	pop    %r12
+  80280b:	41 5d                	pop    %r13
+  80280d:	5d                   	pop    %rbp
+  80280e:	c3                   	ret
+  80280f:	48 89 d0             	mov    %rdx,%rax
+  802812:	c3                   	ret
+
+0000000000802813 <cputchar>:
+cputchar(int ch) {
+  802813:	55                   	push   %rbp
+  802814:	48 89 e5             	mov    %rsp,%rbp
+  802817:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80281b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80281f:	be 01 00 00 00       	mov    $0x1,%esi
+  802824:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802828:	48 b8 0e 0f 80 00 00 	movabs $0x800f0e,%rax
+  80282f:	00 00 00 
+  802832:	ff d0                	call   *%rax
+}
+  802834:	c9                   	leave
+  802835:	c3                   	ret
+
+0000000000802836 <getchar>:
+getchar(void) {
+  802836:	55                   	push   %rbp
+  802837:	48 89 e5             	mov    %rsp,%rbp
+  80283a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80283e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802843:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802847:	bf 00 00 00 00       	mov    $0x0,%edi
+  80284c:	48 b8 aa 19 80 00 00 	movabs $0x8019aa,%rax
+  802853:	00 00 00 
+  802856:	ff d0                	call   *%rax
+  802858:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80285a:	85 c0                	test   %eax,%eax
+  80285c:	78 06                	js     802864 <getchar+0x2e>
+  80285e:	74 08                	je     802868 <getchar+0x32>
+  802860:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802864:	89 d0                	mov    %edx,%eax
+  802866:	c9                   	leave
+  802867:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802868:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80286d:	eb f5                	jmp    802864 <getchar+0x2e>
+
+000000000080286f <iscons>:
+iscons(int fdnum) {
+  80286f:	55                   	push   %rbp
+  802870:	48 89 e5             	mov    %rsp,%rbp
+  802873:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802877:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80287b:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  802882:	00 00 00 
+  802885:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802887:	85 c0                	test   %eax,%eax
+  802889:	78 18                	js     8028a3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80288b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80288f:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802896:	00 00 00 
+  802899:	8b 00                	mov    (%rax),%eax
+  80289b:	39 02                	cmp    %eax,(%rdx)
+  80289d:	0f 94 c0             	sete   %al
+  8028a0:	0f b6 c0             	movzbl %al,%eax
+}
+  8028a3:	c9                   	leave
+  8028a4:	c3                   	ret
+
+00000000008028a5 <opencons>:
+opencons(void) {
+  8028a5:	55                   	push   %rbp
+  8028a6:	48 89 e5             	mov    %rsp,%rbp
+  8028a9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8028ad:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8028b1:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  8028b8:	00 00 00 
+  8028bb:	ff d0                	call   *%rax
+  8028bd:	85 c0                	test   %eax,%eax
+  8028bf:	78 49                	js     80290a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8028c1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8028c6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028cb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8028cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028d4:	48 b8 97 10 80 00 00 	movabs $0x801097,%rax
+  8028db:	00 00 00 
+  8028de:	ff d0                	call   *%rax
+  8028e0:	85 c0                	test   %eax,%eax
+  8028e2:	78 26                	js     80290a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8028e4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028e8:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  8028ef:	00 00 
+  8028f1:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8028f3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8028f7:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8028fe:	48 b8 39 16 80 00 00 	movabs $0x801639,%rax
+  802905:	00 00 00 
+  802908:	ff d0                	call   *%rax
+}
+  80290a:	c9                   	leave
+  80290b:	c3                   	ret
+
+000000000080290c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80290c:	55                   	push   %rbp
+  80290d:	48 89 e5             	mov    %rsp,%rbp
+  802910:	41 56                	push   %r14
+  802912:	41 55                	push   %r13
+  802914:	41 54                	push   %r12
+  802916:	53                   	push   %rbx
+  802917:	48 83 ec 50          	sub    $0x50,%rsp
+  80291b:	49 89 fc             	mov    %rdi,%r12
+  80291e:	41 89 f5             	mov    %esi,%r13d
+  802921:	48 89 d3             	mov    %rdx,%rbx
+  802924:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802928:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80292c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802930:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802937:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80293b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80293f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802943:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802947:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80294e:	00 00 00 
+  802951:	4c 8b 30             	mov    (%rax),%r14
+  802954:	48 b8 d7 0f 80 00 00 	movabs $0x800fd7,%rax
+  80295b:	00 00 00 
+  80295e:	ff d0                	call   *%rax
+  802960:	89 c6                	mov    %eax,%esi
+  802962:	45 89 e8             	mov    %r13d,%r8d
+  802965:	4c 89 e1             	mov    %r12,%rcx
+  802968:	4c 89 f2             	mov    %r14,%rdx
+  80296b:	48 bf c0 31 80 00 00 	movabs $0x8031c0,%rdi
+  802972:	00 00 00 
+  802975:	b8 00 00 00 00       	mov    $0x0,%eax
+  80297a:	49 bc c2 01 80 00 00 	movabs $0x8001c2,%r12
+  802981:	00 00 00 
+  802984:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802987:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80298b:	48 89 df             	mov    %rbx,%rdi
+  80298e:	48 b8 5e 01 80 00 00 	movabs $0x80015e,%rax
+  802995:	00 00 00 
+  802998:	ff d0                	call   *%rax
+    cprintf("\n");
+  80299a:	48 bf 3a 2b 80 00 00 	movabs $0x802b3a,%rdi
+  8029a1:	00 00 00 
+  8029a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8029ac:	cc                   	int3
+  8029ad:	eb fd                	jmp    8029ac <_panic+0xa0>
+
+00000000008029af <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8029af:	55                   	push   %rbp
+  8029b0:	48 89 e5             	mov    %rsp,%rbp
+  8029b3:	41 54                	push   %r12
+  8029b5:	53                   	push   %rbx
+  8029b6:	48 89 fb             	mov    %rdi,%rbx
+  8029b9:	48 89 f7             	mov    %rsi,%rdi
+  8029bc:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8029bf:	48 85 f6             	test   %rsi,%rsi
+  8029c2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029c9:	00 00 00 
+  8029cc:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8029d0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029d5:	48 b8 01 14 80 00 00 	movabs $0x801401,%rax
+  8029dc:	00 00 00 
+  8029df:	ff d0                	call   *%rax
+    if (res < 0) {
+  8029e1:	85 c0                	test   %eax,%eax
+  8029e3:	78 45                	js     802a2a <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8029e5:	48 85 db             	test   %rbx,%rbx
+  8029e8:	74 12                	je     8029fc <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8029ea:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029f1:	00 00 00 
+  8029f4:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8029fa:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  8029fc:	4d 85 e4             	test   %r12,%r12
+  8029ff:	74 14                	je     802a15 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802a01:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a08:	00 00 00 
+  802a0b:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802a11:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802a15:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a1c:	00 00 00 
+  802a1f:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802a25:	5b                   	pop    %rbx
+  802a26:	41 5c                	pop    %r12
+  802a28:	5d                   	pop    %rbp
+  802a29:	c3                   	ret
+        if (from_env_store)
+  802a2a:	48 85 db             	test   %rbx,%rbx
+  802a2d:	74 06                	je     802a35 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802a2f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802a35:	4d 85 e4             	test   %r12,%r12
+  802a38:	74 eb                	je     802a25 <ipc_recv+0x76>
+            *perm_store = 0;
+  802a3a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802a41:	00 
+  802a42:	eb e1                	jmp    802a25 <ipc_recv+0x76>
+
+0000000000802a44 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802a44:	55                   	push   %rbp
+  802a45:	48 89 e5             	mov    %rsp,%rbp
+  802a48:	41 57                	push   %r15
+  802a4a:	41 56                	push   %r14
+  802a4c:	41 55                	push   %r13
+  802a4e:	41 54                	push   %r12
+  802a50:	53                   	push   %rbx
+  802a51:	48 83 ec 18          	sub    $0x18,%rsp
+  802a55:	41 89 fd             	mov    %edi,%r13d
+  802a58:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802a5b:	48 89 d3             	mov    %rdx,%rbx
+  802a5e:	49 89 cc             	mov    %rcx,%r12
+  802a61:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a65:	48 85 d2             	test   %rdx,%rdx
+  802a68:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a6f:	00 00 00 
+  802a72:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a76:	49 be d5 13 80 00 00 	movabs $0x8013d5,%r14
+  802a7d:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802a80:	49 bf 08 10 80 00 00 	movabs $0x801008,%r15
+  802a87:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a8a:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802a8d:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802a91:	4c 89 e1             	mov    %r12,%rcx
+  802a94:	48 89 da             	mov    %rbx,%rdx
+  802a97:	44 89 ef             	mov    %r13d,%edi
+  802a9a:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802a9d:	85 c0                	test   %eax,%eax
+  802a9f:	74 34                	je     802ad5 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802aa1:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802aa4:	75 05                	jne    802aab <ipc_send+0x67>
+        sys_yield();
+  802aa6:	41 ff d7             	call   *%r15
+    while (true) {
+  802aa9:	eb df                	jmp    802a8a <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802aab:	48 ba e3 31 80 00 00 	movabs $0x8031e3,%rdx
+  802ab2:	00 00 00 
+  802ab5:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802aba:	48 bf fc 31 80 00 00 	movabs $0x8031fc,%rdi
+  802ac1:	00 00 00 
+  802ac4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac9:	48 b9 0c 29 80 00 00 	movabs $0x80290c,%rcx
+  802ad0:	00 00 00 
+  802ad3:	ff d1                	call   *%rcx
+    }
+}
+  802ad5:	48 83 c4 18          	add    $0x18,%rsp
+  802ad9:	5b                   	pop    %rbx
+  802ada:	41 5c                	pop    %r12
+  802adc:	41 5d                	pop    %r13
+  802ade:	41 5e                	pop    %r14
+  802ae0:	41 5f                	pop    %r15
+  802ae2:	5d                   	pop    %rbp
+  802ae3:	c3                   	ret
+
+0000000000802ae4 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802ae9:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802af0:	00 00 00 
+  802af3:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802afa:	48 01 ca             	add    %rcx,%rdx
+  802afd:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802b03:	39 fa                	cmp    %edi,%edx
+  802b05:	74 12                	je     802b19 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802b07:	48 83 c0 01          	add    $0x1,%rax
+  802b0b:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802b11:	75 e0                	jne    802af3 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802b13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b18:	c3                   	ret
+            return envs[i].env_id;
+  802b19:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802b20:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b27:	00 00 00 
+  802b2a:	48 01 d0             	add    %rdx,%rax
+  802b2d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b33:	c3                   	ret
+  802b34:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000802b38 <__rodata_start>:
+  802b38:	25 64 0a 00 3c       	and    $0x3c000a64,%eax
+  802b3d:	75 6e                	jne    802bad <__rodata_start+0x75>
+  802b3f:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b43:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b44:	3e 00 30             	ds add %dh,(%rax)
+  802b47:	31 32                	xor    %esi,(%rdx)
+  802b49:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802b50:	41                   	rex.B
+  802b51:	42                   	rex.X
+  802b52:	43                   	rex.XB
+  802b53:	44                   	rex.R
+  802b54:	45                   	rex.RB
+  802b55:	46 00 30             	rex.RX add %r14b,(%rax)
+  802b58:	31 32                	xor    %esi,(%rdx)
+  802b5a:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802b61:	61                   	(bad)
+  802b62:	62 63 64 65 66       	(bad)
+  802b67:	00 28                	add    %ch,(%rax)
+  802b69:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b6a:	75 6c                	jne    802bd8 <__rodata_start+0xa0>
+  802b6c:	6c                   	insb   (%dx),%es:(%rdi)
+  802b6d:	29 00                	sub    %eax,(%rax)
+  802b6f:	65 72 72             	gs jb  802be4 <__rodata_start+0xac>
+  802b72:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802b73:	72 20                	jb     802b95 <__rodata_start+0x5d>
+  802b75:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802b7a:	73 70                	jae    802bec <__rodata_start+0xb4>
+  802b7c:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802b80:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802b87:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802b88:	72 00                	jb     802b8a <__rodata_start+0x52>
+  802b8a:	62 61 64 20 65       	(bad)
+  802b8f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b90:	76 69                	jbe    802bfb <__rodata_start+0xc3>
+  802b92:	72 6f                	jb     802c03 <__rodata_start+0xcb>
+  802b94:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b95:	6d                   	insl   (%dx),%es:(%rdi)
+  802b96:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802b98:	74 00                	je     802b9a <__rodata_start+0x62>
+  802b9a:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802ba1:	20 70 61             	and    %dh,0x61(%rax)
+  802ba4:	72 61                	jb     802c07 <__rodata_start+0xcf>
+  802ba6:	6d                   	insl   (%dx),%es:(%rdi)
+  802ba7:	65 74 65             	gs je  802c0f <__rodata_start+0xd7>
+  802baa:	72 00                	jb     802bac <__rodata_start+0x74>
+  802bac:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bad:	75 74                	jne    802c23 <__rodata_start+0xeb>
+  802baf:	20 6f 66             	and    %ch,0x66(%rdi)
+  802bb2:	20 6d 65             	and    %ch,0x65(%rbp)
+  802bb5:	6d                   	insl   (%dx),%es:(%rdi)
+  802bb6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bb7:	72 79                	jb     802c32 <__rodata_start+0xfa>
+  802bb9:	00 6f 75             	add    %ch,0x75(%rdi)
+  802bbc:	74 20                	je     802bde <__rodata_start+0xa6>
+  802bbe:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bbf:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802bc3:	76 69                	jbe    802c2e <__rodata_start+0xf6>
+  802bc5:	72 6f                	jb     802c36 <__rodata_start+0xfe>
+  802bc7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bc8:	6d                   	insl   (%dx),%es:(%rdi)
+  802bc9:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802bcb:	74 73                	je     802c40 <__rodata_start+0x108>
+  802bcd:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802bd0:	72 72                	jb     802c44 <__rodata_start+0x10c>
+  802bd2:	75 70                	jne    802c44 <__rodata_start+0x10c>
+  802bd4:	74 65                	je     802c3b <__rodata_start+0x103>
+  802bd6:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802bdb:	75 67                	jne    802c44 <__rodata_start+0x10c>
+  802bdd:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802be0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802be2:	00 73 65             	add    %dh,0x65(%rbx)
+  802be5:	67 6d                	insl   (%dx),%es:(%edi)
+  802be7:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802be9:	74 61                	je     802c4c <__rodata_start+0x114>
+  802beb:	74 69                	je     802c56 <__rodata_start+0x11e>
+  802bed:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802bef:	20 66 61             	and    %ah,0x61(%rsi)
+  802bf2:	75 6c                	jne    802c60 <__rodata_start+0x128>
+  802bf4:	74 00                	je     802bf6 <__rodata_start+0xbe>
+  802bf6:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802bfd:	20 45 4c             	and    %al,0x4c(%rbp)
+  802c00:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802c04:	61                   	(bad)
+  802c05:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802c0a:	20 73 75             	and    %dh,0x75(%rbx)
+  802c0d:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802c10:	73 79                	jae    802c8b <__rodata_start+0x153>
+  802c12:	73 74                	jae    802c88 <__rodata_start+0x150>
+  802c14:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802c16:	20 63 61             	and    %ah,0x61(%rbx)
+  802c19:	6c                   	insb   (%dx),%es:(%rdi)
+  802c1a:	6c                   	insb   (%dx),%es:(%rdi)
+  802c1b:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802c1e:	74 72                	je     802c92 <__rodata_start+0x15a>
+  802c20:	79 20                	jns    802c42 <__rodata_start+0x10a>
+  802c22:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c23:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c24:	74 20                	je     802c46 <__rodata_start+0x10e>
+  802c26:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802c28:	75 6e                	jne    802c98 <__rodata_start+0x160>
+  802c2a:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802c2e:	76 20                	jbe    802c50 <__rodata_start+0x118>
+  802c30:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802c37:	72 65                	jb     802c9e <__rodata_start+0x166>
+  802c39:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802c3c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c3d:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802c41:	65 78 70             	gs js  802cb4 <__rodata_start+0x17c>
+  802c44:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802c49:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802c4c:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802c50:	20 66 69             	and    %ah,0x69(%rsi)
+  802c53:	6c                   	insb   (%dx),%es:(%rdi)
+  802c54:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802c58:	20 66 72             	and    %ah,0x72(%rsi)
+  802c5b:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802c60:	61                   	(bad)
+  802c61:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802c64:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c65:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c66:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802c6a:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802c6d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c6e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c6f:	20 6d 61             	and    %ch,0x61(%rbp)
+  802c72:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c73:	79 20                	jns    802c95 <__rodata_start+0x15d>
+  802c75:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802c7c:	72 65                	jb     802ce3 <__rodata_start+0x1ab>
+  802c7e:	20 6f 70             	and    %ch,0x70(%rdi)
+  802c81:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802c83:	00 66 69             	add    %ah,0x69(%rsi)
+  802c86:	6c                   	insb   (%dx),%es:(%rdi)
+  802c87:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802c8b:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802c8e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c8f:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802c92:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c93:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c94:	74 20                	je     802cb6 <__rodata_start+0x17e>
+  802c96:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802c98:	75 6e                	jne    802d08 <__rodata_start+0x1d0>
+  802c9a:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802c9e:	76 61                	jbe    802d01 <__rodata_start+0x1c9>
+  802ca0:	6c                   	insb   (%dx),%es:(%rdi)
+  802ca1:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802ca8:	00 
+  802ca9:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802cb0:	72 65                	jb     802d17 <__rodata_start+0x1df>
+  802cb2:	61                   	(bad)
+  802cb3:	64 79 20             	fs jns 802cd6 <__rodata_start+0x19e>
+  802cb6:	65 78 69             	gs js  802d22 <__rodata_start+0x1ea>
+  802cb9:	73 74                	jae    802d2f <__rodata_start+0x1f7>
+  802cbb:	73 00                	jae    802cbd <__rodata_start+0x185>
+  802cbd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cbe:	70 65                	jo     802d25 <__rodata_start+0x1ed>
+  802cc0:	72 61                	jb     802d23 <__rodata_start+0x1eb>
+  802cc2:	74 69                	je     802d2d <__rodata_start+0x1f5>
+  802cc4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cc5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cc6:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802cc9:	74 20                	je     802ceb <__rodata_start+0x1b3>
+  802ccb:	73 75                	jae    802d42 <__rodata_start+0x20a>
+  802ccd:	70 70                	jo     802d3f <__rodata_start+0x207>
+  802ccf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cd0:	72 74                	jb     802d46 <__rodata_start+0x20e>
+  802cd2:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802cd7:	65 72 61             	gs jb  802d3b <__rodata_start+0x203>
+  802cda:	74 69                	je     802d45 <__rodata_start+0x20d>
+  802cdc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cdd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cde:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802ce1:	74 20                	je     802d03 <__rodata_start+0x1cb>
+  802ce3:	70 65                	jo     802d4a <__rodata_start+0x212>
+  802ce5:	72 6d                	jb     802d54 <__rodata_start+0x21c>
+  802ce7:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  802cee:	2e 
+  802cef:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  802cf6:	00 
+  802cf7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  802cfe:	00 00 
+  802d00:	af                   	scas   %es:(%rdi),%eax
+  802d01:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d07:	00 f0                	add    %dh,%al
+  802d09:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d0f:	00 e0                	add    %ah,%al
+  802d11:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d17:	00 f0                	add    %dh,%al
+  802d19:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d1f:	00 f0                	add    %dh,%al
+  802d21:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d27:	00 f0                	add    %dh,%al
+  802d29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d2f:	00 f0                	add    %dh,%al
+  802d31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d37:	00 ce                	add    %cl,%dh
+  802d39:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d3f:	00 f0                	add    %dh,%al
+  802d41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d47:	00 f0                	add    %dh,%al
+  802d49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d4f:	00 c2                	add    %al,%dl
+  802d51:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d57:	00 3c 04             	add    %bh,(%rsp,%rax,1)
+  802d5a:	80 00 00             	addb   $0x0,(%rax)
+  802d5d:	00 00                	add    %al,(%rax)
+  802d5f:	00 f0                	add    %dh,%al
+  802d61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802d67:	00 c2                	add    %al,%dl
+  802d69:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802d6f:	00 08                	add    %cl,(%rax)
+  802d71:	04 80                	add    $0x80,%al
+  802d73:	00 00                	add    %al,(%rax)
+  802d75:	00 00                	add    %al,(%rax)
+  802d77:	00 08                	add    %cl,(%rax)
+  802d79:	04 80                	add    $0x80,%al
+  802d7b:	00 00                	add    %al,(%rax)
+  802d7d:	00 00                	add    %al,(%rax)
+  802d7f:	00 08                	add    %cl,(%rax)
+  802d81:	04 80                	add    $0x80,%al
+  802d83:	00 00                	add    %al,(%rax)
+  802d85:	00 00                	add    %al,(%rax)
+  802d87:	00 08                	add    %cl,(%rax)
+  802d89:	04 80                	add    $0x80,%al
+  802d8b:	00 00                	add    %al,(%rax)
+  802d8d:	00 00                	add    %al,(%rax)
+  802d8f:	00 08                	add    %cl,(%rax)
+  802d91:	04 80                	add    $0x80,%al
+  802d93:	00 00                	add    %al,(%rax)
+  802d95:	00 00                	add    %al,(%rax)
+  802d97:	00 08                	add    %cl,(%rax)
+  802d99:	04 80                	add    $0x80,%al
+  802d9b:	00 00                	add    %al,(%rax)
+  802d9d:	00 00                	add    %al,(%rax)
+  802d9f:	00 08                	add    %cl,(%rax)
+  802da1:	04 80                	add    $0x80,%al
+  802da3:	00 00                	add    %al,(%rax)
+  802da5:	00 00                	add    %al,(%rax)
+  802da7:	00 08                	add    %cl,(%rax)
+  802da9:	04 80                	add    $0x80,%al
+  802dab:	00 00                	add    %al,(%rax)
+  802dad:	00 00                	add    %al,(%rax)
+  802daf:	00 08                	add    %cl,(%rax)
+  802db1:	04 80                	add    $0x80,%al
+  802db3:	00 00                	add    %al,(%rax)
+  802db5:	00 00                	add    %al,(%rax)
+  802db7:	00 f0                	add    %dh,%al
+  802db9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802dbf:	00 f0                	add    %dh,%al
+  802dc1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802dc7:	00 f0                	add    %dh,%al
+  802dc9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802dcf:	00 f0                	add    %dh,%al
+  802dd1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802dd7:	00 f0                	add    %dh,%al
+  802dd9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ddf:	00 f0                	add    %dh,%al
+  802de1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802de7:	00 f0                	add    %dh,%al
+  802de9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802def:	00 f0                	add    %dh,%al
+  802df1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802df7:	00 f0                	add    %dh,%al
+  802df9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802dff:	00 f0                	add    %dh,%al
+  802e01:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e07:	00 f0                	add    %dh,%al
+  802e09:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e0f:	00 f0                	add    %dh,%al
+  802e11:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e17:	00 f0                	add    %dh,%al
+  802e19:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e1f:	00 f0                	add    %dh,%al
+  802e21:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e27:	00 f0                	add    %dh,%al
+  802e29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e2f:	00 f0                	add    %dh,%al
+  802e31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e37:	00 f0                	add    %dh,%al
+  802e39:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e3f:	00 f0                	add    %dh,%al
+  802e41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e47:	00 f0                	add    %dh,%al
+  802e49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e4f:	00 f0                	add    %dh,%al
+  802e51:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e57:	00 f0                	add    %dh,%al
+  802e59:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e5f:	00 f0                	add    %dh,%al
+  802e61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e67:	00 f0                	add    %dh,%al
+  802e69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e6f:	00 f0                	add    %dh,%al
+  802e71:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e77:	00 f0                	add    %dh,%al
+  802e79:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e7f:	00 f0                	add    %dh,%al
+  802e81:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e87:	00 f0                	add    %dh,%al
+  802e89:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e8f:	00 f0                	add    %dh,%al
+  802e91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e97:	00 f0                	add    %dh,%al
+  802e99:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e9f:	00 f0                	add    %dh,%al
+  802ea1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ea7:	00 13                	add    %dl,(%rbx)
+  802ea9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eaf:	00 f0                	add    %dh,%al
+  802eb1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eb7:	00 f0                	add    %dh,%al
+  802eb9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ebf:	00 f0                	add    %dh,%al
+  802ec1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ec7:	00 f0                	add    %dh,%al
+  802ec9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ecf:	00 f0                	add    %dh,%al
+  802ed1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ed7:	00 f0                	add    %dh,%al
+  802ed9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802edf:	00 f0                	add    %dh,%al
+  802ee1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ee7:	00 f0                	add    %dh,%al
+  802ee9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eef:	00 f0                	add    %dh,%al
+  802ef1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ef7:	00 f0                	add    %dh,%al
+  802ef9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eff:	00 5f 04             	add    %bl,0x4(%rdi)
+  802f02:	80 00 00             	addb   $0x0,(%rax)
+  802f05:	00 00                	add    %al,(%rax)
+  802f07:	00 2e                	add    %ch,(%rsi)
+  802f09:	06                   	(bad)
+  802f0a:	80 00 00             	addb   $0x0,(%rax)
+  802f0d:	00 00                	add    %al,(%rax)
+  802f0f:	00 f0                	add    %dh,%al
+  802f11:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f17:	00 f0                	add    %dh,%al
+  802f19:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f1f:	00 f0                	add    %dh,%al
+  802f21:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f27:	00 f0                	add    %dh,%al
+  802f29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f2f:	00 8e 04 80 00 00    	add    %cl,0x8004(%rsi)
+  802f35:	00 00                	add    %al,(%rax)
+  802f37:	00 f0                	add    %dh,%al
+  802f39:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f3f:	00 f0                	add    %dh,%al
+  802f41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f47:	00 54 04 80          	add    %dl,-0x80(%rsp,%rax,1)
+  802f4b:	00 00                	add    %al,(%rax)
+  802f4d:	00 00                	add    %al,(%rax)
+  802f4f:	00 f0                	add    %dh,%al
+  802f51:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f57:	00 f0                	add    %dh,%al
+  802f59:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f5f:	00 d6                	add    %dl,%dh
+  802f61:	07                   	(bad)
+  802f62:	80 00 00             	addb   $0x0,(%rax)
+  802f65:	00 00                	add    %al,(%rax)
+  802f67:	00 a0 08 80 00 00    	add    %ah,0x8008(%rax)
+  802f6d:	00 00                	add    %al,(%rax)
+  802f6f:	00 f0                	add    %dh,%al
+  802f71:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f77:	00 f0                	add    %dh,%al
+  802f79:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f7f:	00 25 05 80 00 00    	add    %ah,0x8005(%rip)        # 80af8a <__bss_end+0x2f8a>
+  802f85:	00 00                	add    %al,(%rax)
+  802f87:	00 f0                	add    %dh,%al
+  802f89:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f8f:	00 02                	add    %al,(%rdx)
+  802f91:	07                   	(bad)
+  802f92:	80 00 00             	addb   $0x0,(%rax)
+  802f95:	00 00                	add    %al,(%rax)
+  802f97:	00 f0                	add    %dh,%al
+  802f99:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f9f:	00 f0                	add    %dh,%al
+  802fa1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fa7:	00 13                	add    %dl,(%rbx)
+  802fa9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802faf:	00 f0                	add    %dh,%al
+  802fb1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fb7:	00 b8 03 80 00 00    	add    %bh,0x8003(%rax)
+  802fbd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000802fc0 <error_string>:
+	...
+  802fc8:	78 2b 80 00 00 00 00 00 8a 2b 80 00 00 00 00 00     x+.......+......
+  802fd8:	9a 2b 80 00 00 00 00 00 ac 2b 80 00 00 00 00 00     .+.......+......
+  802fe8:	ba 2b 80 00 00 00 00 00 ce 2b 80 00 00 00 00 00     .+.......+......
+  802ff8:	e3 2b 80 00 00 00 00 00 f6 2b 80 00 00 00 00 00     .+.......+......
+  803008:	08 2c 80 00 00 00 00 00 1c 2c 80 00 00 00 00 00     .,.......,......
+  803018:	2c 2c 80 00 00 00 00 00 3f 2c 80 00 00 00 00 00     ,,......?,......
+  803028:	56 2c 80 00 00 00 00 00 6c 2c 80 00 00 00 00 00     V,......l,......
+  803038:	84 2c 80 00 00 00 00 00 9c 2c 80 00 00 00 00 00     .,.......,......
+  803048:	a9 2c 80 00 00 00 00 00 70 30 80 00 00 00 00 00     .,......p0......
+  803058:	bd 2c 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .,..............
+  803068:	d5 2c 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .,......file is 
+  803078:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803088:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803098:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8030a8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8030b8:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  8030c8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8030d8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8030e8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8030f8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803108:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803118:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803128:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803138:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803140 <devtab>:
+  803140:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803150:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803160:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803170:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803180:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803190:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8031a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8031b0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8031c0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8031d0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8031e0:	3a 20 00 69 70 63 5f 73 65 6e 64 3a 20 66 61 69     : .ipc_send: fai
+  8031f0:	6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62 2f     led to send.lib/
+  803200:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803210:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803220:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803230:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803240:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803250:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803260:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803270:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803280:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803290:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8032c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803300:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803310:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803320:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803330:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803340:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803350:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803360:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803370:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803380:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803390:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803400:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803410:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803420:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803430:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803440:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803450:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803460:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803470:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803480:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803490:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803500:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803510:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803520:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803530:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803540:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803550:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803560:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803570:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803580:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803590:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803600:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803610:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803620:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803630:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803640:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803650:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803660:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803670:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803680:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803690:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803700:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
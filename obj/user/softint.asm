@@ -0,0 +1,5381 @@
+
+obj/user/softint:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 05 00 00 00       	call   800028 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    asm volatile("int $14"); /* page fault */
+  800025:	cd 0e                	int    $0xe
+}
+  800027:	c3                   	ret
+
+0000000000800028 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800028:	55                   	push   %rbp
+  800029:	48 89 e5             	mov    %rsp,%rbp
+  80002c:	41 56                	push   %r14
+  80002e:	41 55                	push   %r13
+  800030:	41 54                	push   %r12
+  800032:	53                   	push   %rbx
+  800033:	41 89 fd             	mov    %edi,%r13d
+  800036:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800039:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800040:	00 00 00 
+  800043:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80004a:	00 00 00 
+  80004d:	48 39 c2             	cmp    %rax,%rdx
+  800050:	73 17                	jae    800069 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800052:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800055:	49 89 c4             	mov    %rax,%r12
+  800058:	48 83 c3 08          	add    $0x8,%rbx
+  80005c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800061:	ff 53 f8             	call   *-0x8(%rbx)
+  800064:	4c 39 e3             	cmp    %r12,%rbx
+  800067:	72 ef                	jb     800058 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800069:	48 b8 bb 01 80 00 00 	movabs $0x8001bb,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800078:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80007f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800086:	00 00 00 
+  800089:	48 01 d0             	add    %rdx,%rax
+  80008c:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800093:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800096:	45 85 ed             	test   %r13d,%r13d
+  800099:	7e 0d                	jle    8000a8 <libmain+0x80>
+  80009b:	49 8b 06             	mov    (%r14),%rax
+  80009e:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000a5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000a8:	4c 89 f6             	mov    %r14,%rsi
+  8000ab:	44 89 ef             	mov    %r13d,%edi
+  8000ae:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000b5:	00 00 00 
+  8000b8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000ba:	48 b8 cf 00 80 00 00 	movabs $0x8000cf,%rax
+  8000c1:	00 00 00 
+  8000c4:	ff d0                	call   *%rax
+#endif
+}
+  8000c6:	5b                   	pop    %rbx
+  8000c7:	41 5c                	pop    %r12
+  8000c9:	41 5d                	pop    %r13
+  8000cb:	41 5e                	pop    %r14
+  8000cd:	5d                   	pop    %rbp
+  8000ce:	c3                   	ret
+
+00000000008000cf <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000cf:	55                   	push   %rbp
+  8000d0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000d3:	48 b8 43 0a 80 00 00 	movabs $0x800a43,%rax
+  8000da:	00 00 00 
+  8000dd:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000e4:	48 b8 50 01 80 00 00 	movabs $0x800150,%rax
+  8000eb:	00 00 00 
+  8000ee:	ff d0                	call   *%rax
+}
+  8000f0:	5d                   	pop    %rbp
+  8000f1:	c3                   	ret
+
+00000000008000f2 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000f2:	55                   	push   %rbp
+  8000f3:	48 89 e5             	mov    %rsp,%rbp
+  8000f6:	53                   	push   %rbx
+  8000f7:	48 89 fa             	mov    %rdi,%rdx
+  8000fa:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8000fd:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800102:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800107:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80010c:	be 00 00 00 00       	mov    $0x0,%esi
+  800111:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800117:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800119:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80011d:	c9                   	leave
+  80011e:	c3                   	ret
+
+000000000080011f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80011f:	55                   	push   %rbp
+  800120:	48 89 e5             	mov    %rsp,%rbp
+  800123:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800124:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800129:	ba 00 00 00 00       	mov    $0x0,%edx
+  80012e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800133:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800138:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80013d:	be 00 00 00 00       	mov    $0x0,%esi
+  800142:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800148:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80014a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80014e:	c9                   	leave
+  80014f:	c3                   	ret
+
+0000000000800150 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800150:	55                   	push   %rbp
+  800151:	48 89 e5             	mov    %rsp,%rbp
+  800154:	53                   	push   %rbx
+  800155:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800159:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80015c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800161:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800166:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80016b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800170:	be 00 00 00 00       	mov    $0x0,%esi
+  800175:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80017b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80017d:	48 85 c0             	test   %rax,%rax
+  800180:	7f 06                	jg     800188 <sys_env_destroy+0x38>
+}
+  800182:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800186:	c9                   	leave
+  800187:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800188:	49 89 c0             	mov    %rax,%r8
+  80018b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800190:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  800197:	00 00 00 
+  80019a:	be 26 00 00 00       	mov    $0x26,%esi
+  80019f:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  8001a6:	00 00 00 
+  8001a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ae:	49 b9 f0 1a 80 00 00 	movabs $0x801af0,%r9
+  8001b5:	00 00 00 
+  8001b8:	41 ff d1             	call   *%r9
+
+00000000008001bb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001bb:	55                   	push   %rbp
+  8001bc:	48 89 e5             	mov    %rsp,%rbp
+  8001bf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001c0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8001de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001e4:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ea:	c9                   	leave
+  8001eb:	c3                   	ret
+
+00000000008001ec <sys_yield>:
+
+void
+sys_yield(void) {
+  8001ec:	55                   	push   %rbp
+  8001ed:	48 89 e5             	mov    %rsp,%rbp
+  8001f0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001f1:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800200:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800205:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80020a:	be 00 00 00 00       	mov    $0x0,%esi
+  80020f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800215:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800217:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80021b:	c9                   	leave
+  80021c:	c3                   	ret
+
+000000000080021d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80021d:	55                   	push   %rbp
+  80021e:	48 89 e5             	mov    %rsp,%rbp
+  800221:	53                   	push   %rbx
+  800222:	48 89 fa             	mov    %rdi,%rdx
+  800225:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800228:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80022d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800234:	00 00 00 
+  800237:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80023c:	be 00 00 00 00       	mov    $0x0,%esi
+  800241:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800247:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800249:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80024d:	c9                   	leave
+  80024e:	c3                   	ret
+
+000000000080024f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80024f:	55                   	push   %rbp
+  800250:	48 89 e5             	mov    %rsp,%rbp
+  800253:	53                   	push   %rbx
+  800254:	49 89 f8             	mov    %rdi,%r8
+  800257:	48 89 d3             	mov    %rdx,%rbx
+  80025a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80025d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800262:	4c 89 c2             	mov    %r8,%rdx
+  800265:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800268:	be 00 00 00 00       	mov    $0x0,%esi
+  80026d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800273:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800275:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800279:	c9                   	leave
+  80027a:	c3                   	ret
+
+000000000080027b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80027b:	55                   	push   %rbp
+  80027c:	48 89 e5             	mov    %rsp,%rbp
+  80027f:	53                   	push   %rbx
+  800280:	48 83 ec 08          	sub    $0x8,%rsp
+  800284:	89 f8                	mov    %edi,%eax
+  800286:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800289:	48 63 f9             	movslq %ecx,%rdi
+  80028c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80028f:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800294:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800297:	be 00 00 00 00       	mov    $0x0,%esi
+  80029c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002a4:	48 85 c0             	test   %rax,%rax
+  8002a7:	7f 06                	jg     8002af <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002ad:	c9                   	leave
+  8002ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002af:	49 89 c0             	mov    %rax,%r8
+  8002b2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002b7:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  8002be:	00 00 00 
+  8002c1:	be 26 00 00 00       	mov    $0x26,%esi
+  8002c6:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  8002cd:	00 00 00 
+  8002d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d5:	49 b9 f0 1a 80 00 00 	movabs $0x801af0,%r9
+  8002dc:	00 00 00 
+  8002df:	41 ff d1             	call   *%r9
+
+00000000008002e2 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002e2:	55                   	push   %rbp
+  8002e3:	48 89 e5             	mov    %rsp,%rbp
+  8002e6:	53                   	push   %rbx
+  8002e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8002eb:	89 f8                	mov    %edi,%eax
+  8002ed:	49 89 f2             	mov    %rsi,%r10
+  8002f0:	48 89 cf             	mov    %rcx,%rdi
+  8002f3:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002f6:	48 63 da             	movslq %edx,%rbx
+  8002f9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002fc:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800301:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800304:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800307:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800309:	48 85 c0             	test   %rax,%rax
+  80030c:	7f 06                	jg     800314 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80030e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800312:	c9                   	leave
+  800313:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800314:	49 89 c0             	mov    %rax,%r8
+  800317:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80031c:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  800323:	00 00 00 
+  800326:	be 26 00 00 00       	mov    $0x26,%esi
+  80032b:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  800332:	00 00 00 
+  800335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033a:	49 b9 f0 1a 80 00 00 	movabs $0x801af0,%r9
+  800341:	00 00 00 
+  800344:	41 ff d1             	call   *%r9
+
+0000000000800347 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800347:	55                   	push   %rbp
+  800348:	48 89 e5             	mov    %rsp,%rbp
+  80034b:	53                   	push   %rbx
+  80034c:	48 83 ec 08          	sub    $0x8,%rsp
+  800350:	48 89 f1             	mov    %rsi,%rcx
+  800353:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800356:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800359:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80035e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800363:	be 00 00 00 00       	mov    $0x0,%esi
+  800368:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80036e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800370:	48 85 c0             	test   %rax,%rax
+  800373:	7f 06                	jg     80037b <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800375:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800379:	c9                   	leave
+  80037a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80037b:	49 89 c0             	mov    %rax,%r8
+  80037e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800383:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  80038a:	00 00 00 
+  80038d:	be 26 00 00 00       	mov    $0x26,%esi
+  800392:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  800399:	00 00 00 
+  80039c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a1:	49 b9 f0 1a 80 00 00 	movabs $0x801af0,%r9
+  8003a8:	00 00 00 
+  8003ab:	41 ff d1             	call   *%r9
+
+00000000008003ae <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8003ae:	55                   	push   %rbp
+  8003af:	48 89 e5             	mov    %rsp,%rbp
+  8003b2:	53                   	push   %rbx
+  8003b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8003b7:	89 f8                	mov    %edi,%eax
+  8003b9:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8003bc:	48 63 f9             	movslq %ecx,%rdi
+  8003bf:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003c2:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003c7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8003cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003d7:	48 85 c0             	test   %rax,%rax
+  8003da:	7f 06                	jg     8003e2 <sys_region_advise+0x34>
+}
+  8003dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003e0:	c9                   	leave
+  8003e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003e2:	49 89 c0             	mov    %rax,%r8
+  8003e5:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8003ea:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  8003f1:	00 00 00 
+  8003f4:	be 26 00 00 00       	mov    $0x26,%esi
+  8003f9:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  800400:	00 00 00 
+  800403:	b8 00 00 00 00       	mov    $0x0,%eax
+  800408:	49 b9 f0 1a 80 00 00 	movabs $0x801af0,%r9
+  80040f:	00 00 00 
+  800412:	41 ff d1             	call   *%r9
+
+0000000000800415 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  800415:	55                   	push   %rbp
+  800416:	48 89 e5             	mov    %rsp,%rbp
+  800419:	53                   	push   %rbx
+  80041a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80041e:	48 63 ce             	movslq %esi,%rcx
+  800421:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800424:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800429:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80042e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800433:	be 00 00 00 00       	mov    $0x0,%esi
+  800438:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80043e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800440:	48 85 c0             	test   %rax,%rax
+  800443:	7f 06                	jg     80044b <sys_env_set_nice+0x36>
+}
+  800445:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800449:	c9                   	leave
+  80044a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80044b:	49 89 c0             	mov    %rax,%r8
+  80044e:	b9 15 00 00 00       	mov    $0x15,%ecx
+  800453:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  80045a:	00 00 00 
+  80045d:	be 26 00 00 00       	mov    $0x26,%esi
+  800462:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  800469:	00 00 00 
+  80046c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800471:	49 b9 f0 1a 80 00 00 	movabs $0x801af0,%r9
+  800478:	00 00 00 
+  80047b:	41 ff d1             	call   *%r9
+
+000000000080047e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80047e:	55                   	push   %rbp
+  80047f:	48 89 e5             	mov    %rsp,%rbp
+  800482:	53                   	push   %rbx
+  800483:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800487:	48 63 ce             	movslq %esi,%rcx
+  80048a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80048d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800492:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800497:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80049c:	be 00 00 00 00       	mov    $0x0,%esi
+  8004a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004a7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004a9:	48 85 c0             	test   %rax,%rax
+  8004ac:	7f 06                	jg     8004b4 <sys_env_set_status+0x36>
+}
+  8004ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004b2:	c9                   	leave
+  8004b3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004b4:	49 89 c0             	mov    %rax,%r8
+  8004b7:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004bc:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  8004c3:	00 00 00 
+  8004c6:	be 26 00 00 00       	mov    $0x26,%esi
+  8004cb:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  8004d2:	00 00 00 
+  8004d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004da:	49 b9 f0 1a 80 00 00 	movabs $0x801af0,%r9
+  8004e1:	00 00 00 
+  8004e4:	41 ff d1             	call   *%r9
+
+00000000008004e7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8004e7:	55                   	push   %rbp
+  8004e8:	48 89 e5             	mov    %rsp,%rbp
+  8004eb:	53                   	push   %rbx
+  8004ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8004f0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8004f3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004f6:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800500:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800505:	be 00 00 00 00       	mov    $0x0,%esi
+  80050a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800510:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800512:	48 85 c0             	test   %rax,%rax
+  800515:	7f 06                	jg     80051d <sys_env_set_trapframe+0x36>
+}
+  800517:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80051b:	c9                   	leave
+  80051c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80051d:	49 89 c0             	mov    %rax,%r8
+  800520:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800525:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  80052c:	00 00 00 
+  80052f:	be 26 00 00 00       	mov    $0x26,%esi
+  800534:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  80053b:	00 00 00 
+  80053e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800543:	49 b9 f0 1a 80 00 00 	movabs $0x801af0,%r9
+  80054a:	00 00 00 
+  80054d:	41 ff d1             	call   *%r9
+
+0000000000800550 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800550:	55                   	push   %rbp
+  800551:	48 89 e5             	mov    %rsp,%rbp
+  800554:	53                   	push   %rbx
+  800555:	48 83 ec 08          	sub    $0x8,%rsp
+  800559:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80055c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80055f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800564:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800569:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80056e:	be 00 00 00 00       	mov    $0x0,%esi
+  800573:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800579:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80057b:	48 85 c0             	test   %rax,%rax
+  80057e:	7f 06                	jg     800586 <sys_env_set_pgfault_upcall+0x36>
+}
+  800580:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800584:	c9                   	leave
+  800585:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800586:	49 89 c0             	mov    %rax,%r8
+  800589:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80058e:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  800595:	00 00 00 
+  800598:	be 26 00 00 00       	mov    $0x26,%esi
+  80059d:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  8005a4:	00 00 00 
+  8005a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ac:	49 b9 f0 1a 80 00 00 	movabs $0x801af0,%r9
+  8005b3:	00 00 00 
+  8005b6:	41 ff d1             	call   *%r9
+
+00000000008005b9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8005b9:	55                   	push   %rbp
+  8005ba:	48 89 e5             	mov    %rsp,%rbp
+  8005bd:	53                   	push   %rbx
+  8005be:	89 f8                	mov    %edi,%eax
+  8005c0:	49 89 f1             	mov    %rsi,%r9
+  8005c3:	48 89 d3             	mov    %rdx,%rbx
+  8005c6:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8005c9:	49 63 f0             	movslq %r8d,%rsi
+  8005cc:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005cf:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8005d4:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005dd:	cd 30                	int    $0x30
+}
+  8005df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005e3:	c9                   	leave
+  8005e4:	c3                   	ret
+
+00000000008005e5 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8005e5:	55                   	push   %rbp
+  8005e6:	48 89 e5             	mov    %rsp,%rbp
+  8005e9:	53                   	push   %rbx
+  8005ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8005ee:	48 89 fa             	mov    %rdi,%rdx
+  8005f1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8005f4:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800603:	be 00 00 00 00       	mov    $0x0,%esi
+  800608:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80060e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800610:	48 85 c0             	test   %rax,%rax
+  800613:	7f 06                	jg     80061b <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800615:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800619:	c9                   	leave
+  80061a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80061b:	49 89 c0             	mov    %rax,%r8
+  80061e:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800623:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  80062a:	00 00 00 
+  80062d:	be 26 00 00 00       	mov    $0x26,%esi
+  800632:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  800639:	00 00 00 
+  80063c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800641:	49 b9 f0 1a 80 00 00 	movabs $0x801af0,%r9
+  800648:	00 00 00 
+  80064b:	41 ff d1             	call   *%r9
+
+000000000080064e <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80064e:	55                   	push   %rbp
+  80064f:	48 89 e5             	mov    %rsp,%rbp
+  800652:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800653:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800658:	ba 00 00 00 00       	mov    $0x0,%edx
+  80065d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800662:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800667:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80066c:	be 00 00 00 00       	mov    $0x0,%esi
+  800671:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800677:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800679:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80067d:	c9                   	leave
+  80067e:	c3                   	ret
+
+000000000080067f <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80067f:	55                   	push   %rbp
+  800680:	48 89 e5             	mov    %rsp,%rbp
+  800683:	53                   	push   %rbx
+  800684:	48 83 ec 08          	sub    $0x8,%rsp
+  800688:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  80068b:	48 63 ce             	movslq %esi,%rcx
+  80068e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800691:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800696:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80069b:	be 00 00 00 00       	mov    $0x0,%esi
+  8006a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006a6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8006a8:	48 85 c0             	test   %rax,%rax
+  8006ab:	7f 06                	jg     8006b3 <sys_sigqueue+0x34>
+}
+  8006ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006b1:	c9                   	leave
+  8006b2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006b3:	49 89 c0             	mov    %rax,%r8
+  8006b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8006bb:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  8006c2:	00 00 00 
+  8006c5:	be 26 00 00 00       	mov    $0x26,%esi
+  8006ca:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  8006d1:	00 00 00 
+  8006d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d9:	49 b9 f0 1a 80 00 00 	movabs $0x801af0,%r9
+  8006e0:	00 00 00 
+  8006e3:	41 ff d1             	call   *%r9
+
+00000000008006e6 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8006e6:	55                   	push   %rbp
+  8006e7:	48 89 e5             	mov    %rsp,%rbp
+  8006ea:	53                   	push   %rbx
+  8006eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8006ef:	48 89 fa             	mov    %rdi,%rdx
+  8006f2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8006f5:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800704:	be 00 00 00 00       	mov    $0x0,%esi
+  800709:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80070f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800711:	48 85 c0             	test   %rax,%rax
+  800714:	7f 06                	jg     80071c <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  800716:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80071a:	c9                   	leave
+  80071b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80071c:	49 89 c0             	mov    %rax,%r8
+  80071f:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800724:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  80072b:	00 00 00 
+  80072e:	be 26 00 00 00       	mov    $0x26,%esi
+  800733:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  80073a:	00 00 00 
+  80073d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800742:	49 b9 f0 1a 80 00 00 	movabs $0x801af0,%r9
+  800749:	00 00 00 
+  80074c:	41 ff d1             	call   *%r9
+
+000000000080074f <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80074f:	55                   	push   %rbp
+  800750:	48 89 e5             	mov    %rsp,%rbp
+  800753:	53                   	push   %rbx
+  800754:	48 83 ec 08          	sub    $0x8,%rsp
+  800758:	48 89 f1             	mov    %rsi,%rcx
+  80075b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80075e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800761:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800766:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80076b:	be 00 00 00 00       	mov    $0x0,%esi
+  800770:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800776:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800778:	48 85 c0             	test   %rax,%rax
+  80077b:	7f 06                	jg     800783 <sys_sigaction+0x34>
+}
+  80077d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800781:	c9                   	leave
+  800782:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800783:	49 89 c0             	mov    %rax,%r8
+  800786:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80078b:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  800792:	00 00 00 
+  800795:	be 26 00 00 00       	mov    $0x26,%esi
+  80079a:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  8007a1:	00 00 00 
+  8007a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a9:	49 b9 f0 1a 80 00 00 	movabs $0x801af0,%r9
+  8007b0:	00 00 00 
+  8007b3:	41 ff d1             	call   *%r9
+
+00000000008007b6 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8007b6:	55                   	push   %rbp
+  8007b7:	48 89 e5             	mov    %rsp,%rbp
+  8007ba:	53                   	push   %rbx
+  8007bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8007bf:	48 89 f1             	mov    %rsi,%rcx
+  8007c2:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8007c5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8007c8:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8007cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8007d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8007d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8007dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8007df:	48 85 c0             	test   %rax,%rax
+  8007e2:	7f 06                	jg     8007ea <sys_sigprocmask+0x34>
+}
+  8007e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007e8:	c9                   	leave
+  8007e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007ea:	49 89 c0             	mov    %rax,%r8
+  8007ed:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8007f2:	48 ba 28 2b 80 00 00 	movabs $0x802b28,%rdx
+  8007f9:	00 00 00 
+  8007fc:	be 26 00 00 00       	mov    $0x26,%esi
+  800801:	48 bf 47 2b 80 00 00 	movabs $0x802b47,%rdi
+  800808:	00 00 00 
+  80080b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800810:	49 b9 f0 1a 80 00 00 	movabs $0x801af0,%r9
+  800817:	00 00 00 
+  80081a:	41 ff d1             	call   *%r9
+
+000000000080081d <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80081d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800824:	ff ff ff 
+  800827:	48 01 f8             	add    %rdi,%rax
+  80082a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80082e:	c3                   	ret
+
+000000000080082f <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80082f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800836:	ff ff ff 
+  800839:	48 01 f8             	add    %rdi,%rax
+  80083c:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800840:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800846:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80084a:	c3                   	ret
+
+000000000080084b <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80084b:	55                   	push   %rbp
+  80084c:	48 89 e5             	mov    %rsp,%rbp
+  80084f:	41 57                	push   %r15
+  800851:	41 56                	push   %r14
+  800853:	41 55                	push   %r13
+  800855:	41 54                	push   %r12
+  800857:	53                   	push   %rbx
+  800858:	48 83 ec 08          	sub    $0x8,%rsp
+  80085c:	49 89 ff             	mov    %rdi,%r15
+  80085f:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800864:	49 bd c9 17 80 00 00 	movabs $0x8017c9,%r13
+  80086b:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80086e:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800874:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800877:	48 89 df             	mov    %rbx,%rdi
+  80087a:	41 ff d5             	call   *%r13
+  80087d:	83 e0 04             	and    $0x4,%eax
+  800880:	74 17                	je     800899 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800882:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800889:	4c 39 f3             	cmp    %r14,%rbx
+  80088c:	75 e6                	jne    800874 <fd_alloc+0x29>
+  80088e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800894:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800899:	4d 89 27             	mov    %r12,(%r15)
+}
+  80089c:	48 83 c4 08          	add    $0x8,%rsp
+  8008a0:	5b                   	pop    %rbx
+  8008a1:	41 5c                	pop    %r12
+  8008a3:	41 5d                	pop    %r13
+  8008a5:	41 5e                	pop    %r14
+  8008a7:	41 5f                	pop    %r15
+  8008a9:	5d                   	pop    %rbp
+  8008aa:	c3                   	ret
+
+00000000008008ab <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8008ab:	83 ff 1f             	cmp    $0x1f,%edi
+  8008ae:	77 39                	ja     8008e9 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8008b0:	55                   	push   %rbp
+  8008b1:	48 89 e5             	mov    %rsp,%rbp
+  8008b4:	41 54                	push   %r12
+  8008b6:	53                   	push   %rbx
+  8008b7:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8008ba:	48 63 df             	movslq %edi,%rbx
+  8008bd:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8008c4:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8008c8:	48 89 df             	mov    %rbx,%rdi
+  8008cb:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  8008d2:	00 00 00 
+  8008d5:	ff d0                	call   *%rax
+  8008d7:	a8 04                	test   $0x4,%al
+  8008d9:	74 14                	je     8008ef <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8008db:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8008df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008e4:	5b                   	pop    %rbx
+  8008e5:	41 5c                	pop    %r12
+  8008e7:	5d                   	pop    %rbp
+  8008e8:	c3                   	ret
+        return -E_INVAL;
+  8008e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8008ee:	c3                   	ret
+        return -E_INVAL;
+  8008ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008f4:	eb ee                	jmp    8008e4 <fd_lookup+0x39>
+
+00000000008008f6 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8008f6:	55                   	push   %rbp
+  8008f7:	48 89 e5             	mov    %rsp,%rbp
+  8008fa:	41 54                	push   %r12
+  8008fc:	53                   	push   %rbx
+  8008fd:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800900:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  800907:	00 00 00 
+  80090a:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  800911:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800914:	39 3b                	cmp    %edi,(%rbx)
+  800916:	74 47                	je     80095f <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800918:	48 83 c0 08          	add    $0x8,%rax
+  80091c:	48 8b 18             	mov    (%rax),%rbx
+  80091f:	48 85 db             	test   %rbx,%rbx
+  800922:	75 f0                	jne    800914 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800924:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80092b:	00 00 00 
+  80092e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800934:	89 fa                	mov    %edi,%edx
+  800936:	48 bf 58 2b 80 00 00 	movabs $0x802b58,%rdi
+  80093d:	00 00 00 
+  800940:	b8 00 00 00 00       	mov    $0x0,%eax
+  800945:	48 b9 40 1c 80 00 00 	movabs $0x801c40,%rcx
+  80094c:	00 00 00 
+  80094f:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800951:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800956:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80095a:	5b                   	pop    %rbx
+  80095b:	41 5c                	pop    %r12
+  80095d:	5d                   	pop    %rbp
+  80095e:	c3                   	ret
+            return 0;
+  80095f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800964:	eb f0                	jmp    800956 <dev_lookup+0x60>
+
+0000000000800966 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800966:	55                   	push   %rbp
+  800967:	48 89 e5             	mov    %rsp,%rbp
+  80096a:	41 55                	push   %r13
+  80096c:	41 54                	push   %r12
+  80096e:	53                   	push   %rbx
+  80096f:	48 83 ec 18          	sub    $0x18,%rsp
+  800973:	48 89 fb             	mov    %rdi,%rbx
+  800976:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800979:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800980:	ff ff ff 
+  800983:	48 01 df             	add    %rbx,%rdi
+  800986:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80098a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80098e:	48 b8 ab 08 80 00 00 	movabs $0x8008ab,%rax
+  800995:	00 00 00 
+  800998:	ff d0                	call   *%rax
+  80099a:	41 89 c5             	mov    %eax,%r13d
+  80099d:	85 c0                	test   %eax,%eax
+  80099f:	78 06                	js     8009a7 <fd_close+0x41>
+  8009a1:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8009a5:	74 1a                	je     8009c1 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8009a7:	45 84 e4             	test   %r12b,%r12b
+  8009aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009af:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8009b3:	44 89 e8             	mov    %r13d,%eax
+  8009b6:	48 83 c4 18          	add    $0x18,%rsp
+  8009ba:	5b                   	pop    %rbx
+  8009bb:	41 5c                	pop    %r12
+  8009bd:	41 5d                	pop    %r13
+  8009bf:	5d                   	pop    %rbp
+  8009c0:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8009c1:	8b 3b                	mov    (%rbx),%edi
+  8009c3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8009c7:	48 b8 f6 08 80 00 00 	movabs $0x8008f6,%rax
+  8009ce:	00 00 00 
+  8009d1:	ff d0                	call   *%rax
+  8009d3:	41 89 c5             	mov    %eax,%r13d
+  8009d6:	85 c0                	test   %eax,%eax
+  8009d8:	78 1b                	js     8009f5 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8009da:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8009de:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8009e2:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8009e8:	48 85 c0             	test   %rax,%rax
+  8009eb:	74 08                	je     8009f5 <fd_close+0x8f>
+  8009ed:	48 89 df             	mov    %rbx,%rdi
+  8009f0:	ff d0                	call   *%rax
+  8009f2:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8009f5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009fa:	48 89 de             	mov    %rbx,%rsi
+  8009fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a02:	48 b8 47 03 80 00 00 	movabs $0x800347,%rax
+  800a09:	00 00 00 
+  800a0c:	ff d0                	call   *%rax
+    return res;
+  800a0e:	eb a3                	jmp    8009b3 <fd_close+0x4d>
+
+0000000000800a10 <close>:
+
+int
+close(int fdnum) {
+  800a10:	55                   	push   %rbp
+  800a11:	48 89 e5             	mov    %rsp,%rbp
+  800a14:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800a18:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800a1c:	48 b8 ab 08 80 00 00 	movabs $0x8008ab,%rax
+  800a23:	00 00 00 
+  800a26:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800a28:	85 c0                	test   %eax,%eax
+  800a2a:	78 15                	js     800a41 <close+0x31>
+
+    return fd_close(fd, 1);
+  800a2c:	be 01 00 00 00       	mov    $0x1,%esi
+  800a31:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800a35:	48 b8 66 09 80 00 00 	movabs $0x800966,%rax
+  800a3c:	00 00 00 
+  800a3f:	ff d0                	call   *%rax
+}
+  800a41:	c9                   	leave
+  800a42:	c3                   	ret
+
+0000000000800a43 <close_all>:
+
+void
+close_all(void) {
+  800a43:	55                   	push   %rbp
+  800a44:	48 89 e5             	mov    %rsp,%rbp
+  800a47:	41 54                	push   %r12
+  800a49:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800a4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a4f:	49 bc 10 0a 80 00 00 	movabs $0x800a10,%r12
+  800a56:	00 00 00 
+  800a59:	89 df                	mov    %ebx,%edi
+  800a5b:	41 ff d4             	call   *%r12
+  800a5e:	83 c3 01             	add    $0x1,%ebx
+  800a61:	83 fb 20             	cmp    $0x20,%ebx
+  800a64:	75 f3                	jne    800a59 <close_all+0x16>
+}
+  800a66:	5b                   	pop    %rbx
+  800a67:	41 5c                	pop    %r12
+  800a69:	5d                   	pop    %rbp
+  800a6a:	c3                   	ret
+
+0000000000800a6b <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800a6b:	55                   	push   %rbp
+  800a6c:	48 89 e5             	mov    %rsp,%rbp
+  800a6f:	41 57                	push   %r15
+  800a71:	41 56                	push   %r14
+  800a73:	41 55                	push   %r13
+  800a75:	41 54                	push   %r12
+  800a77:	53                   	push   %rbx
+  800a78:	48 83 ec 18          	sub    $0x18,%rsp
+  800a7c:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800a7f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800a83:	48 b8 ab 08 80 00 00 	movabs $0x8008ab,%rax
+  800a8a:	00 00 00 
+  800a8d:	ff d0                	call   *%rax
+  800a8f:	89 c3                	mov    %eax,%ebx
+  800a91:	85 c0                	test   %eax,%eax
+  800a93:	0f 88 b8 00 00 00    	js     800b51 <dup+0xe6>
+    close(newfdnum);
+  800a99:	44 89 e7             	mov    %r12d,%edi
+  800a9c:	48 b8 10 0a 80 00 00 	movabs $0x800a10,%rax
+  800aa3:	00 00 00 
+  800aa6:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800aa8:	4d 63 ec             	movslq %r12d,%r13
+  800aab:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800ab2:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800ab6:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800aba:	4c 89 ff             	mov    %r15,%rdi
+  800abd:	49 be 2f 08 80 00 00 	movabs $0x80082f,%r14
+  800ac4:	00 00 00 
+  800ac7:	41 ff d6             	call   *%r14
+  800aca:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800acd:	4c 89 ef             	mov    %r13,%rdi
+  800ad0:	41 ff d6             	call   *%r14
+  800ad3:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800ad6:	48 89 df             	mov    %rbx,%rdi
+  800ad9:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  800ae0:	00 00 00 
+  800ae3:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800ae5:	a8 04                	test   $0x4,%al
+  800ae7:	74 2b                	je     800b14 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800ae9:	41 89 c1             	mov    %eax,%r9d
+  800aec:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800af2:	4c 89 f1             	mov    %r14,%rcx
+  800af5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800afa:	48 89 de             	mov    %rbx,%rsi
+  800afd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b02:	48 b8 e2 02 80 00 00 	movabs $0x8002e2,%rax
+  800b09:	00 00 00 
+  800b0c:	ff d0                	call   *%rax
+  800b0e:	89 c3                	mov    %eax,%ebx
+  800b10:	85 c0                	test   %eax,%eax
+  800b12:	78 4e                	js     800b62 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800b14:	4c 89 ff             	mov    %r15,%rdi
+  800b17:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  800b1e:	00 00 00 
+  800b21:	ff d0                	call   *%rax
+  800b23:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800b26:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800b2c:	4c 89 e9             	mov    %r13,%rcx
+  800b2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b34:	4c 89 fe             	mov    %r15,%rsi
+  800b37:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b3c:	48 b8 e2 02 80 00 00 	movabs $0x8002e2,%rax
+  800b43:	00 00 00 
+  800b46:	ff d0                	call   *%rax
+  800b48:	89 c3                	mov    %eax,%ebx
+  800b4a:	85 c0                	test   %eax,%eax
+  800b4c:	78 14                	js     800b62 <dup+0xf7>
+
+    return newfdnum;
+  800b4e:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800b51:	89 d8                	mov    %ebx,%eax
+  800b53:	48 83 c4 18          	add    $0x18,%rsp
+  800b57:	5b                   	pop    %rbx
+  800b58:	41 5c                	pop    %r12
+  800b5a:	41 5d                	pop    %r13
+  800b5c:	41 5e                	pop    %r14
+  800b5e:	41 5f                	pop    %r15
+  800b60:	5d                   	pop    %rbp
+  800b61:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800b62:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b67:	4c 89 ee             	mov    %r13,%rsi
+  800b6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b6f:	49 bc 47 03 80 00 00 	movabs $0x800347,%r12
+  800b76:	00 00 00 
+  800b79:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800b7c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800b81:	4c 89 f6             	mov    %r14,%rsi
+  800b84:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b89:	41 ff d4             	call   *%r12
+    return res;
+  800b8c:	eb c3                	jmp    800b51 <dup+0xe6>
+
+0000000000800b8e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800b8e:	55                   	push   %rbp
+  800b8f:	48 89 e5             	mov    %rsp,%rbp
+  800b92:	41 56                	push   %r14
+  800b94:	41 55                	push   %r13
+  800b96:	41 54                	push   %r12
+  800b98:	53                   	push   %rbx
+  800b99:	48 83 ec 10          	sub    $0x10,%rsp
+  800b9d:	89 fb                	mov    %edi,%ebx
+  800b9f:	49 89 f4             	mov    %rsi,%r12
+  800ba2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ba5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ba9:	48 b8 ab 08 80 00 00 	movabs $0x8008ab,%rax
+  800bb0:	00 00 00 
+  800bb3:	ff d0                	call   *%rax
+  800bb5:	85 c0                	test   %eax,%eax
+  800bb7:	78 4c                	js     800c05 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bb9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bbd:	41 8b 3e             	mov    (%r14),%edi
+  800bc0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bc4:	48 b8 f6 08 80 00 00 	movabs $0x8008f6,%rax
+  800bcb:	00 00 00 
+  800bce:	ff d0                	call   *%rax
+  800bd0:	85 c0                	test   %eax,%eax
+  800bd2:	78 35                	js     800c09 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800bd4:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800bd8:	83 e0 03             	and    $0x3,%eax
+  800bdb:	83 f8 01             	cmp    $0x1,%eax
+  800bde:	74 2d                	je     800c0d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800be0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800be4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800be8:	48 85 c0             	test   %rax,%rax
+  800beb:	74 56                	je     800c43 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800bed:	4c 89 ea             	mov    %r13,%rdx
+  800bf0:	4c 89 e6             	mov    %r12,%rsi
+  800bf3:	4c 89 f7             	mov    %r14,%rdi
+  800bf6:	ff d0                	call   *%rax
+}
+  800bf8:	48 83 c4 10          	add    $0x10,%rsp
+  800bfc:	5b                   	pop    %rbx
+  800bfd:	41 5c                	pop    %r12
+  800bff:	41 5d                	pop    %r13
+  800c01:	41 5e                	pop    %r14
+  800c03:	5d                   	pop    %rbp
+  800c04:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c05:	48 98                	cltq
+  800c07:	eb ef                	jmp    800bf8 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c09:	48 98                	cltq
+  800c0b:	eb eb                	jmp    800bf8 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c0d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c14:	00 00 00 
+  800c17:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c1d:	89 da                	mov    %ebx,%edx
+  800c1f:	48 bf 99 2b 80 00 00 	movabs $0x802b99,%rdi
+  800c26:	00 00 00 
+  800c29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2e:	48 b9 40 1c 80 00 00 	movabs $0x801c40,%rcx
+  800c35:	00 00 00 
+  800c38:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c3a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c41:	eb b5                	jmp    800bf8 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800c43:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c4a:	eb ac                	jmp    800bf8 <read+0x6a>
+
+0000000000800c4c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800c4c:	55                   	push   %rbp
+  800c4d:	48 89 e5             	mov    %rsp,%rbp
+  800c50:	41 57                	push   %r15
+  800c52:	41 56                	push   %r14
+  800c54:	41 55                	push   %r13
+  800c56:	41 54                	push   %r12
+  800c58:	53                   	push   %rbx
+  800c59:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800c5d:	48 85 d2             	test   %rdx,%rdx
+  800c60:	74 54                	je     800cb6 <readn+0x6a>
+  800c62:	41 89 fd             	mov    %edi,%r13d
+  800c65:	49 89 f6             	mov    %rsi,%r14
+  800c68:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800c6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800c70:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800c75:	49 bf 8e 0b 80 00 00 	movabs $0x800b8e,%r15
+  800c7c:	00 00 00 
+  800c7f:	4c 89 e2             	mov    %r12,%rdx
+  800c82:	48 29 f2             	sub    %rsi,%rdx
+  800c85:	4c 01 f6             	add    %r14,%rsi
+  800c88:	44 89 ef             	mov    %r13d,%edi
+  800c8b:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800c8e:	85 c0                	test   %eax,%eax
+  800c90:	78 20                	js     800cb2 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800c92:	01 c3                	add    %eax,%ebx
+  800c94:	85 c0                	test   %eax,%eax
+  800c96:	74 08                	je     800ca0 <readn+0x54>
+  800c98:	48 63 f3             	movslq %ebx,%rsi
+  800c9b:	4c 39 e6             	cmp    %r12,%rsi
+  800c9e:	72 df                	jb     800c7f <readn+0x33>
+    }
+    return res;
+  800ca0:	48 63 c3             	movslq %ebx,%rax
+}
+  800ca3:	48 83 c4 08          	add    $0x8,%rsp
+  800ca7:	5b                   	pop    %rbx
+  800ca8:	41 5c                	pop    %r12
+  800caa:	41 5d                	pop    %r13
+  800cac:	41 5e                	pop    %r14
+  800cae:	41 5f                	pop    %r15
+  800cb0:	5d                   	pop    %rbp
+  800cb1:	c3                   	ret
+        if (inc < 0) return inc;
+  800cb2:	48 98                	cltq
+  800cb4:	eb ed                	jmp    800ca3 <readn+0x57>
+    int inc = 1, res = 0;
+  800cb6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cbb:	eb e3                	jmp    800ca0 <readn+0x54>
+
+0000000000800cbd <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800cbd:	55                   	push   %rbp
+  800cbe:	48 89 e5             	mov    %rsp,%rbp
+  800cc1:	41 56                	push   %r14
+  800cc3:	41 55                	push   %r13
+  800cc5:	41 54                	push   %r12
+  800cc7:	53                   	push   %rbx
+  800cc8:	48 83 ec 10          	sub    $0x10,%rsp
+  800ccc:	89 fb                	mov    %edi,%ebx
+  800cce:	49 89 f4             	mov    %rsi,%r12
+  800cd1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cd4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cd8:	48 b8 ab 08 80 00 00 	movabs $0x8008ab,%rax
+  800cdf:	00 00 00 
+  800ce2:	ff d0                	call   *%rax
+  800ce4:	85 c0                	test   %eax,%eax
+  800ce6:	78 47                	js     800d2f <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ce8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800cec:	41 8b 3e             	mov    (%r14),%edi
+  800cef:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cf3:	48 b8 f6 08 80 00 00 	movabs $0x8008f6,%rax
+  800cfa:	00 00 00 
+  800cfd:	ff d0                	call   *%rax
+  800cff:	85 c0                	test   %eax,%eax
+  800d01:	78 30                	js     800d33 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d03:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800d08:	74 2d                	je     800d37 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d0a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d0e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800d12:	48 85 c0             	test   %rax,%rax
+  800d15:	74 56                	je     800d6d <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800d17:	4c 89 ea             	mov    %r13,%rdx
+  800d1a:	4c 89 e6             	mov    %r12,%rsi
+  800d1d:	4c 89 f7             	mov    %r14,%rdi
+  800d20:	ff d0                	call   *%rax
+}
+  800d22:	48 83 c4 10          	add    $0x10,%rsp
+  800d26:	5b                   	pop    %rbx
+  800d27:	41 5c                	pop    %r12
+  800d29:	41 5d                	pop    %r13
+  800d2b:	41 5e                	pop    %r14
+  800d2d:	5d                   	pop    %rbp
+  800d2e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d2f:	48 98                	cltq
+  800d31:	eb ef                	jmp    800d22 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d33:	48 98                	cltq
+  800d35:	eb eb                	jmp    800d22 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800d37:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d3e:	00 00 00 
+  800d41:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800d47:	89 da                	mov    %ebx,%edx
+  800d49:	48 bf b5 2b 80 00 00 	movabs $0x802bb5,%rdi
+  800d50:	00 00 00 
+  800d53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d58:	48 b9 40 1c 80 00 00 	movabs $0x801c40,%rcx
+  800d5f:	00 00 00 
+  800d62:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d64:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800d6b:	eb b5                	jmp    800d22 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800d6d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800d74:	eb ac                	jmp    800d22 <write+0x65>
+
+0000000000800d76 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800d76:	55                   	push   %rbp
+  800d77:	48 89 e5             	mov    %rsp,%rbp
+  800d7a:	53                   	push   %rbx
+  800d7b:	48 83 ec 18          	sub    $0x18,%rsp
+  800d7f:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d81:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d85:	48 b8 ab 08 80 00 00 	movabs $0x8008ab,%rax
+  800d8c:	00 00 00 
+  800d8f:	ff d0                	call   *%rax
+  800d91:	85 c0                	test   %eax,%eax
+  800d93:	78 0c                	js     800da1 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800d95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d99:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800da1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800da5:	c9                   	leave
+  800da6:	c3                   	ret
+
+0000000000800da7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800da7:	55                   	push   %rbp
+  800da8:	48 89 e5             	mov    %rsp,%rbp
+  800dab:	41 55                	push   %r13
+  800dad:	41 54                	push   %r12
+  800daf:	53                   	push   %rbx
+  800db0:	48 83 ec 18          	sub    $0x18,%rsp
+  800db4:	89 fb                	mov    %edi,%ebx
+  800db6:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800db9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800dbd:	48 b8 ab 08 80 00 00 	movabs $0x8008ab,%rax
+  800dc4:	00 00 00 
+  800dc7:	ff d0                	call   *%rax
+  800dc9:	85 c0                	test   %eax,%eax
+  800dcb:	78 38                	js     800e05 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800dcd:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800dd1:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800dd5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800dd9:	48 b8 f6 08 80 00 00 	movabs $0x8008f6,%rax
+  800de0:	00 00 00 
+  800de3:	ff d0                	call   *%rax
+  800de5:	85 c0                	test   %eax,%eax
+  800de7:	78 1c                	js     800e05 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800de9:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800dee:	74 20                	je     800e10 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800df0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800df4:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800df8:	48 85 c0             	test   %rax,%rax
+  800dfb:	74 47                	je     800e44 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800dfd:	44 89 e6             	mov    %r12d,%esi
+  800e00:	4c 89 ef             	mov    %r13,%rdi
+  800e03:	ff d0                	call   *%rax
+}
+  800e05:	48 83 c4 18          	add    $0x18,%rsp
+  800e09:	5b                   	pop    %rbx
+  800e0a:	41 5c                	pop    %r12
+  800e0c:	41 5d                	pop    %r13
+  800e0e:	5d                   	pop    %rbp
+  800e0f:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800e10:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800e17:	00 00 00 
+  800e1a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800e20:	89 da                	mov    %ebx,%edx
+  800e22:	48 bf 78 2b 80 00 00 	movabs $0x802b78,%rdi
+  800e29:	00 00 00 
+  800e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e31:	48 b9 40 1c 80 00 00 	movabs $0x801c40,%rcx
+  800e38:	00 00 00 
+  800e3b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800e3d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e42:	eb c1                	jmp    800e05 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800e44:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e49:	eb ba                	jmp    800e05 <ftruncate+0x5e>
+
+0000000000800e4b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800e4b:	55                   	push   %rbp
+  800e4c:	48 89 e5             	mov    %rsp,%rbp
+  800e4f:	41 54                	push   %r12
+  800e51:	53                   	push   %rbx
+  800e52:	48 83 ec 10          	sub    $0x10,%rsp
+  800e56:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800e59:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e5d:	48 b8 ab 08 80 00 00 	movabs $0x8008ab,%rax
+  800e64:	00 00 00 
+  800e67:	ff d0                	call   *%rax
+  800e69:	85 c0                	test   %eax,%eax
+  800e6b:	78 4e                	js     800ebb <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800e6d:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800e71:	41 8b 3c 24          	mov    (%r12),%edi
+  800e75:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800e79:	48 b8 f6 08 80 00 00 	movabs $0x8008f6,%rax
+  800e80:	00 00 00 
+  800e83:	ff d0                	call   *%rax
+  800e85:	85 c0                	test   %eax,%eax
+  800e87:	78 32                	js     800ebb <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800e89:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e8d:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800e92:	74 30                	je     800ec4 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800e94:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800e97:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800e9e:	00 00 00 
+    stat->st_isdir = 0;
+  800ea1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800ea8:	00 00 00 
+    stat->st_dev = dev;
+  800eab:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800eb2:	48 89 de             	mov    %rbx,%rsi
+  800eb5:	4c 89 e7             	mov    %r12,%rdi
+  800eb8:	ff 50 28             	call   *0x28(%rax)
+}
+  800ebb:	48 83 c4 10          	add    $0x10,%rsp
+  800ebf:	5b                   	pop    %rbx
+  800ec0:	41 5c                	pop    %r12
+  800ec2:	5d                   	pop    %rbp
+  800ec3:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800ec4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ec9:	eb f0                	jmp    800ebb <fstat+0x70>
+
+0000000000800ecb <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800ecb:	55                   	push   %rbp
+  800ecc:	48 89 e5             	mov    %rsp,%rbp
+  800ecf:	41 54                	push   %r12
+  800ed1:	53                   	push   %rbx
+  800ed2:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800ed5:	be 00 00 00 00       	mov    $0x0,%esi
+  800eda:	48 b8 4c 11 80 00 00 	movabs $0x80114c,%rax
+  800ee1:	00 00 00 
+  800ee4:	ff d0                	call   *%rax
+  800ee6:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800ee8:	85 c0                	test   %eax,%eax
+  800eea:	78 25                	js     800f11 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800eec:	4c 89 e6             	mov    %r12,%rsi
+  800eef:	89 c7                	mov    %eax,%edi
+  800ef1:	48 b8 4b 0e 80 00 00 	movabs $0x800e4b,%rax
+  800ef8:	00 00 00 
+  800efb:	ff d0                	call   *%rax
+  800efd:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800f00:	89 df                	mov    %ebx,%edi
+  800f02:	48 b8 10 0a 80 00 00 	movabs $0x800a10,%rax
+  800f09:	00 00 00 
+  800f0c:	ff d0                	call   *%rax
+
+    return res;
+  800f0e:	44 89 e3             	mov    %r12d,%ebx
+}
+  800f11:	89 d8                	mov    %ebx,%eax
+  800f13:	5b                   	pop    %rbx
+  800f14:	41 5c                	pop    %r12
+  800f16:	5d                   	pop    %rbp
+  800f17:	c3                   	ret
+
+0000000000800f18 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800f18:	55                   	push   %rbp
+  800f19:	48 89 e5             	mov    %rsp,%rbp
+  800f1c:	41 54                	push   %r12
+  800f1e:	53                   	push   %rbx
+  800f1f:	48 83 ec 10          	sub    $0x10,%rsp
+  800f23:	41 89 fc             	mov    %edi,%r12d
+  800f26:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f29:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f30:	00 00 00 
+  800f33:	83 38 00             	cmpl   $0x0,(%rax)
+  800f36:	74 5e                	je     800f96 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800f38:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800f3e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800f43:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800f4a:	00 00 00 
+  800f4d:	44 89 e6             	mov    %r12d,%esi
+  800f50:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f57:	00 00 00 
+  800f5a:	8b 38                	mov    (%rax),%edi
+  800f5c:	48 b8 21 2a 80 00 00 	movabs $0x802a21,%rax
+  800f63:	00 00 00 
+  800f66:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800f68:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800f6f:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800f70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f75:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800f79:	48 89 de             	mov    %rbx,%rsi
+  800f7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f81:	48 b8 8c 29 80 00 00 	movabs $0x80298c,%rax
+  800f88:	00 00 00 
+  800f8b:	ff d0                	call   *%rax
+}
+  800f8d:	48 83 c4 10          	add    $0x10,%rsp
+  800f91:	5b                   	pop    %rbx
+  800f92:	41 5c                	pop    %r12
+  800f94:	5d                   	pop    %rbp
+  800f95:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800f96:	bf 03 00 00 00       	mov    $0x3,%edi
+  800f9b:	48 b8 c1 2a 80 00 00 	movabs $0x802ac1,%rax
+  800fa2:	00 00 00 
+  800fa5:	ff d0                	call   *%rax
+  800fa7:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800fae:	00 00 
+  800fb0:	eb 86                	jmp    800f38 <fsipc+0x20>
+
+0000000000800fb2 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800fb2:	55                   	push   %rbp
+  800fb3:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800fb6:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800fbd:	00 00 00 
+  800fc0:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800fc3:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800fc5:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800fc8:	be 00 00 00 00       	mov    $0x0,%esi
+  800fcd:	bf 02 00 00 00       	mov    $0x2,%edi
+  800fd2:	48 b8 18 0f 80 00 00 	movabs $0x800f18,%rax
+  800fd9:	00 00 00 
+  800fdc:	ff d0                	call   *%rax
+}
+  800fde:	5d                   	pop    %rbp
+  800fdf:	c3                   	ret
+
+0000000000800fe0 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800fe0:	55                   	push   %rbp
+  800fe1:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800fe4:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800fe7:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800fee:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  800ff0:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff5:	bf 06 00 00 00       	mov    $0x6,%edi
+  800ffa:	48 b8 18 0f 80 00 00 	movabs $0x800f18,%rax
+  801001:	00 00 00 
+  801004:	ff d0                	call   *%rax
+}
+  801006:	5d                   	pop    %rbp
+  801007:	c3                   	ret
+
+0000000000801008 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801008:	55                   	push   %rbp
+  801009:	48 89 e5             	mov    %rsp,%rbp
+  80100c:	41 54                	push   %r12
+  80100e:	53                   	push   %rbx
+  80100f:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801012:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801015:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80101c:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80101e:	be 00 00 00 00       	mov    $0x0,%esi
+  801023:	bf 05 00 00 00       	mov    $0x5,%edi
+  801028:	48 b8 18 0f 80 00 00 	movabs $0x800f18,%rax
+  80102f:	00 00 00 
+  801032:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801034:	85 c0                	test   %eax,%eax
+  801036:	78 3d                	js     801075 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801038:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80103f:	00 00 00 
+  801042:	4c 89 e6             	mov    %r12,%rsi
+  801045:	48 89 df             	mov    %rbx,%rdi
+  801048:	48 b8 65 25 80 00 00 	movabs $0x802565,%rax
+  80104f:	00 00 00 
+  801052:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801054:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80105b:	00 
+  80105c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801062:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801069:	00 
+  80106a:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801070:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801075:	5b                   	pop    %rbx
+  801076:	41 5c                	pop    %r12
+  801078:	5d                   	pop    %rbp
+  801079:	c3                   	ret
+
+000000000080107a <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80107a:	55                   	push   %rbp
+  80107b:	48 89 e5             	mov    %rsp,%rbp
+  80107e:	41 54                	push   %r12
+  801080:	53                   	push   %rbx
+  801081:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  801084:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  801089:	48 39 c2             	cmp    %rax,%rdx
+  80108c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801090:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801093:	48 89 c2             	mov    %rax,%rdx
+  801096:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80109d:	00 00 00 
+  8010a0:	48 b8 c6 27 80 00 00 	movabs $0x8027c6,%rax
+  8010a7:	00 00 00 
+  8010aa:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8010ac:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8010b3:	00 00 00 
+  8010b6:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8010bb:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8010bd:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8010c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c6:	bf 04 00 00 00       	mov    $0x4,%edi
+  8010cb:	48 b8 18 0f 80 00 00 	movabs $0x800f18,%rax
+  8010d2:	00 00 00 
+  8010d5:	ff d0                	call   *%rax
+  8010d7:	48 98                	cltq
+}
+  8010d9:	5b                   	pop    %rbx
+  8010da:	41 5c                	pop    %r12
+  8010dc:	5d                   	pop    %rbp
+  8010dd:	c3                   	ret
+
+00000000008010de <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8010de:	55                   	push   %rbp
+  8010df:	48 89 e5             	mov    %rsp,%rbp
+  8010e2:	41 54                	push   %r12
+  8010e4:	53                   	push   %rbx
+  8010e5:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8010e8:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8010ef:	00 00 00 
+  8010f2:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8010f5:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8010f7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8010fc:	48 39 ca             	cmp    %rcx,%rdx
+  8010ff:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  801103:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  801107:	be 00 00 00 00       	mov    $0x0,%esi
+  80110c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801111:	48 b8 18 0f 80 00 00 	movabs $0x800f18,%rax
+  801118:	00 00 00 
+  80111b:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  80111d:	85 c0                	test   %eax,%eax
+  80111f:	78 27                	js     801148 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  801121:	48 63 d8             	movslq %eax,%rbx
+  801124:	48 89 da             	mov    %rbx,%rdx
+  801127:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80112e:	00 00 00 
+  801131:	4c 89 e7             	mov    %r12,%rdi
+  801134:	48 b8 c6 27 80 00 00 	movabs $0x8027c6,%rax
+  80113b:	00 00 00 
+  80113e:	ff d0                	call   *%rax
+    return bytes_read;
+  801140:	48 89 d8             	mov    %rbx,%rax
+}
+  801143:	5b                   	pop    %rbx
+  801144:	41 5c                	pop    %r12
+  801146:	5d                   	pop    %rbp
+  801147:	c3                   	ret
+        return bytes_read;
+  801148:	48 98                	cltq
+  80114a:	eb f7                	jmp    801143 <devfile_read+0x65>
+
+000000000080114c <open>:
+open(const char *path, int mode) {
+  80114c:	55                   	push   %rbp
+  80114d:	48 89 e5             	mov    %rsp,%rbp
+  801150:	41 55                	push   %r13
+  801152:	41 54                	push   %r12
+  801154:	53                   	push   %rbx
+  801155:	48 83 ec 18          	sub    $0x18,%rsp
+  801159:	49 89 fc             	mov    %rdi,%r12
+  80115c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80115f:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  801166:	00 00 00 
+  801169:	ff d0                	call   *%rax
+  80116b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801171:	0f 87 8a 00 00 00    	ja     801201 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801177:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80117b:	48 b8 4b 08 80 00 00 	movabs $0x80084b,%rax
+  801182:	00 00 00 
+  801185:	ff d0                	call   *%rax
+  801187:	89 c3                	mov    %eax,%ebx
+  801189:	85 c0                	test   %eax,%eax
+  80118b:	78 50                	js     8011dd <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80118d:	4c 89 e6             	mov    %r12,%rsi
+  801190:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801197:	00 00 00 
+  80119a:	48 89 df             	mov    %rbx,%rdi
+  80119d:	48 b8 65 25 80 00 00 	movabs $0x802565,%rax
+  8011a4:	00 00 00 
+  8011a7:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011a9:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011b0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8011b4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011b9:	48 b8 18 0f 80 00 00 	movabs $0x800f18,%rax
+  8011c0:	00 00 00 
+  8011c3:	ff d0                	call   *%rax
+  8011c5:	89 c3                	mov    %eax,%ebx
+  8011c7:	85 c0                	test   %eax,%eax
+  8011c9:	78 1f                	js     8011ea <open+0x9e>
+    return fd2num(fd);
+  8011cb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8011cf:	48 b8 1d 08 80 00 00 	movabs $0x80081d,%rax
+  8011d6:	00 00 00 
+  8011d9:	ff d0                	call   *%rax
+  8011db:	89 c3                	mov    %eax,%ebx
+}
+  8011dd:	89 d8                	mov    %ebx,%eax
+  8011df:	48 83 c4 18          	add    $0x18,%rsp
+  8011e3:	5b                   	pop    %rbx
+  8011e4:	41 5c                	pop    %r12
+  8011e6:	41 5d                	pop    %r13
+  8011e8:	5d                   	pop    %rbp
+  8011e9:	c3                   	ret
+        fd_close(fd, 0);
+  8011ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ef:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8011f3:	48 b8 66 09 80 00 00 	movabs $0x800966,%rax
+  8011fa:	00 00 00 
+  8011fd:	ff d0                	call   *%rax
+        return res;
+  8011ff:	eb dc                	jmp    8011dd <open+0x91>
+        return -E_BAD_PATH;
+  801201:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801206:	eb d5                	jmp    8011dd <open+0x91>
+
+0000000000801208 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801208:	55                   	push   %rbp
+  801209:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80120c:	be 00 00 00 00       	mov    $0x0,%esi
+  801211:	bf 08 00 00 00       	mov    $0x8,%edi
+  801216:	48 b8 18 0f 80 00 00 	movabs $0x800f18,%rax
+  80121d:	00 00 00 
+  801220:	ff d0                	call   *%rax
+}
+  801222:	5d                   	pop    %rbp
+  801223:	c3                   	ret
+
+0000000000801224 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801224:	55                   	push   %rbp
+  801225:	48 89 e5             	mov    %rsp,%rbp
+  801228:	41 54                	push   %r12
+  80122a:	53                   	push   %rbx
+  80122b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80122e:	48 b8 2f 08 80 00 00 	movabs $0x80082f,%rax
+  801235:	00 00 00 
+  801238:	ff d0                	call   *%rax
+  80123a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80123d:	48 be 00 2c 80 00 00 	movabs $0x802c00,%rsi
+  801244:	00 00 00 
+  801247:	48 89 df             	mov    %rbx,%rdi
+  80124a:	48 b8 65 25 80 00 00 	movabs $0x802565,%rax
+  801251:	00 00 00 
+  801254:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801256:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80125b:	41 2b 04 24          	sub    (%r12),%eax
+  80125f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801265:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80126c:	00 00 00 
+    stat->st_dev = &devpipe;
+  80126f:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  801276:	00 00 00 
+  801279:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  801280:	b8 00 00 00 00       	mov    $0x0,%eax
+  801285:	5b                   	pop    %rbx
+  801286:	41 5c                	pop    %r12
+  801288:	5d                   	pop    %rbp
+  801289:	c3                   	ret
+
+000000000080128a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80128a:	55                   	push   %rbp
+  80128b:	48 89 e5             	mov    %rsp,%rbp
+  80128e:	41 54                	push   %r12
+  801290:	53                   	push   %rbx
+  801291:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801294:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801299:	48 89 fe             	mov    %rdi,%rsi
+  80129c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012a1:	49 bc 47 03 80 00 00 	movabs $0x800347,%r12
+  8012a8:	00 00 00 
+  8012ab:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012ae:	48 89 df             	mov    %rbx,%rdi
+  8012b1:	48 b8 2f 08 80 00 00 	movabs $0x80082f,%rax
+  8012b8:	00 00 00 
+  8012bb:	ff d0                	call   *%rax
+  8012bd:	48 89 c6             	mov    %rax,%rsi
+  8012c0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012ca:	41 ff d4             	call   *%r12
+}
+  8012cd:	5b                   	pop    %rbx
+  8012ce:	41 5c                	pop    %r12
+  8012d0:	5d                   	pop    %rbp
+  8012d1:	c3                   	ret
+
+00000000008012d2 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8012d2:	55                   	push   %rbp
+  8012d3:	48 89 e5             	mov    %rsp,%rbp
+  8012d6:	41 57                	push   %r15
+  8012d8:	41 56                	push   %r14
+  8012da:	41 55                	push   %r13
+  8012dc:	41 54                	push   %r12
+  8012de:	53                   	push   %rbx
+  8012df:	48 83 ec 18          	sub    $0x18,%rsp
+  8012e3:	49 89 fc             	mov    %rdi,%r12
+  8012e6:	49 89 f5             	mov    %rsi,%r13
+  8012e9:	49 89 d7             	mov    %rdx,%r15
+  8012ec:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8012f0:	48 b8 2f 08 80 00 00 	movabs $0x80082f,%rax
+  8012f7:	00 00 00 
+  8012fa:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8012fc:	4d 85 ff             	test   %r15,%r15
+  8012ff:	0f 84 af 00 00 00    	je     8013b4 <devpipe_write+0xe2>
+  801305:	48 89 c3             	mov    %rax,%rbx
+  801308:	4c 89 f8             	mov    %r15,%rax
+  80130b:	4d 89 ef             	mov    %r13,%r15
+  80130e:	4c 01 e8             	add    %r13,%rax
+  801311:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801315:	49 bd 4f 02 80 00 00 	movabs $0x80024f,%r13
+  80131c:	00 00 00 
+            sys_yield();
+  80131f:	49 be ec 01 80 00 00 	movabs $0x8001ec,%r14
+  801326:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801329:	8b 73 04             	mov    0x4(%rbx),%esi
+  80132c:	48 63 ce             	movslq %esi,%rcx
+  80132f:	48 63 03             	movslq (%rbx),%rax
+  801332:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801338:	48 39 c1             	cmp    %rax,%rcx
+  80133b:	72 2e                	jb     80136b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80133d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801342:	48 89 da             	mov    %rbx,%rdx
+  801345:	be 00 10 00 00       	mov    $0x1000,%esi
+  80134a:	4c 89 e7             	mov    %r12,%rdi
+  80134d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801350:	85 c0                	test   %eax,%eax
+  801352:	74 66                	je     8013ba <devpipe_write+0xe8>
+            sys_yield();
+  801354:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801357:	8b 73 04             	mov    0x4(%rbx),%esi
+  80135a:	48 63 ce             	movslq %esi,%rcx
+  80135d:	48 63 03             	movslq (%rbx),%rax
+  801360:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801366:	48 39 c1             	cmp    %rax,%rcx
+  801369:	73 d2                	jae    80133d <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80136b:	41 0f b6 3f          	movzbl (%r15),%edi
+  80136f:	48 89 ca             	mov    %rcx,%rdx
+  801372:	48 c1 ea 03          	shr    $0x3,%rdx
+  801376:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80137d:	08 10 20 
+  801380:	48 f7 e2             	mul    %rdx
+  801383:	48 c1 ea 06          	shr    $0x6,%rdx
+  801387:	48 89 d0             	mov    %rdx,%rax
+  80138a:	48 c1 e0 09          	shl    $0x9,%rax
+  80138e:	48 29 d0             	sub    %rdx,%rax
+  801391:	48 c1 e0 03          	shl    $0x3,%rax
+  801395:	48 29 c1             	sub    %rax,%rcx
+  801398:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80139d:	83 c6 01             	add    $0x1,%esi
+  8013a0:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013a3:	49 83 c7 01          	add    $0x1,%r15
+  8013a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013ab:	49 39 c7             	cmp    %rax,%r15
+  8013ae:	0f 85 75 ff ff ff    	jne    801329 <devpipe_write+0x57>
+    return n;
+  8013b4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8013b8:	eb 05                	jmp    8013bf <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8013ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013bf:	48 83 c4 18          	add    $0x18,%rsp
+  8013c3:	5b                   	pop    %rbx
+  8013c4:	41 5c                	pop    %r12
+  8013c6:	41 5d                	pop    %r13
+  8013c8:	41 5e                	pop    %r14
+  8013ca:	41 5f                	pop    %r15
+  8013cc:	5d                   	pop    %rbp
+  8013cd:	c3                   	ret
+
+00000000008013ce <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8013ce:	55                   	push   %rbp
+  8013cf:	48 89 e5             	mov    %rsp,%rbp
+  8013d2:	41 57                	push   %r15
+  8013d4:	41 56                	push   %r14
+  8013d6:	41 55                	push   %r13
+  8013d8:	41 54                	push   %r12
+  8013da:	53                   	push   %rbx
+  8013db:	48 83 ec 18          	sub    $0x18,%rsp
+  8013df:	49 89 fc             	mov    %rdi,%r12
+  8013e2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8013e6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8013ea:	48 b8 2f 08 80 00 00 	movabs $0x80082f,%rax
+  8013f1:	00 00 00 
+  8013f4:	ff d0                	call   *%rax
+  8013f6:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8013f9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8013ff:	49 bd 4f 02 80 00 00 	movabs $0x80024f,%r13
+  801406:	00 00 00 
+            sys_yield();
+  801409:	49 be ec 01 80 00 00 	movabs $0x8001ec,%r14
+  801410:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801413:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801418:	74 7d                	je     801497 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80141a:	8b 03                	mov    (%rbx),%eax
+  80141c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80141f:	75 26                	jne    801447 <devpipe_read+0x79>
+            if (i > 0) return i;
+  801421:	4d 85 ff             	test   %r15,%r15
+  801424:	75 77                	jne    80149d <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801426:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80142b:	48 89 da             	mov    %rbx,%rdx
+  80142e:	be 00 10 00 00       	mov    $0x1000,%esi
+  801433:	4c 89 e7             	mov    %r12,%rdi
+  801436:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801439:	85 c0                	test   %eax,%eax
+  80143b:	74 72                	je     8014af <devpipe_read+0xe1>
+            sys_yield();
+  80143d:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801440:	8b 03                	mov    (%rbx),%eax
+  801442:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801445:	74 df                	je     801426 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801447:	48 63 c8             	movslq %eax,%rcx
+  80144a:	48 89 ca             	mov    %rcx,%rdx
+  80144d:	48 c1 ea 03          	shr    $0x3,%rdx
+  801451:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801458:	08 10 20 
+  80145b:	48 89 d0             	mov    %rdx,%rax
+  80145e:	48 f7 e6             	mul    %rsi
+  801461:	48 c1 ea 06          	shr    $0x6,%rdx
+  801465:	48 89 d0             	mov    %rdx,%rax
+  801468:	48 c1 e0 09          	shl    $0x9,%rax
+  80146c:	48 29 d0             	sub    %rdx,%rax
+  80146f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801476:	00 
+  801477:	48 89 c8             	mov    %rcx,%rax
+  80147a:	48 29 d0             	sub    %rdx,%rax
+  80147d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  801482:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801486:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80148a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80148d:	49 83 c7 01          	add    $0x1,%r15
+  801491:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801495:	75 83                	jne    80141a <devpipe_read+0x4c>
+    return n;
+  801497:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80149b:	eb 03                	jmp    8014a0 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80149d:	4c 89 f8             	mov    %r15,%rax
+}
+  8014a0:	48 83 c4 18          	add    $0x18,%rsp
+  8014a4:	5b                   	pop    %rbx
+  8014a5:	41 5c                	pop    %r12
+  8014a7:	41 5d                	pop    %r13
+  8014a9:	41 5e                	pop    %r14
+  8014ab:	41 5f                	pop    %r15
+  8014ad:	5d                   	pop    %rbp
+  8014ae:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b4:	eb ea                	jmp    8014a0 <devpipe_read+0xd2>
+
+00000000008014b6 <pipe>:
+pipe(int pfd[2]) {
+  8014b6:	55                   	push   %rbp
+  8014b7:	48 89 e5             	mov    %rsp,%rbp
+  8014ba:	41 55                	push   %r13
+  8014bc:	41 54                	push   %r12
+  8014be:	53                   	push   %rbx
+  8014bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8014c3:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8014c6:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8014ca:	48 b8 4b 08 80 00 00 	movabs $0x80084b,%rax
+  8014d1:	00 00 00 
+  8014d4:	ff d0                	call   *%rax
+  8014d6:	89 c3                	mov    %eax,%ebx
+  8014d8:	85 c0                	test   %eax,%eax
+  8014da:	0f 88 a0 01 00 00    	js     801680 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8014e0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8014e5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8014ea:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8014ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014f3:	48 b8 7b 02 80 00 00 	movabs $0x80027b,%rax
+  8014fa:	00 00 00 
+  8014fd:	ff d0                	call   *%rax
+  8014ff:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801501:	85 c0                	test   %eax,%eax
+  801503:	0f 88 77 01 00 00    	js     801680 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801509:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80150d:	48 b8 4b 08 80 00 00 	movabs $0x80084b,%rax
+  801514:	00 00 00 
+  801517:	ff d0                	call   *%rax
+  801519:	89 c3                	mov    %eax,%ebx
+  80151b:	85 c0                	test   %eax,%eax
+  80151d:	0f 88 43 01 00 00    	js     801666 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  801523:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801528:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80152d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801531:	bf 00 00 00 00       	mov    $0x0,%edi
+  801536:	48 b8 7b 02 80 00 00 	movabs $0x80027b,%rax
+  80153d:	00 00 00 
+  801540:	ff d0                	call   *%rax
+  801542:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  801544:	85 c0                	test   %eax,%eax
+  801546:	0f 88 1a 01 00 00    	js     801666 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80154c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801550:	48 b8 2f 08 80 00 00 	movabs $0x80082f,%rax
+  801557:	00 00 00 
+  80155a:	ff d0                	call   *%rax
+  80155c:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80155f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801564:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801569:	48 89 c6             	mov    %rax,%rsi
+  80156c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801571:	48 b8 7b 02 80 00 00 	movabs $0x80027b,%rax
+  801578:	00 00 00 
+  80157b:	ff d0                	call   *%rax
+  80157d:	89 c3                	mov    %eax,%ebx
+  80157f:	85 c0                	test   %eax,%eax
+  801581:	0f 88 c5 00 00 00    	js     80164c <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  801587:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80158b:	48 b8 2f 08 80 00 00 	movabs $0x80082f,%rax
+  801592:	00 00 00 
+  801595:	ff d0                	call   *%rax
+  801597:	48 89 c1             	mov    %rax,%rcx
+  80159a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8015a0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8015a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ab:	4c 89 ee             	mov    %r13,%rsi
+  8015ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015b3:	48 b8 e2 02 80 00 00 	movabs $0x8002e2,%rax
+  8015ba:	00 00 00 
+  8015bd:	ff d0                	call   *%rax
+  8015bf:	89 c3                	mov    %eax,%ebx
+  8015c1:	85 c0                	test   %eax,%eax
+  8015c3:	78 6e                	js     801633 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8015c5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8015ca:	4c 89 ef             	mov    %r13,%rdi
+  8015cd:	48 b8 1d 02 80 00 00 	movabs $0x80021d,%rax
+  8015d4:	00 00 00 
+  8015d7:	ff d0                	call   *%rax
+  8015d9:	83 f8 02             	cmp    $0x2,%eax
+  8015dc:	0f 85 ab 00 00 00    	jne    80168d <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8015e2:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8015e9:	00 00 
+  8015eb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8015ef:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8015f1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8015f5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8015fc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801600:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801602:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801606:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80160d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801611:	48 bb 1d 08 80 00 00 	movabs $0x80081d,%rbx
+  801618:	00 00 00 
+  80161b:	ff d3                	call   *%rbx
+  80161d:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801621:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801625:	ff d3                	call   *%rbx
+  801627:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80162c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801631:	eb 4d                	jmp    801680 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  801633:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801638:	4c 89 ee             	mov    %r13,%rsi
+  80163b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801640:	48 b8 47 03 80 00 00 	movabs $0x800347,%rax
+  801647:	00 00 00 
+  80164a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80164c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801651:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801655:	bf 00 00 00 00       	mov    $0x0,%edi
+  80165a:	48 b8 47 03 80 00 00 	movabs $0x800347,%rax
+  801661:	00 00 00 
+  801664:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  801666:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80166b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80166f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801674:	48 b8 47 03 80 00 00 	movabs $0x800347,%rax
+  80167b:	00 00 00 
+  80167e:	ff d0                	call   *%rax
+}
+  801680:	89 d8                	mov    %ebx,%eax
+  801682:	48 83 c4 18          	add    $0x18,%rsp
+  801686:	5b                   	pop    %rbx
+  801687:	41 5c                	pop    %r12
+  801689:	41 5d                	pop    %r13
+  80168b:	5d                   	pop    %rbp
+  80168c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80168d:	48 b9 30 2c 80 00 00 	movabs $0x802c30,%rcx
+  801694:	00 00 00 
+  801697:	48 ba 07 2c 80 00 00 	movabs $0x802c07,%rdx
+  80169e:	00 00 00 
+  8016a1:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8016a6:	48 bf 1c 2c 80 00 00 	movabs $0x802c1c,%rdi
+  8016ad:	00 00 00 
+  8016b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b5:	49 b8 f0 1a 80 00 00 	movabs $0x801af0,%r8
+  8016bc:	00 00 00 
+  8016bf:	41 ff d0             	call   *%r8
+
+00000000008016c2 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8016c2:	55                   	push   %rbp
+  8016c3:	48 89 e5             	mov    %rsp,%rbp
+  8016c6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8016ca:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8016ce:	48 b8 ab 08 80 00 00 	movabs $0x8008ab,%rax
+  8016d5:	00 00 00 
+  8016d8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8016da:	85 c0                	test   %eax,%eax
+  8016dc:	78 35                	js     801713 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8016de:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8016e2:	48 b8 2f 08 80 00 00 	movabs $0x80082f,%rax
+  8016e9:	00 00 00 
+  8016ec:	ff d0                	call   *%rax
+  8016ee:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8016f1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8016f6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8016fb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8016ff:	48 b8 4f 02 80 00 00 	movabs $0x80024f,%rax
+  801706:	00 00 00 
+  801709:	ff d0                	call   *%rax
+  80170b:	85 c0                	test   %eax,%eax
+  80170d:	0f 94 c0             	sete   %al
+  801710:	0f b6 c0             	movzbl %al,%eax
+}
+  801713:	c9                   	leave
+  801714:	c3                   	ret
+
+0000000000801715 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801715:	48 89 f8             	mov    %rdi,%rax
+  801718:	48 c1 e8 27          	shr    $0x27,%rax
+  80171c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801723:	01 00 00 
+  801726:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80172a:	f6 c2 01             	test   $0x1,%dl
+  80172d:	74 6d                	je     80179c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80172f:	48 89 f8             	mov    %rdi,%rax
+  801732:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801736:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80173d:	01 00 00 
+  801740:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801744:	f6 c2 01             	test   $0x1,%dl
+  801747:	74 62                	je     8017ab <get_uvpt_entry+0x96>
+  801749:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801750:	01 00 00 
+  801753:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801757:	f6 c2 80             	test   $0x80,%dl
+  80175a:	75 4f                	jne    8017ab <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80175c:	48 89 f8             	mov    %rdi,%rax
+  80175f:	48 c1 e8 15          	shr    $0x15,%rax
+  801763:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80176a:	01 00 00 
+  80176d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801771:	f6 c2 01             	test   $0x1,%dl
+  801774:	74 44                	je     8017ba <get_uvpt_entry+0xa5>
+  801776:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80177d:	01 00 00 
+  801780:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801784:	f6 c2 80             	test   $0x80,%dl
+  801787:	75 31                	jne    8017ba <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  801789:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80178d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801794:	01 00 00 
+  801797:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80179b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80179c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017a3:	01 00 00 
+  8017a6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017aa:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017ab:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017b2:	01 00 00 
+  8017b5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017b9:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017ba:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017c1:	01 00 00 
+  8017c4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017c8:	c3                   	ret
+
+00000000008017c9 <get_prot>:
+
+int
+get_prot(void *va) {
+  8017c9:	55                   	push   %rbp
+  8017ca:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8017cd:	48 b8 15 17 80 00 00 	movabs $0x801715,%rax
+  8017d4:	00 00 00 
+  8017d7:	ff d0                	call   *%rax
+  8017d9:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8017dc:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8017e1:	89 c1                	mov    %eax,%ecx
+  8017e3:	83 c9 04             	or     $0x4,%ecx
+  8017e6:	f6 c2 01             	test   $0x1,%dl
+  8017e9:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8017ec:	89 c1                	mov    %eax,%ecx
+  8017ee:	83 c9 02             	or     $0x2,%ecx
+  8017f1:	f6 c2 02             	test   $0x2,%dl
+  8017f4:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8017f7:	89 c1                	mov    %eax,%ecx
+  8017f9:	83 c9 01             	or     $0x1,%ecx
+  8017fc:	48 85 d2             	test   %rdx,%rdx
+  8017ff:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801802:	89 c1                	mov    %eax,%ecx
+  801804:	83 c9 40             	or     $0x40,%ecx
+  801807:	f6 c6 04             	test   $0x4,%dh
+  80180a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80180d:	5d                   	pop    %rbp
+  80180e:	c3                   	ret
+
+000000000080180f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80180f:	55                   	push   %rbp
+  801810:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801813:	48 b8 15 17 80 00 00 	movabs $0x801715,%rax
+  80181a:	00 00 00 
+  80181d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80181f:	48 c1 e8 06          	shr    $0x6,%rax
+  801823:	83 e0 01             	and    $0x1,%eax
+}
+  801826:	5d                   	pop    %rbp
+  801827:	c3                   	ret
+
+0000000000801828 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  801828:	55                   	push   %rbp
+  801829:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80182c:	48 b8 15 17 80 00 00 	movabs $0x801715,%rax
+  801833:	00 00 00 
+  801836:	ff d0                	call   *%rax
+  801838:	83 e0 01             	and    $0x1,%eax
+}
+  80183b:	5d                   	pop    %rbp
+  80183c:	c3                   	ret
+
+000000000080183d <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80183d:	55                   	push   %rbp
+  80183e:	48 89 e5             	mov    %rsp,%rbp
+  801841:	41 57                	push   %r15
+  801843:	41 56                	push   %r14
+  801845:	41 55                	push   %r13
+  801847:	41 54                	push   %r12
+  801849:	53                   	push   %rbx
+  80184a:	48 83 ec 18          	sub    $0x18,%rsp
+  80184e:	49 89 ff             	mov    %rdi,%r15
+  801851:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  801855:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  80185a:	49 bc 28 18 80 00 00 	movabs $0x801828,%r12
+  801861:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  801864:	49 be c9 17 80 00 00 	movabs $0x8017c9,%r14
+  80186b:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80186e:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  801875:	00 00 00 
+  801878:	eb 0c                	jmp    801886 <foreach_shared_region+0x49>
+  80187a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801881:	4c 39 eb             	cmp    %r13,%rbx
+  801884:	74 38                	je     8018be <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  801886:	48 89 df             	mov    %rbx,%rdi
+  801889:	41 ff d4             	call   *%r12
+  80188c:	84 c0                	test   %al,%al
+  80188e:	74 ea                	je     80187a <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  801890:	48 89 df             	mov    %rbx,%rdi
+  801893:	41 ff d6             	call   *%r14
+  801896:	a8 40                	test   $0x40,%al
+  801898:	74 e0                	je     80187a <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  80189a:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8018a1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8018a5:	48 89 df             	mov    %rbx,%rdi
+  8018a8:	41 ff d7             	call   *%r15
+        if (err)
+  8018ab:	85 c0                	test   %eax,%eax
+  8018ad:	74 cb                	je     80187a <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  8018af:	48 83 c4 18          	add    $0x18,%rsp
+  8018b3:	5b                   	pop    %rbx
+  8018b4:	41 5c                	pop    %r12
+  8018b6:	41 5d                	pop    %r13
+  8018b8:	41 5e                	pop    %r14
+  8018ba:	41 5f                	pop    %r15
+  8018bc:	5d                   	pop    %rbp
+  8018bd:	c3                   	ret
+    return 0;
+  8018be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c3:	eb ea                	jmp    8018af <foreach_shared_region+0x72>
+
+00000000008018c5 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8018c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ca:	c3                   	ret
+
+00000000008018cb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8018cb:	55                   	push   %rbp
+  8018cc:	48 89 e5             	mov    %rsp,%rbp
+  8018cf:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8018d2:	48 be 54 2c 80 00 00 	movabs $0x802c54,%rsi
+  8018d9:	00 00 00 
+  8018dc:	48 b8 65 25 80 00 00 	movabs $0x802565,%rax
+  8018e3:	00 00 00 
+  8018e6:	ff d0                	call   *%rax
+    return 0;
+}
+  8018e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ed:	5d                   	pop    %rbp
+  8018ee:	c3                   	ret
+
+00000000008018ef <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8018ef:	55                   	push   %rbp
+  8018f0:	48 89 e5             	mov    %rsp,%rbp
+  8018f3:	41 57                	push   %r15
+  8018f5:	41 56                	push   %r14
+  8018f7:	41 55                	push   %r13
+  8018f9:	41 54                	push   %r12
+  8018fb:	53                   	push   %rbx
+  8018fc:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801903:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80190a:	48 85 d2             	test   %rdx,%rdx
+  80190d:	74 7a                	je     801989 <devcons_write+0x9a>
+  80190f:	49 89 d6             	mov    %rdx,%r14
+  801912:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801918:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80191d:	49 bf 5f 27 80 00 00 	movabs $0x80275f,%r15
+  801924:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801927:	4c 89 f3             	mov    %r14,%rbx
+  80192a:	48 29 f3             	sub    %rsi,%rbx
+  80192d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801932:	48 39 c3             	cmp    %rax,%rbx
+  801935:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801939:	4c 63 eb             	movslq %ebx,%r13
+  80193c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801943:	48 01 c6             	add    %rax,%rsi
+  801946:	4c 89 ea             	mov    %r13,%rdx
+  801949:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801950:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801953:	4c 89 ee             	mov    %r13,%rsi
+  801956:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80195d:	48 b8 f2 00 80 00 00 	movabs $0x8000f2,%rax
+  801964:	00 00 00 
+  801967:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801969:	41 01 dc             	add    %ebx,%r12d
+  80196c:	49 63 f4             	movslq %r12d,%rsi
+  80196f:	4c 39 f6             	cmp    %r14,%rsi
+  801972:	72 b3                	jb     801927 <devcons_write+0x38>
+    return res;
+  801974:	49 63 c4             	movslq %r12d,%rax
+}
+  801977:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80197e:	5b                   	pop    %rbx
+  80197f:	41 5c                	pop    %r12
+  801981:	41 5d                	pop    %r13
+  801983:	41 5e                	pop    %r14
+  801985:	41 5f                	pop    %r15
+  801987:	5d                   	pop    %rbp
+  801988:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801989:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80198f:	eb e3                	jmp    801974 <devcons_write+0x85>
+
+0000000000801991 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801991:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801994:	ba 00 00 00 00       	mov    $0x0,%edx
+  801999:	48 85 c0             	test   %rax,%rax
+  80199c:	74 55                	je     8019f3 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80199e:	55                   	push   %rbp
+  80199f:	48 89 e5             	mov    %rsp,%rbp
+  8019a2:	41 55                	push   %r13
+  8019a4:	41 54                	push   %r12
+  8019a6:	53                   	push   %rbx
+  8019a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8019ab:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8019ae:	48 bb 1f 01 80 00 00 	movabs $0x80011f,%rbx
+  8019b5:	00 00 00 
+  8019b8:	49 bc ec 01 80 00 00 	movabs $0x8001ec,%r12
+  8019bf:	00 00 00 
+  8019c2:	eb 03                	jmp    8019c7 <devcons_read+0x36>
+  8019c4:	41 ff d4             	call   *%r12
+  8019c7:	ff d3                	call   *%rbx
+  8019c9:	85 c0                	test   %eax,%eax
+  8019cb:	74 f7                	je     8019c4 <devcons_read+0x33>
+    if (c < 0) return c;
+  8019cd:	48 63 d0             	movslq %eax,%rdx
+  8019d0:	78 13                	js     8019e5 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8019d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019d7:	83 f8 04             	cmp    $0x4,%eax
+  8019da:	74 09                	je     8019e5 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8019dc:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8019e0:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8019e5:	48 89 d0             	mov    %rdx,%rax
+  8019e8:	48 83 c4 08          	add    $0x8,%rsp
+  8019ec:	5b                   	pop    %rbx
+  8019ed:	41 5c                	pop    %r12
+  8019ef:	41 5d                	pop    %r13
+  8019f1:	5d                   	pop    %rbp
+  8019f2:	c3                   	ret
+  8019f3:	48 89 d0             	mov    %rdx,%rax
+  8019f6:	c3                   	ret
+
+00000000008019f7 <cputchar>:
+cputchar(int ch) {
+  8019f7:	55                   	push   %rbp
+  8019f8:	48 89 e5             	mov    %rsp,%rbp
+  8019fb:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8019ff:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801a03:	be 01 00 00 00       	mov    $0x1,%esi
+  801a08:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801a0c:	48 b8 f2 00 80 00 00 	movabs $0x8000f2,%rax
+  801a13:	00 00 00 
+  801a16:	ff d0                	call   *%rax
+}
+  801a18:	c9                   	leave
+  801a19:	c3                   	ret
+
+0000000000801a1a <getchar>:
+getchar(void) {
+  801a1a:	55                   	push   %rbp
+  801a1b:	48 89 e5             	mov    %rsp,%rbp
+  801a1e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801a22:	ba 01 00 00 00       	mov    $0x1,%edx
+  801a27:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801a2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a30:	48 b8 8e 0b 80 00 00 	movabs $0x800b8e,%rax
+  801a37:	00 00 00 
+  801a3a:	ff d0                	call   *%rax
+  801a3c:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801a3e:	85 c0                	test   %eax,%eax
+  801a40:	78 06                	js     801a48 <getchar+0x2e>
+  801a42:	74 08                	je     801a4c <getchar+0x32>
+  801a44:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801a48:	89 d0                	mov    %edx,%eax
+  801a4a:	c9                   	leave
+  801a4b:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801a4c:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801a51:	eb f5                	jmp    801a48 <getchar+0x2e>
+
+0000000000801a53 <iscons>:
+iscons(int fdnum) {
+  801a53:	55                   	push   %rbp
+  801a54:	48 89 e5             	mov    %rsp,%rbp
+  801a57:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801a5b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a5f:	48 b8 ab 08 80 00 00 	movabs $0x8008ab,%rax
+  801a66:	00 00 00 
+  801a69:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a6b:	85 c0                	test   %eax,%eax
+  801a6d:	78 18                	js     801a87 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801a6f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a73:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801a7a:	00 00 00 
+  801a7d:	8b 00                	mov    (%rax),%eax
+  801a7f:	39 02                	cmp    %eax,(%rdx)
+  801a81:	0f 94 c0             	sete   %al
+  801a84:	0f b6 c0             	movzbl %al,%eax
+}
+  801a87:	c9                   	leave
+  801a88:	c3                   	ret
+
+0000000000801a89 <opencons>:
+opencons(void) {
+  801a89:	55                   	push   %rbp
+  801a8a:	48 89 e5             	mov    %rsp,%rbp
+  801a8d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801a91:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801a95:	48 b8 4b 08 80 00 00 	movabs $0x80084b,%rax
+  801a9c:	00 00 00 
+  801a9f:	ff d0                	call   *%rax
+  801aa1:	85 c0                	test   %eax,%eax
+  801aa3:	78 49                	js     801aee <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801aa5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801aaa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801aaf:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801ab3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ab8:	48 b8 7b 02 80 00 00 	movabs $0x80027b,%rax
+  801abf:	00 00 00 
+  801ac2:	ff d0                	call   *%rax
+  801ac4:	85 c0                	test   %eax,%eax
+  801ac6:	78 26                	js     801aee <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801ac8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801acc:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801ad3:	00 00 
+  801ad5:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801ad7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801adb:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801ae2:	48 b8 1d 08 80 00 00 	movabs $0x80081d,%rax
+  801ae9:	00 00 00 
+  801aec:	ff d0                	call   *%rax
+}
+  801aee:	c9                   	leave
+  801aef:	c3                   	ret
+
+0000000000801af0 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801af0:	55                   	push   %rbp
+  801af1:	48 89 e5             	mov    %rsp,%rbp
+  801af4:	41 56                	push   %r14
+  801af6:	41 55                	push   %r13
+  801af8:	41 54                	push   %r12
+  801afa:	53                   	push   %rbx
+  801afb:	48 83 ec 50          	sub    $0x50,%rsp
+  801aff:	49 89 fc             	mov    %rdi,%r12
+  801b02:	41 89 f5             	mov    %esi,%r13d
+  801b05:	48 89 d3             	mov    %rdx,%rbx
+  801b08:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b0c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801b10:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801b14:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801b1b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b1f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801b23:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801b27:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801b2b:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801b32:	00 00 00 
+  801b35:	4c 8b 30             	mov    (%rax),%r14
+  801b38:	48 b8 bb 01 80 00 00 	movabs $0x8001bb,%rax
+  801b3f:	00 00 00 
+  801b42:	ff d0                	call   *%rax
+  801b44:	89 c6                	mov    %eax,%esi
+  801b46:	45 89 e8             	mov    %r13d,%r8d
+  801b49:	4c 89 e1             	mov    %r12,%rcx
+  801b4c:	4c 89 f2             	mov    %r14,%rdx
+  801b4f:	48 bf 60 2c 80 00 00 	movabs $0x802c60,%rdi
+  801b56:	00 00 00 
+  801b59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5e:	49 bc 40 1c 80 00 00 	movabs $0x801c40,%r12
+  801b65:	00 00 00 
+  801b68:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801b6b:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801b6f:	48 89 df             	mov    %rbx,%rdi
+  801b72:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  801b79:	00 00 00 
+  801b7c:	ff d0                	call   *%rax
+    cprintf("\n");
+  801b7e:	48 bf b3 2b 80 00 00 	movabs $0x802bb3,%rdi
+  801b85:	00 00 00 
+  801b88:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b8d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801b90:	cc                   	int3
+  801b91:	eb fd                	jmp    801b90 <_panic+0xa0>
+
+0000000000801b93 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801b93:	55                   	push   %rbp
+  801b94:	48 89 e5             	mov    %rsp,%rbp
+  801b97:	53                   	push   %rbx
+  801b98:	48 83 ec 08          	sub    $0x8,%rsp
+  801b9c:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801b9f:	8b 06                	mov    (%rsi),%eax
+  801ba1:	8d 50 01             	lea    0x1(%rax),%edx
+  801ba4:	89 16                	mov    %edx,(%rsi)
+  801ba6:	48 98                	cltq
+  801ba8:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801bad:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801bb3:	74 0a                	je     801bbf <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801bb5:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801bb9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bbd:	c9                   	leave
+  801bbe:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801bbf:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801bc3:	be ff 00 00 00       	mov    $0xff,%esi
+  801bc8:	48 b8 f2 00 80 00 00 	movabs $0x8000f2,%rax
+  801bcf:	00 00 00 
+  801bd2:	ff d0                	call   *%rax
+        state->offset = 0;
+  801bd4:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801bda:	eb d9                	jmp    801bb5 <putch+0x22>
+
+0000000000801bdc <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801bdc:	55                   	push   %rbp
+  801bdd:	48 89 e5             	mov    %rsp,%rbp
+  801be0:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801be7:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801bea:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801bf1:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801bf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bfb:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801bfe:	48 89 f1             	mov    %rsi,%rcx
+  801c01:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801c08:	48 bf 93 1b 80 00 00 	movabs $0x801b93,%rdi
+  801c0f:	00 00 00 
+  801c12:	48 b8 90 1d 80 00 00 	movabs $0x801d90,%rax
+  801c19:	00 00 00 
+  801c1c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801c1e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801c25:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801c2c:	48 b8 f2 00 80 00 00 	movabs $0x8000f2,%rax
+  801c33:	00 00 00 
+  801c36:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801c38:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801c3e:	c9                   	leave
+  801c3f:	c3                   	ret
+
+0000000000801c40 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801c40:	55                   	push   %rbp
+  801c41:	48 89 e5             	mov    %rsp,%rbp
+  801c44:	48 83 ec 50          	sub    $0x50,%rsp
+  801c48:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801c4c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801c50:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c54:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801c58:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801c5c:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801c63:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c6b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801c6f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801c73:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801c77:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  801c7e:	00 00 00 
+  801c81:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801c83:	c9                   	leave
+  801c84:	c3                   	ret
+
+0000000000801c85 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801c85:	55                   	push   %rbp
+  801c86:	48 89 e5             	mov    %rsp,%rbp
+  801c89:	41 57                	push   %r15
+  801c8b:	41 56                	push   %r14
+  801c8d:	41 55                	push   %r13
+  801c8f:	41 54                	push   %r12
+  801c91:	53                   	push   %rbx
+  801c92:	48 83 ec 18          	sub    $0x18,%rsp
+  801c96:	49 89 fc             	mov    %rdi,%r12
+  801c99:	49 89 f5             	mov    %rsi,%r13
+  801c9c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ca0:	8b 45 10             	mov    0x10(%rbp),%eax
+  801ca3:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801ca6:	41 89 cf             	mov    %ecx,%r15d
+  801ca9:	4c 39 fa             	cmp    %r15,%rdx
+  801cac:	73 5b                	jae    801d09 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801cae:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801cb2:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801cb6:	85 db                	test   %ebx,%ebx
+  801cb8:	7e 0e                	jle    801cc8 <print_num+0x43>
+            putch(padc, put_arg);
+  801cba:	4c 89 ee             	mov    %r13,%rsi
+  801cbd:	44 89 f7             	mov    %r14d,%edi
+  801cc0:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801cc3:	83 eb 01             	sub    $0x1,%ebx
+  801cc6:	75 f2                	jne    801cba <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801cc8:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801ccc:	48 b9 94 2c 80 00 00 	movabs $0x802c94,%rcx
+  801cd3:	00 00 00 
+  801cd6:	48 b8 83 2c 80 00 00 	movabs $0x802c83,%rax
+  801cdd:	00 00 00 
+  801ce0:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801ce4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ce8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ced:	49 f7 f7             	div    %r15
+  801cf0:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801cf4:	4c 89 ee             	mov    %r13,%rsi
+  801cf7:	41 ff d4             	call   *%r12
+}
+  801cfa:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801cfe:	5b                   	pop    %rbx
+  801cff:	41 5c                	pop    %r12
+  801d01:	41 5d                	pop    %r13
+  801d03:	41 5e                	pop    %r14
+  801d05:	41 5f                	pop    %r15
+  801d07:	5d                   	pop    %rbp
+  801d08:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801d09:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d12:	49 f7 f7             	div    %r15
+  801d15:	48 83 ec 08          	sub    $0x8,%rsp
+  801d19:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801d1d:	52                   	push   %rdx
+  801d1e:	45 0f be c9          	movsbl %r9b,%r9d
+  801d22:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801d26:	48 89 c2             	mov    %rax,%rdx
+  801d29:	48 b8 85 1c 80 00 00 	movabs $0x801c85,%rax
+  801d30:	00 00 00 
+  801d33:	ff d0                	call   *%rax
+  801d35:	48 83 c4 10          	add    $0x10,%rsp
+  801d39:	eb 8d                	jmp    801cc8 <print_num+0x43>
+
+0000000000801d3b <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801d3b:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801d3f:	48 8b 06             	mov    (%rsi),%rax
+  801d42:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801d46:	73 0a                	jae    801d52 <sprintputch+0x17>
+        *state->start++ = ch;
+  801d48:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d4c:	48 89 16             	mov    %rdx,(%rsi)
+  801d4f:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801d52:	c3                   	ret
+
+0000000000801d53 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801d53:	55                   	push   %rbp
+  801d54:	48 89 e5             	mov    %rsp,%rbp
+  801d57:	48 83 ec 50          	sub    $0x50,%rsp
+  801d5b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d5f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d63:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801d67:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801d6e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d76:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801d7a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801d7e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801d82:	48 b8 90 1d 80 00 00 	movabs $0x801d90,%rax
+  801d89:	00 00 00 
+  801d8c:	ff d0                	call   *%rax
+}
+  801d8e:	c9                   	leave
+  801d8f:	c3                   	ret
+
+0000000000801d90 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801d90:	55                   	push   %rbp
+  801d91:	48 89 e5             	mov    %rsp,%rbp
+  801d94:	41 57                	push   %r15
+  801d96:	41 56                	push   %r14
+  801d98:	41 55                	push   %r13
+  801d9a:	41 54                	push   %r12
+  801d9c:	53                   	push   %rbx
+  801d9d:	48 83 ec 38          	sub    $0x38,%rsp
+  801da1:	49 89 fe             	mov    %rdi,%r14
+  801da4:	49 89 f5             	mov    %rsi,%r13
+  801da7:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801daa:	48 8b 01             	mov    (%rcx),%rax
+  801dad:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801db1:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801db5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801db9:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801dbd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801dc1:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801dc5:	0f b6 3b             	movzbl (%rbx),%edi
+  801dc8:	40 80 ff 25          	cmp    $0x25,%dil
+  801dcc:	74 18                	je     801de6 <vprintfmt+0x56>
+            if (!ch) return;
+  801dce:	40 84 ff             	test   %dil,%dil
+  801dd1:	0f 84 b1 06 00 00    	je     802488 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801dd7:	40 0f b6 ff          	movzbl %dil,%edi
+  801ddb:	4c 89 ee             	mov    %r13,%rsi
+  801dde:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801de1:	4c 89 e3             	mov    %r12,%rbx
+  801de4:	eb db                	jmp    801dc1 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801de6:	be 00 00 00 00       	mov    $0x0,%esi
+  801deb:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801def:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801df4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801dfa:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801e01:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e05:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801e0a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801e0f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801e12:	83 e8 23             	sub    $0x23,%eax
+  801e15:	3c 57                	cmp    $0x57,%al
+  801e17:	0f 87 51 06 00 00    	ja     80246e <vprintfmt+0x6de>
+  801e1d:	0f b6 c0             	movzbl %al,%eax
+  801e20:	48 b9 40 2e 80 00 00 	movabs $0x802e40,%rcx
+  801e27:	00 00 00 
+  801e2a:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801e2d:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801e30:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801e34:	eb cf                	jmp    801e05 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801e36:	49 89 dc             	mov    %rbx,%r12
+  801e39:	be 01 00 00 00       	mov    $0x1,%esi
+  801e3e:	eb c5                	jmp    801e05 <vprintfmt+0x75>
+            padc = ch;
+  801e40:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801e44:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801e47:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801e4a:	eb b9                	jmp    801e05 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e4f:	83 f8 2f             	cmp    $0x2f,%eax
+  801e52:	77 24                	ja     801e78 <vprintfmt+0xe8>
+  801e54:	89 c1                	mov    %eax,%ecx
+  801e56:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801e5a:	83 c0 08             	add    $0x8,%eax
+  801e5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e60:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801e63:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801e66:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801e6a:	79 99                	jns    801e05 <vprintfmt+0x75>
+                width = precision;
+  801e6c:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801e70:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e76:	eb 8d                	jmp    801e05 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e78:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e7c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801e80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e84:	eb da                	jmp    801e60 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801e86:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801e8b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801e8f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801e95:	3c 39                	cmp    $0x39,%al
+  801e97:	77 1c                	ja     801eb5 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801e99:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801e9d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801ea1:	0f b6 c0             	movzbl %al,%eax
+  801ea4:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801ea9:	0f b6 03             	movzbl (%rbx),%eax
+  801eac:	3c 39                	cmp    $0x39,%al
+  801eae:	76 e9                	jbe    801e99 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801eb0:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801eb3:	eb b1                	jmp    801e66 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801eb5:	49 89 dc             	mov    %rbx,%r12
+  801eb8:	eb ac                	jmp    801e66 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801eba:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801ebd:	85 c9                	test   %ecx,%ecx
+  801ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec4:	0f 49 c1             	cmovns %ecx,%eax
+  801ec7:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801eca:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ecd:	e9 33 ff ff ff       	jmp    801e05 <vprintfmt+0x75>
+            lflag++;
+  801ed2:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ed5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ed8:	e9 28 ff ff ff       	jmp    801e05 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801edd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ee0:	83 f8 2f             	cmp    $0x2f,%eax
+  801ee3:	77 19                	ja     801efe <vprintfmt+0x16e>
+  801ee5:	89 c2                	mov    %eax,%edx
+  801ee7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801eeb:	83 c0 08             	add    $0x8,%eax
+  801eee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ef1:	8b 3a                	mov    (%rdx),%edi
+  801ef3:	4c 89 ee             	mov    %r13,%rsi
+  801ef6:	41 ff d6             	call   *%r14
+            break;
+  801ef9:	e9 c3 fe ff ff       	jmp    801dc1 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  801efe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f0a:	eb e5                	jmp    801ef1 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  801f0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f0f:	83 f8 2f             	cmp    $0x2f,%eax
+  801f12:	77 5a                	ja     801f6e <vprintfmt+0x1de>
+  801f14:	89 c2                	mov    %eax,%edx
+  801f16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f1a:	83 c0 08             	add    $0x8,%eax
+  801f1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801f20:	8b 02                	mov    (%rdx),%eax
+  801f22:	89 c1                	mov    %eax,%ecx
+  801f24:	f7 d9                	neg    %ecx
+  801f26:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801f29:	83 f9 15             	cmp    $0x15,%ecx
+  801f2c:	7f 4e                	jg     801f7c <vprintfmt+0x1ec>
+  801f2e:	48 63 c1             	movslq %ecx,%rax
+  801f31:	48 ba 00 31 80 00 00 	movabs $0x803100,%rdx
+  801f38:	00 00 00 
+  801f3b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801f3f:	48 85 c0             	test   %rax,%rax
+  801f42:	74 38                	je     801f7c <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801f44:	48 89 c1             	mov    %rax,%rcx
+  801f47:	48 ba 19 2c 80 00 00 	movabs $0x802c19,%rdx
+  801f4e:	00 00 00 
+  801f51:	4c 89 ee             	mov    %r13,%rsi
+  801f54:	4c 89 f7             	mov    %r14,%rdi
+  801f57:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f5c:	49 b8 53 1d 80 00 00 	movabs $0x801d53,%r8
+  801f63:	00 00 00 
+  801f66:	41 ff d0             	call   *%r8
+  801f69:	e9 53 fe ff ff       	jmp    801dc1 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801f6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f7a:	eb a4                	jmp    801f20 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801f7c:	48 ba ac 2c 80 00 00 	movabs $0x802cac,%rdx
+  801f83:	00 00 00 
+  801f86:	4c 89 ee             	mov    %r13,%rsi
+  801f89:	4c 89 f7             	mov    %r14,%rdi
+  801f8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f91:	49 b8 53 1d 80 00 00 	movabs $0x801d53,%r8
+  801f98:	00 00 00 
+  801f9b:	41 ff d0             	call   *%r8
+  801f9e:	e9 1e fe ff ff       	jmp    801dc1 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801fa3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fa6:	83 f8 2f             	cmp    $0x2f,%eax
+  801fa9:	77 6c                	ja     802017 <vprintfmt+0x287>
+  801fab:	89 c2                	mov    %eax,%edx
+  801fad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fb1:	83 c0 08             	add    $0x8,%eax
+  801fb4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fb7:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801fba:	48 85 d2             	test   %rdx,%rdx
+  801fbd:	48 b8 a5 2c 80 00 00 	movabs $0x802ca5,%rax
+  801fc4:	00 00 00 
+  801fc7:	48 0f 45 c2          	cmovne %rdx,%rax
+  801fcb:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801fcf:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801fd3:	7e 06                	jle    801fdb <vprintfmt+0x24b>
+  801fd5:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801fd9:	75 4a                	jne    802025 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801fdb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801fdf:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801fe3:	0f b6 00             	movzbl (%rax),%eax
+  801fe6:	84 c0                	test   %al,%al
+  801fe8:	0f 85 9a 00 00 00    	jne    802088 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  801fee:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ff1:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801ff5:	85 c0                	test   %eax,%eax
+  801ff7:	0f 8e c4 fd ff ff    	jle    801dc1 <vprintfmt+0x31>
+  801ffd:	4c 89 ee             	mov    %r13,%rsi
+  802000:	bf 20 00 00 00       	mov    $0x20,%edi
+  802005:	41 ff d6             	call   *%r14
+  802008:	41 83 ec 01          	sub    $0x1,%r12d
+  80200c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802010:	75 eb                	jne    801ffd <vprintfmt+0x26d>
+  802012:	e9 aa fd ff ff       	jmp    801dc1 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802017:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80201b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80201f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802023:	eb 92                	jmp    801fb7 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802025:	49 63 f7             	movslq %r15d,%rsi
+  802028:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80202c:	48 b8 42 25 80 00 00 	movabs $0x802542,%rax
+  802033:	00 00 00 
+  802036:	ff d0                	call   *%rax
+  802038:	48 89 c2             	mov    %rax,%rdx
+  80203b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80203e:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802040:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802043:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802046:	85 c0                	test   %eax,%eax
+  802048:	7e 91                	jle    801fdb <vprintfmt+0x24b>
+  80204a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80204f:	4c 89 ee             	mov    %r13,%rsi
+  802052:	44 89 e7             	mov    %r12d,%edi
+  802055:	41 ff d6             	call   *%r14
+  802058:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80205c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80205f:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802062:	75 eb                	jne    80204f <vprintfmt+0x2bf>
+  802064:	e9 72 ff ff ff       	jmp    801fdb <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802069:	0f b6 f8             	movzbl %al,%edi
+  80206c:	4c 89 ee             	mov    %r13,%rsi
+  80206f:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802072:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802076:	49 83 c4 01          	add    $0x1,%r12
+  80207a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802080:	84 c0                	test   %al,%al
+  802082:	0f 84 66 ff ff ff    	je     801fee <vprintfmt+0x25e>
+  802088:	45 85 ff             	test   %r15d,%r15d
+  80208b:	78 0a                	js     802097 <vprintfmt+0x307>
+  80208d:	41 83 ef 01          	sub    $0x1,%r15d
+  802091:	0f 88 57 ff ff ff    	js     801fee <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802097:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80209b:	74 cc                	je     802069 <vprintfmt+0x2d9>
+  80209d:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8020a0:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8020a5:	80 fa 5e             	cmp    $0x5e,%dl
+  8020a8:	77 c2                	ja     80206c <vprintfmt+0x2dc>
+  8020aa:	eb bd                	jmp    802069 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8020ac:	40 84 f6             	test   %sil,%sil
+  8020af:	75 26                	jne    8020d7 <vprintfmt+0x347>
+    switch (lflag) {
+  8020b1:	85 d2                	test   %edx,%edx
+  8020b3:	74 59                	je     80210e <vprintfmt+0x37e>
+  8020b5:	83 fa 01             	cmp    $0x1,%edx
+  8020b8:	74 7b                	je     802135 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8020ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8020c0:	0f 87 96 00 00 00    	ja     80215c <vprintfmt+0x3cc>
+  8020c6:	89 c2                	mov    %eax,%edx
+  8020c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020cc:	83 c0 08             	add    $0x8,%eax
+  8020cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020d2:	4c 8b 22             	mov    (%rdx),%r12
+  8020d5:	eb 17                	jmp    8020ee <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8020d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020da:	83 f8 2f             	cmp    $0x2f,%eax
+  8020dd:	77 21                	ja     802100 <vprintfmt+0x370>
+  8020df:	89 c2                	mov    %eax,%edx
+  8020e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020e5:	83 c0 08             	add    $0x8,%eax
+  8020e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020eb:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8020ee:	4d 85 e4             	test   %r12,%r12
+  8020f1:	78 7a                	js     80216d <vprintfmt+0x3dd>
+            num = i;
+  8020f3:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8020f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8020fb:	e9 50 02 00 00       	jmp    802350 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802100:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802104:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802108:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80210c:	eb dd                	jmp    8020eb <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80210e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802111:	83 f8 2f             	cmp    $0x2f,%eax
+  802114:	77 11                	ja     802127 <vprintfmt+0x397>
+  802116:	89 c2                	mov    %eax,%edx
+  802118:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80211c:	83 c0 08             	add    $0x8,%eax
+  80211f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802122:	4c 63 22             	movslq (%rdx),%r12
+  802125:	eb c7                	jmp    8020ee <vprintfmt+0x35e>
+  802127:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80212b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80212f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802133:	eb ed                	jmp    802122 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802135:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802138:	83 f8 2f             	cmp    $0x2f,%eax
+  80213b:	77 11                	ja     80214e <vprintfmt+0x3be>
+  80213d:	89 c2                	mov    %eax,%edx
+  80213f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802143:	83 c0 08             	add    $0x8,%eax
+  802146:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802149:	4c 8b 22             	mov    (%rdx),%r12
+  80214c:	eb a0                	jmp    8020ee <vprintfmt+0x35e>
+  80214e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802152:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802156:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80215a:	eb ed                	jmp    802149 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80215c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802160:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802164:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802168:	e9 65 ff ff ff       	jmp    8020d2 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80216d:	4c 89 ee             	mov    %r13,%rsi
+  802170:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802175:	41 ff d6             	call   *%r14
+                i = -i;
+  802178:	49 f7 dc             	neg    %r12
+  80217b:	e9 73 ff ff ff       	jmp    8020f3 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802180:	40 84 f6             	test   %sil,%sil
+  802183:	75 32                	jne    8021b7 <vprintfmt+0x427>
+    switch (lflag) {
+  802185:	85 d2                	test   %edx,%edx
+  802187:	74 5d                	je     8021e6 <vprintfmt+0x456>
+  802189:	83 fa 01             	cmp    $0x1,%edx
+  80218c:	0f 84 82 00 00 00    	je     802214 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802192:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802195:	83 f8 2f             	cmp    $0x2f,%eax
+  802198:	0f 87 a5 00 00 00    	ja     802243 <vprintfmt+0x4b3>
+  80219e:	89 c2                	mov    %eax,%edx
+  8021a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021a4:	83 c0 08             	add    $0x8,%eax
+  8021a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021aa:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021ad:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8021b2:	e9 99 01 00 00       	jmp    802350 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8021b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8021bd:	77 19                	ja     8021d8 <vprintfmt+0x448>
+  8021bf:	89 c2                	mov    %eax,%edx
+  8021c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021c5:	83 c0 08             	add    $0x8,%eax
+  8021c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021cb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021ce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8021d3:	e9 78 01 00 00       	jmp    802350 <vprintfmt+0x5c0>
+  8021d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021e4:	eb e5                	jmp    8021cb <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8021e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8021ec:	77 18                	ja     802206 <vprintfmt+0x476>
+  8021ee:	89 c2                	mov    %eax,%edx
+  8021f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021f4:	83 c0 08             	add    $0x8,%eax
+  8021f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021fa:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8021fc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802201:	e9 4a 01 00 00       	jmp    802350 <vprintfmt+0x5c0>
+  802206:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80220a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80220e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802212:	eb e6                	jmp    8021fa <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802214:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802217:	83 f8 2f             	cmp    $0x2f,%eax
+  80221a:	77 19                	ja     802235 <vprintfmt+0x4a5>
+  80221c:	89 c2                	mov    %eax,%edx
+  80221e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802222:	83 c0 08             	add    $0x8,%eax
+  802225:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802228:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80222b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802230:	e9 1b 01 00 00       	jmp    802350 <vprintfmt+0x5c0>
+  802235:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802239:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80223d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802241:	eb e5                	jmp    802228 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802243:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802247:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80224b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80224f:	e9 56 ff ff ff       	jmp    8021aa <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802254:	40 84 f6             	test   %sil,%sil
+  802257:	75 2e                	jne    802287 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802259:	85 d2                	test   %edx,%edx
+  80225b:	74 59                	je     8022b6 <vprintfmt+0x526>
+  80225d:	83 fa 01             	cmp    $0x1,%edx
+  802260:	74 7f                	je     8022e1 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802262:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802265:	83 f8 2f             	cmp    $0x2f,%eax
+  802268:	0f 87 9f 00 00 00    	ja     80230d <vprintfmt+0x57d>
+  80226e:	89 c2                	mov    %eax,%edx
+  802270:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802274:	83 c0 08             	add    $0x8,%eax
+  802277:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80227a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80227d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802282:	e9 c9 00 00 00       	jmp    802350 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802287:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80228a:	83 f8 2f             	cmp    $0x2f,%eax
+  80228d:	77 19                	ja     8022a8 <vprintfmt+0x518>
+  80228f:	89 c2                	mov    %eax,%edx
+  802291:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802295:	83 c0 08             	add    $0x8,%eax
+  802298:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80229b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80229e:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022a3:	e9 a8 00 00 00       	jmp    802350 <vprintfmt+0x5c0>
+  8022a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022b4:	eb e5                	jmp    80229b <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8022b6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022b9:	83 f8 2f             	cmp    $0x2f,%eax
+  8022bc:	77 15                	ja     8022d3 <vprintfmt+0x543>
+  8022be:	89 c2                	mov    %eax,%edx
+  8022c0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022c4:	83 c0 08             	add    $0x8,%eax
+  8022c7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022ca:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8022cc:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8022d1:	eb 7d                	jmp    802350 <vprintfmt+0x5c0>
+  8022d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022df:	eb e9                	jmp    8022ca <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8022e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8022e7:	77 16                	ja     8022ff <vprintfmt+0x56f>
+  8022e9:	89 c2                	mov    %eax,%edx
+  8022eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022ef:	83 c0 08             	add    $0x8,%eax
+  8022f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022f5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8022f8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8022fd:	eb 51                	jmp    802350 <vprintfmt+0x5c0>
+  8022ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802303:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802307:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80230b:	eb e8                	jmp    8022f5 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80230d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802311:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802315:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802319:	e9 5c ff ff ff       	jmp    80227a <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80231e:	4c 89 ee             	mov    %r13,%rsi
+  802321:	bf 30 00 00 00       	mov    $0x30,%edi
+  802326:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802329:	4c 89 ee             	mov    %r13,%rsi
+  80232c:	bf 78 00 00 00       	mov    $0x78,%edi
+  802331:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802334:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802337:	83 f8 2f             	cmp    $0x2f,%eax
+  80233a:	77 47                	ja     802383 <vprintfmt+0x5f3>
+  80233c:	89 c2                	mov    %eax,%edx
+  80233e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802342:	83 c0 08             	add    $0x8,%eax
+  802345:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802348:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80234b:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802350:	48 83 ec 08          	sub    $0x8,%rsp
+  802354:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802358:	0f 94 c0             	sete   %al
+  80235b:	0f b6 c0             	movzbl %al,%eax
+  80235e:	50                   	push   %rax
+  80235f:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802364:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802368:	4c 89 ee             	mov    %r13,%rsi
+  80236b:	4c 89 f7             	mov    %r14,%rdi
+  80236e:	48 b8 85 1c 80 00 00 	movabs $0x801c85,%rax
+  802375:	00 00 00 
+  802378:	ff d0                	call   *%rax
+            break;
+  80237a:	48 83 c4 10          	add    $0x10,%rsp
+  80237e:	e9 3e fa ff ff       	jmp    801dc1 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802383:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802387:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80238b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80238f:	eb b7                	jmp    802348 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802391:	40 84 f6             	test   %sil,%sil
+  802394:	75 2b                	jne    8023c1 <vprintfmt+0x631>
+    switch (lflag) {
+  802396:	85 d2                	test   %edx,%edx
+  802398:	74 56                	je     8023f0 <vprintfmt+0x660>
+  80239a:	83 fa 01             	cmp    $0x1,%edx
+  80239d:	74 7f                	je     80241e <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80239f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8023a5:	0f 87 a2 00 00 00    	ja     80244d <vprintfmt+0x6bd>
+  8023ab:	89 c2                	mov    %eax,%edx
+  8023ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023b1:	83 c0 08             	add    $0x8,%eax
+  8023b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023b7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023ba:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023bf:	eb 8f                	jmp    802350 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8023c7:	77 19                	ja     8023e2 <vprintfmt+0x652>
+  8023c9:	89 c2                	mov    %eax,%edx
+  8023cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023cf:	83 c0 08             	add    $0x8,%eax
+  8023d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023d5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023d8:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023dd:	e9 6e ff ff ff       	jmp    802350 <vprintfmt+0x5c0>
+  8023e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023ee:	eb e5                	jmp    8023d5 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8023f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8023f6:	77 18                	ja     802410 <vprintfmt+0x680>
+  8023f8:	89 c2                	mov    %eax,%edx
+  8023fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023fe:	83 c0 08             	add    $0x8,%eax
+  802401:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802404:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802406:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80240b:	e9 40 ff ff ff       	jmp    802350 <vprintfmt+0x5c0>
+  802410:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802414:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802418:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80241c:	eb e6                	jmp    802404 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80241e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802421:	83 f8 2f             	cmp    $0x2f,%eax
+  802424:	77 19                	ja     80243f <vprintfmt+0x6af>
+  802426:	89 c2                	mov    %eax,%edx
+  802428:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80242c:	83 c0 08             	add    $0x8,%eax
+  80242f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802432:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802435:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80243a:	e9 11 ff ff ff       	jmp    802350 <vprintfmt+0x5c0>
+  80243f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802443:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802447:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80244b:	eb e5                	jmp    802432 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80244d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802451:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802455:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802459:	e9 59 ff ff ff       	jmp    8023b7 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80245e:	4c 89 ee             	mov    %r13,%rsi
+  802461:	bf 25 00 00 00       	mov    $0x25,%edi
+  802466:	41 ff d6             	call   *%r14
+            break;
+  802469:	e9 53 f9 ff ff       	jmp    801dc1 <vprintfmt+0x31>
+            putch('%', put_arg);
+  80246e:	4c 89 ee             	mov    %r13,%rsi
+  802471:	bf 25 00 00 00       	mov    $0x25,%edi
+  802476:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802479:	48 83 eb 01          	sub    $0x1,%rbx
+  80247d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802481:	75 f6                	jne    802479 <vprintfmt+0x6e9>
+  802483:	e9 39 f9 ff ff       	jmp    801dc1 <vprintfmt+0x31>
+}
+  802488:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80248c:	5b                   	pop    %rbx
+  80248d:	41 5c                	pop    %r12
+  80248f:	41 5d                	pop    %r13
+  802491:	41 5e                	pop    %r14
+  802493:	41 5f                	pop    %r15
+  802495:	5d                   	pop    %rbp
+  802496:	c3                   	ret
+
+0000000000802497 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802497:	55                   	push   %rbp
+  802498:	48 89 e5             	mov    %rsp,%rbp
+  80249b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80249f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8024a3:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8024a8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8024ac:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8024b3:	48 85 ff             	test   %rdi,%rdi
+  8024b6:	74 2b                	je     8024e3 <vsnprintf+0x4c>
+  8024b8:	48 85 f6             	test   %rsi,%rsi
+  8024bb:	74 26                	je     8024e3 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8024bd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024c1:	48 bf 3b 1d 80 00 00 	movabs $0x801d3b,%rdi
+  8024c8:	00 00 00 
+  8024cb:	48 b8 90 1d 80 00 00 	movabs $0x801d90,%rax
+  8024d2:	00 00 00 
+  8024d5:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8024d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024db:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8024de:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8024e1:	c9                   	leave
+  8024e2:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8024e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024e8:	eb f7                	jmp    8024e1 <vsnprintf+0x4a>
+
+00000000008024ea <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8024ea:	55                   	push   %rbp
+  8024eb:	48 89 e5             	mov    %rsp,%rbp
+  8024ee:	48 83 ec 50          	sub    $0x50,%rsp
+  8024f2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8024f6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8024fa:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8024fe:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802505:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802509:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80250d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802511:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802515:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802519:	48 b8 97 24 80 00 00 	movabs $0x802497,%rax
+  802520:	00 00 00 
+  802523:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802525:	c9                   	leave
+  802526:	c3                   	ret
+
+0000000000802527 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802527:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80252a:	74 10                	je     80253c <strlen+0x15>
+    size_t n = 0;
+  80252c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802531:	48 83 c0 01          	add    $0x1,%rax
+  802535:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802539:	75 f6                	jne    802531 <strlen+0xa>
+  80253b:	c3                   	ret
+    size_t n = 0;
+  80253c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802541:	c3                   	ret
+
+0000000000802542 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802542:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802545:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80254a:	48 85 f6             	test   %rsi,%rsi
+  80254d:	74 11                	je     802560 <strnlen+0x1e>
+  80254f:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802553:	74 0c                	je     802561 <strnlen+0x1f>
+  802555:	48 83 c2 01          	add    $0x1,%rdx
+  802559:	48 39 d0             	cmp    %rdx,%rax
+  80255c:	75 f1                	jne    80254f <strnlen+0xd>
+  80255e:	eb 04                	jmp    802564 <strnlen+0x22>
+  802560:	c3                   	ret
+  802561:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802564:	c3                   	ret
+
+0000000000802565 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802565:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802568:	ba 00 00 00 00       	mov    $0x0,%edx
+  80256d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802571:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802574:	48 83 c2 01          	add    $0x1,%rdx
+  802578:	84 c9                	test   %cl,%cl
+  80257a:	75 f1                	jne    80256d <strcpy+0x8>
+        ;
+    return res;
+}
+  80257c:	c3                   	ret
+
+000000000080257d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80257d:	55                   	push   %rbp
+  80257e:	48 89 e5             	mov    %rsp,%rbp
+  802581:	41 54                	push   %r12
+  802583:	53                   	push   %rbx
+  802584:	48 89 fb             	mov    %rdi,%rbx
+  802587:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80258a:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  802591:	00 00 00 
+  802594:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802596:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80259a:	4c 89 e6             	mov    %r12,%rsi
+  80259d:	48 b8 65 25 80 00 00 	movabs $0x802565,%rax
+  8025a4:	00 00 00 
+  8025a7:	ff d0                	call   *%rax
+    return dst;
+}
+  8025a9:	48 89 d8             	mov    %rbx,%rax
+  8025ac:	5b                   	pop    %rbx
+  8025ad:	41 5c                	pop    %r12
+  8025af:	5d                   	pop    %rbp
+  8025b0:	c3                   	ret
+
+00000000008025b1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8025b1:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8025b4:	48 85 d2             	test   %rdx,%rdx
+  8025b7:	74 1f                	je     8025d8 <strncpy+0x27>
+  8025b9:	48 01 fa             	add    %rdi,%rdx
+  8025bc:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8025bf:	48 83 c1 01          	add    $0x1,%rcx
+  8025c3:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8025c7:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8025cb:	41 80 f8 01          	cmp    $0x1,%r8b
+  8025cf:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8025d3:	48 39 ca             	cmp    %rcx,%rdx
+  8025d6:	75 e7                	jne    8025bf <strncpy+0xe>
+    }
+    return ret;
+}
+  8025d8:	c3                   	ret
+
+00000000008025d9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8025d9:	48 89 f8             	mov    %rdi,%rax
+  8025dc:	48 85 d2             	test   %rdx,%rdx
+  8025df:	74 24                	je     802605 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8025e1:	48 83 ea 01          	sub    $0x1,%rdx
+  8025e5:	74 1b                	je     802602 <strlcpy+0x29>
+  8025e7:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8025eb:	0f b6 16             	movzbl (%rsi),%edx
+  8025ee:	84 d2                	test   %dl,%dl
+  8025f0:	74 10                	je     802602 <strlcpy+0x29>
+            *dst++ = *src++;
+  8025f2:	48 83 c6 01          	add    $0x1,%rsi
+  8025f6:	48 83 c0 01          	add    $0x1,%rax
+  8025fa:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8025fd:	48 39 c8             	cmp    %rcx,%rax
+  802600:	75 e9                	jne    8025eb <strlcpy+0x12>
+        *dst = '\0';
+  802602:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802605:	48 29 f8             	sub    %rdi,%rax
+}
+  802608:	c3                   	ret
+
+0000000000802609 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802609:	0f b6 07             	movzbl (%rdi),%eax
+  80260c:	84 c0                	test   %al,%al
+  80260e:	74 13                	je     802623 <strcmp+0x1a>
+  802610:	38 06                	cmp    %al,(%rsi)
+  802612:	75 0f                	jne    802623 <strcmp+0x1a>
+  802614:	48 83 c7 01          	add    $0x1,%rdi
+  802618:	48 83 c6 01          	add    $0x1,%rsi
+  80261c:	0f b6 07             	movzbl (%rdi),%eax
+  80261f:	84 c0                	test   %al,%al
+  802621:	75 ed                	jne    802610 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802623:	0f b6 c0             	movzbl %al,%eax
+  802626:	0f b6 16             	movzbl (%rsi),%edx
+  802629:	29 d0                	sub    %edx,%eax
+}
+  80262b:	c3                   	ret
+
+000000000080262c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80262c:	48 85 d2             	test   %rdx,%rdx
+  80262f:	74 1f                	je     802650 <strncmp+0x24>
+  802631:	0f b6 07             	movzbl (%rdi),%eax
+  802634:	84 c0                	test   %al,%al
+  802636:	74 1e                	je     802656 <strncmp+0x2a>
+  802638:	3a 06                	cmp    (%rsi),%al
+  80263a:	75 1a                	jne    802656 <strncmp+0x2a>
+  80263c:	48 83 c7 01          	add    $0x1,%rdi
+  802640:	48 83 c6 01          	add    $0x1,%rsi
+  802644:	48 83 ea 01          	sub    $0x1,%rdx
+  802648:	75 e7                	jne    802631 <strncmp+0x5>
+
+    if (!n) return 0;
+  80264a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80264f:	c3                   	ret
+  802650:	b8 00 00 00 00       	mov    $0x0,%eax
+  802655:	c3                   	ret
+  802656:	48 85 d2             	test   %rdx,%rdx
+  802659:	74 09                	je     802664 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80265b:	0f b6 07             	movzbl (%rdi),%eax
+  80265e:	0f b6 16             	movzbl (%rsi),%edx
+  802661:	29 d0                	sub    %edx,%eax
+  802663:	c3                   	ret
+    if (!n) return 0;
+  802664:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802669:	c3                   	ret
+
+000000000080266a <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80266a:	0f b6 17             	movzbl (%rdi),%edx
+  80266d:	84 d2                	test   %dl,%dl
+  80266f:	74 18                	je     802689 <strchr+0x1f>
+        if (*str == c) {
+  802671:	0f be d2             	movsbl %dl,%edx
+  802674:	39 f2                	cmp    %esi,%edx
+  802676:	74 17                	je     80268f <strchr+0x25>
+    for (; *str; str++) {
+  802678:	48 83 c7 01          	add    $0x1,%rdi
+  80267c:	0f b6 17             	movzbl (%rdi),%edx
+  80267f:	84 d2                	test   %dl,%dl
+  802681:	75 ee                	jne    802671 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802683:	b8 00 00 00 00       	mov    $0x0,%eax
+  802688:	c3                   	ret
+  802689:	b8 00 00 00 00       	mov    $0x0,%eax
+  80268e:	c3                   	ret
+  80268f:	48 89 f8             	mov    %rdi,%rax
+}
+  802692:	c3                   	ret
+
+0000000000802693 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802693:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802696:	0f b6 17             	movzbl (%rdi),%edx
+  802699:	84 d2                	test   %dl,%dl
+  80269b:	74 13                	je     8026b0 <strfind+0x1d>
+  80269d:	0f be d2             	movsbl %dl,%edx
+  8026a0:	39 f2                	cmp    %esi,%edx
+  8026a2:	74 0b                	je     8026af <strfind+0x1c>
+  8026a4:	48 83 c0 01          	add    $0x1,%rax
+  8026a8:	0f b6 10             	movzbl (%rax),%edx
+  8026ab:	84 d2                	test   %dl,%dl
+  8026ad:	75 ee                	jne    80269d <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8026af:	c3                   	ret
+  8026b0:	c3                   	ret
+
+00000000008026b1 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8026b1:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8026b4:	48 89 f8             	mov    %rdi,%rax
+  8026b7:	48 f7 d8             	neg    %rax
+  8026ba:	83 e0 07             	and    $0x7,%eax
+  8026bd:	49 89 d1             	mov    %rdx,%r9
+  8026c0:	49 29 c1             	sub    %rax,%r9
+  8026c3:	78 36                	js     8026fb <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8026c5:	40 0f b6 c6          	movzbl %sil,%eax
+  8026c9:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8026d0:	01 01 01 
+  8026d3:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8026d7:	40 f6 c7 07          	test   $0x7,%dil
+  8026db:	75 38                	jne    802715 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8026dd:	4c 89 c9             	mov    %r9,%rcx
+  8026e0:	48 c1 f9 03          	sar    $0x3,%rcx
+  8026e4:	74 0c                	je     8026f2 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8026e6:	fc                   	cld
+  8026e7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8026ea:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8026ee:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8026f2:	4d 85 c9             	test   %r9,%r9
+  8026f5:	75 45                	jne    80273c <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8026f7:	4c 89 c0             	mov    %r8,%rax
+  8026fa:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8026fb:	48 85 d2             	test   %rdx,%rdx
+  8026fe:	74 f7                	je     8026f7 <memset+0x46>
+  802700:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802703:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802706:	48 83 c0 01          	add    $0x1,%rax
+  80270a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80270e:	48 39 c2             	cmp    %rax,%rdx
+  802711:	75 f3                	jne    802706 <memset+0x55>
+  802713:	eb e2                	jmp    8026f7 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802715:	40 f6 c7 01          	test   $0x1,%dil
+  802719:	74 06                	je     802721 <memset+0x70>
+  80271b:	88 07                	mov    %al,(%rdi)
+  80271d:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802721:	40 f6 c7 02          	test   $0x2,%dil
+  802725:	74 07                	je     80272e <memset+0x7d>
+  802727:	66 89 07             	mov    %ax,(%rdi)
+  80272a:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80272e:	40 f6 c7 04          	test   $0x4,%dil
+  802732:	74 a9                	je     8026dd <memset+0x2c>
+  802734:	89 07                	mov    %eax,(%rdi)
+  802736:	48 83 c7 04          	add    $0x4,%rdi
+  80273a:	eb a1                	jmp    8026dd <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80273c:	41 f6 c1 04          	test   $0x4,%r9b
+  802740:	74 06                	je     802748 <memset+0x97>
+  802742:	89 07                	mov    %eax,(%rdi)
+  802744:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802748:	41 f6 c1 02          	test   $0x2,%r9b
+  80274c:	74 07                	je     802755 <memset+0xa4>
+  80274e:	66 89 07             	mov    %ax,(%rdi)
+  802751:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802755:	41 f6 c1 01          	test   $0x1,%r9b
+  802759:	74 9c                	je     8026f7 <memset+0x46>
+  80275b:	88 07                	mov    %al,(%rdi)
+  80275d:	eb 98                	jmp    8026f7 <memset+0x46>
+
+000000000080275f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80275f:	48 89 f8             	mov    %rdi,%rax
+  802762:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802765:	48 39 fe             	cmp    %rdi,%rsi
+  802768:	73 3b                	jae    8027a5 <memmove+0x46>
+  80276a:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80276e:	48 39 d7             	cmp    %rdx,%rdi
+  802771:	73 32                	jae    8027a5 <memmove+0x46>
+        s += n;
+        d += n;
+  802773:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802777:	48 89 d6             	mov    %rdx,%rsi
+  80277a:	48 09 fe             	or     %rdi,%rsi
+  80277d:	48 09 ce             	or     %rcx,%rsi
+  802780:	40 f6 c6 07          	test   $0x7,%sil
+  802784:	75 12                	jne    802798 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802786:	48 83 ef 08          	sub    $0x8,%rdi
+  80278a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80278e:	48 c1 e9 03          	shr    $0x3,%rcx
+  802792:	fd                   	std
+  802793:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802796:	fc                   	cld
+  802797:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802798:	48 83 ef 01          	sub    $0x1,%rdi
+  80279c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8027a0:	fd                   	std
+  8027a1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8027a3:	eb f1                	jmp    802796 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8027a5:	48 89 f2             	mov    %rsi,%rdx
+  8027a8:	48 09 c2             	or     %rax,%rdx
+  8027ab:	48 09 ca             	or     %rcx,%rdx
+  8027ae:	f6 c2 07             	test   $0x7,%dl
+  8027b1:	75 0c                	jne    8027bf <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8027b3:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027b7:	48 89 c7             	mov    %rax,%rdi
+  8027ba:	fc                   	cld
+  8027bb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8027be:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8027bf:	48 89 c7             	mov    %rax,%rdi
+  8027c2:	fc                   	cld
+  8027c3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8027c5:	c3                   	ret
+
+00000000008027c6 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8027c6:	55                   	push   %rbp
+  8027c7:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8027ca:	48 b8 5f 27 80 00 00 	movabs $0x80275f,%rax
+  8027d1:	00 00 00 
+  8027d4:	ff d0                	call   *%rax
+}
+  8027d6:	5d                   	pop    %rbp
+  8027d7:	c3                   	ret
+
+00000000008027d8 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8027d8:	55                   	push   %rbp
+  8027d9:	48 89 e5             	mov    %rsp,%rbp
+  8027dc:	41 57                	push   %r15
+  8027de:	41 56                	push   %r14
+  8027e0:	41 55                	push   %r13
+  8027e2:	41 54                	push   %r12
+  8027e4:	53                   	push   %rbx
+  8027e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8027e9:	49 89 fe             	mov    %rdi,%r14
+  8027ec:	49 89 f7             	mov    %rsi,%r15
+  8027ef:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8027f2:	48 89 f7             	mov    %rsi,%rdi
+  8027f5:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  8027fc:	00 00 00 
+  8027ff:	ff d0                	call   *%rax
+  802801:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802804:	48 89 de             	mov    %rbx,%rsi
+  802807:	4c 89 f7             	mov    %r14,%rdi
+  80280a:	48 b8 42 25 80 00 00 	movabs $0x802542,%rax
+  802811:	00 00 00 
+  802814:	ff d0                	call   *%rax
+  802816:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802819:	48 39 c3             	cmp    %rax,%rbx
+  80281c:	74 36                	je     802854 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80281e:	48 89 d8             	mov    %rbx,%rax
+  802821:	4c 29 e8             	sub    %r13,%rax
+  802824:	49 39 c4             	cmp    %rax,%r12
+  802827:	73 31                	jae    80285a <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802829:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80282e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802832:	4c 89 fe             	mov    %r15,%rsi
+  802835:	48 b8 c6 27 80 00 00 	movabs $0x8027c6,%rax
+  80283c:	00 00 00 
+  80283f:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802841:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802845:	48 83 c4 08          	add    $0x8,%rsp
+  802849:	5b                   	pop    %rbx
+  80284a:	41 5c                	pop    %r12
+  80284c:	41 5d                	pop    %r13
+  80284e:	41 5e                	pop    %r14
+  802850:	41 5f                	pop    %r15
+  802852:	5d                   	pop    %rbp
+  802853:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802854:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802858:	eb eb                	jmp    802845 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80285a:	48 83 eb 01          	sub    $0x1,%rbx
+  80285e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802862:	48 89 da             	mov    %rbx,%rdx
+  802865:	4c 89 fe             	mov    %r15,%rsi
+  802868:	48 b8 c6 27 80 00 00 	movabs $0x8027c6,%rax
+  80286f:	00 00 00 
+  802872:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802874:	49 01 de             	add    %rbx,%r14
+  802877:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80287c:	eb c3                	jmp    802841 <strlcat+0x69>
+
+000000000080287e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80287e:	48 85 d2             	test   %rdx,%rdx
+  802881:	74 2d                	je     8028b0 <memcmp+0x32>
+  802883:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802888:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80288c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802891:	44 38 c1             	cmp    %r8b,%cl
+  802894:	75 0f                	jne    8028a5 <memcmp+0x27>
+    while (n-- > 0) {
+  802896:	48 83 c0 01          	add    $0x1,%rax
+  80289a:	48 39 c2             	cmp    %rax,%rdx
+  80289d:	75 e9                	jne    802888 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80289f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a4:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8028a5:	0f b6 c1             	movzbl %cl,%eax
+  8028a8:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8028ac:	44 29 c0             	sub    %r8d,%eax
+  8028af:	c3                   	ret
+    return 0;
+  8028b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028b5:	c3                   	ret
+
+00000000008028b6 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8028b6:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8028ba:	48 39 c7             	cmp    %rax,%rdi
+  8028bd:	73 0f                	jae    8028ce <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8028bf:	40 38 37             	cmp    %sil,(%rdi)
+  8028c2:	74 0e                	je     8028d2 <memfind+0x1c>
+    for (; src < end; src++) {
+  8028c4:	48 83 c7 01          	add    $0x1,%rdi
+  8028c8:	48 39 f8             	cmp    %rdi,%rax
+  8028cb:	75 f2                	jne    8028bf <memfind+0x9>
+  8028cd:	c3                   	ret
+  8028ce:	48 89 f8             	mov    %rdi,%rax
+  8028d1:	c3                   	ret
+  8028d2:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8028d5:	c3                   	ret
+
+00000000008028d6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8028d6:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8028d9:	0f b6 37             	movzbl (%rdi),%esi
+  8028dc:	40 80 fe 20          	cmp    $0x20,%sil
+  8028e0:	74 06                	je     8028e8 <strtol+0x12>
+  8028e2:	40 80 fe 09          	cmp    $0x9,%sil
+  8028e6:	75 13                	jne    8028fb <strtol+0x25>
+  8028e8:	48 83 c7 01          	add    $0x1,%rdi
+  8028ec:	0f b6 37             	movzbl (%rdi),%esi
+  8028ef:	40 80 fe 20          	cmp    $0x20,%sil
+  8028f3:	74 f3                	je     8028e8 <strtol+0x12>
+  8028f5:	40 80 fe 09          	cmp    $0x9,%sil
+  8028f9:	74 ed                	je     8028e8 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8028fb:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8028fe:	83 e0 fd             	and    $0xfffffffd,%eax
+  802901:	3c 01                	cmp    $0x1,%al
+  802903:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802907:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80290d:	75 0f                	jne    80291e <strtol+0x48>
+  80290f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802912:	74 14                	je     802928 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802914:	85 d2                	test   %edx,%edx
+  802916:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80291b:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80291e:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802923:	4c 63 ca             	movslq %edx,%r9
+  802926:	eb 36                	jmp    80295e <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802928:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80292c:	74 0f                	je     80293d <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80292e:	85 d2                	test   %edx,%edx
+  802930:	75 ec                	jne    80291e <strtol+0x48>
+        s++;
+  802932:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802936:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80293b:	eb e1                	jmp    80291e <strtol+0x48>
+        s += 2;
+  80293d:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802941:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802946:	eb d6                	jmp    80291e <strtol+0x48>
+            dig -= '0';
+  802948:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80294b:	44 0f b6 c1          	movzbl %cl,%r8d
+  80294f:	41 39 d0             	cmp    %edx,%r8d
+  802952:	7d 21                	jge    802975 <strtol+0x9f>
+        val = val * base + dig;
+  802954:	49 0f af c1          	imul   %r9,%rax
+  802958:	0f b6 c9             	movzbl %cl,%ecx
+  80295b:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80295e:	48 83 c7 01          	add    $0x1,%rdi
+  802962:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802966:	80 f9 39             	cmp    $0x39,%cl
+  802969:	76 dd                	jbe    802948 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80296b:	80 f9 7b             	cmp    $0x7b,%cl
+  80296e:	77 05                	ja     802975 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802970:	83 e9 57             	sub    $0x57,%ecx
+  802973:	eb d6                	jmp    80294b <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802975:	4d 85 d2             	test   %r10,%r10
+  802978:	74 03                	je     80297d <strtol+0xa7>
+  80297a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80297d:	48 89 c2             	mov    %rax,%rdx
+  802980:	48 f7 da             	neg    %rdx
+  802983:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802987:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80298b:	c3                   	ret
+
+000000000080298c <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80298c:	55                   	push   %rbp
+  80298d:	48 89 e5             	mov    %rsp,%rbp
+  802990:	41 54                	push   %r12
+  802992:	53                   	push   %rbx
+  802993:	48 89 fb             	mov    %rdi,%rbx
+  802996:	48 89 f7             	mov    %rsi,%rdi
+  802999:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  80299c:	48 85 f6             	test   %rsi,%rsi
+  80299f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029a6:	00 00 00 
+  8029a9:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8029ad:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029b2:	48 b8 e5 05 80 00 00 	movabs $0x8005e5,%rax
+  8029b9:	00 00 00 
+  8029bc:	ff d0                	call   *%rax
+    if (res < 0) {
+  8029be:	85 c0                	test   %eax,%eax
+  8029c0:	78 45                	js     802a07 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  8029c2:	48 85 db             	test   %rbx,%rbx
+  8029c5:	74 12                	je     8029d9 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  8029c7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029ce:	00 00 00 
+  8029d1:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8029d7:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  8029d9:	4d 85 e4             	test   %r12,%r12
+  8029dc:	74 14                	je     8029f2 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  8029de:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029e5:	00 00 00 
+  8029e8:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8029ee:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  8029f2:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8029f9:	00 00 00 
+  8029fc:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802a02:	5b                   	pop    %rbx
+  802a03:	41 5c                	pop    %r12
+  802a05:	5d                   	pop    %rbp
+  802a06:	c3                   	ret
+        if (from_env_store)
+  802a07:	48 85 db             	test   %rbx,%rbx
+  802a0a:	74 06                	je     802a12 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802a0c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802a12:	4d 85 e4             	test   %r12,%r12
+  802a15:	74 eb                	je     802a02 <ipc_recv+0x76>
+            *perm_store = 0;
+  802a17:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802a1e:	00 
+  802a1f:	eb e1                	jmp    802a02 <ipc_recv+0x76>
+
+0000000000802a21 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802a21:	55                   	push   %rbp
+  802a22:	48 89 e5             	mov    %rsp,%rbp
+  802a25:	41 57                	push   %r15
+  802a27:	41 56                	push   %r14
+  802a29:	41 55                	push   %r13
+  802a2b:	41 54                	push   %r12
+  802a2d:	53                   	push   %rbx
+  802a2e:	48 83 ec 18          	sub    $0x18,%rsp
+  802a32:	41 89 fd             	mov    %edi,%r13d
+  802a35:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802a38:	48 89 d3             	mov    %rdx,%rbx
+  802a3b:	49 89 cc             	mov    %rcx,%r12
+  802a3e:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a42:	48 85 d2             	test   %rdx,%rdx
+  802a45:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a4c:	00 00 00 
+  802a4f:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a53:	49 be b9 05 80 00 00 	movabs $0x8005b9,%r14
+  802a5a:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802a5d:	49 bf ec 01 80 00 00 	movabs $0x8001ec,%r15
+  802a64:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802a67:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802a6a:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802a6e:	4c 89 e1             	mov    %r12,%rcx
+  802a71:	48 89 da             	mov    %rbx,%rdx
+  802a74:	44 89 ef             	mov    %r13d,%edi
+  802a77:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802a7a:	85 c0                	test   %eax,%eax
+  802a7c:	74 34                	je     802ab2 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802a7e:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802a81:	75 05                	jne    802a88 <ipc_send+0x67>
+        sys_yield();
+  802a83:	41 ff d7             	call   *%r15
+    while (true) {
+  802a86:	eb df                	jmp    802a67 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802a88:	48 ba cf 31 80 00 00 	movabs $0x8031cf,%rdx
+  802a8f:	00 00 00 
+  802a92:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802a97:	48 bf e8 31 80 00 00 	movabs $0x8031e8,%rdi
+  802a9e:	00 00 00 
+  802aa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa6:	48 b9 f0 1a 80 00 00 	movabs $0x801af0,%rcx
+  802aad:	00 00 00 
+  802ab0:	ff d1                	call   *%rcx
+    }
+}
+  802ab2:	48 83 c4 18          	add    $0x18,%rsp
+  802ab6:	5b                   	pop    %rbx
+  802ab7:	41 5c                	pop    %r12
+  802ab9:	41 5d                	pop    %r13
+  802abb:	41 5e                	pop    %r14
+  802abd:	41 5f                	pop    %r15
+  802abf:	5d                   	pop    %rbp
+  802ac0:	c3                   	ret
+
+0000000000802ac1 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802ac6:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802acd:	00 00 00 
+  802ad0:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802ad7:	48 01 ca             	add    %rcx,%rdx
+  802ada:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802ae0:	39 fa                	cmp    %edi,%edx
+  802ae2:	74 12                	je     802af6 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802ae4:	48 83 c0 01          	add    $0x1,%rax
+  802ae8:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802aee:	75 e0                	jne    802ad0 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802af0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802af5:	c3                   	ret
+            return envs[i].env_id;
+  802af6:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802afd:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b04:	00 00 00 
+  802b07:	48 01 d0             	add    %rdx,%rax
+  802b0a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b10:	c3                   	ret
+  802b11:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000802b18 <__rodata_start>:
+  802b18:	3c 75                	cmp    $0x75,%al
+  802b1a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b1b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b1f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b20:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802b24:	1f                   	(bad)
+  802b25:	44 00 00             	add    %r8b,(%rax)
+  802b28:	73 79                	jae    802ba3 <__rodata_start+0x8b>
+  802b2a:	73 63                	jae    802b8f <__rodata_start+0x77>
+  802b2c:	61                   	(bad)
+  802b2d:	6c                   	insb   (%dx),%es:(%rdi)
+  802b2e:	6c                   	insb   (%dx),%es:(%rdi)
+  802b2f:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a08faf <__bss_end+0x72200faf>
+  802b35:	65 74 75             	gs je  802bad <__rodata_start+0x95>
+  802b38:	72 6e                	jb     802ba8 <__rodata_start+0x90>
+  802b3a:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a08fbc <__bss_end+0x28200fbc>
+  802b41:	28 
+  802b42:	3e 20 30             	ds and %dh,(%rax)
+  802b45:	29 00                	sub    %eax,(%rax)
+  802b47:	6c                   	insb   (%dx),%es:(%rdi)
+  802b48:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802b4f:	61                   	(bad)
+  802b50:	6c                   	insb   (%dx),%es:(%rdi)
+  802b51:	6c                   	insb   (%dx),%es:(%rdi)
+  802b52:	2e 63 00             	cs movsxd (%rax),%eax
+  802b55:	0f 1f 00             	nopl   (%rax)
+  802b58:	5b                   	pop    %rbx
+  802b59:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b5e:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802b61:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802b65:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b66:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802b6a:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802b71:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 8035dc <error_string+0x4dc>
+  802b78:	5b                   	pop    %rbx
+  802b79:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b7e:	20 66 74             	and    %ah,0x74(%rsi)
+  802b81:	72 75                	jb     802bf8 <devtab+0x18>
+  802b83:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802b84:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802b87:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4bf2 <__bss_end+0x2d2ccbf2>
+  802b8e:	20 62 61             	and    %ah,0x61(%rdx)
+  802b91:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802b95:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802b99:	5b                   	pop    %rbx
+  802b9a:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802b9f:	20 72 65             	and    %dh,0x65(%rdx)
+  802ba2:	61                   	(bad)
+  802ba3:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4c0e <__bss_end+0x2d2ccc0e>
+  802baa:	20 62 61             	and    %ah,0x61(%rdx)
+  802bad:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802bb1:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bb5:	5b                   	pop    %rbx
+  802bb6:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802bbb:	20 77 72             	and    %dh,0x72(%rdi)
+  802bbe:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802bc5:	2d 
+  802bc6:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802bcb:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802bce:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802bd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802bd9:	00 00 00 
+  802bdc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000802be0 <devtab>:
+  802be0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802bf0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802c00:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802c10:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802c20:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802c30:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802c40:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802c50:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802c60:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802c70:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802c80:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802c90:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802ca0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802cb0:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802cc0:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802cd0:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802ce0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802cf0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802d00:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802d10:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802d20:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802d30:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802d40:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802d50:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802d60:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802d70:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802d80:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802d90:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802da0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802db0:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802dc0:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802dd0:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802de0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802df0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802e00:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802e10:	64 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     d.operation not 
+  802e20:	70 65 72 6d 69 74 74 65 64 00 66 2e 0f 1f 84 00     permitted.f.....
+  802e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
+  802e40:	2d 1e 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     -.......n$......
+  802e50:	5e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     ^$......n$......
+  802e60:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  802e70:	6e 24 80 00 00 00 00 00 4c 1e 80 00 00 00 00 00     n$......L.......
+  802e80:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  802e90:	40 1e 80 00 00 00 00 00 ba 1e 80 00 00 00 00 00     @...............
+  802ea0:	6e 24 80 00 00 00 00 00 40 1e 80 00 00 00 00 00     n$......@.......
+  802eb0:	86 1e 80 00 00 00 00 00 86 1e 80 00 00 00 00 00     ................
+  802ec0:	86 1e 80 00 00 00 00 00 86 1e 80 00 00 00 00 00     ................
+  802ed0:	86 1e 80 00 00 00 00 00 86 1e 80 00 00 00 00 00     ................
+  802ee0:	86 1e 80 00 00 00 00 00 86 1e 80 00 00 00 00 00     ................
+  802ef0:	86 1e 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     ........n$......
+  802f00:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  802f10:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  802f20:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  802f30:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  802f40:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  802f50:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  802f60:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  802f70:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  802f80:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  802f90:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  802fa0:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  802fb0:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  802fc0:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  802fd0:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  802fe0:	6e 24 80 00 00 00 00 00 91 23 80 00 00 00 00 00     n$.......#......
+  802ff0:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  803000:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  803010:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  803020:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  803030:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  803040:	dd 1e 80 00 00 00 00 00 ac 20 80 00 00 00 00 00     ......... ......
+  803050:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  803060:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  803070:	0c 1f 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     ........n$......
+  803080:	6e 24 80 00 00 00 00 00 d2 1e 80 00 00 00 00 00     n$..............
+  803090:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  8030a0:	54 22 80 00 00 00 00 00 1e 23 80 00 00 00 00 00     T".......#......
+  8030b0:	6e 24 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     n$......n$......
+  8030c0:	a3 1f 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     ........n$......
+  8030d0:	80 21 80 00 00 00 00 00 6e 24 80 00 00 00 00 00     .!......n$......
+  8030e0:	6e 24 80 00 00 00 00 00 91 23 80 00 00 00 00 00     n$.......#......
+  8030f0:	6e 24 80 00 00 00 00 00 36 1e 80 00 00 00 00 00     n$......6.......
+
+0000000000803100 <error_string>:
+	...
+  803108:	b5 2c 80 00 00 00 00 00 c7 2c 80 00 00 00 00 00     .,.......,......
+  803118:	d7 2c 80 00 00 00 00 00 e9 2c 80 00 00 00 00 00     .,.......,......
+  803128:	f7 2c 80 00 00 00 00 00 0b 2d 80 00 00 00 00 00     .,.......-......
+  803138:	20 2d 80 00 00 00 00 00 33 2d 80 00 00 00 00 00      -......3-......
+  803148:	45 2d 80 00 00 00 00 00 59 2d 80 00 00 00 00 00     E-......Y-......
+  803158:	69 2d 80 00 00 00 00 00 7c 2d 80 00 00 00 00 00     i-......|-......
+  803168:	93 2d 80 00 00 00 00 00 a9 2d 80 00 00 00 00 00     .-.......-......
+  803178:	c1 2d 80 00 00 00 00 00 d9 2d 80 00 00 00 00 00     .-.......-......
+  803188:	e6 2d 80 00 00 00 00 00 b0 31 80 00 00 00 00 00     .-.......1......
+  803198:	fa 2d 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .-..............
+  8031a8:	12 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ........file is 
+  8031b8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8031c8:	75 74 61 62 6c 65 00 69 70 63 5f 73 65 6e 64 3a     utable.ipc_send:
+  8031d8:	20 66 61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00      failed to send.
+  8031e8:	6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00     lib/ipc.c.f.....
+  8031f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803208:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803218:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803228:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803238:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803248:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803258:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803268:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803278:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803288:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803298:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8032b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8032c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8032d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8032e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8032f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803308:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803318:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803328:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803338:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803348:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803358:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803368:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803378:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803388:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803398:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803408:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803418:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803428:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803438:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803448:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803458:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803468:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803478:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803488:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803498:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803508:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803518:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803528:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803538:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803548:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803558:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803568:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803578:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803588:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803598:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035a8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035b8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803608:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803618:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803628:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803638:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803648:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803658:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803668:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803678:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803688:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803698:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803708:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803718:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803728:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803738:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803748:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803758:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803768:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803778:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803788:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803798:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803808:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803818:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803828:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803838:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803848:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803858:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803868:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803878:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803888:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803898:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803908:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803918:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803928:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803938:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803948:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803958:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803968:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803978:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803988:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803998:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039a8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039b8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039d8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039e8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039f8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803aa8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ab8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ac8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ad8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ae8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803af8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ba8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bb8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bc8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bd8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803be8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bf8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ca8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cb8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cc8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cd8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ce8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cf8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803da8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803db8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dc8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dd8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803de8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803df8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ea8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803eb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ec8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ed8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ee8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ef8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fa8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fe8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ff8:	0f 1f 84 00 00 00 00 00                             ........
@@ -0,0 +1,6222 @@
+
+obj/user/spawnhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 87 00 00 00       	call   8000aa <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    int r;
+    cprintf("i am parent environment %08x\n", thisenv->env_id);
+  800029:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800030:	00 00 00 
+  800033:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800039:	48 bf e0 33 80 00 00 	movabs $0x8033e0,%rdi
+  800040:	00 00 00 
+  800043:	b8 00 00 00 00       	mov    $0x0,%eax
+  800048:	48 ba c4 02 80 00 00 	movabs $0x8002c4,%rdx
+  80004f:	00 00 00 
+  800052:	ff d2                	call   *%rdx
+    if ((r = spawnl("hello", "hello", 0)) < 0)
+  800054:	ba 00 00 00 00       	mov    $0x0,%edx
+  800059:	48 bf fe 33 80 00 00 	movabs $0x8033fe,%rdi
+  800060:	00 00 00 
+  800063:	48 89 fe             	mov    %rdi,%rsi
+  800066:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006b:	48 b9 80 28 80 00 00 	movabs $0x802880,%rcx
+  800072:	00 00 00 
+  800075:	ff d1                	call   *%rcx
+  800077:	85 c0                	test   %eax,%eax
+  800079:	78 02                	js     80007d <umain+0x58>
+        panic("spawn(hello) failed: %i", r);
+}
+  80007b:	5d                   	pop    %rbp
+  80007c:	c3                   	ret
+        panic("spawn(hello) failed: %i", r);
+  80007d:	89 c1                	mov    %eax,%ecx
+  80007f:	48 ba 04 34 80 00 00 	movabs $0x803404,%rdx
+  800086:	00 00 00 
+  800089:	be 08 00 00 00       	mov    $0x8,%esi
+  80008e:	48 bf 1c 34 80 00 00 	movabs $0x80341c,%rdi
+  800095:	00 00 00 
+  800098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009d:	49 b8 74 01 80 00 00 	movabs $0x800174,%r8
+  8000a4:	00 00 00 
+  8000a7:	41 ff d0             	call   *%r8
+
+00000000008000aa <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000aa:	55                   	push   %rbp
+  8000ab:	48 89 e5             	mov    %rsp,%rbp
+  8000ae:	41 56                	push   %r14
+  8000b0:	41 55                	push   %r13
+  8000b2:	41 54                	push   %r12
+  8000b4:	53                   	push   %rbx
+  8000b5:	41 89 fd             	mov    %edi,%r13d
+  8000b8:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000bb:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8000c2:	00 00 00 
+  8000c5:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8000cc:	00 00 00 
+  8000cf:	48 39 c2             	cmp    %rax,%rdx
+  8000d2:	73 17                	jae    8000eb <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8000d4:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000d7:	49 89 c4             	mov    %rax,%r12
+  8000da:	48 83 c3 08          	add    $0x8,%rbx
+  8000de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e3:	ff 53 f8             	call   *-0x8(%rbx)
+  8000e6:	4c 39 e3             	cmp    %r12,%rbx
+  8000e9:	72 ef                	jb     8000da <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8000eb:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  8000f2:	00 00 00 
+  8000f5:	ff d0                	call   *%rax
+  8000f7:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8000fa:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800101:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800108:	00 00 00 
+  80010b:	48 01 d0             	add    %rdx,%rax
+  80010e:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800115:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800118:	45 85 ed             	test   %r13d,%r13d
+  80011b:	7e 0d                	jle    80012a <libmain+0x80>
+  80011d:	49 8b 06             	mov    (%r14),%rax
+  800120:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800127:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80012a:	4c 89 f6             	mov    %r14,%rsi
+  80012d:	44 89 ef             	mov    %r13d,%edi
+  800130:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800137:	00 00 00 
+  80013a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80013c:	48 b8 51 01 80 00 00 	movabs $0x800151,%rax
+  800143:	00 00 00 
+  800146:	ff d0                	call   *%rax
+#endif
+}
+  800148:	5b                   	pop    %rbx
+  800149:	41 5c                	pop    %r12
+  80014b:	41 5d                	pop    %r13
+  80014d:	41 5e                	pop    %r14
+  80014f:	5d                   	pop    %rbp
+  800150:	c3                   	ret
+
+0000000000800151 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800151:	55                   	push   %rbp
+  800152:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800155:	48 b8 61 19 80 00 00 	movabs $0x801961,%rax
+  80015c:	00 00 00 
+  80015f:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800161:	bf 00 00 00 00       	mov    $0x0,%edi
+  800166:	48 b8 6e 10 80 00 00 	movabs $0x80106e,%rax
+  80016d:	00 00 00 
+  800170:	ff d0                	call   *%rax
+}
+  800172:	5d                   	pop    %rbp
+  800173:	c3                   	ret
+
+0000000000800174 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800174:	55                   	push   %rbp
+  800175:	48 89 e5             	mov    %rsp,%rbp
+  800178:	41 56                	push   %r14
+  80017a:	41 55                	push   %r13
+  80017c:	41 54                	push   %r12
+  80017e:	53                   	push   %rbx
+  80017f:	48 83 ec 50          	sub    $0x50,%rsp
+  800183:	49 89 fc             	mov    %rdi,%r12
+  800186:	41 89 f5             	mov    %esi,%r13d
+  800189:	48 89 d3             	mov    %rdx,%rbx
+  80018c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800190:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800194:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800198:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80019f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001a3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8001a7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8001ab:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001af:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8001b6:	00 00 00 
+  8001b9:	4c 8b 30             	mov    (%rax),%r14
+  8001bc:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  8001c3:	00 00 00 
+  8001c6:	ff d0                	call   *%rax
+  8001c8:	89 c6                	mov    %eax,%esi
+  8001ca:	45 89 e8             	mov    %r13d,%r8d
+  8001cd:	4c 89 e1             	mov    %r12,%rcx
+  8001d0:	4c 89 f2             	mov    %r14,%rdx
+  8001d3:	48 bf 38 34 80 00 00 	movabs $0x803438,%rdi
+  8001da:	00 00 00 
+  8001dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e2:	49 bc c4 02 80 00 00 	movabs $0x8002c4,%r12
+  8001e9:	00 00 00 
+  8001ec:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8001ef:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8001f3:	48 89 df             	mov    %rbx,%rdi
+  8001f6:	48 b8 60 02 80 00 00 	movabs $0x800260,%rax
+  8001fd:	00 00 00 
+  800200:	ff d0                	call   *%rax
+    cprintf("\n");
+  800202:	48 bf 3b 3a 80 00 00 	movabs $0x803a3b,%rdi
+  800209:	00 00 00 
+  80020c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800211:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800214:	cc                   	int3
+  800215:	eb fd                	jmp    800214 <_panic+0xa0>
+
+0000000000800217 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800217:	55                   	push   %rbp
+  800218:	48 89 e5             	mov    %rsp,%rbp
+  80021b:	53                   	push   %rbx
+  80021c:	48 83 ec 08          	sub    $0x8,%rsp
+  800220:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800223:	8b 06                	mov    (%rsi),%eax
+  800225:	8d 50 01             	lea    0x1(%rax),%edx
+  800228:	89 16                	mov    %edx,(%rsi)
+  80022a:	48 98                	cltq
+  80022c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800231:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800237:	74 0a                	je     800243 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800239:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80023d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800241:	c9                   	leave
+  800242:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800243:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800247:	be ff 00 00 00       	mov    $0xff,%esi
+  80024c:	48 b8 10 10 80 00 00 	movabs $0x801010,%rax
+  800253:	00 00 00 
+  800256:	ff d0                	call   *%rax
+        state->offset = 0;
+  800258:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80025e:	eb d9                	jmp    800239 <putch+0x22>
+
+0000000000800260 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800260:	55                   	push   %rbp
+  800261:	48 89 e5             	mov    %rsp,%rbp
+  800264:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80026b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80026e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800275:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80027a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800282:	48 89 f1             	mov    %rsi,%rcx
+  800285:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80028c:	48 bf 17 02 80 00 00 	movabs $0x800217,%rdi
+  800293:	00 00 00 
+  800296:	48 b8 14 04 80 00 00 	movabs $0x800414,%rax
+  80029d:	00 00 00 
+  8002a0:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002a2:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002a9:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002b0:	48 b8 10 10 80 00 00 	movabs $0x801010,%rax
+  8002b7:	00 00 00 
+  8002ba:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002bc:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002c2:	c9                   	leave
+  8002c3:	c3                   	ret
+
+00000000008002c4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002c4:	55                   	push   %rbp
+  8002c5:	48 89 e5             	mov    %rsp,%rbp
+  8002c8:	48 83 ec 50          	sub    $0x50,%rsp
+  8002cc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002d0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002d4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002d8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002dc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002e0:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002e7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002ef:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002f3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002f7:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002fb:	48 b8 60 02 80 00 00 	movabs $0x800260,%rax
+  800302:	00 00 00 
+  800305:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800307:	c9                   	leave
+  800308:	c3                   	ret
+
+0000000000800309 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800309:	55                   	push   %rbp
+  80030a:	48 89 e5             	mov    %rsp,%rbp
+  80030d:	41 57                	push   %r15
+  80030f:	41 56                	push   %r14
+  800311:	41 55                	push   %r13
+  800313:	41 54                	push   %r12
+  800315:	53                   	push   %rbx
+  800316:	48 83 ec 18          	sub    $0x18,%rsp
+  80031a:	49 89 fc             	mov    %rdi,%r12
+  80031d:	49 89 f5             	mov    %rsi,%r13
+  800320:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800324:	8b 45 10             	mov    0x10(%rbp),%eax
+  800327:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80032a:	41 89 cf             	mov    %ecx,%r15d
+  80032d:	4c 39 fa             	cmp    %r15,%rdx
+  800330:	73 5b                	jae    80038d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800332:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800336:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80033a:	85 db                	test   %ebx,%ebx
+  80033c:	7e 0e                	jle    80034c <print_num+0x43>
+            putch(padc, put_arg);
+  80033e:	4c 89 ee             	mov    %r13,%rsi
+  800341:	44 89 f7             	mov    %r14d,%edi
+  800344:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800347:	83 eb 01             	sub    $0x1,%ebx
+  80034a:	75 f2                	jne    80033e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80034c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800350:	48 b9 6c 34 80 00 00 	movabs $0x80346c,%rcx
+  800357:	00 00 00 
+  80035a:	48 b8 5b 34 80 00 00 	movabs $0x80345b,%rax
+  800361:	00 00 00 
+  800364:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800368:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80036c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800371:	49 f7 f7             	div    %r15
+  800374:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800378:	4c 89 ee             	mov    %r13,%rsi
+  80037b:	41 ff d4             	call   *%r12
+}
+  80037e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800382:	5b                   	pop    %rbx
+  800383:	41 5c                	pop    %r12
+  800385:	41 5d                	pop    %r13
+  800387:	41 5e                	pop    %r14
+  800389:	41 5f                	pop    %r15
+  80038b:	5d                   	pop    %rbp
+  80038c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80038d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800391:	ba 00 00 00 00       	mov    $0x0,%edx
+  800396:	49 f7 f7             	div    %r15
+  800399:	48 83 ec 08          	sub    $0x8,%rsp
+  80039d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003a1:	52                   	push   %rdx
+  8003a2:	45 0f be c9          	movsbl %r9b,%r9d
+  8003a6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003aa:	48 89 c2             	mov    %rax,%rdx
+  8003ad:	48 b8 09 03 80 00 00 	movabs $0x800309,%rax
+  8003b4:	00 00 00 
+  8003b7:	ff d0                	call   *%rax
+  8003b9:	48 83 c4 10          	add    $0x10,%rsp
+  8003bd:	eb 8d                	jmp    80034c <print_num+0x43>
+
+00000000008003bf <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003bf:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003c3:	48 8b 06             	mov    (%rsi),%rax
+  8003c6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003ca:	73 0a                	jae    8003d6 <sprintputch+0x17>
+        *state->start++ = ch;
+  8003cc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003d0:	48 89 16             	mov    %rdx,(%rsi)
+  8003d3:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003d6:	c3                   	ret
+
+00000000008003d7 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003d7:	55                   	push   %rbp
+  8003d8:	48 89 e5             	mov    %rsp,%rbp
+  8003db:	48 83 ec 50          	sub    $0x50,%rsp
+  8003df:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003e3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003e7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003eb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003f2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003fa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003fe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800402:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800406:	48 b8 14 04 80 00 00 	movabs $0x800414,%rax
+  80040d:	00 00 00 
+  800410:	ff d0                	call   *%rax
+}
+  800412:	c9                   	leave
+  800413:	c3                   	ret
+
+0000000000800414 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800414:	55                   	push   %rbp
+  800415:	48 89 e5             	mov    %rsp,%rbp
+  800418:	41 57                	push   %r15
+  80041a:	41 56                	push   %r14
+  80041c:	41 55                	push   %r13
+  80041e:	41 54                	push   %r12
+  800420:	53                   	push   %rbx
+  800421:	48 83 ec 38          	sub    $0x38,%rsp
+  800425:	49 89 fe             	mov    %rdi,%r14
+  800428:	49 89 f5             	mov    %rsi,%r13
+  80042b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80042e:	48 8b 01             	mov    (%rcx),%rax
+  800431:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800435:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800439:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80043d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800441:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800445:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800449:	0f b6 3b             	movzbl (%rbx),%edi
+  80044c:	40 80 ff 25          	cmp    $0x25,%dil
+  800450:	74 18                	je     80046a <vprintfmt+0x56>
+            if (!ch) return;
+  800452:	40 84 ff             	test   %dil,%dil
+  800455:	0f 84 b1 06 00 00    	je     800b0c <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80045b:	40 0f b6 ff          	movzbl %dil,%edi
+  80045f:	4c 89 ee             	mov    %r13,%rsi
+  800462:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800465:	4c 89 e3             	mov    %r12,%rbx
+  800468:	eb db                	jmp    800445 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80046a:	be 00 00 00 00       	mov    $0x0,%esi
+  80046f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800473:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800478:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80047e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800485:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800489:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80048e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800493:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800496:	83 e8 23             	sub    $0x23,%eax
+  800499:	3c 57                	cmp    $0x57,%al
+  80049b:	0f 87 51 06 00 00    	ja     800af2 <vprintfmt+0x6de>
+  8004a1:	0f b6 c0             	movzbl %al,%eax
+  8004a4:	48 b9 20 36 80 00 00 	movabs $0x803620,%rcx
+  8004ab:	00 00 00 
+  8004ae:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004b1:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004b4:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004b8:	eb cf                	jmp    800489 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004ba:	49 89 dc             	mov    %rbx,%r12
+  8004bd:	be 01 00 00 00       	mov    $0x1,%esi
+  8004c2:	eb c5                	jmp    800489 <vprintfmt+0x75>
+            padc = ch;
+  8004c4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004c8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004cb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004ce:	eb b9                	jmp    800489 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8004d6:	77 24                	ja     8004fc <vprintfmt+0xe8>
+  8004d8:	89 c1                	mov    %eax,%ecx
+  8004da:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004de:	83 c0 08             	add    $0x8,%eax
+  8004e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004e4:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004e7:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004ea:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004ee:	79 99                	jns    800489 <vprintfmt+0x75>
+                width = precision;
+  8004f0:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004f4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004fa:	eb 8d                	jmp    800489 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004fc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800500:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800504:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800508:	eb da                	jmp    8004e4 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80050a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80050f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800513:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800519:	3c 39                	cmp    $0x39,%al
+  80051b:	77 1c                	ja     800539 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80051d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800521:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800525:	0f b6 c0             	movzbl %al,%eax
+  800528:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80052d:	0f b6 03             	movzbl (%rbx),%eax
+  800530:	3c 39                	cmp    $0x39,%al
+  800532:	76 e9                	jbe    80051d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800534:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800537:	eb b1                	jmp    8004ea <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800539:	49 89 dc             	mov    %rbx,%r12
+  80053c:	eb ac                	jmp    8004ea <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80053e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800541:	85 c9                	test   %ecx,%ecx
+  800543:	b8 00 00 00 00       	mov    $0x0,%eax
+  800548:	0f 49 c1             	cmovns %ecx,%eax
+  80054b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80054e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800551:	e9 33 ff ff ff       	jmp    800489 <vprintfmt+0x75>
+            lflag++;
+  800556:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800559:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80055c:	e9 28 ff ff ff       	jmp    800489 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800561:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800564:	83 f8 2f             	cmp    $0x2f,%eax
+  800567:	77 19                	ja     800582 <vprintfmt+0x16e>
+  800569:	89 c2                	mov    %eax,%edx
+  80056b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80056f:	83 c0 08             	add    $0x8,%eax
+  800572:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800575:	8b 3a                	mov    (%rdx),%edi
+  800577:	4c 89 ee             	mov    %r13,%rsi
+  80057a:	41 ff d6             	call   *%r14
+            break;
+  80057d:	e9 c3 fe ff ff       	jmp    800445 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800582:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800586:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80058a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80058e:	eb e5                	jmp    800575 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800590:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800593:	83 f8 2f             	cmp    $0x2f,%eax
+  800596:	77 5a                	ja     8005f2 <vprintfmt+0x1de>
+  800598:	89 c2                	mov    %eax,%edx
+  80059a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80059e:	83 c0 08             	add    $0x8,%eax
+  8005a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005a4:	8b 02                	mov    (%rdx),%eax
+  8005a6:	89 c1                	mov    %eax,%ecx
+  8005a8:	f7 d9                	neg    %ecx
+  8005aa:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005ad:	83 f9 15             	cmp    $0x15,%ecx
+  8005b0:	7f 4e                	jg     800600 <vprintfmt+0x1ec>
+  8005b2:	48 63 c1             	movslq %ecx,%rax
+  8005b5:	48 ba e0 38 80 00 00 	movabs $0x8038e0,%rdx
+  8005bc:	00 00 00 
+  8005bf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005c3:	48 85 c0             	test   %rax,%rax
+  8005c6:	74 38                	je     800600 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005c8:	48 89 c1             	mov    %rax,%rcx
+  8005cb:	48 ba 0c 3b 80 00 00 	movabs $0x803b0c,%rdx
+  8005d2:	00 00 00 
+  8005d5:	4c 89 ee             	mov    %r13,%rsi
+  8005d8:	4c 89 f7             	mov    %r14,%rdi
+  8005db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e0:	49 b8 d7 03 80 00 00 	movabs $0x8003d7,%r8
+  8005e7:	00 00 00 
+  8005ea:	41 ff d0             	call   *%r8
+  8005ed:	e9 53 fe ff ff       	jmp    800445 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005fe:	eb a4                	jmp    8005a4 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800600:	48 ba 84 34 80 00 00 	movabs $0x803484,%rdx
+  800607:	00 00 00 
+  80060a:	4c 89 ee             	mov    %r13,%rsi
+  80060d:	4c 89 f7             	mov    %r14,%rdi
+  800610:	b8 00 00 00 00       	mov    $0x0,%eax
+  800615:	49 b8 d7 03 80 00 00 	movabs $0x8003d7,%r8
+  80061c:	00 00 00 
+  80061f:	41 ff d0             	call   *%r8
+  800622:	e9 1e fe ff ff       	jmp    800445 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800627:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80062a:	83 f8 2f             	cmp    $0x2f,%eax
+  80062d:	77 6c                	ja     80069b <vprintfmt+0x287>
+  80062f:	89 c2                	mov    %eax,%edx
+  800631:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800635:	83 c0 08             	add    $0x8,%eax
+  800638:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80063b:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80063e:	48 85 d2             	test   %rdx,%rdx
+  800641:	48 b8 7d 34 80 00 00 	movabs $0x80347d,%rax
+  800648:	00 00 00 
+  80064b:	48 0f 45 c2          	cmovne %rdx,%rax
+  80064f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800653:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800657:	7e 06                	jle    80065f <vprintfmt+0x24b>
+  800659:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80065d:	75 4a                	jne    8006a9 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80065f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800663:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800667:	0f b6 00             	movzbl (%rax),%eax
+  80066a:	84 c0                	test   %al,%al
+  80066c:	0f 85 9a 00 00 00    	jne    80070c <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800672:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800675:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800679:	85 c0                	test   %eax,%eax
+  80067b:	0f 8e c4 fd ff ff    	jle    800445 <vprintfmt+0x31>
+  800681:	4c 89 ee             	mov    %r13,%rsi
+  800684:	bf 20 00 00 00       	mov    $0x20,%edi
+  800689:	41 ff d6             	call   *%r14
+  80068c:	41 83 ec 01          	sub    $0x1,%r12d
+  800690:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800694:	75 eb                	jne    800681 <vprintfmt+0x26d>
+  800696:	e9 aa fd ff ff       	jmp    800445 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80069b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80069f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a7:	eb 92                	jmp    80063b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006a9:	49 63 f7             	movslq %r15d,%rsi
+  8006ac:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006b0:	48 b8 c6 0b 80 00 00 	movabs $0x800bc6,%rax
+  8006b7:	00 00 00 
+  8006ba:	ff d0                	call   *%rax
+  8006bc:	48 89 c2             	mov    %rax,%rdx
+  8006bf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006c2:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006c4:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006c7:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006ca:	85 c0                	test   %eax,%eax
+  8006cc:	7e 91                	jle    80065f <vprintfmt+0x24b>
+  8006ce:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006d3:	4c 89 ee             	mov    %r13,%rsi
+  8006d6:	44 89 e7             	mov    %r12d,%edi
+  8006d9:	41 ff d6             	call   *%r14
+  8006dc:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006e0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006e3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006e6:	75 eb                	jne    8006d3 <vprintfmt+0x2bf>
+  8006e8:	e9 72 ff ff ff       	jmp    80065f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006ed:	0f b6 f8             	movzbl %al,%edi
+  8006f0:	4c 89 ee             	mov    %r13,%rsi
+  8006f3:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006f6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006fa:	49 83 c4 01          	add    $0x1,%r12
+  8006fe:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800704:	84 c0                	test   %al,%al
+  800706:	0f 84 66 ff ff ff    	je     800672 <vprintfmt+0x25e>
+  80070c:	45 85 ff             	test   %r15d,%r15d
+  80070f:	78 0a                	js     80071b <vprintfmt+0x307>
+  800711:	41 83 ef 01          	sub    $0x1,%r15d
+  800715:	0f 88 57 ff ff ff    	js     800672 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80071b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80071f:	74 cc                	je     8006ed <vprintfmt+0x2d9>
+  800721:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800724:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800729:	80 fa 5e             	cmp    $0x5e,%dl
+  80072c:	77 c2                	ja     8006f0 <vprintfmt+0x2dc>
+  80072e:	eb bd                	jmp    8006ed <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800730:	40 84 f6             	test   %sil,%sil
+  800733:	75 26                	jne    80075b <vprintfmt+0x347>
+    switch (lflag) {
+  800735:	85 d2                	test   %edx,%edx
+  800737:	74 59                	je     800792 <vprintfmt+0x37e>
+  800739:	83 fa 01             	cmp    $0x1,%edx
+  80073c:	74 7b                	je     8007b9 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80073e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800741:	83 f8 2f             	cmp    $0x2f,%eax
+  800744:	0f 87 96 00 00 00    	ja     8007e0 <vprintfmt+0x3cc>
+  80074a:	89 c2                	mov    %eax,%edx
+  80074c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800750:	83 c0 08             	add    $0x8,%eax
+  800753:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800756:	4c 8b 22             	mov    (%rdx),%r12
+  800759:	eb 17                	jmp    800772 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80075b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80075e:	83 f8 2f             	cmp    $0x2f,%eax
+  800761:	77 21                	ja     800784 <vprintfmt+0x370>
+  800763:	89 c2                	mov    %eax,%edx
+  800765:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800769:	83 c0 08             	add    $0x8,%eax
+  80076c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80076f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800772:	4d 85 e4             	test   %r12,%r12
+  800775:	78 7a                	js     8007f1 <vprintfmt+0x3dd>
+            num = i;
+  800777:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80077a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80077f:	e9 50 02 00 00       	jmp    8009d4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800784:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800788:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800790:	eb dd                	jmp    80076f <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800792:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800795:	83 f8 2f             	cmp    $0x2f,%eax
+  800798:	77 11                	ja     8007ab <vprintfmt+0x397>
+  80079a:	89 c2                	mov    %eax,%edx
+  80079c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a0:	83 c0 08             	add    $0x8,%eax
+  8007a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a6:	4c 63 22             	movslq (%rdx),%r12
+  8007a9:	eb c7                	jmp    800772 <vprintfmt+0x35e>
+  8007ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b7:	eb ed                	jmp    8007a6 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8007b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007bf:	77 11                	ja     8007d2 <vprintfmt+0x3be>
+  8007c1:	89 c2                	mov    %eax,%edx
+  8007c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c7:	83 c0 08             	add    $0x8,%eax
+  8007ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007cd:	4c 8b 22             	mov    (%rdx),%r12
+  8007d0:	eb a0                	jmp    800772 <vprintfmt+0x35e>
+  8007d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007de:	eb ed                	jmp    8007cd <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ec:	e9 65 ff ff ff       	jmp    800756 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007f1:	4c 89 ee             	mov    %r13,%rsi
+  8007f4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007f9:	41 ff d6             	call   *%r14
+                i = -i;
+  8007fc:	49 f7 dc             	neg    %r12
+  8007ff:	e9 73 ff ff ff       	jmp    800777 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800804:	40 84 f6             	test   %sil,%sil
+  800807:	75 32                	jne    80083b <vprintfmt+0x427>
+    switch (lflag) {
+  800809:	85 d2                	test   %edx,%edx
+  80080b:	74 5d                	je     80086a <vprintfmt+0x456>
+  80080d:	83 fa 01             	cmp    $0x1,%edx
+  800810:	0f 84 82 00 00 00    	je     800898 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800816:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800819:	83 f8 2f             	cmp    $0x2f,%eax
+  80081c:	0f 87 a5 00 00 00    	ja     8008c7 <vprintfmt+0x4b3>
+  800822:	89 c2                	mov    %eax,%edx
+  800824:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800828:	83 c0 08             	add    $0x8,%eax
+  80082b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800831:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800836:	e9 99 01 00 00       	jmp    8009d4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80083b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083e:	83 f8 2f             	cmp    $0x2f,%eax
+  800841:	77 19                	ja     80085c <vprintfmt+0x448>
+  800843:	89 c2                	mov    %eax,%edx
+  800845:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800849:	83 c0 08             	add    $0x8,%eax
+  80084c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800852:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800857:	e9 78 01 00 00       	jmp    8009d4 <vprintfmt+0x5c0>
+  80085c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800860:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800864:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800868:	eb e5                	jmp    80084f <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80086a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086d:	83 f8 2f             	cmp    $0x2f,%eax
+  800870:	77 18                	ja     80088a <vprintfmt+0x476>
+  800872:	89 c2                	mov    %eax,%edx
+  800874:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800878:	83 c0 08             	add    $0x8,%eax
+  80087b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800880:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800885:	e9 4a 01 00 00       	jmp    8009d4 <vprintfmt+0x5c0>
+  80088a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800892:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800896:	eb e6                	jmp    80087e <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800898:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089b:	83 f8 2f             	cmp    $0x2f,%eax
+  80089e:	77 19                	ja     8008b9 <vprintfmt+0x4a5>
+  8008a0:	89 c2                	mov    %eax,%edx
+  8008a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a6:	83 c0 08             	add    $0x8,%eax
+  8008a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ac:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008af:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008b4:	e9 1b 01 00 00       	jmp    8009d4 <vprintfmt+0x5c0>
+  8008b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c5:	eb e5                	jmp    8008ac <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d3:	e9 56 ff ff ff       	jmp    80082e <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008d8:	40 84 f6             	test   %sil,%sil
+  8008db:	75 2e                	jne    80090b <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008dd:	85 d2                	test   %edx,%edx
+  8008df:	74 59                	je     80093a <vprintfmt+0x526>
+  8008e1:	83 fa 01             	cmp    $0x1,%edx
+  8008e4:	74 7f                	je     800965 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ec:	0f 87 9f 00 00 00    	ja     800991 <vprintfmt+0x57d>
+  8008f2:	89 c2                	mov    %eax,%edx
+  8008f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f8:	83 c0 08             	add    $0x8,%eax
+  8008fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008fe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800901:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800906:	e9 c9 00 00 00       	jmp    8009d4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80090b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090e:	83 f8 2f             	cmp    $0x2f,%eax
+  800911:	77 19                	ja     80092c <vprintfmt+0x518>
+  800913:	89 c2                	mov    %eax,%edx
+  800915:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800919:	83 c0 08             	add    $0x8,%eax
+  80091c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800922:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800927:	e9 a8 00 00 00       	jmp    8009d4 <vprintfmt+0x5c0>
+  80092c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800930:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800934:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800938:	eb e5                	jmp    80091f <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80093a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093d:	83 f8 2f             	cmp    $0x2f,%eax
+  800940:	77 15                	ja     800957 <vprintfmt+0x543>
+  800942:	89 c2                	mov    %eax,%edx
+  800944:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800948:	83 c0 08             	add    $0x8,%eax
+  80094b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094e:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800950:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800955:	eb 7d                	jmp    8009d4 <vprintfmt+0x5c0>
+  800957:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800963:	eb e9                	jmp    80094e <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800965:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800968:	83 f8 2f             	cmp    $0x2f,%eax
+  80096b:	77 16                	ja     800983 <vprintfmt+0x56f>
+  80096d:	89 c2                	mov    %eax,%edx
+  80096f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800973:	83 c0 08             	add    $0x8,%eax
+  800976:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800979:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80097c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800981:	eb 51                	jmp    8009d4 <vprintfmt+0x5c0>
+  800983:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800987:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098f:	eb e8                	jmp    800979 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800991:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800995:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800999:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099d:	e9 5c ff ff ff       	jmp    8008fe <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8009a2:	4c 89 ee             	mov    %r13,%rsi
+  8009a5:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009aa:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009ad:	4c 89 ee             	mov    %r13,%rsi
+  8009b0:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009b5:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009be:	77 47                	ja     800a07 <vprintfmt+0x5f3>
+  8009c0:	89 c2                	mov    %eax,%edx
+  8009c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c6:	83 c0 08             	add    $0x8,%eax
+  8009c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009cc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009cf:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8009d8:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009dc:	0f 94 c0             	sete   %al
+  8009df:	0f b6 c0             	movzbl %al,%eax
+  8009e2:	50                   	push   %rax
+  8009e3:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009e8:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009ec:	4c 89 ee             	mov    %r13,%rsi
+  8009ef:	4c 89 f7             	mov    %r14,%rdi
+  8009f2:	48 b8 09 03 80 00 00 	movabs $0x800309,%rax
+  8009f9:	00 00 00 
+  8009fc:	ff d0                	call   *%rax
+            break;
+  8009fe:	48 83 c4 10          	add    $0x10,%rsp
+  800a02:	e9 3e fa ff ff       	jmp    800445 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a13:	eb b7                	jmp    8009cc <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a15:	40 84 f6             	test   %sil,%sil
+  800a18:	75 2b                	jne    800a45 <vprintfmt+0x631>
+    switch (lflag) {
+  800a1a:	85 d2                	test   %edx,%edx
+  800a1c:	74 56                	je     800a74 <vprintfmt+0x660>
+  800a1e:	83 fa 01             	cmp    $0x1,%edx
+  800a21:	74 7f                	je     800aa2 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a23:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a26:	83 f8 2f             	cmp    $0x2f,%eax
+  800a29:	0f 87 a2 00 00 00    	ja     800ad1 <vprintfmt+0x6bd>
+  800a2f:	89 c2                	mov    %eax,%edx
+  800a31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a35:	83 c0 08             	add    $0x8,%eax
+  800a38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a3e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a43:	eb 8f                	jmp    8009d4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a48:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4b:	77 19                	ja     800a66 <vprintfmt+0x652>
+  800a4d:	89 c2                	mov    %eax,%edx
+  800a4f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a53:	83 c0 08             	add    $0x8,%eax
+  800a56:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a59:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a5c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a61:	e9 6e ff ff ff       	jmp    8009d4 <vprintfmt+0x5c0>
+  800a66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a72:	eb e5                	jmp    800a59 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a77:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7a:	77 18                	ja     800a94 <vprintfmt+0x680>
+  800a7c:	89 c2                	mov    %eax,%edx
+  800a7e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a82:	83 c0 08             	add    $0x8,%eax
+  800a85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a88:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a8a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a8f:	e9 40 ff ff ff       	jmp    8009d4 <vprintfmt+0x5c0>
+  800a94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a98:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa0:	eb e6                	jmp    800a88 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800aa2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa5:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa8:	77 19                	ja     800ac3 <vprintfmt+0x6af>
+  800aaa:	89 c2                	mov    %eax,%edx
+  800aac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab0:	83 c0 08             	add    $0x8,%eax
+  800ab3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ab9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800abe:	e9 11 ff ff ff       	jmp    8009d4 <vprintfmt+0x5c0>
+  800ac3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800acf:	eb e5                	jmp    800ab6 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ad1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800add:	e9 59 ff ff ff       	jmp    800a3b <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ae2:	4c 89 ee             	mov    %r13,%rsi
+  800ae5:	bf 25 00 00 00       	mov    $0x25,%edi
+  800aea:	41 ff d6             	call   *%r14
+            break;
+  800aed:	e9 53 f9 ff ff       	jmp    800445 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800af2:	4c 89 ee             	mov    %r13,%rsi
+  800af5:	bf 25 00 00 00       	mov    $0x25,%edi
+  800afa:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800afd:	48 83 eb 01          	sub    $0x1,%rbx
+  800b01:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b05:	75 f6                	jne    800afd <vprintfmt+0x6e9>
+  800b07:	e9 39 f9 ff ff       	jmp    800445 <vprintfmt+0x31>
+}
+  800b0c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b10:	5b                   	pop    %rbx
+  800b11:	41 5c                	pop    %r12
+  800b13:	41 5d                	pop    %r13
+  800b15:	41 5e                	pop    %r14
+  800b17:	41 5f                	pop    %r15
+  800b19:	5d                   	pop    %rbp
+  800b1a:	c3                   	ret
+
+0000000000800b1b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b1b:	55                   	push   %rbp
+  800b1c:	48 89 e5             	mov    %rsp,%rbp
+  800b1f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b23:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b27:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b2c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b30:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b37:	48 85 ff             	test   %rdi,%rdi
+  800b3a:	74 2b                	je     800b67 <vsnprintf+0x4c>
+  800b3c:	48 85 f6             	test   %rsi,%rsi
+  800b3f:	74 26                	je     800b67 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b41:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b45:	48 bf bf 03 80 00 00 	movabs $0x8003bf,%rdi
+  800b4c:	00 00 00 
+  800b4f:	48 b8 14 04 80 00 00 	movabs $0x800414,%rax
+  800b56:	00 00 00 
+  800b59:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b5f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b62:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b65:	c9                   	leave
+  800b66:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b6c:	eb f7                	jmp    800b65 <vsnprintf+0x4a>
+
+0000000000800b6e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b6e:	55                   	push   %rbp
+  800b6f:	48 89 e5             	mov    %rsp,%rbp
+  800b72:	48 83 ec 50          	sub    $0x50,%rsp
+  800b76:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b7a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b7e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b82:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b89:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b91:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b95:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b99:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b9d:	48 b8 1b 0b 80 00 00 	movabs $0x800b1b,%rax
+  800ba4:	00 00 00 
+  800ba7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ba9:	c9                   	leave
+  800baa:	c3                   	ret
+
+0000000000800bab <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bab:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bae:	74 10                	je     800bc0 <strlen+0x15>
+    size_t n = 0;
+  800bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800bb5:	48 83 c0 01          	add    $0x1,%rax
+  800bb9:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800bbd:	75 f6                	jne    800bb5 <strlen+0xa>
+  800bbf:	c3                   	ret
+    size_t n = 0;
+  800bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800bc5:	c3                   	ret
+
+0000000000800bc6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800bc6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bc9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bce:	48 85 f6             	test   %rsi,%rsi
+  800bd1:	74 11                	je     800be4 <strnlen+0x1e>
+  800bd3:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bd7:	74 0c                	je     800be5 <strnlen+0x1f>
+  800bd9:	48 83 c2 01          	add    $0x1,%rdx
+  800bdd:	48 39 d0             	cmp    %rdx,%rax
+  800be0:	75 f1                	jne    800bd3 <strnlen+0xd>
+  800be2:	eb 04                	jmp    800be8 <strnlen+0x22>
+  800be4:	c3                   	ret
+  800be5:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800be8:	c3                   	ret
+
+0000000000800be9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800be9:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bec:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf1:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bf5:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bf8:	48 83 c2 01          	add    $0x1,%rdx
+  800bfc:	84 c9                	test   %cl,%cl
+  800bfe:	75 f1                	jne    800bf1 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c00:	c3                   	ret
+
+0000000000800c01 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c01:	55                   	push   %rbp
+  800c02:	48 89 e5             	mov    %rsp,%rbp
+  800c05:	41 54                	push   %r12
+  800c07:	53                   	push   %rbx
+  800c08:	48 89 fb             	mov    %rdi,%rbx
+  800c0b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c0e:	48 b8 ab 0b 80 00 00 	movabs $0x800bab,%rax
+  800c15:	00 00 00 
+  800c18:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c1a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c1e:	4c 89 e6             	mov    %r12,%rsi
+  800c21:	48 b8 e9 0b 80 00 00 	movabs $0x800be9,%rax
+  800c28:	00 00 00 
+  800c2b:	ff d0                	call   *%rax
+    return dst;
+}
+  800c2d:	48 89 d8             	mov    %rbx,%rax
+  800c30:	5b                   	pop    %rbx
+  800c31:	41 5c                	pop    %r12
+  800c33:	5d                   	pop    %rbp
+  800c34:	c3                   	ret
+
+0000000000800c35 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c35:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c38:	48 85 d2             	test   %rdx,%rdx
+  800c3b:	74 1f                	je     800c5c <strncpy+0x27>
+  800c3d:	48 01 fa             	add    %rdi,%rdx
+  800c40:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c43:	48 83 c1 01          	add    $0x1,%rcx
+  800c47:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c4b:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c4f:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c53:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c57:	48 39 ca             	cmp    %rcx,%rdx
+  800c5a:	75 e7                	jne    800c43 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c5c:	c3                   	ret
+
+0000000000800c5d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c5d:	48 89 f8             	mov    %rdi,%rax
+  800c60:	48 85 d2             	test   %rdx,%rdx
+  800c63:	74 24                	je     800c89 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c65:	48 83 ea 01          	sub    $0x1,%rdx
+  800c69:	74 1b                	je     800c86 <strlcpy+0x29>
+  800c6b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c6f:	0f b6 16             	movzbl (%rsi),%edx
+  800c72:	84 d2                	test   %dl,%dl
+  800c74:	74 10                	je     800c86 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c76:	48 83 c6 01          	add    $0x1,%rsi
+  800c7a:	48 83 c0 01          	add    $0x1,%rax
+  800c7e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c81:	48 39 c8             	cmp    %rcx,%rax
+  800c84:	75 e9                	jne    800c6f <strlcpy+0x12>
+        *dst = '\0';
+  800c86:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c89:	48 29 f8             	sub    %rdi,%rax
+}
+  800c8c:	c3                   	ret
+
+0000000000800c8d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c8d:	0f b6 07             	movzbl (%rdi),%eax
+  800c90:	84 c0                	test   %al,%al
+  800c92:	74 13                	je     800ca7 <strcmp+0x1a>
+  800c94:	38 06                	cmp    %al,(%rsi)
+  800c96:	75 0f                	jne    800ca7 <strcmp+0x1a>
+  800c98:	48 83 c7 01          	add    $0x1,%rdi
+  800c9c:	48 83 c6 01          	add    $0x1,%rsi
+  800ca0:	0f b6 07             	movzbl (%rdi),%eax
+  800ca3:	84 c0                	test   %al,%al
+  800ca5:	75 ed                	jne    800c94 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ca7:	0f b6 c0             	movzbl %al,%eax
+  800caa:	0f b6 16             	movzbl (%rsi),%edx
+  800cad:	29 d0                	sub    %edx,%eax
+}
+  800caf:	c3                   	ret
+
+0000000000800cb0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cb0:	48 85 d2             	test   %rdx,%rdx
+  800cb3:	74 1f                	je     800cd4 <strncmp+0x24>
+  800cb5:	0f b6 07             	movzbl (%rdi),%eax
+  800cb8:	84 c0                	test   %al,%al
+  800cba:	74 1e                	je     800cda <strncmp+0x2a>
+  800cbc:	3a 06                	cmp    (%rsi),%al
+  800cbe:	75 1a                	jne    800cda <strncmp+0x2a>
+  800cc0:	48 83 c7 01          	add    $0x1,%rdi
+  800cc4:	48 83 c6 01          	add    $0x1,%rsi
+  800cc8:	48 83 ea 01          	sub    $0x1,%rdx
+  800ccc:	75 e7                	jne    800cb5 <strncmp+0x5>
+
+    if (!n) return 0;
+  800cce:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd3:	c3                   	ret
+  800cd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd9:	c3                   	ret
+  800cda:	48 85 d2             	test   %rdx,%rdx
+  800cdd:	74 09                	je     800ce8 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cdf:	0f b6 07             	movzbl (%rdi),%eax
+  800ce2:	0f b6 16             	movzbl (%rsi),%edx
+  800ce5:	29 d0                	sub    %edx,%eax
+  800ce7:	c3                   	ret
+    if (!n) return 0;
+  800ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ced:	c3                   	ret
+
+0000000000800cee <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cee:	0f b6 17             	movzbl (%rdi),%edx
+  800cf1:	84 d2                	test   %dl,%dl
+  800cf3:	74 18                	je     800d0d <strchr+0x1f>
+        if (*str == c) {
+  800cf5:	0f be d2             	movsbl %dl,%edx
+  800cf8:	39 f2                	cmp    %esi,%edx
+  800cfa:	74 17                	je     800d13 <strchr+0x25>
+    for (; *str; str++) {
+  800cfc:	48 83 c7 01          	add    $0x1,%rdi
+  800d00:	0f b6 17             	movzbl (%rdi),%edx
+  800d03:	84 d2                	test   %dl,%dl
+  800d05:	75 ee                	jne    800cf5 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d07:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d0c:	c3                   	ret
+  800d0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d12:	c3                   	ret
+  800d13:	48 89 f8             	mov    %rdi,%rax
+}
+  800d16:	c3                   	ret
+
+0000000000800d17 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d17:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d1a:	0f b6 17             	movzbl (%rdi),%edx
+  800d1d:	84 d2                	test   %dl,%dl
+  800d1f:	74 13                	je     800d34 <strfind+0x1d>
+  800d21:	0f be d2             	movsbl %dl,%edx
+  800d24:	39 f2                	cmp    %esi,%edx
+  800d26:	74 0b                	je     800d33 <strfind+0x1c>
+  800d28:	48 83 c0 01          	add    $0x1,%rax
+  800d2c:	0f b6 10             	movzbl (%rax),%edx
+  800d2f:	84 d2                	test   %dl,%dl
+  800d31:	75 ee                	jne    800d21 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d33:	c3                   	ret
+  800d34:	c3                   	ret
+
+0000000000800d35 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d35:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d38:	48 89 f8             	mov    %rdi,%rax
+  800d3b:	48 f7 d8             	neg    %rax
+  800d3e:	83 e0 07             	and    $0x7,%eax
+  800d41:	49 89 d1             	mov    %rdx,%r9
+  800d44:	49 29 c1             	sub    %rax,%r9
+  800d47:	78 36                	js     800d7f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d49:	40 0f b6 c6          	movzbl %sil,%eax
+  800d4d:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d54:	01 01 01 
+  800d57:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d5b:	40 f6 c7 07          	test   $0x7,%dil
+  800d5f:	75 38                	jne    800d99 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d61:	4c 89 c9             	mov    %r9,%rcx
+  800d64:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d68:	74 0c                	je     800d76 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d6a:	fc                   	cld
+  800d6b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d6e:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d72:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d76:	4d 85 c9             	test   %r9,%r9
+  800d79:	75 45                	jne    800dc0 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d7b:	4c 89 c0             	mov    %r8,%rax
+  800d7e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d7f:	48 85 d2             	test   %rdx,%rdx
+  800d82:	74 f7                	je     800d7b <memset+0x46>
+  800d84:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d87:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d8a:	48 83 c0 01          	add    $0x1,%rax
+  800d8e:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d92:	48 39 c2             	cmp    %rax,%rdx
+  800d95:	75 f3                	jne    800d8a <memset+0x55>
+  800d97:	eb e2                	jmp    800d7b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d99:	40 f6 c7 01          	test   $0x1,%dil
+  800d9d:	74 06                	je     800da5 <memset+0x70>
+  800d9f:	88 07                	mov    %al,(%rdi)
+  800da1:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800da5:	40 f6 c7 02          	test   $0x2,%dil
+  800da9:	74 07                	je     800db2 <memset+0x7d>
+  800dab:	66 89 07             	mov    %ax,(%rdi)
+  800dae:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800db2:	40 f6 c7 04          	test   $0x4,%dil
+  800db6:	74 a9                	je     800d61 <memset+0x2c>
+  800db8:	89 07                	mov    %eax,(%rdi)
+  800dba:	48 83 c7 04          	add    $0x4,%rdi
+  800dbe:	eb a1                	jmp    800d61 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800dc0:	41 f6 c1 04          	test   $0x4,%r9b
+  800dc4:	74 06                	je     800dcc <memset+0x97>
+  800dc6:	89 07                	mov    %eax,(%rdi)
+  800dc8:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800dcc:	41 f6 c1 02          	test   $0x2,%r9b
+  800dd0:	74 07                	je     800dd9 <memset+0xa4>
+  800dd2:	66 89 07             	mov    %ax,(%rdi)
+  800dd5:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800dd9:	41 f6 c1 01          	test   $0x1,%r9b
+  800ddd:	74 9c                	je     800d7b <memset+0x46>
+  800ddf:	88 07                	mov    %al,(%rdi)
+  800de1:	eb 98                	jmp    800d7b <memset+0x46>
+
+0000000000800de3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800de3:	48 89 f8             	mov    %rdi,%rax
+  800de6:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800de9:	48 39 fe             	cmp    %rdi,%rsi
+  800dec:	73 3b                	jae    800e29 <memmove+0x46>
+  800dee:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800df2:	48 39 d7             	cmp    %rdx,%rdi
+  800df5:	73 32                	jae    800e29 <memmove+0x46>
+        s += n;
+        d += n;
+  800df7:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dfb:	48 89 d6             	mov    %rdx,%rsi
+  800dfe:	48 09 fe             	or     %rdi,%rsi
+  800e01:	48 09 ce             	or     %rcx,%rsi
+  800e04:	40 f6 c6 07          	test   $0x7,%sil
+  800e08:	75 12                	jne    800e1c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e0a:	48 83 ef 08          	sub    $0x8,%rdi
+  800e0e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e12:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e16:	fd                   	std
+  800e17:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e1a:	fc                   	cld
+  800e1b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e1c:	48 83 ef 01          	sub    $0x1,%rdi
+  800e20:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e24:	fd                   	std
+  800e25:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e27:	eb f1                	jmp    800e1a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e29:	48 89 f2             	mov    %rsi,%rdx
+  800e2c:	48 09 c2             	or     %rax,%rdx
+  800e2f:	48 09 ca             	or     %rcx,%rdx
+  800e32:	f6 c2 07             	test   $0x7,%dl
+  800e35:	75 0c                	jne    800e43 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e37:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e3b:	48 89 c7             	mov    %rax,%rdi
+  800e3e:	fc                   	cld
+  800e3f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e42:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e43:	48 89 c7             	mov    %rax,%rdi
+  800e46:	fc                   	cld
+  800e47:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e49:	c3                   	ret
+
+0000000000800e4a <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e4a:	55                   	push   %rbp
+  800e4b:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e4e:	48 b8 e3 0d 80 00 00 	movabs $0x800de3,%rax
+  800e55:	00 00 00 
+  800e58:	ff d0                	call   *%rax
+}
+  800e5a:	5d                   	pop    %rbp
+  800e5b:	c3                   	ret
+
+0000000000800e5c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e5c:	55                   	push   %rbp
+  800e5d:	48 89 e5             	mov    %rsp,%rbp
+  800e60:	41 57                	push   %r15
+  800e62:	41 56                	push   %r14
+  800e64:	41 55                	push   %r13
+  800e66:	41 54                	push   %r12
+  800e68:	53                   	push   %rbx
+  800e69:	48 83 ec 08          	sub    $0x8,%rsp
+  800e6d:	49 89 fe             	mov    %rdi,%r14
+  800e70:	49 89 f7             	mov    %rsi,%r15
+  800e73:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e76:	48 89 f7             	mov    %rsi,%rdi
+  800e79:	48 b8 ab 0b 80 00 00 	movabs $0x800bab,%rax
+  800e80:	00 00 00 
+  800e83:	ff d0                	call   *%rax
+  800e85:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e88:	48 89 de             	mov    %rbx,%rsi
+  800e8b:	4c 89 f7             	mov    %r14,%rdi
+  800e8e:	48 b8 c6 0b 80 00 00 	movabs $0x800bc6,%rax
+  800e95:	00 00 00 
+  800e98:	ff d0                	call   *%rax
+  800e9a:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e9d:	48 39 c3             	cmp    %rax,%rbx
+  800ea0:	74 36                	je     800ed8 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800ea2:	48 89 d8             	mov    %rbx,%rax
+  800ea5:	4c 29 e8             	sub    %r13,%rax
+  800ea8:	49 39 c4             	cmp    %rax,%r12
+  800eab:	73 31                	jae    800ede <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800ead:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800eb2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800eb6:	4c 89 fe             	mov    %r15,%rsi
+  800eb9:	48 b8 4a 0e 80 00 00 	movabs $0x800e4a,%rax
+  800ec0:	00 00 00 
+  800ec3:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800ec5:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ec9:	48 83 c4 08          	add    $0x8,%rsp
+  800ecd:	5b                   	pop    %rbx
+  800ece:	41 5c                	pop    %r12
+  800ed0:	41 5d                	pop    %r13
+  800ed2:	41 5e                	pop    %r14
+  800ed4:	41 5f                	pop    %r15
+  800ed6:	5d                   	pop    %rbp
+  800ed7:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ed8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800edc:	eb eb                	jmp    800ec9 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800ede:	48 83 eb 01          	sub    $0x1,%rbx
+  800ee2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ee6:	48 89 da             	mov    %rbx,%rdx
+  800ee9:	4c 89 fe             	mov    %r15,%rsi
+  800eec:	48 b8 4a 0e 80 00 00 	movabs $0x800e4a,%rax
+  800ef3:	00 00 00 
+  800ef6:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ef8:	49 01 de             	add    %rbx,%r14
+  800efb:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f00:	eb c3                	jmp    800ec5 <strlcat+0x69>
+
+0000000000800f02 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f02:	48 85 d2             	test   %rdx,%rdx
+  800f05:	74 2d                	je     800f34 <memcmp+0x32>
+  800f07:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f0c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f10:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f15:	44 38 c1             	cmp    %r8b,%cl
+  800f18:	75 0f                	jne    800f29 <memcmp+0x27>
+    while (n-- > 0) {
+  800f1a:	48 83 c0 01          	add    $0x1,%rax
+  800f1e:	48 39 c2             	cmp    %rax,%rdx
+  800f21:	75 e9                	jne    800f0c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f28:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f29:	0f b6 c1             	movzbl %cl,%eax
+  800f2c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f30:	44 29 c0             	sub    %r8d,%eax
+  800f33:	c3                   	ret
+    return 0;
+  800f34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f39:	c3                   	ret
+
+0000000000800f3a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f3a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f3e:	48 39 c7             	cmp    %rax,%rdi
+  800f41:	73 0f                	jae    800f52 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f43:	40 38 37             	cmp    %sil,(%rdi)
+  800f46:	74 0e                	je     800f56 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f48:	48 83 c7 01          	add    $0x1,%rdi
+  800f4c:	48 39 f8             	cmp    %rdi,%rax
+  800f4f:	75 f2                	jne    800f43 <memfind+0x9>
+  800f51:	c3                   	ret
+  800f52:	48 89 f8             	mov    %rdi,%rax
+  800f55:	c3                   	ret
+  800f56:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f59:	c3                   	ret
+
+0000000000800f5a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f5a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f5d:	0f b6 37             	movzbl (%rdi),%esi
+  800f60:	40 80 fe 20          	cmp    $0x20,%sil
+  800f64:	74 06                	je     800f6c <strtol+0x12>
+  800f66:	40 80 fe 09          	cmp    $0x9,%sil
+  800f6a:	75 13                	jne    800f7f <strtol+0x25>
+  800f6c:	48 83 c7 01          	add    $0x1,%rdi
+  800f70:	0f b6 37             	movzbl (%rdi),%esi
+  800f73:	40 80 fe 20          	cmp    $0x20,%sil
+  800f77:	74 f3                	je     800f6c <strtol+0x12>
+  800f79:	40 80 fe 09          	cmp    $0x9,%sil
+  800f7d:	74 ed                	je     800f6c <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f7f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f82:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f85:	3c 01                	cmp    $0x1,%al
+  800f87:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f8b:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f91:	75 0f                	jne    800fa2 <strtol+0x48>
+  800f93:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f96:	74 14                	je     800fac <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f98:	85 d2                	test   %edx,%edx
+  800f9a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f9f:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800fa2:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800fa7:	4c 63 ca             	movslq %edx,%r9
+  800faa:	eb 36                	jmp    800fe2 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fac:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800fb0:	74 0f                	je     800fc1 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800fb2:	85 d2                	test   %edx,%edx
+  800fb4:	75 ec                	jne    800fa2 <strtol+0x48>
+        s++;
+  800fb6:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800fba:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800fbf:	eb e1                	jmp    800fa2 <strtol+0x48>
+        s += 2;
+  800fc1:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800fc5:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800fca:	eb d6                	jmp    800fa2 <strtol+0x48>
+            dig -= '0';
+  800fcc:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fcf:	44 0f b6 c1          	movzbl %cl,%r8d
+  800fd3:	41 39 d0             	cmp    %edx,%r8d
+  800fd6:	7d 21                	jge    800ff9 <strtol+0x9f>
+        val = val * base + dig;
+  800fd8:	49 0f af c1          	imul   %r9,%rax
+  800fdc:	0f b6 c9             	movzbl %cl,%ecx
+  800fdf:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fe2:	48 83 c7 01          	add    $0x1,%rdi
+  800fe6:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800fea:	80 f9 39             	cmp    $0x39,%cl
+  800fed:	76 dd                	jbe    800fcc <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fef:	80 f9 7b             	cmp    $0x7b,%cl
+  800ff2:	77 05                	ja     800ff9 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800ff4:	83 e9 57             	sub    $0x57,%ecx
+  800ff7:	eb d6                	jmp    800fcf <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800ff9:	4d 85 d2             	test   %r10,%r10
+  800ffc:	74 03                	je     801001 <strtol+0xa7>
+  800ffe:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801001:	48 89 c2             	mov    %rax,%rdx
+  801004:	48 f7 da             	neg    %rdx
+  801007:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80100b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80100f:	c3                   	ret
+
+0000000000801010 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801010:	55                   	push   %rbp
+  801011:	48 89 e5             	mov    %rsp,%rbp
+  801014:	53                   	push   %rbx
+  801015:	48 89 fa             	mov    %rdi,%rdx
+  801018:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80101b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801020:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801025:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80102a:	be 00 00 00 00       	mov    $0x0,%esi
+  80102f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801035:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801037:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80103b:	c9                   	leave
+  80103c:	c3                   	ret
+
+000000000080103d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80103d:	55                   	push   %rbp
+  80103e:	48 89 e5             	mov    %rsp,%rbp
+  801041:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801042:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801047:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801051:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801056:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80105b:	be 00 00 00 00       	mov    $0x0,%esi
+  801060:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801066:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801068:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80106c:	c9                   	leave
+  80106d:	c3                   	ret
+
+000000000080106e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80106e:	55                   	push   %rbp
+  80106f:	48 89 e5             	mov    %rsp,%rbp
+  801072:	53                   	push   %rbx
+  801073:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801077:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80107a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80107f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801084:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801089:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80108e:	be 00 00 00 00       	mov    $0x0,%esi
+  801093:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801099:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80109b:	48 85 c0             	test   %rax,%rax
+  80109e:	7f 06                	jg     8010a6 <sys_env_destroy+0x38>
+}
+  8010a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010a4:	c9                   	leave
+  8010a5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010a6:	49 89 c0             	mov    %rax,%r8
+  8010a9:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8010ae:	48 ba b0 39 80 00 00 	movabs $0x8039b0,%rdx
+  8010b5:	00 00 00 
+  8010b8:	be 26 00 00 00       	mov    $0x26,%esi
+  8010bd:	48 bf cf 39 80 00 00 	movabs $0x8039cf,%rdi
+  8010c4:	00 00 00 
+  8010c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010cc:	49 b9 74 01 80 00 00 	movabs $0x800174,%r9
+  8010d3:	00 00 00 
+  8010d6:	41 ff d1             	call   *%r9
+
+00000000008010d9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8010d9:	55                   	push   %rbp
+  8010da:	48 89 e5             	mov    %rsp,%rbp
+  8010dd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010de:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8010fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801102:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801104:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801108:	c9                   	leave
+  801109:	c3                   	ret
+
+000000000080110a <sys_yield>:
+
+void
+sys_yield(void) {
+  80110a:	55                   	push   %rbp
+  80110b:	48 89 e5             	mov    %rsp,%rbp
+  80110e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80110f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801114:	ba 00 00 00 00       	mov    $0x0,%edx
+  801119:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80111e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801123:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801128:	be 00 00 00 00       	mov    $0x0,%esi
+  80112d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801133:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801135:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801139:	c9                   	leave
+  80113a:	c3                   	ret
+
+000000000080113b <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80113b:	55                   	push   %rbp
+  80113c:	48 89 e5             	mov    %rsp,%rbp
+  80113f:	53                   	push   %rbx
+  801140:	48 89 fa             	mov    %rdi,%rdx
+  801143:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801146:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80114b:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801152:	00 00 00 
+  801155:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80115a:	be 00 00 00 00       	mov    $0x0,%esi
+  80115f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801165:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801167:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80116b:	c9                   	leave
+  80116c:	c3                   	ret
+
+000000000080116d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80116d:	55                   	push   %rbp
+  80116e:	48 89 e5             	mov    %rsp,%rbp
+  801171:	53                   	push   %rbx
+  801172:	49 89 f8             	mov    %rdi,%r8
+  801175:	48 89 d3             	mov    %rdx,%rbx
+  801178:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80117b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801180:	4c 89 c2             	mov    %r8,%rdx
+  801183:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801186:	be 00 00 00 00       	mov    $0x0,%esi
+  80118b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801191:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801193:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801197:	c9                   	leave
+  801198:	c3                   	ret
+
+0000000000801199 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801199:	55                   	push   %rbp
+  80119a:	48 89 e5             	mov    %rsp,%rbp
+  80119d:	53                   	push   %rbx
+  80119e:	48 83 ec 08          	sub    $0x8,%rsp
+  8011a2:	89 f8                	mov    %edi,%eax
+  8011a4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8011a7:	48 63 f9             	movslq %ecx,%rdi
+  8011aa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ad:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011b2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011c2:	48 85 c0             	test   %rax,%rax
+  8011c5:	7f 06                	jg     8011cd <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011cb:	c9                   	leave
+  8011cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011cd:	49 89 c0             	mov    %rax,%r8
+  8011d0:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011d5:	48 ba b0 39 80 00 00 	movabs $0x8039b0,%rdx
+  8011dc:	00 00 00 
+  8011df:	be 26 00 00 00       	mov    $0x26,%esi
+  8011e4:	48 bf cf 39 80 00 00 	movabs $0x8039cf,%rdi
+  8011eb:	00 00 00 
+  8011ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f3:	49 b9 74 01 80 00 00 	movabs $0x800174,%r9
+  8011fa:	00 00 00 
+  8011fd:	41 ff d1             	call   *%r9
+
+0000000000801200 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801200:	55                   	push   %rbp
+  801201:	48 89 e5             	mov    %rsp,%rbp
+  801204:	53                   	push   %rbx
+  801205:	48 83 ec 08          	sub    $0x8,%rsp
+  801209:	89 f8                	mov    %edi,%eax
+  80120b:	49 89 f2             	mov    %rsi,%r10
+  80120e:	48 89 cf             	mov    %rcx,%rdi
+  801211:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801214:	48 63 da             	movslq %edx,%rbx
+  801217:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80121a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80121f:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801222:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801225:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801227:	48 85 c0             	test   %rax,%rax
+  80122a:	7f 06                	jg     801232 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80122c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801230:	c9                   	leave
+  801231:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801232:	49 89 c0             	mov    %rax,%r8
+  801235:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80123a:	48 ba b0 39 80 00 00 	movabs $0x8039b0,%rdx
+  801241:	00 00 00 
+  801244:	be 26 00 00 00       	mov    $0x26,%esi
+  801249:	48 bf cf 39 80 00 00 	movabs $0x8039cf,%rdi
+  801250:	00 00 00 
+  801253:	b8 00 00 00 00       	mov    $0x0,%eax
+  801258:	49 b9 74 01 80 00 00 	movabs $0x800174,%r9
+  80125f:	00 00 00 
+  801262:	41 ff d1             	call   *%r9
+
+0000000000801265 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801265:	55                   	push   %rbp
+  801266:	48 89 e5             	mov    %rsp,%rbp
+  801269:	53                   	push   %rbx
+  80126a:	48 83 ec 08          	sub    $0x8,%rsp
+  80126e:	48 89 f1             	mov    %rsi,%rcx
+  801271:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801274:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801277:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80127c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801281:	be 00 00 00 00       	mov    $0x0,%esi
+  801286:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80128c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80128e:	48 85 c0             	test   %rax,%rax
+  801291:	7f 06                	jg     801299 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801293:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801297:	c9                   	leave
+  801298:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801299:	49 89 c0             	mov    %rax,%r8
+  80129c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8012a1:	48 ba b0 39 80 00 00 	movabs $0x8039b0,%rdx
+  8012a8:	00 00 00 
+  8012ab:	be 26 00 00 00       	mov    $0x26,%esi
+  8012b0:	48 bf cf 39 80 00 00 	movabs $0x8039cf,%rdi
+  8012b7:	00 00 00 
+  8012ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012bf:	49 b9 74 01 80 00 00 	movabs $0x800174,%r9
+  8012c6:	00 00 00 
+  8012c9:	41 ff d1             	call   *%r9
+
+00000000008012cc <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8012cc:	55                   	push   %rbp
+  8012cd:	48 89 e5             	mov    %rsp,%rbp
+  8012d0:	53                   	push   %rbx
+  8012d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8012d5:	89 f8                	mov    %edi,%eax
+  8012d7:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8012da:	48 63 f9             	movslq %ecx,%rdi
+  8012dd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012e5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012f5:	48 85 c0             	test   %rax,%rax
+  8012f8:	7f 06                	jg     801300 <sys_region_advise+0x34>
+}
+  8012fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012fe:	c9                   	leave
+  8012ff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801300:	49 89 c0             	mov    %rax,%r8
+  801303:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801308:	48 ba b0 39 80 00 00 	movabs $0x8039b0,%rdx
+  80130f:	00 00 00 
+  801312:	be 26 00 00 00       	mov    $0x26,%esi
+  801317:	48 bf cf 39 80 00 00 	movabs $0x8039cf,%rdi
+  80131e:	00 00 00 
+  801321:	b8 00 00 00 00       	mov    $0x0,%eax
+  801326:	49 b9 74 01 80 00 00 	movabs $0x800174,%r9
+  80132d:	00 00 00 
+  801330:	41 ff d1             	call   *%r9
+
+0000000000801333 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801333:	55                   	push   %rbp
+  801334:	48 89 e5             	mov    %rsp,%rbp
+  801337:	53                   	push   %rbx
+  801338:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80133c:	48 63 ce             	movslq %esi,%rcx
+  80133f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801342:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801347:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801351:	be 00 00 00 00       	mov    $0x0,%esi
+  801356:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80135c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80135e:	48 85 c0             	test   %rax,%rax
+  801361:	7f 06                	jg     801369 <sys_env_set_nice+0x36>
+}
+  801363:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801367:	c9                   	leave
+  801368:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801369:	49 89 c0             	mov    %rax,%r8
+  80136c:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801371:	48 ba b0 39 80 00 00 	movabs $0x8039b0,%rdx
+  801378:	00 00 00 
+  80137b:	be 26 00 00 00       	mov    $0x26,%esi
+  801380:	48 bf cf 39 80 00 00 	movabs $0x8039cf,%rdi
+  801387:	00 00 00 
+  80138a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138f:	49 b9 74 01 80 00 00 	movabs $0x800174,%r9
+  801396:	00 00 00 
+  801399:	41 ff d1             	call   *%r9
+
+000000000080139c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80139c:	55                   	push   %rbp
+  80139d:	48 89 e5             	mov    %rsp,%rbp
+  8013a0:	53                   	push   %rbx
+  8013a1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8013a5:	48 63 ce             	movslq %esi,%rcx
+  8013a8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ab:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8013bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013c7:	48 85 c0             	test   %rax,%rax
+  8013ca:	7f 06                	jg     8013d2 <sys_env_set_status+0x36>
+}
+  8013cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d0:	c9                   	leave
+  8013d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013d2:	49 89 c0             	mov    %rax,%r8
+  8013d5:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013da:	48 ba b0 39 80 00 00 	movabs $0x8039b0,%rdx
+  8013e1:	00 00 00 
+  8013e4:	be 26 00 00 00       	mov    $0x26,%esi
+  8013e9:	48 bf cf 39 80 00 00 	movabs $0x8039cf,%rdi
+  8013f0:	00 00 00 
+  8013f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f8:	49 b9 74 01 80 00 00 	movabs $0x800174,%r9
+  8013ff:	00 00 00 
+  801402:	41 ff d1             	call   *%r9
+
+0000000000801405 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801405:	55                   	push   %rbp
+  801406:	48 89 e5             	mov    %rsp,%rbp
+  801409:	53                   	push   %rbx
+  80140a:	48 83 ec 08          	sub    $0x8,%rsp
+  80140e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801411:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801414:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801419:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801423:	be 00 00 00 00       	mov    $0x0,%esi
+  801428:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80142e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801430:	48 85 c0             	test   %rax,%rax
+  801433:	7f 06                	jg     80143b <sys_env_set_trapframe+0x36>
+}
+  801435:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801439:	c9                   	leave
+  80143a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80143b:	49 89 c0             	mov    %rax,%r8
+  80143e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801443:	48 ba b0 39 80 00 00 	movabs $0x8039b0,%rdx
+  80144a:	00 00 00 
+  80144d:	be 26 00 00 00       	mov    $0x26,%esi
+  801452:	48 bf cf 39 80 00 00 	movabs $0x8039cf,%rdi
+  801459:	00 00 00 
+  80145c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801461:	49 b9 74 01 80 00 00 	movabs $0x800174,%r9
+  801468:	00 00 00 
+  80146b:	41 ff d1             	call   *%r9
+
+000000000080146e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80146e:	55                   	push   %rbp
+  80146f:	48 89 e5             	mov    %rsp,%rbp
+  801472:	53                   	push   %rbx
+  801473:	48 83 ec 08          	sub    $0x8,%rsp
+  801477:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80147a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80147d:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801482:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801487:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148c:	be 00 00 00 00       	mov    $0x0,%esi
+  801491:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801497:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801499:	48 85 c0             	test   %rax,%rax
+  80149c:	7f 06                	jg     8014a4 <sys_env_set_pgfault_upcall+0x36>
+}
+  80149e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a2:	c9                   	leave
+  8014a3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014a4:	49 89 c0             	mov    %rax,%r8
+  8014a7:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8014ac:	48 ba b0 39 80 00 00 	movabs $0x8039b0,%rdx
+  8014b3:	00 00 00 
+  8014b6:	be 26 00 00 00       	mov    $0x26,%esi
+  8014bb:	48 bf cf 39 80 00 00 	movabs $0x8039cf,%rdi
+  8014c2:	00 00 00 
+  8014c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ca:	49 b9 74 01 80 00 00 	movabs $0x800174,%r9
+  8014d1:	00 00 00 
+  8014d4:	41 ff d1             	call   *%r9
+
+00000000008014d7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014d7:	55                   	push   %rbp
+  8014d8:	48 89 e5             	mov    %rsp,%rbp
+  8014db:	53                   	push   %rbx
+  8014dc:	89 f8                	mov    %edi,%eax
+  8014de:	49 89 f1             	mov    %rsi,%r9
+  8014e1:	48 89 d3             	mov    %rdx,%rbx
+  8014e4:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014e7:	49 63 f0             	movslq %r8d,%rsi
+  8014ea:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ed:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014f2:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014fb:	cd 30                	int    $0x30
+}
+  8014fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801501:	c9                   	leave
+  801502:	c3                   	ret
+
+0000000000801503 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801503:	55                   	push   %rbp
+  801504:	48 89 e5             	mov    %rsp,%rbp
+  801507:	53                   	push   %rbx
+  801508:	48 83 ec 08          	sub    $0x8,%rsp
+  80150c:	48 89 fa             	mov    %rdi,%rdx
+  80150f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801512:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801517:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801521:	be 00 00 00 00       	mov    $0x0,%esi
+  801526:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80152c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80152e:	48 85 c0             	test   %rax,%rax
+  801531:	7f 06                	jg     801539 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801533:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801537:	c9                   	leave
+  801538:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801539:	49 89 c0             	mov    %rax,%r8
+  80153c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801541:	48 ba b0 39 80 00 00 	movabs $0x8039b0,%rdx
+  801548:	00 00 00 
+  80154b:	be 26 00 00 00       	mov    $0x26,%esi
+  801550:	48 bf cf 39 80 00 00 	movabs $0x8039cf,%rdi
+  801557:	00 00 00 
+  80155a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155f:	49 b9 74 01 80 00 00 	movabs $0x800174,%r9
+  801566:	00 00 00 
+  801569:	41 ff d1             	call   *%r9
+
+000000000080156c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80156c:	55                   	push   %rbp
+  80156d:	48 89 e5             	mov    %rsp,%rbp
+  801570:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801571:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801576:	ba 00 00 00 00       	mov    $0x0,%edx
+  80157b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801580:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801585:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80158a:	be 00 00 00 00       	mov    $0x0,%esi
+  80158f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801595:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801597:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159b:	c9                   	leave
+  80159c:	c3                   	ret
+
+000000000080159d <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80159d:	55                   	push   %rbp
+  80159e:	48 89 e5             	mov    %rsp,%rbp
+  8015a1:	53                   	push   %rbx
+  8015a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a6:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8015a9:	48 63 ce             	movslq %esi,%rcx
+  8015ac:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015af:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015c6:	48 85 c0             	test   %rax,%rax
+  8015c9:	7f 06                	jg     8015d1 <sys_sigqueue+0x34>
+}
+  8015cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015cf:	c9                   	leave
+  8015d0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015d1:	49 89 c0             	mov    %rax,%r8
+  8015d4:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8015d9:	48 ba b0 39 80 00 00 	movabs $0x8039b0,%rdx
+  8015e0:	00 00 00 
+  8015e3:	be 26 00 00 00       	mov    $0x26,%esi
+  8015e8:	48 bf cf 39 80 00 00 	movabs $0x8039cf,%rdi
+  8015ef:	00 00 00 
+  8015f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f7:	49 b9 74 01 80 00 00 	movabs $0x800174,%r9
+  8015fe:	00 00 00 
+  801601:	41 ff d1             	call   *%r9
+
+0000000000801604 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801604:	55                   	push   %rbp
+  801605:	48 89 e5             	mov    %rsp,%rbp
+  801608:	53                   	push   %rbx
+  801609:	48 83 ec 08          	sub    $0x8,%rsp
+  80160d:	48 89 fa             	mov    %rdi,%rdx
+  801610:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801613:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801618:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801622:	be 00 00 00 00       	mov    $0x0,%esi
+  801627:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80162d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80162f:	48 85 c0             	test   %rax,%rax
+  801632:	7f 06                	jg     80163a <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801634:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801638:	c9                   	leave
+  801639:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80163a:	49 89 c0             	mov    %rax,%r8
+  80163d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801642:	48 ba b0 39 80 00 00 	movabs $0x8039b0,%rdx
+  801649:	00 00 00 
+  80164c:	be 26 00 00 00       	mov    $0x26,%esi
+  801651:	48 bf cf 39 80 00 00 	movabs $0x8039cf,%rdi
+  801658:	00 00 00 
+  80165b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801660:	49 b9 74 01 80 00 00 	movabs $0x800174,%r9
+  801667:	00 00 00 
+  80166a:	41 ff d1             	call   *%r9
+
+000000000080166d <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80166d:	55                   	push   %rbp
+  80166e:	48 89 e5             	mov    %rsp,%rbp
+  801671:	53                   	push   %rbx
+  801672:	48 83 ec 08          	sub    $0x8,%rsp
+  801676:	48 89 f1             	mov    %rsi,%rcx
+  801679:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80167c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80167f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801684:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801689:	be 00 00 00 00       	mov    $0x0,%esi
+  80168e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801694:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801696:	48 85 c0             	test   %rax,%rax
+  801699:	7f 06                	jg     8016a1 <sys_sigaction+0x34>
+}
+  80169b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80169f:	c9                   	leave
+  8016a0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016a1:	49 89 c0             	mov    %rax,%r8
+  8016a4:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8016a9:	48 ba b0 39 80 00 00 	movabs $0x8039b0,%rdx
+  8016b0:	00 00 00 
+  8016b3:	be 26 00 00 00       	mov    $0x26,%esi
+  8016b8:	48 bf cf 39 80 00 00 	movabs $0x8039cf,%rdi
+  8016bf:	00 00 00 
+  8016c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c7:	49 b9 74 01 80 00 00 	movabs $0x800174,%r9
+  8016ce:	00 00 00 
+  8016d1:	41 ff d1             	call   *%r9
+
+00000000008016d4 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8016d4:	55                   	push   %rbp
+  8016d5:	48 89 e5             	mov    %rsp,%rbp
+  8016d8:	53                   	push   %rbx
+  8016d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8016dd:	48 89 f1             	mov    %rsi,%rcx
+  8016e0:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8016e3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e6:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016fd:	48 85 c0             	test   %rax,%rax
+  801700:	7f 06                	jg     801708 <sys_sigprocmask+0x34>
+}
+  801702:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801706:	c9                   	leave
+  801707:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801708:	49 89 c0             	mov    %rax,%r8
+  80170b:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801710:	48 ba b0 39 80 00 00 	movabs $0x8039b0,%rdx
+  801717:	00 00 00 
+  80171a:	be 26 00 00 00       	mov    $0x26,%esi
+  80171f:	48 bf cf 39 80 00 00 	movabs $0x8039cf,%rdi
+  801726:	00 00 00 
+  801729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172e:	49 b9 74 01 80 00 00 	movabs $0x800174,%r9
+  801735:	00 00 00 
+  801738:	41 ff d1             	call   *%r9
+
+000000000080173b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80173b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801742:	ff ff ff 
+  801745:	48 01 f8             	add    %rdi,%rax
+  801748:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80174c:	c3                   	ret
+
+000000000080174d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80174d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801754:	ff ff ff 
+  801757:	48 01 f8             	add    %rdi,%rax
+  80175a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80175e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801764:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801768:	c3                   	ret
+
+0000000000801769 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801769:	55                   	push   %rbp
+  80176a:	48 89 e5             	mov    %rsp,%rbp
+  80176d:	41 57                	push   %r15
+  80176f:	41 56                	push   %r14
+  801771:	41 55                	push   %r13
+  801773:	41 54                	push   %r12
+  801775:	53                   	push   %rbx
+  801776:	48 83 ec 08          	sub    $0x8,%rsp
+  80177a:	49 89 ff             	mov    %rdi,%r15
+  80177d:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801782:	49 bd 2f 2f 80 00 00 	movabs $0x802f2f,%r13
+  801789:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80178c:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801792:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801795:	48 89 df             	mov    %rbx,%rdi
+  801798:	41 ff d5             	call   *%r13
+  80179b:	83 e0 04             	and    $0x4,%eax
+  80179e:	74 17                	je     8017b7 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8017a0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8017a7:	4c 39 f3             	cmp    %r14,%rbx
+  8017aa:	75 e6                	jne    801792 <fd_alloc+0x29>
+  8017ac:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8017b2:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8017b7:	4d 89 27             	mov    %r12,(%r15)
+}
+  8017ba:	48 83 c4 08          	add    $0x8,%rsp
+  8017be:	5b                   	pop    %rbx
+  8017bf:	41 5c                	pop    %r12
+  8017c1:	41 5d                	pop    %r13
+  8017c3:	41 5e                	pop    %r14
+  8017c5:	41 5f                	pop    %r15
+  8017c7:	5d                   	pop    %rbp
+  8017c8:	c3                   	ret
+
+00000000008017c9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8017c9:	83 ff 1f             	cmp    $0x1f,%edi
+  8017cc:	77 39                	ja     801807 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8017ce:	55                   	push   %rbp
+  8017cf:	48 89 e5             	mov    %rsp,%rbp
+  8017d2:	41 54                	push   %r12
+  8017d4:	53                   	push   %rbx
+  8017d5:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8017d8:	48 63 df             	movslq %edi,%rbx
+  8017db:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8017e2:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8017e6:	48 89 df             	mov    %rbx,%rdi
+  8017e9:	48 b8 2f 2f 80 00 00 	movabs $0x802f2f,%rax
+  8017f0:	00 00 00 
+  8017f3:	ff d0                	call   *%rax
+  8017f5:	a8 04                	test   $0x4,%al
+  8017f7:	74 14                	je     80180d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8017f9:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8017fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801802:	5b                   	pop    %rbx
+  801803:	41 5c                	pop    %r12
+  801805:	5d                   	pop    %rbp
+  801806:	c3                   	ret
+        return -E_INVAL;
+  801807:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80180c:	c3                   	ret
+        return -E_INVAL;
+  80180d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801812:	eb ee                	jmp    801802 <fd_lookup+0x39>
+
+0000000000801814 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801814:	55                   	push   %rbp
+  801815:	48 89 e5             	mov    %rsp,%rbp
+  801818:	41 54                	push   %r12
+  80181a:	53                   	push   %rbx
+  80181b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80181e:	48 b8 60 3a 80 00 00 	movabs $0x803a60,%rax
+  801825:	00 00 00 
+  801828:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80182f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801832:	39 3b                	cmp    %edi,(%rbx)
+  801834:	74 47                	je     80187d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801836:	48 83 c0 08          	add    $0x8,%rax
+  80183a:	48 8b 18             	mov    (%rax),%rbx
+  80183d:	48 85 db             	test   %rbx,%rbx
+  801840:	75 f0                	jne    801832 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801842:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801849:	00 00 00 
+  80184c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801852:	89 fa                	mov    %edi,%edx
+  801854:	48 bf e0 39 80 00 00 	movabs $0x8039e0,%rdi
+  80185b:	00 00 00 
+  80185e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801863:	48 b9 c4 02 80 00 00 	movabs $0x8002c4,%rcx
+  80186a:	00 00 00 
+  80186d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80186f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801874:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801878:	5b                   	pop    %rbx
+  801879:	41 5c                	pop    %r12
+  80187b:	5d                   	pop    %rbp
+  80187c:	c3                   	ret
+            return 0;
+  80187d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801882:	eb f0                	jmp    801874 <dev_lookup+0x60>
+
+0000000000801884 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801884:	55                   	push   %rbp
+  801885:	48 89 e5             	mov    %rsp,%rbp
+  801888:	41 55                	push   %r13
+  80188a:	41 54                	push   %r12
+  80188c:	53                   	push   %rbx
+  80188d:	48 83 ec 18          	sub    $0x18,%rsp
+  801891:	48 89 fb             	mov    %rdi,%rbx
+  801894:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801897:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80189e:	ff ff ff 
+  8018a1:	48 01 df             	add    %rbx,%rdi
+  8018a4:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8018a8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018ac:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  8018b3:	00 00 00 
+  8018b6:	ff d0                	call   *%rax
+  8018b8:	41 89 c5             	mov    %eax,%r13d
+  8018bb:	85 c0                	test   %eax,%eax
+  8018bd:	78 06                	js     8018c5 <fd_close+0x41>
+  8018bf:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8018c3:	74 1a                	je     8018df <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8018c5:	45 84 e4             	test   %r12b,%r12b
+  8018c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018cd:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8018d1:	44 89 e8             	mov    %r13d,%eax
+  8018d4:	48 83 c4 18          	add    $0x18,%rsp
+  8018d8:	5b                   	pop    %rbx
+  8018d9:	41 5c                	pop    %r12
+  8018db:	41 5d                	pop    %r13
+  8018dd:	5d                   	pop    %rbp
+  8018de:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018df:	8b 3b                	mov    (%rbx),%edi
+  8018e1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018e5:	48 b8 14 18 80 00 00 	movabs $0x801814,%rax
+  8018ec:	00 00 00 
+  8018ef:	ff d0                	call   *%rax
+  8018f1:	41 89 c5             	mov    %eax,%r13d
+  8018f4:	85 c0                	test   %eax,%eax
+  8018f6:	78 1b                	js     801913 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8018f8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018fc:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801900:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801906:	48 85 c0             	test   %rax,%rax
+  801909:	74 08                	je     801913 <fd_close+0x8f>
+  80190b:	48 89 df             	mov    %rbx,%rdi
+  80190e:	ff d0                	call   *%rax
+  801910:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801913:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801918:	48 89 de             	mov    %rbx,%rsi
+  80191b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801920:	48 b8 65 12 80 00 00 	movabs $0x801265,%rax
+  801927:	00 00 00 
+  80192a:	ff d0                	call   *%rax
+    return res;
+  80192c:	eb a3                	jmp    8018d1 <fd_close+0x4d>
+
+000000000080192e <close>:
+
+int
+close(int fdnum) {
+  80192e:	55                   	push   %rbp
+  80192f:	48 89 e5             	mov    %rsp,%rbp
+  801932:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801936:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80193a:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  801941:	00 00 00 
+  801944:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801946:	85 c0                	test   %eax,%eax
+  801948:	78 15                	js     80195f <close+0x31>
+
+    return fd_close(fd, 1);
+  80194a:	be 01 00 00 00       	mov    $0x1,%esi
+  80194f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801953:	48 b8 84 18 80 00 00 	movabs $0x801884,%rax
+  80195a:	00 00 00 
+  80195d:	ff d0                	call   *%rax
+}
+  80195f:	c9                   	leave
+  801960:	c3                   	ret
+
+0000000000801961 <close_all>:
+
+void
+close_all(void) {
+  801961:	55                   	push   %rbp
+  801962:	48 89 e5             	mov    %rsp,%rbp
+  801965:	41 54                	push   %r12
+  801967:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801968:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80196d:	49 bc 2e 19 80 00 00 	movabs $0x80192e,%r12
+  801974:	00 00 00 
+  801977:	89 df                	mov    %ebx,%edi
+  801979:	41 ff d4             	call   *%r12
+  80197c:	83 c3 01             	add    $0x1,%ebx
+  80197f:	83 fb 20             	cmp    $0x20,%ebx
+  801982:	75 f3                	jne    801977 <close_all+0x16>
+}
+  801984:	5b                   	pop    %rbx
+  801985:	41 5c                	pop    %r12
+  801987:	5d                   	pop    %rbp
+  801988:	c3                   	ret
+
+0000000000801989 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801989:	55                   	push   %rbp
+  80198a:	48 89 e5             	mov    %rsp,%rbp
+  80198d:	41 57                	push   %r15
+  80198f:	41 56                	push   %r14
+  801991:	41 55                	push   %r13
+  801993:	41 54                	push   %r12
+  801995:	53                   	push   %rbx
+  801996:	48 83 ec 18          	sub    $0x18,%rsp
+  80199a:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80199d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8019a1:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  8019a8:	00 00 00 
+  8019ab:	ff d0                	call   *%rax
+  8019ad:	89 c3                	mov    %eax,%ebx
+  8019af:	85 c0                	test   %eax,%eax
+  8019b1:	0f 88 b8 00 00 00    	js     801a6f <dup+0xe6>
+    close(newfdnum);
+  8019b7:	44 89 e7             	mov    %r12d,%edi
+  8019ba:	48 b8 2e 19 80 00 00 	movabs $0x80192e,%rax
+  8019c1:	00 00 00 
+  8019c4:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8019c6:	4d 63 ec             	movslq %r12d,%r13
+  8019c9:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8019d0:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8019d4:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8019d8:	4c 89 ff             	mov    %r15,%rdi
+  8019db:	49 be 4d 17 80 00 00 	movabs $0x80174d,%r14
+  8019e2:	00 00 00 
+  8019e5:	41 ff d6             	call   *%r14
+  8019e8:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8019eb:	4c 89 ef             	mov    %r13,%rdi
+  8019ee:	41 ff d6             	call   *%r14
+  8019f1:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8019f4:	48 89 df             	mov    %rbx,%rdi
+  8019f7:	48 b8 2f 2f 80 00 00 	movabs $0x802f2f,%rax
+  8019fe:	00 00 00 
+  801a01:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801a03:	a8 04                	test   $0x4,%al
+  801a05:	74 2b                	je     801a32 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801a07:	41 89 c1             	mov    %eax,%r9d
+  801a0a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a10:	4c 89 f1             	mov    %r14,%rcx
+  801a13:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a18:	48 89 de             	mov    %rbx,%rsi
+  801a1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a20:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  801a27:	00 00 00 
+  801a2a:	ff d0                	call   *%rax
+  801a2c:	89 c3                	mov    %eax,%ebx
+  801a2e:	85 c0                	test   %eax,%eax
+  801a30:	78 4e                	js     801a80 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801a32:	4c 89 ff             	mov    %r15,%rdi
+  801a35:	48 b8 2f 2f 80 00 00 	movabs $0x802f2f,%rax
+  801a3c:	00 00 00 
+  801a3f:	ff d0                	call   *%rax
+  801a41:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801a44:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a4a:	4c 89 e9             	mov    %r13,%rcx
+  801a4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a52:	4c 89 fe             	mov    %r15,%rsi
+  801a55:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a5a:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  801a61:	00 00 00 
+  801a64:	ff d0                	call   *%rax
+  801a66:	89 c3                	mov    %eax,%ebx
+  801a68:	85 c0                	test   %eax,%eax
+  801a6a:	78 14                	js     801a80 <dup+0xf7>
+
+    return newfdnum;
+  801a6c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801a6f:	89 d8                	mov    %ebx,%eax
+  801a71:	48 83 c4 18          	add    $0x18,%rsp
+  801a75:	5b                   	pop    %rbx
+  801a76:	41 5c                	pop    %r12
+  801a78:	41 5d                	pop    %r13
+  801a7a:	41 5e                	pop    %r14
+  801a7c:	41 5f                	pop    %r15
+  801a7e:	5d                   	pop    %rbp
+  801a7f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a80:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a85:	4c 89 ee             	mov    %r13,%rsi
+  801a88:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a8d:	49 bc 65 12 80 00 00 	movabs $0x801265,%r12
+  801a94:	00 00 00 
+  801a97:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801a9a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a9f:	4c 89 f6             	mov    %r14,%rsi
+  801aa2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aa7:	41 ff d4             	call   *%r12
+    return res;
+  801aaa:	eb c3                	jmp    801a6f <dup+0xe6>
+
+0000000000801aac <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801aac:	55                   	push   %rbp
+  801aad:	48 89 e5             	mov    %rsp,%rbp
+  801ab0:	41 56                	push   %r14
+  801ab2:	41 55                	push   %r13
+  801ab4:	41 54                	push   %r12
+  801ab6:	53                   	push   %rbx
+  801ab7:	48 83 ec 10          	sub    $0x10,%rsp
+  801abb:	89 fb                	mov    %edi,%ebx
+  801abd:	49 89 f4             	mov    %rsi,%r12
+  801ac0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ac3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ac7:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  801ace:	00 00 00 
+  801ad1:	ff d0                	call   *%rax
+  801ad3:	85 c0                	test   %eax,%eax
+  801ad5:	78 4c                	js     801b23 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ad7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801adb:	41 8b 3e             	mov    (%r14),%edi
+  801ade:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ae2:	48 b8 14 18 80 00 00 	movabs $0x801814,%rax
+  801ae9:	00 00 00 
+  801aec:	ff d0                	call   *%rax
+  801aee:	85 c0                	test   %eax,%eax
+  801af0:	78 35                	js     801b27 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801af2:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801af6:	83 e0 03             	and    $0x3,%eax
+  801af9:	83 f8 01             	cmp    $0x1,%eax
+  801afc:	74 2d                	je     801b2b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801afe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b02:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801b06:	48 85 c0             	test   %rax,%rax
+  801b09:	74 56                	je     801b61 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801b0b:	4c 89 ea             	mov    %r13,%rdx
+  801b0e:	4c 89 e6             	mov    %r12,%rsi
+  801b11:	4c 89 f7             	mov    %r14,%rdi
+  801b14:	ff d0                	call   *%rax
+}
+  801b16:	48 83 c4 10          	add    $0x10,%rsp
+  801b1a:	5b                   	pop    %rbx
+  801b1b:	41 5c                	pop    %r12
+  801b1d:	41 5d                	pop    %r13
+  801b1f:	41 5e                	pop    %r14
+  801b21:	5d                   	pop    %rbp
+  801b22:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b23:	48 98                	cltq
+  801b25:	eb ef                	jmp    801b16 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b27:	48 98                	cltq
+  801b29:	eb eb                	jmp    801b16 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b2b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b32:	00 00 00 
+  801b35:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b3b:	89 da                	mov    %ebx,%edx
+  801b3d:	48 bf 21 3a 80 00 00 	movabs $0x803a21,%rdi
+  801b44:	00 00 00 
+  801b47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4c:	48 b9 c4 02 80 00 00 	movabs $0x8002c4,%rcx
+  801b53:	00 00 00 
+  801b56:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b58:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b5f:	eb b5                	jmp    801b16 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b61:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b68:	eb ac                	jmp    801b16 <read+0x6a>
+
+0000000000801b6a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801b6a:	55                   	push   %rbp
+  801b6b:	48 89 e5             	mov    %rsp,%rbp
+  801b6e:	41 57                	push   %r15
+  801b70:	41 56                	push   %r14
+  801b72:	41 55                	push   %r13
+  801b74:	41 54                	push   %r12
+  801b76:	53                   	push   %rbx
+  801b77:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b7b:	48 85 d2             	test   %rdx,%rdx
+  801b7e:	74 54                	je     801bd4 <readn+0x6a>
+  801b80:	41 89 fd             	mov    %edi,%r13d
+  801b83:	49 89 f6             	mov    %rsi,%r14
+  801b86:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b89:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b8e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b93:	49 bf ac 1a 80 00 00 	movabs $0x801aac,%r15
+  801b9a:	00 00 00 
+  801b9d:	4c 89 e2             	mov    %r12,%rdx
+  801ba0:	48 29 f2             	sub    %rsi,%rdx
+  801ba3:	4c 01 f6             	add    %r14,%rsi
+  801ba6:	44 89 ef             	mov    %r13d,%edi
+  801ba9:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801bac:	85 c0                	test   %eax,%eax
+  801bae:	78 20                	js     801bd0 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801bb0:	01 c3                	add    %eax,%ebx
+  801bb2:	85 c0                	test   %eax,%eax
+  801bb4:	74 08                	je     801bbe <readn+0x54>
+  801bb6:	48 63 f3             	movslq %ebx,%rsi
+  801bb9:	4c 39 e6             	cmp    %r12,%rsi
+  801bbc:	72 df                	jb     801b9d <readn+0x33>
+    }
+    return res;
+  801bbe:	48 63 c3             	movslq %ebx,%rax
+}
+  801bc1:	48 83 c4 08          	add    $0x8,%rsp
+  801bc5:	5b                   	pop    %rbx
+  801bc6:	41 5c                	pop    %r12
+  801bc8:	41 5d                	pop    %r13
+  801bca:	41 5e                	pop    %r14
+  801bcc:	41 5f                	pop    %r15
+  801bce:	5d                   	pop    %rbp
+  801bcf:	c3                   	ret
+        if (inc < 0) return inc;
+  801bd0:	48 98                	cltq
+  801bd2:	eb ed                	jmp    801bc1 <readn+0x57>
+    int inc = 1, res = 0;
+  801bd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bd9:	eb e3                	jmp    801bbe <readn+0x54>
+
+0000000000801bdb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801bdb:	55                   	push   %rbp
+  801bdc:	48 89 e5             	mov    %rsp,%rbp
+  801bdf:	41 56                	push   %r14
+  801be1:	41 55                	push   %r13
+  801be3:	41 54                	push   %r12
+  801be5:	53                   	push   %rbx
+  801be6:	48 83 ec 10          	sub    $0x10,%rsp
+  801bea:	89 fb                	mov    %edi,%ebx
+  801bec:	49 89 f4             	mov    %rsi,%r12
+  801bef:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bf2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bf6:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  801bfd:	00 00 00 
+  801c00:	ff d0                	call   *%rax
+  801c02:	85 c0                	test   %eax,%eax
+  801c04:	78 47                	js     801c4d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c06:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c0a:	41 8b 3e             	mov    (%r14),%edi
+  801c0d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c11:	48 b8 14 18 80 00 00 	movabs $0x801814,%rax
+  801c18:	00 00 00 
+  801c1b:	ff d0                	call   *%rax
+  801c1d:	85 c0                	test   %eax,%eax
+  801c1f:	78 30                	js     801c51 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c21:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801c26:	74 2d                	je     801c55 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c28:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c2c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c30:	48 85 c0             	test   %rax,%rax
+  801c33:	74 56                	je     801c8b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801c35:	4c 89 ea             	mov    %r13,%rdx
+  801c38:	4c 89 e6             	mov    %r12,%rsi
+  801c3b:	4c 89 f7             	mov    %r14,%rdi
+  801c3e:	ff d0                	call   *%rax
+}
+  801c40:	48 83 c4 10          	add    $0x10,%rsp
+  801c44:	5b                   	pop    %rbx
+  801c45:	41 5c                	pop    %r12
+  801c47:	41 5d                	pop    %r13
+  801c49:	41 5e                	pop    %r14
+  801c4b:	5d                   	pop    %rbp
+  801c4c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c4d:	48 98                	cltq
+  801c4f:	eb ef                	jmp    801c40 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c51:	48 98                	cltq
+  801c53:	eb eb                	jmp    801c40 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c55:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c5c:	00 00 00 
+  801c5f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c65:	89 da                	mov    %ebx,%edx
+  801c67:	48 bf 3d 3a 80 00 00 	movabs $0x803a3d,%rdi
+  801c6e:	00 00 00 
+  801c71:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c76:	48 b9 c4 02 80 00 00 	movabs $0x8002c4,%rcx
+  801c7d:	00 00 00 
+  801c80:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c82:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c89:	eb b5                	jmp    801c40 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c8b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c92:	eb ac                	jmp    801c40 <write+0x65>
+
+0000000000801c94 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c94:	55                   	push   %rbp
+  801c95:	48 89 e5             	mov    %rsp,%rbp
+  801c98:	53                   	push   %rbx
+  801c99:	48 83 ec 18          	sub    $0x18,%rsp
+  801c9d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c9f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ca3:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  801caa:	00 00 00 
+  801cad:	ff d0                	call   *%rax
+  801caf:	85 c0                	test   %eax,%eax
+  801cb1:	78 0c                	js     801cbf <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801cb3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cb7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801cba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cbf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cc3:	c9                   	leave
+  801cc4:	c3                   	ret
+
+0000000000801cc5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801cc5:	55                   	push   %rbp
+  801cc6:	48 89 e5             	mov    %rsp,%rbp
+  801cc9:	41 55                	push   %r13
+  801ccb:	41 54                	push   %r12
+  801ccd:	53                   	push   %rbx
+  801cce:	48 83 ec 18          	sub    $0x18,%rsp
+  801cd2:	89 fb                	mov    %edi,%ebx
+  801cd4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cd7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cdb:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  801ce2:	00 00 00 
+  801ce5:	ff d0                	call   *%rax
+  801ce7:	85 c0                	test   %eax,%eax
+  801ce9:	78 38                	js     801d23 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ceb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801cef:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801cf3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cf7:	48 b8 14 18 80 00 00 	movabs $0x801814,%rax
+  801cfe:	00 00 00 
+  801d01:	ff d0                	call   *%rax
+  801d03:	85 c0                	test   %eax,%eax
+  801d05:	78 1c                	js     801d23 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d07:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801d0c:	74 20                	je     801d2e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d12:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801d16:	48 85 c0             	test   %rax,%rax
+  801d19:	74 47                	je     801d62 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801d1b:	44 89 e6             	mov    %r12d,%esi
+  801d1e:	4c 89 ef             	mov    %r13,%rdi
+  801d21:	ff d0                	call   *%rax
+}
+  801d23:	48 83 c4 18          	add    $0x18,%rsp
+  801d27:	5b                   	pop    %rbx
+  801d28:	41 5c                	pop    %r12
+  801d2a:	41 5d                	pop    %r13
+  801d2c:	5d                   	pop    %rbp
+  801d2d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801d2e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d35:	00 00 00 
+  801d38:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d3e:	89 da                	mov    %ebx,%edx
+  801d40:	48 bf 00 3a 80 00 00 	movabs $0x803a00,%rdi
+  801d47:	00 00 00 
+  801d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d4f:	48 b9 c4 02 80 00 00 	movabs $0x8002c4,%rcx
+  801d56:	00 00 00 
+  801d59:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d60:	eb c1                	jmp    801d23 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d62:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d67:	eb ba                	jmp    801d23 <ftruncate+0x5e>
+
+0000000000801d69 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801d69:	55                   	push   %rbp
+  801d6a:	48 89 e5             	mov    %rsp,%rbp
+  801d6d:	41 54                	push   %r12
+  801d6f:	53                   	push   %rbx
+  801d70:	48 83 ec 10          	sub    $0x10,%rsp
+  801d74:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d77:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d7b:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  801d82:	00 00 00 
+  801d85:	ff d0                	call   *%rax
+  801d87:	85 c0                	test   %eax,%eax
+  801d89:	78 4e                	js     801dd9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d8b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d8f:	41 8b 3c 24          	mov    (%r12),%edi
+  801d93:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d97:	48 b8 14 18 80 00 00 	movabs $0x801814,%rax
+  801d9e:	00 00 00 
+  801da1:	ff d0                	call   *%rax
+  801da3:	85 c0                	test   %eax,%eax
+  801da5:	78 32                	js     801dd9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801da7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dab:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801db0:	74 30                	je     801de2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801db2:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801db5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801dbc:	00 00 00 
+    stat->st_isdir = 0;
+  801dbf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801dc6:	00 00 00 
+    stat->st_dev = dev;
+  801dc9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801dd0:	48 89 de             	mov    %rbx,%rsi
+  801dd3:	4c 89 e7             	mov    %r12,%rdi
+  801dd6:	ff 50 28             	call   *0x28(%rax)
+}
+  801dd9:	48 83 c4 10          	add    $0x10,%rsp
+  801ddd:	5b                   	pop    %rbx
+  801dde:	41 5c                	pop    %r12
+  801de0:	5d                   	pop    %rbp
+  801de1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801de2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801de7:	eb f0                	jmp    801dd9 <fstat+0x70>
+
+0000000000801de9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801de9:	55                   	push   %rbp
+  801dea:	48 89 e5             	mov    %rsp,%rbp
+  801ded:	41 54                	push   %r12
+  801def:	53                   	push   %rbx
+  801df0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801df3:	be 00 00 00 00       	mov    $0x0,%esi
+  801df8:	48 b8 6a 20 80 00 00 	movabs $0x80206a,%rax
+  801dff:	00 00 00 
+  801e02:	ff d0                	call   *%rax
+  801e04:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801e06:	85 c0                	test   %eax,%eax
+  801e08:	78 25                	js     801e2f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801e0a:	4c 89 e6             	mov    %r12,%rsi
+  801e0d:	89 c7                	mov    %eax,%edi
+  801e0f:	48 b8 69 1d 80 00 00 	movabs $0x801d69,%rax
+  801e16:	00 00 00 
+  801e19:	ff d0                	call   *%rax
+  801e1b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801e1e:	89 df                	mov    %ebx,%edi
+  801e20:	48 b8 2e 19 80 00 00 	movabs $0x80192e,%rax
+  801e27:	00 00 00 
+  801e2a:	ff d0                	call   *%rax
+
+    return res;
+  801e2c:	44 89 e3             	mov    %r12d,%ebx
+}
+  801e2f:	89 d8                	mov    %ebx,%eax
+  801e31:	5b                   	pop    %rbx
+  801e32:	41 5c                	pop    %r12
+  801e34:	5d                   	pop    %rbp
+  801e35:	c3                   	ret
+
+0000000000801e36 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801e36:	55                   	push   %rbp
+  801e37:	48 89 e5             	mov    %rsp,%rbp
+  801e3a:	41 54                	push   %r12
+  801e3c:	53                   	push   %rbx
+  801e3d:	48 83 ec 10          	sub    $0x10,%rsp
+  801e41:	41 89 fc             	mov    %edi,%r12d
+  801e44:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e47:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e4e:	00 00 00 
+  801e51:	83 38 00             	cmpl   $0x0,(%rax)
+  801e54:	74 5e                	je     801eb4 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801e56:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801e5c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e61:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801e68:	00 00 00 
+  801e6b:	44 89 e6             	mov    %r12d,%esi
+  801e6e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e75:	00 00 00 
+  801e78:	8b 38                	mov    (%rax),%edi
+  801e7a:	48 b8 eb 32 80 00 00 	movabs $0x8032eb,%rax
+  801e81:	00 00 00 
+  801e84:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801e86:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801e8d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801e8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e93:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801e97:	48 89 de             	mov    %rbx,%rsi
+  801e9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e9f:	48 b8 56 32 80 00 00 	movabs $0x803256,%rax
+  801ea6:	00 00 00 
+  801ea9:	ff d0                	call   *%rax
+}
+  801eab:	48 83 c4 10          	add    $0x10,%rsp
+  801eaf:	5b                   	pop    %rbx
+  801eb0:	41 5c                	pop    %r12
+  801eb2:	5d                   	pop    %rbp
+  801eb3:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801eb4:	bf 03 00 00 00       	mov    $0x3,%edi
+  801eb9:	48 b8 8b 33 80 00 00 	movabs $0x80338b,%rax
+  801ec0:	00 00 00 
+  801ec3:	ff d0                	call   *%rax
+  801ec5:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801ecc:	00 00 
+  801ece:	eb 86                	jmp    801e56 <fsipc+0x20>
+
+0000000000801ed0 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801ed0:	55                   	push   %rbp
+  801ed1:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ed4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801edb:	00 00 00 
+  801ede:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801ee1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801ee3:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801ee6:	be 00 00 00 00       	mov    $0x0,%esi
+  801eeb:	bf 02 00 00 00       	mov    $0x2,%edi
+  801ef0:	48 b8 36 1e 80 00 00 	movabs $0x801e36,%rax
+  801ef7:	00 00 00 
+  801efa:	ff d0                	call   *%rax
+}
+  801efc:	5d                   	pop    %rbp
+  801efd:	c3                   	ret
+
+0000000000801efe <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801efe:	55                   	push   %rbp
+  801eff:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f02:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801f05:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801f0c:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801f0e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f13:	bf 06 00 00 00       	mov    $0x6,%edi
+  801f18:	48 b8 36 1e 80 00 00 	movabs $0x801e36,%rax
+  801f1f:	00 00 00 
+  801f22:	ff d0                	call   *%rax
+}
+  801f24:	5d                   	pop    %rbp
+  801f25:	c3                   	ret
+
+0000000000801f26 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801f26:	55                   	push   %rbp
+  801f27:	48 89 e5             	mov    %rsp,%rbp
+  801f2a:	41 54                	push   %r12
+  801f2c:	53                   	push   %rbx
+  801f2d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f30:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801f33:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801f3a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801f3c:	be 00 00 00 00       	mov    $0x0,%esi
+  801f41:	bf 05 00 00 00       	mov    $0x5,%edi
+  801f46:	48 b8 36 1e 80 00 00 	movabs $0x801e36,%rax
+  801f4d:	00 00 00 
+  801f50:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801f52:	85 c0                	test   %eax,%eax
+  801f54:	78 3d                	js     801f93 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f56:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801f5d:	00 00 00 
+  801f60:	4c 89 e6             	mov    %r12,%rsi
+  801f63:	48 89 df             	mov    %rbx,%rdi
+  801f66:	48 b8 e9 0b 80 00 00 	movabs $0x800be9,%rax
+  801f6d:	00 00 00 
+  801f70:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801f72:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801f79:	00 
+  801f7a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f80:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801f87:	00 
+  801f88:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801f8e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f93:	5b                   	pop    %rbx
+  801f94:	41 5c                	pop    %r12
+  801f96:	5d                   	pop    %rbp
+  801f97:	c3                   	ret
+
+0000000000801f98 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801f98:	55                   	push   %rbp
+  801f99:	48 89 e5             	mov    %rsp,%rbp
+  801f9c:	41 54                	push   %r12
+  801f9e:	53                   	push   %rbx
+  801f9f:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  801fa2:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  801fa7:	48 39 c2             	cmp    %rax,%rdx
+  801faa:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801fae:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801fb1:	48 89 c2             	mov    %rax,%rdx
+  801fb4:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801fbb:	00 00 00 
+  801fbe:	48 b8 4a 0e 80 00 00 	movabs $0x800e4a,%rax
+  801fc5:	00 00 00 
+  801fc8:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fca:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801fd1:	00 00 00 
+  801fd4:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  801fd9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  801fdb:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  801fdf:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe4:	bf 04 00 00 00       	mov    $0x4,%edi
+  801fe9:	48 b8 36 1e 80 00 00 	movabs $0x801e36,%rax
+  801ff0:	00 00 00 
+  801ff3:	ff d0                	call   *%rax
+  801ff5:	48 98                	cltq
+}
+  801ff7:	5b                   	pop    %rbx
+  801ff8:	41 5c                	pop    %r12
+  801ffa:	5d                   	pop    %rbp
+  801ffb:	c3                   	ret
+
+0000000000801ffc <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801ffc:	55                   	push   %rbp
+  801ffd:	48 89 e5             	mov    %rsp,%rbp
+  802000:	41 54                	push   %r12
+  802002:	53                   	push   %rbx
+  802003:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802006:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80200d:	00 00 00 
+  802010:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802013:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  802015:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80201a:	48 39 ca             	cmp    %rcx,%rdx
+  80201d:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  802021:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  802025:	be 00 00 00 00       	mov    $0x0,%esi
+  80202a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80202f:	48 b8 36 1e 80 00 00 	movabs $0x801e36,%rax
+  802036:	00 00 00 
+  802039:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  80203b:	85 c0                	test   %eax,%eax
+  80203d:	78 27                	js     802066 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  80203f:	48 63 d8             	movslq %eax,%rbx
+  802042:	48 89 da             	mov    %rbx,%rdx
+  802045:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80204c:	00 00 00 
+  80204f:	4c 89 e7             	mov    %r12,%rdi
+  802052:	48 b8 4a 0e 80 00 00 	movabs $0x800e4a,%rax
+  802059:	00 00 00 
+  80205c:	ff d0                	call   *%rax
+    return bytes_read;
+  80205e:	48 89 d8             	mov    %rbx,%rax
+}
+  802061:	5b                   	pop    %rbx
+  802062:	41 5c                	pop    %r12
+  802064:	5d                   	pop    %rbp
+  802065:	c3                   	ret
+        return bytes_read;
+  802066:	48 98                	cltq
+  802068:	eb f7                	jmp    802061 <devfile_read+0x65>
+
+000000000080206a <open>:
+open(const char *path, int mode) {
+  80206a:	55                   	push   %rbp
+  80206b:	48 89 e5             	mov    %rsp,%rbp
+  80206e:	41 55                	push   %r13
+  802070:	41 54                	push   %r12
+  802072:	53                   	push   %rbx
+  802073:	48 83 ec 18          	sub    $0x18,%rsp
+  802077:	49 89 fc             	mov    %rdi,%r12
+  80207a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80207d:	48 b8 ab 0b 80 00 00 	movabs $0x800bab,%rax
+  802084:	00 00 00 
+  802087:	ff d0                	call   *%rax
+  802089:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80208f:	0f 87 8a 00 00 00    	ja     80211f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802095:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802099:	48 b8 69 17 80 00 00 	movabs $0x801769,%rax
+  8020a0:	00 00 00 
+  8020a3:	ff d0                	call   *%rax
+  8020a5:	89 c3                	mov    %eax,%ebx
+  8020a7:	85 c0                	test   %eax,%eax
+  8020a9:	78 50                	js     8020fb <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8020ab:	4c 89 e6             	mov    %r12,%rsi
+  8020ae:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8020b5:	00 00 00 
+  8020b8:	48 89 df             	mov    %rbx,%rdi
+  8020bb:	48 b8 e9 0b 80 00 00 	movabs $0x800be9,%rax
+  8020c2:	00 00 00 
+  8020c5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8020c7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8020ce:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8020d2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020d7:	48 b8 36 1e 80 00 00 	movabs $0x801e36,%rax
+  8020de:	00 00 00 
+  8020e1:	ff d0                	call   *%rax
+  8020e3:	89 c3                	mov    %eax,%ebx
+  8020e5:	85 c0                	test   %eax,%eax
+  8020e7:	78 1f                	js     802108 <open+0x9e>
+    return fd2num(fd);
+  8020e9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020ed:	48 b8 3b 17 80 00 00 	movabs $0x80173b,%rax
+  8020f4:	00 00 00 
+  8020f7:	ff d0                	call   *%rax
+  8020f9:	89 c3                	mov    %eax,%ebx
+}
+  8020fb:	89 d8                	mov    %ebx,%eax
+  8020fd:	48 83 c4 18          	add    $0x18,%rsp
+  802101:	5b                   	pop    %rbx
+  802102:	41 5c                	pop    %r12
+  802104:	41 5d                	pop    %r13
+  802106:	5d                   	pop    %rbp
+  802107:	c3                   	ret
+        fd_close(fd, 0);
+  802108:	be 00 00 00 00       	mov    $0x0,%esi
+  80210d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802111:	48 b8 84 18 80 00 00 	movabs $0x801884,%rax
+  802118:	00 00 00 
+  80211b:	ff d0                	call   *%rax
+        return res;
+  80211d:	eb dc                	jmp    8020fb <open+0x91>
+        return -E_BAD_PATH;
+  80211f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802124:	eb d5                	jmp    8020fb <open+0x91>
+
+0000000000802126 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802126:	55                   	push   %rbp
+  802127:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80212a:	be 00 00 00 00       	mov    $0x0,%esi
+  80212f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802134:	48 b8 36 1e 80 00 00 	movabs $0x801e36,%rax
+  80213b:	00 00 00 
+  80213e:	ff d0                	call   *%rax
+}
+  802140:	5d                   	pop    %rbp
+  802141:	c3                   	ret
+
+0000000000802142 <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  802142:	55                   	push   %rbp
+  802143:	48 89 e5             	mov    %rsp,%rbp
+  802146:	41 55                	push   %r13
+  802148:	41 54                	push   %r12
+  80214a:	53                   	push   %rbx
+  80214b:	48 83 ec 08          	sub    $0x8,%rsp
+  80214f:	48 89 fb             	mov    %rdi,%rbx
+  802152:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  802155:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  802158:	48 b8 2f 2f 80 00 00 	movabs $0x802f2f,%rax
+  80215f:	00 00 00 
+  802162:	ff d0                	call   *%rax
+  802164:	41 89 c1             	mov    %eax,%r9d
+  802167:	4d 89 e0             	mov    %r12,%r8
+  80216a:	49 29 d8             	sub    %rbx,%r8
+  80216d:	48 89 d9             	mov    %rbx,%rcx
+  802170:	44 89 ea             	mov    %r13d,%edx
+  802173:	48 89 de             	mov    %rbx,%rsi
+  802176:	bf 00 00 00 00       	mov    $0x0,%edi
+  80217b:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  802182:	00 00 00 
+  802185:	ff d0                	call   *%rax
+}
+  802187:	48 83 c4 08          	add    $0x8,%rsp
+  80218b:	5b                   	pop    %rbx
+  80218c:	41 5c                	pop    %r12
+  80218e:	41 5d                	pop    %r13
+  802190:	5d                   	pop    %rbp
+  802191:	c3                   	ret
+
+0000000000802192 <spawn>:
+spawn(const char *prog, const char **argv) {
+  802192:	55                   	push   %rbp
+  802193:	48 89 e5             	mov    %rsp,%rbp
+  802196:	41 57                	push   %r15
+  802198:	41 56                	push   %r14
+  80219a:	41 55                	push   %r13
+  80219c:	41 54                	push   %r12
+  80219e:	53                   	push   %rbx
+  80219f:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  8021a6:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  8021a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ae:	48 b8 6a 20 80 00 00 	movabs $0x80206a,%rax
+  8021b5:	00 00 00 
+  8021b8:	ff d0                	call   *%rax
+  8021ba:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+    if (fd < 0) return fd;
+  8021c0:	85 c0                	test   %eax,%eax
+  8021c2:	0f 88 51 06 00 00    	js     802819 <spawn+0x687>
+  8021c8:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  8021ca:	ba 00 02 00 00       	mov    $0x200,%edx
+  8021cf:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  8021d6:	48 b8 6a 1b 80 00 00 	movabs $0x801b6a,%rax
+  8021dd:	00 00 00 
+  8021e0:	ff d0                	call   *%rax
+  8021e2:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  8021e4:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8021e9:	0f 85 76 02 00 00    	jne    802465 <spawn+0x2d3>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  8021ef:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  8021f6:	ff ff 00 
+  8021f9:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  802200:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  802207:	01 01 00 
+  80220a:	48 39 d0             	cmp    %rdx,%rax
+  80220d:	0f 85 8e 02 00 00    	jne    8024a1 <spawn+0x30f>
+        elf->e_type != ET_EXEC /* executable */ ||
+  802213:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  80221a:	00 3e 00 
+  80221d:	0f 85 7e 02 00 00    	jne    8024a1 <spawn+0x30f>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802223:	b8 08 00 00 00       	mov    $0x8,%eax
+  802228:	cd 30                	int    $0x30
+  80222a:	41 89 c6             	mov    %eax,%r14d
+  80222d:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  80222f:	85 c0                	test   %eax,%eax
+  802231:	0f 88 ca 05 00 00    	js     802801 <spawn+0x66f>
+    envid_t child = res;
+  802237:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  80223d:	0f b6 c0             	movzbl %al,%eax
+  802240:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802247:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  80224e:	00 00 00 
+  802251:	48 01 c6             	add    %rax,%rsi
+  802254:	48 8b 06             	mov    (%rsi),%rax
+  802257:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  80225e:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  802265:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  80226c:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  802273:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  80227a:	48 29 ce             	sub    %rcx,%rsi
+  80227d:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  802283:	c1 e9 03             	shr    $0x3,%ecx
+  802286:	89 c9                	mov    %ecx,%ecx
+  802288:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  80228b:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  802292:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  802299:	49 8b 3c 24          	mov    (%r12),%rdi
+  80229d:	48 85 ff             	test   %rdi,%rdi
+  8022a0:	0f 84 8b 05 00 00    	je     802831 <spawn+0x69f>
+  8022a6:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  8022ac:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  8022b2:	48 bb ab 0b 80 00 00 	movabs $0x800bab,%rbx
+  8022b9:	00 00 00 
+  8022bc:	ff d3                	call   *%rbx
+  8022be:	4c 01 f8             	add    %r15,%rax
+  8022c1:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  8022c5:	4c 89 ea             	mov    %r13,%rdx
+  8022c8:	49 83 c5 01          	add    $0x1,%r13
+  8022cc:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  8022d1:	48 85 ff             	test   %rdi,%rdi
+  8022d4:	75 e6                	jne    8022bc <spawn+0x12a>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8022d6:	49 89 d5             	mov    %rdx,%r13
+  8022d9:	48 89 95 e0 fc ff ff 	mov    %rdx,-0x320(%rbp)
+  8022e0:	48 f7 d0             	not    %rax
+  8022e3:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8022ea:	49 89 df             	mov    %rbx,%r15
+  8022ed:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  8022f1:	4c 89 bd f0 fc ff ff 	mov    %r15,-0x310(%rbp)
+  8022f8:	89 d0                	mov    %edx,%eax
+  8022fa:	83 c0 01             	add    $0x1,%eax
+  8022fd:	48 98                	cltq
+  8022ff:	48 c1 e0 03          	shl    $0x3,%rax
+  802303:	49 29 c7             	sub    %rax,%r15
+  802306:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  80230d:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  802311:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  802317:	0f 86 cb 04 00 00    	jbe    8027e8 <spawn+0x656>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  80231d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802322:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802327:	be 00 00 40 00       	mov    $0x400000,%esi
+  80232c:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  802333:	00 00 00 
+  802336:	ff d0                	call   *%rax
+  802338:	85 c0                	test   %eax,%eax
+  80233a:	0f 88 ad 04 00 00    	js     8027ed <spawn+0x65b>
+    for (i = 0; i < argc; i++) {
+  802340:	4c 89 e8             	mov    %r13,%rax
+  802343:	45 85 ed             	test   %r13d,%r13d
+  802346:	7e 54                	jle    80239c <spawn+0x20a>
+  802348:	4d 89 fd             	mov    %r15,%r13
+  80234b:	48 98                	cltq
+  80234d:	4d 8d 3c c7          	lea    (%r15,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  802351:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  802358:	00 00 00 
+  80235b:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  802362:	ff 
+  802363:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  802367:	49 8b 34 24          	mov    (%r12),%rsi
+  80236b:	48 89 df             	mov    %rbx,%rdi
+  80236e:	48 b8 e9 0b 80 00 00 	movabs $0x800be9,%rax
+  802375:	00 00 00 
+  802378:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  80237a:	49 8b 3c 24          	mov    (%r12),%rdi
+  80237e:	48 b8 ab 0b 80 00 00 	movabs $0x800bab,%rax
+  802385:	00 00 00 
+  802388:	ff d0                	call   *%rax
+  80238a:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  80238f:	49 83 c5 08          	add    $0x8,%r13
+  802393:	49 83 c4 08          	add    $0x8,%r12
+  802397:	4d 39 fd             	cmp    %r15,%r13
+  80239a:	75 b5                	jne    802351 <spawn+0x1bf>
+    argv_store[argc] = 0;
+  80239c:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  8023a3:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  8023aa:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8023ab:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  8023b2:	0f 85 30 01 00 00    	jne    8024e8 <spawn+0x356>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  8023b8:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  8023bf:	00 00 00 
+  8023c2:	48 8b 9d e8 fc ff ff 	mov    -0x318(%rbp),%rbx
+  8023c9:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  8023d0:	ff 
+  8023d1:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  8023d5:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  8023dc:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  8023e0:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  8023e7:	00 00 00 
+  8023ea:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  8023f1:	ff 
+  8023f2:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  8023f9:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8023ff:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  802405:	44 89 f2             	mov    %r14d,%edx
+  802408:	be 00 00 40 00       	mov    $0x400000,%esi
+  80240d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802412:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  802419:	00 00 00 
+  80241c:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  80241e:	48 bb 65 12 80 00 00 	movabs $0x801265,%rbx
+  802425:	00 00 00 
+  802428:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80242d:	be 00 00 40 00       	mov    $0x400000,%esi
+  802432:	bf 00 00 00 00       	mov    $0x0,%edi
+  802437:	ff d3                	call   *%rbx
+  802439:	85 c0                	test   %eax,%eax
+  80243b:	78 eb                	js     802428 <spawn+0x296>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80243d:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  802444:	4c 8d a4 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r12
+  80244b:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80244c:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  802453:	00 
+  802454:	0f 84 87 02 00 00    	je     8026e1 <spawn+0x54f>
+  80245a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  802460:	e9 fe 00 00 00       	jmp    802563 <spawn+0x3d1>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  802465:	48 bf 80 3a 80 00 00 	movabs $0x803a80,%rdi
+  80246c:	00 00 00 
+  80246f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802474:	48 ba c4 02 80 00 00 	movabs $0x8002c4,%rdx
+  80247b:	00 00 00 
+  80247e:	ff d2                	call   *%rdx
+        close(fd);
+  802480:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802486:	48 b8 2e 19 80 00 00 	movabs $0x80192e,%rax
+  80248d:	00 00 00 
+  802490:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  802492:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  802499:	ff ff ff 
+  80249c:	e9 78 03 00 00       	jmp    802819 <spawn+0x687>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8024a1:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  8024a6:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  8024ac:	48 bf e0 3a 80 00 00 	movabs $0x803ae0,%rdi
+  8024b3:	00 00 00 
+  8024b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024bb:	48 b9 c4 02 80 00 00 	movabs $0x8002c4,%rcx
+  8024c2:	00 00 00 
+  8024c5:	ff d1                	call   *%rcx
+        close(fd);
+  8024c7:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  8024cd:	48 b8 2e 19 80 00 00 	movabs $0x80192e,%rax
+  8024d4:	00 00 00 
+  8024d7:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8024d9:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  8024e0:	ff ff ff 
+  8024e3:	e9 31 03 00 00       	jmp    802819 <spawn+0x687>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8024e8:	48 b9 b0 3a 80 00 00 	movabs $0x803ab0,%rcx
+  8024ef:	00 00 00 
+  8024f2:	48 ba fa 3a 80 00 00 	movabs $0x803afa,%rdx
+  8024f9:	00 00 00 
+  8024fc:	be f0 00 00 00       	mov    $0xf0,%esi
+  802501:	48 bf 0f 3b 80 00 00 	movabs $0x803b0f,%rdi
+  802508:	00 00 00 
+  80250b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802510:	49 b8 74 01 80 00 00 	movabs $0x800174,%r8
+  802517:	00 00 00 
+  80251a:	41 ff d0             	call   *%r8
+        if (err)
+            return err;
+    }
+
+    /* Allocate filesz in parent to UTEMP */
+    int err = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+  80251d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802522:	4c 89 ea             	mov    %r13,%rdx
+  802525:	be 00 00 40 00       	mov    $0x400000,%esi
+  80252a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80252f:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  802536:	00 00 00 
+  802539:	ff d0                	call   *%rax
+    if (err)
+  80253b:	85 c0                	test   %eax,%eax
+  80253d:	0f 84 d2 00 00 00    	je     802615 <spawn+0x483>
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  802543:	85 c0                	test   %eax,%eax
+  802545:	0f 88 99 02 00 00    	js     8027e4 <spawn+0x652>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80254b:	49 83 c7 01          	add    $0x1,%r15
+  80254f:	49 83 c4 38          	add    $0x38,%r12
+  802553:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  80255a:	49 39 c7             	cmp    %rax,%r15
+  80255d:	0f 83 7e 01 00 00    	jae    8026e1 <spawn+0x54f>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  802563:	41 83 3c 24 01       	cmpl   $0x1,(%r12)
+  802568:	75 e1                	jne    80254b <spawn+0x3b9>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  80256a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80256f:	41 89 c6             	mov    %eax,%r14d
+  802572:	41 83 e6 02          	and    $0x2,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  802576:	44 89 f2             	mov    %r14d,%edx
+  802579:	83 ca 04             	or     $0x4,%edx
+  80257c:	a8 04                	test   $0x4,%al
+  80257e:	44 0f 45 f2          	cmovne %edx,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  802582:	44 89 f2             	mov    %r14d,%edx
+  802585:	83 ca 01             	or     $0x1,%edx
+  802588:	a8 01                	test   $0x1,%al
+  80258a:	44 0f 45 f2          	cmovne %edx,%r14d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  80258e:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802593:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  802599:	4d 8b 6c 24 20       	mov    0x20(%r12),%r13
+  80259e:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  8025a3:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  8025a8:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  8025ae:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  8025b4:	89 d9                	mov    %ebx,%ecx
+  8025b6:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8025bc:	74 14                	je     8025d2 <spawn+0x440>
+        va -= res;
+  8025be:	48 63 f1             	movslq %ecx,%rsi
+  8025c1:	48 29 f3             	sub    %rsi,%rbx
+        memsz += res;
+  8025c4:	48 01 f2             	add    %rsi,%rdx
+        filesz += res;
+  8025c7:	49 01 f5             	add    %rsi,%r13
+        fileoffset -= res;
+  8025ca:	29 c8                	sub    %ecx,%eax
+  8025cc:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    filesz = ROUNDUP(filesz, PAGE_SIZE);
+  8025d2:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8025d9:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    if (filesz < memsz) {
+  8025e0:	49 39 d5             	cmp    %rdx,%r13
+  8025e3:	0f 83 34 ff ff ff    	jae    80251d <spawn+0x38b>
+        int err = sys_alloc_region(child, (void *)va + filesz, memsz - filesz, PROT_RW);
+  8025e9:	4c 29 ea             	sub    %r13,%rdx
+  8025ec:	49 8d 74 1d 00       	lea    0x0(%r13,%rbx,1),%rsi
+  8025f1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8025f6:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  8025fc:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  802603:	00 00 00 
+  802606:	ff d0                	call   *%rax
+        if (err)
+  802608:	85 c0                	test   %eax,%eax
+  80260a:	0f 84 0d ff ff ff    	je     80251d <spawn+0x38b>
+  802610:	e9 2e ff ff ff       	jmp    802543 <spawn+0x3b1>
+        return err;
+
+    /* seek() fd to fileoffset  */
+    err = seek(fd, fileoffset);
+  802615:	8b b5 f0 fc ff ff    	mov    -0x310(%rbp),%esi
+  80261b:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802621:	48 b8 94 1c 80 00 00 	movabs $0x801c94,%rax
+  802628:	00 00 00 
+  80262b:	ff d0                	call   *%rax
+    if (err)
+  80262d:	85 c0                	test   %eax,%eax
+  80262f:	0f 85 0e ff ff ff    	jne    802543 <spawn+0x3b1>
+        return err;
+
+    /* read filesz to UTEMP */
+    ssize_t bytes_read = readn(fd, UTEMP, filesz);
+  802635:	4c 89 ea             	mov    %r13,%rdx
+  802638:	be 00 00 40 00       	mov    $0x400000,%esi
+  80263d:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802643:	48 b8 6a 1b 80 00 00 	movabs $0x801b6a,%rax
+  80264a:	00 00 00 
+  80264d:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  80264f:	48 85 c0             	test   %rax,%rax
+  802652:	0f 88 eb fe ff ff    	js     802543 <spawn+0x3b1>
+        return bytes_read;
+    assert(bytes_read == filesz);
+  802658:	4c 39 e8             	cmp    %r13,%rax
+  80265b:	75 4f                	jne    8026ac <spawn+0x51a>
+
+    /* Map read section conents to child */
+    err = sys_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+  80265d:	45 89 f1             	mov    %r14d,%r9d
+  802660:	41 80 c9 80          	or     $0x80,%r9b
+  802664:	4d 89 e8             	mov    %r13,%r8
+  802667:	48 89 d9             	mov    %rbx,%rcx
+  80266a:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  802670:	be 00 00 40 00       	mov    $0x400000,%esi
+  802675:	bf 00 00 00 00       	mov    $0x0,%edi
+  80267a:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  802681:	00 00 00 
+  802684:	ff d0                	call   *%rax
+    if (err)
+  802686:	85 c0                	test   %eax,%eax
+  802688:	0f 85 b5 fe ff ff    	jne    802543 <spawn+0x3b1>
+        return err;
+
+    /* Unmap it from parent */
+    err = sys_unmap_region(CURENVID, UTEMP, filesz);
+  80268e:	4c 89 ea             	mov    %r13,%rdx
+  802691:	be 00 00 40 00       	mov    $0x400000,%esi
+  802696:	bf 00 00 00 00       	mov    $0x0,%edi
+  80269b:	48 b8 65 12 80 00 00 	movabs $0x801265,%rax
+  8026a2:	00 00 00 
+  8026a5:	ff d0                	call   *%rax
+    if (err)
+  8026a7:	e9 97 fe ff ff       	jmp    802543 <spawn+0x3b1>
+    assert(bytes_read == filesz);
+  8026ac:	48 b9 1b 3b 80 00 00 	movabs $0x803b1b,%rcx
+  8026b3:	00 00 00 
+  8026b6:	48 ba fa 3a 80 00 00 	movabs $0x803afa,%rdx
+  8026bd:	00 00 00 
+  8026c0:	be 2f 01 00 00       	mov    $0x12f,%esi
+  8026c5:	48 bf 0f 3b 80 00 00 	movabs $0x803b0f,%rdi
+  8026cc:	00 00 00 
+  8026cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d4:	49 b8 74 01 80 00 00 	movabs $0x800174,%r8
+  8026db:	00 00 00 
+  8026de:	41 ff d0             	call   *%r8
+    close(fd);
+  8026e1:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  8026e7:	48 b8 2e 19 80 00 00 	movabs $0x80192e,%rax
+  8026ee:	00 00 00 
+  8026f1:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  8026f3:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  8026fa:	48 bf 42 21 80 00 00 	movabs $0x802142,%rdi
+  802701:	00 00 00 
+  802704:	48 b8 a3 2f 80 00 00 	movabs $0x802fa3,%rax
+  80270b:	00 00 00 
+  80270e:	ff d0                	call   *%rax
+  802710:	85 c0                	test   %eax,%eax
+  802712:	78 49                	js     80275d <spawn+0x5cb>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802714:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  80271b:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802721:	48 b8 05 14 80 00 00 	movabs $0x801405,%rax
+  802728:	00 00 00 
+  80272b:	ff d0                	call   *%rax
+  80272d:	85 c0                	test   %eax,%eax
+  80272f:	78 59                	js     80278a <spawn+0x5f8>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802731:	be 02 00 00 00       	mov    $0x2,%esi
+  802736:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  80273c:	48 b8 9c 13 80 00 00 	movabs $0x80139c,%rax
+  802743:	00 00 00 
+  802746:	ff d0                	call   *%rax
+  802748:	85 c0                	test   %eax,%eax
+  80274a:	78 6b                	js     8027b7 <spawn+0x625>
+    return child;
+  80274c:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  802752:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+  802758:	e9 bc 00 00 00       	jmp    802819 <spawn+0x687>
+        panic("copy_shared_region: %i", res);
+  80275d:	89 c1                	mov    %eax,%ecx
+  80275f:	48 ba 30 3b 80 00 00 	movabs $0x803b30,%rdx
+  802766:	00 00 00 
+  802769:	be 84 00 00 00       	mov    $0x84,%esi
+  80276e:	48 bf 0f 3b 80 00 00 	movabs $0x803b0f,%rdi
+  802775:	00 00 00 
+  802778:	b8 00 00 00 00       	mov    $0x0,%eax
+  80277d:	49 b8 74 01 80 00 00 	movabs $0x800174,%r8
+  802784:	00 00 00 
+  802787:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  80278a:	89 c1                	mov    %eax,%ecx
+  80278c:	48 ba 47 3b 80 00 00 	movabs $0x803b47,%rdx
+  802793:	00 00 00 
+  802796:	be 87 00 00 00       	mov    $0x87,%esi
+  80279b:	48 bf 0f 3b 80 00 00 	movabs $0x803b0f,%rdi
+  8027a2:	00 00 00 
+  8027a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027aa:	49 b8 74 01 80 00 00 	movabs $0x800174,%r8
+  8027b1:	00 00 00 
+  8027b4:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8027b7:	89 c1                	mov    %eax,%ecx
+  8027b9:	48 ba 61 3b 80 00 00 	movabs $0x803b61,%rdx
+  8027c0:	00 00 00 
+  8027c3:	be 8a 00 00 00       	mov    $0x8a,%esi
+  8027c8:	48 bf 0f 3b 80 00 00 	movabs $0x803b0f,%rdi
+  8027cf:	00 00 00 
+  8027d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d7:	49 b8 74 01 80 00 00 	movabs $0x800174,%r8
+  8027de:	00 00 00 
+  8027e1:	41 ff d0             	call   *%r8
+  8027e4:	89 c3                	mov    %eax,%ebx
+  8027e6:	eb 07                	jmp    8027ef <spawn+0x65d>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8027e8:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8027ed:	89 c3                	mov    %eax,%ebx
+    sys_env_destroy(child);
+  8027ef:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8027f5:	48 b8 6e 10 80 00 00 	movabs $0x80106e,%rax
+  8027fc:	00 00 00 
+  8027ff:	ff d0                	call   *%rax
+    close(fd);
+  802801:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802807:	48 b8 2e 19 80 00 00 	movabs $0x80192e,%rax
+  80280e:	00 00 00 
+  802811:	ff d0                	call   *%rax
+    return res;
+  802813:	89 9d fc fc ff ff    	mov    %ebx,-0x304(%rbp)
+}
+  802819:	8b 85 fc fc ff ff    	mov    -0x304(%rbp),%eax
+  80281f:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  802826:	5b                   	pop    %rbx
+  802827:	41 5c                	pop    %r12
+  802829:	41 5d                	pop    %r13
+  80282b:	41 5e                	pop    %r14
+  80282d:	41 5f                	pop    %r15
+  80282f:	5d                   	pop    %rbp
+  802830:	c3                   	ret
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  802831:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802836:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80283b:	be 00 00 40 00       	mov    $0x400000,%esi
+  802840:	bf 00 00 00 00       	mov    $0x0,%edi
+  802845:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  80284c:	00 00 00 
+  80284f:	ff d0                	call   *%rax
+  802851:	85 c0                	test   %eax,%eax
+  802853:	78 98                	js     8027ed <spawn+0x65b>
+    for (argc = 0; argv[argc] != 0; argc++)
+  802855:	48 c7 85 e0 fc ff ff 	movq   $0x0,-0x320(%rbp)
+  80285c:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  802860:	48 c7 85 e8 fc ff ff 	movq   $0x40fff8,-0x318(%rbp)
+  802867:	f8 ff 40 00 
+  80286b:	48 c7 85 f0 fc ff ff 	movq   $0x410000,-0x310(%rbp)
+  802872:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  802876:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  80287b:	e9 1c fb ff ff       	jmp    80239c <spawn+0x20a>
+
+0000000000802880 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  802880:	55                   	push   %rbp
+  802881:	48 89 e5             	mov    %rsp,%rbp
+  802884:	48 83 ec 50          	sub    $0x50,%rsp
+  802888:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80288c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802890:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802894:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  802898:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80289f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8028a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028a7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8028ab:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  8028af:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  8028b4:	eb 15                	jmp    8028cb <spawnl+0x4b>
+  8028b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8028ba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8028be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028c2:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8028c6:	74 1c                	je     8028e4 <spawnl+0x64>
+  8028c8:	83 c1 01             	add    $0x1,%ecx
+  8028cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8028d1:	77 e3                	ja     8028b6 <spawnl+0x36>
+  8028d3:	89 c2                	mov    %eax,%edx
+  8028d5:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  8028d9:	4c 01 d2             	add    %r10,%rdx
+  8028dc:	83 c0 08             	add    $0x8,%eax
+  8028df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8028e2:	eb de                	jmp    8028c2 <spawnl+0x42>
+    const char *argv[argc + 2];
+  8028e4:	8d 41 02             	lea    0x2(%rcx),%eax
+  8028e7:	48 98                	cltq
+  8028e9:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  8028f0:	00 
+  8028f1:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  8028f5:	48 29 c4             	sub    %rax,%rsp
+  8028f8:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  8028fd:	4c 89 c0             	mov    %r8,%rax
+  802900:	48 c1 e8 03          	shr    $0x3,%rax
+  802904:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  802908:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  80290f:	00 
+    argv[argc + 1] = NULL;
+  802910:	8d 41 01             	lea    0x1(%rcx),%eax
+  802913:	48 98                	cltq
+  802915:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  80291c:	00 
+    va_start(vl, arg0);
+  80291d:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802924:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802928:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80292c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802930:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  802934:	85 c9                	test   %ecx,%ecx
+  802936:	74 41                	je     802979 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802938:	49 89 c1             	mov    %rax,%r9
+  80293b:	49 8d 40 08          	lea    0x8(%r8),%rax
+  80293f:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  802942:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  802947:	eb 1b                	jmp    802964 <spawnl+0xe4>
+  802949:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80294d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  802951:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  802955:	48 8b 11             	mov    (%rcx),%rdx
+  802958:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  80295b:	48 83 c0 08          	add    $0x8,%rax
+  80295f:	48 39 f0             	cmp    %rsi,%rax
+  802962:	74 15                	je     802979 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802964:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802967:	83 fa 2f             	cmp    $0x2f,%edx
+  80296a:	77 dd                	ja     802949 <spawnl+0xc9>
+  80296c:	89 d1                	mov    %edx,%ecx
+  80296e:	4c 01 c9             	add    %r9,%rcx
+  802971:	83 c2 08             	add    $0x8,%edx
+  802974:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  802977:	eb dc                	jmp    802955 <spawnl+0xd5>
+    return spawn(prog, argv);
+  802979:	4c 89 c6             	mov    %r8,%rsi
+  80297c:	48 b8 92 21 80 00 00 	movabs $0x802192,%rax
+  802983:	00 00 00 
+  802986:	ff d0                	call   *%rax
+}
+  802988:	c9                   	leave
+  802989:	c3                   	ret
+
+000000000080298a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80298a:	55                   	push   %rbp
+  80298b:	48 89 e5             	mov    %rsp,%rbp
+  80298e:	41 54                	push   %r12
+  802990:	53                   	push   %rbx
+  802991:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802994:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  80299b:	00 00 00 
+  80299e:	ff d0                	call   *%rax
+  8029a0:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8029a3:	48 be 78 3b 80 00 00 	movabs $0x803b78,%rsi
+  8029aa:	00 00 00 
+  8029ad:	48 89 df             	mov    %rbx,%rdi
+  8029b0:	48 b8 e9 0b 80 00 00 	movabs $0x800be9,%rax
+  8029b7:	00 00 00 
+  8029ba:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8029bc:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8029c1:	41 2b 04 24          	sub    (%r12),%eax
+  8029c5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8029cb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8029d2:	00 00 00 
+    stat->st_dev = &devpipe;
+  8029d5:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8029dc:	00 00 00 
+  8029df:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8029e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029eb:	5b                   	pop    %rbx
+  8029ec:	41 5c                	pop    %r12
+  8029ee:	5d                   	pop    %rbp
+  8029ef:	c3                   	ret
+
+00000000008029f0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8029f0:	55                   	push   %rbp
+  8029f1:	48 89 e5             	mov    %rsp,%rbp
+  8029f4:	41 54                	push   %r12
+  8029f6:	53                   	push   %rbx
+  8029f7:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8029fa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029ff:	48 89 fe             	mov    %rdi,%rsi
+  802a02:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a07:	49 bc 65 12 80 00 00 	movabs $0x801265,%r12
+  802a0e:	00 00 00 
+  802a11:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802a14:	48 89 df             	mov    %rbx,%rdi
+  802a17:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  802a1e:	00 00 00 
+  802a21:	ff d0                	call   *%rax
+  802a23:	48 89 c6             	mov    %rax,%rsi
+  802a26:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a30:	41 ff d4             	call   *%r12
+}
+  802a33:	5b                   	pop    %rbx
+  802a34:	41 5c                	pop    %r12
+  802a36:	5d                   	pop    %rbp
+  802a37:	c3                   	ret
+
+0000000000802a38 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802a38:	55                   	push   %rbp
+  802a39:	48 89 e5             	mov    %rsp,%rbp
+  802a3c:	41 57                	push   %r15
+  802a3e:	41 56                	push   %r14
+  802a40:	41 55                	push   %r13
+  802a42:	41 54                	push   %r12
+  802a44:	53                   	push   %rbx
+  802a45:	48 83 ec 18          	sub    $0x18,%rsp
+  802a49:	49 89 fc             	mov    %rdi,%r12
+  802a4c:	49 89 f5             	mov    %rsi,%r13
+  802a4f:	49 89 d7             	mov    %rdx,%r15
+  802a52:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a56:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  802a5d:	00 00 00 
+  802a60:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802a62:	4d 85 ff             	test   %r15,%r15
+  802a65:	0f 84 af 00 00 00    	je     802b1a <devpipe_write+0xe2>
+  802a6b:	48 89 c3             	mov    %rax,%rbx
+  802a6e:	4c 89 f8             	mov    %r15,%rax
+  802a71:	4d 89 ef             	mov    %r13,%r15
+  802a74:	4c 01 e8             	add    %r13,%rax
+  802a77:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802a7b:	49 bd 6d 11 80 00 00 	movabs $0x80116d,%r13
+  802a82:	00 00 00 
+            sys_yield();
+  802a85:	49 be 0a 11 80 00 00 	movabs $0x80110a,%r14
+  802a8c:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802a8f:	8b 73 04             	mov    0x4(%rbx),%esi
+  802a92:	48 63 ce             	movslq %esi,%rcx
+  802a95:	48 63 03             	movslq (%rbx),%rax
+  802a98:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802a9e:	48 39 c1             	cmp    %rax,%rcx
+  802aa1:	72 2e                	jb     802ad1 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802aa3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802aa8:	48 89 da             	mov    %rbx,%rdx
+  802aab:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ab0:	4c 89 e7             	mov    %r12,%rdi
+  802ab3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802ab6:	85 c0                	test   %eax,%eax
+  802ab8:	74 66                	je     802b20 <devpipe_write+0xe8>
+            sys_yield();
+  802aba:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802abd:	8b 73 04             	mov    0x4(%rbx),%esi
+  802ac0:	48 63 ce             	movslq %esi,%rcx
+  802ac3:	48 63 03             	movslq (%rbx),%rax
+  802ac6:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802acc:	48 39 c1             	cmp    %rax,%rcx
+  802acf:	73 d2                	jae    802aa3 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802ad1:	41 0f b6 3f          	movzbl (%r15),%edi
+  802ad5:	48 89 ca             	mov    %rcx,%rdx
+  802ad8:	48 c1 ea 03          	shr    $0x3,%rdx
+  802adc:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802ae3:	08 10 20 
+  802ae6:	48 f7 e2             	mul    %rdx
+  802ae9:	48 c1 ea 06          	shr    $0x6,%rdx
+  802aed:	48 89 d0             	mov    %rdx,%rax
+  802af0:	48 c1 e0 09          	shl    $0x9,%rax
+  802af4:	48 29 d0             	sub    %rdx,%rax
+  802af7:	48 c1 e0 03          	shl    $0x3,%rax
+  802afb:	48 29 c1             	sub    %rax,%rcx
+  802afe:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802b03:	83 c6 01             	add    $0x1,%esi
+  802b06:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802b09:	49 83 c7 01          	add    $0x1,%r15
+  802b0d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b11:	49 39 c7             	cmp    %rax,%r15
+  802b14:	0f 85 75 ff ff ff    	jne    802a8f <devpipe_write+0x57>
+    return n;
+  802b1a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b1e:	eb 05                	jmp    802b25 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802b20:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b25:	48 83 c4 18          	add    $0x18,%rsp
+  802b29:	5b                   	pop    %rbx
+  802b2a:	41 5c                	pop    %r12
+  802b2c:	41 5d                	pop    %r13
+  802b2e:	41 5e                	pop    %r14
+  802b30:	41 5f                	pop    %r15
+  802b32:	5d                   	pop    %rbp
+  802b33:	c3                   	ret
+
+0000000000802b34 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802b34:	55                   	push   %rbp
+  802b35:	48 89 e5             	mov    %rsp,%rbp
+  802b38:	41 57                	push   %r15
+  802b3a:	41 56                	push   %r14
+  802b3c:	41 55                	push   %r13
+  802b3e:	41 54                	push   %r12
+  802b40:	53                   	push   %rbx
+  802b41:	48 83 ec 18          	sub    $0x18,%rsp
+  802b45:	49 89 fc             	mov    %rdi,%r12
+  802b48:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802b4c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802b50:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  802b57:	00 00 00 
+  802b5a:	ff d0                	call   *%rax
+  802b5c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802b5f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802b65:	49 bd 6d 11 80 00 00 	movabs $0x80116d,%r13
+  802b6c:	00 00 00 
+            sys_yield();
+  802b6f:	49 be 0a 11 80 00 00 	movabs $0x80110a,%r14
+  802b76:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802b79:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802b7e:	74 7d                	je     802bfd <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802b80:	8b 03                	mov    (%rbx),%eax
+  802b82:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802b85:	75 26                	jne    802bad <devpipe_read+0x79>
+            if (i > 0) return i;
+  802b87:	4d 85 ff             	test   %r15,%r15
+  802b8a:	75 77                	jne    802c03 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802b8c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b91:	48 89 da             	mov    %rbx,%rdx
+  802b94:	be 00 10 00 00       	mov    $0x1000,%esi
+  802b99:	4c 89 e7             	mov    %r12,%rdi
+  802b9c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802b9f:	85 c0                	test   %eax,%eax
+  802ba1:	74 72                	je     802c15 <devpipe_read+0xe1>
+            sys_yield();
+  802ba3:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802ba6:	8b 03                	mov    (%rbx),%eax
+  802ba8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802bab:	74 df                	je     802b8c <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802bad:	48 63 c8             	movslq %eax,%rcx
+  802bb0:	48 89 ca             	mov    %rcx,%rdx
+  802bb3:	48 c1 ea 03          	shr    $0x3,%rdx
+  802bb7:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802bbe:	08 10 20 
+  802bc1:	48 89 d0             	mov    %rdx,%rax
+  802bc4:	48 f7 e6             	mul    %rsi
+  802bc7:	48 c1 ea 06          	shr    $0x6,%rdx
+  802bcb:	48 89 d0             	mov    %rdx,%rax
+  802bce:	48 c1 e0 09          	shl    $0x9,%rax
+  802bd2:	48 29 d0             	sub    %rdx,%rax
+  802bd5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802bdc:	00 
+  802bdd:	48 89 c8             	mov    %rcx,%rax
+  802be0:	48 29 d0             	sub    %rdx,%rax
+  802be3:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802be8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802bec:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802bf0:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802bf3:	49 83 c7 01          	add    $0x1,%r15
+  802bf7:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802bfb:	75 83                	jne    802b80 <devpipe_read+0x4c>
+    return n;
+  802bfd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c01:	eb 03                	jmp    802c06 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802c03:	4c 89 f8             	mov    %r15,%rax
+}
+  802c06:	48 83 c4 18          	add    $0x18,%rsp
+  802c0a:	5b                   	pop    %rbx
+  802c0b:	41 5c                	pop    %r12
+  802c0d:	41 5d                	pop    %r13
+  802c0f:	41 5e                	pop    %r14
+  802c11:	41 5f                	pop    %r15
+  802c13:	5d                   	pop    %rbp
+  802c14:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1a:	eb ea                	jmp    802c06 <devpipe_read+0xd2>
+
+0000000000802c1c <pipe>:
+pipe(int pfd[2]) {
+  802c1c:	55                   	push   %rbp
+  802c1d:	48 89 e5             	mov    %rsp,%rbp
+  802c20:	41 55                	push   %r13
+  802c22:	41 54                	push   %r12
+  802c24:	53                   	push   %rbx
+  802c25:	48 83 ec 18          	sub    $0x18,%rsp
+  802c29:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802c2c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802c30:	48 b8 69 17 80 00 00 	movabs $0x801769,%rax
+  802c37:	00 00 00 
+  802c3a:	ff d0                	call   *%rax
+  802c3c:	89 c3                	mov    %eax,%ebx
+  802c3e:	85 c0                	test   %eax,%eax
+  802c40:	0f 88 a0 01 00 00    	js     802de6 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802c46:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802c4b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c50:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802c54:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c59:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  802c60:	00 00 00 
+  802c63:	ff d0                	call   *%rax
+  802c65:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802c67:	85 c0                	test   %eax,%eax
+  802c69:	0f 88 77 01 00 00    	js     802de6 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802c6f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802c73:	48 b8 69 17 80 00 00 	movabs $0x801769,%rax
+  802c7a:	00 00 00 
+  802c7d:	ff d0                	call   *%rax
+  802c7f:	89 c3                	mov    %eax,%ebx
+  802c81:	85 c0                	test   %eax,%eax
+  802c83:	0f 88 43 01 00 00    	js     802dcc <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802c89:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802c8e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c93:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802c97:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c9c:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  802ca3:	00 00 00 
+  802ca6:	ff d0                	call   *%rax
+  802ca8:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802caa:	85 c0                	test   %eax,%eax
+  802cac:	0f 88 1a 01 00 00    	js     802dcc <pipe+0x1b0>
+    va = fd2data(fd0);
+  802cb2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802cb6:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  802cbd:	00 00 00 
+  802cc0:	ff d0                	call   *%rax
+  802cc2:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802cc5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802cca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ccf:	48 89 c6             	mov    %rax,%rsi
+  802cd2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd7:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  802cde:	00 00 00 
+  802ce1:	ff d0                	call   *%rax
+  802ce3:	89 c3                	mov    %eax,%ebx
+  802ce5:	85 c0                	test   %eax,%eax
+  802ce7:	0f 88 c5 00 00 00    	js     802db2 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802ced:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802cf1:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  802cf8:	00 00 00 
+  802cfb:	ff d0                	call   *%rax
+  802cfd:	48 89 c1             	mov    %rax,%rcx
+  802d00:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802d06:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802d0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d11:	4c 89 ee             	mov    %r13,%rsi
+  802d14:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d19:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  802d20:	00 00 00 
+  802d23:	ff d0                	call   *%rax
+  802d25:	89 c3                	mov    %eax,%ebx
+  802d27:	85 c0                	test   %eax,%eax
+  802d29:	78 6e                	js     802d99 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802d2b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d30:	4c 89 ef             	mov    %r13,%rdi
+  802d33:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  802d3a:	00 00 00 
+  802d3d:	ff d0                	call   *%rax
+  802d3f:	83 f8 02             	cmp    $0x2,%eax
+  802d42:	0f 85 ab 00 00 00    	jne    802df3 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802d48:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802d4f:	00 00 
+  802d51:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802d55:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802d57:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802d5b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802d62:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802d66:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802d68:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d6c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802d73:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d77:	48 bb 3b 17 80 00 00 	movabs $0x80173b,%rbx
+  802d7e:	00 00 00 
+  802d81:	ff d3                	call   *%rbx
+  802d83:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802d87:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802d8b:	ff d3                	call   *%rbx
+  802d8d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802d92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d97:	eb 4d                	jmp    802de6 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802d99:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d9e:	4c 89 ee             	mov    %r13,%rsi
+  802da1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802da6:	48 b8 65 12 80 00 00 	movabs $0x801265,%rax
+  802dad:	00 00 00 
+  802db0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802db2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802db7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802dbb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dc0:	48 b8 65 12 80 00 00 	movabs $0x801265,%rax
+  802dc7:	00 00 00 
+  802dca:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802dcc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802dd1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802dd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dda:	48 b8 65 12 80 00 00 	movabs $0x801265,%rax
+  802de1:	00 00 00 
+  802de4:	ff d0                	call   *%rax
+}
+  802de6:	89 d8                	mov    %ebx,%eax
+  802de8:	48 83 c4 18          	add    $0x18,%rsp
+  802dec:	5b                   	pop    %rbx
+  802ded:	41 5c                	pop    %r12
+  802def:	41 5d                	pop    %r13
+  802df1:	5d                   	pop    %rbp
+  802df2:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802df3:	48 b9 90 3b 80 00 00 	movabs $0x803b90,%rcx
+  802dfa:	00 00 00 
+  802dfd:	48 ba fa 3a 80 00 00 	movabs $0x803afa,%rdx
+  802e04:	00 00 00 
+  802e07:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802e0c:	48 bf 7f 3b 80 00 00 	movabs $0x803b7f,%rdi
+  802e13:	00 00 00 
+  802e16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e1b:	49 b8 74 01 80 00 00 	movabs $0x800174,%r8
+  802e22:	00 00 00 
+  802e25:	41 ff d0             	call   *%r8
+
+0000000000802e28 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802e28:	55                   	push   %rbp
+  802e29:	48 89 e5             	mov    %rsp,%rbp
+  802e2c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802e30:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e34:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  802e3b:	00 00 00 
+  802e3e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e40:	85 c0                	test   %eax,%eax
+  802e42:	78 35                	js     802e79 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802e44:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802e48:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  802e4f:	00 00 00 
+  802e52:	ff d0                	call   *%rax
+  802e54:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802e57:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802e5c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e61:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802e65:	48 b8 6d 11 80 00 00 	movabs $0x80116d,%rax
+  802e6c:	00 00 00 
+  802e6f:	ff d0                	call   *%rax
+  802e71:	85 c0                	test   %eax,%eax
+  802e73:	0f 94 c0             	sete   %al
+  802e76:	0f b6 c0             	movzbl %al,%eax
+}
+  802e79:	c9                   	leave
+  802e7a:	c3                   	ret
+
+0000000000802e7b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802e7b:	48 89 f8             	mov    %rdi,%rax
+  802e7e:	48 c1 e8 27          	shr    $0x27,%rax
+  802e82:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802e89:	01 00 00 
+  802e8c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802e90:	f6 c2 01             	test   $0x1,%dl
+  802e93:	74 6d                	je     802f02 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802e95:	48 89 f8             	mov    %rdi,%rax
+  802e98:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802e9c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802ea3:	01 00 00 
+  802ea6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802eaa:	f6 c2 01             	test   $0x1,%dl
+  802ead:	74 62                	je     802f11 <get_uvpt_entry+0x96>
+  802eaf:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802eb6:	01 00 00 
+  802eb9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ebd:	f6 c2 80             	test   $0x80,%dl
+  802ec0:	75 4f                	jne    802f11 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802ec2:	48 89 f8             	mov    %rdi,%rax
+  802ec5:	48 c1 e8 15          	shr    $0x15,%rax
+  802ec9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802ed0:	01 00 00 
+  802ed3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ed7:	f6 c2 01             	test   $0x1,%dl
+  802eda:	74 44                	je     802f20 <get_uvpt_entry+0xa5>
+  802edc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802ee3:	01 00 00 
+  802ee6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802eea:	f6 c2 80             	test   $0x80,%dl
+  802eed:	75 31                	jne    802f20 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802eef:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802ef3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802efa:	01 00 00 
+  802efd:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802f01:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802f02:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802f09:	01 00 00 
+  802f0c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802f10:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802f11:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802f18:	01 00 00 
+  802f1b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802f1f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802f20:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802f27:	01 00 00 
+  802f2a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802f2e:	c3                   	ret
+
+0000000000802f2f <get_prot>:
+
+int
+get_prot(void *va) {
+  802f2f:	55                   	push   %rbp
+  802f30:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802f33:	48 b8 7b 2e 80 00 00 	movabs $0x802e7b,%rax
+  802f3a:	00 00 00 
+  802f3d:	ff d0                	call   *%rax
+  802f3f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802f42:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802f47:	89 c1                	mov    %eax,%ecx
+  802f49:	83 c9 04             	or     $0x4,%ecx
+  802f4c:	f6 c2 01             	test   $0x1,%dl
+  802f4f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802f52:	89 c1                	mov    %eax,%ecx
+  802f54:	83 c9 02             	or     $0x2,%ecx
+  802f57:	f6 c2 02             	test   $0x2,%dl
+  802f5a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802f5d:	89 c1                	mov    %eax,%ecx
+  802f5f:	83 c9 01             	or     $0x1,%ecx
+  802f62:	48 85 d2             	test   %rdx,%rdx
+  802f65:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802f68:	89 c1                	mov    %eax,%ecx
+  802f6a:	83 c9 40             	or     $0x40,%ecx
+  802f6d:	f6 c6 04             	test   $0x4,%dh
+  802f70:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802f73:	5d                   	pop    %rbp
+  802f74:	c3                   	ret
+
+0000000000802f75 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802f75:	55                   	push   %rbp
+  802f76:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802f79:	48 b8 7b 2e 80 00 00 	movabs $0x802e7b,%rax
+  802f80:	00 00 00 
+  802f83:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802f85:	48 c1 e8 06          	shr    $0x6,%rax
+  802f89:	83 e0 01             	and    $0x1,%eax
+}
+  802f8c:	5d                   	pop    %rbp
+  802f8d:	c3                   	ret
+
+0000000000802f8e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802f8e:	55                   	push   %rbp
+  802f8f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802f92:	48 b8 7b 2e 80 00 00 	movabs $0x802e7b,%rax
+  802f99:	00 00 00 
+  802f9c:	ff d0                	call   *%rax
+  802f9e:	83 e0 01             	and    $0x1,%eax
+}
+  802fa1:	5d                   	pop    %rbp
+  802fa2:	c3                   	ret
+
+0000000000802fa3 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802fa3:	55                   	push   %rbp
+  802fa4:	48 89 e5             	mov    %rsp,%rbp
+  802fa7:	41 57                	push   %r15
+  802fa9:	41 56                	push   %r14
+  802fab:	41 55                	push   %r13
+  802fad:	41 54                	push   %r12
+  802faf:	53                   	push   %rbx
+  802fb0:	48 83 ec 18          	sub    $0x18,%rsp
+  802fb4:	49 89 ff             	mov    %rdi,%r15
+  802fb7:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802fbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802fc0:	49 bc 8e 2f 80 00 00 	movabs $0x802f8e,%r12
+  802fc7:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802fca:	49 be 2f 2f 80 00 00 	movabs $0x802f2f,%r14
+  802fd1:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802fd4:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802fdb:	00 00 00 
+  802fde:	eb 0c                	jmp    802fec <foreach_shared_region+0x49>
+  802fe0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802fe7:	4c 39 eb             	cmp    %r13,%rbx
+  802fea:	74 38                	je     803024 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802fec:	48 89 df             	mov    %rbx,%rdi
+  802fef:	41 ff d4             	call   *%r12
+  802ff2:	84 c0                	test   %al,%al
+  802ff4:	74 ea                	je     802fe0 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802ff6:	48 89 df             	mov    %rbx,%rdi
+  802ff9:	41 ff d6             	call   *%r14
+  802ffc:	a8 40                	test   $0x40,%al
+  802ffe:	74 e0                	je     802fe0 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  803000:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803007:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80300b:	48 89 df             	mov    %rbx,%rdi
+  80300e:	41 ff d7             	call   *%r15
+        if (err)
+  803011:	85 c0                	test   %eax,%eax
+  803013:	74 cb                	je     802fe0 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  803015:	48 83 c4 18          	add    $0x18,%rsp
+  803019:	5b                   	pop    %rbx
+  80301a:	41 5c                	pop    %r12
+  80301c:	41 5d                	pop    %r13
+  80301e:	41 5e                	pop    %r14
+  803020:	41 5f                	pop    %r15
+  803022:	5d                   	pop    %rbp
+  803023:	c3                   	ret
+    return 0;
+  803024:	b8 00 00 00 00       	mov    $0x0,%eax
+  803029:	eb ea                	jmp    803015 <foreach_shared_region+0x72>
+
+000000000080302b <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80302b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803030:	c3                   	ret
+
+0000000000803031 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803031:	55                   	push   %rbp
+  803032:	48 89 e5             	mov    %rsp,%rbp
+  803035:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803038:	48 be b4 3b 80 00 00 	movabs $0x803bb4,%rsi
+  80303f:	00 00 00 
+  803042:	48 b8 e9 0b 80 00 00 	movabs $0x800be9,%rax
+  803049:	00 00 00 
+  80304c:	ff d0                	call   *%rax
+    return 0;
+}
+  80304e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803053:	5d                   	pop    %rbp
+  803054:	c3                   	ret
+
+0000000000803055 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803055:	55                   	push   %rbp
+  803056:	48 89 e5             	mov    %rsp,%rbp
+  803059:	41 57                	push   %r15
+  80305b:	41 56                	push   %r14
+  80305d:	41 55                	push   %r13
+  80305f:	41 54                	push   %r12
+  803061:	53                   	push   %rbx
+  803062:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803069:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803070:	48 85 d2             	test   %rdx,%rdx
+  803073:	74 7a                	je     8030ef <devcons_write+0x9a>
+  803075:	49 89 d6             	mov    %rdx,%r14
+  803078:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80307e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803083:	49 bf e3 0d 80 00 00 	movabs $0x800de3,%r15
+  80308a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80308d:	4c 89 f3             	mov    %r14,%rbx
+  803090:	48 29 f3             	sub    %rsi,%rbx
+  803093:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803098:	48 39 c3             	cmp    %rax,%rbx
+  80309b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80309f:	4c 63 eb             	movslq %ebx,%r13
+  8030a2:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8030a9:	48 01 c6             	add    %rax,%rsi
+  8030ac:	4c 89 ea             	mov    %r13,%rdx
+  8030af:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8030b6:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8030b9:	4c 89 ee             	mov    %r13,%rsi
+  8030bc:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8030c3:	48 b8 10 10 80 00 00 	movabs $0x801010,%rax
+  8030ca:	00 00 00 
+  8030cd:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8030cf:	41 01 dc             	add    %ebx,%r12d
+  8030d2:	49 63 f4             	movslq %r12d,%rsi
+  8030d5:	4c 39 f6             	cmp    %r14,%rsi
+  8030d8:	72 b3                	jb     80308d <devcons_write+0x38>
+    return res;
+  8030da:	49 63 c4             	movslq %r12d,%rax
+}
+  8030dd:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8030e4:	5b                   	pop    %rbx
+  8030e5:	41 5c                	pop    %r12
+  8030e7:	41 5d                	pop    %r13
+  8030e9:	41 5e                	pop    %r14
+  8030eb:	41 5f                	pop    %r15
+  8030ed:	5d                   	pop    %rbp
+  8030ee:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8030ef:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8030f5:	eb e3                	jmp    8030da <devcons_write+0x85>
+
+00000000008030f7 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8030f7:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8030fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030ff:	48 85 c0             	test   %rax,%rax
+  803102:	74 55                	je     803159 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803104:	55                   	push   %rbp
+  803105:	48 89 e5             	mov    %rsp,%rbp
+  803108:	41 55                	push   %r13
+  80310a:	41 54                	push   %r12
+  80310c:	53                   	push   %rbx
+  80310d:	48 83 ec 08          	sub    $0x8,%rsp
+  803111:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803114:	48 bb 3d 10 80 00 00 	movabs $0x80103d,%rbx
+  80311b:	00 00 00 
+  80311e:	49 bc 0a 11 80 00 00 	movabs $0x80110a,%r12
+  803125:	00 00 00 
+  803128:	eb 03                	jmp    80312d <devcons_read+0x36>
+  80312a:	41 ff d4             	call   *%r12
+  80312d:	ff d3                	call   *%rbx
+  80312f:	85 c0                	test   %eax,%eax
+  803131:	74 f7                	je     80312a <devcons_read+0x33>
+    if (c < 0) return c;
+  803133:	48 63 d0             	movslq %eax,%rdx
+  803136:	78 13                	js     80314b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803138:	ba 00 00 00 00       	mov    $0x0,%edx
+  80313d:	83 f8 04             	cmp    $0x4,%eax
+  803140:	74 09                	je     80314b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803142:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803146:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80314b:	48 89 d0             	mov    %rdx,%rax
+  80314e:	48 83 c4 08          	add    $0x8,%rsp
+  803152:	5b                   	pop    %rbx
+  803153:	41 5c                	pop    %r12
+  803155:	41 5d                	pop    %r13
+  803157:	5d                   	pop    %rbp
+  803158:	c3                   	ret
+  803159:	48 89 d0             	mov    %rdx,%rax
+  80315c:	c3                   	ret
+
+000000000080315d <cputchar>:
+cputchar(int ch) {
+  80315d:	55                   	push   %rbp
+  80315e:	48 89 e5             	mov    %rsp,%rbp
+  803161:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803165:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803169:	be 01 00 00 00       	mov    $0x1,%esi
+  80316e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803172:	48 b8 10 10 80 00 00 	movabs $0x801010,%rax
+  803179:	00 00 00 
+  80317c:	ff d0                	call   *%rax
+}
+  80317e:	c9                   	leave
+  80317f:	c3                   	ret
+
+0000000000803180 <getchar>:
+getchar(void) {
+  803180:	55                   	push   %rbp
+  803181:	48 89 e5             	mov    %rsp,%rbp
+  803184:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803188:	ba 01 00 00 00       	mov    $0x1,%edx
+  80318d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803191:	bf 00 00 00 00       	mov    $0x0,%edi
+  803196:	48 b8 ac 1a 80 00 00 	movabs $0x801aac,%rax
+  80319d:	00 00 00 
+  8031a0:	ff d0                	call   *%rax
+  8031a2:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8031a4:	85 c0                	test   %eax,%eax
+  8031a6:	78 06                	js     8031ae <getchar+0x2e>
+  8031a8:	74 08                	je     8031b2 <getchar+0x32>
+  8031aa:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8031ae:	89 d0                	mov    %edx,%eax
+  8031b0:	c9                   	leave
+  8031b1:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8031b2:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8031b7:	eb f5                	jmp    8031ae <getchar+0x2e>
+
+00000000008031b9 <iscons>:
+iscons(int fdnum) {
+  8031b9:	55                   	push   %rbp
+  8031ba:	48 89 e5             	mov    %rsp,%rbp
+  8031bd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8031c1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8031c5:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  8031cc:	00 00 00 
+  8031cf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031d1:	85 c0                	test   %eax,%eax
+  8031d3:	78 18                	js     8031ed <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8031d5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8031d9:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  8031e0:	00 00 00 
+  8031e3:	8b 00                	mov    (%rax),%eax
+  8031e5:	39 02                	cmp    %eax,(%rdx)
+  8031e7:	0f 94 c0             	sete   %al
+  8031ea:	0f b6 c0             	movzbl %al,%eax
+}
+  8031ed:	c9                   	leave
+  8031ee:	c3                   	ret
+
+00000000008031ef <opencons>:
+opencons(void) {
+  8031ef:	55                   	push   %rbp
+  8031f0:	48 89 e5             	mov    %rsp,%rbp
+  8031f3:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8031f7:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8031fb:	48 b8 69 17 80 00 00 	movabs $0x801769,%rax
+  803202:	00 00 00 
+  803205:	ff d0                	call   *%rax
+  803207:	85 c0                	test   %eax,%eax
+  803209:	78 49                	js     803254 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80320b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803210:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803215:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803219:	bf 00 00 00 00       	mov    $0x0,%edi
+  80321e:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  803225:	00 00 00 
+  803228:	ff d0                	call   *%rax
+  80322a:	85 c0                	test   %eax,%eax
+  80322c:	78 26                	js     803254 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80322e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803232:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  803239:	00 00 
+  80323b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80323d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803241:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803248:	48 b8 3b 17 80 00 00 	movabs $0x80173b,%rax
+  80324f:	00 00 00 
+  803252:	ff d0                	call   *%rax
+}
+  803254:	c9                   	leave
+  803255:	c3                   	ret
+
+0000000000803256 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803256:	55                   	push   %rbp
+  803257:	48 89 e5             	mov    %rsp,%rbp
+  80325a:	41 54                	push   %r12
+  80325c:	53                   	push   %rbx
+  80325d:	48 89 fb             	mov    %rdi,%rbx
+  803260:	48 89 f7             	mov    %rsi,%rdi
+  803263:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  803266:	48 85 f6             	test   %rsi,%rsi
+  803269:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803270:	00 00 00 
+  803273:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  803277:	be 00 10 00 00       	mov    $0x1000,%esi
+  80327c:	48 b8 03 15 80 00 00 	movabs $0x801503,%rax
+  803283:	00 00 00 
+  803286:	ff d0                	call   *%rax
+    if (res < 0) {
+  803288:	85 c0                	test   %eax,%eax
+  80328a:	78 45                	js     8032d1 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  80328c:	48 85 db             	test   %rbx,%rbx
+  80328f:	74 12                	je     8032a3 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  803291:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803298:	00 00 00 
+  80329b:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8032a1:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  8032a3:	4d 85 e4             	test   %r12,%r12
+  8032a6:	74 14                	je     8032bc <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  8032a8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8032af:	00 00 00 
+  8032b2:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8032b8:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  8032bc:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8032c3:	00 00 00 
+  8032c6:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  8032cc:	5b                   	pop    %rbx
+  8032cd:	41 5c                	pop    %r12
+  8032cf:	5d                   	pop    %rbp
+  8032d0:	c3                   	ret
+        if (from_env_store)
+  8032d1:	48 85 db             	test   %rbx,%rbx
+  8032d4:	74 06                	je     8032dc <ipc_recv+0x86>
+            *from_env_store = 0;
+  8032d6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  8032dc:	4d 85 e4             	test   %r12,%r12
+  8032df:	74 eb                	je     8032cc <ipc_recv+0x76>
+            *perm_store = 0;
+  8032e1:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8032e8:	00 
+  8032e9:	eb e1                	jmp    8032cc <ipc_recv+0x76>
+
+00000000008032eb <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8032eb:	55                   	push   %rbp
+  8032ec:	48 89 e5             	mov    %rsp,%rbp
+  8032ef:	41 57                	push   %r15
+  8032f1:	41 56                	push   %r14
+  8032f3:	41 55                	push   %r13
+  8032f5:	41 54                	push   %r12
+  8032f7:	53                   	push   %rbx
+  8032f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8032fc:	41 89 fd             	mov    %edi,%r13d
+  8032ff:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803302:	48 89 d3             	mov    %rdx,%rbx
+  803305:	49 89 cc             	mov    %rcx,%r12
+  803308:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  80330c:	48 85 d2             	test   %rdx,%rdx
+  80330f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803316:	00 00 00 
+  803319:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80331d:	49 be d7 14 80 00 00 	movabs $0x8014d7,%r14
+  803324:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  803327:	49 bf 0a 11 80 00 00 	movabs $0x80110a,%r15
+  80332e:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803331:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803334:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  803338:	4c 89 e1             	mov    %r12,%rcx
+  80333b:	48 89 da             	mov    %rbx,%rdx
+  80333e:	44 89 ef             	mov    %r13d,%edi
+  803341:	41 ff d6             	call   *%r14
+        if (res == 0)
+  803344:	85 c0                	test   %eax,%eax
+  803346:	74 34                	je     80337c <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  803348:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80334b:	75 05                	jne    803352 <ipc_send+0x67>
+        sys_yield();
+  80334d:	41 ff d7             	call   *%r15
+    while (true) {
+  803350:	eb df                	jmp    803331 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  803352:	48 ba c0 3b 80 00 00 	movabs $0x803bc0,%rdx
+  803359:	00 00 00 
+  80335c:	be 3e 00 00 00       	mov    $0x3e,%esi
+  803361:	48 bf d9 3b 80 00 00 	movabs $0x803bd9,%rdi
+  803368:	00 00 00 
+  80336b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803370:	48 b9 74 01 80 00 00 	movabs $0x800174,%rcx
+  803377:	00 00 00 
+  80337a:	ff d1                	call   *%rcx
+    }
+}
+  80337c:	48 83 c4 18          	add    $0x18,%rsp
+  803380:	5b                   	pop    %rbx
+  803381:	41 5c                	pop    %r12
+  803383:	41 5d                	pop    %r13
+  803385:	41 5e                	pop    %r14
+  803387:	41 5f                	pop    %r15
+  803389:	5d                   	pop    %rbp
+  80338a:	c3                   	ret
+
+000000000080338b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80338b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803390:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803397:	00 00 00 
+  80339a:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  8033a1:	48 01 ca             	add    %rcx,%rdx
+  8033a4:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8033aa:	39 fa                	cmp    %edi,%edx
+  8033ac:	74 12                	je     8033c0 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8033ae:	48 83 c0 01          	add    $0x1,%rax
+  8033b2:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8033b8:	75 e0                	jne    80339a <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8033ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033bf:	c3                   	ret
+            return envs[i].env_id;
+  8033c0:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8033c7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8033ce:	00 00 00 
+  8033d1:	48 01 d0             	add    %rdx,%rax
+  8033d4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8033da:	c3                   	ret
+  8033db:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000008033e0 <__rodata_start>:
+  8033e0:	69 20 61 6d 20 70    	imul   $0x70206d61,(%rax),%esp
+  8033e6:	61                   	(bad)
+  8033e7:	72 65                	jb     80344e <__rodata_start+0x6e>
+  8033e9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033ea:	74 20                	je     80340c <__rodata_start+0x2c>
+  8033ec:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8033ee:	76 69                	jbe    803459 <__rodata_start+0x79>
+  8033f0:	72 6f                	jb     803461 <__rodata_start+0x81>
+  8033f2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033f3:	6d                   	insl   (%dx),%es:(%rdi)
+  8033f4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8033f6:	74 20                	je     803418 <__rodata_start+0x38>
+  8033f8:	25 30 38 78 0a       	and    $0xa783830,%eax
+  8033fd:	00 68 65             	add    %ch,0x65(%rax)
+  803400:	6c                   	insb   (%dx),%es:(%rdi)
+  803401:	6c                   	insb   (%dx),%es:(%rdi)
+  803402:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803403:	00 73 70             	add    %dh,0x70(%rbx)
+  803406:	61                   	(bad)
+  803407:	77 6e                	ja     803477 <__rodata_start+0x97>
+  803409:	28 68 65             	sub    %ch,0x65(%rax)
+  80340c:	6c                   	insb   (%dx),%es:(%rdi)
+  80340d:	6c                   	insb   (%dx),%es:(%rdi)
+  80340e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80340f:	29 20                	sub    %esp,(%rax)
+  803411:	66 61                	data16 (bad)
+  803413:	69 6c 65 64 3a 20 25 	imul   $0x6925203a,0x64(%rbp,%riz,2),%ebp
+  80341a:	69 
+  80341b:	00 75 73             	add    %dh,0x73(%rbp)
+  80341e:	65 72 2f             	gs jb  803450 <__rodata_start+0x70>
+  803421:	73 70                	jae    803493 <__rodata_start+0xb3>
+  803423:	61                   	(bad)
+  803424:	77 6e                	ja     803494 <__rodata_start+0xb4>
+  803426:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  80342b:	2e 63 00             	cs movsxd (%rax),%eax
+  80342e:	3c 75                	cmp    $0x75,%al
+  803430:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803431:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803435:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803436:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  80343a:	30 38                	xor    %bh,(%rax)
+  80343c:	78 5d                	js     80349b <__rodata_start+0xbb>
+  80343e:	20 75 73             	and    %dh,0x73(%rbp)
+  803441:	65 72 20             	gs jb  803464 <__rodata_start+0x84>
+  803444:	70 61                	jo     8034a7 <__rodata_start+0xc7>
+  803446:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803447:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80344e:	73 20                	jae    803470 <__rodata_start+0x90>
+  803450:	61                   	(bad)
+  803451:	74 20                	je     803473 <__rodata_start+0x93>
+  803453:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803458:	3a 20                	cmp    (%rax),%ah
+  80345a:	00 30                	add    %dh,(%rax)
+  80345c:	31 32                	xor    %esi,(%rdx)
+  80345e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803465:	41                   	rex.B
+  803466:	42                   	rex.X
+  803467:	43                   	rex.XB
+  803468:	44                   	rex.R
+  803469:	45                   	rex.RB
+  80346a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80346d:	31 32                	xor    %esi,(%rdx)
+  80346f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803476:	61                   	(bad)
+  803477:	62 63 64 65 66       	(bad)
+  80347c:	00 28                	add    %ch,(%rax)
+  80347e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80347f:	75 6c                	jne    8034ed <__rodata_start+0x10d>
+  803481:	6c                   	insb   (%dx),%es:(%rdi)
+  803482:	29 00                	sub    %eax,(%rax)
+  803484:	65 72 72             	gs jb  8034f9 <__rodata_start+0x119>
+  803487:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803488:	72 20                	jb     8034aa <__rodata_start+0xca>
+  80348a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80348f:	73 70                	jae    803501 <__rodata_start+0x121>
+  803491:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803495:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80349c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80349d:	72 00                	jb     80349f <__rodata_start+0xbf>
+  80349f:	62 61 64 20 65       	(bad)
+  8034a4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8034a5:	76 69                	jbe    803510 <__rodata_start+0x130>
+  8034a7:	72 6f                	jb     803518 <__rodata_start+0x138>
+  8034a9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8034aa:	6d                   	insl   (%dx),%es:(%rdi)
+  8034ab:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8034ad:	74 00                	je     8034af <__rodata_start+0xcf>
+  8034af:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8034b6:	20 70 61             	and    %dh,0x61(%rax)
+  8034b9:	72 61                	jb     80351c <__rodata_start+0x13c>
+  8034bb:	6d                   	insl   (%dx),%es:(%rdi)
+  8034bc:	65 74 65             	gs je  803524 <__rodata_start+0x144>
+  8034bf:	72 00                	jb     8034c1 <__rodata_start+0xe1>
+  8034c1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8034c2:	75 74                	jne    803538 <__rodata_start+0x158>
+  8034c4:	20 6f 66             	and    %ch,0x66(%rdi)
+  8034c7:	20 6d 65             	and    %ch,0x65(%rbp)
+  8034ca:	6d                   	insl   (%dx),%es:(%rdi)
+  8034cb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8034cc:	72 79                	jb     803547 <__rodata_start+0x167>
+  8034ce:	00 6f 75             	add    %ch,0x75(%rdi)
+  8034d1:	74 20                	je     8034f3 <__rodata_start+0x113>
+  8034d3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8034d4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8034d8:	76 69                	jbe    803543 <__rodata_start+0x163>
+  8034da:	72 6f                	jb     80354b <__rodata_start+0x16b>
+  8034dc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8034dd:	6d                   	insl   (%dx),%es:(%rdi)
+  8034de:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8034e0:	74 73                	je     803555 <__rodata_start+0x175>
+  8034e2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8034e5:	72 72                	jb     803559 <__rodata_start+0x179>
+  8034e7:	75 70                	jne    803559 <__rodata_start+0x179>
+  8034e9:	74 65                	je     803550 <__rodata_start+0x170>
+  8034eb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8034f0:	75 67                	jne    803559 <__rodata_start+0x179>
+  8034f2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8034f5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8034f7:	00 73 65             	add    %dh,0x65(%rbx)
+  8034fa:	67 6d                	insl   (%dx),%es:(%edi)
+  8034fc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8034fe:	74 61                	je     803561 <__rodata_start+0x181>
+  803500:	74 69                	je     80356b <__rodata_start+0x18b>
+  803502:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803503:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803504:	20 66 61             	and    %ah,0x61(%rsi)
+  803507:	75 6c                	jne    803575 <__rodata_start+0x195>
+  803509:	74 00                	je     80350b <__rodata_start+0x12b>
+  80350b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803512:	20 45 4c             	and    %al,0x4c(%rbp)
+  803515:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803519:	61                   	(bad)
+  80351a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80351f:	20 73 75             	and    %dh,0x75(%rbx)
+  803522:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803525:	73 79                	jae    8035a0 <__rodata_start+0x1c0>
+  803527:	73 74                	jae    80359d <__rodata_start+0x1bd>
+  803529:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80352b:	20 63 61             	and    %ah,0x61(%rbx)
+  80352e:	6c                   	insb   (%dx),%es:(%rdi)
+  80352f:	6c                   	insb   (%dx),%es:(%rdi)
+  803530:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803533:	74 72                	je     8035a7 <__rodata_start+0x1c7>
+  803535:	79 20                	jns    803557 <__rodata_start+0x177>
+  803537:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803538:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803539:	74 20                	je     80355b <__rodata_start+0x17b>
+  80353b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80353d:	75 6e                	jne    8035ad <__rodata_start+0x1cd>
+  80353f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803543:	76 20                	jbe    803565 <__rodata_start+0x185>
+  803545:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80354c:	72 65                	jb     8035b3 <__rodata_start+0x1d3>
+  80354e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803551:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803552:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803556:	65 78 70             	gs js  8035c9 <__rodata_start+0x1e9>
+  803559:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80355e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803561:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803565:	20 66 69             	and    %ah,0x69(%rsi)
+  803568:	6c                   	insb   (%dx),%es:(%rdi)
+  803569:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80356d:	20 66 72             	and    %ah,0x72(%rsi)
+  803570:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803575:	61                   	(bad)
+  803576:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803579:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80357a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80357b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80357f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803582:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803583:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803584:	20 6d 61             	and    %ch,0x61(%rbp)
+  803587:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803588:	79 20                	jns    8035aa <__rodata_start+0x1ca>
+  80358a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803591:	72 65                	jb     8035f8 <__rodata_start+0x218>
+  803593:	20 6f 70             	and    %ch,0x70(%rdi)
+  803596:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803598:	00 66 69             	add    %ah,0x69(%rsi)
+  80359b:	6c                   	insb   (%dx),%es:(%rdi)
+  80359c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8035a0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8035a3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035a4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8035a7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035a8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035a9:	74 20                	je     8035cb <__rodata_start+0x1eb>
+  8035ab:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8035ad:	75 6e                	jne    80361d <__rodata_start+0x23d>
+  8035af:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8035b3:	76 61                	jbe    803616 <__rodata_start+0x236>
+  8035b5:	6c                   	insb   (%dx),%es:(%rdi)
+  8035b6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8035bd:	00 
+  8035be:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8035c5:	72 65                	jb     80362c <__rodata_start+0x24c>
+  8035c7:	61                   	(bad)
+  8035c8:	64 79 20             	fs jns 8035eb <__rodata_start+0x20b>
+  8035cb:	65 78 69             	gs js  803637 <__rodata_start+0x257>
+  8035ce:	73 74                	jae    803644 <__rodata_start+0x264>
+  8035d0:	73 00                	jae    8035d2 <__rodata_start+0x1f2>
+  8035d2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035d3:	70 65                	jo     80363a <__rodata_start+0x25a>
+  8035d5:	72 61                	jb     803638 <__rodata_start+0x258>
+  8035d7:	74 69                	je     803642 <__rodata_start+0x262>
+  8035d9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035da:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035db:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8035de:	74 20                	je     803600 <__rodata_start+0x220>
+  8035e0:	73 75                	jae    803657 <__rodata_start+0x277>
+  8035e2:	70 70                	jo     803654 <__rodata_start+0x274>
+  8035e4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035e5:	72 74                	jb     80365b <__rodata_start+0x27b>
+  8035e7:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8035ec:	65 72 61             	gs jb  803650 <__rodata_start+0x270>
+  8035ef:	74 69                	je     80365a <__rodata_start+0x27a>
+  8035f1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035f2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035f3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8035f6:	74 20                	je     803618 <__rodata_start+0x238>
+  8035f8:	70 65                	jo     80365f <__rodata_start+0x27f>
+  8035fa:	72 6d                	jb     803669 <__rodata_start+0x289>
+  8035fc:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  803603:	2e 
+  803604:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80360b:	00 
+  80360c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803613:	00 00 00 
+  803616:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80361d:	00 00 00 
+  803620:	b1 04                	mov    $0x4,%cl
+  803622:	80 00 00             	addb   $0x0,(%rax)
+  803625:	00 00                	add    %al,(%rax)
+  803627:	00 f2                	add    %dh,%dl
+  803629:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80362f:	00 e2                	add    %ah,%dl
+  803631:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803637:	00 f2                	add    %dh,%dl
+  803639:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80363f:	00 f2                	add    %dh,%dl
+  803641:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803647:	00 f2                	add    %dh,%dl
+  803649:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80364f:	00 f2                	add    %dh,%dl
+  803651:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803657:	00 d0                	add    %dl,%al
+  803659:	04 80                	add    $0x80,%al
+  80365b:	00 00                	add    %al,(%rax)
+  80365d:	00 00                	add    %al,(%rax)
+  80365f:	00 f2                	add    %dh,%dl
+  803661:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803667:	00 f2                	add    %dh,%dl
+  803669:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80366f:	00 c4                	add    %al,%ah
+  803671:	04 80                	add    $0x80,%al
+  803673:	00 00                	add    %al,(%rax)
+  803675:	00 00                	add    %al,(%rax)
+  803677:	00 3e                	add    %bh,(%rsi)
+  803679:	05 80 00 00 00       	add    $0x80,%eax
+  80367e:	00 00                	add    %al,(%rax)
+  803680:	f2 0a 80 00 00 00 00 	repnz or 0x0(%rax),%al
+  803687:	00 c4                	add    %al,%ah
+  803689:	04 80                	add    $0x80,%al
+  80368b:	00 00                	add    %al,(%rax)
+  80368d:	00 00                	add    %al,(%rax)
+  80368f:	00 0a                	add    %cl,(%rdx)
+  803691:	05 80 00 00 00       	add    $0x80,%eax
+  803696:	00 00                	add    %al,(%rax)
+  803698:	0a 05 80 00 00 00    	or     0x80(%rip),%al        # 80371e <__rodata_start+0x33e>
+  80369e:	00 00                	add    %al,(%rax)
+  8036a0:	0a 05 80 00 00 00    	or     0x80(%rip),%al        # 803726 <__rodata_start+0x346>
+  8036a6:	00 00                	add    %al,(%rax)
+  8036a8:	0a 05 80 00 00 00    	or     0x80(%rip),%al        # 80372e <__rodata_start+0x34e>
+  8036ae:	00 00                	add    %al,(%rax)
+  8036b0:	0a 05 80 00 00 00    	or     0x80(%rip),%al        # 803736 <__rodata_start+0x356>
+  8036b6:	00 00                	add    %al,(%rax)
+  8036b8:	0a 05 80 00 00 00    	or     0x80(%rip),%al        # 80373e <__rodata_start+0x35e>
+  8036be:	00 00                	add    %al,(%rax)
+  8036c0:	0a 05 80 00 00 00    	or     0x80(%rip),%al        # 803746 <__rodata_start+0x366>
+  8036c6:	00 00                	add    %al,(%rax)
+  8036c8:	0a 05 80 00 00 00    	or     0x80(%rip),%al        # 80374e <__rodata_start+0x36e>
+  8036ce:	00 00                	add    %al,(%rax)
+  8036d0:	0a 05 80 00 00 00    	or     0x80(%rip),%al        # 803756 <__rodata_start+0x376>
+  8036d6:	00 00                	add    %al,(%rax)
+  8036d8:	f2 0a 80 00 00 00 00 	repnz or 0x0(%rax),%al
+  8036df:	00 f2                	add    %dh,%dl
+  8036e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8036e7:	00 f2                	add    %dh,%dl
+  8036e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8036ef:	00 f2                	add    %dh,%dl
+  8036f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8036f7:	00 f2                	add    %dh,%dl
+  8036f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8036ff:	00 f2                	add    %dh,%dl
+  803701:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803707:	00 f2                	add    %dh,%dl
+  803709:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80370f:	00 f2                	add    %dh,%dl
+  803711:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803717:	00 f2                	add    %dh,%dl
+  803719:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80371f:	00 f2                	add    %dh,%dl
+  803721:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803727:	00 f2                	add    %dh,%dl
+  803729:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80372f:	00 f2                	add    %dh,%dl
+  803731:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803737:	00 f2                	add    %dh,%dl
+  803739:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80373f:	00 f2                	add    %dh,%dl
+  803741:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803747:	00 f2                	add    %dh,%dl
+  803749:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80374f:	00 f2                	add    %dh,%dl
+  803751:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803757:	00 f2                	add    %dh,%dl
+  803759:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80375f:	00 f2                	add    %dh,%dl
+  803761:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803767:	00 f2                	add    %dh,%dl
+  803769:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80376f:	00 f2                	add    %dh,%dl
+  803771:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803777:	00 f2                	add    %dh,%dl
+  803779:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80377f:	00 f2                	add    %dh,%dl
+  803781:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803787:	00 f2                	add    %dh,%dl
+  803789:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80378f:	00 f2                	add    %dh,%dl
+  803791:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803797:	00 f2                	add    %dh,%dl
+  803799:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80379f:	00 f2                	add    %dh,%dl
+  8037a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8037a7:	00 f2                	add    %dh,%dl
+  8037a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8037af:	00 f2                	add    %dh,%dl
+  8037b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8037b7:	00 f2                	add    %dh,%dl
+  8037b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8037bf:	00 f2                	add    %dh,%dl
+  8037c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8037c7:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80b7d7 <__bss_end+0x37d7>
+  8037cd:	00 00                	add    %al,(%rax)
+  8037cf:	00 f2                	add    %dh,%dl
+  8037d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8037d7:	00 f2                	add    %dh,%dl
+  8037d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8037df:	00 f2                	add    %dh,%dl
+  8037e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8037e7:	00 f2                	add    %dh,%dl
+  8037e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8037ef:	00 f2                	add    %dh,%dl
+  8037f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8037f7:	00 f2                	add    %dh,%dl
+  8037f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8037ff:	00 f2                	add    %dh,%dl
+  803801:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803807:	00 f2                	add    %dh,%dl
+  803809:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80380f:	00 f2                	add    %dh,%dl
+  803811:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803817:	00 f2                	add    %dh,%dl
+  803819:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80381f:	00 61 05             	add    %ah,0x5(%rcx)
+  803822:	80 00 00             	addb   $0x0,(%rax)
+  803825:	00 00                	add    %al,(%rax)
+  803827:	00 30                	add    %dh,(%rax)
+  803829:	07                   	(bad)
+  80382a:	80 00 00             	addb   $0x0,(%rax)
+  80382d:	00 00                	add    %al,(%rax)
+  80382f:	00 f2                	add    %dh,%dl
+  803831:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803837:	00 f2                	add    %dh,%dl
+  803839:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80383f:	00 f2                	add    %dh,%dl
+  803841:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803847:	00 f2                	add    %dh,%dl
+  803849:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80384f:	00 90 05 80 00 00    	add    %dl,0x8005(%rax)
+  803855:	00 00                	add    %al,(%rax)
+  803857:	00 f2                	add    %dh,%dl
+  803859:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80385f:	00 f2                	add    %dh,%dl
+  803861:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803867:	00 56 05             	add    %dl,0x5(%rsi)
+  80386a:	80 00 00             	addb   $0x0,(%rax)
+  80386d:	00 00                	add    %al,(%rax)
+  80386f:	00 f2                	add    %dh,%dl
+  803871:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803877:	00 f2                	add    %dh,%dl
+  803879:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80387f:	00 d8                	add    %bl,%al
+  803881:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803887:	00 a2 09 80 00 00    	add    %ah,0x8009(%rdx)
+  80388d:	00 00                	add    %al,(%rax)
+  80388f:	00 f2                	add    %dh,%dl
+  803891:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803897:	00 f2                	add    %dh,%dl
+  803899:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80389f:	00 27                	add    %ah,(%rdi)
+  8038a1:	06                   	(bad)
+  8038a2:	80 00 00             	addb   $0x0,(%rax)
+  8038a5:	00 00                	add    %al,(%rax)
+  8038a7:	00 f2                	add    %dh,%dl
+  8038a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8038af:	00 04 08             	add    %al,(%rax,%rcx,1)
+  8038b2:	80 00 00             	addb   $0x0,(%rax)
+  8038b5:	00 00                	add    %al,(%rax)
+  8038b7:	00 f2                	add    %dh,%dl
+  8038b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8038bf:	00 f2                	add    %dh,%dl
+  8038c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8038c7:	00 15 0a 80 00 00    	add    %dl,0x800a(%rip)        # 80b8d7 <__bss_end+0x38d7>
+  8038cd:	00 00                	add    %al,(%rax)
+  8038cf:	00 f2                	add    %dh,%dl
+  8038d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8038d7:	00 ba 04 80 00 00    	add    %bh,0x8004(%rdx)
+  8038dd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008038e0 <error_string>:
+	...
+  8038e8:	8d 34 80 00 00 00 00 00 9f 34 80 00 00 00 00 00     .4.......4......
+  8038f8:	af 34 80 00 00 00 00 00 c1 34 80 00 00 00 00 00     .4.......4......
+  803908:	cf 34 80 00 00 00 00 00 e3 34 80 00 00 00 00 00     .4.......4......
+  803918:	f8 34 80 00 00 00 00 00 0b 35 80 00 00 00 00 00     .4.......5......
+  803928:	1d 35 80 00 00 00 00 00 31 35 80 00 00 00 00 00     .5......15......
+  803938:	41 35 80 00 00 00 00 00 54 35 80 00 00 00 00 00     A5......T5......
+  803948:	6b 35 80 00 00 00 00 00 81 35 80 00 00 00 00 00     k5.......5......
+  803958:	99 35 80 00 00 00 00 00 b1 35 80 00 00 00 00 00     .5.......5......
+  803968:	be 35 80 00 00 00 00 00 90 39 80 00 00 00 00 00     .5.......9......
+  803978:	d2 35 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .5..............
+  803988:	ea 35 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .5......file is 
+  803998:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8039a8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8039b8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8039c8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8039d8:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  8039e8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8039f8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803a08:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803a18:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803a28:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803a38:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803a48:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803a58:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803a60 <devtab>:
+  803a60:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803a70:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803a80:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  803a90:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  803aa0:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  803ab0:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  803ac0:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  803ad0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  803ae0:	45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20 77     Elf magic %08x w
+  803af0:	61 6e 74 20 25 30 38 78 0a 00 61 73 73 65 72 74     ant %08x..assert
+  803b00:	69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00 6c     ion failed: %s.l
+  803b10:	69 62 2f 73 70 61 77 6e 2e 63 00 62 79 74 65 73     ib/spawn.c.bytes
+  803b20:	5f 72 65 61 64 20 3d 3d 20 66 69 6c 65 73 7a 00     _read == filesz.
+  803b30:	63 6f 70 79 5f 73 68 61 72 65 64 5f 72 65 67 69     copy_shared_regi
+  803b40:	6f 6e 3a 20 25 69 00 73 79 73 5f 65 6e 76 5f 73     on: %i.sys_env_s
+  803b50:	65 74 5f 74 72 61 70 66 72 61 6d 65 3a 20 25 69     et_trapframe: %i
+  803b60:	00 73 79 73 5f 65 6e 76 5f 73 65 74 5f 73 74 61     .sys_env_set_sta
+  803b70:	74 75 73 3a 20 25 69 00 3c 70 69 70 65 3e 00 6c     tus: %i.<pipe>.l
+  803b80:	69 62 2f 70 69 70 65 2e 63 00 70 69 70 65 00 90     ib/pipe.c.pipe..
+  803b90:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803ba0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803bb0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803bc0:	69 70 63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64     ipc_send: failed
+  803bd0:	20 74 6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63      to send.lib/ipc
+  803be0:	2e 63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     .c.f.........f..
+  803bf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ca0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ce0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803da0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
@@ -0,0 +1,5836 @@
+
+obj/user/spin:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c2 00 00 00       	call   8000e5 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * Let it run for a couple time slices, then kill it. */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+    envid_t env;
+
+    cprintf("I am the parent.  Forking the child...\n");
+  800032:	48 bf d0 2c 80 00 00 	movabs $0x802cd0,%rdi
+  800039:	00 00 00 
+  80003c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800041:	48 ba 5c 02 80 00 00 	movabs $0x80025c,%rdx
+  800048:	00 00 00 
+  80004b:	ff d2                	call   *%rdx
+    if ((env = fork()) == 0) {
+  80004d:	48 b8 d3 16 80 00 00 	movabs $0x8016d3,%rax
+  800054:	00 00 00 
+  800057:	ff d0                	call   *%rax
+  800059:	85 c0                	test   %eax,%eax
+  80005b:	75 1d                	jne    80007a <umain+0x55>
+        cprintf("I am the child.  Spinning...\n");
+  80005d:	48 bf 48 2d 80 00 00 	movabs $0x802d48,%rdi
+  800064:	00 00 00 
+  800067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006c:	48 ba 5c 02 80 00 00 	movabs $0x80025c,%rdx
+  800073:	00 00 00 
+  800076:	ff d2                	call   *%rdx
+        while (1) /* do nothing */
+  800078:	eb fe                	jmp    800078 <umain+0x53>
+  80007a:	89 c3                	mov    %eax,%ebx
+            ;
+    }
+
+    cprintf("I am the parent.  Running the child...\n");
+  80007c:	48 bf f8 2c 80 00 00 	movabs $0x802cf8,%rdi
+  800083:	00 00 00 
+  800086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008b:	49 bd 5c 02 80 00 00 	movabs $0x80025c,%r13
+  800092:	00 00 00 
+  800095:	41 ff d5             	call   *%r13
+    sys_yield();
+  800098:	49 bc a2 10 80 00 00 	movabs $0x8010a2,%r12
+  80009f:	00 00 00 
+  8000a2:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000a5:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000a8:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000ab:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000ae:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b1:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b4:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b7:	41 ff d4             	call   *%r12
+
+    cprintf("I am the parent.  Killing the child...\n");
+  8000ba:	48 bf 20 2d 80 00 00 	movabs $0x802d20,%rdi
+  8000c1:	00 00 00 
+  8000c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c9:	41 ff d5             	call   *%r13
+    sys_env_destroy(env);
+  8000cc:	89 df                	mov    %ebx,%edi
+  8000ce:	48 b8 06 10 80 00 00 	movabs $0x801006,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+}
+  8000da:	48 83 c4 08          	add    $0x8,%rsp
+  8000de:	5b                   	pop    %rbx
+  8000df:	41 5c                	pop    %r12
+  8000e1:	41 5d                	pop    %r13
+  8000e3:	5d                   	pop    %rbp
+  8000e4:	c3                   	ret
+
+00000000008000e5 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000e5:	55                   	push   %rbp
+  8000e6:	48 89 e5             	mov    %rsp,%rbp
+  8000e9:	41 56                	push   %r14
+  8000eb:	41 55                	push   %r13
+  8000ed:	41 54                	push   %r12
+  8000ef:	53                   	push   %rbx
+  8000f0:	41 89 fd             	mov    %edi,%r13d
+  8000f3:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000f6:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8000fd:	00 00 00 
+  800100:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800107:	00 00 00 
+  80010a:	48 39 c2             	cmp    %rax,%rdx
+  80010d:	73 17                	jae    800126 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80010f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800112:	49 89 c4             	mov    %rax,%r12
+  800115:	48 83 c3 08          	add    $0x8,%rbx
+  800119:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011e:	ff 53 f8             	call   *-0x8(%rbx)
+  800121:	4c 39 e3             	cmp    %r12,%rbx
+  800124:	72 ef                	jb     800115 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800126:	48 b8 71 10 80 00 00 	movabs $0x801071,%rax
+  80012d:	00 00 00 
+  800130:	ff d0                	call   *%rax
+  800132:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800135:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80013c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800143:	00 00 00 
+  800146:	48 01 d0             	add    %rdx,%rax
+  800149:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800150:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800153:	45 85 ed             	test   %r13d,%r13d
+  800156:	7e 0d                	jle    800165 <libmain+0x80>
+  800158:	49 8b 06             	mov    (%r14),%rax
+  80015b:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800162:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800165:	4c 89 f6             	mov    %r14,%rsi
+  800168:	44 89 ef             	mov    %r13d,%edi
+  80016b:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800172:	00 00 00 
+  800175:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800177:	48 b8 8c 01 80 00 00 	movabs $0x80018c,%rax
+  80017e:	00 00 00 
+  800181:	ff d0                	call   *%rax
+#endif
+}
+  800183:	5b                   	pop    %rbx
+  800184:	41 5c                	pop    %r12
+  800186:	41 5d                	pop    %r13
+  800188:	41 5e                	pop    %r14
+  80018a:	5d                   	pop    %rbp
+  80018b:	c3                   	ret
+
+000000000080018c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80018c:	55                   	push   %rbp
+  80018d:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800190:	48 b8 f9 19 80 00 00 	movabs $0x8019f9,%rax
+  800197:	00 00 00 
+  80019a:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80019c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001a1:	48 b8 06 10 80 00 00 	movabs $0x801006,%rax
+  8001a8:	00 00 00 
+  8001ab:	ff d0                	call   *%rax
+}
+  8001ad:	5d                   	pop    %rbp
+  8001ae:	c3                   	ret
+
+00000000008001af <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001af:	55                   	push   %rbp
+  8001b0:	48 89 e5             	mov    %rsp,%rbp
+  8001b3:	53                   	push   %rbx
+  8001b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8001b8:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001bb:	8b 06                	mov    (%rsi),%eax
+  8001bd:	8d 50 01             	lea    0x1(%rax),%edx
+  8001c0:	89 16                	mov    %edx,(%rsi)
+  8001c2:	48 98                	cltq
+  8001c4:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001c9:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001cf:	74 0a                	je     8001db <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001d1:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001d9:	c9                   	leave
+  8001da:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001db:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001df:	be ff 00 00 00       	mov    $0xff,%esi
+  8001e4:	48 b8 a8 0f 80 00 00 	movabs $0x800fa8,%rax
+  8001eb:	00 00 00 
+  8001ee:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001f0:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001f6:	eb d9                	jmp    8001d1 <putch+0x22>
+
+00000000008001f8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001f8:	55                   	push   %rbp
+  8001f9:	48 89 e5             	mov    %rsp,%rbp
+  8001fc:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800203:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800206:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80020d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800212:	b8 00 00 00 00       	mov    $0x0,%eax
+  800217:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80021a:	48 89 f1             	mov    %rsi,%rcx
+  80021d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800224:	48 bf af 01 80 00 00 	movabs $0x8001af,%rdi
+  80022b:	00 00 00 
+  80022e:	48 b8 ac 03 80 00 00 	movabs $0x8003ac,%rax
+  800235:	00 00 00 
+  800238:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80023a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800241:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800248:	48 b8 a8 0f 80 00 00 	movabs $0x800fa8,%rax
+  80024f:	00 00 00 
+  800252:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800254:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80025a:	c9                   	leave
+  80025b:	c3                   	ret
+
+000000000080025c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80025c:	55                   	push   %rbp
+  80025d:	48 89 e5             	mov    %rsp,%rbp
+  800260:	48 83 ec 50          	sub    $0x50,%rsp
+  800264:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800268:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80026c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800270:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800274:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800278:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80027f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800283:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800287:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80028b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80028f:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800293:	48 b8 f8 01 80 00 00 	movabs $0x8001f8,%rax
+  80029a:	00 00 00 
+  80029d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80029f:	c9                   	leave
+  8002a0:	c3                   	ret
+
+00000000008002a1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002a1:	55                   	push   %rbp
+  8002a2:	48 89 e5             	mov    %rsp,%rbp
+  8002a5:	41 57                	push   %r15
+  8002a7:	41 56                	push   %r14
+  8002a9:	41 55                	push   %r13
+  8002ab:	41 54                	push   %r12
+  8002ad:	53                   	push   %rbx
+  8002ae:	48 83 ec 18          	sub    $0x18,%rsp
+  8002b2:	49 89 fc             	mov    %rdi,%r12
+  8002b5:	49 89 f5             	mov    %rsi,%r13
+  8002b8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002bc:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002bf:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002c2:	41 89 cf             	mov    %ecx,%r15d
+  8002c5:	4c 39 fa             	cmp    %r15,%rdx
+  8002c8:	73 5b                	jae    800325 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002ca:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002ce:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002d2:	85 db                	test   %ebx,%ebx
+  8002d4:	7e 0e                	jle    8002e4 <print_num+0x43>
+            putch(padc, put_arg);
+  8002d6:	4c 89 ee             	mov    %r13,%rsi
+  8002d9:	44 89 f7             	mov    %r14d,%edi
+  8002dc:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002df:	83 eb 01             	sub    $0x1,%ebx
+  8002e2:	75 f2                	jne    8002d6 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002e4:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8002e8:	48 b9 81 2d 80 00 00 	movabs $0x802d81,%rcx
+  8002ef:	00 00 00 
+  8002f2:	48 b8 70 2d 80 00 00 	movabs $0x802d70,%rax
+  8002f9:	00 00 00 
+  8002fc:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800300:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800304:	ba 00 00 00 00       	mov    $0x0,%edx
+  800309:	49 f7 f7             	div    %r15
+  80030c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800310:	4c 89 ee             	mov    %r13,%rsi
+  800313:	41 ff d4             	call   *%r12
+}
+  800316:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80031a:	5b                   	pop    %rbx
+  80031b:	41 5c                	pop    %r12
+  80031d:	41 5d                	pop    %r13
+  80031f:	41 5e                	pop    %r14
+  800321:	41 5f                	pop    %r15
+  800323:	5d                   	pop    %rbp
+  800324:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800325:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800329:	ba 00 00 00 00       	mov    $0x0,%edx
+  80032e:	49 f7 f7             	div    %r15
+  800331:	48 83 ec 08          	sub    $0x8,%rsp
+  800335:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800339:	52                   	push   %rdx
+  80033a:	45 0f be c9          	movsbl %r9b,%r9d
+  80033e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800342:	48 89 c2             	mov    %rax,%rdx
+  800345:	48 b8 a1 02 80 00 00 	movabs $0x8002a1,%rax
+  80034c:	00 00 00 
+  80034f:	ff d0                	call   *%rax
+  800351:	48 83 c4 10          	add    $0x10,%rsp
+  800355:	eb 8d                	jmp    8002e4 <print_num+0x43>
+
+0000000000800357 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800357:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80035b:	48 8b 06             	mov    (%rsi),%rax
+  80035e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800362:	73 0a                	jae    80036e <sprintputch+0x17>
+        *state->start++ = ch;
+  800364:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800368:	48 89 16             	mov    %rdx,(%rsi)
+  80036b:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80036e:	c3                   	ret
+
+000000000080036f <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80036f:	55                   	push   %rbp
+  800370:	48 89 e5             	mov    %rsp,%rbp
+  800373:	48 83 ec 50          	sub    $0x50,%rsp
+  800377:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80037b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80037f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800383:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80038a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80038e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800392:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800396:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80039a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80039e:	48 b8 ac 03 80 00 00 	movabs $0x8003ac,%rax
+  8003a5:	00 00 00 
+  8003a8:	ff d0                	call   *%rax
+}
+  8003aa:	c9                   	leave
+  8003ab:	c3                   	ret
+
+00000000008003ac <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003ac:	55                   	push   %rbp
+  8003ad:	48 89 e5             	mov    %rsp,%rbp
+  8003b0:	41 57                	push   %r15
+  8003b2:	41 56                	push   %r14
+  8003b4:	41 55                	push   %r13
+  8003b6:	41 54                	push   %r12
+  8003b8:	53                   	push   %rbx
+  8003b9:	48 83 ec 38          	sub    $0x38,%rsp
+  8003bd:	49 89 fe             	mov    %rdi,%r14
+  8003c0:	49 89 f5             	mov    %rsi,%r13
+  8003c3:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003c6:	48 8b 01             	mov    (%rcx),%rax
+  8003c9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003cd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003d5:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003d9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003dd:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003e1:	0f b6 3b             	movzbl (%rbx),%edi
+  8003e4:	40 80 ff 25          	cmp    $0x25,%dil
+  8003e8:	74 18                	je     800402 <vprintfmt+0x56>
+            if (!ch) return;
+  8003ea:	40 84 ff             	test   %dil,%dil
+  8003ed:	0f 84 b1 06 00 00    	je     800aa4 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003f3:	40 0f b6 ff          	movzbl %dil,%edi
+  8003f7:	4c 89 ee             	mov    %r13,%rsi
+  8003fa:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8003fd:	4c 89 e3             	mov    %r12,%rbx
+  800400:	eb db                	jmp    8003dd <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800402:	be 00 00 00 00       	mov    $0x0,%esi
+  800407:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80040b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800410:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800416:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80041d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800421:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800426:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80042b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80042e:	83 e8 23             	sub    $0x23,%eax
+  800431:	3c 57                	cmp    $0x57,%al
+  800433:	0f 87 51 06 00 00    	ja     800a8a <vprintfmt+0x6de>
+  800439:	0f b6 c0             	movzbl %al,%eax
+  80043c:	48 b9 20 2f 80 00 00 	movabs $0x802f20,%rcx
+  800443:	00 00 00 
+  800446:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800449:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80044c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800450:	eb cf                	jmp    800421 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800452:	49 89 dc             	mov    %rbx,%r12
+  800455:	be 01 00 00 00       	mov    $0x1,%esi
+  80045a:	eb c5                	jmp    800421 <vprintfmt+0x75>
+            padc = ch;
+  80045c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800460:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800463:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800466:	eb b9                	jmp    800421 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800468:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80046b:	83 f8 2f             	cmp    $0x2f,%eax
+  80046e:	77 24                	ja     800494 <vprintfmt+0xe8>
+  800470:	89 c1                	mov    %eax,%ecx
+  800472:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800476:	83 c0 08             	add    $0x8,%eax
+  800479:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80047c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80047f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800482:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800486:	79 99                	jns    800421 <vprintfmt+0x75>
+                width = precision;
+  800488:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80048c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800492:	eb 8d                	jmp    800421 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800494:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800498:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80049c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a0:	eb da                	jmp    80047c <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004a2:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004a7:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004ab:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004b1:	3c 39                	cmp    $0x39,%al
+  8004b3:	77 1c                	ja     8004d1 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004b5:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004b9:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004bd:	0f b6 c0             	movzbl %al,%eax
+  8004c0:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004c5:	0f b6 03             	movzbl (%rbx),%eax
+  8004c8:	3c 39                	cmp    $0x39,%al
+  8004ca:	76 e9                	jbe    8004b5 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004cc:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004cf:	eb b1                	jmp    800482 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004d1:	49 89 dc             	mov    %rbx,%r12
+  8004d4:	eb ac                	jmp    800482 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004d6:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004d9:	85 c9                	test   %ecx,%ecx
+  8004db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e0:	0f 49 c1             	cmovns %ecx,%eax
+  8004e3:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004e6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004e9:	e9 33 ff ff ff       	jmp    800421 <vprintfmt+0x75>
+            lflag++;
+  8004ee:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004f1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004f4:	e9 28 ff ff ff       	jmp    800421 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8004ff:	77 19                	ja     80051a <vprintfmt+0x16e>
+  800501:	89 c2                	mov    %eax,%edx
+  800503:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800507:	83 c0 08             	add    $0x8,%eax
+  80050a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80050d:	8b 3a                	mov    (%rdx),%edi
+  80050f:	4c 89 ee             	mov    %r13,%rsi
+  800512:	41 ff d6             	call   *%r14
+            break;
+  800515:	e9 c3 fe ff ff       	jmp    8003dd <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80051a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80051e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800522:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800526:	eb e5                	jmp    80050d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800528:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80052b:	83 f8 2f             	cmp    $0x2f,%eax
+  80052e:	77 5a                	ja     80058a <vprintfmt+0x1de>
+  800530:	89 c2                	mov    %eax,%edx
+  800532:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800536:	83 c0 08             	add    $0x8,%eax
+  800539:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80053c:	8b 02                	mov    (%rdx),%eax
+  80053e:	89 c1                	mov    %eax,%ecx
+  800540:	f7 d9                	neg    %ecx
+  800542:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800545:	83 f9 15             	cmp    $0x15,%ecx
+  800548:	7f 4e                	jg     800598 <vprintfmt+0x1ec>
+  80054a:	48 63 c1             	movslq %ecx,%rax
+  80054d:	48 ba e0 31 80 00 00 	movabs $0x8031e0,%rdx
+  800554:	00 00 00 
+  800557:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80055b:	48 85 c0             	test   %rax,%rax
+  80055e:	74 38                	je     800598 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800560:	48 89 c1             	mov    %rax,%rcx
+  800563:	48 ba d9 33 80 00 00 	movabs $0x8033d9,%rdx
+  80056a:	00 00 00 
+  80056d:	4c 89 ee             	mov    %r13,%rsi
+  800570:	4c 89 f7             	mov    %r14,%rdi
+  800573:	b8 00 00 00 00       	mov    $0x0,%eax
+  800578:	49 b8 6f 03 80 00 00 	movabs $0x80036f,%r8
+  80057f:	00 00 00 
+  800582:	41 ff d0             	call   *%r8
+  800585:	e9 53 fe ff ff       	jmp    8003dd <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80058a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80058e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800592:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800596:	eb a4                	jmp    80053c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800598:	48 ba 99 2d 80 00 00 	movabs $0x802d99,%rdx
+  80059f:	00 00 00 
+  8005a2:	4c 89 ee             	mov    %r13,%rsi
+  8005a5:	4c 89 f7             	mov    %r14,%rdi
+  8005a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ad:	49 b8 6f 03 80 00 00 	movabs $0x80036f,%r8
+  8005b4:	00 00 00 
+  8005b7:	41 ff d0             	call   *%r8
+  8005ba:	e9 1e fe ff ff       	jmp    8003dd <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8005c5:	77 6c                	ja     800633 <vprintfmt+0x287>
+  8005c7:	89 c2                	mov    %eax,%edx
+  8005c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005cd:	83 c0 08             	add    $0x8,%eax
+  8005d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005d3:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005d6:	48 85 d2             	test   %rdx,%rdx
+  8005d9:	48 b8 92 2d 80 00 00 	movabs $0x802d92,%rax
+  8005e0:	00 00 00 
+  8005e3:	48 0f 45 c2          	cmovne %rdx,%rax
+  8005e7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005eb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005ef:	7e 06                	jle    8005f7 <vprintfmt+0x24b>
+  8005f1:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005f5:	75 4a                	jne    800641 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005f7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005fb:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8005ff:	0f b6 00             	movzbl (%rax),%eax
+  800602:	84 c0                	test   %al,%al
+  800604:	0f 85 9a 00 00 00    	jne    8006a4 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80060a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80060d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800611:	85 c0                	test   %eax,%eax
+  800613:	0f 8e c4 fd ff ff    	jle    8003dd <vprintfmt+0x31>
+  800619:	4c 89 ee             	mov    %r13,%rsi
+  80061c:	bf 20 00 00 00       	mov    $0x20,%edi
+  800621:	41 ff d6             	call   *%r14
+  800624:	41 83 ec 01          	sub    $0x1,%r12d
+  800628:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80062c:	75 eb                	jne    800619 <vprintfmt+0x26d>
+  80062e:	e9 aa fd ff ff       	jmp    8003dd <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800633:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800637:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80063b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80063f:	eb 92                	jmp    8005d3 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800641:	49 63 f7             	movslq %r15d,%rsi
+  800644:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800648:	48 b8 5e 0b 80 00 00 	movabs $0x800b5e,%rax
+  80064f:	00 00 00 
+  800652:	ff d0                	call   *%rax
+  800654:	48 89 c2             	mov    %rax,%rdx
+  800657:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80065a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80065c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80065f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800662:	85 c0                	test   %eax,%eax
+  800664:	7e 91                	jle    8005f7 <vprintfmt+0x24b>
+  800666:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80066b:	4c 89 ee             	mov    %r13,%rsi
+  80066e:	44 89 e7             	mov    %r12d,%edi
+  800671:	41 ff d6             	call   *%r14
+  800674:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800678:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80067b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80067e:	75 eb                	jne    80066b <vprintfmt+0x2bf>
+  800680:	e9 72 ff ff ff       	jmp    8005f7 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800685:	0f b6 f8             	movzbl %al,%edi
+  800688:	4c 89 ee             	mov    %r13,%rsi
+  80068b:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80068e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800692:	49 83 c4 01          	add    $0x1,%r12
+  800696:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80069c:	84 c0                	test   %al,%al
+  80069e:	0f 84 66 ff ff ff    	je     80060a <vprintfmt+0x25e>
+  8006a4:	45 85 ff             	test   %r15d,%r15d
+  8006a7:	78 0a                	js     8006b3 <vprintfmt+0x307>
+  8006a9:	41 83 ef 01          	sub    $0x1,%r15d
+  8006ad:	0f 88 57 ff ff ff    	js     80060a <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006b3:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006b7:	74 cc                	je     800685 <vprintfmt+0x2d9>
+  8006b9:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006bc:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006c1:	80 fa 5e             	cmp    $0x5e,%dl
+  8006c4:	77 c2                	ja     800688 <vprintfmt+0x2dc>
+  8006c6:	eb bd                	jmp    800685 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8006c8:	40 84 f6             	test   %sil,%sil
+  8006cb:	75 26                	jne    8006f3 <vprintfmt+0x347>
+    switch (lflag) {
+  8006cd:	85 d2                	test   %edx,%edx
+  8006cf:	74 59                	je     80072a <vprintfmt+0x37e>
+  8006d1:	83 fa 01             	cmp    $0x1,%edx
+  8006d4:	74 7b                	je     800751 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8006dc:	0f 87 96 00 00 00    	ja     800778 <vprintfmt+0x3cc>
+  8006e2:	89 c2                	mov    %eax,%edx
+  8006e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e8:	83 c0 08             	add    $0x8,%eax
+  8006eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ee:	4c 8b 22             	mov    (%rdx),%r12
+  8006f1:	eb 17                	jmp    80070a <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f9:	77 21                	ja     80071c <vprintfmt+0x370>
+  8006fb:	89 c2                	mov    %eax,%edx
+  8006fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800701:	83 c0 08             	add    $0x8,%eax
+  800704:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800707:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80070a:	4d 85 e4             	test   %r12,%r12
+  80070d:	78 7a                	js     800789 <vprintfmt+0x3dd>
+            num = i;
+  80070f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800712:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800717:	e9 50 02 00 00       	jmp    80096c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80071c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800720:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800724:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800728:	eb dd                	jmp    800707 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80072a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072d:	83 f8 2f             	cmp    $0x2f,%eax
+  800730:	77 11                	ja     800743 <vprintfmt+0x397>
+  800732:	89 c2                	mov    %eax,%edx
+  800734:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800738:	83 c0 08             	add    $0x8,%eax
+  80073b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80073e:	4c 63 22             	movslq (%rdx),%r12
+  800741:	eb c7                	jmp    80070a <vprintfmt+0x35e>
+  800743:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800747:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80074b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80074f:	eb ed                	jmp    80073e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800751:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800754:	83 f8 2f             	cmp    $0x2f,%eax
+  800757:	77 11                	ja     80076a <vprintfmt+0x3be>
+  800759:	89 c2                	mov    %eax,%edx
+  80075b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075f:	83 c0 08             	add    $0x8,%eax
+  800762:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800765:	4c 8b 22             	mov    (%rdx),%r12
+  800768:	eb a0                	jmp    80070a <vprintfmt+0x35e>
+  80076a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80076e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800772:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800776:	eb ed                	jmp    800765 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800778:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80077c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800780:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800784:	e9 65 ff ff ff       	jmp    8006ee <vprintfmt+0x342>
+                putch('-', put_arg);
+  800789:	4c 89 ee             	mov    %r13,%rsi
+  80078c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800791:	41 ff d6             	call   *%r14
+                i = -i;
+  800794:	49 f7 dc             	neg    %r12
+  800797:	e9 73 ff ff ff       	jmp    80070f <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80079c:	40 84 f6             	test   %sil,%sil
+  80079f:	75 32                	jne    8007d3 <vprintfmt+0x427>
+    switch (lflag) {
+  8007a1:	85 d2                	test   %edx,%edx
+  8007a3:	74 5d                	je     800802 <vprintfmt+0x456>
+  8007a5:	83 fa 01             	cmp    $0x1,%edx
+  8007a8:	0f 84 82 00 00 00    	je     800830 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b4:	0f 87 a5 00 00 00    	ja     80085f <vprintfmt+0x4b3>
+  8007ba:	89 c2                	mov    %eax,%edx
+  8007bc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c0:	83 c0 08             	add    $0x8,%eax
+  8007c3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007c9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007ce:	e9 99 01 00 00       	jmp    80096c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d9:	77 19                	ja     8007f4 <vprintfmt+0x448>
+  8007db:	89 c2                	mov    %eax,%edx
+  8007dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e1:	83 c0 08             	add    $0x8,%eax
+  8007e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007e7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007ea:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007ef:	e9 78 01 00 00       	jmp    80096c <vprintfmt+0x5c0>
+  8007f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800800:	eb e5                	jmp    8007e7 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800802:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800805:	83 f8 2f             	cmp    $0x2f,%eax
+  800808:	77 18                	ja     800822 <vprintfmt+0x476>
+  80080a:	89 c2                	mov    %eax,%edx
+  80080c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800810:	83 c0 08             	add    $0x8,%eax
+  800813:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800816:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800818:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80081d:	e9 4a 01 00 00       	jmp    80096c <vprintfmt+0x5c0>
+  800822:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800826:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80082e:	eb e6                	jmp    800816 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800830:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800833:	83 f8 2f             	cmp    $0x2f,%eax
+  800836:	77 19                	ja     800851 <vprintfmt+0x4a5>
+  800838:	89 c2                	mov    %eax,%edx
+  80083a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083e:	83 c0 08             	add    $0x8,%eax
+  800841:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800844:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800847:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80084c:	e9 1b 01 00 00       	jmp    80096c <vprintfmt+0x5c0>
+  800851:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800855:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800859:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085d:	eb e5                	jmp    800844 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80085f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800863:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800867:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086b:	e9 56 ff ff ff       	jmp    8007c6 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800870:	40 84 f6             	test   %sil,%sil
+  800873:	75 2e                	jne    8008a3 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800875:	85 d2                	test   %edx,%edx
+  800877:	74 59                	je     8008d2 <vprintfmt+0x526>
+  800879:	83 fa 01             	cmp    $0x1,%edx
+  80087c:	74 7f                	je     8008fd <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80087e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800881:	83 f8 2f             	cmp    $0x2f,%eax
+  800884:	0f 87 9f 00 00 00    	ja     800929 <vprintfmt+0x57d>
+  80088a:	89 c2                	mov    %eax,%edx
+  80088c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800890:	83 c0 08             	add    $0x8,%eax
+  800893:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800896:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800899:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80089e:	e9 c9 00 00 00       	jmp    80096c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a9:	77 19                	ja     8008c4 <vprintfmt+0x518>
+  8008ab:	89 c2                	mov    %eax,%edx
+  8008ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b1:	83 c0 08             	add    $0x8,%eax
+  8008b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008ba:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008bf:	e9 a8 00 00 00       	jmp    80096c <vprintfmt+0x5c0>
+  8008c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d0:	eb e5                	jmp    8008b7 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d8:	77 15                	ja     8008ef <vprintfmt+0x543>
+  8008da:	89 c2                	mov    %eax,%edx
+  8008dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e0:	83 c0 08             	add    $0x8,%eax
+  8008e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e6:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8008e8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8008ed:	eb 7d                	jmp    80096c <vprintfmt+0x5c0>
+  8008ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fb:	eb e9                	jmp    8008e6 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8008fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800900:	83 f8 2f             	cmp    $0x2f,%eax
+  800903:	77 16                	ja     80091b <vprintfmt+0x56f>
+  800905:	89 c2                	mov    %eax,%edx
+  800907:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090b:	83 c0 08             	add    $0x8,%eax
+  80090e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800911:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800914:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800919:	eb 51                	jmp    80096c <vprintfmt+0x5c0>
+  80091b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800923:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800927:	eb e8                	jmp    800911 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800929:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800931:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800935:	e9 5c ff ff ff       	jmp    800896 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80093a:	4c 89 ee             	mov    %r13,%rsi
+  80093d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800942:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800945:	4c 89 ee             	mov    %r13,%rsi
+  800948:	bf 78 00 00 00       	mov    $0x78,%edi
+  80094d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800950:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800953:	83 f8 2f             	cmp    $0x2f,%eax
+  800956:	77 47                	ja     80099f <vprintfmt+0x5f3>
+  800958:	89 c2                	mov    %eax,%edx
+  80095a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095e:	83 c0 08             	add    $0x8,%eax
+  800961:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800964:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800967:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80096c:	48 83 ec 08          	sub    $0x8,%rsp
+  800970:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800974:	0f 94 c0             	sete   %al
+  800977:	0f b6 c0             	movzbl %al,%eax
+  80097a:	50                   	push   %rax
+  80097b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800980:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800984:	4c 89 ee             	mov    %r13,%rsi
+  800987:	4c 89 f7             	mov    %r14,%rdi
+  80098a:	48 b8 a1 02 80 00 00 	movabs $0x8002a1,%rax
+  800991:	00 00 00 
+  800994:	ff d0                	call   *%rax
+            break;
+  800996:	48 83 c4 10          	add    $0x10,%rsp
+  80099a:	e9 3e fa ff ff       	jmp    8003dd <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80099f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ab:	eb b7                	jmp    800964 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ad:	40 84 f6             	test   %sil,%sil
+  8009b0:	75 2b                	jne    8009dd <vprintfmt+0x631>
+    switch (lflag) {
+  8009b2:	85 d2                	test   %edx,%edx
+  8009b4:	74 56                	je     800a0c <vprintfmt+0x660>
+  8009b6:	83 fa 01             	cmp    $0x1,%edx
+  8009b9:	74 7f                	je     800a3a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009be:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c1:	0f 87 a2 00 00 00    	ja     800a69 <vprintfmt+0x6bd>
+  8009c7:	89 c2                	mov    %eax,%edx
+  8009c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cd:	83 c0 08             	add    $0x8,%eax
+  8009d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009db:	eb 8f                	jmp    80096c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e3:	77 19                	ja     8009fe <vprintfmt+0x652>
+  8009e5:	89 c2                	mov    %eax,%edx
+  8009e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009eb:	83 c0 08             	add    $0x8,%eax
+  8009ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009f4:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009f9:	e9 6e ff ff ff       	jmp    80096c <vprintfmt+0x5c0>
+  8009fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0a:	eb e5                	jmp    8009f1 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a12:	77 18                	ja     800a2c <vprintfmt+0x680>
+  800a14:	89 c2                	mov    %eax,%edx
+  800a16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1a:	83 c0 08             	add    $0x8,%eax
+  800a1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a20:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a22:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a27:	e9 40 ff ff ff       	jmp    80096c <vprintfmt+0x5c0>
+  800a2c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a30:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a34:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a38:	eb e6                	jmp    800a20 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a3a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a3d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a40:	77 19                	ja     800a5b <vprintfmt+0x6af>
+  800a42:	89 c2                	mov    %eax,%edx
+  800a44:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a48:	83 c0 08             	add    $0x8,%eax
+  800a4b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a51:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a56:	e9 11 ff ff ff       	jmp    80096c <vprintfmt+0x5c0>
+  800a5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a67:	eb e5                	jmp    800a4e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a75:	e9 59 ff ff ff       	jmp    8009d3 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a7a:	4c 89 ee             	mov    %r13,%rsi
+  800a7d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a82:	41 ff d6             	call   *%r14
+            break;
+  800a85:	e9 53 f9 ff ff       	jmp    8003dd <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a8a:	4c 89 ee             	mov    %r13,%rsi
+  800a8d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a92:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a95:	48 83 eb 01          	sub    $0x1,%rbx
+  800a99:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a9d:	75 f6                	jne    800a95 <vprintfmt+0x6e9>
+  800a9f:	e9 39 f9 ff ff       	jmp    8003dd <vprintfmt+0x31>
+}
+  800aa4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800aa8:	5b                   	pop    %rbx
+  800aa9:	41 5c                	pop    %r12
+  800aab:	41 5d                	pop    %r13
+  800aad:	41 5e                	pop    %r14
+  800aaf:	41 5f                	pop    %r15
+  800ab1:	5d                   	pop    %rbp
+  800ab2:	c3                   	ret
+
+0000000000800ab3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ab3:	55                   	push   %rbp
+  800ab4:	48 89 e5             	mov    %rsp,%rbp
+  800ab7:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800abb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800abf:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ac4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ac8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800acf:	48 85 ff             	test   %rdi,%rdi
+  800ad2:	74 2b                	je     800aff <vsnprintf+0x4c>
+  800ad4:	48 85 f6             	test   %rsi,%rsi
+  800ad7:	74 26                	je     800aff <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ad9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800add:	48 bf 57 03 80 00 00 	movabs $0x800357,%rdi
+  800ae4:	00 00 00 
+  800ae7:	48 b8 ac 03 80 00 00 	movabs $0x8003ac,%rax
+  800aee:	00 00 00 
+  800af1:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800af3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800af7:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800afa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800afd:	c9                   	leave
+  800afe:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800aff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b04:	eb f7                	jmp    800afd <vsnprintf+0x4a>
+
+0000000000800b06 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b06:	55                   	push   %rbp
+  800b07:	48 89 e5             	mov    %rsp,%rbp
+  800b0a:	48 83 ec 50          	sub    $0x50,%rsp
+  800b0e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b12:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b16:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b1a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b21:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b29:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b2d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b31:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b35:	48 b8 b3 0a 80 00 00 	movabs $0x800ab3,%rax
+  800b3c:	00 00 00 
+  800b3f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b41:	c9                   	leave
+  800b42:	c3                   	ret
+
+0000000000800b43 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b43:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b46:	74 10                	je     800b58 <strlen+0x15>
+    size_t n = 0;
+  800b48:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b4d:	48 83 c0 01          	add    $0x1,%rax
+  800b51:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b55:	75 f6                	jne    800b4d <strlen+0xa>
+  800b57:	c3                   	ret
+    size_t n = 0;
+  800b58:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b5d:	c3                   	ret
+
+0000000000800b5e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b5e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b61:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b66:	48 85 f6             	test   %rsi,%rsi
+  800b69:	74 11                	je     800b7c <strnlen+0x1e>
+  800b6b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b6f:	74 0c                	je     800b7d <strnlen+0x1f>
+  800b71:	48 83 c2 01          	add    $0x1,%rdx
+  800b75:	48 39 d0             	cmp    %rdx,%rax
+  800b78:	75 f1                	jne    800b6b <strnlen+0xd>
+  800b7a:	eb 04                	jmp    800b80 <strnlen+0x22>
+  800b7c:	c3                   	ret
+  800b7d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b80:	c3                   	ret
+
+0000000000800b81 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b81:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b84:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b89:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b8d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b90:	48 83 c2 01          	add    $0x1,%rdx
+  800b94:	84 c9                	test   %cl,%cl
+  800b96:	75 f1                	jne    800b89 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b98:	c3                   	ret
+
+0000000000800b99 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b99:	55                   	push   %rbp
+  800b9a:	48 89 e5             	mov    %rsp,%rbp
+  800b9d:	41 54                	push   %r12
+  800b9f:	53                   	push   %rbx
+  800ba0:	48 89 fb             	mov    %rdi,%rbx
+  800ba3:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ba6:	48 b8 43 0b 80 00 00 	movabs $0x800b43,%rax
+  800bad:	00 00 00 
+  800bb0:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bb2:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bb6:	4c 89 e6             	mov    %r12,%rsi
+  800bb9:	48 b8 81 0b 80 00 00 	movabs $0x800b81,%rax
+  800bc0:	00 00 00 
+  800bc3:	ff d0                	call   *%rax
+    return dst;
+}
+  800bc5:	48 89 d8             	mov    %rbx,%rax
+  800bc8:	5b                   	pop    %rbx
+  800bc9:	41 5c                	pop    %r12
+  800bcb:	5d                   	pop    %rbp
+  800bcc:	c3                   	ret
+
+0000000000800bcd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bcd:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800bd0:	48 85 d2             	test   %rdx,%rdx
+  800bd3:	74 1f                	je     800bf4 <strncpy+0x27>
+  800bd5:	48 01 fa             	add    %rdi,%rdx
+  800bd8:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800bdb:	48 83 c1 01          	add    $0x1,%rcx
+  800bdf:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800be3:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800be7:	41 80 f8 01          	cmp    $0x1,%r8b
+  800beb:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bef:	48 39 ca             	cmp    %rcx,%rdx
+  800bf2:	75 e7                	jne    800bdb <strncpy+0xe>
+    }
+    return ret;
+}
+  800bf4:	c3                   	ret
+
+0000000000800bf5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bf5:	48 89 f8             	mov    %rdi,%rax
+  800bf8:	48 85 d2             	test   %rdx,%rdx
+  800bfb:	74 24                	je     800c21 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bfd:	48 83 ea 01          	sub    $0x1,%rdx
+  800c01:	74 1b                	je     800c1e <strlcpy+0x29>
+  800c03:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c07:	0f b6 16             	movzbl (%rsi),%edx
+  800c0a:	84 d2                	test   %dl,%dl
+  800c0c:	74 10                	je     800c1e <strlcpy+0x29>
+            *dst++ = *src++;
+  800c0e:	48 83 c6 01          	add    $0x1,%rsi
+  800c12:	48 83 c0 01          	add    $0x1,%rax
+  800c16:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c19:	48 39 c8             	cmp    %rcx,%rax
+  800c1c:	75 e9                	jne    800c07 <strlcpy+0x12>
+        *dst = '\0';
+  800c1e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c21:	48 29 f8             	sub    %rdi,%rax
+}
+  800c24:	c3                   	ret
+
+0000000000800c25 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c25:	0f b6 07             	movzbl (%rdi),%eax
+  800c28:	84 c0                	test   %al,%al
+  800c2a:	74 13                	je     800c3f <strcmp+0x1a>
+  800c2c:	38 06                	cmp    %al,(%rsi)
+  800c2e:	75 0f                	jne    800c3f <strcmp+0x1a>
+  800c30:	48 83 c7 01          	add    $0x1,%rdi
+  800c34:	48 83 c6 01          	add    $0x1,%rsi
+  800c38:	0f b6 07             	movzbl (%rdi),%eax
+  800c3b:	84 c0                	test   %al,%al
+  800c3d:	75 ed                	jne    800c2c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c3f:	0f b6 c0             	movzbl %al,%eax
+  800c42:	0f b6 16             	movzbl (%rsi),%edx
+  800c45:	29 d0                	sub    %edx,%eax
+}
+  800c47:	c3                   	ret
+
+0000000000800c48 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c48:	48 85 d2             	test   %rdx,%rdx
+  800c4b:	74 1f                	je     800c6c <strncmp+0x24>
+  800c4d:	0f b6 07             	movzbl (%rdi),%eax
+  800c50:	84 c0                	test   %al,%al
+  800c52:	74 1e                	je     800c72 <strncmp+0x2a>
+  800c54:	3a 06                	cmp    (%rsi),%al
+  800c56:	75 1a                	jne    800c72 <strncmp+0x2a>
+  800c58:	48 83 c7 01          	add    $0x1,%rdi
+  800c5c:	48 83 c6 01          	add    $0x1,%rsi
+  800c60:	48 83 ea 01          	sub    $0x1,%rdx
+  800c64:	75 e7                	jne    800c4d <strncmp+0x5>
+
+    if (!n) return 0;
+  800c66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6b:	c3                   	ret
+  800c6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c71:	c3                   	ret
+  800c72:	48 85 d2             	test   %rdx,%rdx
+  800c75:	74 09                	je     800c80 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c77:	0f b6 07             	movzbl (%rdi),%eax
+  800c7a:	0f b6 16             	movzbl (%rsi),%edx
+  800c7d:	29 d0                	sub    %edx,%eax
+  800c7f:	c3                   	ret
+    if (!n) return 0;
+  800c80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c85:	c3                   	ret
+
+0000000000800c86 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c86:	0f b6 17             	movzbl (%rdi),%edx
+  800c89:	84 d2                	test   %dl,%dl
+  800c8b:	74 18                	je     800ca5 <strchr+0x1f>
+        if (*str == c) {
+  800c8d:	0f be d2             	movsbl %dl,%edx
+  800c90:	39 f2                	cmp    %esi,%edx
+  800c92:	74 17                	je     800cab <strchr+0x25>
+    for (; *str; str++) {
+  800c94:	48 83 c7 01          	add    $0x1,%rdi
+  800c98:	0f b6 17             	movzbl (%rdi),%edx
+  800c9b:	84 d2                	test   %dl,%dl
+  800c9d:	75 ee                	jne    800c8d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca4:	c3                   	ret
+  800ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800caa:	c3                   	ret
+  800cab:	48 89 f8             	mov    %rdi,%rax
+}
+  800cae:	c3                   	ret
+
+0000000000800caf <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800caf:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cb2:	0f b6 17             	movzbl (%rdi),%edx
+  800cb5:	84 d2                	test   %dl,%dl
+  800cb7:	74 13                	je     800ccc <strfind+0x1d>
+  800cb9:	0f be d2             	movsbl %dl,%edx
+  800cbc:	39 f2                	cmp    %esi,%edx
+  800cbe:	74 0b                	je     800ccb <strfind+0x1c>
+  800cc0:	48 83 c0 01          	add    $0x1,%rax
+  800cc4:	0f b6 10             	movzbl (%rax),%edx
+  800cc7:	84 d2                	test   %dl,%dl
+  800cc9:	75 ee                	jne    800cb9 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ccb:	c3                   	ret
+  800ccc:	c3                   	ret
+
+0000000000800ccd <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ccd:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800cd0:	48 89 f8             	mov    %rdi,%rax
+  800cd3:	48 f7 d8             	neg    %rax
+  800cd6:	83 e0 07             	and    $0x7,%eax
+  800cd9:	49 89 d1             	mov    %rdx,%r9
+  800cdc:	49 29 c1             	sub    %rax,%r9
+  800cdf:	78 36                	js     800d17 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ce1:	40 0f b6 c6          	movzbl %sil,%eax
+  800ce5:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800cec:	01 01 01 
+  800cef:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800cf3:	40 f6 c7 07          	test   $0x7,%dil
+  800cf7:	75 38                	jne    800d31 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800cf9:	4c 89 c9             	mov    %r9,%rcx
+  800cfc:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d00:	74 0c                	je     800d0e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d02:	fc                   	cld
+  800d03:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d06:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d0a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d0e:	4d 85 c9             	test   %r9,%r9
+  800d11:	75 45                	jne    800d58 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d13:	4c 89 c0             	mov    %r8,%rax
+  800d16:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d17:	48 85 d2             	test   %rdx,%rdx
+  800d1a:	74 f7                	je     800d13 <memset+0x46>
+  800d1c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d1f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d22:	48 83 c0 01          	add    $0x1,%rax
+  800d26:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d2a:	48 39 c2             	cmp    %rax,%rdx
+  800d2d:	75 f3                	jne    800d22 <memset+0x55>
+  800d2f:	eb e2                	jmp    800d13 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d31:	40 f6 c7 01          	test   $0x1,%dil
+  800d35:	74 06                	je     800d3d <memset+0x70>
+  800d37:	88 07                	mov    %al,(%rdi)
+  800d39:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d3d:	40 f6 c7 02          	test   $0x2,%dil
+  800d41:	74 07                	je     800d4a <memset+0x7d>
+  800d43:	66 89 07             	mov    %ax,(%rdi)
+  800d46:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d4a:	40 f6 c7 04          	test   $0x4,%dil
+  800d4e:	74 a9                	je     800cf9 <memset+0x2c>
+  800d50:	89 07                	mov    %eax,(%rdi)
+  800d52:	48 83 c7 04          	add    $0x4,%rdi
+  800d56:	eb a1                	jmp    800cf9 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d58:	41 f6 c1 04          	test   $0x4,%r9b
+  800d5c:	74 06                	je     800d64 <memset+0x97>
+  800d5e:	89 07                	mov    %eax,(%rdi)
+  800d60:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d64:	41 f6 c1 02          	test   $0x2,%r9b
+  800d68:	74 07                	je     800d71 <memset+0xa4>
+  800d6a:	66 89 07             	mov    %ax,(%rdi)
+  800d6d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d71:	41 f6 c1 01          	test   $0x1,%r9b
+  800d75:	74 9c                	je     800d13 <memset+0x46>
+  800d77:	88 07                	mov    %al,(%rdi)
+  800d79:	eb 98                	jmp    800d13 <memset+0x46>
+
+0000000000800d7b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d7b:	48 89 f8             	mov    %rdi,%rax
+  800d7e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d81:	48 39 fe             	cmp    %rdi,%rsi
+  800d84:	73 3b                	jae    800dc1 <memmove+0x46>
+  800d86:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d8a:	48 39 d7             	cmp    %rdx,%rdi
+  800d8d:	73 32                	jae    800dc1 <memmove+0x46>
+        s += n;
+        d += n;
+  800d8f:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d93:	48 89 d6             	mov    %rdx,%rsi
+  800d96:	48 09 fe             	or     %rdi,%rsi
+  800d99:	48 09 ce             	or     %rcx,%rsi
+  800d9c:	40 f6 c6 07          	test   $0x7,%sil
+  800da0:	75 12                	jne    800db4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800da2:	48 83 ef 08          	sub    $0x8,%rdi
+  800da6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800daa:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dae:	fd                   	std
+  800daf:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800db2:	fc                   	cld
+  800db3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800db4:	48 83 ef 01          	sub    $0x1,%rdi
+  800db8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800dbc:	fd                   	std
+  800dbd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800dbf:	eb f1                	jmp    800db2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dc1:	48 89 f2             	mov    %rsi,%rdx
+  800dc4:	48 09 c2             	or     %rax,%rdx
+  800dc7:	48 09 ca             	or     %rcx,%rdx
+  800dca:	f6 c2 07             	test   $0x7,%dl
+  800dcd:	75 0c                	jne    800ddb <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800dcf:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dd3:	48 89 c7             	mov    %rax,%rdi
+  800dd6:	fc                   	cld
+  800dd7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800dda:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ddb:	48 89 c7             	mov    %rax,%rdi
+  800dde:	fc                   	cld
+  800ddf:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800de1:	c3                   	ret
+
+0000000000800de2 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800de2:	55                   	push   %rbp
+  800de3:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800de6:	48 b8 7b 0d 80 00 00 	movabs $0x800d7b,%rax
+  800ded:	00 00 00 
+  800df0:	ff d0                	call   *%rax
+}
+  800df2:	5d                   	pop    %rbp
+  800df3:	c3                   	ret
+
+0000000000800df4 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800df4:	55                   	push   %rbp
+  800df5:	48 89 e5             	mov    %rsp,%rbp
+  800df8:	41 57                	push   %r15
+  800dfa:	41 56                	push   %r14
+  800dfc:	41 55                	push   %r13
+  800dfe:	41 54                	push   %r12
+  800e00:	53                   	push   %rbx
+  800e01:	48 83 ec 08          	sub    $0x8,%rsp
+  800e05:	49 89 fe             	mov    %rdi,%r14
+  800e08:	49 89 f7             	mov    %rsi,%r15
+  800e0b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e0e:	48 89 f7             	mov    %rsi,%rdi
+  800e11:	48 b8 43 0b 80 00 00 	movabs $0x800b43,%rax
+  800e18:	00 00 00 
+  800e1b:	ff d0                	call   *%rax
+  800e1d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e20:	48 89 de             	mov    %rbx,%rsi
+  800e23:	4c 89 f7             	mov    %r14,%rdi
+  800e26:	48 b8 5e 0b 80 00 00 	movabs $0x800b5e,%rax
+  800e2d:	00 00 00 
+  800e30:	ff d0                	call   *%rax
+  800e32:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e35:	48 39 c3             	cmp    %rax,%rbx
+  800e38:	74 36                	je     800e70 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e3a:	48 89 d8             	mov    %rbx,%rax
+  800e3d:	4c 29 e8             	sub    %r13,%rax
+  800e40:	49 39 c4             	cmp    %rax,%r12
+  800e43:	73 31                	jae    800e76 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e45:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e4a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e4e:	4c 89 fe             	mov    %r15,%rsi
+  800e51:	48 b8 e2 0d 80 00 00 	movabs $0x800de2,%rax
+  800e58:	00 00 00 
+  800e5b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e5d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e61:	48 83 c4 08          	add    $0x8,%rsp
+  800e65:	5b                   	pop    %rbx
+  800e66:	41 5c                	pop    %r12
+  800e68:	41 5d                	pop    %r13
+  800e6a:	41 5e                	pop    %r14
+  800e6c:	41 5f                	pop    %r15
+  800e6e:	5d                   	pop    %rbp
+  800e6f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e70:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e74:	eb eb                	jmp    800e61 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e76:	48 83 eb 01          	sub    $0x1,%rbx
+  800e7a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e7e:	48 89 da             	mov    %rbx,%rdx
+  800e81:	4c 89 fe             	mov    %r15,%rsi
+  800e84:	48 b8 e2 0d 80 00 00 	movabs $0x800de2,%rax
+  800e8b:	00 00 00 
+  800e8e:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e90:	49 01 de             	add    %rbx,%r14
+  800e93:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e98:	eb c3                	jmp    800e5d <strlcat+0x69>
+
+0000000000800e9a <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e9a:	48 85 d2             	test   %rdx,%rdx
+  800e9d:	74 2d                	je     800ecc <memcmp+0x32>
+  800e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ea4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ea8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ead:	44 38 c1             	cmp    %r8b,%cl
+  800eb0:	75 0f                	jne    800ec1 <memcmp+0x27>
+    while (n-- > 0) {
+  800eb2:	48 83 c0 01          	add    $0x1,%rax
+  800eb6:	48 39 c2             	cmp    %rax,%rdx
+  800eb9:	75 e9                	jne    800ea4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec0:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800ec1:	0f b6 c1             	movzbl %cl,%eax
+  800ec4:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ec8:	44 29 c0             	sub    %r8d,%eax
+  800ecb:	c3                   	ret
+    return 0;
+  800ecc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ed1:	c3                   	ret
+
+0000000000800ed2 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800ed2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800ed6:	48 39 c7             	cmp    %rax,%rdi
+  800ed9:	73 0f                	jae    800eea <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800edb:	40 38 37             	cmp    %sil,(%rdi)
+  800ede:	74 0e                	je     800eee <memfind+0x1c>
+    for (; src < end; src++) {
+  800ee0:	48 83 c7 01          	add    $0x1,%rdi
+  800ee4:	48 39 f8             	cmp    %rdi,%rax
+  800ee7:	75 f2                	jne    800edb <memfind+0x9>
+  800ee9:	c3                   	ret
+  800eea:	48 89 f8             	mov    %rdi,%rax
+  800eed:	c3                   	ret
+  800eee:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800ef1:	c3                   	ret
+
+0000000000800ef2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800ef2:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800ef5:	0f b6 37             	movzbl (%rdi),%esi
+  800ef8:	40 80 fe 20          	cmp    $0x20,%sil
+  800efc:	74 06                	je     800f04 <strtol+0x12>
+  800efe:	40 80 fe 09          	cmp    $0x9,%sil
+  800f02:	75 13                	jne    800f17 <strtol+0x25>
+  800f04:	48 83 c7 01          	add    $0x1,%rdi
+  800f08:	0f b6 37             	movzbl (%rdi),%esi
+  800f0b:	40 80 fe 20          	cmp    $0x20,%sil
+  800f0f:	74 f3                	je     800f04 <strtol+0x12>
+  800f11:	40 80 fe 09          	cmp    $0x9,%sil
+  800f15:	74 ed                	je     800f04 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f17:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f1a:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f1d:	3c 01                	cmp    $0x1,%al
+  800f1f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f23:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f29:	75 0f                	jne    800f3a <strtol+0x48>
+  800f2b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f2e:	74 14                	je     800f44 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f30:	85 d2                	test   %edx,%edx
+  800f32:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f37:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f3a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f3f:	4c 63 ca             	movslq %edx,%r9
+  800f42:	eb 36                	jmp    800f7a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f44:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f48:	74 0f                	je     800f59 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f4a:	85 d2                	test   %edx,%edx
+  800f4c:	75 ec                	jne    800f3a <strtol+0x48>
+        s++;
+  800f4e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f52:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f57:	eb e1                	jmp    800f3a <strtol+0x48>
+        s += 2;
+  800f59:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f5d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f62:	eb d6                	jmp    800f3a <strtol+0x48>
+            dig -= '0';
+  800f64:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f67:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f6b:	41 39 d0             	cmp    %edx,%r8d
+  800f6e:	7d 21                	jge    800f91 <strtol+0x9f>
+        val = val * base + dig;
+  800f70:	49 0f af c1          	imul   %r9,%rax
+  800f74:	0f b6 c9             	movzbl %cl,%ecx
+  800f77:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f7a:	48 83 c7 01          	add    $0x1,%rdi
+  800f7e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f82:	80 f9 39             	cmp    $0x39,%cl
+  800f85:	76 dd                	jbe    800f64 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f87:	80 f9 7b             	cmp    $0x7b,%cl
+  800f8a:	77 05                	ja     800f91 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f8c:	83 e9 57             	sub    $0x57,%ecx
+  800f8f:	eb d6                	jmp    800f67 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f91:	4d 85 d2             	test   %r10,%r10
+  800f94:	74 03                	je     800f99 <strtol+0xa7>
+  800f96:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f99:	48 89 c2             	mov    %rax,%rdx
+  800f9c:	48 f7 da             	neg    %rdx
+  800f9f:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fa3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fa7:	c3                   	ret
+
+0000000000800fa8 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800fa8:	55                   	push   %rbp
+  800fa9:	48 89 e5             	mov    %rsp,%rbp
+  800fac:	53                   	push   %rbx
+  800fad:	48 89 fa             	mov    %rdi,%rdx
+  800fb0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fc2:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fcd:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800fcf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fd3:	c9                   	leave
+  800fd4:	c3                   	ret
+
+0000000000800fd5 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800fd5:	55                   	push   %rbp
+  800fd6:	48 89 e5             	mov    %rsp,%rbp
+  800fd9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800fda:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fe9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ff3:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800ffe:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801000:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801004:	c9                   	leave
+  801005:	c3                   	ret
+
+0000000000801006 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801006:	55                   	push   %rbp
+  801007:	48 89 e5             	mov    %rsp,%rbp
+  80100a:	53                   	push   %rbx
+  80100b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80100f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801012:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801017:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80101c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801021:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801026:	be 00 00 00 00       	mov    $0x0,%esi
+  80102b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801031:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801033:	48 85 c0             	test   %rax,%rax
+  801036:	7f 06                	jg     80103e <sys_env_destroy+0x38>
+}
+  801038:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80103c:	c9                   	leave
+  80103d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80103e:	49 89 c0             	mov    %rax,%r8
+  801041:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801046:	48 ba b0 32 80 00 00 	movabs $0x8032b0,%rdx
+  80104d:	00 00 00 
+  801050:	be 26 00 00 00       	mov    $0x26,%esi
+  801055:	48 bf cf 32 80 00 00 	movabs $0x8032cf,%rdi
+  80105c:	00 00 00 
+  80105f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801064:	49 b9 a6 2a 80 00 00 	movabs $0x802aa6,%r9
+  80106b:	00 00 00 
+  80106e:	41 ff d1             	call   *%r9
+
+0000000000801071 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801071:	55                   	push   %rbp
+  801072:	48 89 e5             	mov    %rsp,%rbp
+  801075:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801076:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80107b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801080:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801085:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80108f:	be 00 00 00 00       	mov    $0x0,%esi
+  801094:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80109a:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80109c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010a0:	c9                   	leave
+  8010a1:	c3                   	ret
+
+00000000008010a2 <sys_yield>:
+
+void
+sys_yield(void) {
+  8010a2:	55                   	push   %rbp
+  8010a3:	48 89 e5             	mov    %rsp,%rbp
+  8010a6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010a7:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010bb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010cb:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010d1:	c9                   	leave
+  8010d2:	c3                   	ret
+
+00000000008010d3 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8010d3:	55                   	push   %rbp
+  8010d4:	48 89 e5             	mov    %rsp,%rbp
+  8010d7:	53                   	push   %rbx
+  8010d8:	48 89 fa             	mov    %rdi,%rdx
+  8010db:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010de:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010e3:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8010ea:	00 00 00 
+  8010ed:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010fd:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8010ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801103:	c9                   	leave
+  801104:	c3                   	ret
+
+0000000000801105 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801105:	55                   	push   %rbp
+  801106:	48 89 e5             	mov    %rsp,%rbp
+  801109:	53                   	push   %rbx
+  80110a:	49 89 f8             	mov    %rdi,%r8
+  80110d:	48 89 d3             	mov    %rdx,%rbx
+  801110:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801113:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801118:	4c 89 c2             	mov    %r8,%rdx
+  80111b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80111e:	be 00 00 00 00       	mov    $0x0,%esi
+  801123:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801129:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80112b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80112f:	c9                   	leave
+  801130:	c3                   	ret
+
+0000000000801131 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801131:	55                   	push   %rbp
+  801132:	48 89 e5             	mov    %rsp,%rbp
+  801135:	53                   	push   %rbx
+  801136:	48 83 ec 08          	sub    $0x8,%rsp
+  80113a:	89 f8                	mov    %edi,%eax
+  80113c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80113f:	48 63 f9             	movslq %ecx,%rdi
+  801142:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801145:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80114a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80114d:	be 00 00 00 00       	mov    $0x0,%esi
+  801152:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801158:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80115a:	48 85 c0             	test   %rax,%rax
+  80115d:	7f 06                	jg     801165 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80115f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801163:	c9                   	leave
+  801164:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801165:	49 89 c0             	mov    %rax,%r8
+  801168:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80116d:	48 ba b0 32 80 00 00 	movabs $0x8032b0,%rdx
+  801174:	00 00 00 
+  801177:	be 26 00 00 00       	mov    $0x26,%esi
+  80117c:	48 bf cf 32 80 00 00 	movabs $0x8032cf,%rdi
+  801183:	00 00 00 
+  801186:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118b:	49 b9 a6 2a 80 00 00 	movabs $0x802aa6,%r9
+  801192:	00 00 00 
+  801195:	41 ff d1             	call   *%r9
+
+0000000000801198 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801198:	55                   	push   %rbp
+  801199:	48 89 e5             	mov    %rsp,%rbp
+  80119c:	53                   	push   %rbx
+  80119d:	48 83 ec 08          	sub    $0x8,%rsp
+  8011a1:	89 f8                	mov    %edi,%eax
+  8011a3:	49 89 f2             	mov    %rsi,%r10
+  8011a6:	48 89 cf             	mov    %rcx,%rdi
+  8011a9:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011ac:	48 63 da             	movslq %edx,%rbx
+  8011af:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011b2:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011b7:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ba:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8011bd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011bf:	48 85 c0             	test   %rax,%rax
+  8011c2:	7f 06                	jg     8011ca <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011c8:	c9                   	leave
+  8011c9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011ca:	49 89 c0             	mov    %rax,%r8
+  8011cd:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8011d2:	48 ba b0 32 80 00 00 	movabs $0x8032b0,%rdx
+  8011d9:	00 00 00 
+  8011dc:	be 26 00 00 00       	mov    $0x26,%esi
+  8011e1:	48 bf cf 32 80 00 00 	movabs $0x8032cf,%rdi
+  8011e8:	00 00 00 
+  8011eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f0:	49 b9 a6 2a 80 00 00 	movabs $0x802aa6,%r9
+  8011f7:	00 00 00 
+  8011fa:	41 ff d1             	call   *%r9
+
+00000000008011fd <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8011fd:	55                   	push   %rbp
+  8011fe:	48 89 e5             	mov    %rsp,%rbp
+  801201:	53                   	push   %rbx
+  801202:	48 83 ec 08          	sub    $0x8,%rsp
+  801206:	48 89 f1             	mov    %rsi,%rcx
+  801209:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80120c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80120f:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801214:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801219:	be 00 00 00 00       	mov    $0x0,%esi
+  80121e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801224:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801226:	48 85 c0             	test   %rax,%rax
+  801229:	7f 06                	jg     801231 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80122b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80122f:	c9                   	leave
+  801230:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801231:	49 89 c0             	mov    %rax,%r8
+  801234:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801239:	48 ba b0 32 80 00 00 	movabs $0x8032b0,%rdx
+  801240:	00 00 00 
+  801243:	be 26 00 00 00       	mov    $0x26,%esi
+  801248:	48 bf cf 32 80 00 00 	movabs $0x8032cf,%rdi
+  80124f:	00 00 00 
+  801252:	b8 00 00 00 00       	mov    $0x0,%eax
+  801257:	49 b9 a6 2a 80 00 00 	movabs $0x802aa6,%r9
+  80125e:	00 00 00 
+  801261:	41 ff d1             	call   *%r9
+
+0000000000801264 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801264:	55                   	push   %rbp
+  801265:	48 89 e5             	mov    %rsp,%rbp
+  801268:	53                   	push   %rbx
+  801269:	48 83 ec 08          	sub    $0x8,%rsp
+  80126d:	89 f8                	mov    %edi,%eax
+  80126f:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801272:	48 63 f9             	movslq %ecx,%rdi
+  801275:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801278:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80127d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801280:	be 00 00 00 00       	mov    $0x0,%esi
+  801285:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80128b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80128d:	48 85 c0             	test   %rax,%rax
+  801290:	7f 06                	jg     801298 <sys_region_advise+0x34>
+}
+  801292:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801296:	c9                   	leave
+  801297:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801298:	49 89 c0             	mov    %rax,%r8
+  80129b:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8012a0:	48 ba b0 32 80 00 00 	movabs $0x8032b0,%rdx
+  8012a7:	00 00 00 
+  8012aa:	be 26 00 00 00       	mov    $0x26,%esi
+  8012af:	48 bf cf 32 80 00 00 	movabs $0x8032cf,%rdi
+  8012b6:	00 00 00 
+  8012b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012be:	49 b9 a6 2a 80 00 00 	movabs $0x802aa6,%r9
+  8012c5:	00 00 00 
+  8012c8:	41 ff d1             	call   *%r9
+
+00000000008012cb <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  8012cb:	55                   	push   %rbp
+  8012cc:	48 89 e5             	mov    %rsp,%rbp
+  8012cf:	53                   	push   %rbx
+  8012d0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  8012d4:	48 63 ce             	movslq %esi,%rcx
+  8012d7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012da:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012f6:	48 85 c0             	test   %rax,%rax
+  8012f9:	7f 06                	jg     801301 <sys_env_set_nice+0x36>
+}
+  8012fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ff:	c9                   	leave
+  801300:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801301:	49 89 c0             	mov    %rax,%r8
+  801304:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801309:	48 ba b0 32 80 00 00 	movabs $0x8032b0,%rdx
+  801310:	00 00 00 
+  801313:	be 26 00 00 00       	mov    $0x26,%esi
+  801318:	48 bf cf 32 80 00 00 	movabs $0x8032cf,%rdi
+  80131f:	00 00 00 
+  801322:	b8 00 00 00 00       	mov    $0x0,%eax
+  801327:	49 b9 a6 2a 80 00 00 	movabs $0x802aa6,%r9
+  80132e:	00 00 00 
+  801331:	41 ff d1             	call   *%r9
+
+0000000000801334 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801334:	55                   	push   %rbp
+  801335:	48 89 e5             	mov    %rsp,%rbp
+  801338:	53                   	push   %rbx
+  801339:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80133d:	48 63 ce             	movslq %esi,%rcx
+  801340:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801343:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801348:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801352:	be 00 00 00 00       	mov    $0x0,%esi
+  801357:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80135d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80135f:	48 85 c0             	test   %rax,%rax
+  801362:	7f 06                	jg     80136a <sys_env_set_status+0x36>
+}
+  801364:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801368:	c9                   	leave
+  801369:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80136a:	49 89 c0             	mov    %rax,%r8
+  80136d:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801372:	48 ba b0 32 80 00 00 	movabs $0x8032b0,%rdx
+  801379:	00 00 00 
+  80137c:	be 26 00 00 00       	mov    $0x26,%esi
+  801381:	48 bf cf 32 80 00 00 	movabs $0x8032cf,%rdi
+  801388:	00 00 00 
+  80138b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801390:	49 b9 a6 2a 80 00 00 	movabs $0x802aa6,%r9
+  801397:	00 00 00 
+  80139a:	41 ff d1             	call   *%r9
+
+000000000080139d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80139d:	55                   	push   %rbp
+  80139e:	48 89 e5             	mov    %rsp,%rbp
+  8013a1:	53                   	push   %rbx
+  8013a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8013a6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013a9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ac:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013c8:	48 85 c0             	test   %rax,%rax
+  8013cb:	7f 06                	jg     8013d3 <sys_env_set_trapframe+0x36>
+}
+  8013cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d1:	c9                   	leave
+  8013d2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013d3:	49 89 c0             	mov    %rax,%r8
+  8013d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013db:	48 ba b0 32 80 00 00 	movabs $0x8032b0,%rdx
+  8013e2:	00 00 00 
+  8013e5:	be 26 00 00 00       	mov    $0x26,%esi
+  8013ea:	48 bf cf 32 80 00 00 	movabs $0x8032cf,%rdi
+  8013f1:	00 00 00 
+  8013f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f9:	49 b9 a6 2a 80 00 00 	movabs $0x802aa6,%r9
+  801400:	00 00 00 
+  801403:	41 ff d1             	call   *%r9
+
+0000000000801406 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801406:	55                   	push   %rbp
+  801407:	48 89 e5             	mov    %rsp,%rbp
+  80140a:	53                   	push   %rbx
+  80140b:	48 83 ec 08          	sub    $0x8,%rsp
+  80140f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801412:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801415:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80141a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801424:	be 00 00 00 00       	mov    $0x0,%esi
+  801429:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80142f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801431:	48 85 c0             	test   %rax,%rax
+  801434:	7f 06                	jg     80143c <sys_env_set_pgfault_upcall+0x36>
+}
+  801436:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80143a:	c9                   	leave
+  80143b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80143c:	49 89 c0             	mov    %rax,%r8
+  80143f:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801444:	48 ba b0 32 80 00 00 	movabs $0x8032b0,%rdx
+  80144b:	00 00 00 
+  80144e:	be 26 00 00 00       	mov    $0x26,%esi
+  801453:	48 bf cf 32 80 00 00 	movabs $0x8032cf,%rdi
+  80145a:	00 00 00 
+  80145d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801462:	49 b9 a6 2a 80 00 00 	movabs $0x802aa6,%r9
+  801469:	00 00 00 
+  80146c:	41 ff d1             	call   *%r9
+
+000000000080146f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80146f:	55                   	push   %rbp
+  801470:	48 89 e5             	mov    %rsp,%rbp
+  801473:	53                   	push   %rbx
+  801474:	89 f8                	mov    %edi,%eax
+  801476:	49 89 f1             	mov    %rsi,%r9
+  801479:	48 89 d3             	mov    %rdx,%rbx
+  80147c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80147f:	49 63 f0             	movslq %r8d,%rsi
+  801482:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801485:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80148a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801493:	cd 30                	int    $0x30
+}
+  801495:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801499:	c9                   	leave
+  80149a:	c3                   	ret
+
+000000000080149b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	53                   	push   %rbx
+  8014a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8014a4:	48 89 fa             	mov    %rdi,%rdx
+  8014a7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014aa:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c6:	48 85 c0             	test   %rax,%rax
+  8014c9:	7f 06                	jg     8014d1 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014cf:	c9                   	leave
+  8014d0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d1:	49 89 c0             	mov    %rax,%r8
+  8014d4:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014d9:	48 ba b0 32 80 00 00 	movabs $0x8032b0,%rdx
+  8014e0:	00 00 00 
+  8014e3:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e8:	48 bf cf 32 80 00 00 	movabs $0x8032cf,%rdi
+  8014ef:	00 00 00 
+  8014f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f7:	49 b9 a6 2a 80 00 00 	movabs $0x802aa6,%r9
+  8014fe:	00 00 00 
+  801501:	41 ff d1             	call   *%r9
+
+0000000000801504 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801504:	55                   	push   %rbp
+  801505:	48 89 e5             	mov    %rsp,%rbp
+  801508:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801509:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80150e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801513:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801518:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801522:	be 00 00 00 00       	mov    $0x0,%esi
+  801527:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80152d:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80152f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801533:	c9                   	leave
+  801534:	c3                   	ret
+
+0000000000801535 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  801535:	55                   	push   %rbp
+  801536:	48 89 e5             	mov    %rsp,%rbp
+  801539:	53                   	push   %rbx
+  80153a:	48 83 ec 08          	sub    $0x8,%rsp
+  80153e:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801541:	48 63 ce             	movslq %esi,%rcx
+  801544:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801547:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80154c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801551:	be 00 00 00 00       	mov    $0x0,%esi
+  801556:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80155c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80155e:	48 85 c0             	test   %rax,%rax
+  801561:	7f 06                	jg     801569 <sys_sigqueue+0x34>
+}
+  801563:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801567:	c9                   	leave
+  801568:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801569:	49 89 c0             	mov    %rax,%r8
+  80156c:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801571:	48 ba b0 32 80 00 00 	movabs $0x8032b0,%rdx
+  801578:	00 00 00 
+  80157b:	be 26 00 00 00       	mov    $0x26,%esi
+  801580:	48 bf cf 32 80 00 00 	movabs $0x8032cf,%rdi
+  801587:	00 00 00 
+  80158a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80158f:	49 b9 a6 2a 80 00 00 	movabs $0x802aa6,%r9
+  801596:	00 00 00 
+  801599:	41 ff d1             	call   *%r9
+
+000000000080159c <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  80159c:	55                   	push   %rbp
+  80159d:	48 89 e5             	mov    %rsp,%rbp
+  8015a0:	53                   	push   %rbx
+  8015a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a5:	48 89 fa             	mov    %rdi,%rdx
+  8015a8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ab:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8015bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015c7:	48 85 c0             	test   %rax,%rax
+  8015ca:	7f 06                	jg     8015d2 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  8015cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d0:	c9                   	leave
+  8015d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015d2:	49 89 c0             	mov    %rax,%r8
+  8015d5:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8015da:	48 ba b0 32 80 00 00 	movabs $0x8032b0,%rdx
+  8015e1:	00 00 00 
+  8015e4:	be 26 00 00 00       	mov    $0x26,%esi
+  8015e9:	48 bf cf 32 80 00 00 	movabs $0x8032cf,%rdi
+  8015f0:	00 00 00 
+  8015f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f8:	49 b9 a6 2a 80 00 00 	movabs $0x802aa6,%r9
+  8015ff:	00 00 00 
+  801602:	41 ff d1             	call   *%r9
+
+0000000000801605 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801605:	55                   	push   %rbp
+  801606:	48 89 e5             	mov    %rsp,%rbp
+  801609:	53                   	push   %rbx
+  80160a:	48 83 ec 08          	sub    $0x8,%rsp
+  80160e:	48 89 f1             	mov    %rsi,%rcx
+  801611:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801614:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801617:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80161c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801621:	be 00 00 00 00       	mov    $0x0,%esi
+  801626:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80162c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80162e:	48 85 c0             	test   %rax,%rax
+  801631:	7f 06                	jg     801639 <sys_sigaction+0x34>
+}
+  801633:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801637:	c9                   	leave
+  801638:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801639:	49 89 c0             	mov    %rax,%r8
+  80163c:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801641:	48 ba b0 32 80 00 00 	movabs $0x8032b0,%rdx
+  801648:	00 00 00 
+  80164b:	be 26 00 00 00       	mov    $0x26,%esi
+  801650:	48 bf cf 32 80 00 00 	movabs $0x8032cf,%rdi
+  801657:	00 00 00 
+  80165a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165f:	49 b9 a6 2a 80 00 00 	movabs $0x802aa6,%r9
+  801666:	00 00 00 
+  801669:	41 ff d1             	call   *%r9
+
+000000000080166c <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  80166c:	55                   	push   %rbp
+  80166d:	48 89 e5             	mov    %rsp,%rbp
+  801670:	53                   	push   %rbx
+  801671:	48 83 ec 08          	sub    $0x8,%rsp
+  801675:	48 89 f1             	mov    %rsi,%rcx
+  801678:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  80167b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80167e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801683:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801688:	be 00 00 00 00       	mov    $0x0,%esi
+  80168d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801693:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801695:	48 85 c0             	test   %rax,%rax
+  801698:	7f 06                	jg     8016a0 <sys_sigprocmask+0x34>
+}
+  80169a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80169e:	c9                   	leave
+  80169f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016a0:	49 89 c0             	mov    %rax,%r8
+  8016a3:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8016a8:	48 ba b0 32 80 00 00 	movabs $0x8032b0,%rdx
+  8016af:	00 00 00 
+  8016b2:	be 26 00 00 00       	mov    $0x26,%esi
+  8016b7:	48 bf cf 32 80 00 00 	movabs $0x8032cf,%rdi
+  8016be:	00 00 00 
+  8016c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c6:	49 b9 a6 2a 80 00 00 	movabs $0x802aa6,%r9
+  8016cd:	00 00 00 
+  8016d0:	41 ff d1             	call   *%r9
+
+00000000008016d3 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8016d3:	55                   	push   %rbp
+  8016d4:	48 89 e5             	mov    %rsp,%rbp
+  8016d7:	41 54                	push   %r12
+  8016d9:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8016da:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016df:	cd 30                	int    $0x30
+  8016e1:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  8016e4:	85 c0                	test   %eax,%eax
+  8016e6:	78 76                	js     80175e <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  8016e8:	74 7c                	je     801766 <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  8016ea:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8016f0:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8016f7:	00 00 00 
+  8016fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016ff:	89 c2                	mov    %eax,%edx
+  801701:	be 00 00 00 00       	mov    $0x0,%esi
+  801706:	bf 00 00 00 00       	mov    $0x0,%edi
+  80170b:	48 b8 98 11 80 00 00 	movabs $0x801198,%rax
+  801712:	00 00 00 
+  801715:	ff d0                	call   *%rax
+  801717:	85 c0                	test   %eax,%eax
+  801719:	75 7a                	jne    801795 <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  80171b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801722:	00 00 00 
+  801725:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  80172c:	44 89 e7             	mov    %r12d,%edi
+  80172f:	48 b8 06 14 80 00 00 	movabs $0x801406,%rax
+  801736:	00 00 00 
+  801739:	ff d0                	call   *%rax
+  80173b:	85 c0                	test   %eax,%eax
+  80173d:	75 5e                	jne    80179d <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  80173f:	be 02 00 00 00       	mov    $0x2,%esi
+  801744:	44 89 e7             	mov    %r12d,%edi
+  801747:	48 b8 34 13 80 00 00 	movabs $0x801334,%rax
+  80174e:	00 00 00 
+  801751:	ff d0                	call   *%rax
+        return -1;
+  801753:	85 c0                	test   %eax,%eax
+  801755:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80175a:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  80175e:	44 89 e0             	mov    %r12d,%eax
+  801761:	5b                   	pop    %rbx
+  801762:	41 5c                	pop    %r12
+  801764:	5d                   	pop    %rbp
+  801765:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  801766:	48 b8 71 10 80 00 00 	movabs $0x801071,%rax
+  80176d:	00 00 00 
+  801770:	ff d0                	call   *%rax
+  801772:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  801775:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80177c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801783:	00 00 00 
+  801786:	48 01 d0             	add    %rdx,%rax
+  801789:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  801790:	00 00 00 
+        return 0;
+  801793:	eb c9                	jmp    80175e <fork+0x8b>
+        return -1;
+  801795:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80179b:	eb c1                	jmp    80175e <fork+0x8b>
+        return -1;
+  80179d:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8017a3:	eb b9                	jmp    80175e <fork+0x8b>
+
+00000000008017a5 <sfork>:
+
+envid_t
+sfork() {
+  8017a5:	55                   	push   %rbp
+  8017a6:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8017a9:	48 ba dd 32 80 00 00 	movabs $0x8032dd,%rdx
+  8017b0:	00 00 00 
+  8017b3:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8017b8:	48 bf f8 32 80 00 00 	movabs $0x8032f8,%rdi
+  8017bf:	00 00 00 
+  8017c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c7:	48 b9 a6 2a 80 00 00 	movabs $0x802aa6,%rcx
+  8017ce:	00 00 00 
+  8017d1:	ff d1                	call   *%rcx
+
+00000000008017d3 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017d3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017da:	ff ff ff 
+  8017dd:	48 01 f8             	add    %rdi,%rax
+  8017e0:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8017e4:	c3                   	ret
+
+00000000008017e5 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017e5:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017ec:	ff ff ff 
+  8017ef:	48 01 f8             	add    %rdi,%rax
+  8017f2:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8017f6:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8017fc:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801800:	c3                   	ret
+
+0000000000801801 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801801:	55                   	push   %rbp
+  801802:	48 89 e5             	mov    %rsp,%rbp
+  801805:	41 57                	push   %r15
+  801807:	41 56                	push   %r14
+  801809:	41 55                	push   %r13
+  80180b:	41 54                	push   %r12
+  80180d:	53                   	push   %rbx
+  80180e:	48 83 ec 08          	sub    $0x8,%rsp
+  801812:	49 89 ff             	mov    %rdi,%r15
+  801815:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80181a:	49 bd 7f 27 80 00 00 	movabs $0x80277f,%r13
+  801821:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801824:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80182a:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80182d:	48 89 df             	mov    %rbx,%rdi
+  801830:	41 ff d5             	call   *%r13
+  801833:	83 e0 04             	and    $0x4,%eax
+  801836:	74 17                	je     80184f <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801838:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80183f:	4c 39 f3             	cmp    %r14,%rbx
+  801842:	75 e6                	jne    80182a <fd_alloc+0x29>
+  801844:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80184a:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80184f:	4d 89 27             	mov    %r12,(%r15)
+}
+  801852:	48 83 c4 08          	add    $0x8,%rsp
+  801856:	5b                   	pop    %rbx
+  801857:	41 5c                	pop    %r12
+  801859:	41 5d                	pop    %r13
+  80185b:	41 5e                	pop    %r14
+  80185d:	41 5f                	pop    %r15
+  80185f:	5d                   	pop    %rbp
+  801860:	c3                   	ret
+
+0000000000801861 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801861:	83 ff 1f             	cmp    $0x1f,%edi
+  801864:	77 39                	ja     80189f <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801866:	55                   	push   %rbp
+  801867:	48 89 e5             	mov    %rsp,%rbp
+  80186a:	41 54                	push   %r12
+  80186c:	53                   	push   %rbx
+  80186d:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801870:	48 63 df             	movslq %edi,%rbx
+  801873:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80187a:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80187e:	48 89 df             	mov    %rbx,%rdi
+  801881:	48 b8 7f 27 80 00 00 	movabs $0x80277f,%rax
+  801888:	00 00 00 
+  80188b:	ff d0                	call   *%rax
+  80188d:	a8 04                	test   $0x4,%al
+  80188f:	74 14                	je     8018a5 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801891:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801895:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80189a:	5b                   	pop    %rbx
+  80189b:	41 5c                	pop    %r12
+  80189d:	5d                   	pop    %rbp
+  80189e:	c3                   	ret
+        return -E_INVAL;
+  80189f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018a4:	c3                   	ret
+        return -E_INVAL;
+  8018a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018aa:	eb ee                	jmp    80189a <fd_lookup+0x39>
+
+00000000008018ac <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8018ac:	55                   	push   %rbp
+  8018ad:	48 89 e5             	mov    %rsp,%rbp
+  8018b0:	41 54                	push   %r12
+  8018b2:	53                   	push   %rbx
+  8018b3:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8018b6:	48 b8 a0 33 80 00 00 	movabs $0x8033a0,%rax
+  8018bd:	00 00 00 
+  8018c0:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8018c7:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8018ca:	39 3b                	cmp    %edi,(%rbx)
+  8018cc:	74 47                	je     801915 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8018ce:	48 83 c0 08          	add    $0x8,%rax
+  8018d2:	48 8b 18             	mov    (%rax),%rbx
+  8018d5:	48 85 db             	test   %rbx,%rbx
+  8018d8:	75 f0                	jne    8018ca <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018da:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8018e1:	00 00 00 
+  8018e4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8018ea:	89 fa                	mov    %edi,%edx
+  8018ec:	48 bf 08 33 80 00 00 	movabs $0x803308,%rdi
+  8018f3:	00 00 00 
+  8018f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018fb:	48 b9 5c 02 80 00 00 	movabs $0x80025c,%rcx
+  801902:	00 00 00 
+  801905:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801907:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80190c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801910:	5b                   	pop    %rbx
+  801911:	41 5c                	pop    %r12
+  801913:	5d                   	pop    %rbp
+  801914:	c3                   	ret
+            return 0;
+  801915:	b8 00 00 00 00       	mov    $0x0,%eax
+  80191a:	eb f0                	jmp    80190c <dev_lookup+0x60>
+
+000000000080191c <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80191c:	55                   	push   %rbp
+  80191d:	48 89 e5             	mov    %rsp,%rbp
+  801920:	41 55                	push   %r13
+  801922:	41 54                	push   %r12
+  801924:	53                   	push   %rbx
+  801925:	48 83 ec 18          	sub    $0x18,%rsp
+  801929:	48 89 fb             	mov    %rdi,%rbx
+  80192c:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80192f:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801936:	ff ff ff 
+  801939:	48 01 df             	add    %rbx,%rdi
+  80193c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801940:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801944:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  80194b:	00 00 00 
+  80194e:	ff d0                	call   *%rax
+  801950:	41 89 c5             	mov    %eax,%r13d
+  801953:	85 c0                	test   %eax,%eax
+  801955:	78 06                	js     80195d <fd_close+0x41>
+  801957:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80195b:	74 1a                	je     801977 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80195d:	45 84 e4             	test   %r12b,%r12b
+  801960:	b8 00 00 00 00       	mov    $0x0,%eax
+  801965:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801969:	44 89 e8             	mov    %r13d,%eax
+  80196c:	48 83 c4 18          	add    $0x18,%rsp
+  801970:	5b                   	pop    %rbx
+  801971:	41 5c                	pop    %r12
+  801973:	41 5d                	pop    %r13
+  801975:	5d                   	pop    %rbp
+  801976:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801977:	8b 3b                	mov    (%rbx),%edi
+  801979:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80197d:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  801984:	00 00 00 
+  801987:	ff d0                	call   *%rax
+  801989:	41 89 c5             	mov    %eax,%r13d
+  80198c:	85 c0                	test   %eax,%eax
+  80198e:	78 1b                	js     8019ab <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801990:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801994:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801998:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80199e:	48 85 c0             	test   %rax,%rax
+  8019a1:	74 08                	je     8019ab <fd_close+0x8f>
+  8019a3:	48 89 df             	mov    %rbx,%rdi
+  8019a6:	ff d0                	call   *%rax
+  8019a8:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8019ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019b0:	48 89 de             	mov    %rbx,%rsi
+  8019b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019b8:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  8019bf:	00 00 00 
+  8019c2:	ff d0                	call   *%rax
+    return res;
+  8019c4:	eb a3                	jmp    801969 <fd_close+0x4d>
+
+00000000008019c6 <close>:
+
+int
+close(int fdnum) {
+  8019c6:	55                   	push   %rbp
+  8019c7:	48 89 e5             	mov    %rsp,%rbp
+  8019ca:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8019ce:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8019d2:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  8019d9:	00 00 00 
+  8019dc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8019de:	85 c0                	test   %eax,%eax
+  8019e0:	78 15                	js     8019f7 <close+0x31>
+
+    return fd_close(fd, 1);
+  8019e2:	be 01 00 00 00       	mov    $0x1,%esi
+  8019e7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8019eb:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  8019f2:	00 00 00 
+  8019f5:	ff d0                	call   *%rax
+}
+  8019f7:	c9                   	leave
+  8019f8:	c3                   	ret
+
+00000000008019f9 <close_all>:
+
+void
+close_all(void) {
+  8019f9:	55                   	push   %rbp
+  8019fa:	48 89 e5             	mov    %rsp,%rbp
+  8019fd:	41 54                	push   %r12
+  8019ff:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a00:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a05:	49 bc c6 19 80 00 00 	movabs $0x8019c6,%r12
+  801a0c:	00 00 00 
+  801a0f:	89 df                	mov    %ebx,%edi
+  801a11:	41 ff d4             	call   *%r12
+  801a14:	83 c3 01             	add    $0x1,%ebx
+  801a17:	83 fb 20             	cmp    $0x20,%ebx
+  801a1a:	75 f3                	jne    801a0f <close_all+0x16>
+}
+  801a1c:	5b                   	pop    %rbx
+  801a1d:	41 5c                	pop    %r12
+  801a1f:	5d                   	pop    %rbp
+  801a20:	c3                   	ret
+
+0000000000801a21 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a21:	55                   	push   %rbp
+  801a22:	48 89 e5             	mov    %rsp,%rbp
+  801a25:	41 57                	push   %r15
+  801a27:	41 56                	push   %r14
+  801a29:	41 55                	push   %r13
+  801a2b:	41 54                	push   %r12
+  801a2d:	53                   	push   %rbx
+  801a2e:	48 83 ec 18          	sub    $0x18,%rsp
+  801a32:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a35:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a39:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  801a40:	00 00 00 
+  801a43:	ff d0                	call   *%rax
+  801a45:	89 c3                	mov    %eax,%ebx
+  801a47:	85 c0                	test   %eax,%eax
+  801a49:	0f 88 b8 00 00 00    	js     801b07 <dup+0xe6>
+    close(newfdnum);
+  801a4f:	44 89 e7             	mov    %r12d,%edi
+  801a52:	48 b8 c6 19 80 00 00 	movabs $0x8019c6,%rax
+  801a59:	00 00 00 
+  801a5c:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801a5e:	4d 63 ec             	movslq %r12d,%r13
+  801a61:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801a68:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801a6c:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801a70:	4c 89 ff             	mov    %r15,%rdi
+  801a73:	49 be e5 17 80 00 00 	movabs $0x8017e5,%r14
+  801a7a:	00 00 00 
+  801a7d:	41 ff d6             	call   *%r14
+  801a80:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801a83:	4c 89 ef             	mov    %r13,%rdi
+  801a86:	41 ff d6             	call   *%r14
+  801a89:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801a8c:	48 89 df             	mov    %rbx,%rdi
+  801a8f:	48 b8 7f 27 80 00 00 	movabs $0x80277f,%rax
+  801a96:	00 00 00 
+  801a99:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801a9b:	a8 04                	test   $0x4,%al
+  801a9d:	74 2b                	je     801aca <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801a9f:	41 89 c1             	mov    %eax,%r9d
+  801aa2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801aa8:	4c 89 f1             	mov    %r14,%rcx
+  801aab:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab0:	48 89 de             	mov    %rbx,%rsi
+  801ab3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ab8:	48 b8 98 11 80 00 00 	movabs $0x801198,%rax
+  801abf:	00 00 00 
+  801ac2:	ff d0                	call   *%rax
+  801ac4:	89 c3                	mov    %eax,%ebx
+  801ac6:	85 c0                	test   %eax,%eax
+  801ac8:	78 4e                	js     801b18 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801aca:	4c 89 ff             	mov    %r15,%rdi
+  801acd:	48 b8 7f 27 80 00 00 	movabs $0x80277f,%rax
+  801ad4:	00 00 00 
+  801ad7:	ff d0                	call   *%rax
+  801ad9:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801adc:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ae2:	4c 89 e9             	mov    %r13,%rcx
+  801ae5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aea:	4c 89 fe             	mov    %r15,%rsi
+  801aed:	bf 00 00 00 00       	mov    $0x0,%edi
+  801af2:	48 b8 98 11 80 00 00 	movabs $0x801198,%rax
+  801af9:	00 00 00 
+  801afc:	ff d0                	call   *%rax
+  801afe:	89 c3                	mov    %eax,%ebx
+  801b00:	85 c0                	test   %eax,%eax
+  801b02:	78 14                	js     801b18 <dup+0xf7>
+
+    return newfdnum;
+  801b04:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801b07:	89 d8                	mov    %ebx,%eax
+  801b09:	48 83 c4 18          	add    $0x18,%rsp
+  801b0d:	5b                   	pop    %rbx
+  801b0e:	41 5c                	pop    %r12
+  801b10:	41 5d                	pop    %r13
+  801b12:	41 5e                	pop    %r14
+  801b14:	41 5f                	pop    %r15
+  801b16:	5d                   	pop    %rbp
+  801b17:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b18:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b1d:	4c 89 ee             	mov    %r13,%rsi
+  801b20:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b25:	49 bc fd 11 80 00 00 	movabs $0x8011fd,%r12
+  801b2c:	00 00 00 
+  801b2f:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801b32:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b37:	4c 89 f6             	mov    %r14,%rsi
+  801b3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b3f:	41 ff d4             	call   *%r12
+    return res;
+  801b42:	eb c3                	jmp    801b07 <dup+0xe6>
+
+0000000000801b44 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801b44:	55                   	push   %rbp
+  801b45:	48 89 e5             	mov    %rsp,%rbp
+  801b48:	41 56                	push   %r14
+  801b4a:	41 55                	push   %r13
+  801b4c:	41 54                	push   %r12
+  801b4e:	53                   	push   %rbx
+  801b4f:	48 83 ec 10          	sub    $0x10,%rsp
+  801b53:	89 fb                	mov    %edi,%ebx
+  801b55:	49 89 f4             	mov    %rsi,%r12
+  801b58:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b5b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b5f:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  801b66:	00 00 00 
+  801b69:	ff d0                	call   *%rax
+  801b6b:	85 c0                	test   %eax,%eax
+  801b6d:	78 4c                	js     801bbb <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b6f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b73:	41 8b 3e             	mov    (%r14),%edi
+  801b76:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b7a:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  801b81:	00 00 00 
+  801b84:	ff d0                	call   *%rax
+  801b86:	85 c0                	test   %eax,%eax
+  801b88:	78 35                	js     801bbf <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b8a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801b8e:	83 e0 03             	and    $0x3,%eax
+  801b91:	83 f8 01             	cmp    $0x1,%eax
+  801b94:	74 2d                	je     801bc3 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b96:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b9a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801b9e:	48 85 c0             	test   %rax,%rax
+  801ba1:	74 56                	je     801bf9 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ba3:	4c 89 ea             	mov    %r13,%rdx
+  801ba6:	4c 89 e6             	mov    %r12,%rsi
+  801ba9:	4c 89 f7             	mov    %r14,%rdi
+  801bac:	ff d0                	call   *%rax
+}
+  801bae:	48 83 c4 10          	add    $0x10,%rsp
+  801bb2:	5b                   	pop    %rbx
+  801bb3:	41 5c                	pop    %r12
+  801bb5:	41 5d                	pop    %r13
+  801bb7:	41 5e                	pop    %r14
+  801bb9:	5d                   	pop    %rbp
+  801bba:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bbb:	48 98                	cltq
+  801bbd:	eb ef                	jmp    801bae <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bbf:	48 98                	cltq
+  801bc1:	eb eb                	jmp    801bae <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bc3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801bca:	00 00 00 
+  801bcd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bd3:	89 da                	mov    %ebx,%edx
+  801bd5:	48 bf 49 33 80 00 00 	movabs $0x803349,%rdi
+  801bdc:	00 00 00 
+  801bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be4:	48 b9 5c 02 80 00 00 	movabs $0x80025c,%rcx
+  801beb:	00 00 00 
+  801bee:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801bf0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801bf7:	eb b5                	jmp    801bae <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801bf9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c00:	eb ac                	jmp    801bae <read+0x6a>
+
+0000000000801c02 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c02:	55                   	push   %rbp
+  801c03:	48 89 e5             	mov    %rsp,%rbp
+  801c06:	41 57                	push   %r15
+  801c08:	41 56                	push   %r14
+  801c0a:	41 55                	push   %r13
+  801c0c:	41 54                	push   %r12
+  801c0e:	53                   	push   %rbx
+  801c0f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c13:	48 85 d2             	test   %rdx,%rdx
+  801c16:	74 54                	je     801c6c <readn+0x6a>
+  801c18:	41 89 fd             	mov    %edi,%r13d
+  801c1b:	49 89 f6             	mov    %rsi,%r14
+  801c1e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801c21:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801c26:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801c2b:	49 bf 44 1b 80 00 00 	movabs $0x801b44,%r15
+  801c32:	00 00 00 
+  801c35:	4c 89 e2             	mov    %r12,%rdx
+  801c38:	48 29 f2             	sub    %rsi,%rdx
+  801c3b:	4c 01 f6             	add    %r14,%rsi
+  801c3e:	44 89 ef             	mov    %r13d,%edi
+  801c41:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801c44:	85 c0                	test   %eax,%eax
+  801c46:	78 20                	js     801c68 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801c48:	01 c3                	add    %eax,%ebx
+  801c4a:	85 c0                	test   %eax,%eax
+  801c4c:	74 08                	je     801c56 <readn+0x54>
+  801c4e:	48 63 f3             	movslq %ebx,%rsi
+  801c51:	4c 39 e6             	cmp    %r12,%rsi
+  801c54:	72 df                	jb     801c35 <readn+0x33>
+    }
+    return res;
+  801c56:	48 63 c3             	movslq %ebx,%rax
+}
+  801c59:	48 83 c4 08          	add    $0x8,%rsp
+  801c5d:	5b                   	pop    %rbx
+  801c5e:	41 5c                	pop    %r12
+  801c60:	41 5d                	pop    %r13
+  801c62:	41 5e                	pop    %r14
+  801c64:	41 5f                	pop    %r15
+  801c66:	5d                   	pop    %rbp
+  801c67:	c3                   	ret
+        if (inc < 0) return inc;
+  801c68:	48 98                	cltq
+  801c6a:	eb ed                	jmp    801c59 <readn+0x57>
+    int inc = 1, res = 0;
+  801c6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c71:	eb e3                	jmp    801c56 <readn+0x54>
+
+0000000000801c73 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801c73:	55                   	push   %rbp
+  801c74:	48 89 e5             	mov    %rsp,%rbp
+  801c77:	41 56                	push   %r14
+  801c79:	41 55                	push   %r13
+  801c7b:	41 54                	push   %r12
+  801c7d:	53                   	push   %rbx
+  801c7e:	48 83 ec 10          	sub    $0x10,%rsp
+  801c82:	89 fb                	mov    %edi,%ebx
+  801c84:	49 89 f4             	mov    %rsi,%r12
+  801c87:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c8a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c8e:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  801c95:	00 00 00 
+  801c98:	ff d0                	call   *%rax
+  801c9a:	85 c0                	test   %eax,%eax
+  801c9c:	78 47                	js     801ce5 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c9e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ca2:	41 8b 3e             	mov    (%r14),%edi
+  801ca5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ca9:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  801cb0:	00 00 00 
+  801cb3:	ff d0                	call   *%rax
+  801cb5:	85 c0                	test   %eax,%eax
+  801cb7:	78 30                	js     801ce9 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cb9:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801cbe:	74 2d                	je     801ced <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801cc0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cc4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801cc8:	48 85 c0             	test   %rax,%rax
+  801ccb:	74 56                	je     801d23 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801ccd:	4c 89 ea             	mov    %r13,%rdx
+  801cd0:	4c 89 e6             	mov    %r12,%rsi
+  801cd3:	4c 89 f7             	mov    %r14,%rdi
+  801cd6:	ff d0                	call   *%rax
+}
+  801cd8:	48 83 c4 10          	add    $0x10,%rsp
+  801cdc:	5b                   	pop    %rbx
+  801cdd:	41 5c                	pop    %r12
+  801cdf:	41 5d                	pop    %r13
+  801ce1:	41 5e                	pop    %r14
+  801ce3:	5d                   	pop    %rbp
+  801ce4:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ce5:	48 98                	cltq
+  801ce7:	eb ef                	jmp    801cd8 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ce9:	48 98                	cltq
+  801ceb:	eb eb                	jmp    801cd8 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ced:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801cf4:	00 00 00 
+  801cf7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cfd:	89 da                	mov    %ebx,%edx
+  801cff:	48 bf 65 33 80 00 00 	movabs $0x803365,%rdi
+  801d06:	00 00 00 
+  801d09:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d0e:	48 b9 5c 02 80 00 00 	movabs $0x80025c,%rcx
+  801d15:	00 00 00 
+  801d18:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d1a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d21:	eb b5                	jmp    801cd8 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d23:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d2a:	eb ac                	jmp    801cd8 <write+0x65>
+
+0000000000801d2c <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801d2c:	55                   	push   %rbp
+  801d2d:	48 89 e5             	mov    %rsp,%rbp
+  801d30:	53                   	push   %rbx
+  801d31:	48 83 ec 18          	sub    $0x18,%rsp
+  801d35:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d37:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d3b:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  801d42:	00 00 00 
+  801d45:	ff d0                	call   *%rax
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	78 0c                	js     801d57 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801d4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d4f:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801d52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d57:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d5b:	c9                   	leave
+  801d5c:	c3                   	ret
+
+0000000000801d5d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801d5d:	55                   	push   %rbp
+  801d5e:	48 89 e5             	mov    %rsp,%rbp
+  801d61:	41 55                	push   %r13
+  801d63:	41 54                	push   %r12
+  801d65:	53                   	push   %rbx
+  801d66:	48 83 ec 18          	sub    $0x18,%rsp
+  801d6a:	89 fb                	mov    %edi,%ebx
+  801d6c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d6f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d73:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  801d7a:	00 00 00 
+  801d7d:	ff d0                	call   *%rax
+  801d7f:	85 c0                	test   %eax,%eax
+  801d81:	78 38                	js     801dbb <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d83:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801d87:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801d8b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d8f:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  801d96:	00 00 00 
+  801d99:	ff d0                	call   *%rax
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	78 1c                	js     801dbb <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d9f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801da4:	74 20                	je     801dc6 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801da6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801daa:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801dae:	48 85 c0             	test   %rax,%rax
+  801db1:	74 47                	je     801dfa <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801db3:	44 89 e6             	mov    %r12d,%esi
+  801db6:	4c 89 ef             	mov    %r13,%rdi
+  801db9:	ff d0                	call   *%rax
+}
+  801dbb:	48 83 c4 18          	add    $0x18,%rsp
+  801dbf:	5b                   	pop    %rbx
+  801dc0:	41 5c                	pop    %r12
+  801dc2:	41 5d                	pop    %r13
+  801dc4:	5d                   	pop    %rbp
+  801dc5:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801dc6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801dcd:	00 00 00 
+  801dd0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dd6:	89 da                	mov    %ebx,%edx
+  801dd8:	48 bf 28 33 80 00 00 	movabs $0x803328,%rdi
+  801ddf:	00 00 00 
+  801de2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de7:	48 b9 5c 02 80 00 00 	movabs $0x80025c,%rcx
+  801dee:	00 00 00 
+  801df1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801df3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801df8:	eb c1                	jmp    801dbb <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801dfa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801dff:	eb ba                	jmp    801dbb <ftruncate+0x5e>
+
+0000000000801e01 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e01:	55                   	push   %rbp
+  801e02:	48 89 e5             	mov    %rsp,%rbp
+  801e05:	41 54                	push   %r12
+  801e07:	53                   	push   %rbx
+  801e08:	48 83 ec 10          	sub    $0x10,%rsp
+  801e0c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e0f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e13:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  801e1a:	00 00 00 
+  801e1d:	ff d0                	call   *%rax
+  801e1f:	85 c0                	test   %eax,%eax
+  801e21:	78 4e                	js     801e71 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e23:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e27:	41 8b 3c 24          	mov    (%r12),%edi
+  801e2b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e2f:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  801e36:	00 00 00 
+  801e39:	ff d0                	call   *%rax
+  801e3b:	85 c0                	test   %eax,%eax
+  801e3d:	78 32                	js     801e71 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e3f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e43:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801e48:	74 30                	je     801e7a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801e4a:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801e4d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801e54:	00 00 00 
+    stat->st_isdir = 0;
+  801e57:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801e5e:	00 00 00 
+    stat->st_dev = dev;
+  801e61:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801e68:	48 89 de             	mov    %rbx,%rsi
+  801e6b:	4c 89 e7             	mov    %r12,%rdi
+  801e6e:	ff 50 28             	call   *0x28(%rax)
+}
+  801e71:	48 83 c4 10          	add    $0x10,%rsp
+  801e75:	5b                   	pop    %rbx
+  801e76:	41 5c                	pop    %r12
+  801e78:	5d                   	pop    %rbp
+  801e79:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e7a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e7f:	eb f0                	jmp    801e71 <fstat+0x70>
+
+0000000000801e81 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801e81:	55                   	push   %rbp
+  801e82:	48 89 e5             	mov    %rsp,%rbp
+  801e85:	41 54                	push   %r12
+  801e87:	53                   	push   %rbx
+  801e88:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801e8b:	be 00 00 00 00       	mov    $0x0,%esi
+  801e90:	48 b8 02 21 80 00 00 	movabs $0x802102,%rax
+  801e97:	00 00 00 
+  801e9a:	ff d0                	call   *%rax
+  801e9c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801e9e:	85 c0                	test   %eax,%eax
+  801ea0:	78 25                	js     801ec7 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801ea2:	4c 89 e6             	mov    %r12,%rsi
+  801ea5:	89 c7                	mov    %eax,%edi
+  801ea7:	48 b8 01 1e 80 00 00 	movabs $0x801e01,%rax
+  801eae:	00 00 00 
+  801eb1:	ff d0                	call   *%rax
+  801eb3:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801eb6:	89 df                	mov    %ebx,%edi
+  801eb8:	48 b8 c6 19 80 00 00 	movabs $0x8019c6,%rax
+  801ebf:	00 00 00 
+  801ec2:	ff d0                	call   *%rax
+
+    return res;
+  801ec4:	44 89 e3             	mov    %r12d,%ebx
+}
+  801ec7:	89 d8                	mov    %ebx,%eax
+  801ec9:	5b                   	pop    %rbx
+  801eca:	41 5c                	pop    %r12
+  801ecc:	5d                   	pop    %rbp
+  801ecd:	c3                   	ret
+
+0000000000801ece <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801ece:	55                   	push   %rbp
+  801ecf:	48 89 e5             	mov    %rsp,%rbp
+  801ed2:	41 54                	push   %r12
+  801ed4:	53                   	push   %rbx
+  801ed5:	48 83 ec 10          	sub    $0x10,%rsp
+  801ed9:	41 89 fc             	mov    %edi,%r12d
+  801edc:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801edf:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801ee6:	00 00 00 
+  801ee9:	83 38 00             	cmpl   $0x0,(%rax)
+  801eec:	74 5e                	je     801f4c <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801eee:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801ef4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801ef9:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801f00:	00 00 00 
+  801f03:	44 89 e6             	mov    %r12d,%esi
+  801f06:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801f0d:	00 00 00 
+  801f10:	8b 38                	mov    (%rax),%edi
+  801f12:	48 b8 de 2b 80 00 00 	movabs $0x802bde,%rax
+  801f19:	00 00 00 
+  801f1c:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801f1e:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801f25:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801f26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f2b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801f2f:	48 89 de             	mov    %rbx,%rsi
+  801f32:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f37:	48 b8 49 2b 80 00 00 	movabs $0x802b49,%rax
+  801f3e:	00 00 00 
+  801f41:	ff d0                	call   *%rax
+}
+  801f43:	48 83 c4 10          	add    $0x10,%rsp
+  801f47:	5b                   	pop    %rbx
+  801f48:	41 5c                	pop    %r12
+  801f4a:	5d                   	pop    %rbp
+  801f4b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f4c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f51:	48 b8 7e 2c 80 00 00 	movabs $0x802c7e,%rax
+  801f58:	00 00 00 
+  801f5b:	ff d0                	call   *%rax
+  801f5d:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801f64:	00 00 
+  801f66:	eb 86                	jmp    801eee <fsipc+0x20>
+
+0000000000801f68 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801f68:	55                   	push   %rbp
+  801f69:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f6c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801f73:	00 00 00 
+  801f76:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801f79:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801f7b:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801f7e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f83:	bf 02 00 00 00       	mov    $0x2,%edi
+  801f88:	48 b8 ce 1e 80 00 00 	movabs $0x801ece,%rax
+  801f8f:	00 00 00 
+  801f92:	ff d0                	call   *%rax
+}
+  801f94:	5d                   	pop    %rbp
+  801f95:	c3                   	ret
+
+0000000000801f96 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801f96:	55                   	push   %rbp
+  801f97:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f9a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801f9d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801fa4:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801fa6:	be 00 00 00 00       	mov    $0x0,%esi
+  801fab:	bf 06 00 00 00       	mov    $0x6,%edi
+  801fb0:	48 b8 ce 1e 80 00 00 	movabs $0x801ece,%rax
+  801fb7:	00 00 00 
+  801fba:	ff d0                	call   *%rax
+}
+  801fbc:	5d                   	pop    %rbp
+  801fbd:	c3                   	ret
+
+0000000000801fbe <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801fbe:	55                   	push   %rbp
+  801fbf:	48 89 e5             	mov    %rsp,%rbp
+  801fc2:	41 54                	push   %r12
+  801fc4:	53                   	push   %rbx
+  801fc5:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801fc8:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801fcb:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801fd2:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801fd4:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd9:	bf 05 00 00 00       	mov    $0x5,%edi
+  801fde:	48 b8 ce 1e 80 00 00 	movabs $0x801ece,%rax
+  801fe5:	00 00 00 
+  801fe8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801fea:	85 c0                	test   %eax,%eax
+  801fec:	78 3d                	js     80202b <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801fee:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801ff5:	00 00 00 
+  801ff8:	4c 89 e6             	mov    %r12,%rsi
+  801ffb:	48 89 df             	mov    %rbx,%rdi
+  801ffe:	48 b8 81 0b 80 00 00 	movabs $0x800b81,%rax
+  802005:	00 00 00 
+  802008:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80200a:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802011:	00 
+  802012:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802018:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80201f:	00 
+  802020:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802026:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80202b:	5b                   	pop    %rbx
+  80202c:	41 5c                	pop    %r12
+  80202e:	5d                   	pop    %rbp
+  80202f:	c3                   	ret
+
+0000000000802030 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802030:	55                   	push   %rbp
+  802031:	48 89 e5             	mov    %rsp,%rbp
+  802034:	41 54                	push   %r12
+  802036:	53                   	push   %rbx
+  802037:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  80203a:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80203f:	48 39 c2             	cmp    %rax,%rdx
+  802042:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802046:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802049:	48 89 c2             	mov    %rax,%rdx
+  80204c:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802053:	00 00 00 
+  802056:	48 b8 e2 0d 80 00 00 	movabs $0x800de2,%rax
+  80205d:	00 00 00 
+  802060:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802062:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802069:	00 00 00 
+  80206c:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802071:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802073:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  802077:	be 00 00 00 00       	mov    $0x0,%esi
+  80207c:	bf 04 00 00 00       	mov    $0x4,%edi
+  802081:	48 b8 ce 1e 80 00 00 	movabs $0x801ece,%rax
+  802088:	00 00 00 
+  80208b:	ff d0                	call   *%rax
+  80208d:	48 98                	cltq
+}
+  80208f:	5b                   	pop    %rbx
+  802090:	41 5c                	pop    %r12
+  802092:	5d                   	pop    %rbp
+  802093:	c3                   	ret
+
+0000000000802094 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802094:	55                   	push   %rbp
+  802095:	48 89 e5             	mov    %rsp,%rbp
+  802098:	41 54                	push   %r12
+  80209a:	53                   	push   %rbx
+  80209b:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80209e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8020a5:	00 00 00 
+  8020a8:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8020ab:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8020ad:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020b2:	48 39 ca             	cmp    %rcx,%rdx
+  8020b5:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8020b9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8020bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8020c2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020c7:	48 b8 ce 1e 80 00 00 	movabs $0x801ece,%rax
+  8020ce:	00 00 00 
+  8020d1:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  8020d3:	85 c0                	test   %eax,%eax
+  8020d5:	78 27                	js     8020fe <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  8020d7:	48 63 d8             	movslq %eax,%rbx
+  8020da:	48 89 da             	mov    %rbx,%rdx
+  8020dd:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8020e4:	00 00 00 
+  8020e7:	4c 89 e7             	mov    %r12,%rdi
+  8020ea:	48 b8 e2 0d 80 00 00 	movabs $0x800de2,%rax
+  8020f1:	00 00 00 
+  8020f4:	ff d0                	call   *%rax
+    return bytes_read;
+  8020f6:	48 89 d8             	mov    %rbx,%rax
+}
+  8020f9:	5b                   	pop    %rbx
+  8020fa:	41 5c                	pop    %r12
+  8020fc:	5d                   	pop    %rbp
+  8020fd:	c3                   	ret
+        return bytes_read;
+  8020fe:	48 98                	cltq
+  802100:	eb f7                	jmp    8020f9 <devfile_read+0x65>
+
+0000000000802102 <open>:
+open(const char *path, int mode) {
+  802102:	55                   	push   %rbp
+  802103:	48 89 e5             	mov    %rsp,%rbp
+  802106:	41 55                	push   %r13
+  802108:	41 54                	push   %r12
+  80210a:	53                   	push   %rbx
+  80210b:	48 83 ec 18          	sub    $0x18,%rsp
+  80210f:	49 89 fc             	mov    %rdi,%r12
+  802112:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802115:	48 b8 43 0b 80 00 00 	movabs $0x800b43,%rax
+  80211c:	00 00 00 
+  80211f:	ff d0                	call   *%rax
+  802121:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802127:	0f 87 8a 00 00 00    	ja     8021b7 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80212d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802131:	48 b8 01 18 80 00 00 	movabs $0x801801,%rax
+  802138:	00 00 00 
+  80213b:	ff d0                	call   *%rax
+  80213d:	89 c3                	mov    %eax,%ebx
+  80213f:	85 c0                	test   %eax,%eax
+  802141:	78 50                	js     802193 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802143:	4c 89 e6             	mov    %r12,%rsi
+  802146:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80214d:	00 00 00 
+  802150:	48 89 df             	mov    %rbx,%rdi
+  802153:	48 b8 81 0b 80 00 00 	movabs $0x800b81,%rax
+  80215a:	00 00 00 
+  80215d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80215f:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802166:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80216a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80216f:	48 b8 ce 1e 80 00 00 	movabs $0x801ece,%rax
+  802176:	00 00 00 
+  802179:	ff d0                	call   *%rax
+  80217b:	89 c3                	mov    %eax,%ebx
+  80217d:	85 c0                	test   %eax,%eax
+  80217f:	78 1f                	js     8021a0 <open+0x9e>
+    return fd2num(fd);
+  802181:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802185:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  80218c:	00 00 00 
+  80218f:	ff d0                	call   *%rax
+  802191:	89 c3                	mov    %eax,%ebx
+}
+  802193:	89 d8                	mov    %ebx,%eax
+  802195:	48 83 c4 18          	add    $0x18,%rsp
+  802199:	5b                   	pop    %rbx
+  80219a:	41 5c                	pop    %r12
+  80219c:	41 5d                	pop    %r13
+  80219e:	5d                   	pop    %rbp
+  80219f:	c3                   	ret
+        fd_close(fd, 0);
+  8021a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8021a9:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  8021b0:	00 00 00 
+  8021b3:	ff d0                	call   *%rax
+        return res;
+  8021b5:	eb dc                	jmp    802193 <open+0x91>
+        return -E_BAD_PATH;
+  8021b7:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8021bc:	eb d5                	jmp    802193 <open+0x91>
+
+00000000008021be <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8021be:	55                   	push   %rbp
+  8021bf:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8021c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c7:	bf 08 00 00 00       	mov    $0x8,%edi
+  8021cc:	48 b8 ce 1e 80 00 00 	movabs $0x801ece,%rax
+  8021d3:	00 00 00 
+  8021d6:	ff d0                	call   *%rax
+}
+  8021d8:	5d                   	pop    %rbp
+  8021d9:	c3                   	ret
+
+00000000008021da <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8021da:	55                   	push   %rbp
+  8021db:	48 89 e5             	mov    %rsp,%rbp
+  8021de:	41 54                	push   %r12
+  8021e0:	53                   	push   %rbx
+  8021e1:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8021e4:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  8021eb:	00 00 00 
+  8021ee:	ff d0                	call   *%rax
+  8021f0:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8021f3:	48 be c0 33 80 00 00 	movabs $0x8033c0,%rsi
+  8021fa:	00 00 00 
+  8021fd:	48 89 df             	mov    %rbx,%rdi
+  802200:	48 b8 81 0b 80 00 00 	movabs $0x800b81,%rax
+  802207:	00 00 00 
+  80220a:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80220c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802211:	41 2b 04 24          	sub    (%r12),%eax
+  802215:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80221b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802222:	00 00 00 
+    stat->st_dev = &devpipe;
+  802225:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80222c:	00 00 00 
+  80222f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223b:	5b                   	pop    %rbx
+  80223c:	41 5c                	pop    %r12
+  80223e:	5d                   	pop    %rbp
+  80223f:	c3                   	ret
+
+0000000000802240 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802240:	55                   	push   %rbp
+  802241:	48 89 e5             	mov    %rsp,%rbp
+  802244:	41 54                	push   %r12
+  802246:	53                   	push   %rbx
+  802247:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80224a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80224f:	48 89 fe             	mov    %rdi,%rsi
+  802252:	bf 00 00 00 00       	mov    $0x0,%edi
+  802257:	49 bc fd 11 80 00 00 	movabs $0x8011fd,%r12
+  80225e:	00 00 00 
+  802261:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802264:	48 89 df             	mov    %rbx,%rdi
+  802267:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  80226e:	00 00 00 
+  802271:	ff d0                	call   *%rax
+  802273:	48 89 c6             	mov    %rax,%rsi
+  802276:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80227b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802280:	41 ff d4             	call   *%r12
+}
+  802283:	5b                   	pop    %rbx
+  802284:	41 5c                	pop    %r12
+  802286:	5d                   	pop    %rbp
+  802287:	c3                   	ret
+
+0000000000802288 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802288:	55                   	push   %rbp
+  802289:	48 89 e5             	mov    %rsp,%rbp
+  80228c:	41 57                	push   %r15
+  80228e:	41 56                	push   %r14
+  802290:	41 55                	push   %r13
+  802292:	41 54                	push   %r12
+  802294:	53                   	push   %rbx
+  802295:	48 83 ec 18          	sub    $0x18,%rsp
+  802299:	49 89 fc             	mov    %rdi,%r12
+  80229c:	49 89 f5             	mov    %rsi,%r13
+  80229f:	49 89 d7             	mov    %rdx,%r15
+  8022a2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8022a6:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  8022ad:	00 00 00 
+  8022b0:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8022b2:	4d 85 ff             	test   %r15,%r15
+  8022b5:	0f 84 af 00 00 00    	je     80236a <devpipe_write+0xe2>
+  8022bb:	48 89 c3             	mov    %rax,%rbx
+  8022be:	4c 89 f8             	mov    %r15,%rax
+  8022c1:	4d 89 ef             	mov    %r13,%r15
+  8022c4:	4c 01 e8             	add    %r13,%rax
+  8022c7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8022cb:	49 bd 05 11 80 00 00 	movabs $0x801105,%r13
+  8022d2:	00 00 00 
+            sys_yield();
+  8022d5:	49 be a2 10 80 00 00 	movabs $0x8010a2,%r14
+  8022dc:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8022df:	8b 73 04             	mov    0x4(%rbx),%esi
+  8022e2:	48 63 ce             	movslq %esi,%rcx
+  8022e5:	48 63 03             	movslq (%rbx),%rax
+  8022e8:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8022ee:	48 39 c1             	cmp    %rax,%rcx
+  8022f1:	72 2e                	jb     802321 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8022f3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022f8:	48 89 da             	mov    %rbx,%rdx
+  8022fb:	be 00 10 00 00       	mov    $0x1000,%esi
+  802300:	4c 89 e7             	mov    %r12,%rdi
+  802303:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802306:	85 c0                	test   %eax,%eax
+  802308:	74 66                	je     802370 <devpipe_write+0xe8>
+            sys_yield();
+  80230a:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80230d:	8b 73 04             	mov    0x4(%rbx),%esi
+  802310:	48 63 ce             	movslq %esi,%rcx
+  802313:	48 63 03             	movslq (%rbx),%rax
+  802316:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80231c:	48 39 c1             	cmp    %rax,%rcx
+  80231f:	73 d2                	jae    8022f3 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802321:	41 0f b6 3f          	movzbl (%r15),%edi
+  802325:	48 89 ca             	mov    %rcx,%rdx
+  802328:	48 c1 ea 03          	shr    $0x3,%rdx
+  80232c:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802333:	08 10 20 
+  802336:	48 f7 e2             	mul    %rdx
+  802339:	48 c1 ea 06          	shr    $0x6,%rdx
+  80233d:	48 89 d0             	mov    %rdx,%rax
+  802340:	48 c1 e0 09          	shl    $0x9,%rax
+  802344:	48 29 d0             	sub    %rdx,%rax
+  802347:	48 c1 e0 03          	shl    $0x3,%rax
+  80234b:	48 29 c1             	sub    %rax,%rcx
+  80234e:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802353:	83 c6 01             	add    $0x1,%esi
+  802356:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802359:	49 83 c7 01          	add    $0x1,%r15
+  80235d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802361:	49 39 c7             	cmp    %rax,%r15
+  802364:	0f 85 75 ff ff ff    	jne    8022df <devpipe_write+0x57>
+    return n;
+  80236a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80236e:	eb 05                	jmp    802375 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802370:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802375:	48 83 c4 18          	add    $0x18,%rsp
+  802379:	5b                   	pop    %rbx
+  80237a:	41 5c                	pop    %r12
+  80237c:	41 5d                	pop    %r13
+  80237e:	41 5e                	pop    %r14
+  802380:	41 5f                	pop    %r15
+  802382:	5d                   	pop    %rbp
+  802383:	c3                   	ret
+
+0000000000802384 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802384:	55                   	push   %rbp
+  802385:	48 89 e5             	mov    %rsp,%rbp
+  802388:	41 57                	push   %r15
+  80238a:	41 56                	push   %r14
+  80238c:	41 55                	push   %r13
+  80238e:	41 54                	push   %r12
+  802390:	53                   	push   %rbx
+  802391:	48 83 ec 18          	sub    $0x18,%rsp
+  802395:	49 89 fc             	mov    %rdi,%r12
+  802398:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80239c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8023a0:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  8023a7:	00 00 00 
+  8023aa:	ff d0                	call   *%rax
+  8023ac:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8023af:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8023b5:	49 bd 05 11 80 00 00 	movabs $0x801105,%r13
+  8023bc:	00 00 00 
+            sys_yield();
+  8023bf:	49 be a2 10 80 00 00 	movabs $0x8010a2,%r14
+  8023c6:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8023c9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8023ce:	74 7d                	je     80244d <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8023d0:	8b 03                	mov    (%rbx),%eax
+  8023d2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8023d5:	75 26                	jne    8023fd <devpipe_read+0x79>
+            if (i > 0) return i;
+  8023d7:	4d 85 ff             	test   %r15,%r15
+  8023da:	75 77                	jne    802453 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8023dc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8023e1:	48 89 da             	mov    %rbx,%rdx
+  8023e4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8023e9:	4c 89 e7             	mov    %r12,%rdi
+  8023ec:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8023ef:	85 c0                	test   %eax,%eax
+  8023f1:	74 72                	je     802465 <devpipe_read+0xe1>
+            sys_yield();
+  8023f3:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8023f6:	8b 03                	mov    (%rbx),%eax
+  8023f8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8023fb:	74 df                	je     8023dc <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8023fd:	48 63 c8             	movslq %eax,%rcx
+  802400:	48 89 ca             	mov    %rcx,%rdx
+  802403:	48 c1 ea 03          	shr    $0x3,%rdx
+  802407:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80240e:	08 10 20 
+  802411:	48 89 d0             	mov    %rdx,%rax
+  802414:	48 f7 e6             	mul    %rsi
+  802417:	48 c1 ea 06          	shr    $0x6,%rdx
+  80241b:	48 89 d0             	mov    %rdx,%rax
+  80241e:	48 c1 e0 09          	shl    $0x9,%rax
+  802422:	48 29 d0             	sub    %rdx,%rax
+  802425:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80242c:	00 
+  80242d:	48 89 c8             	mov    %rcx,%rax
+  802430:	48 29 d0             	sub    %rdx,%rax
+  802433:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802438:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80243c:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802440:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802443:	49 83 c7 01          	add    $0x1,%r15
+  802447:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80244b:	75 83                	jne    8023d0 <devpipe_read+0x4c>
+    return n;
+  80244d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802451:	eb 03                	jmp    802456 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802453:	4c 89 f8             	mov    %r15,%rax
+}
+  802456:	48 83 c4 18          	add    $0x18,%rsp
+  80245a:	5b                   	pop    %rbx
+  80245b:	41 5c                	pop    %r12
+  80245d:	41 5d                	pop    %r13
+  80245f:	41 5e                	pop    %r14
+  802461:	41 5f                	pop    %r15
+  802463:	5d                   	pop    %rbp
+  802464:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246a:	eb ea                	jmp    802456 <devpipe_read+0xd2>
+
+000000000080246c <pipe>:
+pipe(int pfd[2]) {
+  80246c:	55                   	push   %rbp
+  80246d:	48 89 e5             	mov    %rsp,%rbp
+  802470:	41 55                	push   %r13
+  802472:	41 54                	push   %r12
+  802474:	53                   	push   %rbx
+  802475:	48 83 ec 18          	sub    $0x18,%rsp
+  802479:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80247c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802480:	48 b8 01 18 80 00 00 	movabs $0x801801,%rax
+  802487:	00 00 00 
+  80248a:	ff d0                	call   *%rax
+  80248c:	89 c3                	mov    %eax,%ebx
+  80248e:	85 c0                	test   %eax,%eax
+  802490:	0f 88 a0 01 00 00    	js     802636 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802496:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80249b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024a0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8024a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024a9:	48 b8 31 11 80 00 00 	movabs $0x801131,%rax
+  8024b0:	00 00 00 
+  8024b3:	ff d0                	call   *%rax
+  8024b5:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8024b7:	85 c0                	test   %eax,%eax
+  8024b9:	0f 88 77 01 00 00    	js     802636 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8024bf:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8024c3:	48 b8 01 18 80 00 00 	movabs $0x801801,%rax
+  8024ca:	00 00 00 
+  8024cd:	ff d0                	call   *%rax
+  8024cf:	89 c3                	mov    %eax,%ebx
+  8024d1:	85 c0                	test   %eax,%eax
+  8024d3:	0f 88 43 01 00 00    	js     80261c <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8024d9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8024de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024e3:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8024e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024ec:	48 b8 31 11 80 00 00 	movabs $0x801131,%rax
+  8024f3:	00 00 00 
+  8024f6:	ff d0                	call   *%rax
+  8024f8:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8024fa:	85 c0                	test   %eax,%eax
+  8024fc:	0f 88 1a 01 00 00    	js     80261c <pipe+0x1b0>
+    va = fd2data(fd0);
+  802502:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802506:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  80250d:	00 00 00 
+  802510:	ff d0                	call   *%rax
+  802512:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802515:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80251a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80251f:	48 89 c6             	mov    %rax,%rsi
+  802522:	bf 00 00 00 00       	mov    $0x0,%edi
+  802527:	48 b8 31 11 80 00 00 	movabs $0x801131,%rax
+  80252e:	00 00 00 
+  802531:	ff d0                	call   *%rax
+  802533:	89 c3                	mov    %eax,%ebx
+  802535:	85 c0                	test   %eax,%eax
+  802537:	0f 88 c5 00 00 00    	js     802602 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80253d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802541:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  802548:	00 00 00 
+  80254b:	ff d0                	call   *%rax
+  80254d:	48 89 c1             	mov    %rax,%rcx
+  802550:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802556:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80255c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802561:	4c 89 ee             	mov    %r13,%rsi
+  802564:	bf 00 00 00 00       	mov    $0x0,%edi
+  802569:	48 b8 98 11 80 00 00 	movabs $0x801198,%rax
+  802570:	00 00 00 
+  802573:	ff d0                	call   *%rax
+  802575:	89 c3                	mov    %eax,%ebx
+  802577:	85 c0                	test   %eax,%eax
+  802579:	78 6e                	js     8025e9 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80257b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802580:	4c 89 ef             	mov    %r13,%rdi
+  802583:	48 b8 d3 10 80 00 00 	movabs $0x8010d3,%rax
+  80258a:	00 00 00 
+  80258d:	ff d0                	call   *%rax
+  80258f:	83 f8 02             	cmp    $0x2,%eax
+  802592:	0f 85 ab 00 00 00    	jne    802643 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802598:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80259f:	00 00 
+  8025a1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8025a5:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8025a7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8025ab:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8025b2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8025b6:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8025b8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025bc:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8025c3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025c7:	48 bb d3 17 80 00 00 	movabs $0x8017d3,%rbx
+  8025ce:	00 00 00 
+  8025d1:	ff d3                	call   *%rbx
+  8025d3:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8025d7:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8025db:	ff d3                	call   *%rbx
+  8025dd:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8025e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025e7:	eb 4d                	jmp    802636 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8025e9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025ee:	4c 89 ee             	mov    %r13,%rsi
+  8025f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025f6:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  8025fd:	00 00 00 
+  802600:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802602:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802607:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80260b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802610:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  802617:	00 00 00 
+  80261a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80261c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802621:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802625:	bf 00 00 00 00       	mov    $0x0,%edi
+  80262a:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  802631:	00 00 00 
+  802634:	ff d0                	call   *%rax
+}
+  802636:	89 d8                	mov    %ebx,%eax
+  802638:	48 83 c4 18          	add    $0x18,%rsp
+  80263c:	5b                   	pop    %rbx
+  80263d:	41 5c                	pop    %r12
+  80263f:	41 5d                	pop    %r13
+  802641:	5d                   	pop    %rbp
+  802642:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802643:	48 b9 f0 33 80 00 00 	movabs $0x8033f0,%rcx
+  80264a:	00 00 00 
+  80264d:	48 ba c7 33 80 00 00 	movabs $0x8033c7,%rdx
+  802654:	00 00 00 
+  802657:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80265c:	48 bf dc 33 80 00 00 	movabs $0x8033dc,%rdi
+  802663:	00 00 00 
+  802666:	b8 00 00 00 00       	mov    $0x0,%eax
+  80266b:	49 b8 a6 2a 80 00 00 	movabs $0x802aa6,%r8
+  802672:	00 00 00 
+  802675:	41 ff d0             	call   *%r8
+
+0000000000802678 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802678:	55                   	push   %rbp
+  802679:	48 89 e5             	mov    %rsp,%rbp
+  80267c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802680:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802684:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  80268b:	00 00 00 
+  80268e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802690:	85 c0                	test   %eax,%eax
+  802692:	78 35                	js     8026c9 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802694:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802698:	48 b8 e5 17 80 00 00 	movabs $0x8017e5,%rax
+  80269f:	00 00 00 
+  8026a2:	ff d0                	call   *%rax
+  8026a4:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026a7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026ac:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026b1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8026b5:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  8026bc:	00 00 00 
+  8026bf:	ff d0                	call   *%rax
+  8026c1:	85 c0                	test   %eax,%eax
+  8026c3:	0f 94 c0             	sete   %al
+  8026c6:	0f b6 c0             	movzbl %al,%eax
+}
+  8026c9:	c9                   	leave
+  8026ca:	c3                   	ret
+
+00000000008026cb <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8026cb:	48 89 f8             	mov    %rdi,%rax
+  8026ce:	48 c1 e8 27          	shr    $0x27,%rax
+  8026d2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8026d9:	01 00 00 
+  8026dc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8026e0:	f6 c2 01             	test   $0x1,%dl
+  8026e3:	74 6d                	je     802752 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8026e5:	48 89 f8             	mov    %rdi,%rax
+  8026e8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8026ec:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8026f3:	01 00 00 
+  8026f6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8026fa:	f6 c2 01             	test   $0x1,%dl
+  8026fd:	74 62                	je     802761 <get_uvpt_entry+0x96>
+  8026ff:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802706:	01 00 00 
+  802709:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80270d:	f6 c2 80             	test   $0x80,%dl
+  802710:	75 4f                	jne    802761 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802712:	48 89 f8             	mov    %rdi,%rax
+  802715:	48 c1 e8 15          	shr    $0x15,%rax
+  802719:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802720:	01 00 00 
+  802723:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802727:	f6 c2 01             	test   $0x1,%dl
+  80272a:	74 44                	je     802770 <get_uvpt_entry+0xa5>
+  80272c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802733:	01 00 00 
+  802736:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80273a:	f6 c2 80             	test   $0x80,%dl
+  80273d:	75 31                	jne    802770 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80273f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802743:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80274a:	01 00 00 
+  80274d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802751:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802752:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802759:	01 00 00 
+  80275c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802760:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802761:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802768:	01 00 00 
+  80276b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80276f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802770:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802777:	01 00 00 
+  80277a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80277e:	c3                   	ret
+
+000000000080277f <get_prot>:
+
+int
+get_prot(void *va) {
+  80277f:	55                   	push   %rbp
+  802780:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802783:	48 b8 cb 26 80 00 00 	movabs $0x8026cb,%rax
+  80278a:	00 00 00 
+  80278d:	ff d0                	call   *%rax
+  80278f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802792:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802797:	89 c1                	mov    %eax,%ecx
+  802799:	83 c9 04             	or     $0x4,%ecx
+  80279c:	f6 c2 01             	test   $0x1,%dl
+  80279f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8027a2:	89 c1                	mov    %eax,%ecx
+  8027a4:	83 c9 02             	or     $0x2,%ecx
+  8027a7:	f6 c2 02             	test   $0x2,%dl
+  8027aa:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8027ad:	89 c1                	mov    %eax,%ecx
+  8027af:	83 c9 01             	or     $0x1,%ecx
+  8027b2:	48 85 d2             	test   %rdx,%rdx
+  8027b5:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8027b8:	89 c1                	mov    %eax,%ecx
+  8027ba:	83 c9 40             	or     $0x40,%ecx
+  8027bd:	f6 c6 04             	test   $0x4,%dh
+  8027c0:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8027c3:	5d                   	pop    %rbp
+  8027c4:	c3                   	ret
+
+00000000008027c5 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8027c5:	55                   	push   %rbp
+  8027c6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8027c9:	48 b8 cb 26 80 00 00 	movabs $0x8026cb,%rax
+  8027d0:	00 00 00 
+  8027d3:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8027d5:	48 c1 e8 06          	shr    $0x6,%rax
+  8027d9:	83 e0 01             	and    $0x1,%eax
+}
+  8027dc:	5d                   	pop    %rbp
+  8027dd:	c3                   	ret
+
+00000000008027de <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8027de:	55                   	push   %rbp
+  8027df:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8027e2:	48 b8 cb 26 80 00 00 	movabs $0x8026cb,%rax
+  8027e9:	00 00 00 
+  8027ec:	ff d0                	call   *%rax
+  8027ee:	83 e0 01             	and    $0x1,%eax
+}
+  8027f1:	5d                   	pop    %rbp
+  8027f2:	c3                   	ret
+
+00000000008027f3 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8027f3:	55                   	push   %rbp
+  8027f4:	48 89 e5             	mov    %rsp,%rbp
+  8027f7:	41 57                	push   %r15
+  8027f9:	41 56                	push   %r14
+  8027fb:	41 55                	push   %r13
+  8027fd:	41 54                	push   %r12
+  8027ff:	53                   	push   %rbx
+  802800:	48 83 ec 18          	sub    $0x18,%rsp
+  802804:	49 89 ff             	mov    %rdi,%r15
+  802807:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80280b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802810:	49 bc de 27 80 00 00 	movabs $0x8027de,%r12
+  802817:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  80281a:	49 be 7f 27 80 00 00 	movabs $0x80277f,%r14
+  802821:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802824:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  80282b:	00 00 00 
+  80282e:	eb 0c                	jmp    80283c <foreach_shared_region+0x49>
+  802830:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802837:	4c 39 eb             	cmp    %r13,%rbx
+  80283a:	74 38                	je     802874 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  80283c:	48 89 df             	mov    %rbx,%rdi
+  80283f:	41 ff d4             	call   *%r12
+  802842:	84 c0                	test   %al,%al
+  802844:	74 ea                	je     802830 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802846:	48 89 df             	mov    %rbx,%rdi
+  802849:	41 ff d6             	call   *%r14
+  80284c:	a8 40                	test   $0x40,%al
+  80284e:	74 e0                	je     802830 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802850:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802857:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80285b:	48 89 df             	mov    %rbx,%rdi
+  80285e:	41 ff d7             	call   *%r15
+        if (err)
+  802861:	85 c0                	test   %eax,%eax
+  802863:	74 cb                	je     802830 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802865:	48 83 c4 18          	add    $0x18,%rsp
+  802869:	5b                   	pop    %rbx
+  80286a:	41 5c                	pop    %r12
+  80286c:	41 5d                	pop    %r13
+  80286e:	41 5e                	pop    %r14
+  802870:	41 5f                	pop    %r15
+  802872:	5d                   	pop    %rbp
+  802873:	c3                   	ret
+    return 0;
+  802874:	b8 00 00 00 00       	mov    $0x0,%eax
+  802879:	eb ea                	jmp    802865 <foreach_shared_region+0x72>
+
+000000000080287b <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80287b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802880:	c3                   	ret
+
+0000000000802881 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802881:	55                   	push   %rbp
+  802882:	48 89 e5             	mov    %rsp,%rbp
+  802885:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802888:	48 be 14 34 80 00 00 	movabs $0x803414,%rsi
+  80288f:	00 00 00 
+  802892:	48 b8 81 0b 80 00 00 	movabs $0x800b81,%rax
+  802899:	00 00 00 
+  80289c:	ff d0                	call   *%rax
+    return 0;
+}
+  80289e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a3:	5d                   	pop    %rbp
+  8028a4:	c3                   	ret
+
+00000000008028a5 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8028a5:	55                   	push   %rbp
+  8028a6:	48 89 e5             	mov    %rsp,%rbp
+  8028a9:	41 57                	push   %r15
+  8028ab:	41 56                	push   %r14
+  8028ad:	41 55                	push   %r13
+  8028af:	41 54                	push   %r12
+  8028b1:	53                   	push   %rbx
+  8028b2:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8028b9:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8028c0:	48 85 d2             	test   %rdx,%rdx
+  8028c3:	74 7a                	je     80293f <devcons_write+0x9a>
+  8028c5:	49 89 d6             	mov    %rdx,%r14
+  8028c8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8028ce:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8028d3:	49 bf 7b 0d 80 00 00 	movabs $0x800d7b,%r15
+  8028da:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8028dd:	4c 89 f3             	mov    %r14,%rbx
+  8028e0:	48 29 f3             	sub    %rsi,%rbx
+  8028e3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8028e8:	48 39 c3             	cmp    %rax,%rbx
+  8028eb:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8028ef:	4c 63 eb             	movslq %ebx,%r13
+  8028f2:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8028f9:	48 01 c6             	add    %rax,%rsi
+  8028fc:	4c 89 ea             	mov    %r13,%rdx
+  8028ff:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802906:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802909:	4c 89 ee             	mov    %r13,%rsi
+  80290c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802913:	48 b8 a8 0f 80 00 00 	movabs $0x800fa8,%rax
+  80291a:	00 00 00 
+  80291d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80291f:	41 01 dc             	add    %ebx,%r12d
+  802922:	49 63 f4             	movslq %r12d,%rsi
+  802925:	4c 39 f6             	cmp    %r14,%rsi
+  802928:	72 b3                	jb     8028dd <devcons_write+0x38>
+    return res;
+  80292a:	49 63 c4             	movslq %r12d,%rax
+}
+  80292d:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802934:	5b                   	pop    %rbx
+  802935:	41 5c                	pop    %r12
+  802937:	41 5d                	pop    %r13
+  802939:	41 5e                	pop    %r14
+  80293b:	41 5f                	pop    %r15
+  80293d:	5d                   	pop    %rbp
+  80293e:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80293f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802945:	eb e3                	jmp    80292a <devcons_write+0x85>
+
+0000000000802947 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802947:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80294a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80294f:	48 85 c0             	test   %rax,%rax
+  802952:	74 55                	je     8029a9 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802954:	55                   	push   %rbp
+  802955:	48 89 e5             	mov    %rsp,%rbp
+  802958:	41 55                	push   %r13
+  80295a:	41 54                	push   %r12
+  80295c:	53                   	push   %rbx
+  80295d:	48 83 ec 08          	sub    $0x8,%rsp
+  802961:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802964:	48 bb d5 0f 80 00 00 	movabs $0x800fd5,%rbx
+  80296b:	00 00 00 
+  80296e:	49 bc a2 10 80 00 00 	movabs $0x8010a2,%r12
+  802975:	00 00 00 
+  802978:	eb 03                	jmp    80297d <devcons_read+0x36>
+  80297a:	41 ff d4             	call   *%r12
+  80297d:	ff d3                	call   *%rbx
+  80297f:	85 c0                	test   %eax,%eax
+  802981:	74 f7                	je     80297a <devcons_read+0x33>
+    if (c < 0) return c;
+  802983:	48 63 d0             	movslq %eax,%rdx
+  802986:	78 13                	js     80299b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802988:	ba 00 00 00 00       	mov    $0x0,%edx
+  80298d:	83 f8 04             	cmp    $0x4,%eax
+  802990:	74 09                	je     80299b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802992:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802996:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80299b:	48 89 d0             	mov    %rdx,%rax
+  80299e:	48 83 c4 08          	add    $0x8,%rsp
+  8029a2:	5b                   	pop    %rbx
+  8029a3:	41 5c                	pop    %r12
+  8029a5:	41 5d                	pop    %r13
+  8029a7:	5d                   	pop    %rbp
+  8029a8:	c3                   	ret
+  8029a9:	48 89 d0             	mov    %rdx,%rax
+  8029ac:	c3                   	ret
+
+00000000008029ad <cputchar>:
+cputchar(int ch) {
+  8029ad:	55                   	push   %rbp
+  8029ae:	48 89 e5             	mov    %rsp,%rbp
+  8029b1:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8029b5:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8029b9:	be 01 00 00 00       	mov    $0x1,%esi
+  8029be:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8029c2:	48 b8 a8 0f 80 00 00 	movabs $0x800fa8,%rax
+  8029c9:	00 00 00 
+  8029cc:	ff d0                	call   *%rax
+}
+  8029ce:	c9                   	leave
+  8029cf:	c3                   	ret
+
+00000000008029d0 <getchar>:
+getchar(void) {
+  8029d0:	55                   	push   %rbp
+  8029d1:	48 89 e5             	mov    %rsp,%rbp
+  8029d4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8029d8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8029dd:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8029e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029e6:	48 b8 44 1b 80 00 00 	movabs $0x801b44,%rax
+  8029ed:	00 00 00 
+  8029f0:	ff d0                	call   *%rax
+  8029f2:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8029f4:	85 c0                	test   %eax,%eax
+  8029f6:	78 06                	js     8029fe <getchar+0x2e>
+  8029f8:	74 08                	je     802a02 <getchar+0x32>
+  8029fa:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8029fe:	89 d0                	mov    %edx,%eax
+  802a00:	c9                   	leave
+  802a01:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802a02:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802a07:	eb f5                	jmp    8029fe <getchar+0x2e>
+
+0000000000802a09 <iscons>:
+iscons(int fdnum) {
+  802a09:	55                   	push   %rbp
+  802a0a:	48 89 e5             	mov    %rsp,%rbp
+  802a0d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802a11:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802a15:	48 b8 61 18 80 00 00 	movabs $0x801861,%rax
+  802a1c:	00 00 00 
+  802a1f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a21:	85 c0                	test   %eax,%eax
+  802a23:	78 18                	js     802a3d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802a25:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a29:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802a30:	00 00 00 
+  802a33:	8b 00                	mov    (%rax),%eax
+  802a35:	39 02                	cmp    %eax,(%rdx)
+  802a37:	0f 94 c0             	sete   %al
+  802a3a:	0f b6 c0             	movzbl %al,%eax
+}
+  802a3d:	c9                   	leave
+  802a3e:	c3                   	ret
+
+0000000000802a3f <opencons>:
+opencons(void) {
+  802a3f:	55                   	push   %rbp
+  802a40:	48 89 e5             	mov    %rsp,%rbp
+  802a43:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802a47:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802a4b:	48 b8 01 18 80 00 00 	movabs $0x801801,%rax
+  802a52:	00 00 00 
+  802a55:	ff d0                	call   *%rax
+  802a57:	85 c0                	test   %eax,%eax
+  802a59:	78 49                	js     802aa4 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802a5b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802a60:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a65:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802a69:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a6e:	48 b8 31 11 80 00 00 	movabs $0x801131,%rax
+  802a75:	00 00 00 
+  802a78:	ff d0                	call   *%rax
+  802a7a:	85 c0                	test   %eax,%eax
+  802a7c:	78 26                	js     802aa4 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802a7e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a82:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802a89:	00 00 
+  802a8b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802a8d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a91:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802a98:	48 b8 d3 17 80 00 00 	movabs $0x8017d3,%rax
+  802a9f:	00 00 00 
+  802aa2:	ff d0                	call   *%rax
+}
+  802aa4:	c9                   	leave
+  802aa5:	c3                   	ret
+
+0000000000802aa6 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802aa6:	55                   	push   %rbp
+  802aa7:	48 89 e5             	mov    %rsp,%rbp
+  802aaa:	41 56                	push   %r14
+  802aac:	41 55                	push   %r13
+  802aae:	41 54                	push   %r12
+  802ab0:	53                   	push   %rbx
+  802ab1:	48 83 ec 50          	sub    $0x50,%rsp
+  802ab5:	49 89 fc             	mov    %rdi,%r12
+  802ab8:	41 89 f5             	mov    %esi,%r13d
+  802abb:	48 89 d3             	mov    %rdx,%rbx
+  802abe:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802ac2:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802ac6:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802aca:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802ad1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802ad5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802ad9:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802add:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802ae1:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802ae8:	00 00 00 
+  802aeb:	4c 8b 30             	mov    (%rax),%r14
+  802aee:	48 b8 71 10 80 00 00 	movabs $0x801071,%rax
+  802af5:	00 00 00 
+  802af8:	ff d0                	call   *%rax
+  802afa:	89 c6                	mov    %eax,%esi
+  802afc:	45 89 e8             	mov    %r13d,%r8d
+  802aff:	4c 89 e1             	mov    %r12,%rcx
+  802b02:	4c 89 f2             	mov    %r14,%rdx
+  802b05:	48 bf 20 34 80 00 00 	movabs $0x803420,%rdi
+  802b0c:	00 00 00 
+  802b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b14:	49 bc 5c 02 80 00 00 	movabs $0x80025c,%r12
+  802b1b:	00 00 00 
+  802b1e:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802b21:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802b25:	48 89 df             	mov    %rbx,%rdi
+  802b28:	48 b8 f8 01 80 00 00 	movabs $0x8001f8,%rax
+  802b2f:	00 00 00 
+  802b32:	ff d0                	call   *%rax
+    cprintf("\n");
+  802b34:	48 bf 64 2d 80 00 00 	movabs $0x802d64,%rdi
+  802b3b:	00 00 00 
+  802b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b43:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802b46:	cc                   	int3
+  802b47:	eb fd                	jmp    802b46 <_panic+0xa0>
+
+0000000000802b49 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802b49:	55                   	push   %rbp
+  802b4a:	48 89 e5             	mov    %rsp,%rbp
+  802b4d:	41 54                	push   %r12
+  802b4f:	53                   	push   %rbx
+  802b50:	48 89 fb             	mov    %rdi,%rbx
+  802b53:	48 89 f7             	mov    %rsi,%rdi
+  802b56:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802b59:	48 85 f6             	test   %rsi,%rsi
+  802b5c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802b63:	00 00 00 
+  802b66:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802b6a:	be 00 10 00 00       	mov    $0x1000,%esi
+  802b6f:	48 b8 9b 14 80 00 00 	movabs $0x80149b,%rax
+  802b76:	00 00 00 
+  802b79:	ff d0                	call   *%rax
+    if (res < 0) {
+  802b7b:	85 c0                	test   %eax,%eax
+  802b7d:	78 45                	js     802bc4 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802b7f:	48 85 db             	test   %rbx,%rbx
+  802b82:	74 12                	je     802b96 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802b84:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b8b:	00 00 00 
+  802b8e:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b94:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802b96:	4d 85 e4             	test   %r12,%r12
+  802b99:	74 14                	je     802baf <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802b9b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802ba2:	00 00 00 
+  802ba5:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802bab:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802baf:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802bb6:	00 00 00 
+  802bb9:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802bbf:	5b                   	pop    %rbx
+  802bc0:	41 5c                	pop    %r12
+  802bc2:	5d                   	pop    %rbp
+  802bc3:	c3                   	ret
+        if (from_env_store)
+  802bc4:	48 85 db             	test   %rbx,%rbx
+  802bc7:	74 06                	je     802bcf <ipc_recv+0x86>
+            *from_env_store = 0;
+  802bc9:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802bcf:	4d 85 e4             	test   %r12,%r12
+  802bd2:	74 eb                	je     802bbf <ipc_recv+0x76>
+            *perm_store = 0;
+  802bd4:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802bdb:	00 
+  802bdc:	eb e1                	jmp    802bbf <ipc_recv+0x76>
+
+0000000000802bde <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802bde:	55                   	push   %rbp
+  802bdf:	48 89 e5             	mov    %rsp,%rbp
+  802be2:	41 57                	push   %r15
+  802be4:	41 56                	push   %r14
+  802be6:	41 55                	push   %r13
+  802be8:	41 54                	push   %r12
+  802bea:	53                   	push   %rbx
+  802beb:	48 83 ec 18          	sub    $0x18,%rsp
+  802bef:	41 89 fd             	mov    %edi,%r13d
+  802bf2:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802bf5:	48 89 d3             	mov    %rdx,%rbx
+  802bf8:	49 89 cc             	mov    %rcx,%r12
+  802bfb:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802bff:	48 85 d2             	test   %rdx,%rdx
+  802c02:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802c09:	00 00 00 
+  802c0c:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802c10:	49 be 6f 14 80 00 00 	movabs $0x80146f,%r14
+  802c17:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802c1a:	49 bf a2 10 80 00 00 	movabs $0x8010a2,%r15
+  802c21:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802c24:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802c27:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802c2b:	4c 89 e1             	mov    %r12,%rcx
+  802c2e:	48 89 da             	mov    %rbx,%rdx
+  802c31:	44 89 ef             	mov    %r13d,%edi
+  802c34:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802c37:	85 c0                	test   %eax,%eax
+  802c39:	74 34                	je     802c6f <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802c3b:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802c3e:	75 05                	jne    802c45 <ipc_send+0x67>
+        sys_yield();
+  802c40:	41 ff d7             	call   *%r15
+    while (true) {
+  802c43:	eb df                	jmp    802c24 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802c45:	48 ba 43 34 80 00 00 	movabs $0x803443,%rdx
+  802c4c:	00 00 00 
+  802c4f:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802c54:	48 bf 5c 34 80 00 00 	movabs $0x80345c,%rdi
+  802c5b:	00 00 00 
+  802c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c63:	48 b9 a6 2a 80 00 00 	movabs $0x802aa6,%rcx
+  802c6a:	00 00 00 
+  802c6d:	ff d1                	call   *%rcx
+    }
+}
+  802c6f:	48 83 c4 18          	add    $0x18,%rsp
+  802c73:	5b                   	pop    %rbx
+  802c74:	41 5c                	pop    %r12
+  802c76:	41 5d                	pop    %r13
+  802c78:	41 5e                	pop    %r14
+  802c7a:	41 5f                	pop    %r15
+  802c7c:	5d                   	pop    %rbp
+  802c7d:	c3                   	ret
+
+0000000000802c7e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c83:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c8a:	00 00 00 
+  802c8d:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802c94:	48 01 ca             	add    %rcx,%rdx
+  802c97:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802c9d:	39 fa                	cmp    %edi,%edx
+  802c9f:	74 12                	je     802cb3 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802ca1:	48 83 c0 01          	add    $0x1,%rax
+  802ca5:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802cab:	75 e0                	jne    802c8d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802cad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cb2:	c3                   	ret
+            return envs[i].env_id;
+  802cb3:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802cba:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802cc1:	00 00 00 
+  802cc4:	48 01 d0             	add    %rdx,%rax
+  802cc7:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802ccd:	c3                   	ret
+  802cce:	66 90                	xchg   %ax,%ax
+
+0000000000802cd0 <__rodata_start>:
+  802cd0:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  802cd4:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  802cd8:	20 70 61             	and    %dh,0x61(%rax)
+  802cdb:	72 65                	jb     802d42 <__rodata_start+0x72>
+  802cdd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cde:	74 2e                	je     802d0e <__rodata_start+0x3e>
+  802ce0:	20 20                	and    %ah,(%rax)
+  802ce2:	46 6f                	rex.RX outsl %ds:(%rsi),(%dx)
+  802ce4:	72 6b                	jb     802d51 <__rodata_start+0x81>
+  802ce6:	69 6e 67 20 74 68 65 	imul   $0x65687420,0x67(%rsi),%ebp
+  802ced:	20 63 68             	and    %ah,0x68(%rbx)
+  802cf0:	69 6c 64 2e 2e 2e 0a 	imul   $0xa2e2e,0x2e(%rsp,%riz,2),%ebp
+  802cf7:	00 
+  802cf8:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  802cfc:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  802d00:	20 70 61             	and    %dh,0x61(%rax)
+  802d03:	72 65                	jb     802d6a <__rodata_start+0x9a>
+  802d05:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d06:	74 2e                	je     802d36 <__rodata_start+0x66>
+  802d08:	20 20                	and    %ah,(%rax)
+  802d0a:	52                   	push   %rdx
+  802d0b:	75 6e                	jne    802d7b <__rodata_start+0xab>
+  802d0d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d0e:	69 6e 67 20 74 68 65 	imul   $0x65687420,0x67(%rsi),%ebp
+  802d15:	20 63 68             	and    %ah,0x68(%rbx)
+  802d18:	69 6c 64 2e 2e 2e 0a 	imul   $0xa2e2e,0x2e(%rsp,%riz,2),%ebp
+  802d1f:	00 
+  802d20:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  802d24:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  802d28:	20 70 61             	and    %dh,0x61(%rax)
+  802d2b:	72 65                	jb     802d92 <__rodata_start+0xc2>
+  802d2d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d2e:	74 2e                	je     802d5e <__rodata_start+0x8e>
+  802d30:	20 20                	and    %ah,(%rax)
+  802d32:	4b 69 6c 6c 69 6e 67 	imul   $0x7420676e,0x69(%r12,%r13,2),%rbp
+  802d39:	20 74 
+  802d3b:	68 65 20 63 68       	push   $0x68632065
+  802d40:	69 6c 64 2e 2e 2e 0a 	imul   $0xa2e2e,0x2e(%rsp,%riz,2),%ebp
+  802d47:	00 
+  802d48:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  802d4c:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  802d50:	20 63 68             	and    %ah,0x68(%rbx)
+  802d53:	69 6c 64 2e 20 20 53 	imul   $0x70532020,0x2e(%rsp,%riz,2),%ebp
+  802d5a:	70 
+  802d5b:	69 6e 6e 69 6e 67 2e 	imul   $0x2e676e69,0x6e(%rsi),%ebp
+  802d62:	2e 2e 0a 00          	cs cs or (%rax),%al
+  802d66:	3c 75                	cmp    $0x75,%al
+  802d68:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d69:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802d6d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d6e:	3e 00 30             	ds add %dh,(%rax)
+  802d71:	31 32                	xor    %esi,(%rdx)
+  802d73:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802d7a:	41                   	rex.B
+  802d7b:	42                   	rex.X
+  802d7c:	43                   	rex.XB
+  802d7d:	44                   	rex.R
+  802d7e:	45                   	rex.RB
+  802d7f:	46 00 30             	rex.RX add %r14b,(%rax)
+  802d82:	31 32                	xor    %esi,(%rdx)
+  802d84:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802d8b:	61                   	(bad)
+  802d8c:	62 63 64 65 66       	(bad)
+  802d91:	00 28                	add    %ch,(%rax)
+  802d93:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d94:	75 6c                	jne    802e02 <__rodata_start+0x132>
+  802d96:	6c                   	insb   (%dx),%es:(%rdi)
+  802d97:	29 00                	sub    %eax,(%rax)
+  802d99:	65 72 72             	gs jb  802e0e <__rodata_start+0x13e>
+  802d9c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d9d:	72 20                	jb     802dbf <__rodata_start+0xef>
+  802d9f:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802da4:	73 70                	jae    802e16 <__rodata_start+0x146>
+  802da6:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802daa:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802db1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802db2:	72 00                	jb     802db4 <__rodata_start+0xe4>
+  802db4:	62 61 64 20 65       	(bad)
+  802db9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dba:	76 69                	jbe    802e25 <__rodata_start+0x155>
+  802dbc:	72 6f                	jb     802e2d <__rodata_start+0x15d>
+  802dbe:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dbf:	6d                   	insl   (%dx),%es:(%rdi)
+  802dc0:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802dc2:	74 00                	je     802dc4 <__rodata_start+0xf4>
+  802dc4:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802dcb:	20 70 61             	and    %dh,0x61(%rax)
+  802dce:	72 61                	jb     802e31 <__rodata_start+0x161>
+  802dd0:	6d                   	insl   (%dx),%es:(%rdi)
+  802dd1:	65 74 65             	gs je  802e39 <__rodata_start+0x169>
+  802dd4:	72 00                	jb     802dd6 <__rodata_start+0x106>
+  802dd6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dd7:	75 74                	jne    802e4d <__rodata_start+0x17d>
+  802dd9:	20 6f 66             	and    %ch,0x66(%rdi)
+  802ddc:	20 6d 65             	and    %ch,0x65(%rbp)
+  802ddf:	6d                   	insl   (%dx),%es:(%rdi)
+  802de0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802de1:	72 79                	jb     802e5c <__rodata_start+0x18c>
+  802de3:	00 6f 75             	add    %ch,0x75(%rdi)
+  802de6:	74 20                	je     802e08 <__rodata_start+0x138>
+  802de8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802de9:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802ded:	76 69                	jbe    802e58 <__rodata_start+0x188>
+  802def:	72 6f                	jb     802e60 <__rodata_start+0x190>
+  802df1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802df2:	6d                   	insl   (%dx),%es:(%rdi)
+  802df3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802df5:	74 73                	je     802e6a <__rodata_start+0x19a>
+  802df7:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802dfa:	72 72                	jb     802e6e <__rodata_start+0x19e>
+  802dfc:	75 70                	jne    802e6e <__rodata_start+0x19e>
+  802dfe:	74 65                	je     802e65 <__rodata_start+0x195>
+  802e00:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802e05:	75 67                	jne    802e6e <__rodata_start+0x19e>
+  802e07:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802e0a:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e0c:	00 73 65             	add    %dh,0x65(%rbx)
+  802e0f:	67 6d                	insl   (%dx),%es:(%edi)
+  802e11:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e13:	74 61                	je     802e76 <__rodata_start+0x1a6>
+  802e15:	74 69                	je     802e80 <__rodata_start+0x1b0>
+  802e17:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e18:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e19:	20 66 61             	and    %ah,0x61(%rsi)
+  802e1c:	75 6c                	jne    802e8a <__rodata_start+0x1ba>
+  802e1e:	74 00                	je     802e20 <__rodata_start+0x150>
+  802e20:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802e27:	20 45 4c             	and    %al,0x4c(%rbp)
+  802e2a:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802e2e:	61                   	(bad)
+  802e2f:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802e34:	20 73 75             	and    %dh,0x75(%rbx)
+  802e37:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802e3a:	73 79                	jae    802eb5 <__rodata_start+0x1e5>
+  802e3c:	73 74                	jae    802eb2 <__rodata_start+0x1e2>
+  802e3e:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802e40:	20 63 61             	and    %ah,0x61(%rbx)
+  802e43:	6c                   	insb   (%dx),%es:(%rdi)
+  802e44:	6c                   	insb   (%dx),%es:(%rdi)
+  802e45:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802e48:	74 72                	je     802ebc <__rodata_start+0x1ec>
+  802e4a:	79 20                	jns    802e6c <__rodata_start+0x19c>
+  802e4c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e4d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e4e:	74 20                	je     802e70 <__rodata_start+0x1a0>
+  802e50:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e52:	75 6e                	jne    802ec2 <__rodata_start+0x1f2>
+  802e54:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802e58:	76 20                	jbe    802e7a <__rodata_start+0x1aa>
+  802e5a:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802e61:	72 65                	jb     802ec8 <__rodata_start+0x1f8>
+  802e63:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802e66:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e67:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802e6b:	65 78 70             	gs js  802ede <__rodata_start+0x20e>
+  802e6e:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802e73:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802e76:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802e7a:	20 66 69             	and    %ah,0x69(%rsi)
+  802e7d:	6c                   	insb   (%dx),%es:(%rdi)
+  802e7e:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802e82:	20 66 72             	and    %ah,0x72(%rsi)
+  802e85:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802e8a:	61                   	(bad)
+  802e8b:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802e8e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e8f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e90:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802e94:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802e97:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e98:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e99:	20 6d 61             	and    %ch,0x61(%rbp)
+  802e9c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e9d:	79 20                	jns    802ebf <__rodata_start+0x1ef>
+  802e9f:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802ea6:	72 65                	jb     802f0d <__rodata_start+0x23d>
+  802ea8:	20 6f 70             	and    %ch,0x70(%rdi)
+  802eab:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802ead:	00 66 69             	add    %ah,0x69(%rsi)
+  802eb0:	6c                   	insb   (%dx),%es:(%rdi)
+  802eb1:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802eb5:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802eb8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eb9:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802ebc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ebd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ebe:	74 20                	je     802ee0 <__rodata_start+0x210>
+  802ec0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802ec2:	75 6e                	jne    802f32 <__rodata_start+0x262>
+  802ec4:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802ec8:	76 61                	jbe    802f2b <__rodata_start+0x25b>
+  802eca:	6c                   	insb   (%dx),%es:(%rdi)
+  802ecb:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802ed2:	00 
+  802ed3:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802eda:	72 65                	jb     802f41 <__rodata_start+0x271>
+  802edc:	61                   	(bad)
+  802edd:	64 79 20             	fs jns 802f00 <__rodata_start+0x230>
+  802ee0:	65 78 69             	gs js  802f4c <__rodata_start+0x27c>
+  802ee3:	73 74                	jae    802f59 <__rodata_start+0x289>
+  802ee5:	73 00                	jae    802ee7 <__rodata_start+0x217>
+  802ee7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ee8:	70 65                	jo     802f4f <__rodata_start+0x27f>
+  802eea:	72 61                	jb     802f4d <__rodata_start+0x27d>
+  802eec:	74 69                	je     802f57 <__rodata_start+0x287>
+  802eee:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ef0:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802ef3:	74 20                	je     802f15 <__rodata_start+0x245>
+  802ef5:	73 75                	jae    802f6c <__rodata_start+0x29c>
+  802ef7:	70 70                	jo     802f69 <__rodata_start+0x299>
+  802ef9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802efa:	72 74                	jb     802f70 <__rodata_start+0x2a0>
+  802efc:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802f01:	65 72 61             	gs jb  802f65 <__rodata_start+0x295>
+  802f04:	74 69                	je     802f6f <__rodata_start+0x29f>
+  802f06:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f07:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f08:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802f0b:	74 20                	je     802f2d <__rodata_start+0x25d>
+  802f0d:	70 65                	jo     802f74 <__rodata_start+0x2a4>
+  802f0f:	72 6d                	jb     802f7e <__rodata_start+0x2ae>
+  802f11:	69 74 74 65 64 00 66 	imul   $0xf660064,0x65(%rsp,%rsi,2),%esi
+  802f18:	0f 
+  802f19:	1f                   	(bad)
+  802f1a:	84 00                	test   %al,(%rax)
+  802f1c:	00 00                	add    %al,(%rax)
+  802f1e:	00 00                	add    %al,(%rax)
+  802f20:	49 04 80             	rex.WB add $0x80,%al
+  802f23:	00 00                	add    %al,(%rax)
+  802f25:	00 00                	add    %al,(%rax)
+  802f27:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  802f2d:	00 00                	add    %al,(%rax)
+  802f2f:	00 7a 0a             	add    %bh,0xa(%rdx)
+  802f32:	80 00 00             	addb   $0x0,(%rax)
+  802f35:	00 00                	add    %al,(%rax)
+  802f37:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  802f3d:	00 00                	add    %al,(%rax)
+  802f3f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  802f45:	00 00                	add    %al,(%rax)
+  802f47:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  802f4d:	00 00                	add    %al,(%rax)
+  802f4f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  802f55:	00 00                	add    %al,(%rax)
+  802f57:	00 68 04             	add    %ch,0x4(%rax)
+  802f5a:	80 00 00             	addb   $0x0,(%rax)
+  802f5d:	00 00                	add    %al,(%rax)
+  802f5f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  802f65:	00 00                	add    %al,(%rax)
+  802f67:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  802f6d:	00 00                	add    %al,(%rax)
+  802f6f:	00 5c 04 80          	add    %bl,-0x80(%rsp,%rax,1)
+  802f73:	00 00                	add    %al,(%rax)
+  802f75:	00 00                	add    %al,(%rax)
+  802f77:	00 d6                	add    %dl,%dh
+  802f79:	04 80                	add    $0x80,%al
+  802f7b:	00 00                	add    %al,(%rax)
+  802f7d:	00 00                	add    %al,(%rax)
+  802f7f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  802f85:	00 00                	add    %al,(%rax)
+  802f87:	00 5c 04 80          	add    %bl,-0x80(%rsp,%rax,1)
+  802f8b:	00 00                	add    %al,(%rax)
+  802f8d:	00 00                	add    %al,(%rax)
+  802f8f:	00 a2 04 80 00 00    	add    %ah,0x8004(%rdx)
+  802f95:	00 00                	add    %al,(%rax)
+  802f97:	00 a2 04 80 00 00    	add    %ah,0x8004(%rdx)
+  802f9d:	00 00                	add    %al,(%rax)
+  802f9f:	00 a2 04 80 00 00    	add    %ah,0x8004(%rdx)
+  802fa5:	00 00                	add    %al,(%rax)
+  802fa7:	00 a2 04 80 00 00    	add    %ah,0x8004(%rdx)
+  802fad:	00 00                	add    %al,(%rax)
+  802faf:	00 a2 04 80 00 00    	add    %ah,0x8004(%rdx)
+  802fb5:	00 00                	add    %al,(%rax)
+  802fb7:	00 a2 04 80 00 00    	add    %ah,0x8004(%rdx)
+  802fbd:	00 00                	add    %al,(%rax)
+  802fbf:	00 a2 04 80 00 00    	add    %ah,0x8004(%rdx)
+  802fc5:	00 00                	add    %al,(%rax)
+  802fc7:	00 a2 04 80 00 00    	add    %ah,0x8004(%rdx)
+  802fcd:	00 00                	add    %al,(%rax)
+  802fcf:	00 a2 04 80 00 00    	add    %ah,0x8004(%rdx)
+  802fd5:	00 00                	add    %al,(%rax)
+  802fd7:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  802fdd:	00 00                	add    %al,(%rax)
+  802fdf:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  802fe5:	00 00                	add    %al,(%rax)
+  802fe7:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  802fed:	00 00                	add    %al,(%rax)
+  802fef:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  802ff5:	00 00                	add    %al,(%rax)
+  802ff7:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  802ffd:	00 00                	add    %al,(%rax)
+  802fff:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803005:	00 00                	add    %al,(%rax)
+  803007:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  80300d:	00 00                	add    %al,(%rax)
+  80300f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803015:	00 00                	add    %al,(%rax)
+  803017:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  80301d:	00 00                	add    %al,(%rax)
+  80301f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803025:	00 00                	add    %al,(%rax)
+  803027:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  80302d:	00 00                	add    %al,(%rax)
+  80302f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803035:	00 00                	add    %al,(%rax)
+  803037:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  80303d:	00 00                	add    %al,(%rax)
+  80303f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803045:	00 00                	add    %al,(%rax)
+  803047:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  80304d:	00 00                	add    %al,(%rax)
+  80304f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803055:	00 00                	add    %al,(%rax)
+  803057:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  80305d:	00 00                	add    %al,(%rax)
+  80305f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803065:	00 00                	add    %al,(%rax)
+  803067:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  80306d:	00 00                	add    %al,(%rax)
+  80306f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803075:	00 00                	add    %al,(%rax)
+  803077:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  80307d:	00 00                	add    %al,(%rax)
+  80307f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803085:	00 00                	add    %al,(%rax)
+  803087:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  80308d:	00 00                	add    %al,(%rax)
+  80308f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803095:	00 00                	add    %al,(%rax)
+  803097:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  80309d:	00 00                	add    %al,(%rax)
+  80309f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  8030a5:	00 00                	add    %al,(%rax)
+  8030a7:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  8030ad:	00 00                	add    %al,(%rax)
+  8030af:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  8030b5:	00 00                	add    %al,(%rax)
+  8030b7:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  8030bd:	00 00                	add    %al,(%rax)
+  8030bf:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  8030c5:	00 00                	add    %al,(%rax)
+  8030c7:	00 ad 09 80 00 00    	add    %ch,0x8009(%rbp)
+  8030cd:	00 00                	add    %al,(%rax)
+  8030cf:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  8030dd:	00 00                	add    %al,(%rax)
+  8030df:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  8030e5:	00 00                	add    %al,(%rax)
+  8030e7:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  8030ed:	00 00                	add    %al,(%rax)
+  8030ef:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  8030f5:	00 00                	add    %al,(%rax)
+  8030f7:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  8030fd:	00 00                	add    %al,(%rax)
+  8030ff:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803105:	00 00                	add    %al,(%rax)
+  803107:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  80310d:	00 00                	add    %al,(%rax)
+  80310f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803115:	00 00                	add    %al,(%rax)
+  803117:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  80311d:	00 00                	add    %al,(%rax)
+  80311f:	00 f9                	add    %bh,%cl
+  803121:	04 80                	add    $0x80,%al
+  803123:	00 00                	add    %al,(%rax)
+  803125:	00 00                	add    %al,(%rax)
+  803127:	00 c8                	add    %cl,%al
+  803129:	06                   	(bad)
+  80312a:	80 00 00             	addb   $0x0,(%rax)
+  80312d:	00 00                	add    %al,(%rax)
+  80312f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  80313d:	00 00                	add    %al,(%rax)
+  80313f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  80314d:	00 00                	add    %al,(%rax)
+  80314f:	00 28                	add    %ch,(%rax)
+  803151:	05 80 00 00 00       	add    $0x80,%eax
+  803156:	00 00                	add    %al,(%rax)
+  803158:	8a 0a                	mov    (%rdx),%cl
+  80315a:	80 00 00             	addb   $0x0,(%rax)
+  80315d:	00 00                	add    %al,(%rax)
+  80315f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803165:	00 00                	add    %al,(%rax)
+  803167:	00 ee                	add    %ch,%dh
+  803169:	04 80                	add    $0x80,%al
+  80316b:	00 00                	add    %al,(%rax)
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803175:	00 00                	add    %al,(%rax)
+  803177:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  80317d:	00 00                	add    %al,(%rax)
+  80317f:	00 70 08             	add    %dh,0x8(%rax)
+  803182:	80 00 00             	addb   $0x0,(%rax)
+  803185:	00 00                	add    %al,(%rax)
+  803187:	00 3a                	add    %bh,(%rdx)
+  803189:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80318f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  803195:	00 00                	add    %al,(%rax)
+  803197:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  80319d:	00 00                	add    %al,(%rax)
+  80319f:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  8031a5:	00 00                	add    %al,(%rax)
+  8031a7:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  8031ad:	00 00                	add    %al,(%rax)
+  8031af:	00 9c 07 80 00 00 00 	add    %bl,0x80(%rdi,%rax,1)
+  8031b6:	00 00                	add    %al,(%rax)
+  8031b8:	8a 0a                	mov    (%rdx),%cl
+  8031ba:	80 00 00             	addb   $0x0,(%rax)
+  8031bd:	00 00                	add    %al,(%rax)
+  8031bf:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  8031c5:	00 00                	add    %al,(%rax)
+  8031c7:	00 ad 09 80 00 00    	add    %ch,0x8009(%rbp)
+  8031cd:	00 00                	add    %al,(%rax)
+  8031cf:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  8031d5:	00 00                	add    %al,(%rax)
+  8031d7:	00 52 04             	add    %dl,0x4(%rdx)
+  8031da:	80 00 00             	addb   $0x0,(%rax)
+  8031dd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008031e0 <error_string>:
+	...
+  8031e8:	a2 2d 80 00 00 00 00 00 b4 2d 80 00 00 00 00 00     .-.......-......
+  8031f8:	c4 2d 80 00 00 00 00 00 d6 2d 80 00 00 00 00 00     .-.......-......
+  803208:	e4 2d 80 00 00 00 00 00 f8 2d 80 00 00 00 00 00     .-.......-......
+  803218:	0d 2e 80 00 00 00 00 00 20 2e 80 00 00 00 00 00     ........ .......
+  803228:	32 2e 80 00 00 00 00 00 46 2e 80 00 00 00 00 00     2.......F.......
+  803238:	56 2e 80 00 00 00 00 00 69 2e 80 00 00 00 00 00     V.......i.......
+  803248:	80 2e 80 00 00 00 00 00 96 2e 80 00 00 00 00 00     ................
+  803258:	ae 2e 80 00 00 00 00 00 c6 2e 80 00 00 00 00 00     ................
+  803268:	d3 2e 80 00 00 00 00 00 90 32 80 00 00 00 00 00     .........2......
+  803278:	e7 2e 80 00 00 00 00 00 00 00 00 00 00 00 00 00     ................
+  803288:	ff 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ........file is 
+  803298:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8032a8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8032b8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8032c8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8032d8:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  8032e8:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  8032f8:	6c 69 62 2f 66 6f 72 6b 2e 63 00 0f 1f 44 00 00     lib/fork.c...D..
+  803308:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803318:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803328:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803338:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803348:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803358:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803368:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803378:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803388:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803398:	0f 1f 84 00 00 00 00 00                             ........
+
+00000000008033a0 <devtab>:
+  8033a0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8033b0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8033c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8033d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8033e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8033f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803400:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803410:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803420:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803430:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803440:	3a 20 00 69 70 63 5f 73 65 6e 64 3a 20 66 61 69     : .ipc_send: fai
+  803450:	6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62 2f     led to send.lib/
+  803460:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803470:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803480:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803490:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803500:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803510:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803520:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803530:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803540:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803550:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803560:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803570:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803580:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803590:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803600:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803610:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803620:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803630:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803640:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803650:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803660:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803670:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803680:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803690:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803700:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803710:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803720:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803730:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803740:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803750:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803760:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803770:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803780:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803790:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803800:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803810:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803820:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803830:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803840:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803850:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803860:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803870:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803880:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803890:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
@@ -0,0 +1,5885 @@
+
+obj/user/stresssched:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4b 01 00 00       	call   80016e <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+volatile int counter;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+    int i, j;
+    envid_t parent = sys_getenvid();
+  800032:	48 b8 9d 11 80 00 00 	movabs $0x80119d,%rax
+  800039:	00 00 00 
+  80003c:	ff d0                	call   *%rax
+  80003e:	41 89 c5             	mov    %eax,%r13d
+
+    /* Fork several environments */
+    for (i = 0; i < 20; i++)
+  800041:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fork() == 0)
+  800046:	49 bc ff 17 80 00 00 	movabs $0x8017ff,%r12
+  80004d:	00 00 00 
+  800050:	41 ff d4             	call   *%r12
+  800053:	85 c0                	test   %eax,%eax
+  800055:	74 19                	je     800070 <umain+0x4b>
+    for (i = 0; i < 20; i++)
+  800057:	83 c3 01             	add    $0x1,%ebx
+  80005a:	83 fb 14             	cmp    $0x14,%ebx
+  80005d:	75 f1                	jne    800050 <umain+0x2b>
+            break;
+    if (i == 20) {
+        sys_yield();
+  80005f:	48 b8 ce 11 80 00 00 	movabs $0x8011ce,%rax
+  800066:	00 00 00 
+  800069:	ff d0                	call   *%rax
+        return;
+  80006b:	e9 bc 00 00 00       	jmp    80012c <umain+0x107>
+    if (i == 20) {
+  800070:	83 fb 14             	cmp    $0x14,%ebx
+  800073:	74 ea                	je     80005f <umain+0x3a>
+    }
+
+    /* Wait for the parent to finish forking */
+    while (envs[ENVX(parent)].env_status != ENV_FREE)
+  800075:	41 0f b6 d5          	movzbl %r13b,%edx
+  800079:	41 0f b6 c5          	movzbl %r13b,%eax
+  80007d:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800084:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80008b:	00 00 00 
+  80008e:	48 01 c8             	add    %rcx,%rax
+  800091:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  800097:	85 c0                	test   %eax,%eax
+  800099:	74 1c                	je     8000b7 <umain+0x92>
+  80009b:	48 63 c2             	movslq %edx,%rax
+  80009e:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8000a5:	48 89 ca             	mov    %rcx,%rdx
+  8000a8:	48 01 c2             	add    %rax,%rdx
+        asm volatile("pause");
+  8000ab:	f3 90                	pause
+    while (envs[ENVX(parent)].env_status != ENV_FREE)
+  8000ad:	8b 82 d4 00 00 00    	mov    0xd4(%rdx),%eax
+  8000b3:	85 c0                	test   %eax,%eax
+  8000b5:	75 f4                	jne    8000ab <umain+0x86>
+    for (i = 0; i < 20; i++)
+  8000b7:	41 bc 0a 00 00 00    	mov    $0xa,%r12d
+
+    /* Check that one environment doesn't run on two CPUs at once */
+    for (i = 0; i < 10; i++) {
+        sys_yield();
+  8000bd:	49 bd ce 11 80 00 00 	movabs $0x8011ce,%r13
+  8000c4:	00 00 00 
+        for (j = 0; j < 10000; j++)
+            counter++;
+  8000c7:	48 bb 00 50 80 00 00 	movabs $0x805000,%rbx
+  8000ce:	00 00 00 
+        sys_yield();
+  8000d1:	41 ff d5             	call   *%r13
+  8000d4:	ba 10 27 00 00       	mov    $0x2710,%edx
+            counter++;
+  8000d9:	8b 03                	mov    (%rbx),%eax
+  8000db:	83 c0 01             	add    $0x1,%eax
+  8000de:	89 03                	mov    %eax,(%rbx)
+        for (j = 0; j < 10000; j++)
+  8000e0:	83 ea 01             	sub    $0x1,%edx
+  8000e3:	75 f4                	jne    8000d9 <umain+0xb4>
+    for (i = 0; i < 10; i++) {
+  8000e5:	41 83 ec 01          	sub    $0x1,%r12d
+  8000e9:	75 e6                	jne    8000d1 <umain+0xac>
+    }
+
+    if (counter != 10 * 10000)
+  8000eb:	a1 00 50 80 00 00 00 	movabs 0x805000,%eax
+  8000f2:	00 00 
+  8000f4:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  8000f9:	75 3c                	jne    800137 <umain+0x112>
+        panic("ran on two CPUs at once (counter is %d)", counter);
+
+    /* Check that we see environments running on different CPUs */
+    cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+  8000fb:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  800102:	00 00 00 
+  800105:	8b 90 a8 06 00 00    	mov    0x6a8(%rax),%edx
+  80010b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800111:	48 bf 93 2d 80 00 00 	movabs $0x802d93,%rdi
+  800118:	00 00 00 
+  80011b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800120:	48 b9 88 03 80 00 00 	movabs $0x800388,%rcx
+  800127:	00 00 00 
+  80012a:	ff d1                	call   *%rcx
+}
+  80012c:	48 83 c4 08          	add    $0x8,%rsp
+  800130:	5b                   	pop    %rbx
+  800131:	41 5c                	pop    %r12
+  800133:	41 5d                	pop    %r13
+  800135:	5d                   	pop    %rbp
+  800136:	c3                   	ret
+        panic("ran on two CPUs at once (counter is %d)", counter);
+  800137:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80013e:	00 00 00 
+  800141:	8b 08                	mov    (%rax),%ecx
+  800143:	48 ba 58 2d 80 00 00 	movabs $0x802d58,%rdx
+  80014a:	00 00 00 
+  80014d:	be 1f 00 00 00       	mov    $0x1f,%esi
+  800152:	48 bf 80 2d 80 00 00 	movabs $0x802d80,%rdi
+  800159:	00 00 00 
+  80015c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800161:	49 b8 38 02 80 00 00 	movabs $0x800238,%r8
+  800168:	00 00 00 
+  80016b:	41 ff d0             	call   *%r8
+
+000000000080016e <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80016e:	55                   	push   %rbp
+  80016f:	48 89 e5             	mov    %rsp,%rbp
+  800172:	41 56                	push   %r14
+  800174:	41 55                	push   %r13
+  800176:	41 54                	push   %r12
+  800178:	53                   	push   %rbx
+  800179:	41 89 fd             	mov    %edi,%r13d
+  80017c:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80017f:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800186:	00 00 00 
+  800189:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800190:	00 00 00 
+  800193:	48 39 c2             	cmp    %rax,%rdx
+  800196:	73 17                	jae    8001af <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800198:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80019b:	49 89 c4             	mov    %rax,%r12
+  80019e:	48 83 c3 08          	add    $0x8,%rbx
+  8001a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a7:	ff 53 f8             	call   *-0x8(%rbx)
+  8001aa:	4c 39 e3             	cmp    %r12,%rbx
+  8001ad:	72 ef                	jb     80019e <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8001af:	48 b8 9d 11 80 00 00 	movabs $0x80119d,%rax
+  8001b6:	00 00 00 
+  8001b9:	ff d0                	call   *%rax
+  8001bb:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8001be:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8001c5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001cc:	00 00 00 
+  8001cf:	48 01 d0             	add    %rdx,%rax
+  8001d2:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  8001d9:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001dc:	45 85 ed             	test   %r13d,%r13d
+  8001df:	7e 0d                	jle    8001ee <libmain+0x80>
+  8001e1:	49 8b 06             	mov    (%r14),%rax
+  8001e4:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001eb:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001ee:	4c 89 f6             	mov    %r14,%rsi
+  8001f1:	44 89 ef             	mov    %r13d,%edi
+  8001f4:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001fb:	00 00 00 
+  8001fe:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800200:	48 b8 15 02 80 00 00 	movabs $0x800215,%rax
+  800207:	00 00 00 
+  80020a:	ff d0                	call   *%rax
+#endif
+}
+  80020c:	5b                   	pop    %rbx
+  80020d:	41 5c                	pop    %r12
+  80020f:	41 5d                	pop    %r13
+  800211:	41 5e                	pop    %r14
+  800213:	5d                   	pop    %rbp
+  800214:	c3                   	ret
+
+0000000000800215 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800215:	55                   	push   %rbp
+  800216:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800219:	48 b8 25 1b 80 00 00 	movabs $0x801b25,%rax
+  800220:	00 00 00 
+  800223:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800225:	bf 00 00 00 00       	mov    $0x0,%edi
+  80022a:	48 b8 32 11 80 00 00 	movabs $0x801132,%rax
+  800231:	00 00 00 
+  800234:	ff d0                	call   *%rax
+}
+  800236:	5d                   	pop    %rbp
+  800237:	c3                   	ret
+
+0000000000800238 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800238:	55                   	push   %rbp
+  800239:	48 89 e5             	mov    %rsp,%rbp
+  80023c:	41 56                	push   %r14
+  80023e:	41 55                	push   %r13
+  800240:	41 54                	push   %r12
+  800242:	53                   	push   %rbx
+  800243:	48 83 ec 50          	sub    $0x50,%rsp
+  800247:	49 89 fc             	mov    %rdi,%r12
+  80024a:	41 89 f5             	mov    %esi,%r13d
+  80024d:	48 89 d3             	mov    %rdx,%rbx
+  800250:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800254:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800258:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80025c:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800263:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800267:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80026b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80026f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800273:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80027a:	00 00 00 
+  80027d:	4c 8b 30             	mov    (%rax),%r14
+  800280:	48 b8 9d 11 80 00 00 	movabs $0x80119d,%rax
+  800287:	00 00 00 
+  80028a:	ff d0                	call   *%rax
+  80028c:	89 c6                	mov    %eax,%esi
+  80028e:	45 89 e8             	mov    %r13d,%r8d
+  800291:	4c 89 e1             	mov    %r12,%rcx
+  800294:	4c 89 f2             	mov    %r14,%rdx
+  800297:	48 bf c0 2d 80 00 00 	movabs $0x802dc0,%rdi
+  80029e:	00 00 00 
+  8002a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a6:	49 bc 88 03 80 00 00 	movabs $0x800388,%r12
+  8002ad:	00 00 00 
+  8002b0:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002b3:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002b7:	48 89 df             	mov    %rbx,%rdi
+  8002ba:	48 b8 24 03 80 00 00 	movabs $0x800324,%rax
+  8002c1:	00 00 00 
+  8002c4:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002c6:	48 bf af 2d 80 00 00 	movabs $0x802daf,%rdi
+  8002cd:	00 00 00 
+  8002d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d5:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002d8:	cc                   	int3
+  8002d9:	eb fd                	jmp    8002d8 <_panic+0xa0>
+
+00000000008002db <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002db:	55                   	push   %rbp
+  8002dc:	48 89 e5             	mov    %rsp,%rbp
+  8002df:	53                   	push   %rbx
+  8002e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8002e4:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002e7:	8b 06                	mov    (%rsi),%eax
+  8002e9:	8d 50 01             	lea    0x1(%rax),%edx
+  8002ec:	89 16                	mov    %edx,(%rsi)
+  8002ee:	48 98                	cltq
+  8002f0:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002f5:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002fb:	74 0a                	je     800307 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002fd:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800301:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800305:	c9                   	leave
+  800306:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800307:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80030b:	be ff 00 00 00       	mov    $0xff,%esi
+  800310:	48 b8 d4 10 80 00 00 	movabs $0x8010d4,%rax
+  800317:	00 00 00 
+  80031a:	ff d0                	call   *%rax
+        state->offset = 0;
+  80031c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800322:	eb d9                	jmp    8002fd <putch+0x22>
+
+0000000000800324 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800324:	55                   	push   %rbp
+  800325:	48 89 e5             	mov    %rsp,%rbp
+  800328:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80032f:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800332:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800339:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80033e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800343:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800346:	48 89 f1             	mov    %rsi,%rcx
+  800349:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800350:	48 bf db 02 80 00 00 	movabs $0x8002db,%rdi
+  800357:	00 00 00 
+  80035a:	48 b8 d8 04 80 00 00 	movabs $0x8004d8,%rax
+  800361:	00 00 00 
+  800364:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800366:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80036d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800374:	48 b8 d4 10 80 00 00 	movabs $0x8010d4,%rax
+  80037b:	00 00 00 
+  80037e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800380:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800386:	c9                   	leave
+  800387:	c3                   	ret
+
+0000000000800388 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800388:	55                   	push   %rbp
+  800389:	48 89 e5             	mov    %rsp,%rbp
+  80038c:	48 83 ec 50          	sub    $0x50,%rsp
+  800390:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800394:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800398:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80039c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003a0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003a4:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003ab:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003b3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003b7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003bb:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003bf:	48 b8 24 03 80 00 00 	movabs $0x800324,%rax
+  8003c6:	00 00 00 
+  8003c9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003cb:	c9                   	leave
+  8003cc:	c3                   	ret
+
+00000000008003cd <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003cd:	55                   	push   %rbp
+  8003ce:	48 89 e5             	mov    %rsp,%rbp
+  8003d1:	41 57                	push   %r15
+  8003d3:	41 56                	push   %r14
+  8003d5:	41 55                	push   %r13
+  8003d7:	41 54                	push   %r12
+  8003d9:	53                   	push   %rbx
+  8003da:	48 83 ec 18          	sub    $0x18,%rsp
+  8003de:	49 89 fc             	mov    %rdi,%r12
+  8003e1:	49 89 f5             	mov    %rsi,%r13
+  8003e4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003e8:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003eb:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003ee:	41 89 cf             	mov    %ecx,%r15d
+  8003f1:	4c 39 fa             	cmp    %r15,%rdx
+  8003f4:	73 5b                	jae    800451 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003f6:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003fa:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003fe:	85 db                	test   %ebx,%ebx
+  800400:	7e 0e                	jle    800410 <print_num+0x43>
+            putch(padc, put_arg);
+  800402:	4c 89 ee             	mov    %r13,%rsi
+  800405:	44 89 f7             	mov    %r14d,%edi
+  800408:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80040b:	83 eb 01             	sub    $0x1,%ebx
+  80040e:	75 f2                	jne    800402 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800410:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800414:	48 b9 f4 2d 80 00 00 	movabs $0x802df4,%rcx
+  80041b:	00 00 00 
+  80041e:	48 b8 e3 2d 80 00 00 	movabs $0x802de3,%rax
+  800425:	00 00 00 
+  800428:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80042c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800430:	ba 00 00 00 00       	mov    $0x0,%edx
+  800435:	49 f7 f7             	div    %r15
+  800438:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80043c:	4c 89 ee             	mov    %r13,%rsi
+  80043f:	41 ff d4             	call   *%r12
+}
+  800442:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800446:	5b                   	pop    %rbx
+  800447:	41 5c                	pop    %r12
+  800449:	41 5d                	pop    %r13
+  80044b:	41 5e                	pop    %r14
+  80044d:	41 5f                	pop    %r15
+  80044f:	5d                   	pop    %rbp
+  800450:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800451:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800455:	ba 00 00 00 00       	mov    $0x0,%edx
+  80045a:	49 f7 f7             	div    %r15
+  80045d:	48 83 ec 08          	sub    $0x8,%rsp
+  800461:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800465:	52                   	push   %rdx
+  800466:	45 0f be c9          	movsbl %r9b,%r9d
+  80046a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80046e:	48 89 c2             	mov    %rax,%rdx
+  800471:	48 b8 cd 03 80 00 00 	movabs $0x8003cd,%rax
+  800478:	00 00 00 
+  80047b:	ff d0                	call   *%rax
+  80047d:	48 83 c4 10          	add    $0x10,%rsp
+  800481:	eb 8d                	jmp    800410 <print_num+0x43>
+
+0000000000800483 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800483:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800487:	48 8b 06             	mov    (%rsi),%rax
+  80048a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80048e:	73 0a                	jae    80049a <sprintputch+0x17>
+        *state->start++ = ch;
+  800490:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800494:	48 89 16             	mov    %rdx,(%rsi)
+  800497:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80049a:	c3                   	ret
+
+000000000080049b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80049b:	55                   	push   %rbp
+  80049c:	48 89 e5             	mov    %rsp,%rbp
+  80049f:	48 83 ec 50          	sub    $0x50,%rsp
+  8004a3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004a7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004ab:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004af:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004b6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004be:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004c2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004c6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004ca:	48 b8 d8 04 80 00 00 	movabs $0x8004d8,%rax
+  8004d1:	00 00 00 
+  8004d4:	ff d0                	call   *%rax
+}
+  8004d6:	c9                   	leave
+  8004d7:	c3                   	ret
+
+00000000008004d8 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004d8:	55                   	push   %rbp
+  8004d9:	48 89 e5             	mov    %rsp,%rbp
+  8004dc:	41 57                	push   %r15
+  8004de:	41 56                	push   %r14
+  8004e0:	41 55                	push   %r13
+  8004e2:	41 54                	push   %r12
+  8004e4:	53                   	push   %rbx
+  8004e5:	48 83 ec 38          	sub    $0x38,%rsp
+  8004e9:	49 89 fe             	mov    %rdi,%r14
+  8004ec:	49 89 f5             	mov    %rsi,%r13
+  8004ef:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004f2:	48 8b 01             	mov    (%rcx),%rax
+  8004f5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004f9:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800501:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800505:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800509:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80050d:	0f b6 3b             	movzbl (%rbx),%edi
+  800510:	40 80 ff 25          	cmp    $0x25,%dil
+  800514:	74 18                	je     80052e <vprintfmt+0x56>
+            if (!ch) return;
+  800516:	40 84 ff             	test   %dil,%dil
+  800519:	0f 84 b1 06 00 00    	je     800bd0 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80051f:	40 0f b6 ff          	movzbl %dil,%edi
+  800523:	4c 89 ee             	mov    %r13,%rsi
+  800526:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800529:	4c 89 e3             	mov    %r12,%rbx
+  80052c:	eb db                	jmp    800509 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80052e:	be 00 00 00 00       	mov    $0x0,%esi
+  800533:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800537:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80053c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800542:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800549:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80054d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800552:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800557:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80055a:	83 e8 23             	sub    $0x23,%eax
+  80055d:	3c 57                	cmp    $0x57,%al
+  80055f:	0f 87 51 06 00 00    	ja     800bb6 <vprintfmt+0x6de>
+  800565:	0f b6 c0             	movzbl %al,%eax
+  800568:	48 b9 a0 2f 80 00 00 	movabs $0x802fa0,%rcx
+  80056f:	00 00 00 
+  800572:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800575:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800578:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80057c:	eb cf                	jmp    80054d <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80057e:	49 89 dc             	mov    %rbx,%r12
+  800581:	be 01 00 00 00       	mov    $0x1,%esi
+  800586:	eb c5                	jmp    80054d <vprintfmt+0x75>
+            padc = ch;
+  800588:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80058c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80058f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800592:	eb b9                	jmp    80054d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800594:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800597:	83 f8 2f             	cmp    $0x2f,%eax
+  80059a:	77 24                	ja     8005c0 <vprintfmt+0xe8>
+  80059c:	89 c1                	mov    %eax,%ecx
+  80059e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005a2:	83 c0 08             	add    $0x8,%eax
+  8005a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005a8:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005ab:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005ae:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005b2:	79 99                	jns    80054d <vprintfmt+0x75>
+                width = precision;
+  8005b4:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005b8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005be:	eb 8d                	jmp    80054d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005c0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005c4:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005cc:	eb da                	jmp    8005a8 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005ce:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005d3:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005d7:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005dd:	3c 39                	cmp    $0x39,%al
+  8005df:	77 1c                	ja     8005fd <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005e1:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005e5:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005e9:	0f b6 c0             	movzbl %al,%eax
+  8005ec:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005f1:	0f b6 03             	movzbl (%rbx),%eax
+  8005f4:	3c 39                	cmp    $0x39,%al
+  8005f6:	76 e9                	jbe    8005e1 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005f8:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005fb:	eb b1                	jmp    8005ae <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005fd:	49 89 dc             	mov    %rbx,%r12
+  800600:	eb ac                	jmp    8005ae <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800602:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800605:	85 c9                	test   %ecx,%ecx
+  800607:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060c:	0f 49 c1             	cmovns %ecx,%eax
+  80060f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800612:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800615:	e9 33 ff ff ff       	jmp    80054d <vprintfmt+0x75>
+            lflag++;
+  80061a:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80061d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800620:	e9 28 ff ff ff       	jmp    80054d <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800625:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800628:	83 f8 2f             	cmp    $0x2f,%eax
+  80062b:	77 19                	ja     800646 <vprintfmt+0x16e>
+  80062d:	89 c2                	mov    %eax,%edx
+  80062f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800633:	83 c0 08             	add    $0x8,%eax
+  800636:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800639:	8b 3a                	mov    (%rdx),%edi
+  80063b:	4c 89 ee             	mov    %r13,%rsi
+  80063e:	41 ff d6             	call   *%r14
+            break;
+  800641:	e9 c3 fe ff ff       	jmp    800509 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800646:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80064a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80064e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800652:	eb e5                	jmp    800639 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800654:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800657:	83 f8 2f             	cmp    $0x2f,%eax
+  80065a:	77 5a                	ja     8006b6 <vprintfmt+0x1de>
+  80065c:	89 c2                	mov    %eax,%edx
+  80065e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800662:	83 c0 08             	add    $0x8,%eax
+  800665:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800668:	8b 02                	mov    (%rdx),%eax
+  80066a:	89 c1                	mov    %eax,%ecx
+  80066c:	f7 d9                	neg    %ecx
+  80066e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800671:	83 f9 15             	cmp    $0x15,%ecx
+  800674:	7f 4e                	jg     8006c4 <vprintfmt+0x1ec>
+  800676:	48 63 c1             	movslq %ecx,%rax
+  800679:	48 ba 60 32 80 00 00 	movabs $0x803260,%rdx
+  800680:	00 00 00 
+  800683:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800687:	48 85 c0             	test   %rax,%rax
+  80068a:	74 38                	je     8006c4 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80068c:	48 89 c1             	mov    %rax,%rcx
+  80068f:	48 ba 59 34 80 00 00 	movabs $0x803459,%rdx
+  800696:	00 00 00 
+  800699:	4c 89 ee             	mov    %r13,%rsi
+  80069c:	4c 89 f7             	mov    %r14,%rdi
+  80069f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a4:	49 b8 9b 04 80 00 00 	movabs $0x80049b,%r8
+  8006ab:	00 00 00 
+  8006ae:	41 ff d0             	call   *%r8
+  8006b1:	e9 53 fe ff ff       	jmp    800509 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c2:	eb a4                	jmp    800668 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006c4:	48 ba 0c 2e 80 00 00 	movabs $0x802e0c,%rdx
+  8006cb:	00 00 00 
+  8006ce:	4c 89 ee             	mov    %r13,%rsi
+  8006d1:	4c 89 f7             	mov    %r14,%rdi
+  8006d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d9:	49 b8 9b 04 80 00 00 	movabs $0x80049b,%r8
+  8006e0:	00 00 00 
+  8006e3:	41 ff d0             	call   *%r8
+  8006e6:	e9 1e fe ff ff       	jmp    800509 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f1:	77 6c                	ja     80075f <vprintfmt+0x287>
+  8006f3:	89 c2                	mov    %eax,%edx
+  8006f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f9:	83 c0 08             	add    $0x8,%eax
+  8006fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ff:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800702:	48 85 d2             	test   %rdx,%rdx
+  800705:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  80070c:	00 00 00 
+  80070f:	48 0f 45 c2          	cmovne %rdx,%rax
+  800713:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800717:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80071b:	7e 06                	jle    800723 <vprintfmt+0x24b>
+  80071d:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800721:	75 4a                	jne    80076d <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800723:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800727:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80072b:	0f b6 00             	movzbl (%rax),%eax
+  80072e:	84 c0                	test   %al,%al
+  800730:	0f 85 9a 00 00 00    	jne    8007d0 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800736:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800739:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80073d:	85 c0                	test   %eax,%eax
+  80073f:	0f 8e c4 fd ff ff    	jle    800509 <vprintfmt+0x31>
+  800745:	4c 89 ee             	mov    %r13,%rsi
+  800748:	bf 20 00 00 00       	mov    $0x20,%edi
+  80074d:	41 ff d6             	call   *%r14
+  800750:	41 83 ec 01          	sub    $0x1,%r12d
+  800754:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800758:	75 eb                	jne    800745 <vprintfmt+0x26d>
+  80075a:	e9 aa fd ff ff       	jmp    800509 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80075f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800763:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800767:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80076b:	eb 92                	jmp    8006ff <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80076d:	49 63 f7             	movslq %r15d,%rsi
+  800770:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800774:	48 b8 8a 0c 80 00 00 	movabs $0x800c8a,%rax
+  80077b:	00 00 00 
+  80077e:	ff d0                	call   *%rax
+  800780:	48 89 c2             	mov    %rax,%rdx
+  800783:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800786:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800788:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80078b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80078e:	85 c0                	test   %eax,%eax
+  800790:	7e 91                	jle    800723 <vprintfmt+0x24b>
+  800792:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800797:	4c 89 ee             	mov    %r13,%rsi
+  80079a:	44 89 e7             	mov    %r12d,%edi
+  80079d:	41 ff d6             	call   *%r14
+  8007a0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007a4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007a7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007aa:	75 eb                	jne    800797 <vprintfmt+0x2bf>
+  8007ac:	e9 72 ff ff ff       	jmp    800723 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007b1:	0f b6 f8             	movzbl %al,%edi
+  8007b4:	4c 89 ee             	mov    %r13,%rsi
+  8007b7:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007ba:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007be:	49 83 c4 01          	add    $0x1,%r12
+  8007c2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007c8:	84 c0                	test   %al,%al
+  8007ca:	0f 84 66 ff ff ff    	je     800736 <vprintfmt+0x25e>
+  8007d0:	45 85 ff             	test   %r15d,%r15d
+  8007d3:	78 0a                	js     8007df <vprintfmt+0x307>
+  8007d5:	41 83 ef 01          	sub    $0x1,%r15d
+  8007d9:	0f 88 57 ff ff ff    	js     800736 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007df:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007e3:	74 cc                	je     8007b1 <vprintfmt+0x2d9>
+  8007e5:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007e8:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007ed:	80 fa 5e             	cmp    $0x5e,%dl
+  8007f0:	77 c2                	ja     8007b4 <vprintfmt+0x2dc>
+  8007f2:	eb bd                	jmp    8007b1 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f4:	40 84 f6             	test   %sil,%sil
+  8007f7:	75 26                	jne    80081f <vprintfmt+0x347>
+    switch (lflag) {
+  8007f9:	85 d2                	test   %edx,%edx
+  8007fb:	74 59                	je     800856 <vprintfmt+0x37e>
+  8007fd:	83 fa 01             	cmp    $0x1,%edx
+  800800:	74 7b                	je     80087d <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800802:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800805:	83 f8 2f             	cmp    $0x2f,%eax
+  800808:	0f 87 96 00 00 00    	ja     8008a4 <vprintfmt+0x3cc>
+  80080e:	89 c2                	mov    %eax,%edx
+  800810:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800814:	83 c0 08             	add    $0x8,%eax
+  800817:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081a:	4c 8b 22             	mov    (%rdx),%r12
+  80081d:	eb 17                	jmp    800836 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80081f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800822:	83 f8 2f             	cmp    $0x2f,%eax
+  800825:	77 21                	ja     800848 <vprintfmt+0x370>
+  800827:	89 c2                	mov    %eax,%edx
+  800829:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082d:	83 c0 08             	add    $0x8,%eax
+  800830:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800833:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800836:	4d 85 e4             	test   %r12,%r12
+  800839:	78 7a                	js     8008b5 <vprintfmt+0x3dd>
+            num = i;
+  80083b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80083e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800843:	e9 50 02 00 00       	jmp    800a98 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800848:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800850:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800854:	eb dd                	jmp    800833 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800856:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800859:	83 f8 2f             	cmp    $0x2f,%eax
+  80085c:	77 11                	ja     80086f <vprintfmt+0x397>
+  80085e:	89 c2                	mov    %eax,%edx
+  800860:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800864:	83 c0 08             	add    $0x8,%eax
+  800867:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086a:	4c 63 22             	movslq (%rdx),%r12
+  80086d:	eb c7                	jmp    800836 <vprintfmt+0x35e>
+  80086f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800873:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800877:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087b:	eb ed                	jmp    80086a <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80087d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800880:	83 f8 2f             	cmp    $0x2f,%eax
+  800883:	77 11                	ja     800896 <vprintfmt+0x3be>
+  800885:	89 c2                	mov    %eax,%edx
+  800887:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088b:	83 c0 08             	add    $0x8,%eax
+  80088e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800891:	4c 8b 22             	mov    (%rdx),%r12
+  800894:	eb a0                	jmp    800836 <vprintfmt+0x35e>
+  800896:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a2:	eb ed                	jmp    800891 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8008a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b0:	e9 65 ff ff ff       	jmp    80081a <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008b5:	4c 89 ee             	mov    %r13,%rsi
+  8008b8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008bd:	41 ff d6             	call   *%r14
+                i = -i;
+  8008c0:	49 f7 dc             	neg    %r12
+  8008c3:	e9 73 ff ff ff       	jmp    80083b <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c8:	40 84 f6             	test   %sil,%sil
+  8008cb:	75 32                	jne    8008ff <vprintfmt+0x427>
+    switch (lflag) {
+  8008cd:	85 d2                	test   %edx,%edx
+  8008cf:	74 5d                	je     80092e <vprintfmt+0x456>
+  8008d1:	83 fa 01             	cmp    $0x1,%edx
+  8008d4:	0f 84 82 00 00 00    	je     80095c <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e0:	0f 87 a5 00 00 00    	ja     80098b <vprintfmt+0x4b3>
+  8008e6:	89 c2                	mov    %eax,%edx
+  8008e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ec:	83 c0 08             	add    $0x8,%eax
+  8008ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008f5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008fa:	e9 99 01 00 00       	jmp    800a98 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800902:	83 f8 2f             	cmp    $0x2f,%eax
+  800905:	77 19                	ja     800920 <vprintfmt+0x448>
+  800907:	89 c2                	mov    %eax,%edx
+  800909:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090d:	83 c0 08             	add    $0x8,%eax
+  800910:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800913:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800916:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80091b:	e9 78 01 00 00       	jmp    800a98 <vprintfmt+0x5c0>
+  800920:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800924:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800928:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092c:	eb e5                	jmp    800913 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80092e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800931:	83 f8 2f             	cmp    $0x2f,%eax
+  800934:	77 18                	ja     80094e <vprintfmt+0x476>
+  800936:	89 c2                	mov    %eax,%edx
+  800938:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093c:	83 c0 08             	add    $0x8,%eax
+  80093f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800942:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800944:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800949:	e9 4a 01 00 00       	jmp    800a98 <vprintfmt+0x5c0>
+  80094e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800952:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800956:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095a:	eb e6                	jmp    800942 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80095c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095f:	83 f8 2f             	cmp    $0x2f,%eax
+  800962:	77 19                	ja     80097d <vprintfmt+0x4a5>
+  800964:	89 c2                	mov    %eax,%edx
+  800966:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096a:	83 c0 08             	add    $0x8,%eax
+  80096d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800970:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800973:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800978:	e9 1b 01 00 00       	jmp    800a98 <vprintfmt+0x5c0>
+  80097d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800981:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800985:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800989:	eb e5                	jmp    800970 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80098b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80098f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800993:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800997:	e9 56 ff ff ff       	jmp    8008f2 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80099c:	40 84 f6             	test   %sil,%sil
+  80099f:	75 2e                	jne    8009cf <vprintfmt+0x4f7>
+    switch (lflag) {
+  8009a1:	85 d2                	test   %edx,%edx
+  8009a3:	74 59                	je     8009fe <vprintfmt+0x526>
+  8009a5:	83 fa 01             	cmp    $0x1,%edx
+  8009a8:	74 7f                	je     800a29 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8009aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b0:	0f 87 9f 00 00 00    	ja     800a55 <vprintfmt+0x57d>
+  8009b6:	89 c2                	mov    %eax,%edx
+  8009b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009bc:	83 c0 08             	add    $0x8,%eax
+  8009bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009c5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009ca:	e9 c9 00 00 00       	jmp    800a98 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d5:	77 19                	ja     8009f0 <vprintfmt+0x518>
+  8009d7:	89 c2                	mov    %eax,%edx
+  8009d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009dd:	83 c0 08             	add    $0x8,%eax
+  8009e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009e6:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009eb:	e9 a8 00 00 00       	jmp    800a98 <vprintfmt+0x5c0>
+  8009f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fc:	eb e5                	jmp    8009e3 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a01:	83 f8 2f             	cmp    $0x2f,%eax
+  800a04:	77 15                	ja     800a1b <vprintfmt+0x543>
+  800a06:	89 c2                	mov    %eax,%edx
+  800a08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0c:	83 c0 08             	add    $0x8,%eax
+  800a0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a12:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a14:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a19:	eb 7d                	jmp    800a98 <vprintfmt+0x5c0>
+  800a1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a27:	eb e9                	jmp    800a12 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2f:	77 16                	ja     800a47 <vprintfmt+0x56f>
+  800a31:	89 c2                	mov    %eax,%edx
+  800a33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a37:	83 c0 08             	add    $0x8,%eax
+  800a3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a40:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a45:	eb 51                	jmp    800a98 <vprintfmt+0x5c0>
+  800a47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a53:	eb e8                	jmp    800a3d <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a61:	e9 5c ff ff ff       	jmp    8009c2 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a66:	4c 89 ee             	mov    %r13,%rsi
+  800a69:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a6e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a71:	4c 89 ee             	mov    %r13,%rsi
+  800a74:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a79:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a82:	77 47                	ja     800acb <vprintfmt+0x5f3>
+  800a84:	89 c2                	mov    %eax,%edx
+  800a86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8a:	83 c0 08             	add    $0x8,%eax
+  800a8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a90:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a93:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a98:	48 83 ec 08          	sub    $0x8,%rsp
+  800a9c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800aa0:	0f 94 c0             	sete   %al
+  800aa3:	0f b6 c0             	movzbl %al,%eax
+  800aa6:	50                   	push   %rax
+  800aa7:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800aac:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ab0:	4c 89 ee             	mov    %r13,%rsi
+  800ab3:	4c 89 f7             	mov    %r14,%rdi
+  800ab6:	48 b8 cd 03 80 00 00 	movabs $0x8003cd,%rax
+  800abd:	00 00 00 
+  800ac0:	ff d0                	call   *%rax
+            break;
+  800ac2:	48 83 c4 10          	add    $0x10,%rsp
+  800ac6:	e9 3e fa ff ff       	jmp    800509 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800acb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800acf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad7:	eb b7                	jmp    800a90 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ad9:	40 84 f6             	test   %sil,%sil
+  800adc:	75 2b                	jne    800b09 <vprintfmt+0x631>
+    switch (lflag) {
+  800ade:	85 d2                	test   %edx,%edx
+  800ae0:	74 56                	je     800b38 <vprintfmt+0x660>
+  800ae2:	83 fa 01             	cmp    $0x1,%edx
+  800ae5:	74 7f                	je     800b66 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800ae7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aea:	83 f8 2f             	cmp    $0x2f,%eax
+  800aed:	0f 87 a2 00 00 00    	ja     800b95 <vprintfmt+0x6bd>
+  800af3:	89 c2                	mov    %eax,%edx
+  800af5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af9:	83 c0 08             	add    $0x8,%eax
+  800afc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aff:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b02:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b07:	eb 8f                	jmp    800a98 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0f:	77 19                	ja     800b2a <vprintfmt+0x652>
+  800b11:	89 c2                	mov    %eax,%edx
+  800b13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b17:	83 c0 08             	add    $0x8,%eax
+  800b1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b20:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b25:	e9 6e ff ff ff       	jmp    800a98 <vprintfmt+0x5c0>
+  800b2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b36:	eb e5                	jmp    800b1d <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3e:	77 18                	ja     800b58 <vprintfmt+0x680>
+  800b40:	89 c2                	mov    %eax,%edx
+  800b42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b46:	83 c0 08             	add    $0x8,%eax
+  800b49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b4e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b53:	e9 40 ff ff ff       	jmp    800a98 <vprintfmt+0x5c0>
+  800b58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b64:	eb e6                	jmp    800b4c <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b66:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b69:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6c:	77 19                	ja     800b87 <vprintfmt+0x6af>
+  800b6e:	89 c2                	mov    %eax,%edx
+  800b70:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b74:	83 c0 08             	add    $0x8,%eax
+  800b77:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b7a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b7d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b82:	e9 11 ff ff ff       	jmp    800a98 <vprintfmt+0x5c0>
+  800b87:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b8b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b93:	eb e5                	jmp    800b7a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b99:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba1:	e9 59 ff ff ff       	jmp    800aff <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ba6:	4c 89 ee             	mov    %r13,%rsi
+  800ba9:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bae:	41 ff d6             	call   *%r14
+            break;
+  800bb1:	e9 53 f9 ff ff       	jmp    800509 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800bb6:	4c 89 ee             	mov    %r13,%rsi
+  800bb9:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bbe:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bc1:	48 83 eb 01          	sub    $0x1,%rbx
+  800bc5:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bc9:	75 f6                	jne    800bc1 <vprintfmt+0x6e9>
+  800bcb:	e9 39 f9 ff ff       	jmp    800509 <vprintfmt+0x31>
+}
+  800bd0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bd4:	5b                   	pop    %rbx
+  800bd5:	41 5c                	pop    %r12
+  800bd7:	41 5d                	pop    %r13
+  800bd9:	41 5e                	pop    %r14
+  800bdb:	41 5f                	pop    %r15
+  800bdd:	5d                   	pop    %rbp
+  800bde:	c3                   	ret
+
+0000000000800bdf <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bdf:	55                   	push   %rbp
+  800be0:	48 89 e5             	mov    %rsp,%rbp
+  800be3:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800be7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800beb:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800bf0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800bf4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800bfb:	48 85 ff             	test   %rdi,%rdi
+  800bfe:	74 2b                	je     800c2b <vsnprintf+0x4c>
+  800c00:	48 85 f6             	test   %rsi,%rsi
+  800c03:	74 26                	je     800c2b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c05:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c09:	48 bf 83 04 80 00 00 	movabs $0x800483,%rdi
+  800c10:	00 00 00 
+  800c13:	48 b8 d8 04 80 00 00 	movabs $0x8004d8,%rax
+  800c1a:	00 00 00 
+  800c1d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c23:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c26:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c29:	c9                   	leave
+  800c2a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c30:	eb f7                	jmp    800c29 <vsnprintf+0x4a>
+
+0000000000800c32 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c32:	55                   	push   %rbp
+  800c33:	48 89 e5             	mov    %rsp,%rbp
+  800c36:	48 83 ec 50          	sub    $0x50,%rsp
+  800c3a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c3e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c42:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c46:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c4d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c55:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c59:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c5d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c61:	48 b8 df 0b 80 00 00 	movabs $0x800bdf,%rax
+  800c68:	00 00 00 
+  800c6b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c6d:	c9                   	leave
+  800c6e:	c3                   	ret
+
+0000000000800c6f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c6f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c72:	74 10                	je     800c84 <strlen+0x15>
+    size_t n = 0;
+  800c74:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c79:	48 83 c0 01          	add    $0x1,%rax
+  800c7d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c81:	75 f6                	jne    800c79 <strlen+0xa>
+  800c83:	c3                   	ret
+    size_t n = 0;
+  800c84:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c89:	c3                   	ret
+
+0000000000800c8a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c8a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c8d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c92:	48 85 f6             	test   %rsi,%rsi
+  800c95:	74 11                	je     800ca8 <strnlen+0x1e>
+  800c97:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c9b:	74 0c                	je     800ca9 <strnlen+0x1f>
+  800c9d:	48 83 c2 01          	add    $0x1,%rdx
+  800ca1:	48 39 d0             	cmp    %rdx,%rax
+  800ca4:	75 f1                	jne    800c97 <strnlen+0xd>
+  800ca6:	eb 04                	jmp    800cac <strnlen+0x22>
+  800ca8:	c3                   	ret
+  800ca9:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800cac:	c3                   	ret
+
+0000000000800cad <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800cad:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800cb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800cb9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cbc:	48 83 c2 01          	add    $0x1,%rdx
+  800cc0:	84 c9                	test   %cl,%cl
+  800cc2:	75 f1                	jne    800cb5 <strcpy+0x8>
+        ;
+    return res;
+}
+  800cc4:	c3                   	ret
+
+0000000000800cc5 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800cc5:	55                   	push   %rbp
+  800cc6:	48 89 e5             	mov    %rsp,%rbp
+  800cc9:	41 54                	push   %r12
+  800ccb:	53                   	push   %rbx
+  800ccc:	48 89 fb             	mov    %rdi,%rbx
+  800ccf:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cd2:	48 b8 6f 0c 80 00 00 	movabs $0x800c6f,%rax
+  800cd9:	00 00 00 
+  800cdc:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cde:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ce2:	4c 89 e6             	mov    %r12,%rsi
+  800ce5:	48 b8 ad 0c 80 00 00 	movabs $0x800cad,%rax
+  800cec:	00 00 00 
+  800cef:	ff d0                	call   *%rax
+    return dst;
+}
+  800cf1:	48 89 d8             	mov    %rbx,%rax
+  800cf4:	5b                   	pop    %rbx
+  800cf5:	41 5c                	pop    %r12
+  800cf7:	5d                   	pop    %rbp
+  800cf8:	c3                   	ret
+
+0000000000800cf9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cf9:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800cfc:	48 85 d2             	test   %rdx,%rdx
+  800cff:	74 1f                	je     800d20 <strncpy+0x27>
+  800d01:	48 01 fa             	add    %rdi,%rdx
+  800d04:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d07:	48 83 c1 01          	add    $0x1,%rcx
+  800d0b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d0f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d13:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d17:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d1b:	48 39 ca             	cmp    %rcx,%rdx
+  800d1e:	75 e7                	jne    800d07 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d20:	c3                   	ret
+
+0000000000800d21 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d21:	48 89 f8             	mov    %rdi,%rax
+  800d24:	48 85 d2             	test   %rdx,%rdx
+  800d27:	74 24                	je     800d4d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d29:	48 83 ea 01          	sub    $0x1,%rdx
+  800d2d:	74 1b                	je     800d4a <strlcpy+0x29>
+  800d2f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d33:	0f b6 16             	movzbl (%rsi),%edx
+  800d36:	84 d2                	test   %dl,%dl
+  800d38:	74 10                	je     800d4a <strlcpy+0x29>
+            *dst++ = *src++;
+  800d3a:	48 83 c6 01          	add    $0x1,%rsi
+  800d3e:	48 83 c0 01          	add    $0x1,%rax
+  800d42:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d45:	48 39 c8             	cmp    %rcx,%rax
+  800d48:	75 e9                	jne    800d33 <strlcpy+0x12>
+        *dst = '\0';
+  800d4a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d4d:	48 29 f8             	sub    %rdi,%rax
+}
+  800d50:	c3                   	ret
+
+0000000000800d51 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d51:	0f b6 07             	movzbl (%rdi),%eax
+  800d54:	84 c0                	test   %al,%al
+  800d56:	74 13                	je     800d6b <strcmp+0x1a>
+  800d58:	38 06                	cmp    %al,(%rsi)
+  800d5a:	75 0f                	jne    800d6b <strcmp+0x1a>
+  800d5c:	48 83 c7 01          	add    $0x1,%rdi
+  800d60:	48 83 c6 01          	add    $0x1,%rsi
+  800d64:	0f b6 07             	movzbl (%rdi),%eax
+  800d67:	84 c0                	test   %al,%al
+  800d69:	75 ed                	jne    800d58 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d6b:	0f b6 c0             	movzbl %al,%eax
+  800d6e:	0f b6 16             	movzbl (%rsi),%edx
+  800d71:	29 d0                	sub    %edx,%eax
+}
+  800d73:	c3                   	ret
+
+0000000000800d74 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d74:	48 85 d2             	test   %rdx,%rdx
+  800d77:	74 1f                	je     800d98 <strncmp+0x24>
+  800d79:	0f b6 07             	movzbl (%rdi),%eax
+  800d7c:	84 c0                	test   %al,%al
+  800d7e:	74 1e                	je     800d9e <strncmp+0x2a>
+  800d80:	3a 06                	cmp    (%rsi),%al
+  800d82:	75 1a                	jne    800d9e <strncmp+0x2a>
+  800d84:	48 83 c7 01          	add    $0x1,%rdi
+  800d88:	48 83 c6 01          	add    $0x1,%rsi
+  800d8c:	48 83 ea 01          	sub    $0x1,%rdx
+  800d90:	75 e7                	jne    800d79 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d92:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d97:	c3                   	ret
+  800d98:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d9d:	c3                   	ret
+  800d9e:	48 85 d2             	test   %rdx,%rdx
+  800da1:	74 09                	je     800dac <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800da3:	0f b6 07             	movzbl (%rdi),%eax
+  800da6:	0f b6 16             	movzbl (%rsi),%edx
+  800da9:	29 d0                	sub    %edx,%eax
+  800dab:	c3                   	ret
+    if (!n) return 0;
+  800dac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800db1:	c3                   	ret
+
+0000000000800db2 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800db2:	0f b6 17             	movzbl (%rdi),%edx
+  800db5:	84 d2                	test   %dl,%dl
+  800db7:	74 18                	je     800dd1 <strchr+0x1f>
+        if (*str == c) {
+  800db9:	0f be d2             	movsbl %dl,%edx
+  800dbc:	39 f2                	cmp    %esi,%edx
+  800dbe:	74 17                	je     800dd7 <strchr+0x25>
+    for (; *str; str++) {
+  800dc0:	48 83 c7 01          	add    $0x1,%rdi
+  800dc4:	0f b6 17             	movzbl (%rdi),%edx
+  800dc7:	84 d2                	test   %dl,%dl
+  800dc9:	75 ee                	jne    800db9 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800dcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd0:	c3                   	ret
+  800dd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd6:	c3                   	ret
+  800dd7:	48 89 f8             	mov    %rdi,%rax
+}
+  800dda:	c3                   	ret
+
+0000000000800ddb <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800ddb:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800dde:	0f b6 17             	movzbl (%rdi),%edx
+  800de1:	84 d2                	test   %dl,%dl
+  800de3:	74 13                	je     800df8 <strfind+0x1d>
+  800de5:	0f be d2             	movsbl %dl,%edx
+  800de8:	39 f2                	cmp    %esi,%edx
+  800dea:	74 0b                	je     800df7 <strfind+0x1c>
+  800dec:	48 83 c0 01          	add    $0x1,%rax
+  800df0:	0f b6 10             	movzbl (%rax),%edx
+  800df3:	84 d2                	test   %dl,%dl
+  800df5:	75 ee                	jne    800de5 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800df7:	c3                   	ret
+  800df8:	c3                   	ret
+
+0000000000800df9 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800df9:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800dfc:	48 89 f8             	mov    %rdi,%rax
+  800dff:	48 f7 d8             	neg    %rax
+  800e02:	83 e0 07             	and    $0x7,%eax
+  800e05:	49 89 d1             	mov    %rdx,%r9
+  800e08:	49 29 c1             	sub    %rax,%r9
+  800e0b:	78 36                	js     800e43 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e0d:	40 0f b6 c6          	movzbl %sil,%eax
+  800e11:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e18:	01 01 01 
+  800e1b:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e1f:	40 f6 c7 07          	test   $0x7,%dil
+  800e23:	75 38                	jne    800e5d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e25:	4c 89 c9             	mov    %r9,%rcx
+  800e28:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e2c:	74 0c                	je     800e3a <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e2e:	fc                   	cld
+  800e2f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e32:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e36:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e3a:	4d 85 c9             	test   %r9,%r9
+  800e3d:	75 45                	jne    800e84 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e3f:	4c 89 c0             	mov    %r8,%rax
+  800e42:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e43:	48 85 d2             	test   %rdx,%rdx
+  800e46:	74 f7                	je     800e3f <memset+0x46>
+  800e48:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e4b:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e4e:	48 83 c0 01          	add    $0x1,%rax
+  800e52:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e56:	48 39 c2             	cmp    %rax,%rdx
+  800e59:	75 f3                	jne    800e4e <memset+0x55>
+  800e5b:	eb e2                	jmp    800e3f <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e5d:	40 f6 c7 01          	test   $0x1,%dil
+  800e61:	74 06                	je     800e69 <memset+0x70>
+  800e63:	88 07                	mov    %al,(%rdi)
+  800e65:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e69:	40 f6 c7 02          	test   $0x2,%dil
+  800e6d:	74 07                	je     800e76 <memset+0x7d>
+  800e6f:	66 89 07             	mov    %ax,(%rdi)
+  800e72:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e76:	40 f6 c7 04          	test   $0x4,%dil
+  800e7a:	74 a9                	je     800e25 <memset+0x2c>
+  800e7c:	89 07                	mov    %eax,(%rdi)
+  800e7e:	48 83 c7 04          	add    $0x4,%rdi
+  800e82:	eb a1                	jmp    800e25 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e84:	41 f6 c1 04          	test   $0x4,%r9b
+  800e88:	74 06                	je     800e90 <memset+0x97>
+  800e8a:	89 07                	mov    %eax,(%rdi)
+  800e8c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e90:	41 f6 c1 02          	test   $0x2,%r9b
+  800e94:	74 07                	je     800e9d <memset+0xa4>
+  800e96:	66 89 07             	mov    %ax,(%rdi)
+  800e99:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e9d:	41 f6 c1 01          	test   $0x1,%r9b
+  800ea1:	74 9c                	je     800e3f <memset+0x46>
+  800ea3:	88 07                	mov    %al,(%rdi)
+  800ea5:	eb 98                	jmp    800e3f <memset+0x46>
+
+0000000000800ea7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ea7:	48 89 f8             	mov    %rdi,%rax
+  800eaa:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ead:	48 39 fe             	cmp    %rdi,%rsi
+  800eb0:	73 3b                	jae    800eed <memmove+0x46>
+  800eb2:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800eb6:	48 39 d7             	cmp    %rdx,%rdi
+  800eb9:	73 32                	jae    800eed <memmove+0x46>
+        s += n;
+        d += n;
+  800ebb:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ebf:	48 89 d6             	mov    %rdx,%rsi
+  800ec2:	48 09 fe             	or     %rdi,%rsi
+  800ec5:	48 09 ce             	or     %rcx,%rsi
+  800ec8:	40 f6 c6 07          	test   $0x7,%sil
+  800ecc:	75 12                	jne    800ee0 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ece:	48 83 ef 08          	sub    $0x8,%rdi
+  800ed2:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800ed6:	48 c1 e9 03          	shr    $0x3,%rcx
+  800eda:	fd                   	std
+  800edb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800ede:	fc                   	cld
+  800edf:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ee0:	48 83 ef 01          	sub    $0x1,%rdi
+  800ee4:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ee8:	fd                   	std
+  800ee9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800eeb:	eb f1                	jmp    800ede <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800eed:	48 89 f2             	mov    %rsi,%rdx
+  800ef0:	48 09 c2             	or     %rax,%rdx
+  800ef3:	48 09 ca             	or     %rcx,%rdx
+  800ef6:	f6 c2 07             	test   $0x7,%dl
+  800ef9:	75 0c                	jne    800f07 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800efb:	48 c1 e9 03          	shr    $0x3,%rcx
+  800eff:	48 89 c7             	mov    %rax,%rdi
+  800f02:	fc                   	cld
+  800f03:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f06:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f07:	48 89 c7             	mov    %rax,%rdi
+  800f0a:	fc                   	cld
+  800f0b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f0d:	c3                   	ret
+
+0000000000800f0e <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f0e:	55                   	push   %rbp
+  800f0f:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f12:	48 b8 a7 0e 80 00 00 	movabs $0x800ea7,%rax
+  800f19:	00 00 00 
+  800f1c:	ff d0                	call   *%rax
+}
+  800f1e:	5d                   	pop    %rbp
+  800f1f:	c3                   	ret
+
+0000000000800f20 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f20:	55                   	push   %rbp
+  800f21:	48 89 e5             	mov    %rsp,%rbp
+  800f24:	41 57                	push   %r15
+  800f26:	41 56                	push   %r14
+  800f28:	41 55                	push   %r13
+  800f2a:	41 54                	push   %r12
+  800f2c:	53                   	push   %rbx
+  800f2d:	48 83 ec 08          	sub    $0x8,%rsp
+  800f31:	49 89 fe             	mov    %rdi,%r14
+  800f34:	49 89 f7             	mov    %rsi,%r15
+  800f37:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f3a:	48 89 f7             	mov    %rsi,%rdi
+  800f3d:	48 b8 6f 0c 80 00 00 	movabs $0x800c6f,%rax
+  800f44:	00 00 00 
+  800f47:	ff d0                	call   *%rax
+  800f49:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f4c:	48 89 de             	mov    %rbx,%rsi
+  800f4f:	4c 89 f7             	mov    %r14,%rdi
+  800f52:	48 b8 8a 0c 80 00 00 	movabs $0x800c8a,%rax
+  800f59:	00 00 00 
+  800f5c:	ff d0                	call   *%rax
+  800f5e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f61:	48 39 c3             	cmp    %rax,%rbx
+  800f64:	74 36                	je     800f9c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f66:	48 89 d8             	mov    %rbx,%rax
+  800f69:	4c 29 e8             	sub    %r13,%rax
+  800f6c:	49 39 c4             	cmp    %rax,%r12
+  800f6f:	73 31                	jae    800fa2 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f71:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f76:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f7a:	4c 89 fe             	mov    %r15,%rsi
+  800f7d:	48 b8 0e 0f 80 00 00 	movabs $0x800f0e,%rax
+  800f84:	00 00 00 
+  800f87:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f89:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f8d:	48 83 c4 08          	add    $0x8,%rsp
+  800f91:	5b                   	pop    %rbx
+  800f92:	41 5c                	pop    %r12
+  800f94:	41 5d                	pop    %r13
+  800f96:	41 5e                	pop    %r14
+  800f98:	41 5f                	pop    %r15
+  800f9a:	5d                   	pop    %rbp
+  800f9b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f9c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fa0:	eb eb                	jmp    800f8d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fa2:	48 83 eb 01          	sub    $0x1,%rbx
+  800fa6:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800faa:	48 89 da             	mov    %rbx,%rdx
+  800fad:	4c 89 fe             	mov    %r15,%rsi
+  800fb0:	48 b8 0e 0f 80 00 00 	movabs $0x800f0e,%rax
+  800fb7:	00 00 00 
+  800fba:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fbc:	49 01 de             	add    %rbx,%r14
+  800fbf:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fc4:	eb c3                	jmp    800f89 <strlcat+0x69>
+
+0000000000800fc6 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fc6:	48 85 d2             	test   %rdx,%rdx
+  800fc9:	74 2d                	je     800ff8 <memcmp+0x32>
+  800fcb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800fd0:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800fd4:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800fd9:	44 38 c1             	cmp    %r8b,%cl
+  800fdc:	75 0f                	jne    800fed <memcmp+0x27>
+    while (n-- > 0) {
+  800fde:	48 83 c0 01          	add    $0x1,%rax
+  800fe2:	48 39 c2             	cmp    %rax,%rdx
+  800fe5:	75 e9                	jne    800fd0 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800fe7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fec:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800fed:	0f b6 c1             	movzbl %cl,%eax
+  800ff0:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ff4:	44 29 c0             	sub    %r8d,%eax
+  800ff7:	c3                   	ret
+    return 0;
+  800ff8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ffd:	c3                   	ret
+
+0000000000800ffe <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800ffe:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801002:	48 39 c7             	cmp    %rax,%rdi
+  801005:	73 0f                	jae    801016 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801007:	40 38 37             	cmp    %sil,(%rdi)
+  80100a:	74 0e                	je     80101a <memfind+0x1c>
+    for (; src < end; src++) {
+  80100c:	48 83 c7 01          	add    $0x1,%rdi
+  801010:	48 39 f8             	cmp    %rdi,%rax
+  801013:	75 f2                	jne    801007 <memfind+0x9>
+  801015:	c3                   	ret
+  801016:	48 89 f8             	mov    %rdi,%rax
+  801019:	c3                   	ret
+  80101a:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80101d:	c3                   	ret
+
+000000000080101e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80101e:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801021:	0f b6 37             	movzbl (%rdi),%esi
+  801024:	40 80 fe 20          	cmp    $0x20,%sil
+  801028:	74 06                	je     801030 <strtol+0x12>
+  80102a:	40 80 fe 09          	cmp    $0x9,%sil
+  80102e:	75 13                	jne    801043 <strtol+0x25>
+  801030:	48 83 c7 01          	add    $0x1,%rdi
+  801034:	0f b6 37             	movzbl (%rdi),%esi
+  801037:	40 80 fe 20          	cmp    $0x20,%sil
+  80103b:	74 f3                	je     801030 <strtol+0x12>
+  80103d:	40 80 fe 09          	cmp    $0x9,%sil
+  801041:	74 ed                	je     801030 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801043:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801046:	83 e0 fd             	and    $0xfffffffd,%eax
+  801049:	3c 01                	cmp    $0x1,%al
+  80104b:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80104f:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801055:	75 0f                	jne    801066 <strtol+0x48>
+  801057:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80105a:	74 14                	je     801070 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80105c:	85 d2                	test   %edx,%edx
+  80105e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801063:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801066:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80106b:	4c 63 ca             	movslq %edx,%r9
+  80106e:	eb 36                	jmp    8010a6 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801070:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801074:	74 0f                	je     801085 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801076:	85 d2                	test   %edx,%edx
+  801078:	75 ec                	jne    801066 <strtol+0x48>
+        s++;
+  80107a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80107e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801083:	eb e1                	jmp    801066 <strtol+0x48>
+        s += 2;
+  801085:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801089:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80108e:	eb d6                	jmp    801066 <strtol+0x48>
+            dig -= '0';
+  801090:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801093:	44 0f b6 c1          	movzbl %cl,%r8d
+  801097:	41 39 d0             	cmp    %edx,%r8d
+  80109a:	7d 21                	jge    8010bd <strtol+0x9f>
+        val = val * base + dig;
+  80109c:	49 0f af c1          	imul   %r9,%rax
+  8010a0:	0f b6 c9             	movzbl %cl,%ecx
+  8010a3:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010a6:	48 83 c7 01          	add    $0x1,%rdi
+  8010aa:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010ae:	80 f9 39             	cmp    $0x39,%cl
+  8010b1:	76 dd                	jbe    801090 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010b3:	80 f9 7b             	cmp    $0x7b,%cl
+  8010b6:	77 05                	ja     8010bd <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010b8:	83 e9 57             	sub    $0x57,%ecx
+  8010bb:	eb d6                	jmp    801093 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010bd:	4d 85 d2             	test   %r10,%r10
+  8010c0:	74 03                	je     8010c5 <strtol+0xa7>
+  8010c2:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010c5:	48 89 c2             	mov    %rax,%rdx
+  8010c8:	48 f7 da             	neg    %rdx
+  8010cb:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010cf:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010d3:	c3                   	ret
+
+00000000008010d4 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010d4:	55                   	push   %rbp
+  8010d5:	48 89 e5             	mov    %rsp,%rbp
+  8010d8:	53                   	push   %rbx
+  8010d9:	48 89 fa             	mov    %rdi,%rdx
+  8010dc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010df:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010f9:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010ff:	c9                   	leave
+  801100:	c3                   	ret
+
+0000000000801101 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801101:	55                   	push   %rbp
+  801102:	48 89 e5             	mov    %rsp,%rbp
+  801105:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801106:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80110b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801110:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801115:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80111f:	be 00 00 00 00       	mov    $0x0,%esi
+  801124:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80112a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80112c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801130:	c9                   	leave
+  801131:	c3                   	ret
+
+0000000000801132 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801132:	55                   	push   %rbp
+  801133:	48 89 e5             	mov    %rsp,%rbp
+  801136:	53                   	push   %rbx
+  801137:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80113b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80113e:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801143:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801148:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801152:	be 00 00 00 00       	mov    $0x0,%esi
+  801157:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80115d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80115f:	48 85 c0             	test   %rax,%rax
+  801162:	7f 06                	jg     80116a <sys_env_destroy+0x38>
+}
+  801164:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801168:	c9                   	leave
+  801169:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80116a:	49 89 c0             	mov    %rax,%r8
+  80116d:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801172:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  801179:	00 00 00 
+  80117c:	be 26 00 00 00       	mov    $0x26,%esi
+  801181:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  801188:	00 00 00 
+  80118b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801190:	49 b9 38 02 80 00 00 	movabs $0x800238,%r9
+  801197:	00 00 00 
+  80119a:	41 ff d1             	call   *%r9
+
+000000000080119d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80119d:	55                   	push   %rbp
+  80119e:	48 89 e5             	mov    %rsp,%rbp
+  8011a1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011a2:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011c6:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011cc:	c9                   	leave
+  8011cd:	c3                   	ret
+
+00000000008011ce <sys_yield>:
+
+void
+sys_yield(void) {
+  8011ce:	55                   	push   %rbp
+  8011cf:	48 89 e5             	mov    %rsp,%rbp
+  8011d2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011d3:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f7:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011fd:	c9                   	leave
+  8011fe:	c3                   	ret
+
+00000000008011ff <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011ff:	55                   	push   %rbp
+  801200:	48 89 e5             	mov    %rsp,%rbp
+  801203:	53                   	push   %rbx
+  801204:	48 89 fa             	mov    %rdi,%rdx
+  801207:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80120a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80120f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801216:	00 00 00 
+  801219:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80121e:	be 00 00 00 00       	mov    $0x0,%esi
+  801223:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801229:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80122b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80122f:	c9                   	leave
+  801230:	c3                   	ret
+
+0000000000801231 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801231:	55                   	push   %rbp
+  801232:	48 89 e5             	mov    %rsp,%rbp
+  801235:	53                   	push   %rbx
+  801236:	49 89 f8             	mov    %rdi,%r8
+  801239:	48 89 d3             	mov    %rdx,%rbx
+  80123c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80123f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801244:	4c 89 c2             	mov    %r8,%rdx
+  801247:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80124a:	be 00 00 00 00       	mov    $0x0,%esi
+  80124f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801255:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801257:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80125b:	c9                   	leave
+  80125c:	c3                   	ret
+
+000000000080125d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80125d:	55                   	push   %rbp
+  80125e:	48 89 e5             	mov    %rsp,%rbp
+  801261:	53                   	push   %rbx
+  801262:	48 83 ec 08          	sub    $0x8,%rsp
+  801266:	89 f8                	mov    %edi,%eax
+  801268:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80126b:	48 63 f9             	movslq %ecx,%rdi
+  80126e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801271:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801276:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801279:	be 00 00 00 00       	mov    $0x0,%esi
+  80127e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801284:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801286:	48 85 c0             	test   %rax,%rax
+  801289:	7f 06                	jg     801291 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80128b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80128f:	c9                   	leave
+  801290:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801291:	49 89 c0             	mov    %rax,%r8
+  801294:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801299:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  8012a0:	00 00 00 
+  8012a3:	be 26 00 00 00       	mov    $0x26,%esi
+  8012a8:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  8012af:	00 00 00 
+  8012b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b7:	49 b9 38 02 80 00 00 	movabs $0x800238,%r9
+  8012be:	00 00 00 
+  8012c1:	41 ff d1             	call   *%r9
+
+00000000008012c4 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012c4:	55                   	push   %rbp
+  8012c5:	48 89 e5             	mov    %rsp,%rbp
+  8012c8:	53                   	push   %rbx
+  8012c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8012cd:	89 f8                	mov    %edi,%eax
+  8012cf:	49 89 f2             	mov    %rsi,%r10
+  8012d2:	48 89 cf             	mov    %rcx,%rdi
+  8012d5:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012d8:	48 63 da             	movslq %edx,%rbx
+  8012db:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012de:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012e3:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012e6:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012e9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012eb:	48 85 c0             	test   %rax,%rax
+  8012ee:	7f 06                	jg     8012f6 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f4:	c9                   	leave
+  8012f5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012f6:	49 89 c0             	mov    %rax,%r8
+  8012f9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012fe:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  801305:	00 00 00 
+  801308:	be 26 00 00 00       	mov    $0x26,%esi
+  80130d:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  801314:	00 00 00 
+  801317:	b8 00 00 00 00       	mov    $0x0,%eax
+  80131c:	49 b9 38 02 80 00 00 	movabs $0x800238,%r9
+  801323:	00 00 00 
+  801326:	41 ff d1             	call   *%r9
+
+0000000000801329 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801329:	55                   	push   %rbp
+  80132a:	48 89 e5             	mov    %rsp,%rbp
+  80132d:	53                   	push   %rbx
+  80132e:	48 83 ec 08          	sub    $0x8,%rsp
+  801332:	48 89 f1             	mov    %rsi,%rcx
+  801335:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801338:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80133b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801340:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801345:	be 00 00 00 00       	mov    $0x0,%esi
+  80134a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801350:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801352:	48 85 c0             	test   %rax,%rax
+  801355:	7f 06                	jg     80135d <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801357:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135b:	c9                   	leave
+  80135c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80135d:	49 89 c0             	mov    %rax,%r8
+  801360:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801365:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  80136c:	00 00 00 
+  80136f:	be 26 00 00 00       	mov    $0x26,%esi
+  801374:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  80137b:	00 00 00 
+  80137e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801383:	49 b9 38 02 80 00 00 	movabs $0x800238,%r9
+  80138a:	00 00 00 
+  80138d:	41 ff d1             	call   *%r9
+
+0000000000801390 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801390:	55                   	push   %rbp
+  801391:	48 89 e5             	mov    %rsp,%rbp
+  801394:	53                   	push   %rbx
+  801395:	48 83 ec 08          	sub    $0x8,%rsp
+  801399:	89 f8                	mov    %edi,%eax
+  80139b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  80139e:	48 63 f9             	movslq %ecx,%rdi
+  8013a1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a4:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013a9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013b9:	48 85 c0             	test   %rax,%rax
+  8013bc:	7f 06                	jg     8013c4 <sys_region_advise+0x34>
+}
+  8013be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c2:	c9                   	leave
+  8013c3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c4:	49 89 c0             	mov    %rax,%r8
+  8013c7:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8013cc:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  8013d3:	00 00 00 
+  8013d6:	be 26 00 00 00       	mov    $0x26,%esi
+  8013db:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  8013e2:	00 00 00 
+  8013e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ea:	49 b9 38 02 80 00 00 	movabs $0x800238,%r9
+  8013f1:	00 00 00 
+  8013f4:	41 ff d1             	call   *%r9
+
+00000000008013f7 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  8013f7:	55                   	push   %rbp
+  8013f8:	48 89 e5             	mov    %rsp,%rbp
+  8013fb:	53                   	push   %rbx
+  8013fc:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801400:	48 63 ce             	movslq %esi,%rcx
+  801403:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801406:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80140b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801410:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801415:	be 00 00 00 00       	mov    $0x0,%esi
+  80141a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801420:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801422:	48 85 c0             	test   %rax,%rax
+  801425:	7f 06                	jg     80142d <sys_env_set_nice+0x36>
+}
+  801427:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80142b:	c9                   	leave
+  80142c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80142d:	49 89 c0             	mov    %rax,%r8
+  801430:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801435:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  80143c:	00 00 00 
+  80143f:	be 26 00 00 00       	mov    $0x26,%esi
+  801444:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  80144b:	00 00 00 
+  80144e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801453:	49 b9 38 02 80 00 00 	movabs $0x800238,%r9
+  80145a:	00 00 00 
+  80145d:	41 ff d1             	call   *%r9
+
+0000000000801460 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801460:	55                   	push   %rbp
+  801461:	48 89 e5             	mov    %rsp,%rbp
+  801464:	53                   	push   %rbx
+  801465:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801469:	48 63 ce             	movslq %esi,%rcx
+  80146c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80146f:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801474:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801479:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80147e:	be 00 00 00 00       	mov    $0x0,%esi
+  801483:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801489:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80148b:	48 85 c0             	test   %rax,%rax
+  80148e:	7f 06                	jg     801496 <sys_env_set_status+0x36>
+}
+  801490:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801494:	c9                   	leave
+  801495:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801496:	49 89 c0             	mov    %rax,%r8
+  801499:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80149e:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  8014a5:	00 00 00 
+  8014a8:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ad:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  8014b4:	00 00 00 
+  8014b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014bc:	49 b9 38 02 80 00 00 	movabs $0x800238,%r9
+  8014c3:	00 00 00 
+  8014c6:	41 ff d1             	call   *%r9
+
+00000000008014c9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8014c9:	55                   	push   %rbp
+  8014ca:	48 89 e5             	mov    %rsp,%rbp
+  8014cd:	53                   	push   %rbx
+  8014ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8014d2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8014d5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d8:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014f4:	48 85 c0             	test   %rax,%rax
+  8014f7:	7f 06                	jg     8014ff <sys_env_set_trapframe+0x36>
+}
+  8014f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014fd:	c9                   	leave
+  8014fe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ff:	49 89 c0             	mov    %rax,%r8
+  801502:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801507:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  80150e:	00 00 00 
+  801511:	be 26 00 00 00       	mov    $0x26,%esi
+  801516:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  80151d:	00 00 00 
+  801520:	b8 00 00 00 00       	mov    $0x0,%eax
+  801525:	49 b9 38 02 80 00 00 	movabs $0x800238,%r9
+  80152c:	00 00 00 
+  80152f:	41 ff d1             	call   *%r9
+
+0000000000801532 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801532:	55                   	push   %rbp
+  801533:	48 89 e5             	mov    %rsp,%rbp
+  801536:	53                   	push   %rbx
+  801537:	48 83 ec 08          	sub    $0x8,%rsp
+  80153b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80153e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801541:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801546:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80154b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801550:	be 00 00 00 00       	mov    $0x0,%esi
+  801555:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80155b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80155d:	48 85 c0             	test   %rax,%rax
+  801560:	7f 06                	jg     801568 <sys_env_set_pgfault_upcall+0x36>
+}
+  801562:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801566:	c9                   	leave
+  801567:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801568:	49 89 c0             	mov    %rax,%r8
+  80156b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801570:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  801577:	00 00 00 
+  80157a:	be 26 00 00 00       	mov    $0x26,%esi
+  80157f:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  801586:	00 00 00 
+  801589:	b8 00 00 00 00       	mov    $0x0,%eax
+  80158e:	49 b9 38 02 80 00 00 	movabs $0x800238,%r9
+  801595:	00 00 00 
+  801598:	41 ff d1             	call   *%r9
+
+000000000080159b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80159b:	55                   	push   %rbp
+  80159c:	48 89 e5             	mov    %rsp,%rbp
+  80159f:	53                   	push   %rbx
+  8015a0:	89 f8                	mov    %edi,%eax
+  8015a2:	49 89 f1             	mov    %rsi,%r9
+  8015a5:	48 89 d3             	mov    %rdx,%rbx
+  8015a8:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015ab:	49 63 f0             	movslq %r8d,%rsi
+  8015ae:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b1:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b6:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015bf:	cd 30                	int    $0x30
+}
+  8015c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c5:	c9                   	leave
+  8015c6:	c3                   	ret
+
+00000000008015c7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8015c7:	55                   	push   %rbp
+  8015c8:	48 89 e5             	mov    %rsp,%rbp
+  8015cb:	53                   	push   %rbx
+  8015cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8015d0:	48 89 fa             	mov    %rdi,%rdx
+  8015d3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d6:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015f2:	48 85 c0             	test   %rax,%rax
+  8015f5:	7f 06                	jg     8015fd <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015fb:	c9                   	leave
+  8015fc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015fd:	49 89 c0             	mov    %rax,%r8
+  801600:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801605:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  80160c:	00 00 00 
+  80160f:	be 26 00 00 00       	mov    $0x26,%esi
+  801614:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  80161b:	00 00 00 
+  80161e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801623:	49 b9 38 02 80 00 00 	movabs $0x800238,%r9
+  80162a:	00 00 00 
+  80162d:	41 ff d1             	call   *%r9
+
+0000000000801630 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801630:	55                   	push   %rbp
+  801631:	48 89 e5             	mov    %rsp,%rbp
+  801634:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801635:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80163a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80163f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801644:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801649:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80164e:	be 00 00 00 00       	mov    $0x0,%esi
+  801653:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801659:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80165b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80165f:	c9                   	leave
+  801660:	c3                   	ret
+
+0000000000801661 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  801661:	55                   	push   %rbp
+  801662:	48 89 e5             	mov    %rsp,%rbp
+  801665:	53                   	push   %rbx
+  801666:	48 83 ec 08          	sub    $0x8,%rsp
+  80166a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  80166d:	48 63 ce             	movslq %esi,%rcx
+  801670:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801673:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801678:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80167d:	be 00 00 00 00       	mov    $0x0,%esi
+  801682:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801688:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80168a:	48 85 c0             	test   %rax,%rax
+  80168d:	7f 06                	jg     801695 <sys_sigqueue+0x34>
+}
+  80168f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801693:	c9                   	leave
+  801694:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801695:	49 89 c0             	mov    %rax,%r8
+  801698:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80169d:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  8016a4:	00 00 00 
+  8016a7:	be 26 00 00 00       	mov    $0x26,%esi
+  8016ac:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  8016b3:	00 00 00 
+  8016b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016bb:	49 b9 38 02 80 00 00 	movabs $0x800238,%r9
+  8016c2:	00 00 00 
+  8016c5:	41 ff d1             	call   *%r9
+
+00000000008016c8 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8016c8:	55                   	push   %rbp
+  8016c9:	48 89 e5             	mov    %rsp,%rbp
+  8016cc:	53                   	push   %rbx
+  8016cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8016d1:	48 89 fa             	mov    %rdi,%rdx
+  8016d4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d7:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8016eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016f3:	48 85 c0             	test   %rax,%rax
+  8016f6:	7f 06                	jg     8016fe <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  8016f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016fc:	c9                   	leave
+  8016fd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016fe:	49 89 c0             	mov    %rax,%r8
+  801701:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801706:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  80170d:	00 00 00 
+  801710:	be 26 00 00 00       	mov    $0x26,%esi
+  801715:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  80171c:	00 00 00 
+  80171f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801724:	49 b9 38 02 80 00 00 	movabs $0x800238,%r9
+  80172b:	00 00 00 
+  80172e:	41 ff d1             	call   *%r9
+
+0000000000801731 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801731:	55                   	push   %rbp
+  801732:	48 89 e5             	mov    %rsp,%rbp
+  801735:	53                   	push   %rbx
+  801736:	48 83 ec 08          	sub    $0x8,%rsp
+  80173a:	48 89 f1             	mov    %rsi,%rcx
+  80173d:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801740:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801743:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801748:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80174d:	be 00 00 00 00       	mov    $0x0,%esi
+  801752:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801758:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80175a:	48 85 c0             	test   %rax,%rax
+  80175d:	7f 06                	jg     801765 <sys_sigaction+0x34>
+}
+  80175f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801763:	c9                   	leave
+  801764:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801765:	49 89 c0             	mov    %rax,%r8
+  801768:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80176d:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  801774:	00 00 00 
+  801777:	be 26 00 00 00       	mov    $0x26,%esi
+  80177c:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  801783:	00 00 00 
+  801786:	b8 00 00 00 00       	mov    $0x0,%eax
+  80178b:	49 b9 38 02 80 00 00 	movabs $0x800238,%r9
+  801792:	00 00 00 
+  801795:	41 ff d1             	call   *%r9
+
+0000000000801798 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801798:	55                   	push   %rbp
+  801799:	48 89 e5             	mov    %rsp,%rbp
+  80179c:	53                   	push   %rbx
+  80179d:	48 83 ec 08          	sub    $0x8,%rsp
+  8017a1:	48 89 f1             	mov    %rsi,%rcx
+  8017a4:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8017a7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017aa:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017bf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017c1:	48 85 c0             	test   %rax,%rax
+  8017c4:	7f 06                	jg     8017cc <sys_sigprocmask+0x34>
+}
+  8017c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ca:	c9                   	leave
+  8017cb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017cc:	49 89 c0             	mov    %rax,%r8
+  8017cf:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8017d4:	48 ba 30 33 80 00 00 	movabs $0x803330,%rdx
+  8017db:	00 00 00 
+  8017de:	be 26 00 00 00       	mov    $0x26,%esi
+  8017e3:	48 bf 4f 33 80 00 00 	movabs $0x80334f,%rdi
+  8017ea:	00 00 00 
+  8017ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f2:	49 b9 38 02 80 00 00 	movabs $0x800238,%r9
+  8017f9:	00 00 00 
+  8017fc:	41 ff d1             	call   *%r9
+
+00000000008017ff <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8017ff:	55                   	push   %rbp
+  801800:	48 89 e5             	mov    %rsp,%rbp
+  801803:	41 54                	push   %r12
+  801805:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801806:	b8 08 00 00 00       	mov    $0x8,%eax
+  80180b:	cd 30                	int    $0x30
+  80180d:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  801810:	85 c0                	test   %eax,%eax
+  801812:	78 76                	js     80188a <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  801814:	74 7c                	je     801892 <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  801816:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80181c:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801823:	00 00 00 
+  801826:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80182b:	89 c2                	mov    %eax,%edx
+  80182d:	be 00 00 00 00       	mov    $0x0,%esi
+  801832:	bf 00 00 00 00       	mov    $0x0,%edi
+  801837:	48 b8 c4 12 80 00 00 	movabs $0x8012c4,%rax
+  80183e:	00 00 00 
+  801841:	ff d0                	call   *%rax
+  801843:	85 c0                	test   %eax,%eax
+  801845:	75 7a                	jne    8018c1 <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  801847:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  80184e:	00 00 00 
+  801851:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801858:	44 89 e7             	mov    %r12d,%edi
+  80185b:	48 b8 32 15 80 00 00 	movabs $0x801532,%rax
+  801862:	00 00 00 
+  801865:	ff d0                	call   *%rax
+  801867:	85 c0                	test   %eax,%eax
+  801869:	75 5e                	jne    8018c9 <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  80186b:	be 02 00 00 00       	mov    $0x2,%esi
+  801870:	44 89 e7             	mov    %r12d,%edi
+  801873:	48 b8 60 14 80 00 00 	movabs $0x801460,%rax
+  80187a:	00 00 00 
+  80187d:	ff d0                	call   *%rax
+        return -1;
+  80187f:	85 c0                	test   %eax,%eax
+  801881:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801886:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  80188a:	44 89 e0             	mov    %r12d,%eax
+  80188d:	5b                   	pop    %rbx
+  80188e:	41 5c                	pop    %r12
+  801890:	5d                   	pop    %rbp
+  801891:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  801892:	48 b8 9d 11 80 00 00 	movabs $0x80119d,%rax
+  801899:	00 00 00 
+  80189c:	ff d0                	call   *%rax
+  80189e:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  8018a1:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8018a8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018af:	00 00 00 
+  8018b2:	48 01 d0             	add    %rdx,%rax
+  8018b5:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  8018bc:	00 00 00 
+        return 0;
+  8018bf:	eb c9                	jmp    80188a <fork+0x8b>
+        return -1;
+  8018c1:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8018c7:	eb c1                	jmp    80188a <fork+0x8b>
+        return -1;
+  8018c9:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8018cf:	eb b9                	jmp    80188a <fork+0x8b>
+
+00000000008018d1 <sfork>:
+
+envid_t
+sfork() {
+  8018d1:	55                   	push   %rbp
+  8018d2:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8018d5:	48 ba 5d 33 80 00 00 	movabs $0x80335d,%rdx
+  8018dc:	00 00 00 
+  8018df:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8018e4:	48 bf 78 33 80 00 00 	movabs $0x803378,%rdi
+  8018eb:	00 00 00 
+  8018ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f3:	48 b9 38 02 80 00 00 	movabs $0x800238,%rcx
+  8018fa:	00 00 00 
+  8018fd:	ff d1                	call   *%rcx
+
+00000000008018ff <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018ff:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801906:	ff ff ff 
+  801909:	48 01 f8             	add    %rdi,%rax
+  80190c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801910:	c3                   	ret
+
+0000000000801911 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801911:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801918:	ff ff ff 
+  80191b:	48 01 f8             	add    %rdi,%rax
+  80191e:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801922:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801928:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80192c:	c3                   	ret
+
+000000000080192d <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80192d:	55                   	push   %rbp
+  80192e:	48 89 e5             	mov    %rsp,%rbp
+  801931:	41 57                	push   %r15
+  801933:	41 56                	push   %r14
+  801935:	41 55                	push   %r13
+  801937:	41 54                	push   %r12
+  801939:	53                   	push   %rbx
+  80193a:	48 83 ec 08          	sub    $0x8,%rsp
+  80193e:	49 89 ff             	mov    %rdi,%r15
+  801941:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801946:	49 bd ab 28 80 00 00 	movabs $0x8028ab,%r13
+  80194d:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801950:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801956:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801959:	48 89 df             	mov    %rbx,%rdi
+  80195c:	41 ff d5             	call   *%r13
+  80195f:	83 e0 04             	and    $0x4,%eax
+  801962:	74 17                	je     80197b <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801964:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80196b:	4c 39 f3             	cmp    %r14,%rbx
+  80196e:	75 e6                	jne    801956 <fd_alloc+0x29>
+  801970:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801976:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80197b:	4d 89 27             	mov    %r12,(%r15)
+}
+  80197e:	48 83 c4 08          	add    $0x8,%rsp
+  801982:	5b                   	pop    %rbx
+  801983:	41 5c                	pop    %r12
+  801985:	41 5d                	pop    %r13
+  801987:	41 5e                	pop    %r14
+  801989:	41 5f                	pop    %r15
+  80198b:	5d                   	pop    %rbp
+  80198c:	c3                   	ret
+
+000000000080198d <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80198d:	83 ff 1f             	cmp    $0x1f,%edi
+  801990:	77 39                	ja     8019cb <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801992:	55                   	push   %rbp
+  801993:	48 89 e5             	mov    %rsp,%rbp
+  801996:	41 54                	push   %r12
+  801998:	53                   	push   %rbx
+  801999:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80199c:	48 63 df             	movslq %edi,%rbx
+  80199f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019a6:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8019aa:	48 89 df             	mov    %rbx,%rdi
+  8019ad:	48 b8 ab 28 80 00 00 	movabs $0x8028ab,%rax
+  8019b4:	00 00 00 
+  8019b7:	ff d0                	call   *%rax
+  8019b9:	a8 04                	test   $0x4,%al
+  8019bb:	74 14                	je     8019d1 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8019bd:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8019c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019c6:	5b                   	pop    %rbx
+  8019c7:	41 5c                	pop    %r12
+  8019c9:	5d                   	pop    %rbp
+  8019ca:	c3                   	ret
+        return -E_INVAL;
+  8019cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8019d0:	c3                   	ret
+        return -E_INVAL;
+  8019d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019d6:	eb ee                	jmp    8019c6 <fd_lookup+0x39>
+
+00000000008019d8 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8019d8:	55                   	push   %rbp
+  8019d9:	48 89 e5             	mov    %rsp,%rbp
+  8019dc:	41 54                	push   %r12
+  8019de:	53                   	push   %rbx
+  8019df:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8019e2:	48 b8 20 34 80 00 00 	movabs $0x803420,%rax
+  8019e9:	00 00 00 
+  8019ec:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8019f3:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8019f6:	39 3b                	cmp    %edi,(%rbx)
+  8019f8:	74 47                	je     801a41 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8019fa:	48 83 c0 08          	add    $0x8,%rax
+  8019fe:	48 8b 18             	mov    (%rax),%rbx
+  801a01:	48 85 db             	test   %rbx,%rbx
+  801a04:	75 f0                	jne    8019f6 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a06:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801a0d:	00 00 00 
+  801a10:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a16:	89 fa                	mov    %edi,%edx
+  801a18:	48 bf 88 33 80 00 00 	movabs $0x803388,%rdi
+  801a1f:	00 00 00 
+  801a22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a27:	48 b9 88 03 80 00 00 	movabs $0x800388,%rcx
+  801a2e:	00 00 00 
+  801a31:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a33:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a38:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a3c:	5b                   	pop    %rbx
+  801a3d:	41 5c                	pop    %r12
+  801a3f:	5d                   	pop    %rbp
+  801a40:	c3                   	ret
+            return 0;
+  801a41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a46:	eb f0                	jmp    801a38 <dev_lookup+0x60>
+
+0000000000801a48 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a48:	55                   	push   %rbp
+  801a49:	48 89 e5             	mov    %rsp,%rbp
+  801a4c:	41 55                	push   %r13
+  801a4e:	41 54                	push   %r12
+  801a50:	53                   	push   %rbx
+  801a51:	48 83 ec 18          	sub    $0x18,%rsp
+  801a55:	48 89 fb             	mov    %rdi,%rbx
+  801a58:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a5b:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a62:	ff ff ff 
+  801a65:	48 01 df             	add    %rbx,%rdi
+  801a68:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a6c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a70:	48 b8 8d 19 80 00 00 	movabs $0x80198d,%rax
+  801a77:	00 00 00 
+  801a7a:	ff d0                	call   *%rax
+  801a7c:	41 89 c5             	mov    %eax,%r13d
+  801a7f:	85 c0                	test   %eax,%eax
+  801a81:	78 06                	js     801a89 <fd_close+0x41>
+  801a83:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a87:	74 1a                	je     801aa3 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a89:	45 84 e4             	test   %r12b,%r12b
+  801a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a91:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a95:	44 89 e8             	mov    %r13d,%eax
+  801a98:	48 83 c4 18          	add    $0x18,%rsp
+  801a9c:	5b                   	pop    %rbx
+  801a9d:	41 5c                	pop    %r12
+  801a9f:	41 5d                	pop    %r13
+  801aa1:	5d                   	pop    %rbp
+  801aa2:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801aa3:	8b 3b                	mov    (%rbx),%edi
+  801aa5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801aa9:	48 b8 d8 19 80 00 00 	movabs $0x8019d8,%rax
+  801ab0:	00 00 00 
+  801ab3:	ff d0                	call   *%rax
+  801ab5:	41 89 c5             	mov    %eax,%r13d
+  801ab8:	85 c0                	test   %eax,%eax
+  801aba:	78 1b                	js     801ad7 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801abc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ac0:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801ac4:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801aca:	48 85 c0             	test   %rax,%rax
+  801acd:	74 08                	je     801ad7 <fd_close+0x8f>
+  801acf:	48 89 df             	mov    %rbx,%rdi
+  801ad2:	ff d0                	call   *%rax
+  801ad4:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801ad7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801adc:	48 89 de             	mov    %rbx,%rsi
+  801adf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ae4:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  801aeb:	00 00 00 
+  801aee:	ff d0                	call   *%rax
+    return res;
+  801af0:	eb a3                	jmp    801a95 <fd_close+0x4d>
+
+0000000000801af2 <close>:
+
+int
+close(int fdnum) {
+  801af2:	55                   	push   %rbp
+  801af3:	48 89 e5             	mov    %rsp,%rbp
+  801af6:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801afa:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801afe:	48 b8 8d 19 80 00 00 	movabs $0x80198d,%rax
+  801b05:	00 00 00 
+  801b08:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b0a:	85 c0                	test   %eax,%eax
+  801b0c:	78 15                	js     801b23 <close+0x31>
+
+    return fd_close(fd, 1);
+  801b0e:	be 01 00 00 00       	mov    $0x1,%esi
+  801b13:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b17:	48 b8 48 1a 80 00 00 	movabs $0x801a48,%rax
+  801b1e:	00 00 00 
+  801b21:	ff d0                	call   *%rax
+}
+  801b23:	c9                   	leave
+  801b24:	c3                   	ret
+
+0000000000801b25 <close_all>:
+
+void
+close_all(void) {
+  801b25:	55                   	push   %rbp
+  801b26:	48 89 e5             	mov    %rsp,%rbp
+  801b29:	41 54                	push   %r12
+  801b2b:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b31:	49 bc f2 1a 80 00 00 	movabs $0x801af2,%r12
+  801b38:	00 00 00 
+  801b3b:	89 df                	mov    %ebx,%edi
+  801b3d:	41 ff d4             	call   *%r12
+  801b40:	83 c3 01             	add    $0x1,%ebx
+  801b43:	83 fb 20             	cmp    $0x20,%ebx
+  801b46:	75 f3                	jne    801b3b <close_all+0x16>
+}
+  801b48:	5b                   	pop    %rbx
+  801b49:	41 5c                	pop    %r12
+  801b4b:	5d                   	pop    %rbp
+  801b4c:	c3                   	ret
+
+0000000000801b4d <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b4d:	55                   	push   %rbp
+  801b4e:	48 89 e5             	mov    %rsp,%rbp
+  801b51:	41 57                	push   %r15
+  801b53:	41 56                	push   %r14
+  801b55:	41 55                	push   %r13
+  801b57:	41 54                	push   %r12
+  801b59:	53                   	push   %rbx
+  801b5a:	48 83 ec 18          	sub    $0x18,%rsp
+  801b5e:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b61:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b65:	48 b8 8d 19 80 00 00 	movabs $0x80198d,%rax
+  801b6c:	00 00 00 
+  801b6f:	ff d0                	call   *%rax
+  801b71:	89 c3                	mov    %eax,%ebx
+  801b73:	85 c0                	test   %eax,%eax
+  801b75:	0f 88 b8 00 00 00    	js     801c33 <dup+0xe6>
+    close(newfdnum);
+  801b7b:	44 89 e7             	mov    %r12d,%edi
+  801b7e:	48 b8 f2 1a 80 00 00 	movabs $0x801af2,%rax
+  801b85:	00 00 00 
+  801b88:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b8a:	4d 63 ec             	movslq %r12d,%r13
+  801b8d:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801b94:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801b98:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b9c:	4c 89 ff             	mov    %r15,%rdi
+  801b9f:	49 be 11 19 80 00 00 	movabs $0x801911,%r14
+  801ba6:	00 00 00 
+  801ba9:	41 ff d6             	call   *%r14
+  801bac:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801baf:	4c 89 ef             	mov    %r13,%rdi
+  801bb2:	41 ff d6             	call   *%r14
+  801bb5:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801bb8:	48 89 df             	mov    %rbx,%rdi
+  801bbb:	48 b8 ab 28 80 00 00 	movabs $0x8028ab,%rax
+  801bc2:	00 00 00 
+  801bc5:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801bc7:	a8 04                	test   $0x4,%al
+  801bc9:	74 2b                	je     801bf6 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801bcb:	41 89 c1             	mov    %eax,%r9d
+  801bce:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bd4:	4c 89 f1             	mov    %r14,%rcx
+  801bd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bdc:	48 89 de             	mov    %rbx,%rsi
+  801bdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801be4:	48 b8 c4 12 80 00 00 	movabs $0x8012c4,%rax
+  801beb:	00 00 00 
+  801bee:	ff d0                	call   *%rax
+  801bf0:	89 c3                	mov    %eax,%ebx
+  801bf2:	85 c0                	test   %eax,%eax
+  801bf4:	78 4e                	js     801c44 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801bf6:	4c 89 ff             	mov    %r15,%rdi
+  801bf9:	48 b8 ab 28 80 00 00 	movabs $0x8028ab,%rax
+  801c00:	00 00 00 
+  801c03:	ff d0                	call   *%rax
+  801c05:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c08:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c0e:	4c 89 e9             	mov    %r13,%rcx
+  801c11:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c16:	4c 89 fe             	mov    %r15,%rsi
+  801c19:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c1e:	48 b8 c4 12 80 00 00 	movabs $0x8012c4,%rax
+  801c25:	00 00 00 
+  801c28:	ff d0                	call   *%rax
+  801c2a:	89 c3                	mov    %eax,%ebx
+  801c2c:	85 c0                	test   %eax,%eax
+  801c2e:	78 14                	js     801c44 <dup+0xf7>
+
+    return newfdnum;
+  801c30:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c33:	89 d8                	mov    %ebx,%eax
+  801c35:	48 83 c4 18          	add    $0x18,%rsp
+  801c39:	5b                   	pop    %rbx
+  801c3a:	41 5c                	pop    %r12
+  801c3c:	41 5d                	pop    %r13
+  801c3e:	41 5e                	pop    %r14
+  801c40:	41 5f                	pop    %r15
+  801c42:	5d                   	pop    %rbp
+  801c43:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c44:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c49:	4c 89 ee             	mov    %r13,%rsi
+  801c4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c51:	49 bc 29 13 80 00 00 	movabs $0x801329,%r12
+  801c58:	00 00 00 
+  801c5b:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c5e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c63:	4c 89 f6             	mov    %r14,%rsi
+  801c66:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c6b:	41 ff d4             	call   *%r12
+    return res;
+  801c6e:	eb c3                	jmp    801c33 <dup+0xe6>
+
+0000000000801c70 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c70:	55                   	push   %rbp
+  801c71:	48 89 e5             	mov    %rsp,%rbp
+  801c74:	41 56                	push   %r14
+  801c76:	41 55                	push   %r13
+  801c78:	41 54                	push   %r12
+  801c7a:	53                   	push   %rbx
+  801c7b:	48 83 ec 10          	sub    $0x10,%rsp
+  801c7f:	89 fb                	mov    %edi,%ebx
+  801c81:	49 89 f4             	mov    %rsi,%r12
+  801c84:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c87:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c8b:	48 b8 8d 19 80 00 00 	movabs $0x80198d,%rax
+  801c92:	00 00 00 
+  801c95:	ff d0                	call   *%rax
+  801c97:	85 c0                	test   %eax,%eax
+  801c99:	78 4c                	js     801ce7 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c9b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c9f:	41 8b 3e             	mov    (%r14),%edi
+  801ca2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ca6:	48 b8 d8 19 80 00 00 	movabs $0x8019d8,%rax
+  801cad:	00 00 00 
+  801cb0:	ff d0                	call   *%rax
+  801cb2:	85 c0                	test   %eax,%eax
+  801cb4:	78 35                	js     801ceb <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cb6:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801cba:	83 e0 03             	and    $0x3,%eax
+  801cbd:	83 f8 01             	cmp    $0x1,%eax
+  801cc0:	74 2d                	je     801cef <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801cc2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cc6:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801cca:	48 85 c0             	test   %rax,%rax
+  801ccd:	74 56                	je     801d25 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ccf:	4c 89 ea             	mov    %r13,%rdx
+  801cd2:	4c 89 e6             	mov    %r12,%rsi
+  801cd5:	4c 89 f7             	mov    %r14,%rdi
+  801cd8:	ff d0                	call   *%rax
+}
+  801cda:	48 83 c4 10          	add    $0x10,%rsp
+  801cde:	5b                   	pop    %rbx
+  801cdf:	41 5c                	pop    %r12
+  801ce1:	41 5d                	pop    %r13
+  801ce3:	41 5e                	pop    %r14
+  801ce5:	5d                   	pop    %rbp
+  801ce6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ce7:	48 98                	cltq
+  801ce9:	eb ef                	jmp    801cda <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ceb:	48 98                	cltq
+  801ced:	eb eb                	jmp    801cda <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cef:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801cf6:	00 00 00 
+  801cf9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cff:	89 da                	mov    %ebx,%edx
+  801d01:	48 bf c9 33 80 00 00 	movabs $0x8033c9,%rdi
+  801d08:	00 00 00 
+  801d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d10:	48 b9 88 03 80 00 00 	movabs $0x800388,%rcx
+  801d17:	00 00 00 
+  801d1a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d1c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d23:	eb b5                	jmp    801cda <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d25:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d2c:	eb ac                	jmp    801cda <read+0x6a>
+
+0000000000801d2e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d2e:	55                   	push   %rbp
+  801d2f:	48 89 e5             	mov    %rsp,%rbp
+  801d32:	41 57                	push   %r15
+  801d34:	41 56                	push   %r14
+  801d36:	41 55                	push   %r13
+  801d38:	41 54                	push   %r12
+  801d3a:	53                   	push   %rbx
+  801d3b:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d3f:	48 85 d2             	test   %rdx,%rdx
+  801d42:	74 54                	je     801d98 <readn+0x6a>
+  801d44:	41 89 fd             	mov    %edi,%r13d
+  801d47:	49 89 f6             	mov    %rsi,%r14
+  801d4a:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d52:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d57:	49 bf 70 1c 80 00 00 	movabs $0x801c70,%r15
+  801d5e:	00 00 00 
+  801d61:	4c 89 e2             	mov    %r12,%rdx
+  801d64:	48 29 f2             	sub    %rsi,%rdx
+  801d67:	4c 01 f6             	add    %r14,%rsi
+  801d6a:	44 89 ef             	mov    %r13d,%edi
+  801d6d:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d70:	85 c0                	test   %eax,%eax
+  801d72:	78 20                	js     801d94 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d74:	01 c3                	add    %eax,%ebx
+  801d76:	85 c0                	test   %eax,%eax
+  801d78:	74 08                	je     801d82 <readn+0x54>
+  801d7a:	48 63 f3             	movslq %ebx,%rsi
+  801d7d:	4c 39 e6             	cmp    %r12,%rsi
+  801d80:	72 df                	jb     801d61 <readn+0x33>
+    }
+    return res;
+  801d82:	48 63 c3             	movslq %ebx,%rax
+}
+  801d85:	48 83 c4 08          	add    $0x8,%rsp
+  801d89:	5b                   	pop    %rbx
+  801d8a:	41 5c                	pop    %r12
+  801d8c:	41 5d                	pop    %r13
+  801d8e:	41 5e                	pop    %r14
+  801d90:	41 5f                	pop    %r15
+  801d92:	5d                   	pop    %rbp
+  801d93:	c3                   	ret
+        if (inc < 0) return inc;
+  801d94:	48 98                	cltq
+  801d96:	eb ed                	jmp    801d85 <readn+0x57>
+    int inc = 1, res = 0;
+  801d98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d9d:	eb e3                	jmp    801d82 <readn+0x54>
+
+0000000000801d9f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d9f:	55                   	push   %rbp
+  801da0:	48 89 e5             	mov    %rsp,%rbp
+  801da3:	41 56                	push   %r14
+  801da5:	41 55                	push   %r13
+  801da7:	41 54                	push   %r12
+  801da9:	53                   	push   %rbx
+  801daa:	48 83 ec 10          	sub    $0x10,%rsp
+  801dae:	89 fb                	mov    %edi,%ebx
+  801db0:	49 89 f4             	mov    %rsi,%r12
+  801db3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801db6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dba:	48 b8 8d 19 80 00 00 	movabs $0x80198d,%rax
+  801dc1:	00 00 00 
+  801dc4:	ff d0                	call   *%rax
+  801dc6:	85 c0                	test   %eax,%eax
+  801dc8:	78 47                	js     801e11 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dca:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801dce:	41 8b 3e             	mov    (%r14),%edi
+  801dd1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dd5:	48 b8 d8 19 80 00 00 	movabs $0x8019d8,%rax
+  801ddc:	00 00 00 
+  801ddf:	ff d0                	call   *%rax
+  801de1:	85 c0                	test   %eax,%eax
+  801de3:	78 30                	js     801e15 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801de5:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801dea:	74 2d                	je     801e19 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801df0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801df4:	48 85 c0             	test   %rax,%rax
+  801df7:	74 56                	je     801e4f <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801df9:	4c 89 ea             	mov    %r13,%rdx
+  801dfc:	4c 89 e6             	mov    %r12,%rsi
+  801dff:	4c 89 f7             	mov    %r14,%rdi
+  801e02:	ff d0                	call   *%rax
+}
+  801e04:	48 83 c4 10          	add    $0x10,%rsp
+  801e08:	5b                   	pop    %rbx
+  801e09:	41 5c                	pop    %r12
+  801e0b:	41 5d                	pop    %r13
+  801e0d:	41 5e                	pop    %r14
+  801e0f:	5d                   	pop    %rbp
+  801e10:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e11:	48 98                	cltq
+  801e13:	eb ef                	jmp    801e04 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e15:	48 98                	cltq
+  801e17:	eb eb                	jmp    801e04 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e19:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801e20:	00 00 00 
+  801e23:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e29:	89 da                	mov    %ebx,%edx
+  801e2b:	48 bf e5 33 80 00 00 	movabs $0x8033e5,%rdi
+  801e32:	00 00 00 
+  801e35:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e3a:	48 b9 88 03 80 00 00 	movabs $0x800388,%rcx
+  801e41:	00 00 00 
+  801e44:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e46:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e4d:	eb b5                	jmp    801e04 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e4f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e56:	eb ac                	jmp    801e04 <write+0x65>
+
+0000000000801e58 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e58:	55                   	push   %rbp
+  801e59:	48 89 e5             	mov    %rsp,%rbp
+  801e5c:	53                   	push   %rbx
+  801e5d:	48 83 ec 18          	sub    $0x18,%rsp
+  801e61:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e63:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e67:	48 b8 8d 19 80 00 00 	movabs $0x80198d,%rax
+  801e6e:	00 00 00 
+  801e71:	ff d0                	call   *%rax
+  801e73:	85 c0                	test   %eax,%eax
+  801e75:	78 0c                	js     801e83 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801e77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e7b:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801e7e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e83:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e87:	c9                   	leave
+  801e88:	c3                   	ret
+
+0000000000801e89 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e89:	55                   	push   %rbp
+  801e8a:	48 89 e5             	mov    %rsp,%rbp
+  801e8d:	41 55                	push   %r13
+  801e8f:	41 54                	push   %r12
+  801e91:	53                   	push   %rbx
+  801e92:	48 83 ec 18          	sub    $0x18,%rsp
+  801e96:	89 fb                	mov    %edi,%ebx
+  801e98:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e9b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e9f:	48 b8 8d 19 80 00 00 	movabs $0x80198d,%rax
+  801ea6:	00 00 00 
+  801ea9:	ff d0                	call   *%rax
+  801eab:	85 c0                	test   %eax,%eax
+  801ead:	78 38                	js     801ee7 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eaf:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801eb3:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801eb7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ebb:	48 b8 d8 19 80 00 00 	movabs $0x8019d8,%rax
+  801ec2:	00 00 00 
+  801ec5:	ff d0                	call   *%rax
+  801ec7:	85 c0                	test   %eax,%eax
+  801ec9:	78 1c                	js     801ee7 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ecb:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801ed0:	74 20                	je     801ef2 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ed2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ed6:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801eda:	48 85 c0             	test   %rax,%rax
+  801edd:	74 47                	je     801f26 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801edf:	44 89 e6             	mov    %r12d,%esi
+  801ee2:	4c 89 ef             	mov    %r13,%rdi
+  801ee5:	ff d0                	call   *%rax
+}
+  801ee7:	48 83 c4 18          	add    $0x18,%rsp
+  801eeb:	5b                   	pop    %rbx
+  801eec:	41 5c                	pop    %r12
+  801eee:	41 5d                	pop    %r13
+  801ef0:	5d                   	pop    %rbp
+  801ef1:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ef2:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801ef9:	00 00 00 
+  801efc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f02:	89 da                	mov    %ebx,%edx
+  801f04:	48 bf a8 33 80 00 00 	movabs $0x8033a8,%rdi
+  801f0b:	00 00 00 
+  801f0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f13:	48 b9 88 03 80 00 00 	movabs $0x800388,%rcx
+  801f1a:	00 00 00 
+  801f1d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f24:	eb c1                	jmp    801ee7 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f26:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f2b:	eb ba                	jmp    801ee7 <ftruncate+0x5e>
+
+0000000000801f2d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f2d:	55                   	push   %rbp
+  801f2e:	48 89 e5             	mov    %rsp,%rbp
+  801f31:	41 54                	push   %r12
+  801f33:	53                   	push   %rbx
+  801f34:	48 83 ec 10          	sub    $0x10,%rsp
+  801f38:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f3b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f3f:	48 b8 8d 19 80 00 00 	movabs $0x80198d,%rax
+  801f46:	00 00 00 
+  801f49:	ff d0                	call   *%rax
+  801f4b:	85 c0                	test   %eax,%eax
+  801f4d:	78 4e                	js     801f9d <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f4f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f53:	41 8b 3c 24          	mov    (%r12),%edi
+  801f57:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f5b:	48 b8 d8 19 80 00 00 	movabs $0x8019d8,%rax
+  801f62:	00 00 00 
+  801f65:	ff d0                	call   *%rax
+  801f67:	85 c0                	test   %eax,%eax
+  801f69:	78 32                	js     801f9d <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f6b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f6f:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f74:	74 30                	je     801fa6 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f76:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f79:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f80:	00 00 00 
+    stat->st_isdir = 0;
+  801f83:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f8a:	00 00 00 
+    stat->st_dev = dev;
+  801f8d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f94:	48 89 de             	mov    %rbx,%rsi
+  801f97:	4c 89 e7             	mov    %r12,%rdi
+  801f9a:	ff 50 28             	call   *0x28(%rax)
+}
+  801f9d:	48 83 c4 10          	add    $0x10,%rsp
+  801fa1:	5b                   	pop    %rbx
+  801fa2:	41 5c                	pop    %r12
+  801fa4:	5d                   	pop    %rbp
+  801fa5:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fa6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fab:	eb f0                	jmp    801f9d <fstat+0x70>
+
+0000000000801fad <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801fad:	55                   	push   %rbp
+  801fae:	48 89 e5             	mov    %rsp,%rbp
+  801fb1:	41 54                	push   %r12
+  801fb3:	53                   	push   %rbx
+  801fb4:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801fb7:	be 00 00 00 00       	mov    $0x0,%esi
+  801fbc:	48 b8 2e 22 80 00 00 	movabs $0x80222e,%rax
+  801fc3:	00 00 00 
+  801fc6:	ff d0                	call   *%rax
+  801fc8:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801fca:	85 c0                	test   %eax,%eax
+  801fcc:	78 25                	js     801ff3 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801fce:	4c 89 e6             	mov    %r12,%rsi
+  801fd1:	89 c7                	mov    %eax,%edi
+  801fd3:	48 b8 2d 1f 80 00 00 	movabs $0x801f2d,%rax
+  801fda:	00 00 00 
+  801fdd:	ff d0                	call   *%rax
+  801fdf:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801fe2:	89 df                	mov    %ebx,%edi
+  801fe4:	48 b8 f2 1a 80 00 00 	movabs $0x801af2,%rax
+  801feb:	00 00 00 
+  801fee:	ff d0                	call   *%rax
+
+    return res;
+  801ff0:	44 89 e3             	mov    %r12d,%ebx
+}
+  801ff3:	89 d8                	mov    %ebx,%eax
+  801ff5:	5b                   	pop    %rbx
+  801ff6:	41 5c                	pop    %r12
+  801ff8:	5d                   	pop    %rbp
+  801ff9:	c3                   	ret
+
+0000000000801ffa <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801ffa:	55                   	push   %rbp
+  801ffb:	48 89 e5             	mov    %rsp,%rbp
+  801ffe:	41 54                	push   %r12
+  802000:	53                   	push   %rbx
+  802001:	48 83 ec 10          	sub    $0x10,%rsp
+  802005:	41 89 fc             	mov    %edi,%r12d
+  802008:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80200b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802012:	00 00 00 
+  802015:	83 38 00             	cmpl   $0x0,(%rax)
+  802018:	74 5e                	je     802078 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80201a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802020:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802025:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80202c:	00 00 00 
+  80202f:	44 89 e6             	mov    %r12d,%esi
+  802032:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802039:	00 00 00 
+  80203c:	8b 38                	mov    (%rax),%edi
+  80203e:	48 b8 67 2c 80 00 00 	movabs $0x802c67,%rax
+  802045:	00 00 00 
+  802048:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  80204a:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802051:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802052:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802057:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80205b:	48 89 de             	mov    %rbx,%rsi
+  80205e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802063:	48 b8 d2 2b 80 00 00 	movabs $0x802bd2,%rax
+  80206a:	00 00 00 
+  80206d:	ff d0                	call   *%rax
+}
+  80206f:	48 83 c4 10          	add    $0x10,%rsp
+  802073:	5b                   	pop    %rbx
+  802074:	41 5c                	pop    %r12
+  802076:	5d                   	pop    %rbp
+  802077:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802078:	bf 03 00 00 00       	mov    $0x3,%edi
+  80207d:	48 b8 07 2d 80 00 00 	movabs $0x802d07,%rax
+  802084:	00 00 00 
+  802087:	ff d0                	call   *%rax
+  802089:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802090:	00 00 
+  802092:	eb 86                	jmp    80201a <fsipc+0x20>
+
+0000000000802094 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802094:	55                   	push   %rbp
+  802095:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802098:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80209f:	00 00 00 
+  8020a2:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8020a5:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8020a7:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8020aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8020af:	bf 02 00 00 00       	mov    $0x2,%edi
+  8020b4:	48 b8 fa 1f 80 00 00 	movabs $0x801ffa,%rax
+  8020bb:	00 00 00 
+  8020be:	ff d0                	call   *%rax
+}
+  8020c0:	5d                   	pop    %rbp
+  8020c1:	c3                   	ret
+
+00000000008020c2 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8020c2:	55                   	push   %rbp
+  8020c3:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8020c6:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8020c9:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8020d0:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8020d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d7:	bf 06 00 00 00       	mov    $0x6,%edi
+  8020dc:	48 b8 fa 1f 80 00 00 	movabs $0x801ffa,%rax
+  8020e3:	00 00 00 
+  8020e6:	ff d0                	call   *%rax
+}
+  8020e8:	5d                   	pop    %rbp
+  8020e9:	c3                   	ret
+
+00000000008020ea <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8020ea:	55                   	push   %rbp
+  8020eb:	48 89 e5             	mov    %rsp,%rbp
+  8020ee:	41 54                	push   %r12
+  8020f0:	53                   	push   %rbx
+  8020f1:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8020f4:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8020f7:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8020fe:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802100:	be 00 00 00 00       	mov    $0x0,%esi
+  802105:	bf 05 00 00 00       	mov    $0x5,%edi
+  80210a:	48 b8 fa 1f 80 00 00 	movabs $0x801ffa,%rax
+  802111:	00 00 00 
+  802114:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802116:	85 c0                	test   %eax,%eax
+  802118:	78 3d                	js     802157 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80211a:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802121:	00 00 00 
+  802124:	4c 89 e6             	mov    %r12,%rsi
+  802127:	48 89 df             	mov    %rbx,%rdi
+  80212a:	48 b8 ad 0c 80 00 00 	movabs $0x800cad,%rax
+  802131:	00 00 00 
+  802134:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802136:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80213d:	00 
+  80213e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802144:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80214b:	00 
+  80214c:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802152:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802157:	5b                   	pop    %rbx
+  802158:	41 5c                	pop    %r12
+  80215a:	5d                   	pop    %rbp
+  80215b:	c3                   	ret
+
+000000000080215c <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80215c:	55                   	push   %rbp
+  80215d:	48 89 e5             	mov    %rsp,%rbp
+  802160:	41 54                	push   %r12
+  802162:	53                   	push   %rbx
+  802163:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  802166:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80216b:	48 39 c2             	cmp    %rax,%rdx
+  80216e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802172:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802175:	48 89 c2             	mov    %rax,%rdx
+  802178:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80217f:	00 00 00 
+  802182:	48 b8 0e 0f 80 00 00 	movabs $0x800f0e,%rax
+  802189:	00 00 00 
+  80218c:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80218e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802195:	00 00 00 
+  802198:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80219d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  80219f:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8021a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a8:	bf 04 00 00 00       	mov    $0x4,%edi
+  8021ad:	48 b8 fa 1f 80 00 00 	movabs $0x801ffa,%rax
+  8021b4:	00 00 00 
+  8021b7:	ff d0                	call   *%rax
+  8021b9:	48 98                	cltq
+}
+  8021bb:	5b                   	pop    %rbx
+  8021bc:	41 5c                	pop    %r12
+  8021be:	5d                   	pop    %rbp
+  8021bf:	c3                   	ret
+
+00000000008021c0 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8021c0:	55                   	push   %rbp
+  8021c1:	48 89 e5             	mov    %rsp,%rbp
+  8021c4:	41 54                	push   %r12
+  8021c6:	53                   	push   %rbx
+  8021c7:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8021ca:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8021d1:	00 00 00 
+  8021d4:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8021d7:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8021d9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021de:	48 39 ca             	cmp    %rcx,%rdx
+  8021e1:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8021e5:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8021e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ee:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021f3:	48 b8 fa 1f 80 00 00 	movabs $0x801ffa,%rax
+  8021fa:	00 00 00 
+  8021fd:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  8021ff:	85 c0                	test   %eax,%eax
+  802201:	78 27                	js     80222a <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802203:	48 63 d8             	movslq %eax,%rbx
+  802206:	48 89 da             	mov    %rbx,%rdx
+  802209:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802210:	00 00 00 
+  802213:	4c 89 e7             	mov    %r12,%rdi
+  802216:	48 b8 0e 0f 80 00 00 	movabs $0x800f0e,%rax
+  80221d:	00 00 00 
+  802220:	ff d0                	call   *%rax
+    return bytes_read;
+  802222:	48 89 d8             	mov    %rbx,%rax
+}
+  802225:	5b                   	pop    %rbx
+  802226:	41 5c                	pop    %r12
+  802228:	5d                   	pop    %rbp
+  802229:	c3                   	ret
+        return bytes_read;
+  80222a:	48 98                	cltq
+  80222c:	eb f7                	jmp    802225 <devfile_read+0x65>
+
+000000000080222e <open>:
+open(const char *path, int mode) {
+  80222e:	55                   	push   %rbp
+  80222f:	48 89 e5             	mov    %rsp,%rbp
+  802232:	41 55                	push   %r13
+  802234:	41 54                	push   %r12
+  802236:	53                   	push   %rbx
+  802237:	48 83 ec 18          	sub    $0x18,%rsp
+  80223b:	49 89 fc             	mov    %rdi,%r12
+  80223e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802241:	48 b8 6f 0c 80 00 00 	movabs $0x800c6f,%rax
+  802248:	00 00 00 
+  80224b:	ff d0                	call   *%rax
+  80224d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802253:	0f 87 8a 00 00 00    	ja     8022e3 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802259:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80225d:	48 b8 2d 19 80 00 00 	movabs $0x80192d,%rax
+  802264:	00 00 00 
+  802267:	ff d0                	call   *%rax
+  802269:	89 c3                	mov    %eax,%ebx
+  80226b:	85 c0                	test   %eax,%eax
+  80226d:	78 50                	js     8022bf <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80226f:	4c 89 e6             	mov    %r12,%rsi
+  802272:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802279:	00 00 00 
+  80227c:	48 89 df             	mov    %rbx,%rdi
+  80227f:	48 b8 ad 0c 80 00 00 	movabs $0x800cad,%rax
+  802286:	00 00 00 
+  802289:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80228b:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802292:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802296:	bf 01 00 00 00       	mov    $0x1,%edi
+  80229b:	48 b8 fa 1f 80 00 00 	movabs $0x801ffa,%rax
+  8022a2:	00 00 00 
+  8022a5:	ff d0                	call   *%rax
+  8022a7:	89 c3                	mov    %eax,%ebx
+  8022a9:	85 c0                	test   %eax,%eax
+  8022ab:	78 1f                	js     8022cc <open+0x9e>
+    return fd2num(fd);
+  8022ad:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022b1:	48 b8 ff 18 80 00 00 	movabs $0x8018ff,%rax
+  8022b8:	00 00 00 
+  8022bb:	ff d0                	call   *%rax
+  8022bd:	89 c3                	mov    %eax,%ebx
+}
+  8022bf:	89 d8                	mov    %ebx,%eax
+  8022c1:	48 83 c4 18          	add    $0x18,%rsp
+  8022c5:	5b                   	pop    %rbx
+  8022c6:	41 5c                	pop    %r12
+  8022c8:	41 5d                	pop    %r13
+  8022ca:	5d                   	pop    %rbp
+  8022cb:	c3                   	ret
+        fd_close(fd, 0);
+  8022cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8022d1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022d5:	48 b8 48 1a 80 00 00 	movabs $0x801a48,%rax
+  8022dc:	00 00 00 
+  8022df:	ff d0                	call   *%rax
+        return res;
+  8022e1:	eb dc                	jmp    8022bf <open+0x91>
+        return -E_BAD_PATH;
+  8022e3:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8022e8:	eb d5                	jmp    8022bf <open+0x91>
+
+00000000008022ea <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8022ea:	55                   	push   %rbp
+  8022eb:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8022ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f3:	bf 08 00 00 00       	mov    $0x8,%edi
+  8022f8:	48 b8 fa 1f 80 00 00 	movabs $0x801ffa,%rax
+  8022ff:	00 00 00 
+  802302:	ff d0                	call   *%rax
+}
+  802304:	5d                   	pop    %rbp
+  802305:	c3                   	ret
+
+0000000000802306 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802306:	55                   	push   %rbp
+  802307:	48 89 e5             	mov    %rsp,%rbp
+  80230a:	41 54                	push   %r12
+  80230c:	53                   	push   %rbx
+  80230d:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802310:	48 b8 11 19 80 00 00 	movabs $0x801911,%rax
+  802317:	00 00 00 
+  80231a:	ff d0                	call   *%rax
+  80231c:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80231f:	48 be 40 34 80 00 00 	movabs $0x803440,%rsi
+  802326:	00 00 00 
+  802329:	48 89 df             	mov    %rbx,%rdi
+  80232c:	48 b8 ad 0c 80 00 00 	movabs $0x800cad,%rax
+  802333:	00 00 00 
+  802336:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802338:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80233d:	41 2b 04 24          	sub    (%r12),%eax
+  802341:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802347:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80234e:	00 00 00 
+    stat->st_dev = &devpipe;
+  802351:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802358:	00 00 00 
+  80235b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802362:	b8 00 00 00 00       	mov    $0x0,%eax
+  802367:	5b                   	pop    %rbx
+  802368:	41 5c                	pop    %r12
+  80236a:	5d                   	pop    %rbp
+  80236b:	c3                   	ret
+
+000000000080236c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80236c:	55                   	push   %rbp
+  80236d:	48 89 e5             	mov    %rsp,%rbp
+  802370:	41 54                	push   %r12
+  802372:	53                   	push   %rbx
+  802373:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802376:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80237b:	48 89 fe             	mov    %rdi,%rsi
+  80237e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802383:	49 bc 29 13 80 00 00 	movabs $0x801329,%r12
+  80238a:	00 00 00 
+  80238d:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802390:	48 89 df             	mov    %rbx,%rdi
+  802393:	48 b8 11 19 80 00 00 	movabs $0x801911,%rax
+  80239a:	00 00 00 
+  80239d:	ff d0                	call   *%rax
+  80239f:	48 89 c6             	mov    %rax,%rsi
+  8023a2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023ac:	41 ff d4             	call   *%r12
+}
+  8023af:	5b                   	pop    %rbx
+  8023b0:	41 5c                	pop    %r12
+  8023b2:	5d                   	pop    %rbp
+  8023b3:	c3                   	ret
+
+00000000008023b4 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8023b4:	55                   	push   %rbp
+  8023b5:	48 89 e5             	mov    %rsp,%rbp
+  8023b8:	41 57                	push   %r15
+  8023ba:	41 56                	push   %r14
+  8023bc:	41 55                	push   %r13
+  8023be:	41 54                	push   %r12
+  8023c0:	53                   	push   %rbx
+  8023c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8023c5:	49 89 fc             	mov    %rdi,%r12
+  8023c8:	49 89 f5             	mov    %rsi,%r13
+  8023cb:	49 89 d7             	mov    %rdx,%r15
+  8023ce:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8023d2:	48 b8 11 19 80 00 00 	movabs $0x801911,%rax
+  8023d9:	00 00 00 
+  8023dc:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8023de:	4d 85 ff             	test   %r15,%r15
+  8023e1:	0f 84 af 00 00 00    	je     802496 <devpipe_write+0xe2>
+  8023e7:	48 89 c3             	mov    %rax,%rbx
+  8023ea:	4c 89 f8             	mov    %r15,%rax
+  8023ed:	4d 89 ef             	mov    %r13,%r15
+  8023f0:	4c 01 e8             	add    %r13,%rax
+  8023f3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8023f7:	49 bd 31 12 80 00 00 	movabs $0x801231,%r13
+  8023fe:	00 00 00 
+            sys_yield();
+  802401:	49 be ce 11 80 00 00 	movabs $0x8011ce,%r14
+  802408:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80240b:	8b 73 04             	mov    0x4(%rbx),%esi
+  80240e:	48 63 ce             	movslq %esi,%rcx
+  802411:	48 63 03             	movslq (%rbx),%rax
+  802414:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80241a:	48 39 c1             	cmp    %rax,%rcx
+  80241d:	72 2e                	jb     80244d <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80241f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802424:	48 89 da             	mov    %rbx,%rdx
+  802427:	be 00 10 00 00       	mov    $0x1000,%esi
+  80242c:	4c 89 e7             	mov    %r12,%rdi
+  80242f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802432:	85 c0                	test   %eax,%eax
+  802434:	74 66                	je     80249c <devpipe_write+0xe8>
+            sys_yield();
+  802436:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802439:	8b 73 04             	mov    0x4(%rbx),%esi
+  80243c:	48 63 ce             	movslq %esi,%rcx
+  80243f:	48 63 03             	movslq (%rbx),%rax
+  802442:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802448:	48 39 c1             	cmp    %rax,%rcx
+  80244b:	73 d2                	jae    80241f <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80244d:	41 0f b6 3f          	movzbl (%r15),%edi
+  802451:	48 89 ca             	mov    %rcx,%rdx
+  802454:	48 c1 ea 03          	shr    $0x3,%rdx
+  802458:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80245f:	08 10 20 
+  802462:	48 f7 e2             	mul    %rdx
+  802465:	48 c1 ea 06          	shr    $0x6,%rdx
+  802469:	48 89 d0             	mov    %rdx,%rax
+  80246c:	48 c1 e0 09          	shl    $0x9,%rax
+  802470:	48 29 d0             	sub    %rdx,%rax
+  802473:	48 c1 e0 03          	shl    $0x3,%rax
+  802477:	48 29 c1             	sub    %rax,%rcx
+  80247a:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80247f:	83 c6 01             	add    $0x1,%esi
+  802482:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802485:	49 83 c7 01          	add    $0x1,%r15
+  802489:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80248d:	49 39 c7             	cmp    %rax,%r15
+  802490:	0f 85 75 ff ff ff    	jne    80240b <devpipe_write+0x57>
+    return n;
+  802496:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80249a:	eb 05                	jmp    8024a1 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80249c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024a1:	48 83 c4 18          	add    $0x18,%rsp
+  8024a5:	5b                   	pop    %rbx
+  8024a6:	41 5c                	pop    %r12
+  8024a8:	41 5d                	pop    %r13
+  8024aa:	41 5e                	pop    %r14
+  8024ac:	41 5f                	pop    %r15
+  8024ae:	5d                   	pop    %rbp
+  8024af:	c3                   	ret
+
+00000000008024b0 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8024b0:	55                   	push   %rbp
+  8024b1:	48 89 e5             	mov    %rsp,%rbp
+  8024b4:	41 57                	push   %r15
+  8024b6:	41 56                	push   %r14
+  8024b8:	41 55                	push   %r13
+  8024ba:	41 54                	push   %r12
+  8024bc:	53                   	push   %rbx
+  8024bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8024c1:	49 89 fc             	mov    %rdi,%r12
+  8024c4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8024c8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024cc:	48 b8 11 19 80 00 00 	movabs $0x801911,%rax
+  8024d3:	00 00 00 
+  8024d6:	ff d0                	call   *%rax
+  8024d8:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8024db:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8024e1:	49 bd 31 12 80 00 00 	movabs $0x801231,%r13
+  8024e8:	00 00 00 
+            sys_yield();
+  8024eb:	49 be ce 11 80 00 00 	movabs $0x8011ce,%r14
+  8024f2:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8024f5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8024fa:	74 7d                	je     802579 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8024fc:	8b 03                	mov    (%rbx),%eax
+  8024fe:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802501:	75 26                	jne    802529 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802503:	4d 85 ff             	test   %r15,%r15
+  802506:	75 77                	jne    80257f <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802508:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80250d:	48 89 da             	mov    %rbx,%rdx
+  802510:	be 00 10 00 00       	mov    $0x1000,%esi
+  802515:	4c 89 e7             	mov    %r12,%rdi
+  802518:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80251b:	85 c0                	test   %eax,%eax
+  80251d:	74 72                	je     802591 <devpipe_read+0xe1>
+            sys_yield();
+  80251f:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802522:	8b 03                	mov    (%rbx),%eax
+  802524:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802527:	74 df                	je     802508 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802529:	48 63 c8             	movslq %eax,%rcx
+  80252c:	48 89 ca             	mov    %rcx,%rdx
+  80252f:	48 c1 ea 03          	shr    $0x3,%rdx
+  802533:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80253a:	08 10 20 
+  80253d:	48 89 d0             	mov    %rdx,%rax
+  802540:	48 f7 e6             	mul    %rsi
+  802543:	48 c1 ea 06          	shr    $0x6,%rdx
+  802547:	48 89 d0             	mov    %rdx,%rax
+  80254a:	48 c1 e0 09          	shl    $0x9,%rax
+  80254e:	48 29 d0             	sub    %rdx,%rax
+  802551:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802558:	00 
+  802559:	48 89 c8             	mov    %rcx,%rax
+  80255c:	48 29 d0             	sub    %rdx,%rax
+  80255f:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802564:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802568:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80256c:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80256f:	49 83 c7 01          	add    $0x1,%r15
+  802573:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802577:	75 83                	jne    8024fc <devpipe_read+0x4c>
+    return n;
+  802579:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80257d:	eb 03                	jmp    802582 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80257f:	4c 89 f8             	mov    %r15,%rax
+}
+  802582:	48 83 c4 18          	add    $0x18,%rsp
+  802586:	5b                   	pop    %rbx
+  802587:	41 5c                	pop    %r12
+  802589:	41 5d                	pop    %r13
+  80258b:	41 5e                	pop    %r14
+  80258d:	41 5f                	pop    %r15
+  80258f:	5d                   	pop    %rbp
+  802590:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802591:	b8 00 00 00 00       	mov    $0x0,%eax
+  802596:	eb ea                	jmp    802582 <devpipe_read+0xd2>
+
+0000000000802598 <pipe>:
+pipe(int pfd[2]) {
+  802598:	55                   	push   %rbp
+  802599:	48 89 e5             	mov    %rsp,%rbp
+  80259c:	41 55                	push   %r13
+  80259e:	41 54                	push   %r12
+  8025a0:	53                   	push   %rbx
+  8025a1:	48 83 ec 18          	sub    $0x18,%rsp
+  8025a5:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8025a8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8025ac:	48 b8 2d 19 80 00 00 	movabs $0x80192d,%rax
+  8025b3:	00 00 00 
+  8025b6:	ff d0                	call   *%rax
+  8025b8:	89 c3                	mov    %eax,%ebx
+  8025ba:	85 c0                	test   %eax,%eax
+  8025bc:	0f 88 a0 01 00 00    	js     802762 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8025c2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8025c7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025cc:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8025d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025d5:	48 b8 5d 12 80 00 00 	movabs $0x80125d,%rax
+  8025dc:	00 00 00 
+  8025df:	ff d0                	call   *%rax
+  8025e1:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8025e3:	85 c0                	test   %eax,%eax
+  8025e5:	0f 88 77 01 00 00    	js     802762 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8025eb:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8025ef:	48 b8 2d 19 80 00 00 	movabs $0x80192d,%rax
+  8025f6:	00 00 00 
+  8025f9:	ff d0                	call   *%rax
+  8025fb:	89 c3                	mov    %eax,%ebx
+  8025fd:	85 c0                	test   %eax,%eax
+  8025ff:	0f 88 43 01 00 00    	js     802748 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802605:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80260a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80260f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802613:	bf 00 00 00 00       	mov    $0x0,%edi
+  802618:	48 b8 5d 12 80 00 00 	movabs $0x80125d,%rax
+  80261f:	00 00 00 
+  802622:	ff d0                	call   *%rax
+  802624:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802626:	85 c0                	test   %eax,%eax
+  802628:	0f 88 1a 01 00 00    	js     802748 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80262e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802632:	48 b8 11 19 80 00 00 	movabs $0x801911,%rax
+  802639:	00 00 00 
+  80263c:	ff d0                	call   *%rax
+  80263e:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802641:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802646:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80264b:	48 89 c6             	mov    %rax,%rsi
+  80264e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802653:	48 b8 5d 12 80 00 00 	movabs $0x80125d,%rax
+  80265a:	00 00 00 
+  80265d:	ff d0                	call   *%rax
+  80265f:	89 c3                	mov    %eax,%ebx
+  802661:	85 c0                	test   %eax,%eax
+  802663:	0f 88 c5 00 00 00    	js     80272e <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802669:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80266d:	48 b8 11 19 80 00 00 	movabs $0x801911,%rax
+  802674:	00 00 00 
+  802677:	ff d0                	call   *%rax
+  802679:	48 89 c1             	mov    %rax,%rcx
+  80267c:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802682:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802688:	ba 00 00 00 00       	mov    $0x0,%edx
+  80268d:	4c 89 ee             	mov    %r13,%rsi
+  802690:	bf 00 00 00 00       	mov    $0x0,%edi
+  802695:	48 b8 c4 12 80 00 00 	movabs $0x8012c4,%rax
+  80269c:	00 00 00 
+  80269f:	ff d0                	call   *%rax
+  8026a1:	89 c3                	mov    %eax,%ebx
+  8026a3:	85 c0                	test   %eax,%eax
+  8026a5:	78 6e                	js     802715 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8026a7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026ac:	4c 89 ef             	mov    %r13,%rdi
+  8026af:	48 b8 ff 11 80 00 00 	movabs $0x8011ff,%rax
+  8026b6:	00 00 00 
+  8026b9:	ff d0                	call   *%rax
+  8026bb:	83 f8 02             	cmp    $0x2,%eax
+  8026be:	0f 85 ab 00 00 00    	jne    80276f <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8026c4:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8026cb:	00 00 
+  8026cd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8026d1:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8026d3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8026d7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8026de:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8026e2:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8026e4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026e8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8026ef:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8026f3:	48 bb ff 18 80 00 00 	movabs $0x8018ff,%rbx
+  8026fa:	00 00 00 
+  8026fd:	ff d3                	call   *%rbx
+  8026ff:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802703:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802707:	ff d3                	call   *%rbx
+  802709:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80270e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802713:	eb 4d                	jmp    802762 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802715:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80271a:	4c 89 ee             	mov    %r13,%rsi
+  80271d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802722:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  802729:	00 00 00 
+  80272c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80272e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802733:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802737:	bf 00 00 00 00       	mov    $0x0,%edi
+  80273c:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  802743:	00 00 00 
+  802746:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802748:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80274d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802751:	bf 00 00 00 00       	mov    $0x0,%edi
+  802756:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  80275d:	00 00 00 
+  802760:	ff d0                	call   *%rax
+}
+  802762:	89 d8                	mov    %ebx,%eax
+  802764:	48 83 c4 18          	add    $0x18,%rsp
+  802768:	5b                   	pop    %rbx
+  802769:	41 5c                	pop    %r12
+  80276b:	41 5d                	pop    %r13
+  80276d:	5d                   	pop    %rbp
+  80276e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80276f:	48 b9 70 34 80 00 00 	movabs $0x803470,%rcx
+  802776:	00 00 00 
+  802779:	48 ba 47 34 80 00 00 	movabs $0x803447,%rdx
+  802780:	00 00 00 
+  802783:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802788:	48 bf 5c 34 80 00 00 	movabs $0x80345c,%rdi
+  80278f:	00 00 00 
+  802792:	b8 00 00 00 00       	mov    $0x0,%eax
+  802797:	49 b8 38 02 80 00 00 	movabs $0x800238,%r8
+  80279e:	00 00 00 
+  8027a1:	41 ff d0             	call   *%r8
+
+00000000008027a4 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8027a4:	55                   	push   %rbp
+  8027a5:	48 89 e5             	mov    %rsp,%rbp
+  8027a8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8027ac:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8027b0:	48 b8 8d 19 80 00 00 	movabs $0x80198d,%rax
+  8027b7:	00 00 00 
+  8027ba:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8027bc:	85 c0                	test   %eax,%eax
+  8027be:	78 35                	js     8027f5 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8027c0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8027c4:	48 b8 11 19 80 00 00 	movabs $0x801911,%rax
+  8027cb:	00 00 00 
+  8027ce:	ff d0                	call   *%rax
+  8027d0:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8027d3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8027d8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8027dd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8027e1:	48 b8 31 12 80 00 00 	movabs $0x801231,%rax
+  8027e8:	00 00 00 
+  8027eb:	ff d0                	call   *%rax
+  8027ed:	85 c0                	test   %eax,%eax
+  8027ef:	0f 94 c0             	sete   %al
+  8027f2:	0f b6 c0             	movzbl %al,%eax
+}
+  8027f5:	c9                   	leave
+  8027f6:	c3                   	ret
+
+00000000008027f7 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8027f7:	48 89 f8             	mov    %rdi,%rax
+  8027fa:	48 c1 e8 27          	shr    $0x27,%rax
+  8027fe:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802805:	01 00 00 
+  802808:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80280c:	f6 c2 01             	test   $0x1,%dl
+  80280f:	74 6d                	je     80287e <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802811:	48 89 f8             	mov    %rdi,%rax
+  802814:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802818:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80281f:	01 00 00 
+  802822:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802826:	f6 c2 01             	test   $0x1,%dl
+  802829:	74 62                	je     80288d <get_uvpt_entry+0x96>
+  80282b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802832:	01 00 00 
+  802835:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802839:	f6 c2 80             	test   $0x80,%dl
+  80283c:	75 4f                	jne    80288d <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80283e:	48 89 f8             	mov    %rdi,%rax
+  802841:	48 c1 e8 15          	shr    $0x15,%rax
+  802845:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80284c:	01 00 00 
+  80284f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802853:	f6 c2 01             	test   $0x1,%dl
+  802856:	74 44                	je     80289c <get_uvpt_entry+0xa5>
+  802858:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80285f:	01 00 00 
+  802862:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802866:	f6 c2 80             	test   $0x80,%dl
+  802869:	75 31                	jne    80289c <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80286b:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80286f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802876:	01 00 00 
+  802879:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80287d:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80287e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802885:	01 00 00 
+  802888:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80288c:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80288d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802894:	01 00 00 
+  802897:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80289b:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80289c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8028a3:	01 00 00 
+  8028a6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8028aa:	c3                   	ret
+
+00000000008028ab <get_prot>:
+
+int
+get_prot(void *va) {
+  8028ab:	55                   	push   %rbp
+  8028ac:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8028af:	48 b8 f7 27 80 00 00 	movabs $0x8027f7,%rax
+  8028b6:	00 00 00 
+  8028b9:	ff d0                	call   *%rax
+  8028bb:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8028be:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8028c3:	89 c1                	mov    %eax,%ecx
+  8028c5:	83 c9 04             	or     $0x4,%ecx
+  8028c8:	f6 c2 01             	test   $0x1,%dl
+  8028cb:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8028ce:	89 c1                	mov    %eax,%ecx
+  8028d0:	83 c9 02             	or     $0x2,%ecx
+  8028d3:	f6 c2 02             	test   $0x2,%dl
+  8028d6:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8028d9:	89 c1                	mov    %eax,%ecx
+  8028db:	83 c9 01             	or     $0x1,%ecx
+  8028de:	48 85 d2             	test   %rdx,%rdx
+  8028e1:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8028e4:	89 c1                	mov    %eax,%ecx
+  8028e6:	83 c9 40             	or     $0x40,%ecx
+  8028e9:	f6 c6 04             	test   $0x4,%dh
+  8028ec:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8028ef:	5d                   	pop    %rbp
+  8028f0:	c3                   	ret
+
+00000000008028f1 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8028f1:	55                   	push   %rbp
+  8028f2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8028f5:	48 b8 f7 27 80 00 00 	movabs $0x8027f7,%rax
+  8028fc:	00 00 00 
+  8028ff:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802901:	48 c1 e8 06          	shr    $0x6,%rax
+  802905:	83 e0 01             	and    $0x1,%eax
+}
+  802908:	5d                   	pop    %rbp
+  802909:	c3                   	ret
+
+000000000080290a <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80290a:	55                   	push   %rbp
+  80290b:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80290e:	48 b8 f7 27 80 00 00 	movabs $0x8027f7,%rax
+  802915:	00 00 00 
+  802918:	ff d0                	call   *%rax
+  80291a:	83 e0 01             	and    $0x1,%eax
+}
+  80291d:	5d                   	pop    %rbp
+  80291e:	c3                   	ret
+
+000000000080291f <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80291f:	55                   	push   %rbp
+  802920:	48 89 e5             	mov    %rsp,%rbp
+  802923:	41 57                	push   %r15
+  802925:	41 56                	push   %r14
+  802927:	41 55                	push   %r13
+  802929:	41 54                	push   %r12
+  80292b:	53                   	push   %rbx
+  80292c:	48 83 ec 18          	sub    $0x18,%rsp
+  802930:	49 89 ff             	mov    %rdi,%r15
+  802933:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802937:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  80293c:	49 bc 0a 29 80 00 00 	movabs $0x80290a,%r12
+  802943:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802946:	49 be ab 28 80 00 00 	movabs $0x8028ab,%r14
+  80294d:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802950:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802957:	00 00 00 
+  80295a:	eb 0c                	jmp    802968 <foreach_shared_region+0x49>
+  80295c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802963:	4c 39 eb             	cmp    %r13,%rbx
+  802966:	74 38                	je     8029a0 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802968:	48 89 df             	mov    %rbx,%rdi
+  80296b:	41 ff d4             	call   *%r12
+  80296e:	84 c0                	test   %al,%al
+  802970:	74 ea                	je     80295c <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802972:	48 89 df             	mov    %rbx,%rdi
+  802975:	41 ff d6             	call   *%r14
+  802978:	a8 40                	test   $0x40,%al
+  80297a:	74 e0                	je     80295c <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  80297c:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802983:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802987:	48 89 df             	mov    %rbx,%rdi
+  80298a:	41 ff d7             	call   *%r15
+        if (err)
+  80298d:	85 c0                	test   %eax,%eax
+  80298f:	74 cb                	je     80295c <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802991:	48 83 c4 18          	add    $0x18,%rsp
+  802995:	5b                   	pop    %rbx
+  802996:	41 5c                	pop    %r12
+  802998:	41 5d                	pop    %r13
+  80299a:	41 5e                	pop    %r14
+  80299c:	41 5f                	pop    %r15
+  80299e:	5d                   	pop    %rbp
+  80299f:	c3                   	ret
+    return 0;
+  8029a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a5:	eb ea                	jmp    802991 <foreach_shared_region+0x72>
+
+00000000008029a7 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ac:	c3                   	ret
+
+00000000008029ad <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8029ad:	55                   	push   %rbp
+  8029ae:	48 89 e5             	mov    %rsp,%rbp
+  8029b1:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8029b4:	48 be 94 34 80 00 00 	movabs $0x803494,%rsi
+  8029bb:	00 00 00 
+  8029be:	48 b8 ad 0c 80 00 00 	movabs $0x800cad,%rax
+  8029c5:	00 00 00 
+  8029c8:	ff d0                	call   *%rax
+    return 0;
+}
+  8029ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029cf:	5d                   	pop    %rbp
+  8029d0:	c3                   	ret
+
+00000000008029d1 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8029d1:	55                   	push   %rbp
+  8029d2:	48 89 e5             	mov    %rsp,%rbp
+  8029d5:	41 57                	push   %r15
+  8029d7:	41 56                	push   %r14
+  8029d9:	41 55                	push   %r13
+  8029db:	41 54                	push   %r12
+  8029dd:	53                   	push   %rbx
+  8029de:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8029e5:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8029ec:	48 85 d2             	test   %rdx,%rdx
+  8029ef:	74 7a                	je     802a6b <devcons_write+0x9a>
+  8029f1:	49 89 d6             	mov    %rdx,%r14
+  8029f4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8029fa:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8029ff:	49 bf a7 0e 80 00 00 	movabs $0x800ea7,%r15
+  802a06:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a09:	4c 89 f3             	mov    %r14,%rbx
+  802a0c:	48 29 f3             	sub    %rsi,%rbx
+  802a0f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a14:	48 39 c3             	cmp    %rax,%rbx
+  802a17:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a1b:	4c 63 eb             	movslq %ebx,%r13
+  802a1e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a25:	48 01 c6             	add    %rax,%rsi
+  802a28:	4c 89 ea             	mov    %r13,%rdx
+  802a2b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a32:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a35:	4c 89 ee             	mov    %r13,%rsi
+  802a38:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a3f:	48 b8 d4 10 80 00 00 	movabs $0x8010d4,%rax
+  802a46:	00 00 00 
+  802a49:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a4b:	41 01 dc             	add    %ebx,%r12d
+  802a4e:	49 63 f4             	movslq %r12d,%rsi
+  802a51:	4c 39 f6             	cmp    %r14,%rsi
+  802a54:	72 b3                	jb     802a09 <devcons_write+0x38>
+    return res;
+  802a56:	49 63 c4             	movslq %r12d,%rax
+}
+  802a59:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802a60:	5b                   	pop    %rbx
+  802a61:	41 5c                	pop    %r12
+  802a63:	41 5d                	pop    %r13
+  802a65:	41 5e                	pop    %r14
+  802a67:	41 5f                	pop    %r15
+  802a69:	5d                   	pop    %rbp
+  802a6a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802a6b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a71:	eb e3                	jmp    802a56 <devcons_write+0x85>
+
+0000000000802a73 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a73:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802a76:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a7b:	48 85 c0             	test   %rax,%rax
+  802a7e:	74 55                	je     802ad5 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a80:	55                   	push   %rbp
+  802a81:	48 89 e5             	mov    %rsp,%rbp
+  802a84:	41 55                	push   %r13
+  802a86:	41 54                	push   %r12
+  802a88:	53                   	push   %rbx
+  802a89:	48 83 ec 08          	sub    $0x8,%rsp
+  802a8d:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802a90:	48 bb 01 11 80 00 00 	movabs $0x801101,%rbx
+  802a97:	00 00 00 
+  802a9a:	49 bc ce 11 80 00 00 	movabs $0x8011ce,%r12
+  802aa1:	00 00 00 
+  802aa4:	eb 03                	jmp    802aa9 <devcons_read+0x36>
+  802aa6:	41 ff d4             	call   *%r12
+  802aa9:	ff d3                	call   *%rbx
+  802aab:	85 c0                	test   %eax,%eax
+  802aad:	74 f7                	je     802aa6 <devcons_read+0x33>
+    if (c < 0) return c;
+  802aaf:	48 63 d0             	movslq %eax,%rdx
+  802ab2:	78 13                	js     802ac7 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802ab4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ab9:	83 f8 04             	cmp    $0x4,%eax
+  802abc:	74 09                	je     802ac7 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802abe:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802ac2:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802ac7:	48 89 d0             	mov    %rdx,%rax
+  802aca:	48 83 c4 08          	add    $0x8,%rsp
+  802ace:	5b                   	pop    %rbx
+  802acf:	41 5c                	pop    %r12
+  802ad1:	41 5d                	pop    %r13
+  802ad3:	5d                   	pop    %rbp
+  802ad4:	c3                   	ret
+  802ad5:	48 89 d0             	mov    %rdx,%rax
+  802ad8:	c3                   	ret
+
+0000000000802ad9 <cputchar>:
+cputchar(int ch) {
+  802ad9:	55                   	push   %rbp
+  802ada:	48 89 e5             	mov    %rsp,%rbp
+  802add:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802ae1:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802ae5:	be 01 00 00 00       	mov    $0x1,%esi
+  802aea:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802aee:	48 b8 d4 10 80 00 00 	movabs $0x8010d4,%rax
+  802af5:	00 00 00 
+  802af8:	ff d0                	call   *%rax
+}
+  802afa:	c9                   	leave
+  802afb:	c3                   	ret
+
+0000000000802afc <getchar>:
+getchar(void) {
+  802afc:	55                   	push   %rbp
+  802afd:	48 89 e5             	mov    %rsp,%rbp
+  802b00:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b04:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b09:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b12:	48 b8 70 1c 80 00 00 	movabs $0x801c70,%rax
+  802b19:	00 00 00 
+  802b1c:	ff d0                	call   *%rax
+  802b1e:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b20:	85 c0                	test   %eax,%eax
+  802b22:	78 06                	js     802b2a <getchar+0x2e>
+  802b24:	74 08                	je     802b2e <getchar+0x32>
+  802b26:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b2a:	89 d0                	mov    %edx,%eax
+  802b2c:	c9                   	leave
+  802b2d:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b2e:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b33:	eb f5                	jmp    802b2a <getchar+0x2e>
+
+0000000000802b35 <iscons>:
+iscons(int fdnum) {
+  802b35:	55                   	push   %rbp
+  802b36:	48 89 e5             	mov    %rsp,%rbp
+  802b39:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b3d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b41:	48 b8 8d 19 80 00 00 	movabs $0x80198d,%rax
+  802b48:	00 00 00 
+  802b4b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b4d:	85 c0                	test   %eax,%eax
+  802b4f:	78 18                	js     802b69 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802b51:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b55:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802b5c:	00 00 00 
+  802b5f:	8b 00                	mov    (%rax),%eax
+  802b61:	39 02                	cmp    %eax,(%rdx)
+  802b63:	0f 94 c0             	sete   %al
+  802b66:	0f b6 c0             	movzbl %al,%eax
+}
+  802b69:	c9                   	leave
+  802b6a:	c3                   	ret
+
+0000000000802b6b <opencons>:
+opencons(void) {
+  802b6b:	55                   	push   %rbp
+  802b6c:	48 89 e5             	mov    %rsp,%rbp
+  802b6f:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b73:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802b77:	48 b8 2d 19 80 00 00 	movabs $0x80192d,%rax
+  802b7e:	00 00 00 
+  802b81:	ff d0                	call   *%rax
+  802b83:	85 c0                	test   %eax,%eax
+  802b85:	78 49                	js     802bd0 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802b87:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b8c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b91:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802b95:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b9a:	48 b8 5d 12 80 00 00 	movabs $0x80125d,%rax
+  802ba1:	00 00 00 
+  802ba4:	ff d0                	call   *%rax
+  802ba6:	85 c0                	test   %eax,%eax
+  802ba8:	78 26                	js     802bd0 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802baa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bae:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802bb5:	00 00 
+  802bb7:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802bb9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802bbd:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802bc4:	48 b8 ff 18 80 00 00 	movabs $0x8018ff,%rax
+  802bcb:	00 00 00 
+  802bce:	ff d0                	call   *%rax
+}
+  802bd0:	c9                   	leave
+  802bd1:	c3                   	ret
+
+0000000000802bd2 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802bd2:	55                   	push   %rbp
+  802bd3:	48 89 e5             	mov    %rsp,%rbp
+  802bd6:	41 54                	push   %r12
+  802bd8:	53                   	push   %rbx
+  802bd9:	48 89 fb             	mov    %rdi,%rbx
+  802bdc:	48 89 f7             	mov    %rsi,%rdi
+  802bdf:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802be2:	48 85 f6             	test   %rsi,%rsi
+  802be5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bec:	00 00 00 
+  802bef:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802bf3:	be 00 10 00 00       	mov    $0x1000,%esi
+  802bf8:	48 b8 c7 15 80 00 00 	movabs $0x8015c7,%rax
+  802bff:	00 00 00 
+  802c02:	ff d0                	call   *%rax
+    if (res < 0) {
+  802c04:	85 c0                	test   %eax,%eax
+  802c06:	78 45                	js     802c4d <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802c08:	48 85 db             	test   %rbx,%rbx
+  802c0b:	74 12                	je     802c1f <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802c0d:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802c14:	00 00 00 
+  802c17:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802c1d:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802c1f:	4d 85 e4             	test   %r12,%r12
+  802c22:	74 14                	je     802c38 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802c24:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802c2b:	00 00 00 
+  802c2e:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802c34:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802c38:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802c3f:	00 00 00 
+  802c42:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802c48:	5b                   	pop    %rbx
+  802c49:	41 5c                	pop    %r12
+  802c4b:	5d                   	pop    %rbp
+  802c4c:	c3                   	ret
+        if (from_env_store)
+  802c4d:	48 85 db             	test   %rbx,%rbx
+  802c50:	74 06                	je     802c58 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802c52:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802c58:	4d 85 e4             	test   %r12,%r12
+  802c5b:	74 eb                	je     802c48 <ipc_recv+0x76>
+            *perm_store = 0;
+  802c5d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802c64:	00 
+  802c65:	eb e1                	jmp    802c48 <ipc_recv+0x76>
+
+0000000000802c67 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802c67:	55                   	push   %rbp
+  802c68:	48 89 e5             	mov    %rsp,%rbp
+  802c6b:	41 57                	push   %r15
+  802c6d:	41 56                	push   %r14
+  802c6f:	41 55                	push   %r13
+  802c71:	41 54                	push   %r12
+  802c73:	53                   	push   %rbx
+  802c74:	48 83 ec 18          	sub    $0x18,%rsp
+  802c78:	41 89 fd             	mov    %edi,%r13d
+  802c7b:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802c7e:	48 89 d3             	mov    %rdx,%rbx
+  802c81:	49 89 cc             	mov    %rcx,%r12
+  802c84:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802c88:	48 85 d2             	test   %rdx,%rdx
+  802c8b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802c92:	00 00 00 
+  802c95:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802c99:	49 be 9b 15 80 00 00 	movabs $0x80159b,%r14
+  802ca0:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802ca3:	49 bf ce 11 80 00 00 	movabs $0x8011ce,%r15
+  802caa:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802cad:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802cb0:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802cb4:	4c 89 e1             	mov    %r12,%rcx
+  802cb7:	48 89 da             	mov    %rbx,%rdx
+  802cba:	44 89 ef             	mov    %r13d,%edi
+  802cbd:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802cc0:	85 c0                	test   %eax,%eax
+  802cc2:	74 34                	je     802cf8 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802cc4:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802cc7:	75 05                	jne    802cce <ipc_send+0x67>
+        sys_yield();
+  802cc9:	41 ff d7             	call   *%r15
+    while (true) {
+  802ccc:	eb df                	jmp    802cad <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802cce:	48 ba a0 34 80 00 00 	movabs $0x8034a0,%rdx
+  802cd5:	00 00 00 
+  802cd8:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802cdd:	48 bf b9 34 80 00 00 	movabs $0x8034b9,%rdi
+  802ce4:	00 00 00 
+  802ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cec:	48 b9 38 02 80 00 00 	movabs $0x800238,%rcx
+  802cf3:	00 00 00 
+  802cf6:	ff d1                	call   *%rcx
+    }
+}
+  802cf8:	48 83 c4 18          	add    $0x18,%rsp
+  802cfc:	5b                   	pop    %rbx
+  802cfd:	41 5c                	pop    %r12
+  802cff:	41 5d                	pop    %r13
+  802d01:	41 5e                	pop    %r14
+  802d03:	41 5f                	pop    %r15
+  802d05:	5d                   	pop    %rbp
+  802d06:	c3                   	ret
+
+0000000000802d07 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802d07:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802d0c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802d13:	00 00 00 
+  802d16:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802d1d:	48 01 ca             	add    %rcx,%rdx
+  802d20:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802d26:	39 fa                	cmp    %edi,%edx
+  802d28:	74 12                	je     802d3c <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802d2a:	48 83 c0 01          	add    $0x1,%rax
+  802d2e:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802d34:	75 e0                	jne    802d16 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802d36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d3b:	c3                   	ret
+            return envs[i].env_id;
+  802d3c:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802d43:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802d4a:	00 00 00 
+  802d4d:	48 01 d0             	add    %rdx,%rax
+  802d50:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802d56:	c3                   	ret
+  802d57:	90                   	nop
+
+0000000000802d58 <__rodata_start>:
+  802d58:	72 61                	jb     802dbb <__rodata_start+0x63>
+  802d5a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d5b:	20 6f 6e             	and    %ch,0x6e(%rdi)
+  802d5e:	20 74 77 6f          	and    %dh,0x6f(%rdi,%rsi,2)
+  802d62:	20 43 50             	and    %al,0x50(%rbx)
+  802d65:	55                   	push   %rbp
+  802d66:	73 20                	jae    802d88 <__rodata_start+0x30>
+  802d68:	61                   	(bad)
+  802d69:	74 20                	je     802d8b <__rodata_start+0x33>
+  802d6b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d6c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d6d:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802d70:	28 63 6f             	sub    %ah,0x6f(%rbx)
+  802d73:	75 6e                	jne    802de3 <__rodata_start+0x8b>
+  802d75:	74 65                	je     802ddc <__rodata_start+0x84>
+  802d77:	72 20                	jb     802d99 <__rodata_start+0x41>
+  802d79:	69 73 20 25 64 29 00 	imul   $0x296425,0x20(%rbx),%esi
+  802d80:	75 73                	jne    802df5 <__rodata_start+0x9d>
+  802d82:	65 72 2f             	gs jb  802db4 <__rodata_start+0x5c>
+  802d85:	73 74                	jae    802dfb <__rodata_start+0xa3>
+  802d87:	72 65                	jb     802dee <__rodata_start+0x96>
+  802d89:	73 73                	jae    802dfe <__rodata_start+0xa6>
+  802d8b:	73 63                	jae    802df0 <__rodata_start+0x98>
+  802d8d:	68 65 64 2e 63       	push   $0x632e6465
+  802d92:	00 5b 25             	add    %bl,0x25(%rbx)
+  802d95:	30 38                	xor    %bh,(%rax)
+  802d97:	78 5d                	js     802df6 <__rodata_start+0x9e>
+  802d99:	20 73 74             	and    %dh,0x74(%rbx)
+  802d9c:	72 65                	jb     802e03 <__rodata_start+0xab>
+  802d9e:	73 73                	jae    802e13 <__rodata_start+0xbb>
+  802da0:	73 63                	jae    802e05 <__rodata_start+0xad>
+  802da2:	68 65 64 20 6f       	push   $0x6f206465
+  802da7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802da8:	20 43 50             	and    %al,0x50(%rbx)
+  802dab:	55                   	push   %rbp
+  802dac:	20 25 64 0a 00 3c    	and    %ah,0x3c000a64(%rip)        # 3c803816 <__bss_end+0x3bffb816>
+  802db2:	75 6e                	jne    802e22 <__rodata_start+0xca>
+  802db4:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802db8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802db9:	3e 00 0f             	ds add %cl,(%rdi)
+  802dbc:	1f                   	(bad)
+  802dbd:	44 00 00             	add    %r8b,(%rax)
+  802dc0:	5b                   	pop    %rbx
+  802dc1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802dc6:	20 75 73             	and    %dh,0x73(%rbp)
+  802dc9:	65 72 20             	gs jb  802dec <__rodata_start+0x94>
+  802dcc:	70 61                	jo     802e2f <__rodata_start+0xd7>
+  802dce:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dcf:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  802dd6:	73 20                	jae    802df8 <__rodata_start+0xa0>
+  802dd8:	61                   	(bad)
+  802dd9:	74 20                	je     802dfb <__rodata_start+0xa3>
+  802ddb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  802de0:	3a 20                	cmp    (%rax),%ah
+  802de2:	00 30                	add    %dh,(%rax)
+  802de4:	31 32                	xor    %esi,(%rdx)
+  802de6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802ded:	41                   	rex.B
+  802dee:	42                   	rex.X
+  802def:	43                   	rex.XB
+  802df0:	44                   	rex.R
+  802df1:	45                   	rex.RB
+  802df2:	46 00 30             	rex.RX add %r14b,(%rax)
+  802df5:	31 32                	xor    %esi,(%rdx)
+  802df7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802dfe:	61                   	(bad)
+  802dff:	62 63 64 65 66       	(bad)
+  802e04:	00 28                	add    %ch,(%rax)
+  802e06:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e07:	75 6c                	jne    802e75 <__rodata_start+0x11d>
+  802e09:	6c                   	insb   (%dx),%es:(%rdi)
+  802e0a:	29 00                	sub    %eax,(%rax)
+  802e0c:	65 72 72             	gs jb  802e81 <__rodata_start+0x129>
+  802e0f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e10:	72 20                	jb     802e32 <__rodata_start+0xda>
+  802e12:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802e17:	73 70                	jae    802e89 <__rodata_start+0x131>
+  802e19:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802e1d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802e24:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e25:	72 00                	jb     802e27 <__rodata_start+0xcf>
+  802e27:	62 61 64 20 65       	(bad)
+  802e2c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e2d:	76 69                	jbe    802e98 <__rodata_start+0x140>
+  802e2f:	72 6f                	jb     802ea0 <__rodata_start+0x148>
+  802e31:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e32:	6d                   	insl   (%dx),%es:(%rdi)
+  802e33:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e35:	74 00                	je     802e37 <__rodata_start+0xdf>
+  802e37:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802e3e:	20 70 61             	and    %dh,0x61(%rax)
+  802e41:	72 61                	jb     802ea4 <__rodata_start+0x14c>
+  802e43:	6d                   	insl   (%dx),%es:(%rdi)
+  802e44:	65 74 65             	gs je  802eac <__rodata_start+0x154>
+  802e47:	72 00                	jb     802e49 <__rodata_start+0xf1>
+  802e49:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e4a:	75 74                	jne    802ec0 <__rodata_start+0x168>
+  802e4c:	20 6f 66             	and    %ch,0x66(%rdi)
+  802e4f:	20 6d 65             	and    %ch,0x65(%rbp)
+  802e52:	6d                   	insl   (%dx),%es:(%rdi)
+  802e53:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e54:	72 79                	jb     802ecf <__rodata_start+0x177>
+  802e56:	00 6f 75             	add    %ch,0x75(%rdi)
+  802e59:	74 20                	je     802e7b <__rodata_start+0x123>
+  802e5b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e5c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802e60:	76 69                	jbe    802ecb <__rodata_start+0x173>
+  802e62:	72 6f                	jb     802ed3 <__rodata_start+0x17b>
+  802e64:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e65:	6d                   	insl   (%dx),%es:(%rdi)
+  802e66:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e68:	74 73                	je     802edd <__rodata_start+0x185>
+  802e6a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802e6d:	72 72                	jb     802ee1 <__rodata_start+0x189>
+  802e6f:	75 70                	jne    802ee1 <__rodata_start+0x189>
+  802e71:	74 65                	je     802ed8 <__rodata_start+0x180>
+  802e73:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802e78:	75 67                	jne    802ee1 <__rodata_start+0x189>
+  802e7a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802e7d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e7f:	00 73 65             	add    %dh,0x65(%rbx)
+  802e82:	67 6d                	insl   (%dx),%es:(%edi)
+  802e84:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e86:	74 61                	je     802ee9 <__rodata_start+0x191>
+  802e88:	74 69                	je     802ef3 <__rodata_start+0x19b>
+  802e8a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e8b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e8c:	20 66 61             	and    %ah,0x61(%rsi)
+  802e8f:	75 6c                	jne    802efd <__rodata_start+0x1a5>
+  802e91:	74 00                	je     802e93 <__rodata_start+0x13b>
+  802e93:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802e9a:	20 45 4c             	and    %al,0x4c(%rbp)
+  802e9d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802ea1:	61                   	(bad)
+  802ea2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802ea7:	20 73 75             	and    %dh,0x75(%rbx)
+  802eaa:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802ead:	73 79                	jae    802f28 <__rodata_start+0x1d0>
+  802eaf:	73 74                	jae    802f25 <__rodata_start+0x1cd>
+  802eb1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802eb3:	20 63 61             	and    %ah,0x61(%rbx)
+  802eb6:	6c                   	insb   (%dx),%es:(%rdi)
+  802eb7:	6c                   	insb   (%dx),%es:(%rdi)
+  802eb8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802ebb:	74 72                	je     802f2f <__rodata_start+0x1d7>
+  802ebd:	79 20                	jns    802edf <__rodata_start+0x187>
+  802ebf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ec0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ec1:	74 20                	je     802ee3 <__rodata_start+0x18b>
+  802ec3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802ec5:	75 6e                	jne    802f35 <__rodata_start+0x1dd>
+  802ec7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802ecb:	76 20                	jbe    802eed <__rodata_start+0x195>
+  802ecd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802ed4:	72 65                	jb     802f3b <__rodata_start+0x1e3>
+  802ed6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802ed9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802eda:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802ede:	65 78 70             	gs js  802f51 <__rodata_start+0x1f9>
+  802ee1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802ee6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802ee9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802eed:	20 66 69             	and    %ah,0x69(%rsi)
+  802ef0:	6c                   	insb   (%dx),%es:(%rdi)
+  802ef1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802ef5:	20 66 72             	and    %ah,0x72(%rsi)
+  802ef8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802efd:	61                   	(bad)
+  802efe:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802f01:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f02:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f03:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802f07:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802f0a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f0b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f0c:	20 6d 61             	and    %ch,0x61(%rbp)
+  802f0f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f10:	79 20                	jns    802f32 <__rodata_start+0x1da>
+  802f12:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802f19:	72 65                	jb     802f80 <__rodata_start+0x228>
+  802f1b:	20 6f 70             	and    %ch,0x70(%rdi)
+  802f1e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f20:	00 66 69             	add    %ah,0x69(%rsi)
+  802f23:	6c                   	insb   (%dx),%es:(%rdi)
+  802f24:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802f28:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802f2b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f2c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802f2f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f30:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f31:	74 20                	je     802f53 <__rodata_start+0x1fb>
+  802f33:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802f35:	75 6e                	jne    802fa5 <__rodata_start+0x24d>
+  802f37:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802f3b:	76 61                	jbe    802f9e <__rodata_start+0x246>
+  802f3d:	6c                   	insb   (%dx),%es:(%rdi)
+  802f3e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802f45:	00 
+  802f46:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802f4d:	72 65                	jb     802fb4 <__rodata_start+0x25c>
+  802f4f:	61                   	(bad)
+  802f50:	64 79 20             	fs jns 802f73 <__rodata_start+0x21b>
+  802f53:	65 78 69             	gs js  802fbf <__rodata_start+0x267>
+  802f56:	73 74                	jae    802fcc <__rodata_start+0x274>
+  802f58:	73 00                	jae    802f5a <__rodata_start+0x202>
+  802f5a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f5b:	70 65                	jo     802fc2 <__rodata_start+0x26a>
+  802f5d:	72 61                	jb     802fc0 <__rodata_start+0x268>
+  802f5f:	74 69                	je     802fca <__rodata_start+0x272>
+  802f61:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f62:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f63:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802f66:	74 20                	je     802f88 <__rodata_start+0x230>
+  802f68:	73 75                	jae    802fdf <__rodata_start+0x287>
+  802f6a:	70 70                	jo     802fdc <__rodata_start+0x284>
+  802f6c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f6d:	72 74                	jb     802fe3 <__rodata_start+0x28b>
+  802f6f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802f74:	65 72 61             	gs jb  802fd8 <__rodata_start+0x280>
+  802f77:	74 69                	je     802fe2 <__rodata_start+0x28a>
+  802f79:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f7a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f7b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802f7e:	74 20                	je     802fa0 <__rodata_start+0x248>
+  802f80:	70 65                	jo     802fe7 <__rodata_start+0x28f>
+  802f82:	72 6d                	jb     802ff1 <__rodata_start+0x299>
+  802f84:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  802f8b:	2e 
+  802f8c:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  802f93:	00 
+  802f94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802f9b:	00 00 00 
+  802f9e:	66 90                	xchg   %ax,%ax
+  802fa0:	75 05                	jne    802fa7 <__rodata_start+0x24f>
+  802fa2:	80 00 00             	addb   $0x0,(%rax)
+  802fa5:	00 00                	add    %al,(%rax)
+  802fa7:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  802fad:	00 00                	add    %al,(%rax)
+  802faf:	00 a6 0b 80 00 00    	add    %ah,0x800b(%rsi)
+  802fb5:	00 00                	add    %al,(%rax)
+  802fb7:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  802fbd:	00 00                	add    %al,(%rax)
+  802fbf:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  802fc5:	00 00                	add    %al,(%rax)
+  802fc7:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  802fcd:	00 00                	add    %al,(%rax)
+  802fcf:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  802fd5:	00 00                	add    %al,(%rax)
+  802fd7:	00 94 05 80 00 00 00 	add    %dl,0x80(%rbp,%rax,1)
+  802fde:	00 00                	add    %al,(%rax)
+  802fe0:	b6 0b                	mov    $0xb,%dh
+  802fe2:	80 00 00             	addb   $0x0,(%rax)
+  802fe5:	00 00                	add    %al,(%rax)
+  802fe7:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  802fed:	00 00                	add    %al,(%rax)
+  802fef:	00 88 05 80 00 00    	add    %cl,0x8005(%rax)
+  802ff5:	00 00                	add    %al,(%rax)
+  802ff7:	00 02                	add    %al,(%rdx)
+  802ff9:	06                   	(bad)
+  802ffa:	80 00 00             	addb   $0x0,(%rax)
+  802ffd:	00 00                	add    %al,(%rax)
+  802fff:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803005:	00 00                	add    %al,(%rax)
+  803007:	00 88 05 80 00 00    	add    %cl,0x8005(%rax)
+  80300d:	00 00                	add    %al,(%rax)
+  80300f:	00 ce                	add    %cl,%dh
+  803011:	05 80 00 00 00       	add    $0x80,%eax
+  803016:	00 00                	add    %al,(%rax)
+  803018:	ce                   	(bad)
+  803019:	05 80 00 00 00       	add    $0x80,%eax
+  80301e:	00 00                	add    %al,(%rax)
+  803020:	ce                   	(bad)
+  803021:	05 80 00 00 00       	add    $0x80,%eax
+  803026:	00 00                	add    %al,(%rax)
+  803028:	ce                   	(bad)
+  803029:	05 80 00 00 00       	add    $0x80,%eax
+  80302e:	00 00                	add    %al,(%rax)
+  803030:	ce                   	(bad)
+  803031:	05 80 00 00 00       	add    $0x80,%eax
+  803036:	00 00                	add    %al,(%rax)
+  803038:	ce                   	(bad)
+  803039:	05 80 00 00 00       	add    $0x80,%eax
+  80303e:	00 00                	add    %al,(%rax)
+  803040:	ce                   	(bad)
+  803041:	05 80 00 00 00       	add    $0x80,%eax
+  803046:	00 00                	add    %al,(%rax)
+  803048:	ce                   	(bad)
+  803049:	05 80 00 00 00       	add    $0x80,%eax
+  80304e:	00 00                	add    %al,(%rax)
+  803050:	ce                   	(bad)
+  803051:	05 80 00 00 00       	add    $0x80,%eax
+  803056:	00 00                	add    %al,(%rax)
+  803058:	b6 0b                	mov    $0xb,%dh
+  80305a:	80 00 00             	addb   $0x0,(%rax)
+  80305d:	00 00                	add    %al,(%rax)
+  80305f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803065:	00 00                	add    %al,(%rax)
+  803067:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  80306d:	00 00                	add    %al,(%rax)
+  80306f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803075:	00 00                	add    %al,(%rax)
+  803077:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  80307d:	00 00                	add    %al,(%rax)
+  80307f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803085:	00 00                	add    %al,(%rax)
+  803087:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  80308d:	00 00                	add    %al,(%rax)
+  80308f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803095:	00 00                	add    %al,(%rax)
+  803097:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  80309d:	00 00                	add    %al,(%rax)
+  80309f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8030a5:	00 00                	add    %al,(%rax)
+  8030a7:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8030ad:	00 00                	add    %al,(%rax)
+  8030af:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8030b5:	00 00                	add    %al,(%rax)
+  8030b7:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8030bd:	00 00                	add    %al,(%rax)
+  8030bf:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8030c5:	00 00                	add    %al,(%rax)
+  8030c7:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8030cd:	00 00                	add    %al,(%rax)
+  8030cf:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8030dd:	00 00                	add    %al,(%rax)
+  8030df:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8030e5:	00 00                	add    %al,(%rax)
+  8030e7:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8030ed:	00 00                	add    %al,(%rax)
+  8030ef:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8030f5:	00 00                	add    %al,(%rax)
+  8030f7:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8030fd:	00 00                	add    %al,(%rax)
+  8030ff:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803105:	00 00                	add    %al,(%rax)
+  803107:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  80310d:	00 00                	add    %al,(%rax)
+  80310f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803115:	00 00                	add    %al,(%rax)
+  803117:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  80311d:	00 00                	add    %al,(%rax)
+  80311f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803125:	00 00                	add    %al,(%rax)
+  803127:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  80312d:	00 00                	add    %al,(%rax)
+  80312f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  80313d:	00 00                	add    %al,(%rax)
+  80313f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 d9                	add    %bl,%cl
+  803149:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80314f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803155:	00 00                	add    %al,(%rax)
+  803157:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  80315d:	00 00                	add    %al,(%rax)
+  80315f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803165:	00 00                	add    %al,(%rax)
+  803167:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803175:	00 00                	add    %al,(%rax)
+  803177:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  80317d:	00 00                	add    %al,(%rax)
+  80317f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803185:	00 00                	add    %al,(%rax)
+  803187:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  80318d:	00 00                	add    %al,(%rax)
+  80318f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803195:	00 00                	add    %al,(%rax)
+  803197:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  80319d:	00 00                	add    %al,(%rax)
+  80319f:	00 25 06 80 00 00    	add    %ah,0x8006(%rip)        # 80b1ab <__bss_end+0x31ab>
+  8031a5:	00 00                	add    %al,(%rax)
+  8031a7:	00 f4                	add    %dh,%ah
+  8031a9:	07                   	(bad)
+  8031aa:	80 00 00             	addb   $0x0,(%rax)
+  8031ad:	00 00                	add    %al,(%rax)
+  8031af:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8031b5:	00 00                	add    %al,(%rax)
+  8031b7:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8031bd:	00 00                	add    %al,(%rax)
+  8031bf:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8031c5:	00 00                	add    %al,(%rax)
+  8031c7:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8031cd:	00 00                	add    %al,(%rax)
+  8031cf:	00 54 06 80          	add    %dl,-0x80(%rsi,%rax,1)
+  8031d3:	00 00                	add    %al,(%rax)
+  8031d5:	00 00                	add    %al,(%rax)
+  8031d7:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8031dd:	00 00                	add    %al,(%rax)
+  8031df:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8031e5:	00 00                	add    %al,(%rax)
+  8031e7:	00 1a                	add    %bl,(%rdx)
+  8031e9:	06                   	(bad)
+  8031ea:	80 00 00             	addb   $0x0,(%rax)
+  8031ed:	00 00                	add    %al,(%rax)
+  8031ef:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8031f5:	00 00                	add    %al,(%rax)
+  8031f7:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8031fd:	00 00                	add    %al,(%rax)
+  8031ff:	00 9c 09 80 00 00 00 	add    %bl,0x80(%rcx,%rcx,1)
+  803206:	00 00                	add    %al,(%rax)
+  803208:	66 0a 80 00 00 00 00 	data16 or 0x0(%rax),%al
+  80320f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803215:	00 00                	add    %al,(%rax)
+  803217:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  80321d:	00 00                	add    %al,(%rax)
+  80321f:	00 eb                	add    %ch,%bl
+  803221:	06                   	(bad)
+  803222:	80 00 00             	addb   $0x0,(%rax)
+  803225:	00 00                	add    %al,(%rax)
+  803227:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  80322d:	00 00                	add    %al,(%rax)
+  80322f:	00 c8                	add    %cl,%al
+  803231:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803237:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  80323d:	00 00                	add    %al,(%rax)
+  80323f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803245:	00 00                	add    %al,(%rax)
+  803247:	00 d9                	add    %bl,%cl
+  803249:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80324f:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  803255:	00 00                	add    %al,(%rax)
+  803257:	00 7e 05             	add    %bh,0x5(%rsi)
+  80325a:	80 00 00             	addb   $0x0,(%rax)
+  80325d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803260 <error_string>:
+	...
+  803268:	15 2e 80 00 00 00 00 00 27 2e 80 00 00 00 00 00     ........'.......
+  803278:	37 2e 80 00 00 00 00 00 49 2e 80 00 00 00 00 00     7.......I.......
+  803288:	57 2e 80 00 00 00 00 00 6b 2e 80 00 00 00 00 00     W.......k.......
+  803298:	80 2e 80 00 00 00 00 00 93 2e 80 00 00 00 00 00     ................
+  8032a8:	a5 2e 80 00 00 00 00 00 b9 2e 80 00 00 00 00 00     ................
+  8032b8:	c9 2e 80 00 00 00 00 00 dc 2e 80 00 00 00 00 00     ................
+  8032c8:	f3 2e 80 00 00 00 00 00 09 2f 80 00 00 00 00 00     ........./......
+  8032d8:	21 2f 80 00 00 00 00 00 39 2f 80 00 00 00 00 00     !/......9/......
+  8032e8:	46 2f 80 00 00 00 00 00 10 33 80 00 00 00 00 00     F/.......3......
+  8032f8:	5a 2f 80 00 00 00 00 00 00 00 00 00 00 00 00 00     Z/..............
+  803308:	72 2f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     r/......file is 
+  803318:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803328:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803338:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803348:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803358:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  803368:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  803378:	6c 69 62 2f 66 6f 72 6b 2e 63 00 0f 1f 44 00 00     lib/fork.c...D..
+  803388:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803398:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8033a8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8033b8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8033c8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8033d8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8033e8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8033f8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803408:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803418:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000803420 <devtab>:
+  803420:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803430:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803440:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803450:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803460:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803470:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803480:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803490:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8034a0:	69 70 63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64     ipc_send: failed
+  8034b0:	20 74 6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63      to send.lib/ipc
+  8034c0:	2e 63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     .c.f.........f..
+  8034d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803500:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803510:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803520:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803530:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803540:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803550:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803560:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803570:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803580:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803590:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803600:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803610:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803620:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803630:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803640:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803650:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803660:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803670:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803680:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803690:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803700:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
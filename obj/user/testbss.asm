@@ -0,0 +1,5767 @@
+
+obj/user/testbss:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 35 01 00 00       	call   800158 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#define ARRAYSIZE (1024 * 1024)
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    int i;
+
+    cprintf("Making sure bss works right...\n");
+  800029:	48 bf 48 2c 80 00 00 	movabs $0x802c48,%rdi
+  800030:	00 00 00 
+  800033:	b8 00 00 00 00       	mov    $0x0,%eax
+  800038:	48 ba 72 03 80 00 00 	movabs $0x800372,%rdx
+  80003f:	00 00 00 
+  800042:	ff d2                	call   *%rdx
+  800044:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (i = 0; i < ARRAYSIZE; i++)
+        if (bigarray[i] != 0)
+  800049:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800050:	00 00 00 
+  800053:	83 3c 88 00          	cmpl   $0x0,(%rax,%rcx,4)
+  800057:	0f 85 a5 00 00 00    	jne    800102 <umain+0xdd>
+    for (i = 0; i < ARRAYSIZE; i++)
+  80005d:	48 83 c1 01          	add    $0x1,%rcx
+  800061:	48 81 f9 00 00 10 00 	cmp    $0x100000,%rcx
+  800068:	75 e9                	jne    800053 <umain+0x2e>
+  80006a:	b8 00 00 00 00       	mov    $0x0,%eax
+            panic("bigarray[%d] isn't cleared!\n", i);
+    for (i = 0; i < ARRAYSIZE; i++)
+        bigarray[i] = i;
+  80006f:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800076:	00 00 00 
+  800079:	89 04 82             	mov    %eax,(%rdx,%rax,4)
+    for (i = 0; i < ARRAYSIZE; i++)
+  80007c:	48 83 c0 01          	add    $0x1,%rax
+  800080:	48 3d 00 00 10 00    	cmp    $0x100000,%rax
+  800086:	75 f1                	jne    800079 <umain+0x54>
+  800088:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (i = 0; i < ARRAYSIZE; i++)
+        if (bigarray[i] != i)
+  80008d:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800094:	00 00 00 
+  800097:	39 0c 88             	cmp    %ecx,(%rax,%rcx,4)
+  80009a:	0f 85 8d 00 00 00    	jne    80012d <umain+0x108>
+    for (i = 0; i < ARRAYSIZE; i++)
+  8000a0:	48 83 c1 01          	add    $0x1,%rcx
+  8000a4:	48 81 f9 00 00 10 00 	cmp    $0x100000,%rcx
+  8000ab:	75 ea                	jne    800097 <umain+0x72>
+            panic("bigarray[%d] didn't hold its value!\n", i);
+
+    cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  8000ad:	48 bf 90 2c 80 00 00 	movabs $0x802c90,%rdi
+  8000b4:	00 00 00 
+  8000b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bc:	48 ba 72 03 80 00 00 	movabs $0x800372,%rdx
+  8000c3:	00 00 00 
+  8000c6:	ff d2                	call   *%rdx
+
+    /* Accessing via subscript operator ([]) will result in -Warray-bounds warning. */
+    *((volatile uint32_t *)bigarray + ARRAYSIZE + 0x800000) = 0;
+  8000c8:	48 b8 00 50 c0 02 00 	movabs $0x2c05000,%rax
+  8000cf:	00 00 00 
+  8000d2:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    panic("SHOULD HAVE TRAPPED!!!");
+  8000d8:	48 ba ef 2c 80 00 00 	movabs $0x802cef,%rdx
+  8000df:	00 00 00 
+  8000e2:	be 1b 00 00 00       	mov    $0x1b,%esi
+  8000e7:	48 bf e0 2c 80 00 00 	movabs $0x802ce0,%rdi
+  8000ee:	00 00 00 
+  8000f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f6:	48 b9 22 02 80 00 00 	movabs $0x800222,%rcx
+  8000fd:	00 00 00 
+  800100:	ff d1                	call   *%rcx
+            panic("bigarray[%d] isn't cleared!\n", i);
+  800102:	48 ba c3 2c 80 00 00 	movabs $0x802cc3,%rdx
+  800109:	00 00 00 
+  80010c:	be 10 00 00 00       	mov    $0x10,%esi
+  800111:	48 bf e0 2c 80 00 00 	movabs $0x802ce0,%rdi
+  800118:	00 00 00 
+  80011b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800120:	49 b8 22 02 80 00 00 	movabs $0x800222,%r8
+  800127:	00 00 00 
+  80012a:	41 ff d0             	call   *%r8
+            panic("bigarray[%d] didn't hold its value!\n", i);
+  80012d:	48 ba 68 2c 80 00 00 	movabs $0x802c68,%rdx
+  800134:	00 00 00 
+  800137:	be 15 00 00 00       	mov    $0x15,%esi
+  80013c:	48 bf e0 2c 80 00 00 	movabs $0x802ce0,%rdi
+  800143:	00 00 00 
+  800146:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014b:	49 b8 22 02 80 00 00 	movabs $0x800222,%r8
+  800152:	00 00 00 
+  800155:	41 ff d0             	call   *%r8
+
+0000000000800158 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800158:	55                   	push   %rbp
+  800159:	48 89 e5             	mov    %rsp,%rbp
+  80015c:	41 56                	push   %r14
+  80015e:	41 55                	push   %r13
+  800160:	41 54                	push   %r12
+  800162:	53                   	push   %rbx
+  800163:	41 89 fd             	mov    %edi,%r13d
+  800166:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800169:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800170:	00 00 00 
+  800173:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80017a:	00 00 00 
+  80017d:	48 39 c2             	cmp    %rax,%rdx
+  800180:	73 17                	jae    800199 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800182:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800185:	49 89 c4             	mov    %rax,%r12
+  800188:	48 83 c3 08          	add    $0x8,%rbx
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	ff 53 f8             	call   *-0x8(%rbx)
+  800194:	4c 39 e3             	cmp    %r12,%rbx
+  800197:	72 ef                	jb     800188 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800199:	48 b8 87 11 80 00 00 	movabs $0x801187,%rax
+  8001a0:	00 00 00 
+  8001a3:	ff d0                	call   *%rax
+  8001a5:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8001a8:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8001af:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001b6:	00 00 00 
+  8001b9:	48 01 d0             	add    %rdx,%rax
+  8001bc:	48 a3 00 50 c0 00 00 	movabs %rax,0xc05000
+  8001c3:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001c6:	45 85 ed             	test   %r13d,%r13d
+  8001c9:	7e 0d                	jle    8001d8 <libmain+0x80>
+  8001cb:	49 8b 06             	mov    (%r14),%rax
+  8001ce:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001d5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001d8:	4c 89 f6             	mov    %r14,%rsi
+  8001db:	44 89 ef             	mov    %r13d,%edi
+  8001de:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001e5:	00 00 00 
+  8001e8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001ea:	48 b8 ff 01 80 00 00 	movabs $0x8001ff,%rax
+  8001f1:	00 00 00 
+  8001f4:	ff d0                	call   *%rax
+#endif
+}
+  8001f6:	5b                   	pop    %rbx
+  8001f7:	41 5c                	pop    %r12
+  8001f9:	41 5d                	pop    %r13
+  8001fb:	41 5e                	pop    %r14
+  8001fd:	5d                   	pop    %rbp
+  8001fe:	c3                   	ret
+
+00000000008001ff <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001ff:	55                   	push   %rbp
+  800200:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800203:	48 b8 0f 1a 80 00 00 	movabs $0x801a0f,%rax
+  80020a:	00 00 00 
+  80020d:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80020f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800214:	48 b8 1c 11 80 00 00 	movabs $0x80111c,%rax
+  80021b:	00 00 00 
+  80021e:	ff d0                	call   *%rax
+}
+  800220:	5d                   	pop    %rbp
+  800221:	c3                   	ret
+
+0000000000800222 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800222:	55                   	push   %rbp
+  800223:	48 89 e5             	mov    %rsp,%rbp
+  800226:	41 56                	push   %r14
+  800228:	41 55                	push   %r13
+  80022a:	41 54                	push   %r12
+  80022c:	53                   	push   %rbx
+  80022d:	48 83 ec 50          	sub    $0x50,%rsp
+  800231:	49 89 fc             	mov    %rdi,%r12
+  800234:	41 89 f5             	mov    %esi,%r13d
+  800237:	48 89 d3             	mov    %rdx,%rbx
+  80023a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80023e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800242:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800246:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80024d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800251:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800255:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800259:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80025d:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800264:	00 00 00 
+  800267:	4c 8b 30             	mov    (%rax),%r14
+  80026a:	48 b8 87 11 80 00 00 	movabs $0x801187,%rax
+  800271:	00 00 00 
+  800274:	ff d0                	call   *%rax
+  800276:	89 c6                	mov    %eax,%esi
+  800278:	45 89 e8             	mov    %r13d,%r8d
+  80027b:	4c 89 e1             	mov    %r12,%rcx
+  80027e:	4c 89 f2             	mov    %r14,%rdx
+  800281:	48 bf 10 2d 80 00 00 	movabs $0x802d10,%rdi
+  800288:	00 00 00 
+  80028b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800290:	49 bc 72 03 80 00 00 	movabs $0x800372,%r12
+  800297:	00 00 00 
+  80029a:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80029d:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002a1:	48 89 df             	mov    %rbx,%rdi
+  8002a4:	48 b8 0e 03 80 00 00 	movabs $0x80030e,%rax
+  8002ab:	00 00 00 
+  8002ae:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002b0:	48 bf de 2c 80 00 00 	movabs $0x802cde,%rdi
+  8002b7:	00 00 00 
+  8002ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002bf:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002c2:	cc                   	int3
+  8002c3:	eb fd                	jmp    8002c2 <_panic+0xa0>
+
+00000000008002c5 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002c5:	55                   	push   %rbp
+  8002c6:	48 89 e5             	mov    %rsp,%rbp
+  8002c9:	53                   	push   %rbx
+  8002ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ce:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002d1:	8b 06                	mov    (%rsi),%eax
+  8002d3:	8d 50 01             	lea    0x1(%rax),%edx
+  8002d6:	89 16                	mov    %edx,(%rsi)
+  8002d8:	48 98                	cltq
+  8002da:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002df:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002e5:	74 0a                	je     8002f1 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002e7:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002ef:	c9                   	leave
+  8002f0:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002f1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002f5:	be ff 00 00 00       	mov    $0xff,%esi
+  8002fa:	48 b8 be 10 80 00 00 	movabs $0x8010be,%rax
+  800301:	00 00 00 
+  800304:	ff d0                	call   *%rax
+        state->offset = 0;
+  800306:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80030c:	eb d9                	jmp    8002e7 <putch+0x22>
+
+000000000080030e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80030e:	55                   	push   %rbp
+  80030f:	48 89 e5             	mov    %rsp,%rbp
+  800312:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800319:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80031c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800323:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800328:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800330:	48 89 f1             	mov    %rsi,%rcx
+  800333:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80033a:	48 bf c5 02 80 00 00 	movabs $0x8002c5,%rdi
+  800341:	00 00 00 
+  800344:	48 b8 c2 04 80 00 00 	movabs $0x8004c2,%rax
+  80034b:	00 00 00 
+  80034e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800350:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800357:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80035e:	48 b8 be 10 80 00 00 	movabs $0x8010be,%rax
+  800365:	00 00 00 
+  800368:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80036a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800370:	c9                   	leave
+  800371:	c3                   	ret
+
+0000000000800372 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800372:	55                   	push   %rbp
+  800373:	48 89 e5             	mov    %rsp,%rbp
+  800376:	48 83 ec 50          	sub    $0x50,%rsp
+  80037a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80037e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800382:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800386:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80038a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80038e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800395:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800399:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80039d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003a1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003a5:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003a9:	48 b8 0e 03 80 00 00 	movabs $0x80030e,%rax
+  8003b0:	00 00 00 
+  8003b3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003b5:	c9                   	leave
+  8003b6:	c3                   	ret
+
+00000000008003b7 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003b7:	55                   	push   %rbp
+  8003b8:	48 89 e5             	mov    %rsp,%rbp
+  8003bb:	41 57                	push   %r15
+  8003bd:	41 56                	push   %r14
+  8003bf:	41 55                	push   %r13
+  8003c1:	41 54                	push   %r12
+  8003c3:	53                   	push   %rbx
+  8003c4:	48 83 ec 18          	sub    $0x18,%rsp
+  8003c8:	49 89 fc             	mov    %rdi,%r12
+  8003cb:	49 89 f5             	mov    %rsi,%r13
+  8003ce:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003d2:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003d5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003d8:	41 89 cf             	mov    %ecx,%r15d
+  8003db:	4c 39 fa             	cmp    %r15,%rdx
+  8003de:	73 5b                	jae    80043b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003e0:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003e4:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003e8:	85 db                	test   %ebx,%ebx
+  8003ea:	7e 0e                	jle    8003fa <print_num+0x43>
+            putch(padc, put_arg);
+  8003ec:	4c 89 ee             	mov    %r13,%rsi
+  8003ef:	44 89 f7             	mov    %r14d,%edi
+  8003f2:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003f5:	83 eb 01             	sub    $0x1,%ebx
+  8003f8:	75 f2                	jne    8003ec <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003fa:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003fe:	48 b9 44 2d 80 00 00 	movabs $0x802d44,%rcx
+  800405:	00 00 00 
+  800408:	48 b8 33 2d 80 00 00 	movabs $0x802d33,%rax
+  80040f:	00 00 00 
+  800412:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800416:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80041a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80041f:	49 f7 f7             	div    %r15
+  800422:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800426:	4c 89 ee             	mov    %r13,%rsi
+  800429:	41 ff d4             	call   *%r12
+}
+  80042c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800430:	5b                   	pop    %rbx
+  800431:	41 5c                	pop    %r12
+  800433:	41 5d                	pop    %r13
+  800435:	41 5e                	pop    %r14
+  800437:	41 5f                	pop    %r15
+  800439:	5d                   	pop    %rbp
+  80043a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80043b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80043f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800444:	49 f7 f7             	div    %r15
+  800447:	48 83 ec 08          	sub    $0x8,%rsp
+  80044b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80044f:	52                   	push   %rdx
+  800450:	45 0f be c9          	movsbl %r9b,%r9d
+  800454:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800458:	48 89 c2             	mov    %rax,%rdx
+  80045b:	48 b8 b7 03 80 00 00 	movabs $0x8003b7,%rax
+  800462:	00 00 00 
+  800465:	ff d0                	call   *%rax
+  800467:	48 83 c4 10          	add    $0x10,%rsp
+  80046b:	eb 8d                	jmp    8003fa <print_num+0x43>
+
+000000000080046d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80046d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800471:	48 8b 06             	mov    (%rsi),%rax
+  800474:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800478:	73 0a                	jae    800484 <sprintputch+0x17>
+        *state->start++ = ch;
+  80047a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80047e:	48 89 16             	mov    %rdx,(%rsi)
+  800481:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800484:	c3                   	ret
+
+0000000000800485 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800485:	55                   	push   %rbp
+  800486:	48 89 e5             	mov    %rsp,%rbp
+  800489:	48 83 ec 50          	sub    $0x50,%rsp
+  80048d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800491:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800495:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800499:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004a0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004a4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004ac:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004b0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004b4:	48 b8 c2 04 80 00 00 	movabs $0x8004c2,%rax
+  8004bb:	00 00 00 
+  8004be:	ff d0                	call   *%rax
+}
+  8004c0:	c9                   	leave
+  8004c1:	c3                   	ret
+
+00000000008004c2 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004c2:	55                   	push   %rbp
+  8004c3:	48 89 e5             	mov    %rsp,%rbp
+  8004c6:	41 57                	push   %r15
+  8004c8:	41 56                	push   %r14
+  8004ca:	41 55                	push   %r13
+  8004cc:	41 54                	push   %r12
+  8004ce:	53                   	push   %rbx
+  8004cf:	48 83 ec 38          	sub    $0x38,%rsp
+  8004d3:	49 89 fe             	mov    %rdi,%r14
+  8004d6:	49 89 f5             	mov    %rsi,%r13
+  8004d9:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004dc:	48 8b 01             	mov    (%rcx),%rax
+  8004df:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004e3:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004eb:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004ef:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004f3:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004f7:	0f b6 3b             	movzbl (%rbx),%edi
+  8004fa:	40 80 ff 25          	cmp    $0x25,%dil
+  8004fe:	74 18                	je     800518 <vprintfmt+0x56>
+            if (!ch) return;
+  800500:	40 84 ff             	test   %dil,%dil
+  800503:	0f 84 b1 06 00 00    	je     800bba <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800509:	40 0f b6 ff          	movzbl %dil,%edi
+  80050d:	4c 89 ee             	mov    %r13,%rsi
+  800510:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800513:	4c 89 e3             	mov    %r12,%rbx
+  800516:	eb db                	jmp    8004f3 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800518:	be 00 00 00 00       	mov    $0x0,%esi
+  80051d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800521:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800526:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80052c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800533:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800537:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80053c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800541:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800544:	83 e8 23             	sub    $0x23,%eax
+  800547:	3c 57                	cmp    $0x57,%al
+  800549:	0f 87 51 06 00 00    	ja     800ba0 <vprintfmt+0x6de>
+  80054f:	0f b6 c0             	movzbl %al,%eax
+  800552:	48 b9 e0 2e 80 00 00 	movabs $0x802ee0,%rcx
+  800559:	00 00 00 
+  80055c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80055f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800562:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800566:	eb cf                	jmp    800537 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800568:	49 89 dc             	mov    %rbx,%r12
+  80056b:	be 01 00 00 00       	mov    $0x1,%esi
+  800570:	eb c5                	jmp    800537 <vprintfmt+0x75>
+            padc = ch;
+  800572:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800576:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800579:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80057c:	eb b9                	jmp    800537 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80057e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800581:	83 f8 2f             	cmp    $0x2f,%eax
+  800584:	77 24                	ja     8005aa <vprintfmt+0xe8>
+  800586:	89 c1                	mov    %eax,%ecx
+  800588:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80058c:	83 c0 08             	add    $0x8,%eax
+  80058f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800592:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800595:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800598:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80059c:	79 99                	jns    800537 <vprintfmt+0x75>
+                width = precision;
+  80059e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005a2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005a8:	eb 8d                	jmp    800537 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005aa:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005ae:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b6:	eb da                	jmp    800592 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005b8:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005bd:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005c1:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005c7:	3c 39                	cmp    $0x39,%al
+  8005c9:	77 1c                	ja     8005e7 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005cb:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005cf:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005d3:	0f b6 c0             	movzbl %al,%eax
+  8005d6:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005db:	0f b6 03             	movzbl (%rbx),%eax
+  8005de:	3c 39                	cmp    $0x39,%al
+  8005e0:	76 e9                	jbe    8005cb <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005e2:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005e5:	eb b1                	jmp    800598 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005e7:	49 89 dc             	mov    %rbx,%r12
+  8005ea:	eb ac                	jmp    800598 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005ec:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005ef:	85 c9                	test   %ecx,%ecx
+  8005f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f6:	0f 49 c1             	cmovns %ecx,%eax
+  8005f9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005fc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005ff:	e9 33 ff ff ff       	jmp    800537 <vprintfmt+0x75>
+            lflag++;
+  800604:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800607:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80060a:	e9 28 ff ff ff       	jmp    800537 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80060f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800612:	83 f8 2f             	cmp    $0x2f,%eax
+  800615:	77 19                	ja     800630 <vprintfmt+0x16e>
+  800617:	89 c2                	mov    %eax,%edx
+  800619:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80061d:	83 c0 08             	add    $0x8,%eax
+  800620:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800623:	8b 3a                	mov    (%rdx),%edi
+  800625:	4c 89 ee             	mov    %r13,%rsi
+  800628:	41 ff d6             	call   *%r14
+            break;
+  80062b:	e9 c3 fe ff ff       	jmp    8004f3 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800630:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800634:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800638:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80063c:	eb e5                	jmp    800623 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80063e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800641:	83 f8 2f             	cmp    $0x2f,%eax
+  800644:	77 5a                	ja     8006a0 <vprintfmt+0x1de>
+  800646:	89 c2                	mov    %eax,%edx
+  800648:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80064c:	83 c0 08             	add    $0x8,%eax
+  80064f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800652:	8b 02                	mov    (%rdx),%eax
+  800654:	89 c1                	mov    %eax,%ecx
+  800656:	f7 d9                	neg    %ecx
+  800658:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80065b:	83 f9 15             	cmp    $0x15,%ecx
+  80065e:	7f 4e                	jg     8006ae <vprintfmt+0x1ec>
+  800660:	48 63 c1             	movslq %ecx,%rax
+  800663:	48 ba a0 31 80 00 00 	movabs $0x8031a0,%rdx
+  80066a:	00 00 00 
+  80066d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800671:	48 85 c0             	test   %rax,%rax
+  800674:	74 38                	je     8006ae <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800676:	48 89 c1             	mov    %rax,%rcx
+  800679:	48 ba 59 33 80 00 00 	movabs $0x803359,%rdx
+  800680:	00 00 00 
+  800683:	4c 89 ee             	mov    %r13,%rsi
+  800686:	4c 89 f7             	mov    %r14,%rdi
+  800689:	b8 00 00 00 00       	mov    $0x0,%eax
+  80068e:	49 b8 85 04 80 00 00 	movabs $0x800485,%r8
+  800695:	00 00 00 
+  800698:	41 ff d0             	call   *%r8
+  80069b:	e9 53 fe ff ff       	jmp    8004f3 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006a4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ac:	eb a4                	jmp    800652 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006ae:	48 ba 5c 2d 80 00 00 	movabs $0x802d5c,%rdx
+  8006b5:	00 00 00 
+  8006b8:	4c 89 ee             	mov    %r13,%rsi
+  8006bb:	4c 89 f7             	mov    %r14,%rdi
+  8006be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c3:	49 b8 85 04 80 00 00 	movabs $0x800485,%r8
+  8006ca:	00 00 00 
+  8006cd:	41 ff d0             	call   *%r8
+  8006d0:	e9 1e fe ff ff       	jmp    8004f3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006db:	77 6c                	ja     800749 <vprintfmt+0x287>
+  8006dd:	89 c2                	mov    %eax,%edx
+  8006df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e3:	83 c0 08             	add    $0x8,%eax
+  8006e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006e9:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006ec:	48 85 d2             	test   %rdx,%rdx
+  8006ef:	48 b8 55 2d 80 00 00 	movabs $0x802d55,%rax
+  8006f6:	00 00 00 
+  8006f9:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006fd:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800701:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800705:	7e 06                	jle    80070d <vprintfmt+0x24b>
+  800707:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80070b:	75 4a                	jne    800757 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80070d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800711:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800715:	0f b6 00             	movzbl (%rax),%eax
+  800718:	84 c0                	test   %al,%al
+  80071a:	0f 85 9a 00 00 00    	jne    8007ba <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800720:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800723:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800727:	85 c0                	test   %eax,%eax
+  800729:	0f 8e c4 fd ff ff    	jle    8004f3 <vprintfmt+0x31>
+  80072f:	4c 89 ee             	mov    %r13,%rsi
+  800732:	bf 20 00 00 00       	mov    $0x20,%edi
+  800737:	41 ff d6             	call   *%r14
+  80073a:	41 83 ec 01          	sub    $0x1,%r12d
+  80073e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800742:	75 eb                	jne    80072f <vprintfmt+0x26d>
+  800744:	e9 aa fd ff ff       	jmp    8004f3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800749:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80074d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800751:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800755:	eb 92                	jmp    8006e9 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800757:	49 63 f7             	movslq %r15d,%rsi
+  80075a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80075e:	48 b8 74 0c 80 00 00 	movabs $0x800c74,%rax
+  800765:	00 00 00 
+  800768:	ff d0                	call   *%rax
+  80076a:	48 89 c2             	mov    %rax,%rdx
+  80076d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800770:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800772:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800775:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800778:	85 c0                	test   %eax,%eax
+  80077a:	7e 91                	jle    80070d <vprintfmt+0x24b>
+  80077c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800781:	4c 89 ee             	mov    %r13,%rsi
+  800784:	44 89 e7             	mov    %r12d,%edi
+  800787:	41 ff d6             	call   *%r14
+  80078a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80078e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800791:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800794:	75 eb                	jne    800781 <vprintfmt+0x2bf>
+  800796:	e9 72 ff ff ff       	jmp    80070d <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80079b:	0f b6 f8             	movzbl %al,%edi
+  80079e:	4c 89 ee             	mov    %r13,%rsi
+  8007a1:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007a4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007a8:	49 83 c4 01          	add    $0x1,%r12
+  8007ac:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007b2:	84 c0                	test   %al,%al
+  8007b4:	0f 84 66 ff ff ff    	je     800720 <vprintfmt+0x25e>
+  8007ba:	45 85 ff             	test   %r15d,%r15d
+  8007bd:	78 0a                	js     8007c9 <vprintfmt+0x307>
+  8007bf:	41 83 ef 01          	sub    $0x1,%r15d
+  8007c3:	0f 88 57 ff ff ff    	js     800720 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007c9:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007cd:	74 cc                	je     80079b <vprintfmt+0x2d9>
+  8007cf:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007d2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007d7:	80 fa 5e             	cmp    $0x5e,%dl
+  8007da:	77 c2                	ja     80079e <vprintfmt+0x2dc>
+  8007dc:	eb bd                	jmp    80079b <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007de:	40 84 f6             	test   %sil,%sil
+  8007e1:	75 26                	jne    800809 <vprintfmt+0x347>
+    switch (lflag) {
+  8007e3:	85 d2                	test   %edx,%edx
+  8007e5:	74 59                	je     800840 <vprintfmt+0x37e>
+  8007e7:	83 fa 01             	cmp    $0x1,%edx
+  8007ea:	74 7b                	je     800867 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f2:	0f 87 96 00 00 00    	ja     80088e <vprintfmt+0x3cc>
+  8007f8:	89 c2                	mov    %eax,%edx
+  8007fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fe:	83 c0 08             	add    $0x8,%eax
+  800801:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800804:	4c 8b 22             	mov    (%rdx),%r12
+  800807:	eb 17                	jmp    800820 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800809:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080c:	83 f8 2f             	cmp    $0x2f,%eax
+  80080f:	77 21                	ja     800832 <vprintfmt+0x370>
+  800811:	89 c2                	mov    %eax,%edx
+  800813:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800817:	83 c0 08             	add    $0x8,%eax
+  80081a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800820:	4d 85 e4             	test   %r12,%r12
+  800823:	78 7a                	js     80089f <vprintfmt+0x3dd>
+            num = i;
+  800825:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800828:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80082d:	e9 50 02 00 00       	jmp    800a82 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800832:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800836:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083e:	eb dd                	jmp    80081d <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800840:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800843:	83 f8 2f             	cmp    $0x2f,%eax
+  800846:	77 11                	ja     800859 <vprintfmt+0x397>
+  800848:	89 c2                	mov    %eax,%edx
+  80084a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084e:	83 c0 08             	add    $0x8,%eax
+  800851:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800854:	4c 63 22             	movslq (%rdx),%r12
+  800857:	eb c7                	jmp    800820 <vprintfmt+0x35e>
+  800859:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800861:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800865:	eb ed                	jmp    800854 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800867:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086a:	83 f8 2f             	cmp    $0x2f,%eax
+  80086d:	77 11                	ja     800880 <vprintfmt+0x3be>
+  80086f:	89 c2                	mov    %eax,%edx
+  800871:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800875:	83 c0 08             	add    $0x8,%eax
+  800878:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087b:	4c 8b 22             	mov    (%rdx),%r12
+  80087e:	eb a0                	jmp    800820 <vprintfmt+0x35e>
+  800880:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800884:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800888:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088c:	eb ed                	jmp    80087b <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80088e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800892:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800896:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089a:	e9 65 ff ff ff       	jmp    800804 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80089f:	4c 89 ee             	mov    %r13,%rsi
+  8008a2:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008a7:	41 ff d6             	call   *%r14
+                i = -i;
+  8008aa:	49 f7 dc             	neg    %r12
+  8008ad:	e9 73 ff ff ff       	jmp    800825 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008b2:	40 84 f6             	test   %sil,%sil
+  8008b5:	75 32                	jne    8008e9 <vprintfmt+0x427>
+    switch (lflag) {
+  8008b7:	85 d2                	test   %edx,%edx
+  8008b9:	74 5d                	je     800918 <vprintfmt+0x456>
+  8008bb:	83 fa 01             	cmp    $0x1,%edx
+  8008be:	0f 84 82 00 00 00    	je     800946 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ca:	0f 87 a5 00 00 00    	ja     800975 <vprintfmt+0x4b3>
+  8008d0:	89 c2                	mov    %eax,%edx
+  8008d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d6:	83 c0 08             	add    $0x8,%eax
+  8008d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008dc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008df:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008e4:	e9 99 01 00 00       	jmp    800a82 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ef:	77 19                	ja     80090a <vprintfmt+0x448>
+  8008f1:	89 c2                	mov    %eax,%edx
+  8008f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f7:	83 c0 08             	add    $0x8,%eax
+  8008fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008fd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800900:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800905:	e9 78 01 00 00       	jmp    800a82 <vprintfmt+0x5c0>
+  80090a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800912:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800916:	eb e5                	jmp    8008fd <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800918:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091b:	83 f8 2f             	cmp    $0x2f,%eax
+  80091e:	77 18                	ja     800938 <vprintfmt+0x476>
+  800920:	89 c2                	mov    %eax,%edx
+  800922:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800926:	83 c0 08             	add    $0x8,%eax
+  800929:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80092e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800933:	e9 4a 01 00 00       	jmp    800a82 <vprintfmt+0x5c0>
+  800938:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80093c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800940:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800944:	eb e6                	jmp    80092c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800946:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800949:	83 f8 2f             	cmp    $0x2f,%eax
+  80094c:	77 19                	ja     800967 <vprintfmt+0x4a5>
+  80094e:	89 c2                	mov    %eax,%edx
+  800950:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800954:	83 c0 08             	add    $0x8,%eax
+  800957:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80095d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800962:	e9 1b 01 00 00       	jmp    800a82 <vprintfmt+0x5c0>
+  800967:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800973:	eb e5                	jmp    80095a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800975:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800979:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800981:	e9 56 ff ff ff       	jmp    8008dc <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800986:	40 84 f6             	test   %sil,%sil
+  800989:	75 2e                	jne    8009b9 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80098b:	85 d2                	test   %edx,%edx
+  80098d:	74 59                	je     8009e8 <vprintfmt+0x526>
+  80098f:	83 fa 01             	cmp    $0x1,%edx
+  800992:	74 7f                	je     800a13 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800994:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800997:	83 f8 2f             	cmp    $0x2f,%eax
+  80099a:	0f 87 9f 00 00 00    	ja     800a3f <vprintfmt+0x57d>
+  8009a0:	89 c2                	mov    %eax,%edx
+  8009a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a6:	83 c0 08             	add    $0x8,%eax
+  8009a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ac:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009af:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009b4:	e9 c9 00 00 00       	jmp    800a82 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009bf:	77 19                	ja     8009da <vprintfmt+0x518>
+  8009c1:	89 c2                	mov    %eax,%edx
+  8009c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c7:	83 c0 08             	add    $0x8,%eax
+  8009ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009cd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009d0:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009d5:	e9 a8 00 00 00       	jmp    800a82 <vprintfmt+0x5c0>
+  8009da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e6:	eb e5                	jmp    8009cd <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ee:	77 15                	ja     800a05 <vprintfmt+0x543>
+  8009f0:	89 c2                	mov    %eax,%edx
+  8009f2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f6:	83 c0 08             	add    $0x8,%eax
+  8009f9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fc:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8009fe:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a03:	eb 7d                	jmp    800a82 <vprintfmt+0x5c0>
+  800a05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a09:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a11:	eb e9                	jmp    8009fc <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a16:	83 f8 2f             	cmp    $0x2f,%eax
+  800a19:	77 16                	ja     800a31 <vprintfmt+0x56f>
+  800a1b:	89 c2                	mov    %eax,%edx
+  800a1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a21:	83 c0 08             	add    $0x8,%eax
+  800a24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a27:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a2a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a2f:	eb 51                	jmp    800a82 <vprintfmt+0x5c0>
+  800a31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3d:	eb e8                	jmp    800a27 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a43:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a4b:	e9 5c ff ff ff       	jmp    8009ac <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a50:	4c 89 ee             	mov    %r13,%rsi
+  800a53:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a58:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a5b:	4c 89 ee             	mov    %r13,%rsi
+  800a5e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a63:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a66:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a69:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6c:	77 47                	ja     800ab5 <vprintfmt+0x5f3>
+  800a6e:	89 c2                	mov    %eax,%edx
+  800a70:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a74:	83 c0 08             	add    $0x8,%eax
+  800a77:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a7d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a82:	48 83 ec 08          	sub    $0x8,%rsp
+  800a86:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a8a:	0f 94 c0             	sete   %al
+  800a8d:	0f b6 c0             	movzbl %al,%eax
+  800a90:	50                   	push   %rax
+  800a91:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a96:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a9a:	4c 89 ee             	mov    %r13,%rsi
+  800a9d:	4c 89 f7             	mov    %r14,%rdi
+  800aa0:	48 b8 b7 03 80 00 00 	movabs $0x8003b7,%rax
+  800aa7:	00 00 00 
+  800aaa:	ff d0                	call   *%rax
+            break;
+  800aac:	48 83 c4 10          	add    $0x10,%rsp
+  800ab0:	e9 3e fa ff ff       	jmp    8004f3 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ab5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800abd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac1:	eb b7                	jmp    800a7a <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ac3:	40 84 f6             	test   %sil,%sil
+  800ac6:	75 2b                	jne    800af3 <vprintfmt+0x631>
+    switch (lflag) {
+  800ac8:	85 d2                	test   %edx,%edx
+  800aca:	74 56                	je     800b22 <vprintfmt+0x660>
+  800acc:	83 fa 01             	cmp    $0x1,%edx
+  800acf:	74 7f                	je     800b50 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800ad1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad7:	0f 87 a2 00 00 00    	ja     800b7f <vprintfmt+0x6bd>
+  800add:	89 c2                	mov    %eax,%edx
+  800adf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae3:	83 c0 08             	add    $0x8,%eax
+  800ae6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aec:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800af1:	eb 8f                	jmp    800a82 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800af3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af6:	83 f8 2f             	cmp    $0x2f,%eax
+  800af9:	77 19                	ja     800b14 <vprintfmt+0x652>
+  800afb:	89 c2                	mov    %eax,%edx
+  800afd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b01:	83 c0 08             	add    $0x8,%eax
+  800b04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b07:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b0a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b0f:	e9 6e ff ff ff       	jmp    800a82 <vprintfmt+0x5c0>
+  800b14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b20:	eb e5                	jmp    800b07 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b25:	83 f8 2f             	cmp    $0x2f,%eax
+  800b28:	77 18                	ja     800b42 <vprintfmt+0x680>
+  800b2a:	89 c2                	mov    %eax,%edx
+  800b2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b30:	83 c0 08             	add    $0x8,%eax
+  800b33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b36:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b38:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b3d:	e9 40 ff ff ff       	jmp    800a82 <vprintfmt+0x5c0>
+  800b42:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b46:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4e:	eb e6                	jmp    800b36 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b53:	83 f8 2f             	cmp    $0x2f,%eax
+  800b56:	77 19                	ja     800b71 <vprintfmt+0x6af>
+  800b58:	89 c2                	mov    %eax,%edx
+  800b5a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5e:	83 c0 08             	add    $0x8,%eax
+  800b61:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b64:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b67:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b6c:	e9 11 ff ff ff       	jmp    800a82 <vprintfmt+0x5c0>
+  800b71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b75:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7d:	eb e5                	jmp    800b64 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b83:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8b:	e9 59 ff ff ff       	jmp    800ae9 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b90:	4c 89 ee             	mov    %r13,%rsi
+  800b93:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b98:	41 ff d6             	call   *%r14
+            break;
+  800b9b:	e9 53 f9 ff ff       	jmp    8004f3 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ba0:	4c 89 ee             	mov    %r13,%rsi
+  800ba3:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ba8:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bab:	48 83 eb 01          	sub    $0x1,%rbx
+  800baf:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bb3:	75 f6                	jne    800bab <vprintfmt+0x6e9>
+  800bb5:	e9 39 f9 ff ff       	jmp    8004f3 <vprintfmt+0x31>
+}
+  800bba:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bbe:	5b                   	pop    %rbx
+  800bbf:	41 5c                	pop    %r12
+  800bc1:	41 5d                	pop    %r13
+  800bc3:	41 5e                	pop    %r14
+  800bc5:	41 5f                	pop    %r15
+  800bc7:	5d                   	pop    %rbp
+  800bc8:	c3                   	ret
+
+0000000000800bc9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bc9:	55                   	push   %rbp
+  800bca:	48 89 e5             	mov    %rsp,%rbp
+  800bcd:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bd1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bd5:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800bda:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800bde:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800be5:	48 85 ff             	test   %rdi,%rdi
+  800be8:	74 2b                	je     800c15 <vsnprintf+0x4c>
+  800bea:	48 85 f6             	test   %rsi,%rsi
+  800bed:	74 26                	je     800c15 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bef:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bf3:	48 bf 6d 04 80 00 00 	movabs $0x80046d,%rdi
+  800bfa:	00 00 00 
+  800bfd:	48 b8 c2 04 80 00 00 	movabs $0x8004c2,%rax
+  800c04:	00 00 00 
+  800c07:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c0d:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c10:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c13:	c9                   	leave
+  800c14:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c15:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c1a:	eb f7                	jmp    800c13 <vsnprintf+0x4a>
+
+0000000000800c1c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c1c:	55                   	push   %rbp
+  800c1d:	48 89 e5             	mov    %rsp,%rbp
+  800c20:	48 83 ec 50          	sub    $0x50,%rsp
+  800c24:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c28:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c2c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c30:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c37:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c43:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c47:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c4b:	48 b8 c9 0b 80 00 00 	movabs $0x800bc9,%rax
+  800c52:	00 00 00 
+  800c55:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c57:	c9                   	leave
+  800c58:	c3                   	ret
+
+0000000000800c59 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c59:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c5c:	74 10                	je     800c6e <strlen+0x15>
+    size_t n = 0;
+  800c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c63:	48 83 c0 01          	add    $0x1,%rax
+  800c67:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c6b:	75 f6                	jne    800c63 <strlen+0xa>
+  800c6d:	c3                   	ret
+    size_t n = 0;
+  800c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c73:	c3                   	ret
+
+0000000000800c74 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c74:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c77:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c7c:	48 85 f6             	test   %rsi,%rsi
+  800c7f:	74 11                	je     800c92 <strnlen+0x1e>
+  800c81:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c85:	74 0c                	je     800c93 <strnlen+0x1f>
+  800c87:	48 83 c2 01          	add    $0x1,%rdx
+  800c8b:	48 39 d0             	cmp    %rdx,%rax
+  800c8e:	75 f1                	jne    800c81 <strnlen+0xd>
+  800c90:	eb 04                	jmp    800c96 <strnlen+0x22>
+  800c92:	c3                   	ret
+  800c93:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c96:	c3                   	ret
+
+0000000000800c97 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c97:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c9f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ca3:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ca6:	48 83 c2 01          	add    $0x1,%rdx
+  800caa:	84 c9                	test   %cl,%cl
+  800cac:	75 f1                	jne    800c9f <strcpy+0x8>
+        ;
+    return res;
+}
+  800cae:	c3                   	ret
+
+0000000000800caf <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800caf:	55                   	push   %rbp
+  800cb0:	48 89 e5             	mov    %rsp,%rbp
+  800cb3:	41 54                	push   %r12
+  800cb5:	53                   	push   %rbx
+  800cb6:	48 89 fb             	mov    %rdi,%rbx
+  800cb9:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cbc:	48 b8 59 0c 80 00 00 	movabs $0x800c59,%rax
+  800cc3:	00 00 00 
+  800cc6:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cc8:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ccc:	4c 89 e6             	mov    %r12,%rsi
+  800ccf:	48 b8 97 0c 80 00 00 	movabs $0x800c97,%rax
+  800cd6:	00 00 00 
+  800cd9:	ff d0                	call   *%rax
+    return dst;
+}
+  800cdb:	48 89 d8             	mov    %rbx,%rax
+  800cde:	5b                   	pop    %rbx
+  800cdf:	41 5c                	pop    %r12
+  800ce1:	5d                   	pop    %rbp
+  800ce2:	c3                   	ret
+
+0000000000800ce3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ce3:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ce6:	48 85 d2             	test   %rdx,%rdx
+  800ce9:	74 1f                	je     800d0a <strncpy+0x27>
+  800ceb:	48 01 fa             	add    %rdi,%rdx
+  800cee:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cf1:	48 83 c1 01          	add    $0x1,%rcx
+  800cf5:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cf9:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800cfd:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d01:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d05:	48 39 ca             	cmp    %rcx,%rdx
+  800d08:	75 e7                	jne    800cf1 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d0a:	c3                   	ret
+
+0000000000800d0b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d0b:	48 89 f8             	mov    %rdi,%rax
+  800d0e:	48 85 d2             	test   %rdx,%rdx
+  800d11:	74 24                	je     800d37 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d13:	48 83 ea 01          	sub    $0x1,%rdx
+  800d17:	74 1b                	je     800d34 <strlcpy+0x29>
+  800d19:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d1d:	0f b6 16             	movzbl (%rsi),%edx
+  800d20:	84 d2                	test   %dl,%dl
+  800d22:	74 10                	je     800d34 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d24:	48 83 c6 01          	add    $0x1,%rsi
+  800d28:	48 83 c0 01          	add    $0x1,%rax
+  800d2c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d2f:	48 39 c8             	cmp    %rcx,%rax
+  800d32:	75 e9                	jne    800d1d <strlcpy+0x12>
+        *dst = '\0';
+  800d34:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d37:	48 29 f8             	sub    %rdi,%rax
+}
+  800d3a:	c3                   	ret
+
+0000000000800d3b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d3b:	0f b6 07             	movzbl (%rdi),%eax
+  800d3e:	84 c0                	test   %al,%al
+  800d40:	74 13                	je     800d55 <strcmp+0x1a>
+  800d42:	38 06                	cmp    %al,(%rsi)
+  800d44:	75 0f                	jne    800d55 <strcmp+0x1a>
+  800d46:	48 83 c7 01          	add    $0x1,%rdi
+  800d4a:	48 83 c6 01          	add    $0x1,%rsi
+  800d4e:	0f b6 07             	movzbl (%rdi),%eax
+  800d51:	84 c0                	test   %al,%al
+  800d53:	75 ed                	jne    800d42 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d55:	0f b6 c0             	movzbl %al,%eax
+  800d58:	0f b6 16             	movzbl (%rsi),%edx
+  800d5b:	29 d0                	sub    %edx,%eax
+}
+  800d5d:	c3                   	ret
+
+0000000000800d5e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d5e:	48 85 d2             	test   %rdx,%rdx
+  800d61:	74 1f                	je     800d82 <strncmp+0x24>
+  800d63:	0f b6 07             	movzbl (%rdi),%eax
+  800d66:	84 c0                	test   %al,%al
+  800d68:	74 1e                	je     800d88 <strncmp+0x2a>
+  800d6a:	3a 06                	cmp    (%rsi),%al
+  800d6c:	75 1a                	jne    800d88 <strncmp+0x2a>
+  800d6e:	48 83 c7 01          	add    $0x1,%rdi
+  800d72:	48 83 c6 01          	add    $0x1,%rsi
+  800d76:	48 83 ea 01          	sub    $0x1,%rdx
+  800d7a:	75 e7                	jne    800d63 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d81:	c3                   	ret
+  800d82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d87:	c3                   	ret
+  800d88:	48 85 d2             	test   %rdx,%rdx
+  800d8b:	74 09                	je     800d96 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d8d:	0f b6 07             	movzbl (%rdi),%eax
+  800d90:	0f b6 16             	movzbl (%rsi),%edx
+  800d93:	29 d0                	sub    %edx,%eax
+  800d95:	c3                   	ret
+    if (!n) return 0;
+  800d96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d9b:	c3                   	ret
+
+0000000000800d9c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d9c:	0f b6 17             	movzbl (%rdi),%edx
+  800d9f:	84 d2                	test   %dl,%dl
+  800da1:	74 18                	je     800dbb <strchr+0x1f>
+        if (*str == c) {
+  800da3:	0f be d2             	movsbl %dl,%edx
+  800da6:	39 f2                	cmp    %esi,%edx
+  800da8:	74 17                	je     800dc1 <strchr+0x25>
+    for (; *str; str++) {
+  800daa:	48 83 c7 01          	add    $0x1,%rdi
+  800dae:	0f b6 17             	movzbl (%rdi),%edx
+  800db1:	84 d2                	test   %dl,%dl
+  800db3:	75 ee                	jne    800da3 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800db5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dba:	c3                   	ret
+  800dbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc0:	c3                   	ret
+  800dc1:	48 89 f8             	mov    %rdi,%rax
+}
+  800dc4:	c3                   	ret
+
+0000000000800dc5 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800dc5:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800dc8:	0f b6 17             	movzbl (%rdi),%edx
+  800dcb:	84 d2                	test   %dl,%dl
+  800dcd:	74 13                	je     800de2 <strfind+0x1d>
+  800dcf:	0f be d2             	movsbl %dl,%edx
+  800dd2:	39 f2                	cmp    %esi,%edx
+  800dd4:	74 0b                	je     800de1 <strfind+0x1c>
+  800dd6:	48 83 c0 01          	add    $0x1,%rax
+  800dda:	0f b6 10             	movzbl (%rax),%edx
+  800ddd:	84 d2                	test   %dl,%dl
+  800ddf:	75 ee                	jne    800dcf <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800de1:	c3                   	ret
+  800de2:	c3                   	ret
+
+0000000000800de3 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800de3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800de6:	48 89 f8             	mov    %rdi,%rax
+  800de9:	48 f7 d8             	neg    %rax
+  800dec:	83 e0 07             	and    $0x7,%eax
+  800def:	49 89 d1             	mov    %rdx,%r9
+  800df2:	49 29 c1             	sub    %rax,%r9
+  800df5:	78 36                	js     800e2d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800df7:	40 0f b6 c6          	movzbl %sil,%eax
+  800dfb:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e02:	01 01 01 
+  800e05:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e09:	40 f6 c7 07          	test   $0x7,%dil
+  800e0d:	75 38                	jne    800e47 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e0f:	4c 89 c9             	mov    %r9,%rcx
+  800e12:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e16:	74 0c                	je     800e24 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e18:	fc                   	cld
+  800e19:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e1c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e20:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e24:	4d 85 c9             	test   %r9,%r9
+  800e27:	75 45                	jne    800e6e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e29:	4c 89 c0             	mov    %r8,%rax
+  800e2c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e2d:	48 85 d2             	test   %rdx,%rdx
+  800e30:	74 f7                	je     800e29 <memset+0x46>
+  800e32:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e35:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e38:	48 83 c0 01          	add    $0x1,%rax
+  800e3c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e40:	48 39 c2             	cmp    %rax,%rdx
+  800e43:	75 f3                	jne    800e38 <memset+0x55>
+  800e45:	eb e2                	jmp    800e29 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e47:	40 f6 c7 01          	test   $0x1,%dil
+  800e4b:	74 06                	je     800e53 <memset+0x70>
+  800e4d:	88 07                	mov    %al,(%rdi)
+  800e4f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e53:	40 f6 c7 02          	test   $0x2,%dil
+  800e57:	74 07                	je     800e60 <memset+0x7d>
+  800e59:	66 89 07             	mov    %ax,(%rdi)
+  800e5c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e60:	40 f6 c7 04          	test   $0x4,%dil
+  800e64:	74 a9                	je     800e0f <memset+0x2c>
+  800e66:	89 07                	mov    %eax,(%rdi)
+  800e68:	48 83 c7 04          	add    $0x4,%rdi
+  800e6c:	eb a1                	jmp    800e0f <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e6e:	41 f6 c1 04          	test   $0x4,%r9b
+  800e72:	74 06                	je     800e7a <memset+0x97>
+  800e74:	89 07                	mov    %eax,(%rdi)
+  800e76:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e7a:	41 f6 c1 02          	test   $0x2,%r9b
+  800e7e:	74 07                	je     800e87 <memset+0xa4>
+  800e80:	66 89 07             	mov    %ax,(%rdi)
+  800e83:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e87:	41 f6 c1 01          	test   $0x1,%r9b
+  800e8b:	74 9c                	je     800e29 <memset+0x46>
+  800e8d:	88 07                	mov    %al,(%rdi)
+  800e8f:	eb 98                	jmp    800e29 <memset+0x46>
+
+0000000000800e91 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e91:	48 89 f8             	mov    %rdi,%rax
+  800e94:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e97:	48 39 fe             	cmp    %rdi,%rsi
+  800e9a:	73 3b                	jae    800ed7 <memmove+0x46>
+  800e9c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ea0:	48 39 d7             	cmp    %rdx,%rdi
+  800ea3:	73 32                	jae    800ed7 <memmove+0x46>
+        s += n;
+        d += n;
+  800ea5:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ea9:	48 89 d6             	mov    %rdx,%rsi
+  800eac:	48 09 fe             	or     %rdi,%rsi
+  800eaf:	48 09 ce             	or     %rcx,%rsi
+  800eb2:	40 f6 c6 07          	test   $0x7,%sil
+  800eb6:	75 12                	jne    800eca <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800eb8:	48 83 ef 08          	sub    $0x8,%rdi
+  800ebc:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800ec0:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ec4:	fd                   	std
+  800ec5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800ec8:	fc                   	cld
+  800ec9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800eca:	48 83 ef 01          	sub    $0x1,%rdi
+  800ece:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ed2:	fd                   	std
+  800ed3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800ed5:	eb f1                	jmp    800ec8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ed7:	48 89 f2             	mov    %rsi,%rdx
+  800eda:	48 09 c2             	or     %rax,%rdx
+  800edd:	48 09 ca             	or     %rcx,%rdx
+  800ee0:	f6 c2 07             	test   $0x7,%dl
+  800ee3:	75 0c                	jne    800ef1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ee5:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ee9:	48 89 c7             	mov    %rax,%rdi
+  800eec:	fc                   	cld
+  800eed:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ef0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ef1:	48 89 c7             	mov    %rax,%rdi
+  800ef4:	fc                   	cld
+  800ef5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800ef7:	c3                   	ret
+
+0000000000800ef8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800ef8:	55                   	push   %rbp
+  800ef9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800efc:	48 b8 91 0e 80 00 00 	movabs $0x800e91,%rax
+  800f03:	00 00 00 
+  800f06:	ff d0                	call   *%rax
+}
+  800f08:	5d                   	pop    %rbp
+  800f09:	c3                   	ret
+
+0000000000800f0a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f0a:	55                   	push   %rbp
+  800f0b:	48 89 e5             	mov    %rsp,%rbp
+  800f0e:	41 57                	push   %r15
+  800f10:	41 56                	push   %r14
+  800f12:	41 55                	push   %r13
+  800f14:	41 54                	push   %r12
+  800f16:	53                   	push   %rbx
+  800f17:	48 83 ec 08          	sub    $0x8,%rsp
+  800f1b:	49 89 fe             	mov    %rdi,%r14
+  800f1e:	49 89 f7             	mov    %rsi,%r15
+  800f21:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f24:	48 89 f7             	mov    %rsi,%rdi
+  800f27:	48 b8 59 0c 80 00 00 	movabs $0x800c59,%rax
+  800f2e:	00 00 00 
+  800f31:	ff d0                	call   *%rax
+  800f33:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f36:	48 89 de             	mov    %rbx,%rsi
+  800f39:	4c 89 f7             	mov    %r14,%rdi
+  800f3c:	48 b8 74 0c 80 00 00 	movabs $0x800c74,%rax
+  800f43:	00 00 00 
+  800f46:	ff d0                	call   *%rax
+  800f48:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f4b:	48 39 c3             	cmp    %rax,%rbx
+  800f4e:	74 36                	je     800f86 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f50:	48 89 d8             	mov    %rbx,%rax
+  800f53:	4c 29 e8             	sub    %r13,%rax
+  800f56:	49 39 c4             	cmp    %rax,%r12
+  800f59:	73 31                	jae    800f8c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f5b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f60:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f64:	4c 89 fe             	mov    %r15,%rsi
+  800f67:	48 b8 f8 0e 80 00 00 	movabs $0x800ef8,%rax
+  800f6e:	00 00 00 
+  800f71:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f73:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f77:	48 83 c4 08          	add    $0x8,%rsp
+  800f7b:	5b                   	pop    %rbx
+  800f7c:	41 5c                	pop    %r12
+  800f7e:	41 5d                	pop    %r13
+  800f80:	41 5e                	pop    %r14
+  800f82:	41 5f                	pop    %r15
+  800f84:	5d                   	pop    %rbp
+  800f85:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f86:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f8a:	eb eb                	jmp    800f77 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f8c:	48 83 eb 01          	sub    $0x1,%rbx
+  800f90:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f94:	48 89 da             	mov    %rbx,%rdx
+  800f97:	4c 89 fe             	mov    %r15,%rsi
+  800f9a:	48 b8 f8 0e 80 00 00 	movabs $0x800ef8,%rax
+  800fa1:	00 00 00 
+  800fa4:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fa6:	49 01 de             	add    %rbx,%r14
+  800fa9:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fae:	eb c3                	jmp    800f73 <strlcat+0x69>
+
+0000000000800fb0 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fb0:	48 85 d2             	test   %rdx,%rdx
+  800fb3:	74 2d                	je     800fe2 <memcmp+0x32>
+  800fb5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800fba:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800fbe:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800fc3:	44 38 c1             	cmp    %r8b,%cl
+  800fc6:	75 0f                	jne    800fd7 <memcmp+0x27>
+    while (n-- > 0) {
+  800fc8:	48 83 c0 01          	add    $0x1,%rax
+  800fcc:	48 39 c2             	cmp    %rax,%rdx
+  800fcf:	75 e9                	jne    800fba <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd6:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800fd7:	0f b6 c1             	movzbl %cl,%eax
+  800fda:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800fde:	44 29 c0             	sub    %r8d,%eax
+  800fe1:	c3                   	ret
+    return 0;
+  800fe2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fe7:	c3                   	ret
+
+0000000000800fe8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fe8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800fec:	48 39 c7             	cmp    %rax,%rdi
+  800fef:	73 0f                	jae    801000 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800ff1:	40 38 37             	cmp    %sil,(%rdi)
+  800ff4:	74 0e                	je     801004 <memfind+0x1c>
+    for (; src < end; src++) {
+  800ff6:	48 83 c7 01          	add    $0x1,%rdi
+  800ffa:	48 39 f8             	cmp    %rdi,%rax
+  800ffd:	75 f2                	jne    800ff1 <memfind+0x9>
+  800fff:	c3                   	ret
+  801000:	48 89 f8             	mov    %rdi,%rax
+  801003:	c3                   	ret
+  801004:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801007:	c3                   	ret
+
+0000000000801008 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801008:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80100b:	0f b6 37             	movzbl (%rdi),%esi
+  80100e:	40 80 fe 20          	cmp    $0x20,%sil
+  801012:	74 06                	je     80101a <strtol+0x12>
+  801014:	40 80 fe 09          	cmp    $0x9,%sil
+  801018:	75 13                	jne    80102d <strtol+0x25>
+  80101a:	48 83 c7 01          	add    $0x1,%rdi
+  80101e:	0f b6 37             	movzbl (%rdi),%esi
+  801021:	40 80 fe 20          	cmp    $0x20,%sil
+  801025:	74 f3                	je     80101a <strtol+0x12>
+  801027:	40 80 fe 09          	cmp    $0x9,%sil
+  80102b:	74 ed                	je     80101a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80102d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801030:	83 e0 fd             	and    $0xfffffffd,%eax
+  801033:	3c 01                	cmp    $0x1,%al
+  801035:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801039:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80103f:	75 0f                	jne    801050 <strtol+0x48>
+  801041:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801044:	74 14                	je     80105a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801046:	85 d2                	test   %edx,%edx
+  801048:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80104d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801050:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801055:	4c 63 ca             	movslq %edx,%r9
+  801058:	eb 36                	jmp    801090 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80105a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80105e:	74 0f                	je     80106f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801060:	85 d2                	test   %edx,%edx
+  801062:	75 ec                	jne    801050 <strtol+0x48>
+        s++;
+  801064:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801068:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80106d:	eb e1                	jmp    801050 <strtol+0x48>
+        s += 2;
+  80106f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801073:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801078:	eb d6                	jmp    801050 <strtol+0x48>
+            dig -= '0';
+  80107a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80107d:	44 0f b6 c1          	movzbl %cl,%r8d
+  801081:	41 39 d0             	cmp    %edx,%r8d
+  801084:	7d 21                	jge    8010a7 <strtol+0x9f>
+        val = val * base + dig;
+  801086:	49 0f af c1          	imul   %r9,%rax
+  80108a:	0f b6 c9             	movzbl %cl,%ecx
+  80108d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801090:	48 83 c7 01          	add    $0x1,%rdi
+  801094:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801098:	80 f9 39             	cmp    $0x39,%cl
+  80109b:	76 dd                	jbe    80107a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80109d:	80 f9 7b             	cmp    $0x7b,%cl
+  8010a0:	77 05                	ja     8010a7 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010a2:	83 e9 57             	sub    $0x57,%ecx
+  8010a5:	eb d6                	jmp    80107d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010a7:	4d 85 d2             	test   %r10,%r10
+  8010aa:	74 03                	je     8010af <strtol+0xa7>
+  8010ac:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010af:	48 89 c2             	mov    %rax,%rdx
+  8010b2:	48 f7 da             	neg    %rdx
+  8010b5:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010b9:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010bd:	c3                   	ret
+
+00000000008010be <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010be:	55                   	push   %rbp
+  8010bf:	48 89 e5             	mov    %rsp,%rbp
+  8010c2:	53                   	push   %rbx
+  8010c3:	48 89 fa             	mov    %rdi,%rdx
+  8010c6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010c9:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8010dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010e3:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010e9:	c9                   	leave
+  8010ea:	c3                   	ret
+
+00000000008010eb <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010eb:	55                   	push   %rbp
+  8010ec:	48 89 e5             	mov    %rsp,%rbp
+  8010ef:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f0:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801104:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801109:	be 00 00 00 00       	mov    $0x0,%esi
+  80110e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801114:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801116:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80111a:	c9                   	leave
+  80111b:	c3                   	ret
+
+000000000080111c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80111c:	55                   	push   %rbp
+  80111d:	48 89 e5             	mov    %rsp,%rbp
+  801120:	53                   	push   %rbx
+  801121:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801125:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801128:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80112d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801132:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801137:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80113c:	be 00 00 00 00       	mov    $0x0,%esi
+  801141:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801147:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801149:	48 85 c0             	test   %rax,%rax
+  80114c:	7f 06                	jg     801154 <sys_env_destroy+0x38>
+}
+  80114e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801152:	c9                   	leave
+  801153:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801154:	49 89 c0             	mov    %rax,%r8
+  801157:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80115c:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  801163:	00 00 00 
+  801166:	be 26 00 00 00       	mov    $0x26,%esi
+  80116b:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  801172:	00 00 00 
+  801175:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117a:	49 b9 22 02 80 00 00 	movabs $0x800222,%r9
+  801181:	00 00 00 
+  801184:	41 ff d1             	call   *%r9
+
+0000000000801187 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801187:	55                   	push   %rbp
+  801188:	48 89 e5             	mov    %rsp,%rbp
+  80118b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80118c:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801191:	ba 00 00 00 00       	mov    $0x0,%edx
+  801196:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80119b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011b0:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b6:	c9                   	leave
+  8011b7:	c3                   	ret
+
+00000000008011b8 <sys_yield>:
+
+void
+sys_yield(void) {
+  8011b8:	55                   	push   %rbp
+  8011b9:	48 89 e5             	mov    %rsp,%rbp
+  8011bc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011bd:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011e1:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e7:	c9                   	leave
+  8011e8:	c3                   	ret
+
+00000000008011e9 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011e9:	55                   	push   %rbp
+  8011ea:	48 89 e5             	mov    %rsp,%rbp
+  8011ed:	53                   	push   %rbx
+  8011ee:	48 89 fa             	mov    %rdi,%rdx
+  8011f1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011f9:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801200:	00 00 00 
+  801203:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801208:	be 00 00 00 00       	mov    $0x0,%esi
+  80120d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801213:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801215:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801219:	c9                   	leave
+  80121a:	c3                   	ret
+
+000000000080121b <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80121b:	55                   	push   %rbp
+  80121c:	48 89 e5             	mov    %rsp,%rbp
+  80121f:	53                   	push   %rbx
+  801220:	49 89 f8             	mov    %rdi,%r8
+  801223:	48 89 d3             	mov    %rdx,%rbx
+  801226:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801229:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80122e:	4c 89 c2             	mov    %r8,%rdx
+  801231:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801234:	be 00 00 00 00       	mov    $0x0,%esi
+  801239:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80123f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801241:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801245:	c9                   	leave
+  801246:	c3                   	ret
+
+0000000000801247 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801247:	55                   	push   %rbp
+  801248:	48 89 e5             	mov    %rsp,%rbp
+  80124b:	53                   	push   %rbx
+  80124c:	48 83 ec 08          	sub    $0x8,%rsp
+  801250:	89 f8                	mov    %edi,%eax
+  801252:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801255:	48 63 f9             	movslq %ecx,%rdi
+  801258:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80125b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801260:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801263:	be 00 00 00 00       	mov    $0x0,%esi
+  801268:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80126e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801270:	48 85 c0             	test   %rax,%rax
+  801273:	7f 06                	jg     80127b <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801275:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801279:	c9                   	leave
+  80127a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80127b:	49 89 c0             	mov    %rax,%r8
+  80127e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801283:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  80128a:	00 00 00 
+  80128d:	be 26 00 00 00       	mov    $0x26,%esi
+  801292:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  801299:	00 00 00 
+  80129c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a1:	49 b9 22 02 80 00 00 	movabs $0x800222,%r9
+  8012a8:	00 00 00 
+  8012ab:	41 ff d1             	call   *%r9
+
+00000000008012ae <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012ae:	55                   	push   %rbp
+  8012af:	48 89 e5             	mov    %rsp,%rbp
+  8012b2:	53                   	push   %rbx
+  8012b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8012b7:	89 f8                	mov    %edi,%eax
+  8012b9:	49 89 f2             	mov    %rsi,%r10
+  8012bc:	48 89 cf             	mov    %rcx,%rdi
+  8012bf:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012c2:	48 63 da             	movslq %edx,%rbx
+  8012c5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012cd:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d0:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012d3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012d5:	48 85 c0             	test   %rax,%rax
+  8012d8:	7f 06                	jg     8012e0 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012de:	c9                   	leave
+  8012df:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012e0:	49 89 c0             	mov    %rax,%r8
+  8012e3:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012e8:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  8012ef:	00 00 00 
+  8012f2:	be 26 00 00 00       	mov    $0x26,%esi
+  8012f7:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  8012fe:	00 00 00 
+  801301:	b8 00 00 00 00       	mov    $0x0,%eax
+  801306:	49 b9 22 02 80 00 00 	movabs $0x800222,%r9
+  80130d:	00 00 00 
+  801310:	41 ff d1             	call   *%r9
+
+0000000000801313 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801313:	55                   	push   %rbp
+  801314:	48 89 e5             	mov    %rsp,%rbp
+  801317:	53                   	push   %rbx
+  801318:	48 83 ec 08          	sub    $0x8,%rsp
+  80131c:	48 89 f1             	mov    %rsi,%rcx
+  80131f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801322:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801325:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80132a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80132f:	be 00 00 00 00       	mov    $0x0,%esi
+  801334:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80133a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80133c:	48 85 c0             	test   %rax,%rax
+  80133f:	7f 06                	jg     801347 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801341:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801345:	c9                   	leave
+  801346:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801347:	49 89 c0             	mov    %rax,%r8
+  80134a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80134f:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  801356:	00 00 00 
+  801359:	be 26 00 00 00       	mov    $0x26,%esi
+  80135e:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  801365:	00 00 00 
+  801368:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136d:	49 b9 22 02 80 00 00 	movabs $0x800222,%r9
+  801374:	00 00 00 
+  801377:	41 ff d1             	call   *%r9
+
+000000000080137a <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  80137a:	55                   	push   %rbp
+  80137b:	48 89 e5             	mov    %rsp,%rbp
+  80137e:	53                   	push   %rbx
+  80137f:	48 83 ec 08          	sub    $0x8,%rsp
+  801383:	89 f8                	mov    %edi,%eax
+  801385:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801388:	48 63 f9             	movslq %ecx,%rdi
+  80138b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80138e:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801393:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801396:	be 00 00 00 00       	mov    $0x0,%esi
+  80139b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013a3:	48 85 c0             	test   %rax,%rax
+  8013a6:	7f 06                	jg     8013ae <sys_region_advise+0x34>
+}
+  8013a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ac:	c9                   	leave
+  8013ad:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ae:	49 89 c0             	mov    %rax,%r8
+  8013b1:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8013b6:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  8013bd:	00 00 00 
+  8013c0:	be 26 00 00 00       	mov    $0x26,%esi
+  8013c5:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  8013cc:	00 00 00 
+  8013cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d4:	49 b9 22 02 80 00 00 	movabs $0x800222,%r9
+  8013db:	00 00 00 
+  8013de:	41 ff d1             	call   *%r9
+
+00000000008013e1 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  8013e1:	55                   	push   %rbp
+  8013e2:	48 89 e5             	mov    %rsp,%rbp
+  8013e5:	53                   	push   %rbx
+  8013e6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  8013ea:	48 63 ce             	movslq %esi,%rcx
+  8013ed:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f0:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801404:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80140a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80140c:	48 85 c0             	test   %rax,%rax
+  80140f:	7f 06                	jg     801417 <sys_env_set_nice+0x36>
+}
+  801411:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801415:	c9                   	leave
+  801416:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801417:	49 89 c0             	mov    %rax,%r8
+  80141a:	b9 15 00 00 00       	mov    $0x15,%ecx
+  80141f:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  801426:	00 00 00 
+  801429:	be 26 00 00 00       	mov    $0x26,%esi
+  80142e:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  801435:	00 00 00 
+  801438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143d:	49 b9 22 02 80 00 00 	movabs $0x800222,%r9
+  801444:	00 00 00 
+  801447:	41 ff d1             	call   *%r9
+
+000000000080144a <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80144a:	55                   	push   %rbp
+  80144b:	48 89 e5             	mov    %rsp,%rbp
+  80144e:	53                   	push   %rbx
+  80144f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801453:	48 63 ce             	movslq %esi,%rcx
+  801456:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801459:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80145e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801463:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801468:	be 00 00 00 00       	mov    $0x0,%esi
+  80146d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801473:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801475:	48 85 c0             	test   %rax,%rax
+  801478:	7f 06                	jg     801480 <sys_env_set_status+0x36>
+}
+  80147a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147e:	c9                   	leave
+  80147f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801480:	49 89 c0             	mov    %rax,%r8
+  801483:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801488:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  80148f:	00 00 00 
+  801492:	be 26 00 00 00       	mov    $0x26,%esi
+  801497:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  80149e:	00 00 00 
+  8014a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a6:	49 b9 22 02 80 00 00 	movabs $0x800222,%r9
+  8014ad:	00 00 00 
+  8014b0:	41 ff d1             	call   *%r9
+
+00000000008014b3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8014b3:	55                   	push   %rbp
+  8014b4:	48 89 e5             	mov    %rsp,%rbp
+  8014b7:	53                   	push   %rbx
+  8014b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8014bc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8014bf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c2:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014de:	48 85 c0             	test   %rax,%rax
+  8014e1:	7f 06                	jg     8014e9 <sys_env_set_trapframe+0x36>
+}
+  8014e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e7:	c9                   	leave
+  8014e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e9:	49 89 c0             	mov    %rax,%r8
+  8014ec:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8014f1:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  8014f8:	00 00 00 
+  8014fb:	be 26 00 00 00       	mov    $0x26,%esi
+  801500:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  801507:	00 00 00 
+  80150a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150f:	49 b9 22 02 80 00 00 	movabs $0x800222,%r9
+  801516:	00 00 00 
+  801519:	41 ff d1             	call   *%r9
+
+000000000080151c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80151c:	55                   	push   %rbp
+  80151d:	48 89 e5             	mov    %rsp,%rbp
+  801520:	53                   	push   %rbx
+  801521:	48 83 ec 08          	sub    $0x8,%rsp
+  801525:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801528:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80152b:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801530:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801535:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80153a:	be 00 00 00 00       	mov    $0x0,%esi
+  80153f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801545:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801547:	48 85 c0             	test   %rax,%rax
+  80154a:	7f 06                	jg     801552 <sys_env_set_pgfault_upcall+0x36>
+}
+  80154c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801550:	c9                   	leave
+  801551:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801552:	49 89 c0             	mov    %rax,%r8
+  801555:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80155a:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  801561:	00 00 00 
+  801564:	be 26 00 00 00       	mov    $0x26,%esi
+  801569:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  801570:	00 00 00 
+  801573:	b8 00 00 00 00       	mov    $0x0,%eax
+  801578:	49 b9 22 02 80 00 00 	movabs $0x800222,%r9
+  80157f:	00 00 00 
+  801582:	41 ff d1             	call   *%r9
+
+0000000000801585 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801585:	55                   	push   %rbp
+  801586:	48 89 e5             	mov    %rsp,%rbp
+  801589:	53                   	push   %rbx
+  80158a:	89 f8                	mov    %edi,%eax
+  80158c:	49 89 f1             	mov    %rsi,%r9
+  80158f:	48 89 d3             	mov    %rdx,%rbx
+  801592:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801595:	49 63 f0             	movslq %r8d,%rsi
+  801598:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80159b:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015a0:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a9:	cd 30                	int    $0x30
+}
+  8015ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015af:	c9                   	leave
+  8015b0:	c3                   	ret
+
+00000000008015b1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8015b1:	55                   	push   %rbp
+  8015b2:	48 89 e5             	mov    %rsp,%rbp
+  8015b5:	53                   	push   %rbx
+  8015b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ba:	48 89 fa             	mov    %rdi,%rdx
+  8015bd:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c0:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015da:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015dc:	48 85 c0             	test   %rax,%rax
+  8015df:	7f 06                	jg     8015e7 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e5:	c9                   	leave
+  8015e6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015e7:	49 89 c0             	mov    %rax,%r8
+  8015ea:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015ef:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  8015f6:	00 00 00 
+  8015f9:	be 26 00 00 00       	mov    $0x26,%esi
+  8015fe:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  801605:	00 00 00 
+  801608:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160d:	49 b9 22 02 80 00 00 	movabs $0x800222,%r9
+  801614:	00 00 00 
+  801617:	41 ff d1             	call   *%r9
+
+000000000080161a <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80161a:	55                   	push   %rbp
+  80161b:	48 89 e5             	mov    %rsp,%rbp
+  80161e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80161f:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801624:	ba 00 00 00 00       	mov    $0x0,%edx
+  801629:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80162e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801633:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801638:	be 00 00 00 00       	mov    $0x0,%esi
+  80163d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801643:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801645:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801649:	c9                   	leave
+  80164a:	c3                   	ret
+
+000000000080164b <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80164b:	55                   	push   %rbp
+  80164c:	48 89 e5             	mov    %rsp,%rbp
+  80164f:	53                   	push   %rbx
+  801650:	48 83 ec 08          	sub    $0x8,%rsp
+  801654:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801657:	48 63 ce             	movslq %esi,%rcx
+  80165a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80165d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801662:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801667:	be 00 00 00 00       	mov    $0x0,%esi
+  80166c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801672:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801674:	48 85 c0             	test   %rax,%rax
+  801677:	7f 06                	jg     80167f <sys_sigqueue+0x34>
+}
+  801679:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167d:	c9                   	leave
+  80167e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80167f:	49 89 c0             	mov    %rax,%r8
+  801682:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801687:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  80168e:	00 00 00 
+  801691:	be 26 00 00 00       	mov    $0x26,%esi
+  801696:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  80169d:	00 00 00 
+  8016a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a5:	49 b9 22 02 80 00 00 	movabs $0x800222,%r9
+  8016ac:	00 00 00 
+  8016af:	41 ff d1             	call   *%r9
+
+00000000008016b2 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8016b2:	55                   	push   %rbp
+  8016b3:	48 89 e5             	mov    %rsp,%rbp
+  8016b6:	53                   	push   %rbx
+  8016b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8016bb:	48 89 fa             	mov    %rdi,%rdx
+  8016be:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c1:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016cb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016db:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016dd:	48 85 c0             	test   %rax,%rax
+  8016e0:	7f 06                	jg     8016e8 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  8016e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e6:	c9                   	leave
+  8016e7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016e8:	49 89 c0             	mov    %rax,%r8
+  8016eb:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8016f0:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  8016f7:	00 00 00 
+  8016fa:	be 26 00 00 00       	mov    $0x26,%esi
+  8016ff:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  801706:	00 00 00 
+  801709:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170e:	49 b9 22 02 80 00 00 	movabs $0x800222,%r9
+  801715:	00 00 00 
+  801718:	41 ff d1             	call   *%r9
+
+000000000080171b <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80171b:	55                   	push   %rbp
+  80171c:	48 89 e5             	mov    %rsp,%rbp
+  80171f:	53                   	push   %rbx
+  801720:	48 83 ec 08          	sub    $0x8,%rsp
+  801724:	48 89 f1             	mov    %rsi,%rcx
+  801727:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  80172a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80172d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801732:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801737:	be 00 00 00 00       	mov    $0x0,%esi
+  80173c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801742:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801744:	48 85 c0             	test   %rax,%rax
+  801747:	7f 06                	jg     80174f <sys_sigaction+0x34>
+}
+  801749:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80174d:	c9                   	leave
+  80174e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80174f:	49 89 c0             	mov    %rax,%r8
+  801752:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801757:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  80175e:	00 00 00 
+  801761:	be 26 00 00 00       	mov    $0x26,%esi
+  801766:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  80176d:	00 00 00 
+  801770:	b8 00 00 00 00       	mov    $0x0,%eax
+  801775:	49 b9 22 02 80 00 00 	movabs $0x800222,%r9
+  80177c:	00 00 00 
+  80177f:	41 ff d1             	call   *%r9
+
+0000000000801782 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801782:	55                   	push   %rbp
+  801783:	48 89 e5             	mov    %rsp,%rbp
+  801786:	53                   	push   %rbx
+  801787:	48 83 ec 08          	sub    $0x8,%rsp
+  80178b:	48 89 f1             	mov    %rsi,%rcx
+  80178e:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801791:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801794:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801799:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80179e:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017ab:	48 85 c0             	test   %rax,%rax
+  8017ae:	7f 06                	jg     8017b6 <sys_sigprocmask+0x34>
+}
+  8017b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b4:	c9                   	leave
+  8017b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017b6:	49 89 c0             	mov    %rax,%r8
+  8017b9:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8017be:	48 ba 70 32 80 00 00 	movabs $0x803270,%rdx
+  8017c5:	00 00 00 
+  8017c8:	be 26 00 00 00       	mov    $0x26,%esi
+  8017cd:	48 bf 8f 32 80 00 00 	movabs $0x80328f,%rdi
+  8017d4:	00 00 00 
+  8017d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017dc:	49 b9 22 02 80 00 00 	movabs $0x800222,%r9
+  8017e3:	00 00 00 
+  8017e6:	41 ff d1             	call   *%r9
+
+00000000008017e9 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017e9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017f0:	ff ff ff 
+  8017f3:	48 01 f8             	add    %rdi,%rax
+  8017f6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8017fa:	c3                   	ret
+
+00000000008017fb <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017fb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801802:	ff ff ff 
+  801805:	48 01 f8             	add    %rdi,%rax
+  801808:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80180c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801812:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801816:	c3                   	ret
+
+0000000000801817 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801817:	55                   	push   %rbp
+  801818:	48 89 e5             	mov    %rsp,%rbp
+  80181b:	41 57                	push   %r15
+  80181d:	41 56                	push   %r14
+  80181f:	41 55                	push   %r13
+  801821:	41 54                	push   %r12
+  801823:	53                   	push   %rbx
+  801824:	48 83 ec 08          	sub    $0x8,%rsp
+  801828:	49 89 ff             	mov    %rdi,%r15
+  80182b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801830:	49 bd 95 27 80 00 00 	movabs $0x802795,%r13
+  801837:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80183a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801840:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801843:	48 89 df             	mov    %rbx,%rdi
+  801846:	41 ff d5             	call   *%r13
+  801849:	83 e0 04             	and    $0x4,%eax
+  80184c:	74 17                	je     801865 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80184e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801855:	4c 39 f3             	cmp    %r14,%rbx
+  801858:	75 e6                	jne    801840 <fd_alloc+0x29>
+  80185a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801860:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801865:	4d 89 27             	mov    %r12,(%r15)
+}
+  801868:	48 83 c4 08          	add    $0x8,%rsp
+  80186c:	5b                   	pop    %rbx
+  80186d:	41 5c                	pop    %r12
+  80186f:	41 5d                	pop    %r13
+  801871:	41 5e                	pop    %r14
+  801873:	41 5f                	pop    %r15
+  801875:	5d                   	pop    %rbp
+  801876:	c3                   	ret
+
+0000000000801877 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801877:	83 ff 1f             	cmp    $0x1f,%edi
+  80187a:	77 39                	ja     8018b5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80187c:	55                   	push   %rbp
+  80187d:	48 89 e5             	mov    %rsp,%rbp
+  801880:	41 54                	push   %r12
+  801882:	53                   	push   %rbx
+  801883:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801886:	48 63 df             	movslq %edi,%rbx
+  801889:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801890:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801894:	48 89 df             	mov    %rbx,%rdi
+  801897:	48 b8 95 27 80 00 00 	movabs $0x802795,%rax
+  80189e:	00 00 00 
+  8018a1:	ff d0                	call   *%rax
+  8018a3:	a8 04                	test   $0x4,%al
+  8018a5:	74 14                	je     8018bb <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8018a7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8018ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018b0:	5b                   	pop    %rbx
+  8018b1:	41 5c                	pop    %r12
+  8018b3:	5d                   	pop    %rbp
+  8018b4:	c3                   	ret
+        return -E_INVAL;
+  8018b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018ba:	c3                   	ret
+        return -E_INVAL;
+  8018bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018c0:	eb ee                	jmp    8018b0 <fd_lookup+0x39>
+
+00000000008018c2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8018c2:	55                   	push   %rbp
+  8018c3:	48 89 e5             	mov    %rsp,%rbp
+  8018c6:	41 54                	push   %r12
+  8018c8:	53                   	push   %rbx
+  8018c9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8018cc:	48 b8 20 33 80 00 00 	movabs $0x803320,%rax
+  8018d3:	00 00 00 
+  8018d6:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8018dd:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8018e0:	39 3b                	cmp    %edi,(%rbx)
+  8018e2:	74 47                	je     80192b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8018e4:	48 83 c0 08          	add    $0x8,%rax
+  8018e8:	48 8b 18             	mov    (%rax),%rbx
+  8018eb:	48 85 db             	test   %rbx,%rbx
+  8018ee:	75 f0                	jne    8018e0 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018f0:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  8018f7:	00 00 00 
+  8018fa:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801900:	89 fa                	mov    %edi,%edx
+  801902:	48 bf a0 32 80 00 00 	movabs $0x8032a0,%rdi
+  801909:	00 00 00 
+  80190c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801911:	48 b9 72 03 80 00 00 	movabs $0x800372,%rcx
+  801918:	00 00 00 
+  80191b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80191d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801922:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801926:	5b                   	pop    %rbx
+  801927:	41 5c                	pop    %r12
+  801929:	5d                   	pop    %rbp
+  80192a:	c3                   	ret
+            return 0;
+  80192b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801930:	eb f0                	jmp    801922 <dev_lookup+0x60>
+
+0000000000801932 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801932:	55                   	push   %rbp
+  801933:	48 89 e5             	mov    %rsp,%rbp
+  801936:	41 55                	push   %r13
+  801938:	41 54                	push   %r12
+  80193a:	53                   	push   %rbx
+  80193b:	48 83 ec 18          	sub    $0x18,%rsp
+  80193f:	48 89 fb             	mov    %rdi,%rbx
+  801942:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801945:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80194c:	ff ff ff 
+  80194f:	48 01 df             	add    %rbx,%rdi
+  801952:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801956:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80195a:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  801961:	00 00 00 
+  801964:	ff d0                	call   *%rax
+  801966:	41 89 c5             	mov    %eax,%r13d
+  801969:	85 c0                	test   %eax,%eax
+  80196b:	78 06                	js     801973 <fd_close+0x41>
+  80196d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801971:	74 1a                	je     80198d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801973:	45 84 e4             	test   %r12b,%r12b
+  801976:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80197f:	44 89 e8             	mov    %r13d,%eax
+  801982:	48 83 c4 18          	add    $0x18,%rsp
+  801986:	5b                   	pop    %rbx
+  801987:	41 5c                	pop    %r12
+  801989:	41 5d                	pop    %r13
+  80198b:	5d                   	pop    %rbp
+  80198c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80198d:	8b 3b                	mov    (%rbx),%edi
+  80198f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801993:	48 b8 c2 18 80 00 00 	movabs $0x8018c2,%rax
+  80199a:	00 00 00 
+  80199d:	ff d0                	call   *%rax
+  80199f:	41 89 c5             	mov    %eax,%r13d
+  8019a2:	85 c0                	test   %eax,%eax
+  8019a4:	78 1b                	js     8019c1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8019a6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019aa:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8019ae:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019b4:	48 85 c0             	test   %rax,%rax
+  8019b7:	74 08                	je     8019c1 <fd_close+0x8f>
+  8019b9:	48 89 df             	mov    %rbx,%rdi
+  8019bc:	ff d0                	call   *%rax
+  8019be:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8019c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019c6:	48 89 de             	mov    %rbx,%rsi
+  8019c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019ce:	48 b8 13 13 80 00 00 	movabs $0x801313,%rax
+  8019d5:	00 00 00 
+  8019d8:	ff d0                	call   *%rax
+    return res;
+  8019da:	eb a3                	jmp    80197f <fd_close+0x4d>
+
+00000000008019dc <close>:
+
+int
+close(int fdnum) {
+  8019dc:	55                   	push   %rbp
+  8019dd:	48 89 e5             	mov    %rsp,%rbp
+  8019e0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8019e4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8019e8:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  8019ef:	00 00 00 
+  8019f2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8019f4:	85 c0                	test   %eax,%eax
+  8019f6:	78 15                	js     801a0d <close+0x31>
+
+    return fd_close(fd, 1);
+  8019f8:	be 01 00 00 00       	mov    $0x1,%esi
+  8019fd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a01:	48 b8 32 19 80 00 00 	movabs $0x801932,%rax
+  801a08:	00 00 00 
+  801a0b:	ff d0                	call   *%rax
+}
+  801a0d:	c9                   	leave
+  801a0e:	c3                   	ret
+
+0000000000801a0f <close_all>:
+
+void
+close_all(void) {
+  801a0f:	55                   	push   %rbp
+  801a10:	48 89 e5             	mov    %rsp,%rbp
+  801a13:	41 54                	push   %r12
+  801a15:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a1b:	49 bc dc 19 80 00 00 	movabs $0x8019dc,%r12
+  801a22:	00 00 00 
+  801a25:	89 df                	mov    %ebx,%edi
+  801a27:	41 ff d4             	call   *%r12
+  801a2a:	83 c3 01             	add    $0x1,%ebx
+  801a2d:	83 fb 20             	cmp    $0x20,%ebx
+  801a30:	75 f3                	jne    801a25 <close_all+0x16>
+}
+  801a32:	5b                   	pop    %rbx
+  801a33:	41 5c                	pop    %r12
+  801a35:	5d                   	pop    %rbp
+  801a36:	c3                   	ret
+
+0000000000801a37 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a37:	55                   	push   %rbp
+  801a38:	48 89 e5             	mov    %rsp,%rbp
+  801a3b:	41 57                	push   %r15
+  801a3d:	41 56                	push   %r14
+  801a3f:	41 55                	push   %r13
+  801a41:	41 54                	push   %r12
+  801a43:	53                   	push   %rbx
+  801a44:	48 83 ec 18          	sub    $0x18,%rsp
+  801a48:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a4b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a4f:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  801a56:	00 00 00 
+  801a59:	ff d0                	call   *%rax
+  801a5b:	89 c3                	mov    %eax,%ebx
+  801a5d:	85 c0                	test   %eax,%eax
+  801a5f:	0f 88 b8 00 00 00    	js     801b1d <dup+0xe6>
+    close(newfdnum);
+  801a65:	44 89 e7             	mov    %r12d,%edi
+  801a68:	48 b8 dc 19 80 00 00 	movabs $0x8019dc,%rax
+  801a6f:	00 00 00 
+  801a72:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801a74:	4d 63 ec             	movslq %r12d,%r13
+  801a77:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801a7e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801a82:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801a86:	4c 89 ff             	mov    %r15,%rdi
+  801a89:	49 be fb 17 80 00 00 	movabs $0x8017fb,%r14
+  801a90:	00 00 00 
+  801a93:	41 ff d6             	call   *%r14
+  801a96:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801a99:	4c 89 ef             	mov    %r13,%rdi
+  801a9c:	41 ff d6             	call   *%r14
+  801a9f:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801aa2:	48 89 df             	mov    %rbx,%rdi
+  801aa5:	48 b8 95 27 80 00 00 	movabs $0x802795,%rax
+  801aac:	00 00 00 
+  801aaf:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801ab1:	a8 04                	test   $0x4,%al
+  801ab3:	74 2b                	je     801ae0 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ab5:	41 89 c1             	mov    %eax,%r9d
+  801ab8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801abe:	4c 89 f1             	mov    %r14,%rcx
+  801ac1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac6:	48 89 de             	mov    %rbx,%rsi
+  801ac9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ace:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  801ad5:	00 00 00 
+  801ad8:	ff d0                	call   *%rax
+  801ada:	89 c3                	mov    %eax,%ebx
+  801adc:	85 c0                	test   %eax,%eax
+  801ade:	78 4e                	js     801b2e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801ae0:	4c 89 ff             	mov    %r15,%rdi
+  801ae3:	48 b8 95 27 80 00 00 	movabs $0x802795,%rax
+  801aea:	00 00 00 
+  801aed:	ff d0                	call   *%rax
+  801aef:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801af2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801af8:	4c 89 e9             	mov    %r13,%rcx
+  801afb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b00:	4c 89 fe             	mov    %r15,%rsi
+  801b03:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b08:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  801b0f:	00 00 00 
+  801b12:	ff d0                	call   *%rax
+  801b14:	89 c3                	mov    %eax,%ebx
+  801b16:	85 c0                	test   %eax,%eax
+  801b18:	78 14                	js     801b2e <dup+0xf7>
+
+    return newfdnum;
+  801b1a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801b1d:	89 d8                	mov    %ebx,%eax
+  801b1f:	48 83 c4 18          	add    $0x18,%rsp
+  801b23:	5b                   	pop    %rbx
+  801b24:	41 5c                	pop    %r12
+  801b26:	41 5d                	pop    %r13
+  801b28:	41 5e                	pop    %r14
+  801b2a:	41 5f                	pop    %r15
+  801b2c:	5d                   	pop    %rbp
+  801b2d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b2e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b33:	4c 89 ee             	mov    %r13,%rsi
+  801b36:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b3b:	49 bc 13 13 80 00 00 	movabs $0x801313,%r12
+  801b42:	00 00 00 
+  801b45:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801b48:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b4d:	4c 89 f6             	mov    %r14,%rsi
+  801b50:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b55:	41 ff d4             	call   *%r12
+    return res;
+  801b58:	eb c3                	jmp    801b1d <dup+0xe6>
+
+0000000000801b5a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801b5a:	55                   	push   %rbp
+  801b5b:	48 89 e5             	mov    %rsp,%rbp
+  801b5e:	41 56                	push   %r14
+  801b60:	41 55                	push   %r13
+  801b62:	41 54                	push   %r12
+  801b64:	53                   	push   %rbx
+  801b65:	48 83 ec 10          	sub    $0x10,%rsp
+  801b69:	89 fb                	mov    %edi,%ebx
+  801b6b:	49 89 f4             	mov    %rsi,%r12
+  801b6e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b71:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b75:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  801b7c:	00 00 00 
+  801b7f:	ff d0                	call   *%rax
+  801b81:	85 c0                	test   %eax,%eax
+  801b83:	78 4c                	js     801bd1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b85:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b89:	41 8b 3e             	mov    (%r14),%edi
+  801b8c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b90:	48 b8 c2 18 80 00 00 	movabs $0x8018c2,%rax
+  801b97:	00 00 00 
+  801b9a:	ff d0                	call   *%rax
+  801b9c:	85 c0                	test   %eax,%eax
+  801b9e:	78 35                	js     801bd5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ba0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ba4:	83 e0 03             	and    $0x3,%eax
+  801ba7:	83 f8 01             	cmp    $0x1,%eax
+  801baa:	74 2d                	je     801bd9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801bac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bb0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801bb4:	48 85 c0             	test   %rax,%rax
+  801bb7:	74 56                	je     801c0f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801bb9:	4c 89 ea             	mov    %r13,%rdx
+  801bbc:	4c 89 e6             	mov    %r12,%rsi
+  801bbf:	4c 89 f7             	mov    %r14,%rdi
+  801bc2:	ff d0                	call   *%rax
+}
+  801bc4:	48 83 c4 10          	add    $0x10,%rsp
+  801bc8:	5b                   	pop    %rbx
+  801bc9:	41 5c                	pop    %r12
+  801bcb:	41 5d                	pop    %r13
+  801bcd:	41 5e                	pop    %r14
+  801bcf:	5d                   	pop    %rbp
+  801bd0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bd1:	48 98                	cltq
+  801bd3:	eb ef                	jmp    801bc4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bd5:	48 98                	cltq
+  801bd7:	eb eb                	jmp    801bc4 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bd9:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  801be0:	00 00 00 
+  801be3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801be9:	89 da                	mov    %ebx,%edx
+  801beb:	48 bf e1 32 80 00 00 	movabs $0x8032e1,%rdi
+  801bf2:	00 00 00 
+  801bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bfa:	48 b9 72 03 80 00 00 	movabs $0x800372,%rcx
+  801c01:	00 00 00 
+  801c04:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c06:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c0d:	eb b5                	jmp    801bc4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c0f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c16:	eb ac                	jmp    801bc4 <read+0x6a>
+
+0000000000801c18 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c18:	55                   	push   %rbp
+  801c19:	48 89 e5             	mov    %rsp,%rbp
+  801c1c:	41 57                	push   %r15
+  801c1e:	41 56                	push   %r14
+  801c20:	41 55                	push   %r13
+  801c22:	41 54                	push   %r12
+  801c24:	53                   	push   %rbx
+  801c25:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c29:	48 85 d2             	test   %rdx,%rdx
+  801c2c:	74 54                	je     801c82 <readn+0x6a>
+  801c2e:	41 89 fd             	mov    %edi,%r13d
+  801c31:	49 89 f6             	mov    %rsi,%r14
+  801c34:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801c37:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801c3c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801c41:	49 bf 5a 1b 80 00 00 	movabs $0x801b5a,%r15
+  801c48:	00 00 00 
+  801c4b:	4c 89 e2             	mov    %r12,%rdx
+  801c4e:	48 29 f2             	sub    %rsi,%rdx
+  801c51:	4c 01 f6             	add    %r14,%rsi
+  801c54:	44 89 ef             	mov    %r13d,%edi
+  801c57:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801c5a:	85 c0                	test   %eax,%eax
+  801c5c:	78 20                	js     801c7e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801c5e:	01 c3                	add    %eax,%ebx
+  801c60:	85 c0                	test   %eax,%eax
+  801c62:	74 08                	je     801c6c <readn+0x54>
+  801c64:	48 63 f3             	movslq %ebx,%rsi
+  801c67:	4c 39 e6             	cmp    %r12,%rsi
+  801c6a:	72 df                	jb     801c4b <readn+0x33>
+    }
+    return res;
+  801c6c:	48 63 c3             	movslq %ebx,%rax
+}
+  801c6f:	48 83 c4 08          	add    $0x8,%rsp
+  801c73:	5b                   	pop    %rbx
+  801c74:	41 5c                	pop    %r12
+  801c76:	41 5d                	pop    %r13
+  801c78:	41 5e                	pop    %r14
+  801c7a:	41 5f                	pop    %r15
+  801c7c:	5d                   	pop    %rbp
+  801c7d:	c3                   	ret
+        if (inc < 0) return inc;
+  801c7e:	48 98                	cltq
+  801c80:	eb ed                	jmp    801c6f <readn+0x57>
+    int inc = 1, res = 0;
+  801c82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c87:	eb e3                	jmp    801c6c <readn+0x54>
+
+0000000000801c89 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801c89:	55                   	push   %rbp
+  801c8a:	48 89 e5             	mov    %rsp,%rbp
+  801c8d:	41 56                	push   %r14
+  801c8f:	41 55                	push   %r13
+  801c91:	41 54                	push   %r12
+  801c93:	53                   	push   %rbx
+  801c94:	48 83 ec 10          	sub    $0x10,%rsp
+  801c98:	89 fb                	mov    %edi,%ebx
+  801c9a:	49 89 f4             	mov    %rsi,%r12
+  801c9d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ca0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ca4:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  801cab:	00 00 00 
+  801cae:	ff d0                	call   *%rax
+  801cb0:	85 c0                	test   %eax,%eax
+  801cb2:	78 47                	js     801cfb <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cb4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cb8:	41 8b 3e             	mov    (%r14),%edi
+  801cbb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cbf:	48 b8 c2 18 80 00 00 	movabs $0x8018c2,%rax
+  801cc6:	00 00 00 
+  801cc9:	ff d0                	call   *%rax
+  801ccb:	85 c0                	test   %eax,%eax
+  801ccd:	78 30                	js     801cff <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ccf:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801cd4:	74 2d                	je     801d03 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801cd6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cda:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801cde:	48 85 c0             	test   %rax,%rax
+  801ce1:	74 56                	je     801d39 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801ce3:	4c 89 ea             	mov    %r13,%rdx
+  801ce6:	4c 89 e6             	mov    %r12,%rsi
+  801ce9:	4c 89 f7             	mov    %r14,%rdi
+  801cec:	ff d0                	call   *%rax
+}
+  801cee:	48 83 c4 10          	add    $0x10,%rsp
+  801cf2:	5b                   	pop    %rbx
+  801cf3:	41 5c                	pop    %r12
+  801cf5:	41 5d                	pop    %r13
+  801cf7:	41 5e                	pop    %r14
+  801cf9:	5d                   	pop    %rbp
+  801cfa:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cfb:	48 98                	cltq
+  801cfd:	eb ef                	jmp    801cee <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cff:	48 98                	cltq
+  801d01:	eb eb                	jmp    801cee <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d03:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  801d0a:	00 00 00 
+  801d0d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d13:	89 da                	mov    %ebx,%edx
+  801d15:	48 bf fd 32 80 00 00 	movabs $0x8032fd,%rdi
+  801d1c:	00 00 00 
+  801d1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d24:	48 b9 72 03 80 00 00 	movabs $0x800372,%rcx
+  801d2b:	00 00 00 
+  801d2e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d30:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d37:	eb b5                	jmp    801cee <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d39:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d40:	eb ac                	jmp    801cee <write+0x65>
+
+0000000000801d42 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801d42:	55                   	push   %rbp
+  801d43:	48 89 e5             	mov    %rsp,%rbp
+  801d46:	53                   	push   %rbx
+  801d47:	48 83 ec 18          	sub    $0x18,%rsp
+  801d4b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d4d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d51:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  801d58:	00 00 00 
+  801d5b:	ff d0                	call   *%rax
+  801d5d:	85 c0                	test   %eax,%eax
+  801d5f:	78 0c                	js     801d6d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801d61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d65:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801d68:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d6d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d71:	c9                   	leave
+  801d72:	c3                   	ret
+
+0000000000801d73 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801d73:	55                   	push   %rbp
+  801d74:	48 89 e5             	mov    %rsp,%rbp
+  801d77:	41 55                	push   %r13
+  801d79:	41 54                	push   %r12
+  801d7b:	53                   	push   %rbx
+  801d7c:	48 83 ec 18          	sub    $0x18,%rsp
+  801d80:	89 fb                	mov    %edi,%ebx
+  801d82:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d85:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d89:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  801d90:	00 00 00 
+  801d93:	ff d0                	call   *%rax
+  801d95:	85 c0                	test   %eax,%eax
+  801d97:	78 38                	js     801dd1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d99:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801d9d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801da1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801da5:	48 b8 c2 18 80 00 00 	movabs $0x8018c2,%rax
+  801dac:	00 00 00 
+  801daf:	ff d0                	call   *%rax
+  801db1:	85 c0                	test   %eax,%eax
+  801db3:	78 1c                	js     801dd1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801db5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801dba:	74 20                	je     801ddc <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801dbc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dc0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801dc4:	48 85 c0             	test   %rax,%rax
+  801dc7:	74 47                	je     801e10 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801dc9:	44 89 e6             	mov    %r12d,%esi
+  801dcc:	4c 89 ef             	mov    %r13,%rdi
+  801dcf:	ff d0                	call   *%rax
+}
+  801dd1:	48 83 c4 18          	add    $0x18,%rsp
+  801dd5:	5b                   	pop    %rbx
+  801dd6:	41 5c                	pop    %r12
+  801dd8:	41 5d                	pop    %r13
+  801dda:	5d                   	pop    %rbp
+  801ddb:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ddc:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  801de3:	00 00 00 
+  801de6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dec:	89 da                	mov    %ebx,%edx
+  801dee:	48 bf c0 32 80 00 00 	movabs $0x8032c0,%rdi
+  801df5:	00 00 00 
+  801df8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dfd:	48 b9 72 03 80 00 00 	movabs $0x800372,%rcx
+  801e04:	00 00 00 
+  801e07:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e0e:	eb c1                	jmp    801dd1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e10:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e15:	eb ba                	jmp    801dd1 <ftruncate+0x5e>
+
+0000000000801e17 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e17:	55                   	push   %rbp
+  801e18:	48 89 e5             	mov    %rsp,%rbp
+  801e1b:	41 54                	push   %r12
+  801e1d:	53                   	push   %rbx
+  801e1e:	48 83 ec 10          	sub    $0x10,%rsp
+  801e22:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e25:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e29:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  801e30:	00 00 00 
+  801e33:	ff d0                	call   *%rax
+  801e35:	85 c0                	test   %eax,%eax
+  801e37:	78 4e                	js     801e87 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e39:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e3d:	41 8b 3c 24          	mov    (%r12),%edi
+  801e41:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e45:	48 b8 c2 18 80 00 00 	movabs $0x8018c2,%rax
+  801e4c:	00 00 00 
+  801e4f:	ff d0                	call   *%rax
+  801e51:	85 c0                	test   %eax,%eax
+  801e53:	78 32                	js     801e87 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e55:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e59:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801e5e:	74 30                	je     801e90 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801e60:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801e63:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801e6a:	00 00 00 
+    stat->st_isdir = 0;
+  801e6d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801e74:	00 00 00 
+    stat->st_dev = dev;
+  801e77:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801e7e:	48 89 de             	mov    %rbx,%rsi
+  801e81:	4c 89 e7             	mov    %r12,%rdi
+  801e84:	ff 50 28             	call   *0x28(%rax)
+}
+  801e87:	48 83 c4 10          	add    $0x10,%rsp
+  801e8b:	5b                   	pop    %rbx
+  801e8c:	41 5c                	pop    %r12
+  801e8e:	5d                   	pop    %rbp
+  801e8f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e90:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e95:	eb f0                	jmp    801e87 <fstat+0x70>
+
+0000000000801e97 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801e97:	55                   	push   %rbp
+  801e98:	48 89 e5             	mov    %rsp,%rbp
+  801e9b:	41 54                	push   %r12
+  801e9d:	53                   	push   %rbx
+  801e9e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801ea1:	be 00 00 00 00       	mov    $0x0,%esi
+  801ea6:	48 b8 18 21 80 00 00 	movabs $0x802118,%rax
+  801ead:	00 00 00 
+  801eb0:	ff d0                	call   *%rax
+  801eb2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801eb4:	85 c0                	test   %eax,%eax
+  801eb6:	78 25                	js     801edd <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801eb8:	4c 89 e6             	mov    %r12,%rsi
+  801ebb:	89 c7                	mov    %eax,%edi
+  801ebd:	48 b8 17 1e 80 00 00 	movabs $0x801e17,%rax
+  801ec4:	00 00 00 
+  801ec7:	ff d0                	call   *%rax
+  801ec9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801ecc:	89 df                	mov    %ebx,%edi
+  801ece:	48 b8 dc 19 80 00 00 	movabs $0x8019dc,%rax
+  801ed5:	00 00 00 
+  801ed8:	ff d0                	call   *%rax
+
+    return res;
+  801eda:	44 89 e3             	mov    %r12d,%ebx
+}
+  801edd:	89 d8                	mov    %ebx,%eax
+  801edf:	5b                   	pop    %rbx
+  801ee0:	41 5c                	pop    %r12
+  801ee2:	5d                   	pop    %rbp
+  801ee3:	c3                   	ret
+
+0000000000801ee4 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801ee4:	55                   	push   %rbp
+  801ee5:	48 89 e5             	mov    %rsp,%rbp
+  801ee8:	41 54                	push   %r12
+  801eea:	53                   	push   %rbx
+  801eeb:	48 83 ec 10          	sub    $0x10,%rsp
+  801eef:	41 89 fc             	mov    %edi,%r12d
+  801ef2:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ef5:	48 b8 00 70 c0 00 00 	movabs $0xc07000,%rax
+  801efc:	00 00 00 
+  801eff:	83 38 00             	cmpl   $0x0,(%rax)
+  801f02:	74 5e                	je     801f62 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801f04:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801f0a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801f0f:	48 ba 00 60 c0 00 00 	movabs $0xc06000,%rdx
+  801f16:	00 00 00 
+  801f19:	44 89 e6             	mov    %r12d,%esi
+  801f1c:	48 b8 00 70 c0 00 00 	movabs $0xc07000,%rax
+  801f23:	00 00 00 
+  801f26:	8b 38                	mov    (%rax),%edi
+  801f28:	48 b8 51 2b 80 00 00 	movabs $0x802b51,%rax
+  801f2f:	00 00 00 
+  801f32:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801f34:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801f3b:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801f3c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f41:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801f45:	48 89 de             	mov    %rbx,%rsi
+  801f48:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f4d:	48 b8 bc 2a 80 00 00 	movabs $0x802abc,%rax
+  801f54:	00 00 00 
+  801f57:	ff d0                	call   *%rax
+}
+  801f59:	48 83 c4 10          	add    $0x10,%rsp
+  801f5d:	5b                   	pop    %rbx
+  801f5e:	41 5c                	pop    %r12
+  801f60:	5d                   	pop    %rbp
+  801f61:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f62:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f67:	48 b8 f1 2b 80 00 00 	movabs $0x802bf1,%rax
+  801f6e:	00 00 00 
+  801f71:	ff d0                	call   *%rax
+  801f73:	a3 00 70 c0 00 00 00 	movabs %eax,0xc07000
+  801f7a:	00 00 
+  801f7c:	eb 86                	jmp    801f04 <fsipc+0x20>
+
+0000000000801f7e <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801f7e:	55                   	push   %rbp
+  801f7f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f82:	48 b8 00 60 c0 00 00 	movabs $0xc06000,%rax
+  801f89:	00 00 00 
+  801f8c:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801f8f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801f91:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801f94:	be 00 00 00 00       	mov    $0x0,%esi
+  801f99:	bf 02 00 00 00       	mov    $0x2,%edi
+  801f9e:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  801fa5:	00 00 00 
+  801fa8:	ff d0                	call   *%rax
+}
+  801faa:	5d                   	pop    %rbp
+  801fab:	c3                   	ret
+
+0000000000801fac <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801fac:	55                   	push   %rbp
+  801fad:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801fb0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801fb3:	a3 00 60 c0 00 00 00 	movabs %eax,0xc06000
+  801fba:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801fbc:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc1:	bf 06 00 00 00       	mov    $0x6,%edi
+  801fc6:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  801fcd:	00 00 00 
+  801fd0:	ff d0                	call   *%rax
+}
+  801fd2:	5d                   	pop    %rbp
+  801fd3:	c3                   	ret
+
+0000000000801fd4 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801fd4:	55                   	push   %rbp
+  801fd5:	48 89 e5             	mov    %rsp,%rbp
+  801fd8:	41 54                	push   %r12
+  801fda:	53                   	push   %rbx
+  801fdb:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801fde:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801fe1:	a3 00 60 c0 00 00 00 	movabs %eax,0xc06000
+  801fe8:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801fea:	be 00 00 00 00       	mov    $0x0,%esi
+  801fef:	bf 05 00 00 00       	mov    $0x5,%edi
+  801ff4:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  801ffb:	00 00 00 
+  801ffe:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802000:	85 c0                	test   %eax,%eax
+  802002:	78 3d                	js     802041 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802004:	49 bc 00 60 c0 00 00 	movabs $0xc06000,%r12
+  80200b:	00 00 00 
+  80200e:	4c 89 e6             	mov    %r12,%rsi
+  802011:	48 89 df             	mov    %rbx,%rdi
+  802014:	48 b8 97 0c 80 00 00 	movabs $0x800c97,%rax
+  80201b:	00 00 00 
+  80201e:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802020:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802027:	00 
+  802028:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80202e:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802035:	00 
+  802036:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80203c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802041:	5b                   	pop    %rbx
+  802042:	41 5c                	pop    %r12
+  802044:	5d                   	pop    %rbp
+  802045:	c3                   	ret
+
+0000000000802046 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802046:	55                   	push   %rbp
+  802047:	48 89 e5             	mov    %rsp,%rbp
+  80204a:	41 54                	push   %r12
+  80204c:	53                   	push   %rbx
+  80204d:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  802050:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802055:	48 39 c2             	cmp    %rax,%rdx
+  802058:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80205c:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80205f:	48 89 c2             	mov    %rax,%rdx
+  802062:	48 bf 10 60 c0 00 00 	movabs $0xc06010,%rdi
+  802069:	00 00 00 
+  80206c:	48 b8 f8 0e 80 00 00 	movabs $0x800ef8,%rax
+  802073:	00 00 00 
+  802076:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802078:	48 b8 00 60 c0 00 00 	movabs $0xc06000,%rax
+  80207f:	00 00 00 
+  802082:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802087:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802089:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  80208d:	be 00 00 00 00       	mov    $0x0,%esi
+  802092:	bf 04 00 00 00       	mov    $0x4,%edi
+  802097:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  80209e:	00 00 00 
+  8020a1:	ff d0                	call   *%rax
+  8020a3:	48 98                	cltq
+}
+  8020a5:	5b                   	pop    %rbx
+  8020a6:	41 5c                	pop    %r12
+  8020a8:	5d                   	pop    %rbp
+  8020a9:	c3                   	ret
+
+00000000008020aa <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8020aa:	55                   	push   %rbp
+  8020ab:	48 89 e5             	mov    %rsp,%rbp
+  8020ae:	41 54                	push   %r12
+  8020b0:	53                   	push   %rbx
+  8020b1:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020b4:	48 b8 00 60 c0 00 00 	movabs $0xc06000,%rax
+  8020bb:	00 00 00 
+  8020be:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8020c1:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8020c3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020c8:	48 39 ca             	cmp    %rcx,%rdx
+  8020cb:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8020cf:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8020d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020dd:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  8020e4:	00 00 00 
+  8020e7:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  8020e9:	85 c0                	test   %eax,%eax
+  8020eb:	78 27                	js     802114 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  8020ed:	48 63 d8             	movslq %eax,%rbx
+  8020f0:	48 89 da             	mov    %rbx,%rdx
+  8020f3:	48 be 00 60 c0 00 00 	movabs $0xc06000,%rsi
+  8020fa:	00 00 00 
+  8020fd:	4c 89 e7             	mov    %r12,%rdi
+  802100:	48 b8 f8 0e 80 00 00 	movabs $0x800ef8,%rax
+  802107:	00 00 00 
+  80210a:	ff d0                	call   *%rax
+    return bytes_read;
+  80210c:	48 89 d8             	mov    %rbx,%rax
+}
+  80210f:	5b                   	pop    %rbx
+  802110:	41 5c                	pop    %r12
+  802112:	5d                   	pop    %rbp
+  802113:	c3                   	ret
+        return bytes_read;
+  802114:	48 98                	cltq
+  802116:	eb f7                	jmp    80210f <devfile_read+0x65>
+
+0000000000802118 <open>:
+open(const char *path, int mode) {
+  802118:	55                   	push   %rbp
+  802119:	48 89 e5             	mov    %rsp,%rbp
+  80211c:	41 55                	push   %r13
+  80211e:	41 54                	push   %r12
+  802120:	53                   	push   %rbx
+  802121:	48 83 ec 18          	sub    $0x18,%rsp
+  802125:	49 89 fc             	mov    %rdi,%r12
+  802128:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80212b:	48 b8 59 0c 80 00 00 	movabs $0x800c59,%rax
+  802132:	00 00 00 
+  802135:	ff d0                	call   *%rax
+  802137:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80213d:	0f 87 8a 00 00 00    	ja     8021cd <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802143:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802147:	48 b8 17 18 80 00 00 	movabs $0x801817,%rax
+  80214e:	00 00 00 
+  802151:	ff d0                	call   *%rax
+  802153:	89 c3                	mov    %eax,%ebx
+  802155:	85 c0                	test   %eax,%eax
+  802157:	78 50                	js     8021a9 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802159:	4c 89 e6             	mov    %r12,%rsi
+  80215c:	48 bb 00 60 c0 00 00 	movabs $0xc06000,%rbx
+  802163:	00 00 00 
+  802166:	48 89 df             	mov    %rbx,%rdi
+  802169:	48 b8 97 0c 80 00 00 	movabs $0x800c97,%rax
+  802170:	00 00 00 
+  802173:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802175:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80217c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802180:	bf 01 00 00 00       	mov    $0x1,%edi
+  802185:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  80218c:	00 00 00 
+  80218f:	ff d0                	call   *%rax
+  802191:	89 c3                	mov    %eax,%ebx
+  802193:	85 c0                	test   %eax,%eax
+  802195:	78 1f                	js     8021b6 <open+0x9e>
+    return fd2num(fd);
+  802197:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80219b:	48 b8 e9 17 80 00 00 	movabs $0x8017e9,%rax
+  8021a2:	00 00 00 
+  8021a5:	ff d0                	call   *%rax
+  8021a7:	89 c3                	mov    %eax,%ebx
+}
+  8021a9:	89 d8                	mov    %ebx,%eax
+  8021ab:	48 83 c4 18          	add    $0x18,%rsp
+  8021af:	5b                   	pop    %rbx
+  8021b0:	41 5c                	pop    %r12
+  8021b2:	41 5d                	pop    %r13
+  8021b4:	5d                   	pop    %rbp
+  8021b5:	c3                   	ret
+        fd_close(fd, 0);
+  8021b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021bb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8021bf:	48 b8 32 19 80 00 00 	movabs $0x801932,%rax
+  8021c6:	00 00 00 
+  8021c9:	ff d0                	call   *%rax
+        return res;
+  8021cb:	eb dc                	jmp    8021a9 <open+0x91>
+        return -E_BAD_PATH;
+  8021cd:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8021d2:	eb d5                	jmp    8021a9 <open+0x91>
+
+00000000008021d4 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8021d4:	55                   	push   %rbp
+  8021d5:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8021d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8021dd:	bf 08 00 00 00       	mov    $0x8,%edi
+  8021e2:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  8021e9:	00 00 00 
+  8021ec:	ff d0                	call   *%rax
+}
+  8021ee:	5d                   	pop    %rbp
+  8021ef:	c3                   	ret
+
+00000000008021f0 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8021f0:	55                   	push   %rbp
+  8021f1:	48 89 e5             	mov    %rsp,%rbp
+  8021f4:	41 54                	push   %r12
+  8021f6:	53                   	push   %rbx
+  8021f7:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8021fa:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  802201:	00 00 00 
+  802204:	ff d0                	call   *%rax
+  802206:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802209:	48 be 40 33 80 00 00 	movabs $0x803340,%rsi
+  802210:	00 00 00 
+  802213:	48 89 df             	mov    %rbx,%rdi
+  802216:	48 b8 97 0c 80 00 00 	movabs $0x800c97,%rax
+  80221d:	00 00 00 
+  802220:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802222:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802227:	41 2b 04 24          	sub    (%r12),%eax
+  80222b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802231:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802238:	00 00 00 
+    stat->st_dev = &devpipe;
+  80223b:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802242:	00 00 00 
+  802245:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80224c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802251:	5b                   	pop    %rbx
+  802252:	41 5c                	pop    %r12
+  802254:	5d                   	pop    %rbp
+  802255:	c3                   	ret
+
+0000000000802256 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802256:	55                   	push   %rbp
+  802257:	48 89 e5             	mov    %rsp,%rbp
+  80225a:	41 54                	push   %r12
+  80225c:	53                   	push   %rbx
+  80225d:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802260:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802265:	48 89 fe             	mov    %rdi,%rsi
+  802268:	bf 00 00 00 00       	mov    $0x0,%edi
+  80226d:	49 bc 13 13 80 00 00 	movabs $0x801313,%r12
+  802274:	00 00 00 
+  802277:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80227a:	48 89 df             	mov    %rbx,%rdi
+  80227d:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  802284:	00 00 00 
+  802287:	ff d0                	call   *%rax
+  802289:	48 89 c6             	mov    %rax,%rsi
+  80228c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802291:	bf 00 00 00 00       	mov    $0x0,%edi
+  802296:	41 ff d4             	call   *%r12
+}
+  802299:	5b                   	pop    %rbx
+  80229a:	41 5c                	pop    %r12
+  80229c:	5d                   	pop    %rbp
+  80229d:	c3                   	ret
+
+000000000080229e <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80229e:	55                   	push   %rbp
+  80229f:	48 89 e5             	mov    %rsp,%rbp
+  8022a2:	41 57                	push   %r15
+  8022a4:	41 56                	push   %r14
+  8022a6:	41 55                	push   %r13
+  8022a8:	41 54                	push   %r12
+  8022aa:	53                   	push   %rbx
+  8022ab:	48 83 ec 18          	sub    $0x18,%rsp
+  8022af:	49 89 fc             	mov    %rdi,%r12
+  8022b2:	49 89 f5             	mov    %rsi,%r13
+  8022b5:	49 89 d7             	mov    %rdx,%r15
+  8022b8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8022bc:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  8022c3:	00 00 00 
+  8022c6:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8022c8:	4d 85 ff             	test   %r15,%r15
+  8022cb:	0f 84 af 00 00 00    	je     802380 <devpipe_write+0xe2>
+  8022d1:	48 89 c3             	mov    %rax,%rbx
+  8022d4:	4c 89 f8             	mov    %r15,%rax
+  8022d7:	4d 89 ef             	mov    %r13,%r15
+  8022da:	4c 01 e8             	add    %r13,%rax
+  8022dd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8022e1:	49 bd 1b 12 80 00 00 	movabs $0x80121b,%r13
+  8022e8:	00 00 00 
+            sys_yield();
+  8022eb:	49 be b8 11 80 00 00 	movabs $0x8011b8,%r14
+  8022f2:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8022f5:	8b 73 04             	mov    0x4(%rbx),%esi
+  8022f8:	48 63 ce             	movslq %esi,%rcx
+  8022fb:	48 63 03             	movslq (%rbx),%rax
+  8022fe:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802304:	48 39 c1             	cmp    %rax,%rcx
+  802307:	72 2e                	jb     802337 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802309:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80230e:	48 89 da             	mov    %rbx,%rdx
+  802311:	be 00 10 00 00       	mov    $0x1000,%esi
+  802316:	4c 89 e7             	mov    %r12,%rdi
+  802319:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80231c:	85 c0                	test   %eax,%eax
+  80231e:	74 66                	je     802386 <devpipe_write+0xe8>
+            sys_yield();
+  802320:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802323:	8b 73 04             	mov    0x4(%rbx),%esi
+  802326:	48 63 ce             	movslq %esi,%rcx
+  802329:	48 63 03             	movslq (%rbx),%rax
+  80232c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802332:	48 39 c1             	cmp    %rax,%rcx
+  802335:	73 d2                	jae    802309 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802337:	41 0f b6 3f          	movzbl (%r15),%edi
+  80233b:	48 89 ca             	mov    %rcx,%rdx
+  80233e:	48 c1 ea 03          	shr    $0x3,%rdx
+  802342:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802349:	08 10 20 
+  80234c:	48 f7 e2             	mul    %rdx
+  80234f:	48 c1 ea 06          	shr    $0x6,%rdx
+  802353:	48 89 d0             	mov    %rdx,%rax
+  802356:	48 c1 e0 09          	shl    $0x9,%rax
+  80235a:	48 29 d0             	sub    %rdx,%rax
+  80235d:	48 c1 e0 03          	shl    $0x3,%rax
+  802361:	48 29 c1             	sub    %rax,%rcx
+  802364:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802369:	83 c6 01             	add    $0x1,%esi
+  80236c:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80236f:	49 83 c7 01          	add    $0x1,%r15
+  802373:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802377:	49 39 c7             	cmp    %rax,%r15
+  80237a:	0f 85 75 ff ff ff    	jne    8022f5 <devpipe_write+0x57>
+    return n;
+  802380:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802384:	eb 05                	jmp    80238b <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802386:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80238b:	48 83 c4 18          	add    $0x18,%rsp
+  80238f:	5b                   	pop    %rbx
+  802390:	41 5c                	pop    %r12
+  802392:	41 5d                	pop    %r13
+  802394:	41 5e                	pop    %r14
+  802396:	41 5f                	pop    %r15
+  802398:	5d                   	pop    %rbp
+  802399:	c3                   	ret
+
+000000000080239a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80239a:	55                   	push   %rbp
+  80239b:	48 89 e5             	mov    %rsp,%rbp
+  80239e:	41 57                	push   %r15
+  8023a0:	41 56                	push   %r14
+  8023a2:	41 55                	push   %r13
+  8023a4:	41 54                	push   %r12
+  8023a6:	53                   	push   %rbx
+  8023a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8023ab:	49 89 fc             	mov    %rdi,%r12
+  8023ae:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8023b2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8023b6:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  8023bd:	00 00 00 
+  8023c0:	ff d0                	call   *%rax
+  8023c2:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8023c5:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8023cb:	49 bd 1b 12 80 00 00 	movabs $0x80121b,%r13
+  8023d2:	00 00 00 
+            sys_yield();
+  8023d5:	49 be b8 11 80 00 00 	movabs $0x8011b8,%r14
+  8023dc:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8023df:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8023e4:	74 7d                	je     802463 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8023e6:	8b 03                	mov    (%rbx),%eax
+  8023e8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8023eb:	75 26                	jne    802413 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8023ed:	4d 85 ff             	test   %r15,%r15
+  8023f0:	75 77                	jne    802469 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8023f2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8023f7:	48 89 da             	mov    %rbx,%rdx
+  8023fa:	be 00 10 00 00       	mov    $0x1000,%esi
+  8023ff:	4c 89 e7             	mov    %r12,%rdi
+  802402:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802405:	85 c0                	test   %eax,%eax
+  802407:	74 72                	je     80247b <devpipe_read+0xe1>
+            sys_yield();
+  802409:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80240c:	8b 03                	mov    (%rbx),%eax
+  80240e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802411:	74 df                	je     8023f2 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802413:	48 63 c8             	movslq %eax,%rcx
+  802416:	48 89 ca             	mov    %rcx,%rdx
+  802419:	48 c1 ea 03          	shr    $0x3,%rdx
+  80241d:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802424:	08 10 20 
+  802427:	48 89 d0             	mov    %rdx,%rax
+  80242a:	48 f7 e6             	mul    %rsi
+  80242d:	48 c1 ea 06          	shr    $0x6,%rdx
+  802431:	48 89 d0             	mov    %rdx,%rax
+  802434:	48 c1 e0 09          	shl    $0x9,%rax
+  802438:	48 29 d0             	sub    %rdx,%rax
+  80243b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802442:	00 
+  802443:	48 89 c8             	mov    %rcx,%rax
+  802446:	48 29 d0             	sub    %rdx,%rax
+  802449:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80244e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802452:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802456:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802459:	49 83 c7 01          	add    $0x1,%r15
+  80245d:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802461:	75 83                	jne    8023e6 <devpipe_read+0x4c>
+    return n;
+  802463:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802467:	eb 03                	jmp    80246c <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802469:	4c 89 f8             	mov    %r15,%rax
+}
+  80246c:	48 83 c4 18          	add    $0x18,%rsp
+  802470:	5b                   	pop    %rbx
+  802471:	41 5c                	pop    %r12
+  802473:	41 5d                	pop    %r13
+  802475:	41 5e                	pop    %r14
+  802477:	41 5f                	pop    %r15
+  802479:	5d                   	pop    %rbp
+  80247a:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80247b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802480:	eb ea                	jmp    80246c <devpipe_read+0xd2>
+
+0000000000802482 <pipe>:
+pipe(int pfd[2]) {
+  802482:	55                   	push   %rbp
+  802483:	48 89 e5             	mov    %rsp,%rbp
+  802486:	41 55                	push   %r13
+  802488:	41 54                	push   %r12
+  80248a:	53                   	push   %rbx
+  80248b:	48 83 ec 18          	sub    $0x18,%rsp
+  80248f:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802492:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802496:	48 b8 17 18 80 00 00 	movabs $0x801817,%rax
+  80249d:	00 00 00 
+  8024a0:	ff d0                	call   *%rax
+  8024a2:	89 c3                	mov    %eax,%ebx
+  8024a4:	85 c0                	test   %eax,%eax
+  8024a6:	0f 88 a0 01 00 00    	js     80264c <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8024ac:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8024b1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024b6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8024ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024bf:	48 b8 47 12 80 00 00 	movabs $0x801247,%rax
+  8024c6:	00 00 00 
+  8024c9:	ff d0                	call   *%rax
+  8024cb:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8024cd:	85 c0                	test   %eax,%eax
+  8024cf:	0f 88 77 01 00 00    	js     80264c <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8024d5:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8024d9:	48 b8 17 18 80 00 00 	movabs $0x801817,%rax
+  8024e0:	00 00 00 
+  8024e3:	ff d0                	call   *%rax
+  8024e5:	89 c3                	mov    %eax,%ebx
+  8024e7:	85 c0                	test   %eax,%eax
+  8024e9:	0f 88 43 01 00 00    	js     802632 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8024ef:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8024f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024f9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8024fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802502:	48 b8 47 12 80 00 00 	movabs $0x801247,%rax
+  802509:	00 00 00 
+  80250c:	ff d0                	call   *%rax
+  80250e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802510:	85 c0                	test   %eax,%eax
+  802512:	0f 88 1a 01 00 00    	js     802632 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802518:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80251c:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  802523:	00 00 00 
+  802526:	ff d0                	call   *%rax
+  802528:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80252b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802530:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802535:	48 89 c6             	mov    %rax,%rsi
+  802538:	bf 00 00 00 00       	mov    $0x0,%edi
+  80253d:	48 b8 47 12 80 00 00 	movabs $0x801247,%rax
+  802544:	00 00 00 
+  802547:	ff d0                	call   *%rax
+  802549:	89 c3                	mov    %eax,%ebx
+  80254b:	85 c0                	test   %eax,%eax
+  80254d:	0f 88 c5 00 00 00    	js     802618 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802553:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802557:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  80255e:	00 00 00 
+  802561:	ff d0                	call   *%rax
+  802563:	48 89 c1             	mov    %rax,%rcx
+  802566:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80256c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802572:	ba 00 00 00 00       	mov    $0x0,%edx
+  802577:	4c 89 ee             	mov    %r13,%rsi
+  80257a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80257f:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  802586:	00 00 00 
+  802589:	ff d0                	call   *%rax
+  80258b:	89 c3                	mov    %eax,%ebx
+  80258d:	85 c0                	test   %eax,%eax
+  80258f:	78 6e                	js     8025ff <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802591:	be 00 10 00 00       	mov    $0x1000,%esi
+  802596:	4c 89 ef             	mov    %r13,%rdi
+  802599:	48 b8 e9 11 80 00 00 	movabs $0x8011e9,%rax
+  8025a0:	00 00 00 
+  8025a3:	ff d0                	call   *%rax
+  8025a5:	83 f8 02             	cmp    $0x2,%eax
+  8025a8:	0f 85 ab 00 00 00    	jne    802659 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8025ae:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8025b5:	00 00 
+  8025b7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8025bb:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8025bd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8025c1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8025c8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8025cc:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8025ce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025d2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8025d9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025dd:	48 bb e9 17 80 00 00 	movabs $0x8017e9,%rbx
+  8025e4:	00 00 00 
+  8025e7:	ff d3                	call   *%rbx
+  8025e9:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8025ed:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8025f1:	ff d3                	call   *%rbx
+  8025f3:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8025f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025fd:	eb 4d                	jmp    80264c <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8025ff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802604:	4c 89 ee             	mov    %r13,%rsi
+  802607:	bf 00 00 00 00       	mov    $0x0,%edi
+  80260c:	48 b8 13 13 80 00 00 	movabs $0x801313,%rax
+  802613:	00 00 00 
+  802616:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802618:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80261d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802621:	bf 00 00 00 00       	mov    $0x0,%edi
+  802626:	48 b8 13 13 80 00 00 	movabs $0x801313,%rax
+  80262d:	00 00 00 
+  802630:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802632:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802637:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80263b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802640:	48 b8 13 13 80 00 00 	movabs $0x801313,%rax
+  802647:	00 00 00 
+  80264a:	ff d0                	call   *%rax
+}
+  80264c:	89 d8                	mov    %ebx,%eax
+  80264e:	48 83 c4 18          	add    $0x18,%rsp
+  802652:	5b                   	pop    %rbx
+  802653:	41 5c                	pop    %r12
+  802655:	41 5d                	pop    %r13
+  802657:	5d                   	pop    %rbp
+  802658:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802659:	48 b9 70 33 80 00 00 	movabs $0x803370,%rcx
+  802660:	00 00 00 
+  802663:	48 ba 47 33 80 00 00 	movabs $0x803347,%rdx
+  80266a:	00 00 00 
+  80266d:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802672:	48 bf 5c 33 80 00 00 	movabs $0x80335c,%rdi
+  802679:	00 00 00 
+  80267c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802681:	49 b8 22 02 80 00 00 	movabs $0x800222,%r8
+  802688:	00 00 00 
+  80268b:	41 ff d0             	call   *%r8
+
+000000000080268e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80268e:	55                   	push   %rbp
+  80268f:	48 89 e5             	mov    %rsp,%rbp
+  802692:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802696:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80269a:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  8026a1:	00 00 00 
+  8026a4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026a6:	85 c0                	test   %eax,%eax
+  8026a8:	78 35                	js     8026df <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8026aa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8026ae:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  8026b5:	00 00 00 
+  8026b8:	ff d0                	call   *%rax
+  8026ba:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026bd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026c2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026c7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8026cb:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  8026d2:	00 00 00 
+  8026d5:	ff d0                	call   *%rax
+  8026d7:	85 c0                	test   %eax,%eax
+  8026d9:	0f 94 c0             	sete   %al
+  8026dc:	0f b6 c0             	movzbl %al,%eax
+}
+  8026df:	c9                   	leave
+  8026e0:	c3                   	ret
+
+00000000008026e1 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8026e1:	48 89 f8             	mov    %rdi,%rax
+  8026e4:	48 c1 e8 27          	shr    $0x27,%rax
+  8026e8:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8026ef:	01 00 00 
+  8026f2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8026f6:	f6 c2 01             	test   $0x1,%dl
+  8026f9:	74 6d                	je     802768 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8026fb:	48 89 f8             	mov    %rdi,%rax
+  8026fe:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802702:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802709:	01 00 00 
+  80270c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802710:	f6 c2 01             	test   $0x1,%dl
+  802713:	74 62                	je     802777 <get_uvpt_entry+0x96>
+  802715:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80271c:	01 00 00 
+  80271f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802723:	f6 c2 80             	test   $0x80,%dl
+  802726:	75 4f                	jne    802777 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802728:	48 89 f8             	mov    %rdi,%rax
+  80272b:	48 c1 e8 15          	shr    $0x15,%rax
+  80272f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802736:	01 00 00 
+  802739:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80273d:	f6 c2 01             	test   $0x1,%dl
+  802740:	74 44                	je     802786 <get_uvpt_entry+0xa5>
+  802742:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802749:	01 00 00 
+  80274c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802750:	f6 c2 80             	test   $0x80,%dl
+  802753:	75 31                	jne    802786 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802755:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802759:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802760:	01 00 00 
+  802763:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802767:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802768:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80276f:	01 00 00 
+  802772:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802776:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802777:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80277e:	01 00 00 
+  802781:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802785:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802786:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80278d:	01 00 00 
+  802790:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802794:	c3                   	ret
+
+0000000000802795 <get_prot>:
+
+int
+get_prot(void *va) {
+  802795:	55                   	push   %rbp
+  802796:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802799:	48 b8 e1 26 80 00 00 	movabs $0x8026e1,%rax
+  8027a0:	00 00 00 
+  8027a3:	ff d0                	call   *%rax
+  8027a5:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8027a8:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8027ad:	89 c1                	mov    %eax,%ecx
+  8027af:	83 c9 04             	or     $0x4,%ecx
+  8027b2:	f6 c2 01             	test   $0x1,%dl
+  8027b5:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8027b8:	89 c1                	mov    %eax,%ecx
+  8027ba:	83 c9 02             	or     $0x2,%ecx
+  8027bd:	f6 c2 02             	test   $0x2,%dl
+  8027c0:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8027c3:	89 c1                	mov    %eax,%ecx
+  8027c5:	83 c9 01             	or     $0x1,%ecx
+  8027c8:	48 85 d2             	test   %rdx,%rdx
+  8027cb:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8027ce:	89 c1                	mov    %eax,%ecx
+  8027d0:	83 c9 40             	or     $0x40,%ecx
+  8027d3:	f6 c6 04             	test   $0x4,%dh
+  8027d6:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8027d9:	5d                   	pop    %rbp
+  8027da:	c3                   	ret
+
+00000000008027db <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8027db:	55                   	push   %rbp
+  8027dc:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8027df:	48 b8 e1 26 80 00 00 	movabs $0x8026e1,%rax
+  8027e6:	00 00 00 
+  8027e9:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8027eb:	48 c1 e8 06          	shr    $0x6,%rax
+  8027ef:	83 e0 01             	and    $0x1,%eax
+}
+  8027f2:	5d                   	pop    %rbp
+  8027f3:	c3                   	ret
+
+00000000008027f4 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8027f4:	55                   	push   %rbp
+  8027f5:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8027f8:	48 b8 e1 26 80 00 00 	movabs $0x8026e1,%rax
+  8027ff:	00 00 00 
+  802802:	ff d0                	call   *%rax
+  802804:	83 e0 01             	and    $0x1,%eax
+}
+  802807:	5d                   	pop    %rbp
+  802808:	c3                   	ret
+
+0000000000802809 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802809:	55                   	push   %rbp
+  80280a:	48 89 e5             	mov    %rsp,%rbp
+  80280d:	41 57                	push   %r15
+  80280f:	41 56                	push   %r14
+  802811:	41 55                	push   %r13
+  802813:	41 54                	push   %r12
+  802815:	53                   	push   %rbx
+  802816:	48 83 ec 18          	sub    $0x18,%rsp
+  80281a:	49 89 ff             	mov    %rdi,%r15
+  80281d:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802821:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802826:	49 bc f4 27 80 00 00 	movabs $0x8027f4,%r12
+  80282d:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802830:	49 be 95 27 80 00 00 	movabs $0x802795,%r14
+  802837:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80283a:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802841:	00 00 00 
+  802844:	eb 0c                	jmp    802852 <foreach_shared_region+0x49>
+  802846:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80284d:	4c 39 eb             	cmp    %r13,%rbx
+  802850:	74 38                	je     80288a <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802852:	48 89 df             	mov    %rbx,%rdi
+  802855:	41 ff d4             	call   *%r12
+  802858:	84 c0                	test   %al,%al
+  80285a:	74 ea                	je     802846 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  80285c:	48 89 df             	mov    %rbx,%rdi
+  80285f:	41 ff d6             	call   *%r14
+  802862:	a8 40                	test   $0x40,%al
+  802864:	74 e0                	je     802846 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802866:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80286d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802871:	48 89 df             	mov    %rbx,%rdi
+  802874:	41 ff d7             	call   *%r15
+        if (err)
+  802877:	85 c0                	test   %eax,%eax
+  802879:	74 cb                	je     802846 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  80287b:	48 83 c4 18          	add    $0x18,%rsp
+  80287f:	5b                   	pop    %rbx
+  802880:	41 5c                	pop    %r12
+  802882:	41 5d                	pop    %r13
+  802884:	41 5e                	pop    %r14
+  802886:	41 5f                	pop    %r15
+  802888:	5d                   	pop    %rbp
+  802889:	c3                   	ret
+    return 0;
+  80288a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80288f:	eb ea                	jmp    80287b <foreach_shared_region+0x72>
+
+0000000000802891 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802891:	b8 00 00 00 00       	mov    $0x0,%eax
+  802896:	c3                   	ret
+
+0000000000802897 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802897:	55                   	push   %rbp
+  802898:	48 89 e5             	mov    %rsp,%rbp
+  80289b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80289e:	48 be 94 33 80 00 00 	movabs $0x803394,%rsi
+  8028a5:	00 00 00 
+  8028a8:	48 b8 97 0c 80 00 00 	movabs $0x800c97,%rax
+  8028af:	00 00 00 
+  8028b2:	ff d0                	call   *%rax
+    return 0;
+}
+  8028b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b9:	5d                   	pop    %rbp
+  8028ba:	c3                   	ret
+
+00000000008028bb <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8028bb:	55                   	push   %rbp
+  8028bc:	48 89 e5             	mov    %rsp,%rbp
+  8028bf:	41 57                	push   %r15
+  8028c1:	41 56                	push   %r14
+  8028c3:	41 55                	push   %r13
+  8028c5:	41 54                	push   %r12
+  8028c7:	53                   	push   %rbx
+  8028c8:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8028cf:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8028d6:	48 85 d2             	test   %rdx,%rdx
+  8028d9:	74 7a                	je     802955 <devcons_write+0x9a>
+  8028db:	49 89 d6             	mov    %rdx,%r14
+  8028de:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8028e4:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8028e9:	49 bf 91 0e 80 00 00 	movabs $0x800e91,%r15
+  8028f0:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8028f3:	4c 89 f3             	mov    %r14,%rbx
+  8028f6:	48 29 f3             	sub    %rsi,%rbx
+  8028f9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8028fe:	48 39 c3             	cmp    %rax,%rbx
+  802901:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802905:	4c 63 eb             	movslq %ebx,%r13
+  802908:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80290f:	48 01 c6             	add    %rax,%rsi
+  802912:	4c 89 ea             	mov    %r13,%rdx
+  802915:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80291c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80291f:	4c 89 ee             	mov    %r13,%rsi
+  802922:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802929:	48 b8 be 10 80 00 00 	movabs $0x8010be,%rax
+  802930:	00 00 00 
+  802933:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802935:	41 01 dc             	add    %ebx,%r12d
+  802938:	49 63 f4             	movslq %r12d,%rsi
+  80293b:	4c 39 f6             	cmp    %r14,%rsi
+  80293e:	72 b3                	jb     8028f3 <devcons_write+0x38>
+    return res;
+  802940:	49 63 c4             	movslq %r12d,%rax
+}
+  802943:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80294a:	5b                   	pop    %rbx
+  80294b:	41 5c                	pop    %r12
+  80294d:	41 5d                	pop    %r13
+  80294f:	41 5e                	pop    %r14
+  802951:	41 5f                	pop    %r15
+  802953:	5d                   	pop    %rbp
+  802954:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802955:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80295b:	eb e3                	jmp    802940 <devcons_write+0x85>
+
+000000000080295d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80295d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802960:	ba 00 00 00 00       	mov    $0x0,%edx
+  802965:	48 85 c0             	test   %rax,%rax
+  802968:	74 55                	je     8029bf <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80296a:	55                   	push   %rbp
+  80296b:	48 89 e5             	mov    %rsp,%rbp
+  80296e:	41 55                	push   %r13
+  802970:	41 54                	push   %r12
+  802972:	53                   	push   %rbx
+  802973:	48 83 ec 08          	sub    $0x8,%rsp
+  802977:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80297a:	48 bb eb 10 80 00 00 	movabs $0x8010eb,%rbx
+  802981:	00 00 00 
+  802984:	49 bc b8 11 80 00 00 	movabs $0x8011b8,%r12
+  80298b:	00 00 00 
+  80298e:	eb 03                	jmp    802993 <devcons_read+0x36>
+  802990:	41 ff d4             	call   *%r12
+  802993:	ff d3                	call   *%rbx
+  802995:	85 c0                	test   %eax,%eax
+  802997:	74 f7                	je     802990 <devcons_read+0x33>
+    if (c < 0) return c;
+  802999:	48 63 d0             	movslq %eax,%rdx
+  80299c:	78 13                	js     8029b1 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80299e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029a3:	83 f8 04             	cmp    $0x4,%eax
+  8029a6:	74 09                	je     8029b1 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8029a8:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8029ac:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8029b1:	48 89 d0             	mov    %rdx,%rax
+  8029b4:	48 83 c4 08          	add    $0x8,%rsp
+  8029b8:	5b                   	pop    %rbx
+  8029b9:	41 5c                	pop    %r12
+  8029bb:	41 5d                	pop    %r13
+  8029bd:	5d                   	pop    %rbp
+  8029be:	c3                   	ret
+  8029bf:	48 89 d0             	mov    %rdx,%rax
+  8029c2:	c3                   	ret
+
+00000000008029c3 <cputchar>:
+cputchar(int ch) {
+  8029c3:	55                   	push   %rbp
+  8029c4:	48 89 e5             	mov    %rsp,%rbp
+  8029c7:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8029cb:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8029cf:	be 01 00 00 00       	mov    $0x1,%esi
+  8029d4:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8029d8:	48 b8 be 10 80 00 00 	movabs $0x8010be,%rax
+  8029df:	00 00 00 
+  8029e2:	ff d0                	call   *%rax
+}
+  8029e4:	c9                   	leave
+  8029e5:	c3                   	ret
+
+00000000008029e6 <getchar>:
+getchar(void) {
+  8029e6:	55                   	push   %rbp
+  8029e7:	48 89 e5             	mov    %rsp,%rbp
+  8029ea:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8029ee:	ba 01 00 00 00       	mov    $0x1,%edx
+  8029f3:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8029f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029fc:	48 b8 5a 1b 80 00 00 	movabs $0x801b5a,%rax
+  802a03:	00 00 00 
+  802a06:	ff d0                	call   *%rax
+  802a08:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802a0a:	85 c0                	test   %eax,%eax
+  802a0c:	78 06                	js     802a14 <getchar+0x2e>
+  802a0e:	74 08                	je     802a18 <getchar+0x32>
+  802a10:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802a14:	89 d0                	mov    %edx,%eax
+  802a16:	c9                   	leave
+  802a17:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802a18:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802a1d:	eb f5                	jmp    802a14 <getchar+0x2e>
+
+0000000000802a1f <iscons>:
+iscons(int fdnum) {
+  802a1f:	55                   	push   %rbp
+  802a20:	48 89 e5             	mov    %rsp,%rbp
+  802a23:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802a27:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802a2b:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  802a32:	00 00 00 
+  802a35:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a37:	85 c0                	test   %eax,%eax
+  802a39:	78 18                	js     802a53 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802a3b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a3f:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802a46:	00 00 00 
+  802a49:	8b 00                	mov    (%rax),%eax
+  802a4b:	39 02                	cmp    %eax,(%rdx)
+  802a4d:	0f 94 c0             	sete   %al
+  802a50:	0f b6 c0             	movzbl %al,%eax
+}
+  802a53:	c9                   	leave
+  802a54:	c3                   	ret
+
+0000000000802a55 <opencons>:
+opencons(void) {
+  802a55:	55                   	push   %rbp
+  802a56:	48 89 e5             	mov    %rsp,%rbp
+  802a59:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802a5d:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802a61:	48 b8 17 18 80 00 00 	movabs $0x801817,%rax
+  802a68:	00 00 00 
+  802a6b:	ff d0                	call   *%rax
+  802a6d:	85 c0                	test   %eax,%eax
+  802a6f:	78 49                	js     802aba <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802a71:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802a76:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a7b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802a7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a84:	48 b8 47 12 80 00 00 	movabs $0x801247,%rax
+  802a8b:	00 00 00 
+  802a8e:	ff d0                	call   *%rax
+  802a90:	85 c0                	test   %eax,%eax
+  802a92:	78 26                	js     802aba <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802a94:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a98:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802a9f:	00 00 
+  802aa1:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802aa3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802aa7:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802aae:	48 b8 e9 17 80 00 00 	movabs $0x8017e9,%rax
+  802ab5:	00 00 00 
+  802ab8:	ff d0                	call   *%rax
+}
+  802aba:	c9                   	leave
+  802abb:	c3                   	ret
+
+0000000000802abc <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802abc:	55                   	push   %rbp
+  802abd:	48 89 e5             	mov    %rsp,%rbp
+  802ac0:	41 54                	push   %r12
+  802ac2:	53                   	push   %rbx
+  802ac3:	48 89 fb             	mov    %rdi,%rbx
+  802ac6:	48 89 f7             	mov    %rsi,%rdi
+  802ac9:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802acc:	48 85 f6             	test   %rsi,%rsi
+  802acf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ad6:	00 00 00 
+  802ad9:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802add:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ae2:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  802ae9:	00 00 00 
+  802aec:	ff d0                	call   *%rax
+    if (res < 0) {
+  802aee:	85 c0                	test   %eax,%eax
+  802af0:	78 45                	js     802b37 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802af2:	48 85 db             	test   %rbx,%rbx
+  802af5:	74 12                	je     802b09 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802af7:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  802afe:	00 00 00 
+  802b01:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b07:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802b09:	4d 85 e4             	test   %r12,%r12
+  802b0c:	74 14                	je     802b22 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802b0e:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  802b15:	00 00 00 
+  802b18:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b1e:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802b22:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  802b29:	00 00 00 
+  802b2c:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b32:	5b                   	pop    %rbx
+  802b33:	41 5c                	pop    %r12
+  802b35:	5d                   	pop    %rbp
+  802b36:	c3                   	ret
+        if (from_env_store)
+  802b37:	48 85 db             	test   %rbx,%rbx
+  802b3a:	74 06                	je     802b42 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802b3c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802b42:	4d 85 e4             	test   %r12,%r12
+  802b45:	74 eb                	je     802b32 <ipc_recv+0x76>
+            *perm_store = 0;
+  802b47:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b4e:	00 
+  802b4f:	eb e1                	jmp    802b32 <ipc_recv+0x76>
+
+0000000000802b51 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802b51:	55                   	push   %rbp
+  802b52:	48 89 e5             	mov    %rsp,%rbp
+  802b55:	41 57                	push   %r15
+  802b57:	41 56                	push   %r14
+  802b59:	41 55                	push   %r13
+  802b5b:	41 54                	push   %r12
+  802b5d:	53                   	push   %rbx
+  802b5e:	48 83 ec 18          	sub    $0x18,%rsp
+  802b62:	41 89 fd             	mov    %edi,%r13d
+  802b65:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802b68:	48 89 d3             	mov    %rdx,%rbx
+  802b6b:	49 89 cc             	mov    %rcx,%r12
+  802b6e:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802b72:	48 85 d2             	test   %rdx,%rdx
+  802b75:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802b7c:	00 00 00 
+  802b7f:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802b83:	49 be 85 15 80 00 00 	movabs $0x801585,%r14
+  802b8a:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802b8d:	49 bf b8 11 80 00 00 	movabs $0x8011b8,%r15
+  802b94:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802b97:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802b9a:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802b9e:	4c 89 e1             	mov    %r12,%rcx
+  802ba1:	48 89 da             	mov    %rbx,%rdx
+  802ba4:	44 89 ef             	mov    %r13d,%edi
+  802ba7:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802baa:	85 c0                	test   %eax,%eax
+  802bac:	74 34                	je     802be2 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802bae:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802bb1:	75 05                	jne    802bb8 <ipc_send+0x67>
+        sys_yield();
+  802bb3:	41 ff d7             	call   *%r15
+    while (true) {
+  802bb6:	eb df                	jmp    802b97 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802bb8:	48 ba a0 33 80 00 00 	movabs $0x8033a0,%rdx
+  802bbf:	00 00 00 
+  802bc2:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802bc7:	48 bf b9 33 80 00 00 	movabs $0x8033b9,%rdi
+  802bce:	00 00 00 
+  802bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd6:	48 b9 22 02 80 00 00 	movabs $0x800222,%rcx
+  802bdd:	00 00 00 
+  802be0:	ff d1                	call   *%rcx
+    }
+}
+  802be2:	48 83 c4 18          	add    $0x18,%rsp
+  802be6:	5b                   	pop    %rbx
+  802be7:	41 5c                	pop    %r12
+  802be9:	41 5d                	pop    %r13
+  802beb:	41 5e                	pop    %r14
+  802bed:	41 5f                	pop    %r15
+  802bef:	5d                   	pop    %rbp
+  802bf0:	c3                   	ret
+
+0000000000802bf1 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802bf6:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802bfd:	00 00 00 
+  802c00:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802c07:	48 01 ca             	add    %rcx,%rdx
+  802c0a:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802c10:	39 fa                	cmp    %edi,%edx
+  802c12:	74 12                	je     802c26 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c14:	48 83 c0 01          	add    $0x1,%rax
+  802c18:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802c1e:	75 e0                	jne    802c00 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c20:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c25:	c3                   	ret
+            return envs[i].env_id;
+  802c26:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802c2d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c34:	00 00 00 
+  802c37:	48 01 d0             	add    %rdx,%rax
+  802c3a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802c40:	c3                   	ret
+  802c41:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000802c48 <__rodata_start>:
+  802c48:	4d 61                	rex.WRB (bad)
+  802c4a:	6b 69 6e 67          	imul   $0x67,0x6e(%rcx),%ebp
+  802c4e:	20 73 75             	and    %dh,0x75(%rbx)
+  802c51:	72 65                	jb     802cb8 <__rodata_start+0x70>
+  802c53:	20 62 73             	and    %ah,0x73(%rdx)
+  802c56:	73 20                	jae    802c78 <__rodata_start+0x30>
+  802c58:	77 6f                	ja     802cc9 <__rodata_start+0x81>
+  802c5a:	72 6b                	jb     802cc7 <__rodata_start+0x7f>
+  802c5c:	73 20                	jae    802c7e <__rodata_start+0x36>
+  802c5e:	72 69                	jb     802cc9 <__rodata_start+0x81>
+  802c60:	67 68 74 2e 2e 2e    	addr32 push $0x2e2e2e74
+  802c66:	0a 00                	or     (%rax),%al
+  802c68:	62                   	(bad)
+  802c69:	69 67 61 72 72 61 79 	imul   $0x79617272,0x61(%rdi),%esp
+  802c70:	5b                   	pop    %rbx
+  802c71:	25 64 5d 20 64       	and    $0x64205d64,%eax
+  802c76:	69 64 6e 27 74 20 68 	imul   $0x6f682074,0x27(%rsi,%rbp,2),%esp
+  802c7d:	6f 
+  802c7e:	6c                   	insb   (%dx),%es:(%rdi)
+  802c7f:	64 20 69 74          	and    %ch,%fs:0x74(%rcx)
+  802c83:	73 20                	jae    802ca5 <__rodata_start+0x5d>
+  802c85:	76 61                	jbe    802ce8 <__rodata_start+0xa0>
+  802c87:	6c                   	insb   (%dx),%es:(%rdi)
+  802c88:	75 65                	jne    802cef <__rodata_start+0xa7>
+  802c8a:	21 0a                	and    %ecx,(%rdx)
+  802c8c:	00 00                	add    %al,(%rax)
+  802c8e:	00 00                	add    %al,(%rax)
+  802c90:	59                   	pop    %rcx
+  802c91:	65 73 2c             	gs jae 802cc0 <__rodata_start+0x78>
+  802c94:	20 67 6f             	and    %ah,0x6f(%rdi)
+  802c97:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c98:	64 2e 20 20          	fs and %ah,%fs:(%rax)
+  802c9c:	4e 6f                	rex.WRX outsl %ds:(%rsi),(%dx)
+  802c9e:	77 20                	ja     802cc0 <__rodata_start+0x78>
+  802ca0:	64 6f                	outsl  %fs:(%rsi),(%dx)
+  802ca2:	69 6e 67 20 61 20 77 	imul   $0x77206120,0x67(%rsi),%ebp
+  802ca9:	69 6c 64 20 77 72 69 	imul   $0x74697277,0x20(%rsp,%riz,2),%ebp
+  802cb0:	74 
+  802cb1:	65 20 6f 66          	and    %ch,%gs:0x66(%rdi)
+  802cb5:	66 20 74 68 65       	data16 and %dh,0x65(%rax,%rbp,2)
+  802cba:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802cbd:	64 2e 2e 2e 0a 00    	fs cs cs or %fs:(%rax),%al
+  802cc3:	62                   	(bad)
+  802cc4:	69 67 61 72 72 61 79 	imul   $0x79617272,0x61(%rdi),%esp
+  802ccb:	5b                   	pop    %rbx
+  802ccc:	25 64 5d 20 69       	and    $0x69205d64,%eax
+  802cd1:	73 6e                	jae    802d41 <__rodata_start+0xf9>
+  802cd3:	27                   	(bad)
+  802cd4:	74 20                	je     802cf6 <__rodata_start+0xae>
+  802cd6:	63 6c 65 61          	movsxd 0x61(%rbp,%riz,2),%ebp
+  802cda:	72 65                	jb     802d41 <__rodata_start+0xf9>
+  802cdc:	64 21 0a             	and    %ecx,%fs:(%rdx)
+  802cdf:	00 75 73             	add    %dh,0x73(%rbp)
+  802ce2:	65 72 2f             	gs jb  802d14 <__rodata_start+0xcc>
+  802ce5:	74 65                	je     802d4c <__rodata_start+0x104>
+  802ce7:	73 74                	jae    802d5d <__rodata_start+0x115>
+  802ce9:	62 73                	(bad)
+  802ceb:	73 2e                	jae    802d1b <__rodata_start+0xd3>
+  802ced:	63 00                	movsxd (%rax),%eax
+  802cef:	53                   	push   %rbx
+  802cf0:	48                   	rex.W
+  802cf1:	4f 55                	rex.WRXB push %r13
+  802cf3:	4c                   	rex.WR
+  802cf4:	44 20 48 41          	and    %r9b,0x41(%rax)
+  802cf8:	56                   	push   %rsi
+  802cf9:	45 20 54 52 41       	and    %r10b,0x41(%r10,%rdx,2)
+  802cfe:	50                   	push   %rax
+  802cff:	50                   	push   %rax
+  802d00:	45                   	rex.RB
+  802d01:	44 21 21             	and    %r12d,(%rcx)
+  802d04:	21 00                	and    %eax,(%rax)
+  802d06:	3c 75                	cmp    $0x75,%al
+  802d08:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d09:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802d0d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d0e:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  802d12:	30 38                	xor    %bh,(%rax)
+  802d14:	78 5d                	js     802d73 <__rodata_start+0x12b>
+  802d16:	20 75 73             	and    %dh,0x73(%rbp)
+  802d19:	65 72 20             	gs jb  802d3c <__rodata_start+0xf4>
+  802d1c:	70 61                	jo     802d7f <__rodata_start+0x137>
+  802d1e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d1f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  802d26:	73 20                	jae    802d48 <__rodata_start+0x100>
+  802d28:	61                   	(bad)
+  802d29:	74 20                	je     802d4b <__rodata_start+0x103>
+  802d2b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  802d30:	3a 20                	cmp    (%rax),%ah
+  802d32:	00 30                	add    %dh,(%rax)
+  802d34:	31 32                	xor    %esi,(%rdx)
+  802d36:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802d3d:	41                   	rex.B
+  802d3e:	42                   	rex.X
+  802d3f:	43                   	rex.XB
+  802d40:	44                   	rex.R
+  802d41:	45                   	rex.RB
+  802d42:	46 00 30             	rex.RX add %r14b,(%rax)
+  802d45:	31 32                	xor    %esi,(%rdx)
+  802d47:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802d4e:	61                   	(bad)
+  802d4f:	62 63 64 65 66       	(bad)
+  802d54:	00 28                	add    %ch,(%rax)
+  802d56:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d57:	75 6c                	jne    802dc5 <__rodata_start+0x17d>
+  802d59:	6c                   	insb   (%dx),%es:(%rdi)
+  802d5a:	29 00                	sub    %eax,(%rax)
+  802d5c:	65 72 72             	gs jb  802dd1 <__rodata_start+0x189>
+  802d5f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d60:	72 20                	jb     802d82 <__rodata_start+0x13a>
+  802d62:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802d67:	73 70                	jae    802dd9 <__rodata_start+0x191>
+  802d69:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802d6d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802d74:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d75:	72 00                	jb     802d77 <__rodata_start+0x12f>
+  802d77:	62 61 64 20 65       	(bad)
+  802d7c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d7d:	76 69                	jbe    802de8 <__rodata_start+0x1a0>
+  802d7f:	72 6f                	jb     802df0 <__rodata_start+0x1a8>
+  802d81:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d82:	6d                   	insl   (%dx),%es:(%rdi)
+  802d83:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d85:	74 00                	je     802d87 <__rodata_start+0x13f>
+  802d87:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802d8e:	20 70 61             	and    %dh,0x61(%rax)
+  802d91:	72 61                	jb     802df4 <__rodata_start+0x1ac>
+  802d93:	6d                   	insl   (%dx),%es:(%rdi)
+  802d94:	65 74 65             	gs je  802dfc <__rodata_start+0x1b4>
+  802d97:	72 00                	jb     802d99 <__rodata_start+0x151>
+  802d99:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d9a:	75 74                	jne    802e10 <__rodata_start+0x1c8>
+  802d9c:	20 6f 66             	and    %ch,0x66(%rdi)
+  802d9f:	20 6d 65             	and    %ch,0x65(%rbp)
+  802da2:	6d                   	insl   (%dx),%es:(%rdi)
+  802da3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802da4:	72 79                	jb     802e1f <__rodata_start+0x1d7>
+  802da6:	00 6f 75             	add    %ch,0x75(%rdi)
+  802da9:	74 20                	je     802dcb <__rodata_start+0x183>
+  802dab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dac:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802db0:	76 69                	jbe    802e1b <__rodata_start+0x1d3>
+  802db2:	72 6f                	jb     802e23 <__rodata_start+0x1db>
+  802db4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802db5:	6d                   	insl   (%dx),%es:(%rdi)
+  802db6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802db8:	74 73                	je     802e2d <__rodata_start+0x1e5>
+  802dba:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802dbd:	72 72                	jb     802e31 <__rodata_start+0x1e9>
+  802dbf:	75 70                	jne    802e31 <__rodata_start+0x1e9>
+  802dc1:	74 65                	je     802e28 <__rodata_start+0x1e0>
+  802dc3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802dc8:	75 67                	jne    802e31 <__rodata_start+0x1e9>
+  802dca:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802dcd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802dcf:	00 73 65             	add    %dh,0x65(%rbx)
+  802dd2:	67 6d                	insl   (%dx),%es:(%edi)
+  802dd4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802dd6:	74 61                	je     802e39 <__rodata_start+0x1f1>
+  802dd8:	74 69                	je     802e43 <__rodata_start+0x1fb>
+  802dda:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ddb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ddc:	20 66 61             	and    %ah,0x61(%rsi)
+  802ddf:	75 6c                	jne    802e4d <__rodata_start+0x205>
+  802de1:	74 00                	je     802de3 <__rodata_start+0x19b>
+  802de3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802dea:	20 45 4c             	and    %al,0x4c(%rbp)
+  802ded:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802df1:	61                   	(bad)
+  802df2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802df7:	20 73 75             	and    %dh,0x75(%rbx)
+  802dfa:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802dfd:	73 79                	jae    802e78 <__rodata_start+0x230>
+  802dff:	73 74                	jae    802e75 <__rodata_start+0x22d>
+  802e01:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802e03:	20 63 61             	and    %ah,0x61(%rbx)
+  802e06:	6c                   	insb   (%dx),%es:(%rdi)
+  802e07:	6c                   	insb   (%dx),%es:(%rdi)
+  802e08:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802e0b:	74 72                	je     802e7f <__rodata_start+0x237>
+  802e0d:	79 20                	jns    802e2f <__rodata_start+0x1e7>
+  802e0f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e10:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e11:	74 20                	je     802e33 <__rodata_start+0x1eb>
+  802e13:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e15:	75 6e                	jne    802e85 <__rodata_start+0x23d>
+  802e17:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802e1b:	76 20                	jbe    802e3d <__rodata_start+0x1f5>
+  802e1d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802e24:	72 65                	jb     802e8b <__rodata_start+0x243>
+  802e26:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802e29:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e2a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802e2e:	65 78 70             	gs js  802ea1 <__rodata_start+0x259>
+  802e31:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802e36:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802e39:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802e3d:	20 66 69             	and    %ah,0x69(%rsi)
+  802e40:	6c                   	insb   (%dx),%es:(%rdi)
+  802e41:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802e45:	20 66 72             	and    %ah,0x72(%rsi)
+  802e48:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802e4d:	61                   	(bad)
+  802e4e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802e51:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e52:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e53:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802e57:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802e5a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e5b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e5c:	20 6d 61             	and    %ch,0x61(%rbp)
+  802e5f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e60:	79 20                	jns    802e82 <__rodata_start+0x23a>
+  802e62:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802e69:	72 65                	jb     802ed0 <__rodata_start+0x288>
+  802e6b:	20 6f 70             	and    %ch,0x70(%rdi)
+  802e6e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e70:	00 66 69             	add    %ah,0x69(%rsi)
+  802e73:	6c                   	insb   (%dx),%es:(%rdi)
+  802e74:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802e78:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802e7b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e7c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802e7f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e80:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e81:	74 20                	je     802ea3 <__rodata_start+0x25b>
+  802e83:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e85:	75 6e                	jne    802ef5 <__rodata_start+0x2ad>
+  802e87:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802e8b:	76 61                	jbe    802eee <__rodata_start+0x2a6>
+  802e8d:	6c                   	insb   (%dx),%es:(%rdi)
+  802e8e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802e95:	00 
+  802e96:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802e9d:	72 65                	jb     802f04 <__rodata_start+0x2bc>
+  802e9f:	61                   	(bad)
+  802ea0:	64 79 20             	fs jns 802ec3 <__rodata_start+0x27b>
+  802ea3:	65 78 69             	gs js  802f0f <__rodata_start+0x2c7>
+  802ea6:	73 74                	jae    802f1c <__rodata_start+0x2d4>
+  802ea8:	73 00                	jae    802eaa <__rodata_start+0x262>
+  802eaa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eab:	70 65                	jo     802f12 <__rodata_start+0x2ca>
+  802ead:	72 61                	jb     802f10 <__rodata_start+0x2c8>
+  802eaf:	74 69                	je     802f1a <__rodata_start+0x2d2>
+  802eb1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eb2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802eb3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802eb6:	74 20                	je     802ed8 <__rodata_start+0x290>
+  802eb8:	73 75                	jae    802f2f <__rodata_start+0x2e7>
+  802eba:	70 70                	jo     802f2c <__rodata_start+0x2e4>
+  802ebc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ebd:	72 74                	jb     802f33 <__rodata_start+0x2eb>
+  802ebf:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802ec4:	65 72 61             	gs jb  802f28 <__rodata_start+0x2e0>
+  802ec7:	74 69                	je     802f32 <__rodata_start+0x2ea>
+  802ec9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eca:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ecb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802ece:	74 20                	je     802ef0 <__rodata_start+0x2a8>
+  802ed0:	70 65                	jo     802f37 <__rodata_start+0x2ef>
+  802ed2:	72 6d                	jb     802f41 <__rodata_start+0x2f9>
+  802ed4:	69 74 74 65 64 00 66 	imul   $0xf660064,0x65(%rsp,%rsi,2),%esi
+  802edb:	0f 
+  802edc:	1f                   	(bad)
+  802edd:	44 00 00             	add    %r8b,(%rax)
+  802ee0:	5f                   	pop    %rdi
+  802ee1:	05 80 00 00 00       	add    $0x80,%eax
+  802ee6:	00 00                	add    %al,(%rax)
+  802ee8:	a0 0b 80 00 00 00 00 	movabs 0x900000000000800b,%al
+  802eef:	00 90 
+  802ef1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  802ef7:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802efd:	00 00                	add    %al,(%rax)
+  802eff:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802f05:	00 00                	add    %al,(%rax)
+  802f07:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802f0d:	00 00                	add    %al,(%rax)
+  802f0f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802f15:	00 00                	add    %al,(%rax)
+  802f17:	00 7e 05             	add    %bh,0x5(%rsi)
+  802f1a:	80 00 00             	addb   $0x0,(%rax)
+  802f1d:	00 00                	add    %al,(%rax)
+  802f1f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802f25:	00 00                	add    %al,(%rax)
+  802f27:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802f2d:	00 00                	add    %al,(%rax)
+  802f2f:	00 72 05             	add    %dh,0x5(%rdx)
+  802f32:	80 00 00             	addb   $0x0,(%rax)
+  802f35:	00 00                	add    %al,(%rax)
+  802f37:	00 ec                	add    %ch,%ah
+  802f39:	05 80 00 00 00       	add    $0x80,%eax
+  802f3e:	00 00                	add    %al,(%rax)
+  802f40:	a0 0b 80 00 00 00 00 	movabs 0x720000000000800b,%al
+  802f47:	00 72 
+  802f49:	05 80 00 00 00       	add    $0x80,%eax
+  802f4e:	00 00                	add    %al,(%rax)
+  802f50:	b8 05 80 00 00       	mov    $0x8005,%eax
+  802f55:	00 00                	add    %al,(%rax)
+  802f57:	00 b8 05 80 00 00    	add    %bh,0x8005(%rax)
+  802f5d:	00 00                	add    %al,(%rax)
+  802f5f:	00 b8 05 80 00 00    	add    %bh,0x8005(%rax)
+  802f65:	00 00                	add    %al,(%rax)
+  802f67:	00 b8 05 80 00 00    	add    %bh,0x8005(%rax)
+  802f6d:	00 00                	add    %al,(%rax)
+  802f6f:	00 b8 05 80 00 00    	add    %bh,0x8005(%rax)
+  802f75:	00 00                	add    %al,(%rax)
+  802f77:	00 b8 05 80 00 00    	add    %bh,0x8005(%rax)
+  802f7d:	00 00                	add    %al,(%rax)
+  802f7f:	00 b8 05 80 00 00    	add    %bh,0x8005(%rax)
+  802f85:	00 00                	add    %al,(%rax)
+  802f87:	00 b8 05 80 00 00    	add    %bh,0x8005(%rax)
+  802f8d:	00 00                	add    %al,(%rax)
+  802f8f:	00 b8 05 80 00 00    	add    %bh,0x8005(%rax)
+  802f95:	00 00                	add    %al,(%rax)
+  802f97:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802f9d:	00 00                	add    %al,(%rax)
+  802f9f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802fa5:	00 00                	add    %al,(%rax)
+  802fa7:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802fad:	00 00                	add    %al,(%rax)
+  802faf:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802fb5:	00 00                	add    %al,(%rax)
+  802fb7:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802fbd:	00 00                	add    %al,(%rax)
+  802fbf:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802fc5:	00 00                	add    %al,(%rax)
+  802fc7:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802fcd:	00 00                	add    %al,(%rax)
+  802fcf:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802fd5:	00 00                	add    %al,(%rax)
+  802fd7:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802fdd:	00 00                	add    %al,(%rax)
+  802fdf:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802fe5:	00 00                	add    %al,(%rax)
+  802fe7:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802fed:	00 00                	add    %al,(%rax)
+  802fef:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802ff5:	00 00                	add    %al,(%rax)
+  802ff7:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  802ffd:	00 00                	add    %al,(%rax)
+  802fff:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  803005:	00 00                	add    %al,(%rax)
+  803007:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  80300d:	00 00                	add    %al,(%rax)
+  80300f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  803015:	00 00                	add    %al,(%rax)
+  803017:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  80301d:	00 00                	add    %al,(%rax)
+  80301f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  803025:	00 00                	add    %al,(%rax)
+  803027:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  80302d:	00 00                	add    %al,(%rax)
+  80302f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  803035:	00 00                	add    %al,(%rax)
+  803037:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  80303d:	00 00                	add    %al,(%rax)
+  80303f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  803045:	00 00                	add    %al,(%rax)
+  803047:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  80304d:	00 00                	add    %al,(%rax)
+  80304f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  803055:	00 00                	add    %al,(%rax)
+  803057:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  80305d:	00 00                	add    %al,(%rax)
+  80305f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  803065:	00 00                	add    %al,(%rax)
+  803067:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  80306d:	00 00                	add    %al,(%rax)
+  80306f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  803075:	00 00                	add    %al,(%rax)
+  803077:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  80307d:	00 00                	add    %al,(%rax)
+  80307f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  803085:	00 00                	add    %al,(%rax)
+  803087:	00 c3                	add    %al,%bl
+  803089:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80308f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  803095:	00 00                	add    %al,(%rax)
+  803097:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  80309d:	00 00                	add    %al,(%rax)
+  80309f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  8030a5:	00 00                	add    %al,(%rax)
+  8030a7:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  8030ad:	00 00                	add    %al,(%rax)
+  8030af:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  8030b5:	00 00                	add    %al,(%rax)
+  8030b7:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  8030bd:	00 00                	add    %al,(%rax)
+  8030bf:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  8030c5:	00 00                	add    %al,(%rax)
+  8030c7:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  8030cd:	00 00                	add    %al,(%rax)
+  8030cf:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  8030dd:	00 00                	add    %al,(%rax)
+  8030df:	00 0f                	add    %cl,(%rdi)
+  8030e1:	06                   	(bad)
+  8030e2:	80 00 00             	addb   $0x0,(%rax)
+  8030e5:	00 00                	add    %al,(%rax)
+  8030e7:	00 de                	add    %bl,%dh
+  8030e9:	07                   	(bad)
+  8030ea:	80 00 00             	addb   $0x0,(%rax)
+  8030ed:	00 00                	add    %al,(%rax)
+  8030ef:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  8030f5:	00 00                	add    %al,(%rax)
+  8030f7:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  8030fd:	00 00                	add    %al,(%rax)
+  8030ff:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  803105:	00 00                	add    %al,(%rax)
+  803107:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  80310d:	00 00                	add    %al,(%rax)
+  80310f:	00 3e                	add    %bh,(%rsi)
+  803111:	06                   	(bad)
+  803112:	80 00 00             	addb   $0x0,(%rax)
+  803115:	00 00                	add    %al,(%rax)
+  803117:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  80311d:	00 00                	add    %al,(%rax)
+  80311f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  803125:	00 00                	add    %al,(%rax)
+  803127:	00 04 06             	add    %al,(%rsi,%rax,1)
+  80312a:	80 00 00             	addb   $0x0,(%rax)
+  80312d:	00 00                	add    %al,(%rax)
+  80312f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  80313d:	00 00                	add    %al,(%rax)
+  80313f:	00 86 09 80 00 00    	add    %al,0x8009(%rsi)
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 50 0a             	add    %dl,0xa(%rax)
+  80314a:	80 00 00             	addb   $0x0,(%rax)
+  80314d:	00 00                	add    %al,(%rax)
+  80314f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  803155:	00 00                	add    %al,(%rax)
+  803157:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  80315d:	00 00                	add    %al,(%rax)
+  80315f:	00 d5                	add    %dl,%ch
+  803161:	06                   	(bad)
+  803162:	80 00 00             	addb   $0x0,(%rax)
+  803165:	00 00                	add    %al,(%rax)
+  803167:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 b2 08 80 00 00    	add    %dh,0x8008(%rdx)
+  803175:	00 00                	add    %al,(%rax)
+  803177:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  80317d:	00 00                	add    %al,(%rax)
+  80317f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  803185:	00 00                	add    %al,(%rax)
+  803187:	00 c3                	add    %al,%bl
+  803189:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80318f:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  803195:	00 00                	add    %al,(%rax)
+  803197:	00 68 05             	add    %ch,0x5(%rax)
+  80319a:	80 00 00             	addb   $0x0,(%rax)
+  80319d:	00 00                	add    %al,(%rax)
+	...
+
+00000000008031a0 <error_string>:
+	...
+  8031a8:	65 2d 80 00 00 00 00 00 77 2d 80 00 00 00 00 00     e-......w-......
+  8031b8:	87 2d 80 00 00 00 00 00 99 2d 80 00 00 00 00 00     .-.......-......
+  8031c8:	a7 2d 80 00 00 00 00 00 bb 2d 80 00 00 00 00 00     .-.......-......
+  8031d8:	d0 2d 80 00 00 00 00 00 e3 2d 80 00 00 00 00 00     .-.......-......
+  8031e8:	f5 2d 80 00 00 00 00 00 09 2e 80 00 00 00 00 00     .-..............
+  8031f8:	19 2e 80 00 00 00 00 00 2c 2e 80 00 00 00 00 00     ........,.......
+  803208:	43 2e 80 00 00 00 00 00 59 2e 80 00 00 00 00 00     C.......Y.......
+  803218:	71 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     q...............
+  803228:	96 2e 80 00 00 00 00 00 50 32 80 00 00 00 00 00     ........P2......
+  803238:	aa 2e 80 00 00 00 00 00 00 00 00 00 00 00 00 00     ................
+  803248:	c2 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ........file is 
+  803258:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803268:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803278:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803288:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803298:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  8032a8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8032b8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8032c8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8032d8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8032e8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8032f8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803308:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803318:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803320 <devtab>:
+  803320:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803330:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803340:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803350:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803360:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803370:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803380:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803390:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8033a0:	69 70 63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64     ipc_send: failed
+  8033b0:	20 74 6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63      to send.lib/ipc
+  8033c0:	2e 63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     .c.f.........f..
+  8033d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803400:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803410:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803420:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803430:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803440:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803450:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803460:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803470:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803480:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803490:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803500:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803510:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803520:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803530:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803540:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803550:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803560:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803570:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803580:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803590:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803600:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803610:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803620:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803630:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803640:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803650:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803660:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803670:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803680:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803690:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803700:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803710:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803720:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803730:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803740:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803750:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803760:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803770:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803780:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803790:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803800:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803810:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803820:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803830:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803840:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803850:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803860:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803870:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803880:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803890:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803900:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803910:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803920:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803930:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803940:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803950:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803960:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803970:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803980:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803990:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803aa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ab0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ac0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ad0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ae0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803af0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ba0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803be0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ca0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ce0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803da0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
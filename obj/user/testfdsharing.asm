@@ -0,0 +1,6094 @@
+
+obj/user/testfdsharing:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 cf 02 00 00       	call   8002f2 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+    int fd, r, n, n2;
+
+    if ((fd = open("motd", O_RDONLY)) < 0)
+  800030:	be 00 00 00 00       	mov    $0x0,%esi
+  800035:	48 bf 90 2f 80 00 00 	movabs $0x802f90,%rdi
+  80003c:	00 00 00 
+  80003f:	48 b8 b2 23 80 00 00 	movabs $0x8023b2,%rax
+  800046:	00 00 00 
+  800049:	ff d0                	call   *%rax
+  80004b:	89 c3                	mov    %eax,%ebx
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	0f 88 8a 01 00 00    	js     8001df <umain+0x1ba>
+        panic("open motd: %i", fd);
+    seek(fd, 0);
+  800055:	be 00 00 00 00       	mov    $0x0,%esi
+  80005a:	89 c7                	mov    %eax,%edi
+  80005c:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  800063:	00 00 00 
+  800066:	ff d0                	call   *%rax
+    if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  800068:	ba 00 02 00 00       	mov    $0x200,%edx
+  80006d:	48 be 00 52 80 00 00 	movabs $0x805200,%rsi
+  800074:	00 00 00 
+  800077:	89 df                	mov    %ebx,%edi
+  800079:	48 b8 b2 1e 80 00 00 	movabs $0x801eb2,%rax
+  800080:	00 00 00 
+  800083:	ff d0                	call   *%rax
+  800085:	49 89 c4             	mov    %rax,%r12
+  800088:	41 89 c6             	mov    %eax,%r14d
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	0f 8e 79 01 00 00    	jle    80020c <umain+0x1e7>
+        panic("readn: %i", n);
+
+    if ((r = fork()) < 0)
+  800093:	48 b8 83 19 80 00 00 	movabs $0x801983,%rax
+  80009a:	00 00 00 
+  80009d:	ff d0                	call   *%rax
+  80009f:	41 89 c5             	mov    %eax,%r13d
+  8000a2:	85 c0                	test   %eax,%eax
+  8000a4:	0f 88 8f 01 00 00    	js     800239 <umain+0x214>
+        panic("fork: %i", r);
+    if (r == 0) {
+  8000aa:	0f 85 c7 00 00 00    	jne    800177 <umain+0x152>
+        seek(fd, 0);
+  8000b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8000b5:	89 df                	mov    %ebx,%edi
+  8000b7:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  8000be:	00 00 00 
+  8000c1:	ff d0                	call   *%rax
+        cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  8000c3:	48 bf 00 30 80 00 00 	movabs $0x803000,%rdi
+  8000ca:	00 00 00 
+  8000cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d2:	48 ba 0c 05 80 00 00 	movabs $0x80050c,%rdx
+  8000d9:	00 00 00 
+  8000dc:	ff d2                	call   *%rdx
+        if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8000de:	ba 00 02 00 00       	mov    $0x200,%edx
+  8000e3:	48 be 00 50 80 00 00 	movabs $0x805000,%rsi
+  8000ea:	00 00 00 
+  8000ed:	89 df                	mov    %ebx,%edi
+  8000ef:	48 b8 b2 1e 80 00 00 	movabs $0x801eb2,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+  8000fb:	41 39 c4             	cmp    %eax,%r12d
+  8000fe:	0f 85 62 01 00 00    	jne    800266 <umain+0x241>
+            panic("read in parent got %d, read in child got %d", n, n2);
+        if (memcmp(buf, buf2, n) != 0)
+  800104:	49 63 d4             	movslq %r12d,%rdx
+  800107:	48 be 00 50 80 00 00 	movabs $0x805000,%rsi
+  80010e:	00 00 00 
+  800111:	48 bf 00 52 80 00 00 	movabs $0x805200,%rdi
+  800118:	00 00 00 
+  80011b:	48 b8 4a 11 80 00 00 	movabs $0x80114a,%rax
+  800122:	00 00 00 
+  800125:	ff d0                	call   *%rax
+  800127:	85 c0                	test   %eax,%eax
+  800129:	0f 85 68 01 00 00    	jne    800297 <umain+0x272>
+            panic("read in parent got different bytes from read in child");
+        cprintf("read in child succeeded\n");
+  80012f:	48 bf cb 2f 80 00 00 	movabs $0x802fcb,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	48 ba 0c 05 80 00 00 	movabs $0x80050c,%rdx
+  800145:	00 00 00 
+  800148:	ff d2                	call   *%rdx
+        seek(fd, 0);
+  80014a:	be 00 00 00 00       	mov    $0x0,%esi
+  80014f:	89 df                	mov    %ebx,%edi
+  800151:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  800158:	00 00 00 
+  80015b:	ff d0                	call   *%rax
+        close(fd);
+  80015d:	89 df                	mov    %ebx,%edi
+  80015f:	48 b8 76 1c 80 00 00 	movabs $0x801c76,%rax
+  800166:	00 00 00 
+  800169:	ff d0                	call   *%rax
+        exit();
+  80016b:	48 b8 99 03 80 00 00 	movabs $0x800399,%rax
+  800172:	00 00 00 
+  800175:	ff d0                	call   *%rax
+    }
+    wait(r);
+  800177:	44 89 ef             	mov    %r13d,%edi
+  80017a:	48 b8 7b 29 80 00 00 	movabs $0x80297b,%rax
+  800181:	00 00 00 
+  800184:	ff d0                	call   *%rax
+    if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  800186:	ba 00 02 00 00       	mov    $0x200,%edx
+  80018b:	48 be 00 50 80 00 00 	movabs $0x805000,%rsi
+  800192:	00 00 00 
+  800195:	89 df                	mov    %ebx,%edi
+  800197:	48 b8 b2 1e 80 00 00 	movabs $0x801eb2,%rax
+  80019e:	00 00 00 
+  8001a1:	ff d0                	call   *%rax
+  8001a3:	41 39 c4             	cmp    %eax,%r12d
+  8001a6:	0f 85 15 01 00 00    	jne    8002c1 <umain+0x29c>
+        panic("read in parent got %d, then got %d", n, n2);
+    cprintf("read in parent succeeded\n");
+  8001ac:	48 bf e4 2f 80 00 00 	movabs $0x802fe4,%rdi
+  8001b3:	00 00 00 
+  8001b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bb:	48 ba 0c 05 80 00 00 	movabs $0x80050c,%rdx
+  8001c2:	00 00 00 
+  8001c5:	ff d2                	call   *%rdx
+    close(fd);
+  8001c7:	89 df                	mov    %ebx,%edi
+  8001c9:	48 b8 76 1c 80 00 00 	movabs $0x801c76,%rax
+  8001d0:	00 00 00 
+  8001d3:	ff d0                	call   *%rax
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8001d5:	cc                   	int3
+
+    breakpoint();
+}
+  8001d6:	5b                   	pop    %rbx
+  8001d7:	41 5c                	pop    %r12
+  8001d9:	41 5d                	pop    %r13
+  8001db:	41 5e                	pop    %r14
+  8001dd:	5d                   	pop    %rbp
+  8001de:	c3                   	ret
+        panic("open motd: %i", fd);
+  8001df:	89 c1                	mov    %eax,%ecx
+  8001e1:	48 ba 95 2f 80 00 00 	movabs $0x802f95,%rdx
+  8001e8:	00 00 00 
+  8001eb:	be 0b 00 00 00       	mov    $0xb,%esi
+  8001f0:	48 bf a3 2f 80 00 00 	movabs $0x802fa3,%rdi
+  8001f7:	00 00 00 
+  8001fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ff:	49 b8 bc 03 80 00 00 	movabs $0x8003bc,%r8
+  800206:	00 00 00 
+  800209:	41 ff d0             	call   *%r8
+        panic("readn: %i", n);
+  80020c:	89 c1                	mov    %eax,%ecx
+  80020e:	48 ba b8 2f 80 00 00 	movabs $0x802fb8,%rdx
+  800215:	00 00 00 
+  800218:	be 0e 00 00 00       	mov    $0xe,%esi
+  80021d:	48 bf a3 2f 80 00 00 	movabs $0x802fa3,%rdi
+  800224:	00 00 00 
+  800227:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022c:	49 b8 bc 03 80 00 00 	movabs $0x8003bc,%r8
+  800233:	00 00 00 
+  800236:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800239:	89 c1                	mov    %eax,%ecx
+  80023b:	48 ba c2 2f 80 00 00 	movabs $0x802fc2,%rdx
+  800242:	00 00 00 
+  800245:	be 11 00 00 00       	mov    $0x11,%esi
+  80024a:	48 bf a3 2f 80 00 00 	movabs $0x802fa3,%rdi
+  800251:	00 00 00 
+  800254:	b8 00 00 00 00       	mov    $0x0,%eax
+  800259:	49 b8 bc 03 80 00 00 	movabs $0x8003bc,%r8
+  800260:	00 00 00 
+  800263:	41 ff d0             	call   *%r8
+            panic("read in parent got %d, read in child got %d", n, n2);
+  800266:	41 89 c0             	mov    %eax,%r8d
+  800269:	44 89 e1             	mov    %r12d,%ecx
+  80026c:	48 ba 48 30 80 00 00 	movabs $0x803048,%rdx
+  800273:	00 00 00 
+  800276:	be 16 00 00 00       	mov    $0x16,%esi
+  80027b:	48 bf a3 2f 80 00 00 	movabs $0x802fa3,%rdi
+  800282:	00 00 00 
+  800285:	b8 00 00 00 00       	mov    $0x0,%eax
+  80028a:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  800291:	00 00 00 
+  800294:	41 ff d1             	call   *%r9
+            panic("read in parent got different bytes from read in child");
+  800297:	48 ba 78 30 80 00 00 	movabs $0x803078,%rdx
+  80029e:	00 00 00 
+  8002a1:	be 18 00 00 00       	mov    $0x18,%esi
+  8002a6:	48 bf a3 2f 80 00 00 	movabs $0x802fa3,%rdi
+  8002ad:	00 00 00 
+  8002b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b5:	48 b9 bc 03 80 00 00 	movabs $0x8003bc,%rcx
+  8002bc:	00 00 00 
+  8002bf:	ff d1                	call   *%rcx
+        panic("read in parent got %d, then got %d", n, n2);
+  8002c1:	41 89 c0             	mov    %eax,%r8d
+  8002c4:	44 89 f1             	mov    %r14d,%ecx
+  8002c7:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  8002ce:	00 00 00 
+  8002d1:	be 20 00 00 00       	mov    $0x20,%esi
+  8002d6:	48 bf a3 2f 80 00 00 	movabs $0x802fa3,%rdi
+  8002dd:	00 00 00 
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  8002ec:	00 00 00 
+  8002ef:	41 ff d1             	call   *%r9
+
+00000000008002f2 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002f2:	55                   	push   %rbp
+  8002f3:	48 89 e5             	mov    %rsp,%rbp
+  8002f6:	41 56                	push   %r14
+  8002f8:	41 55                	push   %r13
+  8002fa:	41 54                	push   %r12
+  8002fc:	53                   	push   %rbx
+  8002fd:	41 89 fd             	mov    %edi,%r13d
+  800300:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800303:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80030a:	00 00 00 
+  80030d:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800314:	00 00 00 
+  800317:	48 39 c2             	cmp    %rax,%rdx
+  80031a:	73 17                	jae    800333 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80031c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80031f:	49 89 c4             	mov    %rax,%r12
+  800322:	48 83 c3 08          	add    $0x8,%rbx
+  800326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032b:	ff 53 f8             	call   *-0x8(%rbx)
+  80032e:	4c 39 e3             	cmp    %r12,%rbx
+  800331:	72 ef                	jb     800322 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800333:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  80033a:	00 00 00 
+  80033d:	ff d0                	call   *%rax
+  80033f:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800342:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800349:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800350:	00 00 00 
+  800353:	48 01 d0             	add    %rdx,%rax
+  800356:	48 a3 00 54 80 00 00 	movabs %rax,0x805400
+  80035d:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800360:	45 85 ed             	test   %r13d,%r13d
+  800363:	7e 0d                	jle    800372 <libmain+0x80>
+  800365:	49 8b 06             	mov    (%r14),%rax
+  800368:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80036f:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800372:	4c 89 f6             	mov    %r14,%rsi
+  800375:	44 89 ef             	mov    %r13d,%edi
+  800378:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80037f:	00 00 00 
+  800382:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800384:	48 b8 99 03 80 00 00 	movabs $0x800399,%rax
+  80038b:	00 00 00 
+  80038e:	ff d0                	call   *%rax
+#endif
+}
+  800390:	5b                   	pop    %rbx
+  800391:	41 5c                	pop    %r12
+  800393:	41 5d                	pop    %r13
+  800395:	41 5e                	pop    %r14
+  800397:	5d                   	pop    %rbp
+  800398:	c3                   	ret
+
+0000000000800399 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800399:	55                   	push   %rbp
+  80039a:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80039d:	48 b8 a9 1c 80 00 00 	movabs $0x801ca9,%rax
+  8003a4:	00 00 00 
+  8003a7:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8003a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003ae:	48 b8 b6 12 80 00 00 	movabs $0x8012b6,%rax
+  8003b5:	00 00 00 
+  8003b8:	ff d0                	call   *%rax
+}
+  8003ba:	5d                   	pop    %rbp
+  8003bb:	c3                   	ret
+
+00000000008003bc <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003bc:	55                   	push   %rbp
+  8003bd:	48 89 e5             	mov    %rsp,%rbp
+  8003c0:	41 56                	push   %r14
+  8003c2:	41 55                	push   %r13
+  8003c4:	41 54                	push   %r12
+  8003c6:	53                   	push   %rbx
+  8003c7:	48 83 ec 50          	sub    $0x50,%rsp
+  8003cb:	49 89 fc             	mov    %rdi,%r12
+  8003ce:	41 89 f5             	mov    %esi,%r13d
+  8003d1:	48 89 d3             	mov    %rdx,%rbx
+  8003d4:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003d8:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003dc:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8003e0:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8003e7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003eb:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8003ef:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8003f3:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003f7:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8003fe:	00 00 00 
+  800401:	4c 8b 30             	mov    (%rax),%r14
+  800404:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  80040b:	00 00 00 
+  80040e:	ff d0                	call   *%rax
+  800410:	89 c6                	mov    %eax,%esi
+  800412:	45 89 e8             	mov    %r13d,%r8d
+  800415:	4c 89 e1             	mov    %r12,%rcx
+  800418:	4c 89 f2             	mov    %r14,%rdx
+  80041b:	48 bf e0 30 80 00 00 	movabs $0x8030e0,%rdi
+  800422:	00 00 00 
+  800425:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042a:	49 bc 0c 05 80 00 00 	movabs $0x80050c,%r12
+  800431:	00 00 00 
+  800434:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800437:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80043b:	48 89 df             	mov    %rbx,%rdi
+  80043e:	48 b8 a8 04 80 00 00 	movabs $0x8004a8,%rax
+  800445:	00 00 00 
+  800448:	ff d0                	call   *%rax
+    cprintf("\n");
+  80044a:	48 bf e2 2f 80 00 00 	movabs $0x802fe2,%rdi
+  800451:	00 00 00 
+  800454:	b8 00 00 00 00       	mov    $0x0,%eax
+  800459:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80045c:	cc                   	int3
+  80045d:	eb fd                	jmp    80045c <_panic+0xa0>
+
+000000000080045f <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80045f:	55                   	push   %rbp
+  800460:	48 89 e5             	mov    %rsp,%rbp
+  800463:	53                   	push   %rbx
+  800464:	48 83 ec 08          	sub    $0x8,%rsp
+  800468:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80046b:	8b 06                	mov    (%rsi),%eax
+  80046d:	8d 50 01             	lea    0x1(%rax),%edx
+  800470:	89 16                	mov    %edx,(%rsi)
+  800472:	48 98                	cltq
+  800474:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800479:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80047f:	74 0a                	je     80048b <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800481:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800485:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800489:	c9                   	leave
+  80048a:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80048b:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80048f:	be ff 00 00 00       	mov    $0xff,%esi
+  800494:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  80049b:	00 00 00 
+  80049e:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004a0:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004a6:	eb d9                	jmp    800481 <putch+0x22>
+
+00000000008004a8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004a8:	55                   	push   %rbp
+  8004a9:	48 89 e5             	mov    %rsp,%rbp
+  8004ac:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004b3:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004b6:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004bd:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004ca:	48 89 f1             	mov    %rsi,%rcx
+  8004cd:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004d4:	48 bf 5f 04 80 00 00 	movabs $0x80045f,%rdi
+  8004db:	00 00 00 
+  8004de:	48 b8 5c 06 80 00 00 	movabs $0x80065c,%rax
+  8004e5:	00 00 00 
+  8004e8:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004ea:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004f1:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004f8:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  8004ff:	00 00 00 
+  800502:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800504:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80050a:	c9                   	leave
+  80050b:	c3                   	ret
+
+000000000080050c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80050c:	55                   	push   %rbp
+  80050d:	48 89 e5             	mov    %rsp,%rbp
+  800510:	48 83 ec 50          	sub    $0x50,%rsp
+  800514:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800518:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80051c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800520:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800524:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800528:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80052f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800533:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800537:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80053b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80053f:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800543:	48 b8 a8 04 80 00 00 	movabs $0x8004a8,%rax
+  80054a:	00 00 00 
+  80054d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80054f:	c9                   	leave
+  800550:	c3                   	ret
+
+0000000000800551 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800551:	55                   	push   %rbp
+  800552:	48 89 e5             	mov    %rsp,%rbp
+  800555:	41 57                	push   %r15
+  800557:	41 56                	push   %r14
+  800559:	41 55                	push   %r13
+  80055b:	41 54                	push   %r12
+  80055d:	53                   	push   %rbx
+  80055e:	48 83 ec 18          	sub    $0x18,%rsp
+  800562:	49 89 fc             	mov    %rdi,%r12
+  800565:	49 89 f5             	mov    %rsi,%r13
+  800568:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80056c:	8b 45 10             	mov    0x10(%rbp),%eax
+  80056f:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800572:	41 89 cf             	mov    %ecx,%r15d
+  800575:	4c 39 fa             	cmp    %r15,%rdx
+  800578:	73 5b                	jae    8005d5 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80057a:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80057e:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800582:	85 db                	test   %ebx,%ebx
+  800584:	7e 0e                	jle    800594 <print_num+0x43>
+            putch(padc, put_arg);
+  800586:	4c 89 ee             	mov    %r13,%rsi
+  800589:	44 89 f7             	mov    %r14d,%edi
+  80058c:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80058f:	83 eb 01             	sub    $0x1,%ebx
+  800592:	75 f2                	jne    800586 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800594:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800598:	48 b9 14 31 80 00 00 	movabs $0x803114,%rcx
+  80059f:	00 00 00 
+  8005a2:	48 b8 03 31 80 00 00 	movabs $0x803103,%rax
+  8005a9:	00 00 00 
+  8005ac:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b9:	49 f7 f7             	div    %r15
+  8005bc:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005c0:	4c 89 ee             	mov    %r13,%rsi
+  8005c3:	41 ff d4             	call   *%r12
+}
+  8005c6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005ca:	5b                   	pop    %rbx
+  8005cb:	41 5c                	pop    %r12
+  8005cd:	41 5d                	pop    %r13
+  8005cf:	41 5e                	pop    %r14
+  8005d1:	41 5f                	pop    %r15
+  8005d3:	5d                   	pop    %rbp
+  8005d4:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005de:	49 f7 f7             	div    %r15
+  8005e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8005e5:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005e9:	52                   	push   %rdx
+  8005ea:	45 0f be c9          	movsbl %r9b,%r9d
+  8005ee:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005f2:	48 89 c2             	mov    %rax,%rdx
+  8005f5:	48 b8 51 05 80 00 00 	movabs $0x800551,%rax
+  8005fc:	00 00 00 
+  8005ff:	ff d0                	call   *%rax
+  800601:	48 83 c4 10          	add    $0x10,%rsp
+  800605:	eb 8d                	jmp    800594 <print_num+0x43>
+
+0000000000800607 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800607:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80060b:	48 8b 06             	mov    (%rsi),%rax
+  80060e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800612:	73 0a                	jae    80061e <sprintputch+0x17>
+        *state->start++ = ch;
+  800614:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800618:	48 89 16             	mov    %rdx,(%rsi)
+  80061b:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80061e:	c3                   	ret
+
+000000000080061f <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80061f:	55                   	push   %rbp
+  800620:	48 89 e5             	mov    %rsp,%rbp
+  800623:	48 83 ec 50          	sub    $0x50,%rsp
+  800627:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80062b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80062f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800633:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80063a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80063e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800642:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800646:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80064a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80064e:	48 b8 5c 06 80 00 00 	movabs $0x80065c,%rax
+  800655:	00 00 00 
+  800658:	ff d0                	call   *%rax
+}
+  80065a:	c9                   	leave
+  80065b:	c3                   	ret
+
+000000000080065c <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80065c:	55                   	push   %rbp
+  80065d:	48 89 e5             	mov    %rsp,%rbp
+  800660:	41 57                	push   %r15
+  800662:	41 56                	push   %r14
+  800664:	41 55                	push   %r13
+  800666:	41 54                	push   %r12
+  800668:	53                   	push   %rbx
+  800669:	48 83 ec 38          	sub    $0x38,%rsp
+  80066d:	49 89 fe             	mov    %rdi,%r14
+  800670:	49 89 f5             	mov    %rsi,%r13
+  800673:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800676:	48 8b 01             	mov    (%rcx),%rax
+  800679:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80067d:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800681:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800685:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800689:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80068d:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800691:	0f b6 3b             	movzbl (%rbx),%edi
+  800694:	40 80 ff 25          	cmp    $0x25,%dil
+  800698:	74 18                	je     8006b2 <vprintfmt+0x56>
+            if (!ch) return;
+  80069a:	40 84 ff             	test   %dil,%dil
+  80069d:	0f 84 b1 06 00 00    	je     800d54 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8006a3:	40 0f b6 ff          	movzbl %dil,%edi
+  8006a7:	4c 89 ee             	mov    %r13,%rsi
+  8006aa:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006ad:	4c 89 e3             	mov    %r12,%rbx
+  8006b0:	eb db                	jmp    80068d <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b7:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006bb:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006c0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006c6:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006cd:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006d1:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006d6:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006db:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006de:	83 e8 23             	sub    $0x23,%eax
+  8006e1:	3c 57                	cmp    $0x57,%al
+  8006e3:	0f 87 51 06 00 00    	ja     800d3a <vprintfmt+0x6de>
+  8006e9:	0f b6 c0             	movzbl %al,%eax
+  8006ec:	48 b9 c0 32 80 00 00 	movabs $0x8032c0,%rcx
+  8006f3:	00 00 00 
+  8006f6:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006f9:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006fc:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800700:	eb cf                	jmp    8006d1 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800702:	49 89 dc             	mov    %rbx,%r12
+  800705:	be 01 00 00 00       	mov    $0x1,%esi
+  80070a:	eb c5                	jmp    8006d1 <vprintfmt+0x75>
+            padc = ch;
+  80070c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800710:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800713:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800716:	eb b9                	jmp    8006d1 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800718:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071b:	83 f8 2f             	cmp    $0x2f,%eax
+  80071e:	77 24                	ja     800744 <vprintfmt+0xe8>
+  800720:	89 c1                	mov    %eax,%ecx
+  800722:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800726:	83 c0 08             	add    $0x8,%eax
+  800729:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80072c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80072f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800732:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800736:	79 99                	jns    8006d1 <vprintfmt+0x75>
+                width = precision;
+  800738:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80073c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800742:	eb 8d                	jmp    8006d1 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800744:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800748:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80074c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800750:	eb da                	jmp    80072c <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800752:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800757:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80075b:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800761:	3c 39                	cmp    $0x39,%al
+  800763:	77 1c                	ja     800781 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800765:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800769:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80076d:	0f b6 c0             	movzbl %al,%eax
+  800770:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800775:	0f b6 03             	movzbl (%rbx),%eax
+  800778:	3c 39                	cmp    $0x39,%al
+  80077a:	76 e9                	jbe    800765 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80077c:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80077f:	eb b1                	jmp    800732 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800781:	49 89 dc             	mov    %rbx,%r12
+  800784:	eb ac                	jmp    800732 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800786:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800789:	85 c9                	test   %ecx,%ecx
+  80078b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800790:	0f 49 c1             	cmovns %ecx,%eax
+  800793:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800796:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800799:	e9 33 ff ff ff       	jmp    8006d1 <vprintfmt+0x75>
+            lflag++;
+  80079e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007a1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007a4:	e9 28 ff ff ff       	jmp    8006d1 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8007af:	77 19                	ja     8007ca <vprintfmt+0x16e>
+  8007b1:	89 c2                	mov    %eax,%edx
+  8007b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b7:	83 c0 08             	add    $0x8,%eax
+  8007ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007bd:	8b 3a                	mov    (%rdx),%edi
+  8007bf:	4c 89 ee             	mov    %r13,%rsi
+  8007c2:	41 ff d6             	call   *%r14
+            break;
+  8007c5:	e9 c3 fe ff ff       	jmp    80068d <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d6:	eb e5                	jmp    8007bd <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007db:	83 f8 2f             	cmp    $0x2f,%eax
+  8007de:	77 5a                	ja     80083a <vprintfmt+0x1de>
+  8007e0:	89 c2                	mov    %eax,%edx
+  8007e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e6:	83 c0 08             	add    $0x8,%eax
+  8007e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007ec:	8b 02                	mov    (%rdx),%eax
+  8007ee:	89 c1                	mov    %eax,%ecx
+  8007f0:	f7 d9                	neg    %ecx
+  8007f2:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007f5:	83 f9 15             	cmp    $0x15,%ecx
+  8007f8:	7f 4e                	jg     800848 <vprintfmt+0x1ec>
+  8007fa:	48 63 c1             	movslq %ecx,%rax
+  8007fd:	48 ba 80 35 80 00 00 	movabs $0x803580,%rdx
+  800804:	00 00 00 
+  800807:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80080b:	48 85 c0             	test   %rax,%rax
+  80080e:	74 38                	je     800848 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800810:	48 89 c1             	mov    %rax,%rcx
+  800813:	48 ba 79 37 80 00 00 	movabs $0x803779,%rdx
+  80081a:	00 00 00 
+  80081d:	4c 89 ee             	mov    %r13,%rsi
+  800820:	4c 89 f7             	mov    %r14,%rdi
+  800823:	b8 00 00 00 00       	mov    $0x0,%eax
+  800828:	49 b8 1f 06 80 00 00 	movabs $0x80061f,%r8
+  80082f:	00 00 00 
+  800832:	41 ff d0             	call   *%r8
+  800835:	e9 53 fe ff ff       	jmp    80068d <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80083a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800842:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800846:	eb a4                	jmp    8007ec <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800848:	48 ba 2c 31 80 00 00 	movabs $0x80312c,%rdx
+  80084f:	00 00 00 
+  800852:	4c 89 ee             	mov    %r13,%rsi
+  800855:	4c 89 f7             	mov    %r14,%rdi
+  800858:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085d:	49 b8 1f 06 80 00 00 	movabs $0x80061f,%r8
+  800864:	00 00 00 
+  800867:	41 ff d0             	call   *%r8
+  80086a:	e9 1e fe ff ff       	jmp    80068d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80086f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800872:	83 f8 2f             	cmp    $0x2f,%eax
+  800875:	77 6c                	ja     8008e3 <vprintfmt+0x287>
+  800877:	89 c2                	mov    %eax,%edx
+  800879:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087d:	83 c0 08             	add    $0x8,%eax
+  800880:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800883:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800886:	48 85 d2             	test   %rdx,%rdx
+  800889:	48 b8 25 31 80 00 00 	movabs $0x803125,%rax
+  800890:	00 00 00 
+  800893:	48 0f 45 c2          	cmovne %rdx,%rax
+  800897:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80089b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80089f:	7e 06                	jle    8008a7 <vprintfmt+0x24b>
+  8008a1:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8008a5:	75 4a                	jne    8008f1 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008a7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008ab:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008af:	0f b6 00             	movzbl (%rax),%eax
+  8008b2:	84 c0                	test   %al,%al
+  8008b4:	0f 85 9a 00 00 00    	jne    800954 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008ba:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008bd:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008c1:	85 c0                	test   %eax,%eax
+  8008c3:	0f 8e c4 fd ff ff    	jle    80068d <vprintfmt+0x31>
+  8008c9:	4c 89 ee             	mov    %r13,%rsi
+  8008cc:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008d1:	41 ff d6             	call   *%r14
+  8008d4:	41 83 ec 01          	sub    $0x1,%r12d
+  8008d8:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008dc:	75 eb                	jne    8008c9 <vprintfmt+0x26d>
+  8008de:	e9 aa fd ff ff       	jmp    80068d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ef:	eb 92                	jmp    800883 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008f1:	49 63 f7             	movslq %r15d,%rsi
+  8008f4:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008f8:	48 b8 0e 0e 80 00 00 	movabs $0x800e0e,%rax
+  8008ff:	00 00 00 
+  800902:	ff d0                	call   *%rax
+  800904:	48 89 c2             	mov    %rax,%rdx
+  800907:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80090a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80090c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80090f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800912:	85 c0                	test   %eax,%eax
+  800914:	7e 91                	jle    8008a7 <vprintfmt+0x24b>
+  800916:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80091b:	4c 89 ee             	mov    %r13,%rsi
+  80091e:	44 89 e7             	mov    %r12d,%edi
+  800921:	41 ff d6             	call   *%r14
+  800924:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800928:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80092b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80092e:	75 eb                	jne    80091b <vprintfmt+0x2bf>
+  800930:	e9 72 ff ff ff       	jmp    8008a7 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800935:	0f b6 f8             	movzbl %al,%edi
+  800938:	4c 89 ee             	mov    %r13,%rsi
+  80093b:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80093e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800942:	49 83 c4 01          	add    $0x1,%r12
+  800946:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80094c:	84 c0                	test   %al,%al
+  80094e:	0f 84 66 ff ff ff    	je     8008ba <vprintfmt+0x25e>
+  800954:	45 85 ff             	test   %r15d,%r15d
+  800957:	78 0a                	js     800963 <vprintfmt+0x307>
+  800959:	41 83 ef 01          	sub    $0x1,%r15d
+  80095d:	0f 88 57 ff ff ff    	js     8008ba <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800963:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800967:	74 cc                	je     800935 <vprintfmt+0x2d9>
+  800969:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80096c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800971:	80 fa 5e             	cmp    $0x5e,%dl
+  800974:	77 c2                	ja     800938 <vprintfmt+0x2dc>
+  800976:	eb bd                	jmp    800935 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800978:	40 84 f6             	test   %sil,%sil
+  80097b:	75 26                	jne    8009a3 <vprintfmt+0x347>
+    switch (lflag) {
+  80097d:	85 d2                	test   %edx,%edx
+  80097f:	74 59                	je     8009da <vprintfmt+0x37e>
+  800981:	83 fa 01             	cmp    $0x1,%edx
+  800984:	74 7b                	je     800a01 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800986:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800989:	83 f8 2f             	cmp    $0x2f,%eax
+  80098c:	0f 87 96 00 00 00    	ja     800a28 <vprintfmt+0x3cc>
+  800992:	89 c2                	mov    %eax,%edx
+  800994:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800998:	83 c0 08             	add    $0x8,%eax
+  80099b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099e:	4c 8b 22             	mov    (%rdx),%r12
+  8009a1:	eb 17                	jmp    8009ba <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a9:	77 21                	ja     8009cc <vprintfmt+0x370>
+  8009ab:	89 c2                	mov    %eax,%edx
+  8009ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b1:	83 c0 08             	add    $0x8,%eax
+  8009b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b7:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009ba:	4d 85 e4             	test   %r12,%r12
+  8009bd:	78 7a                	js     800a39 <vprintfmt+0x3dd>
+            num = i;
+  8009bf:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009c2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009c7:	e9 50 02 00 00       	jmp    800c1c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d8:	eb dd                	jmp    8009b7 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e0:	77 11                	ja     8009f3 <vprintfmt+0x397>
+  8009e2:	89 c2                	mov    %eax,%edx
+  8009e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e8:	83 c0 08             	add    $0x8,%eax
+  8009eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ee:	4c 63 22             	movslq (%rdx),%r12
+  8009f1:	eb c7                	jmp    8009ba <vprintfmt+0x35e>
+  8009f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ff:	eb ed                	jmp    8009ee <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a04:	83 f8 2f             	cmp    $0x2f,%eax
+  800a07:	77 11                	ja     800a1a <vprintfmt+0x3be>
+  800a09:	89 c2                	mov    %eax,%edx
+  800a0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0f:	83 c0 08             	add    $0x8,%eax
+  800a12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a15:	4c 8b 22             	mov    (%rdx),%r12
+  800a18:	eb a0                	jmp    8009ba <vprintfmt+0x35e>
+  800a1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a26:	eb ed                	jmp    800a15 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a34:	e9 65 ff ff ff       	jmp    80099e <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a39:	4c 89 ee             	mov    %r13,%rsi
+  800a3c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a41:	41 ff d6             	call   *%r14
+                i = -i;
+  800a44:	49 f7 dc             	neg    %r12
+  800a47:	e9 73 ff ff ff       	jmp    8009bf <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a4c:	40 84 f6             	test   %sil,%sil
+  800a4f:	75 32                	jne    800a83 <vprintfmt+0x427>
+    switch (lflag) {
+  800a51:	85 d2                	test   %edx,%edx
+  800a53:	74 5d                	je     800ab2 <vprintfmt+0x456>
+  800a55:	83 fa 01             	cmp    $0x1,%edx
+  800a58:	0f 84 82 00 00 00    	je     800ae0 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a5e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a61:	83 f8 2f             	cmp    $0x2f,%eax
+  800a64:	0f 87 a5 00 00 00    	ja     800b0f <vprintfmt+0x4b3>
+  800a6a:	89 c2                	mov    %eax,%edx
+  800a6c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a70:	83 c0 08             	add    $0x8,%eax
+  800a73:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a76:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a79:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a7e:	e9 99 01 00 00       	jmp    800c1c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a86:	83 f8 2f             	cmp    $0x2f,%eax
+  800a89:	77 19                	ja     800aa4 <vprintfmt+0x448>
+  800a8b:	89 c2                	mov    %eax,%edx
+  800a8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a91:	83 c0 08             	add    $0x8,%eax
+  800a94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a97:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a9a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a9f:	e9 78 01 00 00       	jmp    800c1c <vprintfmt+0x5c0>
+  800aa4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab0:	eb e5                	jmp    800a97 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800ab2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab8:	77 18                	ja     800ad2 <vprintfmt+0x476>
+  800aba:	89 c2                	mov    %eax,%edx
+  800abc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac0:	83 c0 08             	add    $0x8,%eax
+  800ac3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac6:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800ac8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800acd:	e9 4a 01 00 00       	jmp    800c1c <vprintfmt+0x5c0>
+  800ad2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ada:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ade:	eb e6                	jmp    800ac6 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800ae0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae6:	77 19                	ja     800b01 <vprintfmt+0x4a5>
+  800ae8:	89 c2                	mov    %eax,%edx
+  800aea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aee:	83 c0 08             	add    $0x8,%eax
+  800af1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800af7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800afc:	e9 1b 01 00 00       	jmp    800c1c <vprintfmt+0x5c0>
+  800b01:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b05:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0d:	eb e5                	jmp    800af4 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b0f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b13:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1b:	e9 56 ff ff ff       	jmp    800a76 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b20:	40 84 f6             	test   %sil,%sil
+  800b23:	75 2e                	jne    800b53 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b25:	85 d2                	test   %edx,%edx
+  800b27:	74 59                	je     800b82 <vprintfmt+0x526>
+  800b29:	83 fa 01             	cmp    $0x1,%edx
+  800b2c:	74 7f                	je     800bad <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b31:	83 f8 2f             	cmp    $0x2f,%eax
+  800b34:	0f 87 9f 00 00 00    	ja     800bd9 <vprintfmt+0x57d>
+  800b3a:	89 c2                	mov    %eax,%edx
+  800b3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b40:	83 c0 08             	add    $0x8,%eax
+  800b43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b46:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b49:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b4e:	e9 c9 00 00 00       	jmp    800c1c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b56:	83 f8 2f             	cmp    $0x2f,%eax
+  800b59:	77 19                	ja     800b74 <vprintfmt+0x518>
+  800b5b:	89 c2                	mov    %eax,%edx
+  800b5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b61:	83 c0 08             	add    $0x8,%eax
+  800b64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b67:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b6a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b6f:	e9 a8 00 00 00       	jmp    800c1c <vprintfmt+0x5c0>
+  800b74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b80:	eb e5                	jmp    800b67 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b82:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b85:	83 f8 2f             	cmp    $0x2f,%eax
+  800b88:	77 15                	ja     800b9f <vprintfmt+0x543>
+  800b8a:	89 c2                	mov    %eax,%edx
+  800b8c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b90:	83 c0 08             	add    $0x8,%eax
+  800b93:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b96:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b98:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b9d:	eb 7d                	jmp    800c1c <vprintfmt+0x5c0>
+  800b9f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bab:	eb e9                	jmp    800b96 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800bad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb0:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb3:	77 16                	ja     800bcb <vprintfmt+0x56f>
+  800bb5:	89 c2                	mov    %eax,%edx
+  800bb7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bbb:	83 c0 08             	add    $0x8,%eax
+  800bbe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bc4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bc9:	eb 51                	jmp    800c1c <vprintfmt+0x5c0>
+  800bcb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bcf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd7:	eb e8                	jmp    800bc1 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800bd9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bdd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be5:	e9 5c ff ff ff       	jmp    800b46 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800bea:	4c 89 ee             	mov    %r13,%rsi
+  800bed:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bf2:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800bf5:	4c 89 ee             	mov    %r13,%rsi
+  800bf8:	bf 78 00 00 00       	mov    $0x78,%edi
+  800bfd:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c03:	83 f8 2f             	cmp    $0x2f,%eax
+  800c06:	77 47                	ja     800c4f <vprintfmt+0x5f3>
+  800c08:	89 c2                	mov    %eax,%edx
+  800c0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0e:	83 c0 08             	add    $0x8,%eax
+  800c11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c14:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c17:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c1c:	48 83 ec 08          	sub    $0x8,%rsp
+  800c20:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c24:	0f 94 c0             	sete   %al
+  800c27:	0f b6 c0             	movzbl %al,%eax
+  800c2a:	50                   	push   %rax
+  800c2b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c30:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c34:	4c 89 ee             	mov    %r13,%rsi
+  800c37:	4c 89 f7             	mov    %r14,%rdi
+  800c3a:	48 b8 51 05 80 00 00 	movabs $0x800551,%rax
+  800c41:	00 00 00 
+  800c44:	ff d0                	call   *%rax
+            break;
+  800c46:	48 83 c4 10          	add    $0x10,%rsp
+  800c4a:	e9 3e fa ff ff       	jmp    80068d <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c5b:	eb b7                	jmp    800c14 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c5d:	40 84 f6             	test   %sil,%sil
+  800c60:	75 2b                	jne    800c8d <vprintfmt+0x631>
+    switch (lflag) {
+  800c62:	85 d2                	test   %edx,%edx
+  800c64:	74 56                	je     800cbc <vprintfmt+0x660>
+  800c66:	83 fa 01             	cmp    $0x1,%edx
+  800c69:	74 7f                	je     800cea <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c6b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c71:	0f 87 a2 00 00 00    	ja     800d19 <vprintfmt+0x6bd>
+  800c77:	89 c2                	mov    %eax,%edx
+  800c79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7d:	83 c0 08             	add    $0x8,%eax
+  800c80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c83:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c86:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c8b:	eb 8f                	jmp    800c1c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c90:	83 f8 2f             	cmp    $0x2f,%eax
+  800c93:	77 19                	ja     800cae <vprintfmt+0x652>
+  800c95:	89 c2                	mov    %eax,%edx
+  800c97:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c9b:	83 c0 08             	add    $0x8,%eax
+  800c9e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ca1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ca4:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ca9:	e9 6e ff ff ff       	jmp    800c1c <vprintfmt+0x5c0>
+  800cae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cb2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cb6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cba:	eb e5                	jmp    800ca1 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800cbc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cbf:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc2:	77 18                	ja     800cdc <vprintfmt+0x680>
+  800cc4:	89 c2                	mov    %eax,%edx
+  800cc6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cca:	83 c0 08             	add    $0x8,%eax
+  800ccd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd0:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800cd2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800cd7:	e9 40 ff ff ff       	jmp    800c1c <vprintfmt+0x5c0>
+  800cdc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ce0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ce4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce8:	eb e6                	jmp    800cd0 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800cea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ced:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf0:	77 19                	ja     800d0b <vprintfmt+0x6af>
+  800cf2:	89 c2                	mov    %eax,%edx
+  800cf4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf8:	83 c0 08             	add    $0x8,%eax
+  800cfb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cfe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d01:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d06:	e9 11 ff ff ff       	jmp    800c1c <vprintfmt+0x5c0>
+  800d0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d17:	eb e5                	jmp    800cfe <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d25:	e9 59 ff ff ff       	jmp    800c83 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d2a:	4c 89 ee             	mov    %r13,%rsi
+  800d2d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d32:	41 ff d6             	call   *%r14
+            break;
+  800d35:	e9 53 f9 ff ff       	jmp    80068d <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d3a:	4c 89 ee             	mov    %r13,%rsi
+  800d3d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d42:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d45:	48 83 eb 01          	sub    $0x1,%rbx
+  800d49:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d4d:	75 f6                	jne    800d45 <vprintfmt+0x6e9>
+  800d4f:	e9 39 f9 ff ff       	jmp    80068d <vprintfmt+0x31>
+}
+  800d54:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d58:	5b                   	pop    %rbx
+  800d59:	41 5c                	pop    %r12
+  800d5b:	41 5d                	pop    %r13
+  800d5d:	41 5e                	pop    %r14
+  800d5f:	41 5f                	pop    %r15
+  800d61:	5d                   	pop    %rbp
+  800d62:	c3                   	ret
+
+0000000000800d63 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d63:	55                   	push   %rbp
+  800d64:	48 89 e5             	mov    %rsp,%rbp
+  800d67:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d6b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d6f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d74:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d78:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d7f:	48 85 ff             	test   %rdi,%rdi
+  800d82:	74 2b                	je     800daf <vsnprintf+0x4c>
+  800d84:	48 85 f6             	test   %rsi,%rsi
+  800d87:	74 26                	je     800daf <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d89:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d8d:	48 bf 07 06 80 00 00 	movabs $0x800607,%rdi
+  800d94:	00 00 00 
+  800d97:	48 b8 5c 06 80 00 00 	movabs $0x80065c,%rax
+  800d9e:	00 00 00 
+  800da1:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800da3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800da7:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800daa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800dad:	c9                   	leave
+  800dae:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800daf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800db4:	eb f7                	jmp    800dad <vsnprintf+0x4a>
+
+0000000000800db6 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800db6:	55                   	push   %rbp
+  800db7:	48 89 e5             	mov    %rsp,%rbp
+  800dba:	48 83 ec 50          	sub    $0x50,%rsp
+  800dbe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800dc2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800dc6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dca:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800dd1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dd5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dd9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ddd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800de1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800de5:	48 b8 63 0d 80 00 00 	movabs $0x800d63,%rax
+  800dec:	00 00 00 
+  800def:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800df1:	c9                   	leave
+  800df2:	c3                   	ret
+
+0000000000800df3 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800df3:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800df6:	74 10                	je     800e08 <strlen+0x15>
+    size_t n = 0;
+  800df8:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800dfd:	48 83 c0 01          	add    $0x1,%rax
+  800e01:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e05:	75 f6                	jne    800dfd <strlen+0xa>
+  800e07:	c3                   	ret
+    size_t n = 0;
+  800e08:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e0d:	c3                   	ret
+
+0000000000800e0e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e0e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e11:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e16:	48 85 f6             	test   %rsi,%rsi
+  800e19:	74 11                	je     800e2c <strnlen+0x1e>
+  800e1b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e1f:	74 0c                	je     800e2d <strnlen+0x1f>
+  800e21:	48 83 c2 01          	add    $0x1,%rdx
+  800e25:	48 39 d0             	cmp    %rdx,%rax
+  800e28:	75 f1                	jne    800e1b <strnlen+0xd>
+  800e2a:	eb 04                	jmp    800e30 <strnlen+0x22>
+  800e2c:	c3                   	ret
+  800e2d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e30:	c3                   	ret
+
+0000000000800e31 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e31:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e34:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e39:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e3d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e40:	48 83 c2 01          	add    $0x1,%rdx
+  800e44:	84 c9                	test   %cl,%cl
+  800e46:	75 f1                	jne    800e39 <strcpy+0x8>
+        ;
+    return res;
+}
+  800e48:	c3                   	ret
+
+0000000000800e49 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e49:	55                   	push   %rbp
+  800e4a:	48 89 e5             	mov    %rsp,%rbp
+  800e4d:	41 54                	push   %r12
+  800e4f:	53                   	push   %rbx
+  800e50:	48 89 fb             	mov    %rdi,%rbx
+  800e53:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e56:	48 b8 f3 0d 80 00 00 	movabs $0x800df3,%rax
+  800e5d:	00 00 00 
+  800e60:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e62:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e66:	4c 89 e6             	mov    %r12,%rsi
+  800e69:	48 b8 31 0e 80 00 00 	movabs $0x800e31,%rax
+  800e70:	00 00 00 
+  800e73:	ff d0                	call   *%rax
+    return dst;
+}
+  800e75:	48 89 d8             	mov    %rbx,%rax
+  800e78:	5b                   	pop    %rbx
+  800e79:	41 5c                	pop    %r12
+  800e7b:	5d                   	pop    %rbp
+  800e7c:	c3                   	ret
+
+0000000000800e7d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e7d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e80:	48 85 d2             	test   %rdx,%rdx
+  800e83:	74 1f                	je     800ea4 <strncpy+0x27>
+  800e85:	48 01 fa             	add    %rdi,%rdx
+  800e88:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e8b:	48 83 c1 01          	add    $0x1,%rcx
+  800e8f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e93:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e97:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e9b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e9f:	48 39 ca             	cmp    %rcx,%rdx
+  800ea2:	75 e7                	jne    800e8b <strncpy+0xe>
+    }
+    return ret;
+}
+  800ea4:	c3                   	ret
+
+0000000000800ea5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ea5:	48 89 f8             	mov    %rdi,%rax
+  800ea8:	48 85 d2             	test   %rdx,%rdx
+  800eab:	74 24                	je     800ed1 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ead:	48 83 ea 01          	sub    $0x1,%rdx
+  800eb1:	74 1b                	je     800ece <strlcpy+0x29>
+  800eb3:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800eb7:	0f b6 16             	movzbl (%rsi),%edx
+  800eba:	84 d2                	test   %dl,%dl
+  800ebc:	74 10                	je     800ece <strlcpy+0x29>
+            *dst++ = *src++;
+  800ebe:	48 83 c6 01          	add    $0x1,%rsi
+  800ec2:	48 83 c0 01          	add    $0x1,%rax
+  800ec6:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ec9:	48 39 c8             	cmp    %rcx,%rax
+  800ecc:	75 e9                	jne    800eb7 <strlcpy+0x12>
+        *dst = '\0';
+  800ece:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ed1:	48 29 f8             	sub    %rdi,%rax
+}
+  800ed4:	c3                   	ret
+
+0000000000800ed5 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ed5:	0f b6 07             	movzbl (%rdi),%eax
+  800ed8:	84 c0                	test   %al,%al
+  800eda:	74 13                	je     800eef <strcmp+0x1a>
+  800edc:	38 06                	cmp    %al,(%rsi)
+  800ede:	75 0f                	jne    800eef <strcmp+0x1a>
+  800ee0:	48 83 c7 01          	add    $0x1,%rdi
+  800ee4:	48 83 c6 01          	add    $0x1,%rsi
+  800ee8:	0f b6 07             	movzbl (%rdi),%eax
+  800eeb:	84 c0                	test   %al,%al
+  800eed:	75 ed                	jne    800edc <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800eef:	0f b6 c0             	movzbl %al,%eax
+  800ef2:	0f b6 16             	movzbl (%rsi),%edx
+  800ef5:	29 d0                	sub    %edx,%eax
+}
+  800ef7:	c3                   	ret
+
+0000000000800ef8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800ef8:	48 85 d2             	test   %rdx,%rdx
+  800efb:	74 1f                	je     800f1c <strncmp+0x24>
+  800efd:	0f b6 07             	movzbl (%rdi),%eax
+  800f00:	84 c0                	test   %al,%al
+  800f02:	74 1e                	je     800f22 <strncmp+0x2a>
+  800f04:	3a 06                	cmp    (%rsi),%al
+  800f06:	75 1a                	jne    800f22 <strncmp+0x2a>
+  800f08:	48 83 c7 01          	add    $0x1,%rdi
+  800f0c:	48 83 c6 01          	add    $0x1,%rsi
+  800f10:	48 83 ea 01          	sub    $0x1,%rdx
+  800f14:	75 e7                	jne    800efd <strncmp+0x5>
+
+    if (!n) return 0;
+  800f16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f1b:	c3                   	ret
+  800f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f21:	c3                   	ret
+  800f22:	48 85 d2             	test   %rdx,%rdx
+  800f25:	74 09                	je     800f30 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f27:	0f b6 07             	movzbl (%rdi),%eax
+  800f2a:	0f b6 16             	movzbl (%rsi),%edx
+  800f2d:	29 d0                	sub    %edx,%eax
+  800f2f:	c3                   	ret
+    if (!n) return 0;
+  800f30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f35:	c3                   	ret
+
+0000000000800f36 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f36:	0f b6 17             	movzbl (%rdi),%edx
+  800f39:	84 d2                	test   %dl,%dl
+  800f3b:	74 18                	je     800f55 <strchr+0x1f>
+        if (*str == c) {
+  800f3d:	0f be d2             	movsbl %dl,%edx
+  800f40:	39 f2                	cmp    %esi,%edx
+  800f42:	74 17                	je     800f5b <strchr+0x25>
+    for (; *str; str++) {
+  800f44:	48 83 c7 01          	add    $0x1,%rdi
+  800f48:	0f b6 17             	movzbl (%rdi),%edx
+  800f4b:	84 d2                	test   %dl,%dl
+  800f4d:	75 ee                	jne    800f3d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f54:	c3                   	ret
+  800f55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f5a:	c3                   	ret
+  800f5b:	48 89 f8             	mov    %rdi,%rax
+}
+  800f5e:	c3                   	ret
+
+0000000000800f5f <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f5f:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f62:	0f b6 17             	movzbl (%rdi),%edx
+  800f65:	84 d2                	test   %dl,%dl
+  800f67:	74 13                	je     800f7c <strfind+0x1d>
+  800f69:	0f be d2             	movsbl %dl,%edx
+  800f6c:	39 f2                	cmp    %esi,%edx
+  800f6e:	74 0b                	je     800f7b <strfind+0x1c>
+  800f70:	48 83 c0 01          	add    $0x1,%rax
+  800f74:	0f b6 10             	movzbl (%rax),%edx
+  800f77:	84 d2                	test   %dl,%dl
+  800f79:	75 ee                	jne    800f69 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f7b:	c3                   	ret
+  800f7c:	c3                   	ret
+
+0000000000800f7d <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f7d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f80:	48 89 f8             	mov    %rdi,%rax
+  800f83:	48 f7 d8             	neg    %rax
+  800f86:	83 e0 07             	and    $0x7,%eax
+  800f89:	49 89 d1             	mov    %rdx,%r9
+  800f8c:	49 29 c1             	sub    %rax,%r9
+  800f8f:	78 36                	js     800fc7 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f91:	40 0f b6 c6          	movzbl %sil,%eax
+  800f95:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f9c:	01 01 01 
+  800f9f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800fa3:	40 f6 c7 07          	test   $0x7,%dil
+  800fa7:	75 38                	jne    800fe1 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fa9:	4c 89 c9             	mov    %r9,%rcx
+  800fac:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fb0:	74 0c                	je     800fbe <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fb2:	fc                   	cld
+  800fb3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fb6:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fba:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fbe:	4d 85 c9             	test   %r9,%r9
+  800fc1:	75 45                	jne    801008 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fc3:	4c 89 c0             	mov    %r8,%rax
+  800fc6:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fc7:	48 85 d2             	test   %rdx,%rdx
+  800fca:	74 f7                	je     800fc3 <memset+0x46>
+  800fcc:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fcf:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fd2:	48 83 c0 01          	add    $0x1,%rax
+  800fd6:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fda:	48 39 c2             	cmp    %rax,%rdx
+  800fdd:	75 f3                	jne    800fd2 <memset+0x55>
+  800fdf:	eb e2                	jmp    800fc3 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fe1:	40 f6 c7 01          	test   $0x1,%dil
+  800fe5:	74 06                	je     800fed <memset+0x70>
+  800fe7:	88 07                	mov    %al,(%rdi)
+  800fe9:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fed:	40 f6 c7 02          	test   $0x2,%dil
+  800ff1:	74 07                	je     800ffa <memset+0x7d>
+  800ff3:	66 89 07             	mov    %ax,(%rdi)
+  800ff6:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ffa:	40 f6 c7 04          	test   $0x4,%dil
+  800ffe:	74 a9                	je     800fa9 <memset+0x2c>
+  801000:	89 07                	mov    %eax,(%rdi)
+  801002:	48 83 c7 04          	add    $0x4,%rdi
+  801006:	eb a1                	jmp    800fa9 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801008:	41 f6 c1 04          	test   $0x4,%r9b
+  80100c:	74 06                	je     801014 <memset+0x97>
+  80100e:	89 07                	mov    %eax,(%rdi)
+  801010:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801014:	41 f6 c1 02          	test   $0x2,%r9b
+  801018:	74 07                	je     801021 <memset+0xa4>
+  80101a:	66 89 07             	mov    %ax,(%rdi)
+  80101d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801021:	41 f6 c1 01          	test   $0x1,%r9b
+  801025:	74 9c                	je     800fc3 <memset+0x46>
+  801027:	88 07                	mov    %al,(%rdi)
+  801029:	eb 98                	jmp    800fc3 <memset+0x46>
+
+000000000080102b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80102b:	48 89 f8             	mov    %rdi,%rax
+  80102e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801031:	48 39 fe             	cmp    %rdi,%rsi
+  801034:	73 3b                	jae    801071 <memmove+0x46>
+  801036:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80103a:	48 39 d7             	cmp    %rdx,%rdi
+  80103d:	73 32                	jae    801071 <memmove+0x46>
+        s += n;
+        d += n;
+  80103f:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801043:	48 89 d6             	mov    %rdx,%rsi
+  801046:	48 09 fe             	or     %rdi,%rsi
+  801049:	48 09 ce             	or     %rcx,%rsi
+  80104c:	40 f6 c6 07          	test   $0x7,%sil
+  801050:	75 12                	jne    801064 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801052:	48 83 ef 08          	sub    $0x8,%rdi
+  801056:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80105a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80105e:	fd                   	std
+  80105f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801062:	fc                   	cld
+  801063:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801064:	48 83 ef 01          	sub    $0x1,%rdi
+  801068:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80106c:	fd                   	std
+  80106d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80106f:	eb f1                	jmp    801062 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801071:	48 89 f2             	mov    %rsi,%rdx
+  801074:	48 09 c2             	or     %rax,%rdx
+  801077:	48 09 ca             	or     %rcx,%rdx
+  80107a:	f6 c2 07             	test   $0x7,%dl
+  80107d:	75 0c                	jne    80108b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80107f:	48 c1 e9 03          	shr    $0x3,%rcx
+  801083:	48 89 c7             	mov    %rax,%rdi
+  801086:	fc                   	cld
+  801087:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80108a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80108b:	48 89 c7             	mov    %rax,%rdi
+  80108e:	fc                   	cld
+  80108f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801091:	c3                   	ret
+
+0000000000801092 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801092:	55                   	push   %rbp
+  801093:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801096:	48 b8 2b 10 80 00 00 	movabs $0x80102b,%rax
+  80109d:	00 00 00 
+  8010a0:	ff d0                	call   *%rax
+}
+  8010a2:	5d                   	pop    %rbp
+  8010a3:	c3                   	ret
+
+00000000008010a4 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010a4:	55                   	push   %rbp
+  8010a5:	48 89 e5             	mov    %rsp,%rbp
+  8010a8:	41 57                	push   %r15
+  8010aa:	41 56                	push   %r14
+  8010ac:	41 55                	push   %r13
+  8010ae:	41 54                	push   %r12
+  8010b0:	53                   	push   %rbx
+  8010b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8010b5:	49 89 fe             	mov    %rdi,%r14
+  8010b8:	49 89 f7             	mov    %rsi,%r15
+  8010bb:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010be:	48 89 f7             	mov    %rsi,%rdi
+  8010c1:	48 b8 f3 0d 80 00 00 	movabs $0x800df3,%rax
+  8010c8:	00 00 00 
+  8010cb:	ff d0                	call   *%rax
+  8010cd:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010d0:	48 89 de             	mov    %rbx,%rsi
+  8010d3:	4c 89 f7             	mov    %r14,%rdi
+  8010d6:	48 b8 0e 0e 80 00 00 	movabs $0x800e0e,%rax
+  8010dd:	00 00 00 
+  8010e0:	ff d0                	call   *%rax
+  8010e2:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010e5:	48 39 c3             	cmp    %rax,%rbx
+  8010e8:	74 36                	je     801120 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010ea:	48 89 d8             	mov    %rbx,%rax
+  8010ed:	4c 29 e8             	sub    %r13,%rax
+  8010f0:	49 39 c4             	cmp    %rax,%r12
+  8010f3:	73 31                	jae    801126 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010f5:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8010fa:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010fe:	4c 89 fe             	mov    %r15,%rsi
+  801101:	48 b8 92 10 80 00 00 	movabs $0x801092,%rax
+  801108:	00 00 00 
+  80110b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80110d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801111:	48 83 c4 08          	add    $0x8,%rsp
+  801115:	5b                   	pop    %rbx
+  801116:	41 5c                	pop    %r12
+  801118:	41 5d                	pop    %r13
+  80111a:	41 5e                	pop    %r14
+  80111c:	41 5f                	pop    %r15
+  80111e:	5d                   	pop    %rbp
+  80111f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801120:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801124:	eb eb                	jmp    801111 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801126:	48 83 eb 01          	sub    $0x1,%rbx
+  80112a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80112e:	48 89 da             	mov    %rbx,%rdx
+  801131:	4c 89 fe             	mov    %r15,%rsi
+  801134:	48 b8 92 10 80 00 00 	movabs $0x801092,%rax
+  80113b:	00 00 00 
+  80113e:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801140:	49 01 de             	add    %rbx,%r14
+  801143:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801148:	eb c3                	jmp    80110d <strlcat+0x69>
+
+000000000080114a <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80114a:	48 85 d2             	test   %rdx,%rdx
+  80114d:	74 2d                	je     80117c <memcmp+0x32>
+  80114f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801154:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801158:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80115d:	44 38 c1             	cmp    %r8b,%cl
+  801160:	75 0f                	jne    801171 <memcmp+0x27>
+    while (n-- > 0) {
+  801162:	48 83 c0 01          	add    $0x1,%rax
+  801166:	48 39 c2             	cmp    %rax,%rdx
+  801169:	75 e9                	jne    801154 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80116b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801170:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801171:	0f b6 c1             	movzbl %cl,%eax
+  801174:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801178:	44 29 c0             	sub    %r8d,%eax
+  80117b:	c3                   	ret
+    return 0;
+  80117c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801181:	c3                   	ret
+
+0000000000801182 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801182:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801186:	48 39 c7             	cmp    %rax,%rdi
+  801189:	73 0f                	jae    80119a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80118b:	40 38 37             	cmp    %sil,(%rdi)
+  80118e:	74 0e                	je     80119e <memfind+0x1c>
+    for (; src < end; src++) {
+  801190:	48 83 c7 01          	add    $0x1,%rdi
+  801194:	48 39 f8             	cmp    %rdi,%rax
+  801197:	75 f2                	jne    80118b <memfind+0x9>
+  801199:	c3                   	ret
+  80119a:	48 89 f8             	mov    %rdi,%rax
+  80119d:	c3                   	ret
+  80119e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011a1:	c3                   	ret
+
+00000000008011a2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011a2:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011a5:	0f b6 37             	movzbl (%rdi),%esi
+  8011a8:	40 80 fe 20          	cmp    $0x20,%sil
+  8011ac:	74 06                	je     8011b4 <strtol+0x12>
+  8011ae:	40 80 fe 09          	cmp    $0x9,%sil
+  8011b2:	75 13                	jne    8011c7 <strtol+0x25>
+  8011b4:	48 83 c7 01          	add    $0x1,%rdi
+  8011b8:	0f b6 37             	movzbl (%rdi),%esi
+  8011bb:	40 80 fe 20          	cmp    $0x20,%sil
+  8011bf:	74 f3                	je     8011b4 <strtol+0x12>
+  8011c1:	40 80 fe 09          	cmp    $0x9,%sil
+  8011c5:	74 ed                	je     8011b4 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011c7:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011ca:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011cd:	3c 01                	cmp    $0x1,%al
+  8011cf:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011d3:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011d9:	75 0f                	jne    8011ea <strtol+0x48>
+  8011db:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011de:	74 14                	je     8011f4 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011e0:	85 d2                	test   %edx,%edx
+  8011e2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011e7:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011ea:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011ef:	4c 63 ca             	movslq %edx,%r9
+  8011f2:	eb 36                	jmp    80122a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011f4:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011f8:	74 0f                	je     801209 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8011fa:	85 d2                	test   %edx,%edx
+  8011fc:	75 ec                	jne    8011ea <strtol+0x48>
+        s++;
+  8011fe:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801202:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801207:	eb e1                	jmp    8011ea <strtol+0x48>
+        s += 2;
+  801209:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80120d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801212:	eb d6                	jmp    8011ea <strtol+0x48>
+            dig -= '0';
+  801214:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801217:	44 0f b6 c1          	movzbl %cl,%r8d
+  80121b:	41 39 d0             	cmp    %edx,%r8d
+  80121e:	7d 21                	jge    801241 <strtol+0x9f>
+        val = val * base + dig;
+  801220:	49 0f af c1          	imul   %r9,%rax
+  801224:	0f b6 c9             	movzbl %cl,%ecx
+  801227:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80122a:	48 83 c7 01          	add    $0x1,%rdi
+  80122e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801232:	80 f9 39             	cmp    $0x39,%cl
+  801235:	76 dd                	jbe    801214 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801237:	80 f9 7b             	cmp    $0x7b,%cl
+  80123a:	77 05                	ja     801241 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80123c:	83 e9 57             	sub    $0x57,%ecx
+  80123f:	eb d6                	jmp    801217 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801241:	4d 85 d2             	test   %r10,%r10
+  801244:	74 03                	je     801249 <strtol+0xa7>
+  801246:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801249:	48 89 c2             	mov    %rax,%rdx
+  80124c:	48 f7 da             	neg    %rdx
+  80124f:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801253:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801257:	c3                   	ret
+
+0000000000801258 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801258:	55                   	push   %rbp
+  801259:	48 89 e5             	mov    %rsp,%rbp
+  80125c:	53                   	push   %rbx
+  80125d:	48 89 fa             	mov    %rdi,%rdx
+  801260:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801263:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801268:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801272:	be 00 00 00 00       	mov    $0x0,%esi
+  801277:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80127d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80127f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801283:	c9                   	leave
+  801284:	c3                   	ret
+
+0000000000801285 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801285:	55                   	push   %rbp
+  801286:	48 89 e5             	mov    %rsp,%rbp
+  801289:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80128a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80128f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801294:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801299:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ae:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b4:	c9                   	leave
+  8012b5:	c3                   	ret
+
+00000000008012b6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8012b6:	55                   	push   %rbp
+  8012b7:	48 89 e5             	mov    %rsp,%rbp
+  8012ba:	53                   	push   %rbx
+  8012bb:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012bf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c2:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012e3:	48 85 c0             	test   %rax,%rax
+  8012e6:	7f 06                	jg     8012ee <sys_env_destroy+0x38>
+}
+  8012e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ec:	c9                   	leave
+  8012ed:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ee:	49 89 c0             	mov    %rax,%r8
+  8012f1:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012f6:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  8012fd:	00 00 00 
+  801300:	be 26 00 00 00       	mov    $0x26,%esi
+  801305:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  80130c:	00 00 00 
+  80130f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801314:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  80131b:	00 00 00 
+  80131e:	41 ff d1             	call   *%r9
+
+0000000000801321 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801321:	55                   	push   %rbp
+  801322:	48 89 e5             	mov    %rsp,%rbp
+  801325:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801326:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80132b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801330:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801335:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133f:	be 00 00 00 00       	mov    $0x0,%esi
+  801344:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80134a:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80134c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801350:	c9                   	leave
+  801351:	c3                   	ret
+
+0000000000801352 <sys_yield>:
+
+void
+sys_yield(void) {
+  801352:	55                   	push   %rbp
+  801353:	48 89 e5             	mov    %rsp,%rbp
+  801356:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801357:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80135c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801361:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801366:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801370:	be 00 00 00 00       	mov    $0x0,%esi
+  801375:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80137b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80137d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801381:	c9                   	leave
+  801382:	c3                   	ret
+
+0000000000801383 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801383:	55                   	push   %rbp
+  801384:	48 89 e5             	mov    %rsp,%rbp
+  801387:	53                   	push   %rbx
+  801388:	48 89 fa             	mov    %rdi,%rdx
+  80138b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80138e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801393:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80139a:	00 00 00 
+  80139d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ad:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b3:	c9                   	leave
+  8013b4:	c3                   	ret
+
+00000000008013b5 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013b5:	55                   	push   %rbp
+  8013b6:	48 89 e5             	mov    %rsp,%rbp
+  8013b9:	53                   	push   %rbx
+  8013ba:	49 89 f8             	mov    %rdi,%r8
+  8013bd:	48 89 d3             	mov    %rdx,%rbx
+  8013c0:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013c3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013c8:	4c 89 c2             	mov    %r8,%rdx
+  8013cb:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013df:	c9                   	leave
+  8013e0:	c3                   	ret
+
+00000000008013e1 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013e1:	55                   	push   %rbp
+  8013e2:	48 89 e5             	mov    %rsp,%rbp
+  8013e5:	53                   	push   %rbx
+  8013e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8013ea:	89 f8                	mov    %edi,%eax
+  8013ec:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8013ef:	48 63 f9             	movslq %ecx,%rdi
+  8013f2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f5:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013fa:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801402:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801408:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80140a:	48 85 c0             	test   %rax,%rax
+  80140d:	7f 06                	jg     801415 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80140f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801413:	c9                   	leave
+  801414:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801415:	49 89 c0             	mov    %rax,%r8
+  801418:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80141d:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801424:	00 00 00 
+  801427:	be 26 00 00 00       	mov    $0x26,%esi
+  80142c:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801433:	00 00 00 
+  801436:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143b:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  801442:	00 00 00 
+  801445:	41 ff d1             	call   *%r9
+
+0000000000801448 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801448:	55                   	push   %rbp
+  801449:	48 89 e5             	mov    %rsp,%rbp
+  80144c:	53                   	push   %rbx
+  80144d:	48 83 ec 08          	sub    $0x8,%rsp
+  801451:	89 f8                	mov    %edi,%eax
+  801453:	49 89 f2             	mov    %rsi,%r10
+  801456:	48 89 cf             	mov    %rcx,%rdi
+  801459:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80145c:	48 63 da             	movslq %edx,%rbx
+  80145f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801462:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801467:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80146a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80146d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80146f:	48 85 c0             	test   %rax,%rax
+  801472:	7f 06                	jg     80147a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801474:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801478:	c9                   	leave
+  801479:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80147a:	49 89 c0             	mov    %rax,%r8
+  80147d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801482:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801489:	00 00 00 
+  80148c:	be 26 00 00 00       	mov    $0x26,%esi
+  801491:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801498:	00 00 00 
+  80149b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a0:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  8014a7:	00 00 00 
+  8014aa:	41 ff d1             	call   *%r9
+
+00000000008014ad <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8014ad:	55                   	push   %rbp
+  8014ae:	48 89 e5             	mov    %rsp,%rbp
+  8014b1:	53                   	push   %rbx
+  8014b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8014b6:	48 89 f1             	mov    %rsi,%rcx
+  8014b9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014bc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014bf:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d6:	48 85 c0             	test   %rax,%rax
+  8014d9:	7f 06                	jg     8014e1 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014df:	c9                   	leave
+  8014e0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e1:	49 89 c0             	mov    %rax,%r8
+  8014e4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014e9:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  8014f0:	00 00 00 
+  8014f3:	be 26 00 00 00       	mov    $0x26,%esi
+  8014f8:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  8014ff:	00 00 00 
+  801502:	b8 00 00 00 00       	mov    $0x0,%eax
+  801507:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  80150e:	00 00 00 
+  801511:	41 ff d1             	call   *%r9
+
+0000000000801514 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801514:	55                   	push   %rbp
+  801515:	48 89 e5             	mov    %rsp,%rbp
+  801518:	53                   	push   %rbx
+  801519:	48 83 ec 08          	sub    $0x8,%rsp
+  80151d:	89 f8                	mov    %edi,%eax
+  80151f:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801522:	48 63 f9             	movslq %ecx,%rdi
+  801525:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801528:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80152d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801530:	be 00 00 00 00       	mov    $0x0,%esi
+  801535:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80153d:	48 85 c0             	test   %rax,%rax
+  801540:	7f 06                	jg     801548 <sys_region_advise+0x34>
+}
+  801542:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801546:	c9                   	leave
+  801547:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801548:	49 89 c0             	mov    %rax,%r8
+  80154b:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801550:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801557:	00 00 00 
+  80155a:	be 26 00 00 00       	mov    $0x26,%esi
+  80155f:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801566:	00 00 00 
+  801569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156e:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  801575:	00 00 00 
+  801578:	41 ff d1             	call   *%r9
+
+000000000080157b <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  80157b:	55                   	push   %rbp
+  80157c:	48 89 e5             	mov    %rsp,%rbp
+  80157f:	53                   	push   %rbx
+  801580:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801584:	48 63 ce             	movslq %esi,%rcx
+  801587:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80158a:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80158f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801594:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801599:	be 00 00 00 00       	mov    $0x0,%esi
+  80159e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a6:	48 85 c0             	test   %rax,%rax
+  8015a9:	7f 06                	jg     8015b1 <sys_env_set_nice+0x36>
+}
+  8015ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015af:	c9                   	leave
+  8015b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b1:	49 89 c0             	mov    %rax,%r8
+  8015b4:	b9 15 00 00 00       	mov    $0x15,%ecx
+  8015b9:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  8015c0:	00 00 00 
+  8015c3:	be 26 00 00 00       	mov    $0x26,%esi
+  8015c8:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  8015cf:	00 00 00 
+  8015d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d7:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  8015de:	00 00 00 
+  8015e1:	41 ff d1             	call   *%r9
+
+00000000008015e4 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8015e4:	55                   	push   %rbp
+  8015e5:	48 89 e5             	mov    %rsp,%rbp
+  8015e8:	53                   	push   %rbx
+  8015e9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8015ed:	48 63 ce             	movslq %esi,%rcx
+  8015f0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f3:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801602:	be 00 00 00 00       	mov    $0x0,%esi
+  801607:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80160f:	48 85 c0             	test   %rax,%rax
+  801612:	7f 06                	jg     80161a <sys_env_set_status+0x36>
+}
+  801614:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801618:	c9                   	leave
+  801619:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80161a:	49 89 c0             	mov    %rax,%r8
+  80161d:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801622:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801629:	00 00 00 
+  80162c:	be 26 00 00 00       	mov    $0x26,%esi
+  801631:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801638:	00 00 00 
+  80163b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801640:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  801647:	00 00 00 
+  80164a:	41 ff d1             	call   *%r9
+
+000000000080164d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80164d:	55                   	push   %rbp
+  80164e:	48 89 e5             	mov    %rsp,%rbp
+  801651:	53                   	push   %rbx
+  801652:	48 83 ec 08          	sub    $0x8,%rsp
+  801656:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801659:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80165c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801661:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801666:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80166b:	be 00 00 00 00       	mov    $0x0,%esi
+  801670:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801676:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801678:	48 85 c0             	test   %rax,%rax
+  80167b:	7f 06                	jg     801683 <sys_env_set_trapframe+0x36>
+}
+  80167d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801681:	c9                   	leave
+  801682:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801683:	49 89 c0             	mov    %rax,%r8
+  801686:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80168b:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801692:	00 00 00 
+  801695:	be 26 00 00 00       	mov    $0x26,%esi
+  80169a:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  8016a1:	00 00 00 
+  8016a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a9:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  8016b0:	00 00 00 
+  8016b3:	41 ff d1             	call   *%r9
+
+00000000008016b6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8016b6:	55                   	push   %rbp
+  8016b7:	48 89 e5             	mov    %rsp,%rbp
+  8016ba:	53                   	push   %rbx
+  8016bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8016bf:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8016c2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c5:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016cf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016df:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016e1:	48 85 c0             	test   %rax,%rax
+  8016e4:	7f 06                	jg     8016ec <sys_env_set_pgfault_upcall+0x36>
+}
+  8016e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ea:	c9                   	leave
+  8016eb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ec:	49 89 c0             	mov    %rax,%r8
+  8016ef:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8016f4:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  8016fb:	00 00 00 
+  8016fe:	be 26 00 00 00       	mov    $0x26,%esi
+  801703:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  80170a:	00 00 00 
+  80170d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801712:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  801719:	00 00 00 
+  80171c:	41 ff d1             	call   *%r9
+
+000000000080171f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80171f:	55                   	push   %rbp
+  801720:	48 89 e5             	mov    %rsp,%rbp
+  801723:	53                   	push   %rbx
+  801724:	89 f8                	mov    %edi,%eax
+  801726:	49 89 f1             	mov    %rsi,%r9
+  801729:	48 89 d3             	mov    %rdx,%rbx
+  80172c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80172f:	49 63 f0             	movslq %r8d,%rsi
+  801732:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801735:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80173a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80173d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801743:	cd 30                	int    $0x30
+}
+  801745:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801749:	c9                   	leave
+  80174a:	c3                   	ret
+
+000000000080174b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80174b:	55                   	push   %rbp
+  80174c:	48 89 e5             	mov    %rsp,%rbp
+  80174f:	53                   	push   %rbx
+  801750:	48 83 ec 08          	sub    $0x8,%rsp
+  801754:	48 89 fa             	mov    %rdi,%rdx
+  801757:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80175a:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80175f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801764:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801769:	be 00 00 00 00       	mov    $0x0,%esi
+  80176e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801774:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801776:	48 85 c0             	test   %rax,%rax
+  801779:	7f 06                	jg     801781 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80177b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80177f:	c9                   	leave
+  801780:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801781:	49 89 c0             	mov    %rax,%r8
+  801784:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801789:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801790:	00 00 00 
+  801793:	be 26 00 00 00       	mov    $0x26,%esi
+  801798:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  80179f:	00 00 00 
+  8017a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a7:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  8017ae:	00 00 00 
+  8017b1:	41 ff d1             	call   *%r9
+
+00000000008017b4 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8017b4:	55                   	push   %rbp
+  8017b5:	48 89 e5             	mov    %rsp,%rbp
+  8017b8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017b9:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017dd:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e3:	c9                   	leave
+  8017e4:	c3                   	ret
+
+00000000008017e5 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8017e5:	55                   	push   %rbp
+  8017e6:	48 89 e5             	mov    %rsp,%rbp
+  8017e9:	53                   	push   %rbx
+  8017ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ee:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8017f1:	48 63 ce             	movslq %esi,%rcx
+  8017f4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017f7:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801801:	be 00 00 00 00       	mov    $0x0,%esi
+  801806:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80180c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80180e:	48 85 c0             	test   %rax,%rax
+  801811:	7f 06                	jg     801819 <sys_sigqueue+0x34>
+}
+  801813:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801817:	c9                   	leave
+  801818:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801819:	49 89 c0             	mov    %rax,%r8
+  80181c:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801821:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801828:	00 00 00 
+  80182b:	be 26 00 00 00       	mov    $0x26,%esi
+  801830:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801837:	00 00 00 
+  80183a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80183f:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  801846:	00 00 00 
+  801849:	41 ff d1             	call   *%r9
+
+000000000080184c <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  80184c:	55                   	push   %rbp
+  80184d:	48 89 e5             	mov    %rsp,%rbp
+  801850:	53                   	push   %rbx
+  801851:	48 83 ec 08          	sub    $0x8,%rsp
+  801855:	48 89 fa             	mov    %rdi,%rdx
+  801858:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80185b:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801860:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801865:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80186a:	be 00 00 00 00       	mov    $0x0,%esi
+  80186f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801875:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801877:	48 85 c0             	test   %rax,%rax
+  80187a:	7f 06                	jg     801882 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  80187c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801880:	c9                   	leave
+  801881:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801882:	49 89 c0             	mov    %rax,%r8
+  801885:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80188a:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801891:	00 00 00 
+  801894:	be 26 00 00 00       	mov    $0x26,%esi
+  801899:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  8018a0:	00 00 00 
+  8018a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a8:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  8018af:	00 00 00 
+  8018b2:	41 ff d1             	call   *%r9
+
+00000000008018b5 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  8018b5:	55                   	push   %rbp
+  8018b6:	48 89 e5             	mov    %rsp,%rbp
+  8018b9:	53                   	push   %rbx
+  8018ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8018be:	48 89 f1             	mov    %rsi,%rcx
+  8018c1:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  8018c4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018c7:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8018d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018de:	48 85 c0             	test   %rax,%rax
+  8018e1:	7f 06                	jg     8018e9 <sys_sigaction+0x34>
+}
+  8018e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018e7:	c9                   	leave
+  8018e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018e9:	49 89 c0             	mov    %rax,%r8
+  8018ec:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8018f1:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  8018f8:	00 00 00 
+  8018fb:	be 26 00 00 00       	mov    $0x26,%esi
+  801900:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801907:	00 00 00 
+  80190a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190f:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  801916:	00 00 00 
+  801919:	41 ff d1             	call   *%r9
+
+000000000080191c <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  80191c:	55                   	push   %rbp
+  80191d:	48 89 e5             	mov    %rsp,%rbp
+  801920:	53                   	push   %rbx
+  801921:	48 83 ec 08          	sub    $0x8,%rsp
+  801925:	48 89 f1             	mov    %rsi,%rcx
+  801928:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  80192b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80192e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801933:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801938:	be 00 00 00 00       	mov    $0x0,%esi
+  80193d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801943:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801945:	48 85 c0             	test   %rax,%rax
+  801948:	7f 06                	jg     801950 <sys_sigprocmask+0x34>
+}
+  80194a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80194e:	c9                   	leave
+  80194f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801950:	49 89 c0             	mov    %rax,%r8
+  801953:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801958:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  80195f:	00 00 00 
+  801962:	be 26 00 00 00       	mov    $0x26,%esi
+  801967:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  80196e:	00 00 00 
+  801971:	b8 00 00 00 00       	mov    $0x0,%eax
+  801976:	49 b9 bc 03 80 00 00 	movabs $0x8003bc,%r9
+  80197d:	00 00 00 
+  801980:	41 ff d1             	call   *%r9
+
+0000000000801983 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801983:	55                   	push   %rbp
+  801984:	48 89 e5             	mov    %rsp,%rbp
+  801987:	41 54                	push   %r12
+  801989:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80198a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80198f:	cd 30                	int    $0x30
+  801991:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  801994:	85 c0                	test   %eax,%eax
+  801996:	78 76                	js     801a0e <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  801998:	74 7c                	je     801a16 <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  80199a:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8019a0:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8019a7:	00 00 00 
+  8019aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019af:	89 c2                	mov    %eax,%edx
+  8019b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019bb:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  8019c2:	00 00 00 
+  8019c5:	ff d0                	call   *%rax
+  8019c7:	85 c0                	test   %eax,%eax
+  8019c9:	75 7a                	jne    801a45 <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  8019cb:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  8019d2:	00 00 00 
+  8019d5:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8019dc:	44 89 e7             	mov    %r12d,%edi
+  8019df:	48 b8 b6 16 80 00 00 	movabs $0x8016b6,%rax
+  8019e6:	00 00 00 
+  8019e9:	ff d0                	call   *%rax
+  8019eb:	85 c0                	test   %eax,%eax
+  8019ed:	75 5e                	jne    801a4d <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  8019ef:	be 02 00 00 00       	mov    $0x2,%esi
+  8019f4:	44 89 e7             	mov    %r12d,%edi
+  8019f7:	48 b8 e4 15 80 00 00 	movabs $0x8015e4,%rax
+  8019fe:	00 00 00 
+  801a01:	ff d0                	call   *%rax
+        return -1;
+  801a03:	85 c0                	test   %eax,%eax
+  801a05:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801a0a:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  801a0e:	44 89 e0             	mov    %r12d,%eax
+  801a11:	5b                   	pop    %rbx
+  801a12:	41 5c                	pop    %r12
+  801a14:	5d                   	pop    %rbp
+  801a15:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  801a16:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  801a1d:	00 00 00 
+  801a20:	ff d0                	call   *%rax
+  801a22:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  801a25:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  801a2c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801a33:	00 00 00 
+  801a36:	48 01 d0             	add    %rdx,%rax
+  801a39:	48 a3 00 54 80 00 00 	movabs %rax,0x805400
+  801a40:	00 00 00 
+        return 0;
+  801a43:	eb c9                	jmp    801a0e <fork+0x8b>
+        return -1;
+  801a45:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801a4b:	eb c1                	jmp    801a0e <fork+0x8b>
+        return -1;
+  801a4d:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801a53:	eb b9                	jmp    801a0e <fork+0x8b>
+
+0000000000801a55 <sfork>:
+
+envid_t
+sfork() {
+  801a55:	55                   	push   %rbp
+  801a56:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801a59:	48 ba 7d 36 80 00 00 	movabs $0x80367d,%rdx
+  801a60:	00 00 00 
+  801a63:	be 2e 00 00 00       	mov    $0x2e,%esi
+  801a68:	48 bf 98 36 80 00 00 	movabs $0x803698,%rdi
+  801a6f:	00 00 00 
+  801a72:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a77:	48 b9 bc 03 80 00 00 	movabs $0x8003bc,%rcx
+  801a7e:	00 00 00 
+  801a81:	ff d1                	call   *%rcx
+
+0000000000801a83 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a83:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a8a:	ff ff ff 
+  801a8d:	48 01 f8             	add    %rdi,%rax
+  801a90:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a94:	c3                   	ret
+
+0000000000801a95 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a95:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a9c:	ff ff ff 
+  801a9f:	48 01 f8             	add    %rdi,%rax
+  801aa2:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801aa6:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801aac:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801ab0:	c3                   	ret
+
+0000000000801ab1 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801ab1:	55                   	push   %rbp
+  801ab2:	48 89 e5             	mov    %rsp,%rbp
+  801ab5:	41 57                	push   %r15
+  801ab7:	41 56                	push   %r14
+  801ab9:	41 55                	push   %r13
+  801abb:	41 54                	push   %r12
+  801abd:	53                   	push   %rbx
+  801abe:	48 83 ec 08          	sub    $0x8,%rsp
+  801ac2:	49 89 ff             	mov    %rdi,%r15
+  801ac5:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801aca:	49 bd e1 2a 80 00 00 	movabs $0x802ae1,%r13
+  801ad1:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801ad4:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801ada:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801add:	48 89 df             	mov    %rbx,%rdi
+  801ae0:	41 ff d5             	call   *%r13
+  801ae3:	83 e0 04             	and    $0x4,%eax
+  801ae6:	74 17                	je     801aff <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801ae8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801aef:	4c 39 f3             	cmp    %r14,%rbx
+  801af2:	75 e6                	jne    801ada <fd_alloc+0x29>
+  801af4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801afa:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801aff:	4d 89 27             	mov    %r12,(%r15)
+}
+  801b02:	48 83 c4 08          	add    $0x8,%rsp
+  801b06:	5b                   	pop    %rbx
+  801b07:	41 5c                	pop    %r12
+  801b09:	41 5d                	pop    %r13
+  801b0b:	41 5e                	pop    %r14
+  801b0d:	41 5f                	pop    %r15
+  801b0f:	5d                   	pop    %rbp
+  801b10:	c3                   	ret
+
+0000000000801b11 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801b11:	83 ff 1f             	cmp    $0x1f,%edi
+  801b14:	77 39                	ja     801b4f <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801b16:	55                   	push   %rbp
+  801b17:	48 89 e5             	mov    %rsp,%rbp
+  801b1a:	41 54                	push   %r12
+  801b1c:	53                   	push   %rbx
+  801b1d:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801b20:	48 63 df             	movslq %edi,%rbx
+  801b23:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801b2a:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801b2e:	48 89 df             	mov    %rbx,%rdi
+  801b31:	48 b8 e1 2a 80 00 00 	movabs $0x802ae1,%rax
+  801b38:	00 00 00 
+  801b3b:	ff d0                	call   *%rax
+  801b3d:	a8 04                	test   $0x4,%al
+  801b3f:	74 14                	je     801b55 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801b41:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801b45:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b4a:	5b                   	pop    %rbx
+  801b4b:	41 5c                	pop    %r12
+  801b4d:	5d                   	pop    %rbp
+  801b4e:	c3                   	ret
+        return -E_INVAL;
+  801b4f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b54:	c3                   	ret
+        return -E_INVAL;
+  801b55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b5a:	eb ee                	jmp    801b4a <fd_lookup+0x39>
+
+0000000000801b5c <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b5c:	55                   	push   %rbp
+  801b5d:	48 89 e5             	mov    %rsp,%rbp
+  801b60:	41 54                	push   %r12
+  801b62:	53                   	push   %rbx
+  801b63:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b66:	48 b8 40 37 80 00 00 	movabs $0x803740,%rax
+  801b6d:	00 00 00 
+  801b70:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801b77:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b7a:	39 3b                	cmp    %edi,(%rbx)
+  801b7c:	74 47                	je     801bc5 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b7e:	48 83 c0 08          	add    $0x8,%rax
+  801b82:	48 8b 18             	mov    (%rax),%rbx
+  801b85:	48 85 db             	test   %rbx,%rbx
+  801b88:	75 f0                	jne    801b7a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b8a:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  801b91:	00 00 00 
+  801b94:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b9a:	89 fa                	mov    %edi,%edx
+  801b9c:	48 bf a8 36 80 00 00 	movabs $0x8036a8,%rdi
+  801ba3:	00 00 00 
+  801ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bab:	48 b9 0c 05 80 00 00 	movabs $0x80050c,%rcx
+  801bb2:	00 00 00 
+  801bb5:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801bb7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801bbc:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801bc0:	5b                   	pop    %rbx
+  801bc1:	41 5c                	pop    %r12
+  801bc3:	5d                   	pop    %rbp
+  801bc4:	c3                   	ret
+            return 0;
+  801bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bca:	eb f0                	jmp    801bbc <dev_lookup+0x60>
+
+0000000000801bcc <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801bcc:	55                   	push   %rbp
+  801bcd:	48 89 e5             	mov    %rsp,%rbp
+  801bd0:	41 55                	push   %r13
+  801bd2:	41 54                	push   %r12
+  801bd4:	53                   	push   %rbx
+  801bd5:	48 83 ec 18          	sub    $0x18,%rsp
+  801bd9:	48 89 fb             	mov    %rdi,%rbx
+  801bdc:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801bdf:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801be6:	ff ff ff 
+  801be9:	48 01 df             	add    %rbx,%rdi
+  801bec:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801bf0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bf4:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801bfb:	00 00 00 
+  801bfe:	ff d0                	call   *%rax
+  801c00:	41 89 c5             	mov    %eax,%r13d
+  801c03:	85 c0                	test   %eax,%eax
+  801c05:	78 06                	js     801c0d <fd_close+0x41>
+  801c07:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801c0b:	74 1a                	je     801c27 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801c0d:	45 84 e4             	test   %r12b,%r12b
+  801c10:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c15:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801c19:	44 89 e8             	mov    %r13d,%eax
+  801c1c:	48 83 c4 18          	add    $0x18,%rsp
+  801c20:	5b                   	pop    %rbx
+  801c21:	41 5c                	pop    %r12
+  801c23:	41 5d                	pop    %r13
+  801c25:	5d                   	pop    %rbp
+  801c26:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c27:	8b 3b                	mov    (%rbx),%edi
+  801c29:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c2d:	48 b8 5c 1b 80 00 00 	movabs $0x801b5c,%rax
+  801c34:	00 00 00 
+  801c37:	ff d0                	call   *%rax
+  801c39:	41 89 c5             	mov    %eax,%r13d
+  801c3c:	85 c0                	test   %eax,%eax
+  801c3e:	78 1b                	js     801c5b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801c40:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c44:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c48:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c4e:	48 85 c0             	test   %rax,%rax
+  801c51:	74 08                	je     801c5b <fd_close+0x8f>
+  801c53:	48 89 df             	mov    %rbx,%rdi
+  801c56:	ff d0                	call   *%rax
+  801c58:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c5b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c60:	48 89 de             	mov    %rbx,%rsi
+  801c63:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c68:	48 b8 ad 14 80 00 00 	movabs $0x8014ad,%rax
+  801c6f:	00 00 00 
+  801c72:	ff d0                	call   *%rax
+    return res;
+  801c74:	eb a3                	jmp    801c19 <fd_close+0x4d>
+
+0000000000801c76 <close>:
+
+int
+close(int fdnum) {
+  801c76:	55                   	push   %rbp
+  801c77:	48 89 e5             	mov    %rsp,%rbp
+  801c7a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c7e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c82:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801c89:	00 00 00 
+  801c8c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c8e:	85 c0                	test   %eax,%eax
+  801c90:	78 15                	js     801ca7 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c92:	be 01 00 00 00       	mov    $0x1,%esi
+  801c97:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c9b:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  801ca2:	00 00 00 
+  801ca5:	ff d0                	call   *%rax
+}
+  801ca7:	c9                   	leave
+  801ca8:	c3                   	ret
+
+0000000000801ca9 <close_all>:
+
+void
+close_all(void) {
+  801ca9:	55                   	push   %rbp
+  801caa:	48 89 e5             	mov    %rsp,%rbp
+  801cad:	41 54                	push   %r12
+  801caf:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801cb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cb5:	49 bc 76 1c 80 00 00 	movabs $0x801c76,%r12
+  801cbc:	00 00 00 
+  801cbf:	89 df                	mov    %ebx,%edi
+  801cc1:	41 ff d4             	call   *%r12
+  801cc4:	83 c3 01             	add    $0x1,%ebx
+  801cc7:	83 fb 20             	cmp    $0x20,%ebx
+  801cca:	75 f3                	jne    801cbf <close_all+0x16>
+}
+  801ccc:	5b                   	pop    %rbx
+  801ccd:	41 5c                	pop    %r12
+  801ccf:	5d                   	pop    %rbp
+  801cd0:	c3                   	ret
+
+0000000000801cd1 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801cd1:	55                   	push   %rbp
+  801cd2:	48 89 e5             	mov    %rsp,%rbp
+  801cd5:	41 57                	push   %r15
+  801cd7:	41 56                	push   %r14
+  801cd9:	41 55                	push   %r13
+  801cdb:	41 54                	push   %r12
+  801cdd:	53                   	push   %rbx
+  801cde:	48 83 ec 18          	sub    $0x18,%rsp
+  801ce2:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801ce5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ce9:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801cf0:	00 00 00 
+  801cf3:	ff d0                	call   *%rax
+  801cf5:	89 c3                	mov    %eax,%ebx
+  801cf7:	85 c0                	test   %eax,%eax
+  801cf9:	0f 88 b8 00 00 00    	js     801db7 <dup+0xe6>
+    close(newfdnum);
+  801cff:	44 89 e7             	mov    %r12d,%edi
+  801d02:	48 b8 76 1c 80 00 00 	movabs $0x801c76,%rax
+  801d09:	00 00 00 
+  801d0c:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801d0e:	4d 63 ec             	movslq %r12d,%r13
+  801d11:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801d18:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801d1c:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801d20:	4c 89 ff             	mov    %r15,%rdi
+  801d23:	49 be 95 1a 80 00 00 	movabs $0x801a95,%r14
+  801d2a:	00 00 00 
+  801d2d:	41 ff d6             	call   *%r14
+  801d30:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801d33:	4c 89 ef             	mov    %r13,%rdi
+  801d36:	41 ff d6             	call   *%r14
+  801d39:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801d3c:	48 89 df             	mov    %rbx,%rdi
+  801d3f:	48 b8 e1 2a 80 00 00 	movabs $0x802ae1,%rax
+  801d46:	00 00 00 
+  801d49:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801d4b:	a8 04                	test   $0x4,%al
+  801d4d:	74 2b                	je     801d7a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801d4f:	41 89 c1             	mov    %eax,%r9d
+  801d52:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d58:	4c 89 f1             	mov    %r14,%rcx
+  801d5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d60:	48 89 de             	mov    %rbx,%rsi
+  801d63:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d68:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  801d6f:	00 00 00 
+  801d72:	ff d0                	call   *%rax
+  801d74:	89 c3                	mov    %eax,%ebx
+  801d76:	85 c0                	test   %eax,%eax
+  801d78:	78 4e                	js     801dc8 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d7a:	4c 89 ff             	mov    %r15,%rdi
+  801d7d:	48 b8 e1 2a 80 00 00 	movabs $0x802ae1,%rax
+  801d84:	00 00 00 
+  801d87:	ff d0                	call   *%rax
+  801d89:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d8c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d92:	4c 89 e9             	mov    %r13,%rcx
+  801d95:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9a:	4c 89 fe             	mov    %r15,%rsi
+  801d9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801da2:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  801da9:	00 00 00 
+  801dac:	ff d0                	call   *%rax
+  801dae:	89 c3                	mov    %eax,%ebx
+  801db0:	85 c0                	test   %eax,%eax
+  801db2:	78 14                	js     801dc8 <dup+0xf7>
+
+    return newfdnum;
+  801db4:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801db7:	89 d8                	mov    %ebx,%eax
+  801db9:	48 83 c4 18          	add    $0x18,%rsp
+  801dbd:	5b                   	pop    %rbx
+  801dbe:	41 5c                	pop    %r12
+  801dc0:	41 5d                	pop    %r13
+  801dc2:	41 5e                	pop    %r14
+  801dc4:	41 5f                	pop    %r15
+  801dc6:	5d                   	pop    %rbp
+  801dc7:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801dc8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801dcd:	4c 89 ee             	mov    %r13,%rsi
+  801dd0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dd5:	49 bc ad 14 80 00 00 	movabs $0x8014ad,%r12
+  801ddc:	00 00 00 
+  801ddf:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801de2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801de7:	4c 89 f6             	mov    %r14,%rsi
+  801dea:	bf 00 00 00 00       	mov    $0x0,%edi
+  801def:	41 ff d4             	call   *%r12
+    return res;
+  801df2:	eb c3                	jmp    801db7 <dup+0xe6>
+
+0000000000801df4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801df4:	55                   	push   %rbp
+  801df5:	48 89 e5             	mov    %rsp,%rbp
+  801df8:	41 56                	push   %r14
+  801dfa:	41 55                	push   %r13
+  801dfc:	41 54                	push   %r12
+  801dfe:	53                   	push   %rbx
+  801dff:	48 83 ec 10          	sub    $0x10,%rsp
+  801e03:	89 fb                	mov    %edi,%ebx
+  801e05:	49 89 f4             	mov    %rsi,%r12
+  801e08:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e0b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e0f:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801e16:	00 00 00 
+  801e19:	ff d0                	call   *%rax
+  801e1b:	85 c0                	test   %eax,%eax
+  801e1d:	78 4c                	js     801e6b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e1f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e23:	41 8b 3e             	mov    (%r14),%edi
+  801e26:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e2a:	48 b8 5c 1b 80 00 00 	movabs $0x801b5c,%rax
+  801e31:	00 00 00 
+  801e34:	ff d0                	call   *%rax
+  801e36:	85 c0                	test   %eax,%eax
+  801e38:	78 35                	js     801e6f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e3a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e3e:	83 e0 03             	and    $0x3,%eax
+  801e41:	83 f8 01             	cmp    $0x1,%eax
+  801e44:	74 2d                	je     801e73 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e46:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e4a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e4e:	48 85 c0             	test   %rax,%rax
+  801e51:	74 56                	je     801ea9 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801e53:	4c 89 ea             	mov    %r13,%rdx
+  801e56:	4c 89 e6             	mov    %r12,%rsi
+  801e59:	4c 89 f7             	mov    %r14,%rdi
+  801e5c:	ff d0                	call   *%rax
+}
+  801e5e:	48 83 c4 10          	add    $0x10,%rsp
+  801e62:	5b                   	pop    %rbx
+  801e63:	41 5c                	pop    %r12
+  801e65:	41 5d                	pop    %r13
+  801e67:	41 5e                	pop    %r14
+  801e69:	5d                   	pop    %rbp
+  801e6a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e6b:	48 98                	cltq
+  801e6d:	eb ef                	jmp    801e5e <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e6f:	48 98                	cltq
+  801e71:	eb eb                	jmp    801e5e <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e73:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  801e7a:	00 00 00 
+  801e7d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e83:	89 da                	mov    %ebx,%edx
+  801e85:	48 bf e9 36 80 00 00 	movabs $0x8036e9,%rdi
+  801e8c:	00 00 00 
+  801e8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e94:	48 b9 0c 05 80 00 00 	movabs $0x80050c,%rcx
+  801e9b:	00 00 00 
+  801e9e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ea0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ea7:	eb b5                	jmp    801e5e <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ea9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801eb0:	eb ac                	jmp    801e5e <read+0x6a>
+
+0000000000801eb2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801eb2:	55                   	push   %rbp
+  801eb3:	48 89 e5             	mov    %rsp,%rbp
+  801eb6:	41 57                	push   %r15
+  801eb8:	41 56                	push   %r14
+  801eba:	41 55                	push   %r13
+  801ebc:	41 54                	push   %r12
+  801ebe:	53                   	push   %rbx
+  801ebf:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801ec3:	48 85 d2             	test   %rdx,%rdx
+  801ec6:	74 54                	je     801f1c <readn+0x6a>
+  801ec8:	41 89 fd             	mov    %edi,%r13d
+  801ecb:	49 89 f6             	mov    %rsi,%r14
+  801ece:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801ed1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801ed6:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801edb:	49 bf f4 1d 80 00 00 	movabs $0x801df4,%r15
+  801ee2:	00 00 00 
+  801ee5:	4c 89 e2             	mov    %r12,%rdx
+  801ee8:	48 29 f2             	sub    %rsi,%rdx
+  801eeb:	4c 01 f6             	add    %r14,%rsi
+  801eee:	44 89 ef             	mov    %r13d,%edi
+  801ef1:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801ef4:	85 c0                	test   %eax,%eax
+  801ef6:	78 20                	js     801f18 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ef8:	01 c3                	add    %eax,%ebx
+  801efa:	85 c0                	test   %eax,%eax
+  801efc:	74 08                	je     801f06 <readn+0x54>
+  801efe:	48 63 f3             	movslq %ebx,%rsi
+  801f01:	4c 39 e6             	cmp    %r12,%rsi
+  801f04:	72 df                	jb     801ee5 <readn+0x33>
+    }
+    return res;
+  801f06:	48 63 c3             	movslq %ebx,%rax
+}
+  801f09:	48 83 c4 08          	add    $0x8,%rsp
+  801f0d:	5b                   	pop    %rbx
+  801f0e:	41 5c                	pop    %r12
+  801f10:	41 5d                	pop    %r13
+  801f12:	41 5e                	pop    %r14
+  801f14:	41 5f                	pop    %r15
+  801f16:	5d                   	pop    %rbp
+  801f17:	c3                   	ret
+        if (inc < 0) return inc;
+  801f18:	48 98                	cltq
+  801f1a:	eb ed                	jmp    801f09 <readn+0x57>
+    int inc = 1, res = 0;
+  801f1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f21:	eb e3                	jmp    801f06 <readn+0x54>
+
+0000000000801f23 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f23:	55                   	push   %rbp
+  801f24:	48 89 e5             	mov    %rsp,%rbp
+  801f27:	41 56                	push   %r14
+  801f29:	41 55                	push   %r13
+  801f2b:	41 54                	push   %r12
+  801f2d:	53                   	push   %rbx
+  801f2e:	48 83 ec 10          	sub    $0x10,%rsp
+  801f32:	89 fb                	mov    %edi,%ebx
+  801f34:	49 89 f4             	mov    %rsi,%r12
+  801f37:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f3a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f3e:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801f45:	00 00 00 
+  801f48:	ff d0                	call   *%rax
+  801f4a:	85 c0                	test   %eax,%eax
+  801f4c:	78 47                	js     801f95 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f4e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f52:	41 8b 3e             	mov    (%r14),%edi
+  801f55:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f59:	48 b8 5c 1b 80 00 00 	movabs $0x801b5c,%rax
+  801f60:	00 00 00 
+  801f63:	ff d0                	call   *%rax
+  801f65:	85 c0                	test   %eax,%eax
+  801f67:	78 30                	js     801f99 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f69:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f6e:	74 2d                	je     801f9d <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f70:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f74:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f78:	48 85 c0             	test   %rax,%rax
+  801f7b:	74 56                	je     801fd3 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f7d:	4c 89 ea             	mov    %r13,%rdx
+  801f80:	4c 89 e6             	mov    %r12,%rsi
+  801f83:	4c 89 f7             	mov    %r14,%rdi
+  801f86:	ff d0                	call   *%rax
+}
+  801f88:	48 83 c4 10          	add    $0x10,%rsp
+  801f8c:	5b                   	pop    %rbx
+  801f8d:	41 5c                	pop    %r12
+  801f8f:	41 5d                	pop    %r13
+  801f91:	41 5e                	pop    %r14
+  801f93:	5d                   	pop    %rbp
+  801f94:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f95:	48 98                	cltq
+  801f97:	eb ef                	jmp    801f88 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f99:	48 98                	cltq
+  801f9b:	eb eb                	jmp    801f88 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f9d:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  801fa4:	00 00 00 
+  801fa7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fad:	89 da                	mov    %ebx,%edx
+  801faf:	48 bf 05 37 80 00 00 	movabs $0x803705,%rdi
+  801fb6:	00 00 00 
+  801fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fbe:	48 b9 0c 05 80 00 00 	movabs $0x80050c,%rcx
+  801fc5:	00 00 00 
+  801fc8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fca:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fd1:	eb b5                	jmp    801f88 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fd3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fda:	eb ac                	jmp    801f88 <write+0x65>
+
+0000000000801fdc <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801fdc:	55                   	push   %rbp
+  801fdd:	48 89 e5             	mov    %rsp,%rbp
+  801fe0:	53                   	push   %rbx
+  801fe1:	48 83 ec 18          	sub    $0x18,%rsp
+  801fe5:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fe7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801feb:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801ff2:	00 00 00 
+  801ff5:	ff d0                	call   *%rax
+  801ff7:	85 c0                	test   %eax,%eax
+  801ff9:	78 0c                	js     802007 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801ffb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fff:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802002:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802007:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80200b:	c9                   	leave
+  80200c:	c3                   	ret
+
+000000000080200d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80200d:	55                   	push   %rbp
+  80200e:	48 89 e5             	mov    %rsp,%rbp
+  802011:	41 55                	push   %r13
+  802013:	41 54                	push   %r12
+  802015:	53                   	push   %rbx
+  802016:	48 83 ec 18          	sub    $0x18,%rsp
+  80201a:	89 fb                	mov    %edi,%ebx
+  80201c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80201f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802023:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  80202a:	00 00 00 
+  80202d:	ff d0                	call   *%rax
+  80202f:	85 c0                	test   %eax,%eax
+  802031:	78 38                	js     80206b <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802033:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802037:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80203b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80203f:	48 b8 5c 1b 80 00 00 	movabs $0x801b5c,%rax
+  802046:	00 00 00 
+  802049:	ff d0                	call   *%rax
+  80204b:	85 c0                	test   %eax,%eax
+  80204d:	78 1c                	js     80206b <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80204f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802054:	74 20                	je     802076 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802056:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80205a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80205e:	48 85 c0             	test   %rax,%rax
+  802061:	74 47                	je     8020aa <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802063:	44 89 e6             	mov    %r12d,%esi
+  802066:	4c 89 ef             	mov    %r13,%rdi
+  802069:	ff d0                	call   *%rax
+}
+  80206b:	48 83 c4 18          	add    $0x18,%rsp
+  80206f:	5b                   	pop    %rbx
+  802070:	41 5c                	pop    %r12
+  802072:	41 5d                	pop    %r13
+  802074:	5d                   	pop    %rbp
+  802075:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802076:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  80207d:	00 00 00 
+  802080:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802086:	89 da                	mov    %ebx,%edx
+  802088:	48 bf c8 36 80 00 00 	movabs $0x8036c8,%rdi
+  80208f:	00 00 00 
+  802092:	b8 00 00 00 00       	mov    $0x0,%eax
+  802097:	48 b9 0c 05 80 00 00 	movabs $0x80050c,%rcx
+  80209e:	00 00 00 
+  8020a1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020a8:	eb c1                	jmp    80206b <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020aa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020af:	eb ba                	jmp    80206b <ftruncate+0x5e>
+
+00000000008020b1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8020b1:	55                   	push   %rbp
+  8020b2:	48 89 e5             	mov    %rsp,%rbp
+  8020b5:	41 54                	push   %r12
+  8020b7:	53                   	push   %rbx
+  8020b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8020bc:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020bf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020c3:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  8020ca:	00 00 00 
+  8020cd:	ff d0                	call   *%rax
+  8020cf:	85 c0                	test   %eax,%eax
+  8020d1:	78 4e                	js     802121 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020d3:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8020d7:	41 8b 3c 24          	mov    (%r12),%edi
+  8020db:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020df:	48 b8 5c 1b 80 00 00 	movabs $0x801b5c,%rax
+  8020e6:	00 00 00 
+  8020e9:	ff d0                	call   *%rax
+  8020eb:	85 c0                	test   %eax,%eax
+  8020ed:	78 32                	js     802121 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020f3:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8020f8:	74 30                	je     80212a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8020fa:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8020fd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802104:	00 00 00 
+    stat->st_isdir = 0;
+  802107:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80210e:	00 00 00 
+    stat->st_dev = dev;
+  802111:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802118:	48 89 de             	mov    %rbx,%rsi
+  80211b:	4c 89 e7             	mov    %r12,%rdi
+  80211e:	ff 50 28             	call   *0x28(%rax)
+}
+  802121:	48 83 c4 10          	add    $0x10,%rsp
+  802125:	5b                   	pop    %rbx
+  802126:	41 5c                	pop    %r12
+  802128:	5d                   	pop    %rbp
+  802129:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80212a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80212f:	eb f0                	jmp    802121 <fstat+0x70>
+
+0000000000802131 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802131:	55                   	push   %rbp
+  802132:	48 89 e5             	mov    %rsp,%rbp
+  802135:	41 54                	push   %r12
+  802137:	53                   	push   %rbx
+  802138:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80213b:	be 00 00 00 00       	mov    $0x0,%esi
+  802140:	48 b8 b2 23 80 00 00 	movabs $0x8023b2,%rax
+  802147:	00 00 00 
+  80214a:	ff d0                	call   *%rax
+  80214c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80214e:	85 c0                	test   %eax,%eax
+  802150:	78 25                	js     802177 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802152:	4c 89 e6             	mov    %r12,%rsi
+  802155:	89 c7                	mov    %eax,%edi
+  802157:	48 b8 b1 20 80 00 00 	movabs $0x8020b1,%rax
+  80215e:	00 00 00 
+  802161:	ff d0                	call   *%rax
+  802163:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802166:	89 df                	mov    %ebx,%edi
+  802168:	48 b8 76 1c 80 00 00 	movabs $0x801c76,%rax
+  80216f:	00 00 00 
+  802172:	ff d0                	call   *%rax
+
+    return res;
+  802174:	44 89 e3             	mov    %r12d,%ebx
+}
+  802177:	89 d8                	mov    %ebx,%eax
+  802179:	5b                   	pop    %rbx
+  80217a:	41 5c                	pop    %r12
+  80217c:	5d                   	pop    %rbp
+  80217d:	c3                   	ret
+
+000000000080217e <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  80217e:	55                   	push   %rbp
+  80217f:	48 89 e5             	mov    %rsp,%rbp
+  802182:	41 54                	push   %r12
+  802184:	53                   	push   %rbx
+  802185:	48 83 ec 10          	sub    $0x10,%rsp
+  802189:	41 89 fc             	mov    %edi,%r12d
+  80218c:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80218f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802196:	00 00 00 
+  802199:	83 38 00             	cmpl   $0x0,(%rax)
+  80219c:	74 5e                	je     8021fc <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80219e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8021a4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021a9:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8021b0:	00 00 00 
+  8021b3:	44 89 e6             	mov    %r12d,%esi
+  8021b6:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8021bd:	00 00 00 
+  8021c0:	8b 38                	mov    (%rax),%edi
+  8021c2:	48 b8 9d 2e 80 00 00 	movabs $0x802e9d,%rax
+  8021c9:	00 00 00 
+  8021cc:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8021ce:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8021d5:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8021d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021db:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8021df:	48 89 de             	mov    %rbx,%rsi
+  8021e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021e7:	48 b8 08 2e 80 00 00 	movabs $0x802e08,%rax
+  8021ee:	00 00 00 
+  8021f1:	ff d0                	call   *%rax
+}
+  8021f3:	48 83 c4 10          	add    $0x10,%rsp
+  8021f7:	5b                   	pop    %rbx
+  8021f8:	41 5c                	pop    %r12
+  8021fa:	5d                   	pop    %rbp
+  8021fb:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021fc:	bf 03 00 00 00       	mov    $0x3,%edi
+  802201:	48 b8 3d 2f 80 00 00 	movabs $0x802f3d,%rax
+  802208:	00 00 00 
+  80220b:	ff d0                	call   *%rax
+  80220d:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802214:	00 00 
+  802216:	eb 86                	jmp    80219e <fsipc+0x20>
+
+0000000000802218 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802218:	55                   	push   %rbp
+  802219:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80221c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802223:	00 00 00 
+  802226:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802229:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80222b:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80222e:	be 00 00 00 00       	mov    $0x0,%esi
+  802233:	bf 02 00 00 00       	mov    $0x2,%edi
+  802238:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  80223f:	00 00 00 
+  802242:	ff d0                	call   *%rax
+}
+  802244:	5d                   	pop    %rbp
+  802245:	c3                   	ret
+
+0000000000802246 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802246:	55                   	push   %rbp
+  802247:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80224a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80224d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802254:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802256:	be 00 00 00 00       	mov    $0x0,%esi
+  80225b:	bf 06 00 00 00       	mov    $0x6,%edi
+  802260:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  802267:	00 00 00 
+  80226a:	ff d0                	call   *%rax
+}
+  80226c:	5d                   	pop    %rbp
+  80226d:	c3                   	ret
+
+000000000080226e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80226e:	55                   	push   %rbp
+  80226f:	48 89 e5             	mov    %rsp,%rbp
+  802272:	41 54                	push   %r12
+  802274:	53                   	push   %rbx
+  802275:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802278:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80227b:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802282:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802284:	be 00 00 00 00       	mov    $0x0,%esi
+  802289:	bf 05 00 00 00       	mov    $0x5,%edi
+  80228e:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  802295:	00 00 00 
+  802298:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	78 3d                	js     8022db <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80229e:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8022a5:	00 00 00 
+  8022a8:	4c 89 e6             	mov    %r12,%rsi
+  8022ab:	48 89 df             	mov    %rbx,%rdi
+  8022ae:	48 b8 31 0e 80 00 00 	movabs $0x800e31,%rax
+  8022b5:	00 00 00 
+  8022b8:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8022ba:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8022c1:	00 
+  8022c2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8022c8:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8022cf:	00 
+  8022d0:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8022d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022db:	5b                   	pop    %rbx
+  8022dc:	41 5c                	pop    %r12
+  8022de:	5d                   	pop    %rbp
+  8022df:	c3                   	ret
+
+00000000008022e0 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8022e0:	55                   	push   %rbp
+  8022e1:	48 89 e5             	mov    %rsp,%rbp
+  8022e4:	41 54                	push   %r12
+  8022e6:	53                   	push   %rbx
+  8022e7:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8022ea:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8022ef:	48 39 c2             	cmp    %rax,%rdx
+  8022f2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8022f6:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8022f9:	48 89 c2             	mov    %rax,%rdx
+  8022fc:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802303:	00 00 00 
+  802306:	48 b8 92 10 80 00 00 	movabs $0x801092,%rax
+  80230d:	00 00 00 
+  802310:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802312:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802319:	00 00 00 
+  80231c:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802321:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802323:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  802327:	be 00 00 00 00       	mov    $0x0,%esi
+  80232c:	bf 04 00 00 00       	mov    $0x4,%edi
+  802331:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  802338:	00 00 00 
+  80233b:	ff d0                	call   *%rax
+  80233d:	48 98                	cltq
+}
+  80233f:	5b                   	pop    %rbx
+  802340:	41 5c                	pop    %r12
+  802342:	5d                   	pop    %rbp
+  802343:	c3                   	ret
+
+0000000000802344 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802344:	55                   	push   %rbp
+  802345:	48 89 e5             	mov    %rsp,%rbp
+  802348:	41 54                	push   %r12
+  80234a:	53                   	push   %rbx
+  80234b:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80234e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802355:	00 00 00 
+  802358:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80235b:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  80235d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802362:	48 39 ca             	cmp    %rcx,%rdx
+  802365:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  802369:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  80236d:	be 00 00 00 00       	mov    $0x0,%esi
+  802372:	bf 03 00 00 00       	mov    $0x3,%edi
+  802377:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  80237e:	00 00 00 
+  802381:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802383:	85 c0                	test   %eax,%eax
+  802385:	78 27                	js     8023ae <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802387:	48 63 d8             	movslq %eax,%rbx
+  80238a:	48 89 da             	mov    %rbx,%rdx
+  80238d:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802394:	00 00 00 
+  802397:	4c 89 e7             	mov    %r12,%rdi
+  80239a:	48 b8 92 10 80 00 00 	movabs $0x801092,%rax
+  8023a1:	00 00 00 
+  8023a4:	ff d0                	call   *%rax
+    return bytes_read;
+  8023a6:	48 89 d8             	mov    %rbx,%rax
+}
+  8023a9:	5b                   	pop    %rbx
+  8023aa:	41 5c                	pop    %r12
+  8023ac:	5d                   	pop    %rbp
+  8023ad:	c3                   	ret
+        return bytes_read;
+  8023ae:	48 98                	cltq
+  8023b0:	eb f7                	jmp    8023a9 <devfile_read+0x65>
+
+00000000008023b2 <open>:
+open(const char *path, int mode) {
+  8023b2:	55                   	push   %rbp
+  8023b3:	48 89 e5             	mov    %rsp,%rbp
+  8023b6:	41 55                	push   %r13
+  8023b8:	41 54                	push   %r12
+  8023ba:	53                   	push   %rbx
+  8023bb:	48 83 ec 18          	sub    $0x18,%rsp
+  8023bf:	49 89 fc             	mov    %rdi,%r12
+  8023c2:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8023c5:	48 b8 f3 0d 80 00 00 	movabs $0x800df3,%rax
+  8023cc:	00 00 00 
+  8023cf:	ff d0                	call   *%rax
+  8023d1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8023d7:	0f 87 8a 00 00 00    	ja     802467 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8023dd:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8023e1:	48 b8 b1 1a 80 00 00 	movabs $0x801ab1,%rax
+  8023e8:	00 00 00 
+  8023eb:	ff d0                	call   *%rax
+  8023ed:	89 c3                	mov    %eax,%ebx
+  8023ef:	85 c0                	test   %eax,%eax
+  8023f1:	78 50                	js     802443 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8023f3:	4c 89 e6             	mov    %r12,%rsi
+  8023f6:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8023fd:	00 00 00 
+  802400:	48 89 df             	mov    %rbx,%rdi
+  802403:	48 b8 31 0e 80 00 00 	movabs $0x800e31,%rax
+  80240a:	00 00 00 
+  80240d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80240f:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802416:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80241a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80241f:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  802426:	00 00 00 
+  802429:	ff d0                	call   *%rax
+  80242b:	89 c3                	mov    %eax,%ebx
+  80242d:	85 c0                	test   %eax,%eax
+  80242f:	78 1f                	js     802450 <open+0x9e>
+    return fd2num(fd);
+  802431:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802435:	48 b8 83 1a 80 00 00 	movabs $0x801a83,%rax
+  80243c:	00 00 00 
+  80243f:	ff d0                	call   *%rax
+  802441:	89 c3                	mov    %eax,%ebx
+}
+  802443:	89 d8                	mov    %ebx,%eax
+  802445:	48 83 c4 18          	add    $0x18,%rsp
+  802449:	5b                   	pop    %rbx
+  80244a:	41 5c                	pop    %r12
+  80244c:	41 5d                	pop    %r13
+  80244e:	5d                   	pop    %rbp
+  80244f:	c3                   	ret
+        fd_close(fd, 0);
+  802450:	be 00 00 00 00       	mov    $0x0,%esi
+  802455:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802459:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  802460:	00 00 00 
+  802463:	ff d0                	call   *%rax
+        return res;
+  802465:	eb dc                	jmp    802443 <open+0x91>
+        return -E_BAD_PATH;
+  802467:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80246c:	eb d5                	jmp    802443 <open+0x91>
+
+000000000080246e <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80246e:	55                   	push   %rbp
+  80246f:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802472:	be 00 00 00 00       	mov    $0x0,%esi
+  802477:	bf 08 00 00 00       	mov    $0x8,%edi
+  80247c:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  802483:	00 00 00 
+  802486:	ff d0                	call   *%rax
+}
+  802488:	5d                   	pop    %rbp
+  802489:	c3                   	ret
+
+000000000080248a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80248a:	55                   	push   %rbp
+  80248b:	48 89 e5             	mov    %rsp,%rbp
+  80248e:	41 54                	push   %r12
+  802490:	53                   	push   %rbx
+  802491:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802494:	48 b8 95 1a 80 00 00 	movabs $0x801a95,%rax
+  80249b:	00 00 00 
+  80249e:	ff d0                	call   *%rax
+  8024a0:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8024a3:	48 be 60 37 80 00 00 	movabs $0x803760,%rsi
+  8024aa:	00 00 00 
+  8024ad:	48 89 df             	mov    %rbx,%rdi
+  8024b0:	48 b8 31 0e 80 00 00 	movabs $0x800e31,%rax
+  8024b7:	00 00 00 
+  8024ba:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8024bc:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8024c1:	41 2b 04 24          	sub    (%r12),%eax
+  8024c5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8024cb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8024d2:	00 00 00 
+    stat->st_dev = &devpipe;
+  8024d5:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8024dc:	00 00 00 
+  8024df:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8024e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024eb:	5b                   	pop    %rbx
+  8024ec:	41 5c                	pop    %r12
+  8024ee:	5d                   	pop    %rbp
+  8024ef:	c3                   	ret
+
+00000000008024f0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8024f0:	55                   	push   %rbp
+  8024f1:	48 89 e5             	mov    %rsp,%rbp
+  8024f4:	41 54                	push   %r12
+  8024f6:	53                   	push   %rbx
+  8024f7:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8024fa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024ff:	48 89 fe             	mov    %rdi,%rsi
+  802502:	bf 00 00 00 00       	mov    $0x0,%edi
+  802507:	49 bc ad 14 80 00 00 	movabs $0x8014ad,%r12
+  80250e:	00 00 00 
+  802511:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802514:	48 89 df             	mov    %rbx,%rdi
+  802517:	48 b8 95 1a 80 00 00 	movabs $0x801a95,%rax
+  80251e:	00 00 00 
+  802521:	ff d0                	call   *%rax
+  802523:	48 89 c6             	mov    %rax,%rsi
+  802526:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80252b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802530:	41 ff d4             	call   *%r12
+}
+  802533:	5b                   	pop    %rbx
+  802534:	41 5c                	pop    %r12
+  802536:	5d                   	pop    %rbp
+  802537:	c3                   	ret
+
+0000000000802538 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802538:	55                   	push   %rbp
+  802539:	48 89 e5             	mov    %rsp,%rbp
+  80253c:	41 57                	push   %r15
+  80253e:	41 56                	push   %r14
+  802540:	41 55                	push   %r13
+  802542:	41 54                	push   %r12
+  802544:	53                   	push   %rbx
+  802545:	48 83 ec 18          	sub    $0x18,%rsp
+  802549:	49 89 fc             	mov    %rdi,%r12
+  80254c:	49 89 f5             	mov    %rsi,%r13
+  80254f:	49 89 d7             	mov    %rdx,%r15
+  802552:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802556:	48 b8 95 1a 80 00 00 	movabs $0x801a95,%rax
+  80255d:	00 00 00 
+  802560:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802562:	4d 85 ff             	test   %r15,%r15
+  802565:	0f 84 af 00 00 00    	je     80261a <devpipe_write+0xe2>
+  80256b:	48 89 c3             	mov    %rax,%rbx
+  80256e:	4c 89 f8             	mov    %r15,%rax
+  802571:	4d 89 ef             	mov    %r13,%r15
+  802574:	4c 01 e8             	add    %r13,%rax
+  802577:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80257b:	49 bd b5 13 80 00 00 	movabs $0x8013b5,%r13
+  802582:	00 00 00 
+            sys_yield();
+  802585:	49 be 52 13 80 00 00 	movabs $0x801352,%r14
+  80258c:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80258f:	8b 73 04             	mov    0x4(%rbx),%esi
+  802592:	48 63 ce             	movslq %esi,%rcx
+  802595:	48 63 03             	movslq (%rbx),%rax
+  802598:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80259e:	48 39 c1             	cmp    %rax,%rcx
+  8025a1:	72 2e                	jb     8025d1 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025a3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025a8:	48 89 da             	mov    %rbx,%rdx
+  8025ab:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025b0:	4c 89 e7             	mov    %r12,%rdi
+  8025b3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025b6:	85 c0                	test   %eax,%eax
+  8025b8:	74 66                	je     802620 <devpipe_write+0xe8>
+            sys_yield();
+  8025ba:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025bd:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025c0:	48 63 ce             	movslq %esi,%rcx
+  8025c3:	48 63 03             	movslq (%rbx),%rax
+  8025c6:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025cc:	48 39 c1             	cmp    %rax,%rcx
+  8025cf:	73 d2                	jae    8025a3 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025d1:	41 0f b6 3f          	movzbl (%r15),%edi
+  8025d5:	48 89 ca             	mov    %rcx,%rdx
+  8025d8:	48 c1 ea 03          	shr    $0x3,%rdx
+  8025dc:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8025e3:	08 10 20 
+  8025e6:	48 f7 e2             	mul    %rdx
+  8025e9:	48 c1 ea 06          	shr    $0x6,%rdx
+  8025ed:	48 89 d0             	mov    %rdx,%rax
+  8025f0:	48 c1 e0 09          	shl    $0x9,%rax
+  8025f4:	48 29 d0             	sub    %rdx,%rax
+  8025f7:	48 c1 e0 03          	shl    $0x3,%rax
+  8025fb:	48 29 c1             	sub    %rax,%rcx
+  8025fe:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802603:	83 c6 01             	add    $0x1,%esi
+  802606:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802609:	49 83 c7 01          	add    $0x1,%r15
+  80260d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802611:	49 39 c7             	cmp    %rax,%r15
+  802614:	0f 85 75 ff ff ff    	jne    80258f <devpipe_write+0x57>
+    return n;
+  80261a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80261e:	eb 05                	jmp    802625 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802620:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802625:	48 83 c4 18          	add    $0x18,%rsp
+  802629:	5b                   	pop    %rbx
+  80262a:	41 5c                	pop    %r12
+  80262c:	41 5d                	pop    %r13
+  80262e:	41 5e                	pop    %r14
+  802630:	41 5f                	pop    %r15
+  802632:	5d                   	pop    %rbp
+  802633:	c3                   	ret
+
+0000000000802634 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802634:	55                   	push   %rbp
+  802635:	48 89 e5             	mov    %rsp,%rbp
+  802638:	41 57                	push   %r15
+  80263a:	41 56                	push   %r14
+  80263c:	41 55                	push   %r13
+  80263e:	41 54                	push   %r12
+  802640:	53                   	push   %rbx
+  802641:	48 83 ec 18          	sub    $0x18,%rsp
+  802645:	49 89 fc             	mov    %rdi,%r12
+  802648:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80264c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802650:	48 b8 95 1a 80 00 00 	movabs $0x801a95,%rax
+  802657:	00 00 00 
+  80265a:	ff d0                	call   *%rax
+  80265c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80265f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802665:	49 bd b5 13 80 00 00 	movabs $0x8013b5,%r13
+  80266c:	00 00 00 
+            sys_yield();
+  80266f:	49 be 52 13 80 00 00 	movabs $0x801352,%r14
+  802676:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802679:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80267e:	74 7d                	je     8026fd <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802680:	8b 03                	mov    (%rbx),%eax
+  802682:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802685:	75 26                	jne    8026ad <devpipe_read+0x79>
+            if (i > 0) return i;
+  802687:	4d 85 ff             	test   %r15,%r15
+  80268a:	75 77                	jne    802703 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80268c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802691:	48 89 da             	mov    %rbx,%rdx
+  802694:	be 00 10 00 00       	mov    $0x1000,%esi
+  802699:	4c 89 e7             	mov    %r12,%rdi
+  80269c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80269f:	85 c0                	test   %eax,%eax
+  8026a1:	74 72                	je     802715 <devpipe_read+0xe1>
+            sys_yield();
+  8026a3:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026a6:	8b 03                	mov    (%rbx),%eax
+  8026a8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026ab:	74 df                	je     80268c <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026ad:	48 63 c8             	movslq %eax,%rcx
+  8026b0:	48 89 ca             	mov    %rcx,%rdx
+  8026b3:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026b7:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8026be:	08 10 20 
+  8026c1:	48 89 d0             	mov    %rdx,%rax
+  8026c4:	48 f7 e6             	mul    %rsi
+  8026c7:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026cb:	48 89 d0             	mov    %rdx,%rax
+  8026ce:	48 c1 e0 09          	shl    $0x9,%rax
+  8026d2:	48 29 d0             	sub    %rdx,%rax
+  8026d5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8026dc:	00 
+  8026dd:	48 89 c8             	mov    %rcx,%rax
+  8026e0:	48 29 d0             	sub    %rdx,%rax
+  8026e3:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8026e8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8026ec:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8026f0:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8026f3:	49 83 c7 01          	add    $0x1,%r15
+  8026f7:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8026fb:	75 83                	jne    802680 <devpipe_read+0x4c>
+    return n;
+  8026fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802701:	eb 03                	jmp    802706 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802703:	4c 89 f8             	mov    %r15,%rax
+}
+  802706:	48 83 c4 18          	add    $0x18,%rsp
+  80270a:	5b                   	pop    %rbx
+  80270b:	41 5c                	pop    %r12
+  80270d:	41 5d                	pop    %r13
+  80270f:	41 5e                	pop    %r14
+  802711:	41 5f                	pop    %r15
+  802713:	5d                   	pop    %rbp
+  802714:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802715:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271a:	eb ea                	jmp    802706 <devpipe_read+0xd2>
+
+000000000080271c <pipe>:
+pipe(int pfd[2]) {
+  80271c:	55                   	push   %rbp
+  80271d:	48 89 e5             	mov    %rsp,%rbp
+  802720:	41 55                	push   %r13
+  802722:	41 54                	push   %r12
+  802724:	53                   	push   %rbx
+  802725:	48 83 ec 18          	sub    $0x18,%rsp
+  802729:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80272c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802730:	48 b8 b1 1a 80 00 00 	movabs $0x801ab1,%rax
+  802737:	00 00 00 
+  80273a:	ff d0                	call   *%rax
+  80273c:	89 c3                	mov    %eax,%ebx
+  80273e:	85 c0                	test   %eax,%eax
+  802740:	0f 88 a0 01 00 00    	js     8028e6 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802746:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80274b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802750:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802754:	bf 00 00 00 00       	mov    $0x0,%edi
+  802759:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  802760:	00 00 00 
+  802763:	ff d0                	call   *%rax
+  802765:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802767:	85 c0                	test   %eax,%eax
+  802769:	0f 88 77 01 00 00    	js     8028e6 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80276f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802773:	48 b8 b1 1a 80 00 00 	movabs $0x801ab1,%rax
+  80277a:	00 00 00 
+  80277d:	ff d0                	call   *%rax
+  80277f:	89 c3                	mov    %eax,%ebx
+  802781:	85 c0                	test   %eax,%eax
+  802783:	0f 88 43 01 00 00    	js     8028cc <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802789:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80278e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802793:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802797:	bf 00 00 00 00       	mov    $0x0,%edi
+  80279c:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  8027a3:	00 00 00 
+  8027a6:	ff d0                	call   *%rax
+  8027a8:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027aa:	85 c0                	test   %eax,%eax
+  8027ac:	0f 88 1a 01 00 00    	js     8028cc <pipe+0x1b0>
+    va = fd2data(fd0);
+  8027b2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027b6:	48 b8 95 1a 80 00 00 	movabs $0x801a95,%rax
+  8027bd:	00 00 00 
+  8027c0:	ff d0                	call   *%rax
+  8027c2:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8027c5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027cf:	48 89 c6             	mov    %rax,%rsi
+  8027d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027d7:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  8027de:	00 00 00 
+  8027e1:	ff d0                	call   *%rax
+  8027e3:	89 c3                	mov    %eax,%ebx
+  8027e5:	85 c0                	test   %eax,%eax
+  8027e7:	0f 88 c5 00 00 00    	js     8028b2 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8027ed:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8027f1:	48 b8 95 1a 80 00 00 	movabs $0x801a95,%rax
+  8027f8:	00 00 00 
+  8027fb:	ff d0                	call   *%rax
+  8027fd:	48 89 c1             	mov    %rax,%rcx
+  802800:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802806:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80280c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802811:	4c 89 ee             	mov    %r13,%rsi
+  802814:	bf 00 00 00 00       	mov    $0x0,%edi
+  802819:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  802820:	00 00 00 
+  802823:	ff d0                	call   *%rax
+  802825:	89 c3                	mov    %eax,%ebx
+  802827:	85 c0                	test   %eax,%eax
+  802829:	78 6e                	js     802899 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80282b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802830:	4c 89 ef             	mov    %r13,%rdi
+  802833:	48 b8 83 13 80 00 00 	movabs $0x801383,%rax
+  80283a:	00 00 00 
+  80283d:	ff d0                	call   *%rax
+  80283f:	83 f8 02             	cmp    $0x2,%eax
+  802842:	0f 85 ab 00 00 00    	jne    8028f3 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802848:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80284f:	00 00 
+  802851:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802855:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802857:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80285b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802862:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802866:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802868:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80286c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802873:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802877:	48 bb 83 1a 80 00 00 	movabs $0x801a83,%rbx
+  80287e:	00 00 00 
+  802881:	ff d3                	call   *%rbx
+  802883:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802887:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80288b:	ff d3                	call   *%rbx
+  80288d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802892:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802897:	eb 4d                	jmp    8028e6 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802899:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80289e:	4c 89 ee             	mov    %r13,%rsi
+  8028a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028a6:	48 b8 ad 14 80 00 00 	movabs $0x8014ad,%rax
+  8028ad:	00 00 00 
+  8028b0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8028b2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028b7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8028bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028c0:	48 b8 ad 14 80 00 00 	movabs $0x8014ad,%rax
+  8028c7:	00 00 00 
+  8028ca:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8028cc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028d1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8028d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028da:	48 b8 ad 14 80 00 00 	movabs $0x8014ad,%rax
+  8028e1:	00 00 00 
+  8028e4:	ff d0                	call   *%rax
+}
+  8028e6:	89 d8                	mov    %ebx,%eax
+  8028e8:	48 83 c4 18          	add    $0x18,%rsp
+  8028ec:	5b                   	pop    %rbx
+  8028ed:	41 5c                	pop    %r12
+  8028ef:	41 5d                	pop    %r13
+  8028f1:	5d                   	pop    %rbp
+  8028f2:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028f3:	48 b9 90 37 80 00 00 	movabs $0x803790,%rcx
+  8028fa:	00 00 00 
+  8028fd:	48 ba 67 37 80 00 00 	movabs $0x803767,%rdx
+  802904:	00 00 00 
+  802907:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80290c:	48 bf 7c 37 80 00 00 	movabs $0x80377c,%rdi
+  802913:	00 00 00 
+  802916:	b8 00 00 00 00       	mov    $0x0,%eax
+  80291b:	49 b8 bc 03 80 00 00 	movabs $0x8003bc,%r8
+  802922:	00 00 00 
+  802925:	41 ff d0             	call   *%r8
+
+0000000000802928 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802928:	55                   	push   %rbp
+  802929:	48 89 e5             	mov    %rsp,%rbp
+  80292c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802930:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802934:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  80293b:	00 00 00 
+  80293e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802940:	85 c0                	test   %eax,%eax
+  802942:	78 35                	js     802979 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802944:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802948:	48 b8 95 1a 80 00 00 	movabs $0x801a95,%rax
+  80294f:	00 00 00 
+  802952:	ff d0                	call   *%rax
+  802954:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802957:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80295c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802961:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802965:	48 b8 b5 13 80 00 00 	movabs $0x8013b5,%rax
+  80296c:	00 00 00 
+  80296f:	ff d0                	call   *%rax
+  802971:	85 c0                	test   %eax,%eax
+  802973:	0f 94 c0             	sete   %al
+  802976:	0f b6 c0             	movzbl %al,%eax
+}
+  802979:	c9                   	leave
+  80297a:	c3                   	ret
+
+000000000080297b <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  80297b:	55                   	push   %rbp
+  80297c:	48 89 e5             	mov    %rsp,%rbp
+  80297f:	41 55                	push   %r13
+  802981:	41 54                	push   %r12
+  802983:	53                   	push   %rbx
+  802984:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  802988:	85 ff                	test   %edi,%edi
+  80298a:	74 6c                	je     8029f8 <wait+0x7d>
+  80298c:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  80298f:	40 0f b6 c7          	movzbl %dil,%eax
+
+    while (env->env_id == envid &&
+  802993:	40 0f b6 cf          	movzbl %dil,%ecx
+  802997:	48 69 c9 b0 06 00 00 	imul   $0x6b0,%rcx,%rcx
+  80299e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8029a5:	00 00 00 
+  8029a8:	48 01 ca             	add    %rcx,%rdx
+  8029ab:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8029b1:	39 d7                	cmp    %edx,%edi
+  8029b3:	75 38                	jne    8029ed <wait+0x72>
+           env->env_status != ENV_FREE) {
+  8029b5:	48 98                	cltq
+  8029b7:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8029be:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8029c5:	00 00 00 
+  8029c8:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  8029cb:	49 bd 52 13 80 00 00 	movabs $0x801352,%r13
+  8029d2:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8029d5:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8029db:	85 c0                	test   %eax,%eax
+  8029dd:	74 0e                	je     8029ed <wait+0x72>
+        sys_yield();
+  8029df:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8029e2:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8029e8:	44 39 e0             	cmp    %r12d,%eax
+  8029eb:	74 e8                	je     8029d5 <wait+0x5a>
+    }
+}
+  8029ed:	48 83 c4 08          	add    $0x8,%rsp
+  8029f1:	5b                   	pop    %rbx
+  8029f2:	41 5c                	pop    %r12
+  8029f4:	41 5d                	pop    %r13
+  8029f6:	5d                   	pop    %rbp
+  8029f7:	c3                   	ret
+    assert(envid != 0);
+  8029f8:	48 b9 b4 37 80 00 00 	movabs $0x8037b4,%rcx
+  8029ff:	00 00 00 
+  802a02:	48 ba 67 37 80 00 00 	movabs $0x803767,%rdx
+  802a09:	00 00 00 
+  802a0c:	be 06 00 00 00       	mov    $0x6,%esi
+  802a11:	48 bf bf 37 80 00 00 	movabs $0x8037bf,%rdi
+  802a18:	00 00 00 
+  802a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a20:	49 b8 bc 03 80 00 00 	movabs $0x8003bc,%r8
+  802a27:	00 00 00 
+  802a2a:	41 ff d0             	call   *%r8
+
+0000000000802a2d <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a2d:	48 89 f8             	mov    %rdi,%rax
+  802a30:	48 c1 e8 27          	shr    $0x27,%rax
+  802a34:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a3b:	01 00 00 
+  802a3e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a42:	f6 c2 01             	test   $0x1,%dl
+  802a45:	74 6d                	je     802ab4 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a47:	48 89 f8             	mov    %rdi,%rax
+  802a4a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a4e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a55:	01 00 00 
+  802a58:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a5c:	f6 c2 01             	test   $0x1,%dl
+  802a5f:	74 62                	je     802ac3 <get_uvpt_entry+0x96>
+  802a61:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a68:	01 00 00 
+  802a6b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a6f:	f6 c2 80             	test   $0x80,%dl
+  802a72:	75 4f                	jne    802ac3 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a74:	48 89 f8             	mov    %rdi,%rax
+  802a77:	48 c1 e8 15          	shr    $0x15,%rax
+  802a7b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a82:	01 00 00 
+  802a85:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a89:	f6 c2 01             	test   $0x1,%dl
+  802a8c:	74 44                	je     802ad2 <get_uvpt_entry+0xa5>
+  802a8e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a95:	01 00 00 
+  802a98:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a9c:	f6 c2 80             	test   $0x80,%dl
+  802a9f:	75 31                	jne    802ad2 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802aa1:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802aa5:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802aac:	01 00 00 
+  802aaf:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802ab3:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802ab4:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802abb:	01 00 00 
+  802abe:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ac2:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802ac3:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802aca:	01 00 00 
+  802acd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ad1:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802ad2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802ad9:	01 00 00 
+  802adc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ae0:	c3                   	ret
+
+0000000000802ae1 <get_prot>:
+
+int
+get_prot(void *va) {
+  802ae1:	55                   	push   %rbp
+  802ae2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802ae5:	48 b8 2d 2a 80 00 00 	movabs $0x802a2d,%rax
+  802aec:	00 00 00 
+  802aef:	ff d0                	call   *%rax
+  802af1:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802af4:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802af9:	89 c1                	mov    %eax,%ecx
+  802afb:	83 c9 04             	or     $0x4,%ecx
+  802afe:	f6 c2 01             	test   $0x1,%dl
+  802b01:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802b04:	89 c1                	mov    %eax,%ecx
+  802b06:	83 c9 02             	or     $0x2,%ecx
+  802b09:	f6 c2 02             	test   $0x2,%dl
+  802b0c:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802b0f:	89 c1                	mov    %eax,%ecx
+  802b11:	83 c9 01             	or     $0x1,%ecx
+  802b14:	48 85 d2             	test   %rdx,%rdx
+  802b17:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802b1a:	89 c1                	mov    %eax,%ecx
+  802b1c:	83 c9 40             	or     $0x40,%ecx
+  802b1f:	f6 c6 04             	test   $0x4,%dh
+  802b22:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802b25:	5d                   	pop    %rbp
+  802b26:	c3                   	ret
+
+0000000000802b27 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802b27:	55                   	push   %rbp
+  802b28:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b2b:	48 b8 2d 2a 80 00 00 	movabs $0x802a2d,%rax
+  802b32:	00 00 00 
+  802b35:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802b37:	48 c1 e8 06          	shr    $0x6,%rax
+  802b3b:	83 e0 01             	and    $0x1,%eax
+}
+  802b3e:	5d                   	pop    %rbp
+  802b3f:	c3                   	ret
+
+0000000000802b40 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802b40:	55                   	push   %rbp
+  802b41:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802b44:	48 b8 2d 2a 80 00 00 	movabs $0x802a2d,%rax
+  802b4b:	00 00 00 
+  802b4e:	ff d0                	call   *%rax
+  802b50:	83 e0 01             	and    $0x1,%eax
+}
+  802b53:	5d                   	pop    %rbp
+  802b54:	c3                   	ret
+
+0000000000802b55 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802b55:	55                   	push   %rbp
+  802b56:	48 89 e5             	mov    %rsp,%rbp
+  802b59:	41 57                	push   %r15
+  802b5b:	41 56                	push   %r14
+  802b5d:	41 55                	push   %r13
+  802b5f:	41 54                	push   %r12
+  802b61:	53                   	push   %rbx
+  802b62:	48 83 ec 18          	sub    $0x18,%rsp
+  802b66:	49 89 ff             	mov    %rdi,%r15
+  802b69:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802b6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802b72:	49 bc 40 2b 80 00 00 	movabs $0x802b40,%r12
+  802b79:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802b7c:	49 be e1 2a 80 00 00 	movabs $0x802ae1,%r14
+  802b83:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802b86:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802b8d:	00 00 00 
+  802b90:	eb 0c                	jmp    802b9e <foreach_shared_region+0x49>
+  802b92:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b99:	4c 39 eb             	cmp    %r13,%rbx
+  802b9c:	74 38                	je     802bd6 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802b9e:	48 89 df             	mov    %rbx,%rdi
+  802ba1:	41 ff d4             	call   *%r12
+  802ba4:	84 c0                	test   %al,%al
+  802ba6:	74 ea                	je     802b92 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802ba8:	48 89 df             	mov    %rbx,%rdi
+  802bab:	41 ff d6             	call   *%r14
+  802bae:	a8 40                	test   $0x40,%al
+  802bb0:	74 e0                	je     802b92 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802bb2:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802bb9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802bbd:	48 89 df             	mov    %rbx,%rdi
+  802bc0:	41 ff d7             	call   *%r15
+        if (err)
+  802bc3:	85 c0                	test   %eax,%eax
+  802bc5:	74 cb                	je     802b92 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802bc7:	48 83 c4 18          	add    $0x18,%rsp
+  802bcb:	5b                   	pop    %rbx
+  802bcc:	41 5c                	pop    %r12
+  802bce:	41 5d                	pop    %r13
+  802bd0:	41 5e                	pop    %r14
+  802bd2:	41 5f                	pop    %r15
+  802bd4:	5d                   	pop    %rbp
+  802bd5:	c3                   	ret
+    return 0;
+  802bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bdb:	eb ea                	jmp    802bc7 <foreach_shared_region+0x72>
+
+0000000000802bdd <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be2:	c3                   	ret
+
+0000000000802be3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802be3:	55                   	push   %rbp
+  802be4:	48 89 e5             	mov    %rsp,%rbp
+  802be7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802bea:	48 be ca 37 80 00 00 	movabs $0x8037ca,%rsi
+  802bf1:	00 00 00 
+  802bf4:	48 b8 31 0e 80 00 00 	movabs $0x800e31,%rax
+  802bfb:	00 00 00 
+  802bfe:	ff d0                	call   *%rax
+    return 0;
+}
+  802c00:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c05:	5d                   	pop    %rbp
+  802c06:	c3                   	ret
+
+0000000000802c07 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c07:	55                   	push   %rbp
+  802c08:	48 89 e5             	mov    %rsp,%rbp
+  802c0b:	41 57                	push   %r15
+  802c0d:	41 56                	push   %r14
+  802c0f:	41 55                	push   %r13
+  802c11:	41 54                	push   %r12
+  802c13:	53                   	push   %rbx
+  802c14:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802c1b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802c22:	48 85 d2             	test   %rdx,%rdx
+  802c25:	74 7a                	je     802ca1 <devcons_write+0x9a>
+  802c27:	49 89 d6             	mov    %rdx,%r14
+  802c2a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802c30:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802c35:	49 bf 2b 10 80 00 00 	movabs $0x80102b,%r15
+  802c3c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802c3f:	4c 89 f3             	mov    %r14,%rbx
+  802c42:	48 29 f3             	sub    %rsi,%rbx
+  802c45:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802c4a:	48 39 c3             	cmp    %rax,%rbx
+  802c4d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802c51:	4c 63 eb             	movslq %ebx,%r13
+  802c54:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802c5b:	48 01 c6             	add    %rax,%rsi
+  802c5e:	4c 89 ea             	mov    %r13,%rdx
+  802c61:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802c68:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802c6b:	4c 89 ee             	mov    %r13,%rsi
+  802c6e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802c75:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  802c7c:	00 00 00 
+  802c7f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802c81:	41 01 dc             	add    %ebx,%r12d
+  802c84:	49 63 f4             	movslq %r12d,%rsi
+  802c87:	4c 39 f6             	cmp    %r14,%rsi
+  802c8a:	72 b3                	jb     802c3f <devcons_write+0x38>
+    return res;
+  802c8c:	49 63 c4             	movslq %r12d,%rax
+}
+  802c8f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802c96:	5b                   	pop    %rbx
+  802c97:	41 5c                	pop    %r12
+  802c99:	41 5d                	pop    %r13
+  802c9b:	41 5e                	pop    %r14
+  802c9d:	41 5f                	pop    %r15
+  802c9f:	5d                   	pop    %rbp
+  802ca0:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802ca1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802ca7:	eb e3                	jmp    802c8c <devcons_write+0x85>
+
+0000000000802ca9 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ca9:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802cac:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cb1:	48 85 c0             	test   %rax,%rax
+  802cb4:	74 55                	je     802d0b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802cb6:	55                   	push   %rbp
+  802cb7:	48 89 e5             	mov    %rsp,%rbp
+  802cba:	41 55                	push   %r13
+  802cbc:	41 54                	push   %r12
+  802cbe:	53                   	push   %rbx
+  802cbf:	48 83 ec 08          	sub    $0x8,%rsp
+  802cc3:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802cc6:	48 bb 85 12 80 00 00 	movabs $0x801285,%rbx
+  802ccd:	00 00 00 
+  802cd0:	49 bc 52 13 80 00 00 	movabs $0x801352,%r12
+  802cd7:	00 00 00 
+  802cda:	eb 03                	jmp    802cdf <devcons_read+0x36>
+  802cdc:	41 ff d4             	call   *%r12
+  802cdf:	ff d3                	call   *%rbx
+  802ce1:	85 c0                	test   %eax,%eax
+  802ce3:	74 f7                	je     802cdc <devcons_read+0x33>
+    if (c < 0) return c;
+  802ce5:	48 63 d0             	movslq %eax,%rdx
+  802ce8:	78 13                	js     802cfd <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802cea:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cef:	83 f8 04             	cmp    $0x4,%eax
+  802cf2:	74 09                	je     802cfd <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802cf4:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802cf8:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802cfd:	48 89 d0             	mov    %rdx,%rax
+  802d00:	48 83 c4 08          	add    $0x8,%rsp
+  802d04:	5b                   	pop    %rbx
+  802d05:	41 5c                	pop    %r12
+  802d07:	41 5d                	pop    %r13
+  802d09:	5d                   	pop    %rbp
+  802d0a:	c3                   	ret
+  802d0b:	48 89 d0             	mov    %rdx,%rax
+  802d0e:	c3                   	ret
+
+0000000000802d0f <cputchar>:
+cputchar(int ch) {
+  802d0f:	55                   	push   %rbp
+  802d10:	48 89 e5             	mov    %rsp,%rbp
+  802d13:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802d17:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802d1b:	be 01 00 00 00       	mov    $0x1,%esi
+  802d20:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802d24:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  802d2b:	00 00 00 
+  802d2e:	ff d0                	call   *%rax
+}
+  802d30:	c9                   	leave
+  802d31:	c3                   	ret
+
+0000000000802d32 <getchar>:
+getchar(void) {
+  802d32:	55                   	push   %rbp
+  802d33:	48 89 e5             	mov    %rsp,%rbp
+  802d36:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802d3a:	ba 01 00 00 00       	mov    $0x1,%edx
+  802d3f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802d43:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d48:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  802d4f:	00 00 00 
+  802d52:	ff d0                	call   *%rax
+  802d54:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802d56:	85 c0                	test   %eax,%eax
+  802d58:	78 06                	js     802d60 <getchar+0x2e>
+  802d5a:	74 08                	je     802d64 <getchar+0x32>
+  802d5c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802d60:	89 d0                	mov    %edx,%eax
+  802d62:	c9                   	leave
+  802d63:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802d64:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802d69:	eb f5                	jmp    802d60 <getchar+0x2e>
+
+0000000000802d6b <iscons>:
+iscons(int fdnum) {
+  802d6b:	55                   	push   %rbp
+  802d6c:	48 89 e5             	mov    %rsp,%rbp
+  802d6f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802d73:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d77:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  802d7e:	00 00 00 
+  802d81:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d83:	85 c0                	test   %eax,%eax
+  802d85:	78 18                	js     802d9f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802d87:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d8b:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802d92:	00 00 00 
+  802d95:	8b 00                	mov    (%rax),%eax
+  802d97:	39 02                	cmp    %eax,(%rdx)
+  802d99:	0f 94 c0             	sete   %al
+  802d9c:	0f b6 c0             	movzbl %al,%eax
+}
+  802d9f:	c9                   	leave
+  802da0:	c3                   	ret
+
+0000000000802da1 <opencons>:
+opencons(void) {
+  802da1:	55                   	push   %rbp
+  802da2:	48 89 e5             	mov    %rsp,%rbp
+  802da5:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802da9:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802dad:	48 b8 b1 1a 80 00 00 	movabs $0x801ab1,%rax
+  802db4:	00 00 00 
+  802db7:	ff d0                	call   *%rax
+  802db9:	85 c0                	test   %eax,%eax
+  802dbb:	78 49                	js     802e06 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802dbd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802dc2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802dc7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802dcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dd0:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  802dd7:	00 00 00 
+  802dda:	ff d0                	call   *%rax
+  802ddc:	85 c0                	test   %eax,%eax
+  802dde:	78 26                	js     802e06 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802de0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802de4:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802deb:	00 00 
+  802ded:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802def:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802df3:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802dfa:	48 b8 83 1a 80 00 00 	movabs $0x801a83,%rax
+  802e01:	00 00 00 
+  802e04:	ff d0                	call   *%rax
+}
+  802e06:	c9                   	leave
+  802e07:	c3                   	ret
+
+0000000000802e08 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802e08:	55                   	push   %rbp
+  802e09:	48 89 e5             	mov    %rsp,%rbp
+  802e0c:	41 54                	push   %r12
+  802e0e:	53                   	push   %rbx
+  802e0f:	48 89 fb             	mov    %rdi,%rbx
+  802e12:	48 89 f7             	mov    %rsi,%rdi
+  802e15:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802e18:	48 85 f6             	test   %rsi,%rsi
+  802e1b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802e22:	00 00 00 
+  802e25:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802e29:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e2e:	48 b8 4b 17 80 00 00 	movabs $0x80174b,%rax
+  802e35:	00 00 00 
+  802e38:	ff d0                	call   *%rax
+    if (res < 0) {
+  802e3a:	85 c0                	test   %eax,%eax
+  802e3c:	78 45                	js     802e83 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802e3e:	48 85 db             	test   %rbx,%rbx
+  802e41:	74 12                	je     802e55 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802e43:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  802e4a:	00 00 00 
+  802e4d:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802e53:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802e55:	4d 85 e4             	test   %r12,%r12
+  802e58:	74 14                	je     802e6e <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802e5a:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  802e61:	00 00 00 
+  802e64:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802e6a:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802e6e:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  802e75:	00 00 00 
+  802e78:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802e7e:	5b                   	pop    %rbx
+  802e7f:	41 5c                	pop    %r12
+  802e81:	5d                   	pop    %rbp
+  802e82:	c3                   	ret
+        if (from_env_store)
+  802e83:	48 85 db             	test   %rbx,%rbx
+  802e86:	74 06                	je     802e8e <ipc_recv+0x86>
+            *from_env_store = 0;
+  802e88:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802e8e:	4d 85 e4             	test   %r12,%r12
+  802e91:	74 eb                	je     802e7e <ipc_recv+0x76>
+            *perm_store = 0;
+  802e93:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802e9a:	00 
+  802e9b:	eb e1                	jmp    802e7e <ipc_recv+0x76>
+
+0000000000802e9d <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802e9d:	55                   	push   %rbp
+  802e9e:	48 89 e5             	mov    %rsp,%rbp
+  802ea1:	41 57                	push   %r15
+  802ea3:	41 56                	push   %r14
+  802ea5:	41 55                	push   %r13
+  802ea7:	41 54                	push   %r12
+  802ea9:	53                   	push   %rbx
+  802eaa:	48 83 ec 18          	sub    $0x18,%rsp
+  802eae:	41 89 fd             	mov    %edi,%r13d
+  802eb1:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802eb4:	48 89 d3             	mov    %rdx,%rbx
+  802eb7:	49 89 cc             	mov    %rcx,%r12
+  802eba:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802ebe:	48 85 d2             	test   %rdx,%rdx
+  802ec1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ec8:	00 00 00 
+  802ecb:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802ecf:	49 be 1f 17 80 00 00 	movabs $0x80171f,%r14
+  802ed6:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802ed9:	49 bf 52 13 80 00 00 	movabs $0x801352,%r15
+  802ee0:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802ee3:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802ee6:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802eea:	4c 89 e1             	mov    %r12,%rcx
+  802eed:	48 89 da             	mov    %rbx,%rdx
+  802ef0:	44 89 ef             	mov    %r13d,%edi
+  802ef3:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802ef6:	85 c0                	test   %eax,%eax
+  802ef8:	74 34                	je     802f2e <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802efa:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802efd:	75 05                	jne    802f04 <ipc_send+0x67>
+        sys_yield();
+  802eff:	41 ff d7             	call   *%r15
+    while (true) {
+  802f02:	eb df                	jmp    802ee3 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802f04:	48 ba d6 37 80 00 00 	movabs $0x8037d6,%rdx
+  802f0b:	00 00 00 
+  802f0e:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802f13:	48 bf ef 37 80 00 00 	movabs $0x8037ef,%rdi
+  802f1a:	00 00 00 
+  802f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f22:	48 b9 bc 03 80 00 00 	movabs $0x8003bc,%rcx
+  802f29:	00 00 00 
+  802f2c:	ff d1                	call   *%rcx
+    }
+}
+  802f2e:	48 83 c4 18          	add    $0x18,%rsp
+  802f32:	5b                   	pop    %rbx
+  802f33:	41 5c                	pop    %r12
+  802f35:	41 5d                	pop    %r13
+  802f37:	41 5e                	pop    %r14
+  802f39:	41 5f                	pop    %r15
+  802f3b:	5d                   	pop    %rbp
+  802f3c:	c3                   	ret
+
+0000000000802f3d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802f42:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802f49:	00 00 00 
+  802f4c:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802f53:	48 01 ca             	add    %rcx,%rdx
+  802f56:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802f5c:	39 fa                	cmp    %edi,%edx
+  802f5e:	74 12                	je     802f72 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802f60:	48 83 c0 01          	add    $0x1,%rax
+  802f64:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802f6a:	75 e0                	jne    802f4c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f71:	c3                   	ret
+            return envs[i].env_id;
+  802f72:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802f79:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802f80:	00 00 00 
+  802f83:	48 01 d0             	add    %rdx,%rax
+  802f86:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802f8c:	c3                   	ret
+  802f8d:	0f 1f 00             	nopl   (%rax)
+
+0000000000802f90 <__rodata_start>:
+  802f90:	6d                   	insl   (%dx),%es:(%rdi)
+  802f91:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f92:	74 64                	je     802ff8 <__rodata_start+0x68>
+  802f94:	00 6f 70             	add    %ch,0x70(%rdi)
+  802f97:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f99:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802f9c:	74 64                	je     803002 <__rodata_start+0x72>
+  802f9e:	3a 20                	cmp    (%rax),%ah
+  802fa0:	25 69 00 75 73       	and    $0x73750069,%eax
+  802fa5:	65 72 2f             	gs jb  802fd7 <__rodata_start+0x47>
+  802fa8:	74 65                	je     80300f <__rodata_start+0x7f>
+  802faa:	73 74                	jae    803020 <__rodata_start+0x90>
+  802fac:	66 64 73 68          	data16 fs jae 803018 <__rodata_start+0x88>
+  802fb0:	61                   	(bad)
+  802fb1:	72 69                	jb     80301c <__rodata_start+0x8c>
+  802fb3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fb4:	67 2e 63 00          	cs movsxd (%eax),%eax
+  802fb8:	72 65                	jb     80301f <__rodata_start+0x8f>
+  802fba:	61                   	(bad)
+  802fbb:	64 6e                	outsb  %fs:(%rsi),(%dx)
+  802fbd:	3a 20                	cmp    (%rax),%ah
+  802fbf:	25 69 00 66 6f       	and    $0x6f660069,%eax
+  802fc4:	72 6b                	jb     803031 <__rodata_start+0xa1>
+  802fc6:	3a 20                	cmp    (%rax),%ah
+  802fc8:	25 69 00 72 65       	and    $0x65720069,%eax
+  802fcd:	61                   	(bad)
+  802fce:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  802fd2:	20 63 68             	and    %ah,0x68(%rbx)
+  802fd5:	69 6c 64 20 73 75 63 	imul   $0x63637573,0x20(%rsp,%riz,2),%ebp
+  802fdc:	63 
+  802fdd:	65 65 64 65 64 0a 00 	gs gs fs gs or %fs:(%rax),%al
+  802fe4:	72 65                	jb     80304b <__rodata_start+0xbb>
+  802fe6:	61                   	(bad)
+  802fe7:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  802feb:	20 70 61             	and    %dh,0x61(%rax)
+  802fee:	72 65                	jb     803055 <__rodata_start+0xc5>
+  802ff0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ff1:	74 20                	je     803013 <__rodata_start+0x83>
+  802ff3:	73 75                	jae    80306a <__rodata_start+0xda>
+  802ff5:	63 63 65             	movsxd 0x65(%rbx),%esp
+  802ff8:	65 64 65 64 0a 00    	gs fs gs or %fs:(%rax),%al
+  802ffe:	66 90                	xchg   %ax,%ax
+  803000:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803002:	69 6e 67 20 74 6f 20 	imul   $0x206f7420,0x67(%rsi),%ebp
+  803009:	72 65                	jb     803070 <__rodata_start+0xe0>
+  80300b:	61                   	(bad)
+  80300c:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803010:	20 63 68             	and    %ah,0x68(%rbx)
+  803013:	69 6c 64 20 28 6d 69 	imul   $0x67696d28,0x20(%rsp,%riz,2),%ebp
+  80301a:	67 
+  80301b:	68 74 20 70 61       	push   $0x61702074
+  803020:	67 65 20 66 61       	and    %ah,%gs:0x61(%esi)
+  803025:	75 6c                	jne    803093 <__rodata_start+0x103>
+  803027:	74 20                	je     803049 <__rodata_start+0xb9>
+  803029:	69 66 20 79 6f 75 72 	imul   $0x72756f79,0x20(%rsi),%esp
+  803030:	20 73 68             	and    %dh,0x68(%rbx)
+  803033:	61                   	(bad)
+  803034:	72 69                	jb     80309f <__rodata_start+0x10f>
+  803036:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803037:	67 20 69 73          	and    %ch,0x73(%ecx)
+  80303b:	20 62 75             	and    %ah,0x75(%rdx)
+  80303e:	67 67 79 29          	addr32 addr32 jns 80306b <__rodata_start+0xdb>
+  803042:	0a 00                	or     (%rax),%al
+  803044:	00 00                	add    %al,(%rax)
+  803046:	00 00                	add    %al,(%rax)
+  803048:	72 65                	jb     8030af <__rodata_start+0x11f>
+  80304a:	61                   	(bad)
+  80304b:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  80304f:	20 70 61             	and    %dh,0x61(%rax)
+  803052:	72 65                	jb     8030b9 <__rodata_start+0x129>
+  803054:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803055:	74 20                	je     803077 <__rodata_start+0xe7>
+  803057:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803059:	74 20                	je     80307b <__rodata_start+0xeb>
+  80305b:	25 64 2c 20 72       	and    $0x72202c64,%eax
+  803060:	65 61                	gs (bad)
+  803062:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803066:	20 63 68             	and    %ah,0x68(%rbx)
+  803069:	69 6c 64 20 67 6f 74 	imul   $0x20746f67,0x20(%rsp,%riz,2),%ebp
+  803070:	20 
+  803071:	25 64 00 00 00       	and    $0x64,%eax
+  803076:	00 00                	add    %al,(%rax)
+  803078:	72 65                	jb     8030df <__rodata_start+0x14f>
+  80307a:	61                   	(bad)
+  80307b:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  80307f:	20 70 61             	and    %dh,0x61(%rax)
+  803082:	72 65                	jb     8030e9 <__rodata_start+0x159>
+  803084:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803085:	74 20                	je     8030a7 <__rodata_start+0x117>
+  803087:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803089:	74 20                	je     8030ab <__rodata_start+0x11b>
+  80308b:	64 69 66 66 65 72 65 	imul   $0x6e657265,%fs:0x66(%rsi),%esp
+  803092:	6e 
+  803093:	74 20                	je     8030b5 <__rodata_start+0x125>
+  803095:	62                   	(bad)
+  803096:	79 74                	jns    80310c <__rodata_start+0x17c>
+  803098:	65 73 20             	gs jae 8030bb <__rodata_start+0x12b>
+  80309b:	66 72 6f             	data16 jb 80310d <__rodata_start+0x17d>
+  80309e:	6d                   	insl   (%dx),%es:(%rdi)
+  80309f:	20 72 65             	and    %dh,0x65(%rdx)
+  8030a2:	61                   	(bad)
+  8030a3:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  8030a7:	20 63 68             	and    %ah,0x68(%rbx)
+  8030aa:	69 6c 64 00 00 00 72 	imul   $0x65720000,0x0(%rsp,%riz,2),%ebp
+  8030b1:	65 
+  8030b2:	61                   	(bad)
+  8030b3:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  8030b7:	20 70 61             	and    %dh,0x61(%rax)
+  8030ba:	72 65                	jb     803121 <__rodata_start+0x191>
+  8030bc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030bd:	74 20                	je     8030df <__rodata_start+0x14f>
+  8030bf:	67 6f                	outsl  %ds:(%esi),(%dx)
+  8030c1:	74 20                	je     8030e3 <__rodata_start+0x153>
+  8030c3:	25 64 2c 20 74       	and    $0x74202c64,%eax
+  8030c8:	68 65 6e 20 67       	push   $0x67206e65
+  8030cd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030ce:	74 20                	je     8030f0 <__rodata_start+0x160>
+  8030d0:	25 64 00 3c 75       	and    $0x753c0064,%eax
+  8030d5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030d6:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8030da:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030db:	3e 00 0f             	ds add %cl,(%rdi)
+  8030de:	1f                   	(bad)
+  8030df:	00 5b 25             	add    %bl,0x25(%rbx)
+  8030e2:	30 38                	xor    %bh,(%rax)
+  8030e4:	78 5d                	js     803143 <__rodata_start+0x1b3>
+  8030e6:	20 75 73             	and    %dh,0x73(%rbp)
+  8030e9:	65 72 20             	gs jb  80310c <__rodata_start+0x17c>
+  8030ec:	70 61                	jo     80314f <__rodata_start+0x1bf>
+  8030ee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030ef:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  8030f6:	73 20                	jae    803118 <__rodata_start+0x188>
+  8030f8:	61                   	(bad)
+  8030f9:	74 20                	je     80311b <__rodata_start+0x18b>
+  8030fb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803100:	3a 20                	cmp    (%rax),%ah
+  803102:	00 30                	add    %dh,(%rax)
+  803104:	31 32                	xor    %esi,(%rdx)
+  803106:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80310d:	41                   	rex.B
+  80310e:	42                   	rex.X
+  80310f:	43                   	rex.XB
+  803110:	44                   	rex.R
+  803111:	45                   	rex.RB
+  803112:	46 00 30             	rex.RX add %r14b,(%rax)
+  803115:	31 32                	xor    %esi,(%rdx)
+  803117:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80311e:	61                   	(bad)
+  80311f:	62 63 64 65 66       	(bad)
+  803124:	00 28                	add    %ch,(%rax)
+  803126:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803127:	75 6c                	jne    803195 <__rodata_start+0x205>
+  803129:	6c                   	insb   (%dx),%es:(%rdi)
+  80312a:	29 00                	sub    %eax,(%rax)
+  80312c:	65 72 72             	gs jb  8031a1 <__rodata_start+0x211>
+  80312f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803130:	72 20                	jb     803152 <__rodata_start+0x1c2>
+  803132:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803137:	73 70                	jae    8031a9 <__rodata_start+0x219>
+  803139:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80313d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803144:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803145:	72 00                	jb     803147 <__rodata_start+0x1b7>
+  803147:	62 61 64 20 65       	(bad)
+  80314c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80314d:	76 69                	jbe    8031b8 <__rodata_start+0x228>
+  80314f:	72 6f                	jb     8031c0 <__rodata_start+0x230>
+  803151:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803152:	6d                   	insl   (%dx),%es:(%rdi)
+  803153:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803155:	74 00                	je     803157 <__rodata_start+0x1c7>
+  803157:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80315e:	20 70 61             	and    %dh,0x61(%rax)
+  803161:	72 61                	jb     8031c4 <__rodata_start+0x234>
+  803163:	6d                   	insl   (%dx),%es:(%rdi)
+  803164:	65 74 65             	gs je  8031cc <__rodata_start+0x23c>
+  803167:	72 00                	jb     803169 <__rodata_start+0x1d9>
+  803169:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80316a:	75 74                	jne    8031e0 <__rodata_start+0x250>
+  80316c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80316f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803172:	6d                   	insl   (%dx),%es:(%rdi)
+  803173:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803174:	72 79                	jb     8031ef <__rodata_start+0x25f>
+  803176:	00 6f 75             	add    %ch,0x75(%rdi)
+  803179:	74 20                	je     80319b <__rodata_start+0x20b>
+  80317b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80317c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803180:	76 69                	jbe    8031eb <__rodata_start+0x25b>
+  803182:	72 6f                	jb     8031f3 <__rodata_start+0x263>
+  803184:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803185:	6d                   	insl   (%dx),%es:(%rdi)
+  803186:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803188:	74 73                	je     8031fd <__rodata_start+0x26d>
+  80318a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80318d:	72 72                	jb     803201 <__rodata_start+0x271>
+  80318f:	75 70                	jne    803201 <__rodata_start+0x271>
+  803191:	74 65                	je     8031f8 <__rodata_start+0x268>
+  803193:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803198:	75 67                	jne    803201 <__rodata_start+0x271>
+  80319a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80319d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80319f:	00 73 65             	add    %dh,0x65(%rbx)
+  8031a2:	67 6d                	insl   (%dx),%es:(%edi)
+  8031a4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8031a6:	74 61                	je     803209 <__rodata_start+0x279>
+  8031a8:	74 69                	je     803213 <__rodata_start+0x283>
+  8031aa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031ab:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031ac:	20 66 61             	and    %ah,0x61(%rsi)
+  8031af:	75 6c                	jne    80321d <__rodata_start+0x28d>
+  8031b1:	74 00                	je     8031b3 <__rodata_start+0x223>
+  8031b3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8031ba:	20 45 4c             	and    %al,0x4c(%rbp)
+  8031bd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8031c1:	61                   	(bad)
+  8031c2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8031c7:	20 73 75             	and    %dh,0x75(%rbx)
+  8031ca:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8031cd:	73 79                	jae    803248 <__rodata_start+0x2b8>
+  8031cf:	73 74                	jae    803245 <__rodata_start+0x2b5>
+  8031d1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8031d3:	20 63 61             	and    %ah,0x61(%rbx)
+  8031d6:	6c                   	insb   (%dx),%es:(%rdi)
+  8031d7:	6c                   	insb   (%dx),%es:(%rdi)
+  8031d8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8031db:	74 72                	je     80324f <__rodata_start+0x2bf>
+  8031dd:	79 20                	jns    8031ff <__rodata_start+0x26f>
+  8031df:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031e0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031e1:	74 20                	je     803203 <__rodata_start+0x273>
+  8031e3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8031e5:	75 6e                	jne    803255 <__rodata_start+0x2c5>
+  8031e7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8031eb:	76 20                	jbe    80320d <__rodata_start+0x27d>
+  8031ed:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8031f4:	72 65                	jb     80325b <__rodata_start+0x2cb>
+  8031f6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8031f9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031fa:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8031fe:	65 78 70             	gs js  803271 <__rodata_start+0x2e1>
+  803201:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803206:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803209:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80320d:	20 66 69             	and    %ah,0x69(%rsi)
+  803210:	6c                   	insb   (%dx),%es:(%rdi)
+  803211:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803215:	20 66 72             	and    %ah,0x72(%rsi)
+  803218:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80321d:	61                   	(bad)
+  80321e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803221:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803222:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803223:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803227:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80322a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80322b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80322c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80322f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803230:	79 20                	jns    803252 <__rodata_start+0x2c2>
+  803232:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803239:	72 65                	jb     8032a0 <__rodata_start+0x310>
+  80323b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80323e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803240:	00 66 69             	add    %ah,0x69(%rsi)
+  803243:	6c                   	insb   (%dx),%es:(%rdi)
+  803244:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803248:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80324b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80324c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80324f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803250:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803251:	74 20                	je     803273 <__rodata_start+0x2e3>
+  803253:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803255:	75 6e                	jne    8032c5 <__rodata_start+0x335>
+  803257:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80325b:	76 61                	jbe    8032be <__rodata_start+0x32e>
+  80325d:	6c                   	insb   (%dx),%es:(%rdi)
+  80325e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803265:	00 
+  803266:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80326d:	72 65                	jb     8032d4 <__rodata_start+0x344>
+  80326f:	61                   	(bad)
+  803270:	64 79 20             	fs jns 803293 <__rodata_start+0x303>
+  803273:	65 78 69             	gs js  8032df <__rodata_start+0x34f>
+  803276:	73 74                	jae    8032ec <__rodata_start+0x35c>
+  803278:	73 00                	jae    80327a <__rodata_start+0x2ea>
+  80327a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80327b:	70 65                	jo     8032e2 <__rodata_start+0x352>
+  80327d:	72 61                	jb     8032e0 <__rodata_start+0x350>
+  80327f:	74 69                	je     8032ea <__rodata_start+0x35a>
+  803281:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803282:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803283:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803286:	74 20                	je     8032a8 <__rodata_start+0x318>
+  803288:	73 75                	jae    8032ff <__rodata_start+0x36f>
+  80328a:	70 70                	jo     8032fc <__rodata_start+0x36c>
+  80328c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80328d:	72 74                	jb     803303 <__rodata_start+0x373>
+  80328f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803294:	65 72 61             	gs jb  8032f8 <__rodata_start+0x368>
+  803297:	74 69                	je     803302 <__rodata_start+0x372>
+  803299:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80329a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80329b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80329e:	74 20                	je     8032c0 <__rodata_start+0x330>
+  8032a0:	70 65                	jo     803307 <__rodata_start+0x377>
+  8032a2:	72 6d                	jb     803311 <__rodata_start+0x381>
+  8032a4:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  8032ab:	2e 
+  8032ac:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8032b3:	00 
+  8032b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8032bb:	00 00 00 
+  8032be:	66 90                	xchg   %ax,%ax
+  8032c0:	f9                   	stc
+  8032c1:	06                   	(bad)
+  8032c2:	80 00 00             	addb   $0x0,(%rax)
+  8032c5:	00 00                	add    %al,(%rax)
+  8032c7:	00 3a                	add    %bh,(%rdx)
+  8032c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8032ce:	00 00                	add    %al,(%rax)
+  8032d0:	2a 0d 80 00 00 00    	sub    0x80(%rip),%cl        # 803356 <__rodata_start+0x3c6>
+  8032d6:	00 00                	add    %al,(%rax)
+  8032d8:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80335e <__rodata_start+0x3ce>
+  8032de:	00 00                	add    %al,(%rax)
+  8032e0:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803366 <__rodata_start+0x3d6>
+  8032e6:	00 00                	add    %al,(%rax)
+  8032e8:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80336e <__rodata_start+0x3de>
+  8032ee:	00 00                	add    %al,(%rax)
+  8032f0:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803376 <__rodata_start+0x3e6>
+  8032f6:	00 00                	add    %al,(%rax)
+  8032f8:	18 07                	sbb    %al,(%rdi)
+  8032fa:	80 00 00             	addb   $0x0,(%rax)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 3a                	add    %bh,(%rdx)
+  803301:	0d 80 00 00 00       	or     $0x80,%eax
+  803306:	00 00                	add    %al,(%rax)
+  803308:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80338e <__rodata_start+0x3fe>
+  80330e:	00 00                	add    %al,(%rax)
+  803310:	0c 07                	or     $0x7,%al
+  803312:	80 00 00             	addb   $0x0,(%rax)
+  803315:	00 00                	add    %al,(%rax)
+  803317:	00 86 07 80 00 00    	add    %al,0x8007(%rsi)
+  80331d:	00 00                	add    %al,(%rax)
+  80331f:	00 3a                	add    %bh,(%rdx)
+  803321:	0d 80 00 00 00       	or     $0x80,%eax
+  803326:	00 00                	add    %al,(%rax)
+  803328:	0c 07                	or     $0x7,%al
+  80332a:	80 00 00             	addb   $0x0,(%rax)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 52 07             	add    %dl,0x7(%rdx)
+  803332:	80 00 00             	addb   $0x0,(%rax)
+  803335:	00 00                	add    %al,(%rax)
+  803337:	00 52 07             	add    %dl,0x7(%rdx)
+  80333a:	80 00 00             	addb   $0x0,(%rax)
+  80333d:	00 00                	add    %al,(%rax)
+  80333f:	00 52 07             	add    %dl,0x7(%rdx)
+  803342:	80 00 00             	addb   $0x0,(%rax)
+  803345:	00 00                	add    %al,(%rax)
+  803347:	00 52 07             	add    %dl,0x7(%rdx)
+  80334a:	80 00 00             	addb   $0x0,(%rax)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 52 07             	add    %dl,0x7(%rdx)
+  803352:	80 00 00             	addb   $0x0,(%rax)
+  803355:	00 00                	add    %al,(%rax)
+  803357:	00 52 07             	add    %dl,0x7(%rdx)
+  80335a:	80 00 00             	addb   $0x0,(%rax)
+  80335d:	00 00                	add    %al,(%rax)
+  80335f:	00 52 07             	add    %dl,0x7(%rdx)
+  803362:	80 00 00             	addb   $0x0,(%rax)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 52 07             	add    %dl,0x7(%rdx)
+  80336a:	80 00 00             	addb   $0x0,(%rax)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 52 07             	add    %dl,0x7(%rdx)
+  803372:	80 00 00             	addb   $0x0,(%rax)
+  803375:	00 00                	add    %al,(%rax)
+  803377:	00 3a                	add    %bh,(%rdx)
+  803379:	0d 80 00 00 00       	or     $0x80,%eax
+  80337e:	00 00                	add    %al,(%rax)
+  803380:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803406 <__rodata_start+0x476>
+  803386:	00 00                	add    %al,(%rax)
+  803388:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80340e <__rodata_start+0x47e>
+  80338e:	00 00                	add    %al,(%rax)
+  803390:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803416 <__rodata_start+0x486>
+  803396:	00 00                	add    %al,(%rax)
+  803398:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80341e <__rodata_start+0x48e>
+  80339e:	00 00                	add    %al,(%rax)
+  8033a0:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803426 <__rodata_start+0x496>
+  8033a6:	00 00                	add    %al,(%rax)
+  8033a8:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80342e <__rodata_start+0x49e>
+  8033ae:	00 00                	add    %al,(%rax)
+  8033b0:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803436 <__rodata_start+0x4a6>
+  8033b6:	00 00                	add    %al,(%rax)
+  8033b8:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80343e <__rodata_start+0x4ae>
+  8033be:	00 00                	add    %al,(%rax)
+  8033c0:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803446 <__rodata_start+0x4b6>
+  8033c6:	00 00                	add    %al,(%rax)
+  8033c8:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80344e <__rodata_start+0x4be>
+  8033ce:	00 00                	add    %al,(%rax)
+  8033d0:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803456 <__rodata_start+0x4c6>
+  8033d6:	00 00                	add    %al,(%rax)
+  8033d8:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80345e <__rodata_start+0x4ce>
+  8033de:	00 00                	add    %al,(%rax)
+  8033e0:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803466 <__rodata_start+0x4d6>
+  8033e6:	00 00                	add    %al,(%rax)
+  8033e8:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80346e <__rodata_start+0x4de>
+  8033ee:	00 00                	add    %al,(%rax)
+  8033f0:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803476 <__rodata_start+0x4e6>
+  8033f6:	00 00                	add    %al,(%rax)
+  8033f8:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80347e <__rodata_start+0x4ee>
+  8033fe:	00 00                	add    %al,(%rax)
+  803400:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803486 <__rodata_start+0x4f6>
+  803406:	00 00                	add    %al,(%rax)
+  803408:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80348e <__rodata_start+0x4fe>
+  80340e:	00 00                	add    %al,(%rax)
+  803410:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803496 <__rodata_start+0x506>
+  803416:	00 00                	add    %al,(%rax)
+  803418:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80349e <__rodata_start+0x50e>
+  80341e:	00 00                	add    %al,(%rax)
+  803420:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 8034a6 <__rodata_start+0x516>
+  803426:	00 00                	add    %al,(%rax)
+  803428:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 8034ae <__rodata_start+0x51e>
+  80342e:	00 00                	add    %al,(%rax)
+  803430:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 8034b6 <__rodata_start+0x526>
+  803436:	00 00                	add    %al,(%rax)
+  803438:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 8034be <__rodata_start+0x52e>
+  80343e:	00 00                	add    %al,(%rax)
+  803440:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 8034c6 <__rodata_start+0x536>
+  803446:	00 00                	add    %al,(%rax)
+  803448:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 8034ce <__rodata_start+0x53e>
+  80344e:	00 00                	add    %al,(%rax)
+  803450:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 8034d6 <__rodata_start+0x546>
+  803456:	00 00                	add    %al,(%rax)
+  803458:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 8034de <__rodata_start+0x54e>
+  80345e:	00 00                	add    %al,(%rax)
+  803460:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 8034e6 <__rodata_start+0x556>
+  803466:	00 00                	add    %al,(%rax)
+  803468:	5d                   	pop    %rbp
+  803469:	0c 80                	or     $0x80,%al
+  80346b:	00 00                	add    %al,(%rax)
+  80346d:	00 00                	add    %al,(%rax)
+  80346f:	00 3a                	add    %bh,(%rdx)
+  803471:	0d 80 00 00 00       	or     $0x80,%eax
+  803476:	00 00                	add    %al,(%rax)
+  803478:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 8034fe <__rodata_start+0x56e>
+  80347e:	00 00                	add    %al,(%rax)
+  803480:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803506 <__rodata_start+0x576>
+  803486:	00 00                	add    %al,(%rax)
+  803488:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80350e <__rodata_start+0x57e>
+  80348e:	00 00                	add    %al,(%rax)
+  803490:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803516 <__rodata_start+0x586>
+  803496:	00 00                	add    %al,(%rax)
+  803498:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80351e <__rodata_start+0x58e>
+  80349e:	00 00                	add    %al,(%rax)
+  8034a0:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803526 <__rodata_start+0x596>
+  8034a6:	00 00                	add    %al,(%rax)
+  8034a8:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80352e <__rodata_start+0x59e>
+  8034ae:	00 00                	add    %al,(%rax)
+  8034b0:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803536 <__rodata_start+0x5a6>
+  8034b6:	00 00                	add    %al,(%rax)
+  8034b8:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80353e <__rodata_start+0x5ae>
+  8034be:	00 00                	add    %al,(%rax)
+  8034c0:	a9 07 80 00 00       	test   $0x8007,%eax
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 78 09             	add    %bh,0x9(%rax)
+  8034ca:	80 00 00             	addb   $0x0,(%rax)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 3a                	add    %bh,(%rdx)
+  8034d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8034d6:	00 00                	add    %al,(%rax)
+  8034d8:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80355e <__rodata_start+0x5ce>
+  8034de:	00 00                	add    %al,(%rax)
+  8034e0:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803566 <__rodata_start+0x5d6>
+  8034e6:	00 00                	add    %al,(%rax)
+  8034e8:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80356e <__rodata_start+0x5de>
+  8034ee:	00 00                	add    %al,(%rax)
+  8034f0:	d8 07                	fadds  (%rdi)
+  8034f2:	80 00 00             	addb   $0x0,(%rax)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 3a                	add    %bh,(%rdx)
+  8034f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8034fe:	00 00                	add    %al,(%rax)
+  803500:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 803586 <error_string+0x6>
+  803506:	00 00                	add    %al,(%rax)
+  803508:	9e                   	sahf
+  803509:	07                   	(bad)
+  80350a:	80 00 00             	addb   $0x0,(%rax)
+  80350d:	00 00                	add    %al,(%rax)
+  80350f:	00 3a                	add    %bh,(%rdx)
+  803511:	0d 80 00 00 00       	or     $0x80,%eax
+  803516:	00 00                	add    %al,(%rax)
+  803518:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 80359e <error_string+0x1e>
+  80351e:	00 00                	add    %al,(%rax)
+  803520:	20 0b                	and    %cl,(%rbx)
+  803522:	80 00 00             	addb   $0x0,(%rax)
+  803525:	00 00                	add    %al,(%rax)
+  803527:	00 ea                	add    %ch,%dl
+  803529:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80352f:	00 3a                	add    %bh,(%rdx)
+  803531:	0d 80 00 00 00       	or     $0x80,%eax
+  803536:	00 00                	add    %al,(%rax)
+  803538:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 8035be <error_string+0x3e>
+  80353e:	00 00                	add    %al,(%rax)
+  803540:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803541:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803547:	00 3a                	add    %bh,(%rdx)
+  803549:	0d 80 00 00 00       	or     $0x80,%eax
+  80354e:	00 00                	add    %al,(%rax)
+  803550:	4c 0a 80 00 00 00 00 	rex.WR or 0x0(%rax),%r8b
+  803557:	00 3a                	add    %bh,(%rdx)
+  803559:	0d 80 00 00 00       	or     $0x80,%eax
+  80355e:	00 00                	add    %al,(%rax)
+  803560:	3a 0d 80 00 00 00    	cmp    0x80(%rip),%cl        # 8035e6 <error_string+0x66>
+  803566:	00 00                	add    %al,(%rax)
+  803568:	5d                   	pop    %rbp
+  803569:	0c 80                	or     $0x80,%al
+  80356b:	00 00                	add    %al,(%rax)
+  80356d:	00 00                	add    %al,(%rax)
+  80356f:	00 3a                	add    %bh,(%rdx)
+  803571:	0d 80 00 00 00       	or     $0x80,%eax
+  803576:	00 00                	add    %al,(%rax)
+  803578:	02 07                	add    (%rdi),%al
+  80357a:	80 00 00             	addb   $0x0,(%rax)
+  80357d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803580 <error_string>:
+	...
+  803588:	35 31 80 00 00 00 00 00 47 31 80 00 00 00 00 00     51......G1......
+  803598:	57 31 80 00 00 00 00 00 69 31 80 00 00 00 00 00     W1......i1......
+  8035a8:	77 31 80 00 00 00 00 00 8b 31 80 00 00 00 00 00     w1.......1......
+  8035b8:	a0 31 80 00 00 00 00 00 b3 31 80 00 00 00 00 00     .1.......1......
+  8035c8:	c5 31 80 00 00 00 00 00 d9 31 80 00 00 00 00 00     .1.......1......
+  8035d8:	e9 31 80 00 00 00 00 00 fc 31 80 00 00 00 00 00     .1.......1......
+  8035e8:	13 32 80 00 00 00 00 00 29 32 80 00 00 00 00 00     .2......)2......
+  8035f8:	41 32 80 00 00 00 00 00 59 32 80 00 00 00 00 00     A2......Y2......
+  803608:	66 32 80 00 00 00 00 00 30 36 80 00 00 00 00 00     f2......06......
+  803618:	7a 32 80 00 00 00 00 00 00 00 00 00 00 00 00 00     z2..............
+  803628:	92 32 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .2......file is 
+  803638:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803648:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803658:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803668:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803678:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  803688:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  803698:	6c 69 62 2f 66 6f 72 6b 2e 63 00 0f 1f 44 00 00     lib/fork.c...D..
+  8036a8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8036b8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8036c8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8036d8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8036e8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8036f8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803708:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803718:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803728:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803738:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000803740 <devtab>:
+  803740:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803750:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803760:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803770:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803780:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803790:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8037a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8037b0:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  8037c0:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  8037d0:	00 63 6f 6e 73 00 69 70 63 5f 73 65 6e 64 3a 20     .cons.ipc_send: 
+  8037e0:	66 61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00 6c     failed to send.l
+  8037f0:	69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00     ib/ipc.c.f......
+  803800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
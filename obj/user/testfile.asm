@@ -0,0 +1,6907 @@
+
+obj/user/testfile:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 8b 0a 00 00       	call   800aae <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <xopen>:
+const char *msg = "This is the NEW message of the day!\n\n";
+
+#define FVA ((struct Fd *)0xA000000)
+
+static int
+xopen(const char *path, int mode) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 54                	push   %r12
+  80002b:	53                   	push   %rbx
+  80002c:	48 83 ec 10          	sub    $0x10,%rsp
+  800030:	41 89 f4             	mov    %esi,%r12d
+    extern union Fsipc fsipcbuf;
+    envid_t fsenv;
+
+    strcpy(fsipcbuf.open.req_path, path);
+  800033:	48 89 fe             	mov    %rdi,%rsi
+  800036:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  80003d:	00 00 00 
+  800040:	48 89 df             	mov    %rbx,%rdi
+  800043:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  80004a:	00 00 00 
+  80004d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80004f:	44 89 a3 00 04 00 00 	mov    %r12d,0x400(%rbx)
+
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  800056:	bf 03 00 00 00       	mov    $0x3,%edi
+  80005b:	48 b8 74 22 80 00 00 	movabs $0x802274,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+  800067:	89 c7                	mov    %eax,%edi
+    size_t sz = PAGE_SIZE;
+  800069:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800070:	00 
+    ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, sz, PROT_RW);
+  800071:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800077:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80007c:	48 89 da             	mov    %rbx,%rdx
+  80007f:	be 01 00 00 00       	mov    $0x1,%esi
+  800084:	48 b8 d4 21 80 00 00 	movabs $0x8021d4,%rax
+  80008b:	00 00 00 
+  80008e:	ff d0                	call   *%rax
+    return ipc_recv(NULL, FVA, &sz, NULL);
+  800090:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800095:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800099:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  80009e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000a3:	48 b8 3f 21 80 00 00 	movabs $0x80213f,%rax
+  8000aa:	00 00 00 
+  8000ad:	ff d0                	call   *%rax
+}
+  8000af:	48 83 c4 10          	add    $0x10,%rsp
+  8000b3:	5b                   	pop    %rbx
+  8000b4:	41 5c                	pop    %r12
+  8000b6:	5d                   	pop    %rbp
+  8000b7:	c3                   	ret
+
+00000000008000b8 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000b8:	55                   	push   %rbp
+  8000b9:	48 89 e5             	mov    %rsp,%rbp
+  8000bc:	41 55                	push   %r13
+  8000be:	41 54                	push   %r12
+  8000c0:	53                   	push   %rbx
+  8000c1:	48 81 ec a8 02 00 00 	sub    $0x2a8,%rsp
+    struct Fd fdcopy;
+    struct Stat st;
+    char buf[512];
+
+    /* We open files manually first, to avoid the FD layer */
+    if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  8000c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8000cd:	48 bf 98 35 80 00 00 	movabs $0x803598,%rdi
+  8000d4:	00 00 00 
+  8000d7:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000de:	00 00 00 
+  8000e1:	ff d0                	call   *%rax
+  8000e3:	48 63 c8             	movslq %eax,%rcx
+  8000e6:	48 85 c9             	test   %rcx,%rcx
+  8000e9:	0f 89 70 05 00 00    	jns    80065f <umain+0x5a7>
+  8000ef:	48 83 f9 f1          	cmp    $0xfffffffffffffff1,%rcx
+  8000f3:	0f 85 3b 05 00 00    	jne    800634 <umain+0x57c>
+        panic("serve_open /not-found: %ld", (long)r);
+    else if (r >= 0)
+        panic("serve_open /not-found succeeded!");
+
+    if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  8000f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8000fe:	48 bf ce 35 80 00 00 	movabs $0x8035ce,%rdi
+  800105:	00 00 00 
+  800108:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80010f:	00 00 00 
+  800112:	ff d0                	call   *%rax
+  800114:	48 63 c8             	movslq %eax,%rcx
+  800117:	48 85 c9             	test   %rcx,%rcx
+  80011a:	0f 88 69 05 00 00    	js     800689 <umain+0x5d1>
+        panic("serve_open /newmotd: %ld", (long)r);
+    if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  800120:	83 3c 25 00 00 00 0a 	cmpl   $0x66,0xa000000
+  800127:	66 
+  800128:	0f 85 86 05 00 00    	jne    8006b4 <umain+0x5fc>
+  80012e:	83 3c 25 04 00 00 0a 	cmpl   $0x0,0xa000004
+  800135:	00 
+  800136:	0f 85 78 05 00 00    	jne    8006b4 <umain+0x5fc>
+  80013c:	83 3c 25 08 00 00 0a 	cmpl   $0x0,0xa000008
+  800143:	00 
+  800144:	0f 85 6a 05 00 00    	jne    8006b4 <umain+0x5fc>
+        panic("serve_open did not fill struct Fd correctly\n");
+    cprintf("serve_open is good\n");
+  80014a:	48 bf f0 35 80 00 00 	movabs $0x8035f0,%rdi
+  800151:	00 00 00 
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	48 ba c8 0c 80 00 00 	movabs $0x800cc8,%rdx
+  800160:	00 00 00 
+  800163:	ff d2                	call   *%rdx
+
+    if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  800165:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  80016c:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800171:	48 a1 48 50 80 00 00 	movabs 0x805048,%rax
+  800178:	00 00 00 
+  80017b:	ff d0                	call   *%rax
+  80017d:	48 63 c8             	movslq %eax,%rcx
+  800180:	48 85 c9             	test   %rcx,%rcx
+  800183:	0f 88 55 05 00 00    	js     8006de <umain+0x626>
+        panic("file_stat: %ld", (long)r);
+    if (strlen(msg) != st.st_size)
+  800189:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800190:	00 00 00 
+  800193:	48 8b 38             	mov    (%rax),%rdi
+  800196:	48 b8 af 15 80 00 00 	movabs $0x8015af,%rax
+  80019d:	00 00 00 
+  8001a0:	ff d0                	call   *%rax
+  8001a2:	48 89 c2             	mov    %rax,%rdx
+  8001a5:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8001a9:	48 39 c2             	cmp    %rax,%rdx
+  8001ac:	0f 85 57 05 00 00    	jne    800709 <umain+0x651>
+        panic("file_stat returned size %ld wanted %zd\n", (long)st.st_size, strlen(msg));
+    cprintf("file_stat is good\n");
+  8001b2:	48 bf 13 36 80 00 00 	movabs $0x803613,%rdi
+  8001b9:	00 00 00 
+  8001bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c1:	48 ba c8 0c 80 00 00 	movabs $0x800cc8,%rdx
+  8001c8:	00 00 00 
+  8001cb:	ff d2                	call   *%rdx
+
+    memset(buf, 0, sizeof buf);
+  8001cd:	ba 00 02 00 00       	mov    $0x200,%edx
+  8001d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8001d7:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  8001de:	48 b8 39 17 80 00 00 	movabs $0x801739,%rax
+  8001e5:	00 00 00 
+  8001e8:	ff d0                	call   *%rax
+    if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8001ea:	ba 00 02 00 00       	mov    $0x200,%edx
+  8001ef:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  8001f6:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8001fb:	48 a1 30 50 80 00 00 	movabs 0x805030,%rax
+  800202:	00 00 00 
+  800205:	ff d0                	call   *%rax
+  800207:	48 85 c0             	test   %rax,%rax
+  80020a:	0f 88 44 05 00 00    	js     800754 <umain+0x69c>
+        panic("file_read: %ld", (long)r);
+    if (strcmp(buf, msg) != 0)
+  800210:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800217:	00 00 00 
+  80021a:	48 8b 30             	mov    (%rax),%rsi
+  80021d:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  800224:	48 b8 91 16 80 00 00 	movabs $0x801691,%rax
+  80022b:	00 00 00 
+  80022e:	ff d0                	call   *%rax
+  800230:	85 c0                	test   %eax,%eax
+  800232:	0f 85 4a 05 00 00    	jne    800782 <umain+0x6ca>
+        panic("file_read returned wrong data");
+    cprintf("file_read is good\n");
+  800238:	48 bf 53 36 80 00 00 	movabs $0x803653,%rdi
+  80023f:	00 00 00 
+  800242:	b8 00 00 00 00       	mov    $0x0,%eax
+  800247:	48 ba c8 0c 80 00 00 	movabs $0x800cc8,%rdx
+  80024e:	00 00 00 
+  800251:	ff d2                	call   *%rdx
+
+    if ((r = devfile.dev_close(FVA)) < 0)
+  800253:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800258:	48 a1 40 50 80 00 00 	movabs 0x805040,%rax
+  80025f:	00 00 00 
+  800262:	ff d0                	call   *%rax
+  800264:	48 63 c8             	movslq %eax,%rcx
+  800267:	48 85 c9             	test   %rcx,%rcx
+  80026a:	0f 88 3c 05 00 00    	js     8007ac <umain+0x6f4>
+        panic("file_close: %ld", (long)r);
+    cprintf("file_close is good\n");
+  800270:	48 bf 76 36 80 00 00 	movabs $0x803676,%rdi
+  800277:	00 00 00 
+  80027a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027f:	48 ba c8 0c 80 00 00 	movabs $0x800cc8,%rdx
+  800286:	00 00 00 
+  800289:	ff d2                	call   *%rdx
+
+    /* We're about to unmap the FD, but still need a way to get
+     * the stale filenum to serve_read, so we make a local copy.
+     * The file server won't think it's stale until we unmap the
+     * FD page. */
+    fdcopy = *FVA;
+  80028b:	48 8b 04 25 00 00 00 	mov    0xa000000,%rax
+  800292:	0a 
+  800293:	48 8b 14 25 08 00 00 	mov    0xa000008,%rdx
+  80029a:	0a 
+  80029b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80029f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    sys_unmap_region(0, FVA, PAGE_SIZE);
+  8002a3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8002a8:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  8002ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b2:	48 b8 69 1c 80 00 00 	movabs $0x801c69,%rax
+  8002b9:	00 00 00 
+  8002bc:	ff d0                	call   *%rax
+
+    if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  8002be:	ba 00 02 00 00       	mov    $0x200,%edx
+  8002c3:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  8002ca:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8002ce:	48 a1 30 50 80 00 00 	movabs 0x805030,%rax
+  8002d5:	00 00 00 
+  8002d8:	ff d0                	call   *%rax
+  8002da:	48 83 f8 fd          	cmp    $0xfffffffffffffffd,%rax
+  8002de:	0f 85 f3 04 00 00    	jne    8007d7 <umain+0x71f>
+        panic("serve_read does not handle stale fileids correctly: %ld", (long)r);
+    cprintf("stale fileid is good\n");
+  8002e4:	48 bf 8a 36 80 00 00 	movabs $0x80368a,%rdi
+  8002eb:	00 00 00 
+  8002ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f3:	48 ba c8 0c 80 00 00 	movabs $0x800cc8,%rdx
+  8002fa:	00 00 00 
+  8002fd:	ff d2                	call   *%rdx
+
+    /* Try writing */
+    if ((r = xopen("/new-file", O_RDWR | O_CREAT)) < 0)
+  8002ff:	be 02 01 00 00       	mov    $0x102,%esi
+  800304:	48 bf a0 36 80 00 00 	movabs $0x8036a0,%rdi
+  80030b:	00 00 00 
+  80030e:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800315:	00 00 00 
+  800318:	ff d0                	call   *%rax
+  80031a:	48 63 c8             	movslq %eax,%rcx
+  80031d:	48 85 c9             	test   %rcx,%rcx
+  800320:	0f 88 df 04 00 00    	js     800805 <umain+0x74d>
+        panic("serve_open /new-file: %ld", (long)r);
+
+    if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  800326:	48 b8 38 50 80 00 00 	movabs $0x805038,%rax
+  80032d:	00 00 00 
+  800330:	48 8b 18             	mov    (%rax),%rbx
+  800333:	49 bc 00 50 80 00 00 	movabs $0x805000,%r12
+  80033a:	00 00 00 
+  80033d:	49 8b 3c 24          	mov    (%r12),%rdi
+  800341:	49 bd af 15 80 00 00 	movabs $0x8015af,%r13
+  800348:	00 00 00 
+  80034b:	41 ff d5             	call   *%r13
+  80034e:	48 89 c2             	mov    %rax,%rdx
+  800351:	49 8b 34 24          	mov    (%r12),%rsi
+  800355:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80035a:	ff d3                	call   *%rbx
+  80035c:	48 89 c3             	mov    %rax,%rbx
+  80035f:	49 8b 3c 24          	mov    (%r12),%rdi
+  800363:	41 ff d5             	call   *%r13
+  800366:	48 39 c3             	cmp    %rax,%rbx
+  800369:	0f 85 c1 04 00 00    	jne    800830 <umain+0x778>
+        panic("file_write: %ld", (long)r);
+    cprintf("file_write is good\n");
+  80036f:	48 bf d4 36 80 00 00 	movabs $0x8036d4,%rdi
+  800376:	00 00 00 
+  800379:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037e:	48 ba c8 0c 80 00 00 	movabs $0x800cc8,%rdx
+  800385:	00 00 00 
+  800388:	ff d2                	call   *%rdx
+
+    FVA->fd_offset = 0;
+  80038a:	c7 04 25 04 00 00 0a 	movl   $0x0,0xa000004
+  800391:	00 00 00 00 
+    memset(buf, 0, sizeof buf);
+  800395:	ba 00 02 00 00       	mov    $0x200,%edx
+  80039a:	be 00 00 00 00       	mov    $0x0,%esi
+  80039f:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  8003a6:	48 b8 39 17 80 00 00 	movabs $0x801739,%rax
+  8003ad:	00 00 00 
+  8003b0:	ff d0                	call   *%rax
+    if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8003b2:	ba 00 02 00 00       	mov    $0x200,%edx
+  8003b7:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  8003be:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8003c3:	48 a1 30 50 80 00 00 	movabs 0x805030,%rax
+  8003ca:	00 00 00 
+  8003cd:	ff d0                	call   *%rax
+  8003cf:	48 89 c3             	mov    %rax,%rbx
+  8003d2:	48 85 c0             	test   %rax,%rax
+  8003d5:	0f 88 83 04 00 00    	js     80085e <umain+0x7a6>
+        panic("file_read after file_write: %ld", (long)r);
+    if (r != strlen(msg))
+  8003db:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8003e2:	00 00 00 
+  8003e5:	48 8b 38             	mov    (%rax),%rdi
+  8003e8:	48 b8 af 15 80 00 00 	movabs $0x8015af,%rax
+  8003ef:	00 00 00 
+  8003f2:	ff d0                	call   *%rax
+  8003f4:	48 39 d8             	cmp    %rbx,%rax
+  8003f7:	0f 85 8f 04 00 00    	jne    80088c <umain+0x7d4>
+        panic("file_read after file_write returned wrong length: %ld", (long)r);
+    if (strcmp(buf, msg) != 0)
+  8003fd:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800404:	00 00 00 
+  800407:	48 8b 30             	mov    (%rax),%rsi
+  80040a:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  800411:	48 b8 91 16 80 00 00 	movabs $0x801691,%rax
+  800418:	00 00 00 
+  80041b:	ff d0                	call   *%rax
+  80041d:	85 c0                	test   %eax,%eax
+  80041f:	0f 85 95 04 00 00    	jne    8008ba <umain+0x802>
+        panic("file_read after file_write returned wrong data");
+    cprintf("file_read after file_write is good\n");
+  800425:	48 bf a8 38 80 00 00 	movabs $0x8038a8,%rdi
+  80042c:	00 00 00 
+  80042f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800434:	48 ba c8 0c 80 00 00 	movabs $0x800cc8,%rdx
+  80043b:	00 00 00 
+  80043e:	ff d2                	call   *%rdx
+
+    /* Now we'll try out open */
+    if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  800440:	be 00 00 00 00       	mov    $0x0,%esi
+  800445:	48 bf 98 35 80 00 00 	movabs $0x803598,%rdi
+  80044c:	00 00 00 
+  80044f:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  800456:	00 00 00 
+  800459:	ff d0                	call   *%rax
+  80045b:	48 63 c8             	movslq %eax,%rcx
+  80045e:	48 85 c9             	test   %rcx,%rcx
+  800461:	0f 89 a8 04 00 00    	jns    80090f <umain+0x857>
+  800467:	48 83 f9 f1          	cmp    $0xfffffffffffffff1,%rcx
+  80046b:	0f 85 73 04 00 00    	jne    8008e4 <umain+0x82c>
+        panic("open /not-found: %ld", (long)r);
+    else if (r >= 0)
+        panic("open /not-found succeeded!");
+
+    if ((r = open("/newmotd", O_RDONLY)) < 0)
+  800471:	be 00 00 00 00       	mov    $0x0,%esi
+  800476:	48 bf ce 35 80 00 00 	movabs $0x8035ce,%rdi
+  80047d:	00 00 00 
+  800480:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  800487:	00 00 00 
+  80048a:	ff d0                	call   *%rax
+  80048c:	48 98                	cltq
+  80048e:	48 85 c0             	test   %rax,%rax
+  800491:	0f 88 a2 04 00 00    	js     800939 <umain+0x881>
+        panic("open /newmotd: %ld", (long)r);
+    fd = (struct Fd *)(0xD0000000 + r * PAGE_SIZE);
+  800497:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80049d:	48 c1 e0 0c          	shl    $0xc,%rax
+    if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  8004a1:	83 38 66             	cmpl   $0x66,(%rax)
+  8004a4:	0f 85 bd 04 00 00    	jne    800967 <umain+0x8af>
+  8004aa:	83 78 04 00          	cmpl   $0x0,0x4(%rax)
+  8004ae:	0f 85 b3 04 00 00    	jne    800967 <umain+0x8af>
+  8004b4:	83 78 08 00          	cmpl   $0x0,0x8(%rax)
+  8004b8:	0f 85 a9 04 00 00    	jne    800967 <umain+0x8af>
+        panic("open did not fill struct Fd correctly\n");
+    cprintf("open is good\n");
+  8004be:	48 bf f6 35 80 00 00 	movabs $0x8035f6,%rdi
+  8004c5:	00 00 00 
+  8004c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004cd:	48 ba c8 0c 80 00 00 	movabs $0x800cc8,%rdx
+  8004d4:	00 00 00 
+  8004d7:	ff d2                	call   *%rdx
+
+    /* Try files with indirect blocks */
+    if ((f = open("/big", O_WRONLY | O_CREAT)) < 0)
+  8004d9:	be 01 01 00 00       	mov    $0x101,%esi
+  8004de:	48 bf 03 37 80 00 00 	movabs $0x803703,%rdi
+  8004e5:	00 00 00 
+  8004e8:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  8004ef:	00 00 00 
+  8004f2:	ff d0                	call   *%rax
+  8004f4:	41 89 c4             	mov    %eax,%r12d
+  8004f7:	48 63 c8             	movslq %eax,%rcx
+  8004fa:	48 85 c9             	test   %rcx,%rcx
+  8004fd:	0f 88 8e 04 00 00    	js     800991 <umain+0x8d9>
+        panic("creat /big: %ld", (long)f);
+    memset(buf, 0, sizeof(buf));
+  800503:	ba 00 02 00 00       	mov    $0x200,%edx
+  800508:	be 00 00 00 00       	mov    $0x0,%esi
+  80050d:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  800514:	48 b8 39 17 80 00 00 	movabs $0x801739,%rax
+  80051b:	00 00 00 
+  80051e:	ff d0                	call   *%rax
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  800520:	bb 00 00 00 00       	mov    $0x0,%ebx
+        *(int *)buf = i;
+        if ((r = write(f, buf, sizeof(buf))) < 0)
+  800525:	49 bd 64 27 80 00 00 	movabs $0x802764,%r13
+  80052c:	00 00 00 
+        *(int *)buf = i;
+  80052f:	89 9d 40 fd ff ff    	mov    %ebx,-0x2c0(%rbp)
+        if ((r = write(f, buf, sizeof(buf))) < 0)
+  800535:	ba 00 02 00 00       	mov    $0x200,%edx
+  80053a:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  800541:	44 89 e7             	mov    %r12d,%edi
+  800544:	41 ff d5             	call   *%r13
+  800547:	48 85 c0             	test   %rax,%rax
+  80054a:	0f 88 6c 04 00 00    	js     8009bc <umain+0x904>
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  800550:	48 8d 83 00 02 00 00 	lea    0x200(%rbx),%rax
+  800557:	48 89 c3             	mov    %rax,%rbx
+  80055a:	48 3d 00 e0 01 00    	cmp    $0x1e000,%rax
+  800560:	75 cd                	jne    80052f <umain+0x477>
+            panic("write /big@%ld: %ld", (long)i, (long)r);
+    }
+    close(f);
+  800562:	44 89 e7             	mov    %r12d,%edi
+  800565:	48 b8 b7 24 80 00 00 	movabs $0x8024b7,%rax
+  80056c:	00 00 00 
+  80056f:	ff d0                	call   *%rax
+
+    if ((f = open("/big", O_RDONLY)) < 0)
+  800571:	be 00 00 00 00       	mov    $0x0,%esi
+  800576:	48 bf 03 37 80 00 00 	movabs $0x803703,%rdi
+  80057d:	00 00 00 
+  800580:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  800587:	00 00 00 
+  80058a:	ff d0                	call   *%rax
+  80058c:	41 89 c4             	mov    %eax,%r12d
+  80058f:	48 63 c8             	movslq %eax,%rcx
+  800592:	48 85 c9             	test   %rcx,%rcx
+  800595:	0f 88 52 04 00 00    	js     8009ed <umain+0x935>
+        panic("open /big: %ld", (long)f);
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  80059b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        *(int *)buf = i;
+        if ((r = readn(f, buf, sizeof(buf))) < 0)
+  8005a0:	49 bd f3 26 80 00 00 	movabs $0x8026f3,%r13
+  8005a7:	00 00 00 
+        *(int *)buf = i;
+  8005aa:	89 9d 40 fd ff ff    	mov    %ebx,-0x2c0(%rbp)
+        if ((r = readn(f, buf, sizeof(buf))) < 0)
+  8005b0:	ba 00 02 00 00       	mov    $0x200,%edx
+  8005b5:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  8005bc:	44 89 e7             	mov    %r12d,%edi
+  8005bf:	41 ff d5             	call   *%r13
+  8005c2:	48 85 c0             	test   %rax,%rax
+  8005c5:	0f 88 4d 04 00 00    	js     800a18 <umain+0x960>
+            panic("read /big@%ld: %ld", (long)i, (long)r);
+        if (r != sizeof(buf))
+  8005cb:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  8005d1:	0f 85 72 04 00 00    	jne    800a49 <umain+0x991>
+            panic("read /big from %ld returned %ld < %d bytes",
+                  (long)i, (long)r, (uint32_t)sizeof(buf));
+        if (*(int *)buf != i)
+  8005d7:	44 8b 85 40 fd ff ff 	mov    -0x2c0(%rbp),%r8d
+  8005de:	49 63 c0             	movslq %r8d,%rax
+  8005e1:	48 39 d8             	cmp    %rbx,%rax
+  8005e4:	0f 85 96 04 00 00    	jne    800a80 <umain+0x9c8>
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  8005ea:	48 8d 83 00 02 00 00 	lea    0x200(%rbx),%rax
+  8005f1:	48 89 c3             	mov    %rax,%rbx
+  8005f4:	48 3d 00 e0 01 00    	cmp    $0x1e000,%rax
+  8005fa:	75 ae                	jne    8005aa <umain+0x4f2>
+            panic("read /big from %ld returned bad data %d",
+                  (long)i, *(int *)buf);
+    }
+    close(f);
+  8005fc:	44 89 e7             	mov    %r12d,%edi
+  8005ff:	48 b8 b7 24 80 00 00 	movabs $0x8024b7,%rax
+  800606:	00 00 00 
+  800609:	ff d0                	call   *%rax
+    cprintf("large file is good\n");
+  80060b:	48 bf 4e 37 80 00 00 	movabs $0x80374e,%rdi
+  800612:	00 00 00 
+  800615:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061a:	48 ba c8 0c 80 00 00 	movabs $0x800cc8,%rdx
+  800621:	00 00 00 
+  800624:	ff d2                	call   *%rdx
+}
+  800626:	48 81 c4 a8 02 00 00 	add    $0x2a8,%rsp
+  80062d:	5b                   	pop    %rbx
+  80062e:	41 5c                	pop    %r12
+  800630:	41 5d                	pop    %r13
+  800632:	5d                   	pop    %rbp
+  800633:	c3                   	ret
+        panic("serve_open /not-found: %ld", (long)r);
+  800634:	48 ba a3 35 80 00 00 	movabs $0x8035a3,%rdx
+  80063b:	00 00 00 
+  80063e:	be 1f 00 00 00       	mov    $0x1f,%esi
+  800643:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  80064a:	00 00 00 
+  80064d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800652:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  800659:	00 00 00 
+  80065c:	41 ff d0             	call   *%r8
+        panic("serve_open /not-found succeeded!");
+  80065f:	48 ba 68 37 80 00 00 	movabs $0x803768,%rdx
+  800666:	00 00 00 
+  800669:	be 21 00 00 00       	mov    $0x21,%esi
+  80066e:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  800675:	00 00 00 
+  800678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067d:	48 b9 78 0b 80 00 00 	movabs $0x800b78,%rcx
+  800684:	00 00 00 
+  800687:	ff d1                	call   *%rcx
+        panic("serve_open /newmotd: %ld", (long)r);
+  800689:	48 ba d7 35 80 00 00 	movabs $0x8035d7,%rdx
+  800690:	00 00 00 
+  800693:	be 24 00 00 00       	mov    $0x24,%esi
+  800698:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  80069f:	00 00 00 
+  8006a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a7:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  8006ae:	00 00 00 
+  8006b1:	41 ff d0             	call   *%r8
+        panic("serve_open did not fill struct Fd correctly\n");
+  8006b4:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  8006bb:	00 00 00 
+  8006be:	be 26 00 00 00       	mov    $0x26,%esi
+  8006c3:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  8006ca:	00 00 00 
+  8006cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d2:	48 b9 78 0b 80 00 00 	movabs $0x800b78,%rcx
+  8006d9:	00 00 00 
+  8006dc:	ff d1                	call   *%rcx
+        panic("file_stat: %ld", (long)r);
+  8006de:	48 ba 04 36 80 00 00 	movabs $0x803604,%rdx
+  8006e5:	00 00 00 
+  8006e8:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8006ed:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  8006f4:	00 00 00 
+  8006f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006fc:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  800703:	00 00 00 
+  800706:	41 ff d0             	call   *%r8
+        panic("file_stat returned size %ld wanted %zd\n", (long)st.st_size, strlen(msg));
+  800709:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800710:	00 00 00 
+  800713:	48 8b 38             	mov    (%rax),%rdi
+  800716:	48 b8 af 15 80 00 00 	movabs $0x8015af,%rax
+  80071d:	00 00 00 
+  800720:	ff d0                	call   *%rax
+  800722:	49 89 c0             	mov    %rax,%r8
+  800725:	48 63 4d c0          	movslq -0x40(%rbp),%rcx
+  800729:	48 ba c0 37 80 00 00 	movabs $0x8037c0,%rdx
+  800730:	00 00 00 
+  800733:	be 2c 00 00 00       	mov    $0x2c,%esi
+  800738:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  80073f:	00 00 00 
+  800742:	b8 00 00 00 00       	mov    $0x0,%eax
+  800747:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  80074e:	00 00 00 
+  800751:	41 ff d1             	call   *%r9
+        panic("file_read: %ld", (long)r);
+  800754:	48 89 c1             	mov    %rax,%rcx
+  800757:	48 ba 26 36 80 00 00 	movabs $0x803626,%rdx
+  80075e:	00 00 00 
+  800761:	be 31 00 00 00       	mov    $0x31,%esi
+  800766:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  80076d:	00 00 00 
+  800770:	b8 00 00 00 00       	mov    $0x0,%eax
+  800775:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  80077c:	00 00 00 
+  80077f:	41 ff d0             	call   *%r8
+        panic("file_read returned wrong data");
+  800782:	48 ba 35 36 80 00 00 	movabs $0x803635,%rdx
+  800789:	00 00 00 
+  80078c:	be 33 00 00 00       	mov    $0x33,%esi
+  800791:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  800798:	00 00 00 
+  80079b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a0:	48 b9 78 0b 80 00 00 	movabs $0x800b78,%rcx
+  8007a7:	00 00 00 
+  8007aa:	ff d1                	call   *%rcx
+        panic("file_close: %ld", (long)r);
+  8007ac:	48 ba 66 36 80 00 00 	movabs $0x803666,%rdx
+  8007b3:	00 00 00 
+  8007b6:	be 37 00 00 00       	mov    $0x37,%esi
+  8007bb:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  8007c2:	00 00 00 
+  8007c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ca:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  8007d1:	00 00 00 
+  8007d4:	41 ff d0             	call   *%r8
+        panic("serve_read does not handle stale fileids correctly: %ld", (long)r);
+  8007d7:	48 89 c1             	mov    %rax,%rcx
+  8007da:	48 ba e8 37 80 00 00 	movabs $0x8037e8,%rdx
+  8007e1:	00 00 00 
+  8007e4:	be 42 00 00 00       	mov    $0x42,%esi
+  8007e9:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  8007f0:	00 00 00 
+  8007f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f8:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  8007ff:	00 00 00 
+  800802:	41 ff d0             	call   *%r8
+        panic("serve_open /new-file: %ld", (long)r);
+  800805:	48 ba aa 36 80 00 00 	movabs $0x8036aa,%rdx
+  80080c:	00 00 00 
+  80080f:	be 47 00 00 00       	mov    $0x47,%esi
+  800814:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  80081b:	00 00 00 
+  80081e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800823:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  80082a:	00 00 00 
+  80082d:	41 ff d0             	call   *%r8
+        panic("file_write: %ld", (long)r);
+  800830:	48 89 d9             	mov    %rbx,%rcx
+  800833:	48 ba c4 36 80 00 00 	movabs $0x8036c4,%rdx
+  80083a:	00 00 00 
+  80083d:	be 4a 00 00 00       	mov    $0x4a,%esi
+  800842:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  800849:	00 00 00 
+  80084c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800851:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  800858:	00 00 00 
+  80085b:	41 ff d0             	call   *%r8
+        panic("file_read after file_write: %ld", (long)r);
+  80085e:	48 89 c1             	mov    %rax,%rcx
+  800861:	48 ba 20 38 80 00 00 	movabs $0x803820,%rdx
+  800868:	00 00 00 
+  80086b:	be 50 00 00 00       	mov    $0x50,%esi
+  800870:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  800877:	00 00 00 
+  80087a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087f:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  800886:	00 00 00 
+  800889:	41 ff d0             	call   *%r8
+        panic("file_read after file_write returned wrong length: %ld", (long)r);
+  80088c:	48 89 d9             	mov    %rbx,%rcx
+  80088f:	48 ba 40 38 80 00 00 	movabs $0x803840,%rdx
+  800896:	00 00 00 
+  800899:	be 52 00 00 00       	mov    $0x52,%esi
+  80089e:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  8008a5:	00 00 00 
+  8008a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ad:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  8008b4:	00 00 00 
+  8008b7:	41 ff d0             	call   *%r8
+        panic("file_read after file_write returned wrong data");
+  8008ba:	48 ba 78 38 80 00 00 	movabs $0x803878,%rdx
+  8008c1:	00 00 00 
+  8008c4:	be 54 00 00 00       	mov    $0x54,%esi
+  8008c9:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  8008d0:	00 00 00 
+  8008d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d8:	48 b9 78 0b 80 00 00 	movabs $0x800b78,%rcx
+  8008df:	00 00 00 
+  8008e2:	ff d1                	call   *%rcx
+        panic("open /not-found: %ld", (long)r);
+  8008e4:	48 ba a9 35 80 00 00 	movabs $0x8035a9,%rdx
+  8008eb:	00 00 00 
+  8008ee:	be 59 00 00 00       	mov    $0x59,%esi
+  8008f3:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  8008fa:	00 00 00 
+  8008fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800902:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  800909:	00 00 00 
+  80090c:	41 ff d0             	call   *%r8
+        panic("open /not-found succeeded!");
+  80090f:	48 ba e8 36 80 00 00 	movabs $0x8036e8,%rdx
+  800916:	00 00 00 
+  800919:	be 5b 00 00 00       	mov    $0x5b,%esi
+  80091e:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  800925:	00 00 00 
+  800928:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092d:	48 b9 78 0b 80 00 00 	movabs $0x800b78,%rcx
+  800934:	00 00 00 
+  800937:	ff d1                	call   *%rcx
+        panic("open /newmotd: %ld", (long)r);
+  800939:	48 89 c1             	mov    %rax,%rcx
+  80093c:	48 ba dd 35 80 00 00 	movabs $0x8035dd,%rdx
+  800943:	00 00 00 
+  800946:	be 5e 00 00 00       	mov    $0x5e,%esi
+  80094b:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  800952:	00 00 00 
+  800955:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095a:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  800961:	00 00 00 
+  800964:	41 ff d0             	call   *%r8
+        panic("open did not fill struct Fd correctly\n");
+  800967:	48 ba d0 38 80 00 00 	movabs $0x8038d0,%rdx
+  80096e:	00 00 00 
+  800971:	be 61 00 00 00       	mov    $0x61,%esi
+  800976:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  80097d:	00 00 00 
+  800980:	b8 00 00 00 00       	mov    $0x0,%eax
+  800985:	48 b9 78 0b 80 00 00 	movabs $0x800b78,%rcx
+  80098c:	00 00 00 
+  80098f:	ff d1                	call   *%rcx
+        panic("creat /big: %ld", (long)f);
+  800991:	48 ba 08 37 80 00 00 	movabs $0x803708,%rdx
+  800998:	00 00 00 
+  80099b:	be 66 00 00 00       	mov    $0x66,%esi
+  8009a0:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  8009a7:	00 00 00 
+  8009aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009af:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  8009b6:	00 00 00 
+  8009b9:	41 ff d0             	call   *%r8
+            panic("write /big@%ld: %ld", (long)i, (long)r);
+  8009bc:	49 89 c0             	mov    %rax,%r8
+  8009bf:	48 89 d9             	mov    %rbx,%rcx
+  8009c2:	48 ba 18 37 80 00 00 	movabs $0x803718,%rdx
+  8009c9:	00 00 00 
+  8009cc:	be 6b 00 00 00       	mov    $0x6b,%esi
+  8009d1:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  8009d8:	00 00 00 
+  8009db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e0:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  8009e7:	00 00 00 
+  8009ea:	41 ff d1             	call   *%r9
+        panic("open /big: %ld", (long)f);
+  8009ed:	48 ba 2c 37 80 00 00 	movabs $0x80372c,%rdx
+  8009f4:	00 00 00 
+  8009f7:	be 70 00 00 00       	mov    $0x70,%esi
+  8009fc:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  800a03:	00 00 00 
+  800a06:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0b:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  800a12:	00 00 00 
+  800a15:	41 ff d0             	call   *%r8
+            panic("read /big@%ld: %ld", (long)i, (long)r);
+  800a18:	49 89 c0             	mov    %rax,%r8
+  800a1b:	48 89 d9             	mov    %rbx,%rcx
+  800a1e:	48 ba 3b 37 80 00 00 	movabs $0x80373b,%rdx
+  800a25:	00 00 00 
+  800a28:	be 74 00 00 00       	mov    $0x74,%esi
+  800a2d:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  800a34:	00 00 00 
+  800a37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3c:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  800a43:	00 00 00 
+  800a46:	41 ff d1             	call   *%r9
+            panic("read /big from %ld returned %ld < %d bytes",
+  800a49:	41 b9 00 02 00 00    	mov    $0x200,%r9d
+  800a4f:	49 89 c0             	mov    %rax,%r8
+  800a52:	48 89 d9             	mov    %rbx,%rcx
+  800a55:	48 ba f8 38 80 00 00 	movabs $0x8038f8,%rdx
+  800a5c:	00 00 00 
+  800a5f:	be 76 00 00 00       	mov    $0x76,%esi
+  800a64:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  800a6b:	00 00 00 
+  800a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a73:	49 ba 78 0b 80 00 00 	movabs $0x800b78,%r10
+  800a7a:	00 00 00 
+  800a7d:	41 ff d2             	call   *%r10
+            panic("read /big from %ld returned bad data %d",
+  800a80:	48 89 d9             	mov    %rbx,%rcx
+  800a83:	48 ba 28 39 80 00 00 	movabs $0x803928,%rdx
+  800a8a:	00 00 00 
+  800a8d:	be 79 00 00 00       	mov    $0x79,%esi
+  800a92:	48 bf be 35 80 00 00 	movabs $0x8035be,%rdi
+  800a99:	00 00 00 
+  800a9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa1:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  800aa8:	00 00 00 
+  800aab:	41 ff d1             	call   *%r9
+
+0000000000800aae <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800aae:	55                   	push   %rbp
+  800aaf:	48 89 e5             	mov    %rsp,%rbp
+  800ab2:	41 56                	push   %r14
+  800ab4:	41 55                	push   %r13
+  800ab6:	41 54                	push   %r12
+  800ab8:	53                   	push   %rbx
+  800ab9:	41 89 fd             	mov    %edi,%r13d
+  800abc:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800abf:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  800ac6:	00 00 00 
+  800ac9:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  800ad0:	00 00 00 
+  800ad3:	48 39 c2             	cmp    %rax,%rdx
+  800ad6:	73 17                	jae    800aef <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800ad8:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800adb:	49 89 c4             	mov    %rax,%r12
+  800ade:	48 83 c3 08          	add    $0x8,%rbx
+  800ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae7:	ff 53 f8             	call   *-0x8(%rbx)
+  800aea:	4c 39 e3             	cmp    %r12,%rbx
+  800aed:	72 ef                	jb     800ade <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800aef:	48 b8 dd 1a 80 00 00 	movabs $0x801add,%rax
+  800af6:	00 00 00 
+  800af9:	ff d0                	call   *%rax
+  800afb:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800afe:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800b05:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800b0c:	00 00 00 
+  800b0f:	48 01 d0             	add    %rdx,%rax
+  800b12:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800b19:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800b1c:	45 85 ed             	test   %r13d,%r13d
+  800b1f:	7e 0d                	jle    800b2e <libmain+0x80>
+  800b21:	49 8b 06             	mov    (%r14),%rax
+  800b24:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  800b2b:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800b2e:	4c 89 f6             	mov    %r14,%rsi
+  800b31:	44 89 ef             	mov    %r13d,%edi
+  800b34:	48 b8 b8 00 80 00 00 	movabs $0x8000b8,%rax
+  800b3b:	00 00 00 
+  800b3e:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800b40:	48 b8 55 0b 80 00 00 	movabs $0x800b55,%rax
+  800b47:	00 00 00 
+  800b4a:	ff d0                	call   *%rax
+#endif
+}
+  800b4c:	5b                   	pop    %rbx
+  800b4d:	41 5c                	pop    %r12
+  800b4f:	41 5d                	pop    %r13
+  800b51:	41 5e                	pop    %r14
+  800b53:	5d                   	pop    %rbp
+  800b54:	c3                   	ret
+
+0000000000800b55 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800b55:	55                   	push   %rbp
+  800b56:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800b59:	48 b8 ea 24 80 00 00 	movabs $0x8024ea,%rax
+  800b60:	00 00 00 
+  800b63:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800b65:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b6a:	48 b8 72 1a 80 00 00 	movabs $0x801a72,%rax
+  800b71:	00 00 00 
+  800b74:	ff d0                	call   *%rax
+}
+  800b76:	5d                   	pop    %rbp
+  800b77:	c3                   	ret
+
+0000000000800b78 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800b78:	55                   	push   %rbp
+  800b79:	48 89 e5             	mov    %rsp,%rbp
+  800b7c:	41 56                	push   %r14
+  800b7e:	41 55                	push   %r13
+  800b80:	41 54                	push   %r12
+  800b82:	53                   	push   %rbx
+  800b83:	48 83 ec 50          	sub    $0x50,%rsp
+  800b87:	49 89 fc             	mov    %rdi,%r12
+  800b8a:	41 89 f5             	mov    %esi,%r13d
+  800b8d:	48 89 d3             	mov    %rdx,%rbx
+  800b90:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800b94:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800b98:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b9c:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800ba3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ba7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800bab:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800baf:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800bb3:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  800bba:	00 00 00 
+  800bbd:	4c 8b 30             	mov    (%rax),%r14
+  800bc0:	48 b8 dd 1a 80 00 00 	movabs $0x801add,%rax
+  800bc7:	00 00 00 
+  800bca:	ff d0                	call   *%rax
+  800bcc:	89 c6                	mov    %eax,%esi
+  800bce:	45 89 e8             	mov    %r13d,%r8d
+  800bd1:	4c 89 e1             	mov    %r12,%rcx
+  800bd4:	4c 89 f2             	mov    %r14,%rdx
+  800bd7:	48 bf 80 39 80 00 00 	movabs $0x803980,%rdi
+  800bde:	00 00 00 
+  800be1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be6:	49 bc c8 0c 80 00 00 	movabs $0x800cc8,%r12
+  800bed:	00 00 00 
+  800bf0:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800bf3:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800bf7:	48 89 df             	mov    %rbx,%rdi
+  800bfa:	48 b8 64 0c 80 00 00 	movabs $0x800c64,%rax
+  800c01:	00 00 00 
+  800c04:	ff d0                	call   *%rax
+    cprintf("\n");
+  800c06:	48 bf 64 36 80 00 00 	movabs $0x803664,%rdi
+  800c0d:	00 00 00 
+  800c10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c15:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800c18:	cc                   	int3
+  800c19:	eb fd                	jmp    800c18 <_panic+0xa0>
+
+0000000000800c1b <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800c1b:	55                   	push   %rbp
+  800c1c:	48 89 e5             	mov    %rsp,%rbp
+  800c1f:	53                   	push   %rbx
+  800c20:	48 83 ec 08          	sub    $0x8,%rsp
+  800c24:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800c27:	8b 06                	mov    (%rsi),%eax
+  800c29:	8d 50 01             	lea    0x1(%rax),%edx
+  800c2c:	89 16                	mov    %edx,(%rsi)
+  800c2e:	48 98                	cltq
+  800c30:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800c35:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800c3b:	74 0a                	je     800c47 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800c3d:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800c41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c45:	c9                   	leave
+  800c46:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800c47:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800c4b:	be ff 00 00 00       	mov    $0xff,%esi
+  800c50:	48 b8 14 1a 80 00 00 	movabs $0x801a14,%rax
+  800c57:	00 00 00 
+  800c5a:	ff d0                	call   *%rax
+        state->offset = 0;
+  800c5c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800c62:	eb d9                	jmp    800c3d <putch+0x22>
+
+0000000000800c64 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800c64:	55                   	push   %rbp
+  800c65:	48 89 e5             	mov    %rsp,%rbp
+  800c68:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800c6f:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800c72:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800c79:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c83:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800c86:	48 89 f1             	mov    %rsi,%rcx
+  800c89:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800c90:	48 bf 1b 0c 80 00 00 	movabs $0x800c1b,%rdi
+  800c97:	00 00 00 
+  800c9a:	48 b8 18 0e 80 00 00 	movabs $0x800e18,%rax
+  800ca1:	00 00 00 
+  800ca4:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800ca6:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800cad:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800cb4:	48 b8 14 1a 80 00 00 	movabs $0x801a14,%rax
+  800cbb:	00 00 00 
+  800cbe:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800cc0:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800cc6:	c9                   	leave
+  800cc7:	c3                   	ret
+
+0000000000800cc8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800cc8:	55                   	push   %rbp
+  800cc9:	48 89 e5             	mov    %rsp,%rbp
+  800ccc:	48 83 ec 50          	sub    $0x50,%rsp
+  800cd0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800cd4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800cd8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800cdc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ce0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800ce4:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800ceb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cf7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800cfb:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800cff:	48 b8 64 0c 80 00 00 	movabs $0x800c64,%rax
+  800d06:	00 00 00 
+  800d09:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800d0b:	c9                   	leave
+  800d0c:	c3                   	ret
+
+0000000000800d0d <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800d0d:	55                   	push   %rbp
+  800d0e:	48 89 e5             	mov    %rsp,%rbp
+  800d11:	41 57                	push   %r15
+  800d13:	41 56                	push   %r14
+  800d15:	41 55                	push   %r13
+  800d17:	41 54                	push   %r12
+  800d19:	53                   	push   %rbx
+  800d1a:	48 83 ec 18          	sub    $0x18,%rsp
+  800d1e:	49 89 fc             	mov    %rdi,%r12
+  800d21:	49 89 f5             	mov    %rsi,%r13
+  800d24:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800d28:	8b 45 10             	mov    0x10(%rbp),%eax
+  800d2b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800d2e:	41 89 cf             	mov    %ecx,%r15d
+  800d31:	4c 39 fa             	cmp    %r15,%rdx
+  800d34:	73 5b                	jae    800d91 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800d36:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800d3a:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800d3e:	85 db                	test   %ebx,%ebx
+  800d40:	7e 0e                	jle    800d50 <print_num+0x43>
+            putch(padc, put_arg);
+  800d42:	4c 89 ee             	mov    %r13,%rsi
+  800d45:	44 89 f7             	mov    %r14d,%edi
+  800d48:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800d4b:	83 eb 01             	sub    $0x1,%ebx
+  800d4e:	75 f2                	jne    800d42 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800d50:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800d54:	48 b9 b4 39 80 00 00 	movabs $0x8039b4,%rcx
+  800d5b:	00 00 00 
+  800d5e:	48 b8 a3 39 80 00 00 	movabs $0x8039a3,%rax
+  800d65:	00 00 00 
+  800d68:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800d6c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d70:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d75:	49 f7 f7             	div    %r15
+  800d78:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800d7c:	4c 89 ee             	mov    %r13,%rsi
+  800d7f:	41 ff d4             	call   *%r12
+}
+  800d82:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d86:	5b                   	pop    %rbx
+  800d87:	41 5c                	pop    %r12
+  800d89:	41 5d                	pop    %r13
+  800d8b:	41 5e                	pop    %r14
+  800d8d:	41 5f                	pop    %r15
+  800d8f:	5d                   	pop    %rbp
+  800d90:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800d91:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d95:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9a:	49 f7 f7             	div    %r15
+  800d9d:	48 83 ec 08          	sub    $0x8,%rsp
+  800da1:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800da5:	52                   	push   %rdx
+  800da6:	45 0f be c9          	movsbl %r9b,%r9d
+  800daa:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800dae:	48 89 c2             	mov    %rax,%rdx
+  800db1:	48 b8 0d 0d 80 00 00 	movabs $0x800d0d,%rax
+  800db8:	00 00 00 
+  800dbb:	ff d0                	call   *%rax
+  800dbd:	48 83 c4 10          	add    $0x10,%rsp
+  800dc1:	eb 8d                	jmp    800d50 <print_num+0x43>
+
+0000000000800dc3 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800dc3:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800dc7:	48 8b 06             	mov    (%rsi),%rax
+  800dca:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800dce:	73 0a                	jae    800dda <sprintputch+0x17>
+        *state->start++ = ch;
+  800dd0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800dd4:	48 89 16             	mov    %rdx,(%rsi)
+  800dd7:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800dda:	c3                   	ret
+
+0000000000800ddb <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800ddb:	55                   	push   %rbp
+  800ddc:	48 89 e5             	mov    %rsp,%rbp
+  800ddf:	48 83 ec 50          	sub    $0x50,%rsp
+  800de3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800de7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800deb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800def:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800df6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dfa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dfe:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e02:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800e06:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e0a:	48 b8 18 0e 80 00 00 	movabs $0x800e18,%rax
+  800e11:	00 00 00 
+  800e14:	ff d0                	call   *%rax
+}
+  800e16:	c9                   	leave
+  800e17:	c3                   	ret
+
+0000000000800e18 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800e18:	55                   	push   %rbp
+  800e19:	48 89 e5             	mov    %rsp,%rbp
+  800e1c:	41 57                	push   %r15
+  800e1e:	41 56                	push   %r14
+  800e20:	41 55                	push   %r13
+  800e22:	41 54                	push   %r12
+  800e24:	53                   	push   %rbx
+  800e25:	48 83 ec 38          	sub    $0x38,%rsp
+  800e29:	49 89 fe             	mov    %rdi,%r14
+  800e2c:	49 89 f5             	mov    %rsi,%r13
+  800e2f:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800e32:	48 8b 01             	mov    (%rcx),%rax
+  800e35:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800e39:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800e3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e41:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800e45:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800e49:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800e4d:	0f b6 3b             	movzbl (%rbx),%edi
+  800e50:	40 80 ff 25          	cmp    $0x25,%dil
+  800e54:	74 18                	je     800e6e <vprintfmt+0x56>
+            if (!ch) return;
+  800e56:	40 84 ff             	test   %dil,%dil
+  800e59:	0f 84 b1 06 00 00    	je     801510 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800e5f:	40 0f b6 ff          	movzbl %dil,%edi
+  800e63:	4c 89 ee             	mov    %r13,%rsi
+  800e66:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800e69:	4c 89 e3             	mov    %r12,%rbx
+  800e6c:	eb db                	jmp    800e49 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800e6e:	be 00 00 00 00       	mov    $0x0,%esi
+  800e73:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800e77:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800e7c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800e82:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800e89:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800e8d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800e92:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800e97:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800e9a:	83 e8 23             	sub    $0x23,%eax
+  800e9d:	3c 57                	cmp    $0x57,%al
+  800e9f:	0f 87 51 06 00 00    	ja     8014f6 <vprintfmt+0x6de>
+  800ea5:	0f b6 c0             	movzbl %al,%eax
+  800ea8:	48 b9 60 3b 80 00 00 	movabs $0x803b60,%rcx
+  800eaf:	00 00 00 
+  800eb2:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800eb5:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800eb8:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800ebc:	eb cf                	jmp    800e8d <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800ebe:	49 89 dc             	mov    %rbx,%r12
+  800ec1:	be 01 00 00 00       	mov    $0x1,%esi
+  800ec6:	eb c5                	jmp    800e8d <vprintfmt+0x75>
+            padc = ch;
+  800ec8:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800ecc:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800ecf:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800ed2:	eb b9                	jmp    800e8d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800ed4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ed7:	83 f8 2f             	cmp    $0x2f,%eax
+  800eda:	77 24                	ja     800f00 <vprintfmt+0xe8>
+  800edc:	89 c1                	mov    %eax,%ecx
+  800ede:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800ee2:	83 c0 08             	add    $0x8,%eax
+  800ee5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ee8:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800eeb:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800eee:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800ef2:	79 99                	jns    800e8d <vprintfmt+0x75>
+                width = precision;
+  800ef4:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800ef8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800efe:	eb 8d                	jmp    800e8d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800f00:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800f04:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800f08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f0c:	eb da                	jmp    800ee8 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800f0e:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800f13:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800f17:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800f1d:	3c 39                	cmp    $0x39,%al
+  800f1f:	77 1c                	ja     800f3d <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800f21:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800f25:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800f29:	0f b6 c0             	movzbl %al,%eax
+  800f2c:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800f31:	0f b6 03             	movzbl (%rbx),%eax
+  800f34:	3c 39                	cmp    $0x39,%al
+  800f36:	76 e9                	jbe    800f21 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800f38:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800f3b:	eb b1                	jmp    800eee <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800f3d:	49 89 dc             	mov    %rbx,%r12
+  800f40:	eb ac                	jmp    800eee <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800f42:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800f45:	85 c9                	test   %ecx,%ecx
+  800f47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f4c:	0f 49 c1             	cmovns %ecx,%eax
+  800f4f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800f52:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800f55:	e9 33 ff ff ff       	jmp    800e8d <vprintfmt+0x75>
+            lflag++;
+  800f5a:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800f5d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800f60:	e9 28 ff ff ff       	jmp    800e8d <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800f65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f68:	83 f8 2f             	cmp    $0x2f,%eax
+  800f6b:	77 19                	ja     800f86 <vprintfmt+0x16e>
+  800f6d:	89 c2                	mov    %eax,%edx
+  800f6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f73:	83 c0 08             	add    $0x8,%eax
+  800f76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f79:	8b 3a                	mov    (%rdx),%edi
+  800f7b:	4c 89 ee             	mov    %r13,%rsi
+  800f7e:	41 ff d6             	call   *%r14
+            break;
+  800f81:	e9 c3 fe ff ff       	jmp    800e49 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800f86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f92:	eb e5                	jmp    800f79 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800f94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f97:	83 f8 2f             	cmp    $0x2f,%eax
+  800f9a:	77 5a                	ja     800ff6 <vprintfmt+0x1de>
+  800f9c:	89 c2                	mov    %eax,%edx
+  800f9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fa2:	83 c0 08             	add    $0x8,%eax
+  800fa5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800fa8:	8b 02                	mov    (%rdx),%eax
+  800faa:	89 c1                	mov    %eax,%ecx
+  800fac:	f7 d9                	neg    %ecx
+  800fae:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800fb1:	83 f9 15             	cmp    $0x15,%ecx
+  800fb4:	7f 4e                	jg     801004 <vprintfmt+0x1ec>
+  800fb6:	48 63 c1             	movslq %ecx,%rax
+  800fb9:	48 ba 20 3e 80 00 00 	movabs $0x803e20,%rdx
+  800fc0:	00 00 00 
+  800fc3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800fc7:	48 85 c0             	test   %rax,%rax
+  800fca:	74 38                	je     801004 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800fcc:	48 89 c1             	mov    %rax,%rcx
+  800fcf:	48 ba f9 3f 80 00 00 	movabs $0x803ff9,%rdx
+  800fd6:	00 00 00 
+  800fd9:	4c 89 ee             	mov    %r13,%rsi
+  800fdc:	4c 89 f7             	mov    %r14,%rdi
+  800fdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe4:	49 b8 db 0d 80 00 00 	movabs $0x800ddb,%r8
+  800feb:	00 00 00 
+  800fee:	41 ff d0             	call   *%r8
+  800ff1:	e9 53 fe ff ff       	jmp    800e49 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800ff6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ffa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ffe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801002:	eb a4                	jmp    800fa8 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801004:	48 ba cc 39 80 00 00 	movabs $0x8039cc,%rdx
+  80100b:	00 00 00 
+  80100e:	4c 89 ee             	mov    %r13,%rsi
+  801011:	4c 89 f7             	mov    %r14,%rdi
+  801014:	b8 00 00 00 00       	mov    $0x0,%eax
+  801019:	49 b8 db 0d 80 00 00 	movabs $0x800ddb,%r8
+  801020:	00 00 00 
+  801023:	41 ff d0             	call   *%r8
+  801026:	e9 1e fe ff ff       	jmp    800e49 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80102b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80102e:	83 f8 2f             	cmp    $0x2f,%eax
+  801031:	77 6c                	ja     80109f <vprintfmt+0x287>
+  801033:	89 c2                	mov    %eax,%edx
+  801035:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801039:	83 c0 08             	add    $0x8,%eax
+  80103c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80103f:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801042:	48 85 d2             	test   %rdx,%rdx
+  801045:	48 b8 c5 39 80 00 00 	movabs $0x8039c5,%rax
+  80104c:	00 00 00 
+  80104f:	48 0f 45 c2          	cmovne %rdx,%rax
+  801053:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801057:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80105b:	7e 06                	jle    801063 <vprintfmt+0x24b>
+  80105d:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801061:	75 4a                	jne    8010ad <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801063:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801067:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80106b:	0f b6 00             	movzbl (%rax),%eax
+  80106e:	84 c0                	test   %al,%al
+  801070:	0f 85 9a 00 00 00    	jne    801110 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  801076:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801079:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80107d:	85 c0                	test   %eax,%eax
+  80107f:	0f 8e c4 fd ff ff    	jle    800e49 <vprintfmt+0x31>
+  801085:	4c 89 ee             	mov    %r13,%rsi
+  801088:	bf 20 00 00 00       	mov    $0x20,%edi
+  80108d:	41 ff d6             	call   *%r14
+  801090:	41 83 ec 01          	sub    $0x1,%r12d
+  801094:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801098:	75 eb                	jne    801085 <vprintfmt+0x26d>
+  80109a:	e9 aa fd ff ff       	jmp    800e49 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80109f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010ab:	eb 92                	jmp    80103f <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8010ad:	49 63 f7             	movslq %r15d,%rsi
+  8010b0:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8010b4:	48 b8 ca 15 80 00 00 	movabs $0x8015ca,%rax
+  8010bb:	00 00 00 
+  8010be:	ff d0                	call   *%rax
+  8010c0:	48 89 c2             	mov    %rax,%rdx
+  8010c3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8010c6:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8010c8:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8010cb:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8010ce:	85 c0                	test   %eax,%eax
+  8010d0:	7e 91                	jle    801063 <vprintfmt+0x24b>
+  8010d2:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8010d7:	4c 89 ee             	mov    %r13,%rsi
+  8010da:	44 89 e7             	mov    %r12d,%edi
+  8010dd:	41 ff d6             	call   *%r14
+  8010e0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8010e4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8010e7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8010ea:	75 eb                	jne    8010d7 <vprintfmt+0x2bf>
+  8010ec:	e9 72 ff ff ff       	jmp    801063 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8010f1:	0f b6 f8             	movzbl %al,%edi
+  8010f4:	4c 89 ee             	mov    %r13,%rsi
+  8010f7:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8010fa:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8010fe:	49 83 c4 01          	add    $0x1,%r12
+  801102:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801108:	84 c0                	test   %al,%al
+  80110a:	0f 84 66 ff ff ff    	je     801076 <vprintfmt+0x25e>
+  801110:	45 85 ff             	test   %r15d,%r15d
+  801113:	78 0a                	js     80111f <vprintfmt+0x307>
+  801115:	41 83 ef 01          	sub    $0x1,%r15d
+  801119:	0f 88 57 ff ff ff    	js     801076 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80111f:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801123:	74 cc                	je     8010f1 <vprintfmt+0x2d9>
+  801125:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801128:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80112d:	80 fa 5e             	cmp    $0x5e,%dl
+  801130:	77 c2                	ja     8010f4 <vprintfmt+0x2dc>
+  801132:	eb bd                	jmp    8010f1 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  801134:	40 84 f6             	test   %sil,%sil
+  801137:	75 26                	jne    80115f <vprintfmt+0x347>
+    switch (lflag) {
+  801139:	85 d2                	test   %edx,%edx
+  80113b:	74 59                	je     801196 <vprintfmt+0x37e>
+  80113d:	83 fa 01             	cmp    $0x1,%edx
+  801140:	74 7b                	je     8011bd <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  801142:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801145:	83 f8 2f             	cmp    $0x2f,%eax
+  801148:	0f 87 96 00 00 00    	ja     8011e4 <vprintfmt+0x3cc>
+  80114e:	89 c2                	mov    %eax,%edx
+  801150:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801154:	83 c0 08             	add    $0x8,%eax
+  801157:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80115a:	4c 8b 22             	mov    (%rdx),%r12
+  80115d:	eb 17                	jmp    801176 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80115f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801162:	83 f8 2f             	cmp    $0x2f,%eax
+  801165:	77 21                	ja     801188 <vprintfmt+0x370>
+  801167:	89 c2                	mov    %eax,%edx
+  801169:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80116d:	83 c0 08             	add    $0x8,%eax
+  801170:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801173:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801176:	4d 85 e4             	test   %r12,%r12
+  801179:	78 7a                	js     8011f5 <vprintfmt+0x3dd>
+            num = i;
+  80117b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80117e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801183:	e9 50 02 00 00       	jmp    8013d8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801188:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80118c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801190:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801194:	eb dd                	jmp    801173 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  801196:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801199:	83 f8 2f             	cmp    $0x2f,%eax
+  80119c:	77 11                	ja     8011af <vprintfmt+0x397>
+  80119e:	89 c2                	mov    %eax,%edx
+  8011a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011a4:	83 c0 08             	add    $0x8,%eax
+  8011a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011aa:	4c 63 22             	movslq (%rdx),%r12
+  8011ad:	eb c7                	jmp    801176 <vprintfmt+0x35e>
+  8011af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011b3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011bb:	eb ed                	jmp    8011aa <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8011bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8011c3:	77 11                	ja     8011d6 <vprintfmt+0x3be>
+  8011c5:	89 c2                	mov    %eax,%edx
+  8011c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011cb:	83 c0 08             	add    $0x8,%eax
+  8011ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011d1:	4c 8b 22             	mov    (%rdx),%r12
+  8011d4:	eb a0                	jmp    801176 <vprintfmt+0x35e>
+  8011d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011e2:	eb ed                	jmp    8011d1 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8011e4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011e8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011f0:	e9 65 ff ff ff       	jmp    80115a <vprintfmt+0x342>
+                putch('-', put_arg);
+  8011f5:	4c 89 ee             	mov    %r13,%rsi
+  8011f8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8011fd:	41 ff d6             	call   *%r14
+                i = -i;
+  801200:	49 f7 dc             	neg    %r12
+  801203:	e9 73 ff ff ff       	jmp    80117b <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  801208:	40 84 f6             	test   %sil,%sil
+  80120b:	75 32                	jne    80123f <vprintfmt+0x427>
+    switch (lflag) {
+  80120d:	85 d2                	test   %edx,%edx
+  80120f:	74 5d                	je     80126e <vprintfmt+0x456>
+  801211:	83 fa 01             	cmp    $0x1,%edx
+  801214:	0f 84 82 00 00 00    	je     80129c <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80121a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80121d:	83 f8 2f             	cmp    $0x2f,%eax
+  801220:	0f 87 a5 00 00 00    	ja     8012cb <vprintfmt+0x4b3>
+  801226:	89 c2                	mov    %eax,%edx
+  801228:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80122c:	83 c0 08             	add    $0x8,%eax
+  80122f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801232:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801235:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80123a:	e9 99 01 00 00       	jmp    8013d8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80123f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801242:	83 f8 2f             	cmp    $0x2f,%eax
+  801245:	77 19                	ja     801260 <vprintfmt+0x448>
+  801247:	89 c2                	mov    %eax,%edx
+  801249:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80124d:	83 c0 08             	add    $0x8,%eax
+  801250:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801253:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801256:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80125b:	e9 78 01 00 00       	jmp    8013d8 <vprintfmt+0x5c0>
+  801260:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801264:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801268:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80126c:	eb e5                	jmp    801253 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80126e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801271:	83 f8 2f             	cmp    $0x2f,%eax
+  801274:	77 18                	ja     80128e <vprintfmt+0x476>
+  801276:	89 c2                	mov    %eax,%edx
+  801278:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80127c:	83 c0 08             	add    $0x8,%eax
+  80127f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801282:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801284:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801289:	e9 4a 01 00 00       	jmp    8013d8 <vprintfmt+0x5c0>
+  80128e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801292:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801296:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80129a:	eb e6                	jmp    801282 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80129c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80129f:	83 f8 2f             	cmp    $0x2f,%eax
+  8012a2:	77 19                	ja     8012bd <vprintfmt+0x4a5>
+  8012a4:	89 c2                	mov    %eax,%edx
+  8012a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012aa:	83 c0 08             	add    $0x8,%eax
+  8012ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012b0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8012b3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8012b8:	e9 1b 01 00 00       	jmp    8013d8 <vprintfmt+0x5c0>
+  8012bd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012c1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012c9:	eb e5                	jmp    8012b0 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8012cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012d7:	e9 56 ff ff ff       	jmp    801232 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8012dc:	40 84 f6             	test   %sil,%sil
+  8012df:	75 2e                	jne    80130f <vprintfmt+0x4f7>
+    switch (lflag) {
+  8012e1:	85 d2                	test   %edx,%edx
+  8012e3:	74 59                	je     80133e <vprintfmt+0x526>
+  8012e5:	83 fa 01             	cmp    $0x1,%edx
+  8012e8:	74 7f                	je     801369 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8012ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8012f0:	0f 87 9f 00 00 00    	ja     801395 <vprintfmt+0x57d>
+  8012f6:	89 c2                	mov    %eax,%edx
+  8012f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012fc:	83 c0 08             	add    $0x8,%eax
+  8012ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801302:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801305:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80130a:	e9 c9 00 00 00       	jmp    8013d8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80130f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801312:	83 f8 2f             	cmp    $0x2f,%eax
+  801315:	77 19                	ja     801330 <vprintfmt+0x518>
+  801317:	89 c2                	mov    %eax,%edx
+  801319:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80131d:	83 c0 08             	add    $0x8,%eax
+  801320:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801323:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801326:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80132b:	e9 a8 00 00 00       	jmp    8013d8 <vprintfmt+0x5c0>
+  801330:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801334:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801338:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80133c:	eb e5                	jmp    801323 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80133e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801341:	83 f8 2f             	cmp    $0x2f,%eax
+  801344:	77 15                	ja     80135b <vprintfmt+0x543>
+  801346:	89 c2                	mov    %eax,%edx
+  801348:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80134c:	83 c0 08             	add    $0x8,%eax
+  80134f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801352:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801354:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801359:	eb 7d                	jmp    8013d8 <vprintfmt+0x5c0>
+  80135b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80135f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801363:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801367:	eb e9                	jmp    801352 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  801369:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80136c:	83 f8 2f             	cmp    $0x2f,%eax
+  80136f:	77 16                	ja     801387 <vprintfmt+0x56f>
+  801371:	89 c2                	mov    %eax,%edx
+  801373:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801377:	83 c0 08             	add    $0x8,%eax
+  80137a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80137d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801380:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801385:	eb 51                	jmp    8013d8 <vprintfmt+0x5c0>
+  801387:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80138b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80138f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801393:	eb e8                	jmp    80137d <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  801395:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801399:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80139d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013a1:	e9 5c ff ff ff       	jmp    801302 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8013a6:	4c 89 ee             	mov    %r13,%rsi
+  8013a9:	bf 30 00 00 00       	mov    $0x30,%edi
+  8013ae:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8013b1:	4c 89 ee             	mov    %r13,%rsi
+  8013b4:	bf 78 00 00 00       	mov    $0x78,%edi
+  8013b9:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8013bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8013c2:	77 47                	ja     80140b <vprintfmt+0x5f3>
+  8013c4:	89 c2                	mov    %eax,%edx
+  8013c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013ca:	83 c0 08             	add    $0x8,%eax
+  8013cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013d0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8013d3:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8013d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8013dc:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8013e0:	0f 94 c0             	sete   %al
+  8013e3:	0f b6 c0             	movzbl %al,%eax
+  8013e6:	50                   	push   %rax
+  8013e7:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8013ec:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8013f0:	4c 89 ee             	mov    %r13,%rsi
+  8013f3:	4c 89 f7             	mov    %r14,%rdi
+  8013f6:	48 b8 0d 0d 80 00 00 	movabs $0x800d0d,%rax
+  8013fd:	00 00 00 
+  801400:	ff d0                	call   *%rax
+            break;
+  801402:	48 83 c4 10          	add    $0x10,%rsp
+  801406:	e9 3e fa ff ff       	jmp    800e49 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80140b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80140f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801413:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801417:	eb b7                	jmp    8013d0 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  801419:	40 84 f6             	test   %sil,%sil
+  80141c:	75 2b                	jne    801449 <vprintfmt+0x631>
+    switch (lflag) {
+  80141e:	85 d2                	test   %edx,%edx
+  801420:	74 56                	je     801478 <vprintfmt+0x660>
+  801422:	83 fa 01             	cmp    $0x1,%edx
+  801425:	74 7f                	je     8014a6 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  801427:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80142a:	83 f8 2f             	cmp    $0x2f,%eax
+  80142d:	0f 87 a2 00 00 00    	ja     8014d5 <vprintfmt+0x6bd>
+  801433:	89 c2                	mov    %eax,%edx
+  801435:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801439:	83 c0 08             	add    $0x8,%eax
+  80143c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80143f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801442:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801447:	eb 8f                	jmp    8013d8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801449:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80144c:	83 f8 2f             	cmp    $0x2f,%eax
+  80144f:	77 19                	ja     80146a <vprintfmt+0x652>
+  801451:	89 c2                	mov    %eax,%edx
+  801453:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801457:	83 c0 08             	add    $0x8,%eax
+  80145a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80145d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801460:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801465:	e9 6e ff ff ff       	jmp    8013d8 <vprintfmt+0x5c0>
+  80146a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80146e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801472:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801476:	eb e5                	jmp    80145d <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  801478:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80147b:	83 f8 2f             	cmp    $0x2f,%eax
+  80147e:	77 18                	ja     801498 <vprintfmt+0x680>
+  801480:	89 c2                	mov    %eax,%edx
+  801482:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801486:	83 c0 08             	add    $0x8,%eax
+  801489:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80148c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80148e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801493:	e9 40 ff ff ff       	jmp    8013d8 <vprintfmt+0x5c0>
+  801498:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80149c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014a4:	eb e6                	jmp    80148c <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8014a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8014ac:	77 19                	ja     8014c7 <vprintfmt+0x6af>
+  8014ae:	89 c2                	mov    %eax,%edx
+  8014b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014b4:	83 c0 08             	add    $0x8,%eax
+  8014b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014ba:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8014bd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8014c2:	e9 11 ff ff ff       	jmp    8013d8 <vprintfmt+0x5c0>
+  8014c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014d3:	eb e5                	jmp    8014ba <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8014d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014e1:	e9 59 ff ff ff       	jmp    80143f <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8014e6:	4c 89 ee             	mov    %r13,%rsi
+  8014e9:	bf 25 00 00 00       	mov    $0x25,%edi
+  8014ee:	41 ff d6             	call   *%r14
+            break;
+  8014f1:	e9 53 f9 ff ff       	jmp    800e49 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8014f6:	4c 89 ee             	mov    %r13,%rsi
+  8014f9:	bf 25 00 00 00       	mov    $0x25,%edi
+  8014fe:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801501:	48 83 eb 01          	sub    $0x1,%rbx
+  801505:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801509:	75 f6                	jne    801501 <vprintfmt+0x6e9>
+  80150b:	e9 39 f9 ff ff       	jmp    800e49 <vprintfmt+0x31>
+}
+  801510:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801514:	5b                   	pop    %rbx
+  801515:	41 5c                	pop    %r12
+  801517:	41 5d                	pop    %r13
+  801519:	41 5e                	pop    %r14
+  80151b:	41 5f                	pop    %r15
+  80151d:	5d                   	pop    %rbp
+  80151e:	c3                   	ret
+
+000000000080151f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80151f:	55                   	push   %rbp
+  801520:	48 89 e5             	mov    %rsp,%rbp
+  801523:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801527:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80152b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801530:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801534:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80153b:	48 85 ff             	test   %rdi,%rdi
+  80153e:	74 2b                	je     80156b <vsnprintf+0x4c>
+  801540:	48 85 f6             	test   %rsi,%rsi
+  801543:	74 26                	je     80156b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801545:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801549:	48 bf c3 0d 80 00 00 	movabs $0x800dc3,%rdi
+  801550:	00 00 00 
+  801553:	48 b8 18 0e 80 00 00 	movabs $0x800e18,%rax
+  80155a:	00 00 00 
+  80155d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80155f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801563:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801566:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801569:	c9                   	leave
+  80156a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80156b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801570:	eb f7                	jmp    801569 <vsnprintf+0x4a>
+
+0000000000801572 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801572:	55                   	push   %rbp
+  801573:	48 89 e5             	mov    %rsp,%rbp
+  801576:	48 83 ec 50          	sub    $0x50,%rsp
+  80157a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80157e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801582:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801586:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80158d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801591:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801595:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801599:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80159d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8015a1:	48 b8 1f 15 80 00 00 	movabs $0x80151f,%rax
+  8015a8:	00 00 00 
+  8015ab:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8015ad:	c9                   	leave
+  8015ae:	c3                   	ret
+
+00000000008015af <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8015af:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8015b2:	74 10                	je     8015c4 <strlen+0x15>
+    size_t n = 0;
+  8015b4:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8015b9:	48 83 c0 01          	add    $0x1,%rax
+  8015bd:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8015c1:	75 f6                	jne    8015b9 <strlen+0xa>
+  8015c3:	c3                   	ret
+    size_t n = 0;
+  8015c4:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8015c9:	c3                   	ret
+
+00000000008015ca <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8015ca:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8015cd:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8015d2:	48 85 f6             	test   %rsi,%rsi
+  8015d5:	74 11                	je     8015e8 <strnlen+0x1e>
+  8015d7:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8015db:	74 0c                	je     8015e9 <strnlen+0x1f>
+  8015dd:	48 83 c2 01          	add    $0x1,%rdx
+  8015e1:	48 39 d0             	cmp    %rdx,%rax
+  8015e4:	75 f1                	jne    8015d7 <strnlen+0xd>
+  8015e6:	eb 04                	jmp    8015ec <strnlen+0x22>
+  8015e8:	c3                   	ret
+  8015e9:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8015ec:	c3                   	ret
+
+00000000008015ed <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8015ed:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8015f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8015f9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8015fc:	48 83 c2 01          	add    $0x1,%rdx
+  801600:	84 c9                	test   %cl,%cl
+  801602:	75 f1                	jne    8015f5 <strcpy+0x8>
+        ;
+    return res;
+}
+  801604:	c3                   	ret
+
+0000000000801605 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801605:	55                   	push   %rbp
+  801606:	48 89 e5             	mov    %rsp,%rbp
+  801609:	41 54                	push   %r12
+  80160b:	53                   	push   %rbx
+  80160c:	48 89 fb             	mov    %rdi,%rbx
+  80160f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801612:	48 b8 af 15 80 00 00 	movabs $0x8015af,%rax
+  801619:	00 00 00 
+  80161c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80161e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801622:	4c 89 e6             	mov    %r12,%rsi
+  801625:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  80162c:	00 00 00 
+  80162f:	ff d0                	call   *%rax
+    return dst;
+}
+  801631:	48 89 d8             	mov    %rbx,%rax
+  801634:	5b                   	pop    %rbx
+  801635:	41 5c                	pop    %r12
+  801637:	5d                   	pop    %rbp
+  801638:	c3                   	ret
+
+0000000000801639 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801639:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80163c:	48 85 d2             	test   %rdx,%rdx
+  80163f:	74 1f                	je     801660 <strncpy+0x27>
+  801641:	48 01 fa             	add    %rdi,%rdx
+  801644:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801647:	48 83 c1 01          	add    $0x1,%rcx
+  80164b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80164f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801653:	41 80 f8 01          	cmp    $0x1,%r8b
+  801657:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80165b:	48 39 ca             	cmp    %rcx,%rdx
+  80165e:	75 e7                	jne    801647 <strncpy+0xe>
+    }
+    return ret;
+}
+  801660:	c3                   	ret
+
+0000000000801661 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801661:	48 89 f8             	mov    %rdi,%rax
+  801664:	48 85 d2             	test   %rdx,%rdx
+  801667:	74 24                	je     80168d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801669:	48 83 ea 01          	sub    $0x1,%rdx
+  80166d:	74 1b                	je     80168a <strlcpy+0x29>
+  80166f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801673:	0f b6 16             	movzbl (%rsi),%edx
+  801676:	84 d2                	test   %dl,%dl
+  801678:	74 10                	je     80168a <strlcpy+0x29>
+            *dst++ = *src++;
+  80167a:	48 83 c6 01          	add    $0x1,%rsi
+  80167e:	48 83 c0 01          	add    $0x1,%rax
+  801682:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801685:	48 39 c8             	cmp    %rcx,%rax
+  801688:	75 e9                	jne    801673 <strlcpy+0x12>
+        *dst = '\0';
+  80168a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80168d:	48 29 f8             	sub    %rdi,%rax
+}
+  801690:	c3                   	ret
+
+0000000000801691 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801691:	0f b6 07             	movzbl (%rdi),%eax
+  801694:	84 c0                	test   %al,%al
+  801696:	74 13                	je     8016ab <strcmp+0x1a>
+  801698:	38 06                	cmp    %al,(%rsi)
+  80169a:	75 0f                	jne    8016ab <strcmp+0x1a>
+  80169c:	48 83 c7 01          	add    $0x1,%rdi
+  8016a0:	48 83 c6 01          	add    $0x1,%rsi
+  8016a4:	0f b6 07             	movzbl (%rdi),%eax
+  8016a7:	84 c0                	test   %al,%al
+  8016a9:	75 ed                	jne    801698 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8016ab:	0f b6 c0             	movzbl %al,%eax
+  8016ae:	0f b6 16             	movzbl (%rsi),%edx
+  8016b1:	29 d0                	sub    %edx,%eax
+}
+  8016b3:	c3                   	ret
+
+00000000008016b4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8016b4:	48 85 d2             	test   %rdx,%rdx
+  8016b7:	74 1f                	je     8016d8 <strncmp+0x24>
+  8016b9:	0f b6 07             	movzbl (%rdi),%eax
+  8016bc:	84 c0                	test   %al,%al
+  8016be:	74 1e                	je     8016de <strncmp+0x2a>
+  8016c0:	3a 06                	cmp    (%rsi),%al
+  8016c2:	75 1a                	jne    8016de <strncmp+0x2a>
+  8016c4:	48 83 c7 01          	add    $0x1,%rdi
+  8016c8:	48 83 c6 01          	add    $0x1,%rsi
+  8016cc:	48 83 ea 01          	sub    $0x1,%rdx
+  8016d0:	75 e7                	jne    8016b9 <strncmp+0x5>
+
+    if (!n) return 0;
+  8016d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d7:	c3                   	ret
+  8016d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016dd:	c3                   	ret
+  8016de:	48 85 d2             	test   %rdx,%rdx
+  8016e1:	74 09                	je     8016ec <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8016e3:	0f b6 07             	movzbl (%rdi),%eax
+  8016e6:	0f b6 16             	movzbl (%rsi),%edx
+  8016e9:	29 d0                	sub    %edx,%eax
+  8016eb:	c3                   	ret
+    if (!n) return 0;
+  8016ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016f1:	c3                   	ret
+
+00000000008016f2 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8016f2:	0f b6 17             	movzbl (%rdi),%edx
+  8016f5:	84 d2                	test   %dl,%dl
+  8016f7:	74 18                	je     801711 <strchr+0x1f>
+        if (*str == c) {
+  8016f9:	0f be d2             	movsbl %dl,%edx
+  8016fc:	39 f2                	cmp    %esi,%edx
+  8016fe:	74 17                	je     801717 <strchr+0x25>
+    for (; *str; str++) {
+  801700:	48 83 c7 01          	add    $0x1,%rdi
+  801704:	0f b6 17             	movzbl (%rdi),%edx
+  801707:	84 d2                	test   %dl,%dl
+  801709:	75 ee                	jne    8016f9 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80170b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801710:	c3                   	ret
+  801711:	b8 00 00 00 00       	mov    $0x0,%eax
+  801716:	c3                   	ret
+  801717:	48 89 f8             	mov    %rdi,%rax
+}
+  80171a:	c3                   	ret
+
+000000000080171b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80171b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80171e:	0f b6 17             	movzbl (%rdi),%edx
+  801721:	84 d2                	test   %dl,%dl
+  801723:	74 13                	je     801738 <strfind+0x1d>
+  801725:	0f be d2             	movsbl %dl,%edx
+  801728:	39 f2                	cmp    %esi,%edx
+  80172a:	74 0b                	je     801737 <strfind+0x1c>
+  80172c:	48 83 c0 01          	add    $0x1,%rax
+  801730:	0f b6 10             	movzbl (%rax),%edx
+  801733:	84 d2                	test   %dl,%dl
+  801735:	75 ee                	jne    801725 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801737:	c3                   	ret
+  801738:	c3                   	ret
+
+0000000000801739 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801739:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80173c:	48 89 f8             	mov    %rdi,%rax
+  80173f:	48 f7 d8             	neg    %rax
+  801742:	83 e0 07             	and    $0x7,%eax
+  801745:	49 89 d1             	mov    %rdx,%r9
+  801748:	49 29 c1             	sub    %rax,%r9
+  80174b:	78 36                	js     801783 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80174d:	40 0f b6 c6          	movzbl %sil,%eax
+  801751:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801758:	01 01 01 
+  80175b:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80175f:	40 f6 c7 07          	test   $0x7,%dil
+  801763:	75 38                	jne    80179d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801765:	4c 89 c9             	mov    %r9,%rcx
+  801768:	48 c1 f9 03          	sar    $0x3,%rcx
+  80176c:	74 0c                	je     80177a <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80176e:	fc                   	cld
+  80176f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801772:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801776:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80177a:	4d 85 c9             	test   %r9,%r9
+  80177d:	75 45                	jne    8017c4 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80177f:	4c 89 c0             	mov    %r8,%rax
+  801782:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801783:	48 85 d2             	test   %rdx,%rdx
+  801786:	74 f7                	je     80177f <memset+0x46>
+  801788:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80178b:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80178e:	48 83 c0 01          	add    $0x1,%rax
+  801792:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801796:	48 39 c2             	cmp    %rax,%rdx
+  801799:	75 f3                	jne    80178e <memset+0x55>
+  80179b:	eb e2                	jmp    80177f <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80179d:	40 f6 c7 01          	test   $0x1,%dil
+  8017a1:	74 06                	je     8017a9 <memset+0x70>
+  8017a3:	88 07                	mov    %al,(%rdi)
+  8017a5:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8017a9:	40 f6 c7 02          	test   $0x2,%dil
+  8017ad:	74 07                	je     8017b6 <memset+0x7d>
+  8017af:	66 89 07             	mov    %ax,(%rdi)
+  8017b2:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8017b6:	40 f6 c7 04          	test   $0x4,%dil
+  8017ba:	74 a9                	je     801765 <memset+0x2c>
+  8017bc:	89 07                	mov    %eax,(%rdi)
+  8017be:	48 83 c7 04          	add    $0x4,%rdi
+  8017c2:	eb a1                	jmp    801765 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8017c4:	41 f6 c1 04          	test   $0x4,%r9b
+  8017c8:	74 06                	je     8017d0 <memset+0x97>
+  8017ca:	89 07                	mov    %eax,(%rdi)
+  8017cc:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8017d0:	41 f6 c1 02          	test   $0x2,%r9b
+  8017d4:	74 07                	je     8017dd <memset+0xa4>
+  8017d6:	66 89 07             	mov    %ax,(%rdi)
+  8017d9:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8017dd:	41 f6 c1 01          	test   $0x1,%r9b
+  8017e1:	74 9c                	je     80177f <memset+0x46>
+  8017e3:	88 07                	mov    %al,(%rdi)
+  8017e5:	eb 98                	jmp    80177f <memset+0x46>
+
+00000000008017e7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8017e7:	48 89 f8             	mov    %rdi,%rax
+  8017ea:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8017ed:	48 39 fe             	cmp    %rdi,%rsi
+  8017f0:	73 3b                	jae    80182d <memmove+0x46>
+  8017f2:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8017f6:	48 39 d7             	cmp    %rdx,%rdi
+  8017f9:	73 32                	jae    80182d <memmove+0x46>
+        s += n;
+        d += n;
+  8017fb:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8017ff:	48 89 d6             	mov    %rdx,%rsi
+  801802:	48 09 fe             	or     %rdi,%rsi
+  801805:	48 09 ce             	or     %rcx,%rsi
+  801808:	40 f6 c6 07          	test   $0x7,%sil
+  80180c:	75 12                	jne    801820 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80180e:	48 83 ef 08          	sub    $0x8,%rdi
+  801812:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801816:	48 c1 e9 03          	shr    $0x3,%rcx
+  80181a:	fd                   	std
+  80181b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80181e:	fc                   	cld
+  80181f:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801820:	48 83 ef 01          	sub    $0x1,%rdi
+  801824:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801828:	fd                   	std
+  801829:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80182b:	eb f1                	jmp    80181e <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80182d:	48 89 f2             	mov    %rsi,%rdx
+  801830:	48 09 c2             	or     %rax,%rdx
+  801833:	48 09 ca             	or     %rcx,%rdx
+  801836:	f6 c2 07             	test   $0x7,%dl
+  801839:	75 0c                	jne    801847 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80183b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80183f:	48 89 c7             	mov    %rax,%rdi
+  801842:	fc                   	cld
+  801843:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801846:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801847:	48 89 c7             	mov    %rax,%rdi
+  80184a:	fc                   	cld
+  80184b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80184d:	c3                   	ret
+
+000000000080184e <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80184e:	55                   	push   %rbp
+  80184f:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801852:	48 b8 e7 17 80 00 00 	movabs $0x8017e7,%rax
+  801859:	00 00 00 
+  80185c:	ff d0                	call   *%rax
+}
+  80185e:	5d                   	pop    %rbp
+  80185f:	c3                   	ret
+
+0000000000801860 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801860:	55                   	push   %rbp
+  801861:	48 89 e5             	mov    %rsp,%rbp
+  801864:	41 57                	push   %r15
+  801866:	41 56                	push   %r14
+  801868:	41 55                	push   %r13
+  80186a:	41 54                	push   %r12
+  80186c:	53                   	push   %rbx
+  80186d:	48 83 ec 08          	sub    $0x8,%rsp
+  801871:	49 89 fe             	mov    %rdi,%r14
+  801874:	49 89 f7             	mov    %rsi,%r15
+  801877:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80187a:	48 89 f7             	mov    %rsi,%rdi
+  80187d:	48 b8 af 15 80 00 00 	movabs $0x8015af,%rax
+  801884:	00 00 00 
+  801887:	ff d0                	call   *%rax
+  801889:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80188c:	48 89 de             	mov    %rbx,%rsi
+  80188f:	4c 89 f7             	mov    %r14,%rdi
+  801892:	48 b8 ca 15 80 00 00 	movabs $0x8015ca,%rax
+  801899:	00 00 00 
+  80189c:	ff d0                	call   *%rax
+  80189e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8018a1:	48 39 c3             	cmp    %rax,%rbx
+  8018a4:	74 36                	je     8018dc <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8018a6:	48 89 d8             	mov    %rbx,%rax
+  8018a9:	4c 29 e8             	sub    %r13,%rax
+  8018ac:	49 39 c4             	cmp    %rax,%r12
+  8018af:	73 31                	jae    8018e2 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8018b1:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8018b6:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8018ba:	4c 89 fe             	mov    %r15,%rsi
+  8018bd:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  8018c4:	00 00 00 
+  8018c7:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8018c9:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8018cd:	48 83 c4 08          	add    $0x8,%rsp
+  8018d1:	5b                   	pop    %rbx
+  8018d2:	41 5c                	pop    %r12
+  8018d4:	41 5d                	pop    %r13
+  8018d6:	41 5e                	pop    %r14
+  8018d8:	41 5f                	pop    %r15
+  8018da:	5d                   	pop    %rbp
+  8018db:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8018dc:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8018e0:	eb eb                	jmp    8018cd <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8018e2:	48 83 eb 01          	sub    $0x1,%rbx
+  8018e6:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8018ea:	48 89 da             	mov    %rbx,%rdx
+  8018ed:	4c 89 fe             	mov    %r15,%rsi
+  8018f0:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  8018f7:	00 00 00 
+  8018fa:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8018fc:	49 01 de             	add    %rbx,%r14
+  8018ff:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801904:	eb c3                	jmp    8018c9 <strlcat+0x69>
+
+0000000000801906 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801906:	48 85 d2             	test   %rdx,%rdx
+  801909:	74 2d                	je     801938 <memcmp+0x32>
+  80190b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801910:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801914:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801919:	44 38 c1             	cmp    %r8b,%cl
+  80191c:	75 0f                	jne    80192d <memcmp+0x27>
+    while (n-- > 0) {
+  80191e:	48 83 c0 01          	add    $0x1,%rax
+  801922:	48 39 c2             	cmp    %rax,%rdx
+  801925:	75 e9                	jne    801910 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192c:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80192d:	0f b6 c1             	movzbl %cl,%eax
+  801930:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801934:	44 29 c0             	sub    %r8d,%eax
+  801937:	c3                   	ret
+    return 0;
+  801938:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80193d:	c3                   	ret
+
+000000000080193e <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80193e:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801942:	48 39 c7             	cmp    %rax,%rdi
+  801945:	73 0f                	jae    801956 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801947:	40 38 37             	cmp    %sil,(%rdi)
+  80194a:	74 0e                	je     80195a <memfind+0x1c>
+    for (; src < end; src++) {
+  80194c:	48 83 c7 01          	add    $0x1,%rdi
+  801950:	48 39 f8             	cmp    %rdi,%rax
+  801953:	75 f2                	jne    801947 <memfind+0x9>
+  801955:	c3                   	ret
+  801956:	48 89 f8             	mov    %rdi,%rax
+  801959:	c3                   	ret
+  80195a:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80195d:	c3                   	ret
+
+000000000080195e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80195e:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801961:	0f b6 37             	movzbl (%rdi),%esi
+  801964:	40 80 fe 20          	cmp    $0x20,%sil
+  801968:	74 06                	je     801970 <strtol+0x12>
+  80196a:	40 80 fe 09          	cmp    $0x9,%sil
+  80196e:	75 13                	jne    801983 <strtol+0x25>
+  801970:	48 83 c7 01          	add    $0x1,%rdi
+  801974:	0f b6 37             	movzbl (%rdi),%esi
+  801977:	40 80 fe 20          	cmp    $0x20,%sil
+  80197b:	74 f3                	je     801970 <strtol+0x12>
+  80197d:	40 80 fe 09          	cmp    $0x9,%sil
+  801981:	74 ed                	je     801970 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801983:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801986:	83 e0 fd             	and    $0xfffffffd,%eax
+  801989:	3c 01                	cmp    $0x1,%al
+  80198b:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80198f:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801995:	75 0f                	jne    8019a6 <strtol+0x48>
+  801997:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80199a:	74 14                	je     8019b0 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80199c:	85 d2                	test   %edx,%edx
+  80199e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8019a3:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8019a6:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8019ab:	4c 63 ca             	movslq %edx,%r9
+  8019ae:	eb 36                	jmp    8019e6 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8019b0:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8019b4:	74 0f                	je     8019c5 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8019b6:	85 d2                	test   %edx,%edx
+  8019b8:	75 ec                	jne    8019a6 <strtol+0x48>
+        s++;
+  8019ba:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8019be:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8019c3:	eb e1                	jmp    8019a6 <strtol+0x48>
+        s += 2;
+  8019c5:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8019c9:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8019ce:	eb d6                	jmp    8019a6 <strtol+0x48>
+            dig -= '0';
+  8019d0:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8019d3:	44 0f b6 c1          	movzbl %cl,%r8d
+  8019d7:	41 39 d0             	cmp    %edx,%r8d
+  8019da:	7d 21                	jge    8019fd <strtol+0x9f>
+        val = val * base + dig;
+  8019dc:	49 0f af c1          	imul   %r9,%rax
+  8019e0:	0f b6 c9             	movzbl %cl,%ecx
+  8019e3:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8019e6:	48 83 c7 01          	add    $0x1,%rdi
+  8019ea:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8019ee:	80 f9 39             	cmp    $0x39,%cl
+  8019f1:	76 dd                	jbe    8019d0 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8019f3:	80 f9 7b             	cmp    $0x7b,%cl
+  8019f6:	77 05                	ja     8019fd <strtol+0x9f>
+            dig -= 'a' - 10;
+  8019f8:	83 e9 57             	sub    $0x57,%ecx
+  8019fb:	eb d6                	jmp    8019d3 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8019fd:	4d 85 d2             	test   %r10,%r10
+  801a00:	74 03                	je     801a05 <strtol+0xa7>
+  801a02:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801a05:	48 89 c2             	mov    %rax,%rdx
+  801a08:	48 f7 da             	neg    %rdx
+  801a0b:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801a0f:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801a13:	c3                   	ret
+
+0000000000801a14 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801a14:	55                   	push   %rbp
+  801a15:	48 89 e5             	mov    %rsp,%rbp
+  801a18:	53                   	push   %rbx
+  801a19:	48 89 fa             	mov    %rdi,%rdx
+  801a1c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a29:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a2e:	be 00 00 00 00       	mov    $0x0,%esi
+  801a33:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a39:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801a3b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a3f:	c9                   	leave
+  801a40:	c3                   	ret
+
+0000000000801a41 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801a41:	55                   	push   %rbp
+  801a42:	48 89 e5             	mov    %rsp,%rbp
+  801a45:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a46:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a50:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a5a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a5f:	be 00 00 00 00       	mov    $0x0,%esi
+  801a64:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a6a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a6c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a70:	c9                   	leave
+  801a71:	c3                   	ret
+
+0000000000801a72 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801a72:	55                   	push   %rbp
+  801a73:	48 89 e5             	mov    %rsp,%rbp
+  801a76:	53                   	push   %rbx
+  801a77:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801a7b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a7e:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a83:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a8d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a92:	be 00 00 00 00       	mov    $0x0,%esi
+  801a97:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a9d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a9f:	48 85 c0             	test   %rax,%rax
+  801aa2:	7f 06                	jg     801aaa <sys_env_destroy+0x38>
+}
+  801aa4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aa8:	c9                   	leave
+  801aa9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801aaa:	49 89 c0             	mov    %rax,%r8
+  801aad:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801ab2:	48 ba f0 3e 80 00 00 	movabs $0x803ef0,%rdx
+  801ab9:	00 00 00 
+  801abc:	be 26 00 00 00       	mov    $0x26,%esi
+  801ac1:	48 bf 0f 3f 80 00 00 	movabs $0x803f0f,%rdi
+  801ac8:	00 00 00 
+  801acb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad0:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  801ad7:	00 00 00 
+  801ada:	41 ff d1             	call   *%r9
+
+0000000000801add <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801add:	55                   	push   %rbp
+  801ade:	48 89 e5             	mov    %rsp,%rbp
+  801ae1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801ae2:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ae7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aec:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801af1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801af6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801afb:	be 00 00 00 00       	mov    $0x0,%esi
+  801b00:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b06:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b08:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b0c:	c9                   	leave
+  801b0d:	c3                   	ret
+
+0000000000801b0e <sys_yield>:
+
+void
+sys_yield(void) {
+  801b0e:	55                   	push   %rbp
+  801b0f:	48 89 e5             	mov    %rsp,%rbp
+  801b12:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b13:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b18:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b27:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b2c:	be 00 00 00 00       	mov    $0x0,%esi
+  801b31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b37:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b3d:	c9                   	leave
+  801b3e:	c3                   	ret
+
+0000000000801b3f <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801b3f:	55                   	push   %rbp
+  801b40:	48 89 e5             	mov    %rsp,%rbp
+  801b43:	53                   	push   %rbx
+  801b44:	48 89 fa             	mov    %rdi,%rdx
+  801b47:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b4a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b4f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801b56:	00 00 00 
+  801b59:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b5e:	be 00 00 00 00       	mov    $0x0,%esi
+  801b63:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b69:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801b6b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b6f:	c9                   	leave
+  801b70:	c3                   	ret
+
+0000000000801b71 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801b71:	55                   	push   %rbp
+  801b72:	48 89 e5             	mov    %rsp,%rbp
+  801b75:	53                   	push   %rbx
+  801b76:	49 89 f8             	mov    %rdi,%r8
+  801b79:	48 89 d3             	mov    %rdx,%rbx
+  801b7c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801b7f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b84:	4c 89 c2             	mov    %r8,%rdx
+  801b87:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b8a:	be 00 00 00 00       	mov    $0x0,%esi
+  801b8f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b95:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801b97:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b9b:	c9                   	leave
+  801b9c:	c3                   	ret
+
+0000000000801b9d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801b9d:	55                   	push   %rbp
+  801b9e:	48 89 e5             	mov    %rsp,%rbp
+  801ba1:	53                   	push   %rbx
+  801ba2:	48 83 ec 08          	sub    $0x8,%rsp
+  801ba6:	89 f8                	mov    %edi,%eax
+  801ba8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801bab:	48 63 f9             	movslq %ecx,%rdi
+  801bae:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801bb1:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bb6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bb9:	be 00 00 00 00       	mov    $0x0,%esi
+  801bbe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bc4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801bc6:	48 85 c0             	test   %rax,%rax
+  801bc9:	7f 06                	jg     801bd1 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801bcb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bcf:	c9                   	leave
+  801bd0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801bd1:	49 89 c0             	mov    %rax,%r8
+  801bd4:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801bd9:	48 ba f0 3e 80 00 00 	movabs $0x803ef0,%rdx
+  801be0:	00 00 00 
+  801be3:	be 26 00 00 00       	mov    $0x26,%esi
+  801be8:	48 bf 0f 3f 80 00 00 	movabs $0x803f0f,%rdi
+  801bef:	00 00 00 
+  801bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf7:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  801bfe:	00 00 00 
+  801c01:	41 ff d1             	call   *%r9
+
+0000000000801c04 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801c04:	55                   	push   %rbp
+  801c05:	48 89 e5             	mov    %rsp,%rbp
+  801c08:	53                   	push   %rbx
+  801c09:	48 83 ec 08          	sub    $0x8,%rsp
+  801c0d:	89 f8                	mov    %edi,%eax
+  801c0f:	49 89 f2             	mov    %rsi,%r10
+  801c12:	48 89 cf             	mov    %rcx,%rdi
+  801c15:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801c18:	48 63 da             	movslq %edx,%rbx
+  801c1b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c1e:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c23:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c26:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801c29:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c2b:	48 85 c0             	test   %rax,%rax
+  801c2e:	7f 06                	jg     801c36 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801c30:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c34:	c9                   	leave
+  801c35:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c36:	49 89 c0             	mov    %rax,%r8
+  801c39:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801c3e:	48 ba f0 3e 80 00 00 	movabs $0x803ef0,%rdx
+  801c45:	00 00 00 
+  801c48:	be 26 00 00 00       	mov    $0x26,%esi
+  801c4d:	48 bf 0f 3f 80 00 00 	movabs $0x803f0f,%rdi
+  801c54:	00 00 00 
+  801c57:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5c:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  801c63:	00 00 00 
+  801c66:	41 ff d1             	call   *%r9
+
+0000000000801c69 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801c69:	55                   	push   %rbp
+  801c6a:	48 89 e5             	mov    %rsp,%rbp
+  801c6d:	53                   	push   %rbx
+  801c6e:	48 83 ec 08          	sub    $0x8,%rsp
+  801c72:	48 89 f1             	mov    %rsi,%rcx
+  801c75:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801c78:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c7b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c80:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c85:	be 00 00 00 00       	mov    $0x0,%esi
+  801c8a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c90:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c92:	48 85 c0             	test   %rax,%rax
+  801c95:	7f 06                	jg     801c9d <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801c97:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c9b:	c9                   	leave
+  801c9c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c9d:	49 89 c0             	mov    %rax,%r8
+  801ca0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801ca5:	48 ba f0 3e 80 00 00 	movabs $0x803ef0,%rdx
+  801cac:	00 00 00 
+  801caf:	be 26 00 00 00       	mov    $0x26,%esi
+  801cb4:	48 bf 0f 3f 80 00 00 	movabs $0x803f0f,%rdi
+  801cbb:	00 00 00 
+  801cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc3:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  801cca:	00 00 00 
+  801ccd:	41 ff d1             	call   *%r9
+
+0000000000801cd0 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801cd0:	55                   	push   %rbp
+  801cd1:	48 89 e5             	mov    %rsp,%rbp
+  801cd4:	53                   	push   %rbx
+  801cd5:	48 83 ec 08          	sub    $0x8,%rsp
+  801cd9:	89 f8                	mov    %edi,%eax
+  801cdb:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801cde:	48 63 f9             	movslq %ecx,%rdi
+  801ce1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ce4:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ce9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cec:	be 00 00 00 00       	mov    $0x0,%esi
+  801cf1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cf7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801cf9:	48 85 c0             	test   %rax,%rax
+  801cfc:	7f 06                	jg     801d04 <sys_region_advise+0x34>
+}
+  801cfe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d02:	c9                   	leave
+  801d03:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801d04:	49 89 c0             	mov    %rax,%r8
+  801d07:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801d0c:	48 ba f0 3e 80 00 00 	movabs $0x803ef0,%rdx
+  801d13:	00 00 00 
+  801d16:	be 26 00 00 00       	mov    $0x26,%esi
+  801d1b:	48 bf 0f 3f 80 00 00 	movabs $0x803f0f,%rdi
+  801d22:	00 00 00 
+  801d25:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d2a:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  801d31:	00 00 00 
+  801d34:	41 ff d1             	call   *%r9
+
+0000000000801d37 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801d37:	55                   	push   %rbp
+  801d38:	48 89 e5             	mov    %rsp,%rbp
+  801d3b:	53                   	push   %rbx
+  801d3c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801d40:	48 63 ce             	movslq %esi,%rcx
+  801d43:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801d46:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d50:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d55:	be 00 00 00 00       	mov    $0x0,%esi
+  801d5a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d60:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801d62:	48 85 c0             	test   %rax,%rax
+  801d65:	7f 06                	jg     801d6d <sys_env_set_nice+0x36>
+}
+  801d67:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d6b:	c9                   	leave
+  801d6c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801d6d:	49 89 c0             	mov    %rax,%r8
+  801d70:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801d75:	48 ba f0 3e 80 00 00 	movabs $0x803ef0,%rdx
+  801d7c:	00 00 00 
+  801d7f:	be 26 00 00 00       	mov    $0x26,%esi
+  801d84:	48 bf 0f 3f 80 00 00 	movabs $0x803f0f,%rdi
+  801d8b:	00 00 00 
+  801d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d93:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  801d9a:	00 00 00 
+  801d9d:	41 ff d1             	call   *%r9
+
+0000000000801da0 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801da0:	55                   	push   %rbp
+  801da1:	48 89 e5             	mov    %rsp,%rbp
+  801da4:	53                   	push   %rbx
+  801da5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801da9:	48 63 ce             	movslq %esi,%rcx
+  801dac:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801daf:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801db4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801db9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dbe:	be 00 00 00 00       	mov    $0x0,%esi
+  801dc3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801dc9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801dcb:	48 85 c0             	test   %rax,%rax
+  801dce:	7f 06                	jg     801dd6 <sys_env_set_status+0x36>
+}
+  801dd0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dd4:	c9                   	leave
+  801dd5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801dd6:	49 89 c0             	mov    %rax,%r8
+  801dd9:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801dde:	48 ba f0 3e 80 00 00 	movabs $0x803ef0,%rdx
+  801de5:	00 00 00 
+  801de8:	be 26 00 00 00       	mov    $0x26,%esi
+  801ded:	48 bf 0f 3f 80 00 00 	movabs $0x803f0f,%rdi
+  801df4:	00 00 00 
+  801df7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dfc:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  801e03:	00 00 00 
+  801e06:	41 ff d1             	call   *%r9
+
+0000000000801e09 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801e09:	55                   	push   %rbp
+  801e0a:	48 89 e5             	mov    %rsp,%rbp
+  801e0d:	53                   	push   %rbx
+  801e0e:	48 83 ec 08          	sub    $0x8,%rsp
+  801e12:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801e15:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e18:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e22:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e27:	be 00 00 00 00       	mov    $0x0,%esi
+  801e2c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e32:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e34:	48 85 c0             	test   %rax,%rax
+  801e37:	7f 06                	jg     801e3f <sys_env_set_trapframe+0x36>
+}
+  801e39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e3d:	c9                   	leave
+  801e3e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e3f:	49 89 c0             	mov    %rax,%r8
+  801e42:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801e47:	48 ba f0 3e 80 00 00 	movabs $0x803ef0,%rdx
+  801e4e:	00 00 00 
+  801e51:	be 26 00 00 00       	mov    $0x26,%esi
+  801e56:	48 bf 0f 3f 80 00 00 	movabs $0x803f0f,%rdi
+  801e5d:	00 00 00 
+  801e60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e65:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  801e6c:	00 00 00 
+  801e6f:	41 ff d1             	call   *%r9
+
+0000000000801e72 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801e72:	55                   	push   %rbp
+  801e73:	48 89 e5             	mov    %rsp,%rbp
+  801e76:	53                   	push   %rbx
+  801e77:	48 83 ec 08          	sub    $0x8,%rsp
+  801e7b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801e7e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e81:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e8b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e90:	be 00 00 00 00       	mov    $0x0,%esi
+  801e95:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e9b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e9d:	48 85 c0             	test   %rax,%rax
+  801ea0:	7f 06                	jg     801ea8 <sys_env_set_pgfault_upcall+0x36>
+}
+  801ea2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ea6:	c9                   	leave
+  801ea7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ea8:	49 89 c0             	mov    %rax,%r8
+  801eab:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801eb0:	48 ba f0 3e 80 00 00 	movabs $0x803ef0,%rdx
+  801eb7:	00 00 00 
+  801eba:	be 26 00 00 00       	mov    $0x26,%esi
+  801ebf:	48 bf 0f 3f 80 00 00 	movabs $0x803f0f,%rdi
+  801ec6:	00 00 00 
+  801ec9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ece:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  801ed5:	00 00 00 
+  801ed8:	41 ff d1             	call   *%r9
+
+0000000000801edb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801edb:	55                   	push   %rbp
+  801edc:	48 89 e5             	mov    %rsp,%rbp
+  801edf:	53                   	push   %rbx
+  801ee0:	89 f8                	mov    %edi,%eax
+  801ee2:	49 89 f1             	mov    %rsi,%r9
+  801ee5:	48 89 d3             	mov    %rdx,%rbx
+  801ee8:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801eeb:	49 63 f0             	movslq %r8d,%rsi
+  801eee:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ef1:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ef6:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ef9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801eff:	cd 30                	int    $0x30
+}
+  801f01:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f05:	c9                   	leave
+  801f06:	c3                   	ret
+
+0000000000801f07 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801f07:	55                   	push   %rbp
+  801f08:	48 89 e5             	mov    %rsp,%rbp
+  801f0b:	53                   	push   %rbx
+  801f0c:	48 83 ec 08          	sub    $0x8,%rsp
+  801f10:	48 89 fa             	mov    %rdi,%rdx
+  801f13:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801f16:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f20:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f25:	be 00 00 00 00       	mov    $0x0,%esi
+  801f2a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f30:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f32:	48 85 c0             	test   %rax,%rax
+  801f35:	7f 06                	jg     801f3d <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801f37:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f3b:	c9                   	leave
+  801f3c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f3d:	49 89 c0             	mov    %rax,%r8
+  801f40:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801f45:	48 ba f0 3e 80 00 00 	movabs $0x803ef0,%rdx
+  801f4c:	00 00 00 
+  801f4f:	be 26 00 00 00       	mov    $0x26,%esi
+  801f54:	48 bf 0f 3f 80 00 00 	movabs $0x803f0f,%rdi
+  801f5b:	00 00 00 
+  801f5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f63:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  801f6a:	00 00 00 
+  801f6d:	41 ff d1             	call   *%r9
+
+0000000000801f70 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801f70:	55                   	push   %rbp
+  801f71:	48 89 e5             	mov    %rsp,%rbp
+  801f74:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f75:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f89:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f8e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f93:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f99:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f9b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f9f:	c9                   	leave
+  801fa0:	c3                   	ret
+
+0000000000801fa1 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  801fa1:	55                   	push   %rbp
+  801fa2:	48 89 e5             	mov    %rsp,%rbp
+  801fa5:	53                   	push   %rbx
+  801fa6:	48 83 ec 08          	sub    $0x8,%rsp
+  801faa:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801fad:	48 63 ce             	movslq %esi,%rcx
+  801fb0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801fb3:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801fb8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fbd:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801fc8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801fca:	48 85 c0             	test   %rax,%rax
+  801fcd:	7f 06                	jg     801fd5 <sys_sigqueue+0x34>
+}
+  801fcf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fd3:	c9                   	leave
+  801fd4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801fd5:	49 89 c0             	mov    %rax,%r8
+  801fd8:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801fdd:	48 ba f0 3e 80 00 00 	movabs $0x803ef0,%rdx
+  801fe4:	00 00 00 
+  801fe7:	be 26 00 00 00       	mov    $0x26,%esi
+  801fec:	48 bf 0f 3f 80 00 00 	movabs $0x803f0f,%rdi
+  801ff3:	00 00 00 
+  801ff6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ffb:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  802002:	00 00 00 
+  802005:	41 ff d1             	call   *%r9
+
+0000000000802008 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  802008:	55                   	push   %rbp
+  802009:	48 89 e5             	mov    %rsp,%rbp
+  80200c:	53                   	push   %rbx
+  80200d:	48 83 ec 08          	sub    $0x8,%rsp
+  802011:	48 89 fa             	mov    %rdi,%rdx
+  802014:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802017:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80201c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802021:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802026:	be 00 00 00 00       	mov    $0x0,%esi
+  80202b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802031:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802033:	48 85 c0             	test   %rax,%rax
+  802036:	7f 06                	jg     80203e <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  802038:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80203c:	c9                   	leave
+  80203d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80203e:	49 89 c0             	mov    %rax,%r8
+  802041:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802046:	48 ba f0 3e 80 00 00 	movabs $0x803ef0,%rdx
+  80204d:	00 00 00 
+  802050:	be 26 00 00 00       	mov    $0x26,%esi
+  802055:	48 bf 0f 3f 80 00 00 	movabs $0x803f0f,%rdi
+  80205c:	00 00 00 
+  80205f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802064:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  80206b:	00 00 00 
+  80206e:	41 ff d1             	call   *%r9
+
+0000000000802071 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  802071:	55                   	push   %rbp
+  802072:	48 89 e5             	mov    %rsp,%rbp
+  802075:	53                   	push   %rbx
+  802076:	48 83 ec 08          	sub    $0x8,%rsp
+  80207a:	48 89 f1             	mov    %rsi,%rcx
+  80207d:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  802080:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802083:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802088:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80208d:	be 00 00 00 00       	mov    $0x0,%esi
+  802092:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802098:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80209a:	48 85 c0             	test   %rax,%rax
+  80209d:	7f 06                	jg     8020a5 <sys_sigaction+0x34>
+}
+  80209f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020a3:	c9                   	leave
+  8020a4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8020a5:	49 89 c0             	mov    %rax,%r8
+  8020a8:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8020ad:	48 ba f0 3e 80 00 00 	movabs $0x803ef0,%rdx
+  8020b4:	00 00 00 
+  8020b7:	be 26 00 00 00       	mov    $0x26,%esi
+  8020bc:	48 bf 0f 3f 80 00 00 	movabs $0x803f0f,%rdi
+  8020c3:	00 00 00 
+  8020c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020cb:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  8020d2:	00 00 00 
+  8020d5:	41 ff d1             	call   *%r9
+
+00000000008020d8 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8020d8:	55                   	push   %rbp
+  8020d9:	48 89 e5             	mov    %rsp,%rbp
+  8020dc:	53                   	push   %rbx
+  8020dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8020e1:	48 89 f1             	mov    %rsi,%rcx
+  8020e4:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8020e7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8020ea:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8020ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8020f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8020f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8020ff:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802101:	48 85 c0             	test   %rax,%rax
+  802104:	7f 06                	jg     80210c <sys_sigprocmask+0x34>
+}
+  802106:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80210a:	c9                   	leave
+  80210b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80210c:	49 89 c0             	mov    %rax,%r8
+  80210f:	b9 13 00 00 00       	mov    $0x13,%ecx
+  802114:	48 ba f0 3e 80 00 00 	movabs $0x803ef0,%rdx
+  80211b:	00 00 00 
+  80211e:	be 26 00 00 00       	mov    $0x26,%esi
+  802123:	48 bf 0f 3f 80 00 00 	movabs $0x803f0f,%rdi
+  80212a:	00 00 00 
+  80212d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802132:	49 b9 78 0b 80 00 00 	movabs $0x800b78,%r9
+  802139:	00 00 00 
+  80213c:	41 ff d1             	call   *%r9
+
+000000000080213f <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80213f:	55                   	push   %rbp
+  802140:	48 89 e5             	mov    %rsp,%rbp
+  802143:	41 54                	push   %r12
+  802145:	53                   	push   %rbx
+  802146:	48 89 fb             	mov    %rdi,%rbx
+  802149:	48 89 f7             	mov    %rsi,%rdi
+  80214c:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  80214f:	48 85 f6             	test   %rsi,%rsi
+  802152:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802159:	00 00 00 
+  80215c:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802160:	be 00 10 00 00       	mov    $0x1000,%esi
+  802165:	48 b8 07 1f 80 00 00 	movabs $0x801f07,%rax
+  80216c:	00 00 00 
+  80216f:	ff d0                	call   *%rax
+    if (res < 0) {
+  802171:	85 c0                	test   %eax,%eax
+  802173:	78 45                	js     8021ba <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802175:	48 85 db             	test   %rbx,%rbx
+  802178:	74 12                	je     80218c <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  80217a:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802181:	00 00 00 
+  802184:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  80218a:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  80218c:	4d 85 e4             	test   %r12,%r12
+  80218f:	74 14                	je     8021a5 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802191:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802198:	00 00 00 
+  80219b:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8021a1:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  8021a5:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8021ac:	00 00 00 
+  8021af:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  8021b5:	5b                   	pop    %rbx
+  8021b6:	41 5c                	pop    %r12
+  8021b8:	5d                   	pop    %rbp
+  8021b9:	c3                   	ret
+        if (from_env_store)
+  8021ba:	48 85 db             	test   %rbx,%rbx
+  8021bd:	74 06                	je     8021c5 <ipc_recv+0x86>
+            *from_env_store = 0;
+  8021bf:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  8021c5:	4d 85 e4             	test   %r12,%r12
+  8021c8:	74 eb                	je     8021b5 <ipc_recv+0x76>
+            *perm_store = 0;
+  8021ca:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8021d1:	00 
+  8021d2:	eb e1                	jmp    8021b5 <ipc_recv+0x76>
+
+00000000008021d4 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8021d4:	55                   	push   %rbp
+  8021d5:	48 89 e5             	mov    %rsp,%rbp
+  8021d8:	41 57                	push   %r15
+  8021da:	41 56                	push   %r14
+  8021dc:	41 55                	push   %r13
+  8021de:	41 54                	push   %r12
+  8021e0:	53                   	push   %rbx
+  8021e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8021e5:	41 89 fd             	mov    %edi,%r13d
+  8021e8:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8021eb:	48 89 d3             	mov    %rdx,%rbx
+  8021ee:	49 89 cc             	mov    %rcx,%r12
+  8021f1:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8021f5:	48 85 d2             	test   %rdx,%rdx
+  8021f8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8021ff:	00 00 00 
+  802202:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802206:	49 be db 1e 80 00 00 	movabs $0x801edb,%r14
+  80220d:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802210:	49 bf 0e 1b 80 00 00 	movabs $0x801b0e,%r15
+  802217:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80221a:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80221d:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802221:	4c 89 e1             	mov    %r12,%rcx
+  802224:	48 89 da             	mov    %rbx,%rdx
+  802227:	44 89 ef             	mov    %r13d,%edi
+  80222a:	41 ff d6             	call   *%r14
+        if (res == 0)
+  80222d:	85 c0                	test   %eax,%eax
+  80222f:	74 34                	je     802265 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802231:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802234:	75 05                	jne    80223b <ipc_send+0x67>
+        sys_yield();
+  802236:	41 ff d7             	call   *%r15
+    while (true) {
+  802239:	eb df                	jmp    80221a <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  80223b:	48 ba 1d 3f 80 00 00 	movabs $0x803f1d,%rdx
+  802242:	00 00 00 
+  802245:	be 3e 00 00 00       	mov    $0x3e,%esi
+  80224a:	48 bf 36 3f 80 00 00 	movabs $0x803f36,%rdi
+  802251:	00 00 00 
+  802254:	b8 00 00 00 00       	mov    $0x0,%eax
+  802259:	48 b9 78 0b 80 00 00 	movabs $0x800b78,%rcx
+  802260:	00 00 00 
+  802263:	ff d1                	call   *%rcx
+    }
+}
+  802265:	48 83 c4 18          	add    $0x18,%rsp
+  802269:	5b                   	pop    %rbx
+  80226a:	41 5c                	pop    %r12
+  80226c:	41 5d                	pop    %r13
+  80226e:	41 5e                	pop    %r14
+  802270:	41 5f                	pop    %r15
+  802272:	5d                   	pop    %rbp
+  802273:	c3                   	ret
+
+0000000000802274 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802274:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802279:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802280:	00 00 00 
+  802283:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  80228a:	48 01 ca             	add    %rcx,%rdx
+  80228d:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802293:	39 fa                	cmp    %edi,%edx
+  802295:	74 12                	je     8022a9 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802297:	48 83 c0 01          	add    $0x1,%rax
+  80229b:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8022a1:	75 e0                	jne    802283 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8022a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022a8:	c3                   	ret
+            return envs[i].env_id;
+  8022a9:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8022b0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8022b7:	00 00 00 
+  8022ba:	48 01 d0             	add    %rdx,%rax
+  8022bd:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8022c3:	c3                   	ret
+
+00000000008022c4 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022c4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022cb:	ff ff ff 
+  8022ce:	48 01 f8             	add    %rdi,%rax
+  8022d1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8022d5:	c3                   	ret
+
+00000000008022d6 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022d6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022dd:	ff ff ff 
+  8022e0:	48 01 f8             	add    %rdi,%rax
+  8022e3:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8022e7:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8022ed:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8022f1:	c3                   	ret
+
+00000000008022f2 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8022f2:	55                   	push   %rbp
+  8022f3:	48 89 e5             	mov    %rsp,%rbp
+  8022f6:	41 57                	push   %r15
+  8022f8:	41 56                	push   %r14
+  8022fa:	41 55                	push   %r13
+  8022fc:	41 54                	push   %r12
+  8022fe:	53                   	push   %rbx
+  8022ff:	48 83 ec 08          	sub    $0x8,%rsp
+  802303:	49 89 ff             	mov    %rdi,%r15
+  802306:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80230b:	49 bd 70 32 80 00 00 	movabs $0x803270,%r13
+  802312:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802315:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80231b:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80231e:	48 89 df             	mov    %rbx,%rdi
+  802321:	41 ff d5             	call   *%r13
+  802324:	83 e0 04             	and    $0x4,%eax
+  802327:	74 17                	je     802340 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802329:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802330:	4c 39 f3             	cmp    %r14,%rbx
+  802333:	75 e6                	jne    80231b <fd_alloc+0x29>
+  802335:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80233b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802340:	4d 89 27             	mov    %r12,(%r15)
+}
+  802343:	48 83 c4 08          	add    $0x8,%rsp
+  802347:	5b                   	pop    %rbx
+  802348:	41 5c                	pop    %r12
+  80234a:	41 5d                	pop    %r13
+  80234c:	41 5e                	pop    %r14
+  80234e:	41 5f                	pop    %r15
+  802350:	5d                   	pop    %rbp
+  802351:	c3                   	ret
+
+0000000000802352 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802352:	83 ff 1f             	cmp    $0x1f,%edi
+  802355:	77 39                	ja     802390 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802357:	55                   	push   %rbp
+  802358:	48 89 e5             	mov    %rsp,%rbp
+  80235b:	41 54                	push   %r12
+  80235d:	53                   	push   %rbx
+  80235e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802361:	48 63 df             	movslq %edi,%rbx
+  802364:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80236b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80236f:	48 89 df             	mov    %rbx,%rdi
+  802372:	48 b8 70 32 80 00 00 	movabs $0x803270,%rax
+  802379:	00 00 00 
+  80237c:	ff d0                	call   *%rax
+  80237e:	a8 04                	test   $0x4,%al
+  802380:	74 14                	je     802396 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802382:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802386:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80238b:	5b                   	pop    %rbx
+  80238c:	41 5c                	pop    %r12
+  80238e:	5d                   	pop    %rbp
+  80238f:	c3                   	ret
+        return -E_INVAL;
+  802390:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802395:	c3                   	ret
+        return -E_INVAL;
+  802396:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80239b:	eb ee                	jmp    80238b <fd_lookup+0x39>
+
+000000000080239d <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80239d:	55                   	push   %rbp
+  80239e:	48 89 e5             	mov    %rsp,%rbp
+  8023a1:	41 54                	push   %r12
+  8023a3:	53                   	push   %rbx
+  8023a4:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8023a7:	48 b8 c0 3f 80 00 00 	movabs $0x803fc0,%rax
+  8023ae:	00 00 00 
+  8023b1:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  8023b8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8023bb:	39 3b                	cmp    %edi,(%rbx)
+  8023bd:	74 47                	je     802406 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8023bf:	48 83 c0 08          	add    $0x8,%rax
+  8023c3:	48 8b 18             	mov    (%rax),%rbx
+  8023c6:	48 85 db             	test   %rbx,%rbx
+  8023c9:	75 f0                	jne    8023bb <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8023cb:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8023d2:	00 00 00 
+  8023d5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023db:	89 fa                	mov    %edi,%edx
+  8023dd:	48 bf 40 3f 80 00 00 	movabs $0x803f40,%rdi
+  8023e4:	00 00 00 
+  8023e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ec:	48 b9 c8 0c 80 00 00 	movabs $0x800cc8,%rcx
+  8023f3:	00 00 00 
+  8023f6:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8023f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8023fd:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802401:	5b                   	pop    %rbx
+  802402:	41 5c                	pop    %r12
+  802404:	5d                   	pop    %rbp
+  802405:	c3                   	ret
+            return 0;
+  802406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80240b:	eb f0                	jmp    8023fd <dev_lookup+0x60>
+
+000000000080240d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80240d:	55                   	push   %rbp
+  80240e:	48 89 e5             	mov    %rsp,%rbp
+  802411:	41 55                	push   %r13
+  802413:	41 54                	push   %r12
+  802415:	53                   	push   %rbx
+  802416:	48 83 ec 18          	sub    $0x18,%rsp
+  80241a:	48 89 fb             	mov    %rdi,%rbx
+  80241d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802420:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802427:	ff ff ff 
+  80242a:	48 01 df             	add    %rbx,%rdi
+  80242d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802431:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802435:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  80243c:	00 00 00 
+  80243f:	ff d0                	call   *%rax
+  802441:	41 89 c5             	mov    %eax,%r13d
+  802444:	85 c0                	test   %eax,%eax
+  802446:	78 06                	js     80244e <fd_close+0x41>
+  802448:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80244c:	74 1a                	je     802468 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80244e:	45 84 e4             	test   %r12b,%r12b
+  802451:	b8 00 00 00 00       	mov    $0x0,%eax
+  802456:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80245a:	44 89 e8             	mov    %r13d,%eax
+  80245d:	48 83 c4 18          	add    $0x18,%rsp
+  802461:	5b                   	pop    %rbx
+  802462:	41 5c                	pop    %r12
+  802464:	41 5d                	pop    %r13
+  802466:	5d                   	pop    %rbp
+  802467:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802468:	8b 3b                	mov    (%rbx),%edi
+  80246a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80246e:	48 b8 9d 23 80 00 00 	movabs $0x80239d,%rax
+  802475:	00 00 00 
+  802478:	ff d0                	call   *%rax
+  80247a:	41 89 c5             	mov    %eax,%r13d
+  80247d:	85 c0                	test   %eax,%eax
+  80247f:	78 1b                	js     80249c <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802481:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802485:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802489:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80248f:	48 85 c0             	test   %rax,%rax
+  802492:	74 08                	je     80249c <fd_close+0x8f>
+  802494:	48 89 df             	mov    %rbx,%rdi
+  802497:	ff d0                	call   *%rax
+  802499:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80249c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024a1:	48 89 de             	mov    %rbx,%rsi
+  8024a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024a9:	48 b8 69 1c 80 00 00 	movabs $0x801c69,%rax
+  8024b0:	00 00 00 
+  8024b3:	ff d0                	call   *%rax
+    return res;
+  8024b5:	eb a3                	jmp    80245a <fd_close+0x4d>
+
+00000000008024b7 <close>:
+
+int
+close(int fdnum) {
+  8024b7:	55                   	push   %rbp
+  8024b8:	48 89 e5             	mov    %rsp,%rbp
+  8024bb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8024bf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024c3:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  8024ca:	00 00 00 
+  8024cd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024cf:	85 c0                	test   %eax,%eax
+  8024d1:	78 15                	js     8024e8 <close+0x31>
+
+    return fd_close(fd, 1);
+  8024d3:	be 01 00 00 00       	mov    $0x1,%esi
+  8024d8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024dc:	48 b8 0d 24 80 00 00 	movabs $0x80240d,%rax
+  8024e3:	00 00 00 
+  8024e6:	ff d0                	call   *%rax
+}
+  8024e8:	c9                   	leave
+  8024e9:	c3                   	ret
+
+00000000008024ea <close_all>:
+
+void
+close_all(void) {
+  8024ea:	55                   	push   %rbp
+  8024eb:	48 89 e5             	mov    %rsp,%rbp
+  8024ee:	41 54                	push   %r12
+  8024f0:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8024f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024f6:	49 bc b7 24 80 00 00 	movabs $0x8024b7,%r12
+  8024fd:	00 00 00 
+  802500:	89 df                	mov    %ebx,%edi
+  802502:	41 ff d4             	call   *%r12
+  802505:	83 c3 01             	add    $0x1,%ebx
+  802508:	83 fb 20             	cmp    $0x20,%ebx
+  80250b:	75 f3                	jne    802500 <close_all+0x16>
+}
+  80250d:	5b                   	pop    %rbx
+  80250e:	41 5c                	pop    %r12
+  802510:	5d                   	pop    %rbp
+  802511:	c3                   	ret
+
+0000000000802512 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802512:	55                   	push   %rbp
+  802513:	48 89 e5             	mov    %rsp,%rbp
+  802516:	41 57                	push   %r15
+  802518:	41 56                	push   %r14
+  80251a:	41 55                	push   %r13
+  80251c:	41 54                	push   %r12
+  80251e:	53                   	push   %rbx
+  80251f:	48 83 ec 18          	sub    $0x18,%rsp
+  802523:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802526:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80252a:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  802531:	00 00 00 
+  802534:	ff d0                	call   *%rax
+  802536:	89 c3                	mov    %eax,%ebx
+  802538:	85 c0                	test   %eax,%eax
+  80253a:	0f 88 b8 00 00 00    	js     8025f8 <dup+0xe6>
+    close(newfdnum);
+  802540:	44 89 e7             	mov    %r12d,%edi
+  802543:	48 b8 b7 24 80 00 00 	movabs $0x8024b7,%rax
+  80254a:	00 00 00 
+  80254d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80254f:	4d 63 ec             	movslq %r12d,%r13
+  802552:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802559:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80255d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802561:	4c 89 ff             	mov    %r15,%rdi
+  802564:	49 be d6 22 80 00 00 	movabs $0x8022d6,%r14
+  80256b:	00 00 00 
+  80256e:	41 ff d6             	call   *%r14
+  802571:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802574:	4c 89 ef             	mov    %r13,%rdi
+  802577:	41 ff d6             	call   *%r14
+  80257a:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80257d:	48 89 df             	mov    %rbx,%rdi
+  802580:	48 b8 70 32 80 00 00 	movabs $0x803270,%rax
+  802587:	00 00 00 
+  80258a:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80258c:	a8 04                	test   $0x4,%al
+  80258e:	74 2b                	je     8025bb <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802590:	41 89 c1             	mov    %eax,%r9d
+  802593:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802599:	4c 89 f1             	mov    %r14,%rcx
+  80259c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a1:	48 89 de             	mov    %rbx,%rsi
+  8025a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025a9:	48 b8 04 1c 80 00 00 	movabs $0x801c04,%rax
+  8025b0:	00 00 00 
+  8025b3:	ff d0                	call   *%rax
+  8025b5:	89 c3                	mov    %eax,%ebx
+  8025b7:	85 c0                	test   %eax,%eax
+  8025b9:	78 4e                	js     802609 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8025bb:	4c 89 ff             	mov    %r15,%rdi
+  8025be:	48 b8 70 32 80 00 00 	movabs $0x803270,%rax
+  8025c5:	00 00 00 
+  8025c8:	ff d0                	call   *%rax
+  8025ca:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8025cd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8025d3:	4c 89 e9             	mov    %r13,%rcx
+  8025d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025db:	4c 89 fe             	mov    %r15,%rsi
+  8025de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025e3:	48 b8 04 1c 80 00 00 	movabs $0x801c04,%rax
+  8025ea:	00 00 00 
+  8025ed:	ff d0                	call   *%rax
+  8025ef:	89 c3                	mov    %eax,%ebx
+  8025f1:	85 c0                	test   %eax,%eax
+  8025f3:	78 14                	js     802609 <dup+0xf7>
+
+    return newfdnum;
+  8025f5:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8025f8:	89 d8                	mov    %ebx,%eax
+  8025fa:	48 83 c4 18          	add    $0x18,%rsp
+  8025fe:	5b                   	pop    %rbx
+  8025ff:	41 5c                	pop    %r12
+  802601:	41 5d                	pop    %r13
+  802603:	41 5e                	pop    %r14
+  802605:	41 5f                	pop    %r15
+  802607:	5d                   	pop    %rbp
+  802608:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802609:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80260e:	4c 89 ee             	mov    %r13,%rsi
+  802611:	bf 00 00 00 00       	mov    $0x0,%edi
+  802616:	49 bc 69 1c 80 00 00 	movabs $0x801c69,%r12
+  80261d:	00 00 00 
+  802620:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802623:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802628:	4c 89 f6             	mov    %r14,%rsi
+  80262b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802630:	41 ff d4             	call   *%r12
+    return res;
+  802633:	eb c3                	jmp    8025f8 <dup+0xe6>
+
+0000000000802635 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802635:	55                   	push   %rbp
+  802636:	48 89 e5             	mov    %rsp,%rbp
+  802639:	41 56                	push   %r14
+  80263b:	41 55                	push   %r13
+  80263d:	41 54                	push   %r12
+  80263f:	53                   	push   %rbx
+  802640:	48 83 ec 10          	sub    $0x10,%rsp
+  802644:	89 fb                	mov    %edi,%ebx
+  802646:	49 89 f4             	mov    %rsi,%r12
+  802649:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80264c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802650:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  802657:	00 00 00 
+  80265a:	ff d0                	call   *%rax
+  80265c:	85 c0                	test   %eax,%eax
+  80265e:	78 4c                	js     8026ac <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802660:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802664:	41 8b 3e             	mov    (%r14),%edi
+  802667:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80266b:	48 b8 9d 23 80 00 00 	movabs $0x80239d,%rax
+  802672:	00 00 00 
+  802675:	ff d0                	call   *%rax
+  802677:	85 c0                	test   %eax,%eax
+  802679:	78 35                	js     8026b0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80267b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80267f:	83 e0 03             	and    $0x3,%eax
+  802682:	83 f8 01             	cmp    $0x1,%eax
+  802685:	74 2d                	je     8026b4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802687:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80268b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80268f:	48 85 c0             	test   %rax,%rax
+  802692:	74 56                	je     8026ea <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802694:	4c 89 ea             	mov    %r13,%rdx
+  802697:	4c 89 e6             	mov    %r12,%rsi
+  80269a:	4c 89 f7             	mov    %r14,%rdi
+  80269d:	ff d0                	call   *%rax
+}
+  80269f:	48 83 c4 10          	add    $0x10,%rsp
+  8026a3:	5b                   	pop    %rbx
+  8026a4:	41 5c                	pop    %r12
+  8026a6:	41 5d                	pop    %r13
+  8026a8:	41 5e                	pop    %r14
+  8026aa:	5d                   	pop    %rbp
+  8026ab:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026ac:	48 98                	cltq
+  8026ae:	eb ef                	jmp    80269f <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026b0:	48 98                	cltq
+  8026b2:	eb eb                	jmp    80269f <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8026b4:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8026bb:	00 00 00 
+  8026be:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8026c4:	89 da                	mov    %ebx,%edx
+  8026c6:	48 bf 81 3f 80 00 00 	movabs $0x803f81,%rdi
+  8026cd:	00 00 00 
+  8026d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d5:	48 b9 c8 0c 80 00 00 	movabs $0x800cc8,%rcx
+  8026dc:	00 00 00 
+  8026df:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8026e1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8026e8:	eb b5                	jmp    80269f <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8026ea:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8026f1:	eb ac                	jmp    80269f <read+0x6a>
+
+00000000008026f3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8026f3:	55                   	push   %rbp
+  8026f4:	48 89 e5             	mov    %rsp,%rbp
+  8026f7:	41 57                	push   %r15
+  8026f9:	41 56                	push   %r14
+  8026fb:	41 55                	push   %r13
+  8026fd:	41 54                	push   %r12
+  8026ff:	53                   	push   %rbx
+  802700:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802704:	48 85 d2             	test   %rdx,%rdx
+  802707:	74 54                	je     80275d <readn+0x6a>
+  802709:	41 89 fd             	mov    %edi,%r13d
+  80270c:	49 89 f6             	mov    %rsi,%r14
+  80270f:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802712:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802717:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80271c:	49 bf 35 26 80 00 00 	movabs $0x802635,%r15
+  802723:	00 00 00 
+  802726:	4c 89 e2             	mov    %r12,%rdx
+  802729:	48 29 f2             	sub    %rsi,%rdx
+  80272c:	4c 01 f6             	add    %r14,%rsi
+  80272f:	44 89 ef             	mov    %r13d,%edi
+  802732:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802735:	85 c0                	test   %eax,%eax
+  802737:	78 20                	js     802759 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802739:	01 c3                	add    %eax,%ebx
+  80273b:	85 c0                	test   %eax,%eax
+  80273d:	74 08                	je     802747 <readn+0x54>
+  80273f:	48 63 f3             	movslq %ebx,%rsi
+  802742:	4c 39 e6             	cmp    %r12,%rsi
+  802745:	72 df                	jb     802726 <readn+0x33>
+    }
+    return res;
+  802747:	48 63 c3             	movslq %ebx,%rax
+}
+  80274a:	48 83 c4 08          	add    $0x8,%rsp
+  80274e:	5b                   	pop    %rbx
+  80274f:	41 5c                	pop    %r12
+  802751:	41 5d                	pop    %r13
+  802753:	41 5e                	pop    %r14
+  802755:	41 5f                	pop    %r15
+  802757:	5d                   	pop    %rbp
+  802758:	c3                   	ret
+        if (inc < 0) return inc;
+  802759:	48 98                	cltq
+  80275b:	eb ed                	jmp    80274a <readn+0x57>
+    int inc = 1, res = 0;
+  80275d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802762:	eb e3                	jmp    802747 <readn+0x54>
+
+0000000000802764 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802764:	55                   	push   %rbp
+  802765:	48 89 e5             	mov    %rsp,%rbp
+  802768:	41 56                	push   %r14
+  80276a:	41 55                	push   %r13
+  80276c:	41 54                	push   %r12
+  80276e:	53                   	push   %rbx
+  80276f:	48 83 ec 10          	sub    $0x10,%rsp
+  802773:	89 fb                	mov    %edi,%ebx
+  802775:	49 89 f4             	mov    %rsi,%r12
+  802778:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80277b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80277f:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  802786:	00 00 00 
+  802789:	ff d0                	call   *%rax
+  80278b:	85 c0                	test   %eax,%eax
+  80278d:	78 47                	js     8027d6 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80278f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802793:	41 8b 3e             	mov    (%r14),%edi
+  802796:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80279a:	48 b8 9d 23 80 00 00 	movabs $0x80239d,%rax
+  8027a1:	00 00 00 
+  8027a4:	ff d0                	call   *%rax
+  8027a6:	85 c0                	test   %eax,%eax
+  8027a8:	78 30                	js     8027da <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8027aa:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8027af:	74 2d                	je     8027de <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8027b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027b5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8027b9:	48 85 c0             	test   %rax,%rax
+  8027bc:	74 56                	je     802814 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8027be:	4c 89 ea             	mov    %r13,%rdx
+  8027c1:	4c 89 e6             	mov    %r12,%rsi
+  8027c4:	4c 89 f7             	mov    %r14,%rdi
+  8027c7:	ff d0                	call   *%rax
+}
+  8027c9:	48 83 c4 10          	add    $0x10,%rsp
+  8027cd:	5b                   	pop    %rbx
+  8027ce:	41 5c                	pop    %r12
+  8027d0:	41 5d                	pop    %r13
+  8027d2:	41 5e                	pop    %r14
+  8027d4:	5d                   	pop    %rbp
+  8027d5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027d6:	48 98                	cltq
+  8027d8:	eb ef                	jmp    8027c9 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027da:	48 98                	cltq
+  8027dc:	eb eb                	jmp    8027c9 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8027de:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8027e5:	00 00 00 
+  8027e8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8027ee:	89 da                	mov    %ebx,%edx
+  8027f0:	48 bf 9d 3f 80 00 00 	movabs $0x803f9d,%rdi
+  8027f7:	00 00 00 
+  8027fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ff:	48 b9 c8 0c 80 00 00 	movabs $0x800cc8,%rcx
+  802806:	00 00 00 
+  802809:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80280b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802812:	eb b5                	jmp    8027c9 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802814:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80281b:	eb ac                	jmp    8027c9 <write+0x65>
+
+000000000080281d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80281d:	55                   	push   %rbp
+  80281e:	48 89 e5             	mov    %rsp,%rbp
+  802821:	53                   	push   %rbx
+  802822:	48 83 ec 18          	sub    $0x18,%rsp
+  802826:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802828:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80282c:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  802833:	00 00 00 
+  802836:	ff d0                	call   *%rax
+  802838:	85 c0                	test   %eax,%eax
+  80283a:	78 0c                	js     802848 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80283c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802840:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802843:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802848:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80284c:	c9                   	leave
+  80284d:	c3                   	ret
+
+000000000080284e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80284e:	55                   	push   %rbp
+  80284f:	48 89 e5             	mov    %rsp,%rbp
+  802852:	41 55                	push   %r13
+  802854:	41 54                	push   %r12
+  802856:	53                   	push   %rbx
+  802857:	48 83 ec 18          	sub    $0x18,%rsp
+  80285b:	89 fb                	mov    %edi,%ebx
+  80285d:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802860:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802864:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  80286b:	00 00 00 
+  80286e:	ff d0                	call   *%rax
+  802870:	85 c0                	test   %eax,%eax
+  802872:	78 38                	js     8028ac <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802874:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802878:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80287c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802880:	48 b8 9d 23 80 00 00 	movabs $0x80239d,%rax
+  802887:	00 00 00 
+  80288a:	ff d0                	call   *%rax
+  80288c:	85 c0                	test   %eax,%eax
+  80288e:	78 1c                	js     8028ac <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802890:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802895:	74 20                	je     8028b7 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802897:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80289b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80289f:	48 85 c0             	test   %rax,%rax
+  8028a2:	74 47                	je     8028eb <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8028a4:	44 89 e6             	mov    %r12d,%esi
+  8028a7:	4c 89 ef             	mov    %r13,%rdi
+  8028aa:	ff d0                	call   *%rax
+}
+  8028ac:	48 83 c4 18          	add    $0x18,%rsp
+  8028b0:	5b                   	pop    %rbx
+  8028b1:	41 5c                	pop    %r12
+  8028b3:	41 5d                	pop    %r13
+  8028b5:	5d                   	pop    %rbp
+  8028b6:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8028b7:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8028be:	00 00 00 
+  8028c1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8028c7:	89 da                	mov    %ebx,%edx
+  8028c9:	48 bf 60 3f 80 00 00 	movabs $0x803f60,%rdi
+  8028d0:	00 00 00 
+  8028d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d8:	48 b9 c8 0c 80 00 00 	movabs $0x800cc8,%rcx
+  8028df:	00 00 00 
+  8028e2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8028e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028e9:	eb c1                	jmp    8028ac <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8028eb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8028f0:	eb ba                	jmp    8028ac <ftruncate+0x5e>
+
+00000000008028f2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8028f2:	55                   	push   %rbp
+  8028f3:	48 89 e5             	mov    %rsp,%rbp
+  8028f6:	41 54                	push   %r12
+  8028f8:	53                   	push   %rbx
+  8028f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8028fd:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802900:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802904:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  80290b:	00 00 00 
+  80290e:	ff d0                	call   *%rax
+  802910:	85 c0                	test   %eax,%eax
+  802912:	78 4e                	js     802962 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802914:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802918:	41 8b 3c 24          	mov    (%r12),%edi
+  80291c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802920:	48 b8 9d 23 80 00 00 	movabs $0x80239d,%rax
+  802927:	00 00 00 
+  80292a:	ff d0                	call   *%rax
+  80292c:	85 c0                	test   %eax,%eax
+  80292e:	78 32                	js     802962 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802930:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802934:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802939:	74 30                	je     80296b <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80293b:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80293e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802945:	00 00 00 
+    stat->st_isdir = 0;
+  802948:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80294f:	00 00 00 
+    stat->st_dev = dev;
+  802952:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802959:	48 89 de             	mov    %rbx,%rsi
+  80295c:	4c 89 e7             	mov    %r12,%rdi
+  80295f:	ff 50 28             	call   *0x28(%rax)
+}
+  802962:	48 83 c4 10          	add    $0x10,%rsp
+  802966:	5b                   	pop    %rbx
+  802967:	41 5c                	pop    %r12
+  802969:	5d                   	pop    %rbp
+  80296a:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80296b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802970:	eb f0                	jmp    802962 <fstat+0x70>
+
+0000000000802972 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802972:	55                   	push   %rbp
+  802973:	48 89 e5             	mov    %rsp,%rbp
+  802976:	41 54                	push   %r12
+  802978:	53                   	push   %rbx
+  802979:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80297c:	be 00 00 00 00       	mov    $0x0,%esi
+  802981:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  802988:	00 00 00 
+  80298b:	ff d0                	call   *%rax
+  80298d:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80298f:	85 c0                	test   %eax,%eax
+  802991:	78 25                	js     8029b8 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802993:	4c 89 e6             	mov    %r12,%rsi
+  802996:	89 c7                	mov    %eax,%edi
+  802998:	48 b8 f2 28 80 00 00 	movabs $0x8028f2,%rax
+  80299f:	00 00 00 
+  8029a2:	ff d0                	call   *%rax
+  8029a4:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8029a7:	89 df                	mov    %ebx,%edi
+  8029a9:	48 b8 b7 24 80 00 00 	movabs $0x8024b7,%rax
+  8029b0:	00 00 00 
+  8029b3:	ff d0                	call   *%rax
+
+    return res;
+  8029b5:	44 89 e3             	mov    %r12d,%ebx
+}
+  8029b8:	89 d8                	mov    %ebx,%eax
+  8029ba:	5b                   	pop    %rbx
+  8029bb:	41 5c                	pop    %r12
+  8029bd:	5d                   	pop    %rbp
+  8029be:	c3                   	ret
+
+00000000008029bf <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  8029bf:	55                   	push   %rbp
+  8029c0:	48 89 e5             	mov    %rsp,%rbp
+  8029c3:	41 54                	push   %r12
+  8029c5:	53                   	push   %rbx
+  8029c6:	48 83 ec 10          	sub    $0x10,%rsp
+  8029ca:	41 89 fc             	mov    %edi,%r12d
+  8029cd:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8029d0:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8029d7:	00 00 00 
+  8029da:	83 38 00             	cmpl   $0x0,(%rax)
+  8029dd:	74 5e                	je     802a3d <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8029df:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8029e5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029ea:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8029f1:	00 00 00 
+  8029f4:	44 89 e6             	mov    %r12d,%esi
+  8029f7:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8029fe:	00 00 00 
+  802a01:	8b 38                	mov    (%rax),%edi
+  802a03:	48 b8 d4 21 80 00 00 	movabs $0x8021d4,%rax
+  802a0a:	00 00 00 
+  802a0d:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802a0f:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802a16:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802a17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a1c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802a20:	48 89 de             	mov    %rbx,%rsi
+  802a23:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a28:	48 b8 3f 21 80 00 00 	movabs $0x80213f,%rax
+  802a2f:	00 00 00 
+  802a32:	ff d0                	call   *%rax
+}
+  802a34:	48 83 c4 10          	add    $0x10,%rsp
+  802a38:	5b                   	pop    %rbx
+  802a39:	41 5c                	pop    %r12
+  802a3b:	5d                   	pop    %rbp
+  802a3c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a3d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a42:	48 b8 74 22 80 00 00 	movabs $0x802274,%rax
+  802a49:	00 00 00 
+  802a4c:	ff d0                	call   *%rax
+  802a4e:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802a55:	00 00 
+  802a57:	eb 86                	jmp    8029df <fsipc+0x20>
+
+0000000000802a59 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802a59:	55                   	push   %rbp
+  802a5a:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802a5d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802a64:	00 00 00 
+  802a67:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802a6a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802a6c:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802a6f:	be 00 00 00 00       	mov    $0x0,%esi
+  802a74:	bf 02 00 00 00       	mov    $0x2,%edi
+  802a79:	48 b8 bf 29 80 00 00 	movabs $0x8029bf,%rax
+  802a80:	00 00 00 
+  802a83:	ff d0                	call   *%rax
+}
+  802a85:	5d                   	pop    %rbp
+  802a86:	c3                   	ret
+
+0000000000802a87 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802a87:	55                   	push   %rbp
+  802a88:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802a8b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802a8e:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802a95:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802a97:	be 00 00 00 00       	mov    $0x0,%esi
+  802a9c:	bf 06 00 00 00       	mov    $0x6,%edi
+  802aa1:	48 b8 bf 29 80 00 00 	movabs $0x8029bf,%rax
+  802aa8:	00 00 00 
+  802aab:	ff d0                	call   *%rax
+}
+  802aad:	5d                   	pop    %rbp
+  802aae:	c3                   	ret
+
+0000000000802aaf <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802aaf:	55                   	push   %rbp
+  802ab0:	48 89 e5             	mov    %rsp,%rbp
+  802ab3:	41 54                	push   %r12
+  802ab5:	53                   	push   %rbx
+  802ab6:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802ab9:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802abc:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802ac3:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802ac5:	be 00 00 00 00       	mov    $0x0,%esi
+  802aca:	bf 05 00 00 00       	mov    $0x5,%edi
+  802acf:	48 b8 bf 29 80 00 00 	movabs $0x8029bf,%rax
+  802ad6:	00 00 00 
+  802ad9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802adb:	85 c0                	test   %eax,%eax
+  802add:	78 3d                	js     802b1c <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802adf:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802ae6:	00 00 00 
+  802ae9:	4c 89 e6             	mov    %r12,%rsi
+  802aec:	48 89 df             	mov    %rbx,%rdi
+  802aef:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  802af6:	00 00 00 
+  802af9:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802afb:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802b02:	00 
+  802b03:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802b09:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802b10:	00 
+  802b11:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802b17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b1c:	5b                   	pop    %rbx
+  802b1d:	41 5c                	pop    %r12
+  802b1f:	5d                   	pop    %rbp
+  802b20:	c3                   	ret
+
+0000000000802b21 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802b21:	55                   	push   %rbp
+  802b22:	48 89 e5             	mov    %rsp,%rbp
+  802b25:	41 54                	push   %r12
+  802b27:	53                   	push   %rbx
+  802b28:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  802b2b:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802b30:	48 39 c2             	cmp    %rax,%rdx
+  802b33:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802b37:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802b3a:	48 89 c2             	mov    %rax,%rdx
+  802b3d:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802b44:	00 00 00 
+  802b47:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  802b4e:	00 00 00 
+  802b51:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802b53:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802b5a:	00 00 00 
+  802b5d:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802b62:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802b64:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  802b68:	be 00 00 00 00       	mov    $0x0,%esi
+  802b6d:	bf 04 00 00 00       	mov    $0x4,%edi
+  802b72:	48 b8 bf 29 80 00 00 	movabs $0x8029bf,%rax
+  802b79:	00 00 00 
+  802b7c:	ff d0                	call   *%rax
+  802b7e:	48 98                	cltq
+}
+  802b80:	5b                   	pop    %rbx
+  802b81:	41 5c                	pop    %r12
+  802b83:	5d                   	pop    %rbp
+  802b84:	c3                   	ret
+
+0000000000802b85 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802b85:	55                   	push   %rbp
+  802b86:	48 89 e5             	mov    %rsp,%rbp
+  802b89:	41 54                	push   %r12
+  802b8b:	53                   	push   %rbx
+  802b8c:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b8f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802b96:	00 00 00 
+  802b99:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802b9c:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  802b9e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802ba3:	48 39 ca             	cmp    %rcx,%rdx
+  802ba6:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  802baa:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  802bae:	be 00 00 00 00       	mov    $0x0,%esi
+  802bb3:	bf 03 00 00 00       	mov    $0x3,%edi
+  802bb8:	48 b8 bf 29 80 00 00 	movabs $0x8029bf,%rax
+  802bbf:	00 00 00 
+  802bc2:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802bc4:	85 c0                	test   %eax,%eax
+  802bc6:	78 27                	js     802bef <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802bc8:	48 63 d8             	movslq %eax,%rbx
+  802bcb:	48 89 da             	mov    %rbx,%rdx
+  802bce:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  802bd5:	00 00 00 
+  802bd8:	4c 89 e7             	mov    %r12,%rdi
+  802bdb:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  802be2:	00 00 00 
+  802be5:	ff d0                	call   *%rax
+    return bytes_read;
+  802be7:	48 89 d8             	mov    %rbx,%rax
+}
+  802bea:	5b                   	pop    %rbx
+  802beb:	41 5c                	pop    %r12
+  802bed:	5d                   	pop    %rbp
+  802bee:	c3                   	ret
+        return bytes_read;
+  802bef:	48 98                	cltq
+  802bf1:	eb f7                	jmp    802bea <devfile_read+0x65>
+
+0000000000802bf3 <open>:
+open(const char *path, int mode) {
+  802bf3:	55                   	push   %rbp
+  802bf4:	48 89 e5             	mov    %rsp,%rbp
+  802bf7:	41 55                	push   %r13
+  802bf9:	41 54                	push   %r12
+  802bfb:	53                   	push   %rbx
+  802bfc:	48 83 ec 18          	sub    $0x18,%rsp
+  802c00:	49 89 fc             	mov    %rdi,%r12
+  802c03:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802c06:	48 b8 af 15 80 00 00 	movabs $0x8015af,%rax
+  802c0d:	00 00 00 
+  802c10:	ff d0                	call   *%rax
+  802c12:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802c18:	0f 87 8a 00 00 00    	ja     802ca8 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802c1e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802c22:	48 b8 f2 22 80 00 00 	movabs $0x8022f2,%rax
+  802c29:	00 00 00 
+  802c2c:	ff d0                	call   *%rax
+  802c2e:	89 c3                	mov    %eax,%ebx
+  802c30:	85 c0                	test   %eax,%eax
+  802c32:	78 50                	js     802c84 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802c34:	4c 89 e6             	mov    %r12,%rsi
+  802c37:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802c3e:	00 00 00 
+  802c41:	48 89 df             	mov    %rbx,%rdi
+  802c44:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  802c4b:	00 00 00 
+  802c4e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802c50:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802c57:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802c5b:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c60:	48 b8 bf 29 80 00 00 	movabs $0x8029bf,%rax
+  802c67:	00 00 00 
+  802c6a:	ff d0                	call   *%rax
+  802c6c:	89 c3                	mov    %eax,%ebx
+  802c6e:	85 c0                	test   %eax,%eax
+  802c70:	78 1f                	js     802c91 <open+0x9e>
+    return fd2num(fd);
+  802c72:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c76:	48 b8 c4 22 80 00 00 	movabs $0x8022c4,%rax
+  802c7d:	00 00 00 
+  802c80:	ff d0                	call   *%rax
+  802c82:	89 c3                	mov    %eax,%ebx
+}
+  802c84:	89 d8                	mov    %ebx,%eax
+  802c86:	48 83 c4 18          	add    $0x18,%rsp
+  802c8a:	5b                   	pop    %rbx
+  802c8b:	41 5c                	pop    %r12
+  802c8d:	41 5d                	pop    %r13
+  802c8f:	5d                   	pop    %rbp
+  802c90:	c3                   	ret
+        fd_close(fd, 0);
+  802c91:	be 00 00 00 00       	mov    $0x0,%esi
+  802c96:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c9a:	48 b8 0d 24 80 00 00 	movabs $0x80240d,%rax
+  802ca1:	00 00 00 
+  802ca4:	ff d0                	call   *%rax
+        return res;
+  802ca6:	eb dc                	jmp    802c84 <open+0x91>
+        return -E_BAD_PATH;
+  802ca8:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802cad:	eb d5                	jmp    802c84 <open+0x91>
+
+0000000000802caf <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802caf:	55                   	push   %rbp
+  802cb0:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802cb3:	be 00 00 00 00       	mov    $0x0,%esi
+  802cb8:	bf 08 00 00 00       	mov    $0x8,%edi
+  802cbd:	48 b8 bf 29 80 00 00 	movabs $0x8029bf,%rax
+  802cc4:	00 00 00 
+  802cc7:	ff d0                	call   *%rax
+}
+  802cc9:	5d                   	pop    %rbp
+  802cca:	c3                   	ret
+
+0000000000802ccb <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802ccb:	55                   	push   %rbp
+  802ccc:	48 89 e5             	mov    %rsp,%rbp
+  802ccf:	41 54                	push   %r12
+  802cd1:	53                   	push   %rbx
+  802cd2:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802cd5:	48 b8 d6 22 80 00 00 	movabs $0x8022d6,%rax
+  802cdc:	00 00 00 
+  802cdf:	ff d0                	call   *%rax
+  802ce1:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802ce4:	48 be e0 3f 80 00 00 	movabs $0x803fe0,%rsi
+  802ceb:	00 00 00 
+  802cee:	48 89 df             	mov    %rbx,%rdi
+  802cf1:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  802cf8:	00 00 00 
+  802cfb:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802cfd:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802d02:	41 2b 04 24          	sub    (%r12),%eax
+  802d06:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802d0c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802d13:	00 00 00 
+    stat->st_dev = &devpipe;
+  802d16:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  802d1d:	00 00 00 
+  802d20:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802d27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2c:	5b                   	pop    %rbx
+  802d2d:	41 5c                	pop    %r12
+  802d2f:	5d                   	pop    %rbp
+  802d30:	c3                   	ret
+
+0000000000802d31 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802d31:	55                   	push   %rbp
+  802d32:	48 89 e5             	mov    %rsp,%rbp
+  802d35:	41 54                	push   %r12
+  802d37:	53                   	push   %rbx
+  802d38:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802d3b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d40:	48 89 fe             	mov    %rdi,%rsi
+  802d43:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d48:	49 bc 69 1c 80 00 00 	movabs $0x801c69,%r12
+  802d4f:	00 00 00 
+  802d52:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802d55:	48 89 df             	mov    %rbx,%rdi
+  802d58:	48 b8 d6 22 80 00 00 	movabs $0x8022d6,%rax
+  802d5f:	00 00 00 
+  802d62:	ff d0                	call   *%rax
+  802d64:	48 89 c6             	mov    %rax,%rsi
+  802d67:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d71:	41 ff d4             	call   *%r12
+}
+  802d74:	5b                   	pop    %rbx
+  802d75:	41 5c                	pop    %r12
+  802d77:	5d                   	pop    %rbp
+  802d78:	c3                   	ret
+
+0000000000802d79 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d79:	55                   	push   %rbp
+  802d7a:	48 89 e5             	mov    %rsp,%rbp
+  802d7d:	41 57                	push   %r15
+  802d7f:	41 56                	push   %r14
+  802d81:	41 55                	push   %r13
+  802d83:	41 54                	push   %r12
+  802d85:	53                   	push   %rbx
+  802d86:	48 83 ec 18          	sub    $0x18,%rsp
+  802d8a:	49 89 fc             	mov    %rdi,%r12
+  802d8d:	49 89 f5             	mov    %rsi,%r13
+  802d90:	49 89 d7             	mov    %rdx,%r15
+  802d93:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d97:	48 b8 d6 22 80 00 00 	movabs $0x8022d6,%rax
+  802d9e:	00 00 00 
+  802da1:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802da3:	4d 85 ff             	test   %r15,%r15
+  802da6:	0f 84 af 00 00 00    	je     802e5b <devpipe_write+0xe2>
+  802dac:	48 89 c3             	mov    %rax,%rbx
+  802daf:	4c 89 f8             	mov    %r15,%rax
+  802db2:	4d 89 ef             	mov    %r13,%r15
+  802db5:	4c 01 e8             	add    %r13,%rax
+  802db8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802dbc:	49 bd 71 1b 80 00 00 	movabs $0x801b71,%r13
+  802dc3:	00 00 00 
+            sys_yield();
+  802dc6:	49 be 0e 1b 80 00 00 	movabs $0x801b0e,%r14
+  802dcd:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802dd0:	8b 73 04             	mov    0x4(%rbx),%esi
+  802dd3:	48 63 ce             	movslq %esi,%rcx
+  802dd6:	48 63 03             	movslq (%rbx),%rax
+  802dd9:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802ddf:	48 39 c1             	cmp    %rax,%rcx
+  802de2:	72 2e                	jb     802e12 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802de4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802de9:	48 89 da             	mov    %rbx,%rdx
+  802dec:	be 00 10 00 00       	mov    $0x1000,%esi
+  802df1:	4c 89 e7             	mov    %r12,%rdi
+  802df4:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802df7:	85 c0                	test   %eax,%eax
+  802df9:	74 66                	je     802e61 <devpipe_write+0xe8>
+            sys_yield();
+  802dfb:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802dfe:	8b 73 04             	mov    0x4(%rbx),%esi
+  802e01:	48 63 ce             	movslq %esi,%rcx
+  802e04:	48 63 03             	movslq (%rbx),%rax
+  802e07:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802e0d:	48 39 c1             	cmp    %rax,%rcx
+  802e10:	73 d2                	jae    802de4 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802e12:	41 0f b6 3f          	movzbl (%r15),%edi
+  802e16:	48 89 ca             	mov    %rcx,%rdx
+  802e19:	48 c1 ea 03          	shr    $0x3,%rdx
+  802e1d:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802e24:	08 10 20 
+  802e27:	48 f7 e2             	mul    %rdx
+  802e2a:	48 c1 ea 06          	shr    $0x6,%rdx
+  802e2e:	48 89 d0             	mov    %rdx,%rax
+  802e31:	48 c1 e0 09          	shl    $0x9,%rax
+  802e35:	48 29 d0             	sub    %rdx,%rax
+  802e38:	48 c1 e0 03          	shl    $0x3,%rax
+  802e3c:	48 29 c1             	sub    %rax,%rcx
+  802e3f:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802e44:	83 c6 01             	add    $0x1,%esi
+  802e47:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802e4a:	49 83 c7 01          	add    $0x1,%r15
+  802e4e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e52:	49 39 c7             	cmp    %rax,%r15
+  802e55:	0f 85 75 ff ff ff    	jne    802dd0 <devpipe_write+0x57>
+    return n;
+  802e5b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802e5f:	eb 05                	jmp    802e66 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802e61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e66:	48 83 c4 18          	add    $0x18,%rsp
+  802e6a:	5b                   	pop    %rbx
+  802e6b:	41 5c                	pop    %r12
+  802e6d:	41 5d                	pop    %r13
+  802e6f:	41 5e                	pop    %r14
+  802e71:	41 5f                	pop    %r15
+  802e73:	5d                   	pop    %rbp
+  802e74:	c3                   	ret
+
+0000000000802e75 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e75:	55                   	push   %rbp
+  802e76:	48 89 e5             	mov    %rsp,%rbp
+  802e79:	41 57                	push   %r15
+  802e7b:	41 56                	push   %r14
+  802e7d:	41 55                	push   %r13
+  802e7f:	41 54                	push   %r12
+  802e81:	53                   	push   %rbx
+  802e82:	48 83 ec 18          	sub    $0x18,%rsp
+  802e86:	49 89 fc             	mov    %rdi,%r12
+  802e89:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802e8d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e91:	48 b8 d6 22 80 00 00 	movabs $0x8022d6,%rax
+  802e98:	00 00 00 
+  802e9b:	ff d0                	call   *%rax
+  802e9d:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802ea0:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ea6:	49 bd 71 1b 80 00 00 	movabs $0x801b71,%r13
+  802ead:	00 00 00 
+            sys_yield();
+  802eb0:	49 be 0e 1b 80 00 00 	movabs $0x801b0e,%r14
+  802eb7:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802eba:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802ebf:	74 7d                	je     802f3e <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802ec1:	8b 03                	mov    (%rbx),%eax
+  802ec3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802ec6:	75 26                	jne    802eee <devpipe_read+0x79>
+            if (i > 0) return i;
+  802ec8:	4d 85 ff             	test   %r15,%r15
+  802ecb:	75 77                	jne    802f44 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ecd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802ed2:	48 89 da             	mov    %rbx,%rdx
+  802ed5:	be 00 10 00 00       	mov    $0x1000,%esi
+  802eda:	4c 89 e7             	mov    %r12,%rdi
+  802edd:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802ee0:	85 c0                	test   %eax,%eax
+  802ee2:	74 72                	je     802f56 <devpipe_read+0xe1>
+            sys_yield();
+  802ee4:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802ee7:	8b 03                	mov    (%rbx),%eax
+  802ee9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802eec:	74 df                	je     802ecd <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802eee:	48 63 c8             	movslq %eax,%rcx
+  802ef1:	48 89 ca             	mov    %rcx,%rdx
+  802ef4:	48 c1 ea 03          	shr    $0x3,%rdx
+  802ef8:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802eff:	08 10 20 
+  802f02:	48 89 d0             	mov    %rdx,%rax
+  802f05:	48 f7 e6             	mul    %rsi
+  802f08:	48 c1 ea 06          	shr    $0x6,%rdx
+  802f0c:	48 89 d0             	mov    %rdx,%rax
+  802f0f:	48 c1 e0 09          	shl    $0x9,%rax
+  802f13:	48 29 d0             	sub    %rdx,%rax
+  802f16:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802f1d:	00 
+  802f1e:	48 89 c8             	mov    %rcx,%rax
+  802f21:	48 29 d0             	sub    %rdx,%rax
+  802f24:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802f29:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f2d:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802f31:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802f34:	49 83 c7 01          	add    $0x1,%r15
+  802f38:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802f3c:	75 83                	jne    802ec1 <devpipe_read+0x4c>
+    return n;
+  802f3e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f42:	eb 03                	jmp    802f47 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802f44:	4c 89 f8             	mov    %r15,%rax
+}
+  802f47:	48 83 c4 18          	add    $0x18,%rsp
+  802f4b:	5b                   	pop    %rbx
+  802f4c:	41 5c                	pop    %r12
+  802f4e:	41 5d                	pop    %r13
+  802f50:	41 5e                	pop    %r14
+  802f52:	41 5f                	pop    %r15
+  802f54:	5d                   	pop    %rbp
+  802f55:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802f56:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f5b:	eb ea                	jmp    802f47 <devpipe_read+0xd2>
+
+0000000000802f5d <pipe>:
+pipe(int pfd[2]) {
+  802f5d:	55                   	push   %rbp
+  802f5e:	48 89 e5             	mov    %rsp,%rbp
+  802f61:	41 55                	push   %r13
+  802f63:	41 54                	push   %r12
+  802f65:	53                   	push   %rbx
+  802f66:	48 83 ec 18          	sub    $0x18,%rsp
+  802f6a:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802f6d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f71:	48 b8 f2 22 80 00 00 	movabs $0x8022f2,%rax
+  802f78:	00 00 00 
+  802f7b:	ff d0                	call   *%rax
+  802f7d:	89 c3                	mov    %eax,%ebx
+  802f7f:	85 c0                	test   %eax,%eax
+  802f81:	0f 88 a0 01 00 00    	js     803127 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802f87:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f8c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f91:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f95:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f9a:	48 b8 9d 1b 80 00 00 	movabs $0x801b9d,%rax
+  802fa1:	00 00 00 
+  802fa4:	ff d0                	call   *%rax
+  802fa6:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802fa8:	85 c0                	test   %eax,%eax
+  802faa:	0f 88 77 01 00 00    	js     803127 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802fb0:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802fb4:	48 b8 f2 22 80 00 00 	movabs $0x8022f2,%rax
+  802fbb:	00 00 00 
+  802fbe:	ff d0                	call   *%rax
+  802fc0:	89 c3                	mov    %eax,%ebx
+  802fc2:	85 c0                	test   %eax,%eax
+  802fc4:	0f 88 43 01 00 00    	js     80310d <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802fca:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802fcf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fd4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802fd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fdd:	48 b8 9d 1b 80 00 00 	movabs $0x801b9d,%rax
+  802fe4:	00 00 00 
+  802fe7:	ff d0                	call   *%rax
+  802fe9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802feb:	85 c0                	test   %eax,%eax
+  802fed:	0f 88 1a 01 00 00    	js     80310d <pipe+0x1b0>
+    va = fd2data(fd0);
+  802ff3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ff7:	48 b8 d6 22 80 00 00 	movabs $0x8022d6,%rax
+  802ffe:	00 00 00 
+  803001:	ff d0                	call   *%rax
+  803003:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803006:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80300b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803010:	48 89 c6             	mov    %rax,%rsi
+  803013:	bf 00 00 00 00       	mov    $0x0,%edi
+  803018:	48 b8 9d 1b 80 00 00 	movabs $0x801b9d,%rax
+  80301f:	00 00 00 
+  803022:	ff d0                	call   *%rax
+  803024:	89 c3                	mov    %eax,%ebx
+  803026:	85 c0                	test   %eax,%eax
+  803028:	0f 88 c5 00 00 00    	js     8030f3 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80302e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803032:	48 b8 d6 22 80 00 00 	movabs $0x8022d6,%rax
+  803039:	00 00 00 
+  80303c:	ff d0                	call   *%rax
+  80303e:	48 89 c1             	mov    %rax,%rcx
+  803041:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803047:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80304d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803052:	4c 89 ee             	mov    %r13,%rsi
+  803055:	bf 00 00 00 00       	mov    $0x0,%edi
+  80305a:	48 b8 04 1c 80 00 00 	movabs $0x801c04,%rax
+  803061:	00 00 00 
+  803064:	ff d0                	call   *%rax
+  803066:	89 c3                	mov    %eax,%ebx
+  803068:	85 c0                	test   %eax,%eax
+  80306a:	78 6e                	js     8030da <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80306c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803071:	4c 89 ef             	mov    %r13,%rdi
+  803074:	48 b8 3f 1b 80 00 00 	movabs $0x801b3f,%rax
+  80307b:	00 00 00 
+  80307e:	ff d0                	call   *%rax
+  803080:	83 f8 02             	cmp    $0x2,%eax
+  803083:	0f 85 ab 00 00 00    	jne    803134 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803089:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803090:	00 00 
+  803092:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803096:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803098:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80309c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8030a3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8030a7:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8030a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030ad:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8030b4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030b8:	48 bb c4 22 80 00 00 	movabs $0x8022c4,%rbx
+  8030bf:	00 00 00 
+  8030c2:	ff d3                	call   *%rbx
+  8030c4:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8030c8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8030cc:	ff d3                	call   *%rbx
+  8030ce:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8030d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030d8:	eb 4d                	jmp    803127 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8030da:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030df:	4c 89 ee             	mov    %r13,%rsi
+  8030e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030e7:	48 b8 69 1c 80 00 00 	movabs $0x801c69,%rax
+  8030ee:	00 00 00 
+  8030f1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8030f3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030f8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8030fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803101:	48 b8 69 1c 80 00 00 	movabs $0x801c69,%rax
+  803108:	00 00 00 
+  80310b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80310d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803112:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803116:	bf 00 00 00 00       	mov    $0x0,%edi
+  80311b:	48 b8 69 1c 80 00 00 	movabs $0x801c69,%rax
+  803122:	00 00 00 
+  803125:	ff d0                	call   *%rax
+}
+  803127:	89 d8                	mov    %ebx,%eax
+  803129:	48 83 c4 18          	add    $0x18,%rsp
+  80312d:	5b                   	pop    %rbx
+  80312e:	41 5c                	pop    %r12
+  803130:	41 5d                	pop    %r13
+  803132:	5d                   	pop    %rbp
+  803133:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803134:	48 b9 10 40 80 00 00 	movabs $0x804010,%rcx
+  80313b:	00 00 00 
+  80313e:	48 ba e7 3f 80 00 00 	movabs $0x803fe7,%rdx
+  803145:	00 00 00 
+  803148:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80314d:	48 bf fc 3f 80 00 00 	movabs $0x803ffc,%rdi
+  803154:	00 00 00 
+  803157:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315c:	49 b8 78 0b 80 00 00 	movabs $0x800b78,%r8
+  803163:	00 00 00 
+  803166:	41 ff d0             	call   *%r8
+
+0000000000803169 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803169:	55                   	push   %rbp
+  80316a:	48 89 e5             	mov    %rsp,%rbp
+  80316d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803171:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803175:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  80317c:	00 00 00 
+  80317f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803181:	85 c0                	test   %eax,%eax
+  803183:	78 35                	js     8031ba <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803185:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803189:	48 b8 d6 22 80 00 00 	movabs $0x8022d6,%rax
+  803190:	00 00 00 
+  803193:	ff d0                	call   *%rax
+  803195:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803198:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80319d:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031a2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8031a6:	48 b8 71 1b 80 00 00 	movabs $0x801b71,%rax
+  8031ad:	00 00 00 
+  8031b0:	ff d0                	call   *%rax
+  8031b2:	85 c0                	test   %eax,%eax
+  8031b4:	0f 94 c0             	sete   %al
+  8031b7:	0f b6 c0             	movzbl %al,%eax
+}
+  8031ba:	c9                   	leave
+  8031bb:	c3                   	ret
+
+00000000008031bc <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8031bc:	48 89 f8             	mov    %rdi,%rax
+  8031bf:	48 c1 e8 27          	shr    $0x27,%rax
+  8031c3:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8031ca:	01 00 00 
+  8031cd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031d1:	f6 c2 01             	test   $0x1,%dl
+  8031d4:	74 6d                	je     803243 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8031d6:	48 89 f8             	mov    %rdi,%rax
+  8031d9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8031dd:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8031e4:	01 00 00 
+  8031e7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031eb:	f6 c2 01             	test   $0x1,%dl
+  8031ee:	74 62                	je     803252 <get_uvpt_entry+0x96>
+  8031f0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8031f7:	01 00 00 
+  8031fa:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031fe:	f6 c2 80             	test   $0x80,%dl
+  803201:	75 4f                	jne    803252 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803203:	48 89 f8             	mov    %rdi,%rax
+  803206:	48 c1 e8 15          	shr    $0x15,%rax
+  80320a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803211:	01 00 00 
+  803214:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803218:	f6 c2 01             	test   $0x1,%dl
+  80321b:	74 44                	je     803261 <get_uvpt_entry+0xa5>
+  80321d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803224:	01 00 00 
+  803227:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80322b:	f6 c2 80             	test   $0x80,%dl
+  80322e:	75 31                	jne    803261 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803230:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803234:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80323b:	01 00 00 
+  80323e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803242:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803243:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80324a:	01 00 00 
+  80324d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803251:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803252:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803259:	01 00 00 
+  80325c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803260:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803261:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803268:	01 00 00 
+  80326b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80326f:	c3                   	ret
+
+0000000000803270 <get_prot>:
+
+int
+get_prot(void *va) {
+  803270:	55                   	push   %rbp
+  803271:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803274:	48 b8 bc 31 80 00 00 	movabs $0x8031bc,%rax
+  80327b:	00 00 00 
+  80327e:	ff d0                	call   *%rax
+  803280:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803283:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803288:	89 c1                	mov    %eax,%ecx
+  80328a:	83 c9 04             	or     $0x4,%ecx
+  80328d:	f6 c2 01             	test   $0x1,%dl
+  803290:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803293:	89 c1                	mov    %eax,%ecx
+  803295:	83 c9 02             	or     $0x2,%ecx
+  803298:	f6 c2 02             	test   $0x2,%dl
+  80329b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80329e:	89 c1                	mov    %eax,%ecx
+  8032a0:	83 c9 01             	or     $0x1,%ecx
+  8032a3:	48 85 d2             	test   %rdx,%rdx
+  8032a6:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8032a9:	89 c1                	mov    %eax,%ecx
+  8032ab:	83 c9 40             	or     $0x40,%ecx
+  8032ae:	f6 c6 04             	test   $0x4,%dh
+  8032b1:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8032b4:	5d                   	pop    %rbp
+  8032b5:	c3                   	ret
+
+00000000008032b6 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8032b6:	55                   	push   %rbp
+  8032b7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8032ba:	48 b8 bc 31 80 00 00 	movabs $0x8031bc,%rax
+  8032c1:	00 00 00 
+  8032c4:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8032c6:	48 c1 e8 06          	shr    $0x6,%rax
+  8032ca:	83 e0 01             	and    $0x1,%eax
+}
+  8032cd:	5d                   	pop    %rbp
+  8032ce:	c3                   	ret
+
+00000000008032cf <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8032cf:	55                   	push   %rbp
+  8032d0:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8032d3:	48 b8 bc 31 80 00 00 	movabs $0x8031bc,%rax
+  8032da:	00 00 00 
+  8032dd:	ff d0                	call   *%rax
+  8032df:	83 e0 01             	and    $0x1,%eax
+}
+  8032e2:	5d                   	pop    %rbp
+  8032e3:	c3                   	ret
+
+00000000008032e4 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8032e4:	55                   	push   %rbp
+  8032e5:	48 89 e5             	mov    %rsp,%rbp
+  8032e8:	41 57                	push   %r15
+  8032ea:	41 56                	push   %r14
+  8032ec:	41 55                	push   %r13
+  8032ee:	41 54                	push   %r12
+  8032f0:	53                   	push   %rbx
+  8032f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8032f5:	49 89 ff             	mov    %rdi,%r15
+  8032f8:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8032fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  803301:	49 bc cf 32 80 00 00 	movabs $0x8032cf,%r12
+  803308:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  80330b:	49 be 70 32 80 00 00 	movabs $0x803270,%r14
+  803312:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  803315:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  80331c:	00 00 00 
+  80331f:	eb 0c                	jmp    80332d <foreach_shared_region+0x49>
+  803321:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803328:	4c 39 eb             	cmp    %r13,%rbx
+  80332b:	74 38                	je     803365 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  80332d:	48 89 df             	mov    %rbx,%rdi
+  803330:	41 ff d4             	call   *%r12
+  803333:	84 c0                	test   %al,%al
+  803335:	74 ea                	je     803321 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  803337:	48 89 df             	mov    %rbx,%rdi
+  80333a:	41 ff d6             	call   *%r14
+  80333d:	a8 40                	test   $0x40,%al
+  80333f:	74 e0                	je     803321 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  803341:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803348:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80334c:	48 89 df             	mov    %rbx,%rdi
+  80334f:	41 ff d7             	call   *%r15
+        if (err)
+  803352:	85 c0                	test   %eax,%eax
+  803354:	74 cb                	je     803321 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  803356:	48 83 c4 18          	add    $0x18,%rsp
+  80335a:	5b                   	pop    %rbx
+  80335b:	41 5c                	pop    %r12
+  80335d:	41 5d                	pop    %r13
+  80335f:	41 5e                	pop    %r14
+  803361:	41 5f                	pop    %r15
+  803363:	5d                   	pop    %rbp
+  803364:	c3                   	ret
+    return 0;
+  803365:	b8 00 00 00 00       	mov    $0x0,%eax
+  80336a:	eb ea                	jmp    803356 <foreach_shared_region+0x72>
+
+000000000080336c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80336c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803371:	c3                   	ret
+
+0000000000803372 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803372:	55                   	push   %rbp
+  803373:	48 89 e5             	mov    %rsp,%rbp
+  803376:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803379:	48 be 34 40 80 00 00 	movabs $0x804034,%rsi
+  803380:	00 00 00 
+  803383:	48 b8 ed 15 80 00 00 	movabs $0x8015ed,%rax
+  80338a:	00 00 00 
+  80338d:	ff d0                	call   *%rax
+    return 0;
+}
+  80338f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803394:	5d                   	pop    %rbp
+  803395:	c3                   	ret
+
+0000000000803396 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803396:	55                   	push   %rbp
+  803397:	48 89 e5             	mov    %rsp,%rbp
+  80339a:	41 57                	push   %r15
+  80339c:	41 56                	push   %r14
+  80339e:	41 55                	push   %r13
+  8033a0:	41 54                	push   %r12
+  8033a2:	53                   	push   %rbx
+  8033a3:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8033aa:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8033b1:	48 85 d2             	test   %rdx,%rdx
+  8033b4:	74 7a                	je     803430 <devcons_write+0x9a>
+  8033b6:	49 89 d6             	mov    %rdx,%r14
+  8033b9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8033bf:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8033c4:	49 bf e7 17 80 00 00 	movabs $0x8017e7,%r15
+  8033cb:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8033ce:	4c 89 f3             	mov    %r14,%rbx
+  8033d1:	48 29 f3             	sub    %rsi,%rbx
+  8033d4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8033d9:	48 39 c3             	cmp    %rax,%rbx
+  8033dc:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8033e0:	4c 63 eb             	movslq %ebx,%r13
+  8033e3:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8033ea:	48 01 c6             	add    %rax,%rsi
+  8033ed:	4c 89 ea             	mov    %r13,%rdx
+  8033f0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8033f7:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8033fa:	4c 89 ee             	mov    %r13,%rsi
+  8033fd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803404:	48 b8 14 1a 80 00 00 	movabs $0x801a14,%rax
+  80340b:	00 00 00 
+  80340e:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803410:	41 01 dc             	add    %ebx,%r12d
+  803413:	49 63 f4             	movslq %r12d,%rsi
+  803416:	4c 39 f6             	cmp    %r14,%rsi
+  803419:	72 b3                	jb     8033ce <devcons_write+0x38>
+    return res;
+  80341b:	49 63 c4             	movslq %r12d,%rax
+}
+  80341e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803425:	5b                   	pop    %rbx
+  803426:	41 5c                	pop    %r12
+  803428:	41 5d                	pop    %r13
+  80342a:	41 5e                	pop    %r14
+  80342c:	41 5f                	pop    %r15
+  80342e:	5d                   	pop    %rbp
+  80342f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803430:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803436:	eb e3                	jmp    80341b <devcons_write+0x85>
+
+0000000000803438 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803438:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80343b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803440:	48 85 c0             	test   %rax,%rax
+  803443:	74 55                	je     80349a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803445:	55                   	push   %rbp
+  803446:	48 89 e5             	mov    %rsp,%rbp
+  803449:	41 55                	push   %r13
+  80344b:	41 54                	push   %r12
+  80344d:	53                   	push   %rbx
+  80344e:	48 83 ec 08          	sub    $0x8,%rsp
+  803452:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803455:	48 bb 41 1a 80 00 00 	movabs $0x801a41,%rbx
+  80345c:	00 00 00 
+  80345f:	49 bc 0e 1b 80 00 00 	movabs $0x801b0e,%r12
+  803466:	00 00 00 
+  803469:	eb 03                	jmp    80346e <devcons_read+0x36>
+  80346b:	41 ff d4             	call   *%r12
+  80346e:	ff d3                	call   *%rbx
+  803470:	85 c0                	test   %eax,%eax
+  803472:	74 f7                	je     80346b <devcons_read+0x33>
+    if (c < 0) return c;
+  803474:	48 63 d0             	movslq %eax,%rdx
+  803477:	78 13                	js     80348c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803479:	ba 00 00 00 00       	mov    $0x0,%edx
+  80347e:	83 f8 04             	cmp    $0x4,%eax
+  803481:	74 09                	je     80348c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803483:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803487:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80348c:	48 89 d0             	mov    %rdx,%rax
+  80348f:	48 83 c4 08          	add    $0x8,%rsp
+  803493:	5b                   	pop    %rbx
+  803494:	41 5c                	pop    %r12
+  803496:	41 5d                	pop    %r13
+  803498:	5d                   	pop    %rbp
+  803499:	c3                   	ret
+  80349a:	48 89 d0             	mov    %rdx,%rax
+  80349d:	c3                   	ret
+
+000000000080349e <cputchar>:
+cputchar(int ch) {
+  80349e:	55                   	push   %rbp
+  80349f:	48 89 e5             	mov    %rsp,%rbp
+  8034a2:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8034a6:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8034aa:	be 01 00 00 00       	mov    $0x1,%esi
+  8034af:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8034b3:	48 b8 14 1a 80 00 00 	movabs $0x801a14,%rax
+  8034ba:	00 00 00 
+  8034bd:	ff d0                	call   *%rax
+}
+  8034bf:	c9                   	leave
+  8034c0:	c3                   	ret
+
+00000000008034c1 <getchar>:
+getchar(void) {
+  8034c1:	55                   	push   %rbp
+  8034c2:	48 89 e5             	mov    %rsp,%rbp
+  8034c5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8034c9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8034ce:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8034d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034d7:	48 b8 35 26 80 00 00 	movabs $0x802635,%rax
+  8034de:	00 00 00 
+  8034e1:	ff d0                	call   *%rax
+  8034e3:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8034e5:	85 c0                	test   %eax,%eax
+  8034e7:	78 06                	js     8034ef <getchar+0x2e>
+  8034e9:	74 08                	je     8034f3 <getchar+0x32>
+  8034eb:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8034ef:	89 d0                	mov    %edx,%eax
+  8034f1:	c9                   	leave
+  8034f2:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8034f3:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8034f8:	eb f5                	jmp    8034ef <getchar+0x2e>
+
+00000000008034fa <iscons>:
+iscons(int fdnum) {
+  8034fa:	55                   	push   %rbp
+  8034fb:	48 89 e5             	mov    %rsp,%rbp
+  8034fe:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803502:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803506:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  80350d:	00 00 00 
+  803510:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803512:	85 c0                	test   %eax,%eax
+  803514:	78 18                	js     80352e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803516:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80351a:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  803521:	00 00 00 
+  803524:	8b 00                	mov    (%rax),%eax
+  803526:	39 02                	cmp    %eax,(%rdx)
+  803528:	0f 94 c0             	sete   %al
+  80352b:	0f b6 c0             	movzbl %al,%eax
+}
+  80352e:	c9                   	leave
+  80352f:	c3                   	ret
+
+0000000000803530 <opencons>:
+opencons(void) {
+  803530:	55                   	push   %rbp
+  803531:	48 89 e5             	mov    %rsp,%rbp
+  803534:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803538:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80353c:	48 b8 f2 22 80 00 00 	movabs $0x8022f2,%rax
+  803543:	00 00 00 
+  803546:	ff d0                	call   *%rax
+  803548:	85 c0                	test   %eax,%eax
+  80354a:	78 49                	js     803595 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80354c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803551:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803556:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80355a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80355f:	48 b8 9d 1b 80 00 00 	movabs $0x801b9d,%rax
+  803566:	00 00 00 
+  803569:	ff d0                	call   *%rax
+  80356b:	85 c0                	test   %eax,%eax
+  80356d:	78 26                	js     803595 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80356f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803573:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  80357a:	00 00 
+  80357c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80357e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803582:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803589:	48 b8 c4 22 80 00 00 	movabs $0x8022c4,%rax
+  803590:	00 00 00 
+  803593:	ff d0                	call   *%rax
+}
+  803595:	c9                   	leave
+  803596:	c3                   	ret
+  803597:	90                   	nop
+
+0000000000803598 <__rodata_start>:
+  803598:	2f                   	(bad)
+  803599:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80359a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80359b:	74 2d                	je     8035ca <__rodata_start+0x32>
+  80359d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80359f:	75 6e                	jne    80360f <__rodata_start+0x77>
+  8035a1:	64 00 73 65          	add    %dh,%fs:0x65(%rbx)
+  8035a5:	72 76                	jb     80361d <__rodata_start+0x85>
+  8035a7:	65 5f                	gs pop %rdi
+  8035a9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035aa:	70 65                	jo     803611 <__rodata_start+0x79>
+  8035ac:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035ad:	20 2f                	and    %ch,(%rdi)
+  8035af:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035b0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035b1:	74 2d                	je     8035e0 <__rodata_start+0x48>
+  8035b3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8035b5:	75 6e                	jne    803625 <__rodata_start+0x8d>
+  8035b7:	64 3a 20             	cmp    %fs:(%rax),%ah
+  8035ba:	25 6c 64 00 75       	and    $0x7500646c,%eax
+  8035bf:	73 65                	jae    803626 <__rodata_start+0x8e>
+  8035c1:	72 2f                	jb     8035f2 <__rodata_start+0x5a>
+  8035c3:	74 65                	je     80362a <__rodata_start+0x92>
+  8035c5:	73 74                	jae    80363b <__rodata_start+0xa3>
+  8035c7:	66 69 6c 65 2e 63 00 	imul   $0x63,0x2e(%rbp,%riz,2),%bp
+  8035ce:	2f                   	(bad)
+  8035cf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035d0:	65 77 6d             	gs ja  803640 <__rodata_start+0xa8>
+  8035d3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035d4:	74 64                	je     80363a <__rodata_start+0xa2>
+  8035d6:	00 73 65             	add    %dh,0x65(%rbx)
+  8035d9:	72 76                	jb     803651 <__rodata_start+0xb9>
+  8035db:	65 5f                	gs pop %rdi
+  8035dd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035de:	70 65                	jo     803645 <__rodata_start+0xad>
+  8035e0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035e1:	20 2f                	and    %ch,(%rdi)
+  8035e3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035e4:	65 77 6d             	gs ja  803654 <__rodata_start+0xbc>
+  8035e7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035e8:	74 64                	je     80364e <__rodata_start+0xb6>
+  8035ea:	3a 20                	cmp    (%rax),%ah
+  8035ec:	25 6c 64 00 73       	and    $0x7300646c,%eax
+  8035f1:	65 72 76             	gs jb  80366a <__rodata_start+0xd2>
+  8035f4:	65 5f                	gs pop %rdi
+  8035f6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035f7:	70 65                	jo     80365e <__rodata_start+0xc6>
+  8035f9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035fa:	20 69 73             	and    %ch,0x73(%rcx)
+  8035fd:	20 67 6f             	and    %ah,0x6f(%rdi)
+  803600:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803601:	64 0a 00             	or     %fs:(%rax),%al
+  803604:	66 69 6c 65 5f 73 74 	imul   $0x7473,0x5f(%rbp,%riz,2),%bp
+  80360b:	61                   	(bad)
+  80360c:	74 3a                	je     803648 <__rodata_start+0xb0>
+  80360e:	20 25 6c 64 00 66    	and    %ah,0x6600646c(%rip)        # 66809a80 <__bss_end+0x66000a80>
+  803614:	69 6c 65 5f 73 74 61 	imul   $0x74617473,0x5f(%rbp,%riz,2),%ebp
+  80361b:	74 
+  80361c:	20 69 73             	and    %ch,0x73(%rcx)
+  80361f:	20 67 6f             	and    %ah,0x6f(%rdi)
+  803622:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803623:	64 0a 00             	or     %fs:(%rax),%al
+  803626:	66 69 6c 65 5f 72 65 	imul   $0x6572,0x5f(%rbp,%riz,2),%bp
+  80362d:	61                   	(bad)
+  80362e:	64 3a 20             	cmp    %fs:(%rax),%ah
+  803631:	25 6c 64 00 66       	and    $0x6600646c,%eax
+  803636:	69 6c 65 5f 72 65 61 	imul   $0x64616572,0x5f(%rbp,%riz,2),%ebp
+  80363d:	64 
+  80363e:	20 72 65             	and    %dh,0x65(%rdx)
+  803641:	74 75                	je     8036b8 <__rodata_start+0x120>
+  803643:	72 6e                	jb     8036b3 <__rodata_start+0x11b>
+  803645:	65 64 20 77 72       	gs and %dh,%fs:0x72(%rdi)
+  80364a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80364b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80364c:	67 20 64 61 74       	and    %ah,0x74(%ecx,%eiz,2)
+  803651:	61                   	(bad)
+  803652:	00 66 69             	add    %ah,0x69(%rsi)
+  803655:	6c                   	insb   (%dx),%es:(%rdi)
+  803656:	65 5f                	gs pop %rdi
+  803658:	72 65                	jb     8036bf <__rodata_start+0x127>
+  80365a:	61                   	(bad)
+  80365b:	64 20 69 73          	and    %ch,%fs:0x73(%rcx)
+  80365f:	20 67 6f             	and    %ah,0x6f(%rdi)
+  803662:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803663:	64 0a 00             	or     %fs:(%rax),%al
+  803666:	66 69 6c 65 5f 63 6c 	imul   $0x6c63,0x5f(%rbp,%riz,2),%bp
+  80366d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80366e:	73 65                	jae    8036d5 <__rodata_start+0x13d>
+  803670:	3a 20                	cmp    (%rax),%ah
+  803672:	25 6c 64 00 66       	and    $0x6600646c,%eax
+  803677:	69 6c 65 5f 63 6c 6f 	imul   $0x736f6c63,0x5f(%rbp,%riz,2),%ebp
+  80367e:	73 
+  80367f:	65 20 69 73          	and    %ch,%gs:0x73(%rcx)
+  803683:	20 67 6f             	and    %ah,0x6f(%rdi)
+  803686:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803687:	64 0a 00             	or     %fs:(%rax),%al
+  80368a:	73 74                	jae    803700 <__rodata_start+0x168>
+  80368c:	61                   	(bad)
+  80368d:	6c                   	insb   (%dx),%es:(%rdi)
+  80368e:	65 20 66 69          	and    %ah,%gs:0x69(%rsi)
+  803692:	6c                   	insb   (%dx),%es:(%rdi)
+  803693:	65 69 64 20 69 73 20 	imul   $0x6f672073,%gs:0x69(%rax,%riz,1),%esp
+  80369a:	67 6f 
+  80369c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80369d:	64 0a 00             	or     %fs:(%rax),%al
+  8036a0:	2f                   	(bad)
+  8036a1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036a2:	65 77 2d             	gs ja  8036d2 <__rodata_start+0x13a>
+  8036a5:	66 69 6c 65 00 73 65 	imul   $0x6573,0x0(%rbp,%riz,2),%bp
+  8036ac:	72 76                	jb     803724 <__rodata_start+0x18c>
+  8036ae:	65 5f                	gs pop %rdi
+  8036b0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036b1:	70 65                	jo     803718 <__rodata_start+0x180>
+  8036b3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036b4:	20 2f                	and    %ch,(%rdi)
+  8036b6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036b7:	65 77 2d             	gs ja  8036e7 <__rodata_start+0x14f>
+  8036ba:	66 69 6c 65 3a 20 25 	imul   $0x2520,0x3a(%rbp,%riz,2),%bp
+  8036c1:	6c                   	insb   (%dx),%es:(%rdi)
+  8036c2:	64 00 66 69          	add    %ah,%fs:0x69(%rsi)
+  8036c6:	6c                   	insb   (%dx),%es:(%rdi)
+  8036c7:	65 5f                	gs pop %rdi
+  8036c9:	77 72                	ja     80373d <__rodata_start+0x1a5>
+  8036cb:	69 74 65 3a 20 25 6c 	imul   $0x646c2520,0x3a(%rbp,%riz,2),%esi
+  8036d2:	64 
+  8036d3:	00 66 69             	add    %ah,0x69(%rsi)
+  8036d6:	6c                   	insb   (%dx),%es:(%rdi)
+  8036d7:	65 5f                	gs pop %rdi
+  8036d9:	77 72                	ja     80374d <__rodata_start+0x1b5>
+  8036db:	69 74 65 20 69 73 20 	imul   $0x67207369,0x20(%rbp,%riz,2),%esi
+  8036e2:	67 
+  8036e3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036e4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036e5:	64 0a 00             	or     %fs:(%rax),%al
+  8036e8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036e9:	70 65                	jo     803750 <__rodata_start+0x1b8>
+  8036eb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036ec:	20 2f                	and    %ch,(%rdi)
+  8036ee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036ef:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036f0:	74 2d                	je     80371f <__rodata_start+0x187>
+  8036f2:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8036f4:	75 6e                	jne    803764 <__rodata_start+0x1cc>
+  8036f6:	64 20 73 75          	and    %dh,%fs:0x75(%rbx)
+  8036fa:	63 63 65             	movsxd 0x65(%rbx),%esp
+  8036fd:	65 64 65 64 21 00    	gs fs gs and %eax,%fs:(%rax)
+  803703:	2f                   	(bad)
+  803704:	62                   	(bad)
+  803705:	69 67 00 63 72 65 61 	imul   $0x61657263,0x0(%rdi),%esp
+  80370c:	74 20                	je     80372e <__rodata_start+0x196>
+  80370e:	2f                   	(bad)
+  80370f:	62                   	(bad)
+  803710:	69 67 3a 20 25 6c 64 	imul   $0x646c2520,0x3a(%rdi),%esp
+  803717:	00 77 72             	add    %dh,0x72(%rdi)
+  80371a:	69 74 65 20 2f 62 69 	imul   $0x6769622f,0x20(%rbp,%riz,2),%esi
+  803721:	67 
+  803722:	40 25 6c 64 3a 20    	rex and $0x203a646c,%eax
+  803728:	25 6c 64 00 6f       	and    $0x6f00646c,%eax
+  80372d:	70 65                	jo     803794 <__rodata_start+0x1fc>
+  80372f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803730:	20 2f                	and    %ch,(%rdi)
+  803732:	62                   	(bad)
+  803733:	69 67 3a 20 25 6c 64 	imul   $0x646c2520,0x3a(%rdi),%esp
+  80373a:	00 72 65             	add    %dh,0x65(%rdx)
+  80373d:	61                   	(bad)
+  80373e:	64 20 2f             	and    %ch,%fs:(%rdi)
+  803741:	62                   	(bad)
+  803742:	69 67 40 25 6c 64 3a 	imul   $0x3a646c25,0x40(%rdi),%esp
+  803749:	20 25 6c 64 00 6c    	and    %ah,0x6c00646c(%rip)        # 6c809bbb <__bss_end+0x6c000bbb>
+  80374f:	61                   	(bad)
+  803750:	72 67                	jb     8037b9 <__rodata_start+0x221>
+  803752:	65 20 66 69          	and    %ah,%gs:0x69(%rsi)
+  803756:	6c                   	insb   (%dx),%es:(%rdi)
+  803757:	65 20 69 73          	and    %ch,%gs:0x73(%rcx)
+  80375b:	20 67 6f             	and    %ah,0x6f(%rdi)
+  80375e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80375f:	64 0a 00             	or     %fs:(%rax),%al
+  803762:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  803768:	73 65                	jae    8037cf <__rodata_start+0x237>
+  80376a:	72 76                	jb     8037e2 <__rodata_start+0x24a>
+  80376c:	65 5f                	gs pop %rdi
+  80376e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80376f:	70 65                	jo     8037d6 <__rodata_start+0x23e>
+  803771:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803772:	20 2f                	and    %ch,(%rdi)
+  803774:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803775:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803776:	74 2d                	je     8037a5 <__rodata_start+0x20d>
+  803778:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80377a:	75 6e                	jne    8037ea <__rodata_start+0x252>
+  80377c:	64 20 73 75          	and    %dh,%fs:0x75(%rbx)
+  803780:	63 63 65             	movsxd 0x65(%rbx),%esp
+  803783:	65 64 65 64 21 00    	gs fs gs and %eax,%fs:(%rax)
+  803789:	00 00                	add    %al,(%rax)
+  80378b:	00 00                	add    %al,(%rax)
+  80378d:	00 00                	add    %al,(%rax)
+  80378f:	00 73 65             	add    %dh,0x65(%rbx)
+  803792:	72 76                	jb     80380a <__rodata_start+0x272>
+  803794:	65 5f                	gs pop %rdi
+  803796:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803797:	70 65                	jo     8037fe <__rodata_start+0x266>
+  803799:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80379a:	20 64 69 64          	and    %ah,0x64(%rcx,%rbp,2)
+  80379e:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8037a1:	74 20                	je     8037c3 <__rodata_start+0x22b>
+  8037a3:	66 69 6c 6c 20 73 74 	imul   $0x7473,0x20(%rsp,%rbp,2),%bp
+  8037aa:	72 75                	jb     803821 <__rodata_start+0x289>
+  8037ac:	63 74 20 46          	movsxd 0x46(%rax,%riz,1),%esi
+  8037b0:	64 20 63 6f          	and    %ah,%fs:0x6f(%rbx)
+  8037b4:	72 72                	jb     803828 <__rodata_start+0x290>
+  8037b6:	65 63 74 6c 79       	movsxd %gs:0x79(%rsp,%rbp,2),%esi
+  8037bb:	0a 00                	or     (%rax),%al
+  8037bd:	00 00                	add    %al,(%rax)
+  8037bf:	00 66 69             	add    %ah,0x69(%rsi)
+  8037c2:	6c                   	insb   (%dx),%es:(%rdi)
+  8037c3:	65 5f                	gs pop %rdi
+  8037c5:	73 74                	jae    80383b <__rodata_start+0x2a3>
+  8037c7:	61                   	(bad)
+  8037c8:	74 20                	je     8037ea <__rodata_start+0x252>
+  8037ca:	72 65                	jb     803831 <__rodata_start+0x299>
+  8037cc:	74 75                	je     803843 <__rodata_start+0x2ab>
+  8037ce:	72 6e                	jb     80383e <__rodata_start+0x2a6>
+  8037d0:	65 64 20 73 69       	gs and %dh,%fs:0x69(%rbx)
+  8037d5:	7a 65                	jp     80383c <__rodata_start+0x2a4>
+  8037d7:	20 25 6c 64 20 77    	and    %ah,0x7720646c(%rip)        # 77a09c49 <__bss_end+0x77200c49>
+  8037dd:	61                   	(bad)
+  8037de:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037df:	74 65                	je     803846 <__rodata_start+0x2ae>
+  8037e1:	64 20 25 7a 64 0a 00 	and    %ah,%fs:0xa647a(%rip)        # 8a9c62 <__bss_end+0xa0c62>
+  8037e8:	73 65                	jae    80384f <__rodata_start+0x2b7>
+  8037ea:	72 76                	jb     803862 <__rodata_start+0x2ca>
+  8037ec:	65 5f                	gs pop %rdi
+  8037ee:	72 65                	jb     803855 <__rodata_start+0x2bd>
+  8037f0:	61                   	(bad)
+  8037f1:	64 20 64 6f 65       	and    %ah,%fs:0x65(%rdi,%rbp,2)
+  8037f6:	73 20                	jae    803818 <__rodata_start+0x280>
+  8037f8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037fa:	74 20                	je     80381c <__rodata_start+0x284>
+  8037fc:	68 61 6e 64 6c       	push   $0x6c646e61
+  803801:	65 20 73 74          	and    %dh,%gs:0x74(%rbx)
+  803805:	61                   	(bad)
+  803806:	6c                   	insb   (%dx),%es:(%rdi)
+  803807:	65 20 66 69          	and    %ah,%gs:0x69(%rsi)
+  80380b:	6c                   	insb   (%dx),%es:(%rdi)
+  80380c:	65 69 64 73 20 63 6f 	imul   $0x72726f63,%gs:0x20(%rbx,%rsi,2),%esp
+  803813:	72 72 
+  803815:	65 63 74 6c 79       	movsxd %gs:0x79(%rsp,%rbp,2),%esi
+  80381a:	3a 20                	cmp    (%rax),%ah
+  80381c:	25 6c 64 00 66       	and    $0x6600646c,%eax
+  803821:	69 6c 65 5f 72 65 61 	imul   $0x64616572,0x5f(%rbp,%riz,2),%ebp
+  803828:	64 
+  803829:	20 61 66             	and    %ah,0x66(%rcx)
+  80382c:	74 65                	je     803893 <__rodata_start+0x2fb>
+  80382e:	72 20                	jb     803850 <__rodata_start+0x2b8>
+  803830:	66 69 6c 65 5f 77 72 	imul   $0x7277,0x5f(%rbp,%riz,2),%bp
+  803837:	69 74 65 3a 20 25 6c 	imul   $0x646c2520,0x3a(%rbp,%riz,2),%esi
+  80383e:	64 
+  80383f:	00 66 69             	add    %ah,0x69(%rsi)
+  803842:	6c                   	insb   (%dx),%es:(%rdi)
+  803843:	65 5f                	gs pop %rdi
+  803845:	72 65                	jb     8038ac <__rodata_start+0x314>
+  803847:	61                   	(bad)
+  803848:	64 20 61 66          	and    %ah,%fs:0x66(%rcx)
+  80384c:	74 65                	je     8038b3 <__rodata_start+0x31b>
+  80384e:	72 20                	jb     803870 <__rodata_start+0x2d8>
+  803850:	66 69 6c 65 5f 77 72 	imul   $0x7277,0x5f(%rbp,%riz,2),%bp
+  803857:	69 74 65 20 72 65 74 	imul   $0x75746572,0x20(%rbp,%riz,2),%esi
+  80385e:	75 
+  80385f:	72 6e                	jb     8038cf <__rodata_start+0x337>
+  803861:	65 64 20 77 72       	gs and %dh,%fs:0x72(%rdi)
+  803866:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803867:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803868:	67 20 6c 65 6e       	and    %ch,0x6e(%ebp,%eiz,2)
+  80386d:	67 74 68             	addr32 je 8038d8 <__rodata_start+0x340>
+  803870:	3a 20                	cmp    (%rax),%ah
+  803872:	25 6c 64 00 00       	and    $0x646c,%eax
+  803877:	00 66 69             	add    %ah,0x69(%rsi)
+  80387a:	6c                   	insb   (%dx),%es:(%rdi)
+  80387b:	65 5f                	gs pop %rdi
+  80387d:	72 65                	jb     8038e4 <__rodata_start+0x34c>
+  80387f:	61                   	(bad)
+  803880:	64 20 61 66          	and    %ah,%fs:0x66(%rcx)
+  803884:	74 65                	je     8038eb <__rodata_start+0x353>
+  803886:	72 20                	jb     8038a8 <__rodata_start+0x310>
+  803888:	66 69 6c 65 5f 77 72 	imul   $0x7277,0x5f(%rbp,%riz,2),%bp
+  80388f:	69 74 65 20 72 65 74 	imul   $0x75746572,0x20(%rbp,%riz,2),%esi
+  803896:	75 
+  803897:	72 6e                	jb     803907 <__rodata_start+0x36f>
+  803899:	65 64 20 77 72       	gs and %dh,%fs:0x72(%rdi)
+  80389e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80389f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038a0:	67 20 64 61 74       	and    %ah,0x74(%ecx,%eiz,2)
+  8038a5:	61                   	(bad)
+  8038a6:	00 00                	add    %al,(%rax)
+  8038a8:	66 69 6c 65 5f 72 65 	imul   $0x6572,0x5f(%rbp,%riz,2),%bp
+  8038af:	61                   	(bad)
+  8038b0:	64 20 61 66          	and    %ah,%fs:0x66(%rcx)
+  8038b4:	74 65                	je     80391b <__rodata_start+0x383>
+  8038b6:	72 20                	jb     8038d8 <__rodata_start+0x340>
+  8038b8:	66 69 6c 65 5f 77 72 	imul   $0x7277,0x5f(%rbp,%riz,2),%bp
+  8038bf:	69 74 65 20 69 73 20 	imul   $0x67207369,0x20(%rbp,%riz,2),%esi
+  8038c6:	67 
+  8038c7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038c8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038c9:	64 0a 00             	or     %fs:(%rax),%al
+  8038cc:	00 00                	add    %al,(%rax)
+  8038ce:	00 00                	add    %al,(%rax)
+  8038d0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038d1:	70 65                	jo     803938 <__rodata_start+0x3a0>
+  8038d3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038d4:	20 64 69 64          	and    %ah,0x64(%rcx,%rbp,2)
+  8038d8:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8038db:	74 20                	je     8038fd <__rodata_start+0x365>
+  8038dd:	66 69 6c 6c 20 73 74 	imul   $0x7473,0x20(%rsp,%rbp,2),%bp
+  8038e4:	72 75                	jb     80395b <__rodata_start+0x3c3>
+  8038e6:	63 74 20 46          	movsxd 0x46(%rax,%riz,1),%esi
+  8038ea:	64 20 63 6f          	and    %ah,%fs:0x6f(%rbx)
+  8038ee:	72 72                	jb     803962 <__rodata_start+0x3ca>
+  8038f0:	65 63 74 6c 79       	movsxd %gs:0x79(%rsp,%rbp,2),%esi
+  8038f5:	0a 00                	or     (%rax),%al
+  8038f7:	00 72 65             	add    %dh,0x65(%rdx)
+  8038fa:	61                   	(bad)
+  8038fb:	64 20 2f             	and    %ch,%fs:(%rdi)
+  8038fe:	62                   	(bad)
+  8038ff:	69 67 20 66 72 6f 6d 	imul   $0x6d6f7266,0x20(%rdi),%esp
+  803906:	20 25 6c 64 20 72    	and    %ah,0x7220646c(%rip)        # 72a09d78 <__bss_end+0x72200d78>
+  80390c:	65 74 75             	gs je  803984 <__rodata_start+0x3ec>
+  80390f:	72 6e                	jb     80397f <__rodata_start+0x3e7>
+  803911:	65 64 20 25 6c 64 20 	gs and %ah,%fs:0x3c20646c(%rip)        # 3ca09d85 <__bss_end+0x3c200d85>
+  803918:	3c 
+  803919:	20 25 64 20 62 79    	and    %ah,0x79622064(%rip)        # 79e25983 <__bss_end+0x7961c983>
+  80391f:	74 65                	je     803986 <__rodata_start+0x3ee>
+  803921:	73 00                	jae    803923 <__rodata_start+0x38b>
+  803923:	00 00                	add    %al,(%rax)
+  803925:	00 00                	add    %al,(%rax)
+  803927:	00 72 65             	add    %dh,0x65(%rdx)
+  80392a:	61                   	(bad)
+  80392b:	64 20 2f             	and    %ch,%fs:(%rdi)
+  80392e:	62                   	(bad)
+  80392f:	69 67 20 66 72 6f 6d 	imul   $0x6d6f7266,0x20(%rdi),%esp
+  803936:	20 25 6c 64 20 72    	and    %ah,0x7220646c(%rip)        # 72a09da8 <__bss_end+0x72200da8>
+  80393c:	65 74 75             	gs je  8039b4 <__rodata_start+0x41c>
+  80393f:	72 6e                	jb     8039af <__rodata_start+0x417>
+  803941:	65 64 20 62 61       	gs and %ah,%fs:0x61(%rdx)
+  803946:	64 20 64 61 74       	and    %ah,%fs:0x74(%rcx,%riz,2)
+  80394b:	61                   	(bad)
+  80394c:	20 25 64 00 54 68    	and    %ah,0x68540064(%rip)        # 68d439b6 <__bss_end+0x6853a9b6>
+  803952:	69 73 20 69 73 20 74 	imul   $0x74207369,0x20(%rbx),%esi
+  803959:	68 65 20 4e 45       	push   $0x454e2065
+  80395e:	57                   	push   %rdi
+  80395f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803962:	73 73                	jae    8039d7 <__rodata_start+0x43f>
+  803964:	61                   	(bad)
+  803965:	67 65 20 6f 66       	and    %ch,%gs:0x66(%edi)
+  80396a:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  80396e:	20 64 61 79          	and    %ah,0x79(%rcx,%riz,2)
+  803972:	21 0a                	and    %ecx,(%rdx)
+  803974:	0a 00                	or     (%rax),%al
+  803976:	3c 75                	cmp    $0x75,%al
+  803978:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803979:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80397d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80397e:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  803982:	30 38                	xor    %bh,(%rax)
+  803984:	78 5d                	js     8039e3 <__rodata_start+0x44b>
+  803986:	20 75 73             	and    %dh,0x73(%rbp)
+  803989:	65 72 20             	gs jb  8039ac <__rodata_start+0x414>
+  80398c:	70 61                	jo     8039ef <__rodata_start+0x457>
+  80398e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80398f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803996:	73 20                	jae    8039b8 <__rodata_start+0x420>
+  803998:	61                   	(bad)
+  803999:	74 20                	je     8039bb <__rodata_start+0x423>
+  80399b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  8039a0:	3a 20                	cmp    (%rax),%ah
+  8039a2:	00 30                	add    %dh,(%rax)
+  8039a4:	31 32                	xor    %esi,(%rdx)
+  8039a6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8039ad:	41                   	rex.B
+  8039ae:	42                   	rex.X
+  8039af:	43                   	rex.XB
+  8039b0:	44                   	rex.R
+  8039b1:	45                   	rex.RB
+  8039b2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8039b5:	31 32                	xor    %esi,(%rdx)
+  8039b7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8039be:	61                   	(bad)
+  8039bf:	62 63 64 65 66       	(bad)
+  8039c4:	00 28                	add    %ch,(%rax)
+  8039c6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039c7:	75 6c                	jne    803a35 <__rodata_start+0x49d>
+  8039c9:	6c                   	insb   (%dx),%es:(%rdi)
+  8039ca:	29 00                	sub    %eax,(%rax)
+  8039cc:	65 72 72             	gs jb  803a41 <__rodata_start+0x4a9>
+  8039cf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039d0:	72 20                	jb     8039f2 <__rodata_start+0x45a>
+  8039d2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8039d7:	73 70                	jae    803a49 <__rodata_start+0x4b1>
+  8039d9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8039dd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8039e4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039e5:	72 00                	jb     8039e7 <__rodata_start+0x44f>
+  8039e7:	62 61 64 20 65       	(bad)
+  8039ec:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039ed:	76 69                	jbe    803a58 <__rodata_start+0x4c0>
+  8039ef:	72 6f                	jb     803a60 <__rodata_start+0x4c8>
+  8039f1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039f2:	6d                   	insl   (%dx),%es:(%rdi)
+  8039f3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039f5:	74 00                	je     8039f7 <__rodata_start+0x45f>
+  8039f7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8039fe:	20 70 61             	and    %dh,0x61(%rax)
+  803a01:	72 61                	jb     803a64 <__rodata_start+0x4cc>
+  803a03:	6d                   	insl   (%dx),%es:(%rdi)
+  803a04:	65 74 65             	gs je  803a6c <__rodata_start+0x4d4>
+  803a07:	72 00                	jb     803a09 <__rodata_start+0x471>
+  803a09:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a0a:	75 74                	jne    803a80 <__rodata_start+0x4e8>
+  803a0c:	20 6f 66             	and    %ch,0x66(%rdi)
+  803a0f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803a12:	6d                   	insl   (%dx),%es:(%rdi)
+  803a13:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a14:	72 79                	jb     803a8f <__rodata_start+0x4f7>
+  803a16:	00 6f 75             	add    %ch,0x75(%rdi)
+  803a19:	74 20                	je     803a3b <__rodata_start+0x4a3>
+  803a1b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a1c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803a20:	76 69                	jbe    803a8b <__rodata_start+0x4f3>
+  803a22:	72 6f                	jb     803a93 <__rodata_start+0x4fb>
+  803a24:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a25:	6d                   	insl   (%dx),%es:(%rdi)
+  803a26:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803a28:	74 73                	je     803a9d <__rodata_start+0x505>
+  803a2a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803a2d:	72 72                	jb     803aa1 <__rodata_start+0x509>
+  803a2f:	75 70                	jne    803aa1 <__rodata_start+0x509>
+  803a31:	74 65                	je     803a98 <__rodata_start+0x500>
+  803a33:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803a38:	75 67                	jne    803aa1 <__rodata_start+0x509>
+  803a3a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803a3d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803a3f:	00 73 65             	add    %dh,0x65(%rbx)
+  803a42:	67 6d                	insl   (%dx),%es:(%edi)
+  803a44:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803a46:	74 61                	je     803aa9 <__rodata_start+0x511>
+  803a48:	74 69                	je     803ab3 <__rodata_start+0x51b>
+  803a4a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a4b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a4c:	20 66 61             	and    %ah,0x61(%rsi)
+  803a4f:	75 6c                	jne    803abd <__rodata_start+0x525>
+  803a51:	74 00                	je     803a53 <__rodata_start+0x4bb>
+  803a53:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803a5a:	20 45 4c             	and    %al,0x4c(%rbp)
+  803a5d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803a61:	61                   	(bad)
+  803a62:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803a67:	20 73 75             	and    %dh,0x75(%rbx)
+  803a6a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803a6d:	73 79                	jae    803ae8 <__rodata_start+0x550>
+  803a6f:	73 74                	jae    803ae5 <__rodata_start+0x54d>
+  803a71:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803a73:	20 63 61             	and    %ah,0x61(%rbx)
+  803a76:	6c                   	insb   (%dx),%es:(%rdi)
+  803a77:	6c                   	insb   (%dx),%es:(%rdi)
+  803a78:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803a7b:	74 72                	je     803aef <__rodata_start+0x557>
+  803a7d:	79 20                	jns    803a9f <__rodata_start+0x507>
+  803a7f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a80:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a81:	74 20                	je     803aa3 <__rodata_start+0x50b>
+  803a83:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803a85:	75 6e                	jne    803af5 <__rodata_start+0x55d>
+  803a87:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803a8b:	76 20                	jbe    803aad <__rodata_start+0x515>
+  803a8d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803a94:	72 65                	jb     803afb <__rodata_start+0x563>
+  803a96:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803a99:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a9a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803a9e:	65 78 70             	gs js  803b11 <__rodata_start+0x579>
+  803aa1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803aa6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803aa9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803aad:	20 66 69             	and    %ah,0x69(%rsi)
+  803ab0:	6c                   	insb   (%dx),%es:(%rdi)
+  803ab1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803ab5:	20 66 72             	and    %ah,0x72(%rsi)
+  803ab8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803abd:	61                   	(bad)
+  803abe:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803ac1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ac2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ac3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803ac7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803aca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803acb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803acc:	20 6d 61             	and    %ch,0x61(%rbp)
+  803acf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ad0:	79 20                	jns    803af2 <__rodata_start+0x55a>
+  803ad2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803ad9:	72 65                	jb     803b40 <__rodata_start+0x5a8>
+  803adb:	20 6f 70             	and    %ch,0x70(%rdi)
+  803ade:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ae0:	00 66 69             	add    %ah,0x69(%rsi)
+  803ae3:	6c                   	insb   (%dx),%es:(%rdi)
+  803ae4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803ae8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803aeb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803aec:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803aef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803af0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803af1:	74 20                	je     803b13 <__rodata_start+0x57b>
+  803af3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803af5:	75 6e                	jne    803b65 <__rodata_start+0x5cd>
+  803af7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803afb:	76 61                	jbe    803b5e <__rodata_start+0x5c6>
+  803afd:	6c                   	insb   (%dx),%es:(%rdi)
+  803afe:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803b05:	00 
+  803b06:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803b0d:	72 65                	jb     803b74 <__rodata_start+0x5dc>
+  803b0f:	61                   	(bad)
+  803b10:	64 79 20             	fs jns 803b33 <__rodata_start+0x59b>
+  803b13:	65 78 69             	gs js  803b7f <__rodata_start+0x5e7>
+  803b16:	73 74                	jae    803b8c <__rodata_start+0x5f4>
+  803b18:	73 00                	jae    803b1a <__rodata_start+0x582>
+  803b1a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b1b:	70 65                	jo     803b82 <__rodata_start+0x5ea>
+  803b1d:	72 61                	jb     803b80 <__rodata_start+0x5e8>
+  803b1f:	74 69                	je     803b8a <__rodata_start+0x5f2>
+  803b21:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b22:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b23:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803b26:	74 20                	je     803b48 <__rodata_start+0x5b0>
+  803b28:	73 75                	jae    803b9f <__rodata_start+0x607>
+  803b2a:	70 70                	jo     803b9c <__rodata_start+0x604>
+  803b2c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b2d:	72 74                	jb     803ba3 <__rodata_start+0x60b>
+  803b2f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803b34:	65 72 61             	gs jb  803b98 <__rodata_start+0x600>
+  803b37:	74 69                	je     803ba2 <__rodata_start+0x60a>
+  803b39:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b3a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b3b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803b3e:	74 20                	je     803b60 <__rodata_start+0x5c8>
+  803b40:	70 65                	jo     803ba7 <__rodata_start+0x60f>
+  803b42:	72 6d                	jb     803bb1 <__rodata_start+0x619>
+  803b44:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  803b4b:	2e 
+  803b4c:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803b53:	00 
+  803b54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803b5b:	00 00 00 
+  803b5e:	66 90                	xchg   %ax,%ax
+  803b60:	b5 0e                	mov    $0xe,%ch
+  803b62:	80 00 00             	addb   $0x0,(%rax)
+  803b65:	00 00                	add    %al,(%rax)
+  803b67:	00 f6                	add    %dh,%dh
+  803b69:	14 80                	adc    $0x80,%al
+  803b6b:	00 00                	add    %al,(%rax)
+  803b6d:	00 00                	add    %al,(%rax)
+  803b6f:	00 e6                	add    %ah,%dh
+  803b71:	14 80                	adc    $0x80,%al
+  803b73:	00 00                	add    %al,(%rax)
+  803b75:	00 00                	add    %al,(%rax)
+  803b77:	00 f6                	add    %dh,%dh
+  803b79:	14 80                	adc    $0x80,%al
+  803b7b:	00 00                	add    %al,(%rax)
+  803b7d:	00 00                	add    %al,(%rax)
+  803b7f:	00 f6                	add    %dh,%dh
+  803b81:	14 80                	adc    $0x80,%al
+  803b83:	00 00                	add    %al,(%rax)
+  803b85:	00 00                	add    %al,(%rax)
+  803b87:	00 f6                	add    %dh,%dh
+  803b89:	14 80                	adc    $0x80,%al
+  803b8b:	00 00                	add    %al,(%rax)
+  803b8d:	00 00                	add    %al,(%rax)
+  803b8f:	00 f6                	add    %dh,%dh
+  803b91:	14 80                	adc    $0x80,%al
+  803b93:	00 00                	add    %al,(%rax)
+  803b95:	00 00                	add    %al,(%rax)
+  803b97:	00 d4                	add    %dl,%ah
+  803b99:	0e                   	(bad)
+  803b9a:	80 00 00             	addb   $0x0,(%rax)
+  803b9d:	00 00                	add    %al,(%rax)
+  803b9f:	00 f6                	add    %dh,%dh
+  803ba1:	14 80                	adc    $0x80,%al
+  803ba3:	00 00                	add    %al,(%rax)
+  803ba5:	00 00                	add    %al,(%rax)
+  803ba7:	00 f6                	add    %dh,%dh
+  803ba9:	14 80                	adc    $0x80,%al
+  803bab:	00 00                	add    %al,(%rax)
+  803bad:	00 00                	add    %al,(%rax)
+  803baf:	00 c8                	add    %cl,%al
+  803bb1:	0e                   	(bad)
+  803bb2:	80 00 00             	addb   $0x0,(%rax)
+  803bb5:	00 00                	add    %al,(%rax)
+  803bb7:	00 42 0f             	add    %al,0xf(%rdx)
+  803bba:	80 00 00             	addb   $0x0,(%rax)
+  803bbd:	00 00                	add    %al,(%rax)
+  803bbf:	00 f6                	add    %dh,%dh
+  803bc1:	14 80                	adc    $0x80,%al
+  803bc3:	00 00                	add    %al,(%rax)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 c8                	add    %cl,%al
+  803bc9:	0e                   	(bad)
+  803bca:	80 00 00             	addb   $0x0,(%rax)
+  803bcd:	00 00                	add    %al,(%rax)
+  803bcf:	00 0e                	add    %cl,(%rsi)
+  803bd1:	0f 80 00 00 00 00    	jo     803bd7 <__rodata_start+0x63f>
+  803bd7:	00 0e                	add    %cl,(%rsi)
+  803bd9:	0f 80 00 00 00 00    	jo     803bdf <__rodata_start+0x647>
+  803bdf:	00 0e                	add    %cl,(%rsi)
+  803be1:	0f 80 00 00 00 00    	jo     803be7 <__rodata_start+0x64f>
+  803be7:	00 0e                	add    %cl,(%rsi)
+  803be9:	0f 80 00 00 00 00    	jo     803bef <__rodata_start+0x657>
+  803bef:	00 0e                	add    %cl,(%rsi)
+  803bf1:	0f 80 00 00 00 00    	jo     803bf7 <__rodata_start+0x65f>
+  803bf7:	00 0e                	add    %cl,(%rsi)
+  803bf9:	0f 80 00 00 00 00    	jo     803bff <__rodata_start+0x667>
+  803bff:	00 0e                	add    %cl,(%rsi)
+  803c01:	0f 80 00 00 00 00    	jo     803c07 <__rodata_start+0x66f>
+  803c07:	00 0e                	add    %cl,(%rsi)
+  803c09:	0f 80 00 00 00 00    	jo     803c0f <__rodata_start+0x677>
+  803c0f:	00 0e                	add    %cl,(%rsi)
+  803c11:	0f 80 00 00 00 00    	jo     803c17 <__rodata_start+0x67f>
+  803c17:	00 f6                	add    %dh,%dh
+  803c19:	14 80                	adc    $0x80,%al
+  803c1b:	00 00                	add    %al,(%rax)
+  803c1d:	00 00                	add    %al,(%rax)
+  803c1f:	00 f6                	add    %dh,%dh
+  803c21:	14 80                	adc    $0x80,%al
+  803c23:	00 00                	add    %al,(%rax)
+  803c25:	00 00                	add    %al,(%rax)
+  803c27:	00 f6                	add    %dh,%dh
+  803c29:	14 80                	adc    $0x80,%al
+  803c2b:	00 00                	add    %al,(%rax)
+  803c2d:	00 00                	add    %al,(%rax)
+  803c2f:	00 f6                	add    %dh,%dh
+  803c31:	14 80                	adc    $0x80,%al
+  803c33:	00 00                	add    %al,(%rax)
+  803c35:	00 00                	add    %al,(%rax)
+  803c37:	00 f6                	add    %dh,%dh
+  803c39:	14 80                	adc    $0x80,%al
+  803c3b:	00 00                	add    %al,(%rax)
+  803c3d:	00 00                	add    %al,(%rax)
+  803c3f:	00 f6                	add    %dh,%dh
+  803c41:	14 80                	adc    $0x80,%al
+  803c43:	00 00                	add    %al,(%rax)
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 f6                	add    %dh,%dh
+  803c49:	14 80                	adc    $0x80,%al
+  803c4b:	00 00                	add    %al,(%rax)
+  803c4d:	00 00                	add    %al,(%rax)
+  803c4f:	00 f6                	add    %dh,%dh
+  803c51:	14 80                	adc    $0x80,%al
+  803c53:	00 00                	add    %al,(%rax)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 f6                	add    %dh,%dh
+  803c59:	14 80                	adc    $0x80,%al
+  803c5b:	00 00                	add    %al,(%rax)
+  803c5d:	00 00                	add    %al,(%rax)
+  803c5f:	00 f6                	add    %dh,%dh
+  803c61:	14 80                	adc    $0x80,%al
+  803c63:	00 00                	add    %al,(%rax)
+  803c65:	00 00                	add    %al,(%rax)
+  803c67:	00 f6                	add    %dh,%dh
+  803c69:	14 80                	adc    $0x80,%al
+  803c6b:	00 00                	add    %al,(%rax)
+  803c6d:	00 00                	add    %al,(%rax)
+  803c6f:	00 f6                	add    %dh,%dh
+  803c71:	14 80                	adc    $0x80,%al
+  803c73:	00 00                	add    %al,(%rax)
+  803c75:	00 00                	add    %al,(%rax)
+  803c77:	00 f6                	add    %dh,%dh
+  803c79:	14 80                	adc    $0x80,%al
+  803c7b:	00 00                	add    %al,(%rax)
+  803c7d:	00 00                	add    %al,(%rax)
+  803c7f:	00 f6                	add    %dh,%dh
+  803c81:	14 80                	adc    $0x80,%al
+  803c83:	00 00                	add    %al,(%rax)
+  803c85:	00 00                	add    %al,(%rax)
+  803c87:	00 f6                	add    %dh,%dh
+  803c89:	14 80                	adc    $0x80,%al
+  803c8b:	00 00                	add    %al,(%rax)
+  803c8d:	00 00                	add    %al,(%rax)
+  803c8f:	00 f6                	add    %dh,%dh
+  803c91:	14 80                	adc    $0x80,%al
+  803c93:	00 00                	add    %al,(%rax)
+  803c95:	00 00                	add    %al,(%rax)
+  803c97:	00 f6                	add    %dh,%dh
+  803c99:	14 80                	adc    $0x80,%al
+  803c9b:	00 00                	add    %al,(%rax)
+  803c9d:	00 00                	add    %al,(%rax)
+  803c9f:	00 f6                	add    %dh,%dh
+  803ca1:	14 80                	adc    $0x80,%al
+  803ca3:	00 00                	add    %al,(%rax)
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 f6                	add    %dh,%dh
+  803ca9:	14 80                	adc    $0x80,%al
+  803cab:	00 00                	add    %al,(%rax)
+  803cad:	00 00                	add    %al,(%rax)
+  803caf:	00 f6                	add    %dh,%dh
+  803cb1:	14 80                	adc    $0x80,%al
+  803cb3:	00 00                	add    %al,(%rax)
+  803cb5:	00 00                	add    %al,(%rax)
+  803cb7:	00 f6                	add    %dh,%dh
+  803cb9:	14 80                	adc    $0x80,%al
+  803cbb:	00 00                	add    %al,(%rax)
+  803cbd:	00 00                	add    %al,(%rax)
+  803cbf:	00 f6                	add    %dh,%dh
+  803cc1:	14 80                	adc    $0x80,%al
+  803cc3:	00 00                	add    %al,(%rax)
+  803cc5:	00 00                	add    %al,(%rax)
+  803cc7:	00 f6                	add    %dh,%dh
+  803cc9:	14 80                	adc    $0x80,%al
+  803ccb:	00 00                	add    %al,(%rax)
+  803ccd:	00 00                	add    %al,(%rax)
+  803ccf:	00 f6                	add    %dh,%dh
+  803cd1:	14 80                	adc    $0x80,%al
+  803cd3:	00 00                	add    %al,(%rax)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 f6                	add    %dh,%dh
+  803cd9:	14 80                	adc    $0x80,%al
+  803cdb:	00 00                	add    %al,(%rax)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 f6                	add    %dh,%dh
+  803ce1:	14 80                	adc    $0x80,%al
+  803ce3:	00 00                	add    %al,(%rax)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 f6                	add    %dh,%dh
+  803ce9:	14 80                	adc    $0x80,%al
+  803ceb:	00 00                	add    %al,(%rax)
+  803ced:	00 00                	add    %al,(%rax)
+  803cef:	00 f6                	add    %dh,%dh
+  803cf1:	14 80                	adc    $0x80,%al
+  803cf3:	00 00                	add    %al,(%rax)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 f6                	add    %dh,%dh
+  803cf9:	14 80                	adc    $0x80,%al
+  803cfb:	00 00                	add    %al,(%rax)
+  803cfd:	00 00                	add    %al,(%rax)
+  803cff:	00 f6                	add    %dh,%dh
+  803d01:	14 80                	adc    $0x80,%al
+  803d03:	00 00                	add    %al,(%rax)
+  803d05:	00 00                	add    %al,(%rax)
+  803d07:	00 19                	add    %bl,(%rcx)
+  803d09:	14 80                	adc    $0x80,%al
+  803d0b:	00 00                	add    %al,(%rax)
+  803d0d:	00 00                	add    %al,(%rax)
+  803d0f:	00 f6                	add    %dh,%dh
+  803d11:	14 80                	adc    $0x80,%al
+  803d13:	00 00                	add    %al,(%rax)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 f6                	add    %dh,%dh
+  803d19:	14 80                	adc    $0x80,%al
+  803d1b:	00 00                	add    %al,(%rax)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 f6                	add    %dh,%dh
+  803d21:	14 80                	adc    $0x80,%al
+  803d23:	00 00                	add    %al,(%rax)
+  803d25:	00 00                	add    %al,(%rax)
+  803d27:	00 f6                	add    %dh,%dh
+  803d29:	14 80                	adc    $0x80,%al
+  803d2b:	00 00                	add    %al,(%rax)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 f6                	add    %dh,%dh
+  803d31:	14 80                	adc    $0x80,%al
+  803d33:	00 00                	add    %al,(%rax)
+  803d35:	00 00                	add    %al,(%rax)
+  803d37:	00 f6                	add    %dh,%dh
+  803d39:	14 80                	adc    $0x80,%al
+  803d3b:	00 00                	add    %al,(%rax)
+  803d3d:	00 00                	add    %al,(%rax)
+  803d3f:	00 f6                	add    %dh,%dh
+  803d41:	14 80                	adc    $0x80,%al
+  803d43:	00 00                	add    %al,(%rax)
+  803d45:	00 00                	add    %al,(%rax)
+  803d47:	00 f6                	add    %dh,%dh
+  803d49:	14 80                	adc    $0x80,%al
+  803d4b:	00 00                	add    %al,(%rax)
+  803d4d:	00 00                	add    %al,(%rax)
+  803d4f:	00 f6                	add    %dh,%dh
+  803d51:	14 80                	adc    $0x80,%al
+  803d53:	00 00                	add    %al,(%rax)
+  803d55:	00 00                	add    %al,(%rax)
+  803d57:	00 f6                	add    %dh,%dh
+  803d59:	14 80                	adc    $0x80,%al
+  803d5b:	00 00                	add    %al,(%rax)
+  803d5d:	00 00                	add    %al,(%rax)
+  803d5f:	00 65 0f             	add    %ah,0xf(%rbp)
+  803d62:	80 00 00             	addb   $0x0,(%rax)
+  803d65:	00 00                	add    %al,(%rax)
+  803d67:	00 34 11             	add    %dh,(%rcx,%rdx,1)
+  803d6a:	80 00 00             	addb   $0x0,(%rax)
+  803d6d:	00 00                	add    %al,(%rax)
+  803d6f:	00 f6                	add    %dh,%dh
+  803d71:	14 80                	adc    $0x80,%al
+  803d73:	00 00                	add    %al,(%rax)
+  803d75:	00 00                	add    %al,(%rax)
+  803d77:	00 f6                	add    %dh,%dh
+  803d79:	14 80                	adc    $0x80,%al
+  803d7b:	00 00                	add    %al,(%rax)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 f6                	add    %dh,%dh
+  803d81:	14 80                	adc    $0x80,%al
+  803d83:	00 00                	add    %al,(%rax)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 f6                	add    %dh,%dh
+  803d89:	14 80                	adc    $0x80,%al
+  803d8b:	00 00                	add    %al,(%rax)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 94 0f 80 00 00 00 	add    %dl,0x80(%rdi,%rcx,1)
+  803d96:	00 00                	add    %al,(%rax)
+  803d98:	f6 14 80             	notb   (%rax,%rax,4)
+  803d9b:	00 00                	add    %al,(%rax)
+  803d9d:	00 00                	add    %al,(%rax)
+  803d9f:	00 f6                	add    %dh,%dh
+  803da1:	14 80                	adc    $0x80,%al
+  803da3:	00 00                	add    %al,(%rax)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 5a 0f             	add    %bl,0xf(%rdx)
+  803daa:	80 00 00             	addb   $0x0,(%rax)
+  803dad:	00 00                	add    %al,(%rax)
+  803daf:	00 f6                	add    %dh,%dh
+  803db1:	14 80                	adc    $0x80,%al
+  803db3:	00 00                	add    %al,(%rax)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 f6                	add    %dh,%dh
+  803db9:	14 80                	adc    $0x80,%al
+  803dbb:	00 00                	add    %al,(%rax)
+  803dbd:	00 00                	add    %al,(%rax)
+  803dbf:	00 dc                	add    %bl,%ah
+  803dc1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  803dc7:	00 a6 13 80 00 00    	add    %ah,0x8013(%rsi)
+  803dcd:	00 00                	add    %al,(%rax)
+  803dcf:	00 f6                	add    %dh,%dh
+  803dd1:	14 80                	adc    $0x80,%al
+  803dd3:	00 00                	add    %al,(%rax)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 f6                	add    %dh,%dh
+  803dd9:	14 80                	adc    $0x80,%al
+  803ddb:	00 00                	add    %al,(%rax)
+  803ddd:	00 00                	add    %al,(%rax)
+  803ddf:	00 2b                	add    %ch,(%rbx)
+  803de1:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+  803de7:	00 f6                	add    %dh,%dh
+  803de9:	14 80                	adc    $0x80,%al
+  803deb:	00 00                	add    %al,(%rax)
+  803ded:	00 00                	add    %al,(%rax)
+  803def:	00 08                	add    %cl,(%rax)
+  803df1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  803df7:	00 f6                	add    %dh,%dh
+  803df9:	14 80                	adc    $0x80,%al
+  803dfb:	00 00                	add    %al,(%rax)
+  803dfd:	00 00                	add    %al,(%rax)
+  803dff:	00 f6                	add    %dh,%dh
+  803e01:	14 80                	adc    $0x80,%al
+  803e03:	00 00                	add    %al,(%rax)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 19                	add    %bl,(%rcx)
+  803e09:	14 80                	adc    $0x80,%al
+  803e0b:	00 00                	add    %al,(%rax)
+  803e0d:	00 00                	add    %al,(%rax)
+  803e0f:	00 f6                	add    %dh,%dh
+  803e11:	14 80                	adc    $0x80,%al
+  803e13:	00 00                	add    %al,(%rax)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 be 0e 80 00 00    	add    %bh,0x800e(%rsi)
+  803e1d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803e20 <error_string>:
+	...
+  803e28:	d5 39 80 00 00 00 00 00 e7 39 80 00 00 00 00 00     .9.......9......
+  803e38:	f7 39 80 00 00 00 00 00 09 3a 80 00 00 00 00 00     .9.......:......
+  803e48:	17 3a 80 00 00 00 00 00 2b 3a 80 00 00 00 00 00     .:......+:......
+  803e58:	40 3a 80 00 00 00 00 00 53 3a 80 00 00 00 00 00     @:......S:......
+  803e68:	65 3a 80 00 00 00 00 00 79 3a 80 00 00 00 00 00     e:......y:......
+  803e78:	89 3a 80 00 00 00 00 00 9c 3a 80 00 00 00 00 00     .:.......:......
+  803e88:	b3 3a 80 00 00 00 00 00 c9 3a 80 00 00 00 00 00     .:.......:......
+  803e98:	e1 3a 80 00 00 00 00 00 f9 3a 80 00 00 00 00 00     .:.......:......
+  803ea8:	06 3b 80 00 00 00 00 00 d0 3e 80 00 00 00 00 00     .;.......>......
+  803eb8:	1a 3b 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .;..............
+  803ec8:	32 3b 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     2;......file is 
+  803ed8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803ee8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803ef8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803f08:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803f18:	6c 6c 2e 63 00 69 70 63 5f 73 65 6e 64 3a 20 66     ll.c.ipc_send: f
+  803f28:	61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69     ailed to send.li
+  803f38:	62 2f 69 70 63 2e 63 00 5b 25 30 38 78 5d 20 75     b/ipc.c.[%08x] u
+  803f48:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803f58:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803f68:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803f78:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803f88:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803f98:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803fa8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803fb8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803fc0 <devtab>:
+  803fc0:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  803fd0:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  803fe0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803ff0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804000:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804010:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804020:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804030:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804040:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804050:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804060:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804070:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804080:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804090:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8040a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8040b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8040c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8040d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8040e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8040f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804100:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804110:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804120:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804130:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804140:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804150:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804160:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804170:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804180:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804190:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8041a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8041b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8041c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8041d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8041e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8041f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804200:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804210:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804220:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804230:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804240:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804250:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804260:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804270:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804280:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804290:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8042b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8042c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8042d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8042e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804300:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804310:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804320:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804330:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804340:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804350:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804360:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804370:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804380:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804390:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804400:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804410:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804420:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804430:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804440:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
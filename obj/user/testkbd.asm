@@ -0,0 +1,6089 @@
+
+obj/user/testkbd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 71 03 00 00       	call   800394 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+  800030:	bb 0a 00 00 00       	mov    $0xa,%ebx
+    int r;
+
+    /* Spin for a bit to let the console quiet */
+    for (int i = 0; i < 10; ++i)
+        sys_yield();
+  800035:	49 bc 3e 15 80 00 00 	movabs $0x80153e,%r12
+  80003c:	00 00 00 
+  80003f:	41 ff d4             	call   *%r12
+    for (int i = 0; i < 10; ++i)
+  800042:	83 eb 01             	sub    $0x1,%ebx
+  800045:	75 f8                	jne    80003f <umain+0x1a>
+
+    close(0);
+  800047:	bf 00 00 00 00       	mov    $0x0,%edi
+  80004c:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  800053:	00 00 00 
+  800056:	ff d0                	call   *%rax
+    if ((r = opencons()) < 0)
+  800058:	48 b8 2d 03 80 00 00 	movabs $0x80032d,%rax
+  80005f:	00 00 00 
+  800062:	ff d0                	call   *%rax
+  800064:	85 c0                	test   %eax,%eax
+  800066:	78 2f                	js     800097 <umain+0x72>
+        panic("opencons: %i", r);
+    if (r != 0)
+  800068:	74 5a                	je     8000c4 <umain+0x9f>
+        panic("first opencons used fd %d", r);
+  80006a:	89 c1                	mov    %eax,%ecx
+  80006c:	48 ba 5c 2f 80 00 00 	movabs $0x802f5c,%rdx
+  800073:	00 00 00 
+  800076:	be 10 00 00 00       	mov    $0x10,%esi
+  80007b:	48 bf 4d 2f 80 00 00 	movabs $0x802f4d,%rdi
+  800082:	00 00 00 
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	49 b8 5e 04 80 00 00 	movabs $0x80045e,%r8
+  800091:	00 00 00 
+  800094:	41 ff d0             	call   *%r8
+        panic("opencons: %i", r);
+  800097:	89 c1                	mov    %eax,%ecx
+  800099:	48 ba 40 2f 80 00 00 	movabs $0x802f40,%rdx
+  8000a0:	00 00 00 
+  8000a3:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000a8:	48 bf 4d 2f 80 00 00 	movabs $0x802f4d,%rdi
+  8000af:	00 00 00 
+  8000b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b7:	49 b8 5e 04 80 00 00 	movabs $0x80045e,%r8
+  8000be:	00 00 00 
+  8000c1:	41 ff d0             	call   *%r8
+    if ((r = dup(0, 1)) < 0)
+  8000c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8000c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ce:	48 b8 bd 1d 80 00 00 	movabs $0x801dbd,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+        panic("dup: %i", r);
+
+    for (;;) {
+        char *buf;
+
+        buf = readline("Type a line: ");
+  8000da:	49 bc 7e 2f 80 00 00 	movabs $0x802f7e,%r12
+  8000e1:	00 00 00 
+  8000e4:	48 bb fa 12 80 00 00 	movabs $0x8012fa,%rbx
+  8000eb:	00 00 00 
+        if (buf != NULL)
+            fprintf(1, "%s\n", buf);
+        else
+            fprintf(1, "(end of file received)\n");
+  8000ee:	49 be 90 2f 80 00 00 	movabs $0x802f90,%r14
+  8000f5:	00 00 00 
+  8000f8:	49 bd 8c 26 80 00 00 	movabs $0x80268c,%r13
+  8000ff:	00 00 00 
+    if ((r = dup(0, 1)) < 0)
+  800102:	85 c0                	test   %eax,%eax
+  800104:	79 44                	jns    80014a <umain+0x125>
+        panic("dup: %i", r);
+  800106:	89 c1                	mov    %eax,%ecx
+  800108:	48 ba 76 2f 80 00 00 	movabs $0x802f76,%rdx
+  80010f:	00 00 00 
+  800112:	be 12 00 00 00       	mov    $0x12,%esi
+  800117:	48 bf 4d 2f 80 00 00 	movabs $0x802f4d,%rdi
+  80011e:	00 00 00 
+  800121:	b8 00 00 00 00       	mov    $0x0,%eax
+  800126:	49 b8 5e 04 80 00 00 	movabs $0x80045e,%r8
+  80012d:	00 00 00 
+  800130:	41 ff d0             	call   *%r8
+            fprintf(1, "%s\n", buf);
+  800133:	48 be 8c 2f 80 00 00 	movabs $0x802f8c,%rsi
+  80013a:	00 00 00 
+  80013d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800142:	b8 00 00 00 00       	mov    $0x0,%eax
+  800147:	41 ff d5             	call   *%r13
+        buf = readline("Type a line: ");
+  80014a:	4c 89 e7             	mov    %r12,%rdi
+  80014d:	ff d3                	call   *%rbx
+  80014f:	48 89 c2             	mov    %rax,%rdx
+        if (buf != NULL)
+  800152:	48 85 c0             	test   %rax,%rax
+  800155:	75 dc                	jne    800133 <umain+0x10e>
+            fprintf(1, "(end of file received)\n");
+  800157:	4c 89 f6             	mov    %r14,%rsi
+  80015a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80015f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800164:	41 ff d5             	call   *%r13
+  800167:	eb e1                	jmp    80014a <umain+0x125>
+
+0000000000800169 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  800169:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016e:	c3                   	ret
+
+000000000080016f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80016f:	55                   	push   %rbp
+  800170:	48 89 e5             	mov    %rsp,%rbp
+  800173:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  800176:	48 be a8 2f 80 00 00 	movabs $0x802fa8,%rsi
+  80017d:	00 00 00 
+  800180:	48 b8 d3 0e 80 00 00 	movabs $0x800ed3,%rax
+  800187:	00 00 00 
+  80018a:	ff d0                	call   *%rax
+    return 0;
+}
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	5d                   	pop    %rbp
+  800192:	c3                   	ret
+
+0000000000800193 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800193:	55                   	push   %rbp
+  800194:	48 89 e5             	mov    %rsp,%rbp
+  800197:	41 57                	push   %r15
+  800199:	41 56                	push   %r14
+  80019b:	41 55                	push   %r13
+  80019d:	41 54                	push   %r12
+  80019f:	53                   	push   %rbx
+  8001a0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8001a7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8001ae:	48 85 d2             	test   %rdx,%rdx
+  8001b1:	74 7a                	je     80022d <devcons_write+0x9a>
+  8001b3:	49 89 d6             	mov    %rdx,%r14
+  8001b6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8001bc:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8001c1:	49 bf cd 10 80 00 00 	movabs $0x8010cd,%r15
+  8001c8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8001cb:	4c 89 f3             	mov    %r14,%rbx
+  8001ce:	48 29 f3             	sub    %rsi,%rbx
+  8001d1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8001d6:	48 39 c3             	cmp    %rax,%rbx
+  8001d9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8001dd:	4c 63 eb             	movslq %ebx,%r13
+  8001e0:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8001e7:	48 01 c6             	add    %rax,%rsi
+  8001ea:	4c 89 ea             	mov    %r13,%rdx
+  8001ed:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8001f4:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8001f7:	4c 89 ee             	mov    %r13,%rsi
+  8001fa:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800201:	48 b8 44 14 80 00 00 	movabs $0x801444,%rax
+  800208:	00 00 00 
+  80020b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80020d:	41 01 dc             	add    %ebx,%r12d
+  800210:	49 63 f4             	movslq %r12d,%rsi
+  800213:	4c 39 f6             	cmp    %r14,%rsi
+  800216:	72 b3                	jb     8001cb <devcons_write+0x38>
+    return res;
+  800218:	49 63 c4             	movslq %r12d,%rax
+}
+  80021b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  800222:	5b                   	pop    %rbx
+  800223:	41 5c                	pop    %r12
+  800225:	41 5d                	pop    %r13
+  800227:	41 5e                	pop    %r14
+  800229:	41 5f                	pop    %r15
+  80022b:	5d                   	pop    %rbp
+  80022c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80022d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800233:	eb e3                	jmp    800218 <devcons_write+0x85>
+
+0000000000800235 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800235:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  800238:	ba 00 00 00 00       	mov    $0x0,%edx
+  80023d:	48 85 c0             	test   %rax,%rax
+  800240:	74 55                	je     800297 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800242:	55                   	push   %rbp
+  800243:	48 89 e5             	mov    %rsp,%rbp
+  800246:	41 55                	push   %r13
+  800248:	41 54                	push   %r12
+  80024a:	53                   	push   %rbx
+  80024b:	48 83 ec 08          	sub    $0x8,%rsp
+  80024f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  800252:	48 bb 71 14 80 00 00 	movabs $0x801471,%rbx
+  800259:	00 00 00 
+  80025c:	49 bc 3e 15 80 00 00 	movabs $0x80153e,%r12
+  800263:	00 00 00 
+  800266:	eb 03                	jmp    80026b <devcons_read+0x36>
+  800268:	41 ff d4             	call   *%r12
+  80026b:	ff d3                	call   *%rbx
+  80026d:	85 c0                	test   %eax,%eax
+  80026f:	74 f7                	je     800268 <devcons_read+0x33>
+    if (c < 0) return c;
+  800271:	48 63 d0             	movslq %eax,%rdx
+  800274:	78 13                	js     800289 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  800276:	ba 00 00 00 00       	mov    $0x0,%edx
+  80027b:	83 f8 04             	cmp    $0x4,%eax
+  80027e:	74 09                	je     800289 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  800280:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  800284:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  800289:	48 89 d0             	mov    %rdx,%rax
+  80028c:	48 83 c4 08          	add    $0x8,%rsp
+  800290:	5b                   	pop    %rbx
+  800291:	41 5c                	pop    %r12
+  800293:	41 5d                	pop    %r13
+  800295:	5d                   	pop    %rbp
+  800296:	c3                   	ret
+  800297:	48 89 d0             	mov    %rdx,%rax
+  80029a:	c3                   	ret
+
+000000000080029b <cputchar>:
+cputchar(int ch) {
+  80029b:	55                   	push   %rbp
+  80029c:	48 89 e5             	mov    %rsp,%rbp
+  80029f:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8002a3:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8002a7:	be 01 00 00 00       	mov    $0x1,%esi
+  8002ac:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8002b0:	48 b8 44 14 80 00 00 	movabs $0x801444,%rax
+  8002b7:	00 00 00 
+  8002ba:	ff d0                	call   *%rax
+}
+  8002bc:	c9                   	leave
+  8002bd:	c3                   	ret
+
+00000000008002be <getchar>:
+getchar(void) {
+  8002be:	55                   	push   %rbp
+  8002bf:	48 89 e5             	mov    %rsp,%rbp
+  8002c2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8002c6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8002cb:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8002cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002d4:	48 b8 e0 1e 80 00 00 	movabs $0x801ee0,%rax
+  8002db:	00 00 00 
+  8002de:	ff d0                	call   *%rax
+  8002e0:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8002e2:	85 c0                	test   %eax,%eax
+  8002e4:	78 06                	js     8002ec <getchar+0x2e>
+  8002e6:	74 08                	je     8002f0 <getchar+0x32>
+  8002e8:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8002ec:	89 d0                	mov    %edx,%eax
+  8002ee:	c9                   	leave
+  8002ef:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8002f0:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8002f5:	eb f5                	jmp    8002ec <getchar+0x2e>
+
+00000000008002f7 <iscons>:
+iscons(int fdnum) {
+  8002f7:	55                   	push   %rbp
+  8002f8:	48 89 e5             	mov    %rsp,%rbp
+  8002fb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8002ff:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800303:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  80030a:	00 00 00 
+  80030d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80030f:	85 c0                	test   %eax,%eax
+  800311:	78 18                	js     80032b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  800313:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800317:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80031e:	00 00 00 
+  800321:	8b 00                	mov    (%rax),%eax
+  800323:	39 02                	cmp    %eax,(%rdx)
+  800325:	0f 94 c0             	sete   %al
+  800328:	0f b6 c0             	movzbl %al,%eax
+}
+  80032b:	c9                   	leave
+  80032c:	c3                   	ret
+
+000000000080032d <opencons>:
+opencons(void) {
+  80032d:	55                   	push   %rbp
+  80032e:	48 89 e5             	mov    %rsp,%rbp
+  800331:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  800335:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  800339:	48 b8 9d 1b 80 00 00 	movabs $0x801b9d,%rax
+  800340:	00 00 00 
+  800343:	ff d0                	call   *%rax
+  800345:	85 c0                	test   %eax,%eax
+  800347:	78 49                	js     800392 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  800349:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80034e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800353:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800357:	bf 00 00 00 00       	mov    $0x0,%edi
+  80035c:	48 b8 cd 15 80 00 00 	movabs $0x8015cd,%rax
+  800363:	00 00 00 
+  800366:	ff d0                	call   *%rax
+  800368:	85 c0                	test   %eax,%eax
+  80036a:	78 26                	js     800392 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80036c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800370:	a1 00 40 80 00 00 00 	movabs 0x804000,%eax
+  800377:	00 00 
+  800379:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80037b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80037f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800386:	48 b8 6f 1b 80 00 00 	movabs $0x801b6f,%rax
+  80038d:	00 00 00 
+  800390:	ff d0                	call   *%rax
+}
+  800392:	c9                   	leave
+  800393:	c3                   	ret
+
+0000000000800394 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800394:	55                   	push   %rbp
+  800395:	48 89 e5             	mov    %rsp,%rbp
+  800398:	41 56                	push   %r14
+  80039a:	41 55                	push   %r13
+  80039c:	41 54                	push   %r12
+  80039e:	53                   	push   %rbx
+  80039f:	41 89 fd             	mov    %edi,%r13d
+  8003a2:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003a5:	48 ba b8 40 80 00 00 	movabs $0x8040b8,%rdx
+  8003ac:	00 00 00 
+  8003af:	48 b8 b8 40 80 00 00 	movabs $0x8040b8,%rax
+  8003b6:	00 00 00 
+  8003b9:	48 39 c2             	cmp    %rax,%rdx
+  8003bc:	73 17                	jae    8003d5 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8003be:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003c1:	49 89 c4             	mov    %rax,%r12
+  8003c4:	48 83 c3 08          	add    $0x8,%rbx
+  8003c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cd:	ff 53 f8             	call   *-0x8(%rbx)
+  8003d0:	4c 39 e3             	cmp    %r12,%rbx
+  8003d3:	72 ef                	jb     8003c4 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8003d5:	48 b8 0d 15 80 00 00 	movabs $0x80150d,%rax
+  8003dc:	00 00 00 
+  8003df:	ff d0                	call   *%rax
+  8003e1:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8003e4:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8003eb:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003f2:	00 00 00 
+  8003f5:	48 01 d0             	add    %rdx,%rax
+  8003f8:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8003ff:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800402:	45 85 ed             	test   %r13d,%r13d
+  800405:	7e 0d                	jle    800414 <libmain+0x80>
+  800407:	49 8b 06             	mov    (%r14),%rax
+  80040a:	48 a3 38 40 80 00 00 	movabs %rax,0x804038
+  800411:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800414:	4c 89 f6             	mov    %r14,%rsi
+  800417:	44 89 ef             	mov    %r13d,%edi
+  80041a:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800421:	00 00 00 
+  800424:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800426:	48 b8 3b 04 80 00 00 	movabs $0x80043b,%rax
+  80042d:	00 00 00 
+  800430:	ff d0                	call   *%rax
+#endif
+}
+  800432:	5b                   	pop    %rbx
+  800433:	41 5c                	pop    %r12
+  800435:	41 5d                	pop    %r13
+  800437:	41 5e                	pop    %r14
+  800439:	5d                   	pop    %rbp
+  80043a:	c3                   	ret
+
+000000000080043b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80043b:	55                   	push   %rbp
+  80043c:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80043f:	48 b8 95 1d 80 00 00 	movabs $0x801d95,%rax
+  800446:	00 00 00 
+  800449:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80044b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800450:	48 b8 a2 14 80 00 00 	movabs $0x8014a2,%rax
+  800457:	00 00 00 
+  80045a:	ff d0                	call   *%rax
+}
+  80045c:	5d                   	pop    %rbp
+  80045d:	c3                   	ret
+
+000000000080045e <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80045e:	55                   	push   %rbp
+  80045f:	48 89 e5             	mov    %rsp,%rbp
+  800462:	41 56                	push   %r14
+  800464:	41 55                	push   %r13
+  800466:	41 54                	push   %r12
+  800468:	53                   	push   %rbx
+  800469:	48 83 ec 50          	sub    $0x50,%rsp
+  80046d:	49 89 fc             	mov    %rdi,%r12
+  800470:	41 89 f5             	mov    %esi,%r13d
+  800473:	48 89 d3             	mov    %rdx,%rbx
+  800476:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80047a:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80047e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800482:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800489:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80048d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800491:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800495:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800499:	48 b8 38 40 80 00 00 	movabs $0x804038,%rax
+  8004a0:	00 00 00 
+  8004a3:	4c 8b 30             	mov    (%rax),%r14
+  8004a6:	48 b8 0d 15 80 00 00 	movabs $0x80150d,%rax
+  8004ad:	00 00 00 
+  8004b0:	ff d0                	call   *%rax
+  8004b2:	89 c6                	mov    %eax,%esi
+  8004b4:	45 89 e8             	mov    %r13d,%r8d
+  8004b7:	4c 89 e1             	mov    %r12,%rcx
+  8004ba:	4c 89 f2             	mov    %r14,%rdx
+  8004bd:	48 bf c0 2f 80 00 00 	movabs $0x802fc0,%rdi
+  8004c4:	00 00 00 
+  8004c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004cc:	49 bc ae 05 80 00 00 	movabs $0x8005ae,%r12
+  8004d3:	00 00 00 
+  8004d6:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004d9:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004dd:	48 89 df             	mov    %rbx,%rdi
+  8004e0:	48 b8 4a 05 80 00 00 	movabs $0x80054a,%rax
+  8004e7:	00 00 00 
+  8004ea:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004ec:	48 bf a6 2f 80 00 00 	movabs $0x802fa6,%rdi
+  8004f3:	00 00 00 
+  8004f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fb:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004fe:	cc                   	int3
+  8004ff:	eb fd                	jmp    8004fe <_panic+0xa0>
+
+0000000000800501 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800501:	55                   	push   %rbp
+  800502:	48 89 e5             	mov    %rsp,%rbp
+  800505:	53                   	push   %rbx
+  800506:	48 83 ec 08          	sub    $0x8,%rsp
+  80050a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80050d:	8b 06                	mov    (%rsi),%eax
+  80050f:	8d 50 01             	lea    0x1(%rax),%edx
+  800512:	89 16                	mov    %edx,(%rsi)
+  800514:	48 98                	cltq
+  800516:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80051b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800521:	74 0a                	je     80052d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800523:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800527:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80052b:	c9                   	leave
+  80052c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80052d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800531:	be ff 00 00 00       	mov    $0xff,%esi
+  800536:	48 b8 44 14 80 00 00 	movabs $0x801444,%rax
+  80053d:	00 00 00 
+  800540:	ff d0                	call   *%rax
+        state->offset = 0;
+  800542:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800548:	eb d9                	jmp    800523 <putch+0x22>
+
+000000000080054a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80054a:	55                   	push   %rbp
+  80054b:	48 89 e5             	mov    %rsp,%rbp
+  80054e:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800555:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800558:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80055f:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800564:	b8 00 00 00 00       	mov    $0x0,%eax
+  800569:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80056c:	48 89 f1             	mov    %rsi,%rcx
+  80056f:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800576:	48 bf 01 05 80 00 00 	movabs $0x800501,%rdi
+  80057d:	00 00 00 
+  800580:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  800587:	00 00 00 
+  80058a:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80058c:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800593:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80059a:	48 b8 44 14 80 00 00 	movabs $0x801444,%rax
+  8005a1:	00 00 00 
+  8005a4:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8005a6:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8005ac:	c9                   	leave
+  8005ad:	c3                   	ret
+
+00000000008005ae <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8005ae:	55                   	push   %rbp
+  8005af:	48 89 e5             	mov    %rsp,%rbp
+  8005b2:	48 83 ec 50          	sub    $0x50,%rsp
+  8005b6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8005ba:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8005be:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005c2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005c6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005ca:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005d1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005dd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005e1:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005e5:	48 b8 4a 05 80 00 00 	movabs $0x80054a,%rax
+  8005ec:	00 00 00 
+  8005ef:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005f1:	c9                   	leave
+  8005f2:	c3                   	ret
+
+00000000008005f3 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005f3:	55                   	push   %rbp
+  8005f4:	48 89 e5             	mov    %rsp,%rbp
+  8005f7:	41 57                	push   %r15
+  8005f9:	41 56                	push   %r14
+  8005fb:	41 55                	push   %r13
+  8005fd:	41 54                	push   %r12
+  8005ff:	53                   	push   %rbx
+  800600:	48 83 ec 18          	sub    $0x18,%rsp
+  800604:	49 89 fc             	mov    %rdi,%r12
+  800607:	49 89 f5             	mov    %rsi,%r13
+  80060a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80060e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800611:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800614:	41 89 cf             	mov    %ecx,%r15d
+  800617:	4c 39 fa             	cmp    %r15,%rdx
+  80061a:	73 5b                	jae    800677 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80061c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800620:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800624:	85 db                	test   %ebx,%ebx
+  800626:	7e 0e                	jle    800636 <print_num+0x43>
+            putch(padc, put_arg);
+  800628:	4c 89 ee             	mov    %r13,%rsi
+  80062b:	44 89 f7             	mov    %r14d,%edi
+  80062e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800631:	83 eb 01             	sub    $0x1,%ebx
+  800634:	75 f2                	jne    800628 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800636:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80063a:	48 b9 f4 2f 80 00 00 	movabs $0x802ff4,%rcx
+  800641:	00 00 00 
+  800644:	48 b8 e3 2f 80 00 00 	movabs $0x802fe3,%rax
+  80064b:	00 00 00 
+  80064e:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800652:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800656:	ba 00 00 00 00       	mov    $0x0,%edx
+  80065b:	49 f7 f7             	div    %r15
+  80065e:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800662:	4c 89 ee             	mov    %r13,%rsi
+  800665:	41 ff d4             	call   *%r12
+}
+  800668:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80066c:	5b                   	pop    %rbx
+  80066d:	41 5c                	pop    %r12
+  80066f:	41 5d                	pop    %r13
+  800671:	41 5e                	pop    %r14
+  800673:	41 5f                	pop    %r15
+  800675:	5d                   	pop    %rbp
+  800676:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800677:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80067b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800680:	49 f7 f7             	div    %r15
+  800683:	48 83 ec 08          	sub    $0x8,%rsp
+  800687:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80068b:	52                   	push   %rdx
+  80068c:	45 0f be c9          	movsbl %r9b,%r9d
+  800690:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800694:	48 89 c2             	mov    %rax,%rdx
+  800697:	48 b8 f3 05 80 00 00 	movabs $0x8005f3,%rax
+  80069e:	00 00 00 
+  8006a1:	ff d0                	call   *%rax
+  8006a3:	48 83 c4 10          	add    $0x10,%rsp
+  8006a7:	eb 8d                	jmp    800636 <print_num+0x43>
+
+00000000008006a9 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8006a9:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8006ad:	48 8b 06             	mov    (%rsi),%rax
+  8006b0:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8006b4:	73 0a                	jae    8006c0 <sprintputch+0x17>
+        *state->start++ = ch;
+  8006b6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006ba:	48 89 16             	mov    %rdx,(%rsi)
+  8006bd:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006c0:	c3                   	ret
+
+00000000008006c1 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006c1:	55                   	push   %rbp
+  8006c2:	48 89 e5             	mov    %rsp,%rbp
+  8006c5:	48 83 ec 50          	sub    $0x50,%rsp
+  8006c9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006cd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006d1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006d5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006dc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006e8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006ec:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006f0:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  8006f7:	00 00 00 
+  8006fa:	ff d0                	call   *%rax
+}
+  8006fc:	c9                   	leave
+  8006fd:	c3                   	ret
+
+00000000008006fe <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006fe:	55                   	push   %rbp
+  8006ff:	48 89 e5             	mov    %rsp,%rbp
+  800702:	41 57                	push   %r15
+  800704:	41 56                	push   %r14
+  800706:	41 55                	push   %r13
+  800708:	41 54                	push   %r12
+  80070a:	53                   	push   %rbx
+  80070b:	48 83 ec 38          	sub    $0x38,%rsp
+  80070f:	49 89 fe             	mov    %rdi,%r14
+  800712:	49 89 f5             	mov    %rsi,%r13
+  800715:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800718:	48 8b 01             	mov    (%rcx),%rax
+  80071b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80071f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800723:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800727:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80072b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80072f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800733:	0f b6 3b             	movzbl (%rbx),%edi
+  800736:	40 80 ff 25          	cmp    $0x25,%dil
+  80073a:	74 18                	je     800754 <vprintfmt+0x56>
+            if (!ch) return;
+  80073c:	40 84 ff             	test   %dil,%dil
+  80073f:	0f 84 b1 06 00 00    	je     800df6 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800745:	40 0f b6 ff          	movzbl %dil,%edi
+  800749:	4c 89 ee             	mov    %r13,%rsi
+  80074c:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80074f:	4c 89 e3             	mov    %r12,%rbx
+  800752:	eb db                	jmp    80072f <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800754:	be 00 00 00 00       	mov    $0x0,%esi
+  800759:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80075d:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800762:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800768:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80076f:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800773:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800778:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80077d:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800780:	83 e8 23             	sub    $0x23,%eax
+  800783:	3c 57                	cmp    $0x57,%al
+  800785:	0f 87 51 06 00 00    	ja     800ddc <vprintfmt+0x6de>
+  80078b:	0f b6 c0             	movzbl %al,%eax
+  80078e:	48 b9 a0 31 80 00 00 	movabs $0x8031a0,%rcx
+  800795:	00 00 00 
+  800798:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80079b:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80079e:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8007a2:	eb cf                	jmp    800773 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8007a4:	49 89 dc             	mov    %rbx,%r12
+  8007a7:	be 01 00 00 00       	mov    $0x1,%esi
+  8007ac:	eb c5                	jmp    800773 <vprintfmt+0x75>
+            padc = ch;
+  8007ae:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8007b2:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007b5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007b8:	eb b9                	jmp    800773 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c0:	77 24                	ja     8007e6 <vprintfmt+0xe8>
+  8007c2:	89 c1                	mov    %eax,%ecx
+  8007c4:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007c8:	83 c0 08             	add    $0x8,%eax
+  8007cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ce:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007d1:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007d4:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007d8:	79 99                	jns    800773 <vprintfmt+0x75>
+                width = precision;
+  8007da:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007de:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007e4:	eb 8d                	jmp    800773 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007e6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007ea:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f2:	eb da                	jmp    8007ce <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007f4:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007f9:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007fd:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800803:	3c 39                	cmp    $0x39,%al
+  800805:	77 1c                	ja     800823 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800807:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80080b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80080f:	0f b6 c0             	movzbl %al,%eax
+  800812:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800817:	0f b6 03             	movzbl (%rbx),%eax
+  80081a:	3c 39                	cmp    $0x39,%al
+  80081c:	76 e9                	jbe    800807 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80081e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800821:	eb b1                	jmp    8007d4 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800823:	49 89 dc             	mov    %rbx,%r12
+  800826:	eb ac                	jmp    8007d4 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800828:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80082b:	85 c9                	test   %ecx,%ecx
+  80082d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800832:	0f 49 c1             	cmovns %ecx,%eax
+  800835:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800838:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80083b:	e9 33 ff ff ff       	jmp    800773 <vprintfmt+0x75>
+            lflag++;
+  800840:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800843:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800846:	e9 28 ff ff ff       	jmp    800773 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80084b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084e:	83 f8 2f             	cmp    $0x2f,%eax
+  800851:	77 19                	ja     80086c <vprintfmt+0x16e>
+  800853:	89 c2                	mov    %eax,%edx
+  800855:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800859:	83 c0 08             	add    $0x8,%eax
+  80085c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085f:	8b 3a                	mov    (%rdx),%edi
+  800861:	4c 89 ee             	mov    %r13,%rsi
+  800864:	41 ff d6             	call   *%r14
+            break;
+  800867:	e9 c3 fe ff ff       	jmp    80072f <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80086c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800870:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800874:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800878:	eb e5                	jmp    80085f <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80087a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087d:	83 f8 2f             	cmp    $0x2f,%eax
+  800880:	77 5a                	ja     8008dc <vprintfmt+0x1de>
+  800882:	89 c2                	mov    %eax,%edx
+  800884:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800888:	83 c0 08             	add    $0x8,%eax
+  80088b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80088e:	8b 02                	mov    (%rdx),%eax
+  800890:	89 c1                	mov    %eax,%ecx
+  800892:	f7 d9                	neg    %ecx
+  800894:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800897:	83 f9 15             	cmp    $0x15,%ecx
+  80089a:	7f 4e                	jg     8008ea <vprintfmt+0x1ec>
+  80089c:	48 63 c1             	movslq %ecx,%rax
+  80089f:	48 ba 60 34 80 00 00 	movabs $0x803460,%rdx
+  8008a6:	00 00 00 
+  8008a9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8008ad:	48 85 c0             	test   %rax,%rax
+  8008b0:	74 38                	je     8008ea <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8008b2:	48 89 c1             	mov    %rax,%rcx
+  8008b5:	48 ba 39 36 80 00 00 	movabs $0x803639,%rdx
+  8008bc:	00 00 00 
+  8008bf:	4c 89 ee             	mov    %r13,%rsi
+  8008c2:	4c 89 f7             	mov    %r14,%rdi
+  8008c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ca:	49 b8 c1 06 80 00 00 	movabs $0x8006c1,%r8
+  8008d1:	00 00 00 
+  8008d4:	41 ff d0             	call   *%r8
+  8008d7:	e9 53 fe ff ff       	jmp    80072f <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e8:	eb a4                	jmp    80088e <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008ea:	48 ba 0c 30 80 00 00 	movabs $0x80300c,%rdx
+  8008f1:	00 00 00 
+  8008f4:	4c 89 ee             	mov    %r13,%rsi
+  8008f7:	4c 89 f7             	mov    %r14,%rdi
+  8008fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ff:	49 b8 c1 06 80 00 00 	movabs $0x8006c1,%r8
+  800906:	00 00 00 
+  800909:	41 ff d0             	call   *%r8
+  80090c:	e9 1e fe ff ff       	jmp    80072f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800911:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800914:	83 f8 2f             	cmp    $0x2f,%eax
+  800917:	77 6c                	ja     800985 <vprintfmt+0x287>
+  800919:	89 c2                	mov    %eax,%edx
+  80091b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091f:	83 c0 08             	add    $0x8,%eax
+  800922:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800925:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800928:	48 85 d2             	test   %rdx,%rdx
+  80092b:	48 b8 05 30 80 00 00 	movabs $0x803005,%rax
+  800932:	00 00 00 
+  800935:	48 0f 45 c2          	cmovne %rdx,%rax
+  800939:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80093d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800941:	7e 06                	jle    800949 <vprintfmt+0x24b>
+  800943:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800947:	75 4a                	jne    800993 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800949:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80094d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800951:	0f b6 00             	movzbl (%rax),%eax
+  800954:	84 c0                	test   %al,%al
+  800956:	0f 85 9a 00 00 00    	jne    8009f6 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80095c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80095f:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800963:	85 c0                	test   %eax,%eax
+  800965:	0f 8e c4 fd ff ff    	jle    80072f <vprintfmt+0x31>
+  80096b:	4c 89 ee             	mov    %r13,%rsi
+  80096e:	bf 20 00 00 00       	mov    $0x20,%edi
+  800973:	41 ff d6             	call   *%r14
+  800976:	41 83 ec 01          	sub    $0x1,%r12d
+  80097a:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80097e:	75 eb                	jne    80096b <vprintfmt+0x26d>
+  800980:	e9 aa fd ff ff       	jmp    80072f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800985:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800989:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800991:	eb 92                	jmp    800925 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800993:	49 63 f7             	movslq %r15d,%rsi
+  800996:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80099a:	48 b8 b0 0e 80 00 00 	movabs $0x800eb0,%rax
+  8009a1:	00 00 00 
+  8009a4:	ff d0                	call   *%rax
+  8009a6:	48 89 c2             	mov    %rax,%rdx
+  8009a9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009ac:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8009ae:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8009b1:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8009b4:	85 c0                	test   %eax,%eax
+  8009b6:	7e 91                	jle    800949 <vprintfmt+0x24b>
+  8009b8:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8009bd:	4c 89 ee             	mov    %r13,%rsi
+  8009c0:	44 89 e7             	mov    %r12d,%edi
+  8009c3:	41 ff d6             	call   *%r14
+  8009c6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009ca:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009cd:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009d0:	75 eb                	jne    8009bd <vprintfmt+0x2bf>
+  8009d2:	e9 72 ff ff ff       	jmp    800949 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009d7:	0f b6 f8             	movzbl %al,%edi
+  8009da:	4c 89 ee             	mov    %r13,%rsi
+  8009dd:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009e0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009e4:	49 83 c4 01          	add    $0x1,%r12
+  8009e8:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009ee:	84 c0                	test   %al,%al
+  8009f0:	0f 84 66 ff ff ff    	je     80095c <vprintfmt+0x25e>
+  8009f6:	45 85 ff             	test   %r15d,%r15d
+  8009f9:	78 0a                	js     800a05 <vprintfmt+0x307>
+  8009fb:	41 83 ef 01          	sub    $0x1,%r15d
+  8009ff:	0f 88 57 ff ff ff    	js     80095c <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a05:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a09:	74 cc                	je     8009d7 <vprintfmt+0x2d9>
+  800a0b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a0e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a13:	80 fa 5e             	cmp    $0x5e,%dl
+  800a16:	77 c2                	ja     8009da <vprintfmt+0x2dc>
+  800a18:	eb bd                	jmp    8009d7 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a1a:	40 84 f6             	test   %sil,%sil
+  800a1d:	75 26                	jne    800a45 <vprintfmt+0x347>
+    switch (lflag) {
+  800a1f:	85 d2                	test   %edx,%edx
+  800a21:	74 59                	je     800a7c <vprintfmt+0x37e>
+  800a23:	83 fa 01             	cmp    $0x1,%edx
+  800a26:	74 7b                	je     800aa3 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2e:	0f 87 96 00 00 00    	ja     800aca <vprintfmt+0x3cc>
+  800a34:	89 c2                	mov    %eax,%edx
+  800a36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3a:	83 c0 08             	add    $0x8,%eax
+  800a3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a40:	4c 8b 22             	mov    (%rdx),%r12
+  800a43:	eb 17                	jmp    800a5c <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a48:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4b:	77 21                	ja     800a6e <vprintfmt+0x370>
+  800a4d:	89 c2                	mov    %eax,%edx
+  800a4f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a53:	83 c0 08             	add    $0x8,%eax
+  800a56:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a59:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a5c:	4d 85 e4             	test   %r12,%r12
+  800a5f:	78 7a                	js     800adb <vprintfmt+0x3dd>
+            num = i;
+  800a61:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a64:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a69:	e9 50 02 00 00       	jmp    800cbe <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7a:	eb dd                	jmp    800a59 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a82:	77 11                	ja     800a95 <vprintfmt+0x397>
+  800a84:	89 c2                	mov    %eax,%edx
+  800a86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8a:	83 c0 08             	add    $0x8,%eax
+  800a8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a90:	4c 63 22             	movslq (%rdx),%r12
+  800a93:	eb c7                	jmp    800a5c <vprintfmt+0x35e>
+  800a95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a99:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa1:	eb ed                	jmp    800a90 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800aa3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa6:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa9:	77 11                	ja     800abc <vprintfmt+0x3be>
+  800aab:	89 c2                	mov    %eax,%edx
+  800aad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab1:	83 c0 08             	add    $0x8,%eax
+  800ab4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab7:	4c 8b 22             	mov    (%rdx),%r12
+  800aba:	eb a0                	jmp    800a5c <vprintfmt+0x35e>
+  800abc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac8:	eb ed                	jmp    800ab7 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800aca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ace:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad6:	e9 65 ff ff ff       	jmp    800a40 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800adb:	4c 89 ee             	mov    %r13,%rsi
+  800ade:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ae3:	41 ff d6             	call   *%r14
+                i = -i;
+  800ae6:	49 f7 dc             	neg    %r12
+  800ae9:	e9 73 ff ff ff       	jmp    800a61 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800aee:	40 84 f6             	test   %sil,%sil
+  800af1:	75 32                	jne    800b25 <vprintfmt+0x427>
+    switch (lflag) {
+  800af3:	85 d2                	test   %edx,%edx
+  800af5:	74 5d                	je     800b54 <vprintfmt+0x456>
+  800af7:	83 fa 01             	cmp    $0x1,%edx
+  800afa:	0f 84 82 00 00 00    	je     800b82 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800b00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b03:	83 f8 2f             	cmp    $0x2f,%eax
+  800b06:	0f 87 a5 00 00 00    	ja     800bb1 <vprintfmt+0x4b3>
+  800b0c:	89 c2                	mov    %eax,%edx
+  800b0e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b12:	83 c0 08             	add    $0x8,%eax
+  800b15:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b18:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b1b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b20:	e9 99 01 00 00       	jmp    800cbe <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b28:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2b:	77 19                	ja     800b46 <vprintfmt+0x448>
+  800b2d:	89 c2                	mov    %eax,%edx
+  800b2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b33:	83 c0 08             	add    $0x8,%eax
+  800b36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b39:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b3c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b41:	e9 78 01 00 00       	jmp    800cbe <vprintfmt+0x5c0>
+  800b46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b52:	eb e5                	jmp    800b39 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b54:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b57:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5a:	77 18                	ja     800b74 <vprintfmt+0x476>
+  800b5c:	89 c2                	mov    %eax,%edx
+  800b5e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b62:	83 c0 08             	add    $0x8,%eax
+  800b65:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b68:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b6a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b6f:	e9 4a 01 00 00       	jmp    800cbe <vprintfmt+0x5c0>
+  800b74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b80:	eb e6                	jmp    800b68 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b82:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b85:	83 f8 2f             	cmp    $0x2f,%eax
+  800b88:	77 19                	ja     800ba3 <vprintfmt+0x4a5>
+  800b8a:	89 c2                	mov    %eax,%edx
+  800b8c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b90:	83 c0 08             	add    $0x8,%eax
+  800b93:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b96:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b99:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b9e:	e9 1b 01 00 00       	jmp    800cbe <vprintfmt+0x5c0>
+  800ba3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800baf:	eb e5                	jmp    800b96 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800bb1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbd:	e9 56 ff ff ff       	jmp    800b18 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800bc2:	40 84 f6             	test   %sil,%sil
+  800bc5:	75 2e                	jne    800bf5 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800bc7:	85 d2                	test   %edx,%edx
+  800bc9:	74 59                	je     800c24 <vprintfmt+0x526>
+  800bcb:	83 fa 01             	cmp    $0x1,%edx
+  800bce:	74 7f                	je     800c4f <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800bd0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bd3:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd6:	0f 87 9f 00 00 00    	ja     800c7b <vprintfmt+0x57d>
+  800bdc:	89 c2                	mov    %eax,%edx
+  800bde:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be2:	83 c0 08             	add    $0x8,%eax
+  800be5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800be8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800beb:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bf0:	e9 c9 00 00 00       	jmp    800cbe <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bf5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf8:	83 f8 2f             	cmp    $0x2f,%eax
+  800bfb:	77 19                	ja     800c16 <vprintfmt+0x518>
+  800bfd:	89 c2                	mov    %eax,%edx
+  800bff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c03:	83 c0 08             	add    $0x8,%eax
+  800c06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c09:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c0c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c11:	e9 a8 00 00 00       	jmp    800cbe <vprintfmt+0x5c0>
+  800c16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c22:	eb e5                	jmp    800c09 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c24:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c27:	83 f8 2f             	cmp    $0x2f,%eax
+  800c2a:	77 15                	ja     800c41 <vprintfmt+0x543>
+  800c2c:	89 c2                	mov    %eax,%edx
+  800c2e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c32:	83 c0 08             	add    $0x8,%eax
+  800c35:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c38:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c3a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c3f:	eb 7d                	jmp    800cbe <vprintfmt+0x5c0>
+  800c41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c4d:	eb e9                	jmp    800c38 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c52:	83 f8 2f             	cmp    $0x2f,%eax
+  800c55:	77 16                	ja     800c6d <vprintfmt+0x56f>
+  800c57:	89 c2                	mov    %eax,%edx
+  800c59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c5d:	83 c0 08             	add    $0x8,%eax
+  800c60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c63:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c66:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c6b:	eb 51                	jmp    800cbe <vprintfmt+0x5c0>
+  800c6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c79:	eb e8                	jmp    800c63 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c87:	e9 5c ff ff ff       	jmp    800be8 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c8c:	4c 89 ee             	mov    %r13,%rsi
+  800c8f:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c94:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c97:	4c 89 ee             	mov    %r13,%rsi
+  800c9a:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c9f:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800ca2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca8:	77 47                	ja     800cf1 <vprintfmt+0x5f3>
+  800caa:	89 c2                	mov    %eax,%edx
+  800cac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb0:	83 c0 08             	add    $0x8,%eax
+  800cb3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cb9:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800cbe:	48 83 ec 08          	sub    $0x8,%rsp
+  800cc2:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800cc6:	0f 94 c0             	sete   %al
+  800cc9:	0f b6 c0             	movzbl %al,%eax
+  800ccc:	50                   	push   %rax
+  800ccd:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800cd2:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800cd6:	4c 89 ee             	mov    %r13,%rsi
+  800cd9:	4c 89 f7             	mov    %r14,%rdi
+  800cdc:	48 b8 f3 05 80 00 00 	movabs $0x8005f3,%rax
+  800ce3:	00 00 00 
+  800ce6:	ff d0                	call   *%rax
+            break;
+  800ce8:	48 83 c4 10          	add    $0x10,%rsp
+  800cec:	e9 3e fa ff ff       	jmp    80072f <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cf1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cfd:	eb b7                	jmp    800cb6 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800cff:	40 84 f6             	test   %sil,%sil
+  800d02:	75 2b                	jne    800d2f <vprintfmt+0x631>
+    switch (lflag) {
+  800d04:	85 d2                	test   %edx,%edx
+  800d06:	74 56                	je     800d5e <vprintfmt+0x660>
+  800d08:	83 fa 01             	cmp    $0x1,%edx
+  800d0b:	74 7f                	je     800d8c <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d10:	83 f8 2f             	cmp    $0x2f,%eax
+  800d13:	0f 87 a2 00 00 00    	ja     800dbb <vprintfmt+0x6bd>
+  800d19:	89 c2                	mov    %eax,%edx
+  800d1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d1f:	83 c0 08             	add    $0x8,%eax
+  800d22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d25:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d28:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d2d:	eb 8f                	jmp    800cbe <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d32:	83 f8 2f             	cmp    $0x2f,%eax
+  800d35:	77 19                	ja     800d50 <vprintfmt+0x652>
+  800d37:	89 c2                	mov    %eax,%edx
+  800d39:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d3d:	83 c0 08             	add    $0x8,%eax
+  800d40:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d43:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d46:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d4b:	e9 6e ff ff ff       	jmp    800cbe <vprintfmt+0x5c0>
+  800d50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d5c:	eb e5                	jmp    800d43 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d5e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d61:	83 f8 2f             	cmp    $0x2f,%eax
+  800d64:	77 18                	ja     800d7e <vprintfmt+0x680>
+  800d66:	89 c2                	mov    %eax,%edx
+  800d68:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d6c:	83 c0 08             	add    $0x8,%eax
+  800d6f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d72:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d74:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d79:	e9 40 ff ff ff       	jmp    800cbe <vprintfmt+0x5c0>
+  800d7e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d82:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d8a:	eb e6                	jmp    800d72 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d8f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d92:	77 19                	ja     800dad <vprintfmt+0x6af>
+  800d94:	89 c2                	mov    %eax,%edx
+  800d96:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d9a:	83 c0 08             	add    $0x8,%eax
+  800d9d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800da0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800da3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800da8:	e9 11 ff ff ff       	jmp    800cbe <vprintfmt+0x5c0>
+  800dad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800db1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800db5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800db9:	eb e5                	jmp    800da0 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800dbb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dbf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dc3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc7:	e9 59 ff ff ff       	jmp    800d25 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800dcc:	4c 89 ee             	mov    %r13,%rsi
+  800dcf:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dd4:	41 ff d6             	call   *%r14
+            break;
+  800dd7:	e9 53 f9 ff ff       	jmp    80072f <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ddc:	4c 89 ee             	mov    %r13,%rsi
+  800ddf:	bf 25 00 00 00       	mov    $0x25,%edi
+  800de4:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800de7:	48 83 eb 01          	sub    $0x1,%rbx
+  800deb:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800def:	75 f6                	jne    800de7 <vprintfmt+0x6e9>
+  800df1:	e9 39 f9 ff ff       	jmp    80072f <vprintfmt+0x31>
+}
+  800df6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800dfa:	5b                   	pop    %rbx
+  800dfb:	41 5c                	pop    %r12
+  800dfd:	41 5d                	pop    %r13
+  800dff:	41 5e                	pop    %r14
+  800e01:	41 5f                	pop    %r15
+  800e03:	5d                   	pop    %rbp
+  800e04:	c3                   	ret
+
+0000000000800e05 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e05:	55                   	push   %rbp
+  800e06:	48 89 e5             	mov    %rsp,%rbp
+  800e09:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e0d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e11:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e16:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e1a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e21:	48 85 ff             	test   %rdi,%rdi
+  800e24:	74 2b                	je     800e51 <vsnprintf+0x4c>
+  800e26:	48 85 f6             	test   %rsi,%rsi
+  800e29:	74 26                	je     800e51 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e2b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e2f:	48 bf a9 06 80 00 00 	movabs $0x8006a9,%rdi
+  800e36:	00 00 00 
+  800e39:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  800e40:	00 00 00 
+  800e43:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e49:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e4c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e4f:	c9                   	leave
+  800e50:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e51:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e56:	eb f7                	jmp    800e4f <vsnprintf+0x4a>
+
+0000000000800e58 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e58:	55                   	push   %rbp
+  800e59:	48 89 e5             	mov    %rsp,%rbp
+  800e5c:	48 83 ec 50          	sub    $0x50,%rsp
+  800e60:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e64:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e68:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e6c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e73:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e7b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e7f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e83:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e87:	48 b8 05 0e 80 00 00 	movabs $0x800e05,%rax
+  800e8e:	00 00 00 
+  800e91:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e93:	c9                   	leave
+  800e94:	c3                   	ret
+
+0000000000800e95 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e95:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e98:	74 10                	je     800eaa <strlen+0x15>
+    size_t n = 0;
+  800e9a:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e9f:	48 83 c0 01          	add    $0x1,%rax
+  800ea3:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ea7:	75 f6                	jne    800e9f <strlen+0xa>
+  800ea9:	c3                   	ret
+    size_t n = 0;
+  800eaa:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800eaf:	c3                   	ret
+
+0000000000800eb0 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800eb0:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800eb3:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800eb8:	48 85 f6             	test   %rsi,%rsi
+  800ebb:	74 11                	je     800ece <strnlen+0x1e>
+  800ebd:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ec1:	74 0c                	je     800ecf <strnlen+0x1f>
+  800ec3:	48 83 c2 01          	add    $0x1,%rdx
+  800ec7:	48 39 d0             	cmp    %rdx,%rax
+  800eca:	75 f1                	jne    800ebd <strnlen+0xd>
+  800ecc:	eb 04                	jmp    800ed2 <strnlen+0x22>
+  800ece:	c3                   	ret
+  800ecf:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ed2:	c3                   	ret
+
+0000000000800ed3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ed3:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ed6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800edb:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800edf:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ee2:	48 83 c2 01          	add    $0x1,%rdx
+  800ee6:	84 c9                	test   %cl,%cl
+  800ee8:	75 f1                	jne    800edb <strcpy+0x8>
+        ;
+    return res;
+}
+  800eea:	c3                   	ret
+
+0000000000800eeb <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800eeb:	55                   	push   %rbp
+  800eec:	48 89 e5             	mov    %rsp,%rbp
+  800eef:	41 54                	push   %r12
+  800ef1:	53                   	push   %rbx
+  800ef2:	48 89 fb             	mov    %rdi,%rbx
+  800ef5:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ef8:	48 b8 95 0e 80 00 00 	movabs $0x800e95,%rax
+  800eff:	00 00 00 
+  800f02:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f04:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f08:	4c 89 e6             	mov    %r12,%rsi
+  800f0b:	48 b8 d3 0e 80 00 00 	movabs $0x800ed3,%rax
+  800f12:	00 00 00 
+  800f15:	ff d0                	call   *%rax
+    return dst;
+}
+  800f17:	48 89 d8             	mov    %rbx,%rax
+  800f1a:	5b                   	pop    %rbx
+  800f1b:	41 5c                	pop    %r12
+  800f1d:	5d                   	pop    %rbp
+  800f1e:	c3                   	ret
+
+0000000000800f1f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f1f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f22:	48 85 d2             	test   %rdx,%rdx
+  800f25:	74 1f                	je     800f46 <strncpy+0x27>
+  800f27:	48 01 fa             	add    %rdi,%rdx
+  800f2a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f2d:	48 83 c1 01          	add    $0x1,%rcx
+  800f31:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f35:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f39:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f3d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f41:	48 39 ca             	cmp    %rcx,%rdx
+  800f44:	75 e7                	jne    800f2d <strncpy+0xe>
+    }
+    return ret;
+}
+  800f46:	c3                   	ret
+
+0000000000800f47 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f47:	48 89 f8             	mov    %rdi,%rax
+  800f4a:	48 85 d2             	test   %rdx,%rdx
+  800f4d:	74 24                	je     800f73 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f4f:	48 83 ea 01          	sub    $0x1,%rdx
+  800f53:	74 1b                	je     800f70 <strlcpy+0x29>
+  800f55:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f59:	0f b6 16             	movzbl (%rsi),%edx
+  800f5c:	84 d2                	test   %dl,%dl
+  800f5e:	74 10                	je     800f70 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f60:	48 83 c6 01          	add    $0x1,%rsi
+  800f64:	48 83 c0 01          	add    $0x1,%rax
+  800f68:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f6b:	48 39 c8             	cmp    %rcx,%rax
+  800f6e:	75 e9                	jne    800f59 <strlcpy+0x12>
+        *dst = '\0';
+  800f70:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f73:	48 29 f8             	sub    %rdi,%rax
+}
+  800f76:	c3                   	ret
+
+0000000000800f77 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f77:	0f b6 07             	movzbl (%rdi),%eax
+  800f7a:	84 c0                	test   %al,%al
+  800f7c:	74 13                	je     800f91 <strcmp+0x1a>
+  800f7e:	38 06                	cmp    %al,(%rsi)
+  800f80:	75 0f                	jne    800f91 <strcmp+0x1a>
+  800f82:	48 83 c7 01          	add    $0x1,%rdi
+  800f86:	48 83 c6 01          	add    $0x1,%rsi
+  800f8a:	0f b6 07             	movzbl (%rdi),%eax
+  800f8d:	84 c0                	test   %al,%al
+  800f8f:	75 ed                	jne    800f7e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f91:	0f b6 c0             	movzbl %al,%eax
+  800f94:	0f b6 16             	movzbl (%rsi),%edx
+  800f97:	29 d0                	sub    %edx,%eax
+}
+  800f99:	c3                   	ret
+
+0000000000800f9a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f9a:	48 85 d2             	test   %rdx,%rdx
+  800f9d:	74 1f                	je     800fbe <strncmp+0x24>
+  800f9f:	0f b6 07             	movzbl (%rdi),%eax
+  800fa2:	84 c0                	test   %al,%al
+  800fa4:	74 1e                	je     800fc4 <strncmp+0x2a>
+  800fa6:	3a 06                	cmp    (%rsi),%al
+  800fa8:	75 1a                	jne    800fc4 <strncmp+0x2a>
+  800faa:	48 83 c7 01          	add    $0x1,%rdi
+  800fae:	48 83 c6 01          	add    $0x1,%rsi
+  800fb2:	48 83 ea 01          	sub    $0x1,%rdx
+  800fb6:	75 e7                	jne    800f9f <strncmp+0x5>
+
+    if (!n) return 0;
+  800fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fbd:	c3                   	ret
+  800fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc3:	c3                   	ret
+  800fc4:	48 85 d2             	test   %rdx,%rdx
+  800fc7:	74 09                	je     800fd2 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fc9:	0f b6 07             	movzbl (%rdi),%eax
+  800fcc:	0f b6 16             	movzbl (%rsi),%edx
+  800fcf:	29 d0                	sub    %edx,%eax
+  800fd1:	c3                   	ret
+    if (!n) return 0;
+  800fd2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fd7:	c3                   	ret
+
+0000000000800fd8 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fd8:	0f b6 17             	movzbl (%rdi),%edx
+  800fdb:	84 d2                	test   %dl,%dl
+  800fdd:	74 18                	je     800ff7 <strchr+0x1f>
+        if (*str == c) {
+  800fdf:	0f be d2             	movsbl %dl,%edx
+  800fe2:	39 f2                	cmp    %esi,%edx
+  800fe4:	74 17                	je     800ffd <strchr+0x25>
+    for (; *str; str++) {
+  800fe6:	48 83 c7 01          	add    $0x1,%rdi
+  800fea:	0f b6 17             	movzbl (%rdi),%edx
+  800fed:	84 d2                	test   %dl,%dl
+  800fef:	75 ee                	jne    800fdf <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ff1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff6:	c3                   	ret
+  800ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ffc:	c3                   	ret
+  800ffd:	48 89 f8             	mov    %rdi,%rax
+}
+  801000:	c3                   	ret
+
+0000000000801001 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801001:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801004:	0f b6 17             	movzbl (%rdi),%edx
+  801007:	84 d2                	test   %dl,%dl
+  801009:	74 13                	je     80101e <strfind+0x1d>
+  80100b:	0f be d2             	movsbl %dl,%edx
+  80100e:	39 f2                	cmp    %esi,%edx
+  801010:	74 0b                	je     80101d <strfind+0x1c>
+  801012:	48 83 c0 01          	add    $0x1,%rax
+  801016:	0f b6 10             	movzbl (%rax),%edx
+  801019:	84 d2                	test   %dl,%dl
+  80101b:	75 ee                	jne    80100b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80101d:	c3                   	ret
+  80101e:	c3                   	ret
+
+000000000080101f <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80101f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801022:	48 89 f8             	mov    %rdi,%rax
+  801025:	48 f7 d8             	neg    %rax
+  801028:	83 e0 07             	and    $0x7,%eax
+  80102b:	49 89 d1             	mov    %rdx,%r9
+  80102e:	49 29 c1             	sub    %rax,%r9
+  801031:	78 36                	js     801069 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801033:	40 0f b6 c6          	movzbl %sil,%eax
+  801037:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80103e:	01 01 01 
+  801041:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801045:	40 f6 c7 07          	test   $0x7,%dil
+  801049:	75 38                	jne    801083 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80104b:	4c 89 c9             	mov    %r9,%rcx
+  80104e:	48 c1 f9 03          	sar    $0x3,%rcx
+  801052:	74 0c                	je     801060 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801054:	fc                   	cld
+  801055:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801058:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80105c:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801060:	4d 85 c9             	test   %r9,%r9
+  801063:	75 45                	jne    8010aa <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801065:	4c 89 c0             	mov    %r8,%rax
+  801068:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801069:	48 85 d2             	test   %rdx,%rdx
+  80106c:	74 f7                	je     801065 <memset+0x46>
+  80106e:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801071:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801074:	48 83 c0 01          	add    $0x1,%rax
+  801078:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80107c:	48 39 c2             	cmp    %rax,%rdx
+  80107f:	75 f3                	jne    801074 <memset+0x55>
+  801081:	eb e2                	jmp    801065 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801083:	40 f6 c7 01          	test   $0x1,%dil
+  801087:	74 06                	je     80108f <memset+0x70>
+  801089:	88 07                	mov    %al,(%rdi)
+  80108b:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80108f:	40 f6 c7 02          	test   $0x2,%dil
+  801093:	74 07                	je     80109c <memset+0x7d>
+  801095:	66 89 07             	mov    %ax,(%rdi)
+  801098:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80109c:	40 f6 c7 04          	test   $0x4,%dil
+  8010a0:	74 a9                	je     80104b <memset+0x2c>
+  8010a2:	89 07                	mov    %eax,(%rdi)
+  8010a4:	48 83 c7 04          	add    $0x4,%rdi
+  8010a8:	eb a1                	jmp    80104b <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010aa:	41 f6 c1 04          	test   $0x4,%r9b
+  8010ae:	74 06                	je     8010b6 <memset+0x97>
+  8010b0:	89 07                	mov    %eax,(%rdi)
+  8010b2:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010b6:	41 f6 c1 02          	test   $0x2,%r9b
+  8010ba:	74 07                	je     8010c3 <memset+0xa4>
+  8010bc:	66 89 07             	mov    %ax,(%rdi)
+  8010bf:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010c3:	41 f6 c1 01          	test   $0x1,%r9b
+  8010c7:	74 9c                	je     801065 <memset+0x46>
+  8010c9:	88 07                	mov    %al,(%rdi)
+  8010cb:	eb 98                	jmp    801065 <memset+0x46>
+
+00000000008010cd <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010cd:	48 89 f8             	mov    %rdi,%rax
+  8010d0:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010d3:	48 39 fe             	cmp    %rdi,%rsi
+  8010d6:	73 3b                	jae    801113 <memmove+0x46>
+  8010d8:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010dc:	48 39 d7             	cmp    %rdx,%rdi
+  8010df:	73 32                	jae    801113 <memmove+0x46>
+        s += n;
+        d += n;
+  8010e1:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010e5:	48 89 d6             	mov    %rdx,%rsi
+  8010e8:	48 09 fe             	or     %rdi,%rsi
+  8010eb:	48 09 ce             	or     %rcx,%rsi
+  8010ee:	40 f6 c6 07          	test   $0x7,%sil
+  8010f2:	75 12                	jne    801106 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010f4:	48 83 ef 08          	sub    $0x8,%rdi
+  8010f8:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010fc:	48 c1 e9 03          	shr    $0x3,%rcx
+  801100:	fd                   	std
+  801101:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801104:	fc                   	cld
+  801105:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801106:	48 83 ef 01          	sub    $0x1,%rdi
+  80110a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80110e:	fd                   	std
+  80110f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801111:	eb f1                	jmp    801104 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801113:	48 89 f2             	mov    %rsi,%rdx
+  801116:	48 09 c2             	or     %rax,%rdx
+  801119:	48 09 ca             	or     %rcx,%rdx
+  80111c:	f6 c2 07             	test   $0x7,%dl
+  80111f:	75 0c                	jne    80112d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801121:	48 c1 e9 03          	shr    $0x3,%rcx
+  801125:	48 89 c7             	mov    %rax,%rdi
+  801128:	fc                   	cld
+  801129:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80112c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80112d:	48 89 c7             	mov    %rax,%rdi
+  801130:	fc                   	cld
+  801131:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801133:	c3                   	ret
+
+0000000000801134 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801134:	55                   	push   %rbp
+  801135:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801138:	48 b8 cd 10 80 00 00 	movabs $0x8010cd,%rax
+  80113f:	00 00 00 
+  801142:	ff d0                	call   *%rax
+}
+  801144:	5d                   	pop    %rbp
+  801145:	c3                   	ret
+
+0000000000801146 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801146:	55                   	push   %rbp
+  801147:	48 89 e5             	mov    %rsp,%rbp
+  80114a:	41 57                	push   %r15
+  80114c:	41 56                	push   %r14
+  80114e:	41 55                	push   %r13
+  801150:	41 54                	push   %r12
+  801152:	53                   	push   %rbx
+  801153:	48 83 ec 08          	sub    $0x8,%rsp
+  801157:	49 89 fe             	mov    %rdi,%r14
+  80115a:	49 89 f7             	mov    %rsi,%r15
+  80115d:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801160:	48 89 f7             	mov    %rsi,%rdi
+  801163:	48 b8 95 0e 80 00 00 	movabs $0x800e95,%rax
+  80116a:	00 00 00 
+  80116d:	ff d0                	call   *%rax
+  80116f:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801172:	48 89 de             	mov    %rbx,%rsi
+  801175:	4c 89 f7             	mov    %r14,%rdi
+  801178:	48 b8 b0 0e 80 00 00 	movabs $0x800eb0,%rax
+  80117f:	00 00 00 
+  801182:	ff d0                	call   *%rax
+  801184:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801187:	48 39 c3             	cmp    %rax,%rbx
+  80118a:	74 36                	je     8011c2 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80118c:	48 89 d8             	mov    %rbx,%rax
+  80118f:	4c 29 e8             	sub    %r13,%rax
+  801192:	49 39 c4             	cmp    %rax,%r12
+  801195:	73 31                	jae    8011c8 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801197:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80119c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011a0:	4c 89 fe             	mov    %r15,%rsi
+  8011a3:	48 b8 34 11 80 00 00 	movabs $0x801134,%rax
+  8011aa:	00 00 00 
+  8011ad:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8011af:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8011b3:	48 83 c4 08          	add    $0x8,%rsp
+  8011b7:	5b                   	pop    %rbx
+  8011b8:	41 5c                	pop    %r12
+  8011ba:	41 5d                	pop    %r13
+  8011bc:	41 5e                	pop    %r14
+  8011be:	41 5f                	pop    %r15
+  8011c0:	5d                   	pop    %rbp
+  8011c1:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011c2:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011c6:	eb eb                	jmp    8011b3 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011c8:	48 83 eb 01          	sub    $0x1,%rbx
+  8011cc:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011d0:	48 89 da             	mov    %rbx,%rdx
+  8011d3:	4c 89 fe             	mov    %r15,%rsi
+  8011d6:	48 b8 34 11 80 00 00 	movabs $0x801134,%rax
+  8011dd:	00 00 00 
+  8011e0:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011e2:	49 01 de             	add    %rbx,%r14
+  8011e5:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011ea:	eb c3                	jmp    8011af <strlcat+0x69>
+
+00000000008011ec <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011ec:	48 85 d2             	test   %rdx,%rdx
+  8011ef:	74 2d                	je     80121e <memcmp+0x32>
+  8011f1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011f6:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011fa:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011ff:	44 38 c1             	cmp    %r8b,%cl
+  801202:	75 0f                	jne    801213 <memcmp+0x27>
+    while (n-- > 0) {
+  801204:	48 83 c0 01          	add    $0x1,%rax
+  801208:	48 39 c2             	cmp    %rax,%rdx
+  80120b:	75 e9                	jne    8011f6 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80120d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801212:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801213:	0f b6 c1             	movzbl %cl,%eax
+  801216:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80121a:	44 29 c0             	sub    %r8d,%eax
+  80121d:	c3                   	ret
+    return 0;
+  80121e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801223:	c3                   	ret
+
+0000000000801224 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801224:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801228:	48 39 c7             	cmp    %rax,%rdi
+  80122b:	73 0f                	jae    80123c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80122d:	40 38 37             	cmp    %sil,(%rdi)
+  801230:	74 0e                	je     801240 <memfind+0x1c>
+    for (; src < end; src++) {
+  801232:	48 83 c7 01          	add    $0x1,%rdi
+  801236:	48 39 f8             	cmp    %rdi,%rax
+  801239:	75 f2                	jne    80122d <memfind+0x9>
+  80123b:	c3                   	ret
+  80123c:	48 89 f8             	mov    %rdi,%rax
+  80123f:	c3                   	ret
+  801240:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801243:	c3                   	ret
+
+0000000000801244 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801244:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801247:	0f b6 37             	movzbl (%rdi),%esi
+  80124a:	40 80 fe 20          	cmp    $0x20,%sil
+  80124e:	74 06                	je     801256 <strtol+0x12>
+  801250:	40 80 fe 09          	cmp    $0x9,%sil
+  801254:	75 13                	jne    801269 <strtol+0x25>
+  801256:	48 83 c7 01          	add    $0x1,%rdi
+  80125a:	0f b6 37             	movzbl (%rdi),%esi
+  80125d:	40 80 fe 20          	cmp    $0x20,%sil
+  801261:	74 f3                	je     801256 <strtol+0x12>
+  801263:	40 80 fe 09          	cmp    $0x9,%sil
+  801267:	74 ed                	je     801256 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801269:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80126c:	83 e0 fd             	and    $0xfffffffd,%eax
+  80126f:	3c 01                	cmp    $0x1,%al
+  801271:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801275:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80127b:	75 0f                	jne    80128c <strtol+0x48>
+  80127d:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801280:	74 14                	je     801296 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801282:	85 d2                	test   %edx,%edx
+  801284:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801289:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80128c:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801291:	4c 63 ca             	movslq %edx,%r9
+  801294:	eb 36                	jmp    8012cc <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801296:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80129a:	74 0f                	je     8012ab <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80129c:	85 d2                	test   %edx,%edx
+  80129e:	75 ec                	jne    80128c <strtol+0x48>
+        s++;
+  8012a0:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8012a4:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8012a9:	eb e1                	jmp    80128c <strtol+0x48>
+        s += 2;
+  8012ab:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8012af:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8012b4:	eb d6                	jmp    80128c <strtol+0x48>
+            dig -= '0';
+  8012b6:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8012b9:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012bd:	41 39 d0             	cmp    %edx,%r8d
+  8012c0:	7d 21                	jge    8012e3 <strtol+0x9f>
+        val = val * base + dig;
+  8012c2:	49 0f af c1          	imul   %r9,%rax
+  8012c6:	0f b6 c9             	movzbl %cl,%ecx
+  8012c9:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012cc:	48 83 c7 01          	add    $0x1,%rdi
+  8012d0:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012d4:	80 f9 39             	cmp    $0x39,%cl
+  8012d7:	76 dd                	jbe    8012b6 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012d9:	80 f9 7b             	cmp    $0x7b,%cl
+  8012dc:	77 05                	ja     8012e3 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012de:	83 e9 57             	sub    $0x57,%ecx
+  8012e1:	eb d6                	jmp    8012b9 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012e3:	4d 85 d2             	test   %r10,%r10
+  8012e6:	74 03                	je     8012eb <strtol+0xa7>
+  8012e8:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012eb:	48 89 c2             	mov    %rax,%rdx
+  8012ee:	48 f7 da             	neg    %rdx
+  8012f1:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012f5:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012f9:	c3                   	ret
+
+00000000008012fa <readline>:
+#define BUFLEN 1024
+
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt) {
+  8012fa:	55                   	push   %rbp
+  8012fb:	48 89 e5             	mov    %rsp,%rbp
+  8012fe:	41 57                	push   %r15
+  801300:	41 56                	push   %r14
+  801302:	41 55                	push   %r13
+  801304:	41 54                	push   %r12
+  801306:	53                   	push   %rbx
+  801307:	48 83 ec 08          	sub    $0x8,%rsp
+    if (prompt) {
+  80130b:	48 85 ff             	test   %rdi,%rdi
+  80130e:	74 23                	je     801333 <readline+0x39>
+#if JOS_KERNEL
+        cprintf("%s", prompt);
+#else
+        fprintf(1, "%s", prompt);
+  801310:	48 89 fa             	mov    %rdi,%rdx
+  801313:	48 be 39 36 80 00 00 	movabs $0x803639,%rsi
+  80131a:	00 00 00 
+  80131d:	bf 01 00 00 00       	mov    $0x1,%edi
+  801322:	b8 00 00 00 00       	mov    $0x0,%eax
+  801327:	48 b9 8c 26 80 00 00 	movabs $0x80268c,%rcx
+  80132e:	00 00 00 
+  801331:	ff d1                	call   *%rcx
+#endif
+    }
+
+    bool echo = iscons(0);
+  801333:	bf 00 00 00 00       	mov    $0x0,%edi
+  801338:	48 b8 f7 02 80 00 00 	movabs $0x8002f7,%rax
+  80133f:	00 00 00 
+  801342:	ff d0                	call   *%rax
+  801344:	41 89 c6             	mov    %eax,%r14d
+
+    for (size_t i = 0;;) {
+  801347:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        int c = getchar();
+  80134d:	49 bd be 02 80 00 00 	movabs $0x8002be,%r13
+  801354:	00 00 00 
+                cprintf("read error: %i\n", c);
+            return NULL;
+        } else if ((c == '\b' || c == '\x7F')) {
+            if (i) {
+                if (echo) {
+                    cputchar('\b');
+  801357:	49 bf 9b 02 80 00 00 	movabs $0x80029b,%r15
+  80135e:	00 00 00 
+  801361:	eb 46                	jmp    8013a9 <readline+0xaf>
+            return NULL;
+  801363:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (c != -E_EOF)
+  801368:	83 fb f4             	cmp    $0xfffffff4,%ebx
+  80136b:	75 0f                	jne    80137c <readline+0x82>
+            }
+            buf[i] = 0;
+            return buf;
+        }
+    }
+}
+  80136d:	48 83 c4 08          	add    $0x8,%rsp
+  801371:	5b                   	pop    %rbx
+  801372:	41 5c                	pop    %r12
+  801374:	41 5d                	pop    %r13
+  801376:	41 5e                	pop    %r14
+  801378:	41 5f                	pop    %r15
+  80137a:	5d                   	pop    %rbp
+  80137b:	c3                   	ret
+                cprintf("read error: %i\n", c);
+  80137c:	89 de                	mov    %ebx,%esi
+  80137e:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801385:	00 00 00 
+  801388:	48 ba ae 05 80 00 00 	movabs $0x8005ae,%rdx
+  80138f:	00 00 00 
+  801392:	ff d2                	call   *%rdx
+            return NULL;
+  801394:	b8 00 00 00 00       	mov    $0x0,%eax
+  801399:	eb d2                	jmp    80136d <readline+0x73>
+            if (i) {
+  80139b:	4d 85 e4             	test   %r12,%r12
+  80139e:	74 09                	je     8013a9 <readline+0xaf>
+                if (echo) {
+  8013a0:	45 85 f6             	test   %r14d,%r14d
+  8013a3:	75 3f                	jne    8013e4 <readline+0xea>
+                i--;
+  8013a5:	49 83 ec 01          	sub    $0x1,%r12
+        int c = getchar();
+  8013a9:	41 ff d5             	call   *%r13
+  8013ac:	89 c3                	mov    %eax,%ebx
+        if (c < 0) {
+  8013ae:	85 c0                	test   %eax,%eax
+  8013b0:	78 b1                	js     801363 <readline+0x69>
+        } else if ((c == '\b' || c == '\x7F')) {
+  8013b2:	83 f8 08             	cmp    $0x8,%eax
+  8013b5:	74 e4                	je     80139b <readline+0xa1>
+  8013b7:	83 f8 7f             	cmp    $0x7f,%eax
+  8013ba:	74 df                	je     80139b <readline+0xa1>
+        } else if (c >= ' ') {
+  8013bc:	83 f8 1f             	cmp    $0x1f,%eax
+  8013bf:	7e 4d                	jle    80140e <readline+0x114>
+            if (i < BUFLEN - 1) {
+  8013c1:	49 81 fc fe 03 00 00 	cmp    $0x3fe,%r12
+  8013c8:	77 df                	ja     8013a9 <readline+0xaf>
+                if (echo) {
+  8013ca:	45 85 f6             	test   %r14d,%r14d
+  8013cd:	75 2f                	jne    8013fe <readline+0x104>
+                buf[i++] = (char)c;
+  8013cf:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  8013d6:	00 00 00 
+  8013d9:	42 88 1c 20          	mov    %bl,(%rax,%r12,1)
+  8013dd:	4d 8d 64 24 01       	lea    0x1(%r12),%r12
+  8013e2:	eb c5                	jmp    8013a9 <readline+0xaf>
+                    cputchar('\b');
+  8013e4:	bf 08 00 00 00       	mov    $0x8,%edi
+  8013e9:	41 ff d7             	call   *%r15
+                    cputchar(' ');
+  8013ec:	bf 20 00 00 00       	mov    $0x20,%edi
+  8013f1:	41 ff d7             	call   *%r15
+                    cputchar('\b');
+  8013f4:	bf 08 00 00 00       	mov    $0x8,%edi
+  8013f9:	41 ff d7             	call   *%r15
+  8013fc:	eb a7                	jmp    8013a5 <readline+0xab>
+                    cputchar(c);
+  8013fe:	89 c7                	mov    %eax,%edi
+  801400:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  801407:	00 00 00 
+  80140a:	ff d0                	call   *%rax
+  80140c:	eb c1                	jmp    8013cf <readline+0xd5>
+        } else if (c == '\n' || c == '\r') {
+  80140e:	83 f8 0a             	cmp    $0xa,%eax
+  801411:	74 05                	je     801418 <readline+0x11e>
+  801413:	83 f8 0d             	cmp    $0xd,%eax
+  801416:	75 91                	jne    8013a9 <readline+0xaf>
+            if (echo) {
+  801418:	45 85 f6             	test   %r14d,%r14d
+  80141b:	75 14                	jne    801431 <readline+0x137>
+            buf[i] = 0;
+  80141d:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  801424:	00 00 00 
+  801427:	42 c6 04 20 00       	movb   $0x0,(%rax,%r12,1)
+            return buf;
+  80142c:	e9 3c ff ff ff       	jmp    80136d <readline+0x73>
+                cputchar('\n');
+  801431:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801436:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  80143d:	00 00 00 
+  801440:	ff d0                	call   *%rax
+  801442:	eb d9                	jmp    80141d <readline+0x123>
+
+0000000000801444 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801444:	55                   	push   %rbp
+  801445:	48 89 e5             	mov    %rsp,%rbp
+  801448:	53                   	push   %rbx
+  801449:	48 89 fa             	mov    %rdi,%rdx
+  80144c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80144f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801454:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801459:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80145e:	be 00 00 00 00       	mov    $0x0,%esi
+  801463:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801469:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80146b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80146f:	c9                   	leave
+  801470:	c3                   	ret
+
+0000000000801471 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801471:	55                   	push   %rbp
+  801472:	48 89 e5             	mov    %rsp,%rbp
+  801475:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801476:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80147b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801480:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801485:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148f:	be 00 00 00 00       	mov    $0x0,%esi
+  801494:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80149a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80149c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a0:	c9                   	leave
+  8014a1:	c3                   	ret
+
+00000000008014a2 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8014a2:	55                   	push   %rbp
+  8014a3:	48 89 e5             	mov    %rsp,%rbp
+  8014a6:	53                   	push   %rbx
+  8014a7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8014ab:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ae:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014cd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014cf:	48 85 c0             	test   %rax,%rax
+  8014d2:	7f 06                	jg     8014da <sys_env_destroy+0x38>
+}
+  8014d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d8:	c9                   	leave
+  8014d9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014da:	49 89 c0             	mov    %rax,%r8
+  8014dd:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8014e2:	48 ba 40 35 80 00 00 	movabs $0x803540,%rdx
+  8014e9:	00 00 00 
+  8014ec:	be 26 00 00 00       	mov    $0x26,%esi
+  8014f1:	48 bf 5f 35 80 00 00 	movabs $0x80355f,%rdi
+  8014f8:	00 00 00 
+  8014fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801500:	49 b9 5e 04 80 00 00 	movabs $0x80045e,%r9
+  801507:	00 00 00 
+  80150a:	41 ff d1             	call   *%r9
+
+000000000080150d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80150d:	55                   	push   %rbp
+  80150e:	48 89 e5             	mov    %rsp,%rbp
+  801511:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801512:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801517:	ba 00 00 00 00       	mov    $0x0,%edx
+  80151c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801521:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801526:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80152b:	be 00 00 00 00       	mov    $0x0,%esi
+  801530:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801536:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801538:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80153c:	c9                   	leave
+  80153d:	c3                   	ret
+
+000000000080153e <sys_yield>:
+
+void
+sys_yield(void) {
+  80153e:	55                   	push   %rbp
+  80153f:	48 89 e5             	mov    %rsp,%rbp
+  801542:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801543:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801548:	ba 00 00 00 00       	mov    $0x0,%edx
+  80154d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801552:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801557:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80155c:	be 00 00 00 00       	mov    $0x0,%esi
+  801561:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801567:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801569:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80156d:	c9                   	leave
+  80156e:	c3                   	ret
+
+000000000080156f <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80156f:	55                   	push   %rbp
+  801570:	48 89 e5             	mov    %rsp,%rbp
+  801573:	53                   	push   %rbx
+  801574:	48 89 fa             	mov    %rdi,%rdx
+  801577:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80157a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80157f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801586:	00 00 00 
+  801589:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80158e:	be 00 00 00 00       	mov    $0x0,%esi
+  801593:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801599:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80159b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159f:	c9                   	leave
+  8015a0:	c3                   	ret
+
+00000000008015a1 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8015a1:	55                   	push   %rbp
+  8015a2:	48 89 e5             	mov    %rsp,%rbp
+  8015a5:	53                   	push   %rbx
+  8015a6:	49 89 f8             	mov    %rdi,%r8
+  8015a9:	48 89 d3             	mov    %rdx,%rbx
+  8015ac:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015af:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b4:	4c 89 c2             	mov    %r8,%rdx
+  8015b7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8015bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c5:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8015c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015cb:	c9                   	leave
+  8015cc:	c3                   	ret
+
+00000000008015cd <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8015cd:	55                   	push   %rbp
+  8015ce:	48 89 e5             	mov    %rsp,%rbp
+  8015d1:	53                   	push   %rbx
+  8015d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8015d6:	89 f8                	mov    %edi,%eax
+  8015d8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8015db:	48 63 f9             	movslq %ecx,%rdi
+  8015de:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e1:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015e6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015f6:	48 85 c0             	test   %rax,%rax
+  8015f9:	7f 06                	jg     801601 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8015fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ff:	c9                   	leave
+  801600:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801601:	49 89 c0             	mov    %rax,%r8
+  801604:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801609:	48 ba 40 35 80 00 00 	movabs $0x803540,%rdx
+  801610:	00 00 00 
+  801613:	be 26 00 00 00       	mov    $0x26,%esi
+  801618:	48 bf 5f 35 80 00 00 	movabs $0x80355f,%rdi
+  80161f:	00 00 00 
+  801622:	b8 00 00 00 00       	mov    $0x0,%eax
+  801627:	49 b9 5e 04 80 00 00 	movabs $0x80045e,%r9
+  80162e:	00 00 00 
+  801631:	41 ff d1             	call   *%r9
+
+0000000000801634 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801634:	55                   	push   %rbp
+  801635:	48 89 e5             	mov    %rsp,%rbp
+  801638:	53                   	push   %rbx
+  801639:	48 83 ec 08          	sub    $0x8,%rsp
+  80163d:	89 f8                	mov    %edi,%eax
+  80163f:	49 89 f2             	mov    %rsi,%r10
+  801642:	48 89 cf             	mov    %rcx,%rdi
+  801645:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801648:	48 63 da             	movslq %edx,%rbx
+  80164b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80164e:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801653:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801656:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801659:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80165b:	48 85 c0             	test   %rax,%rax
+  80165e:	7f 06                	jg     801666 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801660:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801664:	c9                   	leave
+  801665:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801666:	49 89 c0             	mov    %rax,%r8
+  801669:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80166e:	48 ba 40 35 80 00 00 	movabs $0x803540,%rdx
+  801675:	00 00 00 
+  801678:	be 26 00 00 00       	mov    $0x26,%esi
+  80167d:	48 bf 5f 35 80 00 00 	movabs $0x80355f,%rdi
+  801684:	00 00 00 
+  801687:	b8 00 00 00 00       	mov    $0x0,%eax
+  80168c:	49 b9 5e 04 80 00 00 	movabs $0x80045e,%r9
+  801693:	00 00 00 
+  801696:	41 ff d1             	call   *%r9
+
+0000000000801699 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801699:	55                   	push   %rbp
+  80169a:	48 89 e5             	mov    %rsp,%rbp
+  80169d:	53                   	push   %rbx
+  80169e:	48 83 ec 08          	sub    $0x8,%rsp
+  8016a2:	48 89 f1             	mov    %rsi,%rcx
+  8016a5:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8016a8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ab:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016c2:	48 85 c0             	test   %rax,%rax
+  8016c5:	7f 06                	jg     8016cd <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8016c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016cb:	c9                   	leave
+  8016cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016cd:	49 89 c0             	mov    %rax,%r8
+  8016d0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8016d5:	48 ba 40 35 80 00 00 	movabs $0x803540,%rdx
+  8016dc:	00 00 00 
+  8016df:	be 26 00 00 00       	mov    $0x26,%esi
+  8016e4:	48 bf 5f 35 80 00 00 	movabs $0x80355f,%rdi
+  8016eb:	00 00 00 
+  8016ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f3:	49 b9 5e 04 80 00 00 	movabs $0x80045e,%r9
+  8016fa:	00 00 00 
+  8016fd:	41 ff d1             	call   *%r9
+
+0000000000801700 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801700:	55                   	push   %rbp
+  801701:	48 89 e5             	mov    %rsp,%rbp
+  801704:	53                   	push   %rbx
+  801705:	48 83 ec 08          	sub    $0x8,%rsp
+  801709:	89 f8                	mov    %edi,%eax
+  80170b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  80170e:	48 63 f9             	movslq %ecx,%rdi
+  801711:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801714:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801719:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80171c:	be 00 00 00 00       	mov    $0x0,%esi
+  801721:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801727:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801729:	48 85 c0             	test   %rax,%rax
+  80172c:	7f 06                	jg     801734 <sys_region_advise+0x34>
+}
+  80172e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801732:	c9                   	leave
+  801733:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801734:	49 89 c0             	mov    %rax,%r8
+  801737:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80173c:	48 ba 40 35 80 00 00 	movabs $0x803540,%rdx
+  801743:	00 00 00 
+  801746:	be 26 00 00 00       	mov    $0x26,%esi
+  80174b:	48 bf 5f 35 80 00 00 	movabs $0x80355f,%rdi
+  801752:	00 00 00 
+  801755:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175a:	49 b9 5e 04 80 00 00 	movabs $0x80045e,%r9
+  801761:	00 00 00 
+  801764:	41 ff d1             	call   *%r9
+
+0000000000801767 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801767:	55                   	push   %rbp
+  801768:	48 89 e5             	mov    %rsp,%rbp
+  80176b:	53                   	push   %rbx
+  80176c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801770:	48 63 ce             	movslq %esi,%rcx
+  801773:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801776:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80177b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801780:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801785:	be 00 00 00 00       	mov    $0x0,%esi
+  80178a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801790:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801792:	48 85 c0             	test   %rax,%rax
+  801795:	7f 06                	jg     80179d <sys_env_set_nice+0x36>
+}
+  801797:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80179b:	c9                   	leave
+  80179c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80179d:	49 89 c0             	mov    %rax,%r8
+  8017a0:	b9 15 00 00 00       	mov    $0x15,%ecx
+  8017a5:	48 ba 40 35 80 00 00 	movabs $0x803540,%rdx
+  8017ac:	00 00 00 
+  8017af:	be 26 00 00 00       	mov    $0x26,%esi
+  8017b4:	48 bf 5f 35 80 00 00 	movabs $0x80355f,%rdi
+  8017bb:	00 00 00 
+  8017be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c3:	49 b9 5e 04 80 00 00 	movabs $0x80045e,%r9
+  8017ca:	00 00 00 
+  8017cd:	41 ff d1             	call   *%r9
+
+00000000008017d0 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8017d0:	55                   	push   %rbp
+  8017d1:	48 89 e5             	mov    %rsp,%rbp
+  8017d4:	53                   	push   %rbx
+  8017d5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8017d9:	48 63 ce             	movslq %esi,%rcx
+  8017dc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017df:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017fb:	48 85 c0             	test   %rax,%rax
+  8017fe:	7f 06                	jg     801806 <sys_env_set_status+0x36>
+}
+  801800:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801804:	c9                   	leave
+  801805:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801806:	49 89 c0             	mov    %rax,%r8
+  801809:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80180e:	48 ba 40 35 80 00 00 	movabs $0x803540,%rdx
+  801815:	00 00 00 
+  801818:	be 26 00 00 00       	mov    $0x26,%esi
+  80181d:	48 bf 5f 35 80 00 00 	movabs $0x80355f,%rdi
+  801824:	00 00 00 
+  801827:	b8 00 00 00 00       	mov    $0x0,%eax
+  80182c:	49 b9 5e 04 80 00 00 	movabs $0x80045e,%r9
+  801833:	00 00 00 
+  801836:	41 ff d1             	call   *%r9
+
+0000000000801839 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801839:	55                   	push   %rbp
+  80183a:	48 89 e5             	mov    %rsp,%rbp
+  80183d:	53                   	push   %rbx
+  80183e:	48 83 ec 08          	sub    $0x8,%rsp
+  801842:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801845:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801848:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80184d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801852:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801857:	be 00 00 00 00       	mov    $0x0,%esi
+  80185c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801862:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801864:	48 85 c0             	test   %rax,%rax
+  801867:	7f 06                	jg     80186f <sys_env_set_trapframe+0x36>
+}
+  801869:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80186d:	c9                   	leave
+  80186e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80186f:	49 89 c0             	mov    %rax,%r8
+  801872:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801877:	48 ba 40 35 80 00 00 	movabs $0x803540,%rdx
+  80187e:	00 00 00 
+  801881:	be 26 00 00 00       	mov    $0x26,%esi
+  801886:	48 bf 5f 35 80 00 00 	movabs $0x80355f,%rdi
+  80188d:	00 00 00 
+  801890:	b8 00 00 00 00       	mov    $0x0,%eax
+  801895:	49 b9 5e 04 80 00 00 	movabs $0x80045e,%r9
+  80189c:	00 00 00 
+  80189f:	41 ff d1             	call   *%r9
+
+00000000008018a2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8018a2:	55                   	push   %rbp
+  8018a3:	48 89 e5             	mov    %rsp,%rbp
+  8018a6:	53                   	push   %rbx
+  8018a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8018ab:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8018ae:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018b1:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018bb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018cb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018cd:	48 85 c0             	test   %rax,%rax
+  8018d0:	7f 06                	jg     8018d8 <sys_env_set_pgfault_upcall+0x36>
+}
+  8018d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018d6:	c9                   	leave
+  8018d7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018d8:	49 89 c0             	mov    %rax,%r8
+  8018db:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8018e0:	48 ba 40 35 80 00 00 	movabs $0x803540,%rdx
+  8018e7:	00 00 00 
+  8018ea:	be 26 00 00 00       	mov    $0x26,%esi
+  8018ef:	48 bf 5f 35 80 00 00 	movabs $0x80355f,%rdi
+  8018f6:	00 00 00 
+  8018f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018fe:	49 b9 5e 04 80 00 00 	movabs $0x80045e,%r9
+  801905:	00 00 00 
+  801908:	41 ff d1             	call   *%r9
+
+000000000080190b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80190b:	55                   	push   %rbp
+  80190c:	48 89 e5             	mov    %rsp,%rbp
+  80190f:	53                   	push   %rbx
+  801910:	89 f8                	mov    %edi,%eax
+  801912:	49 89 f1             	mov    %rsi,%r9
+  801915:	48 89 d3             	mov    %rdx,%rbx
+  801918:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80191b:	49 63 f0             	movslq %r8d,%rsi
+  80191e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801921:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801926:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801929:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80192f:	cd 30                	int    $0x30
+}
+  801931:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801935:	c9                   	leave
+  801936:	c3                   	ret
+
+0000000000801937 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801937:	55                   	push   %rbp
+  801938:	48 89 e5             	mov    %rsp,%rbp
+  80193b:	53                   	push   %rbx
+  80193c:	48 83 ec 08          	sub    $0x8,%rsp
+  801940:	48 89 fa             	mov    %rdi,%rdx
+  801943:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801946:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80194b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801950:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801955:	be 00 00 00 00       	mov    $0x0,%esi
+  80195a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801960:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801962:	48 85 c0             	test   %rax,%rax
+  801965:	7f 06                	jg     80196d <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801967:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80196b:	c9                   	leave
+  80196c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80196d:	49 89 c0             	mov    %rax,%r8
+  801970:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801975:	48 ba 40 35 80 00 00 	movabs $0x803540,%rdx
+  80197c:	00 00 00 
+  80197f:	be 26 00 00 00       	mov    $0x26,%esi
+  801984:	48 bf 5f 35 80 00 00 	movabs $0x80355f,%rdi
+  80198b:	00 00 00 
+  80198e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801993:	49 b9 5e 04 80 00 00 	movabs $0x80045e,%r9
+  80199a:	00 00 00 
+  80199d:	41 ff d1             	call   *%r9
+
+00000000008019a0 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8019a0:	55                   	push   %rbp
+  8019a1:	48 89 e5             	mov    %rsp,%rbp
+  8019a4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019a5:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019af:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019be:	be 00 00 00 00       	mov    $0x0,%esi
+  8019c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019c9:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8019cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019cf:	c9                   	leave
+  8019d0:	c3                   	ret
+
+00000000008019d1 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8019d1:	55                   	push   %rbp
+  8019d2:	48 89 e5             	mov    %rsp,%rbp
+  8019d5:	53                   	push   %rbx
+  8019d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8019da:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8019dd:	48 63 ce             	movslq %esi,%rcx
+  8019e0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019e3:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019e8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8019f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019f8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019fa:	48 85 c0             	test   %rax,%rax
+  8019fd:	7f 06                	jg     801a05 <sys_sigqueue+0x34>
+}
+  8019ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a03:	c9                   	leave
+  801a04:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a05:	49 89 c0             	mov    %rax,%r8
+  801a08:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801a0d:	48 ba 40 35 80 00 00 	movabs $0x803540,%rdx
+  801a14:	00 00 00 
+  801a17:	be 26 00 00 00       	mov    $0x26,%esi
+  801a1c:	48 bf 5f 35 80 00 00 	movabs $0x80355f,%rdi
+  801a23:	00 00 00 
+  801a26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2b:	49 b9 5e 04 80 00 00 	movabs $0x80045e,%r9
+  801a32:	00 00 00 
+  801a35:	41 ff d1             	call   *%r9
+
+0000000000801a38 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801a38:	55                   	push   %rbp
+  801a39:	48 89 e5             	mov    %rsp,%rbp
+  801a3c:	53                   	push   %rbx
+  801a3d:	48 83 ec 08          	sub    $0x8,%rsp
+  801a41:	48 89 fa             	mov    %rdi,%rdx
+  801a44:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a47:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a51:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a56:	be 00 00 00 00       	mov    $0x0,%esi
+  801a5b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a61:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a63:	48 85 c0             	test   %rax,%rax
+  801a66:	7f 06                	jg     801a6e <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801a68:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a6c:	c9                   	leave
+  801a6d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a6e:	49 89 c0             	mov    %rax,%r8
+  801a71:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801a76:	48 ba 40 35 80 00 00 	movabs $0x803540,%rdx
+  801a7d:	00 00 00 
+  801a80:	be 26 00 00 00       	mov    $0x26,%esi
+  801a85:	48 bf 5f 35 80 00 00 	movabs $0x80355f,%rdi
+  801a8c:	00 00 00 
+  801a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a94:	49 b9 5e 04 80 00 00 	movabs $0x80045e,%r9
+  801a9b:	00 00 00 
+  801a9e:	41 ff d1             	call   *%r9
+
+0000000000801aa1 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801aa1:	55                   	push   %rbp
+  801aa2:	48 89 e5             	mov    %rsp,%rbp
+  801aa5:	53                   	push   %rbx
+  801aa6:	48 83 ec 08          	sub    $0x8,%rsp
+  801aaa:	48 89 f1             	mov    %rsi,%rcx
+  801aad:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801ab0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ab3:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ab8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801abd:	be 00 00 00 00       	mov    $0x0,%esi
+  801ac2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ac8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801aca:	48 85 c0             	test   %rax,%rax
+  801acd:	7f 06                	jg     801ad5 <sys_sigaction+0x34>
+}
+  801acf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ad3:	c9                   	leave
+  801ad4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ad5:	49 89 c0             	mov    %rax,%r8
+  801ad8:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801add:	48 ba 40 35 80 00 00 	movabs $0x803540,%rdx
+  801ae4:	00 00 00 
+  801ae7:	be 26 00 00 00       	mov    $0x26,%esi
+  801aec:	48 bf 5f 35 80 00 00 	movabs $0x80355f,%rdi
+  801af3:	00 00 00 
+  801af6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afb:	49 b9 5e 04 80 00 00 	movabs $0x80045e,%r9
+  801b02:	00 00 00 
+  801b05:	41 ff d1             	call   *%r9
+
+0000000000801b08 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801b08:	55                   	push   %rbp
+  801b09:	48 89 e5             	mov    %rsp,%rbp
+  801b0c:	53                   	push   %rbx
+  801b0d:	48 83 ec 08          	sub    $0x8,%rsp
+  801b11:	48 89 f1             	mov    %rsi,%rcx
+  801b14:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801b17:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b1a:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b1f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b24:	be 00 00 00 00       	mov    $0x0,%esi
+  801b29:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b2f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b31:	48 85 c0             	test   %rax,%rax
+  801b34:	7f 06                	jg     801b3c <sys_sigprocmask+0x34>
+}
+  801b36:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b3a:	c9                   	leave
+  801b3b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b3c:	49 89 c0             	mov    %rax,%r8
+  801b3f:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801b44:	48 ba 40 35 80 00 00 	movabs $0x803540,%rdx
+  801b4b:	00 00 00 
+  801b4e:	be 26 00 00 00       	mov    $0x26,%esi
+  801b53:	48 bf 5f 35 80 00 00 	movabs $0x80355f,%rdi
+  801b5a:	00 00 00 
+  801b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b62:	49 b9 5e 04 80 00 00 	movabs $0x80045e,%r9
+  801b69:	00 00 00 
+  801b6c:	41 ff d1             	call   *%r9
+
+0000000000801b6f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b6f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b76:	ff ff ff 
+  801b79:	48 01 f8             	add    %rdi,%rax
+  801b7c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801b80:	c3                   	ret
+
+0000000000801b81 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b81:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b88:	ff ff ff 
+  801b8b:	48 01 f8             	add    %rdi,%rax
+  801b8e:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801b92:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801b98:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801b9c:	c3                   	ret
+
+0000000000801b9d <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801b9d:	55                   	push   %rbp
+  801b9e:	48 89 e5             	mov    %rsp,%rbp
+  801ba1:	41 57                	push   %r15
+  801ba3:	41 56                	push   %r14
+  801ba5:	41 55                	push   %r13
+  801ba7:	41 54                	push   %r12
+  801ba9:	53                   	push   %rbx
+  801baa:	48 83 ec 08          	sub    $0x8,%rsp
+  801bae:	49 89 ff             	mov    %rdi,%r15
+  801bb1:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801bb6:	49 bd bf 2c 80 00 00 	movabs $0x802cbf,%r13
+  801bbd:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801bc0:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801bc6:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801bc9:	48 89 df             	mov    %rbx,%rdi
+  801bcc:	41 ff d5             	call   *%r13
+  801bcf:	83 e0 04             	and    $0x4,%eax
+  801bd2:	74 17                	je     801beb <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801bd4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801bdb:	4c 39 f3             	cmp    %r14,%rbx
+  801bde:	75 e6                	jne    801bc6 <fd_alloc+0x29>
+  801be0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801be6:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801beb:	4d 89 27             	mov    %r12,(%r15)
+}
+  801bee:	48 83 c4 08          	add    $0x8,%rsp
+  801bf2:	5b                   	pop    %rbx
+  801bf3:	41 5c                	pop    %r12
+  801bf5:	41 5d                	pop    %r13
+  801bf7:	41 5e                	pop    %r14
+  801bf9:	41 5f                	pop    %r15
+  801bfb:	5d                   	pop    %rbp
+  801bfc:	c3                   	ret
+
+0000000000801bfd <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801bfd:	83 ff 1f             	cmp    $0x1f,%edi
+  801c00:	77 39                	ja     801c3b <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801c02:	55                   	push   %rbp
+  801c03:	48 89 e5             	mov    %rsp,%rbp
+  801c06:	41 54                	push   %r12
+  801c08:	53                   	push   %rbx
+  801c09:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801c0c:	48 63 df             	movslq %edi,%rbx
+  801c0f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801c16:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801c1a:	48 89 df             	mov    %rbx,%rdi
+  801c1d:	48 b8 bf 2c 80 00 00 	movabs $0x802cbf,%rax
+  801c24:	00 00 00 
+  801c27:	ff d0                	call   *%rax
+  801c29:	a8 04                	test   $0x4,%al
+  801c2b:	74 14                	je     801c41 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801c2d:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801c31:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c36:	5b                   	pop    %rbx
+  801c37:	41 5c                	pop    %r12
+  801c39:	5d                   	pop    %rbp
+  801c3a:	c3                   	ret
+        return -E_INVAL;
+  801c3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801c40:	c3                   	ret
+        return -E_INVAL;
+  801c41:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c46:	eb ee                	jmp    801c36 <fd_lookup+0x39>
+
+0000000000801c48 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801c48:	55                   	push   %rbp
+  801c49:	48 89 e5             	mov    %rsp,%rbp
+  801c4c:	41 54                	push   %r12
+  801c4e:	53                   	push   %rbx
+  801c4f:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801c52:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  801c59:	00 00 00 
+  801c5c:	48 bb 40 40 80 00 00 	movabs $0x804040,%rbx
+  801c63:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801c66:	39 3b                	cmp    %edi,(%rbx)
+  801c68:	74 47                	je     801cb1 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c6a:	48 83 c0 08          	add    $0x8,%rax
+  801c6e:	48 8b 18             	mov    (%rax),%rbx
+  801c71:	48 85 db             	test   %rbx,%rbx
+  801c74:	75 f0                	jne    801c66 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c76:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c7d:	00 00 00 
+  801c80:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c86:	89 fa                	mov    %edi,%edx
+  801c88:	48 bf 70 35 80 00 00 	movabs $0x803570,%rdi
+  801c8f:	00 00 00 
+  801c92:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c97:	48 b9 ae 05 80 00 00 	movabs $0x8005ae,%rcx
+  801c9e:	00 00 00 
+  801ca1:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801ca3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801ca8:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801cac:	5b                   	pop    %rbx
+  801cad:	41 5c                	pop    %r12
+  801caf:	5d                   	pop    %rbp
+  801cb0:	c3                   	ret
+            return 0;
+  801cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb6:	eb f0                	jmp    801ca8 <dev_lookup+0x60>
+
+0000000000801cb8 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801cb8:	55                   	push   %rbp
+  801cb9:	48 89 e5             	mov    %rsp,%rbp
+  801cbc:	41 55                	push   %r13
+  801cbe:	41 54                	push   %r12
+  801cc0:	53                   	push   %rbx
+  801cc1:	48 83 ec 18          	sub    $0x18,%rsp
+  801cc5:	48 89 fb             	mov    %rdi,%rbx
+  801cc8:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ccb:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801cd2:	ff ff ff 
+  801cd5:	48 01 df             	add    %rbx,%rdi
+  801cd8:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801cdc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ce0:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  801ce7:	00 00 00 
+  801cea:	ff d0                	call   *%rax
+  801cec:	41 89 c5             	mov    %eax,%r13d
+  801cef:	85 c0                	test   %eax,%eax
+  801cf1:	78 06                	js     801cf9 <fd_close+0x41>
+  801cf3:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801cf7:	74 1a                	je     801d13 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801cf9:	45 84 e4             	test   %r12b,%r12b
+  801cfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d01:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801d05:	44 89 e8             	mov    %r13d,%eax
+  801d08:	48 83 c4 18          	add    $0x18,%rsp
+  801d0c:	5b                   	pop    %rbx
+  801d0d:	41 5c                	pop    %r12
+  801d0f:	41 5d                	pop    %r13
+  801d11:	5d                   	pop    %rbp
+  801d12:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d13:	8b 3b                	mov    (%rbx),%edi
+  801d15:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d19:	48 b8 48 1c 80 00 00 	movabs $0x801c48,%rax
+  801d20:	00 00 00 
+  801d23:	ff d0                	call   *%rax
+  801d25:	41 89 c5             	mov    %eax,%r13d
+  801d28:	85 c0                	test   %eax,%eax
+  801d2a:	78 1b                	js     801d47 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801d2c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d30:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d34:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801d3a:	48 85 c0             	test   %rax,%rax
+  801d3d:	74 08                	je     801d47 <fd_close+0x8f>
+  801d3f:	48 89 df             	mov    %rbx,%rdi
+  801d42:	ff d0                	call   *%rax
+  801d44:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801d47:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d4c:	48 89 de             	mov    %rbx,%rsi
+  801d4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d54:	48 b8 99 16 80 00 00 	movabs $0x801699,%rax
+  801d5b:	00 00 00 
+  801d5e:	ff d0                	call   *%rax
+    return res;
+  801d60:	eb a3                	jmp    801d05 <fd_close+0x4d>
+
+0000000000801d62 <close>:
+
+int
+close(int fdnum) {
+  801d62:	55                   	push   %rbp
+  801d63:	48 89 e5             	mov    %rsp,%rbp
+  801d66:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d6a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d6e:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  801d75:	00 00 00 
+  801d78:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d7a:	85 c0                	test   %eax,%eax
+  801d7c:	78 15                	js     801d93 <close+0x31>
+
+    return fd_close(fd, 1);
+  801d7e:	be 01 00 00 00       	mov    $0x1,%esi
+  801d83:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801d87:	48 b8 b8 1c 80 00 00 	movabs $0x801cb8,%rax
+  801d8e:	00 00 00 
+  801d91:	ff d0                	call   *%rax
+}
+  801d93:	c9                   	leave
+  801d94:	c3                   	ret
+
+0000000000801d95 <close_all>:
+
+void
+close_all(void) {
+  801d95:	55                   	push   %rbp
+  801d96:	48 89 e5             	mov    %rsp,%rbp
+  801d99:	41 54                	push   %r12
+  801d9b:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801d9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801da1:	49 bc 62 1d 80 00 00 	movabs $0x801d62,%r12
+  801da8:	00 00 00 
+  801dab:	89 df                	mov    %ebx,%edi
+  801dad:	41 ff d4             	call   *%r12
+  801db0:	83 c3 01             	add    $0x1,%ebx
+  801db3:	83 fb 20             	cmp    $0x20,%ebx
+  801db6:	75 f3                	jne    801dab <close_all+0x16>
+}
+  801db8:	5b                   	pop    %rbx
+  801db9:	41 5c                	pop    %r12
+  801dbb:	5d                   	pop    %rbp
+  801dbc:	c3                   	ret
+
+0000000000801dbd <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801dbd:	55                   	push   %rbp
+  801dbe:	48 89 e5             	mov    %rsp,%rbp
+  801dc1:	41 57                	push   %r15
+  801dc3:	41 56                	push   %r14
+  801dc5:	41 55                	push   %r13
+  801dc7:	41 54                	push   %r12
+  801dc9:	53                   	push   %rbx
+  801dca:	48 83 ec 18          	sub    $0x18,%rsp
+  801dce:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801dd1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801dd5:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  801ddc:	00 00 00 
+  801ddf:	ff d0                	call   *%rax
+  801de1:	89 c3                	mov    %eax,%ebx
+  801de3:	85 c0                	test   %eax,%eax
+  801de5:	0f 88 b8 00 00 00    	js     801ea3 <dup+0xe6>
+    close(newfdnum);
+  801deb:	44 89 e7             	mov    %r12d,%edi
+  801dee:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  801df5:	00 00 00 
+  801df8:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801dfa:	4d 63 ec             	movslq %r12d,%r13
+  801dfd:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801e04:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801e08:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801e0c:	4c 89 ff             	mov    %r15,%rdi
+  801e0f:	49 be 81 1b 80 00 00 	movabs $0x801b81,%r14
+  801e16:	00 00 00 
+  801e19:	41 ff d6             	call   *%r14
+  801e1c:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801e1f:	4c 89 ef             	mov    %r13,%rdi
+  801e22:	41 ff d6             	call   *%r14
+  801e25:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801e28:	48 89 df             	mov    %rbx,%rdi
+  801e2b:	48 b8 bf 2c 80 00 00 	movabs $0x802cbf,%rax
+  801e32:	00 00 00 
+  801e35:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801e37:	a8 04                	test   $0x4,%al
+  801e39:	74 2b                	je     801e66 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801e3b:	41 89 c1             	mov    %eax,%r9d
+  801e3e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e44:	4c 89 f1             	mov    %r14,%rcx
+  801e47:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e4c:	48 89 de             	mov    %rbx,%rsi
+  801e4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e54:	48 b8 34 16 80 00 00 	movabs $0x801634,%rax
+  801e5b:	00 00 00 
+  801e5e:	ff d0                	call   *%rax
+  801e60:	89 c3                	mov    %eax,%ebx
+  801e62:	85 c0                	test   %eax,%eax
+  801e64:	78 4e                	js     801eb4 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801e66:	4c 89 ff             	mov    %r15,%rdi
+  801e69:	48 b8 bf 2c 80 00 00 	movabs $0x802cbf,%rax
+  801e70:	00 00 00 
+  801e73:	ff d0                	call   *%rax
+  801e75:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801e78:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e7e:	4c 89 e9             	mov    %r13,%rcx
+  801e81:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e86:	4c 89 fe             	mov    %r15,%rsi
+  801e89:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e8e:	48 b8 34 16 80 00 00 	movabs $0x801634,%rax
+  801e95:	00 00 00 
+  801e98:	ff d0                	call   *%rax
+  801e9a:	89 c3                	mov    %eax,%ebx
+  801e9c:	85 c0                	test   %eax,%eax
+  801e9e:	78 14                	js     801eb4 <dup+0xf7>
+
+    return newfdnum;
+  801ea0:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ea3:	89 d8                	mov    %ebx,%eax
+  801ea5:	48 83 c4 18          	add    $0x18,%rsp
+  801ea9:	5b                   	pop    %rbx
+  801eaa:	41 5c                	pop    %r12
+  801eac:	41 5d                	pop    %r13
+  801eae:	41 5e                	pop    %r14
+  801eb0:	41 5f                	pop    %r15
+  801eb2:	5d                   	pop    %rbp
+  801eb3:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801eb4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801eb9:	4c 89 ee             	mov    %r13,%rsi
+  801ebc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ec1:	49 bc 99 16 80 00 00 	movabs $0x801699,%r12
+  801ec8:	00 00 00 
+  801ecb:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801ece:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ed3:	4c 89 f6             	mov    %r14,%rsi
+  801ed6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801edb:	41 ff d4             	call   *%r12
+    return res;
+  801ede:	eb c3                	jmp    801ea3 <dup+0xe6>
+
+0000000000801ee0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801ee0:	55                   	push   %rbp
+  801ee1:	48 89 e5             	mov    %rsp,%rbp
+  801ee4:	41 56                	push   %r14
+  801ee6:	41 55                	push   %r13
+  801ee8:	41 54                	push   %r12
+  801eea:	53                   	push   %rbx
+  801eeb:	48 83 ec 10          	sub    $0x10,%rsp
+  801eef:	89 fb                	mov    %edi,%ebx
+  801ef1:	49 89 f4             	mov    %rsi,%r12
+  801ef4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ef7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801efb:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  801f02:	00 00 00 
+  801f05:	ff d0                	call   *%rax
+  801f07:	85 c0                	test   %eax,%eax
+  801f09:	78 4c                	js     801f57 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f0b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f0f:	41 8b 3e             	mov    (%r14),%edi
+  801f12:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f16:	48 b8 48 1c 80 00 00 	movabs $0x801c48,%rax
+  801f1d:	00 00 00 
+  801f20:	ff d0                	call   *%rax
+  801f22:	85 c0                	test   %eax,%eax
+  801f24:	78 35                	js     801f5b <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f26:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801f2a:	83 e0 03             	and    $0x3,%eax
+  801f2d:	83 f8 01             	cmp    $0x1,%eax
+  801f30:	74 2d                	je     801f5f <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f32:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f36:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f3a:	48 85 c0             	test   %rax,%rax
+  801f3d:	74 56                	je     801f95 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801f3f:	4c 89 ea             	mov    %r13,%rdx
+  801f42:	4c 89 e6             	mov    %r12,%rsi
+  801f45:	4c 89 f7             	mov    %r14,%rdi
+  801f48:	ff d0                	call   *%rax
+}
+  801f4a:	48 83 c4 10          	add    $0x10,%rsp
+  801f4e:	5b                   	pop    %rbx
+  801f4f:	41 5c                	pop    %r12
+  801f51:	41 5d                	pop    %r13
+  801f53:	41 5e                	pop    %r14
+  801f55:	5d                   	pop    %rbp
+  801f56:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f57:	48 98                	cltq
+  801f59:	eb ef                	jmp    801f4a <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f5b:	48 98                	cltq
+  801f5d:	eb eb                	jmp    801f4a <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f5f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f66:	00 00 00 
+  801f69:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f6f:	89 da                	mov    %ebx,%edx
+  801f71:	48 bf b1 35 80 00 00 	movabs $0x8035b1,%rdi
+  801f78:	00 00 00 
+  801f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f80:	48 b9 ae 05 80 00 00 	movabs $0x8005ae,%rcx
+  801f87:	00 00 00 
+  801f8a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f8c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f93:	eb b5                	jmp    801f4a <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f95:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f9c:	eb ac                	jmp    801f4a <read+0x6a>
+
+0000000000801f9e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801f9e:	55                   	push   %rbp
+  801f9f:	48 89 e5             	mov    %rsp,%rbp
+  801fa2:	41 57                	push   %r15
+  801fa4:	41 56                	push   %r14
+  801fa6:	41 55                	push   %r13
+  801fa8:	41 54                	push   %r12
+  801faa:	53                   	push   %rbx
+  801fab:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801faf:	48 85 d2             	test   %rdx,%rdx
+  801fb2:	74 54                	je     802008 <readn+0x6a>
+  801fb4:	41 89 fd             	mov    %edi,%r13d
+  801fb7:	49 89 f6             	mov    %rsi,%r14
+  801fba:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801fbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801fc2:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801fc7:	49 bf e0 1e 80 00 00 	movabs $0x801ee0,%r15
+  801fce:	00 00 00 
+  801fd1:	4c 89 e2             	mov    %r12,%rdx
+  801fd4:	48 29 f2             	sub    %rsi,%rdx
+  801fd7:	4c 01 f6             	add    %r14,%rsi
+  801fda:	44 89 ef             	mov    %r13d,%edi
+  801fdd:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801fe0:	85 c0                	test   %eax,%eax
+  801fe2:	78 20                	js     802004 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801fe4:	01 c3                	add    %eax,%ebx
+  801fe6:	85 c0                	test   %eax,%eax
+  801fe8:	74 08                	je     801ff2 <readn+0x54>
+  801fea:	48 63 f3             	movslq %ebx,%rsi
+  801fed:	4c 39 e6             	cmp    %r12,%rsi
+  801ff0:	72 df                	jb     801fd1 <readn+0x33>
+    }
+    return res;
+  801ff2:	48 63 c3             	movslq %ebx,%rax
+}
+  801ff5:	48 83 c4 08          	add    $0x8,%rsp
+  801ff9:	5b                   	pop    %rbx
+  801ffa:	41 5c                	pop    %r12
+  801ffc:	41 5d                	pop    %r13
+  801ffe:	41 5e                	pop    %r14
+  802000:	41 5f                	pop    %r15
+  802002:	5d                   	pop    %rbp
+  802003:	c3                   	ret
+        if (inc < 0) return inc;
+  802004:	48 98                	cltq
+  802006:	eb ed                	jmp    801ff5 <readn+0x57>
+    int inc = 1, res = 0;
+  802008:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80200d:	eb e3                	jmp    801ff2 <readn+0x54>
+
+000000000080200f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80200f:	55                   	push   %rbp
+  802010:	48 89 e5             	mov    %rsp,%rbp
+  802013:	41 56                	push   %r14
+  802015:	41 55                	push   %r13
+  802017:	41 54                	push   %r12
+  802019:	53                   	push   %rbx
+  80201a:	48 83 ec 10          	sub    $0x10,%rsp
+  80201e:	89 fb                	mov    %edi,%ebx
+  802020:	49 89 f4             	mov    %rsi,%r12
+  802023:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802026:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80202a:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  802031:	00 00 00 
+  802034:	ff d0                	call   *%rax
+  802036:	85 c0                	test   %eax,%eax
+  802038:	78 47                	js     802081 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80203a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80203e:	41 8b 3e             	mov    (%r14),%edi
+  802041:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802045:	48 b8 48 1c 80 00 00 	movabs $0x801c48,%rax
+  80204c:	00 00 00 
+  80204f:	ff d0                	call   *%rax
+  802051:	85 c0                	test   %eax,%eax
+  802053:	78 30                	js     802085 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802055:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80205a:	74 2d                	je     802089 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80205c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802060:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802064:	48 85 c0             	test   %rax,%rax
+  802067:	74 56                	je     8020bf <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802069:	4c 89 ea             	mov    %r13,%rdx
+  80206c:	4c 89 e6             	mov    %r12,%rsi
+  80206f:	4c 89 f7             	mov    %r14,%rdi
+  802072:	ff d0                	call   *%rax
+}
+  802074:	48 83 c4 10          	add    $0x10,%rsp
+  802078:	5b                   	pop    %rbx
+  802079:	41 5c                	pop    %r12
+  80207b:	41 5d                	pop    %r13
+  80207d:	41 5e                	pop    %r14
+  80207f:	5d                   	pop    %rbp
+  802080:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802081:	48 98                	cltq
+  802083:	eb ef                	jmp    802074 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802085:	48 98                	cltq
+  802087:	eb eb                	jmp    802074 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802089:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802090:	00 00 00 
+  802093:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802099:	89 da                	mov    %ebx,%edx
+  80209b:	48 bf cd 35 80 00 00 	movabs $0x8035cd,%rdi
+  8020a2:	00 00 00 
+  8020a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020aa:	48 b9 ae 05 80 00 00 	movabs $0x8005ae,%rcx
+  8020b1:	00 00 00 
+  8020b4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020b6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020bd:	eb b5                	jmp    802074 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020bf:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020c6:	eb ac                	jmp    802074 <write+0x65>
+
+00000000008020c8 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8020c8:	55                   	push   %rbp
+  8020c9:	48 89 e5             	mov    %rsp,%rbp
+  8020cc:	53                   	push   %rbx
+  8020cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8020d1:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020d3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020d7:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  8020de:	00 00 00 
+  8020e1:	ff d0                	call   *%rax
+  8020e3:	85 c0                	test   %eax,%eax
+  8020e5:	78 0c                	js     8020f3 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8020e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020eb:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8020ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020f7:	c9                   	leave
+  8020f8:	c3                   	ret
+
+00000000008020f9 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8020f9:	55                   	push   %rbp
+  8020fa:	48 89 e5             	mov    %rsp,%rbp
+  8020fd:	41 55                	push   %r13
+  8020ff:	41 54                	push   %r12
+  802101:	53                   	push   %rbx
+  802102:	48 83 ec 18          	sub    $0x18,%rsp
+  802106:	89 fb                	mov    %edi,%ebx
+  802108:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80210b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80210f:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  802116:	00 00 00 
+  802119:	ff d0                	call   *%rax
+  80211b:	85 c0                	test   %eax,%eax
+  80211d:	78 38                	js     802157 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80211f:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802123:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802127:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80212b:	48 b8 48 1c 80 00 00 	movabs $0x801c48,%rax
+  802132:	00 00 00 
+  802135:	ff d0                	call   *%rax
+  802137:	85 c0                	test   %eax,%eax
+  802139:	78 1c                	js     802157 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80213b:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802140:	74 20                	je     802162 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802142:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802146:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80214a:	48 85 c0             	test   %rax,%rax
+  80214d:	74 47                	je     802196 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80214f:	44 89 e6             	mov    %r12d,%esi
+  802152:	4c 89 ef             	mov    %r13,%rdi
+  802155:	ff d0                	call   *%rax
+}
+  802157:	48 83 c4 18          	add    $0x18,%rsp
+  80215b:	5b                   	pop    %rbx
+  80215c:	41 5c                	pop    %r12
+  80215e:	41 5d                	pop    %r13
+  802160:	5d                   	pop    %rbp
+  802161:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802162:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802169:	00 00 00 
+  80216c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802172:	89 da                	mov    %ebx,%edx
+  802174:	48 bf 90 35 80 00 00 	movabs $0x803590,%rdi
+  80217b:	00 00 00 
+  80217e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802183:	48 b9 ae 05 80 00 00 	movabs $0x8005ae,%rcx
+  80218a:	00 00 00 
+  80218d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80218f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802194:	eb c1                	jmp    802157 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802196:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80219b:	eb ba                	jmp    802157 <ftruncate+0x5e>
+
+000000000080219d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80219d:	55                   	push   %rbp
+  80219e:	48 89 e5             	mov    %rsp,%rbp
+  8021a1:	41 54                	push   %r12
+  8021a3:	53                   	push   %rbx
+  8021a4:	48 83 ec 10          	sub    $0x10,%rsp
+  8021a8:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021ab:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021af:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  8021b6:	00 00 00 
+  8021b9:	ff d0                	call   *%rax
+  8021bb:	85 c0                	test   %eax,%eax
+  8021bd:	78 4e                	js     80220d <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021bf:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8021c3:	41 8b 3c 24          	mov    (%r12),%edi
+  8021c7:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8021cb:	48 b8 48 1c 80 00 00 	movabs $0x801c48,%rax
+  8021d2:	00 00 00 
+  8021d5:	ff d0                	call   *%rax
+  8021d7:	85 c0                	test   %eax,%eax
+  8021d9:	78 32                	js     80220d <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8021db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8021df:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8021e4:	74 30                	je     802216 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8021e6:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8021e9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8021f0:	00 00 00 
+    stat->st_isdir = 0;
+  8021f3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8021fa:	00 00 00 
+    stat->st_dev = dev;
+  8021fd:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802204:	48 89 de             	mov    %rbx,%rsi
+  802207:	4c 89 e7             	mov    %r12,%rdi
+  80220a:	ff 50 28             	call   *0x28(%rax)
+}
+  80220d:	48 83 c4 10          	add    $0x10,%rsp
+  802211:	5b                   	pop    %rbx
+  802212:	41 5c                	pop    %r12
+  802214:	5d                   	pop    %rbp
+  802215:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802216:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80221b:	eb f0                	jmp    80220d <fstat+0x70>
+
+000000000080221d <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80221d:	55                   	push   %rbp
+  80221e:	48 89 e5             	mov    %rsp,%rbp
+  802221:	41 54                	push   %r12
+  802223:	53                   	push   %rbx
+  802224:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802227:	be 00 00 00 00       	mov    $0x0,%esi
+  80222c:	48 b8 9e 24 80 00 00 	movabs $0x80249e,%rax
+  802233:	00 00 00 
+  802236:	ff d0                	call   *%rax
+  802238:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80223a:	85 c0                	test   %eax,%eax
+  80223c:	78 25                	js     802263 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80223e:	4c 89 e6             	mov    %r12,%rsi
+  802241:	89 c7                	mov    %eax,%edi
+  802243:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  80224a:	00 00 00 
+  80224d:	ff d0                	call   *%rax
+  80224f:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802252:	89 df                	mov    %ebx,%edi
+  802254:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  80225b:	00 00 00 
+  80225e:	ff d0                	call   *%rax
+
+    return res;
+  802260:	44 89 e3             	mov    %r12d,%ebx
+}
+  802263:	89 d8                	mov    %ebx,%eax
+  802265:	5b                   	pop    %rbx
+  802266:	41 5c                	pop    %r12
+  802268:	5d                   	pop    %rbp
+  802269:	c3                   	ret
+
+000000000080226a <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  80226a:	55                   	push   %rbp
+  80226b:	48 89 e5             	mov    %rsp,%rbp
+  80226e:	41 54                	push   %r12
+  802270:	53                   	push   %rbx
+  802271:	48 83 ec 10          	sub    $0x10,%rsp
+  802275:	41 89 fc             	mov    %edi,%r12d
+  802278:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80227b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802282:	00 00 00 
+  802285:	83 38 00             	cmpl   $0x0,(%rax)
+  802288:	74 5e                	je     8022e8 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  80228a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802290:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802295:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80229c:	00 00 00 
+  80229f:	44 89 e6             	mov    %r12d,%esi
+  8022a2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8022a9:	00 00 00 
+  8022ac:	8b 38                	mov    (%rax),%edi
+  8022ae:	48 b8 50 2e 80 00 00 	movabs $0x802e50,%rax
+  8022b5:	00 00 00 
+  8022b8:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8022ba:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8022c1:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8022c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022c7:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8022cb:	48 89 de             	mov    %rbx,%rsi
+  8022ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022d3:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  8022da:	00 00 00 
+  8022dd:	ff d0                	call   *%rax
+}
+  8022df:	48 83 c4 10          	add    $0x10,%rsp
+  8022e3:	5b                   	pop    %rbx
+  8022e4:	41 5c                	pop    %r12
+  8022e6:	5d                   	pop    %rbp
+  8022e7:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022e8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022ed:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  8022f4:	00 00 00 
+  8022f7:	ff d0                	call   *%rax
+  8022f9:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802300:	00 00 
+  802302:	eb 86                	jmp    80228a <fsipc+0x20>
+
+0000000000802304 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802304:	55                   	push   %rbp
+  802305:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802308:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80230f:	00 00 00 
+  802312:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802315:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802317:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80231a:	be 00 00 00 00       	mov    $0x0,%esi
+  80231f:	bf 02 00 00 00       	mov    $0x2,%edi
+  802324:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  80232b:	00 00 00 
+  80232e:	ff d0                	call   *%rax
+}
+  802330:	5d                   	pop    %rbp
+  802331:	c3                   	ret
+
+0000000000802332 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802332:	55                   	push   %rbp
+  802333:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802336:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802339:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802340:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802342:	be 00 00 00 00       	mov    $0x0,%esi
+  802347:	bf 06 00 00 00       	mov    $0x6,%edi
+  80234c:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  802353:	00 00 00 
+  802356:	ff d0                	call   *%rax
+}
+  802358:	5d                   	pop    %rbp
+  802359:	c3                   	ret
+
+000000000080235a <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80235a:	55                   	push   %rbp
+  80235b:	48 89 e5             	mov    %rsp,%rbp
+  80235e:	41 54                	push   %r12
+  802360:	53                   	push   %rbx
+  802361:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802364:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802367:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80236e:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802370:	be 00 00 00 00       	mov    $0x0,%esi
+  802375:	bf 05 00 00 00       	mov    $0x5,%edi
+  80237a:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  802381:	00 00 00 
+  802384:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802386:	85 c0                	test   %eax,%eax
+  802388:	78 3d                	js     8023c7 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80238a:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802391:	00 00 00 
+  802394:	4c 89 e6             	mov    %r12,%rsi
+  802397:	48 89 df             	mov    %rbx,%rdi
+  80239a:	48 b8 d3 0e 80 00 00 	movabs $0x800ed3,%rax
+  8023a1:	00 00 00 
+  8023a4:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8023a6:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8023ad:	00 
+  8023ae:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8023b4:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8023bb:	00 
+  8023bc:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8023c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023c7:	5b                   	pop    %rbx
+  8023c8:	41 5c                	pop    %r12
+  8023ca:	5d                   	pop    %rbp
+  8023cb:	c3                   	ret
+
+00000000008023cc <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8023cc:	55                   	push   %rbp
+  8023cd:	48 89 e5             	mov    %rsp,%rbp
+  8023d0:	41 54                	push   %r12
+  8023d2:	53                   	push   %rbx
+  8023d3:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8023d6:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8023db:	48 39 c2             	cmp    %rax,%rdx
+  8023de:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8023e2:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8023e5:	48 89 c2             	mov    %rax,%rdx
+  8023e8:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8023ef:	00 00 00 
+  8023f2:	48 b8 34 11 80 00 00 	movabs $0x801134,%rax
+  8023f9:	00 00 00 
+  8023fc:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8023fe:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802405:	00 00 00 
+  802408:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80240d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  80240f:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  802413:	be 00 00 00 00       	mov    $0x0,%esi
+  802418:	bf 04 00 00 00       	mov    $0x4,%edi
+  80241d:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  802424:	00 00 00 
+  802427:	ff d0                	call   *%rax
+  802429:	48 98                	cltq
+}
+  80242b:	5b                   	pop    %rbx
+  80242c:	41 5c                	pop    %r12
+  80242e:	5d                   	pop    %rbp
+  80242f:	c3                   	ret
+
+0000000000802430 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802430:	55                   	push   %rbp
+  802431:	48 89 e5             	mov    %rsp,%rbp
+  802434:	41 54                	push   %r12
+  802436:	53                   	push   %rbx
+  802437:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80243a:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802441:	00 00 00 
+  802444:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802447:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  802449:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80244e:	48 39 ca             	cmp    %rcx,%rdx
+  802451:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  802455:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  802459:	be 00 00 00 00       	mov    $0x0,%esi
+  80245e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802463:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  80246a:	00 00 00 
+  80246d:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  80246f:	85 c0                	test   %eax,%eax
+  802471:	78 27                	js     80249a <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802473:	48 63 d8             	movslq %eax,%rbx
+  802476:	48 89 da             	mov    %rbx,%rdx
+  802479:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802480:	00 00 00 
+  802483:	4c 89 e7             	mov    %r12,%rdi
+  802486:	48 b8 34 11 80 00 00 	movabs $0x801134,%rax
+  80248d:	00 00 00 
+  802490:	ff d0                	call   *%rax
+    return bytes_read;
+  802492:	48 89 d8             	mov    %rbx,%rax
+}
+  802495:	5b                   	pop    %rbx
+  802496:	41 5c                	pop    %r12
+  802498:	5d                   	pop    %rbp
+  802499:	c3                   	ret
+        return bytes_read;
+  80249a:	48 98                	cltq
+  80249c:	eb f7                	jmp    802495 <devfile_read+0x65>
+
+000000000080249e <open>:
+open(const char *path, int mode) {
+  80249e:	55                   	push   %rbp
+  80249f:	48 89 e5             	mov    %rsp,%rbp
+  8024a2:	41 55                	push   %r13
+  8024a4:	41 54                	push   %r12
+  8024a6:	53                   	push   %rbx
+  8024a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8024ab:	49 89 fc             	mov    %rdi,%r12
+  8024ae:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8024b1:	48 b8 95 0e 80 00 00 	movabs $0x800e95,%rax
+  8024b8:	00 00 00 
+  8024bb:	ff d0                	call   *%rax
+  8024bd:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024c3:	0f 87 8a 00 00 00    	ja     802553 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8024c9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8024cd:	48 b8 9d 1b 80 00 00 	movabs $0x801b9d,%rax
+  8024d4:	00 00 00 
+  8024d7:	ff d0                	call   *%rax
+  8024d9:	89 c3                	mov    %eax,%ebx
+  8024db:	85 c0                	test   %eax,%eax
+  8024dd:	78 50                	js     80252f <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8024df:	4c 89 e6             	mov    %r12,%rsi
+  8024e2:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8024e9:	00 00 00 
+  8024ec:	48 89 df             	mov    %rbx,%rdi
+  8024ef:	48 b8 d3 0e 80 00 00 	movabs $0x800ed3,%rax
+  8024f6:	00 00 00 
+  8024f9:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8024fb:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802502:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802506:	bf 01 00 00 00       	mov    $0x1,%edi
+  80250b:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  802512:	00 00 00 
+  802515:	ff d0                	call   *%rax
+  802517:	89 c3                	mov    %eax,%ebx
+  802519:	85 c0                	test   %eax,%eax
+  80251b:	78 1f                	js     80253c <open+0x9e>
+    return fd2num(fd);
+  80251d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802521:	48 b8 6f 1b 80 00 00 	movabs $0x801b6f,%rax
+  802528:	00 00 00 
+  80252b:	ff d0                	call   *%rax
+  80252d:	89 c3                	mov    %eax,%ebx
+}
+  80252f:	89 d8                	mov    %ebx,%eax
+  802531:	48 83 c4 18          	add    $0x18,%rsp
+  802535:	5b                   	pop    %rbx
+  802536:	41 5c                	pop    %r12
+  802538:	41 5d                	pop    %r13
+  80253a:	5d                   	pop    %rbp
+  80253b:	c3                   	ret
+        fd_close(fd, 0);
+  80253c:	be 00 00 00 00       	mov    $0x0,%esi
+  802541:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802545:	48 b8 b8 1c 80 00 00 	movabs $0x801cb8,%rax
+  80254c:	00 00 00 
+  80254f:	ff d0                	call   *%rax
+        return res;
+  802551:	eb dc                	jmp    80252f <open+0x91>
+        return -E_BAD_PATH;
+  802553:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802558:	eb d5                	jmp    80252f <open+0x91>
+
+000000000080255a <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80255a:	55                   	push   %rbp
+  80255b:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80255e:	be 00 00 00 00       	mov    $0x0,%esi
+  802563:	bf 08 00 00 00       	mov    $0x8,%edi
+  802568:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  80256f:	00 00 00 
+  802572:	ff d0                	call   *%rax
+}
+  802574:	5d                   	pop    %rbp
+  802575:	c3                   	ret
+
+0000000000802576 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  802576:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  80257a:	7f 01                	jg     80257d <writebuf+0x7>
+  80257c:	c3                   	ret
+writebuf(struct printbuf *state) {
+  80257d:	55                   	push   %rbp
+  80257e:	48 89 e5             	mov    %rsp,%rbp
+  802581:	53                   	push   %rbx
+  802582:	48 83 ec 08          	sub    $0x8,%rsp
+  802586:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  802589:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  80258d:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  802591:	8b 3f                	mov    (%rdi),%edi
+  802593:	48 b8 0f 20 80 00 00 	movabs $0x80200f,%rax
+  80259a:	00 00 00 
+  80259d:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  80259f:	48 85 c0             	test   %rax,%rax
+  8025a2:	7e 04                	jle    8025a8 <writebuf+0x32>
+  8025a4:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  8025a8:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  8025ac:	48 39 c2             	cmp    %rax,%rdx
+  8025af:	74 0f                	je     8025c0 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  8025b1:	48 85 c0             	test   %rax,%rax
+  8025b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025b9:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8025bd:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  8025c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025c4:	c9                   	leave
+  8025c5:	c3                   	ret
+
+00000000008025c6 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  8025c6:	8b 46 04             	mov    0x4(%rsi),%eax
+  8025c9:	8d 50 01             	lea    0x1(%rax),%edx
+  8025cc:	89 56 04             	mov    %edx,0x4(%rsi)
+  8025cf:	48 98                	cltq
+  8025d1:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  8025d6:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8025dc:	74 01                	je     8025df <putch+0x19>
+  8025de:	c3                   	ret
+putch(int ch, void *arg) {
+  8025df:	55                   	push   %rbp
+  8025e0:	48 89 e5             	mov    %rsp,%rbp
+  8025e3:	53                   	push   %rbx
+  8025e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8025e8:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  8025eb:	48 89 f7             	mov    %rsi,%rdi
+  8025ee:	48 b8 76 25 80 00 00 	movabs $0x802576,%rax
+  8025f5:	00 00 00 
+  8025f8:	ff d0                	call   *%rax
+        state->offset = 0;
+  8025fa:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  802601:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802605:	c9                   	leave
+  802606:	c3                   	ret
+
+0000000000802607 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  802607:	55                   	push   %rbp
+  802608:	48 89 e5             	mov    %rsp,%rbp
+  80260b:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  802612:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  802615:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  80261b:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  802622:	00 00 00 
+    state.result = 0;
+  802625:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  80262c:	00 00 00 00 
+    state.error = 1;
+  802630:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  802637:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  80263a:	48 89 f2             	mov    %rsi,%rdx
+  80263d:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  802644:	48 bf c6 25 80 00 00 	movabs $0x8025c6,%rdi
+  80264b:	00 00 00 
+  80264e:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  802655:	00 00 00 
+  802658:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  80265a:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  802661:	7f 14                	jg     802677 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  802663:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  80266a:	48 85 c0             	test   %rax,%rax
+  80266d:	75 06                	jne    802675 <vfprintf+0x6e>
+  80266f:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  802675:	c9                   	leave
+  802676:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  802677:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  80267e:	48 b8 76 25 80 00 00 	movabs $0x802576,%rax
+  802685:	00 00 00 
+  802688:	ff d0                	call   *%rax
+  80268a:	eb d7                	jmp    802663 <vfprintf+0x5c>
+
+000000000080268c <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  80268c:	55                   	push   %rbp
+  80268d:	48 89 e5             	mov    %rsp,%rbp
+  802690:	48 83 ec 50          	sub    $0x50,%rsp
+  802694:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802698:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80269c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8026a0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8026a4:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8026ab:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8026af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026b3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8026b7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  8026bb:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8026bf:	48 b8 07 26 80 00 00 	movabs $0x802607,%rax
+  8026c6:	00 00 00 
+  8026c9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8026cb:	c9                   	leave
+  8026cc:	c3                   	ret
+
+00000000008026cd <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8026cd:	55                   	push   %rbp
+  8026ce:	48 89 e5             	mov    %rsp,%rbp
+  8026d1:	48 83 ec 50          	sub    $0x50,%rsp
+  8026d5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8026d9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8026dd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8026e1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8026e5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8026e9:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8026f0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8026f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026f8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8026fc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  802700:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  802704:	48 89 fe             	mov    %rdi,%rsi
+  802707:	bf 01 00 00 00       	mov    $0x1,%edi
+  80270c:	48 b8 07 26 80 00 00 	movabs $0x802607,%rax
+  802713:	00 00 00 
+  802716:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  802718:	c9                   	leave
+  802719:	c3                   	ret
+
+000000000080271a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80271a:	55                   	push   %rbp
+  80271b:	48 89 e5             	mov    %rsp,%rbp
+  80271e:	41 54                	push   %r12
+  802720:	53                   	push   %rbx
+  802721:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802724:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  80272b:	00 00 00 
+  80272e:	ff d0                	call   *%rax
+  802730:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802733:	48 be 20 36 80 00 00 	movabs $0x803620,%rsi
+  80273a:	00 00 00 
+  80273d:	48 89 df             	mov    %rbx,%rdi
+  802740:	48 b8 d3 0e 80 00 00 	movabs $0x800ed3,%rax
+  802747:	00 00 00 
+  80274a:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80274c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802751:	41 2b 04 24          	sub    (%r12),%eax
+  802755:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80275b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802762:	00 00 00 
+    stat->st_dev = &devpipe;
+  802765:	48 b8 80 40 80 00 00 	movabs $0x804080,%rax
+  80276c:	00 00 00 
+  80276f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802776:	b8 00 00 00 00       	mov    $0x0,%eax
+  80277b:	5b                   	pop    %rbx
+  80277c:	41 5c                	pop    %r12
+  80277e:	5d                   	pop    %rbp
+  80277f:	c3                   	ret
+
+0000000000802780 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802780:	55                   	push   %rbp
+  802781:	48 89 e5             	mov    %rsp,%rbp
+  802784:	41 54                	push   %r12
+  802786:	53                   	push   %rbx
+  802787:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80278a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80278f:	48 89 fe             	mov    %rdi,%rsi
+  802792:	bf 00 00 00 00       	mov    $0x0,%edi
+  802797:	49 bc 99 16 80 00 00 	movabs $0x801699,%r12
+  80279e:	00 00 00 
+  8027a1:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8027a4:	48 89 df             	mov    %rbx,%rdi
+  8027a7:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  8027ae:	00 00 00 
+  8027b1:	ff d0                	call   *%rax
+  8027b3:	48 89 c6             	mov    %rax,%rsi
+  8027b6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027c0:	41 ff d4             	call   *%r12
+}
+  8027c3:	5b                   	pop    %rbx
+  8027c4:	41 5c                	pop    %r12
+  8027c6:	5d                   	pop    %rbp
+  8027c7:	c3                   	ret
+
+00000000008027c8 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8027c8:	55                   	push   %rbp
+  8027c9:	48 89 e5             	mov    %rsp,%rbp
+  8027cc:	41 57                	push   %r15
+  8027ce:	41 56                	push   %r14
+  8027d0:	41 55                	push   %r13
+  8027d2:	41 54                	push   %r12
+  8027d4:	53                   	push   %rbx
+  8027d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8027d9:	49 89 fc             	mov    %rdi,%r12
+  8027dc:	49 89 f5             	mov    %rsi,%r13
+  8027df:	49 89 d7             	mov    %rdx,%r15
+  8027e2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8027e6:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  8027ed:	00 00 00 
+  8027f0:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8027f2:	4d 85 ff             	test   %r15,%r15
+  8027f5:	0f 84 af 00 00 00    	je     8028aa <devpipe_write+0xe2>
+  8027fb:	48 89 c3             	mov    %rax,%rbx
+  8027fe:	4c 89 f8             	mov    %r15,%rax
+  802801:	4d 89 ef             	mov    %r13,%r15
+  802804:	4c 01 e8             	add    %r13,%rax
+  802807:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80280b:	49 bd a1 15 80 00 00 	movabs $0x8015a1,%r13
+  802812:	00 00 00 
+            sys_yield();
+  802815:	49 be 3e 15 80 00 00 	movabs $0x80153e,%r14
+  80281c:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80281f:	8b 73 04             	mov    0x4(%rbx),%esi
+  802822:	48 63 ce             	movslq %esi,%rcx
+  802825:	48 63 03             	movslq (%rbx),%rax
+  802828:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80282e:	48 39 c1             	cmp    %rax,%rcx
+  802831:	72 2e                	jb     802861 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802833:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802838:	48 89 da             	mov    %rbx,%rdx
+  80283b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802840:	4c 89 e7             	mov    %r12,%rdi
+  802843:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802846:	85 c0                	test   %eax,%eax
+  802848:	74 66                	je     8028b0 <devpipe_write+0xe8>
+            sys_yield();
+  80284a:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80284d:	8b 73 04             	mov    0x4(%rbx),%esi
+  802850:	48 63 ce             	movslq %esi,%rcx
+  802853:	48 63 03             	movslq (%rbx),%rax
+  802856:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80285c:	48 39 c1             	cmp    %rax,%rcx
+  80285f:	73 d2                	jae    802833 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802861:	41 0f b6 3f          	movzbl (%r15),%edi
+  802865:	48 89 ca             	mov    %rcx,%rdx
+  802868:	48 c1 ea 03          	shr    $0x3,%rdx
+  80286c:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802873:	08 10 20 
+  802876:	48 f7 e2             	mul    %rdx
+  802879:	48 c1 ea 06          	shr    $0x6,%rdx
+  80287d:	48 89 d0             	mov    %rdx,%rax
+  802880:	48 c1 e0 09          	shl    $0x9,%rax
+  802884:	48 29 d0             	sub    %rdx,%rax
+  802887:	48 c1 e0 03          	shl    $0x3,%rax
+  80288b:	48 29 c1             	sub    %rax,%rcx
+  80288e:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802893:	83 c6 01             	add    $0x1,%esi
+  802896:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802899:	49 83 c7 01          	add    $0x1,%r15
+  80289d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028a1:	49 39 c7             	cmp    %rax,%r15
+  8028a4:	0f 85 75 ff ff ff    	jne    80281f <devpipe_write+0x57>
+    return n;
+  8028aa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8028ae:	eb 05                	jmp    8028b5 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8028b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028b5:	48 83 c4 18          	add    $0x18,%rsp
+  8028b9:	5b                   	pop    %rbx
+  8028ba:	41 5c                	pop    %r12
+  8028bc:	41 5d                	pop    %r13
+  8028be:	41 5e                	pop    %r14
+  8028c0:	41 5f                	pop    %r15
+  8028c2:	5d                   	pop    %rbp
+  8028c3:	c3                   	ret
+
+00000000008028c4 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8028c4:	55                   	push   %rbp
+  8028c5:	48 89 e5             	mov    %rsp,%rbp
+  8028c8:	41 57                	push   %r15
+  8028ca:	41 56                	push   %r14
+  8028cc:	41 55                	push   %r13
+  8028ce:	41 54                	push   %r12
+  8028d0:	53                   	push   %rbx
+  8028d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8028d5:	49 89 fc             	mov    %rdi,%r12
+  8028d8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8028dc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028e0:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  8028e7:	00 00 00 
+  8028ea:	ff d0                	call   *%rax
+  8028ec:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8028ef:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8028f5:	49 bd a1 15 80 00 00 	movabs $0x8015a1,%r13
+  8028fc:	00 00 00 
+            sys_yield();
+  8028ff:	49 be 3e 15 80 00 00 	movabs $0x80153e,%r14
+  802906:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802909:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80290e:	74 7d                	je     80298d <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802910:	8b 03                	mov    (%rbx),%eax
+  802912:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802915:	75 26                	jne    80293d <devpipe_read+0x79>
+            if (i > 0) return i;
+  802917:	4d 85 ff             	test   %r15,%r15
+  80291a:	75 77                	jne    802993 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80291c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802921:	48 89 da             	mov    %rbx,%rdx
+  802924:	be 00 10 00 00       	mov    $0x1000,%esi
+  802929:	4c 89 e7             	mov    %r12,%rdi
+  80292c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80292f:	85 c0                	test   %eax,%eax
+  802931:	74 72                	je     8029a5 <devpipe_read+0xe1>
+            sys_yield();
+  802933:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802936:	8b 03                	mov    (%rbx),%eax
+  802938:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80293b:	74 df                	je     80291c <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80293d:	48 63 c8             	movslq %eax,%rcx
+  802940:	48 89 ca             	mov    %rcx,%rdx
+  802943:	48 c1 ea 03          	shr    $0x3,%rdx
+  802947:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80294e:	08 10 20 
+  802951:	48 89 d0             	mov    %rdx,%rax
+  802954:	48 f7 e6             	mul    %rsi
+  802957:	48 c1 ea 06          	shr    $0x6,%rdx
+  80295b:	48 89 d0             	mov    %rdx,%rax
+  80295e:	48 c1 e0 09          	shl    $0x9,%rax
+  802962:	48 29 d0             	sub    %rdx,%rax
+  802965:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80296c:	00 
+  80296d:	48 89 c8             	mov    %rcx,%rax
+  802970:	48 29 d0             	sub    %rdx,%rax
+  802973:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802978:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80297c:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802980:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802983:	49 83 c7 01          	add    $0x1,%r15
+  802987:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80298b:	75 83                	jne    802910 <devpipe_read+0x4c>
+    return n;
+  80298d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802991:	eb 03                	jmp    802996 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802993:	4c 89 f8             	mov    %r15,%rax
+}
+  802996:	48 83 c4 18          	add    $0x18,%rsp
+  80299a:	5b                   	pop    %rbx
+  80299b:	41 5c                	pop    %r12
+  80299d:	41 5d                	pop    %r13
+  80299f:	41 5e                	pop    %r14
+  8029a1:	41 5f                	pop    %r15
+  8029a3:	5d                   	pop    %rbp
+  8029a4:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8029a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029aa:	eb ea                	jmp    802996 <devpipe_read+0xd2>
+
+00000000008029ac <pipe>:
+pipe(int pfd[2]) {
+  8029ac:	55                   	push   %rbp
+  8029ad:	48 89 e5             	mov    %rsp,%rbp
+  8029b0:	41 55                	push   %r13
+  8029b2:	41 54                	push   %r12
+  8029b4:	53                   	push   %rbx
+  8029b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8029b9:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8029bc:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8029c0:	48 b8 9d 1b 80 00 00 	movabs $0x801b9d,%rax
+  8029c7:	00 00 00 
+  8029ca:	ff d0                	call   *%rax
+  8029cc:	89 c3                	mov    %eax,%ebx
+  8029ce:	85 c0                	test   %eax,%eax
+  8029d0:	0f 88 a0 01 00 00    	js     802b76 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8029d6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8029db:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029e0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8029e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029e9:	48 b8 cd 15 80 00 00 	movabs $0x8015cd,%rax
+  8029f0:	00 00 00 
+  8029f3:	ff d0                	call   *%rax
+  8029f5:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8029f7:	85 c0                	test   %eax,%eax
+  8029f9:	0f 88 77 01 00 00    	js     802b76 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8029ff:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802a03:	48 b8 9d 1b 80 00 00 	movabs $0x801b9d,%rax
+  802a0a:	00 00 00 
+  802a0d:	ff d0                	call   *%rax
+  802a0f:	89 c3                	mov    %eax,%ebx
+  802a11:	85 c0                	test   %eax,%eax
+  802a13:	0f 88 43 01 00 00    	js     802b5c <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802a19:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802a1e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a23:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802a27:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a2c:	48 b8 cd 15 80 00 00 	movabs $0x8015cd,%rax
+  802a33:	00 00 00 
+  802a36:	ff d0                	call   *%rax
+  802a38:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802a3a:	85 c0                	test   %eax,%eax
+  802a3c:	0f 88 1a 01 00 00    	js     802b5c <pipe+0x1b0>
+    va = fd2data(fd0);
+  802a42:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802a46:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  802a4d:	00 00 00 
+  802a50:	ff d0                	call   *%rax
+  802a52:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802a55:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802a5a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a5f:	48 89 c6             	mov    %rax,%rsi
+  802a62:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a67:	48 b8 cd 15 80 00 00 	movabs $0x8015cd,%rax
+  802a6e:	00 00 00 
+  802a71:	ff d0                	call   *%rax
+  802a73:	89 c3                	mov    %eax,%ebx
+  802a75:	85 c0                	test   %eax,%eax
+  802a77:	0f 88 c5 00 00 00    	js     802b42 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802a7d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802a81:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  802a88:	00 00 00 
+  802a8b:	ff d0                	call   *%rax
+  802a8d:	48 89 c1             	mov    %rax,%rcx
+  802a90:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802a96:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802a9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aa1:	4c 89 ee             	mov    %r13,%rsi
+  802aa4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aa9:	48 b8 34 16 80 00 00 	movabs $0x801634,%rax
+  802ab0:	00 00 00 
+  802ab3:	ff d0                	call   *%rax
+  802ab5:	89 c3                	mov    %eax,%ebx
+  802ab7:	85 c0                	test   %eax,%eax
+  802ab9:	78 6e                	js     802b29 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802abb:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ac0:	4c 89 ef             	mov    %r13,%rdi
+  802ac3:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  802aca:	00 00 00 
+  802acd:	ff d0                	call   *%rax
+  802acf:	83 f8 02             	cmp    $0x2,%eax
+  802ad2:	0f 85 ab 00 00 00    	jne    802b83 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802ad8:	a1 80 40 80 00 00 00 	movabs 0x804080,%eax
+  802adf:	00 00 
+  802ae1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ae5:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802ae7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802aeb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802af2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802af6:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802af8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802afc:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802b03:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b07:	48 bb 6f 1b 80 00 00 	movabs $0x801b6f,%rbx
+  802b0e:	00 00 00 
+  802b11:	ff d3                	call   *%rbx
+  802b13:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802b17:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802b1b:	ff d3                	call   *%rbx
+  802b1d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802b22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b27:	eb 4d                	jmp    802b76 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802b29:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b2e:	4c 89 ee             	mov    %r13,%rsi
+  802b31:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b36:	48 b8 99 16 80 00 00 	movabs $0x801699,%rax
+  802b3d:	00 00 00 
+  802b40:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802b42:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b47:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802b4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b50:	48 b8 99 16 80 00 00 	movabs $0x801699,%rax
+  802b57:	00 00 00 
+  802b5a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802b5c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b61:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b65:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b6a:	48 b8 99 16 80 00 00 	movabs $0x801699,%rax
+  802b71:	00 00 00 
+  802b74:	ff d0                	call   *%rax
+}
+  802b76:	89 d8                	mov    %ebx,%eax
+  802b78:	48 83 c4 18          	add    $0x18,%rsp
+  802b7c:	5b                   	pop    %rbx
+  802b7d:	41 5c                	pop    %r12
+  802b7f:	41 5d                	pop    %r13
+  802b81:	5d                   	pop    %rbp
+  802b82:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802b83:	48 b9 50 36 80 00 00 	movabs $0x803650,%rcx
+  802b8a:	00 00 00 
+  802b8d:	48 ba 27 36 80 00 00 	movabs $0x803627,%rdx
+  802b94:	00 00 00 
+  802b97:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802b9c:	48 bf 3c 36 80 00 00 	movabs $0x80363c,%rdi
+  802ba3:	00 00 00 
+  802ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bab:	49 b8 5e 04 80 00 00 	movabs $0x80045e,%r8
+  802bb2:	00 00 00 
+  802bb5:	41 ff d0             	call   *%r8
+
+0000000000802bb8 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802bb8:	55                   	push   %rbp
+  802bb9:	48 89 e5             	mov    %rsp,%rbp
+  802bbc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802bc0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802bc4:	48 b8 fd 1b 80 00 00 	movabs $0x801bfd,%rax
+  802bcb:	00 00 00 
+  802bce:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bd0:	85 c0                	test   %eax,%eax
+  802bd2:	78 35                	js     802c09 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802bd4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802bd8:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  802bdf:	00 00 00 
+  802be2:	ff d0                	call   *%rax
+  802be4:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802be7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802bec:	be 00 10 00 00       	mov    $0x1000,%esi
+  802bf1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802bf5:	48 b8 a1 15 80 00 00 	movabs $0x8015a1,%rax
+  802bfc:	00 00 00 
+  802bff:	ff d0                	call   *%rax
+  802c01:	85 c0                	test   %eax,%eax
+  802c03:	0f 94 c0             	sete   %al
+  802c06:	0f b6 c0             	movzbl %al,%eax
+}
+  802c09:	c9                   	leave
+  802c0a:	c3                   	ret
+
+0000000000802c0b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802c0b:	48 89 f8             	mov    %rdi,%rax
+  802c0e:	48 c1 e8 27          	shr    $0x27,%rax
+  802c12:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802c19:	01 00 00 
+  802c1c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c20:	f6 c2 01             	test   $0x1,%dl
+  802c23:	74 6d                	je     802c92 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802c25:	48 89 f8             	mov    %rdi,%rax
+  802c28:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c2c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802c33:	01 00 00 
+  802c36:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c3a:	f6 c2 01             	test   $0x1,%dl
+  802c3d:	74 62                	je     802ca1 <get_uvpt_entry+0x96>
+  802c3f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802c46:	01 00 00 
+  802c49:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c4d:	f6 c2 80             	test   $0x80,%dl
+  802c50:	75 4f                	jne    802ca1 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802c52:	48 89 f8             	mov    %rdi,%rax
+  802c55:	48 c1 e8 15          	shr    $0x15,%rax
+  802c59:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802c60:	01 00 00 
+  802c63:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c67:	f6 c2 01             	test   $0x1,%dl
+  802c6a:	74 44                	je     802cb0 <get_uvpt_entry+0xa5>
+  802c6c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802c73:	01 00 00 
+  802c76:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c7a:	f6 c2 80             	test   $0x80,%dl
+  802c7d:	75 31                	jne    802cb0 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802c7f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802c83:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c8a:	01 00 00 
+  802c8d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802c91:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802c92:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802c99:	01 00 00 
+  802c9c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ca0:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802ca1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802ca8:	01 00 00 
+  802cab:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802caf:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802cb0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802cb7:	01 00 00 
+  802cba:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cbe:	c3                   	ret
+
+0000000000802cbf <get_prot>:
+
+int
+get_prot(void *va) {
+  802cbf:	55                   	push   %rbp
+  802cc0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802cc3:	48 b8 0b 2c 80 00 00 	movabs $0x802c0b,%rax
+  802cca:	00 00 00 
+  802ccd:	ff d0                	call   *%rax
+  802ccf:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802cd2:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802cd7:	89 c1                	mov    %eax,%ecx
+  802cd9:	83 c9 04             	or     $0x4,%ecx
+  802cdc:	f6 c2 01             	test   $0x1,%dl
+  802cdf:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802ce2:	89 c1                	mov    %eax,%ecx
+  802ce4:	83 c9 02             	or     $0x2,%ecx
+  802ce7:	f6 c2 02             	test   $0x2,%dl
+  802cea:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802ced:	89 c1                	mov    %eax,%ecx
+  802cef:	83 c9 01             	or     $0x1,%ecx
+  802cf2:	48 85 d2             	test   %rdx,%rdx
+  802cf5:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802cf8:	89 c1                	mov    %eax,%ecx
+  802cfa:	83 c9 40             	or     $0x40,%ecx
+  802cfd:	f6 c6 04             	test   $0x4,%dh
+  802d00:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802d03:	5d                   	pop    %rbp
+  802d04:	c3                   	ret
+
+0000000000802d05 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802d05:	55                   	push   %rbp
+  802d06:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802d09:	48 b8 0b 2c 80 00 00 	movabs $0x802c0b,%rax
+  802d10:	00 00 00 
+  802d13:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802d15:	48 c1 e8 06          	shr    $0x6,%rax
+  802d19:	83 e0 01             	and    $0x1,%eax
+}
+  802d1c:	5d                   	pop    %rbp
+  802d1d:	c3                   	ret
+
+0000000000802d1e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802d1e:	55                   	push   %rbp
+  802d1f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802d22:	48 b8 0b 2c 80 00 00 	movabs $0x802c0b,%rax
+  802d29:	00 00 00 
+  802d2c:	ff d0                	call   *%rax
+  802d2e:	83 e0 01             	and    $0x1,%eax
+}
+  802d31:	5d                   	pop    %rbp
+  802d32:	c3                   	ret
+
+0000000000802d33 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802d33:	55                   	push   %rbp
+  802d34:	48 89 e5             	mov    %rsp,%rbp
+  802d37:	41 57                	push   %r15
+  802d39:	41 56                	push   %r14
+  802d3b:	41 55                	push   %r13
+  802d3d:	41 54                	push   %r12
+  802d3f:	53                   	push   %rbx
+  802d40:	48 83 ec 18          	sub    $0x18,%rsp
+  802d44:	49 89 ff             	mov    %rdi,%r15
+  802d47:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802d4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802d50:	49 bc 1e 2d 80 00 00 	movabs $0x802d1e,%r12
+  802d57:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802d5a:	49 be bf 2c 80 00 00 	movabs $0x802cbf,%r14
+  802d61:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802d64:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802d6b:	00 00 00 
+  802d6e:	eb 0c                	jmp    802d7c <foreach_shared_region+0x49>
+  802d70:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802d77:	4c 39 eb             	cmp    %r13,%rbx
+  802d7a:	74 38                	je     802db4 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802d7c:	48 89 df             	mov    %rbx,%rdi
+  802d7f:	41 ff d4             	call   *%r12
+  802d82:	84 c0                	test   %al,%al
+  802d84:	74 ea                	je     802d70 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802d86:	48 89 df             	mov    %rbx,%rdi
+  802d89:	41 ff d6             	call   *%r14
+  802d8c:	a8 40                	test   $0x40,%al
+  802d8e:	74 e0                	je     802d70 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802d90:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802d97:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802d9b:	48 89 df             	mov    %rbx,%rdi
+  802d9e:	41 ff d7             	call   *%r15
+        if (err)
+  802da1:	85 c0                	test   %eax,%eax
+  802da3:	74 cb                	je     802d70 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802da5:	48 83 c4 18          	add    $0x18,%rsp
+  802da9:	5b                   	pop    %rbx
+  802daa:	41 5c                	pop    %r12
+  802dac:	41 5d                	pop    %r13
+  802dae:	41 5e                	pop    %r14
+  802db0:	41 5f                	pop    %r15
+  802db2:	5d                   	pop    %rbp
+  802db3:	c3                   	ret
+    return 0;
+  802db4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db9:	eb ea                	jmp    802da5 <foreach_shared_region+0x72>
+
+0000000000802dbb <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802dbb:	55                   	push   %rbp
+  802dbc:	48 89 e5             	mov    %rsp,%rbp
+  802dbf:	41 54                	push   %r12
+  802dc1:	53                   	push   %rbx
+  802dc2:	48 89 fb             	mov    %rdi,%rbx
+  802dc5:	48 89 f7             	mov    %rsi,%rdi
+  802dc8:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802dcb:	48 85 f6             	test   %rsi,%rsi
+  802dce:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802dd5:	00 00 00 
+  802dd8:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802ddc:	be 00 10 00 00       	mov    $0x1000,%esi
+  802de1:	48 b8 37 19 80 00 00 	movabs $0x801937,%rax
+  802de8:	00 00 00 
+  802deb:	ff d0                	call   *%rax
+    if (res < 0) {
+  802ded:	85 c0                	test   %eax,%eax
+  802def:	78 45                	js     802e36 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802df1:	48 85 db             	test   %rbx,%rbx
+  802df4:	74 12                	je     802e08 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802df6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802dfd:	00 00 00 
+  802e00:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802e06:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802e08:	4d 85 e4             	test   %r12,%r12
+  802e0b:	74 14                	je     802e21 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802e0d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e14:	00 00 00 
+  802e17:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802e1d:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802e21:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e28:	00 00 00 
+  802e2b:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802e31:	5b                   	pop    %rbx
+  802e32:	41 5c                	pop    %r12
+  802e34:	5d                   	pop    %rbp
+  802e35:	c3                   	ret
+        if (from_env_store)
+  802e36:	48 85 db             	test   %rbx,%rbx
+  802e39:	74 06                	je     802e41 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802e3b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802e41:	4d 85 e4             	test   %r12,%r12
+  802e44:	74 eb                	je     802e31 <ipc_recv+0x76>
+            *perm_store = 0;
+  802e46:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802e4d:	00 
+  802e4e:	eb e1                	jmp    802e31 <ipc_recv+0x76>
+
+0000000000802e50 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802e50:	55                   	push   %rbp
+  802e51:	48 89 e5             	mov    %rsp,%rbp
+  802e54:	41 57                	push   %r15
+  802e56:	41 56                	push   %r14
+  802e58:	41 55                	push   %r13
+  802e5a:	41 54                	push   %r12
+  802e5c:	53                   	push   %rbx
+  802e5d:	48 83 ec 18          	sub    $0x18,%rsp
+  802e61:	41 89 fd             	mov    %edi,%r13d
+  802e64:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802e67:	48 89 d3             	mov    %rdx,%rbx
+  802e6a:	49 89 cc             	mov    %rcx,%r12
+  802e6d:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802e71:	48 85 d2             	test   %rdx,%rdx
+  802e74:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802e7b:	00 00 00 
+  802e7e:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802e82:	49 be 0b 19 80 00 00 	movabs $0x80190b,%r14
+  802e89:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802e8c:	49 bf 3e 15 80 00 00 	movabs $0x80153e,%r15
+  802e93:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802e96:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802e99:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802e9d:	4c 89 e1             	mov    %r12,%rcx
+  802ea0:	48 89 da             	mov    %rbx,%rdx
+  802ea3:	44 89 ef             	mov    %r13d,%edi
+  802ea6:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802ea9:	85 c0                	test   %eax,%eax
+  802eab:	74 34                	je     802ee1 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802ead:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802eb0:	75 05                	jne    802eb7 <ipc_send+0x67>
+        sys_yield();
+  802eb2:	41 ff d7             	call   *%r15
+    while (true) {
+  802eb5:	eb df                	jmp    802e96 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802eb7:	48 ba 74 36 80 00 00 	movabs $0x803674,%rdx
+  802ebe:	00 00 00 
+  802ec1:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802ec6:	48 bf 8d 36 80 00 00 	movabs $0x80368d,%rdi
+  802ecd:	00 00 00 
+  802ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ed5:	48 b9 5e 04 80 00 00 	movabs $0x80045e,%rcx
+  802edc:	00 00 00 
+  802edf:	ff d1                	call   *%rcx
+    }
+}
+  802ee1:	48 83 c4 18          	add    $0x18,%rsp
+  802ee5:	5b                   	pop    %rbx
+  802ee6:	41 5c                	pop    %r12
+  802ee8:	41 5d                	pop    %r13
+  802eea:	41 5e                	pop    %r14
+  802eec:	41 5f                	pop    %r15
+  802eee:	5d                   	pop    %rbp
+  802eef:	c3                   	ret
+
+0000000000802ef0 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802ef5:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802efc:	00 00 00 
+  802eff:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802f06:	48 01 ca             	add    %rcx,%rdx
+  802f09:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802f0f:	39 fa                	cmp    %edi,%edx
+  802f11:	74 12                	je     802f25 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802f13:	48 83 c0 01          	add    $0x1,%rax
+  802f17:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802f1d:	75 e0                	jne    802eff <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802f1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f24:	c3                   	ret
+            return envs[i].env_id;
+  802f25:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802f2c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802f33:	00 00 00 
+  802f36:	48 01 d0             	add    %rdx,%rax
+  802f39:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802f3f:	c3                   	ret
+
+0000000000802f40 <__rodata_start>:
+  802f40:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f41:	70 65                	jo     802fa8 <__rodata_start+0x68>
+  802f43:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f44:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  802f47:	73 3a                	jae    802f83 <__rodata_start+0x43>
+  802f49:	20 25 69 00 75 73    	and    %ah,0x73750069(%rip)        # 73f52fb8 <__bss_end+0x7374afb8>
+  802f4f:	65 72 2f             	gs jb  802f81 <__rodata_start+0x41>
+  802f52:	74 65                	je     802fb9 <__rodata_start+0x79>
+  802f54:	73 74                	jae    802fca <__rodata_start+0x8a>
+  802f56:	6b 62 64 2e          	imul   $0x2e,0x64(%rdx),%esp
+  802f5a:	63 00                	movsxd (%rax),%eax
+  802f5c:	66 69 72 73 74 20    	imul   $0x2074,0x73(%rdx),%si
+  802f62:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f63:	70 65                	jo     802fca <__rodata_start+0x8a>
+  802f65:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f66:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  802f69:	73 20                	jae    802f8b <__rodata_start+0x4b>
+  802f6b:	75 73                	jne    802fe0 <__rodata_start+0xa0>
+  802f6d:	65 64 20 66 64       	gs and %ah,%fs:0x64(%rsi)
+  802f72:	20 25 64 00 64 75    	and    %ah,0x75640064(%rip)        # 75e42fdc <__bss_end+0x7563afdc>
+  802f78:	70 3a                	jo     802fb4 <__rodata_start+0x74>
+  802f7a:	20 25 69 00 54 79    	and    %ah,0x79540069(%rip)        # 79d42fe9 <__bss_end+0x7953afe9>
+  802f80:	70 65                	jo     802fe7 <__rodata_start+0xa7>
+  802f82:	20 61 20             	and    %ah,0x20(%rcx)
+  802f85:	6c                   	insb   (%dx),%es:(%rdi)
+  802f86:	69 6e 65 3a 20 00 25 	imul   $0x2500203a,0x65(%rsi),%ebp
+  802f8d:	73 0a                	jae    802f99 <__rodata_start+0x59>
+  802f8f:	00 28                	add    %ch,(%rax)
+  802f91:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f93:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802f97:	20 66 69             	and    %ah,0x69(%rsi)
+  802f9a:	6c                   	insb   (%dx),%es:(%rdi)
+  802f9b:	65 20 72 65          	and    %dh,%gs:0x65(%rdx)
+  802f9f:	63 65 69             	movsxd 0x69(%rbp),%esp
+  802fa2:	76 65                	jbe    803009 <__rodata_start+0xc9>
+  802fa4:	64 29 0a             	sub    %ecx,%fs:(%rdx)
+  802fa7:	00 3c 63             	add    %bh,(%rbx,%riz,2)
+  802faa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fab:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fac:	73 3e                	jae    802fec <__rodata_start+0xac>
+  802fae:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802fb1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fb2:	73 00                	jae    802fb4 <__rodata_start+0x74>
+  802fb4:	3c 75                	cmp    $0x75,%al
+  802fb6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fb7:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802fbb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fbc:	3e 00 66 90          	ds add %ah,-0x70(%rsi)
+  802fc0:	5b                   	pop    %rbx
+  802fc1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802fc6:	20 75 73             	and    %dh,0x73(%rbp)
+  802fc9:	65 72 20             	gs jb  802fec <__rodata_start+0xac>
+  802fcc:	70 61                	jo     80302f <__rodata_start+0xef>
+  802fce:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fcf:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  802fd6:	73 20                	jae    802ff8 <__rodata_start+0xb8>
+  802fd8:	61                   	(bad)
+  802fd9:	74 20                	je     802ffb <__rodata_start+0xbb>
+  802fdb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  802fe0:	3a 20                	cmp    (%rax),%ah
+  802fe2:	00 30                	add    %dh,(%rax)
+  802fe4:	31 32                	xor    %esi,(%rdx)
+  802fe6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802fed:	41                   	rex.B
+  802fee:	42                   	rex.X
+  802fef:	43                   	rex.XB
+  802ff0:	44                   	rex.R
+  802ff1:	45                   	rex.RB
+  802ff2:	46 00 30             	rex.RX add %r14b,(%rax)
+  802ff5:	31 32                	xor    %esi,(%rdx)
+  802ff7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802ffe:	61                   	(bad)
+  802fff:	62 63 64 65 66       	(bad)
+  803004:	00 28                	add    %ch,(%rax)
+  803006:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803007:	75 6c                	jne    803075 <__rodata_start+0x135>
+  803009:	6c                   	insb   (%dx),%es:(%rdi)
+  80300a:	29 00                	sub    %eax,(%rax)
+  80300c:	65 72 72             	gs jb  803081 <__rodata_start+0x141>
+  80300f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803010:	72 20                	jb     803032 <__rodata_start+0xf2>
+  803012:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803017:	73 70                	jae    803089 <__rodata_start+0x149>
+  803019:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80301d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803024:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803025:	72 00                	jb     803027 <__rodata_start+0xe7>
+  803027:	62 61 64 20 65       	(bad)
+  80302c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80302d:	76 69                	jbe    803098 <__rodata_start+0x158>
+  80302f:	72 6f                	jb     8030a0 <__rodata_start+0x160>
+  803031:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803032:	6d                   	insl   (%dx),%es:(%rdi)
+  803033:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803035:	74 00                	je     803037 <__rodata_start+0xf7>
+  803037:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80303e:	20 70 61             	and    %dh,0x61(%rax)
+  803041:	72 61                	jb     8030a4 <__rodata_start+0x164>
+  803043:	6d                   	insl   (%dx),%es:(%rdi)
+  803044:	65 74 65             	gs je  8030ac <__rodata_start+0x16c>
+  803047:	72 00                	jb     803049 <__rodata_start+0x109>
+  803049:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80304a:	75 74                	jne    8030c0 <__rodata_start+0x180>
+  80304c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80304f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803052:	6d                   	insl   (%dx),%es:(%rdi)
+  803053:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803054:	72 79                	jb     8030cf <__rodata_start+0x18f>
+  803056:	00 6f 75             	add    %ch,0x75(%rdi)
+  803059:	74 20                	je     80307b <__rodata_start+0x13b>
+  80305b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80305c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803060:	76 69                	jbe    8030cb <__rodata_start+0x18b>
+  803062:	72 6f                	jb     8030d3 <__rodata_start+0x193>
+  803064:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803065:	6d                   	insl   (%dx),%es:(%rdi)
+  803066:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803068:	74 73                	je     8030dd <__rodata_start+0x19d>
+  80306a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80306d:	72 72                	jb     8030e1 <__rodata_start+0x1a1>
+  80306f:	75 70                	jne    8030e1 <__rodata_start+0x1a1>
+  803071:	74 65                	je     8030d8 <__rodata_start+0x198>
+  803073:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803078:	75 67                	jne    8030e1 <__rodata_start+0x1a1>
+  80307a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80307d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80307f:	00 73 65             	add    %dh,0x65(%rbx)
+  803082:	67 6d                	insl   (%dx),%es:(%edi)
+  803084:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803086:	74 61                	je     8030e9 <__rodata_start+0x1a9>
+  803088:	74 69                	je     8030f3 <__rodata_start+0x1b3>
+  80308a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80308b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80308c:	20 66 61             	and    %ah,0x61(%rsi)
+  80308f:	75 6c                	jne    8030fd <__rodata_start+0x1bd>
+  803091:	74 00                	je     803093 <__rodata_start+0x153>
+  803093:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80309a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80309d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8030a1:	61                   	(bad)
+  8030a2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8030a7:	20 73 75             	and    %dh,0x75(%rbx)
+  8030aa:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8030ad:	73 79                	jae    803128 <__rodata_start+0x1e8>
+  8030af:	73 74                	jae    803125 <__rodata_start+0x1e5>
+  8030b1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8030b3:	20 63 61             	and    %ah,0x61(%rbx)
+  8030b6:	6c                   	insb   (%dx),%es:(%rdi)
+  8030b7:	6c                   	insb   (%dx),%es:(%rdi)
+  8030b8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8030bb:	74 72                	je     80312f <__rodata_start+0x1ef>
+  8030bd:	79 20                	jns    8030df <__rodata_start+0x19f>
+  8030bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030c0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030c1:	74 20                	je     8030e3 <__rodata_start+0x1a3>
+  8030c3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8030c5:	75 6e                	jne    803135 <__rodata_start+0x1f5>
+  8030c7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8030cb:	76 20                	jbe    8030ed <__rodata_start+0x1ad>
+  8030cd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8030d4:	72 65                	jb     80313b <__rodata_start+0x1fb>
+  8030d6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8030d9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030da:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8030de:	65 78 70             	gs js  803151 <__rodata_start+0x211>
+  8030e1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8030e6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8030e9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8030ed:	20 66 69             	and    %ah,0x69(%rsi)
+  8030f0:	6c                   	insb   (%dx),%es:(%rdi)
+  8030f1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8030f5:	20 66 72             	and    %ah,0x72(%rsi)
+  8030f8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8030fd:	61                   	(bad)
+  8030fe:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803101:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803102:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803103:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803107:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80310a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80310b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80310c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80310f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803110:	79 20                	jns    803132 <__rodata_start+0x1f2>
+  803112:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803119:	72 65                	jb     803180 <__rodata_start+0x240>
+  80311b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80311e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803120:	00 66 69             	add    %ah,0x69(%rsi)
+  803123:	6c                   	insb   (%dx),%es:(%rdi)
+  803124:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803128:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80312b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80312c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80312f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803130:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803131:	74 20                	je     803153 <__rodata_start+0x213>
+  803133:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803135:	75 6e                	jne    8031a5 <__rodata_start+0x265>
+  803137:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80313b:	76 61                	jbe    80319e <__rodata_start+0x25e>
+  80313d:	6c                   	insb   (%dx),%es:(%rdi)
+  80313e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803145:	00 
+  803146:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80314d:	72 65                	jb     8031b4 <__rodata_start+0x274>
+  80314f:	61                   	(bad)
+  803150:	64 79 20             	fs jns 803173 <__rodata_start+0x233>
+  803153:	65 78 69             	gs js  8031bf <__rodata_start+0x27f>
+  803156:	73 74                	jae    8031cc <__rodata_start+0x28c>
+  803158:	73 00                	jae    80315a <__rodata_start+0x21a>
+  80315a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80315b:	70 65                	jo     8031c2 <__rodata_start+0x282>
+  80315d:	72 61                	jb     8031c0 <__rodata_start+0x280>
+  80315f:	74 69                	je     8031ca <__rodata_start+0x28a>
+  803161:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803162:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803163:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803166:	74 20                	je     803188 <__rodata_start+0x248>
+  803168:	73 75                	jae    8031df <__rodata_start+0x29f>
+  80316a:	70 70                	jo     8031dc <__rodata_start+0x29c>
+  80316c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80316d:	72 74                	jb     8031e3 <__rodata_start+0x2a3>
+  80316f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803174:	65 72 61             	gs jb  8031d8 <__rodata_start+0x298>
+  803177:	74 69                	je     8031e2 <__rodata_start+0x2a2>
+  803179:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80317a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80317b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80317e:	74 20                	je     8031a0 <__rodata_start+0x260>
+  803180:	70 65                	jo     8031e7 <__rodata_start+0x2a7>
+  803182:	72 6d                	jb     8031f1 <__rodata_start+0x2b1>
+  803184:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  80318b:	2e 
+  80318c:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803193:	00 
+  803194:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80319b:	00 00 00 
+  80319e:	66 90                	xchg   %ax,%ax
+  8031a0:	9b                   	fwait
+  8031a1:	07                   	(bad)
+  8031a2:	80 00 00             	addb   $0x0,(%rax)
+  8031a5:	00 00                	add    %al,(%rax)
+  8031a7:	00 dc                	add    %bl,%ah
+  8031a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8031ae:	00 00                	add    %al,(%rax)
+  8031b0:	cc                   	int3
+  8031b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8031b6:	00 00                	add    %al,(%rax)
+  8031b8:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80323e <__rodata_start+0x2fe>
+  8031be:	00 00                	add    %al,(%rax)
+  8031c0:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803246 <__rodata_start+0x306>
+  8031c6:	00 00                	add    %al,(%rax)
+  8031c8:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80324e <__rodata_start+0x30e>
+  8031ce:	00 00                	add    %al,(%rax)
+  8031d0:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803256 <__rodata_start+0x316>
+  8031d6:	00 00                	add    %al,(%rax)
+  8031d8:	ba 07 80 00 00       	mov    $0x8007,%edx
+  8031dd:	00 00                	add    %al,(%rax)
+  8031df:	00 dc                	add    %bl,%ah
+  8031e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8031e6:	00 00                	add    %al,(%rax)
+  8031e8:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80326e <__rodata_start+0x32e>
+  8031ee:	00 00                	add    %al,(%rax)
+  8031f0:	ae                   	scas   %es:(%rdi),%al
+  8031f1:	07                   	(bad)
+  8031f2:	80 00 00             	addb   $0x0,(%rax)
+  8031f5:	00 00                	add    %al,(%rax)
+  8031f7:	00 28                	add    %ch,(%rax)
+  8031f9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8031ff:	00 dc                	add    %bl,%ah
+  803201:	0d 80 00 00 00       	or     $0x80,%eax
+  803206:	00 00                	add    %al,(%rax)
+  803208:	ae                   	scas   %es:(%rdi),%al
+  803209:	07                   	(bad)
+  80320a:	80 00 00             	addb   $0x0,(%rax)
+  80320d:	00 00                	add    %al,(%rax)
+  80320f:	00 f4                	add    %dh,%ah
+  803211:	07                   	(bad)
+  803212:	80 00 00             	addb   $0x0,(%rax)
+  803215:	00 00                	add    %al,(%rax)
+  803217:	00 f4                	add    %dh,%ah
+  803219:	07                   	(bad)
+  80321a:	80 00 00             	addb   $0x0,(%rax)
+  80321d:	00 00                	add    %al,(%rax)
+  80321f:	00 f4                	add    %dh,%ah
+  803221:	07                   	(bad)
+  803222:	80 00 00             	addb   $0x0,(%rax)
+  803225:	00 00                	add    %al,(%rax)
+  803227:	00 f4                	add    %dh,%ah
+  803229:	07                   	(bad)
+  80322a:	80 00 00             	addb   $0x0,(%rax)
+  80322d:	00 00                	add    %al,(%rax)
+  80322f:	00 f4                	add    %dh,%ah
+  803231:	07                   	(bad)
+  803232:	80 00 00             	addb   $0x0,(%rax)
+  803235:	00 00                	add    %al,(%rax)
+  803237:	00 f4                	add    %dh,%ah
+  803239:	07                   	(bad)
+  80323a:	80 00 00             	addb   $0x0,(%rax)
+  80323d:	00 00                	add    %al,(%rax)
+  80323f:	00 f4                	add    %dh,%ah
+  803241:	07                   	(bad)
+  803242:	80 00 00             	addb   $0x0,(%rax)
+  803245:	00 00                	add    %al,(%rax)
+  803247:	00 f4                	add    %dh,%ah
+  803249:	07                   	(bad)
+  80324a:	80 00 00             	addb   $0x0,(%rax)
+  80324d:	00 00                	add    %al,(%rax)
+  80324f:	00 f4                	add    %dh,%ah
+  803251:	07                   	(bad)
+  803252:	80 00 00             	addb   $0x0,(%rax)
+  803255:	00 00                	add    %al,(%rax)
+  803257:	00 dc                	add    %bl,%ah
+  803259:	0d 80 00 00 00       	or     $0x80,%eax
+  80325e:	00 00                	add    %al,(%rax)
+  803260:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 8032e6 <__rodata_start+0x3a6>
+  803266:	00 00                	add    %al,(%rax)
+  803268:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 8032ee <__rodata_start+0x3ae>
+  80326e:	00 00                	add    %al,(%rax)
+  803270:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 8032f6 <__rodata_start+0x3b6>
+  803276:	00 00                	add    %al,(%rax)
+  803278:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 8032fe <__rodata_start+0x3be>
+  80327e:	00 00                	add    %al,(%rax)
+  803280:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803306 <__rodata_start+0x3c6>
+  803286:	00 00                	add    %al,(%rax)
+  803288:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80330e <__rodata_start+0x3ce>
+  80328e:	00 00                	add    %al,(%rax)
+  803290:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803316 <__rodata_start+0x3d6>
+  803296:	00 00                	add    %al,(%rax)
+  803298:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80331e <__rodata_start+0x3de>
+  80329e:	00 00                	add    %al,(%rax)
+  8032a0:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803326 <__rodata_start+0x3e6>
+  8032a6:	00 00                	add    %al,(%rax)
+  8032a8:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80332e <__rodata_start+0x3ee>
+  8032ae:	00 00                	add    %al,(%rax)
+  8032b0:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803336 <__rodata_start+0x3f6>
+  8032b6:	00 00                	add    %al,(%rax)
+  8032b8:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80333e <__rodata_start+0x3fe>
+  8032be:	00 00                	add    %al,(%rax)
+  8032c0:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803346 <__rodata_start+0x406>
+  8032c6:	00 00                	add    %al,(%rax)
+  8032c8:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80334e <__rodata_start+0x40e>
+  8032ce:	00 00                	add    %al,(%rax)
+  8032d0:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803356 <__rodata_start+0x416>
+  8032d6:	00 00                	add    %al,(%rax)
+  8032d8:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80335e <__rodata_start+0x41e>
+  8032de:	00 00                	add    %al,(%rax)
+  8032e0:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803366 <__rodata_start+0x426>
+  8032e6:	00 00                	add    %al,(%rax)
+  8032e8:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80336e <__rodata_start+0x42e>
+  8032ee:	00 00                	add    %al,(%rax)
+  8032f0:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803376 <__rodata_start+0x436>
+  8032f6:	00 00                	add    %al,(%rax)
+  8032f8:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80337e <__rodata_start+0x43e>
+  8032fe:	00 00                	add    %al,(%rax)
+  803300:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803386 <__rodata_start+0x446>
+  803306:	00 00                	add    %al,(%rax)
+  803308:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80338e <__rodata_start+0x44e>
+  80330e:	00 00                	add    %al,(%rax)
+  803310:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803396 <__rodata_start+0x456>
+  803316:	00 00                	add    %al,(%rax)
+  803318:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80339e <__rodata_start+0x45e>
+  80331e:	00 00                	add    %al,(%rax)
+  803320:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 8033a6 <__rodata_start+0x466>
+  803326:	00 00                	add    %al,(%rax)
+  803328:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 8033ae <__rodata_start+0x46e>
+  80332e:	00 00                	add    %al,(%rax)
+  803330:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 8033b6 <__rodata_start+0x476>
+  803336:	00 00                	add    %al,(%rax)
+  803338:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 8033be <__rodata_start+0x47e>
+  80333e:	00 00                	add    %al,(%rax)
+  803340:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 8033c6 <__rodata_start+0x486>
+  803346:	00 00                	add    %al,(%rax)
+  803348:	ff 0c 80             	decl   (%rax,%rax,4)
+  80334b:	00 00                	add    %al,(%rax)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 dc                	add    %bl,%ah
+  803351:	0d 80 00 00 00       	or     $0x80,%eax
+  803356:	00 00                	add    %al,(%rax)
+  803358:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 8033de <__rodata_start+0x49e>
+  80335e:	00 00                	add    %al,(%rax)
+  803360:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 8033e6 <__rodata_start+0x4a6>
+  803366:	00 00                	add    %al,(%rax)
+  803368:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 8033ee <__rodata_start+0x4ae>
+  80336e:	00 00                	add    %al,(%rax)
+  803370:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 8033f6 <__rodata_start+0x4b6>
+  803376:	00 00                	add    %al,(%rax)
+  803378:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 8033fe <__rodata_start+0x4be>
+  80337e:	00 00                	add    %al,(%rax)
+  803380:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803406 <__rodata_start+0x4c6>
+  803386:	00 00                	add    %al,(%rax)
+  803388:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80340e <__rodata_start+0x4ce>
+  80338e:	00 00                	add    %al,(%rax)
+  803390:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803416 <__rodata_start+0x4d6>
+  803396:	00 00                	add    %al,(%rax)
+  803398:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80341e <__rodata_start+0x4de>
+  80339e:	00 00                	add    %al,(%rax)
+  8033a0:	4b 08 80 00 00 00 00 	rex.WXB or %al,0x0(%r8)
+  8033a7:	00 1a                	add    %bl,(%rdx)
+  8033a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8033af:	00 dc                	add    %bl,%ah
+  8033b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8033b6:	00 00                	add    %al,(%rax)
+  8033b8:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80343e <__rodata_start+0x4fe>
+  8033be:	00 00                	add    %al,(%rax)
+  8033c0:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803446 <__rodata_start+0x506>
+  8033c6:	00 00                	add    %al,(%rax)
+  8033c8:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80344e <__rodata_start+0x50e>
+  8033ce:	00 00                	add    %al,(%rax)
+  8033d0:	7a 08                	jp     8033da <__rodata_start+0x49a>
+  8033d2:	80 00 00             	addb   $0x0,(%rax)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 dc                	add    %bl,%ah
+  8033d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8033de:	00 00                	add    %al,(%rax)
+  8033e0:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803466 <error_string+0x6>
+  8033e6:	00 00                	add    %al,(%rax)
+  8033e8:	40 08 80 00 00 00 00 	rex or %al,0x0(%rax)
+  8033ef:	00 dc                	add    %bl,%ah
+  8033f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8033f6:	00 00                	add    %al,(%rax)
+  8033f8:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80347e <error_string+0x1e>
+  8033fe:	00 00                	add    %al,(%rax)
+  803400:	c2 0b 80             	ret    $0x800b
+  803403:	00 00                	add    %al,(%rax)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 8c 0c 80 00 00 00 	add    %cl,0x80(%rsp,%rcx,1)
+  80340e:	00 00                	add    %al,(%rax)
+  803410:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 803496 <error_string+0x36>
+  803416:	00 00                	add    %al,(%rax)
+  803418:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 80349e <error_string+0x3e>
+  80341e:	00 00                	add    %al,(%rax)
+  803420:	11 09                	adc    %ecx,(%rcx)
+  803422:	80 00 00             	addb   $0x0,(%rax)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 dc                	add    %bl,%ah
+  803429:	0d 80 00 00 00       	or     $0x80,%eax
+  80342e:	00 00                	add    %al,(%rax)
+  803430:	ee                   	out    %al,(%dx)
+  803431:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803437:	00 dc                	add    %bl,%ah
+  803439:	0d 80 00 00 00       	or     $0x80,%eax
+  80343e:	00 00                	add    %al,(%rax)
+  803440:	dc 0d 80 00 00 00    	fmull  0x80(%rip)        # 8034c6 <error_string+0x66>
+  803446:	00 00                	add    %al,(%rax)
+  803448:	ff 0c 80             	decl   (%rax,%rax,4)
+  80344b:	00 00                	add    %al,(%rax)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 dc                	add    %bl,%ah
+  803451:	0d 80 00 00 00       	or     $0x80,%eax
+  803456:	00 00                	add    %al,(%rax)
+  803458:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  803459:	07                   	(bad)
+  80345a:	80 00 00             	addb   $0x0,(%rax)
+  80345d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803460 <error_string>:
+	...
+  803468:	15 30 80 00 00 00 00 00 27 30 80 00 00 00 00 00     .0......'0......
+  803478:	37 30 80 00 00 00 00 00 49 30 80 00 00 00 00 00     70......I0......
+  803488:	57 30 80 00 00 00 00 00 6b 30 80 00 00 00 00 00     W0......k0......
+  803498:	80 30 80 00 00 00 00 00 93 30 80 00 00 00 00 00     .0.......0......
+  8034a8:	a5 30 80 00 00 00 00 00 b9 30 80 00 00 00 00 00     .0.......0......
+  8034b8:	c9 30 80 00 00 00 00 00 dc 30 80 00 00 00 00 00     .0.......0......
+  8034c8:	f3 30 80 00 00 00 00 00 09 31 80 00 00 00 00 00     .0.......1......
+  8034d8:	21 31 80 00 00 00 00 00 39 31 80 00 00 00 00 00     !1......91......
+  8034e8:	46 31 80 00 00 00 00 00 10 35 80 00 00 00 00 00     F1.......5......
+  8034f8:	5a 31 80 00 00 00 00 00 00 00 00 00 00 00 00 00     Z1..............
+  803508:	72 31 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     r1......file is 
+  803518:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803528:	75 74 61 62 6c 65 00 72 65 61 64 20 65 72 72 6f     utable.read erro
+  803538:	72 3a 20 25 69 0a 00 90 73 79 73 63 61 6c 6c 20     r: %i...syscall 
+  803548:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803558:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803568:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803578:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803588:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803598:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8035a8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8035b8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8035c8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8035d8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8035e8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035f8:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000803600 <devtab>:
+  803600:	40 40 80 00 00 00 00 00 80 40 80 00 00 00 00 00     @@.......@......
+  803610:	00 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803620:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803630:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803640:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803650:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803660:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803670:	3d 20 32 00 69 70 63 5f 73 65 6e 64 3a 20 66 61     = 2.ipc_send: fa
+  803680:	69 6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62     iled to send.lib
+  803690:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8036a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803700:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803710:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803720:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803730:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803740:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803750:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803760:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803770:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803780:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803790:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803800:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803810:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803820:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803830:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803840:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803850:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803860:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803870:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803880:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803890:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803900:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803910:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803920:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803930:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803940:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803950:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803960:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803970:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803980:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803990:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803aa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ab0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ac0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ad0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ae0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803af0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ba0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803be0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ca0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ce0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
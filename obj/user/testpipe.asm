@@ -0,0 +1,6283 @@
+
+obj/user/testpipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 85 04 00 00       	call   8004a8 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+char *msg = "Now is the time for all good men to come to the aid of their party.";
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 78          	sub    $0x78,%rsp
+    char buf[100];
+    int i, pid, p[2];
+
+    binaryname = "pipereadeof";
+  800036:	48 b8 48 31 80 00 00 	movabs $0x803148,%rax
+  80003d:	00 00 00 
+  800040:	48 a3 08 40 80 00 00 	movabs %rax,0x804008
+  800047:	00 00 00 
+
+    if ((i = pipe(p)) < 0)
+  80004a:	48 8d bd 64 ff ff ff 	lea    -0x9c(%rbp),%rdi
+  800051:	48 b8 d2 28 80 00 00 	movabs $0x8028d2,%rax
+  800058:	00 00 00 
+  80005b:	ff d0                	call   *%rax
+  80005d:	41 89 c4             	mov    %eax,%r12d
+  800060:	85 c0                	test   %eax,%eax
+  800062:	0f 88 b3 01 00 00    	js     80021b <umain+0x1f6>
+        panic("pipe: %i", i);
+
+    if ((pid = fork()) < 0)
+  800068:	48 b8 39 1b 80 00 00 	movabs $0x801b39,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	89 c3                	mov    %eax,%ebx
+  800076:	85 c0                	test   %eax,%eax
+  800078:	0f 88 ca 01 00 00    	js     800248 <umain+0x223>
+        panic("fork: %i", i);
+
+    if (pid == 0) {
+  80007e:	0f 85 49 02 00 00    	jne    8002cd <umain+0x2a8>
+        cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  800084:	49 bd 00 50 80 00 00 	movabs $0x805000,%r13
+  80008b:	00 00 00 
+  80008e:	49 8b 45 00          	mov    0x0(%r13),%rax
+  800092:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800098:	8b 95 68 ff ff ff    	mov    -0x98(%rbp),%edx
+  80009e:	48 bf 76 31 80 00 00 	movabs $0x803176,%rdi
+  8000a5:	00 00 00 
+  8000a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ad:	49 bc c2 06 80 00 00 	movabs $0x8006c2,%r12
+  8000b4:	00 00 00 
+  8000b7:	41 ff d4             	call   *%r12
+        close(p[1]);
+  8000ba:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  8000c0:	48 b8 2c 1e 80 00 00 	movabs $0x801e2c,%rax
+  8000c7:	00 00 00 
+  8000ca:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  8000cc:	49 8b 45 00          	mov    0x0(%r13),%rax
+  8000d0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8000d6:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+  8000dc:	48 bf 93 31 80 00 00 	movabs $0x803193,%rdi
+  8000e3:	00 00 00 
+  8000e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000eb:	41 ff d4             	call   *%r12
+        i = readn(p[0], buf, sizeof buf - 1);
+  8000ee:	ba 63 00 00 00       	mov    $0x63,%edx
+  8000f3:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  8000fa:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  800100:	48 b8 68 20 80 00 00 	movabs $0x802068,%rax
+  800107:	00 00 00 
+  80010a:	ff d0                	call   *%rax
+  80010c:	41 89 c4             	mov    %eax,%r12d
+        if (i < 0)
+  80010f:	85 c0                	test   %eax,%eax
+  800111:	0f 88 5f 01 00 00    	js     800276 <umain+0x251>
+            panic("read: %i", i);
+        buf[i] = 0;
+  800117:	48 98                	cltq
+  800119:	c6 84 05 6c ff ff ff 	movb   $0x0,-0x94(%rbp,%rax,1)
+  800120:	00 
+        if (strcmp(buf, msg) == 0)
+  800121:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800128:	00 00 00 
+  80012b:	48 8b 30             	mov    (%rax),%rsi
+  80012e:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  800135:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  80013c:	00 00 00 
+  80013f:	ff d0                	call   *%rax
+  800141:	85 c0                	test   %eax,%eax
+  800143:	0f 85 5a 01 00 00    	jne    8002a3 <umain+0x27e>
+            cprintf("\npipe read closed properly\n");
+  800149:	48 bf b9 31 80 00 00 	movabs $0x8031b9,%rdi
+  800150:	00 00 00 
+  800153:	48 ba c2 06 80 00 00 	movabs $0x8006c2,%rdx
+  80015a:	00 00 00 
+  80015d:	ff d2                	call   *%rdx
+        else
+            cprintf("\ngot %d bytes: %s\n", i, buf);
+        exit();
+  80015f:	48 b8 4f 05 80 00 00 	movabs $0x80054f,%rax
+  800166:	00 00 00 
+  800169:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+        if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+            panic("write: %i", i);
+        close(p[1]);
+    }
+    wait(pid);
+  80016b:	89 df                	mov    %ebx,%edi
+  80016d:	48 b8 31 2b 80 00 00 	movabs $0x802b31,%rax
+  800174:	00 00 00 
+  800177:	ff d0                	call   *%rax
+
+    binaryname = "pipewriteeof";
+  800179:	48 b8 0f 32 80 00 00 	movabs $0x80320f,%rax
+  800180:	00 00 00 
+  800183:	48 a3 08 40 80 00 00 	movabs %rax,0x804008
+  80018a:	00 00 00 
+    if ((i = pipe(p)) < 0)
+  80018d:	48 8d bd 64 ff ff ff 	lea    -0x9c(%rbp),%rdi
+  800194:	48 b8 d2 28 80 00 00 	movabs $0x8028d2,%rax
+  80019b:	00 00 00 
+  80019e:	ff d0                	call   *%rax
+  8001a0:	41 89 c4             	mov    %eax,%r12d
+  8001a3:	85 c0                	test   %eax,%eax
+  8001a5:	0f 88 1a 02 00 00    	js     8003c5 <umain+0x3a0>
+        panic("pipe: %i", i);
+
+    if ((pid = fork()) < 0)
+  8001ab:	48 b8 39 1b 80 00 00 	movabs $0x801b39,%rax
+  8001b2:	00 00 00 
+  8001b5:	ff d0                	call   *%rax
+  8001b7:	89 c3                	mov    %eax,%ebx
+  8001b9:	85 c0                	test   %eax,%eax
+  8001bb:	0f 88 31 02 00 00    	js     8003f2 <umain+0x3cd>
+        panic("fork: %i", i);
+
+    if (pid == 0) {
+  8001c1:	0f 84 59 02 00 00    	je     800420 <umain+0x3fb>
+                break;
+        }
+        cprintf("\npipe write closed properly\n");
+        exit();
+    }
+    close(p[0]);
+  8001c7:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  8001cd:	49 bc 2c 1e 80 00 00 	movabs $0x801e2c,%r12
+  8001d4:	00 00 00 
+  8001d7:	41 ff d4             	call   *%r12
+    close(p[1]);
+  8001da:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  8001e0:	41 ff d4             	call   *%r12
+    wait(pid);
+  8001e3:	89 df                	mov    %ebx,%edi
+  8001e5:	48 b8 31 2b 80 00 00 	movabs $0x802b31,%rax
+  8001ec:	00 00 00 
+  8001ef:	ff d0                	call   *%rax
+
+    cprintf("pipe tests passed\n");
+  8001f1:	48 bf 3d 32 80 00 00 	movabs $0x80323d,%rdi
+  8001f8:	00 00 00 
+  8001fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800200:	48 ba c2 06 80 00 00 	movabs $0x8006c2,%rdx
+  800207:	00 00 00 
+  80020a:	ff d2                	call   *%rdx
+}
+  80020c:	48 83 c4 78          	add    $0x78,%rsp
+  800210:	5b                   	pop    %rbx
+  800211:	41 5c                	pop    %r12
+  800213:	41 5d                	pop    %r13
+  800215:	41 5e                	pop    %r14
+  800217:	41 5f                	pop    %r15
+  800219:	5d                   	pop    %rbp
+  80021a:	c3                   	ret
+        panic("pipe: %i", i);
+  80021b:	89 c1                	mov    %eax,%ecx
+  80021d:	48 ba 54 31 80 00 00 	movabs $0x803154,%rdx
+  800224:	00 00 00 
+  800227:	be 0d 00 00 00       	mov    $0xd,%esi
+  80022c:	48 bf 5d 31 80 00 00 	movabs $0x80315d,%rdi
+  800233:	00 00 00 
+  800236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023b:	49 b8 72 05 80 00 00 	movabs $0x800572,%r8
+  800242:	00 00 00 
+  800245:	41 ff d0             	call   *%r8
+        panic("fork: %i", i);
+  800248:	44 89 e1             	mov    %r12d,%ecx
+  80024b:	48 ba 6d 31 80 00 00 	movabs $0x80316d,%rdx
+  800252:	00 00 00 
+  800255:	be 10 00 00 00       	mov    $0x10,%esi
+  80025a:	48 bf 5d 31 80 00 00 	movabs $0x80315d,%rdi
+  800261:	00 00 00 
+  800264:	b8 00 00 00 00       	mov    $0x0,%eax
+  800269:	49 b8 72 05 80 00 00 	movabs $0x800572,%r8
+  800270:	00 00 00 
+  800273:	41 ff d0             	call   *%r8
+            panic("read: %i", i);
+  800276:	89 c1                	mov    %eax,%ecx
+  800278:	48 ba b0 31 80 00 00 	movabs $0x8031b0,%rdx
+  80027f:	00 00 00 
+  800282:	be 18 00 00 00       	mov    $0x18,%esi
+  800287:	48 bf 5d 31 80 00 00 	movabs $0x80315d,%rdi
+  80028e:	00 00 00 
+  800291:	b8 00 00 00 00       	mov    $0x0,%eax
+  800296:	49 b8 72 05 80 00 00 	movabs $0x800572,%r8
+  80029d:	00 00 00 
+  8002a0:	41 ff d0             	call   *%r8
+            cprintf("\ngot %d bytes: %s\n", i, buf);
+  8002a3:	48 8d 95 6c ff ff ff 	lea    -0x94(%rbp),%rdx
+  8002aa:	44 89 e6             	mov    %r12d,%esi
+  8002ad:	48 bf d5 31 80 00 00 	movabs $0x8031d5,%rdi
+  8002b4:	00 00 00 
+  8002b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002bc:	48 b9 c2 06 80 00 00 	movabs $0x8006c2,%rcx
+  8002c3:	00 00 00 
+  8002c6:	ff d1                	call   *%rcx
+  8002c8:	e9 92 fe ff ff       	jmp    80015f <umain+0x13a>
+        cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  8002cd:	49 bd 00 50 80 00 00 	movabs $0x805000,%r13
+  8002d4:	00 00 00 
+  8002d7:	49 8b 45 00          	mov    0x0(%r13),%rax
+  8002db:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8002e1:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+  8002e7:	48 bf 76 31 80 00 00 	movabs $0x803176,%rdi
+  8002ee:	00 00 00 
+  8002f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f6:	49 bc c2 06 80 00 00 	movabs $0x8006c2,%r12
+  8002fd:	00 00 00 
+  800300:	41 ff d4             	call   *%r12
+        close(p[0]);
+  800303:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  800309:	48 b8 2c 1e 80 00 00 	movabs $0x801e2c,%rax
+  800310:	00 00 00 
+  800313:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  800315:	49 8b 45 00          	mov    0x0(%r13),%rax
+  800319:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80031f:	8b 95 68 ff ff ff    	mov    -0x98(%rbp),%edx
+  800325:	48 bf e8 31 80 00 00 	movabs $0x8031e8,%rdi
+  80032c:	00 00 00 
+  80032f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800334:	41 ff d4             	call   *%r12
+        if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  800337:	49 bd 00 40 80 00 00 	movabs $0x804000,%r13
+  80033e:	00 00 00 
+  800341:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  800345:	49 bf a9 0f 80 00 00 	movabs $0x800fa9,%r15
+  80034c:	00 00 00 
+  80034f:	41 ff d7             	call   *%r15
+  800352:	48 89 c2             	mov    %rax,%rdx
+  800355:	49 8b 75 00          	mov    0x0(%r13),%rsi
+  800359:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  80035f:	48 b8 d9 20 80 00 00 	movabs $0x8020d9,%rax
+  800366:	00 00 00 
+  800369:	ff d0                	call   *%rax
+  80036b:	49 89 c4             	mov    %rax,%r12
+  80036e:	41 89 c6             	mov    %eax,%r14d
+  800371:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  800375:	41 ff d7             	call   *%r15
+  800378:	4d 63 e4             	movslq %r12d,%r12
+  80037b:	49 39 c4             	cmp    %rax,%r12
+  80037e:	75 17                	jne    800397 <umain+0x372>
+        close(p[1]);
+  800380:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  800386:	48 b8 2c 1e 80 00 00 	movabs $0x801e2c,%rax
+  80038d:	00 00 00 
+  800390:	ff d0                	call   *%rax
+  800392:	e9 d4 fd ff ff       	jmp    80016b <umain+0x146>
+            panic("write: %i", i);
+  800397:	44 89 f1             	mov    %r14d,%ecx
+  80039a:	48 ba 05 32 80 00 00 	movabs $0x803205,%rdx
+  8003a1:	00 00 00 
+  8003a4:	be 24 00 00 00       	mov    $0x24,%esi
+  8003a9:	48 bf 5d 31 80 00 00 	movabs $0x80315d,%rdi
+  8003b0:	00 00 00 
+  8003b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b8:	49 b8 72 05 80 00 00 	movabs $0x800572,%r8
+  8003bf:	00 00 00 
+  8003c2:	41 ff d0             	call   *%r8
+        panic("pipe: %i", i);
+  8003c5:	89 c1                	mov    %eax,%ecx
+  8003c7:	48 ba 54 31 80 00 00 	movabs $0x803154,%rdx
+  8003ce:	00 00 00 
+  8003d1:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8003d6:	48 bf 5d 31 80 00 00 	movabs $0x80315d,%rdi
+  8003dd:	00 00 00 
+  8003e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e5:	49 b8 72 05 80 00 00 	movabs $0x800572,%r8
+  8003ec:	00 00 00 
+  8003ef:	41 ff d0             	call   *%r8
+        panic("fork: %i", i);
+  8003f2:	44 89 e1             	mov    %r12d,%ecx
+  8003f5:	48 ba 6d 31 80 00 00 	movabs $0x80316d,%rdx
+  8003fc:	00 00 00 
+  8003ff:	be 2e 00 00 00       	mov    $0x2e,%esi
+  800404:	48 bf 5d 31 80 00 00 	movabs $0x80315d,%rdi
+  80040b:	00 00 00 
+  80040e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800413:	49 b8 72 05 80 00 00 	movabs $0x800572,%r8
+  80041a:	00 00 00 
+  80041d:	41 ff d0             	call   *%r8
+        close(p[0]);
+  800420:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  800426:	48 b8 2c 1e 80 00 00 	movabs $0x801e2c,%rax
+  80042d:	00 00 00 
+  800430:	ff d0                	call   *%rax
+            cprintf(".");
+  800432:	49 bf 1c 32 80 00 00 	movabs $0x80321c,%r15
+  800439:	00 00 00 
+  80043c:	49 be c2 06 80 00 00 	movabs $0x8006c2,%r14
+  800443:	00 00 00 
+            if (write(p[1], "x", 1) != 1)
+  800446:	49 bd 1e 32 80 00 00 	movabs $0x80321e,%r13
+  80044d:	00 00 00 
+  800450:	49 bc d9 20 80 00 00 	movabs $0x8020d9,%r12
+  800457:	00 00 00 
+            cprintf(".");
+  80045a:	4c 89 ff             	mov    %r15,%rdi
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	41 ff d6             	call   *%r14
+            if (write(p[1], "x", 1) != 1)
+  800465:	ba 01 00 00 00       	mov    $0x1,%edx
+  80046a:	4c 89 ee             	mov    %r13,%rsi
+  80046d:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  800473:	41 ff d4             	call   *%r12
+  800476:	48 83 f8 01          	cmp    $0x1,%rax
+  80047a:	74 de                	je     80045a <umain+0x435>
+        cprintf("\npipe write closed properly\n");
+  80047c:	48 bf 20 32 80 00 00 	movabs $0x803220,%rdi
+  800483:	00 00 00 
+  800486:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048b:	48 ba c2 06 80 00 00 	movabs $0x8006c2,%rdx
+  800492:	00 00 00 
+  800495:	ff d2                	call   *%rdx
+        exit();
+  800497:	48 b8 4f 05 80 00 00 	movabs $0x80054f,%rax
+  80049e:	00 00 00 
+  8004a1:	ff d0                	call   *%rax
+  8004a3:	e9 1f fd ff ff       	jmp    8001c7 <umain+0x1a2>
+
+00000000008004a8 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8004a8:	55                   	push   %rbp
+  8004a9:	48 89 e5             	mov    %rsp,%rbp
+  8004ac:	41 56                	push   %r14
+  8004ae:	41 55                	push   %r13
+  8004b0:	41 54                	push   %r12
+  8004b2:	53                   	push   %rbx
+  8004b3:	41 89 fd             	mov    %edi,%r13d
+  8004b6:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8004b9:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8004c0:	00 00 00 
+  8004c3:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8004ca:	00 00 00 
+  8004cd:	48 39 c2             	cmp    %rax,%rdx
+  8004d0:	73 17                	jae    8004e9 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8004d2:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8004d5:	49 89 c4             	mov    %rax,%r12
+  8004d8:	48 83 c3 08          	add    $0x8,%rbx
+  8004dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e1:	ff 53 f8             	call   *-0x8(%rbx)
+  8004e4:	4c 39 e3             	cmp    %r12,%rbx
+  8004e7:	72 ef                	jb     8004d8 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8004e9:	48 b8 d7 14 80 00 00 	movabs $0x8014d7,%rax
+  8004f0:	00 00 00 
+  8004f3:	ff d0                	call   *%rax
+  8004f5:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8004f8:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8004ff:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800506:	00 00 00 
+  800509:	48 01 d0             	add    %rdx,%rax
+  80050c:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800513:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800516:	45 85 ed             	test   %r13d,%r13d
+  800519:	7e 0d                	jle    800528 <libmain+0x80>
+  80051b:	49 8b 06             	mov    (%r14),%rax
+  80051e:	48 a3 08 40 80 00 00 	movabs %rax,0x804008
+  800525:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800528:	4c 89 f6             	mov    %r14,%rsi
+  80052b:	44 89 ef             	mov    %r13d,%edi
+  80052e:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800535:	00 00 00 
+  800538:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80053a:	48 b8 4f 05 80 00 00 	movabs $0x80054f,%rax
+  800541:	00 00 00 
+  800544:	ff d0                	call   *%rax
+#endif
+}
+  800546:	5b                   	pop    %rbx
+  800547:	41 5c                	pop    %r12
+  800549:	41 5d                	pop    %r13
+  80054b:	41 5e                	pop    %r14
+  80054d:	5d                   	pop    %rbp
+  80054e:	c3                   	ret
+
+000000000080054f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80054f:	55                   	push   %rbp
+  800550:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800553:	48 b8 5f 1e 80 00 00 	movabs $0x801e5f,%rax
+  80055a:	00 00 00 
+  80055d:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80055f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800564:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  80056b:	00 00 00 
+  80056e:	ff d0                	call   *%rax
+}
+  800570:	5d                   	pop    %rbp
+  800571:	c3                   	ret
+
+0000000000800572 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800572:	55                   	push   %rbp
+  800573:	48 89 e5             	mov    %rsp,%rbp
+  800576:	41 56                	push   %r14
+  800578:	41 55                	push   %r13
+  80057a:	41 54                	push   %r12
+  80057c:	53                   	push   %rbx
+  80057d:	48 83 ec 50          	sub    $0x50,%rsp
+  800581:	49 89 fc             	mov    %rdi,%r12
+  800584:	41 89 f5             	mov    %esi,%r13d
+  800587:	48 89 d3             	mov    %rdx,%rbx
+  80058a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80058e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800592:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800596:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80059d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005a1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8005a5:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8005a9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005ad:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  8005b4:	00 00 00 
+  8005b7:	4c 8b 30             	mov    (%rax),%r14
+  8005ba:	48 b8 d7 14 80 00 00 	movabs $0x8014d7,%rax
+  8005c1:	00 00 00 
+  8005c4:	ff d0                	call   *%rax
+  8005c6:	89 c6                	mov    %eax,%esi
+  8005c8:	45 89 e8             	mov    %r13d,%r8d
+  8005cb:	4c 89 e1             	mov    %r12,%rcx
+  8005ce:	4c 89 f2             	mov    %r14,%rdx
+  8005d1:	48 bf a0 32 80 00 00 	movabs $0x8032a0,%rdi
+  8005d8:	00 00 00 
+  8005db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e0:	49 bc c2 06 80 00 00 	movabs $0x8006c2,%r12
+  8005e7:	00 00 00 
+  8005ea:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8005ed:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8005f1:	48 89 df             	mov    %rbx,%rdi
+  8005f4:	48 b8 5e 06 80 00 00 	movabs $0x80065e,%rax
+  8005fb:	00 00 00 
+  8005fe:	ff d0                	call   *%rax
+    cprintf("\n");
+  800600:	48 bf 91 31 80 00 00 	movabs $0x803191,%rdi
+  800607:	00 00 00 
+  80060a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060f:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800612:	cc                   	int3
+  800613:	eb fd                	jmp    800612 <_panic+0xa0>
+
+0000000000800615 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800615:	55                   	push   %rbp
+  800616:	48 89 e5             	mov    %rsp,%rbp
+  800619:	53                   	push   %rbx
+  80061a:	48 83 ec 08          	sub    $0x8,%rsp
+  80061e:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800621:	8b 06                	mov    (%rsi),%eax
+  800623:	8d 50 01             	lea    0x1(%rax),%edx
+  800626:	89 16                	mov    %edx,(%rsi)
+  800628:	48 98                	cltq
+  80062a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80062f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800635:	74 0a                	je     800641 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800637:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80063b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80063f:	c9                   	leave
+  800640:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800641:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800645:	be ff 00 00 00       	mov    $0xff,%esi
+  80064a:	48 b8 0e 14 80 00 00 	movabs $0x80140e,%rax
+  800651:	00 00 00 
+  800654:	ff d0                	call   *%rax
+        state->offset = 0;
+  800656:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80065c:	eb d9                	jmp    800637 <putch+0x22>
+
+000000000080065e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80065e:	55                   	push   %rbp
+  80065f:	48 89 e5             	mov    %rsp,%rbp
+  800662:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800669:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80066c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800673:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800680:	48 89 f1             	mov    %rsi,%rcx
+  800683:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80068a:	48 bf 15 06 80 00 00 	movabs $0x800615,%rdi
+  800691:	00 00 00 
+  800694:	48 b8 12 08 80 00 00 	movabs $0x800812,%rax
+  80069b:	00 00 00 
+  80069e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8006a0:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8006a7:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8006ae:	48 b8 0e 14 80 00 00 	movabs $0x80140e,%rax
+  8006b5:	00 00 00 
+  8006b8:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8006ba:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8006c0:	c9                   	leave
+  8006c1:	c3                   	ret
+
+00000000008006c2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8006c2:	55                   	push   %rbp
+  8006c3:	48 89 e5             	mov    %rsp,%rbp
+  8006c6:	48 83 ec 50          	sub    $0x50,%rsp
+  8006ca:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8006ce:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8006d2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006d6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006da:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8006de:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8006e5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ed:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006f1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8006f5:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8006f9:	48 b8 5e 06 80 00 00 	movabs $0x80065e,%rax
+  800700:	00 00 00 
+  800703:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800705:	c9                   	leave
+  800706:	c3                   	ret
+
+0000000000800707 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800707:	55                   	push   %rbp
+  800708:	48 89 e5             	mov    %rsp,%rbp
+  80070b:	41 57                	push   %r15
+  80070d:	41 56                	push   %r14
+  80070f:	41 55                	push   %r13
+  800711:	41 54                	push   %r12
+  800713:	53                   	push   %rbx
+  800714:	48 83 ec 18          	sub    $0x18,%rsp
+  800718:	49 89 fc             	mov    %rdi,%r12
+  80071b:	49 89 f5             	mov    %rsi,%r13
+  80071e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800722:	8b 45 10             	mov    0x10(%rbp),%eax
+  800725:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800728:	41 89 cf             	mov    %ecx,%r15d
+  80072b:	4c 39 fa             	cmp    %r15,%rdx
+  80072e:	73 5b                	jae    80078b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800730:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800734:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800738:	85 db                	test   %ebx,%ebx
+  80073a:	7e 0e                	jle    80074a <print_num+0x43>
+            putch(padc, put_arg);
+  80073c:	4c 89 ee             	mov    %r13,%rsi
+  80073f:	44 89 f7             	mov    %r14d,%edi
+  800742:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800745:	83 eb 01             	sub    $0x1,%ebx
+  800748:	75 f2                	jne    80073c <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80074a:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80074e:	48 b9 d4 32 80 00 00 	movabs $0x8032d4,%rcx
+  800755:	00 00 00 
+  800758:	48 b8 c3 32 80 00 00 	movabs $0x8032c3,%rax
+  80075f:	00 00 00 
+  800762:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800766:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80076a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80076f:	49 f7 f7             	div    %r15
+  800772:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800776:	4c 89 ee             	mov    %r13,%rsi
+  800779:	41 ff d4             	call   *%r12
+}
+  80077c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800780:	5b                   	pop    %rbx
+  800781:	41 5c                	pop    %r12
+  800783:	41 5d                	pop    %r13
+  800785:	41 5e                	pop    %r14
+  800787:	41 5f                	pop    %r15
+  800789:	5d                   	pop    %rbp
+  80078a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80078b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80078f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800794:	49 f7 f7             	div    %r15
+  800797:	48 83 ec 08          	sub    $0x8,%rsp
+  80079b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80079f:	52                   	push   %rdx
+  8007a0:	45 0f be c9          	movsbl %r9b,%r9d
+  8007a4:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8007a8:	48 89 c2             	mov    %rax,%rdx
+  8007ab:	48 b8 07 07 80 00 00 	movabs $0x800707,%rax
+  8007b2:	00 00 00 
+  8007b5:	ff d0                	call   *%rax
+  8007b7:	48 83 c4 10          	add    $0x10,%rsp
+  8007bb:	eb 8d                	jmp    80074a <print_num+0x43>
+
+00000000008007bd <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8007bd:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8007c1:	48 8b 06             	mov    (%rsi),%rax
+  8007c4:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8007c8:	73 0a                	jae    8007d4 <sprintputch+0x17>
+        *state->start++ = ch;
+  8007ca:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8007ce:	48 89 16             	mov    %rdx,(%rsi)
+  8007d1:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8007d4:	c3                   	ret
+
+00000000008007d5 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8007d5:	55                   	push   %rbp
+  8007d6:	48 89 e5             	mov    %rsp,%rbp
+  8007d9:	48 83 ec 50          	sub    $0x50,%rsp
+  8007dd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8007e1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8007e5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8007e9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8007f0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8007fc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800800:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800804:	48 b8 12 08 80 00 00 	movabs $0x800812,%rax
+  80080b:	00 00 00 
+  80080e:	ff d0                	call   *%rax
+}
+  800810:	c9                   	leave
+  800811:	c3                   	ret
+
+0000000000800812 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800812:	55                   	push   %rbp
+  800813:	48 89 e5             	mov    %rsp,%rbp
+  800816:	41 57                	push   %r15
+  800818:	41 56                	push   %r14
+  80081a:	41 55                	push   %r13
+  80081c:	41 54                	push   %r12
+  80081e:	53                   	push   %rbx
+  80081f:	48 83 ec 38          	sub    $0x38,%rsp
+  800823:	49 89 fe             	mov    %rdi,%r14
+  800826:	49 89 f5             	mov    %rsi,%r13
+  800829:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80082c:	48 8b 01             	mov    (%rcx),%rax
+  80082f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800833:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800837:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083b:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80083f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800843:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800847:	0f b6 3b             	movzbl (%rbx),%edi
+  80084a:	40 80 ff 25          	cmp    $0x25,%dil
+  80084e:	74 18                	je     800868 <vprintfmt+0x56>
+            if (!ch) return;
+  800850:	40 84 ff             	test   %dil,%dil
+  800853:	0f 84 b1 06 00 00    	je     800f0a <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800859:	40 0f b6 ff          	movzbl %dil,%edi
+  80085d:	4c 89 ee             	mov    %r13,%rsi
+  800860:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800863:	4c 89 e3             	mov    %r12,%rbx
+  800866:	eb db                	jmp    800843 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800868:	be 00 00 00 00       	mov    $0x0,%esi
+  80086d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800871:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800876:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80087c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800883:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800887:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80088c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800891:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800894:	83 e8 23             	sub    $0x23,%eax
+  800897:	3c 57                	cmp    $0x57,%al
+  800899:	0f 87 51 06 00 00    	ja     800ef0 <vprintfmt+0x6de>
+  80089f:	0f b6 c0             	movzbl %al,%eax
+  8008a2:	48 b9 80 34 80 00 00 	movabs $0x803480,%rcx
+  8008a9:	00 00 00 
+  8008ac:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8008af:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8008b2:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8008b6:	eb cf                	jmp    800887 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8008b8:	49 89 dc             	mov    %rbx,%r12
+  8008bb:	be 01 00 00 00       	mov    $0x1,%esi
+  8008c0:	eb c5                	jmp    800887 <vprintfmt+0x75>
+            padc = ch;
+  8008c2:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8008c6:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8008c9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008cc:	eb b9                	jmp    800887 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8008ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d4:	77 24                	ja     8008fa <vprintfmt+0xe8>
+  8008d6:	89 c1                	mov    %eax,%ecx
+  8008d8:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8008dc:	83 c0 08             	add    $0x8,%eax
+  8008df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e2:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8008e5:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8008e8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008ec:	79 99                	jns    800887 <vprintfmt+0x75>
+                width = precision;
+  8008ee:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8008f2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8008f8:	eb 8d                	jmp    800887 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8008fa:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8008fe:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800902:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800906:	eb da                	jmp    8008e2 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800908:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80090d:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800911:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800917:	3c 39                	cmp    $0x39,%al
+  800919:	77 1c                	ja     800937 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80091b:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80091f:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800923:	0f b6 c0             	movzbl %al,%eax
+  800926:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80092b:	0f b6 03             	movzbl (%rbx),%eax
+  80092e:	3c 39                	cmp    $0x39,%al
+  800930:	76 e9                	jbe    80091b <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800932:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800935:	eb b1                	jmp    8008e8 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800937:	49 89 dc             	mov    %rbx,%r12
+  80093a:	eb ac                	jmp    8008e8 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80093c:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80093f:	85 c9                	test   %ecx,%ecx
+  800941:	b8 00 00 00 00       	mov    $0x0,%eax
+  800946:	0f 49 c1             	cmovns %ecx,%eax
+  800949:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80094c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80094f:	e9 33 ff ff ff       	jmp    800887 <vprintfmt+0x75>
+            lflag++;
+  800954:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800957:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80095a:	e9 28 ff ff ff       	jmp    800887 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80095f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800962:	83 f8 2f             	cmp    $0x2f,%eax
+  800965:	77 19                	ja     800980 <vprintfmt+0x16e>
+  800967:	89 c2                	mov    %eax,%edx
+  800969:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096d:	83 c0 08             	add    $0x8,%eax
+  800970:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800973:	8b 3a                	mov    (%rdx),%edi
+  800975:	4c 89 ee             	mov    %r13,%rsi
+  800978:	41 ff d6             	call   *%r14
+            break;
+  80097b:	e9 c3 fe ff ff       	jmp    800843 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800980:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800984:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800988:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098c:	eb e5                	jmp    800973 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80098e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800991:	83 f8 2f             	cmp    $0x2f,%eax
+  800994:	77 5a                	ja     8009f0 <vprintfmt+0x1de>
+  800996:	89 c2                	mov    %eax,%edx
+  800998:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099c:	83 c0 08             	add    $0x8,%eax
+  80099f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8009a2:	8b 02                	mov    (%rdx),%eax
+  8009a4:	89 c1                	mov    %eax,%ecx
+  8009a6:	f7 d9                	neg    %ecx
+  8009a8:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8009ab:	83 f9 15             	cmp    $0x15,%ecx
+  8009ae:	7f 4e                	jg     8009fe <vprintfmt+0x1ec>
+  8009b0:	48 63 c1             	movslq %ecx,%rax
+  8009b3:	48 ba 40 37 80 00 00 	movabs $0x803740,%rdx
+  8009ba:	00 00 00 
+  8009bd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8009c1:	48 85 c0             	test   %rax,%rax
+  8009c4:	74 38                	je     8009fe <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8009c6:	48 89 c1             	mov    %rax,%rcx
+  8009c9:	48 ba 39 39 80 00 00 	movabs $0x803939,%rdx
+  8009d0:	00 00 00 
+  8009d3:	4c 89 ee             	mov    %r13,%rsi
+  8009d6:	4c 89 f7             	mov    %r14,%rdi
+  8009d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009de:	49 b8 d5 07 80 00 00 	movabs $0x8007d5,%r8
+  8009e5:	00 00 00 
+  8009e8:	41 ff d0             	call   *%r8
+  8009eb:	e9 53 fe ff ff       	jmp    800843 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8009f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fc:	eb a4                	jmp    8009a2 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8009fe:	48 ba ec 32 80 00 00 	movabs $0x8032ec,%rdx
+  800a05:	00 00 00 
+  800a08:	4c 89 ee             	mov    %r13,%rsi
+  800a0b:	4c 89 f7             	mov    %r14,%rdi
+  800a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a13:	49 b8 d5 07 80 00 00 	movabs $0x8007d5,%r8
+  800a1a:	00 00 00 
+  800a1d:	41 ff d0             	call   *%r8
+  800a20:	e9 1e fe ff ff       	jmp    800843 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a28:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2b:	77 6c                	ja     800a99 <vprintfmt+0x287>
+  800a2d:	89 c2                	mov    %eax,%edx
+  800a2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a33:	83 c0 08             	add    $0x8,%eax
+  800a36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a39:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800a3c:	48 85 d2             	test   %rdx,%rdx
+  800a3f:	48 b8 e5 32 80 00 00 	movabs $0x8032e5,%rax
+  800a46:	00 00 00 
+  800a49:	48 0f 45 c2          	cmovne %rdx,%rax
+  800a4d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800a51:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800a55:	7e 06                	jle    800a5d <vprintfmt+0x24b>
+  800a57:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800a5b:	75 4a                	jne    800aa7 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a5d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a61:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800a65:	0f b6 00             	movzbl (%rax),%eax
+  800a68:	84 c0                	test   %al,%al
+  800a6a:	0f 85 9a 00 00 00    	jne    800b0a <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800a70:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a73:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800a77:	85 c0                	test   %eax,%eax
+  800a79:	0f 8e c4 fd ff ff    	jle    800843 <vprintfmt+0x31>
+  800a7f:	4c 89 ee             	mov    %r13,%rsi
+  800a82:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a87:	41 ff d6             	call   *%r14
+  800a8a:	41 83 ec 01          	sub    $0x1,%r12d
+  800a8e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800a92:	75 eb                	jne    800a7f <vprintfmt+0x26d>
+  800a94:	e9 aa fd ff ff       	jmp    800843 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa5:	eb 92                	jmp    800a39 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800aa7:	49 63 f7             	movslq %r15d,%rsi
+  800aaa:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800aae:	48 b8 c4 0f 80 00 00 	movabs $0x800fc4,%rax
+  800ab5:	00 00 00 
+  800ab8:	ff d0                	call   *%rax
+  800aba:	48 89 c2             	mov    %rax,%rdx
+  800abd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800ac0:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800ac2:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800ac5:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800ac8:	85 c0                	test   %eax,%eax
+  800aca:	7e 91                	jle    800a5d <vprintfmt+0x24b>
+  800acc:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800ad1:	4c 89 ee             	mov    %r13,%rsi
+  800ad4:	44 89 e7             	mov    %r12d,%edi
+  800ad7:	41 ff d6             	call   *%r14
+  800ada:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800ade:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800ae1:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800ae4:	75 eb                	jne    800ad1 <vprintfmt+0x2bf>
+  800ae6:	e9 72 ff ff ff       	jmp    800a5d <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800aeb:	0f b6 f8             	movzbl %al,%edi
+  800aee:	4c 89 ee             	mov    %r13,%rsi
+  800af1:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800af4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800af8:	49 83 c4 01          	add    $0x1,%r12
+  800afc:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800b02:	84 c0                	test   %al,%al
+  800b04:	0f 84 66 ff ff ff    	je     800a70 <vprintfmt+0x25e>
+  800b0a:	45 85 ff             	test   %r15d,%r15d
+  800b0d:	78 0a                	js     800b19 <vprintfmt+0x307>
+  800b0f:	41 83 ef 01          	sub    $0x1,%r15d
+  800b13:	0f 88 57 ff ff ff    	js     800a70 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800b19:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800b1d:	74 cc                	je     800aeb <vprintfmt+0x2d9>
+  800b1f:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800b22:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b27:	80 fa 5e             	cmp    $0x5e,%dl
+  800b2a:	77 c2                	ja     800aee <vprintfmt+0x2dc>
+  800b2c:	eb bd                	jmp    800aeb <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800b2e:	40 84 f6             	test   %sil,%sil
+  800b31:	75 26                	jne    800b59 <vprintfmt+0x347>
+    switch (lflag) {
+  800b33:	85 d2                	test   %edx,%edx
+  800b35:	74 59                	je     800b90 <vprintfmt+0x37e>
+  800b37:	83 fa 01             	cmp    $0x1,%edx
+  800b3a:	74 7b                	je     800bb7 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800b3c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b42:	0f 87 96 00 00 00    	ja     800bde <vprintfmt+0x3cc>
+  800b48:	89 c2                	mov    %eax,%edx
+  800b4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b4e:	83 c0 08             	add    $0x8,%eax
+  800b51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b54:	4c 8b 22             	mov    (%rdx),%r12
+  800b57:	eb 17                	jmp    800b70 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800b59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5f:	77 21                	ja     800b82 <vprintfmt+0x370>
+  800b61:	89 c2                	mov    %eax,%edx
+  800b63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b67:	83 c0 08             	add    $0x8,%eax
+  800b6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b6d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800b70:	4d 85 e4             	test   %r12,%r12
+  800b73:	78 7a                	js     800bef <vprintfmt+0x3dd>
+            num = i;
+  800b75:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800b78:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800b7d:	e9 50 02 00 00       	jmp    800dd2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8e:	eb dd                	jmp    800b6d <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800b90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b93:	83 f8 2f             	cmp    $0x2f,%eax
+  800b96:	77 11                	ja     800ba9 <vprintfmt+0x397>
+  800b98:	89 c2                	mov    %eax,%edx
+  800b9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9e:	83 c0 08             	add    $0x8,%eax
+  800ba1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba4:	4c 63 22             	movslq (%rdx),%r12
+  800ba7:	eb c7                	jmp    800b70 <vprintfmt+0x35e>
+  800ba9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb5:	eb ed                	jmp    800ba4 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800bb7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bba:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbd:	77 11                	ja     800bd0 <vprintfmt+0x3be>
+  800bbf:	89 c2                	mov    %eax,%edx
+  800bc1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc5:	83 c0 08             	add    $0x8,%eax
+  800bc8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bcb:	4c 8b 22             	mov    (%rdx),%r12
+  800bce:	eb a0                	jmp    800b70 <vprintfmt+0x35e>
+  800bd0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bdc:	eb ed                	jmp    800bcb <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800bde:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bea:	e9 65 ff ff ff       	jmp    800b54 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800bef:	4c 89 ee             	mov    %r13,%rsi
+  800bf2:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800bf7:	41 ff d6             	call   *%r14
+                i = -i;
+  800bfa:	49 f7 dc             	neg    %r12
+  800bfd:	e9 73 ff ff ff       	jmp    800b75 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800c02:	40 84 f6             	test   %sil,%sil
+  800c05:	75 32                	jne    800c39 <vprintfmt+0x427>
+    switch (lflag) {
+  800c07:	85 d2                	test   %edx,%edx
+  800c09:	74 5d                	je     800c68 <vprintfmt+0x456>
+  800c0b:	83 fa 01             	cmp    $0x1,%edx
+  800c0e:	0f 84 82 00 00 00    	je     800c96 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800c14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c17:	83 f8 2f             	cmp    $0x2f,%eax
+  800c1a:	0f 87 a5 00 00 00    	ja     800cc5 <vprintfmt+0x4b3>
+  800c20:	89 c2                	mov    %eax,%edx
+  800c22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c26:	83 c0 08             	add    $0x8,%eax
+  800c29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c2c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c2f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c34:	e9 99 01 00 00       	jmp    800dd2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c3c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c3f:	77 19                	ja     800c5a <vprintfmt+0x448>
+  800c41:	89 c2                	mov    %eax,%edx
+  800c43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c47:	83 c0 08             	add    $0x8,%eax
+  800c4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c4d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c50:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c55:	e9 78 01 00 00       	jmp    800dd2 <vprintfmt+0x5c0>
+  800c5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c66:	eb e5                	jmp    800c4d <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800c68:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6b:	83 f8 2f             	cmp    $0x2f,%eax
+  800c6e:	77 18                	ja     800c88 <vprintfmt+0x476>
+  800c70:	89 c2                	mov    %eax,%edx
+  800c72:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c76:	83 c0 08             	add    $0x8,%eax
+  800c79:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c7c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800c7e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800c83:	e9 4a 01 00 00       	jmp    800dd2 <vprintfmt+0x5c0>
+  800c88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c94:	eb e6                	jmp    800c7c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800c96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c99:	83 f8 2f             	cmp    $0x2f,%eax
+  800c9c:	77 19                	ja     800cb7 <vprintfmt+0x4a5>
+  800c9e:	89 c2                	mov    %eax,%edx
+  800ca0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ca4:	83 c0 08             	add    $0x8,%eax
+  800ca7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800caa:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800cad:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800cb2:	e9 1b 01 00 00       	jmp    800dd2 <vprintfmt+0x5c0>
+  800cb7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cbb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cbf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc3:	eb e5                	jmp    800caa <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800cc5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ccd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd1:	e9 56 ff ff ff       	jmp    800c2c <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800cd6:	40 84 f6             	test   %sil,%sil
+  800cd9:	75 2e                	jne    800d09 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800cdb:	85 d2                	test   %edx,%edx
+  800cdd:	74 59                	je     800d38 <vprintfmt+0x526>
+  800cdf:	83 fa 01             	cmp    $0x1,%edx
+  800ce2:	74 7f                	je     800d63 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800ce4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce7:	83 f8 2f             	cmp    $0x2f,%eax
+  800cea:	0f 87 9f 00 00 00    	ja     800d8f <vprintfmt+0x57d>
+  800cf0:	89 c2                	mov    %eax,%edx
+  800cf2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf6:	83 c0 08             	add    $0x8,%eax
+  800cf9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cfc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800cff:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d04:	e9 c9 00 00 00       	jmp    800dd2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d0c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d0f:	77 19                	ja     800d2a <vprintfmt+0x518>
+  800d11:	89 c2                	mov    %eax,%edx
+  800d13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d17:	83 c0 08             	add    $0x8,%eax
+  800d1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d1d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d20:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d25:	e9 a8 00 00 00       	jmp    800dd2 <vprintfmt+0x5c0>
+  800d2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d36:	eb e5                	jmp    800d1d <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800d38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d3b:	83 f8 2f             	cmp    $0x2f,%eax
+  800d3e:	77 15                	ja     800d55 <vprintfmt+0x543>
+  800d40:	89 c2                	mov    %eax,%edx
+  800d42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d46:	83 c0 08             	add    $0x8,%eax
+  800d49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d4c:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800d4e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800d53:	eb 7d                	jmp    800dd2 <vprintfmt+0x5c0>
+  800d55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d61:	eb e9                	jmp    800d4c <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800d63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d66:	83 f8 2f             	cmp    $0x2f,%eax
+  800d69:	77 16                	ja     800d81 <vprintfmt+0x56f>
+  800d6b:	89 c2                	mov    %eax,%edx
+  800d6d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d71:	83 c0 08             	add    $0x8,%eax
+  800d74:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d77:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d7a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800d7f:	eb 51                	jmp    800dd2 <vprintfmt+0x5c0>
+  800d81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d8d:	eb e8                	jmp    800d77 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800d8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d9b:	e9 5c ff ff ff       	jmp    800cfc <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800da0:	4c 89 ee             	mov    %r13,%rsi
+  800da3:	bf 30 00 00 00       	mov    $0x30,%edi
+  800da8:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800dab:	4c 89 ee             	mov    %r13,%rsi
+  800dae:	bf 78 00 00 00       	mov    $0x78,%edi
+  800db3:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800db6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800db9:	83 f8 2f             	cmp    $0x2f,%eax
+  800dbc:	77 47                	ja     800e05 <vprintfmt+0x5f3>
+  800dbe:	89 c2                	mov    %eax,%edx
+  800dc0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dc4:	83 c0 08             	add    $0x8,%eax
+  800dc7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dca:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dcd:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800dd2:	48 83 ec 08          	sub    $0x8,%rsp
+  800dd6:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800dda:	0f 94 c0             	sete   %al
+  800ddd:	0f b6 c0             	movzbl %al,%eax
+  800de0:	50                   	push   %rax
+  800de1:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800de6:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800dea:	4c 89 ee             	mov    %r13,%rsi
+  800ded:	4c 89 f7             	mov    %r14,%rdi
+  800df0:	48 b8 07 07 80 00 00 	movabs $0x800707,%rax
+  800df7:	00 00 00 
+  800dfa:	ff d0                	call   *%rax
+            break;
+  800dfc:	48 83 c4 10          	add    $0x10,%rsp
+  800e00:	e9 3e fa ff ff       	jmp    800843 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800e05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e09:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e11:	eb b7                	jmp    800dca <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800e13:	40 84 f6             	test   %sil,%sil
+  800e16:	75 2b                	jne    800e43 <vprintfmt+0x631>
+    switch (lflag) {
+  800e18:	85 d2                	test   %edx,%edx
+  800e1a:	74 56                	je     800e72 <vprintfmt+0x660>
+  800e1c:	83 fa 01             	cmp    $0x1,%edx
+  800e1f:	74 7f                	je     800ea0 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800e21:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e24:	83 f8 2f             	cmp    $0x2f,%eax
+  800e27:	0f 87 a2 00 00 00    	ja     800ecf <vprintfmt+0x6bd>
+  800e2d:	89 c2                	mov    %eax,%edx
+  800e2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e33:	83 c0 08             	add    $0x8,%eax
+  800e36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e39:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e3c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e41:	eb 8f                	jmp    800dd2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e46:	83 f8 2f             	cmp    $0x2f,%eax
+  800e49:	77 19                	ja     800e64 <vprintfmt+0x652>
+  800e4b:	89 c2                	mov    %eax,%edx
+  800e4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e51:	83 c0 08             	add    $0x8,%eax
+  800e54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e57:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e5a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e5f:	e9 6e ff ff ff       	jmp    800dd2 <vprintfmt+0x5c0>
+  800e64:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e68:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e70:	eb e5                	jmp    800e57 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800e72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e75:	83 f8 2f             	cmp    $0x2f,%eax
+  800e78:	77 18                	ja     800e92 <vprintfmt+0x680>
+  800e7a:	89 c2                	mov    %eax,%edx
+  800e7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e80:	83 c0 08             	add    $0x8,%eax
+  800e83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e86:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800e88:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800e8d:	e9 40 ff ff ff       	jmp    800dd2 <vprintfmt+0x5c0>
+  800e92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e9e:	eb e6                	jmp    800e86 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800ea0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ea3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ea6:	77 19                	ja     800ec1 <vprintfmt+0x6af>
+  800ea8:	89 c2                	mov    %eax,%edx
+  800eaa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800eae:	83 c0 08             	add    $0x8,%eax
+  800eb1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800eb4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800eb7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ebc:	e9 11 ff ff ff       	jmp    800dd2 <vprintfmt+0x5c0>
+  800ec1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ec5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ec9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ecd:	eb e5                	jmp    800eb4 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ecf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ed3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ed7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800edb:	e9 59 ff ff ff       	jmp    800e39 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ee0:	4c 89 ee             	mov    %r13,%rsi
+  800ee3:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ee8:	41 ff d6             	call   *%r14
+            break;
+  800eeb:	e9 53 f9 ff ff       	jmp    800843 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ef0:	4c 89 ee             	mov    %r13,%rsi
+  800ef3:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ef8:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800efb:	48 83 eb 01          	sub    $0x1,%rbx
+  800eff:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800f03:	75 f6                	jne    800efb <vprintfmt+0x6e9>
+  800f05:	e9 39 f9 ff ff       	jmp    800843 <vprintfmt+0x31>
+}
+  800f0a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800f0e:	5b                   	pop    %rbx
+  800f0f:	41 5c                	pop    %r12
+  800f11:	41 5d                	pop    %r13
+  800f13:	41 5e                	pop    %r14
+  800f15:	41 5f                	pop    %r15
+  800f17:	5d                   	pop    %rbp
+  800f18:	c3                   	ret
+
+0000000000800f19 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800f19:	55                   	push   %rbp
+  800f1a:	48 89 e5             	mov    %rsp,%rbp
+  800f1d:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800f21:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f25:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800f2a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800f2e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800f35:	48 85 ff             	test   %rdi,%rdi
+  800f38:	74 2b                	je     800f65 <vsnprintf+0x4c>
+  800f3a:	48 85 f6             	test   %rsi,%rsi
+  800f3d:	74 26                	je     800f65 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800f3f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f43:	48 bf bd 07 80 00 00 	movabs $0x8007bd,%rdi
+  800f4a:	00 00 00 
+  800f4d:	48 b8 12 08 80 00 00 	movabs $0x800812,%rax
+  800f54:	00 00 00 
+  800f57:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800f59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f5d:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800f60:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800f63:	c9                   	leave
+  800f64:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800f65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f6a:	eb f7                	jmp    800f63 <vsnprintf+0x4a>
+
+0000000000800f6c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800f6c:	55                   	push   %rbp
+  800f6d:	48 89 e5             	mov    %rsp,%rbp
+  800f70:	48 83 ec 50          	sub    $0x50,%rsp
+  800f74:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f78:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f7c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800f80:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800f87:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f8f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f93:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800f97:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800f9b:	48 b8 19 0f 80 00 00 	movabs $0x800f19,%rax
+  800fa2:	00 00 00 
+  800fa5:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800fa7:	c9                   	leave
+  800fa8:	c3                   	ret
+
+0000000000800fa9 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800fa9:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800fac:	74 10                	je     800fbe <strlen+0x15>
+    size_t n = 0;
+  800fae:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800fb3:	48 83 c0 01          	add    $0x1,%rax
+  800fb7:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800fbb:	75 f6                	jne    800fb3 <strlen+0xa>
+  800fbd:	c3                   	ret
+    size_t n = 0;
+  800fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800fc3:	c3                   	ret
+
+0000000000800fc4 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800fc4:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800fc7:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800fcc:	48 85 f6             	test   %rsi,%rsi
+  800fcf:	74 11                	je     800fe2 <strnlen+0x1e>
+  800fd1:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800fd5:	74 0c                	je     800fe3 <strnlen+0x1f>
+  800fd7:	48 83 c2 01          	add    $0x1,%rdx
+  800fdb:	48 39 d0             	cmp    %rdx,%rax
+  800fde:	75 f1                	jne    800fd1 <strnlen+0xd>
+  800fe0:	eb 04                	jmp    800fe6 <strnlen+0x22>
+  800fe2:	c3                   	ret
+  800fe3:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800fe6:	c3                   	ret
+
+0000000000800fe7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800fe7:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800fea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fef:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ff3:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ff6:	48 83 c2 01          	add    $0x1,%rdx
+  800ffa:	84 c9                	test   %cl,%cl
+  800ffc:	75 f1                	jne    800fef <strcpy+0x8>
+        ;
+    return res;
+}
+  800ffe:	c3                   	ret
+
+0000000000800fff <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800fff:	55                   	push   %rbp
+  801000:	48 89 e5             	mov    %rsp,%rbp
+  801003:	41 54                	push   %r12
+  801005:	53                   	push   %rbx
+  801006:	48 89 fb             	mov    %rdi,%rbx
+  801009:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80100c:	48 b8 a9 0f 80 00 00 	movabs $0x800fa9,%rax
+  801013:	00 00 00 
+  801016:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801018:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80101c:	4c 89 e6             	mov    %r12,%rsi
+  80101f:	48 b8 e7 0f 80 00 00 	movabs $0x800fe7,%rax
+  801026:	00 00 00 
+  801029:	ff d0                	call   *%rax
+    return dst;
+}
+  80102b:	48 89 d8             	mov    %rbx,%rax
+  80102e:	5b                   	pop    %rbx
+  80102f:	41 5c                	pop    %r12
+  801031:	5d                   	pop    %rbp
+  801032:	c3                   	ret
+
+0000000000801033 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801033:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801036:	48 85 d2             	test   %rdx,%rdx
+  801039:	74 1f                	je     80105a <strncpy+0x27>
+  80103b:	48 01 fa             	add    %rdi,%rdx
+  80103e:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801041:	48 83 c1 01          	add    $0x1,%rcx
+  801045:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801049:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80104d:	41 80 f8 01          	cmp    $0x1,%r8b
+  801051:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801055:	48 39 ca             	cmp    %rcx,%rdx
+  801058:	75 e7                	jne    801041 <strncpy+0xe>
+    }
+    return ret;
+}
+  80105a:	c3                   	ret
+
+000000000080105b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80105b:	48 89 f8             	mov    %rdi,%rax
+  80105e:	48 85 d2             	test   %rdx,%rdx
+  801061:	74 24                	je     801087 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801063:	48 83 ea 01          	sub    $0x1,%rdx
+  801067:	74 1b                	je     801084 <strlcpy+0x29>
+  801069:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80106d:	0f b6 16             	movzbl (%rsi),%edx
+  801070:	84 d2                	test   %dl,%dl
+  801072:	74 10                	je     801084 <strlcpy+0x29>
+            *dst++ = *src++;
+  801074:	48 83 c6 01          	add    $0x1,%rsi
+  801078:	48 83 c0 01          	add    $0x1,%rax
+  80107c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80107f:	48 39 c8             	cmp    %rcx,%rax
+  801082:	75 e9                	jne    80106d <strlcpy+0x12>
+        *dst = '\0';
+  801084:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801087:	48 29 f8             	sub    %rdi,%rax
+}
+  80108a:	c3                   	ret
+
+000000000080108b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80108b:	0f b6 07             	movzbl (%rdi),%eax
+  80108e:	84 c0                	test   %al,%al
+  801090:	74 13                	je     8010a5 <strcmp+0x1a>
+  801092:	38 06                	cmp    %al,(%rsi)
+  801094:	75 0f                	jne    8010a5 <strcmp+0x1a>
+  801096:	48 83 c7 01          	add    $0x1,%rdi
+  80109a:	48 83 c6 01          	add    $0x1,%rsi
+  80109e:	0f b6 07             	movzbl (%rdi),%eax
+  8010a1:	84 c0                	test   %al,%al
+  8010a3:	75 ed                	jne    801092 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8010a5:	0f b6 c0             	movzbl %al,%eax
+  8010a8:	0f b6 16             	movzbl (%rsi),%edx
+  8010ab:	29 d0                	sub    %edx,%eax
+}
+  8010ad:	c3                   	ret
+
+00000000008010ae <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8010ae:	48 85 d2             	test   %rdx,%rdx
+  8010b1:	74 1f                	je     8010d2 <strncmp+0x24>
+  8010b3:	0f b6 07             	movzbl (%rdi),%eax
+  8010b6:	84 c0                	test   %al,%al
+  8010b8:	74 1e                	je     8010d8 <strncmp+0x2a>
+  8010ba:	3a 06                	cmp    (%rsi),%al
+  8010bc:	75 1a                	jne    8010d8 <strncmp+0x2a>
+  8010be:	48 83 c7 01          	add    $0x1,%rdi
+  8010c2:	48 83 c6 01          	add    $0x1,%rsi
+  8010c6:	48 83 ea 01          	sub    $0x1,%rdx
+  8010ca:	75 e7                	jne    8010b3 <strncmp+0x5>
+
+    if (!n) return 0;
+  8010cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d1:	c3                   	ret
+  8010d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d7:	c3                   	ret
+  8010d8:	48 85 d2             	test   %rdx,%rdx
+  8010db:	74 09                	je     8010e6 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8010dd:	0f b6 07             	movzbl (%rdi),%eax
+  8010e0:	0f b6 16             	movzbl (%rsi),%edx
+  8010e3:	29 d0                	sub    %edx,%eax
+  8010e5:	c3                   	ret
+    if (!n) return 0;
+  8010e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010eb:	c3                   	ret
+
+00000000008010ec <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8010ec:	0f b6 17             	movzbl (%rdi),%edx
+  8010ef:	84 d2                	test   %dl,%dl
+  8010f1:	74 18                	je     80110b <strchr+0x1f>
+        if (*str == c) {
+  8010f3:	0f be d2             	movsbl %dl,%edx
+  8010f6:	39 f2                	cmp    %esi,%edx
+  8010f8:	74 17                	je     801111 <strchr+0x25>
+    for (; *str; str++) {
+  8010fa:	48 83 c7 01          	add    $0x1,%rdi
+  8010fe:	0f b6 17             	movzbl (%rdi),%edx
+  801101:	84 d2                	test   %dl,%dl
+  801103:	75 ee                	jne    8010f3 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801105:	b8 00 00 00 00       	mov    $0x0,%eax
+  80110a:	c3                   	ret
+  80110b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801110:	c3                   	ret
+  801111:	48 89 f8             	mov    %rdi,%rax
+}
+  801114:	c3                   	ret
+
+0000000000801115 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801115:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801118:	0f b6 17             	movzbl (%rdi),%edx
+  80111b:	84 d2                	test   %dl,%dl
+  80111d:	74 13                	je     801132 <strfind+0x1d>
+  80111f:	0f be d2             	movsbl %dl,%edx
+  801122:	39 f2                	cmp    %esi,%edx
+  801124:	74 0b                	je     801131 <strfind+0x1c>
+  801126:	48 83 c0 01          	add    $0x1,%rax
+  80112a:	0f b6 10             	movzbl (%rax),%edx
+  80112d:	84 d2                	test   %dl,%dl
+  80112f:	75 ee                	jne    80111f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801131:	c3                   	ret
+  801132:	c3                   	ret
+
+0000000000801133 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801133:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801136:	48 89 f8             	mov    %rdi,%rax
+  801139:	48 f7 d8             	neg    %rax
+  80113c:	83 e0 07             	and    $0x7,%eax
+  80113f:	49 89 d1             	mov    %rdx,%r9
+  801142:	49 29 c1             	sub    %rax,%r9
+  801145:	78 36                	js     80117d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801147:	40 0f b6 c6          	movzbl %sil,%eax
+  80114b:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801152:	01 01 01 
+  801155:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801159:	40 f6 c7 07          	test   $0x7,%dil
+  80115d:	75 38                	jne    801197 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80115f:	4c 89 c9             	mov    %r9,%rcx
+  801162:	48 c1 f9 03          	sar    $0x3,%rcx
+  801166:	74 0c                	je     801174 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801168:	fc                   	cld
+  801169:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80116c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801170:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801174:	4d 85 c9             	test   %r9,%r9
+  801177:	75 45                	jne    8011be <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801179:	4c 89 c0             	mov    %r8,%rax
+  80117c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80117d:	48 85 d2             	test   %rdx,%rdx
+  801180:	74 f7                	je     801179 <memset+0x46>
+  801182:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801185:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801188:	48 83 c0 01          	add    $0x1,%rax
+  80118c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801190:	48 39 c2             	cmp    %rax,%rdx
+  801193:	75 f3                	jne    801188 <memset+0x55>
+  801195:	eb e2                	jmp    801179 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801197:	40 f6 c7 01          	test   $0x1,%dil
+  80119b:	74 06                	je     8011a3 <memset+0x70>
+  80119d:	88 07                	mov    %al,(%rdi)
+  80119f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011a3:	40 f6 c7 02          	test   $0x2,%dil
+  8011a7:	74 07                	je     8011b0 <memset+0x7d>
+  8011a9:	66 89 07             	mov    %ax,(%rdi)
+  8011ac:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011b0:	40 f6 c7 04          	test   $0x4,%dil
+  8011b4:	74 a9                	je     80115f <memset+0x2c>
+  8011b6:	89 07                	mov    %eax,(%rdi)
+  8011b8:	48 83 c7 04          	add    $0x4,%rdi
+  8011bc:	eb a1                	jmp    80115f <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011be:	41 f6 c1 04          	test   $0x4,%r9b
+  8011c2:	74 06                	je     8011ca <memset+0x97>
+  8011c4:	89 07                	mov    %eax,(%rdi)
+  8011c6:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011ca:	41 f6 c1 02          	test   $0x2,%r9b
+  8011ce:	74 07                	je     8011d7 <memset+0xa4>
+  8011d0:	66 89 07             	mov    %ax,(%rdi)
+  8011d3:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8011d7:	41 f6 c1 01          	test   $0x1,%r9b
+  8011db:	74 9c                	je     801179 <memset+0x46>
+  8011dd:	88 07                	mov    %al,(%rdi)
+  8011df:	eb 98                	jmp    801179 <memset+0x46>
+
+00000000008011e1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8011e1:	48 89 f8             	mov    %rdi,%rax
+  8011e4:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8011e7:	48 39 fe             	cmp    %rdi,%rsi
+  8011ea:	73 3b                	jae    801227 <memmove+0x46>
+  8011ec:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8011f0:	48 39 d7             	cmp    %rdx,%rdi
+  8011f3:	73 32                	jae    801227 <memmove+0x46>
+        s += n;
+        d += n;
+  8011f5:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8011f9:	48 89 d6             	mov    %rdx,%rsi
+  8011fc:	48 09 fe             	or     %rdi,%rsi
+  8011ff:	48 09 ce             	or     %rcx,%rsi
+  801202:	40 f6 c6 07          	test   $0x7,%sil
+  801206:	75 12                	jne    80121a <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801208:	48 83 ef 08          	sub    $0x8,%rdi
+  80120c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801210:	48 c1 e9 03          	shr    $0x3,%rcx
+  801214:	fd                   	std
+  801215:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801218:	fc                   	cld
+  801219:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80121a:	48 83 ef 01          	sub    $0x1,%rdi
+  80121e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801222:	fd                   	std
+  801223:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801225:	eb f1                	jmp    801218 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801227:	48 89 f2             	mov    %rsi,%rdx
+  80122a:	48 09 c2             	or     %rax,%rdx
+  80122d:	48 09 ca             	or     %rcx,%rdx
+  801230:	f6 c2 07             	test   $0x7,%dl
+  801233:	75 0c                	jne    801241 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801235:	48 c1 e9 03          	shr    $0x3,%rcx
+  801239:	48 89 c7             	mov    %rax,%rdi
+  80123c:	fc                   	cld
+  80123d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801240:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801241:	48 89 c7             	mov    %rax,%rdi
+  801244:	fc                   	cld
+  801245:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801247:	c3                   	ret
+
+0000000000801248 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801248:	55                   	push   %rbp
+  801249:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80124c:	48 b8 e1 11 80 00 00 	movabs $0x8011e1,%rax
+  801253:	00 00 00 
+  801256:	ff d0                	call   *%rax
+}
+  801258:	5d                   	pop    %rbp
+  801259:	c3                   	ret
+
+000000000080125a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80125a:	55                   	push   %rbp
+  80125b:	48 89 e5             	mov    %rsp,%rbp
+  80125e:	41 57                	push   %r15
+  801260:	41 56                	push   %r14
+  801262:	41 55                	push   %r13
+  801264:	41 54                	push   %r12
+  801266:	53                   	push   %rbx
+  801267:	48 83 ec 08          	sub    $0x8,%rsp
+  80126b:	49 89 fe             	mov    %rdi,%r14
+  80126e:	49 89 f7             	mov    %rsi,%r15
+  801271:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801274:	48 89 f7             	mov    %rsi,%rdi
+  801277:	48 b8 a9 0f 80 00 00 	movabs $0x800fa9,%rax
+  80127e:	00 00 00 
+  801281:	ff d0                	call   *%rax
+  801283:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801286:	48 89 de             	mov    %rbx,%rsi
+  801289:	4c 89 f7             	mov    %r14,%rdi
+  80128c:	48 b8 c4 0f 80 00 00 	movabs $0x800fc4,%rax
+  801293:	00 00 00 
+  801296:	ff d0                	call   *%rax
+  801298:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80129b:	48 39 c3             	cmp    %rax,%rbx
+  80129e:	74 36                	je     8012d6 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8012a0:	48 89 d8             	mov    %rbx,%rax
+  8012a3:	4c 29 e8             	sub    %r13,%rax
+  8012a6:	49 39 c4             	cmp    %rax,%r12
+  8012a9:	73 31                	jae    8012dc <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8012ab:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8012b0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012b4:	4c 89 fe             	mov    %r15,%rsi
+  8012b7:	48 b8 48 12 80 00 00 	movabs $0x801248,%rax
+  8012be:	00 00 00 
+  8012c1:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8012c3:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8012c7:	48 83 c4 08          	add    $0x8,%rsp
+  8012cb:	5b                   	pop    %rbx
+  8012cc:	41 5c                	pop    %r12
+  8012ce:	41 5d                	pop    %r13
+  8012d0:	41 5e                	pop    %r14
+  8012d2:	41 5f                	pop    %r15
+  8012d4:	5d                   	pop    %rbp
+  8012d5:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8012d6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012da:	eb eb                	jmp    8012c7 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8012dc:	48 83 eb 01          	sub    $0x1,%rbx
+  8012e0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012e4:	48 89 da             	mov    %rbx,%rdx
+  8012e7:	4c 89 fe             	mov    %r15,%rsi
+  8012ea:	48 b8 48 12 80 00 00 	movabs $0x801248,%rax
+  8012f1:	00 00 00 
+  8012f4:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8012f6:	49 01 de             	add    %rbx,%r14
+  8012f9:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8012fe:	eb c3                	jmp    8012c3 <strlcat+0x69>
+
+0000000000801300 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801300:	48 85 d2             	test   %rdx,%rdx
+  801303:	74 2d                	je     801332 <memcmp+0x32>
+  801305:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80130a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80130e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801313:	44 38 c1             	cmp    %r8b,%cl
+  801316:	75 0f                	jne    801327 <memcmp+0x27>
+    while (n-- > 0) {
+  801318:	48 83 c0 01          	add    $0x1,%rax
+  80131c:	48 39 c2             	cmp    %rax,%rdx
+  80131f:	75 e9                	jne    80130a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801321:	b8 00 00 00 00       	mov    $0x0,%eax
+  801326:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801327:	0f b6 c1             	movzbl %cl,%eax
+  80132a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80132e:	44 29 c0             	sub    %r8d,%eax
+  801331:	c3                   	ret
+    return 0;
+  801332:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801337:	c3                   	ret
+
+0000000000801338 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801338:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80133c:	48 39 c7             	cmp    %rax,%rdi
+  80133f:	73 0f                	jae    801350 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801341:	40 38 37             	cmp    %sil,(%rdi)
+  801344:	74 0e                	je     801354 <memfind+0x1c>
+    for (; src < end; src++) {
+  801346:	48 83 c7 01          	add    $0x1,%rdi
+  80134a:	48 39 f8             	cmp    %rdi,%rax
+  80134d:	75 f2                	jne    801341 <memfind+0x9>
+  80134f:	c3                   	ret
+  801350:	48 89 f8             	mov    %rdi,%rax
+  801353:	c3                   	ret
+  801354:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801357:	c3                   	ret
+
+0000000000801358 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801358:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80135b:	0f b6 37             	movzbl (%rdi),%esi
+  80135e:	40 80 fe 20          	cmp    $0x20,%sil
+  801362:	74 06                	je     80136a <strtol+0x12>
+  801364:	40 80 fe 09          	cmp    $0x9,%sil
+  801368:	75 13                	jne    80137d <strtol+0x25>
+  80136a:	48 83 c7 01          	add    $0x1,%rdi
+  80136e:	0f b6 37             	movzbl (%rdi),%esi
+  801371:	40 80 fe 20          	cmp    $0x20,%sil
+  801375:	74 f3                	je     80136a <strtol+0x12>
+  801377:	40 80 fe 09          	cmp    $0x9,%sil
+  80137b:	74 ed                	je     80136a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80137d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801380:	83 e0 fd             	and    $0xfffffffd,%eax
+  801383:	3c 01                	cmp    $0x1,%al
+  801385:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801389:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80138f:	75 0f                	jne    8013a0 <strtol+0x48>
+  801391:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801394:	74 14                	je     8013aa <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801396:	85 d2                	test   %edx,%edx
+  801398:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80139d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8013a0:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8013a5:	4c 63 ca             	movslq %edx,%r9
+  8013a8:	eb 36                	jmp    8013e0 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8013aa:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8013ae:	74 0f                	je     8013bf <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8013b0:	85 d2                	test   %edx,%edx
+  8013b2:	75 ec                	jne    8013a0 <strtol+0x48>
+        s++;
+  8013b4:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8013b8:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8013bd:	eb e1                	jmp    8013a0 <strtol+0x48>
+        s += 2;
+  8013bf:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8013c3:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8013c8:	eb d6                	jmp    8013a0 <strtol+0x48>
+            dig -= '0';
+  8013ca:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8013cd:	44 0f b6 c1          	movzbl %cl,%r8d
+  8013d1:	41 39 d0             	cmp    %edx,%r8d
+  8013d4:	7d 21                	jge    8013f7 <strtol+0x9f>
+        val = val * base + dig;
+  8013d6:	49 0f af c1          	imul   %r9,%rax
+  8013da:	0f b6 c9             	movzbl %cl,%ecx
+  8013dd:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8013e0:	48 83 c7 01          	add    $0x1,%rdi
+  8013e4:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8013e8:	80 f9 39             	cmp    $0x39,%cl
+  8013eb:	76 dd                	jbe    8013ca <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8013ed:	80 f9 7b             	cmp    $0x7b,%cl
+  8013f0:	77 05                	ja     8013f7 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8013f2:	83 e9 57             	sub    $0x57,%ecx
+  8013f5:	eb d6                	jmp    8013cd <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8013f7:	4d 85 d2             	test   %r10,%r10
+  8013fa:	74 03                	je     8013ff <strtol+0xa7>
+  8013fc:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8013ff:	48 89 c2             	mov    %rax,%rdx
+  801402:	48 f7 da             	neg    %rdx
+  801405:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801409:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80140d:	c3                   	ret
+
+000000000080140e <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80140e:	55                   	push   %rbp
+  80140f:	48 89 e5             	mov    %rsp,%rbp
+  801412:	53                   	push   %rbx
+  801413:	48 89 fa             	mov    %rdi,%rdx
+  801416:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801419:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80141e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801423:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801428:	be 00 00 00 00       	mov    $0x0,%esi
+  80142d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801433:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801435:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801439:	c9                   	leave
+  80143a:	c3                   	ret
+
+000000000080143b <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80143b:	55                   	push   %rbp
+  80143c:	48 89 e5             	mov    %rsp,%rbp
+  80143f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801440:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801445:	ba 00 00 00 00       	mov    $0x0,%edx
+  80144a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80144f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801454:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801459:	be 00 00 00 00       	mov    $0x0,%esi
+  80145e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801464:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801466:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80146a:	c9                   	leave
+  80146b:	c3                   	ret
+
+000000000080146c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80146c:	55                   	push   %rbp
+  80146d:	48 89 e5             	mov    %rsp,%rbp
+  801470:	53                   	push   %rbx
+  801471:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801475:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801478:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80147d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801482:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801487:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148c:	be 00 00 00 00       	mov    $0x0,%esi
+  801491:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801497:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801499:	48 85 c0             	test   %rax,%rax
+  80149c:	7f 06                	jg     8014a4 <sys_env_destroy+0x38>
+}
+  80149e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a2:	c9                   	leave
+  8014a3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014a4:	49 89 c0             	mov    %rax,%r8
+  8014a7:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8014ac:	48 ba 10 38 80 00 00 	movabs $0x803810,%rdx
+  8014b3:	00 00 00 
+  8014b6:	be 26 00 00 00       	mov    $0x26,%esi
+  8014bb:	48 bf 2f 38 80 00 00 	movabs $0x80382f,%rdi
+  8014c2:	00 00 00 
+  8014c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ca:	49 b9 72 05 80 00 00 	movabs $0x800572,%r9
+  8014d1:	00 00 00 
+  8014d4:	41 ff d1             	call   *%r9
+
+00000000008014d7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8014d7:	55                   	push   %rbp
+  8014d8:	48 89 e5             	mov    %rsp,%rbp
+  8014db:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014dc:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801500:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801502:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801506:	c9                   	leave
+  801507:	c3                   	ret
+
+0000000000801508 <sys_yield>:
+
+void
+sys_yield(void) {
+  801508:	55                   	push   %rbp
+  801509:	48 89 e5             	mov    %rsp,%rbp
+  80150c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80150d:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801512:	ba 00 00 00 00       	mov    $0x0,%edx
+  801517:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80151c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801521:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801526:	be 00 00 00 00       	mov    $0x0,%esi
+  80152b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801531:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801533:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801537:	c9                   	leave
+  801538:	c3                   	ret
+
+0000000000801539 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801539:	55                   	push   %rbp
+  80153a:	48 89 e5             	mov    %rsp,%rbp
+  80153d:	53                   	push   %rbx
+  80153e:	48 89 fa             	mov    %rdi,%rdx
+  801541:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801544:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801549:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801550:	00 00 00 
+  801553:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801558:	be 00 00 00 00       	mov    $0x0,%esi
+  80155d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801563:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801565:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801569:	c9                   	leave
+  80156a:	c3                   	ret
+
+000000000080156b <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80156b:	55                   	push   %rbp
+  80156c:	48 89 e5             	mov    %rsp,%rbp
+  80156f:	53                   	push   %rbx
+  801570:	49 89 f8             	mov    %rdi,%r8
+  801573:	48 89 d3             	mov    %rdx,%rbx
+  801576:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801579:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80157e:	4c 89 c2             	mov    %r8,%rdx
+  801581:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801584:	be 00 00 00 00       	mov    $0x0,%esi
+  801589:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80158f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801591:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801595:	c9                   	leave
+  801596:	c3                   	ret
+
+0000000000801597 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801597:	55                   	push   %rbp
+  801598:	48 89 e5             	mov    %rsp,%rbp
+  80159b:	53                   	push   %rbx
+  80159c:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a0:	89 f8                	mov    %edi,%eax
+  8015a2:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8015a5:	48 63 f9             	movslq %ecx,%rdi
+  8015a8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ab:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b0:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015c0:	48 85 c0             	test   %rax,%rax
+  8015c3:	7f 06                	jg     8015cb <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8015c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c9:	c9                   	leave
+  8015ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015cb:	49 89 c0             	mov    %rax,%r8
+  8015ce:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8015d3:	48 ba 10 38 80 00 00 	movabs $0x803810,%rdx
+  8015da:	00 00 00 
+  8015dd:	be 26 00 00 00       	mov    $0x26,%esi
+  8015e2:	48 bf 2f 38 80 00 00 	movabs $0x80382f,%rdi
+  8015e9:	00 00 00 
+  8015ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f1:	49 b9 72 05 80 00 00 	movabs $0x800572,%r9
+  8015f8:	00 00 00 
+  8015fb:	41 ff d1             	call   *%r9
+
+00000000008015fe <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8015fe:	55                   	push   %rbp
+  8015ff:	48 89 e5             	mov    %rsp,%rbp
+  801602:	53                   	push   %rbx
+  801603:	48 83 ec 08          	sub    $0x8,%rsp
+  801607:	89 f8                	mov    %edi,%eax
+  801609:	49 89 f2             	mov    %rsi,%r10
+  80160c:	48 89 cf             	mov    %rcx,%rdi
+  80160f:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801612:	48 63 da             	movslq %edx,%rbx
+  801615:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801618:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80161d:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801620:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801623:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801625:	48 85 c0             	test   %rax,%rax
+  801628:	7f 06                	jg     801630 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80162a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80162e:	c9                   	leave
+  80162f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801630:	49 89 c0             	mov    %rax,%r8
+  801633:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801638:	48 ba 10 38 80 00 00 	movabs $0x803810,%rdx
+  80163f:	00 00 00 
+  801642:	be 26 00 00 00       	mov    $0x26,%esi
+  801647:	48 bf 2f 38 80 00 00 	movabs $0x80382f,%rdi
+  80164e:	00 00 00 
+  801651:	b8 00 00 00 00       	mov    $0x0,%eax
+  801656:	49 b9 72 05 80 00 00 	movabs $0x800572,%r9
+  80165d:	00 00 00 
+  801660:	41 ff d1             	call   *%r9
+
+0000000000801663 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801663:	55                   	push   %rbp
+  801664:	48 89 e5             	mov    %rsp,%rbp
+  801667:	53                   	push   %rbx
+  801668:	48 83 ec 08          	sub    $0x8,%rsp
+  80166c:	48 89 f1             	mov    %rsi,%rcx
+  80166f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801672:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801675:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80167a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80167f:	be 00 00 00 00       	mov    $0x0,%esi
+  801684:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80168a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80168c:	48 85 c0             	test   %rax,%rax
+  80168f:	7f 06                	jg     801697 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801691:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801695:	c9                   	leave
+  801696:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801697:	49 89 c0             	mov    %rax,%r8
+  80169a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80169f:	48 ba 10 38 80 00 00 	movabs $0x803810,%rdx
+  8016a6:	00 00 00 
+  8016a9:	be 26 00 00 00       	mov    $0x26,%esi
+  8016ae:	48 bf 2f 38 80 00 00 	movabs $0x80382f,%rdi
+  8016b5:	00 00 00 
+  8016b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016bd:	49 b9 72 05 80 00 00 	movabs $0x800572,%r9
+  8016c4:	00 00 00 
+  8016c7:	41 ff d1             	call   *%r9
+
+00000000008016ca <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8016ca:	55                   	push   %rbp
+  8016cb:	48 89 e5             	mov    %rsp,%rbp
+  8016ce:	53                   	push   %rbx
+  8016cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8016d3:	89 f8                	mov    %edi,%eax
+  8016d5:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8016d8:	48 63 f9             	movslq %ecx,%rdi
+  8016db:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016de:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016e3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8016eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016f3:	48 85 c0             	test   %rax,%rax
+  8016f6:	7f 06                	jg     8016fe <sys_region_advise+0x34>
+}
+  8016f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016fc:	c9                   	leave
+  8016fd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016fe:	49 89 c0             	mov    %rax,%r8
+  801701:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801706:	48 ba 10 38 80 00 00 	movabs $0x803810,%rdx
+  80170d:	00 00 00 
+  801710:	be 26 00 00 00       	mov    $0x26,%esi
+  801715:	48 bf 2f 38 80 00 00 	movabs $0x80382f,%rdi
+  80171c:	00 00 00 
+  80171f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801724:	49 b9 72 05 80 00 00 	movabs $0x800572,%r9
+  80172b:	00 00 00 
+  80172e:	41 ff d1             	call   *%r9
+
+0000000000801731 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801731:	55                   	push   %rbp
+  801732:	48 89 e5             	mov    %rsp,%rbp
+  801735:	53                   	push   %rbx
+  801736:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80173a:	48 63 ce             	movslq %esi,%rcx
+  80173d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801740:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801745:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80174f:	be 00 00 00 00       	mov    $0x0,%esi
+  801754:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80175a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80175c:	48 85 c0             	test   %rax,%rax
+  80175f:	7f 06                	jg     801767 <sys_env_set_nice+0x36>
+}
+  801761:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801765:	c9                   	leave
+  801766:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801767:	49 89 c0             	mov    %rax,%r8
+  80176a:	b9 15 00 00 00       	mov    $0x15,%ecx
+  80176f:	48 ba 10 38 80 00 00 	movabs $0x803810,%rdx
+  801776:	00 00 00 
+  801779:	be 26 00 00 00       	mov    $0x26,%esi
+  80177e:	48 bf 2f 38 80 00 00 	movabs $0x80382f,%rdi
+  801785:	00 00 00 
+  801788:	b8 00 00 00 00       	mov    $0x0,%eax
+  80178d:	49 b9 72 05 80 00 00 	movabs $0x800572,%r9
+  801794:	00 00 00 
+  801797:	41 ff d1             	call   *%r9
+
+000000000080179a <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80179a:	55                   	push   %rbp
+  80179b:	48 89 e5             	mov    %rsp,%rbp
+  80179e:	53                   	push   %rbx
+  80179f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8017a3:	48 63 ce             	movslq %esi,%rcx
+  8017a6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a9:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8017bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017c5:	48 85 c0             	test   %rax,%rax
+  8017c8:	7f 06                	jg     8017d0 <sys_env_set_status+0x36>
+}
+  8017ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ce:	c9                   	leave
+  8017cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017d0:	49 89 c0             	mov    %rax,%r8
+  8017d3:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8017d8:	48 ba 10 38 80 00 00 	movabs $0x803810,%rdx
+  8017df:	00 00 00 
+  8017e2:	be 26 00 00 00       	mov    $0x26,%esi
+  8017e7:	48 bf 2f 38 80 00 00 	movabs $0x80382f,%rdi
+  8017ee:	00 00 00 
+  8017f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f6:	49 b9 72 05 80 00 00 	movabs $0x800572,%r9
+  8017fd:	00 00 00 
+  801800:	41 ff d1             	call   *%r9
+
+0000000000801803 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801803:	55                   	push   %rbp
+  801804:	48 89 e5             	mov    %rsp,%rbp
+  801807:	53                   	push   %rbx
+  801808:	48 83 ec 08          	sub    $0x8,%rsp
+  80180c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80180f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801812:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801817:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80181c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801821:	be 00 00 00 00       	mov    $0x0,%esi
+  801826:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80182c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80182e:	48 85 c0             	test   %rax,%rax
+  801831:	7f 06                	jg     801839 <sys_env_set_trapframe+0x36>
+}
+  801833:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801837:	c9                   	leave
+  801838:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801839:	49 89 c0             	mov    %rax,%r8
+  80183c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801841:	48 ba 10 38 80 00 00 	movabs $0x803810,%rdx
+  801848:	00 00 00 
+  80184b:	be 26 00 00 00       	mov    $0x26,%esi
+  801850:	48 bf 2f 38 80 00 00 	movabs $0x80382f,%rdi
+  801857:	00 00 00 
+  80185a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185f:	49 b9 72 05 80 00 00 	movabs $0x800572,%r9
+  801866:	00 00 00 
+  801869:	41 ff d1             	call   *%r9
+
+000000000080186c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80186c:	55                   	push   %rbp
+  80186d:	48 89 e5             	mov    %rsp,%rbp
+  801870:	53                   	push   %rbx
+  801871:	48 83 ec 08          	sub    $0x8,%rsp
+  801875:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801878:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80187b:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801880:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801885:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80188a:	be 00 00 00 00       	mov    $0x0,%esi
+  80188f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801895:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801897:	48 85 c0             	test   %rax,%rax
+  80189a:	7f 06                	jg     8018a2 <sys_env_set_pgfault_upcall+0x36>
+}
+  80189c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a0:	c9                   	leave
+  8018a1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018a2:	49 89 c0             	mov    %rax,%r8
+  8018a5:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8018aa:	48 ba 10 38 80 00 00 	movabs $0x803810,%rdx
+  8018b1:	00 00 00 
+  8018b4:	be 26 00 00 00       	mov    $0x26,%esi
+  8018b9:	48 bf 2f 38 80 00 00 	movabs $0x80382f,%rdi
+  8018c0:	00 00 00 
+  8018c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c8:	49 b9 72 05 80 00 00 	movabs $0x800572,%r9
+  8018cf:	00 00 00 
+  8018d2:	41 ff d1             	call   *%r9
+
+00000000008018d5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8018d5:	55                   	push   %rbp
+  8018d6:	48 89 e5             	mov    %rsp,%rbp
+  8018d9:	53                   	push   %rbx
+  8018da:	89 f8                	mov    %edi,%eax
+  8018dc:	49 89 f1             	mov    %rsi,%r9
+  8018df:	48 89 d3             	mov    %rdx,%rbx
+  8018e2:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8018e5:	49 63 f0             	movslq %r8d,%rsi
+  8018e8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018eb:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018f0:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018f9:	cd 30                	int    $0x30
+}
+  8018fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018ff:	c9                   	leave
+  801900:	c3                   	ret
+
+0000000000801901 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801901:	55                   	push   %rbp
+  801902:	48 89 e5             	mov    %rsp,%rbp
+  801905:	53                   	push   %rbx
+  801906:	48 83 ec 08          	sub    $0x8,%rsp
+  80190a:	48 89 fa             	mov    %rdi,%rdx
+  80190d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801910:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801915:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80191a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80191f:	be 00 00 00 00       	mov    $0x0,%esi
+  801924:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80192a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80192c:	48 85 c0             	test   %rax,%rax
+  80192f:	7f 06                	jg     801937 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801931:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801935:	c9                   	leave
+  801936:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801937:	49 89 c0             	mov    %rax,%r8
+  80193a:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80193f:	48 ba 10 38 80 00 00 	movabs $0x803810,%rdx
+  801946:	00 00 00 
+  801949:	be 26 00 00 00       	mov    $0x26,%esi
+  80194e:	48 bf 2f 38 80 00 00 	movabs $0x80382f,%rdi
+  801955:	00 00 00 
+  801958:	b8 00 00 00 00       	mov    $0x0,%eax
+  80195d:	49 b9 72 05 80 00 00 	movabs $0x800572,%r9
+  801964:	00 00 00 
+  801967:	41 ff d1             	call   *%r9
+
+000000000080196a <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80196a:	55                   	push   %rbp
+  80196b:	48 89 e5             	mov    %rsp,%rbp
+  80196e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80196f:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801974:	ba 00 00 00 00       	mov    $0x0,%edx
+  801979:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80197e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801983:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801988:	be 00 00 00 00       	mov    $0x0,%esi
+  80198d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801993:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801995:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801999:	c9                   	leave
+  80199a:	c3                   	ret
+
+000000000080199b <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80199b:	55                   	push   %rbp
+  80199c:	48 89 e5             	mov    %rsp,%rbp
+  80199f:	53                   	push   %rbx
+  8019a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8019a4:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8019a7:	48 63 ce             	movslq %esi,%rcx
+  8019aa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019ad:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8019bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019c4:	48 85 c0             	test   %rax,%rax
+  8019c7:	7f 06                	jg     8019cf <sys_sigqueue+0x34>
+}
+  8019c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019cd:	c9                   	leave
+  8019ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019cf:	49 89 c0             	mov    %rax,%r8
+  8019d2:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8019d7:	48 ba 10 38 80 00 00 	movabs $0x803810,%rdx
+  8019de:	00 00 00 
+  8019e1:	be 26 00 00 00       	mov    $0x26,%esi
+  8019e6:	48 bf 2f 38 80 00 00 	movabs $0x80382f,%rdi
+  8019ed:	00 00 00 
+  8019f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f5:	49 b9 72 05 80 00 00 	movabs $0x800572,%r9
+  8019fc:	00 00 00 
+  8019ff:	41 ff d1             	call   *%r9
+
+0000000000801a02 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801a02:	55                   	push   %rbp
+  801a03:	48 89 e5             	mov    %rsp,%rbp
+  801a06:	53                   	push   %rbx
+  801a07:	48 83 ec 08          	sub    $0x8,%rsp
+  801a0b:	48 89 fa             	mov    %rdi,%rdx
+  801a0e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a11:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a1b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a20:	be 00 00 00 00       	mov    $0x0,%esi
+  801a25:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a2b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a2d:	48 85 c0             	test   %rax,%rax
+  801a30:	7f 06                	jg     801a38 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801a32:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a36:	c9                   	leave
+  801a37:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a38:	49 89 c0             	mov    %rax,%r8
+  801a3b:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801a40:	48 ba 10 38 80 00 00 	movabs $0x803810,%rdx
+  801a47:	00 00 00 
+  801a4a:	be 26 00 00 00       	mov    $0x26,%esi
+  801a4f:	48 bf 2f 38 80 00 00 	movabs $0x80382f,%rdi
+  801a56:	00 00 00 
+  801a59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5e:	49 b9 72 05 80 00 00 	movabs $0x800572,%r9
+  801a65:	00 00 00 
+  801a68:	41 ff d1             	call   *%r9
+
+0000000000801a6b <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801a6b:	55                   	push   %rbp
+  801a6c:	48 89 e5             	mov    %rsp,%rbp
+  801a6f:	53                   	push   %rbx
+  801a70:	48 83 ec 08          	sub    $0x8,%rsp
+  801a74:	48 89 f1             	mov    %rsi,%rcx
+  801a77:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801a7a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a7d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a82:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a87:	be 00 00 00 00       	mov    $0x0,%esi
+  801a8c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a92:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a94:	48 85 c0             	test   %rax,%rax
+  801a97:	7f 06                	jg     801a9f <sys_sigaction+0x34>
+}
+  801a99:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a9d:	c9                   	leave
+  801a9e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a9f:	49 89 c0             	mov    %rax,%r8
+  801aa2:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801aa7:	48 ba 10 38 80 00 00 	movabs $0x803810,%rdx
+  801aae:	00 00 00 
+  801ab1:	be 26 00 00 00       	mov    $0x26,%esi
+  801ab6:	48 bf 2f 38 80 00 00 	movabs $0x80382f,%rdi
+  801abd:	00 00 00 
+  801ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac5:	49 b9 72 05 80 00 00 	movabs $0x800572,%r9
+  801acc:	00 00 00 
+  801acf:	41 ff d1             	call   *%r9
+
+0000000000801ad2 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801ad2:	55                   	push   %rbp
+  801ad3:	48 89 e5             	mov    %rsp,%rbp
+  801ad6:	53                   	push   %rbx
+  801ad7:	48 83 ec 08          	sub    $0x8,%rsp
+  801adb:	48 89 f1             	mov    %rsi,%rcx
+  801ade:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801ae1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ae4:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ae9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aee:	be 00 00 00 00       	mov    $0x0,%esi
+  801af3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801af9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801afb:	48 85 c0             	test   %rax,%rax
+  801afe:	7f 06                	jg     801b06 <sys_sigprocmask+0x34>
+}
+  801b00:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b04:	c9                   	leave
+  801b05:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b06:	49 89 c0             	mov    %rax,%r8
+  801b09:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801b0e:	48 ba 10 38 80 00 00 	movabs $0x803810,%rdx
+  801b15:	00 00 00 
+  801b18:	be 26 00 00 00       	mov    $0x26,%esi
+  801b1d:	48 bf 2f 38 80 00 00 	movabs $0x80382f,%rdi
+  801b24:	00 00 00 
+  801b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2c:	49 b9 72 05 80 00 00 	movabs $0x800572,%r9
+  801b33:	00 00 00 
+  801b36:	41 ff d1             	call   *%r9
+
+0000000000801b39 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801b39:	55                   	push   %rbp
+  801b3a:	48 89 e5             	mov    %rsp,%rbp
+  801b3d:	41 54                	push   %r12
+  801b3f:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801b40:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b45:	cd 30                	int    $0x30
+  801b47:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  801b4a:	85 c0                	test   %eax,%eax
+  801b4c:	78 76                	js     801bc4 <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  801b4e:	74 7c                	je     801bcc <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  801b50:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801b56:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801b5d:	00 00 00 
+  801b60:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b65:	89 c2                	mov    %eax,%edx
+  801b67:	be 00 00 00 00       	mov    $0x0,%esi
+  801b6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b71:	48 b8 fe 15 80 00 00 	movabs $0x8015fe,%rax
+  801b78:	00 00 00 
+  801b7b:	ff d0                	call   *%rax
+  801b7d:	85 c0                	test   %eax,%eax
+  801b7f:	75 7a                	jne    801bfb <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  801b81:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b88:	00 00 00 
+  801b8b:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801b92:	44 89 e7             	mov    %r12d,%edi
+  801b95:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  801b9c:	00 00 00 
+  801b9f:	ff d0                	call   *%rax
+  801ba1:	85 c0                	test   %eax,%eax
+  801ba3:	75 5e                	jne    801c03 <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  801ba5:	be 02 00 00 00       	mov    $0x2,%esi
+  801baa:	44 89 e7             	mov    %r12d,%edi
+  801bad:	48 b8 9a 17 80 00 00 	movabs $0x80179a,%rax
+  801bb4:	00 00 00 
+  801bb7:	ff d0                	call   *%rax
+        return -1;
+  801bb9:	85 c0                	test   %eax,%eax
+  801bbb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801bc0:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  801bc4:	44 89 e0             	mov    %r12d,%eax
+  801bc7:	5b                   	pop    %rbx
+  801bc8:	41 5c                	pop    %r12
+  801bca:	5d                   	pop    %rbp
+  801bcb:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  801bcc:	48 b8 d7 14 80 00 00 	movabs $0x8014d7,%rax
+  801bd3:	00 00 00 
+  801bd6:	ff d0                	call   *%rax
+  801bd8:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  801bdb:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  801be2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801be9:	00 00 00 
+  801bec:	48 01 d0             	add    %rdx,%rax
+  801bef:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  801bf6:	00 00 00 
+        return 0;
+  801bf9:	eb c9                	jmp    801bc4 <fork+0x8b>
+        return -1;
+  801bfb:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801c01:	eb c1                	jmp    801bc4 <fork+0x8b>
+        return -1;
+  801c03:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801c09:	eb b9                	jmp    801bc4 <fork+0x8b>
+
+0000000000801c0b <sfork>:
+
+envid_t
+sfork() {
+  801c0b:	55                   	push   %rbp
+  801c0c:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801c0f:	48 ba 3d 38 80 00 00 	movabs $0x80383d,%rdx
+  801c16:	00 00 00 
+  801c19:	be 2e 00 00 00       	mov    $0x2e,%esi
+  801c1e:	48 bf 58 38 80 00 00 	movabs $0x803858,%rdi
+  801c25:	00 00 00 
+  801c28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2d:	48 b9 72 05 80 00 00 	movabs $0x800572,%rcx
+  801c34:	00 00 00 
+  801c37:	ff d1                	call   *%rcx
+
+0000000000801c39 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c39:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c40:	ff ff ff 
+  801c43:	48 01 f8             	add    %rdi,%rax
+  801c46:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801c4a:	c3                   	ret
+
+0000000000801c4b <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c4b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c52:	ff ff ff 
+  801c55:	48 01 f8             	add    %rdi,%rax
+  801c58:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801c5c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801c62:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801c66:	c3                   	ret
+
+0000000000801c67 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801c67:	55                   	push   %rbp
+  801c68:	48 89 e5             	mov    %rsp,%rbp
+  801c6b:	41 57                	push   %r15
+  801c6d:	41 56                	push   %r14
+  801c6f:	41 55                	push   %r13
+  801c71:	41 54                	push   %r12
+  801c73:	53                   	push   %rbx
+  801c74:	48 83 ec 08          	sub    $0x8,%rsp
+  801c78:	49 89 ff             	mov    %rdi,%r15
+  801c7b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801c80:	49 bd 97 2c 80 00 00 	movabs $0x802c97,%r13
+  801c87:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801c8a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801c90:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801c93:	48 89 df             	mov    %rbx,%rdi
+  801c96:	41 ff d5             	call   *%r13
+  801c99:	83 e0 04             	and    $0x4,%eax
+  801c9c:	74 17                	je     801cb5 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801c9e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801ca5:	4c 39 f3             	cmp    %r14,%rbx
+  801ca8:	75 e6                	jne    801c90 <fd_alloc+0x29>
+  801caa:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801cb0:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801cb5:	4d 89 27             	mov    %r12,(%r15)
+}
+  801cb8:	48 83 c4 08          	add    $0x8,%rsp
+  801cbc:	5b                   	pop    %rbx
+  801cbd:	41 5c                	pop    %r12
+  801cbf:	41 5d                	pop    %r13
+  801cc1:	41 5e                	pop    %r14
+  801cc3:	41 5f                	pop    %r15
+  801cc5:	5d                   	pop    %rbp
+  801cc6:	c3                   	ret
+
+0000000000801cc7 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801cc7:	83 ff 1f             	cmp    $0x1f,%edi
+  801cca:	77 39                	ja     801d05 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801ccc:	55                   	push   %rbp
+  801ccd:	48 89 e5             	mov    %rsp,%rbp
+  801cd0:	41 54                	push   %r12
+  801cd2:	53                   	push   %rbx
+  801cd3:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801cd6:	48 63 df             	movslq %edi,%rbx
+  801cd9:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801ce0:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ce4:	48 89 df             	mov    %rbx,%rdi
+  801ce7:	48 b8 97 2c 80 00 00 	movabs $0x802c97,%rax
+  801cee:	00 00 00 
+  801cf1:	ff d0                	call   *%rax
+  801cf3:	a8 04                	test   $0x4,%al
+  801cf5:	74 14                	je     801d0b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801cf7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d00:	5b                   	pop    %rbx
+  801d01:	41 5c                	pop    %r12
+  801d03:	5d                   	pop    %rbp
+  801d04:	c3                   	ret
+        return -E_INVAL;
+  801d05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801d0a:	c3                   	ret
+        return -E_INVAL;
+  801d0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d10:	eb ee                	jmp    801d00 <fd_lookup+0x39>
+
+0000000000801d12 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801d12:	55                   	push   %rbp
+  801d13:	48 89 e5             	mov    %rsp,%rbp
+  801d16:	41 54                	push   %r12
+  801d18:	53                   	push   %rbx
+  801d19:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801d1c:	48 b8 00 39 80 00 00 	movabs $0x803900,%rax
+  801d23:	00 00 00 
+  801d26:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801d2d:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801d30:	39 3b                	cmp    %edi,(%rbx)
+  801d32:	74 47                	je     801d7b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801d34:	48 83 c0 08          	add    $0x8,%rax
+  801d38:	48 8b 18             	mov    (%rax),%rbx
+  801d3b:	48 85 db             	test   %rbx,%rbx
+  801d3e:	75 f0                	jne    801d30 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801d40:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d47:	00 00 00 
+  801d4a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d50:	89 fa                	mov    %edi,%edx
+  801d52:	48 bf 68 38 80 00 00 	movabs $0x803868,%rdi
+  801d59:	00 00 00 
+  801d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d61:	48 b9 c2 06 80 00 00 	movabs $0x8006c2,%rcx
+  801d68:	00 00 00 
+  801d6b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801d6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801d72:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801d76:	5b                   	pop    %rbx
+  801d77:	41 5c                	pop    %r12
+  801d79:	5d                   	pop    %rbp
+  801d7a:	c3                   	ret
+            return 0;
+  801d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d80:	eb f0                	jmp    801d72 <dev_lookup+0x60>
+
+0000000000801d82 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801d82:	55                   	push   %rbp
+  801d83:	48 89 e5             	mov    %rsp,%rbp
+  801d86:	41 55                	push   %r13
+  801d88:	41 54                	push   %r12
+  801d8a:	53                   	push   %rbx
+  801d8b:	48 83 ec 18          	sub    $0x18,%rsp
+  801d8f:	48 89 fb             	mov    %rdi,%rbx
+  801d92:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801d95:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801d9c:	ff ff ff 
+  801d9f:	48 01 df             	add    %rbx,%rdi
+  801da2:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801da6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801daa:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  801db1:	00 00 00 
+  801db4:	ff d0                	call   *%rax
+  801db6:	41 89 c5             	mov    %eax,%r13d
+  801db9:	85 c0                	test   %eax,%eax
+  801dbb:	78 06                	js     801dc3 <fd_close+0x41>
+  801dbd:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801dc1:	74 1a                	je     801ddd <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801dc3:	45 84 e4             	test   %r12b,%r12b
+  801dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dcb:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801dcf:	44 89 e8             	mov    %r13d,%eax
+  801dd2:	48 83 c4 18          	add    $0x18,%rsp
+  801dd6:	5b                   	pop    %rbx
+  801dd7:	41 5c                	pop    %r12
+  801dd9:	41 5d                	pop    %r13
+  801ddb:	5d                   	pop    %rbp
+  801ddc:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ddd:	8b 3b                	mov    (%rbx),%edi
+  801ddf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801de3:	48 b8 12 1d 80 00 00 	movabs $0x801d12,%rax
+  801dea:	00 00 00 
+  801ded:	ff d0                	call   *%rax
+  801def:	41 89 c5             	mov    %eax,%r13d
+  801df2:	85 c0                	test   %eax,%eax
+  801df4:	78 1b                	js     801e11 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801df6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dfa:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801dfe:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e04:	48 85 c0             	test   %rax,%rax
+  801e07:	74 08                	je     801e11 <fd_close+0x8f>
+  801e09:	48 89 df             	mov    %rbx,%rdi
+  801e0c:	ff d0                	call   *%rax
+  801e0e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801e11:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e16:	48 89 de             	mov    %rbx,%rsi
+  801e19:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e1e:	48 b8 63 16 80 00 00 	movabs $0x801663,%rax
+  801e25:	00 00 00 
+  801e28:	ff d0                	call   *%rax
+    return res;
+  801e2a:	eb a3                	jmp    801dcf <fd_close+0x4d>
+
+0000000000801e2c <close>:
+
+int
+close(int fdnum) {
+  801e2c:	55                   	push   %rbp
+  801e2d:	48 89 e5             	mov    %rsp,%rbp
+  801e30:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801e34:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e38:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  801e3f:	00 00 00 
+  801e42:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e44:	85 c0                	test   %eax,%eax
+  801e46:	78 15                	js     801e5d <close+0x31>
+
+    return fd_close(fd, 1);
+  801e48:	be 01 00 00 00       	mov    $0x1,%esi
+  801e4d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801e51:	48 b8 82 1d 80 00 00 	movabs $0x801d82,%rax
+  801e58:	00 00 00 
+  801e5b:	ff d0                	call   *%rax
+}
+  801e5d:	c9                   	leave
+  801e5e:	c3                   	ret
+
+0000000000801e5f <close_all>:
+
+void
+close_all(void) {
+  801e5f:	55                   	push   %rbp
+  801e60:	48 89 e5             	mov    %rsp,%rbp
+  801e63:	41 54                	push   %r12
+  801e65:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801e66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e6b:	49 bc 2c 1e 80 00 00 	movabs $0x801e2c,%r12
+  801e72:	00 00 00 
+  801e75:	89 df                	mov    %ebx,%edi
+  801e77:	41 ff d4             	call   *%r12
+  801e7a:	83 c3 01             	add    $0x1,%ebx
+  801e7d:	83 fb 20             	cmp    $0x20,%ebx
+  801e80:	75 f3                	jne    801e75 <close_all+0x16>
+}
+  801e82:	5b                   	pop    %rbx
+  801e83:	41 5c                	pop    %r12
+  801e85:	5d                   	pop    %rbp
+  801e86:	c3                   	ret
+
+0000000000801e87 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801e87:	55                   	push   %rbp
+  801e88:	48 89 e5             	mov    %rsp,%rbp
+  801e8b:	41 57                	push   %r15
+  801e8d:	41 56                	push   %r14
+  801e8f:	41 55                	push   %r13
+  801e91:	41 54                	push   %r12
+  801e93:	53                   	push   %rbx
+  801e94:	48 83 ec 18          	sub    $0x18,%rsp
+  801e98:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801e9b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801e9f:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  801ea6:	00 00 00 
+  801ea9:	ff d0                	call   *%rax
+  801eab:	89 c3                	mov    %eax,%ebx
+  801ead:	85 c0                	test   %eax,%eax
+  801eaf:	0f 88 b8 00 00 00    	js     801f6d <dup+0xe6>
+    close(newfdnum);
+  801eb5:	44 89 e7             	mov    %r12d,%edi
+  801eb8:	48 b8 2c 1e 80 00 00 	movabs $0x801e2c,%rax
+  801ebf:	00 00 00 
+  801ec2:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801ec4:	4d 63 ec             	movslq %r12d,%r13
+  801ec7:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801ece:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801ed2:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ed6:	4c 89 ff             	mov    %r15,%rdi
+  801ed9:	49 be 4b 1c 80 00 00 	movabs $0x801c4b,%r14
+  801ee0:	00 00 00 
+  801ee3:	41 ff d6             	call   *%r14
+  801ee6:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801ee9:	4c 89 ef             	mov    %r13,%rdi
+  801eec:	41 ff d6             	call   *%r14
+  801eef:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801ef2:	48 89 df             	mov    %rbx,%rdi
+  801ef5:	48 b8 97 2c 80 00 00 	movabs $0x802c97,%rax
+  801efc:	00 00 00 
+  801eff:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801f01:	a8 04                	test   $0x4,%al
+  801f03:	74 2b                	je     801f30 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801f05:	41 89 c1             	mov    %eax,%r9d
+  801f08:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f0e:	4c 89 f1             	mov    %r14,%rcx
+  801f11:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f16:	48 89 de             	mov    %rbx,%rsi
+  801f19:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f1e:	48 b8 fe 15 80 00 00 	movabs $0x8015fe,%rax
+  801f25:	00 00 00 
+  801f28:	ff d0                	call   *%rax
+  801f2a:	89 c3                	mov    %eax,%ebx
+  801f2c:	85 c0                	test   %eax,%eax
+  801f2e:	78 4e                	js     801f7e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801f30:	4c 89 ff             	mov    %r15,%rdi
+  801f33:	48 b8 97 2c 80 00 00 	movabs $0x802c97,%rax
+  801f3a:	00 00 00 
+  801f3d:	ff d0                	call   *%rax
+  801f3f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801f42:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f48:	4c 89 e9             	mov    %r13,%rcx
+  801f4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f50:	4c 89 fe             	mov    %r15,%rsi
+  801f53:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f58:	48 b8 fe 15 80 00 00 	movabs $0x8015fe,%rax
+  801f5f:	00 00 00 
+  801f62:	ff d0                	call   *%rax
+  801f64:	89 c3                	mov    %eax,%ebx
+  801f66:	85 c0                	test   %eax,%eax
+  801f68:	78 14                	js     801f7e <dup+0xf7>
+
+    return newfdnum;
+  801f6a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801f6d:	89 d8                	mov    %ebx,%eax
+  801f6f:	48 83 c4 18          	add    $0x18,%rsp
+  801f73:	5b                   	pop    %rbx
+  801f74:	41 5c                	pop    %r12
+  801f76:	41 5d                	pop    %r13
+  801f78:	41 5e                	pop    %r14
+  801f7a:	41 5f                	pop    %r15
+  801f7c:	5d                   	pop    %rbp
+  801f7d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801f7e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f83:	4c 89 ee             	mov    %r13,%rsi
+  801f86:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f8b:	49 bc 63 16 80 00 00 	movabs $0x801663,%r12
+  801f92:	00 00 00 
+  801f95:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801f98:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f9d:	4c 89 f6             	mov    %r14,%rsi
+  801fa0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fa5:	41 ff d4             	call   *%r12
+    return res;
+  801fa8:	eb c3                	jmp    801f6d <dup+0xe6>
+
+0000000000801faa <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801faa:	55                   	push   %rbp
+  801fab:	48 89 e5             	mov    %rsp,%rbp
+  801fae:	41 56                	push   %r14
+  801fb0:	41 55                	push   %r13
+  801fb2:	41 54                	push   %r12
+  801fb4:	53                   	push   %rbx
+  801fb5:	48 83 ec 10          	sub    $0x10,%rsp
+  801fb9:	89 fb                	mov    %edi,%ebx
+  801fbb:	49 89 f4             	mov    %rsi,%r12
+  801fbe:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fc1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fc5:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  801fcc:	00 00 00 
+  801fcf:	ff d0                	call   *%rax
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	78 4c                	js     802021 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fd5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801fd9:	41 8b 3e             	mov    (%r14),%edi
+  801fdc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fe0:	48 b8 12 1d 80 00 00 	movabs $0x801d12,%rax
+  801fe7:	00 00 00 
+  801fea:	ff d0                	call   *%rax
+  801fec:	85 c0                	test   %eax,%eax
+  801fee:	78 35                	js     802025 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ff0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ff4:	83 e0 03             	and    $0x3,%eax
+  801ff7:	83 f8 01             	cmp    $0x1,%eax
+  801ffa:	74 2d                	je     802029 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ffc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802000:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802004:	48 85 c0             	test   %rax,%rax
+  802007:	74 56                	je     80205f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802009:	4c 89 ea             	mov    %r13,%rdx
+  80200c:	4c 89 e6             	mov    %r12,%rsi
+  80200f:	4c 89 f7             	mov    %r14,%rdi
+  802012:	ff d0                	call   *%rax
+}
+  802014:	48 83 c4 10          	add    $0x10,%rsp
+  802018:	5b                   	pop    %rbx
+  802019:	41 5c                	pop    %r12
+  80201b:	41 5d                	pop    %r13
+  80201d:	41 5e                	pop    %r14
+  80201f:	5d                   	pop    %rbp
+  802020:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802021:	48 98                	cltq
+  802023:	eb ef                	jmp    802014 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802025:	48 98                	cltq
+  802027:	eb eb                	jmp    802014 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802029:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802030:	00 00 00 
+  802033:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802039:	89 da                	mov    %ebx,%edx
+  80203b:	48 bf a9 38 80 00 00 	movabs $0x8038a9,%rdi
+  802042:	00 00 00 
+  802045:	b8 00 00 00 00       	mov    $0x0,%eax
+  80204a:	48 b9 c2 06 80 00 00 	movabs $0x8006c2,%rcx
+  802051:	00 00 00 
+  802054:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802056:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80205d:	eb b5                	jmp    802014 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80205f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802066:	eb ac                	jmp    802014 <read+0x6a>
+
+0000000000802068 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802068:	55                   	push   %rbp
+  802069:	48 89 e5             	mov    %rsp,%rbp
+  80206c:	41 57                	push   %r15
+  80206e:	41 56                	push   %r14
+  802070:	41 55                	push   %r13
+  802072:	41 54                	push   %r12
+  802074:	53                   	push   %rbx
+  802075:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802079:	48 85 d2             	test   %rdx,%rdx
+  80207c:	74 54                	je     8020d2 <readn+0x6a>
+  80207e:	41 89 fd             	mov    %edi,%r13d
+  802081:	49 89 f6             	mov    %rsi,%r14
+  802084:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802087:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80208c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802091:	49 bf aa 1f 80 00 00 	movabs $0x801faa,%r15
+  802098:	00 00 00 
+  80209b:	4c 89 e2             	mov    %r12,%rdx
+  80209e:	48 29 f2             	sub    %rsi,%rdx
+  8020a1:	4c 01 f6             	add    %r14,%rsi
+  8020a4:	44 89 ef             	mov    %r13d,%edi
+  8020a7:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8020aa:	85 c0                	test   %eax,%eax
+  8020ac:	78 20                	js     8020ce <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8020ae:	01 c3                	add    %eax,%ebx
+  8020b0:	85 c0                	test   %eax,%eax
+  8020b2:	74 08                	je     8020bc <readn+0x54>
+  8020b4:	48 63 f3             	movslq %ebx,%rsi
+  8020b7:	4c 39 e6             	cmp    %r12,%rsi
+  8020ba:	72 df                	jb     80209b <readn+0x33>
+    }
+    return res;
+  8020bc:	48 63 c3             	movslq %ebx,%rax
+}
+  8020bf:	48 83 c4 08          	add    $0x8,%rsp
+  8020c3:	5b                   	pop    %rbx
+  8020c4:	41 5c                	pop    %r12
+  8020c6:	41 5d                	pop    %r13
+  8020c8:	41 5e                	pop    %r14
+  8020ca:	41 5f                	pop    %r15
+  8020cc:	5d                   	pop    %rbp
+  8020cd:	c3                   	ret
+        if (inc < 0) return inc;
+  8020ce:	48 98                	cltq
+  8020d0:	eb ed                	jmp    8020bf <readn+0x57>
+    int inc = 1, res = 0;
+  8020d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020d7:	eb e3                	jmp    8020bc <readn+0x54>
+
+00000000008020d9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8020d9:	55                   	push   %rbp
+  8020da:	48 89 e5             	mov    %rsp,%rbp
+  8020dd:	41 56                	push   %r14
+  8020df:	41 55                	push   %r13
+  8020e1:	41 54                	push   %r12
+  8020e3:	53                   	push   %rbx
+  8020e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8020e8:	89 fb                	mov    %edi,%ebx
+  8020ea:	49 89 f4             	mov    %rsi,%r12
+  8020ed:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020f0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020f4:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  8020fb:	00 00 00 
+  8020fe:	ff d0                	call   *%rax
+  802100:	85 c0                	test   %eax,%eax
+  802102:	78 47                	js     80214b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802104:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802108:	41 8b 3e             	mov    (%r14),%edi
+  80210b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80210f:	48 b8 12 1d 80 00 00 	movabs $0x801d12,%rax
+  802116:	00 00 00 
+  802119:	ff d0                	call   *%rax
+  80211b:	85 c0                	test   %eax,%eax
+  80211d:	78 30                	js     80214f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80211f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802124:	74 2d                	je     802153 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802126:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80212a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80212e:	48 85 c0             	test   %rax,%rax
+  802131:	74 56                	je     802189 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802133:	4c 89 ea             	mov    %r13,%rdx
+  802136:	4c 89 e6             	mov    %r12,%rsi
+  802139:	4c 89 f7             	mov    %r14,%rdi
+  80213c:	ff d0                	call   *%rax
+}
+  80213e:	48 83 c4 10          	add    $0x10,%rsp
+  802142:	5b                   	pop    %rbx
+  802143:	41 5c                	pop    %r12
+  802145:	41 5d                	pop    %r13
+  802147:	41 5e                	pop    %r14
+  802149:	5d                   	pop    %rbp
+  80214a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80214b:	48 98                	cltq
+  80214d:	eb ef                	jmp    80213e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80214f:	48 98                	cltq
+  802151:	eb eb                	jmp    80213e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802153:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80215a:	00 00 00 
+  80215d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802163:	89 da                	mov    %ebx,%edx
+  802165:	48 bf c5 38 80 00 00 	movabs $0x8038c5,%rdi
+  80216c:	00 00 00 
+  80216f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802174:	48 b9 c2 06 80 00 00 	movabs $0x8006c2,%rcx
+  80217b:	00 00 00 
+  80217e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802180:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802187:	eb b5                	jmp    80213e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802189:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802190:	eb ac                	jmp    80213e <write+0x65>
+
+0000000000802192 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802192:	55                   	push   %rbp
+  802193:	48 89 e5             	mov    %rsp,%rbp
+  802196:	53                   	push   %rbx
+  802197:	48 83 ec 18          	sub    $0x18,%rsp
+  80219b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80219d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021a1:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  8021a8:	00 00 00 
+  8021ab:	ff d0                	call   *%rax
+  8021ad:	85 c0                	test   %eax,%eax
+  8021af:	78 0c                	js     8021bd <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8021b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021b5:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8021b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021c1:	c9                   	leave
+  8021c2:	c3                   	ret
+
+00000000008021c3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8021c3:	55                   	push   %rbp
+  8021c4:	48 89 e5             	mov    %rsp,%rbp
+  8021c7:	41 55                	push   %r13
+  8021c9:	41 54                	push   %r12
+  8021cb:	53                   	push   %rbx
+  8021cc:	48 83 ec 18          	sub    $0x18,%rsp
+  8021d0:	89 fb                	mov    %edi,%ebx
+  8021d2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021d5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021d9:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  8021e0:	00 00 00 
+  8021e3:	ff d0                	call   *%rax
+  8021e5:	85 c0                	test   %eax,%eax
+  8021e7:	78 38                	js     802221 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021e9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8021ed:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8021f1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021f5:	48 b8 12 1d 80 00 00 	movabs $0x801d12,%rax
+  8021fc:	00 00 00 
+  8021ff:	ff d0                	call   *%rax
+  802201:	85 c0                	test   %eax,%eax
+  802203:	78 1c                	js     802221 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802205:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80220a:	74 20                	je     80222c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80220c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802210:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802214:	48 85 c0             	test   %rax,%rax
+  802217:	74 47                	je     802260 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802219:	44 89 e6             	mov    %r12d,%esi
+  80221c:	4c 89 ef             	mov    %r13,%rdi
+  80221f:	ff d0                	call   *%rax
+}
+  802221:	48 83 c4 18          	add    $0x18,%rsp
+  802225:	5b                   	pop    %rbx
+  802226:	41 5c                	pop    %r12
+  802228:	41 5d                	pop    %r13
+  80222a:	5d                   	pop    %rbp
+  80222b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80222c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802233:	00 00 00 
+  802236:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80223c:	89 da                	mov    %ebx,%edx
+  80223e:	48 bf 88 38 80 00 00 	movabs $0x803888,%rdi
+  802245:	00 00 00 
+  802248:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224d:	48 b9 c2 06 80 00 00 	movabs $0x8006c2,%rcx
+  802254:	00 00 00 
+  802257:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802259:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80225e:	eb c1                	jmp    802221 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802260:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802265:	eb ba                	jmp    802221 <ftruncate+0x5e>
+
+0000000000802267 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802267:	55                   	push   %rbp
+  802268:	48 89 e5             	mov    %rsp,%rbp
+  80226b:	41 54                	push   %r12
+  80226d:	53                   	push   %rbx
+  80226e:	48 83 ec 10          	sub    $0x10,%rsp
+  802272:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802275:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802279:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  802280:	00 00 00 
+  802283:	ff d0                	call   *%rax
+  802285:	85 c0                	test   %eax,%eax
+  802287:	78 4e                	js     8022d7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802289:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80228d:	41 8b 3c 24          	mov    (%r12),%edi
+  802291:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802295:	48 b8 12 1d 80 00 00 	movabs $0x801d12,%rax
+  80229c:	00 00 00 
+  80229f:	ff d0                	call   *%rax
+  8022a1:	85 c0                	test   %eax,%eax
+  8022a3:	78 32                	js     8022d7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8022a5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8022a9:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8022ae:	74 30                	je     8022e0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8022b0:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8022b3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8022ba:	00 00 00 
+    stat->st_isdir = 0;
+  8022bd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8022c4:	00 00 00 
+    stat->st_dev = dev;
+  8022c7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8022ce:	48 89 de             	mov    %rbx,%rsi
+  8022d1:	4c 89 e7             	mov    %r12,%rdi
+  8022d4:	ff 50 28             	call   *0x28(%rax)
+}
+  8022d7:	48 83 c4 10          	add    $0x10,%rsp
+  8022db:	5b                   	pop    %rbx
+  8022dc:	41 5c                	pop    %r12
+  8022de:	5d                   	pop    %rbp
+  8022df:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8022e0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022e5:	eb f0                	jmp    8022d7 <fstat+0x70>
+
+00000000008022e7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8022e7:	55                   	push   %rbp
+  8022e8:	48 89 e5             	mov    %rsp,%rbp
+  8022eb:	41 54                	push   %r12
+  8022ed:	53                   	push   %rbx
+  8022ee:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8022f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f6:	48 b8 68 25 80 00 00 	movabs $0x802568,%rax
+  8022fd:	00 00 00 
+  802300:	ff d0                	call   *%rax
+  802302:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802304:	85 c0                	test   %eax,%eax
+  802306:	78 25                	js     80232d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802308:	4c 89 e6             	mov    %r12,%rsi
+  80230b:	89 c7                	mov    %eax,%edi
+  80230d:	48 b8 67 22 80 00 00 	movabs $0x802267,%rax
+  802314:	00 00 00 
+  802317:	ff d0                	call   *%rax
+  802319:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80231c:	89 df                	mov    %ebx,%edi
+  80231e:	48 b8 2c 1e 80 00 00 	movabs $0x801e2c,%rax
+  802325:	00 00 00 
+  802328:	ff d0                	call   *%rax
+
+    return res;
+  80232a:	44 89 e3             	mov    %r12d,%ebx
+}
+  80232d:	89 d8                	mov    %ebx,%eax
+  80232f:	5b                   	pop    %rbx
+  802330:	41 5c                	pop    %r12
+  802332:	5d                   	pop    %rbp
+  802333:	c3                   	ret
+
+0000000000802334 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802334:	55                   	push   %rbp
+  802335:	48 89 e5             	mov    %rsp,%rbp
+  802338:	41 54                	push   %r12
+  80233a:	53                   	push   %rbx
+  80233b:	48 83 ec 10          	sub    $0x10,%rsp
+  80233f:	41 89 fc             	mov    %edi,%r12d
+  802342:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802345:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80234c:	00 00 00 
+  80234f:	83 38 00             	cmpl   $0x0,(%rax)
+  802352:	74 5e                	je     8023b2 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802354:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80235a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80235f:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802366:	00 00 00 
+  802369:	44 89 e6             	mov    %r12d,%esi
+  80236c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802373:	00 00 00 
+  802376:	8b 38                	mov    (%rax),%edi
+  802378:	48 b8 53 30 80 00 00 	movabs $0x803053,%rax
+  80237f:	00 00 00 
+  802382:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802384:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80238b:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80238c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802391:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802395:	48 89 de             	mov    %rbx,%rsi
+  802398:	bf 00 00 00 00       	mov    $0x0,%edi
+  80239d:	48 b8 be 2f 80 00 00 	movabs $0x802fbe,%rax
+  8023a4:	00 00 00 
+  8023a7:	ff d0                	call   *%rax
+}
+  8023a9:	48 83 c4 10          	add    $0x10,%rsp
+  8023ad:	5b                   	pop    %rbx
+  8023ae:	41 5c                	pop    %r12
+  8023b0:	5d                   	pop    %rbp
+  8023b1:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023b2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023b7:	48 b8 f3 30 80 00 00 	movabs $0x8030f3,%rax
+  8023be:	00 00 00 
+  8023c1:	ff d0                	call   *%rax
+  8023c3:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8023ca:	00 00 
+  8023cc:	eb 86                	jmp    802354 <fsipc+0x20>
+
+00000000008023ce <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8023ce:	55                   	push   %rbp
+  8023cf:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8023d2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023d9:	00 00 00 
+  8023dc:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8023df:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8023e1:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8023e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8023e9:	bf 02 00 00 00       	mov    $0x2,%edi
+  8023ee:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  8023f5:	00 00 00 
+  8023f8:	ff d0                	call   *%rax
+}
+  8023fa:	5d                   	pop    %rbp
+  8023fb:	c3                   	ret
+
+00000000008023fc <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8023fc:	55                   	push   %rbp
+  8023fd:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802400:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802403:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80240a:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80240c:	be 00 00 00 00       	mov    $0x0,%esi
+  802411:	bf 06 00 00 00       	mov    $0x6,%edi
+  802416:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  80241d:	00 00 00 
+  802420:	ff d0                	call   *%rax
+}
+  802422:	5d                   	pop    %rbp
+  802423:	c3                   	ret
+
+0000000000802424 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802424:	55                   	push   %rbp
+  802425:	48 89 e5             	mov    %rsp,%rbp
+  802428:	41 54                	push   %r12
+  80242a:	53                   	push   %rbx
+  80242b:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80242e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802431:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802438:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80243a:	be 00 00 00 00       	mov    $0x0,%esi
+  80243f:	bf 05 00 00 00       	mov    $0x5,%edi
+  802444:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  80244b:	00 00 00 
+  80244e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802450:	85 c0                	test   %eax,%eax
+  802452:	78 3d                	js     802491 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802454:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80245b:	00 00 00 
+  80245e:	4c 89 e6             	mov    %r12,%rsi
+  802461:	48 89 df             	mov    %rbx,%rdi
+  802464:	48 b8 e7 0f 80 00 00 	movabs $0x800fe7,%rax
+  80246b:	00 00 00 
+  80246e:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802470:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802477:	00 
+  802478:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80247e:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802485:	00 
+  802486:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80248c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802491:	5b                   	pop    %rbx
+  802492:	41 5c                	pop    %r12
+  802494:	5d                   	pop    %rbp
+  802495:	c3                   	ret
+
+0000000000802496 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802496:	55                   	push   %rbp
+  802497:	48 89 e5             	mov    %rsp,%rbp
+  80249a:	41 54                	push   %r12
+  80249c:	53                   	push   %rbx
+  80249d:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8024a0:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8024a5:	48 39 c2             	cmp    %rax,%rdx
+  8024a8:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8024ac:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8024af:	48 89 c2             	mov    %rax,%rdx
+  8024b2:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8024b9:	00 00 00 
+  8024bc:	48 b8 48 12 80 00 00 	movabs $0x801248,%rax
+  8024c3:	00 00 00 
+  8024c6:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024c8:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8024cf:	00 00 00 
+  8024d2:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8024d7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8024d9:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8024dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e2:	bf 04 00 00 00       	mov    $0x4,%edi
+  8024e7:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  8024ee:	00 00 00 
+  8024f1:	ff d0                	call   *%rax
+  8024f3:	48 98                	cltq
+}
+  8024f5:	5b                   	pop    %rbx
+  8024f6:	41 5c                	pop    %r12
+  8024f8:	5d                   	pop    %rbp
+  8024f9:	c3                   	ret
+
+00000000008024fa <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8024fa:	55                   	push   %rbp
+  8024fb:	48 89 e5             	mov    %rsp,%rbp
+  8024fe:	41 54                	push   %r12
+  802500:	53                   	push   %rbx
+  802501:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802504:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80250b:	00 00 00 
+  80250e:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802511:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  802513:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802518:	48 39 ca             	cmp    %rcx,%rdx
+  80251b:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  80251f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  802523:	be 00 00 00 00       	mov    $0x0,%esi
+  802528:	bf 03 00 00 00       	mov    $0x3,%edi
+  80252d:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  802534:	00 00 00 
+  802537:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802539:	85 c0                	test   %eax,%eax
+  80253b:	78 27                	js     802564 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  80253d:	48 63 d8             	movslq %eax,%rbx
+  802540:	48 89 da             	mov    %rbx,%rdx
+  802543:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80254a:	00 00 00 
+  80254d:	4c 89 e7             	mov    %r12,%rdi
+  802550:	48 b8 48 12 80 00 00 	movabs $0x801248,%rax
+  802557:	00 00 00 
+  80255a:	ff d0                	call   *%rax
+    return bytes_read;
+  80255c:	48 89 d8             	mov    %rbx,%rax
+}
+  80255f:	5b                   	pop    %rbx
+  802560:	41 5c                	pop    %r12
+  802562:	5d                   	pop    %rbp
+  802563:	c3                   	ret
+        return bytes_read;
+  802564:	48 98                	cltq
+  802566:	eb f7                	jmp    80255f <devfile_read+0x65>
+
+0000000000802568 <open>:
+open(const char *path, int mode) {
+  802568:	55                   	push   %rbp
+  802569:	48 89 e5             	mov    %rsp,%rbp
+  80256c:	41 55                	push   %r13
+  80256e:	41 54                	push   %r12
+  802570:	53                   	push   %rbx
+  802571:	48 83 ec 18          	sub    $0x18,%rsp
+  802575:	49 89 fc             	mov    %rdi,%r12
+  802578:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80257b:	48 b8 a9 0f 80 00 00 	movabs $0x800fa9,%rax
+  802582:	00 00 00 
+  802585:	ff d0                	call   *%rax
+  802587:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80258d:	0f 87 8a 00 00 00    	ja     80261d <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802593:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802597:	48 b8 67 1c 80 00 00 	movabs $0x801c67,%rax
+  80259e:	00 00 00 
+  8025a1:	ff d0                	call   *%rax
+  8025a3:	89 c3                	mov    %eax,%ebx
+  8025a5:	85 c0                	test   %eax,%eax
+  8025a7:	78 50                	js     8025f9 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8025a9:	4c 89 e6             	mov    %r12,%rsi
+  8025ac:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8025b3:	00 00 00 
+  8025b6:	48 89 df             	mov    %rbx,%rdi
+  8025b9:	48 b8 e7 0f 80 00 00 	movabs $0x800fe7,%rax
+  8025c0:	00 00 00 
+  8025c3:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8025c5:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8025cc:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8025d0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8025d5:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  8025dc:	00 00 00 
+  8025df:	ff d0                	call   *%rax
+  8025e1:	89 c3                	mov    %eax,%ebx
+  8025e3:	85 c0                	test   %eax,%eax
+  8025e5:	78 1f                	js     802606 <open+0x9e>
+    return fd2num(fd);
+  8025e7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025eb:	48 b8 39 1c 80 00 00 	movabs $0x801c39,%rax
+  8025f2:	00 00 00 
+  8025f5:	ff d0                	call   *%rax
+  8025f7:	89 c3                	mov    %eax,%ebx
+}
+  8025f9:	89 d8                	mov    %ebx,%eax
+  8025fb:	48 83 c4 18          	add    $0x18,%rsp
+  8025ff:	5b                   	pop    %rbx
+  802600:	41 5c                	pop    %r12
+  802602:	41 5d                	pop    %r13
+  802604:	5d                   	pop    %rbp
+  802605:	c3                   	ret
+        fd_close(fd, 0);
+  802606:	be 00 00 00 00       	mov    $0x0,%esi
+  80260b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80260f:	48 b8 82 1d 80 00 00 	movabs $0x801d82,%rax
+  802616:	00 00 00 
+  802619:	ff d0                	call   *%rax
+        return res;
+  80261b:	eb dc                	jmp    8025f9 <open+0x91>
+        return -E_BAD_PATH;
+  80261d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802622:	eb d5                	jmp    8025f9 <open+0x91>
+
+0000000000802624 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802624:	55                   	push   %rbp
+  802625:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802628:	be 00 00 00 00       	mov    $0x0,%esi
+  80262d:	bf 08 00 00 00       	mov    $0x8,%edi
+  802632:	48 b8 34 23 80 00 00 	movabs $0x802334,%rax
+  802639:	00 00 00 
+  80263c:	ff d0                	call   *%rax
+}
+  80263e:	5d                   	pop    %rbp
+  80263f:	c3                   	ret
+
+0000000000802640 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802640:	55                   	push   %rbp
+  802641:	48 89 e5             	mov    %rsp,%rbp
+  802644:	41 54                	push   %r12
+  802646:	53                   	push   %rbx
+  802647:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80264a:	48 b8 4b 1c 80 00 00 	movabs $0x801c4b,%rax
+  802651:	00 00 00 
+  802654:	ff d0                	call   *%rax
+  802656:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802659:	48 be 20 39 80 00 00 	movabs $0x803920,%rsi
+  802660:	00 00 00 
+  802663:	48 89 df             	mov    %rbx,%rdi
+  802666:	48 b8 e7 0f 80 00 00 	movabs $0x800fe7,%rax
+  80266d:	00 00 00 
+  802670:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802672:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802677:	41 2b 04 24          	sub    (%r12),%eax
+  80267b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802681:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802688:	00 00 00 
+    stat->st_dev = &devpipe;
+  80268b:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802692:	00 00 00 
+  802695:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80269c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a1:	5b                   	pop    %rbx
+  8026a2:	41 5c                	pop    %r12
+  8026a4:	5d                   	pop    %rbp
+  8026a5:	c3                   	ret
+
+00000000008026a6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8026a6:	55                   	push   %rbp
+  8026a7:	48 89 e5             	mov    %rsp,%rbp
+  8026aa:	41 54                	push   %r12
+  8026ac:	53                   	push   %rbx
+  8026ad:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8026b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026b5:	48 89 fe             	mov    %rdi,%rsi
+  8026b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026bd:	49 bc 63 16 80 00 00 	movabs $0x801663,%r12
+  8026c4:	00 00 00 
+  8026c7:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8026ca:	48 89 df             	mov    %rbx,%rdi
+  8026cd:	48 b8 4b 1c 80 00 00 	movabs $0x801c4b,%rax
+  8026d4:	00 00 00 
+  8026d7:	ff d0                	call   *%rax
+  8026d9:	48 89 c6             	mov    %rax,%rsi
+  8026dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026e6:	41 ff d4             	call   *%r12
+}
+  8026e9:	5b                   	pop    %rbx
+  8026ea:	41 5c                	pop    %r12
+  8026ec:	5d                   	pop    %rbp
+  8026ed:	c3                   	ret
+
+00000000008026ee <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8026ee:	55                   	push   %rbp
+  8026ef:	48 89 e5             	mov    %rsp,%rbp
+  8026f2:	41 57                	push   %r15
+  8026f4:	41 56                	push   %r14
+  8026f6:	41 55                	push   %r13
+  8026f8:	41 54                	push   %r12
+  8026fa:	53                   	push   %rbx
+  8026fb:	48 83 ec 18          	sub    $0x18,%rsp
+  8026ff:	49 89 fc             	mov    %rdi,%r12
+  802702:	49 89 f5             	mov    %rsi,%r13
+  802705:	49 89 d7             	mov    %rdx,%r15
+  802708:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80270c:	48 b8 4b 1c 80 00 00 	movabs $0x801c4b,%rax
+  802713:	00 00 00 
+  802716:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802718:	4d 85 ff             	test   %r15,%r15
+  80271b:	0f 84 af 00 00 00    	je     8027d0 <devpipe_write+0xe2>
+  802721:	48 89 c3             	mov    %rax,%rbx
+  802724:	4c 89 f8             	mov    %r15,%rax
+  802727:	4d 89 ef             	mov    %r13,%r15
+  80272a:	4c 01 e8             	add    %r13,%rax
+  80272d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802731:	49 bd 6b 15 80 00 00 	movabs $0x80156b,%r13
+  802738:	00 00 00 
+            sys_yield();
+  80273b:	49 be 08 15 80 00 00 	movabs $0x801508,%r14
+  802742:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802745:	8b 73 04             	mov    0x4(%rbx),%esi
+  802748:	48 63 ce             	movslq %esi,%rcx
+  80274b:	48 63 03             	movslq (%rbx),%rax
+  80274e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802754:	48 39 c1             	cmp    %rax,%rcx
+  802757:	72 2e                	jb     802787 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802759:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80275e:	48 89 da             	mov    %rbx,%rdx
+  802761:	be 00 10 00 00       	mov    $0x1000,%esi
+  802766:	4c 89 e7             	mov    %r12,%rdi
+  802769:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80276c:	85 c0                	test   %eax,%eax
+  80276e:	74 66                	je     8027d6 <devpipe_write+0xe8>
+            sys_yield();
+  802770:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802773:	8b 73 04             	mov    0x4(%rbx),%esi
+  802776:	48 63 ce             	movslq %esi,%rcx
+  802779:	48 63 03             	movslq (%rbx),%rax
+  80277c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802782:	48 39 c1             	cmp    %rax,%rcx
+  802785:	73 d2                	jae    802759 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802787:	41 0f b6 3f          	movzbl (%r15),%edi
+  80278b:	48 89 ca             	mov    %rcx,%rdx
+  80278e:	48 c1 ea 03          	shr    $0x3,%rdx
+  802792:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802799:	08 10 20 
+  80279c:	48 f7 e2             	mul    %rdx
+  80279f:	48 c1 ea 06          	shr    $0x6,%rdx
+  8027a3:	48 89 d0             	mov    %rdx,%rax
+  8027a6:	48 c1 e0 09          	shl    $0x9,%rax
+  8027aa:	48 29 d0             	sub    %rdx,%rax
+  8027ad:	48 c1 e0 03          	shl    $0x3,%rax
+  8027b1:	48 29 c1             	sub    %rax,%rcx
+  8027b4:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8027b9:	83 c6 01             	add    $0x1,%esi
+  8027bc:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8027bf:	49 83 c7 01          	add    $0x1,%r15
+  8027c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027c7:	49 39 c7             	cmp    %rax,%r15
+  8027ca:	0f 85 75 ff ff ff    	jne    802745 <devpipe_write+0x57>
+    return n;
+  8027d0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8027d4:	eb 05                	jmp    8027db <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8027d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027db:	48 83 c4 18          	add    $0x18,%rsp
+  8027df:	5b                   	pop    %rbx
+  8027e0:	41 5c                	pop    %r12
+  8027e2:	41 5d                	pop    %r13
+  8027e4:	41 5e                	pop    %r14
+  8027e6:	41 5f                	pop    %r15
+  8027e8:	5d                   	pop    %rbp
+  8027e9:	c3                   	ret
+
+00000000008027ea <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8027ea:	55                   	push   %rbp
+  8027eb:	48 89 e5             	mov    %rsp,%rbp
+  8027ee:	41 57                	push   %r15
+  8027f0:	41 56                	push   %r14
+  8027f2:	41 55                	push   %r13
+  8027f4:	41 54                	push   %r12
+  8027f6:	53                   	push   %rbx
+  8027f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8027fb:	49 89 fc             	mov    %rdi,%r12
+  8027fe:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802802:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802806:	48 b8 4b 1c 80 00 00 	movabs $0x801c4b,%rax
+  80280d:	00 00 00 
+  802810:	ff d0                	call   *%rax
+  802812:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802815:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80281b:	49 bd 6b 15 80 00 00 	movabs $0x80156b,%r13
+  802822:	00 00 00 
+            sys_yield();
+  802825:	49 be 08 15 80 00 00 	movabs $0x801508,%r14
+  80282c:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80282f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802834:	74 7d                	je     8028b3 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802836:	8b 03                	mov    (%rbx),%eax
+  802838:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80283b:	75 26                	jne    802863 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80283d:	4d 85 ff             	test   %r15,%r15
+  802840:	75 77                	jne    8028b9 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802842:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802847:	48 89 da             	mov    %rbx,%rdx
+  80284a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80284f:	4c 89 e7             	mov    %r12,%rdi
+  802852:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802855:	85 c0                	test   %eax,%eax
+  802857:	74 72                	je     8028cb <devpipe_read+0xe1>
+            sys_yield();
+  802859:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80285c:	8b 03                	mov    (%rbx),%eax
+  80285e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802861:	74 df                	je     802842 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802863:	48 63 c8             	movslq %eax,%rcx
+  802866:	48 89 ca             	mov    %rcx,%rdx
+  802869:	48 c1 ea 03          	shr    $0x3,%rdx
+  80286d:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802874:	08 10 20 
+  802877:	48 89 d0             	mov    %rdx,%rax
+  80287a:	48 f7 e6             	mul    %rsi
+  80287d:	48 c1 ea 06          	shr    $0x6,%rdx
+  802881:	48 89 d0             	mov    %rdx,%rax
+  802884:	48 c1 e0 09          	shl    $0x9,%rax
+  802888:	48 29 d0             	sub    %rdx,%rax
+  80288b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802892:	00 
+  802893:	48 89 c8             	mov    %rcx,%rax
+  802896:	48 29 d0             	sub    %rdx,%rax
+  802899:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80289e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8028a2:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8028a6:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8028a9:	49 83 c7 01          	add    $0x1,%r15
+  8028ad:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8028b1:	75 83                	jne    802836 <devpipe_read+0x4c>
+    return n;
+  8028b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028b7:	eb 03                	jmp    8028bc <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8028b9:	4c 89 f8             	mov    %r15,%rax
+}
+  8028bc:	48 83 c4 18          	add    $0x18,%rsp
+  8028c0:	5b                   	pop    %rbx
+  8028c1:	41 5c                	pop    %r12
+  8028c3:	41 5d                	pop    %r13
+  8028c5:	41 5e                	pop    %r14
+  8028c7:	41 5f                	pop    %r15
+  8028c9:	5d                   	pop    %rbp
+  8028ca:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8028cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d0:	eb ea                	jmp    8028bc <devpipe_read+0xd2>
+
+00000000008028d2 <pipe>:
+pipe(int pfd[2]) {
+  8028d2:	55                   	push   %rbp
+  8028d3:	48 89 e5             	mov    %rsp,%rbp
+  8028d6:	41 55                	push   %r13
+  8028d8:	41 54                	push   %r12
+  8028da:	53                   	push   %rbx
+  8028db:	48 83 ec 18          	sub    $0x18,%rsp
+  8028df:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8028e2:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8028e6:	48 b8 67 1c 80 00 00 	movabs $0x801c67,%rax
+  8028ed:	00 00 00 
+  8028f0:	ff d0                	call   *%rax
+  8028f2:	89 c3                	mov    %eax,%ebx
+  8028f4:	85 c0                	test   %eax,%eax
+  8028f6:	0f 88 a0 01 00 00    	js     802a9c <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8028fc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802901:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802906:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80290a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80290f:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  802916:	00 00 00 
+  802919:	ff d0                	call   *%rax
+  80291b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80291d:	85 c0                	test   %eax,%eax
+  80291f:	0f 88 77 01 00 00    	js     802a9c <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802925:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802929:	48 b8 67 1c 80 00 00 	movabs $0x801c67,%rax
+  802930:	00 00 00 
+  802933:	ff d0                	call   *%rax
+  802935:	89 c3                	mov    %eax,%ebx
+  802937:	85 c0                	test   %eax,%eax
+  802939:	0f 88 43 01 00 00    	js     802a82 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80293f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802944:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802949:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80294d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802952:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  802959:	00 00 00 
+  80295c:	ff d0                	call   *%rax
+  80295e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802960:	85 c0                	test   %eax,%eax
+  802962:	0f 88 1a 01 00 00    	js     802a82 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802968:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80296c:	48 b8 4b 1c 80 00 00 	movabs $0x801c4b,%rax
+  802973:	00 00 00 
+  802976:	ff d0                	call   *%rax
+  802978:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80297b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802980:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802985:	48 89 c6             	mov    %rax,%rsi
+  802988:	bf 00 00 00 00       	mov    $0x0,%edi
+  80298d:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  802994:	00 00 00 
+  802997:	ff d0                	call   *%rax
+  802999:	89 c3                	mov    %eax,%ebx
+  80299b:	85 c0                	test   %eax,%eax
+  80299d:	0f 88 c5 00 00 00    	js     802a68 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8029a3:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8029a7:	48 b8 4b 1c 80 00 00 	movabs $0x801c4b,%rax
+  8029ae:	00 00 00 
+  8029b1:	ff d0                	call   *%rax
+  8029b3:	48 89 c1             	mov    %rax,%rcx
+  8029b6:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8029bc:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8029c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029c7:	4c 89 ee             	mov    %r13,%rsi
+  8029ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029cf:	48 b8 fe 15 80 00 00 	movabs $0x8015fe,%rax
+  8029d6:	00 00 00 
+  8029d9:	ff d0                	call   *%rax
+  8029db:	89 c3                	mov    %eax,%ebx
+  8029dd:	85 c0                	test   %eax,%eax
+  8029df:	78 6e                	js     802a4f <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8029e1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029e6:	4c 89 ef             	mov    %r13,%rdi
+  8029e9:	48 b8 39 15 80 00 00 	movabs $0x801539,%rax
+  8029f0:	00 00 00 
+  8029f3:	ff d0                	call   *%rax
+  8029f5:	83 f8 02             	cmp    $0x2,%eax
+  8029f8:	0f 85 ab 00 00 00    	jne    802aa9 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8029fe:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802a05:	00 00 
+  802a07:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802a0b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802a0d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802a11:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802a18:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802a1c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802a1e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a22:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802a29:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802a2d:	48 bb 39 1c 80 00 00 	movabs $0x801c39,%rbx
+  802a34:	00 00 00 
+  802a37:	ff d3                	call   *%rbx
+  802a39:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802a3d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802a41:	ff d3                	call   *%rbx
+  802a43:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802a48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a4d:	eb 4d                	jmp    802a9c <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802a4f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a54:	4c 89 ee             	mov    %r13,%rsi
+  802a57:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a5c:	48 b8 63 16 80 00 00 	movabs $0x801663,%rax
+  802a63:	00 00 00 
+  802a66:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802a68:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a6d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802a71:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a76:	48 b8 63 16 80 00 00 	movabs $0x801663,%rax
+  802a7d:	00 00 00 
+  802a80:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802a82:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a87:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802a8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a90:	48 b8 63 16 80 00 00 	movabs $0x801663,%rax
+  802a97:	00 00 00 
+  802a9a:	ff d0                	call   *%rax
+}
+  802a9c:	89 d8                	mov    %ebx,%eax
+  802a9e:	48 83 c4 18          	add    $0x18,%rsp
+  802aa2:	5b                   	pop    %rbx
+  802aa3:	41 5c                	pop    %r12
+  802aa5:	41 5d                	pop    %r13
+  802aa7:	5d                   	pop    %rbp
+  802aa8:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802aa9:	48 b9 50 39 80 00 00 	movabs $0x803950,%rcx
+  802ab0:	00 00 00 
+  802ab3:	48 ba 27 39 80 00 00 	movabs $0x803927,%rdx
+  802aba:	00 00 00 
+  802abd:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802ac2:	48 bf 3c 39 80 00 00 	movabs $0x80393c,%rdi
+  802ac9:	00 00 00 
+  802acc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad1:	49 b8 72 05 80 00 00 	movabs $0x800572,%r8
+  802ad8:	00 00 00 
+  802adb:	41 ff d0             	call   *%r8
+
+0000000000802ade <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802ade:	55                   	push   %rbp
+  802adf:	48 89 e5             	mov    %rsp,%rbp
+  802ae2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802ae6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802aea:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  802af1:	00 00 00 
+  802af4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802af6:	85 c0                	test   %eax,%eax
+  802af8:	78 35                	js     802b2f <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802afa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802afe:	48 b8 4b 1c 80 00 00 	movabs $0x801c4b,%rax
+  802b05:	00 00 00 
+  802b08:	ff d0                	call   *%rax
+  802b0a:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802b0d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b12:	be 00 10 00 00       	mov    $0x1000,%esi
+  802b17:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802b1b:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  802b22:	00 00 00 
+  802b25:	ff d0                	call   *%rax
+  802b27:	85 c0                	test   %eax,%eax
+  802b29:	0f 94 c0             	sete   %al
+  802b2c:	0f b6 c0             	movzbl %al,%eax
+}
+  802b2f:	c9                   	leave
+  802b30:	c3                   	ret
+
+0000000000802b31 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  802b31:	55                   	push   %rbp
+  802b32:	48 89 e5             	mov    %rsp,%rbp
+  802b35:	41 55                	push   %r13
+  802b37:	41 54                	push   %r12
+  802b39:	53                   	push   %rbx
+  802b3a:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  802b3e:	85 ff                	test   %edi,%edi
+  802b40:	74 6c                	je     802bae <wait+0x7d>
+  802b42:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  802b45:	40 0f b6 c7          	movzbl %dil,%eax
+
+    while (env->env_id == envid &&
+  802b49:	40 0f b6 cf          	movzbl %dil,%ecx
+  802b4d:	48 69 c9 b0 06 00 00 	imul   $0x6b0,%rcx,%rcx
+  802b54:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802b5b:	00 00 00 
+  802b5e:	48 01 ca             	add    %rcx,%rdx
+  802b61:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  802b67:	39 d7                	cmp    %edx,%edi
+  802b69:	75 38                	jne    802ba3 <wait+0x72>
+           env->env_status != ENV_FREE) {
+  802b6b:	48 98                	cltq
+  802b6d:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802b74:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  802b7b:	00 00 00 
+  802b7e:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  802b81:	49 bd 08 15 80 00 00 	movabs $0x801508,%r13
+  802b88:	00 00 00 
+           env->env_status != ENV_FREE) {
+  802b8b:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  802b91:	85 c0                	test   %eax,%eax
+  802b93:	74 0e                	je     802ba3 <wait+0x72>
+        sys_yield();
+  802b95:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  802b98:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  802b9e:	44 39 e0             	cmp    %r12d,%eax
+  802ba1:	74 e8                	je     802b8b <wait+0x5a>
+    }
+}
+  802ba3:	48 83 c4 08          	add    $0x8,%rsp
+  802ba7:	5b                   	pop    %rbx
+  802ba8:	41 5c                	pop    %r12
+  802baa:	41 5d                	pop    %r13
+  802bac:	5d                   	pop    %rbp
+  802bad:	c3                   	ret
+    assert(envid != 0);
+  802bae:	48 b9 74 39 80 00 00 	movabs $0x803974,%rcx
+  802bb5:	00 00 00 
+  802bb8:	48 ba 27 39 80 00 00 	movabs $0x803927,%rdx
+  802bbf:	00 00 00 
+  802bc2:	be 06 00 00 00       	mov    $0x6,%esi
+  802bc7:	48 bf 7f 39 80 00 00 	movabs $0x80397f,%rdi
+  802bce:	00 00 00 
+  802bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd6:	49 b8 72 05 80 00 00 	movabs $0x800572,%r8
+  802bdd:	00 00 00 
+  802be0:	41 ff d0             	call   *%r8
+
+0000000000802be3 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802be3:	48 89 f8             	mov    %rdi,%rax
+  802be6:	48 c1 e8 27          	shr    $0x27,%rax
+  802bea:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802bf1:	01 00 00 
+  802bf4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802bf8:	f6 c2 01             	test   $0x1,%dl
+  802bfb:	74 6d                	je     802c6a <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802bfd:	48 89 f8             	mov    %rdi,%rax
+  802c00:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c04:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802c0b:	01 00 00 
+  802c0e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c12:	f6 c2 01             	test   $0x1,%dl
+  802c15:	74 62                	je     802c79 <get_uvpt_entry+0x96>
+  802c17:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802c1e:	01 00 00 
+  802c21:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c25:	f6 c2 80             	test   $0x80,%dl
+  802c28:	75 4f                	jne    802c79 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802c2a:	48 89 f8             	mov    %rdi,%rax
+  802c2d:	48 c1 e8 15          	shr    $0x15,%rax
+  802c31:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802c38:	01 00 00 
+  802c3b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c3f:	f6 c2 01             	test   $0x1,%dl
+  802c42:	74 44                	je     802c88 <get_uvpt_entry+0xa5>
+  802c44:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802c4b:	01 00 00 
+  802c4e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c52:	f6 c2 80             	test   $0x80,%dl
+  802c55:	75 31                	jne    802c88 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802c57:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802c5b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c62:	01 00 00 
+  802c65:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802c69:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802c6a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802c71:	01 00 00 
+  802c74:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c78:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802c79:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802c80:	01 00 00 
+  802c83:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c87:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802c88:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802c8f:	01 00 00 
+  802c92:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c96:	c3                   	ret
+
+0000000000802c97 <get_prot>:
+
+int
+get_prot(void *va) {
+  802c97:	55                   	push   %rbp
+  802c98:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802c9b:	48 b8 e3 2b 80 00 00 	movabs $0x802be3,%rax
+  802ca2:	00 00 00 
+  802ca5:	ff d0                	call   *%rax
+  802ca7:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802caa:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802caf:	89 c1                	mov    %eax,%ecx
+  802cb1:	83 c9 04             	or     $0x4,%ecx
+  802cb4:	f6 c2 01             	test   $0x1,%dl
+  802cb7:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802cba:	89 c1                	mov    %eax,%ecx
+  802cbc:	83 c9 02             	or     $0x2,%ecx
+  802cbf:	f6 c2 02             	test   $0x2,%dl
+  802cc2:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802cc5:	89 c1                	mov    %eax,%ecx
+  802cc7:	83 c9 01             	or     $0x1,%ecx
+  802cca:	48 85 d2             	test   %rdx,%rdx
+  802ccd:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802cd0:	89 c1                	mov    %eax,%ecx
+  802cd2:	83 c9 40             	or     $0x40,%ecx
+  802cd5:	f6 c6 04             	test   $0x4,%dh
+  802cd8:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802cdb:	5d                   	pop    %rbp
+  802cdc:	c3                   	ret
+
+0000000000802cdd <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802cdd:	55                   	push   %rbp
+  802cde:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802ce1:	48 b8 e3 2b 80 00 00 	movabs $0x802be3,%rax
+  802ce8:	00 00 00 
+  802ceb:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802ced:	48 c1 e8 06          	shr    $0x6,%rax
+  802cf1:	83 e0 01             	and    $0x1,%eax
+}
+  802cf4:	5d                   	pop    %rbp
+  802cf5:	c3                   	ret
+
+0000000000802cf6 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802cf6:	55                   	push   %rbp
+  802cf7:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802cfa:	48 b8 e3 2b 80 00 00 	movabs $0x802be3,%rax
+  802d01:	00 00 00 
+  802d04:	ff d0                	call   *%rax
+  802d06:	83 e0 01             	and    $0x1,%eax
+}
+  802d09:	5d                   	pop    %rbp
+  802d0a:	c3                   	ret
+
+0000000000802d0b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802d0b:	55                   	push   %rbp
+  802d0c:	48 89 e5             	mov    %rsp,%rbp
+  802d0f:	41 57                	push   %r15
+  802d11:	41 56                	push   %r14
+  802d13:	41 55                	push   %r13
+  802d15:	41 54                	push   %r12
+  802d17:	53                   	push   %rbx
+  802d18:	48 83 ec 18          	sub    $0x18,%rsp
+  802d1c:	49 89 ff             	mov    %rdi,%r15
+  802d1f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802d23:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802d28:	49 bc f6 2c 80 00 00 	movabs $0x802cf6,%r12
+  802d2f:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802d32:	49 be 97 2c 80 00 00 	movabs $0x802c97,%r14
+  802d39:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802d3c:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802d43:	00 00 00 
+  802d46:	eb 0c                	jmp    802d54 <foreach_shared_region+0x49>
+  802d48:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802d4f:	4c 39 eb             	cmp    %r13,%rbx
+  802d52:	74 38                	je     802d8c <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802d54:	48 89 df             	mov    %rbx,%rdi
+  802d57:	41 ff d4             	call   *%r12
+  802d5a:	84 c0                	test   %al,%al
+  802d5c:	74 ea                	je     802d48 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802d5e:	48 89 df             	mov    %rbx,%rdi
+  802d61:	41 ff d6             	call   *%r14
+  802d64:	a8 40                	test   $0x40,%al
+  802d66:	74 e0                	je     802d48 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802d68:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802d6f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802d73:	48 89 df             	mov    %rbx,%rdi
+  802d76:	41 ff d7             	call   *%r15
+        if (err)
+  802d79:	85 c0                	test   %eax,%eax
+  802d7b:	74 cb                	je     802d48 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802d7d:	48 83 c4 18          	add    $0x18,%rsp
+  802d81:	5b                   	pop    %rbx
+  802d82:	41 5c                	pop    %r12
+  802d84:	41 5d                	pop    %r13
+  802d86:	41 5e                	pop    %r14
+  802d88:	41 5f                	pop    %r15
+  802d8a:	5d                   	pop    %rbp
+  802d8b:	c3                   	ret
+    return 0;
+  802d8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d91:	eb ea                	jmp    802d7d <foreach_shared_region+0x72>
+
+0000000000802d93 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802d93:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d98:	c3                   	ret
+
+0000000000802d99 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802d99:	55                   	push   %rbp
+  802d9a:	48 89 e5             	mov    %rsp,%rbp
+  802d9d:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802da0:	48 be 8a 39 80 00 00 	movabs $0x80398a,%rsi
+  802da7:	00 00 00 
+  802daa:	48 b8 e7 0f 80 00 00 	movabs $0x800fe7,%rax
+  802db1:	00 00 00 
+  802db4:	ff d0                	call   *%rax
+    return 0;
+}
+  802db6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dbb:	5d                   	pop    %rbp
+  802dbc:	c3                   	ret
+
+0000000000802dbd <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802dbd:	55                   	push   %rbp
+  802dbe:	48 89 e5             	mov    %rsp,%rbp
+  802dc1:	41 57                	push   %r15
+  802dc3:	41 56                	push   %r14
+  802dc5:	41 55                	push   %r13
+  802dc7:	41 54                	push   %r12
+  802dc9:	53                   	push   %rbx
+  802dca:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802dd1:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802dd8:	48 85 d2             	test   %rdx,%rdx
+  802ddb:	74 7a                	je     802e57 <devcons_write+0x9a>
+  802ddd:	49 89 d6             	mov    %rdx,%r14
+  802de0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802de6:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802deb:	49 bf e1 11 80 00 00 	movabs $0x8011e1,%r15
+  802df2:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802df5:	4c 89 f3             	mov    %r14,%rbx
+  802df8:	48 29 f3             	sub    %rsi,%rbx
+  802dfb:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802e00:	48 39 c3             	cmp    %rax,%rbx
+  802e03:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802e07:	4c 63 eb             	movslq %ebx,%r13
+  802e0a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802e11:	48 01 c6             	add    %rax,%rsi
+  802e14:	4c 89 ea             	mov    %r13,%rdx
+  802e17:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802e1e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802e21:	4c 89 ee             	mov    %r13,%rsi
+  802e24:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802e2b:	48 b8 0e 14 80 00 00 	movabs $0x80140e,%rax
+  802e32:	00 00 00 
+  802e35:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802e37:	41 01 dc             	add    %ebx,%r12d
+  802e3a:	49 63 f4             	movslq %r12d,%rsi
+  802e3d:	4c 39 f6             	cmp    %r14,%rsi
+  802e40:	72 b3                	jb     802df5 <devcons_write+0x38>
+    return res;
+  802e42:	49 63 c4             	movslq %r12d,%rax
+}
+  802e45:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802e4c:	5b                   	pop    %rbx
+  802e4d:	41 5c                	pop    %r12
+  802e4f:	41 5d                	pop    %r13
+  802e51:	41 5e                	pop    %r14
+  802e53:	41 5f                	pop    %r15
+  802e55:	5d                   	pop    %rbp
+  802e56:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802e57:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802e5d:	eb e3                	jmp    802e42 <devcons_write+0x85>
+
+0000000000802e5f <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e5f:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802e62:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e67:	48 85 c0             	test   %rax,%rax
+  802e6a:	74 55                	je     802ec1 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e6c:	55                   	push   %rbp
+  802e6d:	48 89 e5             	mov    %rsp,%rbp
+  802e70:	41 55                	push   %r13
+  802e72:	41 54                	push   %r12
+  802e74:	53                   	push   %rbx
+  802e75:	48 83 ec 08          	sub    $0x8,%rsp
+  802e79:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802e7c:	48 bb 3b 14 80 00 00 	movabs $0x80143b,%rbx
+  802e83:	00 00 00 
+  802e86:	49 bc 08 15 80 00 00 	movabs $0x801508,%r12
+  802e8d:	00 00 00 
+  802e90:	eb 03                	jmp    802e95 <devcons_read+0x36>
+  802e92:	41 ff d4             	call   *%r12
+  802e95:	ff d3                	call   *%rbx
+  802e97:	85 c0                	test   %eax,%eax
+  802e99:	74 f7                	je     802e92 <devcons_read+0x33>
+    if (c < 0) return c;
+  802e9b:	48 63 d0             	movslq %eax,%rdx
+  802e9e:	78 13                	js     802eb3 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802ea0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ea5:	83 f8 04             	cmp    $0x4,%eax
+  802ea8:	74 09                	je     802eb3 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802eaa:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802eae:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802eb3:	48 89 d0             	mov    %rdx,%rax
+  802eb6:	48 83 c4 08          	add    $0x8,%rsp
+  802eba:	5b                   	pop    %rbx
+  802ebb:	41 5c                	pop    %r12
+  802ebd:	41 5d                	pop    %r13
+  802ebf:	5d                   	pop    %rbp
+  802ec0:	c3                   	ret
+  802ec1:	48 89 d0             	mov    %rdx,%rax
+  802ec4:	c3                   	ret
+
+0000000000802ec5 <cputchar>:
+cputchar(int ch) {
+  802ec5:	55                   	push   %rbp
+  802ec6:	48 89 e5             	mov    %rsp,%rbp
+  802ec9:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802ecd:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802ed1:	be 01 00 00 00       	mov    $0x1,%esi
+  802ed6:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802eda:	48 b8 0e 14 80 00 00 	movabs $0x80140e,%rax
+  802ee1:	00 00 00 
+  802ee4:	ff d0                	call   *%rax
+}
+  802ee6:	c9                   	leave
+  802ee7:	c3                   	ret
+
+0000000000802ee8 <getchar>:
+getchar(void) {
+  802ee8:	55                   	push   %rbp
+  802ee9:	48 89 e5             	mov    %rsp,%rbp
+  802eec:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802ef0:	ba 01 00 00 00       	mov    $0x1,%edx
+  802ef5:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802ef9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802efe:	48 b8 aa 1f 80 00 00 	movabs $0x801faa,%rax
+  802f05:	00 00 00 
+  802f08:	ff d0                	call   *%rax
+  802f0a:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802f0c:	85 c0                	test   %eax,%eax
+  802f0e:	78 06                	js     802f16 <getchar+0x2e>
+  802f10:	74 08                	je     802f1a <getchar+0x32>
+  802f12:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802f16:	89 d0                	mov    %edx,%eax
+  802f18:	c9                   	leave
+  802f19:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802f1a:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802f1f:	eb f5                	jmp    802f16 <getchar+0x2e>
+
+0000000000802f21 <iscons>:
+iscons(int fdnum) {
+  802f21:	55                   	push   %rbp
+  802f22:	48 89 e5             	mov    %rsp,%rbp
+  802f25:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802f29:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f2d:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  802f34:	00 00 00 
+  802f37:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f39:	85 c0                	test   %eax,%eax
+  802f3b:	78 18                	js     802f55 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802f3d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f41:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802f48:	00 00 00 
+  802f4b:	8b 00                	mov    (%rax),%eax
+  802f4d:	39 02                	cmp    %eax,(%rdx)
+  802f4f:	0f 94 c0             	sete   %al
+  802f52:	0f b6 c0             	movzbl %al,%eax
+}
+  802f55:	c9                   	leave
+  802f56:	c3                   	ret
+
+0000000000802f57 <opencons>:
+opencons(void) {
+  802f57:	55                   	push   %rbp
+  802f58:	48 89 e5             	mov    %rsp,%rbp
+  802f5b:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f5f:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802f63:	48 b8 67 1c 80 00 00 	movabs $0x801c67,%rax
+  802f6a:	00 00 00 
+  802f6d:	ff d0                	call   *%rax
+  802f6f:	85 c0                	test   %eax,%eax
+  802f71:	78 49                	js     802fbc <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802f73:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f78:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f7d:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802f81:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f86:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  802f8d:	00 00 00 
+  802f90:	ff d0                	call   *%rax
+  802f92:	85 c0                	test   %eax,%eax
+  802f94:	78 26                	js     802fbc <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802f96:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f9a:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802fa1:	00 00 
+  802fa3:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802fa5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fa9:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802fb0:	48 b8 39 1c 80 00 00 	movabs $0x801c39,%rax
+  802fb7:	00 00 00 
+  802fba:	ff d0                	call   *%rax
+}
+  802fbc:	c9                   	leave
+  802fbd:	c3                   	ret
+
+0000000000802fbe <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802fbe:	55                   	push   %rbp
+  802fbf:	48 89 e5             	mov    %rsp,%rbp
+  802fc2:	41 54                	push   %r12
+  802fc4:	53                   	push   %rbx
+  802fc5:	48 89 fb             	mov    %rdi,%rbx
+  802fc8:	48 89 f7             	mov    %rsi,%rdi
+  802fcb:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802fce:	48 85 f6             	test   %rsi,%rsi
+  802fd1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802fd8:	00 00 00 
+  802fdb:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802fdf:	be 00 10 00 00       	mov    $0x1000,%esi
+  802fe4:	48 b8 01 19 80 00 00 	movabs $0x801901,%rax
+  802feb:	00 00 00 
+  802fee:	ff d0                	call   *%rax
+    if (res < 0) {
+  802ff0:	85 c0                	test   %eax,%eax
+  802ff2:	78 45                	js     803039 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802ff4:	48 85 db             	test   %rbx,%rbx
+  802ff7:	74 12                	je     80300b <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802ff9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803000:	00 00 00 
+  803003:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  803009:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  80300b:	4d 85 e4             	test   %r12,%r12
+  80300e:	74 14                	je     803024 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  803010:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803017:	00 00 00 
+  80301a:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  803020:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  803024:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80302b:	00 00 00 
+  80302e:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  803034:	5b                   	pop    %rbx
+  803035:	41 5c                	pop    %r12
+  803037:	5d                   	pop    %rbp
+  803038:	c3                   	ret
+        if (from_env_store)
+  803039:	48 85 db             	test   %rbx,%rbx
+  80303c:	74 06                	je     803044 <ipc_recv+0x86>
+            *from_env_store = 0;
+  80303e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  803044:	4d 85 e4             	test   %r12,%r12
+  803047:	74 eb                	je     803034 <ipc_recv+0x76>
+            *perm_store = 0;
+  803049:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803050:	00 
+  803051:	eb e1                	jmp    803034 <ipc_recv+0x76>
+
+0000000000803053 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803053:	55                   	push   %rbp
+  803054:	48 89 e5             	mov    %rsp,%rbp
+  803057:	41 57                	push   %r15
+  803059:	41 56                	push   %r14
+  80305b:	41 55                	push   %r13
+  80305d:	41 54                	push   %r12
+  80305f:	53                   	push   %rbx
+  803060:	48 83 ec 18          	sub    $0x18,%rsp
+  803064:	41 89 fd             	mov    %edi,%r13d
+  803067:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80306a:	48 89 d3             	mov    %rdx,%rbx
+  80306d:	49 89 cc             	mov    %rcx,%r12
+  803070:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  803074:	48 85 d2             	test   %rdx,%rdx
+  803077:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80307e:	00 00 00 
+  803081:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803085:	49 be d5 18 80 00 00 	movabs $0x8018d5,%r14
+  80308c:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  80308f:	49 bf 08 15 80 00 00 	movabs $0x801508,%r15
+  803096:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803099:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80309c:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8030a0:	4c 89 e1             	mov    %r12,%rcx
+  8030a3:	48 89 da             	mov    %rbx,%rdx
+  8030a6:	44 89 ef             	mov    %r13d,%edi
+  8030a9:	41 ff d6             	call   *%r14
+        if (res == 0)
+  8030ac:	85 c0                	test   %eax,%eax
+  8030ae:	74 34                	je     8030e4 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  8030b0:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8030b3:	75 05                	jne    8030ba <ipc_send+0x67>
+        sys_yield();
+  8030b5:	41 ff d7             	call   *%r15
+    while (true) {
+  8030b8:	eb df                	jmp    803099 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  8030ba:	48 ba 96 39 80 00 00 	movabs $0x803996,%rdx
+  8030c1:	00 00 00 
+  8030c4:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8030c9:	48 bf af 39 80 00 00 	movabs $0x8039af,%rdi
+  8030d0:	00 00 00 
+  8030d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d8:	48 b9 72 05 80 00 00 	movabs $0x800572,%rcx
+  8030df:	00 00 00 
+  8030e2:	ff d1                	call   *%rcx
+    }
+}
+  8030e4:	48 83 c4 18          	add    $0x18,%rsp
+  8030e8:	5b                   	pop    %rbx
+  8030e9:	41 5c                	pop    %r12
+  8030eb:	41 5d                	pop    %r13
+  8030ed:	41 5e                	pop    %r14
+  8030ef:	41 5f                	pop    %r15
+  8030f1:	5d                   	pop    %rbp
+  8030f2:	c3                   	ret
+
+00000000008030f3 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8030f3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8030f8:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8030ff:	00 00 00 
+  803102:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  803109:	48 01 ca             	add    %rcx,%rdx
+  80310c:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803112:	39 fa                	cmp    %edi,%edx
+  803114:	74 12                	je     803128 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803116:	48 83 c0 01          	add    $0x1,%rax
+  80311a:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  803120:	75 e0                	jne    803102 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803122:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803127:	c3                   	ret
+            return envs[i].env_id;
+  803128:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80312f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803136:	00 00 00 
+  803139:	48 01 d0             	add    %rdx,%rax
+  80313c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803142:	c3                   	ret
+  803143:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000803148 <__rodata_start>:
+  803148:	70 69                	jo     8031b3 <__rodata_start+0x6b>
+  80314a:	70 65                	jo     8031b1 <__rodata_start+0x69>
+  80314c:	72 65                	jb     8031b3 <__rodata_start+0x6b>
+  80314e:	61                   	(bad)
+  80314f:	64 65 6f             	fs outsl %gs:(%rsi),(%dx)
+  803152:	66 00 70 69          	data16 add %dh,0x69(%rax)
+  803156:	70 65                	jo     8031bd <__rodata_start+0x75>
+  803158:	3a 20                	cmp    (%rax),%ah
+  80315a:	25 69 00 75 73       	and    $0x73750069,%eax
+  80315f:	65 72 2f             	gs jb  803191 <__rodata_start+0x49>
+  803162:	74 65                	je     8031c9 <__rodata_start+0x81>
+  803164:	73 74                	jae    8031da <__rodata_start+0x92>
+  803166:	70 69                	jo     8031d1 <__rodata_start+0x89>
+  803168:	70 65                	jo     8031cf <__rodata_start+0x87>
+  80316a:	2e 63 00             	cs movsxd (%rax),%eax
+  80316d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80316f:	72 6b                	jb     8031dc <__rodata_start+0x94>
+  803171:	3a 20                	cmp    (%rax),%ah
+  803173:	25 69 00 5b 25       	and    $0x255b0069,%eax
+  803178:	30 38                	xor    %bh,(%rax)
+  80317a:	78 5d                	js     8031d9 <__rodata_start+0x91>
+  80317c:	20 70 69             	and    %dh,0x69(%rax)
+  80317f:	70 65                	jo     8031e6 <__rodata_start+0x9e>
+  803181:	72 65                	jb     8031e8 <__rodata_start+0xa0>
+  803183:	61                   	(bad)
+  803184:	64 65 6f             	fs outsl %gs:(%rsi),(%dx)
+  803187:	66 20 63 6c          	data16 and %ah,0x6c(%rbx)
+  80318b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80318c:	73 65                	jae    8031f3 <__rodata_start+0xab>
+  80318e:	20 25 64 0a 00 5b    	and    %ah,0x5b000a64(%rip)        # 5b803bf8 <__bss_end+0x5affbbf8>
+  803194:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803199:	20 70 69             	and    %dh,0x69(%rax)
+  80319c:	70 65                	jo     803203 <__rodata_start+0xbb>
+  80319e:	72 65                	jb     803205 <__rodata_start+0xbd>
+  8031a0:	61                   	(bad)
+  8031a1:	64 65 6f             	fs outsl %gs:(%rsi),(%dx)
+  8031a4:	66 20 72 65          	data16 and %dh,0x65(%rdx)
+  8031a8:	61                   	(bad)
+  8031a9:	64 6e                	outsb  %fs:(%rsi),(%dx)
+  8031ab:	20 25 64 0a 00 72    	and    %ah,0x72000a64(%rip)        # 72803c15 <__bss_end+0x71ffbc15>
+  8031b1:	65 61                	gs (bad)
+  8031b3:	64 3a 20             	cmp    %fs:(%rax),%ah
+  8031b6:	25 69 00 0a 70       	and    $0x700a0069,%eax
+  8031bb:	69 70 65 20 72 65 61 	imul   $0x61657220,0x65(%rax),%esi
+  8031c2:	64 20 63 6c          	and    %ah,%fs:0x6c(%rbx)
+  8031c6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031c7:	73 65                	jae    80322e <__rodata_start+0xe6>
+  8031c9:	64 20 70 72          	and    %dh,%fs:0x72(%rax)
+  8031cd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031ce:	70 65                	jo     803235 <__rodata_start+0xed>
+  8031d0:	72 6c                	jb     80323e <__rodata_start+0xf6>
+  8031d2:	79 0a                	jns    8031de <__rodata_start+0x96>
+  8031d4:	00 0a                	add    %cl,(%rdx)
+  8031d6:	67 6f                	outsl  %ds:(%esi),(%dx)
+  8031d8:	74 20                	je     8031fa <__rodata_start+0xb2>
+  8031da:	25 64 20 62 79       	and    $0x79622064,%eax
+  8031df:	74 65                	je     803246 <__rodata_start+0xfe>
+  8031e1:	73 3a                	jae    80321d <__rodata_start+0xd5>
+  8031e3:	20 25 73 0a 00 5b    	and    %ah,0x5b000a73(%rip)        # 5b803c5c <__bss_end+0x5affbc5c>
+  8031e9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8031ee:	20 70 69             	and    %dh,0x69(%rax)
+  8031f1:	70 65                	jo     803258 <__rodata_start+0x110>
+  8031f3:	72 65                	jb     80325a <__rodata_start+0x112>
+  8031f5:	61                   	(bad)
+  8031f6:	64 65 6f             	fs outsl %gs:(%rsi),(%dx)
+  8031f9:	66 20 77 72          	data16 and %dh,0x72(%rdi)
+  8031fd:	69 74 65 20 25 64 0a 	imul   $0xa6425,0x20(%rbp,%riz,2),%esi
+  803204:	00 
+  803205:	77 72                	ja     803279 <__rodata_start+0x131>
+  803207:	69 74 65 3a 20 25 69 	imul   $0x692520,0x3a(%rbp,%riz,2),%esi
+  80320e:	00 
+  80320f:	70 69                	jo     80327a <__rodata_start+0x132>
+  803211:	70 65                	jo     803278 <__rodata_start+0x130>
+  803213:	77 72                	ja     803287 <__rodata_start+0x13f>
+  803215:	69 74 65 65 6f 66 00 	imul   $0x2e00666f,0x65(%rbp,%riz,2),%esi
+  80321c:	2e 
+  80321d:	00 78 00             	add    %bh,0x0(%rax)
+  803220:	0a 70 69             	or     0x69(%rax),%dh
+  803223:	70 65                	jo     80328a <__rodata_start+0x142>
+  803225:	20 77 72             	and    %dh,0x72(%rdi)
+  803228:	69 74 65 20 63 6c 6f 	imul   $0x736f6c63,0x20(%rbp,%riz,2),%esi
+  80322f:	73 
+  803230:	65 64 20 70 72       	gs and %dh,%fs:0x72(%rax)
+  803235:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803236:	70 65                	jo     80329d <__rodata_start+0x155>
+  803238:	72 6c                	jb     8032a6 <__rodata_start+0x15e>
+  80323a:	79 0a                	jns    803246 <__rodata_start+0xfe>
+  80323c:	00 70 69             	add    %dh,0x69(%rax)
+  80323f:	70 65                	jo     8032a6 <__rodata_start+0x15e>
+  803241:	20 74 65 73          	and    %dh,0x73(%rbp,%riz,2)
+  803245:	74 73                	je     8032ba <__rodata_start+0x172>
+  803247:	20 70 61             	and    %dh,0x61(%rax)
+  80324a:	73 73                	jae    8032bf <__rodata_start+0x177>
+  80324c:	65 64 0a 00          	gs or  %fs:(%rax),%al
+  803250:	4e 6f                	rex.WRX outsl %ds:(%rsi),(%dx)
+  803252:	77 20                	ja     803274 <__rodata_start+0x12c>
+  803254:	69 73 20 74 68 65 20 	imul   $0x20656874,0x20(%rbx),%esi
+  80325b:	74 69                	je     8032c6 <__rodata_start+0x17e>
+  80325d:	6d                   	insl   (%dx),%es:(%rdi)
+  80325e:	65 20 66 6f          	and    %ah,%gs:0x6f(%rsi)
+  803262:	72 20                	jb     803284 <__rodata_start+0x13c>
+  803264:	61                   	(bad)
+  803265:	6c                   	insb   (%dx),%es:(%rdi)
+  803266:	6c                   	insb   (%dx),%es:(%rdi)
+  803267:	20 67 6f             	and    %ah,0x6f(%rdi)
+  80326a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80326b:	64 20 6d 65          	and    %ch,%fs:0x65(%rbp)
+  80326f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803270:	20 74 6f 20          	and    %dh,0x20(%rdi,%rbp,2)
+  803274:	63 6f 6d             	movsxd 0x6d(%rdi),%ebp
+  803277:	65 20 74 6f 20       	and    %dh,%gs:0x20(%rdi,%rbp,2)
+  80327c:	74 68                	je     8032e6 <__rodata_start+0x19e>
+  80327e:	65 20 61 69          	and    %ah,%gs:0x69(%rcx)
+  803282:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803286:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  80328a:	69 72 20 70 61 72 74 	imul   $0x74726170,0x20(%rdx),%esi
+  803291:	79 2e                	jns    8032c1 <__rodata_start+0x179>
+  803293:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  80329a:	77 6e                	ja     80330a <__rodata_start+0x1c2>
+  80329c:	3e 00 66 90          	ds add %ah,-0x70(%rsi)
+  8032a0:	5b                   	pop    %rbx
+  8032a1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8032a6:	20 75 73             	and    %dh,0x73(%rbp)
+  8032a9:	65 72 20             	gs jb  8032cc <__rodata_start+0x184>
+  8032ac:	70 61                	jo     80330f <__rodata_start+0x1c7>
+  8032ae:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032af:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  8032b6:	73 20                	jae    8032d8 <__rodata_start+0x190>
+  8032b8:	61                   	(bad)
+  8032b9:	74 20                	je     8032db <__rodata_start+0x193>
+  8032bb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  8032c0:	3a 20                	cmp    (%rax),%ah
+  8032c2:	00 30                	add    %dh,(%rax)
+  8032c4:	31 32                	xor    %esi,(%rdx)
+  8032c6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8032cd:	41                   	rex.B
+  8032ce:	42                   	rex.X
+  8032cf:	43                   	rex.XB
+  8032d0:	44                   	rex.R
+  8032d1:	45                   	rex.RB
+  8032d2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8032d5:	31 32                	xor    %esi,(%rdx)
+  8032d7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8032de:	61                   	(bad)
+  8032df:	62 63 64 65 66       	(bad)
+  8032e4:	00 28                	add    %ch,(%rax)
+  8032e6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032e7:	75 6c                	jne    803355 <__rodata_start+0x20d>
+  8032e9:	6c                   	insb   (%dx),%es:(%rdi)
+  8032ea:	29 00                	sub    %eax,(%rax)
+  8032ec:	65 72 72             	gs jb  803361 <__rodata_start+0x219>
+  8032ef:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032f0:	72 20                	jb     803312 <__rodata_start+0x1ca>
+  8032f2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8032f7:	73 70                	jae    803369 <__rodata_start+0x221>
+  8032f9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8032fd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803304:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803305:	72 00                	jb     803307 <__rodata_start+0x1bf>
+  803307:	62 61 64 20 65       	(bad)
+  80330c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80330d:	76 69                	jbe    803378 <__rodata_start+0x230>
+  80330f:	72 6f                	jb     803380 <__rodata_start+0x238>
+  803311:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803312:	6d                   	insl   (%dx),%es:(%rdi)
+  803313:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803315:	74 00                	je     803317 <__rodata_start+0x1cf>
+  803317:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80331e:	20 70 61             	and    %dh,0x61(%rax)
+  803321:	72 61                	jb     803384 <__rodata_start+0x23c>
+  803323:	6d                   	insl   (%dx),%es:(%rdi)
+  803324:	65 74 65             	gs je  80338c <__rodata_start+0x244>
+  803327:	72 00                	jb     803329 <__rodata_start+0x1e1>
+  803329:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80332a:	75 74                	jne    8033a0 <__rodata_start+0x258>
+  80332c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80332f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803332:	6d                   	insl   (%dx),%es:(%rdi)
+  803333:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803334:	72 79                	jb     8033af <__rodata_start+0x267>
+  803336:	00 6f 75             	add    %ch,0x75(%rdi)
+  803339:	74 20                	je     80335b <__rodata_start+0x213>
+  80333b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80333c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803340:	76 69                	jbe    8033ab <__rodata_start+0x263>
+  803342:	72 6f                	jb     8033b3 <__rodata_start+0x26b>
+  803344:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803345:	6d                   	insl   (%dx),%es:(%rdi)
+  803346:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803348:	74 73                	je     8033bd <__rodata_start+0x275>
+  80334a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80334d:	72 72                	jb     8033c1 <__rodata_start+0x279>
+  80334f:	75 70                	jne    8033c1 <__rodata_start+0x279>
+  803351:	74 65                	je     8033b8 <__rodata_start+0x270>
+  803353:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803358:	75 67                	jne    8033c1 <__rodata_start+0x279>
+  80335a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80335d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80335f:	00 73 65             	add    %dh,0x65(%rbx)
+  803362:	67 6d                	insl   (%dx),%es:(%edi)
+  803364:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803366:	74 61                	je     8033c9 <__rodata_start+0x281>
+  803368:	74 69                	je     8033d3 <__rodata_start+0x28b>
+  80336a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80336b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80336c:	20 66 61             	and    %ah,0x61(%rsi)
+  80336f:	75 6c                	jne    8033dd <__rodata_start+0x295>
+  803371:	74 00                	je     803373 <__rodata_start+0x22b>
+  803373:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80337a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80337d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803381:	61                   	(bad)
+  803382:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803387:	20 73 75             	and    %dh,0x75(%rbx)
+  80338a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80338d:	73 79                	jae    803408 <__rodata_start+0x2c0>
+  80338f:	73 74                	jae    803405 <__rodata_start+0x2bd>
+  803391:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803393:	20 63 61             	and    %ah,0x61(%rbx)
+  803396:	6c                   	insb   (%dx),%es:(%rdi)
+  803397:	6c                   	insb   (%dx),%es:(%rdi)
+  803398:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80339b:	74 72                	je     80340f <__rodata_start+0x2c7>
+  80339d:	79 20                	jns    8033bf <__rodata_start+0x277>
+  80339f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033a0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033a1:	74 20                	je     8033c3 <__rodata_start+0x27b>
+  8033a3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8033a5:	75 6e                	jne    803415 <__rodata_start+0x2cd>
+  8033a7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8033ab:	76 20                	jbe    8033cd <__rodata_start+0x285>
+  8033ad:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8033b4:	72 65                	jb     80341b <__rodata_start+0x2d3>
+  8033b6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8033b9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033ba:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8033be:	65 78 70             	gs js  803431 <__rodata_start+0x2e9>
+  8033c1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8033c6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8033c9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8033cd:	20 66 69             	and    %ah,0x69(%rsi)
+  8033d0:	6c                   	insb   (%dx),%es:(%rdi)
+  8033d1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8033d5:	20 66 72             	and    %ah,0x72(%rsi)
+  8033d8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8033dd:	61                   	(bad)
+  8033de:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8033e1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033e2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033e3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8033e7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8033ea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033eb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033ec:	20 6d 61             	and    %ch,0x61(%rbp)
+  8033ef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033f0:	79 20                	jns    803412 <__rodata_start+0x2ca>
+  8033f2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8033f9:	72 65                	jb     803460 <__rodata_start+0x318>
+  8033fb:	20 6f 70             	and    %ch,0x70(%rdi)
+  8033fe:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803400:	00 66 69             	add    %ah,0x69(%rsi)
+  803403:	6c                   	insb   (%dx),%es:(%rdi)
+  803404:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803408:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80340b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80340c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80340f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803410:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803411:	74 20                	je     803433 <__rodata_start+0x2eb>
+  803413:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803415:	75 6e                	jne    803485 <__rodata_start+0x33d>
+  803417:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80341b:	76 61                	jbe    80347e <__rodata_start+0x336>
+  80341d:	6c                   	insb   (%dx),%es:(%rdi)
+  80341e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803425:	00 
+  803426:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80342d:	72 65                	jb     803494 <__rodata_start+0x34c>
+  80342f:	61                   	(bad)
+  803430:	64 79 20             	fs jns 803453 <__rodata_start+0x30b>
+  803433:	65 78 69             	gs js  80349f <__rodata_start+0x357>
+  803436:	73 74                	jae    8034ac <__rodata_start+0x364>
+  803438:	73 00                	jae    80343a <__rodata_start+0x2f2>
+  80343a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80343b:	70 65                	jo     8034a2 <__rodata_start+0x35a>
+  80343d:	72 61                	jb     8034a0 <__rodata_start+0x358>
+  80343f:	74 69                	je     8034aa <__rodata_start+0x362>
+  803441:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803442:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803443:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803446:	74 20                	je     803468 <__rodata_start+0x320>
+  803448:	73 75                	jae    8034bf <__rodata_start+0x377>
+  80344a:	70 70                	jo     8034bc <__rodata_start+0x374>
+  80344c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80344d:	72 74                	jb     8034c3 <__rodata_start+0x37b>
+  80344f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803454:	65 72 61             	gs jb  8034b8 <__rodata_start+0x370>
+  803457:	74 69                	je     8034c2 <__rodata_start+0x37a>
+  803459:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80345a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80345b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80345e:	74 20                	je     803480 <__rodata_start+0x338>
+  803460:	70 65                	jo     8034c7 <__rodata_start+0x37f>
+  803462:	72 6d                	jb     8034d1 <__rodata_start+0x389>
+  803464:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  80346b:	2e 
+  80346c:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803473:	00 
+  803474:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80347b:	00 00 00 
+  80347e:	66 90                	xchg   %ax,%ax
+  803480:	af                   	scas   %es:(%rdi),%eax
+  803481:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803487:	00 f0                	add    %dh,%al
+  803489:	0e                   	(bad)
+  80348a:	80 00 00             	addb   $0x0,(%rax)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 e0                	add    %ah,%al
+  803491:	0e                   	(bad)
+  803492:	80 00 00             	addb   $0x0,(%rax)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 f0                	add    %dh,%al
+  803499:	0e                   	(bad)
+  80349a:	80 00 00             	addb   $0x0,(%rax)
+  80349d:	00 00                	add    %al,(%rax)
+  80349f:	00 f0                	add    %dh,%al
+  8034a1:	0e                   	(bad)
+  8034a2:	80 00 00             	addb   $0x0,(%rax)
+  8034a5:	00 00                	add    %al,(%rax)
+  8034a7:	00 f0                	add    %dh,%al
+  8034a9:	0e                   	(bad)
+  8034aa:	80 00 00             	addb   $0x0,(%rax)
+  8034ad:	00 00                	add    %al,(%rax)
+  8034af:	00 f0                	add    %dh,%al
+  8034b1:	0e                   	(bad)
+  8034b2:	80 00 00             	addb   $0x0,(%rax)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 ce                	add    %cl,%dh
+  8034b9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8034bf:	00 f0                	add    %dh,%al
+  8034c1:	0e                   	(bad)
+  8034c2:	80 00 00             	addb   $0x0,(%rax)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 f0                	add    %dh,%al
+  8034c9:	0e                   	(bad)
+  8034ca:	80 00 00             	addb   $0x0,(%rax)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 c2                	add    %al,%dl
+  8034d1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8034d7:	00 3c 09             	add    %bh,(%rcx,%rcx,1)
+  8034da:	80 00 00             	addb   $0x0,(%rax)
+  8034dd:	00 00                	add    %al,(%rax)
+  8034df:	00 f0                	add    %dh,%al
+  8034e1:	0e                   	(bad)
+  8034e2:	80 00 00             	addb   $0x0,(%rax)
+  8034e5:	00 00                	add    %al,(%rax)
+  8034e7:	00 c2                	add    %al,%dl
+  8034e9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8034ef:	00 08                	add    %cl,(%rax)
+  8034f1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8034f7:	00 08                	add    %cl,(%rax)
+  8034f9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8034ff:	00 08                	add    %cl,(%rax)
+  803501:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803507:	00 08                	add    %cl,(%rax)
+  803509:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80350f:	00 08                	add    %cl,(%rax)
+  803511:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803517:	00 08                	add    %cl,(%rax)
+  803519:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80351f:	00 08                	add    %cl,(%rax)
+  803521:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803527:	00 08                	add    %cl,(%rax)
+  803529:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80352f:	00 08                	add    %cl,(%rax)
+  803531:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803537:	00 f0                	add    %dh,%al
+  803539:	0e                   	(bad)
+  80353a:	80 00 00             	addb   $0x0,(%rax)
+  80353d:	00 00                	add    %al,(%rax)
+  80353f:	00 f0                	add    %dh,%al
+  803541:	0e                   	(bad)
+  803542:	80 00 00             	addb   $0x0,(%rax)
+  803545:	00 00                	add    %al,(%rax)
+  803547:	00 f0                	add    %dh,%al
+  803549:	0e                   	(bad)
+  80354a:	80 00 00             	addb   $0x0,(%rax)
+  80354d:	00 00                	add    %al,(%rax)
+  80354f:	00 f0                	add    %dh,%al
+  803551:	0e                   	(bad)
+  803552:	80 00 00             	addb   $0x0,(%rax)
+  803555:	00 00                	add    %al,(%rax)
+  803557:	00 f0                	add    %dh,%al
+  803559:	0e                   	(bad)
+  80355a:	80 00 00             	addb   $0x0,(%rax)
+  80355d:	00 00                	add    %al,(%rax)
+  80355f:	00 f0                	add    %dh,%al
+  803561:	0e                   	(bad)
+  803562:	80 00 00             	addb   $0x0,(%rax)
+  803565:	00 00                	add    %al,(%rax)
+  803567:	00 f0                	add    %dh,%al
+  803569:	0e                   	(bad)
+  80356a:	80 00 00             	addb   $0x0,(%rax)
+  80356d:	00 00                	add    %al,(%rax)
+  80356f:	00 f0                	add    %dh,%al
+  803571:	0e                   	(bad)
+  803572:	80 00 00             	addb   $0x0,(%rax)
+  803575:	00 00                	add    %al,(%rax)
+  803577:	00 f0                	add    %dh,%al
+  803579:	0e                   	(bad)
+  80357a:	80 00 00             	addb   $0x0,(%rax)
+  80357d:	00 00                	add    %al,(%rax)
+  80357f:	00 f0                	add    %dh,%al
+  803581:	0e                   	(bad)
+  803582:	80 00 00             	addb   $0x0,(%rax)
+  803585:	00 00                	add    %al,(%rax)
+  803587:	00 f0                	add    %dh,%al
+  803589:	0e                   	(bad)
+  80358a:	80 00 00             	addb   $0x0,(%rax)
+  80358d:	00 00                	add    %al,(%rax)
+  80358f:	00 f0                	add    %dh,%al
+  803591:	0e                   	(bad)
+  803592:	80 00 00             	addb   $0x0,(%rax)
+  803595:	00 00                	add    %al,(%rax)
+  803597:	00 f0                	add    %dh,%al
+  803599:	0e                   	(bad)
+  80359a:	80 00 00             	addb   $0x0,(%rax)
+  80359d:	00 00                	add    %al,(%rax)
+  80359f:	00 f0                	add    %dh,%al
+  8035a1:	0e                   	(bad)
+  8035a2:	80 00 00             	addb   $0x0,(%rax)
+  8035a5:	00 00                	add    %al,(%rax)
+  8035a7:	00 f0                	add    %dh,%al
+  8035a9:	0e                   	(bad)
+  8035aa:	80 00 00             	addb   $0x0,(%rax)
+  8035ad:	00 00                	add    %al,(%rax)
+  8035af:	00 f0                	add    %dh,%al
+  8035b1:	0e                   	(bad)
+  8035b2:	80 00 00             	addb   $0x0,(%rax)
+  8035b5:	00 00                	add    %al,(%rax)
+  8035b7:	00 f0                	add    %dh,%al
+  8035b9:	0e                   	(bad)
+  8035ba:	80 00 00             	addb   $0x0,(%rax)
+  8035bd:	00 00                	add    %al,(%rax)
+  8035bf:	00 f0                	add    %dh,%al
+  8035c1:	0e                   	(bad)
+  8035c2:	80 00 00             	addb   $0x0,(%rax)
+  8035c5:	00 00                	add    %al,(%rax)
+  8035c7:	00 f0                	add    %dh,%al
+  8035c9:	0e                   	(bad)
+  8035ca:	80 00 00             	addb   $0x0,(%rax)
+  8035cd:	00 00                	add    %al,(%rax)
+  8035cf:	00 f0                	add    %dh,%al
+  8035d1:	0e                   	(bad)
+  8035d2:	80 00 00             	addb   $0x0,(%rax)
+  8035d5:	00 00                	add    %al,(%rax)
+  8035d7:	00 f0                	add    %dh,%al
+  8035d9:	0e                   	(bad)
+  8035da:	80 00 00             	addb   $0x0,(%rax)
+  8035dd:	00 00                	add    %al,(%rax)
+  8035df:	00 f0                	add    %dh,%al
+  8035e1:	0e                   	(bad)
+  8035e2:	80 00 00             	addb   $0x0,(%rax)
+  8035e5:	00 00                	add    %al,(%rax)
+  8035e7:	00 f0                	add    %dh,%al
+  8035e9:	0e                   	(bad)
+  8035ea:	80 00 00             	addb   $0x0,(%rax)
+  8035ed:	00 00                	add    %al,(%rax)
+  8035ef:	00 f0                	add    %dh,%al
+  8035f1:	0e                   	(bad)
+  8035f2:	80 00 00             	addb   $0x0,(%rax)
+  8035f5:	00 00                	add    %al,(%rax)
+  8035f7:	00 f0                	add    %dh,%al
+  8035f9:	0e                   	(bad)
+  8035fa:	80 00 00             	addb   $0x0,(%rax)
+  8035fd:	00 00                	add    %al,(%rax)
+  8035ff:	00 f0                	add    %dh,%al
+  803601:	0e                   	(bad)
+  803602:	80 00 00             	addb   $0x0,(%rax)
+  803605:	00 00                	add    %al,(%rax)
+  803607:	00 f0                	add    %dh,%al
+  803609:	0e                   	(bad)
+  80360a:	80 00 00             	addb   $0x0,(%rax)
+  80360d:	00 00                	add    %al,(%rax)
+  80360f:	00 f0                	add    %dh,%al
+  803611:	0e                   	(bad)
+  803612:	80 00 00             	addb   $0x0,(%rax)
+  803615:	00 00                	add    %al,(%rax)
+  803617:	00 f0                	add    %dh,%al
+  803619:	0e                   	(bad)
+  80361a:	80 00 00             	addb   $0x0,(%rax)
+  80361d:	00 00                	add    %al,(%rax)
+  80361f:	00 f0                	add    %dh,%al
+  803621:	0e                   	(bad)
+  803622:	80 00 00             	addb   $0x0,(%rax)
+  803625:	00 00                	add    %al,(%rax)
+  803627:	00 13                	add    %dl,(%rbx)
+  803629:	0e                   	(bad)
+  80362a:	80 00 00             	addb   $0x0,(%rax)
+  80362d:	00 00                	add    %al,(%rax)
+  80362f:	00 f0                	add    %dh,%al
+  803631:	0e                   	(bad)
+  803632:	80 00 00             	addb   $0x0,(%rax)
+  803635:	00 00                	add    %al,(%rax)
+  803637:	00 f0                	add    %dh,%al
+  803639:	0e                   	(bad)
+  80363a:	80 00 00             	addb   $0x0,(%rax)
+  80363d:	00 00                	add    %al,(%rax)
+  80363f:	00 f0                	add    %dh,%al
+  803641:	0e                   	(bad)
+  803642:	80 00 00             	addb   $0x0,(%rax)
+  803645:	00 00                	add    %al,(%rax)
+  803647:	00 f0                	add    %dh,%al
+  803649:	0e                   	(bad)
+  80364a:	80 00 00             	addb   $0x0,(%rax)
+  80364d:	00 00                	add    %al,(%rax)
+  80364f:	00 f0                	add    %dh,%al
+  803651:	0e                   	(bad)
+  803652:	80 00 00             	addb   $0x0,(%rax)
+  803655:	00 00                	add    %al,(%rax)
+  803657:	00 f0                	add    %dh,%al
+  803659:	0e                   	(bad)
+  80365a:	80 00 00             	addb   $0x0,(%rax)
+  80365d:	00 00                	add    %al,(%rax)
+  80365f:	00 f0                	add    %dh,%al
+  803661:	0e                   	(bad)
+  803662:	80 00 00             	addb   $0x0,(%rax)
+  803665:	00 00                	add    %al,(%rax)
+  803667:	00 f0                	add    %dh,%al
+  803669:	0e                   	(bad)
+  80366a:	80 00 00             	addb   $0x0,(%rax)
+  80366d:	00 00                	add    %al,(%rax)
+  80366f:	00 f0                	add    %dh,%al
+  803671:	0e                   	(bad)
+  803672:	80 00 00             	addb   $0x0,(%rax)
+  803675:	00 00                	add    %al,(%rax)
+  803677:	00 f0                	add    %dh,%al
+  803679:	0e                   	(bad)
+  80367a:	80 00 00             	addb   $0x0,(%rax)
+  80367d:	00 00                	add    %al,(%rax)
+  80367f:	00 5f 09             	add    %bl,0x9(%rdi)
+  803682:	80 00 00             	addb   $0x0,(%rax)
+  803685:	00 00                	add    %al,(%rax)
+  803687:	00 2e                	add    %ch,(%rsi)
+  803689:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80368f:	00 f0                	add    %dh,%al
+  803691:	0e                   	(bad)
+  803692:	80 00 00             	addb   $0x0,(%rax)
+  803695:	00 00                	add    %al,(%rax)
+  803697:	00 f0                	add    %dh,%al
+  803699:	0e                   	(bad)
+  80369a:	80 00 00             	addb   $0x0,(%rax)
+  80369d:	00 00                	add    %al,(%rax)
+  80369f:	00 f0                	add    %dh,%al
+  8036a1:	0e                   	(bad)
+  8036a2:	80 00 00             	addb   $0x0,(%rax)
+  8036a5:	00 00                	add    %al,(%rax)
+  8036a7:	00 f0                	add    %dh,%al
+  8036a9:	0e                   	(bad)
+  8036aa:	80 00 00             	addb   $0x0,(%rax)
+  8036ad:	00 00                	add    %al,(%rax)
+  8036af:	00 8e 09 80 00 00    	add    %cl,0x8009(%rsi)
+  8036b5:	00 00                	add    %al,(%rax)
+  8036b7:	00 f0                	add    %dh,%al
+  8036b9:	0e                   	(bad)
+  8036ba:	80 00 00             	addb   $0x0,(%rax)
+  8036bd:	00 00                	add    %al,(%rax)
+  8036bf:	00 f0                	add    %dh,%al
+  8036c1:	0e                   	(bad)
+  8036c2:	80 00 00             	addb   $0x0,(%rax)
+  8036c5:	00 00                	add    %al,(%rax)
+  8036c7:	00 54 09 80          	add    %dl,-0x80(%rcx,%rcx,1)
+  8036cb:	00 00                	add    %al,(%rax)
+  8036cd:	00 00                	add    %al,(%rax)
+  8036cf:	00 f0                	add    %dh,%al
+  8036d1:	0e                   	(bad)
+  8036d2:	80 00 00             	addb   $0x0,(%rax)
+  8036d5:	00 00                	add    %al,(%rax)
+  8036d7:	00 f0                	add    %dh,%al
+  8036d9:	0e                   	(bad)
+  8036da:	80 00 00             	addb   $0x0,(%rax)
+  8036dd:	00 00                	add    %al,(%rax)
+  8036df:	00 d6                	add    %dl,%dh
+  8036e1:	0c 80                	or     $0x80,%al
+  8036e3:	00 00                	add    %al,(%rax)
+  8036e5:	00 00                	add    %al,(%rax)
+  8036e7:	00 a0 0d 80 00 00    	add    %ah,0x800d(%rax)
+  8036ed:	00 00                	add    %al,(%rax)
+  8036ef:	00 f0                	add    %dh,%al
+  8036f1:	0e                   	(bad)
+  8036f2:	80 00 00             	addb   $0x0,(%rax)
+  8036f5:	00 00                	add    %al,(%rax)
+  8036f7:	00 f0                	add    %dh,%al
+  8036f9:	0e                   	(bad)
+  8036fa:	80 00 00             	addb   $0x0,(%rax)
+  8036fd:	00 00                	add    %al,(%rax)
+  8036ff:	00 25 0a 80 00 00    	add    %ah,0x800a(%rip)        # 80b70f <__bss_end+0x370f>
+  803705:	00 00                	add    %al,(%rax)
+  803707:	00 f0                	add    %dh,%al
+  803709:	0e                   	(bad)
+  80370a:	80 00 00             	addb   $0x0,(%rax)
+  80370d:	00 00                	add    %al,(%rax)
+  80370f:	00 02                	add    %al,(%rdx)
+  803711:	0c 80                	or     $0x80,%al
+  803713:	00 00                	add    %al,(%rax)
+  803715:	00 00                	add    %al,(%rax)
+  803717:	00 f0                	add    %dh,%al
+  803719:	0e                   	(bad)
+  80371a:	80 00 00             	addb   $0x0,(%rax)
+  80371d:	00 00                	add    %al,(%rax)
+  80371f:	00 f0                	add    %dh,%al
+  803721:	0e                   	(bad)
+  803722:	80 00 00             	addb   $0x0,(%rax)
+  803725:	00 00                	add    %al,(%rax)
+  803727:	00 13                	add    %dl,(%rbx)
+  803729:	0e                   	(bad)
+  80372a:	80 00 00             	addb   $0x0,(%rax)
+  80372d:	00 00                	add    %al,(%rax)
+  80372f:	00 f0                	add    %dh,%al
+  803731:	0e                   	(bad)
+  803732:	80 00 00             	addb   $0x0,(%rax)
+  803735:	00 00                	add    %al,(%rax)
+  803737:	00 b8 08 80 00 00    	add    %bh,0x8008(%rax)
+  80373d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803740 <error_string>:
+	...
+  803748:	f5 32 80 00 00 00 00 00 07 33 80 00 00 00 00 00     .2.......3......
+  803758:	17 33 80 00 00 00 00 00 29 33 80 00 00 00 00 00     .3......)3......
+  803768:	37 33 80 00 00 00 00 00 4b 33 80 00 00 00 00 00     73......K3......
+  803778:	60 33 80 00 00 00 00 00 73 33 80 00 00 00 00 00     `3......s3......
+  803788:	85 33 80 00 00 00 00 00 99 33 80 00 00 00 00 00     .3.......3......
+  803798:	a9 33 80 00 00 00 00 00 bc 33 80 00 00 00 00 00     .3.......3......
+  8037a8:	d3 33 80 00 00 00 00 00 e9 33 80 00 00 00 00 00     .3.......3......
+  8037b8:	01 34 80 00 00 00 00 00 19 34 80 00 00 00 00 00     .4.......4......
+  8037c8:	26 34 80 00 00 00 00 00 f0 37 80 00 00 00 00 00     &4.......7......
+  8037d8:	3a 34 80 00 00 00 00 00 00 00 00 00 00 00 00 00     :4..............
+  8037e8:	52 34 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     R4......file is 
+  8037f8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803808:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803818:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803828:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803838:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  803848:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  803858:	6c 69 62 2f 66 6f 72 6b 2e 63 00 0f 1f 44 00 00     lib/fork.c...D..
+  803868:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803878:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803888:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803898:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8038a8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8038b8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8038c8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8038d8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8038e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038f8:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000803900 <devtab>:
+  803900:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803910:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803920:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803930:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803940:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803950:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803960:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803970:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  803980:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  803990:	00 63 6f 6e 73 00 69 70 63 5f 73 65 6e 64 3a 20     .cons.ipc_send: 
+  8039a0:	66 61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00 6c     failed to send.l
+  8039b0:	69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00     ib/ipc.c.f......
+  8039c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
@@ -0,0 +1,6025 @@
+
+obj/user/testpiperace:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 20 03 00 00       	call   800343 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+    int p[2], r, pid, i, max;
+    void *va;
+    struct Fd *fd;
+    const volatile struct Env *kid;
+
+    cprintf("testing for dup race...\n");
+  800036:	48 bf 30 2f 80 00 00 	movabs $0x802f30,%rdi
+  80003d:	00 00 00 
+  800040:	b8 00 00 00 00       	mov    $0x0,%eax
+  800045:	48 ba 5d 05 80 00 00 	movabs $0x80055d,%rdx
+  80004c:	00 00 00 
+  80004f:	ff d2                	call   *%rdx
+    if ((r = pipe(p)) < 0)
+  800051:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  800055:	48 b8 f2 28 80 00 00 	movabs $0x8028f2,%rax
+  80005c:	00 00 00 
+  80005f:	ff d0                	call   *%rax
+  800061:	85 c0                	test   %eax,%eax
+  800063:	0f 88 76 01 00 00    	js     8001df <umain+0x1ba>
+        panic("pipe: %i", r);
+    max = 200;
+    if ((r = fork()) < 0)
+  800069:	48 b8 d4 19 80 00 00 	movabs $0x8019d4,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 88 8c 01 00 00    	js     80020c <umain+0x1e7>
+        panic("fork: %i", r);
+    if (r == 0) {
+  800080:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  800084:	0f 84 af 01 00 00    	je     800239 <umain+0x214>
+        }
+        /* do something to be not runnable besides exiting */
+        ipc_recv(0, 0, 0, 0);
+    }
+    pid = r;
+    cprintf("pid is %d\n", pid);
+  80008a:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+  80008d:	89 de                	mov    %ebx,%esi
+  80008f:	48 bf 8a 2f 80 00 00 	movabs $0x802f8a,%rdi
+  800096:	00 00 00 
+  800099:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009e:	49 bc 5d 05 80 00 00 	movabs $0x80055d,%r12
+  8000a5:	00 00 00 
+  8000a8:	41 ff d4             	call   *%r12
+    va = 0;
+    kid = &envs[ENVX(pid)];
+  8000ab:	44 0f b6 eb          	movzbl %bl,%r13d
+    cprintf("kid is %d\n", (int32_t)(kid - envs));
+  8000af:	0f b6 db             	movzbl %bl,%ebx
+  8000b2:	48 69 db b0 06 00 00 	imul   $0x6b0,%rbx,%rbx
+  8000b9:	48 89 de             	mov    %rbx,%rsi
+  8000bc:	48 c1 fe 04          	sar    $0x4,%rsi
+  8000c0:	69 f6 43 ac 28 8d    	imul   $0x8d28ac43,%esi,%esi
+  8000c6:	48 bf 95 2f 80 00 00 	movabs $0x802f95,%rdi
+  8000cd:	00 00 00 
+  8000d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d5:	41 ff d4             	call   *%r12
+    dup(p[0], 10);
+  8000d8:	be 0a 00 00 00       	mov    $0xa,%esi
+  8000dd:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000e0:	48 b8 a7 1e 80 00 00 	movabs $0x801ea7,%rax
+  8000e7:	00 00 00 
+  8000ea:	ff d0                	call   *%rax
+    while (kid->env_status == ENV_RUNNABLE)
+  8000ec:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8000f3:	00 00 00 
+  8000f6:	48 01 d8             	add    %rbx,%rax
+  8000f9:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  8000ff:	83 f8 02             	cmp    $0x2,%eax
+  800102:	75 37                	jne    80013b <umain+0x116>
+        dup(p[0], 10);
+  800104:	49 bc a7 1e 80 00 00 	movabs $0x801ea7,%r12
+  80010b:	00 00 00 
+    while (kid->env_status == ENV_RUNNABLE)
+  80010e:	4d 63 ed             	movslq %r13d,%r13
+  800111:	4d 69 ed b0 06 00 00 	imul   $0x6b0,%r13,%r13
+  800118:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  80011f:	00 00 00 
+  800122:	4c 01 eb             	add    %r13,%rbx
+        dup(p[0], 10);
+  800125:	be 0a 00 00 00       	mov    $0xa,%esi
+  80012a:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80012d:	41 ff d4             	call   *%r12
+    while (kid->env_status == ENV_RUNNABLE)
+  800130:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  800136:	83 f8 02             	cmp    $0x2,%eax
+  800139:	74 ea                	je     800125 <umain+0x100>
+
+    cprintf("child done with loop\n");
+  80013b:	48 bf a0 2f 80 00 00 	movabs $0x802fa0,%rdi
+  800142:	00 00 00 
+  800145:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014a:	48 ba 5d 05 80 00 00 	movabs $0x80055d,%rdx
+  800151:	00 00 00 
+  800154:	ff d2                	call   *%rdx
+    if (pipeisclosed(p[0]))
+  800156:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800159:	48 b8 fe 2a 80 00 00 	movabs $0x802afe,%rax
+  800160:	00 00 00 
+  800163:	ff d0                	call   *%rax
+  800165:	85 c0                	test   %eax,%eax
+  800167:	0f 85 5a 01 00 00    	jne    8002c7 <umain+0x2a2>
+        panic("somehow the other end of p[0] got closed!");
+    if ((r = fd_lookup(p[0], &fd)) < 0)
+  80016d:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800171:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800174:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  80017b:	00 00 00 
+  80017e:	ff d0                	call   *%rax
+  800180:	85 c0                	test   %eax,%eax
+  800182:	0f 88 69 01 00 00    	js     8002f1 <umain+0x2cc>
+        panic("cannot look up p[0]: %i", r);
+    va = fd2data(fd);
+  800188:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80018c:	48 b8 6b 1c 80 00 00 	movabs $0x801c6b,%rax
+  800193:	00 00 00 
+  800196:	ff d0                	call   *%rax
+  800198:	48 89 c7             	mov    %rax,%rdi
+    if (sys_region_refs(va, PAGE_SIZE) != 3 + 1)
+  80019b:	be 00 10 00 00       	mov    $0x1000,%esi
+  8001a0:	48 b8 d4 13 80 00 00 	movabs $0x8013d4,%rax
+  8001a7:	00 00 00 
+  8001aa:	ff d0                	call   *%rax
+  8001ac:	83 f8 04             	cmp    $0x4,%eax
+  8001af:	0f 84 69 01 00 00    	je     80031e <umain+0x2f9>
+        cprintf("\nchild detected race\n");
+  8001b5:	48 bf ce 2f 80 00 00 	movabs $0x802fce,%rdi
+  8001bc:	00 00 00 
+  8001bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c4:	48 ba 5d 05 80 00 00 	movabs $0x80055d,%rdx
+  8001cb:	00 00 00 
+  8001ce:	ff d2                	call   *%rdx
+    else
+        cprintf("\nrace didn't happen (number of tests: %d)\n", max);
+}
+  8001d0:	48 83 c4 28          	add    $0x28,%rsp
+  8001d4:	5b                   	pop    %rbx
+  8001d5:	41 5c                	pop    %r12
+  8001d7:	41 5d                	pop    %r13
+  8001d9:	41 5e                	pop    %r14
+  8001db:	41 5f                	pop    %r15
+  8001dd:	5d                   	pop    %rbp
+  8001de:	c3                   	ret
+        panic("pipe: %i", r);
+  8001df:	89 c1                	mov    %eax,%ecx
+  8001e1:	48 ba 49 2f 80 00 00 	movabs $0x802f49,%rdx
+  8001e8:	00 00 00 
+  8001eb:	be 0c 00 00 00       	mov    $0xc,%esi
+  8001f0:	48 bf 52 2f 80 00 00 	movabs $0x802f52,%rdi
+  8001f7:	00 00 00 
+  8001fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ff:	49 b8 0d 04 80 00 00 	movabs $0x80040d,%r8
+  800206:	00 00 00 
+  800209:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  80020c:	89 c1                	mov    %eax,%ecx
+  80020e:	48 ba 66 2f 80 00 00 	movabs $0x802f66,%rdx
+  800215:	00 00 00 
+  800218:	be 0f 00 00 00       	mov    $0xf,%esi
+  80021d:	48 bf 52 2f 80 00 00 	movabs $0x802f52,%rdi
+  800224:	00 00 00 
+  800227:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022c:	49 b8 0d 04 80 00 00 	movabs $0x80040d,%r8
+  800233:	00 00 00 
+  800236:	41 ff d0             	call   *%r8
+        close(p[1]);
+  800239:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80023c:	48 b8 4c 1e 80 00 00 	movabs $0x801e4c,%rax
+  800243:	00 00 00 
+  800246:	ff d0                	call   *%rax
+  800248:	bb c8 00 00 00       	mov    $0xc8,%ebx
+            if (pipeisclosed(p[0])) {
+  80024d:	49 bc fe 2a 80 00 00 	movabs $0x802afe,%r12
+  800254:	00 00 00 
+                cprintf("RACE: pipe appears closed\n");
+  800257:	49 bf 6f 2f 80 00 00 	movabs $0x802f6f,%r15
+  80025e:	00 00 00 
+  800261:	49 be 5d 05 80 00 00 	movabs $0x80055d,%r14
+  800268:	00 00 00 
+                exit();
+  80026b:	49 bd ea 03 80 00 00 	movabs $0x8003ea,%r13
+  800272:	00 00 00 
+  800275:	eb 11                	jmp    800288 <umain+0x263>
+            sys_yield();
+  800277:	48 b8 a3 13 80 00 00 	movabs $0x8013a3,%rax
+  80027e:	00 00 00 
+  800281:	ff d0                	call   *%rax
+        for (i = 0; i < max; i++) {
+  800283:	83 eb 01             	sub    $0x1,%ebx
+  800286:	74 1a                	je     8002a2 <umain+0x27d>
+            if (pipeisclosed(p[0])) {
+  800288:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80028b:	41 ff d4             	call   *%r12
+  80028e:	85 c0                	test   %eax,%eax
+  800290:	74 e5                	je     800277 <umain+0x252>
+                cprintf("RACE: pipe appears closed\n");
+  800292:	4c 89 ff             	mov    %r15,%rdi
+  800295:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029a:	41 ff d6             	call   *%r14
+                exit();
+  80029d:	41 ff d5             	call   *%r13
+  8002a0:	eb d5                	jmp    800277 <umain+0x252>
+        ipc_recv(0, 0, 0, 0);
+  8002a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b6:	48 b8 d4 1a 80 00 00 	movabs $0x801ad4,%rax
+  8002bd:	00 00 00 
+  8002c0:	ff d0                	call   *%rax
+  8002c2:	e9 c3 fd ff ff       	jmp    80008a <umain+0x65>
+        panic("somehow the other end of p[0] got closed!");
+  8002c7:	48 ba e8 2f 80 00 00 	movabs $0x802fe8,%rdx
+  8002ce:	00 00 00 
+  8002d1:	be 38 00 00 00       	mov    $0x38,%esi
+  8002d6:	48 bf 52 2f 80 00 00 	movabs $0x802f52,%rdi
+  8002dd:	00 00 00 
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	48 b9 0d 04 80 00 00 	movabs $0x80040d,%rcx
+  8002ec:	00 00 00 
+  8002ef:	ff d1                	call   *%rcx
+        panic("cannot look up p[0]: %i", r);
+  8002f1:	89 c1                	mov    %eax,%ecx
+  8002f3:	48 ba b6 2f 80 00 00 	movabs $0x802fb6,%rdx
+  8002fa:	00 00 00 
+  8002fd:	be 3a 00 00 00       	mov    $0x3a,%esi
+  800302:	48 bf 52 2f 80 00 00 	movabs $0x802f52,%rdi
+  800309:	00 00 00 
+  80030c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800311:	49 b8 0d 04 80 00 00 	movabs $0x80040d,%r8
+  800318:	00 00 00 
+  80031b:	41 ff d0             	call   *%r8
+        cprintf("\nrace didn't happen (number of tests: %d)\n", max);
+  80031e:	be c8 00 00 00       	mov    $0xc8,%esi
+  800323:	48 bf 18 30 80 00 00 	movabs $0x803018,%rdi
+  80032a:	00 00 00 
+  80032d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800332:	48 ba 5d 05 80 00 00 	movabs $0x80055d,%rdx
+  800339:	00 00 00 
+  80033c:	ff d2                	call   *%rdx
+}
+  80033e:	e9 8d fe ff ff       	jmp    8001d0 <umain+0x1ab>
+
+0000000000800343 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800343:	55                   	push   %rbp
+  800344:	48 89 e5             	mov    %rsp,%rbp
+  800347:	41 56                	push   %r14
+  800349:	41 55                	push   %r13
+  80034b:	41 54                	push   %r12
+  80034d:	53                   	push   %rbx
+  80034e:	41 89 fd             	mov    %edi,%r13d
+  800351:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800354:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80035b:	00 00 00 
+  80035e:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800365:	00 00 00 
+  800368:	48 39 c2             	cmp    %rax,%rdx
+  80036b:	73 17                	jae    800384 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80036d:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800370:	49 89 c4             	mov    %rax,%r12
+  800373:	48 83 c3 08          	add    $0x8,%rbx
+  800377:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037c:	ff 53 f8             	call   *-0x8(%rbx)
+  80037f:	4c 39 e3             	cmp    %r12,%rbx
+  800382:	72 ef                	jb     800373 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800384:	48 b8 72 13 80 00 00 	movabs $0x801372,%rax
+  80038b:	00 00 00 
+  80038e:	ff d0                	call   *%rax
+  800390:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800393:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80039a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003a1:	00 00 00 
+  8003a4:	48 01 d0             	add    %rdx,%rax
+  8003a7:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8003ae:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003b1:	45 85 ed             	test   %r13d,%r13d
+  8003b4:	7e 0d                	jle    8003c3 <libmain+0x80>
+  8003b6:	49 8b 06             	mov    (%r14),%rax
+  8003b9:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8003c0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003c3:	4c 89 f6             	mov    %r14,%rsi
+  8003c6:	44 89 ef             	mov    %r13d,%edi
+  8003c9:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8003d0:	00 00 00 
+  8003d3:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8003d5:	48 b8 ea 03 80 00 00 	movabs $0x8003ea,%rax
+  8003dc:	00 00 00 
+  8003df:	ff d0                	call   *%rax
+#endif
+}
+  8003e1:	5b                   	pop    %rbx
+  8003e2:	41 5c                	pop    %r12
+  8003e4:	41 5d                	pop    %r13
+  8003e6:	41 5e                	pop    %r14
+  8003e8:	5d                   	pop    %rbp
+  8003e9:	c3                   	ret
+
+00000000008003ea <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003ea:	55                   	push   %rbp
+  8003eb:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8003ee:	48 b8 7f 1e 80 00 00 	movabs $0x801e7f,%rax
+  8003f5:	00 00 00 
+  8003f8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8003fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003ff:	48 b8 07 13 80 00 00 	movabs $0x801307,%rax
+  800406:	00 00 00 
+  800409:	ff d0                	call   *%rax
+}
+  80040b:	5d                   	pop    %rbp
+  80040c:	c3                   	ret
+
+000000000080040d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80040d:	55                   	push   %rbp
+  80040e:	48 89 e5             	mov    %rsp,%rbp
+  800411:	41 56                	push   %r14
+  800413:	41 55                	push   %r13
+  800415:	41 54                	push   %r12
+  800417:	53                   	push   %rbx
+  800418:	48 83 ec 50          	sub    $0x50,%rsp
+  80041c:	49 89 fc             	mov    %rdi,%r12
+  80041f:	41 89 f5             	mov    %esi,%r13d
+  800422:	48 89 d3             	mov    %rdx,%rbx
+  800425:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800429:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80042d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800431:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800438:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80043c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800440:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800444:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800448:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80044f:	00 00 00 
+  800452:	4c 8b 30             	mov    (%rax),%r14
+  800455:	48 b8 72 13 80 00 00 	movabs $0x801372,%rax
+  80045c:	00 00 00 
+  80045f:	ff d0                	call   *%rax
+  800461:	89 c6                	mov    %eax,%esi
+  800463:	45 89 e8             	mov    %r13d,%r8d
+  800466:	4c 89 e1             	mov    %r12,%rcx
+  800469:	4c 89 f2             	mov    %r14,%rdx
+  80046c:	48 bf 50 30 80 00 00 	movabs $0x803050,%rdi
+  800473:	00 00 00 
+  800476:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047b:	49 bc 5d 05 80 00 00 	movabs $0x80055d,%r12
+  800482:	00 00 00 
+  800485:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800488:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80048c:	48 89 df             	mov    %rbx,%rdi
+  80048f:	48 b8 f9 04 80 00 00 	movabs $0x8004f9,%rax
+  800496:	00 00 00 
+  800499:	ff d0                	call   *%rax
+    cprintf("\n");
+  80049b:	48 bf 47 2f 80 00 00 	movabs $0x802f47,%rdi
+  8004a2:	00 00 00 
+  8004a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004aa:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004ad:	cc                   	int3
+  8004ae:	eb fd                	jmp    8004ad <_panic+0xa0>
+
+00000000008004b0 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004b0:	55                   	push   %rbp
+  8004b1:	48 89 e5             	mov    %rsp,%rbp
+  8004b4:	53                   	push   %rbx
+  8004b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004b9:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004bc:	8b 06                	mov    (%rsi),%eax
+  8004be:	8d 50 01             	lea    0x1(%rax),%edx
+  8004c1:	89 16                	mov    %edx,(%rsi)
+  8004c3:	48 98                	cltq
+  8004c5:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004ca:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004d0:	74 0a                	je     8004dc <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004d2:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8004d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004da:	c9                   	leave
+  8004db:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8004dc:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8004e0:	be ff 00 00 00       	mov    $0xff,%esi
+  8004e5:	48 b8 a9 12 80 00 00 	movabs $0x8012a9,%rax
+  8004ec:	00 00 00 
+  8004ef:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004f1:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004f7:	eb d9                	jmp    8004d2 <putch+0x22>
+
+00000000008004f9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004f9:	55                   	push   %rbp
+  8004fa:	48 89 e5             	mov    %rsp,%rbp
+  8004fd:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800504:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800507:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80050e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800513:	b8 00 00 00 00       	mov    $0x0,%eax
+  800518:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80051b:	48 89 f1             	mov    %rsi,%rcx
+  80051e:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800525:	48 bf b0 04 80 00 00 	movabs $0x8004b0,%rdi
+  80052c:	00 00 00 
+  80052f:	48 b8 ad 06 80 00 00 	movabs $0x8006ad,%rax
+  800536:	00 00 00 
+  800539:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80053b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800542:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800549:	48 b8 a9 12 80 00 00 	movabs $0x8012a9,%rax
+  800550:	00 00 00 
+  800553:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800555:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80055b:	c9                   	leave
+  80055c:	c3                   	ret
+
+000000000080055d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80055d:	55                   	push   %rbp
+  80055e:	48 89 e5             	mov    %rsp,%rbp
+  800561:	48 83 ec 50          	sub    $0x50,%rsp
+  800565:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800569:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80056d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800571:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800575:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800579:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800580:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800584:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800588:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80058c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800590:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800594:	48 b8 f9 04 80 00 00 	movabs $0x8004f9,%rax
+  80059b:	00 00 00 
+  80059e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005a0:	c9                   	leave
+  8005a1:	c3                   	ret
+
+00000000008005a2 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005a2:	55                   	push   %rbp
+  8005a3:	48 89 e5             	mov    %rsp,%rbp
+  8005a6:	41 57                	push   %r15
+  8005a8:	41 56                	push   %r14
+  8005aa:	41 55                	push   %r13
+  8005ac:	41 54                	push   %r12
+  8005ae:	53                   	push   %rbx
+  8005af:	48 83 ec 18          	sub    $0x18,%rsp
+  8005b3:	49 89 fc             	mov    %rdi,%r12
+  8005b6:	49 89 f5             	mov    %rsi,%r13
+  8005b9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005bd:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005c0:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005c3:	41 89 cf             	mov    %ecx,%r15d
+  8005c6:	4c 39 fa             	cmp    %r15,%rdx
+  8005c9:	73 5b                	jae    800626 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005cb:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8005cf:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005d3:	85 db                	test   %ebx,%ebx
+  8005d5:	7e 0e                	jle    8005e5 <print_num+0x43>
+            putch(padc, put_arg);
+  8005d7:	4c 89 ee             	mov    %r13,%rsi
+  8005da:	44 89 f7             	mov    %r14d,%edi
+  8005dd:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8005e0:	83 eb 01             	sub    $0x1,%ebx
+  8005e3:	75 f2                	jne    8005d7 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8005e5:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8005e9:	48 b9 84 30 80 00 00 	movabs $0x803084,%rcx
+  8005f0:	00 00 00 
+  8005f3:	48 b8 73 30 80 00 00 	movabs $0x803073,%rax
+  8005fa:	00 00 00 
+  8005fd:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800601:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800605:	ba 00 00 00 00       	mov    $0x0,%edx
+  80060a:	49 f7 f7             	div    %r15
+  80060d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800611:	4c 89 ee             	mov    %r13,%rsi
+  800614:	41 ff d4             	call   *%r12
+}
+  800617:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80061b:	5b                   	pop    %rbx
+  80061c:	41 5c                	pop    %r12
+  80061e:	41 5d                	pop    %r13
+  800620:	41 5e                	pop    %r14
+  800622:	41 5f                	pop    %r15
+  800624:	5d                   	pop    %rbp
+  800625:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800626:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80062a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80062f:	49 f7 f7             	div    %r15
+  800632:	48 83 ec 08          	sub    $0x8,%rsp
+  800636:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80063a:	52                   	push   %rdx
+  80063b:	45 0f be c9          	movsbl %r9b,%r9d
+  80063f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800643:	48 89 c2             	mov    %rax,%rdx
+  800646:	48 b8 a2 05 80 00 00 	movabs $0x8005a2,%rax
+  80064d:	00 00 00 
+  800650:	ff d0                	call   *%rax
+  800652:	48 83 c4 10          	add    $0x10,%rsp
+  800656:	eb 8d                	jmp    8005e5 <print_num+0x43>
+
+0000000000800658 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800658:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80065c:	48 8b 06             	mov    (%rsi),%rax
+  80065f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800663:	73 0a                	jae    80066f <sprintputch+0x17>
+        *state->start++ = ch;
+  800665:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800669:	48 89 16             	mov    %rdx,(%rsi)
+  80066c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80066f:	c3                   	ret
+
+0000000000800670 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800670:	55                   	push   %rbp
+  800671:	48 89 e5             	mov    %rsp,%rbp
+  800674:	48 83 ec 50          	sub    $0x50,%rsp
+  800678:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80067c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800680:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800684:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80068b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80068f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800693:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800697:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80069b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80069f:	48 b8 ad 06 80 00 00 	movabs $0x8006ad,%rax
+  8006a6:	00 00 00 
+  8006a9:	ff d0                	call   *%rax
+}
+  8006ab:	c9                   	leave
+  8006ac:	c3                   	ret
+
+00000000008006ad <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006ad:	55                   	push   %rbp
+  8006ae:	48 89 e5             	mov    %rsp,%rbp
+  8006b1:	41 57                	push   %r15
+  8006b3:	41 56                	push   %r14
+  8006b5:	41 55                	push   %r13
+  8006b7:	41 54                	push   %r12
+  8006b9:	53                   	push   %rbx
+  8006ba:	48 83 ec 38          	sub    $0x38,%rsp
+  8006be:	49 89 fe             	mov    %rdi,%r14
+  8006c1:	49 89 f5             	mov    %rsi,%r13
+  8006c4:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006c7:	48 8b 01             	mov    (%rcx),%rax
+  8006ca:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8006ce:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d6:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8006da:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8006de:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8006e2:	0f b6 3b             	movzbl (%rbx),%edi
+  8006e5:	40 80 ff 25          	cmp    $0x25,%dil
+  8006e9:	74 18                	je     800703 <vprintfmt+0x56>
+            if (!ch) return;
+  8006eb:	40 84 ff             	test   %dil,%dil
+  8006ee:	0f 84 b1 06 00 00    	je     800da5 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8006f4:	40 0f b6 ff          	movzbl %dil,%edi
+  8006f8:	4c 89 ee             	mov    %r13,%rsi
+  8006fb:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006fe:	4c 89 e3             	mov    %r12,%rbx
+  800701:	eb db                	jmp    8006de <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800703:	be 00 00 00 00       	mov    $0x0,%esi
+  800708:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80070c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800711:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800717:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80071e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800722:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800727:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80072c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80072f:	83 e8 23             	sub    $0x23,%eax
+  800732:	3c 57                	cmp    $0x57,%al
+  800734:	0f 87 51 06 00 00    	ja     800d8b <vprintfmt+0x6de>
+  80073a:	0f b6 c0             	movzbl %al,%eax
+  80073d:	48 b9 20 32 80 00 00 	movabs $0x803220,%rcx
+  800744:	00 00 00 
+  800747:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80074a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80074d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800751:	eb cf                	jmp    800722 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800753:	49 89 dc             	mov    %rbx,%r12
+  800756:	be 01 00 00 00       	mov    $0x1,%esi
+  80075b:	eb c5                	jmp    800722 <vprintfmt+0x75>
+            padc = ch;
+  80075d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800761:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800764:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800767:	eb b9                	jmp    800722 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800769:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076c:	83 f8 2f             	cmp    $0x2f,%eax
+  80076f:	77 24                	ja     800795 <vprintfmt+0xe8>
+  800771:	89 c1                	mov    %eax,%ecx
+  800773:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800777:	83 c0 08             	add    $0x8,%eax
+  80077a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800780:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800783:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800787:	79 99                	jns    800722 <vprintfmt+0x75>
+                width = precision;
+  800789:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80078d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800793:	eb 8d                	jmp    800722 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800795:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800799:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80079d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a1:	eb da                	jmp    80077d <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007a3:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007a8:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007ac:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007b2:	3c 39                	cmp    $0x39,%al
+  8007b4:	77 1c                	ja     8007d2 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007b6:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007ba:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007be:	0f b6 c0             	movzbl %al,%eax
+  8007c1:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007c6:	0f b6 03             	movzbl (%rbx),%eax
+  8007c9:	3c 39                	cmp    $0x39,%al
+  8007cb:	76 e9                	jbe    8007b6 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007cd:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007d0:	eb b1                	jmp    800783 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007d2:	49 89 dc             	mov    %rbx,%r12
+  8007d5:	eb ac                	jmp    800783 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8007d7:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007da:	85 c9                	test   %ecx,%ecx
+  8007dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e1:	0f 49 c1             	cmovns %ecx,%eax
+  8007e4:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8007e7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007ea:	e9 33 ff ff ff       	jmp    800722 <vprintfmt+0x75>
+            lflag++;
+  8007ef:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007f2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007f5:	e9 28 ff ff ff       	jmp    800722 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fd:	83 f8 2f             	cmp    $0x2f,%eax
+  800800:	77 19                	ja     80081b <vprintfmt+0x16e>
+  800802:	89 c2                	mov    %eax,%edx
+  800804:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800808:	83 c0 08             	add    $0x8,%eax
+  80080b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080e:	8b 3a                	mov    (%rdx),%edi
+  800810:	4c 89 ee             	mov    %r13,%rsi
+  800813:	41 ff d6             	call   *%r14
+            break;
+  800816:	e9 c3 fe ff ff       	jmp    8006de <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80081b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80081f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800823:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800827:	eb e5                	jmp    80080e <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800829:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082c:	83 f8 2f             	cmp    $0x2f,%eax
+  80082f:	77 5a                	ja     80088b <vprintfmt+0x1de>
+  800831:	89 c2                	mov    %eax,%edx
+  800833:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800837:	83 c0 08             	add    $0x8,%eax
+  80083a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80083d:	8b 02                	mov    (%rdx),%eax
+  80083f:	89 c1                	mov    %eax,%ecx
+  800841:	f7 d9                	neg    %ecx
+  800843:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800846:	83 f9 15             	cmp    $0x15,%ecx
+  800849:	7f 4e                	jg     800899 <vprintfmt+0x1ec>
+  80084b:	48 63 c1             	movslq %ecx,%rax
+  80084e:	48 ba e0 34 80 00 00 	movabs $0x8034e0,%rdx
+  800855:	00 00 00 
+  800858:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80085c:	48 85 c0             	test   %rax,%rax
+  80085f:	74 38                	je     800899 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800861:	48 89 c1             	mov    %rax,%rcx
+  800864:	48 ba f9 36 80 00 00 	movabs $0x8036f9,%rdx
+  80086b:	00 00 00 
+  80086e:	4c 89 ee             	mov    %r13,%rsi
+  800871:	4c 89 f7             	mov    %r14,%rdi
+  800874:	b8 00 00 00 00       	mov    $0x0,%eax
+  800879:	49 b8 70 06 80 00 00 	movabs $0x800670,%r8
+  800880:	00 00 00 
+  800883:	41 ff d0             	call   *%r8
+  800886:	e9 53 fe ff ff       	jmp    8006de <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80088b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800893:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800897:	eb a4                	jmp    80083d <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800899:	48 ba 9c 30 80 00 00 	movabs $0x80309c,%rdx
+  8008a0:	00 00 00 
+  8008a3:	4c 89 ee             	mov    %r13,%rsi
+  8008a6:	4c 89 f7             	mov    %r14,%rdi
+  8008a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ae:	49 b8 70 06 80 00 00 	movabs $0x800670,%r8
+  8008b5:	00 00 00 
+  8008b8:	41 ff d0             	call   *%r8
+  8008bb:	e9 1e fe ff ff       	jmp    8006de <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c6:	77 6c                	ja     800934 <vprintfmt+0x287>
+  8008c8:	89 c2                	mov    %eax,%edx
+  8008ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ce:	83 c0 08             	add    $0x8,%eax
+  8008d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d4:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8008d7:	48 85 d2             	test   %rdx,%rdx
+  8008da:	48 b8 95 30 80 00 00 	movabs $0x803095,%rax
+  8008e1:	00 00 00 
+  8008e4:	48 0f 45 c2          	cmovne %rdx,%rax
+  8008e8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8008ec:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008f0:	7e 06                	jle    8008f8 <vprintfmt+0x24b>
+  8008f2:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8008f6:	75 4a                	jne    800942 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008f8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008fc:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800900:	0f b6 00             	movzbl (%rax),%eax
+  800903:	84 c0                	test   %al,%al
+  800905:	0f 85 9a 00 00 00    	jne    8009a5 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80090b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80090e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800912:	85 c0                	test   %eax,%eax
+  800914:	0f 8e c4 fd ff ff    	jle    8006de <vprintfmt+0x31>
+  80091a:	4c 89 ee             	mov    %r13,%rsi
+  80091d:	bf 20 00 00 00       	mov    $0x20,%edi
+  800922:	41 ff d6             	call   *%r14
+  800925:	41 83 ec 01          	sub    $0x1,%r12d
+  800929:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80092d:	75 eb                	jne    80091a <vprintfmt+0x26d>
+  80092f:	e9 aa fd ff ff       	jmp    8006de <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800934:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800938:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800940:	eb 92                	jmp    8008d4 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800942:	49 63 f7             	movslq %r15d,%rsi
+  800945:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800949:	48 b8 5f 0e 80 00 00 	movabs $0x800e5f,%rax
+  800950:	00 00 00 
+  800953:	ff d0                	call   *%rax
+  800955:	48 89 c2             	mov    %rax,%rdx
+  800958:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80095b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80095d:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800960:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800963:	85 c0                	test   %eax,%eax
+  800965:	7e 91                	jle    8008f8 <vprintfmt+0x24b>
+  800967:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80096c:	4c 89 ee             	mov    %r13,%rsi
+  80096f:	44 89 e7             	mov    %r12d,%edi
+  800972:	41 ff d6             	call   *%r14
+  800975:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800979:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80097c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80097f:	75 eb                	jne    80096c <vprintfmt+0x2bf>
+  800981:	e9 72 ff ff ff       	jmp    8008f8 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800986:	0f b6 f8             	movzbl %al,%edi
+  800989:	4c 89 ee             	mov    %r13,%rsi
+  80098c:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80098f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800993:	49 83 c4 01          	add    $0x1,%r12
+  800997:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80099d:	84 c0                	test   %al,%al
+  80099f:	0f 84 66 ff ff ff    	je     80090b <vprintfmt+0x25e>
+  8009a5:	45 85 ff             	test   %r15d,%r15d
+  8009a8:	78 0a                	js     8009b4 <vprintfmt+0x307>
+  8009aa:	41 83 ef 01          	sub    $0x1,%r15d
+  8009ae:	0f 88 57 ff ff ff    	js     80090b <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009b4:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009b8:	74 cc                	je     800986 <vprintfmt+0x2d9>
+  8009ba:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009bd:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009c2:	80 fa 5e             	cmp    $0x5e,%dl
+  8009c5:	77 c2                	ja     800989 <vprintfmt+0x2dc>
+  8009c7:	eb bd                	jmp    800986 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c9:	40 84 f6             	test   %sil,%sil
+  8009cc:	75 26                	jne    8009f4 <vprintfmt+0x347>
+    switch (lflag) {
+  8009ce:	85 d2                	test   %edx,%edx
+  8009d0:	74 59                	je     800a2b <vprintfmt+0x37e>
+  8009d2:	83 fa 01             	cmp    $0x1,%edx
+  8009d5:	74 7b                	je     800a52 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8009d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009da:	83 f8 2f             	cmp    $0x2f,%eax
+  8009dd:	0f 87 96 00 00 00    	ja     800a79 <vprintfmt+0x3cc>
+  8009e3:	89 c2                	mov    %eax,%edx
+  8009e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e9:	83 c0 08             	add    $0x8,%eax
+  8009ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ef:	4c 8b 22             	mov    (%rdx),%r12
+  8009f2:	eb 17                	jmp    800a0b <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fa:	77 21                	ja     800a1d <vprintfmt+0x370>
+  8009fc:	89 c2                	mov    %eax,%edx
+  8009fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a02:	83 c0 08             	add    $0x8,%eax
+  800a05:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a08:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a0b:	4d 85 e4             	test   %r12,%r12
+  800a0e:	78 7a                	js     800a8a <vprintfmt+0x3dd>
+            num = i;
+  800a10:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a13:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a18:	e9 50 02 00 00       	jmp    800c6d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a21:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a29:	eb dd                	jmp    800a08 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a31:	77 11                	ja     800a44 <vprintfmt+0x397>
+  800a33:	89 c2                	mov    %eax,%edx
+  800a35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a39:	83 c0 08             	add    $0x8,%eax
+  800a3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3f:	4c 63 22             	movslq (%rdx),%r12
+  800a42:	eb c7                	jmp    800a0b <vprintfmt+0x35e>
+  800a44:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a48:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a50:	eb ed                	jmp    800a3f <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a52:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a55:	83 f8 2f             	cmp    $0x2f,%eax
+  800a58:	77 11                	ja     800a6b <vprintfmt+0x3be>
+  800a5a:	89 c2                	mov    %eax,%edx
+  800a5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a60:	83 c0 08             	add    $0x8,%eax
+  800a63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a66:	4c 8b 22             	mov    (%rdx),%r12
+  800a69:	eb a0                	jmp    800a0b <vprintfmt+0x35e>
+  800a6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a77:	eb ed                	jmp    800a66 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a85:	e9 65 ff ff ff       	jmp    8009ef <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a8a:	4c 89 ee             	mov    %r13,%rsi
+  800a8d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a92:	41 ff d6             	call   *%r14
+                i = -i;
+  800a95:	49 f7 dc             	neg    %r12
+  800a98:	e9 73 ff ff ff       	jmp    800a10 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a9d:	40 84 f6             	test   %sil,%sil
+  800aa0:	75 32                	jne    800ad4 <vprintfmt+0x427>
+    switch (lflag) {
+  800aa2:	85 d2                	test   %edx,%edx
+  800aa4:	74 5d                	je     800b03 <vprintfmt+0x456>
+  800aa6:	83 fa 01             	cmp    $0x1,%edx
+  800aa9:	0f 84 82 00 00 00    	je     800b31 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800aaf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab5:	0f 87 a5 00 00 00    	ja     800b60 <vprintfmt+0x4b3>
+  800abb:	89 c2                	mov    %eax,%edx
+  800abd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac1:	83 c0 08             	add    $0x8,%eax
+  800ac4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800aca:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800acf:	e9 99 01 00 00       	jmp    800c6d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ad4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad7:	83 f8 2f             	cmp    $0x2f,%eax
+  800ada:	77 19                	ja     800af5 <vprintfmt+0x448>
+  800adc:	89 c2                	mov    %eax,%edx
+  800ade:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae2:	83 c0 08             	add    $0x8,%eax
+  800ae5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800aeb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800af0:	e9 78 01 00 00       	jmp    800c6d <vprintfmt+0x5c0>
+  800af5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800afd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b01:	eb e5                	jmp    800ae8 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b03:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b06:	83 f8 2f             	cmp    $0x2f,%eax
+  800b09:	77 18                	ja     800b23 <vprintfmt+0x476>
+  800b0b:	89 c2                	mov    %eax,%edx
+  800b0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b11:	83 c0 08             	add    $0x8,%eax
+  800b14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b17:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b19:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b1e:	e9 4a 01 00 00       	jmp    800c6d <vprintfmt+0x5c0>
+  800b23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2f:	eb e6                	jmp    800b17 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b34:	83 f8 2f             	cmp    $0x2f,%eax
+  800b37:	77 19                	ja     800b52 <vprintfmt+0x4a5>
+  800b39:	89 c2                	mov    %eax,%edx
+  800b3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3f:	83 c0 08             	add    $0x8,%eax
+  800b42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b45:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b48:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b4d:	e9 1b 01 00 00       	jmp    800c6d <vprintfmt+0x5c0>
+  800b52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b5e:	eb e5                	jmp    800b45 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6c:	e9 56 ff ff ff       	jmp    800ac7 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b71:	40 84 f6             	test   %sil,%sil
+  800b74:	75 2e                	jne    800ba4 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b76:	85 d2                	test   %edx,%edx
+  800b78:	74 59                	je     800bd3 <vprintfmt+0x526>
+  800b7a:	83 fa 01             	cmp    $0x1,%edx
+  800b7d:	74 7f                	je     800bfe <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b7f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b82:	83 f8 2f             	cmp    $0x2f,%eax
+  800b85:	0f 87 9f 00 00 00    	ja     800c2a <vprintfmt+0x57d>
+  800b8b:	89 c2                	mov    %eax,%edx
+  800b8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b91:	83 c0 08             	add    $0x8,%eax
+  800b94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b97:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b9a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b9f:	e9 c9 00 00 00       	jmp    800c6d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ba4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba7:	83 f8 2f             	cmp    $0x2f,%eax
+  800baa:	77 19                	ja     800bc5 <vprintfmt+0x518>
+  800bac:	89 c2                	mov    %eax,%edx
+  800bae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb2:	83 c0 08             	add    $0x8,%eax
+  800bb5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bbb:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bc0:	e9 a8 00 00 00       	jmp    800c6d <vprintfmt+0x5c0>
+  800bc5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bcd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd1:	eb e5                	jmp    800bb8 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800bd3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bd6:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd9:	77 15                	ja     800bf0 <vprintfmt+0x543>
+  800bdb:	89 c2                	mov    %eax,%edx
+  800bdd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be1:	83 c0 08             	add    $0x8,%eax
+  800be4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800be7:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800be9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800bee:	eb 7d                	jmp    800c6d <vprintfmt+0x5c0>
+  800bf0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bfc:	eb e9                	jmp    800be7 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800bfe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c01:	83 f8 2f             	cmp    $0x2f,%eax
+  800c04:	77 16                	ja     800c1c <vprintfmt+0x56f>
+  800c06:	89 c2                	mov    %eax,%edx
+  800c08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0c:	83 c0 08             	add    $0x8,%eax
+  800c0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c12:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c15:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c1a:	eb 51                	jmp    800c6d <vprintfmt+0x5c0>
+  800c1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c28:	eb e8                	jmp    800c12 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c36:	e9 5c ff ff ff       	jmp    800b97 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c3b:	4c 89 ee             	mov    %r13,%rsi
+  800c3e:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c43:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c46:	4c 89 ee             	mov    %r13,%rsi
+  800c49:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c4e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c51:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c54:	83 f8 2f             	cmp    $0x2f,%eax
+  800c57:	77 47                	ja     800ca0 <vprintfmt+0x5f3>
+  800c59:	89 c2                	mov    %eax,%edx
+  800c5b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c5f:	83 c0 08             	add    $0x8,%eax
+  800c62:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c65:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c68:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c6d:	48 83 ec 08          	sub    $0x8,%rsp
+  800c71:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c75:	0f 94 c0             	sete   %al
+  800c78:	0f b6 c0             	movzbl %al,%eax
+  800c7b:	50                   	push   %rax
+  800c7c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c81:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c85:	4c 89 ee             	mov    %r13,%rsi
+  800c88:	4c 89 f7             	mov    %r14,%rdi
+  800c8b:	48 b8 a2 05 80 00 00 	movabs $0x8005a2,%rax
+  800c92:	00 00 00 
+  800c95:	ff d0                	call   *%rax
+            break;
+  800c97:	48 83 c4 10          	add    $0x10,%rsp
+  800c9b:	e9 3e fa ff ff       	jmp    8006de <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ca0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cac:	eb b7                	jmp    800c65 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800cae:	40 84 f6             	test   %sil,%sil
+  800cb1:	75 2b                	jne    800cde <vprintfmt+0x631>
+    switch (lflag) {
+  800cb3:	85 d2                	test   %edx,%edx
+  800cb5:	74 56                	je     800d0d <vprintfmt+0x660>
+  800cb7:	83 fa 01             	cmp    $0x1,%edx
+  800cba:	74 7f                	je     800d3b <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800cbc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cbf:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc2:	0f 87 a2 00 00 00    	ja     800d6a <vprintfmt+0x6bd>
+  800cc8:	89 c2                	mov    %eax,%edx
+  800cca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cce:	83 c0 08             	add    $0x8,%eax
+  800cd1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cd7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cdc:	eb 8f                	jmp    800c6d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800cde:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce4:	77 19                	ja     800cff <vprintfmt+0x652>
+  800ce6:	89 c2                	mov    %eax,%edx
+  800ce8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cec:	83 c0 08             	add    $0x8,%eax
+  800cef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cf5:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cfa:	e9 6e ff ff ff       	jmp    800c6d <vprintfmt+0x5c0>
+  800cff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d03:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d07:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d0b:	eb e5                	jmp    800cf2 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d10:	83 f8 2f             	cmp    $0x2f,%eax
+  800d13:	77 18                	ja     800d2d <vprintfmt+0x680>
+  800d15:	89 c2                	mov    %eax,%edx
+  800d17:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d1b:	83 c0 08             	add    $0x8,%eax
+  800d1e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d21:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d23:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d28:	e9 40 ff ff ff       	jmp    800c6d <vprintfmt+0x5c0>
+  800d2d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d31:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d35:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d39:	eb e6                	jmp    800d21 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d3e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d41:	77 19                	ja     800d5c <vprintfmt+0x6af>
+  800d43:	89 c2                	mov    %eax,%edx
+  800d45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d49:	83 c0 08             	add    $0x8,%eax
+  800d4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d4f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d52:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d57:	e9 11 ff ff ff       	jmp    800c6d <vprintfmt+0x5c0>
+  800d5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d68:	eb e5                	jmp    800d4f <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d6e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d76:	e9 59 ff ff ff       	jmp    800cd4 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d7b:	4c 89 ee             	mov    %r13,%rsi
+  800d7e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d83:	41 ff d6             	call   *%r14
+            break;
+  800d86:	e9 53 f9 ff ff       	jmp    8006de <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d8b:	4c 89 ee             	mov    %r13,%rsi
+  800d8e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d93:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d96:	48 83 eb 01          	sub    $0x1,%rbx
+  800d9a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d9e:	75 f6                	jne    800d96 <vprintfmt+0x6e9>
+  800da0:	e9 39 f9 ff ff       	jmp    8006de <vprintfmt+0x31>
+}
+  800da5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800da9:	5b                   	pop    %rbx
+  800daa:	41 5c                	pop    %r12
+  800dac:	41 5d                	pop    %r13
+  800dae:	41 5e                	pop    %r14
+  800db0:	41 5f                	pop    %r15
+  800db2:	5d                   	pop    %rbp
+  800db3:	c3                   	ret
+
+0000000000800db4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800db4:	55                   	push   %rbp
+  800db5:	48 89 e5             	mov    %rsp,%rbp
+  800db8:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800dbc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800dc0:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800dc5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800dc9:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800dd0:	48 85 ff             	test   %rdi,%rdi
+  800dd3:	74 2b                	je     800e00 <vsnprintf+0x4c>
+  800dd5:	48 85 f6             	test   %rsi,%rsi
+  800dd8:	74 26                	je     800e00 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800dda:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800dde:	48 bf 58 06 80 00 00 	movabs $0x800658,%rdi
+  800de5:	00 00 00 
+  800de8:	48 b8 ad 06 80 00 00 	movabs $0x8006ad,%rax
+  800def:	00 00 00 
+  800df2:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800df4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800df8:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800dfb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800dfe:	c9                   	leave
+  800dff:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e05:	eb f7                	jmp    800dfe <vsnprintf+0x4a>
+
+0000000000800e07 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e07:	55                   	push   %rbp
+  800e08:	48 89 e5             	mov    %rsp,%rbp
+  800e0b:	48 83 ec 50          	sub    $0x50,%rsp
+  800e0f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e13:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e17:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e1b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e22:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e26:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e2a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e2e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e32:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e36:	48 b8 b4 0d 80 00 00 	movabs $0x800db4,%rax
+  800e3d:	00 00 00 
+  800e40:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e42:	c9                   	leave
+  800e43:	c3                   	ret
+
+0000000000800e44 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e44:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e47:	74 10                	je     800e59 <strlen+0x15>
+    size_t n = 0;
+  800e49:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e4e:	48 83 c0 01          	add    $0x1,%rax
+  800e52:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e56:	75 f6                	jne    800e4e <strlen+0xa>
+  800e58:	c3                   	ret
+    size_t n = 0;
+  800e59:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e5e:	c3                   	ret
+
+0000000000800e5f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e5f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e62:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e67:	48 85 f6             	test   %rsi,%rsi
+  800e6a:	74 11                	je     800e7d <strnlen+0x1e>
+  800e6c:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e70:	74 0c                	je     800e7e <strnlen+0x1f>
+  800e72:	48 83 c2 01          	add    $0x1,%rdx
+  800e76:	48 39 d0             	cmp    %rdx,%rax
+  800e79:	75 f1                	jne    800e6c <strnlen+0xd>
+  800e7b:	eb 04                	jmp    800e81 <strnlen+0x22>
+  800e7d:	c3                   	ret
+  800e7e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e81:	c3                   	ret
+
+0000000000800e82 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e82:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e85:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e8a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e8e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e91:	48 83 c2 01          	add    $0x1,%rdx
+  800e95:	84 c9                	test   %cl,%cl
+  800e97:	75 f1                	jne    800e8a <strcpy+0x8>
+        ;
+    return res;
+}
+  800e99:	c3                   	ret
+
+0000000000800e9a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e9a:	55                   	push   %rbp
+  800e9b:	48 89 e5             	mov    %rsp,%rbp
+  800e9e:	41 54                	push   %r12
+  800ea0:	53                   	push   %rbx
+  800ea1:	48 89 fb             	mov    %rdi,%rbx
+  800ea4:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ea7:	48 b8 44 0e 80 00 00 	movabs $0x800e44,%rax
+  800eae:	00 00 00 
+  800eb1:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800eb3:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800eb7:	4c 89 e6             	mov    %r12,%rsi
+  800eba:	48 b8 82 0e 80 00 00 	movabs $0x800e82,%rax
+  800ec1:	00 00 00 
+  800ec4:	ff d0                	call   *%rax
+    return dst;
+}
+  800ec6:	48 89 d8             	mov    %rbx,%rax
+  800ec9:	5b                   	pop    %rbx
+  800eca:	41 5c                	pop    %r12
+  800ecc:	5d                   	pop    %rbp
+  800ecd:	c3                   	ret
+
+0000000000800ece <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ece:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ed1:	48 85 d2             	test   %rdx,%rdx
+  800ed4:	74 1f                	je     800ef5 <strncpy+0x27>
+  800ed6:	48 01 fa             	add    %rdi,%rdx
+  800ed9:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800edc:	48 83 c1 01          	add    $0x1,%rcx
+  800ee0:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ee4:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ee8:	41 80 f8 01          	cmp    $0x1,%r8b
+  800eec:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ef0:	48 39 ca             	cmp    %rcx,%rdx
+  800ef3:	75 e7                	jne    800edc <strncpy+0xe>
+    }
+    return ret;
+}
+  800ef5:	c3                   	ret
+
+0000000000800ef6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ef6:	48 89 f8             	mov    %rdi,%rax
+  800ef9:	48 85 d2             	test   %rdx,%rdx
+  800efc:	74 24                	je     800f22 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800efe:	48 83 ea 01          	sub    $0x1,%rdx
+  800f02:	74 1b                	je     800f1f <strlcpy+0x29>
+  800f04:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f08:	0f b6 16             	movzbl (%rsi),%edx
+  800f0b:	84 d2                	test   %dl,%dl
+  800f0d:	74 10                	je     800f1f <strlcpy+0x29>
+            *dst++ = *src++;
+  800f0f:	48 83 c6 01          	add    $0x1,%rsi
+  800f13:	48 83 c0 01          	add    $0x1,%rax
+  800f17:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f1a:	48 39 c8             	cmp    %rcx,%rax
+  800f1d:	75 e9                	jne    800f08 <strlcpy+0x12>
+        *dst = '\0';
+  800f1f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f22:	48 29 f8             	sub    %rdi,%rax
+}
+  800f25:	c3                   	ret
+
+0000000000800f26 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f26:	0f b6 07             	movzbl (%rdi),%eax
+  800f29:	84 c0                	test   %al,%al
+  800f2b:	74 13                	je     800f40 <strcmp+0x1a>
+  800f2d:	38 06                	cmp    %al,(%rsi)
+  800f2f:	75 0f                	jne    800f40 <strcmp+0x1a>
+  800f31:	48 83 c7 01          	add    $0x1,%rdi
+  800f35:	48 83 c6 01          	add    $0x1,%rsi
+  800f39:	0f b6 07             	movzbl (%rdi),%eax
+  800f3c:	84 c0                	test   %al,%al
+  800f3e:	75 ed                	jne    800f2d <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f40:	0f b6 c0             	movzbl %al,%eax
+  800f43:	0f b6 16             	movzbl (%rsi),%edx
+  800f46:	29 d0                	sub    %edx,%eax
+}
+  800f48:	c3                   	ret
+
+0000000000800f49 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f49:	48 85 d2             	test   %rdx,%rdx
+  800f4c:	74 1f                	je     800f6d <strncmp+0x24>
+  800f4e:	0f b6 07             	movzbl (%rdi),%eax
+  800f51:	84 c0                	test   %al,%al
+  800f53:	74 1e                	je     800f73 <strncmp+0x2a>
+  800f55:	3a 06                	cmp    (%rsi),%al
+  800f57:	75 1a                	jne    800f73 <strncmp+0x2a>
+  800f59:	48 83 c7 01          	add    $0x1,%rdi
+  800f5d:	48 83 c6 01          	add    $0x1,%rsi
+  800f61:	48 83 ea 01          	sub    $0x1,%rdx
+  800f65:	75 e7                	jne    800f4e <strncmp+0x5>
+
+    if (!n) return 0;
+  800f67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6c:	c3                   	ret
+  800f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f72:	c3                   	ret
+  800f73:	48 85 d2             	test   %rdx,%rdx
+  800f76:	74 09                	je     800f81 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f78:	0f b6 07             	movzbl (%rdi),%eax
+  800f7b:	0f b6 16             	movzbl (%rsi),%edx
+  800f7e:	29 d0                	sub    %edx,%eax
+  800f80:	c3                   	ret
+    if (!n) return 0;
+  800f81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f86:	c3                   	ret
+
+0000000000800f87 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f87:	0f b6 17             	movzbl (%rdi),%edx
+  800f8a:	84 d2                	test   %dl,%dl
+  800f8c:	74 18                	je     800fa6 <strchr+0x1f>
+        if (*str == c) {
+  800f8e:	0f be d2             	movsbl %dl,%edx
+  800f91:	39 f2                	cmp    %esi,%edx
+  800f93:	74 17                	je     800fac <strchr+0x25>
+    for (; *str; str++) {
+  800f95:	48 83 c7 01          	add    $0x1,%rdi
+  800f99:	0f b6 17             	movzbl (%rdi),%edx
+  800f9c:	84 d2                	test   %dl,%dl
+  800f9e:	75 ee                	jne    800f8e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa5:	c3                   	ret
+  800fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fab:	c3                   	ret
+  800fac:	48 89 f8             	mov    %rdi,%rax
+}
+  800faf:	c3                   	ret
+
+0000000000800fb0 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fb0:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800fb3:	0f b6 17             	movzbl (%rdi),%edx
+  800fb6:	84 d2                	test   %dl,%dl
+  800fb8:	74 13                	je     800fcd <strfind+0x1d>
+  800fba:	0f be d2             	movsbl %dl,%edx
+  800fbd:	39 f2                	cmp    %esi,%edx
+  800fbf:	74 0b                	je     800fcc <strfind+0x1c>
+  800fc1:	48 83 c0 01          	add    $0x1,%rax
+  800fc5:	0f b6 10             	movzbl (%rax),%edx
+  800fc8:	84 d2                	test   %dl,%dl
+  800fca:	75 ee                	jne    800fba <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800fcc:	c3                   	ret
+  800fcd:	c3                   	ret
+
+0000000000800fce <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800fce:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800fd1:	48 89 f8             	mov    %rdi,%rax
+  800fd4:	48 f7 d8             	neg    %rax
+  800fd7:	83 e0 07             	and    $0x7,%eax
+  800fda:	49 89 d1             	mov    %rdx,%r9
+  800fdd:	49 29 c1             	sub    %rax,%r9
+  800fe0:	78 36                	js     801018 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800fe2:	40 0f b6 c6          	movzbl %sil,%eax
+  800fe6:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800fed:	01 01 01 
+  800ff0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ff4:	40 f6 c7 07          	test   $0x7,%dil
+  800ff8:	75 38                	jne    801032 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ffa:	4c 89 c9             	mov    %r9,%rcx
+  800ffd:	48 c1 f9 03          	sar    $0x3,%rcx
+  801001:	74 0c                	je     80100f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801003:	fc                   	cld
+  801004:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801007:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80100b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80100f:	4d 85 c9             	test   %r9,%r9
+  801012:	75 45                	jne    801059 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801014:	4c 89 c0             	mov    %r8,%rax
+  801017:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801018:	48 85 d2             	test   %rdx,%rdx
+  80101b:	74 f7                	je     801014 <memset+0x46>
+  80101d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801020:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801023:	48 83 c0 01          	add    $0x1,%rax
+  801027:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80102b:	48 39 c2             	cmp    %rax,%rdx
+  80102e:	75 f3                	jne    801023 <memset+0x55>
+  801030:	eb e2                	jmp    801014 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801032:	40 f6 c7 01          	test   $0x1,%dil
+  801036:	74 06                	je     80103e <memset+0x70>
+  801038:	88 07                	mov    %al,(%rdi)
+  80103a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80103e:	40 f6 c7 02          	test   $0x2,%dil
+  801042:	74 07                	je     80104b <memset+0x7d>
+  801044:	66 89 07             	mov    %ax,(%rdi)
+  801047:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80104b:	40 f6 c7 04          	test   $0x4,%dil
+  80104f:	74 a9                	je     800ffa <memset+0x2c>
+  801051:	89 07                	mov    %eax,(%rdi)
+  801053:	48 83 c7 04          	add    $0x4,%rdi
+  801057:	eb a1                	jmp    800ffa <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801059:	41 f6 c1 04          	test   $0x4,%r9b
+  80105d:	74 06                	je     801065 <memset+0x97>
+  80105f:	89 07                	mov    %eax,(%rdi)
+  801061:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801065:	41 f6 c1 02          	test   $0x2,%r9b
+  801069:	74 07                	je     801072 <memset+0xa4>
+  80106b:	66 89 07             	mov    %ax,(%rdi)
+  80106e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801072:	41 f6 c1 01          	test   $0x1,%r9b
+  801076:	74 9c                	je     801014 <memset+0x46>
+  801078:	88 07                	mov    %al,(%rdi)
+  80107a:	eb 98                	jmp    801014 <memset+0x46>
+
+000000000080107c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80107c:	48 89 f8             	mov    %rdi,%rax
+  80107f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801082:	48 39 fe             	cmp    %rdi,%rsi
+  801085:	73 3b                	jae    8010c2 <memmove+0x46>
+  801087:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80108b:	48 39 d7             	cmp    %rdx,%rdi
+  80108e:	73 32                	jae    8010c2 <memmove+0x46>
+        s += n;
+        d += n;
+  801090:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801094:	48 89 d6             	mov    %rdx,%rsi
+  801097:	48 09 fe             	or     %rdi,%rsi
+  80109a:	48 09 ce             	or     %rcx,%rsi
+  80109d:	40 f6 c6 07          	test   $0x7,%sil
+  8010a1:	75 12                	jne    8010b5 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010a3:	48 83 ef 08          	sub    $0x8,%rdi
+  8010a7:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010ab:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010af:	fd                   	std
+  8010b0:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010b3:	fc                   	cld
+  8010b4:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010b5:	48 83 ef 01          	sub    $0x1,%rdi
+  8010b9:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010bd:	fd                   	std
+  8010be:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010c0:	eb f1                	jmp    8010b3 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010c2:	48 89 f2             	mov    %rsi,%rdx
+  8010c5:	48 09 c2             	or     %rax,%rdx
+  8010c8:	48 09 ca             	or     %rcx,%rdx
+  8010cb:	f6 c2 07             	test   $0x7,%dl
+  8010ce:	75 0c                	jne    8010dc <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010d0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010d4:	48 89 c7             	mov    %rax,%rdi
+  8010d7:	fc                   	cld
+  8010d8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8010db:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8010dc:	48 89 c7             	mov    %rax,%rdi
+  8010df:	fc                   	cld
+  8010e0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8010e2:	c3                   	ret
+
+00000000008010e3 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8010e3:	55                   	push   %rbp
+  8010e4:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8010e7:	48 b8 7c 10 80 00 00 	movabs $0x80107c,%rax
+  8010ee:	00 00 00 
+  8010f1:	ff d0                	call   *%rax
+}
+  8010f3:	5d                   	pop    %rbp
+  8010f4:	c3                   	ret
+
+00000000008010f5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010f5:	55                   	push   %rbp
+  8010f6:	48 89 e5             	mov    %rsp,%rbp
+  8010f9:	41 57                	push   %r15
+  8010fb:	41 56                	push   %r14
+  8010fd:	41 55                	push   %r13
+  8010ff:	41 54                	push   %r12
+  801101:	53                   	push   %rbx
+  801102:	48 83 ec 08          	sub    $0x8,%rsp
+  801106:	49 89 fe             	mov    %rdi,%r14
+  801109:	49 89 f7             	mov    %rsi,%r15
+  80110c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80110f:	48 89 f7             	mov    %rsi,%rdi
+  801112:	48 b8 44 0e 80 00 00 	movabs $0x800e44,%rax
+  801119:	00 00 00 
+  80111c:	ff d0                	call   *%rax
+  80111e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801121:	48 89 de             	mov    %rbx,%rsi
+  801124:	4c 89 f7             	mov    %r14,%rdi
+  801127:	48 b8 5f 0e 80 00 00 	movabs $0x800e5f,%rax
+  80112e:	00 00 00 
+  801131:	ff d0                	call   *%rax
+  801133:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801136:	48 39 c3             	cmp    %rax,%rbx
+  801139:	74 36                	je     801171 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80113b:	48 89 d8             	mov    %rbx,%rax
+  80113e:	4c 29 e8             	sub    %r13,%rax
+  801141:	49 39 c4             	cmp    %rax,%r12
+  801144:	73 31                	jae    801177 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801146:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80114b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80114f:	4c 89 fe             	mov    %r15,%rsi
+  801152:	48 b8 e3 10 80 00 00 	movabs $0x8010e3,%rax
+  801159:	00 00 00 
+  80115c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80115e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801162:	48 83 c4 08          	add    $0x8,%rsp
+  801166:	5b                   	pop    %rbx
+  801167:	41 5c                	pop    %r12
+  801169:	41 5d                	pop    %r13
+  80116b:	41 5e                	pop    %r14
+  80116d:	41 5f                	pop    %r15
+  80116f:	5d                   	pop    %rbp
+  801170:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801171:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801175:	eb eb                	jmp    801162 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801177:	48 83 eb 01          	sub    $0x1,%rbx
+  80117b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80117f:	48 89 da             	mov    %rbx,%rdx
+  801182:	4c 89 fe             	mov    %r15,%rsi
+  801185:	48 b8 e3 10 80 00 00 	movabs $0x8010e3,%rax
+  80118c:	00 00 00 
+  80118f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801191:	49 01 de             	add    %rbx,%r14
+  801194:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801199:	eb c3                	jmp    80115e <strlcat+0x69>
+
+000000000080119b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80119b:	48 85 d2             	test   %rdx,%rdx
+  80119e:	74 2d                	je     8011cd <memcmp+0x32>
+  8011a0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011a5:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011a9:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011ae:	44 38 c1             	cmp    %r8b,%cl
+  8011b1:	75 0f                	jne    8011c2 <memcmp+0x27>
+    while (n-- > 0) {
+  8011b3:	48 83 c0 01          	add    $0x1,%rax
+  8011b7:	48 39 c2             	cmp    %rax,%rdx
+  8011ba:	75 e9                	jne    8011a5 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c1:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011c2:	0f b6 c1             	movzbl %cl,%eax
+  8011c5:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011c9:	44 29 c0             	sub    %r8d,%eax
+  8011cc:	c3                   	ret
+    return 0;
+  8011cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011d2:	c3                   	ret
+
+00000000008011d3 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011d3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011d7:	48 39 c7             	cmp    %rax,%rdi
+  8011da:	73 0f                	jae    8011eb <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8011dc:	40 38 37             	cmp    %sil,(%rdi)
+  8011df:	74 0e                	je     8011ef <memfind+0x1c>
+    for (; src < end; src++) {
+  8011e1:	48 83 c7 01          	add    $0x1,%rdi
+  8011e5:	48 39 f8             	cmp    %rdi,%rax
+  8011e8:	75 f2                	jne    8011dc <memfind+0x9>
+  8011ea:	c3                   	ret
+  8011eb:	48 89 f8             	mov    %rdi,%rax
+  8011ee:	c3                   	ret
+  8011ef:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011f2:	c3                   	ret
+
+00000000008011f3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011f3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011f6:	0f b6 37             	movzbl (%rdi),%esi
+  8011f9:	40 80 fe 20          	cmp    $0x20,%sil
+  8011fd:	74 06                	je     801205 <strtol+0x12>
+  8011ff:	40 80 fe 09          	cmp    $0x9,%sil
+  801203:	75 13                	jne    801218 <strtol+0x25>
+  801205:	48 83 c7 01          	add    $0x1,%rdi
+  801209:	0f b6 37             	movzbl (%rdi),%esi
+  80120c:	40 80 fe 20          	cmp    $0x20,%sil
+  801210:	74 f3                	je     801205 <strtol+0x12>
+  801212:	40 80 fe 09          	cmp    $0x9,%sil
+  801216:	74 ed                	je     801205 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801218:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80121b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80121e:	3c 01                	cmp    $0x1,%al
+  801220:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801224:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80122a:	75 0f                	jne    80123b <strtol+0x48>
+  80122c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80122f:	74 14                	je     801245 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801231:	85 d2                	test   %edx,%edx
+  801233:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801238:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80123b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801240:	4c 63 ca             	movslq %edx,%r9
+  801243:	eb 36                	jmp    80127b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801245:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801249:	74 0f                	je     80125a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80124b:	85 d2                	test   %edx,%edx
+  80124d:	75 ec                	jne    80123b <strtol+0x48>
+        s++;
+  80124f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801253:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801258:	eb e1                	jmp    80123b <strtol+0x48>
+        s += 2;
+  80125a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80125e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801263:	eb d6                	jmp    80123b <strtol+0x48>
+            dig -= '0';
+  801265:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801268:	44 0f b6 c1          	movzbl %cl,%r8d
+  80126c:	41 39 d0             	cmp    %edx,%r8d
+  80126f:	7d 21                	jge    801292 <strtol+0x9f>
+        val = val * base + dig;
+  801271:	49 0f af c1          	imul   %r9,%rax
+  801275:	0f b6 c9             	movzbl %cl,%ecx
+  801278:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80127b:	48 83 c7 01          	add    $0x1,%rdi
+  80127f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801283:	80 f9 39             	cmp    $0x39,%cl
+  801286:	76 dd                	jbe    801265 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801288:	80 f9 7b             	cmp    $0x7b,%cl
+  80128b:	77 05                	ja     801292 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80128d:	83 e9 57             	sub    $0x57,%ecx
+  801290:	eb d6                	jmp    801268 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801292:	4d 85 d2             	test   %r10,%r10
+  801295:	74 03                	je     80129a <strtol+0xa7>
+  801297:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80129a:	48 89 c2             	mov    %rax,%rdx
+  80129d:	48 f7 da             	neg    %rdx
+  8012a0:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012a4:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012a8:	c3                   	ret
+
+00000000008012a9 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8012a9:	55                   	push   %rbp
+  8012aa:	48 89 e5             	mov    %rsp,%rbp
+  8012ad:	53                   	push   %rbx
+  8012ae:	48 89 fa             	mov    %rdi,%rdx
+  8012b1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b4:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ce:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d4:	c9                   	leave
+  8012d5:	c3                   	ret
+
+00000000008012d6 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8012d6:	55                   	push   %rbp
+  8012d7:	48 89 e5             	mov    %rsp,%rbp
+  8012da:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012db:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ff:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801301:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801305:	c9                   	leave
+  801306:	c3                   	ret
+
+0000000000801307 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801307:	55                   	push   %rbp
+  801308:	48 89 e5             	mov    %rsp,%rbp
+  80130b:	53                   	push   %rbx
+  80130c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801310:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801313:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801318:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80131d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801322:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801327:	be 00 00 00 00       	mov    $0x0,%esi
+  80132c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801332:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801334:	48 85 c0             	test   %rax,%rax
+  801337:	7f 06                	jg     80133f <sys_env_destroy+0x38>
+}
+  801339:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80133d:	c9                   	leave
+  80133e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80133f:	49 89 c0             	mov    %rax,%r8
+  801342:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801347:	48 ba b0 35 80 00 00 	movabs $0x8035b0,%rdx
+  80134e:	00 00 00 
+  801351:	be 26 00 00 00       	mov    $0x26,%esi
+  801356:	48 bf cf 35 80 00 00 	movabs $0x8035cf,%rdi
+  80135d:	00 00 00 
+  801360:	b8 00 00 00 00       	mov    $0x0,%eax
+  801365:	49 b9 0d 04 80 00 00 	movabs $0x80040d,%r9
+  80136c:	00 00 00 
+  80136f:	41 ff d1             	call   *%r9
+
+0000000000801372 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801372:	55                   	push   %rbp
+  801373:	48 89 e5             	mov    %rsp,%rbp
+  801376:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801377:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80137c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801381:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801386:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801390:	be 00 00 00 00       	mov    $0x0,%esi
+  801395:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80139b:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80139d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a1:	c9                   	leave
+  8013a2:	c3                   	ret
+
+00000000008013a3 <sys_yield>:
+
+void
+sys_yield(void) {
+  8013a3:	55                   	push   %rbp
+  8013a4:	48 89 e5             	mov    %rsp,%rbp
+  8013a7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a8:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013cc:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d2:	c9                   	leave
+  8013d3:	c3                   	ret
+
+00000000008013d4 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8013d4:	55                   	push   %rbp
+  8013d5:	48 89 e5             	mov    %rsp,%rbp
+  8013d8:	53                   	push   %rbx
+  8013d9:	48 89 fa             	mov    %rdi,%rdx
+  8013dc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013df:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013e4:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8013eb:	00 00 00 
+  8013ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013fe:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801400:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801404:	c9                   	leave
+  801405:	c3                   	ret
+
+0000000000801406 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801406:	55                   	push   %rbp
+  801407:	48 89 e5             	mov    %rsp,%rbp
+  80140a:	53                   	push   %rbx
+  80140b:	49 89 f8             	mov    %rdi,%r8
+  80140e:	48 89 d3             	mov    %rdx,%rbx
+  801411:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801414:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801419:	4c 89 c2             	mov    %r8,%rdx
+  80141c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80141f:	be 00 00 00 00       	mov    $0x0,%esi
+  801424:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80142a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80142c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801430:	c9                   	leave
+  801431:	c3                   	ret
+
+0000000000801432 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801432:	55                   	push   %rbp
+  801433:	48 89 e5             	mov    %rsp,%rbp
+  801436:	53                   	push   %rbx
+  801437:	48 83 ec 08          	sub    $0x8,%rsp
+  80143b:	89 f8                	mov    %edi,%eax
+  80143d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801440:	48 63 f9             	movslq %ecx,%rdi
+  801443:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801446:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80144b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80144e:	be 00 00 00 00       	mov    $0x0,%esi
+  801453:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801459:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80145b:	48 85 c0             	test   %rax,%rax
+  80145e:	7f 06                	jg     801466 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801460:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801464:	c9                   	leave
+  801465:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801466:	49 89 c0             	mov    %rax,%r8
+  801469:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80146e:	48 ba b0 35 80 00 00 	movabs $0x8035b0,%rdx
+  801475:	00 00 00 
+  801478:	be 26 00 00 00       	mov    $0x26,%esi
+  80147d:	48 bf cf 35 80 00 00 	movabs $0x8035cf,%rdi
+  801484:	00 00 00 
+  801487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148c:	49 b9 0d 04 80 00 00 	movabs $0x80040d,%r9
+  801493:	00 00 00 
+  801496:	41 ff d1             	call   *%r9
+
+0000000000801499 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801499:	55                   	push   %rbp
+  80149a:	48 89 e5             	mov    %rsp,%rbp
+  80149d:	53                   	push   %rbx
+  80149e:	48 83 ec 08          	sub    $0x8,%rsp
+  8014a2:	89 f8                	mov    %edi,%eax
+  8014a4:	49 89 f2             	mov    %rsi,%r10
+  8014a7:	48 89 cf             	mov    %rcx,%rdi
+  8014aa:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8014ad:	48 63 da             	movslq %edx,%rbx
+  8014b0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b3:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014b8:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014bb:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8014be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c0:	48 85 c0             	test   %rax,%rax
+  8014c3:	7f 06                	jg     8014cb <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c9:	c9                   	leave
+  8014ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014cb:	49 89 c0             	mov    %rax,%r8
+  8014ce:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014d3:	48 ba b0 35 80 00 00 	movabs $0x8035b0,%rdx
+  8014da:	00 00 00 
+  8014dd:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e2:	48 bf cf 35 80 00 00 	movabs $0x8035cf,%rdi
+  8014e9:	00 00 00 
+  8014ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f1:	49 b9 0d 04 80 00 00 	movabs $0x80040d,%r9
+  8014f8:	00 00 00 
+  8014fb:	41 ff d1             	call   *%r9
+
+00000000008014fe <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8014fe:	55                   	push   %rbp
+  8014ff:	48 89 e5             	mov    %rsp,%rbp
+  801502:	53                   	push   %rbx
+  801503:	48 83 ec 08          	sub    $0x8,%rsp
+  801507:	48 89 f1             	mov    %rsi,%rcx
+  80150a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80150d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801510:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801515:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80151a:	be 00 00 00 00       	mov    $0x0,%esi
+  80151f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801525:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801527:	48 85 c0             	test   %rax,%rax
+  80152a:	7f 06                	jg     801532 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80152c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801530:	c9                   	leave
+  801531:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801532:	49 89 c0             	mov    %rax,%r8
+  801535:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80153a:	48 ba b0 35 80 00 00 	movabs $0x8035b0,%rdx
+  801541:	00 00 00 
+  801544:	be 26 00 00 00       	mov    $0x26,%esi
+  801549:	48 bf cf 35 80 00 00 	movabs $0x8035cf,%rdi
+  801550:	00 00 00 
+  801553:	b8 00 00 00 00       	mov    $0x0,%eax
+  801558:	49 b9 0d 04 80 00 00 	movabs $0x80040d,%r9
+  80155f:	00 00 00 
+  801562:	41 ff d1             	call   *%r9
+
+0000000000801565 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801565:	55                   	push   %rbp
+  801566:	48 89 e5             	mov    %rsp,%rbp
+  801569:	53                   	push   %rbx
+  80156a:	48 83 ec 08          	sub    $0x8,%rsp
+  80156e:	89 f8                	mov    %edi,%eax
+  801570:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801573:	48 63 f9             	movslq %ecx,%rdi
+  801576:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801579:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80157e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801581:	be 00 00 00 00       	mov    $0x0,%esi
+  801586:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80158c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80158e:	48 85 c0             	test   %rax,%rax
+  801591:	7f 06                	jg     801599 <sys_region_advise+0x34>
+}
+  801593:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801597:	c9                   	leave
+  801598:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801599:	49 89 c0             	mov    %rax,%r8
+  80159c:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8015a1:	48 ba b0 35 80 00 00 	movabs $0x8035b0,%rdx
+  8015a8:	00 00 00 
+  8015ab:	be 26 00 00 00       	mov    $0x26,%esi
+  8015b0:	48 bf cf 35 80 00 00 	movabs $0x8035cf,%rdi
+  8015b7:	00 00 00 
+  8015ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015bf:	49 b9 0d 04 80 00 00 	movabs $0x80040d,%r9
+  8015c6:	00 00 00 
+  8015c9:	41 ff d1             	call   *%r9
+
+00000000008015cc <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  8015cc:	55                   	push   %rbp
+  8015cd:	48 89 e5             	mov    %rsp,%rbp
+  8015d0:	53                   	push   %rbx
+  8015d1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  8015d5:	48 63 ce             	movslq %esi,%rcx
+  8015d8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015db:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015f7:	48 85 c0             	test   %rax,%rax
+  8015fa:	7f 06                	jg     801602 <sys_env_set_nice+0x36>
+}
+  8015fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801600:	c9                   	leave
+  801601:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801602:	49 89 c0             	mov    %rax,%r8
+  801605:	b9 15 00 00 00       	mov    $0x15,%ecx
+  80160a:	48 ba b0 35 80 00 00 	movabs $0x8035b0,%rdx
+  801611:	00 00 00 
+  801614:	be 26 00 00 00       	mov    $0x26,%esi
+  801619:	48 bf cf 35 80 00 00 	movabs $0x8035cf,%rdi
+  801620:	00 00 00 
+  801623:	b8 00 00 00 00       	mov    $0x0,%eax
+  801628:	49 b9 0d 04 80 00 00 	movabs $0x80040d,%r9
+  80162f:	00 00 00 
+  801632:	41 ff d1             	call   *%r9
+
+0000000000801635 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801635:	55                   	push   %rbp
+  801636:	48 89 e5             	mov    %rsp,%rbp
+  801639:	53                   	push   %rbx
+  80163a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80163e:	48 63 ce             	movslq %esi,%rcx
+  801641:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801644:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801649:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801653:	be 00 00 00 00       	mov    $0x0,%esi
+  801658:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80165e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801660:	48 85 c0             	test   %rax,%rax
+  801663:	7f 06                	jg     80166b <sys_env_set_status+0x36>
+}
+  801665:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801669:	c9                   	leave
+  80166a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80166b:	49 89 c0             	mov    %rax,%r8
+  80166e:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801673:	48 ba b0 35 80 00 00 	movabs $0x8035b0,%rdx
+  80167a:	00 00 00 
+  80167d:	be 26 00 00 00       	mov    $0x26,%esi
+  801682:	48 bf cf 35 80 00 00 	movabs $0x8035cf,%rdi
+  801689:	00 00 00 
+  80168c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801691:	49 b9 0d 04 80 00 00 	movabs $0x80040d,%r9
+  801698:	00 00 00 
+  80169b:	41 ff d1             	call   *%r9
+
+000000000080169e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80169e:	55                   	push   %rbp
+  80169f:	48 89 e5             	mov    %rsp,%rbp
+  8016a2:	53                   	push   %rbx
+  8016a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8016a7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016aa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ad:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016c9:	48 85 c0             	test   %rax,%rax
+  8016cc:	7f 06                	jg     8016d4 <sys_env_set_trapframe+0x36>
+}
+  8016ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d2:	c9                   	leave
+  8016d3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016d4:	49 89 c0             	mov    %rax,%r8
+  8016d7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8016dc:	48 ba b0 35 80 00 00 	movabs $0x8035b0,%rdx
+  8016e3:	00 00 00 
+  8016e6:	be 26 00 00 00       	mov    $0x26,%esi
+  8016eb:	48 bf cf 35 80 00 00 	movabs $0x8035cf,%rdi
+  8016f2:	00 00 00 
+  8016f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fa:	49 b9 0d 04 80 00 00 	movabs $0x80040d,%r9
+  801701:	00 00 00 
+  801704:	41 ff d1             	call   *%r9
+
+0000000000801707 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801707:	55                   	push   %rbp
+  801708:	48 89 e5             	mov    %rsp,%rbp
+  80170b:	53                   	push   %rbx
+  80170c:	48 83 ec 08          	sub    $0x8,%rsp
+  801710:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801713:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801716:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80171b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801720:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801725:	be 00 00 00 00       	mov    $0x0,%esi
+  80172a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801730:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801732:	48 85 c0             	test   %rax,%rax
+  801735:	7f 06                	jg     80173d <sys_env_set_pgfault_upcall+0x36>
+}
+  801737:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80173b:	c9                   	leave
+  80173c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80173d:	49 89 c0             	mov    %rax,%r8
+  801740:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801745:	48 ba b0 35 80 00 00 	movabs $0x8035b0,%rdx
+  80174c:	00 00 00 
+  80174f:	be 26 00 00 00       	mov    $0x26,%esi
+  801754:	48 bf cf 35 80 00 00 	movabs $0x8035cf,%rdi
+  80175b:	00 00 00 
+  80175e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801763:	49 b9 0d 04 80 00 00 	movabs $0x80040d,%r9
+  80176a:	00 00 00 
+  80176d:	41 ff d1             	call   *%r9
+
+0000000000801770 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801770:	55                   	push   %rbp
+  801771:	48 89 e5             	mov    %rsp,%rbp
+  801774:	53                   	push   %rbx
+  801775:	89 f8                	mov    %edi,%eax
+  801777:	49 89 f1             	mov    %rsi,%r9
+  80177a:	48 89 d3             	mov    %rdx,%rbx
+  80177d:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801780:	49 63 f0             	movslq %r8d,%rsi
+  801783:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801786:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80178b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80178e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801794:	cd 30                	int    $0x30
+}
+  801796:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80179a:	c9                   	leave
+  80179b:	c3                   	ret
+
+000000000080179c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80179c:	55                   	push   %rbp
+  80179d:	48 89 e5             	mov    %rsp,%rbp
+  8017a0:	53                   	push   %rbx
+  8017a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8017a5:	48 89 fa             	mov    %rdi,%rdx
+  8017a8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8017bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017c7:	48 85 c0             	test   %rax,%rax
+  8017ca:	7f 06                	jg     8017d2 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017d0:	c9                   	leave
+  8017d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017d2:	49 89 c0             	mov    %rax,%r8
+  8017d5:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8017da:	48 ba b0 35 80 00 00 	movabs $0x8035b0,%rdx
+  8017e1:	00 00 00 
+  8017e4:	be 26 00 00 00       	mov    $0x26,%esi
+  8017e9:	48 bf cf 35 80 00 00 	movabs $0x8035cf,%rdi
+  8017f0:	00 00 00 
+  8017f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f8:	49 b9 0d 04 80 00 00 	movabs $0x80040d,%r9
+  8017ff:	00 00 00 
+  801802:	41 ff d1             	call   *%r9
+
+0000000000801805 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801805:	55                   	push   %rbp
+  801806:	48 89 e5             	mov    %rsp,%rbp
+  801809:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80180a:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80180f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801814:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801819:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80181e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801823:	be 00 00 00 00       	mov    $0x0,%esi
+  801828:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80182e:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801830:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801834:	c9                   	leave
+  801835:	c3                   	ret
+
+0000000000801836 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  801836:	55                   	push   %rbp
+  801837:	48 89 e5             	mov    %rsp,%rbp
+  80183a:	53                   	push   %rbx
+  80183b:	48 83 ec 08          	sub    $0x8,%rsp
+  80183f:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801842:	48 63 ce             	movslq %esi,%rcx
+  801845:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801848:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80184d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801852:	be 00 00 00 00       	mov    $0x0,%esi
+  801857:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80185d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80185f:	48 85 c0             	test   %rax,%rax
+  801862:	7f 06                	jg     80186a <sys_sigqueue+0x34>
+}
+  801864:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801868:	c9                   	leave
+  801869:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80186a:	49 89 c0             	mov    %rax,%r8
+  80186d:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801872:	48 ba b0 35 80 00 00 	movabs $0x8035b0,%rdx
+  801879:	00 00 00 
+  80187c:	be 26 00 00 00       	mov    $0x26,%esi
+  801881:	48 bf cf 35 80 00 00 	movabs $0x8035cf,%rdi
+  801888:	00 00 00 
+  80188b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801890:	49 b9 0d 04 80 00 00 	movabs $0x80040d,%r9
+  801897:	00 00 00 
+  80189a:	41 ff d1             	call   *%r9
+
+000000000080189d <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  80189d:	55                   	push   %rbp
+  80189e:	48 89 e5             	mov    %rsp,%rbp
+  8018a1:	53                   	push   %rbx
+  8018a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8018a6:	48 89 fa             	mov    %rdi,%rdx
+  8018a9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018ac:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018c6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018c8:	48 85 c0             	test   %rax,%rax
+  8018cb:	7f 06                	jg     8018d3 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  8018cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018d1:	c9                   	leave
+  8018d2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018d3:	49 89 c0             	mov    %rax,%r8
+  8018d6:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8018db:	48 ba b0 35 80 00 00 	movabs $0x8035b0,%rdx
+  8018e2:	00 00 00 
+  8018e5:	be 26 00 00 00       	mov    $0x26,%esi
+  8018ea:	48 bf cf 35 80 00 00 	movabs $0x8035cf,%rdi
+  8018f1:	00 00 00 
+  8018f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f9:	49 b9 0d 04 80 00 00 	movabs $0x80040d,%r9
+  801900:	00 00 00 
+  801903:	41 ff d1             	call   *%r9
+
+0000000000801906 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801906:	55                   	push   %rbp
+  801907:	48 89 e5             	mov    %rsp,%rbp
+  80190a:	53                   	push   %rbx
+  80190b:	48 83 ec 08          	sub    $0x8,%rsp
+  80190f:	48 89 f1             	mov    %rsi,%rcx
+  801912:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801915:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801918:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80191d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801922:	be 00 00 00 00       	mov    $0x0,%esi
+  801927:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80192d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80192f:	48 85 c0             	test   %rax,%rax
+  801932:	7f 06                	jg     80193a <sys_sigaction+0x34>
+}
+  801934:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801938:	c9                   	leave
+  801939:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80193a:	49 89 c0             	mov    %rax,%r8
+  80193d:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801942:	48 ba b0 35 80 00 00 	movabs $0x8035b0,%rdx
+  801949:	00 00 00 
+  80194c:	be 26 00 00 00       	mov    $0x26,%esi
+  801951:	48 bf cf 35 80 00 00 	movabs $0x8035cf,%rdi
+  801958:	00 00 00 
+  80195b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801960:	49 b9 0d 04 80 00 00 	movabs $0x80040d,%r9
+  801967:	00 00 00 
+  80196a:	41 ff d1             	call   *%r9
+
+000000000080196d <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  80196d:	55                   	push   %rbp
+  80196e:	48 89 e5             	mov    %rsp,%rbp
+  801971:	53                   	push   %rbx
+  801972:	48 83 ec 08          	sub    $0x8,%rsp
+  801976:	48 89 f1             	mov    %rsi,%rcx
+  801979:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  80197c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80197f:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801984:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801989:	be 00 00 00 00       	mov    $0x0,%esi
+  80198e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801994:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801996:	48 85 c0             	test   %rax,%rax
+  801999:	7f 06                	jg     8019a1 <sys_sigprocmask+0x34>
+}
+  80199b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80199f:	c9                   	leave
+  8019a0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019a1:	49 89 c0             	mov    %rax,%r8
+  8019a4:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8019a9:	48 ba b0 35 80 00 00 	movabs $0x8035b0,%rdx
+  8019b0:	00 00 00 
+  8019b3:	be 26 00 00 00       	mov    $0x26,%esi
+  8019b8:	48 bf cf 35 80 00 00 	movabs $0x8035cf,%rdi
+  8019bf:	00 00 00 
+  8019c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c7:	49 b9 0d 04 80 00 00 	movabs $0x80040d,%r9
+  8019ce:	00 00 00 
+  8019d1:	41 ff d1             	call   *%r9
+
+00000000008019d4 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8019d4:	55                   	push   %rbp
+  8019d5:	48 89 e5             	mov    %rsp,%rbp
+  8019d8:	41 54                	push   %r12
+  8019da:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8019db:	b8 08 00 00 00       	mov    $0x8,%eax
+  8019e0:	cd 30                	int    $0x30
+  8019e2:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  8019e5:	85 c0                	test   %eax,%eax
+  8019e7:	78 76                	js     801a5f <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  8019e9:	74 7c                	je     801a67 <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  8019eb:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8019f1:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8019f8:	00 00 00 
+  8019fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a00:	89 c2                	mov    %eax,%edx
+  801a02:	be 00 00 00 00       	mov    $0x0,%esi
+  801a07:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a0c:	48 b8 99 14 80 00 00 	movabs $0x801499,%rax
+  801a13:	00 00 00 
+  801a16:	ff d0                	call   *%rax
+  801a18:	85 c0                	test   %eax,%eax
+  801a1a:	75 7a                	jne    801a96 <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  801a1c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a23:	00 00 00 
+  801a26:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801a2d:	44 89 e7             	mov    %r12d,%edi
+  801a30:	48 b8 07 17 80 00 00 	movabs $0x801707,%rax
+  801a37:	00 00 00 
+  801a3a:	ff d0                	call   *%rax
+  801a3c:	85 c0                	test   %eax,%eax
+  801a3e:	75 5e                	jne    801a9e <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  801a40:	be 02 00 00 00       	mov    $0x2,%esi
+  801a45:	44 89 e7             	mov    %r12d,%edi
+  801a48:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  801a4f:	00 00 00 
+  801a52:	ff d0                	call   *%rax
+        return -1;
+  801a54:	85 c0                	test   %eax,%eax
+  801a56:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801a5b:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  801a5f:	44 89 e0             	mov    %r12d,%eax
+  801a62:	5b                   	pop    %rbx
+  801a63:	41 5c                	pop    %r12
+  801a65:	5d                   	pop    %rbp
+  801a66:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  801a67:	48 b8 72 13 80 00 00 	movabs $0x801372,%rax
+  801a6e:	00 00 00 
+  801a71:	ff d0                	call   *%rax
+  801a73:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  801a76:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  801a7d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801a84:	00 00 00 
+  801a87:	48 01 d0             	add    %rdx,%rax
+  801a8a:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  801a91:	00 00 00 
+        return 0;
+  801a94:	eb c9                	jmp    801a5f <fork+0x8b>
+        return -1;
+  801a96:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801a9c:	eb c1                	jmp    801a5f <fork+0x8b>
+        return -1;
+  801a9e:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801aa4:	eb b9                	jmp    801a5f <fork+0x8b>
+
+0000000000801aa6 <sfork>:
+
+envid_t
+sfork() {
+  801aa6:	55                   	push   %rbp
+  801aa7:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801aaa:	48 ba dd 35 80 00 00 	movabs $0x8035dd,%rdx
+  801ab1:	00 00 00 
+  801ab4:	be 2e 00 00 00       	mov    $0x2e,%esi
+  801ab9:	48 bf f8 35 80 00 00 	movabs $0x8035f8,%rdi
+  801ac0:	00 00 00 
+  801ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac8:	48 b9 0d 04 80 00 00 	movabs $0x80040d,%rcx
+  801acf:	00 00 00 
+  801ad2:	ff d1                	call   *%rcx
+
+0000000000801ad4 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801ad4:	55                   	push   %rbp
+  801ad5:	48 89 e5             	mov    %rsp,%rbp
+  801ad8:	41 54                	push   %r12
+  801ada:	53                   	push   %rbx
+  801adb:	48 89 fb             	mov    %rdi,%rbx
+  801ade:	48 89 f7             	mov    %rsi,%rdi
+  801ae1:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  801ae4:	48 85 f6             	test   %rsi,%rsi
+  801ae7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801aee:	00 00 00 
+  801af1:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  801af5:	be 00 10 00 00       	mov    $0x1000,%esi
+  801afa:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  801b01:	00 00 00 
+  801b04:	ff d0                	call   *%rax
+    if (res < 0) {
+  801b06:	85 c0                	test   %eax,%eax
+  801b08:	78 45                	js     801b4f <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  801b0a:	48 85 db             	test   %rbx,%rbx
+  801b0d:	74 12                	je     801b21 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  801b0f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b16:	00 00 00 
+  801b19:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  801b1f:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  801b21:	4d 85 e4             	test   %r12,%r12
+  801b24:	74 14                	je     801b3a <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  801b26:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b2d:	00 00 00 
+  801b30:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  801b36:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  801b3a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b41:	00 00 00 
+  801b44:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  801b4a:	5b                   	pop    %rbx
+  801b4b:	41 5c                	pop    %r12
+  801b4d:	5d                   	pop    %rbp
+  801b4e:	c3                   	ret
+        if (from_env_store)
+  801b4f:	48 85 db             	test   %rbx,%rbx
+  801b52:	74 06                	je     801b5a <ipc_recv+0x86>
+            *from_env_store = 0;
+  801b54:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  801b5a:	4d 85 e4             	test   %r12,%r12
+  801b5d:	74 eb                	je     801b4a <ipc_recv+0x76>
+            *perm_store = 0;
+  801b5f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801b66:	00 
+  801b67:	eb e1                	jmp    801b4a <ipc_recv+0x76>
+
+0000000000801b69 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801b69:	55                   	push   %rbp
+  801b6a:	48 89 e5             	mov    %rsp,%rbp
+  801b6d:	41 57                	push   %r15
+  801b6f:	41 56                	push   %r14
+  801b71:	41 55                	push   %r13
+  801b73:	41 54                	push   %r12
+  801b75:	53                   	push   %rbx
+  801b76:	48 83 ec 18          	sub    $0x18,%rsp
+  801b7a:	41 89 fd             	mov    %edi,%r13d
+  801b7d:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  801b80:	48 89 d3             	mov    %rdx,%rbx
+  801b83:	49 89 cc             	mov    %rcx,%r12
+  801b86:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  801b8a:	48 85 d2             	test   %rdx,%rdx
+  801b8d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801b94:	00 00 00 
+  801b97:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  801b9b:	49 be 70 17 80 00 00 	movabs $0x801770,%r14
+  801ba2:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  801ba5:	49 bf a3 13 80 00 00 	movabs $0x8013a3,%r15
+  801bac:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  801baf:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  801bb2:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  801bb6:	4c 89 e1             	mov    %r12,%rcx
+  801bb9:	48 89 da             	mov    %rbx,%rdx
+  801bbc:	44 89 ef             	mov    %r13d,%edi
+  801bbf:	41 ff d6             	call   *%r14
+        if (res == 0)
+  801bc2:	85 c0                	test   %eax,%eax
+  801bc4:	74 34                	je     801bfa <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  801bc6:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801bc9:	75 05                	jne    801bd0 <ipc_send+0x67>
+        sys_yield();
+  801bcb:	41 ff d7             	call   *%r15
+    while (true) {
+  801bce:	eb df                	jmp    801baf <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  801bd0:	48 ba 03 36 80 00 00 	movabs $0x803603,%rdx
+  801bd7:	00 00 00 
+  801bda:	be 3e 00 00 00       	mov    $0x3e,%esi
+  801bdf:	48 bf 1c 36 80 00 00 	movabs $0x80361c,%rdi
+  801be6:	00 00 00 
+  801be9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bee:	48 b9 0d 04 80 00 00 	movabs $0x80040d,%rcx
+  801bf5:	00 00 00 
+  801bf8:	ff d1                	call   *%rcx
+    }
+}
+  801bfa:	48 83 c4 18          	add    $0x18,%rsp
+  801bfe:	5b                   	pop    %rbx
+  801bff:	41 5c                	pop    %r12
+  801c01:	41 5d                	pop    %r13
+  801c03:	41 5e                	pop    %r14
+  801c05:	41 5f                	pop    %r15
+  801c07:	5d                   	pop    %rbp
+  801c08:	c3                   	ret
+
+0000000000801c09 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801c09:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  801c0e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801c15:	00 00 00 
+  801c18:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  801c1f:	48 01 ca             	add    %rcx,%rdx
+  801c22:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  801c28:	39 fa                	cmp    %edi,%edx
+  801c2a:	74 12                	je     801c3e <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  801c2c:	48 83 c0 01          	add    $0x1,%rax
+  801c30:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  801c36:	75 e0                	jne    801c18 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801c38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c3d:	c3                   	ret
+            return envs[i].env_id;
+  801c3e:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  801c45:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801c4c:	00 00 00 
+  801c4f:	48 01 d0             	add    %rdx,%rax
+  801c52:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801c58:	c3                   	ret
+
+0000000000801c59 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c59:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c60:	ff ff ff 
+  801c63:	48 01 f8             	add    %rdi,%rax
+  801c66:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801c6a:	c3                   	ret
+
+0000000000801c6b <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c6b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c72:	ff ff ff 
+  801c75:	48 01 f8             	add    %rdi,%rax
+  801c78:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801c7c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801c82:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801c86:	c3                   	ret
+
+0000000000801c87 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801c87:	55                   	push   %rbp
+  801c88:	48 89 e5             	mov    %rsp,%rbp
+  801c8b:	41 57                	push   %r15
+  801c8d:	41 56                	push   %r14
+  801c8f:	41 55                	push   %r13
+  801c91:	41 54                	push   %r12
+  801c93:	53                   	push   %rbx
+  801c94:	48 83 ec 08          	sub    $0x8,%rsp
+  801c98:	49 89 ff             	mov    %rdi,%r15
+  801c9b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801ca0:	49 bd 05 2c 80 00 00 	movabs $0x802c05,%r13
+  801ca7:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801caa:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801cb0:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801cb3:	48 89 df             	mov    %rbx,%rdi
+  801cb6:	41 ff d5             	call   *%r13
+  801cb9:	83 e0 04             	and    $0x4,%eax
+  801cbc:	74 17                	je     801cd5 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801cbe:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801cc5:	4c 39 f3             	cmp    %r14,%rbx
+  801cc8:	75 e6                	jne    801cb0 <fd_alloc+0x29>
+  801cca:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801cd0:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801cd5:	4d 89 27             	mov    %r12,(%r15)
+}
+  801cd8:	48 83 c4 08          	add    $0x8,%rsp
+  801cdc:	5b                   	pop    %rbx
+  801cdd:	41 5c                	pop    %r12
+  801cdf:	41 5d                	pop    %r13
+  801ce1:	41 5e                	pop    %r14
+  801ce3:	41 5f                	pop    %r15
+  801ce5:	5d                   	pop    %rbp
+  801ce6:	c3                   	ret
+
+0000000000801ce7 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801ce7:	83 ff 1f             	cmp    $0x1f,%edi
+  801cea:	77 39                	ja     801d25 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801cec:	55                   	push   %rbp
+  801ced:	48 89 e5             	mov    %rsp,%rbp
+  801cf0:	41 54                	push   %r12
+  801cf2:	53                   	push   %rbx
+  801cf3:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801cf6:	48 63 df             	movslq %edi,%rbx
+  801cf9:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801d00:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801d04:	48 89 df             	mov    %rbx,%rdi
+  801d07:	48 b8 05 2c 80 00 00 	movabs $0x802c05,%rax
+  801d0e:	00 00 00 
+  801d11:	ff d0                	call   *%rax
+  801d13:	a8 04                	test   $0x4,%al
+  801d15:	74 14                	je     801d2b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801d17:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d20:	5b                   	pop    %rbx
+  801d21:	41 5c                	pop    %r12
+  801d23:	5d                   	pop    %rbp
+  801d24:	c3                   	ret
+        return -E_INVAL;
+  801d25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801d2a:	c3                   	ret
+        return -E_INVAL;
+  801d2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d30:	eb ee                	jmp    801d20 <fd_lookup+0x39>
+
+0000000000801d32 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801d32:	55                   	push   %rbp
+  801d33:	48 89 e5             	mov    %rsp,%rbp
+  801d36:	41 54                	push   %r12
+  801d38:	53                   	push   %rbx
+  801d39:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801d3c:	48 b8 c0 36 80 00 00 	movabs $0x8036c0,%rax
+  801d43:	00 00 00 
+  801d46:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801d4d:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801d50:	39 3b                	cmp    %edi,(%rbx)
+  801d52:	74 47                	je     801d9b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801d54:	48 83 c0 08          	add    $0x8,%rax
+  801d58:	48 8b 18             	mov    (%rax),%rbx
+  801d5b:	48 85 db             	test   %rbx,%rbx
+  801d5e:	75 f0                	jne    801d50 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801d60:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d67:	00 00 00 
+  801d6a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d70:	89 fa                	mov    %edi,%edx
+  801d72:	48 bf 28 36 80 00 00 	movabs $0x803628,%rdi
+  801d79:	00 00 00 
+  801d7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d81:	48 b9 5d 05 80 00 00 	movabs $0x80055d,%rcx
+  801d88:	00 00 00 
+  801d8b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801d8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801d92:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801d96:	5b                   	pop    %rbx
+  801d97:	41 5c                	pop    %r12
+  801d99:	5d                   	pop    %rbp
+  801d9a:	c3                   	ret
+            return 0;
+  801d9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da0:	eb f0                	jmp    801d92 <dev_lookup+0x60>
+
+0000000000801da2 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801da2:	55                   	push   %rbp
+  801da3:	48 89 e5             	mov    %rsp,%rbp
+  801da6:	41 55                	push   %r13
+  801da8:	41 54                	push   %r12
+  801daa:	53                   	push   %rbx
+  801dab:	48 83 ec 18          	sub    $0x18,%rsp
+  801daf:	48 89 fb             	mov    %rdi,%rbx
+  801db2:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801db5:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801dbc:	ff ff ff 
+  801dbf:	48 01 df             	add    %rbx,%rdi
+  801dc2:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801dc6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dca:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  801dd1:	00 00 00 
+  801dd4:	ff d0                	call   *%rax
+  801dd6:	41 89 c5             	mov    %eax,%r13d
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	78 06                	js     801de3 <fd_close+0x41>
+  801ddd:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801de1:	74 1a                	je     801dfd <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801de3:	45 84 e4             	test   %r12b,%r12b
+  801de6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801deb:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801def:	44 89 e8             	mov    %r13d,%eax
+  801df2:	48 83 c4 18          	add    $0x18,%rsp
+  801df6:	5b                   	pop    %rbx
+  801df7:	41 5c                	pop    %r12
+  801df9:	41 5d                	pop    %r13
+  801dfb:	5d                   	pop    %rbp
+  801dfc:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801dfd:	8b 3b                	mov    (%rbx),%edi
+  801dff:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e03:	48 b8 32 1d 80 00 00 	movabs $0x801d32,%rax
+  801e0a:	00 00 00 
+  801e0d:	ff d0                	call   *%rax
+  801e0f:	41 89 c5             	mov    %eax,%r13d
+  801e12:	85 c0                	test   %eax,%eax
+  801e14:	78 1b                	js     801e31 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801e16:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e1a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e1e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e24:	48 85 c0             	test   %rax,%rax
+  801e27:	74 08                	je     801e31 <fd_close+0x8f>
+  801e29:	48 89 df             	mov    %rbx,%rdi
+  801e2c:	ff d0                	call   *%rax
+  801e2e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801e31:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e36:	48 89 de             	mov    %rbx,%rsi
+  801e39:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e3e:	48 b8 fe 14 80 00 00 	movabs $0x8014fe,%rax
+  801e45:	00 00 00 
+  801e48:	ff d0                	call   *%rax
+    return res;
+  801e4a:	eb a3                	jmp    801def <fd_close+0x4d>
+
+0000000000801e4c <close>:
+
+int
+close(int fdnum) {
+  801e4c:	55                   	push   %rbp
+  801e4d:	48 89 e5             	mov    %rsp,%rbp
+  801e50:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801e54:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801e58:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  801e5f:	00 00 00 
+  801e62:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e64:	85 c0                	test   %eax,%eax
+  801e66:	78 15                	js     801e7d <close+0x31>
+
+    return fd_close(fd, 1);
+  801e68:	be 01 00 00 00       	mov    $0x1,%esi
+  801e6d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801e71:	48 b8 a2 1d 80 00 00 	movabs $0x801da2,%rax
+  801e78:	00 00 00 
+  801e7b:	ff d0                	call   *%rax
+}
+  801e7d:	c9                   	leave
+  801e7e:	c3                   	ret
+
+0000000000801e7f <close_all>:
+
+void
+close_all(void) {
+  801e7f:	55                   	push   %rbp
+  801e80:	48 89 e5             	mov    %rsp,%rbp
+  801e83:	41 54                	push   %r12
+  801e85:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801e86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e8b:	49 bc 4c 1e 80 00 00 	movabs $0x801e4c,%r12
+  801e92:	00 00 00 
+  801e95:	89 df                	mov    %ebx,%edi
+  801e97:	41 ff d4             	call   *%r12
+  801e9a:	83 c3 01             	add    $0x1,%ebx
+  801e9d:	83 fb 20             	cmp    $0x20,%ebx
+  801ea0:	75 f3                	jne    801e95 <close_all+0x16>
+}
+  801ea2:	5b                   	pop    %rbx
+  801ea3:	41 5c                	pop    %r12
+  801ea5:	5d                   	pop    %rbp
+  801ea6:	c3                   	ret
+
+0000000000801ea7 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801ea7:	55                   	push   %rbp
+  801ea8:	48 89 e5             	mov    %rsp,%rbp
+  801eab:	41 57                	push   %r15
+  801ead:	41 56                	push   %r14
+  801eaf:	41 55                	push   %r13
+  801eb1:	41 54                	push   %r12
+  801eb3:	53                   	push   %rbx
+  801eb4:	48 83 ec 18          	sub    $0x18,%rsp
+  801eb8:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801ebb:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ebf:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  801ec6:	00 00 00 
+  801ec9:	ff d0                	call   *%rax
+  801ecb:	89 c3                	mov    %eax,%ebx
+  801ecd:	85 c0                	test   %eax,%eax
+  801ecf:	0f 88 b8 00 00 00    	js     801f8d <dup+0xe6>
+    close(newfdnum);
+  801ed5:	44 89 e7             	mov    %r12d,%edi
+  801ed8:	48 b8 4c 1e 80 00 00 	movabs $0x801e4c,%rax
+  801edf:	00 00 00 
+  801ee2:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801ee4:	4d 63 ec             	movslq %r12d,%r13
+  801ee7:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801eee:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801ef2:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ef6:	4c 89 ff             	mov    %r15,%rdi
+  801ef9:	49 be 6b 1c 80 00 00 	movabs $0x801c6b,%r14
+  801f00:	00 00 00 
+  801f03:	41 ff d6             	call   *%r14
+  801f06:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801f09:	4c 89 ef             	mov    %r13,%rdi
+  801f0c:	41 ff d6             	call   *%r14
+  801f0f:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801f12:	48 89 df             	mov    %rbx,%rdi
+  801f15:	48 b8 05 2c 80 00 00 	movabs $0x802c05,%rax
+  801f1c:	00 00 00 
+  801f1f:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801f21:	a8 04                	test   $0x4,%al
+  801f23:	74 2b                	je     801f50 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801f25:	41 89 c1             	mov    %eax,%r9d
+  801f28:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f2e:	4c 89 f1             	mov    %r14,%rcx
+  801f31:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f36:	48 89 de             	mov    %rbx,%rsi
+  801f39:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f3e:	48 b8 99 14 80 00 00 	movabs $0x801499,%rax
+  801f45:	00 00 00 
+  801f48:	ff d0                	call   *%rax
+  801f4a:	89 c3                	mov    %eax,%ebx
+  801f4c:	85 c0                	test   %eax,%eax
+  801f4e:	78 4e                	js     801f9e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801f50:	4c 89 ff             	mov    %r15,%rdi
+  801f53:	48 b8 05 2c 80 00 00 	movabs $0x802c05,%rax
+  801f5a:	00 00 00 
+  801f5d:	ff d0                	call   *%rax
+  801f5f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801f62:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f68:	4c 89 e9             	mov    %r13,%rcx
+  801f6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f70:	4c 89 fe             	mov    %r15,%rsi
+  801f73:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f78:	48 b8 99 14 80 00 00 	movabs $0x801499,%rax
+  801f7f:	00 00 00 
+  801f82:	ff d0                	call   *%rax
+  801f84:	89 c3                	mov    %eax,%ebx
+  801f86:	85 c0                	test   %eax,%eax
+  801f88:	78 14                	js     801f9e <dup+0xf7>
+
+    return newfdnum;
+  801f8a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801f8d:	89 d8                	mov    %ebx,%eax
+  801f8f:	48 83 c4 18          	add    $0x18,%rsp
+  801f93:	5b                   	pop    %rbx
+  801f94:	41 5c                	pop    %r12
+  801f96:	41 5d                	pop    %r13
+  801f98:	41 5e                	pop    %r14
+  801f9a:	41 5f                	pop    %r15
+  801f9c:	5d                   	pop    %rbp
+  801f9d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801f9e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801fa3:	4c 89 ee             	mov    %r13,%rsi
+  801fa6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fab:	49 bc fe 14 80 00 00 	movabs $0x8014fe,%r12
+  801fb2:	00 00 00 
+  801fb5:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801fb8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801fbd:	4c 89 f6             	mov    %r14,%rsi
+  801fc0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fc5:	41 ff d4             	call   *%r12
+    return res;
+  801fc8:	eb c3                	jmp    801f8d <dup+0xe6>
+
+0000000000801fca <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801fca:	55                   	push   %rbp
+  801fcb:	48 89 e5             	mov    %rsp,%rbp
+  801fce:	41 56                	push   %r14
+  801fd0:	41 55                	push   %r13
+  801fd2:	41 54                	push   %r12
+  801fd4:	53                   	push   %rbx
+  801fd5:	48 83 ec 10          	sub    $0x10,%rsp
+  801fd9:	89 fb                	mov    %edi,%ebx
+  801fdb:	49 89 f4             	mov    %rsi,%r12
+  801fde:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fe1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fe5:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  801fec:	00 00 00 
+  801fef:	ff d0                	call   *%rax
+  801ff1:	85 c0                	test   %eax,%eax
+  801ff3:	78 4c                	js     802041 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ff5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ff9:	41 8b 3e             	mov    (%r14),%edi
+  801ffc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802000:	48 b8 32 1d 80 00 00 	movabs $0x801d32,%rax
+  802007:	00 00 00 
+  80200a:	ff d0                	call   *%rax
+  80200c:	85 c0                	test   %eax,%eax
+  80200e:	78 35                	js     802045 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802010:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802014:	83 e0 03             	and    $0x3,%eax
+  802017:	83 f8 01             	cmp    $0x1,%eax
+  80201a:	74 2d                	je     802049 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80201c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802020:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802024:	48 85 c0             	test   %rax,%rax
+  802027:	74 56                	je     80207f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802029:	4c 89 ea             	mov    %r13,%rdx
+  80202c:	4c 89 e6             	mov    %r12,%rsi
+  80202f:	4c 89 f7             	mov    %r14,%rdi
+  802032:	ff d0                	call   *%rax
+}
+  802034:	48 83 c4 10          	add    $0x10,%rsp
+  802038:	5b                   	pop    %rbx
+  802039:	41 5c                	pop    %r12
+  80203b:	41 5d                	pop    %r13
+  80203d:	41 5e                	pop    %r14
+  80203f:	5d                   	pop    %rbp
+  802040:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802041:	48 98                	cltq
+  802043:	eb ef                	jmp    802034 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802045:	48 98                	cltq
+  802047:	eb eb                	jmp    802034 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802049:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802050:	00 00 00 
+  802053:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802059:	89 da                	mov    %ebx,%edx
+  80205b:	48 bf 69 36 80 00 00 	movabs $0x803669,%rdi
+  802062:	00 00 00 
+  802065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80206a:	48 b9 5d 05 80 00 00 	movabs $0x80055d,%rcx
+  802071:	00 00 00 
+  802074:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802076:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80207d:	eb b5                	jmp    802034 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80207f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802086:	eb ac                	jmp    802034 <read+0x6a>
+
+0000000000802088 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802088:	55                   	push   %rbp
+  802089:	48 89 e5             	mov    %rsp,%rbp
+  80208c:	41 57                	push   %r15
+  80208e:	41 56                	push   %r14
+  802090:	41 55                	push   %r13
+  802092:	41 54                	push   %r12
+  802094:	53                   	push   %rbx
+  802095:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802099:	48 85 d2             	test   %rdx,%rdx
+  80209c:	74 54                	je     8020f2 <readn+0x6a>
+  80209e:	41 89 fd             	mov    %edi,%r13d
+  8020a1:	49 89 f6             	mov    %rsi,%r14
+  8020a4:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8020a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8020ac:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8020b1:	49 bf ca 1f 80 00 00 	movabs $0x801fca,%r15
+  8020b8:	00 00 00 
+  8020bb:	4c 89 e2             	mov    %r12,%rdx
+  8020be:	48 29 f2             	sub    %rsi,%rdx
+  8020c1:	4c 01 f6             	add    %r14,%rsi
+  8020c4:	44 89 ef             	mov    %r13d,%edi
+  8020c7:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8020ca:	85 c0                	test   %eax,%eax
+  8020cc:	78 20                	js     8020ee <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8020ce:	01 c3                	add    %eax,%ebx
+  8020d0:	85 c0                	test   %eax,%eax
+  8020d2:	74 08                	je     8020dc <readn+0x54>
+  8020d4:	48 63 f3             	movslq %ebx,%rsi
+  8020d7:	4c 39 e6             	cmp    %r12,%rsi
+  8020da:	72 df                	jb     8020bb <readn+0x33>
+    }
+    return res;
+  8020dc:	48 63 c3             	movslq %ebx,%rax
+}
+  8020df:	48 83 c4 08          	add    $0x8,%rsp
+  8020e3:	5b                   	pop    %rbx
+  8020e4:	41 5c                	pop    %r12
+  8020e6:	41 5d                	pop    %r13
+  8020e8:	41 5e                	pop    %r14
+  8020ea:	41 5f                	pop    %r15
+  8020ec:	5d                   	pop    %rbp
+  8020ed:	c3                   	ret
+        if (inc < 0) return inc;
+  8020ee:	48 98                	cltq
+  8020f0:	eb ed                	jmp    8020df <readn+0x57>
+    int inc = 1, res = 0;
+  8020f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020f7:	eb e3                	jmp    8020dc <readn+0x54>
+
+00000000008020f9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8020f9:	55                   	push   %rbp
+  8020fa:	48 89 e5             	mov    %rsp,%rbp
+  8020fd:	41 56                	push   %r14
+  8020ff:	41 55                	push   %r13
+  802101:	41 54                	push   %r12
+  802103:	53                   	push   %rbx
+  802104:	48 83 ec 10          	sub    $0x10,%rsp
+  802108:	89 fb                	mov    %edi,%ebx
+  80210a:	49 89 f4             	mov    %rsi,%r12
+  80210d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802110:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802114:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  80211b:	00 00 00 
+  80211e:	ff d0                	call   *%rax
+  802120:	85 c0                	test   %eax,%eax
+  802122:	78 47                	js     80216b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802124:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802128:	41 8b 3e             	mov    (%r14),%edi
+  80212b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80212f:	48 b8 32 1d 80 00 00 	movabs $0x801d32,%rax
+  802136:	00 00 00 
+  802139:	ff d0                	call   *%rax
+  80213b:	85 c0                	test   %eax,%eax
+  80213d:	78 30                	js     80216f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80213f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802144:	74 2d                	je     802173 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802146:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80214a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80214e:	48 85 c0             	test   %rax,%rax
+  802151:	74 56                	je     8021a9 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802153:	4c 89 ea             	mov    %r13,%rdx
+  802156:	4c 89 e6             	mov    %r12,%rsi
+  802159:	4c 89 f7             	mov    %r14,%rdi
+  80215c:	ff d0                	call   *%rax
+}
+  80215e:	48 83 c4 10          	add    $0x10,%rsp
+  802162:	5b                   	pop    %rbx
+  802163:	41 5c                	pop    %r12
+  802165:	41 5d                	pop    %r13
+  802167:	41 5e                	pop    %r14
+  802169:	5d                   	pop    %rbp
+  80216a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80216b:	48 98                	cltq
+  80216d:	eb ef                	jmp    80215e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80216f:	48 98                	cltq
+  802171:	eb eb                	jmp    80215e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802173:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80217a:	00 00 00 
+  80217d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802183:	89 da                	mov    %ebx,%edx
+  802185:	48 bf 85 36 80 00 00 	movabs $0x803685,%rdi
+  80218c:	00 00 00 
+  80218f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802194:	48 b9 5d 05 80 00 00 	movabs $0x80055d,%rcx
+  80219b:	00 00 00 
+  80219e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021a0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8021a7:	eb b5                	jmp    80215e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8021a9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8021b0:	eb ac                	jmp    80215e <write+0x65>
+
+00000000008021b2 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8021b2:	55                   	push   %rbp
+  8021b3:	48 89 e5             	mov    %rsp,%rbp
+  8021b6:	53                   	push   %rbx
+  8021b7:	48 83 ec 18          	sub    $0x18,%rsp
+  8021bb:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021bd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021c1:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  8021c8:	00 00 00 
+  8021cb:	ff d0                	call   *%rax
+  8021cd:	85 c0                	test   %eax,%eax
+  8021cf:	78 0c                	js     8021dd <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8021d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021d5:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8021d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021e1:	c9                   	leave
+  8021e2:	c3                   	ret
+
+00000000008021e3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8021e3:	55                   	push   %rbp
+  8021e4:	48 89 e5             	mov    %rsp,%rbp
+  8021e7:	41 55                	push   %r13
+  8021e9:	41 54                	push   %r12
+  8021eb:	53                   	push   %rbx
+  8021ec:	48 83 ec 18          	sub    $0x18,%rsp
+  8021f0:	89 fb                	mov    %edi,%ebx
+  8021f2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021f5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021f9:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  802200:	00 00 00 
+  802203:	ff d0                	call   *%rax
+  802205:	85 c0                	test   %eax,%eax
+  802207:	78 38                	js     802241 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802209:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80220d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802211:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802215:	48 b8 32 1d 80 00 00 	movabs $0x801d32,%rax
+  80221c:	00 00 00 
+  80221f:	ff d0                	call   *%rax
+  802221:	85 c0                	test   %eax,%eax
+  802223:	78 1c                	js     802241 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802225:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80222a:	74 20                	je     80224c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80222c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802230:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802234:	48 85 c0             	test   %rax,%rax
+  802237:	74 47                	je     802280 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802239:	44 89 e6             	mov    %r12d,%esi
+  80223c:	4c 89 ef             	mov    %r13,%rdi
+  80223f:	ff d0                	call   *%rax
+}
+  802241:	48 83 c4 18          	add    $0x18,%rsp
+  802245:	5b                   	pop    %rbx
+  802246:	41 5c                	pop    %r12
+  802248:	41 5d                	pop    %r13
+  80224a:	5d                   	pop    %rbp
+  80224b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80224c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802253:	00 00 00 
+  802256:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80225c:	89 da                	mov    %ebx,%edx
+  80225e:	48 bf 48 36 80 00 00 	movabs $0x803648,%rdi
+  802265:	00 00 00 
+  802268:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226d:	48 b9 5d 05 80 00 00 	movabs $0x80055d,%rcx
+  802274:	00 00 00 
+  802277:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802279:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80227e:	eb c1                	jmp    802241 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802280:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802285:	eb ba                	jmp    802241 <ftruncate+0x5e>
+
+0000000000802287 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802287:	55                   	push   %rbp
+  802288:	48 89 e5             	mov    %rsp,%rbp
+  80228b:	41 54                	push   %r12
+  80228d:	53                   	push   %rbx
+  80228e:	48 83 ec 10          	sub    $0x10,%rsp
+  802292:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802295:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802299:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  8022a0:	00 00 00 
+  8022a3:	ff d0                	call   *%rax
+  8022a5:	85 c0                	test   %eax,%eax
+  8022a7:	78 4e                	js     8022f7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022a9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8022ad:	41 8b 3c 24          	mov    (%r12),%edi
+  8022b1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8022b5:	48 b8 32 1d 80 00 00 	movabs $0x801d32,%rax
+  8022bc:	00 00 00 
+  8022bf:	ff d0                	call   *%rax
+  8022c1:	85 c0                	test   %eax,%eax
+  8022c3:	78 32                	js     8022f7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8022c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8022c9:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8022ce:	74 30                	je     802300 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8022d0:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8022d3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8022da:	00 00 00 
+    stat->st_isdir = 0;
+  8022dd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8022e4:	00 00 00 
+    stat->st_dev = dev;
+  8022e7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8022ee:	48 89 de             	mov    %rbx,%rsi
+  8022f1:	4c 89 e7             	mov    %r12,%rdi
+  8022f4:	ff 50 28             	call   *0x28(%rax)
+}
+  8022f7:	48 83 c4 10          	add    $0x10,%rsp
+  8022fb:	5b                   	pop    %rbx
+  8022fc:	41 5c                	pop    %r12
+  8022fe:	5d                   	pop    %rbp
+  8022ff:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802300:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802305:	eb f0                	jmp    8022f7 <fstat+0x70>
+
+0000000000802307 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802307:	55                   	push   %rbp
+  802308:	48 89 e5             	mov    %rsp,%rbp
+  80230b:	41 54                	push   %r12
+  80230d:	53                   	push   %rbx
+  80230e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802311:	be 00 00 00 00       	mov    $0x0,%esi
+  802316:	48 b8 88 25 80 00 00 	movabs $0x802588,%rax
+  80231d:	00 00 00 
+  802320:	ff d0                	call   *%rax
+  802322:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802324:	85 c0                	test   %eax,%eax
+  802326:	78 25                	js     80234d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802328:	4c 89 e6             	mov    %r12,%rsi
+  80232b:	89 c7                	mov    %eax,%edi
+  80232d:	48 b8 87 22 80 00 00 	movabs $0x802287,%rax
+  802334:	00 00 00 
+  802337:	ff d0                	call   *%rax
+  802339:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80233c:	89 df                	mov    %ebx,%edi
+  80233e:	48 b8 4c 1e 80 00 00 	movabs $0x801e4c,%rax
+  802345:	00 00 00 
+  802348:	ff d0                	call   *%rax
+
+    return res;
+  80234a:	44 89 e3             	mov    %r12d,%ebx
+}
+  80234d:	89 d8                	mov    %ebx,%eax
+  80234f:	5b                   	pop    %rbx
+  802350:	41 5c                	pop    %r12
+  802352:	5d                   	pop    %rbp
+  802353:	c3                   	ret
+
+0000000000802354 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802354:	55                   	push   %rbp
+  802355:	48 89 e5             	mov    %rsp,%rbp
+  802358:	41 54                	push   %r12
+  80235a:	53                   	push   %rbx
+  80235b:	48 83 ec 10          	sub    $0x10,%rsp
+  80235f:	41 89 fc             	mov    %edi,%r12d
+  802362:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802365:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80236c:	00 00 00 
+  80236f:	83 38 00             	cmpl   $0x0,(%rax)
+  802372:	74 5e                	je     8023d2 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802374:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80237a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80237f:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802386:	00 00 00 
+  802389:	44 89 e6             	mov    %r12d,%esi
+  80238c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802393:	00 00 00 
+  802396:	8b 38                	mov    (%rax),%edi
+  802398:	48 b8 69 1b 80 00 00 	movabs $0x801b69,%rax
+  80239f:	00 00 00 
+  8023a2:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8023a4:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8023ab:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8023ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023b1:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8023b5:	48 89 de             	mov    %rbx,%rsi
+  8023b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023bd:	48 b8 d4 1a 80 00 00 	movabs $0x801ad4,%rax
+  8023c4:	00 00 00 
+  8023c7:	ff d0                	call   *%rax
+}
+  8023c9:	48 83 c4 10          	add    $0x10,%rsp
+  8023cd:	5b                   	pop    %rbx
+  8023ce:	41 5c                	pop    %r12
+  8023d0:	5d                   	pop    %rbp
+  8023d1:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023d2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023d7:	48 b8 09 1c 80 00 00 	movabs $0x801c09,%rax
+  8023de:	00 00 00 
+  8023e1:	ff d0                	call   *%rax
+  8023e3:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8023ea:	00 00 
+  8023ec:	eb 86                	jmp    802374 <fsipc+0x20>
+
+00000000008023ee <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8023ee:	55                   	push   %rbp
+  8023ef:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8023f2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023f9:	00 00 00 
+  8023fc:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8023ff:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802401:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802404:	be 00 00 00 00       	mov    $0x0,%esi
+  802409:	bf 02 00 00 00       	mov    $0x2,%edi
+  80240e:	48 b8 54 23 80 00 00 	movabs $0x802354,%rax
+  802415:	00 00 00 
+  802418:	ff d0                	call   *%rax
+}
+  80241a:	5d                   	pop    %rbp
+  80241b:	c3                   	ret
+
+000000000080241c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80241c:	55                   	push   %rbp
+  80241d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802420:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802423:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80242a:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80242c:	be 00 00 00 00       	mov    $0x0,%esi
+  802431:	bf 06 00 00 00       	mov    $0x6,%edi
+  802436:	48 b8 54 23 80 00 00 	movabs $0x802354,%rax
+  80243d:	00 00 00 
+  802440:	ff d0                	call   *%rax
+}
+  802442:	5d                   	pop    %rbp
+  802443:	c3                   	ret
+
+0000000000802444 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802444:	55                   	push   %rbp
+  802445:	48 89 e5             	mov    %rsp,%rbp
+  802448:	41 54                	push   %r12
+  80244a:	53                   	push   %rbx
+  80244b:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80244e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802451:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802458:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80245a:	be 00 00 00 00       	mov    $0x0,%esi
+  80245f:	bf 05 00 00 00       	mov    $0x5,%edi
+  802464:	48 b8 54 23 80 00 00 	movabs $0x802354,%rax
+  80246b:	00 00 00 
+  80246e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802470:	85 c0                	test   %eax,%eax
+  802472:	78 3d                	js     8024b1 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802474:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80247b:	00 00 00 
+  80247e:	4c 89 e6             	mov    %r12,%rsi
+  802481:	48 89 df             	mov    %rbx,%rdi
+  802484:	48 b8 82 0e 80 00 00 	movabs $0x800e82,%rax
+  80248b:	00 00 00 
+  80248e:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802490:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802497:	00 
+  802498:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80249e:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8024a5:	00 
+  8024a6:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8024ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024b1:	5b                   	pop    %rbx
+  8024b2:	41 5c                	pop    %r12
+  8024b4:	5d                   	pop    %rbp
+  8024b5:	c3                   	ret
+
+00000000008024b6 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8024b6:	55                   	push   %rbp
+  8024b7:	48 89 e5             	mov    %rsp,%rbp
+  8024ba:	41 54                	push   %r12
+  8024bc:	53                   	push   %rbx
+  8024bd:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8024c0:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8024c5:	48 39 c2             	cmp    %rax,%rdx
+  8024c8:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8024cc:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8024cf:	48 89 c2             	mov    %rax,%rdx
+  8024d2:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8024d9:	00 00 00 
+  8024dc:	48 b8 e3 10 80 00 00 	movabs $0x8010e3,%rax
+  8024e3:	00 00 00 
+  8024e6:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024e8:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8024ef:	00 00 00 
+  8024f2:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8024f7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8024f9:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8024fd:	be 00 00 00 00       	mov    $0x0,%esi
+  802502:	bf 04 00 00 00       	mov    $0x4,%edi
+  802507:	48 b8 54 23 80 00 00 	movabs $0x802354,%rax
+  80250e:	00 00 00 
+  802511:	ff d0                	call   *%rax
+  802513:	48 98                	cltq
+}
+  802515:	5b                   	pop    %rbx
+  802516:	41 5c                	pop    %r12
+  802518:	5d                   	pop    %rbp
+  802519:	c3                   	ret
+
+000000000080251a <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80251a:	55                   	push   %rbp
+  80251b:	48 89 e5             	mov    %rsp,%rbp
+  80251e:	41 54                	push   %r12
+  802520:	53                   	push   %rbx
+  802521:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802524:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80252b:	00 00 00 
+  80252e:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802531:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  802533:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802538:	48 39 ca             	cmp    %rcx,%rdx
+  80253b:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  80253f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  802543:	be 00 00 00 00       	mov    $0x0,%esi
+  802548:	bf 03 00 00 00       	mov    $0x3,%edi
+  80254d:	48 b8 54 23 80 00 00 	movabs $0x802354,%rax
+  802554:	00 00 00 
+  802557:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802559:	85 c0                	test   %eax,%eax
+  80255b:	78 27                	js     802584 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  80255d:	48 63 d8             	movslq %eax,%rbx
+  802560:	48 89 da             	mov    %rbx,%rdx
+  802563:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80256a:	00 00 00 
+  80256d:	4c 89 e7             	mov    %r12,%rdi
+  802570:	48 b8 e3 10 80 00 00 	movabs $0x8010e3,%rax
+  802577:	00 00 00 
+  80257a:	ff d0                	call   *%rax
+    return bytes_read;
+  80257c:	48 89 d8             	mov    %rbx,%rax
+}
+  80257f:	5b                   	pop    %rbx
+  802580:	41 5c                	pop    %r12
+  802582:	5d                   	pop    %rbp
+  802583:	c3                   	ret
+        return bytes_read;
+  802584:	48 98                	cltq
+  802586:	eb f7                	jmp    80257f <devfile_read+0x65>
+
+0000000000802588 <open>:
+open(const char *path, int mode) {
+  802588:	55                   	push   %rbp
+  802589:	48 89 e5             	mov    %rsp,%rbp
+  80258c:	41 55                	push   %r13
+  80258e:	41 54                	push   %r12
+  802590:	53                   	push   %rbx
+  802591:	48 83 ec 18          	sub    $0x18,%rsp
+  802595:	49 89 fc             	mov    %rdi,%r12
+  802598:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80259b:	48 b8 44 0e 80 00 00 	movabs $0x800e44,%rax
+  8025a2:	00 00 00 
+  8025a5:	ff d0                	call   *%rax
+  8025a7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8025ad:	0f 87 8a 00 00 00    	ja     80263d <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8025b3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8025b7:	48 b8 87 1c 80 00 00 	movabs $0x801c87,%rax
+  8025be:	00 00 00 
+  8025c1:	ff d0                	call   *%rax
+  8025c3:	89 c3                	mov    %eax,%ebx
+  8025c5:	85 c0                	test   %eax,%eax
+  8025c7:	78 50                	js     802619 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8025c9:	4c 89 e6             	mov    %r12,%rsi
+  8025cc:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8025d3:	00 00 00 
+  8025d6:	48 89 df             	mov    %rbx,%rdi
+  8025d9:	48 b8 82 0e 80 00 00 	movabs $0x800e82,%rax
+  8025e0:	00 00 00 
+  8025e3:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8025e5:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8025ec:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8025f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8025f5:	48 b8 54 23 80 00 00 	movabs $0x802354,%rax
+  8025fc:	00 00 00 
+  8025ff:	ff d0                	call   *%rax
+  802601:	89 c3                	mov    %eax,%ebx
+  802603:	85 c0                	test   %eax,%eax
+  802605:	78 1f                	js     802626 <open+0x9e>
+    return fd2num(fd);
+  802607:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80260b:	48 b8 59 1c 80 00 00 	movabs $0x801c59,%rax
+  802612:	00 00 00 
+  802615:	ff d0                	call   *%rax
+  802617:	89 c3                	mov    %eax,%ebx
+}
+  802619:	89 d8                	mov    %ebx,%eax
+  80261b:	48 83 c4 18          	add    $0x18,%rsp
+  80261f:	5b                   	pop    %rbx
+  802620:	41 5c                	pop    %r12
+  802622:	41 5d                	pop    %r13
+  802624:	5d                   	pop    %rbp
+  802625:	c3                   	ret
+        fd_close(fd, 0);
+  802626:	be 00 00 00 00       	mov    $0x0,%esi
+  80262b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80262f:	48 b8 a2 1d 80 00 00 	movabs $0x801da2,%rax
+  802636:	00 00 00 
+  802639:	ff d0                	call   *%rax
+        return res;
+  80263b:	eb dc                	jmp    802619 <open+0x91>
+        return -E_BAD_PATH;
+  80263d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802642:	eb d5                	jmp    802619 <open+0x91>
+
+0000000000802644 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802644:	55                   	push   %rbp
+  802645:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802648:	be 00 00 00 00       	mov    $0x0,%esi
+  80264d:	bf 08 00 00 00       	mov    $0x8,%edi
+  802652:	48 b8 54 23 80 00 00 	movabs $0x802354,%rax
+  802659:	00 00 00 
+  80265c:	ff d0                	call   *%rax
+}
+  80265e:	5d                   	pop    %rbp
+  80265f:	c3                   	ret
+
+0000000000802660 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802660:	55                   	push   %rbp
+  802661:	48 89 e5             	mov    %rsp,%rbp
+  802664:	41 54                	push   %r12
+  802666:	53                   	push   %rbx
+  802667:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80266a:	48 b8 6b 1c 80 00 00 	movabs $0x801c6b,%rax
+  802671:	00 00 00 
+  802674:	ff d0                	call   *%rax
+  802676:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802679:	48 be e0 36 80 00 00 	movabs $0x8036e0,%rsi
+  802680:	00 00 00 
+  802683:	48 89 df             	mov    %rbx,%rdi
+  802686:	48 b8 82 0e 80 00 00 	movabs $0x800e82,%rax
+  80268d:	00 00 00 
+  802690:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802692:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802697:	41 2b 04 24          	sub    (%r12),%eax
+  80269b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8026a1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8026a8:	00 00 00 
+    stat->st_dev = &devpipe;
+  8026ab:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8026b2:	00 00 00 
+  8026b5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8026bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026c1:	5b                   	pop    %rbx
+  8026c2:	41 5c                	pop    %r12
+  8026c4:	5d                   	pop    %rbp
+  8026c5:	c3                   	ret
+
+00000000008026c6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8026c6:	55                   	push   %rbp
+  8026c7:	48 89 e5             	mov    %rsp,%rbp
+  8026ca:	41 54                	push   %r12
+  8026cc:	53                   	push   %rbx
+  8026cd:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8026d0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026d5:	48 89 fe             	mov    %rdi,%rsi
+  8026d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026dd:	49 bc fe 14 80 00 00 	movabs $0x8014fe,%r12
+  8026e4:	00 00 00 
+  8026e7:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8026ea:	48 89 df             	mov    %rbx,%rdi
+  8026ed:	48 b8 6b 1c 80 00 00 	movabs $0x801c6b,%rax
+  8026f4:	00 00 00 
+  8026f7:	ff d0                	call   *%rax
+  8026f9:	48 89 c6             	mov    %rax,%rsi
+  8026fc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802701:	bf 00 00 00 00       	mov    $0x0,%edi
+  802706:	41 ff d4             	call   *%r12
+}
+  802709:	5b                   	pop    %rbx
+  80270a:	41 5c                	pop    %r12
+  80270c:	5d                   	pop    %rbp
+  80270d:	c3                   	ret
+
+000000000080270e <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80270e:	55                   	push   %rbp
+  80270f:	48 89 e5             	mov    %rsp,%rbp
+  802712:	41 57                	push   %r15
+  802714:	41 56                	push   %r14
+  802716:	41 55                	push   %r13
+  802718:	41 54                	push   %r12
+  80271a:	53                   	push   %rbx
+  80271b:	48 83 ec 18          	sub    $0x18,%rsp
+  80271f:	49 89 fc             	mov    %rdi,%r12
+  802722:	49 89 f5             	mov    %rsi,%r13
+  802725:	49 89 d7             	mov    %rdx,%r15
+  802728:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80272c:	48 b8 6b 1c 80 00 00 	movabs $0x801c6b,%rax
+  802733:	00 00 00 
+  802736:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802738:	4d 85 ff             	test   %r15,%r15
+  80273b:	0f 84 af 00 00 00    	je     8027f0 <devpipe_write+0xe2>
+  802741:	48 89 c3             	mov    %rax,%rbx
+  802744:	4c 89 f8             	mov    %r15,%rax
+  802747:	4d 89 ef             	mov    %r13,%r15
+  80274a:	4c 01 e8             	add    %r13,%rax
+  80274d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802751:	49 bd 06 14 80 00 00 	movabs $0x801406,%r13
+  802758:	00 00 00 
+            sys_yield();
+  80275b:	49 be a3 13 80 00 00 	movabs $0x8013a3,%r14
+  802762:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802765:	8b 73 04             	mov    0x4(%rbx),%esi
+  802768:	48 63 ce             	movslq %esi,%rcx
+  80276b:	48 63 03             	movslq (%rbx),%rax
+  80276e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802774:	48 39 c1             	cmp    %rax,%rcx
+  802777:	72 2e                	jb     8027a7 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802779:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80277e:	48 89 da             	mov    %rbx,%rdx
+  802781:	be 00 10 00 00       	mov    $0x1000,%esi
+  802786:	4c 89 e7             	mov    %r12,%rdi
+  802789:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80278c:	85 c0                	test   %eax,%eax
+  80278e:	74 66                	je     8027f6 <devpipe_write+0xe8>
+            sys_yield();
+  802790:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802793:	8b 73 04             	mov    0x4(%rbx),%esi
+  802796:	48 63 ce             	movslq %esi,%rcx
+  802799:	48 63 03             	movslq (%rbx),%rax
+  80279c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8027a2:	48 39 c1             	cmp    %rax,%rcx
+  8027a5:	73 d2                	jae    802779 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8027a7:	41 0f b6 3f          	movzbl (%r15),%edi
+  8027ab:	48 89 ca             	mov    %rcx,%rdx
+  8027ae:	48 c1 ea 03          	shr    $0x3,%rdx
+  8027b2:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8027b9:	08 10 20 
+  8027bc:	48 f7 e2             	mul    %rdx
+  8027bf:	48 c1 ea 06          	shr    $0x6,%rdx
+  8027c3:	48 89 d0             	mov    %rdx,%rax
+  8027c6:	48 c1 e0 09          	shl    $0x9,%rax
+  8027ca:	48 29 d0             	sub    %rdx,%rax
+  8027cd:	48 c1 e0 03          	shl    $0x3,%rax
+  8027d1:	48 29 c1             	sub    %rax,%rcx
+  8027d4:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8027d9:	83 c6 01             	add    $0x1,%esi
+  8027dc:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8027df:	49 83 c7 01          	add    $0x1,%r15
+  8027e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027e7:	49 39 c7             	cmp    %rax,%r15
+  8027ea:	0f 85 75 ff ff ff    	jne    802765 <devpipe_write+0x57>
+    return n;
+  8027f0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8027f4:	eb 05                	jmp    8027fb <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8027f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027fb:	48 83 c4 18          	add    $0x18,%rsp
+  8027ff:	5b                   	pop    %rbx
+  802800:	41 5c                	pop    %r12
+  802802:	41 5d                	pop    %r13
+  802804:	41 5e                	pop    %r14
+  802806:	41 5f                	pop    %r15
+  802808:	5d                   	pop    %rbp
+  802809:	c3                   	ret
+
+000000000080280a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80280a:	55                   	push   %rbp
+  80280b:	48 89 e5             	mov    %rsp,%rbp
+  80280e:	41 57                	push   %r15
+  802810:	41 56                	push   %r14
+  802812:	41 55                	push   %r13
+  802814:	41 54                	push   %r12
+  802816:	53                   	push   %rbx
+  802817:	48 83 ec 18          	sub    $0x18,%rsp
+  80281b:	49 89 fc             	mov    %rdi,%r12
+  80281e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802822:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802826:	48 b8 6b 1c 80 00 00 	movabs $0x801c6b,%rax
+  80282d:	00 00 00 
+  802830:	ff d0                	call   *%rax
+  802832:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802835:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80283b:	49 bd 06 14 80 00 00 	movabs $0x801406,%r13
+  802842:	00 00 00 
+            sys_yield();
+  802845:	49 be a3 13 80 00 00 	movabs $0x8013a3,%r14
+  80284c:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80284f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802854:	74 7d                	je     8028d3 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802856:	8b 03                	mov    (%rbx),%eax
+  802858:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80285b:	75 26                	jne    802883 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80285d:	4d 85 ff             	test   %r15,%r15
+  802860:	75 77                	jne    8028d9 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802862:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802867:	48 89 da             	mov    %rbx,%rdx
+  80286a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80286f:	4c 89 e7             	mov    %r12,%rdi
+  802872:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802875:	85 c0                	test   %eax,%eax
+  802877:	74 72                	je     8028eb <devpipe_read+0xe1>
+            sys_yield();
+  802879:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80287c:	8b 03                	mov    (%rbx),%eax
+  80287e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802881:	74 df                	je     802862 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802883:	48 63 c8             	movslq %eax,%rcx
+  802886:	48 89 ca             	mov    %rcx,%rdx
+  802889:	48 c1 ea 03          	shr    $0x3,%rdx
+  80288d:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802894:	08 10 20 
+  802897:	48 89 d0             	mov    %rdx,%rax
+  80289a:	48 f7 e6             	mul    %rsi
+  80289d:	48 c1 ea 06          	shr    $0x6,%rdx
+  8028a1:	48 89 d0             	mov    %rdx,%rax
+  8028a4:	48 c1 e0 09          	shl    $0x9,%rax
+  8028a8:	48 29 d0             	sub    %rdx,%rax
+  8028ab:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8028b2:	00 
+  8028b3:	48 89 c8             	mov    %rcx,%rax
+  8028b6:	48 29 d0             	sub    %rdx,%rax
+  8028b9:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8028be:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8028c2:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8028c6:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8028c9:	49 83 c7 01          	add    $0x1,%r15
+  8028cd:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8028d1:	75 83                	jne    802856 <devpipe_read+0x4c>
+    return n;
+  8028d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028d7:	eb 03                	jmp    8028dc <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8028d9:	4c 89 f8             	mov    %r15,%rax
+}
+  8028dc:	48 83 c4 18          	add    $0x18,%rsp
+  8028e0:	5b                   	pop    %rbx
+  8028e1:	41 5c                	pop    %r12
+  8028e3:	41 5d                	pop    %r13
+  8028e5:	41 5e                	pop    %r14
+  8028e7:	41 5f                	pop    %r15
+  8028e9:	5d                   	pop    %rbp
+  8028ea:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8028eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f0:	eb ea                	jmp    8028dc <devpipe_read+0xd2>
+
+00000000008028f2 <pipe>:
+pipe(int pfd[2]) {
+  8028f2:	55                   	push   %rbp
+  8028f3:	48 89 e5             	mov    %rsp,%rbp
+  8028f6:	41 55                	push   %r13
+  8028f8:	41 54                	push   %r12
+  8028fa:	53                   	push   %rbx
+  8028fb:	48 83 ec 18          	sub    $0x18,%rsp
+  8028ff:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802902:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802906:	48 b8 87 1c 80 00 00 	movabs $0x801c87,%rax
+  80290d:	00 00 00 
+  802910:	ff d0                	call   *%rax
+  802912:	89 c3                	mov    %eax,%ebx
+  802914:	85 c0                	test   %eax,%eax
+  802916:	0f 88 a0 01 00 00    	js     802abc <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80291c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802921:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802926:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80292a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80292f:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  802936:	00 00 00 
+  802939:	ff d0                	call   *%rax
+  80293b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80293d:	85 c0                	test   %eax,%eax
+  80293f:	0f 88 77 01 00 00    	js     802abc <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802945:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802949:	48 b8 87 1c 80 00 00 	movabs $0x801c87,%rax
+  802950:	00 00 00 
+  802953:	ff d0                	call   *%rax
+  802955:	89 c3                	mov    %eax,%ebx
+  802957:	85 c0                	test   %eax,%eax
+  802959:	0f 88 43 01 00 00    	js     802aa2 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80295f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802964:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802969:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80296d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802972:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  802979:	00 00 00 
+  80297c:	ff d0                	call   *%rax
+  80297e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802980:	85 c0                	test   %eax,%eax
+  802982:	0f 88 1a 01 00 00    	js     802aa2 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802988:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80298c:	48 b8 6b 1c 80 00 00 	movabs $0x801c6b,%rax
+  802993:	00 00 00 
+  802996:	ff d0                	call   *%rax
+  802998:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80299b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8029a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029a5:	48 89 c6             	mov    %rax,%rsi
+  8029a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029ad:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  8029b4:	00 00 00 
+  8029b7:	ff d0                	call   *%rax
+  8029b9:	89 c3                	mov    %eax,%ebx
+  8029bb:	85 c0                	test   %eax,%eax
+  8029bd:	0f 88 c5 00 00 00    	js     802a88 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8029c3:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8029c7:	48 b8 6b 1c 80 00 00 	movabs $0x801c6b,%rax
+  8029ce:	00 00 00 
+  8029d1:	ff d0                	call   *%rax
+  8029d3:	48 89 c1             	mov    %rax,%rcx
+  8029d6:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8029dc:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8029e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029e7:	4c 89 ee             	mov    %r13,%rsi
+  8029ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029ef:	48 b8 99 14 80 00 00 	movabs $0x801499,%rax
+  8029f6:	00 00 00 
+  8029f9:	ff d0                	call   *%rax
+  8029fb:	89 c3                	mov    %eax,%ebx
+  8029fd:	85 c0                	test   %eax,%eax
+  8029ff:	78 6e                	js     802a6f <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802a01:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a06:	4c 89 ef             	mov    %r13,%rdi
+  802a09:	48 b8 d4 13 80 00 00 	movabs $0x8013d4,%rax
+  802a10:	00 00 00 
+  802a13:	ff d0                	call   *%rax
+  802a15:	83 f8 02             	cmp    $0x2,%eax
+  802a18:	0f 85 ab 00 00 00    	jne    802ac9 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802a1e:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802a25:	00 00 
+  802a27:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802a2b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802a2d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802a31:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802a38:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802a3c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802a3e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a42:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802a49:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802a4d:	48 bb 59 1c 80 00 00 	movabs $0x801c59,%rbx
+  802a54:	00 00 00 
+  802a57:	ff d3                	call   *%rbx
+  802a59:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802a5d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802a61:	ff d3                	call   *%rbx
+  802a63:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802a68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a6d:	eb 4d                	jmp    802abc <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802a6f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a74:	4c 89 ee             	mov    %r13,%rsi
+  802a77:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a7c:	48 b8 fe 14 80 00 00 	movabs $0x8014fe,%rax
+  802a83:	00 00 00 
+  802a86:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802a88:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a8d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802a91:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a96:	48 b8 fe 14 80 00 00 	movabs $0x8014fe,%rax
+  802a9d:	00 00 00 
+  802aa0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802aa2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802aa7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802aab:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ab0:	48 b8 fe 14 80 00 00 	movabs $0x8014fe,%rax
+  802ab7:	00 00 00 
+  802aba:	ff d0                	call   *%rax
+}
+  802abc:	89 d8                	mov    %ebx,%eax
+  802abe:	48 83 c4 18          	add    $0x18,%rsp
+  802ac2:	5b                   	pop    %rbx
+  802ac3:	41 5c                	pop    %r12
+  802ac5:	41 5d                	pop    %r13
+  802ac7:	5d                   	pop    %rbp
+  802ac8:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802ac9:	48 b9 10 37 80 00 00 	movabs $0x803710,%rcx
+  802ad0:	00 00 00 
+  802ad3:	48 ba e7 36 80 00 00 	movabs $0x8036e7,%rdx
+  802ada:	00 00 00 
+  802add:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802ae2:	48 bf fc 36 80 00 00 	movabs $0x8036fc,%rdi
+  802ae9:	00 00 00 
+  802aec:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af1:	49 b8 0d 04 80 00 00 	movabs $0x80040d,%r8
+  802af8:	00 00 00 
+  802afb:	41 ff d0             	call   *%r8
+
+0000000000802afe <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802afe:	55                   	push   %rbp
+  802aff:	48 89 e5             	mov    %rsp,%rbp
+  802b02:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b06:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b0a:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  802b11:	00 00 00 
+  802b14:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b16:	85 c0                	test   %eax,%eax
+  802b18:	78 35                	js     802b4f <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802b1a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802b1e:	48 b8 6b 1c 80 00 00 	movabs $0x801c6b,%rax
+  802b25:	00 00 00 
+  802b28:	ff d0                	call   *%rax
+  802b2a:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802b2d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b32:	be 00 10 00 00       	mov    $0x1000,%esi
+  802b37:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802b3b:	48 b8 06 14 80 00 00 	movabs $0x801406,%rax
+  802b42:	00 00 00 
+  802b45:	ff d0                	call   *%rax
+  802b47:	85 c0                	test   %eax,%eax
+  802b49:	0f 94 c0             	sete   %al
+  802b4c:	0f b6 c0             	movzbl %al,%eax
+}
+  802b4f:	c9                   	leave
+  802b50:	c3                   	ret
+
+0000000000802b51 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802b51:	48 89 f8             	mov    %rdi,%rax
+  802b54:	48 c1 e8 27          	shr    $0x27,%rax
+  802b58:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802b5f:	01 00 00 
+  802b62:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b66:	f6 c2 01             	test   $0x1,%dl
+  802b69:	74 6d                	je     802bd8 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802b6b:	48 89 f8             	mov    %rdi,%rax
+  802b6e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b72:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802b79:	01 00 00 
+  802b7c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b80:	f6 c2 01             	test   $0x1,%dl
+  802b83:	74 62                	je     802be7 <get_uvpt_entry+0x96>
+  802b85:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802b8c:	01 00 00 
+  802b8f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b93:	f6 c2 80             	test   $0x80,%dl
+  802b96:	75 4f                	jne    802be7 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802b98:	48 89 f8             	mov    %rdi,%rax
+  802b9b:	48 c1 e8 15          	shr    $0x15,%rax
+  802b9f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802ba6:	01 00 00 
+  802ba9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802bad:	f6 c2 01             	test   $0x1,%dl
+  802bb0:	74 44                	je     802bf6 <get_uvpt_entry+0xa5>
+  802bb2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802bb9:	01 00 00 
+  802bbc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802bc0:	f6 c2 80             	test   $0x80,%dl
+  802bc3:	75 31                	jne    802bf6 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802bc5:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802bc9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802bd0:	01 00 00 
+  802bd3:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802bd7:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802bd8:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802bdf:	01 00 00 
+  802be2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802be6:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802be7:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802bee:	01 00 00 
+  802bf1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802bf5:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802bf6:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802bfd:	01 00 00 
+  802c00:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c04:	c3                   	ret
+
+0000000000802c05 <get_prot>:
+
+int
+get_prot(void *va) {
+  802c05:	55                   	push   %rbp
+  802c06:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802c09:	48 b8 51 2b 80 00 00 	movabs $0x802b51,%rax
+  802c10:	00 00 00 
+  802c13:	ff d0                	call   *%rax
+  802c15:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802c18:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802c1d:	89 c1                	mov    %eax,%ecx
+  802c1f:	83 c9 04             	or     $0x4,%ecx
+  802c22:	f6 c2 01             	test   $0x1,%dl
+  802c25:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802c28:	89 c1                	mov    %eax,%ecx
+  802c2a:	83 c9 02             	or     $0x2,%ecx
+  802c2d:	f6 c2 02             	test   $0x2,%dl
+  802c30:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802c33:	89 c1                	mov    %eax,%ecx
+  802c35:	83 c9 01             	or     $0x1,%ecx
+  802c38:	48 85 d2             	test   %rdx,%rdx
+  802c3b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802c3e:	89 c1                	mov    %eax,%ecx
+  802c40:	83 c9 40             	or     $0x40,%ecx
+  802c43:	f6 c6 04             	test   $0x4,%dh
+  802c46:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802c49:	5d                   	pop    %rbp
+  802c4a:	c3                   	ret
+
+0000000000802c4b <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802c4b:	55                   	push   %rbp
+  802c4c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802c4f:	48 b8 51 2b 80 00 00 	movabs $0x802b51,%rax
+  802c56:	00 00 00 
+  802c59:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802c5b:	48 c1 e8 06          	shr    $0x6,%rax
+  802c5f:	83 e0 01             	and    $0x1,%eax
+}
+  802c62:	5d                   	pop    %rbp
+  802c63:	c3                   	ret
+
+0000000000802c64 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802c64:	55                   	push   %rbp
+  802c65:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802c68:	48 b8 51 2b 80 00 00 	movabs $0x802b51,%rax
+  802c6f:	00 00 00 
+  802c72:	ff d0                	call   *%rax
+  802c74:	83 e0 01             	and    $0x1,%eax
+}
+  802c77:	5d                   	pop    %rbp
+  802c78:	c3                   	ret
+
+0000000000802c79 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802c79:	55                   	push   %rbp
+  802c7a:	48 89 e5             	mov    %rsp,%rbp
+  802c7d:	41 57                	push   %r15
+  802c7f:	41 56                	push   %r14
+  802c81:	41 55                	push   %r13
+  802c83:	41 54                	push   %r12
+  802c85:	53                   	push   %rbx
+  802c86:	48 83 ec 18          	sub    $0x18,%rsp
+  802c8a:	49 89 ff             	mov    %rdi,%r15
+  802c8d:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802c91:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802c96:	49 bc 64 2c 80 00 00 	movabs $0x802c64,%r12
+  802c9d:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802ca0:	49 be 05 2c 80 00 00 	movabs $0x802c05,%r14
+  802ca7:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802caa:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802cb1:	00 00 00 
+  802cb4:	eb 0c                	jmp    802cc2 <foreach_shared_region+0x49>
+  802cb6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802cbd:	4c 39 eb             	cmp    %r13,%rbx
+  802cc0:	74 38                	je     802cfa <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802cc2:	48 89 df             	mov    %rbx,%rdi
+  802cc5:	41 ff d4             	call   *%r12
+  802cc8:	84 c0                	test   %al,%al
+  802cca:	74 ea                	je     802cb6 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802ccc:	48 89 df             	mov    %rbx,%rdi
+  802ccf:	41 ff d6             	call   *%r14
+  802cd2:	a8 40                	test   $0x40,%al
+  802cd4:	74 e0                	je     802cb6 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802cd6:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802cdd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802ce1:	48 89 df             	mov    %rbx,%rdi
+  802ce4:	41 ff d7             	call   *%r15
+        if (err)
+  802ce7:	85 c0                	test   %eax,%eax
+  802ce9:	74 cb                	je     802cb6 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802ceb:	48 83 c4 18          	add    $0x18,%rsp
+  802cef:	5b                   	pop    %rbx
+  802cf0:	41 5c                	pop    %r12
+  802cf2:	41 5d                	pop    %r13
+  802cf4:	41 5e                	pop    %r14
+  802cf6:	41 5f                	pop    %r15
+  802cf8:	5d                   	pop    %rbp
+  802cf9:	c3                   	ret
+    return 0;
+  802cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cff:	eb ea                	jmp    802ceb <foreach_shared_region+0x72>
+
+0000000000802d01 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802d01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d06:	c3                   	ret
+
+0000000000802d07 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802d07:	55                   	push   %rbp
+  802d08:	48 89 e5             	mov    %rsp,%rbp
+  802d0b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802d0e:	48 be 34 37 80 00 00 	movabs $0x803734,%rsi
+  802d15:	00 00 00 
+  802d18:	48 b8 82 0e 80 00 00 	movabs $0x800e82,%rax
+  802d1f:	00 00 00 
+  802d22:	ff d0                	call   *%rax
+    return 0;
+}
+  802d24:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d29:	5d                   	pop    %rbp
+  802d2a:	c3                   	ret
+
+0000000000802d2b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d2b:	55                   	push   %rbp
+  802d2c:	48 89 e5             	mov    %rsp,%rbp
+  802d2f:	41 57                	push   %r15
+  802d31:	41 56                	push   %r14
+  802d33:	41 55                	push   %r13
+  802d35:	41 54                	push   %r12
+  802d37:	53                   	push   %rbx
+  802d38:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802d3f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802d46:	48 85 d2             	test   %rdx,%rdx
+  802d49:	74 7a                	je     802dc5 <devcons_write+0x9a>
+  802d4b:	49 89 d6             	mov    %rdx,%r14
+  802d4e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d54:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802d59:	49 bf 7c 10 80 00 00 	movabs $0x80107c,%r15
+  802d60:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802d63:	4c 89 f3             	mov    %r14,%rbx
+  802d66:	48 29 f3             	sub    %rsi,%rbx
+  802d69:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d6e:	48 39 c3             	cmp    %rax,%rbx
+  802d71:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802d75:	4c 63 eb             	movslq %ebx,%r13
+  802d78:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d7f:	48 01 c6             	add    %rax,%rsi
+  802d82:	4c 89 ea             	mov    %r13,%rdx
+  802d85:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d8c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802d8f:	4c 89 ee             	mov    %r13,%rsi
+  802d92:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d99:	48 b8 a9 12 80 00 00 	movabs $0x8012a9,%rax
+  802da0:	00 00 00 
+  802da3:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802da5:	41 01 dc             	add    %ebx,%r12d
+  802da8:	49 63 f4             	movslq %r12d,%rsi
+  802dab:	4c 39 f6             	cmp    %r14,%rsi
+  802dae:	72 b3                	jb     802d63 <devcons_write+0x38>
+    return res;
+  802db0:	49 63 c4             	movslq %r12d,%rax
+}
+  802db3:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802dba:	5b                   	pop    %rbx
+  802dbb:	41 5c                	pop    %r12
+  802dbd:	41 5d                	pop    %r13
+  802dbf:	41 5e                	pop    %r14
+  802dc1:	41 5f                	pop    %r15
+  802dc3:	5d                   	pop    %rbp
+  802dc4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802dc5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802dcb:	eb e3                	jmp    802db0 <devcons_write+0x85>
+
+0000000000802dcd <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dcd:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802dd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dd5:	48 85 c0             	test   %rax,%rax
+  802dd8:	74 55                	je     802e2f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dda:	55                   	push   %rbp
+  802ddb:	48 89 e5             	mov    %rsp,%rbp
+  802dde:	41 55                	push   %r13
+  802de0:	41 54                	push   %r12
+  802de2:	53                   	push   %rbx
+  802de3:	48 83 ec 08          	sub    $0x8,%rsp
+  802de7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802dea:	48 bb d6 12 80 00 00 	movabs $0x8012d6,%rbx
+  802df1:	00 00 00 
+  802df4:	49 bc a3 13 80 00 00 	movabs $0x8013a3,%r12
+  802dfb:	00 00 00 
+  802dfe:	eb 03                	jmp    802e03 <devcons_read+0x36>
+  802e00:	41 ff d4             	call   *%r12
+  802e03:	ff d3                	call   *%rbx
+  802e05:	85 c0                	test   %eax,%eax
+  802e07:	74 f7                	je     802e00 <devcons_read+0x33>
+    if (c < 0) return c;
+  802e09:	48 63 d0             	movslq %eax,%rdx
+  802e0c:	78 13                	js     802e21 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802e0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e13:	83 f8 04             	cmp    $0x4,%eax
+  802e16:	74 09                	je     802e21 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e18:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e1c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e21:	48 89 d0             	mov    %rdx,%rax
+  802e24:	48 83 c4 08          	add    $0x8,%rsp
+  802e28:	5b                   	pop    %rbx
+  802e29:	41 5c                	pop    %r12
+  802e2b:	41 5d                	pop    %r13
+  802e2d:	5d                   	pop    %rbp
+  802e2e:	c3                   	ret
+  802e2f:	48 89 d0             	mov    %rdx,%rax
+  802e32:	c3                   	ret
+
+0000000000802e33 <cputchar>:
+cputchar(int ch) {
+  802e33:	55                   	push   %rbp
+  802e34:	48 89 e5             	mov    %rsp,%rbp
+  802e37:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e3b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802e3f:	be 01 00 00 00       	mov    $0x1,%esi
+  802e44:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802e48:	48 b8 a9 12 80 00 00 	movabs $0x8012a9,%rax
+  802e4f:	00 00 00 
+  802e52:	ff d0                	call   *%rax
+}
+  802e54:	c9                   	leave
+  802e55:	c3                   	ret
+
+0000000000802e56 <getchar>:
+getchar(void) {
+  802e56:	55                   	push   %rbp
+  802e57:	48 89 e5             	mov    %rsp,%rbp
+  802e5a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802e5e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e63:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802e67:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e6c:	48 b8 ca 1f 80 00 00 	movabs $0x801fca,%rax
+  802e73:	00 00 00 
+  802e76:	ff d0                	call   *%rax
+  802e78:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e7a:	85 c0                	test   %eax,%eax
+  802e7c:	78 06                	js     802e84 <getchar+0x2e>
+  802e7e:	74 08                	je     802e88 <getchar+0x32>
+  802e80:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e84:	89 d0                	mov    %edx,%eax
+  802e86:	c9                   	leave
+  802e87:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e88:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802e8d:	eb f5                	jmp    802e84 <getchar+0x2e>
+
+0000000000802e8f <iscons>:
+iscons(int fdnum) {
+  802e8f:	55                   	push   %rbp
+  802e90:	48 89 e5             	mov    %rsp,%rbp
+  802e93:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802e97:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e9b:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  802ea2:	00 00 00 
+  802ea5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ea7:	85 c0                	test   %eax,%eax
+  802ea9:	78 18                	js     802ec3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802eab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802eaf:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802eb6:	00 00 00 
+  802eb9:	8b 00                	mov    (%rax),%eax
+  802ebb:	39 02                	cmp    %eax,(%rdx)
+  802ebd:	0f 94 c0             	sete   %al
+  802ec0:	0f b6 c0             	movzbl %al,%eax
+}
+  802ec3:	c9                   	leave
+  802ec4:	c3                   	ret
+
+0000000000802ec5 <opencons>:
+opencons(void) {
+  802ec5:	55                   	push   %rbp
+  802ec6:	48 89 e5             	mov    %rsp,%rbp
+  802ec9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ecd:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802ed1:	48 b8 87 1c 80 00 00 	movabs $0x801c87,%rax
+  802ed8:	00 00 00 
+  802edb:	ff d0                	call   *%rax
+  802edd:	85 c0                	test   %eax,%eax
+  802edf:	78 49                	js     802f2a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802ee1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ee6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802eeb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802eef:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ef4:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  802efb:	00 00 00 
+  802efe:	ff d0                	call   *%rax
+  802f00:	85 c0                	test   %eax,%eax
+  802f02:	78 26                	js     802f2a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802f04:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f08:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802f0f:	00 00 
+  802f11:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f13:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f17:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f1e:	48 b8 59 1c 80 00 00 	movabs $0x801c59,%rax
+  802f25:	00 00 00 
+  802f28:	ff d0                	call   *%rax
+}
+  802f2a:	c9                   	leave
+  802f2b:	c3                   	ret
+  802f2c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000802f30 <__rodata_start>:
+  802f30:	74 65                	je     802f97 <__rodata_start+0x67>
+  802f32:	73 74                	jae    802fa8 <__rodata_start+0x78>
+  802f34:	69 6e 67 20 66 6f 72 	imul   $0x726f6620,0x67(%rsi),%ebp
+  802f3b:	20 64 75 70          	and    %ah,0x70(%rbp,%rsi,2)
+  802f3f:	20 72 61             	and    %dh,0x61(%rdx)
+  802f42:	63 65 2e             	movsxd 0x2e(%rbp),%esp
+  802f45:	2e 2e 0a 00          	cs cs or (%rax),%al
+  802f49:	70 69                	jo     802fb4 <__rodata_start+0x84>
+  802f4b:	70 65                	jo     802fb2 <__rodata_start+0x82>
+  802f4d:	3a 20                	cmp    (%rax),%ah
+  802f4f:	25 69 00 75 73       	and    $0x73750069,%eax
+  802f54:	65 72 2f             	gs jb  802f86 <__rodata_start+0x56>
+  802f57:	74 65                	je     802fbe <__rodata_start+0x8e>
+  802f59:	73 74                	jae    802fcf <__rodata_start+0x9f>
+  802f5b:	70 69                	jo     802fc6 <__rodata_start+0x96>
+  802f5d:	70 65                	jo     802fc4 <__rodata_start+0x94>
+  802f5f:	72 61                	jb     802fc2 <__rodata_start+0x92>
+  802f61:	63 65 2e             	movsxd 0x2e(%rbp),%esp
+  802f64:	63 00                	movsxd (%rax),%eax
+  802f66:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802f68:	72 6b                	jb     802fd5 <__rodata_start+0xa5>
+  802f6a:	3a 20                	cmp    (%rax),%ah
+  802f6c:	25 69 00 52 41       	and    $0x41520069,%eax
+  802f71:	43                   	rex.XB
+  802f72:	45 3a 20             	cmp    (%r8),%r12b
+  802f75:	70 69                	jo     802fe0 <__rodata_start+0xb0>
+  802f77:	70 65                	jo     802fde <__rodata_start+0xae>
+  802f79:	20 61 70             	and    %ah,0x70(%rcx)
+  802f7c:	70 65                	jo     802fe3 <__rodata_start+0xb3>
+  802f7e:	61                   	(bad)
+  802f7f:	72 73                	jb     802ff4 <__rodata_start+0xc4>
+  802f81:	20 63 6c             	and    %ah,0x6c(%rbx)
+  802f84:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f85:	73 65                	jae    802fec <__rodata_start+0xbc>
+  802f87:	64 0a 00             	or     %fs:(%rax),%al
+  802f8a:	70 69                	jo     802ff5 <__rodata_start+0xc5>
+  802f8c:	64 20 69 73          	and    %ch,%fs:0x73(%rcx)
+  802f90:	20 25 64 0a 00 6b    	and    %ah,0x6b000a64(%rip)        # 6b8039fa <__bss_end+0x6affb9fa>
+  802f96:	69 64 20 69 73 20 25 	imul   $0x64252073,0x69(%rax,%riz,1),%esp
+  802f9d:	64 
+  802f9e:	0a 00                	or     (%rax),%al
+  802fa0:	63 68 69             	movsxd 0x69(%rax),%ebp
+  802fa3:	6c                   	insb   (%dx),%es:(%rdi)
+  802fa4:	64 20 64 6f 6e       	and    %ah,%fs:0x6e(%rdi,%rbp,2)
+  802fa9:	65 20 77 69          	and    %dh,%gs:0x69(%rdi)
+  802fad:	74 68                	je     803017 <__rodata_start+0xe7>
+  802faf:	20 6c 6f 6f          	and    %ch,0x6f(%rdi,%rbp,2)
+  802fb3:	70 0a                	jo     802fbf <__rodata_start+0x8f>
+  802fb5:	00 63 61             	add    %ah,0x61(%rbx)
+  802fb8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fb9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fbb:	74 20                	je     802fdd <__rodata_start+0xad>
+  802fbd:	6c                   	insb   (%dx),%es:(%rdi)
+  802fbe:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fbf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fc0:	6b 20 75             	imul   $0x75,(%rax),%esp
+  802fc3:	70 20                	jo     802fe5 <__rodata_start+0xb5>
+  802fc5:	70 5b                	jo     803022 <__rodata_start+0xf2>
+  802fc7:	30 5d 3a             	xor    %bl,0x3a(%rbp)
+  802fca:	20 25 69 00 0a 63    	and    %ah,0x630a0069(%rip)        # 638a3039 <__bss_end+0x6309b039>
+  802fd0:	68 69 6c 64 20       	push   $0x20646c69
+  802fd5:	64 65 74 65          	fs gs je 80303e <__rodata_start+0x10e>
+  802fd9:	63 74 65 64          	movsxd 0x64(%rbp,%riz,2),%esi
+  802fdd:	20 72 61             	and    %dh,0x61(%rdx)
+  802fe0:	63 65 0a             	movsxd 0xa(%rbp),%esp
+  802fe3:	00 0f                	add    %cl,(%rdi)
+  802fe5:	1f                   	(bad)
+  802fe6:	40 00 73 6f          	add    %sil,0x6f(%rbx)
+  802fea:	6d                   	insl   (%dx),%es:(%rdi)
+  802feb:	65 68 6f 77 20 74    	gs push $0x7420776f
+  802ff1:	68 65 20 6f 74       	push   $0x746f2065
+  802ff6:	68 65 72 20 65       	push   $0x65207265
+  802ffb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ffc:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803000:	20 70 5b             	and    %dh,0x5b(%rax)
+  803003:	30 5d 20             	xor    %bl,0x20(%rbp)
+  803006:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803008:	74 20                	je     80302a <__rodata_start+0xfa>
+  80300a:	63 6c 6f 73          	movsxd 0x73(%rdi,%rbp,2),%ebp
+  80300e:	65 64 21 00          	gs and %eax,%fs:(%rax)
+  803012:	00 00                	add    %al,(%rax)
+  803014:	00 00                	add    %al,(%rax)
+  803016:	00 00                	add    %al,(%rax)
+  803018:	0a 72 61             	or     0x61(%rdx),%dh
+  80301b:	63 65 20             	movsxd 0x20(%rbp),%esp
+  80301e:	64 69 64 6e 27 74 20 	imul   $0x61682074,%fs:0x27(%rsi,%rbp,2),%esp
+  803025:	68 61 
+  803027:	70 70                	jo     803099 <__rodata_start+0x169>
+  803029:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80302b:	20 28                	and    %ch,(%rax)
+  80302d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80302e:	75 6d                	jne    80309d <__rodata_start+0x16d>
+  803030:	62 65                	(bad)
+  803032:	72 20                	jb     803054 <__rodata_start+0x124>
+  803034:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803035:	66 20 74 65 73       	data16 and %dh,0x73(%rbp,%riz,2)
+  80303a:	74 73                	je     8030af <__rodata_start+0x17f>
+  80303c:	3a 20                	cmp    (%rax),%ah
+  80303e:	25 64 29 0a 00       	and    $0xa2964,%eax
+  803043:	3c 75                	cmp    $0x75,%al
+  803045:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803046:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80304a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80304b:	3e 00 0f             	ds add %cl,(%rdi)
+  80304e:	1f                   	(bad)
+  80304f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803052:	30 38                	xor    %bh,(%rax)
+  803054:	78 5d                	js     8030b3 <__rodata_start+0x183>
+  803056:	20 75 73             	and    %dh,0x73(%rbp)
+  803059:	65 72 20             	gs jb  80307c <__rodata_start+0x14c>
+  80305c:	70 61                	jo     8030bf <__rodata_start+0x18f>
+  80305e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80305f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803066:	73 20                	jae    803088 <__rodata_start+0x158>
+  803068:	61                   	(bad)
+  803069:	74 20                	je     80308b <__rodata_start+0x15b>
+  80306b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803070:	3a 20                	cmp    (%rax),%ah
+  803072:	00 30                	add    %dh,(%rax)
+  803074:	31 32                	xor    %esi,(%rdx)
+  803076:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80307d:	41                   	rex.B
+  80307e:	42                   	rex.X
+  80307f:	43                   	rex.XB
+  803080:	44                   	rex.R
+  803081:	45                   	rex.RB
+  803082:	46 00 30             	rex.RX add %r14b,(%rax)
+  803085:	31 32                	xor    %esi,(%rdx)
+  803087:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80308e:	61                   	(bad)
+  80308f:	62 63 64 65 66       	(bad)
+  803094:	00 28                	add    %ch,(%rax)
+  803096:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803097:	75 6c                	jne    803105 <__rodata_start+0x1d5>
+  803099:	6c                   	insb   (%dx),%es:(%rdi)
+  80309a:	29 00                	sub    %eax,(%rax)
+  80309c:	65 72 72             	gs jb  803111 <__rodata_start+0x1e1>
+  80309f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030a0:	72 20                	jb     8030c2 <__rodata_start+0x192>
+  8030a2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8030a7:	73 70                	jae    803119 <__rodata_start+0x1e9>
+  8030a9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8030ad:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8030b4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030b5:	72 00                	jb     8030b7 <__rodata_start+0x187>
+  8030b7:	62 61 64 20 65       	(bad)
+  8030bc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030bd:	76 69                	jbe    803128 <__rodata_start+0x1f8>
+  8030bf:	72 6f                	jb     803130 <__rodata_start+0x200>
+  8030c1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030c2:	6d                   	insl   (%dx),%es:(%rdi)
+  8030c3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030c5:	74 00                	je     8030c7 <__rodata_start+0x197>
+  8030c7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8030ce:	20 70 61             	and    %dh,0x61(%rax)
+  8030d1:	72 61                	jb     803134 <__rodata_start+0x204>
+  8030d3:	6d                   	insl   (%dx),%es:(%rdi)
+  8030d4:	65 74 65             	gs je  80313c <__rodata_start+0x20c>
+  8030d7:	72 00                	jb     8030d9 <__rodata_start+0x1a9>
+  8030d9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030da:	75 74                	jne    803150 <__rodata_start+0x220>
+  8030dc:	20 6f 66             	and    %ch,0x66(%rdi)
+  8030df:	20 6d 65             	and    %ch,0x65(%rbp)
+  8030e2:	6d                   	insl   (%dx),%es:(%rdi)
+  8030e3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030e4:	72 79                	jb     80315f <__rodata_start+0x22f>
+  8030e6:	00 6f 75             	add    %ch,0x75(%rdi)
+  8030e9:	74 20                	je     80310b <__rodata_start+0x1db>
+  8030eb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030ec:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8030f0:	76 69                	jbe    80315b <__rodata_start+0x22b>
+  8030f2:	72 6f                	jb     803163 <__rodata_start+0x233>
+  8030f4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030f5:	6d                   	insl   (%dx),%es:(%rdi)
+  8030f6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030f8:	74 73                	je     80316d <__rodata_start+0x23d>
+  8030fa:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8030fd:	72 72                	jb     803171 <__rodata_start+0x241>
+  8030ff:	75 70                	jne    803171 <__rodata_start+0x241>
+  803101:	74 65                	je     803168 <__rodata_start+0x238>
+  803103:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803108:	75 67                	jne    803171 <__rodata_start+0x241>
+  80310a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80310d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80310f:	00 73 65             	add    %dh,0x65(%rbx)
+  803112:	67 6d                	insl   (%dx),%es:(%edi)
+  803114:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803116:	74 61                	je     803179 <__rodata_start+0x249>
+  803118:	74 69                	je     803183 <__rodata_start+0x253>
+  80311a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80311b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80311c:	20 66 61             	and    %ah,0x61(%rsi)
+  80311f:	75 6c                	jne    80318d <__rodata_start+0x25d>
+  803121:	74 00                	je     803123 <__rodata_start+0x1f3>
+  803123:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80312a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80312d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803131:	61                   	(bad)
+  803132:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803137:	20 73 75             	and    %dh,0x75(%rbx)
+  80313a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80313d:	73 79                	jae    8031b8 <__rodata_start+0x288>
+  80313f:	73 74                	jae    8031b5 <__rodata_start+0x285>
+  803141:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803143:	20 63 61             	and    %ah,0x61(%rbx)
+  803146:	6c                   	insb   (%dx),%es:(%rdi)
+  803147:	6c                   	insb   (%dx),%es:(%rdi)
+  803148:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80314b:	74 72                	je     8031bf <__rodata_start+0x28f>
+  80314d:	79 20                	jns    80316f <__rodata_start+0x23f>
+  80314f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803150:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803151:	74 20                	je     803173 <__rodata_start+0x243>
+  803153:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803155:	75 6e                	jne    8031c5 <__rodata_start+0x295>
+  803157:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80315b:	76 20                	jbe    80317d <__rodata_start+0x24d>
+  80315d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803164:	72 65                	jb     8031cb <__rodata_start+0x29b>
+  803166:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803169:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80316a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80316e:	65 78 70             	gs js  8031e1 <__rodata_start+0x2b1>
+  803171:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803176:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803179:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80317d:	20 66 69             	and    %ah,0x69(%rsi)
+  803180:	6c                   	insb   (%dx),%es:(%rdi)
+  803181:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803185:	20 66 72             	and    %ah,0x72(%rsi)
+  803188:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80318d:	61                   	(bad)
+  80318e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803191:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803192:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803193:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803197:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80319a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80319b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80319c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80319f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031a0:	79 20                	jns    8031c2 <__rodata_start+0x292>
+  8031a2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8031a9:	72 65                	jb     803210 <__rodata_start+0x2e0>
+  8031ab:	20 6f 70             	and    %ch,0x70(%rdi)
+  8031ae:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8031b0:	00 66 69             	add    %ah,0x69(%rsi)
+  8031b3:	6c                   	insb   (%dx),%es:(%rdi)
+  8031b4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8031b8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8031bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031bc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8031bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031c0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031c1:	74 20                	je     8031e3 <__rodata_start+0x2b3>
+  8031c3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8031c5:	75 6e                	jne    803235 <__rodata_start+0x305>
+  8031c7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8031cb:	76 61                	jbe    80322e <__rodata_start+0x2fe>
+  8031cd:	6c                   	insb   (%dx),%es:(%rdi)
+  8031ce:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8031d5:	00 
+  8031d6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8031dd:	72 65                	jb     803244 <__rodata_start+0x314>
+  8031df:	61                   	(bad)
+  8031e0:	64 79 20             	fs jns 803203 <__rodata_start+0x2d3>
+  8031e3:	65 78 69             	gs js  80324f <__rodata_start+0x31f>
+  8031e6:	73 74                	jae    80325c <__rodata_start+0x32c>
+  8031e8:	73 00                	jae    8031ea <__rodata_start+0x2ba>
+  8031ea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031eb:	70 65                	jo     803252 <__rodata_start+0x322>
+  8031ed:	72 61                	jb     803250 <__rodata_start+0x320>
+  8031ef:	74 69                	je     80325a <__rodata_start+0x32a>
+  8031f1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031f2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031f3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8031f6:	74 20                	je     803218 <__rodata_start+0x2e8>
+  8031f8:	73 75                	jae    80326f <__rodata_start+0x33f>
+  8031fa:	70 70                	jo     80326c <__rodata_start+0x33c>
+  8031fc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031fd:	72 74                	jb     803273 <__rodata_start+0x343>
+  8031ff:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803204:	65 72 61             	gs jb  803268 <__rodata_start+0x338>
+  803207:	74 69                	je     803272 <__rodata_start+0x342>
+  803209:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80320a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80320b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80320e:	74 20                	je     803230 <__rodata_start+0x300>
+  803210:	70 65                	jo     803277 <__rodata_start+0x347>
+  803212:	72 6d                	jb     803281 <__rodata_start+0x351>
+  803214:	69 74 74 65 64 00 66 	imul   $0xf660064,0x65(%rsp,%rsi,2),%esi
+  80321b:	0f 
+  80321c:	1f                   	(bad)
+  80321d:	44 00 00             	add    %r8b,(%rax)
+  803220:	4a 07                	rex.WX (bad)
+  803222:	80 00 00             	addb   $0x0,(%rax)
+  803225:	00 00                	add    %al,(%rax)
+  803227:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80322d:	00 00                	add    %al,(%rax)
+  80322f:	00 7b 0d             	add    %bh,0xd(%rbx)
+  803232:	80 00 00             	addb   $0x0,(%rax)
+  803235:	00 00                	add    %al,(%rax)
+  803237:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80323d:	00 00                	add    %al,(%rax)
+  80323f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803245:	00 00                	add    %al,(%rax)
+  803247:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80324d:	00 00                	add    %al,(%rax)
+  80324f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803255:	00 00                	add    %al,(%rax)
+  803257:	00 69 07             	add    %ch,0x7(%rcx)
+  80325a:	80 00 00             	addb   $0x0,(%rax)
+  80325d:	00 00                	add    %al,(%rax)
+  80325f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803265:	00 00                	add    %al,(%rax)
+  803267:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80326d:	00 00                	add    %al,(%rax)
+  80326f:	00 5d 07             	add    %bl,0x7(%rbp)
+  803272:	80 00 00             	addb   $0x0,(%rax)
+  803275:	00 00                	add    %al,(%rax)
+  803277:	00 d7                	add    %dl,%bh
+  803279:	07                   	(bad)
+  80327a:	80 00 00             	addb   $0x0,(%rax)
+  80327d:	00 00                	add    %al,(%rax)
+  80327f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803285:	00 00                	add    %al,(%rax)
+  803287:	00 5d 07             	add    %bl,0x7(%rbp)
+  80328a:	80 00 00             	addb   $0x0,(%rax)
+  80328d:	00 00                	add    %al,(%rax)
+  80328f:	00 a3 07 80 00 00    	add    %ah,0x8007(%rbx)
+  803295:	00 00                	add    %al,(%rax)
+  803297:	00 a3 07 80 00 00    	add    %ah,0x8007(%rbx)
+  80329d:	00 00                	add    %al,(%rax)
+  80329f:	00 a3 07 80 00 00    	add    %ah,0x8007(%rbx)
+  8032a5:	00 00                	add    %al,(%rax)
+  8032a7:	00 a3 07 80 00 00    	add    %ah,0x8007(%rbx)
+  8032ad:	00 00                	add    %al,(%rax)
+  8032af:	00 a3 07 80 00 00    	add    %ah,0x8007(%rbx)
+  8032b5:	00 00                	add    %al,(%rax)
+  8032b7:	00 a3 07 80 00 00    	add    %ah,0x8007(%rbx)
+  8032bd:	00 00                	add    %al,(%rax)
+  8032bf:	00 a3 07 80 00 00    	add    %ah,0x8007(%rbx)
+  8032c5:	00 00                	add    %al,(%rax)
+  8032c7:	00 a3 07 80 00 00    	add    %ah,0x8007(%rbx)
+  8032cd:	00 00                	add    %al,(%rax)
+  8032cf:	00 a3 07 80 00 00    	add    %ah,0x8007(%rbx)
+  8032d5:	00 00                	add    %al,(%rax)
+  8032d7:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8032dd:	00 00                	add    %al,(%rax)
+  8032df:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8032e5:	00 00                	add    %al,(%rax)
+  8032e7:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8032f5:	00 00                	add    %al,(%rax)
+  8032f7:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803305:	00 00                	add    %al,(%rax)
+  803307:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80330d:	00 00                	add    %al,(%rax)
+  80330f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803315:	00 00                	add    %al,(%rax)
+  803317:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80331d:	00 00                	add    %al,(%rax)
+  80331f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803325:	00 00                	add    %al,(%rax)
+  803327:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803335:	00 00                	add    %al,(%rax)
+  803337:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80333d:	00 00                	add    %al,(%rax)
+  80333f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803345:	00 00                	add    %al,(%rax)
+  803347:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803355:	00 00                	add    %al,(%rax)
+  803357:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80335d:	00 00                	add    %al,(%rax)
+  80335f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803375:	00 00                	add    %al,(%rax)
+  803377:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80337d:	00 00                	add    %al,(%rax)
+  80337f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803385:	00 00                	add    %al,(%rax)
+  803387:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803395:	00 00                	add    %al,(%rax)
+  803397:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80339d:	00 00                	add    %al,(%rax)
+  80339f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8033a5:	00 00                	add    %al,(%rax)
+  8033a7:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8033bd:	00 00                	add    %al,(%rax)
+  8033bf:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 ae 0c 80 00 00    	add    %ch,0x800c(%rsi)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8033dd:	00 00                	add    %al,(%rax)
+  8033df:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8033e5:	00 00                	add    %al,(%rax)
+  8033e7:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8033ed:	00 00                	add    %al,(%rax)
+  8033ef:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8033f5:	00 00                	add    %al,(%rax)
+  8033f7:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8033fd:	00 00                	add    %al,(%rax)
+  8033ff:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80341d:	00 00                	add    %al,(%rax)
+  80341f:	00 fa                	add    %bh,%dl
+  803421:	07                   	(bad)
+  803422:	80 00 00             	addb   $0x0,(%rax)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 c9                	add    %cl,%cl
+  803429:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80342f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803435:	00 00                	add    %al,(%rax)
+  803437:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80343d:	00 00                	add    %al,(%rax)
+  80343f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803445:	00 00                	add    %al,(%rax)
+  803447:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 29                	add    %ch,(%rcx)
+  803451:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803457:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80345d:	00 00                	add    %al,(%rax)
+  80345f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803465:	00 00                	add    %al,(%rax)
+  803467:	00 ef                	add    %ch,%bh
+  803469:	07                   	(bad)
+  80346a:	80 00 00             	addb   $0x0,(%rax)
+  80346d:	00 00                	add    %al,(%rax)
+  80346f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803475:	00 00                	add    %al,(%rax)
+  803477:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80347d:	00 00                	add    %al,(%rax)
+  80347f:	00 71 0b             	add    %dh,0xb(%rcx)
+  803482:	80 00 00             	addb   $0x0,(%rax)
+  803485:	00 00                	add    %al,(%rax)
+  803487:	00 3b                	add    %bh,(%rbx)
+  803489:	0c 80                	or     $0x80,%al
+  80348b:	00 00                	add    %al,(%rax)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  80349d:	00 00                	add    %al,(%rax)
+  80349f:	00 c0                	add    %al,%al
+  8034a1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8034a7:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8034ad:	00 00                	add    %al,(%rax)
+  8034af:	00 9d 0a 80 00 00    	add    %bl,0x800a(%rbp)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8034bd:	00 00                	add    %al,(%rax)
+  8034bf:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 ae 0c 80 00 00    	add    %ch,0x800c(%rsi)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 8b 0d 80 00 00    	add    %cl,0x800d(%rbx)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 53 07             	add    %dl,0x7(%rbx)
+  8034da:	80 00 00             	addb   $0x0,(%rax)
+  8034dd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008034e0 <error_string>:
+	...
+  8034e8:	a5 30 80 00 00 00 00 00 b7 30 80 00 00 00 00 00     .0.......0......
+  8034f8:	c7 30 80 00 00 00 00 00 d9 30 80 00 00 00 00 00     .0.......0......
+  803508:	e7 30 80 00 00 00 00 00 fb 30 80 00 00 00 00 00     .0.......0......
+  803518:	10 31 80 00 00 00 00 00 23 31 80 00 00 00 00 00     .1......#1......
+  803528:	35 31 80 00 00 00 00 00 49 31 80 00 00 00 00 00     51......I1......
+  803538:	59 31 80 00 00 00 00 00 6c 31 80 00 00 00 00 00     Y1......l1......
+  803548:	83 31 80 00 00 00 00 00 99 31 80 00 00 00 00 00     .1.......1......
+  803558:	b1 31 80 00 00 00 00 00 c9 31 80 00 00 00 00 00     .1.......1......
+  803568:	d6 31 80 00 00 00 00 00 90 35 80 00 00 00 00 00     .1.......5......
+  803578:	ea 31 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .1..............
+  803588:	02 32 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .2......file is 
+  803598:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8035a8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8035b8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8035c8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8035d8:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  8035e8:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  8035f8:	6c 69 62 2f 66 6f 72 6b 2e 63 00 69 70 63 5f 73     lib/fork.c.ipc_s
+  803608:	65 6e 64 3a 20 66 61 69 6c 65 64 20 74 6f 20 73     end: failed to s
+  803618:	65 6e 64 00 6c 69 62 2f 69 70 63 2e 63 00 66 90     end.lib/ipc.c.f.
+  803628:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803638:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803648:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803658:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803668:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803678:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803688:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803698:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8036a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036b8:	0f 1f 84 00 00 00 00 00                             ........
+
+00000000008036c0 <devtab>:
+  8036c0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8036d0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8036e0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8036f0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803700:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803710:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803720:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803730:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803740:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803750:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803760:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803770:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803780:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803790:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803800:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803810:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803820:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803830:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803840:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803850:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803860:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803870:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803880:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803890:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
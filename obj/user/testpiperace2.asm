@@ -0,0 +1,6031 @@
+
+obj/user/testpiperace2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 b1 02 00 00       	call   8002d4 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+    int p[2], r, i;
+    struct Fd *fd;
+    const volatile struct Env *kid;
+
+    cprintf("testing for pipeisclosed race...\n");
+  800036:	48 bf c0 2e 80 00 00 	movabs $0x802ec0,%rdi
+  80003d:	00 00 00 
+  800040:	b8 00 00 00 00       	mov    $0x0,%eax
+  800045:	48 ba ee 04 80 00 00 	movabs $0x8004ee,%rdx
+  80004c:	00 00 00 
+  80004f:	ff d2                	call   *%rdx
+    if ((r = pipe(p)) < 0)
+  800051:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  800055:	48 b8 fe 26 80 00 00 	movabs $0x8026fe,%rax
+  80005c:	00 00 00 
+  80005f:	ff d0                	call   *%rax
+  800061:	85 c0                	test   %eax,%eax
+  800063:	0f 88 94 00 00 00    	js     8000fd <umain+0xd8>
+        panic("pipe: %i", r);
+    if ((r = fork()) < 0)
+  800069:	48 b8 65 19 80 00 00 	movabs $0x801965,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 88 aa 00 00 00    	js     80012a <umain+0x105>
+        panic("fork: %i", r);
+    if (r == 0) {
+  800080:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  800084:	0f 84 cd 00 00 00    	je     800157 <umain+0x132>
+     * it shouldn't.
+     *
+     * So either way, pipeisclosed is going give a wrong answer. */
+
+    kid = &envs[ENVX(r)];
+    while (kid->env_status == ENV_RUNNABLE) {
+  80008a:	0f b6 45 bc          	movzbl -0x44(%rbp),%eax
+  80008e:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800095:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  80009c:	00 00 00 
+  80009f:	48 01 c3             	add    %rax,%rbx
+        if (pipeisclosed(p[0]) != 0) {
+  8000a2:	49 bc 0a 29 80 00 00 	movabs $0x80290a,%r12
+  8000a9:	00 00 00 
+    while (kid->env_status == ENV_RUNNABLE) {
+  8000ac:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  8000b2:	83 f8 02             	cmp    $0x2,%eax
+  8000b5:	0f 85 43 01 00 00    	jne    8001fe <umain+0x1d9>
+        if (pipeisclosed(p[0]) != 0) {
+  8000bb:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000be:	41 ff d4             	call   *%r12
+  8000c1:	85 c0                	test   %eax,%eax
+  8000c3:	74 e7                	je     8000ac <umain+0x87>
+            cprintf("\nRACE: pipe appears closed\n");
+  8000c5:	48 bf 3d 2f 80 00 00 	movabs $0x802f3d,%rdi
+  8000cc:	00 00 00 
+  8000cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d4:	48 ba ee 04 80 00 00 	movabs $0x8004ee,%rdx
+  8000db:	00 00 00 
+  8000de:	ff d2                	call   *%rdx
+            sys_env_destroy(r);
+  8000e0:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8000e3:	48 b8 98 12 80 00 00 	movabs $0x801298,%rax
+  8000ea:	00 00 00 
+  8000ed:	ff d0                	call   *%rax
+            exit();
+  8000ef:	48 b8 7b 03 80 00 00 	movabs $0x80037b,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+  8000fb:	eb af                	jmp    8000ac <umain+0x87>
+        panic("pipe: %i", r);
+  8000fd:	89 c1                	mov    %eax,%ecx
+  8000ff:	48 ba 12 2f 80 00 00 	movabs $0x802f12,%rdx
+  800106:	00 00 00 
+  800109:	be 0c 00 00 00       	mov    $0xc,%esi
+  80010e:	48 bf 1b 2f 80 00 00 	movabs $0x802f1b,%rdi
+  800115:	00 00 00 
+  800118:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011d:	49 b8 9e 03 80 00 00 	movabs $0x80039e,%r8
+  800124:	00 00 00 
+  800127:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  80012a:	89 c1                	mov    %eax,%ecx
+  80012c:	48 ba 30 2f 80 00 00 	movabs $0x802f30,%rdx
+  800133:	00 00 00 
+  800136:	be 0e 00 00 00       	mov    $0xe,%esi
+  80013b:	48 bf 1b 2f 80 00 00 	movabs $0x802f1b,%rdi
+  800142:	00 00 00 
+  800145:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014a:	49 b8 9e 03 80 00 00 	movabs $0x80039e,%r8
+  800151:	00 00 00 
+  800154:	41 ff d0             	call   *%r8
+        close(p[1]);
+  800157:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80015a:	48 b8 58 1c 80 00 00 	movabs $0x801c58,%rax
+  800161:	00 00 00 
+  800164:	ff d0                	call   *%rax
+        for (i = 0; i < 200; i++) {
+  800166:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+                cprintf("%d.", i);
+  800169:	49 bf 39 2f 80 00 00 	movabs $0x802f39,%r15
+  800170:	00 00 00 
+  800173:	49 be ee 04 80 00 00 	movabs $0x8004ee,%r14
+  80017a:	00 00 00 
+            dup(p[0], 10);
+  80017d:	49 bd b3 1c 80 00 00 	movabs $0x801cb3,%r13
+  800184:	00 00 00 
+            sys_yield();
+  800187:	49 bc 34 13 80 00 00 	movabs $0x801334,%r12
+  80018e:	00 00 00 
+  800191:	eb 2d                	jmp    8001c0 <umain+0x19b>
+            dup(p[0], 10);
+  800193:	be 0a 00 00 00       	mov    $0xa,%esi
+  800198:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80019b:	41 ff d5             	call   *%r13
+            sys_yield();
+  80019e:	41 ff d4             	call   *%r12
+            close(10);
+  8001a1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8001a6:	48 b8 58 1c 80 00 00 	movabs $0x801c58,%rax
+  8001ad:	00 00 00 
+  8001b0:	ff d0                	call   *%rax
+            sys_yield();
+  8001b2:	41 ff d4             	call   *%r12
+        for (i = 0; i < 200; i++) {
+  8001b5:	83 c3 01             	add    $0x1,%ebx
+  8001b8:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  8001be:	74 2d                	je     8001ed <umain+0x1c8>
+            if (i % 10 == 0)
+  8001c0:	48 63 c3             	movslq %ebx,%rax
+  8001c3:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+  8001ca:	48 c1 f8 22          	sar    $0x22,%rax
+  8001ce:	89 da                	mov    %ebx,%edx
+  8001d0:	c1 fa 1f             	sar    $0x1f,%edx
+  8001d3:	29 d0                	sub    %edx,%eax
+  8001d5:	8d 04 80             	lea    (%rax,%rax,4),%eax
+  8001d8:	01 c0                	add    %eax,%eax
+  8001da:	39 c3                	cmp    %eax,%ebx
+  8001dc:	75 b5                	jne    800193 <umain+0x16e>
+                cprintf("%d.", i);
+  8001de:	89 de                	mov    %ebx,%esi
+  8001e0:	4c 89 ff             	mov    %r15,%rdi
+  8001e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e8:	41 ff d6             	call   *%r14
+  8001eb:	eb a6                	jmp    800193 <umain+0x16e>
+        exit();
+  8001ed:	48 b8 7b 03 80 00 00 	movabs $0x80037b,%rax
+  8001f4:	00 00 00 
+  8001f7:	ff d0                	call   *%rax
+  8001f9:	e9 8c fe ff ff       	jmp    80008a <umain+0x65>
+        }
+    }
+    cprintf("child done with loop\n");
+  8001fe:	48 bf 59 2f 80 00 00 	movabs $0x802f59,%rdi
+  800205:	00 00 00 
+  800208:	b8 00 00 00 00       	mov    $0x0,%eax
+  80020d:	48 ba ee 04 80 00 00 	movabs $0x8004ee,%rdx
+  800214:	00 00 00 
+  800217:	ff d2                	call   *%rdx
+    if (pipeisclosed(p[0]))
+  800219:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80021c:	48 b8 0a 29 80 00 00 	movabs $0x80290a,%rax
+  800223:	00 00 00 
+  800226:	ff d0                	call   *%rax
+  800228:	85 c0                	test   %eax,%eax
+  80022a:	75 51                	jne    80027d <umain+0x258>
+        panic("somehow the other end of p[0] got closed!");
+    if ((r = fd_lookup(p[0], &fd)) < 0)
+  80022c:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800230:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800233:	48 b8 f3 1a 80 00 00 	movabs $0x801af3,%rax
+  80023a:	00 00 00 
+  80023d:	ff d0                	call   *%rax
+  80023f:	85 c0                	test   %eax,%eax
+  800241:	78 64                	js     8002a7 <umain+0x282>
+        panic("cannot look up p[0]: %i", r);
+    USED(fd2data(fd));
+  800243:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  800247:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  80024e:	00 00 00 
+  800251:	ff d0                	call   *%rax
+    cprintf("race didn't happen\n");
+  800253:	48 bf 87 2f 80 00 00 	movabs $0x802f87,%rdi
+  80025a:	00 00 00 
+  80025d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800262:	48 ba ee 04 80 00 00 	movabs $0x8004ee,%rdx
+  800269:	00 00 00 
+  80026c:	ff d2                	call   *%rdx
+}
+  80026e:	48 83 c4 28          	add    $0x28,%rsp
+  800272:	5b                   	pop    %rbx
+  800273:	41 5c                	pop    %r12
+  800275:	41 5d                	pop    %r13
+  800277:	41 5e                	pop    %r14
+  800279:	41 5f                	pop    %r15
+  80027b:	5d                   	pop    %rbp
+  80027c:	c3                   	ret
+        panic("somehow the other end of p[0] got closed!");
+  80027d:	48 ba e8 2e 80 00 00 	movabs $0x802ee8,%rdx
+  800284:	00 00 00 
+  800287:	be 40 00 00 00       	mov    $0x40,%esi
+  80028c:	48 bf 1b 2f 80 00 00 	movabs $0x802f1b,%rdi
+  800293:	00 00 00 
+  800296:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029b:	48 b9 9e 03 80 00 00 	movabs $0x80039e,%rcx
+  8002a2:	00 00 00 
+  8002a5:	ff d1                	call   *%rcx
+        panic("cannot look up p[0]: %i", r);
+  8002a7:	89 c1                	mov    %eax,%ecx
+  8002a9:	48 ba 6f 2f 80 00 00 	movabs $0x802f6f,%rdx
+  8002b0:	00 00 00 
+  8002b3:	be 42 00 00 00       	mov    $0x42,%esi
+  8002b8:	48 bf 1b 2f 80 00 00 	movabs $0x802f1b,%rdi
+  8002bf:	00 00 00 
+  8002c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c7:	49 b8 9e 03 80 00 00 	movabs $0x80039e,%r8
+  8002ce:	00 00 00 
+  8002d1:	41 ff d0             	call   *%r8
+
+00000000008002d4 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002d4:	55                   	push   %rbp
+  8002d5:	48 89 e5             	mov    %rsp,%rbp
+  8002d8:	41 56                	push   %r14
+  8002da:	41 55                	push   %r13
+  8002dc:	41 54                	push   %r12
+  8002de:	53                   	push   %rbx
+  8002df:	41 89 fd             	mov    %edi,%r13d
+  8002e2:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002e5:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8002ec:	00 00 00 
+  8002ef:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8002f6:	00 00 00 
+  8002f9:	48 39 c2             	cmp    %rax,%rdx
+  8002fc:	73 17                	jae    800315 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8002fe:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800301:	49 89 c4             	mov    %rax,%r12
+  800304:	48 83 c3 08          	add    $0x8,%rbx
+  800308:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030d:	ff 53 f8             	call   *-0x8(%rbx)
+  800310:	4c 39 e3             	cmp    %r12,%rbx
+  800313:	72 ef                	jb     800304 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800315:	48 b8 03 13 80 00 00 	movabs $0x801303,%rax
+  80031c:	00 00 00 
+  80031f:	ff d0                	call   *%rax
+  800321:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800324:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80032b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800332:	00 00 00 
+  800335:	48 01 d0             	add    %rdx,%rax
+  800338:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80033f:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800342:	45 85 ed             	test   %r13d,%r13d
+  800345:	7e 0d                	jle    800354 <libmain+0x80>
+  800347:	49 8b 06             	mov    (%r14),%rax
+  80034a:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800351:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800354:	4c 89 f6             	mov    %r14,%rsi
+  800357:	44 89 ef             	mov    %r13d,%edi
+  80035a:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800361:	00 00 00 
+  800364:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800366:	48 b8 7b 03 80 00 00 	movabs $0x80037b,%rax
+  80036d:	00 00 00 
+  800370:	ff d0                	call   *%rax
+#endif
+}
+  800372:	5b                   	pop    %rbx
+  800373:	41 5c                	pop    %r12
+  800375:	41 5d                	pop    %r13
+  800377:	41 5e                	pop    %r14
+  800379:	5d                   	pop    %rbp
+  80037a:	c3                   	ret
+
+000000000080037b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80037b:	55                   	push   %rbp
+  80037c:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80037f:	48 b8 8b 1c 80 00 00 	movabs $0x801c8b,%rax
+  800386:	00 00 00 
+  800389:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80038b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800390:	48 b8 98 12 80 00 00 	movabs $0x801298,%rax
+  800397:	00 00 00 
+  80039a:	ff d0                	call   *%rax
+}
+  80039c:	5d                   	pop    %rbp
+  80039d:	c3                   	ret
+
+000000000080039e <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80039e:	55                   	push   %rbp
+  80039f:	48 89 e5             	mov    %rsp,%rbp
+  8003a2:	41 56                	push   %r14
+  8003a4:	41 55                	push   %r13
+  8003a6:	41 54                	push   %r12
+  8003a8:	53                   	push   %rbx
+  8003a9:	48 83 ec 50          	sub    $0x50,%rsp
+  8003ad:	49 89 fc             	mov    %rdi,%r12
+  8003b0:	41 89 f5             	mov    %esi,%r13d
+  8003b3:	48 89 d3             	mov    %rdx,%rbx
+  8003b6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003ba:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003be:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8003c2:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8003c9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003cd:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8003d1:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8003d5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003d9:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8003e0:	00 00 00 
+  8003e3:	4c 8b 30             	mov    (%rax),%r14
+  8003e6:	48 b8 03 13 80 00 00 	movabs $0x801303,%rax
+  8003ed:	00 00 00 
+  8003f0:	ff d0                	call   *%rax
+  8003f2:	89 c6                	mov    %eax,%esi
+  8003f4:	45 89 e8             	mov    %r13d,%r8d
+  8003f7:	4c 89 e1             	mov    %r12,%rcx
+  8003fa:	4c 89 f2             	mov    %r14,%rdx
+  8003fd:	48 bf a8 2f 80 00 00 	movabs $0x802fa8,%rdi
+  800404:	00 00 00 
+  800407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040c:	49 bc ee 04 80 00 00 	movabs $0x8004ee,%r12
+  800413:	00 00 00 
+  800416:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800419:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80041d:	48 89 df             	mov    %rbx,%rdi
+  800420:	48 b8 8a 04 80 00 00 	movabs $0x80048a,%rax
+  800427:	00 00 00 
+  80042a:	ff d0                	call   *%rax
+    cprintf("\n");
+  80042c:	48 bf 57 2f 80 00 00 	movabs $0x802f57,%rdi
+  800433:	00 00 00 
+  800436:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80043e:	cc                   	int3
+  80043f:	eb fd                	jmp    80043e <_panic+0xa0>
+
+0000000000800441 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800441:	55                   	push   %rbp
+  800442:	48 89 e5             	mov    %rsp,%rbp
+  800445:	53                   	push   %rbx
+  800446:	48 83 ec 08          	sub    $0x8,%rsp
+  80044a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80044d:	8b 06                	mov    (%rsi),%eax
+  80044f:	8d 50 01             	lea    0x1(%rax),%edx
+  800452:	89 16                	mov    %edx,(%rsi)
+  800454:	48 98                	cltq
+  800456:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80045b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800461:	74 0a                	je     80046d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800463:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800467:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80046b:	c9                   	leave
+  80046c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80046d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800471:	be ff 00 00 00       	mov    $0xff,%esi
+  800476:	48 b8 3a 12 80 00 00 	movabs $0x80123a,%rax
+  80047d:	00 00 00 
+  800480:	ff d0                	call   *%rax
+        state->offset = 0;
+  800482:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800488:	eb d9                	jmp    800463 <putch+0x22>
+
+000000000080048a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80048a:	55                   	push   %rbp
+  80048b:	48 89 e5             	mov    %rsp,%rbp
+  80048e:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800495:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800498:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80049f:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004ac:	48 89 f1             	mov    %rsi,%rcx
+  8004af:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004b6:	48 bf 41 04 80 00 00 	movabs $0x800441,%rdi
+  8004bd:	00 00 00 
+  8004c0:	48 b8 3e 06 80 00 00 	movabs $0x80063e,%rax
+  8004c7:	00 00 00 
+  8004ca:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004cc:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004d3:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004da:	48 b8 3a 12 80 00 00 	movabs $0x80123a,%rax
+  8004e1:	00 00 00 
+  8004e4:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8004e6:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8004ec:	c9                   	leave
+  8004ed:	c3                   	ret
+
+00000000008004ee <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8004ee:	55                   	push   %rbp
+  8004ef:	48 89 e5             	mov    %rsp,%rbp
+  8004f2:	48 83 ec 50          	sub    $0x50,%rsp
+  8004f6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004fa:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004fe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800502:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800506:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80050a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800511:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800515:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800519:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80051d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800521:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800525:	48 b8 8a 04 80 00 00 	movabs $0x80048a,%rax
+  80052c:	00 00 00 
+  80052f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800531:	c9                   	leave
+  800532:	c3                   	ret
+
+0000000000800533 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800533:	55                   	push   %rbp
+  800534:	48 89 e5             	mov    %rsp,%rbp
+  800537:	41 57                	push   %r15
+  800539:	41 56                	push   %r14
+  80053b:	41 55                	push   %r13
+  80053d:	41 54                	push   %r12
+  80053f:	53                   	push   %rbx
+  800540:	48 83 ec 18          	sub    $0x18,%rsp
+  800544:	49 89 fc             	mov    %rdi,%r12
+  800547:	49 89 f5             	mov    %rsi,%r13
+  80054a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80054e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800551:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800554:	41 89 cf             	mov    %ecx,%r15d
+  800557:	4c 39 fa             	cmp    %r15,%rdx
+  80055a:	73 5b                	jae    8005b7 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80055c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800560:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800564:	85 db                	test   %ebx,%ebx
+  800566:	7e 0e                	jle    800576 <print_num+0x43>
+            putch(padc, put_arg);
+  800568:	4c 89 ee             	mov    %r13,%rsi
+  80056b:	44 89 f7             	mov    %r14d,%edi
+  80056e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800571:	83 eb 01             	sub    $0x1,%ebx
+  800574:	75 f2                	jne    800568 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800576:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80057a:	48 b9 dc 2f 80 00 00 	movabs $0x802fdc,%rcx
+  800581:	00 00 00 
+  800584:	48 b8 cb 2f 80 00 00 	movabs $0x802fcb,%rax
+  80058b:	00 00 00 
+  80058e:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800592:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800596:	ba 00 00 00 00       	mov    $0x0,%edx
+  80059b:	49 f7 f7             	div    %r15
+  80059e:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005a2:	4c 89 ee             	mov    %r13,%rsi
+  8005a5:	41 ff d4             	call   *%r12
+}
+  8005a8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005ac:	5b                   	pop    %rbx
+  8005ad:	41 5c                	pop    %r12
+  8005af:	41 5d                	pop    %r13
+  8005b1:	41 5e                	pop    %r14
+  8005b3:	41 5f                	pop    %r15
+  8005b5:	5d                   	pop    %rbp
+  8005b6:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005c0:	49 f7 f7             	div    %r15
+  8005c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8005c7:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005cb:	52                   	push   %rdx
+  8005cc:	45 0f be c9          	movsbl %r9b,%r9d
+  8005d0:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005d4:	48 89 c2             	mov    %rax,%rdx
+  8005d7:	48 b8 33 05 80 00 00 	movabs $0x800533,%rax
+  8005de:	00 00 00 
+  8005e1:	ff d0                	call   *%rax
+  8005e3:	48 83 c4 10          	add    $0x10,%rsp
+  8005e7:	eb 8d                	jmp    800576 <print_num+0x43>
+
+00000000008005e9 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8005e9:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8005ed:	48 8b 06             	mov    (%rsi),%rax
+  8005f0:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8005f4:	73 0a                	jae    800600 <sprintputch+0x17>
+        *state->start++ = ch;
+  8005f6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8005fa:	48 89 16             	mov    %rdx,(%rsi)
+  8005fd:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800600:	c3                   	ret
+
+0000000000800601 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800601:	55                   	push   %rbp
+  800602:	48 89 e5             	mov    %rsp,%rbp
+  800605:	48 83 ec 50          	sub    $0x50,%rsp
+  800609:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80060d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800611:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800615:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80061c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800620:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800624:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800628:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80062c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800630:	48 b8 3e 06 80 00 00 	movabs $0x80063e,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+}
+  80063c:	c9                   	leave
+  80063d:	c3                   	ret
+
+000000000080063e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80063e:	55                   	push   %rbp
+  80063f:	48 89 e5             	mov    %rsp,%rbp
+  800642:	41 57                	push   %r15
+  800644:	41 56                	push   %r14
+  800646:	41 55                	push   %r13
+  800648:	41 54                	push   %r12
+  80064a:	53                   	push   %rbx
+  80064b:	48 83 ec 38          	sub    $0x38,%rsp
+  80064f:	49 89 fe             	mov    %rdi,%r14
+  800652:	49 89 f5             	mov    %rsi,%r13
+  800655:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800658:	48 8b 01             	mov    (%rcx),%rax
+  80065b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80065f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800663:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800667:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80066b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80066f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800673:	0f b6 3b             	movzbl (%rbx),%edi
+  800676:	40 80 ff 25          	cmp    $0x25,%dil
+  80067a:	74 18                	je     800694 <vprintfmt+0x56>
+            if (!ch) return;
+  80067c:	40 84 ff             	test   %dil,%dil
+  80067f:	0f 84 b1 06 00 00    	je     800d36 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800685:	40 0f b6 ff          	movzbl %dil,%edi
+  800689:	4c 89 ee             	mov    %r13,%rsi
+  80068c:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80068f:	4c 89 e3             	mov    %r12,%rbx
+  800692:	eb db                	jmp    80066f <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800694:	be 00 00 00 00       	mov    $0x0,%esi
+  800699:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80069d:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006a2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006a8:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006af:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006b3:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006b8:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006bd:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006c0:	83 e8 23             	sub    $0x23,%eax
+  8006c3:	3c 57                	cmp    $0x57,%al
+  8006c5:	0f 87 51 06 00 00    	ja     800d1c <vprintfmt+0x6de>
+  8006cb:	0f b6 c0             	movzbl %al,%eax
+  8006ce:	48 b9 80 31 80 00 00 	movabs $0x803180,%rcx
+  8006d5:	00 00 00 
+  8006d8:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006db:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006de:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8006e2:	eb cf                	jmp    8006b3 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8006e4:	49 89 dc             	mov    %rbx,%r12
+  8006e7:	be 01 00 00 00       	mov    $0x1,%esi
+  8006ec:	eb c5                	jmp    8006b3 <vprintfmt+0x75>
+            padc = ch;
+  8006ee:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8006f2:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006f5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006f8:	eb b9                	jmp    8006b3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006fd:	83 f8 2f             	cmp    $0x2f,%eax
+  800700:	77 24                	ja     800726 <vprintfmt+0xe8>
+  800702:	89 c1                	mov    %eax,%ecx
+  800704:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800708:	83 c0 08             	add    $0x8,%eax
+  80070b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80070e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800711:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800714:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800718:	79 99                	jns    8006b3 <vprintfmt+0x75>
+                width = precision;
+  80071a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80071e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800724:	eb 8d                	jmp    8006b3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800726:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80072a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80072e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800732:	eb da                	jmp    80070e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800734:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800739:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80073d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800743:	3c 39                	cmp    $0x39,%al
+  800745:	77 1c                	ja     800763 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800747:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80074b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80074f:	0f b6 c0             	movzbl %al,%eax
+  800752:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800757:	0f b6 03             	movzbl (%rbx),%eax
+  80075a:	3c 39                	cmp    $0x39,%al
+  80075c:	76 e9                	jbe    800747 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80075e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800761:	eb b1                	jmp    800714 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800763:	49 89 dc             	mov    %rbx,%r12
+  800766:	eb ac                	jmp    800714 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800768:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80076b:	85 c9                	test   %ecx,%ecx
+  80076d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800772:	0f 49 c1             	cmovns %ecx,%eax
+  800775:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800778:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80077b:	e9 33 ff ff ff       	jmp    8006b3 <vprintfmt+0x75>
+            lflag++;
+  800780:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800783:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800786:	e9 28 ff ff ff       	jmp    8006b3 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80078b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80078e:	83 f8 2f             	cmp    $0x2f,%eax
+  800791:	77 19                	ja     8007ac <vprintfmt+0x16e>
+  800793:	89 c2                	mov    %eax,%edx
+  800795:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800799:	83 c0 08             	add    $0x8,%eax
+  80079c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079f:	8b 3a                	mov    (%rdx),%edi
+  8007a1:	4c 89 ee             	mov    %r13,%rsi
+  8007a4:	41 ff d6             	call   *%r14
+            break;
+  8007a7:	e9 c3 fe ff ff       	jmp    80066f <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b8:	eb e5                	jmp    80079f <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c0:	77 5a                	ja     80081c <vprintfmt+0x1de>
+  8007c2:	89 c2                	mov    %eax,%edx
+  8007c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c8:	83 c0 08             	add    $0x8,%eax
+  8007cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007ce:	8b 02                	mov    (%rdx),%eax
+  8007d0:	89 c1                	mov    %eax,%ecx
+  8007d2:	f7 d9                	neg    %ecx
+  8007d4:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007d7:	83 f9 15             	cmp    $0x15,%ecx
+  8007da:	7f 4e                	jg     80082a <vprintfmt+0x1ec>
+  8007dc:	48 63 c1             	movslq %ecx,%rax
+  8007df:	48 ba 40 34 80 00 00 	movabs $0x803440,%rdx
+  8007e6:	00 00 00 
+  8007e9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007ed:	48 85 c0             	test   %rax,%rax
+  8007f0:	74 38                	je     80082a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8007f2:	48 89 c1             	mov    %rax,%rcx
+  8007f5:	48 ba 39 36 80 00 00 	movabs $0x803639,%rdx
+  8007fc:	00 00 00 
+  8007ff:	4c 89 ee             	mov    %r13,%rsi
+  800802:	4c 89 f7             	mov    %r14,%rdi
+  800805:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080a:	49 b8 01 06 80 00 00 	movabs $0x800601,%r8
+  800811:	00 00 00 
+  800814:	41 ff d0             	call   *%r8
+  800817:	e9 53 fe ff ff       	jmp    80066f <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80081c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800820:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800824:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800828:	eb a4                	jmp    8007ce <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80082a:	48 ba f4 2f 80 00 00 	movabs $0x802ff4,%rdx
+  800831:	00 00 00 
+  800834:	4c 89 ee             	mov    %r13,%rsi
+  800837:	4c 89 f7             	mov    %r14,%rdi
+  80083a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083f:	49 b8 01 06 80 00 00 	movabs $0x800601,%r8
+  800846:	00 00 00 
+  800849:	41 ff d0             	call   *%r8
+  80084c:	e9 1e fe ff ff       	jmp    80066f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800851:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800854:	83 f8 2f             	cmp    $0x2f,%eax
+  800857:	77 6c                	ja     8008c5 <vprintfmt+0x287>
+  800859:	89 c2                	mov    %eax,%edx
+  80085b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085f:	83 c0 08             	add    $0x8,%eax
+  800862:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800865:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800868:	48 85 d2             	test   %rdx,%rdx
+  80086b:	48 b8 ed 2f 80 00 00 	movabs $0x802fed,%rax
+  800872:	00 00 00 
+  800875:	48 0f 45 c2          	cmovne %rdx,%rax
+  800879:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80087d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800881:	7e 06                	jle    800889 <vprintfmt+0x24b>
+  800883:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800887:	75 4a                	jne    8008d3 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800889:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80088d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800891:	0f b6 00             	movzbl (%rax),%eax
+  800894:	84 c0                	test   %al,%al
+  800896:	0f 85 9a 00 00 00    	jne    800936 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80089c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80089f:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008a3:	85 c0                	test   %eax,%eax
+  8008a5:	0f 8e c4 fd ff ff    	jle    80066f <vprintfmt+0x31>
+  8008ab:	4c 89 ee             	mov    %r13,%rsi
+  8008ae:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008b3:	41 ff d6             	call   *%r14
+  8008b6:	41 83 ec 01          	sub    $0x1,%r12d
+  8008ba:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008be:	75 eb                	jne    8008ab <vprintfmt+0x26d>
+  8008c0:	e9 aa fd ff ff       	jmp    80066f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d1:	eb 92                	jmp    800865 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008d3:	49 63 f7             	movslq %r15d,%rsi
+  8008d6:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008da:	48 b8 f0 0d 80 00 00 	movabs $0x800df0,%rax
+  8008e1:	00 00 00 
+  8008e4:	ff d0                	call   *%rax
+  8008e6:	48 89 c2             	mov    %rax,%rdx
+  8008e9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008ec:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8008ee:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8008f1:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8008f4:	85 c0                	test   %eax,%eax
+  8008f6:	7e 91                	jle    800889 <vprintfmt+0x24b>
+  8008f8:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8008fd:	4c 89 ee             	mov    %r13,%rsi
+  800900:	44 89 e7             	mov    %r12d,%edi
+  800903:	41 ff d6             	call   *%r14
+  800906:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80090a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80090d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800910:	75 eb                	jne    8008fd <vprintfmt+0x2bf>
+  800912:	e9 72 ff ff ff       	jmp    800889 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800917:	0f b6 f8             	movzbl %al,%edi
+  80091a:	4c 89 ee             	mov    %r13,%rsi
+  80091d:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800920:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800924:	49 83 c4 01          	add    $0x1,%r12
+  800928:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80092e:	84 c0                	test   %al,%al
+  800930:	0f 84 66 ff ff ff    	je     80089c <vprintfmt+0x25e>
+  800936:	45 85 ff             	test   %r15d,%r15d
+  800939:	78 0a                	js     800945 <vprintfmt+0x307>
+  80093b:	41 83 ef 01          	sub    $0x1,%r15d
+  80093f:	0f 88 57 ff ff ff    	js     80089c <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800945:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800949:	74 cc                	je     800917 <vprintfmt+0x2d9>
+  80094b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80094e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800953:	80 fa 5e             	cmp    $0x5e,%dl
+  800956:	77 c2                	ja     80091a <vprintfmt+0x2dc>
+  800958:	eb bd                	jmp    800917 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80095a:	40 84 f6             	test   %sil,%sil
+  80095d:	75 26                	jne    800985 <vprintfmt+0x347>
+    switch (lflag) {
+  80095f:	85 d2                	test   %edx,%edx
+  800961:	74 59                	je     8009bc <vprintfmt+0x37e>
+  800963:	83 fa 01             	cmp    $0x1,%edx
+  800966:	74 7b                	je     8009e3 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800968:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096b:	83 f8 2f             	cmp    $0x2f,%eax
+  80096e:	0f 87 96 00 00 00    	ja     800a0a <vprintfmt+0x3cc>
+  800974:	89 c2                	mov    %eax,%edx
+  800976:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097a:	83 c0 08             	add    $0x8,%eax
+  80097d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800980:	4c 8b 22             	mov    (%rdx),%r12
+  800983:	eb 17                	jmp    80099c <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800985:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800988:	83 f8 2f             	cmp    $0x2f,%eax
+  80098b:	77 21                	ja     8009ae <vprintfmt+0x370>
+  80098d:	89 c2                	mov    %eax,%edx
+  80098f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800993:	83 c0 08             	add    $0x8,%eax
+  800996:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800999:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80099c:	4d 85 e4             	test   %r12,%r12
+  80099f:	78 7a                	js     800a1b <vprintfmt+0x3dd>
+            num = i;
+  8009a1:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009a4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009a9:	e9 50 02 00 00       	jmp    800bfe <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ba:	eb dd                	jmp    800999 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c2:	77 11                	ja     8009d5 <vprintfmt+0x397>
+  8009c4:	89 c2                	mov    %eax,%edx
+  8009c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ca:	83 c0 08             	add    $0x8,%eax
+  8009cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d0:	4c 63 22             	movslq (%rdx),%r12
+  8009d3:	eb c7                	jmp    80099c <vprintfmt+0x35e>
+  8009d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e1:	eb ed                	jmp    8009d0 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8009e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e9:	77 11                	ja     8009fc <vprintfmt+0x3be>
+  8009eb:	89 c2                	mov    %eax,%edx
+  8009ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f1:	83 c0 08             	add    $0x8,%eax
+  8009f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f7:	4c 8b 22             	mov    (%rdx),%r12
+  8009fa:	eb a0                	jmp    80099c <vprintfmt+0x35e>
+  8009fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a00:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a08:	eb ed                	jmp    8009f7 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a16:	e9 65 ff ff ff       	jmp    800980 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a1b:	4c 89 ee             	mov    %r13,%rsi
+  800a1e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a23:	41 ff d6             	call   *%r14
+                i = -i;
+  800a26:	49 f7 dc             	neg    %r12
+  800a29:	e9 73 ff ff ff       	jmp    8009a1 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a2e:	40 84 f6             	test   %sil,%sil
+  800a31:	75 32                	jne    800a65 <vprintfmt+0x427>
+    switch (lflag) {
+  800a33:	85 d2                	test   %edx,%edx
+  800a35:	74 5d                	je     800a94 <vprintfmt+0x456>
+  800a37:	83 fa 01             	cmp    $0x1,%edx
+  800a3a:	0f 84 82 00 00 00    	je     800ac2 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a43:	83 f8 2f             	cmp    $0x2f,%eax
+  800a46:	0f 87 a5 00 00 00    	ja     800af1 <vprintfmt+0x4b3>
+  800a4c:	89 c2                	mov    %eax,%edx
+  800a4e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a52:	83 c0 08             	add    $0x8,%eax
+  800a55:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a58:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a5b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a60:	e9 99 01 00 00       	jmp    800bfe <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a68:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6b:	77 19                	ja     800a86 <vprintfmt+0x448>
+  800a6d:	89 c2                	mov    %eax,%edx
+  800a6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a73:	83 c0 08             	add    $0x8,%eax
+  800a76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a79:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a7c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a81:	e9 78 01 00 00       	jmp    800bfe <vprintfmt+0x5c0>
+  800a86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a92:	eb e5                	jmp    800a79 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a97:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9a:	77 18                	ja     800ab4 <vprintfmt+0x476>
+  800a9c:	89 c2                	mov    %eax,%edx
+  800a9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa2:	83 c0 08             	add    $0x8,%eax
+  800aa5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa8:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800aaa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800aaf:	e9 4a 01 00 00       	jmp    800bfe <vprintfmt+0x5c0>
+  800ab4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800abc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac0:	eb e6                	jmp    800aa8 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800ac2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac8:	77 19                	ja     800ae3 <vprintfmt+0x4a5>
+  800aca:	89 c2                	mov    %eax,%edx
+  800acc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad0:	83 c0 08             	add    $0x8,%eax
+  800ad3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ad9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800ade:	e9 1b 01 00 00       	jmp    800bfe <vprintfmt+0x5c0>
+  800ae3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aeb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aef:	eb e5                	jmp    800ad6 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800af1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800afd:	e9 56 ff ff ff       	jmp    800a58 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b02:	40 84 f6             	test   %sil,%sil
+  800b05:	75 2e                	jne    800b35 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b07:	85 d2                	test   %edx,%edx
+  800b09:	74 59                	je     800b64 <vprintfmt+0x526>
+  800b0b:	83 fa 01             	cmp    $0x1,%edx
+  800b0e:	74 7f                	je     800b8f <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b13:	83 f8 2f             	cmp    $0x2f,%eax
+  800b16:	0f 87 9f 00 00 00    	ja     800bbb <vprintfmt+0x57d>
+  800b1c:	89 c2                	mov    %eax,%edx
+  800b1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b22:	83 c0 08             	add    $0x8,%eax
+  800b25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b28:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b2b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b30:	e9 c9 00 00 00       	jmp    800bfe <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b35:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b38:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3b:	77 19                	ja     800b56 <vprintfmt+0x518>
+  800b3d:	89 c2                	mov    %eax,%edx
+  800b3f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b43:	83 c0 08             	add    $0x8,%eax
+  800b46:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b49:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b4c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b51:	e9 a8 00 00 00       	jmp    800bfe <vprintfmt+0x5c0>
+  800b56:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b62:	eb e5                	jmp    800b49 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b67:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6a:	77 15                	ja     800b81 <vprintfmt+0x543>
+  800b6c:	89 c2                	mov    %eax,%edx
+  800b6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b72:	83 c0 08             	add    $0x8,%eax
+  800b75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b78:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b7a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b7f:	eb 7d                	jmp    800bfe <vprintfmt+0x5c0>
+  800b81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8d:	eb e9                	jmp    800b78 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b8f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b92:	83 f8 2f             	cmp    $0x2f,%eax
+  800b95:	77 16                	ja     800bad <vprintfmt+0x56f>
+  800b97:	89 c2                	mov    %eax,%edx
+  800b99:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9d:	83 c0 08             	add    $0x8,%eax
+  800ba0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ba6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bab:	eb 51                	jmp    800bfe <vprintfmt+0x5c0>
+  800bad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb9:	eb e8                	jmp    800ba3 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800bbb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bbf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc7:	e9 5c ff ff ff       	jmp    800b28 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800bcc:	4c 89 ee             	mov    %r13,%rsi
+  800bcf:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bd4:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800bd7:	4c 89 ee             	mov    %r13,%rsi
+  800bda:	bf 78 00 00 00       	mov    $0x78,%edi
+  800bdf:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800be2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be5:	83 f8 2f             	cmp    $0x2f,%eax
+  800be8:	77 47                	ja     800c31 <vprintfmt+0x5f3>
+  800bea:	89 c2                	mov    %eax,%edx
+  800bec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf0:	83 c0 08             	add    $0x8,%eax
+  800bf3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bf9:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800bfe:	48 83 ec 08          	sub    $0x8,%rsp
+  800c02:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c06:	0f 94 c0             	sete   %al
+  800c09:	0f b6 c0             	movzbl %al,%eax
+  800c0c:	50                   	push   %rax
+  800c0d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c12:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c16:	4c 89 ee             	mov    %r13,%rsi
+  800c19:	4c 89 f7             	mov    %r14,%rdi
+  800c1c:	48 b8 33 05 80 00 00 	movabs $0x800533,%rax
+  800c23:	00 00 00 
+  800c26:	ff d0                	call   *%rax
+            break;
+  800c28:	48 83 c4 10          	add    $0x10,%rsp
+  800c2c:	e9 3e fa ff ff       	jmp    80066f <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3d:	eb b7                	jmp    800bf6 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c3f:	40 84 f6             	test   %sil,%sil
+  800c42:	75 2b                	jne    800c6f <vprintfmt+0x631>
+    switch (lflag) {
+  800c44:	85 d2                	test   %edx,%edx
+  800c46:	74 56                	je     800c9e <vprintfmt+0x660>
+  800c48:	83 fa 01             	cmp    $0x1,%edx
+  800c4b:	74 7f                	je     800ccc <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c50:	83 f8 2f             	cmp    $0x2f,%eax
+  800c53:	0f 87 a2 00 00 00    	ja     800cfb <vprintfmt+0x6bd>
+  800c59:	89 c2                	mov    %eax,%edx
+  800c5b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c5f:	83 c0 08             	add    $0x8,%eax
+  800c62:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c65:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c68:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c6d:	eb 8f                	jmp    800bfe <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c72:	83 f8 2f             	cmp    $0x2f,%eax
+  800c75:	77 19                	ja     800c90 <vprintfmt+0x652>
+  800c77:	89 c2                	mov    %eax,%edx
+  800c79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7d:	83 c0 08             	add    $0x8,%eax
+  800c80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c83:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c86:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c8b:	e9 6e ff ff ff       	jmp    800bfe <vprintfmt+0x5c0>
+  800c90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c9c:	eb e5                	jmp    800c83 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca4:	77 18                	ja     800cbe <vprintfmt+0x680>
+  800ca6:	89 c2                	mov    %eax,%edx
+  800ca8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cac:	83 c0 08             	add    $0x8,%eax
+  800caf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb2:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800cb4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800cb9:	e9 40 ff ff ff       	jmp    800bfe <vprintfmt+0x5c0>
+  800cbe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cca:	eb e6                	jmp    800cb2 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800ccc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ccf:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd2:	77 19                	ja     800ced <vprintfmt+0x6af>
+  800cd4:	89 c2                	mov    %eax,%edx
+  800cd6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cda:	83 c0 08             	add    $0x8,%eax
+  800cdd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ce0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ce3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ce8:	e9 11 ff ff ff       	jmp    800bfe <vprintfmt+0x5c0>
+  800ced:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf9:	eb e5                	jmp    800ce0 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800cfb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d07:	e9 59 ff ff ff       	jmp    800c65 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d0c:	4c 89 ee             	mov    %r13,%rsi
+  800d0f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d14:	41 ff d6             	call   *%r14
+            break;
+  800d17:	e9 53 f9 ff ff       	jmp    80066f <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d1c:	4c 89 ee             	mov    %r13,%rsi
+  800d1f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d24:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d27:	48 83 eb 01          	sub    $0x1,%rbx
+  800d2b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d2f:	75 f6                	jne    800d27 <vprintfmt+0x6e9>
+  800d31:	e9 39 f9 ff ff       	jmp    80066f <vprintfmt+0x31>
+}
+  800d36:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d3a:	5b                   	pop    %rbx
+  800d3b:	41 5c                	pop    %r12
+  800d3d:	41 5d                	pop    %r13
+  800d3f:	41 5e                	pop    %r14
+  800d41:	41 5f                	pop    %r15
+  800d43:	5d                   	pop    %rbp
+  800d44:	c3                   	ret
+
+0000000000800d45 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d45:	55                   	push   %rbp
+  800d46:	48 89 e5             	mov    %rsp,%rbp
+  800d49:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d4d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d51:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d56:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d5a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d61:	48 85 ff             	test   %rdi,%rdi
+  800d64:	74 2b                	je     800d91 <vsnprintf+0x4c>
+  800d66:	48 85 f6             	test   %rsi,%rsi
+  800d69:	74 26                	je     800d91 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d6b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d6f:	48 bf e9 05 80 00 00 	movabs $0x8005e9,%rdi
+  800d76:	00 00 00 
+  800d79:	48 b8 3e 06 80 00 00 	movabs $0x80063e,%rax
+  800d80:	00 00 00 
+  800d83:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d85:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d89:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d8c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d8f:	c9                   	leave
+  800d90:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d96:	eb f7                	jmp    800d8f <vsnprintf+0x4a>
+
+0000000000800d98 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d98:	55                   	push   %rbp
+  800d99:	48 89 e5             	mov    %rsp,%rbp
+  800d9c:	48 83 ec 50          	sub    $0x50,%rsp
+  800da0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800da4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800da8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dac:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800db3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800db7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dbb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800dbf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800dc3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800dc7:	48 b8 45 0d 80 00 00 	movabs $0x800d45,%rax
+  800dce:	00 00 00 
+  800dd1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800dd3:	c9                   	leave
+  800dd4:	c3                   	ret
+
+0000000000800dd5 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800dd5:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800dd8:	74 10                	je     800dea <strlen+0x15>
+    size_t n = 0;
+  800dda:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ddf:	48 83 c0 01          	add    $0x1,%rax
+  800de3:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800de7:	75 f6                	jne    800ddf <strlen+0xa>
+  800de9:	c3                   	ret
+    size_t n = 0;
+  800dea:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800def:	c3                   	ret
+
+0000000000800df0 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800df0:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800df3:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800df8:	48 85 f6             	test   %rsi,%rsi
+  800dfb:	74 11                	je     800e0e <strnlen+0x1e>
+  800dfd:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e01:	74 0c                	je     800e0f <strnlen+0x1f>
+  800e03:	48 83 c2 01          	add    $0x1,%rdx
+  800e07:	48 39 d0             	cmp    %rdx,%rax
+  800e0a:	75 f1                	jne    800dfd <strnlen+0xd>
+  800e0c:	eb 04                	jmp    800e12 <strnlen+0x22>
+  800e0e:	c3                   	ret
+  800e0f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e12:	c3                   	ret
+
+0000000000800e13 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e13:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e16:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e1f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e22:	48 83 c2 01          	add    $0x1,%rdx
+  800e26:	84 c9                	test   %cl,%cl
+  800e28:	75 f1                	jne    800e1b <strcpy+0x8>
+        ;
+    return res;
+}
+  800e2a:	c3                   	ret
+
+0000000000800e2b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e2b:	55                   	push   %rbp
+  800e2c:	48 89 e5             	mov    %rsp,%rbp
+  800e2f:	41 54                	push   %r12
+  800e31:	53                   	push   %rbx
+  800e32:	48 89 fb             	mov    %rdi,%rbx
+  800e35:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e38:	48 b8 d5 0d 80 00 00 	movabs $0x800dd5,%rax
+  800e3f:	00 00 00 
+  800e42:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e44:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e48:	4c 89 e6             	mov    %r12,%rsi
+  800e4b:	48 b8 13 0e 80 00 00 	movabs $0x800e13,%rax
+  800e52:	00 00 00 
+  800e55:	ff d0                	call   *%rax
+    return dst;
+}
+  800e57:	48 89 d8             	mov    %rbx,%rax
+  800e5a:	5b                   	pop    %rbx
+  800e5b:	41 5c                	pop    %r12
+  800e5d:	5d                   	pop    %rbp
+  800e5e:	c3                   	ret
+
+0000000000800e5f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e5f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e62:	48 85 d2             	test   %rdx,%rdx
+  800e65:	74 1f                	je     800e86 <strncpy+0x27>
+  800e67:	48 01 fa             	add    %rdi,%rdx
+  800e6a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e6d:	48 83 c1 01          	add    $0x1,%rcx
+  800e71:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e75:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e79:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e7d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e81:	48 39 ca             	cmp    %rcx,%rdx
+  800e84:	75 e7                	jne    800e6d <strncpy+0xe>
+    }
+    return ret;
+}
+  800e86:	c3                   	ret
+
+0000000000800e87 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e87:	48 89 f8             	mov    %rdi,%rax
+  800e8a:	48 85 d2             	test   %rdx,%rdx
+  800e8d:	74 24                	je     800eb3 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e8f:	48 83 ea 01          	sub    $0x1,%rdx
+  800e93:	74 1b                	je     800eb0 <strlcpy+0x29>
+  800e95:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e99:	0f b6 16             	movzbl (%rsi),%edx
+  800e9c:	84 d2                	test   %dl,%dl
+  800e9e:	74 10                	je     800eb0 <strlcpy+0x29>
+            *dst++ = *src++;
+  800ea0:	48 83 c6 01          	add    $0x1,%rsi
+  800ea4:	48 83 c0 01          	add    $0x1,%rax
+  800ea8:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800eab:	48 39 c8             	cmp    %rcx,%rax
+  800eae:	75 e9                	jne    800e99 <strlcpy+0x12>
+        *dst = '\0';
+  800eb0:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800eb3:	48 29 f8             	sub    %rdi,%rax
+}
+  800eb6:	c3                   	ret
+
+0000000000800eb7 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800eb7:	0f b6 07             	movzbl (%rdi),%eax
+  800eba:	84 c0                	test   %al,%al
+  800ebc:	74 13                	je     800ed1 <strcmp+0x1a>
+  800ebe:	38 06                	cmp    %al,(%rsi)
+  800ec0:	75 0f                	jne    800ed1 <strcmp+0x1a>
+  800ec2:	48 83 c7 01          	add    $0x1,%rdi
+  800ec6:	48 83 c6 01          	add    $0x1,%rsi
+  800eca:	0f b6 07             	movzbl (%rdi),%eax
+  800ecd:	84 c0                	test   %al,%al
+  800ecf:	75 ed                	jne    800ebe <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ed1:	0f b6 c0             	movzbl %al,%eax
+  800ed4:	0f b6 16             	movzbl (%rsi),%edx
+  800ed7:	29 d0                	sub    %edx,%eax
+}
+  800ed9:	c3                   	ret
+
+0000000000800eda <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800eda:	48 85 d2             	test   %rdx,%rdx
+  800edd:	74 1f                	je     800efe <strncmp+0x24>
+  800edf:	0f b6 07             	movzbl (%rdi),%eax
+  800ee2:	84 c0                	test   %al,%al
+  800ee4:	74 1e                	je     800f04 <strncmp+0x2a>
+  800ee6:	3a 06                	cmp    (%rsi),%al
+  800ee8:	75 1a                	jne    800f04 <strncmp+0x2a>
+  800eea:	48 83 c7 01          	add    $0x1,%rdi
+  800eee:	48 83 c6 01          	add    $0x1,%rsi
+  800ef2:	48 83 ea 01          	sub    $0x1,%rdx
+  800ef6:	75 e7                	jne    800edf <strncmp+0x5>
+
+    if (!n) return 0;
+  800ef8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800efd:	c3                   	ret
+  800efe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f03:	c3                   	ret
+  800f04:	48 85 d2             	test   %rdx,%rdx
+  800f07:	74 09                	je     800f12 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f09:	0f b6 07             	movzbl (%rdi),%eax
+  800f0c:	0f b6 16             	movzbl (%rsi),%edx
+  800f0f:	29 d0                	sub    %edx,%eax
+  800f11:	c3                   	ret
+    if (!n) return 0;
+  800f12:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f17:	c3                   	ret
+
+0000000000800f18 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f18:	0f b6 17             	movzbl (%rdi),%edx
+  800f1b:	84 d2                	test   %dl,%dl
+  800f1d:	74 18                	je     800f37 <strchr+0x1f>
+        if (*str == c) {
+  800f1f:	0f be d2             	movsbl %dl,%edx
+  800f22:	39 f2                	cmp    %esi,%edx
+  800f24:	74 17                	je     800f3d <strchr+0x25>
+    for (; *str; str++) {
+  800f26:	48 83 c7 01          	add    $0x1,%rdi
+  800f2a:	0f b6 17             	movzbl (%rdi),%edx
+  800f2d:	84 d2                	test   %dl,%dl
+  800f2f:	75 ee                	jne    800f1f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f36:	c3                   	ret
+  800f37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f3c:	c3                   	ret
+  800f3d:	48 89 f8             	mov    %rdi,%rax
+}
+  800f40:	c3                   	ret
+
+0000000000800f41 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f41:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f44:	0f b6 17             	movzbl (%rdi),%edx
+  800f47:	84 d2                	test   %dl,%dl
+  800f49:	74 13                	je     800f5e <strfind+0x1d>
+  800f4b:	0f be d2             	movsbl %dl,%edx
+  800f4e:	39 f2                	cmp    %esi,%edx
+  800f50:	74 0b                	je     800f5d <strfind+0x1c>
+  800f52:	48 83 c0 01          	add    $0x1,%rax
+  800f56:	0f b6 10             	movzbl (%rax),%edx
+  800f59:	84 d2                	test   %dl,%dl
+  800f5b:	75 ee                	jne    800f4b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f5d:	c3                   	ret
+  800f5e:	c3                   	ret
+
+0000000000800f5f <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f5f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f62:	48 89 f8             	mov    %rdi,%rax
+  800f65:	48 f7 d8             	neg    %rax
+  800f68:	83 e0 07             	and    $0x7,%eax
+  800f6b:	49 89 d1             	mov    %rdx,%r9
+  800f6e:	49 29 c1             	sub    %rax,%r9
+  800f71:	78 36                	js     800fa9 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f73:	40 0f b6 c6          	movzbl %sil,%eax
+  800f77:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f7e:	01 01 01 
+  800f81:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f85:	40 f6 c7 07          	test   $0x7,%dil
+  800f89:	75 38                	jne    800fc3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f8b:	4c 89 c9             	mov    %r9,%rcx
+  800f8e:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f92:	74 0c                	je     800fa0 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f94:	fc                   	cld
+  800f95:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f98:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f9c:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fa0:	4d 85 c9             	test   %r9,%r9
+  800fa3:	75 45                	jne    800fea <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fa5:	4c 89 c0             	mov    %r8,%rax
+  800fa8:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fa9:	48 85 d2             	test   %rdx,%rdx
+  800fac:	74 f7                	je     800fa5 <memset+0x46>
+  800fae:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fb1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fb4:	48 83 c0 01          	add    $0x1,%rax
+  800fb8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fbc:	48 39 c2             	cmp    %rax,%rdx
+  800fbf:	75 f3                	jne    800fb4 <memset+0x55>
+  800fc1:	eb e2                	jmp    800fa5 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fc3:	40 f6 c7 01          	test   $0x1,%dil
+  800fc7:	74 06                	je     800fcf <memset+0x70>
+  800fc9:	88 07                	mov    %al,(%rdi)
+  800fcb:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fcf:	40 f6 c7 02          	test   $0x2,%dil
+  800fd3:	74 07                	je     800fdc <memset+0x7d>
+  800fd5:	66 89 07             	mov    %ax,(%rdi)
+  800fd8:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800fdc:	40 f6 c7 04          	test   $0x4,%dil
+  800fe0:	74 a9                	je     800f8b <memset+0x2c>
+  800fe2:	89 07                	mov    %eax,(%rdi)
+  800fe4:	48 83 c7 04          	add    $0x4,%rdi
+  800fe8:	eb a1                	jmp    800f8b <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800fea:	41 f6 c1 04          	test   $0x4,%r9b
+  800fee:	74 06                	je     800ff6 <memset+0x97>
+  800ff0:	89 07                	mov    %eax,(%rdi)
+  800ff2:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ff6:	41 f6 c1 02          	test   $0x2,%r9b
+  800ffa:	74 07                	je     801003 <memset+0xa4>
+  800ffc:	66 89 07             	mov    %ax,(%rdi)
+  800fff:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801003:	41 f6 c1 01          	test   $0x1,%r9b
+  801007:	74 9c                	je     800fa5 <memset+0x46>
+  801009:	88 07                	mov    %al,(%rdi)
+  80100b:	eb 98                	jmp    800fa5 <memset+0x46>
+
+000000000080100d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80100d:	48 89 f8             	mov    %rdi,%rax
+  801010:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801013:	48 39 fe             	cmp    %rdi,%rsi
+  801016:	73 3b                	jae    801053 <memmove+0x46>
+  801018:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80101c:	48 39 d7             	cmp    %rdx,%rdi
+  80101f:	73 32                	jae    801053 <memmove+0x46>
+        s += n;
+        d += n;
+  801021:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801025:	48 89 d6             	mov    %rdx,%rsi
+  801028:	48 09 fe             	or     %rdi,%rsi
+  80102b:	48 09 ce             	or     %rcx,%rsi
+  80102e:	40 f6 c6 07          	test   $0x7,%sil
+  801032:	75 12                	jne    801046 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801034:	48 83 ef 08          	sub    $0x8,%rdi
+  801038:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80103c:	48 c1 e9 03          	shr    $0x3,%rcx
+  801040:	fd                   	std
+  801041:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801044:	fc                   	cld
+  801045:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801046:	48 83 ef 01          	sub    $0x1,%rdi
+  80104a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80104e:	fd                   	std
+  80104f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801051:	eb f1                	jmp    801044 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801053:	48 89 f2             	mov    %rsi,%rdx
+  801056:	48 09 c2             	or     %rax,%rdx
+  801059:	48 09 ca             	or     %rcx,%rdx
+  80105c:	f6 c2 07             	test   $0x7,%dl
+  80105f:	75 0c                	jne    80106d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801061:	48 c1 e9 03          	shr    $0x3,%rcx
+  801065:	48 89 c7             	mov    %rax,%rdi
+  801068:	fc                   	cld
+  801069:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80106c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80106d:	48 89 c7             	mov    %rax,%rdi
+  801070:	fc                   	cld
+  801071:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801073:	c3                   	ret
+
+0000000000801074 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801074:	55                   	push   %rbp
+  801075:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801078:	48 b8 0d 10 80 00 00 	movabs $0x80100d,%rax
+  80107f:	00 00 00 
+  801082:	ff d0                	call   *%rax
+}
+  801084:	5d                   	pop    %rbp
+  801085:	c3                   	ret
+
+0000000000801086 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801086:	55                   	push   %rbp
+  801087:	48 89 e5             	mov    %rsp,%rbp
+  80108a:	41 57                	push   %r15
+  80108c:	41 56                	push   %r14
+  80108e:	41 55                	push   %r13
+  801090:	41 54                	push   %r12
+  801092:	53                   	push   %rbx
+  801093:	48 83 ec 08          	sub    $0x8,%rsp
+  801097:	49 89 fe             	mov    %rdi,%r14
+  80109a:	49 89 f7             	mov    %rsi,%r15
+  80109d:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010a0:	48 89 f7             	mov    %rsi,%rdi
+  8010a3:	48 b8 d5 0d 80 00 00 	movabs $0x800dd5,%rax
+  8010aa:	00 00 00 
+  8010ad:	ff d0                	call   *%rax
+  8010af:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010b2:	48 89 de             	mov    %rbx,%rsi
+  8010b5:	4c 89 f7             	mov    %r14,%rdi
+  8010b8:	48 b8 f0 0d 80 00 00 	movabs $0x800df0,%rax
+  8010bf:	00 00 00 
+  8010c2:	ff d0                	call   *%rax
+  8010c4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010c7:	48 39 c3             	cmp    %rax,%rbx
+  8010ca:	74 36                	je     801102 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010cc:	48 89 d8             	mov    %rbx,%rax
+  8010cf:	4c 29 e8             	sub    %r13,%rax
+  8010d2:	49 39 c4             	cmp    %rax,%r12
+  8010d5:	73 31                	jae    801108 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010d7:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8010dc:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010e0:	4c 89 fe             	mov    %r15,%rsi
+  8010e3:	48 b8 74 10 80 00 00 	movabs $0x801074,%rax
+  8010ea:	00 00 00 
+  8010ed:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8010ef:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8010f3:	48 83 c4 08          	add    $0x8,%rsp
+  8010f7:	5b                   	pop    %rbx
+  8010f8:	41 5c                	pop    %r12
+  8010fa:	41 5d                	pop    %r13
+  8010fc:	41 5e                	pop    %r14
+  8010fe:	41 5f                	pop    %r15
+  801100:	5d                   	pop    %rbp
+  801101:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801102:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801106:	eb eb                	jmp    8010f3 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801108:	48 83 eb 01          	sub    $0x1,%rbx
+  80110c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801110:	48 89 da             	mov    %rbx,%rdx
+  801113:	4c 89 fe             	mov    %r15,%rsi
+  801116:	48 b8 74 10 80 00 00 	movabs $0x801074,%rax
+  80111d:	00 00 00 
+  801120:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801122:	49 01 de             	add    %rbx,%r14
+  801125:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80112a:	eb c3                	jmp    8010ef <strlcat+0x69>
+
+000000000080112c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80112c:	48 85 d2             	test   %rdx,%rdx
+  80112f:	74 2d                	je     80115e <memcmp+0x32>
+  801131:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801136:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80113a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80113f:	44 38 c1             	cmp    %r8b,%cl
+  801142:	75 0f                	jne    801153 <memcmp+0x27>
+    while (n-- > 0) {
+  801144:	48 83 c0 01          	add    $0x1,%rax
+  801148:	48 39 c2             	cmp    %rax,%rdx
+  80114b:	75 e9                	jne    801136 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80114d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801152:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801153:	0f b6 c1             	movzbl %cl,%eax
+  801156:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80115a:	44 29 c0             	sub    %r8d,%eax
+  80115d:	c3                   	ret
+    return 0;
+  80115e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801163:	c3                   	ret
+
+0000000000801164 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801164:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801168:	48 39 c7             	cmp    %rax,%rdi
+  80116b:	73 0f                	jae    80117c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80116d:	40 38 37             	cmp    %sil,(%rdi)
+  801170:	74 0e                	je     801180 <memfind+0x1c>
+    for (; src < end; src++) {
+  801172:	48 83 c7 01          	add    $0x1,%rdi
+  801176:	48 39 f8             	cmp    %rdi,%rax
+  801179:	75 f2                	jne    80116d <memfind+0x9>
+  80117b:	c3                   	ret
+  80117c:	48 89 f8             	mov    %rdi,%rax
+  80117f:	c3                   	ret
+  801180:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801183:	c3                   	ret
+
+0000000000801184 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801184:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801187:	0f b6 37             	movzbl (%rdi),%esi
+  80118a:	40 80 fe 20          	cmp    $0x20,%sil
+  80118e:	74 06                	je     801196 <strtol+0x12>
+  801190:	40 80 fe 09          	cmp    $0x9,%sil
+  801194:	75 13                	jne    8011a9 <strtol+0x25>
+  801196:	48 83 c7 01          	add    $0x1,%rdi
+  80119a:	0f b6 37             	movzbl (%rdi),%esi
+  80119d:	40 80 fe 20          	cmp    $0x20,%sil
+  8011a1:	74 f3                	je     801196 <strtol+0x12>
+  8011a3:	40 80 fe 09          	cmp    $0x9,%sil
+  8011a7:	74 ed                	je     801196 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011a9:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011ac:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011af:	3c 01                	cmp    $0x1,%al
+  8011b1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011b5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011bb:	75 0f                	jne    8011cc <strtol+0x48>
+  8011bd:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011c0:	74 14                	je     8011d6 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011c2:	85 d2                	test   %edx,%edx
+  8011c4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011c9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011cc:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011d1:	4c 63 ca             	movslq %edx,%r9
+  8011d4:	eb 36                	jmp    80120c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011d6:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011da:	74 0f                	je     8011eb <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8011dc:	85 d2                	test   %edx,%edx
+  8011de:	75 ec                	jne    8011cc <strtol+0x48>
+        s++;
+  8011e0:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8011e4:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8011e9:	eb e1                	jmp    8011cc <strtol+0x48>
+        s += 2;
+  8011eb:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8011ef:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8011f4:	eb d6                	jmp    8011cc <strtol+0x48>
+            dig -= '0';
+  8011f6:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8011f9:	44 0f b6 c1          	movzbl %cl,%r8d
+  8011fd:	41 39 d0             	cmp    %edx,%r8d
+  801200:	7d 21                	jge    801223 <strtol+0x9f>
+        val = val * base + dig;
+  801202:	49 0f af c1          	imul   %r9,%rax
+  801206:	0f b6 c9             	movzbl %cl,%ecx
+  801209:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80120c:	48 83 c7 01          	add    $0x1,%rdi
+  801210:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801214:	80 f9 39             	cmp    $0x39,%cl
+  801217:	76 dd                	jbe    8011f6 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801219:	80 f9 7b             	cmp    $0x7b,%cl
+  80121c:	77 05                	ja     801223 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80121e:	83 e9 57             	sub    $0x57,%ecx
+  801221:	eb d6                	jmp    8011f9 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801223:	4d 85 d2             	test   %r10,%r10
+  801226:	74 03                	je     80122b <strtol+0xa7>
+  801228:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80122b:	48 89 c2             	mov    %rax,%rdx
+  80122e:	48 f7 da             	neg    %rdx
+  801231:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801235:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801239:	c3                   	ret
+
+000000000080123a <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80123a:	55                   	push   %rbp
+  80123b:	48 89 e5             	mov    %rsp,%rbp
+  80123e:	53                   	push   %rbx
+  80123f:	48 89 fa             	mov    %rdi,%rdx
+  801242:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801245:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80124a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801254:	be 00 00 00 00       	mov    $0x0,%esi
+  801259:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80125f:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801261:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801265:	c9                   	leave
+  801266:	c3                   	ret
+
+0000000000801267 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801267:	55                   	push   %rbp
+  801268:	48 89 e5             	mov    %rsp,%rbp
+  80126b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80126c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801271:	ba 00 00 00 00       	mov    $0x0,%edx
+  801276:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80127b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801280:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801285:	be 00 00 00 00       	mov    $0x0,%esi
+  80128a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801290:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801292:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801296:	c9                   	leave
+  801297:	c3                   	ret
+
+0000000000801298 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801298:	55                   	push   %rbp
+  801299:	48 89 e5             	mov    %rsp,%rbp
+  80129c:	53                   	push   %rbx
+  80129d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012a1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a4:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012c5:	48 85 c0             	test   %rax,%rax
+  8012c8:	7f 06                	jg     8012d0 <sys_env_destroy+0x38>
+}
+  8012ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ce:	c9                   	leave
+  8012cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d0:	49 89 c0             	mov    %rax,%r8
+  8012d3:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012d8:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  8012df:	00 00 00 
+  8012e2:	be 26 00 00 00       	mov    $0x26,%esi
+  8012e7:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  8012ee:	00 00 00 
+  8012f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f6:	49 b9 9e 03 80 00 00 	movabs $0x80039e,%r9
+  8012fd:	00 00 00 
+  801300:	41 ff d1             	call   *%r9
+
+0000000000801303 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801303:	55                   	push   %rbp
+  801304:	48 89 e5             	mov    %rsp,%rbp
+  801307:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801308:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80130d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801312:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801317:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801321:	be 00 00 00 00       	mov    $0x0,%esi
+  801326:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80132c:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80132e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801332:	c9                   	leave
+  801333:	c3                   	ret
+
+0000000000801334 <sys_yield>:
+
+void
+sys_yield(void) {
+  801334:	55                   	push   %rbp
+  801335:	48 89 e5             	mov    %rsp,%rbp
+  801338:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801339:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80133e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801343:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801348:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801352:	be 00 00 00 00       	mov    $0x0,%esi
+  801357:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80135d:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80135f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801363:	c9                   	leave
+  801364:	c3                   	ret
+
+0000000000801365 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801365:	55                   	push   %rbp
+  801366:	48 89 e5             	mov    %rsp,%rbp
+  801369:	53                   	push   %rbx
+  80136a:	48 89 fa             	mov    %rdi,%rdx
+  80136d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801370:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801375:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80137c:	00 00 00 
+  80137f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801384:	be 00 00 00 00       	mov    $0x0,%esi
+  801389:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80138f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801391:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801395:	c9                   	leave
+  801396:	c3                   	ret
+
+0000000000801397 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801397:	55                   	push   %rbp
+  801398:	48 89 e5             	mov    %rsp,%rbp
+  80139b:	53                   	push   %rbx
+  80139c:	49 89 f8             	mov    %rdi,%r8
+  80139f:	48 89 d3             	mov    %rdx,%rbx
+  8013a2:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013a5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013aa:	4c 89 c2             	mov    %r8,%rdx
+  8013ad:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013bb:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c1:	c9                   	leave
+  8013c2:	c3                   	ret
+
+00000000008013c3 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013c3:	55                   	push   %rbp
+  8013c4:	48 89 e5             	mov    %rsp,%rbp
+  8013c7:	53                   	push   %rbx
+  8013c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8013cc:	89 f8                	mov    %edi,%eax
+  8013ce:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8013d1:	48 63 f9             	movslq %ecx,%rdi
+  8013d4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d7:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013dc:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013df:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ea:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013ec:	48 85 c0             	test   %rax,%rax
+  8013ef:	7f 06                	jg     8013f7 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f5:	c9                   	leave
+  8013f6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013f7:	49 89 c0             	mov    %rax,%r8
+  8013fa:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013ff:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  801406:	00 00 00 
+  801409:	be 26 00 00 00       	mov    $0x26,%esi
+  80140e:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801415:	00 00 00 
+  801418:	b8 00 00 00 00       	mov    $0x0,%eax
+  80141d:	49 b9 9e 03 80 00 00 	movabs $0x80039e,%r9
+  801424:	00 00 00 
+  801427:	41 ff d1             	call   *%r9
+
+000000000080142a <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80142a:	55                   	push   %rbp
+  80142b:	48 89 e5             	mov    %rsp,%rbp
+  80142e:	53                   	push   %rbx
+  80142f:	48 83 ec 08          	sub    $0x8,%rsp
+  801433:	89 f8                	mov    %edi,%eax
+  801435:	49 89 f2             	mov    %rsi,%r10
+  801438:	48 89 cf             	mov    %rcx,%rdi
+  80143b:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80143e:	48 63 da             	movslq %edx,%rbx
+  801441:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801444:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801449:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80144c:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80144f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801451:	48 85 c0             	test   %rax,%rax
+  801454:	7f 06                	jg     80145c <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801456:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80145a:	c9                   	leave
+  80145b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80145c:	49 89 c0             	mov    %rax,%r8
+  80145f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801464:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  80146b:	00 00 00 
+  80146e:	be 26 00 00 00       	mov    $0x26,%esi
+  801473:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  80147a:	00 00 00 
+  80147d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801482:	49 b9 9e 03 80 00 00 	movabs $0x80039e,%r9
+  801489:	00 00 00 
+  80148c:	41 ff d1             	call   *%r9
+
+000000000080148f <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80148f:	55                   	push   %rbp
+  801490:	48 89 e5             	mov    %rsp,%rbp
+  801493:	53                   	push   %rbx
+  801494:	48 83 ec 08          	sub    $0x8,%rsp
+  801498:	48 89 f1             	mov    %rsi,%rcx
+  80149b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80149e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a1:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014b8:	48 85 c0             	test   %rax,%rax
+  8014bb:	7f 06                	jg     8014c3 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c1:	c9                   	leave
+  8014c2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c3:	49 89 c0             	mov    %rax,%r8
+  8014c6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014cb:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  8014d2:	00 00 00 
+  8014d5:	be 26 00 00 00       	mov    $0x26,%esi
+  8014da:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  8014e1:	00 00 00 
+  8014e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e9:	49 b9 9e 03 80 00 00 	movabs $0x80039e,%r9
+  8014f0:	00 00 00 
+  8014f3:	41 ff d1             	call   *%r9
+
+00000000008014f6 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  8014f6:	55                   	push   %rbp
+  8014f7:	48 89 e5             	mov    %rsp,%rbp
+  8014fa:	53                   	push   %rbx
+  8014fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ff:	89 f8                	mov    %edi,%eax
+  801501:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801504:	48 63 f9             	movslq %ecx,%rdi
+  801507:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80150a:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80150f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801512:	be 00 00 00 00       	mov    $0x0,%esi
+  801517:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80151d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80151f:	48 85 c0             	test   %rax,%rax
+  801522:	7f 06                	jg     80152a <sys_region_advise+0x34>
+}
+  801524:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801528:	c9                   	leave
+  801529:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80152a:	49 89 c0             	mov    %rax,%r8
+  80152d:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801532:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  801539:	00 00 00 
+  80153c:	be 26 00 00 00       	mov    $0x26,%esi
+  801541:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801548:	00 00 00 
+  80154b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801550:	49 b9 9e 03 80 00 00 	movabs $0x80039e,%r9
+  801557:	00 00 00 
+  80155a:	41 ff d1             	call   *%r9
+
+000000000080155d <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  80155d:	55                   	push   %rbp
+  80155e:	48 89 e5             	mov    %rsp,%rbp
+  801561:	53                   	push   %rbx
+  801562:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801566:	48 63 ce             	movslq %esi,%rcx
+  801569:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80156c:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801571:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801576:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80157b:	be 00 00 00 00       	mov    $0x0,%esi
+  801580:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801586:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801588:	48 85 c0             	test   %rax,%rax
+  80158b:	7f 06                	jg     801593 <sys_env_set_nice+0x36>
+}
+  80158d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801591:	c9                   	leave
+  801592:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801593:	49 89 c0             	mov    %rax,%r8
+  801596:	b9 15 00 00 00       	mov    $0x15,%ecx
+  80159b:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  8015a2:	00 00 00 
+  8015a5:	be 26 00 00 00       	mov    $0x26,%esi
+  8015aa:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  8015b1:	00 00 00 
+  8015b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b9:	49 b9 9e 03 80 00 00 	movabs $0x80039e,%r9
+  8015c0:	00 00 00 
+  8015c3:	41 ff d1             	call   *%r9
+
+00000000008015c6 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8015c6:	55                   	push   %rbp
+  8015c7:	48 89 e5             	mov    %rsp,%rbp
+  8015ca:	53                   	push   %rbx
+  8015cb:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8015cf:	48 63 ce             	movslq %esi,%rcx
+  8015d2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d5:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ef:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015f1:	48 85 c0             	test   %rax,%rax
+  8015f4:	7f 06                	jg     8015fc <sys_env_set_status+0x36>
+}
+  8015f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015fa:	c9                   	leave
+  8015fb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015fc:	49 89 c0             	mov    %rax,%r8
+  8015ff:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801604:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  80160b:	00 00 00 
+  80160e:	be 26 00 00 00       	mov    $0x26,%esi
+  801613:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  80161a:	00 00 00 
+  80161d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801622:	49 b9 9e 03 80 00 00 	movabs $0x80039e,%r9
+  801629:	00 00 00 
+  80162c:	41 ff d1             	call   *%r9
+
+000000000080162f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80162f:	55                   	push   %rbp
+  801630:	48 89 e5             	mov    %rsp,%rbp
+  801633:	53                   	push   %rbx
+  801634:	48 83 ec 08          	sub    $0x8,%rsp
+  801638:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80163b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80163e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801643:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801648:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80164d:	be 00 00 00 00       	mov    $0x0,%esi
+  801652:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801658:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80165a:	48 85 c0             	test   %rax,%rax
+  80165d:	7f 06                	jg     801665 <sys_env_set_trapframe+0x36>
+}
+  80165f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801663:	c9                   	leave
+  801664:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801665:	49 89 c0             	mov    %rax,%r8
+  801668:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80166d:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  801674:	00 00 00 
+  801677:	be 26 00 00 00       	mov    $0x26,%esi
+  80167c:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801683:	00 00 00 
+  801686:	b8 00 00 00 00       	mov    $0x0,%eax
+  80168b:	49 b9 9e 03 80 00 00 	movabs $0x80039e,%r9
+  801692:	00 00 00 
+  801695:	41 ff d1             	call   *%r9
+
+0000000000801698 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801698:	55                   	push   %rbp
+  801699:	48 89 e5             	mov    %rsp,%rbp
+  80169c:	53                   	push   %rbx
+  80169d:	48 83 ec 08          	sub    $0x8,%rsp
+  8016a1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8016a4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016a7:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8016bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016c3:	48 85 c0             	test   %rax,%rax
+  8016c6:	7f 06                	jg     8016ce <sys_env_set_pgfault_upcall+0x36>
+}
+  8016c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016cc:	c9                   	leave
+  8016cd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ce:	49 89 c0             	mov    %rax,%r8
+  8016d1:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8016d6:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  8016dd:	00 00 00 
+  8016e0:	be 26 00 00 00       	mov    $0x26,%esi
+  8016e5:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  8016ec:	00 00 00 
+  8016ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f4:	49 b9 9e 03 80 00 00 	movabs $0x80039e,%r9
+  8016fb:	00 00 00 
+  8016fe:	41 ff d1             	call   *%r9
+
+0000000000801701 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801701:	55                   	push   %rbp
+  801702:	48 89 e5             	mov    %rsp,%rbp
+  801705:	53                   	push   %rbx
+  801706:	89 f8                	mov    %edi,%eax
+  801708:	49 89 f1             	mov    %rsi,%r9
+  80170b:	48 89 d3             	mov    %rdx,%rbx
+  80170e:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801711:	49 63 f0             	movslq %r8d,%rsi
+  801714:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801717:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80171c:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80171f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801725:	cd 30                	int    $0x30
+}
+  801727:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80172b:	c9                   	leave
+  80172c:	c3                   	ret
+
+000000000080172d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80172d:	55                   	push   %rbp
+  80172e:	48 89 e5             	mov    %rsp,%rbp
+  801731:	53                   	push   %rbx
+  801732:	48 83 ec 08          	sub    $0x8,%rsp
+  801736:	48 89 fa             	mov    %rdi,%rdx
+  801739:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80173c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801741:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801746:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80174b:	be 00 00 00 00       	mov    $0x0,%esi
+  801750:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801756:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801758:	48 85 c0             	test   %rax,%rax
+  80175b:	7f 06                	jg     801763 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80175d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801761:	c9                   	leave
+  801762:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801763:	49 89 c0             	mov    %rax,%r8
+  801766:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80176b:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  801772:	00 00 00 
+  801775:	be 26 00 00 00       	mov    $0x26,%esi
+  80177a:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801781:	00 00 00 
+  801784:	b8 00 00 00 00       	mov    $0x0,%eax
+  801789:	49 b9 9e 03 80 00 00 	movabs $0x80039e,%r9
+  801790:	00 00 00 
+  801793:	41 ff d1             	call   *%r9
+
+0000000000801796 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801796:	55                   	push   %rbp
+  801797:	48 89 e5             	mov    %rsp,%rbp
+  80179a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80179b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017bf:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c5:	c9                   	leave
+  8017c6:	c3                   	ret
+
+00000000008017c7 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  8017c7:	55                   	push   %rbp
+  8017c8:	48 89 e5             	mov    %rsp,%rbp
+  8017cb:	53                   	push   %rbx
+  8017cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8017d0:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  8017d3:	48 63 ce             	movslq %esi,%rcx
+  8017d6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017d9:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017de:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ee:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017f0:	48 85 c0             	test   %rax,%rax
+  8017f3:	7f 06                	jg     8017fb <sys_sigqueue+0x34>
+}
+  8017f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f9:	c9                   	leave
+  8017fa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017fb:	49 89 c0             	mov    %rax,%r8
+  8017fe:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801803:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  80180a:	00 00 00 
+  80180d:	be 26 00 00 00       	mov    $0x26,%esi
+  801812:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801819:	00 00 00 
+  80181c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801821:	49 b9 9e 03 80 00 00 	movabs $0x80039e,%r9
+  801828:	00 00 00 
+  80182b:	41 ff d1             	call   *%r9
+
+000000000080182e <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  80182e:	55                   	push   %rbp
+  80182f:	48 89 e5             	mov    %rsp,%rbp
+  801832:	53                   	push   %rbx
+  801833:	48 83 ec 08          	sub    $0x8,%rsp
+  801837:	48 89 fa             	mov    %rdi,%rdx
+  80183a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80183d:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801842:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801847:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80184c:	be 00 00 00 00       	mov    $0x0,%esi
+  801851:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801857:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801859:	48 85 c0             	test   %rax,%rax
+  80185c:	7f 06                	jg     801864 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  80185e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801862:	c9                   	leave
+  801863:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801864:	49 89 c0             	mov    %rax,%r8
+  801867:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80186c:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  801873:	00 00 00 
+  801876:	be 26 00 00 00       	mov    $0x26,%esi
+  80187b:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801882:	00 00 00 
+  801885:	b8 00 00 00 00       	mov    $0x0,%eax
+  80188a:	49 b9 9e 03 80 00 00 	movabs $0x80039e,%r9
+  801891:	00 00 00 
+  801894:	41 ff d1             	call   *%r9
+
+0000000000801897 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801897:	55                   	push   %rbp
+  801898:	48 89 e5             	mov    %rsp,%rbp
+  80189b:	53                   	push   %rbx
+  80189c:	48 83 ec 08          	sub    $0x8,%rsp
+  8018a0:	48 89 f1             	mov    %rsi,%rcx
+  8018a3:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  8018a6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018a9:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018c0:	48 85 c0             	test   %rax,%rax
+  8018c3:	7f 06                	jg     8018cb <sys_sigaction+0x34>
+}
+  8018c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018c9:	c9                   	leave
+  8018ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018cb:	49 89 c0             	mov    %rax,%r8
+  8018ce:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8018d3:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  8018da:	00 00 00 
+  8018dd:	be 26 00 00 00       	mov    $0x26,%esi
+  8018e2:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  8018e9:	00 00 00 
+  8018ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f1:	49 b9 9e 03 80 00 00 	movabs $0x80039e,%r9
+  8018f8:	00 00 00 
+  8018fb:	41 ff d1             	call   *%r9
+
+00000000008018fe <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8018fe:	55                   	push   %rbp
+  8018ff:	48 89 e5             	mov    %rsp,%rbp
+  801902:	53                   	push   %rbx
+  801903:	48 83 ec 08          	sub    $0x8,%rsp
+  801907:	48 89 f1             	mov    %rsi,%rcx
+  80190a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  80190d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801910:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801915:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80191a:	be 00 00 00 00       	mov    $0x0,%esi
+  80191f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801925:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801927:	48 85 c0             	test   %rax,%rax
+  80192a:	7f 06                	jg     801932 <sys_sigprocmask+0x34>
+}
+  80192c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801930:	c9                   	leave
+  801931:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801932:	49 89 c0             	mov    %rax,%r8
+  801935:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80193a:	48 ba 10 35 80 00 00 	movabs $0x803510,%rdx
+  801941:	00 00 00 
+  801944:	be 26 00 00 00       	mov    $0x26,%esi
+  801949:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801950:	00 00 00 
+  801953:	b8 00 00 00 00       	mov    $0x0,%eax
+  801958:	49 b9 9e 03 80 00 00 	movabs $0x80039e,%r9
+  80195f:	00 00 00 
+  801962:	41 ff d1             	call   *%r9
+
+0000000000801965 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801965:	55                   	push   %rbp
+  801966:	48 89 e5             	mov    %rsp,%rbp
+  801969:	41 54                	push   %r12
+  80196b:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80196c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801971:	cd 30                	int    $0x30
+  801973:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  801976:	85 c0                	test   %eax,%eax
+  801978:	78 76                	js     8019f0 <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  80197a:	74 7c                	je     8019f8 <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  80197c:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801982:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801989:	00 00 00 
+  80198c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801991:	89 c2                	mov    %eax,%edx
+  801993:	be 00 00 00 00       	mov    $0x0,%esi
+  801998:	bf 00 00 00 00       	mov    $0x0,%edi
+  80199d:	48 b8 2a 14 80 00 00 	movabs $0x80142a,%rax
+  8019a4:	00 00 00 
+  8019a7:	ff d0                	call   *%rax
+  8019a9:	85 c0                	test   %eax,%eax
+  8019ab:	75 7a                	jne    801a27 <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  8019ad:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8019b4:	00 00 00 
+  8019b7:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8019be:	44 89 e7             	mov    %r12d,%edi
+  8019c1:	48 b8 98 16 80 00 00 	movabs $0x801698,%rax
+  8019c8:	00 00 00 
+  8019cb:	ff d0                	call   *%rax
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	75 5e                	jne    801a2f <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  8019d1:	be 02 00 00 00       	mov    $0x2,%esi
+  8019d6:	44 89 e7             	mov    %r12d,%edi
+  8019d9:	48 b8 c6 15 80 00 00 	movabs $0x8015c6,%rax
+  8019e0:	00 00 00 
+  8019e3:	ff d0                	call   *%rax
+        return -1;
+  8019e5:	85 c0                	test   %eax,%eax
+  8019e7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8019ec:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  8019f0:	44 89 e0             	mov    %r12d,%eax
+  8019f3:	5b                   	pop    %rbx
+  8019f4:	41 5c                	pop    %r12
+  8019f6:	5d                   	pop    %rbp
+  8019f7:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  8019f8:	48 b8 03 13 80 00 00 	movabs $0x801303,%rax
+  8019ff:	00 00 00 
+  801a02:	ff d0                	call   *%rax
+  801a04:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  801a07:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  801a0e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801a15:	00 00 00 
+  801a18:	48 01 d0             	add    %rdx,%rax
+  801a1b:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  801a22:	00 00 00 
+        return 0;
+  801a25:	eb c9                	jmp    8019f0 <fork+0x8b>
+        return -1;
+  801a27:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801a2d:	eb c1                	jmp    8019f0 <fork+0x8b>
+        return -1;
+  801a2f:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801a35:	eb b9                	jmp    8019f0 <fork+0x8b>
+
+0000000000801a37 <sfork>:
+
+envid_t
+sfork() {
+  801a37:	55                   	push   %rbp
+  801a38:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801a3b:	48 ba 3d 35 80 00 00 	movabs $0x80353d,%rdx
+  801a42:	00 00 00 
+  801a45:	be 2e 00 00 00       	mov    $0x2e,%esi
+  801a4a:	48 bf 58 35 80 00 00 	movabs $0x803558,%rdi
+  801a51:	00 00 00 
+  801a54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a59:	48 b9 9e 03 80 00 00 	movabs $0x80039e,%rcx
+  801a60:	00 00 00 
+  801a63:	ff d1                	call   *%rcx
+
+0000000000801a65 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a65:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a6c:	ff ff ff 
+  801a6f:	48 01 f8             	add    %rdi,%rax
+  801a72:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a76:	c3                   	ret
+
+0000000000801a77 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a77:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a7e:	ff ff ff 
+  801a81:	48 01 f8             	add    %rdi,%rax
+  801a84:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a88:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801a8e:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801a92:	c3                   	ret
+
+0000000000801a93 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801a93:	55                   	push   %rbp
+  801a94:	48 89 e5             	mov    %rsp,%rbp
+  801a97:	41 57                	push   %r15
+  801a99:	41 56                	push   %r14
+  801a9b:	41 55                	push   %r13
+  801a9d:	41 54                	push   %r12
+  801a9f:	53                   	push   %rbx
+  801aa0:	48 83 ec 08          	sub    $0x8,%rsp
+  801aa4:	49 89 ff             	mov    %rdi,%r15
+  801aa7:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801aac:	49 bd 11 2a 80 00 00 	movabs $0x802a11,%r13
+  801ab3:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801ab6:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801abc:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801abf:	48 89 df             	mov    %rbx,%rdi
+  801ac2:	41 ff d5             	call   *%r13
+  801ac5:	83 e0 04             	and    $0x4,%eax
+  801ac8:	74 17                	je     801ae1 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801aca:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801ad1:	4c 39 f3             	cmp    %r14,%rbx
+  801ad4:	75 e6                	jne    801abc <fd_alloc+0x29>
+  801ad6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801adc:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801ae1:	4d 89 27             	mov    %r12,(%r15)
+}
+  801ae4:	48 83 c4 08          	add    $0x8,%rsp
+  801ae8:	5b                   	pop    %rbx
+  801ae9:	41 5c                	pop    %r12
+  801aeb:	41 5d                	pop    %r13
+  801aed:	41 5e                	pop    %r14
+  801aef:	41 5f                	pop    %r15
+  801af1:	5d                   	pop    %rbp
+  801af2:	c3                   	ret
+
+0000000000801af3 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801af3:	83 ff 1f             	cmp    $0x1f,%edi
+  801af6:	77 39                	ja     801b31 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801af8:	55                   	push   %rbp
+  801af9:	48 89 e5             	mov    %rsp,%rbp
+  801afc:	41 54                	push   %r12
+  801afe:	53                   	push   %rbx
+  801aff:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801b02:	48 63 df             	movslq %edi,%rbx
+  801b05:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801b0c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801b10:	48 89 df             	mov    %rbx,%rdi
+  801b13:	48 b8 11 2a 80 00 00 	movabs $0x802a11,%rax
+  801b1a:	00 00 00 
+  801b1d:	ff d0                	call   *%rax
+  801b1f:	a8 04                	test   $0x4,%al
+  801b21:	74 14                	je     801b37 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801b23:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801b27:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b2c:	5b                   	pop    %rbx
+  801b2d:	41 5c                	pop    %r12
+  801b2f:	5d                   	pop    %rbp
+  801b30:	c3                   	ret
+        return -E_INVAL;
+  801b31:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b36:	c3                   	ret
+        return -E_INVAL;
+  801b37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b3c:	eb ee                	jmp    801b2c <fd_lookup+0x39>
+
+0000000000801b3e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b3e:	55                   	push   %rbp
+  801b3f:	48 89 e5             	mov    %rsp,%rbp
+  801b42:	41 54                	push   %r12
+  801b44:	53                   	push   %rbx
+  801b45:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b48:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  801b4f:	00 00 00 
+  801b52:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801b59:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b5c:	39 3b                	cmp    %edi,(%rbx)
+  801b5e:	74 47                	je     801ba7 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b60:	48 83 c0 08          	add    $0x8,%rax
+  801b64:	48 8b 18             	mov    (%rax),%rbx
+  801b67:	48 85 db             	test   %rbx,%rbx
+  801b6a:	75 f0                	jne    801b5c <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b6c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b73:	00 00 00 
+  801b76:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b7c:	89 fa                	mov    %edi,%edx
+  801b7e:	48 bf 68 35 80 00 00 	movabs $0x803568,%rdi
+  801b85:	00 00 00 
+  801b88:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b8d:	48 b9 ee 04 80 00 00 	movabs $0x8004ee,%rcx
+  801b94:	00 00 00 
+  801b97:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b99:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b9e:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801ba2:	5b                   	pop    %rbx
+  801ba3:	41 5c                	pop    %r12
+  801ba5:	5d                   	pop    %rbp
+  801ba6:	c3                   	ret
+            return 0;
+  801ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bac:	eb f0                	jmp    801b9e <dev_lookup+0x60>
+
+0000000000801bae <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801bae:	55                   	push   %rbp
+  801baf:	48 89 e5             	mov    %rsp,%rbp
+  801bb2:	41 55                	push   %r13
+  801bb4:	41 54                	push   %r12
+  801bb6:	53                   	push   %rbx
+  801bb7:	48 83 ec 18          	sub    $0x18,%rsp
+  801bbb:	48 89 fb             	mov    %rdi,%rbx
+  801bbe:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801bc1:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801bc8:	ff ff ff 
+  801bcb:	48 01 df             	add    %rbx,%rdi
+  801bce:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801bd2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bd6:	48 b8 f3 1a 80 00 00 	movabs $0x801af3,%rax
+  801bdd:	00 00 00 
+  801be0:	ff d0                	call   *%rax
+  801be2:	41 89 c5             	mov    %eax,%r13d
+  801be5:	85 c0                	test   %eax,%eax
+  801be7:	78 06                	js     801bef <fd_close+0x41>
+  801be9:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801bed:	74 1a                	je     801c09 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801bef:	45 84 e4             	test   %r12b,%r12b
+  801bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf7:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801bfb:	44 89 e8             	mov    %r13d,%eax
+  801bfe:	48 83 c4 18          	add    $0x18,%rsp
+  801c02:	5b                   	pop    %rbx
+  801c03:	41 5c                	pop    %r12
+  801c05:	41 5d                	pop    %r13
+  801c07:	5d                   	pop    %rbp
+  801c08:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c09:	8b 3b                	mov    (%rbx),%edi
+  801c0b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c0f:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  801c16:	00 00 00 
+  801c19:	ff d0                	call   *%rax
+  801c1b:	41 89 c5             	mov    %eax,%r13d
+  801c1e:	85 c0                	test   %eax,%eax
+  801c20:	78 1b                	js     801c3d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801c22:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c26:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c2a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c30:	48 85 c0             	test   %rax,%rax
+  801c33:	74 08                	je     801c3d <fd_close+0x8f>
+  801c35:	48 89 df             	mov    %rbx,%rdi
+  801c38:	ff d0                	call   *%rax
+  801c3a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c3d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c42:	48 89 de             	mov    %rbx,%rsi
+  801c45:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c4a:	48 b8 8f 14 80 00 00 	movabs $0x80148f,%rax
+  801c51:	00 00 00 
+  801c54:	ff d0                	call   *%rax
+    return res;
+  801c56:	eb a3                	jmp    801bfb <fd_close+0x4d>
+
+0000000000801c58 <close>:
+
+int
+close(int fdnum) {
+  801c58:	55                   	push   %rbp
+  801c59:	48 89 e5             	mov    %rsp,%rbp
+  801c5c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c60:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c64:	48 b8 f3 1a 80 00 00 	movabs $0x801af3,%rax
+  801c6b:	00 00 00 
+  801c6e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c70:	85 c0                	test   %eax,%eax
+  801c72:	78 15                	js     801c89 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c74:	be 01 00 00 00       	mov    $0x1,%esi
+  801c79:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c7d:	48 b8 ae 1b 80 00 00 	movabs $0x801bae,%rax
+  801c84:	00 00 00 
+  801c87:	ff d0                	call   *%rax
+}
+  801c89:	c9                   	leave
+  801c8a:	c3                   	ret
+
+0000000000801c8b <close_all>:
+
+void
+close_all(void) {
+  801c8b:	55                   	push   %rbp
+  801c8c:	48 89 e5             	mov    %rsp,%rbp
+  801c8f:	41 54                	push   %r12
+  801c91:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c97:	49 bc 58 1c 80 00 00 	movabs $0x801c58,%r12
+  801c9e:	00 00 00 
+  801ca1:	89 df                	mov    %ebx,%edi
+  801ca3:	41 ff d4             	call   *%r12
+  801ca6:	83 c3 01             	add    $0x1,%ebx
+  801ca9:	83 fb 20             	cmp    $0x20,%ebx
+  801cac:	75 f3                	jne    801ca1 <close_all+0x16>
+}
+  801cae:	5b                   	pop    %rbx
+  801caf:	41 5c                	pop    %r12
+  801cb1:	5d                   	pop    %rbp
+  801cb2:	c3                   	ret
+
+0000000000801cb3 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801cb3:	55                   	push   %rbp
+  801cb4:	48 89 e5             	mov    %rsp,%rbp
+  801cb7:	41 57                	push   %r15
+  801cb9:	41 56                	push   %r14
+  801cbb:	41 55                	push   %r13
+  801cbd:	41 54                	push   %r12
+  801cbf:	53                   	push   %rbx
+  801cc0:	48 83 ec 18          	sub    $0x18,%rsp
+  801cc4:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801cc7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ccb:	48 b8 f3 1a 80 00 00 	movabs $0x801af3,%rax
+  801cd2:	00 00 00 
+  801cd5:	ff d0                	call   *%rax
+  801cd7:	89 c3                	mov    %eax,%ebx
+  801cd9:	85 c0                	test   %eax,%eax
+  801cdb:	0f 88 b8 00 00 00    	js     801d99 <dup+0xe6>
+    close(newfdnum);
+  801ce1:	44 89 e7             	mov    %r12d,%edi
+  801ce4:	48 b8 58 1c 80 00 00 	movabs $0x801c58,%rax
+  801ceb:	00 00 00 
+  801cee:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801cf0:	4d 63 ec             	movslq %r12d,%r13
+  801cf3:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801cfa:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801cfe:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801d02:	4c 89 ff             	mov    %r15,%rdi
+  801d05:	49 be 77 1a 80 00 00 	movabs $0x801a77,%r14
+  801d0c:	00 00 00 
+  801d0f:	41 ff d6             	call   *%r14
+  801d12:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801d15:	4c 89 ef             	mov    %r13,%rdi
+  801d18:	41 ff d6             	call   *%r14
+  801d1b:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801d1e:	48 89 df             	mov    %rbx,%rdi
+  801d21:	48 b8 11 2a 80 00 00 	movabs $0x802a11,%rax
+  801d28:	00 00 00 
+  801d2b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801d2d:	a8 04                	test   $0x4,%al
+  801d2f:	74 2b                	je     801d5c <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801d31:	41 89 c1             	mov    %eax,%r9d
+  801d34:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d3a:	4c 89 f1             	mov    %r14,%rcx
+  801d3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d42:	48 89 de             	mov    %rbx,%rsi
+  801d45:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d4a:	48 b8 2a 14 80 00 00 	movabs $0x80142a,%rax
+  801d51:	00 00 00 
+  801d54:	ff d0                	call   *%rax
+  801d56:	89 c3                	mov    %eax,%ebx
+  801d58:	85 c0                	test   %eax,%eax
+  801d5a:	78 4e                	js     801daa <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d5c:	4c 89 ff             	mov    %r15,%rdi
+  801d5f:	48 b8 11 2a 80 00 00 	movabs $0x802a11,%rax
+  801d66:	00 00 00 
+  801d69:	ff d0                	call   *%rax
+  801d6b:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d6e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d74:	4c 89 e9             	mov    %r13,%rcx
+  801d77:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d7c:	4c 89 fe             	mov    %r15,%rsi
+  801d7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d84:	48 b8 2a 14 80 00 00 	movabs $0x80142a,%rax
+  801d8b:	00 00 00 
+  801d8e:	ff d0                	call   *%rax
+  801d90:	89 c3                	mov    %eax,%ebx
+  801d92:	85 c0                	test   %eax,%eax
+  801d94:	78 14                	js     801daa <dup+0xf7>
+
+    return newfdnum;
+  801d96:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d99:	89 d8                	mov    %ebx,%eax
+  801d9b:	48 83 c4 18          	add    $0x18,%rsp
+  801d9f:	5b                   	pop    %rbx
+  801da0:	41 5c                	pop    %r12
+  801da2:	41 5d                	pop    %r13
+  801da4:	41 5e                	pop    %r14
+  801da6:	41 5f                	pop    %r15
+  801da8:	5d                   	pop    %rbp
+  801da9:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801daa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801daf:	4c 89 ee             	mov    %r13,%rsi
+  801db2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801db7:	49 bc 8f 14 80 00 00 	movabs $0x80148f,%r12
+  801dbe:	00 00 00 
+  801dc1:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801dc4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801dc9:	4c 89 f6             	mov    %r14,%rsi
+  801dcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dd1:	41 ff d4             	call   *%r12
+    return res;
+  801dd4:	eb c3                	jmp    801d99 <dup+0xe6>
+
+0000000000801dd6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801dd6:	55                   	push   %rbp
+  801dd7:	48 89 e5             	mov    %rsp,%rbp
+  801dda:	41 56                	push   %r14
+  801ddc:	41 55                	push   %r13
+  801dde:	41 54                	push   %r12
+  801de0:	53                   	push   %rbx
+  801de1:	48 83 ec 10          	sub    $0x10,%rsp
+  801de5:	89 fb                	mov    %edi,%ebx
+  801de7:	49 89 f4             	mov    %rsi,%r12
+  801dea:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ded:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801df1:	48 b8 f3 1a 80 00 00 	movabs $0x801af3,%rax
+  801df8:	00 00 00 
+  801dfb:	ff d0                	call   *%rax
+  801dfd:	85 c0                	test   %eax,%eax
+  801dff:	78 4c                	js     801e4d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e01:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e05:	41 8b 3e             	mov    (%r14),%edi
+  801e08:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e0c:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  801e13:	00 00 00 
+  801e16:	ff d0                	call   *%rax
+  801e18:	85 c0                	test   %eax,%eax
+  801e1a:	78 35                	js     801e51 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e1c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e20:	83 e0 03             	and    $0x3,%eax
+  801e23:	83 f8 01             	cmp    $0x1,%eax
+  801e26:	74 2d                	je     801e55 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e28:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e2c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e30:	48 85 c0             	test   %rax,%rax
+  801e33:	74 56                	je     801e8b <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801e35:	4c 89 ea             	mov    %r13,%rdx
+  801e38:	4c 89 e6             	mov    %r12,%rsi
+  801e3b:	4c 89 f7             	mov    %r14,%rdi
+  801e3e:	ff d0                	call   *%rax
+}
+  801e40:	48 83 c4 10          	add    $0x10,%rsp
+  801e44:	5b                   	pop    %rbx
+  801e45:	41 5c                	pop    %r12
+  801e47:	41 5d                	pop    %r13
+  801e49:	41 5e                	pop    %r14
+  801e4b:	5d                   	pop    %rbp
+  801e4c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e4d:	48 98                	cltq
+  801e4f:	eb ef                	jmp    801e40 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e51:	48 98                	cltq
+  801e53:	eb eb                	jmp    801e40 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e55:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e5c:	00 00 00 
+  801e5f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e65:	89 da                	mov    %ebx,%edx
+  801e67:	48 bf a9 35 80 00 00 	movabs $0x8035a9,%rdi
+  801e6e:	00 00 00 
+  801e71:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e76:	48 b9 ee 04 80 00 00 	movabs $0x8004ee,%rcx
+  801e7d:	00 00 00 
+  801e80:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e82:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e89:	eb b5                	jmp    801e40 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e8b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e92:	eb ac                	jmp    801e40 <read+0x6a>
+
+0000000000801e94 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e94:	55                   	push   %rbp
+  801e95:	48 89 e5             	mov    %rsp,%rbp
+  801e98:	41 57                	push   %r15
+  801e9a:	41 56                	push   %r14
+  801e9c:	41 55                	push   %r13
+  801e9e:	41 54                	push   %r12
+  801ea0:	53                   	push   %rbx
+  801ea1:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801ea5:	48 85 d2             	test   %rdx,%rdx
+  801ea8:	74 54                	je     801efe <readn+0x6a>
+  801eaa:	41 89 fd             	mov    %edi,%r13d
+  801ead:	49 89 f6             	mov    %rsi,%r14
+  801eb0:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801eb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801eb8:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ebd:	49 bf d6 1d 80 00 00 	movabs $0x801dd6,%r15
+  801ec4:	00 00 00 
+  801ec7:	4c 89 e2             	mov    %r12,%rdx
+  801eca:	48 29 f2             	sub    %rsi,%rdx
+  801ecd:	4c 01 f6             	add    %r14,%rsi
+  801ed0:	44 89 ef             	mov    %r13d,%edi
+  801ed3:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801ed6:	85 c0                	test   %eax,%eax
+  801ed8:	78 20                	js     801efa <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801eda:	01 c3                	add    %eax,%ebx
+  801edc:	85 c0                	test   %eax,%eax
+  801ede:	74 08                	je     801ee8 <readn+0x54>
+  801ee0:	48 63 f3             	movslq %ebx,%rsi
+  801ee3:	4c 39 e6             	cmp    %r12,%rsi
+  801ee6:	72 df                	jb     801ec7 <readn+0x33>
+    }
+    return res;
+  801ee8:	48 63 c3             	movslq %ebx,%rax
+}
+  801eeb:	48 83 c4 08          	add    $0x8,%rsp
+  801eef:	5b                   	pop    %rbx
+  801ef0:	41 5c                	pop    %r12
+  801ef2:	41 5d                	pop    %r13
+  801ef4:	41 5e                	pop    %r14
+  801ef6:	41 5f                	pop    %r15
+  801ef8:	5d                   	pop    %rbp
+  801ef9:	c3                   	ret
+        if (inc < 0) return inc;
+  801efa:	48 98                	cltq
+  801efc:	eb ed                	jmp    801eeb <readn+0x57>
+    int inc = 1, res = 0;
+  801efe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f03:	eb e3                	jmp    801ee8 <readn+0x54>
+
+0000000000801f05 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f05:	55                   	push   %rbp
+  801f06:	48 89 e5             	mov    %rsp,%rbp
+  801f09:	41 56                	push   %r14
+  801f0b:	41 55                	push   %r13
+  801f0d:	41 54                	push   %r12
+  801f0f:	53                   	push   %rbx
+  801f10:	48 83 ec 10          	sub    $0x10,%rsp
+  801f14:	89 fb                	mov    %edi,%ebx
+  801f16:	49 89 f4             	mov    %rsi,%r12
+  801f19:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f1c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f20:	48 b8 f3 1a 80 00 00 	movabs $0x801af3,%rax
+  801f27:	00 00 00 
+  801f2a:	ff d0                	call   *%rax
+  801f2c:	85 c0                	test   %eax,%eax
+  801f2e:	78 47                	js     801f77 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f30:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f34:	41 8b 3e             	mov    (%r14),%edi
+  801f37:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f3b:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  801f42:	00 00 00 
+  801f45:	ff d0                	call   *%rax
+  801f47:	85 c0                	test   %eax,%eax
+  801f49:	78 30                	js     801f7b <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f4b:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f50:	74 2d                	je     801f7f <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f56:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f5a:	48 85 c0             	test   %rax,%rax
+  801f5d:	74 56                	je     801fb5 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f5f:	4c 89 ea             	mov    %r13,%rdx
+  801f62:	4c 89 e6             	mov    %r12,%rsi
+  801f65:	4c 89 f7             	mov    %r14,%rdi
+  801f68:	ff d0                	call   *%rax
+}
+  801f6a:	48 83 c4 10          	add    $0x10,%rsp
+  801f6e:	5b                   	pop    %rbx
+  801f6f:	41 5c                	pop    %r12
+  801f71:	41 5d                	pop    %r13
+  801f73:	41 5e                	pop    %r14
+  801f75:	5d                   	pop    %rbp
+  801f76:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f77:	48 98                	cltq
+  801f79:	eb ef                	jmp    801f6a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f7b:	48 98                	cltq
+  801f7d:	eb eb                	jmp    801f6a <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f7f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f86:	00 00 00 
+  801f89:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f8f:	89 da                	mov    %ebx,%edx
+  801f91:	48 bf c5 35 80 00 00 	movabs $0x8035c5,%rdi
+  801f98:	00 00 00 
+  801f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa0:	48 b9 ee 04 80 00 00 	movabs $0x8004ee,%rcx
+  801fa7:	00 00 00 
+  801faa:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fac:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fb3:	eb b5                	jmp    801f6a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fb5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fbc:	eb ac                	jmp    801f6a <write+0x65>
+
+0000000000801fbe <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801fbe:	55                   	push   %rbp
+  801fbf:	48 89 e5             	mov    %rsp,%rbp
+  801fc2:	53                   	push   %rbx
+  801fc3:	48 83 ec 18          	sub    $0x18,%rsp
+  801fc7:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fc9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fcd:	48 b8 f3 1a 80 00 00 	movabs $0x801af3,%rax
+  801fd4:	00 00 00 
+  801fd7:	ff d0                	call   *%rax
+  801fd9:	85 c0                	test   %eax,%eax
+  801fdb:	78 0c                	js     801fe9 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801fdd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fe1:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801fe4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fe9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fed:	c9                   	leave
+  801fee:	c3                   	ret
+
+0000000000801fef <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801fef:	55                   	push   %rbp
+  801ff0:	48 89 e5             	mov    %rsp,%rbp
+  801ff3:	41 55                	push   %r13
+  801ff5:	41 54                	push   %r12
+  801ff7:	53                   	push   %rbx
+  801ff8:	48 83 ec 18          	sub    $0x18,%rsp
+  801ffc:	89 fb                	mov    %edi,%ebx
+  801ffe:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802001:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802005:	48 b8 f3 1a 80 00 00 	movabs $0x801af3,%rax
+  80200c:	00 00 00 
+  80200f:	ff d0                	call   *%rax
+  802011:	85 c0                	test   %eax,%eax
+  802013:	78 38                	js     80204d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802015:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802019:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80201d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802021:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  802028:	00 00 00 
+  80202b:	ff d0                	call   *%rax
+  80202d:	85 c0                	test   %eax,%eax
+  80202f:	78 1c                	js     80204d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802031:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802036:	74 20                	je     802058 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802038:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80203c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802040:	48 85 c0             	test   %rax,%rax
+  802043:	74 47                	je     80208c <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802045:	44 89 e6             	mov    %r12d,%esi
+  802048:	4c 89 ef             	mov    %r13,%rdi
+  80204b:	ff d0                	call   *%rax
+}
+  80204d:	48 83 c4 18          	add    $0x18,%rsp
+  802051:	5b                   	pop    %rbx
+  802052:	41 5c                	pop    %r12
+  802054:	41 5d                	pop    %r13
+  802056:	5d                   	pop    %rbp
+  802057:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802058:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80205f:	00 00 00 
+  802062:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802068:	89 da                	mov    %ebx,%edx
+  80206a:	48 bf 88 35 80 00 00 	movabs $0x803588,%rdi
+  802071:	00 00 00 
+  802074:	b8 00 00 00 00       	mov    $0x0,%eax
+  802079:	48 b9 ee 04 80 00 00 	movabs $0x8004ee,%rcx
+  802080:	00 00 00 
+  802083:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802085:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80208a:	eb c1                	jmp    80204d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80208c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802091:	eb ba                	jmp    80204d <ftruncate+0x5e>
+
+0000000000802093 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802093:	55                   	push   %rbp
+  802094:	48 89 e5             	mov    %rsp,%rbp
+  802097:	41 54                	push   %r12
+  802099:	53                   	push   %rbx
+  80209a:	48 83 ec 10          	sub    $0x10,%rsp
+  80209e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020a1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020a5:	48 b8 f3 1a 80 00 00 	movabs $0x801af3,%rax
+  8020ac:	00 00 00 
+  8020af:	ff d0                	call   *%rax
+  8020b1:	85 c0                	test   %eax,%eax
+  8020b3:	78 4e                	js     802103 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020b5:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8020b9:	41 8b 3c 24          	mov    (%r12),%edi
+  8020bd:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020c1:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  8020c8:	00 00 00 
+  8020cb:	ff d0                	call   *%rax
+  8020cd:	85 c0                	test   %eax,%eax
+  8020cf:	78 32                	js     802103 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020d5:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8020da:	74 30                	je     80210c <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8020dc:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8020df:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8020e6:	00 00 00 
+    stat->st_isdir = 0;
+  8020e9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020f0:	00 00 00 
+    stat->st_dev = dev;
+  8020f3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8020fa:	48 89 de             	mov    %rbx,%rsi
+  8020fd:	4c 89 e7             	mov    %r12,%rdi
+  802100:	ff 50 28             	call   *0x28(%rax)
+}
+  802103:	48 83 c4 10          	add    $0x10,%rsp
+  802107:	5b                   	pop    %rbx
+  802108:	41 5c                	pop    %r12
+  80210a:	5d                   	pop    %rbp
+  80210b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80210c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802111:	eb f0                	jmp    802103 <fstat+0x70>
+
+0000000000802113 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802113:	55                   	push   %rbp
+  802114:	48 89 e5             	mov    %rsp,%rbp
+  802117:	41 54                	push   %r12
+  802119:	53                   	push   %rbx
+  80211a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80211d:	be 00 00 00 00       	mov    $0x0,%esi
+  802122:	48 b8 94 23 80 00 00 	movabs $0x802394,%rax
+  802129:	00 00 00 
+  80212c:	ff d0                	call   *%rax
+  80212e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802130:	85 c0                	test   %eax,%eax
+  802132:	78 25                	js     802159 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802134:	4c 89 e6             	mov    %r12,%rsi
+  802137:	89 c7                	mov    %eax,%edi
+  802139:	48 b8 93 20 80 00 00 	movabs $0x802093,%rax
+  802140:	00 00 00 
+  802143:	ff d0                	call   *%rax
+  802145:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802148:	89 df                	mov    %ebx,%edi
+  80214a:	48 b8 58 1c 80 00 00 	movabs $0x801c58,%rax
+  802151:	00 00 00 
+  802154:	ff d0                	call   *%rax
+
+    return res;
+  802156:	44 89 e3             	mov    %r12d,%ebx
+}
+  802159:	89 d8                	mov    %ebx,%eax
+  80215b:	5b                   	pop    %rbx
+  80215c:	41 5c                	pop    %r12
+  80215e:	5d                   	pop    %rbp
+  80215f:	c3                   	ret
+
+0000000000802160 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802160:	55                   	push   %rbp
+  802161:	48 89 e5             	mov    %rsp,%rbp
+  802164:	41 54                	push   %r12
+  802166:	53                   	push   %rbx
+  802167:	48 83 ec 10          	sub    $0x10,%rsp
+  80216b:	41 89 fc             	mov    %edi,%r12d
+  80216e:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802171:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802178:	00 00 00 
+  80217b:	83 38 00             	cmpl   $0x0,(%rax)
+  80217e:	74 5e                	je     8021de <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802180:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802186:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80218b:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802192:	00 00 00 
+  802195:	44 89 e6             	mov    %r12d,%esi
+  802198:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80219f:	00 00 00 
+  8021a2:	8b 38                	mov    (%rax),%edi
+  8021a4:	48 b8 cd 2d 80 00 00 	movabs $0x802dcd,%rax
+  8021ab:	00 00 00 
+  8021ae:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8021b0:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8021b7:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8021b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021bd:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8021c1:	48 89 de             	mov    %rbx,%rsi
+  8021c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021c9:	48 b8 38 2d 80 00 00 	movabs $0x802d38,%rax
+  8021d0:	00 00 00 
+  8021d3:	ff d0                	call   *%rax
+}
+  8021d5:	48 83 c4 10          	add    $0x10,%rsp
+  8021d9:	5b                   	pop    %rbx
+  8021da:	41 5c                	pop    %r12
+  8021dc:	5d                   	pop    %rbp
+  8021dd:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021de:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021e3:	48 b8 6d 2e 80 00 00 	movabs $0x802e6d,%rax
+  8021ea:	00 00 00 
+  8021ed:	ff d0                	call   *%rax
+  8021ef:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8021f6:	00 00 
+  8021f8:	eb 86                	jmp    802180 <fsipc+0x20>
+
+00000000008021fa <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8021fa:	55                   	push   %rbp
+  8021fb:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8021fe:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802205:	00 00 00 
+  802208:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80220b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80220d:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802210:	be 00 00 00 00       	mov    $0x0,%esi
+  802215:	bf 02 00 00 00       	mov    $0x2,%edi
+  80221a:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  802221:	00 00 00 
+  802224:	ff d0                	call   *%rax
+}
+  802226:	5d                   	pop    %rbp
+  802227:	c3                   	ret
+
+0000000000802228 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802228:	55                   	push   %rbp
+  802229:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80222c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80222f:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802236:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802238:	be 00 00 00 00       	mov    $0x0,%esi
+  80223d:	bf 06 00 00 00       	mov    $0x6,%edi
+  802242:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  802249:	00 00 00 
+  80224c:	ff d0                	call   *%rax
+}
+  80224e:	5d                   	pop    %rbp
+  80224f:	c3                   	ret
+
+0000000000802250 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802250:	55                   	push   %rbp
+  802251:	48 89 e5             	mov    %rsp,%rbp
+  802254:	41 54                	push   %r12
+  802256:	53                   	push   %rbx
+  802257:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80225a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80225d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802264:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802266:	be 00 00 00 00       	mov    $0x0,%esi
+  80226b:	bf 05 00 00 00       	mov    $0x5,%edi
+  802270:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  802277:	00 00 00 
+  80227a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80227c:	85 c0                	test   %eax,%eax
+  80227e:	78 3d                	js     8022bd <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802280:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802287:	00 00 00 
+  80228a:	4c 89 e6             	mov    %r12,%rsi
+  80228d:	48 89 df             	mov    %rbx,%rdi
+  802290:	48 b8 13 0e 80 00 00 	movabs $0x800e13,%rax
+  802297:	00 00 00 
+  80229a:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80229c:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8022a3:	00 
+  8022a4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8022aa:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8022b1:	00 
+  8022b2:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8022b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022bd:	5b                   	pop    %rbx
+  8022be:	41 5c                	pop    %r12
+  8022c0:	5d                   	pop    %rbp
+  8022c1:	c3                   	ret
+
+00000000008022c2 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8022c2:	55                   	push   %rbp
+  8022c3:	48 89 e5             	mov    %rsp,%rbp
+  8022c6:	41 54                	push   %r12
+  8022c8:	53                   	push   %rbx
+  8022c9:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  8022cc:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8022d1:	48 39 c2             	cmp    %rax,%rdx
+  8022d4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8022d8:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8022db:	48 89 c2             	mov    %rax,%rdx
+  8022de:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8022e5:	00 00 00 
+  8022e8:	48 b8 74 10 80 00 00 	movabs $0x801074,%rax
+  8022ef:	00 00 00 
+  8022f2:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022f4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022fb:	00 00 00 
+  8022fe:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802303:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802305:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  802309:	be 00 00 00 00       	mov    $0x0,%esi
+  80230e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802313:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  80231a:	00 00 00 
+  80231d:	ff d0                	call   *%rax
+  80231f:	48 98                	cltq
+}
+  802321:	5b                   	pop    %rbx
+  802322:	41 5c                	pop    %r12
+  802324:	5d                   	pop    %rbp
+  802325:	c3                   	ret
+
+0000000000802326 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802326:	55                   	push   %rbp
+  802327:	48 89 e5             	mov    %rsp,%rbp
+  80232a:	41 54                	push   %r12
+  80232c:	53                   	push   %rbx
+  80232d:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802330:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802337:	00 00 00 
+  80233a:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80233d:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  80233f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802344:	48 39 ca             	cmp    %rcx,%rdx
+  802347:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  80234b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  80234f:	be 00 00 00 00       	mov    $0x0,%esi
+  802354:	bf 03 00 00 00       	mov    $0x3,%edi
+  802359:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  802360:	00 00 00 
+  802363:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802365:	85 c0                	test   %eax,%eax
+  802367:	78 27                	js     802390 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  802369:	48 63 d8             	movslq %eax,%rbx
+  80236c:	48 89 da             	mov    %rbx,%rdx
+  80236f:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802376:	00 00 00 
+  802379:	4c 89 e7             	mov    %r12,%rdi
+  80237c:	48 b8 74 10 80 00 00 	movabs $0x801074,%rax
+  802383:	00 00 00 
+  802386:	ff d0                	call   *%rax
+    return bytes_read;
+  802388:	48 89 d8             	mov    %rbx,%rax
+}
+  80238b:	5b                   	pop    %rbx
+  80238c:	41 5c                	pop    %r12
+  80238e:	5d                   	pop    %rbp
+  80238f:	c3                   	ret
+        return bytes_read;
+  802390:	48 98                	cltq
+  802392:	eb f7                	jmp    80238b <devfile_read+0x65>
+
+0000000000802394 <open>:
+open(const char *path, int mode) {
+  802394:	55                   	push   %rbp
+  802395:	48 89 e5             	mov    %rsp,%rbp
+  802398:	41 55                	push   %r13
+  80239a:	41 54                	push   %r12
+  80239c:	53                   	push   %rbx
+  80239d:	48 83 ec 18          	sub    $0x18,%rsp
+  8023a1:	49 89 fc             	mov    %rdi,%r12
+  8023a4:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8023a7:	48 b8 d5 0d 80 00 00 	movabs $0x800dd5,%rax
+  8023ae:	00 00 00 
+  8023b1:	ff d0                	call   *%rax
+  8023b3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8023b9:	0f 87 8a 00 00 00    	ja     802449 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8023bf:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8023c3:	48 b8 93 1a 80 00 00 	movabs $0x801a93,%rax
+  8023ca:	00 00 00 
+  8023cd:	ff d0                	call   *%rax
+  8023cf:	89 c3                	mov    %eax,%ebx
+  8023d1:	85 c0                	test   %eax,%eax
+  8023d3:	78 50                	js     802425 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8023d5:	4c 89 e6             	mov    %r12,%rsi
+  8023d8:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8023df:	00 00 00 
+  8023e2:	48 89 df             	mov    %rbx,%rdi
+  8023e5:	48 b8 13 0e 80 00 00 	movabs $0x800e13,%rax
+  8023ec:	00 00 00 
+  8023ef:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8023f1:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8023f8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8023fc:	bf 01 00 00 00       	mov    $0x1,%edi
+  802401:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  802408:	00 00 00 
+  80240b:	ff d0                	call   *%rax
+  80240d:	89 c3                	mov    %eax,%ebx
+  80240f:	85 c0                	test   %eax,%eax
+  802411:	78 1f                	js     802432 <open+0x9e>
+    return fd2num(fd);
+  802413:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802417:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  80241e:	00 00 00 
+  802421:	ff d0                	call   *%rax
+  802423:	89 c3                	mov    %eax,%ebx
+}
+  802425:	89 d8                	mov    %ebx,%eax
+  802427:	48 83 c4 18          	add    $0x18,%rsp
+  80242b:	5b                   	pop    %rbx
+  80242c:	41 5c                	pop    %r12
+  80242e:	41 5d                	pop    %r13
+  802430:	5d                   	pop    %rbp
+  802431:	c3                   	ret
+        fd_close(fd, 0);
+  802432:	be 00 00 00 00       	mov    $0x0,%esi
+  802437:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80243b:	48 b8 ae 1b 80 00 00 	movabs $0x801bae,%rax
+  802442:	00 00 00 
+  802445:	ff d0                	call   *%rax
+        return res;
+  802447:	eb dc                	jmp    802425 <open+0x91>
+        return -E_BAD_PATH;
+  802449:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80244e:	eb d5                	jmp    802425 <open+0x91>
+
+0000000000802450 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802450:	55                   	push   %rbp
+  802451:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802454:	be 00 00 00 00       	mov    $0x0,%esi
+  802459:	bf 08 00 00 00       	mov    $0x8,%edi
+  80245e:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  802465:	00 00 00 
+  802468:	ff d0                	call   *%rax
+}
+  80246a:	5d                   	pop    %rbp
+  80246b:	c3                   	ret
+
+000000000080246c <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80246c:	55                   	push   %rbp
+  80246d:	48 89 e5             	mov    %rsp,%rbp
+  802470:	41 54                	push   %r12
+  802472:	53                   	push   %rbx
+  802473:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802476:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  80247d:	00 00 00 
+  802480:	ff d0                	call   *%rax
+  802482:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802485:	48 be 20 36 80 00 00 	movabs $0x803620,%rsi
+  80248c:	00 00 00 
+  80248f:	48 89 df             	mov    %rbx,%rdi
+  802492:	48 b8 13 0e 80 00 00 	movabs $0x800e13,%rax
+  802499:	00 00 00 
+  80249c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80249e:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8024a3:	41 2b 04 24          	sub    (%r12),%eax
+  8024a7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8024ad:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8024b4:	00 00 00 
+    stat->st_dev = &devpipe;
+  8024b7:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8024be:	00 00 00 
+  8024c1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8024c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024cd:	5b                   	pop    %rbx
+  8024ce:	41 5c                	pop    %r12
+  8024d0:	5d                   	pop    %rbp
+  8024d1:	c3                   	ret
+
+00000000008024d2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8024d2:	55                   	push   %rbp
+  8024d3:	48 89 e5             	mov    %rsp,%rbp
+  8024d6:	41 54                	push   %r12
+  8024d8:	53                   	push   %rbx
+  8024d9:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8024dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024e1:	48 89 fe             	mov    %rdi,%rsi
+  8024e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024e9:	49 bc 8f 14 80 00 00 	movabs $0x80148f,%r12
+  8024f0:	00 00 00 
+  8024f3:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8024f6:	48 89 df             	mov    %rbx,%rdi
+  8024f9:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  802500:	00 00 00 
+  802503:	ff d0                	call   *%rax
+  802505:	48 89 c6             	mov    %rax,%rsi
+  802508:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80250d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802512:	41 ff d4             	call   *%r12
+}
+  802515:	5b                   	pop    %rbx
+  802516:	41 5c                	pop    %r12
+  802518:	5d                   	pop    %rbp
+  802519:	c3                   	ret
+
+000000000080251a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80251a:	55                   	push   %rbp
+  80251b:	48 89 e5             	mov    %rsp,%rbp
+  80251e:	41 57                	push   %r15
+  802520:	41 56                	push   %r14
+  802522:	41 55                	push   %r13
+  802524:	41 54                	push   %r12
+  802526:	53                   	push   %rbx
+  802527:	48 83 ec 18          	sub    $0x18,%rsp
+  80252b:	49 89 fc             	mov    %rdi,%r12
+  80252e:	49 89 f5             	mov    %rsi,%r13
+  802531:	49 89 d7             	mov    %rdx,%r15
+  802534:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802538:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  80253f:	00 00 00 
+  802542:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802544:	4d 85 ff             	test   %r15,%r15
+  802547:	0f 84 af 00 00 00    	je     8025fc <devpipe_write+0xe2>
+  80254d:	48 89 c3             	mov    %rax,%rbx
+  802550:	4c 89 f8             	mov    %r15,%rax
+  802553:	4d 89 ef             	mov    %r13,%r15
+  802556:	4c 01 e8             	add    %r13,%rax
+  802559:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80255d:	49 bd 97 13 80 00 00 	movabs $0x801397,%r13
+  802564:	00 00 00 
+            sys_yield();
+  802567:	49 be 34 13 80 00 00 	movabs $0x801334,%r14
+  80256e:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802571:	8b 73 04             	mov    0x4(%rbx),%esi
+  802574:	48 63 ce             	movslq %esi,%rcx
+  802577:	48 63 03             	movslq (%rbx),%rax
+  80257a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802580:	48 39 c1             	cmp    %rax,%rcx
+  802583:	72 2e                	jb     8025b3 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802585:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80258a:	48 89 da             	mov    %rbx,%rdx
+  80258d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802592:	4c 89 e7             	mov    %r12,%rdi
+  802595:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802598:	85 c0                	test   %eax,%eax
+  80259a:	74 66                	je     802602 <devpipe_write+0xe8>
+            sys_yield();
+  80259c:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80259f:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025a2:	48 63 ce             	movslq %esi,%rcx
+  8025a5:	48 63 03             	movslq (%rbx),%rax
+  8025a8:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025ae:	48 39 c1             	cmp    %rax,%rcx
+  8025b1:	73 d2                	jae    802585 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025b3:	41 0f b6 3f          	movzbl (%r15),%edi
+  8025b7:	48 89 ca             	mov    %rcx,%rdx
+  8025ba:	48 c1 ea 03          	shr    $0x3,%rdx
+  8025be:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8025c5:	08 10 20 
+  8025c8:	48 f7 e2             	mul    %rdx
+  8025cb:	48 c1 ea 06          	shr    $0x6,%rdx
+  8025cf:	48 89 d0             	mov    %rdx,%rax
+  8025d2:	48 c1 e0 09          	shl    $0x9,%rax
+  8025d6:	48 29 d0             	sub    %rdx,%rax
+  8025d9:	48 c1 e0 03          	shl    $0x3,%rax
+  8025dd:	48 29 c1             	sub    %rax,%rcx
+  8025e0:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8025e5:	83 c6 01             	add    $0x1,%esi
+  8025e8:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8025eb:	49 83 c7 01          	add    $0x1,%r15
+  8025ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025f3:	49 39 c7             	cmp    %rax,%r15
+  8025f6:	0f 85 75 ff ff ff    	jne    802571 <devpipe_write+0x57>
+    return n;
+  8025fc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802600:	eb 05                	jmp    802607 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802602:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802607:	48 83 c4 18          	add    $0x18,%rsp
+  80260b:	5b                   	pop    %rbx
+  80260c:	41 5c                	pop    %r12
+  80260e:	41 5d                	pop    %r13
+  802610:	41 5e                	pop    %r14
+  802612:	41 5f                	pop    %r15
+  802614:	5d                   	pop    %rbp
+  802615:	c3                   	ret
+
+0000000000802616 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802616:	55                   	push   %rbp
+  802617:	48 89 e5             	mov    %rsp,%rbp
+  80261a:	41 57                	push   %r15
+  80261c:	41 56                	push   %r14
+  80261e:	41 55                	push   %r13
+  802620:	41 54                	push   %r12
+  802622:	53                   	push   %rbx
+  802623:	48 83 ec 18          	sub    $0x18,%rsp
+  802627:	49 89 fc             	mov    %rdi,%r12
+  80262a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80262e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802632:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  802639:	00 00 00 
+  80263c:	ff d0                	call   *%rax
+  80263e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802641:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802647:	49 bd 97 13 80 00 00 	movabs $0x801397,%r13
+  80264e:	00 00 00 
+            sys_yield();
+  802651:	49 be 34 13 80 00 00 	movabs $0x801334,%r14
+  802658:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80265b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802660:	74 7d                	je     8026df <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802662:	8b 03                	mov    (%rbx),%eax
+  802664:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802667:	75 26                	jne    80268f <devpipe_read+0x79>
+            if (i > 0) return i;
+  802669:	4d 85 ff             	test   %r15,%r15
+  80266c:	75 77                	jne    8026e5 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80266e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802673:	48 89 da             	mov    %rbx,%rdx
+  802676:	be 00 10 00 00       	mov    $0x1000,%esi
+  80267b:	4c 89 e7             	mov    %r12,%rdi
+  80267e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802681:	85 c0                	test   %eax,%eax
+  802683:	74 72                	je     8026f7 <devpipe_read+0xe1>
+            sys_yield();
+  802685:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802688:	8b 03                	mov    (%rbx),%eax
+  80268a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80268d:	74 df                	je     80266e <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80268f:	48 63 c8             	movslq %eax,%rcx
+  802692:	48 89 ca             	mov    %rcx,%rdx
+  802695:	48 c1 ea 03          	shr    $0x3,%rdx
+  802699:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8026a0:	08 10 20 
+  8026a3:	48 89 d0             	mov    %rdx,%rax
+  8026a6:	48 f7 e6             	mul    %rsi
+  8026a9:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026ad:	48 89 d0             	mov    %rdx,%rax
+  8026b0:	48 c1 e0 09          	shl    $0x9,%rax
+  8026b4:	48 29 d0             	sub    %rdx,%rax
+  8026b7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8026be:	00 
+  8026bf:	48 89 c8             	mov    %rcx,%rax
+  8026c2:	48 29 d0             	sub    %rdx,%rax
+  8026c5:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8026ca:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8026ce:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8026d2:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8026d5:	49 83 c7 01          	add    $0x1,%r15
+  8026d9:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8026dd:	75 83                	jne    802662 <devpipe_read+0x4c>
+    return n;
+  8026df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026e3:	eb 03                	jmp    8026e8 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8026e5:	4c 89 f8             	mov    %r15,%rax
+}
+  8026e8:	48 83 c4 18          	add    $0x18,%rsp
+  8026ec:	5b                   	pop    %rbx
+  8026ed:	41 5c                	pop    %r12
+  8026ef:	41 5d                	pop    %r13
+  8026f1:	41 5e                	pop    %r14
+  8026f3:	41 5f                	pop    %r15
+  8026f5:	5d                   	pop    %rbp
+  8026f6:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8026f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026fc:	eb ea                	jmp    8026e8 <devpipe_read+0xd2>
+
+00000000008026fe <pipe>:
+pipe(int pfd[2]) {
+  8026fe:	55                   	push   %rbp
+  8026ff:	48 89 e5             	mov    %rsp,%rbp
+  802702:	41 55                	push   %r13
+  802704:	41 54                	push   %r12
+  802706:	53                   	push   %rbx
+  802707:	48 83 ec 18          	sub    $0x18,%rsp
+  80270b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80270e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802712:	48 b8 93 1a 80 00 00 	movabs $0x801a93,%rax
+  802719:	00 00 00 
+  80271c:	ff d0                	call   *%rax
+  80271e:	89 c3                	mov    %eax,%ebx
+  802720:	85 c0                	test   %eax,%eax
+  802722:	0f 88 a0 01 00 00    	js     8028c8 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802728:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80272d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802732:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802736:	bf 00 00 00 00       	mov    $0x0,%edi
+  80273b:	48 b8 c3 13 80 00 00 	movabs $0x8013c3,%rax
+  802742:	00 00 00 
+  802745:	ff d0                	call   *%rax
+  802747:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802749:	85 c0                	test   %eax,%eax
+  80274b:	0f 88 77 01 00 00    	js     8028c8 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802751:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802755:	48 b8 93 1a 80 00 00 	movabs $0x801a93,%rax
+  80275c:	00 00 00 
+  80275f:	ff d0                	call   *%rax
+  802761:	89 c3                	mov    %eax,%ebx
+  802763:	85 c0                	test   %eax,%eax
+  802765:	0f 88 43 01 00 00    	js     8028ae <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80276b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802770:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802775:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802779:	bf 00 00 00 00       	mov    $0x0,%edi
+  80277e:	48 b8 c3 13 80 00 00 	movabs $0x8013c3,%rax
+  802785:	00 00 00 
+  802788:	ff d0                	call   *%rax
+  80278a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80278c:	85 c0                	test   %eax,%eax
+  80278e:	0f 88 1a 01 00 00    	js     8028ae <pipe+0x1b0>
+    va = fd2data(fd0);
+  802794:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802798:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  80279f:	00 00 00 
+  8027a2:	ff d0                	call   *%rax
+  8027a4:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8027a7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027b1:	48 89 c6             	mov    %rax,%rsi
+  8027b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027b9:	48 b8 c3 13 80 00 00 	movabs $0x8013c3,%rax
+  8027c0:	00 00 00 
+  8027c3:	ff d0                	call   *%rax
+  8027c5:	89 c3                	mov    %eax,%ebx
+  8027c7:	85 c0                	test   %eax,%eax
+  8027c9:	0f 88 c5 00 00 00    	js     802894 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8027cf:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8027d3:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  8027da:	00 00 00 
+  8027dd:	ff d0                	call   *%rax
+  8027df:	48 89 c1             	mov    %rax,%rcx
+  8027e2:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8027e8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8027ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f3:	4c 89 ee             	mov    %r13,%rsi
+  8027f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027fb:	48 b8 2a 14 80 00 00 	movabs $0x80142a,%rax
+  802802:	00 00 00 
+  802805:	ff d0                	call   *%rax
+  802807:	89 c3                	mov    %eax,%ebx
+  802809:	85 c0                	test   %eax,%eax
+  80280b:	78 6e                	js     80287b <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80280d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802812:	4c 89 ef             	mov    %r13,%rdi
+  802815:	48 b8 65 13 80 00 00 	movabs $0x801365,%rax
+  80281c:	00 00 00 
+  80281f:	ff d0                	call   *%rax
+  802821:	83 f8 02             	cmp    $0x2,%eax
+  802824:	0f 85 ab 00 00 00    	jne    8028d5 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80282a:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802831:	00 00 
+  802833:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802837:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802839:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80283d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802844:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802848:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80284a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80284e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802855:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802859:	48 bb 65 1a 80 00 00 	movabs $0x801a65,%rbx
+  802860:	00 00 00 
+  802863:	ff d3                	call   *%rbx
+  802865:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802869:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80286d:	ff d3                	call   *%rbx
+  80286f:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802874:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802879:	eb 4d                	jmp    8028c8 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80287b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802880:	4c 89 ee             	mov    %r13,%rsi
+  802883:	bf 00 00 00 00       	mov    $0x0,%edi
+  802888:	48 b8 8f 14 80 00 00 	movabs $0x80148f,%rax
+  80288f:	00 00 00 
+  802892:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802894:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802899:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80289d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028a2:	48 b8 8f 14 80 00 00 	movabs $0x80148f,%rax
+  8028a9:	00 00 00 
+  8028ac:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8028ae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028b3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8028b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028bc:	48 b8 8f 14 80 00 00 	movabs $0x80148f,%rax
+  8028c3:	00 00 00 
+  8028c6:	ff d0                	call   *%rax
+}
+  8028c8:	89 d8                	mov    %ebx,%eax
+  8028ca:	48 83 c4 18          	add    $0x18,%rsp
+  8028ce:	5b                   	pop    %rbx
+  8028cf:	41 5c                	pop    %r12
+  8028d1:	41 5d                	pop    %r13
+  8028d3:	5d                   	pop    %rbp
+  8028d4:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028d5:	48 b9 50 36 80 00 00 	movabs $0x803650,%rcx
+  8028dc:	00 00 00 
+  8028df:	48 ba 27 36 80 00 00 	movabs $0x803627,%rdx
+  8028e6:	00 00 00 
+  8028e9:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8028ee:	48 bf 3c 36 80 00 00 	movabs $0x80363c,%rdi
+  8028f5:	00 00 00 
+  8028f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028fd:	49 b8 9e 03 80 00 00 	movabs $0x80039e,%r8
+  802904:	00 00 00 
+  802907:	41 ff d0             	call   *%r8
+
+000000000080290a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80290a:	55                   	push   %rbp
+  80290b:	48 89 e5             	mov    %rsp,%rbp
+  80290e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802912:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802916:	48 b8 f3 1a 80 00 00 	movabs $0x801af3,%rax
+  80291d:	00 00 00 
+  802920:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802922:	85 c0                	test   %eax,%eax
+  802924:	78 35                	js     80295b <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802926:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80292a:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  802931:	00 00 00 
+  802934:	ff d0                	call   *%rax
+  802936:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802939:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80293e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802943:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802947:	48 b8 97 13 80 00 00 	movabs $0x801397,%rax
+  80294e:	00 00 00 
+  802951:	ff d0                	call   *%rax
+  802953:	85 c0                	test   %eax,%eax
+  802955:	0f 94 c0             	sete   %al
+  802958:	0f b6 c0             	movzbl %al,%eax
+}
+  80295b:	c9                   	leave
+  80295c:	c3                   	ret
+
+000000000080295d <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80295d:	48 89 f8             	mov    %rdi,%rax
+  802960:	48 c1 e8 27          	shr    $0x27,%rax
+  802964:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80296b:	01 00 00 
+  80296e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802972:	f6 c2 01             	test   $0x1,%dl
+  802975:	74 6d                	je     8029e4 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802977:	48 89 f8             	mov    %rdi,%rax
+  80297a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80297e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802985:	01 00 00 
+  802988:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80298c:	f6 c2 01             	test   $0x1,%dl
+  80298f:	74 62                	je     8029f3 <get_uvpt_entry+0x96>
+  802991:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802998:	01 00 00 
+  80299b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80299f:	f6 c2 80             	test   $0x80,%dl
+  8029a2:	75 4f                	jne    8029f3 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8029a4:	48 89 f8             	mov    %rdi,%rax
+  8029a7:	48 c1 e8 15          	shr    $0x15,%rax
+  8029ab:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8029b2:	01 00 00 
+  8029b5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029b9:	f6 c2 01             	test   $0x1,%dl
+  8029bc:	74 44                	je     802a02 <get_uvpt_entry+0xa5>
+  8029be:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8029c5:	01 00 00 
+  8029c8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029cc:	f6 c2 80             	test   $0x80,%dl
+  8029cf:	75 31                	jne    802a02 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8029d1:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8029d5:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8029dc:	01 00 00 
+  8029df:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8029e3:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029e4:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8029eb:	01 00 00 
+  8029ee:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029f2:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029f3:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8029fa:	01 00 00 
+  8029fd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a01:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a02:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a09:	01 00 00 
+  802a0c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a10:	c3                   	ret
+
+0000000000802a11 <get_prot>:
+
+int
+get_prot(void *va) {
+  802a11:	55                   	push   %rbp
+  802a12:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a15:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  802a1c:	00 00 00 
+  802a1f:	ff d0                	call   *%rax
+  802a21:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802a24:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802a29:	89 c1                	mov    %eax,%ecx
+  802a2b:	83 c9 04             	or     $0x4,%ecx
+  802a2e:	f6 c2 01             	test   $0x1,%dl
+  802a31:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802a34:	89 c1                	mov    %eax,%ecx
+  802a36:	83 c9 02             	or     $0x2,%ecx
+  802a39:	f6 c2 02             	test   $0x2,%dl
+  802a3c:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802a3f:	89 c1                	mov    %eax,%ecx
+  802a41:	83 c9 01             	or     $0x1,%ecx
+  802a44:	48 85 d2             	test   %rdx,%rdx
+  802a47:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802a4a:	89 c1                	mov    %eax,%ecx
+  802a4c:	83 c9 40             	or     $0x40,%ecx
+  802a4f:	f6 c6 04             	test   $0x4,%dh
+  802a52:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802a55:	5d                   	pop    %rbp
+  802a56:	c3                   	ret
+
+0000000000802a57 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802a57:	55                   	push   %rbp
+  802a58:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a5b:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  802a62:	00 00 00 
+  802a65:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802a67:	48 c1 e8 06          	shr    $0x6,%rax
+  802a6b:	83 e0 01             	and    $0x1,%eax
+}
+  802a6e:	5d                   	pop    %rbp
+  802a6f:	c3                   	ret
+
+0000000000802a70 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802a70:	55                   	push   %rbp
+  802a71:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802a74:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  802a7b:	00 00 00 
+  802a7e:	ff d0                	call   *%rax
+  802a80:	83 e0 01             	and    $0x1,%eax
+}
+  802a83:	5d                   	pop    %rbp
+  802a84:	c3                   	ret
+
+0000000000802a85 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802a85:	55                   	push   %rbp
+  802a86:	48 89 e5             	mov    %rsp,%rbp
+  802a89:	41 57                	push   %r15
+  802a8b:	41 56                	push   %r14
+  802a8d:	41 55                	push   %r13
+  802a8f:	41 54                	push   %r12
+  802a91:	53                   	push   %rbx
+  802a92:	48 83 ec 18          	sub    $0x18,%rsp
+  802a96:	49 89 ff             	mov    %rdi,%r15
+  802a99:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802a9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802aa2:	49 bc 70 2a 80 00 00 	movabs $0x802a70,%r12
+  802aa9:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  802aac:	49 be 11 2a 80 00 00 	movabs $0x802a11,%r14
+  802ab3:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802ab6:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  802abd:	00 00 00 
+  802ac0:	eb 0c                	jmp    802ace <foreach_shared_region+0x49>
+  802ac2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ac9:	4c 39 eb             	cmp    %r13,%rbx
+  802acc:	74 38                	je     802b06 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802ace:	48 89 df             	mov    %rbx,%rdi
+  802ad1:	41 ff d4             	call   *%r12
+  802ad4:	84 c0                	test   %al,%al
+  802ad6:	74 ea                	je     802ac2 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  802ad8:	48 89 df             	mov    %rbx,%rdi
+  802adb:	41 ff d6             	call   *%r14
+  802ade:	a8 40                	test   $0x40,%al
+  802ae0:	74 e0                	je     802ac2 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802ae2:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802ae9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802aed:	48 89 df             	mov    %rbx,%rdi
+  802af0:	41 ff d7             	call   *%r15
+        if (err)
+  802af3:	85 c0                	test   %eax,%eax
+  802af5:	74 cb                	je     802ac2 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802af7:	48 83 c4 18          	add    $0x18,%rsp
+  802afb:	5b                   	pop    %rbx
+  802afc:	41 5c                	pop    %r12
+  802afe:	41 5d                	pop    %r13
+  802b00:	41 5e                	pop    %r14
+  802b02:	41 5f                	pop    %r15
+  802b04:	5d                   	pop    %rbp
+  802b05:	c3                   	ret
+    return 0;
+  802b06:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b0b:	eb ea                	jmp    802af7 <foreach_shared_region+0x72>
+
+0000000000802b0d <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802b0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b12:	c3                   	ret
+
+0000000000802b13 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802b13:	55                   	push   %rbp
+  802b14:	48 89 e5             	mov    %rsp,%rbp
+  802b17:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802b1a:	48 be 74 36 80 00 00 	movabs $0x803674,%rsi
+  802b21:	00 00 00 
+  802b24:	48 b8 13 0e 80 00 00 	movabs $0x800e13,%rax
+  802b2b:	00 00 00 
+  802b2e:	ff d0                	call   *%rax
+    return 0;
+}
+  802b30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b35:	5d                   	pop    %rbp
+  802b36:	c3                   	ret
+
+0000000000802b37 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802b37:	55                   	push   %rbp
+  802b38:	48 89 e5             	mov    %rsp,%rbp
+  802b3b:	41 57                	push   %r15
+  802b3d:	41 56                	push   %r14
+  802b3f:	41 55                	push   %r13
+  802b41:	41 54                	push   %r12
+  802b43:	53                   	push   %rbx
+  802b44:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802b4b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802b52:	48 85 d2             	test   %rdx,%rdx
+  802b55:	74 7a                	je     802bd1 <devcons_write+0x9a>
+  802b57:	49 89 d6             	mov    %rdx,%r14
+  802b5a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802b60:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802b65:	49 bf 0d 10 80 00 00 	movabs $0x80100d,%r15
+  802b6c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802b6f:	4c 89 f3             	mov    %r14,%rbx
+  802b72:	48 29 f3             	sub    %rsi,%rbx
+  802b75:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802b7a:	48 39 c3             	cmp    %rax,%rbx
+  802b7d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802b81:	4c 63 eb             	movslq %ebx,%r13
+  802b84:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802b8b:	48 01 c6             	add    %rax,%rsi
+  802b8e:	4c 89 ea             	mov    %r13,%rdx
+  802b91:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802b98:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802b9b:	4c 89 ee             	mov    %r13,%rsi
+  802b9e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802ba5:	48 b8 3a 12 80 00 00 	movabs $0x80123a,%rax
+  802bac:	00 00 00 
+  802baf:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802bb1:	41 01 dc             	add    %ebx,%r12d
+  802bb4:	49 63 f4             	movslq %r12d,%rsi
+  802bb7:	4c 39 f6             	cmp    %r14,%rsi
+  802bba:	72 b3                	jb     802b6f <devcons_write+0x38>
+    return res;
+  802bbc:	49 63 c4             	movslq %r12d,%rax
+}
+  802bbf:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802bc6:	5b                   	pop    %rbx
+  802bc7:	41 5c                	pop    %r12
+  802bc9:	41 5d                	pop    %r13
+  802bcb:	41 5e                	pop    %r14
+  802bcd:	41 5f                	pop    %r15
+  802bcf:	5d                   	pop    %rbp
+  802bd0:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802bd1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802bd7:	eb e3                	jmp    802bbc <devcons_write+0x85>
+
+0000000000802bd9 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802bd9:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802bdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802be1:	48 85 c0             	test   %rax,%rax
+  802be4:	74 55                	je     802c3b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802be6:	55                   	push   %rbp
+  802be7:	48 89 e5             	mov    %rsp,%rbp
+  802bea:	41 55                	push   %r13
+  802bec:	41 54                	push   %r12
+  802bee:	53                   	push   %rbx
+  802bef:	48 83 ec 08          	sub    $0x8,%rsp
+  802bf3:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802bf6:	48 bb 67 12 80 00 00 	movabs $0x801267,%rbx
+  802bfd:	00 00 00 
+  802c00:	49 bc 34 13 80 00 00 	movabs $0x801334,%r12
+  802c07:	00 00 00 
+  802c0a:	eb 03                	jmp    802c0f <devcons_read+0x36>
+  802c0c:	41 ff d4             	call   *%r12
+  802c0f:	ff d3                	call   *%rbx
+  802c11:	85 c0                	test   %eax,%eax
+  802c13:	74 f7                	je     802c0c <devcons_read+0x33>
+    if (c < 0) return c;
+  802c15:	48 63 d0             	movslq %eax,%rdx
+  802c18:	78 13                	js     802c2d <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802c1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c1f:	83 f8 04             	cmp    $0x4,%eax
+  802c22:	74 09                	je     802c2d <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802c24:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802c28:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802c2d:	48 89 d0             	mov    %rdx,%rax
+  802c30:	48 83 c4 08          	add    $0x8,%rsp
+  802c34:	5b                   	pop    %rbx
+  802c35:	41 5c                	pop    %r12
+  802c37:	41 5d                	pop    %r13
+  802c39:	5d                   	pop    %rbp
+  802c3a:	c3                   	ret
+  802c3b:	48 89 d0             	mov    %rdx,%rax
+  802c3e:	c3                   	ret
+
+0000000000802c3f <cputchar>:
+cputchar(int ch) {
+  802c3f:	55                   	push   %rbp
+  802c40:	48 89 e5             	mov    %rsp,%rbp
+  802c43:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802c47:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802c4b:	be 01 00 00 00       	mov    $0x1,%esi
+  802c50:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802c54:	48 b8 3a 12 80 00 00 	movabs $0x80123a,%rax
+  802c5b:	00 00 00 
+  802c5e:	ff d0                	call   *%rax
+}
+  802c60:	c9                   	leave
+  802c61:	c3                   	ret
+
+0000000000802c62 <getchar>:
+getchar(void) {
+  802c62:	55                   	push   %rbp
+  802c63:	48 89 e5             	mov    %rsp,%rbp
+  802c66:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802c6a:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c6f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802c73:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c78:	48 b8 d6 1d 80 00 00 	movabs $0x801dd6,%rax
+  802c7f:	00 00 00 
+  802c82:	ff d0                	call   *%rax
+  802c84:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802c86:	85 c0                	test   %eax,%eax
+  802c88:	78 06                	js     802c90 <getchar+0x2e>
+  802c8a:	74 08                	je     802c94 <getchar+0x32>
+  802c8c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802c90:	89 d0                	mov    %edx,%eax
+  802c92:	c9                   	leave
+  802c93:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802c94:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802c99:	eb f5                	jmp    802c90 <getchar+0x2e>
+
+0000000000802c9b <iscons>:
+iscons(int fdnum) {
+  802c9b:	55                   	push   %rbp
+  802c9c:	48 89 e5             	mov    %rsp,%rbp
+  802c9f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802ca3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802ca7:	48 b8 f3 1a 80 00 00 	movabs $0x801af3,%rax
+  802cae:	00 00 00 
+  802cb1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cb3:	85 c0                	test   %eax,%eax
+  802cb5:	78 18                	js     802ccf <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802cb7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802cbb:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802cc2:	00 00 00 
+  802cc5:	8b 00                	mov    (%rax),%eax
+  802cc7:	39 02                	cmp    %eax,(%rdx)
+  802cc9:	0f 94 c0             	sete   %al
+  802ccc:	0f b6 c0             	movzbl %al,%eax
+}
+  802ccf:	c9                   	leave
+  802cd0:	c3                   	ret
+
+0000000000802cd1 <opencons>:
+opencons(void) {
+  802cd1:	55                   	push   %rbp
+  802cd2:	48 89 e5             	mov    %rsp,%rbp
+  802cd5:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802cd9:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802cdd:	48 b8 93 1a 80 00 00 	movabs $0x801a93,%rax
+  802ce4:	00 00 00 
+  802ce7:	ff d0                	call   *%rax
+  802ce9:	85 c0                	test   %eax,%eax
+  802ceb:	78 49                	js     802d36 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802ced:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802cf2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cf7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802cfb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d00:	48 b8 c3 13 80 00 00 	movabs $0x8013c3,%rax
+  802d07:	00 00 00 
+  802d0a:	ff d0                	call   *%rax
+  802d0c:	85 c0                	test   %eax,%eax
+  802d0e:	78 26                	js     802d36 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802d10:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d14:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802d1b:	00 00 
+  802d1d:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802d1f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d23:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802d2a:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  802d31:	00 00 00 
+  802d34:	ff d0                	call   *%rax
+}
+  802d36:	c9                   	leave
+  802d37:	c3                   	ret
+
+0000000000802d38 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802d38:	55                   	push   %rbp
+  802d39:	48 89 e5             	mov    %rsp,%rbp
+  802d3c:	41 54                	push   %r12
+  802d3e:	53                   	push   %rbx
+  802d3f:	48 89 fb             	mov    %rdi,%rbx
+  802d42:	48 89 f7             	mov    %rsi,%rdi
+  802d45:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802d48:	48 85 f6             	test   %rsi,%rsi
+  802d4b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802d52:	00 00 00 
+  802d55:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802d59:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d5e:	48 b8 2d 17 80 00 00 	movabs $0x80172d,%rax
+  802d65:	00 00 00 
+  802d68:	ff d0                	call   *%rax
+    if (res < 0) {
+  802d6a:	85 c0                	test   %eax,%eax
+  802d6c:	78 45                	js     802db3 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802d6e:	48 85 db             	test   %rbx,%rbx
+  802d71:	74 12                	je     802d85 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802d73:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802d7a:	00 00 00 
+  802d7d:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802d83:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802d85:	4d 85 e4             	test   %r12,%r12
+  802d88:	74 14                	je     802d9e <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802d8a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802d91:	00 00 00 
+  802d94:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802d9a:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802d9e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802da5:	00 00 00 
+  802da8:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802dae:	5b                   	pop    %rbx
+  802daf:	41 5c                	pop    %r12
+  802db1:	5d                   	pop    %rbp
+  802db2:	c3                   	ret
+        if (from_env_store)
+  802db3:	48 85 db             	test   %rbx,%rbx
+  802db6:	74 06                	je     802dbe <ipc_recv+0x86>
+            *from_env_store = 0;
+  802db8:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802dbe:	4d 85 e4             	test   %r12,%r12
+  802dc1:	74 eb                	je     802dae <ipc_recv+0x76>
+            *perm_store = 0;
+  802dc3:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802dca:	00 
+  802dcb:	eb e1                	jmp    802dae <ipc_recv+0x76>
+
+0000000000802dcd <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802dcd:	55                   	push   %rbp
+  802dce:	48 89 e5             	mov    %rsp,%rbp
+  802dd1:	41 57                	push   %r15
+  802dd3:	41 56                	push   %r14
+  802dd5:	41 55                	push   %r13
+  802dd7:	41 54                	push   %r12
+  802dd9:	53                   	push   %rbx
+  802dda:	48 83 ec 18          	sub    $0x18,%rsp
+  802dde:	41 89 fd             	mov    %edi,%r13d
+  802de1:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802de4:	48 89 d3             	mov    %rdx,%rbx
+  802de7:	49 89 cc             	mov    %rcx,%r12
+  802dea:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802dee:	48 85 d2             	test   %rdx,%rdx
+  802df1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802df8:	00 00 00 
+  802dfb:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802dff:	49 be 01 17 80 00 00 	movabs $0x801701,%r14
+  802e06:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802e09:	49 bf 34 13 80 00 00 	movabs $0x801334,%r15
+  802e10:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802e13:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802e16:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802e1a:	4c 89 e1             	mov    %r12,%rcx
+  802e1d:	48 89 da             	mov    %rbx,%rdx
+  802e20:	44 89 ef             	mov    %r13d,%edi
+  802e23:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802e26:	85 c0                	test   %eax,%eax
+  802e28:	74 34                	je     802e5e <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802e2a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802e2d:	75 05                	jne    802e34 <ipc_send+0x67>
+        sys_yield();
+  802e2f:	41 ff d7             	call   *%r15
+    while (true) {
+  802e32:	eb df                	jmp    802e13 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802e34:	48 ba 80 36 80 00 00 	movabs $0x803680,%rdx
+  802e3b:	00 00 00 
+  802e3e:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802e43:	48 bf 99 36 80 00 00 	movabs $0x803699,%rdi
+  802e4a:	00 00 00 
+  802e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e52:	48 b9 9e 03 80 00 00 	movabs $0x80039e,%rcx
+  802e59:	00 00 00 
+  802e5c:	ff d1                	call   *%rcx
+    }
+}
+  802e5e:	48 83 c4 18          	add    $0x18,%rsp
+  802e62:	5b                   	pop    %rbx
+  802e63:	41 5c                	pop    %r12
+  802e65:	41 5d                	pop    %r13
+  802e67:	41 5e                	pop    %r14
+  802e69:	41 5f                	pop    %r15
+  802e6b:	5d                   	pop    %rbp
+  802e6c:	c3                   	ret
+
+0000000000802e6d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802e6d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802e72:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802e79:	00 00 00 
+  802e7c:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802e83:	48 01 ca             	add    %rcx,%rdx
+  802e86:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802e8c:	39 fa                	cmp    %edi,%edx
+  802e8e:	74 12                	je     802ea2 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802e90:	48 83 c0 01          	add    $0x1,%rax
+  802e94:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802e9a:	75 e0                	jne    802e7c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802e9c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ea1:	c3                   	ret
+            return envs[i].env_id;
+  802ea2:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802ea9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802eb0:	00 00 00 
+  802eb3:	48 01 d0             	add    %rdx,%rax
+  802eb6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802ebc:	c3                   	ret
+  802ebd:	0f 1f 00             	nopl   (%rax)
+
+0000000000802ec0 <__rodata_start>:
+  802ec0:	74 65                	je     802f27 <__rodata_start+0x67>
+  802ec2:	73 74                	jae    802f38 <__rodata_start+0x78>
+  802ec4:	69 6e 67 20 66 6f 72 	imul   $0x726f6620,0x67(%rsi),%ebp
+  802ecb:	20 70 69             	and    %dh,0x69(%rax)
+  802ece:	70 65                	jo     802f35 <__rodata_start+0x75>
+  802ed0:	69 73 63 6c 6f 73 65 	imul   $0x65736f6c,0x63(%rbx),%esi
+  802ed7:	64 20 72 61          	and    %dh,%fs:0x61(%rdx)
+  802edb:	63 65 2e             	movsxd 0x2e(%rbp),%esp
+  802ede:	2e 2e 0a 00          	cs cs or (%rax),%al
+  802ee2:	00 00                	add    %al,(%rax)
+  802ee4:	00 00                	add    %al,(%rax)
+  802ee6:	00 00                	add    %al,(%rax)
+  802ee8:	73 6f                	jae    802f59 <__rodata_start+0x99>
+  802eea:	6d                   	insl   (%dx),%es:(%rdi)
+  802eeb:	65 68 6f 77 20 74    	gs push $0x7420776f
+  802ef1:	68 65 20 6f 74       	push   $0x746f2065
+  802ef6:	68 65 72 20 65       	push   $0x65207265
+  802efb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802efc:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802f00:	20 70 5b             	and    %dh,0x5b(%rax)
+  802f03:	30 5d 20             	xor    %bl,0x20(%rbp)
+  802f06:	67 6f                	outsl  %ds:(%esi),(%dx)
+  802f08:	74 20                	je     802f2a <__rodata_start+0x6a>
+  802f0a:	63 6c 6f 73          	movsxd 0x73(%rdi,%rbp,2),%ebp
+  802f0e:	65 64 21 00          	gs and %eax,%fs:(%rax)
+  802f12:	70 69                	jo     802f7d <__rodata_start+0xbd>
+  802f14:	70 65                	jo     802f7b <__rodata_start+0xbb>
+  802f16:	3a 20                	cmp    (%rax),%ah
+  802f18:	25 69 00 75 73       	and    $0x73750069,%eax
+  802f1d:	65 72 2f             	gs jb  802f4f <__rodata_start+0x8f>
+  802f20:	74 65                	je     802f87 <__rodata_start+0xc7>
+  802f22:	73 74                	jae    802f98 <__rodata_start+0xd8>
+  802f24:	70 69                	jo     802f8f <__rodata_start+0xcf>
+  802f26:	70 65                	jo     802f8d <__rodata_start+0xcd>
+  802f28:	72 61                	jb     802f8b <__rodata_start+0xcb>
+  802f2a:	63 65 32             	movsxd 0x32(%rbp),%esp
+  802f2d:	2e 63 00             	cs movsxd (%rax),%eax
+  802f30:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802f32:	72 6b                	jb     802f9f <__rodata_start+0xdf>
+  802f34:	3a 20                	cmp    (%rax),%ah
+  802f36:	25 69 00 25 64       	and    $0x64250069,%eax
+  802f3b:	2e 00 0a             	cs add %cl,(%rdx)
+  802f3e:	52                   	push   %rdx
+  802f3f:	41                   	rex.B
+  802f40:	43                   	rex.XB
+  802f41:	45 3a 20             	cmp    (%r8),%r12b
+  802f44:	70 69                	jo     802faf <__rodata_start+0xef>
+  802f46:	70 65                	jo     802fad <__rodata_start+0xed>
+  802f48:	20 61 70             	and    %ah,0x70(%rcx)
+  802f4b:	70 65                	jo     802fb2 <__rodata_start+0xf2>
+  802f4d:	61                   	(bad)
+  802f4e:	72 73                	jb     802fc3 <__rodata_start+0x103>
+  802f50:	20 63 6c             	and    %ah,0x6c(%rbx)
+  802f53:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f54:	73 65                	jae    802fbb <__rodata_start+0xfb>
+  802f56:	64 0a 00             	or     %fs:(%rax),%al
+  802f59:	63 68 69             	movsxd 0x69(%rax),%ebp
+  802f5c:	6c                   	insb   (%dx),%es:(%rdi)
+  802f5d:	64 20 64 6f 6e       	and    %ah,%fs:0x6e(%rdi,%rbp,2)
+  802f62:	65 20 77 69          	and    %dh,%gs:0x69(%rdi)
+  802f66:	74 68                	je     802fd0 <__rodata_start+0x110>
+  802f68:	20 6c 6f 6f          	and    %ch,0x6f(%rdi,%rbp,2)
+  802f6c:	70 0a                	jo     802f78 <__rodata_start+0xb8>
+  802f6e:	00 63 61             	add    %ah,0x61(%rbx)
+  802f71:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f72:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f73:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f74:	74 20                	je     802f96 <__rodata_start+0xd6>
+  802f76:	6c                   	insb   (%dx),%es:(%rdi)
+  802f77:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f78:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f79:	6b 20 75             	imul   $0x75,(%rax),%esp
+  802f7c:	70 20                	jo     802f9e <__rodata_start+0xde>
+  802f7e:	70 5b                	jo     802fdb <__rodata_start+0x11b>
+  802f80:	30 5d 3a             	xor    %bl,0x3a(%rbp)
+  802f83:	20 25 69 00 72 61    	and    %ah,0x61720069(%rip)        # 61f22ff2 <__bss_end+0x6171aff2>
+  802f89:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802f8c:	64 69 64 6e 27 74 20 	imul   $0x61682074,%fs:0x27(%rsi,%rbp,2),%esp
+  802f93:	68 61 
+  802f95:	70 70                	jo     803007 <__rodata_start+0x147>
+  802f97:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f99:	0a 00                	or     (%rax),%al
+  802f9b:	3c 75                	cmp    $0x75,%al
+  802f9d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f9e:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802fa2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fa3:	3e 00 0f             	ds add %cl,(%rdi)
+  802fa6:	1f                   	(bad)
+  802fa7:	00 5b 25             	add    %bl,0x25(%rbx)
+  802faa:	30 38                	xor    %bh,(%rax)
+  802fac:	78 5d                	js     80300b <__rodata_start+0x14b>
+  802fae:	20 75 73             	and    %dh,0x73(%rbp)
+  802fb1:	65 72 20             	gs jb  802fd4 <__rodata_start+0x114>
+  802fb4:	70 61                	jo     803017 <__rodata_start+0x157>
+  802fb6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fb7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  802fbe:	73 20                	jae    802fe0 <__rodata_start+0x120>
+  802fc0:	61                   	(bad)
+  802fc1:	74 20                	je     802fe3 <__rodata_start+0x123>
+  802fc3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  802fc8:	3a 20                	cmp    (%rax),%ah
+  802fca:	00 30                	add    %dh,(%rax)
+  802fcc:	31 32                	xor    %esi,(%rdx)
+  802fce:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802fd5:	41                   	rex.B
+  802fd6:	42                   	rex.X
+  802fd7:	43                   	rex.XB
+  802fd8:	44                   	rex.R
+  802fd9:	45                   	rex.RB
+  802fda:	46 00 30             	rex.RX add %r14b,(%rax)
+  802fdd:	31 32                	xor    %esi,(%rdx)
+  802fdf:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802fe6:	61                   	(bad)
+  802fe7:	62 63 64 65 66       	(bad)
+  802fec:	00 28                	add    %ch,(%rax)
+  802fee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fef:	75 6c                	jne    80305d <__rodata_start+0x19d>
+  802ff1:	6c                   	insb   (%dx),%es:(%rdi)
+  802ff2:	29 00                	sub    %eax,(%rax)
+  802ff4:	65 72 72             	gs jb  803069 <__rodata_start+0x1a9>
+  802ff7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ff8:	72 20                	jb     80301a <__rodata_start+0x15a>
+  802ffa:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802fff:	73 70                	jae    803071 <__rodata_start+0x1b1>
+  803001:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803005:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80300c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80300d:	72 00                	jb     80300f <__rodata_start+0x14f>
+  80300f:	62 61 64 20 65       	(bad)
+  803014:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803015:	76 69                	jbe    803080 <__rodata_start+0x1c0>
+  803017:	72 6f                	jb     803088 <__rodata_start+0x1c8>
+  803019:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80301a:	6d                   	insl   (%dx),%es:(%rdi)
+  80301b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80301d:	74 00                	je     80301f <__rodata_start+0x15f>
+  80301f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803026:	20 70 61             	and    %dh,0x61(%rax)
+  803029:	72 61                	jb     80308c <__rodata_start+0x1cc>
+  80302b:	6d                   	insl   (%dx),%es:(%rdi)
+  80302c:	65 74 65             	gs je  803094 <__rodata_start+0x1d4>
+  80302f:	72 00                	jb     803031 <__rodata_start+0x171>
+  803031:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803032:	75 74                	jne    8030a8 <__rodata_start+0x1e8>
+  803034:	20 6f 66             	and    %ch,0x66(%rdi)
+  803037:	20 6d 65             	and    %ch,0x65(%rbp)
+  80303a:	6d                   	insl   (%dx),%es:(%rdi)
+  80303b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80303c:	72 79                	jb     8030b7 <__rodata_start+0x1f7>
+  80303e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803041:	74 20                	je     803063 <__rodata_start+0x1a3>
+  803043:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803044:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803048:	76 69                	jbe    8030b3 <__rodata_start+0x1f3>
+  80304a:	72 6f                	jb     8030bb <__rodata_start+0x1fb>
+  80304c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80304d:	6d                   	insl   (%dx),%es:(%rdi)
+  80304e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803050:	74 73                	je     8030c5 <__rodata_start+0x205>
+  803052:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803055:	72 72                	jb     8030c9 <__rodata_start+0x209>
+  803057:	75 70                	jne    8030c9 <__rodata_start+0x209>
+  803059:	74 65                	je     8030c0 <__rodata_start+0x200>
+  80305b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803060:	75 67                	jne    8030c9 <__rodata_start+0x209>
+  803062:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803065:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803067:	00 73 65             	add    %dh,0x65(%rbx)
+  80306a:	67 6d                	insl   (%dx),%es:(%edi)
+  80306c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80306e:	74 61                	je     8030d1 <__rodata_start+0x211>
+  803070:	74 69                	je     8030db <__rodata_start+0x21b>
+  803072:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803073:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803074:	20 66 61             	and    %ah,0x61(%rsi)
+  803077:	75 6c                	jne    8030e5 <__rodata_start+0x225>
+  803079:	74 00                	je     80307b <__rodata_start+0x1bb>
+  80307b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803082:	20 45 4c             	and    %al,0x4c(%rbp)
+  803085:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803089:	61                   	(bad)
+  80308a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80308f:	20 73 75             	and    %dh,0x75(%rbx)
+  803092:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803095:	73 79                	jae    803110 <__rodata_start+0x250>
+  803097:	73 74                	jae    80310d <__rodata_start+0x24d>
+  803099:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80309b:	20 63 61             	and    %ah,0x61(%rbx)
+  80309e:	6c                   	insb   (%dx),%es:(%rdi)
+  80309f:	6c                   	insb   (%dx),%es:(%rdi)
+  8030a0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8030a3:	74 72                	je     803117 <__rodata_start+0x257>
+  8030a5:	79 20                	jns    8030c7 <__rodata_start+0x207>
+  8030a7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030a8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030a9:	74 20                	je     8030cb <__rodata_start+0x20b>
+  8030ab:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8030ad:	75 6e                	jne    80311d <__rodata_start+0x25d>
+  8030af:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8030b3:	76 20                	jbe    8030d5 <__rodata_start+0x215>
+  8030b5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8030bc:	72 65                	jb     803123 <__rodata_start+0x263>
+  8030be:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8030c1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030c2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8030c6:	65 78 70             	gs js  803139 <__rodata_start+0x279>
+  8030c9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8030ce:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8030d1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8030d5:	20 66 69             	and    %ah,0x69(%rsi)
+  8030d8:	6c                   	insb   (%dx),%es:(%rdi)
+  8030d9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8030dd:	20 66 72             	and    %ah,0x72(%rsi)
+  8030e0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8030e5:	61                   	(bad)
+  8030e6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8030e9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030ea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030eb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8030ef:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8030f2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030f3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030f4:	20 6d 61             	and    %ch,0x61(%rbp)
+  8030f7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030f8:	79 20                	jns    80311a <__rodata_start+0x25a>
+  8030fa:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803101:	72 65                	jb     803168 <__rodata_start+0x2a8>
+  803103:	20 6f 70             	and    %ch,0x70(%rdi)
+  803106:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803108:	00 66 69             	add    %ah,0x69(%rsi)
+  80310b:	6c                   	insb   (%dx),%es:(%rdi)
+  80310c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803110:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803113:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803114:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803117:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803118:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803119:	74 20                	je     80313b <__rodata_start+0x27b>
+  80311b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80311d:	75 6e                	jne    80318d <__rodata_start+0x2cd>
+  80311f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803123:	76 61                	jbe    803186 <__rodata_start+0x2c6>
+  803125:	6c                   	insb   (%dx),%es:(%rdi)
+  803126:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80312d:	00 
+  80312e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803135:	72 65                	jb     80319c <__rodata_start+0x2dc>
+  803137:	61                   	(bad)
+  803138:	64 79 20             	fs jns 80315b <__rodata_start+0x29b>
+  80313b:	65 78 69             	gs js  8031a7 <__rodata_start+0x2e7>
+  80313e:	73 74                	jae    8031b4 <__rodata_start+0x2f4>
+  803140:	73 00                	jae    803142 <__rodata_start+0x282>
+  803142:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803143:	70 65                	jo     8031aa <__rodata_start+0x2ea>
+  803145:	72 61                	jb     8031a8 <__rodata_start+0x2e8>
+  803147:	74 69                	je     8031b2 <__rodata_start+0x2f2>
+  803149:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80314a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80314b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80314e:	74 20                	je     803170 <__rodata_start+0x2b0>
+  803150:	73 75                	jae    8031c7 <__rodata_start+0x307>
+  803152:	70 70                	jo     8031c4 <__rodata_start+0x304>
+  803154:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803155:	72 74                	jb     8031cb <__rodata_start+0x30b>
+  803157:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  80315c:	65 72 61             	gs jb  8031c0 <__rodata_start+0x300>
+  80315f:	74 69                	je     8031ca <__rodata_start+0x30a>
+  803161:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803162:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803163:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803166:	74 20                	je     803188 <__rodata_start+0x2c8>
+  803168:	70 65                	jo     8031cf <__rodata_start+0x30f>
+  80316a:	72 6d                	jb     8031d9 <__rodata_start+0x319>
+  80316c:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  803173:	2e 
+  803174:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80317b:	00 
+  80317c:	0f 1f 40 00          	nopl   0x0(%rax)
+  803180:	db 06                	fildl  (%rsi)
+  803182:	80 00 00             	addb   $0x0,(%rax)
+  803185:	00 00                	add    %al,(%rax)
+  803187:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  80318e:	00 00                	add    %al,(%rax)
+  803190:	0c 0d                	or     $0xd,%al
+  803192:	80 00 00             	addb   $0x0,(%rax)
+  803195:	00 00                	add    %al,(%rax)
+  803197:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  80319e:	00 00                	add    %al,(%rax)
+  8031a0:	1c 0d                	sbb    $0xd,%al
+  8031a2:	80 00 00             	addb   $0x0,(%rax)
+  8031a5:	00 00                	add    %al,(%rax)
+  8031a7:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  8031ae:	00 00                	add    %al,(%rax)
+  8031b0:	1c 0d                	sbb    $0xd,%al
+  8031b2:	80 00 00             	addb   $0x0,(%rax)
+  8031b5:	00 00                	add    %al,(%rax)
+  8031b7:	00 fa                	add    %bh,%dl
+  8031b9:	06                   	(bad)
+  8031ba:	80 00 00             	addb   $0x0,(%rax)
+  8031bd:	00 00                	add    %al,(%rax)
+  8031bf:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  8031c6:	00 00                	add    %al,(%rax)
+  8031c8:	1c 0d                	sbb    $0xd,%al
+  8031ca:	80 00 00             	addb   $0x0,(%rax)
+  8031cd:	00 00                	add    %al,(%rax)
+  8031cf:	00 ee                	add    %ch,%dh
+  8031d1:	06                   	(bad)
+  8031d2:	80 00 00             	addb   $0x0,(%rax)
+  8031d5:	00 00                	add    %al,(%rax)
+  8031d7:	00 68 07             	add    %ch,0x7(%rax)
+  8031da:	80 00 00             	addb   $0x0,(%rax)
+  8031dd:	00 00                	add    %al,(%rax)
+  8031df:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  8031e6:	00 00                	add    %al,(%rax)
+  8031e8:	ee                   	out    %al,(%dx)
+  8031e9:	06                   	(bad)
+  8031ea:	80 00 00             	addb   $0x0,(%rax)
+  8031ed:	00 00                	add    %al,(%rax)
+  8031ef:	00 34 07             	add    %dh,(%rdi,%rax,1)
+  8031f2:	80 00 00             	addb   $0x0,(%rax)
+  8031f5:	00 00                	add    %al,(%rax)
+  8031f7:	00 34 07             	add    %dh,(%rdi,%rax,1)
+  8031fa:	80 00 00             	addb   $0x0,(%rax)
+  8031fd:	00 00                	add    %al,(%rax)
+  8031ff:	00 34 07             	add    %dh,(%rdi,%rax,1)
+  803202:	80 00 00             	addb   $0x0,(%rax)
+  803205:	00 00                	add    %al,(%rax)
+  803207:	00 34 07             	add    %dh,(%rdi,%rax,1)
+  80320a:	80 00 00             	addb   $0x0,(%rax)
+  80320d:	00 00                	add    %al,(%rax)
+  80320f:	00 34 07             	add    %dh,(%rdi,%rax,1)
+  803212:	80 00 00             	addb   $0x0,(%rax)
+  803215:	00 00                	add    %al,(%rax)
+  803217:	00 34 07             	add    %dh,(%rdi,%rax,1)
+  80321a:	80 00 00             	addb   $0x0,(%rax)
+  80321d:	00 00                	add    %al,(%rax)
+  80321f:	00 34 07             	add    %dh,(%rdi,%rax,1)
+  803222:	80 00 00             	addb   $0x0,(%rax)
+  803225:	00 00                	add    %al,(%rax)
+  803227:	00 34 07             	add    %dh,(%rdi,%rax,1)
+  80322a:	80 00 00             	addb   $0x0,(%rax)
+  80322d:	00 00                	add    %al,(%rax)
+  80322f:	00 34 07             	add    %dh,(%rdi,%rax,1)
+  803232:	80 00 00             	addb   $0x0,(%rax)
+  803235:	00 00                	add    %al,(%rax)
+  803237:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  80323e:	00 00                	add    %al,(%rax)
+  803240:	1c 0d                	sbb    $0xd,%al
+  803242:	80 00 00             	addb   $0x0,(%rax)
+  803245:	00 00                	add    %al,(%rax)
+  803247:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  80324e:	00 00                	add    %al,(%rax)
+  803250:	1c 0d                	sbb    $0xd,%al
+  803252:	80 00 00             	addb   $0x0,(%rax)
+  803255:	00 00                	add    %al,(%rax)
+  803257:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  80325e:	00 00                	add    %al,(%rax)
+  803260:	1c 0d                	sbb    $0xd,%al
+  803262:	80 00 00             	addb   $0x0,(%rax)
+  803265:	00 00                	add    %al,(%rax)
+  803267:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  80326e:	00 00                	add    %al,(%rax)
+  803270:	1c 0d                	sbb    $0xd,%al
+  803272:	80 00 00             	addb   $0x0,(%rax)
+  803275:	00 00                	add    %al,(%rax)
+  803277:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  80327e:	00 00                	add    %al,(%rax)
+  803280:	1c 0d                	sbb    $0xd,%al
+  803282:	80 00 00             	addb   $0x0,(%rax)
+  803285:	00 00                	add    %al,(%rax)
+  803287:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  80328e:	00 00                	add    %al,(%rax)
+  803290:	1c 0d                	sbb    $0xd,%al
+  803292:	80 00 00             	addb   $0x0,(%rax)
+  803295:	00 00                	add    %al,(%rax)
+  803297:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  80329e:	00 00                	add    %al,(%rax)
+  8032a0:	1c 0d                	sbb    $0xd,%al
+  8032a2:	80 00 00             	addb   $0x0,(%rax)
+  8032a5:	00 00                	add    %al,(%rax)
+  8032a7:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  8032ae:	00 00                	add    %al,(%rax)
+  8032b0:	1c 0d                	sbb    $0xd,%al
+  8032b2:	80 00 00             	addb   $0x0,(%rax)
+  8032b5:	00 00                	add    %al,(%rax)
+  8032b7:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  8032be:	00 00                	add    %al,(%rax)
+  8032c0:	1c 0d                	sbb    $0xd,%al
+  8032c2:	80 00 00             	addb   $0x0,(%rax)
+  8032c5:	00 00                	add    %al,(%rax)
+  8032c7:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  8032ce:	00 00                	add    %al,(%rax)
+  8032d0:	1c 0d                	sbb    $0xd,%al
+  8032d2:	80 00 00             	addb   $0x0,(%rax)
+  8032d5:	00 00                	add    %al,(%rax)
+  8032d7:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  8032de:	00 00                	add    %al,(%rax)
+  8032e0:	1c 0d                	sbb    $0xd,%al
+  8032e2:	80 00 00             	addb   $0x0,(%rax)
+  8032e5:	00 00                	add    %al,(%rax)
+  8032e7:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  8032ee:	00 00                	add    %al,(%rax)
+  8032f0:	1c 0d                	sbb    $0xd,%al
+  8032f2:	80 00 00             	addb   $0x0,(%rax)
+  8032f5:	00 00                	add    %al,(%rax)
+  8032f7:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  8032fe:	00 00                	add    %al,(%rax)
+  803300:	1c 0d                	sbb    $0xd,%al
+  803302:	80 00 00             	addb   $0x0,(%rax)
+  803305:	00 00                	add    %al,(%rax)
+  803307:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  80330e:	00 00                	add    %al,(%rax)
+  803310:	1c 0d                	sbb    $0xd,%al
+  803312:	80 00 00             	addb   $0x0,(%rax)
+  803315:	00 00                	add    %al,(%rax)
+  803317:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  80331e:	00 00                	add    %al,(%rax)
+  803320:	1c 0d                	sbb    $0xd,%al
+  803322:	80 00 00             	addb   $0x0,(%rax)
+  803325:	00 00                	add    %al,(%rax)
+  803327:	00 3f                	add    %bh,(%rdi)
+  803329:	0c 80                	or     $0x80,%al
+  80332b:	00 00                	add    %al,(%rax)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  803336:	00 00                	add    %al,(%rax)
+  803338:	1c 0d                	sbb    $0xd,%al
+  80333a:	80 00 00             	addb   $0x0,(%rax)
+  80333d:	00 00                	add    %al,(%rax)
+  80333f:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  803346:	00 00                	add    %al,(%rax)
+  803348:	1c 0d                	sbb    $0xd,%al
+  80334a:	80 00 00             	addb   $0x0,(%rax)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  803356:	00 00                	add    %al,(%rax)
+  803358:	1c 0d                	sbb    $0xd,%al
+  80335a:	80 00 00             	addb   $0x0,(%rax)
+  80335d:	00 00                	add    %al,(%rax)
+  80335f:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  803366:	00 00                	add    %al,(%rax)
+  803368:	1c 0d                	sbb    $0xd,%al
+  80336a:	80 00 00             	addb   $0x0,(%rax)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  803376:	00 00                	add    %al,(%rax)
+  803378:	1c 0d                	sbb    $0xd,%al
+  80337a:	80 00 00             	addb   $0x0,(%rax)
+  80337d:	00 00                	add    %al,(%rax)
+  80337f:	00 8b 07 80 00 00    	add    %cl,0x8007(%rbx)
+  803385:	00 00                	add    %al,(%rax)
+  803387:	00 5a 09             	add    %bl,0x9(%rdx)
+  80338a:	80 00 00             	addb   $0x0,(%rax)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  803396:	00 00                	add    %al,(%rax)
+  803398:	1c 0d                	sbb    $0xd,%al
+  80339a:	80 00 00             	addb   $0x0,(%rax)
+  80339d:	00 00                	add    %al,(%rax)
+  80339f:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  8033a6:	00 00                	add    %al,(%rax)
+  8033a8:	1c 0d                	sbb    $0xd,%al
+  8033aa:	80 00 00             	addb   $0x0,(%rax)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 ba 07 80 00 00    	add    %bh,0x8007(%rdx)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  8033be:	00 00                	add    %al,(%rax)
+  8033c0:	1c 0d                	sbb    $0xd,%al
+  8033c2:	80 00 00             	addb   $0x0,(%rax)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 80 07 80 00 00    	add    %al,0x8007(%rax)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  8033d6:	00 00                	add    %al,(%rax)
+  8033d8:	1c 0d                	sbb    $0xd,%al
+  8033da:	80 00 00             	addb   $0x0,(%rax)
+  8033dd:	00 00                	add    %al,(%rax)
+  8033df:	00 02                	add    %al,(%rdx)
+  8033e1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033e7:	00 cc                	add    %cl,%ah
+  8033e9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033ef:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  8033f6:	00 00                	add    %al,(%rax)
+  8033f8:	1c 0d                	sbb    $0xd,%al
+  8033fa:	80 00 00             	addb   $0x0,(%rax)
+  8033fd:	00 00                	add    %al,(%rax)
+  8033ff:	00 51 08             	add    %dl,0x8(%rcx)
+  803402:	80 00 00             	addb   $0x0,(%rax)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  80340e:	00 00                	add    %al,(%rax)
+  803410:	2e 0a 80 00 00 00 00 	cs or  0x0(%rax),%al
+  803417:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  80341e:	00 00                	add    %al,(%rax)
+  803420:	1c 0d                	sbb    $0xd,%al
+  803422:	80 00 00             	addb   $0x0,(%rax)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 3f                	add    %bh,(%rdi)
+  803429:	0c 80                	or     $0x80,%al
+  80342b:	00 00                	add    %al,(%rax)
+  80342d:	00 00                	add    %al,(%rax)
+  80342f:	00 1c 0d 80 00 00 00 	add    %bl,0x80(,%rcx,1)
+  803436:	00 00                	add    %al,(%rax)
+  803438:	e4 06                	in     $0x6,%al
+  80343a:	80 00 00             	addb   $0x0,(%rax)
+  80343d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803440 <error_string>:
+	...
+  803448:	fd 2f 80 00 00 00 00 00 0f 30 80 00 00 00 00 00     ./.......0......
+  803458:	1f 30 80 00 00 00 00 00 31 30 80 00 00 00 00 00     .0......10......
+  803468:	3f 30 80 00 00 00 00 00 53 30 80 00 00 00 00 00     ?0......S0......
+  803478:	68 30 80 00 00 00 00 00 7b 30 80 00 00 00 00 00     h0......{0......
+  803488:	8d 30 80 00 00 00 00 00 a1 30 80 00 00 00 00 00     .0.......0......
+  803498:	b1 30 80 00 00 00 00 00 c4 30 80 00 00 00 00 00     .0.......0......
+  8034a8:	db 30 80 00 00 00 00 00 f1 30 80 00 00 00 00 00     .0.......0......
+  8034b8:	09 31 80 00 00 00 00 00 21 31 80 00 00 00 00 00     .1......!1......
+  8034c8:	2e 31 80 00 00 00 00 00 f0 34 80 00 00 00 00 00     .1.......4......
+  8034d8:	42 31 80 00 00 00 00 00 00 00 00 00 00 00 00 00     B1..............
+  8034e8:	5a 31 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     Z1......file is 
+  8034f8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803508:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803518:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803528:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803538:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  803548:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  803558:	6c 69 62 2f 66 6f 72 6b 2e 63 00 0f 1f 44 00 00     lib/fork.c...D..
+  803568:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803578:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803588:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803598:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8035a8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8035b8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8035c8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8035d8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8035e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035f8:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000803600 <devtab>:
+  803600:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803610:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803620:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803630:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803640:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803650:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803660:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803670:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803680:	69 70 63 5f 73 65 6e 64 3a 20 66 61 69 6c 65 64     ipc_send: failed
+  803690:	20 74 6f 20 73 65 6e 64 00 6c 69 62 2f 69 70 63      to send.lib/ipc
+  8036a0:	2e 63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     .c.f.........f..
+  8036b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803700:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
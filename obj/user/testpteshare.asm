@@ -0,0 +1,6788 @@
+
+obj/user/testpteshare:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 54 02 00 00       	call   800277 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <childofspawn>:
+
+    breakpoint();
+}
+
+void
+childofspawn(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    strcpy(VA, msg2);
+  800029:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800030:	00 00 00 
+  800033:	48 8b 30             	mov    (%rax),%rsi
+  800036:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80003b:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  800042:	00 00 00 
+  800045:	ff d0                	call   *%rax
+    exit();
+  800047:	48 b8 1e 03 80 00 00 	movabs $0x80031e,%rax
+  80004e:	00 00 00 
+  800051:	ff d0                	call   *%rax
+}
+  800053:	5d                   	pop    %rbp
+  800054:	c3                   	ret
+
+0000000000800055 <umain>:
+umain(int argc, char **argv) {
+  800055:	55                   	push   %rbp
+  800056:	48 89 e5             	mov    %rsp,%rbp
+  800059:	53                   	push   %rbx
+  80005a:	48 83 ec 08          	sub    $0x8,%rsp
+    if (argc != 0)
+  80005e:	85 ff                	test   %edi,%edi
+  800060:	0f 85 4a 01 00 00    	jne    8001b0 <umain+0x15b>
+    if ((r = sys_alloc_region(0, VA, PAGE_SIZE, PROT_SHARE | PROT_RW)) < 0)
+  800066:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80006b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800070:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  800075:	bf 00 00 00 00       	mov    $0x0,%edi
+  80007a:	48 b8 66 13 80 00 00 	movabs $0x801366,%rax
+  800081:	00 00 00 
+  800084:	ff d0                	call   *%rax
+  800086:	85 c0                	test   %eax,%eax
+  800088:	0f 88 33 01 00 00    	js     8001c1 <umain+0x16c>
+    if ((r = fork()) < 0)
+  80008e:	48 b8 08 19 80 00 00 	movabs $0x801908,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+  80009a:	89 c3                	mov    %eax,%ebx
+  80009c:	85 c0                	test   %eax,%eax
+  80009e:	0f 88 4a 01 00 00    	js     8001ee <umain+0x199>
+    if (r == 0) {
+  8000a4:	0f 84 71 01 00 00    	je     80021b <umain+0x1c6>
+    wait(r);
+  8000aa:	89 df                	mov    %ebx,%edi
+  8000ac:	48 b8 48 31 80 00 00 	movabs $0x803148,%rax
+  8000b3:	00 00 00 
+  8000b6:	ff d0                	call   *%rax
+    cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  8000b8:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  8000bf:	00 00 00 
+  8000c2:	48 8b 30             	mov    (%rax),%rsi
+  8000c5:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8000ca:	48 b8 5a 0e 80 00 00 	movabs $0x800e5a,%rax
+  8000d1:	00 00 00 
+  8000d4:	ff d0                	call   *%rax
+  8000d6:	85 c0                	test   %eax,%eax
+  8000d8:	48 be 66 37 80 00 00 	movabs $0x803766,%rsi
+  8000df:	00 00 00 
+  8000e2:	48 b8 60 37 80 00 00 	movabs $0x803760,%rax
+  8000e9:	00 00 00 
+  8000ec:	48 0f 44 f0          	cmove  %rax,%rsi
+  8000f0:	48 bf 9c 37 80 00 00 	movabs $0x80379c,%rdi
+  8000f7:	00 00 00 
+  8000fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ff:	48 ba 91 04 80 00 00 	movabs $0x800491,%rdx
+  800106:	00 00 00 
+  800109:	ff d2                	call   *%rdx
+    if ((r = spawnl("/testpteshare", "testpteshare", "arg", 0)) < 0)
+  80010b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800110:	48 ba b7 37 80 00 00 	movabs $0x8037b7,%rdx
+  800117:	00 00 00 
+  80011a:	48 be bc 37 80 00 00 	movabs $0x8037bc,%rsi
+  800121:	00 00 00 
+  800124:	48 bf bb 37 80 00 00 	movabs $0x8037bb,%rdi
+  80012b:	00 00 00 
+  80012e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800133:	49 b8 4d 2b 80 00 00 	movabs $0x802b4d,%r8
+  80013a:	00 00 00 
+  80013d:	41 ff d0             	call   *%r8
+  800140:	89 c7                	mov    %eax,%edi
+  800142:	85 c0                	test   %eax,%eax
+  800144:	0f 88 00 01 00 00    	js     80024a <umain+0x1f5>
+    wait(r);
+  80014a:	48 b8 48 31 80 00 00 	movabs $0x803148,%rax
+  800151:	00 00 00 
+  800154:	ff d0                	call   *%rax
+    cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  800156:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80015d:	00 00 00 
+  800160:	48 8b 30             	mov    (%rax),%rsi
+  800163:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800168:	48 b8 5a 0e 80 00 00 	movabs $0x800e5a,%rax
+  80016f:	00 00 00 
+  800172:	ff d0                	call   *%rax
+  800174:	85 c0                	test   %eax,%eax
+  800176:	48 be 66 37 80 00 00 	movabs $0x803766,%rsi
+  80017d:	00 00 00 
+  800180:	48 b8 60 37 80 00 00 	movabs $0x803760,%rax
+  800187:	00 00 00 
+  80018a:	48 0f 44 f0          	cmove  %rax,%rsi
+  80018e:	48 bf d3 37 80 00 00 	movabs $0x8037d3,%rdi
+  800195:	00 00 00 
+  800198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019d:	48 ba 91 04 80 00 00 	movabs $0x800491,%rdx
+  8001a4:	00 00 00 
+  8001a7:	ff d2                	call   *%rdx
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8001a9:	cc                   	int3
+}
+  8001aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ae:	c9                   	leave
+  8001af:	c3                   	ret
+        childofspawn();
+  8001b0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001b7:	00 00 00 
+  8001ba:	ff d0                	call   *%rax
+  8001bc:	e9 a5 fe ff ff       	jmp    800066 <umain+0x11>
+        panic("sys_page_alloc: %i", r);
+  8001c1:	89 c1                	mov    %eax,%ecx
+  8001c3:	48 ba 6c 37 80 00 00 	movabs $0x80376c,%rdx
+  8001ca:	00 00 00 
+  8001cd:	be 12 00 00 00       	mov    $0x12,%esi
+  8001d2:	48 bf 7f 37 80 00 00 	movabs $0x80377f,%rdi
+  8001d9:	00 00 00 
+  8001dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e1:	49 b8 41 03 80 00 00 	movabs $0x800341,%r8
+  8001e8:	00 00 00 
+  8001eb:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  8001ee:	89 c1                	mov    %eax,%ecx
+  8001f0:	48 ba 93 37 80 00 00 	movabs $0x803793,%rdx
+  8001f7:	00 00 00 
+  8001fa:	be 16 00 00 00       	mov    $0x16,%esi
+  8001ff:	48 bf 7f 37 80 00 00 	movabs $0x80377f,%rdi
+  800206:	00 00 00 
+  800209:	b8 00 00 00 00       	mov    $0x0,%eax
+  80020e:	49 b8 41 03 80 00 00 	movabs $0x800341,%r8
+  800215:	00 00 00 
+  800218:	41 ff d0             	call   *%r8
+        strcpy(VA, msg);
+  80021b:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  800222:	00 00 00 
+  800225:	48 8b 30             	mov    (%rax),%rsi
+  800228:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80022d:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  800234:	00 00 00 
+  800237:	ff d0                	call   *%rax
+        exit();
+  800239:	48 b8 1e 03 80 00 00 	movabs $0x80031e,%rax
+  800240:	00 00 00 
+  800243:	ff d0                	call   *%rax
+  800245:	e9 60 fe ff ff       	jmp    8000aa <umain+0x55>
+        panic("spawn: %i", r);
+  80024a:	89 c1                	mov    %eax,%ecx
+  80024c:	48 ba c9 37 80 00 00 	movabs $0x8037c9,%rdx
+  800253:	00 00 00 
+  800256:	be 20 00 00 00       	mov    $0x20,%esi
+  80025b:	48 bf 7f 37 80 00 00 	movabs $0x80377f,%rdi
+  800262:	00 00 00 
+  800265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026a:	49 b8 41 03 80 00 00 	movabs $0x800341,%r8
+  800271:	00 00 00 
+  800274:	41 ff d0             	call   *%r8
+
+0000000000800277 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800277:	55                   	push   %rbp
+  800278:	48 89 e5             	mov    %rsp,%rbp
+  80027b:	41 56                	push   %r14
+  80027d:	41 55                	push   %r13
+  80027f:	41 54                	push   %r12
+  800281:	53                   	push   %rbx
+  800282:	41 89 fd             	mov    %edi,%r13d
+  800285:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800288:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  80028f:	00 00 00 
+  800292:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  800299:	00 00 00 
+  80029c:	48 39 c2             	cmp    %rax,%rdx
+  80029f:	73 17                	jae    8002b8 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8002a1:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002a4:	49 89 c4             	mov    %rax,%r12
+  8002a7:	48 83 c3 08          	add    $0x8,%rbx
+  8002ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b0:	ff 53 f8             	call   *-0x8(%rbx)
+  8002b3:	4c 39 e3             	cmp    %r12,%rbx
+  8002b6:	72 ef                	jb     8002a7 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8002b8:	48 b8 a6 12 80 00 00 	movabs $0x8012a6,%rax
+  8002bf:	00 00 00 
+  8002c2:	ff d0                	call   *%rax
+  8002c4:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8002c7:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8002ce:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8002d5:	00 00 00 
+  8002d8:	48 01 d0             	add    %rdx,%rax
+  8002db:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8002e2:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002e5:	45 85 ed             	test   %r13d,%r13d
+  8002e8:	7e 0d                	jle    8002f7 <libmain+0x80>
+  8002ea:	49 8b 06             	mov    (%r14),%rax
+  8002ed:	48 a3 10 50 80 00 00 	movabs %rax,0x805010
+  8002f4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002f7:	4c 89 f6             	mov    %r14,%rsi
+  8002fa:	44 89 ef             	mov    %r13d,%edi
+  8002fd:	48 b8 55 00 80 00 00 	movabs $0x800055,%rax
+  800304:	00 00 00 
+  800307:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800309:	48 b8 1e 03 80 00 00 	movabs $0x80031e,%rax
+  800310:	00 00 00 
+  800313:	ff d0                	call   *%rax
+#endif
+}
+  800315:	5b                   	pop    %rbx
+  800316:	41 5c                	pop    %r12
+  800318:	41 5d                	pop    %r13
+  80031a:	41 5e                	pop    %r14
+  80031c:	5d                   	pop    %rbp
+  80031d:	c3                   	ret
+
+000000000080031e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80031e:	55                   	push   %rbp
+  80031f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800322:	48 b8 2e 1c 80 00 00 	movabs $0x801c2e,%rax
+  800329:	00 00 00 
+  80032c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80032e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800333:	48 b8 3b 12 80 00 00 	movabs $0x80123b,%rax
+  80033a:	00 00 00 
+  80033d:	ff d0                	call   *%rax
+}
+  80033f:	5d                   	pop    %rbp
+  800340:	c3                   	ret
+
+0000000000800341 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800341:	55                   	push   %rbp
+  800342:	48 89 e5             	mov    %rsp,%rbp
+  800345:	41 56                	push   %r14
+  800347:	41 55                	push   %r13
+  800349:	41 54                	push   %r12
+  80034b:	53                   	push   %rbx
+  80034c:	48 83 ec 50          	sub    $0x50,%rsp
+  800350:	49 89 fc             	mov    %rdi,%r12
+  800353:	41 89 f5             	mov    %esi,%r13d
+  800356:	48 89 d3             	mov    %rdx,%rbx
+  800359:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80035d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800361:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800365:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80036c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800370:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800374:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800378:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80037c:	48 b8 10 50 80 00 00 	movabs $0x805010,%rax
+  800383:	00 00 00 
+  800386:	4c 8b 30             	mov    (%rax),%r14
+  800389:	48 b8 a6 12 80 00 00 	movabs $0x8012a6,%rax
+  800390:	00 00 00 
+  800393:	ff d0                	call   *%rax
+  800395:	89 c6                	mov    %eax,%esi
+  800397:	45 89 e8             	mov    %r13d,%r8d
+  80039a:	4c 89 e1             	mov    %r12,%rcx
+  80039d:	4c 89 f2             	mov    %r14,%rdx
+  8003a0:	48 bf 18 38 80 00 00 	movabs $0x803818,%rdi
+  8003a7:	00 00 00 
+  8003aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003af:	49 bc 91 04 80 00 00 	movabs $0x800491,%r12
+  8003b6:	00 00 00 
+  8003b9:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8003bc:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8003c0:	48 89 df             	mov    %rbx,%rdi
+  8003c3:	48 b8 2d 04 80 00 00 	movabs $0x80042d,%rax
+  8003ca:	00 00 00 
+  8003cd:	ff d0                	call   *%rax
+    cprintf("\n");
+  8003cf:	48 bf fd 37 80 00 00 	movabs $0x8037fd,%rdi
+  8003d6:	00 00 00 
+  8003d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003de:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003e1:	cc                   	int3
+  8003e2:	eb fd                	jmp    8003e1 <_panic+0xa0>
+
+00000000008003e4 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003e4:	55                   	push   %rbp
+  8003e5:	48 89 e5             	mov    %rsp,%rbp
+  8003e8:	53                   	push   %rbx
+  8003e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ed:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003f0:	8b 06                	mov    (%rsi),%eax
+  8003f2:	8d 50 01             	lea    0x1(%rax),%edx
+  8003f5:	89 16                	mov    %edx,(%rsi)
+  8003f7:	48 98                	cltq
+  8003f9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8003fe:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800404:	74 0a                	je     800410 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800406:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80040a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80040e:	c9                   	leave
+  80040f:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800410:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800414:	be ff 00 00 00       	mov    $0xff,%esi
+  800419:	48 b8 dd 11 80 00 00 	movabs $0x8011dd,%rax
+  800420:	00 00 00 
+  800423:	ff d0                	call   *%rax
+        state->offset = 0;
+  800425:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80042b:	eb d9                	jmp    800406 <putch+0x22>
+
+000000000080042d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80042d:	55                   	push   %rbp
+  80042e:	48 89 e5             	mov    %rsp,%rbp
+  800431:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800438:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80043b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800442:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800447:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80044f:	48 89 f1             	mov    %rsi,%rcx
+  800452:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800459:	48 bf e4 03 80 00 00 	movabs $0x8003e4,%rdi
+  800460:	00 00 00 
+  800463:	48 b8 e1 05 80 00 00 	movabs $0x8005e1,%rax
+  80046a:	00 00 00 
+  80046d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80046f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800476:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80047d:	48 b8 dd 11 80 00 00 	movabs $0x8011dd,%rax
+  800484:	00 00 00 
+  800487:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800489:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80048f:	c9                   	leave
+  800490:	c3                   	ret
+
+0000000000800491 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800491:	55                   	push   %rbp
+  800492:	48 89 e5             	mov    %rsp,%rbp
+  800495:	48 83 ec 50          	sub    $0x50,%rsp
+  800499:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80049d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004a1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004a5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004a9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8004ad:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8004b4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004bc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004c0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8004c4:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8004c8:	48 b8 2d 04 80 00 00 	movabs $0x80042d,%rax
+  8004cf:	00 00 00 
+  8004d2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8004d4:	c9                   	leave
+  8004d5:	c3                   	ret
+
+00000000008004d6 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8004d6:	55                   	push   %rbp
+  8004d7:	48 89 e5             	mov    %rsp,%rbp
+  8004da:	41 57                	push   %r15
+  8004dc:	41 56                	push   %r14
+  8004de:	41 55                	push   %r13
+  8004e0:	41 54                	push   %r12
+  8004e2:	53                   	push   %rbx
+  8004e3:	48 83 ec 18          	sub    $0x18,%rsp
+  8004e7:	49 89 fc             	mov    %rdi,%r12
+  8004ea:	49 89 f5             	mov    %rsi,%r13
+  8004ed:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004f1:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004f4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8004f7:	41 89 cf             	mov    %ecx,%r15d
+  8004fa:	4c 39 fa             	cmp    %r15,%rdx
+  8004fd:	73 5b                	jae    80055a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8004ff:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800503:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800507:	85 db                	test   %ebx,%ebx
+  800509:	7e 0e                	jle    800519 <print_num+0x43>
+            putch(padc, put_arg);
+  80050b:	4c 89 ee             	mov    %r13,%rsi
+  80050e:	44 89 f7             	mov    %r14d,%edi
+  800511:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800514:	83 eb 01             	sub    $0x1,%ebx
+  800517:	75 f2                	jne    80050b <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800519:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80051d:	48 b9 4c 38 80 00 00 	movabs $0x80384c,%rcx
+  800524:	00 00 00 
+  800527:	48 b8 3b 38 80 00 00 	movabs $0x80383b,%rax
+  80052e:	00 00 00 
+  800531:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800535:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800539:	ba 00 00 00 00       	mov    $0x0,%edx
+  80053e:	49 f7 f7             	div    %r15
+  800541:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800545:	4c 89 ee             	mov    %r13,%rsi
+  800548:	41 ff d4             	call   *%r12
+}
+  80054b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80054f:	5b                   	pop    %rbx
+  800550:	41 5c                	pop    %r12
+  800552:	41 5d                	pop    %r13
+  800554:	41 5e                	pop    %r14
+  800556:	41 5f                	pop    %r15
+  800558:	5d                   	pop    %rbp
+  800559:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80055a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80055e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800563:	49 f7 f7             	div    %r15
+  800566:	48 83 ec 08          	sub    $0x8,%rsp
+  80056a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80056e:	52                   	push   %rdx
+  80056f:	45 0f be c9          	movsbl %r9b,%r9d
+  800573:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800577:	48 89 c2             	mov    %rax,%rdx
+  80057a:	48 b8 d6 04 80 00 00 	movabs $0x8004d6,%rax
+  800581:	00 00 00 
+  800584:	ff d0                	call   *%rax
+  800586:	48 83 c4 10          	add    $0x10,%rsp
+  80058a:	eb 8d                	jmp    800519 <print_num+0x43>
+
+000000000080058c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80058c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800590:	48 8b 06             	mov    (%rsi),%rax
+  800593:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800597:	73 0a                	jae    8005a3 <sprintputch+0x17>
+        *state->start++ = ch;
+  800599:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80059d:	48 89 16             	mov    %rdx,(%rsi)
+  8005a0:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8005a3:	c3                   	ret
+
+00000000008005a4 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8005a4:	55                   	push   %rbp
+  8005a5:	48 89 e5             	mov    %rsp,%rbp
+  8005a8:	48 83 ec 50          	sub    $0x50,%rsp
+  8005ac:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005b0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005b4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8005b8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8005bf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005c7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005cb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8005cf:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8005d3:	48 b8 e1 05 80 00 00 	movabs $0x8005e1,%rax
+  8005da:	00 00 00 
+  8005dd:	ff d0                	call   *%rax
+}
+  8005df:	c9                   	leave
+  8005e0:	c3                   	ret
+
+00000000008005e1 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005e1:	55                   	push   %rbp
+  8005e2:	48 89 e5             	mov    %rsp,%rbp
+  8005e5:	41 57                	push   %r15
+  8005e7:	41 56                	push   %r14
+  8005e9:	41 55                	push   %r13
+  8005eb:	41 54                	push   %r12
+  8005ed:	53                   	push   %rbx
+  8005ee:	48 83 ec 38          	sub    $0x38,%rsp
+  8005f2:	49 89 fe             	mov    %rdi,%r14
+  8005f5:	49 89 f5             	mov    %rsi,%r13
+  8005f8:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8005fb:	48 8b 01             	mov    (%rcx),%rax
+  8005fe:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800602:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800606:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80060a:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80060e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800612:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800616:	0f b6 3b             	movzbl (%rbx),%edi
+  800619:	40 80 ff 25          	cmp    $0x25,%dil
+  80061d:	74 18                	je     800637 <vprintfmt+0x56>
+            if (!ch) return;
+  80061f:	40 84 ff             	test   %dil,%dil
+  800622:	0f 84 b1 06 00 00    	je     800cd9 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800628:	40 0f b6 ff          	movzbl %dil,%edi
+  80062c:	4c 89 ee             	mov    %r13,%rsi
+  80062f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800632:	4c 89 e3             	mov    %r12,%rbx
+  800635:	eb db                	jmp    800612 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800637:	be 00 00 00 00       	mov    $0x0,%esi
+  80063c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800640:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800645:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80064b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800652:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800656:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80065b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800660:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800663:	83 e8 23             	sub    $0x23,%eax
+  800666:	3c 57                	cmp    $0x57,%al
+  800668:	0f 87 51 06 00 00    	ja     800cbf <vprintfmt+0x6de>
+  80066e:	0f b6 c0             	movzbl %al,%eax
+  800671:	48 b9 00 3a 80 00 00 	movabs $0x803a00,%rcx
+  800678:	00 00 00 
+  80067b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80067e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800681:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800685:	eb cf                	jmp    800656 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800687:	49 89 dc             	mov    %rbx,%r12
+  80068a:	be 01 00 00 00       	mov    $0x1,%esi
+  80068f:	eb c5                	jmp    800656 <vprintfmt+0x75>
+            padc = ch;
+  800691:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800695:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800698:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80069b:	eb b9                	jmp    800656 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80069d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a3:	77 24                	ja     8006c9 <vprintfmt+0xe8>
+  8006a5:	89 c1                	mov    %eax,%ecx
+  8006a7:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8006ab:	83 c0 08             	add    $0x8,%eax
+  8006ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b1:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8006b4:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8006b7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006bb:	79 99                	jns    800656 <vprintfmt+0x75>
+                width = precision;
+  8006bd:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8006c1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006c7:	eb 8d                	jmp    800656 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006c9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8006cd:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8006d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d5:	eb da                	jmp    8006b1 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8006d7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006dc:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006e0:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006e6:	3c 39                	cmp    $0x39,%al
+  8006e8:	77 1c                	ja     800706 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006ea:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006ee:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006f2:	0f b6 c0             	movzbl %al,%eax
+  8006f5:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006fa:	0f b6 03             	movzbl (%rbx),%eax
+  8006fd:	3c 39                	cmp    $0x39,%al
+  8006ff:	76 e9                	jbe    8006ea <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800701:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800704:	eb b1                	jmp    8006b7 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800706:	49 89 dc             	mov    %rbx,%r12
+  800709:	eb ac                	jmp    8006b7 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80070b:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80070e:	85 c9                	test   %ecx,%ecx
+  800710:	b8 00 00 00 00       	mov    $0x0,%eax
+  800715:	0f 49 c1             	cmovns %ecx,%eax
+  800718:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80071b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80071e:	e9 33 ff ff ff       	jmp    800656 <vprintfmt+0x75>
+            lflag++;
+  800723:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800726:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800729:	e9 28 ff ff ff       	jmp    800656 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80072e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800731:	83 f8 2f             	cmp    $0x2f,%eax
+  800734:	77 19                	ja     80074f <vprintfmt+0x16e>
+  800736:	89 c2                	mov    %eax,%edx
+  800738:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073c:	83 c0 08             	add    $0x8,%eax
+  80073f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800742:	8b 3a                	mov    (%rdx),%edi
+  800744:	4c 89 ee             	mov    %r13,%rsi
+  800747:	41 ff d6             	call   *%r14
+            break;
+  80074a:	e9 c3 fe ff ff       	jmp    800612 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80074f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800753:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800757:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075b:	eb e5                	jmp    800742 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80075d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800760:	83 f8 2f             	cmp    $0x2f,%eax
+  800763:	77 5a                	ja     8007bf <vprintfmt+0x1de>
+  800765:	89 c2                	mov    %eax,%edx
+  800767:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076b:	83 c0 08             	add    $0x8,%eax
+  80076e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800771:	8b 02                	mov    (%rdx),%eax
+  800773:	89 c1                	mov    %eax,%ecx
+  800775:	f7 d9                	neg    %ecx
+  800777:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80077a:	83 f9 15             	cmp    $0x15,%ecx
+  80077d:	7f 4e                	jg     8007cd <vprintfmt+0x1ec>
+  80077f:	48 63 c1             	movslq %ecx,%rax
+  800782:	48 ba c0 3c 80 00 00 	movabs $0x803cc0,%rdx
+  800789:	00 00 00 
+  80078c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800790:	48 85 c0             	test   %rax,%rax
+  800793:	74 38                	je     8007cd <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800795:	48 89 c1             	mov    %rax,%rcx
+  800798:	48 ba 2c 3f 80 00 00 	movabs $0x803f2c,%rdx
+  80079f:	00 00 00 
+  8007a2:	4c 89 ee             	mov    %r13,%rsi
+  8007a5:	4c 89 f7             	mov    %r14,%rdi
+  8007a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ad:	49 b8 a4 05 80 00 00 	movabs $0x8005a4,%r8
+  8007b4:	00 00 00 
+  8007b7:	41 ff d0             	call   *%r8
+  8007ba:	e9 53 fe ff ff       	jmp    800612 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8007bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007cb:	eb a4                	jmp    800771 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8007cd:	48 ba 64 38 80 00 00 	movabs $0x803864,%rdx
+  8007d4:	00 00 00 
+  8007d7:	4c 89 ee             	mov    %r13,%rsi
+  8007da:	4c 89 f7             	mov    %r14,%rdi
+  8007dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e2:	49 b8 a4 05 80 00 00 	movabs $0x8005a4,%r8
+  8007e9:	00 00 00 
+  8007ec:	41 ff d0             	call   *%r8
+  8007ef:	e9 1e fe ff ff       	jmp    800612 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fa:	77 6c                	ja     800868 <vprintfmt+0x287>
+  8007fc:	89 c2                	mov    %eax,%edx
+  8007fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800802:	83 c0 08             	add    $0x8,%eax
+  800805:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800808:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80080b:	48 85 d2             	test   %rdx,%rdx
+  80080e:	48 b8 5d 38 80 00 00 	movabs $0x80385d,%rax
+  800815:	00 00 00 
+  800818:	48 0f 45 c2          	cmovne %rdx,%rax
+  80081c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800820:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800824:	7e 06                	jle    80082c <vprintfmt+0x24b>
+  800826:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80082a:	75 4a                	jne    800876 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80082c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800830:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800834:	0f b6 00             	movzbl (%rax),%eax
+  800837:	84 c0                	test   %al,%al
+  800839:	0f 85 9a 00 00 00    	jne    8008d9 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80083f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800842:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800846:	85 c0                	test   %eax,%eax
+  800848:	0f 8e c4 fd ff ff    	jle    800612 <vprintfmt+0x31>
+  80084e:	4c 89 ee             	mov    %r13,%rsi
+  800851:	bf 20 00 00 00       	mov    $0x20,%edi
+  800856:	41 ff d6             	call   *%r14
+  800859:	41 83 ec 01          	sub    $0x1,%r12d
+  80085d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800861:	75 eb                	jne    80084e <vprintfmt+0x26d>
+  800863:	e9 aa fd ff ff       	jmp    800612 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800868:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800870:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800874:	eb 92                	jmp    800808 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800876:	49 63 f7             	movslq %r15d,%rsi
+  800879:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80087d:	48 b8 93 0d 80 00 00 	movabs $0x800d93,%rax
+  800884:	00 00 00 
+  800887:	ff d0                	call   *%rax
+  800889:	48 89 c2             	mov    %rax,%rdx
+  80088c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80088f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800891:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800894:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800897:	85 c0                	test   %eax,%eax
+  800899:	7e 91                	jle    80082c <vprintfmt+0x24b>
+  80089b:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8008a0:	4c 89 ee             	mov    %r13,%rsi
+  8008a3:	44 89 e7             	mov    %r12d,%edi
+  8008a6:	41 ff d6             	call   *%r14
+  8008a9:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008ad:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008b0:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8008b3:	75 eb                	jne    8008a0 <vprintfmt+0x2bf>
+  8008b5:	e9 72 ff ff ff       	jmp    80082c <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008ba:	0f b6 f8             	movzbl %al,%edi
+  8008bd:	4c 89 ee             	mov    %r13,%rsi
+  8008c0:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008c3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008c7:	49 83 c4 01          	add    $0x1,%r12
+  8008cb:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8008d1:	84 c0                	test   %al,%al
+  8008d3:	0f 84 66 ff ff ff    	je     80083f <vprintfmt+0x25e>
+  8008d9:	45 85 ff             	test   %r15d,%r15d
+  8008dc:	78 0a                	js     8008e8 <vprintfmt+0x307>
+  8008de:	41 83 ef 01          	sub    $0x1,%r15d
+  8008e2:	0f 88 57 ff ff ff    	js     80083f <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008e8:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008ec:	74 cc                	je     8008ba <vprintfmt+0x2d9>
+  8008ee:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008f1:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008f6:	80 fa 5e             	cmp    $0x5e,%dl
+  8008f9:	77 c2                	ja     8008bd <vprintfmt+0x2dc>
+  8008fb:	eb bd                	jmp    8008ba <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8008fd:	40 84 f6             	test   %sil,%sil
+  800900:	75 26                	jne    800928 <vprintfmt+0x347>
+    switch (lflag) {
+  800902:	85 d2                	test   %edx,%edx
+  800904:	74 59                	je     80095f <vprintfmt+0x37e>
+  800906:	83 fa 01             	cmp    $0x1,%edx
+  800909:	74 7b                	je     800986 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80090b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090e:	83 f8 2f             	cmp    $0x2f,%eax
+  800911:	0f 87 96 00 00 00    	ja     8009ad <vprintfmt+0x3cc>
+  800917:	89 c2                	mov    %eax,%edx
+  800919:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091d:	83 c0 08             	add    $0x8,%eax
+  800920:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800923:	4c 8b 22             	mov    (%rdx),%r12
+  800926:	eb 17                	jmp    80093f <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800928:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092b:	83 f8 2f             	cmp    $0x2f,%eax
+  80092e:	77 21                	ja     800951 <vprintfmt+0x370>
+  800930:	89 c2                	mov    %eax,%edx
+  800932:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800936:	83 c0 08             	add    $0x8,%eax
+  800939:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80093f:	4d 85 e4             	test   %r12,%r12
+  800942:	78 7a                	js     8009be <vprintfmt+0x3dd>
+            num = i;
+  800944:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800947:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80094c:	e9 50 02 00 00       	jmp    800ba1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800951:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800955:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800959:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095d:	eb dd                	jmp    80093c <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80095f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800962:	83 f8 2f             	cmp    $0x2f,%eax
+  800965:	77 11                	ja     800978 <vprintfmt+0x397>
+  800967:	89 c2                	mov    %eax,%edx
+  800969:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096d:	83 c0 08             	add    $0x8,%eax
+  800970:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800973:	4c 63 22             	movslq (%rdx),%r12
+  800976:	eb c7                	jmp    80093f <vprintfmt+0x35e>
+  800978:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800980:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800984:	eb ed                	jmp    800973 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800986:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800989:	83 f8 2f             	cmp    $0x2f,%eax
+  80098c:	77 11                	ja     80099f <vprintfmt+0x3be>
+  80098e:	89 c2                	mov    %eax,%edx
+  800990:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800994:	83 c0 08             	add    $0x8,%eax
+  800997:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099a:	4c 8b 22             	mov    (%rdx),%r12
+  80099d:	eb a0                	jmp    80093f <vprintfmt+0x35e>
+  80099f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ab:	eb ed                	jmp    80099a <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8009ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b9:	e9 65 ff ff ff       	jmp    800923 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8009be:	4c 89 ee             	mov    %r13,%rsi
+  8009c1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009c6:	41 ff d6             	call   *%r14
+                i = -i;
+  8009c9:	49 f7 dc             	neg    %r12
+  8009cc:	e9 73 ff ff ff       	jmp    800944 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d1:	40 84 f6             	test   %sil,%sil
+  8009d4:	75 32                	jne    800a08 <vprintfmt+0x427>
+    switch (lflag) {
+  8009d6:	85 d2                	test   %edx,%edx
+  8009d8:	74 5d                	je     800a37 <vprintfmt+0x456>
+  8009da:	83 fa 01             	cmp    $0x1,%edx
+  8009dd:	0f 84 82 00 00 00    	je     800a65 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8009e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e9:	0f 87 a5 00 00 00    	ja     800a94 <vprintfmt+0x4b3>
+  8009ef:	89 c2                	mov    %eax,%edx
+  8009f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f5:	83 c0 08             	add    $0x8,%eax
+  8009f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009fe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a03:	e9 99 01 00 00       	jmp    800ba1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a08:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0e:	77 19                	ja     800a29 <vprintfmt+0x448>
+  800a10:	89 c2                	mov    %eax,%edx
+  800a12:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a16:	83 c0 08             	add    $0x8,%eax
+  800a19:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a1c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a1f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a24:	e9 78 01 00 00       	jmp    800ba1 <vprintfmt+0x5c0>
+  800a29:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a31:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a35:	eb e5                	jmp    800a1c <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a37:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a3a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3d:	77 18                	ja     800a57 <vprintfmt+0x476>
+  800a3f:	89 c2                	mov    %eax,%edx
+  800a41:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a45:	83 c0 08             	add    $0x8,%eax
+  800a48:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4b:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a4d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a52:	e9 4a 01 00 00       	jmp    800ba1 <vprintfmt+0x5c0>
+  800a57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a63:	eb e6                	jmp    800a4b <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a68:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6b:	77 19                	ja     800a86 <vprintfmt+0x4a5>
+  800a6d:	89 c2                	mov    %eax,%edx
+  800a6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a73:	83 c0 08             	add    $0x8,%eax
+  800a76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a79:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a7c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a81:	e9 1b 01 00 00       	jmp    800ba1 <vprintfmt+0x5c0>
+  800a86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a92:	eb e5                	jmp    800a79 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a98:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa0:	e9 56 ff ff ff       	jmp    8009fb <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa5:	40 84 f6             	test   %sil,%sil
+  800aa8:	75 2e                	jne    800ad8 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800aaa:	85 d2                	test   %edx,%edx
+  800aac:	74 59                	je     800b07 <vprintfmt+0x526>
+  800aae:	83 fa 01             	cmp    $0x1,%edx
+  800ab1:	74 7f                	je     800b32 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800ab3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab9:	0f 87 9f 00 00 00    	ja     800b5e <vprintfmt+0x57d>
+  800abf:	89 c2                	mov    %eax,%edx
+  800ac1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac5:	83 c0 08             	add    $0x8,%eax
+  800ac8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800acb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ace:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ad3:	e9 c9 00 00 00       	jmp    800ba1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ad8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800adb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ade:	77 19                	ja     800af9 <vprintfmt+0x518>
+  800ae0:	89 c2                	mov    %eax,%edx
+  800ae2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae6:	83 c0 08             	add    $0x8,%eax
+  800ae9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800aef:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800af4:	e9 a8 00 00 00       	jmp    800ba1 <vprintfmt+0x5c0>
+  800af9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b05:	eb e5                	jmp    800aec <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0d:	77 15                	ja     800b24 <vprintfmt+0x543>
+  800b0f:	89 c2                	mov    %eax,%edx
+  800b11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b15:	83 c0 08             	add    $0x8,%eax
+  800b18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1b:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b1d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b22:	eb 7d                	jmp    800ba1 <vprintfmt+0x5c0>
+  800b24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b30:	eb e9                	jmp    800b1b <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b35:	83 f8 2f             	cmp    $0x2f,%eax
+  800b38:	77 16                	ja     800b50 <vprintfmt+0x56f>
+  800b3a:	89 c2                	mov    %eax,%edx
+  800b3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b40:	83 c0 08             	add    $0x8,%eax
+  800b43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b46:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b49:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b4e:	eb 51                	jmp    800ba1 <vprintfmt+0x5c0>
+  800b50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b5c:	eb e8                	jmp    800b46 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6a:	e9 5c ff ff ff       	jmp    800acb <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b6f:	4c 89 ee             	mov    %r13,%rsi
+  800b72:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b77:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b7a:	4c 89 ee             	mov    %r13,%rsi
+  800b7d:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b82:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b88:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8b:	77 47                	ja     800bd4 <vprintfmt+0x5f3>
+  800b8d:	89 c2                	mov    %eax,%edx
+  800b8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b93:	83 c0 08             	add    $0x8,%eax
+  800b96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b99:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b9c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ba1:	48 83 ec 08          	sub    $0x8,%rsp
+  800ba5:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ba9:	0f 94 c0             	sete   %al
+  800bac:	0f b6 c0             	movzbl %al,%eax
+  800baf:	50                   	push   %rax
+  800bb0:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800bb5:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800bb9:	4c 89 ee             	mov    %r13,%rsi
+  800bbc:	4c 89 f7             	mov    %r14,%rdi
+  800bbf:	48 b8 d6 04 80 00 00 	movabs $0x8004d6,%rax
+  800bc6:	00 00 00 
+  800bc9:	ff d0                	call   *%rax
+            break;
+  800bcb:	48 83 c4 10          	add    $0x10,%rsp
+  800bcf:	e9 3e fa ff ff       	jmp    800612 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800bd4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bdc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be0:	eb b7                	jmp    800b99 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800be2:	40 84 f6             	test   %sil,%sil
+  800be5:	75 2b                	jne    800c12 <vprintfmt+0x631>
+    switch (lflag) {
+  800be7:	85 d2                	test   %edx,%edx
+  800be9:	74 56                	je     800c41 <vprintfmt+0x660>
+  800beb:	83 fa 01             	cmp    $0x1,%edx
+  800bee:	74 7f                	je     800c6f <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800bf0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf3:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf6:	0f 87 a2 00 00 00    	ja     800c9e <vprintfmt+0x6bd>
+  800bfc:	89 c2                	mov    %eax,%edx
+  800bfe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c02:	83 c0 08             	add    $0x8,%eax
+  800c05:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c08:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c0b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c10:	eb 8f                	jmp    800ba1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c15:	83 f8 2f             	cmp    $0x2f,%eax
+  800c18:	77 19                	ja     800c33 <vprintfmt+0x652>
+  800c1a:	89 c2                	mov    %eax,%edx
+  800c1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c20:	83 c0 08             	add    $0x8,%eax
+  800c23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c26:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c29:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c2e:	e9 6e ff ff ff       	jmp    800ba1 <vprintfmt+0x5c0>
+  800c33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3f:	eb e5                	jmp    800c26 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c41:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c44:	83 f8 2f             	cmp    $0x2f,%eax
+  800c47:	77 18                	ja     800c61 <vprintfmt+0x680>
+  800c49:	89 c2                	mov    %eax,%edx
+  800c4b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c4f:	83 c0 08             	add    $0x8,%eax
+  800c52:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c55:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c57:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c5c:	e9 40 ff ff ff       	jmp    800ba1 <vprintfmt+0x5c0>
+  800c61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c6d:	eb e6                	jmp    800c55 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c72:	83 f8 2f             	cmp    $0x2f,%eax
+  800c75:	77 19                	ja     800c90 <vprintfmt+0x6af>
+  800c77:	89 c2                	mov    %eax,%edx
+  800c79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7d:	83 c0 08             	add    $0x8,%eax
+  800c80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c83:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c86:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c8b:	e9 11 ff ff ff       	jmp    800ba1 <vprintfmt+0x5c0>
+  800c90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c9c:	eb e5                	jmp    800c83 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800caa:	e9 59 ff ff ff       	jmp    800c08 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800caf:	4c 89 ee             	mov    %r13,%rsi
+  800cb2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cb7:	41 ff d6             	call   *%r14
+            break;
+  800cba:	e9 53 f9 ff ff       	jmp    800612 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800cbf:	4c 89 ee             	mov    %r13,%rsi
+  800cc2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cc7:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800cca:	48 83 eb 01          	sub    $0x1,%rbx
+  800cce:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800cd2:	75 f6                	jne    800cca <vprintfmt+0x6e9>
+  800cd4:	e9 39 f9 ff ff       	jmp    800612 <vprintfmt+0x31>
+}
+  800cd9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800cdd:	5b                   	pop    %rbx
+  800cde:	41 5c                	pop    %r12
+  800ce0:	41 5d                	pop    %r13
+  800ce2:	41 5e                	pop    %r14
+  800ce4:	41 5f                	pop    %r15
+  800ce6:	5d                   	pop    %rbp
+  800ce7:	c3                   	ret
+
+0000000000800ce8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ce8:	55                   	push   %rbp
+  800ce9:	48 89 e5             	mov    %rsp,%rbp
+  800cec:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800cf0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800cf4:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800cf9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800cfd:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d04:	48 85 ff             	test   %rdi,%rdi
+  800d07:	74 2b                	je     800d34 <vsnprintf+0x4c>
+  800d09:	48 85 f6             	test   %rsi,%rsi
+  800d0c:	74 26                	je     800d34 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d0e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d12:	48 bf 8c 05 80 00 00 	movabs $0x80058c,%rdi
+  800d19:	00 00 00 
+  800d1c:	48 b8 e1 05 80 00 00 	movabs $0x8005e1,%rax
+  800d23:	00 00 00 
+  800d26:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d2c:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d2f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d32:	c9                   	leave
+  800d33:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d39:	eb f7                	jmp    800d32 <vsnprintf+0x4a>
+
+0000000000800d3b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d3b:	55                   	push   %rbp
+  800d3c:	48 89 e5             	mov    %rsp,%rbp
+  800d3f:	48 83 ec 50          	sub    $0x50,%rsp
+  800d43:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d47:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d4b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d4f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d56:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d5e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d62:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d66:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d6a:	48 b8 e8 0c 80 00 00 	movabs $0x800ce8,%rax
+  800d71:	00 00 00 
+  800d74:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d76:	c9                   	leave
+  800d77:	c3                   	ret
+
+0000000000800d78 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d78:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d7b:	74 10                	je     800d8d <strlen+0x15>
+    size_t n = 0;
+  800d7d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d82:	48 83 c0 01          	add    $0x1,%rax
+  800d86:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d8a:	75 f6                	jne    800d82 <strlen+0xa>
+  800d8c:	c3                   	ret
+    size_t n = 0;
+  800d8d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d92:	c3                   	ret
+
+0000000000800d93 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d93:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d96:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d9b:	48 85 f6             	test   %rsi,%rsi
+  800d9e:	74 11                	je     800db1 <strnlen+0x1e>
+  800da0:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800da4:	74 0c                	je     800db2 <strnlen+0x1f>
+  800da6:	48 83 c2 01          	add    $0x1,%rdx
+  800daa:	48 39 d0             	cmp    %rdx,%rax
+  800dad:	75 f1                	jne    800da0 <strnlen+0xd>
+  800daf:	eb 04                	jmp    800db5 <strnlen+0x22>
+  800db1:	c3                   	ret
+  800db2:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800db5:	c3                   	ret
+
+0000000000800db6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800db6:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800db9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbe:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800dc2:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800dc5:	48 83 c2 01          	add    $0x1,%rdx
+  800dc9:	84 c9                	test   %cl,%cl
+  800dcb:	75 f1                	jne    800dbe <strcpy+0x8>
+        ;
+    return res;
+}
+  800dcd:	c3                   	ret
+
+0000000000800dce <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800dce:	55                   	push   %rbp
+  800dcf:	48 89 e5             	mov    %rsp,%rbp
+  800dd2:	41 54                	push   %r12
+  800dd4:	53                   	push   %rbx
+  800dd5:	48 89 fb             	mov    %rdi,%rbx
+  800dd8:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ddb:	48 b8 78 0d 80 00 00 	movabs $0x800d78,%rax
+  800de2:	00 00 00 
+  800de5:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800de7:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800deb:	4c 89 e6             	mov    %r12,%rsi
+  800dee:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  800df5:	00 00 00 
+  800df8:	ff d0                	call   *%rax
+    return dst;
+}
+  800dfa:	48 89 d8             	mov    %rbx,%rax
+  800dfd:	5b                   	pop    %rbx
+  800dfe:	41 5c                	pop    %r12
+  800e00:	5d                   	pop    %rbp
+  800e01:	c3                   	ret
+
+0000000000800e02 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e02:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e05:	48 85 d2             	test   %rdx,%rdx
+  800e08:	74 1f                	je     800e29 <strncpy+0x27>
+  800e0a:	48 01 fa             	add    %rdi,%rdx
+  800e0d:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e10:	48 83 c1 01          	add    $0x1,%rcx
+  800e14:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e18:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e1c:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e20:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e24:	48 39 ca             	cmp    %rcx,%rdx
+  800e27:	75 e7                	jne    800e10 <strncpy+0xe>
+    }
+    return ret;
+}
+  800e29:	c3                   	ret
+
+0000000000800e2a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e2a:	48 89 f8             	mov    %rdi,%rax
+  800e2d:	48 85 d2             	test   %rdx,%rdx
+  800e30:	74 24                	je     800e56 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e32:	48 83 ea 01          	sub    $0x1,%rdx
+  800e36:	74 1b                	je     800e53 <strlcpy+0x29>
+  800e38:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e3c:	0f b6 16             	movzbl (%rsi),%edx
+  800e3f:	84 d2                	test   %dl,%dl
+  800e41:	74 10                	je     800e53 <strlcpy+0x29>
+            *dst++ = *src++;
+  800e43:	48 83 c6 01          	add    $0x1,%rsi
+  800e47:	48 83 c0 01          	add    $0x1,%rax
+  800e4b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e4e:	48 39 c8             	cmp    %rcx,%rax
+  800e51:	75 e9                	jne    800e3c <strlcpy+0x12>
+        *dst = '\0';
+  800e53:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e56:	48 29 f8             	sub    %rdi,%rax
+}
+  800e59:	c3                   	ret
+
+0000000000800e5a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e5a:	0f b6 07             	movzbl (%rdi),%eax
+  800e5d:	84 c0                	test   %al,%al
+  800e5f:	74 13                	je     800e74 <strcmp+0x1a>
+  800e61:	38 06                	cmp    %al,(%rsi)
+  800e63:	75 0f                	jne    800e74 <strcmp+0x1a>
+  800e65:	48 83 c7 01          	add    $0x1,%rdi
+  800e69:	48 83 c6 01          	add    $0x1,%rsi
+  800e6d:	0f b6 07             	movzbl (%rdi),%eax
+  800e70:	84 c0                	test   %al,%al
+  800e72:	75 ed                	jne    800e61 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e74:	0f b6 c0             	movzbl %al,%eax
+  800e77:	0f b6 16             	movzbl (%rsi),%edx
+  800e7a:	29 d0                	sub    %edx,%eax
+}
+  800e7c:	c3                   	ret
+
+0000000000800e7d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e7d:	48 85 d2             	test   %rdx,%rdx
+  800e80:	74 1f                	je     800ea1 <strncmp+0x24>
+  800e82:	0f b6 07             	movzbl (%rdi),%eax
+  800e85:	84 c0                	test   %al,%al
+  800e87:	74 1e                	je     800ea7 <strncmp+0x2a>
+  800e89:	3a 06                	cmp    (%rsi),%al
+  800e8b:	75 1a                	jne    800ea7 <strncmp+0x2a>
+  800e8d:	48 83 c7 01          	add    $0x1,%rdi
+  800e91:	48 83 c6 01          	add    $0x1,%rsi
+  800e95:	48 83 ea 01          	sub    $0x1,%rdx
+  800e99:	75 e7                	jne    800e82 <strncmp+0x5>
+
+    if (!n) return 0;
+  800e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea0:	c3                   	ret
+  800ea1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea6:	c3                   	ret
+  800ea7:	48 85 d2             	test   %rdx,%rdx
+  800eaa:	74 09                	je     800eb5 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800eac:	0f b6 07             	movzbl (%rdi),%eax
+  800eaf:	0f b6 16             	movzbl (%rsi),%edx
+  800eb2:	29 d0                	sub    %edx,%eax
+  800eb4:	c3                   	ret
+    if (!n) return 0;
+  800eb5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800eba:	c3                   	ret
+
+0000000000800ebb <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ebb:	0f b6 17             	movzbl (%rdi),%edx
+  800ebe:	84 d2                	test   %dl,%dl
+  800ec0:	74 18                	je     800eda <strchr+0x1f>
+        if (*str == c) {
+  800ec2:	0f be d2             	movsbl %dl,%edx
+  800ec5:	39 f2                	cmp    %esi,%edx
+  800ec7:	74 17                	je     800ee0 <strchr+0x25>
+    for (; *str; str++) {
+  800ec9:	48 83 c7 01          	add    $0x1,%rdi
+  800ecd:	0f b6 17             	movzbl (%rdi),%edx
+  800ed0:	84 d2                	test   %dl,%dl
+  800ed2:	75 ee                	jne    800ec2 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ed4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed9:	c3                   	ret
+  800eda:	b8 00 00 00 00       	mov    $0x0,%eax
+  800edf:	c3                   	ret
+  800ee0:	48 89 f8             	mov    %rdi,%rax
+}
+  800ee3:	c3                   	ret
+
+0000000000800ee4 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800ee4:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800ee7:	0f b6 17             	movzbl (%rdi),%edx
+  800eea:	84 d2                	test   %dl,%dl
+  800eec:	74 13                	je     800f01 <strfind+0x1d>
+  800eee:	0f be d2             	movsbl %dl,%edx
+  800ef1:	39 f2                	cmp    %esi,%edx
+  800ef3:	74 0b                	je     800f00 <strfind+0x1c>
+  800ef5:	48 83 c0 01          	add    $0x1,%rax
+  800ef9:	0f b6 10             	movzbl (%rax),%edx
+  800efc:	84 d2                	test   %dl,%dl
+  800efe:	75 ee                	jne    800eee <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f00:	c3                   	ret
+  800f01:	c3                   	ret
+
+0000000000800f02 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f02:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f05:	48 89 f8             	mov    %rdi,%rax
+  800f08:	48 f7 d8             	neg    %rax
+  800f0b:	83 e0 07             	and    $0x7,%eax
+  800f0e:	49 89 d1             	mov    %rdx,%r9
+  800f11:	49 29 c1             	sub    %rax,%r9
+  800f14:	78 36                	js     800f4c <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f16:	40 0f b6 c6          	movzbl %sil,%eax
+  800f1a:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f21:	01 01 01 
+  800f24:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f28:	40 f6 c7 07          	test   $0x7,%dil
+  800f2c:	75 38                	jne    800f66 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f2e:	4c 89 c9             	mov    %r9,%rcx
+  800f31:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f35:	74 0c                	je     800f43 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f37:	fc                   	cld
+  800f38:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f3b:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f3f:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f43:	4d 85 c9             	test   %r9,%r9
+  800f46:	75 45                	jne    800f8d <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f48:	4c 89 c0             	mov    %r8,%rax
+  800f4b:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f4c:	48 85 d2             	test   %rdx,%rdx
+  800f4f:	74 f7                	je     800f48 <memset+0x46>
+  800f51:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f54:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f57:	48 83 c0 01          	add    $0x1,%rax
+  800f5b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f5f:	48 39 c2             	cmp    %rax,%rdx
+  800f62:	75 f3                	jne    800f57 <memset+0x55>
+  800f64:	eb e2                	jmp    800f48 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f66:	40 f6 c7 01          	test   $0x1,%dil
+  800f6a:	74 06                	je     800f72 <memset+0x70>
+  800f6c:	88 07                	mov    %al,(%rdi)
+  800f6e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f72:	40 f6 c7 02          	test   $0x2,%dil
+  800f76:	74 07                	je     800f7f <memset+0x7d>
+  800f78:	66 89 07             	mov    %ax,(%rdi)
+  800f7b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f7f:	40 f6 c7 04          	test   $0x4,%dil
+  800f83:	74 a9                	je     800f2e <memset+0x2c>
+  800f85:	89 07                	mov    %eax,(%rdi)
+  800f87:	48 83 c7 04          	add    $0x4,%rdi
+  800f8b:	eb a1                	jmp    800f2e <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f8d:	41 f6 c1 04          	test   $0x4,%r9b
+  800f91:	74 06                	je     800f99 <memset+0x97>
+  800f93:	89 07                	mov    %eax,(%rdi)
+  800f95:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f99:	41 f6 c1 02          	test   $0x2,%r9b
+  800f9d:	74 07                	je     800fa6 <memset+0xa4>
+  800f9f:	66 89 07             	mov    %ax,(%rdi)
+  800fa2:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800fa6:	41 f6 c1 01          	test   $0x1,%r9b
+  800faa:	74 9c                	je     800f48 <memset+0x46>
+  800fac:	88 07                	mov    %al,(%rdi)
+  800fae:	eb 98                	jmp    800f48 <memset+0x46>
+
+0000000000800fb0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800fb0:	48 89 f8             	mov    %rdi,%rax
+  800fb3:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800fb6:	48 39 fe             	cmp    %rdi,%rsi
+  800fb9:	73 3b                	jae    800ff6 <memmove+0x46>
+  800fbb:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800fbf:	48 39 d7             	cmp    %rdx,%rdi
+  800fc2:	73 32                	jae    800ff6 <memmove+0x46>
+        s += n;
+        d += n;
+  800fc4:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fc8:	48 89 d6             	mov    %rdx,%rsi
+  800fcb:	48 09 fe             	or     %rdi,%rsi
+  800fce:	48 09 ce             	or     %rcx,%rsi
+  800fd1:	40 f6 c6 07          	test   $0x7,%sil
+  800fd5:	75 12                	jne    800fe9 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fd7:	48 83 ef 08          	sub    $0x8,%rdi
+  800fdb:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fdf:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fe3:	fd                   	std
+  800fe4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800fe7:	fc                   	cld
+  800fe8:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800fe9:	48 83 ef 01          	sub    $0x1,%rdi
+  800fed:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ff1:	fd                   	std
+  800ff2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800ff4:	eb f1                	jmp    800fe7 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ff6:	48 89 f2             	mov    %rsi,%rdx
+  800ff9:	48 09 c2             	or     %rax,%rdx
+  800ffc:	48 09 ca             	or     %rcx,%rdx
+  800fff:	f6 c2 07             	test   $0x7,%dl
+  801002:	75 0c                	jne    801010 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801004:	48 c1 e9 03          	shr    $0x3,%rcx
+  801008:	48 89 c7             	mov    %rax,%rdi
+  80100b:	fc                   	cld
+  80100c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80100f:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801010:	48 89 c7             	mov    %rax,%rdi
+  801013:	fc                   	cld
+  801014:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801016:	c3                   	ret
+
+0000000000801017 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801017:	55                   	push   %rbp
+  801018:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80101b:	48 b8 b0 0f 80 00 00 	movabs $0x800fb0,%rax
+  801022:	00 00 00 
+  801025:	ff d0                	call   *%rax
+}
+  801027:	5d                   	pop    %rbp
+  801028:	c3                   	ret
+
+0000000000801029 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801029:	55                   	push   %rbp
+  80102a:	48 89 e5             	mov    %rsp,%rbp
+  80102d:	41 57                	push   %r15
+  80102f:	41 56                	push   %r14
+  801031:	41 55                	push   %r13
+  801033:	41 54                	push   %r12
+  801035:	53                   	push   %rbx
+  801036:	48 83 ec 08          	sub    $0x8,%rsp
+  80103a:	49 89 fe             	mov    %rdi,%r14
+  80103d:	49 89 f7             	mov    %rsi,%r15
+  801040:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801043:	48 89 f7             	mov    %rsi,%rdi
+  801046:	48 b8 78 0d 80 00 00 	movabs $0x800d78,%rax
+  80104d:	00 00 00 
+  801050:	ff d0                	call   *%rax
+  801052:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801055:	48 89 de             	mov    %rbx,%rsi
+  801058:	4c 89 f7             	mov    %r14,%rdi
+  80105b:	48 b8 93 0d 80 00 00 	movabs $0x800d93,%rax
+  801062:	00 00 00 
+  801065:	ff d0                	call   *%rax
+  801067:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80106a:	48 39 c3             	cmp    %rax,%rbx
+  80106d:	74 36                	je     8010a5 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80106f:	48 89 d8             	mov    %rbx,%rax
+  801072:	4c 29 e8             	sub    %r13,%rax
+  801075:	49 39 c4             	cmp    %rax,%r12
+  801078:	73 31                	jae    8010ab <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80107a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80107f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801083:	4c 89 fe             	mov    %r15,%rsi
+  801086:	48 b8 17 10 80 00 00 	movabs $0x801017,%rax
+  80108d:	00 00 00 
+  801090:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801092:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801096:	48 83 c4 08          	add    $0x8,%rsp
+  80109a:	5b                   	pop    %rbx
+  80109b:	41 5c                	pop    %r12
+  80109d:	41 5d                	pop    %r13
+  80109f:	41 5e                	pop    %r14
+  8010a1:	41 5f                	pop    %r15
+  8010a3:	5d                   	pop    %rbp
+  8010a4:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010a5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010a9:	eb eb                	jmp    801096 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8010ab:	48 83 eb 01          	sub    $0x1,%rbx
+  8010af:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010b3:	48 89 da             	mov    %rbx,%rdx
+  8010b6:	4c 89 fe             	mov    %r15,%rsi
+  8010b9:	48 b8 17 10 80 00 00 	movabs $0x801017,%rax
+  8010c0:	00 00 00 
+  8010c3:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8010c5:	49 01 de             	add    %rbx,%r14
+  8010c8:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8010cd:	eb c3                	jmp    801092 <strlcat+0x69>
+
+00000000008010cf <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8010cf:	48 85 d2             	test   %rdx,%rdx
+  8010d2:	74 2d                	je     801101 <memcmp+0x32>
+  8010d4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010d9:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010dd:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010e2:	44 38 c1             	cmp    %r8b,%cl
+  8010e5:	75 0f                	jne    8010f6 <memcmp+0x27>
+    while (n-- > 0) {
+  8010e7:	48 83 c0 01          	add    $0x1,%rax
+  8010eb:	48 39 c2             	cmp    %rax,%rdx
+  8010ee:	75 e9                	jne    8010d9 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f5:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010f6:	0f b6 c1             	movzbl %cl,%eax
+  8010f9:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010fd:	44 29 c0             	sub    %r8d,%eax
+  801100:	c3                   	ret
+    return 0;
+  801101:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801106:	c3                   	ret
+
+0000000000801107 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801107:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80110b:	48 39 c7             	cmp    %rax,%rdi
+  80110e:	73 0f                	jae    80111f <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801110:	40 38 37             	cmp    %sil,(%rdi)
+  801113:	74 0e                	je     801123 <memfind+0x1c>
+    for (; src < end; src++) {
+  801115:	48 83 c7 01          	add    $0x1,%rdi
+  801119:	48 39 f8             	cmp    %rdi,%rax
+  80111c:	75 f2                	jne    801110 <memfind+0x9>
+  80111e:	c3                   	ret
+  80111f:	48 89 f8             	mov    %rdi,%rax
+  801122:	c3                   	ret
+  801123:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801126:	c3                   	ret
+
+0000000000801127 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801127:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80112a:	0f b6 37             	movzbl (%rdi),%esi
+  80112d:	40 80 fe 20          	cmp    $0x20,%sil
+  801131:	74 06                	je     801139 <strtol+0x12>
+  801133:	40 80 fe 09          	cmp    $0x9,%sil
+  801137:	75 13                	jne    80114c <strtol+0x25>
+  801139:	48 83 c7 01          	add    $0x1,%rdi
+  80113d:	0f b6 37             	movzbl (%rdi),%esi
+  801140:	40 80 fe 20          	cmp    $0x20,%sil
+  801144:	74 f3                	je     801139 <strtol+0x12>
+  801146:	40 80 fe 09          	cmp    $0x9,%sil
+  80114a:	74 ed                	je     801139 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80114c:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80114f:	83 e0 fd             	and    $0xfffffffd,%eax
+  801152:	3c 01                	cmp    $0x1,%al
+  801154:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801158:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80115e:	75 0f                	jne    80116f <strtol+0x48>
+  801160:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801163:	74 14                	je     801179 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801165:	85 d2                	test   %edx,%edx
+  801167:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80116c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80116f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801174:	4c 63 ca             	movslq %edx,%r9
+  801177:	eb 36                	jmp    8011af <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801179:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80117d:	74 0f                	je     80118e <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80117f:	85 d2                	test   %edx,%edx
+  801181:	75 ec                	jne    80116f <strtol+0x48>
+        s++;
+  801183:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801187:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80118c:	eb e1                	jmp    80116f <strtol+0x48>
+        s += 2;
+  80118e:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801192:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801197:	eb d6                	jmp    80116f <strtol+0x48>
+            dig -= '0';
+  801199:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80119c:	44 0f b6 c1          	movzbl %cl,%r8d
+  8011a0:	41 39 d0             	cmp    %edx,%r8d
+  8011a3:	7d 21                	jge    8011c6 <strtol+0x9f>
+        val = val * base + dig;
+  8011a5:	49 0f af c1          	imul   %r9,%rax
+  8011a9:	0f b6 c9             	movzbl %cl,%ecx
+  8011ac:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8011af:	48 83 c7 01          	add    $0x1,%rdi
+  8011b3:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8011b7:	80 f9 39             	cmp    $0x39,%cl
+  8011ba:	76 dd                	jbe    801199 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8011bc:	80 f9 7b             	cmp    $0x7b,%cl
+  8011bf:	77 05                	ja     8011c6 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8011c1:	83 e9 57             	sub    $0x57,%ecx
+  8011c4:	eb d6                	jmp    80119c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8011c6:	4d 85 d2             	test   %r10,%r10
+  8011c9:	74 03                	je     8011ce <strtol+0xa7>
+  8011cb:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8011ce:	48 89 c2             	mov    %rax,%rdx
+  8011d1:	48 f7 da             	neg    %rdx
+  8011d4:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011d8:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011dc:	c3                   	ret
+
+00000000008011dd <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011dd:	55                   	push   %rbp
+  8011de:	48 89 e5             	mov    %rsp,%rbp
+  8011e1:	53                   	push   %rbx
+  8011e2:	48 89 fa             	mov    %rdi,%rdx
+  8011e5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011e8:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801202:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801204:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801208:	c9                   	leave
+  801209:	c3                   	ret
+
+000000000080120a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80120a:	55                   	push   %rbp
+  80120b:	48 89 e5             	mov    %rsp,%rbp
+  80120e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80120f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801214:	ba 00 00 00 00       	mov    $0x0,%edx
+  801219:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80121e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801223:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801228:	be 00 00 00 00       	mov    $0x0,%esi
+  80122d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801233:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801235:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801239:	c9                   	leave
+  80123a:	c3                   	ret
+
+000000000080123b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80123b:	55                   	push   %rbp
+  80123c:	48 89 e5             	mov    %rsp,%rbp
+  80123f:	53                   	push   %rbx
+  801240:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801244:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801247:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80124c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801251:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801256:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80125b:	be 00 00 00 00       	mov    $0x0,%esi
+  801260:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801266:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801268:	48 85 c0             	test   %rax,%rax
+  80126b:	7f 06                	jg     801273 <sys_env_destroy+0x38>
+}
+  80126d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801271:	c9                   	leave
+  801272:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801273:	49 89 c0             	mov    %rax,%r8
+  801276:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80127b:	48 ba 90 3d 80 00 00 	movabs $0x803d90,%rdx
+  801282:	00 00 00 
+  801285:	be 26 00 00 00       	mov    $0x26,%esi
+  80128a:	48 bf af 3d 80 00 00 	movabs $0x803daf,%rdi
+  801291:	00 00 00 
+  801294:	b8 00 00 00 00       	mov    $0x0,%eax
+  801299:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  8012a0:	00 00 00 
+  8012a3:	41 ff d1             	call   *%r9
+
+00000000008012a6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8012a6:	55                   	push   %rbp
+  8012a7:	48 89 e5             	mov    %rsp,%rbp
+  8012aa:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ab:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012cf:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d5:	c9                   	leave
+  8012d6:	c3                   	ret
+
+00000000008012d7 <sys_yield>:
+
+void
+sys_yield(void) {
+  8012d7:	55                   	push   %rbp
+  8012d8:	48 89 e5             	mov    %rsp,%rbp
+  8012db:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012dc:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801300:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801302:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801306:	c9                   	leave
+  801307:	c3                   	ret
+
+0000000000801308 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801308:	55                   	push   %rbp
+  801309:	48 89 e5             	mov    %rsp,%rbp
+  80130c:	53                   	push   %rbx
+  80130d:	48 89 fa             	mov    %rdi,%rdx
+  801310:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801313:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801318:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80131f:	00 00 00 
+  801322:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801327:	be 00 00 00 00       	mov    $0x0,%esi
+  80132c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801332:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801334:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801338:	c9                   	leave
+  801339:	c3                   	ret
+
+000000000080133a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80133a:	55                   	push   %rbp
+  80133b:	48 89 e5             	mov    %rsp,%rbp
+  80133e:	53                   	push   %rbx
+  80133f:	49 89 f8             	mov    %rdi,%r8
+  801342:	48 89 d3             	mov    %rdx,%rbx
+  801345:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801348:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80134d:	4c 89 c2             	mov    %r8,%rdx
+  801350:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801353:	be 00 00 00 00       	mov    $0x0,%esi
+  801358:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80135e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801360:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801364:	c9                   	leave
+  801365:	c3                   	ret
+
+0000000000801366 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801366:	55                   	push   %rbp
+  801367:	48 89 e5             	mov    %rsp,%rbp
+  80136a:	53                   	push   %rbx
+  80136b:	48 83 ec 08          	sub    $0x8,%rsp
+  80136f:	89 f8                	mov    %edi,%eax
+  801371:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801374:	48 63 f9             	movslq %ecx,%rdi
+  801377:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80137a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80137f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801382:	be 00 00 00 00       	mov    $0x0,%esi
+  801387:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80138d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80138f:	48 85 c0             	test   %rax,%rax
+  801392:	7f 06                	jg     80139a <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801394:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801398:	c9                   	leave
+  801399:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80139a:	49 89 c0             	mov    %rax,%r8
+  80139d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013a2:	48 ba 90 3d 80 00 00 	movabs $0x803d90,%rdx
+  8013a9:	00 00 00 
+  8013ac:	be 26 00 00 00       	mov    $0x26,%esi
+  8013b1:	48 bf af 3d 80 00 00 	movabs $0x803daf,%rdi
+  8013b8:	00 00 00 
+  8013bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c0:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  8013c7:	00 00 00 
+  8013ca:	41 ff d1             	call   *%r9
+
+00000000008013cd <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013cd:	55                   	push   %rbp
+  8013ce:	48 89 e5             	mov    %rsp,%rbp
+  8013d1:	53                   	push   %rbx
+  8013d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d6:	89 f8                	mov    %edi,%eax
+  8013d8:	49 89 f2             	mov    %rsi,%r10
+  8013db:	48 89 cf             	mov    %rcx,%rdi
+  8013de:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013e1:	48 63 da             	movslq %edx,%rbx
+  8013e4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013e7:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013ec:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ef:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013f2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013f4:	48 85 c0             	test   %rax,%rax
+  8013f7:	7f 06                	jg     8013ff <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013fd:	c9                   	leave
+  8013fe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ff:	49 89 c0             	mov    %rax,%r8
+  801402:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801407:	48 ba 90 3d 80 00 00 	movabs $0x803d90,%rdx
+  80140e:	00 00 00 
+  801411:	be 26 00 00 00       	mov    $0x26,%esi
+  801416:	48 bf af 3d 80 00 00 	movabs $0x803daf,%rdi
+  80141d:	00 00 00 
+  801420:	b8 00 00 00 00       	mov    $0x0,%eax
+  801425:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  80142c:	00 00 00 
+  80142f:	41 ff d1             	call   *%r9
+
+0000000000801432 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801432:	55                   	push   %rbp
+  801433:	48 89 e5             	mov    %rsp,%rbp
+  801436:	53                   	push   %rbx
+  801437:	48 83 ec 08          	sub    $0x8,%rsp
+  80143b:	48 89 f1             	mov    %rsi,%rcx
+  80143e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801441:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801444:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801449:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80144e:	be 00 00 00 00       	mov    $0x0,%esi
+  801453:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801459:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80145b:	48 85 c0             	test   %rax,%rax
+  80145e:	7f 06                	jg     801466 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801460:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801464:	c9                   	leave
+  801465:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801466:	49 89 c0             	mov    %rax,%r8
+  801469:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80146e:	48 ba 90 3d 80 00 00 	movabs $0x803d90,%rdx
+  801475:	00 00 00 
+  801478:	be 26 00 00 00       	mov    $0x26,%esi
+  80147d:	48 bf af 3d 80 00 00 	movabs $0x803daf,%rdi
+  801484:	00 00 00 
+  801487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148c:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  801493:	00 00 00 
+  801496:	41 ff d1             	call   *%r9
+
+0000000000801499 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801499:	55                   	push   %rbp
+  80149a:	48 89 e5             	mov    %rsp,%rbp
+  80149d:	53                   	push   %rbx
+  80149e:	48 83 ec 08          	sub    $0x8,%rsp
+  8014a2:	89 f8                	mov    %edi,%eax
+  8014a4:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  8014a7:	48 63 f9             	movslq %ecx,%rdi
+  8014aa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ad:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014b2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c2:	48 85 c0             	test   %rax,%rax
+  8014c5:	7f 06                	jg     8014cd <sys_region_advise+0x34>
+}
+  8014c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014cb:	c9                   	leave
+  8014cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014cd:	49 89 c0             	mov    %rax,%r8
+  8014d0:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8014d5:	48 ba 90 3d 80 00 00 	movabs $0x803d90,%rdx
+  8014dc:	00 00 00 
+  8014df:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e4:	48 bf af 3d 80 00 00 	movabs $0x803daf,%rdi
+  8014eb:	00 00 00 
+  8014ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f3:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  8014fa:	00 00 00 
+  8014fd:	41 ff d1             	call   *%r9
+
+0000000000801500 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801500:	55                   	push   %rbp
+  801501:	48 89 e5             	mov    %rsp,%rbp
+  801504:	53                   	push   %rbx
+  801505:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801509:	48 63 ce             	movslq %esi,%rcx
+  80150c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80150f:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801514:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801519:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80151e:	be 00 00 00 00       	mov    $0x0,%esi
+  801523:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801529:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80152b:	48 85 c0             	test   %rax,%rax
+  80152e:	7f 06                	jg     801536 <sys_env_set_nice+0x36>
+}
+  801530:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801534:	c9                   	leave
+  801535:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801536:	49 89 c0             	mov    %rax,%r8
+  801539:	b9 15 00 00 00       	mov    $0x15,%ecx
+  80153e:	48 ba 90 3d 80 00 00 	movabs $0x803d90,%rdx
+  801545:	00 00 00 
+  801548:	be 26 00 00 00       	mov    $0x26,%esi
+  80154d:	48 bf af 3d 80 00 00 	movabs $0x803daf,%rdi
+  801554:	00 00 00 
+  801557:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155c:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  801563:	00 00 00 
+  801566:	41 ff d1             	call   *%r9
+
+0000000000801569 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801569:	55                   	push   %rbp
+  80156a:	48 89 e5             	mov    %rsp,%rbp
+  80156d:	53                   	push   %rbx
+  80156e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801572:	48 63 ce             	movslq %esi,%rcx
+  801575:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801578:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80157d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801582:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801587:	be 00 00 00 00       	mov    $0x0,%esi
+  80158c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801592:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801594:	48 85 c0             	test   %rax,%rax
+  801597:	7f 06                	jg     80159f <sys_env_set_status+0x36>
+}
+  801599:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159d:	c9                   	leave
+  80159e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80159f:	49 89 c0             	mov    %rax,%r8
+  8015a2:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8015a7:	48 ba 90 3d 80 00 00 	movabs $0x803d90,%rdx
+  8015ae:	00 00 00 
+  8015b1:	be 26 00 00 00       	mov    $0x26,%esi
+  8015b6:	48 bf af 3d 80 00 00 	movabs $0x803daf,%rdi
+  8015bd:	00 00 00 
+  8015c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c5:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  8015cc:	00 00 00 
+  8015cf:	41 ff d1             	call   *%r9
+
+00000000008015d2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8015d2:	55                   	push   %rbp
+  8015d3:	48 89 e5             	mov    %rsp,%rbp
+  8015d6:	53                   	push   %rbx
+  8015d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8015db:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8015de:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e1:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015fd:	48 85 c0             	test   %rax,%rax
+  801600:	7f 06                	jg     801608 <sys_env_set_trapframe+0x36>
+}
+  801602:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801606:	c9                   	leave
+  801607:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801608:	49 89 c0             	mov    %rax,%r8
+  80160b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801610:	48 ba 90 3d 80 00 00 	movabs $0x803d90,%rdx
+  801617:	00 00 00 
+  80161a:	be 26 00 00 00       	mov    $0x26,%esi
+  80161f:	48 bf af 3d 80 00 00 	movabs $0x803daf,%rdi
+  801626:	00 00 00 
+  801629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162e:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  801635:	00 00 00 
+  801638:	41 ff d1             	call   *%r9
+
+000000000080163b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80163b:	55                   	push   %rbp
+  80163c:	48 89 e5             	mov    %rsp,%rbp
+  80163f:	53                   	push   %rbx
+  801640:	48 83 ec 08          	sub    $0x8,%rsp
+  801644:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801647:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80164a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80164f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801654:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801659:	be 00 00 00 00       	mov    $0x0,%esi
+  80165e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801664:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801666:	48 85 c0             	test   %rax,%rax
+  801669:	7f 06                	jg     801671 <sys_env_set_pgfault_upcall+0x36>
+}
+  80166b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80166f:	c9                   	leave
+  801670:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801671:	49 89 c0             	mov    %rax,%r8
+  801674:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801679:	48 ba 90 3d 80 00 00 	movabs $0x803d90,%rdx
+  801680:	00 00 00 
+  801683:	be 26 00 00 00       	mov    $0x26,%esi
+  801688:	48 bf af 3d 80 00 00 	movabs $0x803daf,%rdi
+  80168f:	00 00 00 
+  801692:	b8 00 00 00 00       	mov    $0x0,%eax
+  801697:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  80169e:	00 00 00 
+  8016a1:	41 ff d1             	call   *%r9
+
+00000000008016a4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016a4:	55                   	push   %rbp
+  8016a5:	48 89 e5             	mov    %rsp,%rbp
+  8016a8:	53                   	push   %rbx
+  8016a9:	89 f8                	mov    %edi,%eax
+  8016ab:	49 89 f1             	mov    %rsi,%r9
+  8016ae:	48 89 d3             	mov    %rdx,%rbx
+  8016b1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016b4:	49 63 f0             	movslq %r8d,%rsi
+  8016b7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ba:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016bf:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c8:	cd 30                	int    $0x30
+}
+  8016ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ce:	c9                   	leave
+  8016cf:	c3                   	ret
+
+00000000008016d0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8016d0:	55                   	push   %rbp
+  8016d1:	48 89 e5             	mov    %rsp,%rbp
+  8016d4:	53                   	push   %rbx
+  8016d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8016d9:	48 89 fa             	mov    %rdi,%rdx
+  8016dc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016df:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016fb:	48 85 c0             	test   %rax,%rax
+  8016fe:	7f 06                	jg     801706 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801700:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801704:	c9                   	leave
+  801705:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801706:	49 89 c0             	mov    %rax,%r8
+  801709:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80170e:	48 ba 90 3d 80 00 00 	movabs $0x803d90,%rdx
+  801715:	00 00 00 
+  801718:	be 26 00 00 00       	mov    $0x26,%esi
+  80171d:	48 bf af 3d 80 00 00 	movabs $0x803daf,%rdi
+  801724:	00 00 00 
+  801727:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172c:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  801733:	00 00 00 
+  801736:	41 ff d1             	call   *%r9
+
+0000000000801739 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801739:	55                   	push   %rbp
+  80173a:	48 89 e5             	mov    %rsp,%rbp
+  80173d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80173e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801743:	ba 00 00 00 00       	mov    $0x0,%edx
+  801748:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80174d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801752:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801757:	be 00 00 00 00       	mov    $0x0,%esi
+  80175c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801762:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801764:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801768:	c9                   	leave
+  801769:	c3                   	ret
+
+000000000080176a <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  80176a:	55                   	push   %rbp
+  80176b:	48 89 e5             	mov    %rsp,%rbp
+  80176e:	53                   	push   %rbx
+  80176f:	48 83 ec 08          	sub    $0x8,%rsp
+  801773:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801776:	48 63 ce             	movslq %esi,%rcx
+  801779:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80177c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801781:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801786:	be 00 00 00 00       	mov    $0x0,%esi
+  80178b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801791:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801793:	48 85 c0             	test   %rax,%rax
+  801796:	7f 06                	jg     80179e <sys_sigqueue+0x34>
+}
+  801798:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80179c:	c9                   	leave
+  80179d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80179e:	49 89 c0             	mov    %rax,%r8
+  8017a1:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8017a6:	48 ba 90 3d 80 00 00 	movabs $0x803d90,%rdx
+  8017ad:	00 00 00 
+  8017b0:	be 26 00 00 00       	mov    $0x26,%esi
+  8017b5:	48 bf af 3d 80 00 00 	movabs $0x803daf,%rdi
+  8017bc:	00 00 00 
+  8017bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c4:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  8017cb:	00 00 00 
+  8017ce:	41 ff d1             	call   *%r9
+
+00000000008017d1 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8017d1:	55                   	push   %rbp
+  8017d2:	48 89 e5             	mov    %rsp,%rbp
+  8017d5:	53                   	push   %rbx
+  8017d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8017da:	48 89 fa             	mov    %rdi,%rdx
+  8017dd:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e0:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017fa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017fc:	48 85 c0             	test   %rax,%rax
+  8017ff:	7f 06                	jg     801807 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801801:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801805:	c9                   	leave
+  801806:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801807:	49 89 c0             	mov    %rax,%r8
+  80180a:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80180f:	48 ba 90 3d 80 00 00 	movabs $0x803d90,%rdx
+  801816:	00 00 00 
+  801819:	be 26 00 00 00       	mov    $0x26,%esi
+  80181e:	48 bf af 3d 80 00 00 	movabs $0x803daf,%rdi
+  801825:	00 00 00 
+  801828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80182d:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  801834:	00 00 00 
+  801837:	41 ff d1             	call   *%r9
+
+000000000080183a <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  80183a:	55                   	push   %rbp
+  80183b:	48 89 e5             	mov    %rsp,%rbp
+  80183e:	53                   	push   %rbx
+  80183f:	48 83 ec 08          	sub    $0x8,%rsp
+  801843:	48 89 f1             	mov    %rsi,%rcx
+  801846:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801849:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80184c:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801851:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801856:	be 00 00 00 00       	mov    $0x0,%esi
+  80185b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801861:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801863:	48 85 c0             	test   %rax,%rax
+  801866:	7f 06                	jg     80186e <sys_sigaction+0x34>
+}
+  801868:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80186c:	c9                   	leave
+  80186d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80186e:	49 89 c0             	mov    %rax,%r8
+  801871:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801876:	48 ba 90 3d 80 00 00 	movabs $0x803d90,%rdx
+  80187d:	00 00 00 
+  801880:	be 26 00 00 00       	mov    $0x26,%esi
+  801885:	48 bf af 3d 80 00 00 	movabs $0x803daf,%rdi
+  80188c:	00 00 00 
+  80188f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801894:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  80189b:	00 00 00 
+  80189e:	41 ff d1             	call   *%r9
+
+00000000008018a1 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  8018a1:	55                   	push   %rbp
+  8018a2:	48 89 e5             	mov    %rsp,%rbp
+  8018a5:	53                   	push   %rbx
+  8018a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8018aa:	48 89 f1             	mov    %rsi,%rcx
+  8018ad:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  8018b0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018b3:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018b8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018c8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018ca:	48 85 c0             	test   %rax,%rax
+  8018cd:	7f 06                	jg     8018d5 <sys_sigprocmask+0x34>
+}
+  8018cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018d3:	c9                   	leave
+  8018d4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018d5:	49 89 c0             	mov    %rax,%r8
+  8018d8:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8018dd:	48 ba 90 3d 80 00 00 	movabs $0x803d90,%rdx
+  8018e4:	00 00 00 
+  8018e7:	be 26 00 00 00       	mov    $0x26,%esi
+  8018ec:	48 bf af 3d 80 00 00 	movabs $0x803daf,%rdi
+  8018f3:	00 00 00 
+  8018f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018fb:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  801902:	00 00 00 
+  801905:	41 ff d1             	call   *%r9
+
+0000000000801908 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801908:	55                   	push   %rbp
+  801909:	48 89 e5             	mov    %rsp,%rbp
+  80190c:	41 54                	push   %r12
+  80190e:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80190f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801914:	cd 30                	int    $0x30
+  801916:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  801919:	85 c0                	test   %eax,%eax
+  80191b:	78 76                	js     801993 <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  80191d:	74 7c                	je     80199b <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  80191f:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801925:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80192c:	00 00 00 
+  80192f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801934:	89 c2                	mov    %eax,%edx
+  801936:	be 00 00 00 00       	mov    $0x0,%esi
+  80193b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801940:	48 b8 cd 13 80 00 00 	movabs $0x8013cd,%rax
+  801947:	00 00 00 
+  80194a:	ff d0                	call   *%rax
+  80194c:	85 c0                	test   %eax,%eax
+  80194e:	75 7a                	jne    8019ca <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  801950:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801957:	00 00 00 
+  80195a:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801961:	44 89 e7             	mov    %r12d,%edi
+  801964:	48 b8 3b 16 80 00 00 	movabs $0x80163b,%rax
+  80196b:	00 00 00 
+  80196e:	ff d0                	call   *%rax
+  801970:	85 c0                	test   %eax,%eax
+  801972:	75 5e                	jne    8019d2 <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  801974:	be 02 00 00 00       	mov    $0x2,%esi
+  801979:	44 89 e7             	mov    %r12d,%edi
+  80197c:	48 b8 69 15 80 00 00 	movabs $0x801569,%rax
+  801983:	00 00 00 
+  801986:	ff d0                	call   *%rax
+        return -1;
+  801988:	85 c0                	test   %eax,%eax
+  80198a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80198f:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  801993:	44 89 e0             	mov    %r12d,%eax
+  801996:	5b                   	pop    %rbx
+  801997:	41 5c                	pop    %r12
+  801999:	5d                   	pop    %rbp
+  80199a:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  80199b:	48 b8 a6 12 80 00 00 	movabs $0x8012a6,%rax
+  8019a2:	00 00 00 
+  8019a5:	ff d0                	call   *%rax
+  8019a7:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  8019aa:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8019b1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8019b8:	00 00 00 
+  8019bb:	48 01 d0             	add    %rdx,%rax
+  8019be:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8019c5:	00 00 00 
+        return 0;
+  8019c8:	eb c9                	jmp    801993 <fork+0x8b>
+        return -1;
+  8019ca:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8019d0:	eb c1                	jmp    801993 <fork+0x8b>
+        return -1;
+  8019d2:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8019d8:	eb b9                	jmp    801993 <fork+0x8b>
+
+00000000008019da <sfork>:
+
+envid_t
+sfork() {
+  8019da:	55                   	push   %rbp
+  8019db:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8019de:	48 ba bd 3d 80 00 00 	movabs $0x803dbd,%rdx
+  8019e5:	00 00 00 
+  8019e8:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8019ed:	48 bf d8 3d 80 00 00 	movabs $0x803dd8,%rdi
+  8019f4:	00 00 00 
+  8019f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fc:	48 b9 41 03 80 00 00 	movabs $0x800341,%rcx
+  801a03:	00 00 00 
+  801a06:	ff d1                	call   *%rcx
+
+0000000000801a08 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a08:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a0f:	ff ff ff 
+  801a12:	48 01 f8             	add    %rdi,%rax
+  801a15:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a19:	c3                   	ret
+
+0000000000801a1a <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a1a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a21:	ff ff ff 
+  801a24:	48 01 f8             	add    %rdi,%rax
+  801a27:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a2b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801a31:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801a35:	c3                   	ret
+
+0000000000801a36 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801a36:	55                   	push   %rbp
+  801a37:	48 89 e5             	mov    %rsp,%rbp
+  801a3a:	41 57                	push   %r15
+  801a3c:	41 56                	push   %r14
+  801a3e:	41 55                	push   %r13
+  801a40:	41 54                	push   %r12
+  801a42:	53                   	push   %rbx
+  801a43:	48 83 ec 08          	sub    $0x8,%rsp
+  801a47:	49 89 ff             	mov    %rdi,%r15
+  801a4a:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a4f:	49 bd ae 32 80 00 00 	movabs $0x8032ae,%r13
+  801a56:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801a59:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801a5f:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801a62:	48 89 df             	mov    %rbx,%rdi
+  801a65:	41 ff d5             	call   *%r13
+  801a68:	83 e0 04             	and    $0x4,%eax
+  801a6b:	74 17                	je     801a84 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801a6d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a74:	4c 39 f3             	cmp    %r14,%rbx
+  801a77:	75 e6                	jne    801a5f <fd_alloc+0x29>
+  801a79:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a7f:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a84:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a87:	48 83 c4 08          	add    $0x8,%rsp
+  801a8b:	5b                   	pop    %rbx
+  801a8c:	41 5c                	pop    %r12
+  801a8e:	41 5d                	pop    %r13
+  801a90:	41 5e                	pop    %r14
+  801a92:	41 5f                	pop    %r15
+  801a94:	5d                   	pop    %rbp
+  801a95:	c3                   	ret
+
+0000000000801a96 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a96:	83 ff 1f             	cmp    $0x1f,%edi
+  801a99:	77 39                	ja     801ad4 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a9b:	55                   	push   %rbp
+  801a9c:	48 89 e5             	mov    %rsp,%rbp
+  801a9f:	41 54                	push   %r12
+  801aa1:	53                   	push   %rbx
+  801aa2:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801aa5:	48 63 df             	movslq %edi,%rbx
+  801aa8:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801aaf:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ab3:	48 89 df             	mov    %rbx,%rdi
+  801ab6:	48 b8 ae 32 80 00 00 	movabs $0x8032ae,%rax
+  801abd:	00 00 00 
+  801ac0:	ff d0                	call   *%rax
+  801ac2:	a8 04                	test   $0x4,%al
+  801ac4:	74 14                	je     801ada <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801ac6:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801aca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801acf:	5b                   	pop    %rbx
+  801ad0:	41 5c                	pop    %r12
+  801ad2:	5d                   	pop    %rbp
+  801ad3:	c3                   	ret
+        return -E_INVAL;
+  801ad4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801ad9:	c3                   	ret
+        return -E_INVAL;
+  801ada:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801adf:	eb ee                	jmp    801acf <fd_lookup+0x39>
+
+0000000000801ae1 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801ae1:	55                   	push   %rbp
+  801ae2:	48 89 e5             	mov    %rsp,%rbp
+  801ae5:	41 54                	push   %r12
+  801ae7:	53                   	push   %rbx
+  801ae8:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801aeb:	48 b8 80 3e 80 00 00 	movabs $0x803e80,%rax
+  801af2:	00 00 00 
+  801af5:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801afc:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801aff:	39 3b                	cmp    %edi,(%rbx)
+  801b01:	74 47                	je     801b4a <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b03:	48 83 c0 08          	add    $0x8,%rax
+  801b07:	48 8b 18             	mov    (%rax),%rbx
+  801b0a:	48 85 db             	test   %rbx,%rbx
+  801b0d:	75 f0                	jne    801aff <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b0f:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801b16:	00 00 00 
+  801b19:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b1f:	89 fa                	mov    %edi,%edx
+  801b21:	48 bf e8 3d 80 00 00 	movabs $0x803de8,%rdi
+  801b28:	00 00 00 
+  801b2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b30:	48 b9 91 04 80 00 00 	movabs $0x800491,%rcx
+  801b37:	00 00 00 
+  801b3a:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b41:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b45:	5b                   	pop    %rbx
+  801b46:	41 5c                	pop    %r12
+  801b48:	5d                   	pop    %rbp
+  801b49:	c3                   	ret
+            return 0;
+  801b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4f:	eb f0                	jmp    801b41 <dev_lookup+0x60>
+
+0000000000801b51 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b51:	55                   	push   %rbp
+  801b52:	48 89 e5             	mov    %rsp,%rbp
+  801b55:	41 55                	push   %r13
+  801b57:	41 54                	push   %r12
+  801b59:	53                   	push   %rbx
+  801b5a:	48 83 ec 18          	sub    $0x18,%rsp
+  801b5e:	48 89 fb             	mov    %rdi,%rbx
+  801b61:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b64:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b6b:	ff ff ff 
+  801b6e:	48 01 df             	add    %rbx,%rdi
+  801b71:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b75:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b79:	48 b8 96 1a 80 00 00 	movabs $0x801a96,%rax
+  801b80:	00 00 00 
+  801b83:	ff d0                	call   *%rax
+  801b85:	41 89 c5             	mov    %eax,%r13d
+  801b88:	85 c0                	test   %eax,%eax
+  801b8a:	78 06                	js     801b92 <fd_close+0x41>
+  801b8c:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b90:	74 1a                	je     801bac <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b92:	45 84 e4             	test   %r12b,%r12b
+  801b95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9a:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b9e:	44 89 e8             	mov    %r13d,%eax
+  801ba1:	48 83 c4 18          	add    $0x18,%rsp
+  801ba5:	5b                   	pop    %rbx
+  801ba6:	41 5c                	pop    %r12
+  801ba8:	41 5d                	pop    %r13
+  801baa:	5d                   	pop    %rbp
+  801bab:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bac:	8b 3b                	mov    (%rbx),%edi
+  801bae:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bb2:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  801bb9:	00 00 00 
+  801bbc:	ff d0                	call   *%rax
+  801bbe:	41 89 c5             	mov    %eax,%r13d
+  801bc1:	85 c0                	test   %eax,%eax
+  801bc3:	78 1b                	js     801be0 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801bc5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bc9:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801bcd:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801bd3:	48 85 c0             	test   %rax,%rax
+  801bd6:	74 08                	je     801be0 <fd_close+0x8f>
+  801bd8:	48 89 df             	mov    %rbx,%rdi
+  801bdb:	ff d0                	call   *%rax
+  801bdd:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801be0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801be5:	48 89 de             	mov    %rbx,%rsi
+  801be8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bed:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  801bf4:	00 00 00 
+  801bf7:	ff d0                	call   *%rax
+    return res;
+  801bf9:	eb a3                	jmp    801b9e <fd_close+0x4d>
+
+0000000000801bfb <close>:
+
+int
+close(int fdnum) {
+  801bfb:	55                   	push   %rbp
+  801bfc:	48 89 e5             	mov    %rsp,%rbp
+  801bff:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c03:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c07:	48 b8 96 1a 80 00 00 	movabs $0x801a96,%rax
+  801c0e:	00 00 00 
+  801c11:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c13:	85 c0                	test   %eax,%eax
+  801c15:	78 15                	js     801c2c <close+0x31>
+
+    return fd_close(fd, 1);
+  801c17:	be 01 00 00 00       	mov    $0x1,%esi
+  801c1c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c20:	48 b8 51 1b 80 00 00 	movabs $0x801b51,%rax
+  801c27:	00 00 00 
+  801c2a:	ff d0                	call   *%rax
+}
+  801c2c:	c9                   	leave
+  801c2d:	c3                   	ret
+
+0000000000801c2e <close_all>:
+
+void
+close_all(void) {
+  801c2e:	55                   	push   %rbp
+  801c2f:	48 89 e5             	mov    %rsp,%rbp
+  801c32:	41 54                	push   %r12
+  801c34:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c3a:	49 bc fb 1b 80 00 00 	movabs $0x801bfb,%r12
+  801c41:	00 00 00 
+  801c44:	89 df                	mov    %ebx,%edi
+  801c46:	41 ff d4             	call   *%r12
+  801c49:	83 c3 01             	add    $0x1,%ebx
+  801c4c:	83 fb 20             	cmp    $0x20,%ebx
+  801c4f:	75 f3                	jne    801c44 <close_all+0x16>
+}
+  801c51:	5b                   	pop    %rbx
+  801c52:	41 5c                	pop    %r12
+  801c54:	5d                   	pop    %rbp
+  801c55:	c3                   	ret
+
+0000000000801c56 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c56:	55                   	push   %rbp
+  801c57:	48 89 e5             	mov    %rsp,%rbp
+  801c5a:	41 57                	push   %r15
+  801c5c:	41 56                	push   %r14
+  801c5e:	41 55                	push   %r13
+  801c60:	41 54                	push   %r12
+  801c62:	53                   	push   %rbx
+  801c63:	48 83 ec 18          	sub    $0x18,%rsp
+  801c67:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c6a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c6e:	48 b8 96 1a 80 00 00 	movabs $0x801a96,%rax
+  801c75:	00 00 00 
+  801c78:	ff d0                	call   *%rax
+  801c7a:	89 c3                	mov    %eax,%ebx
+  801c7c:	85 c0                	test   %eax,%eax
+  801c7e:	0f 88 b8 00 00 00    	js     801d3c <dup+0xe6>
+    close(newfdnum);
+  801c84:	44 89 e7             	mov    %r12d,%edi
+  801c87:	48 b8 fb 1b 80 00 00 	movabs $0x801bfb,%rax
+  801c8e:	00 00 00 
+  801c91:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c93:	4d 63 ec             	movslq %r12d,%r13
+  801c96:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c9d:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801ca1:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ca5:	4c 89 ff             	mov    %r15,%rdi
+  801ca8:	49 be 1a 1a 80 00 00 	movabs $0x801a1a,%r14
+  801caf:	00 00 00 
+  801cb2:	41 ff d6             	call   *%r14
+  801cb5:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801cb8:	4c 89 ef             	mov    %r13,%rdi
+  801cbb:	41 ff d6             	call   *%r14
+  801cbe:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801cc1:	48 89 df             	mov    %rbx,%rdi
+  801cc4:	48 b8 ae 32 80 00 00 	movabs $0x8032ae,%rax
+  801ccb:	00 00 00 
+  801cce:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801cd0:	a8 04                	test   $0x4,%al
+  801cd2:	74 2b                	je     801cff <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801cd4:	41 89 c1             	mov    %eax,%r9d
+  801cd7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cdd:	4c 89 f1             	mov    %r14,%rcx
+  801ce0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce5:	48 89 de             	mov    %rbx,%rsi
+  801ce8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ced:	48 b8 cd 13 80 00 00 	movabs $0x8013cd,%rax
+  801cf4:	00 00 00 
+  801cf7:	ff d0                	call   *%rax
+  801cf9:	89 c3                	mov    %eax,%ebx
+  801cfb:	85 c0                	test   %eax,%eax
+  801cfd:	78 4e                	js     801d4d <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801cff:	4c 89 ff             	mov    %r15,%rdi
+  801d02:	48 b8 ae 32 80 00 00 	movabs $0x8032ae,%rax
+  801d09:	00 00 00 
+  801d0c:	ff d0                	call   *%rax
+  801d0e:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d11:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d17:	4c 89 e9             	mov    %r13,%rcx
+  801d1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d1f:	4c 89 fe             	mov    %r15,%rsi
+  801d22:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d27:	48 b8 cd 13 80 00 00 	movabs $0x8013cd,%rax
+  801d2e:	00 00 00 
+  801d31:	ff d0                	call   *%rax
+  801d33:	89 c3                	mov    %eax,%ebx
+  801d35:	85 c0                	test   %eax,%eax
+  801d37:	78 14                	js     801d4d <dup+0xf7>
+
+    return newfdnum;
+  801d39:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d3c:	89 d8                	mov    %ebx,%eax
+  801d3e:	48 83 c4 18          	add    $0x18,%rsp
+  801d42:	5b                   	pop    %rbx
+  801d43:	41 5c                	pop    %r12
+  801d45:	41 5d                	pop    %r13
+  801d47:	41 5e                	pop    %r14
+  801d49:	41 5f                	pop    %r15
+  801d4b:	5d                   	pop    %rbp
+  801d4c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d4d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d52:	4c 89 ee             	mov    %r13,%rsi
+  801d55:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d5a:	49 bc 32 14 80 00 00 	movabs $0x801432,%r12
+  801d61:	00 00 00 
+  801d64:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d67:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d6c:	4c 89 f6             	mov    %r14,%rsi
+  801d6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d74:	41 ff d4             	call   *%r12
+    return res;
+  801d77:	eb c3                	jmp    801d3c <dup+0xe6>
+
+0000000000801d79 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d79:	55                   	push   %rbp
+  801d7a:	48 89 e5             	mov    %rsp,%rbp
+  801d7d:	41 56                	push   %r14
+  801d7f:	41 55                	push   %r13
+  801d81:	41 54                	push   %r12
+  801d83:	53                   	push   %rbx
+  801d84:	48 83 ec 10          	sub    $0x10,%rsp
+  801d88:	89 fb                	mov    %edi,%ebx
+  801d8a:	49 89 f4             	mov    %rsi,%r12
+  801d8d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d90:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d94:	48 b8 96 1a 80 00 00 	movabs $0x801a96,%rax
+  801d9b:	00 00 00 
+  801d9e:	ff d0                	call   *%rax
+  801da0:	85 c0                	test   %eax,%eax
+  801da2:	78 4c                	js     801df0 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801da4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801da8:	41 8b 3e             	mov    (%r14),%edi
+  801dab:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801daf:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  801db6:	00 00 00 
+  801db9:	ff d0                	call   *%rax
+  801dbb:	85 c0                	test   %eax,%eax
+  801dbd:	78 35                	js     801df4 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801dbf:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801dc3:	83 e0 03             	and    $0x3,%eax
+  801dc6:	83 f8 01             	cmp    $0x1,%eax
+  801dc9:	74 2d                	je     801df8 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dcb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dcf:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801dd3:	48 85 c0             	test   %rax,%rax
+  801dd6:	74 56                	je     801e2e <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801dd8:	4c 89 ea             	mov    %r13,%rdx
+  801ddb:	4c 89 e6             	mov    %r12,%rsi
+  801dde:	4c 89 f7             	mov    %r14,%rdi
+  801de1:	ff d0                	call   *%rax
+}
+  801de3:	48 83 c4 10          	add    $0x10,%rsp
+  801de7:	5b                   	pop    %rbx
+  801de8:	41 5c                	pop    %r12
+  801dea:	41 5d                	pop    %r13
+  801dec:	41 5e                	pop    %r14
+  801dee:	5d                   	pop    %rbp
+  801def:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801df0:	48 98                	cltq
+  801df2:	eb ef                	jmp    801de3 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801df4:	48 98                	cltq
+  801df6:	eb eb                	jmp    801de3 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801df8:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801dff:	00 00 00 
+  801e02:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e08:	89 da                	mov    %ebx,%edx
+  801e0a:	48 bf 29 3e 80 00 00 	movabs $0x803e29,%rdi
+  801e11:	00 00 00 
+  801e14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e19:	48 b9 91 04 80 00 00 	movabs $0x800491,%rcx
+  801e20:	00 00 00 
+  801e23:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e25:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e2c:	eb b5                	jmp    801de3 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e2e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e35:	eb ac                	jmp    801de3 <read+0x6a>
+
+0000000000801e37 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e37:	55                   	push   %rbp
+  801e38:	48 89 e5             	mov    %rsp,%rbp
+  801e3b:	41 57                	push   %r15
+  801e3d:	41 56                	push   %r14
+  801e3f:	41 55                	push   %r13
+  801e41:	41 54                	push   %r12
+  801e43:	53                   	push   %rbx
+  801e44:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e48:	48 85 d2             	test   %rdx,%rdx
+  801e4b:	74 54                	je     801ea1 <readn+0x6a>
+  801e4d:	41 89 fd             	mov    %edi,%r13d
+  801e50:	49 89 f6             	mov    %rsi,%r14
+  801e53:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e56:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e5b:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e60:	49 bf 79 1d 80 00 00 	movabs $0x801d79,%r15
+  801e67:	00 00 00 
+  801e6a:	4c 89 e2             	mov    %r12,%rdx
+  801e6d:	48 29 f2             	sub    %rsi,%rdx
+  801e70:	4c 01 f6             	add    %r14,%rsi
+  801e73:	44 89 ef             	mov    %r13d,%edi
+  801e76:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e79:	85 c0                	test   %eax,%eax
+  801e7b:	78 20                	js     801e9d <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e7d:	01 c3                	add    %eax,%ebx
+  801e7f:	85 c0                	test   %eax,%eax
+  801e81:	74 08                	je     801e8b <readn+0x54>
+  801e83:	48 63 f3             	movslq %ebx,%rsi
+  801e86:	4c 39 e6             	cmp    %r12,%rsi
+  801e89:	72 df                	jb     801e6a <readn+0x33>
+    }
+    return res;
+  801e8b:	48 63 c3             	movslq %ebx,%rax
+}
+  801e8e:	48 83 c4 08          	add    $0x8,%rsp
+  801e92:	5b                   	pop    %rbx
+  801e93:	41 5c                	pop    %r12
+  801e95:	41 5d                	pop    %r13
+  801e97:	41 5e                	pop    %r14
+  801e99:	41 5f                	pop    %r15
+  801e9b:	5d                   	pop    %rbp
+  801e9c:	c3                   	ret
+        if (inc < 0) return inc;
+  801e9d:	48 98                	cltq
+  801e9f:	eb ed                	jmp    801e8e <readn+0x57>
+    int inc = 1, res = 0;
+  801ea1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ea6:	eb e3                	jmp    801e8b <readn+0x54>
+
+0000000000801ea8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ea8:	55                   	push   %rbp
+  801ea9:	48 89 e5             	mov    %rsp,%rbp
+  801eac:	41 56                	push   %r14
+  801eae:	41 55                	push   %r13
+  801eb0:	41 54                	push   %r12
+  801eb2:	53                   	push   %rbx
+  801eb3:	48 83 ec 10          	sub    $0x10,%rsp
+  801eb7:	89 fb                	mov    %edi,%ebx
+  801eb9:	49 89 f4             	mov    %rsi,%r12
+  801ebc:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ebf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ec3:	48 b8 96 1a 80 00 00 	movabs $0x801a96,%rax
+  801eca:	00 00 00 
+  801ecd:	ff d0                	call   *%rax
+  801ecf:	85 c0                	test   %eax,%eax
+  801ed1:	78 47                	js     801f1a <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ed3:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ed7:	41 8b 3e             	mov    (%r14),%edi
+  801eda:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ede:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  801ee5:	00 00 00 
+  801ee8:	ff d0                	call   *%rax
+  801eea:	85 c0                	test   %eax,%eax
+  801eec:	78 30                	js     801f1e <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801eee:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801ef3:	74 2d                	je     801f22 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ef5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ef9:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801efd:	48 85 c0             	test   %rax,%rax
+  801f00:	74 56                	je     801f58 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f02:	4c 89 ea             	mov    %r13,%rdx
+  801f05:	4c 89 e6             	mov    %r12,%rsi
+  801f08:	4c 89 f7             	mov    %r14,%rdi
+  801f0b:	ff d0                	call   *%rax
+}
+  801f0d:	48 83 c4 10          	add    $0x10,%rsp
+  801f11:	5b                   	pop    %rbx
+  801f12:	41 5c                	pop    %r12
+  801f14:	41 5d                	pop    %r13
+  801f16:	41 5e                	pop    %r14
+  801f18:	5d                   	pop    %rbp
+  801f19:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f1a:	48 98                	cltq
+  801f1c:	eb ef                	jmp    801f0d <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f1e:	48 98                	cltq
+  801f20:	eb eb                	jmp    801f0d <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f22:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801f29:	00 00 00 
+  801f2c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f32:	89 da                	mov    %ebx,%edx
+  801f34:	48 bf 45 3e 80 00 00 	movabs $0x803e45,%rdi
+  801f3b:	00 00 00 
+  801f3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f43:	48 b9 91 04 80 00 00 	movabs $0x800491,%rcx
+  801f4a:	00 00 00 
+  801f4d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f4f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f56:	eb b5                	jmp    801f0d <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f58:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f5f:	eb ac                	jmp    801f0d <write+0x65>
+
+0000000000801f61 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f61:	55                   	push   %rbp
+  801f62:	48 89 e5             	mov    %rsp,%rbp
+  801f65:	53                   	push   %rbx
+  801f66:	48 83 ec 18          	sub    $0x18,%rsp
+  801f6a:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f6c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f70:	48 b8 96 1a 80 00 00 	movabs $0x801a96,%rax
+  801f77:	00 00 00 
+  801f7a:	ff d0                	call   *%rax
+  801f7c:	85 c0                	test   %eax,%eax
+  801f7e:	78 0c                	js     801f8c <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f84:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f8c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f90:	c9                   	leave
+  801f91:	c3                   	ret
+
+0000000000801f92 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f92:	55                   	push   %rbp
+  801f93:	48 89 e5             	mov    %rsp,%rbp
+  801f96:	41 55                	push   %r13
+  801f98:	41 54                	push   %r12
+  801f9a:	53                   	push   %rbx
+  801f9b:	48 83 ec 18          	sub    $0x18,%rsp
+  801f9f:	89 fb                	mov    %edi,%ebx
+  801fa1:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fa4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fa8:	48 b8 96 1a 80 00 00 	movabs $0x801a96,%rax
+  801faf:	00 00 00 
+  801fb2:	ff d0                	call   *%rax
+  801fb4:	85 c0                	test   %eax,%eax
+  801fb6:	78 38                	js     801ff0 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fb8:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801fbc:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801fc0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fc4:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  801fcb:	00 00 00 
+  801fce:	ff d0                	call   *%rax
+  801fd0:	85 c0                	test   %eax,%eax
+  801fd2:	78 1c                	js     801ff0 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fd4:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801fd9:	74 20                	je     801ffb <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fdb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fdf:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801fe3:	48 85 c0             	test   %rax,%rax
+  801fe6:	74 47                	je     80202f <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801fe8:	44 89 e6             	mov    %r12d,%esi
+  801feb:	4c 89 ef             	mov    %r13,%rdi
+  801fee:	ff d0                	call   *%rax
+}
+  801ff0:	48 83 c4 18          	add    $0x18,%rsp
+  801ff4:	5b                   	pop    %rbx
+  801ff5:	41 5c                	pop    %r12
+  801ff7:	41 5d                	pop    %r13
+  801ff9:	5d                   	pop    %rbp
+  801ffa:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ffb:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802002:	00 00 00 
+  802005:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80200b:	89 da                	mov    %ebx,%edx
+  80200d:	48 bf 08 3e 80 00 00 	movabs $0x803e08,%rdi
+  802014:	00 00 00 
+  802017:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201c:	48 b9 91 04 80 00 00 	movabs $0x800491,%rcx
+  802023:	00 00 00 
+  802026:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802028:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80202d:	eb c1                	jmp    801ff0 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80202f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802034:	eb ba                	jmp    801ff0 <ftruncate+0x5e>
+
+0000000000802036 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802036:	55                   	push   %rbp
+  802037:	48 89 e5             	mov    %rsp,%rbp
+  80203a:	41 54                	push   %r12
+  80203c:	53                   	push   %rbx
+  80203d:	48 83 ec 10          	sub    $0x10,%rsp
+  802041:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802044:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802048:	48 b8 96 1a 80 00 00 	movabs $0x801a96,%rax
+  80204f:	00 00 00 
+  802052:	ff d0                	call   *%rax
+  802054:	85 c0                	test   %eax,%eax
+  802056:	78 4e                	js     8020a6 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802058:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80205c:	41 8b 3c 24          	mov    (%r12),%edi
+  802060:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802064:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  80206b:	00 00 00 
+  80206e:	ff d0                	call   *%rax
+  802070:	85 c0                	test   %eax,%eax
+  802072:	78 32                	js     8020a6 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802074:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802078:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80207d:	74 30                	je     8020af <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80207f:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802082:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802089:	00 00 00 
+    stat->st_isdir = 0;
+  80208c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802093:	00 00 00 
+    stat->st_dev = dev;
+  802096:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80209d:	48 89 de             	mov    %rbx,%rsi
+  8020a0:	4c 89 e7             	mov    %r12,%rdi
+  8020a3:	ff 50 28             	call   *0x28(%rax)
+}
+  8020a6:	48 83 c4 10          	add    $0x10,%rsp
+  8020aa:	5b                   	pop    %rbx
+  8020ab:	41 5c                	pop    %r12
+  8020ad:	5d                   	pop    %rbp
+  8020ae:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020af:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020b4:	eb f0                	jmp    8020a6 <fstat+0x70>
+
+00000000008020b6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8020b6:	55                   	push   %rbp
+  8020b7:	48 89 e5             	mov    %rsp,%rbp
+  8020ba:	41 54                	push   %r12
+  8020bc:	53                   	push   %rbx
+  8020bd:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8020c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8020c5:	48 b8 37 23 80 00 00 	movabs $0x802337,%rax
+  8020cc:	00 00 00 
+  8020cf:	ff d0                	call   *%rax
+  8020d1:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8020d3:	85 c0                	test   %eax,%eax
+  8020d5:	78 25                	js     8020fc <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8020d7:	4c 89 e6             	mov    %r12,%rsi
+  8020da:	89 c7                	mov    %eax,%edi
+  8020dc:	48 b8 36 20 80 00 00 	movabs $0x802036,%rax
+  8020e3:	00 00 00 
+  8020e6:	ff d0                	call   *%rax
+  8020e8:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8020eb:	89 df                	mov    %ebx,%edi
+  8020ed:	48 b8 fb 1b 80 00 00 	movabs $0x801bfb,%rax
+  8020f4:	00 00 00 
+  8020f7:	ff d0                	call   *%rax
+
+    return res;
+  8020f9:	44 89 e3             	mov    %r12d,%ebx
+}
+  8020fc:	89 d8                	mov    %ebx,%eax
+  8020fe:	5b                   	pop    %rbx
+  8020ff:	41 5c                	pop    %r12
+  802101:	5d                   	pop    %rbp
+  802102:	c3                   	ret
+
+0000000000802103 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802103:	55                   	push   %rbp
+  802104:	48 89 e5             	mov    %rsp,%rbp
+  802107:	41 54                	push   %r12
+  802109:	53                   	push   %rbx
+  80210a:	48 83 ec 10          	sub    $0x10,%rsp
+  80210e:	41 89 fc             	mov    %edi,%r12d
+  802111:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802114:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80211b:	00 00 00 
+  80211e:	83 38 00             	cmpl   $0x0,(%rax)
+  802121:	74 5e                	je     802181 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802123:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802129:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80212e:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802135:	00 00 00 
+  802138:	44 89 e6             	mov    %r12d,%esi
+  80213b:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802142:	00 00 00 
+  802145:	8b 38                	mov    (%rax),%edi
+  802147:	48 b8 6a 36 80 00 00 	movabs $0x80366a,%rax
+  80214e:	00 00 00 
+  802151:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802153:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80215a:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80215b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802160:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802164:	48 89 de             	mov    %rbx,%rsi
+  802167:	bf 00 00 00 00       	mov    $0x0,%edi
+  80216c:	48 b8 d5 35 80 00 00 	movabs $0x8035d5,%rax
+  802173:	00 00 00 
+  802176:	ff d0                	call   *%rax
+}
+  802178:	48 83 c4 10          	add    $0x10,%rsp
+  80217c:	5b                   	pop    %rbx
+  80217d:	41 5c                	pop    %r12
+  80217f:	5d                   	pop    %rbp
+  802180:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802181:	bf 03 00 00 00       	mov    $0x3,%edi
+  802186:	48 b8 0a 37 80 00 00 	movabs $0x80370a,%rax
+  80218d:	00 00 00 
+  802190:	ff d0                	call   *%rax
+  802192:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802199:	00 00 
+  80219b:	eb 86                	jmp    802123 <fsipc+0x20>
+
+000000000080219d <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80219d:	55                   	push   %rbp
+  80219e:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8021a1:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8021a8:	00 00 00 
+  8021ab:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8021ae:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8021b0:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8021b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8021bd:	48 b8 03 21 80 00 00 	movabs $0x802103,%rax
+  8021c4:	00 00 00 
+  8021c7:	ff d0                	call   *%rax
+}
+  8021c9:	5d                   	pop    %rbp
+  8021ca:	c3                   	ret
+
+00000000008021cb <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8021cb:	55                   	push   %rbp
+  8021cc:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8021cf:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8021d2:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8021d9:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8021db:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e0:	bf 06 00 00 00       	mov    $0x6,%edi
+  8021e5:	48 b8 03 21 80 00 00 	movabs $0x802103,%rax
+  8021ec:	00 00 00 
+  8021ef:	ff d0                	call   *%rax
+}
+  8021f1:	5d                   	pop    %rbp
+  8021f2:	c3                   	ret
+
+00000000008021f3 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8021f3:	55                   	push   %rbp
+  8021f4:	48 89 e5             	mov    %rsp,%rbp
+  8021f7:	41 54                	push   %r12
+  8021f9:	53                   	push   %rbx
+  8021fa:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8021fd:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802200:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802207:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802209:	be 00 00 00 00       	mov    $0x0,%esi
+  80220e:	bf 05 00 00 00       	mov    $0x5,%edi
+  802213:	48 b8 03 21 80 00 00 	movabs $0x802103,%rax
+  80221a:	00 00 00 
+  80221d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80221f:	85 c0                	test   %eax,%eax
+  802221:	78 3d                	js     802260 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802223:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80222a:	00 00 00 
+  80222d:	4c 89 e6             	mov    %r12,%rsi
+  802230:	48 89 df             	mov    %rbx,%rdi
+  802233:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  80223a:	00 00 00 
+  80223d:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80223f:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802246:	00 
+  802247:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80224d:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802254:	00 
+  802255:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80225b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802260:	5b                   	pop    %rbx
+  802261:	41 5c                	pop    %r12
+  802263:	5d                   	pop    %rbp
+  802264:	c3                   	ret
+
+0000000000802265 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802265:	55                   	push   %rbp
+  802266:	48 89 e5             	mov    %rsp,%rbp
+  802269:	41 54                	push   %r12
+  80226b:	53                   	push   %rbx
+  80226c:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  80226f:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802274:	48 39 c2             	cmp    %rax,%rdx
+  802277:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80227b:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80227e:	48 89 c2             	mov    %rax,%rdx
+  802281:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802288:	00 00 00 
+  80228b:	48 b8 17 10 80 00 00 	movabs $0x801017,%rax
+  802292:	00 00 00 
+  802295:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802297:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80229e:	00 00 00 
+  8022a1:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8022a6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  8022a8:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  8022ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b1:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022b6:	48 b8 03 21 80 00 00 	movabs $0x802103,%rax
+  8022bd:	00 00 00 
+  8022c0:	ff d0                	call   *%rax
+  8022c2:	48 98                	cltq
+}
+  8022c4:	5b                   	pop    %rbx
+  8022c5:	41 5c                	pop    %r12
+  8022c7:	5d                   	pop    %rbp
+  8022c8:	c3                   	ret
+
+00000000008022c9 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8022c9:	55                   	push   %rbp
+  8022ca:	48 89 e5             	mov    %rsp,%rbp
+  8022cd:	41 54                	push   %r12
+  8022cf:	53                   	push   %rbx
+  8022d0:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022d3:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8022da:	00 00 00 
+  8022dd:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8022e0:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8022e2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022e7:	48 39 ca             	cmp    %rcx,%rdx
+  8022ea:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8022ee:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8022f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022fc:	48 b8 03 21 80 00 00 	movabs $0x802103,%rax
+  802303:	00 00 00 
+  802306:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802308:	85 c0                	test   %eax,%eax
+  80230a:	78 27                	js     802333 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  80230c:	48 63 d8             	movslq %eax,%rbx
+  80230f:	48 89 da             	mov    %rbx,%rdx
+  802312:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  802319:	00 00 00 
+  80231c:	4c 89 e7             	mov    %r12,%rdi
+  80231f:	48 b8 17 10 80 00 00 	movabs $0x801017,%rax
+  802326:	00 00 00 
+  802329:	ff d0                	call   *%rax
+    return bytes_read;
+  80232b:	48 89 d8             	mov    %rbx,%rax
+}
+  80232e:	5b                   	pop    %rbx
+  80232f:	41 5c                	pop    %r12
+  802331:	5d                   	pop    %rbp
+  802332:	c3                   	ret
+        return bytes_read;
+  802333:	48 98                	cltq
+  802335:	eb f7                	jmp    80232e <devfile_read+0x65>
+
+0000000000802337 <open>:
+open(const char *path, int mode) {
+  802337:	55                   	push   %rbp
+  802338:	48 89 e5             	mov    %rsp,%rbp
+  80233b:	41 55                	push   %r13
+  80233d:	41 54                	push   %r12
+  80233f:	53                   	push   %rbx
+  802340:	48 83 ec 18          	sub    $0x18,%rsp
+  802344:	49 89 fc             	mov    %rdi,%r12
+  802347:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80234a:	48 b8 78 0d 80 00 00 	movabs $0x800d78,%rax
+  802351:	00 00 00 
+  802354:	ff d0                	call   *%rax
+  802356:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80235c:	0f 87 8a 00 00 00    	ja     8023ec <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802362:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802366:	48 b8 36 1a 80 00 00 	movabs $0x801a36,%rax
+  80236d:	00 00 00 
+  802370:	ff d0                	call   *%rax
+  802372:	89 c3                	mov    %eax,%ebx
+  802374:	85 c0                	test   %eax,%eax
+  802376:	78 50                	js     8023c8 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802378:	4c 89 e6             	mov    %r12,%rsi
+  80237b:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802382:	00 00 00 
+  802385:	48 89 df             	mov    %rbx,%rdi
+  802388:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  80238f:	00 00 00 
+  802392:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802394:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80239b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80239f:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023a4:	48 b8 03 21 80 00 00 	movabs $0x802103,%rax
+  8023ab:	00 00 00 
+  8023ae:	ff d0                	call   *%rax
+  8023b0:	89 c3                	mov    %eax,%ebx
+  8023b2:	85 c0                	test   %eax,%eax
+  8023b4:	78 1f                	js     8023d5 <open+0x9e>
+    return fd2num(fd);
+  8023b6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8023ba:	48 b8 08 1a 80 00 00 	movabs $0x801a08,%rax
+  8023c1:	00 00 00 
+  8023c4:	ff d0                	call   *%rax
+  8023c6:	89 c3                	mov    %eax,%ebx
+}
+  8023c8:	89 d8                	mov    %ebx,%eax
+  8023ca:	48 83 c4 18          	add    $0x18,%rsp
+  8023ce:	5b                   	pop    %rbx
+  8023cf:	41 5c                	pop    %r12
+  8023d1:	41 5d                	pop    %r13
+  8023d3:	5d                   	pop    %rbp
+  8023d4:	c3                   	ret
+        fd_close(fd, 0);
+  8023d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8023da:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8023de:	48 b8 51 1b 80 00 00 	movabs $0x801b51,%rax
+  8023e5:	00 00 00 
+  8023e8:	ff d0                	call   *%rax
+        return res;
+  8023ea:	eb dc                	jmp    8023c8 <open+0x91>
+        return -E_BAD_PATH;
+  8023ec:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8023f1:	eb d5                	jmp    8023c8 <open+0x91>
+
+00000000008023f3 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8023f3:	55                   	push   %rbp
+  8023f4:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8023f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8023fc:	bf 08 00 00 00       	mov    $0x8,%edi
+  802401:	48 b8 03 21 80 00 00 	movabs $0x802103,%rax
+  802408:	00 00 00 
+  80240b:	ff d0                	call   *%rax
+}
+  80240d:	5d                   	pop    %rbp
+  80240e:	c3                   	ret
+
+000000000080240f <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  80240f:	55                   	push   %rbp
+  802410:	48 89 e5             	mov    %rsp,%rbp
+  802413:	41 55                	push   %r13
+  802415:	41 54                	push   %r12
+  802417:	53                   	push   %rbx
+  802418:	48 83 ec 08          	sub    $0x8,%rsp
+  80241c:	48 89 fb             	mov    %rdi,%rbx
+  80241f:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  802422:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  802425:	48 b8 ae 32 80 00 00 	movabs $0x8032ae,%rax
+  80242c:	00 00 00 
+  80242f:	ff d0                	call   *%rax
+  802431:	41 89 c1             	mov    %eax,%r9d
+  802434:	4d 89 e0             	mov    %r12,%r8
+  802437:	49 29 d8             	sub    %rbx,%r8
+  80243a:	48 89 d9             	mov    %rbx,%rcx
+  80243d:	44 89 ea             	mov    %r13d,%edx
+  802440:	48 89 de             	mov    %rbx,%rsi
+  802443:	bf 00 00 00 00       	mov    $0x0,%edi
+  802448:	48 b8 cd 13 80 00 00 	movabs $0x8013cd,%rax
+  80244f:	00 00 00 
+  802452:	ff d0                	call   *%rax
+}
+  802454:	48 83 c4 08          	add    $0x8,%rsp
+  802458:	5b                   	pop    %rbx
+  802459:	41 5c                	pop    %r12
+  80245b:	41 5d                	pop    %r13
+  80245d:	5d                   	pop    %rbp
+  80245e:	c3                   	ret
+
+000000000080245f <spawn>:
+spawn(const char *prog, const char **argv) {
+  80245f:	55                   	push   %rbp
+  802460:	48 89 e5             	mov    %rsp,%rbp
+  802463:	41 57                	push   %r15
+  802465:	41 56                	push   %r14
+  802467:	41 55                	push   %r13
+  802469:	41 54                	push   %r12
+  80246b:	53                   	push   %rbx
+  80246c:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  802473:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  802476:	be 00 00 00 00       	mov    $0x0,%esi
+  80247b:	48 b8 37 23 80 00 00 	movabs $0x802337,%rax
+  802482:	00 00 00 
+  802485:	ff d0                	call   *%rax
+  802487:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+    if (fd < 0) return fd;
+  80248d:	85 c0                	test   %eax,%eax
+  80248f:	0f 88 51 06 00 00    	js     802ae6 <spawn+0x687>
+  802495:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  802497:	ba 00 02 00 00       	mov    $0x200,%edx
+  80249c:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  8024a3:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  8024aa:	00 00 00 
+  8024ad:	ff d0                	call   *%rax
+  8024af:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  8024b1:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8024b6:	0f 85 76 02 00 00    	jne    802732 <spawn+0x2d3>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  8024bc:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  8024c3:	ff ff 00 
+  8024c6:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  8024cd:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  8024d4:	01 01 00 
+  8024d7:	48 39 d0             	cmp    %rdx,%rax
+  8024da:	0f 85 8e 02 00 00    	jne    80276e <spawn+0x30f>
+        elf->e_type != ET_EXEC /* executable */ ||
+  8024e0:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  8024e7:	00 3e 00 
+  8024ea:	0f 85 7e 02 00 00    	jne    80276e <spawn+0x30f>
+  8024f0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024f5:	cd 30                	int    $0x30
+  8024f7:	41 89 c6             	mov    %eax,%r14d
+  8024fa:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  8024fc:	85 c0                	test   %eax,%eax
+  8024fe:	0f 88 ca 05 00 00    	js     802ace <spawn+0x66f>
+    envid_t child = res;
+  802504:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  80250a:	0f b6 c0             	movzbl %al,%eax
+  80250d:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802514:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  80251b:	00 00 00 
+  80251e:	48 01 c6             	add    %rax,%rsi
+  802521:	48 8b 06             	mov    (%rsi),%rax
+  802524:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  80252b:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  802532:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  802539:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  802540:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  802547:	48 29 ce             	sub    %rcx,%rsi
+  80254a:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  802550:	c1 e9 03             	shr    $0x3,%ecx
+  802553:	89 c9                	mov    %ecx,%ecx
+  802555:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  802558:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  80255f:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  802566:	49 8b 3c 24          	mov    (%r12),%rdi
+  80256a:	48 85 ff             	test   %rdi,%rdi
+  80256d:	0f 84 8b 05 00 00    	je     802afe <spawn+0x69f>
+  802573:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  802579:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  80257f:	48 bb 78 0d 80 00 00 	movabs $0x800d78,%rbx
+  802586:	00 00 00 
+  802589:	ff d3                	call   *%rbx
+  80258b:	4c 01 f8             	add    %r15,%rax
+  80258e:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  802592:	4c 89 ea             	mov    %r13,%rdx
+  802595:	49 83 c5 01          	add    $0x1,%r13
+  802599:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  80259e:	48 85 ff             	test   %rdi,%rdi
+  8025a1:	75 e6                	jne    802589 <spawn+0x12a>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8025a3:	49 89 d5             	mov    %rdx,%r13
+  8025a6:	48 89 95 e0 fc ff ff 	mov    %rdx,-0x320(%rbp)
+  8025ad:	48 f7 d0             	not    %rax
+  8025b0:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8025b7:	49 89 df             	mov    %rbx,%r15
+  8025ba:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  8025be:	4c 89 bd f0 fc ff ff 	mov    %r15,-0x310(%rbp)
+  8025c5:	89 d0                	mov    %edx,%eax
+  8025c7:	83 c0 01             	add    $0x1,%eax
+  8025ca:	48 98                	cltq
+  8025cc:	48 c1 e0 03          	shl    $0x3,%rax
+  8025d0:	49 29 c7             	sub    %rax,%r15
+  8025d3:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8025da:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  8025de:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  8025e4:	0f 86 cb 04 00 00    	jbe    802ab5 <spawn+0x656>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  8025ea:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8025ef:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8025f4:	be 00 00 40 00       	mov    $0x400000,%esi
+  8025f9:	48 b8 66 13 80 00 00 	movabs $0x801366,%rax
+  802600:	00 00 00 
+  802603:	ff d0                	call   *%rax
+  802605:	85 c0                	test   %eax,%eax
+  802607:	0f 88 ad 04 00 00    	js     802aba <spawn+0x65b>
+    for (i = 0; i < argc; i++) {
+  80260d:	4c 89 e8             	mov    %r13,%rax
+  802610:	45 85 ed             	test   %r13d,%r13d
+  802613:	7e 54                	jle    802669 <spawn+0x20a>
+  802615:	4d 89 fd             	mov    %r15,%r13
+  802618:	48 98                	cltq
+  80261a:	4d 8d 3c c7          	lea    (%r15,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  80261e:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  802625:	00 00 00 
+  802628:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  80262f:	ff 
+  802630:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  802634:	49 8b 34 24          	mov    (%r12),%rsi
+  802638:	48 89 df             	mov    %rbx,%rdi
+  80263b:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  802642:	00 00 00 
+  802645:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  802647:	49 8b 3c 24          	mov    (%r12),%rdi
+  80264b:	48 b8 78 0d 80 00 00 	movabs $0x800d78,%rax
+  802652:	00 00 00 
+  802655:	ff d0                	call   *%rax
+  802657:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  80265c:	49 83 c5 08          	add    $0x8,%r13
+  802660:	49 83 c4 08          	add    $0x8,%r12
+  802664:	4d 39 fd             	cmp    %r15,%r13
+  802667:	75 b5                	jne    80261e <spawn+0x1bf>
+    argv_store[argc] = 0;
+  802669:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  802670:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  802677:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  802678:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  80267f:	0f 85 30 01 00 00    	jne    8027b5 <spawn+0x356>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  802685:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  80268c:	00 00 00 
+  80268f:	48 8b 9d e8 fc ff ff 	mov    -0x318(%rbp),%rbx
+  802696:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  80269d:	ff 
+  80269e:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  8026a2:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  8026a9:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  8026ad:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  8026b4:	00 00 00 
+  8026b7:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  8026be:	ff 
+  8026bf:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  8026c6:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8026cc:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  8026d2:	44 89 f2             	mov    %r14d,%edx
+  8026d5:	be 00 00 40 00       	mov    $0x400000,%esi
+  8026da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026df:	48 b8 cd 13 80 00 00 	movabs $0x8013cd,%rax
+  8026e6:	00 00 00 
+  8026e9:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  8026eb:	48 bb 32 14 80 00 00 	movabs $0x801432,%rbx
+  8026f2:	00 00 00 
+  8026f5:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8026fa:	be 00 00 40 00       	mov    $0x400000,%esi
+  8026ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802704:	ff d3                	call   *%rbx
+  802706:	85 c0                	test   %eax,%eax
+  802708:	78 eb                	js     8026f5 <spawn+0x296>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80270a:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  802711:	4c 8d a4 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r12
+  802718:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802719:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  802720:	00 
+  802721:	0f 84 87 02 00 00    	je     8029ae <spawn+0x54f>
+  802727:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  80272d:	e9 fe 00 00 00       	jmp    802830 <spawn+0x3d1>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  802732:	48 bf a0 3e 80 00 00 	movabs $0x803ea0,%rdi
+  802739:	00 00 00 
+  80273c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802741:	48 ba 91 04 80 00 00 	movabs $0x800491,%rdx
+  802748:	00 00 00 
+  80274b:	ff d2                	call   *%rdx
+        close(fd);
+  80274d:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802753:	48 b8 fb 1b 80 00 00 	movabs $0x801bfb,%rax
+  80275a:	00 00 00 
+  80275d:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  80275f:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  802766:	ff ff ff 
+  802769:	e9 78 03 00 00       	jmp    802ae6 <spawn+0x687>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80276e:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  802773:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  802779:	48 bf 00 3f 80 00 00 	movabs $0x803f00,%rdi
+  802780:	00 00 00 
+  802783:	b8 00 00 00 00       	mov    $0x0,%eax
+  802788:	48 b9 91 04 80 00 00 	movabs $0x800491,%rcx
+  80278f:	00 00 00 
+  802792:	ff d1                	call   *%rcx
+        close(fd);
+  802794:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  80279a:	48 b8 fb 1b 80 00 00 	movabs $0x801bfb,%rax
+  8027a1:	00 00 00 
+  8027a4:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8027a6:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  8027ad:	ff ff ff 
+  8027b0:	e9 31 03 00 00       	jmp    802ae6 <spawn+0x687>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8027b5:	48 b9 d0 3e 80 00 00 	movabs $0x803ed0,%rcx
+  8027bc:	00 00 00 
+  8027bf:	48 ba 1a 3f 80 00 00 	movabs $0x803f1a,%rdx
+  8027c6:	00 00 00 
+  8027c9:	be f0 00 00 00       	mov    $0xf0,%esi
+  8027ce:	48 bf 2f 3f 80 00 00 	movabs $0x803f2f,%rdi
+  8027d5:	00 00 00 
+  8027d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027dd:	49 b8 41 03 80 00 00 	movabs $0x800341,%r8
+  8027e4:	00 00 00 
+  8027e7:	41 ff d0             	call   *%r8
+        if (err)
+            return err;
+    }
+
+    /* Allocate filesz in parent to UTEMP */
+    int err = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+  8027ea:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8027ef:	4c 89 ea             	mov    %r13,%rdx
+  8027f2:	be 00 00 40 00       	mov    $0x400000,%esi
+  8027f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027fc:	48 b8 66 13 80 00 00 	movabs $0x801366,%rax
+  802803:	00 00 00 
+  802806:	ff d0                	call   *%rax
+    if (err)
+  802808:	85 c0                	test   %eax,%eax
+  80280a:	0f 84 d2 00 00 00    	je     8028e2 <spawn+0x483>
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  802810:	85 c0                	test   %eax,%eax
+  802812:	0f 88 99 02 00 00    	js     802ab1 <spawn+0x652>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802818:	49 83 c7 01          	add    $0x1,%r15
+  80281c:	49 83 c4 38          	add    $0x38,%r12
+  802820:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  802827:	49 39 c7             	cmp    %rax,%r15
+  80282a:	0f 83 7e 01 00 00    	jae    8029ae <spawn+0x54f>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  802830:	41 83 3c 24 01       	cmpl   $0x1,(%r12)
+  802835:	75 e1                	jne    802818 <spawn+0x3b9>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  802837:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80283c:	41 89 c6             	mov    %eax,%r14d
+  80283f:	41 83 e6 02          	and    $0x2,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  802843:	44 89 f2             	mov    %r14d,%edx
+  802846:	83 ca 04             	or     $0x4,%edx
+  802849:	a8 04                	test   $0x4,%al
+  80284b:	44 0f 45 f2          	cmovne %edx,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  80284f:	44 89 f2             	mov    %r14d,%edx
+  802852:	83 ca 01             	or     $0x1,%edx
+  802855:	a8 01                	test   $0x1,%al
+  802857:	44 0f 45 f2          	cmovne %edx,%r14d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  80285b:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802860:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  802866:	4d 8b 6c 24 20       	mov    0x20(%r12),%r13
+  80286b:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  802870:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  802875:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  80287b:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  802881:	89 d9                	mov    %ebx,%ecx
+  802883:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802889:	74 14                	je     80289f <spawn+0x440>
+        va -= res;
+  80288b:	48 63 f1             	movslq %ecx,%rsi
+  80288e:	48 29 f3             	sub    %rsi,%rbx
+        memsz += res;
+  802891:	48 01 f2             	add    %rsi,%rdx
+        filesz += res;
+  802894:	49 01 f5             	add    %rsi,%r13
+        fileoffset -= res;
+  802897:	29 c8                	sub    %ecx,%eax
+  802899:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    filesz = ROUNDUP(filesz, PAGE_SIZE);
+  80289f:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8028a6:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    if (filesz < memsz) {
+  8028ad:	49 39 d5             	cmp    %rdx,%r13
+  8028b0:	0f 83 34 ff ff ff    	jae    8027ea <spawn+0x38b>
+        int err = sys_alloc_region(child, (void *)va + filesz, memsz - filesz, PROT_RW);
+  8028b6:	4c 29 ea             	sub    %r13,%rdx
+  8028b9:	49 8d 74 1d 00       	lea    0x0(%r13,%rbx,1),%rsi
+  8028be:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8028c3:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  8028c9:	48 b8 66 13 80 00 00 	movabs $0x801366,%rax
+  8028d0:	00 00 00 
+  8028d3:	ff d0                	call   *%rax
+        if (err)
+  8028d5:	85 c0                	test   %eax,%eax
+  8028d7:	0f 84 0d ff ff ff    	je     8027ea <spawn+0x38b>
+  8028dd:	e9 2e ff ff ff       	jmp    802810 <spawn+0x3b1>
+        return err;
+
+    /* seek() fd to fileoffset  */
+    err = seek(fd, fileoffset);
+  8028e2:	8b b5 f0 fc ff ff    	mov    -0x310(%rbp),%esi
+  8028e8:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  8028ee:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  8028f5:	00 00 00 
+  8028f8:	ff d0                	call   *%rax
+    if (err)
+  8028fa:	85 c0                	test   %eax,%eax
+  8028fc:	0f 85 0e ff ff ff    	jne    802810 <spawn+0x3b1>
+        return err;
+
+    /* read filesz to UTEMP */
+    ssize_t bytes_read = readn(fd, UTEMP, filesz);
+  802902:	4c 89 ea             	mov    %r13,%rdx
+  802905:	be 00 00 40 00       	mov    $0x400000,%esi
+  80290a:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802910:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  802917:	00 00 00 
+  80291a:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  80291c:	48 85 c0             	test   %rax,%rax
+  80291f:	0f 88 eb fe ff ff    	js     802810 <spawn+0x3b1>
+        return bytes_read;
+    assert(bytes_read == filesz);
+  802925:	4c 39 e8             	cmp    %r13,%rax
+  802928:	75 4f                	jne    802979 <spawn+0x51a>
+
+    /* Map read section conents to child */
+    err = sys_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+  80292a:	45 89 f1             	mov    %r14d,%r9d
+  80292d:	41 80 c9 80          	or     $0x80,%r9b
+  802931:	4d 89 e8             	mov    %r13,%r8
+  802934:	48 89 d9             	mov    %rbx,%rcx
+  802937:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  80293d:	be 00 00 40 00       	mov    $0x400000,%esi
+  802942:	bf 00 00 00 00       	mov    $0x0,%edi
+  802947:	48 b8 cd 13 80 00 00 	movabs $0x8013cd,%rax
+  80294e:	00 00 00 
+  802951:	ff d0                	call   *%rax
+    if (err)
+  802953:	85 c0                	test   %eax,%eax
+  802955:	0f 85 b5 fe ff ff    	jne    802810 <spawn+0x3b1>
+        return err;
+
+    /* Unmap it from parent */
+    err = sys_unmap_region(CURENVID, UTEMP, filesz);
+  80295b:	4c 89 ea             	mov    %r13,%rdx
+  80295e:	be 00 00 40 00       	mov    $0x400000,%esi
+  802963:	bf 00 00 00 00       	mov    $0x0,%edi
+  802968:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  80296f:	00 00 00 
+  802972:	ff d0                	call   *%rax
+    if (err)
+  802974:	e9 97 fe ff ff       	jmp    802810 <spawn+0x3b1>
+    assert(bytes_read == filesz);
+  802979:	48 b9 3b 3f 80 00 00 	movabs $0x803f3b,%rcx
+  802980:	00 00 00 
+  802983:	48 ba 1a 3f 80 00 00 	movabs $0x803f1a,%rdx
+  80298a:	00 00 00 
+  80298d:	be 2f 01 00 00       	mov    $0x12f,%esi
+  802992:	48 bf 2f 3f 80 00 00 	movabs $0x803f2f,%rdi
+  802999:	00 00 00 
+  80299c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a1:	49 b8 41 03 80 00 00 	movabs $0x800341,%r8
+  8029a8:	00 00 00 
+  8029ab:	41 ff d0             	call   *%r8
+    close(fd);
+  8029ae:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  8029b4:	48 b8 fb 1b 80 00 00 	movabs $0x801bfb,%rax
+  8029bb:	00 00 00 
+  8029be:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  8029c0:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  8029c7:	48 bf 0f 24 80 00 00 	movabs $0x80240f,%rdi
+  8029ce:	00 00 00 
+  8029d1:	48 b8 22 33 80 00 00 	movabs $0x803322,%rax
+  8029d8:	00 00 00 
+  8029db:	ff d0                	call   *%rax
+  8029dd:	85 c0                	test   %eax,%eax
+  8029df:	78 49                	js     802a2a <spawn+0x5cb>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8029e1:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  8029e8:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8029ee:	48 b8 d2 15 80 00 00 	movabs $0x8015d2,%rax
+  8029f5:	00 00 00 
+  8029f8:	ff d0                	call   *%rax
+  8029fa:	85 c0                	test   %eax,%eax
+  8029fc:	78 59                	js     802a57 <spawn+0x5f8>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  8029fe:	be 02 00 00 00       	mov    $0x2,%esi
+  802a03:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802a09:	48 b8 69 15 80 00 00 	movabs $0x801569,%rax
+  802a10:	00 00 00 
+  802a13:	ff d0                	call   *%rax
+  802a15:	85 c0                	test   %eax,%eax
+  802a17:	78 6b                	js     802a84 <spawn+0x625>
+    return child;
+  802a19:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  802a1f:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+  802a25:	e9 bc 00 00 00       	jmp    802ae6 <spawn+0x687>
+        panic("copy_shared_region: %i", res);
+  802a2a:	89 c1                	mov    %eax,%ecx
+  802a2c:	48 ba 50 3f 80 00 00 	movabs $0x803f50,%rdx
+  802a33:	00 00 00 
+  802a36:	be 84 00 00 00       	mov    $0x84,%esi
+  802a3b:	48 bf 2f 3f 80 00 00 	movabs $0x803f2f,%rdi
+  802a42:	00 00 00 
+  802a45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4a:	49 b8 41 03 80 00 00 	movabs $0x800341,%r8
+  802a51:	00 00 00 
+  802a54:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  802a57:	89 c1                	mov    %eax,%ecx
+  802a59:	48 ba 67 3f 80 00 00 	movabs $0x803f67,%rdx
+  802a60:	00 00 00 
+  802a63:	be 87 00 00 00       	mov    $0x87,%esi
+  802a68:	48 bf 2f 3f 80 00 00 	movabs $0x803f2f,%rdi
+  802a6f:	00 00 00 
+  802a72:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a77:	49 b8 41 03 80 00 00 	movabs $0x800341,%r8
+  802a7e:	00 00 00 
+  802a81:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  802a84:	89 c1                	mov    %eax,%ecx
+  802a86:	48 ba 81 3f 80 00 00 	movabs $0x803f81,%rdx
+  802a8d:	00 00 00 
+  802a90:	be 8a 00 00 00       	mov    $0x8a,%esi
+  802a95:	48 bf 2f 3f 80 00 00 	movabs $0x803f2f,%rdi
+  802a9c:	00 00 00 
+  802a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa4:	49 b8 41 03 80 00 00 	movabs $0x800341,%r8
+  802aab:	00 00 00 
+  802aae:	41 ff d0             	call   *%r8
+  802ab1:	89 c3                	mov    %eax,%ebx
+  802ab3:	eb 07                	jmp    802abc <spawn+0x65d>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  802ab5:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802aba:	89 c3                	mov    %eax,%ebx
+    sys_env_destroy(child);
+  802abc:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802ac2:	48 b8 3b 12 80 00 00 	movabs $0x80123b,%rax
+  802ac9:	00 00 00 
+  802acc:	ff d0                	call   *%rax
+    close(fd);
+  802ace:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802ad4:	48 b8 fb 1b 80 00 00 	movabs $0x801bfb,%rax
+  802adb:	00 00 00 
+  802ade:	ff d0                	call   *%rax
+    return res;
+  802ae0:	89 9d fc fc ff ff    	mov    %ebx,-0x304(%rbp)
+}
+  802ae6:	8b 85 fc fc ff ff    	mov    -0x304(%rbp),%eax
+  802aec:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  802af3:	5b                   	pop    %rbx
+  802af4:	41 5c                	pop    %r12
+  802af6:	41 5d                	pop    %r13
+  802af8:	41 5e                	pop    %r14
+  802afa:	41 5f                	pop    %r15
+  802afc:	5d                   	pop    %rbp
+  802afd:	c3                   	ret
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  802afe:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b03:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802b08:	be 00 00 40 00       	mov    $0x400000,%esi
+  802b0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b12:	48 b8 66 13 80 00 00 	movabs $0x801366,%rax
+  802b19:	00 00 00 
+  802b1c:	ff d0                	call   *%rax
+  802b1e:	85 c0                	test   %eax,%eax
+  802b20:	78 98                	js     802aba <spawn+0x65b>
+    for (argc = 0; argv[argc] != 0; argc++)
+  802b22:	48 c7 85 e0 fc ff ff 	movq   $0x0,-0x320(%rbp)
+  802b29:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  802b2d:	48 c7 85 e8 fc ff ff 	movq   $0x40fff8,-0x318(%rbp)
+  802b34:	f8 ff 40 00 
+  802b38:	48 c7 85 f0 fc ff ff 	movq   $0x410000,-0x310(%rbp)
+  802b3f:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  802b43:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  802b48:	e9 1c fb ff ff       	jmp    802669 <spawn+0x20a>
+
+0000000000802b4d <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  802b4d:	55                   	push   %rbp
+  802b4e:	48 89 e5             	mov    %rsp,%rbp
+  802b51:	48 83 ec 50          	sub    $0x50,%rsp
+  802b55:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802b59:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802b5d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802b61:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  802b65:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802b6c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802b70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b74:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802b78:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  802b7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  802b81:	eb 15                	jmp    802b98 <spawnl+0x4b>
+  802b83:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b87:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b8f:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802b93:	74 1c                	je     802bb1 <spawnl+0x64>
+  802b95:	83 c1 01             	add    $0x1,%ecx
+  802b98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b9b:	83 f8 2f             	cmp    $0x2f,%eax
+  802b9e:	77 e3                	ja     802b83 <spawnl+0x36>
+  802ba0:	89 c2                	mov    %eax,%edx
+  802ba2:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  802ba6:	4c 01 d2             	add    %r10,%rdx
+  802ba9:	83 c0 08             	add    $0x8,%eax
+  802bac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802baf:	eb de                	jmp    802b8f <spawnl+0x42>
+    const char *argv[argc + 2];
+  802bb1:	8d 41 02             	lea    0x2(%rcx),%eax
+  802bb4:	48 98                	cltq
+  802bb6:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  802bbd:	00 
+  802bbe:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  802bc2:	48 29 c4             	sub    %rax,%rsp
+  802bc5:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  802bca:	4c 89 c0             	mov    %r8,%rax
+  802bcd:	48 c1 e8 03          	shr    $0x3,%rax
+  802bd1:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  802bd5:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  802bdc:	00 
+    argv[argc + 1] = NULL;
+  802bdd:	8d 41 01             	lea    0x1(%rcx),%eax
+  802be0:	48 98                	cltq
+  802be2:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  802be9:	00 
+    va_start(vl, arg0);
+  802bea:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802bf1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802bf5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802bf9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802bfd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  802c01:	85 c9                	test   %ecx,%ecx
+  802c03:	74 41                	je     802c46 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802c05:	49 89 c1             	mov    %rax,%r9
+  802c08:	49 8d 40 08          	lea    0x8(%r8),%rax
+  802c0c:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  802c0f:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  802c14:	eb 1b                	jmp    802c31 <spawnl+0xe4>
+  802c16:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802c1a:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  802c1e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  802c22:	48 8b 11             	mov    (%rcx),%rdx
+  802c25:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  802c28:	48 83 c0 08          	add    $0x8,%rax
+  802c2c:	48 39 f0             	cmp    %rsi,%rax
+  802c2f:	74 15                	je     802c46 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802c31:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802c34:	83 fa 2f             	cmp    $0x2f,%edx
+  802c37:	77 dd                	ja     802c16 <spawnl+0xc9>
+  802c39:	89 d1                	mov    %edx,%ecx
+  802c3b:	4c 01 c9             	add    %r9,%rcx
+  802c3e:	83 c2 08             	add    $0x8,%edx
+  802c41:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  802c44:	eb dc                	jmp    802c22 <spawnl+0xd5>
+    return spawn(prog, argv);
+  802c46:	4c 89 c6             	mov    %r8,%rsi
+  802c49:	48 b8 5f 24 80 00 00 	movabs $0x80245f,%rax
+  802c50:	00 00 00 
+  802c53:	ff d0                	call   *%rax
+}
+  802c55:	c9                   	leave
+  802c56:	c3                   	ret
+
+0000000000802c57 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802c57:	55                   	push   %rbp
+  802c58:	48 89 e5             	mov    %rsp,%rbp
+  802c5b:	41 54                	push   %r12
+  802c5d:	53                   	push   %rbx
+  802c5e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802c61:	48 b8 1a 1a 80 00 00 	movabs $0x801a1a,%rax
+  802c68:	00 00 00 
+  802c6b:	ff d0                	call   *%rax
+  802c6d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802c70:	48 be 98 3f 80 00 00 	movabs $0x803f98,%rsi
+  802c77:	00 00 00 
+  802c7a:	48 89 df             	mov    %rbx,%rdi
+  802c7d:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  802c84:	00 00 00 
+  802c87:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802c89:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802c8e:	41 2b 04 24          	sub    (%r12),%eax
+  802c92:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802c98:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802c9f:	00 00 00 
+    stat->st_dev = &devpipe;
+  802ca2:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  802ca9:	00 00 00 
+  802cac:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb8:	5b                   	pop    %rbx
+  802cb9:	41 5c                	pop    %r12
+  802cbb:	5d                   	pop    %rbp
+  802cbc:	c3                   	ret
+
+0000000000802cbd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802cbd:	55                   	push   %rbp
+  802cbe:	48 89 e5             	mov    %rsp,%rbp
+  802cc1:	41 54                	push   %r12
+  802cc3:	53                   	push   %rbx
+  802cc4:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802cc7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ccc:	48 89 fe             	mov    %rdi,%rsi
+  802ccf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd4:	49 bc 32 14 80 00 00 	movabs $0x801432,%r12
+  802cdb:	00 00 00 
+  802cde:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802ce1:	48 89 df             	mov    %rbx,%rdi
+  802ce4:	48 b8 1a 1a 80 00 00 	movabs $0x801a1a,%rax
+  802ceb:	00 00 00 
+  802cee:	ff d0                	call   *%rax
+  802cf0:	48 89 c6             	mov    %rax,%rsi
+  802cf3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cf8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cfd:	41 ff d4             	call   *%r12
+}
+  802d00:	5b                   	pop    %rbx
+  802d01:	41 5c                	pop    %r12
+  802d03:	5d                   	pop    %rbp
+  802d04:	c3                   	ret
+
+0000000000802d05 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d05:	55                   	push   %rbp
+  802d06:	48 89 e5             	mov    %rsp,%rbp
+  802d09:	41 57                	push   %r15
+  802d0b:	41 56                	push   %r14
+  802d0d:	41 55                	push   %r13
+  802d0f:	41 54                	push   %r12
+  802d11:	53                   	push   %rbx
+  802d12:	48 83 ec 18          	sub    $0x18,%rsp
+  802d16:	49 89 fc             	mov    %rdi,%r12
+  802d19:	49 89 f5             	mov    %rsi,%r13
+  802d1c:	49 89 d7             	mov    %rdx,%r15
+  802d1f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d23:	48 b8 1a 1a 80 00 00 	movabs $0x801a1a,%rax
+  802d2a:	00 00 00 
+  802d2d:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802d2f:	4d 85 ff             	test   %r15,%r15
+  802d32:	0f 84 af 00 00 00    	je     802de7 <devpipe_write+0xe2>
+  802d38:	48 89 c3             	mov    %rax,%rbx
+  802d3b:	4c 89 f8             	mov    %r15,%rax
+  802d3e:	4d 89 ef             	mov    %r13,%r15
+  802d41:	4c 01 e8             	add    %r13,%rax
+  802d44:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d48:	49 bd 3a 13 80 00 00 	movabs $0x80133a,%r13
+  802d4f:	00 00 00 
+            sys_yield();
+  802d52:	49 be d7 12 80 00 00 	movabs $0x8012d7,%r14
+  802d59:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802d5c:	8b 73 04             	mov    0x4(%rbx),%esi
+  802d5f:	48 63 ce             	movslq %esi,%rcx
+  802d62:	48 63 03             	movslq (%rbx),%rax
+  802d65:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802d6b:	48 39 c1             	cmp    %rax,%rcx
+  802d6e:	72 2e                	jb     802d9e <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d70:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802d75:	48 89 da             	mov    %rbx,%rdx
+  802d78:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d7d:	4c 89 e7             	mov    %r12,%rdi
+  802d80:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802d83:	85 c0                	test   %eax,%eax
+  802d85:	74 66                	je     802ded <devpipe_write+0xe8>
+            sys_yield();
+  802d87:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802d8a:	8b 73 04             	mov    0x4(%rbx),%esi
+  802d8d:	48 63 ce             	movslq %esi,%rcx
+  802d90:	48 63 03             	movslq (%rbx),%rax
+  802d93:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802d99:	48 39 c1             	cmp    %rax,%rcx
+  802d9c:	73 d2                	jae    802d70 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802d9e:	41 0f b6 3f          	movzbl (%r15),%edi
+  802da2:	48 89 ca             	mov    %rcx,%rdx
+  802da5:	48 c1 ea 03          	shr    $0x3,%rdx
+  802da9:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802db0:	08 10 20 
+  802db3:	48 f7 e2             	mul    %rdx
+  802db6:	48 c1 ea 06          	shr    $0x6,%rdx
+  802dba:	48 89 d0             	mov    %rdx,%rax
+  802dbd:	48 c1 e0 09          	shl    $0x9,%rax
+  802dc1:	48 29 d0             	sub    %rdx,%rax
+  802dc4:	48 c1 e0 03          	shl    $0x3,%rax
+  802dc8:	48 29 c1             	sub    %rax,%rcx
+  802dcb:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802dd0:	83 c6 01             	add    $0x1,%esi
+  802dd3:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802dd6:	49 83 c7 01          	add    $0x1,%r15
+  802dda:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dde:	49 39 c7             	cmp    %rax,%r15
+  802de1:	0f 85 75 ff ff ff    	jne    802d5c <devpipe_write+0x57>
+    return n;
+  802de7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802deb:	eb 05                	jmp    802df2 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802ded:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802df2:	48 83 c4 18          	add    $0x18,%rsp
+  802df6:	5b                   	pop    %rbx
+  802df7:	41 5c                	pop    %r12
+  802df9:	41 5d                	pop    %r13
+  802dfb:	41 5e                	pop    %r14
+  802dfd:	41 5f                	pop    %r15
+  802dff:	5d                   	pop    %rbp
+  802e00:	c3                   	ret
+
+0000000000802e01 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e01:	55                   	push   %rbp
+  802e02:	48 89 e5             	mov    %rsp,%rbp
+  802e05:	41 57                	push   %r15
+  802e07:	41 56                	push   %r14
+  802e09:	41 55                	push   %r13
+  802e0b:	41 54                	push   %r12
+  802e0d:	53                   	push   %rbx
+  802e0e:	48 83 ec 18          	sub    $0x18,%rsp
+  802e12:	49 89 fc             	mov    %rdi,%r12
+  802e15:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802e19:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e1d:	48 b8 1a 1a 80 00 00 	movabs $0x801a1a,%rax
+  802e24:	00 00 00 
+  802e27:	ff d0                	call   *%rax
+  802e29:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802e2c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802e32:	49 bd 3a 13 80 00 00 	movabs $0x80133a,%r13
+  802e39:	00 00 00 
+            sys_yield();
+  802e3c:	49 be d7 12 80 00 00 	movabs $0x8012d7,%r14
+  802e43:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802e46:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802e4b:	74 7d                	je     802eca <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802e4d:	8b 03                	mov    (%rbx),%eax
+  802e4f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802e52:	75 26                	jne    802e7a <devpipe_read+0x79>
+            if (i > 0) return i;
+  802e54:	4d 85 ff             	test   %r15,%r15
+  802e57:	75 77                	jne    802ed0 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802e59:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802e5e:	48 89 da             	mov    %rbx,%rdx
+  802e61:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e66:	4c 89 e7             	mov    %r12,%rdi
+  802e69:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802e6c:	85 c0                	test   %eax,%eax
+  802e6e:	74 72                	je     802ee2 <devpipe_read+0xe1>
+            sys_yield();
+  802e70:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802e73:	8b 03                	mov    (%rbx),%eax
+  802e75:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802e78:	74 df                	je     802e59 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802e7a:	48 63 c8             	movslq %eax,%rcx
+  802e7d:	48 89 ca             	mov    %rcx,%rdx
+  802e80:	48 c1 ea 03          	shr    $0x3,%rdx
+  802e84:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802e8b:	08 10 20 
+  802e8e:	48 89 d0             	mov    %rdx,%rax
+  802e91:	48 f7 e6             	mul    %rsi
+  802e94:	48 c1 ea 06          	shr    $0x6,%rdx
+  802e98:	48 89 d0             	mov    %rdx,%rax
+  802e9b:	48 c1 e0 09          	shl    $0x9,%rax
+  802e9f:	48 29 d0             	sub    %rdx,%rax
+  802ea2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802ea9:	00 
+  802eaa:	48 89 c8             	mov    %rcx,%rax
+  802ead:	48 29 d0             	sub    %rdx,%rax
+  802eb0:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802eb5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802eb9:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802ebd:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802ec0:	49 83 c7 01          	add    $0x1,%r15
+  802ec4:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802ec8:	75 83                	jne    802e4d <devpipe_read+0x4c>
+    return n;
+  802eca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ece:	eb 03                	jmp    802ed3 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802ed0:	4c 89 f8             	mov    %r15,%rax
+}
+  802ed3:	48 83 c4 18          	add    $0x18,%rsp
+  802ed7:	5b                   	pop    %rbx
+  802ed8:	41 5c                	pop    %r12
+  802eda:	41 5d                	pop    %r13
+  802edc:	41 5e                	pop    %r14
+  802ede:	41 5f                	pop    %r15
+  802ee0:	5d                   	pop    %rbp
+  802ee1:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee7:	eb ea                	jmp    802ed3 <devpipe_read+0xd2>
+
+0000000000802ee9 <pipe>:
+pipe(int pfd[2]) {
+  802ee9:	55                   	push   %rbp
+  802eea:	48 89 e5             	mov    %rsp,%rbp
+  802eed:	41 55                	push   %r13
+  802eef:	41 54                	push   %r12
+  802ef1:	53                   	push   %rbx
+  802ef2:	48 83 ec 18          	sub    $0x18,%rsp
+  802ef6:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802ef9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802efd:	48 b8 36 1a 80 00 00 	movabs $0x801a36,%rax
+  802f04:	00 00 00 
+  802f07:	ff d0                	call   *%rax
+  802f09:	89 c3                	mov    %eax,%ebx
+  802f0b:	85 c0                	test   %eax,%eax
+  802f0d:	0f 88 a0 01 00 00    	js     8030b3 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802f13:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f18:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f1d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f21:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f26:	48 b8 66 13 80 00 00 	movabs $0x801366,%rax
+  802f2d:	00 00 00 
+  802f30:	ff d0                	call   *%rax
+  802f32:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802f34:	85 c0                	test   %eax,%eax
+  802f36:	0f 88 77 01 00 00    	js     8030b3 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802f3c:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802f40:	48 b8 36 1a 80 00 00 	movabs $0x801a36,%rax
+  802f47:	00 00 00 
+  802f4a:	ff d0                	call   *%rax
+  802f4c:	89 c3                	mov    %eax,%ebx
+  802f4e:	85 c0                	test   %eax,%eax
+  802f50:	0f 88 43 01 00 00    	js     803099 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802f56:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f5b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f60:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802f64:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f69:	48 b8 66 13 80 00 00 	movabs $0x801366,%rax
+  802f70:	00 00 00 
+  802f73:	ff d0                	call   *%rax
+  802f75:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802f77:	85 c0                	test   %eax,%eax
+  802f79:	0f 88 1a 01 00 00    	js     803099 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802f7f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f83:	48 b8 1a 1a 80 00 00 	movabs $0x801a1a,%rax
+  802f8a:	00 00 00 
+  802f8d:	ff d0                	call   *%rax
+  802f8f:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802f92:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f97:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f9c:	48 89 c6             	mov    %rax,%rsi
+  802f9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fa4:	48 b8 66 13 80 00 00 	movabs $0x801366,%rax
+  802fab:	00 00 00 
+  802fae:	ff d0                	call   *%rax
+  802fb0:	89 c3                	mov    %eax,%ebx
+  802fb2:	85 c0                	test   %eax,%eax
+  802fb4:	0f 88 c5 00 00 00    	js     80307f <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802fba:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802fbe:	48 b8 1a 1a 80 00 00 	movabs $0x801a1a,%rax
+  802fc5:	00 00 00 
+  802fc8:	ff d0                	call   *%rax
+  802fca:	48 89 c1             	mov    %rax,%rcx
+  802fcd:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802fd3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802fd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fde:	4c 89 ee             	mov    %r13,%rsi
+  802fe1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fe6:	48 b8 cd 13 80 00 00 	movabs $0x8013cd,%rax
+  802fed:	00 00 00 
+  802ff0:	ff d0                	call   *%rax
+  802ff2:	89 c3                	mov    %eax,%ebx
+  802ff4:	85 c0                	test   %eax,%eax
+  802ff6:	78 6e                	js     803066 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802ff8:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ffd:	4c 89 ef             	mov    %r13,%rdi
+  803000:	48 b8 08 13 80 00 00 	movabs $0x801308,%rax
+  803007:	00 00 00 
+  80300a:	ff d0                	call   *%rax
+  80300c:	83 f8 02             	cmp    $0x2,%eax
+  80300f:	0f 85 ab 00 00 00    	jne    8030c0 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803015:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  80301c:	00 00 
+  80301e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803022:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803024:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803028:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80302f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803033:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803035:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803039:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803040:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803044:	48 bb 08 1a 80 00 00 	movabs $0x801a08,%rbx
+  80304b:	00 00 00 
+  80304e:	ff d3                	call   *%rbx
+  803050:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803054:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803058:	ff d3                	call   *%rbx
+  80305a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80305f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803064:	eb 4d                	jmp    8030b3 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803066:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80306b:	4c 89 ee             	mov    %r13,%rsi
+  80306e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803073:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  80307a:	00 00 00 
+  80307d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80307f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803084:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803088:	bf 00 00 00 00       	mov    $0x0,%edi
+  80308d:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  803094:	00 00 00 
+  803097:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803099:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80309e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8030a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030a7:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  8030ae:	00 00 00 
+  8030b1:	ff d0                	call   *%rax
+}
+  8030b3:	89 d8                	mov    %ebx,%eax
+  8030b5:	48 83 c4 18          	add    $0x18,%rsp
+  8030b9:	5b                   	pop    %rbx
+  8030ba:	41 5c                	pop    %r12
+  8030bc:	41 5d                	pop    %r13
+  8030be:	5d                   	pop    %rbp
+  8030bf:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8030c0:	48 b9 b0 3f 80 00 00 	movabs $0x803fb0,%rcx
+  8030c7:	00 00 00 
+  8030ca:	48 ba 1a 3f 80 00 00 	movabs $0x803f1a,%rdx
+  8030d1:	00 00 00 
+  8030d4:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8030d9:	48 bf 9f 3f 80 00 00 	movabs $0x803f9f,%rdi
+  8030e0:	00 00 00 
+  8030e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030e8:	49 b8 41 03 80 00 00 	movabs $0x800341,%r8
+  8030ef:	00 00 00 
+  8030f2:	41 ff d0             	call   *%r8
+
+00000000008030f5 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8030f5:	55                   	push   %rbp
+  8030f6:	48 89 e5             	mov    %rsp,%rbp
+  8030f9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8030fd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803101:	48 b8 96 1a 80 00 00 	movabs $0x801a96,%rax
+  803108:	00 00 00 
+  80310b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80310d:	85 c0                	test   %eax,%eax
+  80310f:	78 35                	js     803146 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803111:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803115:	48 b8 1a 1a 80 00 00 	movabs $0x801a1a,%rax
+  80311c:	00 00 00 
+  80311f:	ff d0                	call   *%rax
+  803121:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803124:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803129:	be 00 10 00 00       	mov    $0x1000,%esi
+  80312e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803132:	48 b8 3a 13 80 00 00 	movabs $0x80133a,%rax
+  803139:	00 00 00 
+  80313c:	ff d0                	call   *%rax
+  80313e:	85 c0                	test   %eax,%eax
+  803140:	0f 94 c0             	sete   %al
+  803143:	0f b6 c0             	movzbl %al,%eax
+}
+  803146:	c9                   	leave
+  803147:	c3                   	ret
+
+0000000000803148 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803148:	55                   	push   %rbp
+  803149:	48 89 e5             	mov    %rsp,%rbp
+  80314c:	41 55                	push   %r13
+  80314e:	41 54                	push   %r12
+  803150:	53                   	push   %rbx
+  803151:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  803155:	85 ff                	test   %edi,%edi
+  803157:	74 6c                	je     8031c5 <wait+0x7d>
+  803159:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  80315c:	40 0f b6 c7          	movzbl %dil,%eax
+
+    while (env->env_id == envid &&
+  803160:	40 0f b6 cf          	movzbl %dil,%ecx
+  803164:	48 69 c9 b0 06 00 00 	imul   $0x6b0,%rcx,%rcx
+  80316b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803172:	00 00 00 
+  803175:	48 01 ca             	add    %rcx,%rdx
+  803178:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80317e:	39 d7                	cmp    %edx,%edi
+  803180:	75 38                	jne    8031ba <wait+0x72>
+           env->env_status != ENV_FREE) {
+  803182:	48 98                	cltq
+  803184:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80318b:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803192:	00 00 00 
+  803195:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  803198:	49 bd d7 12 80 00 00 	movabs $0x8012d7,%r13
+  80319f:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8031a2:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8031a8:	85 c0                	test   %eax,%eax
+  8031aa:	74 0e                	je     8031ba <wait+0x72>
+        sys_yield();
+  8031ac:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8031af:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8031b5:	44 39 e0             	cmp    %r12d,%eax
+  8031b8:	74 e8                	je     8031a2 <wait+0x5a>
+    }
+}
+  8031ba:	48 83 c4 08          	add    $0x8,%rsp
+  8031be:	5b                   	pop    %rbx
+  8031bf:	41 5c                	pop    %r12
+  8031c1:	41 5d                	pop    %r13
+  8031c3:	5d                   	pop    %rbp
+  8031c4:	c3                   	ret
+    assert(envid != 0);
+  8031c5:	48 b9 d4 3f 80 00 00 	movabs $0x803fd4,%rcx
+  8031cc:	00 00 00 
+  8031cf:	48 ba 1a 3f 80 00 00 	movabs $0x803f1a,%rdx
+  8031d6:	00 00 00 
+  8031d9:	be 06 00 00 00       	mov    $0x6,%esi
+  8031de:	48 bf df 3f 80 00 00 	movabs $0x803fdf,%rdi
+  8031e5:	00 00 00 
+  8031e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ed:	49 b8 41 03 80 00 00 	movabs $0x800341,%r8
+  8031f4:	00 00 00 
+  8031f7:	41 ff d0             	call   *%r8
+
+00000000008031fa <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8031fa:	48 89 f8             	mov    %rdi,%rax
+  8031fd:	48 c1 e8 27          	shr    $0x27,%rax
+  803201:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803208:	01 00 00 
+  80320b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80320f:	f6 c2 01             	test   $0x1,%dl
+  803212:	74 6d                	je     803281 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803214:	48 89 f8             	mov    %rdi,%rax
+  803217:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80321b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803222:	01 00 00 
+  803225:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803229:	f6 c2 01             	test   $0x1,%dl
+  80322c:	74 62                	je     803290 <get_uvpt_entry+0x96>
+  80322e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803235:	01 00 00 
+  803238:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80323c:	f6 c2 80             	test   $0x80,%dl
+  80323f:	75 4f                	jne    803290 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803241:	48 89 f8             	mov    %rdi,%rax
+  803244:	48 c1 e8 15          	shr    $0x15,%rax
+  803248:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80324f:	01 00 00 
+  803252:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803256:	f6 c2 01             	test   $0x1,%dl
+  803259:	74 44                	je     80329f <get_uvpt_entry+0xa5>
+  80325b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803262:	01 00 00 
+  803265:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803269:	f6 c2 80             	test   $0x80,%dl
+  80326c:	75 31                	jne    80329f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80326e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803272:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803279:	01 00 00 
+  80327c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803280:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803281:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803288:	01 00 00 
+  80328b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80328f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803290:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803297:	01 00 00 
+  80329a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80329e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80329f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8032a6:	01 00 00 
+  8032a9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8032ad:	c3                   	ret
+
+00000000008032ae <get_prot>:
+
+int
+get_prot(void *va) {
+  8032ae:	55                   	push   %rbp
+  8032af:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8032b2:	48 b8 fa 31 80 00 00 	movabs $0x8031fa,%rax
+  8032b9:	00 00 00 
+  8032bc:	ff d0                	call   *%rax
+  8032be:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8032c1:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8032c6:	89 c1                	mov    %eax,%ecx
+  8032c8:	83 c9 04             	or     $0x4,%ecx
+  8032cb:	f6 c2 01             	test   $0x1,%dl
+  8032ce:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8032d1:	89 c1                	mov    %eax,%ecx
+  8032d3:	83 c9 02             	or     $0x2,%ecx
+  8032d6:	f6 c2 02             	test   $0x2,%dl
+  8032d9:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8032dc:	89 c1                	mov    %eax,%ecx
+  8032de:	83 c9 01             	or     $0x1,%ecx
+  8032e1:	48 85 d2             	test   %rdx,%rdx
+  8032e4:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8032e7:	89 c1                	mov    %eax,%ecx
+  8032e9:	83 c9 40             	or     $0x40,%ecx
+  8032ec:	f6 c6 04             	test   $0x4,%dh
+  8032ef:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8032f2:	5d                   	pop    %rbp
+  8032f3:	c3                   	ret
+
+00000000008032f4 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8032f4:	55                   	push   %rbp
+  8032f5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8032f8:	48 b8 fa 31 80 00 00 	movabs $0x8031fa,%rax
+  8032ff:	00 00 00 
+  803302:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803304:	48 c1 e8 06          	shr    $0x6,%rax
+  803308:	83 e0 01             	and    $0x1,%eax
+}
+  80330b:	5d                   	pop    %rbp
+  80330c:	c3                   	ret
+
+000000000080330d <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80330d:	55                   	push   %rbp
+  80330e:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803311:	48 b8 fa 31 80 00 00 	movabs $0x8031fa,%rax
+  803318:	00 00 00 
+  80331b:	ff d0                	call   *%rax
+  80331d:	83 e0 01             	and    $0x1,%eax
+}
+  803320:	5d                   	pop    %rbp
+  803321:	c3                   	ret
+
+0000000000803322 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803322:	55                   	push   %rbp
+  803323:	48 89 e5             	mov    %rsp,%rbp
+  803326:	41 57                	push   %r15
+  803328:	41 56                	push   %r14
+  80332a:	41 55                	push   %r13
+  80332c:	41 54                	push   %r12
+  80332e:	53                   	push   %rbx
+  80332f:	48 83 ec 18          	sub    $0x18,%rsp
+  803333:	49 89 ff             	mov    %rdi,%r15
+  803336:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80333a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  80333f:	49 bc 0d 33 80 00 00 	movabs $0x80330d,%r12
+  803346:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  803349:	49 be ae 32 80 00 00 	movabs $0x8032ae,%r14
+  803350:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  803353:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  80335a:	00 00 00 
+  80335d:	eb 0c                	jmp    80336b <foreach_shared_region+0x49>
+  80335f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803366:	4c 39 eb             	cmp    %r13,%rbx
+  803369:	74 38                	je     8033a3 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  80336b:	48 89 df             	mov    %rbx,%rdi
+  80336e:	41 ff d4             	call   *%r12
+  803371:	84 c0                	test   %al,%al
+  803373:	74 ea                	je     80335f <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  803375:	48 89 df             	mov    %rbx,%rdi
+  803378:	41 ff d6             	call   *%r14
+  80337b:	a8 40                	test   $0x40,%al
+  80337d:	74 e0                	je     80335f <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  80337f:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803386:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80338a:	48 89 df             	mov    %rbx,%rdi
+  80338d:	41 ff d7             	call   *%r15
+        if (err)
+  803390:	85 c0                	test   %eax,%eax
+  803392:	74 cb                	je     80335f <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  803394:	48 83 c4 18          	add    $0x18,%rsp
+  803398:	5b                   	pop    %rbx
+  803399:	41 5c                	pop    %r12
+  80339b:	41 5d                	pop    %r13
+  80339d:	41 5e                	pop    %r14
+  80339f:	41 5f                	pop    %r15
+  8033a1:	5d                   	pop    %rbp
+  8033a2:	c3                   	ret
+    return 0;
+  8033a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a8:	eb ea                	jmp    803394 <foreach_shared_region+0x72>
+
+00000000008033aa <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8033aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033af:	c3                   	ret
+
+00000000008033b0 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8033b0:	55                   	push   %rbp
+  8033b1:	48 89 e5             	mov    %rsp,%rbp
+  8033b4:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8033b7:	48 be ea 3f 80 00 00 	movabs $0x803fea,%rsi
+  8033be:	00 00 00 
+  8033c1:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  8033c8:	00 00 00 
+  8033cb:	ff d0                	call   *%rax
+    return 0;
+}
+  8033cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d2:	5d                   	pop    %rbp
+  8033d3:	c3                   	ret
+
+00000000008033d4 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8033d4:	55                   	push   %rbp
+  8033d5:	48 89 e5             	mov    %rsp,%rbp
+  8033d8:	41 57                	push   %r15
+  8033da:	41 56                	push   %r14
+  8033dc:	41 55                	push   %r13
+  8033de:	41 54                	push   %r12
+  8033e0:	53                   	push   %rbx
+  8033e1:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8033e8:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8033ef:	48 85 d2             	test   %rdx,%rdx
+  8033f2:	74 7a                	je     80346e <devcons_write+0x9a>
+  8033f4:	49 89 d6             	mov    %rdx,%r14
+  8033f7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8033fd:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803402:	49 bf b0 0f 80 00 00 	movabs $0x800fb0,%r15
+  803409:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80340c:	4c 89 f3             	mov    %r14,%rbx
+  80340f:	48 29 f3             	sub    %rsi,%rbx
+  803412:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803417:	48 39 c3             	cmp    %rax,%rbx
+  80341a:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80341e:	4c 63 eb             	movslq %ebx,%r13
+  803421:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803428:	48 01 c6             	add    %rax,%rsi
+  80342b:	4c 89 ea             	mov    %r13,%rdx
+  80342e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803435:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803438:	4c 89 ee             	mov    %r13,%rsi
+  80343b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803442:	48 b8 dd 11 80 00 00 	movabs $0x8011dd,%rax
+  803449:	00 00 00 
+  80344c:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80344e:	41 01 dc             	add    %ebx,%r12d
+  803451:	49 63 f4             	movslq %r12d,%rsi
+  803454:	4c 39 f6             	cmp    %r14,%rsi
+  803457:	72 b3                	jb     80340c <devcons_write+0x38>
+    return res;
+  803459:	49 63 c4             	movslq %r12d,%rax
+}
+  80345c:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803463:	5b                   	pop    %rbx
+  803464:	41 5c                	pop    %r12
+  803466:	41 5d                	pop    %r13
+  803468:	41 5e                	pop    %r14
+  80346a:	41 5f                	pop    %r15
+  80346c:	5d                   	pop    %rbp
+  80346d:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80346e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803474:	eb e3                	jmp    803459 <devcons_write+0x85>
+
+0000000000803476 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803476:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803479:	ba 00 00 00 00       	mov    $0x0,%edx
+  80347e:	48 85 c0             	test   %rax,%rax
+  803481:	74 55                	je     8034d8 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803483:	55                   	push   %rbp
+  803484:	48 89 e5             	mov    %rsp,%rbp
+  803487:	41 55                	push   %r13
+  803489:	41 54                	push   %r12
+  80348b:	53                   	push   %rbx
+  80348c:	48 83 ec 08          	sub    $0x8,%rsp
+  803490:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803493:	48 bb 0a 12 80 00 00 	movabs $0x80120a,%rbx
+  80349a:	00 00 00 
+  80349d:	49 bc d7 12 80 00 00 	movabs $0x8012d7,%r12
+  8034a4:	00 00 00 
+  8034a7:	eb 03                	jmp    8034ac <devcons_read+0x36>
+  8034a9:	41 ff d4             	call   *%r12
+  8034ac:	ff d3                	call   *%rbx
+  8034ae:	85 c0                	test   %eax,%eax
+  8034b0:	74 f7                	je     8034a9 <devcons_read+0x33>
+    if (c < 0) return c;
+  8034b2:	48 63 d0             	movslq %eax,%rdx
+  8034b5:	78 13                	js     8034ca <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8034b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034bc:	83 f8 04             	cmp    $0x4,%eax
+  8034bf:	74 09                	je     8034ca <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8034c1:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8034c5:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8034ca:	48 89 d0             	mov    %rdx,%rax
+  8034cd:	48 83 c4 08          	add    $0x8,%rsp
+  8034d1:	5b                   	pop    %rbx
+  8034d2:	41 5c                	pop    %r12
+  8034d4:	41 5d                	pop    %r13
+  8034d6:	5d                   	pop    %rbp
+  8034d7:	c3                   	ret
+  8034d8:	48 89 d0             	mov    %rdx,%rax
+  8034db:	c3                   	ret
+
+00000000008034dc <cputchar>:
+cputchar(int ch) {
+  8034dc:	55                   	push   %rbp
+  8034dd:	48 89 e5             	mov    %rsp,%rbp
+  8034e0:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8034e4:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8034e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8034ed:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8034f1:	48 b8 dd 11 80 00 00 	movabs $0x8011dd,%rax
+  8034f8:	00 00 00 
+  8034fb:	ff d0                	call   *%rax
+}
+  8034fd:	c9                   	leave
+  8034fe:	c3                   	ret
+
+00000000008034ff <getchar>:
+getchar(void) {
+  8034ff:	55                   	push   %rbp
+  803500:	48 89 e5             	mov    %rsp,%rbp
+  803503:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803507:	ba 01 00 00 00       	mov    $0x1,%edx
+  80350c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803510:	bf 00 00 00 00       	mov    $0x0,%edi
+  803515:	48 b8 79 1d 80 00 00 	movabs $0x801d79,%rax
+  80351c:	00 00 00 
+  80351f:	ff d0                	call   *%rax
+  803521:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803523:	85 c0                	test   %eax,%eax
+  803525:	78 06                	js     80352d <getchar+0x2e>
+  803527:	74 08                	je     803531 <getchar+0x32>
+  803529:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80352d:	89 d0                	mov    %edx,%eax
+  80352f:	c9                   	leave
+  803530:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803531:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803536:	eb f5                	jmp    80352d <getchar+0x2e>
+
+0000000000803538 <iscons>:
+iscons(int fdnum) {
+  803538:	55                   	push   %rbp
+  803539:	48 89 e5             	mov    %rsp,%rbp
+  80353c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803540:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803544:	48 b8 96 1a 80 00 00 	movabs $0x801a96,%rax
+  80354b:	00 00 00 
+  80354e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803550:	85 c0                	test   %eax,%eax
+  803552:	78 18                	js     80356c <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803554:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803558:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  80355f:	00 00 00 
+  803562:	8b 00                	mov    (%rax),%eax
+  803564:	39 02                	cmp    %eax,(%rdx)
+  803566:	0f 94 c0             	sete   %al
+  803569:	0f b6 c0             	movzbl %al,%eax
+}
+  80356c:	c9                   	leave
+  80356d:	c3                   	ret
+
+000000000080356e <opencons>:
+opencons(void) {
+  80356e:	55                   	push   %rbp
+  80356f:	48 89 e5             	mov    %rsp,%rbp
+  803572:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803576:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80357a:	48 b8 36 1a 80 00 00 	movabs $0x801a36,%rax
+  803581:	00 00 00 
+  803584:	ff d0                	call   *%rax
+  803586:	85 c0                	test   %eax,%eax
+  803588:	78 49                	js     8035d3 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80358a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80358f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803594:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803598:	bf 00 00 00 00       	mov    $0x0,%edi
+  80359d:	48 b8 66 13 80 00 00 	movabs $0x801366,%rax
+  8035a4:	00 00 00 
+  8035a7:	ff d0                	call   *%rax
+  8035a9:	85 c0                	test   %eax,%eax
+  8035ab:	78 26                	js     8035d3 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8035ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8035b1:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  8035b8:	00 00 
+  8035ba:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8035bc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8035c0:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8035c7:	48 b8 08 1a 80 00 00 	movabs $0x801a08,%rax
+  8035ce:	00 00 00 
+  8035d1:	ff d0                	call   *%rax
+}
+  8035d3:	c9                   	leave
+  8035d4:	c3                   	ret
+
+00000000008035d5 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8035d5:	55                   	push   %rbp
+  8035d6:	48 89 e5             	mov    %rsp,%rbp
+  8035d9:	41 54                	push   %r12
+  8035db:	53                   	push   %rbx
+  8035dc:	48 89 fb             	mov    %rdi,%rbx
+  8035df:	48 89 f7             	mov    %rsi,%rdi
+  8035e2:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8035e5:	48 85 f6             	test   %rsi,%rsi
+  8035e8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8035ef:	00 00 00 
+  8035f2:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  8035f6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8035fb:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  803602:	00 00 00 
+  803605:	ff d0                	call   *%rax
+    if (res < 0) {
+  803607:	85 c0                	test   %eax,%eax
+  803609:	78 45                	js     803650 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  80360b:	48 85 db             	test   %rbx,%rbx
+  80360e:	74 12                	je     803622 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  803610:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803617:	00 00 00 
+  80361a:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  803620:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  803622:	4d 85 e4             	test   %r12,%r12
+  803625:	74 14                	je     80363b <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  803627:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80362e:	00 00 00 
+  803631:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  803637:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  80363b:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803642:	00 00 00 
+  803645:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  80364b:	5b                   	pop    %rbx
+  80364c:	41 5c                	pop    %r12
+  80364e:	5d                   	pop    %rbp
+  80364f:	c3                   	ret
+        if (from_env_store)
+  803650:	48 85 db             	test   %rbx,%rbx
+  803653:	74 06                	je     80365b <ipc_recv+0x86>
+            *from_env_store = 0;
+  803655:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  80365b:	4d 85 e4             	test   %r12,%r12
+  80365e:	74 eb                	je     80364b <ipc_recv+0x76>
+            *perm_store = 0;
+  803660:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803667:	00 
+  803668:	eb e1                	jmp    80364b <ipc_recv+0x76>
+
+000000000080366a <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80366a:	55                   	push   %rbp
+  80366b:	48 89 e5             	mov    %rsp,%rbp
+  80366e:	41 57                	push   %r15
+  803670:	41 56                	push   %r14
+  803672:	41 55                	push   %r13
+  803674:	41 54                	push   %r12
+  803676:	53                   	push   %rbx
+  803677:	48 83 ec 18          	sub    $0x18,%rsp
+  80367b:	41 89 fd             	mov    %edi,%r13d
+  80367e:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803681:	48 89 d3             	mov    %rdx,%rbx
+  803684:	49 89 cc             	mov    %rcx,%r12
+  803687:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  80368b:	48 85 d2             	test   %rdx,%rdx
+  80368e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803695:	00 00 00 
+  803698:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80369c:	49 be a4 16 80 00 00 	movabs $0x8016a4,%r14
+  8036a3:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  8036a6:	49 bf d7 12 80 00 00 	movabs $0x8012d7,%r15
+  8036ad:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  8036b0:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8036b3:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8036b7:	4c 89 e1             	mov    %r12,%rcx
+  8036ba:	48 89 da             	mov    %rbx,%rdx
+  8036bd:	44 89 ef             	mov    %r13d,%edi
+  8036c0:	41 ff d6             	call   *%r14
+        if (res == 0)
+  8036c3:	85 c0                	test   %eax,%eax
+  8036c5:	74 34                	je     8036fb <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  8036c7:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8036ca:	75 05                	jne    8036d1 <ipc_send+0x67>
+        sys_yield();
+  8036cc:	41 ff d7             	call   *%r15
+    while (true) {
+  8036cf:	eb df                	jmp    8036b0 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  8036d1:	48 ba f6 3f 80 00 00 	movabs $0x803ff6,%rdx
+  8036d8:	00 00 00 
+  8036db:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8036e0:	48 bf 0f 40 80 00 00 	movabs $0x80400f,%rdi
+  8036e7:	00 00 00 
+  8036ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ef:	48 b9 41 03 80 00 00 	movabs $0x800341,%rcx
+  8036f6:	00 00 00 
+  8036f9:	ff d1                	call   *%rcx
+    }
+}
+  8036fb:	48 83 c4 18          	add    $0x18,%rsp
+  8036ff:	5b                   	pop    %rbx
+  803700:	41 5c                	pop    %r12
+  803702:	41 5d                	pop    %r13
+  803704:	41 5e                	pop    %r14
+  803706:	41 5f                	pop    %r15
+  803708:	5d                   	pop    %rbp
+  803709:	c3                   	ret
+
+000000000080370a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80370a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80370f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803716:	00 00 00 
+  803719:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  803720:	48 01 ca             	add    %rcx,%rdx
+  803723:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  803729:	39 fa                	cmp    %edi,%edx
+  80372b:	74 12                	je     80373f <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80372d:	48 83 c0 01          	add    $0x1,%rax
+  803731:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  803737:	75 e0                	jne    803719 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803739:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80373e:	c3                   	ret
+            return envs[i].env_id;
+  80373f:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  803746:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80374d:	00 00 00 
+  803750:	48 01 d0             	add    %rdx,%rax
+  803753:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803759:	c3                   	ret
+  80375a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000803760 <__rodata_start>:
+  803760:	72 69                	jb     8037cb <__rodata_start+0x6b>
+  803762:	67 68 74 00 77 72    	addr32 push $0x72770074
+  803768:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803769:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80376a:	67 00 73 79          	add    %dh,0x79(%ebx)
+  80376e:	73 5f                	jae    8037cf <__rodata_start+0x6f>
+  803770:	70 61                	jo     8037d3 <__rodata_start+0x73>
+  803772:	67 65 5f             	addr32 gs pop %rdi
+  803775:	61                   	(bad)
+  803776:	6c                   	insb   (%dx),%es:(%rdi)
+  803777:	6c                   	insb   (%dx),%es:(%rdi)
+  803778:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803779:	63 3a                	movsxd (%rdx),%edi
+  80377b:	20 25 69 00 75 73    	and    %ah,0x73750069(%rip)        # 73f537ea <__bss_end+0x7374a7ea>
+  803781:	65 72 2f             	gs jb  8037b3 <__rodata_start+0x53>
+  803784:	74 65                	je     8037eb <__rodata_start+0x8b>
+  803786:	73 74                	jae    8037fc <__rodata_start+0x9c>
+  803788:	70 74                	jo     8037fe <__rodata_start+0x9e>
+  80378a:	65 73 68             	gs jae 8037f5 <__rodata_start+0x95>
+  80378d:	61                   	(bad)
+  80378e:	72 65                	jb     8037f5 <__rodata_start+0x95>
+  803790:	2e 63 00             	cs movsxd (%rax),%eax
+  803793:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803795:	72 6b                	jb     803802 <__rodata_start+0xa2>
+  803797:	3a 20                	cmp    (%rax),%ah
+  803799:	25 69 00 66 6f       	and    $0x6f660069,%eax
+  80379e:	72 6b                	jb     80380b <__rodata_start+0xab>
+  8037a0:	20 68 61             	and    %ch,0x61(%rax)
+  8037a3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037a4:	64 6c                	fs insb (%dx),%es:(%rdi)
+  8037a6:	65 73 20             	gs jae 8037c9 <__rodata_start+0x69>
+  8037a9:	50                   	push   %rax
+  8037aa:	54                   	push   %rsp
+  8037ab:	45 5f                	rex.RB pop %r15
+  8037ad:	53                   	push   %rbx
+  8037ae:	48                   	rex.W
+  8037af:	41 52                	push   %r10
+  8037b1:	45 20 25 73 0a 00 61 	and    %r12b,0x61000a73(%rip)        # 6180422b <__bss_end+0x60ffb22b>
+  8037b8:	72 67                	jb     803821 <__rodata_start+0xc1>
+  8037ba:	00 2f                	add    %ch,(%rdi)
+  8037bc:	74 65                	je     803823 <__rodata_start+0xc3>
+  8037be:	73 74                	jae    803834 <__rodata_start+0xd4>
+  8037c0:	70 74                	jo     803836 <__rodata_start+0xd6>
+  8037c2:	65 73 68             	gs jae 80382d <__rodata_start+0xcd>
+  8037c5:	61                   	(bad)
+  8037c6:	72 65                	jb     80382d <__rodata_start+0xcd>
+  8037c8:	00 73 70             	add    %dh,0x70(%rbx)
+  8037cb:	61                   	(bad)
+  8037cc:	77 6e                	ja     80383c <__rodata_start+0xdc>
+  8037ce:	3a 20                	cmp    (%rax),%ah
+  8037d0:	25 69 00 73 70       	and    $0x70730069,%eax
+  8037d5:	61                   	(bad)
+  8037d6:	77 6e                	ja     803846 <__rodata_start+0xe6>
+  8037d8:	20 68 61             	and    %ch,0x61(%rax)
+  8037db:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037dc:	64 6c                	fs insb (%dx),%es:(%rdi)
+  8037de:	65 73 20             	gs jae 803801 <__rodata_start+0xa1>
+  8037e1:	50                   	push   %rax
+  8037e2:	54                   	push   %rsp
+  8037e3:	45 5f                	rex.RB pop %r15
+  8037e5:	53                   	push   %rbx
+  8037e6:	48                   	rex.W
+  8037e7:	41 52                	push   %r10
+  8037e9:	45 20 25 73 0a 00 67 	and    %r12b,0x67000a73(%rip)        # 67804263 <__bss_end+0x66ffb263>
+  8037f0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037f1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037f2:	64 62                	fs (bad)
+  8037f4:	79 65                	jns    80385b <__rodata_start+0xfb>
+  8037f6:	2c 20                	sub    $0x20,%al
+  8037f8:	77 6f                	ja     803869 <__rodata_start+0x109>
+  8037fa:	72 6c                	jb     803868 <__rodata_start+0x108>
+  8037fc:	64 0a 00             	or     %fs:(%rax),%al
+  8037ff:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  803804:	2c 20                	sub    $0x20,%al
+  803806:	77 6f                	ja     803877 <__rodata_start+0x117>
+  803808:	72 6c                	jb     803876 <__rodata_start+0x116>
+  80380a:	64 0a 00             	or     %fs:(%rax),%al
+  80380d:	3c 75                	cmp    $0x75,%al
+  80380f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803810:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803814:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803815:	3e 00 90 5b 25 30 38 	ds add %dl,0x3830255b(%rax)
+  80381c:	78 5d                	js     80387b <__rodata_start+0x11b>
+  80381e:	20 75 73             	and    %dh,0x73(%rbp)
+  803821:	65 72 20             	gs jb  803844 <__rodata_start+0xe4>
+  803824:	70 61                	jo     803887 <__rodata_start+0x127>
+  803826:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803827:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80382e:	73 20                	jae    803850 <__rodata_start+0xf0>
+  803830:	61                   	(bad)
+  803831:	74 20                	je     803853 <__rodata_start+0xf3>
+  803833:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803838:	3a 20                	cmp    (%rax),%ah
+  80383a:	00 30                	add    %dh,(%rax)
+  80383c:	31 32                	xor    %esi,(%rdx)
+  80383e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803845:	41                   	rex.B
+  803846:	42                   	rex.X
+  803847:	43                   	rex.XB
+  803848:	44                   	rex.R
+  803849:	45                   	rex.RB
+  80384a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80384d:	31 32                	xor    %esi,(%rdx)
+  80384f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803856:	61                   	(bad)
+  803857:	62 63 64 65 66       	(bad)
+  80385c:	00 28                	add    %ch,(%rax)
+  80385e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80385f:	75 6c                	jne    8038cd <__rodata_start+0x16d>
+  803861:	6c                   	insb   (%dx),%es:(%rdi)
+  803862:	29 00                	sub    %eax,(%rax)
+  803864:	65 72 72             	gs jb  8038d9 <__rodata_start+0x179>
+  803867:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803868:	72 20                	jb     80388a <__rodata_start+0x12a>
+  80386a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80386f:	73 70                	jae    8038e1 <__rodata_start+0x181>
+  803871:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803875:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80387c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80387d:	72 00                	jb     80387f <__rodata_start+0x11f>
+  80387f:	62 61 64 20 65       	(bad)
+  803884:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803885:	76 69                	jbe    8038f0 <__rodata_start+0x190>
+  803887:	72 6f                	jb     8038f8 <__rodata_start+0x198>
+  803889:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80388a:	6d                   	insl   (%dx),%es:(%rdi)
+  80388b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80388d:	74 00                	je     80388f <__rodata_start+0x12f>
+  80388f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803896:	20 70 61             	and    %dh,0x61(%rax)
+  803899:	72 61                	jb     8038fc <__rodata_start+0x19c>
+  80389b:	6d                   	insl   (%dx),%es:(%rdi)
+  80389c:	65 74 65             	gs je  803904 <__rodata_start+0x1a4>
+  80389f:	72 00                	jb     8038a1 <__rodata_start+0x141>
+  8038a1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038a2:	75 74                	jne    803918 <__rodata_start+0x1b8>
+  8038a4:	20 6f 66             	and    %ch,0x66(%rdi)
+  8038a7:	20 6d 65             	and    %ch,0x65(%rbp)
+  8038aa:	6d                   	insl   (%dx),%es:(%rdi)
+  8038ab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038ac:	72 79                	jb     803927 <__rodata_start+0x1c7>
+  8038ae:	00 6f 75             	add    %ch,0x75(%rdi)
+  8038b1:	74 20                	je     8038d3 <__rodata_start+0x173>
+  8038b3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038b4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8038b8:	76 69                	jbe    803923 <__rodata_start+0x1c3>
+  8038ba:	72 6f                	jb     80392b <__rodata_start+0x1cb>
+  8038bc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038bd:	6d                   	insl   (%dx),%es:(%rdi)
+  8038be:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8038c0:	74 73                	je     803935 <__rodata_start+0x1d5>
+  8038c2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8038c5:	72 72                	jb     803939 <__rodata_start+0x1d9>
+  8038c7:	75 70                	jne    803939 <__rodata_start+0x1d9>
+  8038c9:	74 65                	je     803930 <__rodata_start+0x1d0>
+  8038cb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8038d0:	75 67                	jne    803939 <__rodata_start+0x1d9>
+  8038d2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8038d5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8038d7:	00 73 65             	add    %dh,0x65(%rbx)
+  8038da:	67 6d                	insl   (%dx),%es:(%edi)
+  8038dc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8038de:	74 61                	je     803941 <__rodata_start+0x1e1>
+  8038e0:	74 69                	je     80394b <__rodata_start+0x1eb>
+  8038e2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038e3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038e4:	20 66 61             	and    %ah,0x61(%rsi)
+  8038e7:	75 6c                	jne    803955 <__rodata_start+0x1f5>
+  8038e9:	74 00                	je     8038eb <__rodata_start+0x18b>
+  8038eb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8038f2:	20 45 4c             	and    %al,0x4c(%rbp)
+  8038f5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8038f9:	61                   	(bad)
+  8038fa:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8038ff:	20 73 75             	and    %dh,0x75(%rbx)
+  803902:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803905:	73 79                	jae    803980 <__rodata_start+0x220>
+  803907:	73 74                	jae    80397d <__rodata_start+0x21d>
+  803909:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80390b:	20 63 61             	and    %ah,0x61(%rbx)
+  80390e:	6c                   	insb   (%dx),%es:(%rdi)
+  80390f:	6c                   	insb   (%dx),%es:(%rdi)
+  803910:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803913:	74 72                	je     803987 <__rodata_start+0x227>
+  803915:	79 20                	jns    803937 <__rodata_start+0x1d7>
+  803917:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803918:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803919:	74 20                	je     80393b <__rodata_start+0x1db>
+  80391b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80391d:	75 6e                	jne    80398d <__rodata_start+0x22d>
+  80391f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803923:	76 20                	jbe    803945 <__rodata_start+0x1e5>
+  803925:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80392c:	72 65                	jb     803993 <__rodata_start+0x233>
+  80392e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803931:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803932:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803936:	65 78 70             	gs js  8039a9 <__rodata_start+0x249>
+  803939:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80393e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803941:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803945:	20 66 69             	and    %ah,0x69(%rsi)
+  803948:	6c                   	insb   (%dx),%es:(%rdi)
+  803949:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80394d:	20 66 72             	and    %ah,0x72(%rsi)
+  803950:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803955:	61                   	(bad)
+  803956:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803959:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80395a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80395b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80395f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803962:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803963:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803964:	20 6d 61             	and    %ch,0x61(%rbp)
+  803967:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803968:	79 20                	jns    80398a <__rodata_start+0x22a>
+  80396a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803971:	72 65                	jb     8039d8 <__rodata_start+0x278>
+  803973:	20 6f 70             	and    %ch,0x70(%rdi)
+  803976:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803978:	00 66 69             	add    %ah,0x69(%rsi)
+  80397b:	6c                   	insb   (%dx),%es:(%rdi)
+  80397c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803980:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803983:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803984:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803987:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803988:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803989:	74 20                	je     8039ab <__rodata_start+0x24b>
+  80398b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80398d:	75 6e                	jne    8039fd <__rodata_start+0x29d>
+  80398f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803993:	76 61                	jbe    8039f6 <__rodata_start+0x296>
+  803995:	6c                   	insb   (%dx),%es:(%rdi)
+  803996:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80399d:	00 
+  80399e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8039a5:	72 65                	jb     803a0c <__rodata_start+0x2ac>
+  8039a7:	61                   	(bad)
+  8039a8:	64 79 20             	fs jns 8039cb <__rodata_start+0x26b>
+  8039ab:	65 78 69             	gs js  803a17 <__rodata_start+0x2b7>
+  8039ae:	73 74                	jae    803a24 <__rodata_start+0x2c4>
+  8039b0:	73 00                	jae    8039b2 <__rodata_start+0x252>
+  8039b2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039b3:	70 65                	jo     803a1a <__rodata_start+0x2ba>
+  8039b5:	72 61                	jb     803a18 <__rodata_start+0x2b8>
+  8039b7:	74 69                	je     803a22 <__rodata_start+0x2c2>
+  8039b9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039ba:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039bb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8039be:	74 20                	je     8039e0 <__rodata_start+0x280>
+  8039c0:	73 75                	jae    803a37 <__rodata_start+0x2d7>
+  8039c2:	70 70                	jo     803a34 <__rodata_start+0x2d4>
+  8039c4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039c5:	72 74                	jb     803a3b <__rodata_start+0x2db>
+  8039c7:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8039cc:	65 72 61             	gs jb  803a30 <__rodata_start+0x2d0>
+  8039cf:	74 69                	je     803a3a <__rodata_start+0x2da>
+  8039d1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039d2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039d3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8039d6:	74 20                	je     8039f8 <__rodata_start+0x298>
+  8039d8:	70 65                	jo     803a3f <__rodata_start+0x2df>
+  8039da:	72 6d                	jb     803a49 <__rodata_start+0x2e9>
+  8039dc:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  8039e3:	2e 
+  8039e4:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8039eb:	00 
+  8039ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8039f3:	00 00 00 
+  8039f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8039fd:	00 00 00 
+  803a00:	7e 06                	jle    803a08 <__rodata_start+0x2a8>
+  803a02:	80 00 00             	addb   $0x0,(%rax)
+  803a05:	00 00                	add    %al,(%rax)
+  803a07:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803a0d:	00 00                	add    %al,(%rax)
+  803a0f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803a15:	00 00                	add    %al,(%rax)
+  803a17:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803a1d:	00 00                	add    %al,(%rax)
+  803a1f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803a25:	00 00                	add    %al,(%rax)
+  803a27:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803a2d:	00 00                	add    %al,(%rax)
+  803a2f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803a35:	00 00                	add    %al,(%rax)
+  803a37:	00 9d 06 80 00 00    	add    %bl,0x8006(%rbp)
+  803a3d:	00 00                	add    %al,(%rax)
+  803a3f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803a45:	00 00                	add    %al,(%rax)
+  803a47:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803a4d:	00 00                	add    %al,(%rax)
+  803a4f:	00 91 06 80 00 00    	add    %dl,0x8006(%rcx)
+  803a55:	00 00                	add    %al,(%rax)
+  803a57:	00 0b                	add    %cl,(%rbx)
+  803a59:	07                   	(bad)
+  803a5a:	80 00 00             	addb   $0x0,(%rax)
+  803a5d:	00 00                	add    %al,(%rax)
+  803a5f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803a65:	00 00                	add    %al,(%rax)
+  803a67:	00 91 06 80 00 00    	add    %dl,0x8006(%rcx)
+  803a6d:	00 00                	add    %al,(%rax)
+  803a6f:	00 d7                	add    %dl,%bh
+  803a71:	06                   	(bad)
+  803a72:	80 00 00             	addb   $0x0,(%rax)
+  803a75:	00 00                	add    %al,(%rax)
+  803a77:	00 d7                	add    %dl,%bh
+  803a79:	06                   	(bad)
+  803a7a:	80 00 00             	addb   $0x0,(%rax)
+  803a7d:	00 00                	add    %al,(%rax)
+  803a7f:	00 d7                	add    %dl,%bh
+  803a81:	06                   	(bad)
+  803a82:	80 00 00             	addb   $0x0,(%rax)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 d7                	add    %dl,%bh
+  803a89:	06                   	(bad)
+  803a8a:	80 00 00             	addb   $0x0,(%rax)
+  803a8d:	00 00                	add    %al,(%rax)
+  803a8f:	00 d7                	add    %dl,%bh
+  803a91:	06                   	(bad)
+  803a92:	80 00 00             	addb   $0x0,(%rax)
+  803a95:	00 00                	add    %al,(%rax)
+  803a97:	00 d7                	add    %dl,%bh
+  803a99:	06                   	(bad)
+  803a9a:	80 00 00             	addb   $0x0,(%rax)
+  803a9d:	00 00                	add    %al,(%rax)
+  803a9f:	00 d7                	add    %dl,%bh
+  803aa1:	06                   	(bad)
+  803aa2:	80 00 00             	addb   $0x0,(%rax)
+  803aa5:	00 00                	add    %al,(%rax)
+  803aa7:	00 d7                	add    %dl,%bh
+  803aa9:	06                   	(bad)
+  803aaa:	80 00 00             	addb   $0x0,(%rax)
+  803aad:	00 00                	add    %al,(%rax)
+  803aaf:	00 d7                	add    %dl,%bh
+  803ab1:	06                   	(bad)
+  803ab2:	80 00 00             	addb   $0x0,(%rax)
+  803ab5:	00 00                	add    %al,(%rax)
+  803ab7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803abd:	00 00                	add    %al,(%rax)
+  803abf:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803ac5:	00 00                	add    %al,(%rax)
+  803ac7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803acd:	00 00                	add    %al,(%rax)
+  803acf:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803ad5:	00 00                	add    %al,(%rax)
+  803ad7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803add:	00 00                	add    %al,(%rax)
+  803adf:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803ae5:	00 00                	add    %al,(%rax)
+  803ae7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803aed:	00 00                	add    %al,(%rax)
+  803aef:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803af5:	00 00                	add    %al,(%rax)
+  803af7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803afd:	00 00                	add    %al,(%rax)
+  803aff:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b05:	00 00                	add    %al,(%rax)
+  803b07:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b1d:	00 00                	add    %al,(%rax)
+  803b1f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b25:	00 00                	add    %al,(%rax)
+  803b27:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b2d:	00 00                	add    %al,(%rax)
+  803b2f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b35:	00 00                	add    %al,(%rax)
+  803b37:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b3d:	00 00                	add    %al,(%rax)
+  803b3f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b45:	00 00                	add    %al,(%rax)
+  803b47:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b4d:	00 00                	add    %al,(%rax)
+  803b4f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b55:	00 00                	add    %al,(%rax)
+  803b57:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b5d:	00 00                	add    %al,(%rax)
+  803b5f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b65:	00 00                	add    %al,(%rax)
+  803b67:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b6d:	00 00                	add    %al,(%rax)
+  803b6f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b75:	00 00                	add    %al,(%rax)
+  803b77:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b7d:	00 00                	add    %al,(%rax)
+  803b7f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b85:	00 00                	add    %al,(%rax)
+  803b87:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b8d:	00 00                	add    %al,(%rax)
+  803b8f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b95:	00 00                	add    %al,(%rax)
+  803b97:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803b9d:	00 00                	add    %al,(%rax)
+  803b9f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803ba5:	00 00                	add    %al,(%rax)
+  803ba7:	00 e2                	add    %ah,%dl
+  803ba9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803baf:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803bb5:	00 00                	add    %al,(%rax)
+  803bb7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803bbd:	00 00                	add    %al,(%rax)
+  803bbf:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803bcd:	00 00                	add    %al,(%rax)
+  803bcf:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803bd5:	00 00                	add    %al,(%rax)
+  803bd7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803bdd:	00 00                	add    %al,(%rax)
+  803bdf:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803be5:	00 00                	add    %al,(%rax)
+  803be7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803bed:	00 00                	add    %al,(%rax)
+  803bef:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803bf5:	00 00                	add    %al,(%rax)
+  803bf7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803bfd:	00 00                	add    %al,(%rax)
+  803bff:	00 2e                	add    %ch,(%rsi)
+  803c01:	07                   	(bad)
+  803c02:	80 00 00             	addb   $0x0,(%rax)
+  803c05:	00 00                	add    %al,(%rax)
+  803c07:	00 fd                	add    %bh,%ch
+  803c09:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803c0f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803c15:	00 00                	add    %al,(%rax)
+  803c17:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803c1d:	00 00                	add    %al,(%rax)
+  803c1f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803c25:	00 00                	add    %al,(%rax)
+  803c27:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803c2d:	00 00                	add    %al,(%rax)
+  803c2f:	00 5d 07             	add    %bl,0x7(%rbp)
+  803c32:	80 00 00             	addb   $0x0,(%rax)
+  803c35:	00 00                	add    %al,(%rax)
+  803c37:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803c3d:	00 00                	add    %al,(%rax)
+  803c3f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 23                	add    %ah,(%rbx)
+  803c49:	07                   	(bad)
+  803c4a:	80 00 00             	addb   $0x0,(%rax)
+  803c4d:	00 00                	add    %al,(%rax)
+  803c4f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803c5d:	00 00                	add    %al,(%rax)
+  803c5f:	00 a5 0a 80 00 00    	add    %ah,0x800a(%rbp)
+  803c65:	00 00                	add    %al,(%rax)
+  803c67:	00 6f 0b             	add    %ch,0xb(%rdi)
+  803c6a:	80 00 00             	addb   $0x0,(%rax)
+  803c6d:	00 00                	add    %al,(%rax)
+  803c6f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803c75:	00 00                	add    %al,(%rax)
+  803c77:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803c7d:	00 00                	add    %al,(%rax)
+  803c7f:	00 f4                	add    %dh,%ah
+  803c81:	07                   	(bad)
+  803c82:	80 00 00             	addb   $0x0,(%rax)
+  803c85:	00 00                	add    %al,(%rax)
+  803c87:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803c8d:	00 00                	add    %al,(%rax)
+  803c8f:	00 d1                	add    %dl,%cl
+  803c91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803c97:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803c9d:	00 00                	add    %al,(%rax)
+  803c9f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 e2                	add    %ah,%dl
+  803ca9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803caf:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803cb5:	00 00                	add    %al,(%rax)
+  803cb7:	00 87 06 80 00 00    	add    %al,0x8006(%rdi)
+  803cbd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803cc0 <error_string>:
+	...
+  803cc8:	6d 38 80 00 00 00 00 00 7f 38 80 00 00 00 00 00     m8.......8......
+  803cd8:	8f 38 80 00 00 00 00 00 a1 38 80 00 00 00 00 00     .8.......8......
+  803ce8:	af 38 80 00 00 00 00 00 c3 38 80 00 00 00 00 00     .8.......8......
+  803cf8:	d8 38 80 00 00 00 00 00 eb 38 80 00 00 00 00 00     .8.......8......
+  803d08:	fd 38 80 00 00 00 00 00 11 39 80 00 00 00 00 00     .8.......9......
+  803d18:	21 39 80 00 00 00 00 00 34 39 80 00 00 00 00 00     !9......49......
+  803d28:	4b 39 80 00 00 00 00 00 61 39 80 00 00 00 00 00     K9......a9......
+  803d38:	79 39 80 00 00 00 00 00 91 39 80 00 00 00 00 00     y9.......9......
+  803d48:	9e 39 80 00 00 00 00 00 70 3d 80 00 00 00 00 00     .9......p=......
+  803d58:	b2 39 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .9..............
+  803d68:	ca 39 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .9......file is 
+  803d78:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803d88:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803d98:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803da8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803db8:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  803dc8:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  803dd8:	6c 69 62 2f 66 6f 72 6b 2e 63 00 0f 1f 44 00 00     lib/fork.c...D..
+  803de8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803df8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803e08:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803e18:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803e28:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803e38:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803e48:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803e58:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803e68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e78:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000803e80 <devtab>:
+  803e80:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  803e90:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  803ea0:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  803eb0:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  803ec0:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  803ed0:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  803ee0:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  803ef0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  803f00:	45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20 77     Elf magic %08x w
+  803f10:	61 6e 74 20 25 30 38 78 0a 00 61 73 73 65 72 74     ant %08x..assert
+  803f20:	69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00 6c     ion failed: %s.l
+  803f30:	69 62 2f 73 70 61 77 6e 2e 63 00 62 79 74 65 73     ib/spawn.c.bytes
+  803f40:	5f 72 65 61 64 20 3d 3d 20 66 69 6c 65 73 7a 00     _read == filesz.
+  803f50:	63 6f 70 79 5f 73 68 61 72 65 64 5f 72 65 67 69     copy_shared_regi
+  803f60:	6f 6e 3a 20 25 69 00 73 79 73 5f 65 6e 76 5f 73     on: %i.sys_env_s
+  803f70:	65 74 5f 74 72 61 70 66 72 61 6d 65 3a 20 25 69     et_trapframe: %i
+  803f80:	00 73 79 73 5f 65 6e 76 5f 73 65 74 5f 73 74 61     .sys_env_set_sta
+  803f90:	74 75 73 3a 20 25 69 00 3c 70 69 70 65 3e 00 6c     tus: %i.<pipe>.l
+  803fa0:	69 62 2f 70 69 70 65 2e 63 00 70 69 70 65 00 90     ib/pipe.c.pipe..
+  803fb0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803fc0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803fd0:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  803fe0:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  803ff0:	00 63 6f 6e 73 00 69 70 63 5f 73 65 6e 64 3a 20     .cons.ipc_send: 
+  804000:	66 61 69 6c 65 64 20 74 6f 20 73 65 6e 64 00 6c     failed to send.l
+  804010:	69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00     ib/ipc.c.f......
+  804020:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804030:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804040:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804050:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804060:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804070:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804080:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804090:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8040a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8040b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8040c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8040d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8040e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8040f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804100:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804110:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804120:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804130:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804140:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804150:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804160:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804170:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804180:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804190:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8041a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8041b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8041c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8041d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8041e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8041f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804200:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804210:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804220:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804230:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804240:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804250:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804260:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804270:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804280:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804290:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8042a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8042b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8042c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8042d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8042e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8042f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804300:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804310:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804320:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804330:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804340:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804350:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804360:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804370:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804380:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804390:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8043a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8043b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8043c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8043d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8043e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8043f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804400:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804410:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804420:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804430:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804440:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804450:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804460:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804470:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804480:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804490:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8044a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8044b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8044c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8044d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8044e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8044f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804500:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804510:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804520:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804530:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804540:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804550:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804560:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804570:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804580:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804590:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8045a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8045b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8045c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8045d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8045e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8045f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804600:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804610:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804620:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804630:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804640:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804650:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804660:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804670:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804680:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804690:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8046a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8046b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8046c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8046d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8046e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8046f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8047a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8047b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8047c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8047d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8047e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8047f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8048a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8048b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8048c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8048d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8048e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8048f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8049a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8049b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8049c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8049d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8049f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
@@ -0,0 +1,7048 @@
+
+obj/user/testshell:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 e5 06 00 00       	call   800708 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <wrong>:
+
+    breakpoint();
+}
+
+void
+wrong(int rfd, int kfd, int off, char c1, char c2) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+  800039:	89 fb                	mov    %edi,%ebx
+  80003b:	41 89 f4             	mov    %esi,%r12d
+  80003e:	41 89 d6             	mov    %edx,%r14d
+  800041:	41 89 cd             	mov    %ecx,%r13d
+  800044:	44 89 85 5c ff ff ff 	mov    %r8d,-0xa4(%rbp)
+    char buf[100];
+    int n;
+
+    seek(rfd, off);
+  80004b:	89 d6                	mov    %edx,%esi
+  80004d:	49 bf f2 23 80 00 00 	movabs $0x8023f2,%r15
+  800054:	00 00 00 
+  800057:	41 ff d7             	call   *%r15
+    seek(kfd, off);
+  80005a:	44 89 f6             	mov    %r14d,%esi
+  80005d:	44 89 e7             	mov    %r12d,%edi
+  800060:	41 ff d7             	call   *%r15
+
+    cprintf("shell produced incorrect output.\n");
+  800063:	48 bf c0 39 80 00 00 	movabs $0x8039c0,%rdi
+  80006a:	00 00 00 
+  80006d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800072:	49 be 22 09 80 00 00 	movabs $0x800922,%r14
+  800079:	00 00 00 
+  80007c:	41 ff d6             	call   *%r14
+    cprintf("expected:\n===\n%c", c1);
+  80007f:	41 0f be f5          	movsbl %r13b,%esi
+  800083:	48 bf 33 3a 80 00 00 	movabs $0x803a33,%rdi
+  80008a:	00 00 00 
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	41 ff d6             	call   *%r14
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  800095:	49 bd 0a 22 80 00 00 	movabs $0x80220a,%r13
+  80009c:	00 00 00 
+        sys_cputs(buf, n);
+  80009f:	49 be 6e 16 80 00 00 	movabs $0x80166e,%r14
+  8000a6:	00 00 00 
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  8000a9:	eb 0d                	jmp    8000b8 <wrong+0x93>
+        sys_cputs(buf, n);
+  8000ab:	48 63 f0             	movslq %eax,%rsi
+  8000ae:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  8000b5:	41 ff d6             	call   *%r14
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  8000b8:	ba 63 00 00 00       	mov    $0x63,%edx
+  8000bd:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  8000c4:	44 89 e7             	mov    %r12d,%edi
+  8000c7:	41 ff d5             	call   *%r13
+  8000ca:	85 c0                	test   %eax,%eax
+  8000cc:	7f dd                	jg     8000ab <wrong+0x86>
+    cprintf("===\ngot:\n===\n%c", c2);
+  8000ce:	0f be b5 5c ff ff ff 	movsbl -0xa4(%rbp),%esi
+  8000d5:	48 bf 44 3a 80 00 00 	movabs $0x803a44,%rdi
+  8000dc:	00 00 00 
+  8000df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e4:	48 ba 22 09 80 00 00 	movabs $0x800922,%rdx
+  8000eb:	00 00 00 
+  8000ee:	ff d2                	call   *%rdx
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  8000f0:	49 bc 0a 22 80 00 00 	movabs $0x80220a,%r12
+  8000f7:	00 00 00 
+        sys_cputs(buf, n);
+  8000fa:	49 bd 6e 16 80 00 00 	movabs $0x80166e,%r13
+  800101:	00 00 00 
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  800104:	eb 0d                	jmp    800113 <wrong+0xee>
+        sys_cputs(buf, n);
+  800106:	48 63 f0             	movslq %eax,%rsi
+  800109:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  800110:	41 ff d5             	call   *%r13
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  800113:	ba 63 00 00 00       	mov    $0x63,%edx
+  800118:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  80011f:	89 df                	mov    %ebx,%edi
+  800121:	41 ff d4             	call   *%r12
+  800124:	85 c0                	test   %eax,%eax
+  800126:	7f de                	jg     800106 <wrong+0xe1>
+    cprintf("===\n");
+  800128:	48 bf 54 3a 80 00 00 	movabs $0x803a54,%rdi
+  80012f:	00 00 00 
+  800132:	b8 00 00 00 00       	mov    $0x0,%eax
+  800137:	48 ba 22 09 80 00 00 	movabs $0x800922,%rdx
+  80013e:	00 00 00 
+  800141:	ff d2                	call   *%rdx
+    exit();
+  800143:	48 b8 af 07 80 00 00 	movabs $0x8007af,%rax
+  80014a:	00 00 00 
+  80014d:	ff d0                	call   *%rax
+}
+  80014f:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+  800156:	5b                   	pop    %rbx
+  800157:	41 5c                	pop    %r12
+  800159:	41 5d                	pop    %r13
+  80015b:	41 5e                	pop    %r14
+  80015d:	41 5f                	pop    %r15
+  80015f:	5d                   	pop    %rbp
+  800160:	c3                   	ret
+
+0000000000800161 <umain>:
+umain(int argc, char **argv) {
+  800161:	55                   	push   %rbp
+  800162:	48 89 e5             	mov    %rsp,%rbp
+  800165:	41 57                	push   %r15
+  800167:	41 56                	push   %r14
+  800169:	41 55                	push   %r13
+  80016b:	41 54                	push   %r12
+  80016d:	53                   	push   %rbx
+  80016e:	48 83 ec 28          	sub    $0x28,%rsp
+    close(0);
+  800172:	bf 00 00 00 00       	mov    $0x0,%edi
+  800177:	48 bb 8c 20 80 00 00 	movabs $0x80208c,%rbx
+  80017e:	00 00 00 
+  800181:	ff d3                	call   *%rbx
+    close(1);
+  800183:	bf 01 00 00 00       	mov    $0x1,%edi
+  800188:	ff d3                	call   *%rbx
+    opencons();
+  80018a:	48 bb a1 06 80 00 00 	movabs $0x8006a1,%rbx
+  800191:	00 00 00 
+  800194:	ff d3                	call   *%rbx
+    opencons();
+  800196:	ff d3                	call   *%rbx
+    if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  800198:	be 00 00 00 00       	mov    $0x0,%esi
+  80019d:	48 bf 59 3a 80 00 00 	movabs $0x803a59,%rdi
+  8001a4:	00 00 00 
+  8001a7:	48 b8 c8 27 80 00 00 	movabs $0x8027c8,%rax
+  8001ae:	00 00 00 
+  8001b1:	ff d0                	call   *%rax
+  8001b3:	89 c3                	mov    %eax,%ebx
+  8001b5:	85 c0                	test   %eax,%eax
+  8001b7:	0f 88 4c 01 00 00    	js     800309 <umain+0x1a8>
+    if ((wfd = pipe(pfds)) < 0)
+  8001bd:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  8001c1:	48 b8 7a 33 80 00 00 	movabs $0x80337a,%rax
+  8001c8:	00 00 00 
+  8001cb:	ff d0                	call   *%rax
+  8001cd:	85 c0                	test   %eax,%eax
+  8001cf:	0f 88 61 01 00 00    	js     800336 <umain+0x1d5>
+    wfd = pfds[1];
+  8001d5:	44 8b 65 c8          	mov    -0x38(%rbp),%r12d
+    cprintf("running sh -x < testshell.sh | cat\n");
+  8001d9:	48 bf e8 39 80 00 00 	movabs $0x8039e8,%rdi
+  8001e0:	00 00 00 
+  8001e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e8:	48 ba 22 09 80 00 00 	movabs $0x800922,%rdx
+  8001ef:	00 00 00 
+  8001f2:	ff d2                	call   *%rdx
+    if ((r = fork()) < 0)
+  8001f4:	48 b8 99 1d 80 00 00 	movabs $0x801d99,%rax
+  8001fb:	00 00 00 
+  8001fe:	ff d0                	call   *%rax
+  800200:	85 c0                	test   %eax,%eax
+  800202:	0f 88 5b 01 00 00    	js     800363 <umain+0x202>
+    if (r == 0) {
+  800208:	0f 85 a9 00 00 00    	jne    8002b7 <umain+0x156>
+        dup(rfd, 0);
+  80020e:	be 00 00 00 00       	mov    $0x0,%esi
+  800213:	89 df                	mov    %ebx,%edi
+  800215:	49 bd e7 20 80 00 00 	movabs $0x8020e7,%r13
+  80021c:	00 00 00 
+  80021f:	41 ff d5             	call   *%r13
+        dup(wfd, 1);
+  800222:	be 01 00 00 00       	mov    $0x1,%esi
+  800227:	44 89 e7             	mov    %r12d,%edi
+  80022a:	41 ff d5             	call   *%r13
+        close(rfd);
+  80022d:	89 df                	mov    %ebx,%edi
+  80022f:	49 bd 8c 20 80 00 00 	movabs $0x80208c,%r13
+  800236:	00 00 00 
+  800239:	41 ff d5             	call   *%r13
+        close(wfd);
+  80023c:	44 89 e7             	mov    %r12d,%edi
+  80023f:	41 ff d5             	call   *%r13
+        if ((r = spawnl("/sh", "sh", "-x", 0)) < 0)
+  800242:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800247:	48 ba 9f 3a 80 00 00 	movabs $0x803a9f,%rdx
+  80024e:	00 00 00 
+  800251:	48 be 63 3a 80 00 00 	movabs $0x803a63,%rsi
+  800258:	00 00 00 
+  80025b:	48 bf a2 3a 80 00 00 	movabs $0x803aa2,%rdi
+  800262:	00 00 00 
+  800265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026a:	49 b8 de 2f 80 00 00 	movabs $0x802fde,%r8
+  800271:	00 00 00 
+  800274:	41 ff d0             	call   *%r8
+  800277:	41 89 c5             	mov    %eax,%r13d
+  80027a:	85 c0                	test   %eax,%eax
+  80027c:	0f 88 0e 01 00 00    	js     800390 <umain+0x22f>
+        close(0);
+  800282:	bf 00 00 00 00       	mov    $0x0,%edi
+  800287:	49 be 8c 20 80 00 00 	movabs $0x80208c,%r14
+  80028e:	00 00 00 
+  800291:	41 ff d6             	call   *%r14
+        close(1);
+  800294:	bf 01 00 00 00       	mov    $0x1,%edi
+  800299:	41 ff d6             	call   *%r14
+        wait(r);
+  80029c:	44 89 ef             	mov    %r13d,%edi
+  80029f:	48 b8 d9 35 80 00 00 	movabs $0x8035d9,%rax
+  8002a6:	00 00 00 
+  8002a9:	ff d0                	call   *%rax
+        exit();
+  8002ab:	48 b8 af 07 80 00 00 	movabs $0x8007af,%rax
+  8002b2:	00 00 00 
+  8002b5:	ff d0                	call   *%rax
+    close(rfd);
+  8002b7:	89 df                	mov    %ebx,%edi
+  8002b9:	48 bb 8c 20 80 00 00 	movabs $0x80208c,%rbx
+  8002c0:	00 00 00 
+  8002c3:	ff d3                	call   *%rbx
+    close(wfd);
+  8002c5:	44 89 e7             	mov    %r12d,%edi
+  8002c8:	ff d3                	call   *%rbx
+    rfd = pfds[0];
+  8002ca:	44 8b 7d c4          	mov    -0x3c(%rbp),%r15d
+    if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  8002ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8002d3:	48 bf b0 3a 80 00 00 	movabs $0x803ab0,%rdi
+  8002da:	00 00 00 
+  8002dd:	48 b8 c8 27 80 00 00 	movabs $0x8027c8,%rax
+  8002e4:	00 00 00 
+  8002e7:	ff d0                	call   *%rax
+  8002e9:	41 89 c6             	mov    %eax,%r14d
+  8002ec:	85 c0                	test   %eax,%eax
+  8002ee:	0f 88 c9 00 00 00    	js     8003bd <umain+0x25c>
+    for (off = 0;; off++) {
+  8002f4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        n1 = read(rfd, &c1, 1);
+  8002fa:	49 bd 0a 22 80 00 00 	movabs $0x80220a,%r13
+  800301:	00 00 00 
+  800304:	e9 5c 01 00 00       	jmp    800465 <umain+0x304>
+        panic("open testshell.sh: %i", rfd);
+  800309:	89 c1                	mov    %eax,%ecx
+  80030b:	48 ba 66 3a 80 00 00 	movabs $0x803a66,%rdx
+  800312:	00 00 00 
+  800315:	be 12 00 00 00       	mov    $0x12,%esi
+  80031a:	48 bf 7c 3a 80 00 00 	movabs $0x803a7c,%rdi
+  800321:	00 00 00 
+  800324:	b8 00 00 00 00       	mov    $0x0,%eax
+  800329:	49 b8 d2 07 80 00 00 	movabs $0x8007d2,%r8
+  800330:	00 00 00 
+  800333:	41 ff d0             	call   *%r8
+        panic("pipe: %i", wfd);
+  800336:	89 c1                	mov    %eax,%ecx
+  800338:	48 ba 8d 3a 80 00 00 	movabs $0x803a8d,%rdx
+  80033f:	00 00 00 
+  800342:	be 14 00 00 00       	mov    $0x14,%esi
+  800347:	48 bf 7c 3a 80 00 00 	movabs $0x803a7c,%rdi
+  80034e:	00 00 00 
+  800351:	b8 00 00 00 00       	mov    $0x0,%eax
+  800356:	49 b8 d2 07 80 00 00 	movabs $0x8007d2,%r8
+  80035d:	00 00 00 
+  800360:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800363:	89 c1                	mov    %eax,%ecx
+  800365:	48 ba 96 3a 80 00 00 	movabs $0x803a96,%rdx
+  80036c:	00 00 00 
+  80036f:	be 19 00 00 00       	mov    $0x19,%esi
+  800374:	48 bf 7c 3a 80 00 00 	movabs $0x803a7c,%rdi
+  80037b:	00 00 00 
+  80037e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800383:	49 b8 d2 07 80 00 00 	movabs $0x8007d2,%r8
+  80038a:	00 00 00 
+  80038d:	41 ff d0             	call   *%r8
+            panic("spawn: %i", r);
+  800390:	89 c1                	mov    %eax,%ecx
+  800392:	48 ba a6 3a 80 00 00 	movabs $0x803aa6,%rdx
+  800399:	00 00 00 
+  80039c:	be 20 00 00 00       	mov    $0x20,%esi
+  8003a1:	48 bf 7c 3a 80 00 00 	movabs $0x803a7c,%rdi
+  8003a8:	00 00 00 
+  8003ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b0:	49 b8 d2 07 80 00 00 	movabs $0x8007d2,%r8
+  8003b7:	00 00 00 
+  8003ba:	41 ff d0             	call   *%r8
+        panic("open testshell.key for reading: %i", kfd);
+  8003bd:	89 c1                	mov    %eax,%ecx
+  8003bf:	48 ba 10 3a 80 00 00 	movabs $0x803a10,%rdx
+  8003c6:	00 00 00 
+  8003c9:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8003ce:	48 bf 7c 3a 80 00 00 	movabs $0x803a7c,%rdi
+  8003d5:	00 00 00 
+  8003d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003dd:	49 b8 d2 07 80 00 00 	movabs $0x8007d2,%r8
+  8003e4:	00 00 00 
+  8003e7:	41 ff d0             	call   *%r8
+            panic("reading testshell.out: %i", n1);
+  8003ea:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8003ed:	48 ba be 3a 80 00 00 	movabs $0x803abe,%rdx
+  8003f4:	00 00 00 
+  8003f7:	be 32 00 00 00       	mov    $0x32,%esi
+  8003fc:	48 bf 7c 3a 80 00 00 	movabs $0x803a7c,%rdi
+  800403:	00 00 00 
+  800406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040b:	49 b8 d2 07 80 00 00 	movabs $0x8007d2,%r8
+  800412:	00 00 00 
+  800415:	41 ff d0             	call   *%r8
+            panic("reading testshell.key: %i", n2);
+  800418:	48 ba d8 3a 80 00 00 	movabs $0x803ad8,%rdx
+  80041f:	00 00 00 
+  800422:	be 34 00 00 00       	mov    $0x34,%esi
+  800427:	48 bf 7c 3a 80 00 00 	movabs $0x803a7c,%rdi
+  80042e:	00 00 00 
+  800431:	b8 00 00 00 00       	mov    $0x0,%eax
+  800436:	49 b8 d2 07 80 00 00 	movabs $0x8007d2,%r8
+  80043d:	00 00 00 
+  800440:	41 ff d0             	call   *%r8
+            wrong(rfd, kfd, off, c1, c2);
+  800443:	0f be 4d cf          	movsbl -0x31(%rbp),%ecx
+  800447:	44 0f be 45 ce       	movsbl -0x32(%rbp),%r8d
+  80044c:	44 89 e2             	mov    %r12d,%edx
+  80044f:	44 89 f6             	mov    %r14d,%esi
+  800452:	44 89 ff             	mov    %r15d,%edi
+  800455:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80045c:	00 00 00 
+  80045f:	ff d0                	call   *%rax
+    for (off = 0;; off++) {
+  800461:	41 83 c4 01          	add    $0x1,%r12d
+        n1 = read(rfd, &c1, 1);
+  800465:	ba 01 00 00 00       	mov    $0x1,%edx
+  80046a:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  80046e:	44 89 ff             	mov    %r15d,%edi
+  800471:	41 ff d5             	call   *%r13
+  800474:	48 89 c3             	mov    %rax,%rbx
+  800477:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        n2 = read(kfd, &c2, 1);
+  80047a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80047f:	48 8d 75 ce          	lea    -0x32(%rbp),%rsi
+  800483:	44 89 f7             	mov    %r14d,%edi
+  800486:	41 ff d5             	call   *%r13
+  800489:	89 c1                	mov    %eax,%ecx
+        if (n1 < 0)
+  80048b:	85 db                	test   %ebx,%ebx
+  80048d:	0f 88 57 ff ff ff    	js     8003ea <umain+0x289>
+        if (n2 < 0)
+  800493:	85 c0                	test   %eax,%eax
+  800495:	78 81                	js     800418 <umain+0x2b7>
+        if (n1 == 0 && n2 == 0)
+  800497:	89 c2                	mov    %eax,%edx
+  800499:	09 da                	or     %ebx,%edx
+  80049b:	74 15                	je     8004b2 <umain+0x351>
+        if (n1 != 1 || n2 != 1 || c1 != c2) {
+  80049d:	83 fb 01             	cmp    $0x1,%ebx
+  8004a0:	75 a1                	jne    800443 <umain+0x2e2>
+  8004a2:	83 f8 01             	cmp    $0x1,%eax
+  8004a5:	75 9c                	jne    800443 <umain+0x2e2>
+  8004a7:	0f b6 45 ce          	movzbl -0x32(%rbp),%eax
+  8004ab:	38 45 cf             	cmp    %al,-0x31(%rbp)
+  8004ae:	75 93                	jne    800443 <umain+0x2e2>
+  8004b0:	eb af                	jmp    800461 <umain+0x300>
+    cprintf("shell ran correctly\n");
+  8004b2:	48 bf f2 3a 80 00 00 	movabs $0x803af2,%rdi
+  8004b9:	00 00 00 
+  8004bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c1:	48 ba 22 09 80 00 00 	movabs $0x800922,%rdx
+  8004c8:	00 00 00 
+  8004cb:	ff d2                	call   *%rdx
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8004cd:	cc                   	int3
+}
+  8004ce:	48 83 c4 28          	add    $0x28,%rsp
+  8004d2:	5b                   	pop    %rbx
+  8004d3:	41 5c                	pop    %r12
+  8004d5:	41 5d                	pop    %r13
+  8004d7:	41 5e                	pop    %r14
+  8004d9:	41 5f                	pop    %r15
+  8004db:	5d                   	pop    %rbp
+  8004dc:	c3                   	ret
+
+00000000008004dd <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8004dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e2:	c3                   	ret
+
+00000000008004e3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8004e3:	55                   	push   %rbp
+  8004e4:	48 89 e5             	mov    %rsp,%rbp
+  8004e7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8004ea:	48 be 07 3b 80 00 00 	movabs $0x803b07,%rsi
+  8004f1:	00 00 00 
+  8004f4:	48 b8 47 12 80 00 00 	movabs $0x801247,%rax
+  8004fb:	00 00 00 
+  8004fe:	ff d0                	call   *%rax
+    return 0;
+}
+  800500:	b8 00 00 00 00       	mov    $0x0,%eax
+  800505:	5d                   	pop    %rbp
+  800506:	c3                   	ret
+
+0000000000800507 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800507:	55                   	push   %rbp
+  800508:	48 89 e5             	mov    %rsp,%rbp
+  80050b:	41 57                	push   %r15
+  80050d:	41 56                	push   %r14
+  80050f:	41 55                	push   %r13
+  800511:	41 54                	push   %r12
+  800513:	53                   	push   %rbx
+  800514:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80051b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  800522:	48 85 d2             	test   %rdx,%rdx
+  800525:	74 7a                	je     8005a1 <devcons_write+0x9a>
+  800527:	49 89 d6             	mov    %rdx,%r14
+  80052a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800530:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  800535:	49 bf 41 14 80 00 00 	movabs $0x801441,%r15
+  80053c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80053f:	4c 89 f3             	mov    %r14,%rbx
+  800542:	48 29 f3             	sub    %rsi,%rbx
+  800545:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80054a:	48 39 c3             	cmp    %rax,%rbx
+  80054d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  800551:	4c 63 eb             	movslq %ebx,%r13
+  800554:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80055b:	48 01 c6             	add    %rax,%rsi
+  80055e:	4c 89 ea             	mov    %r13,%rdx
+  800561:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800568:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80056b:	4c 89 ee             	mov    %r13,%rsi
+  80056e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800575:	48 b8 6e 16 80 00 00 	movabs $0x80166e,%rax
+  80057c:	00 00 00 
+  80057f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  800581:	41 01 dc             	add    %ebx,%r12d
+  800584:	49 63 f4             	movslq %r12d,%rsi
+  800587:	4c 39 f6             	cmp    %r14,%rsi
+  80058a:	72 b3                	jb     80053f <devcons_write+0x38>
+    return res;
+  80058c:	49 63 c4             	movslq %r12d,%rax
+}
+  80058f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  800596:	5b                   	pop    %rbx
+  800597:	41 5c                	pop    %r12
+  800599:	41 5d                	pop    %r13
+  80059b:	41 5e                	pop    %r14
+  80059d:	41 5f                	pop    %r15
+  80059f:	5d                   	pop    %rbp
+  8005a0:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8005a1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8005a7:	eb e3                	jmp    80058c <devcons_write+0x85>
+
+00000000008005a9 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8005a9:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8005ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b1:	48 85 c0             	test   %rax,%rax
+  8005b4:	74 55                	je     80060b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8005b6:	55                   	push   %rbp
+  8005b7:	48 89 e5             	mov    %rsp,%rbp
+  8005ba:	41 55                	push   %r13
+  8005bc:	41 54                	push   %r12
+  8005be:	53                   	push   %rbx
+  8005bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8005c3:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8005c6:	48 bb 9b 16 80 00 00 	movabs $0x80169b,%rbx
+  8005cd:	00 00 00 
+  8005d0:	49 bc 68 17 80 00 00 	movabs $0x801768,%r12
+  8005d7:	00 00 00 
+  8005da:	eb 03                	jmp    8005df <devcons_read+0x36>
+  8005dc:	41 ff d4             	call   *%r12
+  8005df:	ff d3                	call   *%rbx
+  8005e1:	85 c0                	test   %eax,%eax
+  8005e3:	74 f7                	je     8005dc <devcons_read+0x33>
+    if (c < 0) return c;
+  8005e5:	48 63 d0             	movslq %eax,%rdx
+  8005e8:	78 13                	js     8005fd <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8005ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ef:	83 f8 04             	cmp    $0x4,%eax
+  8005f2:	74 09                	je     8005fd <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8005f4:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8005f8:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8005fd:	48 89 d0             	mov    %rdx,%rax
+  800600:	48 83 c4 08          	add    $0x8,%rsp
+  800604:	5b                   	pop    %rbx
+  800605:	41 5c                	pop    %r12
+  800607:	41 5d                	pop    %r13
+  800609:	5d                   	pop    %rbp
+  80060a:	c3                   	ret
+  80060b:	48 89 d0             	mov    %rdx,%rax
+  80060e:	c3                   	ret
+
+000000000080060f <cputchar>:
+cputchar(int ch) {
+  80060f:	55                   	push   %rbp
+  800610:	48 89 e5             	mov    %rsp,%rbp
+  800613:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  800617:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80061b:	be 01 00 00 00       	mov    $0x1,%esi
+  800620:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  800624:	48 b8 6e 16 80 00 00 	movabs $0x80166e,%rax
+  80062b:	00 00 00 
+  80062e:	ff d0                	call   *%rax
+}
+  800630:	c9                   	leave
+  800631:	c3                   	ret
+
+0000000000800632 <getchar>:
+getchar(void) {
+  800632:	55                   	push   %rbp
+  800633:	48 89 e5             	mov    %rsp,%rbp
+  800636:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80063a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80063f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  800643:	bf 00 00 00 00       	mov    $0x0,%edi
+  800648:	48 b8 0a 22 80 00 00 	movabs $0x80220a,%rax
+  80064f:	00 00 00 
+  800652:	ff d0                	call   *%rax
+  800654:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  800656:	85 c0                	test   %eax,%eax
+  800658:	78 06                	js     800660 <getchar+0x2e>
+  80065a:	74 08                	je     800664 <getchar+0x32>
+  80065c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  800660:	89 d0                	mov    %edx,%eax
+  800662:	c9                   	leave
+  800663:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  800664:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  800669:	eb f5                	jmp    800660 <getchar+0x2e>
+
+000000000080066b <iscons>:
+iscons(int fdnum) {
+  80066b:	55                   	push   %rbp
+  80066c:	48 89 e5             	mov    %rsp,%rbp
+  80066f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  800673:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800677:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  80067e:	00 00 00 
+  800681:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800683:	85 c0                	test   %eax,%eax
+  800685:	78 18                	js     80069f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  800687:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80068b:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800692:	00 00 00 
+  800695:	8b 00                	mov    (%rax),%eax
+  800697:	39 02                	cmp    %eax,(%rdx)
+  800699:	0f 94 c0             	sete   %al
+  80069c:	0f b6 c0             	movzbl %al,%eax
+}
+  80069f:	c9                   	leave
+  8006a0:	c3                   	ret
+
+00000000008006a1 <opencons>:
+opencons(void) {
+  8006a1:	55                   	push   %rbp
+  8006a2:	48 89 e5             	mov    %rsp,%rbp
+  8006a5:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8006a9:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8006ad:	48 b8 c7 1e 80 00 00 	movabs $0x801ec7,%rax
+  8006b4:	00 00 00 
+  8006b7:	ff d0                	call   *%rax
+  8006b9:	85 c0                	test   %eax,%eax
+  8006bb:	78 49                	js     800706 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8006bd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8006c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8006c7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8006cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8006d0:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  8006d7:	00 00 00 
+  8006da:	ff d0                	call   *%rax
+  8006dc:	85 c0                	test   %eax,%eax
+  8006de:	78 26                	js     800706 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8006e0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006e4:	a1 00 50 80 00 00 00 	movabs 0x805000,%eax
+  8006eb:	00 00 
+  8006ed:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8006ef:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8006f3:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8006fa:	48 b8 99 1e 80 00 00 	movabs $0x801e99,%rax
+  800701:	00 00 00 
+  800704:	ff d0                	call   *%rax
+}
+  800706:	c9                   	leave
+  800707:	c3                   	ret
+
+0000000000800708 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800708:	55                   	push   %rbp
+  800709:	48 89 e5             	mov    %rsp,%rbp
+  80070c:	41 56                	push   %r14
+  80070e:	41 55                	push   %r13
+  800710:	41 54                	push   %r12
+  800712:	53                   	push   %rbx
+  800713:	41 89 fd             	mov    %edi,%r13d
+  800716:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800719:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  800720:	00 00 00 
+  800723:	48 b8 b8 50 80 00 00 	movabs $0x8050b8,%rax
+  80072a:	00 00 00 
+  80072d:	48 39 c2             	cmp    %rax,%rdx
+  800730:	73 17                	jae    800749 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800732:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800735:	49 89 c4             	mov    %rax,%r12
+  800738:	48 83 c3 08          	add    $0x8,%rbx
+  80073c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800741:	ff 53 f8             	call   *-0x8(%rbx)
+  800744:	4c 39 e3             	cmp    %r12,%rbx
+  800747:	72 ef                	jb     800738 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  800749:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  800750:	00 00 00 
+  800753:	ff d0                	call   *%rax
+  800755:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800758:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80075f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800766:	00 00 00 
+  800769:	48 01 d0             	add    %rdx,%rax
+  80076c:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800773:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800776:	45 85 ed             	test   %r13d,%r13d
+  800779:	7e 0d                	jle    800788 <libmain+0x80>
+  80077b:	49 8b 06             	mov    (%r14),%rax
+  80077e:	48 a3 38 50 80 00 00 	movabs %rax,0x805038
+  800785:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800788:	4c 89 f6             	mov    %r14,%rsi
+  80078b:	44 89 ef             	mov    %r13d,%edi
+  80078e:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800795:	00 00 00 
+  800798:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80079a:	48 b8 af 07 80 00 00 	movabs $0x8007af,%rax
+  8007a1:	00 00 00 
+  8007a4:	ff d0                	call   *%rax
+#endif
+}
+  8007a6:	5b                   	pop    %rbx
+  8007a7:	41 5c                	pop    %r12
+  8007a9:	41 5d                	pop    %r13
+  8007ab:	41 5e                	pop    %r14
+  8007ad:	5d                   	pop    %rbp
+  8007ae:	c3                   	ret
+
+00000000008007af <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8007af:	55                   	push   %rbp
+  8007b0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8007b3:	48 b8 bf 20 80 00 00 	movabs $0x8020bf,%rax
+  8007ba:	00 00 00 
+  8007bd:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8007bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007c4:	48 b8 cc 16 80 00 00 	movabs $0x8016cc,%rax
+  8007cb:	00 00 00 
+  8007ce:	ff d0                	call   *%rax
+}
+  8007d0:	5d                   	pop    %rbp
+  8007d1:	c3                   	ret
+
+00000000008007d2 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8007d2:	55                   	push   %rbp
+  8007d3:	48 89 e5             	mov    %rsp,%rbp
+  8007d6:	41 56                	push   %r14
+  8007d8:	41 55                	push   %r13
+  8007da:	41 54                	push   %r12
+  8007dc:	53                   	push   %rbx
+  8007dd:	48 83 ec 50          	sub    $0x50,%rsp
+  8007e1:	49 89 fc             	mov    %rdi,%r12
+  8007e4:	41 89 f5             	mov    %esi,%r13d
+  8007e7:	48 89 d3             	mov    %rdx,%rbx
+  8007ea:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8007ee:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8007f2:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8007f6:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8007fd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800801:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800805:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800809:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80080d:	48 b8 38 50 80 00 00 	movabs $0x805038,%rax
+  800814:	00 00 00 
+  800817:	4c 8b 30             	mov    (%rax),%r14
+  80081a:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  800821:	00 00 00 
+  800824:	ff d0                	call   *%rax
+  800826:	89 c6                	mov    %eax,%esi
+  800828:	45 89 e8             	mov    %r13d,%r8d
+  80082b:	4c 89 e1             	mov    %r12,%rcx
+  80082e:	4c 89 f2             	mov    %r14,%rdx
+  800831:	48 bf 20 3b 80 00 00 	movabs $0x803b20,%rdi
+  800838:	00 00 00 
+  80083b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800840:	49 bc 22 09 80 00 00 	movabs $0x800922,%r12
+  800847:	00 00 00 
+  80084a:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80084d:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800851:	48 89 df             	mov    %rbx,%rdi
+  800854:	48 b8 be 08 80 00 00 	movabs $0x8008be,%rax
+  80085b:	00 00 00 
+  80085e:	ff d0                	call   *%rax
+    cprintf("\n");
+  800860:	48 bf 57 3a 80 00 00 	movabs $0x803a57,%rdi
+  800867:	00 00 00 
+  80086a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086f:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800872:	cc                   	int3
+  800873:	eb fd                	jmp    800872 <_panic+0xa0>
+
+0000000000800875 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800875:	55                   	push   %rbp
+  800876:	48 89 e5             	mov    %rsp,%rbp
+  800879:	53                   	push   %rbx
+  80087a:	48 83 ec 08          	sub    $0x8,%rsp
+  80087e:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800881:	8b 06                	mov    (%rsi),%eax
+  800883:	8d 50 01             	lea    0x1(%rax),%edx
+  800886:	89 16                	mov    %edx,(%rsi)
+  800888:	48 98                	cltq
+  80088a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80088f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800895:	74 0a                	je     8008a1 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800897:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80089b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80089f:	c9                   	leave
+  8008a0:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8008a1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8008a5:	be ff 00 00 00       	mov    $0xff,%esi
+  8008aa:	48 b8 6e 16 80 00 00 	movabs $0x80166e,%rax
+  8008b1:	00 00 00 
+  8008b4:	ff d0                	call   *%rax
+        state->offset = 0;
+  8008b6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8008bc:	eb d9                	jmp    800897 <putch+0x22>
+
+00000000008008be <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8008be:	55                   	push   %rbp
+  8008bf:	48 89 e5             	mov    %rsp,%rbp
+  8008c2:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8008c9:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8008cc:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8008d3:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8008d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008dd:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8008e0:	48 89 f1             	mov    %rsi,%rcx
+  8008e3:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8008ea:	48 bf 75 08 80 00 00 	movabs $0x800875,%rdi
+  8008f1:	00 00 00 
+  8008f4:	48 b8 72 0a 80 00 00 	movabs $0x800a72,%rax
+  8008fb:	00 00 00 
+  8008fe:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800900:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800907:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80090e:	48 b8 6e 16 80 00 00 	movabs $0x80166e,%rax
+  800915:	00 00 00 
+  800918:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80091a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800920:	c9                   	leave
+  800921:	c3                   	ret
+
+0000000000800922 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800922:	55                   	push   %rbp
+  800923:	48 89 e5             	mov    %rsp,%rbp
+  800926:	48 83 ec 50          	sub    $0x50,%rsp
+  80092a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80092e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800932:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800936:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80093a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80093e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800945:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800949:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800951:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800955:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800959:	48 b8 be 08 80 00 00 	movabs $0x8008be,%rax
+  800960:	00 00 00 
+  800963:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800965:	c9                   	leave
+  800966:	c3                   	ret
+
+0000000000800967 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800967:	55                   	push   %rbp
+  800968:	48 89 e5             	mov    %rsp,%rbp
+  80096b:	41 57                	push   %r15
+  80096d:	41 56                	push   %r14
+  80096f:	41 55                	push   %r13
+  800971:	41 54                	push   %r12
+  800973:	53                   	push   %rbx
+  800974:	48 83 ec 18          	sub    $0x18,%rsp
+  800978:	49 89 fc             	mov    %rdi,%r12
+  80097b:	49 89 f5             	mov    %rsi,%r13
+  80097e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800982:	8b 45 10             	mov    0x10(%rbp),%eax
+  800985:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800988:	41 89 cf             	mov    %ecx,%r15d
+  80098b:	4c 39 fa             	cmp    %r15,%rdx
+  80098e:	73 5b                	jae    8009eb <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800990:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800994:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800998:	85 db                	test   %ebx,%ebx
+  80099a:	7e 0e                	jle    8009aa <print_num+0x43>
+            putch(padc, put_arg);
+  80099c:	4c 89 ee             	mov    %r13,%rsi
+  80099f:	44 89 f7             	mov    %r14d,%edi
+  8009a2:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8009a5:	83 eb 01             	sub    $0x1,%ebx
+  8009a8:	75 f2                	jne    80099c <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8009aa:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8009ae:	48 b9 54 3b 80 00 00 	movabs $0x803b54,%rcx
+  8009b5:	00 00 00 
+  8009b8:	48 b8 43 3b 80 00 00 	movabs $0x803b43,%rax
+  8009bf:	00 00 00 
+  8009c2:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8009c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009cf:	49 f7 f7             	div    %r15
+  8009d2:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8009d6:	4c 89 ee             	mov    %r13,%rsi
+  8009d9:	41 ff d4             	call   *%r12
+}
+  8009dc:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8009e0:	5b                   	pop    %rbx
+  8009e1:	41 5c                	pop    %r12
+  8009e3:	41 5d                	pop    %r13
+  8009e5:	41 5e                	pop    %r14
+  8009e7:	41 5f                	pop    %r15
+  8009e9:	5d                   	pop    %rbp
+  8009ea:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8009eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009f4:	49 f7 f7             	div    %r15
+  8009f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8009fb:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8009ff:	52                   	push   %rdx
+  800a00:	45 0f be c9          	movsbl %r9b,%r9d
+  800a04:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800a08:	48 89 c2             	mov    %rax,%rdx
+  800a0b:	48 b8 67 09 80 00 00 	movabs $0x800967,%rax
+  800a12:	00 00 00 
+  800a15:	ff d0                	call   *%rax
+  800a17:	48 83 c4 10          	add    $0x10,%rsp
+  800a1b:	eb 8d                	jmp    8009aa <print_num+0x43>
+
+0000000000800a1d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800a1d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800a21:	48 8b 06             	mov    (%rsi),%rax
+  800a24:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800a28:	73 0a                	jae    800a34 <sprintputch+0x17>
+        *state->start++ = ch;
+  800a2a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a2e:	48 89 16             	mov    %rdx,(%rsi)
+  800a31:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800a34:	c3                   	ret
+
+0000000000800a35 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800a35:	55                   	push   %rbp
+  800a36:	48 89 e5             	mov    %rsp,%rbp
+  800a39:	48 83 ec 50          	sub    $0x50,%rsp
+  800a3d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a41:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a45:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800a49:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a50:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a58:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800a5c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800a60:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800a64:	48 b8 72 0a 80 00 00 	movabs $0x800a72,%rax
+  800a6b:	00 00 00 
+  800a6e:	ff d0                	call   *%rax
+}
+  800a70:	c9                   	leave
+  800a71:	c3                   	ret
+
+0000000000800a72 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800a72:	55                   	push   %rbp
+  800a73:	48 89 e5             	mov    %rsp,%rbp
+  800a76:	41 57                	push   %r15
+  800a78:	41 56                	push   %r14
+  800a7a:	41 55                	push   %r13
+  800a7c:	41 54                	push   %r12
+  800a7e:	53                   	push   %rbx
+  800a7f:	48 83 ec 38          	sub    $0x38,%rsp
+  800a83:	49 89 fe             	mov    %rdi,%r14
+  800a86:	49 89 f5             	mov    %rsi,%r13
+  800a89:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800a8c:	48 8b 01             	mov    (%rcx),%rax
+  800a8f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800a93:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800a97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9b:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800a9f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800aa3:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800aa7:	0f b6 3b             	movzbl (%rbx),%edi
+  800aaa:	40 80 ff 25          	cmp    $0x25,%dil
+  800aae:	74 18                	je     800ac8 <vprintfmt+0x56>
+            if (!ch) return;
+  800ab0:	40 84 ff             	test   %dil,%dil
+  800ab3:	0f 84 b1 06 00 00    	je     80116a <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800ab9:	40 0f b6 ff          	movzbl %dil,%edi
+  800abd:	4c 89 ee             	mov    %r13,%rsi
+  800ac0:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800ac3:	4c 89 e3             	mov    %r12,%rbx
+  800ac6:	eb db                	jmp    800aa3 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800ac8:	be 00 00 00 00       	mov    $0x0,%esi
+  800acd:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800ad1:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800ad6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800adc:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800ae3:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800ae7:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800aec:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800af1:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800af4:	83 e8 23             	sub    $0x23,%eax
+  800af7:	3c 57                	cmp    $0x57,%al
+  800af9:	0f 87 51 06 00 00    	ja     801150 <vprintfmt+0x6de>
+  800aff:	0f b6 c0             	movzbl %al,%eax
+  800b02:	48 b9 00 3d 80 00 00 	movabs $0x803d00,%rcx
+  800b09:	00 00 00 
+  800b0c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800b0f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800b12:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800b16:	eb cf                	jmp    800ae7 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800b18:	49 89 dc             	mov    %rbx,%r12
+  800b1b:	be 01 00 00 00       	mov    $0x1,%esi
+  800b20:	eb c5                	jmp    800ae7 <vprintfmt+0x75>
+            padc = ch;
+  800b22:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800b26:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800b29:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800b2c:	eb b9                	jmp    800ae7 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800b2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b31:	83 f8 2f             	cmp    $0x2f,%eax
+  800b34:	77 24                	ja     800b5a <vprintfmt+0xe8>
+  800b36:	89 c1                	mov    %eax,%ecx
+  800b38:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800b3c:	83 c0 08             	add    $0x8,%eax
+  800b3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b42:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800b45:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800b48:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b4c:	79 99                	jns    800ae7 <vprintfmt+0x75>
+                width = precision;
+  800b4e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800b52:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800b58:	eb 8d                	jmp    800ae7 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800b5a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800b5e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800b62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b66:	eb da                	jmp    800b42 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800b68:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800b6d:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800b71:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800b77:	3c 39                	cmp    $0x39,%al
+  800b79:	77 1c                	ja     800b97 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800b7b:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800b7f:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800b83:	0f b6 c0             	movzbl %al,%eax
+  800b86:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800b8b:	0f b6 03             	movzbl (%rbx),%eax
+  800b8e:	3c 39                	cmp    $0x39,%al
+  800b90:	76 e9                	jbe    800b7b <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800b92:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800b95:	eb b1                	jmp    800b48 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800b97:	49 89 dc             	mov    %rbx,%r12
+  800b9a:	eb ac                	jmp    800b48 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800b9c:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800b9f:	85 c9                	test   %ecx,%ecx
+  800ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba6:	0f 49 c1             	cmovns %ecx,%eax
+  800ba9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800bac:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800baf:	e9 33 ff ff ff       	jmp    800ae7 <vprintfmt+0x75>
+            lflag++;
+  800bb4:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800bb7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800bba:	e9 28 ff ff ff       	jmp    800ae7 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800bbf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc2:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc5:	77 19                	ja     800be0 <vprintfmt+0x16e>
+  800bc7:	89 c2                	mov    %eax,%edx
+  800bc9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bcd:	83 c0 08             	add    $0x8,%eax
+  800bd0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd3:	8b 3a                	mov    (%rdx),%edi
+  800bd5:	4c 89 ee             	mov    %r13,%rsi
+  800bd8:	41 ff d6             	call   *%r14
+            break;
+  800bdb:	e9 c3 fe ff ff       	jmp    800aa3 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800be0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bec:	eb e5                	jmp    800bd3 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800bee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf1:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf4:	77 5a                	ja     800c50 <vprintfmt+0x1de>
+  800bf6:	89 c2                	mov    %eax,%edx
+  800bf8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bfc:	83 c0 08             	add    $0x8,%eax
+  800bff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800c02:	8b 02                	mov    (%rdx),%eax
+  800c04:	89 c1                	mov    %eax,%ecx
+  800c06:	f7 d9                	neg    %ecx
+  800c08:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800c0b:	83 f9 15             	cmp    $0x15,%ecx
+  800c0e:	7f 4e                	jg     800c5e <vprintfmt+0x1ec>
+  800c10:	48 63 c1             	movslq %ecx,%rax
+  800c13:	48 ba c0 3f 80 00 00 	movabs $0x803fc0,%rdx
+  800c1a:	00 00 00 
+  800c1d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800c21:	48 85 c0             	test   %rax,%rax
+  800c24:	74 38                	je     800c5e <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800c26:	48 89 c1             	mov    %rax,%rcx
+  800c29:	48 ba 2c 42 80 00 00 	movabs $0x80422c,%rdx
+  800c30:	00 00 00 
+  800c33:	4c 89 ee             	mov    %r13,%rsi
+  800c36:	4c 89 f7             	mov    %r14,%rdi
+  800c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3e:	49 b8 35 0a 80 00 00 	movabs $0x800a35,%r8
+  800c45:	00 00 00 
+  800c48:	41 ff d0             	call   *%r8
+  800c4b:	e9 53 fe ff ff       	jmp    800aa3 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800c50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c5c:	eb a4                	jmp    800c02 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800c5e:	48 ba 6c 3b 80 00 00 	movabs $0x803b6c,%rdx
+  800c65:	00 00 00 
+  800c68:	4c 89 ee             	mov    %r13,%rsi
+  800c6b:	4c 89 f7             	mov    %r14,%rdi
+  800c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c73:	49 b8 35 0a 80 00 00 	movabs $0x800a35,%r8
+  800c7a:	00 00 00 
+  800c7d:	41 ff d0             	call   *%r8
+  800c80:	e9 1e fe ff ff       	jmp    800aa3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800c85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c88:	83 f8 2f             	cmp    $0x2f,%eax
+  800c8b:	77 6c                	ja     800cf9 <vprintfmt+0x287>
+  800c8d:	89 c2                	mov    %eax,%edx
+  800c8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c93:	83 c0 08             	add    $0x8,%eax
+  800c96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c99:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800c9c:	48 85 d2             	test   %rdx,%rdx
+  800c9f:	48 b8 65 3b 80 00 00 	movabs $0x803b65,%rax
+  800ca6:	00 00 00 
+  800ca9:	48 0f 45 c2          	cmovne %rdx,%rax
+  800cad:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800cb1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800cb5:	7e 06                	jle    800cbd <vprintfmt+0x24b>
+  800cb7:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800cbb:	75 4a                	jne    800d07 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800cbd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800cc1:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800cc5:	0f b6 00             	movzbl (%rax),%eax
+  800cc8:	84 c0                	test   %al,%al
+  800cca:	0f 85 9a 00 00 00    	jne    800d6a <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800cd0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800cd3:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800cd7:	85 c0                	test   %eax,%eax
+  800cd9:	0f 8e c4 fd ff ff    	jle    800aa3 <vprintfmt+0x31>
+  800cdf:	4c 89 ee             	mov    %r13,%rsi
+  800ce2:	bf 20 00 00 00       	mov    $0x20,%edi
+  800ce7:	41 ff d6             	call   *%r14
+  800cea:	41 83 ec 01          	sub    $0x1,%r12d
+  800cee:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800cf2:	75 eb                	jne    800cdf <vprintfmt+0x26d>
+  800cf4:	e9 aa fd ff ff       	jmp    800aa3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800cf9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cfd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d05:	eb 92                	jmp    800c99 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800d07:	49 63 f7             	movslq %r15d,%rsi
+  800d0a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800d0e:	48 b8 24 12 80 00 00 	movabs $0x801224,%rax
+  800d15:	00 00 00 
+  800d18:	ff d0                	call   *%rax
+  800d1a:	48 89 c2             	mov    %rax,%rdx
+  800d1d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d20:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800d22:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800d25:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800d28:	85 c0                	test   %eax,%eax
+  800d2a:	7e 91                	jle    800cbd <vprintfmt+0x24b>
+  800d2c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800d31:	4c 89 ee             	mov    %r13,%rsi
+  800d34:	44 89 e7             	mov    %r12d,%edi
+  800d37:	41 ff d6             	call   *%r14
+  800d3a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800d3e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d41:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800d44:	75 eb                	jne    800d31 <vprintfmt+0x2bf>
+  800d46:	e9 72 ff ff ff       	jmp    800cbd <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800d4b:	0f b6 f8             	movzbl %al,%edi
+  800d4e:	4c 89 ee             	mov    %r13,%rsi
+  800d51:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800d54:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800d58:	49 83 c4 01          	add    $0x1,%r12
+  800d5c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800d62:	84 c0                	test   %al,%al
+  800d64:	0f 84 66 ff ff ff    	je     800cd0 <vprintfmt+0x25e>
+  800d6a:	45 85 ff             	test   %r15d,%r15d
+  800d6d:	78 0a                	js     800d79 <vprintfmt+0x307>
+  800d6f:	41 83 ef 01          	sub    $0x1,%r15d
+  800d73:	0f 88 57 ff ff ff    	js     800cd0 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800d79:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800d7d:	74 cc                	je     800d4b <vprintfmt+0x2d9>
+  800d7f:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800d82:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800d87:	80 fa 5e             	cmp    $0x5e,%dl
+  800d8a:	77 c2                	ja     800d4e <vprintfmt+0x2dc>
+  800d8c:	eb bd                	jmp    800d4b <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800d8e:	40 84 f6             	test   %sil,%sil
+  800d91:	75 26                	jne    800db9 <vprintfmt+0x347>
+    switch (lflag) {
+  800d93:	85 d2                	test   %edx,%edx
+  800d95:	74 59                	je     800df0 <vprintfmt+0x37e>
+  800d97:	83 fa 01             	cmp    $0x1,%edx
+  800d9a:	74 7b                	je     800e17 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800d9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d9f:	83 f8 2f             	cmp    $0x2f,%eax
+  800da2:	0f 87 96 00 00 00    	ja     800e3e <vprintfmt+0x3cc>
+  800da8:	89 c2                	mov    %eax,%edx
+  800daa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dae:	83 c0 08             	add    $0x8,%eax
+  800db1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800db4:	4c 8b 22             	mov    (%rdx),%r12
+  800db7:	eb 17                	jmp    800dd0 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800db9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dbc:	83 f8 2f             	cmp    $0x2f,%eax
+  800dbf:	77 21                	ja     800de2 <vprintfmt+0x370>
+  800dc1:	89 c2                	mov    %eax,%edx
+  800dc3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dc7:	83 c0 08             	add    $0x8,%eax
+  800dca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dcd:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800dd0:	4d 85 e4             	test   %r12,%r12
+  800dd3:	78 7a                	js     800e4f <vprintfmt+0x3dd>
+            num = i;
+  800dd5:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800dd8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800ddd:	e9 50 02 00 00       	jmp    801032 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800de2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800de6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dee:	eb dd                	jmp    800dcd <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800df0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800df3:	83 f8 2f             	cmp    $0x2f,%eax
+  800df6:	77 11                	ja     800e09 <vprintfmt+0x397>
+  800df8:	89 c2                	mov    %eax,%edx
+  800dfa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dfe:	83 c0 08             	add    $0x8,%eax
+  800e01:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e04:	4c 63 22             	movslq (%rdx),%r12
+  800e07:	eb c7                	jmp    800dd0 <vprintfmt+0x35e>
+  800e09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e0d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e15:	eb ed                	jmp    800e04 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800e17:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e1a:	83 f8 2f             	cmp    $0x2f,%eax
+  800e1d:	77 11                	ja     800e30 <vprintfmt+0x3be>
+  800e1f:	89 c2                	mov    %eax,%edx
+  800e21:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e25:	83 c0 08             	add    $0x8,%eax
+  800e28:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e2b:	4c 8b 22             	mov    (%rdx),%r12
+  800e2e:	eb a0                	jmp    800dd0 <vprintfmt+0x35e>
+  800e30:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e34:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e38:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e3c:	eb ed                	jmp    800e2b <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800e3e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e42:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e46:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e4a:	e9 65 ff ff ff       	jmp    800db4 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800e4f:	4c 89 ee             	mov    %r13,%rsi
+  800e52:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800e57:	41 ff d6             	call   *%r14
+                i = -i;
+  800e5a:	49 f7 dc             	neg    %r12
+  800e5d:	e9 73 ff ff ff       	jmp    800dd5 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800e62:	40 84 f6             	test   %sil,%sil
+  800e65:	75 32                	jne    800e99 <vprintfmt+0x427>
+    switch (lflag) {
+  800e67:	85 d2                	test   %edx,%edx
+  800e69:	74 5d                	je     800ec8 <vprintfmt+0x456>
+  800e6b:	83 fa 01             	cmp    $0x1,%edx
+  800e6e:	0f 84 82 00 00 00    	je     800ef6 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800e74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e77:	83 f8 2f             	cmp    $0x2f,%eax
+  800e7a:	0f 87 a5 00 00 00    	ja     800f25 <vprintfmt+0x4b3>
+  800e80:	89 c2                	mov    %eax,%edx
+  800e82:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e86:	83 c0 08             	add    $0x8,%eax
+  800e89:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e8c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800e8f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e94:	e9 99 01 00 00       	jmp    801032 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e9c:	83 f8 2f             	cmp    $0x2f,%eax
+  800e9f:	77 19                	ja     800eba <vprintfmt+0x448>
+  800ea1:	89 c2                	mov    %eax,%edx
+  800ea3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ea7:	83 c0 08             	add    $0x8,%eax
+  800eaa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ead:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800eb0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800eb5:	e9 78 01 00 00       	jmp    801032 <vprintfmt+0x5c0>
+  800eba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ebe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ec2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ec6:	eb e5                	jmp    800ead <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800ec8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ecb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ece:	77 18                	ja     800ee8 <vprintfmt+0x476>
+  800ed0:	89 c2                	mov    %eax,%edx
+  800ed2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ed6:	83 c0 08             	add    $0x8,%eax
+  800ed9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800edc:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800ede:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800ee3:	e9 4a 01 00 00       	jmp    801032 <vprintfmt+0x5c0>
+  800ee8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ef0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ef4:	eb e6                	jmp    800edc <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800ef6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ef9:	83 f8 2f             	cmp    $0x2f,%eax
+  800efc:	77 19                	ja     800f17 <vprintfmt+0x4a5>
+  800efe:	89 c2                	mov    %eax,%edx
+  800f00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f04:	83 c0 08             	add    $0x8,%eax
+  800f07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f0a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800f0d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800f12:	e9 1b 01 00 00       	jmp    801032 <vprintfmt+0x5c0>
+  800f17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f23:	eb e5                	jmp    800f0a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800f25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f29:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f2d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f31:	e9 56 ff ff ff       	jmp    800e8c <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800f36:	40 84 f6             	test   %sil,%sil
+  800f39:	75 2e                	jne    800f69 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800f3b:	85 d2                	test   %edx,%edx
+  800f3d:	74 59                	je     800f98 <vprintfmt+0x526>
+  800f3f:	83 fa 01             	cmp    $0x1,%edx
+  800f42:	74 7f                	je     800fc3 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800f44:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f47:	83 f8 2f             	cmp    $0x2f,%eax
+  800f4a:	0f 87 9f 00 00 00    	ja     800fef <vprintfmt+0x57d>
+  800f50:	89 c2                	mov    %eax,%edx
+  800f52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f56:	83 c0 08             	add    $0x8,%eax
+  800f59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f5c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800f5f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800f64:	e9 c9 00 00 00       	jmp    801032 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800f69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f6c:	83 f8 2f             	cmp    $0x2f,%eax
+  800f6f:	77 19                	ja     800f8a <vprintfmt+0x518>
+  800f71:	89 c2                	mov    %eax,%edx
+  800f73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f77:	83 c0 08             	add    $0x8,%eax
+  800f7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f7d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800f80:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f85:	e9 a8 00 00 00       	jmp    801032 <vprintfmt+0x5c0>
+  800f8a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f8e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f96:	eb e5                	jmp    800f7d <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800f98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f9b:	83 f8 2f             	cmp    $0x2f,%eax
+  800f9e:	77 15                	ja     800fb5 <vprintfmt+0x543>
+  800fa0:	89 c2                	mov    %eax,%edx
+  800fa2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fa6:	83 c0 08             	add    $0x8,%eax
+  800fa9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fac:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800fae:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800fb3:	eb 7d                	jmp    801032 <vprintfmt+0x5c0>
+  800fb5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fb9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fbd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fc1:	eb e9                	jmp    800fac <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800fc3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fc6:	83 f8 2f             	cmp    $0x2f,%eax
+  800fc9:	77 16                	ja     800fe1 <vprintfmt+0x56f>
+  800fcb:	89 c2                	mov    %eax,%edx
+  800fcd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fd1:	83 c0 08             	add    $0x8,%eax
+  800fd4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fd7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800fda:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800fdf:	eb 51                	jmp    801032 <vprintfmt+0x5c0>
+  800fe1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fe5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fe9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fed:	eb e8                	jmp    800fd7 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800fef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ff3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ff7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ffb:	e9 5c ff ff ff       	jmp    800f5c <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  801000:	4c 89 ee             	mov    %r13,%rsi
+  801003:	bf 30 00 00 00       	mov    $0x30,%edi
+  801008:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80100b:	4c 89 ee             	mov    %r13,%rsi
+  80100e:	bf 78 00 00 00       	mov    $0x78,%edi
+  801013:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801016:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801019:	83 f8 2f             	cmp    $0x2f,%eax
+  80101c:	77 47                	ja     801065 <vprintfmt+0x5f3>
+  80101e:	89 c2                	mov    %eax,%edx
+  801020:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801024:	83 c0 08             	add    $0x8,%eax
+  801027:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80102a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80102d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801032:	48 83 ec 08          	sub    $0x8,%rsp
+  801036:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80103a:	0f 94 c0             	sete   %al
+  80103d:	0f b6 c0             	movzbl %al,%eax
+  801040:	50                   	push   %rax
+  801041:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801046:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80104a:	4c 89 ee             	mov    %r13,%rsi
+  80104d:	4c 89 f7             	mov    %r14,%rdi
+  801050:	48 b8 67 09 80 00 00 	movabs $0x800967,%rax
+  801057:	00 00 00 
+  80105a:	ff d0                	call   *%rax
+            break;
+  80105c:	48 83 c4 10          	add    $0x10,%rsp
+  801060:	e9 3e fa ff ff       	jmp    800aa3 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  801065:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801069:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80106d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801071:	eb b7                	jmp    80102a <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  801073:	40 84 f6             	test   %sil,%sil
+  801076:	75 2b                	jne    8010a3 <vprintfmt+0x631>
+    switch (lflag) {
+  801078:	85 d2                	test   %edx,%edx
+  80107a:	74 56                	je     8010d2 <vprintfmt+0x660>
+  80107c:	83 fa 01             	cmp    $0x1,%edx
+  80107f:	74 7f                	je     801100 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  801081:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801084:	83 f8 2f             	cmp    $0x2f,%eax
+  801087:	0f 87 a2 00 00 00    	ja     80112f <vprintfmt+0x6bd>
+  80108d:	89 c2                	mov    %eax,%edx
+  80108f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801093:	83 c0 08             	add    $0x8,%eax
+  801096:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801099:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80109c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8010a1:	eb 8f                	jmp    801032 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8010a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8010a9:	77 19                	ja     8010c4 <vprintfmt+0x652>
+  8010ab:	89 c2                	mov    %eax,%edx
+  8010ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010b1:	83 c0 08             	add    $0x8,%eax
+  8010b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010b7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8010ba:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8010bf:	e9 6e ff ff ff       	jmp    801032 <vprintfmt+0x5c0>
+  8010c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010d0:	eb e5                	jmp    8010b7 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8010d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8010d8:	77 18                	ja     8010f2 <vprintfmt+0x680>
+  8010da:	89 c2                	mov    %eax,%edx
+  8010dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010e0:	83 c0 08             	add    $0x8,%eax
+  8010e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010e6:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8010e8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8010ed:	e9 40 ff ff ff       	jmp    801032 <vprintfmt+0x5c0>
+  8010f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010fe:	eb e6                	jmp    8010e6 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  801100:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801103:	83 f8 2f             	cmp    $0x2f,%eax
+  801106:	77 19                	ja     801121 <vprintfmt+0x6af>
+  801108:	89 c2                	mov    %eax,%edx
+  80110a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80110e:	83 c0 08             	add    $0x8,%eax
+  801111:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801114:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801117:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80111c:	e9 11 ff ff ff       	jmp    801032 <vprintfmt+0x5c0>
+  801121:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801125:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801129:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80112d:	eb e5                	jmp    801114 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80112f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801133:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801137:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80113b:	e9 59 ff ff ff       	jmp    801099 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  801140:	4c 89 ee             	mov    %r13,%rsi
+  801143:	bf 25 00 00 00       	mov    $0x25,%edi
+  801148:	41 ff d6             	call   *%r14
+            break;
+  80114b:	e9 53 f9 ff ff       	jmp    800aa3 <vprintfmt+0x31>
+            putch('%', put_arg);
+  801150:	4c 89 ee             	mov    %r13,%rsi
+  801153:	bf 25 00 00 00       	mov    $0x25,%edi
+  801158:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80115b:	48 83 eb 01          	sub    $0x1,%rbx
+  80115f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801163:	75 f6                	jne    80115b <vprintfmt+0x6e9>
+  801165:	e9 39 f9 ff ff       	jmp    800aa3 <vprintfmt+0x31>
+}
+  80116a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80116e:	5b                   	pop    %rbx
+  80116f:	41 5c                	pop    %r12
+  801171:	41 5d                	pop    %r13
+  801173:	41 5e                	pop    %r14
+  801175:	41 5f                	pop    %r15
+  801177:	5d                   	pop    %rbp
+  801178:	c3                   	ret
+
+0000000000801179 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801179:	55                   	push   %rbp
+  80117a:	48 89 e5             	mov    %rsp,%rbp
+  80117d:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801181:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801185:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80118a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80118e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801195:	48 85 ff             	test   %rdi,%rdi
+  801198:	74 2b                	je     8011c5 <vsnprintf+0x4c>
+  80119a:	48 85 f6             	test   %rsi,%rsi
+  80119d:	74 26                	je     8011c5 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80119f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8011a3:	48 bf 1d 0a 80 00 00 	movabs $0x800a1d,%rdi
+  8011aa:	00 00 00 
+  8011ad:	48 b8 72 0a 80 00 00 	movabs $0x800a72,%rax
+  8011b4:	00 00 00 
+  8011b7:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8011b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011bd:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8011c0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8011c3:	c9                   	leave
+  8011c4:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8011c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011ca:	eb f7                	jmp    8011c3 <vsnprintf+0x4a>
+
+00000000008011cc <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8011cc:	55                   	push   %rbp
+  8011cd:	48 89 e5             	mov    %rsp,%rbp
+  8011d0:	48 83 ec 50          	sub    $0x50,%rsp
+  8011d4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8011d8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8011dc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8011e0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8011e7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8011eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011ef:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8011f3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8011f7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8011fb:	48 b8 79 11 80 00 00 	movabs $0x801179,%rax
+  801202:	00 00 00 
+  801205:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801207:	c9                   	leave
+  801208:	c3                   	ret
+
+0000000000801209 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801209:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80120c:	74 10                	je     80121e <strlen+0x15>
+    size_t n = 0;
+  80120e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801213:	48 83 c0 01          	add    $0x1,%rax
+  801217:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80121b:	75 f6                	jne    801213 <strlen+0xa>
+  80121d:	c3                   	ret
+    size_t n = 0;
+  80121e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801223:	c3                   	ret
+
+0000000000801224 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801224:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801227:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80122c:	48 85 f6             	test   %rsi,%rsi
+  80122f:	74 11                	je     801242 <strnlen+0x1e>
+  801231:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801235:	74 0c                	je     801243 <strnlen+0x1f>
+  801237:	48 83 c2 01          	add    $0x1,%rdx
+  80123b:	48 39 d0             	cmp    %rdx,%rax
+  80123e:	75 f1                	jne    801231 <strnlen+0xd>
+  801240:	eb 04                	jmp    801246 <strnlen+0x22>
+  801242:	c3                   	ret
+  801243:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801246:	c3                   	ret
+
+0000000000801247 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801247:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80124a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80124f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801253:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801256:	48 83 c2 01          	add    $0x1,%rdx
+  80125a:	84 c9                	test   %cl,%cl
+  80125c:	75 f1                	jne    80124f <strcpy+0x8>
+        ;
+    return res;
+}
+  80125e:	c3                   	ret
+
+000000000080125f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80125f:	55                   	push   %rbp
+  801260:	48 89 e5             	mov    %rsp,%rbp
+  801263:	41 54                	push   %r12
+  801265:	53                   	push   %rbx
+  801266:	48 89 fb             	mov    %rdi,%rbx
+  801269:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80126c:	48 b8 09 12 80 00 00 	movabs $0x801209,%rax
+  801273:	00 00 00 
+  801276:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801278:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80127c:	4c 89 e6             	mov    %r12,%rsi
+  80127f:	48 b8 47 12 80 00 00 	movabs $0x801247,%rax
+  801286:	00 00 00 
+  801289:	ff d0                	call   *%rax
+    return dst;
+}
+  80128b:	48 89 d8             	mov    %rbx,%rax
+  80128e:	5b                   	pop    %rbx
+  80128f:	41 5c                	pop    %r12
+  801291:	5d                   	pop    %rbp
+  801292:	c3                   	ret
+
+0000000000801293 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801293:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801296:	48 85 d2             	test   %rdx,%rdx
+  801299:	74 1f                	je     8012ba <strncpy+0x27>
+  80129b:	48 01 fa             	add    %rdi,%rdx
+  80129e:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8012a1:	48 83 c1 01          	add    $0x1,%rcx
+  8012a5:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8012a9:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8012ad:	41 80 f8 01          	cmp    $0x1,%r8b
+  8012b1:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8012b5:	48 39 ca             	cmp    %rcx,%rdx
+  8012b8:	75 e7                	jne    8012a1 <strncpy+0xe>
+    }
+    return ret;
+}
+  8012ba:	c3                   	ret
+
+00000000008012bb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8012bb:	48 89 f8             	mov    %rdi,%rax
+  8012be:	48 85 d2             	test   %rdx,%rdx
+  8012c1:	74 24                	je     8012e7 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8012c3:	48 83 ea 01          	sub    $0x1,%rdx
+  8012c7:	74 1b                	je     8012e4 <strlcpy+0x29>
+  8012c9:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8012cd:	0f b6 16             	movzbl (%rsi),%edx
+  8012d0:	84 d2                	test   %dl,%dl
+  8012d2:	74 10                	je     8012e4 <strlcpy+0x29>
+            *dst++ = *src++;
+  8012d4:	48 83 c6 01          	add    $0x1,%rsi
+  8012d8:	48 83 c0 01          	add    $0x1,%rax
+  8012dc:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8012df:	48 39 c8             	cmp    %rcx,%rax
+  8012e2:	75 e9                	jne    8012cd <strlcpy+0x12>
+        *dst = '\0';
+  8012e4:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8012e7:	48 29 f8             	sub    %rdi,%rax
+}
+  8012ea:	c3                   	ret
+
+00000000008012eb <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8012eb:	0f b6 07             	movzbl (%rdi),%eax
+  8012ee:	84 c0                	test   %al,%al
+  8012f0:	74 13                	je     801305 <strcmp+0x1a>
+  8012f2:	38 06                	cmp    %al,(%rsi)
+  8012f4:	75 0f                	jne    801305 <strcmp+0x1a>
+  8012f6:	48 83 c7 01          	add    $0x1,%rdi
+  8012fa:	48 83 c6 01          	add    $0x1,%rsi
+  8012fe:	0f b6 07             	movzbl (%rdi),%eax
+  801301:	84 c0                	test   %al,%al
+  801303:	75 ed                	jne    8012f2 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801305:	0f b6 c0             	movzbl %al,%eax
+  801308:	0f b6 16             	movzbl (%rsi),%edx
+  80130b:	29 d0                	sub    %edx,%eax
+}
+  80130d:	c3                   	ret
+
+000000000080130e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80130e:	48 85 d2             	test   %rdx,%rdx
+  801311:	74 1f                	je     801332 <strncmp+0x24>
+  801313:	0f b6 07             	movzbl (%rdi),%eax
+  801316:	84 c0                	test   %al,%al
+  801318:	74 1e                	je     801338 <strncmp+0x2a>
+  80131a:	3a 06                	cmp    (%rsi),%al
+  80131c:	75 1a                	jne    801338 <strncmp+0x2a>
+  80131e:	48 83 c7 01          	add    $0x1,%rdi
+  801322:	48 83 c6 01          	add    $0x1,%rsi
+  801326:	48 83 ea 01          	sub    $0x1,%rdx
+  80132a:	75 e7                	jne    801313 <strncmp+0x5>
+
+    if (!n) return 0;
+  80132c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801331:	c3                   	ret
+  801332:	b8 00 00 00 00       	mov    $0x0,%eax
+  801337:	c3                   	ret
+  801338:	48 85 d2             	test   %rdx,%rdx
+  80133b:	74 09                	je     801346 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80133d:	0f b6 07             	movzbl (%rdi),%eax
+  801340:	0f b6 16             	movzbl (%rsi),%edx
+  801343:	29 d0                	sub    %edx,%eax
+  801345:	c3                   	ret
+    if (!n) return 0;
+  801346:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80134b:	c3                   	ret
+
+000000000080134c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80134c:	0f b6 17             	movzbl (%rdi),%edx
+  80134f:	84 d2                	test   %dl,%dl
+  801351:	74 18                	je     80136b <strchr+0x1f>
+        if (*str == c) {
+  801353:	0f be d2             	movsbl %dl,%edx
+  801356:	39 f2                	cmp    %esi,%edx
+  801358:	74 17                	je     801371 <strchr+0x25>
+    for (; *str; str++) {
+  80135a:	48 83 c7 01          	add    $0x1,%rdi
+  80135e:	0f b6 17             	movzbl (%rdi),%edx
+  801361:	84 d2                	test   %dl,%dl
+  801363:	75 ee                	jne    801353 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801365:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136a:	c3                   	ret
+  80136b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801370:	c3                   	ret
+  801371:	48 89 f8             	mov    %rdi,%rax
+}
+  801374:	c3                   	ret
+
+0000000000801375 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801375:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801378:	0f b6 17             	movzbl (%rdi),%edx
+  80137b:	84 d2                	test   %dl,%dl
+  80137d:	74 13                	je     801392 <strfind+0x1d>
+  80137f:	0f be d2             	movsbl %dl,%edx
+  801382:	39 f2                	cmp    %esi,%edx
+  801384:	74 0b                	je     801391 <strfind+0x1c>
+  801386:	48 83 c0 01          	add    $0x1,%rax
+  80138a:	0f b6 10             	movzbl (%rax),%edx
+  80138d:	84 d2                	test   %dl,%dl
+  80138f:	75 ee                	jne    80137f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801391:	c3                   	ret
+  801392:	c3                   	ret
+
+0000000000801393 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801393:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801396:	48 89 f8             	mov    %rdi,%rax
+  801399:	48 f7 d8             	neg    %rax
+  80139c:	83 e0 07             	and    $0x7,%eax
+  80139f:	49 89 d1             	mov    %rdx,%r9
+  8013a2:	49 29 c1             	sub    %rax,%r9
+  8013a5:	78 36                	js     8013dd <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8013a7:	40 0f b6 c6          	movzbl %sil,%eax
+  8013ab:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8013b2:	01 01 01 
+  8013b5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8013b9:	40 f6 c7 07          	test   $0x7,%dil
+  8013bd:	75 38                	jne    8013f7 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8013bf:	4c 89 c9             	mov    %r9,%rcx
+  8013c2:	48 c1 f9 03          	sar    $0x3,%rcx
+  8013c6:	74 0c                	je     8013d4 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8013c8:	fc                   	cld
+  8013c9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8013cc:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8013d0:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8013d4:	4d 85 c9             	test   %r9,%r9
+  8013d7:	75 45                	jne    80141e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8013d9:	4c 89 c0             	mov    %r8,%rax
+  8013dc:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8013dd:	48 85 d2             	test   %rdx,%rdx
+  8013e0:	74 f7                	je     8013d9 <memset+0x46>
+  8013e2:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8013e5:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8013e8:	48 83 c0 01          	add    $0x1,%rax
+  8013ec:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8013f0:	48 39 c2             	cmp    %rax,%rdx
+  8013f3:	75 f3                	jne    8013e8 <memset+0x55>
+  8013f5:	eb e2                	jmp    8013d9 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8013f7:	40 f6 c7 01          	test   $0x1,%dil
+  8013fb:	74 06                	je     801403 <memset+0x70>
+  8013fd:	88 07                	mov    %al,(%rdi)
+  8013ff:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801403:	40 f6 c7 02          	test   $0x2,%dil
+  801407:	74 07                	je     801410 <memset+0x7d>
+  801409:	66 89 07             	mov    %ax,(%rdi)
+  80140c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801410:	40 f6 c7 04          	test   $0x4,%dil
+  801414:	74 a9                	je     8013bf <memset+0x2c>
+  801416:	89 07                	mov    %eax,(%rdi)
+  801418:	48 83 c7 04          	add    $0x4,%rdi
+  80141c:	eb a1                	jmp    8013bf <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80141e:	41 f6 c1 04          	test   $0x4,%r9b
+  801422:	74 06                	je     80142a <memset+0x97>
+  801424:	89 07                	mov    %eax,(%rdi)
+  801426:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80142a:	41 f6 c1 02          	test   $0x2,%r9b
+  80142e:	74 07                	je     801437 <memset+0xa4>
+  801430:	66 89 07             	mov    %ax,(%rdi)
+  801433:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801437:	41 f6 c1 01          	test   $0x1,%r9b
+  80143b:	74 9c                	je     8013d9 <memset+0x46>
+  80143d:	88 07                	mov    %al,(%rdi)
+  80143f:	eb 98                	jmp    8013d9 <memset+0x46>
+
+0000000000801441 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801441:	48 89 f8             	mov    %rdi,%rax
+  801444:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801447:	48 39 fe             	cmp    %rdi,%rsi
+  80144a:	73 3b                	jae    801487 <memmove+0x46>
+  80144c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801450:	48 39 d7             	cmp    %rdx,%rdi
+  801453:	73 32                	jae    801487 <memmove+0x46>
+        s += n;
+        d += n;
+  801455:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801459:	48 89 d6             	mov    %rdx,%rsi
+  80145c:	48 09 fe             	or     %rdi,%rsi
+  80145f:	48 09 ce             	or     %rcx,%rsi
+  801462:	40 f6 c6 07          	test   $0x7,%sil
+  801466:	75 12                	jne    80147a <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801468:	48 83 ef 08          	sub    $0x8,%rdi
+  80146c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801470:	48 c1 e9 03          	shr    $0x3,%rcx
+  801474:	fd                   	std
+  801475:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801478:	fc                   	cld
+  801479:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80147a:	48 83 ef 01          	sub    $0x1,%rdi
+  80147e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801482:	fd                   	std
+  801483:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801485:	eb f1                	jmp    801478 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801487:	48 89 f2             	mov    %rsi,%rdx
+  80148a:	48 09 c2             	or     %rax,%rdx
+  80148d:	48 09 ca             	or     %rcx,%rdx
+  801490:	f6 c2 07             	test   $0x7,%dl
+  801493:	75 0c                	jne    8014a1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801495:	48 c1 e9 03          	shr    $0x3,%rcx
+  801499:	48 89 c7             	mov    %rax,%rdi
+  80149c:	fc                   	cld
+  80149d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8014a0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8014a1:	48 89 c7             	mov    %rax,%rdi
+  8014a4:	fc                   	cld
+  8014a5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8014a7:	c3                   	ret
+
+00000000008014a8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8014a8:	55                   	push   %rbp
+  8014a9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8014ac:	48 b8 41 14 80 00 00 	movabs $0x801441,%rax
+  8014b3:	00 00 00 
+  8014b6:	ff d0                	call   *%rax
+}
+  8014b8:	5d                   	pop    %rbp
+  8014b9:	c3                   	ret
+
+00000000008014ba <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8014ba:	55                   	push   %rbp
+  8014bb:	48 89 e5             	mov    %rsp,%rbp
+  8014be:	41 57                	push   %r15
+  8014c0:	41 56                	push   %r14
+  8014c2:	41 55                	push   %r13
+  8014c4:	41 54                	push   %r12
+  8014c6:	53                   	push   %rbx
+  8014c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8014cb:	49 89 fe             	mov    %rdi,%r14
+  8014ce:	49 89 f7             	mov    %rsi,%r15
+  8014d1:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8014d4:	48 89 f7             	mov    %rsi,%rdi
+  8014d7:	48 b8 09 12 80 00 00 	movabs $0x801209,%rax
+  8014de:	00 00 00 
+  8014e1:	ff d0                	call   *%rax
+  8014e3:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8014e6:	48 89 de             	mov    %rbx,%rsi
+  8014e9:	4c 89 f7             	mov    %r14,%rdi
+  8014ec:	48 b8 24 12 80 00 00 	movabs $0x801224,%rax
+  8014f3:	00 00 00 
+  8014f6:	ff d0                	call   *%rax
+  8014f8:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8014fb:	48 39 c3             	cmp    %rax,%rbx
+  8014fe:	74 36                	je     801536 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801500:	48 89 d8             	mov    %rbx,%rax
+  801503:	4c 29 e8             	sub    %r13,%rax
+  801506:	49 39 c4             	cmp    %rax,%r12
+  801509:	73 31                	jae    80153c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80150b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801510:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801514:	4c 89 fe             	mov    %r15,%rsi
+  801517:	48 b8 a8 14 80 00 00 	movabs $0x8014a8,%rax
+  80151e:	00 00 00 
+  801521:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801523:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801527:	48 83 c4 08          	add    $0x8,%rsp
+  80152b:	5b                   	pop    %rbx
+  80152c:	41 5c                	pop    %r12
+  80152e:	41 5d                	pop    %r13
+  801530:	41 5e                	pop    %r14
+  801532:	41 5f                	pop    %r15
+  801534:	5d                   	pop    %rbp
+  801535:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801536:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80153a:	eb eb                	jmp    801527 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80153c:	48 83 eb 01          	sub    $0x1,%rbx
+  801540:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801544:	48 89 da             	mov    %rbx,%rdx
+  801547:	4c 89 fe             	mov    %r15,%rsi
+  80154a:	48 b8 a8 14 80 00 00 	movabs $0x8014a8,%rax
+  801551:	00 00 00 
+  801554:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801556:	49 01 de             	add    %rbx,%r14
+  801559:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80155e:	eb c3                	jmp    801523 <strlcat+0x69>
+
+0000000000801560 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801560:	48 85 d2             	test   %rdx,%rdx
+  801563:	74 2d                	je     801592 <memcmp+0x32>
+  801565:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80156a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80156e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801573:	44 38 c1             	cmp    %r8b,%cl
+  801576:	75 0f                	jne    801587 <memcmp+0x27>
+    while (n-- > 0) {
+  801578:	48 83 c0 01          	add    $0x1,%rax
+  80157c:	48 39 c2             	cmp    %rax,%rdx
+  80157f:	75 e9                	jne    80156a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801581:	b8 00 00 00 00       	mov    $0x0,%eax
+  801586:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801587:	0f b6 c1             	movzbl %cl,%eax
+  80158a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80158e:	44 29 c0             	sub    %r8d,%eax
+  801591:	c3                   	ret
+    return 0;
+  801592:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801597:	c3                   	ret
+
+0000000000801598 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801598:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80159c:	48 39 c7             	cmp    %rax,%rdi
+  80159f:	73 0f                	jae    8015b0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8015a1:	40 38 37             	cmp    %sil,(%rdi)
+  8015a4:	74 0e                	je     8015b4 <memfind+0x1c>
+    for (; src < end; src++) {
+  8015a6:	48 83 c7 01          	add    $0x1,%rdi
+  8015aa:	48 39 f8             	cmp    %rdi,%rax
+  8015ad:	75 f2                	jne    8015a1 <memfind+0x9>
+  8015af:	c3                   	ret
+  8015b0:	48 89 f8             	mov    %rdi,%rax
+  8015b3:	c3                   	ret
+  8015b4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8015b7:	c3                   	ret
+
+00000000008015b8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8015b8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8015bb:	0f b6 37             	movzbl (%rdi),%esi
+  8015be:	40 80 fe 20          	cmp    $0x20,%sil
+  8015c2:	74 06                	je     8015ca <strtol+0x12>
+  8015c4:	40 80 fe 09          	cmp    $0x9,%sil
+  8015c8:	75 13                	jne    8015dd <strtol+0x25>
+  8015ca:	48 83 c7 01          	add    $0x1,%rdi
+  8015ce:	0f b6 37             	movzbl (%rdi),%esi
+  8015d1:	40 80 fe 20          	cmp    $0x20,%sil
+  8015d5:	74 f3                	je     8015ca <strtol+0x12>
+  8015d7:	40 80 fe 09          	cmp    $0x9,%sil
+  8015db:	74 ed                	je     8015ca <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8015dd:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8015e0:	83 e0 fd             	and    $0xfffffffd,%eax
+  8015e3:	3c 01                	cmp    $0x1,%al
+  8015e5:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8015e9:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8015ef:	75 0f                	jne    801600 <strtol+0x48>
+  8015f1:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8015f4:	74 14                	je     80160a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8015f6:	85 d2                	test   %edx,%edx
+  8015f8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8015fd:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801600:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801605:	4c 63 ca             	movslq %edx,%r9
+  801608:	eb 36                	jmp    801640 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80160a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80160e:	74 0f                	je     80161f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801610:	85 d2                	test   %edx,%edx
+  801612:	75 ec                	jne    801600 <strtol+0x48>
+        s++;
+  801614:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801618:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80161d:	eb e1                	jmp    801600 <strtol+0x48>
+        s += 2;
+  80161f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801623:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801628:	eb d6                	jmp    801600 <strtol+0x48>
+            dig -= '0';
+  80162a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80162d:	44 0f b6 c1          	movzbl %cl,%r8d
+  801631:	41 39 d0             	cmp    %edx,%r8d
+  801634:	7d 21                	jge    801657 <strtol+0x9f>
+        val = val * base + dig;
+  801636:	49 0f af c1          	imul   %r9,%rax
+  80163a:	0f b6 c9             	movzbl %cl,%ecx
+  80163d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801640:	48 83 c7 01          	add    $0x1,%rdi
+  801644:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801648:	80 f9 39             	cmp    $0x39,%cl
+  80164b:	76 dd                	jbe    80162a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80164d:	80 f9 7b             	cmp    $0x7b,%cl
+  801650:	77 05                	ja     801657 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801652:	83 e9 57             	sub    $0x57,%ecx
+  801655:	eb d6                	jmp    80162d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801657:	4d 85 d2             	test   %r10,%r10
+  80165a:	74 03                	je     80165f <strtol+0xa7>
+  80165c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80165f:	48 89 c2             	mov    %rax,%rdx
+  801662:	48 f7 da             	neg    %rdx
+  801665:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801669:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80166d:	c3                   	ret
+
+000000000080166e <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80166e:	55                   	push   %rbp
+  80166f:	48 89 e5             	mov    %rsp,%rbp
+  801672:	53                   	push   %rbx
+  801673:	48 89 fa             	mov    %rdi,%rdx
+  801676:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801679:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80167e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801683:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801688:	be 00 00 00 00       	mov    $0x0,%esi
+  80168d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801693:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801695:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801699:	c9                   	leave
+  80169a:	c3                   	ret
+
+000000000080169b <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80169b:	55                   	push   %rbp
+  80169c:	48 89 e5             	mov    %rsp,%rbp
+  80169f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016a0:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8016be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c4:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ca:	c9                   	leave
+  8016cb:	c3                   	ret
+
+00000000008016cc <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8016cc:	55                   	push   %rbp
+  8016cd:	48 89 e5             	mov    %rsp,%rbp
+  8016d0:	53                   	push   %rbx
+  8016d1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8016d5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d8:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016f9:	48 85 c0             	test   %rax,%rax
+  8016fc:	7f 06                	jg     801704 <sys_env_destroy+0x38>
+}
+  8016fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801702:	c9                   	leave
+  801703:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801704:	49 89 c0             	mov    %rax,%r8
+  801707:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80170c:	48 ba 90 40 80 00 00 	movabs $0x804090,%rdx
+  801713:	00 00 00 
+  801716:	be 26 00 00 00       	mov    $0x26,%esi
+  80171b:	48 bf af 40 80 00 00 	movabs $0x8040af,%rdi
+  801722:	00 00 00 
+  801725:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172a:	49 b9 d2 07 80 00 00 	movabs $0x8007d2,%r9
+  801731:	00 00 00 
+  801734:	41 ff d1             	call   *%r9
+
+0000000000801737 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801737:	55                   	push   %rbp
+  801738:	48 89 e5             	mov    %rsp,%rbp
+  80173b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80173c:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801741:	ba 00 00 00 00       	mov    $0x0,%edx
+  801746:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80174b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801750:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801755:	be 00 00 00 00       	mov    $0x0,%esi
+  80175a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801760:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801762:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801766:	c9                   	leave
+  801767:	c3                   	ret
+
+0000000000801768 <sys_yield>:
+
+void
+sys_yield(void) {
+  801768:	55                   	push   %rbp
+  801769:	48 89 e5             	mov    %rsp,%rbp
+  80176c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80176d:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801772:	ba 00 00 00 00       	mov    $0x0,%edx
+  801777:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80177c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801781:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801786:	be 00 00 00 00       	mov    $0x0,%esi
+  80178b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801791:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801793:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801797:	c9                   	leave
+  801798:	c3                   	ret
+
+0000000000801799 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801799:	55                   	push   %rbp
+  80179a:	48 89 e5             	mov    %rsp,%rbp
+  80179d:	53                   	push   %rbx
+  80179e:	48 89 fa             	mov    %rdi,%rdx
+  8017a1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017a9:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8017b0:	00 00 00 
+  8017b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8017bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c3:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8017c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c9:	c9                   	leave
+  8017ca:	c3                   	ret
+
+00000000008017cb <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8017cb:	55                   	push   %rbp
+  8017cc:	48 89 e5             	mov    %rsp,%rbp
+  8017cf:	53                   	push   %rbx
+  8017d0:	49 89 f8             	mov    %rdi,%r8
+  8017d3:	48 89 d3             	mov    %rdx,%rbx
+  8017d6:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8017d9:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017de:	4c 89 c2             	mov    %r8,%rdx
+  8017e1:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ef:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8017f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f5:	c9                   	leave
+  8017f6:	c3                   	ret
+
+00000000008017f7 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8017f7:	55                   	push   %rbp
+  8017f8:	48 89 e5             	mov    %rsp,%rbp
+  8017fb:	53                   	push   %rbx
+  8017fc:	48 83 ec 08          	sub    $0x8,%rsp
+  801800:	89 f8                	mov    %edi,%eax
+  801802:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801805:	48 63 f9             	movslq %ecx,%rdi
+  801808:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80180b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801810:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801813:	be 00 00 00 00       	mov    $0x0,%esi
+  801818:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80181e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801820:	48 85 c0             	test   %rax,%rax
+  801823:	7f 06                	jg     80182b <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801825:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801829:	c9                   	leave
+  80182a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80182b:	49 89 c0             	mov    %rax,%r8
+  80182e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801833:	48 ba 90 40 80 00 00 	movabs $0x804090,%rdx
+  80183a:	00 00 00 
+  80183d:	be 26 00 00 00       	mov    $0x26,%esi
+  801842:	48 bf af 40 80 00 00 	movabs $0x8040af,%rdi
+  801849:	00 00 00 
+  80184c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801851:	49 b9 d2 07 80 00 00 	movabs $0x8007d2,%r9
+  801858:	00 00 00 
+  80185b:	41 ff d1             	call   *%r9
+
+000000000080185e <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80185e:	55                   	push   %rbp
+  80185f:	48 89 e5             	mov    %rsp,%rbp
+  801862:	53                   	push   %rbx
+  801863:	48 83 ec 08          	sub    $0x8,%rsp
+  801867:	89 f8                	mov    %edi,%eax
+  801869:	49 89 f2             	mov    %rsi,%r10
+  80186c:	48 89 cf             	mov    %rcx,%rdi
+  80186f:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801872:	48 63 da             	movslq %edx,%rbx
+  801875:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801878:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80187d:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801880:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801883:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801885:	48 85 c0             	test   %rax,%rax
+  801888:	7f 06                	jg     801890 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80188a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80188e:	c9                   	leave
+  80188f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801890:	49 89 c0             	mov    %rax,%r8
+  801893:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801898:	48 ba 90 40 80 00 00 	movabs $0x804090,%rdx
+  80189f:	00 00 00 
+  8018a2:	be 26 00 00 00       	mov    $0x26,%esi
+  8018a7:	48 bf af 40 80 00 00 	movabs $0x8040af,%rdi
+  8018ae:	00 00 00 
+  8018b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b6:	49 b9 d2 07 80 00 00 	movabs $0x8007d2,%r9
+  8018bd:	00 00 00 
+  8018c0:	41 ff d1             	call   *%r9
+
+00000000008018c3 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8018c3:	55                   	push   %rbp
+  8018c4:	48 89 e5             	mov    %rsp,%rbp
+  8018c7:	53                   	push   %rbx
+  8018c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8018cc:	48 89 f1             	mov    %rsi,%rcx
+  8018cf:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8018d2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018d5:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018df:	be 00 00 00 00       	mov    $0x0,%esi
+  8018e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018ea:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018ec:	48 85 c0             	test   %rax,%rax
+  8018ef:	7f 06                	jg     8018f7 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8018f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018f5:	c9                   	leave
+  8018f6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018f7:	49 89 c0             	mov    %rax,%r8
+  8018fa:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8018ff:	48 ba 90 40 80 00 00 	movabs $0x804090,%rdx
+  801906:	00 00 00 
+  801909:	be 26 00 00 00       	mov    $0x26,%esi
+  80190e:	48 bf af 40 80 00 00 	movabs $0x8040af,%rdi
+  801915:	00 00 00 
+  801918:	b8 00 00 00 00       	mov    $0x0,%eax
+  80191d:	49 b9 d2 07 80 00 00 	movabs $0x8007d2,%r9
+  801924:	00 00 00 
+  801927:	41 ff d1             	call   *%r9
+
+000000000080192a <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  80192a:	55                   	push   %rbp
+  80192b:	48 89 e5             	mov    %rsp,%rbp
+  80192e:	53                   	push   %rbx
+  80192f:	48 83 ec 08          	sub    $0x8,%rsp
+  801933:	89 f8                	mov    %edi,%eax
+  801935:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801938:	48 63 f9             	movslq %ecx,%rdi
+  80193b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80193e:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801943:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801946:	be 00 00 00 00       	mov    $0x0,%esi
+  80194b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801951:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801953:	48 85 c0             	test   %rax,%rax
+  801956:	7f 06                	jg     80195e <sys_region_advise+0x34>
+}
+  801958:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80195c:	c9                   	leave
+  80195d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80195e:	49 89 c0             	mov    %rax,%r8
+  801961:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801966:	48 ba 90 40 80 00 00 	movabs $0x804090,%rdx
+  80196d:	00 00 00 
+  801970:	be 26 00 00 00       	mov    $0x26,%esi
+  801975:	48 bf af 40 80 00 00 	movabs $0x8040af,%rdi
+  80197c:	00 00 00 
+  80197f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801984:	49 b9 d2 07 80 00 00 	movabs $0x8007d2,%r9
+  80198b:	00 00 00 
+  80198e:	41 ff d1             	call   *%r9
+
+0000000000801991 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801991:	55                   	push   %rbp
+  801992:	48 89 e5             	mov    %rsp,%rbp
+  801995:	53                   	push   %rbx
+  801996:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  80199a:	48 63 ce             	movslq %esi,%rcx
+  80199d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019a0:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019aa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019af:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019ba:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019bc:	48 85 c0             	test   %rax,%rax
+  8019bf:	7f 06                	jg     8019c7 <sys_env_set_nice+0x36>
+}
+  8019c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019c5:	c9                   	leave
+  8019c6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019c7:	49 89 c0             	mov    %rax,%r8
+  8019ca:	b9 15 00 00 00       	mov    $0x15,%ecx
+  8019cf:	48 ba 90 40 80 00 00 	movabs $0x804090,%rdx
+  8019d6:	00 00 00 
+  8019d9:	be 26 00 00 00       	mov    $0x26,%esi
+  8019de:	48 bf af 40 80 00 00 	movabs $0x8040af,%rdi
+  8019e5:	00 00 00 
+  8019e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ed:	49 b9 d2 07 80 00 00 	movabs $0x8007d2,%r9
+  8019f4:	00 00 00 
+  8019f7:	41 ff d1             	call   *%r9
+
+00000000008019fa <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8019fa:	55                   	push   %rbp
+  8019fb:	48 89 e5             	mov    %rsp,%rbp
+  8019fe:	53                   	push   %rbx
+  8019ff:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801a03:	48 63 ce             	movslq %esi,%rcx
+  801a06:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a09:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a13:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a18:	be 00 00 00 00       	mov    $0x0,%esi
+  801a1d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a23:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a25:	48 85 c0             	test   %rax,%rax
+  801a28:	7f 06                	jg     801a30 <sys_env_set_status+0x36>
+}
+  801a2a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a2e:	c9                   	leave
+  801a2f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a30:	49 89 c0             	mov    %rax,%r8
+  801a33:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801a38:	48 ba 90 40 80 00 00 	movabs $0x804090,%rdx
+  801a3f:	00 00 00 
+  801a42:	be 26 00 00 00       	mov    $0x26,%esi
+  801a47:	48 bf af 40 80 00 00 	movabs $0x8040af,%rdi
+  801a4e:	00 00 00 
+  801a51:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a56:	49 b9 d2 07 80 00 00 	movabs $0x8007d2,%r9
+  801a5d:	00 00 00 
+  801a60:	41 ff d1             	call   *%r9
+
+0000000000801a63 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801a63:	55                   	push   %rbp
+  801a64:	48 89 e5             	mov    %rsp,%rbp
+  801a67:	53                   	push   %rbx
+  801a68:	48 83 ec 08          	sub    $0x8,%rsp
+  801a6c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801a6f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a72:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a7c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a81:	be 00 00 00 00       	mov    $0x0,%esi
+  801a86:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a8c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a8e:	48 85 c0             	test   %rax,%rax
+  801a91:	7f 06                	jg     801a99 <sys_env_set_trapframe+0x36>
+}
+  801a93:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a97:	c9                   	leave
+  801a98:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a99:	49 89 c0             	mov    %rax,%r8
+  801a9c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801aa1:	48 ba 90 40 80 00 00 	movabs $0x804090,%rdx
+  801aa8:	00 00 00 
+  801aab:	be 26 00 00 00       	mov    $0x26,%esi
+  801ab0:	48 bf af 40 80 00 00 	movabs $0x8040af,%rdi
+  801ab7:	00 00 00 
+  801aba:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abf:	49 b9 d2 07 80 00 00 	movabs $0x8007d2,%r9
+  801ac6:	00 00 00 
+  801ac9:	41 ff d1             	call   *%r9
+
+0000000000801acc <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801acc:	55                   	push   %rbp
+  801acd:	48 89 e5             	mov    %rsp,%rbp
+  801ad0:	53                   	push   %rbx
+  801ad1:	48 83 ec 08          	sub    $0x8,%rsp
+  801ad5:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801ad8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801adb:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ae0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ae5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aea:	be 00 00 00 00       	mov    $0x0,%esi
+  801aef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801af5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801af7:	48 85 c0             	test   %rax,%rax
+  801afa:	7f 06                	jg     801b02 <sys_env_set_pgfault_upcall+0x36>
+}
+  801afc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b00:	c9                   	leave
+  801b01:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b02:	49 89 c0             	mov    %rax,%r8
+  801b05:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801b0a:	48 ba 90 40 80 00 00 	movabs $0x804090,%rdx
+  801b11:	00 00 00 
+  801b14:	be 26 00 00 00       	mov    $0x26,%esi
+  801b19:	48 bf af 40 80 00 00 	movabs $0x8040af,%rdi
+  801b20:	00 00 00 
+  801b23:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b28:	49 b9 d2 07 80 00 00 	movabs $0x8007d2,%r9
+  801b2f:	00 00 00 
+  801b32:	41 ff d1             	call   *%r9
+
+0000000000801b35 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801b35:	55                   	push   %rbp
+  801b36:	48 89 e5             	mov    %rsp,%rbp
+  801b39:	53                   	push   %rbx
+  801b3a:	89 f8                	mov    %edi,%eax
+  801b3c:	49 89 f1             	mov    %rsi,%r9
+  801b3f:	48 89 d3             	mov    %rdx,%rbx
+  801b42:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801b45:	49 63 f0             	movslq %r8d,%rsi
+  801b48:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b4b:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b50:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b53:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b59:	cd 30                	int    $0x30
+}
+  801b5b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b5f:	c9                   	leave
+  801b60:	c3                   	ret
+
+0000000000801b61 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801b61:	55                   	push   %rbp
+  801b62:	48 89 e5             	mov    %rsp,%rbp
+  801b65:	53                   	push   %rbx
+  801b66:	48 83 ec 08          	sub    $0x8,%rsp
+  801b6a:	48 89 fa             	mov    %rdi,%rdx
+  801b6d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b70:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b7a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b7f:	be 00 00 00 00       	mov    $0x0,%esi
+  801b84:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b8a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b8c:	48 85 c0             	test   %rax,%rax
+  801b8f:	7f 06                	jg     801b97 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801b91:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b95:	c9                   	leave
+  801b96:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b97:	49 89 c0             	mov    %rax,%r8
+  801b9a:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801b9f:	48 ba 90 40 80 00 00 	movabs $0x804090,%rdx
+  801ba6:	00 00 00 
+  801ba9:	be 26 00 00 00       	mov    $0x26,%esi
+  801bae:	48 bf af 40 80 00 00 	movabs $0x8040af,%rdi
+  801bb5:	00 00 00 
+  801bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bbd:	49 b9 d2 07 80 00 00 	movabs $0x8007d2,%r9
+  801bc4:	00 00 00 
+  801bc7:	41 ff d1             	call   *%r9
+
+0000000000801bca <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801bca:	55                   	push   %rbp
+  801bcb:	48 89 e5             	mov    %rsp,%rbp
+  801bce:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801bcf:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bde:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801be3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801be8:	be 00 00 00 00       	mov    $0x0,%esi
+  801bed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bf3:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801bf5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bf9:	c9                   	leave
+  801bfa:	c3                   	ret
+
+0000000000801bfb <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  801bfb:	55                   	push   %rbp
+  801bfc:	48 89 e5             	mov    %rsp,%rbp
+  801bff:	53                   	push   %rbx
+  801c00:	48 83 ec 08          	sub    $0x8,%rsp
+  801c04:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801c07:	48 63 ce             	movslq %esi,%rcx
+  801c0a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c0d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c12:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c17:	be 00 00 00 00       	mov    $0x0,%esi
+  801c1c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c22:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c24:	48 85 c0             	test   %rax,%rax
+  801c27:	7f 06                	jg     801c2f <sys_sigqueue+0x34>
+}
+  801c29:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c2d:	c9                   	leave
+  801c2e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c2f:	49 89 c0             	mov    %rax,%r8
+  801c32:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801c37:	48 ba 90 40 80 00 00 	movabs $0x804090,%rdx
+  801c3e:	00 00 00 
+  801c41:	be 26 00 00 00       	mov    $0x26,%esi
+  801c46:	48 bf af 40 80 00 00 	movabs $0x8040af,%rdi
+  801c4d:	00 00 00 
+  801c50:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c55:	49 b9 d2 07 80 00 00 	movabs $0x8007d2,%r9
+  801c5c:	00 00 00 
+  801c5f:	41 ff d1             	call   *%r9
+
+0000000000801c62 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801c62:	55                   	push   %rbp
+  801c63:	48 89 e5             	mov    %rsp,%rbp
+  801c66:	53                   	push   %rbx
+  801c67:	48 83 ec 08          	sub    $0x8,%rsp
+  801c6b:	48 89 fa             	mov    %rdi,%rdx
+  801c6e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801c71:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c7b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c80:	be 00 00 00 00       	mov    $0x0,%esi
+  801c85:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c8b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c8d:	48 85 c0             	test   %rax,%rax
+  801c90:	7f 06                	jg     801c98 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801c92:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c96:	c9                   	leave
+  801c97:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c98:	49 89 c0             	mov    %rax,%r8
+  801c9b:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801ca0:	48 ba 90 40 80 00 00 	movabs $0x804090,%rdx
+  801ca7:	00 00 00 
+  801caa:	be 26 00 00 00       	mov    $0x26,%esi
+  801caf:	48 bf af 40 80 00 00 	movabs $0x8040af,%rdi
+  801cb6:	00 00 00 
+  801cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cbe:	49 b9 d2 07 80 00 00 	movabs $0x8007d2,%r9
+  801cc5:	00 00 00 
+  801cc8:	41 ff d1             	call   *%r9
+
+0000000000801ccb <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801ccb:	55                   	push   %rbp
+  801ccc:	48 89 e5             	mov    %rsp,%rbp
+  801ccf:	53                   	push   %rbx
+  801cd0:	48 83 ec 08          	sub    $0x8,%rsp
+  801cd4:	48 89 f1             	mov    %rsi,%rcx
+  801cd7:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801cda:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801cdd:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ce2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ce7:	be 00 00 00 00       	mov    $0x0,%esi
+  801cec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cf2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801cf4:	48 85 c0             	test   %rax,%rax
+  801cf7:	7f 06                	jg     801cff <sys_sigaction+0x34>
+}
+  801cf9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cfd:	c9                   	leave
+  801cfe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801cff:	49 89 c0             	mov    %rax,%r8
+  801d02:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801d07:	48 ba 90 40 80 00 00 	movabs $0x804090,%rdx
+  801d0e:	00 00 00 
+  801d11:	be 26 00 00 00       	mov    $0x26,%esi
+  801d16:	48 bf af 40 80 00 00 	movabs $0x8040af,%rdi
+  801d1d:	00 00 00 
+  801d20:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d25:	49 b9 d2 07 80 00 00 	movabs $0x8007d2,%r9
+  801d2c:	00 00 00 
+  801d2f:	41 ff d1             	call   *%r9
+
+0000000000801d32 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801d32:	55                   	push   %rbp
+  801d33:	48 89 e5             	mov    %rsp,%rbp
+  801d36:	53                   	push   %rbx
+  801d37:	48 83 ec 08          	sub    $0x8,%rsp
+  801d3b:	48 89 f1             	mov    %rsi,%rcx
+  801d3e:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801d41:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801d44:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d49:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d4e:	be 00 00 00 00       	mov    $0x0,%esi
+  801d53:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d59:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801d5b:	48 85 c0             	test   %rax,%rax
+  801d5e:	7f 06                	jg     801d66 <sys_sigprocmask+0x34>
+}
+  801d60:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d64:	c9                   	leave
+  801d65:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801d66:	49 89 c0             	mov    %rax,%r8
+  801d69:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801d6e:	48 ba 90 40 80 00 00 	movabs $0x804090,%rdx
+  801d75:	00 00 00 
+  801d78:	be 26 00 00 00       	mov    $0x26,%esi
+  801d7d:	48 bf af 40 80 00 00 	movabs $0x8040af,%rdi
+  801d84:	00 00 00 
+  801d87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d8c:	49 b9 d2 07 80 00 00 	movabs $0x8007d2,%r9
+  801d93:	00 00 00 
+  801d96:	41 ff d1             	call   *%r9
+
+0000000000801d99 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801d99:	55                   	push   %rbp
+  801d9a:	48 89 e5             	mov    %rsp,%rbp
+  801d9d:	41 54                	push   %r12
+  801d9f:	53                   	push   %rbx
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801da0:	b8 08 00 00 00       	mov    $0x8,%eax
+  801da5:	cd 30                	int    $0x30
+  801da7:	41 89 c4             	mov    %eax,%r12d
+    // LAB 9: Your code here
+    envid_t child_id = sys_exofork();
+    if (child_id < 0)
+  801daa:	85 c0                	test   %eax,%eax
+  801dac:	78 76                	js     801e24 <fork+0x8b>
+        return child_id;
+    
+    if (child_id == 0) {
+  801dae:	74 7c                	je     801e2c <fork+0x93>
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+        thisenv = envs + env_idx;
+        return 0;
+    }
+
+    if (sys_map_region(CURENVID, 0, child_id, 0, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE))
+  801db0:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801db6:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801dbd:	00 00 00 
+  801dc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dc5:	89 c2                	mov    %eax,%edx
+  801dc7:	be 00 00 00 00       	mov    $0x0,%esi
+  801dcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dd1:	48 b8 5e 18 80 00 00 	movabs $0x80185e,%rax
+  801dd8:	00 00 00 
+  801ddb:	ff d0                	call   *%rax
+  801ddd:	85 c0                	test   %eax,%eax
+  801ddf:	75 7a                	jne    801e5b <fork+0xc2>
+        return -1;
+
+    if (sys_env_set_pgfault_upcall(child_id, thisenv->env_pgfault_upcall))
+  801de1:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801de8:	00 00 00 
+  801deb:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801df2:	44 89 e7             	mov    %r12d,%edi
+  801df5:	48 b8 cc 1a 80 00 00 	movabs $0x801acc,%rax
+  801dfc:	00 00 00 
+  801dff:	ff d0                	call   *%rax
+  801e01:	85 c0                	test   %eax,%eax
+  801e03:	75 5e                	jne    801e63 <fork+0xca>
+        return -1;
+
+    if (sys_env_set_status(child_id, ENV_RUNNABLE))
+  801e05:	be 02 00 00 00       	mov    $0x2,%esi
+  801e0a:	44 89 e7             	mov    %r12d,%edi
+  801e0d:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801e14:	00 00 00 
+  801e17:	ff d0                	call   *%rax
+        return -1;
+  801e19:	85 c0                	test   %eax,%eax
+  801e1b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801e20:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return child_id;
+}
+  801e24:	44 89 e0             	mov    %r12d,%eax
+  801e27:	5b                   	pop    %rbx
+  801e28:	41 5c                	pop    %r12
+  801e2a:	5d                   	pop    %rbp
+  801e2b:	c3                   	ret
+        size_t env_idx = sys_getenvid() & env_idx_mask;
+  801e2c:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  801e33:	00 00 00 
+  801e36:	ff d0                	call   *%rax
+  801e38:	0f b6 c0             	movzbl %al,%eax
+        thisenv = envs + env_idx;
+  801e3b:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  801e42:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801e49:	00 00 00 
+  801e4c:	48 01 d0             	add    %rdx,%rax
+  801e4f:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  801e56:	00 00 00 
+        return 0;
+  801e59:	eb c9                	jmp    801e24 <fork+0x8b>
+        return -1;
+  801e5b:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801e61:	eb c1                	jmp    801e24 <fork+0x8b>
+        return -1;
+  801e63:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801e69:	eb b9                	jmp    801e24 <fork+0x8b>
+
+0000000000801e6b <sfork>:
+
+envid_t
+sfork() {
+  801e6b:	55                   	push   %rbp
+  801e6c:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801e6f:	48 ba bd 40 80 00 00 	movabs $0x8040bd,%rdx
+  801e76:	00 00 00 
+  801e79:	be 2e 00 00 00       	mov    $0x2e,%esi
+  801e7e:	48 bf d8 40 80 00 00 	movabs $0x8040d8,%rdi
+  801e85:	00 00 00 
+  801e88:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8d:	48 b9 d2 07 80 00 00 	movabs $0x8007d2,%rcx
+  801e94:	00 00 00 
+  801e97:	ff d1                	call   *%rcx
+
+0000000000801e99 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e99:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801ea0:	ff ff ff 
+  801ea3:	48 01 f8             	add    %rdi,%rax
+  801ea6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801eaa:	c3                   	ret
+
+0000000000801eab <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801eab:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801eb2:	ff ff ff 
+  801eb5:	48 01 f8             	add    %rdi,%rax
+  801eb8:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801ebc:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801ec2:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801ec6:	c3                   	ret
+
+0000000000801ec7 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801ec7:	55                   	push   %rbp
+  801ec8:	48 89 e5             	mov    %rsp,%rbp
+  801ecb:	41 57                	push   %r15
+  801ecd:	41 56                	push   %r14
+  801ecf:	41 55                	push   %r13
+  801ed1:	41 54                	push   %r12
+  801ed3:	53                   	push   %rbx
+  801ed4:	48 83 ec 08          	sub    $0x8,%rsp
+  801ed8:	49 89 ff             	mov    %rdi,%r15
+  801edb:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801ee0:	49 bd 3f 37 80 00 00 	movabs $0x80373f,%r13
+  801ee7:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801eea:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801ef0:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801ef3:	48 89 df             	mov    %rbx,%rdi
+  801ef6:	41 ff d5             	call   *%r13
+  801ef9:	83 e0 04             	and    $0x4,%eax
+  801efc:	74 17                	je     801f15 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801efe:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801f05:	4c 39 f3             	cmp    %r14,%rbx
+  801f08:	75 e6                	jne    801ef0 <fd_alloc+0x29>
+  801f0a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801f10:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801f15:	4d 89 27             	mov    %r12,(%r15)
+}
+  801f18:	48 83 c4 08          	add    $0x8,%rsp
+  801f1c:	5b                   	pop    %rbx
+  801f1d:	41 5c                	pop    %r12
+  801f1f:	41 5d                	pop    %r13
+  801f21:	41 5e                	pop    %r14
+  801f23:	41 5f                	pop    %r15
+  801f25:	5d                   	pop    %rbp
+  801f26:	c3                   	ret
+
+0000000000801f27 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801f27:	83 ff 1f             	cmp    $0x1f,%edi
+  801f2a:	77 39                	ja     801f65 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801f2c:	55                   	push   %rbp
+  801f2d:	48 89 e5             	mov    %rsp,%rbp
+  801f30:	41 54                	push   %r12
+  801f32:	53                   	push   %rbx
+  801f33:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801f36:	48 63 df             	movslq %edi,%rbx
+  801f39:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801f40:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801f44:	48 89 df             	mov    %rbx,%rdi
+  801f47:	48 b8 3f 37 80 00 00 	movabs $0x80373f,%rax
+  801f4e:	00 00 00 
+  801f51:	ff d0                	call   *%rax
+  801f53:	a8 04                	test   $0x4,%al
+  801f55:	74 14                	je     801f6b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801f57:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801f5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f60:	5b                   	pop    %rbx
+  801f61:	41 5c                	pop    %r12
+  801f63:	5d                   	pop    %rbp
+  801f64:	c3                   	ret
+        return -E_INVAL;
+  801f65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801f6a:	c3                   	ret
+        return -E_INVAL;
+  801f6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f70:	eb ee                	jmp    801f60 <fd_lookup+0x39>
+
+0000000000801f72 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801f72:	55                   	push   %rbp
+  801f73:	48 89 e5             	mov    %rsp,%rbp
+  801f76:	41 54                	push   %r12
+  801f78:	53                   	push   %rbx
+  801f79:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801f7c:	48 b8 80 41 80 00 00 	movabs $0x804180,%rax
+  801f83:	00 00 00 
+  801f86:	48 bb 40 50 80 00 00 	movabs $0x805040,%rbx
+  801f8d:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801f90:	39 3b                	cmp    %edi,(%rbx)
+  801f92:	74 47                	je     801fdb <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801f94:	48 83 c0 08          	add    $0x8,%rax
+  801f98:	48 8b 18             	mov    (%rax),%rbx
+  801f9b:	48 85 db             	test   %rbx,%rbx
+  801f9e:	75 f0                	jne    801f90 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801fa0:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801fa7:	00 00 00 
+  801faa:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fb0:	89 fa                	mov    %edi,%edx
+  801fb2:	48 bf e8 40 80 00 00 	movabs $0x8040e8,%rdi
+  801fb9:	00 00 00 
+  801fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc1:	48 b9 22 09 80 00 00 	movabs $0x800922,%rcx
+  801fc8:	00 00 00 
+  801fcb:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801fcd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801fd2:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801fd6:	5b                   	pop    %rbx
+  801fd7:	41 5c                	pop    %r12
+  801fd9:	5d                   	pop    %rbp
+  801fda:	c3                   	ret
+            return 0;
+  801fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe0:	eb f0                	jmp    801fd2 <dev_lookup+0x60>
+
+0000000000801fe2 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801fe2:	55                   	push   %rbp
+  801fe3:	48 89 e5             	mov    %rsp,%rbp
+  801fe6:	41 55                	push   %r13
+  801fe8:	41 54                	push   %r12
+  801fea:	53                   	push   %rbx
+  801feb:	48 83 ec 18          	sub    $0x18,%rsp
+  801fef:	48 89 fb             	mov    %rdi,%rbx
+  801ff2:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ff5:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801ffc:	ff ff ff 
+  801fff:	48 01 df             	add    %rbx,%rdi
+  802002:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802006:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80200a:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  802011:	00 00 00 
+  802014:	ff d0                	call   *%rax
+  802016:	41 89 c5             	mov    %eax,%r13d
+  802019:	85 c0                	test   %eax,%eax
+  80201b:	78 06                	js     802023 <fd_close+0x41>
+  80201d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802021:	74 1a                	je     80203d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802023:	45 84 e4             	test   %r12b,%r12b
+  802026:	b8 00 00 00 00       	mov    $0x0,%eax
+  80202b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80202f:	44 89 e8             	mov    %r13d,%eax
+  802032:	48 83 c4 18          	add    $0x18,%rsp
+  802036:	5b                   	pop    %rbx
+  802037:	41 5c                	pop    %r12
+  802039:	41 5d                	pop    %r13
+  80203b:	5d                   	pop    %rbp
+  80203c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80203d:	8b 3b                	mov    (%rbx),%edi
+  80203f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802043:	48 b8 72 1f 80 00 00 	movabs $0x801f72,%rax
+  80204a:	00 00 00 
+  80204d:	ff d0                	call   *%rax
+  80204f:	41 89 c5             	mov    %eax,%r13d
+  802052:	85 c0                	test   %eax,%eax
+  802054:	78 1b                	js     802071 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802056:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80205a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80205e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802064:	48 85 c0             	test   %rax,%rax
+  802067:	74 08                	je     802071 <fd_close+0x8f>
+  802069:	48 89 df             	mov    %rbx,%rdi
+  80206c:	ff d0                	call   *%rax
+  80206e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802071:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802076:	48 89 de             	mov    %rbx,%rsi
+  802079:	bf 00 00 00 00       	mov    $0x0,%edi
+  80207e:	48 b8 c3 18 80 00 00 	movabs $0x8018c3,%rax
+  802085:	00 00 00 
+  802088:	ff d0                	call   *%rax
+    return res;
+  80208a:	eb a3                	jmp    80202f <fd_close+0x4d>
+
+000000000080208c <close>:
+
+int
+close(int fdnum) {
+  80208c:	55                   	push   %rbp
+  80208d:	48 89 e5             	mov    %rsp,%rbp
+  802090:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802094:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802098:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  80209f:	00 00 00 
+  8020a2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020a4:	85 c0                	test   %eax,%eax
+  8020a6:	78 15                	js     8020bd <close+0x31>
+
+    return fd_close(fd, 1);
+  8020a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8020ad:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020b1:	48 b8 e2 1f 80 00 00 	movabs $0x801fe2,%rax
+  8020b8:	00 00 00 
+  8020bb:	ff d0                	call   *%rax
+}
+  8020bd:	c9                   	leave
+  8020be:	c3                   	ret
+
+00000000008020bf <close_all>:
+
+void
+close_all(void) {
+  8020bf:	55                   	push   %rbp
+  8020c0:	48 89 e5             	mov    %rsp,%rbp
+  8020c3:	41 54                	push   %r12
+  8020c5:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8020c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020cb:	49 bc 8c 20 80 00 00 	movabs $0x80208c,%r12
+  8020d2:	00 00 00 
+  8020d5:	89 df                	mov    %ebx,%edi
+  8020d7:	41 ff d4             	call   *%r12
+  8020da:	83 c3 01             	add    $0x1,%ebx
+  8020dd:	83 fb 20             	cmp    $0x20,%ebx
+  8020e0:	75 f3                	jne    8020d5 <close_all+0x16>
+}
+  8020e2:	5b                   	pop    %rbx
+  8020e3:	41 5c                	pop    %r12
+  8020e5:	5d                   	pop    %rbp
+  8020e6:	c3                   	ret
+
+00000000008020e7 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8020e7:	55                   	push   %rbp
+  8020e8:	48 89 e5             	mov    %rsp,%rbp
+  8020eb:	41 57                	push   %r15
+  8020ed:	41 56                	push   %r14
+  8020ef:	41 55                	push   %r13
+  8020f1:	41 54                	push   %r12
+  8020f3:	53                   	push   %rbx
+  8020f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8020f8:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8020fb:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8020ff:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  802106:	00 00 00 
+  802109:	ff d0                	call   *%rax
+  80210b:	89 c3                	mov    %eax,%ebx
+  80210d:	85 c0                	test   %eax,%eax
+  80210f:	0f 88 b8 00 00 00    	js     8021cd <dup+0xe6>
+    close(newfdnum);
+  802115:	44 89 e7             	mov    %r12d,%edi
+  802118:	48 b8 8c 20 80 00 00 	movabs $0x80208c,%rax
+  80211f:	00 00 00 
+  802122:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802124:	4d 63 ec             	movslq %r12d,%r13
+  802127:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80212e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802132:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802136:	4c 89 ff             	mov    %r15,%rdi
+  802139:	49 be ab 1e 80 00 00 	movabs $0x801eab,%r14
+  802140:	00 00 00 
+  802143:	41 ff d6             	call   *%r14
+  802146:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802149:	4c 89 ef             	mov    %r13,%rdi
+  80214c:	41 ff d6             	call   *%r14
+  80214f:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802152:	48 89 df             	mov    %rbx,%rdi
+  802155:	48 b8 3f 37 80 00 00 	movabs $0x80373f,%rax
+  80215c:	00 00 00 
+  80215f:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802161:	a8 04                	test   $0x4,%al
+  802163:	74 2b                	je     802190 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802165:	41 89 c1             	mov    %eax,%r9d
+  802168:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80216e:	4c 89 f1             	mov    %r14,%rcx
+  802171:	ba 00 00 00 00       	mov    $0x0,%edx
+  802176:	48 89 de             	mov    %rbx,%rsi
+  802179:	bf 00 00 00 00       	mov    $0x0,%edi
+  80217e:	48 b8 5e 18 80 00 00 	movabs $0x80185e,%rax
+  802185:	00 00 00 
+  802188:	ff d0                	call   *%rax
+  80218a:	89 c3                	mov    %eax,%ebx
+  80218c:	85 c0                	test   %eax,%eax
+  80218e:	78 4e                	js     8021de <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802190:	4c 89 ff             	mov    %r15,%rdi
+  802193:	48 b8 3f 37 80 00 00 	movabs $0x80373f,%rax
+  80219a:	00 00 00 
+  80219d:	ff d0                	call   *%rax
+  80219f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8021a2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8021a8:	4c 89 e9             	mov    %r13,%rcx
+  8021ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021b0:	4c 89 fe             	mov    %r15,%rsi
+  8021b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021b8:	48 b8 5e 18 80 00 00 	movabs $0x80185e,%rax
+  8021bf:	00 00 00 
+  8021c2:	ff d0                	call   *%rax
+  8021c4:	89 c3                	mov    %eax,%ebx
+  8021c6:	85 c0                	test   %eax,%eax
+  8021c8:	78 14                	js     8021de <dup+0xf7>
+
+    return newfdnum;
+  8021ca:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8021cd:	89 d8                	mov    %ebx,%eax
+  8021cf:	48 83 c4 18          	add    $0x18,%rsp
+  8021d3:	5b                   	pop    %rbx
+  8021d4:	41 5c                	pop    %r12
+  8021d6:	41 5d                	pop    %r13
+  8021d8:	41 5e                	pop    %r14
+  8021da:	41 5f                	pop    %r15
+  8021dc:	5d                   	pop    %rbp
+  8021dd:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8021de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021e3:	4c 89 ee             	mov    %r13,%rsi
+  8021e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021eb:	49 bc c3 18 80 00 00 	movabs $0x8018c3,%r12
+  8021f2:	00 00 00 
+  8021f5:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8021f8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021fd:	4c 89 f6             	mov    %r14,%rsi
+  802200:	bf 00 00 00 00       	mov    $0x0,%edi
+  802205:	41 ff d4             	call   *%r12
+    return res;
+  802208:	eb c3                	jmp    8021cd <dup+0xe6>
+
+000000000080220a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80220a:	55                   	push   %rbp
+  80220b:	48 89 e5             	mov    %rsp,%rbp
+  80220e:	41 56                	push   %r14
+  802210:	41 55                	push   %r13
+  802212:	41 54                	push   %r12
+  802214:	53                   	push   %rbx
+  802215:	48 83 ec 10          	sub    $0x10,%rsp
+  802219:	89 fb                	mov    %edi,%ebx
+  80221b:	49 89 f4             	mov    %rsi,%r12
+  80221e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802221:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802225:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  80222c:	00 00 00 
+  80222f:	ff d0                	call   *%rax
+  802231:	85 c0                	test   %eax,%eax
+  802233:	78 4c                	js     802281 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802235:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802239:	41 8b 3e             	mov    (%r14),%edi
+  80223c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802240:	48 b8 72 1f 80 00 00 	movabs $0x801f72,%rax
+  802247:	00 00 00 
+  80224a:	ff d0                	call   *%rax
+  80224c:	85 c0                	test   %eax,%eax
+  80224e:	78 35                	js     802285 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802250:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802254:	83 e0 03             	and    $0x3,%eax
+  802257:	83 f8 01             	cmp    $0x1,%eax
+  80225a:	74 2d                	je     802289 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80225c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802260:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802264:	48 85 c0             	test   %rax,%rax
+  802267:	74 56                	je     8022bf <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802269:	4c 89 ea             	mov    %r13,%rdx
+  80226c:	4c 89 e6             	mov    %r12,%rsi
+  80226f:	4c 89 f7             	mov    %r14,%rdi
+  802272:	ff d0                	call   *%rax
+}
+  802274:	48 83 c4 10          	add    $0x10,%rsp
+  802278:	5b                   	pop    %rbx
+  802279:	41 5c                	pop    %r12
+  80227b:	41 5d                	pop    %r13
+  80227d:	41 5e                	pop    %r14
+  80227f:	5d                   	pop    %rbp
+  802280:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802281:	48 98                	cltq
+  802283:	eb ef                	jmp    802274 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802285:	48 98                	cltq
+  802287:	eb eb                	jmp    802274 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802289:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802290:	00 00 00 
+  802293:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802299:	89 da                	mov    %ebx,%edx
+  80229b:	48 bf 29 41 80 00 00 	movabs $0x804129,%rdi
+  8022a2:	00 00 00 
+  8022a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022aa:	48 b9 22 09 80 00 00 	movabs $0x800922,%rcx
+  8022b1:	00 00 00 
+  8022b4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8022b6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8022bd:	eb b5                	jmp    802274 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8022bf:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8022c6:	eb ac                	jmp    802274 <read+0x6a>
+
+00000000008022c8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8022c8:	55                   	push   %rbp
+  8022c9:	48 89 e5             	mov    %rsp,%rbp
+  8022cc:	41 57                	push   %r15
+  8022ce:	41 56                	push   %r14
+  8022d0:	41 55                	push   %r13
+  8022d2:	41 54                	push   %r12
+  8022d4:	53                   	push   %rbx
+  8022d5:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8022d9:	48 85 d2             	test   %rdx,%rdx
+  8022dc:	74 54                	je     802332 <readn+0x6a>
+  8022de:	41 89 fd             	mov    %edi,%r13d
+  8022e1:	49 89 f6             	mov    %rsi,%r14
+  8022e4:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8022e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8022ec:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8022f1:	49 bf 0a 22 80 00 00 	movabs $0x80220a,%r15
+  8022f8:	00 00 00 
+  8022fb:	4c 89 e2             	mov    %r12,%rdx
+  8022fe:	48 29 f2             	sub    %rsi,%rdx
+  802301:	4c 01 f6             	add    %r14,%rsi
+  802304:	44 89 ef             	mov    %r13d,%edi
+  802307:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80230a:	85 c0                	test   %eax,%eax
+  80230c:	78 20                	js     80232e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80230e:	01 c3                	add    %eax,%ebx
+  802310:	85 c0                	test   %eax,%eax
+  802312:	74 08                	je     80231c <readn+0x54>
+  802314:	48 63 f3             	movslq %ebx,%rsi
+  802317:	4c 39 e6             	cmp    %r12,%rsi
+  80231a:	72 df                	jb     8022fb <readn+0x33>
+    }
+    return res;
+  80231c:	48 63 c3             	movslq %ebx,%rax
+}
+  80231f:	48 83 c4 08          	add    $0x8,%rsp
+  802323:	5b                   	pop    %rbx
+  802324:	41 5c                	pop    %r12
+  802326:	41 5d                	pop    %r13
+  802328:	41 5e                	pop    %r14
+  80232a:	41 5f                	pop    %r15
+  80232c:	5d                   	pop    %rbp
+  80232d:	c3                   	ret
+        if (inc < 0) return inc;
+  80232e:	48 98                	cltq
+  802330:	eb ed                	jmp    80231f <readn+0x57>
+    int inc = 1, res = 0;
+  802332:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802337:	eb e3                	jmp    80231c <readn+0x54>
+
+0000000000802339 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802339:	55                   	push   %rbp
+  80233a:	48 89 e5             	mov    %rsp,%rbp
+  80233d:	41 56                	push   %r14
+  80233f:	41 55                	push   %r13
+  802341:	41 54                	push   %r12
+  802343:	53                   	push   %rbx
+  802344:	48 83 ec 10          	sub    $0x10,%rsp
+  802348:	89 fb                	mov    %edi,%ebx
+  80234a:	49 89 f4             	mov    %rsi,%r12
+  80234d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802350:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802354:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  80235b:	00 00 00 
+  80235e:	ff d0                	call   *%rax
+  802360:	85 c0                	test   %eax,%eax
+  802362:	78 47                	js     8023ab <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802364:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802368:	41 8b 3e             	mov    (%r14),%edi
+  80236b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80236f:	48 b8 72 1f 80 00 00 	movabs $0x801f72,%rax
+  802376:	00 00 00 
+  802379:	ff d0                	call   *%rax
+  80237b:	85 c0                	test   %eax,%eax
+  80237d:	78 30                	js     8023af <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80237f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802384:	74 2d                	je     8023b3 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802386:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80238a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80238e:	48 85 c0             	test   %rax,%rax
+  802391:	74 56                	je     8023e9 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802393:	4c 89 ea             	mov    %r13,%rdx
+  802396:	4c 89 e6             	mov    %r12,%rsi
+  802399:	4c 89 f7             	mov    %r14,%rdi
+  80239c:	ff d0                	call   *%rax
+}
+  80239e:	48 83 c4 10          	add    $0x10,%rsp
+  8023a2:	5b                   	pop    %rbx
+  8023a3:	41 5c                	pop    %r12
+  8023a5:	41 5d                	pop    %r13
+  8023a7:	41 5e                	pop    %r14
+  8023a9:	5d                   	pop    %rbp
+  8023aa:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023ab:	48 98                	cltq
+  8023ad:	eb ef                	jmp    80239e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023af:	48 98                	cltq
+  8023b1:	eb eb                	jmp    80239e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8023b3:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8023ba:	00 00 00 
+  8023bd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023c3:	89 da                	mov    %ebx,%edx
+  8023c5:	48 bf 45 41 80 00 00 	movabs $0x804145,%rdi
+  8023cc:	00 00 00 
+  8023cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d4:	48 b9 22 09 80 00 00 	movabs $0x800922,%rcx
+  8023db:	00 00 00 
+  8023de:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8023e0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023e7:	eb b5                	jmp    80239e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8023e9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8023f0:	eb ac                	jmp    80239e <write+0x65>
+
+00000000008023f2 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8023f2:	55                   	push   %rbp
+  8023f3:	48 89 e5             	mov    %rsp,%rbp
+  8023f6:	53                   	push   %rbx
+  8023f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8023fb:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023fd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802401:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  802408:	00 00 00 
+  80240b:	ff d0                	call   *%rax
+  80240d:	85 c0                	test   %eax,%eax
+  80240f:	78 0c                	js     80241d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802411:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802415:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802418:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80241d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802421:	c9                   	leave
+  802422:	c3                   	ret
+
+0000000000802423 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802423:	55                   	push   %rbp
+  802424:	48 89 e5             	mov    %rsp,%rbp
+  802427:	41 55                	push   %r13
+  802429:	41 54                	push   %r12
+  80242b:	53                   	push   %rbx
+  80242c:	48 83 ec 18          	sub    $0x18,%rsp
+  802430:	89 fb                	mov    %edi,%ebx
+  802432:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802435:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802439:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  802440:	00 00 00 
+  802443:	ff d0                	call   *%rax
+  802445:	85 c0                	test   %eax,%eax
+  802447:	78 38                	js     802481 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802449:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80244d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802451:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802455:	48 b8 72 1f 80 00 00 	movabs $0x801f72,%rax
+  80245c:	00 00 00 
+  80245f:	ff d0                	call   *%rax
+  802461:	85 c0                	test   %eax,%eax
+  802463:	78 1c                	js     802481 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802465:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80246a:	74 20                	je     80248c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80246c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802470:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802474:	48 85 c0             	test   %rax,%rax
+  802477:	74 47                	je     8024c0 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802479:	44 89 e6             	mov    %r12d,%esi
+  80247c:	4c 89 ef             	mov    %r13,%rdi
+  80247f:	ff d0                	call   *%rax
+}
+  802481:	48 83 c4 18          	add    $0x18,%rsp
+  802485:	5b                   	pop    %rbx
+  802486:	41 5c                	pop    %r12
+  802488:	41 5d                	pop    %r13
+  80248a:	5d                   	pop    %rbp
+  80248b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80248c:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802493:	00 00 00 
+  802496:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80249c:	89 da                	mov    %ebx,%edx
+  80249e:	48 bf 08 41 80 00 00 	movabs $0x804108,%rdi
+  8024a5:	00 00 00 
+  8024a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ad:	48 b9 22 09 80 00 00 	movabs $0x800922,%rcx
+  8024b4:	00 00 00 
+  8024b7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8024b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024be:	eb c1                	jmp    802481 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8024c0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024c5:	eb ba                	jmp    802481 <ftruncate+0x5e>
+
+00000000008024c7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8024c7:	55                   	push   %rbp
+  8024c8:	48 89 e5             	mov    %rsp,%rbp
+  8024cb:	41 54                	push   %r12
+  8024cd:	53                   	push   %rbx
+  8024ce:	48 83 ec 10          	sub    $0x10,%rsp
+  8024d2:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024d5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024d9:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  8024e0:	00 00 00 
+  8024e3:	ff d0                	call   *%rax
+  8024e5:	85 c0                	test   %eax,%eax
+  8024e7:	78 4e                	js     802537 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024e9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8024ed:	41 8b 3c 24          	mov    (%r12),%edi
+  8024f1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8024f5:	48 b8 72 1f 80 00 00 	movabs $0x801f72,%rax
+  8024fc:	00 00 00 
+  8024ff:	ff d0                	call   *%rax
+  802501:	85 c0                	test   %eax,%eax
+  802503:	78 32                	js     802537 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802505:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802509:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80250e:	74 30                	je     802540 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802510:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802513:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80251a:	00 00 00 
+    stat->st_isdir = 0;
+  80251d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802524:	00 00 00 
+    stat->st_dev = dev;
+  802527:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80252e:	48 89 de             	mov    %rbx,%rsi
+  802531:	4c 89 e7             	mov    %r12,%rdi
+  802534:	ff 50 28             	call   *0x28(%rax)
+}
+  802537:	48 83 c4 10          	add    $0x10,%rsp
+  80253b:	5b                   	pop    %rbx
+  80253c:	41 5c                	pop    %r12
+  80253e:	5d                   	pop    %rbp
+  80253f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802540:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802545:	eb f0                	jmp    802537 <fstat+0x70>
+
+0000000000802547 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802547:	55                   	push   %rbp
+  802548:	48 89 e5             	mov    %rsp,%rbp
+  80254b:	41 54                	push   %r12
+  80254d:	53                   	push   %rbx
+  80254e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802551:	be 00 00 00 00       	mov    $0x0,%esi
+  802556:	48 b8 c8 27 80 00 00 	movabs $0x8027c8,%rax
+  80255d:	00 00 00 
+  802560:	ff d0                	call   *%rax
+  802562:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802564:	85 c0                	test   %eax,%eax
+  802566:	78 25                	js     80258d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802568:	4c 89 e6             	mov    %r12,%rsi
+  80256b:	89 c7                	mov    %eax,%edi
+  80256d:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  802574:	00 00 00 
+  802577:	ff d0                	call   *%rax
+  802579:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80257c:	89 df                	mov    %ebx,%edi
+  80257e:	48 b8 8c 20 80 00 00 	movabs $0x80208c,%rax
+  802585:	00 00 00 
+  802588:	ff d0                	call   *%rax
+
+    return res;
+  80258a:	44 89 e3             	mov    %r12d,%ebx
+}
+  80258d:	89 d8                	mov    %ebx,%eax
+  80258f:	5b                   	pop    %rbx
+  802590:	41 5c                	pop    %r12
+  802592:	5d                   	pop    %rbp
+  802593:	c3                   	ret
+
+0000000000802594 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802594:	55                   	push   %rbp
+  802595:	48 89 e5             	mov    %rsp,%rbp
+  802598:	41 54                	push   %r12
+  80259a:	53                   	push   %rbx
+  80259b:	48 83 ec 10          	sub    $0x10,%rsp
+  80259f:	41 89 fc             	mov    %edi,%r12d
+  8025a2:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8025a5:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8025ac:	00 00 00 
+  8025af:	83 38 00             	cmpl   $0x0,(%rax)
+  8025b2:	74 5e                	je     802612 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8025b4:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8025ba:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025bf:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8025c6:	00 00 00 
+  8025c9:	44 89 e6             	mov    %r12d,%esi
+  8025cc:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8025d3:	00 00 00 
+  8025d6:	8b 38                	mov    (%rax),%edi
+  8025d8:	48 b8 d0 38 80 00 00 	movabs $0x8038d0,%rax
+  8025df:	00 00 00 
+  8025e2:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8025e4:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8025eb:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8025ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025f1:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8025f5:	48 89 de             	mov    %rbx,%rsi
+  8025f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025fd:	48 b8 3b 38 80 00 00 	movabs $0x80383b,%rax
+  802604:	00 00 00 
+  802607:	ff d0                	call   *%rax
+}
+  802609:	48 83 c4 10          	add    $0x10,%rsp
+  80260d:	5b                   	pop    %rbx
+  80260e:	41 5c                	pop    %r12
+  802610:	5d                   	pop    %rbp
+  802611:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802612:	bf 03 00 00 00       	mov    $0x3,%edi
+  802617:	48 b8 70 39 80 00 00 	movabs $0x803970,%rax
+  80261e:	00 00 00 
+  802621:	ff d0                	call   *%rax
+  802623:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  80262a:	00 00 
+  80262c:	eb 86                	jmp    8025b4 <fsipc+0x20>
+
+000000000080262e <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80262e:	55                   	push   %rbp
+  80262f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802632:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802639:	00 00 00 
+  80263c:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80263f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802641:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802644:	be 00 00 00 00       	mov    $0x0,%esi
+  802649:	bf 02 00 00 00       	mov    $0x2,%edi
+  80264e:	48 b8 94 25 80 00 00 	movabs $0x802594,%rax
+  802655:	00 00 00 
+  802658:	ff d0                	call   *%rax
+}
+  80265a:	5d                   	pop    %rbp
+  80265b:	c3                   	ret
+
+000000000080265c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80265c:	55                   	push   %rbp
+  80265d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802660:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802663:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80266a:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80266c:	be 00 00 00 00       	mov    $0x0,%esi
+  802671:	bf 06 00 00 00       	mov    $0x6,%edi
+  802676:	48 b8 94 25 80 00 00 	movabs $0x802594,%rax
+  80267d:	00 00 00 
+  802680:	ff d0                	call   *%rax
+}
+  802682:	5d                   	pop    %rbp
+  802683:	c3                   	ret
+
+0000000000802684 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802684:	55                   	push   %rbp
+  802685:	48 89 e5             	mov    %rsp,%rbp
+  802688:	41 54                	push   %r12
+  80268a:	53                   	push   %rbx
+  80268b:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80268e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802691:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802698:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80269a:	be 00 00 00 00       	mov    $0x0,%esi
+  80269f:	bf 05 00 00 00       	mov    $0x5,%edi
+  8026a4:	48 b8 94 25 80 00 00 	movabs $0x802594,%rax
+  8026ab:	00 00 00 
+  8026ae:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026b0:	85 c0                	test   %eax,%eax
+  8026b2:	78 3d                	js     8026f1 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8026b4:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8026bb:	00 00 00 
+  8026be:	4c 89 e6             	mov    %r12,%rsi
+  8026c1:	48 89 df             	mov    %rbx,%rdi
+  8026c4:	48 b8 47 12 80 00 00 	movabs $0x801247,%rax
+  8026cb:	00 00 00 
+  8026ce:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8026d0:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8026d7:	00 
+  8026d8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8026de:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8026e5:	00 
+  8026e6:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8026ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026f1:	5b                   	pop    %rbx
+  8026f2:	41 5c                	pop    %r12
+  8026f4:	5d                   	pop    %rbp
+  8026f5:	c3                   	ret
+
+00000000008026f6 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8026f6:	55                   	push   %rbp
+  8026f7:	48 89 e5             	mov    %rsp,%rbp
+  8026fa:	41 54                	push   %r12
+  8026fc:	53                   	push   %rbx
+  8026fd:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  802700:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802705:	48 39 c2             	cmp    %rax,%rdx
+  802708:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80270c:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80270f:	48 89 c2             	mov    %rax,%rdx
+  802712:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802719:	00 00 00 
+  80271c:	48 b8 a8 14 80 00 00 	movabs $0x8014a8,%rax
+  802723:	00 00 00 
+  802726:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802728:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80272f:	00 00 00 
+  802732:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802737:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802739:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  80273d:	be 00 00 00 00       	mov    $0x0,%esi
+  802742:	bf 04 00 00 00       	mov    $0x4,%edi
+  802747:	48 b8 94 25 80 00 00 	movabs $0x802594,%rax
+  80274e:	00 00 00 
+  802751:	ff d0                	call   *%rax
+  802753:	48 98                	cltq
+}
+  802755:	5b                   	pop    %rbx
+  802756:	41 5c                	pop    %r12
+  802758:	5d                   	pop    %rbp
+  802759:	c3                   	ret
+
+000000000080275a <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80275a:	55                   	push   %rbp
+  80275b:	48 89 e5             	mov    %rsp,%rbp
+  80275e:	41 54                	push   %r12
+  802760:	53                   	push   %rbx
+  802761:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802764:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80276b:	00 00 00 
+  80276e:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802771:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  802773:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802778:	48 39 ca             	cmp    %rcx,%rdx
+  80277b:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  80277f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  802783:	be 00 00 00 00       	mov    $0x0,%esi
+  802788:	bf 03 00 00 00       	mov    $0x3,%edi
+  80278d:	48 b8 94 25 80 00 00 	movabs $0x802594,%rax
+  802794:	00 00 00 
+  802797:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802799:	85 c0                	test   %eax,%eax
+  80279b:	78 27                	js     8027c4 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  80279d:	48 63 d8             	movslq %eax,%rbx
+  8027a0:	48 89 da             	mov    %rbx,%rdx
+  8027a3:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  8027aa:	00 00 00 
+  8027ad:	4c 89 e7             	mov    %r12,%rdi
+  8027b0:	48 b8 a8 14 80 00 00 	movabs $0x8014a8,%rax
+  8027b7:	00 00 00 
+  8027ba:	ff d0                	call   *%rax
+    return bytes_read;
+  8027bc:	48 89 d8             	mov    %rbx,%rax
+}
+  8027bf:	5b                   	pop    %rbx
+  8027c0:	41 5c                	pop    %r12
+  8027c2:	5d                   	pop    %rbp
+  8027c3:	c3                   	ret
+        return bytes_read;
+  8027c4:	48 98                	cltq
+  8027c6:	eb f7                	jmp    8027bf <devfile_read+0x65>
+
+00000000008027c8 <open>:
+open(const char *path, int mode) {
+  8027c8:	55                   	push   %rbp
+  8027c9:	48 89 e5             	mov    %rsp,%rbp
+  8027cc:	41 55                	push   %r13
+  8027ce:	41 54                	push   %r12
+  8027d0:	53                   	push   %rbx
+  8027d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8027d5:	49 89 fc             	mov    %rdi,%r12
+  8027d8:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8027db:	48 b8 09 12 80 00 00 	movabs $0x801209,%rax
+  8027e2:	00 00 00 
+  8027e5:	ff d0                	call   *%rax
+  8027e7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8027ed:	0f 87 8a 00 00 00    	ja     80287d <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8027f3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8027f7:	48 b8 c7 1e 80 00 00 	movabs $0x801ec7,%rax
+  8027fe:	00 00 00 
+  802801:	ff d0                	call   *%rax
+  802803:	89 c3                	mov    %eax,%ebx
+  802805:	85 c0                	test   %eax,%eax
+  802807:	78 50                	js     802859 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802809:	4c 89 e6             	mov    %r12,%rsi
+  80280c:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802813:	00 00 00 
+  802816:	48 89 df             	mov    %rbx,%rdi
+  802819:	48 b8 47 12 80 00 00 	movabs $0x801247,%rax
+  802820:	00 00 00 
+  802823:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802825:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80282c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802830:	bf 01 00 00 00       	mov    $0x1,%edi
+  802835:	48 b8 94 25 80 00 00 	movabs $0x802594,%rax
+  80283c:	00 00 00 
+  80283f:	ff d0                	call   *%rax
+  802841:	89 c3                	mov    %eax,%ebx
+  802843:	85 c0                	test   %eax,%eax
+  802845:	78 1f                	js     802866 <open+0x9e>
+    return fd2num(fd);
+  802847:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80284b:	48 b8 99 1e 80 00 00 	movabs $0x801e99,%rax
+  802852:	00 00 00 
+  802855:	ff d0                	call   *%rax
+  802857:	89 c3                	mov    %eax,%ebx
+}
+  802859:	89 d8                	mov    %ebx,%eax
+  80285b:	48 83 c4 18          	add    $0x18,%rsp
+  80285f:	5b                   	pop    %rbx
+  802860:	41 5c                	pop    %r12
+  802862:	41 5d                	pop    %r13
+  802864:	5d                   	pop    %rbp
+  802865:	c3                   	ret
+        fd_close(fd, 0);
+  802866:	be 00 00 00 00       	mov    $0x0,%esi
+  80286b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80286f:	48 b8 e2 1f 80 00 00 	movabs $0x801fe2,%rax
+  802876:	00 00 00 
+  802879:	ff d0                	call   *%rax
+        return res;
+  80287b:	eb dc                	jmp    802859 <open+0x91>
+        return -E_BAD_PATH;
+  80287d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802882:	eb d5                	jmp    802859 <open+0x91>
+
+0000000000802884 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802884:	55                   	push   %rbp
+  802885:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802888:	be 00 00 00 00       	mov    $0x0,%esi
+  80288d:	bf 08 00 00 00       	mov    $0x8,%edi
+  802892:	48 b8 94 25 80 00 00 	movabs $0x802594,%rax
+  802899:	00 00 00 
+  80289c:	ff d0                	call   *%rax
+}
+  80289e:	5d                   	pop    %rbp
+  80289f:	c3                   	ret
+
+00000000008028a0 <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  8028a0:	55                   	push   %rbp
+  8028a1:	48 89 e5             	mov    %rsp,%rbp
+  8028a4:	41 55                	push   %r13
+  8028a6:	41 54                	push   %r12
+  8028a8:	53                   	push   %rbx
+  8028a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8028ad:	48 89 fb             	mov    %rdi,%rbx
+  8028b0:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  8028b3:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  8028b6:	48 b8 3f 37 80 00 00 	movabs $0x80373f,%rax
+  8028bd:	00 00 00 
+  8028c0:	ff d0                	call   *%rax
+  8028c2:	41 89 c1             	mov    %eax,%r9d
+  8028c5:	4d 89 e0             	mov    %r12,%r8
+  8028c8:	49 29 d8             	sub    %rbx,%r8
+  8028cb:	48 89 d9             	mov    %rbx,%rcx
+  8028ce:	44 89 ea             	mov    %r13d,%edx
+  8028d1:	48 89 de             	mov    %rbx,%rsi
+  8028d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028d9:	48 b8 5e 18 80 00 00 	movabs $0x80185e,%rax
+  8028e0:	00 00 00 
+  8028e3:	ff d0                	call   *%rax
+}
+  8028e5:	48 83 c4 08          	add    $0x8,%rsp
+  8028e9:	5b                   	pop    %rbx
+  8028ea:	41 5c                	pop    %r12
+  8028ec:	41 5d                	pop    %r13
+  8028ee:	5d                   	pop    %rbp
+  8028ef:	c3                   	ret
+
+00000000008028f0 <spawn>:
+spawn(const char *prog, const char **argv) {
+  8028f0:	55                   	push   %rbp
+  8028f1:	48 89 e5             	mov    %rsp,%rbp
+  8028f4:	41 57                	push   %r15
+  8028f6:	41 56                	push   %r14
+  8028f8:	41 55                	push   %r13
+  8028fa:	41 54                	push   %r12
+  8028fc:	53                   	push   %rbx
+  8028fd:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  802904:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  802907:	be 00 00 00 00       	mov    $0x0,%esi
+  80290c:	48 b8 c8 27 80 00 00 	movabs $0x8027c8,%rax
+  802913:	00 00 00 
+  802916:	ff d0                	call   *%rax
+  802918:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+    if (fd < 0) return fd;
+  80291e:	85 c0                	test   %eax,%eax
+  802920:	0f 88 51 06 00 00    	js     802f77 <spawn+0x687>
+  802926:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  802928:	ba 00 02 00 00       	mov    $0x200,%edx
+  80292d:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  802934:	48 b8 c8 22 80 00 00 	movabs $0x8022c8,%rax
+  80293b:	00 00 00 
+  80293e:	ff d0                	call   *%rax
+  802940:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  802942:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802947:	0f 85 76 02 00 00    	jne    802bc3 <spawn+0x2d3>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  80294d:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  802954:	ff ff 00 
+  802957:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  80295e:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  802965:	01 01 00 
+  802968:	48 39 d0             	cmp    %rdx,%rax
+  80296b:	0f 85 8e 02 00 00    	jne    802bff <spawn+0x30f>
+        elf->e_type != ET_EXEC /* executable */ ||
+  802971:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  802978:	00 3e 00 
+  80297b:	0f 85 7e 02 00 00    	jne    802bff <spawn+0x30f>
+  802981:	b8 08 00 00 00       	mov    $0x8,%eax
+  802986:	cd 30                	int    $0x30
+  802988:	41 89 c6             	mov    %eax,%r14d
+  80298b:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  80298d:	85 c0                	test   %eax,%eax
+  80298f:	0f 88 ca 05 00 00    	js     802f5f <spawn+0x66f>
+    envid_t child = res;
+  802995:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  80299b:	0f b6 c0             	movzbl %al,%eax
+  80299e:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8029a5:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  8029ac:	00 00 00 
+  8029af:	48 01 c6             	add    %rax,%rsi
+  8029b2:	48 8b 06             	mov    (%rsi),%rax
+  8029b5:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  8029bc:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  8029c3:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  8029ca:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  8029d1:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  8029d8:	48 29 ce             	sub    %rcx,%rsi
+  8029db:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  8029e1:	c1 e9 03             	shr    $0x3,%ecx
+  8029e4:	89 c9                	mov    %ecx,%ecx
+  8029e6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  8029e9:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  8029f0:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  8029f7:	49 8b 3c 24          	mov    (%r12),%rdi
+  8029fb:	48 85 ff             	test   %rdi,%rdi
+  8029fe:	0f 84 8b 05 00 00    	je     802f8f <spawn+0x69f>
+  802a04:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  802a0a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  802a10:	48 bb 09 12 80 00 00 	movabs $0x801209,%rbx
+  802a17:	00 00 00 
+  802a1a:	ff d3                	call   *%rbx
+  802a1c:	4c 01 f8             	add    %r15,%rax
+  802a1f:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  802a23:	4c 89 ea             	mov    %r13,%rdx
+  802a26:	49 83 c5 01          	add    $0x1,%r13
+  802a2a:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  802a2f:	48 85 ff             	test   %rdi,%rdi
+  802a32:	75 e6                	jne    802a1a <spawn+0x12a>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  802a34:	49 89 d5             	mov    %rdx,%r13
+  802a37:	48 89 95 e0 fc ff ff 	mov    %rdx,-0x320(%rbp)
+  802a3e:	48 f7 d0             	not    %rax
+  802a41:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  802a48:	49 89 df             	mov    %rbx,%r15
+  802a4b:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  802a4f:	4c 89 bd f0 fc ff ff 	mov    %r15,-0x310(%rbp)
+  802a56:	89 d0                	mov    %edx,%eax
+  802a58:	83 c0 01             	add    $0x1,%eax
+  802a5b:	48 98                	cltq
+  802a5d:	48 c1 e0 03          	shl    $0x3,%rax
+  802a61:	49 29 c7             	sub    %rax,%r15
+  802a64:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  802a6b:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  802a6f:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  802a75:	0f 86 cb 04 00 00    	jbe    802f46 <spawn+0x656>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  802a7b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a80:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802a85:	be 00 00 40 00       	mov    $0x400000,%esi
+  802a8a:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  802a91:	00 00 00 
+  802a94:	ff d0                	call   *%rax
+  802a96:	85 c0                	test   %eax,%eax
+  802a98:	0f 88 ad 04 00 00    	js     802f4b <spawn+0x65b>
+    for (i = 0; i < argc; i++) {
+  802a9e:	4c 89 e8             	mov    %r13,%rax
+  802aa1:	45 85 ed             	test   %r13d,%r13d
+  802aa4:	7e 54                	jle    802afa <spawn+0x20a>
+  802aa6:	4d 89 fd             	mov    %r15,%r13
+  802aa9:	48 98                	cltq
+  802aab:	4d 8d 3c c7          	lea    (%r15,%rax,8),%r15
+        argv_store[i] = UTEMP2USTACK(string_store);
+  802aaf:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  802ab6:	00 00 00 
+  802ab9:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  802ac0:	ff 
+  802ac1:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  802ac5:	49 8b 34 24          	mov    (%r12),%rsi
+  802ac9:	48 89 df             	mov    %rbx,%rdi
+  802acc:	48 b8 47 12 80 00 00 	movabs $0x801247,%rax
+  802ad3:	00 00 00 
+  802ad6:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  802ad8:	49 8b 3c 24          	mov    (%r12),%rdi
+  802adc:	48 b8 09 12 80 00 00 	movabs $0x801209,%rax
+  802ae3:	00 00 00 
+  802ae6:	ff d0                	call   *%rax
+  802ae8:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  802aed:	49 83 c5 08          	add    $0x8,%r13
+  802af1:	49 83 c4 08          	add    $0x8,%r12
+  802af5:	4d 39 fd             	cmp    %r15,%r13
+  802af8:	75 b5                	jne    802aaf <spawn+0x1bf>
+    argv_store[argc] = 0;
+  802afa:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  802b01:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  802b08:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  802b09:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  802b10:	0f 85 30 01 00 00    	jne    802c46 <spawn+0x356>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  802b16:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  802b1d:	00 00 00 
+  802b20:	48 8b 9d e8 fc ff ff 	mov    -0x318(%rbp),%rbx
+  802b27:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  802b2e:	ff 
+  802b2f:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  802b33:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  802b3a:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  802b3e:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  802b45:	00 00 00 
+  802b48:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  802b4f:	ff 
+  802b50:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  802b57:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  802b5d:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  802b63:	44 89 f2             	mov    %r14d,%edx
+  802b66:	be 00 00 40 00       	mov    $0x400000,%esi
+  802b6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b70:	48 b8 5e 18 80 00 00 	movabs $0x80185e,%rax
+  802b77:	00 00 00 
+  802b7a:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  802b7c:	48 bb c3 18 80 00 00 	movabs $0x8018c3,%rbx
+  802b83:	00 00 00 
+  802b86:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802b8b:	be 00 00 40 00       	mov    $0x400000,%esi
+  802b90:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b95:	ff d3                	call   *%rbx
+  802b97:	85 c0                	test   %eax,%eax
+  802b99:	78 eb                	js     802b86 <spawn+0x296>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  802b9b:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  802ba2:	4c 8d a4 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r12
+  802ba9:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802baa:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  802bb1:	00 
+  802bb2:	0f 84 87 02 00 00    	je     802e3f <spawn+0x54f>
+  802bb8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  802bbe:	e9 fe 00 00 00       	jmp    802cc1 <spawn+0x3d1>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  802bc3:	48 bf a0 41 80 00 00 	movabs $0x8041a0,%rdi
+  802bca:	00 00 00 
+  802bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd2:	48 ba 22 09 80 00 00 	movabs $0x800922,%rdx
+  802bd9:	00 00 00 
+  802bdc:	ff d2                	call   *%rdx
+        close(fd);
+  802bde:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802be4:	48 b8 8c 20 80 00 00 	movabs $0x80208c,%rax
+  802beb:	00 00 00 
+  802bee:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  802bf0:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  802bf7:	ff ff ff 
+  802bfa:	e9 78 03 00 00       	jmp    802f77 <spawn+0x687>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802bff:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  802c04:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  802c0a:	48 bf 00 42 80 00 00 	movabs $0x804200,%rdi
+  802c11:	00 00 00 
+  802c14:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c19:	48 b9 22 09 80 00 00 	movabs $0x800922,%rcx
+  802c20:	00 00 00 
+  802c23:	ff d1                	call   *%rcx
+        close(fd);
+  802c25:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802c2b:	48 b8 8c 20 80 00 00 	movabs $0x80208c,%rax
+  802c32:	00 00 00 
+  802c35:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  802c37:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  802c3e:	ff ff ff 
+  802c41:	e9 31 03 00 00       	jmp    802f77 <spawn+0x687>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  802c46:	48 b9 d0 41 80 00 00 	movabs $0x8041d0,%rcx
+  802c4d:	00 00 00 
+  802c50:	48 ba 1a 42 80 00 00 	movabs $0x80421a,%rdx
+  802c57:	00 00 00 
+  802c5a:	be f0 00 00 00       	mov    $0xf0,%esi
+  802c5f:	48 bf 2f 42 80 00 00 	movabs $0x80422f,%rdi
+  802c66:	00 00 00 
+  802c69:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c6e:	49 b8 d2 07 80 00 00 	movabs $0x8007d2,%r8
+  802c75:	00 00 00 
+  802c78:	41 ff d0             	call   *%r8
+        if (err)
+            return err;
+    }
+
+    /* Allocate filesz in parent to UTEMP */
+    int err = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
+  802c7b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c80:	4c 89 ea             	mov    %r13,%rdx
+  802c83:	be 00 00 40 00       	mov    $0x400000,%esi
+  802c88:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c8d:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  802c94:	00 00 00 
+  802c97:	ff d0                	call   *%rax
+    if (err)
+  802c99:	85 c0                	test   %eax,%eax
+  802c9b:	0f 84 d2 00 00 00    	je     802d73 <spawn+0x483>
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  802ca1:	85 c0                	test   %eax,%eax
+  802ca3:	0f 88 99 02 00 00    	js     802f42 <spawn+0x652>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802ca9:	49 83 c7 01          	add    $0x1,%r15
+  802cad:	49 83 c4 38          	add    $0x38,%r12
+  802cb1:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  802cb8:	49 39 c7             	cmp    %rax,%r15
+  802cbb:	0f 83 7e 01 00 00    	jae    802e3f <spawn+0x54f>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  802cc1:	41 83 3c 24 01       	cmpl   $0x1,(%r12)
+  802cc6:	75 e1                	jne    802ca9 <spawn+0x3b9>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  802cc8:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802ccd:	41 89 c6             	mov    %eax,%r14d
+  802cd0:	41 83 e6 02          	and    $0x2,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  802cd4:	44 89 f2             	mov    %r14d,%edx
+  802cd7:	83 ca 04             	or     $0x4,%edx
+  802cda:	a8 04                	test   $0x4,%al
+  802cdc:	44 0f 45 f2          	cmovne %edx,%r14d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  802ce0:	44 89 f2             	mov    %r14d,%edx
+  802ce3:	83 ca 01             	or     $0x1,%edx
+  802ce6:	a8 01                	test   $0x1,%al
+  802ce8:	44 0f 45 f2          	cmovne %edx,%r14d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  802cec:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  802cf1:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  802cf7:	4d 8b 6c 24 20       	mov    0x20(%r12),%r13
+  802cfc:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  802d01:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  802d06:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  802d0c:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  802d12:	89 d9                	mov    %ebx,%ecx
+  802d14:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802d1a:	74 14                	je     802d30 <spawn+0x440>
+        va -= res;
+  802d1c:	48 63 f1             	movslq %ecx,%rsi
+  802d1f:	48 29 f3             	sub    %rsi,%rbx
+        memsz += res;
+  802d22:	48 01 f2             	add    %rsi,%rdx
+        filesz += res;
+  802d25:	49 01 f5             	add    %rsi,%r13
+        fileoffset -= res;
+  802d28:	29 c8                	sub    %ecx,%eax
+  802d2a:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    filesz = ROUNDUP(filesz, PAGE_SIZE);
+  802d30:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802d37:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    if (filesz < memsz) {
+  802d3e:	49 39 d5             	cmp    %rdx,%r13
+  802d41:	0f 83 34 ff ff ff    	jae    802c7b <spawn+0x38b>
+        int err = sys_alloc_region(child, (void *)va + filesz, memsz - filesz, PROT_RW);
+  802d47:	4c 29 ea             	sub    %r13,%rdx
+  802d4a:	49 8d 74 1d 00       	lea    0x0(%r13,%rbx,1),%rsi
+  802d4f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802d54:	8b bd e8 fc ff ff    	mov    -0x318(%rbp),%edi
+  802d5a:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  802d61:	00 00 00 
+  802d64:	ff d0                	call   *%rax
+        if (err)
+  802d66:	85 c0                	test   %eax,%eax
+  802d68:	0f 84 0d ff ff ff    	je     802c7b <spawn+0x38b>
+  802d6e:	e9 2e ff ff ff       	jmp    802ca1 <spawn+0x3b1>
+        return err;
+
+    /* seek() fd to fileoffset  */
+    err = seek(fd, fileoffset);
+  802d73:	8b b5 f0 fc ff ff    	mov    -0x310(%rbp),%esi
+  802d79:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802d7f:	48 b8 f2 23 80 00 00 	movabs $0x8023f2,%rax
+  802d86:	00 00 00 
+  802d89:	ff d0                	call   *%rax
+    if (err)
+  802d8b:	85 c0                	test   %eax,%eax
+  802d8d:	0f 85 0e ff ff ff    	jne    802ca1 <spawn+0x3b1>
+        return err;
+
+    /* read filesz to UTEMP */
+    ssize_t bytes_read = readn(fd, UTEMP, filesz);
+  802d93:	4c 89 ea             	mov    %r13,%rdx
+  802d96:	be 00 00 40 00       	mov    $0x400000,%esi
+  802d9b:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802da1:	48 b8 c8 22 80 00 00 	movabs $0x8022c8,%rax
+  802da8:	00 00 00 
+  802dab:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  802dad:	48 85 c0             	test   %rax,%rax
+  802db0:	0f 88 eb fe ff ff    	js     802ca1 <spawn+0x3b1>
+        return bytes_read;
+    assert(bytes_read == filesz);
+  802db6:	4c 39 e8             	cmp    %r13,%rax
+  802db9:	75 4f                	jne    802e0a <spawn+0x51a>
+
+    /* Map read section conents to child */
+    err = sys_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+  802dbb:	45 89 f1             	mov    %r14d,%r9d
+  802dbe:	41 80 c9 80          	or     $0x80,%r9b
+  802dc2:	4d 89 e8             	mov    %r13,%r8
+  802dc5:	48 89 d9             	mov    %rbx,%rcx
+  802dc8:	8b 95 e8 fc ff ff    	mov    -0x318(%rbp),%edx
+  802dce:	be 00 00 40 00       	mov    $0x400000,%esi
+  802dd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dd8:	48 b8 5e 18 80 00 00 	movabs $0x80185e,%rax
+  802ddf:	00 00 00 
+  802de2:	ff d0                	call   *%rax
+    if (err)
+  802de4:	85 c0                	test   %eax,%eax
+  802de6:	0f 85 b5 fe ff ff    	jne    802ca1 <spawn+0x3b1>
+        return err;
+
+    /* Unmap it from parent */
+    err = sys_unmap_region(CURENVID, UTEMP, filesz);
+  802dec:	4c 89 ea             	mov    %r13,%rdx
+  802def:	be 00 00 40 00       	mov    $0x400000,%esi
+  802df4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802df9:	48 b8 c3 18 80 00 00 	movabs $0x8018c3,%rax
+  802e00:	00 00 00 
+  802e03:	ff d0                	call   *%rax
+    if (err)
+  802e05:	e9 97 fe ff ff       	jmp    802ca1 <spawn+0x3b1>
+    assert(bytes_read == filesz);
+  802e0a:	48 b9 3b 42 80 00 00 	movabs $0x80423b,%rcx
+  802e11:	00 00 00 
+  802e14:	48 ba 1a 42 80 00 00 	movabs $0x80421a,%rdx
+  802e1b:	00 00 00 
+  802e1e:	be 2f 01 00 00       	mov    $0x12f,%esi
+  802e23:	48 bf 2f 42 80 00 00 	movabs $0x80422f,%rdi
+  802e2a:	00 00 00 
+  802e2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e32:	49 b8 d2 07 80 00 00 	movabs $0x8007d2,%r8
+  802e39:	00 00 00 
+  802e3c:	41 ff d0             	call   *%r8
+    close(fd);
+  802e3f:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802e45:	48 b8 8c 20 80 00 00 	movabs $0x80208c,%rax
+  802e4c:	00 00 00 
+  802e4f:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  802e51:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  802e58:	48 bf a0 28 80 00 00 	movabs $0x8028a0,%rdi
+  802e5f:	00 00 00 
+  802e62:	48 b8 b3 37 80 00 00 	movabs $0x8037b3,%rax
+  802e69:	00 00 00 
+  802e6c:	ff d0                	call   *%rax
+  802e6e:	85 c0                	test   %eax,%eax
+  802e70:	78 49                	js     802ebb <spawn+0x5cb>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802e72:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  802e79:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802e7f:	48 b8 63 1a 80 00 00 	movabs $0x801a63,%rax
+  802e86:	00 00 00 
+  802e89:	ff d0                	call   *%rax
+  802e8b:	85 c0                	test   %eax,%eax
+  802e8d:	78 59                	js     802ee8 <spawn+0x5f8>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802e8f:	be 02 00 00 00       	mov    $0x2,%esi
+  802e94:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802e9a:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  802ea1:	00 00 00 
+  802ea4:	ff d0                	call   *%rax
+  802ea6:	85 c0                	test   %eax,%eax
+  802ea8:	78 6b                	js     802f15 <spawn+0x625>
+    return child;
+  802eaa:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  802eb0:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+  802eb6:	e9 bc 00 00 00       	jmp    802f77 <spawn+0x687>
+        panic("copy_shared_region: %i", res);
+  802ebb:	89 c1                	mov    %eax,%ecx
+  802ebd:	48 ba 50 42 80 00 00 	movabs $0x804250,%rdx
+  802ec4:	00 00 00 
+  802ec7:	be 84 00 00 00       	mov    $0x84,%esi
+  802ecc:	48 bf 2f 42 80 00 00 	movabs $0x80422f,%rdi
+  802ed3:	00 00 00 
+  802ed6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802edb:	49 b8 d2 07 80 00 00 	movabs $0x8007d2,%r8
+  802ee2:	00 00 00 
+  802ee5:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  802ee8:	89 c1                	mov    %eax,%ecx
+  802eea:	48 ba 67 42 80 00 00 	movabs $0x804267,%rdx
+  802ef1:	00 00 00 
+  802ef4:	be 87 00 00 00       	mov    $0x87,%esi
+  802ef9:	48 bf 2f 42 80 00 00 	movabs $0x80422f,%rdi
+  802f00:	00 00 00 
+  802f03:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f08:	49 b8 d2 07 80 00 00 	movabs $0x8007d2,%r8
+  802f0f:	00 00 00 
+  802f12:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  802f15:	89 c1                	mov    %eax,%ecx
+  802f17:	48 ba 81 42 80 00 00 	movabs $0x804281,%rdx
+  802f1e:	00 00 00 
+  802f21:	be 8a 00 00 00       	mov    $0x8a,%esi
+  802f26:	48 bf 2f 42 80 00 00 	movabs $0x80422f,%rdi
+  802f2d:	00 00 00 
+  802f30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f35:	49 b8 d2 07 80 00 00 	movabs $0x8007d2,%r8
+  802f3c:	00 00 00 
+  802f3f:	41 ff d0             	call   *%r8
+  802f42:	89 c3                	mov    %eax,%ebx
+  802f44:	eb 07                	jmp    802f4d <spawn+0x65d>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  802f46:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802f4b:	89 c3                	mov    %eax,%ebx
+    sys_env_destroy(child);
+  802f4d:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802f53:	48 b8 cc 16 80 00 00 	movabs $0x8016cc,%rax
+  802f5a:	00 00 00 
+  802f5d:	ff d0                	call   *%rax
+    close(fd);
+  802f5f:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802f65:	48 b8 8c 20 80 00 00 	movabs $0x80208c,%rax
+  802f6c:	00 00 00 
+  802f6f:	ff d0                	call   *%rax
+    return res;
+  802f71:	89 9d fc fc ff ff    	mov    %ebx,-0x304(%rbp)
+}
+  802f77:	8b 85 fc fc ff ff    	mov    -0x304(%rbp),%eax
+  802f7d:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  802f84:	5b                   	pop    %rbx
+  802f85:	41 5c                	pop    %r12
+  802f87:	41 5d                	pop    %r13
+  802f89:	41 5e                	pop    %r14
+  802f8b:	41 5f                	pop    %r15
+  802f8d:	5d                   	pop    %rbp
+  802f8e:	c3                   	ret
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  802f8f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802f94:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802f99:	be 00 00 40 00       	mov    $0x400000,%esi
+  802f9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fa3:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  802faa:	00 00 00 
+  802fad:	ff d0                	call   *%rax
+  802faf:	85 c0                	test   %eax,%eax
+  802fb1:	78 98                	js     802f4b <spawn+0x65b>
+    for (argc = 0; argv[argc] != 0; argc++)
+  802fb3:	48 c7 85 e0 fc ff ff 	movq   $0x0,-0x320(%rbp)
+  802fba:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  802fbe:	48 c7 85 e8 fc ff ff 	movq   $0x40fff8,-0x318(%rbp)
+  802fc5:	f8 ff 40 00 
+  802fc9:	48 c7 85 f0 fc ff ff 	movq   $0x410000,-0x310(%rbp)
+  802fd0:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  802fd4:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  802fd9:	e9 1c fb ff ff       	jmp    802afa <spawn+0x20a>
+
+0000000000802fde <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  802fde:	55                   	push   %rbp
+  802fdf:	48 89 e5             	mov    %rsp,%rbp
+  802fe2:	48 83 ec 50          	sub    $0x50,%rsp
+  802fe6:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802fea:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802fee:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802ff2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  802ff6:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802ffd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803001:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803005:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803009:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  80300d:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  803012:	eb 15                	jmp    803029 <spawnl+0x4b>
+  803014:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803018:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80301c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803020:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803024:	74 1c                	je     803042 <spawnl+0x64>
+  803026:	83 c1 01             	add    $0x1,%ecx
+  803029:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80302c:	83 f8 2f             	cmp    $0x2f,%eax
+  80302f:	77 e3                	ja     803014 <spawnl+0x36>
+  803031:	89 c2                	mov    %eax,%edx
+  803033:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  803037:	4c 01 d2             	add    %r10,%rdx
+  80303a:	83 c0 08             	add    $0x8,%eax
+  80303d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803040:	eb de                	jmp    803020 <spawnl+0x42>
+    const char *argv[argc + 2];
+  803042:	8d 41 02             	lea    0x2(%rcx),%eax
+  803045:	48 98                	cltq
+  803047:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  80304e:	00 
+  80304f:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  803053:	48 29 c4             	sub    %rax,%rsp
+  803056:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  80305b:	4c 89 c0             	mov    %r8,%rax
+  80305e:	48 c1 e8 03          	shr    $0x3,%rax
+  803062:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  803066:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  80306d:	00 
+    argv[argc + 1] = NULL;
+  80306e:	8d 41 01             	lea    0x1(%rcx),%eax
+  803071:	48 98                	cltq
+  803073:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  80307a:	00 
+    va_start(vl, arg0);
+  80307b:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803082:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803086:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80308a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80308e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  803092:	85 c9                	test   %ecx,%ecx
+  803094:	74 41                	je     8030d7 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803096:	49 89 c1             	mov    %rax,%r9
+  803099:	49 8d 40 08          	lea    0x8(%r8),%rax
+  80309d:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8030a0:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  8030a5:	eb 1b                	jmp    8030c2 <spawnl+0xe4>
+  8030a7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8030ab:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  8030af:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8030b3:	48 8b 11             	mov    (%rcx),%rdx
+  8030b6:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  8030b9:	48 83 c0 08          	add    $0x8,%rax
+  8030bd:	48 39 f0             	cmp    %rsi,%rax
+  8030c0:	74 15                	je     8030d7 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8030c2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8030c5:	83 fa 2f             	cmp    $0x2f,%edx
+  8030c8:	77 dd                	ja     8030a7 <spawnl+0xc9>
+  8030ca:	89 d1                	mov    %edx,%ecx
+  8030cc:	4c 01 c9             	add    %r9,%rcx
+  8030cf:	83 c2 08             	add    $0x8,%edx
+  8030d2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8030d5:	eb dc                	jmp    8030b3 <spawnl+0xd5>
+    return spawn(prog, argv);
+  8030d7:	4c 89 c6             	mov    %r8,%rsi
+  8030da:	48 b8 f0 28 80 00 00 	movabs $0x8028f0,%rax
+  8030e1:	00 00 00 
+  8030e4:	ff d0                	call   *%rax
+}
+  8030e6:	c9                   	leave
+  8030e7:	c3                   	ret
+
+00000000008030e8 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8030e8:	55                   	push   %rbp
+  8030e9:	48 89 e5             	mov    %rsp,%rbp
+  8030ec:	41 54                	push   %r12
+  8030ee:	53                   	push   %rbx
+  8030ef:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8030f2:	48 b8 ab 1e 80 00 00 	movabs $0x801eab,%rax
+  8030f9:	00 00 00 
+  8030fc:	ff d0                	call   *%rax
+  8030fe:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803101:	48 be 98 42 80 00 00 	movabs $0x804298,%rsi
+  803108:	00 00 00 
+  80310b:	48 89 df             	mov    %rbx,%rdi
+  80310e:	48 b8 47 12 80 00 00 	movabs $0x801247,%rax
+  803115:	00 00 00 
+  803118:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80311a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80311f:	41 2b 04 24          	sub    (%r12),%eax
+  803123:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803129:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803130:	00 00 00 
+    stat->st_dev = &devpipe;
+  803133:	48 b8 80 50 80 00 00 	movabs $0x805080,%rax
+  80313a:	00 00 00 
+  80313d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803144:	b8 00 00 00 00       	mov    $0x0,%eax
+  803149:	5b                   	pop    %rbx
+  80314a:	41 5c                	pop    %r12
+  80314c:	5d                   	pop    %rbp
+  80314d:	c3                   	ret
+
+000000000080314e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80314e:	55                   	push   %rbp
+  80314f:	48 89 e5             	mov    %rsp,%rbp
+  803152:	41 54                	push   %r12
+  803154:	53                   	push   %rbx
+  803155:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803158:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80315d:	48 89 fe             	mov    %rdi,%rsi
+  803160:	bf 00 00 00 00       	mov    $0x0,%edi
+  803165:	49 bc c3 18 80 00 00 	movabs $0x8018c3,%r12
+  80316c:	00 00 00 
+  80316f:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803172:	48 89 df             	mov    %rbx,%rdi
+  803175:	48 b8 ab 1e 80 00 00 	movabs $0x801eab,%rax
+  80317c:	00 00 00 
+  80317f:	ff d0                	call   *%rax
+  803181:	48 89 c6             	mov    %rax,%rsi
+  803184:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803189:	bf 00 00 00 00       	mov    $0x0,%edi
+  80318e:	41 ff d4             	call   *%r12
+}
+  803191:	5b                   	pop    %rbx
+  803192:	41 5c                	pop    %r12
+  803194:	5d                   	pop    %rbp
+  803195:	c3                   	ret
+
+0000000000803196 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803196:	55                   	push   %rbp
+  803197:	48 89 e5             	mov    %rsp,%rbp
+  80319a:	41 57                	push   %r15
+  80319c:	41 56                	push   %r14
+  80319e:	41 55                	push   %r13
+  8031a0:	41 54                	push   %r12
+  8031a2:	53                   	push   %rbx
+  8031a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8031a7:	49 89 fc             	mov    %rdi,%r12
+  8031aa:	49 89 f5             	mov    %rsi,%r13
+  8031ad:	49 89 d7             	mov    %rdx,%r15
+  8031b0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8031b4:	48 b8 ab 1e 80 00 00 	movabs $0x801eab,%rax
+  8031bb:	00 00 00 
+  8031be:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8031c0:	4d 85 ff             	test   %r15,%r15
+  8031c3:	0f 84 af 00 00 00    	je     803278 <devpipe_write+0xe2>
+  8031c9:	48 89 c3             	mov    %rax,%rbx
+  8031cc:	4c 89 f8             	mov    %r15,%rax
+  8031cf:	4d 89 ef             	mov    %r13,%r15
+  8031d2:	4c 01 e8             	add    %r13,%rax
+  8031d5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8031d9:	49 bd cb 17 80 00 00 	movabs $0x8017cb,%r13
+  8031e0:	00 00 00 
+            sys_yield();
+  8031e3:	49 be 68 17 80 00 00 	movabs $0x801768,%r14
+  8031ea:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8031ed:	8b 73 04             	mov    0x4(%rbx),%esi
+  8031f0:	48 63 ce             	movslq %esi,%rcx
+  8031f3:	48 63 03             	movslq (%rbx),%rax
+  8031f6:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8031fc:	48 39 c1             	cmp    %rax,%rcx
+  8031ff:	72 2e                	jb     80322f <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803201:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803206:	48 89 da             	mov    %rbx,%rdx
+  803209:	be 00 10 00 00       	mov    $0x1000,%esi
+  80320e:	4c 89 e7             	mov    %r12,%rdi
+  803211:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803214:	85 c0                	test   %eax,%eax
+  803216:	74 66                	je     80327e <devpipe_write+0xe8>
+            sys_yield();
+  803218:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80321b:	8b 73 04             	mov    0x4(%rbx),%esi
+  80321e:	48 63 ce             	movslq %esi,%rcx
+  803221:	48 63 03             	movslq (%rbx),%rax
+  803224:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80322a:	48 39 c1             	cmp    %rax,%rcx
+  80322d:	73 d2                	jae    803201 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80322f:	41 0f b6 3f          	movzbl (%r15),%edi
+  803233:	48 89 ca             	mov    %rcx,%rdx
+  803236:	48 c1 ea 03          	shr    $0x3,%rdx
+  80323a:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803241:	08 10 20 
+  803244:	48 f7 e2             	mul    %rdx
+  803247:	48 c1 ea 06          	shr    $0x6,%rdx
+  80324b:	48 89 d0             	mov    %rdx,%rax
+  80324e:	48 c1 e0 09          	shl    $0x9,%rax
+  803252:	48 29 d0             	sub    %rdx,%rax
+  803255:	48 c1 e0 03          	shl    $0x3,%rax
+  803259:	48 29 c1             	sub    %rax,%rcx
+  80325c:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803261:	83 c6 01             	add    $0x1,%esi
+  803264:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803267:	49 83 c7 01          	add    $0x1,%r15
+  80326b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80326f:	49 39 c7             	cmp    %rax,%r15
+  803272:	0f 85 75 ff ff ff    	jne    8031ed <devpipe_write+0x57>
+    return n;
+  803278:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80327c:	eb 05                	jmp    803283 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80327e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803283:	48 83 c4 18          	add    $0x18,%rsp
+  803287:	5b                   	pop    %rbx
+  803288:	41 5c                	pop    %r12
+  80328a:	41 5d                	pop    %r13
+  80328c:	41 5e                	pop    %r14
+  80328e:	41 5f                	pop    %r15
+  803290:	5d                   	pop    %rbp
+  803291:	c3                   	ret
+
+0000000000803292 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803292:	55                   	push   %rbp
+  803293:	48 89 e5             	mov    %rsp,%rbp
+  803296:	41 57                	push   %r15
+  803298:	41 56                	push   %r14
+  80329a:	41 55                	push   %r13
+  80329c:	41 54                	push   %r12
+  80329e:	53                   	push   %rbx
+  80329f:	48 83 ec 18          	sub    $0x18,%rsp
+  8032a3:	49 89 fc             	mov    %rdi,%r12
+  8032a6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8032aa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8032ae:	48 b8 ab 1e 80 00 00 	movabs $0x801eab,%rax
+  8032b5:	00 00 00 
+  8032b8:	ff d0                	call   *%rax
+  8032ba:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8032bd:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8032c3:	49 bd cb 17 80 00 00 	movabs $0x8017cb,%r13
+  8032ca:	00 00 00 
+            sys_yield();
+  8032cd:	49 be 68 17 80 00 00 	movabs $0x801768,%r14
+  8032d4:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8032d7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8032dc:	74 7d                	je     80335b <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8032de:	8b 03                	mov    (%rbx),%eax
+  8032e0:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8032e3:	75 26                	jne    80330b <devpipe_read+0x79>
+            if (i > 0) return i;
+  8032e5:	4d 85 ff             	test   %r15,%r15
+  8032e8:	75 77                	jne    803361 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8032ea:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8032ef:	48 89 da             	mov    %rbx,%rdx
+  8032f2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8032f7:	4c 89 e7             	mov    %r12,%rdi
+  8032fa:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8032fd:	85 c0                	test   %eax,%eax
+  8032ff:	74 72                	je     803373 <devpipe_read+0xe1>
+            sys_yield();
+  803301:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803304:	8b 03                	mov    (%rbx),%eax
+  803306:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803309:	74 df                	je     8032ea <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80330b:	48 63 c8             	movslq %eax,%rcx
+  80330e:	48 89 ca             	mov    %rcx,%rdx
+  803311:	48 c1 ea 03          	shr    $0x3,%rdx
+  803315:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80331c:	08 10 20 
+  80331f:	48 89 d0             	mov    %rdx,%rax
+  803322:	48 f7 e6             	mul    %rsi
+  803325:	48 c1 ea 06          	shr    $0x6,%rdx
+  803329:	48 89 d0             	mov    %rdx,%rax
+  80332c:	48 c1 e0 09          	shl    $0x9,%rax
+  803330:	48 29 d0             	sub    %rdx,%rax
+  803333:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80333a:	00 
+  80333b:	48 89 c8             	mov    %rcx,%rax
+  80333e:	48 29 d0             	sub    %rdx,%rax
+  803341:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803346:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80334a:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80334e:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803351:	49 83 c7 01          	add    $0x1,%r15
+  803355:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803359:	75 83                	jne    8032de <devpipe_read+0x4c>
+    return n;
+  80335b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80335f:	eb 03                	jmp    803364 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803361:	4c 89 f8             	mov    %r15,%rax
+}
+  803364:	48 83 c4 18          	add    $0x18,%rsp
+  803368:	5b                   	pop    %rbx
+  803369:	41 5c                	pop    %r12
+  80336b:	41 5d                	pop    %r13
+  80336d:	41 5e                	pop    %r14
+  80336f:	41 5f                	pop    %r15
+  803371:	5d                   	pop    %rbp
+  803372:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803373:	b8 00 00 00 00       	mov    $0x0,%eax
+  803378:	eb ea                	jmp    803364 <devpipe_read+0xd2>
+
+000000000080337a <pipe>:
+pipe(int pfd[2]) {
+  80337a:	55                   	push   %rbp
+  80337b:	48 89 e5             	mov    %rsp,%rbp
+  80337e:	41 55                	push   %r13
+  803380:	41 54                	push   %r12
+  803382:	53                   	push   %rbx
+  803383:	48 83 ec 18          	sub    $0x18,%rsp
+  803387:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80338a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80338e:	48 b8 c7 1e 80 00 00 	movabs $0x801ec7,%rax
+  803395:	00 00 00 
+  803398:	ff d0                	call   *%rax
+  80339a:	89 c3                	mov    %eax,%ebx
+  80339c:	85 c0                	test   %eax,%eax
+  80339e:	0f 88 a0 01 00 00    	js     803544 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8033a4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8033a9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033ae:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8033b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033b7:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  8033be:	00 00 00 
+  8033c1:	ff d0                	call   *%rax
+  8033c3:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8033c5:	85 c0                	test   %eax,%eax
+  8033c7:	0f 88 77 01 00 00    	js     803544 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8033cd:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8033d1:	48 b8 c7 1e 80 00 00 	movabs $0x801ec7,%rax
+  8033d8:	00 00 00 
+  8033db:	ff d0                	call   *%rax
+  8033dd:	89 c3                	mov    %eax,%ebx
+  8033df:	85 c0                	test   %eax,%eax
+  8033e1:	0f 88 43 01 00 00    	js     80352a <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8033e7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8033ec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033f1:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8033f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033fa:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  803401:	00 00 00 
+  803404:	ff d0                	call   *%rax
+  803406:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803408:	85 c0                	test   %eax,%eax
+  80340a:	0f 88 1a 01 00 00    	js     80352a <pipe+0x1b0>
+    va = fd2data(fd0);
+  803410:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803414:	48 b8 ab 1e 80 00 00 	movabs $0x801eab,%rax
+  80341b:	00 00 00 
+  80341e:	ff d0                	call   *%rax
+  803420:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803423:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803428:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80342d:	48 89 c6             	mov    %rax,%rsi
+  803430:	bf 00 00 00 00       	mov    $0x0,%edi
+  803435:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  80343c:	00 00 00 
+  80343f:	ff d0                	call   *%rax
+  803441:	89 c3                	mov    %eax,%ebx
+  803443:	85 c0                	test   %eax,%eax
+  803445:	0f 88 c5 00 00 00    	js     803510 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80344b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80344f:	48 b8 ab 1e 80 00 00 	movabs $0x801eab,%rax
+  803456:	00 00 00 
+  803459:	ff d0                	call   *%rax
+  80345b:	48 89 c1             	mov    %rax,%rcx
+  80345e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803464:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80346a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80346f:	4c 89 ee             	mov    %r13,%rsi
+  803472:	bf 00 00 00 00       	mov    $0x0,%edi
+  803477:	48 b8 5e 18 80 00 00 	movabs $0x80185e,%rax
+  80347e:	00 00 00 
+  803481:	ff d0                	call   *%rax
+  803483:	89 c3                	mov    %eax,%ebx
+  803485:	85 c0                	test   %eax,%eax
+  803487:	78 6e                	js     8034f7 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803489:	be 00 10 00 00       	mov    $0x1000,%esi
+  80348e:	4c 89 ef             	mov    %r13,%rdi
+  803491:	48 b8 99 17 80 00 00 	movabs $0x801799,%rax
+  803498:	00 00 00 
+  80349b:	ff d0                	call   *%rax
+  80349d:	83 f8 02             	cmp    $0x2,%eax
+  8034a0:	0f 85 ab 00 00 00    	jne    803551 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8034a6:	a1 80 50 80 00 00 00 	movabs 0x805080,%eax
+  8034ad:	00 00 
+  8034af:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8034b3:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8034b5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8034b9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8034c0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8034c4:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8034c6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034ca:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8034d1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034d5:	48 bb 99 1e 80 00 00 	movabs $0x801e99,%rbx
+  8034dc:	00 00 00 
+  8034df:	ff d3                	call   *%rbx
+  8034e1:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8034e5:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8034e9:	ff d3                	call   *%rbx
+  8034eb:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8034f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034f5:	eb 4d                	jmp    803544 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8034f7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034fc:	4c 89 ee             	mov    %r13,%rsi
+  8034ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  803504:	48 b8 c3 18 80 00 00 	movabs $0x8018c3,%rax
+  80350b:	00 00 00 
+  80350e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803510:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803515:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803519:	bf 00 00 00 00       	mov    $0x0,%edi
+  80351e:	48 b8 c3 18 80 00 00 	movabs $0x8018c3,%rax
+  803525:	00 00 00 
+  803528:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80352a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80352f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803533:	bf 00 00 00 00       	mov    $0x0,%edi
+  803538:	48 b8 c3 18 80 00 00 	movabs $0x8018c3,%rax
+  80353f:	00 00 00 
+  803542:	ff d0                	call   *%rax
+}
+  803544:	89 d8                	mov    %ebx,%eax
+  803546:	48 83 c4 18          	add    $0x18,%rsp
+  80354a:	5b                   	pop    %rbx
+  80354b:	41 5c                	pop    %r12
+  80354d:	41 5d                	pop    %r13
+  80354f:	5d                   	pop    %rbp
+  803550:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803551:	48 b9 b0 42 80 00 00 	movabs $0x8042b0,%rcx
+  803558:	00 00 00 
+  80355b:	48 ba 1a 42 80 00 00 	movabs $0x80421a,%rdx
+  803562:	00 00 00 
+  803565:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80356a:	48 bf 9f 42 80 00 00 	movabs $0x80429f,%rdi
+  803571:	00 00 00 
+  803574:	b8 00 00 00 00       	mov    $0x0,%eax
+  803579:	49 b8 d2 07 80 00 00 	movabs $0x8007d2,%r8
+  803580:	00 00 00 
+  803583:	41 ff d0             	call   *%r8
+
+0000000000803586 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803586:	55                   	push   %rbp
+  803587:	48 89 e5             	mov    %rsp,%rbp
+  80358a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80358e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803592:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  803599:	00 00 00 
+  80359c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80359e:	85 c0                	test   %eax,%eax
+  8035a0:	78 35                	js     8035d7 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8035a2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8035a6:	48 b8 ab 1e 80 00 00 	movabs $0x801eab,%rax
+  8035ad:	00 00 00 
+  8035b0:	ff d0                	call   *%rax
+  8035b2:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8035b5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8035ba:	be 00 10 00 00       	mov    $0x1000,%esi
+  8035bf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8035c3:	48 b8 cb 17 80 00 00 	movabs $0x8017cb,%rax
+  8035ca:	00 00 00 
+  8035cd:	ff d0                	call   *%rax
+  8035cf:	85 c0                	test   %eax,%eax
+  8035d1:	0f 94 c0             	sete   %al
+  8035d4:	0f b6 c0             	movzbl %al,%eax
+}
+  8035d7:	c9                   	leave
+  8035d8:	c3                   	ret
+
+00000000008035d9 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8035d9:	55                   	push   %rbp
+  8035da:	48 89 e5             	mov    %rsp,%rbp
+  8035dd:	41 55                	push   %r13
+  8035df:	41 54                	push   %r12
+  8035e1:	53                   	push   %rbx
+  8035e2:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  8035e6:	85 ff                	test   %edi,%edi
+  8035e8:	74 6c                	je     803656 <wait+0x7d>
+  8035ea:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8035ed:	40 0f b6 c7          	movzbl %dil,%eax
+
+    while (env->env_id == envid &&
+  8035f1:	40 0f b6 cf          	movzbl %dil,%ecx
+  8035f5:	48 69 c9 b0 06 00 00 	imul   $0x6b0,%rcx,%rcx
+  8035fc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803603:	00 00 00 
+  803606:	48 01 ca             	add    %rcx,%rdx
+  803609:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80360f:	39 d7                	cmp    %edx,%edi
+  803611:	75 38                	jne    80364b <wait+0x72>
+           env->env_status != ENV_FREE) {
+  803613:	48 98                	cltq
+  803615:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  80361c:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803623:	00 00 00 
+  803626:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  803629:	49 bd 68 17 80 00 00 	movabs $0x801768,%r13
+  803630:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803633:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803639:	85 c0                	test   %eax,%eax
+  80363b:	74 0e                	je     80364b <wait+0x72>
+        sys_yield();
+  80363d:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803640:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803646:	44 39 e0             	cmp    %r12d,%eax
+  803649:	74 e8                	je     803633 <wait+0x5a>
+    }
+}
+  80364b:	48 83 c4 08          	add    $0x8,%rsp
+  80364f:	5b                   	pop    %rbx
+  803650:	41 5c                	pop    %r12
+  803652:	41 5d                	pop    %r13
+  803654:	5d                   	pop    %rbp
+  803655:	c3                   	ret
+    assert(envid != 0);
+  803656:	48 b9 d4 42 80 00 00 	movabs $0x8042d4,%rcx
+  80365d:	00 00 00 
+  803660:	48 ba 1a 42 80 00 00 	movabs $0x80421a,%rdx
+  803667:	00 00 00 
+  80366a:	be 06 00 00 00       	mov    $0x6,%esi
+  80366f:	48 bf df 42 80 00 00 	movabs $0x8042df,%rdi
+  803676:	00 00 00 
+  803679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367e:	49 b8 d2 07 80 00 00 	movabs $0x8007d2,%r8
+  803685:	00 00 00 
+  803688:	41 ff d0             	call   *%r8
+
+000000000080368b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80368b:	48 89 f8             	mov    %rdi,%rax
+  80368e:	48 c1 e8 27          	shr    $0x27,%rax
+  803692:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803699:	01 00 00 
+  80369c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036a0:	f6 c2 01             	test   $0x1,%dl
+  8036a3:	74 6d                	je     803712 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8036a5:	48 89 f8             	mov    %rdi,%rax
+  8036a8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8036ac:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8036b3:	01 00 00 
+  8036b6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036ba:	f6 c2 01             	test   $0x1,%dl
+  8036bd:	74 62                	je     803721 <get_uvpt_entry+0x96>
+  8036bf:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8036c6:	01 00 00 
+  8036c9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036cd:	f6 c2 80             	test   $0x80,%dl
+  8036d0:	75 4f                	jne    803721 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8036d2:	48 89 f8             	mov    %rdi,%rax
+  8036d5:	48 c1 e8 15          	shr    $0x15,%rax
+  8036d9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8036e0:	01 00 00 
+  8036e3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036e7:	f6 c2 01             	test   $0x1,%dl
+  8036ea:	74 44                	je     803730 <get_uvpt_entry+0xa5>
+  8036ec:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8036f3:	01 00 00 
+  8036f6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036fa:	f6 c2 80             	test   $0x80,%dl
+  8036fd:	75 31                	jne    803730 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8036ff:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803703:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80370a:	01 00 00 
+  80370d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803711:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803712:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803719:	01 00 00 
+  80371c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803720:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803721:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803728:	01 00 00 
+  80372b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80372f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803730:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803737:	01 00 00 
+  80373a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80373e:	c3                   	ret
+
+000000000080373f <get_prot>:
+
+int
+get_prot(void *va) {
+  80373f:	55                   	push   %rbp
+  803740:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803743:	48 b8 8b 36 80 00 00 	movabs $0x80368b,%rax
+  80374a:	00 00 00 
+  80374d:	ff d0                	call   *%rax
+  80374f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803752:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803757:	89 c1                	mov    %eax,%ecx
+  803759:	83 c9 04             	or     $0x4,%ecx
+  80375c:	f6 c2 01             	test   $0x1,%dl
+  80375f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803762:	89 c1                	mov    %eax,%ecx
+  803764:	83 c9 02             	or     $0x2,%ecx
+  803767:	f6 c2 02             	test   $0x2,%dl
+  80376a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80376d:	89 c1                	mov    %eax,%ecx
+  80376f:	83 c9 01             	or     $0x1,%ecx
+  803772:	48 85 d2             	test   %rdx,%rdx
+  803775:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803778:	89 c1                	mov    %eax,%ecx
+  80377a:	83 c9 40             	or     $0x40,%ecx
+  80377d:	f6 c6 04             	test   $0x4,%dh
+  803780:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803783:	5d                   	pop    %rbp
+  803784:	c3                   	ret
+
+0000000000803785 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803785:	55                   	push   %rbp
+  803786:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803789:	48 b8 8b 36 80 00 00 	movabs $0x80368b,%rax
+  803790:	00 00 00 
+  803793:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803795:	48 c1 e8 06          	shr    $0x6,%rax
+  803799:	83 e0 01             	and    $0x1,%eax
+}
+  80379c:	5d                   	pop    %rbp
+  80379d:	c3                   	ret
+
+000000000080379e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80379e:	55                   	push   %rbp
+  80379f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8037a2:	48 b8 8b 36 80 00 00 	movabs $0x80368b,%rax
+  8037a9:	00 00 00 
+  8037ac:	ff d0                	call   *%rax
+  8037ae:	83 e0 01             	and    $0x1,%eax
+}
+  8037b1:	5d                   	pop    %rbp
+  8037b2:	c3                   	ret
+
+00000000008037b3 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8037b3:	55                   	push   %rbp
+  8037b4:	48 89 e5             	mov    %rsp,%rbp
+  8037b7:	41 57                	push   %r15
+  8037b9:	41 56                	push   %r14
+  8037bb:	41 55                	push   %r13
+  8037bd:	41 54                	push   %r12
+  8037bf:	53                   	push   %rbx
+  8037c0:	48 83 ec 18          	sub    $0x18,%rsp
+  8037c4:	49 89 ff             	mov    %rdi,%r15
+  8037c7:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8037cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  8037d0:	49 bc 9e 37 80 00 00 	movabs $0x80379e,%r12
+  8037d7:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  8037da:	49 be 3f 37 80 00 00 	movabs $0x80373f,%r14
+  8037e1:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  8037e4:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  8037eb:	00 00 00 
+  8037ee:	eb 0c                	jmp    8037fc <foreach_shared_region+0x49>
+  8037f0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8037f7:	4c 39 eb             	cmp    %r13,%rbx
+  8037fa:	74 38                	je     803834 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  8037fc:	48 89 df             	mov    %rbx,%rdi
+  8037ff:	41 ff d4             	call   *%r12
+  803802:	84 c0                	test   %al,%al
+  803804:	74 ea                	je     8037f0 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  803806:	48 89 df             	mov    %rbx,%rdi
+  803809:	41 ff d6             	call   *%r14
+  80380c:	a8 40                	test   $0x40,%al
+  80380e:	74 e0                	je     8037f0 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  803810:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803817:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80381b:	48 89 df             	mov    %rbx,%rdi
+  80381e:	41 ff d7             	call   *%r15
+        if (err)
+  803821:	85 c0                	test   %eax,%eax
+  803823:	74 cb                	je     8037f0 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  803825:	48 83 c4 18          	add    $0x18,%rsp
+  803829:	5b                   	pop    %rbx
+  80382a:	41 5c                	pop    %r12
+  80382c:	41 5d                	pop    %r13
+  80382e:	41 5e                	pop    %r14
+  803830:	41 5f                	pop    %r15
+  803832:	5d                   	pop    %rbp
+  803833:	c3                   	ret
+    return 0;
+  803834:	b8 00 00 00 00       	mov    $0x0,%eax
+  803839:	eb ea                	jmp    803825 <foreach_shared_region+0x72>
+
+000000000080383b <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80383b:	55                   	push   %rbp
+  80383c:	48 89 e5             	mov    %rsp,%rbp
+  80383f:	41 54                	push   %r12
+  803841:	53                   	push   %rbx
+  803842:	48 89 fb             	mov    %rdi,%rbx
+  803845:	48 89 f7             	mov    %rsi,%rdi
+  803848:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  80384b:	48 85 f6             	test   %rsi,%rsi
+  80384e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803855:	00 00 00 
+  803858:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  80385c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803861:	48 b8 61 1b 80 00 00 	movabs $0x801b61,%rax
+  803868:	00 00 00 
+  80386b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80386d:	85 c0                	test   %eax,%eax
+  80386f:	78 45                	js     8038b6 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  803871:	48 85 db             	test   %rbx,%rbx
+  803874:	74 12                	je     803888 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  803876:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80387d:	00 00 00 
+  803880:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  803886:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  803888:	4d 85 e4             	test   %r12,%r12
+  80388b:	74 14                	je     8038a1 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  80388d:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803894:	00 00 00 
+  803897:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  80389d:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  8038a1:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8038a8:	00 00 00 
+  8038ab:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  8038b1:	5b                   	pop    %rbx
+  8038b2:	41 5c                	pop    %r12
+  8038b4:	5d                   	pop    %rbp
+  8038b5:	c3                   	ret
+        if (from_env_store)
+  8038b6:	48 85 db             	test   %rbx,%rbx
+  8038b9:	74 06                	je     8038c1 <ipc_recv+0x86>
+            *from_env_store = 0;
+  8038bb:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  8038c1:	4d 85 e4             	test   %r12,%r12
+  8038c4:	74 eb                	je     8038b1 <ipc_recv+0x76>
+            *perm_store = 0;
+  8038c6:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8038cd:	00 
+  8038ce:	eb e1                	jmp    8038b1 <ipc_recv+0x76>
+
+00000000008038d0 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8038d0:	55                   	push   %rbp
+  8038d1:	48 89 e5             	mov    %rsp,%rbp
+  8038d4:	41 57                	push   %r15
+  8038d6:	41 56                	push   %r14
+  8038d8:	41 55                	push   %r13
+  8038da:	41 54                	push   %r12
+  8038dc:	53                   	push   %rbx
+  8038dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8038e1:	41 89 fd             	mov    %edi,%r13d
+  8038e4:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8038e7:	48 89 d3             	mov    %rdx,%rbx
+  8038ea:	49 89 cc             	mov    %rcx,%r12
+  8038ed:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  8038f1:	48 85 d2             	test   %rdx,%rdx
+  8038f4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8038fb:	00 00 00 
+  8038fe:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803902:	49 be 35 1b 80 00 00 	movabs $0x801b35,%r14
+  803909:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  80390c:	49 bf 68 17 80 00 00 	movabs $0x801768,%r15
+  803913:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  803916:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803919:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  80391d:	4c 89 e1             	mov    %r12,%rcx
+  803920:	48 89 da             	mov    %rbx,%rdx
+  803923:	44 89 ef             	mov    %r13d,%edi
+  803926:	41 ff d6             	call   *%r14
+        if (res == 0)
+  803929:	85 c0                	test   %eax,%eax
+  80392b:	74 34                	je     803961 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  80392d:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803930:	75 05                	jne    803937 <ipc_send+0x67>
+        sys_yield();
+  803932:	41 ff d7             	call   *%r15
+    while (true) {
+  803935:	eb df                	jmp    803916 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  803937:	48 ba ea 42 80 00 00 	movabs $0x8042ea,%rdx
+  80393e:	00 00 00 
+  803941:	be 3e 00 00 00       	mov    $0x3e,%esi
+  803946:	48 bf 03 43 80 00 00 	movabs $0x804303,%rdi
+  80394d:	00 00 00 
+  803950:	b8 00 00 00 00       	mov    $0x0,%eax
+  803955:	48 b9 d2 07 80 00 00 	movabs $0x8007d2,%rcx
+  80395c:	00 00 00 
+  80395f:	ff d1                	call   *%rcx
+    }
+}
+  803961:	48 83 c4 18          	add    $0x18,%rsp
+  803965:	5b                   	pop    %rbx
+  803966:	41 5c                	pop    %r12
+  803968:	41 5d                	pop    %r13
+  80396a:	41 5e                	pop    %r14
+  80396c:	41 5f                	pop    %r15
+  80396e:	5d                   	pop    %rbp
+  80396f:	c3                   	ret
+
+0000000000803970 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803970:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803975:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80397c:	00 00 00 
+  80397f:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  803986:	48 01 ca             	add    %rcx,%rdx
+  803989:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80398f:	39 fa                	cmp    %edi,%edx
+  803991:	74 12                	je     8039a5 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803993:	48 83 c0 01          	add    $0x1,%rax
+  803997:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80399d:	75 e0                	jne    80397f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80399f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039a4:	c3                   	ret
+            return envs[i].env_id;
+  8039a5:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8039ac:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8039b3:	00 00 00 
+  8039b6:	48 01 d0             	add    %rdx,%rax
+  8039b9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8039bf:	c3                   	ret
+
+00000000008039c0 <__rodata_start>:
+  8039c0:	73 68                	jae    803a2a <__rodata_start+0x6a>
+  8039c2:	65 6c                	gs insb (%dx),%es:(%rdi)
+  8039c4:	6c                   	insb   (%dx),%es:(%rdi)
+  8039c5:	20 70 72             	and    %dh,0x72(%rax)
+  8039c8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039c9:	64 75 63             	fs jne 803a2f <__rodata_start+0x6f>
+  8039cc:	65 64 20 69 6e       	gs and %ch,%fs:0x6e(%rcx)
+  8039d1:	63 6f 72             	movsxd 0x72(%rdi),%ebp
+  8039d4:	72 65                	jb     803a3b <__rodata_start+0x7b>
+  8039d6:	63 74 20 6f          	movsxd 0x6f(%rax,%riz,1),%esi
+  8039da:	75 74                	jne    803a50 <__rodata_start+0x90>
+  8039dc:	70 75                	jo     803a53 <__rodata_start+0x93>
+  8039de:	74 2e                	je     803a0e <__rodata_start+0x4e>
+  8039e0:	0a 00                	or     (%rax),%al
+  8039e2:	00 00                	add    %al,(%rax)
+  8039e4:	00 00                	add    %al,(%rax)
+  8039e6:	00 00                	add    %al,(%rax)
+  8039e8:	72 75                	jb     803a5f <__rodata_start+0x9f>
+  8039ea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039eb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039ec:	69 6e 67 20 73 68 20 	imul   $0x20687320,0x67(%rsi),%ebp
+  8039f3:	2d 78 20 3c 20       	sub    $0x203c2078,%eax
+  8039f8:	74 65                	je     803a5f <__rodata_start+0x9f>
+  8039fa:	73 74                	jae    803a70 <__rodata_start+0xb0>
+  8039fc:	73 68                	jae    803a66 <__rodata_start+0xa6>
+  8039fe:	65 6c                	gs insb (%dx),%es:(%rdi)
+  803a00:	6c                   	insb   (%dx),%es:(%rdi)
+  803a01:	2e 73 68             	jae,pn 803a6c <__rodata_start+0xac>
+  803a04:	20 7c 20 63          	and    %bh,0x63(%rax,%riz,1)
+  803a08:	61                   	(bad)
+  803a09:	74 0a                	je     803a15 <__rodata_start+0x55>
+  803a0b:	00 00                	add    %al,(%rax)
+  803a0d:	00 00                	add    %al,(%rax)
+  803a0f:	00 6f 70             	add    %ch,0x70(%rdi)
+  803a12:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803a14:	20 74 65 73          	and    %dh,0x73(%rbp,%riz,2)
+  803a18:	74 73                	je     803a8d <__rodata_start+0xcd>
+  803a1a:	68 65 6c 6c 2e       	push   $0x2e6c6c65
+  803a1f:	6b 65 79 20          	imul   $0x20,0x79(%rbp),%esp
+  803a23:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803a25:	72 20                	jb     803a47 <__rodata_start+0x87>
+  803a27:	72 65                	jb     803a8e <__rodata_start+0xce>
+  803a29:	61                   	(bad)
+  803a2a:	64 69 6e 67 3a 20 25 	imul   $0x6925203a,%fs:0x67(%rsi),%ebp
+  803a31:	69 
+  803a32:	00 65 78             	add    %ah,0x78(%rbp)
+  803a35:	70 65                	jo     803a9c <__rodata_start+0xdc>
+  803a37:	63 74 65 64          	movsxd 0x64(%rbp,%riz,2),%esi
+  803a3b:	3a 0a                	cmp    (%rdx),%cl
+  803a3d:	3d 3d 3d 0a 25       	cmp    $0x250a3d3d,%eax
+  803a42:	63 00                	movsxd (%rax),%eax
+  803a44:	3d 3d 3d 0a 67       	cmp    $0x670a3d3d,%eax
+  803a49:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a4a:	74 3a                	je     803a86 <__rodata_start+0xc6>
+  803a4c:	0a 3d 3d 3d 0a 25    	or     0x250a3d3d(%rip),%bh        # 258a778f <__bss_end+0x2509e78f>
+  803a52:	63 00                	movsxd (%rax),%eax
+  803a54:	3d 3d 3d 0a 00       	cmp    $0xa3d3d,%eax
+  803a59:	74 65                	je     803ac0 <__rodata_start+0x100>
+  803a5b:	73 74                	jae    803ad1 <__rodata_start+0x111>
+  803a5d:	73 68                	jae    803ac7 <__rodata_start+0x107>
+  803a5f:	65 6c                	gs insb (%dx),%es:(%rdi)
+  803a61:	6c                   	insb   (%dx),%es:(%rdi)
+  803a62:	2e 73 68             	jae,pn 803acd <__rodata_start+0x10d>
+  803a65:	00 6f 70             	add    %ch,0x70(%rdi)
+  803a68:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803a6a:	20 74 65 73          	and    %dh,0x73(%rbp,%riz,2)
+  803a6e:	74 73                	je     803ae3 <__rodata_start+0x123>
+  803a70:	68 65 6c 6c 2e       	push   $0x2e6c6c65
+  803a75:	73 68                	jae    803adf <__rodata_start+0x11f>
+  803a77:	3a 20                	cmp    (%rax),%ah
+  803a79:	25 69 00 75 73       	and    $0x73750069,%eax
+  803a7e:	65 72 2f             	gs jb  803ab0 <__rodata_start+0xf0>
+  803a81:	74 65                	je     803ae8 <__rodata_start+0x128>
+  803a83:	73 74                	jae    803af9 <__rodata_start+0x139>
+  803a85:	73 68                	jae    803aef <__rodata_start+0x12f>
+  803a87:	65 6c                	gs insb (%dx),%es:(%rdi)
+  803a89:	6c                   	insb   (%dx),%es:(%rdi)
+  803a8a:	2e 63 00             	cs movsxd (%rax),%eax
+  803a8d:	70 69                	jo     803af8 <__rodata_start+0x138>
+  803a8f:	70 65                	jo     803af6 <__rodata_start+0x136>
+  803a91:	3a 20                	cmp    (%rax),%ah
+  803a93:	25 69 00 66 6f       	and    $0x6f660069,%eax
+  803a98:	72 6b                	jb     803b05 <__rodata_start+0x145>
+  803a9a:	3a 20                	cmp    (%rax),%ah
+  803a9c:	25 69 00 2d 78       	and    $0x782d0069,%eax
+  803aa1:	00 2f                	add    %ch,(%rdi)
+  803aa3:	73 68                	jae    803b0d <__rodata_start+0x14d>
+  803aa5:	00 73 70             	add    %dh,0x70(%rbx)
+  803aa8:	61                   	(bad)
+  803aa9:	77 6e                	ja     803b19 <__rodata_start+0x159>
+  803aab:	3a 20                	cmp    (%rax),%ah
+  803aad:	25 69 00 74 65       	and    $0x65740069,%eax
+  803ab2:	73 74                	jae    803b28 <__rodata_start+0x168>
+  803ab4:	73 68                	jae    803b1e <__rodata_start+0x15e>
+  803ab6:	65 6c                	gs insb (%dx),%es:(%rdi)
+  803ab8:	6c                   	insb   (%dx),%es:(%rdi)
+  803ab9:	2e 6b 65 79 00       	cs imul $0x0,0x79(%rbp),%esp
+  803abe:	72 65                	jb     803b25 <__rodata_start+0x165>
+  803ac0:	61                   	(bad)
+  803ac1:	64 69 6e 67 20 74 65 	imul   $0x73657420,%fs:0x67(%rsi),%ebp
+  803ac8:	73 
+  803ac9:	74 73                	je     803b3e <__rodata_start+0x17e>
+  803acb:	68 65 6c 6c 2e       	push   $0x2e6c6c65
+  803ad0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ad1:	75 74                	jne    803b47 <__rodata_start+0x187>
+  803ad3:	3a 20                	cmp    (%rax),%ah
+  803ad5:	25 69 00 72 65       	and    $0x65720069,%eax
+  803ada:	61                   	(bad)
+  803adb:	64 69 6e 67 20 74 65 	imul   $0x73657420,%fs:0x67(%rsi),%ebp
+  803ae2:	73 
+  803ae3:	74 73                	je     803b58 <__rodata_start+0x198>
+  803ae5:	68 65 6c 6c 2e       	push   $0x2e6c6c65
+  803aea:	6b 65 79 3a          	imul   $0x3a,0x79(%rbp),%esp
+  803aee:	20 25 69 00 73 68    	and    %ah,0x68730069(%rip)        # 68f33b5d <__bss_end+0x6872ab5d>
+  803af4:	65 6c                	gs insb (%dx),%es:(%rdi)
+  803af6:	6c                   	insb   (%dx),%es:(%rdi)
+  803af7:	20 72 61             	and    %dh,0x61(%rdx)
+  803afa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803afb:	20 63 6f             	and    %ah,0x6f(%rbx)
+  803afe:	72 72                	jb     803b72 <__rodata_start+0x1b2>
+  803b00:	65 63 74 6c 79       	movsxd %gs:0x79(%rsp,%rbp,2),%esi
+  803b05:	0a 00                	or     (%rax),%al
+  803b07:	3c 63                	cmp    $0x63,%al
+  803b09:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b0a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b0b:	73 3e                	jae    803b4b <__rodata_start+0x18b>
+  803b0d:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803b10:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b11:	73 00                	jae    803b13 <__rodata_start+0x153>
+  803b13:	3c 75                	cmp    $0x75,%al
+  803b15:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b16:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803b1a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b1b:	3e 00 0f             	ds add %cl,(%rdi)
+  803b1e:	1f                   	(bad)
+  803b1f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803b22:	30 38                	xor    %bh,(%rax)
+  803b24:	78 5d                	js     803b83 <__rodata_start+0x1c3>
+  803b26:	20 75 73             	and    %dh,0x73(%rbp)
+  803b29:	65 72 20             	gs jb  803b4c <__rodata_start+0x18c>
+  803b2c:	70 61                	jo     803b8f <__rodata_start+0x1cf>
+  803b2e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b2f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803b36:	73 20                	jae    803b58 <__rodata_start+0x198>
+  803b38:	61                   	(bad)
+  803b39:	74 20                	je     803b5b <__rodata_start+0x19b>
+  803b3b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803b40:	3a 20                	cmp    (%rax),%ah
+  803b42:	00 30                	add    %dh,(%rax)
+  803b44:	31 32                	xor    %esi,(%rdx)
+  803b46:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803b4d:	41                   	rex.B
+  803b4e:	42                   	rex.X
+  803b4f:	43                   	rex.XB
+  803b50:	44                   	rex.R
+  803b51:	45                   	rex.RB
+  803b52:	46 00 30             	rex.RX add %r14b,(%rax)
+  803b55:	31 32                	xor    %esi,(%rdx)
+  803b57:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803b5e:	61                   	(bad)
+  803b5f:	62 63 64 65 66       	(bad)
+  803b64:	00 28                	add    %ch,(%rax)
+  803b66:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b67:	75 6c                	jne    803bd5 <__rodata_start+0x215>
+  803b69:	6c                   	insb   (%dx),%es:(%rdi)
+  803b6a:	29 00                	sub    %eax,(%rax)
+  803b6c:	65 72 72             	gs jb  803be1 <__rodata_start+0x221>
+  803b6f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b70:	72 20                	jb     803b92 <__rodata_start+0x1d2>
+  803b72:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803b77:	73 70                	jae    803be9 <__rodata_start+0x229>
+  803b79:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803b7d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803b84:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b85:	72 00                	jb     803b87 <__rodata_start+0x1c7>
+  803b87:	62 61 64 20 65       	(bad)
+  803b8c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b8d:	76 69                	jbe    803bf8 <__rodata_start+0x238>
+  803b8f:	72 6f                	jb     803c00 <__rodata_start+0x240>
+  803b91:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b92:	6d                   	insl   (%dx),%es:(%rdi)
+  803b93:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b95:	74 00                	je     803b97 <__rodata_start+0x1d7>
+  803b97:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803b9e:	20 70 61             	and    %dh,0x61(%rax)
+  803ba1:	72 61                	jb     803c04 <__rodata_start+0x244>
+  803ba3:	6d                   	insl   (%dx),%es:(%rdi)
+  803ba4:	65 74 65             	gs je  803c0c <__rodata_start+0x24c>
+  803ba7:	72 00                	jb     803ba9 <__rodata_start+0x1e9>
+  803ba9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803baa:	75 74                	jne    803c20 <__rodata_start+0x260>
+  803bac:	20 6f 66             	and    %ch,0x66(%rdi)
+  803baf:	20 6d 65             	and    %ch,0x65(%rbp)
+  803bb2:	6d                   	insl   (%dx),%es:(%rdi)
+  803bb3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bb4:	72 79                	jb     803c2f <__rodata_start+0x26f>
+  803bb6:	00 6f 75             	add    %ch,0x75(%rdi)
+  803bb9:	74 20                	je     803bdb <__rodata_start+0x21b>
+  803bbb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bbc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803bc0:	76 69                	jbe    803c2b <__rodata_start+0x26b>
+  803bc2:	72 6f                	jb     803c33 <__rodata_start+0x273>
+  803bc4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bc5:	6d                   	insl   (%dx),%es:(%rdi)
+  803bc6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803bc8:	74 73                	je     803c3d <__rodata_start+0x27d>
+  803bca:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803bcd:	72 72                	jb     803c41 <__rodata_start+0x281>
+  803bcf:	75 70                	jne    803c41 <__rodata_start+0x281>
+  803bd1:	74 65                	je     803c38 <__rodata_start+0x278>
+  803bd3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803bd8:	75 67                	jne    803c41 <__rodata_start+0x281>
+  803bda:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803bdd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803bdf:	00 73 65             	add    %dh,0x65(%rbx)
+  803be2:	67 6d                	insl   (%dx),%es:(%edi)
+  803be4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803be6:	74 61                	je     803c49 <__rodata_start+0x289>
+  803be8:	74 69                	je     803c53 <__rodata_start+0x293>
+  803bea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803beb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bec:	20 66 61             	and    %ah,0x61(%rsi)
+  803bef:	75 6c                	jne    803c5d <__rodata_start+0x29d>
+  803bf1:	74 00                	je     803bf3 <__rodata_start+0x233>
+  803bf3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803bfa:	20 45 4c             	and    %al,0x4c(%rbp)
+  803bfd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803c01:	61                   	(bad)
+  803c02:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803c07:	20 73 75             	and    %dh,0x75(%rbx)
+  803c0a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803c0d:	73 79                	jae    803c88 <__rodata_start+0x2c8>
+  803c0f:	73 74                	jae    803c85 <__rodata_start+0x2c5>
+  803c11:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803c13:	20 63 61             	and    %ah,0x61(%rbx)
+  803c16:	6c                   	insb   (%dx),%es:(%rdi)
+  803c17:	6c                   	insb   (%dx),%es:(%rdi)
+  803c18:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803c1b:	74 72                	je     803c8f <__rodata_start+0x2cf>
+  803c1d:	79 20                	jns    803c3f <__rodata_start+0x27f>
+  803c1f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c20:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c21:	74 20                	je     803c43 <__rodata_start+0x283>
+  803c23:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c25:	75 6e                	jne    803c95 <__rodata_start+0x2d5>
+  803c27:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803c2b:	76 20                	jbe    803c4d <__rodata_start+0x28d>
+  803c2d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803c34:	72 65                	jb     803c9b <__rodata_start+0x2db>
+  803c36:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803c39:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c3a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803c3e:	65 78 70             	gs js  803cb1 <__rodata_start+0x2f1>
+  803c41:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803c46:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803c49:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803c4d:	20 66 69             	and    %ah,0x69(%rsi)
+  803c50:	6c                   	insb   (%dx),%es:(%rdi)
+  803c51:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803c55:	20 66 72             	and    %ah,0x72(%rsi)
+  803c58:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803c5d:	61                   	(bad)
+  803c5e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803c61:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c62:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c63:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803c67:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803c6a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c6b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c6c:	20 6d 61             	and    %ch,0x61(%rbp)
+  803c6f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c70:	79 20                	jns    803c92 <__rodata_start+0x2d2>
+  803c72:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803c79:	72 65                	jb     803ce0 <__rodata_start+0x320>
+  803c7b:	20 6f 70             	and    %ch,0x70(%rdi)
+  803c7e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c80:	00 66 69             	add    %ah,0x69(%rsi)
+  803c83:	6c                   	insb   (%dx),%es:(%rdi)
+  803c84:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803c88:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803c8b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c8c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803c8f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c90:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c91:	74 20                	je     803cb3 <__rodata_start+0x2f3>
+  803c93:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c95:	75 6e                	jne    803d05 <__rodata_start+0x345>
+  803c97:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803c9b:	76 61                	jbe    803cfe <__rodata_start+0x33e>
+  803c9d:	6c                   	insb   (%dx),%es:(%rdi)
+  803c9e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803ca5:	00 
+  803ca6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803cad:	72 65                	jb     803d14 <__rodata_start+0x354>
+  803caf:	61                   	(bad)
+  803cb0:	64 79 20             	fs jns 803cd3 <__rodata_start+0x313>
+  803cb3:	65 78 69             	gs js  803d1f <__rodata_start+0x35f>
+  803cb6:	73 74                	jae    803d2c <__rodata_start+0x36c>
+  803cb8:	73 00                	jae    803cba <__rodata_start+0x2fa>
+  803cba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cbb:	70 65                	jo     803d22 <__rodata_start+0x362>
+  803cbd:	72 61                	jb     803d20 <__rodata_start+0x360>
+  803cbf:	74 69                	je     803d2a <__rodata_start+0x36a>
+  803cc1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cc2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803cc3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803cc6:	74 20                	je     803ce8 <__rodata_start+0x328>
+  803cc8:	73 75                	jae    803d3f <__rodata_start+0x37f>
+  803cca:	70 70                	jo     803d3c <__rodata_start+0x37c>
+  803ccc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ccd:	72 74                	jb     803d43 <__rodata_start+0x383>
+  803ccf:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803cd4:	65 72 61             	gs jb  803d38 <__rodata_start+0x378>
+  803cd7:	74 69                	je     803d42 <__rodata_start+0x382>
+  803cd9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cda:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803cdb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803cde:	74 20                	je     803d00 <__rodata_start+0x340>
+  803ce0:	70 65                	jo     803d47 <__rodata_start+0x387>
+  803ce2:	72 6d                	jb     803d51 <__rodata_start+0x391>
+  803ce4:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  803ceb:	2e 
+  803cec:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803cf3:	00 
+  803cf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803cfb:	00 00 00 
+  803cfe:	66 90                	xchg   %ax,%ax
+  803d00:	0f 0b                	ud2
+  803d02:	80 00 00             	addb   $0x0,(%rax)
+  803d05:	00 00                	add    %al,(%rax)
+  803d07:	00 50 11             	add    %dl,0x11(%rax)
+  803d0a:	80 00 00             	addb   $0x0,(%rax)
+  803d0d:	00 00                	add    %al,(%rax)
+  803d0f:	00 40 11             	add    %al,0x11(%rax)
+  803d12:	80 00 00             	addb   $0x0,(%rax)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 50 11             	add    %dl,0x11(%rax)
+  803d1a:	80 00 00             	addb   $0x0,(%rax)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 50 11             	add    %dl,0x11(%rax)
+  803d22:	80 00 00             	addb   $0x0,(%rax)
+  803d25:	00 00                	add    %al,(%rax)
+  803d27:	00 50 11             	add    %dl,0x11(%rax)
+  803d2a:	80 00 00             	addb   $0x0,(%rax)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 50 11             	add    %dl,0x11(%rax)
+  803d32:	80 00 00             	addb   $0x0,(%rax)
+  803d35:	00 00                	add    %al,(%rax)
+  803d37:	00 2e                	add    %ch,(%rsi)
+  803d39:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d3f:	00 50 11             	add    %dl,0x11(%rax)
+  803d42:	80 00 00             	addb   $0x0,(%rax)
+  803d45:	00 00                	add    %al,(%rax)
+  803d47:	00 50 11             	add    %dl,0x11(%rax)
+  803d4a:	80 00 00             	addb   $0x0,(%rax)
+  803d4d:	00 00                	add    %al,(%rax)
+  803d4f:	00 22                	add    %ah,(%rdx)
+  803d51:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d57:	00 9c 0b 80 00 00 00 	add    %bl,0x80(%rbx,%rcx,1)
+  803d5e:	00 00                	add    %al,(%rax)
+  803d60:	50                   	push   %rax
+  803d61:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  803d67:	00 22                	add    %ah,(%rdx)
+  803d69:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803d6f:	00 68 0b             	add    %ch,0xb(%rax)
+  803d72:	80 00 00             	addb   $0x0,(%rax)
+  803d75:	00 00                	add    %al,(%rax)
+  803d77:	00 68 0b             	add    %ch,0xb(%rax)
+  803d7a:	80 00 00             	addb   $0x0,(%rax)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 68 0b             	add    %ch,0xb(%rax)
+  803d82:	80 00 00             	addb   $0x0,(%rax)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 68 0b             	add    %ch,0xb(%rax)
+  803d8a:	80 00 00             	addb   $0x0,(%rax)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 68 0b             	add    %ch,0xb(%rax)
+  803d92:	80 00 00             	addb   $0x0,(%rax)
+  803d95:	00 00                	add    %al,(%rax)
+  803d97:	00 68 0b             	add    %ch,0xb(%rax)
+  803d9a:	80 00 00             	addb   $0x0,(%rax)
+  803d9d:	00 00                	add    %al,(%rax)
+  803d9f:	00 68 0b             	add    %ch,0xb(%rax)
+  803da2:	80 00 00             	addb   $0x0,(%rax)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 68 0b             	add    %ch,0xb(%rax)
+  803daa:	80 00 00             	addb   $0x0,(%rax)
+  803dad:	00 00                	add    %al,(%rax)
+  803daf:	00 68 0b             	add    %ch,0xb(%rax)
+  803db2:	80 00 00             	addb   $0x0,(%rax)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 50 11             	add    %dl,0x11(%rax)
+  803dba:	80 00 00             	addb   $0x0,(%rax)
+  803dbd:	00 00                	add    %al,(%rax)
+  803dbf:	00 50 11             	add    %dl,0x11(%rax)
+  803dc2:	80 00 00             	addb   $0x0,(%rax)
+  803dc5:	00 00                	add    %al,(%rax)
+  803dc7:	00 50 11             	add    %dl,0x11(%rax)
+  803dca:	80 00 00             	addb   $0x0,(%rax)
+  803dcd:	00 00                	add    %al,(%rax)
+  803dcf:	00 50 11             	add    %dl,0x11(%rax)
+  803dd2:	80 00 00             	addb   $0x0,(%rax)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 50 11             	add    %dl,0x11(%rax)
+  803dda:	80 00 00             	addb   $0x0,(%rax)
+  803ddd:	00 00                	add    %al,(%rax)
+  803ddf:	00 50 11             	add    %dl,0x11(%rax)
+  803de2:	80 00 00             	addb   $0x0,(%rax)
+  803de5:	00 00                	add    %al,(%rax)
+  803de7:	00 50 11             	add    %dl,0x11(%rax)
+  803dea:	80 00 00             	addb   $0x0,(%rax)
+  803ded:	00 00                	add    %al,(%rax)
+  803def:	00 50 11             	add    %dl,0x11(%rax)
+  803df2:	80 00 00             	addb   $0x0,(%rax)
+  803df5:	00 00                	add    %al,(%rax)
+  803df7:	00 50 11             	add    %dl,0x11(%rax)
+  803dfa:	80 00 00             	addb   $0x0,(%rax)
+  803dfd:	00 00                	add    %al,(%rax)
+  803dff:	00 50 11             	add    %dl,0x11(%rax)
+  803e02:	80 00 00             	addb   $0x0,(%rax)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 50 11             	add    %dl,0x11(%rax)
+  803e0a:	80 00 00             	addb   $0x0,(%rax)
+  803e0d:	00 00                	add    %al,(%rax)
+  803e0f:	00 50 11             	add    %dl,0x11(%rax)
+  803e12:	80 00 00             	addb   $0x0,(%rax)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 50 11             	add    %dl,0x11(%rax)
+  803e1a:	80 00 00             	addb   $0x0,(%rax)
+  803e1d:	00 00                	add    %al,(%rax)
+  803e1f:	00 50 11             	add    %dl,0x11(%rax)
+  803e22:	80 00 00             	addb   $0x0,(%rax)
+  803e25:	00 00                	add    %al,(%rax)
+  803e27:	00 50 11             	add    %dl,0x11(%rax)
+  803e2a:	80 00 00             	addb   $0x0,(%rax)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 50 11             	add    %dl,0x11(%rax)
+  803e32:	80 00 00             	addb   $0x0,(%rax)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 50 11             	add    %dl,0x11(%rax)
+  803e3a:	80 00 00             	addb   $0x0,(%rax)
+  803e3d:	00 00                	add    %al,(%rax)
+  803e3f:	00 50 11             	add    %dl,0x11(%rax)
+  803e42:	80 00 00             	addb   $0x0,(%rax)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 50 11             	add    %dl,0x11(%rax)
+  803e4a:	80 00 00             	addb   $0x0,(%rax)
+  803e4d:	00 00                	add    %al,(%rax)
+  803e4f:	00 50 11             	add    %dl,0x11(%rax)
+  803e52:	80 00 00             	addb   $0x0,(%rax)
+  803e55:	00 00                	add    %al,(%rax)
+  803e57:	00 50 11             	add    %dl,0x11(%rax)
+  803e5a:	80 00 00             	addb   $0x0,(%rax)
+  803e5d:	00 00                	add    %al,(%rax)
+  803e5f:	00 50 11             	add    %dl,0x11(%rax)
+  803e62:	80 00 00             	addb   $0x0,(%rax)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 50 11             	add    %dl,0x11(%rax)
+  803e6a:	80 00 00             	addb   $0x0,(%rax)
+  803e6d:	00 00                	add    %al,(%rax)
+  803e6f:	00 50 11             	add    %dl,0x11(%rax)
+  803e72:	80 00 00             	addb   $0x0,(%rax)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 50 11             	add    %dl,0x11(%rax)
+  803e7a:	80 00 00             	addb   $0x0,(%rax)
+  803e7d:	00 00                	add    %al,(%rax)
+  803e7f:	00 50 11             	add    %dl,0x11(%rax)
+  803e82:	80 00 00             	addb   $0x0,(%rax)
+  803e85:	00 00                	add    %al,(%rax)
+  803e87:	00 50 11             	add    %dl,0x11(%rax)
+  803e8a:	80 00 00             	addb   $0x0,(%rax)
+  803e8d:	00 00                	add    %al,(%rax)
+  803e8f:	00 50 11             	add    %dl,0x11(%rax)
+  803e92:	80 00 00             	addb   $0x0,(%rax)
+  803e95:	00 00                	add    %al,(%rax)
+  803e97:	00 50 11             	add    %dl,0x11(%rax)
+  803e9a:	80 00 00             	addb   $0x0,(%rax)
+  803e9d:	00 00                	add    %al,(%rax)
+  803e9f:	00 50 11             	add    %dl,0x11(%rax)
+  803ea2:	80 00 00             	addb   $0x0,(%rax)
+  803ea5:	00 00                	add    %al,(%rax)
+  803ea7:	00 73 10             	add    %dh,0x10(%rbx)
+  803eaa:	80 00 00             	addb   $0x0,(%rax)
+  803ead:	00 00                	add    %al,(%rax)
+  803eaf:	00 50 11             	add    %dl,0x11(%rax)
+  803eb2:	80 00 00             	addb   $0x0,(%rax)
+  803eb5:	00 00                	add    %al,(%rax)
+  803eb7:	00 50 11             	add    %dl,0x11(%rax)
+  803eba:	80 00 00             	addb   $0x0,(%rax)
+  803ebd:	00 00                	add    %al,(%rax)
+  803ebf:	00 50 11             	add    %dl,0x11(%rax)
+  803ec2:	80 00 00             	addb   $0x0,(%rax)
+  803ec5:	00 00                	add    %al,(%rax)
+  803ec7:	00 50 11             	add    %dl,0x11(%rax)
+  803eca:	80 00 00             	addb   $0x0,(%rax)
+  803ecd:	00 00                	add    %al,(%rax)
+  803ecf:	00 50 11             	add    %dl,0x11(%rax)
+  803ed2:	80 00 00             	addb   $0x0,(%rax)
+  803ed5:	00 00                	add    %al,(%rax)
+  803ed7:	00 50 11             	add    %dl,0x11(%rax)
+  803eda:	80 00 00             	addb   $0x0,(%rax)
+  803edd:	00 00                	add    %al,(%rax)
+  803edf:	00 50 11             	add    %dl,0x11(%rax)
+  803ee2:	80 00 00             	addb   $0x0,(%rax)
+  803ee5:	00 00                	add    %al,(%rax)
+  803ee7:	00 50 11             	add    %dl,0x11(%rax)
+  803eea:	80 00 00             	addb   $0x0,(%rax)
+  803eed:	00 00                	add    %al,(%rax)
+  803eef:	00 50 11             	add    %dl,0x11(%rax)
+  803ef2:	80 00 00             	addb   $0x0,(%rax)
+  803ef5:	00 00                	add    %al,(%rax)
+  803ef7:	00 50 11             	add    %dl,0x11(%rax)
+  803efa:	80 00 00             	addb   $0x0,(%rax)
+  803efd:	00 00                	add    %al,(%rax)
+  803eff:	00 bf 0b 80 00 00    	add    %bh,0x800b(%rdi)
+  803f05:	00 00                	add    %al,(%rax)
+  803f07:	00 8e 0d 80 00 00    	add    %cl,0x800d(%rsi)
+  803f0d:	00 00                	add    %al,(%rax)
+  803f0f:	00 50 11             	add    %dl,0x11(%rax)
+  803f12:	80 00 00             	addb   $0x0,(%rax)
+  803f15:	00 00                	add    %al,(%rax)
+  803f17:	00 50 11             	add    %dl,0x11(%rax)
+  803f1a:	80 00 00             	addb   $0x0,(%rax)
+  803f1d:	00 00                	add    %al,(%rax)
+  803f1f:	00 50 11             	add    %dl,0x11(%rax)
+  803f22:	80 00 00             	addb   $0x0,(%rax)
+  803f25:	00 00                	add    %al,(%rax)
+  803f27:	00 50 11             	add    %dl,0x11(%rax)
+  803f2a:	80 00 00             	addb   $0x0,(%rax)
+  803f2d:	00 00                	add    %al,(%rax)
+  803f2f:	00 ee                	add    %ch,%dh
+  803f31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803f37:	00 50 11             	add    %dl,0x11(%rax)
+  803f3a:	80 00 00             	addb   $0x0,(%rax)
+  803f3d:	00 00                	add    %al,(%rax)
+  803f3f:	00 50 11             	add    %dl,0x11(%rax)
+  803f42:	80 00 00             	addb   $0x0,(%rax)
+  803f45:	00 00                	add    %al,(%rax)
+  803f47:	00 b4 0b 80 00 00 00 	add    %dh,0x80(%rbx,%rcx,1)
+  803f4e:	00 00                	add    %al,(%rax)
+  803f50:	50                   	push   %rax
+  803f51:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  803f57:	00 50 11             	add    %dl,0x11(%rax)
+  803f5a:	80 00 00             	addb   $0x0,(%rax)
+  803f5d:	00 00                	add    %al,(%rax)
+  803f5f:	00 36                	add    %dh,(%rsi)
+  803f61:	0f 80 00 00 00 00    	jo     803f67 <__rodata_start+0x5a7>
+  803f67:	00 00                	add    %al,(%rax)
+  803f69:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+  803f6f:	00 50 11             	add    %dl,0x11(%rax)
+  803f72:	80 00 00             	addb   $0x0,(%rax)
+  803f75:	00 00                	add    %al,(%rax)
+  803f77:	00 50 11             	add    %dl,0x11(%rax)
+  803f7a:	80 00 00             	addb   $0x0,(%rax)
+  803f7d:	00 00                	add    %al,(%rax)
+  803f7f:	00 85 0c 80 00 00    	add    %al,0x800c(%rbp)
+  803f85:	00 00                	add    %al,(%rax)
+  803f87:	00 50 11             	add    %dl,0x11(%rax)
+  803f8a:	80 00 00             	addb   $0x0,(%rax)
+  803f8d:	00 00                	add    %al,(%rax)
+  803f8f:	00 62 0e             	add    %ah,0xe(%rdx)
+  803f92:	80 00 00             	addb   $0x0,(%rax)
+  803f95:	00 00                	add    %al,(%rax)
+  803f97:	00 50 11             	add    %dl,0x11(%rax)
+  803f9a:	80 00 00             	addb   $0x0,(%rax)
+  803f9d:	00 00                	add    %al,(%rax)
+  803f9f:	00 50 11             	add    %dl,0x11(%rax)
+  803fa2:	80 00 00             	addb   $0x0,(%rax)
+  803fa5:	00 00                	add    %al,(%rax)
+  803fa7:	00 73 10             	add    %dh,0x10(%rbx)
+  803faa:	80 00 00             	addb   $0x0,(%rax)
+  803fad:	00 00                	add    %al,(%rax)
+  803faf:	00 50 11             	add    %dl,0x11(%rax)
+  803fb2:	80 00 00             	addb   $0x0,(%rax)
+  803fb5:	00 00                	add    %al,(%rax)
+  803fb7:	00 18                	add    %bl,(%rax)
+  803fb9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+	...
+
+0000000000803fc0 <error_string>:
+	...
+  803fc8:	75 3b 80 00 00 00 00 00 87 3b 80 00 00 00 00 00     u;.......;......
+  803fd8:	97 3b 80 00 00 00 00 00 a9 3b 80 00 00 00 00 00     .;.......;......
+  803fe8:	b7 3b 80 00 00 00 00 00 cb 3b 80 00 00 00 00 00     .;.......;......
+  803ff8:	e0 3b 80 00 00 00 00 00 f3 3b 80 00 00 00 00 00     .;.......;......
+  804008:	05 3c 80 00 00 00 00 00 19 3c 80 00 00 00 00 00     .<.......<......
+  804018:	29 3c 80 00 00 00 00 00 3c 3c 80 00 00 00 00 00     )<......<<......
+  804028:	53 3c 80 00 00 00 00 00 69 3c 80 00 00 00 00 00     S<......i<......
+  804038:	81 3c 80 00 00 00 00 00 99 3c 80 00 00 00 00 00     .<.......<......
+  804048:	a6 3c 80 00 00 00 00 00 70 40 80 00 00 00 00 00     .<......p@......
+  804058:	ba 3c 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .<..............
+  804068:	d2 3c 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .<......file is 
+  804078:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  804088:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  804098:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8040a8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8040b8:	6c 6c 2e 63 00 73 66 6f 72 6b 28 29 20 69 73 20     ll.c.sfork() is 
+  8040c8:	6e 6f 74 20 69 6d 70 6c 65 6d 65 6e 74 65 64 00     not implemented.
+  8040d8:	6c 69 62 2f 66 6f 72 6b 2e 63 00 0f 1f 44 00 00     lib/fork.c...D..
+  8040e8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8040f8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804108:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804118:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804128:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804138:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804148:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804158:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804168:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804178:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000804180 <devtab>:
+  804180:	40 50 80 00 00 00 00 00 80 50 80 00 00 00 00 00     @P.......P......
+  804190:	00 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  8041a0:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  8041b0:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  8041c0:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  8041d0:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  8041e0:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  8041f0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  804200:	45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20 77     Elf magic %08x w
+  804210:	61 6e 74 20 25 30 38 78 0a 00 61 73 73 65 72 74     ant %08x..assert
+  804220:	69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00 6c     ion failed: %s.l
+  804230:	69 62 2f 73 70 61 77 6e 2e 63 00 62 79 74 65 73     ib/spawn.c.bytes
+  804240:	5f 72 65 61 64 20 3d 3d 20 66 69 6c 65 73 7a 00     _read == filesz.
+  804250:	63 6f 70 79 5f 73 68 61 72 65 64 5f 72 65 67 69     copy_shared_regi
+  804260:	6f 6e 3a 20 25 69 00 73 79 73 5f 65 6e 76 5f 73     on: %i.sys_env_s
+  804270:	65 74 5f 74 72 61 70 66 72 61 6d 65 3a 20 25 69     et_trapframe: %i
+  804280:	00 73 79 73 5f 65 6e 76 5f 73 65 74 5f 73 74 61     .sys_env_set_sta
+  804290:	74 75 73 3a 20 25 69 00 3c 70 69 70 65 3e 00 6c     tus: %i.<pipe>.l
+  8042a0:	69 62 2f 70 69 70 65 2e 63 00 70 69 70 65 00 90     ib/pipe.c.pipe..
+  8042b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8042c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8042d0:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  8042e0:	69 62 2f 77 61 69 74 2e 63 00 69 70 63 5f 73 65     ib/wait.c.ipc_se
+  8042f0:	6e 64 3a 20 66 61 69 6c 65 64 20 74 6f 20 73 65     nd: failed to se
+  804300:	6e 64 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     nd.lib/ipc.c.f..
+  804310:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804320:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804330:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804340:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804350:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804360:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804370:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804380:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804390:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8043a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8043b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8043c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8043d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8043e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8043f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804400:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804410:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804420:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804430:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804440:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804450:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804460:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804470:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804480:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804490:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8044a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8044b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8044c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8044d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8044e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8044f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804500:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804510:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804520:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804530:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804540:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804550:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804560:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804570:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804580:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804590:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8045a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8045b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8045c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8045d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8045e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8045f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804600:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804610:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804620:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804630:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804640:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804650:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804660:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804670:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804680:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804690:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8046a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8046b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8046c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8046d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8046e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8046f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804700:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804710:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804720:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804730:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804740:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804750:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804760:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804770:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804780:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804790:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8047a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8047b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8047c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8047d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8047e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8047f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8048a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8048b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8048c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8048d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8048e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8048f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8049b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8049c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8049d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8049e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
@@ -0,0 +1,7019 @@
+
+obj/user/testsig:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 44 09 00 00       	call   800967 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler_term>:
+
+volatile sig_atomic_t termcount = 0;
+
+static void
+handler_term(int signo) {
+    ++termcount;
+  800025:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80002c:	00 00 00 
+  80002f:	8b 02                	mov    (%rdx),%eax
+  800031:	83 c0 01             	add    $0x1,%eax
+  800034:	89 02                	mov    %eax,(%rdx)
+}
+  800036:	c3                   	ret
+
+0000000000800037 <handler_chld>:
+    assert(signo == SIGCHLD);
+  800037:	83 ff 11             	cmp    $0x11,%edi
+  80003a:	75 12                	jne    80004e <handler_chld+0x17>
+    ++chldcntr;
+  80003c:	48 ba 10 60 80 00 00 	movabs $0x806010,%rdx
+  800043:	00 00 00 
+  800046:	8b 02                	mov    (%rdx),%eax
+  800048:	83 c0 01             	add    $0x1,%eax
+  80004b:	89 02                	mov    %eax,(%rdx)
+  80004d:	c3                   	ret
+handler_chld(int signo, siginfo_t * info, void * ctx) {
+  80004e:	55                   	push   %rbp
+  80004f:	48 89 e5             	mov    %rsp,%rbp
+    assert(signo == SIGCHLD);
+  800052:	48 b9 b0 39 80 00 00 	movabs $0x8039b0,%rcx
+  800059:	00 00 00 
+  80005c:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  800063:	00 00 00 
+  800066:	be 0b 00 00 00       	mov    $0xb,%esi
+  80006b:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  800072:	00 00 00 
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007a:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  800081:	00 00 00 
+  800084:	41 ff d0             	call   *%r8
+
+0000000000800087 <handler_defer>:
+handler_defer(int signo) {
+  800087:	55                   	push   %rbp
+  800088:	48 89 e5             	mov    %rsp,%rbp
+  80008b:	53                   	push   %rbx
+  80008c:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(depth == 0);
+  800090:	a1 0c 60 80 00 00 00 	movabs 0x80600c,%eax
+  800097:	00 00 
+  800099:	85 c0                	test   %eax,%eax
+  80009b:	75 14                	jne    8000b1 <handler_defer+0x2a>
+    if (10 < intcount)
+  80009d:	a1 04 60 80 00 00 00 	movabs 0x806004,%eax
+  8000a4:	00 00 
+  8000a6:	83 f8 0a             	cmp    $0xa,%eax
+  8000a9:	7e 3b                	jle    8000e6 <handler_defer+0x5f>
+}
+  8000ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000af:	c9                   	leave
+  8000b0:	c3                   	ret
+    assert(depth == 0);
+  8000b1:	48 b9 e5 39 80 00 00 	movabs $0x8039e5,%rcx
+  8000b8:	00 00 00 
+  8000bb:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  8000c2:	00 00 00 
+  8000c5:	be 23 00 00 00       	mov    $0x23,%esi
+  8000ca:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  8000d1:	00 00 00 
+  8000d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d9:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  8000e0:	00 00 00 
+  8000e3:	41 ff d0             	call   *%r8
+    ++depth;
+  8000e6:	48 bb 0c 60 80 00 00 	movabs $0x80600c,%rbx
+  8000ed:	00 00 00 
+  8000f0:	8b 03                	mov    (%rbx),%eax
+  8000f2:	83 c0 01             	add    $0x1,%eax
+  8000f5:	89 03                	mov    %eax,(%rbx)
+    sigqueue(0, 2, sv);
+  8000f7:	48 b8 18 60 80 00 00 	movabs $0x806018,%rax
+  8000fe:	00 00 00 
+  800101:	48 8b 10             	mov    (%rax),%rdx
+  800104:	be 02 00 00 00       	mov    $0x2,%esi
+  800109:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010e:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  800115:	00 00 00 
+  800118:	ff d0                	call   *%rax
+    sys_yield();
+  80011a:	48 b8 c7 19 80 00 00 	movabs $0x8019c7,%rax
+  800121:	00 00 00 
+  800124:	ff d0                	call   *%rax
+    --depth;
+  800126:	8b 03                	mov    (%rbx),%eax
+  800128:	83 e8 01             	sub    $0x1,%eax
+  80012b:	89 03                	mov    %eax,(%rbx)
+    ++intcount;
+  80012d:	48 ba 04 60 80 00 00 	movabs $0x806004,%rdx
+  800134:	00 00 00 
+  800137:	8b 02                	mov    (%rdx),%eax
+  800139:	83 c0 01             	add    $0x1,%eax
+  80013c:	89 02                	mov    %eax,(%rdx)
+  80013e:	e9 68 ff ff ff       	jmp    8000ab <handler_defer+0x24>
+
+0000000000800143 <handler_nodefer>:
+    if (10 < depth) {
+  800143:	a1 0c 60 80 00 00 00 	movabs 0x80600c,%eax
+  80014a:	00 00 
+  80014c:	83 f8 0a             	cmp    $0xa,%eax
+  80014f:	7e 11                	jle    800162 <handler_nodefer+0x1f>
+        reached_max_depth = 1;
+  800151:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800158:	00 00 00 
+  80015b:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        return;
+  800161:	c3                   	ret
+handler_nodefer(int signo) {
+  800162:	55                   	push   %rbp
+  800163:	48 89 e5             	mov    %rsp,%rbp
+  800166:	53                   	push   %rbx
+  800167:	48 83 ec 08          	sub    $0x8,%rsp
+    ++depth;
+  80016b:	48 bb 0c 60 80 00 00 	movabs $0x80600c,%rbx
+  800172:	00 00 00 
+  800175:	8b 03                	mov    (%rbx),%eax
+  800177:	83 c0 01             	add    $0x1,%eax
+  80017a:	89 03                	mov    %eax,(%rbx)
+    sigqueue(0, 2, sv);
+  80017c:	48 b8 18 60 80 00 00 	movabs $0x806018,%rax
+  800183:	00 00 00 
+  800186:	48 8b 10             	mov    (%rax),%rdx
+  800189:	be 02 00 00 00       	mov    $0x2,%esi
+  80018e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800193:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  80019a:	00 00 00 
+  80019d:	ff d0                	call   *%rax
+    sys_yield();
+  80019f:	48 b8 c7 19 80 00 00 	movabs $0x8019c7,%rax
+  8001a6:	00 00 00 
+  8001a9:	ff d0                	call   *%rax
+    --depth;
+  8001ab:	8b 03                	mov    (%rbx),%eax
+  8001ad:	83 e8 01             	sub    $0x1,%eax
+  8001b0:	89 03                	mov    %eax,(%rbx)
+}
+  8001b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001b6:	c9                   	leave
+  8001b7:	c3                   	ret
+
+00000000008001b8 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8001b8:	55                   	push   %rbp
+  8001b9:	48 89 e5             	mov    %rsp,%rbp
+  8001bc:	41 55                	push   %r13
+  8001be:	41 54                	push   %r12
+  8001c0:	53                   	push   %rbx
+  8001c1:	48 83 ec 38          	sub    $0x38,%rsp
+    sv.sival_ptr = 0;
+  8001c5:	48 b8 18 60 80 00 00 	movabs $0x806018,%rax
+  8001cc:	00 00 00 
+  8001cf:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+    int err;
+
+    // test SA_RESETHAND
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+  8001d6:	ba 10 00 00 00       	mov    $0x10,%edx
+  8001db:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e0:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8001e4:	48 b8 f2 15 80 00 00 	movabs $0x8015f2,%rax
+  8001eb:	00 00 00 
+  8001ee:	ff d0                	call   *%rax
+    sa.sa_sigaction = handler_chld;
+  8001f0:	48 b8 37 00 80 00 00 	movabs $0x800037,%rax
+  8001f7:	00 00 00 
+  8001fa:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    sa.sa_flags = SA_RESETHAND | SA_SIGINFO;
+  8001fe:	c7 45 dc 04 00 00 80 	movl   $0x80000004,-0x24(%rbp)
+    err = sigaction(SIGCHLD, &sa, NULL);
+  800205:	ba 00 00 00 00       	mov    $0x0,%edx
+  80020a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80020e:	bf 11 00 00 00       	mov    $0x11,%edi
+  800213:	48 b8 16 32 80 00 00 	movabs $0x803216,%rax
+  80021a:	00 00 00 
+  80021d:	ff d0                	call   *%rax
+    assert(err == 0);
+  80021f:	85 c0                	test   %eax,%eax
+  800221:	0f 85 21 03 00 00    	jne    800548 <umain+0x390>
+
+    err = sigqueue(CURENVID, SIGCHLD, sv);
+  800227:	48 b8 18 60 80 00 00 	movabs $0x806018,%rax
+  80022e:	00 00 00 
+  800231:	48 8b 10             	mov    (%rax),%rdx
+  800234:	be 11 00 00 00       	mov    $0x11,%esi
+  800239:	bf 00 00 00 00       	mov    $0x0,%edi
+  80023e:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  800245:	00 00 00 
+  800248:	ff d0                	call   *%rax
+    assert(err == 0);
+  80024a:	85 c0                	test   %eax,%eax
+  80024c:	0f 85 2b 03 00 00    	jne    80057d <umain+0x3c5>
+    err = sigqueue(CURENVID, SIGCHLD, sv);  // ign
+  800252:	48 b8 18 60 80 00 00 	movabs $0x806018,%rax
+  800259:	00 00 00 
+  80025c:	48 8b 10             	mov    (%rax),%rdx
+  80025f:	be 11 00 00 00       	mov    $0x11,%esi
+  800264:	bf 00 00 00 00       	mov    $0x0,%edi
+  800269:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  800270:	00 00 00 
+  800273:	ff d0                	call   *%rax
+    assert(err == 0);
+  800275:	85 c0                	test   %eax,%eax
+  800277:	0f 85 35 03 00 00    	jne    8005b2 <umain+0x3fa>
+    assert(chldcntr == 1);
+  80027d:	a1 10 60 80 00 00 00 	movabs 0x806010,%eax
+  800284:	00 00 
+  800286:	83 f8 01             	cmp    $0x1,%eax
+  800289:	0f 85 58 03 00 00    	jne    8005e7 <umain+0x42f>
+
+    struct sigaction old_sa;
+    memset(&sa, 0, sizeof(sa));
+  80028f:	ba 10 00 00 00       	mov    $0x10,%edx
+  800294:	be 00 00 00 00       	mov    $0x0,%esi
+  800299:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80029d:	48 b8 f2 15 80 00 00 	movabs $0x8015f2,%rax
+  8002a4:	00 00 00 
+  8002a7:	ff d0                	call   *%rax
+    err = sigaction(SIGCHLD, &sa, &old_sa);
+  8002a9:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  8002ad:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8002b1:	bf 11 00 00 00       	mov    $0x11,%edi
+  8002b6:	48 b8 16 32 80 00 00 	movabs $0x803216,%rax
+  8002bd:	00 00 00 
+  8002c0:	ff d0                	call   *%rax
+    assert(err == 0);
+  8002c2:	85 c0                	test   %eax,%eax
+  8002c4:	0f 85 52 03 00 00    	jne    80061c <umain+0x464>
+    assert((old_sa.sa_flags & SA_SIGINFO) == 0);
+  8002ca:	f6 45 cc 04          	testb  $0x4,-0x34(%rbp)
+  8002ce:	0f 85 7d 03 00 00    	jne    800651 <umain+0x499>
+    assert(old_sa.sa_handler == SIG_IGN);
+  8002d4:	48 83 7d c0 01       	cmpq   $0x1,-0x40(%rbp)
+  8002d9:	0f 85 a7 03 00 00    	jne    800686 <umain+0x4ce>
+
+
+    // test SA_NODEFER and nested signals
+    sa.sa_handler = handler_nodefer;
+  8002df:	48 b8 43 01 80 00 00 	movabs $0x800143,%rax
+  8002e6:	00 00 00 
+  8002e9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    sa.sa_flags = SA_NODEFER;
+  8002ed:	c7 45 dc 00 00 00 40 	movl   $0x40000000,-0x24(%rbp)
+    err = sigaction(SIGINT, &sa, &old_sa);
+  8002f4:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  8002f8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8002fc:	bf 02 00 00 00       	mov    $0x2,%edi
+  800301:	48 b8 16 32 80 00 00 	movabs $0x803216,%rax
+  800308:	00 00 00 
+  80030b:	ff d0                	call   *%rax
+    assert(err == 0);
+  80030d:	85 c0                	test   %eax,%eax
+  80030f:	0f 85 a6 03 00 00    	jne    8006bb <umain+0x503>
+    err = sigqueue(CURENVID, SIGINT, sv);
+  800315:	48 b8 18 60 80 00 00 	movabs $0x806018,%rax
+  80031c:	00 00 00 
+  80031f:	48 8b 10             	mov    (%rax),%rdx
+  800322:	be 02 00 00 00       	mov    $0x2,%esi
+  800327:	bf 00 00 00 00       	mov    $0x0,%edi
+  80032c:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  800333:	00 00 00 
+  800336:	ff d0                	call   *%rax
+    assert(err == 0);
+  800338:	85 c0                	test   %eax,%eax
+  80033a:	0f 85 b0 03 00 00    	jne    8006f0 <umain+0x538>
+    assert(depth == 0);
+  800340:	a1 0c 60 80 00 00 00 	movabs 0x80600c,%eax
+  800347:	00 00 
+  800349:	85 c0                	test   %eax,%eax
+  80034b:	0f 85 d4 03 00 00    	jne    800725 <umain+0x56d>
+    assert(reached_max_depth);
+  800351:	a1 08 60 80 00 00 00 	movabs 0x806008,%eax
+  800358:	00 00 
+  80035a:	85 c0                	test   %eax,%eax
+  80035c:	0f 84 f8 03 00 00    	je     80075a <umain+0x5a2>
+    reached_max_depth = 0;
+  800362:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800369:	00 00 00 
+  80036c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    // signal is blocked by default
+    sa.sa_handler = handler_defer;
+  800372:	48 b8 87 00 80 00 00 	movabs $0x800087,%rax
+  800379:	00 00 00 
+  80037c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    sa.sa_flags = 0;
+  800380:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+    err = sigaction(SIGINT, &sa, &old_sa);
+  800387:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  80038b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80038f:	bf 02 00 00 00       	mov    $0x2,%edi
+  800394:	48 b8 16 32 80 00 00 	movabs $0x803216,%rax
+  80039b:	00 00 00 
+  80039e:	ff d0                	call   *%rax
+    assert(err == 0);
+  8003a0:	85 c0                	test   %eax,%eax
+  8003a2:	0f 85 e2 03 00 00    	jne    80078a <umain+0x5d2>
+    assert(old_sa.sa_handler == handler_nodefer);
+  8003a8:	48 b8 43 01 80 00 00 	movabs $0x800143,%rax
+  8003af:	00 00 00 
+  8003b2:	48 39 45 c0          	cmp    %rax,-0x40(%rbp)
+  8003b6:	0f 85 03 04 00 00    	jne    8007bf <umain+0x607>
+    assert(old_sa.sa_flags == SA_NODEFER);
+  8003bc:	81 7d cc 00 00 00 40 	cmpl   $0x40000000,-0x34(%rbp)
+  8003c3:	0f 85 2b 04 00 00    	jne    8007f4 <umain+0x63c>
+    err = sigqueue(CURENVID, SIGINT, sv);
+  8003c9:	48 b8 18 60 80 00 00 	movabs $0x806018,%rax
+  8003d0:	00 00 00 
+  8003d3:	48 8b 10             	mov    (%rax),%rdx
+  8003d6:	be 02 00 00 00       	mov    $0x2,%esi
+  8003db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003e0:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  8003e7:	00 00 00 
+  8003ea:	ff d0                	call   *%rax
+    assert(err == 0);
+  8003ec:	85 c0                	test   %eax,%eax
+  8003ee:	0f 85 35 04 00 00    	jne    800829 <umain+0x671>
+    assert(depth == 0);
+  8003f4:	a1 0c 60 80 00 00 00 	movabs 0x80600c,%eax
+  8003fb:	00 00 
+  8003fd:	85 c0                	test   %eax,%eax
+  8003ff:	0f 85 59 04 00 00    	jne    80085e <umain+0x6a6>
+    assert(intcount == 11);
+  800405:	a1 04 60 80 00 00 00 	movabs 0x806004,%eax
+  80040c:	00 00 
+  80040e:	83 f8 0b             	cmp    $0xb,%eax
+  800411:	0f 85 7c 04 00 00    	jne    800893 <umain+0x6db>
+    assert(!reached_max_depth);
+  800417:	a1 08 60 80 00 00 00 	movabs 0x806008,%eax
+  80041e:	00 00 
+  800420:	85 c0                	test   %eax,%eax
+  800422:	0f 85 a0 04 00 00    	jne    8008c8 <umain+0x710>
+
+
+    // test sigwait removes only one signal
+    sa.sa_handler = handler_term;
+  800428:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80042f:	00 00 00 
+  800432:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    err = sigaction(SIGTERM, &sa, NULL);
+  800436:	ba 00 00 00 00       	mov    $0x0,%edx
+  80043b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80043f:	bf 0f 00 00 00       	mov    $0xf,%edi
+  800444:	48 b8 16 32 80 00 00 	movabs $0x803216,%rax
+  80044b:	00 00 00 
+  80044e:	ff d0                	call   *%rax
+    assert(err == 0);
+  800450:	85 c0                	test   %eax,%eax
+  800452:	0f 85 a5 04 00 00    	jne    8008fd <umain+0x745>
+    sigset_t set = SIGNAL_FLAG(SIGTERM);
+  800458:	c7 45 bc 00 80 00 00 	movl   $0x8000,-0x44(%rbp)
+    sigprocmask(SIG_BLOCK, &set, NULL);
+  80045f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800464:	48 8d 75 bc          	lea    -0x44(%rbp),%rsi
+  800468:	bf 01 00 00 00       	mov    $0x1,%edi
+  80046d:	49 bd 6b 32 80 00 00 	movabs $0x80326b,%r13
+  800474:	00 00 00 
+  800477:	41 ff d5             	call   *%r13
+    sigqueue(CURENVID, SIGTERM, sv);
+  80047a:	49 bc 18 60 80 00 00 	movabs $0x806018,%r12
+  800481:	00 00 00 
+  800484:	49 8b 14 24          	mov    (%r12),%rdx
+  800488:	be 0f 00 00 00       	mov    $0xf,%esi
+  80048d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800492:	48 bb f2 31 80 00 00 	movabs $0x8031f2,%rbx
+  800499:	00 00 00 
+  80049c:	ff d3                	call   *%rbx
+    sigqueue(CURENVID, SIGTERM, sv);
+  80049e:	49 8b 14 24          	mov    (%r12),%rdx
+  8004a2:	be 0f 00 00 00       	mov    $0xf,%esi
+  8004a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004ac:	ff d3                	call   *%rbx
+    sigqueue(CURENVID, SIGTERM, sv);
+  8004ae:	49 8b 14 24          	mov    (%r12),%rdx
+  8004b2:	be 0f 00 00 00       	mov    $0xf,%esi
+  8004b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004bc:	ff d3                	call   *%rbx
+    sigwait(&set, NULL);
+  8004be:	be 00 00 00 00       	mov    $0x0,%esi
+  8004c3:	48 8d 7d bc          	lea    -0x44(%rbp),%rdi
+  8004c7:	48 b8 04 32 80 00 00 	movabs $0x803204,%rax
+  8004ce:	00 00 00 
+  8004d1:	ff d0                	call   *%rax
+    sigqueue(CURENVID, SIGTERM, sv);
+  8004d3:	49 8b 14 24          	mov    (%r12),%rdx
+  8004d7:	be 0f 00 00 00       	mov    $0xf,%esi
+  8004dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004e1:	ff d3                	call   *%rbx
+    sigprocmask(SIG_UNBLOCK, &set, NULL);
+  8004e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004e8:	48 8d 75 bc          	lea    -0x44(%rbp),%rsi
+  8004ec:	bf 02 00 00 00       	mov    $0x2,%edi
+  8004f1:	41 ff d5             	call   *%r13
+    sigqueue(CURENVID, SIGTERM, sv);
+  8004f4:	49 8b 14 24          	mov    (%r12),%rdx
+  8004f8:	be 0f 00 00 00       	mov    $0xf,%esi
+  8004fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800502:	ff d3                	call   *%rbx
+    sys_yield();
+  800504:	48 b8 c7 19 80 00 00 	movabs $0x8019c7,%rax
+  80050b:	00 00 00 
+  80050e:	ff d0                	call   *%rax
+    assert(termcount == 4);
+  800510:	a1 00 60 80 00 00 00 	movabs 0x806000,%eax
+  800517:	00 00 
+  800519:	83 f8 04             	cmp    $0x4,%eax
+  80051c:	0f 85 10 04 00 00    	jne    800932 <umain+0x77a>
+
+    cprintf("Test finished\n");
+  800522:	48 bf 73 3a 80 00 00 	movabs $0x803a73,%rdi
+  800529:	00 00 00 
+  80052c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800531:	48 ba 81 0b 80 00 00 	movabs $0x800b81,%rdx
+  800538:	00 00 00 
+  80053b:	ff d2                	call   *%rdx
+  80053d:	48 83 c4 38          	add    $0x38,%rsp
+  800541:	5b                   	pop    %rbx
+  800542:	41 5c                	pop    %r12
+  800544:	41 5d                	pop    %r13
+  800546:	5d                   	pop    %rbp
+  800547:	c3                   	ret
+    assert(err == 0);
+  800548:	48 b9 f0 39 80 00 00 	movabs $0x8039f0,%rcx
+  80054f:	00 00 00 
+  800552:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  800559:	00 00 00 
+  80055c:	be 40 00 00 00       	mov    $0x40,%esi
+  800561:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  800568:	00 00 00 
+  80056b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800570:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  800577:	00 00 00 
+  80057a:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  80057d:	48 b9 f0 39 80 00 00 	movabs $0x8039f0,%rcx
+  800584:	00 00 00 
+  800587:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  80058e:	00 00 00 
+  800591:	be 43 00 00 00       	mov    $0x43,%esi
+  800596:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  80059d:	00 00 00 
+  8005a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a5:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  8005ac:	00 00 00 
+  8005af:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  8005b2:	48 b9 f0 39 80 00 00 	movabs $0x8039f0,%rcx
+  8005b9:	00 00 00 
+  8005bc:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  8005c3:	00 00 00 
+  8005c6:	be 45 00 00 00       	mov    $0x45,%esi
+  8005cb:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  8005d2:	00 00 00 
+  8005d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005da:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  8005e1:	00 00 00 
+  8005e4:	41 ff d0             	call   *%r8
+    assert(chldcntr == 1);
+  8005e7:	48 b9 f9 39 80 00 00 	movabs $0x8039f9,%rcx
+  8005ee:	00 00 00 
+  8005f1:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  8005f8:	00 00 00 
+  8005fb:	be 46 00 00 00       	mov    $0x46,%esi
+  800600:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  800607:	00 00 00 
+  80060a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060f:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  800616:	00 00 00 
+  800619:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  80061c:	48 b9 f0 39 80 00 00 	movabs $0x8039f0,%rcx
+  800623:	00 00 00 
+  800626:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  80062d:	00 00 00 
+  800630:	be 4b 00 00 00       	mov    $0x4b,%esi
+  800635:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  80063c:	00 00 00 
+  80063f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800644:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  80064b:	00 00 00 
+  80064e:	41 ff d0             	call   *%r8
+    assert((old_sa.sa_flags & SA_SIGINFO) == 0);
+  800651:	48 b9 88 3a 80 00 00 	movabs $0x803a88,%rcx
+  800658:	00 00 00 
+  80065b:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  800662:	00 00 00 
+  800665:	be 4c 00 00 00       	mov    $0x4c,%esi
+  80066a:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  800671:	00 00 00 
+  800674:	b8 00 00 00 00       	mov    $0x0,%eax
+  800679:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  800680:	00 00 00 
+  800683:	41 ff d0             	call   *%r8
+    assert(old_sa.sa_handler == SIG_IGN);
+  800686:	48 b9 07 3a 80 00 00 	movabs $0x803a07,%rcx
+  80068d:	00 00 00 
+  800690:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  800697:	00 00 00 
+  80069a:	be 4d 00 00 00       	mov    $0x4d,%esi
+  80069f:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  8006a6:	00 00 00 
+  8006a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ae:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  8006b5:	00 00 00 
+  8006b8:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  8006bb:	48 b9 f0 39 80 00 00 	movabs $0x8039f0,%rcx
+  8006c2:	00 00 00 
+  8006c5:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  8006cc:	00 00 00 
+  8006cf:	be 54 00 00 00       	mov    $0x54,%esi
+  8006d4:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  8006db:	00 00 00 
+  8006de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e3:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  8006ea:	00 00 00 
+  8006ed:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  8006f0:	48 b9 f0 39 80 00 00 	movabs $0x8039f0,%rcx
+  8006f7:	00 00 00 
+  8006fa:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  800701:	00 00 00 
+  800704:	be 56 00 00 00       	mov    $0x56,%esi
+  800709:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  800710:	00 00 00 
+  800713:	b8 00 00 00 00       	mov    $0x0,%eax
+  800718:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  80071f:	00 00 00 
+  800722:	41 ff d0             	call   *%r8
+    assert(depth == 0);
+  800725:	48 b9 e5 39 80 00 00 	movabs $0x8039e5,%rcx
+  80072c:	00 00 00 
+  80072f:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  800736:	00 00 00 
+  800739:	be 57 00 00 00       	mov    $0x57,%esi
+  80073e:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  800745:	00 00 00 
+  800748:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074d:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  800754:	00 00 00 
+  800757:	41 ff d0             	call   *%r8
+    assert(reached_max_depth);
+  80075a:	48 b9 52 3a 80 00 00 	movabs $0x803a52,%rcx
+  800761:	00 00 00 
+  800764:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  80076b:	00 00 00 
+  80076e:	be 58 00 00 00       	mov    $0x58,%esi
+  800773:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  80077a:	00 00 00 
+  80077d:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  800784:	00 00 00 
+  800787:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  80078a:	48 b9 f0 39 80 00 00 	movabs $0x8039f0,%rcx
+  800791:	00 00 00 
+  800794:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  80079b:	00 00 00 
+  80079e:	be 5f 00 00 00       	mov    $0x5f,%esi
+  8007a3:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  8007aa:	00 00 00 
+  8007ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b2:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  8007b9:	00 00 00 
+  8007bc:	41 ff d0             	call   *%r8
+    assert(old_sa.sa_handler == handler_nodefer);
+  8007bf:	48 b9 b0 3a 80 00 00 	movabs $0x803ab0,%rcx
+  8007c6:	00 00 00 
+  8007c9:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  8007d0:	00 00 00 
+  8007d3:	be 60 00 00 00       	mov    $0x60,%esi
+  8007d8:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  8007df:	00 00 00 
+  8007e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e7:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  8007ee:	00 00 00 
+  8007f1:	41 ff d0             	call   *%r8
+    assert(old_sa.sa_flags == SA_NODEFER);
+  8007f4:	48 b9 24 3a 80 00 00 	movabs $0x803a24,%rcx
+  8007fb:	00 00 00 
+  8007fe:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  800805:	00 00 00 
+  800808:	be 61 00 00 00       	mov    $0x61,%esi
+  80080d:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  800814:	00 00 00 
+  800817:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081c:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  800823:	00 00 00 
+  800826:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  800829:	48 b9 f0 39 80 00 00 	movabs $0x8039f0,%rcx
+  800830:	00 00 00 
+  800833:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  80083a:	00 00 00 
+  80083d:	be 63 00 00 00       	mov    $0x63,%esi
+  800842:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  800849:	00 00 00 
+  80084c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800851:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  800858:	00 00 00 
+  80085b:	41 ff d0             	call   *%r8
+    assert(depth == 0);
+  80085e:	48 b9 e5 39 80 00 00 	movabs $0x8039e5,%rcx
+  800865:	00 00 00 
+  800868:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  80086f:	00 00 00 
+  800872:	be 64 00 00 00       	mov    $0x64,%esi
+  800877:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  80087e:	00 00 00 
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+  800886:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  80088d:	00 00 00 
+  800890:	41 ff d0             	call   *%r8
+    assert(intcount == 11);
+  800893:	48 b9 42 3a 80 00 00 	movabs $0x803a42,%rcx
+  80089a:	00 00 00 
+  80089d:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  8008a4:	00 00 00 
+  8008a7:	be 65 00 00 00       	mov    $0x65,%esi
+  8008ac:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  8008b3:	00 00 00 
+  8008b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008bb:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  8008c2:	00 00 00 
+  8008c5:	41 ff d0             	call   *%r8
+    assert(!reached_max_depth);
+  8008c8:	48 b9 51 3a 80 00 00 	movabs $0x803a51,%rcx
+  8008cf:	00 00 00 
+  8008d2:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  8008d9:	00 00 00 
+  8008dc:	be 66 00 00 00       	mov    $0x66,%esi
+  8008e1:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  8008e8:	00 00 00 
+  8008eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f0:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  8008f7:	00 00 00 
+  8008fa:	41 ff d0             	call   *%r8
+    assert(err == 0);
+  8008fd:	48 b9 f0 39 80 00 00 	movabs $0x8039f0,%rcx
+  800904:	00 00 00 
+  800907:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  80090e:	00 00 00 
+  800911:	be 6c 00 00 00       	mov    $0x6c,%esi
+  800916:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  80091d:	00 00 00 
+  800920:	b8 00 00 00 00       	mov    $0x0,%eax
+  800925:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  80092c:	00 00 00 
+  80092f:	41 ff d0             	call   *%r8
+    assert(termcount == 4);
+  800932:	48 b9 64 3a 80 00 00 	movabs $0x803a64,%rcx
+  800939:	00 00 00 
+  80093c:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  800943:	00 00 00 
+  800946:	be 77 00 00 00       	mov    $0x77,%esi
+  80094b:	48 bf d6 39 80 00 00 	movabs $0x8039d6,%rdi
+  800952:	00 00 00 
+  800955:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095a:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  800961:	00 00 00 
+  800964:	41 ff d0             	call   *%r8
+
+0000000000800967 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800967:	55                   	push   %rbp
+  800968:	48 89 e5             	mov    %rsp,%rbp
+  80096b:	41 56                	push   %r14
+  80096d:	41 55                	push   %r13
+  80096f:	41 54                	push   %r12
+  800971:	53                   	push   %rbx
+  800972:	41 89 fd             	mov    %edi,%r13d
+  800975:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800978:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  80097f:	00 00 00 
+  800982:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  800989:	00 00 00 
+  80098c:	48 39 c2             	cmp    %rax,%rdx
+  80098f:	73 17                	jae    8009a8 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800991:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800994:	49 89 c4             	mov    %rax,%r12
+  800997:	48 83 c3 08          	add    $0x8,%rbx
+  80099b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a0:	ff 53 f8             	call   *-0x8(%rbx)
+  8009a3:	4c 39 e3             	cmp    %r12,%rbx
+  8009a6:	72 ef                	jb     800997 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  8009a8:	48 b8 96 19 80 00 00 	movabs $0x801996,%rax
+  8009af:	00 00 00 
+  8009b2:	ff d0                	call   *%rax
+  8009b4:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  8009b7:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8009be:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8009c5:	00 00 00 
+  8009c8:	48 01 d0             	add    %rdx,%rax
+  8009cb:	48 a3 20 60 80 00 00 	movabs %rax,0x806020
+  8009d2:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8009d5:	45 85 ed             	test   %r13d,%r13d
+  8009d8:	7e 0d                	jle    8009e7 <libmain+0x80>
+  8009da:	49 8b 06             	mov    (%r14),%rax
+  8009dd:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8009e4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8009e7:	4c 89 f6             	mov    %r14,%rsi
+  8009ea:	44 89 ef             	mov    %r13d,%edi
+  8009ed:	48 b8 b8 01 80 00 00 	movabs $0x8001b8,%rax
+  8009f4:	00 00 00 
+  8009f7:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8009f9:	48 b8 0e 0a 80 00 00 	movabs $0x800a0e,%rax
+  800a00:	00 00 00 
+  800a03:	ff d0                	call   *%rax
+#endif
+}
+  800a05:	5b                   	pop    %rbx
+  800a06:	41 5c                	pop    %r12
+  800a08:	41 5d                	pop    %r13
+  800a0a:	41 5e                	pop    %r14
+  800a0c:	5d                   	pop    %rbp
+  800a0d:	c3                   	ret
+
+0000000000800a0e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800a0e:	55                   	push   %rbp
+  800a0f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800a12:	48 b8 1e 22 80 00 00 	movabs $0x80221e,%rax
+  800a19:	00 00 00 
+  800a1c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800a1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a23:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  800a2a:	00 00 00 
+  800a2d:	ff d0                	call   *%rax
+}
+  800a2f:	5d                   	pop    %rbp
+  800a30:	c3                   	ret
+
+0000000000800a31 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800a31:	55                   	push   %rbp
+  800a32:	48 89 e5             	mov    %rsp,%rbp
+  800a35:	41 56                	push   %r14
+  800a37:	41 55                	push   %r13
+  800a39:	41 54                	push   %r12
+  800a3b:	53                   	push   %rbx
+  800a3c:	48 83 ec 50          	sub    $0x50,%rsp
+  800a40:	49 89 fc             	mov    %rdi,%r12
+  800a43:	41 89 f5             	mov    %esi,%r13d
+  800a46:	48 89 d3             	mov    %rdx,%rbx
+  800a49:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800a4d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800a51:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a55:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800a5c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a60:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800a64:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800a68:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800a6c:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800a73:	00 00 00 
+  800a76:	4c 8b 30             	mov    (%rax),%r14
+  800a79:	48 b8 96 19 80 00 00 	movabs $0x801996,%rax
+  800a80:	00 00 00 
+  800a83:	ff d0                	call   *%rax
+  800a85:	89 c6                	mov    %eax,%esi
+  800a87:	45 89 e8             	mov    %r13d,%r8d
+  800a8a:	4c 89 e1             	mov    %r12,%rcx
+  800a8d:	4c 89 f2             	mov    %r14,%rdx
+  800a90:	48 bf e0 3a 80 00 00 	movabs $0x803ae0,%rdi
+  800a97:	00 00 00 
+  800a9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a9f:	49 bc 81 0b 80 00 00 	movabs $0x800b81,%r12
+  800aa6:	00 00 00 
+  800aa9:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800aac:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800ab0:	48 89 df             	mov    %rbx,%rdi
+  800ab3:	48 b8 1d 0b 80 00 00 	movabs $0x800b1d,%rax
+  800aba:	00 00 00 
+  800abd:	ff d0                	call   *%rax
+    cprintf("\n");
+  800abf:	48 bf 80 3a 80 00 00 	movabs $0x803a80,%rdi
+  800ac6:	00 00 00 
+  800ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ace:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800ad1:	cc                   	int3
+  800ad2:	eb fd                	jmp    800ad1 <_panic+0xa0>
+
+0000000000800ad4 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800ad4:	55                   	push   %rbp
+  800ad5:	48 89 e5             	mov    %rsp,%rbp
+  800ad8:	53                   	push   %rbx
+  800ad9:	48 83 ec 08          	sub    $0x8,%rsp
+  800add:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800ae0:	8b 06                	mov    (%rsi),%eax
+  800ae2:	8d 50 01             	lea    0x1(%rax),%edx
+  800ae5:	89 16                	mov    %edx,(%rsi)
+  800ae7:	48 98                	cltq
+  800ae9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800aee:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800af4:	74 0a                	je     800b00 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800af6:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800afa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800afe:	c9                   	leave
+  800aff:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800b00:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800b04:	be ff 00 00 00       	mov    $0xff,%esi
+  800b09:	48 b8 cd 18 80 00 00 	movabs $0x8018cd,%rax
+  800b10:	00 00 00 
+  800b13:	ff d0                	call   *%rax
+        state->offset = 0;
+  800b15:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800b1b:	eb d9                	jmp    800af6 <putch+0x22>
+
+0000000000800b1d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800b1d:	55                   	push   %rbp
+  800b1e:	48 89 e5             	mov    %rsp,%rbp
+  800b21:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800b28:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800b2b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800b32:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800b37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800b3f:	48 89 f1             	mov    %rsi,%rcx
+  800b42:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800b49:	48 bf d4 0a 80 00 00 	movabs $0x800ad4,%rdi
+  800b50:	00 00 00 
+  800b53:	48 b8 d1 0c 80 00 00 	movabs $0x800cd1,%rax
+  800b5a:	00 00 00 
+  800b5d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800b5f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800b66:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800b6d:	48 b8 cd 18 80 00 00 	movabs $0x8018cd,%rax
+  800b74:	00 00 00 
+  800b77:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800b79:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800b7f:	c9                   	leave
+  800b80:	c3                   	ret
+
+0000000000800b81 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800b81:	55                   	push   %rbp
+  800b82:	48 89 e5             	mov    %rsp,%rbp
+  800b85:	48 83 ec 50          	sub    $0x50,%rsp
+  800b89:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800b8d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800b91:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b95:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b99:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800b9d:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800ba4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ba8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bac:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bb0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800bb4:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800bb8:	48 b8 1d 0b 80 00 00 	movabs $0x800b1d,%rax
+  800bbf:	00 00 00 
+  800bc2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800bc4:	c9                   	leave
+  800bc5:	c3                   	ret
+
+0000000000800bc6 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800bc6:	55                   	push   %rbp
+  800bc7:	48 89 e5             	mov    %rsp,%rbp
+  800bca:	41 57                	push   %r15
+  800bcc:	41 56                	push   %r14
+  800bce:	41 55                	push   %r13
+  800bd0:	41 54                	push   %r12
+  800bd2:	53                   	push   %rbx
+  800bd3:	48 83 ec 18          	sub    $0x18,%rsp
+  800bd7:	49 89 fc             	mov    %rdi,%r12
+  800bda:	49 89 f5             	mov    %rsi,%r13
+  800bdd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800be1:	8b 45 10             	mov    0x10(%rbp),%eax
+  800be4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800be7:	41 89 cf             	mov    %ecx,%r15d
+  800bea:	4c 39 fa             	cmp    %r15,%rdx
+  800bed:	73 5b                	jae    800c4a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800bef:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800bf3:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800bf7:	85 db                	test   %ebx,%ebx
+  800bf9:	7e 0e                	jle    800c09 <print_num+0x43>
+            putch(padc, put_arg);
+  800bfb:	4c 89 ee             	mov    %r13,%rsi
+  800bfe:	44 89 f7             	mov    %r14d,%edi
+  800c01:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800c04:	83 eb 01             	sub    $0x1,%ebx
+  800c07:	75 f2                	jne    800bfb <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800c09:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800c0d:	48 b9 14 3b 80 00 00 	movabs $0x803b14,%rcx
+  800c14:	00 00 00 
+  800c17:	48 b8 03 3b 80 00 00 	movabs $0x803b03,%rax
+  800c1e:	00 00 00 
+  800c21:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800c25:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c29:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c2e:	49 f7 f7             	div    %r15
+  800c31:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800c35:	4c 89 ee             	mov    %r13,%rsi
+  800c38:	41 ff d4             	call   *%r12
+}
+  800c3b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c3f:	5b                   	pop    %rbx
+  800c40:	41 5c                	pop    %r12
+  800c42:	41 5d                	pop    %r13
+  800c44:	41 5e                	pop    %r14
+  800c46:	41 5f                	pop    %r15
+  800c48:	5d                   	pop    %rbp
+  800c49:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800c4a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c53:	49 f7 f7             	div    %r15
+  800c56:	48 83 ec 08          	sub    $0x8,%rsp
+  800c5a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800c5e:	52                   	push   %rdx
+  800c5f:	45 0f be c9          	movsbl %r9b,%r9d
+  800c63:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800c67:	48 89 c2             	mov    %rax,%rdx
+  800c6a:	48 b8 c6 0b 80 00 00 	movabs $0x800bc6,%rax
+  800c71:	00 00 00 
+  800c74:	ff d0                	call   *%rax
+  800c76:	48 83 c4 10          	add    $0x10,%rsp
+  800c7a:	eb 8d                	jmp    800c09 <print_num+0x43>
+
+0000000000800c7c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800c7c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800c80:	48 8b 06             	mov    (%rsi),%rax
+  800c83:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800c87:	73 0a                	jae    800c93 <sprintputch+0x17>
+        *state->start++ = ch;
+  800c89:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c8d:	48 89 16             	mov    %rdx,(%rsi)
+  800c90:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800c93:	c3                   	ret
+
+0000000000800c94 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800c94:	55                   	push   %rbp
+  800c95:	48 89 e5             	mov    %rsp,%rbp
+  800c98:	48 83 ec 50          	sub    $0x50,%rsp
+  800c9c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ca0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ca4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800ca8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800caf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cbb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800cbf:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800cc3:	48 b8 d1 0c 80 00 00 	movabs $0x800cd1,%rax
+  800cca:	00 00 00 
+  800ccd:	ff d0                	call   *%rax
+}
+  800ccf:	c9                   	leave
+  800cd0:	c3                   	ret
+
+0000000000800cd1 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800cd1:	55                   	push   %rbp
+  800cd2:	48 89 e5             	mov    %rsp,%rbp
+  800cd5:	41 57                	push   %r15
+  800cd7:	41 56                	push   %r14
+  800cd9:	41 55                	push   %r13
+  800cdb:	41 54                	push   %r12
+  800cdd:	53                   	push   %rbx
+  800cde:	48 83 ec 38          	sub    $0x38,%rsp
+  800ce2:	49 89 fe             	mov    %rdi,%r14
+  800ce5:	49 89 f5             	mov    %rsi,%r13
+  800ce8:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800ceb:	48 8b 01             	mov    (%rcx),%rax
+  800cee:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800cf2:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cf6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cfa:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800cfe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800d02:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800d06:	0f b6 3b             	movzbl (%rbx),%edi
+  800d09:	40 80 ff 25          	cmp    $0x25,%dil
+  800d0d:	74 18                	je     800d27 <vprintfmt+0x56>
+            if (!ch) return;
+  800d0f:	40 84 ff             	test   %dil,%dil
+  800d12:	0f 84 b1 06 00 00    	je     8013c9 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800d18:	40 0f b6 ff          	movzbl %dil,%edi
+  800d1c:	4c 89 ee             	mov    %r13,%rsi
+  800d1f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800d22:	4c 89 e3             	mov    %r12,%rbx
+  800d25:	eb db                	jmp    800d02 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800d27:	be 00 00 00 00       	mov    $0x0,%esi
+  800d2c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800d30:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800d35:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800d3b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800d42:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800d46:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800d4b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800d50:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800d53:	83 e8 23             	sub    $0x23,%eax
+  800d56:	3c 57                	cmp    $0x57,%al
+  800d58:	0f 87 51 06 00 00    	ja     8013af <vprintfmt+0x6de>
+  800d5e:	0f b6 c0             	movzbl %al,%eax
+  800d61:	48 b9 c0 3c 80 00 00 	movabs $0x803cc0,%rcx
+  800d68:	00 00 00 
+  800d6b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800d6e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800d71:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800d75:	eb cf                	jmp    800d46 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800d77:	49 89 dc             	mov    %rbx,%r12
+  800d7a:	be 01 00 00 00       	mov    $0x1,%esi
+  800d7f:	eb c5                	jmp    800d46 <vprintfmt+0x75>
+            padc = ch;
+  800d81:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800d85:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800d88:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800d8b:	eb b9                	jmp    800d46 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800d8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d90:	83 f8 2f             	cmp    $0x2f,%eax
+  800d93:	77 24                	ja     800db9 <vprintfmt+0xe8>
+  800d95:	89 c1                	mov    %eax,%ecx
+  800d97:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800d9b:	83 c0 08             	add    $0x8,%eax
+  800d9e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800da1:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800da4:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800da7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800dab:	79 99                	jns    800d46 <vprintfmt+0x75>
+                width = precision;
+  800dad:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800db1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800db7:	eb 8d                	jmp    800d46 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800db9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800dbd:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800dc1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc5:	eb da                	jmp    800da1 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800dc7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800dcc:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800dd0:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800dd6:	3c 39                	cmp    $0x39,%al
+  800dd8:	77 1c                	ja     800df6 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800dda:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800dde:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800de2:	0f b6 c0             	movzbl %al,%eax
+  800de5:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800dea:	0f b6 03             	movzbl (%rbx),%eax
+  800ded:	3c 39                	cmp    $0x39,%al
+  800def:	76 e9                	jbe    800dda <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800df1:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800df4:	eb b1                	jmp    800da7 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800df6:	49 89 dc             	mov    %rbx,%r12
+  800df9:	eb ac                	jmp    800da7 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800dfb:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800dfe:	85 c9                	test   %ecx,%ecx
+  800e00:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e05:	0f 49 c1             	cmovns %ecx,%eax
+  800e08:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800e0b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800e0e:	e9 33 ff ff ff       	jmp    800d46 <vprintfmt+0x75>
+            lflag++;
+  800e13:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800e16:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800e19:	e9 28 ff ff ff       	jmp    800d46 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800e1e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e21:	83 f8 2f             	cmp    $0x2f,%eax
+  800e24:	77 19                	ja     800e3f <vprintfmt+0x16e>
+  800e26:	89 c2                	mov    %eax,%edx
+  800e28:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e2c:	83 c0 08             	add    $0x8,%eax
+  800e2f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e32:	8b 3a                	mov    (%rdx),%edi
+  800e34:	4c 89 ee             	mov    %r13,%rsi
+  800e37:	41 ff d6             	call   *%r14
+            break;
+  800e3a:	e9 c3 fe ff ff       	jmp    800d02 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800e3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e43:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e4b:	eb e5                	jmp    800e32 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800e4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e50:	83 f8 2f             	cmp    $0x2f,%eax
+  800e53:	77 5a                	ja     800eaf <vprintfmt+0x1de>
+  800e55:	89 c2                	mov    %eax,%edx
+  800e57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e5b:	83 c0 08             	add    $0x8,%eax
+  800e5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800e61:	8b 02                	mov    (%rdx),%eax
+  800e63:	89 c1                	mov    %eax,%ecx
+  800e65:	f7 d9                	neg    %ecx
+  800e67:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800e6a:	83 f9 15             	cmp    $0x15,%ecx
+  800e6d:	7f 4e                	jg     800ebd <vprintfmt+0x1ec>
+  800e6f:	48 63 c1             	movslq %ecx,%rax
+  800e72:	48 ba 80 3f 80 00 00 	movabs $0x803f80,%rdx
+  800e79:	00 00 00 
+  800e7c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800e80:	48 85 c0             	test   %rax,%rax
+  800e83:	74 38                	je     800ebd <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800e85:	48 89 c1             	mov    %rax,%rcx
+  800e88:	48 ba d3 39 80 00 00 	movabs $0x8039d3,%rdx
+  800e8f:	00 00 00 
+  800e92:	4c 89 ee             	mov    %r13,%rsi
+  800e95:	4c 89 f7             	mov    %r14,%rdi
+  800e98:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e9d:	49 b8 94 0c 80 00 00 	movabs $0x800c94,%r8
+  800ea4:	00 00 00 
+  800ea7:	41 ff d0             	call   *%r8
+  800eaa:	e9 53 fe ff ff       	jmp    800d02 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800eaf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eb3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800eb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ebb:	eb a4                	jmp    800e61 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800ebd:	48 ba 2c 3b 80 00 00 	movabs $0x803b2c,%rdx
+  800ec4:	00 00 00 
+  800ec7:	4c 89 ee             	mov    %r13,%rsi
+  800eca:	4c 89 f7             	mov    %r14,%rdi
+  800ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed2:	49 b8 94 0c 80 00 00 	movabs $0x800c94,%r8
+  800ed9:	00 00 00 
+  800edc:	41 ff d0             	call   *%r8
+  800edf:	e9 1e fe ff ff       	jmp    800d02 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800ee4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ee7:	83 f8 2f             	cmp    $0x2f,%eax
+  800eea:	77 6c                	ja     800f58 <vprintfmt+0x287>
+  800eec:	89 c2                	mov    %eax,%edx
+  800eee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ef2:	83 c0 08             	add    $0x8,%eax
+  800ef5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ef8:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800efb:	48 85 d2             	test   %rdx,%rdx
+  800efe:	48 b8 25 3b 80 00 00 	movabs $0x803b25,%rax
+  800f05:	00 00 00 
+  800f08:	48 0f 45 c2          	cmovne %rdx,%rax
+  800f0c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800f10:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800f14:	7e 06                	jle    800f1c <vprintfmt+0x24b>
+  800f16:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800f1a:	75 4a                	jne    800f66 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800f1c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f20:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800f24:	0f b6 00             	movzbl (%rax),%eax
+  800f27:	84 c0                	test   %al,%al
+  800f29:	0f 85 9a 00 00 00    	jne    800fc9 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800f2f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800f32:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800f36:	85 c0                	test   %eax,%eax
+  800f38:	0f 8e c4 fd ff ff    	jle    800d02 <vprintfmt+0x31>
+  800f3e:	4c 89 ee             	mov    %r13,%rsi
+  800f41:	bf 20 00 00 00       	mov    $0x20,%edi
+  800f46:	41 ff d6             	call   *%r14
+  800f49:	41 83 ec 01          	sub    $0x1,%r12d
+  800f4d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800f51:	75 eb                	jne    800f3e <vprintfmt+0x26d>
+  800f53:	e9 aa fd ff ff       	jmp    800d02 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800f58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f64:	eb 92                	jmp    800ef8 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800f66:	49 63 f7             	movslq %r15d,%rsi
+  800f69:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800f6d:	48 b8 83 14 80 00 00 	movabs $0x801483,%rax
+  800f74:	00 00 00 
+  800f77:	ff d0                	call   *%rax
+  800f79:	48 89 c2             	mov    %rax,%rdx
+  800f7c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800f7f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800f81:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800f84:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800f87:	85 c0                	test   %eax,%eax
+  800f89:	7e 91                	jle    800f1c <vprintfmt+0x24b>
+  800f8b:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800f90:	4c 89 ee             	mov    %r13,%rsi
+  800f93:	44 89 e7             	mov    %r12d,%edi
+  800f96:	41 ff d6             	call   *%r14
+  800f99:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800f9d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800fa0:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800fa3:	75 eb                	jne    800f90 <vprintfmt+0x2bf>
+  800fa5:	e9 72 ff ff ff       	jmp    800f1c <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800faa:	0f b6 f8             	movzbl %al,%edi
+  800fad:	4c 89 ee             	mov    %r13,%rsi
+  800fb0:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800fb3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800fb7:	49 83 c4 01          	add    $0x1,%r12
+  800fbb:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800fc1:	84 c0                	test   %al,%al
+  800fc3:	0f 84 66 ff ff ff    	je     800f2f <vprintfmt+0x25e>
+  800fc9:	45 85 ff             	test   %r15d,%r15d
+  800fcc:	78 0a                	js     800fd8 <vprintfmt+0x307>
+  800fce:	41 83 ef 01          	sub    $0x1,%r15d
+  800fd2:	0f 88 57 ff ff ff    	js     800f2f <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800fd8:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800fdc:	74 cc                	je     800faa <vprintfmt+0x2d9>
+  800fde:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800fe1:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800fe6:	80 fa 5e             	cmp    $0x5e,%dl
+  800fe9:	77 c2                	ja     800fad <vprintfmt+0x2dc>
+  800feb:	eb bd                	jmp    800faa <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800fed:	40 84 f6             	test   %sil,%sil
+  800ff0:	75 26                	jne    801018 <vprintfmt+0x347>
+    switch (lflag) {
+  800ff2:	85 d2                	test   %edx,%edx
+  800ff4:	74 59                	je     80104f <vprintfmt+0x37e>
+  800ff6:	83 fa 01             	cmp    $0x1,%edx
+  800ff9:	74 7b                	je     801076 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800ffb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ffe:	83 f8 2f             	cmp    $0x2f,%eax
+  801001:	0f 87 96 00 00 00    	ja     80109d <vprintfmt+0x3cc>
+  801007:	89 c2                	mov    %eax,%edx
+  801009:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80100d:	83 c0 08             	add    $0x8,%eax
+  801010:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801013:	4c 8b 22             	mov    (%rdx),%r12
+  801016:	eb 17                	jmp    80102f <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  801018:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80101b:	83 f8 2f             	cmp    $0x2f,%eax
+  80101e:	77 21                	ja     801041 <vprintfmt+0x370>
+  801020:	89 c2                	mov    %eax,%edx
+  801022:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801026:	83 c0 08             	add    $0x8,%eax
+  801029:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80102c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80102f:	4d 85 e4             	test   %r12,%r12
+  801032:	78 7a                	js     8010ae <vprintfmt+0x3dd>
+            num = i;
+  801034:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801037:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80103c:	e9 50 02 00 00       	jmp    801291 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801041:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801045:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801049:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80104d:	eb dd                	jmp    80102c <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80104f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801052:	83 f8 2f             	cmp    $0x2f,%eax
+  801055:	77 11                	ja     801068 <vprintfmt+0x397>
+  801057:	89 c2                	mov    %eax,%edx
+  801059:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80105d:	83 c0 08             	add    $0x8,%eax
+  801060:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801063:	4c 63 22             	movslq (%rdx),%r12
+  801066:	eb c7                	jmp    80102f <vprintfmt+0x35e>
+  801068:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80106c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801070:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801074:	eb ed                	jmp    801063 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  801076:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801079:	83 f8 2f             	cmp    $0x2f,%eax
+  80107c:	77 11                	ja     80108f <vprintfmt+0x3be>
+  80107e:	89 c2                	mov    %eax,%edx
+  801080:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801084:	83 c0 08             	add    $0x8,%eax
+  801087:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80108a:	4c 8b 22             	mov    (%rdx),%r12
+  80108d:	eb a0                	jmp    80102f <vprintfmt+0x35e>
+  80108f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801093:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801097:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80109b:	eb ed                	jmp    80108a <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80109d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010a9:	e9 65 ff ff ff       	jmp    801013 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8010ae:	4c 89 ee             	mov    %r13,%rsi
+  8010b1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8010b6:	41 ff d6             	call   *%r14
+                i = -i;
+  8010b9:	49 f7 dc             	neg    %r12
+  8010bc:	e9 73 ff ff ff       	jmp    801034 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8010c1:	40 84 f6             	test   %sil,%sil
+  8010c4:	75 32                	jne    8010f8 <vprintfmt+0x427>
+    switch (lflag) {
+  8010c6:	85 d2                	test   %edx,%edx
+  8010c8:	74 5d                	je     801127 <vprintfmt+0x456>
+  8010ca:	83 fa 01             	cmp    $0x1,%edx
+  8010cd:	0f 84 82 00 00 00    	je     801155 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8010d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8010d9:	0f 87 a5 00 00 00    	ja     801184 <vprintfmt+0x4b3>
+  8010df:	89 c2                	mov    %eax,%edx
+  8010e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010e5:	83 c0 08             	add    $0x8,%eax
+  8010e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010eb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8010ee:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8010f3:	e9 99 01 00 00       	jmp    801291 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8010f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8010fe:	77 19                	ja     801119 <vprintfmt+0x448>
+  801100:	89 c2                	mov    %eax,%edx
+  801102:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801106:	83 c0 08             	add    $0x8,%eax
+  801109:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80110c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80110f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801114:	e9 78 01 00 00       	jmp    801291 <vprintfmt+0x5c0>
+  801119:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80111d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801121:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801125:	eb e5                	jmp    80110c <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  801127:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80112a:	83 f8 2f             	cmp    $0x2f,%eax
+  80112d:	77 18                	ja     801147 <vprintfmt+0x476>
+  80112f:	89 c2                	mov    %eax,%edx
+  801131:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801135:	83 c0 08             	add    $0x8,%eax
+  801138:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80113b:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80113d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801142:	e9 4a 01 00 00       	jmp    801291 <vprintfmt+0x5c0>
+  801147:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80114b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80114f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801153:	eb e6                	jmp    80113b <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  801155:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801158:	83 f8 2f             	cmp    $0x2f,%eax
+  80115b:	77 19                	ja     801176 <vprintfmt+0x4a5>
+  80115d:	89 c2                	mov    %eax,%edx
+  80115f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801163:	83 c0 08             	add    $0x8,%eax
+  801166:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801169:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80116c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801171:	e9 1b 01 00 00       	jmp    801291 <vprintfmt+0x5c0>
+  801176:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80117a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80117e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801182:	eb e5                	jmp    801169 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  801184:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801188:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80118c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801190:	e9 56 ff ff ff       	jmp    8010eb <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  801195:	40 84 f6             	test   %sil,%sil
+  801198:	75 2e                	jne    8011c8 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80119a:	85 d2                	test   %edx,%edx
+  80119c:	74 59                	je     8011f7 <vprintfmt+0x526>
+  80119e:	83 fa 01             	cmp    $0x1,%edx
+  8011a1:	74 7f                	je     801222 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8011a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8011a9:	0f 87 9f 00 00 00    	ja     80124e <vprintfmt+0x57d>
+  8011af:	89 c2                	mov    %eax,%edx
+  8011b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011b5:	83 c0 08             	add    $0x8,%eax
+  8011b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011bb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8011be:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8011c3:	e9 c9 00 00 00       	jmp    801291 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8011c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8011ce:	77 19                	ja     8011e9 <vprintfmt+0x518>
+  8011d0:	89 c2                	mov    %eax,%edx
+  8011d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011d6:	83 c0 08             	add    $0x8,%eax
+  8011d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011dc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8011df:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8011e4:	e9 a8 00 00 00       	jmp    801291 <vprintfmt+0x5c0>
+  8011e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011f5:	eb e5                	jmp    8011dc <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8011f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8011fd:	77 15                	ja     801214 <vprintfmt+0x543>
+  8011ff:	89 c2                	mov    %eax,%edx
+  801201:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801205:	83 c0 08             	add    $0x8,%eax
+  801208:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80120b:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80120d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801212:	eb 7d                	jmp    801291 <vprintfmt+0x5c0>
+  801214:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801218:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80121c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801220:	eb e9                	jmp    80120b <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  801222:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801225:	83 f8 2f             	cmp    $0x2f,%eax
+  801228:	77 16                	ja     801240 <vprintfmt+0x56f>
+  80122a:	89 c2                	mov    %eax,%edx
+  80122c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801230:	83 c0 08             	add    $0x8,%eax
+  801233:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801236:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801239:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80123e:	eb 51                	jmp    801291 <vprintfmt+0x5c0>
+  801240:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801244:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801248:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80124c:	eb e8                	jmp    801236 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80124e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801252:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801256:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80125a:	e9 5c ff ff ff       	jmp    8011bb <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80125f:	4c 89 ee             	mov    %r13,%rsi
+  801262:	bf 30 00 00 00       	mov    $0x30,%edi
+  801267:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80126a:	4c 89 ee             	mov    %r13,%rsi
+  80126d:	bf 78 00 00 00       	mov    $0x78,%edi
+  801272:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801275:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801278:	83 f8 2f             	cmp    $0x2f,%eax
+  80127b:	77 47                	ja     8012c4 <vprintfmt+0x5f3>
+  80127d:	89 c2                	mov    %eax,%edx
+  80127f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801283:	83 c0 08             	add    $0x8,%eax
+  801286:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801289:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80128c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801291:	48 83 ec 08          	sub    $0x8,%rsp
+  801295:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801299:	0f 94 c0             	sete   %al
+  80129c:	0f b6 c0             	movzbl %al,%eax
+  80129f:	50                   	push   %rax
+  8012a0:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8012a5:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8012a9:	4c 89 ee             	mov    %r13,%rsi
+  8012ac:	4c 89 f7             	mov    %r14,%rdi
+  8012af:	48 b8 c6 0b 80 00 00 	movabs $0x800bc6,%rax
+  8012b6:	00 00 00 
+  8012b9:	ff d0                	call   *%rax
+            break;
+  8012bb:	48 83 c4 10          	add    $0x10,%rsp
+  8012bf:	e9 3e fa ff ff       	jmp    800d02 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8012c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012d0:	eb b7                	jmp    801289 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8012d2:	40 84 f6             	test   %sil,%sil
+  8012d5:	75 2b                	jne    801302 <vprintfmt+0x631>
+    switch (lflag) {
+  8012d7:	85 d2                	test   %edx,%edx
+  8012d9:	74 56                	je     801331 <vprintfmt+0x660>
+  8012db:	83 fa 01             	cmp    $0x1,%edx
+  8012de:	74 7f                	je     80135f <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8012e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8012e6:	0f 87 a2 00 00 00    	ja     80138e <vprintfmt+0x6bd>
+  8012ec:	89 c2                	mov    %eax,%edx
+  8012ee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012f2:	83 c0 08             	add    $0x8,%eax
+  8012f5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012f8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8012fb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801300:	eb 8f                	jmp    801291 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801302:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801305:	83 f8 2f             	cmp    $0x2f,%eax
+  801308:	77 19                	ja     801323 <vprintfmt+0x652>
+  80130a:	89 c2                	mov    %eax,%edx
+  80130c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801310:	83 c0 08             	add    $0x8,%eax
+  801313:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801316:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801319:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80131e:	e9 6e ff ff ff       	jmp    801291 <vprintfmt+0x5c0>
+  801323:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801327:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80132b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80132f:	eb e5                	jmp    801316 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  801331:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801334:	83 f8 2f             	cmp    $0x2f,%eax
+  801337:	77 18                	ja     801351 <vprintfmt+0x680>
+  801339:	89 c2                	mov    %eax,%edx
+  80133b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80133f:	83 c0 08             	add    $0x8,%eax
+  801342:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801345:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801347:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80134c:	e9 40 ff ff ff       	jmp    801291 <vprintfmt+0x5c0>
+  801351:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801355:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801359:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80135d:	eb e6                	jmp    801345 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80135f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801362:	83 f8 2f             	cmp    $0x2f,%eax
+  801365:	77 19                	ja     801380 <vprintfmt+0x6af>
+  801367:	89 c2                	mov    %eax,%edx
+  801369:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80136d:	83 c0 08             	add    $0x8,%eax
+  801370:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801373:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801376:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80137b:	e9 11 ff ff ff       	jmp    801291 <vprintfmt+0x5c0>
+  801380:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801384:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801388:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80138c:	eb e5                	jmp    801373 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80138e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801392:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801396:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80139a:	e9 59 ff ff ff       	jmp    8012f8 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80139f:	4c 89 ee             	mov    %r13,%rsi
+  8013a2:	bf 25 00 00 00       	mov    $0x25,%edi
+  8013a7:	41 ff d6             	call   *%r14
+            break;
+  8013aa:	e9 53 f9 ff ff       	jmp    800d02 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8013af:	4c 89 ee             	mov    %r13,%rsi
+  8013b2:	bf 25 00 00 00       	mov    $0x25,%edi
+  8013b7:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8013ba:	48 83 eb 01          	sub    $0x1,%rbx
+  8013be:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8013c2:	75 f6                	jne    8013ba <vprintfmt+0x6e9>
+  8013c4:	e9 39 f9 ff ff       	jmp    800d02 <vprintfmt+0x31>
+}
+  8013c9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8013cd:	5b                   	pop    %rbx
+  8013ce:	41 5c                	pop    %r12
+  8013d0:	41 5d                	pop    %r13
+  8013d2:	41 5e                	pop    %r14
+  8013d4:	41 5f                	pop    %r15
+  8013d6:	5d                   	pop    %rbp
+  8013d7:	c3                   	ret
+
+00000000008013d8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8013d8:	55                   	push   %rbp
+  8013d9:	48 89 e5             	mov    %rsp,%rbp
+  8013dc:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8013e0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013e4:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8013e9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8013ed:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8013f4:	48 85 ff             	test   %rdi,%rdi
+  8013f7:	74 2b                	je     801424 <vsnprintf+0x4c>
+  8013f9:	48 85 f6             	test   %rsi,%rsi
+  8013fc:	74 26                	je     801424 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8013fe:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801402:	48 bf 7c 0c 80 00 00 	movabs $0x800c7c,%rdi
+  801409:	00 00 00 
+  80140c:	48 b8 d1 0c 80 00 00 	movabs $0x800cd1,%rax
+  801413:	00 00 00 
+  801416:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801418:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80141c:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80141f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801422:	c9                   	leave
+  801423:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801424:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801429:	eb f7                	jmp    801422 <vsnprintf+0x4a>
+
+000000000080142b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80142b:	55                   	push   %rbp
+  80142c:	48 89 e5             	mov    %rsp,%rbp
+  80142f:	48 83 ec 50          	sub    $0x50,%rsp
+  801433:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801437:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80143b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80143f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801446:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80144a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80144e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801452:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801456:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80145a:	48 b8 d8 13 80 00 00 	movabs $0x8013d8,%rax
+  801461:	00 00 00 
+  801464:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801466:	c9                   	leave
+  801467:	c3                   	ret
+
+0000000000801468 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801468:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80146b:	74 10                	je     80147d <strlen+0x15>
+    size_t n = 0;
+  80146d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801472:	48 83 c0 01          	add    $0x1,%rax
+  801476:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80147a:	75 f6                	jne    801472 <strlen+0xa>
+  80147c:	c3                   	ret
+    size_t n = 0;
+  80147d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801482:	c3                   	ret
+
+0000000000801483 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801483:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801486:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80148b:	48 85 f6             	test   %rsi,%rsi
+  80148e:	74 11                	je     8014a1 <strnlen+0x1e>
+  801490:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801494:	74 0c                	je     8014a2 <strnlen+0x1f>
+  801496:	48 83 c2 01          	add    $0x1,%rdx
+  80149a:	48 39 d0             	cmp    %rdx,%rax
+  80149d:	75 f1                	jne    801490 <strnlen+0xd>
+  80149f:	eb 04                	jmp    8014a5 <strnlen+0x22>
+  8014a1:	c3                   	ret
+  8014a2:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8014a5:	c3                   	ret
+
+00000000008014a6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8014a6:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8014a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ae:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8014b2:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8014b5:	48 83 c2 01          	add    $0x1,%rdx
+  8014b9:	84 c9                	test   %cl,%cl
+  8014bb:	75 f1                	jne    8014ae <strcpy+0x8>
+        ;
+    return res;
+}
+  8014bd:	c3                   	ret
+
+00000000008014be <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8014be:	55                   	push   %rbp
+  8014bf:	48 89 e5             	mov    %rsp,%rbp
+  8014c2:	41 54                	push   %r12
+  8014c4:	53                   	push   %rbx
+  8014c5:	48 89 fb             	mov    %rdi,%rbx
+  8014c8:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8014cb:	48 b8 68 14 80 00 00 	movabs $0x801468,%rax
+  8014d2:	00 00 00 
+  8014d5:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8014d7:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8014db:	4c 89 e6             	mov    %r12,%rsi
+  8014de:	48 b8 a6 14 80 00 00 	movabs $0x8014a6,%rax
+  8014e5:	00 00 00 
+  8014e8:	ff d0                	call   *%rax
+    return dst;
+}
+  8014ea:	48 89 d8             	mov    %rbx,%rax
+  8014ed:	5b                   	pop    %rbx
+  8014ee:	41 5c                	pop    %r12
+  8014f0:	5d                   	pop    %rbp
+  8014f1:	c3                   	ret
+
+00000000008014f2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8014f2:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8014f5:	48 85 d2             	test   %rdx,%rdx
+  8014f8:	74 1f                	je     801519 <strncpy+0x27>
+  8014fa:	48 01 fa             	add    %rdi,%rdx
+  8014fd:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801500:	48 83 c1 01          	add    $0x1,%rcx
+  801504:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801508:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80150c:	41 80 f8 01          	cmp    $0x1,%r8b
+  801510:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801514:	48 39 ca             	cmp    %rcx,%rdx
+  801517:	75 e7                	jne    801500 <strncpy+0xe>
+    }
+    return ret;
+}
+  801519:	c3                   	ret
+
+000000000080151a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80151a:	48 89 f8             	mov    %rdi,%rax
+  80151d:	48 85 d2             	test   %rdx,%rdx
+  801520:	74 24                	je     801546 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801522:	48 83 ea 01          	sub    $0x1,%rdx
+  801526:	74 1b                	je     801543 <strlcpy+0x29>
+  801528:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80152c:	0f b6 16             	movzbl (%rsi),%edx
+  80152f:	84 d2                	test   %dl,%dl
+  801531:	74 10                	je     801543 <strlcpy+0x29>
+            *dst++ = *src++;
+  801533:	48 83 c6 01          	add    $0x1,%rsi
+  801537:	48 83 c0 01          	add    $0x1,%rax
+  80153b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80153e:	48 39 c8             	cmp    %rcx,%rax
+  801541:	75 e9                	jne    80152c <strlcpy+0x12>
+        *dst = '\0';
+  801543:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801546:	48 29 f8             	sub    %rdi,%rax
+}
+  801549:	c3                   	ret
+
+000000000080154a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80154a:	0f b6 07             	movzbl (%rdi),%eax
+  80154d:	84 c0                	test   %al,%al
+  80154f:	74 13                	je     801564 <strcmp+0x1a>
+  801551:	38 06                	cmp    %al,(%rsi)
+  801553:	75 0f                	jne    801564 <strcmp+0x1a>
+  801555:	48 83 c7 01          	add    $0x1,%rdi
+  801559:	48 83 c6 01          	add    $0x1,%rsi
+  80155d:	0f b6 07             	movzbl (%rdi),%eax
+  801560:	84 c0                	test   %al,%al
+  801562:	75 ed                	jne    801551 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801564:	0f b6 c0             	movzbl %al,%eax
+  801567:	0f b6 16             	movzbl (%rsi),%edx
+  80156a:	29 d0                	sub    %edx,%eax
+}
+  80156c:	c3                   	ret
+
+000000000080156d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80156d:	48 85 d2             	test   %rdx,%rdx
+  801570:	74 1f                	je     801591 <strncmp+0x24>
+  801572:	0f b6 07             	movzbl (%rdi),%eax
+  801575:	84 c0                	test   %al,%al
+  801577:	74 1e                	je     801597 <strncmp+0x2a>
+  801579:	3a 06                	cmp    (%rsi),%al
+  80157b:	75 1a                	jne    801597 <strncmp+0x2a>
+  80157d:	48 83 c7 01          	add    $0x1,%rdi
+  801581:	48 83 c6 01          	add    $0x1,%rsi
+  801585:	48 83 ea 01          	sub    $0x1,%rdx
+  801589:	75 e7                	jne    801572 <strncmp+0x5>
+
+    if (!n) return 0;
+  80158b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801590:	c3                   	ret
+  801591:	b8 00 00 00 00       	mov    $0x0,%eax
+  801596:	c3                   	ret
+  801597:	48 85 d2             	test   %rdx,%rdx
+  80159a:	74 09                	je     8015a5 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80159c:	0f b6 07             	movzbl (%rdi),%eax
+  80159f:	0f b6 16             	movzbl (%rsi),%edx
+  8015a2:	29 d0                	sub    %edx,%eax
+  8015a4:	c3                   	ret
+    if (!n) return 0;
+  8015a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015aa:	c3                   	ret
+
+00000000008015ab <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8015ab:	0f b6 17             	movzbl (%rdi),%edx
+  8015ae:	84 d2                	test   %dl,%dl
+  8015b0:	74 18                	je     8015ca <strchr+0x1f>
+        if (*str == c) {
+  8015b2:	0f be d2             	movsbl %dl,%edx
+  8015b5:	39 f2                	cmp    %esi,%edx
+  8015b7:	74 17                	je     8015d0 <strchr+0x25>
+    for (; *str; str++) {
+  8015b9:	48 83 c7 01          	add    $0x1,%rdi
+  8015bd:	0f b6 17             	movzbl (%rdi),%edx
+  8015c0:	84 d2                	test   %dl,%dl
+  8015c2:	75 ee                	jne    8015b2 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8015c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c9:	c3                   	ret
+  8015ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015cf:	c3                   	ret
+  8015d0:	48 89 f8             	mov    %rdi,%rax
+}
+  8015d3:	c3                   	ret
+
+00000000008015d4 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8015d4:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8015d7:	0f b6 17             	movzbl (%rdi),%edx
+  8015da:	84 d2                	test   %dl,%dl
+  8015dc:	74 13                	je     8015f1 <strfind+0x1d>
+  8015de:	0f be d2             	movsbl %dl,%edx
+  8015e1:	39 f2                	cmp    %esi,%edx
+  8015e3:	74 0b                	je     8015f0 <strfind+0x1c>
+  8015e5:	48 83 c0 01          	add    $0x1,%rax
+  8015e9:	0f b6 10             	movzbl (%rax),%edx
+  8015ec:	84 d2                	test   %dl,%dl
+  8015ee:	75 ee                	jne    8015de <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8015f0:	c3                   	ret
+  8015f1:	c3                   	ret
+
+00000000008015f2 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8015f2:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8015f5:	48 89 f8             	mov    %rdi,%rax
+  8015f8:	48 f7 d8             	neg    %rax
+  8015fb:	83 e0 07             	and    $0x7,%eax
+  8015fe:	49 89 d1             	mov    %rdx,%r9
+  801601:	49 29 c1             	sub    %rax,%r9
+  801604:	78 36                	js     80163c <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801606:	40 0f b6 c6          	movzbl %sil,%eax
+  80160a:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801611:	01 01 01 
+  801614:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801618:	40 f6 c7 07          	test   $0x7,%dil
+  80161c:	75 38                	jne    801656 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80161e:	4c 89 c9             	mov    %r9,%rcx
+  801621:	48 c1 f9 03          	sar    $0x3,%rcx
+  801625:	74 0c                	je     801633 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801627:	fc                   	cld
+  801628:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80162b:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80162f:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801633:	4d 85 c9             	test   %r9,%r9
+  801636:	75 45                	jne    80167d <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801638:	4c 89 c0             	mov    %r8,%rax
+  80163b:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80163c:	48 85 d2             	test   %rdx,%rdx
+  80163f:	74 f7                	je     801638 <memset+0x46>
+  801641:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801644:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801647:	48 83 c0 01          	add    $0x1,%rax
+  80164b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80164f:	48 39 c2             	cmp    %rax,%rdx
+  801652:	75 f3                	jne    801647 <memset+0x55>
+  801654:	eb e2                	jmp    801638 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801656:	40 f6 c7 01          	test   $0x1,%dil
+  80165a:	74 06                	je     801662 <memset+0x70>
+  80165c:	88 07                	mov    %al,(%rdi)
+  80165e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801662:	40 f6 c7 02          	test   $0x2,%dil
+  801666:	74 07                	je     80166f <memset+0x7d>
+  801668:	66 89 07             	mov    %ax,(%rdi)
+  80166b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80166f:	40 f6 c7 04          	test   $0x4,%dil
+  801673:	74 a9                	je     80161e <memset+0x2c>
+  801675:	89 07                	mov    %eax,(%rdi)
+  801677:	48 83 c7 04          	add    $0x4,%rdi
+  80167b:	eb a1                	jmp    80161e <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80167d:	41 f6 c1 04          	test   $0x4,%r9b
+  801681:	74 06                	je     801689 <memset+0x97>
+  801683:	89 07                	mov    %eax,(%rdi)
+  801685:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801689:	41 f6 c1 02          	test   $0x2,%r9b
+  80168d:	74 07                	je     801696 <memset+0xa4>
+  80168f:	66 89 07             	mov    %ax,(%rdi)
+  801692:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801696:	41 f6 c1 01          	test   $0x1,%r9b
+  80169a:	74 9c                	je     801638 <memset+0x46>
+  80169c:	88 07                	mov    %al,(%rdi)
+  80169e:	eb 98                	jmp    801638 <memset+0x46>
+
+00000000008016a0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8016a0:	48 89 f8             	mov    %rdi,%rax
+  8016a3:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8016a6:	48 39 fe             	cmp    %rdi,%rsi
+  8016a9:	73 3b                	jae    8016e6 <memmove+0x46>
+  8016ab:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8016af:	48 39 d7             	cmp    %rdx,%rdi
+  8016b2:	73 32                	jae    8016e6 <memmove+0x46>
+        s += n;
+        d += n;
+  8016b4:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8016b8:	48 89 d6             	mov    %rdx,%rsi
+  8016bb:	48 09 fe             	or     %rdi,%rsi
+  8016be:	48 09 ce             	or     %rcx,%rsi
+  8016c1:	40 f6 c6 07          	test   $0x7,%sil
+  8016c5:	75 12                	jne    8016d9 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8016c7:	48 83 ef 08          	sub    $0x8,%rdi
+  8016cb:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8016cf:	48 c1 e9 03          	shr    $0x3,%rcx
+  8016d3:	fd                   	std
+  8016d4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8016d7:	fc                   	cld
+  8016d8:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8016d9:	48 83 ef 01          	sub    $0x1,%rdi
+  8016dd:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8016e1:	fd                   	std
+  8016e2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8016e4:	eb f1                	jmp    8016d7 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8016e6:	48 89 f2             	mov    %rsi,%rdx
+  8016e9:	48 09 c2             	or     %rax,%rdx
+  8016ec:	48 09 ca             	or     %rcx,%rdx
+  8016ef:	f6 c2 07             	test   $0x7,%dl
+  8016f2:	75 0c                	jne    801700 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8016f4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8016f8:	48 89 c7             	mov    %rax,%rdi
+  8016fb:	fc                   	cld
+  8016fc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8016ff:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801700:	48 89 c7             	mov    %rax,%rdi
+  801703:	fc                   	cld
+  801704:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801706:	c3                   	ret
+
+0000000000801707 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801707:	55                   	push   %rbp
+  801708:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80170b:	48 b8 a0 16 80 00 00 	movabs $0x8016a0,%rax
+  801712:	00 00 00 
+  801715:	ff d0                	call   *%rax
+}
+  801717:	5d                   	pop    %rbp
+  801718:	c3                   	ret
+
+0000000000801719 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801719:	55                   	push   %rbp
+  80171a:	48 89 e5             	mov    %rsp,%rbp
+  80171d:	41 57                	push   %r15
+  80171f:	41 56                	push   %r14
+  801721:	41 55                	push   %r13
+  801723:	41 54                	push   %r12
+  801725:	53                   	push   %rbx
+  801726:	48 83 ec 08          	sub    $0x8,%rsp
+  80172a:	49 89 fe             	mov    %rdi,%r14
+  80172d:	49 89 f7             	mov    %rsi,%r15
+  801730:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801733:	48 89 f7             	mov    %rsi,%rdi
+  801736:	48 b8 68 14 80 00 00 	movabs $0x801468,%rax
+  80173d:	00 00 00 
+  801740:	ff d0                	call   *%rax
+  801742:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801745:	48 89 de             	mov    %rbx,%rsi
+  801748:	4c 89 f7             	mov    %r14,%rdi
+  80174b:	48 b8 83 14 80 00 00 	movabs $0x801483,%rax
+  801752:	00 00 00 
+  801755:	ff d0                	call   *%rax
+  801757:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80175a:	48 39 c3             	cmp    %rax,%rbx
+  80175d:	74 36                	je     801795 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80175f:	48 89 d8             	mov    %rbx,%rax
+  801762:	4c 29 e8             	sub    %r13,%rax
+  801765:	49 39 c4             	cmp    %rax,%r12
+  801768:	73 31                	jae    80179b <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80176a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80176f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801773:	4c 89 fe             	mov    %r15,%rsi
+  801776:	48 b8 07 17 80 00 00 	movabs $0x801707,%rax
+  80177d:	00 00 00 
+  801780:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801782:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801786:	48 83 c4 08          	add    $0x8,%rsp
+  80178a:	5b                   	pop    %rbx
+  80178b:	41 5c                	pop    %r12
+  80178d:	41 5d                	pop    %r13
+  80178f:	41 5e                	pop    %r14
+  801791:	41 5f                	pop    %r15
+  801793:	5d                   	pop    %rbp
+  801794:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801795:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801799:	eb eb                	jmp    801786 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80179b:	48 83 eb 01          	sub    $0x1,%rbx
+  80179f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8017a3:	48 89 da             	mov    %rbx,%rdx
+  8017a6:	4c 89 fe             	mov    %r15,%rsi
+  8017a9:	48 b8 07 17 80 00 00 	movabs $0x801707,%rax
+  8017b0:	00 00 00 
+  8017b3:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8017b5:	49 01 de             	add    %rbx,%r14
+  8017b8:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8017bd:	eb c3                	jmp    801782 <strlcat+0x69>
+
+00000000008017bf <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8017bf:	48 85 d2             	test   %rdx,%rdx
+  8017c2:	74 2d                	je     8017f1 <memcmp+0x32>
+  8017c4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8017c9:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8017cd:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8017d2:	44 38 c1             	cmp    %r8b,%cl
+  8017d5:	75 0f                	jne    8017e6 <memcmp+0x27>
+    while (n-- > 0) {
+  8017d7:	48 83 c0 01          	add    $0x1,%rax
+  8017db:	48 39 c2             	cmp    %rax,%rdx
+  8017de:	75 e9                	jne    8017c9 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8017e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e5:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8017e6:	0f b6 c1             	movzbl %cl,%eax
+  8017e9:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8017ed:	44 29 c0             	sub    %r8d,%eax
+  8017f0:	c3                   	ret
+    return 0;
+  8017f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017f6:	c3                   	ret
+
+00000000008017f7 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8017f7:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8017fb:	48 39 c7             	cmp    %rax,%rdi
+  8017fe:	73 0f                	jae    80180f <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801800:	40 38 37             	cmp    %sil,(%rdi)
+  801803:	74 0e                	je     801813 <memfind+0x1c>
+    for (; src < end; src++) {
+  801805:	48 83 c7 01          	add    $0x1,%rdi
+  801809:	48 39 f8             	cmp    %rdi,%rax
+  80180c:	75 f2                	jne    801800 <memfind+0x9>
+  80180e:	c3                   	ret
+  80180f:	48 89 f8             	mov    %rdi,%rax
+  801812:	c3                   	ret
+  801813:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801816:	c3                   	ret
+
+0000000000801817 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801817:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80181a:	0f b6 37             	movzbl (%rdi),%esi
+  80181d:	40 80 fe 20          	cmp    $0x20,%sil
+  801821:	74 06                	je     801829 <strtol+0x12>
+  801823:	40 80 fe 09          	cmp    $0x9,%sil
+  801827:	75 13                	jne    80183c <strtol+0x25>
+  801829:	48 83 c7 01          	add    $0x1,%rdi
+  80182d:	0f b6 37             	movzbl (%rdi),%esi
+  801830:	40 80 fe 20          	cmp    $0x20,%sil
+  801834:	74 f3                	je     801829 <strtol+0x12>
+  801836:	40 80 fe 09          	cmp    $0x9,%sil
+  80183a:	74 ed                	je     801829 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80183c:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80183f:	83 e0 fd             	and    $0xfffffffd,%eax
+  801842:	3c 01                	cmp    $0x1,%al
+  801844:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801848:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80184e:	75 0f                	jne    80185f <strtol+0x48>
+  801850:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801853:	74 14                	je     801869 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801855:	85 d2                	test   %edx,%edx
+  801857:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80185c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80185f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801864:	4c 63 ca             	movslq %edx,%r9
+  801867:	eb 36                	jmp    80189f <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801869:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80186d:	74 0f                	je     80187e <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80186f:	85 d2                	test   %edx,%edx
+  801871:	75 ec                	jne    80185f <strtol+0x48>
+        s++;
+  801873:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801877:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80187c:	eb e1                	jmp    80185f <strtol+0x48>
+        s += 2;
+  80187e:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801882:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801887:	eb d6                	jmp    80185f <strtol+0x48>
+            dig -= '0';
+  801889:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80188c:	44 0f b6 c1          	movzbl %cl,%r8d
+  801890:	41 39 d0             	cmp    %edx,%r8d
+  801893:	7d 21                	jge    8018b6 <strtol+0x9f>
+        val = val * base + dig;
+  801895:	49 0f af c1          	imul   %r9,%rax
+  801899:	0f b6 c9             	movzbl %cl,%ecx
+  80189c:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80189f:	48 83 c7 01          	add    $0x1,%rdi
+  8018a3:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8018a7:	80 f9 39             	cmp    $0x39,%cl
+  8018aa:	76 dd                	jbe    801889 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8018ac:	80 f9 7b             	cmp    $0x7b,%cl
+  8018af:	77 05                	ja     8018b6 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8018b1:	83 e9 57             	sub    $0x57,%ecx
+  8018b4:	eb d6                	jmp    80188c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8018b6:	4d 85 d2             	test   %r10,%r10
+  8018b9:	74 03                	je     8018be <strtol+0xa7>
+  8018bb:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8018be:	48 89 c2             	mov    %rax,%rdx
+  8018c1:	48 f7 da             	neg    %rdx
+  8018c4:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8018c8:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8018cc:	c3                   	ret
+
+00000000008018cd <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8018cd:	55                   	push   %rbp
+  8018ce:	48 89 e5             	mov    %rsp,%rbp
+  8018d1:	53                   	push   %rbx
+  8018d2:	48 89 fa             	mov    %rdi,%rdx
+  8018d5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018d8:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8018ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018f2:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8018f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018f8:	c9                   	leave
+  8018f9:	c3                   	ret
+
+00000000008018fa <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8018fa:	55                   	push   %rbp
+  8018fb:	48 89 e5             	mov    %rsp,%rbp
+  8018fe:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018ff:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801904:	ba 00 00 00 00       	mov    $0x0,%edx
+  801909:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80190e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801913:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801918:	be 00 00 00 00       	mov    $0x0,%esi
+  80191d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801923:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801925:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801929:	c9                   	leave
+  80192a:	c3                   	ret
+
+000000000080192b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80192b:	55                   	push   %rbp
+  80192c:	48 89 e5             	mov    %rsp,%rbp
+  80192f:	53                   	push   %rbx
+  801930:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801934:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801937:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80193c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801941:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801946:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80194b:	be 00 00 00 00       	mov    $0x0,%esi
+  801950:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801956:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801958:	48 85 c0             	test   %rax,%rax
+  80195b:	7f 06                	jg     801963 <sys_env_destroy+0x38>
+}
+  80195d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801961:	c9                   	leave
+  801962:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801963:	49 89 c0             	mov    %rax,%r8
+  801966:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80196b:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801972:	00 00 00 
+  801975:	be 26 00 00 00       	mov    $0x26,%esi
+  80197a:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801981:	00 00 00 
+  801984:	b8 00 00 00 00       	mov    $0x0,%eax
+  801989:	49 b9 31 0a 80 00 00 	movabs $0x800a31,%r9
+  801990:	00 00 00 
+  801993:	41 ff d1             	call   *%r9
+
+0000000000801996 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801996:	55                   	push   %rbp
+  801997:	48 89 e5             	mov    %rsp,%rbp
+  80199a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80199b:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019bf:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8019c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019c5:	c9                   	leave
+  8019c6:	c3                   	ret
+
+00000000008019c7 <sys_yield>:
+
+void
+sys_yield(void) {
+  8019c7:	55                   	push   %rbp
+  8019c8:	48 89 e5             	mov    %rsp,%rbp
+  8019cb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019cc:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019f0:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8019f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019f6:	c9                   	leave
+  8019f7:	c3                   	ret
+
+00000000008019f8 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8019f8:	55                   	push   %rbp
+  8019f9:	48 89 e5             	mov    %rsp,%rbp
+  8019fc:	53                   	push   %rbx
+  8019fd:	48 89 fa             	mov    %rdi,%rdx
+  801a00:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a03:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a08:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801a0f:	00 00 00 
+  801a12:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a17:	be 00 00 00 00       	mov    $0x0,%esi
+  801a1c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a22:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801a24:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a28:	c9                   	leave
+  801a29:	c3                   	ret
+
+0000000000801a2a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801a2a:	55                   	push   %rbp
+  801a2b:	48 89 e5             	mov    %rsp,%rbp
+  801a2e:	53                   	push   %rbx
+  801a2f:	49 89 f8             	mov    %rdi,%r8
+  801a32:	48 89 d3             	mov    %rdx,%rbx
+  801a35:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801a38:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a3d:	4c 89 c2             	mov    %r8,%rdx
+  801a40:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a43:	be 00 00 00 00       	mov    $0x0,%esi
+  801a48:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a4e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801a50:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a54:	c9                   	leave
+  801a55:	c3                   	ret
+
+0000000000801a56 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801a56:	55                   	push   %rbp
+  801a57:	48 89 e5             	mov    %rsp,%rbp
+  801a5a:	53                   	push   %rbx
+  801a5b:	48 83 ec 08          	sub    $0x8,%rsp
+  801a5f:	89 f8                	mov    %edi,%eax
+  801a61:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801a64:	48 63 f9             	movslq %ecx,%rdi
+  801a67:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a6a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a6f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a72:	be 00 00 00 00       	mov    $0x0,%esi
+  801a77:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a7d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a7f:	48 85 c0             	test   %rax,%rax
+  801a82:	7f 06                	jg     801a8a <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801a84:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a88:	c9                   	leave
+  801a89:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a8a:	49 89 c0             	mov    %rax,%r8
+  801a8d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801a92:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801a99:	00 00 00 
+  801a9c:	be 26 00 00 00       	mov    $0x26,%esi
+  801aa1:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801aa8:	00 00 00 
+  801aab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab0:	49 b9 31 0a 80 00 00 	movabs $0x800a31,%r9
+  801ab7:	00 00 00 
+  801aba:	41 ff d1             	call   *%r9
+
+0000000000801abd <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801abd:	55                   	push   %rbp
+  801abe:	48 89 e5             	mov    %rsp,%rbp
+  801ac1:	53                   	push   %rbx
+  801ac2:	48 83 ec 08          	sub    $0x8,%rsp
+  801ac6:	89 f8                	mov    %edi,%eax
+  801ac8:	49 89 f2             	mov    %rsi,%r10
+  801acb:	48 89 cf             	mov    %rcx,%rdi
+  801ace:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801ad1:	48 63 da             	movslq %edx,%rbx
+  801ad4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ad7:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801adc:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801adf:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801ae2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ae4:	48 85 c0             	test   %rax,%rax
+  801ae7:	7f 06                	jg     801aef <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801ae9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aed:	c9                   	leave
+  801aee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801aef:	49 89 c0             	mov    %rax,%r8
+  801af2:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801af7:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801afe:	00 00 00 
+  801b01:	be 26 00 00 00       	mov    $0x26,%esi
+  801b06:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801b0d:	00 00 00 
+  801b10:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b15:	49 b9 31 0a 80 00 00 	movabs $0x800a31,%r9
+  801b1c:	00 00 00 
+  801b1f:	41 ff d1             	call   *%r9
+
+0000000000801b22 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801b22:	55                   	push   %rbp
+  801b23:	48 89 e5             	mov    %rsp,%rbp
+  801b26:	53                   	push   %rbx
+  801b27:	48 83 ec 08          	sub    $0x8,%rsp
+  801b2b:	48 89 f1             	mov    %rsi,%rcx
+  801b2e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801b31:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b34:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b39:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b3e:	be 00 00 00 00       	mov    $0x0,%esi
+  801b43:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b49:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b4b:	48 85 c0             	test   %rax,%rax
+  801b4e:	7f 06                	jg     801b56 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801b50:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b54:	c9                   	leave
+  801b55:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b56:	49 89 c0             	mov    %rax,%r8
+  801b59:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801b5e:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801b65:	00 00 00 
+  801b68:	be 26 00 00 00       	mov    $0x26,%esi
+  801b6d:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801b74:	00 00 00 
+  801b77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b7c:	49 b9 31 0a 80 00 00 	movabs $0x800a31,%r9
+  801b83:	00 00 00 
+  801b86:	41 ff d1             	call   *%r9
+
+0000000000801b89 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801b89:	55                   	push   %rbp
+  801b8a:	48 89 e5             	mov    %rsp,%rbp
+  801b8d:	53                   	push   %rbx
+  801b8e:	48 83 ec 08          	sub    $0x8,%rsp
+  801b92:	89 f8                	mov    %edi,%eax
+  801b94:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801b97:	48 63 f9             	movslq %ecx,%rdi
+  801b9a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b9d:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ba2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ba5:	be 00 00 00 00       	mov    $0x0,%esi
+  801baa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bb0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801bb2:	48 85 c0             	test   %rax,%rax
+  801bb5:	7f 06                	jg     801bbd <sys_region_advise+0x34>
+}
+  801bb7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bbb:	c9                   	leave
+  801bbc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801bbd:	49 89 c0             	mov    %rax,%r8
+  801bc0:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801bc5:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801bcc:	00 00 00 
+  801bcf:	be 26 00 00 00       	mov    $0x26,%esi
+  801bd4:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801bdb:	00 00 00 
+  801bde:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be3:	49 b9 31 0a 80 00 00 	movabs $0x800a31,%r9
+  801bea:	00 00 00 
+  801bed:	41 ff d1             	call   *%r9
+
+0000000000801bf0 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  801bf0:	55                   	push   %rbp
+  801bf1:	48 89 e5             	mov    %rsp,%rbp
+  801bf4:	53                   	push   %rbx
+  801bf5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  801bf9:	48 63 ce             	movslq %esi,%rcx
+  801bfc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801bff:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c09:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c0e:	be 00 00 00 00       	mov    $0x0,%esi
+  801c13:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c19:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c1b:	48 85 c0             	test   %rax,%rax
+  801c1e:	7f 06                	jg     801c26 <sys_env_set_nice+0x36>
+}
+  801c20:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c24:	c9                   	leave
+  801c25:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c26:	49 89 c0             	mov    %rax,%r8
+  801c29:	b9 15 00 00 00       	mov    $0x15,%ecx
+  801c2e:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801c35:	00 00 00 
+  801c38:	be 26 00 00 00       	mov    $0x26,%esi
+  801c3d:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801c44:	00 00 00 
+  801c47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c4c:	49 b9 31 0a 80 00 00 	movabs $0x800a31,%r9
+  801c53:	00 00 00 
+  801c56:	41 ff d1             	call   *%r9
+
+0000000000801c59 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801c59:	55                   	push   %rbp
+  801c5a:	48 89 e5             	mov    %rsp,%rbp
+  801c5d:	53                   	push   %rbx
+  801c5e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801c62:	48 63 ce             	movslq %esi,%rcx
+  801c65:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c68:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c72:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c77:	be 00 00 00 00       	mov    $0x0,%esi
+  801c7c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c82:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c84:	48 85 c0             	test   %rax,%rax
+  801c87:	7f 06                	jg     801c8f <sys_env_set_status+0x36>
+}
+  801c89:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c8d:	c9                   	leave
+  801c8e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c8f:	49 89 c0             	mov    %rax,%r8
+  801c92:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801c97:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801c9e:	00 00 00 
+  801ca1:	be 26 00 00 00       	mov    $0x26,%esi
+  801ca6:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801cad:	00 00 00 
+  801cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb5:	49 b9 31 0a 80 00 00 	movabs $0x800a31,%r9
+  801cbc:	00 00 00 
+  801cbf:	41 ff d1             	call   *%r9
+
+0000000000801cc2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801cc2:	55                   	push   %rbp
+  801cc3:	48 89 e5             	mov    %rsp,%rbp
+  801cc6:	53                   	push   %rbx
+  801cc7:	48 83 ec 08          	sub    $0x8,%rsp
+  801ccb:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801cce:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801cd1:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cdb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ce0:	be 00 00 00 00       	mov    $0x0,%esi
+  801ce5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ceb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ced:	48 85 c0             	test   %rax,%rax
+  801cf0:	7f 06                	jg     801cf8 <sys_env_set_trapframe+0x36>
+}
+  801cf2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cf6:	c9                   	leave
+  801cf7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801cf8:	49 89 c0             	mov    %rax,%r8
+  801cfb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801d00:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801d07:	00 00 00 
+  801d0a:	be 26 00 00 00       	mov    $0x26,%esi
+  801d0f:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801d16:	00 00 00 
+  801d19:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d1e:	49 b9 31 0a 80 00 00 	movabs $0x800a31,%r9
+  801d25:	00 00 00 
+  801d28:	41 ff d1             	call   *%r9
+
+0000000000801d2b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801d2b:	55                   	push   %rbp
+  801d2c:	48 89 e5             	mov    %rsp,%rbp
+  801d2f:	53                   	push   %rbx
+  801d30:	48 83 ec 08          	sub    $0x8,%rsp
+  801d34:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801d37:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801d3a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d44:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d49:	be 00 00 00 00       	mov    $0x0,%esi
+  801d4e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d54:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801d56:	48 85 c0             	test   %rax,%rax
+  801d59:	7f 06                	jg     801d61 <sys_env_set_pgfault_upcall+0x36>
+}
+  801d5b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d5f:	c9                   	leave
+  801d60:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801d61:	49 89 c0             	mov    %rax,%r8
+  801d64:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801d69:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801d70:	00 00 00 
+  801d73:	be 26 00 00 00       	mov    $0x26,%esi
+  801d78:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801d7f:	00 00 00 
+  801d82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d87:	49 b9 31 0a 80 00 00 	movabs $0x800a31,%r9
+  801d8e:	00 00 00 
+  801d91:	41 ff d1             	call   *%r9
+
+0000000000801d94 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801d94:	55                   	push   %rbp
+  801d95:	48 89 e5             	mov    %rsp,%rbp
+  801d98:	53                   	push   %rbx
+  801d99:	89 f8                	mov    %edi,%eax
+  801d9b:	49 89 f1             	mov    %rsi,%r9
+  801d9e:	48 89 d3             	mov    %rdx,%rbx
+  801da1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801da4:	49 63 f0             	movslq %r8d,%rsi
+  801da7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801daa:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801daf:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801db2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801db8:	cd 30                	int    $0x30
+}
+  801dba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dbe:	c9                   	leave
+  801dbf:	c3                   	ret
+
+0000000000801dc0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801dc0:	55                   	push   %rbp
+  801dc1:	48 89 e5             	mov    %rsp,%rbp
+  801dc4:	53                   	push   %rbx
+  801dc5:	48 83 ec 08          	sub    $0x8,%rsp
+  801dc9:	48 89 fa             	mov    %rdi,%rdx
+  801dcc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801dcf:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801dd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dd9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dde:	be 00 00 00 00       	mov    $0x0,%esi
+  801de3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801de9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801deb:	48 85 c0             	test   %rax,%rax
+  801dee:	7f 06                	jg     801df6 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801df0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801df4:	c9                   	leave
+  801df5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801df6:	49 89 c0             	mov    %rax,%r8
+  801df9:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801dfe:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801e05:	00 00 00 
+  801e08:	be 26 00 00 00       	mov    $0x26,%esi
+  801e0d:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801e14:	00 00 00 
+  801e17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1c:	49 b9 31 0a 80 00 00 	movabs $0x800a31,%r9
+  801e23:	00 00 00 
+  801e26:	41 ff d1             	call   *%r9
+
+0000000000801e29 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801e29:	55                   	push   %rbp
+  801e2a:	48 89 e5             	mov    %rsp,%rbp
+  801e2d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e2e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e33:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e38:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e42:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e47:	be 00 00 00 00       	mov    $0x0,%esi
+  801e4c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e52:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e54:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e58:	c9                   	leave
+  801e59:	c3                   	ret
+
+0000000000801e5a <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  801e5a:	55                   	push   %rbp
+  801e5b:	48 89 e5             	mov    %rsp,%rbp
+  801e5e:	53                   	push   %rbx
+  801e5f:	48 83 ec 08          	sub    $0x8,%rsp
+  801e63:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801e66:	48 63 ce             	movslq %esi,%rcx
+  801e69:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e6c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e71:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e76:	be 00 00 00 00       	mov    $0x0,%esi
+  801e7b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e81:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e83:	48 85 c0             	test   %rax,%rax
+  801e86:	7f 06                	jg     801e8e <sys_sigqueue+0x34>
+}
+  801e88:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e8c:	c9                   	leave
+  801e8d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e8e:	49 89 c0             	mov    %rax,%r8
+  801e91:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801e96:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801e9d:	00 00 00 
+  801ea0:	be 26 00 00 00       	mov    $0x26,%esi
+  801ea5:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801eac:	00 00 00 
+  801eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb4:	49 b9 31 0a 80 00 00 	movabs $0x800a31,%r9
+  801ebb:	00 00 00 
+  801ebe:	41 ff d1             	call   *%r9
+
+0000000000801ec1 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  801ec1:	55                   	push   %rbp
+  801ec2:	48 89 e5             	mov    %rsp,%rbp
+  801ec5:	53                   	push   %rbx
+  801ec6:	48 83 ec 08          	sub    $0x8,%rsp
+  801eca:	48 89 fa             	mov    %rdi,%rdx
+  801ecd:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801ed0:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ed5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eda:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801edf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801eea:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801eec:	48 85 c0             	test   %rax,%rax
+  801eef:	7f 06                	jg     801ef7 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  801ef1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ef5:	c9                   	leave
+  801ef6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ef7:	49 89 c0             	mov    %rax,%r8
+  801efa:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801eff:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801f06:	00 00 00 
+  801f09:	be 26 00 00 00       	mov    $0x26,%esi
+  801f0e:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801f15:	00 00 00 
+  801f18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f1d:	49 b9 31 0a 80 00 00 	movabs $0x800a31,%r9
+  801f24:	00 00 00 
+  801f27:	41 ff d1             	call   *%r9
+
+0000000000801f2a <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801f2a:	55                   	push   %rbp
+  801f2b:	48 89 e5             	mov    %rsp,%rbp
+  801f2e:	53                   	push   %rbx
+  801f2f:	48 83 ec 08          	sub    $0x8,%rsp
+  801f33:	48 89 f1             	mov    %rsi,%rcx
+  801f36:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801f39:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f3c:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f41:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f46:	be 00 00 00 00       	mov    $0x0,%esi
+  801f4b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f51:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f53:	48 85 c0             	test   %rax,%rax
+  801f56:	7f 06                	jg     801f5e <sys_sigaction+0x34>
+}
+  801f58:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f5c:	c9                   	leave
+  801f5d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f5e:	49 89 c0             	mov    %rax,%r8
+  801f61:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801f66:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801f6d:	00 00 00 
+  801f70:	be 26 00 00 00       	mov    $0x26,%esi
+  801f75:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801f7c:	00 00 00 
+  801f7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f84:	49 b9 31 0a 80 00 00 	movabs $0x800a31,%r9
+  801f8b:	00 00 00 
+  801f8e:	41 ff d1             	call   *%r9
+
+0000000000801f91 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801f91:	55                   	push   %rbp
+  801f92:	48 89 e5             	mov    %rsp,%rbp
+  801f95:	53                   	push   %rbx
+  801f96:	48 83 ec 08          	sub    $0x8,%rsp
+  801f9a:	48 89 f1             	mov    %rsi,%rcx
+  801f9d:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  801fa0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801fa3:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801fa8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fad:	be 00 00 00 00       	mov    $0x0,%esi
+  801fb2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801fb8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801fba:	48 85 c0             	test   %rax,%rax
+  801fbd:	7f 06                	jg     801fc5 <sys_sigprocmask+0x34>
+}
+  801fbf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fc3:	c9                   	leave
+  801fc4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801fc5:	49 89 c0             	mov    %rax,%r8
+  801fc8:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801fcd:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801fd4:	00 00 00 
+  801fd7:	be 26 00 00 00       	mov    $0x26,%esi
+  801fdc:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801fe3:	00 00 00 
+  801fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801feb:	49 b9 31 0a 80 00 00 	movabs $0x800a31,%r9
+  801ff2:	00 00 00 
+  801ff5:	41 ff d1             	call   *%r9
+
+0000000000801ff8 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ff8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801fff:	ff ff ff 
+  802002:	48 01 f8             	add    %rdi,%rax
+  802005:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802009:	c3                   	ret
+
+000000000080200a <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80200a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802011:	ff ff ff 
+  802014:	48 01 f8             	add    %rdi,%rax
+  802017:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80201b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802021:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802025:	c3                   	ret
+
+0000000000802026 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802026:	55                   	push   %rbp
+  802027:	48 89 e5             	mov    %rsp,%rbp
+  80202a:	41 57                	push   %r15
+  80202c:	41 56                	push   %r14
+  80202e:	41 55                	push   %r13
+  802030:	41 54                	push   %r12
+  802032:	53                   	push   %rbx
+  802033:	48 83 ec 08          	sub    $0x8,%rsp
+  802037:	49 89 ff             	mov    %rdi,%r15
+  80203a:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80203f:	49 bd a4 2f 80 00 00 	movabs $0x802fa4,%r13
+  802046:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802049:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80204f:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802052:	48 89 df             	mov    %rbx,%rdi
+  802055:	41 ff d5             	call   *%r13
+  802058:	83 e0 04             	and    $0x4,%eax
+  80205b:	74 17                	je     802074 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80205d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802064:	4c 39 f3             	cmp    %r14,%rbx
+  802067:	75 e6                	jne    80204f <fd_alloc+0x29>
+  802069:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80206f:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802074:	4d 89 27             	mov    %r12,(%r15)
+}
+  802077:	48 83 c4 08          	add    $0x8,%rsp
+  80207b:	5b                   	pop    %rbx
+  80207c:	41 5c                	pop    %r12
+  80207e:	41 5d                	pop    %r13
+  802080:	41 5e                	pop    %r14
+  802082:	41 5f                	pop    %r15
+  802084:	5d                   	pop    %rbp
+  802085:	c3                   	ret
+
+0000000000802086 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802086:	83 ff 1f             	cmp    $0x1f,%edi
+  802089:	77 39                	ja     8020c4 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80208b:	55                   	push   %rbp
+  80208c:	48 89 e5             	mov    %rsp,%rbp
+  80208f:	41 54                	push   %r12
+  802091:	53                   	push   %rbx
+  802092:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802095:	48 63 df             	movslq %edi,%rbx
+  802098:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80209f:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8020a3:	48 89 df             	mov    %rbx,%rdi
+  8020a6:	48 b8 a4 2f 80 00 00 	movabs $0x802fa4,%rax
+  8020ad:	00 00 00 
+  8020b0:	ff d0                	call   *%rax
+  8020b2:	a8 04                	test   $0x4,%al
+  8020b4:	74 14                	je     8020ca <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8020b6:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8020ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020bf:	5b                   	pop    %rbx
+  8020c0:	41 5c                	pop    %r12
+  8020c2:	5d                   	pop    %rbp
+  8020c3:	c3                   	ret
+        return -E_INVAL;
+  8020c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8020c9:	c3                   	ret
+        return -E_INVAL;
+  8020ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020cf:	eb ee                	jmp    8020bf <fd_lookup+0x39>
+
+00000000008020d1 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8020d1:	55                   	push   %rbp
+  8020d2:	48 89 e5             	mov    %rsp,%rbp
+  8020d5:	41 54                	push   %r12
+  8020d7:	53                   	push   %rbx
+  8020d8:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8020db:	48 b8 00 41 80 00 00 	movabs $0x804100,%rax
+  8020e2:	00 00 00 
+  8020e5:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  8020ec:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8020ef:	39 3b                	cmp    %edi,(%rbx)
+  8020f1:	74 47                	je     80213a <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8020f3:	48 83 c0 08          	add    $0x8,%rax
+  8020f7:	48 8b 18             	mov    (%rax),%rbx
+  8020fa:	48 85 db             	test   %rbx,%rbx
+  8020fd:	75 f0                	jne    8020ef <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8020ff:	48 a1 20 60 80 00 00 	movabs 0x806020,%rax
+  802106:	00 00 00 
+  802109:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80210f:	89 fa                	mov    %edi,%edx
+  802111:	48 bf 80 40 80 00 00 	movabs $0x804080,%rdi
+  802118:	00 00 00 
+  80211b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802120:	48 b9 81 0b 80 00 00 	movabs $0x800b81,%rcx
+  802127:	00 00 00 
+  80212a:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80212c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802131:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802135:	5b                   	pop    %rbx
+  802136:	41 5c                	pop    %r12
+  802138:	5d                   	pop    %rbp
+  802139:	c3                   	ret
+            return 0;
+  80213a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80213f:	eb f0                	jmp    802131 <dev_lookup+0x60>
+
+0000000000802141 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802141:	55                   	push   %rbp
+  802142:	48 89 e5             	mov    %rsp,%rbp
+  802145:	41 55                	push   %r13
+  802147:	41 54                	push   %r12
+  802149:	53                   	push   %rbx
+  80214a:	48 83 ec 18          	sub    $0x18,%rsp
+  80214e:	48 89 fb             	mov    %rdi,%rbx
+  802151:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802154:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80215b:	ff ff ff 
+  80215e:	48 01 df             	add    %rbx,%rdi
+  802161:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802165:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802169:	48 b8 86 20 80 00 00 	movabs $0x802086,%rax
+  802170:	00 00 00 
+  802173:	ff d0                	call   *%rax
+  802175:	41 89 c5             	mov    %eax,%r13d
+  802178:	85 c0                	test   %eax,%eax
+  80217a:	78 06                	js     802182 <fd_close+0x41>
+  80217c:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802180:	74 1a                	je     80219c <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802182:	45 84 e4             	test   %r12b,%r12b
+  802185:	b8 00 00 00 00       	mov    $0x0,%eax
+  80218a:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80218e:	44 89 e8             	mov    %r13d,%eax
+  802191:	48 83 c4 18          	add    $0x18,%rsp
+  802195:	5b                   	pop    %rbx
+  802196:	41 5c                	pop    %r12
+  802198:	41 5d                	pop    %r13
+  80219a:	5d                   	pop    %rbp
+  80219b:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80219c:	8b 3b                	mov    (%rbx),%edi
+  80219e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021a2:	48 b8 d1 20 80 00 00 	movabs $0x8020d1,%rax
+  8021a9:	00 00 00 
+  8021ac:	ff d0                	call   *%rax
+  8021ae:	41 89 c5             	mov    %eax,%r13d
+  8021b1:	85 c0                	test   %eax,%eax
+  8021b3:	78 1b                	js     8021d0 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8021b5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021b9:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8021bd:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8021c3:	48 85 c0             	test   %rax,%rax
+  8021c6:	74 08                	je     8021d0 <fd_close+0x8f>
+  8021c8:	48 89 df             	mov    %rbx,%rdi
+  8021cb:	ff d0                	call   *%rax
+  8021cd:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8021d0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021d5:	48 89 de             	mov    %rbx,%rsi
+  8021d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021dd:	48 b8 22 1b 80 00 00 	movabs $0x801b22,%rax
+  8021e4:	00 00 00 
+  8021e7:	ff d0                	call   *%rax
+    return res;
+  8021e9:	eb a3                	jmp    80218e <fd_close+0x4d>
+
+00000000008021eb <close>:
+
+int
+close(int fdnum) {
+  8021eb:	55                   	push   %rbp
+  8021ec:	48 89 e5             	mov    %rsp,%rbp
+  8021ef:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8021f3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8021f7:	48 b8 86 20 80 00 00 	movabs $0x802086,%rax
+  8021fe:	00 00 00 
+  802201:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802203:	85 c0                	test   %eax,%eax
+  802205:	78 15                	js     80221c <close+0x31>
+
+    return fd_close(fd, 1);
+  802207:	be 01 00 00 00       	mov    $0x1,%esi
+  80220c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802210:	48 b8 41 21 80 00 00 	movabs $0x802141,%rax
+  802217:	00 00 00 
+  80221a:	ff d0                	call   *%rax
+}
+  80221c:	c9                   	leave
+  80221d:	c3                   	ret
+
+000000000080221e <close_all>:
+
+void
+close_all(void) {
+  80221e:	55                   	push   %rbp
+  80221f:	48 89 e5             	mov    %rsp,%rbp
+  802222:	41 54                	push   %r12
+  802224:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802225:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80222a:	49 bc eb 21 80 00 00 	movabs $0x8021eb,%r12
+  802231:	00 00 00 
+  802234:	89 df                	mov    %ebx,%edi
+  802236:	41 ff d4             	call   *%r12
+  802239:	83 c3 01             	add    $0x1,%ebx
+  80223c:	83 fb 20             	cmp    $0x20,%ebx
+  80223f:	75 f3                	jne    802234 <close_all+0x16>
+}
+  802241:	5b                   	pop    %rbx
+  802242:	41 5c                	pop    %r12
+  802244:	5d                   	pop    %rbp
+  802245:	c3                   	ret
+
+0000000000802246 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802246:	55                   	push   %rbp
+  802247:	48 89 e5             	mov    %rsp,%rbp
+  80224a:	41 57                	push   %r15
+  80224c:	41 56                	push   %r14
+  80224e:	41 55                	push   %r13
+  802250:	41 54                	push   %r12
+  802252:	53                   	push   %rbx
+  802253:	48 83 ec 18          	sub    $0x18,%rsp
+  802257:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80225a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80225e:	48 b8 86 20 80 00 00 	movabs $0x802086,%rax
+  802265:	00 00 00 
+  802268:	ff d0                	call   *%rax
+  80226a:	89 c3                	mov    %eax,%ebx
+  80226c:	85 c0                	test   %eax,%eax
+  80226e:	0f 88 b8 00 00 00    	js     80232c <dup+0xe6>
+    close(newfdnum);
+  802274:	44 89 e7             	mov    %r12d,%edi
+  802277:	48 b8 eb 21 80 00 00 	movabs $0x8021eb,%rax
+  80227e:	00 00 00 
+  802281:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802283:	4d 63 ec             	movslq %r12d,%r13
+  802286:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80228d:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802291:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802295:	4c 89 ff             	mov    %r15,%rdi
+  802298:	49 be 0a 20 80 00 00 	movabs $0x80200a,%r14
+  80229f:	00 00 00 
+  8022a2:	41 ff d6             	call   *%r14
+  8022a5:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8022a8:	4c 89 ef             	mov    %r13,%rdi
+  8022ab:	41 ff d6             	call   *%r14
+  8022ae:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8022b1:	48 89 df             	mov    %rbx,%rdi
+  8022b4:	48 b8 a4 2f 80 00 00 	movabs $0x802fa4,%rax
+  8022bb:	00 00 00 
+  8022be:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8022c0:	a8 04                	test   $0x4,%al
+  8022c2:	74 2b                	je     8022ef <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8022c4:	41 89 c1             	mov    %eax,%r9d
+  8022c7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8022cd:	4c 89 f1             	mov    %r14,%rcx
+  8022d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d5:	48 89 de             	mov    %rbx,%rsi
+  8022d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022dd:	48 b8 bd 1a 80 00 00 	movabs $0x801abd,%rax
+  8022e4:	00 00 00 
+  8022e7:	ff d0                	call   *%rax
+  8022e9:	89 c3                	mov    %eax,%ebx
+  8022eb:	85 c0                	test   %eax,%eax
+  8022ed:	78 4e                	js     80233d <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8022ef:	4c 89 ff             	mov    %r15,%rdi
+  8022f2:	48 b8 a4 2f 80 00 00 	movabs $0x802fa4,%rax
+  8022f9:	00 00 00 
+  8022fc:	ff d0                	call   *%rax
+  8022fe:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802301:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802307:	4c 89 e9             	mov    %r13,%rcx
+  80230a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80230f:	4c 89 fe             	mov    %r15,%rsi
+  802312:	bf 00 00 00 00       	mov    $0x0,%edi
+  802317:	48 b8 bd 1a 80 00 00 	movabs $0x801abd,%rax
+  80231e:	00 00 00 
+  802321:	ff d0                	call   *%rax
+  802323:	89 c3                	mov    %eax,%ebx
+  802325:	85 c0                	test   %eax,%eax
+  802327:	78 14                	js     80233d <dup+0xf7>
+
+    return newfdnum;
+  802329:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80232c:	89 d8                	mov    %ebx,%eax
+  80232e:	48 83 c4 18          	add    $0x18,%rsp
+  802332:	5b                   	pop    %rbx
+  802333:	41 5c                	pop    %r12
+  802335:	41 5d                	pop    %r13
+  802337:	41 5e                	pop    %r14
+  802339:	41 5f                	pop    %r15
+  80233b:	5d                   	pop    %rbp
+  80233c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80233d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802342:	4c 89 ee             	mov    %r13,%rsi
+  802345:	bf 00 00 00 00       	mov    $0x0,%edi
+  80234a:	49 bc 22 1b 80 00 00 	movabs $0x801b22,%r12
+  802351:	00 00 00 
+  802354:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802357:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80235c:	4c 89 f6             	mov    %r14,%rsi
+  80235f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802364:	41 ff d4             	call   *%r12
+    return res;
+  802367:	eb c3                	jmp    80232c <dup+0xe6>
+
+0000000000802369 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802369:	55                   	push   %rbp
+  80236a:	48 89 e5             	mov    %rsp,%rbp
+  80236d:	41 56                	push   %r14
+  80236f:	41 55                	push   %r13
+  802371:	41 54                	push   %r12
+  802373:	53                   	push   %rbx
+  802374:	48 83 ec 10          	sub    $0x10,%rsp
+  802378:	89 fb                	mov    %edi,%ebx
+  80237a:	49 89 f4             	mov    %rsi,%r12
+  80237d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802380:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802384:	48 b8 86 20 80 00 00 	movabs $0x802086,%rax
+  80238b:	00 00 00 
+  80238e:	ff d0                	call   *%rax
+  802390:	85 c0                	test   %eax,%eax
+  802392:	78 4c                	js     8023e0 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802394:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802398:	41 8b 3e             	mov    (%r14),%edi
+  80239b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80239f:	48 b8 d1 20 80 00 00 	movabs $0x8020d1,%rax
+  8023a6:	00 00 00 
+  8023a9:	ff d0                	call   *%rax
+  8023ab:	85 c0                	test   %eax,%eax
+  8023ad:	78 35                	js     8023e4 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8023af:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8023b3:	83 e0 03             	and    $0x3,%eax
+  8023b6:	83 f8 01             	cmp    $0x1,%eax
+  8023b9:	74 2d                	je     8023e8 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8023bb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023bf:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8023c3:	48 85 c0             	test   %rax,%rax
+  8023c6:	74 56                	je     80241e <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8023c8:	4c 89 ea             	mov    %r13,%rdx
+  8023cb:	4c 89 e6             	mov    %r12,%rsi
+  8023ce:	4c 89 f7             	mov    %r14,%rdi
+  8023d1:	ff d0                	call   *%rax
+}
+  8023d3:	48 83 c4 10          	add    $0x10,%rsp
+  8023d7:	5b                   	pop    %rbx
+  8023d8:	41 5c                	pop    %r12
+  8023da:	41 5d                	pop    %r13
+  8023dc:	41 5e                	pop    %r14
+  8023de:	5d                   	pop    %rbp
+  8023df:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023e0:	48 98                	cltq
+  8023e2:	eb ef                	jmp    8023d3 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023e4:	48 98                	cltq
+  8023e6:	eb eb                	jmp    8023d3 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8023e8:	48 a1 20 60 80 00 00 	movabs 0x806020,%rax
+  8023ef:	00 00 00 
+  8023f2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023f8:	89 da                	mov    %ebx,%edx
+  8023fa:	48 bf c1 40 80 00 00 	movabs $0x8040c1,%rdi
+  802401:	00 00 00 
+  802404:	b8 00 00 00 00       	mov    $0x0,%eax
+  802409:	48 b9 81 0b 80 00 00 	movabs $0x800b81,%rcx
+  802410:	00 00 00 
+  802413:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802415:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80241c:	eb b5                	jmp    8023d3 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80241e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802425:	eb ac                	jmp    8023d3 <read+0x6a>
+
+0000000000802427 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802427:	55                   	push   %rbp
+  802428:	48 89 e5             	mov    %rsp,%rbp
+  80242b:	41 57                	push   %r15
+  80242d:	41 56                	push   %r14
+  80242f:	41 55                	push   %r13
+  802431:	41 54                	push   %r12
+  802433:	53                   	push   %rbx
+  802434:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802438:	48 85 d2             	test   %rdx,%rdx
+  80243b:	74 54                	je     802491 <readn+0x6a>
+  80243d:	41 89 fd             	mov    %edi,%r13d
+  802440:	49 89 f6             	mov    %rsi,%r14
+  802443:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802446:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80244b:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802450:	49 bf 69 23 80 00 00 	movabs $0x802369,%r15
+  802457:	00 00 00 
+  80245a:	4c 89 e2             	mov    %r12,%rdx
+  80245d:	48 29 f2             	sub    %rsi,%rdx
+  802460:	4c 01 f6             	add    %r14,%rsi
+  802463:	44 89 ef             	mov    %r13d,%edi
+  802466:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802469:	85 c0                	test   %eax,%eax
+  80246b:	78 20                	js     80248d <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80246d:	01 c3                	add    %eax,%ebx
+  80246f:	85 c0                	test   %eax,%eax
+  802471:	74 08                	je     80247b <readn+0x54>
+  802473:	48 63 f3             	movslq %ebx,%rsi
+  802476:	4c 39 e6             	cmp    %r12,%rsi
+  802479:	72 df                	jb     80245a <readn+0x33>
+    }
+    return res;
+  80247b:	48 63 c3             	movslq %ebx,%rax
+}
+  80247e:	48 83 c4 08          	add    $0x8,%rsp
+  802482:	5b                   	pop    %rbx
+  802483:	41 5c                	pop    %r12
+  802485:	41 5d                	pop    %r13
+  802487:	41 5e                	pop    %r14
+  802489:	41 5f                	pop    %r15
+  80248b:	5d                   	pop    %rbp
+  80248c:	c3                   	ret
+        if (inc < 0) return inc;
+  80248d:	48 98                	cltq
+  80248f:	eb ed                	jmp    80247e <readn+0x57>
+    int inc = 1, res = 0;
+  802491:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802496:	eb e3                	jmp    80247b <readn+0x54>
+
+0000000000802498 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802498:	55                   	push   %rbp
+  802499:	48 89 e5             	mov    %rsp,%rbp
+  80249c:	41 56                	push   %r14
+  80249e:	41 55                	push   %r13
+  8024a0:	41 54                	push   %r12
+  8024a2:	53                   	push   %rbx
+  8024a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a7:	89 fb                	mov    %edi,%ebx
+  8024a9:	49 89 f4             	mov    %rsi,%r12
+  8024ac:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024af:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8024b3:	48 b8 86 20 80 00 00 	movabs $0x802086,%rax
+  8024ba:	00 00 00 
+  8024bd:	ff d0                	call   *%rax
+  8024bf:	85 c0                	test   %eax,%eax
+  8024c1:	78 47                	js     80250a <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024c3:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8024c7:	41 8b 3e             	mov    (%r14),%edi
+  8024ca:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8024ce:	48 b8 d1 20 80 00 00 	movabs $0x8020d1,%rax
+  8024d5:	00 00 00 
+  8024d8:	ff d0                	call   *%rax
+  8024da:	85 c0                	test   %eax,%eax
+  8024dc:	78 30                	js     80250e <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8024de:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8024e3:	74 2d                	je     802512 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8024e5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024e9:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8024ed:	48 85 c0             	test   %rax,%rax
+  8024f0:	74 56                	je     802548 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8024f2:	4c 89 ea             	mov    %r13,%rdx
+  8024f5:	4c 89 e6             	mov    %r12,%rsi
+  8024f8:	4c 89 f7             	mov    %r14,%rdi
+  8024fb:	ff d0                	call   *%rax
+}
+  8024fd:	48 83 c4 10          	add    $0x10,%rsp
+  802501:	5b                   	pop    %rbx
+  802502:	41 5c                	pop    %r12
+  802504:	41 5d                	pop    %r13
+  802506:	41 5e                	pop    %r14
+  802508:	5d                   	pop    %rbp
+  802509:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80250a:	48 98                	cltq
+  80250c:	eb ef                	jmp    8024fd <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80250e:	48 98                	cltq
+  802510:	eb eb                	jmp    8024fd <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802512:	48 a1 20 60 80 00 00 	movabs 0x806020,%rax
+  802519:	00 00 00 
+  80251c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802522:	89 da                	mov    %ebx,%edx
+  802524:	48 bf dd 40 80 00 00 	movabs $0x8040dd,%rdi
+  80252b:	00 00 00 
+  80252e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802533:	48 b9 81 0b 80 00 00 	movabs $0x800b81,%rcx
+  80253a:	00 00 00 
+  80253d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80253f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802546:	eb b5                	jmp    8024fd <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802548:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80254f:	eb ac                	jmp    8024fd <write+0x65>
+
+0000000000802551 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802551:	55                   	push   %rbp
+  802552:	48 89 e5             	mov    %rsp,%rbp
+  802555:	53                   	push   %rbx
+  802556:	48 83 ec 18          	sub    $0x18,%rsp
+  80255a:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80255c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802560:	48 b8 86 20 80 00 00 	movabs $0x802086,%rax
+  802567:	00 00 00 
+  80256a:	ff d0                	call   *%rax
+  80256c:	85 c0                	test   %eax,%eax
+  80256e:	78 0c                	js     80257c <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802570:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802574:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802577:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80257c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802580:	c9                   	leave
+  802581:	c3                   	ret
+
+0000000000802582 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802582:	55                   	push   %rbp
+  802583:	48 89 e5             	mov    %rsp,%rbp
+  802586:	41 55                	push   %r13
+  802588:	41 54                	push   %r12
+  80258a:	53                   	push   %rbx
+  80258b:	48 83 ec 18          	sub    $0x18,%rsp
+  80258f:	89 fb                	mov    %edi,%ebx
+  802591:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802594:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802598:	48 b8 86 20 80 00 00 	movabs $0x802086,%rax
+  80259f:	00 00 00 
+  8025a2:	ff d0                	call   *%rax
+  8025a4:	85 c0                	test   %eax,%eax
+  8025a6:	78 38                	js     8025e0 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025a8:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8025ac:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8025b0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8025b4:	48 b8 d1 20 80 00 00 	movabs $0x8020d1,%rax
+  8025bb:	00 00 00 
+  8025be:	ff d0                	call   *%rax
+  8025c0:	85 c0                	test   %eax,%eax
+  8025c2:	78 1c                	js     8025e0 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025c4:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8025c9:	74 20                	je     8025eb <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8025cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025cf:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8025d3:	48 85 c0             	test   %rax,%rax
+  8025d6:	74 47                	je     80261f <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8025d8:	44 89 e6             	mov    %r12d,%esi
+  8025db:	4c 89 ef             	mov    %r13,%rdi
+  8025de:	ff d0                	call   *%rax
+}
+  8025e0:	48 83 c4 18          	add    $0x18,%rsp
+  8025e4:	5b                   	pop    %rbx
+  8025e5:	41 5c                	pop    %r12
+  8025e7:	41 5d                	pop    %r13
+  8025e9:	5d                   	pop    %rbp
+  8025ea:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8025eb:	48 a1 20 60 80 00 00 	movabs 0x806020,%rax
+  8025f2:	00 00 00 
+  8025f5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8025fb:	89 da                	mov    %ebx,%edx
+  8025fd:	48 bf a0 40 80 00 00 	movabs $0x8040a0,%rdi
+  802604:	00 00 00 
+  802607:	b8 00 00 00 00       	mov    $0x0,%eax
+  80260c:	48 b9 81 0b 80 00 00 	movabs $0x800b81,%rcx
+  802613:	00 00 00 
+  802616:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802618:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80261d:	eb c1                	jmp    8025e0 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80261f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802624:	eb ba                	jmp    8025e0 <ftruncate+0x5e>
+
+0000000000802626 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802626:	55                   	push   %rbp
+  802627:	48 89 e5             	mov    %rsp,%rbp
+  80262a:	41 54                	push   %r12
+  80262c:	53                   	push   %rbx
+  80262d:	48 83 ec 10          	sub    $0x10,%rsp
+  802631:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802634:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802638:	48 b8 86 20 80 00 00 	movabs $0x802086,%rax
+  80263f:	00 00 00 
+  802642:	ff d0                	call   *%rax
+  802644:	85 c0                	test   %eax,%eax
+  802646:	78 4e                	js     802696 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802648:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80264c:	41 8b 3c 24          	mov    (%r12),%edi
+  802650:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802654:	48 b8 d1 20 80 00 00 	movabs $0x8020d1,%rax
+  80265b:	00 00 00 
+  80265e:	ff d0                	call   *%rax
+  802660:	85 c0                	test   %eax,%eax
+  802662:	78 32                	js     802696 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802664:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802668:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80266d:	74 30                	je     80269f <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80266f:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802672:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802679:	00 00 00 
+    stat->st_isdir = 0;
+  80267c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802683:	00 00 00 
+    stat->st_dev = dev;
+  802686:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80268d:	48 89 de             	mov    %rbx,%rsi
+  802690:	4c 89 e7             	mov    %r12,%rdi
+  802693:	ff 50 28             	call   *0x28(%rax)
+}
+  802696:	48 83 c4 10          	add    $0x10,%rsp
+  80269a:	5b                   	pop    %rbx
+  80269b:	41 5c                	pop    %r12
+  80269d:	5d                   	pop    %rbp
+  80269e:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80269f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8026a4:	eb f0                	jmp    802696 <fstat+0x70>
+
+00000000008026a6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8026a6:	55                   	push   %rbp
+  8026a7:	48 89 e5             	mov    %rsp,%rbp
+  8026aa:	41 54                	push   %r12
+  8026ac:	53                   	push   %rbx
+  8026ad:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8026b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b5:	48 b8 27 29 80 00 00 	movabs $0x802927,%rax
+  8026bc:	00 00 00 
+  8026bf:	ff d0                	call   *%rax
+  8026c1:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8026c3:	85 c0                	test   %eax,%eax
+  8026c5:	78 25                	js     8026ec <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8026c7:	4c 89 e6             	mov    %r12,%rsi
+  8026ca:	89 c7                	mov    %eax,%edi
+  8026cc:	48 b8 26 26 80 00 00 	movabs $0x802626,%rax
+  8026d3:	00 00 00 
+  8026d6:	ff d0                	call   *%rax
+  8026d8:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8026db:	89 df                	mov    %ebx,%edi
+  8026dd:	48 b8 eb 21 80 00 00 	movabs $0x8021eb,%rax
+  8026e4:	00 00 00 
+  8026e7:	ff d0                	call   *%rax
+
+    return res;
+  8026e9:	44 89 e3             	mov    %r12d,%ebx
+}
+  8026ec:	89 d8                	mov    %ebx,%eax
+  8026ee:	5b                   	pop    %rbx
+  8026ef:	41 5c                	pop    %r12
+  8026f1:	5d                   	pop    %rbp
+  8026f2:	c3                   	ret
+
+00000000008026f3 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  8026f3:	55                   	push   %rbp
+  8026f4:	48 89 e5             	mov    %rsp,%rbp
+  8026f7:	41 54                	push   %r12
+  8026f9:	53                   	push   %rbx
+  8026fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8026fe:	41 89 fc             	mov    %edi,%r12d
+  802701:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802704:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80270b:	00 00 00 
+  80270e:	83 38 00             	cmpl   $0x0,(%rax)
+  802711:	74 5e                	je     802771 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802713:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802719:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80271e:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802725:	00 00 00 
+  802728:	44 89 e6             	mov    %r12d,%esi
+  80272b:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802732:	00 00 00 
+  802735:	8b 38                	mov    (%rax),%edi
+  802737:	48 b8 f8 35 80 00 00 	movabs $0x8035f8,%rax
+  80273e:	00 00 00 
+  802741:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802743:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80274a:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80274b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802750:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802754:	48 89 de             	mov    %rbx,%rsi
+  802757:	bf 00 00 00 00       	mov    $0x0,%edi
+  80275c:	48 b8 63 35 80 00 00 	movabs $0x803563,%rax
+  802763:	00 00 00 
+  802766:	ff d0                	call   *%rax
+}
+  802768:	48 83 c4 10          	add    $0x10,%rsp
+  80276c:	5b                   	pop    %rbx
+  80276d:	41 5c                	pop    %r12
+  80276f:	5d                   	pop    %rbp
+  802770:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802771:	bf 03 00 00 00       	mov    $0x3,%edi
+  802776:	48 b8 98 36 80 00 00 	movabs $0x803698,%rax
+  80277d:	00 00 00 
+  802780:	ff d0                	call   *%rax
+  802782:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802789:	00 00 
+  80278b:	eb 86                	jmp    802713 <fsipc+0x20>
+
+000000000080278d <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80278d:	55                   	push   %rbp
+  80278e:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802791:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802798:	00 00 00 
+  80279b:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80279e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8027a0:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8027a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8027a8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8027ad:	48 b8 f3 26 80 00 00 	movabs $0x8026f3,%rax
+  8027b4:	00 00 00 
+  8027b7:	ff d0                	call   *%rax
+}
+  8027b9:	5d                   	pop    %rbp
+  8027ba:	c3                   	ret
+
+00000000008027bb <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8027bb:	55                   	push   %rbp
+  8027bc:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8027bf:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8027c2:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8027c9:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8027cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8027d0:	bf 06 00 00 00       	mov    $0x6,%edi
+  8027d5:	48 b8 f3 26 80 00 00 	movabs $0x8026f3,%rax
+  8027dc:	00 00 00 
+  8027df:	ff d0                	call   *%rax
+}
+  8027e1:	5d                   	pop    %rbp
+  8027e2:	c3                   	ret
+
+00000000008027e3 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8027e3:	55                   	push   %rbp
+  8027e4:	48 89 e5             	mov    %rsp,%rbp
+  8027e7:	41 54                	push   %r12
+  8027e9:	53                   	push   %rbx
+  8027ea:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8027ed:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8027f0:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8027f7:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8027f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8027fe:	bf 05 00 00 00       	mov    $0x5,%edi
+  802803:	48 b8 f3 26 80 00 00 	movabs $0x8026f3,%rax
+  80280a:	00 00 00 
+  80280d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80280f:	85 c0                	test   %eax,%eax
+  802811:	78 3d                	js     802850 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802813:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80281a:	00 00 00 
+  80281d:	4c 89 e6             	mov    %r12,%rsi
+  802820:	48 89 df             	mov    %rbx,%rdi
+  802823:	48 b8 a6 14 80 00 00 	movabs $0x8014a6,%rax
+  80282a:	00 00 00 
+  80282d:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80282f:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802836:	00 
+  802837:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80283d:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802844:	00 
+  802845:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80284b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802850:	5b                   	pop    %rbx
+  802851:	41 5c                	pop    %r12
+  802853:	5d                   	pop    %rbp
+  802854:	c3                   	ret
+
+0000000000802855 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802855:	55                   	push   %rbp
+  802856:	48 89 e5             	mov    %rsp,%rbp
+  802859:	41 54                	push   %r12
+  80285b:	53                   	push   %rbx
+  80285c:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  80285f:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  802864:	48 39 c2             	cmp    %rax,%rdx
+  802867:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80286b:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80286e:	48 89 c2             	mov    %rax,%rdx
+  802871:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802878:	00 00 00 
+  80287b:	48 b8 07 17 80 00 00 	movabs $0x801707,%rax
+  802882:	00 00 00 
+  802885:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802887:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80288e:	00 00 00 
+  802891:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802896:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  802898:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  80289c:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a1:	bf 04 00 00 00       	mov    $0x4,%edi
+  8028a6:	48 b8 f3 26 80 00 00 	movabs $0x8026f3,%rax
+  8028ad:	00 00 00 
+  8028b0:	ff d0                	call   *%rax
+  8028b2:	48 98                	cltq
+}
+  8028b4:	5b                   	pop    %rbx
+  8028b5:	41 5c                	pop    %r12
+  8028b7:	5d                   	pop    %rbp
+  8028b8:	c3                   	ret
+
+00000000008028b9 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8028b9:	55                   	push   %rbp
+  8028ba:	48 89 e5             	mov    %rsp,%rbp
+  8028bd:	41 54                	push   %r12
+  8028bf:	53                   	push   %rbx
+  8028c0:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8028c3:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8028ca:	00 00 00 
+  8028cd:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8028d0:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  8028d2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8028d7:	48 39 ca             	cmp    %rcx,%rdx
+  8028da:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  8028de:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  8028e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8028e7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8028ec:	48 b8 f3 26 80 00 00 	movabs $0x8026f3,%rax
+  8028f3:	00 00 00 
+  8028f6:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  8028f8:	85 c0                	test   %eax,%eax
+  8028fa:	78 27                	js     802923 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  8028fc:	48 63 d8             	movslq %eax,%rbx
+  8028ff:	48 89 da             	mov    %rbx,%rdx
+  802902:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  802909:	00 00 00 
+  80290c:	4c 89 e7             	mov    %r12,%rdi
+  80290f:	48 b8 07 17 80 00 00 	movabs $0x801707,%rax
+  802916:	00 00 00 
+  802919:	ff d0                	call   *%rax
+    return bytes_read;
+  80291b:	48 89 d8             	mov    %rbx,%rax
+}
+  80291e:	5b                   	pop    %rbx
+  80291f:	41 5c                	pop    %r12
+  802921:	5d                   	pop    %rbp
+  802922:	c3                   	ret
+        return bytes_read;
+  802923:	48 98                	cltq
+  802925:	eb f7                	jmp    80291e <devfile_read+0x65>
+
+0000000000802927 <open>:
+open(const char *path, int mode) {
+  802927:	55                   	push   %rbp
+  802928:	48 89 e5             	mov    %rsp,%rbp
+  80292b:	41 55                	push   %r13
+  80292d:	41 54                	push   %r12
+  80292f:	53                   	push   %rbx
+  802930:	48 83 ec 18          	sub    $0x18,%rsp
+  802934:	49 89 fc             	mov    %rdi,%r12
+  802937:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80293a:	48 b8 68 14 80 00 00 	movabs $0x801468,%rax
+  802941:	00 00 00 
+  802944:	ff d0                	call   *%rax
+  802946:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80294c:	0f 87 8a 00 00 00    	ja     8029dc <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802952:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802956:	48 b8 26 20 80 00 00 	movabs $0x802026,%rax
+  80295d:	00 00 00 
+  802960:	ff d0                	call   *%rax
+  802962:	89 c3                	mov    %eax,%ebx
+  802964:	85 c0                	test   %eax,%eax
+  802966:	78 50                	js     8029b8 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802968:	4c 89 e6             	mov    %r12,%rsi
+  80296b:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802972:	00 00 00 
+  802975:	48 89 df             	mov    %rbx,%rdi
+  802978:	48 b8 a6 14 80 00 00 	movabs $0x8014a6,%rax
+  80297f:	00 00 00 
+  802982:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802984:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80298b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80298f:	bf 01 00 00 00       	mov    $0x1,%edi
+  802994:	48 b8 f3 26 80 00 00 	movabs $0x8026f3,%rax
+  80299b:	00 00 00 
+  80299e:	ff d0                	call   *%rax
+  8029a0:	89 c3                	mov    %eax,%ebx
+  8029a2:	85 c0                	test   %eax,%eax
+  8029a4:	78 1f                	js     8029c5 <open+0x9e>
+    return fd2num(fd);
+  8029a6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8029aa:	48 b8 f8 1f 80 00 00 	movabs $0x801ff8,%rax
+  8029b1:	00 00 00 
+  8029b4:	ff d0                	call   *%rax
+  8029b6:	89 c3                	mov    %eax,%ebx
+}
+  8029b8:	89 d8                	mov    %ebx,%eax
+  8029ba:	48 83 c4 18          	add    $0x18,%rsp
+  8029be:	5b                   	pop    %rbx
+  8029bf:	41 5c                	pop    %r12
+  8029c1:	41 5d                	pop    %r13
+  8029c3:	5d                   	pop    %rbp
+  8029c4:	c3                   	ret
+        fd_close(fd, 0);
+  8029c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ca:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8029ce:	48 b8 41 21 80 00 00 	movabs $0x802141,%rax
+  8029d5:	00 00 00 
+  8029d8:	ff d0                	call   *%rax
+        return res;
+  8029da:	eb dc                	jmp    8029b8 <open+0x91>
+        return -E_BAD_PATH;
+  8029dc:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8029e1:	eb d5                	jmp    8029b8 <open+0x91>
+
+00000000008029e3 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8029e3:	55                   	push   %rbp
+  8029e4:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8029e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ec:	bf 08 00 00 00       	mov    $0x8,%edi
+  8029f1:	48 b8 f3 26 80 00 00 	movabs $0x8026f3,%rax
+  8029f8:	00 00 00 
+  8029fb:	ff d0                	call   *%rax
+}
+  8029fd:	5d                   	pop    %rbp
+  8029fe:	c3                   	ret
+
+00000000008029ff <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8029ff:	55                   	push   %rbp
+  802a00:	48 89 e5             	mov    %rsp,%rbp
+  802a03:	41 54                	push   %r12
+  802a05:	53                   	push   %rbx
+  802a06:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a09:	48 b8 0a 20 80 00 00 	movabs $0x80200a,%rax
+  802a10:	00 00 00 
+  802a13:	ff d0                	call   *%rax
+  802a15:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802a18:	48 be 20 41 80 00 00 	movabs $0x804120,%rsi
+  802a1f:	00 00 00 
+  802a22:	48 89 df             	mov    %rbx,%rdi
+  802a25:	48 b8 a6 14 80 00 00 	movabs $0x8014a6,%rax
+  802a2c:	00 00 00 
+  802a2f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802a31:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802a36:	41 2b 04 24          	sub    (%r12),%eax
+  802a3a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802a40:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802a47:	00 00 00 
+    stat->st_dev = &devpipe;
+  802a4a:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  802a51:	00 00 00 
+  802a54:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802a5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a60:	5b                   	pop    %rbx
+  802a61:	41 5c                	pop    %r12
+  802a63:	5d                   	pop    %rbp
+  802a64:	c3                   	ret
+
+0000000000802a65 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802a65:	55                   	push   %rbp
+  802a66:	48 89 e5             	mov    %rsp,%rbp
+  802a69:	41 54                	push   %r12
+  802a6b:	53                   	push   %rbx
+  802a6c:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802a6f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a74:	48 89 fe             	mov    %rdi,%rsi
+  802a77:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a7c:	49 bc 22 1b 80 00 00 	movabs $0x801b22,%r12
+  802a83:	00 00 00 
+  802a86:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802a89:	48 89 df             	mov    %rbx,%rdi
+  802a8c:	48 b8 0a 20 80 00 00 	movabs $0x80200a,%rax
+  802a93:	00 00 00 
+  802a96:	ff d0                	call   *%rax
+  802a98:	48 89 c6             	mov    %rax,%rsi
+  802a9b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802aa0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aa5:	41 ff d4             	call   *%r12
+}
+  802aa8:	5b                   	pop    %rbx
+  802aa9:	41 5c                	pop    %r12
+  802aab:	5d                   	pop    %rbp
+  802aac:	c3                   	ret
+
+0000000000802aad <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802aad:	55                   	push   %rbp
+  802aae:	48 89 e5             	mov    %rsp,%rbp
+  802ab1:	41 57                	push   %r15
+  802ab3:	41 56                	push   %r14
+  802ab5:	41 55                	push   %r13
+  802ab7:	41 54                	push   %r12
+  802ab9:	53                   	push   %rbx
+  802aba:	48 83 ec 18          	sub    $0x18,%rsp
+  802abe:	49 89 fc             	mov    %rdi,%r12
+  802ac1:	49 89 f5             	mov    %rsi,%r13
+  802ac4:	49 89 d7             	mov    %rdx,%r15
+  802ac7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802acb:	48 b8 0a 20 80 00 00 	movabs $0x80200a,%rax
+  802ad2:	00 00 00 
+  802ad5:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802ad7:	4d 85 ff             	test   %r15,%r15
+  802ada:	0f 84 af 00 00 00    	je     802b8f <devpipe_write+0xe2>
+  802ae0:	48 89 c3             	mov    %rax,%rbx
+  802ae3:	4c 89 f8             	mov    %r15,%rax
+  802ae6:	4d 89 ef             	mov    %r13,%r15
+  802ae9:	4c 01 e8             	add    %r13,%rax
+  802aec:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802af0:	49 bd 2a 1a 80 00 00 	movabs $0x801a2a,%r13
+  802af7:	00 00 00 
+            sys_yield();
+  802afa:	49 be c7 19 80 00 00 	movabs $0x8019c7,%r14
+  802b01:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802b04:	8b 73 04             	mov    0x4(%rbx),%esi
+  802b07:	48 63 ce             	movslq %esi,%rcx
+  802b0a:	48 63 03             	movslq (%rbx),%rax
+  802b0d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802b13:	48 39 c1             	cmp    %rax,%rcx
+  802b16:	72 2e                	jb     802b46 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802b18:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b1d:	48 89 da             	mov    %rbx,%rdx
+  802b20:	be 00 10 00 00       	mov    $0x1000,%esi
+  802b25:	4c 89 e7             	mov    %r12,%rdi
+  802b28:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802b2b:	85 c0                	test   %eax,%eax
+  802b2d:	74 66                	je     802b95 <devpipe_write+0xe8>
+            sys_yield();
+  802b2f:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802b32:	8b 73 04             	mov    0x4(%rbx),%esi
+  802b35:	48 63 ce             	movslq %esi,%rcx
+  802b38:	48 63 03             	movslq (%rbx),%rax
+  802b3b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802b41:	48 39 c1             	cmp    %rax,%rcx
+  802b44:	73 d2                	jae    802b18 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802b46:	41 0f b6 3f          	movzbl (%r15),%edi
+  802b4a:	48 89 ca             	mov    %rcx,%rdx
+  802b4d:	48 c1 ea 03          	shr    $0x3,%rdx
+  802b51:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802b58:	08 10 20 
+  802b5b:	48 f7 e2             	mul    %rdx
+  802b5e:	48 c1 ea 06          	shr    $0x6,%rdx
+  802b62:	48 89 d0             	mov    %rdx,%rax
+  802b65:	48 c1 e0 09          	shl    $0x9,%rax
+  802b69:	48 29 d0             	sub    %rdx,%rax
+  802b6c:	48 c1 e0 03          	shl    $0x3,%rax
+  802b70:	48 29 c1             	sub    %rax,%rcx
+  802b73:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802b78:	83 c6 01             	add    $0x1,%esi
+  802b7b:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802b7e:	49 83 c7 01          	add    $0x1,%r15
+  802b82:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b86:	49 39 c7             	cmp    %rax,%r15
+  802b89:	0f 85 75 ff ff ff    	jne    802b04 <devpipe_write+0x57>
+    return n;
+  802b8f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b93:	eb 05                	jmp    802b9a <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802b95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b9a:	48 83 c4 18          	add    $0x18,%rsp
+  802b9e:	5b                   	pop    %rbx
+  802b9f:	41 5c                	pop    %r12
+  802ba1:	41 5d                	pop    %r13
+  802ba3:	41 5e                	pop    %r14
+  802ba5:	41 5f                	pop    %r15
+  802ba7:	5d                   	pop    %rbp
+  802ba8:	c3                   	ret
+
+0000000000802ba9 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ba9:	55                   	push   %rbp
+  802baa:	48 89 e5             	mov    %rsp,%rbp
+  802bad:	41 57                	push   %r15
+  802baf:	41 56                	push   %r14
+  802bb1:	41 55                	push   %r13
+  802bb3:	41 54                	push   %r12
+  802bb5:	53                   	push   %rbx
+  802bb6:	48 83 ec 18          	sub    $0x18,%rsp
+  802bba:	49 89 fc             	mov    %rdi,%r12
+  802bbd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802bc1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802bc5:	48 b8 0a 20 80 00 00 	movabs $0x80200a,%rax
+  802bcc:	00 00 00 
+  802bcf:	ff d0                	call   *%rax
+  802bd1:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802bd4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802bda:	49 bd 2a 1a 80 00 00 	movabs $0x801a2a,%r13
+  802be1:	00 00 00 
+            sys_yield();
+  802be4:	49 be c7 19 80 00 00 	movabs $0x8019c7,%r14
+  802beb:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802bee:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802bf3:	74 7d                	je     802c72 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802bf5:	8b 03                	mov    (%rbx),%eax
+  802bf7:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802bfa:	75 26                	jne    802c22 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802bfc:	4d 85 ff             	test   %r15,%r15
+  802bff:	75 77                	jne    802c78 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c01:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c06:	48 89 da             	mov    %rbx,%rdx
+  802c09:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c0e:	4c 89 e7             	mov    %r12,%rdi
+  802c11:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802c14:	85 c0                	test   %eax,%eax
+  802c16:	74 72                	je     802c8a <devpipe_read+0xe1>
+            sys_yield();
+  802c18:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802c1b:	8b 03                	mov    (%rbx),%eax
+  802c1d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802c20:	74 df                	je     802c01 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802c22:	48 63 c8             	movslq %eax,%rcx
+  802c25:	48 89 ca             	mov    %rcx,%rdx
+  802c28:	48 c1 ea 03          	shr    $0x3,%rdx
+  802c2c:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802c33:	08 10 20 
+  802c36:	48 89 d0             	mov    %rdx,%rax
+  802c39:	48 f7 e6             	mul    %rsi
+  802c3c:	48 c1 ea 06          	shr    $0x6,%rdx
+  802c40:	48 89 d0             	mov    %rdx,%rax
+  802c43:	48 c1 e0 09          	shl    $0x9,%rax
+  802c47:	48 29 d0             	sub    %rdx,%rax
+  802c4a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802c51:	00 
+  802c52:	48 89 c8             	mov    %rcx,%rax
+  802c55:	48 29 d0             	sub    %rdx,%rax
+  802c58:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802c5d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802c61:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802c65:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802c68:	49 83 c7 01          	add    $0x1,%r15
+  802c6c:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802c70:	75 83                	jne    802bf5 <devpipe_read+0x4c>
+    return n;
+  802c72:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c76:	eb 03                	jmp    802c7b <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802c78:	4c 89 f8             	mov    %r15,%rax
+}
+  802c7b:	48 83 c4 18          	add    $0x18,%rsp
+  802c7f:	5b                   	pop    %rbx
+  802c80:	41 5c                	pop    %r12
+  802c82:	41 5d                	pop    %r13
+  802c84:	41 5e                	pop    %r14
+  802c86:	41 5f                	pop    %r15
+  802c88:	5d                   	pop    %rbp
+  802c89:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8f:	eb ea                	jmp    802c7b <devpipe_read+0xd2>
+
+0000000000802c91 <pipe>:
+pipe(int pfd[2]) {
+  802c91:	55                   	push   %rbp
+  802c92:	48 89 e5             	mov    %rsp,%rbp
+  802c95:	41 55                	push   %r13
+  802c97:	41 54                	push   %r12
+  802c99:	53                   	push   %rbx
+  802c9a:	48 83 ec 18          	sub    $0x18,%rsp
+  802c9e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802ca1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802ca5:	48 b8 26 20 80 00 00 	movabs $0x802026,%rax
+  802cac:	00 00 00 
+  802caf:	ff d0                	call   *%rax
+  802cb1:	89 c3                	mov    %eax,%ebx
+  802cb3:	85 c0                	test   %eax,%eax
+  802cb5:	0f 88 a0 01 00 00    	js     802e5b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802cbb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802cc0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cc5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802cc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cce:	48 b8 56 1a 80 00 00 	movabs $0x801a56,%rax
+  802cd5:	00 00 00 
+  802cd8:	ff d0                	call   *%rax
+  802cda:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802cdc:	85 c0                	test   %eax,%eax
+  802cde:	0f 88 77 01 00 00    	js     802e5b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802ce4:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802ce8:	48 b8 26 20 80 00 00 	movabs $0x802026,%rax
+  802cef:	00 00 00 
+  802cf2:	ff d0                	call   *%rax
+  802cf4:	89 c3                	mov    %eax,%ebx
+  802cf6:	85 c0                	test   %eax,%eax
+  802cf8:	0f 88 43 01 00 00    	js     802e41 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802cfe:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802d03:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d08:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802d0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d11:	48 b8 56 1a 80 00 00 	movabs $0x801a56,%rax
+  802d18:	00 00 00 
+  802d1b:	ff d0                	call   *%rax
+  802d1d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802d1f:	85 c0                	test   %eax,%eax
+  802d21:	0f 88 1a 01 00 00    	js     802e41 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802d27:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d2b:	48 b8 0a 20 80 00 00 	movabs $0x80200a,%rax
+  802d32:	00 00 00 
+  802d35:	ff d0                	call   *%rax
+  802d37:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802d3a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802d3f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d44:	48 89 c6             	mov    %rax,%rsi
+  802d47:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d4c:	48 b8 56 1a 80 00 00 	movabs $0x801a56,%rax
+  802d53:	00 00 00 
+  802d56:	ff d0                	call   *%rax
+  802d58:	89 c3                	mov    %eax,%ebx
+  802d5a:	85 c0                	test   %eax,%eax
+  802d5c:	0f 88 c5 00 00 00    	js     802e27 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802d62:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802d66:	48 b8 0a 20 80 00 00 	movabs $0x80200a,%rax
+  802d6d:	00 00 00 
+  802d70:	ff d0                	call   *%rax
+  802d72:	48 89 c1             	mov    %rax,%rcx
+  802d75:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802d7b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802d81:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d86:	4c 89 ee             	mov    %r13,%rsi
+  802d89:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d8e:	48 b8 bd 1a 80 00 00 	movabs $0x801abd,%rax
+  802d95:	00 00 00 
+  802d98:	ff d0                	call   *%rax
+  802d9a:	89 c3                	mov    %eax,%ebx
+  802d9c:	85 c0                	test   %eax,%eax
+  802d9e:	78 6e                	js     802e0e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802da0:	be 00 10 00 00       	mov    $0x1000,%esi
+  802da5:	4c 89 ef             	mov    %r13,%rdi
+  802da8:	48 b8 f8 19 80 00 00 	movabs $0x8019f8,%rax
+  802daf:	00 00 00 
+  802db2:	ff d0                	call   *%rax
+  802db4:	83 f8 02             	cmp    $0x2,%eax
+  802db7:	0f 85 ab 00 00 00    	jne    802e68 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802dbd:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  802dc4:	00 00 
+  802dc6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802dca:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802dcc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802dd0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802dd7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ddb:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802ddd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802de1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802de8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802dec:	48 bb f8 1f 80 00 00 	movabs $0x801ff8,%rbx
+  802df3:	00 00 00 
+  802df6:	ff d3                	call   *%rbx
+  802df8:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802dfc:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802e00:	ff d3                	call   *%rbx
+  802e02:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802e07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e0c:	eb 4d                	jmp    802e5b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802e0e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e13:	4c 89 ee             	mov    %r13,%rsi
+  802e16:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e1b:	48 b8 22 1b 80 00 00 	movabs $0x801b22,%rax
+  802e22:	00 00 00 
+  802e25:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802e27:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e2c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802e30:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e35:	48 b8 22 1b 80 00 00 	movabs $0x801b22,%rax
+  802e3c:	00 00 00 
+  802e3f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802e41:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e46:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802e4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e4f:	48 b8 22 1b 80 00 00 	movabs $0x801b22,%rax
+  802e56:	00 00 00 
+  802e59:	ff d0                	call   *%rax
+}
+  802e5b:	89 d8                	mov    %ebx,%eax
+  802e5d:	48 83 c4 18          	add    $0x18,%rsp
+  802e61:	5b                   	pop    %rbx
+  802e62:	41 5c                	pop    %r12
+  802e64:	41 5d                	pop    %r13
+  802e66:	5d                   	pop    %rbp
+  802e67:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802e68:	48 b9 38 41 80 00 00 	movabs $0x804138,%rcx
+  802e6f:	00 00 00 
+  802e72:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  802e79:	00 00 00 
+  802e7c:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802e81:	48 bf 27 41 80 00 00 	movabs $0x804127,%rdi
+  802e88:	00 00 00 
+  802e8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e90:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  802e97:	00 00 00 
+  802e9a:	41 ff d0             	call   *%r8
+
+0000000000802e9d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802e9d:	55                   	push   %rbp
+  802e9e:	48 89 e5             	mov    %rsp,%rbp
+  802ea1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802ea5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802ea9:	48 b8 86 20 80 00 00 	movabs $0x802086,%rax
+  802eb0:	00 00 00 
+  802eb3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802eb5:	85 c0                	test   %eax,%eax
+  802eb7:	78 35                	js     802eee <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802eb9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802ebd:	48 b8 0a 20 80 00 00 	movabs $0x80200a,%rax
+  802ec4:	00 00 00 
+  802ec7:	ff d0                	call   *%rax
+  802ec9:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ecc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802ed1:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ed6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802eda:	48 b8 2a 1a 80 00 00 	movabs $0x801a2a,%rax
+  802ee1:	00 00 00 
+  802ee4:	ff d0                	call   *%rax
+  802ee6:	85 c0                	test   %eax,%eax
+  802ee8:	0f 94 c0             	sete   %al
+  802eeb:	0f b6 c0             	movzbl %al,%eax
+}
+  802eee:	c9                   	leave
+  802eef:	c3                   	ret
+
+0000000000802ef0 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802ef0:	48 89 f8             	mov    %rdi,%rax
+  802ef3:	48 c1 e8 27          	shr    $0x27,%rax
+  802ef7:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802efe:	01 00 00 
+  802f01:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802f05:	f6 c2 01             	test   $0x1,%dl
+  802f08:	74 6d                	je     802f77 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802f0a:	48 89 f8             	mov    %rdi,%rax
+  802f0d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f11:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802f18:	01 00 00 
+  802f1b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802f1f:	f6 c2 01             	test   $0x1,%dl
+  802f22:	74 62                	je     802f86 <get_uvpt_entry+0x96>
+  802f24:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802f2b:	01 00 00 
+  802f2e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802f32:	f6 c2 80             	test   $0x80,%dl
+  802f35:	75 4f                	jne    802f86 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802f37:	48 89 f8             	mov    %rdi,%rax
+  802f3a:	48 c1 e8 15          	shr    $0x15,%rax
+  802f3e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802f45:	01 00 00 
+  802f48:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802f4c:	f6 c2 01             	test   $0x1,%dl
+  802f4f:	74 44                	je     802f95 <get_uvpt_entry+0xa5>
+  802f51:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802f58:	01 00 00 
+  802f5b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802f5f:	f6 c2 80             	test   $0x80,%dl
+  802f62:	75 31                	jne    802f95 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802f64:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802f68:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802f6f:	01 00 00 
+  802f72:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802f76:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802f77:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802f7e:	01 00 00 
+  802f81:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802f85:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802f86:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802f8d:	01 00 00 
+  802f90:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802f94:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802f95:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802f9c:	01 00 00 
+  802f9f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802fa3:	c3                   	ret
+
+0000000000802fa4 <get_prot>:
+
+int
+get_prot(void *va) {
+  802fa4:	55                   	push   %rbp
+  802fa5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802fa8:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  802faf:	00 00 00 
+  802fb2:	ff d0                	call   *%rax
+  802fb4:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802fb7:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802fbc:	89 c1                	mov    %eax,%ecx
+  802fbe:	83 c9 04             	or     $0x4,%ecx
+  802fc1:	f6 c2 01             	test   $0x1,%dl
+  802fc4:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802fc7:	89 c1                	mov    %eax,%ecx
+  802fc9:	83 c9 02             	or     $0x2,%ecx
+  802fcc:	f6 c2 02             	test   $0x2,%dl
+  802fcf:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802fd2:	89 c1                	mov    %eax,%ecx
+  802fd4:	83 c9 01             	or     $0x1,%ecx
+  802fd7:	48 85 d2             	test   %rdx,%rdx
+  802fda:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802fdd:	89 c1                	mov    %eax,%ecx
+  802fdf:	83 c9 40             	or     $0x40,%ecx
+  802fe2:	f6 c6 04             	test   $0x4,%dh
+  802fe5:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802fe8:	5d                   	pop    %rbp
+  802fe9:	c3                   	ret
+
+0000000000802fea <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802fea:	55                   	push   %rbp
+  802feb:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802fee:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  802ff5:	00 00 00 
+  802ff8:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802ffa:	48 c1 e8 06          	shr    $0x6,%rax
+  802ffe:	83 e0 01             	and    $0x1,%eax
+}
+  803001:	5d                   	pop    %rbp
+  803002:	c3                   	ret
+
+0000000000803003 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803003:	55                   	push   %rbp
+  803004:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803007:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  80300e:	00 00 00 
+  803011:	ff d0                	call   *%rax
+  803013:	83 e0 01             	and    $0x1,%eax
+}
+  803016:	5d                   	pop    %rbp
+  803017:	c3                   	ret
+
+0000000000803018 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803018:	55                   	push   %rbp
+  803019:	48 89 e5             	mov    %rsp,%rbp
+  80301c:	41 57                	push   %r15
+  80301e:	41 56                	push   %r14
+  803020:	41 55                	push   %r13
+  803022:	41 54                	push   %r12
+  803024:	53                   	push   %rbx
+  803025:	48 83 ec 18          	sub    $0x18,%rsp
+  803029:	49 89 ff             	mov    %rdi,%r15
+  80302c:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  803030:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  803035:	49 bc 03 30 80 00 00 	movabs $0x803003,%r12
+  80303c:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  80303f:	49 be a4 2f 80 00 00 	movabs $0x802fa4,%r14
+  803046:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  803049:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  803050:	00 00 00 
+  803053:	eb 0c                	jmp    803061 <foreach_shared_region+0x49>
+  803055:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80305c:	4c 39 eb             	cmp    %r13,%rbx
+  80305f:	74 38                	je     803099 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  803061:	48 89 df             	mov    %rbx,%rdi
+  803064:	41 ff d4             	call   *%r12
+  803067:	84 c0                	test   %al,%al
+  803069:	74 ea                	je     803055 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  80306b:	48 89 df             	mov    %rbx,%rdi
+  80306e:	41 ff d6             	call   *%r14
+  803071:	a8 40                	test   $0x40,%al
+  803073:	74 e0                	je     803055 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  803075:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80307c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803080:	48 89 df             	mov    %rbx,%rdi
+  803083:	41 ff d7             	call   *%r15
+        if (err)
+  803086:	85 c0                	test   %eax,%eax
+  803088:	74 cb                	je     803055 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  80308a:	48 83 c4 18          	add    $0x18,%rsp
+  80308e:	5b                   	pop    %rbx
+  80308f:	41 5c                	pop    %r12
+  803091:	41 5d                	pop    %r13
+  803093:	41 5e                	pop    %r14
+  803095:	41 5f                	pop    %r15
+  803097:	5d                   	pop    %rbp
+  803098:	c3                   	ret
+    return 0;
+  803099:	b8 00 00 00 00       	mov    $0x0,%eax
+  80309e:	eb ea                	jmp    80308a <foreach_shared_region+0x72>
+
+00000000008030a0 <_generic_signal_handler>:
+        (es->sa.sa_handler)(es->signo);
+    }
+}
+
+void
+_generic_signal_handler(struct UTrapframe *utf, struct EnqueuedSignal * es) {
+  8030a0:	55                   	push   %rbp
+  8030a1:	48 89 e5             	mov    %rsp,%rbp
+  8030a4:	41 55                	push   %r13
+  8030a6:	41 54                	push   %r12
+  8030a8:	53                   	push   %rbx
+  8030a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8030ad:	49 89 fc             	mov    %rdi,%r12
+  8030b0:	48 89 f3             	mov    %rsi,%rbx
+    if (trace_signals)
+        cprintf("signals: env %x: begin generic handler for %d\n", sys_getenvid(), es->signo);
+  8030b3:	44 8b 2e             	mov    (%rsi),%r13d
+  8030b6:	48 b8 96 19 80 00 00 	movabs $0x801996,%rax
+  8030bd:	00 00 00 
+  8030c0:	ff d0                	call   *%rax
+  8030c2:	89 c6                	mov    %eax,%esi
+  8030c4:	44 89 ea             	mov    %r13d,%edx
+  8030c7:	48 bf 60 41 80 00 00 	movabs $0x804160,%rdi
+  8030ce:	00 00 00 
+  8030d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d6:	48 b9 81 0b 80 00 00 	movabs $0x800b81,%rcx
+  8030dd:	00 00 00 
+  8030e0:	ff d1                	call   *%rcx
+    if (es->sa.sa_handler == SIG_DFL) {
+  8030e2:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8030e6:	48 85 c0             	test   %rax,%rax
+  8030e9:	74 57                	je     803142 <_generic_signal_handler+0xa2>
+    if (es->sa.sa_handler == SIG_IGN) {
+  8030eb:	48 83 f8 01          	cmp    $0x1,%rax
+  8030ef:	0f 84 c0 00 00 00    	je     8031b5 <_generic_signal_handler+0x115>
+    if (es->sa.sa_flags & SA_SIGINFO) {
+  8030f5:	f6 43 14 04          	testb  $0x4,0x14(%rbx)
+  8030f9:	0f 84 ea 00 00 00    	je     8031e9 <_generic_signal_handler+0x149>
+        (es->sa.sa_sigaction)(es->signo, &(es->info), utf);
+  8030ff:	48 8d 73 18          	lea    0x18(%rbx),%rsi
+  803103:	8b 3b                	mov    (%rbx),%edi
+  803105:	4c 89 e2             	mov    %r12,%rdx
+  803108:	ff d0                	call   *%rax
+
+    _generic_signal_handler_impl(utf, es);
+
+    if (trace_signals)
+        cprintf("signals: env %x: end generic handler for %d\n", sys_getenvid(), es->signo);
+  80310a:	8b 1b                	mov    (%rbx),%ebx
+  80310c:	48 b8 96 19 80 00 00 	movabs $0x801996,%rax
+  803113:	00 00 00 
+  803116:	ff d0                	call   *%rax
+  803118:	89 c6                	mov    %eax,%esi
+  80311a:	89 da                	mov    %ebx,%edx
+  80311c:	48 bf e8 41 80 00 00 	movabs $0x8041e8,%rdi
+  803123:	00 00 00 
+  803126:	b8 00 00 00 00       	mov    $0x0,%eax
+  80312b:	48 b9 81 0b 80 00 00 	movabs $0x800b81,%rcx
+  803132:	00 00 00 
+  803135:	ff d1                	call   *%rcx
+}
+  803137:	48 83 c4 08          	add    $0x8,%rsp
+  80313b:	5b                   	pop    %rbx
+  80313c:	41 5c                	pop    %r12
+  80313e:	41 5d                	pop    %r13
+  803140:	5d                   	pop    %rbp
+  803141:	c3                   	ret
+            cprintf("signals: env %x: exiting due to signal %d\n", sys_getenvid(), es->signo);
+  803142:	8b 1b                	mov    (%rbx),%ebx
+  803144:	48 b8 96 19 80 00 00 	movabs $0x801996,%rax
+  80314b:	00 00 00 
+  80314e:	ff d0                	call   *%rax
+  803150:	89 c6                	mov    %eax,%esi
+  803152:	89 da                	mov    %ebx,%edx
+  803154:	48 bf 90 41 80 00 00 	movabs $0x804190,%rdi
+  80315b:	00 00 00 
+  80315e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803163:	48 b9 81 0b 80 00 00 	movabs $0x800b81,%rcx
+  80316a:	00 00 00 
+  80316d:	ff d1                	call   *%rcx
+        sys_env_destroy(CURENVID);
+  80316f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803174:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  80317b:	00 00 00 
+  80317e:	ff d0                	call   *%rax
+        assert(false);
+  803180:	48 b9 15 42 80 00 00 	movabs $0x804215,%rcx
+  803187:	00 00 00 
+  80318a:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  803191:	00 00 00 
+  803194:	be 0c 00 00 00       	mov    $0xc,%esi
+  803199:	48 bf 1b 42 80 00 00 	movabs $0x80421b,%rdi
+  8031a0:	00 00 00 
+  8031a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a8:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  8031af:	00 00 00 
+  8031b2:	41 ff d0             	call   *%r8
+            cprintf("signals: env %x: ignoring signal %d\n", sys_getenvid(), es->signo);
+  8031b5:	44 8b 23             	mov    (%rbx),%r12d
+  8031b8:	48 b8 96 19 80 00 00 	movabs $0x801996,%rax
+  8031bf:	00 00 00 
+  8031c2:	ff d0                	call   *%rax
+  8031c4:	89 c6                	mov    %eax,%esi
+  8031c6:	44 89 e2             	mov    %r12d,%edx
+  8031c9:	48 bf c0 41 80 00 00 	movabs $0x8041c0,%rdi
+  8031d0:	00 00 00 
+  8031d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d8:	48 b9 81 0b 80 00 00 	movabs $0x800b81,%rcx
+  8031df:	00 00 00 
+  8031e2:	ff d1                	call   *%rcx
+        return;
+  8031e4:	e9 21 ff ff ff       	jmp    80310a <_generic_signal_handler+0x6a>
+        (es->sa.sa_handler)(es->signo);
+  8031e9:	8b 3b                	mov    (%rbx),%edi
+  8031eb:	ff d0                	call   *%rax
+  8031ed:	e9 18 ff ff ff       	jmp    80310a <_generic_signal_handler+0x6a>
+
+00000000008031f2 <sigqueue>:
+
+int sigqueue(pid_t pid, int signo, const union sigval value) {
+  8031f2:	55                   	push   %rbp
+  8031f3:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigqueue(pid, signo, value);
+  8031f6:	48 b8 5a 1e 80 00 00 	movabs $0x801e5a,%rax
+  8031fd:	00 00 00 
+  803200:	ff d0                	call   *%rax
+}
+  803202:	5d                   	pop    %rbp
+  803203:	c3                   	ret
+
+0000000000803204 <sigwait>:
+
+int sigwait(const sigset_t * set, int * sig) {
+  803204:	55                   	push   %rbp
+  803205:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigwait(set, sig);
+  803208:	48 b8 c1 1e 80 00 00 	movabs $0x801ec1,%rax
+  80320f:	00 00 00 
+  803212:	ff d0                	call   *%rax
+}
+  803214:	5d                   	pop    %rbp
+  803215:	c3                   	ret
+
+0000000000803216 <sigaction>:
+
+extern void _signal_handler_trampoline(void);
+
+int sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  803216:	55                   	push   %rbp
+  803217:	48 89 e5             	mov    %rsp,%rbp
+  80321a:	41 55                	push   %r13
+  80321c:	41 54                	push   %r12
+  80321e:	53                   	push   %rbx
+  80321f:	48 83 ec 08          	sub    $0x8,%rsp
+  803223:	89 fb                	mov    %edi,%ebx
+  803225:	49 89 f4             	mov    %rsi,%r12
+  803228:	49 89 d5             	mov    %rdx,%r13
+    int err = sys_env_set_pgfault_upcall(CURENVID, _signal_handler_trampoline);
+  80322b:	48 be a8 34 80 00 00 	movabs $0x8034a8,%rsi
+  803232:	00 00 00 
+  803235:	bf 00 00 00 00       	mov    $0x0,%edi
+  80323a:	48 b8 2b 1d 80 00 00 	movabs $0x801d2b,%rax
+  803241:	00 00 00 
+  803244:	ff d0                	call   *%rax
+    if (err)
+  803246:	85 c0                	test   %eax,%eax
+  803248:	74 0b                	je     803255 <sigaction+0x3f>
+        return err;
+    return sys_sigaction(sig, act, oact);
+}
+  80324a:	48 83 c4 08          	add    $0x8,%rsp
+  80324e:	5b                   	pop    %rbx
+  80324f:	41 5c                	pop    %r12
+  803251:	41 5d                	pop    %r13
+  803253:	5d                   	pop    %rbp
+  803254:	c3                   	ret
+    return sys_sigaction(sig, act, oact);
+  803255:	4c 89 ea             	mov    %r13,%rdx
+  803258:	4c 89 e6             	mov    %r12,%rsi
+  80325b:	89 df                	mov    %ebx,%edi
+  80325d:	48 b8 2a 1f 80 00 00 	movabs $0x801f2a,%rax
+  803264:	00 00 00 
+  803267:	ff d0                	call   *%rax
+  803269:	eb df                	jmp    80324a <sigaction+0x34>
+
+000000000080326b <sigprocmask>:
+
+int sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  80326b:	55                   	push   %rbp
+  80326c:	48 89 e5             	mov    %rsp,%rbp
+    return sys_sigprocmask(how, set, oldset);
+  80326f:	48 b8 91 1f 80 00 00 	movabs $0x801f91,%rax
+  803276:	00 00 00 
+  803279:	ff d0                	call   *%rax
+}
+  80327b:	5d                   	pop    %rbp
+  80327c:	c3                   	ret
+
+000000000080327d <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80327d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803282:	c3                   	ret
+
+0000000000803283 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803283:	55                   	push   %rbp
+  803284:	48 89 e5             	mov    %rsp,%rbp
+  803287:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80328a:	48 be 28 42 80 00 00 	movabs $0x804228,%rsi
+  803291:	00 00 00 
+  803294:	48 b8 a6 14 80 00 00 	movabs $0x8014a6,%rax
+  80329b:	00 00 00 
+  80329e:	ff d0                	call   *%rax
+    return 0;
+}
+  8032a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032a5:	5d                   	pop    %rbp
+  8032a6:	c3                   	ret
+
+00000000008032a7 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8032a7:	55                   	push   %rbp
+  8032a8:	48 89 e5             	mov    %rsp,%rbp
+  8032ab:	41 57                	push   %r15
+  8032ad:	41 56                	push   %r14
+  8032af:	41 55                	push   %r13
+  8032b1:	41 54                	push   %r12
+  8032b3:	53                   	push   %rbx
+  8032b4:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8032bb:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8032c2:	48 85 d2             	test   %rdx,%rdx
+  8032c5:	74 7a                	je     803341 <devcons_write+0x9a>
+  8032c7:	49 89 d6             	mov    %rdx,%r14
+  8032ca:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8032d0:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8032d5:	49 bf a0 16 80 00 00 	movabs $0x8016a0,%r15
+  8032dc:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8032df:	4c 89 f3             	mov    %r14,%rbx
+  8032e2:	48 29 f3             	sub    %rsi,%rbx
+  8032e5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8032ea:	48 39 c3             	cmp    %rax,%rbx
+  8032ed:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8032f1:	4c 63 eb             	movslq %ebx,%r13
+  8032f4:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8032fb:	48 01 c6             	add    %rax,%rsi
+  8032fe:	4c 89 ea             	mov    %r13,%rdx
+  803301:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803308:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80330b:	4c 89 ee             	mov    %r13,%rsi
+  80330e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803315:	48 b8 cd 18 80 00 00 	movabs $0x8018cd,%rax
+  80331c:	00 00 00 
+  80331f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803321:	41 01 dc             	add    %ebx,%r12d
+  803324:	49 63 f4             	movslq %r12d,%rsi
+  803327:	4c 39 f6             	cmp    %r14,%rsi
+  80332a:	72 b3                	jb     8032df <devcons_write+0x38>
+    return res;
+  80332c:	49 63 c4             	movslq %r12d,%rax
+}
+  80332f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803336:	5b                   	pop    %rbx
+  803337:	41 5c                	pop    %r12
+  803339:	41 5d                	pop    %r13
+  80333b:	41 5e                	pop    %r14
+  80333d:	41 5f                	pop    %r15
+  80333f:	5d                   	pop    %rbp
+  803340:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803341:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803347:	eb e3                	jmp    80332c <devcons_write+0x85>
+
+0000000000803349 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803349:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80334c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803351:	48 85 c0             	test   %rax,%rax
+  803354:	74 55                	je     8033ab <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803356:	55                   	push   %rbp
+  803357:	48 89 e5             	mov    %rsp,%rbp
+  80335a:	41 55                	push   %r13
+  80335c:	41 54                	push   %r12
+  80335e:	53                   	push   %rbx
+  80335f:	48 83 ec 08          	sub    $0x8,%rsp
+  803363:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803366:	48 bb fa 18 80 00 00 	movabs $0x8018fa,%rbx
+  80336d:	00 00 00 
+  803370:	49 bc c7 19 80 00 00 	movabs $0x8019c7,%r12
+  803377:	00 00 00 
+  80337a:	eb 03                	jmp    80337f <devcons_read+0x36>
+  80337c:	41 ff d4             	call   *%r12
+  80337f:	ff d3                	call   *%rbx
+  803381:	85 c0                	test   %eax,%eax
+  803383:	74 f7                	je     80337c <devcons_read+0x33>
+    if (c < 0) return c;
+  803385:	48 63 d0             	movslq %eax,%rdx
+  803388:	78 13                	js     80339d <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80338a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80338f:	83 f8 04             	cmp    $0x4,%eax
+  803392:	74 09                	je     80339d <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803394:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803398:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80339d:	48 89 d0             	mov    %rdx,%rax
+  8033a0:	48 83 c4 08          	add    $0x8,%rsp
+  8033a4:	5b                   	pop    %rbx
+  8033a5:	41 5c                	pop    %r12
+  8033a7:	41 5d                	pop    %r13
+  8033a9:	5d                   	pop    %rbp
+  8033aa:	c3                   	ret
+  8033ab:	48 89 d0             	mov    %rdx,%rax
+  8033ae:	c3                   	ret
+
+00000000008033af <cputchar>:
+cputchar(int ch) {
+  8033af:	55                   	push   %rbp
+  8033b0:	48 89 e5             	mov    %rsp,%rbp
+  8033b3:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8033b7:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8033bb:	be 01 00 00 00       	mov    $0x1,%esi
+  8033c0:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8033c4:	48 b8 cd 18 80 00 00 	movabs $0x8018cd,%rax
+  8033cb:	00 00 00 
+  8033ce:	ff d0                	call   *%rax
+}
+  8033d0:	c9                   	leave
+  8033d1:	c3                   	ret
+
+00000000008033d2 <getchar>:
+getchar(void) {
+  8033d2:	55                   	push   %rbp
+  8033d3:	48 89 e5             	mov    %rsp,%rbp
+  8033d6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8033da:	ba 01 00 00 00       	mov    $0x1,%edx
+  8033df:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8033e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033e8:	48 b8 69 23 80 00 00 	movabs $0x802369,%rax
+  8033ef:	00 00 00 
+  8033f2:	ff d0                	call   *%rax
+  8033f4:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8033f6:	85 c0                	test   %eax,%eax
+  8033f8:	78 06                	js     803400 <getchar+0x2e>
+  8033fa:	74 08                	je     803404 <getchar+0x32>
+  8033fc:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803400:	89 d0                	mov    %edx,%eax
+  803402:	c9                   	leave
+  803403:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803404:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803409:	eb f5                	jmp    803400 <getchar+0x2e>
+
+000000000080340b <iscons>:
+iscons(int fdnum) {
+  80340b:	55                   	push   %rbp
+  80340c:	48 89 e5             	mov    %rsp,%rbp
+  80340f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803413:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803417:	48 b8 86 20 80 00 00 	movabs $0x802086,%rax
+  80341e:	00 00 00 
+  803421:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803423:	85 c0                	test   %eax,%eax
+  803425:	78 18                	js     80343f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803427:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80342b:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  803432:	00 00 00 
+  803435:	8b 00                	mov    (%rax),%eax
+  803437:	39 02                	cmp    %eax,(%rdx)
+  803439:	0f 94 c0             	sete   %al
+  80343c:	0f b6 c0             	movzbl %al,%eax
+}
+  80343f:	c9                   	leave
+  803440:	c3                   	ret
+
+0000000000803441 <opencons>:
+opencons(void) {
+  803441:	55                   	push   %rbp
+  803442:	48 89 e5             	mov    %rsp,%rbp
+  803445:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803449:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80344d:	48 b8 26 20 80 00 00 	movabs $0x802026,%rax
+  803454:	00 00 00 
+  803457:	ff d0                	call   *%rax
+  803459:	85 c0                	test   %eax,%eax
+  80345b:	78 49                	js     8034a6 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80345d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803462:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803467:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80346b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803470:	48 b8 56 1a 80 00 00 	movabs $0x801a56,%rax
+  803477:	00 00 00 
+  80347a:	ff d0                	call   *%rax
+  80347c:	85 c0                	test   %eax,%eax
+  80347e:	78 26                	js     8034a6 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803480:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803484:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  80348b:	00 00 
+  80348d:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80348f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803493:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80349a:	48 b8 f8 1f 80 00 00 	movabs $0x801ff8,%rax
+  8034a1:	00 00 00 
+  8034a4:	ff d0                	call   *%rax
+}
+  8034a6:	c9                   	leave
+  8034a7:	c3                   	ret
+
+00000000008034a8 <_pgfault_upcall>:
+.text
+.globl _pgfault_upcall
+.globl _signal_handler_trampoline
+_pgfault_upcall:
+_signal_handler_trampoline:
+    movq  %rsp,%rdi # passing the function argument (UTrapframe *) in rdi
+  8034a8:	48 89 e7             	mov    %rsp,%rdi
+    # sizeof(struct EnqueuedSignal) == 56
+    # sizeof(curenv->env_sig_mask) == 4
+    # + 4 bytes of alignment
+    add $64, %rdi
+  8034ab:	48 83 c7 40          	add    $0x40,%rdi
+
+    # load signo
+    mov (%rsp), %eax
+  8034af:	8b 04 24             	mov    (%rsp),%eax
+    test %eax, %eax
+  8034b2:	85 c0                	test   %eax,%eax
+    jnz _call_generic_signal_handler
+  8034b4:	75 0e                	jne    8034c4 <_call_generic_signal_handler>
+
+    # Call the C page fault handler.
+    movabs $_handle_vectored_pagefault, %rax
+  8034b6:	48 b8 e8 36 80 00 00 	movabs $0x8036e8,%rax
+  8034bd:	00 00 00 
+    call *%rax
+  8034c0:	ff d0                	call   *%rax
+    jmp _return_from_handler
+  8034c2:	eb 0f                	jmp    8034d3 <_return_from_handler>
+
+00000000008034c4 <_call_generic_signal_handler>:
+
+_call_generic_signal_handler:
+    movq %rsp, %rsi # passing the function argument (EnqueuedSignal *) in rsi
+  8034c4:	48 89 e6             	mov    %rsp,%rsi
+    movabs $_generic_signal_handler, %rax
+  8034c7:	48 b8 a0 30 80 00 00 	movabs $0x8030a0,%rax
+  8034ce:	00 00 00 
+    call *%rax
+  8034d1:	ff d0                	call   *%rax
+
+00000000008034d3 <_return_from_handler>:
+
+_return_from_handler:
+    # ignore EnqueuedSignal and env_sig_mask
+    add $64, %rsp
+  8034d3:	48 83 c4 40          	add    $0x40,%rsp
+    # put SIG_SETMASK as the first func arg
+    movq $3, %rdi
+  8034d7:	48 c7 c7 03 00 00 00 	mov    $0x3,%rdi
+    # load &env_sig_mask (as the second func arg)
+    lea -4(%rsp), %rsi
+  8034de:	48 8d 74 24 fc       	lea    -0x4(%rsp),%rsi
+    # NULL as the third arg
+    xor %rdx, %rdx
+  8034e3:	48 31 d2             	xor    %rdx,%rdx
+    # restore blocked signals mask
+    movabs $sys_sigprocmask, %rax
+  8034e6:	48 b8 91 1f 80 00 00 	movabs $0x801f91,%rax
+  8034ed:	00 00 00 
+    call *%rax
+  8034f0:	ff d0                	call   *%rax
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    # ignore utf_fault_va, utf_err
+    addq $16, %rsp
+  8034f2:	48 83 c4 10          	add    $0x10,%rsp
+    # restore utf_regs, save rax again
+    POPA
+  8034f6:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8034fa:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8034ff:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  803504:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  803509:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80350e:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  803513:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  803518:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80351d:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  803522:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  803527:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80352c:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  803531:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  803536:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80353b:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  803540:	48 83 c4 78          	add    $0x78,%rsp
+    pushq %rax
+  803544:	50                   	push   %rax
+    # 16 utf_rflags
+    #  8 utf_rip
+    #  0 rax
+
+    # load utf_rip
+    movq 8(%rsp), %rax
+  803545:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    # save rbx to utf_rip
+    movq %rbx, 8(%rsp)
+  80354a:	48 89 5c 24 08       	mov    %rbx,0x8(%rsp)
+    # load utf_rsp
+    movq 24(%rsp), %rbx
+  80354f:	48 8b 5c 24 18       	mov    0x18(%rsp),%rbx
+    # store return address to *utf_stack
+    subq $8, 24(%rsp)
+  803554:	48 83 6c 24 18 08    	subq   $0x8,0x18(%rsp)
+    movq %rax, -8(%rbx)
+  80355a:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    # restore rax and rbx
+    popq %rax
+  80355e:	58                   	pop    %rax
+    popq %rbx
+  80355f:	5b                   	pop    %rbx
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+    popfq
+  803560:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+    popq %rsp
+  803561:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  803562:	c3                   	ret
+
+0000000000803563 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803563:	55                   	push   %rbp
+  803564:	48 89 e5             	mov    %rsp,%rbp
+  803567:	41 54                	push   %r12
+  803569:	53                   	push   %rbx
+  80356a:	48 89 fb             	mov    %rdi,%rbx
+  80356d:	48 89 f7             	mov    %rsi,%rdi
+  803570:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  803573:	48 85 f6             	test   %rsi,%rsi
+  803576:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80357d:	00 00 00 
+  803580:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  803584:	be 00 10 00 00       	mov    $0x1000,%esi
+  803589:	48 b8 c0 1d 80 00 00 	movabs $0x801dc0,%rax
+  803590:	00 00 00 
+  803593:	ff d0                	call   *%rax
+    if (res < 0) {
+  803595:	85 c0                	test   %eax,%eax
+  803597:	78 45                	js     8035de <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  803599:	48 85 db             	test   %rbx,%rbx
+  80359c:	74 12                	je     8035b0 <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  80359e:	48 a1 20 60 80 00 00 	movabs 0x806020,%rax
+  8035a5:	00 00 00 
+  8035a8:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8035ae:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  8035b0:	4d 85 e4             	test   %r12,%r12
+  8035b3:	74 14                	je     8035c9 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  8035b5:	48 a1 20 60 80 00 00 	movabs 0x806020,%rax
+  8035bc:	00 00 00 
+  8035bf:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8035c5:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  8035c9:	48 a1 20 60 80 00 00 	movabs 0x806020,%rax
+  8035d0:	00 00 00 
+  8035d3:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  8035d9:	5b                   	pop    %rbx
+  8035da:	41 5c                	pop    %r12
+  8035dc:	5d                   	pop    %rbp
+  8035dd:	c3                   	ret
+        if (from_env_store)
+  8035de:	48 85 db             	test   %rbx,%rbx
+  8035e1:	74 06                	je     8035e9 <ipc_recv+0x86>
+            *from_env_store = 0;
+  8035e3:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  8035e9:	4d 85 e4             	test   %r12,%r12
+  8035ec:	74 eb                	je     8035d9 <ipc_recv+0x76>
+            *perm_store = 0;
+  8035ee:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8035f5:	00 
+  8035f6:	eb e1                	jmp    8035d9 <ipc_recv+0x76>
+
+00000000008035f8 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8035f8:	55                   	push   %rbp
+  8035f9:	48 89 e5             	mov    %rsp,%rbp
+  8035fc:	41 57                	push   %r15
+  8035fe:	41 56                	push   %r14
+  803600:	41 55                	push   %r13
+  803602:	41 54                	push   %r12
+  803604:	53                   	push   %rbx
+  803605:	48 83 ec 18          	sub    $0x18,%rsp
+  803609:	41 89 fd             	mov    %edi,%r13d
+  80360c:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80360f:	48 89 d3             	mov    %rdx,%rbx
+  803612:	49 89 cc             	mov    %rcx,%r12
+  803615:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  803619:	48 85 d2             	test   %rdx,%rdx
+  80361c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803623:	00 00 00 
+  803626:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80362a:	49 be 94 1d 80 00 00 	movabs $0x801d94,%r14
+  803631:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  803634:	49 bf c7 19 80 00 00 	movabs $0x8019c7,%r15
+  80363b:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  80363e:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803641:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  803645:	4c 89 e1             	mov    %r12,%rcx
+  803648:	48 89 da             	mov    %rbx,%rdx
+  80364b:	44 89 ef             	mov    %r13d,%edi
+  80364e:	41 ff d6             	call   *%r14
+        if (res == 0)
+  803651:	85 c0                	test   %eax,%eax
+  803653:	74 34                	je     803689 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  803655:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803658:	75 05                	jne    80365f <ipc_send+0x67>
+        sys_yield();
+  80365a:	41 ff d7             	call   *%r15
+    while (true) {
+  80365d:	eb df                	jmp    80363e <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  80365f:	48 ba 34 42 80 00 00 	movabs $0x804234,%rdx
+  803666:	00 00 00 
+  803669:	be 3e 00 00 00       	mov    $0x3e,%esi
+  80366e:	48 bf 4d 42 80 00 00 	movabs $0x80424d,%rdi
+  803675:	00 00 00 
+  803678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367d:	48 b9 31 0a 80 00 00 	movabs $0x800a31,%rcx
+  803684:	00 00 00 
+  803687:	ff d1                	call   *%rcx
+    }
+}
+  803689:	48 83 c4 18          	add    $0x18,%rsp
+  80368d:	5b                   	pop    %rbx
+  80368e:	41 5c                	pop    %r12
+  803690:	41 5d                	pop    %r13
+  803692:	41 5e                	pop    %r14
+  803694:	41 5f                	pop    %r15
+  803696:	5d                   	pop    %rbp
+  803697:	c3                   	ret
+
+0000000000803698 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803698:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80369d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8036a4:	00 00 00 
+  8036a7:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  8036ae:	48 01 ca             	add    %rcx,%rdx
+  8036b1:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8036b7:	39 fa                	cmp    %edi,%edx
+  8036b9:	74 12                	je     8036cd <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8036bb:	48 83 c0 01          	add    $0x1,%rax
+  8036bf:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8036c5:	75 e0                	jne    8036a7 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8036c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036cc:	c3                   	ret
+            return envs[i].env_id;
+  8036cd:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  8036d4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8036db:	00 00 00 
+  8036de:	48 01 d0             	add    %rdx,%rax
+  8036e1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8036e7:	c3                   	ret
+
+00000000008036e8 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8036e8:	55                   	push   %rbp
+  8036e9:	48 89 e5             	mov    %rsp,%rbp
+  8036ec:	41 56                	push   %r14
+  8036ee:	41 55                	push   %r13
+  8036f0:	41 54                	push   %r12
+  8036f2:	53                   	push   %rbx
+  8036f3:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8036f6:	48 b8 68 80 80 00 00 	movabs $0x808068,%rax
+  8036fd:	00 00 00 
+  803700:	48 83 38 00          	cmpq   $0x0,(%rax)
+  803704:	74 27                	je     80372d <_handle_vectored_pagefault+0x45>
+  803706:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80370b:	49 bd 20 80 80 00 00 	movabs $0x808020,%r13
+  803712:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803715:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  803718:	4c 89 e7             	mov    %r12,%rdi
+  80371b:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  803720:	84 c0                	test   %al,%al
+  803722:	75 45                	jne    803769 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803724:	48 83 c3 01          	add    $0x1,%rbx
+  803728:	49 3b 1e             	cmp    (%r14),%rbx
+  80372b:	72 eb                	jb     803718 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80372d:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  803734:	00 
+  803735:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80373a:	4d 8b 04 24          	mov    (%r12),%r8
+  80373e:	48 ba 58 42 80 00 00 	movabs $0x804258,%rdx
+  803745:	00 00 00 
+  803748:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80374d:	48 bf ef 42 80 00 00 	movabs $0x8042ef,%rdi
+  803754:	00 00 00 
+  803757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80375c:	49 ba 31 0a 80 00 00 	movabs $0x800a31,%r10
+  803763:	00 00 00 
+  803766:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  803769:	5b                   	pop    %rbx
+  80376a:	41 5c                	pop    %r12
+  80376c:	41 5d                	pop    %r13
+  80376e:	41 5e                	pop    %r14
+  803770:	5d                   	pop    %rbp
+  803771:	c3                   	ret
+
+0000000000803772 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  803772:	55                   	push   %rbp
+  803773:	48 89 e5             	mov    %rsp,%rbp
+  803776:	53                   	push   %rbx
+  803777:	48 83 ec 08          	sub    $0x8,%rsp
+  80377b:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80377e:	48 b8 60 80 80 00 00 	movabs $0x808060,%rax
+  803785:	00 00 00 
+  803788:	80 38 00             	cmpb   $0x0,(%rax)
+  80378b:	74 61                	je     8037ee <add_pgfault_handler+0x7c>
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80378d:	48 b8 68 80 80 00 00 	movabs $0x808068,%rax
+  803794:	00 00 00 
+  803797:	48 8b 10             	mov    (%rax),%rdx
+  80379a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80379f:	48 b9 20 80 80 00 00 	movabs $0x808020,%rcx
+  8037a6:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8037a9:	48 85 d2             	test   %rdx,%rdx
+  8037ac:	74 19                	je     8037c7 <add_pgfault_handler+0x55>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8037ae:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8037b2:	74 2f                	je     8037e3 <add_pgfault_handler+0x71>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8037b4:	48 83 c0 01          	add    $0x1,%rax
+  8037b8:	48 39 d0             	cmp    %rdx,%rax
+  8037bb:	75 f1                	jne    8037ae <add_pgfault_handler+0x3c>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8037bd:	48 83 fa 08          	cmp    $0x8,%rdx
+  8037c1:	0f 84 f7 00 00 00    	je     8038be <add_pgfault_handler+0x14c>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8037c7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8037cb:	48 a3 68 80 80 00 00 	movabs %rax,0x808068
+  8037d2:	00 00 00 
+  8037d5:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8037dc:	00 00 00 
+  8037df:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  8037e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037ec:	c9                   	leave
+  8037ed:	c3                   	ret
+        if (sys_alloc_region(CURENVID, ues_beg, PAGE_SIZE, PROT_RW))
+  8037ee:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8037f3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037f8:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8037ff:	00 00 00 
+  803802:	bf 00 00 00 00       	mov    $0x0,%edi
+  803807:	48 b8 56 1a 80 00 00 	movabs $0x801a56,%rax
+  80380e:	00 00 00 
+  803811:	ff d0                	call   *%rax
+  803813:	85 c0                	test   %eax,%eax
+  803815:	75 53                	jne    80386a <add_pgfault_handler+0xf8>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  803817:	48 ba 68 80 80 00 00 	movabs $0x808068,%rdx
+  80381e:	00 00 00 
+  803821:	48 8b 02             	mov    (%rdx),%rax
+  803824:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803828:	48 89 0a             	mov    %rcx,(%rdx)
+  80382b:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  803832:	00 00 00 
+  803835:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        if (sys_env_set_pgfault_upcall(CURENVID, _pgfault_upcall))
+  803839:	48 be a8 34 80 00 00 	movabs $0x8034a8,%rsi
+  803840:	00 00 00 
+  803843:	bf 00 00 00 00       	mov    $0x0,%edi
+  803848:	48 b8 2b 1d 80 00 00 	movabs $0x801d2b,%rax
+  80384f:	00 00 00 
+  803852:	ff d0                	call   *%rax
+  803854:	85 c0                	test   %eax,%eax
+  803856:	75 3c                	jne    803894 <add_pgfault_handler+0x122>
+        _pfhandler_inititiallized = 1;
+  803858:	48 b8 60 80 80 00 00 	movabs $0x808060,%rax
+  80385f:	00 00 00 
+  803862:	c6 00 01             	movb   $0x1,(%rax)
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803865:	e9 79 ff ff ff       	jmp    8037e3 <add_pgfault_handler+0x71>
+            panic("add_pgfault_handler: sys_alloc_region failed");
+  80386a:	48 ba 88 42 80 00 00 	movabs $0x804288,%rdx
+  803871:	00 00 00 
+  803874:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803879:	48 bf ef 42 80 00 00 	movabs $0x8042ef,%rdi
+  803880:	00 00 00 
+  803883:	b8 00 00 00 00       	mov    $0x0,%eax
+  803888:	48 b9 31 0a 80 00 00 	movabs $0x800a31,%rcx
+  80388f:	00 00 00 
+  803892:	ff d1                	call   *%rcx
+            panic("add_pgfault_handler: sys_env_set_pgfault_upcall failed");
+  803894:	48 ba b8 42 80 00 00 	movabs $0x8042b8,%rdx
+  80389b:	00 00 00 
+  80389e:	be 32 00 00 00       	mov    $0x32,%esi
+  8038a3:	48 bf ef 42 80 00 00 	movabs $0x8042ef,%rdi
+  8038aa:	00 00 00 
+  8038ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b2:	48 b9 31 0a 80 00 00 	movabs $0x800a31,%rcx
+  8038b9:	00 00 00 
+  8038bc:	ff d1                	call   *%rcx
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8038be:	b9 fd ff ff ff       	mov    $0xfffffffd,%ecx
+  8038c3:	48 ba fd 42 80 00 00 	movabs $0x8042fd,%rdx
+  8038ca:	00 00 00 
+  8038cd:	be 40 00 00 00       	mov    $0x40,%esi
+  8038d2:	48 bf ef 42 80 00 00 	movabs $0x8042ef,%rdi
+  8038d9:	00 00 00 
+  8038dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038e1:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  8038e8:	00 00 00 
+  8038eb:	41 ff d0             	call   *%r8
+
+00000000008038ee <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8038ee:	55                   	push   %rbp
+  8038ef:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8038f2:	48 b8 60 80 80 00 00 	movabs $0x808060,%rax
+  8038f9:	00 00 00 
+  8038fc:	80 38 00             	cmpb   $0x0,(%rax)
+  8038ff:	74 33                	je     803934 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803901:	48 a1 68 80 80 00 00 	movabs 0x808068,%rax
+  803908:	00 00 00 
+  80390b:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  803910:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  803917:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80391a:	48 85 c0             	test   %rax,%rax
+  80391d:	0f 84 85 00 00 00    	je     8039a8 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  803923:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  803927:	74 40                	je     803969 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803929:	48 83 c1 01          	add    $0x1,%rcx
+  80392d:	48 39 c1             	cmp    %rax,%rcx
+  803930:	75 f1                	jne    803923 <remove_pgfault_handler+0x35>
+  803932:	eb 74                	jmp    8039a8 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  803934:	48 b9 15 43 80 00 00 	movabs $0x804315,%rcx
+  80393b:	00 00 00 
+  80393e:	48 ba c1 39 80 00 00 	movabs $0x8039c1,%rdx
+  803945:	00 00 00 
+  803948:	be 46 00 00 00       	mov    $0x46,%esi
+  80394d:	48 bf ef 42 80 00 00 	movabs $0x8042ef,%rdi
+  803954:	00 00 00 
+  803957:	b8 00 00 00 00       	mov    $0x0,%eax
+  80395c:	49 b8 31 0a 80 00 00 	movabs $0x800a31,%r8
+  803963:	00 00 00 
+  803966:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  803969:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  803970:	00 
+  803971:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803975:	48 29 ca             	sub    %rcx,%rdx
+  803978:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80397f:	00 00 00 
+  803982:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  803986:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80398b:	48 89 ce             	mov    %rcx,%rsi
+  80398e:	48 b8 a0 16 80 00 00 	movabs $0x8016a0,%rax
+  803995:	00 00 00 
+  803998:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80399a:	48 b8 68 80 80 00 00 	movabs $0x808068,%rax
+  8039a1:	00 00 00 
+  8039a4:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8039a8:	5d                   	pop    %rbp
+  8039a9:	c3                   	ret
+  8039aa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000008039b0 <__rodata_start>:
+  8039b0:	73 69                	jae    803a1b <__rodata_start+0x6b>
+  8039b2:	67 6e                	outsb  %ds:(%esi),(%dx)
+  8039b4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039b5:	20 3d 3d 20 53 49    	and    %bh,0x4953203d(%rip)        # 49d359f8 <__bss_end+0x4952c9f8>
+  8039bb:	47                   	rex.RXB
+  8039bc:	43                   	rex.XB
+  8039bd:	48                   	rex.W
+  8039be:	4c                   	rex.WR
+  8039bf:	44 00 61 73          	add    %r12b,0x73(%rcx)
+  8039c3:	73 65                	jae    803a2a <__rodata_start+0x7a>
+  8039c5:	72 74                	jb     803a3b <__rodata_start+0x8b>
+  8039c7:	69 6f 6e 20 66 61 69 	imul   $0x69616620,0x6e(%rdi),%ebp
+  8039ce:	6c                   	insb   (%dx),%es:(%rdi)
+  8039cf:	65 64 3a 20          	gs cmp %fs:(%rax),%ah
+  8039d3:	25 73 00 75 73       	and    $0x73750073,%eax
+  8039d8:	65 72 2f             	gs jb  803a0a <__rodata_start+0x5a>
+  8039db:	74 65                	je     803a42 <__rodata_start+0x92>
+  8039dd:	73 74                	jae    803a53 <__rodata_start+0xa3>
+  8039df:	73 69                	jae    803a4a <__rodata_start+0x9a>
+  8039e1:	67 2e 63 00          	cs movsxd (%eax),%eax
+  8039e5:	64 65 70 74          	fs gs jo 803a5d <__rodata_start+0xad>
+  8039e9:	68 20 3d 3d 20       	push   $0x203d3d20
+  8039ee:	30 00                	xor    %al,(%rax)
+  8039f0:	65 72 72             	gs jb  803a65 <__rodata_start+0xb5>
+  8039f3:	20 3d 3d 20 30 00    	and    %bh,0x30203d(%rip)        # b05a36 <__bss_end+0x2fca36>
+  8039f9:	63 68 6c             	movsxd 0x6c(%rax),%ebp
+  8039fc:	64 63 6e 74          	movsxd %fs:0x74(%rsi),%ebp
+  803a00:	72 20                	jb     803a22 <__rodata_start+0x72>
+  803a02:	3d 3d 20 31 00       	cmp    $0x31203d,%eax
+  803a07:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a08:	6c                   	insb   (%dx),%es:(%rdi)
+  803a09:	64 5f                	fs pop %rdi
+  803a0b:	73 61                	jae    803a6e <__rodata_start+0xbe>
+  803a0d:	2e 73 61             	jae,pn 803a71 <__rodata_start+0xc1>
+  803a10:	5f                   	pop    %rdi
+  803a11:	68 61 6e 64 6c       	push   $0x6c646e61
+  803a16:	65 72 20             	gs jb  803a39 <__rodata_start+0x89>
+  803a19:	3d 3d 20 53 49       	cmp    $0x4953203d,%eax
+  803a1e:	47 5f                	rex.RXB pop %r15
+  803a20:	49                   	rex.WB
+  803a21:	47                   	rex.RXB
+  803a22:	4e 00 6f 6c          	rex.WRX add %r13b,0x6c(%rdi)
+  803a26:	64 5f                	fs pop %rdi
+  803a28:	73 61                	jae    803a8b <__rodata_start+0xdb>
+  803a2a:	2e 73 61             	jae,pn 803a8e <__rodata_start+0xde>
+  803a2d:	5f                   	pop    %rdi
+  803a2e:	66 6c                	data16 insb (%dx),%es:(%rdi)
+  803a30:	61                   	(bad)
+  803a31:	67 73 20             	addr32 jae 803a54 <__rodata_start+0xa4>
+  803a34:	3d 3d 20 53 41       	cmp    $0x4153203d,%eax
+  803a39:	5f                   	pop    %rdi
+  803a3a:	4e                   	rex.WRX
+  803a3b:	4f                   	rex.WRXB
+  803a3c:	44                   	rex.R
+  803a3d:	45                   	rex.RB
+  803a3e:	46                   	rex.RX
+  803a3f:	45 52                	rex.RB push %r10
+  803a41:	00 69 6e             	add    %ch,0x6e(%rcx)
+  803a44:	74 63                	je     803aa9 <__rodata_start+0xf9>
+  803a46:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a47:	75 6e                	jne    803ab7 <__rodata_start+0x107>
+  803a49:	74 20                	je     803a6b <__rodata_start+0xbb>
+  803a4b:	3d 3d 20 31 31       	cmp    $0x3131203d,%eax
+  803a50:	00 21                	add    %ah,(%rcx)
+  803a52:	72 65                	jb     803ab9 <__rodata_start+0x109>
+  803a54:	61                   	(bad)
+  803a55:	63 68 65             	movsxd 0x65(%rax),%ebp
+  803a58:	64 5f                	fs pop %rdi
+  803a5a:	6d                   	insl   (%dx),%es:(%rdi)
+  803a5b:	61                   	(bad)
+  803a5c:	78 5f                	js     803abd <__rodata_start+0x10d>
+  803a5e:	64 65 70 74          	fs gs jo 803ad6 <__rodata_start+0x126>
+  803a62:	68 00 74 65 72       	push   $0x72657400
+  803a67:	6d                   	insl   (%dx),%es:(%rdi)
+  803a68:	63 6f 75             	movsxd 0x75(%rdi),%ebp
+  803a6b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a6c:	74 20                	je     803a8e <__rodata_start+0xde>
+  803a6e:	3d 3d 20 34 00       	cmp    $0x34203d,%eax
+  803a73:	54                   	push   %rsp
+  803a74:	65 73 74             	gs jae 803aeb <__rodata_start+0x13b>
+  803a77:	20 66 69             	and    %ah,0x69(%rsi)
+  803a7a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a7b:	69 73 68 65 64 0a 00 	imul   $0xa6465,0x68(%rbx),%esi
+  803a82:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  803a88:	28 6f 6c             	sub    %ch,0x6c(%rdi)
+  803a8b:	64 5f                	fs pop %rdi
+  803a8d:	73 61                	jae    803af0 <__rodata_start+0x140>
+  803a8f:	2e 73 61             	jae,pn 803af3 <__rodata_start+0x143>
+  803a92:	5f                   	pop    %rdi
+  803a93:	66 6c                	data16 insb (%dx),%es:(%rdi)
+  803a95:	61                   	(bad)
+  803a96:	67 73 20             	addr32 jae 803ab9 <__rodata_start+0x109>
+  803a99:	26 20 53 41          	es and %dl,0x41(%rbx)
+  803a9d:	5f                   	pop    %rdi
+  803a9e:	53                   	push   %rbx
+  803a9f:	49                   	rex.WB
+  803aa0:	47                   	rex.RXB
+  803aa1:	49                   	rex.WB
+  803aa2:	4e                   	rex.WRX
+  803aa3:	46                   	rex.RX
+  803aa4:	4f 29 20             	rex.WRXB sub %r12,(%r8)
+  803aa7:	3d 3d 20 30 00       	cmp    $0x30203d,%eax
+  803aac:	00 00                	add    %al,(%rax)
+  803aae:	00 00                	add    %al,(%rax)
+  803ab0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ab1:	6c                   	insb   (%dx),%es:(%rdi)
+  803ab2:	64 5f                	fs pop %rdi
+  803ab4:	73 61                	jae    803b17 <__rodata_start+0x167>
+  803ab6:	2e 73 61             	jae,pn 803b1a <__rodata_start+0x16a>
+  803ab9:	5f                   	pop    %rdi
+  803aba:	68 61 6e 64 6c       	push   $0x6c646e61
+  803abf:	65 72 20             	gs jb  803ae2 <__rodata_start+0x132>
+  803ac2:	3d 3d 20 68 61       	cmp    $0x6168203d,%eax
+  803ac7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ac8:	64 6c                	fs insb (%dx),%es:(%rdi)
+  803aca:	65 72 5f             	gs jb  803b2c <__rodata_start+0x17c>
+  803acd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ace:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803acf:	64 65 66 65 72 00    	fs gs data16 gs jb 803ad5 <__rodata_start+0x125>
+  803ad5:	3c 75                	cmp    $0x75,%al
+  803ad7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ad8:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803adc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803add:	3e 00 90 5b 25 30 38 	ds add %dl,0x3830255b(%rax)
+  803ae4:	78 5d                	js     803b43 <__rodata_start+0x193>
+  803ae6:	20 75 73             	and    %dh,0x73(%rbp)
+  803ae9:	65 72 20             	gs jb  803b0c <__rodata_start+0x15c>
+  803aec:	70 61                	jo     803b4f <__rodata_start+0x19f>
+  803aee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803aef:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803af6:	73 20                	jae    803b18 <__rodata_start+0x168>
+  803af8:	61                   	(bad)
+  803af9:	74 20                	je     803b1b <__rodata_start+0x16b>
+  803afb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803b00:	3a 20                	cmp    (%rax),%ah
+  803b02:	00 30                	add    %dh,(%rax)
+  803b04:	31 32                	xor    %esi,(%rdx)
+  803b06:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803b0d:	41                   	rex.B
+  803b0e:	42                   	rex.X
+  803b0f:	43                   	rex.XB
+  803b10:	44                   	rex.R
+  803b11:	45                   	rex.RB
+  803b12:	46 00 30             	rex.RX add %r14b,(%rax)
+  803b15:	31 32                	xor    %esi,(%rdx)
+  803b17:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803b1e:	61                   	(bad)
+  803b1f:	62 63 64 65 66       	(bad)
+  803b24:	00 28                	add    %ch,(%rax)
+  803b26:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b27:	75 6c                	jne    803b95 <__rodata_start+0x1e5>
+  803b29:	6c                   	insb   (%dx),%es:(%rdi)
+  803b2a:	29 00                	sub    %eax,(%rax)
+  803b2c:	65 72 72             	gs jb  803ba1 <__rodata_start+0x1f1>
+  803b2f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b30:	72 20                	jb     803b52 <__rodata_start+0x1a2>
+  803b32:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803b37:	73 70                	jae    803ba9 <__rodata_start+0x1f9>
+  803b39:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803b3d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803b44:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b45:	72 00                	jb     803b47 <__rodata_start+0x197>
+  803b47:	62 61 64 20 65       	(bad)
+  803b4c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b4d:	76 69                	jbe    803bb8 <__rodata_start+0x208>
+  803b4f:	72 6f                	jb     803bc0 <__rodata_start+0x210>
+  803b51:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b52:	6d                   	insl   (%dx),%es:(%rdi)
+  803b53:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b55:	74 00                	je     803b57 <__rodata_start+0x1a7>
+  803b57:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803b5e:	20 70 61             	and    %dh,0x61(%rax)
+  803b61:	72 61                	jb     803bc4 <__rodata_start+0x214>
+  803b63:	6d                   	insl   (%dx),%es:(%rdi)
+  803b64:	65 74 65             	gs je  803bcc <__rodata_start+0x21c>
+  803b67:	72 00                	jb     803b69 <__rodata_start+0x1b9>
+  803b69:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b6a:	75 74                	jne    803be0 <__rodata_start+0x230>
+  803b6c:	20 6f 66             	and    %ch,0x66(%rdi)
+  803b6f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803b72:	6d                   	insl   (%dx),%es:(%rdi)
+  803b73:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b74:	72 79                	jb     803bef <__rodata_start+0x23f>
+  803b76:	00 6f 75             	add    %ch,0x75(%rdi)
+  803b79:	74 20                	je     803b9b <__rodata_start+0x1eb>
+  803b7b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b7c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803b80:	76 69                	jbe    803beb <__rodata_start+0x23b>
+  803b82:	72 6f                	jb     803bf3 <__rodata_start+0x243>
+  803b84:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b85:	6d                   	insl   (%dx),%es:(%rdi)
+  803b86:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b88:	74 73                	je     803bfd <__rodata_start+0x24d>
+  803b8a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803b8d:	72 72                	jb     803c01 <__rodata_start+0x251>
+  803b8f:	75 70                	jne    803c01 <__rodata_start+0x251>
+  803b91:	74 65                	je     803bf8 <__rodata_start+0x248>
+  803b93:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803b98:	75 67                	jne    803c01 <__rodata_start+0x251>
+  803b9a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803b9d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803b9f:	00 73 65             	add    %dh,0x65(%rbx)
+  803ba2:	67 6d                	insl   (%dx),%es:(%edi)
+  803ba4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ba6:	74 61                	je     803c09 <__rodata_start+0x259>
+  803ba8:	74 69                	je     803c13 <__rodata_start+0x263>
+  803baa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bab:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bac:	20 66 61             	and    %ah,0x61(%rsi)
+  803baf:	75 6c                	jne    803c1d <__rodata_start+0x26d>
+  803bb1:	74 00                	je     803bb3 <__rodata_start+0x203>
+  803bb3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803bba:	20 45 4c             	and    %al,0x4c(%rbp)
+  803bbd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803bc1:	61                   	(bad)
+  803bc2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803bc7:	20 73 75             	and    %dh,0x75(%rbx)
+  803bca:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803bcd:	73 79                	jae    803c48 <__rodata_start+0x298>
+  803bcf:	73 74                	jae    803c45 <__rodata_start+0x295>
+  803bd1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803bd3:	20 63 61             	and    %ah,0x61(%rbx)
+  803bd6:	6c                   	insb   (%dx),%es:(%rdi)
+  803bd7:	6c                   	insb   (%dx),%es:(%rdi)
+  803bd8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803bdb:	74 72                	je     803c4f <__rodata_start+0x29f>
+  803bdd:	79 20                	jns    803bff <__rodata_start+0x24f>
+  803bdf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803be0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803be1:	74 20                	je     803c03 <__rodata_start+0x253>
+  803be3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803be5:	75 6e                	jne    803c55 <__rodata_start+0x2a5>
+  803be7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803beb:	76 20                	jbe    803c0d <__rodata_start+0x25d>
+  803bed:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803bf4:	72 65                	jb     803c5b <__rodata_start+0x2ab>
+  803bf6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803bf9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bfa:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803bfe:	65 78 70             	gs js  803c71 <__rodata_start+0x2c1>
+  803c01:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803c06:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803c09:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803c0d:	20 66 69             	and    %ah,0x69(%rsi)
+  803c10:	6c                   	insb   (%dx),%es:(%rdi)
+  803c11:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803c15:	20 66 72             	and    %ah,0x72(%rsi)
+  803c18:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803c1d:	61                   	(bad)
+  803c1e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803c21:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c22:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c23:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803c27:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803c2a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c2b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c2c:	20 6d 61             	and    %ch,0x61(%rbp)
+  803c2f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c30:	79 20                	jns    803c52 <__rodata_start+0x2a2>
+  803c32:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803c39:	72 65                	jb     803ca0 <__rodata_start+0x2f0>
+  803c3b:	20 6f 70             	and    %ch,0x70(%rdi)
+  803c3e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c40:	00 66 69             	add    %ah,0x69(%rsi)
+  803c43:	6c                   	insb   (%dx),%es:(%rdi)
+  803c44:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803c48:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803c4b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c4c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803c4f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c50:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c51:	74 20                	je     803c73 <__rodata_start+0x2c3>
+  803c53:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c55:	75 6e                	jne    803cc5 <__rodata_start+0x315>
+  803c57:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803c5b:	76 61                	jbe    803cbe <__rodata_start+0x30e>
+  803c5d:	6c                   	insb   (%dx),%es:(%rdi)
+  803c5e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803c65:	00 
+  803c66:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803c6d:	72 65                	jb     803cd4 <__rodata_start+0x324>
+  803c6f:	61                   	(bad)
+  803c70:	64 79 20             	fs jns 803c93 <__rodata_start+0x2e3>
+  803c73:	65 78 69             	gs js  803cdf <__rodata_start+0x32f>
+  803c76:	73 74                	jae    803cec <__rodata_start+0x33c>
+  803c78:	73 00                	jae    803c7a <__rodata_start+0x2ca>
+  803c7a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c7b:	70 65                	jo     803ce2 <__rodata_start+0x332>
+  803c7d:	72 61                	jb     803ce0 <__rodata_start+0x330>
+  803c7f:	74 69                	je     803cea <__rodata_start+0x33a>
+  803c81:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c82:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c83:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803c86:	74 20                	je     803ca8 <__rodata_start+0x2f8>
+  803c88:	73 75                	jae    803cff <__rodata_start+0x34f>
+  803c8a:	70 70                	jo     803cfc <__rodata_start+0x34c>
+  803c8c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c8d:	72 74                	jb     803d03 <__rodata_start+0x353>
+  803c8f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803c94:	65 72 61             	gs jb  803cf8 <__rodata_start+0x348>
+  803c97:	74 69                	je     803d02 <__rodata_start+0x352>
+  803c99:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c9a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c9b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803c9e:	74 20                	je     803cc0 <__rodata_start+0x310>
+  803ca0:	70 65                	jo     803d07 <__rodata_start+0x357>
+  803ca2:	72 6d                	jb     803d11 <__rodata_start+0x361>
+  803ca4:	69 74 74 65 64 00 66 	imul   $0x2e660064,0x65(%rsp,%rsi,2),%esi
+  803cab:	2e 
+  803cac:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803cb3:	00 
+  803cb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803cbb:	00 00 00 
+  803cbe:	66 90                	xchg   %ax,%ax
+  803cc0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803cc1:	0d 80 00 00 00       	or     $0x80,%eax
+  803cc6:	00 00                	add    %al,(%rax)
+  803cc8:	af                   	scas   %es:(%rdi),%eax
+  803cc9:	13 80 00 00 00 00    	adc    0x0(%rax),%eax
+  803ccf:	00 9f 13 80 00 00    	add    %bl,0x8013(%rdi)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803ced:	00 00                	add    %al,(%rax)
+  803cef:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 8d 0d 80 00 00    	add    %cl,0x800d(%rbp)
+  803cfd:	00 00                	add    %al,(%rax)
+  803cff:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803d05:	00 00                	add    %al,(%rax)
+  803d07:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803d0d:	00 00                	add    %al,(%rax)
+  803d0f:	00 81 0d 80 00 00    	add    %al,0x800d(%rcx)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 fb                	add    %bh,%bl
+  803d19:	0d 80 00 00 00       	or     $0x80,%eax
+  803d1e:	00 00                	add    %al,(%rax)
+  803d20:	af                   	scas   %es:(%rdi),%eax
+  803d21:	13 80 00 00 00 00    	adc    0x0(%rax),%eax
+  803d27:	00 81 0d 80 00 00    	add    %al,0x800d(%rcx)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 c7                	add    %al,%bh
+  803d31:	0d 80 00 00 00       	or     $0x80,%eax
+  803d36:	00 00                	add    %al,(%rax)
+  803d38:	c7                   	(bad)
+  803d39:	0d 80 00 00 00       	or     $0x80,%eax
+  803d3e:	00 00                	add    %al,(%rax)
+  803d40:	c7                   	(bad)
+  803d41:	0d 80 00 00 00       	or     $0x80,%eax
+  803d46:	00 00                	add    %al,(%rax)
+  803d48:	c7                   	(bad)
+  803d49:	0d 80 00 00 00       	or     $0x80,%eax
+  803d4e:	00 00                	add    %al,(%rax)
+  803d50:	c7                   	(bad)
+  803d51:	0d 80 00 00 00       	or     $0x80,%eax
+  803d56:	00 00                	add    %al,(%rax)
+  803d58:	c7                   	(bad)
+  803d59:	0d 80 00 00 00       	or     $0x80,%eax
+  803d5e:	00 00                	add    %al,(%rax)
+  803d60:	c7                   	(bad)
+  803d61:	0d 80 00 00 00       	or     $0x80,%eax
+  803d66:	00 00                	add    %al,(%rax)
+  803d68:	c7                   	(bad)
+  803d69:	0d 80 00 00 00       	or     $0x80,%eax
+  803d6e:	00 00                	add    %al,(%rax)
+  803d70:	c7                   	(bad)
+  803d71:	0d 80 00 00 00       	or     $0x80,%eax
+  803d76:	00 00                	add    %al,(%rax)
+  803d78:	af                   	scas   %es:(%rdi),%eax
+  803d79:	13 80 00 00 00 00    	adc    0x0(%rax),%eax
+  803d7f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803d95:	00 00                	add    %al,(%rax)
+  803d97:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803d9d:	00 00                	add    %al,(%rax)
+  803d9f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803dad:	00 00                	add    %al,(%rax)
+  803daf:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803dbd:	00 00                	add    %al,(%rax)
+  803dbf:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803dc5:	00 00                	add    %al,(%rax)
+  803dc7:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803dcd:	00 00                	add    %al,(%rax)
+  803dcf:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803ddd:	00 00                	add    %al,(%rax)
+  803ddf:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803de5:	00 00                	add    %al,(%rax)
+  803de7:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803ded:	00 00                	add    %al,(%rax)
+  803def:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803df5:	00 00                	add    %al,(%rax)
+  803df7:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803dfd:	00 00                	add    %al,(%rax)
+  803dff:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e0d:	00 00                	add    %al,(%rax)
+  803e0f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e1d:	00 00                	add    %al,(%rax)
+  803e1f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e25:	00 00                	add    %al,(%rax)
+  803e27:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e3d:	00 00                	add    %al,(%rax)
+  803e3f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e4d:	00 00                	add    %al,(%rax)
+  803e4f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e55:	00 00                	add    %al,(%rax)
+  803e57:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e5d:	00 00                	add    %al,(%rax)
+  803e5f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 d2                	add    %dl,%dl
+  803e69:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  803e6f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e7d:	00 00                	add    %al,(%rax)
+  803e7f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e85:	00 00                	add    %al,(%rax)
+  803e87:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e8d:	00 00                	add    %al,(%rax)
+  803e8f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e95:	00 00                	add    %al,(%rax)
+  803e97:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803e9d:	00 00                	add    %al,(%rax)
+  803e9f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803ea5:	00 00                	add    %al,(%rax)
+  803ea7:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803ead:	00 00                	add    %al,(%rax)
+  803eaf:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803eb5:	00 00                	add    %al,(%rax)
+  803eb7:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803ebd:	00 00                	add    %al,(%rax)
+  803ebf:	00 1e                	add    %bl,(%rsi)
+  803ec1:	0e                   	(bad)
+  803ec2:	80 00 00             	addb   $0x0,(%rax)
+  803ec5:	00 00                	add    %al,(%rax)
+  803ec7:	00 ed                	add    %ch,%ch
+  803ec9:	0f 80 00 00 00 00    	jo     803ecf <__rodata_start+0x51f>
+  803ecf:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803ed5:	00 00                	add    %al,(%rax)
+  803ed7:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803edd:	00 00                	add    %al,(%rax)
+  803edf:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803ee5:	00 00                	add    %al,(%rax)
+  803ee7:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803eed:	00 00                	add    %al,(%rax)
+  803eef:	00 4d 0e             	add    %cl,0xe(%rbp)
+  803ef2:	80 00 00             	addb   $0x0,(%rax)
+  803ef5:	00 00                	add    %al,(%rax)
+  803ef7:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803efd:	00 00                	add    %al,(%rax)
+  803eff:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803f05:	00 00                	add    %al,(%rax)
+  803f07:	00 13                	add    %dl,(%rbx)
+  803f09:	0e                   	(bad)
+  803f0a:	80 00 00             	addb   $0x0,(%rax)
+  803f0d:	00 00                	add    %al,(%rax)
+  803f0f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803f15:	00 00                	add    %al,(%rax)
+  803f17:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803f1d:	00 00                	add    %al,(%rax)
+  803f1f:	00 95 11 80 00 00    	add    %dl,0x8011(%rbp)
+  803f25:	00 00                	add    %al,(%rax)
+  803f27:	00 5f 12             	add    %bl,0x12(%rdi)
+  803f2a:	80 00 00             	addb   $0x0,(%rax)
+  803f2d:	00 00                	add    %al,(%rax)
+  803f2f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803f35:	00 00                	add    %al,(%rax)
+  803f37:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803f3d:	00 00                	add    %al,(%rax)
+  803f3f:	00 e4                	add    %ah,%ah
+  803f41:	0e                   	(bad)
+  803f42:	80 00 00             	addb   $0x0,(%rax)
+  803f45:	00 00                	add    %al,(%rax)
+  803f47:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803f4d:	00 00                	add    %al,(%rax)
+  803f4f:	00 c1                	add    %al,%cl
+  803f51:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+  803f57:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803f5d:	00 00                	add    %al,(%rax)
+  803f5f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803f65:	00 00                	add    %al,(%rax)
+  803f67:	00 d2                	add    %dl,%dl
+  803f69:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  803f6f:	00 af 13 80 00 00    	add    %ch,0x8013(%rdi)
+  803f75:	00 00                	add    %al,(%rax)
+  803f77:	00 77 0d             	add    %dh,0xd(%rdi)
+  803f7a:	80 00 00             	addb   $0x0,(%rax)
+  803f7d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803f80 <error_string>:
+	...
+  803f88:	35 3b 80 00 00 00 00 00 47 3b 80 00 00 00 00 00     5;......G;......
+  803f98:	57 3b 80 00 00 00 00 00 69 3b 80 00 00 00 00 00     W;......i;......
+  803fa8:	77 3b 80 00 00 00 00 00 8b 3b 80 00 00 00 00 00     w;.......;......
+  803fb8:	a0 3b 80 00 00 00 00 00 b3 3b 80 00 00 00 00 00     .;.......;......
+  803fc8:	c5 3b 80 00 00 00 00 00 d9 3b 80 00 00 00 00 00     .;.......;......
+  803fd8:	e9 3b 80 00 00 00 00 00 fc 3b 80 00 00 00 00 00     .;.......;......
+  803fe8:	13 3c 80 00 00 00 00 00 29 3c 80 00 00 00 00 00     .<......)<......
+  803ff8:	41 3c 80 00 00 00 00 00 59 3c 80 00 00 00 00 00     A<......Y<......
+  804008:	66 3c 80 00 00 00 00 00 30 40 80 00 00 00 00 00     f<......0@......
+  804018:	7a 3c 80 00 00 00 00 00 00 00 00 00 00 00 00 00     z<..............
+  804028:	92 3c 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .<......file is 
+  804038:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  804048:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  804058:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  804068:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  804078:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  804088:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804098:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8040a8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8040b8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8040c8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8040d8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8040e8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8040f8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000804100 <devtab>:
+  804100:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804110:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804120:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  804130:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  804140:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  804150:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 0f 1f 40 00     _SIZE) == 2...@.
+  804160:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  804170:	20 62 65 67 69 6e 20 67 65 6e 65 72 69 63 20 68      begin generic h
+  804180:	61 6e 64 6c 65 72 20 66 6f 72 20 25 64 0a 00 00     andler for %d...
+  804190:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  8041a0:	20 65 78 69 74 69 6e 67 20 64 75 65 20 74 6f 20      exiting due to 
+  8041b0:	73 69 67 6e 61 6c 20 25 64 0a 00 00 00 00 00 00     signal %d.......
+  8041c0:	73 69 67 6e 61 6c 73 3a 20 65 6e 76 20 25 78 3a     signals: env %x:
+  8041d0:	20 69 67 6e 6f 72 69 6e 67 20 73 69 67 6e 61 6c      ignoring signal
+  8041e0:	20 25 64 0a 00 00 00 00 73 69 67 6e 61 6c 73 3a      %d.....signals:
+  8041f0:	20 65 6e 76 20 25 78 3a 20 65 6e 64 20 67 65 6e      env %x: end gen
+  804200:	65 72 69 63 20 68 61 6e 64 6c 65 72 20 66 6f 72     eric handler for
+  804210:	20 25 64 0a 00 66 61 6c 73 65 00 6c 69 62 2f 73      %d..false.lib/s
+  804220:	69 67 6e 61 6c 2e 63 00 3c 63 6f 6e 73 3e 00 63     ignal.c.<cons>.c
+  804230:	6f 6e 73 00 69 70 63 5f 73 65 6e 64 3a 20 66 61     ons.ipc_send: fa
+  804240:	69 6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62     iled to send.lib
+  804250:	2f 69 70 63 2e 63 00 90 55 73 65 72 73 70 61 63     /ipc.c..Userspac
+  804260:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  804270:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  804280:	65 72 72 3d 25 78 0a 00 61 64 64 5f 70 67 66 61     err=%x..add_pgfa
+  804290:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  8042a0:	5f 61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61     _alloc_region fa
+  8042b0:	69 6c 65 64 00 00 00 00 61 64 64 5f 70 67 66 61     iled....add_pgfa
+  8042c0:	75 6c 74 5f 68 61 6e 64 6c 65 72 3a 20 73 79 73     ult_handler: sys
+  8042d0:	5f 65 6e 76 5f 73 65 74 5f 70 67 66 61 75 6c 74     _env_set_pgfault
+  8042e0:	5f 75 70 63 61 6c 6c 20 66 61 69 6c 65 64 00 6c     _upcall failed.l
+  8042f0:	69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65 74     ib/pgfault.c.set
+  804300:	5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65 72     _pgfault_handler
+  804310:	3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72 5f     : %i._pfhandler_
+  804320:	69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00 66     inititiallized.f
+  804330:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804340:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804350:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804360:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804370:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804380:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804390:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8043a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8043b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8043c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8043d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8043e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8043f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804400:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804410:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804420:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804430:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804440:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804450:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804460:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804470:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804480:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804490:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8044a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8044b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8044c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8044d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8044e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8044f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804500:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804510:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804520:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804530:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804540:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804550:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804560:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804570:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804580:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804590:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8045a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8045b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8045c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8045d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8045e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8045f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804600:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804610:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804620:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804630:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804640:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804650:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804660:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804670:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804680:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804690:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8046a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8046b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8046c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8046d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8046e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8046f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8047a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8047b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8047c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8047d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8047e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8047f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8048a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8048b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8048c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8048d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8048e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8048f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8049a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8049b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8049c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8049d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8049e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8049f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
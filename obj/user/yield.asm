@@ -0,0 +1,5725 @@
+
+obj/user/yield:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c6 00 00 00       	call   8000e9 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* yield the processor to other environments */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+    cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  800036:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80003d:	00 00 00 
+  800040:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800046:	48 bf d8 2b 80 00 00 	movabs $0x802bd8,%rdi
+  80004d:	00 00 00 
+  800050:	b8 00 00 00 00       	mov    $0x0,%eax
+  800055:	48 ba 60 02 80 00 00 	movabs $0x800260,%rdx
+  80005c:	00 00 00 
+  80005f:	ff d2                	call   *%rdx
+    for (int i = 0; i < 5; i++) {
+  800061:	bb 00 00 00 00       	mov    $0x0,%ebx
+        sys_yield();
+  800066:	49 bf a6 10 80 00 00 	movabs $0x8010a6,%r15
+  80006d:	00 00 00 
+        cprintf("Back in environment %08x, iteration %d.\n",
+                thisenv->env_id, i);
+  800070:	49 be 00 50 80 00 00 	movabs $0x805000,%r14
+  800077:	00 00 00 
+        cprintf("Back in environment %08x, iteration %d.\n",
+  80007a:	49 bd f8 2b 80 00 00 	movabs $0x802bf8,%r13
+  800081:	00 00 00 
+  800084:	49 bc 60 02 80 00 00 	movabs $0x800260,%r12
+  80008b:	00 00 00 
+        sys_yield();
+  80008e:	41 ff d7             	call   *%r15
+                thisenv->env_id, i);
+  800091:	49 8b 06             	mov    (%r14),%rax
+  800094:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("Back in environment %08x, iteration %d.\n",
+  80009a:	89 da                	mov    %ebx,%edx
+  80009c:	4c 89 ef             	mov    %r13,%rdi
+  80009f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a4:	41 ff d4             	call   *%r12
+    for (int i = 0; i < 5; i++) {
+  8000a7:	83 c3 01             	add    $0x1,%ebx
+  8000aa:	83 fb 05             	cmp    $0x5,%ebx
+  8000ad:	75 df                	jne    80008e <umain+0x69>
+    }
+    cprintf("All done in environment %08x.\n", thisenv->env_id);
+  8000af:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8000b6:	00 00 00 
+  8000b9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8000bf:	48 bf 28 2c 80 00 00 	movabs $0x802c28,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	48 ba 60 02 80 00 00 	movabs $0x800260,%rdx
+  8000d5:	00 00 00 
+  8000d8:	ff d2                	call   *%rdx
+}
+  8000da:	48 83 c4 08          	add    $0x8,%rsp
+  8000de:	5b                   	pop    %rbx
+  8000df:	41 5c                	pop    %r12
+  8000e1:	41 5d                	pop    %r13
+  8000e3:	41 5e                	pop    %r14
+  8000e5:	41 5f                	pop    %r15
+  8000e7:	5d                   	pop    %rbp
+  8000e8:	c3                   	ret
+
+00000000008000e9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000e9:	55                   	push   %rbp
+  8000ea:	48 89 e5             	mov    %rsp,%rbp
+  8000ed:	41 56                	push   %r14
+  8000ef:	41 55                	push   %r13
+  8000f1:	41 54                	push   %r12
+  8000f3:	53                   	push   %rbx
+  8000f4:	41 89 fd             	mov    %edi,%r13d
+  8000f7:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000fa:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800101:	00 00 00 
+  800104:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80010b:	00 00 00 
+  80010e:	48 39 c2             	cmp    %rax,%rdx
+  800111:	73 17                	jae    80012a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800113:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800116:	49 89 c4             	mov    %rax,%r12
+  800119:	48 83 c3 08          	add    $0x8,%rbx
+  80011d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800122:	ff 53 f8             	call   *-0x8(%rbx)
+  800125:	4c 39 e3             	cmp    %r12,%rbx
+  800128:	72 ef                	jb     800119 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    size_t env_idx_mask = NENV - 1;
+    size_t env_idx = sys_getenvid() & env_idx_mask;
+  80012a:	48 b8 75 10 80 00 00 	movabs $0x801075,%rax
+  800131:	00 00 00 
+  800134:	ff d0                	call   *%rax
+  800136:	0f b6 c0             	movzbl %al,%eax
+    thisenv = envs + env_idx;
+  800139:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  800140:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800147:	00 00 00 
+  80014a:	48 01 d0             	add    %rdx,%rax
+  80014d:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800154:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800157:	45 85 ed             	test   %r13d,%r13d
+  80015a:	7e 0d                	jle    800169 <libmain+0x80>
+  80015c:	49 8b 06             	mov    (%r14),%rax
+  80015f:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800166:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800169:	4c 89 f6             	mov    %r14,%rsi
+  80016c:	44 89 ef             	mov    %r13d,%edi
+  80016f:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800176:	00 00 00 
+  800179:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80017b:	48 b8 90 01 80 00 00 	movabs $0x800190,%rax
+  800182:	00 00 00 
+  800185:	ff d0                	call   *%rax
+#endif
+}
+  800187:	5b                   	pop    %rbx
+  800188:	41 5c                	pop    %r12
+  80018a:	41 5d                	pop    %r13
+  80018c:	41 5e                	pop    %r14
+  80018e:	5d                   	pop    %rbp
+  80018f:	c3                   	ret
+
+0000000000800190 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800190:	55                   	push   %rbp
+  800191:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800194:	48 b8 fd 18 80 00 00 	movabs $0x8018fd,%rax
+  80019b:	00 00 00 
+  80019e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001a5:	48 b8 0a 10 80 00 00 	movabs $0x80100a,%rax
+  8001ac:	00 00 00 
+  8001af:	ff d0                	call   *%rax
+}
+  8001b1:	5d                   	pop    %rbp
+  8001b2:	c3                   	ret
+
+00000000008001b3 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001b3:	55                   	push   %rbp
+  8001b4:	48 89 e5             	mov    %rsp,%rbp
+  8001b7:	53                   	push   %rbx
+  8001b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8001bc:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001bf:	8b 06                	mov    (%rsi),%eax
+  8001c1:	8d 50 01             	lea    0x1(%rax),%edx
+  8001c4:	89 16                	mov    %edx,(%rsi)
+  8001c6:	48 98                	cltq
+  8001c8:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001cd:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001d3:	74 0a                	je     8001df <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001d5:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001dd:	c9                   	leave
+  8001de:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001df:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001e3:	be ff 00 00 00       	mov    $0xff,%esi
+  8001e8:	48 b8 ac 0f 80 00 00 	movabs $0x800fac,%rax
+  8001ef:	00 00 00 
+  8001f2:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001f4:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001fa:	eb d9                	jmp    8001d5 <putch+0x22>
+
+00000000008001fc <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001fc:	55                   	push   %rbp
+  8001fd:	48 89 e5             	mov    %rsp,%rbp
+  800200:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800207:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80020a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800211:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800216:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80021e:	48 89 f1             	mov    %rsi,%rcx
+  800221:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800228:	48 bf b3 01 80 00 00 	movabs $0x8001b3,%rdi
+  80022f:	00 00 00 
+  800232:	48 b8 b0 03 80 00 00 	movabs $0x8003b0,%rax
+  800239:	00 00 00 
+  80023c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80023e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800245:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80024c:	48 b8 ac 0f 80 00 00 	movabs $0x800fac,%rax
+  800253:	00 00 00 
+  800256:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800258:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80025e:	c9                   	leave
+  80025f:	c3                   	ret
+
+0000000000800260 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800260:	55                   	push   %rbp
+  800261:	48 89 e5             	mov    %rsp,%rbp
+  800264:	48 83 ec 50          	sub    $0x50,%rsp
+  800268:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80026c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800270:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800274:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800278:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80027c:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800283:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800287:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80028b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80028f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800293:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800297:	48 b8 fc 01 80 00 00 	movabs $0x8001fc,%rax
+  80029e:	00 00 00 
+  8002a1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002a3:	c9                   	leave
+  8002a4:	c3                   	ret
+
+00000000008002a5 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002a5:	55                   	push   %rbp
+  8002a6:	48 89 e5             	mov    %rsp,%rbp
+  8002a9:	41 57                	push   %r15
+  8002ab:	41 56                	push   %r14
+  8002ad:	41 55                	push   %r13
+  8002af:	41 54                	push   %r12
+  8002b1:	53                   	push   %rbx
+  8002b2:	48 83 ec 18          	sub    $0x18,%rsp
+  8002b6:	49 89 fc             	mov    %rdi,%r12
+  8002b9:	49 89 f5             	mov    %rsi,%r13
+  8002bc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002c0:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002c3:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002c6:	41 89 cf             	mov    %ecx,%r15d
+  8002c9:	4c 39 fa             	cmp    %r15,%rdx
+  8002cc:	73 5b                	jae    800329 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002ce:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002d2:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002d6:	85 db                	test   %ebx,%ebx
+  8002d8:	7e 0e                	jle    8002e8 <print_num+0x43>
+            putch(padc, put_arg);
+  8002da:	4c 89 ee             	mov    %r13,%rsi
+  8002dd:	44 89 f7             	mov    %r14d,%edi
+  8002e0:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002e3:	83 eb 01             	sub    $0x1,%ebx
+  8002e6:	75 f2                	jne    8002da <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002e8:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8002ec:	48 b9 62 2c 80 00 00 	movabs $0x802c62,%rcx
+  8002f3:	00 00 00 
+  8002f6:	48 b8 51 2c 80 00 00 	movabs $0x802c51,%rax
+  8002fd:	00 00 00 
+  800300:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800304:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800308:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030d:	49 f7 f7             	div    %r15
+  800310:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800314:	4c 89 ee             	mov    %r13,%rsi
+  800317:	41 ff d4             	call   *%r12
+}
+  80031a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80031e:	5b                   	pop    %rbx
+  80031f:	41 5c                	pop    %r12
+  800321:	41 5d                	pop    %r13
+  800323:	41 5e                	pop    %r14
+  800325:	41 5f                	pop    %r15
+  800327:	5d                   	pop    %rbp
+  800328:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800329:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80032d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800332:	49 f7 f7             	div    %r15
+  800335:	48 83 ec 08          	sub    $0x8,%rsp
+  800339:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80033d:	52                   	push   %rdx
+  80033e:	45 0f be c9          	movsbl %r9b,%r9d
+  800342:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800346:	48 89 c2             	mov    %rax,%rdx
+  800349:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  800350:	00 00 00 
+  800353:	ff d0                	call   *%rax
+  800355:	48 83 c4 10          	add    $0x10,%rsp
+  800359:	eb 8d                	jmp    8002e8 <print_num+0x43>
+
+000000000080035b <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80035b:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80035f:	48 8b 06             	mov    (%rsi),%rax
+  800362:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800366:	73 0a                	jae    800372 <sprintputch+0x17>
+        *state->start++ = ch;
+  800368:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80036c:	48 89 16             	mov    %rdx,(%rsi)
+  80036f:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800372:	c3                   	ret
+
+0000000000800373 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800373:	55                   	push   %rbp
+  800374:	48 89 e5             	mov    %rsp,%rbp
+  800377:	48 83 ec 50          	sub    $0x50,%rsp
+  80037b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80037f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800383:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800387:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80038e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800392:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800396:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80039a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80039e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003a2:	48 b8 b0 03 80 00 00 	movabs $0x8003b0,%rax
+  8003a9:	00 00 00 
+  8003ac:	ff d0                	call   *%rax
+}
+  8003ae:	c9                   	leave
+  8003af:	c3                   	ret
+
+00000000008003b0 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003b0:	55                   	push   %rbp
+  8003b1:	48 89 e5             	mov    %rsp,%rbp
+  8003b4:	41 57                	push   %r15
+  8003b6:	41 56                	push   %r14
+  8003b8:	41 55                	push   %r13
+  8003ba:	41 54                	push   %r12
+  8003bc:	53                   	push   %rbx
+  8003bd:	48 83 ec 38          	sub    $0x38,%rsp
+  8003c1:	49 89 fe             	mov    %rdi,%r14
+  8003c4:	49 89 f5             	mov    %rsi,%r13
+  8003c7:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003ca:	48 8b 01             	mov    (%rcx),%rax
+  8003cd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003d1:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003d9:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003dd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003e1:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003e5:	0f b6 3b             	movzbl (%rbx),%edi
+  8003e8:	40 80 ff 25          	cmp    $0x25,%dil
+  8003ec:	74 18                	je     800406 <vprintfmt+0x56>
+            if (!ch) return;
+  8003ee:	40 84 ff             	test   %dil,%dil
+  8003f1:	0f 84 b1 06 00 00    	je     800aa8 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003f7:	40 0f b6 ff          	movzbl %dil,%edi
+  8003fb:	4c 89 ee             	mov    %r13,%rsi
+  8003fe:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800401:	4c 89 e3             	mov    %r12,%rbx
+  800404:	eb db                	jmp    8003e1 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800406:	be 00 00 00 00       	mov    $0x0,%esi
+  80040b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80040f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800414:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80041a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800421:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800425:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80042a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80042f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800432:	83 e8 23             	sub    $0x23,%eax
+  800435:	3c 57                	cmp    $0x57,%al
+  800437:	0f 87 51 06 00 00    	ja     800a8e <vprintfmt+0x6de>
+  80043d:	0f b6 c0             	movzbl %al,%eax
+  800440:	48 b9 00 2e 80 00 00 	movabs $0x802e00,%rcx
+  800447:	00 00 00 
+  80044a:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80044d:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800450:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800454:	eb cf                	jmp    800425 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800456:	49 89 dc             	mov    %rbx,%r12
+  800459:	be 01 00 00 00       	mov    $0x1,%esi
+  80045e:	eb c5                	jmp    800425 <vprintfmt+0x75>
+            padc = ch;
+  800460:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800464:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800467:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80046a:	eb b9                	jmp    800425 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80046c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80046f:	83 f8 2f             	cmp    $0x2f,%eax
+  800472:	77 24                	ja     800498 <vprintfmt+0xe8>
+  800474:	89 c1                	mov    %eax,%ecx
+  800476:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80047a:	83 c0 08             	add    $0x8,%eax
+  80047d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800480:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800483:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800486:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80048a:	79 99                	jns    800425 <vprintfmt+0x75>
+                width = precision;
+  80048c:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800490:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800496:	eb 8d                	jmp    800425 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800498:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80049c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a4:	eb da                	jmp    800480 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004a6:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004ab:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004af:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004b5:	3c 39                	cmp    $0x39,%al
+  8004b7:	77 1c                	ja     8004d5 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004b9:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004bd:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004c1:	0f b6 c0             	movzbl %al,%eax
+  8004c4:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004c9:	0f b6 03             	movzbl (%rbx),%eax
+  8004cc:	3c 39                	cmp    $0x39,%al
+  8004ce:	76 e9                	jbe    8004b9 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004d0:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004d3:	eb b1                	jmp    800486 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004d5:	49 89 dc             	mov    %rbx,%r12
+  8004d8:	eb ac                	jmp    800486 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004da:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004dd:	85 c9                	test   %ecx,%ecx
+  8004df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e4:	0f 49 c1             	cmovns %ecx,%eax
+  8004e7:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004ea:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004ed:	e9 33 ff ff ff       	jmp    800425 <vprintfmt+0x75>
+            lflag++;
+  8004f2:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004f5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004f8:	e9 28 ff ff ff       	jmp    800425 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800500:	83 f8 2f             	cmp    $0x2f,%eax
+  800503:	77 19                	ja     80051e <vprintfmt+0x16e>
+  800505:	89 c2                	mov    %eax,%edx
+  800507:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80050b:	83 c0 08             	add    $0x8,%eax
+  80050e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800511:	8b 3a                	mov    (%rdx),%edi
+  800513:	4c 89 ee             	mov    %r13,%rsi
+  800516:	41 ff d6             	call   *%r14
+            break;
+  800519:	e9 c3 fe ff ff       	jmp    8003e1 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80051e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800522:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800526:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80052a:	eb e5                	jmp    800511 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80052c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80052f:	83 f8 2f             	cmp    $0x2f,%eax
+  800532:	77 5a                	ja     80058e <vprintfmt+0x1de>
+  800534:	89 c2                	mov    %eax,%edx
+  800536:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80053a:	83 c0 08             	add    $0x8,%eax
+  80053d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800540:	8b 02                	mov    (%rdx),%eax
+  800542:	89 c1                	mov    %eax,%ecx
+  800544:	f7 d9                	neg    %ecx
+  800546:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800549:	83 f9 15             	cmp    $0x15,%ecx
+  80054c:	7f 4e                	jg     80059c <vprintfmt+0x1ec>
+  80054e:	48 63 c1             	movslq %ecx,%rax
+  800551:	48 ba c0 30 80 00 00 	movabs $0x8030c0,%rdx
+  800558:	00 00 00 
+  80055b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80055f:	48 85 c0             	test   %rax,%rax
+  800562:	74 38                	je     80059c <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800564:	48 89 c1             	mov    %rax,%rcx
+  800567:	48 ba 79 32 80 00 00 	movabs $0x803279,%rdx
+  80056e:	00 00 00 
+  800571:	4c 89 ee             	mov    %r13,%rsi
+  800574:	4c 89 f7             	mov    %r14,%rdi
+  800577:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057c:	49 b8 73 03 80 00 00 	movabs $0x800373,%r8
+  800583:	00 00 00 
+  800586:	41 ff d0             	call   *%r8
+  800589:	e9 53 fe ff ff       	jmp    8003e1 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80058e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800592:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800596:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80059a:	eb a4                	jmp    800540 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80059c:	48 ba 7a 2c 80 00 00 	movabs $0x802c7a,%rdx
+  8005a3:	00 00 00 
+  8005a6:	4c 89 ee             	mov    %r13,%rsi
+  8005a9:	4c 89 f7             	mov    %r14,%rdi
+  8005ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b1:	49 b8 73 03 80 00 00 	movabs $0x800373,%r8
+  8005b8:	00 00 00 
+  8005bb:	41 ff d0             	call   *%r8
+  8005be:	e9 1e fe ff ff       	jmp    8003e1 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8005c9:	77 6c                	ja     800637 <vprintfmt+0x287>
+  8005cb:	89 c2                	mov    %eax,%edx
+  8005cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005d1:	83 c0 08             	add    $0x8,%eax
+  8005d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005d7:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005da:	48 85 d2             	test   %rdx,%rdx
+  8005dd:	48 b8 73 2c 80 00 00 	movabs $0x802c73,%rax
+  8005e4:	00 00 00 
+  8005e7:	48 0f 45 c2          	cmovne %rdx,%rax
+  8005eb:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005ef:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005f3:	7e 06                	jle    8005fb <vprintfmt+0x24b>
+  8005f5:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005f9:	75 4a                	jne    800645 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005fb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005ff:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800603:	0f b6 00             	movzbl (%rax),%eax
+  800606:	84 c0                	test   %al,%al
+  800608:	0f 85 9a 00 00 00    	jne    8006a8 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80060e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800611:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800615:	85 c0                	test   %eax,%eax
+  800617:	0f 8e c4 fd ff ff    	jle    8003e1 <vprintfmt+0x31>
+  80061d:	4c 89 ee             	mov    %r13,%rsi
+  800620:	bf 20 00 00 00       	mov    $0x20,%edi
+  800625:	41 ff d6             	call   *%r14
+  800628:	41 83 ec 01          	sub    $0x1,%r12d
+  80062c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800630:	75 eb                	jne    80061d <vprintfmt+0x26d>
+  800632:	e9 aa fd ff ff       	jmp    8003e1 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800637:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80063b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80063f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800643:	eb 92                	jmp    8005d7 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800645:	49 63 f7             	movslq %r15d,%rsi
+  800648:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80064c:	48 b8 62 0b 80 00 00 	movabs $0x800b62,%rax
+  800653:	00 00 00 
+  800656:	ff d0                	call   *%rax
+  800658:	48 89 c2             	mov    %rax,%rdx
+  80065b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80065e:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800660:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800663:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800666:	85 c0                	test   %eax,%eax
+  800668:	7e 91                	jle    8005fb <vprintfmt+0x24b>
+  80066a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80066f:	4c 89 ee             	mov    %r13,%rsi
+  800672:	44 89 e7             	mov    %r12d,%edi
+  800675:	41 ff d6             	call   *%r14
+  800678:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80067c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80067f:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800682:	75 eb                	jne    80066f <vprintfmt+0x2bf>
+  800684:	e9 72 ff ff ff       	jmp    8005fb <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800689:	0f b6 f8             	movzbl %al,%edi
+  80068c:	4c 89 ee             	mov    %r13,%rsi
+  80068f:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800692:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800696:	49 83 c4 01          	add    $0x1,%r12
+  80069a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006a0:	84 c0                	test   %al,%al
+  8006a2:	0f 84 66 ff ff ff    	je     80060e <vprintfmt+0x25e>
+  8006a8:	45 85 ff             	test   %r15d,%r15d
+  8006ab:	78 0a                	js     8006b7 <vprintfmt+0x307>
+  8006ad:	41 83 ef 01          	sub    $0x1,%r15d
+  8006b1:	0f 88 57 ff ff ff    	js     80060e <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006b7:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006bb:	74 cc                	je     800689 <vprintfmt+0x2d9>
+  8006bd:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006c0:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006c5:	80 fa 5e             	cmp    $0x5e,%dl
+  8006c8:	77 c2                	ja     80068c <vprintfmt+0x2dc>
+  8006ca:	eb bd                	jmp    800689 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8006cc:	40 84 f6             	test   %sil,%sil
+  8006cf:	75 26                	jne    8006f7 <vprintfmt+0x347>
+    switch (lflag) {
+  8006d1:	85 d2                	test   %edx,%edx
+  8006d3:	74 59                	je     80072e <vprintfmt+0x37e>
+  8006d5:	83 fa 01             	cmp    $0x1,%edx
+  8006d8:	74 7b                	je     800755 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e0:	0f 87 96 00 00 00    	ja     80077c <vprintfmt+0x3cc>
+  8006e6:	89 c2                	mov    %eax,%edx
+  8006e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ec:	83 c0 08             	add    $0x8,%eax
+  8006ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f2:	4c 8b 22             	mov    (%rdx),%r12
+  8006f5:	eb 17                	jmp    80070e <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8006fd:	77 21                	ja     800720 <vprintfmt+0x370>
+  8006ff:	89 c2                	mov    %eax,%edx
+  800701:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800705:	83 c0 08             	add    $0x8,%eax
+  800708:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80070b:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80070e:	4d 85 e4             	test   %r12,%r12
+  800711:	78 7a                	js     80078d <vprintfmt+0x3dd>
+            num = i;
+  800713:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800716:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80071b:	e9 50 02 00 00       	jmp    800970 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800720:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800724:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800728:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80072c:	eb dd                	jmp    80070b <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80072e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800731:	83 f8 2f             	cmp    $0x2f,%eax
+  800734:	77 11                	ja     800747 <vprintfmt+0x397>
+  800736:	89 c2                	mov    %eax,%edx
+  800738:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073c:	83 c0 08             	add    $0x8,%eax
+  80073f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800742:	4c 63 22             	movslq (%rdx),%r12
+  800745:	eb c7                	jmp    80070e <vprintfmt+0x35e>
+  800747:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80074b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80074f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800753:	eb ed                	jmp    800742 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800755:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800758:	83 f8 2f             	cmp    $0x2f,%eax
+  80075b:	77 11                	ja     80076e <vprintfmt+0x3be>
+  80075d:	89 c2                	mov    %eax,%edx
+  80075f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800763:	83 c0 08             	add    $0x8,%eax
+  800766:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800769:	4c 8b 22             	mov    (%rdx),%r12
+  80076c:	eb a0                	jmp    80070e <vprintfmt+0x35e>
+  80076e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800772:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800776:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80077a:	eb ed                	jmp    800769 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80077c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800780:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800784:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800788:	e9 65 ff ff ff       	jmp    8006f2 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80078d:	4c 89 ee             	mov    %r13,%rsi
+  800790:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800795:	41 ff d6             	call   *%r14
+                i = -i;
+  800798:	49 f7 dc             	neg    %r12
+  80079b:	e9 73 ff ff ff       	jmp    800713 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007a0:	40 84 f6             	test   %sil,%sil
+  8007a3:	75 32                	jne    8007d7 <vprintfmt+0x427>
+    switch (lflag) {
+  8007a5:	85 d2                	test   %edx,%edx
+  8007a7:	74 5d                	je     800806 <vprintfmt+0x456>
+  8007a9:	83 fa 01             	cmp    $0x1,%edx
+  8007ac:	0f 84 82 00 00 00    	je     800834 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007b2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b8:	0f 87 a5 00 00 00    	ja     800863 <vprintfmt+0x4b3>
+  8007be:	89 c2                	mov    %eax,%edx
+  8007c0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c4:	83 c0 08             	add    $0x8,%eax
+  8007c7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ca:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007cd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007d2:	e9 99 01 00 00       	jmp    800970 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007da:	83 f8 2f             	cmp    $0x2f,%eax
+  8007dd:	77 19                	ja     8007f8 <vprintfmt+0x448>
+  8007df:	89 c2                	mov    %eax,%edx
+  8007e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e5:	83 c0 08             	add    $0x8,%eax
+  8007e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007eb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007ee:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007f3:	e9 78 01 00 00       	jmp    800970 <vprintfmt+0x5c0>
+  8007f8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007fc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800800:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800804:	eb e5                	jmp    8007eb <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800806:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800809:	83 f8 2f             	cmp    $0x2f,%eax
+  80080c:	77 18                	ja     800826 <vprintfmt+0x476>
+  80080e:	89 c2                	mov    %eax,%edx
+  800810:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800814:	83 c0 08             	add    $0x8,%eax
+  800817:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80081c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800821:	e9 4a 01 00 00       	jmp    800970 <vprintfmt+0x5c0>
+  800826:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80082a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800832:	eb e6                	jmp    80081a <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800834:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800837:	83 f8 2f             	cmp    $0x2f,%eax
+  80083a:	77 19                	ja     800855 <vprintfmt+0x4a5>
+  80083c:	89 c2                	mov    %eax,%edx
+  80083e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800842:	83 c0 08             	add    $0x8,%eax
+  800845:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800848:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80084b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800850:	e9 1b 01 00 00       	jmp    800970 <vprintfmt+0x5c0>
+  800855:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800859:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800861:	eb e5                	jmp    800848 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800863:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800867:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086f:	e9 56 ff ff ff       	jmp    8007ca <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800874:	40 84 f6             	test   %sil,%sil
+  800877:	75 2e                	jne    8008a7 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800879:	85 d2                	test   %edx,%edx
+  80087b:	74 59                	je     8008d6 <vprintfmt+0x526>
+  80087d:	83 fa 01             	cmp    $0x1,%edx
+  800880:	74 7f                	je     800901 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800882:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800885:	83 f8 2f             	cmp    $0x2f,%eax
+  800888:	0f 87 9f 00 00 00    	ja     80092d <vprintfmt+0x57d>
+  80088e:	89 c2                	mov    %eax,%edx
+  800890:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800894:	83 c0 08             	add    $0x8,%eax
+  800897:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80089d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008a2:	e9 c9 00 00 00       	jmp    800970 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ad:	77 19                	ja     8008c8 <vprintfmt+0x518>
+  8008af:	89 c2                	mov    %eax,%edx
+  8008b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b5:	83 c0 08             	add    $0x8,%eax
+  8008b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008bb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008be:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008c3:	e9 a8 00 00 00       	jmp    800970 <vprintfmt+0x5c0>
+  8008c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d4:	eb e5                	jmp    8008bb <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008dc:	77 15                	ja     8008f3 <vprintfmt+0x543>
+  8008de:	89 c2                	mov    %eax,%edx
+  8008e0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e4:	83 c0 08             	add    $0x8,%eax
+  8008e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ea:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8008ec:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8008f1:	eb 7d                	jmp    800970 <vprintfmt+0x5c0>
+  8008f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ff:	eb e9                	jmp    8008ea <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800901:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800904:	83 f8 2f             	cmp    $0x2f,%eax
+  800907:	77 16                	ja     80091f <vprintfmt+0x56f>
+  800909:	89 c2                	mov    %eax,%edx
+  80090b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090f:	83 c0 08             	add    $0x8,%eax
+  800912:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800915:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800918:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80091d:	eb 51                	jmp    800970 <vprintfmt+0x5c0>
+  80091f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800923:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800927:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092b:	eb e8                	jmp    800915 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80092d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800931:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800935:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800939:	e9 5c ff ff ff       	jmp    80089a <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80093e:	4c 89 ee             	mov    %r13,%rsi
+  800941:	bf 30 00 00 00       	mov    $0x30,%edi
+  800946:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800949:	4c 89 ee             	mov    %r13,%rsi
+  80094c:	bf 78 00 00 00       	mov    $0x78,%edi
+  800951:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800954:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800957:	83 f8 2f             	cmp    $0x2f,%eax
+  80095a:	77 47                	ja     8009a3 <vprintfmt+0x5f3>
+  80095c:	89 c2                	mov    %eax,%edx
+  80095e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800962:	83 c0 08             	add    $0x8,%eax
+  800965:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800968:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80096b:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800970:	48 83 ec 08          	sub    $0x8,%rsp
+  800974:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800978:	0f 94 c0             	sete   %al
+  80097b:	0f b6 c0             	movzbl %al,%eax
+  80097e:	50                   	push   %rax
+  80097f:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800984:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800988:	4c 89 ee             	mov    %r13,%rsi
+  80098b:	4c 89 f7             	mov    %r14,%rdi
+  80098e:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  800995:	00 00 00 
+  800998:	ff d0                	call   *%rax
+            break;
+  80099a:	48 83 c4 10          	add    $0x10,%rsp
+  80099e:	e9 3e fa ff ff       	jmp    8003e1 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009af:	eb b7                	jmp    800968 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009b1:	40 84 f6             	test   %sil,%sil
+  8009b4:	75 2b                	jne    8009e1 <vprintfmt+0x631>
+    switch (lflag) {
+  8009b6:	85 d2                	test   %edx,%edx
+  8009b8:	74 56                	je     800a10 <vprintfmt+0x660>
+  8009ba:	83 fa 01             	cmp    $0x1,%edx
+  8009bd:	74 7f                	je     800a3e <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c5:	0f 87 a2 00 00 00    	ja     800a6d <vprintfmt+0x6bd>
+  8009cb:	89 c2                	mov    %eax,%edx
+  8009cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d1:	83 c0 08             	add    $0x8,%eax
+  8009d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009da:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009df:	eb 8f                	jmp    800970 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e7:	77 19                	ja     800a02 <vprintfmt+0x652>
+  8009e9:	89 c2                	mov    %eax,%edx
+  8009eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ef:	83 c0 08             	add    $0x8,%eax
+  8009f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009f8:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009fd:	e9 6e ff ff ff       	jmp    800970 <vprintfmt+0x5c0>
+  800a02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0e:	eb e5                	jmp    8009f5 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a13:	83 f8 2f             	cmp    $0x2f,%eax
+  800a16:	77 18                	ja     800a30 <vprintfmt+0x680>
+  800a18:	89 c2                	mov    %eax,%edx
+  800a1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1e:	83 c0 08             	add    $0x8,%eax
+  800a21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a24:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a26:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a2b:	e9 40 ff ff ff       	jmp    800970 <vprintfmt+0x5c0>
+  800a30:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a34:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a38:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3c:	eb e6                	jmp    800a24 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a41:	83 f8 2f             	cmp    $0x2f,%eax
+  800a44:	77 19                	ja     800a5f <vprintfmt+0x6af>
+  800a46:	89 c2                	mov    %eax,%edx
+  800a48:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4c:	83 c0 08             	add    $0x8,%eax
+  800a4f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a52:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a55:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a5a:	e9 11 ff ff ff       	jmp    800970 <vprintfmt+0x5c0>
+  800a5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a63:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6b:	eb e5                	jmp    800a52 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a79:	e9 59 ff ff ff       	jmp    8009d7 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a7e:	4c 89 ee             	mov    %r13,%rsi
+  800a81:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a86:	41 ff d6             	call   *%r14
+            break;
+  800a89:	e9 53 f9 ff ff       	jmp    8003e1 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a8e:	4c 89 ee             	mov    %r13,%rsi
+  800a91:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a96:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a99:	48 83 eb 01          	sub    $0x1,%rbx
+  800a9d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800aa1:	75 f6                	jne    800a99 <vprintfmt+0x6e9>
+  800aa3:	e9 39 f9 ff ff       	jmp    8003e1 <vprintfmt+0x31>
+}
+  800aa8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800aac:	5b                   	pop    %rbx
+  800aad:	41 5c                	pop    %r12
+  800aaf:	41 5d                	pop    %r13
+  800ab1:	41 5e                	pop    %r14
+  800ab3:	41 5f                	pop    %r15
+  800ab5:	5d                   	pop    %rbp
+  800ab6:	c3                   	ret
+
+0000000000800ab7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ab7:	55                   	push   %rbp
+  800ab8:	48 89 e5             	mov    %rsp,%rbp
+  800abb:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800abf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ac3:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ac8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800acc:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ad3:	48 85 ff             	test   %rdi,%rdi
+  800ad6:	74 2b                	je     800b03 <vsnprintf+0x4c>
+  800ad8:	48 85 f6             	test   %rsi,%rsi
+  800adb:	74 26                	je     800b03 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800add:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ae1:	48 bf 5b 03 80 00 00 	movabs $0x80035b,%rdi
+  800ae8:	00 00 00 
+  800aeb:	48 b8 b0 03 80 00 00 	movabs $0x8003b0,%rax
+  800af2:	00 00 00 
+  800af5:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800af7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800afb:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800afe:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b01:	c9                   	leave
+  800b02:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b08:	eb f7                	jmp    800b01 <vsnprintf+0x4a>
+
+0000000000800b0a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b0a:	55                   	push   %rbp
+  800b0b:	48 89 e5             	mov    %rsp,%rbp
+  800b0e:	48 83 ec 50          	sub    $0x50,%rsp
+  800b12:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b16:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b1a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b1e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b25:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b31:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b35:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b39:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  800b40:	00 00 00 
+  800b43:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b45:	c9                   	leave
+  800b46:	c3                   	ret
+
+0000000000800b47 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b47:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b4a:	74 10                	je     800b5c <strlen+0x15>
+    size_t n = 0;
+  800b4c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b51:	48 83 c0 01          	add    $0x1,%rax
+  800b55:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b59:	75 f6                	jne    800b51 <strlen+0xa>
+  800b5b:	c3                   	ret
+    size_t n = 0;
+  800b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b61:	c3                   	ret
+
+0000000000800b62 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b62:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b65:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b6a:	48 85 f6             	test   %rsi,%rsi
+  800b6d:	74 11                	je     800b80 <strnlen+0x1e>
+  800b6f:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b73:	74 0c                	je     800b81 <strnlen+0x1f>
+  800b75:	48 83 c2 01          	add    $0x1,%rdx
+  800b79:	48 39 d0             	cmp    %rdx,%rax
+  800b7c:	75 f1                	jne    800b6f <strnlen+0xd>
+  800b7e:	eb 04                	jmp    800b84 <strnlen+0x22>
+  800b80:	c3                   	ret
+  800b81:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b84:	c3                   	ret
+
+0000000000800b85 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b85:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b88:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b8d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b91:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b94:	48 83 c2 01          	add    $0x1,%rdx
+  800b98:	84 c9                	test   %cl,%cl
+  800b9a:	75 f1                	jne    800b8d <strcpy+0x8>
+        ;
+    return res;
+}
+  800b9c:	c3                   	ret
+
+0000000000800b9d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b9d:	55                   	push   %rbp
+  800b9e:	48 89 e5             	mov    %rsp,%rbp
+  800ba1:	41 54                	push   %r12
+  800ba3:	53                   	push   %rbx
+  800ba4:	48 89 fb             	mov    %rdi,%rbx
+  800ba7:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800baa:	48 b8 47 0b 80 00 00 	movabs $0x800b47,%rax
+  800bb1:	00 00 00 
+  800bb4:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bb6:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bba:	4c 89 e6             	mov    %r12,%rsi
+  800bbd:	48 b8 85 0b 80 00 00 	movabs $0x800b85,%rax
+  800bc4:	00 00 00 
+  800bc7:	ff d0                	call   *%rax
+    return dst;
+}
+  800bc9:	48 89 d8             	mov    %rbx,%rax
+  800bcc:	5b                   	pop    %rbx
+  800bcd:	41 5c                	pop    %r12
+  800bcf:	5d                   	pop    %rbp
+  800bd0:	c3                   	ret
+
+0000000000800bd1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bd1:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800bd4:	48 85 d2             	test   %rdx,%rdx
+  800bd7:	74 1f                	je     800bf8 <strncpy+0x27>
+  800bd9:	48 01 fa             	add    %rdi,%rdx
+  800bdc:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800bdf:	48 83 c1 01          	add    $0x1,%rcx
+  800be3:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800be7:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800beb:	41 80 f8 01          	cmp    $0x1,%r8b
+  800bef:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bf3:	48 39 ca             	cmp    %rcx,%rdx
+  800bf6:	75 e7                	jne    800bdf <strncpy+0xe>
+    }
+    return ret;
+}
+  800bf8:	c3                   	ret
+
+0000000000800bf9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bf9:	48 89 f8             	mov    %rdi,%rax
+  800bfc:	48 85 d2             	test   %rdx,%rdx
+  800bff:	74 24                	je     800c25 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c01:	48 83 ea 01          	sub    $0x1,%rdx
+  800c05:	74 1b                	je     800c22 <strlcpy+0x29>
+  800c07:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c0b:	0f b6 16             	movzbl (%rsi),%edx
+  800c0e:	84 d2                	test   %dl,%dl
+  800c10:	74 10                	je     800c22 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c12:	48 83 c6 01          	add    $0x1,%rsi
+  800c16:	48 83 c0 01          	add    $0x1,%rax
+  800c1a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c1d:	48 39 c8             	cmp    %rcx,%rax
+  800c20:	75 e9                	jne    800c0b <strlcpy+0x12>
+        *dst = '\0';
+  800c22:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c25:	48 29 f8             	sub    %rdi,%rax
+}
+  800c28:	c3                   	ret
+
+0000000000800c29 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c29:	0f b6 07             	movzbl (%rdi),%eax
+  800c2c:	84 c0                	test   %al,%al
+  800c2e:	74 13                	je     800c43 <strcmp+0x1a>
+  800c30:	38 06                	cmp    %al,(%rsi)
+  800c32:	75 0f                	jne    800c43 <strcmp+0x1a>
+  800c34:	48 83 c7 01          	add    $0x1,%rdi
+  800c38:	48 83 c6 01          	add    $0x1,%rsi
+  800c3c:	0f b6 07             	movzbl (%rdi),%eax
+  800c3f:	84 c0                	test   %al,%al
+  800c41:	75 ed                	jne    800c30 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c43:	0f b6 c0             	movzbl %al,%eax
+  800c46:	0f b6 16             	movzbl (%rsi),%edx
+  800c49:	29 d0                	sub    %edx,%eax
+}
+  800c4b:	c3                   	ret
+
+0000000000800c4c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c4c:	48 85 d2             	test   %rdx,%rdx
+  800c4f:	74 1f                	je     800c70 <strncmp+0x24>
+  800c51:	0f b6 07             	movzbl (%rdi),%eax
+  800c54:	84 c0                	test   %al,%al
+  800c56:	74 1e                	je     800c76 <strncmp+0x2a>
+  800c58:	3a 06                	cmp    (%rsi),%al
+  800c5a:	75 1a                	jne    800c76 <strncmp+0x2a>
+  800c5c:	48 83 c7 01          	add    $0x1,%rdi
+  800c60:	48 83 c6 01          	add    $0x1,%rsi
+  800c64:	48 83 ea 01          	sub    $0x1,%rdx
+  800c68:	75 e7                	jne    800c51 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6f:	c3                   	ret
+  800c70:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c75:	c3                   	ret
+  800c76:	48 85 d2             	test   %rdx,%rdx
+  800c79:	74 09                	je     800c84 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c7b:	0f b6 07             	movzbl (%rdi),%eax
+  800c7e:	0f b6 16             	movzbl (%rsi),%edx
+  800c81:	29 d0                	sub    %edx,%eax
+  800c83:	c3                   	ret
+    if (!n) return 0;
+  800c84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c89:	c3                   	ret
+
+0000000000800c8a <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c8a:	0f b6 17             	movzbl (%rdi),%edx
+  800c8d:	84 d2                	test   %dl,%dl
+  800c8f:	74 18                	je     800ca9 <strchr+0x1f>
+        if (*str == c) {
+  800c91:	0f be d2             	movsbl %dl,%edx
+  800c94:	39 f2                	cmp    %esi,%edx
+  800c96:	74 17                	je     800caf <strchr+0x25>
+    for (; *str; str++) {
+  800c98:	48 83 c7 01          	add    $0x1,%rdi
+  800c9c:	0f b6 17             	movzbl (%rdi),%edx
+  800c9f:	84 d2                	test   %dl,%dl
+  800ca1:	75 ee                	jne    800c91 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca8:	c3                   	ret
+  800ca9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cae:	c3                   	ret
+  800caf:	48 89 f8             	mov    %rdi,%rax
+}
+  800cb2:	c3                   	ret
+
+0000000000800cb3 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cb3:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cb6:	0f b6 17             	movzbl (%rdi),%edx
+  800cb9:	84 d2                	test   %dl,%dl
+  800cbb:	74 13                	je     800cd0 <strfind+0x1d>
+  800cbd:	0f be d2             	movsbl %dl,%edx
+  800cc0:	39 f2                	cmp    %esi,%edx
+  800cc2:	74 0b                	je     800ccf <strfind+0x1c>
+  800cc4:	48 83 c0 01          	add    $0x1,%rax
+  800cc8:	0f b6 10             	movzbl (%rax),%edx
+  800ccb:	84 d2                	test   %dl,%dl
+  800ccd:	75 ee                	jne    800cbd <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ccf:	c3                   	ret
+  800cd0:	c3                   	ret
+
+0000000000800cd1 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800cd1:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800cd4:	48 89 f8             	mov    %rdi,%rax
+  800cd7:	48 f7 d8             	neg    %rax
+  800cda:	83 e0 07             	and    $0x7,%eax
+  800cdd:	49 89 d1             	mov    %rdx,%r9
+  800ce0:	49 29 c1             	sub    %rax,%r9
+  800ce3:	78 36                	js     800d1b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ce5:	40 0f b6 c6          	movzbl %sil,%eax
+  800ce9:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800cf0:	01 01 01 
+  800cf3:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800cf7:	40 f6 c7 07          	test   $0x7,%dil
+  800cfb:	75 38                	jne    800d35 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800cfd:	4c 89 c9             	mov    %r9,%rcx
+  800d00:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d04:	74 0c                	je     800d12 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d06:	fc                   	cld
+  800d07:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d0a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d0e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d12:	4d 85 c9             	test   %r9,%r9
+  800d15:	75 45                	jne    800d5c <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d17:	4c 89 c0             	mov    %r8,%rax
+  800d1a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d1b:	48 85 d2             	test   %rdx,%rdx
+  800d1e:	74 f7                	je     800d17 <memset+0x46>
+  800d20:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d23:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d26:	48 83 c0 01          	add    $0x1,%rax
+  800d2a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d2e:	48 39 c2             	cmp    %rax,%rdx
+  800d31:	75 f3                	jne    800d26 <memset+0x55>
+  800d33:	eb e2                	jmp    800d17 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d35:	40 f6 c7 01          	test   $0x1,%dil
+  800d39:	74 06                	je     800d41 <memset+0x70>
+  800d3b:	88 07                	mov    %al,(%rdi)
+  800d3d:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d41:	40 f6 c7 02          	test   $0x2,%dil
+  800d45:	74 07                	je     800d4e <memset+0x7d>
+  800d47:	66 89 07             	mov    %ax,(%rdi)
+  800d4a:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d4e:	40 f6 c7 04          	test   $0x4,%dil
+  800d52:	74 a9                	je     800cfd <memset+0x2c>
+  800d54:	89 07                	mov    %eax,(%rdi)
+  800d56:	48 83 c7 04          	add    $0x4,%rdi
+  800d5a:	eb a1                	jmp    800cfd <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d5c:	41 f6 c1 04          	test   $0x4,%r9b
+  800d60:	74 06                	je     800d68 <memset+0x97>
+  800d62:	89 07                	mov    %eax,(%rdi)
+  800d64:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d68:	41 f6 c1 02          	test   $0x2,%r9b
+  800d6c:	74 07                	je     800d75 <memset+0xa4>
+  800d6e:	66 89 07             	mov    %ax,(%rdi)
+  800d71:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d75:	41 f6 c1 01          	test   $0x1,%r9b
+  800d79:	74 9c                	je     800d17 <memset+0x46>
+  800d7b:	88 07                	mov    %al,(%rdi)
+  800d7d:	eb 98                	jmp    800d17 <memset+0x46>
+
+0000000000800d7f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d7f:	48 89 f8             	mov    %rdi,%rax
+  800d82:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d85:	48 39 fe             	cmp    %rdi,%rsi
+  800d88:	73 3b                	jae    800dc5 <memmove+0x46>
+  800d8a:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d8e:	48 39 d7             	cmp    %rdx,%rdi
+  800d91:	73 32                	jae    800dc5 <memmove+0x46>
+        s += n;
+        d += n;
+  800d93:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d97:	48 89 d6             	mov    %rdx,%rsi
+  800d9a:	48 09 fe             	or     %rdi,%rsi
+  800d9d:	48 09 ce             	or     %rcx,%rsi
+  800da0:	40 f6 c6 07          	test   $0x7,%sil
+  800da4:	75 12                	jne    800db8 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800da6:	48 83 ef 08          	sub    $0x8,%rdi
+  800daa:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800dae:	48 c1 e9 03          	shr    $0x3,%rcx
+  800db2:	fd                   	std
+  800db3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800db6:	fc                   	cld
+  800db7:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800db8:	48 83 ef 01          	sub    $0x1,%rdi
+  800dbc:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800dc0:	fd                   	std
+  800dc1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800dc3:	eb f1                	jmp    800db6 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dc5:	48 89 f2             	mov    %rsi,%rdx
+  800dc8:	48 09 c2             	or     %rax,%rdx
+  800dcb:	48 09 ca             	or     %rcx,%rdx
+  800dce:	f6 c2 07             	test   $0x7,%dl
+  800dd1:	75 0c                	jne    800ddf <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800dd3:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dd7:	48 89 c7             	mov    %rax,%rdi
+  800dda:	fc                   	cld
+  800ddb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800dde:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ddf:	48 89 c7             	mov    %rax,%rdi
+  800de2:	fc                   	cld
+  800de3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800de5:	c3                   	ret
+
+0000000000800de6 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800de6:	55                   	push   %rbp
+  800de7:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800dea:	48 b8 7f 0d 80 00 00 	movabs $0x800d7f,%rax
+  800df1:	00 00 00 
+  800df4:	ff d0                	call   *%rax
+}
+  800df6:	5d                   	pop    %rbp
+  800df7:	c3                   	ret
+
+0000000000800df8 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800df8:	55                   	push   %rbp
+  800df9:	48 89 e5             	mov    %rsp,%rbp
+  800dfc:	41 57                	push   %r15
+  800dfe:	41 56                	push   %r14
+  800e00:	41 55                	push   %r13
+  800e02:	41 54                	push   %r12
+  800e04:	53                   	push   %rbx
+  800e05:	48 83 ec 08          	sub    $0x8,%rsp
+  800e09:	49 89 fe             	mov    %rdi,%r14
+  800e0c:	49 89 f7             	mov    %rsi,%r15
+  800e0f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e12:	48 89 f7             	mov    %rsi,%rdi
+  800e15:	48 b8 47 0b 80 00 00 	movabs $0x800b47,%rax
+  800e1c:	00 00 00 
+  800e1f:	ff d0                	call   *%rax
+  800e21:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e24:	48 89 de             	mov    %rbx,%rsi
+  800e27:	4c 89 f7             	mov    %r14,%rdi
+  800e2a:	48 b8 62 0b 80 00 00 	movabs $0x800b62,%rax
+  800e31:	00 00 00 
+  800e34:	ff d0                	call   *%rax
+  800e36:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e39:	48 39 c3             	cmp    %rax,%rbx
+  800e3c:	74 36                	je     800e74 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e3e:	48 89 d8             	mov    %rbx,%rax
+  800e41:	4c 29 e8             	sub    %r13,%rax
+  800e44:	49 39 c4             	cmp    %rax,%r12
+  800e47:	73 31                	jae    800e7a <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e49:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e4e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e52:	4c 89 fe             	mov    %r15,%rsi
+  800e55:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  800e5c:	00 00 00 
+  800e5f:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e61:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e65:	48 83 c4 08          	add    $0x8,%rsp
+  800e69:	5b                   	pop    %rbx
+  800e6a:	41 5c                	pop    %r12
+  800e6c:	41 5d                	pop    %r13
+  800e6e:	41 5e                	pop    %r14
+  800e70:	41 5f                	pop    %r15
+  800e72:	5d                   	pop    %rbp
+  800e73:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e74:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e78:	eb eb                	jmp    800e65 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e7a:	48 83 eb 01          	sub    $0x1,%rbx
+  800e7e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e82:	48 89 da             	mov    %rbx,%rdx
+  800e85:	4c 89 fe             	mov    %r15,%rsi
+  800e88:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  800e8f:	00 00 00 
+  800e92:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e94:	49 01 de             	add    %rbx,%r14
+  800e97:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e9c:	eb c3                	jmp    800e61 <strlcat+0x69>
+
+0000000000800e9e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e9e:	48 85 d2             	test   %rdx,%rdx
+  800ea1:	74 2d                	je     800ed0 <memcmp+0x32>
+  800ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ea8:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800eac:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800eb1:	44 38 c1             	cmp    %r8b,%cl
+  800eb4:	75 0f                	jne    800ec5 <memcmp+0x27>
+    while (n-- > 0) {
+  800eb6:	48 83 c0 01          	add    $0x1,%rax
+  800eba:	48 39 c2             	cmp    %rax,%rdx
+  800ebd:	75 e9                	jne    800ea8 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec4:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800ec5:	0f b6 c1             	movzbl %cl,%eax
+  800ec8:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ecc:	44 29 c0             	sub    %r8d,%eax
+  800ecf:	c3                   	ret
+    return 0;
+  800ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ed5:	c3                   	ret
+
+0000000000800ed6 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800ed6:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800eda:	48 39 c7             	cmp    %rax,%rdi
+  800edd:	73 0f                	jae    800eee <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800edf:	40 38 37             	cmp    %sil,(%rdi)
+  800ee2:	74 0e                	je     800ef2 <memfind+0x1c>
+    for (; src < end; src++) {
+  800ee4:	48 83 c7 01          	add    $0x1,%rdi
+  800ee8:	48 39 f8             	cmp    %rdi,%rax
+  800eeb:	75 f2                	jne    800edf <memfind+0x9>
+  800eed:	c3                   	ret
+  800eee:	48 89 f8             	mov    %rdi,%rax
+  800ef1:	c3                   	ret
+  800ef2:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800ef5:	c3                   	ret
+
+0000000000800ef6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800ef6:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800ef9:	0f b6 37             	movzbl (%rdi),%esi
+  800efc:	40 80 fe 20          	cmp    $0x20,%sil
+  800f00:	74 06                	je     800f08 <strtol+0x12>
+  800f02:	40 80 fe 09          	cmp    $0x9,%sil
+  800f06:	75 13                	jne    800f1b <strtol+0x25>
+  800f08:	48 83 c7 01          	add    $0x1,%rdi
+  800f0c:	0f b6 37             	movzbl (%rdi),%esi
+  800f0f:	40 80 fe 20          	cmp    $0x20,%sil
+  800f13:	74 f3                	je     800f08 <strtol+0x12>
+  800f15:	40 80 fe 09          	cmp    $0x9,%sil
+  800f19:	74 ed                	je     800f08 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f1b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f1e:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f21:	3c 01                	cmp    $0x1,%al
+  800f23:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f27:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f2d:	75 0f                	jne    800f3e <strtol+0x48>
+  800f2f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f32:	74 14                	je     800f48 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f34:	85 d2                	test   %edx,%edx
+  800f36:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f3b:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f3e:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f43:	4c 63 ca             	movslq %edx,%r9
+  800f46:	eb 36                	jmp    800f7e <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f48:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f4c:	74 0f                	je     800f5d <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f4e:	85 d2                	test   %edx,%edx
+  800f50:	75 ec                	jne    800f3e <strtol+0x48>
+        s++;
+  800f52:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f56:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f5b:	eb e1                	jmp    800f3e <strtol+0x48>
+        s += 2;
+  800f5d:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f61:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f66:	eb d6                	jmp    800f3e <strtol+0x48>
+            dig -= '0';
+  800f68:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f6b:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f6f:	41 39 d0             	cmp    %edx,%r8d
+  800f72:	7d 21                	jge    800f95 <strtol+0x9f>
+        val = val * base + dig;
+  800f74:	49 0f af c1          	imul   %r9,%rax
+  800f78:	0f b6 c9             	movzbl %cl,%ecx
+  800f7b:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f7e:	48 83 c7 01          	add    $0x1,%rdi
+  800f82:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f86:	80 f9 39             	cmp    $0x39,%cl
+  800f89:	76 dd                	jbe    800f68 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f8b:	80 f9 7b             	cmp    $0x7b,%cl
+  800f8e:	77 05                	ja     800f95 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f90:	83 e9 57             	sub    $0x57,%ecx
+  800f93:	eb d6                	jmp    800f6b <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f95:	4d 85 d2             	test   %r10,%r10
+  800f98:	74 03                	je     800f9d <strtol+0xa7>
+  800f9a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f9d:	48 89 c2             	mov    %rax,%rdx
+  800fa0:	48 f7 da             	neg    %rdx
+  800fa3:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fa7:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fab:	c3                   	ret
+
+0000000000800fac <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800fac:	55                   	push   %rbp
+  800fad:	48 89 e5             	mov    %rsp,%rbp
+  800fb0:	53                   	push   %rbx
+  800fb1:	48 89 fa             	mov    %rdi,%rdx
+  800fb4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800fb7:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fbc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fc6:	be 00 00 00 00       	mov    $0x0,%esi
+  800fcb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fd1:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800fd3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fd7:	c9                   	leave
+  800fd8:	c3                   	ret
+
+0000000000800fd9 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800fd9:	55                   	push   %rbp
+  800fda:	48 89 e5             	mov    %rsp,%rbp
+  800fdd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800fde:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fe3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ff7:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801002:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801004:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801008:	c9                   	leave
+  801009:	c3                   	ret
+
+000000000080100a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80100a:	55                   	push   %rbp
+  80100b:	48 89 e5             	mov    %rsp,%rbp
+  80100e:	53                   	push   %rbx
+  80100f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801013:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801016:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80101b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801020:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801025:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80102a:	be 00 00 00 00       	mov    $0x0,%esi
+  80102f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801035:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801037:	48 85 c0             	test   %rax,%rax
+  80103a:	7f 06                	jg     801042 <sys_env_destroy+0x38>
+}
+  80103c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801040:	c9                   	leave
+  801041:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801042:	49 89 c0             	mov    %rax,%r8
+  801045:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80104a:	48 ba 90 31 80 00 00 	movabs $0x803190,%rdx
+  801051:	00 00 00 
+  801054:	be 26 00 00 00       	mov    $0x26,%esi
+  801059:	48 bf af 31 80 00 00 	movabs $0x8031af,%rdi
+  801060:	00 00 00 
+  801063:	b8 00 00 00 00       	mov    $0x0,%eax
+  801068:	49 b9 aa 29 80 00 00 	movabs $0x8029aa,%r9
+  80106f:	00 00 00 
+  801072:	41 ff d1             	call   *%r9
+
+0000000000801075 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801075:	55                   	push   %rbp
+  801076:	48 89 e5             	mov    %rsp,%rbp
+  801079:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80107a:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80107f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801084:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801089:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801093:	be 00 00 00 00       	mov    $0x0,%esi
+  801098:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80109e:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010a4:	c9                   	leave
+  8010a5:	c3                   	ret
+
+00000000008010a6 <sys_yield>:
+
+void
+sys_yield(void) {
+  8010a6:	55                   	push   %rbp
+  8010a7:	48 89 e5             	mov    %rsp,%rbp
+  8010aa:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010cf:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010d5:	c9                   	leave
+  8010d6:	c3                   	ret
+
+00000000008010d7 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8010d7:	55                   	push   %rbp
+  8010d8:	48 89 e5             	mov    %rsp,%rbp
+  8010db:	53                   	push   %rbx
+  8010dc:	48 89 fa             	mov    %rdi,%rdx
+  8010df:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010e2:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010e7:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8010ee:	00 00 00 
+  8010f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8010fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801101:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801103:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801107:	c9                   	leave
+  801108:	c3                   	ret
+
+0000000000801109 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801109:	55                   	push   %rbp
+  80110a:	48 89 e5             	mov    %rsp,%rbp
+  80110d:	53                   	push   %rbx
+  80110e:	49 89 f8             	mov    %rdi,%r8
+  801111:	48 89 d3             	mov    %rdx,%rbx
+  801114:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801117:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80111c:	4c 89 c2             	mov    %r8,%rdx
+  80111f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801122:	be 00 00 00 00       	mov    $0x0,%esi
+  801127:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80112d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80112f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801133:	c9                   	leave
+  801134:	c3                   	ret
+
+0000000000801135 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801135:	55                   	push   %rbp
+  801136:	48 89 e5             	mov    %rsp,%rbp
+  801139:	53                   	push   %rbx
+  80113a:	48 83 ec 08          	sub    $0x8,%rsp
+  80113e:	89 f8                	mov    %edi,%eax
+  801140:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801143:	48 63 f9             	movslq %ecx,%rdi
+  801146:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801149:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80114e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801151:	be 00 00 00 00       	mov    $0x0,%esi
+  801156:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80115c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80115e:	48 85 c0             	test   %rax,%rax
+  801161:	7f 06                	jg     801169 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801163:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801167:	c9                   	leave
+  801168:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801169:	49 89 c0             	mov    %rax,%r8
+  80116c:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801171:	48 ba 90 31 80 00 00 	movabs $0x803190,%rdx
+  801178:	00 00 00 
+  80117b:	be 26 00 00 00       	mov    $0x26,%esi
+  801180:	48 bf af 31 80 00 00 	movabs $0x8031af,%rdi
+  801187:	00 00 00 
+  80118a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118f:	49 b9 aa 29 80 00 00 	movabs $0x8029aa,%r9
+  801196:	00 00 00 
+  801199:	41 ff d1             	call   *%r9
+
+000000000080119c <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80119c:	55                   	push   %rbp
+  80119d:	48 89 e5             	mov    %rsp,%rbp
+  8011a0:	53                   	push   %rbx
+  8011a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8011a5:	89 f8                	mov    %edi,%eax
+  8011a7:	49 89 f2             	mov    %rsi,%r10
+  8011aa:	48 89 cf             	mov    %rcx,%rdi
+  8011ad:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011b0:	48 63 da             	movslq %edx,%rbx
+  8011b3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011b6:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011bb:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011be:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8011c1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011c3:	48 85 c0             	test   %rax,%rax
+  8011c6:	7f 06                	jg     8011ce <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011cc:	c9                   	leave
+  8011cd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011ce:	49 89 c0             	mov    %rax,%r8
+  8011d1:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8011d6:	48 ba 90 31 80 00 00 	movabs $0x803190,%rdx
+  8011dd:	00 00 00 
+  8011e0:	be 26 00 00 00       	mov    $0x26,%esi
+  8011e5:	48 bf af 31 80 00 00 	movabs $0x8031af,%rdi
+  8011ec:	00 00 00 
+  8011ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f4:	49 b9 aa 29 80 00 00 	movabs $0x8029aa,%r9
+  8011fb:	00 00 00 
+  8011fe:	41 ff d1             	call   *%r9
+
+0000000000801201 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801201:	55                   	push   %rbp
+  801202:	48 89 e5             	mov    %rsp,%rbp
+  801205:	53                   	push   %rbx
+  801206:	48 83 ec 08          	sub    $0x8,%rsp
+  80120a:	48 89 f1             	mov    %rsi,%rcx
+  80120d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801210:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801213:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801218:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80121d:	be 00 00 00 00       	mov    $0x0,%esi
+  801222:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801228:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80122a:	48 85 c0             	test   %rax,%rax
+  80122d:	7f 06                	jg     801235 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80122f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801233:	c9                   	leave
+  801234:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801235:	49 89 c0             	mov    %rax,%r8
+  801238:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80123d:	48 ba 90 31 80 00 00 	movabs $0x803190,%rdx
+  801244:	00 00 00 
+  801247:	be 26 00 00 00       	mov    $0x26,%esi
+  80124c:	48 bf af 31 80 00 00 	movabs $0x8031af,%rdi
+  801253:	00 00 00 
+  801256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80125b:	49 b9 aa 29 80 00 00 	movabs $0x8029aa,%r9
+  801262:	00 00 00 
+  801265:	41 ff d1             	call   *%r9
+
+0000000000801268 <sys_region_advise>:
+
+int
+sys_region_advise(envid_t envid, void *va, size_t size, int advice) {
+  801268:	55                   	push   %rbp
+  801269:	48 89 e5             	mov    %rsp,%rbp
+  80126c:	53                   	push   %rbx
+  80126d:	48 83 ec 08          	sub    $0x8,%rsp
+  801271:	89 f8                	mov    %edi,%eax
+  801273:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_region_advise, 1, envid, (uintptr_t)va, size, advice, 0, 0);
+  801276:	48 63 f9             	movslq %ecx,%rdi
+  801279:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80127c:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801281:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801284:	be 00 00 00 00       	mov    $0x0,%esi
+  801289:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80128f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801291:	48 85 c0             	test   %rax,%rax
+  801294:	7f 06                	jg     80129c <sys_region_advise+0x34>
+}
+  801296:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80129a:	c9                   	leave
+  80129b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80129c:	49 89 c0             	mov    %rax,%r8
+  80129f:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8012a4:	48 ba 90 31 80 00 00 	movabs $0x803190,%rdx
+  8012ab:	00 00 00 
+  8012ae:	be 26 00 00 00       	mov    $0x26,%esi
+  8012b3:	48 bf af 31 80 00 00 	movabs $0x8031af,%rdi
+  8012ba:	00 00 00 
+  8012bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c2:	49 b9 aa 29 80 00 00 	movabs $0x8029aa,%r9
+  8012c9:	00 00 00 
+  8012cc:	41 ff d1             	call   *%r9
+
+00000000008012cf <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  8012cf:	55                   	push   %rbp
+  8012d0:	48 89 e5             	mov    %rsp,%rbp
+  8012d3:	53                   	push   %rbx
+  8012d4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0);
+  8012d8:	48 63 ce             	movslq %esi,%rcx
+  8012db:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012de:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012fa:	48 85 c0             	test   %rax,%rax
+  8012fd:	7f 06                	jg     801305 <sys_env_set_nice+0x36>
+}
+  8012ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801303:	c9                   	leave
+  801304:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801305:	49 89 c0             	mov    %rax,%r8
+  801308:	b9 15 00 00 00       	mov    $0x15,%ecx
+  80130d:	48 ba 90 31 80 00 00 	movabs $0x803190,%rdx
+  801314:	00 00 00 
+  801317:	be 26 00 00 00       	mov    $0x26,%esi
+  80131c:	48 bf af 31 80 00 00 	movabs $0x8031af,%rdi
+  801323:	00 00 00 
+  801326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132b:	49 b9 aa 29 80 00 00 	movabs $0x8029aa,%r9
+  801332:	00 00 00 
+  801335:	41 ff d1             	call   *%r9
+
+0000000000801338 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801338:	55                   	push   %rbp
+  801339:	48 89 e5             	mov    %rsp,%rbp
+  80133c:	53                   	push   %rbx
+  80133d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801341:	48 63 ce             	movslq %esi,%rcx
+  801344:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801347:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80134c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801351:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801356:	be 00 00 00 00       	mov    $0x0,%esi
+  80135b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801361:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801363:	48 85 c0             	test   %rax,%rax
+  801366:	7f 06                	jg     80136e <sys_env_set_status+0x36>
+}
+  801368:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80136c:	c9                   	leave
+  80136d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80136e:	49 89 c0             	mov    %rax,%r8
+  801371:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801376:	48 ba 90 31 80 00 00 	movabs $0x803190,%rdx
+  80137d:	00 00 00 
+  801380:	be 26 00 00 00       	mov    $0x26,%esi
+  801385:	48 bf af 31 80 00 00 	movabs $0x8031af,%rdi
+  80138c:	00 00 00 
+  80138f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801394:	49 b9 aa 29 80 00 00 	movabs $0x8029aa,%r9
+  80139b:	00 00 00 
+  80139e:	41 ff d1             	call   *%r9
+
+00000000008013a1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013a1:	55                   	push   %rbp
+  8013a2:	48 89 e5             	mov    %rsp,%rbp
+  8013a5:	53                   	push   %rbx
+  8013a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8013aa:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013ad:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b0:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ca:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013cc:	48 85 c0             	test   %rax,%rax
+  8013cf:	7f 06                	jg     8013d7 <sys_env_set_trapframe+0x36>
+}
+  8013d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d5:	c9                   	leave
+  8013d6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013d7:	49 89 c0             	mov    %rax,%r8
+  8013da:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013df:	48 ba 90 31 80 00 00 	movabs $0x803190,%rdx
+  8013e6:	00 00 00 
+  8013e9:	be 26 00 00 00       	mov    $0x26,%esi
+  8013ee:	48 bf af 31 80 00 00 	movabs $0x8031af,%rdi
+  8013f5:	00 00 00 
+  8013f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013fd:	49 b9 aa 29 80 00 00 	movabs $0x8029aa,%r9
+  801404:	00 00 00 
+  801407:	41 ff d1             	call   *%r9
+
+000000000080140a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80140a:	55                   	push   %rbp
+  80140b:	48 89 e5             	mov    %rsp,%rbp
+  80140e:	53                   	push   %rbx
+  80140f:	48 83 ec 08          	sub    $0x8,%rsp
+  801413:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801416:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801419:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80141e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801423:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801428:	be 00 00 00 00       	mov    $0x0,%esi
+  80142d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801433:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801435:	48 85 c0             	test   %rax,%rax
+  801438:	7f 06                	jg     801440 <sys_env_set_pgfault_upcall+0x36>
+}
+  80143a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80143e:	c9                   	leave
+  80143f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801440:	49 89 c0             	mov    %rax,%r8
+  801443:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801448:	48 ba 90 31 80 00 00 	movabs $0x803190,%rdx
+  80144f:	00 00 00 
+  801452:	be 26 00 00 00       	mov    $0x26,%esi
+  801457:	48 bf af 31 80 00 00 	movabs $0x8031af,%rdi
+  80145e:	00 00 00 
+  801461:	b8 00 00 00 00       	mov    $0x0,%eax
+  801466:	49 b9 aa 29 80 00 00 	movabs $0x8029aa,%r9
+  80146d:	00 00 00 
+  801470:	41 ff d1             	call   *%r9
+
+0000000000801473 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801473:	55                   	push   %rbp
+  801474:	48 89 e5             	mov    %rsp,%rbp
+  801477:	53                   	push   %rbx
+  801478:	89 f8                	mov    %edi,%eax
+  80147a:	49 89 f1             	mov    %rsi,%r9
+  80147d:	48 89 d3             	mov    %rdx,%rbx
+  801480:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801483:	49 63 f0             	movslq %r8d,%rsi
+  801486:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801489:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80148e:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801491:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801497:	cd 30                	int    $0x30
+}
+  801499:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80149d:	c9                   	leave
+  80149e:	c3                   	ret
+
+000000000080149f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80149f:	55                   	push   %rbp
+  8014a0:	48 89 e5             	mov    %rsp,%rbp
+  8014a3:	53                   	push   %rbx
+  8014a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8014a8:	48 89 fa             	mov    %rdi,%rdx
+  8014ab:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ae:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014ca:	48 85 c0             	test   %rax,%rax
+  8014cd:	7f 06                	jg     8014d5 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d3:	c9                   	leave
+  8014d4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d5:	49 89 c0             	mov    %rax,%r8
+  8014d8:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014dd:	48 ba 90 31 80 00 00 	movabs $0x803190,%rdx
+  8014e4:	00 00 00 
+  8014e7:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ec:	48 bf af 31 80 00 00 	movabs $0x8031af,%rdi
+  8014f3:	00 00 00 
+  8014f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014fb:	49 b9 aa 29 80 00 00 	movabs $0x8029aa,%r9
+  801502:	00 00 00 
+  801505:	41 ff d1             	call   *%r9
+
+0000000000801508 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801508:	55                   	push   %rbp
+  801509:	48 89 e5             	mov    %rsp,%rbp
+  80150c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80150d:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801512:	ba 00 00 00 00       	mov    $0x0,%edx
+  801517:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80151c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801521:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801526:	be 00 00 00 00       	mov    $0x0,%esi
+  80152b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801531:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801533:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801537:	c9                   	leave
+  801538:	c3                   	ret
+
+0000000000801539 <sys_sigqueue>:
+
+
+int
+sys_sigqueue(pid_t pid, int signo, const union sigval value) {
+  801539:	55                   	push   %rbp
+  80153a:	48 89 e5             	mov    %rsp,%rbp
+  80153d:	53                   	push   %rbx
+  80153e:	48 83 ec 08          	sub    $0x8,%rsp
+  801542:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigqueue, 1, (uintptr_t)pid, (uintptr_t)signo, (uintptr_t)value.sival_ptr, 0, 0, 0);
+  801545:	48 63 ce             	movslq %esi,%rcx
+  801548:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80154b:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801550:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801555:	be 00 00 00 00       	mov    $0x0,%esi
+  80155a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801560:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801562:	48 85 c0             	test   %rax,%rax
+  801565:	7f 06                	jg     80156d <sys_sigqueue+0x34>
+}
+  801567:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80156b:	c9                   	leave
+  80156c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80156d:	49 89 c0             	mov    %rax,%r8
+  801570:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801575:	48 ba 90 31 80 00 00 	movabs $0x803190,%rdx
+  80157c:	00 00 00 
+  80157f:	be 26 00 00 00       	mov    $0x26,%esi
+  801584:	48 bf af 31 80 00 00 	movabs $0x8031af,%rdi
+  80158b:	00 00 00 
+  80158e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801593:	49 b9 aa 29 80 00 00 	movabs $0x8029aa,%r9
+  80159a:	00 00 00 
+  80159d:	41 ff d1             	call   *%r9
+
+00000000008015a0 <sys_sigwait>:
+
+int
+sys_sigwait(const sigset_t * set, int * sig) {
+  8015a0:	55                   	push   %rbp
+  8015a1:	48 89 e5             	mov    %rsp,%rbp
+  8015a4:	53                   	push   %rbx
+  8015a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a9:	48 89 fa             	mov    %rdi,%rdx
+  8015ac:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015af:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015be:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015cb:	48 85 c0             	test   %rax,%rax
+  8015ce:	7f 06                	jg     8015d6 <sys_sigwait+0x36>
+    return syscall(SYS_sigwait, 1, (uintptr_t)set, (uintptr_t)sig, 0, 0, 0, 0);
+}
+  8015d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d4:	c9                   	leave
+  8015d5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015d6:	49 89 c0             	mov    %rax,%r8
+  8015d9:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8015de:	48 ba 90 31 80 00 00 	movabs $0x803190,%rdx
+  8015e5:	00 00 00 
+  8015e8:	be 26 00 00 00       	mov    $0x26,%esi
+  8015ed:	48 bf af 31 80 00 00 	movabs $0x8031af,%rdi
+  8015f4:	00 00 00 
+  8015f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fc:	49 b9 aa 29 80 00 00 	movabs $0x8029aa,%r9
+  801603:	00 00 00 
+  801606:	41 ff d1             	call   *%r9
+
+0000000000801609 <sys_sigaction>:
+
+int
+sys_sigaction(int sig, const struct sigaction * act, struct sigaction * oact) {
+  801609:	55                   	push   %rbp
+  80160a:	48 89 e5             	mov    %rsp,%rbp
+  80160d:	53                   	push   %rbx
+  80160e:	48 83 ec 08          	sub    $0x8,%rsp
+  801612:	48 89 f1             	mov    %rsi,%rcx
+  801615:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigaction, 1, (uintptr_t)sig, (uintptr_t)act, (uintptr_t)oact, 0, 0, 0);
+  801618:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80161b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801620:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801625:	be 00 00 00 00       	mov    $0x0,%esi
+  80162a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801630:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801632:	48 85 c0             	test   %rax,%rax
+  801635:	7f 06                	jg     80163d <sys_sigaction+0x34>
+}
+  801637:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80163b:	c9                   	leave
+  80163c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80163d:	49 89 c0             	mov    %rax,%r8
+  801640:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801645:	48 ba 90 31 80 00 00 	movabs $0x803190,%rdx
+  80164c:	00 00 00 
+  80164f:	be 26 00 00 00       	mov    $0x26,%esi
+  801654:	48 bf af 31 80 00 00 	movabs $0x8031af,%rdi
+  80165b:	00 00 00 
+  80165e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801663:	49 b9 aa 29 80 00 00 	movabs $0x8029aa,%r9
+  80166a:	00 00 00 
+  80166d:	41 ff d1             	call   *%r9
+
+0000000000801670 <sys_sigprocmask>:
+
+
+int
+sys_sigprocmask(int how, const sigset_t * set, sigset_t * oldset) {
+  801670:	55                   	push   %rbp
+  801671:	48 89 e5             	mov    %rsp,%rbp
+  801674:	53                   	push   %rbx
+  801675:	48 83 ec 08          	sub    $0x8,%rsp
+  801679:	48 89 f1             	mov    %rsi,%rcx
+  80167c:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_sigprocmask, 1, (uintptr_t)how, (uintptr_t)set, (uintptr_t)oldset, 0, 0, 0);
+  80167f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801682:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801687:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80168c:	be 00 00 00 00       	mov    $0x0,%esi
+  801691:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801697:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801699:	48 85 c0             	test   %rax,%rax
+  80169c:	7f 06                	jg     8016a4 <sys_sigprocmask+0x34>
+}
+  80169e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a2:	c9                   	leave
+  8016a3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016a4:	49 89 c0             	mov    %rax,%r8
+  8016a7:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8016ac:	48 ba 90 31 80 00 00 	movabs $0x803190,%rdx
+  8016b3:	00 00 00 
+  8016b6:	be 26 00 00 00       	mov    $0x26,%esi
+  8016bb:	48 bf af 31 80 00 00 	movabs $0x8031af,%rdi
+  8016c2:	00 00 00 
+  8016c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ca:	49 b9 aa 29 80 00 00 	movabs $0x8029aa,%r9
+  8016d1:	00 00 00 
+  8016d4:	41 ff d1             	call   *%r9
+
+00000000008016d7 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016d7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016de:	ff ff ff 
+  8016e1:	48 01 f8             	add    %rdi,%rax
+  8016e4:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8016e8:	c3                   	ret
+
+00000000008016e9 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016e9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016f0:	ff ff ff 
+  8016f3:	48 01 f8             	add    %rdi,%rax
+  8016f6:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8016fa:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801700:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801704:	c3                   	ret
+
+0000000000801705 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801705:	55                   	push   %rbp
+  801706:	48 89 e5             	mov    %rsp,%rbp
+  801709:	41 57                	push   %r15
+  80170b:	41 56                	push   %r14
+  80170d:	41 55                	push   %r13
+  80170f:	41 54                	push   %r12
+  801711:	53                   	push   %rbx
+  801712:	48 83 ec 08          	sub    $0x8,%rsp
+  801716:	49 89 ff             	mov    %rdi,%r15
+  801719:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80171e:	49 bd 83 26 80 00 00 	movabs $0x802683,%r13
+  801725:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801728:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80172e:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801731:	48 89 df             	mov    %rbx,%rdi
+  801734:	41 ff d5             	call   *%r13
+  801737:	83 e0 04             	and    $0x4,%eax
+  80173a:	74 17                	je     801753 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80173c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801743:	4c 39 f3             	cmp    %r14,%rbx
+  801746:	75 e6                	jne    80172e <fd_alloc+0x29>
+  801748:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80174e:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801753:	4d 89 27             	mov    %r12,(%r15)
+}
+  801756:	48 83 c4 08          	add    $0x8,%rsp
+  80175a:	5b                   	pop    %rbx
+  80175b:	41 5c                	pop    %r12
+  80175d:	41 5d                	pop    %r13
+  80175f:	41 5e                	pop    %r14
+  801761:	41 5f                	pop    %r15
+  801763:	5d                   	pop    %rbp
+  801764:	c3                   	ret
+
+0000000000801765 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801765:	83 ff 1f             	cmp    $0x1f,%edi
+  801768:	77 39                	ja     8017a3 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80176a:	55                   	push   %rbp
+  80176b:	48 89 e5             	mov    %rsp,%rbp
+  80176e:	41 54                	push   %r12
+  801770:	53                   	push   %rbx
+  801771:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801774:	48 63 df             	movslq %edi,%rbx
+  801777:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80177e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801782:	48 89 df             	mov    %rbx,%rdi
+  801785:	48 b8 83 26 80 00 00 	movabs $0x802683,%rax
+  80178c:	00 00 00 
+  80178f:	ff d0                	call   *%rax
+  801791:	a8 04                	test   $0x4,%al
+  801793:	74 14                	je     8017a9 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801795:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801799:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80179e:	5b                   	pop    %rbx
+  80179f:	41 5c                	pop    %r12
+  8017a1:	5d                   	pop    %rbp
+  8017a2:	c3                   	ret
+        return -E_INVAL;
+  8017a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017a8:	c3                   	ret
+        return -E_INVAL;
+  8017a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ae:	eb ee                	jmp    80179e <fd_lookup+0x39>
+
+00000000008017b0 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8017b0:	55                   	push   %rbp
+  8017b1:	48 89 e5             	mov    %rsp,%rbp
+  8017b4:	41 54                	push   %r12
+  8017b6:	53                   	push   %rbx
+  8017b7:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8017ba:	48 b8 40 32 80 00 00 	movabs $0x803240,%rax
+  8017c1:	00 00 00 
+  8017c4:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8017cb:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8017ce:	39 3b                	cmp    %edi,(%rbx)
+  8017d0:	74 47                	je     801819 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8017d2:	48 83 c0 08          	add    $0x8,%rax
+  8017d6:	48 8b 18             	mov    (%rax),%rbx
+  8017d9:	48 85 db             	test   %rbx,%rbx
+  8017dc:	75 f0                	jne    8017ce <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8017de:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8017e5:	00 00 00 
+  8017e8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8017ee:	89 fa                	mov    %edi,%edx
+  8017f0:	48 bf c0 31 80 00 00 	movabs $0x8031c0,%rdi
+  8017f7:	00 00 00 
+  8017fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ff:	48 b9 60 02 80 00 00 	movabs $0x800260,%rcx
+  801806:	00 00 00 
+  801809:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80180b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801810:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801814:	5b                   	pop    %rbx
+  801815:	41 5c                	pop    %r12
+  801817:	5d                   	pop    %rbp
+  801818:	c3                   	ret
+            return 0;
+  801819:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181e:	eb f0                	jmp    801810 <dev_lookup+0x60>
+
+0000000000801820 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801820:	55                   	push   %rbp
+  801821:	48 89 e5             	mov    %rsp,%rbp
+  801824:	41 55                	push   %r13
+  801826:	41 54                	push   %r12
+  801828:	53                   	push   %rbx
+  801829:	48 83 ec 18          	sub    $0x18,%rsp
+  80182d:	48 89 fb             	mov    %rdi,%rbx
+  801830:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801833:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80183a:	ff ff ff 
+  80183d:	48 01 df             	add    %rbx,%rdi
+  801840:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801844:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801848:	48 b8 65 17 80 00 00 	movabs $0x801765,%rax
+  80184f:	00 00 00 
+  801852:	ff d0                	call   *%rax
+  801854:	41 89 c5             	mov    %eax,%r13d
+  801857:	85 c0                	test   %eax,%eax
+  801859:	78 06                	js     801861 <fd_close+0x41>
+  80185b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80185f:	74 1a                	je     80187b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801861:	45 84 e4             	test   %r12b,%r12b
+  801864:	b8 00 00 00 00       	mov    $0x0,%eax
+  801869:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80186d:	44 89 e8             	mov    %r13d,%eax
+  801870:	48 83 c4 18          	add    $0x18,%rsp
+  801874:	5b                   	pop    %rbx
+  801875:	41 5c                	pop    %r12
+  801877:	41 5d                	pop    %r13
+  801879:	5d                   	pop    %rbp
+  80187a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80187b:	8b 3b                	mov    (%rbx),%edi
+  80187d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801881:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801888:	00 00 00 
+  80188b:	ff d0                	call   *%rax
+  80188d:	41 89 c5             	mov    %eax,%r13d
+  801890:	85 c0                	test   %eax,%eax
+  801892:	78 1b                	js     8018af <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801894:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801898:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80189c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8018a2:	48 85 c0             	test   %rax,%rax
+  8018a5:	74 08                	je     8018af <fd_close+0x8f>
+  8018a7:	48 89 df             	mov    %rbx,%rdi
+  8018aa:	ff d0                	call   *%rax
+  8018ac:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8018af:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018b4:	48 89 de             	mov    %rbx,%rsi
+  8018b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018bc:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  8018c3:	00 00 00 
+  8018c6:	ff d0                	call   *%rax
+    return res;
+  8018c8:	eb a3                	jmp    80186d <fd_close+0x4d>
+
+00000000008018ca <close>:
+
+int
+close(int fdnum) {
+  8018ca:	55                   	push   %rbp
+  8018cb:	48 89 e5             	mov    %rsp,%rbp
+  8018ce:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8018d2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8018d6:	48 b8 65 17 80 00 00 	movabs $0x801765,%rax
+  8018dd:	00 00 00 
+  8018e0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018e2:	85 c0                	test   %eax,%eax
+  8018e4:	78 15                	js     8018fb <close+0x31>
+
+    return fd_close(fd, 1);
+  8018e6:	be 01 00 00 00       	mov    $0x1,%esi
+  8018eb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8018ef:	48 b8 20 18 80 00 00 	movabs $0x801820,%rax
+  8018f6:	00 00 00 
+  8018f9:	ff d0                	call   *%rax
+}
+  8018fb:	c9                   	leave
+  8018fc:	c3                   	ret
+
+00000000008018fd <close_all>:
+
+void
+close_all(void) {
+  8018fd:	55                   	push   %rbp
+  8018fe:	48 89 e5             	mov    %rsp,%rbp
+  801901:	41 54                	push   %r12
+  801903:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801904:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801909:	49 bc ca 18 80 00 00 	movabs $0x8018ca,%r12
+  801910:	00 00 00 
+  801913:	89 df                	mov    %ebx,%edi
+  801915:	41 ff d4             	call   *%r12
+  801918:	83 c3 01             	add    $0x1,%ebx
+  80191b:	83 fb 20             	cmp    $0x20,%ebx
+  80191e:	75 f3                	jne    801913 <close_all+0x16>
+}
+  801920:	5b                   	pop    %rbx
+  801921:	41 5c                	pop    %r12
+  801923:	5d                   	pop    %rbp
+  801924:	c3                   	ret
+
+0000000000801925 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801925:	55                   	push   %rbp
+  801926:	48 89 e5             	mov    %rsp,%rbp
+  801929:	41 57                	push   %r15
+  80192b:	41 56                	push   %r14
+  80192d:	41 55                	push   %r13
+  80192f:	41 54                	push   %r12
+  801931:	53                   	push   %rbx
+  801932:	48 83 ec 18          	sub    $0x18,%rsp
+  801936:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801939:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80193d:	48 b8 65 17 80 00 00 	movabs $0x801765,%rax
+  801944:	00 00 00 
+  801947:	ff d0                	call   *%rax
+  801949:	89 c3                	mov    %eax,%ebx
+  80194b:	85 c0                	test   %eax,%eax
+  80194d:	0f 88 b8 00 00 00    	js     801a0b <dup+0xe6>
+    close(newfdnum);
+  801953:	44 89 e7             	mov    %r12d,%edi
+  801956:	48 b8 ca 18 80 00 00 	movabs $0x8018ca,%rax
+  80195d:	00 00 00 
+  801960:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801962:	4d 63 ec             	movslq %r12d,%r13
+  801965:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80196c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801970:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801974:	4c 89 ff             	mov    %r15,%rdi
+  801977:	49 be e9 16 80 00 00 	movabs $0x8016e9,%r14
+  80197e:	00 00 00 
+  801981:	41 ff d6             	call   *%r14
+  801984:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801987:	4c 89 ef             	mov    %r13,%rdi
+  80198a:	41 ff d6             	call   *%r14
+  80198d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801990:	48 89 df             	mov    %rbx,%rdi
+  801993:	48 b8 83 26 80 00 00 	movabs $0x802683,%rax
+  80199a:	00 00 00 
+  80199d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80199f:	a8 04                	test   $0x4,%al
+  8019a1:	74 2b                	je     8019ce <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8019a3:	41 89 c1             	mov    %eax,%r9d
+  8019a6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019ac:	4c 89 f1             	mov    %r14,%rcx
+  8019af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b4:	48 89 de             	mov    %rbx,%rsi
+  8019b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019bc:	48 b8 9c 11 80 00 00 	movabs $0x80119c,%rax
+  8019c3:	00 00 00 
+  8019c6:	ff d0                	call   *%rax
+  8019c8:	89 c3                	mov    %eax,%ebx
+  8019ca:	85 c0                	test   %eax,%eax
+  8019cc:	78 4e                	js     801a1c <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8019ce:	4c 89 ff             	mov    %r15,%rdi
+  8019d1:	48 b8 83 26 80 00 00 	movabs $0x802683,%rax
+  8019d8:	00 00 00 
+  8019db:	ff d0                	call   *%rax
+  8019dd:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8019e0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019e6:	4c 89 e9             	mov    %r13,%rcx
+  8019e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ee:	4c 89 fe             	mov    %r15,%rsi
+  8019f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019f6:	48 b8 9c 11 80 00 00 	movabs $0x80119c,%rax
+  8019fd:	00 00 00 
+  801a00:	ff d0                	call   *%rax
+  801a02:	89 c3                	mov    %eax,%ebx
+  801a04:	85 c0                	test   %eax,%eax
+  801a06:	78 14                	js     801a1c <dup+0xf7>
+
+    return newfdnum;
+  801a08:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801a0b:	89 d8                	mov    %ebx,%eax
+  801a0d:	48 83 c4 18          	add    $0x18,%rsp
+  801a11:	5b                   	pop    %rbx
+  801a12:	41 5c                	pop    %r12
+  801a14:	41 5d                	pop    %r13
+  801a16:	41 5e                	pop    %r14
+  801a18:	41 5f                	pop    %r15
+  801a1a:	5d                   	pop    %rbp
+  801a1b:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a1c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a21:	4c 89 ee             	mov    %r13,%rsi
+  801a24:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a29:	49 bc 01 12 80 00 00 	movabs $0x801201,%r12
+  801a30:	00 00 00 
+  801a33:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801a36:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a3b:	4c 89 f6             	mov    %r14,%rsi
+  801a3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a43:	41 ff d4             	call   *%r12
+    return res;
+  801a46:	eb c3                	jmp    801a0b <dup+0xe6>
+
+0000000000801a48 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801a48:	55                   	push   %rbp
+  801a49:	48 89 e5             	mov    %rsp,%rbp
+  801a4c:	41 56                	push   %r14
+  801a4e:	41 55                	push   %r13
+  801a50:	41 54                	push   %r12
+  801a52:	53                   	push   %rbx
+  801a53:	48 83 ec 10          	sub    $0x10,%rsp
+  801a57:	89 fb                	mov    %edi,%ebx
+  801a59:	49 89 f4             	mov    %rsi,%r12
+  801a5c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a5f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a63:	48 b8 65 17 80 00 00 	movabs $0x801765,%rax
+  801a6a:	00 00 00 
+  801a6d:	ff d0                	call   *%rax
+  801a6f:	85 c0                	test   %eax,%eax
+  801a71:	78 4c                	js     801abf <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a73:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a77:	41 8b 3e             	mov    (%r14),%edi
+  801a7a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a7e:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801a85:	00 00 00 
+  801a88:	ff d0                	call   *%rax
+  801a8a:	85 c0                	test   %eax,%eax
+  801a8c:	78 35                	js     801ac3 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a8e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a92:	83 e0 03             	and    $0x3,%eax
+  801a95:	83 f8 01             	cmp    $0x1,%eax
+  801a98:	74 2d                	je     801ac7 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a9a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a9e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801aa2:	48 85 c0             	test   %rax,%rax
+  801aa5:	74 56                	je     801afd <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801aa7:	4c 89 ea             	mov    %r13,%rdx
+  801aaa:	4c 89 e6             	mov    %r12,%rsi
+  801aad:	4c 89 f7             	mov    %r14,%rdi
+  801ab0:	ff d0                	call   *%rax
+}
+  801ab2:	48 83 c4 10          	add    $0x10,%rsp
+  801ab6:	5b                   	pop    %rbx
+  801ab7:	41 5c                	pop    %r12
+  801ab9:	41 5d                	pop    %r13
+  801abb:	41 5e                	pop    %r14
+  801abd:	5d                   	pop    %rbp
+  801abe:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801abf:	48 98                	cltq
+  801ac1:	eb ef                	jmp    801ab2 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ac3:	48 98                	cltq
+  801ac5:	eb eb                	jmp    801ab2 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ac7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ace:	00 00 00 
+  801ad1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ad7:	89 da                	mov    %ebx,%edx
+  801ad9:	48 bf 01 32 80 00 00 	movabs $0x803201,%rdi
+  801ae0:	00 00 00 
+  801ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae8:	48 b9 60 02 80 00 00 	movabs $0x800260,%rcx
+  801aef:	00 00 00 
+  801af2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801af4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801afb:	eb b5                	jmp    801ab2 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801afd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b04:	eb ac                	jmp    801ab2 <read+0x6a>
+
+0000000000801b06 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801b06:	55                   	push   %rbp
+  801b07:	48 89 e5             	mov    %rsp,%rbp
+  801b0a:	41 57                	push   %r15
+  801b0c:	41 56                	push   %r14
+  801b0e:	41 55                	push   %r13
+  801b10:	41 54                	push   %r12
+  801b12:	53                   	push   %rbx
+  801b13:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b17:	48 85 d2             	test   %rdx,%rdx
+  801b1a:	74 54                	je     801b70 <readn+0x6a>
+  801b1c:	41 89 fd             	mov    %edi,%r13d
+  801b1f:	49 89 f6             	mov    %rsi,%r14
+  801b22:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b25:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b2a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b2f:	49 bf 48 1a 80 00 00 	movabs $0x801a48,%r15
+  801b36:	00 00 00 
+  801b39:	4c 89 e2             	mov    %r12,%rdx
+  801b3c:	48 29 f2             	sub    %rsi,%rdx
+  801b3f:	4c 01 f6             	add    %r14,%rsi
+  801b42:	44 89 ef             	mov    %r13d,%edi
+  801b45:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b48:	85 c0                	test   %eax,%eax
+  801b4a:	78 20                	js     801b6c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b4c:	01 c3                	add    %eax,%ebx
+  801b4e:	85 c0                	test   %eax,%eax
+  801b50:	74 08                	je     801b5a <readn+0x54>
+  801b52:	48 63 f3             	movslq %ebx,%rsi
+  801b55:	4c 39 e6             	cmp    %r12,%rsi
+  801b58:	72 df                	jb     801b39 <readn+0x33>
+    }
+    return res;
+  801b5a:	48 63 c3             	movslq %ebx,%rax
+}
+  801b5d:	48 83 c4 08          	add    $0x8,%rsp
+  801b61:	5b                   	pop    %rbx
+  801b62:	41 5c                	pop    %r12
+  801b64:	41 5d                	pop    %r13
+  801b66:	41 5e                	pop    %r14
+  801b68:	41 5f                	pop    %r15
+  801b6a:	5d                   	pop    %rbp
+  801b6b:	c3                   	ret
+        if (inc < 0) return inc;
+  801b6c:	48 98                	cltq
+  801b6e:	eb ed                	jmp    801b5d <readn+0x57>
+    int inc = 1, res = 0;
+  801b70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b75:	eb e3                	jmp    801b5a <readn+0x54>
+
+0000000000801b77 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801b77:	55                   	push   %rbp
+  801b78:	48 89 e5             	mov    %rsp,%rbp
+  801b7b:	41 56                	push   %r14
+  801b7d:	41 55                	push   %r13
+  801b7f:	41 54                	push   %r12
+  801b81:	53                   	push   %rbx
+  801b82:	48 83 ec 10          	sub    $0x10,%rsp
+  801b86:	89 fb                	mov    %edi,%ebx
+  801b88:	49 89 f4             	mov    %rsi,%r12
+  801b8b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b8e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b92:	48 b8 65 17 80 00 00 	movabs $0x801765,%rax
+  801b99:	00 00 00 
+  801b9c:	ff d0                	call   *%rax
+  801b9e:	85 c0                	test   %eax,%eax
+  801ba0:	78 47                	js     801be9 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ba2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ba6:	41 8b 3e             	mov    (%r14),%edi
+  801ba9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bad:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801bb4:	00 00 00 
+  801bb7:	ff d0                	call   *%rax
+  801bb9:	85 c0                	test   %eax,%eax
+  801bbb:	78 30                	js     801bed <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bbd:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801bc2:	74 2d                	je     801bf1 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801bc4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bc8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801bcc:	48 85 c0             	test   %rax,%rax
+  801bcf:	74 56                	je     801c27 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801bd1:	4c 89 ea             	mov    %r13,%rdx
+  801bd4:	4c 89 e6             	mov    %r12,%rsi
+  801bd7:	4c 89 f7             	mov    %r14,%rdi
+  801bda:	ff d0                	call   *%rax
+}
+  801bdc:	48 83 c4 10          	add    $0x10,%rsp
+  801be0:	5b                   	pop    %rbx
+  801be1:	41 5c                	pop    %r12
+  801be3:	41 5d                	pop    %r13
+  801be5:	41 5e                	pop    %r14
+  801be7:	5d                   	pop    %rbp
+  801be8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801be9:	48 98                	cltq
+  801beb:	eb ef                	jmp    801bdc <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bed:	48 98                	cltq
+  801bef:	eb eb                	jmp    801bdc <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bf1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801bf8:	00 00 00 
+  801bfb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c01:	89 da                	mov    %ebx,%edx
+  801c03:	48 bf 1d 32 80 00 00 	movabs $0x80321d,%rdi
+  801c0a:	00 00 00 
+  801c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c12:	48 b9 60 02 80 00 00 	movabs $0x800260,%rcx
+  801c19:	00 00 00 
+  801c1c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c1e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c25:	eb b5                	jmp    801bdc <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c27:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c2e:	eb ac                	jmp    801bdc <write+0x65>
+
+0000000000801c30 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c30:	55                   	push   %rbp
+  801c31:	48 89 e5             	mov    %rsp,%rbp
+  801c34:	53                   	push   %rbx
+  801c35:	48 83 ec 18          	sub    $0x18,%rsp
+  801c39:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c3b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c3f:	48 b8 65 17 80 00 00 	movabs $0x801765,%rax
+  801c46:	00 00 00 
+  801c49:	ff d0                	call   *%rax
+  801c4b:	85 c0                	test   %eax,%eax
+  801c4d:	78 0c                	js     801c5b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801c4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c53:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801c56:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c5b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c5f:	c9                   	leave
+  801c60:	c3                   	ret
+
+0000000000801c61 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801c61:	55                   	push   %rbp
+  801c62:	48 89 e5             	mov    %rsp,%rbp
+  801c65:	41 55                	push   %r13
+  801c67:	41 54                	push   %r12
+  801c69:	53                   	push   %rbx
+  801c6a:	48 83 ec 18          	sub    $0x18,%rsp
+  801c6e:	89 fb                	mov    %edi,%ebx
+  801c70:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c73:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c77:	48 b8 65 17 80 00 00 	movabs $0x801765,%rax
+  801c7e:	00 00 00 
+  801c81:	ff d0                	call   *%rax
+  801c83:	85 c0                	test   %eax,%eax
+  801c85:	78 38                	js     801cbf <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c87:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801c8b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c8f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c93:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801c9a:	00 00 00 
+  801c9d:	ff d0                	call   *%rax
+  801c9f:	85 c0                	test   %eax,%eax
+  801ca1:	78 1c                	js     801cbf <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ca3:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801ca8:	74 20                	je     801cca <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801caa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cae:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801cb2:	48 85 c0             	test   %rax,%rax
+  801cb5:	74 47                	je     801cfe <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801cb7:	44 89 e6             	mov    %r12d,%esi
+  801cba:	4c 89 ef             	mov    %r13,%rdi
+  801cbd:	ff d0                	call   *%rax
+}
+  801cbf:	48 83 c4 18          	add    $0x18,%rsp
+  801cc3:	5b                   	pop    %rbx
+  801cc4:	41 5c                	pop    %r12
+  801cc6:	41 5d                	pop    %r13
+  801cc8:	5d                   	pop    %rbp
+  801cc9:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801cca:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801cd1:	00 00 00 
+  801cd4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cda:	89 da                	mov    %ebx,%edx
+  801cdc:	48 bf e0 31 80 00 00 	movabs $0x8031e0,%rdi
+  801ce3:	00 00 00 
+  801ce6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ceb:	48 b9 60 02 80 00 00 	movabs $0x800260,%rcx
+  801cf2:	00 00 00 
+  801cf5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cf7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cfc:	eb c1                	jmp    801cbf <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801cfe:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d03:	eb ba                	jmp    801cbf <ftruncate+0x5e>
+
+0000000000801d05 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801d05:	55                   	push   %rbp
+  801d06:	48 89 e5             	mov    %rsp,%rbp
+  801d09:	41 54                	push   %r12
+  801d0b:	53                   	push   %rbx
+  801d0c:	48 83 ec 10          	sub    $0x10,%rsp
+  801d10:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d13:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d17:	48 b8 65 17 80 00 00 	movabs $0x801765,%rax
+  801d1e:	00 00 00 
+  801d21:	ff d0                	call   *%rax
+  801d23:	85 c0                	test   %eax,%eax
+  801d25:	78 4e                	js     801d75 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d27:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d2b:	41 8b 3c 24          	mov    (%r12),%edi
+  801d2f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d33:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801d3a:	00 00 00 
+  801d3d:	ff d0                	call   *%rax
+  801d3f:	85 c0                	test   %eax,%eax
+  801d41:	78 32                	js     801d75 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d43:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d47:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801d4c:	74 30                	je     801d7e <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801d4e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801d51:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801d58:	00 00 00 
+    stat->st_isdir = 0;
+  801d5b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801d62:	00 00 00 
+    stat->st_dev = dev;
+  801d65:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801d6c:	48 89 de             	mov    %rbx,%rsi
+  801d6f:	4c 89 e7             	mov    %r12,%rdi
+  801d72:	ff 50 28             	call   *0x28(%rax)
+}
+  801d75:	48 83 c4 10          	add    $0x10,%rsp
+  801d79:	5b                   	pop    %rbx
+  801d7a:	41 5c                	pop    %r12
+  801d7c:	5d                   	pop    %rbp
+  801d7d:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d7e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d83:	eb f0                	jmp    801d75 <fstat+0x70>
+
+0000000000801d85 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801d85:	55                   	push   %rbp
+  801d86:	48 89 e5             	mov    %rsp,%rbp
+  801d89:	41 54                	push   %r12
+  801d8b:	53                   	push   %rbx
+  801d8c:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d8f:	be 00 00 00 00       	mov    $0x0,%esi
+  801d94:	48 b8 06 20 80 00 00 	movabs $0x802006,%rax
+  801d9b:	00 00 00 
+  801d9e:	ff d0                	call   *%rax
+  801da0:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801da2:	85 c0                	test   %eax,%eax
+  801da4:	78 25                	js     801dcb <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801da6:	4c 89 e6             	mov    %r12,%rsi
+  801da9:	89 c7                	mov    %eax,%edi
+  801dab:	48 b8 05 1d 80 00 00 	movabs $0x801d05,%rax
+  801db2:	00 00 00 
+  801db5:	ff d0                	call   *%rax
+  801db7:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801dba:	89 df                	mov    %ebx,%edi
+  801dbc:	48 b8 ca 18 80 00 00 	movabs $0x8018ca,%rax
+  801dc3:	00 00 00 
+  801dc6:	ff d0                	call   *%rax
+
+    return res;
+  801dc8:	44 89 e3             	mov    %r12d,%ebx
+}
+  801dcb:	89 d8                	mov    %ebx,%eax
+  801dcd:	5b                   	pop    %rbx
+  801dce:	41 5c                	pop    %r12
+  801dd0:	5d                   	pop    %rbp
+  801dd1:	c3                   	ret
+
+0000000000801dd2 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801dd2:	55                   	push   %rbp
+  801dd3:	48 89 e5             	mov    %rsp,%rbp
+  801dd6:	41 54                	push   %r12
+  801dd8:	53                   	push   %rbx
+  801dd9:	48 83 ec 10          	sub    $0x10,%rsp
+  801ddd:	41 89 fc             	mov    %edi,%r12d
+  801de0:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801de3:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801dea:	00 00 00 
+  801ded:	83 38 00             	cmpl   $0x0,(%rax)
+  801df0:	74 5e                	je     801e50 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801df2:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801df8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801dfd:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801e04:	00 00 00 
+  801e07:	44 89 e6             	mov    %r12d,%esi
+  801e0a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e11:	00 00 00 
+  801e14:	8b 38                	mov    (%rax),%edi
+  801e16:	48 b8 e2 2a 80 00 00 	movabs $0x802ae2,%rax
+  801e1d:	00 00 00 
+  801e20:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801e22:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801e29:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801e2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e2f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801e33:	48 89 de             	mov    %rbx,%rsi
+  801e36:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e3b:	48 b8 4d 2a 80 00 00 	movabs $0x802a4d,%rax
+  801e42:	00 00 00 
+  801e45:	ff d0                	call   *%rax
+}
+  801e47:	48 83 c4 10          	add    $0x10,%rsp
+  801e4b:	5b                   	pop    %rbx
+  801e4c:	41 5c                	pop    %r12
+  801e4e:	5d                   	pop    %rbp
+  801e4f:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e50:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e55:	48 b8 82 2b 80 00 00 	movabs $0x802b82,%rax
+  801e5c:	00 00 00 
+  801e5f:	ff d0                	call   *%rax
+  801e61:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801e68:	00 00 
+  801e6a:	eb 86                	jmp    801df2 <fsipc+0x20>
+
+0000000000801e6c <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e6c:	55                   	push   %rbp
+  801e6d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e70:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801e77:	00 00 00 
+  801e7a:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801e7d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801e7f:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801e82:	be 00 00 00 00       	mov    $0x0,%esi
+  801e87:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e8c:	48 b8 d2 1d 80 00 00 	movabs $0x801dd2,%rax
+  801e93:	00 00 00 
+  801e96:	ff d0                	call   *%rax
+}
+  801e98:	5d                   	pop    %rbp
+  801e99:	c3                   	ret
+
+0000000000801e9a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801e9a:	55                   	push   %rbp
+  801e9b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e9e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801ea1:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801ea8:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801eaa:	be 00 00 00 00       	mov    $0x0,%esi
+  801eaf:	bf 06 00 00 00       	mov    $0x6,%edi
+  801eb4:	48 b8 d2 1d 80 00 00 	movabs $0x801dd2,%rax
+  801ebb:	00 00 00 
+  801ebe:	ff d0                	call   *%rax
+}
+  801ec0:	5d                   	pop    %rbp
+  801ec1:	c3                   	ret
+
+0000000000801ec2 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801ec2:	55                   	push   %rbp
+  801ec3:	48 89 e5             	mov    %rsp,%rbp
+  801ec6:	41 54                	push   %r12
+  801ec8:	53                   	push   %rbx
+  801ec9:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ecc:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801ecf:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801ed6:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801ed8:	be 00 00 00 00       	mov    $0x0,%esi
+  801edd:	bf 05 00 00 00       	mov    $0x5,%edi
+  801ee2:	48 b8 d2 1d 80 00 00 	movabs $0x801dd2,%rax
+  801ee9:	00 00 00 
+  801eec:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801eee:	85 c0                	test   %eax,%eax
+  801ef0:	78 3d                	js     801f2f <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ef2:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801ef9:	00 00 00 
+  801efc:	4c 89 e6             	mov    %r12,%rsi
+  801eff:	48 89 df             	mov    %rbx,%rdi
+  801f02:	48 b8 85 0b 80 00 00 	movabs $0x800b85,%rax
+  801f09:	00 00 00 
+  801f0c:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801f0e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801f15:	00 
+  801f16:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f1c:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801f23:	00 
+  801f24:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801f2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f2f:	5b                   	pop    %rbx
+  801f30:	41 5c                	pop    %r12
+  801f32:	5d                   	pop    %rbp
+  801f33:	c3                   	ret
+
+0000000000801f34 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801f34:	55                   	push   %rbp
+  801f35:	48 89 e5             	mov    %rsp,%rbp
+  801f38:	41 54                	push   %r12
+  801f3a:	53                   	push   %rbx
+  801f3b:	49 89 fc             	mov    %rdi,%r12
+    if (max_size < n)
+  801f3e:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  801f43:	48 39 c2             	cmp    %rax,%rdx
+  801f46:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801f4a:	48 89 c3             	mov    %rax,%rbx
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801f4d:	48 89 c2             	mov    %rax,%rdx
+  801f50:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801f57:	00 00 00 
+  801f5a:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  801f61:	00 00 00 
+  801f64:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f66:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801f6d:	00 00 00 
+  801f70:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  801f75:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n = n;
+  801f77:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    return fsipc(FSREQ_WRITE, NULL);
+  801f7b:	be 00 00 00 00       	mov    $0x0,%esi
+  801f80:	bf 04 00 00 00       	mov    $0x4,%edi
+  801f85:	48 b8 d2 1d 80 00 00 	movabs $0x801dd2,%rax
+  801f8c:	00 00 00 
+  801f8f:	ff d0                	call   *%rax
+  801f91:	48 98                	cltq
+}
+  801f93:	5b                   	pop    %rbx
+  801f94:	41 5c                	pop    %r12
+  801f96:	5d                   	pop    %rbp
+  801f97:	c3                   	ret
+
+0000000000801f98 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801f98:	55                   	push   %rbp
+  801f99:	48 89 e5             	mov    %rsp,%rbp
+  801f9c:	41 54                	push   %r12
+  801f9e:	53                   	push   %rbx
+  801f9f:	49 89 f4             	mov    %rsi,%r12
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fa2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801fa9:	00 00 00 
+  801fac:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801faf:	89 08                	mov    %ecx,(%rax)
+    if (max_size < n)
+  801fb1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801fb6:	48 39 ca             	cmp    %rcx,%rdx
+  801fb9:	48 0f 47 d1          	cmova  %rcx,%rdx
+    fsipcbuf.read.req_n = n;
+  801fbd:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    int bytes_read = fsipc(FSREQ_READ, NULL);
+  801fc1:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc6:	bf 03 00 00 00       	mov    $0x3,%edi
+  801fcb:	48 b8 d2 1d 80 00 00 	movabs $0x801dd2,%rax
+  801fd2:	00 00 00 
+  801fd5:	ff d0                	call   *%rax
+    if (bytes_read < 0)
+  801fd7:	85 c0                	test   %eax,%eax
+  801fd9:	78 27                	js     802002 <devfile_read+0x6a>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, bytes_read);
+  801fdb:	48 63 d8             	movslq %eax,%rbx
+  801fde:	48 89 da             	mov    %rbx,%rdx
+  801fe1:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801fe8:	00 00 00 
+  801feb:	4c 89 e7             	mov    %r12,%rdi
+  801fee:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  801ff5:	00 00 00 
+  801ff8:	ff d0                	call   *%rax
+    return bytes_read;
+  801ffa:	48 89 d8             	mov    %rbx,%rax
+}
+  801ffd:	5b                   	pop    %rbx
+  801ffe:	41 5c                	pop    %r12
+  802000:	5d                   	pop    %rbp
+  802001:	c3                   	ret
+        return bytes_read;
+  802002:	48 98                	cltq
+  802004:	eb f7                	jmp    801ffd <devfile_read+0x65>
+
+0000000000802006 <open>:
+open(const char *path, int mode) {
+  802006:	55                   	push   %rbp
+  802007:	48 89 e5             	mov    %rsp,%rbp
+  80200a:	41 55                	push   %r13
+  80200c:	41 54                	push   %r12
+  80200e:	53                   	push   %rbx
+  80200f:	48 83 ec 18          	sub    $0x18,%rsp
+  802013:	49 89 fc             	mov    %rdi,%r12
+  802016:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802019:	48 b8 47 0b 80 00 00 	movabs $0x800b47,%rax
+  802020:	00 00 00 
+  802023:	ff d0                	call   *%rax
+  802025:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80202b:	0f 87 8a 00 00 00    	ja     8020bb <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802031:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802035:	48 b8 05 17 80 00 00 	movabs $0x801705,%rax
+  80203c:	00 00 00 
+  80203f:	ff d0                	call   *%rax
+  802041:	89 c3                	mov    %eax,%ebx
+  802043:	85 c0                	test   %eax,%eax
+  802045:	78 50                	js     802097 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802047:	4c 89 e6             	mov    %r12,%rsi
+  80204a:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802051:	00 00 00 
+  802054:	48 89 df             	mov    %rbx,%rdi
+  802057:	48 b8 85 0b 80 00 00 	movabs $0x800b85,%rax
+  80205e:	00 00 00 
+  802061:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802063:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80206a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80206e:	bf 01 00 00 00       	mov    $0x1,%edi
+  802073:	48 b8 d2 1d 80 00 00 	movabs $0x801dd2,%rax
+  80207a:	00 00 00 
+  80207d:	ff d0                	call   *%rax
+  80207f:	89 c3                	mov    %eax,%ebx
+  802081:	85 c0                	test   %eax,%eax
+  802083:	78 1f                	js     8020a4 <open+0x9e>
+    return fd2num(fd);
+  802085:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802089:	48 b8 d7 16 80 00 00 	movabs $0x8016d7,%rax
+  802090:	00 00 00 
+  802093:	ff d0                	call   *%rax
+  802095:	89 c3                	mov    %eax,%ebx
+}
+  802097:	89 d8                	mov    %ebx,%eax
+  802099:	48 83 c4 18          	add    $0x18,%rsp
+  80209d:	5b                   	pop    %rbx
+  80209e:	41 5c                	pop    %r12
+  8020a0:	41 5d                	pop    %r13
+  8020a2:	5d                   	pop    %rbp
+  8020a3:	c3                   	ret
+        fd_close(fd, 0);
+  8020a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8020a9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020ad:	48 b8 20 18 80 00 00 	movabs $0x801820,%rax
+  8020b4:	00 00 00 
+  8020b7:	ff d0                	call   *%rax
+        return res;
+  8020b9:	eb dc                	jmp    802097 <open+0x91>
+        return -E_BAD_PATH;
+  8020bb:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8020c0:	eb d5                	jmp    802097 <open+0x91>
+
+00000000008020c2 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8020c2:	55                   	push   %rbp
+  8020c3:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8020c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8020cb:	bf 08 00 00 00       	mov    $0x8,%edi
+  8020d0:	48 b8 d2 1d 80 00 00 	movabs $0x801dd2,%rax
+  8020d7:	00 00 00 
+  8020da:	ff d0                	call   *%rax
+}
+  8020dc:	5d                   	pop    %rbp
+  8020dd:	c3                   	ret
+
+00000000008020de <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8020de:	55                   	push   %rbp
+  8020df:	48 89 e5             	mov    %rsp,%rbp
+  8020e2:	41 54                	push   %r12
+  8020e4:	53                   	push   %rbx
+  8020e5:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8020e8:	48 b8 e9 16 80 00 00 	movabs $0x8016e9,%rax
+  8020ef:	00 00 00 
+  8020f2:	ff d0                	call   *%rax
+  8020f4:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8020f7:	48 be 60 32 80 00 00 	movabs $0x803260,%rsi
+  8020fe:	00 00 00 
+  802101:	48 89 df             	mov    %rbx,%rdi
+  802104:	48 b8 85 0b 80 00 00 	movabs $0x800b85,%rax
+  80210b:	00 00 00 
+  80210e:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802110:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802115:	41 2b 04 24          	sub    (%r12),%eax
+  802119:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80211f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802126:	00 00 00 
+    stat->st_dev = &devpipe;
+  802129:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802130:	00 00 00 
+  802133:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80213a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80213f:	5b                   	pop    %rbx
+  802140:	41 5c                	pop    %r12
+  802142:	5d                   	pop    %rbp
+  802143:	c3                   	ret
+
+0000000000802144 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802144:	55                   	push   %rbp
+  802145:	48 89 e5             	mov    %rsp,%rbp
+  802148:	41 54                	push   %r12
+  80214a:	53                   	push   %rbx
+  80214b:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80214e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802153:	48 89 fe             	mov    %rdi,%rsi
+  802156:	bf 00 00 00 00       	mov    $0x0,%edi
+  80215b:	49 bc 01 12 80 00 00 	movabs $0x801201,%r12
+  802162:	00 00 00 
+  802165:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802168:	48 89 df             	mov    %rbx,%rdi
+  80216b:	48 b8 e9 16 80 00 00 	movabs $0x8016e9,%rax
+  802172:	00 00 00 
+  802175:	ff d0                	call   *%rax
+  802177:	48 89 c6             	mov    %rax,%rsi
+  80217a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80217f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802184:	41 ff d4             	call   *%r12
+}
+  802187:	5b                   	pop    %rbx
+  802188:	41 5c                	pop    %r12
+  80218a:	5d                   	pop    %rbp
+  80218b:	c3                   	ret
+
+000000000080218c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80218c:	55                   	push   %rbp
+  80218d:	48 89 e5             	mov    %rsp,%rbp
+  802190:	41 57                	push   %r15
+  802192:	41 56                	push   %r14
+  802194:	41 55                	push   %r13
+  802196:	41 54                	push   %r12
+  802198:	53                   	push   %rbx
+  802199:	48 83 ec 18          	sub    $0x18,%rsp
+  80219d:	49 89 fc             	mov    %rdi,%r12
+  8021a0:	49 89 f5             	mov    %rsi,%r13
+  8021a3:	49 89 d7             	mov    %rdx,%r15
+  8021a6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8021aa:	48 b8 e9 16 80 00 00 	movabs $0x8016e9,%rax
+  8021b1:	00 00 00 
+  8021b4:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8021b6:	4d 85 ff             	test   %r15,%r15
+  8021b9:	0f 84 af 00 00 00    	je     80226e <devpipe_write+0xe2>
+  8021bf:	48 89 c3             	mov    %rax,%rbx
+  8021c2:	4c 89 f8             	mov    %r15,%rax
+  8021c5:	4d 89 ef             	mov    %r13,%r15
+  8021c8:	4c 01 e8             	add    %r13,%rax
+  8021cb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8021cf:	49 bd 09 11 80 00 00 	movabs $0x801109,%r13
+  8021d6:	00 00 00 
+            sys_yield();
+  8021d9:	49 be a6 10 80 00 00 	movabs $0x8010a6,%r14
+  8021e0:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8021e3:	8b 73 04             	mov    0x4(%rbx),%esi
+  8021e6:	48 63 ce             	movslq %esi,%rcx
+  8021e9:	48 63 03             	movslq (%rbx),%rax
+  8021ec:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8021f2:	48 39 c1             	cmp    %rax,%rcx
+  8021f5:	72 2e                	jb     802225 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8021f7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021fc:	48 89 da             	mov    %rbx,%rdx
+  8021ff:	be 00 10 00 00       	mov    $0x1000,%esi
+  802204:	4c 89 e7             	mov    %r12,%rdi
+  802207:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80220a:	85 c0                	test   %eax,%eax
+  80220c:	74 66                	je     802274 <devpipe_write+0xe8>
+            sys_yield();
+  80220e:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802211:	8b 73 04             	mov    0x4(%rbx),%esi
+  802214:	48 63 ce             	movslq %esi,%rcx
+  802217:	48 63 03             	movslq (%rbx),%rax
+  80221a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802220:	48 39 c1             	cmp    %rax,%rcx
+  802223:	73 d2                	jae    8021f7 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802225:	41 0f b6 3f          	movzbl (%r15),%edi
+  802229:	48 89 ca             	mov    %rcx,%rdx
+  80222c:	48 c1 ea 03          	shr    $0x3,%rdx
+  802230:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802237:	08 10 20 
+  80223a:	48 f7 e2             	mul    %rdx
+  80223d:	48 c1 ea 06          	shr    $0x6,%rdx
+  802241:	48 89 d0             	mov    %rdx,%rax
+  802244:	48 c1 e0 09          	shl    $0x9,%rax
+  802248:	48 29 d0             	sub    %rdx,%rax
+  80224b:	48 c1 e0 03          	shl    $0x3,%rax
+  80224f:	48 29 c1             	sub    %rax,%rcx
+  802252:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802257:	83 c6 01             	add    $0x1,%esi
+  80225a:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80225d:	49 83 c7 01          	add    $0x1,%r15
+  802261:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802265:	49 39 c7             	cmp    %rax,%r15
+  802268:	0f 85 75 ff ff ff    	jne    8021e3 <devpipe_write+0x57>
+    return n;
+  80226e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802272:	eb 05                	jmp    802279 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802274:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802279:	48 83 c4 18          	add    $0x18,%rsp
+  80227d:	5b                   	pop    %rbx
+  80227e:	41 5c                	pop    %r12
+  802280:	41 5d                	pop    %r13
+  802282:	41 5e                	pop    %r14
+  802284:	41 5f                	pop    %r15
+  802286:	5d                   	pop    %rbp
+  802287:	c3                   	ret
+
+0000000000802288 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802288:	55                   	push   %rbp
+  802289:	48 89 e5             	mov    %rsp,%rbp
+  80228c:	41 57                	push   %r15
+  80228e:	41 56                	push   %r14
+  802290:	41 55                	push   %r13
+  802292:	41 54                	push   %r12
+  802294:	53                   	push   %rbx
+  802295:	48 83 ec 18          	sub    $0x18,%rsp
+  802299:	49 89 fc             	mov    %rdi,%r12
+  80229c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8022a0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8022a4:	48 b8 e9 16 80 00 00 	movabs $0x8016e9,%rax
+  8022ab:	00 00 00 
+  8022ae:	ff d0                	call   *%rax
+  8022b0:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8022b3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8022b9:	49 bd 09 11 80 00 00 	movabs $0x801109,%r13
+  8022c0:	00 00 00 
+            sys_yield();
+  8022c3:	49 be a6 10 80 00 00 	movabs $0x8010a6,%r14
+  8022ca:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8022cd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8022d2:	74 7d                	je     802351 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8022d4:	8b 03                	mov    (%rbx),%eax
+  8022d6:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8022d9:	75 26                	jne    802301 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8022db:	4d 85 ff             	test   %r15,%r15
+  8022de:	75 77                	jne    802357 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8022e0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022e5:	48 89 da             	mov    %rbx,%rdx
+  8022e8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8022ed:	4c 89 e7             	mov    %r12,%rdi
+  8022f0:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8022f3:	85 c0                	test   %eax,%eax
+  8022f5:	74 72                	je     802369 <devpipe_read+0xe1>
+            sys_yield();
+  8022f7:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8022fa:	8b 03                	mov    (%rbx),%eax
+  8022fc:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8022ff:	74 df                	je     8022e0 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802301:	48 63 c8             	movslq %eax,%rcx
+  802304:	48 89 ca             	mov    %rcx,%rdx
+  802307:	48 c1 ea 03          	shr    $0x3,%rdx
+  80230b:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802312:	08 10 20 
+  802315:	48 89 d0             	mov    %rdx,%rax
+  802318:	48 f7 e6             	mul    %rsi
+  80231b:	48 c1 ea 06          	shr    $0x6,%rdx
+  80231f:	48 89 d0             	mov    %rdx,%rax
+  802322:	48 c1 e0 09          	shl    $0x9,%rax
+  802326:	48 29 d0             	sub    %rdx,%rax
+  802329:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802330:	00 
+  802331:	48 89 c8             	mov    %rcx,%rax
+  802334:	48 29 d0             	sub    %rdx,%rax
+  802337:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80233c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802340:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802344:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802347:	49 83 c7 01          	add    $0x1,%r15
+  80234b:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80234f:	75 83                	jne    8022d4 <devpipe_read+0x4c>
+    return n;
+  802351:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802355:	eb 03                	jmp    80235a <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802357:	4c 89 f8             	mov    %r15,%rax
+}
+  80235a:	48 83 c4 18          	add    $0x18,%rsp
+  80235e:	5b                   	pop    %rbx
+  80235f:	41 5c                	pop    %r12
+  802361:	41 5d                	pop    %r13
+  802363:	41 5e                	pop    %r14
+  802365:	41 5f                	pop    %r15
+  802367:	5d                   	pop    %rbp
+  802368:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802369:	b8 00 00 00 00       	mov    $0x0,%eax
+  80236e:	eb ea                	jmp    80235a <devpipe_read+0xd2>
+
+0000000000802370 <pipe>:
+pipe(int pfd[2]) {
+  802370:	55                   	push   %rbp
+  802371:	48 89 e5             	mov    %rsp,%rbp
+  802374:	41 55                	push   %r13
+  802376:	41 54                	push   %r12
+  802378:	53                   	push   %rbx
+  802379:	48 83 ec 18          	sub    $0x18,%rsp
+  80237d:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802380:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802384:	48 b8 05 17 80 00 00 	movabs $0x801705,%rax
+  80238b:	00 00 00 
+  80238e:	ff d0                	call   *%rax
+  802390:	89 c3                	mov    %eax,%ebx
+  802392:	85 c0                	test   %eax,%eax
+  802394:	0f 88 a0 01 00 00    	js     80253a <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80239a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80239f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023a4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8023a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023ad:	48 b8 35 11 80 00 00 	movabs $0x801135,%rax
+  8023b4:	00 00 00 
+  8023b7:	ff d0                	call   *%rax
+  8023b9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8023bb:	85 c0                	test   %eax,%eax
+  8023bd:	0f 88 77 01 00 00    	js     80253a <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8023c3:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8023c7:	48 b8 05 17 80 00 00 	movabs $0x801705,%rax
+  8023ce:	00 00 00 
+  8023d1:	ff d0                	call   *%rax
+  8023d3:	89 c3                	mov    %eax,%ebx
+  8023d5:	85 c0                	test   %eax,%eax
+  8023d7:	0f 88 43 01 00 00    	js     802520 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8023dd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8023e2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023e7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8023eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023f0:	48 b8 35 11 80 00 00 	movabs $0x801135,%rax
+  8023f7:	00 00 00 
+  8023fa:	ff d0                	call   *%rax
+  8023fc:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8023fe:	85 c0                	test   %eax,%eax
+  802400:	0f 88 1a 01 00 00    	js     802520 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802406:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80240a:	48 b8 e9 16 80 00 00 	movabs $0x8016e9,%rax
+  802411:	00 00 00 
+  802414:	ff d0                	call   *%rax
+  802416:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802419:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80241e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802423:	48 89 c6             	mov    %rax,%rsi
+  802426:	bf 00 00 00 00       	mov    $0x0,%edi
+  80242b:	48 b8 35 11 80 00 00 	movabs $0x801135,%rax
+  802432:	00 00 00 
+  802435:	ff d0                	call   *%rax
+  802437:	89 c3                	mov    %eax,%ebx
+  802439:	85 c0                	test   %eax,%eax
+  80243b:	0f 88 c5 00 00 00    	js     802506 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802441:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802445:	48 b8 e9 16 80 00 00 	movabs $0x8016e9,%rax
+  80244c:	00 00 00 
+  80244f:	ff d0                	call   *%rax
+  802451:	48 89 c1             	mov    %rax,%rcx
+  802454:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80245a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802460:	ba 00 00 00 00       	mov    $0x0,%edx
+  802465:	4c 89 ee             	mov    %r13,%rsi
+  802468:	bf 00 00 00 00       	mov    $0x0,%edi
+  80246d:	48 b8 9c 11 80 00 00 	movabs $0x80119c,%rax
+  802474:	00 00 00 
+  802477:	ff d0                	call   *%rax
+  802479:	89 c3                	mov    %eax,%ebx
+  80247b:	85 c0                	test   %eax,%eax
+  80247d:	78 6e                	js     8024ed <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80247f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802484:	4c 89 ef             	mov    %r13,%rdi
+  802487:	48 b8 d7 10 80 00 00 	movabs $0x8010d7,%rax
+  80248e:	00 00 00 
+  802491:	ff d0                	call   *%rax
+  802493:	83 f8 02             	cmp    $0x2,%eax
+  802496:	0f 85 ab 00 00 00    	jne    802547 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80249c:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8024a3:	00 00 
+  8024a5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8024a9:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8024ab:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8024af:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8024b6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8024ba:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8024bc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024c0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8024c7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024cb:	48 bb d7 16 80 00 00 	movabs $0x8016d7,%rbx
+  8024d2:	00 00 00 
+  8024d5:	ff d3                	call   *%rbx
+  8024d7:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8024db:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8024df:	ff d3                	call   *%rbx
+  8024e1:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8024e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024eb:	eb 4d                	jmp    80253a <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8024ed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024f2:	4c 89 ee             	mov    %r13,%rsi
+  8024f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024fa:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  802501:	00 00 00 
+  802504:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802506:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80250b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80250f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802514:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  80251b:	00 00 00 
+  80251e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802520:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802525:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802529:	bf 00 00 00 00       	mov    $0x0,%edi
+  80252e:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  802535:	00 00 00 
+  802538:	ff d0                	call   *%rax
+}
+  80253a:	89 d8                	mov    %ebx,%eax
+  80253c:	48 83 c4 18          	add    $0x18,%rsp
+  802540:	5b                   	pop    %rbx
+  802541:	41 5c                	pop    %r12
+  802543:	41 5d                	pop    %r13
+  802545:	5d                   	pop    %rbp
+  802546:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802547:	48 b9 90 32 80 00 00 	movabs $0x803290,%rcx
+  80254e:	00 00 00 
+  802551:	48 ba 67 32 80 00 00 	movabs $0x803267,%rdx
+  802558:	00 00 00 
+  80255b:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802560:	48 bf 7c 32 80 00 00 	movabs $0x80327c,%rdi
+  802567:	00 00 00 
+  80256a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256f:	49 b8 aa 29 80 00 00 	movabs $0x8029aa,%r8
+  802576:	00 00 00 
+  802579:	41 ff d0             	call   *%r8
+
+000000000080257c <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80257c:	55                   	push   %rbp
+  80257d:	48 89 e5             	mov    %rsp,%rbp
+  802580:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802584:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802588:	48 b8 65 17 80 00 00 	movabs $0x801765,%rax
+  80258f:	00 00 00 
+  802592:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802594:	85 c0                	test   %eax,%eax
+  802596:	78 35                	js     8025cd <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802598:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80259c:	48 b8 e9 16 80 00 00 	movabs $0x8016e9,%rax
+  8025a3:	00 00 00 
+  8025a6:	ff d0                	call   *%rax
+  8025a8:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025ab:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025b0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025b5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8025b9:	48 b8 09 11 80 00 00 	movabs $0x801109,%rax
+  8025c0:	00 00 00 
+  8025c3:	ff d0                	call   *%rax
+  8025c5:	85 c0                	test   %eax,%eax
+  8025c7:	0f 94 c0             	sete   %al
+  8025ca:	0f b6 c0             	movzbl %al,%eax
+}
+  8025cd:	c9                   	leave
+  8025ce:	c3                   	ret
+
+00000000008025cf <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8025cf:	48 89 f8             	mov    %rdi,%rax
+  8025d2:	48 c1 e8 27          	shr    $0x27,%rax
+  8025d6:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8025dd:	01 00 00 
+  8025e0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025e4:	f6 c2 01             	test   $0x1,%dl
+  8025e7:	74 6d                	je     802656 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025e9:	48 89 f8             	mov    %rdi,%rax
+  8025ec:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8025f0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8025f7:	01 00 00 
+  8025fa:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025fe:	f6 c2 01             	test   $0x1,%dl
+  802601:	74 62                	je     802665 <get_uvpt_entry+0x96>
+  802603:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80260a:	01 00 00 
+  80260d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802611:	f6 c2 80             	test   $0x80,%dl
+  802614:	75 4f                	jne    802665 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802616:	48 89 f8             	mov    %rdi,%rax
+  802619:	48 c1 e8 15          	shr    $0x15,%rax
+  80261d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802624:	01 00 00 
+  802627:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80262b:	f6 c2 01             	test   $0x1,%dl
+  80262e:	74 44                	je     802674 <get_uvpt_entry+0xa5>
+  802630:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802637:	01 00 00 
+  80263a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80263e:	f6 c2 80             	test   $0x80,%dl
+  802641:	75 31                	jne    802674 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802643:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802647:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80264e:	01 00 00 
+  802651:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802655:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802656:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80265d:	01 00 00 
+  802660:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802664:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802665:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80266c:	01 00 00 
+  80266f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802673:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802674:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80267b:	01 00 00 
+  80267e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802682:	c3                   	ret
+
+0000000000802683 <get_prot>:
+
+int
+get_prot(void *va) {
+  802683:	55                   	push   %rbp
+  802684:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802687:	48 b8 cf 25 80 00 00 	movabs $0x8025cf,%rax
+  80268e:	00 00 00 
+  802691:	ff d0                	call   *%rax
+  802693:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802696:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80269b:	89 c1                	mov    %eax,%ecx
+  80269d:	83 c9 04             	or     $0x4,%ecx
+  8026a0:	f6 c2 01             	test   $0x1,%dl
+  8026a3:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8026a6:	89 c1                	mov    %eax,%ecx
+  8026a8:	83 c9 02             	or     $0x2,%ecx
+  8026ab:	f6 c2 02             	test   $0x2,%dl
+  8026ae:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8026b1:	89 c1                	mov    %eax,%ecx
+  8026b3:	83 c9 01             	or     $0x1,%ecx
+  8026b6:	48 85 d2             	test   %rdx,%rdx
+  8026b9:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8026bc:	89 c1                	mov    %eax,%ecx
+  8026be:	83 c9 40             	or     $0x40,%ecx
+  8026c1:	f6 c6 04             	test   $0x4,%dh
+  8026c4:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8026c7:	5d                   	pop    %rbp
+  8026c8:	c3                   	ret
+
+00000000008026c9 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8026c9:	55                   	push   %rbp
+  8026ca:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8026cd:	48 b8 cf 25 80 00 00 	movabs $0x8025cf,%rax
+  8026d4:	00 00 00 
+  8026d7:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8026d9:	48 c1 e8 06          	shr    $0x6,%rax
+  8026dd:	83 e0 01             	and    $0x1,%eax
+}
+  8026e0:	5d                   	pop    %rbp
+  8026e1:	c3                   	ret
+
+00000000008026e2 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8026e2:	55                   	push   %rbp
+  8026e3:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8026e6:	48 b8 cf 25 80 00 00 	movabs $0x8025cf,%rax
+  8026ed:	00 00 00 
+  8026f0:	ff d0                	call   *%rax
+  8026f2:	83 e0 01             	and    $0x1,%eax
+}
+  8026f5:	5d                   	pop    %rbp
+  8026f6:	c3                   	ret
+
+00000000008026f7 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8026f7:	55                   	push   %rbp
+  8026f8:	48 89 e5             	mov    %rsp,%rbp
+  8026fb:	41 57                	push   %r15
+  8026fd:	41 56                	push   %r14
+  8026ff:	41 55                	push   %r13
+  802701:	41 54                	push   %r12
+  802703:	53                   	push   %rbx
+  802704:	48 83 ec 18          	sub    $0x18,%rsp
+  802708:	49 89 ff             	mov    %rdi,%r15
+  80270b:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  80270f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!is_page_present(p))
+  802714:	49 bc e2 26 80 00 00 	movabs $0x8026e2,%r12
+  80271b:	00 00 00 
+            continue;
+
+        if (!(get_prot(p) & PROT_SHARE))
+  80271e:	49 be 83 26 80 00 00 	movabs $0x802683,%r14
+  802725:	00 00 00 
+    for (void * p = 0; p < (void *)MAX_USER_ADDRESS; p += PAGE_SIZE) {
+  802728:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+  80272f:	00 00 00 
+  802732:	eb 0c                	jmp    802740 <foreach_shared_region+0x49>
+  802734:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80273b:	4c 39 eb             	cmp    %r13,%rbx
+  80273e:	74 38                	je     802778 <foreach_shared_region+0x81>
+        if (!is_page_present(p))
+  802740:	48 89 df             	mov    %rbx,%rdi
+  802743:	41 ff d4             	call   *%r12
+  802746:	84 c0                	test   %al,%al
+  802748:	74 ea                	je     802734 <foreach_shared_region+0x3d>
+        if (!(get_prot(p) & PROT_SHARE))
+  80274a:	48 89 df             	mov    %rbx,%rdi
+  80274d:	41 ff d6             	call   *%r14
+  802750:	a8 40                	test   $0x40,%al
+  802752:	74 e0                	je     802734 <foreach_shared_region+0x3d>
+            continue;
+
+        int err = fun(p, p + PAGE_SIZE, arg);
+  802754:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80275b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80275f:	48 89 df             	mov    %rbx,%rdi
+  802762:	41 ff d7             	call   *%r15
+        if (err)
+  802765:	85 c0                	test   %eax,%eax
+  802767:	74 cb                	je     802734 <foreach_shared_region+0x3d>
+            return err;
+    }
+    return 0;
+}
+  802769:	48 83 c4 18          	add    $0x18,%rsp
+  80276d:	5b                   	pop    %rbx
+  80276e:	41 5c                	pop    %r12
+  802770:	41 5d                	pop    %r13
+  802772:	41 5e                	pop    %r14
+  802774:	41 5f                	pop    %r15
+  802776:	5d                   	pop    %rbp
+  802777:	c3                   	ret
+    return 0;
+  802778:	b8 00 00 00 00       	mov    $0x0,%eax
+  80277d:	eb ea                	jmp    802769 <foreach_shared_region+0x72>
+
+000000000080277f <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80277f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802784:	c3                   	ret
+
+0000000000802785 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802785:	55                   	push   %rbp
+  802786:	48 89 e5             	mov    %rsp,%rbp
+  802789:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80278c:	48 be b4 32 80 00 00 	movabs $0x8032b4,%rsi
+  802793:	00 00 00 
+  802796:	48 b8 85 0b 80 00 00 	movabs $0x800b85,%rax
+  80279d:	00 00 00 
+  8027a0:	ff d0                	call   *%rax
+    return 0;
+}
+  8027a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a7:	5d                   	pop    %rbp
+  8027a8:	c3                   	ret
+
+00000000008027a9 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8027a9:	55                   	push   %rbp
+  8027aa:	48 89 e5             	mov    %rsp,%rbp
+  8027ad:	41 57                	push   %r15
+  8027af:	41 56                	push   %r14
+  8027b1:	41 55                	push   %r13
+  8027b3:	41 54                	push   %r12
+  8027b5:	53                   	push   %rbx
+  8027b6:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8027bd:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8027c4:	48 85 d2             	test   %rdx,%rdx
+  8027c7:	74 7a                	je     802843 <devcons_write+0x9a>
+  8027c9:	49 89 d6             	mov    %rdx,%r14
+  8027cc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8027d2:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8027d7:	49 bf 7f 0d 80 00 00 	movabs $0x800d7f,%r15
+  8027de:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8027e1:	4c 89 f3             	mov    %r14,%rbx
+  8027e4:	48 29 f3             	sub    %rsi,%rbx
+  8027e7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8027ec:	48 39 c3             	cmp    %rax,%rbx
+  8027ef:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8027f3:	4c 63 eb             	movslq %ebx,%r13
+  8027f6:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8027fd:	48 01 c6             	add    %rax,%rsi
+  802800:	4c 89 ea             	mov    %r13,%rdx
+  802803:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80280a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80280d:	4c 89 ee             	mov    %r13,%rsi
+  802810:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802817:	48 b8 ac 0f 80 00 00 	movabs $0x800fac,%rax
+  80281e:	00 00 00 
+  802821:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802823:	41 01 dc             	add    %ebx,%r12d
+  802826:	49 63 f4             	movslq %r12d,%rsi
+  802829:	4c 39 f6             	cmp    %r14,%rsi
+  80282c:	72 b3                	jb     8027e1 <devcons_write+0x38>
+    return res;
+  80282e:	49 63 c4             	movslq %r12d,%rax
+}
+  802831:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802838:	5b                   	pop    %rbx
+  802839:	41 5c                	pop    %r12
+  80283b:	41 5d                	pop    %r13
+  80283d:	41 5e                	pop    %r14
+  80283f:	41 5f                	pop    %r15
+  802841:	5d                   	pop    %rbp
+  802842:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802843:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802849:	eb e3                	jmp    80282e <devcons_write+0x85>
+
+000000000080284b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80284b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80284e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802853:	48 85 c0             	test   %rax,%rax
+  802856:	74 55                	je     8028ad <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802858:	55                   	push   %rbp
+  802859:	48 89 e5             	mov    %rsp,%rbp
+  80285c:	41 55                	push   %r13
+  80285e:	41 54                	push   %r12
+  802860:	53                   	push   %rbx
+  802861:	48 83 ec 08          	sub    $0x8,%rsp
+  802865:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802868:	48 bb d9 0f 80 00 00 	movabs $0x800fd9,%rbx
+  80286f:	00 00 00 
+  802872:	49 bc a6 10 80 00 00 	movabs $0x8010a6,%r12
+  802879:	00 00 00 
+  80287c:	eb 03                	jmp    802881 <devcons_read+0x36>
+  80287e:	41 ff d4             	call   *%r12
+  802881:	ff d3                	call   *%rbx
+  802883:	85 c0                	test   %eax,%eax
+  802885:	74 f7                	je     80287e <devcons_read+0x33>
+    if (c < 0) return c;
+  802887:	48 63 d0             	movslq %eax,%rdx
+  80288a:	78 13                	js     80289f <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80288c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802891:	83 f8 04             	cmp    $0x4,%eax
+  802894:	74 09                	je     80289f <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802896:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80289a:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80289f:	48 89 d0             	mov    %rdx,%rax
+  8028a2:	48 83 c4 08          	add    $0x8,%rsp
+  8028a6:	5b                   	pop    %rbx
+  8028a7:	41 5c                	pop    %r12
+  8028a9:	41 5d                	pop    %r13
+  8028ab:	5d                   	pop    %rbp
+  8028ac:	c3                   	ret
+  8028ad:	48 89 d0             	mov    %rdx,%rax
+  8028b0:	c3                   	ret
+
+00000000008028b1 <cputchar>:
+cputchar(int ch) {
+  8028b1:	55                   	push   %rbp
+  8028b2:	48 89 e5             	mov    %rsp,%rbp
+  8028b5:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8028b9:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8028bd:	be 01 00 00 00       	mov    $0x1,%esi
+  8028c2:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8028c6:	48 b8 ac 0f 80 00 00 	movabs $0x800fac,%rax
+  8028cd:	00 00 00 
+  8028d0:	ff d0                	call   *%rax
+}
+  8028d2:	c9                   	leave
+  8028d3:	c3                   	ret
+
+00000000008028d4 <getchar>:
+getchar(void) {
+  8028d4:	55                   	push   %rbp
+  8028d5:	48 89 e5             	mov    %rsp,%rbp
+  8028d8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8028dc:	ba 01 00 00 00       	mov    $0x1,%edx
+  8028e1:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8028e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028ea:	48 b8 48 1a 80 00 00 	movabs $0x801a48,%rax
+  8028f1:	00 00 00 
+  8028f4:	ff d0                	call   *%rax
+  8028f6:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8028f8:	85 c0                	test   %eax,%eax
+  8028fa:	78 06                	js     802902 <getchar+0x2e>
+  8028fc:	74 08                	je     802906 <getchar+0x32>
+  8028fe:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802902:	89 d0                	mov    %edx,%eax
+  802904:	c9                   	leave
+  802905:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802906:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80290b:	eb f5                	jmp    802902 <getchar+0x2e>
+
+000000000080290d <iscons>:
+iscons(int fdnum) {
+  80290d:	55                   	push   %rbp
+  80290e:	48 89 e5             	mov    %rsp,%rbp
+  802911:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802915:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802919:	48 b8 65 17 80 00 00 	movabs $0x801765,%rax
+  802920:	00 00 00 
+  802923:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802925:	85 c0                	test   %eax,%eax
+  802927:	78 18                	js     802941 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802929:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80292d:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802934:	00 00 00 
+  802937:	8b 00                	mov    (%rax),%eax
+  802939:	39 02                	cmp    %eax,(%rdx)
+  80293b:	0f 94 c0             	sete   %al
+  80293e:	0f b6 c0             	movzbl %al,%eax
+}
+  802941:	c9                   	leave
+  802942:	c3                   	ret
+
+0000000000802943 <opencons>:
+opencons(void) {
+  802943:	55                   	push   %rbp
+  802944:	48 89 e5             	mov    %rsp,%rbp
+  802947:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80294b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80294f:	48 b8 05 17 80 00 00 	movabs $0x801705,%rax
+  802956:	00 00 00 
+  802959:	ff d0                	call   *%rax
+  80295b:	85 c0                	test   %eax,%eax
+  80295d:	78 49                	js     8029a8 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80295f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802964:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802969:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80296d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802972:	48 b8 35 11 80 00 00 	movabs $0x801135,%rax
+  802979:	00 00 00 
+  80297c:	ff d0                	call   *%rax
+  80297e:	85 c0                	test   %eax,%eax
+  802980:	78 26                	js     8029a8 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802982:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802986:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  80298d:	00 00 
+  80298f:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802991:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802995:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80299c:	48 b8 d7 16 80 00 00 	movabs $0x8016d7,%rax
+  8029a3:	00 00 00 
+  8029a6:	ff d0                	call   *%rax
+}
+  8029a8:	c9                   	leave
+  8029a9:	c3                   	ret
+
+00000000008029aa <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8029aa:	55                   	push   %rbp
+  8029ab:	48 89 e5             	mov    %rsp,%rbp
+  8029ae:	41 56                	push   %r14
+  8029b0:	41 55                	push   %r13
+  8029b2:	41 54                	push   %r12
+  8029b4:	53                   	push   %rbx
+  8029b5:	48 83 ec 50          	sub    $0x50,%rsp
+  8029b9:	49 89 fc             	mov    %rdi,%r12
+  8029bc:	41 89 f5             	mov    %esi,%r13d
+  8029bf:	48 89 d3             	mov    %rdx,%rbx
+  8029c2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8029c6:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8029ca:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8029ce:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8029d5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8029d9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8029dd:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8029e1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8029e5:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8029ec:	00 00 00 
+  8029ef:	4c 8b 30             	mov    (%rax),%r14
+  8029f2:	48 b8 75 10 80 00 00 	movabs $0x801075,%rax
+  8029f9:	00 00 00 
+  8029fc:	ff d0                	call   *%rax
+  8029fe:	89 c6                	mov    %eax,%esi
+  802a00:	45 89 e8             	mov    %r13d,%r8d
+  802a03:	4c 89 e1             	mov    %r12,%rcx
+  802a06:	4c 89 f2             	mov    %r14,%rdx
+  802a09:	48 bf c0 32 80 00 00 	movabs $0x8032c0,%rdi
+  802a10:	00 00 00 
+  802a13:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a18:	49 bc 60 02 80 00 00 	movabs $0x800260,%r12
+  802a1f:	00 00 00 
+  802a22:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802a25:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802a29:	48 89 df             	mov    %rbx,%rdi
+  802a2c:	48 b8 fc 01 80 00 00 	movabs $0x8001fc,%rax
+  802a33:	00 00 00 
+  802a36:	ff d0                	call   *%rax
+    cprintf("\n");
+  802a38:	48 bf 1b 32 80 00 00 	movabs $0x80321b,%rdi
+  802a3f:	00 00 00 
+  802a42:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a47:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802a4a:	cc                   	int3
+  802a4b:	eb fd                	jmp    802a4a <_panic+0xa0>
+
+0000000000802a4d <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802a4d:	55                   	push   %rbp
+  802a4e:	48 89 e5             	mov    %rsp,%rbp
+  802a51:	41 54                	push   %r12
+  802a53:	53                   	push   %rbx
+  802a54:	48 89 fb             	mov    %rdi,%rbx
+  802a57:	48 89 f7             	mov    %rsi,%rdi
+  802a5a:	49 89 cc             	mov    %rcx,%r12
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802a5d:	48 85 f6             	test   %rsi,%rsi
+  802a60:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a67:	00 00 00 
+  802a6a:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int res = sys_ipc_recv(pg, PAGE_SIZE);
+  802a6e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a73:	48 b8 9f 14 80 00 00 	movabs $0x80149f,%rax
+  802a7a:	00 00 00 
+  802a7d:	ff d0                	call   *%rax
+    if (res < 0) {
+  802a7f:	85 c0                	test   %eax,%eax
+  802a81:	78 45                	js     802ac8 <ipc_recv+0x7b>
+        if (perm_store)
+            *perm_store = 0;
+        return res;
+    }
+
+    if (from_env_store)
+  802a83:	48 85 db             	test   %rbx,%rbx
+  802a86:	74 12                	je     802a9a <ipc_recv+0x4d>
+        *from_env_store = thisenv->env_ipc_from;
+  802a88:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802a8f:	00 00 00 
+  802a92:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802a98:	89 03                	mov    %eax,(%rbx)
+    if (perm_store)
+  802a9a:	4d 85 e4             	test   %r12,%r12
+  802a9d:	74 14                	je     802ab3 <ipc_recv+0x66>
+        *perm_store = thisenv->env_ipc_perm;
+  802a9f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802aa6:	00 00 00 
+  802aa9:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802aaf:	41 89 04 24          	mov    %eax,(%r12)
+    return thisenv->env_ipc_value;
+  802ab3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802aba:	00 00 00 
+  802abd:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802ac3:	5b                   	pop    %rbx
+  802ac4:	41 5c                	pop    %r12
+  802ac6:	5d                   	pop    %rbp
+  802ac7:	c3                   	ret
+        if (from_env_store)
+  802ac8:	48 85 db             	test   %rbx,%rbx
+  802acb:	74 06                	je     802ad3 <ipc_recv+0x86>
+            *from_env_store = 0;
+  802acd:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        if (perm_store)
+  802ad3:	4d 85 e4             	test   %r12,%r12
+  802ad6:	74 eb                	je     802ac3 <ipc_recv+0x76>
+            *perm_store = 0;
+  802ad8:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802adf:	00 
+  802ae0:	eb e1                	jmp    802ac3 <ipc_recv+0x76>
+
+0000000000802ae2 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802ae2:	55                   	push   %rbp
+  802ae3:	48 89 e5             	mov    %rsp,%rbp
+  802ae6:	41 57                	push   %r15
+  802ae8:	41 56                	push   %r14
+  802aea:	41 55                	push   %r13
+  802aec:	41 54                	push   %r12
+  802aee:	53                   	push   %rbx
+  802aef:	48 83 ec 18          	sub    $0x18,%rsp
+  802af3:	41 89 fd             	mov    %edi,%r13d
+  802af6:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802af9:	48 89 d3             	mov    %rdx,%rbx
+  802afc:	49 89 cc             	mov    %rcx,%r12
+  802aff:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    pg = pg ? pg : (void *)MAX_USER_ADDRESS;
+  802b03:	48 85 d2             	test   %rdx,%rdx
+  802b06:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802b0d:	00 00 00 
+  802b10:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    while (true) {
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802b14:	49 be 73 14 80 00 00 	movabs $0x801473,%r14
+  802b1b:	00 00 00 
+            break;
+
+        if (res != -E_IPC_NOT_RECV)
+            panic("ipc_send: failed to send");
+
+        sys_yield();
+  802b1e:	49 bf a6 10 80 00 00 	movabs $0x8010a6,%r15
+  802b25:	00 00 00 
+        int res = sys_ipc_try_send(to_env, val, pg, size, perm);
+  802b28:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802b2b:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802b2f:	4c 89 e1             	mov    %r12,%rcx
+  802b32:	48 89 da             	mov    %rbx,%rdx
+  802b35:	44 89 ef             	mov    %r13d,%edi
+  802b38:	41 ff d6             	call   *%r14
+        if (res == 0)
+  802b3b:	85 c0                	test   %eax,%eax
+  802b3d:	74 34                	je     802b73 <ipc_send+0x91>
+        if (res != -E_IPC_NOT_RECV)
+  802b3f:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802b42:	75 05                	jne    802b49 <ipc_send+0x67>
+        sys_yield();
+  802b44:	41 ff d7             	call   *%r15
+    while (true) {
+  802b47:	eb df                	jmp    802b28 <ipc_send+0x46>
+            panic("ipc_send: failed to send");
+  802b49:	48 ba e3 32 80 00 00 	movabs $0x8032e3,%rdx
+  802b50:	00 00 00 
+  802b53:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802b58:	48 bf fc 32 80 00 00 	movabs $0x8032fc,%rdi
+  802b5f:	00 00 00 
+  802b62:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b67:	48 b9 aa 29 80 00 00 	movabs $0x8029aa,%rcx
+  802b6e:	00 00 00 
+  802b71:	ff d1                	call   *%rcx
+    }
+}
+  802b73:	48 83 c4 18          	add    $0x18,%rsp
+  802b77:	5b                   	pop    %rbx
+  802b78:	41 5c                	pop    %r12
+  802b7a:	41 5d                	pop    %r13
+  802b7c:	41 5e                	pop    %r14
+  802b7e:	41 5f                	pop    %r15
+  802b80:	5d                   	pop    %rbp
+  802b81:	c3                   	ret
+
+0000000000802b82 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802b82:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802b87:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802b8e:	00 00 00 
+  802b91:	48 69 d0 b0 06 00 00 	imul   $0x6b0,%rax,%rdx
+  802b98:	48 01 ca             	add    %rcx,%rdx
+  802b9b:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802ba1:	39 fa                	cmp    %edi,%edx
+  802ba3:	74 12                	je     802bb7 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802ba5:	48 83 c0 01          	add    $0x1,%rax
+  802ba9:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  802baf:	75 e0                	jne    802b91 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802bb1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bb6:	c3                   	ret
+            return envs[i].env_id;
+  802bb7:	48 69 c0 b0 06 00 00 	imul   $0x6b0,%rax,%rax
+  802bbe:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802bc5:	00 00 00 
+  802bc8:	48 01 d0             	add    %rdx,%rax
+  802bcb:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802bd1:	c3                   	ret
+  802bd2:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802bd8 <__rodata_start>:
+  802bd8:	48                   	rex.W
+  802bd9:	65 6c                	gs insb (%dx),%es:(%rdi)
+  802bdb:	6c                   	insb   (%dx),%es:(%rdi)
+  802bdc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802bdd:	2c 20                	sub    $0x20,%al
+  802bdf:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  802be3:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802be6:	76 69                	jbe    802c51 <__rodata_start+0x79>
+  802be8:	72 6f                	jb     802c59 <__rodata_start+0x81>
+  802bea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802beb:	6d                   	insl   (%dx),%es:(%rdi)
+  802bec:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802bee:	74 20                	je     802c10 <__rodata_start+0x38>
+  802bf0:	25 30 38 78 2e       	and    $0x2e783830,%eax
+  802bf5:	0a 00                	or     (%rax),%al
+  802bf7:	00 42 61             	add    %al,0x61(%rdx)
+  802bfa:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802bfd:	69 6e 20 65 6e 76 69 	imul   $0x69766e65,0x20(%rsi),%ebp
+  802c04:	72 6f                	jb     802c75 <__rodata_start+0x9d>
+  802c06:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c07:	6d                   	insl   (%dx),%es:(%rdi)
+  802c08:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802c0a:	74 20                	je     802c2c <__rodata_start+0x54>
+  802c0c:	25 30 38 78 2c       	and    $0x2c783830,%eax
+  802c11:	20 69 74             	and    %ch,0x74(%rcx)
+  802c14:	65 72 61             	gs jb  802c78 <__rodata_start+0xa0>
+  802c17:	74 69                	je     802c82 <__rodata_start+0xaa>
+  802c19:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c1a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c1b:	20 25 64 2e 0a 00    	and    %ah,0xa2e64(%rip)        # 8a5a85 <__bss_end+0x9da85>
+  802c21:	00 00                	add    %al,(%rax)
+  802c23:	00 00                	add    %al,(%rax)
+  802c25:	00 00                	add    %al,(%rax)
+  802c27:	00 41 6c             	add    %al,0x6c(%rcx)
+  802c2a:	6c                   	insb   (%dx),%es:(%rdi)
+  802c2b:	20 64 6f 6e          	and    %ah,0x6e(%rdi,%rbp,2)
+  802c2f:	65 20 69 6e          	and    %ch,%gs:0x6e(%rcx)
+  802c33:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802c36:	76 69                	jbe    802ca1 <__rodata_start+0xc9>
+  802c38:	72 6f                	jb     802ca9 <__rodata_start+0xd1>
+  802c3a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c3b:	6d                   	insl   (%dx),%es:(%rdi)
+  802c3c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802c3e:	74 20                	je     802c60 <__rodata_start+0x88>
+  802c40:	25 30 38 78 2e       	and    $0x2e783830,%eax
+  802c45:	0a 00                	or     (%rax),%al
+  802c47:	3c 75                	cmp    $0x75,%al
+  802c49:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c4a:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802c4e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c4f:	3e 00 30             	ds add %dh,(%rax)
+  802c52:	31 32                	xor    %esi,(%rdx)
+  802c54:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802c5b:	41                   	rex.B
+  802c5c:	42                   	rex.X
+  802c5d:	43                   	rex.XB
+  802c5e:	44                   	rex.R
+  802c5f:	45                   	rex.RB
+  802c60:	46 00 30             	rex.RX add %r14b,(%rax)
+  802c63:	31 32                	xor    %esi,(%rdx)
+  802c65:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802c6c:	61                   	(bad)
+  802c6d:	62 63 64 65 66       	(bad)
+  802c72:	00 28                	add    %ch,(%rax)
+  802c74:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c75:	75 6c                	jne    802ce3 <__rodata_start+0x10b>
+  802c77:	6c                   	insb   (%dx),%es:(%rdi)
+  802c78:	29 00                	sub    %eax,(%rax)
+  802c7a:	65 72 72             	gs jb  802cef <__rodata_start+0x117>
+  802c7d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c7e:	72 20                	jb     802ca0 <__rodata_start+0xc8>
+  802c80:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802c85:	73 70                	jae    802cf7 <__rodata_start+0x11f>
+  802c87:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802c8b:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802c92:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802c93:	72 00                	jb     802c95 <__rodata_start+0xbd>
+  802c95:	62 61 64 20 65       	(bad)
+  802c9a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c9b:	76 69                	jbe    802d06 <__rodata_start+0x12e>
+  802c9d:	72 6f                	jb     802d0e <__rodata_start+0x136>
+  802c9f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ca0:	6d                   	insl   (%dx),%es:(%rdi)
+  802ca1:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802ca3:	74 00                	je     802ca5 <__rodata_start+0xcd>
+  802ca5:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802cac:	20 70 61             	and    %dh,0x61(%rax)
+  802caf:	72 61                	jb     802d12 <__rodata_start+0x13a>
+  802cb1:	6d                   	insl   (%dx),%es:(%rdi)
+  802cb2:	65 74 65             	gs je  802d1a <__rodata_start+0x142>
+  802cb5:	72 00                	jb     802cb7 <__rodata_start+0xdf>
+  802cb7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cb8:	75 74                	jne    802d2e <__rodata_start+0x156>
+  802cba:	20 6f 66             	and    %ch,0x66(%rdi)
+  802cbd:	20 6d 65             	and    %ch,0x65(%rbp)
+  802cc0:	6d                   	insl   (%dx),%es:(%rdi)
+  802cc1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cc2:	72 79                	jb     802d3d <__rodata_start+0x165>
+  802cc4:	00 6f 75             	add    %ch,0x75(%rdi)
+  802cc7:	74 20                	je     802ce9 <__rodata_start+0x111>
+  802cc9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cca:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802cce:	76 69                	jbe    802d39 <__rodata_start+0x161>
+  802cd0:	72 6f                	jb     802d41 <__rodata_start+0x169>
+  802cd2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cd3:	6d                   	insl   (%dx),%es:(%rdi)
+  802cd4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802cd6:	74 73                	je     802d4b <__rodata_start+0x173>
+  802cd8:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802cdb:	72 72                	jb     802d4f <__rodata_start+0x177>
+  802cdd:	75 70                	jne    802d4f <__rodata_start+0x177>
+  802cdf:	74 65                	je     802d46 <__rodata_start+0x16e>
+  802ce1:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802ce6:	75 67                	jne    802d4f <__rodata_start+0x177>
+  802ce8:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802ceb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802ced:	00 73 65             	add    %dh,0x65(%rbx)
+  802cf0:	67 6d                	insl   (%dx),%es:(%edi)
+  802cf2:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802cf4:	74 61                	je     802d57 <__rodata_start+0x17f>
+  802cf6:	74 69                	je     802d61 <__rodata_start+0x189>
+  802cf8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cf9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cfa:	20 66 61             	and    %ah,0x61(%rsi)
+  802cfd:	75 6c                	jne    802d6b <__rodata_start+0x193>
+  802cff:	74 00                	je     802d01 <__rodata_start+0x129>
+  802d01:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802d08:	20 45 4c             	and    %al,0x4c(%rbp)
+  802d0b:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802d0f:	61                   	(bad)
+  802d10:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802d15:	20 73 75             	and    %dh,0x75(%rbx)
+  802d18:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802d1b:	73 79                	jae    802d96 <__rodata_start+0x1be>
+  802d1d:	73 74                	jae    802d93 <__rodata_start+0x1bb>
+  802d1f:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802d21:	20 63 61             	and    %ah,0x61(%rbx)
+  802d24:	6c                   	insb   (%dx),%es:(%rdi)
+  802d25:	6c                   	insb   (%dx),%es:(%rdi)
+  802d26:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802d29:	74 72                	je     802d9d <__rodata_start+0x1c5>
+  802d2b:	79 20                	jns    802d4d <__rodata_start+0x175>
+  802d2d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d2e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d2f:	74 20                	je     802d51 <__rodata_start+0x179>
+  802d31:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802d33:	75 6e                	jne    802da3 <__rodata_start+0x1cb>
+  802d35:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802d39:	76 20                	jbe    802d5b <__rodata_start+0x183>
+  802d3b:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802d42:	72 65                	jb     802da9 <__rodata_start+0x1d1>
+  802d44:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802d47:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d48:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802d4c:	65 78 70             	gs js  802dbf <__rodata_start+0x1e7>
+  802d4f:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802d54:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802d57:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802d5b:	20 66 69             	and    %ah,0x69(%rsi)
+  802d5e:	6c                   	insb   (%dx),%es:(%rdi)
+  802d5f:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802d63:	20 66 72             	and    %ah,0x72(%rsi)
+  802d66:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802d6b:	61                   	(bad)
+  802d6c:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802d6f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d70:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d71:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802d75:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802d78:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d79:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d7a:	20 6d 61             	and    %ch,0x61(%rbp)
+  802d7d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d7e:	79 20                	jns    802da0 <__rodata_start+0x1c8>
+  802d80:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802d87:	72 65                	jb     802dee <__rodata_start+0x216>
+  802d89:	20 6f 70             	and    %ch,0x70(%rdi)
+  802d8c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d8e:	00 66 69             	add    %ah,0x69(%rsi)
+  802d91:	6c                   	insb   (%dx),%es:(%rdi)
+  802d92:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802d96:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802d99:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d9a:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802d9d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d9e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d9f:	74 20                	je     802dc1 <__rodata_start+0x1e9>
+  802da1:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802da3:	75 6e                	jne    802e13 <__rodata_start+0x23b>
+  802da5:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802da9:	76 61                	jbe    802e0c <__rodata_start+0x234>
+  802dab:	6c                   	insb   (%dx),%es:(%rdi)
+  802dac:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802db3:	00 
+  802db4:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802dbb:	72 65                	jb     802e22 <__rodata_start+0x24a>
+  802dbd:	61                   	(bad)
+  802dbe:	64 79 20             	fs jns 802de1 <__rodata_start+0x209>
+  802dc1:	65 78 69             	gs js  802e2d <__rodata_start+0x255>
+  802dc4:	73 74                	jae    802e3a <__rodata_start+0x262>
+  802dc6:	73 00                	jae    802dc8 <__rodata_start+0x1f0>
+  802dc8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dc9:	70 65                	jo     802e30 <__rodata_start+0x258>
+  802dcb:	72 61                	jb     802e2e <__rodata_start+0x256>
+  802dcd:	74 69                	je     802e38 <__rodata_start+0x260>
+  802dcf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dd0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dd1:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802dd4:	74 20                	je     802df6 <__rodata_start+0x21e>
+  802dd6:	73 75                	jae    802e4d <__rodata_start+0x275>
+  802dd8:	70 70                	jo     802e4a <__rodata_start+0x272>
+  802dda:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ddb:	72 74                	jb     802e51 <__rodata_start+0x279>
+  802ddd:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802de2:	65 72 61             	gs jb  802e46 <__rodata_start+0x26e>
+  802de5:	74 69                	je     802e50 <__rodata_start+0x278>
+  802de7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802de8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802de9:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802dec:	74 20                	je     802e0e <__rodata_start+0x236>
+  802dee:	70 65                	jo     802e55 <__rodata_start+0x27d>
+  802df0:	72 6d                	jb     802e5f <__rodata_start+0x287>
+  802df2:	69 74 74 65 64 00 0f 	imul   $0x1f0f0064,0x65(%rsp,%rsi,2),%esi
+  802df9:	1f 
+  802dfa:	84 00                	test   %al,(%rax)
+  802dfc:	00 00                	add    %al,(%rax)
+  802dfe:	00 00                	add    %al,(%rax)
+  802e00:	4d 04 80             	rex.WRB add $0x80,%al
+  802e03:	00 00                	add    %al,(%rax)
+  802e05:	00 00                	add    %al,(%rax)
+  802e07:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802e0d:	00 00                	add    %al,(%rax)
+  802e0f:	00 7e 0a             	add    %bh,0xa(%rsi)
+  802e12:	80 00 00             	addb   $0x0,(%rax)
+  802e15:	00 00                	add    %al,(%rax)
+  802e17:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802e1d:	00 00                	add    %al,(%rax)
+  802e1f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802e25:	00 00                	add    %al,(%rax)
+  802e27:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802e2d:	00 00                	add    %al,(%rax)
+  802e2f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802e35:	00 00                	add    %al,(%rax)
+  802e37:	00 6c 04 80          	add    %ch,-0x80(%rsp,%rax,1)
+  802e3b:	00 00                	add    %al,(%rax)
+  802e3d:	00 00                	add    %al,(%rax)
+  802e3f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802e45:	00 00                	add    %al,(%rax)
+  802e47:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802e4d:	00 00                	add    %al,(%rax)
+  802e4f:	00 60 04             	add    %ah,0x4(%rax)
+  802e52:	80 00 00             	addb   $0x0,(%rax)
+  802e55:	00 00                	add    %al,(%rax)
+  802e57:	00 da                	add    %bl,%dl
+  802e59:	04 80                	add    $0x80,%al
+  802e5b:	00 00                	add    %al,(%rax)
+  802e5d:	00 00                	add    %al,(%rax)
+  802e5f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802e65:	00 00                	add    %al,(%rax)
+  802e67:	00 60 04             	add    %ah,0x4(%rax)
+  802e6a:	80 00 00             	addb   $0x0,(%rax)
+  802e6d:	00 00                	add    %al,(%rax)
+  802e6f:	00 a6 04 80 00 00    	add    %ah,0x8004(%rsi)
+  802e75:	00 00                	add    %al,(%rax)
+  802e77:	00 a6 04 80 00 00    	add    %ah,0x8004(%rsi)
+  802e7d:	00 00                	add    %al,(%rax)
+  802e7f:	00 a6 04 80 00 00    	add    %ah,0x8004(%rsi)
+  802e85:	00 00                	add    %al,(%rax)
+  802e87:	00 a6 04 80 00 00    	add    %ah,0x8004(%rsi)
+  802e8d:	00 00                	add    %al,(%rax)
+  802e8f:	00 a6 04 80 00 00    	add    %ah,0x8004(%rsi)
+  802e95:	00 00                	add    %al,(%rax)
+  802e97:	00 a6 04 80 00 00    	add    %ah,0x8004(%rsi)
+  802e9d:	00 00                	add    %al,(%rax)
+  802e9f:	00 a6 04 80 00 00    	add    %ah,0x8004(%rsi)
+  802ea5:	00 00                	add    %al,(%rax)
+  802ea7:	00 a6 04 80 00 00    	add    %ah,0x8004(%rsi)
+  802ead:	00 00                	add    %al,(%rax)
+  802eaf:	00 a6 04 80 00 00    	add    %ah,0x8004(%rsi)
+  802eb5:	00 00                	add    %al,(%rax)
+  802eb7:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802ebd:	00 00                	add    %al,(%rax)
+  802ebf:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802ec5:	00 00                	add    %al,(%rax)
+  802ec7:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802ecd:	00 00                	add    %al,(%rax)
+  802ecf:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802ed5:	00 00                	add    %al,(%rax)
+  802ed7:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802edd:	00 00                	add    %al,(%rax)
+  802edf:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802ee5:	00 00                	add    %al,(%rax)
+  802ee7:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802eed:	00 00                	add    %al,(%rax)
+  802eef:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802ef5:	00 00                	add    %al,(%rax)
+  802ef7:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802efd:	00 00                	add    %al,(%rax)
+  802eff:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f05:	00 00                	add    %al,(%rax)
+  802f07:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f0d:	00 00                	add    %al,(%rax)
+  802f0f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f15:	00 00                	add    %al,(%rax)
+  802f17:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f1d:	00 00                	add    %al,(%rax)
+  802f1f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f25:	00 00                	add    %al,(%rax)
+  802f27:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f2d:	00 00                	add    %al,(%rax)
+  802f2f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f35:	00 00                	add    %al,(%rax)
+  802f37:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f3d:	00 00                	add    %al,(%rax)
+  802f3f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f45:	00 00                	add    %al,(%rax)
+  802f47:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f4d:	00 00                	add    %al,(%rax)
+  802f4f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f55:	00 00                	add    %al,(%rax)
+  802f57:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f5d:	00 00                	add    %al,(%rax)
+  802f5f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f65:	00 00                	add    %al,(%rax)
+  802f67:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f6d:	00 00                	add    %al,(%rax)
+  802f6f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f75:	00 00                	add    %al,(%rax)
+  802f77:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f7d:	00 00                	add    %al,(%rax)
+  802f7f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f85:	00 00                	add    %al,(%rax)
+  802f87:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f8d:	00 00                	add    %al,(%rax)
+  802f8f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f95:	00 00                	add    %al,(%rax)
+  802f97:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802f9d:	00 00                	add    %al,(%rax)
+  802f9f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802fa5:	00 00                	add    %al,(%rax)
+  802fa7:	00 b1 09 80 00 00    	add    %dh,0x8009(%rcx)
+  802fad:	00 00                	add    %al,(%rax)
+  802faf:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802fb5:	00 00                	add    %al,(%rax)
+  802fb7:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802fbd:	00 00                	add    %al,(%rax)
+  802fbf:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802fc5:	00 00                	add    %al,(%rax)
+  802fc7:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802fcd:	00 00                	add    %al,(%rax)
+  802fcf:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802fd5:	00 00                	add    %al,(%rax)
+  802fd7:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802fdd:	00 00                	add    %al,(%rax)
+  802fdf:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802fe5:	00 00                	add    %al,(%rax)
+  802fe7:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802fed:	00 00                	add    %al,(%rax)
+  802fef:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802ff5:	00 00                	add    %al,(%rax)
+  802ff7:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  802ffd:	00 00                	add    %al,(%rax)
+  802fff:	00 fd                	add    %bh,%ch
+  803001:	04 80                	add    $0x80,%al
+  803003:	00 00                	add    %al,(%rax)
+  803005:	00 00                	add    %al,(%rax)
+  803007:	00 cc                	add    %cl,%ah
+  803009:	06                   	(bad)
+  80300a:	80 00 00             	addb   $0x0,(%rax)
+  80300d:	00 00                	add    %al,(%rax)
+  80300f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  803015:	00 00                	add    %al,(%rax)
+  803017:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  80301d:	00 00                	add    %al,(%rax)
+  80301f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  803025:	00 00                	add    %al,(%rax)
+  803027:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  80302d:	00 00                	add    %al,(%rax)
+  80302f:	00 2c 05 80 00 00 00 	add    %ch,0x80(,%rax,1)
+  803036:	00 00                	add    %al,(%rax)
+  803038:	8e 0a                	mov    (%rdx),%cs
+  80303a:	80 00 00             	addb   $0x0,(%rax)
+  80303d:	00 00                	add    %al,(%rax)
+  80303f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  803045:	00 00                	add    %al,(%rax)
+  803047:	00 f2                	add    %dh,%dl
+  803049:	04 80                	add    $0x80,%al
+  80304b:	00 00                	add    %al,(%rax)
+  80304d:	00 00                	add    %al,(%rax)
+  80304f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  803055:	00 00                	add    %al,(%rax)
+  803057:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  80305d:	00 00                	add    %al,(%rax)
+  80305f:	00 74 08 80          	add    %dh,-0x80(%rax,%rcx,1)
+  803063:	00 00                	add    %al,(%rax)
+  803065:	00 00                	add    %al,(%rax)
+  803067:	00 3e                	add    %bh,(%rsi)
+  803069:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80306f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  803075:	00 00                	add    %al,(%rax)
+  803077:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  80307d:	00 00                	add    %al,(%rax)
+  80307f:	00 c3                	add    %al,%bl
+  803081:	05 80 00 00 00       	add    $0x80,%eax
+  803086:	00 00                	add    %al,(%rax)
+  803088:	8e 0a                	mov    (%rdx),%cs
+  80308a:	80 00 00             	addb   $0x0,(%rax)
+  80308d:	00 00                	add    %al,(%rax)
+  80308f:	00 a0 07 80 00 00    	add    %ah,0x8007(%rax)
+  803095:	00 00                	add    %al,(%rax)
+  803097:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  80309d:	00 00                	add    %al,(%rax)
+  80309f:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  8030a5:	00 00                	add    %al,(%rax)
+  8030a7:	00 b1 09 80 00 00    	add    %dh,0x8009(%rcx)
+  8030ad:	00 00                	add    %al,(%rax)
+  8030af:	00 8e 0a 80 00 00    	add    %cl,0x800a(%rsi)
+  8030b5:	00 00                	add    %al,(%rax)
+  8030b7:	00 56 04             	add    %dl,0x4(%rsi)
+  8030ba:	80 00 00             	addb   $0x0,(%rax)
+  8030bd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008030c0 <error_string>:
+	...
+  8030c8:	83 2c 80 00 00 00 00 00 95 2c 80 00 00 00 00 00     .,.......,......
+  8030d8:	a5 2c 80 00 00 00 00 00 b7 2c 80 00 00 00 00 00     .,.......,......
+  8030e8:	c5 2c 80 00 00 00 00 00 d9 2c 80 00 00 00 00 00     .,.......,......
+  8030f8:	ee 2c 80 00 00 00 00 00 01 2d 80 00 00 00 00 00     .,.......-......
+  803108:	13 2d 80 00 00 00 00 00 27 2d 80 00 00 00 00 00     .-......'-......
+  803118:	37 2d 80 00 00 00 00 00 4a 2d 80 00 00 00 00 00     7-......J-......
+  803128:	61 2d 80 00 00 00 00 00 77 2d 80 00 00 00 00 00     a-......w-......
+  803138:	8f 2d 80 00 00 00 00 00 a7 2d 80 00 00 00 00 00     .-.......-......
+  803148:	b4 2d 80 00 00 00 00 00 70 31 80 00 00 00 00 00     .-......p1......
+  803158:	c8 2d 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .-..............
+  803168:	e0 2d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .-......file is 
+  803178:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803188:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803198:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8031a8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8031b8:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  8031c8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8031d8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8031e8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8031f8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803208:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803218:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803228:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803238:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803240 <devtab>:
+  803240:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803250:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803260:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803270:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803280:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803290:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8032a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8032b0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8032c0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8032d0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8032e0:	3a 20 00 69 70 63 5f 73 65 6e 64 3a 20 66 61 69     : .ipc_send: fai
+  8032f0:	6c 65 64 20 74 6f 20 73 65 6e 64 00 6c 69 62 2f     led to send.lib/
+  803300:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803310:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803320:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803330:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803340:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803350:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803360:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803370:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803380:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803390:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8033b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8033c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8033e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8033f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803400:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803410:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803420:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803430:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803440:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8034b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8034c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8034d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8034e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8034f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
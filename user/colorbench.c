@@ -0,0 +1,59 @@
+/* Page coloring benchmark.
+ * Reads one cache line per page of a buffer with page-sized stride,
+ * so cache sets used by the buffer depend on page colors only.
+ * Physical memory is scattered first, so that without coloring
+ * buffer pages get random colors and collide in the same sets.
+ * Compare the results with "coloring on" and "coloring off"
+ * set in the kernel monitor. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define SCRATCH_PAGES 512
+#define MAX_PAGES     256
+#define ROUNDS        1000
+
+static uint8_t *const scratch = (uint8_t *)0x10000000;
+static uint8_t *const buffer = (uint8_t *)0x20000000;
+
+/* Free scratch pages in shuffled order to mix up free page lists */
+static void
+scatter_memory(void) {
+    int res = sys_alloc_region(0, scratch, SCRATCH_PAGES * PAGE_SIZE, PROT_RW);
+    if (res < 0) panic("sys_alloc_region: %i", res);
+
+    for (size_t i = 0; i < SCRATCH_PAGES; i++)
+        scratch[i * PAGE_SIZE] = 1;
+
+    /* 167 is coprime with SCRATCH_PAGES, so every page is visited once */
+    for (size_t i = 0; i < SCRATCH_PAGES; i++)
+        sys_unmap_region(0, scratch + (i * 167 % SCRATCH_PAGES) * PAGE_SIZE, PAGE_SIZE);
+}
+
+static uint64_t
+measure(size_t npages) {
+    volatile uint8_t *buf = buffer;
+    int res = sys_alloc_region(0, buffer, npages * PAGE_SIZE, PROT_RW);
+    if (res < 0) panic("sys_alloc_region: %i", res);
+
+    for (size_t i = 0; i < npages; i++)
+        buf[i * PAGE_SIZE] = (uint8_t)i;
+
+    uint64_t start = read_tsc();
+    for (size_t r = 0; r < ROUNDS; r++)
+        for (size_t i = 0; i < npages; i++)
+            (void)buf[i * PAGE_SIZE];
+    uint64_t cycles = read_tsc() - start;
+
+    sys_unmap_region(0, buffer, npages * PAGE_SIZE);
+    return cycles / (ROUNDS * npages);
+}
+
+void
+umain(int argc, char **argv) {
+    scatter_memory();
+
+    cprintf("pages  cycles/access\n");
+    for (size_t npages = 8; npages <= MAX_PAGES; npages *= 2)
+        cprintf("%5zu  %lu\n", npages, (unsigned long)measure(npages));
+}
@@ -0,0 +1,61 @@
+/* Test weighted fair sharing of CPU.
+ * Spins children with different nice values for a few seconds,
+ * every child counts its loop iterations in a shared page.
+ * Iteration counts should be close to the ratio of weights:
+ * each nice step changes CPU share by about 1.25 times.
+ * Expects a single CPU, otherwise children do not compete.
+ * Children also check that they cannot lower their nice value. */
+
+#include <inc/lib.h>
+
+#define NCHILD  4
+#define SECONDS 3
+
+static volatile uint64_t *const counters = (volatile uint64_t *)0x10000000;
+static const int nices[NCHILD] = {0, 0, 3, 5};
+/* Scheduler weights of nices[] (see kern/sched.c) */
+static const uint64_t weights[NCHILD] = {1024, 1024, 526, 335};
+
+void
+umain(int argc, char **argv) {
+    envid_t children[NCHILD];
+
+    int res = sys_alloc_region(0, (void *)counters, PAGE_SIZE, PROT_RW | PROT_SHARE);
+    if (res < 0) panic("sys_alloc_region: %i", res);
+
+    for (int i = 0; i < NCHILD; i++) {
+        if ((children[i] = fork()) < 0) panic("fork: %i", children[i]);
+        if (!children[i]) {
+            while (!counters[NCHILD]) sys_yield();
+            if (sys_env_set_nice(0, nices[i] - 1) != -E_PERM) counters[NCHILD + 1]++;
+            if (sys_env_set_nice(0, nices[i]) < 0) counters[NCHILD + 1]++;
+            for (;;) counters[i]++;
+        }
+        if ((res = sys_env_set_nice(children[i], nices[i])) < 0)
+            panic("sys_env_set_nice: %i", res);
+    }
+
+    int start = sys_gettime();
+    counters[NCHILD] = 1;
+    while (sys_gettime() - start < SECONDS) sys_yield();
+
+    for (int i = 0; i < NCHILD; i++)
+        sys_env_destroy(children[i]);
+
+    if (!counters[0]) panic("child with nice 0 did not run");
+    if (counters[NCHILD + 1]) panic("child could lower its nice value");
+
+    cprintf("nice  iterations  share of nice 0\n");
+    for (int i = 0; i < NCHILD; i++)
+        cprintf("%4d  %10lu  %lu%%\n", nices[i], (unsigned long)counters[i],
+                (unsigned long)(counters[i] * 100 / counters[0]));
+
+    /* Allow 25% deviation from the weight ratio */
+    for (int i = 1; i < NCHILD; i++) {
+        uint64_t expected = counters[0] * weights[i] / weights[0];
+        if (counters[i] * 4 < expected * 3 || counters[i] * 4 > expected * 5)
+            panic("nice %d got %lu iterations, expected about %lu",
+                  nices[i], (unsigned long)counters[i], (unsigned long)expected);
+    }
+    cprintf("fairshare: OK\n");
+}
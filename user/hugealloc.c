@@ -0,0 +1,44 @@
+/* Eagerly backed huge page allocations.
+ * Allocates 2MB page backed region, checks that it is zeroed
+ * and writable, then tries 1GB pages. QEMU is run with -m 512M
+ * by default, so no 1GB block exists and the request must fail
+ * with -E_NO_MEM (or -E_NOT_SUPP if CPU has no 1GB pages).
+ * The success path is only reached with -m 2G or more. */
+
+#include <inc/lib.h>
+
+#define REGION_2M (4 * HUGE_PAGE_SIZE)
+
+static uint64_t *const table2m = (uint64_t *)0x40000000;
+static uint64_t *const table1g = (uint64_t *)0x80000000;
+
+void
+umain(int argc, char **argv) {
+    int res = sys_alloc_region(0, table2m, REGION_2M, PROT_RW | ALLOC_HUGE_2M);
+    if (res < 0) panic("sys_alloc_region(ALLOC_HUGE_2M): %i", res);
+
+    for (size_t i = 0; i < REGION_2M / sizeof(*table2m); i++) {
+        if (table2m[i]) panic("table2m[%zu] is not zero", i);
+        table2m[i] = i;
+    }
+    for (size_t i = 0; i < REGION_2M / sizeof(*table2m); i++)
+        if (table2m[i] != i) panic("table2m[%zu] is corrupted", i);
+    cprintf("2MB pages: OK\n");
+
+    res = sys_alloc_region(0, (void *)table2m + PAGE_SIZE, HUGE_PAGE_SIZE, PROT_RW | ALLOC_HUGE_2M);
+    if (res != -E_INVAL) panic("misaligned ALLOC_HUGE_2M: %i", res);
+
+    res = sys_alloc_region(0, table1g, 1ULL << 30, PROT_RW | ALLOC_HUGE_1G);
+    if (res == -E_NOT_SUPP)
+        cprintf("1GB pages: not supported by CPU\n");
+    else if (res == -E_NO_MEM)
+        cprintf("1GB pages: no free 1GB block (expected with -m 512M)\n");
+    else if (res < 0)
+        panic("sys_alloc_region(ALLOC_HUGE_1G): %i", res);
+    else {
+        table1g[0] = 1;
+        cprintf("1GB pages: OK\n");
+    }
+
+    sys_unmap_region(0, table2m, REGION_2M);
+}
@@ -0,0 +1,43 @@
+/* Test sys_region_advise() hints */
+
+#include <inc/lib.h>
+
+#define NPAGES 64
+
+static uint8_t *const region = (uint8_t *)0x10000000;
+
+void
+umain(int argc, char **argv) {
+    size_t size = NPAGES * PAGE_SIZE;
+    int res = sys_alloc_region(0, region, size, PROT_RW);
+    if (res < 0) panic("sys_alloc_region: %i", res);
+
+    /* Populate whole region at once and fill it */
+    if ((res = sys_region_advise(0, region, size, ADVICE_WILLNEED)) < 0) panic("WILLNEED: %i", res);
+    memset(region, 0xAB, size);
+
+    /* Dropped pages read as zeroes but stay writable */
+    if ((res = sys_region_advise(0, region, size / 2, ADVICE_DONTNEED)) < 0) panic("DONTNEED: %i", res);
+    for (size_t i = 0; i < size; i++)
+        if (region[i] != (i < size / 2 ? 0x00 : 0xAB)) panic("region[%zu] = %02x after DONTNEED", i, region[i]);
+    region[0] = 1;
+
+    /* Persistent hints */
+    if ((res = sys_region_advise(0, region, size, ADVICE_SEQUENTIAL)) < 0) panic("SEQUENTIAL: %i", res);
+    if ((res = sys_region_advise(0, region + PAGE_SIZE, PAGE_SIZE, ADVICE_NOHUGEPAGE)) < 0) panic("NOHUGEPAGE: %i", res);
+    if ((res = sys_region_advise(0, region, size, ADVICE_NORMAL)) < 0) panic("NORMAL: %i", res);
+
+    /* Empty regions must not use up hint slots */
+    for (size_t i = 0; i < 2 * NPAGES; i++)
+        if ((res = sys_region_advise(0, region + (i % NPAGES) * PAGE_SIZE, 0, ADVICE_SEQUENTIAL)) < 0) panic("empty SEQUENTIAL: %i", res);
+    for (size_t i = 0; i < NPAGES; i += 2)
+        if ((res = sys_region_advise(0, region + i * PAGE_SIZE, PAGE_SIZE, ADVICE_HUGEPAGE)) < 0) break;
+    if (res != -E_NO_MEM) panic("hint table is not limited: %i", res);
+    if ((res = sys_region_advise(0, region, size, ADVICE_NORMAL)) < 0) panic("NORMAL: %i", res);
+
+    if (sys_region_advise(0, region + 1, PAGE_SIZE, ADVICE_WILLNEED) != -E_INVAL) panic("misaligned region accepted");
+    if (sys_region_advise(0, region, PAGE_SIZE, -1) != -E_INVAL) panic("unknown advice accepted");
+
+    sys_unmap_region(0, region, size);
+    cprintf("regionadvise: OK\n");
+}